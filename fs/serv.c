@@ -45,8 +45,9 @@ struct OpenFile opentab[MAXOPEN] = {
 	{ 0, 0, 1, 0 }
 };
 
-// Virtual address at which to receive page mappings containing client requests.
-union Fsipc *fsreq = (union Fsipc *)0x0ffff000;
+// Virtual address at which to receive page mappings containing client
+// requests, or the up to IPC_MAXPAGES data pages of a write.
+union Fsipc *fsreq = (union Fsipc *)(DISKMAP - IPC_MAXPAGES * PGSIZE);
 
 void
 serve_init(void)
@@ -197,51 +198,63 @@ serve_set_size(envid_t envid, struct Fsreq_set_size *req)
 	return file_set_size(o->o_file, req->req_size);
 }
 
-// Read at most ipc->read.req_n bytes from the current seek position
-// in ipc->read.req_fileid.  Return the bytes read from the file to
-// the caller in ipc->readRet, then update the seek position.  Returns
-// the number of bytes successfully read, or < 0 on error.
+// Read at most req->req_n bytes from the current seek position in
+// req->req_fileid, and update the seek position.  Rather than copying
+// the bytes, store the runs of file blocks that hold them in 'segs'
+// (at most IPC_MAXPAGES blocks in all), their number in *nsegs, and
+// the offset of the first byte in the first block in *off; the caller
+// replies with the blocks.  Returns the number of bytes read, or < 0
+// on error.
 int
-serve_read(envid_t envid, union Fsipc *ipc)
+serve_read(envid_t envid, struct Fsreq_read *req, struct IpcSeg *segs,
+	   int *nsegs, uint64_t *off)
 {
-	// Look up the file id, read the bytes into 'ret', and update
-	// the seek position.  Be careful if req->req_n > PGSIZE
-	// (remember that read is always allowed to return fewer bytes
-	// than requested).  Also, be careful because ipc is a union,
-	// so filling in ret will overwrite req.
-	//
-	// LAB 5: Your code here
-	struct Fsreq_read *req = &ipc->read;
-	struct Fsret_read *ret = &ipc->readRet;
 	struct OpenFile *o;
 	struct Fd *fd;
-	int r, bytes_to_read;
-	size_t bytes_read;
-	
-	//the amount of bytes we need to read is in req.req_n
-	bytes_to_read = MIN(req->req_n,PGSIZE);
-	// look up the file id, and store the OpenFile struct in *o.
-	r = openfile_lookup(envid,req->req_fileid,&o);
-	if (r < 0)
-		return r;
-	//store the OpenFile's pointer to its *Fd struct for later
-	fd = o->o_fd;
-	//make the call to file_read.
-	bytes_read = file_read(o->o_file, ret, bytes_to_read, fd->fd_offset);	
-	// in the case of error, return the amount of bytes read without updating the offset.
-	if (bytes_read < 0)
-		return bytes_read;
-	//update the offset of the Fd struct
-	fd->fd_offset += bytes_read;
+	struct IpcSeg *seg;
+	off_t pos, end;
+	size_t count;
+	char *blk;
+	int r, bn;
+
 	if (debug)
 		cprintf("serve_read %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
-	
-	return bytes_read;
+
+	*nsegs = 0;
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	fd = o->o_fd;
+	pos = fd->fd_offset;
+	*off = pos % BLKSIZE;
+	if (pos >= o->o_file->f_size)
+		return 0;
+
+	count = MIN(req->req_n, IPC_MAXPAGES * BLKSIZE - *off);
+	end = MIN(o->o_file->f_size, pos + count);
+	for (bn = pos / BLKSIZE; bn * BLKSIZE < end; bn++) {
+		if ((r = file_get_block(o->o_file, bn, &blk)) < 0)
+			return r;
+		// Only mapped blocks can be sent.
+		if (!va_is_mapped(blk))
+			(void) *(volatile char *) blk;
+		seg = *nsegs ? &segs[*nsegs - 1] : NULL;
+		if (seg && seg->seg_va + seg->seg_npages * BLKSIZE
+		    == (uintptr_t) blk) {
+			seg->seg_npages++;
+			continue;
+		}
+		seg = &segs[(*nsegs)++];
+		seg->seg_va = (uintptr_t) blk;
+		seg->seg_npages = 1;
+	}
+
+	fd->fd_offset = end;
+	return end - pos;
 }
 
 
-// Write req->req_n bytes from req->req_buf to req_fileid, starting at
-// the current seek position, and update the seek position
+// Write req->req_n bytes, sent as pages at fsreq, to req_fileid,
+// starting at the current seek position, and update the seek position
 // accordingly.  Extend the file if necessary.  Returns the number of
 // bytes written, or < 0 on error.
 int
@@ -254,8 +267,9 @@ serve_write(envid_t envid, struct Fsreq_write *req)
 	struct Fd *fd;
 	int r, bytes_to_write;
 	size_t bytes_written;
-	//the amount of bytes we need to write is in req.req_n
-	bytes_to_write = req->req_n;
+	//the amount of bytes we need to write is in req.req_n, but no
+	//more than came in pages
+	bytes_to_write = MIN(req->req_n, thisenv->env_ipc_npages * PGSIZE);
 	// look up the file id, and store the OpenFile struct in *o.
 	r = openfile_lookup(envid,req->req_fileid,&o);
 	if (r < 0)
@@ -263,7 +277,7 @@ serve_write(envid_t envid, struct Fsreq_write *req)
 	//store the OpenFile's pointer to its *Fd struct for later
 	fd = o->o_fd;
 	//make the call to file_write.
-	bytes_written = file_write(o->o_file, req->req_buf,bytes_to_write, fd->fd_offset);
+	bytes_written = file_write(o->o_file, fsreq, bytes_to_write, fd->fd_offset);
 
 	// in the case of error, return the error without updating the offset.
 	if (bytes_written < 0)
@@ -349,9 +363,9 @@ serve_sync(envid_t envid, union Fsipc *req)
 typedef int (*fshandler)(envid_t envid, union Fsipc *req);
 
 fshandler handlers[] = {
-	// Open is handled specially because it passes pages
+	// Open and read are handled specially because they pass pages
 	/* [FSREQ_OPEN] =	(fshandler)serve_open, */
-	[FSREQ_READ] =		serve_read,
+	/* [FSREQ_READ] =	(fshandler)serve_read, */
 	[FSREQ_STAT] =		serve_stat,
 	[FSREQ_FLUSH] =		(fshandler)serve_flush,
 	[FSREQ_SET_SIZE] =	(fshandler)serve_set_size,
@@ -364,37 +378,63 @@ fshandler handlers[] = {
 void
 serve(void)
 {
-	uint32_t req, whom;
-	int perm, r;
-	void *pg;
+	uint32_t req, whom = 0;
+	int perm = 0, r = 0;
+	void *pg = NULL;
+	uint64_t words[IPC_NWORDS];
+	union Fsipc *args;
+	static struct IpcSeg segs[IPC_MAXPAGES];
+	int nsegs;
 
 	while (1) {
-		perm = 0;
-		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+		// Reply to the last request (if any) and wait for the next
+		// one in a single system call.
+		req = ipc_reply_recv(whom, r, pg, perm, (int32_t *) &whom,
+				     IPC_WINDOW(fsreq, IPC_MAXPAGES), &perm,
+				     words);
 		if (debug)
 			cprintf("fs req %d from %08x [page %08x: %s]\n",
 				req, whom, uvpt[PGNUM(fsreq)], fsreq);
 
-		// All requests must contain an argument page
-		if (!(perm & PTE_P)) {
+		// All requests must contain an argument page, except the
+		// small ones sent in registers by fsipc_words, and reads
+		// and writes, whose pages (if any) hold data.
+		args = fsreq;
+		if (req == FSREQ_FLUSH || req == FSREQ_SET_SIZE
+		    || req == FSREQ_SYNC || req == FSREQ_READ
+		    || req == FSREQ_WRITE) {
+			args = (union Fsipc *) words;
+		} else if (!(perm & PTE_P)) {
 			cprintf("Invalid request from %08x: no argument page\n",
 				whom);
+			// Reply to no one, with nothing.
+			whom = 0;
+			pg = NULL;
+			perm = 0;
+			r = 0;
 			continue; // just leave it hanging...
 		}
 
 		pg = NULL;
 		if (req == FSREQ_OPEN) {
 			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+		} else if (req == FSREQ_READ) {
+			r = serve_read(whom, &args->read, segs, &nsegs, &words[0]);
+			pg = nsegs ? segs : NULL;
+			perm = PTE_P | PTE_U | IPC_PERM_SEGS(nsegs)
+				| IPC_PERM_WORDS(1);
 		} else if (req < NHANDLERS && handlers[req]) {
-			r = handlers[req](whom, fsreq);
+			r = handlers[req](whom, args);
 		} else {
 			cprintf("Invalid request code %d from %08x\n", req, whom);
 			r = -E_INVAL;
 		}
-		ipc_send(whom, r, pg, perm);
+		// Let go of the request's pages (its argument page, or a
+		// write's bytes) rather than keep them until the next one.
+		if (thisenv->env_ipc_npages)
+			ipc_unmap_window(fsreq, thisenv->env_ipc_npages);
 		if(debug)
-			cprintf("FS: Sent response %d to %x\n", r, whom);
-		sys_page_unmap(0, fsreq);
+			cprintf("FS: Sending response %d to %x\n", r, whom);
 	}
 }
 
@@ -405,6 +445,9 @@ umain(int argc, char **argv)
 	binaryname = "fs";
 	cprintf("FS is running\n");
 
+	// Clients block on us; don't let CPU-bound envs get ahead.
+	sys_env_set_priority(0, 0);
+
 	// Check that we are able to do I/O
 	outw(0x8A00, 0x8A00);
 	cprintf("FS can do I/O\n");
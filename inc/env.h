@@ -40,6 +40,12 @@ enum {
 	ENV_NOT_RUNNABLE
 };
 
+// Scheduler priority levels.  Level 0 is the highest.  Envs start at
+// level 0 and move between levels according to how they use the CPU,
+// unless pinned to a level with sys_env_set_priority.
+#define ENV_NPRIO		4
+#define ENV_PRIO_DYNAMIC	(-1)	// Not pinned to any level
+
 // Special environment types
 enum EnvType {
 	ENV_TYPE_USER = 0,
@@ -57,6 +63,17 @@ struct Env {
 	uint32_t env_runs;			// Number of times environment has run
 	int env_cpunum;				// The CPU that the env is running on
 
+	// Scheduling
+	struct Env *env_rq_next;	// Next env on the same run queue
+	int env_rq_cpu;				// CPU whose run queue holds us, or -1
+	int env_prio;				// Current priority level
+	int env_prio_pinned;		// Pinned level, or ENV_PRIO_DYNAMIC
+	struct Env *env_sleep_next;	// Next env on the same sleep queue
+	int env_sleep_cpu;			// CPU whose sleep queue holds us, or -1
+	uint64_t env_wakeup;		// TSC value at which a timed sleep ends
+	uint32_t env_affinity;		// Mask of CPUs the env may run on
+	uint32_t env_migrations;	// Times the env moved to another CPU
+
 	// Address space
 	pml4e_t *env_pml4e;			// Kernel virtual address of top-level page dir,
 								// or root of extended page tables in guest mode.
@@ -67,10 +84,28 @@ struct Env {
 
 	// Lab 4 IPC
 	bool env_ipc_recving;		// Env is blocked receiving
-	void *env_ipc_dstva;		// VA at which to map received page
+	void *env_ipc_dstva;		// Window at which to map received pages
 	uint32_t env_ipc_value;		// Data value sent to us
 	envid_t env_ipc_from;		// envid of the sender
+	envid_t env_ipc_recv_from;	// Only receiving from this env (its
+					// reply to sys_ipc_call), or 0
 	int env_ipc_perm;			// Perm of page mapping received
+	int env_ipc_nwords;			// Register words received
+	int env_ipc_npages;			// Pages received
+
+	// Blocking send (kern/ipc.c)
+	struct Env *env_ipc_senders;	// Envs blocked sending to us, oldest first
+	struct Env *env_ipc_senders_tail;
+	struct Env *env_ipc_send_next;	// Next env on the same send queue
+	struct Env *env_ipc_send_queue;	// Env whose send queue we are on, or NULL
+	envid_t env_ipc_send_to;	// Env we are blocked sending to, or 0
+	uint32_t env_ipc_send_value;	// The message we are sending
+	void *env_ipc_send_srcva;
+	int env_ipc_send_perm;
+	struct Env *env_ipc_callers;	// Envs waiting for our reply
+	struct Env *env_ipc_call_next;	// Neighbours on the same list
+	struct Env *env_ipc_call_prev;
+	struct Env *env_ipc_call_queue;	// Env whose reply we wait for, or NULL
 	uint8_t *elf;
 };
 
@@ -62,7 +62,9 @@ struct Super {
 enum {
 	FSREQ_OPEN = 1,
 	FSREQ_SET_SIZE,
-	// Read returns a Fsret_read on the request page
+	// Read and write send their request in registers, and the bytes
+	// read or written as pages: read maps the file blocks holding the
+	// bytes, and returns the offset of the first in a register word
 	FSREQ_READ,
 	FSREQ_WRITE,
 	// Stat returns a Fsret_stat on the request page
@@ -85,13 +87,9 @@ union Fsipc {
 		int req_fileid;
 		size_t req_n;
 	} read;
-	struct Fsret_read {
-		char ret_buf[PGSIZE];
-	} readRet;
 	struct Fsreq_write {
 		int req_fileid;
 		size_t req_n;
-		char req_buf[PGSIZE - (sizeof(int) + sizeof(size_t))];
 	} write;
 	struct Fsreq_stat {
 		int req_fileid;
@@ -58,8 +58,21 @@ int	sys_page_map(envid_t src_env, void *src_pg,
 		     envid_t dst_env, void *dst_pg, int perm);
 int	sys_page_unmap(envid_t env, void *pg);
 int	sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, int perm);
+int	sys_ipc_send(envid_t to_env, uint64_t value, void *pg, int perm);
 int	sys_ipc_recv(void *rcv_pg);
+int	sys_ipc_call(envid_t to_env, uint64_t value, void *pg, int perm,
+		     void *rcv_pg, uint64_t *words);
+int	sys_ipc_reply_recv(envid_t to_env, uint64_t value, void *pg, int perm,
+			   void *rcv_pg, uint64_t *words);
 unsigned int sys_time_msec(void);
+int	sys_env_set_priority(envid_t env, int prio);
+int	sys_env_set_affinity(envid_t env, uint32_t mask);
+int	sys_sleep_usec(uint64_t usec);
+int	sys_page_alloc_huge(envid_t env, void *pg, int perm);
+int	sys_page_map_batch(const struct PageOp *ops, size_t n);
+int	sys_page_alloc_batch(const struct PageOp *ops, size_t n);
+int	sys_page_unmap_batch(const struct PageOp *ops, size_t n);
+envid_t	sys_fork(void);
 
 // This must be inlined.  Exercise for reader: why?
 static __inline envid_t __attribute__((always_inline))
@@ -77,12 +90,24 @@ sys_exofork(void)
 // ipc.c
 void	ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+int32_t ipc_call(envid_t to_env, uint32_t value, void *pg, int perm,
+		 void *rcv_pg, int *perm_store);
+int32_t ipc_callw(envid_t to_env, uint32_t value, const void *msg,
+		  size_t len);
+int32_t ipc_callv(envid_t to_env, uint32_t value, uint64_t *words,
+		  int nwords, const struct IpcSeg *segs, int nsegs, int perm,
+		  void *rcv_window, int rcv_npages);
+int32_t ipc_reply_recv(envid_t to_env, uint32_t value, void *pg, int perm,
+		       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+		       uint64_t *words_store);
+int	ipc_map_window(void *va, int npages);
+int	ipc_unmap_window(void *va, int npages);
 envid_t	ipc_find_env(enum EnvType type);
 
 
 // fork.c
-#define	PTE_SHARE	0x400
 envid_t	fork(void);
+envid_t	ufork(void);
 envid_t	sfork(void);	// Challenge!
 
 // fd.c
@@ -142,6 +167,9 @@ int	pipeisclosed(int pipefd);
 // wait.c
 void	wait(envid_t env);
 
+// bench.c
+unsigned bench_workers(int n, void (*fn)(int id));
+
 /* File open modes */
 #define	O_RDONLY	0x0000		/* open for reading only */
 #define	O_WRONLY	0x0001		/* open for writing only */
@@ -140,6 +140,8 @@
 // Used for temporary page mappings for the user page-fault handler
 // (should not conflict with other temporary page mappings)
 #define PFTEMP		(UTEMP + PTSIZE - PGSIZE)
+// Used for temporary 2MB page mappings for the user page-fault handler
+#define HUGETEMP	(UTEMP + PTSIZE)
 // The location of the user-level STABS data structure
 #define USTABDATA	(PTSIZE)
 
@@ -195,6 +197,25 @@ struct PageInfo {
 	// Pages allocated at boot time using pmap.c's
 	// boot_alloc do not have valid reference count fields.
 	uint16_t pp_ref;
+
+	// For the first page of a free block in the buddy allocator:
+	// the block's order, and the previous block on its free list.
+	bool pp_free;
+	uint8_t pp_order;
+
+	// For a PML4 page: bumped whenever a mapping in its address space
+	// is removed or changed, so that CPUs holding TLB entries for it
+	// under a PCID know to flush them (see kern/pmap.c).
+	uint32_t pp_tlb_gen;
+
+	union {
+		// Free block: the previous block on its free list.
+		struct PageInfo *pp_prev;
+		// Page directory pointer table, page directory or page
+		// table of a user address space: the number of its
+		// entries that are present (see page_remove).
+		uint64_t pp_live;
+	};
 };
 
 #endif /* !__ASSEMBLER__ */
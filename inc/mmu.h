@@ -62,6 +62,8 @@
 #define PTSIZE		(PGSIZE*NPTENTRIES) // bytes mapped by a page directory entry
 #define PTSHIFT		21		// log2(PTSIZE)
 
+#define PDPSIZE		(PTSIZE*NPDENTRIES) // bytes mapped by a page directory pointer entry
+
 #define PTXSHIFT	12		// offset of PTX in a linear address
 #define PDXSHIFT	21		// offset of PDX in a linear address
 #define PDPESHIFT	30		// offset of PTPE in a linear address
@@ -76,12 +78,23 @@
 #define PTE_A		0x020	// Accessed
 #define PTE_D		0x040	// Dirty
 #define PTE_PS		0x080	// Page Size
+#define PTE_G		0x100	// Global (kept across CR3 loads)
 #define PTE_MBZ		0x180	// Bits must be zero
 
 // The PTE_AVAIL bits aren't used by the kernel or interpreted by the
 // hardware, so user processes are allowed to set them arbitrarily.
 #define PTE_AVAIL	0xE00	// Available for software use
 
+// Of those, fork (lib/fork.c and sys_fork) gives these a meaning:
+#define PTE_SHARE	0x400	// Shared with the child, not copied
+#define PTE_COW		0x800	// Copy-on-write
+
+// For sys_page_alloc: map the kernel's zero page instead of a new one
+// (copy-on-write if PTE_W); a page is allocated on the first write.
+// Never set in a PTE: it lies above the flag bits, outside PTE_SYSCALL,
+// so no other system call accepts it.
+#define PTE_LAZY	0x1000
+
 // Flags in PTE_SYSCALL may be used only in system calls. (Others may not.)
 #define PTE_SYSCALL (PTE_AVAIL | PTE_P | PTE_W | PTE_U)
 
@@ -115,6 +128,13 @@
 
 // x86_64 related flags
 #define CR4_PAE		0x00000020
+#define CR4_PGE		0x00000080	// Global pages
+#define CR4_PCIDE	0x00020000	// Process-context identifiers
+
+// With CR4_PCIDE, the low 12 bits of CR3 are the PCID, and loading CR3
+// with CR3_NOFLUSH set keeps the TLB entries tagged with that PCID.
+#define CR3_PCID	0xFFF
+#define CR3_NOFLUSH	(1ULL << 63)
 #define EFER_MSR	0xC0000080
 #define EFER_LME	8
 
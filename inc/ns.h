@@ -14,7 +14,8 @@ struct jif_pkt {
 
 // Definitions for requests from clients to network server
 enum {
-	// The following messages pass a page containing an Nsipc.
+	// The following messages pass a page containing an Nsipc, except
+	// shutdown, close, listen and send, which pass theirs in registers.
 	// Accept returns a Nsret_accept on the request page.
 	NSREQ_ACCEPT = 1,
 	NSREQ_BIND,
@@ -37,6 +38,9 @@ enum {
 	NSREQ_TIMER,
 };
 
+// The most pages of data one NSREQ_SEND carries.
+#define NSSEND_MAXPAGES	16
+
 union Nsipc {
 	struct Nsreq_accept {
 		int req_s;
@@ -83,11 +87,12 @@ union Nsipc {
 		char ret_buf[0];
 	} recvRet;
 
+	// Sent in registers, with the bytes in up to NSSEND_MAXPAGES
+	// pages (see nsipc_send)
 	struct Nsreq_send {
 		int req_s;
 		int req_size;
 		unsigned int req_flags;
-		char req_buf[0];
 	} send;
 
 	struct Nsreq_socket {
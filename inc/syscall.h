@@ -1,6 +1,8 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
+
 /* system call numbers */
 enum {
 	SYS_cputs = 0,
@@ -18,7 +20,55 @@ enum {
 	SYS_ipc_try_send,
 	SYS_ipc_recv,
 	SYS_time_msec,
+	SYS_env_set_priority,
+	SYS_env_set_affinity,
+	SYS_sleep_usec,
+	SYS_page_alloc_huge,
+	SYS_page_map_batch,
+	SYS_page_alloc_batch,
+	SYS_page_unmap_batch,
+	SYS_fork,
+	SYS_ipc_send,
+	SYS_ipc_call,
+	SYS_ipc_reply_recv,
 	NSYSCALLS
 };
 
+// One operation of the SYS_page_*_batch system calls.  The alloc and
+// unmap variants only use dstenvid, dstva and (for alloc) perm.
+struct PageOp {
+	int32_t srcenvid;	// envid_t
+	int32_t dstenvid;
+	uintptr_t srcva;
+	uintptr_t dstva;
+	int perm;
+};
+
+// Operations the kernel copies in at a time.
+#define PAGE_BATCH_CHUNK	32
+
+// Besides its 32-bit value and optional page, an IPC message can carry
+// up to IPC_NWORDS 64-bit words in registers r8-r13, which the kernel
+// copies from the sender's registers to the receiver's.  The sender
+// gives their number in the perm argument, as IPC_PERM_WORDS(n).
+#define IPC_NWORDS		6
+#define IPC_NWORDS_SHIFT	16
+#define IPC_PERM_WORDS(n)	((n) << IPC_NWORDS_SHIFT)
+
+// In place of its single page, a message can carry a vector of up to
+// IPC_MAXPAGES pages in all: with IPC_PERM_SEGS(n) in perm, srcva
+// points to an array of n struct IpcSeg, each a run of pages, which
+// are mapped in order into the receiver's window.  A receiver asks
+// for a window of n pages by passing IPC_WINDOW(dstva, n) as dstva;
+// pages that do not fit in it are not mapped.
+#define IPC_MAXPAGES		64
+#define IPC_NSEGS_SHIFT		20
+#define IPC_PERM_SEGS(n)	((n) << IPC_NSEGS_SHIFT)
+#define IPC_WINDOW(va, n)	((void *) ((uintptr_t) (va) | ((n) - 1)))
+
+struct IpcSeg {
+	uintptr_t seg_va;	// Page-aligned start of the run
+	size_t seg_npages;
+};
+
 #endif /* !JOS_INC_SYSCALL_H */
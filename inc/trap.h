@@ -39,6 +39,10 @@
 #define IRQ_IDE         14
 #define IRQ_ERROR       19
 
+// Inter-processor interrupts, sent with lapic_ipi_cpu.
+#define IRQ_RESCHED     20		// Run queue of a halted or busy CPU changed
+#define IRQ_TLB         21		// Flush TLB entries another CPU invalidated
+
 #ifndef __ASSEMBLER__
 
 #include <inc/types.h>
@@ -8,10 +8,45 @@
 
 #include <kern/console.h>
 #include <kern/picirq.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
 
 static void cons_intr(int (*proc)(void));
 static void cons_putc(int c);
 
+// Serializes the output devices and the input buffer across CPUs.  It
+// never waits on another lock.  The CPU holding it may take it again
+// (a cprintf while printing, a panic inside the console code), so it
+// counts how deeply the owner has taken it.
+static struct spinlock console_lock = {
+#ifdef DEBUG_SPINLOCK
+	.name = "console_lock"
+#endif
+};
+static int console_owner = -1;
+static int console_depth;
+
+void
+cons_lock(void)
+{
+	if (console_owner == cpunum()) {
+		console_depth++;
+		return;
+	}
+	spin_lock(&console_lock);
+	console_owner = cpunum();
+	console_depth = 1;
+}
+
+void
+cons_unlock(void)
+{
+	if (--console_depth > 0)
+		return;
+	console_owner = -1;
+	spin_unlock(&console_lock);
+}
+
 // Stupid I/O delay routine necessitated by historical PC design flaws
 static void
 delay(void)
@@ -399,6 +434,7 @@ cons_intr(int (*proc)(void))
 {
 	int c;
 
+	cons_lock();
 	while ((c = (*proc)()) != -1) {
 		if (c == 0)
 			continue;
@@ -406,6 +442,7 @@ cons_intr(int (*proc)(void))
 		if (cons.wpos == CONSBUFSIZE)
 			cons.wpos = 0;
 	}
+	cons_unlock();
 }
 
 // return the next input character from the console, or 0 if none waiting
@@ -421,13 +458,15 @@ cons_getc(void)
 	kbd_intr();
 
 	// grab the next character from the input buffer.
+	c = 0;
+	cons_lock();
 	if (cons.rpos != cons.wpos) {
 		c = cons.buf[cons.rpos++];
 		if (cons.rpos == CONSBUFSIZE)
 			cons.rpos = 0;
-		return c;
 	}
-	return 0;
+	cons_unlock();
+	return c;
 }
 
 // output a character to the console
@@ -457,7 +496,9 @@ cons_init(void)
 void
 cputchar(int c)
 {
+	cons_lock();
 	cons_putc(c);
+	cons_unlock();
 }
 
 int
@@ -22,5 +22,7 @@ int cons_getc(void);
 
 void kbd_intr(void); // irq 1
 void serial_intr(void); // irq 4
+void cons_lock(void);
+void cons_unlock(void);
 
 #endif /* _CONSOLE_H_ */
@@ -16,11 +16,44 @@
 #include <kern/sched.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/tlb.h>
+#include <kern/ipc.h>
 
 struct Env *envs = NULL;			// All environments
 static struct Env *env_free_list;	// Free environment list
 									// (linked by Env->env_link)
 
+// Kernel locking.  There is no big kernel lock around traps; instead:
+//
+//   env_locks[i]	envs[i]'s status, IPC fields, trap frame, page tables
+//			and scheduling parameters.  Kept outside struct Env,
+//			which inc/env.h shares with user space, as struct
+//			spinlock is a kernel-only type (kern/spinlock.h).
+//   ipc_wait_locks[i]	envs[i]'s queues of blocked senders and callers
+//			(kern/ipc.c)
+//   run queue locks	each CPU's run and sleep queues (kern/sched.c)
+//   kmem_cache locks	each slab cache's slabs (kern/kmem.c)
+//   pt_share_lock	page tables shared by fork (kern/pmap.c)
+//   page_mag locks	each CPU's magazine of free pages (kern/pmap.c)
+//   page_lock		the physical page free lists (kern/pmap.c)
+//   page_zero_lock	the pool of pre-zeroed pages (kern/pmap.c)
+//   env_table_lock	env_free_list and env_id generation
+//   kmem_lock		the list of slab caches (kern/kmem.c)
+//   console_lock	the console devices (kern/console.c)
+//
+// Locks are taken in that order; a CPU holding two env locks took the
+// one with the lower envs[] index first (see env_lock_pair).
+// env_table_lock, kmem_lock and console_lock are never held while
+// taking another lock.  kernel_lock now only holds the APs back until
+// the BSP has finished booting, and keeps CPUs with nothing left to run
+// out of the kernel monitor one at a time.
+static struct spinlock env_locks[NENV];
+static struct spinlock env_table_lock = {
+#ifdef DEBUG_SPINLOCK
+	.name = "env_table_lock"
+#endif
+};
+
 #define ENVGENSHIFT	12		// >= LOGNENV
 
 // Global descriptor table.
@@ -112,6 +145,69 @@ envid2env(envid_t envid, struct Env **env_store, bool checkperm)
 	return 0;
 }
 
+void
+env_lock(struct Env *e)
+{
+	spin_lock(&env_locks[e - envs]);
+}
+
+void
+env_unlock(struct Env *e)
+{
+	spin_unlock(&env_locks[e - envs]);
+}
+
+// Lock both 'a' and 'b', which may be the same env.
+void
+env_lock_pair(struct Env *a, struct Env *b)
+{
+	if (a == b) {
+		env_lock(a);
+	} else if (a < b) {
+		env_lock(a);
+		env_lock(b);
+	} else {
+		env_lock(b);
+		env_lock(a);
+	}
+}
+
+void
+env_unlock_pair(struct Env *a, struct Env *b)
+{
+	env_unlock(a);
+	if (a != b)
+		env_unlock(b);
+}
+
+// Once 'e', found by envid2env(envid, ...), is locked: is it still the
+// env that envid names?  It may have been freed, and its slot reused,
+// while this CPU waited for the lock.
+bool
+env_is_live(struct Env *e, envid_t envid)
+{
+	return e->env_status != ENV_FREE && (envid == 0 || e->env_id == envid);
+}
+
+// envid2env, returning the env locked.
+int
+envid2env_lock(envid_t envid, struct Env **env_store, bool checkperm)
+{
+	struct Env *e;
+	int r;
+
+	if ((r = envid2env(envid, &e, checkperm)) < 0)
+		return r;
+	env_lock(e);
+	if (!env_is_live(e, envid)) {
+		env_unlock(e);
+		*env_store = 0;
+		return -E_BAD_ENV;
+	}
+	*env_store = e;
+	return 0;
+}
+
 // Mark all environments in 'envs' as free, set their env_ids to 0,
 // and insert them into the env_free_list.
 // Make sure the environments are in the free list in the same order
@@ -125,9 +221,15 @@ env_init(void)
 	env_free_list = &envs[0]; // == envs
 	int i = 1;
 	envs[0].env_id = 0;
+	envs[0].env_rq_cpu = -1;
+	envs[0].env_sleep_cpu = -1;
+	spin_initlock(&env_locks[0]);
 	for (; i < NENV; i++){
 		envs[i-1].env_link = &envs[i];
 		envs[i].env_id = 0;
+		envs[i].env_rq_cpu = -1;
+		envs[i].env_sleep_cpu = -1;
+		spin_initlock(&env_locks[i]);
 	}
 	
 	// Per-CPU part of the initialization
@@ -211,7 +313,7 @@ env_setup_vm(struct Env *e)
 	//..which should be in boot_pml4
 	e->env_pml4e[PML4(UTOP)] = boot_pml4[PML4(UTOP)];
 	e->env_cr3 = page2pa(p);
-	p->pp_ref += 1;	
+	page_incref(p);
 
 	// UVPT maps the env's own page table read-only.
 	// Permissions: kernel R, user R
@@ -224,6 +326,8 @@ env_setup_vm(struct Env *e)
 //
 // Allocates and initializes a new environment.
 // On success, the new environment is stored in *newenv_store.
+// It is ENV_NOT_RUNNABLE; the caller makes it runnable once it is
+// ready to run.
 //
 // Returns 0 on success, < 0 on failure.  Errors include:
 //	-E_NO_FREE_ENV if all NENVS environments are allocated
@@ -236,12 +340,22 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	int r;
 	struct Env *e;
 
-	if (!(e = env_free_list))
+	spin_lock(&env_table_lock);
+	if (!(e = env_free_list)) {
+		spin_unlock(&env_table_lock);
 		return -E_NO_FREE_ENV;
+	}
+	env_free_list = e->env_link;
+	spin_unlock(&env_table_lock);
 
 	// Allocate and set up the page directory for this environment.
-	if ((r = env_setup_vm(e)) < 0)
+	if ((r = env_setup_vm(e)) < 0) {
+		spin_lock(&env_table_lock);
+		e->env_link = env_free_list;
+		env_free_list = e;
+		spin_unlock(&env_table_lock);
 		return r;
+	}
 
 	// Generate an env_id for this environment.
 	generation = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
@@ -252,8 +366,11 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 	// Set the basic status variables.
 	e->env_parent_id = parent_id;
 	e->env_type = ENV_TYPE_USER;
-	e->env_status = ENV_RUNNABLE;
 	e->env_runs = 0;
+	e->env_prio = 0;
+	e->env_prio_pinned = ENV_PRIO_DYNAMIC;
+	e->env_affinity = ~0;
+	e->env_migrations = 0;
 
 	// Clear out all the saved register state,
 	// to prevent the register values
@@ -286,9 +403,13 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
 	// Also clear the IPC receiving flag.
 	e->env_ipc_recving = 0;
+	e->env_ipc_send_to = 0;
 
-	// commit the allocation
-	env_free_list = e->env_link;
+	// Publish the env: until now its status was ENV_FREE, so nothing
+	// that found its slot (envid2env, a stale run queue entry) used it.
+	env_lock(e);
+	e->env_status = ENV_NOT_RUNNABLE;
+	env_unlock(e);
 	*newenv_store = e;
 
 	// cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
@@ -435,9 +556,16 @@ env_create(uint8_t *binary, enum EnvType type)
 	//FL_IOPL_MASK
 		newenv->env_tf.tf_eflags |= FL_IOPL_MASK;	
 	}
+
+	env_lock(newenv);
+	newenv->env_status = ENV_RUNNABLE;
+	sched_enqueue(newenv);
+	env_unlock(newenv);
 }
 //
 // Frees env e and all memory it uses.
+// The caller holds e's lock, which env_free releases as soon as e is
+// marked ENV_FREE: from then on no other CPU will touch e.
 //
 void
 env_free(struct Env *e)
@@ -445,24 +573,46 @@ env_free(struct Env *e)
 	pte_t *pt;
 	uint64_t pdeno, pteno;
 	physaddr_t pa;
+	int i;
 
 
 	// If freeing the current environment, switch to the kernel page table
 	// before freeing the environments page table, just in case the pages
 	// get reused.
-	if (e == curenv)
+	if (e == curenv) {
+		tlb_set_loaded(NULL);
 		lcr3(boot_cr3);
+	}
+
+	// A sleeping env must not be woken up once its slot is reused.
+	sched_cancel_sleep(e);
+	ipc_cancel_send(e);
+	e->env_status = ENV_FREE;
+	env_unlock(e);
+	ipc_wake_senders(e);
+
+	// A CPU that was running e may still be on its way into the
+	// scheduler with e's page tables loaded (curenv is switched only
+	// after cr3 is).  Wait for it to leave them, serving its TLB
+	// shootdown meanwhile: it may be waiting for us in tlb_shootdown.
+	for (i = 0; i < ncpu; i++)
+		while (&cpus[i] != thiscpu && cpus[i].cpu_env == e) {
+			tlb_serve();
+			asm volatile("pause");
+		}
 
 	// Note the environment's demise.
 	// cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 
-	// Flush all mapped pages in the user portion of the address space
+	// Flush all mapped pages in the user portion of the address space.
+	// Tables whose last page was unmapped are gone already (page_remove),
+	// possibly all of them.
 	pdpe_t *env_pdpe = KADDR(PTE_ADDR(e->env_pml4e[0]));
 	int pdeno_limit;
 	uint64_t pdpe_index;
 	// using 3 instead of NPDPENTRIES as we have only first three indices
 	// set for 4GB of address space.
-	for(pdpe_index=0;pdpe_index<=3;pdpe_index++){
+	for(pdpe_index=0;pdpe_index<=3 && (e->env_pml4e[0] & PTE_P);pdpe_index++){
 		if(!(env_pdpe[pdpe_index] & PTE_P))
 			continue;
 		pde_t *env_pgdir = KADDR(PTE_ADDR(env_pdpe[pdpe_index]));
@@ -475,12 +625,28 @@ env_free(struct Env *e)
 				continue;
 			// find the pa and va of the page table
 			pa = PTE_ADDR(env_pgdir[pdeno]);
+
+			// a 2MB page has no page table
+			if (env_pgdir[pdeno] & PTE_PS) {
+				env_pgdir[pdeno] = 0;
+				page_decref(pa2page(pa));
+				continue;
+			}
+			// a page table still shared with a fork relative
+			// keeps its pages for them
+			if (page_table_put(&env_pgdir[pdeno]))
+				continue;
 			pt = (pte_t*) KADDR(pa);
 
-			// unmap all PTEs in this page table
+			// unmap all PTEs in this page table.  No CPU has
+			// the address space loaded any more, and it gets a
+			// new TLB generation below, so there is nothing to
+			// invalidate; page_remove would also free the table
+			// under us.
 			for (pteno = 0; pteno < PTX(~0); pteno++) {
 				if (pt[pteno] & PTE_P){
-					page_remove(e->env_pml4e, PGADDR((uint64_t)0,pdpe_index,pdeno, pteno, 0));
+					page_decref(pa2page(PTE_ADDR(pt[pteno])));
+					pt[pteno] = 0;
 				}
 			}
 
@@ -494,18 +660,23 @@ env_free(struct Env *e)
 		page_decref(pa2page(pa));
 	}
 	// free the page directory pointer
-	page_decref(pa2page(PTE_ADDR(e->env_pml4e[0])));
+	if (e->env_pml4e[0] & PTE_P)
+		page_decref(pa2page(PTE_ADDR(e->env_pml4e[0])));
 	// free the page map level 4 (PML4)
 	e->env_pml4e[0] = 0;
 	pa = e->env_cr3;
+	// CPUs still holding TLB entries for it under a PCID must flush
+	// them if the page is reused as another env's PML4 (pmap_load).
+	page_tlb_gen_bump(pa2page(pa));
 	e->env_pml4e = 0;
 	e->env_cr3 = 0;
 	page_decref(pa2page(pa));
 
 	// return the environment to the free list
-	e->env_status = ENV_FREE;
+	spin_lock(&env_table_lock);
 	e->env_link = env_free_list;
 	env_free_list = e;
+	spin_unlock(&env_table_lock);
 }
 
 //
@@ -516,11 +687,21 @@ env_free(struct Env *e)
 void
 env_destroy(struct Env *e)
 {
+	env_lock(e);
+
+	// Someone else already freed it.
+	if (e->env_status == ENV_FREE) {
+		env_unlock(e);
+		return;
+	}
+
 	// If e is currently running on other CPUs, we change its state to
 	// ENV_DYING. A zombie environment will be freed the next time
 	// it traps to the kernel.
-	if (e->env_status == ENV_RUNNING && curenv != e) {
+	if ((e->env_status == ENV_RUNNING || e->env_status == ENV_DYING) &&
+	    curenv != e) {
 		e->env_status = ENV_DYING;
+		env_unlock(e);
 		return;
 	}
 
@@ -580,23 +761,19 @@ env_run(struct Env *e)
 	//	and make sure you have set the relevant parts of
 	//	e->env_tf to sensible values.
 
-	//1.
+	// Steps 1 and 3 happen in sched_yield, which puts the old curenv
+	// back on a run queue and claims 'e' (marks it ENV_RUNNING on this
+	// CPU) under their env locks before calling us.  trap() only
+	// resumes curenv while it is still ENV_RUNNING.
+	assert(e->env_status == ENV_RUNNING || e->env_status == ENV_DYING);
 
-
-	if (curenv != NULL && curenv->env_status == ENV_RUNNING){
-		curenv->env_status = ENV_RUNNABLE;
-	}
-
-	
+	// Make other CPUs drop the translations this CPU's syscall or
+	// env_free removed before returning to user space.
+	tlb_shootdown();
+	pmap_load(e);		//5.
 	curenv = e; //2.
-	curenv->env_status = ENV_RUNNING; //3.
 	curenv->env_runs++;	//4.
-	lcr3(curenv->env_cr3);	//5.
-	assert(curenv == e);
-	thiscpu->cpu_env = e;
-
 
-	unlock_kernel();
 	env_pop_tf(&e->env_tf);	
 
 	panic("env_run not yet implemented");
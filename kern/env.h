@@ -18,6 +18,12 @@ void env_create(uint8_t *binary, enum EnvType type);
 void env_destroy(struct Env *e);		// Does not return if e == curenv
 
 int	envid2env(envid_t envid, struct Env **env_store, bool checkperm);
+int	envid2env_lock(envid_t envid, struct Env **env_store, bool checkperm);
+void env_lock(struct Env *e);
+void env_unlock(struct Env *e);
+void env_lock_pair(struct Env *a, struct Env *b);
+void env_unlock_pair(struct Env *a, struct Env *b);
+bool env_is_live(struct Env *e, envid_t envid);
 // The following two functions do not return
 void env_run(struct Env *e) __attribute__((noreturn));
 void env_pop_tf(struct Trapframe *tf) __attribute__((noreturn));
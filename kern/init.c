@@ -14,11 +14,13 @@
 #include <kern/env.h>
 #include <kern/trap.h>
 #include <kern/sched.h>
+#include <kern/ipc.h>
 #include <kern/picirq.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
 #include <kern/pci.h>
+#include <kern/kmem.h>
 
 uint64_t end_debug;
 
@@ -51,9 +53,12 @@ i386_init(void)
 
 	// Lab 2 memory management initialization functions
 	x64_vm_init();
+	kmem_init();
 
 	// Lab 3 user environment initialization functions
 	env_init();
+	sched_init();
+	ipc_init();
 	trap_init();
 
 	// Lab 4 multiprocessor initialization functions
@@ -67,9 +72,7 @@ i386_init(void)
 	time_init();
 	pci_init();
 
-	// Acquire the big kernel lock before waking up APs
-	// LAB 4: Your code here.
-
+	// Hold the APs out of the scheduler until the first envs exist.
 	lock_kernel();
 	// Starting non-boot CPUs
 	boot_aps();
@@ -98,7 +101,8 @@ i386_init(void)
 	// Should not be necessary - drains keyboard because interrupt has given up.
 	kbd_intr();
 
-	// Schedule and run the first user environment!
+	// Let the APs in, then schedule and run the first user environment!
+	unlock_kernel();
 	sched_yield();
 }
 
@@ -141,6 +145,7 @@ mp_main(void)
 	// We are in high RIP now, safe to switch to kern_pgdir
 	lcr3(boot_cr3);
 	cprintf("SMP: CPU %d starting\n", cpunum());
+	pmap_init_percpu();
 
 	lapic_init();
 	env_init_percpu();
@@ -148,11 +153,10 @@ mp_main(void)
 	xchg(&thiscpu->cpu_status, CPU_STARTED); // tell boot_aps() we're up
 
 	// Now that we have finished some basic setup, call sched_yield()
-	// to start running processes on this CPU.  But make sure that
-	// only one CPU can enter the scheduler at a time!
-	// LAB 4: Your code here.
-
+	// to start running processes on this CPU, once the BSP has
+	// created the first envs and released kernel_lock.
 	lock_kernel();
+	unlock_kernel();
 	sched_yield();
 }
 
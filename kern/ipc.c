@@ -0,0 +1,220 @@
+// Queues of envs blocked in sys_ipc_send and sys_ipc_call.
+//
+// An env sending to one that is not receiving parks on the target's
+// queue of senders, with its message kept in its own env_ipc_send_*
+// fields, and is not runnable until a sys_ipc_recv by the target
+// takes it off the queue and delivers the message (kern/syscall.c).
+// Senders are served oldest first.  A caller whose message has been
+// delivered then waits on the target's list of callers until the
+// reply comes, so that freeing the target can fail those calls.
+//
+// Each env's queues share one lock, taken after env locks.  A sender is
+// pushed with both its and the target's env locks held, and a target
+// pops with its own held, so a receiver that finds its queue empty
+// can block knowing no sender will slip in behind it.  Popping only
+// takes the sender off the queue; the receiver then locks the sender
+// and checks that it is still waiting (env_ipc_send_to) before
+// delivering, as it may have been freed or woken some other way.
+
+#include <inc/types.h>
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/env.h>
+
+#include <kern/ipc.h>
+#include <kern/env.h>
+#include <kern/sched.h>
+#include <kern/spinlock.h>
+
+static struct spinlock ipc_wait_locks[NENV];
+
+void
+ipc_init(void)
+{
+	int i;
+
+	for (i = 0; i < NENV; i++)
+		spin_initlock(&ipc_wait_locks[i]);
+}
+
+//
+// Queue 'src', blocked sending to 'dst', behind dst's other senders.
+// The caller holds both env locks.
+//
+void
+ipc_wait_push(struct Env *dst, struct Env *src)
+{
+	struct spinlock *lk = &ipc_wait_locks[dst - envs];
+
+	assert(!src->env_ipc_send_queue);
+	spin_lock(lk);
+	src->env_ipc_send_next = NULL;
+	src->env_ipc_send_queue = dst;
+	if (dst->env_ipc_senders_tail)
+		dst->env_ipc_senders_tail->env_ipc_send_next = src;
+	else
+		dst->env_ipc_senders = src;
+	dst->env_ipc_senders_tail = src;
+	spin_unlock(lk);
+}
+
+//
+// Take the oldest sender off 'dst's queue, or return NULL if there is
+// none.  The sender is not locked.
+//
+struct Env *
+ipc_wait_pop(struct Env *dst)
+{
+	struct spinlock *lk = &ipc_wait_locks[dst - envs];
+	struct Env *e;
+
+	spin_lock(lk);
+	if ((e = dst->env_ipc_senders) != NULL) {
+		if (!(dst->env_ipc_senders = e->env_ipc_send_next))
+			dst->env_ipc_senders_tail = NULL;
+		e->env_ipc_send_next = NULL;
+		e->env_ipc_send_queue = NULL;
+	}
+	spin_unlock(lk);
+	return e;
+}
+
+//
+// Add 'src', whose message to 'dst' has been delivered, to dst's list
+// of envs waiting for a reply.  The caller holds both env locks.
+//
+void
+ipc_call_push(struct Env *dst, struct Env *src)
+{
+	struct spinlock *lk = &ipc_wait_locks[dst - envs];
+
+	assert(!src->env_ipc_call_queue);
+	spin_lock(lk);
+	src->env_ipc_call_queue = dst;
+	src->env_ipc_call_prev = NULL;
+	src->env_ipc_call_next = dst->env_ipc_callers;
+	if (dst->env_ipc_callers)
+		dst->env_ipc_callers->env_ipc_call_prev = src;
+	dst->env_ipc_callers = src;
+	spin_unlock(lk);
+}
+
+// Unlink 'e' from the list of callers of 'dst', whose queue lock the
+// caller holds.
+static void
+ipc_call_unlink(struct Env *dst, struct Env *e)
+{
+	if (e->env_ipc_call_prev)
+		e->env_ipc_call_prev->env_ipc_call_next = e->env_ipc_call_next;
+	else
+		dst->env_ipc_callers = e->env_ipc_call_next;
+	if (e->env_ipc_call_next)
+		e->env_ipc_call_next->env_ipc_call_prev = e->env_ipc_call_prev;
+	e->env_ipc_call_next = e->env_ipc_call_prev = NULL;
+	e->env_ipc_call_queue = NULL;
+}
+
+//
+// Take 'e' off the list of callers it is on, if any: it has its reply,
+// or no longer waits for it.  The caller holds e's lock, so e cannot
+// join another list meanwhile.
+//
+void
+ipc_call_leave(struct Env *e)
+{
+	struct Env *dst;
+	struct spinlock *lk;
+
+	if ((dst = e->env_ipc_call_queue) == NULL)
+		return;
+	lk = &ipc_wait_locks[dst - envs];
+	spin_lock(lk);
+	// ipc_wake_senders may have taken e off meanwhile.
+	if (e->env_ipc_call_queue == dst)
+		ipc_call_unlink(dst, e);
+	spin_unlock(lk);
+}
+
+//
+// Call off 'e's send, if it is blocked in one: it is being freed, or
+// was made runnable some other way (see sched_yield), and the send
+// fails with -E_IPC_NOT_RECV.  Likewise e stops waiting for the reply
+// to a call.  The caller holds e's lock.
+//
+void
+ipc_cancel_send(struct Env *e)
+{
+	struct Env *dst, *prev, *cur;
+	struct spinlock *lk;
+
+	ipc_call_leave(e);
+	if (!e->env_ipc_send_to)
+		return;
+	if ((dst = e->env_ipc_send_queue) != NULL) {
+		lk = &ipc_wait_locks[dst - envs];
+		spin_lock(lk);
+		// A receiver may have popped e meanwhile.
+		for (prev = NULL, cur = dst->env_ipc_senders; cur;
+		     prev = cur, cur = cur->env_ipc_send_next) {
+			if (cur != e)
+				continue;
+			if (prev)
+				prev->env_ipc_send_next = e->env_ipc_send_next;
+			else
+				dst->env_ipc_senders = e->env_ipc_send_next;
+			if (dst->env_ipc_senders_tail == e)
+				dst->env_ipc_senders_tail = prev;
+			break;
+		}
+		e->env_ipc_send_next = NULL;
+		e->env_ipc_send_queue = NULL;
+		spin_unlock(lk);
+	}
+	e->env_ipc_send_to = 0;
+	e->env_ipc_recving = false;	// in case it was a sys_ipc_call
+	e->env_tf.tf_regs.reg_rax = -E_IPC_NOT_RECV;
+}
+
+//
+// 'dst' has been freed: fail the sends of the envs still queued on it,
+// and the calls of those waiting for its reply, with -E_BAD_ENV.
+// Called with no env lock held; nothing can join the queue, or call
+// dst, once dst is ENV_FREE.
+//
+void
+ipc_wake_senders(struct Env *dst)
+{
+	struct spinlock *lk = &ipc_wait_locks[dst - envs];
+	struct Env *e;
+
+	while ((e = ipc_wait_pop(dst)) != NULL) {
+		env_lock(e);
+		if (e->env_ipc_send_to == dst->env_id
+		    && !e->env_ipc_send_queue) {
+			e->env_ipc_send_to = 0;
+			e->env_ipc_recving = false;
+			e->env_tf.tf_regs.reg_rax = -E_BAD_ENV;
+			e->env_status = ENV_RUNNABLE;
+			sched_enqueue(e);
+		}
+		env_unlock(e);
+	}
+
+	for (;;) {
+		spin_lock(lk);
+		if ((e = dst->env_ipc_callers) != NULL)
+			ipc_call_unlink(dst, e);
+		spin_unlock(lk);
+		if (e == NULL)
+			break;
+		env_lock(e);
+		if (e->env_ipc_recving && e->env_ipc_recv_from == dst->env_id
+		    && e->env_status == ENV_NOT_RUNNABLE) {
+			e->env_ipc_recving = false;
+			e->env_tf.tf_regs.reg_rax = -E_BAD_ENV;
+			e->env_status = ENV_RUNNABLE;
+			sched_enqueue(e);
+		}
+		env_unlock(e);
+	}
+}
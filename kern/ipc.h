@@ -0,0 +1,19 @@
+#ifndef JOS_KERN_IPC_H
+#define JOS_KERN_IPC_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+
+struct Env;
+
+void	ipc_init(void);
+void	ipc_wait_push(struct Env *dst, struct Env *src);
+struct Env *ipc_wait_pop(struct Env *dst);
+void	ipc_call_push(struct Env *dst, struct Env *src);
+void	ipc_call_leave(struct Env *e);
+void	ipc_cancel_send(struct Env *e);
+void	ipc_wake_senders(struct Env *dst);
+
+#endif	// !JOS_KERN_IPC_H
@@ -0,0 +1,444 @@
+// Slab allocator for kernel objects.
+//
+// Each kmem_cache hands out objects of one size.  Objects live in
+// slabs, single pages from page_alloc with a struct Slab at the start
+// and a stack of free object indices after it; the objects themselves
+// are never written by the allocator, so they keep the state their
+// constructor gave them.
+//
+// In front of the slabs, each CPU has a magazine of free objects per
+// cache.  Kernel code runs with interrupts off and is never preempted,
+// so a CPU can use its own magazine without a lock; the cache lock is
+// only taken to move KMEM_MAG/2 objects at a time between a magazine
+// and the slabs.
+//
+// kmalloc/kfree serve arbitrary sizes from power-of-two caches, and
+// anything larger than KMALLOC_MAX from page_alloc_order.
+
+#include <inc/types.h>
+#include <inc/assert.h>
+#include <inc/string.h>
+#include <inc/mmu.h>
+
+#include <kern/kmem.h>
+#include <kern/pmap.h>
+
+struct Slab {
+	struct Slab *next;
+	struct Slab **pprev;
+	struct kmem_cache *cache;
+	int ninuse;
+	int nfree;		// Entries in freeidx
+	uintptr_t objs;		// Address of object 0
+	uint16_t freeidx[];
+};
+
+#define KMEM_NCACHE	32
+#define KMALLOC_MIN	16
+#define KMALLOC_MAX	1024
+
+static struct kmem_cache kmem_caches[KMEM_NCACHE];
+static int kmem_ncache;
+static struct spinlock kmem_lock = {
+#ifdef DEBUG_SPINLOCK
+	.name = "kmem_lock"
+#endif
+};
+
+static struct kmem_cache *kmalloc_caches[8];
+static const char *kmalloc_names[8] = {
+	"kmalloc-16", "kmalloc-32", "kmalloc-64", "kmalloc-128",
+	"kmalloc-256", "kmalloc-512", "kmalloc-1024", NULL
+};
+
+static void check_kmem(void);
+
+static void
+slab_push(struct Slab **list, struct Slab *s)
+{
+	s->next = *list;
+	s->pprev = list;
+	if (*list)
+		(*list)->pprev = &s->next;
+	*list = s;
+}
+
+static void
+slab_remove(struct Slab *s)
+{
+	*s->pprev = s->next;
+	if (s->next)
+		s->next->pprev = s->pprev;
+	s->next = NULL;
+	s->pprev = NULL;
+}
+
+static uintptr_t
+slab_objs_offset(struct kmem_cache *c, int n)
+{
+	return ROUNDUP(sizeof(struct Slab) + n * sizeof(uint16_t), c->size);
+}
+
+//
+// Create a cache of objects of 'size' bytes aligned to 'align' (a
+// power of two, or 0 for 8).  'ctor', if not NULL, runs on each object
+// as its slab is created.  Returns NULL if there are too many caches.
+//
+struct kmem_cache *
+kmem_cache_create(const char *name, size_t size, size_t align,
+		  void (*ctor)(void *))
+{
+	struct kmem_cache *c;
+	int n;
+
+	if (align < 8)
+		align = 8;
+	size = ROUNDUP(size, align);
+	if (size > PGSIZE / 2)
+		panic("kmem_cache_create: %s: objects of %d bytes too large",
+		      name, size);
+
+	spin_lock(&kmem_lock);
+	if (kmem_ncache == KMEM_NCACHE) {
+		spin_unlock(&kmem_lock);
+		return NULL;
+	}
+	c = &kmem_caches[kmem_ncache];
+	memset(c, 0, sizeof(*c));
+	c->name = name;
+	c->size = size;
+	c->ctor = ctor;
+	for (n = PGSIZE / size; n > 0; n--)
+		if (slab_objs_offset(c, n) + n * size <= PGSIZE)
+			break;
+	assert(n > 0);
+	c->nperslab = n;
+	__spin_initlock(&c->lock, (char *) name);
+	// Publish the cache only once it is set up (kmem_print).
+	kmem_ncache++;
+	spin_unlock(&kmem_lock);
+	return c;
+}
+
+//
+// Allocate and construct a new slab for c.  Called with c->lock held.
+//
+static struct Slab *
+slab_create(struct kmem_cache *c)
+{
+	struct PageInfo *pp;
+	struct Slab *s;
+	int i;
+
+	if ((pp = page_alloc(0)) == NULL)
+		return NULL;
+	s = page2kva(pp);
+	s->cache = c;
+	s->ninuse = 0;
+	s->nfree = c->nperslab;
+	s->objs = (uintptr_t) s + slab_objs_offset(c, c->nperslab);
+	for (i = 0; i < c->nperslab; i++) {
+		s->freeidx[i] = c->nperslab - 1 - i;
+		if (c->ctor)
+			c->ctor((void *) (s->objs + i * c->size));
+	}
+	c->nslabs++;
+	return s;
+}
+
+//
+// Move up to n objects from c's slabs into mag.  Called with c->lock
+// held.  Returns the number moved.
+//
+static int
+kmem_refill(struct kmem_cache *c, struct KmemMagazine *mag, int n)
+{
+	struct Slab *s;
+	int moved = 0;
+
+	while (moved < n) {
+		if ((s = c->partial) == NULL) {
+			if ((s = c->empty) != NULL)
+				c->empty = NULL;
+			else if ((s = slab_create(c)) == NULL)
+				break;
+			slab_push(&c->partial, s);
+		}
+		while (moved < n && s->nfree > 0) {
+			mag->objs[mag->n++] = (void *) (s->objs
+				+ s->freeidx[--s->nfree] * c->size);
+			s->ninuse++;
+			moved++;
+		}
+		if (s->nfree == 0) {
+			slab_remove(s);
+			slab_push(&c->full, s);
+		}
+	}
+	c->nactive += moved;
+	return moved;
+}
+
+//
+// Return obj to its slab.  Called with c->lock held.  Keeps one empty
+// slab around and gives further empty slabs back to the page allocator.
+//
+static void
+kmem_release(struct kmem_cache *c, void *obj)
+{
+	struct Slab *s = ROUNDDOWN(obj, PGSIZE);
+	uintptr_t off = (uintptr_t) obj - s->objs;
+
+	if (s->cache != c || (uintptr_t) obj < s->objs || off % c->size
+	    || off / c->size >= (uintptr_t) c->nperslab)
+		panic("kmem_cache_free: %s: bad object %p", c->name, obj);
+
+	if (s->nfree == 0) {
+		slab_remove(s);
+		slab_push(&c->partial, s);
+	}
+	s->freeidx[s->nfree++] = off / c->size;
+	s->ninuse--;
+	c->nactive--;
+
+	if (s->ninuse == 0) {
+		slab_remove(s);
+		if (c->empty == NULL)
+			c->empty = s;
+		else {
+			page_free(pa2page(PADDR(s)));
+			c->nslabs--;
+		}
+	}
+}
+
+//
+// Give back the oldest n objects in mag.  Called with c->lock held.
+//
+static void
+kmem_flush(struct kmem_cache *c, struct KmemMagazine *mag, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+		kmem_release(c, mag->objs[i]);
+	memmove(mag->objs, mag->objs + n, (mag->n - n) * sizeof(void *));
+	mag->n -= n;
+}
+
+//
+// Allocate an object from c.  Returns NULL if out of memory.
+//
+void *
+kmem_cache_alloc(struct kmem_cache *c)
+{
+	struct KmemMagazine *mag = &c->mags[cpunum()];
+
+	if (mag->n == 0) {
+		spin_lock(&c->lock);
+		c->nmiss++;
+		kmem_refill(c, mag, KMEM_MAG / 2);
+		spin_unlock(&c->lock);
+		if (mag->n == 0)
+			return NULL;
+	}
+	mag->nalloc++;
+	return mag->objs[--mag->n];
+}
+
+//
+// Return obj, in its constructed state, to c.
+//
+void
+kmem_cache_free(struct kmem_cache *c, void *obj)
+{
+	struct KmemMagazine *mag = &c->mags[cpunum()];
+
+	if (mag->n == KMEM_MAG) {
+		spin_lock(&c->lock);
+		kmem_flush(c, mag, KMEM_MAG / 2);
+		spin_unlock(&c->lock);
+	}
+	mag->nfree++;
+	mag->objs[mag->n++] = obj;
+}
+
+//
+// Give back every object in this CPU's magazines, so that an idle CPU
+// does not keep slabs from being freed.
+//
+void
+kmem_cache_drain(void)
+{
+	struct KmemMagazine *mag;
+	struct kmem_cache *c;
+	int i;
+
+	for (i = 0; i < kmem_ncache; i++) {
+		c = &kmem_caches[i];
+		mag = &c->mags[cpunum()];
+		if (mag->n == 0)
+			continue;
+		spin_lock(&c->lock);
+		kmem_flush(c, mag, mag->n);
+		spin_unlock(&c->lock);
+	}
+}
+
+//
+// Allocate size bytes of kernel memory.  Blocks up to KMALLOC_MAX come
+// from the kmalloc caches; larger ones are whole pages, page-aligned.
+// Returns NULL if out of memory.
+//
+void *
+kmalloc(size_t size)
+{
+	struct PageInfo *pp;
+	int i, order;
+
+	if (size <= KMALLOC_MAX) {
+		for (i = 0; (KMALLOC_MIN << i) < size; i++)
+			;
+		return kmem_cache_alloc(kmalloc_caches[i]);
+	}
+	for (order = 0; (PGSIZE << order) < size; order++)
+		;
+	if ((pp = page_alloc_order(order, 0)) == NULL)
+		return NULL;
+	return page2kva(pp);
+}
+
+//
+// Free a block from kmalloc.  Cache objects are never page-aligned,
+// since the Slab header comes first in the page.
+//
+void
+kfree(void *p)
+{
+	struct Slab *s = ROUNDDOWN(p, PGSIZE);
+	struct PageInfo *pp;
+
+	if (p == NULL)
+		return;
+	if ((void *) s == p) {
+		pp = pa2page(PADDR(p));
+		page_free_order(pp, pp->pp_order);
+		return;
+	}
+	kmem_cache_free(s->cache, p);
+}
+
+//
+// Print usage statistics for every cache.
+//
+void
+kmem_print(void)
+{
+	struct kmem_cache *c;
+	uint64_t nalloc, nfree;
+	size_t ncached;
+	int i, j;
+
+	cprintf("%-14s %5s %7s %7s %6s %6s %9s %9s %7s\n",
+		"cache", "size", "active", "objs", "slabs", "mags",
+		"allocs", "frees", "misses");
+	for (i = 0; i < kmem_ncache; i++) {
+		c = &kmem_caches[i];
+		nalloc = nfree = 0;
+		ncached = 0;
+		for (j = 0; j < NCPU; j++) {
+			nalloc += c->mags[j].nalloc;
+			nfree += c->mags[j].nfree;
+			ncached += c->mags[j].n;
+		}
+		// Objects in magazines are free to the caller but active
+		// to the slabs.
+		cprintf("%-14s %5u %7u %7u %6u %6u %9llu %9llu %7llu\n",
+			c->name, c->size, c->nactive - ncached,
+			c->nslabs * c->nperslab, c->nslabs, ncached,
+			nalloc, nfree, c->nmiss);
+	}
+}
+
+//
+// Create the kmalloc caches.  Called once the page allocator is up.
+//
+void
+kmem_init(void)
+{
+	int i;
+
+	for (i = 0; kmalloc_names[i]; i++)
+		if (!(kmalloc_caches[i] = kmem_cache_create(kmalloc_names[i],
+						KMALLOC_MIN << i, 0, NULL)))
+			panic("kmem_init: out of caches");
+	check_kmem();
+}
+
+// --------------------------------------------------------------
+// Checking functions.
+// --------------------------------------------------------------
+
+static int check_kmem_nctor;
+
+static void
+check_kmem_ctor(void *obj)
+{
+	*(uint64_t *) obj = 0x5ab;
+	check_kmem_nctor++;
+}
+
+//
+// Check that objects are distinct, come back constructed, and that
+// slabs are given back once empty.
+//
+static void
+check_kmem(void)
+{
+	static void *objs[200];
+	struct kmem_cache *c;
+	void *big;
+	int i, j;
+
+	c = kmem_cache_create("check_kmem", 40, 8, check_kmem_ctor);
+	assert(c && c->size == 40);
+	for (i = 0; i < 200; i++) {
+		objs[i] = kmem_cache_alloc(c);
+		assert(objs[i] && ((uintptr_t) objs[i] & 7) == 0);
+		assert(*(uint64_t *) objs[i] == 0x5ab);
+		for (j = 0; j < i; j++)
+			assert(objs[i] != objs[j]);
+		memset((char *) objs[i] + 8, 0xee, 32);
+	}
+	assert(check_kmem_nctor == c->nslabs * c->nperslab);
+	assert(c->nslabs >= 200 / c->nperslab);
+	for (i = 0; i < 200; i++)
+		kmem_cache_free(c, objs[i]);
+	kmem_cache_drain();
+	assert(c->nactive == 0 && c->nslabs == 1);
+	// The constructor doesn't run again for recycled objects.
+	j = check_kmem_nctor;
+	objs[0] = kmem_cache_alloc(c);
+	assert(*(uint64_t *) objs[0] == 0x5ab);
+	assert(check_kmem_nctor == j);
+	kmem_cache_free(c, objs[0]);
+	kmem_cache_drain();
+
+	for (i = 0; i < 12; i++) {
+		objs[i] = kmalloc(1 << i);
+		assert(objs[i]);
+		memset(objs[i], i, 1 << i);
+	}
+	big = kmalloc(3 * PGSIZE);
+	assert(big && ((uintptr_t) big & (PGSIZE - 1)) == 0);
+	assert(pa2page(PADDR(big))->pp_order == 2);
+	for (i = 0; i < 12; i++) {
+		for (j = 0; j < (1 << i); j++)
+			assert(((uint8_t *) objs[i])[j] == i);
+		kfree(objs[i]);
+	}
+	kfree(big);
+	kmem_cache_drain();
+
+	cprintf("check_kmem() succeeded!\n");
+}
@@ -0,0 +1,53 @@
+#ifndef JOS_KERN_KMEM_H
+#define JOS_KERN_KMEM_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+
+// Objects each CPU keeps cached per kmem_cache.
+#define KMEM_MAG	32
+
+struct KmemMagazine {
+	int n;
+	uint64_t nalloc, nfree;		// Calls made on this CPU
+	void *objs[KMEM_MAG];
+} __attribute__((aligned(64)));
+
+struct Slab;
+
+// A cache of equally sized kernel objects, carved out of whole pages
+// ("slabs").  Free objects stay constructed: the constructor runs once
+// per object when its slab is created, not on every allocation, so
+// objects must be handed back to kmem_cache_free in that state.
+struct kmem_cache {
+	const char *name;
+	size_t size;			// Object size, including alignment
+	void (*ctor)(void *);		// Constructor, or NULL
+	int nperslab;			// Objects in a slab
+
+	struct spinlock lock;		// Protects the fields below
+	struct Slab *partial;		// Slabs with free objects
+	struct Slab *full;		// Slabs with none
+	struct Slab *empty;		// At most one slab with no objects in use
+	size_t nslabs;			// Slabs allocated, including empty
+	size_t nactive;			// Objects not free in a slab
+	uint64_t nmiss;			// Allocations that missed the magazines
+
+	struct KmemMagazine mags[NCPU];	// Only touched by their own CPU
+};
+
+void kmem_init(void);
+struct kmem_cache *kmem_cache_create(const char *name, size_t size,
+				     size_t align, void (*ctor)(void *));
+void *kmem_cache_alloc(struct kmem_cache *cache);
+void kmem_cache_free(struct kmem_cache *cache, void *obj);
+void kmem_cache_drain(void);
+void *kmalloc(size_t size);
+void kfree(void *p);
+void kmem_print(void);
+
+#endif	// !JOS_KERN_KMEM_H
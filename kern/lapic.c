@@ -33,6 +33,7 @@
 #define TIMER   (0x0320/4)   // Local Vector Table 0 (TIMER)
 #define X1         0x0000000B   // divide counts by 1
 #define PERIODIC   0x00020000   // Periodic
+#define TSCDEADLINE 0x00040000  // Fire once when the TSC reaches IA32_TSC_DEADLINE
 #define PCINT   (0x0340/4)   // Performance Counter LVT
 #define LINT0   (0x0350/4)   // Local Vector Table 1 (LINT0)
 #define LINT1   (0x0360/4)   // Local Vector Table 2 (LINT1)
@@ -42,9 +43,22 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+#define MSR_TSC_DEADLINE	0x6E0
+#define CPUID_TSC_DEADLINE	(1 << 24)	// CPUID.01H:ECX
+
+// PIT channel 2, used as the reference clock in lapic_calibrate.
+#define IO_PIT_CH2	0x42
+#define IO_PIT_MODE	0x43
+#define IO_PIT_GATE	0x61	// System control port B
+#define PIT_HZ		1193182
+
 physaddr_t lapicaddr;        // Initialized in mpconfig.c
 volatile uint32_t *lapic;
 
+uint64_t tsc_khz;			// Set by lapic_calibrate
+static uint64_t lapic_timer_khz;	// LAPIC timer counts per ms, divide by 1
+static bool lapic_tsc_deadline;		// Timer supports TSC-deadline mode
+
 static void
 lapicw(int index, int value)
 {
@@ -52,9 +66,20 @@ lapicw(int index, int value)
 	lapic[ID];  // wait for write to finish, by reading
 }
 
+static void
+lapic_timer_mode(void)
+{
+	if (lapic_tsc_deadline)
+		lapicw(TIMER, TSCDEADLINE | (IRQ_OFFSET + IRQ_TIMER));
+	else
+		lapicw(TIMER, IRQ_OFFSET + IRQ_TIMER);
+}
+
 void
 lapic_init(void)
 {
+	uint32_t ecx;
+
 	if (!lapicaddr)
 		return;
 
@@ -65,13 +90,16 @@ lapic_init(void)
 	// Enable local APIC; set spurious interrupt vector.
 	lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
 
-	// The timer repeatedly counts down at bus frequency
-	// from lapic[TICR] and then issues an interrupt.  
-	// If we cared more about precise timekeeping,
-	// TICR would be calibrated using an external time source.
+	// The timer is one-shot: it only interrupts at the deadline the
+	// scheduler last asked for with lapic_timer_deadline, so an idle
+	// CPU is not woken up for nothing.  Prefer TSC-deadline mode, which
+	// takes an absolute TSC value; otherwise count down from TICR at
+	// the rate lapic_calibrate measured.  The timer starts disarmed.
+	cpuid(1, NULL, NULL, &ecx, NULL);
+	lapic_tsc_deadline = (ecx & CPUID_TSC_DEADLINE) != 0;
 	lapicw(TDCR, X1);
-	lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
-	lapicw(TICR, 10000000); 
+	lapicw(TICR, 0);
+	lapic_timer_mode();
 
 	// Leave LINT0 of the BSP enabled so that it can get
 	// interrupts from the 8259A chip.
@@ -180,3 +208,77 @@ lapic_ipi(int vector)
 	while (lapic[ICRLO] & DELIVS)
 		;
 }
+
+// Send 'vector' to CPU 'cpu' only.
+void
+lapic_ipi_cpu(int cpu, int vector)
+{
+	lapicw(ICRHI, cpus[cpu].cpu_id << 24);
+	lapicw(ICRLO, FIXED | vector);
+	while (lapic[ICRLO] & DELIVS)
+		;
+}
+
+// Measure how fast the TSC and the LAPIC timer run by counting both
+// across 10 ms of PIT channel 2, whose input clock is a fixed PIT_HZ.
+// Called once, on the BSP, after lapic_init; every CPU shares the
+// result.
+void
+lapic_calibrate(void)
+{
+	uint32_t count = PIT_HZ / 100;
+	uint64_t tsc;
+
+	// Gate channel 2 on with the speaker off, then load it in mode 0
+	// (interrupt on terminal count): OUT2 goes high when it hits zero.
+	outb(IO_PIT_GATE, (inb(IO_PIT_GATE) & ~0x02) | 0x01);
+	outb(IO_PIT_MODE, 0xB0);
+	if (lapic) {
+		lapicw(TIMER, MASKED);
+		lapicw(TICR, 0xFFFFFFFF);
+	}
+	outb(IO_PIT_CH2, count & 0xFF);
+	outb(IO_PIT_CH2, count >> 8);
+	tsc = read_tsc();
+	while (!(inb(IO_PIT_GATE) & 0x20))
+		;
+	tsc = read_tsc() - tsc;
+	tsc_khz = tsc / 10;
+
+	if (lapic) {
+		lapic_timer_khz = (0xFFFFFFFF - lapic[TCCR]) / 10;
+		lapicw(TICR, 0);
+		lapic_timer_mode();
+	}
+	cprintf("TSC %llu kHz, LAPIC timer %llu kHz%s\n", tsc_khz,
+		lapic_timer_khz, lapic_tsc_deadline ? ", TSC-deadline" : "");
+}
+
+// Arm this CPU's timer to interrupt once when the TSC reaches
+// 'deadline', replacing any deadline set before.  A deadline of 0
+// disarms the timer; one already in the past fires right away.
+void
+lapic_timer_deadline(uint64_t deadline)
+{
+	uint64_t now, count;
+
+	if (!lapic || !tsc_khz)
+		return;
+	if (lapic_tsc_deadline) {
+		write_msr(MSR_TSC_DEADLINE, deadline);
+		return;
+	}
+	if (!deadline) {
+		lapicw(TICR, 0);
+		return;
+	}
+	now = read_tsc();
+	count = 1;
+	if (deadline > now)
+		count = (deadline - now) * lapic_timer_khz / tsc_khz;
+	if (count == 0)
+		count = 1;
+	if (count > 0xFFFFFFFF)
+		count = 0xFFFFFFFF;
+	lapicw(TICR, count);
+}
@@ -13,6 +13,9 @@
 #include <kern/kdebug.h>
 #include <kern/dwarf_api.h>
 #include <kern/trap.h>
+#include <kern/spinlock.h>
+#include <kern/pmap.h>
+#include <kern/kmem.h>
 
 #define CMDBUF_SIZE	80	// enough for one VGA text line
 
@@ -30,6 +33,9 @@ static struct Command commands[] = {
 	{ "monbacktrace","Display a backtrace of execution (might be broken)", mon_backtrace},
 	{ "colortest", "Display demonstration of printing with colors",colortest},
 	{" shutdown", "Shutdown the computer", mon_shutdown},
+	{ "lockstat", "Lock contention: lockstat [nlocks | name | reset]", mon_lockstat },
+	{ "buddyinfo", "Display free memory by block order", mon_buddyinfo },
+	{ "slabinfo", "Display kernel object cache usage", mon_slabinfo },
 };
 #define NCOMMANDS (sizeof(commands)/sizeof(commands[0]))
 
@@ -161,6 +167,38 @@ mon_backtrace(int argc, char **argv, struct Trapframe *tf)
 
 }
 
+int
+mon_lockstat(int argc, char **argv, struct Trapframe *tf)
+{
+#ifdef DEBUG_SPINLOCK
+	if (argc < 2)
+		lockstat_print(5);
+	else if (strcmp(argv[1], "reset") == 0)
+		lockstat_reset();
+	else if (argv[1][0] >= '0' && argv[1][0] <= '9')
+		lockstat_print(strtol(argv[1], NULL, 10));
+	else
+		lockstat_print_one(argv[1]);
+#else
+	cprintf("lockstat needs DEBUG_SPINLOCK (kern/spinlock.h)\n");
+#endif
+	return 0;
+}
+
+int
+mon_buddyinfo(int argc, char **argv, struct Trapframe *tf)
+{
+	page_buddy_print();
+	return 0;
+}
+
+int
+mon_slabinfo(int argc, char **argv, struct Trapframe *tf)
+{
+	kmem_print();
+	return 0;
+}
+
 int mon_shutdown(int argc, char** argv, struct Trapframe *tf){
 	return 0;
 }
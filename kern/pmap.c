@@ -11,6 +11,8 @@
 #include <kern/multiboot.h>
 #include <kern/env.h>
 #include <kern/cpu.h>
+#include <kern/spinlock.h>
+#include <kern/tlb.h>
 
 extern uint64_t pml4phys;
 #define BOOT_PAGE_TABLE_START ((uint64_t) KADDR((uint64_t) &pml4phys))
@@ -25,6 +27,101 @@ pml4e_t *boot_pml4;							// Kernel's initial page directory
 physaddr_t boot_cr3;						// Physical address of boot time page directory
 struct PageInfo *pages;						// Physical page state array
 static struct PageInfo *page_free_list;		// Free list of physical pages
+static bool page_1gb;						// CPU supports 1GB pages
+
+// PCIDs.  With CR4_PCIDE, TLB entries are tagged with the PCID in the
+// low bits of CR3, and a CR3 load with CR3_NOFLUSH keeps them, so an
+// env switch need not flush the TLB; kernel mappings are PTE_G and
+// survive any CR3 load.  Each CPU hands out its own PCIDs
+// 1..NPCID-1 round robin to the address spaces it runs (PCID 0 is
+// boot_pml4's), and only ever uses them itself, so this state is
+// per-CPU and needs no lock.
+//
+// pcid_cr3[p] is the PML4 that PCID p last tagged entries for, and
+// pcid_gen[p] that PML4's pp_tlb_gen when those entries were last
+// known to be current.  tlb_invalidate bumps pp_tlb_gen, so a PCID
+// whose generation is behind is flushed when next loaded (pmap_load).
+#define NPCID		64
+
+struct PcidCache {
+	uint8_t env_pcid[NENV];		// PCID last given to envs[i], or 0
+	physaddr_t pcid_cr3[NPCID];
+	uint32_t pcid_gen[NPCID];
+	int pcid_next;			// Last PCID recycled
+	int pcid_cur;			// PCID in CR3 now, 0 if boot_pml4's
+};
+
+static struct PcidCache pcid_caches[NCPU];
+static bool pcid_on;		// CPUs run with CR4_PCIDE
+static bool invpcid_on;		// ... and have INVPCID
+
+// A page of zeros, mapped read-only and copy-on-write by
+// sys_page_alloc(PTE_LAZY) wherever memory is reserved but not yet
+// written.  Mappings of it are not counted in its pp_ref.
+struct PageInfo *page_zero;
+
+// Protects page_free_list.  Taken after any env or run queue lock.
+static struct spinlock page_lock = {
+#ifdef DEBUG_SPINLOCK
+	.name = "page_lock"
+#endif
+};
+
+// Serializes the address spaces sharing a page table (PDE_COW), which
+// hold different env locks: its pp_ref, and its PTEs while shared.
+static struct spinlock pt_share_lock = {
+#ifdef DEBUG_SPINLOCK
+	.name = "pt_share_lock"
+#endif
+};
+
+// Buddy allocator.  Once mem_init's checks, which manipulate
+// page_free_list directly, are done, every free page moves from
+// page_free_list into buddy_free[]: buddy_free[k] is a doubly linked
+// list of free blocks of 2^k physically contiguous pages, aligned to
+// 2^k pages.  Freeing a block merges it with its buddy (the other half
+// of the block of order k+1 containing it) when that is free too.
+// buddy_free[] is protected by page_lock.
+#define BUDDY_MAX_ORDER	10
+
+static struct PageInfo *buddy_free[BUDDY_MAX_ORDER + 1];
+static size_t buddy_nfree[BUDDY_MAX_ORDER + 1];	// Blocks on buddy_free[k]
+
+// Per-CPU magazines of free pages in front of the buddy allocator.
+// page_alloc and page_free work on this CPU's magazine and go to
+// buddy_free[0] under page_lock a batch at a time when it runs empty
+// or full.  Each magazine has its own lock, taken before page_lock and
+// uncontended except when a CPU that finds both its magazine and the
+// buddy allocator empty flushes the other CPUs' magazines
+// (page_mag_steal) rather than fail.  Pages in magazines cannot be
+// merged into larger blocks; an idle CPU drains its magazine
+// (page_mag_drain) before it halts.
+#define PAGEMAG_SIZE	64
+#define PAGEMAG_BATCH	(PAGEMAG_SIZE / 2)
+
+struct PageMagazine {
+	struct spinlock lock;
+	int n;					// Number of pages in pages[]
+	struct PageInfo *pages[PAGEMAG_SIZE];	// pages[n-1] is the hottest
+} __attribute__((aligned(64)));
+
+static struct PageMagazine page_mags[NCPU];
+static bool page_mags_on;
+
+// Pool of free pages that are already zero, filled by idle CPUs
+// (page_zero_idle) so that page_alloc(ALLOC_ZERO) need not memset.
+// Linked by pp_link, protected by page_zero_lock.  page_alloc_order
+// gives the pool back to the buddy allocator when a larger block
+// cannot be found without it.
+#define PAGEZERO_MAX	1024
+
+static struct PageInfo *page_zero_list;
+static size_t page_nzero;
+static struct spinlock page_zero_lock = {
+#ifdef DEBUG_SPINLOCK
+	.name = "page_zero_lock"
+#endif
+};
 
 // --------------------------------------------------------------
 // Detect machine's physical memory setup.
@@ -186,6 +283,7 @@ static void check_boot_pml4e(pml4e_t *pml4e);
 static physaddr_t check_va2pa(pde_t *pgdir, uintptr_t va);
 static void page_check(void);
 static void page_initpp(struct PageInfo *pp);
+static void buddy_init(void);
 
 // This simple physical memory allocator is used only while JOS is setting
 // up its virtual memory system.  page_alloc() is the real allocator.
@@ -243,10 +341,27 @@ x64_vm_init(void)
 {
 	uint32_t cr0;
 	uint64_t n;
-	int r;
+	int i, r;
 	struct Env *env;
 
 	i386_detect_memory();	
+
+	// 2MB pages are always available in long mode; 1GB pages are
+	// CPUID 0x80000001 EDX bit 26.
+	uint32_t edx;
+	cpuid(0x80000001, NULL, NULL, NULL, &edx);
+	page_1gb = (edx >> 26) & 1;
+
+	// PCIDs are CPUID 1 ECX bit 17, INVPCID CPUID 7 EBX bit 10.  All
+	// CPUs are taken to be the same model as the BSP.
+	uint32_t ecx, ebx;
+	cpuid(1, NULL, NULL, &ecx, NULL);
+	cpuid_count(7, 0, NULL, &ebx, NULL, NULL);
+	pcid_on = (ecx >> 17) & 1;
+	invpcid_on = pcid_on && ((ebx >> 10) & 1);
+	cprintf("PCID %s, INVPCID %s\n", pcid_on ? "on" : "off",
+		invpcid_on ? "on" : "off");
+
 	boot_pml4 = boot_alloc(PGSIZE);
 	memset(boot_pml4, 0, PGSIZE);
 	boot_cr3 = PADDR(boot_pml4);
@@ -276,12 +391,24 @@ x64_vm_init(void)
 
 	// install the page table
 	lcr3(boot_cr3);
+	pmap_init_percpu();
 
 	// Check that the page table has been set up correctly.
 	check_page_free_list(1);
 	check_page_alloc();
 	page_check();
 	check_page_free_list(0);
+
+	buddy_init();
+	for (i = 0; i < NCPU; i++)
+		__spin_initlock(&page_mags[i].lock, "page_mag");
+	page_mags_on = 1;
+
+	// The shared zero page holds one reference forever (see
+	// page_incref), so it is never freed or made writable.
+	if (!(page_zero = page_alloc(ALLOC_ZERO)))
+		panic("out of memory for the zero page");
+	page_zero->pp_ref = 1;
 }
 
 
@@ -402,6 +529,271 @@ page_init(void)
 	//mark_pages_as_free(boot_alloc(0),npages,pages,&last);
 }
 
+//
+// Buddy allocator internals.  The caller holds page_lock.
+//
+
+static void
+buddy_push(struct PageInfo *pp, int order)
+{
+	pp->pp_free = 1;
+	pp->pp_order = order;
+	pp->pp_prev = NULL;
+	pp->pp_link = buddy_free[order];
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp;
+	buddy_free[order] = pp;
+	buddy_nfree[order]++;
+}
+
+static void
+buddy_remove(struct PageInfo *pp)
+{
+	int order = pp->pp_order;
+
+	if (pp->pp_prev)
+		pp->pp_prev->pp_link = pp->pp_link;
+	else
+		buddy_free[order] = pp->pp_link;
+	if (pp->pp_link)
+		pp->pp_link->pp_prev = pp->pp_prev;
+	pp->pp_link = pp->pp_prev = NULL;
+	pp->pp_free = 0;
+	buddy_nfree[order]--;
+}
+
+// Take a block of 2^order pages, splitting a larger one if needed.
+static struct PageInfo *
+buddy_alloc(int order)
+{
+	struct PageInfo *pp;
+	int k;
+
+	for (k = order; k <= BUDDY_MAX_ORDER && !buddy_free[k]; k++)
+		;
+	if (k > BUDDY_MAX_ORDER)
+		return NULL;
+	pp = buddy_free[k];
+	buddy_remove(pp);
+
+	// Give back the upper half until the block is the right size.
+	while (k > order) {
+		k--;
+		buddy_push(pp + (1 << k), k);
+	}
+	pp->pp_order = order;
+	return pp;
+}
+
+// Free a block of 2^order pages, merging it with its buddies.
+static void
+buddy_release(struct PageInfo *pp, int order)
+{
+	struct PageInfo *buddy;
+	ppn_t ppn = page2ppn(pp);
+
+	while (order < BUDDY_MAX_ORDER) {
+		ppn_t bppn = ppn ^ (1 << order);
+
+		if (bppn >= npages)
+			break;
+		buddy = &pages[bppn];
+		if (!buddy->pp_free || buddy->pp_order != order)
+			break;
+		buddy_remove(buddy);
+		ppn &= ~(1 << order);
+		order++;
+	}
+	buddy_push(&pages[ppn], order);
+}
+
+// Move every page on page_free_list into the buddy allocator.
+static void
+buddy_init(void)
+{
+	struct PageInfo *pp, *next;
+
+	spin_lock(&page_lock);
+	for (pp = page_free_list; pp; pp = next) {
+		next = pp->pp_link;
+		pp->pp_link = NULL;
+		buddy_release(pp, 0);
+	}
+	page_free_list = NULL;
+	spin_unlock(&page_lock);
+}
+
+//
+// Move up to PAGEMAG_BATCH pages from the buddy allocator into 'mag',
+// which must be empty.  The caller holds mag->lock.
+//
+static void
+page_mag_refill(struct PageMagazine *mag)
+{
+	struct PageInfo *pp;
+
+	spin_lock(&page_lock);
+	while (mag->n < PAGEMAG_BATCH && (pp = buddy_alloc(0)) != NULL)
+		mag->pages[mag->n++] = pp;
+	spin_unlock(&page_lock);
+}
+
+//
+// Return the 'n' coldest pages in 'mag' to the buddy allocator.
+// The caller holds mag->lock.
+//
+static void
+page_mag_flush(struct PageMagazine *mag, int n)
+{
+	int i;
+
+	spin_lock(&page_lock);
+	for (i = 0; i < n; i++)
+		buddy_release(mag->pages[i], 0);
+	spin_unlock(&page_lock);
+
+	mag->n -= n;
+	memmove(mag->pages, mag->pages + n, mag->n * sizeof mag->pages[0]);
+}
+
+//
+// Return every page in the other CPUs' magazines to the buddy
+// allocator.  Returns the number of pages returned.  The caller holds
+// no magazine lock.
+//
+static int
+page_mag_steal(void)
+{
+	struct PageMagazine *mag;
+	int i, n = 0;
+
+	for (i = 0; i < ncpu; i++) {
+		mag = &page_mags[i];
+		if (i == cpunum() || mag->n == 0)
+			continue;
+		spin_lock(&mag->lock);
+		n += mag->n;
+		if (mag->n > 0)
+			page_mag_flush(mag, mag->n);
+		spin_unlock(&mag->lock);
+	}
+	return n;
+}
+
+//
+// Take a free page from this CPU's magazine, or from page_free_list
+// during boot.
+//
+static struct PageInfo *
+page_take(void)
+{
+	struct PageInfo *page;
+	struct PageMagazine *mag;
+
+	if (page_mags_on) {
+		mag = &page_mags[cpunum()];
+		spin_lock(&mag->lock);
+		if (mag->n == 0)
+			page_mag_refill(mag);
+		if (mag->n == 0) {
+			spin_unlock(&mag->lock);
+			if (page_mag_steal() == 0)
+				return NULL;
+			spin_lock(&mag->lock);
+			if (mag->n == 0)
+				page_mag_refill(mag);
+		}
+		page = mag->n > 0 ? mag->pages[--mag->n] : NULL;
+		spin_unlock(&mag->lock);
+		return page;
+	}
+
+	spin_lock(&page_lock);
+	page = page_free_list;
+	if (page != NULL)
+		page_free_list = page->pp_link;
+	spin_unlock(&page_lock);
+	return page;
+}
+
+//
+// Take a page from the pre-zeroed pool, or return NULL if it is empty.
+//
+static struct PageInfo *
+page_zero_pop(void)
+{
+	struct PageInfo *page;
+
+	if (!page_zero_list)
+		return NULL;
+	spin_lock(&page_zero_lock);
+	if ((page = page_zero_list) != NULL) {
+		page_zero_list = page->pp_link;
+		page_nzero--;
+	}
+	spin_unlock(&page_zero_lock);
+	if (page)
+		page->pp_link = NULL;
+	return page;
+}
+
+//
+// Return the whole pre-zeroed pool to the buddy allocator, so that its
+// pages can merge back into larger blocks.
+//
+static void
+page_zero_release(void)
+{
+	struct PageInfo *list, *pp;
+
+	if (!page_zero_list)
+		return;
+	spin_lock(&page_zero_lock);
+	list = page_zero_list;
+	page_zero_list = NULL;
+	page_nzero = 0;
+	spin_unlock(&page_zero_lock);
+
+	spin_lock(&page_lock);
+	while ((pp = list) != NULL) {
+		list = pp->pp_link;
+		pp->pp_link = NULL;
+		buddy_release(pp, 0);
+	}
+	spin_unlock(&page_lock);
+}
+
+//
+// Zero one free page and add it to the pre-zeroed pool.  Called by
+// idle CPUs, one page at a time so that they can stop as soon as work
+// arrives.  Only pages already free as single pages are taken: an
+// order-0 block on buddy_free[0] has no free buddy, so zeroing it
+// never splits a larger block.  Returns 0 if the pool is full or
+// there is no such page.
+//
+int
+page_zero_idle(void)
+{
+	struct PageInfo *page;
+
+	if (!page_mags_on || page_nzero >= PAGEZERO_MAX || !buddy_free[0])
+		return 0;
+	spin_lock(&page_lock);
+	if ((page = buddy_free[0]) != NULL)
+		buddy_remove(page);
+	spin_unlock(&page_lock);
+	if (page == NULL)
+		return 0;
+	memset(page2kva(page), 0, PGSIZE);
+
+	spin_lock(&page_zero_lock);
+	page->pp_link = page_zero_list;
+	page_zero_list = page;
+	page_nzero++;
+	spin_unlock(&page_zero_lock);
+	return 1;
+}
+
 //
 // Allocates a physical page.  If (alloc_flags & ALLOC_ZERO), fills the entire
 // returned physical page with '\0' bytes.  Does NOT increment the reference
@@ -421,18 +813,21 @@ page_alloc(int alloc_flags)
 
 	
 
-	struct PageInfo *page = page_free_list;
-	if (page != NULL) {
-		
-	
-		page_free_list = page->pp_link;
+	struct PageInfo *page;
+
+	if ((alloc_flags & ALLOC_ZERO) && (page = page_zero_pop()) != NULL)
+		return page;
+
+	if ((page = page_take()) != NULL) {
 		page->pp_link = NULL;	
 		if (alloc_flags & ALLOC_ZERO){
 			memset(page2kva(page),0,PGSIZE);
 		}
 		return page;
 	}
-	return NULL;
+
+	// Pre-zeroed pages are free memory too.
+	return page_zero_pop();
 }
 
 //
@@ -454,29 +849,165 @@ void
 page_free(struct PageInfo *pp)
 {
 
-	if (pp->pp_ref || pp->pp_link) {
+	struct PageMagazine *mag;
+
+	if (pp->pp_ref || pp->pp_link || pp->pp_free) {
 		panic("page_free: pp_ref or pp_link is non-zero!\n");
 	}
+	if (page_mags_on) {
+		mag = &page_mags[cpunum()];
+		spin_lock(&mag->lock);
+		if (mag->n == PAGEMAG_SIZE)
+			page_mag_flush(mag, PAGEMAG_BATCH);
+		mag->pages[mag->n++] = pp;
+		spin_unlock(&mag->lock);
+		return;
+	}
+	spin_lock(&page_lock);
 	pp->pp_link = page_free_list;
 	page_free_list = pp;
+	spin_unlock(&page_lock);
+}
+
+//
+// Return all of this CPU's magazine to the buddy allocator, so that
+// other CPUs can allocate those pages while this one is idle.
+//
+void
+page_mag_drain(void)
+{
+	struct PageMagazine *mag = &page_mags[cpunum()];
+
+	spin_lock(&mag->lock);
+	if (mag->n > 0)
+		page_mag_flush(mag, mag->n);
+	spin_unlock(&mag->lock);
+}
+
+//
+// Allocate 2^order physically contiguous pages, aligned to 2^order
+// pages, for 0 <= order <= BUDDY_MAX_ORDER.  As with page_alloc,
+// ALLOC_ZERO zeroes them and no reference counts are changed.
+// Returns the first page's PageInfo, or NULL if there is no free block
+// that large.
+//
+struct PageInfo *
+page_alloc_order(int order, int alloc_flags)
+{
+	struct PageInfo *pp;
+
+	if (order == 0)
+		return page_alloc(alloc_flags);
+	if (order < 0 || order > BUDDY_MAX_ORDER)
+		return NULL;
+
+	spin_lock(&page_lock);
+	pp = buddy_alloc(order);
+	spin_unlock(&page_lock);
+	if (!pp) {
+		// This CPU's magazine may hold the missing buddies.
+		page_mag_drain();
+		spin_lock(&page_lock);
+		pp = buddy_alloc(order);
+		spin_unlock(&page_lock);
+	}
+	if (!pp) {
+		// So may the other CPUs' magazines and the pre-zeroed pool.
+		page_mag_steal();
+		page_zero_release();
+		spin_lock(&page_lock);
+		pp = buddy_alloc(order);
+		spin_unlock(&page_lock);
+	}
+
+	if (pp && (alloc_flags & ALLOC_ZERO))
+		memset(page2kva(pp), 0, PGSIZE << order);
+	return pp;
+}
+
+//
+// Free a block from page_alloc_order.  The first page's pp_ref must be
+// zero.
+//
+void
+page_free_order(struct PageInfo *pp, int order)
+{
+	if (order == 0) {
+		page_free(pp);
+		return;
+	}
+	if (pp->pp_ref || pp->pp_link || pp->pp_free)
+		panic("page_free_order: pp_ref or pp_link is non-zero!\n");
+	if (order < 0 || order > BUDDY_MAX_ORDER
+	    || (page2ppn(pp) & ((1 << order) - 1)))
+		panic("page_free_order: bad block %x of order %d", pp, order);
+
+	spin_lock(&page_lock);
+	buddy_release(pp, order);
+	spin_unlock(&page_lock);
+}
+
+//
+// Print how much memory is free in blocks of each order, and for each
+// order the percentage of free memory that is in smaller blocks and
+// so cannot satisfy an allocation of that order.
+//
+void
+page_buddy_print(void)
+{
+	size_t nfree[BUDDY_MAX_ORDER + 1];
+	size_t total = 0, above;
+	int k;
+
+	spin_lock(&page_lock);
+	memmove(nfree, buddy_nfree, sizeof nfree);
+	spin_unlock(&page_lock);
+
+	for (k = 0; k <= BUDDY_MAX_ORDER; k++)
+		total += nfree[k] << k;
+	cprintf("order  blocks    pages  unusable\n");
+	above = total;
+	for (k = 0; k <= BUDDY_MAX_ORDER; k++) {
+		cprintf("%5d %7u %8u %8u%%\n", k, nfree[k], nfree[k] << k,
+			total ? (total - above) * 100 / total : 0);
+		above -= nfree[k] << k;
+	}
+	cprintf("%u free pages (%uK) outside the per-CPU magazines\n",
+		total, total * PGSIZE / 1024);
+	cprintf("%u pre-zeroed pages\n", page_nzero);
 }
 
 //
 // Decrement the reference count on a page,
 // freeing it if there are no more refs.
+// Only the CPU whose decrement takes pp_ref to zero frees the page.
 //
 void
 page_decref(struct PageInfo* pp)
 {
-	if (pp->pp_ref == 0)
+	uint16_t old = (uint16_t) -1;
+
+	if (pp->pp_ref == 0 || pp == page_zero)
 		return;
-	if (--pp->pp_ref == 0)
-		page_free(pp);
-	else if (pp->pp_ref > 0xfff){
-		panic("page pp: (%x) has invalid pp_ref of %u!!\n",pp,pp->pp_ref);
+	__asm __volatile("lock; xaddw %0, %1"
+			 : "+r" (old), "+m" (pp->pp_ref) : : "memory");
+	if (old == 1 && !tlb_defer_free(pp))
+		page_free_order(pp, pp->pp_order);
+	else if ((uint16_t) (old - 1) > 0xfff){
+		panic("page pp: (%x) has invalid pp_ref of %u!!\n",pp,old - 1);
 	}
 }
 
+// The page holding the page table (or page directory, or page
+// directory pointer table) that 'entry' is in.  Its pp_live counts
+// the table's present entries, so that page_remove can free it once
+// the last one goes.  Entries of the PML4 itself are not counted.
+static struct PageInfo *
+pt_page(void *entry)
+{
+	return pa2page(PADDR(ROUNDDOWN(entry, PGSIZE)));
+}
+
 // Given a pml4 pointer, pml4e_walk returns a pointer
 // to the page table entry (PTE) for linear address 'va'
 // This requires walking the 4-level page table structure
@@ -523,7 +1054,8 @@ pml4e_walk(pml4e_t *pml4, const void *va, int create)
 			
 			unsigned int perm = PTE_P | PTE_W | PTE_U;
 			*pml4_tep = page2pa(page) | perm;
-			page->pp_ref++;
+			page_incref(page);
+			page->pp_live = 0;
 		}
 		else{
 			return NULL;
@@ -575,23 +1107,73 @@ pdpe_walk(pdpe_t *pdp, const void *va, int create){
 			// Physical address is a multiple of pagesize - lower 12 bits are flags and permissions
 			unsigned int perm = PTE_P | PTE_W | PTE_U;
 			*pdpe_tep = page2pa(page) | perm;
-			page->pp_ref++;
+			page_incref(page);
+			page->pp_live = 0;
+			pt_page(pdpe_tep)->pp_live++;
 		}
 		else{
 			return NULL;
 		}
 	}
+	// A 1GB page (see boot_map_region): the PDPE itself maps va.
+	if (*pdpe_tep & PTE_PS)
+		return pdpe_tep;
 	pte_t * res = pgdir_walk(KADDR((*pdpe_tep) & ~0xfff),va,create);
 	if (!res){
 		if (create && page != NULL){
 			page_decref(page);
 			*pdpe_tep = 0; //THIS IS WHAT I WAS MISSING!
+			pt_page(pdpe_tep)->pp_live--;
 			return NULL;
 		}
 	}
 	return res; 
 }
 
+// Like pml4e_walk, but stop two levels up: return a pointer to the
+// page directory pointer entry for 'va', allocating the page directory
+// pointer table if 'create' is set.  Used to install 1GB mappings.
+static pdpe_t *
+pml4e_walk_pdpe(pml4e_t *pml4, const void *va, int create)
+{
+	pml4e_t *pml4e = &pml4[PML4(va)];
+	struct PageInfo *page;
+
+	if (!(*pml4e & PTE_P)) {
+		if (!create || !(page = page_alloc(ALLOC_ZERO)))
+			return NULL;
+		*pml4e = page2pa(page) | PTE_P | PTE_W | PTE_U;
+		page_incref(page);
+		page->pp_live = 0;
+	}
+	return (pdpe_t *) KADDR(PTE_ADDR(*pml4e)) + PDPE(va);
+}
+
+// Like pml4e_walk, but stop one level up: return a pointer to the page
+// directory entry for 'va', allocating the page directory pointer
+// table and page directory if 'create' is set.  Used to install
+// 2MB mappings.
+static pde_t *
+pml4e_walk_pde(pml4e_t *pml4, const void *va, int create)
+{
+	pdpe_t *pdpe;
+	struct PageInfo *page;
+
+	if (!(pdpe = pml4e_walk_pdpe(pml4, va, create)))
+		return NULL;
+	if (!(*pdpe & PTE_P)) {
+		// An empty page directory pointer table left behind on
+		// failure is harmless; env_free reclaims it.
+		if (!create || !(page = page_alloc(ALLOC_ZERO)))
+			return NULL;
+		*pdpe = page2pa(page) | PTE_P | PTE_W | PTE_U;
+		page_incref(page);
+		page->pp_live = 0;
+		pt_page(pdpe)->pp_live++;
+	}
+	return (pde_t *) KADDR(PTE_ADDR(*pdpe)) + PDX(va);
+}
+
 // Given 'pgdir', a pointer to a page directory, pgdir_walk returns
 // a pointer to the page table entry (PTE). 
 // The programming logic and the hints are the same as pml4e_walk
@@ -618,17 +1200,23 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 				return NULL;
 			unsigned int perm = PTE_P | PTE_W | PTE_U;
 			*pde_tep = page2pa(page) | perm;
-			page->pp_ref++;
+			page_incref(page);
+			page->pp_live = 0;
+			pt_page(pde_tep)->pp_live++;
 		}
 		else{
 			return NULL;
 		}
 	}
+	// A 2MB page (see page_insert_huge): the PDE itself maps va.
+	if (*pde_tep & PTE_PS)
+		return pde_tep;
 	pte_t *res = KADDR((*pde_tep) & ~0xfff);
 	if (!res){
 		if (create && page != NULL){
 			page_decref(page);
 			*pde_tep = 0; //THIS IS WHAT I WAS MISSING!
+			pt_page(pde_tep)->pp_live--;
 			return NULL;
 		}
 	}
@@ -645,16 +1233,36 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
 // above UTOP. As such, it should *not* change the pp_ref field on the
 // mapped pages.
 //
+// Spans where la and pa are both aligned to a large page are mapped
+// with 1GB pages (if the CPU has them) or 2MB pages, so that e.g. the
+// KERNBASE map of all of physical memory needs few page tables and
+// few TLB entries.  The regions mapped here never overlap, so a large
+// page never has to be split.
+//
 // Hint: the TA solution uses pml4e_walk
 static void
 boot_map_region(pml4e_t *pml4, uintptr_t la, size_t size, physaddr_t pa, int perm)
 {
 	uintptr_t addr = la;
+	physaddr_t a;
 	pte_t *pte;
 	while (addr < la + size ){
-		pte = pml4e_walk(pml4,(void*)addr,1);
-		*pte = (pa + (addr-la)) | (perm|PTE_P);
-		addr+=PGSIZE;
+		a = pa + (addr - la);
+		if (page_1gb && (addr | a) % PDPSIZE == 0
+		    && la + size - addr >= PDPSIZE) {
+			pte = pml4e_walk_pdpe(pml4,(void*)addr,1);
+			*pte = a | (perm|PTE_P|PTE_PS|PTE_G);
+			addr += PDPSIZE;
+		} else if ((addr | a) % PTSIZE == 0
+			   && la + size - addr >= PTSIZE) {
+			pte = pml4e_walk_pde(pml4,(void*)addr,1);
+			*pte = a | (perm|PTE_P|PTE_PS|PTE_G);
+			addr += PTSIZE;
+		} else {
+			pte = pml4e_walk(pml4,(void*)addr,1);
+			*pte = a | (perm|PTE_P|PTE_G);
+			addr+=PGSIZE;
+		}
 	}		
 }
 
@@ -686,7 +1294,12 @@ boot_map_region(pml4e_t *pml4, uintptr_t la, size_t size, physaddr_t pa, int per
 int
 page_insert(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm)
 {
+	struct PageInfo *old;
+
 	//cprintf("calling page_insert with pp: %x va: %x\n",pp,va);
+	// Changing a PTE in a page table shared by fork needs our own copy.
+	if (page_unshare(pml4e,va) < 0)
+		return -E_NO_MEM;
 	pte_t *ptep = pml4e_walk(pml4e,va,1);
 
 	//if ptep is NULL then pml4e_walk was unable to create a new page table
@@ -694,24 +1307,328 @@ page_insert(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm)
 		return -E_NO_MEM;
 	}	
 
+	// va is inside a 2MB mapping, which is only ever replaced or
+	// removed as a whole.
+	if (*ptep & PTE_PS)
+		return -E_INVAL;
 	
 //	*ptep = page2pa(pp) | perm | PTE_P;
 
 	if (PTE_ADDR(*ptep) == page2pa(pp)){
 	
 		*ptep = page2pa(pp) | perm | PTE_P;
+		tlb_invalidate(pml4e,va);
 		return 0;
 	}
 
-	if (*ptep & PTE_P){
-		page_remove(pml4e,va);
-	}
-	pp->pp_ref++;
+	// Replace the old page in place rather than with page_remove,
+	// which would free the page table if va was its last mapping.
+	old = (*ptep & PTE_P) ? pa2page(PTE_ADDR(*ptep)) : NULL;
+	page_incref(pp);
 
 	*ptep = page2pa(pp) | perm | PTE_P;
+	if (old) {
+		tlb_invalidate(pml4e,va);
+		page_decref(old);
+	} else
+		pt_page(ptep)->pp_live++;
+	return 0;
+}
+
+//
+// Map the 2MB page whose first page is 'pp' (from
+// page_alloc_order(HUGE_ORDER, ...)) at 'va', which must be 2MB
+// aligned, with a single PTE_PS page directory entry.  Whatever was
+// mapped in [va, va+PTSIZE) before is unmapped, and a page table that
+// covered the range is freed.  As with page_insert, pp_ref on 'pp'
+// counts the mappings of the whole 2MB page.
+//
+// RETURNS:
+//   0 on success
+//   -E_NO_MEM, if a page directory could not be allocated
+//
+int
+page_insert_huge(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm)
+{
+	pde_t *pde, old;
+	pte_t *pt;
+	int i;
+
+	assert((uintptr_t) va % PTSIZE == 0);
+	assert(page2ppn(pp) % NPTENTRIES == 0);
+
+	if (page_unshare(pml4e, va) < 0 ||
+	    !(pde = pml4e_walk_pde(pml4e, va, 1)))
+		return -E_NO_MEM;
+
+	if ((*pde & PTE_P) && (*pde & PTE_PS)
+	    && PTE_ADDR(*pde) == page2pa(pp)) {
+		*pde = page2pa(pp) | perm | PTE_P | PTE_PS;
+		tlb_invalidate(pml4e, va);
+		return 0;
+	}
+
+	// Whatever was there is replaced in place, so the page
+	// directory keeps its count of present entries.
+	old = *pde;
+	page_incref(pp);
+	*pde = page2pa(pp) | perm | PTE_P | PTE_PS;
+	if (!(old & PTE_P)) {
+		pt_page(pde)->pp_live++;
+		return 0;
+	}
+	if (old & PTE_PS) {
+		tlb_invalidate(pml4e, va);
+		page_decref(pa2page(PTE_ADDR(old)));
+		return 0;
+	}
+	tlb_flush(pml4e);
+	pt = KADDR(PTE_ADDR(old));
+	for (i = 0; i < NPTENTRIES; i++)
+		if (pt[i] & PTE_P)
+			page_decref(pa2page(PTE_ADDR(pt[i])));
+	page_decref(pa2page(PTE_ADDR(old)));
 	return 0;
 }
 
+//
+// The permissions fork gives both parent and child for a user mapping
+// 'pte': shared pages (PTE_SHARE) keep theirs, writable and
+// copy-on-write pages become copy-on-write, and others read-only.
+//
+static int
+page_fork_perm(pte_t pte)
+{
+	if (pte & PTE_SHARE)
+		return pte & PTE_SYSCALL;
+	if (pte & (PTE_W | PTE_COW))
+		return PTE_COW | PTE_U | PTE_P;
+	return PTE_U | PTE_P;
+}
+
+//
+// Copy the user mappings of 'src' below USTACKTOP into 'dst' for fork.
+//
+// Page tables are not copied but shared: both page directories point
+// at the same table, read-only and marked PDE_COW, and the table's
+// pp_ref counts them.  The pages it maps are not touched, so fork
+// costs one step per page table, not per page.  Whichever side first
+// changes a PTE in the table, or writes through it, gets its own copy
+// from page_unshare.
+//
+// 2MB pages are mapped into 'dst' with the permissions given by
+// page_fork_perm, and made copy-on-write in 'src' if writable.
+//
+// RETURNS:
+//   0 on success
+//   -E_NO_MEM, if a page directory for 'dst' could not be allocated
+//
+int
+page_fork(pml4e_t *src, pml4e_t *dst)
+{
+	pdpe_t *pdpe;
+	pde_t *pgdir, *dpde;
+	uintptr_t va;
+	uint64_t i, j;
+	int perm, r = 0;
+	bool flush = 0;
+
+	if (!(src[0] & PTE_P))
+		return 0;
+	pdpe = KADDR(PTE_ADDR(src[0]));
+	for (i = 0; i < NPDPENTRIES && r == 0; i++) {
+		if (!(pdpe[i] & PTE_P))
+			continue;
+		pgdir = KADDR(PTE_ADDR(pdpe[i]));
+		for (j = 0; j < NPDENTRIES; j++) {
+			va = (uintptr_t) PGADDR((uint64_t) 0, i, j, 0, 0);
+			if (va >= USTACKTOP)
+				break;
+			if (!(pgdir[j] & PTE_P))
+				continue;
+
+			if (pgdir[j] & PTE_PS) {
+				perm = page_fork_perm(pgdir[j]);
+				r = page_insert_huge(dst,
+					pa2page(PTE_ADDR(pgdir[j])),
+					(void *) va, perm);
+				if (r < 0)
+					break;
+				if ((perm & PTE_COW) && (pgdir[j] & PTE_W)) {
+					pgdir[j] = (pgdir[j] & ~PTE_W) | PTE_COW;
+					flush = 1;
+				}
+				continue;
+			}
+
+			if (!(dpde = pml4e_walk_pde(dst, (void *) va, 1))) {
+				r = -E_NO_MEM;
+				break;
+			}
+			assert(!(*dpde & PTE_P));
+			spin_lock(&pt_share_lock);
+			if (pgdir[j] & PTE_W) {
+				pgdir[j] = (pgdir[j] & ~PTE_W) | PDE_COW;
+				flush = 1;
+			}
+			page_incref(pa2page(PTE_ADDR(pgdir[j])));
+			*dpde = pgdir[j];
+			pt_page(dpde)->pp_live++;
+			spin_unlock(&pt_share_lock);
+		}
+	}
+
+	// Our writable TLB entries for the pages now shared must go.
+	if (flush)
+		tlb_flush(src);
+	return r;
+}
+
+//
+// Give 'pml4e' its own copy of the page table that maps 'va', if that
+// table is shared (PDE_COW).  Every page the table maps gains a
+// reference, and writable ones become copy-on-write, in both copies;
+// PTE_SHARE pages stay writable.  Called before a PTE in a possibly
+// shared table is changed, or a page in one is written, with the lock
+// of the env owning 'pml4e' held.
+//
+// RETURNS:
+//   0 on success, or if the table is not shared
+//   -E_NO_MEM, if there is no memory for the copy
+//
+int
+page_unshare(pml4e_t *pml4e, void *va)
+{
+	struct PageInfo *old, *copy;
+	pde_t *pde;
+	pte_t *src, *dst, pte;
+	int i;
+
+	if ((uintptr_t) va >= UTOP)
+		return 0;
+	pde = pml4e_walk_pde(pml4e, va, 0);
+	if (!pde || (*pde & (PTE_P | PTE_PS | PDE_COW)) != (PTE_P | PDE_COW))
+		return 0;
+
+	spin_lock(&pt_share_lock);
+	old = pa2page(PTE_ADDR(*pde));
+	if (old->pp_ref == 1) {
+		// The others have let go of it: it's ours.
+		*pde = (*pde & ~PDE_COW) | PTE_W;
+	} else {
+		if (!(copy = page_alloc(0))) {
+			spin_unlock(&pt_share_lock);
+			return -E_NO_MEM;
+		}
+		src = KADDR(PTE_ADDR(*pde));
+		dst = page2kva(copy);
+		for (i = 0; i < NPTENTRIES; i++) {
+			pte = src[i];
+			if (pte & PTE_P) {
+				page_incref(pa2page(PTE_ADDR(pte)));
+				if ((pte & PTE_W) && !(pte & PTE_SHARE)) {
+					pte = (pte & ~PTE_W) | PTE_COW;
+					src[i] = pte;
+				}
+			}
+			dst[i] = pte;
+		}
+		page_incref(copy);
+		copy->pp_live = old->pp_live;
+		*pde = page2pa(copy) | (*pde & 0xFFF & ~PDE_COW) | PTE_W;
+		page_decref(old);
+	}
+	spin_unlock(&pt_share_lock);
+
+	// Entries cached from the shared table are read-only.
+	tlb_flush(pml4e);
+	return 0;
+}
+
+//
+// Drop a reference to the page table 'pde' points to, for env_free.
+// If other address spaces share the table, clear 'pde' and return
+// true: the table's pages are theirs now.  Otherwise return false;
+// the caller frees the table's pages and then the table.
+//
+bool
+page_table_put(pde_t *pde)
+{
+	struct PageInfo *pt;
+	bool shared = 0;
+
+	if ((*pde & (PTE_P | PTE_PS | PDE_COW)) != (PTE_P | PDE_COW))
+		return 0;
+	spin_lock(&pt_share_lock);
+	pt = pa2page(PTE_ADDR(*pde));
+	if (pt->pp_ref > 1) {
+		*pde = 0;
+		page_decref(pt);
+		shared = 1;
+	} else
+		*pde = (*pde & ~PDE_COW) | PTE_W;
+	spin_unlock(&pt_share_lock);
+	return shared;
+}
+
+//
+// Resolve a write fault at 'va' on a copy-on-write page (PTE_COW):
+// make the page writable if this is its only mapping, and give 'pml4e'
+// a private, writable copy of it otherwise.  Faults on page tables
+// shared by fork (PDE_COW) are resolved here too.  The caller holds the lock
+// of the env owning 'pml4e', so pp_ref cannot grow behind our back.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if 'va' is not mapped copy-on-write
+//   -E_NO_MEM, if there is no memory for the copy
+//
+int
+page_cow(pml4e_t *pml4e, void *va)
+{
+	struct PageInfo *pp, *copy;
+	pte_t *pte;
+	int huge, perm, r;
+
+	// The write may have hit a page table shared by fork.
+	if ((r = page_unshare(pml4e, va)) < 0)
+		return r;
+	pp = page_lookup(pml4e, va, &pte);
+	if (pp && (*pte & PTE_P) && (*pte & PTE_W))
+		return 0;	// Only the table was read-only.
+	if (!pp || !(*pte & PTE_P) || !(*pte & PTE_COW))
+		return -E_INVAL;
+	huge = !!(*pte & PTE_PS);
+	if (huge)
+		va = ROUNDDOWN(va, PTSIZE);
+	perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+
+	// The fault flushed the read-only TLB entry for va (and the
+	// env runs on no other CPU), so there is nothing to invalidate.
+	if (pp->pp_ref == 1 && pp != page_zero) {
+		*pte = (*pte & ~PTE_COW) | PTE_W;
+		return 0;
+	}
+
+	if (pp == page_zero) {
+		// First write to demand-zero memory: the pre-zeroed pool
+		// usually has a page ready.
+		if (!(copy = page_alloc(ALLOC_ZERO)))
+			return -E_NO_MEM;
+	} else {
+		if (!(copy = page_alloc_order(huge ? HUGE_ORDER : 0, 0)))
+			return -E_NO_MEM;
+		memcpy(page2kva(copy), page2kva(pp), huge ? PTSIZE : PGSIZE);
+	}
+	if (huge)
+		r = page_insert_huge(pml4e, copy, va, perm);
+	else
+		r = page_insert(pml4e, copy, va, perm);
+	if (r < 0)
+		page_free_order(copy, huge ? HUGE_ORDER : 0);
+	return r;
+}
+
 //
 // Return the page mapped at virtual address 'va'.
 // If pte_store is not zero, then we store in it the address
@@ -738,9 +1655,46 @@ page_lookup(pml4e_t *pml4e, void *va, pte_t **pte_store)
 	return page;
 }
 
+//
+// Account for the removal of 'entry', the page table entry or 2MB
+// page directory entry that mapped 'va' in 'pml4e', and unlink each
+// table the removal leaves empty, from the bottom up.  The unlinked
+// tables are stored in 'tables' and their number returned; the caller
+// frees them once the TLB no longer holds translations through them.
+//
+// Only the tables of the user part of an env's address space are
+// freed: the kernel's (boot_pml4's, and those env address spaces
+// share with it above the first PML4 entry) must stay put.
+//
+static int
+pt_unlink(pml4e_t *pml4e, void *va, void *entry, struct PageInfo **tables)
+{
+	uint64_t *up[3];
+	struct PageInfo *t;
+	int i, n = 0;
+
+	// The entries pointing to the page table, page directory and
+	// page directory pointer table that map va.
+	up[2] = &pml4e[PML4(va)];
+	up[1] = (pdpe_t *) KADDR(PTE_ADDR(*up[2])) + PDPE(va);
+	up[0] = (pde_t *) KADDR(PTE_ADDR(*up[1])) + PDX(va);
+
+	for (i = (entry == up[0]) ? 1 : 0; i < 3; i++) {
+		t = pt_page(entry);
+		if (--t->pp_live > 0 || pml4e == boot_pml4 || PML4(va) != 0)
+			break;
+		*up[i] = 0;
+		tables[n++] = t;
+		entry = up[i];
+	}
+	return n;
+}
+
 //
 // Unmaps the physical page at virtual address 'va'.
 // If there is no physical page at that address, silently does nothing.
+// Returns 0 on success, or -E_NO_MEM if the page table holding 'va' is
+// shared by fork and cannot be copied, in which case the mapping stays.
 //
 // Details:
 //   - The ref count on the physical page should decrement.
@@ -753,21 +1707,32 @@ page_lookup(pml4e_t *pml4e, void *va, pte_t **pte_store)
 // Hint: The TA solution is implemented using page_lookup,
 // 	tlb_invalidate, and page_decref.
 //
-void
+int
 page_remove(pml4e_t *pml4e, void *va)
 {
 	//cprintf("calling page_remove with %x %x\n", pml4e,va);
-	struct PageInfo *pp;
+	struct PageInfo *pp, *tables[3];
 	pte_t *ptep;
+	int n;
+
+	if (page_unshare(pml4e,va) < 0)
+		return -E_NO_MEM;
 	pp = page_lookup(pml4e,va,&ptep);
 
 	
 	if (pp && (*ptep & PTE_P)){
 		//cprintf("page_remove inner condition satisfied\n");
 		*ptep = 0;
-		page_decref(pp);
+		n = pt_unlink(pml4e, va, ptep, tables);
+		// Invalidate first: if other CPUs must flush the entry,
+		// page_decref holds the page back until they have.  The
+		// flush covers the paging-structure caches for va too.
 		tlb_invalidate(pml4e,va);
+		page_decref(pp);
+		while (n > 0)
+			page_decref(tables[--n]);
 	} 
+	return 0;
 }
 
 //
@@ -777,12 +1742,139 @@ page_remove(pml4e_t *pml4e, void *va)
 void
 tlb_invalidate(pml4e_t *pml4e, void *va)
 {
-	// Flush the entry only if we're modifying the current address space.
+	struct PageInfo *root;
+	struct PcidCache *pc;
+	uint32_t gen;
+	int p;
+
 	assert(pml4e!=NULL);
-	if (!curenv || curenv->env_pml4e == pml4e)
+
+	// Entries for this address space tagged with an old generation
+	// are stale, here and on every other CPU.
+	root = pa2page(PADDR(pml4e));
+	gen = page_tlb_gen_bump(root);
+
+	// Flush the entry now if we're modifying the current address
+	// space.  This CPU's PCID for it stays current if it was.
+	// Other CPUs running in it flush at our next tlb_shootdown.
+	tlb_shootdown_add(pml4e, va);
+
+	if (!curenv || curenv->env_pml4e == pml4e) {
 		invlpg(va);
+		if (pcid_on && curenv) {
+			pc = &pcid_caches[cpunum()];
+			p = pc->pcid_cur;
+			if (p && pc->pcid_gen[p] == gen)
+				pc->pcid_gen[p] = gen + 1;
+		}
+		return;
+	}
+
+	// This CPU may still hold entries for it under another PCID.
+	if (invpcid_on) {
+		pc = &pcid_caches[cpunum()];
+		for (p = 1; p < NPCID; p++)
+			if (pc->pcid_cr3[p] == PADDR(pml4e)) {
+				invpcid(INVPCID_ADDR, p, (uintptr_t) va);
+				if (pc->pcid_gen[p] == gen)
+					pc->pcid_gen[p] = gen + 1;
+				break;
+			}
+	}
 }
 
+//
+// Invalidate all of the TLB entries for an address space, for when
+// too many of its mappings changed (or a page directory entry did) to
+// invalidate them one by one.
+//
+void
+tlb_flush(pml4e_t *pml4e)
+{
+	struct PageInfo *root;
+	struct PcidCache *pc;
+	uint32_t gen;
+	int p;
+
+	root = pa2page(PADDR(pml4e));
+	gen = page_tlb_gen_bump(root);
+	tlb_shootdown_add_all(pml4e);
+
+	// Reloading cr3 without CR3_NOFLUSH flushes the current PCID.
+	if (!curenv || curenv->env_pml4e == pml4e) {
+		lcr3(rcr3());
+		if (pcid_on && curenv) {
+			pc = &pcid_caches[cpunum()];
+			p = pc->pcid_cur;
+			if (p && pc->pcid_gen[p] == gen)
+				pc->pcid_gen[p] = gen + 1;
+		}
+		return;
+	}
+
+	if (invpcid_on) {
+		pc = &pcid_caches[cpunum()];
+		for (p = 1; p < NPCID; p++)
+			if (pc->pcid_cr3[p] == PADDR(pml4e)) {
+				invpcid(INVPCID_PCID, p, 0);
+				if (pc->pcid_gen[p] == gen)
+					pc->pcid_gen[p] = gen + 1;
+				break;
+			}
+	}
+}
+
+//
+// Load e's address space on this CPU.  With PCIDs, reuse the TLB
+// entries this CPU still holds for it if they are current, and flush
+// the ones of its PCID otherwise.
+//
+void
+pmap_load(struct Env *e)
+{
+	struct PcidCache *pc;
+	struct PageInfo *root;
+	int p;
+
+	tlb_set_loaded(e->env_pml4e);
+	if (!pcid_on) {
+		lcr3(e->env_cr3);
+		return;
+	}
+
+	pc = &pcid_caches[cpunum()];
+	root = pa2page(e->env_cr3);
+	p = pc->env_pcid[ENVX(e->env_id)];
+	if (p && pc->pcid_cr3[p] == e->env_cr3
+	    && pc->pcid_gen[p] == root->pp_tlb_gen) {
+		pc->pcid_cur = p;
+		lcr3(e->env_cr3 | p | CR3_NOFLUSH);
+		return;
+	}
+
+	// Recycle a PCID if e has lost its own.
+	if (!p || pc->pcid_cr3[p] != e->env_cr3) {
+		p = pc->pcid_next % (NPCID - 1) + 1;
+		pc->pcid_next = p;
+		pc->env_pcid[ENVX(e->env_id)] = p;
+		pc->pcid_cr3[p] = e->env_cr3;
+	}
+	// Read the generation before the flush: a later bump must make
+	// us flush again.
+	pc->pcid_gen[p] = root->pp_tlb_gen;
+	pc->pcid_cur = p;
+	lcr3(e->env_cr3 | p);
+}
+
+//
+// Per-CPU paging setup: turn on global pages and, if the CPU has them,
+// PCIDs.  Called on each CPU once it runs on boot_pml4.
+//
+void
+pmap_init_percpu(void)
+{
+	lcr4(rcr4() | CR4_PGE | (pcid_on ? CR4_PCIDE : 0));
+}
 //
 // Reserve size bytes in the MMIO region and map [pa, pa+size) at this
 // location.  Return the base of the reserved region.  'size' does *not*
@@ -1132,11 +2224,15 @@ check_va2pa(pml4e_t *pml4e, uintptr_t va)
 	// cprintf(" %x %x " , pdpe, *pdpe);
 	if (!(pdpe[PDPE(va)] & PTE_P))
 		return ~0;
+	if (pdpe[PDPE(va)] & PTE_PS)
+		return PTE_ADDR(pdpe[PDPE(va)]) + (va & (PDPSIZE - 1) & ~(PGSIZE - 1));
 	pde = (pde_t *) KADDR(PTE_ADDR(pdpe[PDPE(va)]));
 	// cprintf(" %x %x " , pde, *pde);
 	pde = &pde[PDX(va)];
 	if (!(*pde & PTE_P))
 		return ~0;
+	if (*pde & PTE_PS)
+		return PTE_ADDR(*pde) + (va & (PTSIZE - 1) & ~(PGSIZE - 1));
 	pte = (pte_t*) KADDR(PTE_ADDR(*pde));
 	// cprintf(" %x %x " , pte, *pte);
 	if (!(pte[PTX(va)] & PTE_P))
@@ -14,6 +14,7 @@ extern char bootstacktop[], bootstack[];
 
 extern struct PageInfo *pages;
 extern size_t npages;
+extern struct PageInfo *page_zero;
 
 extern pml4e_t *boot_pml4;
 
@@ -48,17 +49,38 @@ enum {
 	ALLOC_ZERO = 1<<0,
 };
 
+// page_alloc_order order of a 2MB (PTE_PS) page.
+#define HUGE_ORDER	(PTSHIFT - PGSHIFT)
+
+// In a page directory entry for a page table (not PTE_PS): the table is
+// shared by fork with other address spaces, and the entry is read-only
+// until page_unshare gives this one its own copy.
+#define PDE_COW		PTE_COW
+
 void    x64_vm_init();
 
 void	page_init(void);
 struct PageInfo * page_alloc(int alloc_flags);
 void	page_free(struct PageInfo *pp);
+void	page_mag_drain(void);
+int	page_zero_idle(void);
+struct PageInfo *page_alloc_order(int order, int alloc_flags);
+void	page_free_order(struct PageInfo *pp, int order);
+void	page_buddy_print(void);
 int	page_insert(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm);
-void	page_remove(pml4e_t *pml4e, void *va);
+int	page_insert_huge(pml4e_t *pml4e, struct PageInfo *pp, void *va, int perm);
+int	page_fork(pml4e_t *src, pml4e_t *dst);
+int	page_unshare(pml4e_t *pml4e, void *va);
+bool	page_table_put(pde_t *pde);
+int	page_cow(pml4e_t *pml4e, void *va);
+int	page_remove(pml4e_t *pml4e, void *va);
 struct PageInfo *page_lookup(pml4e_t *pml4e, void *va, pte_t **pte_store);
 void	page_decref(struct PageInfo *pp);
 
 void	tlb_invalidate(pml4e_t *pml4e, void *va);
+void	tlb_flush(pml4e_t *pml4e);
+void	pmap_load(struct Env *e);
+void	pmap_init_percpu(void);
 
 void *	mmio_map_region(physaddr_t pa, size_t size);
 
@@ -91,6 +113,31 @@ page2kva(struct PageInfo *pp)
 	return KADDR(page2pa(pp));
 }
 
+// Take a reference to pp.  A page mapped into several address spaces
+// can have its pp_ref changed on several CPUs at once, so pp_ref is
+// only ever updated with locked instructions (see also page_decref).
+// Mappings of page_zero are not counted.
+static inline void
+page_incref(struct PageInfo *pp)
+{
+	if (pp != page_zero)
+		__asm __volatile("lock; incw %0" : "+m" (pp->pp_ref) : : "memory");
+}
+
+// Bump a PML4 page's pp_tlb_gen and return its old value.  Several
+// CPUs may change the same address space at once under different env
+// locks (a shared page table, or a PML4 freed while another CPU still
+// invalidates it), so like pp_ref it is only updated atomically.
+static inline uint32_t
+page_tlb_gen_bump(struct PageInfo *root)
+{
+	uint32_t old = 1;
+
+	__asm __volatile("lock; xaddl %0, %1"
+			 : "+r" (old), "+m" (root->pp_tlb_gen) : : "memory");
+	return old;
+}
+
 pte_t *pml4e_walk(pml4e_t *pml4, const void *va, int create);
 
 pde_t *pdpe_walk(pdpe_t *pdp, const void *va, int create);
@@ -5,6 +5,8 @@
 #include <inc/stdio.h>
 #include <inc/stdarg.h>
 
+#include <kern/console.h>
+
 
 static void
 putch(int ch, int *cnt)
@@ -19,7 +21,11 @@ vcprintf(const char *fmt, va_list ap)
 	int cnt = 0;
 	va_list aq;
 	va_copy(aq,ap);
+	// Hold the console for the whole message so that lines printed
+	// on different CPUs do not interleave.
+	cons_lock();
 	vprintfmt((void*)putch, &cnt, fmt, aq);
+	cons_unlock();
 	va_end(aq);
 	return cnt;
 
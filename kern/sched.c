@@ -4,6 +4,11 @@
 #include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/monitor.h>
+#include <kern/sched.h>
+#include <kern/cpu.h>
+#include <kern/tlb.h>
+#include <kern/kmem.h>
+#include <kern/ipc.h>
 
 void sched_halt(void);
 
@@ -18,106 +23,617 @@ print_envs(void){
 	}
 }
 
+// Per-CPU multilevel feedback run queues.
+//
+// Every CPU owns ENV_NPRIO FIFOs of ENV_RUNNABLE environments, one per
+// priority level (level 0 is the highest).  sched_yield only looks at
+// its own queues, so picking the next env costs O(ENV_NPRIO) no matter
+// how many (mostly blocked) envs exist.  A CPU whose queues are empty
+// steals from the busiest other CPU before giving up and halting.
+// Envs are queued on the CPU they last ran on where possible (see
+// sched_enqueue), and never run on a CPU outside env_affinity.
+//
+// Envs are never unlinked when they stop being runnable (blocking in
+// sys_ipc_recv, sys_env_set_status, env_destroy, ...).  Instead the
+// stale entry is dropped when it reaches the head of its queue.
+// env_rq_cpu tells whether an env is already queued, so an env that
+// becomes runnable again while still queued is not linked in twice.
+//
+// Feedback: an env that uses up its whole quantum drops one level, an
+// env that blocks in sys_ipc_recv rises one level, and lower levels get
+// longer quanta.  Every SCHED_BOOST_TICKS ticks a CPU moves everything
+// on its queues back to level 0 so CPU-bound envs cannot starve.
+// Envs pinned with sys_env_set_priority never change level.
+//
+// There is no periodic tick.  Each CPU's LAPIC timer is armed one-shot
+// for the earliest of the end of curenv's quantum and the first wakeup
+// on that CPU's sleep queue (see sched_arm_timer), and is left off on
+// an idle CPU with nobody sleeping.  sched_enqueue sends IRQ_RESCHED to
+// a CPU that should look at its queues before its timer next fires.
+//
+// Locking: rq_lock protects a CPU's queues, rq_len, rq_sleep and the
+// env_rq_* and env_sleep_* fields of the envs on them.  It is taken
+// after env locks, so code holding an rq_lock never waits for an env:
+// runq_pop only reads env_status as a hint, and sched_yield checks it
+// again under the env's lock before running the env.  sched_enqueue is
+// called with the env's lock held.  Other CPUs' rq_len and the
+// per-CPU status are read without locks, only to make placement
+// decisions.
+struct RunQueue {
+	struct spinlock rq_lock;
+	struct Env *rq_head[ENV_NPRIO];
+	struct Env *rq_tail[ENV_NPRIO];
+	int rq_len;
+	struct Env *rq_sleep;	// Sleeping envs, earliest wakeup first
+	uint64_t rq_slice_end;	// TSC value at which curenv's quantum ends
+	uint64_t rq_next_boost;	// TSC value of the next priority boost
+};
+
+static struct RunQueue runqs[NCPU];
+
+// Quantum, in ticks, of an env at level 'prio'.  A tick is only a unit
+// of time now, SCHED_TICK_MS long.
+#define SCHED_TICK_MS		10
+#define SCHED_QUANTUM(prio)	(1 << (prio))
+#define SCHED_BOOST_TICKS	100
+#define SCHED_TICKS_TSC(n)	((uint64_t) (n) * SCHED_TICK_MS * tsc_khz)
+// How much longer than the shortest allowed run queue an env's last
+// CPU's queue may be before the env is moved off that CPU.
+#define SCHED_IMBALANCE		2
+
+void
+sched_init(void)
+{
+	int i;
+
+	for (i = 0; i < NCPU; i++)
+		spin_initlock(&runqs[i].rq_lock);
+}
+
+// Append 'e' to level e->env_prio of 'cpu's queues.
+// The caller holds runqs[cpu].rq_lock.
+static void
+runq_push(int cpu, struct Env *e)
+{
+	struct RunQueue *rq = &runqs[cpu];
+	int prio = e->env_prio;
+
+	if (e->env_rq_cpu >= 0)
+		return;
+	e->env_rq_next = NULL;
+	e->env_rq_cpu = cpu;
+	if (rq->rq_tail[prio])
+		rq->rq_tail[prio]->env_rq_next = e;
+	else
+		rq->rq_head[prio] = e;
+	rq->rq_tail[prio] = e;
+	rq->rq_len++;
+}
+
+// Unlink 'e', which follows 'prev' (or is the head) on level 'prio'
+// of 'cpu's queues.  The caller holds runqs[cpu].rq_lock.
+static void
+runq_unlink(int cpu, int prio, struct Env *prev, struct Env *e)
+{
+	struct RunQueue *rq = &runqs[cpu];
+
+	if (prev)
+		prev->env_rq_next = e->env_rq_next;
+	else
+		rq->rq_head[prio] = e->env_rq_next;
+	if (rq->rq_tail[prio] == e)
+		rq->rq_tail[prio] = prev;
+	rq->rq_len--;
+	e->env_rq_next = NULL;
+	e->env_rq_cpu = -1;
+}
+
+// Pop the first runnable env that may run on CPU 'thief' off the
+// highest non-empty level of 'cpu's queues, discarding stale entries.
+// Returns NULL if the queues hold nothing 'thief' can run.
+// The env returned is off every queue, but was only seen to be
+// ENV_RUNNABLE; the caller must check again under its lock.
+static struct Env *
+runq_pop(int cpu, int thief)
+{
+	struct RunQueue *rq = &runqs[cpu];
+	struct Env *e, *prev, *next;
+	int prio;
+
+	spin_lock(&rq->rq_lock);
+	for (prio = 0; prio < ENV_NPRIO; prio++) {
+		prev = NULL;
+		for (e = rq->rq_head[prio]; e; e = next) {
+			next = e->env_rq_next;
+			if (e->env_status != ENV_RUNNABLE) {
+				runq_unlink(cpu, prio, prev, e);
+			} else if (e->env_affinity & (1 << thief)) {
+				runq_unlink(cpu, prio, prev, e);
+				spin_unlock(&rq->rq_lock);
+				return e;
+			} else
+				prev = e;
+		}
+	}
+	spin_unlock(&rq->rq_lock);
+	return NULL;
+}
+
+// Take an env from the longest run queue of another CPU that has
+// something this CPU is allowed to run.  An idle CPU next to a queue
+// with waiting envs is the load imbalance that justifies a migration.
+static struct Env *
+runq_steal(void)
+{
+	struct Env *e;
+	uint32_t tried = 1 << cpunum();
+	int i, victim, len;
+
+	for (;;) {
+		victim = -1;
+		len = 0;
+		for (i = 0; i < ncpu; i++) {
+			if (!(tried & (1 << i)) && runqs[i].rq_len > len) {
+				victim = i;
+				len = runqs[i].rq_len;
+			}
+		}
+		if (victim < 0)
+			return NULL;
+		// The victim may only hold stale entries or envs that are
+		// not allowed here; try the next busiest one.
+		tried |= 1 << victim;
+		if ((e = runq_pop(victim, cpunum())) != NULL)
+			return e;
+	}
+}
+
+// Is anything queued on 'cpu' at a level strictly above 'prio'?
+// Only a hint: reads the queue heads without the lock.
+static bool
+runq_has_above(int cpu, int prio)
+{
+	int i;
+
+	for (i = 0; i < prio; i++)
+		if (runqs[cpu].rq_head[i])
+			return true;
+	return false;
+}
+
+// Move every dynamic-priority env queued on 'cpu' back to level 0.
+static void
+runq_boost(int cpu)
+{
+	struct RunQueue *rq = &runqs[cpu];
+	struct Env *e, *next, *keep_head, *keep_tail;
+	int prio;
+
+	spin_lock(&rq->rq_lock);
+	for (prio = 1; prio < ENV_NPRIO; prio++) {
+		keep_head = keep_tail = NULL;
+		for (e = rq->rq_head[prio]; e; e = next) {
+			next = e->env_rq_next;
+			e->env_rq_next = NULL;
+			if (e->env_prio_pinned != ENV_PRIO_DYNAMIC) {
+				if (keep_tail)
+					keep_tail->env_rq_next = e;
+				else
+					keep_head = e;
+				keep_tail = e;
+				continue;
+			}
+			e->env_prio = 0;
+			if (rq->rq_tail[0])
+				rq->rq_tail[0]->env_rq_next = e;
+			else
+				rq->rq_head[0] = e;
+			rq->rq_tail[0] = e;
+		}
+		rq->rq_head[prio] = keep_head;
+		rq->rq_tail[prio] = keep_tail;
+	}
+	spin_unlock(&rq->rq_lock);
+}
+
+// Program this CPU's timer for the earliest thing it has to act on:
+// 'slice_end' (0 when idle) or the first wakeup on its sleep queue.
+// With neither, the timer stays off until something arms it again.
+static void
+sched_arm_timer(uint64_t slice_end)
+{
+	struct RunQueue *rq = &runqs[cpunum()];
+	uint64_t deadline = slice_end;
+
+	spin_lock(&rq->rq_lock);
+	if (rq->rq_sleep && (!deadline || rq->rq_sleep->env_wakeup < deadline))
+		deadline = rq->rq_sleep->env_wakeup;
+	spin_unlock(&rq->rq_lock);
+	lapic_timer_deadline(deadline);
+}
+
+// Make sure some CPU notices 'e', which was just queued on 'cpu'.
+// A halted CPU sleeps until an interrupt arrives, so wake 'cpu' if it
+// is halted or running something less important than 'e'.  If 'cpu'
+// is busy, wake a halted CPU 'e' may run on instead, so it can steal.
+static void
+sched_kick(int cpu, struct Env *e)
+{
+	struct Env *running = cpus[cpu].cpu_env;
+	int i;
+
+	if (cpu == cpunum())
+		return;
+	if (cpus[cpu].cpu_status == CPU_HALTED ||
+	    (running && running->env_prio > e->env_prio)) {
+		lapic_ipi_cpu(cpu, IRQ_OFFSET + IRQ_RESCHED);
+		return;
+	}
+	for (i = 0; i < ncpu; i++) {
+		if (i != cpunum() && (e->env_affinity & (1 << i)) &&
+		    cpus[i].cpu_status == CPU_HALTED) {
+			lapic_ipi_cpu(i, IRQ_OFFSET + IRQ_RESCHED);
+			return;
+		}
+	}
+}
+
+// Make 'e' (which must be ENV_RUNNABLE) eligible to be picked by
+// sched_yield, at its current level.  The caller holds e's lock.
+//
+// Soft affinity: 'e' goes back to the CPU it last ran on, whose caches
+// and TLB may still hold its working set, unless that CPU's queue is
+// more than SCHED_IMBALANCE entries longer than the shortest one 'e' is
+// allowed on.  A new env starts on the calling CPU.
+void
+sched_enqueue(struct Env *e)
+{
+	int cpu, best, i;
+
+	assert(e->env_status == ENV_RUNNABLE);
+
+	// Still queued, perhaps as a stale entry?  Then runq_pop will find
+	// it.  Check under that queue's lock, so that the entry is not
+	// being dropped as stale at the same time.
+	if ((cpu = e->env_rq_cpu) >= 0) {
+		spin_lock(&runqs[cpu].rq_lock);
+		if (e->env_rq_cpu == cpu) {
+			spin_unlock(&runqs[cpu].rq_lock);
+			return;
+		}
+		spin_unlock(&runqs[cpu].rq_lock);
+	}
+
+	best = -1;
+	for (i = 0; i < ncpu; i++)
+		if ((e->env_affinity & (1 << i)) &&
+		    (best < 0 || runqs[i].rq_len < runqs[best].rq_len))
+			best = i;
+	if (best < 0)
+		best = cpunum();
+
+	cpu = e->env_runs ? e->env_cpunum : cpunum();
+	if (!(e->env_affinity & (1 << cpu)) ||
+	    runqs[cpu].rq_len > runqs[best].rq_len + SCHED_IMBALANCE)
+		cpu = best;
+	spin_lock(&runqs[cpu].rq_lock);
+	runq_push(cpu, e);
+	spin_unlock(&runqs[cpu].rq_lock);
+	sched_kick(cpu, e);
+}
+
+// Queue 'e' again if it is queued on a CPU its affinity no longer
+// allows.  The caller holds e's lock.
+void
+sched_requeue(struct Env *e)
+{
+	struct RunQueue *rq;
+	struct Env *p, *prev;
+	int cpu, prio;
+
+	if ((cpu = e->env_rq_cpu) < 0 || (e->env_affinity & (1 << cpu)))
+		return;
+	rq = &runqs[cpu];
+	spin_lock(&rq->rq_lock);
+	for (prio = 0; prio < ENV_NPRIO && e->env_rq_cpu == cpu; prio++) {
+		prev = NULL;
+		for (p = rq->rq_head[prio]; p; prev = p, p = p->env_rq_next) {
+			if (p == e) {
+				runq_unlink(cpu, prio, prev, e);
+				break;
+			}
+		}
+	}
+	spin_unlock(&rq->rq_lock);
+	if (e->env_status == ENV_RUNNABLE)
+		sched_enqueue(e);
+}
+
+// Raise 'e' one priority level.  Called when it blocks waiting for IPC,
+// which is what interactive envs and servers spend their time doing.
+void
+sched_boost(struct Env *e)
+{
+	if (e->env_prio_pinned == ENV_PRIO_DYNAMIC && e->env_prio > 0)
+		e->env_prio--;
+}
+
+// Put 'e' (curenv) to sleep on this CPU until the TSC reaches 'wakeup'.
+// The caller holds e's lock, and must give up the CPU with sched_yield
+// after releasing it.
+void
+sched_sleep(struct Env *e, uint64_t wakeup)
+{
+	struct RunQueue *rq = &runqs[cpunum()];
+	struct Env **pp;
+
+	sched_cancel_sleep(e);
+	e->env_status = ENV_NOT_RUNNABLE;
+	e->env_wakeup = wakeup;
+	spin_lock(&rq->rq_lock);
+	e->env_sleep_cpu = cpunum();
+	for (pp = &rq->rq_sleep; *pp; pp = &(*pp)->env_sleep_next)
+		if ((*pp)->env_wakeup > wakeup)
+			break;
+	e->env_sleep_next = *pp;
+	*pp = e;
+	spin_unlock(&rq->rq_lock);
+}
+
+// End 'e's sleep, if it is sleeping.  Used when something other than
+// its wakeup time ends the sleep: 'e' is dispatched after being made
+// runnable some other way, or is freed.  The caller holds e's lock.
+void
+sched_cancel_sleep(struct Env *e)
+{
+	struct Env **pp;
+	int cpu;
+
+	if ((cpu = e->env_sleep_cpu) >= 0) {
+		spin_lock(&runqs[cpu].rq_lock);
+		for (pp = &runqs[cpu].rq_sleep; *pp;
+		     pp = &(*pp)->env_sleep_next) {
+			if (*pp == e) {
+				*pp = e->env_sleep_next;
+				break;
+			}
+		}
+		if (e->env_sleep_cpu == cpu) {
+			e->env_sleep_next = NULL;
+			e->env_sleep_cpu = -1;
+		}
+		spin_unlock(&runqs[cpu].rq_lock);
+	}
+	e->env_wakeup = 0;
+}
+
+// Make every env on 'cpu's sleep queue whose wakeup time is <= 'now'
+// runnable again.
+//
+// Each env is taken off the queue under rq_lock and only then locked,
+// so by the time we hold its lock it may have been woken some other
+// way (env_wakeup cleared) or even have gone back to sleep
+// (env_sleep_cpu set again); it is left alone then.
+static void
+sleepq_wake(int cpu, uint64_t now)
+{
+	struct RunQueue *rq = &runqs[cpu];
+	struct Env *e;
+
+	for (;;) {
+		spin_lock(&rq->rq_lock);
+		if ((e = rq->rq_sleep) == NULL || e->env_wakeup > now) {
+			spin_unlock(&rq->rq_lock);
+			return;
+		}
+		rq->rq_sleep = e->env_sleep_next;
+		e->env_sleep_next = NULL;
+		e->env_sleep_cpu = -1;
+		spin_unlock(&rq->rq_lock);
+
+		env_lock(e);
+		if (e->env_sleep_cpu < 0 && e->env_wakeup &&
+		    e->env_status == ENV_NOT_RUNNABLE) {
+			e->env_status = ENV_RUNNABLE;
+			e->env_wakeup = 0;
+			sched_enqueue(e);
+		}
+		env_unlock(e);
+	}
+}
+
+// Called when this CPU's timer fires, i.e. at a deadline set by
+// sched_arm_timer: curenv's quantum ran out or a sleeper is due.
+// Returns if curenv should keep running; otherwise calls sched_yield.
+void
+sched_tick(void)
+{
+	struct RunQueue *rq = &runqs[cpunum()];
+	uint64_t now = read_tsc();
+	bool boost = false;
+
+	sleepq_wake(cpunum(), now);
+
+	if (now >= rq->rq_next_boost) {
+		rq->rq_next_boost = now + SCHED_TICKS_TSC(SCHED_BOOST_TICKS);
+		runq_boost(cpunum());
+		boost = true;
+	}
+
+	if (!curenv || curenv->env_status != ENV_RUNNING)
+		sched_yield();
+
+	if (boost && curenv->env_prio_pinned == ENV_PRIO_DYNAMIC)
+		curenv->env_prio = 0;
+	if (now >= rq->rq_slice_end) {
+		// Used its whole quantum: it looks CPU-bound, demote it
+		// (unless it was just boosted).
+		if (!boost && curenv->env_prio_pinned == ENV_PRIO_DYNAMIC &&
+		    curenv->env_prio < ENV_NPRIO - 1)
+			curenv->env_prio++;
+		sched_yield();
+	}
+
+	// Preempt early if something more important is waiting here.
+	if (runq_has_above(cpunum(), curenv->env_prio))
+		sched_yield();
+	sched_arm_timer(rq->rq_slice_end);
+}
+
+// Called when another CPU sent us IRQ_RESCHED after queueing work
+// here.  Returns if curenv should keep running.
+void
+sched_resched(void)
+{
+	if (!curenv || curenv->env_status != ENV_RUNNING ||
+	    runq_has_above(cpunum(), curenv->env_prio))
+		sched_yield();
+}
+
 // Choose a user environment to run and run it.
+//
+// The env that was running on this CPU goes to the back of its level
+// on the local run queue, so everything that was already waiting there
+// gets a turn first.  If neither the local queues nor any other CPU's
+// queues have anything runnable, halt.
+//
+// Never choose an environment that's currently running on another CPU:
+// an env is claimed (made ENV_RUNNING here) under its lock, and only
+// if it is still ENV_RUNNABLE by then.
+//
+// curenv may already be gone from this CPU: once it has blocked (or
+// been queued by an earlier sched_yield) another CPU can claim it
+// before we get here.  Only an env that is ENV_RUNNING or ENV_DYING
+// with env_cpunum == cpunum() is still ours.
 void
 sched_yield(void)
 {
-	struct Env *idle;
-	// Implement simple round-robin scheduling.
-	//
-	// Search through 'envs' for an ENV_RUNNABLE environment in
-	// circular fashion starting just after the env this CPU was
-	// last running.  Switch to the first such environment found.
-	//
-	// If no envs are runnable, but the environment previously
-	// running on this CPU is still ENV_RUNNING, it's okay to
-	// choose that environment.
-	//
-	// Never choose an environment that's currently running on
-	// another CPU (env_status == ENV_RUNNING). If there are
-	// no runnable environments, simply drop through to the code
-	// below to halt the cpu.
-/*
-	Your next task in this lab is to change the JOS kernel so that 
-	it can alternate between multiple environments in "round-robin" 
-	fashion. Round-robin scheduling in JOS works as follows:
-
-	The function sched_yield() in the new kern/sched.c is responsible for selecting 
-	a new environment to run. It searches sequentially through the envs[] array in 
-	circular fashion, starting just after the previously running environment (or at 
-	the beginning of the array if there was no previously running environment), picks 
-	the first environment it finds with a status of ENV_RUNNABLE (see inc/env.h), and 
-	calls env_run() to jump into that environment.
-
-	sched_yield() must never run the same environment on two CPUs at the same time. It can tell 
-	that an environment is currently running on some CPU (possibly the current CPU) because that 
-	environment's status will be ENV_RUNNING.
-	We have implemented a new system call for you, sys_yield(), which user environments can call 
-	to invoke the kernel's sched_yield() function and thereby 
-	voluntarily give up the CPU to a different environment.*/
-
-	// LAB 4: Your code here.	
-		
-	struct Env* e;
-	int i,env_num = 0;
-	if (curenv){
-		env_num = ENVX(curenv->env_id) + 1;
-	}
-	//cprintf("printing envs\n");
-	//print_envs();
-	for (i = 0; i < NENV; i++){
-		//circular iteration
-		e = &envs[(i+env_num) % NENV];
-		if (e->env_status == ENV_RUNNABLE){
-
-			env_run(e);	
+	struct RunQueue *rq = &runqs[cpunum()];
+	struct Env *e;
+
+	if ((e = curenv) != NULL) {
+		env_lock(e);
+		if (e->env_cpunum == cpunum() && e->env_status == ENV_DYING) {
+			env_free(e);
+			curenv = NULL;
+		} else {
+			if (e->env_cpunum == cpunum() &&
+			    e->env_status == ENV_RUNNING) {
+				e->env_status = ENV_RUNNABLE;
+				sched_enqueue(e);
+			}
+			env_unlock(e);
 		}
 	}
-	if (thiscpu->cpu_env && (thiscpu->cpu_env->env_status == ENV_RUNNING)){
-		env_run(thiscpu->cpu_env);
+
+	// sched_halt returns only if work was queued here while it was
+	// getting ready to halt; look again without growing the stack.
+	for (;;) {
+		while ((e = runq_pop(cpunum(), cpunum())) != NULL ||
+		       (e = runq_steal()) != NULL) {
+			env_lock(e);
+			if (e->env_status != ENV_RUNNABLE) {
+				env_unlock(e);
+				continue;
+			}
+			e->env_status = ENV_RUNNING;
+			if (e->env_runs && e->env_cpunum != cpunum())
+				e->env_migrations++;
+			e->env_cpunum = cpunum();
+			sched_cancel_sleep(e);
+			ipc_cancel_send(e);
+			env_unlock(e);
+
+			rq->rq_slice_end = read_tsc() +
+				SCHED_TICKS_TSC(SCHED_QUANTUM(e->env_prio));
+			sched_arm_timer(rq->rq_slice_end);
+			env_run(e);
+		}
+		sched_halt();
 	}
-	// sched_halt never returns
-	//cprintf("printing envs:\n");
-	//print_envs();
-	sched_halt();
 }
 
 
 
-// Halt this CPU when there is nothing to do. Wait until the
-// timer interrupt wakes it up. This function never returns.
+// Run 'e' on this CPU right away, in place of curenv, which has just
+// handed it an IPC message and blocked (see sys_ipc_call): e skips
+// the run queues and gets the rest of curenv's time slice.  The
+// caller holds e's lock, and has set e's return value.  If e may not
+// run here, it is queued as usual instead.
+void
+sched_switch(struct Env *e)
+{
+	if (!(e->env_affinity & (1 << cpunum()))) {
+		e->env_status = ENV_RUNNABLE;
+		sched_enqueue(e);
+		env_unlock(e);
+		sched_yield();
+	}
+
+	e->env_status = ENV_RUNNING;
+	if (e->env_runs && e->env_cpunum != cpunum())
+		e->env_migrations++;
+	e->env_cpunum = cpunum();
+	sched_cancel_sleep(e);
+	env_unlock(e);
+	env_run(e);
+}
+
+// Halt this CPU when there is nothing to do. Wait until an interrupt
+// wakes it up: our timer, armed only if an env sleeping here is due,
+// or an IRQ_RESCHED from a CPU that queued work for us.
+// Returns to sched_yield if work was queued here before this CPU could
+// halt; otherwise it never returns.
 //
 void
 sched_halt(void)
 {
 	int i;
 
+	// Mark that no environment is running on this CPU.  Leave its
+	// page tables first: env_free waits for curenv to change before
+	// freeing them.
+	tlb_set_loaded(NULL);
+	lcr3(PADDR(boot_pml4));
+	curenv = NULL;
+	tlb_shootdown();
+
 	// For debugging and testing purposes, if there are no runnable
 	// environments in the system, then drop into the kernel monitor.
 	for (i = 0; i < NENV; i++) {
 		if ((envs[i].env_status == ENV_RUNNABLE ||
 		     envs[i].env_status == ENV_RUNNING ||
-		     envs[i].env_status == ENV_DYING))
+		     envs[i].env_status == ENV_DYING ||
+		     envs[i].env_wakeup))
 			break;
 	}
 	if (i == NENV) {
+		// One CPU at a time.
+		lock_kernel();
 		cprintf("No runnable environments in the system!\n");
 		cprintf("For CPU%d\n",cpunum());
 		while (1)
 			monitor(NULL);
 	}
 
-	// Mark that no environment is running on this CPU
-	curenv = NULL;
-	lcr3(PADDR(boot_pml4));
+	// Zero free pages for page_alloc(ALLOC_ZERO) until work arrives
+	// or the pool is full, then don't sit on free pages other CPUs
+	// may need.
+	while (runqs[cpunum()].rq_len == 0 && page_zero_idle())
+		;
+	kmem_cache_drain();
+	page_mag_drain();
 
-	// Mark that this CPU is in the HALT state, so that when
-	// timer interupts come in, we know we should re-acquire the
-	// big kernel lock
-	xchg(&thiscpu->cpu_status, CPU_HALTED);
+	sched_arm_timer(0);
 
-	// Release the big kernel lock as if we were "leaving" the kernel	
-	unlock_kernel();
+	// Mark that this CPU is in the HALT state, so that CPUs that
+	// queue work for us know to send IRQ_RESCHED.  Anything queued
+	// before they could see it must be picked up now.
+	xchg(&thiscpu->cpu_status, CPU_HALTED);
+	if (runqs[cpunum()].rq_len > 0) {
+		xchg(&thiscpu->cpu_status, CPU_STARTED);
+		return;
+	}
 
 	
 	// Reset stack pointer, enable interrupts and then halt.
@@ -129,5 +645,9 @@ sched_halt(void)
 		"sti\n"
 		"hlt\n"
 		: : "a" (thiscpu->cpu_ts.ts_esp0));
+
+	// The next interrupt enters trap() on a fresh stack and never
+	// comes back here.
+	panic("sched_halt: hlt returned");
 }
 
@@ -6,7 +6,20 @@
 # error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/types.h>
+
+struct Env;
+
 // This function does not return.
 void sched_yield(void) __attribute__((noreturn));
+void sched_init(void);
+void sched_enqueue(struct Env *e);
+void sched_requeue(struct Env *e);
+void sched_boost(struct Env *e);
+void sched_tick(void);
+void sched_resched(void);
+void sched_sleep(struct Env *e, uint64_t wakeup);
+void sched_cancel_sleep(struct Env *e);
+void sched_switch(struct Env *e) __attribute__((noreturn));
 
 #endif	// !JOS_KERN_SCHED_H
@@ -16,6 +16,16 @@ struct spinlock kernel_lock = {
 #endif
 };
 
+// Atomically add 'v' to '*addr' and return the old value.
+static inline unsigned
+fetch_and_add(volatile unsigned *addr, unsigned v)
+{
+	asm volatile("lock; xaddl %0, %1"
+		     : "+r" (v), "+m" (*addr)
+		     : : "memory");
+	return v;
+}
+
 #ifdef DEBUG_SPINLOCK
 // Record the current call stack in pcs[] by following the %ebp chain.
 static void
@@ -39,17 +49,305 @@ get_caller_pcs(uint64_t pcs[])
 static int
 holding(struct spinlock *lock)
 {
-	return lock->locked && lock->cpu == thiscpu;
+	return lock->next != lock->owner && lock->cpu == thiscpu;
+}
+
+// Lock profiling.
+//
+// Statistics are kept per lock name rather than per lock, so that,
+// e.g., all of env_locks[] is reported as the single "&env_locks[i]".
+// Locks with the same name may be held at once on different CPUs, so
+// the counters are updated with locked adds.  The maxima are updated
+// without atomics and may occasionally miss a sample.
+//
+// Wait and hold times are in TSC cycles.  Bucket b of a histogram
+// counts times in [2^b, 2^(b+1)).
+
+#define LOCKSTAT_NBUCKET	32
+#define LOCKSTAT_NSITE		4	// Call sites remembered per name
+#define LOCKSTAT_NPCS		4	// Frames remembered per call site
+#define NLOCKSTAT		32	// Distinct lock names, plus "(other)"
+
+struct lockstat_site {
+	uintptr_t pcs[LOCKSTAT_NPCS];
+	uint64_t ncontended;
+	uint64_t wait_cycles;
+};
+
+struct lockstat {
+	char *name;
+	uint64_t nacquire;
+	uint64_t ncontended;
+	uint64_t wait_cycles;
+	uint64_t hold_cycles;
+	uint64_t max_wait;
+	uint64_t max_hold;
+	uint64_t wait_hist[LOCKSTAT_NBUCKET];
+	uint64_t hold_hist[LOCKSTAT_NBUCKET];
+
+	// Call sites of contended acquisitions, guarded by site_lock
+	// (a bare xchg flag: it cannot itself be a spinlock).
+	unsigned site_lock;
+	struct lockstat_site sites[LOCKSTAT_NSITE];
+};
+
+// lockstats[NLOCKSTAT] is reserved for names that find the rest full.
+static struct lockstat lockstats[NLOCKSTAT + 1] = {
+	[NLOCKSTAT] = { .name = "(other)" },
+};
+static int nlockstats;
+static unsigned lockstats_lock;		// Guards adding to lockstats[]
+
+// The number of slots of lockstats[] in use, "(other)" included once
+// the rest are taken.
+static int
+lockstat_nslots(void)
+{
+	return nlockstats < NLOCKSTAT ? nlockstats : NLOCKSTAT + 1;
+}
+
+static inline void
+atomic_add64(uint64_t *addr, uint64_t v)
+{
+	asm volatile("lock; addq %1, %0" : "+m" (*addr) : "r" (v));
+}
+
+static int
+lockstat_bucket(uint64_t cycles)
+{
+	int b;
+
+	for (b = 0; cycles > 1 && b < LOCKSTAT_NBUCKET - 1; cycles >>= 1)
+		b++;
+	return b;
+}
+
+// Find the statistics for 'name', adding them if they are new.
+// Names beyond NLOCKSTAT share the "(other)" slot.
+static struct lockstat *
+lockstat_lookup(char *name)
+{
+	struct lockstat *ls;
+	int i;
+
+	while (xchg(&lockstats_lock, 1) != 0)
+		asm volatile ("pause");
+	for (i = 0; i < nlockstats; i++)
+		if (lockstats[i].name == name
+		    || strcmp(lockstats[i].name, name) == 0)
+			break;
+	if (i == nlockstats && nlockstats < NLOCKSTAT)
+		lockstats[nlockstats++].name = name;
+	// Otherwise i == NLOCKSTAT when the table is full: "(other)".
+	ls = &lockstats[i];
+	xchg(&lockstats_lock, 0);
+	return ls;
+}
+
+// Account for an acquisition of 'lk', which waited 'wait' cycles
+// (0 if uncontended).  Called by the new holder.
+static void
+lockstat_acquired(struct spinlock *lk, uint64_t wait)
+{
+	struct lockstat *ls;
+	struct lockstat_site *site, *victim;
+	int i;
+
+	// Statically initialized locks have not been looked up yet.
+	if (!lk->stat)
+		lk->stat = lockstat_lookup(lk->name ? lk->name : "(unnamed)");
+	ls = lk->stat;
+
+	atomic_add64(&ls->nacquire, 1);
+	if (!wait)
+		return;
+	atomic_add64(&ls->ncontended, 1);
+	atomic_add64(&ls->wait_cycles, wait);
+	atomic_add64(&ls->wait_hist[lockstat_bucket(wait)], 1);
+	if (wait > ls->max_wait)
+		ls->max_wait = wait;
+
+	// Charge the wait to this call site, evicting the site with the
+	// least contention if all slots are in use.
+	while (xchg(&ls->site_lock, 1) != 0)
+		asm volatile ("pause");
+	victim = &ls->sites[0];
+	for (i = 0; i < LOCKSTAT_NSITE; i++) {
+		site = &ls->sites[i];
+		if (memcmp(site->pcs, lk->pcs, sizeof site->pcs) == 0)
+			break;
+		if (site->ncontended < victim->ncontended)
+			victim = site;
+	}
+	if (i == LOCKSTAT_NSITE) {
+		site = victim;
+		memmove(site->pcs, lk->pcs, sizeof site->pcs);
+		site->ncontended = 0;
+		site->wait_cycles = 0;
+	}
+	site->ncontended++;
+	site->wait_cycles += wait;
+	xchg(&ls->site_lock, 0);
+}
+
+// Account for the release of 'lk'.  Called by the holder.
+static void
+lockstat_released(struct spinlock *lk)
+{
+	struct lockstat *ls = lk->stat;
+	uint64_t hold = read_tsc() - lk->hold_start;
+
+	atomic_add64(&ls->hold_cycles, hold);
+	atomic_add64(&ls->hold_hist[lockstat_bucket(hold)], 1);
+	if (hold > ls->max_hold)
+		ls->max_hold = hold;
+}
+
+// Convert TSC cycles to microseconds, for printing.
+static uint64_t
+cycles2usec(uint64_t cycles)
+{
+	return tsc_khz ? cycles * 1000 / tsc_khz : 0;
+}
+
+static void
+lockstat_print_site(struct lockstat_site *site)
+{
+	struct Ripdebuginfo info;
+	int i;
+
+	cprintf("    %llu contended, %llu us waiting, from:\n",
+		site->ncontended, cycles2usec(site->wait_cycles));
+	for (i = 0; i < LOCKSTAT_NPCS && site->pcs[i]; i++) {
+		if (debuginfo_rip(site->pcs[i], &info) >= 0)
+			cprintf("      %016llx %s:%d: %.*s+%llx\n", site->pcs[i],
+				info.rip_file, info.rip_line,
+				info.rip_fn_namelen, info.rip_fn_name,
+				site->pcs[i] - info.rip_fn_addr);
+		else
+			cprintf("      %016llx\n", site->pcs[i]);
+	}
+}
+
+static void
+lockstat_print_hist(const char *what, uint64_t *hist)
+{
+	int b;
+
+	cprintf("  %s cycles:\n", what);
+	for (b = 0; b < LOCKSTAT_NBUCKET; b++)
+		if (hist[b])
+			cprintf("    >= %12llu: %llu\n", 1ULL << b, hist[b]);
+}
+
+static void
+lockstat_print_summary(struct lockstat *ls)
+{
+	cprintf("%-20s %10llu %10llu %3llu%% %10llu %8llu %8llu %8llu\n",
+		ls->name, ls->nacquire, ls->ncontended,
+		ls->nacquire ? ls->ncontended * 100 / ls->nacquire : 0,
+		cycles2usec(ls->wait_cycles),
+		cycles2usec(ls->max_wait),
+		ls->nacquire ? ls->hold_cycles / ls->nacquire : 0,
+		ls->max_hold);
+}
+
+static void
+lockstat_print_header(void)
+{
+	cprintf("%-20s %10s %10s %4s %10s %8s %8s %8s\n",
+		"lock", "acquired", "contended", "", "wait(us)",
+		"maxwait", "avghold", "maxhold");
+	cprintf("%-20s %10s %10s %4s %10s %8s %8s %8s\n",
+		"", "", "", "", "", "(us)", "(cyc)", "(cyc)");
+}
+
+// Print the 'nlocks' locks that spent the most time contended, worst
+// first, with the call sites they were contended from.
+void
+lockstat_print(int nlocks)
+{
+	bool printed[NLOCKSTAT + 1];
+	struct lockstat *ls;
+	int i, j, n, nslots = lockstat_nslots();
+
+	memset(printed, 0, sizeof printed);
+	lockstat_print_header();
+	for (n = 0; n < nlocks; n++) {
+		ls = NULL;
+		for (i = 0; i < nslots; i++)
+			if (!printed[i] && (!ls || lockstats[i].wait_cycles
+					    > ls->wait_cycles))
+				ls = &lockstats[i];
+		if (!ls)
+			break;
+		printed[ls - lockstats] = 1;
+		lockstat_print_summary(ls);
+		for (j = 0; j < LOCKSTAT_NSITE; j++)
+			if (ls->sites[j].ncontended)
+				lockstat_print_site(&ls->sites[j]);
+	}
+}
+
+// Print everything known about the lock called 'name'.
+void
+lockstat_print_one(const char *name)
+{
+	struct lockstat *ls;
+	int i, nslots = lockstat_nslots();
+
+	for (i = 0; i < nslots; i++)
+		if (strcmp(lockstats[i].name, name) == 0)
+			break;
+	if (i == nslots) {
+		cprintf("lockstat: no lock named '%s'\n", name);
+		return;
+	}
+	ls = &lockstats[i];
+	lockstat_print_header();
+	lockstat_print_summary(ls);
+	lockstat_print_hist("wait", ls->wait_hist);
+	lockstat_print_hist("hold", ls->hold_hist);
+	cprintf("  contended from:\n");
+	for (i = 0; i < LOCKSTAT_NSITE; i++)
+		if (ls->sites[i].ncontended)
+			lockstat_print_site(&ls->sites[i]);
+}
+
+// Zero all statistics.  Lock names stay registered.
+void
+lockstat_reset(void)
+{
+	struct lockstat *ls;
+	int i, nslots = lockstat_nslots();
+
+	for (i = 0; i < nslots; i++) {
+		ls = &lockstats[i];
+		while (xchg(&ls->site_lock, 1) != 0)
+			asm volatile ("pause");
+		ls->nacquire = ls->ncontended = 0;
+		ls->wait_cycles = ls->hold_cycles = 0;
+		ls->max_wait = ls->max_hold = 0;
+		memset(ls->wait_hist, 0, sizeof ls->wait_hist);
+		memset(ls->hold_hist, 0, sizeof ls->hold_hist);
+		memset(ls->sites, 0, sizeof ls->sites);
+		xchg(&ls->site_lock, 0);
+	}
 }
 #endif
 
 void
 __spin_initlock(struct spinlock *lk, char *name)
 {
-	lk->locked = 0;
+	lk->next = 0;
+	lk->owner = 0;
+	lk->nacquire = 0;
+	lk->ncontended = 0;
+	lk->spin_cycles = 0;
 #ifdef DEBUG_SPINLOCK
 	lk->name = name;
 	lk->cpu = 0;
+	lk->stat = lockstat_lookup(name);
 #endif
 }
 
@@ -60,21 +358,39 @@ __spin_initlock(struct spinlock *lk, char *name)
 void
 spin_lock(struct spinlock *lk)
 {
+	unsigned ticket;
+	uint64_t wait = 0;
+
 #ifdef DEBUG_SPINLOCK
 	if (holding(lk))
 		panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
 #endif
 
-	// The xchg is atomic.
-	// It also serializes, so that reads after acquire are not
-	// reordered before it. 
-	while (xchg(&lk->locked, 1) != 0)
-		asm volatile ("pause");
+	// The locked xadd is atomic and serializes, so that reads
+	// after acquire are not reordered before it.  Waiters only
+	// read 'owner', so the line is not bounced between them while
+	// they spin.
+	ticket = fetch_and_add(&lk->next, 1);
+	if (lk->owner != ticket) {
+		wait = read_tsc();
+		while (lk->owner != ticket)
+			asm volatile ("pause");
+		wait = read_tsc() - wait;
+	}
+
+	// We own the lock; the statistics are ours to update.
+	lk->nacquire++;
+	if (wait) {
+		lk->ncontended++;
+		lk->spin_cycles += wait;
+	}
 
 	// Record info about lock acquisition for debugging.
 #ifdef DEBUG_SPINLOCK
 	lk->cpu = thiscpu;
 	get_caller_pcs(lk->pcs);
+	lockstat_acquired(lk, wait);
+	lk->hold_start = read_tsc();
 #endif
 }
 
@@ -107,18 +423,15 @@ spin_unlock(struct spinlock *lk)
 		panic("spin_unlock");
 	}
 
+	lockstat_released(lk);
 	lk->pcs[0] = 0;
 	lk->cpu = 0;
 #endif
 
-	// The xchg serializes, so that reads before release are 
-	// not reordered after it.  The 1996 PentiumPro manual (Volume 3,
-	// 7.2) says reads can be carried out speculatively and in
-	// any order, which implies we need to serialize here.
-	// But the 2007 Intel 64 Architecture Memory Ordering White
-	// Paper says that Intel 64 and IA-32 will not move a load
-	// after a store. So lock->locked = 0 would work here.
-	// The xchg being asm volatile ensures gcc emits it after
-	// the above assignments (and after the critical section).
-	xchg(&lk->locked, 0);
+	// Hand the lock to the next ticket.  Only the holder writes
+	// 'owner', so a plain store would do: the 2007 Intel 64
+	// Architecture Memory Ordering White Paper says Intel 64 and
+	// IA-32 will not move a load after a store.  The locked add
+	// also keeps gcc from moving the critical section past it.
+	fetch_and_add(&lk->owner, 1);
 }
@@ -6,9 +6,17 @@
 // Comment this to disable spinlock debugging
 #define DEBUG_SPINLOCK
 
-// Mutual exclusion lock.
+// Mutual exclusion lock: a FIFO ticket lock.  A CPU takes the next
+// ticket with an atomic add and waits until 'owner' reaches it, so
+// waiters get the lock in the order they arrived.
 struct spinlock {
-	unsigned locked;       // Is the lock held?
+	volatile unsigned next;   // Next ticket to hand out
+	volatile unsigned owner;  // Ticket currently holding the lock
+
+	// Statistics, only updated by the holder.
+	uint64_t nacquire;     // Number of acquisitions
+	uint64_t ncontended;   // Acquisitions that had to wait
+	uint64_t spin_cycles;  // TSC cycles spent waiting
 
 #ifdef DEBUG_SPINLOCK
 	// For debugging:
@@ -16,6 +24,10 @@ struct spinlock {
 	struct CpuInfo *cpu;   // The CPU holding the lock.
 	uintptr_t pcs[10];     // The call stack (an array of program counters)
 	                       // that locked the lock.
+
+	// For lockstat:
+	struct lockstat *stat; // Statistics shared by all locks with this name
+	uint64_t hold_start;   // TSC when the holder acquired the lock
 #endif
 };
 
@@ -25,6 +37,13 @@ void spin_unlock(struct spinlock *lk);
 
 #define spin_initlock(lock)   __spin_initlock(lock, #lock)
 
+#ifdef DEBUG_SPINLOCK
+// Lock profiling, for the kernel monitor's lockstat command.
+void lockstat_print(int nlocks);
+void lockstat_print_one(const char *name);
+void lockstat_reset(void);
+#endif
+
 extern struct spinlock kernel_lock;
 
 static inline void
@@ -37,12 +56,6 @@ static inline void
 unlock_kernel(void)
 {
 	spin_unlock(&kernel_lock);
-
-	// Normally we wouldn't need to do this, but QEMU only runs
-	// one CPU at a time and has a long time-slice.  Without the
-	// pause, this CPU is likely to reacquire the lock before
-	// another CPU has even been given a chance to acquire it.
-	asm volatile("pause");
 }
 
 #endif
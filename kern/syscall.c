@@ -16,6 +16,7 @@
 #include <kern/console.h>
 #include <kern/sched.h>
 #include <kern/time.h>
+#include <kern/ipc.h>
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -118,6 +119,55 @@ sys_exofork(void)
 	return newenv->env_id;
 }
 
+// Fork the current environment: create a child with a copy of our
+// registers and address space, in one system call.  Pages are shared
+// copy-on-write as lib/fork.c's user-level fork shares them (see
+// page_fork); the child gets a fresh user exception stack if we have
+// one, and our page fault upcall.  The child is runnable on return.
+//
+// Returns the child's envid in the parent and 0 in the child, or < 0
+// on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_fork(void)
+{
+	struct Env *child;
+	struct PageInfo *pp;
+	envid_t envid;
+	int r;
+
+	if ((r = env_alloc(&child, curenv->env_id)) < 0)
+		return r;
+
+	env_lock_pair(curenv, child);
+	child->env_tf = curenv->env_tf;
+	child->env_tf.tf_regs.reg_rax = 0;
+	child->env_pgfault_upcall = curenv->env_pgfault_upcall;
+
+	r = page_fork(curenv->env_pml4e, child->env_pml4e);
+	if (r == 0 && page_lookup(curenv->env_pml4e,
+				  (void *) (UXSTACKTOP - PGSIZE), NULL)) {
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+			r = -E_NO_MEM;
+		else if ((r = page_insert(child->env_pml4e, pp,
+					  (void *) (UXSTACKTOP - PGSIZE),
+					  PTE_U | PTE_W | PTE_P)) < 0)
+			page_free(pp);
+	}
+	if (r < 0) {
+		env_unlock(curenv);
+		env_free(child);
+		return r;
+	}
+
+	envid = child->env_id;
+	child->env_status = ENV_RUNNABLE;
+	sched_enqueue(child);
+	env_unlock_pair(curenv, child);
+	return envid;
+}
+
 // Set envid's env_status to status, which must be ENV_RUNNABLE
 // or ENV_NOT_RUNNABLE.
 //
@@ -136,17 +186,89 @@ sys_env_set_status(envid_t envid, int status)
 
 	// LAB 4: Your code here.
 	struct Env* envstore;
-	int result = envid2env(envid,&envstore,1);
+	if (status != ENV_NOT_RUNNABLE && status != ENV_RUNNABLE){
+		return -E_INVAL;
+	}
+
+	int result = envid2env_lock(envid,&envstore,1);
 	if (result < 0){
 		return result;
 	}
-	
-	if (status != ENV_NOT_RUNNABLE && status != ENV_RUNNABLE){
-		return -E_INVAL;
+
+	// A running env is taken off its CPU only by that CPU: just
+	// leave it running if asked to make it runnable.  A dying env
+	// keeps its mark, so that it is freed once off its CPU.
+	if (envstore->env_status == ENV_DYING) {
+		env_unlock(envstore);
+		return 0;
+	}
+	if (envstore->env_status == ENV_RUNNING) {
+		result = 0;
+		if (status == ENV_NOT_RUNNABLE && envstore == curenv)
+			envstore->env_status = status;
+		else if (status == ENV_NOT_RUNNABLE)
+			result = -E_INVAL;
+		env_unlock(envstore);
+		return result;
 	}
 	envstore->env_status = status;
+	if (status == ENV_RUNNABLE)
+		sched_enqueue(envstore);
+	env_unlock(envstore);
+	return 0;
+
+}
+
+// Pin envid to scheduler priority level 'prio' (0 is the highest), or
+// let the scheduler move it between levels again if 'prio' is
+// ENV_PRIO_DYNAMIC.  Pinned envs are never demoted for using up their
+// quantum, so system servers can stay ahead of CPU-bound envs.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if prio is not ENV_PRIO_DYNAMIC or in [0, ENV_NPRIO).
+static int
+sys_env_set_priority(envid_t envid, int prio)
+{
+	struct Env *e;
+	int r;
+
+	if (prio != ENV_PRIO_DYNAMIC && (prio < 0 || prio >= ENV_NPRIO))
+		return -E_INVAL;
+	if ((r = envid2env_lock(envid, &e, 1)) < 0)
+		return r;
+
+	e->env_prio_pinned = prio;
+	if (prio != ENV_PRIO_DYNAMIC)
+		e->env_prio = prio;
+	env_unlock(e);
 	return 0;
+}
+
+// Restrict envid to the CPUs in 'mask' (bit i stands for CPU i).
+// Within the mask the scheduler still prefers the CPU the env last
+// ran on; this only sets hard limits.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if mask contains none of the CPUs in the system.
+static int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+	struct Env *e;
+	int r;
 
+	if (!(mask & ((1 << ncpu) - 1)))
+		return -E_INVAL;
+	if ((r = envid2env_lock(envid, &e, 1)) < 0)
+		return r;
+
+	e->env_affinity = mask;
+	sched_requeue(e);
+	env_unlock(e);
+	return 0;
 }
 
 // Set envid's trap frame to 'tf'.
@@ -163,7 +285,7 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
 	// Remember to check whether the user has supplied us with a good
 	// address!
 	struct Env* envstore;
-	int result = envid2env(envid,&envstore,1);
+	int result = envid2env_lock(envid,&envstore,1);
 	if (result < 0){
 		return result;
 	}
@@ -173,6 +295,7 @@ sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
 	//I could just set envstore to point to the trapframe the user provides but that danger is that that trapframe lives on the stack of the caller.
 	memcpy(&envstore->env_tf,tf,sizeof(struct Trapframe));
 	//envstore->env_tf = *tf;
+	env_unlock(envstore);
 	return 0;
 	
 
@@ -192,16 +315,29 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 	// LAB 4: Your code here.
 	
 	struct Env* envstore;
-	int result = envid2env(envid,&envstore,1);
+	int result = envid2env_lock(envid,&envstore,1);
 	if (result < 0){
 		return result;
 	}
 
 	envstore->env_pgfault_upcall = func;
+	env_unlock(envstore);
 	return 0;
 
 }
 
+// With PTE_LAZY, the page_zero mapping sys_page_alloc makes instead
+// of allocating a page: read-only, and copy-on-write if PTE_W is asked
+// for, so that page_cow allocates the page on the first write.
+static int
+lazy_perm(int perm)
+{
+	perm &= ~PTE_LAZY;
+	if (perm & PTE_W)
+		perm = (perm & ~PTE_W) | PTE_COW;
+	return perm;
+}
+
 // Allocate a page of memory and map it at 'va' with permission
 // 'perm' in the address space of 'envid'.
 // The page's contents are set to 0.
@@ -210,6 +346,8 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
 //
 // perm -- PTE_U | PTE_P must be set, PTE_AVAIL | PTE_W may or may not be set,
 //         but no other bits may be set.  See PTE_SYSCALL in inc/mmu.h.
+//         PTE_LAZY may be added: the page is only allocated when first
+//         written.
 //
 // Return 0 on success, < 0 on error.  Errors are:
 //	-E_BAD_ENV if environment envid doesn't currently exist,
@@ -228,33 +366,118 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 	//   If page_insert() fails, remember to free the page you
 	//   allocated!
 	struct Env* envstore;
-	int result = envid2env(envid,&envstore,1);
-	if (result < 0){
-		return result;
-	}
-
 	if 
 	(
 		(uintptr_t)va >= UTOP || 
 		(uintptr_t)va % PGSIZE != 0 || 
-		!(perm & PTE_U && perm & PTE_P && !(perm & ~PTE_SYSCALL))
+		!(perm & PTE_U && perm & PTE_P &&
+		  !(perm & ~(PTE_SYSCALL | PTE_LAZY)))
 	)
 	{
 		return -E_INVAL;
 	}
-	struct PageInfo *pp = page_alloc(ALLOC_ZERO);
-	if (pp){
-		int result = page_insert(envstore->env_pml4e,pp,va,perm);
-		if (result < 0){
+
+	// Zero the page before taking the env's lock.
+	struct PageInfo *pp;
+	if (perm & PTE_LAZY){
+		pp = page_zero;
+		perm = lazy_perm(perm);
+	} else if (!(pp = page_alloc(ALLOC_ZERO)))
+		return -E_NO_MEM;
+
+	int result = envid2env_lock(envid,&envstore,1);
+	if (result < 0){
+		if (pp != page_zero)
 			page_free(pp);
-			return -E_NO_MEM;
-		}
-		return 0;
+		return result;
 	}
-	else {
+	result = page_insert(envstore->env_pml4e,pp,va,perm);
+	env_unlock(envstore);
+	if (result < 0){
+		if (pp != page_zero)
+			page_free(pp);
+		return -E_NO_MEM;
+	}
+	return 0;
+
+}
+
+// Allocate a 2MB page of memory, physically contiguous, and map it
+// at 'va' in the address space of 'envid' with one PTE_PS page
+// directory entry, replacing whatever was mapped in [va, va+PTSIZE).
+// The page's contents are set to 0.  The mapping is shared, copied
+// and unmapped as a whole: sys_page_map maps it when srcva and dstva
+// are both 2MB aligned, and sys_page_unmap of any page in it removes
+// all of it.
+//
+// Return 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va >= UTOP, or va is not 2MB-aligned.
+//	-E_INVAL if perm is inappropriate (see sys_page_alloc).
+//	-E_NO_MEM if there's no free 2MB block of physical memory,
+//		or no memory to allocate any necessary page tables.
+static int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	struct Env *e;
+	struct PageInfo *pp;
+	int r;
+
+	if ((uintptr_t)va >= UTOP || (uintptr_t)va % PTSIZE != 0 ||
+	    !(perm & PTE_U && perm & PTE_P && !(perm & ~PTE_SYSCALL)))
+		return -E_INVAL;
+
+	// Zero the page before taking the env's lock.
+	if (!(pp = page_alloc_order(HUGE_ORDER, ALLOC_ZERO)))
 		return -E_NO_MEM;
+
+	if ((r = envid2env_lock(envid, &e, 1)) < 0) {
+		page_free_order(pp, HUGE_ORDER);
+		return r;
 	}
+	r = page_insert_huge(e->env_pml4e, pp, va, perm);
+	env_unlock(e);
+	if (r < 0)
+		page_free_order(pp, HUGE_ORDER);
+	return r;
+}
 
+// sys_page_map, once both envs are locked.
+static int
+page_map_locked(struct Env *src_envstore, void *srcva,
+		struct Env *dst_envstore, void *dstva, int perm)
+{
+	pte_t *pte_store;
+	struct PageInfo * page;
+
+	if ((uintptr_t)srcva >= UTOP || (uintptr_t)srcva % PGSIZE != 0){
+		return -E_INVAL;
+	}
+	if ((uintptr_t)dstva >= UTOP || (uintptr_t)dstva % PGSIZE != 0){
+		return -E_INVAL;
+	}	
+	if (!(perm & PTE_U && perm & PTE_P && !(perm & ~PTE_SYSCALL)))
+	{
+		return -E_INVAL;
+	}
+
+	// A PTE in a page table shared by fork is writable only once
+	// the table is no longer shared.
+	if (perm & PTE_W && page_unshare(src_envstore->env_pml4e,srcva) < 0)
+		return -E_NO_MEM;
+	page  = page_lookup(src_envstore->env_pml4e,srcva,&pte_store);
+	if (!page || (perm & PTE_W && !(*pte_store & PTE_W))){
+		return -E_INVAL;
+	}
+	if (*pte_store & PTE_PS) {
+		if ((uintptr_t)srcva % PTSIZE != 0 ||
+		    (uintptr_t)dstva % PTSIZE != 0)
+			return -E_INVAL;
+		return page_insert_huge(dst_envstore->env_pml4e,page,dstva,perm);
+	}
+	// returns -E_NO_MEM if no memory, 0 on success;
+	return page_insert(dst_envstore->env_pml4e,page,dstva,perm);	
 }
 
 // Map the page of memory at 'srcva' in srcenvid's address space
@@ -272,6 +495,8 @@ sys_page_alloc(envid_t envid, void *va, int perm)
 //	-E_INVAL if perm is inappropriate (see sys_page_alloc).
 //	-E_INVAL if (perm & PTE_W), but srcva is read-only in srcenvid's
 //		address space.
+//	-E_INVAL if srcva is in a 2MB page (see sys_page_alloc_huge) and
+//		srcva or dstva is not 2MB-aligned.
 //	-E_NO_MEM if there's no memory to allocate any necessary page tables.
 static int
 sys_page_map(envid_t srcenvid, void *srcva,
@@ -288,25 +513,16 @@ sys_page_map(envid_t srcenvid, void *srcva,
 		return dst_result;
 	}
 
-	if ((uintptr_t)srcva >= UTOP || (uintptr_t)srcva % PGSIZE != 0){
-		return -E_INVAL;
-	}
-	if ((uintptr_t)dstva >= UTOP || (uintptr_t)dstva % PGSIZE != 0){
-		return -E_INVAL;
-	}	
-	if (!(perm & PTE_U && perm & PTE_P && !(perm & ~PTE_SYSCALL)))
-	{
-		return -E_INVAL;
-	}
-
-	pte_t *pte_store;
-	struct PageInfo * page;
-	page  = page_lookup(src_envstore->env_pml4e,srcva,&pte_store);
-	if (perm & PTE_W && !(*pte_store & PTE_W)){
-		return -E_INVAL;
-	}
-	// returns -E_NO_MEM if no memory, 0 on success;
-	return page_insert(dst_envstore->env_pml4e,page,dstva,perm);	
+	int result;
+	env_lock_pair(src_envstore, dst_envstore);
+	if (!env_is_live(src_envstore, srcenvid) ||
+	    !env_is_live(dst_envstore, dstenvid))
+		result = -E_BAD_ENV;
+	else
+		result = page_map_locked(src_envstore, srcva,
+					 dst_envstore, dstva, perm);
+	env_unlock_pair(src_envstore, dst_envstore);
+	return result;
 }
 
 // Unmap the page of memory at 'va' in the address space of 'envid'.
@@ -316,6 +532,8 @@ sys_page_map(envid_t srcenvid, void *srcva,
 //	-E_BAD_ENV if environment envid doesn't currently exist,
 //		or the caller doesn't have permission to change envid.
 //	-E_INVAL if va >= UTOP, or va is not page-aligned.
+//	-E_NO_MEM if va's page table is shared with a fork child (or
+//		parent) and there is no memory to copy it.
 static int
 sys_page_unmap(envid_t envid, void *va)
 {
@@ -323,16 +541,292 @@ sys_page_unmap(envid_t envid, void *va)
 
 	// LAB 4: Your code here.
 	struct Env* envstore;
-	int result = envid2env(envid,&envstore,1);
+	if ((uintptr_t)va >= UTOP || (uintptr_t)va % PGSIZE != 0){
+		return -E_INVAL;
+	}
+
+	int result = envid2env_lock(envid,&envstore,1);
 	if (result < 0){
 		return result;
 	}
-	
-	if ((uintptr_t)va >= UTOP || (uintptr_t)va % PGSIZE != 0){
+	//if there is no page mapped, succeed silently anyway
+	result = page_remove(envstore->env_pml4e,va);
+	env_unlock(envstore);
+	return result;
+}
+
+// One operation of sys_page_batch, with src and dst locked.
+static int
+page_op_locked(int syscallno, struct Env *src, struct Env *dst,
+	       const struct PageOp *op)
+{
+	struct PageInfo *pp;
+	int r;
+
+	switch (syscallno) {
+	case SYS_page_map_batch:
+		return page_map_locked(src, (void *) op->srcva,
+				       dst, (void *) op->dstva, op->perm);
+	case SYS_page_alloc_batch:
+		if (op->dstva >= UTOP || op->dstva % PGSIZE != 0 ||
+		    !(op->perm & PTE_U && op->perm & PTE_P &&
+		      !(op->perm & ~(PTE_SYSCALL | PTE_LAZY))))
+			return -E_INVAL;
+		if (op->perm & PTE_LAZY)
+			return page_insert(dst->env_pml4e, page_zero,
+					   (void *) op->dstva,
+					   lazy_perm(op->perm));
+		if (!(pp = page_alloc(ALLOC_ZERO)))
+			return -E_NO_MEM;
+		if ((r = page_insert(dst->env_pml4e, pp,
+				     (void *) op->dstva, op->perm)) < 0)
+			page_free(pp);
+		return r;
+	default:
+		if (op->dstva >= UTOP || op->dstva % PGSIZE != 0)
+			return -E_INVAL;
+		return page_remove(dst->env_pml4e, (void *) op->dstva);
+	}
+}
+
+// Apply 'n' page operations from the array 'uops' in one kernel entry:
+// sys_page_map(srcenvid, srcva, dstenvid, dstva, perm) for
+// SYS_page_map_batch, sys_page_alloc(dstenvid, dstva, perm) for
+// SYS_page_alloc_batch, and sys_page_unmap(dstenvid, dstva) for
+// SYS_page_unmap_batch.  The envs stay locked across consecutive
+// operations on the same envs, and TLB invalidations for other CPUs
+// go out as one batch when we return to user space.
+//
+// Return 0 on success.  On error, the operations before the failing
+// one have been applied, and its error is returned, or
+//	-E_FAULT if 'uops' is not readable.
+static int
+sys_page_batch(int syscallno, const struct PageOp *uops, size_t n)
+{
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	struct Env *src = NULL, *dst = NULL;
+	struct PageOp *op;
+	size_t i, j, m;
+	bool locked;
+	int r = 0;
+
+	for (i = 0; i < n && r == 0; i += m) {
+		// Copy the next operations in with no locks held: an
+		// earlier operation may have unmapped them.
+		m = MIN(n - i, PAGE_BATCH_CHUNK);
+		if (user_mem_check(curenv, uops + i, m * sizeof ops[0],
+				   PTE_U) < 0)
+			return -E_FAULT;
+		memmove(ops, uops + i, m * sizeof ops[0]);
+
+		locked = 0;
+		for (j = 0; j < m && r == 0; j++) {
+			op = &ops[j];
+			if (syscallno != SYS_page_map_batch)
+				op->srcenvid = op->dstenvid;
+			if (!locked || op->srcenvid != ops[j-1].srcenvid ||
+			    op->dstenvid != ops[j-1].dstenvid) {
+				if (locked)
+					env_unlock_pair(src, dst);
+				locked = 0;
+				if ((r = envid2env(op->srcenvid, &src, 1)) < 0 ||
+				    (r = envid2env(op->dstenvid, &dst, 1)) < 0)
+					break;
+				env_lock_pair(src, dst);
+				locked = 1;
+				if (!env_is_live(src, op->srcenvid) ||
+				    !env_is_live(dst, op->dstenvid)) {
+					r = -E_BAD_ENV;
+					break;
+				}
+			}
+			r = page_op_locked(syscallno, src, dst, op);
+		}
+		if (locked)
+			env_unlock_pair(src, dst);
+	}
+	return r;
+}
+
+// Check the page and word count arguments of an IPC send.
+static int
+ipc_check_args(void *srcva, unsigned perm)
+{
+	unsigned nsegs = perm >> IPC_NSEGS_SHIFT;
+
+	if ((perm & (IPC_PERM_SEGS(1) - 1)) >> IPC_NWORDS_SHIFT > IPC_NWORDS
+	    || nsegs > IPC_MAXPAGES)
+		return -E_INVAL;
+	perm &= IPC_PERM_WORDS(1) - 1;
+	if ((uintptr_t)srcva < UTOP){
+		if (!nsegs && (uintptr_t)srcva % PGSIZE != 0)
+			return -E_INVAL;
+		if (!(perm & PTE_U && perm & PTE_P && !(perm & ~PTE_SYSCALL))){
+			return -E_INVAL;
+		}
+	} else if (nsegs)
+		return -E_INVAL;
+	return 0;
+}
+
+// The size in pages of the receive window 'dstva' (see inc/syscall.h):
+// 0 if it asks for no pages, or -E_INVAL if it is malformed.
+static int
+ipc_window(void *dstva)
+{
+	uintptr_t va = ROUNDDOWN((uintptr_t)dstva, PGSIZE);
+	int npages = PGOFF(dstva) + 1;
+
+	if (va >= UTOP)
+		return 0;
+	if (npages > IPC_MAXPAGES || va + npages * PGSIZE > UTOP)
 		return -E_INVAL;
+	return npages;
+}
+
+// Is 'dst' blocked receiving a message from 'src'?  It may be waiting
+// for any sender, or only for the reply of the env it called; a caller
+// whose own message is still queued is not receiving yet.
+static bool
+ipc_recving_from(struct Env *dst, struct Env *src)
+{
+	return dst->env_ipc_recving && !dst->env_ipc_send_to &&
+		(!dst->env_ipc_recv_from ||
+		 dst->env_ipc_recv_from == src->env_id);
+}
+
+// Copy the first 'n' register words of a message (see inc/syscall.h).
+static void
+ipc_copy_words(struct PushRegs *to, const struct PushRegs *from, int n)
+{
+	switch (n) {
+	case 6: to->reg_r13 = from->reg_r13;	// fall through
+	case 5: to->reg_r12 = from->reg_r12;	// fall through
+	case 4: to->reg_r11 = from->reg_r11;	// fall through
+	case 3: to->reg_r10 = from->reg_r10;	// fall through
+	case 2: to->reg_r9 = from->reg_r9;	// fall through
+	case 1: to->reg_r8 = from->reg_r8;
 	}
-	//if there is no page mapped, succeed silently anyway
-	page_remove(envstore->env_pml4e,va);
+}
+
+// Copy 'len' bytes at 'va' in 'src's address space, which need not be
+// curenv's, to 'dst'.  The caller holds src's lock.
+static int
+ipc_copyin(struct Env *src, void *dst, uintptr_t va, size_t len)
+{
+	struct PageInfo *page;
+	pte_t *pte;
+	size_t size, off, n;
+
+	while (len > 0) {
+		if (va >= UTOP ||
+		    !(page = page_lookup(src->env_pml4e, (void *)va, &pte)) ||
+		    (*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+			return -E_INVAL;
+		size = (*pte & PTE_PS) ? PTSIZE : PGSIZE;
+		off = va % size;
+		n = MIN(len, size - off);
+		memmove(dst, (char *)page2kva(page) + off, n);
+		dst = (char *)dst + n;
+		va += n;
+		len -= n;
+	}
+	return 0;
+}
+
+// Check that the page at 'srcva' in 'src' can be mapped at 'dstva' in
+// 'dst' with 'perm', storing it in *page, and make dst's page table
+// for dstva ready, so that the page_insert that maps it cannot fail.
+// The caller holds both env locks.
+static int
+ipc_check_page(struct Env *src, struct Env *dst, void *srcva, void *dstva,
+	       unsigned perm, struct PageInfo **page)
+{
+	pte_t* pte;
+
+	if ((uintptr_t)srcva >= UTOP || (uintptr_t)srcva % PGSIZE != 0)
+		return -E_INVAL;
+	if (perm & PTE_W &&
+	    page_unshare(src->env_pml4e,srcva) < 0)
+		return -E_NO_MEM;
+	*page = page_lookup(src->env_pml4e,srcva,&pte);
+	if (!*page)
+		return -E_INVAL;
+	// 2MB pages are not sent by IPC.
+	if ((perm & PTE_W && !(*pte & PTE_W)) || (*pte & PTE_PS))
+		return -E_INVAL;
+
+	if (page_unshare(dst->env_pml4e,dstva) < 0 ||
+	    !(pte = pml4e_walk(dst->env_pml4e,dstva,1)))
+		return -E_NO_MEM;
+	if (*pte & PTE_PS)
+		return -E_INVAL;
+	return 0;
+}
+
+// Deliver a message from 'src' to 'dst', which is blocked receiving,
+// filling in dst's ipc fields.  The message's register words, and its
+// vector of page runs if it has one, are still in src's saved
+// registers and memory, whether src is curenv or blocked in a send.
+// Every page is checked before any is mapped, so a failed delivery
+// leaves dst's window as it was.
+// The caller holds both env locks, and makes dst runnable (or returns
+// to it) on success.
+// Returns 0 on success, or an error as for sys_ipc_try_send.
+static int
+ipc_deliver(struct Env *src, struct Env *dst, uint32_t value, void *srcva,
+	    unsigned perm)
+{
+	struct PageInfo *pages[IPC_MAXPAGES];
+	struct IpcSeg seg;
+	uintptr_t dstva = ROUNDDOWN((uintptr_t)dst->env_ipc_dstva, PGSIZE);
+	int window = ipc_window(dst->env_ipc_dstva);
+	int nwords = (perm & (IPC_PERM_SEGS(1) - 1)) >> IPC_NWORDS_SHIFT;
+	int nsegs = perm >> IPC_NSEGS_SHIFT;
+	int i, npages = 0, total = 0, r;
+	size_t j;
+
+	perm &= IPC_PERM_WORDS(1) - 1;
+	for (i = 0; i < nsegs && npages < window; i++) {
+		r = ipc_copyin(src, &seg, (uintptr_t)srcva + i * sizeof(seg),
+			       sizeof(seg));
+		if (r < 0)
+			return r;
+		if (seg.seg_npages > IPC_MAXPAGES - total)
+			return -E_INVAL;
+		total += seg.seg_npages;
+		for (j = 0; j < seg.seg_npages && npages < window; j++) {
+			r = ipc_check_page(src, dst,
+					   (void *)(seg.seg_va + j * PGSIZE),
+					   (void *)(dstva + npages * PGSIZE),
+					   perm, &pages[npages]);
+			if (r < 0)
+				return r;
+			npages++;
+		}
+	}
+	if (!nsegs && (uintptr_t)srcva < UTOP && window > 0) {
+		r = ipc_check_page(src, dst, srcva, (void *)dstva, perm,
+				   &pages[0]);
+		if (r < 0)
+			return r;
+		npages = 1;
+	}
+
+	for (i = 0; i < npages; i++)
+		if ((r = page_insert(dst->env_pml4e, pages[i],
+				     (void *)(dstva + i * PGSIZE), perm)) < 0)
+			panic("ipc_deliver: page_insert: %e", r);
+
+	//since we are transferring pages, we must set permission
+	dst->env_ipc_perm = npages ? perm : 0;
+	dst->env_ipc_npages = npages;
+	ipc_copy_words(&dst->env_tf.tf_regs, &src->env_tf.tf_regs, nwords);
+	dst->env_ipc_nwords = nwords;
+	dst->env_ipc_recving = false;
+	ipc_call_leave(dst);	// if this is the reply to its call
+	dst->env_ipc_from = src->env_id;
+	dst->env_ipc_value = value;
 	return 0;
 }
 
@@ -355,8 +849,17 @@ sys_page_unmap(envid_t envid, void *va)
 // from the paused sys_ipc_recv system call.  (Hint: does the
 // sys_ipc_recv function ever actually return?)
 //
+// If perm includes IPC_PERM_WORDS(n), the first n of the registers
+// r8-r13 are copied to the receiver's (see inc/syscall.h), and
+// env_ipc_nwords is set to n.
+//
+// If perm includes IPC_PERM_SEGS(n), srcva is instead the address of n
+// struct IpcSeg, whose pages are mapped in order into the receiver's
+// window; env_ipc_npages is set to the number of pages mapped.
+//
 // If the sender wants to send a page but the receiver isn't asking for one,
-// then no page mapping is transferred, but no error occurs.
+// then no page mapping is transferred, but no error occurs.  Likewise,
+// pages that do not fit in the receiver's window are not transferred.
 // The ipc only happens when no errors occur.
 //
 // Returns 0 on success, < 0 on error.
@@ -368,6 +871,10 @@ sys_page_unmap(envid_t envid, void *va)
 //	-E_INVAL if srcva < UTOP but srcva is not page-aligned.
 //	-E_INVAL if srcva < UTOP and perm is inappropriate
 //		(see sys_page_alloc).
+//	-E_INVAL if perm asks for more than IPC_NWORDS register words.
+//	-E_INVAL if perm asks for page runs but srcva >= UTOP, or the
+//		runs are not readable there, or hold more than
+//		IPC_MAXPAGES pages or pages that are not page-aligned.
 //	-E_INVAL if srcva < UTOP but srcva is not mapped in the caller's
 //		address space.
 //	-E_INVAL if (perm & PTE_W), but srcva is read-only in the
@@ -378,49 +885,275 @@ static int
 sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 {
 	struct Env *e;
-	struct PageInfo* page;
+	int result;
 	
-	pte_t* pte;
 	if (envid2env(envid,&e,0)){
 		return -E_BAD_ENV;
 	}
-	if (!e->env_ipc_recving){
-		return -E_IPC_NOT_RECV;
+	if ((result = ipc_check_args(srcva, perm)) < 0)
+		return result;
+
+	// Lock the sender too: its page tables are read below, and
+	// its parent may be changing them.
+	env_lock_pair(curenv, e);
+	if (!env_is_live(e, envid)){
+		result = -E_BAD_ENV;
+		goto out;
 	}
-	if ((uintptr_t)srcva < UTOP){
-		if ((uintptr_t)srcva % PGSIZE != 0)
-			return -E_INVAL;
-		if (!(perm & PTE_U && perm & PTE_P && !(perm & ~PTE_SYSCALL))){
-			return -E_INVAL;
-		}
-		page = page_lookup(curenv->env_pml4e,srcva,&pte);
-		if (!page){
-			return -E_INVAL;
-		}
-		if (perm & PTE_W && !(*pte & PTE_W)){
-			return -E_INVAL;
+	if (!ipc_recving_from(e, curenv)){
+		result = -E_IPC_NOT_RECV;
+		goto out;
+	}
+	if ((result = ipc_deliver(curenv, e, value, srcva, perm)) < 0)
+		goto out;
+
+	e->env_status = ENV_RUNNABLE;
+	e->env_tf.tf_regs.reg_rax = 0;
+	sched_enqueue(e);
+
+out:
+	env_unlock_pair(curenv, e);
+	return result;
+}
+
+// Block curenv, which holds its own lock, until another env wakes it
+// up.  The caller has checked that curenv is not being destroyed
+// (ENV_DYING): such an env must not block, but go to sched_yield to
+// be freed.
+static void
+ipc_block(void)
+{
+	curenv->env_status = ENV_NOT_RUNNABLE;
+	sched_boost(curenv);
+}
+
+// Wait for any message at 'dstva'.  The caller holds curenv's lock.
+static void
+ipc_block_recv(void *dstva)
+{
+	curenv->env_ipc_recving = true;
+	curenv->env_ipc_recv_from = 0;
+	curenv->env_ipc_dstva = dstva;
+	ipc_block();
+}
+
+// Queue curenv, which holds its and e's locks, to send a message to
+// 'e' once e receives (see sys_ipc_recv).
+static void
+ipc_block_send(struct Env *e, uint32_t value, void *srcva, unsigned perm)
+{
+	curenv->env_ipc_send_to = e->env_id;
+	curenv->env_ipc_send_value = value;
+	curenv->env_ipc_send_srcva = srcva;
+	curenv->env_ipc_send_perm = perm;
+	ipc_wait_push(e, curenv);
+	ipc_block();
+}
+
+// Take the message of the oldest sender blocked in sys_ipc_send or
+// sys_ipc_call, if there is one, mapping its pages at 'dstva'.  A plain
+// sender is made runnable with the result; a caller stays blocked,
+// waiting for our reply, unless the delivery failed.
+// The caller holds curenv's lock, which is held again on return.
+// Returns true if a message was received.
+static bool
+ipc_recv_queued(void *dstva)
+{
+	struct Env *e;
+	int r;
+
+	while ((e = ipc_wait_pop(curenv)) != NULL) {
+		env_unlock(curenv);
+		env_lock_pair(curenv, e);
+		// It may have been freed, or woken up some other way.
+		if (e->env_ipc_send_to != curenv->env_id ||
+		    e->env_ipc_send_queue) {
+			env_unlock(e);
+			continue;
 		}
+		curenv->env_ipc_dstva = dstva;
+		r = ipc_deliver(e, curenv, e->env_ipc_send_value,
+				e->env_ipc_send_srcva, e->env_ipc_send_perm);
+		e->env_ipc_send_to = 0;
+		if (r < 0 || !e->env_ipc_recving) {
+			e->env_ipc_recving = false;
+			e->env_tf.tf_regs.reg_rax = r;
+			e->env_status = ENV_RUNNABLE;
+			sched_enqueue(e);
+		} else
+			ipc_call_push(curenv, e);
+		env_unlock(e);
+		if (r == 0)
+			return true;
+	}
+	return false;
+}
 
-		int result = page_insert(e->env_pml4e,page,e->env_ipc_dstva,perm);
-		
-		if (result < 0){
-			return -E_NO_MEM;
+// Send 'value' (and the page at 'srcva' with 'perm', as for
+// sys_ipc_try_send) to 'envid', blocking until it is received.
+// If envid is not receiving, the caller waits on envid's queue of
+// senders (kern/ipc.c) and its message is delivered by the
+// sys_ipc_recv that takes it off, oldest sender first.
+//
+// Returns 0 on success, < 0 on error.  Errors are those of
+// sys_ipc_try_send, except -E_IPC_NOT_RECV, plus:
+//	-E_BAD_ENV if envid is freed while we wait.
+//	-E_IPC_NOT_RECV if we are made runnable before envid receives.
+static int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+{
+	struct Env *e;
+	int result;
+
+	if (envid2env(envid,&e,0))
+		return -E_BAD_ENV;
+	if ((result = ipc_check_args(srcva, perm)) < 0)
+		return result;
+	if (e == curenv)
+		return -E_INVAL;
+
+	env_lock_pair(curenv, e);
+	if (!env_is_live(e, envid)){
+		env_unlock_pair(curenv, e);
+		return -E_BAD_ENV;
+	}
+	if (ipc_recving_from(e, curenv)){
+		if ((result = ipc_deliver(curenv, e, value, srcva, perm)) == 0){
+			e->env_status = ENV_RUNNABLE;
+			e->env_tf.tf_regs.reg_rax = 0;
+			sched_enqueue(e);
 		}
-		//since we are transferring a page, we must set permission
-		e->env_ipc_perm = perm;
+		env_unlock_pair(curenv, e);
+		return result;
 	}
 
-	e->env_ipc_recving = false;
-	e->env_ipc_from = curenv->env_id;
-	e->env_ipc_value = value;
-	e->env_status = ENV_RUNNABLE;
+	// Wait our turn.  The receiver sets our return value.
+	if (curenv->env_status != ENV_DYING)
+		ipc_block_send(e, value, srcva, perm);
+	env_unlock_pair(curenv, e);
+	sched_yield();
+}
+
+// Send 'value' (and the page at 'srcva' with 'perm') to 'envid' as
+// sys_ipc_send does, then wait for envid's reply, mapping its page
+// at 'dstva'.  Messages from other envs wait until we receive again.
+// If envid was waiting for a message, this CPU switches straight to
+// it (sched_switch).
+//
+// Returns 0 once the reply is received, < 0 on error.  Errors are
+// those of sys_ipc_send, plus:
+//	-E_INVAL if dstva is not a valid receive window (see
+//		inc/syscall.h).
+//	-E_BAD_ENV if envid is freed before it replies.
+static int
+sys_ipc_call(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+	     void *dstva)
+{
+	struct Env *e;
+	int result;
+
+	if (envid2env(envid,&e,0))
+		return -E_BAD_ENV;
+	if ((result = ipc_check_args(srcva, perm)) < 0)
+		return result;
+	if (ipc_window(dstva) < 0 || e == curenv)
+		return -E_INVAL;
+
+	env_lock_pair(curenv, e);
+	if (!env_is_live(e, envid)){
+		env_unlock_pair(curenv, e);
+		return -E_BAD_ENV;
+	}
+	if (curenv->env_status == ENV_DYING){
+		env_unlock_pair(curenv, e);
+		sched_yield();
+	}
+	curenv->env_ipc_recving = true;
+	curenv->env_ipc_recv_from = e->env_id;
+	curenv->env_ipc_dstva = dstva;
+	if (!ipc_recving_from(e, curenv)){
+		// Wait our turn; the receiver leaves us waiting for the
+		// reply.
+		ipc_block_send(e, value, srcva, perm);
+		env_unlock_pair(curenv, e);
+		sched_yield();
+	}
+
+	if ((result = ipc_deliver(curenv, e, value, srcva, perm)) < 0){
+		curenv->env_ipc_recving = false;
+		env_unlock_pair(curenv, e);
+		return result;
+	}
 	e->env_tf.tf_regs.reg_rax = 0;
+	ipc_call_push(e, curenv);
+	ipc_block();
+	env_unlock(curenv);
+	sched_switch(e);
+}
 
-	return 0;
-		
-	 
+// Reply 'value' (and the page at 'srcva' with 'perm') to 'envid',
+// which must be waiting for our reply in sys_ipc_call, then wait for
+// the next message as sys_ipc_recv does.  If no message is queued,
+// this CPU switches straight to envid.  A reply envid is not waiting
+// for (or an 'envid' of 0) is dropped; if the reply itself fails,
+// envid's sys_ipc_call returns the error.
+//
+// Returns 0 once a message is received, < 0 on error.  Errors are:
+//	-E_INVAL if srcva, perm (unless envid is 0) or dstva is
+//		inappropriate, as for sys_ipc_try_send and sys_ipc_recv.
+static int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+		   void *dstva)
+{
+	struct Env *e = NULL;
+	int result;
+
+	// With no one to reply to, the reply's arguments do not matter.
+	if (envid && (result = ipc_check_args(srcva, perm)) < 0)
+		return result;
+	if (ipc_window(dstva) < 0)
+		return -E_INVAL;
 
+	if (envid && envid2env(envid,&e,0) == 0 && e != curenv){
+		env_lock_pair(curenv, e);
+		if (env_is_live(e, envid) && ipc_recving_from(e, curenv) &&
+		    e->env_ipc_recv_from == curenv->env_id){
+			result = ipc_deliver(curenv, e, value, srcva, perm);
+			e->env_ipc_recving = false;
+			ipc_call_leave(e);
+			e->env_tf.tf_regs.reg_rax = result;
+		} else {
+			env_unlock(e);
+			e = NULL;
+		}
+	} else {
+		e = NULL;
+		env_lock(curenv);
+	}
+
+	// e, if set, is locked and waits to be woken up.  Do that the
+	// usual way unless we are about to block.
+	if (e && (curenv->env_ipc_senders ||
+		  curenv->env_status == ENV_DYING)) {
+		e->env_status = ENV_RUNNABLE;
+		sched_enqueue(e);
+		env_unlock(e);
+		e = NULL;
+	}
+	if (!e && ipc_recv_queued(dstva)) {
+		env_unlock(curenv);
+		return 0;
+	}
+	if (curenv->env_status == ENV_DYING) {
+		env_unlock(curenv);
+		sched_yield();
+	}
 
+	ipc_block_recv(dstva);
+	env_unlock(curenv);
+	if (e)
+		sched_switch(e);
+	sched_yield();
 }
 
 // Block until a value is ready.  Record that you want to receive
@@ -428,37 +1161,73 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 // mark yourself not runnable, and then give up the CPU.
 //
 // If 'dstva' is < UTOP, then you are willing to receive a page of data.
-// 'dstva' is the virtual address at which the sent page should be mapped.
+// 'dstva' is the virtual address at which the sent page should be mapped,
+// or, as IPC_WINDOW(va, n), a window of n pages at va for the pages
+// of a vector (see inc/syscall.h).
 //
 // This function only returns on error, but the system call will eventually
 // return 0 on success.
 // Return < 0 on error.  Errors are:
-//	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//	-E_INVAL if dstva < UTOP but dstva is not a valid window.
 static int
 sys_ipc_recv(void *dstva)
 {
-
-	if ((uintptr_t)dstva < UTOP && (uintptr_t)dstva % PGSIZE != 0){
+	if (ipc_window(dstva) < 0){
 		return -E_INVAL;
 	}
 
-	curenv->env_ipc_recving = true;
-	curenv->env_ipc_dstva = dstva;
+	env_lock(curenv);
+	if (ipc_recv_queued(dstva)) {
+		env_unlock(curenv);
+		return 0;
+	}
+	if (curenv->env_status == ENV_DYING) {
+		env_unlock(curenv);
+		sched_yield();
+	}
 
-	curenv->env_status = ENV_NOT_RUNNABLE;
+	// Once we unlock, a sender on another CPU may wake us up and a
+	// third CPU may run us before this one reaches sched_yield.
+	ipc_block_recv(dstva);
+	env_unlock(curenv);
 	sched_yield();
 
 	// LAB 4: Your code here.
 	return 0;
 }
 
-
 // Return the current time.
 static int
 sys_time_msec(void)
 {
-	// LAB 6: Your code here.
-	panic("sys_time_msec not implemented");
+	return time_msec();
+}
+
+// Block the calling environment for at least 'usec' microseconds.
+// This CPU's timer is armed for the wakeup itself rather than for the
+// next periodic tick, so short sleeps end on time.
+//
+// A sleep too long to express in TSC cycles lasts until the TSC wraps.
+//
+// This function does not return, but the system call returns 0.
+static int
+sys_sleep_usec(uint64_t usec)
+{
+	uint64_t now = read_tsc(), cycles;
+
+	// usec * tsc_khz / 1000, without overflowing.
+	if (tsc_khz && usec / 1000 >= (~0ULL - now) / tsc_khz)
+		cycles = ~0ULL - now;
+	else
+		cycles = usec / 1000 * tsc_khz + usec % 1000 * tsc_khz / 1000;
+
+	curenv->env_tf.tf_regs.reg_rax = 0;
+	env_lock(curenv);
+	// A dying env must not block, but go to sched_yield to be freed.
+	if (curenv->env_status != ENV_DYING)
+		sched_sleep(curenv, now + cycles);
+	env_unlock(curenv);
+	sched_yield();
 }
 
 
@@ -504,8 +1273,30 @@ syscall(uint64_t syscallno, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4,
 		return sys_ipc_recv((void*)a1);
 	case(SYS_ipc_try_send):
 		return sys_ipc_try_send((envid_t)a1,a2,(void*)a3,a4);
+	case(SYS_ipc_send):
+		return sys_ipc_send((envid_t)a1,a2,(void*)a3,a4);
+	case(SYS_ipc_call):
+		return sys_ipc_call((envid_t)a1,a2,(void*)a3,a4,(void*)a5);
+	case(SYS_ipc_reply_recv):
+		return sys_ipc_reply_recv((envid_t)a1,a2,(void*)a3,a4,(void*)a5);
 	case(SYS_env_set_trapframe):
 		return sys_env_set_trapframe((envid_t)a1,(struct Trapframe*)a2);
+	case(SYS_env_set_priority):
+		return sys_env_set_priority((envid_t)a1,(int)a2);
+	case(SYS_env_set_affinity):
+		return sys_env_set_affinity((envid_t)a1,(uint32_t)a2);
+	case(SYS_time_msec):
+		return sys_time_msec();
+	case(SYS_sleep_usec):
+		return sys_sleep_usec(a1);
+	case(SYS_page_alloc_huge):
+		return sys_page_alloc_huge((envid_t)a1,(void*)a2,a3);
+	case(SYS_fork):
+		return sys_fork();
+	case(SYS_page_map_batch):
+	case(SYS_page_alloc_batch):
+	case(SYS_page_unmap_batch):
+		return sys_page_batch(syscallno,(const struct PageOp*)a1,a2);
 	default:
 		return -E_NO_SYS;
 	}
@@ -1,26 +1,23 @@
 #include <kern/time.h>
-#include <inc/assert.h>
+#include <kern/cpu.h>
+#include <inc/x86.h>
 
-static unsigned int ticks;
+static uint64_t boot_tsc;
 
 void
 time_init(void)
 {
-	ticks = 0;
-}
-
-// This should be called once per timer interrupt.  A timer interrupt
-// fires every 10 ms.
-void
-time_tick(void)
-{
-	ticks++;
-	if (ticks * 10 < ticks)
-		panic("time_tick: time overflowed");
+	lapic_calibrate();
+	boot_tsc = read_tsc();
 }
 
+// Milliseconds since time_init.  Read from the TSC rather than counted
+// in timer interrupts, which only arrive when the scheduler has a
+// deadline to meet.
 unsigned int
 time_msec(void)
 {
-	return ticks * 10;
+	if (!tsc_khz)
+		return 0;
+	return (read_tsc() - boot_tsc) / tsc_khz;
 }
@@ -0,0 +1,254 @@
+// Cross-CPU TLB shootdown.
+//
+// tlb_invalidate (kern/pmap.c) flushes this CPU's TLB.  Other CPUs
+// that have the same address space loaded right now may still hold
+// the old translation; those that don't will flush it when they next
+// load it, because tlb_invalidate also bumps the address space's
+// pp_tlb_gen (see pmap_load).
+//
+// For the CPUs that do have it loaded, invalidations are batched per
+// CPU (tlb_shootdown_add) and sent as one IPI round by tlb_shootdown,
+// which waits until every target has flushed.  While any CPU has a
+// round outstanding, pages whose last reference was dropped are not
+// freed (tlb_defer_free): a remote CPU could still reach them through
+// a stale translation, even if it was another CPU that unmapped them.
+// They are freed once every round outstanding at the time has been
+// completed.
+//
+// tlb_shootdown must be called with no spinlocks held, since a target
+// may be spinning, interrupts off, on a lock this CPU holds.  The
+// kernel calls it on its way out to user space (env_run) and before
+// halting (sched_halt).  While waiting, a CPU also serves requests
+// sent to it, so two CPUs shooting each other down make progress.
+
+#include <inc/types.h>
+#include <inc/assert.h>
+#include <inc/x86.h>
+#include <inc/trap.h>
+
+#include <kern/tlb.h>
+#include <kern/pmap.h>
+#include <kern/cpu.h>
+
+// A batch holds up to TLB_BATCH addresses in up to TLB_NPML4 address
+// spaces; beyond that, targets flush all their non-global entries.
+#define TLB_BATCH	16
+#define TLB_NPML4	2
+
+struct TlbBatch {
+	pml4e_t *pml4[TLB_NPML4];
+	int npml4;
+	uintptr_t va[TLB_BATCH];
+	int nva;
+	bool flush_all;
+
+	uint32_t targets;		// CPUs to send to
+	pml4e_t *target_pml4[NCPU];	// What each had loaded when sent
+	volatile uint32_t pending;	// Targets that have yet to flush
+
+	// Rounds of this CPU's: one is outstanding while they differ.
+	volatile uint64_t opened;
+	volatile uint64_t closed;
+
+	struct PageInfo *deferred;	// Frees held back, linked by pp_link
+	uint64_t wait[NCPU];		// ... until each CPU closes these
+};
+
+static struct TlbBatch tlb_batches[NCPU];
+
+// The address space each CPU has loaded, or NULL for boot_pml4.
+static pml4e_t * volatile tlb_loaded[NCPU];
+
+static inline void
+mfence(void)
+{
+	asm volatile("mfence" : : : "memory");
+}
+
+static inline void
+atomic_clear_bit(volatile uint32_t *addr, int bit)
+{
+	asm volatile("lock; andl %1, %0"
+		     : "+m" (*addr) : "r" (~(1U << bit)) : "memory");
+}
+
+//
+// Record that this CPU is about to load 'pml4' (NULL for boot_pml4).
+// The fence orders this store before pmap_load's read of pp_tlb_gen:
+// either tlb_invalidate sees us in tlb_loaded[] and shoots us down, or
+// we see its new generation and flush.
+//
+void
+tlb_set_loaded(pml4e_t *pml4)
+{
+	tlb_loaded[cpunum()] = pml4;
+	mfence();
+}
+
+//
+// Queue an invalidation in 'pml4' for every other CPU that has it
+// loaded: of 'va', or of all its entries if 'all' is set.  The caller
+// has bumped pml4's pp_tlb_gen.
+//
+static void
+tlb_queue(pml4e_t *pml4, void *va, bool all)
+{
+	struct TlbBatch *b = &tlb_batches[cpunum()];
+	uint32_t targets = 0;
+	int i;
+
+	mfence();
+	for (i = 0; i < ncpu; i++)
+		if (&cpus[i] != thiscpu && tlb_loaded[i] == pml4)
+			targets |= 1 << i;
+	if (!targets)
+		return;
+
+	if (!b->targets)
+		b->opened++;
+	b->targets |= targets;
+	for (i = 0; i < b->npml4 && b->pml4[i] != pml4; i++)
+		;
+	if (i == b->npml4) {
+		if (b->npml4 == TLB_NPML4)
+			b->flush_all = 1;
+		else
+			b->pml4[b->npml4++] = pml4;
+	}
+	if (all || b->nva == TLB_BATCH)
+		b->flush_all = 1;
+	else
+		b->va[b->nva++] = (uintptr_t) va;
+}
+
+//
+// Note that 'va' in 'pml4' was invalidated locally and must be on
+// every other CPU that has 'pml4' loaded.
+//
+void
+tlb_shootdown_add(pml4e_t *pml4, void *va)
+{
+	tlb_queue(pml4, va, 0);
+}
+
+//
+// Likewise for all of pml4's (non-global) entries.
+//
+void
+tlb_shootdown_add_all(pml4e_t *pml4)
+{
+	tlb_queue(pml4, NULL, 1);
+}
+
+//
+// Called by page_decref for a page with no references left.  Returns
+// true if the page must not be freed yet, because some CPU has a round
+// outstanding, and holds on to it until those rounds are completed.
+// The page's unmapping was queued (tlb_queue) before its last
+// reference was dropped, so its round, if it has one, is seen here.
+//
+bool
+tlb_defer_free(struct PageInfo *pp)
+{
+	struct TlbBatch *b = &tlb_batches[cpunum()];
+	bool defer = 0;
+	int i;
+
+	mfence();
+	for (i = 0; i < ncpu; i++)
+		if (tlb_batches[i].opened != tlb_batches[i].closed) {
+			b->wait[i] = tlb_batches[i].opened;
+			defer = 1;
+		}
+	if (!defer)
+		return 0;
+	pp->pp_link = b->deferred;
+	b->deferred = pp;
+	return 1;
+}
+
+//
+// Serve the requests other CPUs have sent this one.  Besides the IPI
+// handler, a CPU that spins with interrupts off waiting on another
+// calls this, as the other may be waiting on it in tlb_shootdown.
+//
+void
+tlb_serve(void)
+{
+	int me = cpunum(), i, j;
+	struct TlbBatch *b;
+
+	for (i = 0; i < ncpu; i++) {
+		b = &tlb_batches[i];
+		if (!(b->pending & (1 << me)))
+			continue;
+		// A CPU that has since switched address spaces will flush
+		// when it comes back (pmap_load).
+		if (tlb_loaded[me] == b->target_pml4[me]) {
+			if (b->flush_all)
+				lcr3(rcr3());
+			else
+				for (j = 0; j < b->nva; j++)
+					invlpg((void *) b->va[j]);
+		}
+		atomic_clear_bit(&b->pending, me);
+	}
+}
+
+//
+// IRQ_TLB handler.
+//
+void
+tlb_shootdown_intr(void)
+{
+	tlb_serve();
+}
+
+//
+// Send this CPU's batch, wait for every target to flush, then free the
+// pages that were held back, if the rounds they wait for are all done.
+// Otherwise they are left for a later call: waiting on other CPUs'
+// rounds here could deadlock with one waiting on us.
+//
+void
+tlb_shootdown(void)
+{
+	struct TlbBatch *b = &tlb_batches[cpunum()];
+	struct PageInfo *pp;
+	int i;
+
+	if (b->targets) {
+		for (i = 0; i < ncpu; i++)
+			b->target_pml4[i] = tlb_loaded[i];
+		b->pending = b->targets;
+		mfence();
+		for (i = 0; i < ncpu; i++)
+			if (b->targets & (1 << i))
+				lapic_ipi_cpu(i, IRQ_OFFSET + IRQ_TLB);
+
+		while (b->pending) {
+			// Targets that have left the address space are done.
+			for (i = 0; i < ncpu; i++)
+				if ((b->pending & (1 << i))
+				    && tlb_loaded[i] != b->target_pml4[i])
+					atomic_clear_bit(&b->pending, i);
+			tlb_serve();
+			asm volatile("pause");
+		}
+
+		b->targets = 0;
+		b->npml4 = 0;
+		b->nva = 0;
+		b->flush_all = 0;
+		b->closed++;
+	}
+
+	for (i = 0; i < ncpu; i++)
+		if (tlb_batches[i].closed < b->wait[i])
+			return;
+	while ((pp = b->deferred) != NULL) {
+		b->deferred = pp->pp_link;
+		pp->pp_link = NULL;
+		page_free_order(pp, pp->pp_order);
+	}
+}
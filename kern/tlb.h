@@ -0,0 +1,18 @@
+#ifndef JOS_KERN_TLB_H
+#define JOS_KERN_TLB_H
+#ifndef JOS_KERNEL
+# error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/types.h>
+#include <inc/memlayout.h>
+
+void	tlb_set_loaded(pml4e_t *pml4);
+void	tlb_shootdown_add(pml4e_t *pml4, void *va);
+void	tlb_shootdown_add_all(pml4e_t *pml4);
+bool	tlb_defer_free(struct PageInfo *pp);
+void	tlb_shootdown(void);
+void	tlb_serve(void);
+void	tlb_shootdown_intr(void);
+
+#endif	// !JOS_KERN_TLB_H
@@ -14,6 +14,7 @@
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
 #include <kern/time.h>
+#include <kern/tlb.h>
 
 extern uintptr_t gdtdesc_64;
 struct Taskstate ts;
@@ -58,6 +59,8 @@ extern void trph_default();
 extern void irq0();
 extern void irq1();
 extern void irq2();
+extern void irq_resched();
+extern void irq_tlb();
 
 static const char *trapname(int trapno)
 {
@@ -136,6 +139,8 @@ trap_init(void)
 	SETGATE(idt[IRQ_OFFSET + 0],0,GD_KT,irq0,0);
 	SETGATE(idt[IRQ_OFFSET + IRQ_KBD],0,GD_KT,irq1,0);
 	SETGATE(idt[IRQ_OFFSET + IRQ_SERIAL],0,GD_KT,irq2,0);
+	SETGATE(idt[IRQ_OFFSET + IRQ_RESCHED],0,GD_KT,irq_resched,0);
+	SETGATE(idt[IRQ_OFFSET + IRQ_TLB],0,GD_KT,irq_tlb,0);
 	trap_init_percpu();
 }
 
@@ -291,11 +296,22 @@ trap_dispatch(struct Trapframe *tf)
 
 	if (tf->tf_trapno == IRQ_OFFSET + 0){
 		lapic_eoi();
-		
-		sched_yield();
+		sched_tick();
 		return;
 	}
 	
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_RESCHED){
+		lapic_eoi();
+		sched_resched();
+		return;
+	}
+
+	if (tf->tf_trapno == IRQ_OFFSET + IRQ_TLB){
+		lapic_eoi();
+		tlb_shootdown_intr();
+		return;
+	}
+
 	if (tf->tf_trapno == IRQ_OFFSET + IRQ_KBD){
 		kbd_intr();
 		return;
@@ -337,10 +353,9 @@ trap(struct Trapframe *tf)
 	if (panicstr)
 		asm volatile("hlt");
 
-	// Re-acqurie the big kernel lock if we were halted in
-	// sched_yield()
-	if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
-		lock_kernel();
+	// We may have been halted in sched_halt(); CPUs queueing work
+	// for us only need to send IRQ_RESCHED while we are.
+	xchg(&thiscpu->cpu_status, CPU_STARTED);
 
 	// Check that interrupts are disabled.  If this assertion
 	// fails, DO NOT be tempted to fix it by inserting a "cli" in
@@ -349,14 +364,13 @@ trap(struct Trapframe *tf)
 
 	if ((tf->tf_cs & 3) == 3) {
 		// Trapped from user mode.
-		// Acquire the big kernel lock before doing any
-		// serious kernel work.
-		// LAB 4: Your code here.
-		lock_kernel();
+		// There is no big kernel lock to take: the kernel code
+		// reached from here locks what it touches.
 		assert(curenv);
 
 		// Garbage collect if current enviroment is a zombie
 		if (curenv->env_status == ENV_DYING) {
+			env_lock(curenv);
 			env_free(curenv);
 			curenv = NULL;
 			sched_yield();
@@ -437,6 +451,20 @@ page_fault_handler(struct Trapframe *tf)
 	//   (the 'tf' variable points at 'curenv->env_tf').
 
 	// LAB 4: Your code here.
+
+	// Writes to copy-on-write pages are resolved here, without a
+	// round trip through the upcall.
+	if ((tf->tf_err & (FEC_PR | FEC_WR)) == (FEC_PR | FEC_WR) &&
+	    fault_va < UTOP) {
+		int r;
+
+		env_lock(curenv);
+		r = page_cow(curenv->env_pml4e, (void *) fault_va);
+		env_unlock(curenv);
+		if (r == 0)
+			return;
+	}
+
 	typedef void func(void);
 	func* pgfault_upcall = NULL;
 	if (curenv && (curenv->env_pgfault_upcall)){
@@ -456,6 +484,12 @@ page_fault_handler(struct Trapframe *tf)
 			utf = (struct UTrapframe*)(UXSTACKTOP-sizeof(struct UTrapframe));
 		}
 		user_mem_assert(curenv,(void*)utf,1,PTE_U);
+
+		// The exception stack may be copy-on-write, or in a page
+		// table shared by fork; we're about to write to it.
+		env_lock(curenv);
+		page_cow(curenv->env_pml4e, ROUNDDOWN((void*)utf, PGSIZE));
+		env_unlock(curenv);
 		
 		utf->utf_fault_va = fault_va;
 		utf->utf_err = tf->tf_err;
@@ -0,0 +1,27 @@
+#include <inc/lib.h>
+
+// Runs fn(id) in 'n' forked workers, worker id pinned to CPU id where
+// there is one, and returns the milliseconds until all have finished.
+unsigned
+bench_workers(int n, void (*fn)(int id))
+{
+	envid_t parent = sys_getenvid();
+	unsigned start;
+	int i, r;
+
+	start = sys_time_msec();
+	for (i = 0; i < n; i++) {
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+		if (r == 0) {
+			// Fails harmlessly on machines with fewer CPUs.
+			sys_env_set_affinity(0, 1 << i);
+			fn(i);
+			ipc_send(parent, i, 0, 0);
+			exit();
+		}
+	}
+	for (i = 0; i < n; i++)
+		ipc_recv(0, 0, 0);
+	return sys_time_msec() - start;
+}
@@ -7,16 +7,23 @@
 
 union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 
+// Window at which reads receive the file server's pages, and the pages
+// in which writes stage their bytes for it.  Both are unmapped again
+// once the request is done.
+#define READVA		0xE0000000
+#define WRITEVA		(READVA + IPC_MAXPAGES * PGSIZE)
+
 // Send an inter-environment request to the file server, and wait for
 // a reply.  The request body should be in fsipcbuf, and parts of the
 // response may be written back to fsipcbuf.
 // type: request code, passed as the simple integer IPC value.
 // dstva: virtual address at which to receive reply page, 0 if none.
 // Returns result from the file server.
+static envid_t fsenv;
+
 static int
 fsipc(unsigned type, void *dstva)
 {
-	static envid_t fsenv;
 	if (fsenv == 0)
 		fsenv = ipc_find_env(ENV_TYPE_FS);
 
@@ -25,8 +32,47 @@ fsipc(unsigned type, void *dstva)
 	if (debug)
 		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
 
-	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
-	return ipc_recv(NULL, dstva, NULL);
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+			dstva, NULL);
+}
+
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+	if (fsenv == 0)
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+}
+
+// Like fsipc_words, for reads and writes: send the 'len' byte request
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+	seg.seg_npages = npages;
+	return ipc_callv(fsenv, type, words,
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
 }
 
 static int devfile_flush(struct Fd *fd);
@@ -110,8 +156,10 @@ open(const char *path, int mode)
 static int
 devfile_flush(struct Fd *fd)
 {
-	fsipcbuf.flush.req_fileid = fd->fd_file.id;
-	return fsipc(FSREQ_FLUSH, NULL);
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
 }
 
 // Read at most 'n' bytes from 'fd' at the current position into 'buf'.
@@ -122,23 +170,22 @@ devfile_flush(struct Fd *fd)
 static ssize_t
 devfile_read(struct Fd *fd, void *buf, size_t n)
 {
-	// Make an FSREQ_READ request to the file system server after
-	// filling fsipcbuf.read with the request arguments.  The
-	// bytes read will be written back to fsipcbuf by the file
-	// system server.
-	// LAB 5: Your code here
-	//fsipc(unsigned type, void *dstva)
-	
-	fsipcbuf.read.req_fileid = fd->fd_file.id;
-	fsipcbuf.read.req_n = n;
-	int r = fsipc(FSREQ_READ,NULL);
-	if (r < 0){
-		// on error
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+	req->req_n = n;
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
 		return r;
-	}
-	memmove(buf,&fsipcbuf,r);
+	memmove(buf, (char *) READVA + words[0], r);
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
 	return r;
-	
 }
 
 // Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
@@ -149,21 +196,23 @@ devfile_read(struct Fd *fd, void *buf, size_t n)
 static ssize_t
 devfile_write(struct Fd *fd, const void *buf, size_t n)
 {
-	// Make an FSREQ_WRITE request to the file system server.  Be
-	// careful: fsipcbuf.write.req_buf is only so large, but
-	// remember that write is always allowed to write *fewer*
-	// bytes than requested.
-	// LAB 5: Your code here
-	
-	int num_bytes = MIN(n,PGSIZE - (sizeof(int) + sizeof(size_t)));
-	fsipcbuf.write.req_fileid = fd->fd_file.id;
-	fsipcbuf.write.req_n = n;
-	memcpy(fsipcbuf.write.req_buf,buf,num_bytes);
-	int r = fsipc(FSREQ_WRITE,NULL);
-	if (r < 0){
-		// on error
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
 		return r;
-	}
+	memmove((void *) WRITEVA, buf, n);
+	req->req_fileid = fd->fd_file.id;
+	req->req_n = n;
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+	ipc_unmap_window((void *) WRITEVA, npages);
 	return r;
 }
 
@@ -185,9 +234,11 @@ devfile_stat(struct Fd *fd, struct Stat *st)
 static int
 devfile_trunc(struct Fd *fd, off_t newsize)
 {
-	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
-	fsipcbuf.set_size.req_size = newsize;
-	return fsipc(FSREQ_SET_SIZE, NULL);
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+	req.req_size = newsize;
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
 }
 
 // Delete a file
@@ -207,7 +258,7 @@ sync(void)
 	// Ask the file server to update the disk
 	// by writing any dirty blocks in the buffer cache.
 
-	return fsipc(FSREQ_SYNC, NULL);
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
 }
 
 //Copy a file from src to dest
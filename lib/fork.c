@@ -3,13 +3,11 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW		0x800
-
 //
 // Custom page fault handler - if faulting page is copy-on-write,
 // map in our own private writable copy.
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
 //
 static void
 pgfault(struct UTrapframe *utf)
@@ -26,6 +24,19 @@ pgfault(struct UTrapframe *utf)
 	//   (see <inc/memlayout.h>).
 
 	if (err & FEC_WR){
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+				panic("sys_page_alloc_huge failed: %e\n", r);
+			memcpy(HUGETEMP,addr,PTSIZE);
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+				panic("sys_page_map failed\n");
+			if (sys_page_unmap(0,HUGETEMP))
+				panic("sys_page_unmap failed\n");
+			return;
+		}
 		if (uvpt[VPN(addr)] & PTE_COW){
 			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
 				panic("sys_page_alloc failed\n");
@@ -60,6 +71,38 @@ pgfault(struct UTrapframe *utf)
 
 }
 
+// fork queues its sys_page_map calls here and makes them with
+// sys_page_map_batch, a few hundred per trap into the kernel.
+#define FORK_NOPS	(4 * PAGE_BATCH_CHUNK)
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+	fork_nops = 0;
+}
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+		fork_flush();
+	op = &fork_ops[fork_nops++];
+	op->srcenvid = 0;
+	op->srcva = addr;
+	op->dstenvid = envid;
+	op->dstva = addr;
+	op->perm = perm;
+}
+
 //
 // Map our virtual page pn (address pn*PGSIZE) into the target envid
 // at the same virtual address.  If the page is writable or copy-on-write,
@@ -68,48 +111,77 @@ pgfault(struct UTrapframe *utf)
 // copy-on-write again if it was already copy-on-write at the beginning of
 // this function?)
 //
+// The mappings are queued (fork_map); fork_flush makes them, in order.
+//
 // Returns: 0 on success, < 0 on error.
 // It is also OK to panic on error.
 //
 static int
 duppage(envid_t envid, unsigned pn)
 {
-	int r;
-	void* addr = (void*)((uintptr_t)pn * PGSIZE);
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
 
 	if (uvpt[pn] & PTE_SHARE){
-		unsigned int perm = uvpt[pn] & (PTE_SYSCALL | PTE_SHARE);
-		r = sys_page_map(0,addr,envid,addr,perm);
-		if (r < 0)
-			panic("sys_page_map in duppage failed\n");
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
 		return 0;
 	}
 		
 	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
 		unsigned int perm = PTE_COW | PTE_U | PTE_P;
-		r = sys_page_map(0,addr,envid,addr,perm);
-		if (r < 0)
-			panic("sys_page_map1 in duppage failed\n");
-
-		
-		r = sys_page_map(0,addr,0,addr,perm);
-		if (r < 0)
-			panic("sys_page_map2 in duppage failed\n");
-
+		fork_map(envid, addr, perm);
+		fork_map(0, addr, perm);
 		return 0;
 
 	}
 	else {
-		unsigned int perm = PTE_U | PTE_P;
-		r = sys_page_map(0,addr,envid,addr,perm);
-		if (r < 0)
-			panic("sys_page_map3 in duppage failed\n");
+		fork_map(envid, addr, PTE_U | PTE_P);
 		return 0;
 	}
 }
 
 //
-// User-level fork with copy-on-write.
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+	pde_t pde = uvpd[VPD(addr)];
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+		perm = pde & PTE_SYSCALL;
+	else if (pde & (PTE_W | PTE_COW))
+		perm = PTE_COW | PTE_U | PTE_P;
+	else
+		perm = PTE_U | PTE_P;
+
+	fork_map(envid, addr, perm);
+	if (perm & PTE_COW)
+		fork_map(0, addr, perm);
+	return 0;
+}
+
+//
+// Fork with copy-on-write, done by the kernel (sys_fork).  The kernel
+// also copies pages on write faults, so unlike ufork this needs no page
+// fault handler.
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+		thisenv = &envs[ENVX(sys_getenvid())];
+	return envid;
+}
+
+//
+// User-level fork with copy-on-write, from sys_exofork and batched
+// sys_page_map calls.  Slower than fork; kept for comparison (forkbench).
 // Set up our page fault handler appropriately.
 // Create a child.
 // Copy our address space and page fault handler setup to the child.
@@ -139,7 +211,7 @@ duppage(envid_t envid, unsigned pn)
 
 */
 envid_t
-fork(void)
+ufork(void)
 {
 	
 	set_pgfault_handler(pgfault);
@@ -156,7 +228,11 @@ fork(void)
 		//to keep the bound at USTACKTOP.
 		for (; addr < USTACKTOP;){
 			if (uvpde[VPDPE(addr)] & PTE_P){
-				if (uvpd[VPD(addr)] & PTE_P){
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+					duphuge(child_envid, addr);
+					addr += PTSIZE;
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
 					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
 						duppage(child_envid, VPN(addr));
 					}
@@ -174,7 +250,7 @@ fork(void)
 				addr += PTSIZE * NPDENTRIES;
 			}
 		}
-		
+		fork_flush();
 
 		//map a user exception stack for the child
 		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
@@ -192,6 +268,8 @@ fork(void)
 	}
 	else {
 		thisenv = &envs[ENVX(sys_getenvid())];
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
 		return 0;
 	}
 	
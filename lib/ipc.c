@@ -41,11 +41,10 @@ ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
 }
 
 // Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
-// This function keeps trying until it succeeds.
-// It should panic() on any error other than -E_IPC_NOT_RECV.
+// The kernel blocks us until 'toenv' receives the message
+// (sys_ipc_send); we only try again if woken up before that.
 //
 // Hint:
-//   Use sys_yield() to be CPU-friendly.
 //   If 'pg' is null, pass sys_ipc_recv a value that it will understand
 //   as meaning "no page".  (Zero is not the right value.)
 void
@@ -53,19 +52,150 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
 {
 	if (!pg)
 		pg = (void*)(UTOP + 1);
-	int result;
-	do {
-		result = sys_ipc_try_send(to_env,val,pg,perm);
-		if (result)
-			sys_yield();
-		else {
-			break;
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+		;
+}
+// Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'to_env',
+// as ipc_send does, and wait for its reply, which is returned as
+// ipc_recv would.  Only 'to_env' can reply; other envs' messages wait.
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+	int r;
+
+	if (!pg)
+		pg = (void*)(UTOP + 1);
+	if (!rcv_pg)
+		rcv_pg = (void*)(UTOP + 1);
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+	if (perm_store)
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+	if (r)
+		return r;
+	return thisenv->env_ipc_value;
+}
+
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+		return -E_INVAL;
+	memmove(words, msg, len);
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+		return r;
+	return thisenv->env_ipc_value;
+}
+
+// Like ipc_call, for bulk transfers: send the first 'nwords' of the
+// IPC_NWORDS words at 'words' and the 'nsegs' page runs at 'segs',
+// with 'perm', and map up to 'rcv_npages' pages of the reply at
+// 'rcv_window' (see inc/syscall.h).  The reply's words are stored
+// back in 'words', and the number of its pages mapped is in
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+	void *pg = (void*)(UTOP + 1);
+	void *rcv_pg = (void*)(UTOP + 1);
+	int r;
+
+	if (nsegs) {
+		pg = (void *) segs;
+		perm |= IPC_PERM_SEGS(nsegs);
+	}
+	if (rcv_npages)
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+			 rcv_pg, words);
+	if (r)
+		return r;
+	return thisenv->env_ipc_value;
+}
+
+// The server side of ipc_call: reply 'val' (and 'pg' with 'perm', if
+// 'pg' is nonnull) to 'to_env', if it is waiting in ipc_call, and
+// receive the next request as ipc_recv(from_env_store, rcv_pg,
+// perm_store) does.  'to_env' 0 replies to no one.
+// If 'words_store' is nonnull, the request's register words (there
+// are thisenv->env_ipc_nwords) are stored in it; if perm includes
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+	int r;
+
+	if (!pg)
+		pg = (void*)(UTOP + 1);
+	if (!rcv_pg)
+		rcv_pg = (void*)(UTOP + 1);
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+	if (from_env_store)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+	if (perm_store)
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+	if (r)
+		return r;
+	return thisenv->env_ipc_value;
+}
+
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+		for (i = 0; i < n; i++) {
+			ops[i].dstenvid = 0;
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+			ops[i].perm = perm;
 		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+		if (r < 0)
+			return r;
+		va = (char *) va + n * PGSIZE;
 	}
-	while (result == -E_IPC_NOT_RECV && result);
-	
+	return 0;
+}
 
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
 }
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+	return ipc_window_batch(0, va, npages, 0);
+}
+
 // Find the first environment of the given type.  We'll use this to
 // find special environments.
 // Returns 0 if no such environment exists.
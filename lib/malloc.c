@@ -26,6 +26,49 @@ static uint8_t *mbegin = (uint8_t*) 0x08000000;
 static uint8_t *mend   = (uint8_t*) 0x10000000;
 static uint8_t *mptr;
 
+// Page operations for sys_page_alloc_batch and sys_page_unmap_batch.
+static struct PageOp mops[PAGE_BATCH_CHUNK];
+static int nmops;
+
+static int
+mops_add(int alloc, void *va, int perm)
+{
+	int r = 0;
+
+	mops[nmops].dstenvid = 0;
+	mops[nmops].dstva = (uintptr_t) va;
+	mops[nmops].perm = perm;
+	if (++nmops == PAGE_BATCH_CHUNK)
+		r = alloc ? sys_page_alloc_batch(mops, nmops)
+			  : sys_page_unmap_batch(mops, nmops);
+	if (nmops == PAGE_BATCH_CHUNK || r < 0)
+		nmops = 0;
+	return r;
+}
+
+static int
+mops_flush(int alloc)
+{
+	int r = 0;
+
+	if (nmops)
+		r = alloc ? sys_page_alloc_batch(mops, nmops)
+			  : sys_page_unmap_batch(mops, nmops);
+	nmops = 0;
+	return r;
+}
+
+// Unmap the pages in [v, v+n).
+static void
+unmap_pages(uint8_t *v, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i += PGSIZE)
+		mops_add(0, v + i, 0);
+	mops_flush(0);
+}
+
 static int
 isfree(void *v, size_t n)
 {
@@ -97,9 +140,12 @@ malloc(size_t n)
 	 */
 	for (i = 0; i < n + 4; i += PGSIZE){
 		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
-		if (sys_page_alloc(0, mptr + i, PTE_P|PTE_U|PTE_W|cont) < 0){
-			for (; i >= 0; i -= PGSIZE)
-				sys_page_unmap(0, mptr + i);
+		// Only the last page is written (its ref count) right
+		// away; the others stay demand-zero until used.
+		if (mops_add(1, mptr + i,
+			     PTE_P|PTE_U|PTE_W|cont|(cont ? PTE_LAZY : 0)) < 0 ||
+		    (!cont && mops_flush(1) < 0)){
+			unmap_pages(mptr, i + PGSIZE);
 			return 0;	/* out of physical memory */
 		}
 	}
@@ -124,10 +170,11 @@ free(void *v)
 	c = ROUNDDOWN(v, PGSIZE);
 
 	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
-		sys_page_unmap(0, c);
+		mops_add(0, c, 0);
 		c += PGSIZE;
 		assert(mbegin <= c && c < mend);
 	}
+	mops_flush(0);
 
 	/*
 	 * c is just a piece of this page, so dec the ref count
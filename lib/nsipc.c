@@ -8,6 +8,11 @@
 #define REQVA		0x0ffff000
 union Nsipc nsipcbuf __attribute__((aligned(PGSIZE)));
 
+// Pages in which sends stage their bytes for the network server.
+static char sendbuf[NSSEND_MAXPAGES * PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static envid_t nsenv;
+
 // Send an IP request to the network server, and wait for a reply.
 // The request body should be in nsipcbuf, and parts of the response
 // may be written back to nsipcbuf.
@@ -16,7 +21,6 @@ union Nsipc nsipcbuf __attribute__((aligned(PGSIZE)));
 static int
 nsipc(unsigned type)
 {
-	static envid_t nsenv;
 	if (nsenv == 0)
 		nsenv = ipc_find_env(ENV_TYPE_NS);
 
@@ -25,8 +29,22 @@ nsipc(unsigned type)
 	if (debug)
 		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
 
-	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
-	return ipc_recv(NULL, NULL, NULL);
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+}
+
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+	if (nsenv == 0)
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
 }
 
 int
@@ -55,16 +73,20 @@ nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
 int
 nsipc_shutdown(int s, int how)
 {
-	nsipcbuf.shutdown.req_s = s;
-	nsipcbuf.shutdown.req_how = how;
-	return nsipc(NSREQ_SHUTDOWN);
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+	req.req_how = how;
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
 }
 
 int
 nsipc_close(int s)
 {
-	nsipcbuf.close.req_s = s;
-	return nsipc(NSREQ_CLOSE);
+	struct Nsreq_close req;
+
+	req.req_s = s;
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
 }
 
 int
@@ -79,9 +101,11 @@ nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
 int
 nsipc_listen(int s, int backlog)
 {
-	nsipcbuf.listen.req_s = s;
-	nsipcbuf.listen.req_backlog = backlog;
-	return nsipc(NSREQ_LISTEN);
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+	req.req_backlog = backlog;
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
 }
 
 int
@@ -104,12 +128,25 @@ nsipc_recv(int s, void *mem, int len, unsigned int flags)
 int
 nsipc_send(int s, const void *buf, int size, unsigned int flags)
 {
-	nsipcbuf.send.req_s = s;
-	assert(size < 1600);
-	memmove(&nsipcbuf.send.req_buf, buf, size);
-	nsipcbuf.send.req_size = size;
-	nsipcbuf.send.req_flags = flags;
-	return nsipc(NSREQ_SEND);
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+	memmove(sendbuf, buf, size);
+	req->req_s = s;
+	req->req_size = size;
+	req->req_flags = flags;
+	seg.seg_va = (uintptr_t) sendbuf;
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
 }
 
 int
@@ -259,12 +259,17 @@ error:
 	return r;
 }
 
+// map_segment works on this many pages at a time, reading the ones
+// that come from the file at UTEMP, UTEMP+PGSIZE, ...
+#define SEG_BATCH	PAGE_BATCH_CHUNK
+
 static int
 map_segment(envid_t child, uintptr_t va, size_t memsz,
 	    int fd, size_t filesz, off_t fileoffset, int perm)
 {
-	int i, r;
-	void *blk;
+	struct PageOp alloc[SEG_BATCH], map[SEG_BATCH], unmap[SEG_BATCH];
+	int i, j, n, nfile, r;
+	void *tmp;
 
 	//cprintf("map_segment %x+%x\n", va, memsz);
 
@@ -275,25 +280,54 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
 		fileoffset -= i;
 	}
 
-	for (i = 0; i < memsz; i += PGSIZE) {
-		if (i >= filesz) {
-			// allocate a blank page
-			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
-				return r;
-		} else {
-			// from file
-			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
-				return r;
-			if ((r = seek(fd, fileoffset + i)) < 0)
-				return r;
-			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
-				return r;
-			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
-				panic("spawn: sys_page_map data: %e", r);
-			sys_page_unmap(0, UTEMP);
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+		n = MIN((memsz - i + PGSIZE - 1) / PGSIZE, SEG_BATCH);
+
+		// Allocate blank pages straight into the child, and pages
+		// for the file's contents at UTEMP in our address space.
+		nfile = 0;
+		for (j = 0; j < n; j++) {
+			if (i + j * PGSIZE < filesz) {
+				tmp = UTEMP + nfile * PGSIZE;
+				alloc[j].dstenvid = 0;
+				alloc[j].dstva = (uintptr_t) tmp;
+				alloc[j].perm = PTE_P|PTE_U|PTE_W;
+				map[nfile].srcenvid = 0;
+				map[nfile].srcva = (uintptr_t) tmp;
+				map[nfile].dstenvid = child;
+				map[nfile].dstva = va + i + j * PGSIZE;
+				map[nfile].perm = perm;
+				unmap[nfile].dstenvid = 0;
+				unmap[nfile].dstva = (uintptr_t) tmp;
+				nfile++;
+			} else {
+				// Blank (BSS) pages are only allocated
+				// once the child writes to them.
+				alloc[j].dstenvid = child;
+				alloc[j].dstva = va + i + j * PGSIZE;
+				alloc[j].perm = perm | PTE_LAZY;
+			}
+		}
+		if ((r = sys_page_alloc_batch(alloc, n)) < 0)
+			goto out;
+
+		// from file
+		for (j = 0; j < nfile; j++) {
+			if ((r = seek(fd, fileoffset + i + j * PGSIZE)) < 0)
+				goto out;
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+				       MIN(PGSIZE, filesz - i - j * PGSIZE))) < 0)
+				goto out;
 		}
+		if ((r = sys_page_map_batch(map, nfile)) < 0)
+			panic("spawn: sys_page_map_batch data: %e", r);
+		sys_page_unmap_batch(unmap, nfile);
 	}
 	return 0;
+
+out:
+	sys_page_unmap_batch(unmap, nfile);
+	return r;
 }
 
 // Copy the mappings for shared pages into the child address space.
@@ -304,7 +338,17 @@ copy_shared_pages(envid_t child)
 	uint64_t addr = 0;
 	for (; addr < USTACKTOP;){
 		if (uvpde[VPDPE(addr)] & PTE_P){
-			if (uvpd[VPD(addr)] & PTE_P){
+			//a 2MB page is described by its PDE, not by uvpt
+			if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+				if (uvpd[VPD(addr)] & PTE_SHARE){
+					unsigned int perm = uvpd[VPD(addr)] & (PTE_SYSCALL);
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+					if (r < 0)
+						panic("sys_page_map in copy_shared_pages failed\n");
+				}
+				addr += PTSIZE;
+			}
+			else if (uvpd[VPD(addr)] & PTE_P){
 				if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_SHARE && uvpt[VPN(addr)] & PTE_U){
 					unsigned int perm = uvpt[VPN(addr)] & (PTE_SYSCALL);
 					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
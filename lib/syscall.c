@@ -37,6 +37,49 @@ syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4,
 	return ret;
 }
 
+// A system call that can receive an IPC message, whose register
+// words (see inc/syscall.h) the kernel leaves in r8-r13.  If 'words'
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+	int64_t ret;
+
+	asm volatile("int %7\n"
+		     : "=a" (ret), "+r" (r8), "+r" (r9), "+r" (r10),
+		       "+r" (r11), "+r" (r12), "+r" (r13)
+		     : "i" (T_SYSCALL),
+		       "a" (num),
+		       "d" (a1),
+		       "c" (a2),
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+		words[0] = r8;
+		words[1] = r9;
+		words[2] = r10;
+		words[3] = r11;
+		words[4] = r12;
+		words[5] = r13;
+	}
+
+	if(check && ret > 0)
+		panic("syscall %d returned %d (> 0)", num, ret);
+
+	return ret;
+}
+
 void
 sys_cputs(const char *s, size_t len)
 {
@@ -111,10 +154,44 @@ sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
 	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
 }
 
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+}
+
 int
 sys_ipc_recv(void *dstva)
 {
-	return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+}
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+			     perm, (uint64_t) dstva, words);
+}
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+}
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
 }
 
 unsigned int
@@ -123,3 +200,38 @@ sys_time_msec(void)
 	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
 }
 
+int
+sys_sleep_usec(uint64_t usec)
+{
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+}
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+}
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+}
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+}
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+}
+
+envid_t
+sys_fork(void)
+{
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
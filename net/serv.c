@@ -64,7 +64,7 @@ get_buffer(void) {
         return 0;
     }
 
-    va = (void *)(REQVA + i * PGSIZE);
+    va = (void *)(REQVA + i * NSSEND_MAXPAGES * PGSIZE);
     buse[i] = 1;
 
     return va;
@@ -72,7 +72,7 @@ get_buffer(void) {
 
 static void
 put_buffer(void *va) {
-    int64_t i = ((uint64_t)va - REQVA) / PGSIZE;
+    int64_t i = ((uint64_t)va - REQVA) / (NSSEND_MAXPAGES * PGSIZE);
     buse[i] = 0;
 }
 
@@ -181,6 +181,9 @@ struct st_args {
     int32_t reqno;
     uint32_t whom;
     union Nsipc *req;
+    void *buf;                    // buffer the request's pages came in
+    int npages;                   // number of pages received there
+    uint64_t words[IPC_NWORDS];   // req, if it came in registers
 };
 
 static void
@@ -222,8 +225,9 @@ serve_thread(uint64_t a) {
                     req->recv.req_len, req->recv.req_flags);
             break;
         case NSREQ_SEND:
-            r = lwip_send(req->send.req_s, &req->send.req_buf,
-                    req->send.req_size, req->send.req_flags);
+            r = lwip_send(req->send.req_s, args->buf,
+                    MIN(req->send.req_size, args->npages * PGSIZE),
+                    req->send.req_flags);
             break;
         case NSREQ_SOCKET:
             r = lwip_socket(req->socket.req_domain, req->socket.req_type,
@@ -248,8 +252,8 @@ serve_thread(uint64_t a) {
     if (args->reqno != NSREQ_INPUT)
         ipc_send(args->whom, r, 0, 0);
 
-    put_buffer(args->req);
-    sys_page_unmap(0, (void*) args->req);
+    ipc_unmap_window(args->buf, args->npages);
+    put_buffer(args->buf);
     free(args);
 }
 
@@ -259,6 +263,7 @@ serve(void) {
     uint32_t whom;
     int i, perm;
     void *va;
+    uint64_t words[IPC_NWORDS];
 
     while (1) {
         // ipc_recv will block the entire process, so we flush
@@ -269,7 +274,8 @@ serve(void) {
 
         perm = 0;
         va = get_buffer();
-        reqno = ipc_recv((int32_t *) &whom, (void *) va, &perm);
+        reqno = ipc_reply_recv(0, 0, NULL, 0, (envid_t *) &whom,
+                IPC_WINDOW(va, NSSEND_MAXPAGES), &perm, words);
         if (debug) {
             cprintf("ns req %d from %08x\n", reqno, whom);
         }
@@ -281,9 +287,14 @@ serve(void) {
             continue;
         }
 
-        // All remaining requests must contain an argument page
-        if (!(perm & PTE_P)) {
+        // Small requests, and sends, come in registers (see
+        // nsipc_words and nsipc_send); all others must contain an
+        // argument page
+        bool inwords = reqno == NSREQ_SHUTDOWN || reqno == NSREQ_CLOSE
+            || reqno == NSREQ_LISTEN || reqno == NSREQ_SEND;
+        if (!(perm & PTE_P) && !inwords) {
             cprintf("Invalid request from %08x: no argument page\n", whom);
+            put_buffer(va);
             continue; // just leave it hanging...
         }
 
@@ -295,7 +306,13 @@ serve(void) {
 
         args->reqno = reqno;
         args->whom = whom;
+        args->buf = va;
+        args->npages = thisenv->env_ipc_npages;
         args->req = va;
+        if (inwords) {
+            memmove(args->words, words, sizeof(words));
+            args->req = (union Nsipc *) args->words;
+        }
 
         thread_create(0, "serve_thread", serve_thread, (uint64_t)args);
         thread_yield(); // let the thread created run
@@ -346,6 +363,10 @@ umain(int argc, char **argv)
         return;
     }
 
+    // Clients block on us; don't let CPU-bound envs get ahead.  The
+    // helpers forked above keep the default, dynamic priority.
+    sys_env_set_priority(0, 0);
+
     // lwIP requires a user threading library; start the library and jump
     // into a thread to continue initialization.
     thread_init();
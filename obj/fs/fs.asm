@@ -0,0 +1,15259 @@
+
+obj/fs/fs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 84 41 00 00       	call   8041c5 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <ide_wait_ready>:
+
+static int diskno = 1;
+
+static int
+ide_wait_ready(bool check_error)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 18          	sub    $0x18,%rsp
+  80004b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80004b <ide_wait_ready+0x8>
+  800052:	49 bb 2d 50 01 00 00 	movabs $0x1502d,%r11
+  800059:	00 00 00 
+  80005c:	4c 01 d8             	add    %r11,%rax
+  80005f:	89 f8                	mov    %edi,%eax
+  800061:	88 45 ec             	mov    %al,-0x14(%rbp)
+	int r;
+
+	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  800064:	90                   	nop
+  800065:	c7 45 f8 f7 01 00 00 	movl   $0x1f7,-0x8(%rbp)
+
+static __inline uint8_t
+inb(int port)
+{
+	uint8_t data;
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80006c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80006f:	89 c2                	mov    %eax,%edx
+  800071:	ec                   	in     (%dx),%al
+  800072:	88 45 f7             	mov    %al,-0x9(%rbp)
+	return data;
+  800075:	0f b6 45 f7          	movzbl -0x9(%rbp),%eax
+  800079:	0f b6 c0             	movzbl %al,%eax
+  80007c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80007f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800082:	25 c0 00 00 00       	and    $0xc0,%eax
+  800087:	83 f8 40             	cmp    $0x40,%eax
+  80008a:	75 d9                	jne    800065 <ide_wait_ready+0x22>
+		/* do nothing */;
+
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  80008c:	80 7d ec 00          	cmpb   $0x0,-0x14(%rbp)
+  800090:	74 11                	je     8000a3 <ide_wait_ready+0x60>
+  800092:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800095:	83 e0 21             	and    $0x21,%eax
+  800098:	85 c0                	test   %eax,%eax
+  80009a:	74 07                	je     8000a3 <ide_wait_ready+0x60>
+		return -1;
+  80009c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8000a1:	eb 05                	jmp    8000a8 <ide_wait_ready+0x65>
+	return 0;
+  8000a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+
+00000000008000aa <ide_probe_disk1>:
+
+bool
+ide_probe_disk1(void)
+{
+  8000aa:	55                   	push   %rbp
+  8000ab:	48 89 e5             	mov    %rsp,%rbp
+  8000ae:	41 57                	push   %r15
+  8000b0:	53                   	push   %rbx
+  8000b1:	48 83 ec 20          	sub    $0x20,%rsp
+  8000b5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000b5 <ide_probe_disk1+0xb>
+  8000bc:	49 bb c3 4f 01 00 00 	movabs $0x14fc3,%r11
+  8000c3:	00 00 00 
+  8000c6:	4c 01 db             	add    %r11,%rbx
+	int r, x;
+
+	// wait for Device 0 to be ready
+	ide_wait_ready(0);
+  8000c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ce:	48 b8 cb af fe ff ff 	movabs $0xfffffffffffeafcb,%rax
+  8000d5:	ff ff ff 
+  8000d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000dc:	ff d0                	call   *%rax
+  8000de:	c7 45 e4 f6 01 00 00 	movl   $0x1f6,-0x1c(%rbp)
+  8000e5:	c6 45 e3 f0          	movb   $0xf0,-0x1d(%rbp)
+}
+
+static __inline void
+outb(int port, uint8_t data)
+{
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8000e9:	0f b6 45 e3          	movzbl -0x1d(%rbp),%eax
+  8000ed:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8000f0:	ee                   	out    %al,(%dx)
+}
+  8000f1:	90                   	nop
+
+	// switch to Device 1
+	outb(0x1F6, 0xE0 | (1<<4));
+
+	// check for Device 1 to be ready for a while
+	for (x = 0;
+  8000f2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8000f9:	eb 04                	jmp    8000ff <ide_probe_disk1+0x55>
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+	     x++)
+  8000fb:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  8000ff:	81 7d ec e7 03 00 00 	cmpl   $0x3e7,-0x14(%rbp)
+  800106:	7f 26                	jg     80012e <ide_probe_disk1+0x84>
+  800108:	c7 45 dc f7 01 00 00 	movl   $0x1f7,-0x24(%rbp)
+	__asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80010f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800112:	89 c2                	mov    %eax,%edx
+  800114:	ec                   	in     (%dx),%al
+  800115:	88 45 db             	mov    %al,-0x25(%rbp)
+	return data;
+  800118:	0f b6 45 db          	movzbl -0x25(%rbp),%eax
+  80011c:	0f b6 c0             	movzbl %al,%eax
+  80011f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800122:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800125:	25 a1 00 00 00       	and    $0xa1,%eax
+  80012a:	85 c0                	test   %eax,%eax
+  80012c:	75 cd                	jne    8000fb <ide_probe_disk1+0x51>
+  80012e:	c7 45 d4 f6 01 00 00 	movl   $0x1f6,-0x2c(%rbp)
+  800135:	c6 45 d3 e0          	movb   $0xe0,-0x2d(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800139:	0f b6 45 d3          	movzbl -0x2d(%rbp),%eax
+  80013d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800140:	ee                   	out    %al,(%dx)
+}
+  800141:	90                   	nop
+		/* do nothing */;
+
+	// switch back to Device 0
+	outb(0x1F6, 0xE0 | (0<<4));
+
+	cprintf("Device 1 presence: %d\n", (x < 1000));
+  800142:	81 7d ec e7 03 00 00 	cmpl   $0x3e7,-0x14(%rbp)
+  800149:	0f 9e c0             	setle  %al
+  80014c:	0f b6 c0             	movzbl %al,%eax
+  80014f:	89 c6                	mov    %eax,%esi
+  800151:	48 b8 60 50 ff ff ff 	movabs $0xffffffffffff5060,%rax
+  800158:	ff ff ff 
+  80015b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80015f:	48 89 c7             	mov    %rax,%rdi
+  800162:	49 89 df             	mov    %rbx,%r15
+  800165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016a:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  800171:	ff ff ff 
+  800174:	48 01 da             	add    %rbx,%rdx
+  800177:	ff d2                	call   *%rdx
+	return (x < 1000);
+  800179:	81 7d ec e7 03 00 00 	cmpl   $0x3e7,-0x14(%rbp)
+  800180:	0f 9e c0             	setle  %al
+}
+  800183:	48 83 c4 20          	add    $0x20,%rsp
+  800187:	5b                   	pop    %rbx
+  800188:	41 5f                	pop    %r15
+  80018a:	5d                   	pop    %rbp
+  80018b:	c3                   	ret
+
+000000000080018c <ide_set_disk>:
+
+void
+ide_set_disk(int d)
+{
+  80018c:	55                   	push   %rbp
+  80018d:	48 89 e5             	mov    %rsp,%rbp
+  800190:	41 57                	push   %r15
+  800192:	48 83 ec 18          	sub    $0x18,%rsp
+  800196:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 800196 <ide_set_disk+0xa>
+  80019d:	49 bb e2 4e 01 00 00 	movabs $0x14ee2,%r11
+  8001a4:	00 00 00 
+  8001a7:	4c 01 d9             	add    %r11,%rcx
+  8001aa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (d != 0 && d != 1)
+  8001ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001b1:	74 45                	je     8001f8 <ide_set_disk+0x6c>
+  8001b3:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  8001b7:	74 3f                	je     8001f8 <ide_set_disk+0x6c>
+		panic("bad disk number");
+  8001b9:	48 b8 77 50 ff ff ff 	movabs $0xffffffffffff5077,%rax
+  8001c0:	ff ff ff 
+  8001c3:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8001c7:	48 89 c2             	mov    %rax,%rdx
+  8001ca:	be 3a 00 00 00       	mov    $0x3a,%esi
+  8001cf:	48 b8 87 50 ff ff ff 	movabs $0xffffffffffff5087,%rax
+  8001d6:	ff ff ff 
+  8001d9:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8001dd:	48 89 c7             	mov    %rax,%rdi
+  8001e0:	49 89 cf             	mov    %rcx,%r15
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  8001ef:	ff ff ff 
+  8001f2:	49 01 c8             	add    %rcx,%r8
+  8001f5:	41 ff d0             	call   *%r8
+	diskno = d;
+  8001f8:	48 ba 88 7f ff ff ff 	movabs $0xffffffffffff7f88,%rdx
+  8001ff:	ff ff ff 
+  800202:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800205:	89 04 11             	mov    %eax,(%rcx,%rdx,1)
+}
+  800208:	90                   	nop
+  800209:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+
+000000000080020f <ide_read>:
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  80020f:	55                   	push   %rbp
+  800210:	48 89 e5             	mov    %rsp,%rbp
+  800213:	41 57                	push   %r15
+  800215:	53                   	push   %rbx
+  800216:	48 83 ec 70          	sub    $0x70,%rsp
+  80021a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80021a <ide_read+0xb>
+  800221:	49 bb 5e 4e 01 00 00 	movabs $0x14e5e,%r11
+  800228:	00 00 00 
+  80022b:	4c 01 db             	add    %r11,%rbx
+  80022e:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  800231:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800235:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+	int r;
+
+	assert(nsecs <= 256);
+  800239:	48 81 7d 88 00 01 00 	cmpq   $0x100,-0x78(%rbp)
+  800240:	00 
+  800241:	76 50                	jbe    800293 <ide_read+0x84>
+  800243:	48 b8 90 50 ff ff ff 	movabs $0xffffffffffff5090,%rax
+  80024a:	ff ff ff 
+  80024d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800251:	48 89 c1             	mov    %rax,%rcx
+  800254:	48 b8 9d 50 ff ff ff 	movabs $0xffffffffffff509d,%rax
+  80025b:	ff ff ff 
+  80025e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800262:	48 89 c2             	mov    %rax,%rdx
+  800265:	be 43 00 00 00       	mov    $0x43,%esi
+  80026a:	48 b8 87 50 ff ff ff 	movabs $0xffffffffffff5087,%rax
+  800271:	ff ff ff 
+  800274:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800278:	48 89 c7             	mov    %rax,%rdi
+  80027b:	49 89 df             	mov    %rbx,%r15
+  80027e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800283:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  80028a:	ff ff ff 
+  80028d:	49 01 d8             	add    %rbx,%r8
+  800290:	41 ff d0             	call   *%r8
+
+	ide_wait_ready(0);
+  800293:	bf 00 00 00 00       	mov    $0x0,%edi
+  800298:	48 b8 cb af fe ff ff 	movabs $0xfffffffffffeafcb,%rax
+  80029f:	ff ff ff 
+  8002a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002a6:	ff d0                	call   *%rax
+
+	outb(0x1F2, nsecs);
+  8002a8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8002ac:	0f b6 c0             	movzbl %al,%eax
+  8002af:	c7 45 c0 f2 01 00 00 	movl   $0x1f2,-0x40(%rbp)
+  8002b6:	88 45 bf             	mov    %al,-0x41(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8002b9:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  8002bd:	8b 55 c0             	mov    -0x40(%rbp),%edx
+  8002c0:	ee                   	out    %al,(%dx)
+}
+  8002c1:	90                   	nop
+	outb(0x1F3, secno & 0xFF);
+  8002c2:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8002c5:	0f b6 c0             	movzbl %al,%eax
+  8002c8:	c7 45 c8 f3 01 00 00 	movl   $0x1f3,-0x38(%rbp)
+  8002cf:	88 45 c7             	mov    %al,-0x39(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8002d2:	0f b6 45 c7          	movzbl -0x39(%rbp),%eax
+  8002d6:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8002d9:	ee                   	out    %al,(%dx)
+}
+  8002da:	90                   	nop
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  8002db:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8002de:	c1 e8 08             	shr    $0x8,%eax
+  8002e1:	0f b6 c0             	movzbl %al,%eax
+  8002e4:	c7 45 d0 f4 01 00 00 	movl   $0x1f4,-0x30(%rbp)
+  8002eb:	88 45 cf             	mov    %al,-0x31(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8002ee:	0f b6 45 cf          	movzbl -0x31(%rbp),%eax
+  8002f2:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8002f5:	ee                   	out    %al,(%dx)
+}
+  8002f6:	90                   	nop
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  8002f7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8002fa:	c1 e8 10             	shr    $0x10,%eax
+  8002fd:	0f b6 c0             	movzbl %al,%eax
+  800300:	c7 45 d8 f5 01 00 00 	movl   $0x1f5,-0x28(%rbp)
+  800307:	88 45 d7             	mov    %al,-0x29(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80030a:	0f b6 45 d7          	movzbl -0x29(%rbp),%eax
+  80030e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800311:	ee                   	out    %al,(%dx)
+}
+  800312:	90                   	nop
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  800313:	48 b8 88 7f ff ff ff 	movabs $0xffffffffffff7f88,%rax
+  80031a:	ff ff ff 
+  80031d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800320:	c1 e0 04             	shl    $0x4,%eax
+  800323:	83 e0 10             	and    $0x10,%eax
+  800326:	89 c2                	mov    %eax,%edx
+  800328:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80032b:	c1 e8 18             	shr    $0x18,%eax
+  80032e:	83 e0 0f             	and    $0xf,%eax
+  800331:	09 d0                	or     %edx,%eax
+  800333:	83 c8 e0             	or     $0xffffffe0,%eax
+  800336:	0f b6 c0             	movzbl %al,%eax
+  800339:	c7 45 e0 f6 01 00 00 	movl   $0x1f6,-0x20(%rbp)
+  800340:	88 45 df             	mov    %al,-0x21(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800343:	0f b6 45 df          	movzbl -0x21(%rbp),%eax
+  800347:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80034a:	ee                   	out    %al,(%dx)
+}
+  80034b:	90                   	nop
+  80034c:	c7 45 e8 f7 01 00 00 	movl   $0x1f7,-0x18(%rbp)
+  800353:	c6 45 e7 20          	movb   $0x20,-0x19(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800357:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  80035b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80035e:	ee                   	out    %al,(%dx)
+}
+  80035f:	90                   	nop
+	outb(0x1F7, 0x20);	// CMD 0x20 means read sector
+
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  800360:	eb 69                	jmp    8003cb <ide_read+0x1bc>
+		if ((r = ide_wait_ready(1)) < 0)
+  800362:	bf 01 00 00 00       	mov    $0x1,%edi
+  800367:	48 b8 cb af fe ff ff 	movabs $0xfffffffffffeafcb,%rax
+  80036e:	ff ff ff 
+  800371:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800375:	ff d0                	call   *%rax
+  800377:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80037a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80037e:	79 05                	jns    800385 <ide_read+0x176>
+			return r;
+  800380:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800383:	eb 52                	jmp    8003d7 <ide_read+0x1c8>
+  800385:	c7 45 b8 f0 01 00 00 	movl   $0x1f0,-0x48(%rbp)
+  80038c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800390:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  800394:	c7 45 ac 00 01 00 00 	movl   $0x100,-0x54(%rbp)
+	__asm __volatile("cld\n\trepne\n\tinsw"			:
+  80039b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80039e:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  8003a2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8003a5:	48 89 ce             	mov    %rcx,%rsi
+  8003a8:	48 89 f7             	mov    %rsi,%rdi
+  8003ab:	89 c1                	mov    %eax,%ecx
+  8003ad:	fc                   	cld
+  8003ae:	f2 66 6d             	repnz insw (%dx),%es:(%rdi)
+  8003b1:	89 c8                	mov    %ecx,%eax
+  8003b3:	48 89 fe             	mov    %rdi,%rsi
+  8003b6:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8003ba:	89 45 ac             	mov    %eax,-0x54(%rbp)
+}
+  8003bd:	90                   	nop
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8003be:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8003c3:	48 81 45 90 00 02 00 	addq   $0x200,-0x70(%rbp)
+  8003ca:	00 
+  8003cb:	48 83 7d 88 00       	cmpq   $0x0,-0x78(%rbp)
+  8003d0:	75 90                	jne    800362 <ide_read+0x153>
+		insw(0x1F0, dst, SECTSIZE/2);
+	}
+
+	return 0;
+  8003d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003d7:	48 83 c4 70          	add    $0x70,%rsp
+  8003db:	5b                   	pop    %rbx
+  8003dc:	41 5f                	pop    %r15
+  8003de:	5d                   	pop    %rbp
+  8003df:	c3                   	ret
+
+00000000008003e0 <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  8003e0:	55                   	push   %rbp
+  8003e1:	48 89 e5             	mov    %rsp,%rbp
+  8003e4:	41 57                	push   %r15
+  8003e6:	53                   	push   %rbx
+  8003e7:	48 83 ec 70          	sub    $0x70,%rsp
+  8003eb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8003eb <ide_write+0xb>
+  8003f2:	49 bb 8d 4c 01 00 00 	movabs $0x14c8d,%r11
+  8003f9:	00 00 00 
+  8003fc:	4c 01 db             	add    %r11,%rbx
+  8003ff:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  800402:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800406:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+	int r;
+
+	assert(nsecs <= 256);
+  80040a:	48 81 7d 88 00 01 00 	cmpq   $0x100,-0x78(%rbp)
+  800411:	00 
+  800412:	76 50                	jbe    800464 <ide_write+0x84>
+  800414:	48 b8 90 50 ff ff ff 	movabs $0xffffffffffff5090,%rax
+  80041b:	ff ff ff 
+  80041e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800422:	48 89 c1             	mov    %rax,%rcx
+  800425:	48 b8 9d 50 ff ff ff 	movabs $0xffffffffffff509d,%rax
+  80042c:	ff ff ff 
+  80042f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800433:	48 89 c2             	mov    %rax,%rdx
+  800436:	be 5c 00 00 00       	mov    $0x5c,%esi
+  80043b:	48 b8 87 50 ff ff ff 	movabs $0xffffffffffff5087,%rax
+  800442:	ff ff ff 
+  800445:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800449:	48 89 c7             	mov    %rax,%rdi
+  80044c:	49 89 df             	mov    %rbx,%r15
+  80044f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800454:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  80045b:	ff ff ff 
+  80045e:	49 01 d8             	add    %rbx,%r8
+  800461:	41 ff d0             	call   *%r8
+
+	ide_wait_ready(0);
+  800464:	bf 00 00 00 00       	mov    $0x0,%edi
+  800469:	48 b8 cb af fe ff ff 	movabs $0xfffffffffffeafcb,%rax
+  800470:	ff ff ff 
+  800473:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800477:	ff d0                	call   *%rax
+
+	outb(0x1F2, nsecs);
+  800479:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80047d:	0f b6 c0             	movzbl %al,%eax
+  800480:	c7 45 c0 f2 01 00 00 	movl   $0x1f2,-0x40(%rbp)
+  800487:	88 45 bf             	mov    %al,-0x41(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80048a:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  80048e:	8b 55 c0             	mov    -0x40(%rbp),%edx
+  800491:	ee                   	out    %al,(%dx)
+}
+  800492:	90                   	nop
+	outb(0x1F3, secno & 0xFF);
+  800493:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  800496:	0f b6 c0             	movzbl %al,%eax
+  800499:	c7 45 c8 f3 01 00 00 	movl   $0x1f3,-0x38(%rbp)
+  8004a0:	88 45 c7             	mov    %al,-0x39(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8004a3:	0f b6 45 c7          	movzbl -0x39(%rbp),%eax
+  8004a7:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8004aa:	ee                   	out    %al,(%dx)
+}
+  8004ab:	90                   	nop
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  8004ac:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8004af:	c1 e8 08             	shr    $0x8,%eax
+  8004b2:	0f b6 c0             	movzbl %al,%eax
+  8004b5:	c7 45 d0 f4 01 00 00 	movl   $0x1f4,-0x30(%rbp)
+  8004bc:	88 45 cf             	mov    %al,-0x31(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8004bf:	0f b6 45 cf          	movzbl -0x31(%rbp),%eax
+  8004c3:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8004c6:	ee                   	out    %al,(%dx)
+}
+  8004c7:	90                   	nop
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  8004c8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8004cb:	c1 e8 10             	shr    $0x10,%eax
+  8004ce:	0f b6 c0             	movzbl %al,%eax
+  8004d1:	c7 45 d8 f5 01 00 00 	movl   $0x1f5,-0x28(%rbp)
+  8004d8:	88 45 d7             	mov    %al,-0x29(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8004db:	0f b6 45 d7          	movzbl -0x29(%rbp),%eax
+  8004df:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8004e2:	ee                   	out    %al,(%dx)
+}
+  8004e3:	90                   	nop
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  8004e4:	48 b8 88 7f ff ff ff 	movabs $0xffffffffffff7f88,%rax
+  8004eb:	ff ff ff 
+  8004ee:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8004f1:	c1 e0 04             	shl    $0x4,%eax
+  8004f4:	83 e0 10             	and    $0x10,%eax
+  8004f7:	89 c2                	mov    %eax,%edx
+  8004f9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8004fc:	c1 e8 18             	shr    $0x18,%eax
+  8004ff:	83 e0 0f             	and    $0xf,%eax
+  800502:	09 d0                	or     %edx,%eax
+  800504:	83 c8 e0             	or     $0xffffffe0,%eax
+  800507:	0f b6 c0             	movzbl %al,%eax
+  80050a:	c7 45 e0 f6 01 00 00 	movl   $0x1f6,-0x20(%rbp)
+  800511:	88 45 df             	mov    %al,-0x21(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800514:	0f b6 45 df          	movzbl -0x21(%rbp),%eax
+  800518:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80051b:	ee                   	out    %al,(%dx)
+}
+  80051c:	90                   	nop
+  80051d:	c7 45 e8 f7 01 00 00 	movl   $0x1f7,-0x18(%rbp)
+  800524:	c6 45 e7 30          	movb   $0x30,-0x19(%rbp)
+	__asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800528:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  80052c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80052f:	ee                   	out    %al,(%dx)
+}
+  800530:	90                   	nop
+	outb(0x1F7, 0x30);	// CMD 0x30 means write sector
+
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800531:	eb 63                	jmp    800596 <ide_write+0x1b6>
+		if ((r = ide_wait_ready(1)) < 0)
+  800533:	bf 01 00 00 00       	mov    $0x1,%edi
+  800538:	48 b8 cb af fe ff ff 	movabs $0xfffffffffffeafcb,%rax
+  80053f:	ff ff ff 
+  800542:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800546:	ff d0                	call   *%rax
+  800548:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80054b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80054f:	79 05                	jns    800556 <ide_write+0x176>
+			return r;
+  800551:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800554:	eb 4c                	jmp    8005a2 <ide_write+0x1c2>
+  800556:	c7 45 b8 f0 01 00 00 	movl   $0x1f0,-0x48(%rbp)
+  80055d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800561:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  800565:	c7 45 ac 00 01 00 00 	movl   $0x100,-0x54(%rbp)
+}
+
+static __inline void
+outsw(int port, const void *addr, int cnt)
+{
+	__asm __volatile("cld\n\trepne\n\toutsw"		:
+  80056c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80056f:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800573:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800576:	48 89 ce             	mov    %rcx,%rsi
+  800579:	89 c1                	mov    %eax,%ecx
+  80057b:	fc                   	cld
+  80057c:	f2 66 6f             	repnz outsw %ds:(%rsi),(%dx)
+  80057f:	89 c8                	mov    %ecx,%eax
+  800581:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  800585:	89 45 ac             	mov    %eax,-0x54(%rbp)
+			"=S" (addr), "=c" (cnt)			:
+			"d" (port), "0" (addr), "1" (cnt)	:
+			"cc");
+}
+  800588:	90                   	nop
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800589:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80058e:	48 81 45 90 00 02 00 	addq   $0x200,-0x70(%rbp)
+  800595:	00 
+  800596:	48 83 7d 88 00       	cmpq   $0x0,-0x78(%rbp)
+  80059b:	75 96                	jne    800533 <ide_write+0x153>
+		outsw(0x1F0, src, SECTSIZE/2);
+	}
+
+	return 0;
+  80059d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8005a2:	48 83 c4 70          	add    $0x70,%rsp
+  8005a6:	5b                   	pop    %rbx
+  8005a7:	41 5f                	pop    %r15
+  8005a9:	5d                   	pop    %rbp
+  8005aa:	c3                   	ret
+
+00000000008005ab <diskaddr>:
+#include "fs.h"
+
+// Return the virtual address of this disk block.
+void*
+diskaddr(uint64_t blockno)
+{
+  8005ab:	55                   	push   %rbp
+  8005ac:	48 89 e5             	mov    %rsp,%rbp
+  8005af:	41 57                	push   %r15
+  8005b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8005b5:	4c 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%r8        # 8005b5 <diskaddr+0xa>
+  8005bc:	49 bb c3 4a 01 00 00 	movabs $0x14ac3,%r11
+  8005c3:	00 00 00 
+  8005c6:	4d 01 d8             	add    %r11,%r8
+  8005c9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  8005cd:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8005d2:	74 2c                	je     800600 <diskaddr+0x55>
+  8005d4:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  8005db:	00 00 00 
+  8005de:	49 8b 04 00          	mov    (%r8,%rax,1),%rax
+  8005e2:	48 85 c0             	test   %rax,%rax
+  8005e5:	74 5f                	je     800646 <diskaddr+0x9b>
+  8005e7:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  8005ee:	00 00 00 
+  8005f1:	49 8b 04 00          	mov    (%r8,%rax,1),%rax
+  8005f5:	8b 40 04             	mov    0x4(%rax),%eax
+  8005f8:	89 c0                	mov    %eax,%eax
+  8005fa:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8005fe:	72 46                	jb     800646 <diskaddr+0x9b>
+		panic("bad block number %08x in diskaddr", blockno);
+  800600:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800604:	48 89 c1             	mov    %rax,%rcx
+  800607:	48 b8 b8 50 ff ff ff 	movabs $0xffffffffffff50b8,%rax
+  80060e:	ff ff ff 
+  800611:	49 8d 04 00          	lea    (%r8,%rax,1),%rax
+  800615:	48 89 c2             	mov    %rax,%rdx
+  800618:	be 09 00 00 00       	mov    $0x9,%esi
+  80061d:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  800624:	ff ff ff 
+  800627:	49 8d 04 00          	lea    (%r8,%rax,1),%rax
+  80062b:	48 89 c7             	mov    %rax,%rdi
+  80062e:	4d 89 c7             	mov    %r8,%r15
+  800631:	b8 00 00 00 00       	mov    $0x0,%eax
+  800636:	49 b9 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r9
+  80063d:	ff ff ff 
+  800640:	4d 01 c1             	add    %r8,%r9
+  800643:	41 ff d1             	call   *%r9
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  800646:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80064a:	48 05 00 00 01 00    	add    $0x10000,%rax
+  800650:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800654:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800658:	c9                   	leave
+  800659:	c3                   	ret
+
+000000000080065a <va_is_mapped>:
+
+// Is this virtual address mapped?
+bool
+va_is_mapped(void *va)
+{
+  80065a:	55                   	push   %rbp
+  80065b:	48 89 e5             	mov    %rsp,%rbp
+  80065e:	48 83 ec 08          	sub    $0x8,%rsp
+  800662:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800662 <va_is_mapped+0x8>
+  800669:	49 bb 16 4a 01 00 00 	movabs $0x14a16,%r11
+  800670:	00 00 00 
+  800673:	4c 01 d8             	add    %r11,%rax
+  800676:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (uvpml4e[VPML4E(va)] & PTE_P) && (uvpde[VPDPE(va)] & PTE_P) && (uvpd[VPD(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  80067a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80067e:	48 89 d1             	mov    %rdx,%rcx
+  800681:	48 c1 e9 27          	shr    $0x27,%rcx
+  800685:	48 ba f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rdx
+  80068c:	ff ff ff 
+  80068f:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800693:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800697:	83 e2 01             	and    $0x1,%edx
+  80069a:	48 85 d2             	test   %rdx,%rdx
+  80069d:	74 73                	je     800712 <va_is_mapped+0xb8>
+  80069f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006a3:	48 89 d1             	mov    %rdx,%rcx
+  8006a6:	48 c1 e9 1e          	shr    $0x1e,%rcx
+  8006aa:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8006b1:	ff ff ff 
+  8006b4:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8006b8:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8006bc:	83 e2 01             	and    $0x1,%edx
+  8006bf:	48 85 d2             	test   %rdx,%rdx
+  8006c2:	74 4e                	je     800712 <va_is_mapped+0xb8>
+  8006c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006c8:	48 89 d1             	mov    %rdx,%rcx
+  8006cb:	48 c1 e9 15          	shr    $0x15,%rcx
+  8006cf:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8006d6:	ff ff ff 
+  8006d9:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8006dd:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8006e1:	83 e2 01             	and    $0x1,%edx
+  8006e4:	48 85 d2             	test   %rdx,%rdx
+  8006e7:	74 29                	je     800712 <va_is_mapped+0xb8>
+  8006e9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006ed:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8006f1:	48 b9 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rcx
+  8006f8:	ff ff ff 
+  8006fb:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8006ff:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800703:	83 e0 01             	and    $0x1,%eax
+  800706:	48 85 c0             	test   %rax,%rax
+  800709:	74 07                	je     800712 <va_is_mapped+0xb8>
+  80070b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800710:	eb 05                	jmp    800717 <va_is_mapped+0xbd>
+  800712:	b8 00 00 00 00       	mov    $0x0,%eax
+  800717:	83 e0 01             	and    $0x1,%eax
+}
+  80071a:	c9                   	leave
+  80071b:	c3                   	ret
+
+000000000080071c <va_is_dirty>:
+
+// Is this virtual address dirty?
+bool
+va_is_dirty(void *va)
+{
+  80071c:	55                   	push   %rbp
+  80071d:	48 89 e5             	mov    %rsp,%rbp
+  800720:	48 83 ec 08          	sub    $0x8,%rsp
+  800724:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800724 <va_is_dirty+0x8>
+  80072b:	49 bb 54 49 01 00 00 	movabs $0x14954,%r11
+  800732:	00 00 00 
+  800735:	4c 01 d8             	add    %r11,%rax
+  800738:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (uvpt[PGNUM(va)] & PTE_D) != 0;
+  80073c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800740:	48 c1 ea 0c          	shr    $0xc,%rdx
+  800744:	48 b9 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rcx
+  80074b:	ff ff ff 
+  80074e:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  800752:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800756:	83 e0 40             	and    $0x40,%eax
+  800759:	48 85 c0             	test   %rax,%rax
+  80075c:	0f 95 c0             	setne  %al
+}
+  80075f:	c9                   	leave
+  800760:	c3                   	ret
+
+0000000000800761 <bc_pgfault>:
+// Fault any disk block that is read in to memory by
+// loading it from disk.
+// Hint: Use ide_read and BLKSECTS.
+static void
+bc_pgfault(struct UTrapframe *utf)
+{
+  800761:	55                   	push   %rbp
+  800762:	48 89 e5             	mov    %rsp,%rbp
+  800765:	41 57                	push   %r15
+  800767:	53                   	push   %rbx
+  800768:	48 83 ec 30          	sub    $0x30,%rsp
+  80076c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80076c <bc_pgfault+0xb>
+  800773:	49 bb 0c 49 01 00 00 	movabs $0x1490c,%r11
+  80077a:	00 00 00 
+  80077d:	4c 01 db             	add    %r11,%rbx
+  800780:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  800784:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800788:	48 8b 00             	mov    (%rax),%rax
+  80078b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint64_t blockno = ((uint64_t)addr - DISKMAP) / BLKSIZE;
+  80078f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800793:	48 2d 00 00 00 10    	sub    $0x10000000,%rax
+  800799:	48 c1 e8 0c          	shr    $0xc,%rax
+  80079d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	// Check that the fault was within the block cache region
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  8007a1:	48 81 7d e8 ff ff ff 	cmpq   $0xfffffff,-0x18(%rbp)
+  8007a8:	0f 
+  8007a9:	76 0b                	jbe    8007b6 <bc_pgfault+0x55>
+  8007ab:	b8 ff ff ff cf       	mov    $0xcfffffff,%eax
+  8007b0:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8007b4:	73 5f                	jae    800815 <bc_pgfault+0xb4>
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+  8007b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007ba:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8007be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007c2:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+  8007c9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007cd:	49 89 c9             	mov    %rcx,%r9
+  8007d0:	49 89 d0             	mov    %rdx,%r8
+  8007d3:	48 89 c1             	mov    %rax,%rcx
+  8007d6:	48 b8 e8 50 ff ff ff 	movabs $0xffffffffffff50e8,%rax
+  8007dd:	ff ff ff 
+  8007e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007e4:	48 89 c2             	mov    %rax,%rdx
+  8007e7:	be 27 00 00 00       	mov    $0x27,%esi
+  8007ec:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  8007f3:	ff ff ff 
+  8007f6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007fa:	48 89 c7             	mov    %rax,%rdi
+  8007fd:	49 89 df             	mov    %rbx,%r15
+  800800:	b8 00 00 00 00       	mov    $0x0,%eax
+  800805:	49 ba 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r10
+  80080c:	ff ff ff 
+  80080f:	49 01 da             	add    %rbx,%r10
+  800812:	41 ff d2             	call   *%r10
+		      utf->utf_rip, addr, utf->utf_err);
+
+	// Sanity check the block number.
+	if (super && blockno >= super->s_nblocks)
+  800815:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  80081c:	00 00 00 
+  80081f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800823:	48 85 c0             	test   %rax,%rax
+  800826:	74 5f                	je     800887 <bc_pgfault+0x126>
+  800828:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  80082f:	00 00 00 
+  800832:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800836:	8b 40 04             	mov    0x4(%rax),%eax
+  800839:	89 c0                	mov    %eax,%eax
+  80083b:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  80083f:	72 46                	jb     800887 <bc_pgfault+0x126>
+		panic("reading non-existent block %08x\n", blockno);
+  800841:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800845:	48 89 c1             	mov    %rax,%rcx
+  800848:	48 b8 18 51 ff ff ff 	movabs $0xffffffffffff5118,%rax
+  80084f:	ff ff ff 
+  800852:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800856:	48 89 c2             	mov    %rax,%rdx
+  800859:	be 2c 00 00 00       	mov    $0x2c,%esi
+  80085e:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  800865:	ff ff ff 
+  800868:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80086c:	48 89 c7             	mov    %rax,%rdi
+  80086f:	49 89 df             	mov    %rbx,%r15
+  800872:	b8 00 00 00 00       	mov    $0x0,%eax
+  800877:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  80087e:	ff ff ff 
+  800881:	49 01 d8             	add    %rbx,%r8
+  800884:	41 ff d0             	call   *%r8
+	// Allocate a page in the disk map region, read the contents
+	// of the block from the disk into that page.
+	// Hint: first round addr to page boundary.
+	//
+	// LAB 5: your code here.
+	addr = ROUNDDOWN(addr,BLKSIZE);
+  800887:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80088b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80088f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800893:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  800899:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	assert((uintptr_t)addr == (blockno * BLKSIZE) + DISKMAP);
+  80089d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8008a1:	48 05 00 00 01 00    	add    $0x10000,%rax
+  8008a7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8008ab:	48 89 c2             	mov    %rax,%rdx
+  8008ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008b2:	48 39 c2             	cmp    %rax,%rdx
+  8008b5:	74 50                	je     800907 <bc_pgfault+0x1a6>
+  8008b7:	48 b8 40 51 ff ff ff 	movabs $0xffffffffffff5140,%rax
+  8008be:	ff ff ff 
+  8008c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008c5:	48 89 c1             	mov    %rax,%rcx
+  8008c8:	48 b8 71 51 ff ff ff 	movabs $0xffffffffffff5171,%rax
+  8008cf:	ff ff ff 
+  8008d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008d6:	48 89 c2             	mov    %rax,%rdx
+  8008d9:	be 37 00 00 00       	mov    $0x37,%esi
+  8008de:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  8008e5:	ff ff ff 
+  8008e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008ec:	48 89 c7             	mov    %rax,%rdi
+  8008ef:	49 89 df             	mov    %rbx,%r15
+  8008f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f7:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  8008fe:	ff ff ff 
+  800901:	49 01 d8             	add    %rbx,%r8
+  800904:	41 ff d0             	call   *%r8
+	if(sys_page_alloc(0,addr,PTE_SYSCALL)){
+  800907:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80090b:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  800910:	48 89 c6             	mov    %rax,%rsi
+  800913:	bf 00 00 00 00       	mov    $0x0,%edi
+  800918:	49 89 df             	mov    %rbx,%r15
+  80091b:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  800922:	ff ff ff 
+  800925:	48 01 d8             	add    %rbx,%rax
+  800928:	ff d0                	call   *%rax
+  80092a:	85 c0                	test   %eax,%eax
+  80092c:	74 3e                	je     80096c <bc_pgfault+0x20b>
+		panic("sys_page_alloc in bg_fault failed\n");
+  80092e:	48 b8 88 51 ff ff ff 	movabs $0xffffffffffff5188,%rax
+  800935:	ff ff ff 
+  800938:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80093c:	48 89 c2             	mov    %rax,%rdx
+  80093f:	be 39 00 00 00       	mov    $0x39,%esi
+  800944:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  80094b:	ff ff ff 
+  80094e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800952:	48 89 c7             	mov    %rax,%rdi
+  800955:	49 89 df             	mov    %rbx,%r15
+  800958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095d:	48 b9 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%rcx
+  800964:	ff ff ff 
+  800967:	48 01 d9             	add    %rbx,%rcx
+  80096a:	ff d1                	call   *%rcx
+	}
+	ide_read(blockno * BLKSECTS, addr,BLKSECTS);
+  80096c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800970:	8d 0c c5 00 00 00 00 	lea    0x0(,%rax,8),%ecx
+  800977:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80097b:	ba 08 00 00 00       	mov    $0x8,%edx
+  800980:	48 89 c6             	mov    %rax,%rsi
+  800983:	89 cf                	mov    %ecx,%edi
+  800985:	49 89 df             	mov    %rbx,%r15
+  800988:	48 b8 97 b1 fe ff ff 	movabs $0xfffffffffffeb197,%rax
+  80098f:	ff ff ff 
+  800992:	48 01 d8             	add    %rbx,%rax
+  800995:	ff d0                	call   *%rax
+
+	// LAB 5: Your code here
+
+
+	if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
+  800997:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80099b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80099f:	48 89 c2             	mov    %rax,%rdx
+  8009a2:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8009a9:	ff ff ff 
+  8009ac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8009b0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8009b4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8009b9:	89 c1                	mov    %eax,%ecx
+  8009bb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c3:	41 89 c8             	mov    %ecx,%r8d
+  8009c6:	48 89 d1             	mov    %rdx,%rcx
+  8009c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ce:	48 89 c6             	mov    %rax,%rsi
+  8009d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d6:	49 89 df             	mov    %rbx,%r15
+  8009d9:	48 b8 11 10 ff ff ff 	movabs $0xffffffffffff1011,%rax
+  8009e0:	ff ff ff 
+  8009e3:	48 01 d8             	add    %rbx,%rax
+  8009e6:	ff d0                	call   *%rax
+  8009e8:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8009eb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8009ef:	79 44                	jns    800a35 <bc_pgfault+0x2d4>
+		panic("in bc_pgfault, sys_page_map: %e", r);
+  8009f1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8009f4:	89 c1                	mov    %eax,%ecx
+  8009f6:	48 b8 b0 51 ff ff ff 	movabs $0xffffffffffff51b0,%rax
+  8009fd:	ff ff ff 
+  800a00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a04:	48 89 c2             	mov    %rax,%rdx
+  800a07:	be 41 00 00 00       	mov    $0x41,%esi
+  800a0c:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  800a13:	ff ff ff 
+  800a16:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a1a:	48 89 c7             	mov    %rax,%rdi
+  800a1d:	49 89 df             	mov    %rbx,%r15
+  800a20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a25:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  800a2c:	ff ff ff 
+  800a2f:	49 01 d8             	add    %rbx,%r8
+  800a32:	41 ff d0             	call   *%r8
+
+	// Check that the block we read was allocated. (exercise for
+	// the reader: why do we do this *after* reading the block
+	// in?)
+	if (bitmap && block_is_free(blockno))
+  800a35:	48 b8 90 1f 01 00 00 	movabs $0x11f90,%rax
+  800a3c:	00 00 00 
+  800a3f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800a43:	48 85 c0             	test   %rax,%rax
+  800a46:	74 62                	je     800aaa <bc_pgfault+0x349>
+  800a48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a4c:	89 c7                	mov    %eax,%edi
+  800a4e:	49 89 df             	mov    %rbx,%r15
+  800a51:	48 b8 aa c0 fe ff ff 	movabs $0xfffffffffffec0aa,%rax
+  800a58:	ff ff ff 
+  800a5b:	48 01 d8             	add    %rbx,%rax
+  800a5e:	ff d0                	call   *%rax
+  800a60:	84 c0                	test   %al,%al
+  800a62:	74 46                	je     800aaa <bc_pgfault+0x349>
+		panic("reading free block %08x\n", blockno);
+  800a64:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a68:	48 89 c1             	mov    %rax,%rcx
+  800a6b:	48 b8 d0 51 ff ff ff 	movabs $0xffffffffffff51d0,%rax
+  800a72:	ff ff ff 
+  800a75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a79:	48 89 c2             	mov    %rax,%rdx
+  800a7c:	be 47 00 00 00       	mov    $0x47,%esi
+  800a81:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  800a88:	ff ff ff 
+  800a8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a8f:	48 89 c7             	mov    %rax,%rdi
+  800a92:	49 89 df             	mov    %rbx,%r15
+  800a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9a:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  800aa1:	ff ff ff 
+  800aa4:	49 01 d8             	add    %rbx,%r8
+  800aa7:	41 ff d0             	call   *%r8
+}
+  800aaa:	90                   	nop
+  800aab:	48 83 c4 30          	add    $0x30,%rsp
+  800aaf:	5b                   	pop    %rbx
+  800ab0:	41 5f                	pop    %r15
+  800ab2:	5d                   	pop    %rbp
+  800ab3:	c3                   	ret
+
+0000000000800ab4 <flush_block>:
+// Hint: Use va_is_mapped, va_is_dirty, and ide_write.
+// Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
+// Hint: Don't forget to round addr down.
+void
+flush_block(void *addr)
+{
+  800ab4:	55                   	push   %rbp
+  800ab5:	48 89 e5             	mov    %rsp,%rbp
+  800ab8:	41 57                	push   %r15
+  800aba:	53                   	push   %rbx
+  800abb:	48 83 ec 20          	sub    $0x20,%rsp
+  800abf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800abf <flush_block+0xb>
+  800ac6:	49 bb b9 45 01 00 00 	movabs $0x145b9,%r11
+  800acd:	00 00 00 
+  800ad0:	4c 01 db             	add    %r11,%rbx
+  800ad3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	uint64_t blockno = ((uint64_t)addr - DISKMAP) / BLKSIZE;
+  800ad7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800adb:	48 2d 00 00 00 10    	sub    $0x10000000,%rax
+  800ae1:	48 c1 e8 0c          	shr    $0xc,%rax
+  800ae5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  800ae9:	48 81 7d d8 ff ff ff 	cmpq   $0xfffffff,-0x28(%rbp)
+  800af0:	0f 
+  800af1:	76 0b                	jbe    800afe <flush_block+0x4a>
+  800af3:	b8 ff ff ff cf       	mov    $0xcfffffff,%eax
+  800af8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  800afc:	73 46                	jae    800b44 <flush_block+0x90>
+		panic("flush_block of bad va %08x", addr);
+  800afe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b02:	48 89 c1             	mov    %rax,%rcx
+  800b05:	48 b8 e9 51 ff ff ff 	movabs $0xffffffffffff51e9,%rax
+  800b0c:	ff ff ff 
+  800b0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b13:	48 89 c2             	mov    %rax,%rdx
+  800b16:	be 57 00 00 00       	mov    $0x57,%esi
+  800b1b:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  800b22:	ff ff ff 
+  800b25:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b29:	48 89 c7             	mov    %rax,%rdi
+  800b2c:	49 89 df             	mov    %rbx,%r15
+  800b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b34:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  800b3b:	ff ff ff 
+  800b3e:	49 01 d8             	add    %rbx,%r8
+  800b41:	41 ff d0             	call   *%r8
+
+	// LAB 5: Your code here.
+	addr = ROUNDDOWN(addr,BLKSIZE);
+  800b44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b48:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800b4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800b50:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  800b56:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	if (va_is_mapped(addr) && va_is_dirty(addr)){
+  800b5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b5e:	48 89 c7             	mov    %rax,%rdi
+  800b61:	48 b8 e2 b5 fe ff ff 	movabs $0xfffffffffffeb5e2,%rax
+  800b68:	ff ff ff 
+  800b6b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b6f:	ff d0                	call   *%rax
+  800b71:	84 c0                	test   %al,%al
+  800b73:	74 76                	je     800beb <flush_block+0x137>
+  800b75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b79:	48 89 c7             	mov    %rax,%rdi
+  800b7c:	48 b8 a4 b6 fe ff ff 	movabs $0xfffffffffffeb6a4,%rax
+  800b83:	ff ff ff 
+  800b86:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b8a:	ff d0                	call   *%rax
+  800b8c:	84 c0                	test   %al,%al
+  800b8e:	74 5b                	je     800beb <flush_block+0x137>
+		ide_write(blockno*BLKSECTS,addr,BLKSECTS);
+  800b90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b94:	8d 0c c5 00 00 00 00 	lea    0x0(,%rax,8),%ecx
+  800b9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b9f:	ba 08 00 00 00       	mov    $0x8,%edx
+  800ba4:	48 89 c6             	mov    %rax,%rsi
+  800ba7:	89 cf                	mov    %ecx,%edi
+  800ba9:	49 89 df             	mov    %rbx,%r15
+  800bac:	48 b8 68 b3 fe ff ff 	movabs $0xfffffffffffeb368,%rax
+  800bb3:	ff ff ff 
+  800bb6:	48 01 d8             	add    %rbx,%rax
+  800bb9:	ff d0                	call   *%rax
+		
+		sys_page_map(0,addr,0,addr,PTE_SYSCALL);	
+  800bbb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800bbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bc3:	41 b8 07 0e 00 00    	mov    $0xe07,%r8d
+  800bc9:	48 89 d1             	mov    %rdx,%rcx
+  800bcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd1:	48 89 c6             	mov    %rax,%rsi
+  800bd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd9:	49 89 df             	mov    %rbx,%r15
+  800bdc:	48 b8 11 10 ff ff ff 	movabs $0xffffffffffff1011,%rax
+  800be3:	ff ff ff 
+  800be6:	48 01 d8             	add    %rbx,%rax
+  800be9:	ff d0                	call   *%rax
+	}
+}
+  800beb:	90                   	nop
+  800bec:	48 83 c4 20          	add    $0x20,%rsp
+  800bf0:	5b                   	pop    %rbx
+  800bf1:	41 5f                	pop    %r15
+  800bf3:	5d                   	pop    %rbp
+  800bf4:	c3                   	ret
+
+0000000000800bf5 <check_bc>:
+
+// Test that the block cache works, by smashing the superblock and
+// reading it back.
+static void
+check_bc(void)
+{
+  800bf5:	55                   	push   %rbp
+  800bf6:	48 89 e5             	mov    %rsp,%rbp
+  800bf9:	41 57                	push   %r15
+  800bfb:	53                   	push   %rbx
+  800bfc:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800c03:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800c03 <check_bc+0xe>
+  800c0a:	49 bb 75 44 01 00 00 	movabs $0x14475,%r11
+  800c11:	00 00 00 
+  800c14:	4c 01 db             	add    %r11,%rbx
+	struct Super backup;
+
+	// back up super block
+	memmove(&backup, diskaddr(1), sizeof backup);
+  800c17:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c1c:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800c23:	ff ff ff 
+  800c26:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c2a:	ff d0                	call   *%rax
+  800c2c:	48 89 c1             	mov    %rax,%rcx
+  800c2f:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800c36:	ba 08 01 00 00       	mov    $0x108,%edx
+  800c3b:	48 89 ce             	mov    %rcx,%rsi
+  800c3e:	48 89 c7             	mov    %rax,%rdi
+  800c41:	49 89 df             	mov    %rbx,%r15
+  800c44:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  800c4b:	ff ff ff 
+  800c4e:	48 01 d8             	add    %rbx,%rax
+  800c51:	ff d0                	call   *%rax
+
+	// smash it
+	strcpy(diskaddr(1), "OOPS!\n");
+  800c53:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c58:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800c5f:	ff ff ff 
+  800c62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c66:	ff d0                	call   *%rax
+  800c68:	48 89 c2             	mov    %rax,%rdx
+  800c6b:	48 b8 04 52 ff ff ff 	movabs $0xffffffffffff5204,%rax
+  800c72:	ff ff ff 
+  800c75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c79:	48 89 c6             	mov    %rax,%rsi
+  800c7c:	48 89 d7             	mov    %rdx,%rdi
+  800c7f:	49 89 df             	mov    %rbx,%r15
+  800c82:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  800c89:	ff ff ff 
+  800c8c:	48 01 d8             	add    %rbx,%rax
+  800c8f:	ff d0                	call   *%rax
+	flush_block(diskaddr(1));
+  800c91:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c96:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800c9d:	ff ff ff 
+  800ca0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ca4:	ff d0                	call   *%rax
+  800ca6:	48 89 c7             	mov    %rax,%rdi
+  800ca9:	48 b8 3c ba fe ff ff 	movabs $0xfffffffffffeba3c,%rax
+  800cb0:	ff ff ff 
+  800cb3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800cb7:	ff d0                	call   *%rax
+	assert(va_is_mapped(diskaddr(1)));
+  800cb9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cbe:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800cc5:	ff ff ff 
+  800cc8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ccc:	ff d0                	call   *%rax
+  800cce:	48 89 c7             	mov    %rax,%rdi
+  800cd1:	48 b8 e2 b5 fe ff ff 	movabs $0xfffffffffffeb5e2,%rax
+  800cd8:	ff ff ff 
+  800cdb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800cdf:	ff d0                	call   *%rax
+  800ce1:	83 f0 01             	xor    $0x1,%eax
+  800ce4:	84 c0                	test   %al,%al
+  800ce6:	74 50                	je     800d38 <check_bc+0x143>
+  800ce8:	48 b8 0b 52 ff ff ff 	movabs $0xffffffffffff520b,%rax
+  800cef:	ff ff ff 
+  800cf2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800cf6:	48 89 c1             	mov    %rax,%rcx
+  800cf9:	48 b8 71 51 ff ff ff 	movabs $0xffffffffffff5171,%rax
+  800d00:	ff ff ff 
+  800d03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d07:	48 89 c2             	mov    %rax,%rdx
+  800d0a:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800d0f:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  800d16:	ff ff ff 
+  800d19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d1d:	48 89 c7             	mov    %rax,%rdi
+  800d20:	49 89 df             	mov    %rbx,%r15
+  800d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d28:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  800d2f:	ff ff ff 
+  800d32:	49 01 d8             	add    %rbx,%r8
+  800d35:	41 ff d0             	call   *%r8
+	assert(!va_is_dirty(diskaddr(1)));
+  800d38:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d3d:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800d44:	ff ff ff 
+  800d47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d4b:	ff d0                	call   *%rax
+  800d4d:	48 89 c7             	mov    %rax,%rdi
+  800d50:	48 b8 a4 b6 fe ff ff 	movabs $0xfffffffffffeb6a4,%rax
+  800d57:	ff ff ff 
+  800d5a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d5e:	ff d0                	call   *%rax
+  800d60:	84 c0                	test   %al,%al
+  800d62:	74 50                	je     800db4 <check_bc+0x1bf>
+  800d64:	48 b8 25 52 ff ff ff 	movabs $0xffffffffffff5225,%rax
+  800d6b:	ff ff ff 
+  800d6e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d72:	48 89 c1             	mov    %rax,%rcx
+  800d75:	48 b8 71 51 ff ff ff 	movabs $0xffffffffffff5171,%rax
+  800d7c:	ff ff ff 
+  800d7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d83:	48 89 c2             	mov    %rax,%rdx
+  800d86:	be 70 00 00 00       	mov    $0x70,%esi
+  800d8b:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  800d92:	ff ff ff 
+  800d95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d99:	48 89 c7             	mov    %rax,%rdi
+  800d9c:	49 89 df             	mov    %rbx,%r15
+  800d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da4:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  800dab:	ff ff ff 
+  800dae:	49 01 d8             	add    %rbx,%r8
+  800db1:	41 ff d0             	call   *%r8
+
+
+	// clear it out
+	sys_page_unmap(0, diskaddr(1));
+  800db4:	bf 01 00 00 00       	mov    $0x1,%edi
+  800db9:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800dc0:	ff ff ff 
+  800dc3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800dc7:	ff d0                	call   *%rax
+  800dc9:	48 89 c6             	mov    %rax,%rsi
+  800dcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dd1:	49 89 df             	mov    %rbx,%r15
+  800dd4:	48 b8 84 10 ff ff ff 	movabs $0xffffffffffff1084,%rax
+  800ddb:	ff ff ff 
+  800dde:	48 01 d8             	add    %rbx,%rax
+  800de1:	ff d0                	call   *%rax
+	assert(!va_is_mapped(diskaddr(1)));
+  800de3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800de8:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800def:	ff ff ff 
+  800df2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800df6:	ff d0                	call   *%rax
+  800df8:	48 89 c7             	mov    %rax,%rdi
+  800dfb:	48 b8 e2 b5 fe ff ff 	movabs $0xfffffffffffeb5e2,%rax
+  800e02:	ff ff ff 
+  800e05:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e09:	ff d0                	call   *%rax
+  800e0b:	84 c0                	test   %al,%al
+  800e0d:	74 50                	je     800e5f <check_bc+0x26a>
+  800e0f:	48 b8 3f 52 ff ff ff 	movabs $0xffffffffffff523f,%rax
+  800e16:	ff ff ff 
+  800e19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e1d:	48 89 c1             	mov    %rax,%rcx
+  800e20:	48 b8 71 51 ff ff ff 	movabs $0xffffffffffff5171,%rax
+  800e27:	ff ff ff 
+  800e2a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e2e:	48 89 c2             	mov    %rax,%rdx
+  800e31:	be 75 00 00 00       	mov    $0x75,%esi
+  800e36:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  800e3d:	ff ff ff 
+  800e40:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e44:	48 89 c7             	mov    %rax,%rdi
+  800e47:	49 89 df             	mov    %rbx,%r15
+  800e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4f:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  800e56:	ff ff ff 
+  800e59:	49 01 d8             	add    %rbx,%r8
+  800e5c:	41 ff d0             	call   *%r8
+
+
+	// read it back in
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  800e5f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e64:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800e6b:	ff ff ff 
+  800e6e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e72:	ff d0                	call   *%rax
+  800e74:	48 89 c2             	mov    %rax,%rdx
+  800e77:	48 b8 04 52 ff ff ff 	movabs $0xffffffffffff5204,%rax
+  800e7e:	ff ff ff 
+  800e81:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e85:	48 89 c6             	mov    %rax,%rsi
+  800e88:	48 89 d7             	mov    %rdx,%rdi
+  800e8b:	49 89 df             	mov    %rbx,%r15
+  800e8e:	48 b8 a9 04 ff ff ff 	movabs $0xffffffffffff04a9,%rax
+  800e95:	ff ff ff 
+  800e98:	48 01 d8             	add    %rbx,%rax
+  800e9b:	ff d0                	call   *%rax
+  800e9d:	85 c0                	test   %eax,%eax
+  800e9f:	74 50                	je     800ef1 <check_bc+0x2fc>
+  800ea1:	48 b8 60 52 ff ff ff 	movabs $0xffffffffffff5260,%rax
+  800ea8:	ff ff ff 
+  800eab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800eaf:	48 89 c1             	mov    %rax,%rcx
+  800eb2:	48 b8 71 51 ff ff ff 	movabs $0xffffffffffff5171,%rax
+  800eb9:	ff ff ff 
+  800ebc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ec0:	48 89 c2             	mov    %rax,%rdx
+  800ec3:	be 79 00 00 00       	mov    $0x79,%esi
+  800ec8:	48 b8 da 50 ff ff ff 	movabs $0xffffffffffff50da,%rax
+  800ecf:	ff ff ff 
+  800ed2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ed6:	48 89 c7             	mov    %rax,%rdi
+  800ed9:	49 89 df             	mov    %rbx,%r15
+  800edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee1:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  800ee8:	ff ff ff 
+  800eeb:	49 01 d8             	add    %rbx,%r8
+  800eee:	41 ff d0             	call   *%r8
+
+
+	// fix it
+	memmove(diskaddr(1), &backup, sizeof backup);
+  800ef1:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ef6:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800efd:	ff ff ff 
+  800f00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f04:	ff d0                	call   *%rax
+  800f06:	48 89 c1             	mov    %rax,%rcx
+  800f09:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800f10:	ba 08 01 00 00       	mov    $0x108,%edx
+  800f15:	48 89 c6             	mov    %rax,%rsi
+  800f18:	48 89 cf             	mov    %rcx,%rdi
+  800f1b:	49 89 df             	mov    %rbx,%r15
+  800f1e:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  800f25:	ff ff ff 
+  800f28:	48 01 d8             	add    %rbx,%rax
+  800f2b:	ff d0                	call   *%rax
+	flush_block(diskaddr(1));
+  800f2d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f32:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800f39:	ff ff ff 
+  800f3c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f40:	ff d0                	call   *%rax
+  800f42:	48 89 c7             	mov    %rax,%rdi
+  800f45:	48 b8 3c ba fe ff ff 	movabs $0xfffffffffffeba3c,%rax
+  800f4c:	ff ff ff 
+  800f4f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f53:	ff d0                	call   *%rax
+
+	cprintf("block cache is good\n");
+  800f55:	48 b8 84 52 ff ff ff 	movabs $0xffffffffffff5284,%rax
+  800f5c:	ff ff ff 
+  800f5f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f63:	48 89 c7             	mov    %rax,%rdi
+  800f66:	49 89 df             	mov    %rbx,%r15
+  800f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6e:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  800f75:	ff ff ff 
+  800f78:	48 01 da             	add    %rbx,%rdx
+  800f7b:	ff d2                	call   *%rdx
+}
+  800f7d:	90                   	nop
+  800f7e:	48 81 c4 10 01 00 00 	add    $0x110,%rsp
+  800f85:	5b                   	pop    %rbx
+  800f86:	41 5f                	pop    %r15
+  800f88:	5d                   	pop    %rbp
+  800f89:	c3                   	ret
+
+0000000000800f8a <bc_init>:
+
+void
+bc_init(void)
+{
+  800f8a:	55                   	push   %rbp
+  800f8b:	48 89 e5             	mov    %rsp,%rbp
+  800f8e:	41 57                	push   %r15
+  800f90:	53                   	push   %rbx
+  800f91:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800f98:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800f98 <bc_init+0xe>
+  800f9f:	49 bb e0 40 01 00 00 	movabs $0x140e0,%r11
+  800fa6:	00 00 00 
+  800fa9:	4c 01 db             	add    %r11,%rbx
+	struct Super super;
+	set_pgfault_handler(bc_pgfault);
+  800fac:	48 b8 e9 b6 fe ff ff 	movabs $0xfffffffffffeb6e9,%rax
+  800fb3:	ff ff ff 
+  800fb6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fba:	48 89 c7             	mov    %rax,%rdi
+  800fbd:	49 89 df             	mov    %rbx,%r15
+  800fc0:	48 b8 55 17 ff ff ff 	movabs $0xffffffffffff1755,%rax
+  800fc7:	ff ff ff 
+  800fca:	48 01 d8             	add    %rbx,%rax
+  800fcd:	ff d0                	call   *%rax
+	check_bc();
+  800fcf:	48 b8 7d bb fe ff ff 	movabs $0xfffffffffffebb7d,%rax
+  800fd6:	ff ff ff 
+  800fd9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fdd:	ff d0                	call   *%rax
+
+	// cache the super block by reading it once
+	memmove(&super, diskaddr(1), sizeof super);
+  800fdf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800fe4:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  800feb:	ff ff ff 
+  800fee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ff2:	ff d0                	call   *%rax
+  800ff4:	48 89 c1             	mov    %rax,%rcx
+  800ff7:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800ffe:	ba 08 01 00 00       	mov    $0x108,%edx
+  801003:	48 89 ce             	mov    %rcx,%rsi
+  801006:	48 89 c7             	mov    %rax,%rdi
+  801009:	49 89 df             	mov    %rbx,%r15
+  80100c:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  801013:	ff ff ff 
+  801016:	48 01 d8             	add    %rbx,%rax
+  801019:	ff d0                	call   *%rax
+}
+  80101b:	90                   	nop
+  80101c:	48 81 c4 10 01 00 00 	add    $0x110,%rsp
+  801023:	5b                   	pop    %rbx
+  801024:	41 5f                	pop    %r15
+  801026:	5d                   	pop    %rbp
+  801027:	c3                   	ret
+
+0000000000801028 <check_super>:
+// --------------------------------------------------------------
+
+// Validate the file system super-block.
+void
+check_super(void)
+{
+  801028:	55                   	push   %rbp
+  801029:	48 89 e5             	mov    %rsp,%rbp
+  80102c:	41 57                	push   %r15
+  80102e:	48 83 ec 08          	sub    $0x8,%rsp
+  801032:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 801032 <check_super+0xa>
+  801039:	49 bb 46 40 01 00 00 	movabs $0x14046,%r11
+  801040:	00 00 00 
+  801043:	4c 01 d9             	add    %r11,%rcx
+	if (super->s_magic != FS_MAGIC)
+  801046:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  80104d:	00 00 00 
+  801050:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  801054:	8b 00                	mov    (%rax),%eax
+  801056:	3d ae 30 05 4a       	cmp    $0x4a0530ae,%eax
+  80105b:	74 3f                	je     80109c <check_super+0x74>
+		panic("bad file system magic number");
+  80105d:	48 b8 99 52 ff ff ff 	movabs $0xffffffffffff5299,%rax
+  801064:	ff ff ff 
+  801067:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80106b:	48 89 c2             	mov    %rax,%rdx
+  80106e:	be 0e 00 00 00       	mov    $0xe,%esi
+  801073:	48 b8 b6 52 ff ff ff 	movabs $0xffffffffffff52b6,%rax
+  80107a:	ff ff ff 
+  80107d:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  801081:	48 89 c7             	mov    %rax,%rdi
+  801084:	49 89 cf             	mov    %rcx,%r15
+  801087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108c:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  801093:	ff ff ff 
+  801096:	49 01 c8             	add    %rcx,%r8
+  801099:	41 ff d0             	call   *%r8
+
+	if (super->s_nblocks > DISKSIZE/BLKSIZE)
+  80109c:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  8010a3:	00 00 00 
+  8010a6:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8010aa:	8b 40 04             	mov    0x4(%rax),%eax
+  8010ad:	3d 00 00 0c 00       	cmp    $0xc0000,%eax
+  8010b2:	76 3f                	jbe    8010f3 <check_super+0xcb>
+		panic("file system is too large");
+  8010b4:	48 b8 be 52 ff ff ff 	movabs $0xffffffffffff52be,%rax
+  8010bb:	ff ff ff 
+  8010be:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8010c2:	48 89 c2             	mov    %rax,%rdx
+  8010c5:	be 11 00 00 00       	mov    $0x11,%esi
+  8010ca:	48 b8 b6 52 ff ff ff 	movabs $0xffffffffffff52b6,%rax
+  8010d1:	ff ff ff 
+  8010d4:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8010d8:	48 89 c7             	mov    %rax,%rdi
+  8010db:	49 89 cf             	mov    %rcx,%r15
+  8010de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e3:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  8010ea:	ff ff ff 
+  8010ed:	49 01 c8             	add    %rcx,%r8
+  8010f0:	41 ff d0             	call   *%r8
+
+	cprintf("superblock is good\n");
+  8010f3:	48 b8 d7 52 ff ff ff 	movabs $0xffffffffffff52d7,%rax
+  8010fa:	ff ff ff 
+  8010fd:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  801101:	48 89 c7             	mov    %rax,%rdi
+  801104:	49 89 cf             	mov    %rcx,%r15
+  801107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110c:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  801113:	ff ff ff 
+  801116:	48 01 ca             	add    %rcx,%rdx
+  801119:	ff d2                	call   *%rdx
+}
+  80111b:	90                   	nop
+  80111c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  801120:	c9                   	leave
+  801121:	c3                   	ret
+
+0000000000801122 <block_is_free>:
+
+// Check to see if the block bitmap indicates that block 'blockno' is free.
+// Return 1 if the block is free, 0 if not.
+bool
+block_is_free(uint32_t blockno)
+{
+  801122:	55                   	push   %rbp
+  801123:	48 89 e5             	mov    %rsp,%rbp
+  801126:	48 83 ec 08          	sub    $0x8,%rsp
+  80112a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80112a <block_is_free+0x8>
+  801131:	49 bb 4e 3f 01 00 00 	movabs $0x13f4e,%r11
+  801138:	00 00 00 
+  80113b:	4c 01 d8             	add    %r11,%rax
+  80113e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	if (super == 0 || blockno >= super->s_nblocks)
+  801141:	48 ba 98 1f 01 00 00 	movabs $0x11f98,%rdx
+  801148:	00 00 00 
+  80114b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80114f:	48 85 d2             	test   %rdx,%rdx
+  801152:	74 16                	je     80116a <block_is_free+0x48>
+  801154:	48 ba 98 1f 01 00 00 	movabs $0x11f98,%rdx
+  80115b:	00 00 00 
+  80115e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  801162:	8b 52 04             	mov    0x4(%rdx),%edx
+  801165:	39 55 fc             	cmp    %edx,-0x4(%rbp)
+  801168:	72 07                	jb     801171 <block_is_free+0x4f>
+		return 0;
+  80116a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116f:	eb 42                	jmp    8011b3 <block_is_free+0x91>
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+  801171:	48 ba 90 1f 01 00 00 	movabs $0x11f90,%rdx
+  801178:	00 00 00 
+  80117b:	48 8b 04 10          	mov    (%rax,%rdx,1),%rax
+  80117f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801182:	c1 ea 05             	shr    $0x5,%edx
+  801185:	89 d2                	mov    %edx,%edx
+  801187:	48 c1 e2 02          	shl    $0x2,%rdx
+  80118b:	48 01 d0             	add    %rdx,%rax
+  80118e:	8b 00                	mov    (%rax),%eax
+  801190:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801193:	83 e2 1f             	and    $0x1f,%edx
+  801196:	be 01 00 00 00       	mov    $0x1,%esi
+  80119b:	89 d1                	mov    %edx,%ecx
+  80119d:	d3 e6                	shl    %cl,%esi
+  80119f:	89 f2                	mov    %esi,%edx
+  8011a1:	21 d0                	and    %edx,%eax
+  8011a3:	85 c0                	test   %eax,%eax
+  8011a5:	74 07                	je     8011ae <block_is_free+0x8c>
+		return 1;
+  8011a7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ac:	eb 05                	jmp    8011b3 <block_is_free+0x91>
+	return 0;
+  8011ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b3:	c9                   	leave
+  8011b4:	c3                   	ret
+
+00000000008011b5 <free_block>:
+
+// Mark a block free in the bitmap
+void
+free_block(uint32_t blockno)
+{
+  8011b5:	55                   	push   %rbp
+  8011b6:	48 89 e5             	mov    %rsp,%rbp
+  8011b9:	41 57                	push   %r15
+  8011bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8011bf:	4c 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%r8        # 8011bf <free_block+0xa>
+  8011c6:	49 bb b9 3e 01 00 00 	movabs $0x13eb9,%r11
+  8011cd:	00 00 00 
+  8011d0:	4d 01 d8             	add    %r11,%r8
+  8011d3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	// Blockno zero is the null pointer of block numbers.
+	if (blockno == 0)
+  8011d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8011da:	75 3e                	jne    80121a <free_block+0x65>
+		panic("attempt to free zero block");
+  8011dc:	48 b8 eb 52 ff ff ff 	movabs $0xffffffffffff52eb,%rax
+  8011e3:	ff ff ff 
+  8011e6:	49 8d 04 00          	lea    (%r8,%rax,1),%rax
+  8011ea:	48 89 c2             	mov    %rax,%rdx
+  8011ed:	be 2c 00 00 00       	mov    $0x2c,%esi
+  8011f2:	48 b8 b6 52 ff ff ff 	movabs $0xffffffffffff52b6,%rax
+  8011f9:	ff ff ff 
+  8011fc:	49 8d 04 00          	lea    (%r8,%rax,1),%rax
+  801200:	48 89 c7             	mov    %rax,%rdi
+  801203:	4d 89 c7             	mov    %r8,%r15
+  801206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120b:	48 b9 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%rcx
+  801212:	ff ff ff 
+  801215:	4c 01 c1             	add    %r8,%rcx
+  801218:	ff d1                	call   *%rcx
+	bitmap[blockno/32] |= 1<<(blockno%32);
+  80121a:	48 b8 90 1f 01 00 00 	movabs $0x11f90,%rax
+  801221:	00 00 00 
+  801224:	49 8b 04 00          	mov    (%r8,%rax,1),%rax
+  801228:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80122b:	89 d6                	mov    %edx,%esi
+  80122d:	c1 ee 05             	shr    $0x5,%esi
+  801230:	89 f2                	mov    %esi,%edx
+  801232:	48 c1 e2 02          	shl    $0x2,%rdx
+  801236:	48 01 d0             	add    %rdx,%rax
+  801239:	8b 10                	mov    (%rax),%edx
+  80123b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80123e:	83 e0 1f             	and    $0x1f,%eax
+  801241:	bf 01 00 00 00       	mov    $0x1,%edi
+  801246:	89 c1                	mov    %eax,%ecx
+  801248:	d3 e7                	shl    %cl,%edi
+  80124a:	89 f8                	mov    %edi,%eax
+  80124c:	89 c7                	mov    %eax,%edi
+  80124e:	48 b8 90 1f 01 00 00 	movabs $0x11f90,%rax
+  801255:	00 00 00 
+  801258:	49 8b 04 00          	mov    (%r8,%rax,1),%rax
+  80125c:	89 f1                	mov    %esi,%ecx
+  80125e:	48 c1 e1 02          	shl    $0x2,%rcx
+  801262:	48 01 c8             	add    %rcx,%rax
+  801265:	09 fa                	or     %edi,%edx
+  801267:	89 10                	mov    %edx,(%rax)
+}
+  801269:	90                   	nop
+  80126a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80126e:	c9                   	leave
+  80126f:	c3                   	ret
+
+0000000000801270 <alloc_block>:
+// -E_NO_DISK if we are out of blocks.
+//
+// Hint: use free_block as an example for manipulating the bitmap.
+int
+alloc_block(void)
+{
+  801270:	55                   	push   %rbp
+  801271:	48 89 e5             	mov    %rsp,%rbp
+  801274:	41 57                	push   %r15
+  801276:	53                   	push   %rbx
+  801277:	48 83 ec 10          	sub    $0x10,%rsp
+  80127b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80127b <alloc_block+0xb>
+  801282:	49 bb fd 3d 01 00 00 	movabs $0x13dfd,%r11
+  801289:	00 00 00 
+  80128c:	4c 01 db             	add    %r11,%rbx
+	// contains the in-use bits for BLKBITSIZE blocks.  There are
+	// super->s_nblocks blocks in the disk altogether.
+
+	// bits in the bitmap are 0 for in use, and 1 for free.
+	// to get the index of the first free block, count the trailing zeroes
+	int i = 0, index = 0;
+  80128f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801296:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+	while (i*32 < super->s_nblocks){
+  80129d:	e9 e4 00 00 00       	jmp    801386 <alloc_block+0x116>
+		//if all the blocks in this bitmap are full, they will all be zero.
+		if (!bitmap[i]){
+  8012a2:	48 b8 90 1f 01 00 00 	movabs $0x11f90,%rax
+  8012a9:	00 00 00 
+  8012ac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8012b0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8012b3:	48 63 d2             	movslq %edx,%rdx
+  8012b6:	48 c1 e2 02          	shl    $0x2,%rdx
+  8012ba:	48 01 d0             	add    %rdx,%rax
+  8012bd:	8b 00                	mov    (%rax),%eax
+  8012bf:	85 c0                	test   %eax,%eax
+  8012c1:	75 09                	jne    8012cc <alloc_block+0x5c>
+			i++;
+  8012c3:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+			continue;
+  8012c7:	e9 ba 00 00 00       	jmp    801386 <alloc_block+0x116>
+		}
+
+		__asm __volatile("tzcnt %1, %0"  : "=r"(index) : "r"(bitmap[i]));
+  8012cc:	48 b8 90 1f 01 00 00 	movabs $0x11f90,%rax
+  8012d3:	00 00 00 
+  8012d6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8012da:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8012dd:	48 63 d2             	movslq %edx,%rdx
+  8012e0:	48 c1 e2 02          	shl    $0x2,%rdx
+  8012e4:	48 01 d0             	add    %rdx,%rax
+  8012e7:	8b 00                	mov    (%rax),%eax
+  8012e9:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8012ed:	89 45 e8             	mov    %eax,-0x18(%rbp)
+
+		//clear the appropriate bit
+		bitmap[i] &= ~(1 << index);
+  8012f0:	48 b8 90 1f 01 00 00 	movabs $0x11f90,%rax
+  8012f7:	00 00 00 
+  8012fa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8012fe:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801301:	48 63 d2             	movslq %edx,%rdx
+  801304:	48 c1 e2 02          	shl    $0x2,%rdx
+  801308:	48 01 d0             	add    %rdx,%rax
+  80130b:	8b 10                	mov    (%rax),%edx
+  80130d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801310:	be 01 00 00 00       	mov    $0x1,%esi
+  801315:	89 c1                	mov    %eax,%ecx
+  801317:	d3 e6                	shl    %cl,%esi
+  801319:	89 f0                	mov    %esi,%eax
+  80131b:	f7 d0                	not    %eax
+  80131d:	89 c6                	mov    %eax,%esi
+  80131f:	48 b8 90 1f 01 00 00 	movabs $0x11f90,%rax
+  801326:	00 00 00 
+  801329:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80132d:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  801330:	48 63 c9             	movslq %ecx,%rcx
+  801333:	48 c1 e1 02          	shl    $0x2,%rcx
+  801337:	48 01 c8             	add    %rcx,%rax
+  80133a:	21 f2                	and    %esi,%edx
+  80133c:	89 10                	mov    %edx,(%rax)
+		//flush it to disk
+		flush_block(diskaddr(index+(32*i)));
+  80133e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801341:	c1 e0 05             	shl    $0x5,%eax
+  801344:	89 c2                	mov    %eax,%edx
+  801346:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801349:	01 d0                	add    %edx,%eax
+  80134b:	48 98                	cltq
+  80134d:	48 89 c7             	mov    %rax,%rdi
+  801350:	49 89 df             	mov    %rbx,%r15
+  801353:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  80135a:	ff ff ff 
+  80135d:	48 01 d8             	add    %rbx,%rax
+  801360:	ff d0                	call   *%rax
+  801362:	48 89 c7             	mov    %rax,%rdi
+  801365:	49 89 df             	mov    %rbx,%r15
+  801368:	48 b8 3c ba fe ff ff 	movabs $0xfffffffffffeba3c,%rax
+  80136f:	ff ff ff 
+  801372:	48 01 d8             	add    %rbx,%rax
+  801375:	ff d0                	call   *%rax
+		return index+(32*i);
+  801377:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80137a:	c1 e0 05             	shl    $0x5,%eax
+  80137d:	89 c2                	mov    %eax,%edx
+  80137f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801382:	01 d0                	add    %edx,%eax
+  801384:	eb 26                	jmp    8013ac <alloc_block+0x13c>
+	while (i*32 < super->s_nblocks){
+  801386:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801389:	c1 e0 05             	shl    $0x5,%eax
+  80138c:	89 c2                	mov    %eax,%edx
+  80138e:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  801395:	00 00 00 
+  801398:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80139c:	8b 40 04             	mov    0x4(%rax),%eax
+  80139f:	39 c2                	cmp    %eax,%edx
+  8013a1:	0f 82 fb fe ff ff    	jb     8012a2 <alloc_block+0x32>
+	}
+	// if we get here that means we've exhausted all of the bitmaps, no disk memory.	
+	return -E_NO_DISK;
+  8013a7:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+}
+  8013ac:	48 83 c4 10          	add    $0x10,%rsp
+  8013b0:	5b                   	pop    %rbx
+  8013b1:	41 5f                	pop    %r15
+  8013b3:	5d                   	pop    %rbp
+  8013b4:	c3                   	ret
+
+00000000008013b5 <check_bitmap>:
+//
+// Check that all reserved blocks -- 0, 1, and the bitmap blocks themselves --
+// are all marked as in-use.
+void
+check_bitmap(void)
+{
+  8013b5:	55                   	push   %rbp
+  8013b6:	48 89 e5             	mov    %rsp,%rbp
+  8013b9:	41 57                	push   %r15
+  8013bb:	53                   	push   %rbx
+  8013bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8013c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8013c0 <check_bitmap+0xb>
+  8013c7:	49 bb b8 3c 01 00 00 	movabs $0x13cb8,%r11
+  8013ce:	00 00 00 
+  8013d1:	4c 01 db             	add    %r11,%rbx
+	uint32_t i;
+
+	// Make sure all bitmap blocks are marked in-use
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  8013d4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8013db:	eb 70                	jmp    80144d <check_bitmap+0x98>
+		assert(!block_is_free(2+i));
+  8013dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013e0:	83 c0 02             	add    $0x2,%eax
+  8013e3:	89 c7                	mov    %eax,%edi
+  8013e5:	48 b8 aa c0 fe ff ff 	movabs $0xfffffffffffec0aa,%rax
+  8013ec:	ff ff ff 
+  8013ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8013f3:	ff d0                	call   *%rax
+  8013f5:	84 c0                	test   %al,%al
+  8013f7:	74 50                	je     801449 <check_bitmap+0x94>
+  8013f9:	48 b8 06 53 ff ff ff 	movabs $0xffffffffffff5306,%rax
+  801400:	ff ff ff 
+  801403:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801407:	48 89 c1             	mov    %rax,%rcx
+  80140a:	48 b8 1a 53 ff ff ff 	movabs $0xffffffffffff531a,%rax
+  801411:	ff ff ff 
+  801414:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801418:	48 89 c2             	mov    %rax,%rdx
+  80141b:	be 61 00 00 00       	mov    $0x61,%esi
+  801420:	48 b8 b6 52 ff ff ff 	movabs $0xffffffffffff52b6,%rax
+  801427:	ff ff ff 
+  80142a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80142e:	48 89 c7             	mov    %rax,%rdi
+  801431:	49 89 df             	mov    %rbx,%r15
+  801434:	b8 00 00 00 00       	mov    $0x0,%eax
+  801439:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  801440:	ff ff ff 
+  801443:	49 01 d8             	add    %rbx,%r8
+  801446:	41 ff d0             	call   *%r8
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  801449:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80144d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801450:	c1 e0 0f             	shl    $0xf,%eax
+  801453:	89 c2                	mov    %eax,%edx
+  801455:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  80145c:	00 00 00 
+  80145f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801463:	8b 40 04             	mov    0x4(%rax),%eax
+  801466:	39 c2                	cmp    %eax,%edx
+  801468:	0f 82 6f ff ff ff    	jb     8013dd <check_bitmap+0x28>
+
+	// Make sure the reserved and root blocks are marked in-use.
+	assert(!block_is_free(0));
+  80146e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801473:	48 b8 aa c0 fe ff ff 	movabs $0xfffffffffffec0aa,%rax
+  80147a:	ff ff ff 
+  80147d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801481:	ff d0                	call   *%rax
+  801483:	84 c0                	test   %al,%al
+  801485:	74 50                	je     8014d7 <check_bitmap+0x122>
+  801487:	48 b8 2f 53 ff ff ff 	movabs $0xffffffffffff532f,%rax
+  80148e:	ff ff ff 
+  801491:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801495:	48 89 c1             	mov    %rax,%rcx
+  801498:	48 b8 1a 53 ff ff ff 	movabs $0xffffffffffff531a,%rax
+  80149f:	ff ff ff 
+  8014a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014a6:	48 89 c2             	mov    %rax,%rdx
+  8014a9:	be 64 00 00 00       	mov    $0x64,%esi
+  8014ae:	48 b8 b6 52 ff ff ff 	movabs $0xffffffffffff52b6,%rax
+  8014b5:	ff ff ff 
+  8014b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014bc:	48 89 c7             	mov    %rax,%rdi
+  8014bf:	49 89 df             	mov    %rbx,%r15
+  8014c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c7:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  8014ce:	ff ff ff 
+  8014d1:	49 01 d8             	add    %rbx,%r8
+  8014d4:	41 ff d0             	call   *%r8
+	assert(!block_is_free(1));
+  8014d7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014dc:	48 b8 aa c0 fe ff ff 	movabs $0xfffffffffffec0aa,%rax
+  8014e3:	ff ff ff 
+  8014e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014ea:	ff d0                	call   *%rax
+  8014ec:	84 c0                	test   %al,%al
+  8014ee:	74 50                	je     801540 <check_bitmap+0x18b>
+  8014f0:	48 b8 41 53 ff ff ff 	movabs $0xffffffffffff5341,%rax
+  8014f7:	ff ff ff 
+  8014fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014fe:	48 89 c1             	mov    %rax,%rcx
+  801501:	48 b8 1a 53 ff ff ff 	movabs $0xffffffffffff531a,%rax
+  801508:	ff ff ff 
+  80150b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80150f:	48 89 c2             	mov    %rax,%rdx
+  801512:	be 65 00 00 00       	mov    $0x65,%esi
+  801517:	48 b8 b6 52 ff ff ff 	movabs $0xffffffffffff52b6,%rax
+  80151e:	ff ff ff 
+  801521:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801525:	48 89 c7             	mov    %rax,%rdi
+  801528:	49 89 df             	mov    %rbx,%r15
+  80152b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801530:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  801537:	ff ff ff 
+  80153a:	49 01 d8             	add    %rbx,%r8
+  80153d:	41 ff d0             	call   *%r8
+
+	cprintf("bitmap is good\n");
+  801540:	48 b8 53 53 ff ff ff 	movabs $0xffffffffffff5353,%rax
+  801547:	ff ff ff 
+  80154a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80154e:	48 89 c7             	mov    %rax,%rdi
+  801551:	49 89 df             	mov    %rbx,%r15
+  801554:	b8 00 00 00 00       	mov    $0x0,%eax
+  801559:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  801560:	ff ff ff 
+  801563:	48 01 da             	add    %rbx,%rdx
+  801566:	ff d2                	call   *%rdx
+}
+  801568:	90                   	nop
+  801569:	48 83 c4 10          	add    $0x10,%rsp
+  80156d:	5b                   	pop    %rbx
+  80156e:	41 5f                	pop    %r15
+  801570:	5d                   	pop    %rbp
+  801571:	c3                   	ret
+
+0000000000801572 <fs_init>:
+
+
+// Initialize the file system
+void
+fs_init(void)
+{
+  801572:	55                   	push   %rbp
+  801573:	48 89 e5             	mov    %rsp,%rbp
+  801576:	41 57                	push   %r15
+  801578:	53                   	push   %rbx
+  801579:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801579 <fs_init+0x7>
+  801580:	49 bb ff 3a 01 00 00 	movabs $0x13aff,%r11
+  801587:	00 00 00 
+  80158a:	4c 01 db             	add    %r11,%rbx
+	static_assert(sizeof(struct File) == 256);
+
+
+	// Find a JOS disk.  Use the second IDE disk (number 1) if available.
+	if (ide_probe_disk1())
+  80158d:	49 89 df             	mov    %rbx,%r15
+  801590:	48 b8 32 b0 fe ff ff 	movabs $0xfffffffffffeb032,%rax
+  801597:	ff ff ff 
+  80159a:	48 01 d8             	add    %rbx,%rax
+  80159d:	ff d0                	call   *%rax
+  80159f:	84 c0                	test   %al,%al
+  8015a1:	74 19                	je     8015bc <fs_init+0x4a>
+		ide_set_disk(1);
+  8015a3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8015a8:	49 89 df             	mov    %rbx,%r15
+  8015ab:	48 b8 14 b1 fe ff ff 	movabs $0xfffffffffffeb114,%rax
+  8015b2:	ff ff ff 
+  8015b5:	48 01 d8             	add    %rbx,%rax
+  8015b8:	ff d0                	call   *%rax
+  8015ba:	eb 17                	jmp    8015d3 <fs_init+0x61>
+	else
+		ide_set_disk(0);
+  8015bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c1:	49 89 df             	mov    %rbx,%r15
+  8015c4:	48 b8 14 b1 fe ff ff 	movabs $0xfffffffffffeb114,%rax
+  8015cb:	ff ff ff 
+  8015ce:	48 01 d8             	add    %rbx,%rax
+  8015d1:	ff d0                	call   *%rax
+
+
+	bc_init();
+  8015d3:	49 89 df             	mov    %rbx,%r15
+  8015d6:	48 b8 12 bf fe ff ff 	movabs $0xfffffffffffebf12,%rax
+  8015dd:	ff ff ff 
+  8015e0:	48 01 d8             	add    %rbx,%rax
+  8015e3:	ff d0                	call   *%rax
+
+	// Set "super" to point to the super block.
+	super = diskaddr(1);
+  8015e5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8015ea:	49 89 df             	mov    %rbx,%r15
+  8015ed:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  8015f4:	ff ff ff 
+  8015f7:	48 01 d8             	add    %rbx,%rax
+  8015fa:	ff d0                	call   *%rax
+  8015fc:	48 ba 98 1f 01 00 00 	movabs $0x11f98,%rdx
+  801603:	00 00 00 
+  801606:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	check_super();
+  80160a:	48 b8 b0 bf fe ff ff 	movabs $0xfffffffffffebfb0,%rax
+  801611:	ff ff ff 
+  801614:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801618:	ff d0                	call   *%rax
+
+	// Set "bitmap" to the beginning of the first bitmap block.
+	bitmap = diskaddr(2);
+  80161a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80161f:	49 89 df             	mov    %rbx,%r15
+  801622:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  801629:	ff ff ff 
+  80162c:	48 01 d8             	add    %rbx,%rax
+  80162f:	ff d0                	call   *%rax
+  801631:	48 ba 90 1f 01 00 00 	movabs $0x11f90,%rdx
+  801638:	00 00 00 
+  80163b:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	check_bitmap();
+  80163f:	48 b8 3d c3 fe ff ff 	movabs $0xfffffffffffec33d,%rax
+  801646:	ff ff ff 
+  801649:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80164d:	ff d0                	call   *%rax
+}
+  80164f:	90                   	nop
+  801650:	5b                   	pop    %rbx
+  801651:	41 5f                	pop    %r15
+  801653:	5d                   	pop    %rbp
+  801654:	c3                   	ret
+
+0000000000801655 <file_block_walk>:
+//
+// Analogy: This is like pgdir_walk for files.
+// Hint: Don't forget to zero-out any block you allocate.
+int
+file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc)
+{
+  801655:	55                   	push   %rbp
+  801656:	48 89 e5             	mov    %rsp,%rbp
+  801659:	41 57                	push   %r15
+  80165b:	53                   	push   %rbx
+  80165c:	48 83 ec 30          	sub    $0x30,%rsp
+  801660:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801660 <file_block_walk+0xb>
+  801667:	49 bb 18 3a 01 00 00 	movabs $0x13a18,%r11
+  80166e:	00 00 00 
+  801671:	4c 01 db             	add    %r11,%rbx
+  801674:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801678:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80167b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80167f:	89 c8                	mov    %ecx,%eax
+  801681:	88 45 d0             	mov    %al,-0x30(%rbp)
+	if (filebno >= NDIRECT + NINDIRECT){
+  801684:	81 7d d4 09 04 00 00 	cmpl   $0x409,-0x2c(%rbp)
+  80168b:	76 0a                	jbe    801697 <file_block_walk+0x42>
+		return -E_INVAL;
+  80168d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801692:	e9 f9 00 00 00       	jmp    801790 <file_block_walk+0x13b>
+	}
+	
+	if (filebno < NDIRECT){
+  801697:	83 7d d4 09          	cmpl   $0x9,-0x2c(%rbp)
+  80169b:	77 2b                	ja     8016c8 <file_block_walk+0x73>
+		*ppdiskbno = &f->f_direct[filebno];
+  80169d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8016a0:	48 83 c0 20          	add    $0x20,%rax
+  8016a4:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8016ab:	00 
+  8016ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016b0:	48 01 d0             	add    %rdx,%rax
+  8016b3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8016b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016bb:	48 89 10             	mov    %rdx,(%rax)
+		return 0;
+  8016be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c3:	e9 c8 00 00 00       	jmp    801790 <file_block_walk+0x13b>
+	}
+	else {
+		//if indirect block is missing
+		if (!f->f_indirect){
+  8016c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016cc:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	75 7e                	jne    801754 <file_block_walk+0xff>
+			//if alloc mode is on - apparently I don't have to worry about this unless I do the challenge.
+			if (alloc){
+  8016d6:	80 7d d0 00          	cmpb   $0x0,-0x30(%rbp)
+  8016da:	74 71                	je     80174d <file_block_walk+0xf8>
+				//allocate an indirect block
+				uint32_t res = alloc_block(); 
+  8016dc:	48 b8 f8 c1 fe ff ff 	movabs $0xfffffffffffec1f8,%rax
+  8016e3:	ff ff ff 
+  8016e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016ea:	ff d0                	call   *%rax
+  8016ec:	89 45 ec             	mov    %eax,-0x14(%rbp)
+				// if successful, set the indirect block, and zero it out.
+				if (res > 0){
+  8016ef:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8016f3:	74 51                	je     801746 <file_block_walk+0xf1>
+					f->f_indirect = res;
+  8016f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016f9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8016fc:	89 90 b0 00 00 00    	mov    %edx,0xb0(%rax)
+					memset(diskaddr(res),0,BLKSIZE);
+  801702:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801705:	48 89 c7             	mov    %rax,%rdi
+  801708:	49 89 df             	mov    %rbx,%r15
+  80170b:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  801712:	ff ff ff 
+  801715:	48 01 d8             	add    %rbx,%rax
+  801718:	ff d0                	call   *%rax
+  80171a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80171f:	be 00 00 00 00       	mov    $0x0,%esi
+  801724:	48 89 c7             	mov    %rax,%rdi
+  801727:	49 89 df             	mov    %rbx,%r15
+  80172a:	48 b8 31 06 ff ff ff 	movabs $0xffffffffffff0631,%rax
+  801731:	ff ff ff 
+  801734:	48 01 d8             	add    %rbx,%rax
+  801737:	ff d0                	call   *%rax
+					*ppdiskbno = 0;
+  801739:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80173d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  801744:	eb 0e                	jmp    801754 <file_block_walk+0xff>
+					
+				}
+				else {
+					return -E_NO_DISK;
+  801746:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80174b:	eb 43                	jmp    801790 <file_block_walk+0x13b>
+				}
+			}
+			//otherwise just return that we cant find it
+			else {
+				return -E_NOT_FOUND;
+  80174d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801752:	eb 3c                	jmp    801790 <file_block_walk+0x13b>
+			}
+		}
+		// if its not missing, or if we just allocated it, return the appropriate block.
+		
+		*ppdiskbno = &(((uint32_t*)(diskaddr(f->f_indirect)))[filebno - NDIRECT]);
+  801754:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801758:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  80175e:	89 c0                	mov    %eax,%eax
+  801760:	48 89 c7             	mov    %rax,%rdi
+  801763:	49 89 df             	mov    %rbx,%r15
+  801766:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  80176d:	ff ff ff 
+  801770:	48 01 d8             	add    %rbx,%rax
+  801773:	ff d0                	call   *%rax
+  801775:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801778:	83 ea 0a             	sub    $0xa,%edx
+  80177b:	89 d2                	mov    %edx,%edx
+  80177d:	48 c1 e2 02          	shl    $0x2,%rdx
+  801781:	48 01 c2             	add    %rax,%rdx
+  801784:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801788:	48 89 10             	mov    %rdx,(%rax)
+		return 0;
+  80178b:	b8 00 00 00 00       	mov    $0x0,%eax
+				
+		
+	}
+		
+}
+  801790:	48 83 c4 30          	add    $0x30,%rsp
+  801794:	5b                   	pop    %rbx
+  801795:	41 5f                	pop    %r15
+  801797:	5d                   	pop    %rbp
+  801798:	c3                   	ret
+
+0000000000801799 <file_get_block>:
+//	-E_NO_DISK if a block needed to be allocated but the disk is full.
+//	-E_INVAL if filebno is out of range.
+//
+int
+file_get_block(struct File *f, uint32_t filebno, char **blk)
+{
+  801799:	55                   	push   %rbp
+  80179a:	48 89 e5             	mov    %rsp,%rbp
+  80179d:	41 57                	push   %r15
+  80179f:	53                   	push   %rbx
+  8017a0:	48 83 ec 30          	sub    $0x30,%rsp
+  8017a4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8017a4 <file_get_block+0xb>
+  8017ab:	49 bb d4 38 01 00 00 	movabs $0x138d4,%r11
+  8017b2:	00 00 00 
+  8017b5:	4c 01 db             	add    %r11,%rbx
+  8017b8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017bc:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8017bf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+
+	uint32_t *ppdiskbno;
+	int res = file_block_walk(f,filebno,&ppdiskbno,1);
+  8017c3:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8017c7:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8017ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ce:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017d3:	48 89 c7             	mov    %rax,%rdi
+  8017d6:	48 b8 dd c5 fe ff ff 	movabs $0xfffffffffffec5dd,%rax
+  8017dd:	ff ff ff 
+  8017e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8017e4:	ff d0                	call   *%rax
+  8017e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (filebno >= NDIRECT){
+	}
+	if (res < 0){
+  8017e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8017ed:	79 05                	jns    8017f4 <file_get_block+0x5b>
+		return res;
+  8017ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8017f2:	eb 5a                	jmp    80184e <file_get_block+0xb5>
+	}
+
+	if (!*ppdiskbno){
+  8017f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017f8:	8b 00                	mov    (%rax),%eax
+  8017fa:	85 c0                	test   %eax,%eax
+  8017fc:	75 27                	jne    801825 <file_get_block+0x8c>
+		res = alloc_block();
+  8017fe:	48 b8 f8 c1 fe ff ff 	movabs $0xfffffffffffec1f8,%rax
+  801805:	ff ff ff 
+  801808:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80180c:	ff d0                	call   *%rax
+  80180e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		if (res < 0)
+  801811:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801815:	79 05                	jns    80181c <file_get_block+0x83>
+			return res;
+  801817:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80181a:	eb 32                	jmp    80184e <file_get_block+0xb5>
+		*ppdiskbno = res;
+  80181c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801820:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801823:	89 10                	mov    %edx,(%rax)
+	}
+	*blk = diskaddr(*ppdiskbno);
+  801825:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801829:	8b 00                	mov    (%rax),%eax
+  80182b:	89 c0                	mov    %eax,%eax
+  80182d:	48 89 c7             	mov    %rax,%rdi
+  801830:	49 89 df             	mov    %rbx,%r15
+  801833:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  80183a:	ff ff ff 
+  80183d:	48 01 d8             	add    %rbx,%rax
+  801840:	ff d0                	call   *%rax
+  801842:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801846:	48 89 02             	mov    %rax,(%rdx)
+	return 0;
+  801849:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80184e:	48 83 c4 30          	add    $0x30,%rsp
+  801852:	5b                   	pop    %rbx
+  801853:	41 5f                	pop    %r15
+  801855:	5d                   	pop    %rbp
+  801856:	c3                   	ret
+
+0000000000801857 <dir_lookup>:
+//
+// Returns 0 and sets *file on success, < 0 on error.  Errors are:
+//	-E_NOT_FOUND if the file is not found
+static int
+dir_lookup(struct File *dir, const char *name, struct File **file)
+{
+  801857:	55                   	push   %rbp
+  801858:	48 89 e5             	mov    %rsp,%rbp
+  80185b:	41 57                	push   %r15
+  80185d:	53                   	push   %rbx
+  80185e:	48 83 ec 40          	sub    $0x40,%rsp
+  801862:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801862 <dir_lookup+0xb>
+  801869:	49 bb 16 38 01 00 00 	movabs $0x13816,%r11
+  801870:	00 00 00 
+  801873:	4c 01 db             	add    %r11,%rbx
+  801876:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80187a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80187e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	struct File *f;
+
+	// Search dir for name.
+	// We maintain the invariant that the size of a directory-file
+	// is always a multiple of the file system's block size.
+	assert((dir->f_size % BLKSIZE) == 0);
+  801882:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801886:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  80188c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801891:	85 c0                	test   %eax,%eax
+  801893:	74 50                	je     8018e5 <dir_lookup+0x8e>
+  801895:	48 b8 63 53 ff ff ff 	movabs $0xffffffffffff5363,%rax
+  80189c:	ff ff ff 
+  80189f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8018a3:	48 89 c1             	mov    %rax,%rcx
+  8018a6:	48 b8 1a 53 ff ff ff 	movabs $0xffffffffffff531a,%rax
+  8018ad:	ff ff ff 
+  8018b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8018b4:	48 89 c2             	mov    %rax,%rdx
+  8018b7:	be f3 00 00 00       	mov    $0xf3,%esi
+  8018bc:	48 b8 b6 52 ff ff ff 	movabs $0xffffffffffff52b6,%rax
+  8018c3:	ff ff ff 
+  8018c6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8018ca:	48 89 c7             	mov    %rax,%rdi
+  8018cd:	49 89 df             	mov    %rbx,%r15
+  8018d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d5:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  8018dc:	ff ff ff 
+  8018df:	49 01 d8             	add    %rbx,%r8
+  8018e2:	41 ff d0             	call   *%r8
+	nblock = dir->f_size / BLKSIZE;
+  8018e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018e9:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  8018ef:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8018f5:	85 c0                	test   %eax,%eax
+  8018f7:	0f 48 c2             	cmovs  %edx,%eax
+  8018fa:	c1 f8 0c             	sar    $0xc,%eax
+  8018fd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	for (i = 0; i < nblock; i++) {
+  801900:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801907:	e9 a3 00 00 00       	jmp    8019af <dir_lookup+0x158>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  80190c:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  801910:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  801913:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801917:	89 ce                	mov    %ecx,%esi
+  801919:	48 89 c7             	mov    %rax,%rdi
+  80191c:	48 b8 21 c7 fe ff ff 	movabs $0xfffffffffffec721,%rax
+  801923:	ff ff ff 
+  801926:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80192a:	ff d0                	call   *%rax
+  80192c:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80192f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  801933:	79 08                	jns    80193d <dir_lookup+0xe6>
+			return r;
+  801935:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  801938:	e9 83 00 00 00       	jmp    8019c0 <dir_lookup+0x169>
+		f = (struct File*) blk;
+  80193d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801941:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+		for (j = 0; j < BLKFILES; j++)
+  801945:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  80194c:	eb 57                	jmp    8019a5 <dir_lookup+0x14e>
+			if (strcmp(f[j].f_name, name) == 0) {
+  80194e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801951:	48 c1 e0 08          	shl    $0x8,%rax
+  801955:	48 89 c2             	mov    %rax,%rdx
+  801958:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80195c:	48 01 d0             	add    %rdx,%rax
+  80195f:	48 89 c2             	mov    %rax,%rdx
+  801962:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801966:	48 89 c6             	mov    %rax,%rsi
+  801969:	48 89 d7             	mov    %rdx,%rdi
+  80196c:	49 89 df             	mov    %rbx,%r15
+  80196f:	48 b8 a9 04 ff ff ff 	movabs $0xffffffffffff04a9,%rax
+  801976:	ff ff ff 
+  801979:	48 01 d8             	add    %rbx,%rax
+  80197c:	ff d0                	call   *%rax
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	75 1f                	jne    8019a1 <dir_lookup+0x14a>
+				*file = &f[j];
+  801982:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801985:	48 c1 e0 08          	shl    $0x8,%rax
+  801989:	48 89 c2             	mov    %rax,%rdx
+  80198c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801990:	48 01 c2             	add    %rax,%rdx
+  801993:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801997:	48 89 10             	mov    %rdx,(%rax)
+				return 0;
+  80199a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199f:	eb 1f                	jmp    8019c0 <dir_lookup+0x169>
+		for (j = 0; j < BLKFILES; j++)
+  8019a1:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  8019a5:	83 7d e8 0f          	cmpl   $0xf,-0x18(%rbp)
+  8019a9:	76 a3                	jbe    80194e <dir_lookup+0xf7>
+	for (i = 0; i < nblock; i++) {
+  8019ab:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8019af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019b2:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8019b5:	0f 82 51 ff ff ff    	jb     80190c <dir_lookup+0xb5>
+			}
+	}
+	return -E_NOT_FOUND;
+  8019bb:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+}
+  8019c0:	48 83 c4 40          	add    $0x40,%rsp
+  8019c4:	5b                   	pop    %rbx
+  8019c5:	41 5f                	pop    %r15
+  8019c7:	5d                   	pop    %rbp
+  8019c8:	c3                   	ret
+
+00000000008019c9 <dir_alloc_file>:
+
+// Set *file to point at a free File structure in dir.  The caller is
+// responsible for filling in the File fields.
+static int
+dir_alloc_file(struct File *dir, struct File **file)
+{
+  8019c9:	55                   	push   %rbp
+  8019ca:	48 89 e5             	mov    %rsp,%rbp
+  8019cd:	41 57                	push   %r15
+  8019cf:	53                   	push   %rbx
+  8019d0:	48 83 ec 30          	sub    $0x30,%rsp
+  8019d4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8019d4 <dir_alloc_file+0xb>
+  8019db:	49 bb a4 36 01 00 00 	movabs $0x136a4,%r11
+  8019e2:	00 00 00 
+  8019e5:	4c 01 db             	add    %r11,%rbx
+  8019e8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8019ec:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	uint32_t nblock, i, j;
+	char *blk;
+	struct File *f;
+
+	assert((dir->f_size % BLKSIZE) == 0);
+  8019f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019f4:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  8019fa:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019ff:	85 c0                	test   %eax,%eax
+  801a01:	74 50                	je     801a53 <dir_alloc_file+0x8a>
+  801a03:	48 b8 63 53 ff ff ff 	movabs $0xffffffffffff5363,%rax
+  801a0a:	ff ff ff 
+  801a0d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a11:	48 89 c1             	mov    %rax,%rcx
+  801a14:	48 b8 1a 53 ff ff ff 	movabs $0xffffffffffff531a,%rax
+  801a1b:	ff ff ff 
+  801a1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a22:	48 89 c2             	mov    %rax,%rdx
+  801a25:	be 0c 01 00 00       	mov    $0x10c,%esi
+  801a2a:	48 b8 b6 52 ff ff ff 	movabs $0xffffffffffff52b6,%rax
+  801a31:	ff ff ff 
+  801a34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a38:	48 89 c7             	mov    %rax,%rdi
+  801a3b:	49 89 df             	mov    %rbx,%r15
+  801a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a43:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  801a4a:	ff ff ff 
+  801a4d:	49 01 d8             	add    %rbx,%r8
+  801a50:	41 ff d0             	call   *%r8
+	nblock = dir->f_size / BLKSIZE;
+  801a53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a57:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801a5d:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  801a63:	85 c0                	test   %eax,%eax
+  801a65:	0f 48 c2             	cmovs  %edx,%eax
+  801a68:	c1 f8 0c             	sar    $0xc,%eax
+  801a6b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	for (i = 0; i < nblock; i++) {
+  801a6e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801a75:	e9 87 00 00 00       	jmp    801b01 <dir_alloc_file+0x138>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  801a7a:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  801a7e:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  801a81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a85:	89 ce                	mov    %ecx,%esi
+  801a87:	48 89 c7             	mov    %rax,%rdi
+  801a8a:	48 b8 21 c7 fe ff ff 	movabs $0xfffffffffffec721,%rax
+  801a91:	ff ff ff 
+  801a94:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a98:	ff d0                	call   *%rax
+  801a9a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  801a9d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  801aa1:	79 08                	jns    801aab <dir_alloc_file+0xe2>
+			return r;
+  801aa3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  801aa6:	e9 c2 00 00 00       	jmp    801b6d <dir_alloc_file+0x1a4>
+		f = (struct File*) blk;
+  801aab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aaf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+		for (j = 0; j < BLKFILES; j++)
+  801ab3:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  801aba:	eb 3b                	jmp    801af7 <dir_alloc_file+0x12e>
+			if (f[j].f_name[0] == '\0') {
+  801abc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801abf:	48 c1 e0 08          	shl    $0x8,%rax
+  801ac3:	48 89 c2             	mov    %rax,%rdx
+  801ac6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aca:	48 01 d0             	add    %rdx,%rax
+  801acd:	0f b6 00             	movzbl (%rax),%eax
+  801ad0:	84 c0                	test   %al,%al
+  801ad2:	75 1f                	jne    801af3 <dir_alloc_file+0x12a>
+				*file = &f[j];
+  801ad4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801ad7:	48 c1 e0 08          	shl    $0x8,%rax
+  801adb:	48 89 c2             	mov    %rax,%rdx
+  801ade:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae2:	48 01 c2             	add    %rax,%rdx
+  801ae5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801ae9:	48 89 10             	mov    %rdx,(%rax)
+				return 0;
+  801aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af1:	eb 7a                	jmp    801b6d <dir_alloc_file+0x1a4>
+		for (j = 0; j < BLKFILES; j++)
+  801af3:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  801af7:	83 7d e8 0f          	cmpl   $0xf,-0x18(%rbp)
+  801afb:	76 bf                	jbe    801abc <dir_alloc_file+0xf3>
+	for (i = 0; i < nblock; i++) {
+  801afd:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  801b01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b04:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  801b07:	0f 82 6d ff ff ff    	jb     801a7a <dir_alloc_file+0xb1>
+			}
+	}
+	dir->f_size += BLKSIZE;
+  801b0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b11:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801b17:	8d 90 00 10 00 00    	lea    0x1000(%rax),%edx
+  801b1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b21:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	if ((r = file_get_block(dir, i, &blk)) < 0)
+  801b27:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  801b2b:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  801b2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b32:	89 ce                	mov    %ecx,%esi
+  801b34:	48 89 c7             	mov    %rax,%rdi
+  801b37:	48 b8 21 c7 fe ff ff 	movabs $0xfffffffffffec721,%rax
+  801b3e:	ff ff ff 
+  801b41:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801b45:	ff d0                	call   *%rax
+  801b47:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  801b4a:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  801b4e:	79 05                	jns    801b55 <dir_alloc_file+0x18c>
+		return r;
+  801b50:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  801b53:	eb 18                	jmp    801b6d <dir_alloc_file+0x1a4>
+	f = (struct File*) blk;
+  801b55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b59:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	*file = &f[0];
+  801b5d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801b61:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b65:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  801b68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b6d:	48 83 c4 30          	add    $0x30,%rsp
+  801b71:	5b                   	pop    %rbx
+  801b72:	41 5f                	pop    %r15
+  801b74:	5d                   	pop    %rbp
+  801b75:	c3                   	ret
+
+0000000000801b76 <skip_slash>:
+
+// Skip over slashes.
+static const char*
+skip_slash(const char *p)
+{
+  801b76:	55                   	push   %rbp
+  801b77:	48 89 e5             	mov    %rsp,%rbp
+  801b7a:	48 83 ec 08          	sub    $0x8,%rsp
+  801b7e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b7e <skip_slash+0x8>
+  801b85:	49 bb fa 34 01 00 00 	movabs $0x134fa,%r11
+  801b8c:	00 00 00 
+  801b8f:	4c 01 d8             	add    %r11,%rax
+  801b92:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	while (*p == '/')
+  801b96:	eb 05                	jmp    801b9d <skip_slash+0x27>
+		p++;
+  801b98:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+	while (*p == '/')
+  801b9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ba1:	0f b6 00             	movzbl (%rax),%eax
+  801ba4:	3c 2f                	cmp    $0x2f,%al
+  801ba6:	74 f0                	je     801b98 <skip_slash+0x22>
+	return p;
+  801ba8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801bac:	c9                   	leave
+  801bad:	c3                   	ret
+
+0000000000801bae <walk_path>:
+// If we cannot find the file but find the directory
+// it should be in, set *pdir and copy the final path
+// element into lastelem.
+static int
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem)
+{
+  801bae:	55                   	push   %rbp
+  801baf:	48 89 e5             	mov    %rsp,%rbp
+  801bb2:	41 57                	push   %r15
+  801bb4:	53                   	push   %rbx
+  801bb5:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  801bbc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801bbc <walk_path+0xe>
+  801bc3:	49 bb bc 34 01 00 00 	movabs $0x134bc,%r11
+  801bca:	00 00 00 
+  801bcd:	4c 01 db             	add    %r11,%rbx
+  801bd0:	48 89 bd 38 ff ff ff 	mov    %rdi,-0xc8(%rbp)
+  801bd7:	48 89 b5 30 ff ff ff 	mov    %rsi,-0xd0(%rbp)
+  801bde:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+  801be5:	48 89 8d 20 ff ff ff 	mov    %rcx,-0xe0(%rbp)
+	struct File *dir, *f;
+	int r;
+
+	// if (*path != '/')
+	//	return -E_BAD_PATH;
+	path = skip_slash(path);
+  801bec:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801bf3:	48 89 c7             	mov    %rax,%rdi
+  801bf6:	48 b8 fe ca fe ff ff 	movabs $0xfffffffffffecafe,%rax
+  801bfd:	ff ff ff 
+  801c00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c04:	ff d0                	call   *%rax
+  801c06:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+	f = &super->s_root;
+  801c0d:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  801c14:	00 00 00 
+  801c17:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801c1b:	48 83 c0 08          	add    $0x8,%rax
+  801c1f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	dir = 0;
+  801c26:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  801c2d:	00 
+	name[0] = 0;
+  801c2e:	c6 85 50 ff ff ff 00 	movb   $0x0,-0xb0(%rbp)
+
+	if (pdir)
+  801c35:	48 83 bd 30 ff ff ff 	cmpq   $0x0,-0xd0(%rbp)
+  801c3c:	00 
+  801c3d:	74 0e                	je     801c4d <walk_path+0x9f>
+		*pdir = 0;
+  801c3f:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+  801c46:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	*pf = 0;
+  801c4d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801c54:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	while (*path != '\0') {
+  801c5b:	e9 75 01 00 00       	jmp    801dd5 <walk_path+0x227>
+		dir = f;
+  801c60:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801c67:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		p = path;
+  801c6b:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801c72:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		while (*path != '/' && *path != '\0')
+  801c76:	eb 08                	jmp    801c80 <walk_path+0xd2>
+			path++;
+  801c78:	48 83 85 38 ff ff ff 	addq   $0x1,-0xc8(%rbp)
+  801c7f:	01 
+		while (*path != '/' && *path != '\0')
+  801c80:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801c87:	0f b6 00             	movzbl (%rax),%eax
+  801c8a:	3c 2f                	cmp    $0x2f,%al
+  801c8c:	74 0e                	je     801c9c <walk_path+0xee>
+  801c8e:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801c95:	0f b6 00             	movzbl (%rax),%eax
+  801c98:	84 c0                	test   %al,%al
+  801c9a:	75 dc                	jne    801c78 <walk_path+0xca>
+		if (path - p >= MAXNAMELEN)
+  801c9c:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801ca3:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  801ca7:	48 83 f8 7f          	cmp    $0x7f,%rax
+  801cab:	7e 0a                	jle    801cb7 <walk_path+0x109>
+			return -E_BAD_PATH;
+  801cad:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801cb2:	e9 5e 01 00 00       	jmp    801e15 <walk_path+0x267>
+		memmove(name, p, path - p);
+  801cb7:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801cbe:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  801cc2:	48 89 c2             	mov    %rax,%rdx
+  801cc5:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801cc9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801cd0:	48 89 ce             	mov    %rcx,%rsi
+  801cd3:	48 89 c7             	mov    %rax,%rdi
+  801cd6:	49 89 df             	mov    %rbx,%r15
+  801cd9:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  801ce0:	ff ff ff 
+  801ce3:	48 01 d8             	add    %rbx,%rax
+  801ce6:	ff d0                	call   *%rax
+		name[path - p] = '\0';
+  801ce8:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801cef:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  801cf3:	c6 84 05 50 ff ff ff 	movb   $0x0,-0xb0(%rbp,%rax,1)
+  801cfa:	00 
+		path = skip_slash(path);
+  801cfb:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801d02:	48 89 c7             	mov    %rax,%rdi
+  801d05:	48 b8 fe ca fe ff ff 	movabs $0xfffffffffffecafe,%rax
+  801d0c:	ff ff ff 
+  801d0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d13:	ff d0                	call   *%rax
+  801d15:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+		if (dir->f_type != FTYPE_DIR)
+  801d1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d20:	8b 80 84 00 00 00    	mov    0x84(%rax),%eax
+  801d26:	83 f8 01             	cmp    $0x1,%eax
+  801d29:	74 0a                	je     801d35 <walk_path+0x187>
+			return -E_NOT_FOUND;
+  801d2b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801d30:	e9 e0 00 00 00       	jmp    801e15 <walk_path+0x267>
+
+		if ((r = dir_lookup(dir, name, &f)) < 0) {
+  801d35:	48 8d 95 48 ff ff ff 	lea    -0xb8(%rbp),%rdx
+  801d3c:	48 8d 8d 50 ff ff ff 	lea    -0xb0(%rbp),%rcx
+  801d43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d47:	48 89 ce             	mov    %rcx,%rsi
+  801d4a:	48 89 c7             	mov    %rax,%rdi
+  801d4d:	48 b8 df c7 fe ff ff 	movabs $0xfffffffffffec7df,%rax
+  801d54:	ff ff ff 
+  801d57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d5b:	ff d0                	call   *%rax
+  801d5d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801d60:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801d64:	79 6f                	jns    801dd5 <walk_path+0x227>
+			if (r == -E_NOT_FOUND && *path == '\0') {
+  801d66:	83 7d dc f4          	cmpl   $0xfffffff4,-0x24(%rbp)
+  801d6a:	75 64                	jne    801dd0 <walk_path+0x222>
+  801d6c:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801d73:	0f b6 00             	movzbl (%rax),%eax
+  801d76:	84 c0                	test   %al,%al
+  801d78:	75 56                	jne    801dd0 <walk_path+0x222>
+				if (pdir)
+  801d7a:	48 83 bd 30 ff ff ff 	cmpq   $0x0,-0xd0(%rbp)
+  801d81:	00 
+  801d82:	74 0e                	je     801d92 <walk_path+0x1e4>
+					*pdir = dir;
+  801d84:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+  801d8b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d8f:	48 89 10             	mov    %rdx,(%rax)
+				if (lastelem)
+  801d92:	48 83 bd 20 ff ff ff 	cmpq   $0x0,-0xe0(%rbp)
+  801d99:	00 
+  801d9a:	74 26                	je     801dc2 <walk_path+0x214>
+					strcpy(lastelem, name);
+  801d9c:	48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+  801da3:	48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+  801daa:	48 89 d6             	mov    %rdx,%rsi
+  801dad:	48 89 c7             	mov    %rax,%rdi
+  801db0:	49 89 df             	mov    %rbx,%r15
+  801db3:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  801dba:	ff ff ff 
+  801dbd:	48 01 d8             	add    %rbx,%rax
+  801dc0:	ff d0                	call   *%rax
+				*pf = 0;
+  801dc2:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801dc9:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+			}
+			return r;
+  801dd0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dd3:	eb 40                	jmp    801e15 <walk_path+0x267>
+	while (*path != '\0') {
+  801dd5:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  801ddc:	0f b6 00             	movzbl (%rax),%eax
+  801ddf:	84 c0                	test   %al,%al
+  801de1:	0f 85 79 fe ff ff    	jne    801c60 <walk_path+0xb2>
+		}
+	}
+
+	if (pdir)
+  801de7:	48 83 bd 30 ff ff ff 	cmpq   $0x0,-0xd0(%rbp)
+  801dee:	00 
+  801def:	74 0e                	je     801dff <walk_path+0x251>
+		*pdir = dir;
+  801df1:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+  801df8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801dfc:	48 89 10             	mov    %rdx,(%rax)
+	*pf = f;
+  801dff:	48 8b 95 48 ff ff ff 	mov    -0xb8(%rbp),%rdx
+  801e06:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801e0d:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  801e10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e15:	48 81 c4 d0 00 00 00 	add    $0xd0,%rsp
+  801e1c:	5b                   	pop    %rbx
+  801e1d:	41 5f                	pop    %r15
+  801e1f:	5d                   	pop    %rbp
+  801e20:	c3                   	ret
+
+0000000000801e21 <file_create>:
+
+// Create "path".  On success set *pf to point at the file and return 0.
+// On error return < 0.
+int
+file_create(const char *path, struct File **pf)
+{
+  801e21:	55                   	push   %rbp
+  801e22:	48 89 e5             	mov    %rsp,%rbp
+  801e25:	41 57                	push   %r15
+  801e27:	53                   	push   %rbx
+  801e28:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  801e2f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801e2f <file_create+0xe>
+  801e36:	49 bb 49 32 01 00 00 	movabs $0x13249,%r11
+  801e3d:	00 00 00 
+  801e40:	4c 01 db             	add    %r11,%rbx
+  801e43:	48 89 bd 48 ff ff ff 	mov    %rdi,-0xb8(%rbp)
+  801e4a:	48 89 b5 40 ff ff ff 	mov    %rsi,-0xc0(%rbp)
+	char name[MAXNAMELEN];
+	int r;
+	struct File *dir, *f;
+
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+  801e51:	48 8d 8d 60 ff ff ff 	lea    -0xa0(%rbp),%rcx
+  801e58:	48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+  801e5f:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801e66:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801e6d:	48 89 c7             	mov    %rax,%rdi
+  801e70:	48 b8 36 cb fe ff ff 	movabs $0xfffffffffffecb36,%rax
+  801e77:	ff ff ff 
+  801e7a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e7e:	ff d0                	call   *%rax
+  801e80:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e83:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801e87:	75 0a                	jne    801e93 <file_create+0x72>
+		return -E_FILE_EXISTS;
+  801e89:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+  801e8e:	e9 a5 00 00 00       	jmp    801f38 <file_create+0x117>
+	if (r != -E_NOT_FOUND || dir == 0)
+  801e93:	83 7d ec f4          	cmpl   $0xfffffff4,-0x14(%rbp)
+  801e97:	75 0c                	jne    801ea5 <file_create+0x84>
+  801e99:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  801ea0:	48 85 c0             	test   %rax,%rax
+  801ea3:	75 08                	jne    801ead <file_create+0x8c>
+		return r;
+  801ea5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ea8:	e9 8b 00 00 00       	jmp    801f38 <file_create+0x117>
+	if ((r = dir_alloc_file(dir, &f)) < 0)
+  801ead:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  801eb4:	48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+  801ebb:	48 89 d6             	mov    %rdx,%rsi
+  801ebe:	48 89 c7             	mov    %rax,%rdi
+  801ec1:	48 b8 51 c9 fe ff ff 	movabs $0xfffffffffffec951,%rax
+  801ec8:	ff ff ff 
+  801ecb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ecf:	ff d0                	call   *%rax
+  801ed1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ed4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801ed8:	79 05                	jns    801edf <file_create+0xbe>
+		return r;
+  801eda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801edd:	eb 59                	jmp    801f38 <file_create+0x117>
+	strcpy(f->f_name, name);
+  801edf:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  801ee6:	48 89 c2             	mov    %rax,%rdx
+  801ee9:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  801ef0:	48 89 c6             	mov    %rax,%rsi
+  801ef3:	48 89 d7             	mov    %rdx,%rdi
+  801ef6:	49 89 df             	mov    %rbx,%r15
+  801ef9:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  801f00:	ff ff ff 
+  801f03:	48 01 d8             	add    %rbx,%rax
+  801f06:	ff d0                	call   *%rax
+	*pf = f;
+  801f08:	48 8b 95 50 ff ff ff 	mov    -0xb0(%rbp),%rdx
+  801f0f:	48 8b 85 40 ff ff ff 	mov    -0xc0(%rbp),%rax
+  801f16:	48 89 10             	mov    %rdx,(%rax)
+	file_flush(dir);
+  801f19:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  801f20:	48 89 c7             	mov    %rax,%rdi
+  801f23:	48 b8 64 d5 fe ff ff 	movabs $0xfffffffffffed564,%rax
+  801f2a:	ff ff ff 
+  801f2d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f31:	ff d0                	call   *%rax
+	return 0;
+  801f33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f38:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  801f3f:	5b                   	pop    %rbx
+  801f40:	41 5f                	pop    %r15
+  801f42:	5d                   	pop    %rbp
+  801f43:	c3                   	ret
+
+0000000000801f44 <file_open>:
+
+// Open "path".  On success set *pf to point at the file and return 0.
+// On error return < 0.
+int
+file_open(const char *path, struct File **pf)
+{
+  801f44:	55                   	push   %rbp
+  801f45:	48 89 e5             	mov    %rsp,%rbp
+  801f48:	48 83 ec 10          	sub    $0x10,%rsp
+  801f4c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f4c <file_open+0x8>
+  801f53:	49 bb 2c 31 01 00 00 	movabs $0x1312c,%r11
+  801f5a:	00 00 00 
+  801f5d:	4c 01 d8             	add    %r11,%rax
+  801f60:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f64:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return walk_path(path, 0, pf, 0);
+  801f68:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f6c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801f70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f75:	be 00 00 00 00       	mov    $0x0,%esi
+  801f7a:	49 b8 36 cb fe ff ff 	movabs $0xfffffffffffecb36,%r8
+  801f81:	ff ff ff 
+  801f84:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801f88:	ff d0                	call   *%rax
+}
+  801f8a:	c9                   	leave
+  801f8b:	c3                   	ret
+
+0000000000801f8c <file_read>:
+// Read count bytes from f into buf, starting from seek position
+// offset.  This meant to mimic the standard pread function.
+// Returns the number of bytes read, < 0 on error.
+ssize_t
+file_read(struct File *f, void *buf, size_t count, off_t offset)
+{
+  801f8c:	55                   	push   %rbp
+  801f8d:	48 89 e5             	mov    %rsp,%rbp
+  801f90:	41 57                	push   %r15
+  801f92:	53                   	push   %rbx
+  801f93:	48 83 ec 60          	sub    $0x60,%rsp
+  801f97:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801f97 <file_read+0xb>
+  801f9e:	49 bb e1 30 01 00 00 	movabs $0x130e1,%r11
+  801fa5:	00 00 00 
+  801fa8:	4c 01 db             	add    %r11,%rbx
+  801fab:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801faf:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801fb3:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801fb7:	89 4d 94             	mov    %ecx,-0x6c(%rbp)
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	if (offset >= f->f_size)
+  801fba:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801fbe:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801fc4:	39 45 94             	cmp    %eax,-0x6c(%rbp)
+  801fc7:	7c 0a                	jl     801fd3 <file_read+0x47>
+		return 0;
+  801fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fce:	e9 36 01 00 00       	jmp    802109 <file_read+0x17d>
+
+	count = MIN(count, f->f_size - offset);
+  801fd3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801fd7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801fdb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801fdf:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  801fe5:	2b 45 94             	sub    -0x6c(%rbp),%eax
+  801fe8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801feb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801fee:	48 63 d0             	movslq %eax,%rdx
+  801ff1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ff5:	48 39 c2             	cmp    %rax,%rdx
+  801ff8:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801ffc:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+
+	for (pos = offset; pos < offset + count; ) {
+  802000:	8b 45 94             	mov    -0x6c(%rbp),%eax
+  802003:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802006:	e9 de 00 00 00       	jmp    8020e9 <file_read+0x15d>
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  80200b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80200e:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  802014:	85 c0                	test   %eax,%eax
+  802016:	0f 48 c2             	cmovs  %edx,%eax
+  802019:	c1 f8 0c             	sar    $0xc,%eax
+  80201c:	89 c1                	mov    %eax,%ecx
+  80201e:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  802022:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802026:	89 ce                	mov    %ecx,%esi
+  802028:	48 89 c7             	mov    %rax,%rdi
+  80202b:	48 b8 21 c7 fe ff ff 	movabs $0xfffffffffffec721,%rax
+  802032:	ff ff ff 
+  802035:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802039:	ff d0                	call   *%rax
+  80203b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80203e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  802042:	79 08                	jns    80204c <file_read+0xc0>
+			return r;
+  802044:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802047:	e9 bd 00 00 00       	jmp    802109 <file_read+0x17d>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  80204c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80204f:	89 d0                	mov    %edx,%eax
+  802051:	c1 f8 1f             	sar    $0x1f,%eax
+  802054:	c1 e8 14             	shr    $0x14,%eax
+  802057:	01 c2                	add    %eax,%edx
+  802059:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80205f:	29 c2                	sub    %eax,%edx
+  802061:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802066:	29 d0                	sub    %edx,%eax
+  802068:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80206b:	8b 45 94             	mov    -0x6c(%rbp),%eax
+  80206e:	48 63 d0             	movslq %eax,%rdx
+  802071:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802075:	48 01 c2             	add    %rax,%rdx
+  802078:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80207b:	48 98                	cltq
+  80207d:	48 29 c2             	sub    %rax,%rdx
+  802080:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802084:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802087:	48 63 d0             	movslq %eax,%rdx
+  80208a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80208e:	48 39 c2             	cmp    %rax,%rdx
+  802091:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802095:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+		memmove(buf, blk + pos % BLKSIZE, bn);
+  802098:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80209b:	48 63 c8             	movslq %eax,%rcx
+  80209e:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8020a2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8020a5:	89 d0                	mov    %edx,%eax
+  8020a7:	c1 f8 1f             	sar    $0x1f,%eax
+  8020aa:	c1 e8 14             	shr    $0x14,%eax
+  8020ad:	01 c2                	add    %eax,%edx
+  8020af:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8020b5:	29 c2                	sub    %eax,%edx
+  8020b7:	89 d0                	mov    %edx,%eax
+  8020b9:	48 98                	cltq
+  8020bb:	48 01 c6             	add    %rax,%rsi
+  8020be:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8020c2:	48 89 ca             	mov    %rcx,%rdx
+  8020c5:	48 89 c7             	mov    %rax,%rdi
+  8020c8:	49 89 df             	mov    %rbx,%r15
+  8020cb:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  8020d2:	ff ff ff 
+  8020d5:	48 01 d8             	add    %rbx,%rax
+  8020d8:	ff d0                	call   *%rax
+		pos += bn;
+  8020da:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8020dd:	01 45 ec             	add    %eax,-0x14(%rbp)
+		buf += bn;
+  8020e0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8020e3:	48 98                	cltq
+  8020e5:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+	for (pos = offset; pos < offset + count; ) {
+  8020e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020ec:	48 63 d0             	movslq %eax,%rdx
+  8020ef:	8b 45 94             	mov    -0x6c(%rbp),%eax
+  8020f2:	48 63 c8             	movslq %eax,%rcx
+  8020f5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8020f9:	48 01 c8             	add    %rcx,%rax
+  8020fc:	48 39 c2             	cmp    %rax,%rdx
+  8020ff:	0f 82 06 ff ff ff    	jb     80200b <file_read+0x7f>
+	}
+
+	return count;
+  802105:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  802109:	48 83 c4 60          	add    $0x60,%rsp
+  80210d:	5b                   	pop    %rbx
+  80210e:	41 5f                	pop    %r15
+  802110:	5d                   	pop    %rbp
+  802111:	c3                   	ret
+
+0000000000802112 <file_write>:
+// offset.  This is meant to mimic the standard pwrite function.
+// Extends the file if necessary.
+// Returns the number of bytes written, < 0 on error.
+int
+file_write(struct File *f, const void *buf, size_t count, off_t offset)
+{
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	41 57                	push   %r15
+  802118:	53                   	push   %rbx
+  802119:	48 83 ec 50          	sub    $0x50,%rsp
+  80211d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80211d <file_write+0xb>
+  802124:	49 bb 5b 2f 01 00 00 	movabs $0x12f5b,%r11
+  80212b:	00 00 00 
+  80212e:	4c 01 db             	add    %r11,%rbx
+  802131:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802135:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  802139:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80213d:	89 4d a4             	mov    %ecx,-0x5c(%rbp)
+	int r, bn;
+	off_t pos;
+	char *blk;
+
+	// Extend file if necessary
+	if (offset + count > f->f_size)
+  802140:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  802143:	48 63 d0             	movslq %eax,%rdx
+  802146:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80214a:	48 01 c2             	add    %rax,%rdx
+  80214d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802151:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  802157:	48 98                	cltq
+  802159:	48 39 d0             	cmp    %rdx,%rax
+  80215c:	73 37                	jae    802195 <file_write+0x83>
+		if ((r = file_set_size(f, offset + count)) < 0)
+  80215e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802162:	89 c2                	mov    %eax,%edx
+  802164:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  802167:	01 d0                	add    %edx,%eax
+  802169:	89 c2                	mov    %eax,%edx
+  80216b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80216f:	89 d6                	mov    %edx,%esi
+  802171:	48 89 c7             	mov    %rax,%rdi
+  802174:	48 b8 c9 d3 fe ff ff 	movabs $0xfffffffffffed3c9,%rax
+  80217b:	ff ff ff 
+  80217e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802182:	ff d0                	call   *%rax
+  802184:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  802187:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80218b:	79 08                	jns    802195 <file_write+0x83>
+			return r;
+  80218d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802190:	e9 0a 01 00 00       	jmp    80229f <file_write+0x18d>
+
+	for (pos = offset; pos < offset + count; ) {
+  802195:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  802198:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80219b:	e9 df 00 00 00       	jmp    80227f <file_write+0x16d>
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  8021a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021a3:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8021a9:	85 c0                	test   %eax,%eax
+  8021ab:	0f 48 c2             	cmovs  %edx,%eax
+  8021ae:	c1 f8 0c             	sar    $0xc,%eax
+  8021b1:	89 c1                	mov    %eax,%ecx
+  8021b3:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8021b7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8021bb:	89 ce                	mov    %ecx,%esi
+  8021bd:	48 89 c7             	mov    %rax,%rdi
+  8021c0:	48 b8 21 c7 fe ff ff 	movabs $0xfffffffffffec721,%rax
+  8021c7:	ff ff ff 
+  8021ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8021ce:	ff d0                	call   *%rax
+  8021d0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8021d3:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8021d7:	79 08                	jns    8021e1 <file_write+0xcf>
+			return r;
+  8021d9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8021dc:	e9 be 00 00 00       	jmp    80229f <file_write+0x18d>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  8021e1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8021e4:	89 d0                	mov    %edx,%eax
+  8021e6:	c1 f8 1f             	sar    $0x1f,%eax
+  8021e9:	c1 e8 14             	shr    $0x14,%eax
+  8021ec:	01 c2                	add    %eax,%edx
+  8021ee:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8021f4:	29 c2                	sub    %eax,%edx
+  8021f6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8021fb:	29 d0                	sub    %edx,%eax
+  8021fd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802200:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  802203:	48 63 d0             	movslq %eax,%rdx
+  802206:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80220a:	48 01 c2             	add    %rax,%rdx
+  80220d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802210:	48 98                	cltq
+  802212:	48 29 c2             	sub    %rax,%rdx
+  802215:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802219:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80221c:	48 63 d0             	movslq %eax,%rdx
+  80221f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802223:	48 39 c2             	cmp    %rax,%rdx
+  802226:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80222a:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		memmove(blk + pos % BLKSIZE, buf, bn);
+  80222d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802230:	48 63 c8             	movslq %eax,%rcx
+  802233:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  802237:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80223a:	89 d0                	mov    %edx,%eax
+  80223c:	c1 f8 1f             	sar    $0x1f,%eax
+  80223f:	c1 e8 14             	shr    $0x14,%eax
+  802242:	01 c2                	add    %eax,%edx
+  802244:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80224a:	29 c2                	sub    %eax,%edx
+  80224c:	89 d0                	mov    %edx,%eax
+  80224e:	48 98                	cltq
+  802250:	48 8d 3c 06          	lea    (%rsi,%rax,1),%rdi
+  802254:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802258:	48 89 ca             	mov    %rcx,%rdx
+  80225b:	48 89 c6             	mov    %rax,%rsi
+  80225e:	49 89 df             	mov    %rbx,%r15
+  802261:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  802268:	ff ff ff 
+  80226b:	48 01 d8             	add    %rbx,%rax
+  80226e:	ff d0                	call   *%rax
+		pos += bn;
+  802270:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802273:	01 45 ec             	add    %eax,-0x14(%rbp)
+		buf += bn;
+  802276:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802279:	48 98                	cltq
+  80227b:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+	for (pos = offset; pos < offset + count; ) {
+  80227f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802282:	48 63 d0             	movslq %eax,%rdx
+  802285:	8b 45 a4             	mov    -0x5c(%rbp),%eax
+  802288:	48 63 c8             	movslq %eax,%rcx
+  80228b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80228f:	48 01 c8             	add    %rcx,%rax
+  802292:	48 39 c2             	cmp    %rax,%rdx
+  802295:	0f 82 05 ff ff ff    	jb     8021a0 <file_write+0x8e>
+	}
+
+	return count;
+  80229b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+}
+  80229f:	48 83 c4 50          	add    $0x50,%rsp
+  8022a3:	5b                   	pop    %rbx
+  8022a4:	41 5f                	pop    %r15
+  8022a6:	5d                   	pop    %rbp
+  8022a7:	c3                   	ret
+
+00000000008022a8 <file_free_block>:
+
+// Remove a block from file f.  If it's not there, just silently succeed.
+// Returns 0 on success, < 0 on error.
+static int
+file_free_block(struct File *f, uint32_t filebno)
+{
+  8022a8:	55                   	push   %rbp
+  8022a9:	48 89 e5             	mov    %rsp,%rbp
+  8022ac:	53                   	push   %rbx
+  8022ad:	48 83 ec 28          	sub    $0x28,%rsp
+  8022b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8022b1 <file_free_block+0x9>
+  8022b8:	49 bb c7 2d 01 00 00 	movabs $0x12dc7,%r11
+  8022bf:	00 00 00 
+  8022c2:	4c 01 db             	add    %r11,%rbx
+  8022c5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022c9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	uint32_t *ptr;
+
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+  8022cc:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8022d0:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8022d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022dc:	48 89 c7             	mov    %rax,%rdi
+  8022df:	48 b8 dd c5 fe ff ff 	movabs $0xfffffffffffec5dd,%rax
+  8022e6:	ff ff ff 
+  8022e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8022ed:	ff d0                	call   *%rax
+  8022ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8022f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8022f6:	79 05                	jns    8022fd <file_free_block+0x55>
+		return r;
+  8022f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022fb:	eb 31                	jmp    80232e <file_free_block+0x86>
+	if (*ptr) {
+  8022fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802301:	8b 00                	mov    (%rax),%eax
+  802303:	85 c0                	test   %eax,%eax
+  802305:	74 22                	je     802329 <file_free_block+0x81>
+		free_block(*ptr);
+  802307:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80230b:	8b 00                	mov    (%rax),%eax
+  80230d:	89 c7                	mov    %eax,%edi
+  80230f:	48 b8 3d c1 fe ff ff 	movabs $0xfffffffffffec13d,%rax
+  802316:	ff ff ff 
+  802319:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80231d:	ff d0                	call   *%rax
+		*ptr = 0;
+  80231f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802323:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	}
+	return 0;
+  802329:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80232e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802332:	c9                   	leave
+  802333:	c3                   	ret
+
+0000000000802334 <file_truncate_blocks>:
+// (Remember to clear the f->f_indirect pointer so you'll know
+// whether it's valid!)
+// Do not change f->f_size.
+static void
+file_truncate_blocks(struct File *f, off_t newsize)
+{
+  802334:	55                   	push   %rbp
+  802335:	48 89 e5             	mov    %rsp,%rbp
+  802338:	41 57                	push   %r15
+  80233a:	53                   	push   %rbx
+  80233b:	48 83 ec 20          	sub    $0x20,%rsp
+  80233f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80233f <file_truncate_blocks+0xb>
+  802346:	49 bb 39 2d 01 00 00 	movabs $0x12d39,%r11
+  80234d:	00 00 00 
+  802350:	4c 01 db             	add    %r11,%rbx
+  802353:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802357:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	uint32_t bno, old_nblocks, new_nblocks;
+
+	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  80235a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80235e:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  802364:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802369:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	0f 48 c2             	cmovs  %edx,%eax
+  802374:	c1 f8 0c             	sar    $0xc,%eax
+  802377:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  80237a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80237d:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802382:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  802388:	85 c0                	test   %eax,%eax
+  80238a:	0f 48 c2             	cmovs  %edx,%eax
+  80238d:	c1 f8 0c             	sar    $0xc,%eax
+  802390:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  802393:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802396:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802399:	eb 56                	jmp    8023f1 <file_truncate_blocks+0xbd>
+		if ((r = file_free_block(f, bno)) < 0)
+  80239b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80239e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023a2:	89 d6                	mov    %edx,%esi
+  8023a4:	48 89 c7             	mov    %rax,%rdi
+  8023a7:	48 b8 30 d2 fe ff ff 	movabs $0xfffffffffffed230,%rax
+  8023ae:	ff ff ff 
+  8023b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8023b5:	ff d0                	call   *%rax
+  8023b7:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8023ba:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8023be:	79 2d                	jns    8023ed <file_truncate_blocks+0xb9>
+			cprintf("warning: file_free_block: %e", r);
+  8023c0:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8023c3:	89 c6                	mov    %eax,%esi
+  8023c5:	48 b8 80 53 ff ff ff 	movabs $0xffffffffffff5380,%rax
+  8023cc:	ff ff ff 
+  8023cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8023d3:	48 89 c7             	mov    %rax,%rdi
+  8023d6:	49 89 df             	mov    %rbx,%r15
+  8023d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023de:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  8023e5:	ff ff ff 
+  8023e8:	48 01 da             	add    %rbx,%rdx
+  8023eb:	ff d2                	call   *%rdx
+	for (bno = new_nblocks; bno < old_nblocks; bno++)
+  8023ed:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8023f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023f4:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+  8023f7:	72 a2                	jb     80239b <file_truncate_blocks+0x67>
+
+	if (new_nblocks <= NDIRECT && f->f_indirect) {
+  8023f9:	83 7d e4 0a          	cmpl   $0xa,-0x1c(%rbp)
+  8023fd:	77 38                	ja     802437 <file_truncate_blocks+0x103>
+  8023ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802403:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  802409:	85 c0                	test   %eax,%eax
+  80240b:	74 2a                	je     802437 <file_truncate_blocks+0x103>
+		free_block(f->f_indirect);
+  80240d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802411:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  802417:	89 c7                	mov    %eax,%edi
+  802419:	48 b8 3d c1 fe ff ff 	movabs $0xfffffffffffec13d,%rax
+  802420:	ff ff ff 
+  802423:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802427:	ff d0                	call   *%rax
+		f->f_indirect = 0;
+  802429:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80242d:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%rax)
+  802434:	00 00 00 
+	}
+}
+  802437:	90                   	nop
+  802438:	48 83 c4 20          	add    $0x20,%rsp
+  80243c:	5b                   	pop    %rbx
+  80243d:	41 5f                	pop    %r15
+  80243f:	5d                   	pop    %rbp
+  802440:	c3                   	ret
+
+0000000000802441 <file_set_size>:
+
+// Set the size of file f, truncating or extending as necessary.
+int
+file_set_size(struct File *f, off_t newsize)
+{
+  802441:	55                   	push   %rbp
+  802442:	48 89 e5             	mov    %rsp,%rbp
+  802445:	41 57                	push   %r15
+  802447:	53                   	push   %rbx
+  802448:	48 83 ec 10          	sub    $0x10,%rsp
+  80244c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80244c <file_set_size+0xb>
+  802453:	49 bb 2c 2c 01 00 00 	movabs $0x12c2c,%r11
+  80245a:	00 00 00 
+  80245d:	4c 01 db             	add    %r11,%rbx
+  802460:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802464:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	if (f->f_size > newsize)
+  802467:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80246b:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  802471:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+  802474:	7d 1c                	jge    802492 <file_set_size+0x51>
+		file_truncate_blocks(f, newsize);
+  802476:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802479:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80247d:	89 d6                	mov    %edx,%esi
+  80247f:	48 89 c7             	mov    %rax,%rdi
+  802482:	48 b8 bc d2 fe ff ff 	movabs $0xfffffffffffed2bc,%rax
+  802489:	ff ff ff 
+  80248c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802490:	ff d0                	call   *%rax
+	f->f_size = newsize;
+  802492:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802496:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802499:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	flush_block(f);
+  80249f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024a3:	48 89 c7             	mov    %rax,%rdi
+  8024a6:	49 89 df             	mov    %rbx,%r15
+  8024a9:	48 b8 3c ba fe ff ff 	movabs $0xfffffffffffeba3c,%rax
+  8024b0:	ff ff ff 
+  8024b3:	48 01 d8             	add    %rbx,%rax
+  8024b6:	ff d0                	call   *%rax
+	return 0;
+  8024b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024bd:	48 83 c4 10          	add    $0x10,%rsp
+  8024c1:	5b                   	pop    %rbx
+  8024c2:	41 5f                	pop    %r15
+  8024c4:	5d                   	pop    %rbp
+  8024c5:	c3                   	ret
+
+00000000008024c6 <print_file_struct>:
+
+void
+print_file_struct(struct File *f){
+  8024c6:	55                   	push   %rbp
+  8024c7:	48 89 e5             	mov    %rsp,%rbp
+  8024ca:	41 57                	push   %r15
+  8024cc:	53                   	push   %rbx
+  8024cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8024d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8024d1 <print_file_struct+0xb>
+  8024d8:	49 bb a7 2b 01 00 00 	movabs $0x12ba7,%r11
+  8024df:	00 00 00 
+  8024e2:	4c 01 db             	add    %r11,%rbx
+  8024e5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	cprintf("printing file at %x:\n",f);
+  8024e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024ed:	48 89 c6             	mov    %rax,%rsi
+  8024f0:	48 b8 9d 53 ff ff ff 	movabs $0xffffffffffff539d,%rax
+  8024f7:	ff ff ff 
+  8024fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8024fe:	48 89 c7             	mov    %rax,%rdi
+  802501:	49 89 df             	mov    %rbx,%r15
+  802504:	b8 00 00 00 00       	mov    $0x0,%eax
+  802509:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  802510:	ff ff ff 
+  802513:	48 01 da             	add    %rbx,%rdx
+  802516:	ff d2                	call   *%rdx
+	cprintf("f_size: %x\n",f->f_size);
+  802518:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80251c:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  802522:	89 c6                	mov    %eax,%esi
+  802524:	48 b8 b3 53 ff ff ff 	movabs $0xffffffffffff53b3,%rax
+  80252b:	ff ff ff 
+  80252e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802532:	48 89 c7             	mov    %rax,%rdi
+  802535:	49 89 df             	mov    %rbx,%r15
+  802538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80253d:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  802544:	ff ff ff 
+  802547:	48 01 da             	add    %rbx,%rdx
+  80254a:	ff d2                	call   *%rdx
+	int i = 0;
+  80254c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	for (;i < NDIRECT; i++){
+  802553:	eb 43                	jmp    802598 <print_file_struct+0xd2>
+		cprintf("f_direct[%d] : %x\n",i,f->f_direct[i]);
+  802555:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802559:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80255c:	48 63 d2             	movslq %edx,%rdx
+  80255f:	48 83 c2 20          	add    $0x20,%rdx
+  802563:	8b 54 90 08          	mov    0x8(%rax,%rdx,4),%edx
+  802567:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80256a:	89 c6                	mov    %eax,%esi
+  80256c:	48 b8 bf 53 ff ff ff 	movabs $0xffffffffffff53bf,%rax
+  802573:	ff ff ff 
+  802576:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80257a:	48 89 c7             	mov    %rax,%rdi
+  80257d:	49 89 df             	mov    %rbx,%r15
+  802580:	b8 00 00 00 00       	mov    $0x0,%eax
+  802585:	48 b9 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rcx
+  80258c:	ff ff ff 
+  80258f:	48 01 d9             	add    %rbx,%rcx
+  802592:	ff d1                	call   *%rcx
+	for (;i < NDIRECT; i++){
+  802594:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802598:	83 7d ec 09          	cmpl   $0x9,-0x14(%rbp)
+  80259c:	7e b7                	jle    802555 <print_file_struct+0x8f>
+	}
+	cprintf("f_indirect: %x\n", f->f_indirect);
+  80259e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025a2:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  8025a8:	89 c6                	mov    %eax,%esi
+  8025aa:	48 b8 d2 53 ff ff ff 	movabs $0xffffffffffff53d2,%rax
+  8025b1:	ff ff ff 
+  8025b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8025b8:	48 89 c7             	mov    %rax,%rdi
+  8025bb:	49 89 df             	mov    %rbx,%r15
+  8025be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c3:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  8025ca:	ff ff ff 
+  8025cd:	48 01 da             	add    %rbx,%rdx
+  8025d0:	ff d2                	call   *%rdx
+}
+  8025d2:	90                   	nop
+  8025d3:	48 83 c4 20          	add    $0x20,%rsp
+  8025d7:	5b                   	pop    %rbx
+  8025d8:	41 5f                	pop    %r15
+  8025da:	5d                   	pop    %rbp
+  8025db:	c3                   	ret
+
+00000000008025dc <file_flush>:
+// Loop over all the blocks in file.
+// Translate the file block number into a disk block number
+// and then check whether that disk block is dirty.  If so, write it out.
+void
+file_flush(struct File *f)
+{
+  8025dc:	55                   	push   %rbp
+  8025dd:	48 89 e5             	mov    %rsp,%rbp
+  8025e0:	41 57                	push   %r15
+  8025e2:	53                   	push   %rbx
+  8025e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8025e7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8025e7 <file_flush+0xb>
+  8025ee:	49 bb 91 2a 01 00 00 	movabs $0x12a91,%r11
+  8025f5:	00 00 00 
+  8025f8:	4c 01 db             	add    %r11,%rbx
+  8025fb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int i;
+	uint32_t *pdiskbno;
+
+	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
+  8025ff:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802606:	eb 73                	jmp    80267b <file_flush+0x9f>
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  802608:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80260b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80260f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802613:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802618:	48 89 c7             	mov    %rax,%rdi
+  80261b:	48 b8 dd c5 fe ff ff 	movabs $0xfffffffffffec5dd,%rax
+  802622:	ff ff ff 
+  802625:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802629:	ff d0                	call   *%rax
+  80262b:	85 c0                	test   %eax,%eax
+  80262d:	78 47                	js     802676 <file_flush+0x9a>
+		    pdiskbno == NULL || *pdiskbno == 0)
+  80262f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
+  802633:	48 85 c0             	test   %rax,%rax
+  802636:	74 3e                	je     802676 <file_flush+0x9a>
+		    pdiskbno == NULL || *pdiskbno == 0)
+  802638:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80263c:	8b 00                	mov    (%rax),%eax
+  80263e:	85 c0                	test   %eax,%eax
+  802640:	74 34                	je     802676 <file_flush+0x9a>
+			continue;
+		flush_block(diskaddr(*pdiskbno));
+  802642:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802646:	8b 00                	mov    (%rax),%eax
+  802648:	89 c0                	mov    %eax,%eax
+  80264a:	48 89 c7             	mov    %rax,%rdi
+  80264d:	49 89 df             	mov    %rbx,%r15
+  802650:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  802657:	ff ff ff 
+  80265a:	48 01 d8             	add    %rbx,%rax
+  80265d:	ff d0                	call   *%rax
+  80265f:	48 89 c7             	mov    %rax,%rdi
+  802662:	49 89 df             	mov    %rbx,%r15
+  802665:	48 b8 3c ba fe ff ff 	movabs $0xfffffffffffeba3c,%rax
+  80266c:	ff ff ff 
+  80266f:	48 01 d8             	add    %rbx,%rax
+  802672:	ff d0                	call   *%rax
+  802674:	eb 01                	jmp    802677 <file_flush+0x9b>
+			continue;
+  802676:	90                   	nop
+	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
+  802677:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80267b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80267f:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  802685:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80268a:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  802690:	85 c0                	test   %eax,%eax
+  802692:	0f 48 c2             	cmovs  %edx,%eax
+  802695:	c1 f8 0c             	sar    $0xc,%eax
+  802698:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80269b:	0f 8c 67 ff ff ff    	jl     802608 <file_flush+0x2c>
+	}
+	flush_block(f);
+  8026a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026a5:	48 89 c7             	mov    %rax,%rdi
+  8026a8:	49 89 df             	mov    %rbx,%r15
+  8026ab:	48 b8 3c ba fe ff ff 	movabs $0xfffffffffffeba3c,%rax
+  8026b2:	ff ff ff 
+  8026b5:	48 01 d8             	add    %rbx,%rax
+  8026b8:	ff d0                	call   *%rax
+	if (f->f_indirect){
+  8026ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026be:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  8026c4:	85 c0                	test   %eax,%eax
+  8026c6:	74 36                	je     8026fe <file_flush+0x122>
+		flush_block(diskaddr(f->f_indirect));
+  8026c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026cc:	8b 80 b0 00 00 00    	mov    0xb0(%rax),%eax
+  8026d2:	89 c0                	mov    %eax,%eax
+  8026d4:	48 89 c7             	mov    %rax,%rdi
+  8026d7:	49 89 df             	mov    %rbx,%r15
+  8026da:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  8026e1:	ff ff ff 
+  8026e4:	48 01 d8             	add    %rbx,%rax
+  8026e7:	ff d0                	call   *%rax
+  8026e9:	48 89 c7             	mov    %rax,%rdi
+  8026ec:	49 89 df             	mov    %rbx,%r15
+  8026ef:	48 b8 3c ba fe ff ff 	movabs $0xfffffffffffeba3c,%rax
+  8026f6:	ff ff ff 
+  8026f9:	48 01 d8             	add    %rbx,%rax
+  8026fc:	ff d0                	call   *%rax
+	}
+}
+  8026fe:	90                   	nop
+  8026ff:	48 83 c4 20          	add    $0x20,%rsp
+  802703:	5b                   	pop    %rbx
+  802704:	41 5f                	pop    %r15
+  802706:	5d                   	pop    %rbp
+  802707:	c3                   	ret
+
+0000000000802708 <file_remove>:
+
+// Remove a file by truncating it and then zeroing the name.
+int
+file_remove(const char *path)
+{
+  802708:	55                   	push   %rbp
+  802709:	48 89 e5             	mov    %rsp,%rbp
+  80270c:	41 57                	push   %r15
+  80270e:	53                   	push   %rbx
+  80270f:	48 83 ec 20          	sub    $0x20,%rsp
+  802713:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802713 <file_remove+0xb>
+  80271a:	49 bb 65 29 01 00 00 	movabs $0x12965,%r11
+  802721:	00 00 00 
+  802724:	4c 01 db             	add    %r11,%rbx
+  802727:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+	struct File *f;
+
+	if ((r = walk_path(path, 0, &f, 0)) < 0)
+  80272b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80272f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802733:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802738:	be 00 00 00 00       	mov    $0x0,%esi
+  80273d:	48 89 c7             	mov    %rax,%rdi
+  802740:	48 b8 36 cb fe ff ff 	movabs $0xfffffffffffecb36,%rax
+  802747:	ff ff ff 
+  80274a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80274e:	ff d0                	call   *%rax
+  802750:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802753:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802757:	79 05                	jns    80275e <file_remove+0x56>
+		return r;
+  802759:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80275c:	eb 4f                	jmp    8027ad <file_remove+0xa5>
+
+	file_truncate_blocks(f, 0);
+  80275e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802762:	be 00 00 00 00       	mov    $0x0,%esi
+  802767:	48 89 c7             	mov    %rax,%rdi
+  80276a:	48 b8 bc d2 fe ff ff 	movabs $0xfffffffffffed2bc,%rax
+  802771:	ff ff ff 
+  802774:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802778:	ff d0                	call   *%rax
+	f->f_name[0] = '\0';
+  80277a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80277e:	c6 00 00             	movb   $0x0,(%rax)
+	f->f_size = 0;
+  802781:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802785:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80278c:	00 00 00 
+	flush_block(f);
+  80278f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802793:	48 89 c7             	mov    %rax,%rdi
+  802796:	49 89 df             	mov    %rbx,%r15
+  802799:	48 b8 3c ba fe ff ff 	movabs $0xfffffffffffeba3c,%rax
+  8027a0:	ff ff ff 
+  8027a3:	48 01 d8             	add    %rbx,%rax
+  8027a6:	ff d0                	call   *%rax
+
+	return 0;
+  8027a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ad:	48 83 c4 20          	add    $0x20,%rsp
+  8027b1:	5b                   	pop    %rbx
+  8027b2:	41 5f                	pop    %r15
+  8027b4:	5d                   	pop    %rbp
+  8027b5:	c3                   	ret
+
+00000000008027b6 <fs_sync>:
+
+// Sync the entire file system.  A big hammer.
+void
+fs_sync(void)
+{
+  8027b6:	55                   	push   %rbp
+  8027b7:	48 89 e5             	mov    %rsp,%rbp
+  8027ba:	41 57                	push   %r15
+  8027bc:	53                   	push   %rbx
+  8027bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8027c1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8027c1 <fs_sync+0xb>
+  8027c8:	49 bb b7 28 01 00 00 	movabs $0x128b7,%r11
+  8027cf:	00 00 00 
+  8027d2:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 1; i < super->s_nblocks; i++)
+  8027d5:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+  8027dc:	eb 33                	jmp    802811 <fs_sync+0x5b>
+		flush_block(diskaddr(i));
+  8027de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027e1:	48 98                	cltq
+  8027e3:	48 89 c7             	mov    %rax,%rdi
+  8027e6:	49 89 df             	mov    %rbx,%r15
+  8027e9:	48 b8 33 b5 fe ff ff 	movabs $0xfffffffffffeb533,%rax
+  8027f0:	ff ff ff 
+  8027f3:	48 01 d8             	add    %rbx,%rax
+  8027f6:	ff d0                	call   *%rax
+  8027f8:	48 89 c7             	mov    %rax,%rdi
+  8027fb:	49 89 df             	mov    %rbx,%r15
+  8027fe:	48 b8 3c ba fe ff ff 	movabs $0xfffffffffffeba3c,%rax
+  802805:	ff ff ff 
+  802808:	48 01 d8             	add    %rbx,%rax
+  80280b:	ff d0                	call   *%rax
+	for (i = 1; i < super->s_nblocks; i++)
+  80280d:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802811:	48 b8 98 1f 01 00 00 	movabs $0x11f98,%rax
+  802818:	00 00 00 
+  80281b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80281f:	8b 40 04             	mov    0x4(%rax),%eax
+  802822:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802825:	39 c2                	cmp    %eax,%edx
+  802827:	72 b5                	jb     8027de <fs_sync+0x28>
+}
+  802829:	90                   	nop
+  80282a:	90                   	nop
+  80282b:	48 83 c4 10          	add    $0x10,%rsp
+  80282f:	5b                   	pop    %rbx
+  802830:	41 5f                	pop    %r15
+  802832:	5d                   	pop    %rbp
+  802833:	c3                   	ret
+
+0000000000802834 <serve_init>:
+// requests, or the up to IPC_MAXPAGES data pages of a write.
+union Fsipc *fsreq = (union Fsipc *)(DISKMAP - IPC_MAXPAGES * PGSIZE);
+
+void
+serve_init(void)
+{
+  802834:	55                   	push   %rbp
+  802835:	48 89 e5             	mov    %rsp,%rbp
+  802838:	48 83 ec 10          	sub    $0x10,%rsp
+  80283c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80283c <serve_init+0x8>
+  802843:	49 bb 3c 28 01 00 00 	movabs $0x1283c,%r11
+  80284a:	00 00 00 
+  80284d:	4c 01 d8             	add    %r11,%rax
+	int i;
+	uintptr_t va = FILEVA;
+  802850:	bf 00 00 00 d0       	mov    $0xd0000000,%edi
+  802855:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+	for (i = 0; i < MAXOPEN; i++) {
+  802859:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802860:	eb 50                	jmp    8028b2 <serve_init+0x7e>
+		opentab[i].o_fileid = i;
+  802862:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802865:	48 be a8 7f ff ff ff 	movabs $0xffffffffffff7fa8,%rsi
+  80286c:	ff ff ff 
+  80286f:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  802872:	48 63 c9             	movslq %ecx,%rcx
+  802875:	48 01 c6             	add    %rax,%rsi
+  802878:	48 c1 e1 05          	shl    $0x5,%rcx
+  80287c:	48 01 f1             	add    %rsi,%rcx
+  80287f:	89 11                	mov    %edx,(%rcx)
+		opentab[i].o_fd = (struct Fd*) va;
+  802881:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802885:	48 be a8 7f ff ff ff 	movabs $0xffffffffffff7fa8,%rsi
+  80288c:	ff ff ff 
+  80288f:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  802892:	48 63 c9             	movslq %ecx,%rcx
+  802895:	48 c1 e1 05          	shl    $0x5,%rcx
+  802899:	48 01 c1             	add    %rax,%rcx
+  80289c:	48 01 f1             	add    %rsi,%rcx
+  80289f:	48 83 c1 18          	add    $0x18,%rcx
+  8028a3:	48 89 11             	mov    %rdx,(%rcx)
+		va += PGSIZE;
+  8028a6:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8028ad:	00 
+	for (i = 0; i < MAXOPEN; i++) {
+  8028ae:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8028b2:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8028b9:	7e a7                	jle    802862 <serve_init+0x2e>
+	}
+}
+  8028bb:	90                   	nop
+  8028bc:	90                   	nop
+  8028bd:	c9                   	leave
+  8028be:	c3                   	ret
+
+00000000008028bf <openfile_alloc>:
+
+// Allocate an open file.
+int
+openfile_alloc(struct OpenFile **o)
+{
+  8028bf:	55                   	push   %rbp
+  8028c0:	48 89 e5             	mov    %rsp,%rbp
+  8028c3:	41 57                	push   %r15
+  8028c5:	53                   	push   %rbx
+  8028c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8028ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8028ca <openfile_alloc+0xb>
+  8028d1:	49 bb ae 27 01 00 00 	movabs $0x127ae,%r11
+  8028d8:	00 00 00 
+  8028db:	4c 01 db             	add    %r11,%rbx
+  8028de:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int i, r;
+
+	// Find an available open-file table entry
+	for (i = 0; i < MAXOPEN; i++) {
+  8028e2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8028e9:	e9 41 01 00 00       	jmp    802a2f <openfile_alloc+0x170>
+		switch (pageref(opentab[i].o_fd)) {
+  8028ee:	48 ba a8 7f ff ff ff 	movabs $0xffffffffffff7fa8,%rdx
+  8028f5:	ff ff ff 
+  8028f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028fb:	48 98                	cltq
+  8028fd:	48 c1 e0 05          	shl    $0x5,%rax
+  802901:	48 01 d8             	add    %rbx,%rax
+  802904:	48 01 d0             	add    %rdx,%rax
+  802907:	48 83 c0 18          	add    $0x18,%rax
+  80290b:	48 8b 00             	mov    (%rax),%rax
+  80290e:	48 89 c7             	mov    %rax,%rdi
+  802911:	49 89 df             	mov    %rbx,%r15
+  802914:	48 b8 5c 37 ff ff ff 	movabs $0xffffffffffff375c,%rax
+  80291b:	ff ff ff 
+  80291e:	48 01 d8             	add    %rbx,%rax
+  802921:	ff d0                	call   *%rax
+  802923:	85 c0                	test   %eax,%eax
+  802925:	74 0a                	je     802931 <openfile_alloc+0x72>
+  802927:	83 f8 01             	cmp    $0x1,%eax
+  80292a:	74 55                	je     802981 <openfile_alloc+0xc2>
+  80292c:	e9 fa 00 00 00       	jmp    802a2b <openfile_alloc+0x16c>
+
+		case 0:
+			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P|PTE_U|PTE_W)) < 0)
+  802931:	48 ba a8 7f ff ff ff 	movabs $0xffffffffffff7fa8,%rdx
+  802938:	ff ff ff 
+  80293b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80293e:	48 98                	cltq
+  802940:	48 c1 e0 05          	shl    $0x5,%rax
+  802944:	48 01 d8             	add    %rbx,%rax
+  802947:	48 01 d0             	add    %rdx,%rax
+  80294a:	48 83 c0 18          	add    $0x18,%rax
+  80294e:	48 8b 00             	mov    (%rax),%rax
+  802951:	ba 07 00 00 00       	mov    $0x7,%edx
+  802956:	48 89 c6             	mov    %rax,%rsi
+  802959:	bf 00 00 00 00       	mov    $0x0,%edi
+  80295e:	49 89 df             	mov    %rbx,%r15
+  802961:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  802968:	ff ff ff 
+  80296b:	48 01 d8             	add    %rbx,%rax
+  80296e:	ff d0                	call   *%rax
+  802970:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  802973:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802977:	79 08                	jns    802981 <openfile_alloc+0xc2>
+				return r;
+  802979:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80297c:	e9 c0 00 00 00       	jmp    802a41 <openfile_alloc+0x182>
+			/* fall through */
+		case 1:
+
+			opentab[i].o_fileid += MAXOPEN;
+  802981:	48 ba a8 7f ff ff ff 	movabs $0xffffffffffff7fa8,%rdx
+  802988:	ff ff ff 
+  80298b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80298e:	48 98                	cltq
+  802990:	48 01 da             	add    %rbx,%rdx
+  802993:	48 c1 e0 05          	shl    $0x5,%rax
+  802997:	48 01 d0             	add    %rdx,%rax
+  80299a:	8b 00                	mov    (%rax),%eax
+  80299c:	8d 90 00 04 00 00    	lea    0x400(%rax),%edx
+  8029a2:	48 b9 a8 7f ff ff ff 	movabs $0xffffffffffff7fa8,%rcx
+  8029a9:	ff ff ff 
+  8029ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029af:	48 98                	cltq
+  8029b1:	48 01 d9             	add    %rbx,%rcx
+  8029b4:	48 c1 e0 05          	shl    $0x5,%rax
+  8029b8:	48 01 c8             	add    %rcx,%rax
+  8029bb:	89 10                	mov    %edx,(%rax)
+			*o = &opentab[i];
+  8029bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029c0:	48 98                	cltq
+  8029c2:	48 c1 e0 05          	shl    $0x5,%rax
+  8029c6:	48 89 c2             	mov    %rax,%rdx
+  8029c9:	48 b8 a8 7f ff ff ff 	movabs $0xffffffffffff7fa8,%rax
+  8029d0:	ff ff ff 
+  8029d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029d7:	48 01 c2             	add    %rax,%rdx
+  8029da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029de:	48 89 10             	mov    %rdx,(%rax)
+			memset(opentab[i].o_fd, 0, PGSIZE);
+  8029e1:	48 ba a8 7f ff ff ff 	movabs $0xffffffffffff7fa8,%rdx
+  8029e8:	ff ff ff 
+  8029eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029ee:	48 98                	cltq
+  8029f0:	48 c1 e0 05          	shl    $0x5,%rax
+  8029f4:	48 01 d8             	add    %rbx,%rax
+  8029f7:	48 01 d0             	add    %rdx,%rax
+  8029fa:	48 83 c0 18          	add    $0x18,%rax
+  8029fe:	48 8b 00             	mov    (%rax),%rax
+  802a01:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a06:	be 00 00 00 00       	mov    $0x0,%esi
+  802a0b:	48 89 c7             	mov    %rax,%rdi
+  802a0e:	49 89 df             	mov    %rbx,%r15
+  802a11:	48 b8 31 06 ff ff ff 	movabs $0xffffffffffff0631,%rax
+  802a18:	ff ff ff 
+  802a1b:	48 01 d8             	add    %rbx,%rax
+  802a1e:	ff d0                	call   *%rax
+			return (*o)->o_fileid;
+  802a20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a24:	48 8b 00             	mov    (%rax),%rax
+  802a27:	8b 00                	mov    (%rax),%eax
+  802a29:	eb 16                	jmp    802a41 <openfile_alloc+0x182>
+	for (i = 0; i < MAXOPEN; i++) {
+  802a2b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802a2f:	81 7d ec ff 03 00 00 	cmpl   $0x3ff,-0x14(%rbp)
+  802a36:	0f 8e b2 fe ff ff    	jle    8028ee <openfile_alloc+0x2f>
+	         }
+        }
+	return -E_MAX_OPEN;
+  802a3c:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802a41:	48 83 c4 20          	add    $0x20,%rsp
+  802a45:	5b                   	pop    %rbx
+  802a46:	41 5f                	pop    %r15
+  802a48:	5d                   	pop    %rbp
+  802a49:	c3                   	ret
+
+0000000000802a4a <openfile_lookup>:
+
+// Look up an open file for envid.
+int
+openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po)
+{
+  802a4a:	55                   	push   %rbp
+  802a4b:	48 89 e5             	mov    %rsp,%rbp
+  802a4e:	41 57                	push   %r15
+  802a50:	48 83 ec 28          	sub    $0x28,%rsp
+  802a54:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a54 <openfile_lookup+0xa>
+  802a5b:	49 bb 24 26 01 00 00 	movabs $0x12624,%r11
+  802a62:	00 00 00 
+  802a65:	4c 01 d8             	add    %r11,%rax
+  802a68:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802a6b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  802a6e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+	struct OpenFile *o;
+
+	o = &opentab[fileid % MAXOPEN];
+  802a72:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802a75:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  802a7b:	89 d2                	mov    %edx,%edx
+  802a7d:	48 89 d1             	mov    %rdx,%rcx
+  802a80:	48 c1 e1 05          	shl    $0x5,%rcx
+  802a84:	48 ba a8 7f ff ff ff 	movabs $0xffffffffffff7fa8,%rdx
+  802a8b:	ff ff ff 
+  802a8e:	48 8d 14 10          	lea    (%rax,%rdx,1),%rdx
+  802a92:	48 01 ca             	add    %rcx,%rdx
+  802a95:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (pageref(o->o_fd) == 1 || o->o_fileid != fileid)
+  802a99:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a9d:	48 8b 52 18          	mov    0x18(%rdx),%rdx
+  802aa1:	48 89 d7             	mov    %rdx,%rdi
+  802aa4:	49 89 c7             	mov    %rax,%r15
+  802aa7:	48 ba 5c 37 ff ff ff 	movabs $0xffffffffffff375c,%rdx
+  802aae:	ff ff ff 
+  802ab1:	48 01 c2             	add    %rax,%rdx
+  802ab4:	ff d2                	call   *%rdx
+  802ab6:	83 f8 01             	cmp    $0x1,%eax
+  802ab9:	74 0b                	je     802ac6 <openfile_lookup+0x7c>
+  802abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802abf:	8b 00                	mov    (%rax),%eax
+  802ac1:	39 45 d8             	cmp    %eax,-0x28(%rbp)
+  802ac4:	74 07                	je     802acd <openfile_lookup+0x83>
+		return -E_INVAL;
+  802ac6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802acb:	eb 10                	jmp    802add <openfile_lookup+0x93>
+	*po = o;
+  802acd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ad1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802ad5:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802ad8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802add:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802ae1:	c9                   	leave
+  802ae2:	c3                   	ret
+
+0000000000802ae3 <serve_open>:
+// permissions to return to the calling environment in *pg_store and
+// *perm_store respectively.
+int
+serve_open(envid_t envid, struct Fsreq_open *req,
+	   void **pg_store, int *perm_store)
+{
+  802ae3:	55                   	push   %rbp
+  802ae4:	48 89 e5             	mov    %rsp,%rbp
+  802ae7:	41 57                	push   %r15
+  802ae9:	53                   	push   %rbx
+  802aea:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  802af1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802af1 <serve_open+0xe>
+  802af8:	49 bb 87 25 01 00 00 	movabs $0x12587,%r11
+  802aff:	00 00 00 
+  802b02:	4c 01 db             	add    %r11,%rbx
+  802b05:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  802b0b:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  802b12:	48 89 95 b8 fb ff ff 	mov    %rdx,-0x448(%rbp)
+  802b19:	48 89 8d b0 fb ff ff 	mov    %rcx,-0x450(%rbp)
+
+	if (debug)
+		cprintf("serve_open %08x %s 0x%x\n", envid, req->req_path, req->req_omode);
+
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, req->req_path, MAXPATHLEN);
+  802b20:	48 8b 8d c0 fb ff ff 	mov    -0x440(%rbp),%rcx
+  802b27:	48 8d 85 e0 fb ff ff 	lea    -0x420(%rbp),%rax
+  802b2e:	ba 00 04 00 00       	mov    $0x400,%edx
+  802b33:	48 89 ce             	mov    %rcx,%rsi
+  802b36:	48 89 c7             	mov    %rax,%rdi
+  802b39:	49 89 df             	mov    %rbx,%r15
+  802b3c:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  802b43:	ff ff ff 
+  802b46:	48 01 d8             	add    %rbx,%rax
+  802b49:	ff d0                	call   *%rax
+	path[MAXPATHLEN-1] = 0;
+  802b4b:	c6 45 df 00          	movb   $0x0,-0x21(%rbp)
+
+	// Find an open file ID
+	if ((r = openfile_alloc(&o)) < 0) {
+  802b4f:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  802b56:	48 89 c7             	mov    %rax,%rdi
+  802b59:	48 b8 47 d8 fe ff ff 	movabs $0xfffffffffffed847,%rax
+  802b60:	ff ff ff 
+  802b63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b67:	ff d0                	call   *%rax
+  802b69:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b6c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b70:	79 08                	jns    802b7a <serve_open+0x97>
+		if (debug)
+			cprintf("openfile_alloc failed: %e", r);
+		return r;
+  802b72:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b75:	e9 94 01 00 00       	jmp    802d0e <serve_open+0x22b>
+	}
+	fileid = r;
+  802b7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b7d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+
+	// Open the file
+	if (req->req_omode & O_CREAT) {
+  802b80:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  802b87:	8b 80 00 04 00 00    	mov    0x400(%rax),%eax
+  802b8d:	25 00 01 00 00       	and    $0x100,%eax
+  802b92:	85 c0                	test   %eax,%eax
+  802b94:	74 53                	je     802be9 <serve_open+0x106>
+		if ((r = file_create(path, &f)) < 0) {
+  802b96:	48 8d 95 d8 fb ff ff 	lea    -0x428(%rbp),%rdx
+  802b9d:	48 8d 85 e0 fb ff ff 	lea    -0x420(%rbp),%rax
+  802ba4:	48 89 d6             	mov    %rdx,%rsi
+  802ba7:	48 89 c7             	mov    %rax,%rdi
+  802baa:	49 89 df             	mov    %rbx,%r15
+  802bad:	48 b8 a9 cd fe ff ff 	movabs $0xfffffffffffecda9,%rax
+  802bb4:	ff ff ff 
+  802bb7:	48 01 d8             	add    %rbx,%rax
+  802bba:	ff d0                	call   *%rax
+  802bbc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bbf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802bc3:	79 5f                	jns    802c24 <serve_open+0x141>
+			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+  802bc5:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  802bcc:	8b 80 00 04 00 00    	mov    0x400(%rax),%eax
+  802bd2:	25 00 04 00 00       	and    $0x400,%eax
+  802bd7:	85 c0                	test   %eax,%eax
+  802bd9:	75 06                	jne    802be1 <serve_open+0xfe>
+  802bdb:	83 7d ec f2          	cmpl   $0xfffffff2,-0x14(%rbp)
+  802bdf:	74 0b                	je     802bec <serve_open+0x109>
+				goto try_open;
+			if (debug)
+				cprintf("file_create failed: %e", r);
+			return r;
+  802be1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802be4:	e9 25 01 00 00       	jmp    802d0e <serve_open+0x22b>
+		}
+	} else {
+try_open:
+  802be9:	90                   	nop
+  802bea:	eb 01                	jmp    802bed <serve_open+0x10a>
+				goto try_open;
+  802bec:	90                   	nop
+		if ((r = file_open(path, &f)) < 0) {
+  802bed:	48 8d 95 d8 fb ff ff 	lea    -0x428(%rbp),%rdx
+  802bf4:	48 8d 85 e0 fb ff ff 	lea    -0x420(%rbp),%rax
+  802bfb:	48 89 d6             	mov    %rdx,%rsi
+  802bfe:	48 89 c7             	mov    %rax,%rdi
+  802c01:	49 89 df             	mov    %rbx,%r15
+  802c04:	48 b8 cc ce fe ff ff 	movabs $0xfffffffffffececc,%rax
+  802c0b:	ff ff ff 
+  802c0e:	48 01 d8             	add    %rbx,%rax
+  802c11:	ff d0                	call   *%rax
+  802c13:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c16:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c1a:	79 08                	jns    802c24 <serve_open+0x141>
+			if (debug)
+				cprintf("file_open failed: %e", r);
+			return r;
+  802c1c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c1f:	e9 ea 00 00 00       	jmp    802d0e <serve_open+0x22b>
+		}
+	}
+
+	// Truncate
+	if (req->req_omode & O_TRUNC) {
+  802c24:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  802c2b:	8b 80 00 04 00 00    	mov    0x400(%rax),%eax
+  802c31:	25 00 02 00 00       	and    $0x200,%eax
+  802c36:	85 c0                	test   %eax,%eax
+  802c38:	74 32                	je     802c6c <serve_open+0x189>
+		if ((r = file_set_size(f, 0)) < 0) {
+  802c3a:	48 8b 85 d8 fb ff ff 	mov    -0x428(%rbp),%rax
+  802c41:	be 00 00 00 00       	mov    $0x0,%esi
+  802c46:	48 89 c7             	mov    %rax,%rdi
+  802c49:	49 89 df             	mov    %rbx,%r15
+  802c4c:	48 b8 c9 d3 fe ff ff 	movabs $0xfffffffffffed3c9,%rax
+  802c53:	ff ff ff 
+  802c56:	48 01 d8             	add    %rbx,%rax
+  802c59:	ff d0                	call   *%rax
+  802c5b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c5e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c62:	79 08                	jns    802c6c <serve_open+0x189>
+			if (debug)
+				cprintf("file_set_size failed: %e", r);
+			return r;
+  802c64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c67:	e9 a2 00 00 00       	jmp    802d0e <serve_open+0x22b>
+		}
+	}
+
+	// Save the file pointer
+	o->o_file = f;
+  802c6c:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  802c73:	48 8b 95 d8 fb ff ff 	mov    -0x428(%rbp),%rdx
+  802c7a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+
+	// Fill out the Fd structure
+	o->o_fd->fd_file.id = o->o_fileid;
+  802c7e:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  802c85:	8b 10                	mov    (%rax),%edx
+  802c87:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  802c8e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802c92:	89 50 0c             	mov    %edx,0xc(%rax)
+	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  802c95:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  802c9c:	8b 90 00 04 00 00    	mov    0x400(%rax),%edx
+  802ca2:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  802ca9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802cad:	83 e2 03             	and    $0x3,%edx
+  802cb0:	89 50 08             	mov    %edx,0x8(%rax)
+	o->o_fd->fd_dev_id = devfile.dev_id;
+  802cb3:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  802cba:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802cbe:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802cc5:	ff ff ff 
+  802cc8:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  802ccc:	8b 12                	mov    (%rdx),%edx
+  802cce:	89 10                	mov    %edx,(%rax)
+	o->o_mode = req->req_omode;
+  802cd0:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  802cd7:	48 8b 95 c0 fb ff ff 	mov    -0x440(%rbp),%rdx
+  802cde:	8b 92 00 04 00 00    	mov    0x400(%rdx),%edx
+  802ce4:	89 50 10             	mov    %edx,0x10(%rax)
+	if (debug)
+		cprintf("sending success, page %08x\n", (uintptr_t) o->o_fd);
+
+	// Share the FD page with the caller by setting *pg_store,
+	// store its permission in *perm_store
+	*pg_store = o->o_fd;
+  802ce7:	48 8b 85 d0 fb ff ff 	mov    -0x430(%rbp),%rax
+  802cee:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  802cf2:	48 8b 85 b8 fb ff ff 	mov    -0x448(%rbp),%rax
+  802cf9:	48 89 10             	mov    %rdx,(%rax)
+	*perm_store = PTE_P|PTE_U|PTE_W|PTE_SHARE;
+  802cfc:	48 8b 85 b0 fb ff ff 	mov    -0x450(%rbp),%rax
+  802d03:	c7 00 07 04 00 00    	movl   $0x407,(%rax)
+
+	return 0;
+  802d09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d0e:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  802d15:	5b                   	pop    %rbx
+  802d16:	41 5f                	pop    %r15
+  802d18:	5d                   	pop    %rbp
+  802d19:	c3                   	ret
+
+0000000000802d1a <serve_set_size>:
+
+// Set the size of req->req_fileid to req->req_size bytes, truncating
+// or extending the file as necessary.
+int
+serve_set_size(envid_t envid, struct Fsreq_set_size *req)
+{
+  802d1a:	55                   	push   %rbp
+  802d1b:	48 89 e5             	mov    %rsp,%rbp
+  802d1e:	41 57                	push   %r15
+  802d20:	53                   	push   %rbx
+  802d21:	48 83 ec 20          	sub    $0x20,%rsp
+  802d25:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d25 <serve_set_size+0xb>
+  802d2c:	49 bb 53 23 01 00 00 	movabs $0x12353,%r11
+  802d33:	00 00 00 
+  802d36:	4c 01 db             	add    %r11,%rbx
+  802d39:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d3c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// Every file system IPC call has the same general structure.
+	// Here's how it goes.
+
+	// First, use openfile_lookup to find the relevant open file.
+	// On failure, return the error code to the client with ipc_send.
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  802d40:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d44:	8b 00                	mov    (%rax),%eax
+  802d46:	89 c1                	mov    %eax,%ecx
+  802d48:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802d4c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d4f:	89 ce                	mov    %ecx,%esi
+  802d51:	89 c7                	mov    %eax,%edi
+  802d53:	48 b8 d2 d9 fe ff ff 	movabs $0xfffffffffffed9d2,%rax
+  802d5a:	ff ff ff 
+  802d5d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d61:	ff d0                	call   *%rax
+  802d63:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d66:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d6a:	79 05                	jns    802d71 <serve_set_size+0x57>
+		return r;
+  802d6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d6f:	eb 26                	jmp    802d97 <serve_set_size+0x7d>
+
+	// Second, call the relevant file system function (from fs/fs.c).
+	// On failure, return the error code to the client.
+	return file_set_size(o->o_file, req->req_size);
+  802d71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d75:	8b 50 04             	mov    0x4(%rax),%edx
+  802d78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d7c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802d80:	89 d6                	mov    %edx,%esi
+  802d82:	48 89 c7             	mov    %rax,%rdi
+  802d85:	49 89 df             	mov    %rbx,%r15
+  802d88:	48 b8 c9 d3 fe ff ff 	movabs $0xfffffffffffed3c9,%rax
+  802d8f:	ff ff ff 
+  802d92:	48 01 d8             	add    %rbx,%rax
+  802d95:	ff d0                	call   *%rax
+}
+  802d97:	48 83 c4 20          	add    $0x20,%rsp
+  802d9b:	5b                   	pop    %rbx
+  802d9c:	41 5f                	pop    %r15
+  802d9e:	5d                   	pop    %rbp
+  802d9f:	c3                   	ret
+
+0000000000802da0 <serve_read>:
+// replies with the blocks.  Returns the number of bytes read, or < 0
+// on error.
+int
+serve_read(envid_t envid, struct Fsreq_read *req, struct IpcSeg *segs,
+	   int *nsegs, uint64_t *off)
+{
+  802da0:	55                   	push   %rbp
+  802da1:	48 89 e5             	mov    %rsp,%rbp
+  802da4:	41 57                	push   %r15
+  802da6:	53                   	push   %rbx
+  802da7:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  802dae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dae <serve_read+0xe>
+  802db5:	49 bb ca 22 01 00 00 	movabs $0x122ca,%r11
+  802dbc:	00 00 00 
+  802dbf:	4c 01 db             	add    %r11,%rbx
+  802dc2:	89 7d 8c             	mov    %edi,-0x74(%rbp)
+  802dc5:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  802dc9:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+  802dd0:	48 89 8d 70 ff ff ff 	mov    %rcx,-0x90(%rbp)
+  802dd7:	4c 89 85 68 ff ff ff 	mov    %r8,-0x98(%rbp)
+	int r, bn;
+
+	if (debug)
+		cprintf("serve_read %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
+
+	*nsegs = 0;
+  802dde:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  802de5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  802deb:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  802def:	8b 00                	mov    (%rax),%eax
+  802df1:	89 c1                	mov    %eax,%ecx
+  802df3:	48 8d 55 98          	lea    -0x68(%rbp),%rdx
+  802df7:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  802dfa:	89 ce                	mov    %ecx,%esi
+  802dfc:	89 c7                	mov    %eax,%edi
+  802dfe:	48 b8 d2 d9 fe ff ff 	movabs $0xfffffffffffed9d2,%rax
+  802e05:	ff ff ff 
+  802e08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e0c:	ff d0                	call   *%rax
+  802e0e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  802e11:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802e15:	79 08                	jns    802e1f <serve_read+0x7f>
+		return r;
+  802e17:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802e1a:	e9 13 02 00 00       	jmp    803032 <serve_read+0x292>
+	fd = o->o_fd;
+  802e1f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802e23:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802e27:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	pos = fd->fd_offset;
+  802e2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e2f:	8b 40 04             	mov    0x4(%rax),%eax
+  802e32:	89 45 dc             	mov    %eax,-0x24(%rbp)
+	*off = pos % BLKSIZE;
+  802e35:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e38:	89 d0                	mov    %edx,%eax
+  802e3a:	c1 f8 1f             	sar    $0x1f,%eax
+  802e3d:	c1 e8 14             	shr    $0x14,%eax
+  802e40:	01 c2                	add    %eax,%edx
+  802e42:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802e48:	29 c2                	sub    %eax,%edx
+  802e4a:	89 d0                	mov    %edx,%eax
+  802e4c:	48 63 d0             	movslq %eax,%rdx
+  802e4f:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  802e56:	48 89 10             	mov    %rdx,(%rax)
+	if (pos >= o->o_file->f_size)
+  802e59:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802e5d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802e61:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  802e67:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802e6a:	7c 0a                	jl     802e76 <serve_read+0xd6>
+		return 0;
+  802e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e71:	e9 bc 01 00 00       	jmp    803032 <serve_read+0x292>
+
+	count = MIN(req->req_n, IPC_MAXPAGES * BLKSIZE - *off);
+  802e76:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  802e7a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802e7e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802e82:	48 8b 85 68 ff ff ff 	mov    -0x98(%rbp),%rax
+  802e89:	48 8b 00             	mov    (%rax),%rax
+  802e8c:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802e91:	48 29 c2             	sub    %rax,%rdx
+  802e94:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802e98:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802e9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ea0:	48 39 c2             	cmp    %rax,%rdx
+  802ea3:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802ea7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	end = MIN(o->o_file->f_size, pos + count);
+  802eab:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802eaf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802eb3:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  802eb9:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  802ebc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ebf:	48 63 d0             	movslq %eax,%rdx
+  802ec2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ec6:	48 01 d0             	add    %rdx,%rax
+  802ec9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  802ecd:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802ed0:	48 63 d0             	movslq %eax,%rdx
+  802ed3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ed7:	48 39 c2             	cmp    %rax,%rdx
+  802eda:	48 0f 46 c2          	cmovbe %rdx,%rax
+  802ede:	89 45 ac             	mov    %eax,-0x54(%rbp)
+	for (bn = pos / BLKSIZE; bn * BLKSIZE < end; bn++) {
+  802ee1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ee4:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  802eea:	85 c0                	test   %eax,%eax
+  802eec:	0f 48 c2             	cmovs  %edx,%eax
+  802eef:	c1 f8 0c             	sar    $0xc,%eax
+  802ef2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ef5:	e9 19 01 00 00       	jmp    803013 <serve_read+0x273>
+		if ((r = file_get_block(o->o_file, bn, &blk)) < 0)
+  802efa:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  802efd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802f01:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802f05:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  802f09:	89 ce                	mov    %ecx,%esi
+  802f0b:	48 89 c7             	mov    %rax,%rdi
+  802f0e:	49 89 df             	mov    %rbx,%r15
+  802f11:	48 b8 21 c7 fe ff ff 	movabs $0xfffffffffffec721,%rax
+  802f18:	ff ff ff 
+  802f1b:	48 01 d8             	add    %rbx,%rax
+  802f1e:	ff d0                	call   *%rax
+  802f20:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  802f23:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802f27:	79 08                	jns    802f31 <serve_read+0x191>
+			return r;
+  802f29:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802f2c:	e9 01 01 00 00       	jmp    803032 <serve_read+0x292>
+		// Only mapped blocks can be sent.
+		if (!va_is_mapped(blk))
+  802f31:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802f35:	48 89 c7             	mov    %rax,%rdi
+  802f38:	49 89 df             	mov    %rbx,%r15
+  802f3b:	48 b8 e2 b5 fe ff ff 	movabs $0xfffffffffffeb5e2,%rax
+  802f42:	ff ff ff 
+  802f45:	48 01 d8             	add    %rbx,%rax
+  802f48:	ff d0                	call   *%rax
+  802f4a:	83 f0 01             	xor    $0x1,%eax
+  802f4d:	84 c0                	test   %al,%al
+  802f4f:	74 07                	je     802f58 <serve_read+0x1b8>
+			(void) *(volatile char *) blk;
+  802f51:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802f55:	0f b6 00             	movzbl (%rax),%eax
+		seg = *nsegs ? &segs[*nsegs - 1] : NULL;
+  802f58:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  802f5f:	8b 00                	mov    (%rax),%eax
+  802f61:	85 c0                	test   %eax,%eax
+  802f63:	74 1f                	je     802f84 <serve_read+0x1e4>
+  802f65:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  802f6c:	8b 00                	mov    (%rax),%eax
+  802f6e:	48 98                	cltq
+  802f70:	48 c1 e0 04          	shl    $0x4,%rax
+  802f74:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  802f78:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  802f7f:	48 01 d0             	add    %rdx,%rax
+  802f82:	eb 05                	jmp    802f89 <serve_read+0x1e9>
+  802f84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f89:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+		if (seg && seg->seg_va + seg->seg_npages * BLKSIZE
+  802f8d:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802f92:	74 35                	je     802fc9 <serve_read+0x229>
+  802f94:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802f98:	48 8b 10             	mov    (%rax),%rdx
+  802f9b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802f9f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802fa3:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fa7:	48 01 c2             	add    %rax,%rdx
+		    == (uintptr_t) blk) {
+  802faa:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+		if (seg && seg->seg_va + seg->seg_npages * BLKSIZE
+  802fae:	48 39 c2             	cmp    %rax,%rdx
+  802fb1:	75 16                	jne    802fc9 <serve_read+0x229>
+			seg->seg_npages++;
+  802fb3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802fb7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802fbb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802fbf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802fc3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+			continue;
+  802fc7:	eb 46                	jmp    80300f <serve_read+0x26f>
+		}
+		seg = &segs[(*nsegs)++];
+  802fc9:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  802fd0:	8b 00                	mov    (%rax),%eax
+  802fd2:	8d 48 01             	lea    0x1(%rax),%ecx
+  802fd5:	48 8b 95 70 ff ff ff 	mov    -0x90(%rbp),%rdx
+  802fdc:	89 0a                	mov    %ecx,(%rdx)
+  802fde:	48 98                	cltq
+  802fe0:	48 c1 e0 04          	shl    $0x4,%rax
+  802fe4:	48 89 c2             	mov    %rax,%rdx
+  802fe7:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  802fee:	48 01 d0             	add    %rdx,%rax
+  802ff1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+		seg->seg_va = (uintptr_t) blk;
+  802ff5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802ff9:	48 89 c2             	mov    %rax,%rdx
+  802ffc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803000:	48 89 10             	mov    %rdx,(%rax)
+		seg->seg_npages = 1;
+  803003:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803007:	48 c7 40 08 01 00 00 	movq   $0x1,0x8(%rax)
+  80300e:	00 
+	for (bn = pos / BLKSIZE; bn * BLKSIZE < end; bn++) {
+  80300f:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803013:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803016:	c1 e0 0c             	shl    $0xc,%eax
+  803019:	39 45 ac             	cmp    %eax,-0x54(%rbp)
+  80301c:	0f 8f d8 fe ff ff    	jg     802efa <serve_read+0x15a>
+	}
+
+	fd->fd_offset = end;
+  803022:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803026:	8b 55 ac             	mov    -0x54(%rbp),%edx
+  803029:	89 50 04             	mov    %edx,0x4(%rax)
+	return end - pos;
+  80302c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80302f:	2b 45 dc             	sub    -0x24(%rbp),%eax
+}
+  803032:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+  803039:	5b                   	pop    %rbx
+  80303a:	41 5f                	pop    %r15
+  80303c:	5d                   	pop    %rbp
+  80303d:	c3                   	ret
+
+000000000080303e <serve_write>:
+// starting at the current seek position, and update the seek position
+// accordingly.  Extend the file if necessary.  Returns the number of
+// bytes written, or < 0 on error.
+int
+serve_write(envid_t envid, struct Fsreq_write *req)
+{
+  80303e:	55                   	push   %rbp
+  80303f:	48 89 e5             	mov    %rsp,%rbp
+  803042:	41 57                	push   %r15
+  803044:	53                   	push   %rbx
+  803045:	48 83 ec 40          	sub    $0x40,%rsp
+  803049:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803049 <serve_write+0xb>
+  803050:	49 bb 2f 20 01 00 00 	movabs $0x1202f,%r11
+  803057:	00 00 00 
+  80305a:	4c 01 db             	add    %r11,%rbx
+  80305d:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803060:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+	struct Fd *fd;
+	int r, bytes_to_write;
+	size_t bytes_written;
+	//the amount of bytes we need to write is in req.req_n, but no
+	//more than came in pages
+	bytes_to_write = MIN(req->req_n, thisenv->env_ipc_npages * PGSIZE);
+  803064:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803068:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80306c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  803070:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803077:	ff ff ff 
+  80307a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80307e:	48 8b 00             	mov    (%rax),%rax
+  803081:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803087:	c1 e0 0c             	shl    $0xc,%eax
+  80308a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80308d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803090:	48 63 d0             	movslq %eax,%rdx
+  803093:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803097:	48 39 c2             	cmp    %rax,%rdx
+  80309a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80309e:	89 45 e0             	mov    %eax,-0x20(%rbp)
+	// look up the file id, and store the OpenFile struct in *o.
+	r = openfile_lookup(envid,req->req_fileid,&o);
+  8030a1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8030a5:	8b 00                	mov    (%rax),%eax
+  8030a7:	89 c1                	mov    %eax,%ecx
+  8030a9:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  8030ad:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8030b0:	89 ce                	mov    %ecx,%esi
+  8030b2:	89 c7                	mov    %eax,%edi
+  8030b4:	48 b8 d2 d9 fe ff ff 	movabs $0xfffffffffffed9d2,%rax
+  8030bb:	ff ff ff 
+  8030be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030c2:	ff d0                	call   *%rax
+  8030c4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+	if (r < 0)
+  8030c7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8030cb:	79 05                	jns    8030d2 <serve_write+0x94>
+		return r;
+  8030cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030d0:	eb 66                	jmp    803138 <serve_write+0xfa>
+	//store the OpenFile's pointer to its *Fd struct for later
+	fd = o->o_fd;
+  8030d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030d6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8030da:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	//make the call to file_write.
+	bytes_written = file_write(o->o_file, fsreq, bytes_to_write, fd->fd_offset);
+  8030de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030e2:	8b 48 04             	mov    0x4(%rax),%ecx
+  8030e5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8030e8:	48 63 d0             	movslq %eax,%rdx
+  8030eb:	48 b8 a8 ff ff ff ff 	movabs $0xffffffffffffffa8,%rax
+  8030f2:	ff ff ff 
+  8030f5:	48 8b 34 03          	mov    (%rbx,%rax,1),%rsi
+  8030f9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030fd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803101:	48 89 c7             	mov    %rax,%rdi
+  803104:	49 89 df             	mov    %rbx,%r15
+  803107:	48 b8 9a d0 fe ff ff 	movabs $0xfffffffffffed09a,%rax
+  80310e:	ff ff ff 
+  803111:	48 01 d8             	add    %rbx,%rax
+  803114:	ff d0                	call   *%rax
+  803116:	48 98                	cltq
+  803118:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+
+	// in the case of error, return the error without updating the offset.
+	if (bytes_written < 0)
+		return bytes_written;
+	//update the offset of the Fd struct
+	fd->fd_offset += bytes_written;
+  80311c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803120:	8b 40 04             	mov    0x4(%rax),%eax
+  803123:	89 c2                	mov    %eax,%edx
+  803125:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803129:	01 d0                	add    %edx,%eax
+  80312b:	89 c2                	mov    %eax,%edx
+  80312d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803131:	89 50 04             	mov    %edx,0x4(%rax)
+	if (debug)
+		cprintf("serve_read %08x %08x %08x\n", envid, req->req_fileid, req->req_n);
+	
+	return bytes_written;
+  803134:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+
+	
+}
+  803138:	48 83 c4 40          	add    $0x40,%rsp
+  80313c:	5b                   	pop    %rbx
+  80313d:	41 5f                	pop    %r15
+  80313f:	5d                   	pop    %rbp
+  803140:	c3                   	ret
+
+0000000000803141 <serve_stat>:
+
+// Stat ipc->stat.req_fileid.  Return the file's struct Stat to the
+// caller in ipc->statRet.
+int
+serve_stat(envid_t envid, union Fsipc *ipc)
+{
+  803141:	55                   	push   %rbp
+  803142:	48 89 e5             	mov    %rsp,%rbp
+  803145:	41 57                	push   %r15
+  803147:	53                   	push   %rbx
+  803148:	48 83 ec 30          	sub    $0x30,%rsp
+  80314c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80314c <serve_stat+0xb>
+  803153:	49 bb 2c 1f 01 00 00 	movabs $0x11f2c,%r11
+  80315a:	00 00 00 
+  80315d:	4c 01 db             	add    %r11,%rbx
+  803160:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803163:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	struct Fsreq_stat *req = &ipc->stat;
+  803167:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80316b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct Fsret_stat *ret = &ipc->statRet;
+  80316f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803173:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (debug)
+		cprintf("serve_stat %08x %08x\n", envid, req->req_fileid);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  803177:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80317b:	8b 00                	mov    (%rax),%eax
+  80317d:	89 c1                	mov    %eax,%ecx
+  80317f:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803183:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803186:	89 ce                	mov    %ecx,%esi
+  803188:	89 c7                	mov    %eax,%edi
+  80318a:	48 b8 d2 d9 fe ff ff 	movabs $0xfffffffffffed9d2,%rax
+  803191:	ff ff ff 
+  803194:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803198:	ff d0                	call   *%rax
+  80319a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80319d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8031a1:	79 05                	jns    8031a8 <serve_stat+0x67>
+		return r;
+  8031a3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031a6:	eb 65                	jmp    80320d <serve_stat+0xcc>
+
+	strcpy(ret->ret_name, o->o_file->f_name);
+  8031a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031ac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8031b0:	48 89 c2             	mov    %rax,%rdx
+  8031b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031b7:	48 89 d6             	mov    %rdx,%rsi
+  8031ba:	48 89 c7             	mov    %rax,%rdi
+  8031bd:	49 89 df             	mov    %rbx,%r15
+  8031c0:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  8031c7:	ff ff ff 
+  8031ca:	48 01 d8             	add    %rbx,%rax
+  8031cd:	ff d0                	call   *%rax
+	ret->ret_size = o->o_file->f_size;
+  8031cf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031d3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8031d7:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8031dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031e1:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  8031e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031eb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8031ef:	8b 80 84 00 00 00    	mov    0x84(%rax),%eax
+  8031f5:	83 f8 01             	cmp    $0x1,%eax
+  8031f8:	0f 94 c0             	sete   %al
+  8031fb:	0f b6 d0             	movzbl %al,%edx
+  8031fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803202:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803208:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80320d:	48 83 c4 30          	add    $0x30,%rsp
+  803211:	5b                   	pop    %rbx
+  803212:	41 5f                	pop    %r15
+  803214:	5d                   	pop    %rbp
+  803215:	c3                   	ret
+
+0000000000803216 <serve_flush>:
+
+// Flush all data and metadata of req->req_fileid to disk.
+int
+serve_flush(envid_t envid, struct Fsreq_flush *req)
+{
+  803216:	55                   	push   %rbp
+  803217:	48 89 e5             	mov    %rsp,%rbp
+  80321a:	41 57                	push   %r15
+  80321c:	53                   	push   %rbx
+  80321d:	48 83 ec 20          	sub    $0x20,%rsp
+  803221:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803221 <serve_flush+0xb>
+  803228:	49 bb 57 1e 01 00 00 	movabs $0x11e57,%r11
+  80322f:	00 00 00 
+  803232:	4c 01 db             	add    %r11,%rbx
+  803235:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803238:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	if (debug)
+		cprintf("serve_flush %08x %08x\n", envid, req->req_fileid);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  80323c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803240:	8b 00                	mov    (%rax),%eax
+  803242:	89 c1                	mov    %eax,%ecx
+  803244:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803248:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80324b:	89 ce                	mov    %ecx,%esi
+  80324d:	89 c7                	mov    %eax,%edi
+  80324f:	48 b8 d2 d9 fe ff ff 	movabs $0xfffffffffffed9d2,%rax
+  803256:	ff ff ff 
+  803259:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80325d:	ff d0                	call   *%rax
+  80325f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803262:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803266:	79 05                	jns    80326d <serve_flush+0x57>
+		return r;
+  803268:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80326b:	eb 22                	jmp    80328f <serve_flush+0x79>
+	file_flush(o->o_file);
+  80326d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803271:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803275:	48 89 c7             	mov    %rax,%rdi
+  803278:	49 89 df             	mov    %rbx,%r15
+  80327b:	48 b8 64 d5 fe ff ff 	movabs $0xfffffffffffed564,%rax
+  803282:	ff ff ff 
+  803285:	48 01 d8             	add    %rbx,%rax
+  803288:	ff d0                	call   *%rax
+	return 0;
+  80328a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80328f:	48 83 c4 20          	add    $0x20,%rsp
+  803293:	5b                   	pop    %rbx
+  803294:	41 5f                	pop    %r15
+  803296:	5d                   	pop    %rbp
+  803297:	c3                   	ret
+
+0000000000803298 <serve_remove>:
+
+// Remove the file req->req_path.
+int
+serve_remove(envid_t envid, struct Fsreq_remove *req)
+{
+  803298:	55                   	push   %rbp
+  803299:	48 89 e5             	mov    %rsp,%rbp
+  80329c:	41 57                	push   %r15
+  80329e:	53                   	push   %rbx
+  80329f:	48 81 ec 10 04 00 00 	sub    $0x410,%rsp
+  8032a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032a6 <serve_remove+0xe>
+  8032ad:	49 bb d2 1d 01 00 00 	movabs $0x11dd2,%r11
+  8032b4:	00 00 00 
+  8032b7:	4c 01 db             	add    %r11,%rbx
+  8032ba:	89 bd ec fb ff ff    	mov    %edi,-0x414(%rbp)
+  8032c0:	48 89 b5 e0 fb ff ff 	mov    %rsi,-0x420(%rbp)
+
+	// Delete the named file.
+	// Note: This request doesn't refer to an open file.
+
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, req->req_path, MAXPATHLEN);
+  8032c7:	48 8b 8d e0 fb ff ff 	mov    -0x420(%rbp),%rcx
+  8032ce:	48 8d 85 f0 fb ff ff 	lea    -0x410(%rbp),%rax
+  8032d5:	ba 00 04 00 00       	mov    $0x400,%edx
+  8032da:	48 89 ce             	mov    %rcx,%rsi
+  8032dd:	48 89 c7             	mov    %rax,%rdi
+  8032e0:	49 89 df             	mov    %rbx,%r15
+  8032e3:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  8032ea:	ff ff ff 
+  8032ed:	48 01 d8             	add    %rbx,%rax
+  8032f0:	ff d0                	call   *%rax
+	path[MAXPATHLEN-1] = 0;
+  8032f2:	c6 45 ef 00          	movb   $0x0,-0x11(%rbp)
+
+	// Delete the specified file
+	return file_remove(path);
+  8032f6:	48 8d 85 f0 fb ff ff 	lea    -0x410(%rbp),%rax
+  8032fd:	48 89 c7             	mov    %rax,%rdi
+  803300:	49 89 df             	mov    %rbx,%r15
+  803303:	48 b8 90 d6 fe ff ff 	movabs $0xfffffffffffed690,%rax
+  80330a:	ff ff ff 
+  80330d:	48 01 d8             	add    %rbx,%rax
+  803310:	ff d0                	call   *%rax
+}
+  803312:	48 81 c4 10 04 00 00 	add    $0x410,%rsp
+  803319:	5b                   	pop    %rbx
+  80331a:	41 5f                	pop    %r15
+  80331c:	5d                   	pop    %rbp
+  80331d:	c3                   	ret
+
+000000000080331e <serve_sync>:
+
+// Sync the file system.
+int
+serve_sync(envid_t envid, union Fsipc *req)
+{
+  80331e:	55                   	push   %rbp
+  80331f:	48 89 e5             	mov    %rsp,%rbp
+  803322:	41 57                	push   %r15
+  803324:	48 83 ec 18          	sub    $0x18,%rsp
+  803328:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803328 <serve_sync+0xa>
+  80332f:	49 bb 50 1d 01 00 00 	movabs $0x11d50,%r11
+  803336:	00 00 00 
+  803339:	4c 01 d8             	add    %r11,%rax
+  80333c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80333f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	fs_sync();
+  803343:	49 89 c7             	mov    %rax,%r15
+  803346:	48 ba 3e d7 fe ff ff 	movabs $0xfffffffffffed73e,%rdx
+  80334d:	ff ff ff 
+  803350:	48 01 c2             	add    %rax,%rdx
+  803353:	ff d2                	call   *%rdx
+	return 0;
+  803355:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80335a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80335e:	c9                   	leave
+  80335f:	c3                   	ret
+
+0000000000803360 <serve>:
+};
+#define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
+
+void
+serve(void)
+{
+  803360:	55                   	push   %rbp
+  803361:	48 89 e5             	mov    %rsp,%rbp
+  803364:	41 57                	push   %r15
+  803366:	53                   	push   %rbx
+  803367:	48 83 ec 70          	sub    $0x70,%rsp
+  80336b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80336b <serve+0xb>
+  803372:	49 bb 0d 1d 01 00 00 	movabs $0x11d0d,%r11
+  803379:	00 00 00 
+  80337c:	4c 01 db             	add    %r11,%rbx
+	uint32_t req, whom = 0;
+  80337f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+	int perm = 0, r = 0;
+  803386:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  80338d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	void *pg = NULL;
+  803394:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80339b:	00 
+
+	while (1) {
+		// Reply to the last request (if any) and wait for the next
+		// one in a single system call.
+		req = ipc_reply_recv(whom, r, pg, perm, (int32_t *) &whom,
+				     IPC_WINDOW(fsreq, IPC_MAXPAGES), &perm,
+  80339c:	48 b8 a8 ff ff ff ff 	movabs $0xffffffffffffffa8,%rax
+  8033a3:	ff ff ff 
+  8033a6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033aa:	48 83 c8 3f          	or     $0x3f,%rax
+		req = ipc_reply_recv(whom, r, pg, perm, (int32_t *) &whom,
+  8033ae:	49 89 c0             	mov    %rax,%r8
+  8033b1:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8033b4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8033b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033bb:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8033be:	41 89 f2             	mov    %esi,%r10d
+  8033c1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8033c5:	48 8d 75 90          	lea    -0x70(%rbp),%rsi
+  8033c9:	56                   	push   %rsi
+  8033ca:	48 8d 75 d4          	lea    -0x2c(%rbp),%rsi
+  8033ce:	56                   	push   %rsi
+  8033cf:	4d 89 c1             	mov    %r8,%r9
+  8033d2:	49 89 f8             	mov    %rdi,%r8
+  8033d5:	89 c6                	mov    %eax,%esi
+  8033d7:	44 89 d7             	mov    %r10d,%edi
+  8033da:	49 89 df             	mov    %rbx,%r15
+  8033dd:	48 b8 f8 1c ff ff ff 	movabs $0xffffffffffff1cf8,%rax
+  8033e4:	ff ff ff 
+  8033e7:	48 01 d8             	add    %rbx,%rax
+  8033ea:	ff d0                	call   *%rax
+  8033ec:	48 83 c4 10          	add    $0x10,%rsp
+  8033f0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+				req, whom, uvpt[PGNUM(fsreq)], fsreq);
+
+		// All requests must contain an argument page, except the
+		// small ones sent in registers by fsipc_words, and reads
+		// and writes, whose pages (if any) hold data.
+		args = fsreq;
+  8033f3:	48 b8 a8 ff ff ff ff 	movabs $0xffffffffffffffa8,%rax
+  8033fa:	ff ff ff 
+  8033fd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803401:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		if (req == FSREQ_FLUSH || req == FSREQ_SET_SIZE
+  803405:	83 7d dc 06          	cmpl   $0x6,-0x24(%rbp)
+  803409:	74 18                	je     803423 <serve+0xc3>
+  80340b:	83 7d dc 02          	cmpl   $0x2,-0x24(%rbp)
+  80340f:	74 12                	je     803423 <serve+0xc3>
+		    || req == FSREQ_SYNC || req == FSREQ_READ
+  803411:	83 7d dc 08          	cmpl   $0x8,-0x24(%rbp)
+  803415:	74 0c                	je     803423 <serve+0xc3>
+  803417:	83 7d dc 03          	cmpl   $0x3,-0x24(%rbp)
+  80341b:	74 06                	je     803423 <serve+0xc3>
+		    || req == FSREQ_WRITE) {
+  80341d:	83 7d dc 04          	cmpl   $0x4,-0x24(%rbp)
+  803421:	75 0a                	jne    80342d <serve+0xcd>
+			args = (union Fsipc *) words;
+  803423:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803427:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80342b:	eb 59                	jmp    803486 <serve+0x126>
+		} else if (!(perm & PTE_P)) {
+  80342d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803430:	83 e0 01             	and    $0x1,%eax
+  803433:	85 c0                	test   %eax,%eax
+  803435:	75 4f                	jne    803486 <serve+0x126>
+			cprintf("Invalid request from %08x: no argument page\n",
+  803437:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80343a:	89 c6                	mov    %eax,%esi
+  80343c:	48 b8 e8 53 ff ff ff 	movabs $0xffffffffffff53e8,%rax
+  803443:	ff ff ff 
+  803446:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80344a:	48 89 c7             	mov    %rax,%rdi
+  80344d:	49 89 df             	mov    %rbx,%r15
+  803450:	b8 00 00 00 00       	mov    $0x0,%eax
+  803455:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  80345c:	ff ff ff 
+  80345f:	48 01 da             	add    %rbx,%rdx
+  803462:	ff d2                	call   *%rdx
+				whom);
+			// Reply to no one, with nothing.
+			whom = 0;
+  803464:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+			pg = NULL;
+  80346b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803472:	00 
+			perm = 0;
+  803473:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+			r = 0;
+  80347a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+			continue; // just leave it hanging...
+  803481:	e9 8f 01 00 00       	jmp    803615 <serve+0x2b5>
+		}
+
+		pg = NULL;
+  803486:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80348d:	00 
+		if (req == FSREQ_OPEN) {
+  80348e:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  803492:	75 36                	jne    8034ca <serve+0x16a>
+			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
+  803494:	48 b8 a8 ff ff ff ff 	movabs $0xffffffffffffffa8,%rax
+  80349b:	ff ff ff 
+  80349e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034a2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8034a5:	89 d7                	mov    %edx,%edi
+  8034a7:	48 8d 4d d4          	lea    -0x2c(%rbp),%rcx
+  8034ab:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8034af:	48 89 c6             	mov    %rax,%rsi
+  8034b2:	48 b8 6b da fe ff ff 	movabs $0xfffffffffffeda6b,%rax
+  8034b9:	ff ff ff 
+  8034bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034c0:	ff d0                	call   *%rax
+  8034c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034c5:	e9 f0 00 00 00       	jmp    8035ba <serve+0x25a>
+		} else if (req == FSREQ_READ) {
+  8034ca:	83 7d dc 03          	cmpl   $0x3,-0x24(%rbp)
+  8034ce:	75 6b                	jne    80353b <serve+0x1db>
+			r = serve_read(whom, &args->read, segs, &nsegs, &words[0]);
+  8034d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034d4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8034d7:	89 d7                	mov    %edx,%edi
+  8034d9:	48 8d 4d 90          	lea    -0x70(%rbp),%rcx
+  8034dd:	48 8d 55 8c          	lea    -0x74(%rbp),%rdx
+  8034e1:	49 89 c8             	mov    %rcx,%r8
+  8034e4:	48 89 d1             	mov    %rdx,%rcx
+  8034e7:	48 ba 88 0f 00 00 00 	movabs $0xf88,%rdx
+  8034ee:	00 00 00 
+  8034f1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8034f5:	48 89 c6             	mov    %rax,%rsi
+  8034f8:	48 b8 28 dd fe ff ff 	movabs $0xfffffffffffedd28,%rax
+  8034ff:	ff ff ff 
+  803502:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803506:	ff d0                	call   *%rax
+  803508:	89 45 ec             	mov    %eax,-0x14(%rbp)
+			pg = nsegs ? segs : NULL;
+  80350b:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  80350e:	85 c0                	test   %eax,%eax
+  803510:	74 10                	je     803522 <serve+0x1c2>
+  803512:	48 b8 88 0f 00 00 00 	movabs $0xf88,%rax
+  803519:	00 00 00 
+  80351c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803520:	eb 05                	jmp    803527 <serve+0x1c7>
+  803522:	b8 00 00 00 00       	mov    $0x0,%eax
+  803527:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+			perm = PTE_P | PTE_U | IPC_PERM_SEGS(nsegs)
+  80352b:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  80352e:	c1 e0 14             	shl    $0x14,%eax
+				| IPC_PERM_WORDS(1);
+  803531:	0d 05 00 01 00       	or     $0x10005,%eax
+			perm = PTE_P | PTE_U | IPC_PERM_SEGS(nsegs)
+  803536:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803539:	eb 7f                	jmp    8035ba <serve+0x25a>
+		} else if (req < NHANDLERS && handlers[req]) {
+  80353b:	83 7d dc 08          	cmpl   $0x8,-0x24(%rbp)
+  80353f:	77 42                	ja     803583 <serve+0x223>
+  803541:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  803548:	00 00 00 
+  80354b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80354e:	48 01 da             	add    %rbx,%rdx
+  803551:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803555:	48 85 c0             	test   %rax,%rax
+  803558:	74 29                	je     803583 <serve+0x223>
+			r = handlers[req](whom, args);
+  80355a:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  803561:	00 00 00 
+  803564:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803567:	48 01 da             	add    %rbx,%rdx
+  80356a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80356e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803571:	89 c1                	mov    %eax,%ecx
+  803573:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803577:	48 89 c6             	mov    %rax,%rsi
+  80357a:	89 cf                	mov    %ecx,%edi
+  80357c:	ff d2                	call   *%rdx
+  80357e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803581:	eb 37                	jmp    8035ba <serve+0x25a>
+		} else {
+			cprintf("Invalid request code %d from %08x\n", req, whom);
+  803583:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803586:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803589:	89 c6                	mov    %eax,%esi
+  80358b:	48 b8 18 54 ff ff ff 	movabs $0xffffffffffff5418,%rax
+  803592:	ff ff ff 
+  803595:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803599:	48 89 c7             	mov    %rax,%rdi
+  80359c:	49 89 df             	mov    %rbx,%r15
+  80359f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a4:	48 b9 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rcx
+  8035ab:	ff ff ff 
+  8035ae:	48 01 d9             	add    %rbx,%rcx
+  8035b1:	ff d1                	call   *%rcx
+			r = -E_INVAL;
+  8035b3:	c7 45 ec fd ff ff ff 	movl   $0xfffffffd,-0x14(%rbp)
+		}
+		// Let go of the request's pages (its argument page, or a
+		// write's bytes) rather than keep them until the next one.
+		if (thisenv->env_ipc_npages)
+  8035ba:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8035c1:	ff ff ff 
+  8035c4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035c8:	48 8b 00             	mov    (%rax),%rax
+  8035cb:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8035d1:	85 c0                	test   %eax,%eax
+  8035d3:	0f 84 c3 fd ff ff    	je     80339c <serve+0x3c>
+			ipc_unmap_window(fsreq, thisenv->env_ipc_npages);
+  8035d9:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8035e0:	ff ff ff 
+  8035e3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035e7:	48 8b 00             	mov    (%rax),%rax
+  8035ea:	8b 90 54 01 00 00    	mov    0x154(%rax),%edx
+  8035f0:	48 b8 a8 ff ff ff ff 	movabs $0xffffffffffffffa8,%rax
+  8035f7:	ff ff ff 
+  8035fa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035fe:	89 d6                	mov    %edx,%esi
+  803600:	48 89 c7             	mov    %rax,%rdi
+  803603:	49 89 df             	mov    %rbx,%r15
+  803606:	48 b8 ce 1f ff ff ff 	movabs $0xffffffffffff1fce,%rax
+  80360d:	ff ff ff 
+  803610:	48 01 d8             	add    %rbx,%rax
+  803613:	ff d0                	call   *%rax
+		req = ipc_reply_recv(whom, r, pg, perm, (int32_t *) &whom,
+  803615:	e9 82 fd ff ff       	jmp    80339c <serve+0x3c>
+
+000000000080361a <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  80361a:	55                   	push   %rbp
+  80361b:	48 89 e5             	mov    %rsp,%rbp
+  80361e:	41 57                	push   %r15
+  803620:	53                   	push   %rbx
+  803621:	48 83 ec 20          	sub    $0x20,%rsp
+  803625:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803625 <umain+0xb>
+  80362c:	49 bb 53 1a 01 00 00 	movabs $0x11a53,%r11
+  803633:	00 00 00 
+  803636:	4c 01 db             	add    %r11,%rbx
+  803639:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80363c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+  803640:	48 b8 b0 ff ff ff ff 	movabs $0xffffffffffffffb0,%rax
+  803647:	ff ff ff 
+  80364a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80364e:	48 ba 3b 54 ff ff ff 	movabs $0xffffffffffff543b,%rdx
+  803655:	ff ff ff 
+  803658:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80365c:	48 89 10             	mov    %rdx,(%rax)
+	cprintf("FS is running\n");
+  80365f:	48 b8 3e 54 ff ff ff 	movabs $0xffffffffffff543e,%rax
+  803666:	ff ff ff 
+  803669:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80366d:	48 89 c7             	mov    %rax,%rdi
+  803670:	49 89 df             	mov    %rbx,%r15
+  803673:	b8 00 00 00 00       	mov    $0x0,%eax
+  803678:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  80367f:	ff ff ff 
+  803682:	48 01 da             	add    %rbx,%rdx
+  803685:	ff d2                	call   *%rdx
+
+	// Clients block on us; don't let CPU-bound envs get ahead.
+	sys_env_set_priority(0, 0);
+  803687:	be 00 00 00 00       	mov    $0x0,%esi
+  80368c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803691:	49 89 df             	mov    %rbx,%r15
+  803694:	48 b8 16 14 ff ff ff 	movabs $0xffffffffffff1416,%rax
+  80369b:	ff ff ff 
+  80369e:	48 01 d8             	add    %rbx,%rax
+  8036a1:	ff d0                	call   *%rax
+  8036a3:	c7 45 ec 00 8a 00 00 	movl   $0x8a00,-0x14(%rbp)
+  8036aa:	66 c7 45 ea 00 8a    	movw   $0x8a00,-0x16(%rbp)
+	__asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  8036b0:	0f b7 45 ea          	movzwl -0x16(%rbp),%eax
+  8036b4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8036b7:	66 ef                	out    %ax,(%dx)
+}
+  8036b9:	90                   	nop
+
+	// Check that we are able to do I/O
+	outw(0x8A00, 0x8A00);
+	cprintf("FS can do I/O\n");
+  8036ba:	48 b8 4d 54 ff ff ff 	movabs $0xffffffffffff544d,%rax
+  8036c1:	ff ff ff 
+  8036c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036c8:	48 89 c7             	mov    %rax,%rdi
+  8036cb:	49 89 df             	mov    %rbx,%r15
+  8036ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d3:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  8036da:	ff ff ff 
+  8036dd:	48 01 da             	add    %rbx,%rdx
+  8036e0:	ff d2                	call   *%rdx
+
+	serve_init();
+  8036e2:	48 b8 bc d7 fe ff ff 	movabs $0xfffffffffffed7bc,%rax
+  8036e9:	ff ff ff 
+  8036ec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036f0:	ff d0                	call   *%rax
+	fs_init();
+  8036f2:	49 89 df             	mov    %rbx,%r15
+  8036f5:	48 b8 fa c4 fe ff ff 	movabs $0xfffffffffffec4fa,%rax
+  8036fc:	ff ff ff 
+  8036ff:	48 01 d8             	add    %rbx,%rax
+  803702:	ff d0                	call   *%rax
+	serve();
+  803704:	48 b8 e8 e2 fe ff ff 	movabs $0xfffffffffffee2e8,%rax
+  80370b:	ff ff ff 
+  80370e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803712:	ff d0                	call   *%rax
+}
+  803714:	90                   	nop
+  803715:	48 83 c4 20          	add    $0x20,%rsp
+  803719:	5b                   	pop    %rbx
+  80371a:	41 5f                	pop    %r15
+  80371c:	5d                   	pop    %rbp
+  80371d:	c3                   	ret
+
+000000000080371e <fs_test>:
+
+static char *msg = "This is the NEW message of the day!\n\n";
+
+void
+fs_test(void)
+{
+  80371e:	55                   	push   %rbp
+  80371f:	48 89 e5             	mov    %rsp,%rbp
+  803722:	41 57                	push   %r15
+  803724:	53                   	push   %rbx
+  803725:	48 83 ec 20          	sub    $0x20,%rsp
+  803729:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803729 <fs_test+0xb>
+  803730:	49 bb 4f 19 01 00 00 	movabs $0x1194f,%r11
+  803737:	00 00 00 
+  80373a:	4c 01 db             	add    %r11,%rbx
+	struct File *f;
+	int r;
+	char *blk;
+	uint32_t *bits;
+	// back up bitmap
+	if ((r = sys_page_alloc(0, (void*) PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  80373d:	ba 07 00 00 00       	mov    $0x7,%edx
+  803742:	be 00 10 00 00       	mov    $0x1000,%esi
+  803747:	bf 00 00 00 00       	mov    $0x0,%edi
+  80374c:	49 89 df             	mov    %rbx,%r15
+  80374f:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  803756:	ff ff ff 
+  803759:	48 01 d8             	add    %rbx,%rax
+  80375c:	ff d0                	call   *%rax
+  80375e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803761:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803765:	79 44                	jns    8037ab <fs_test+0x8d>
+		panic("sys_page_alloc: %e", r);
+  803767:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80376a:	89 c1                	mov    %eax,%ecx
+  80376c:	48 b8 86 54 ff ff ff 	movabs $0xffffffffffff5486,%rax
+  803773:	ff ff ff 
+  803776:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80377a:	48 89 c2             	mov    %rax,%rdx
+  80377d:	be 12 00 00 00       	mov    $0x12,%esi
+  803782:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803789:	ff ff ff 
+  80378c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803790:	48 89 c7             	mov    %rax,%rdi
+  803793:	49 89 df             	mov    %rbx,%r15
+  803796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80379b:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  8037a2:	ff ff ff 
+  8037a5:	49 01 d8             	add    %rbx,%r8
+  8037a8:	41 ff d0             	call   *%r8
+	bits = (uint32_t*) PGSIZE;
+  8037ab:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8037b2:	00 
+	memmove(bits, bitmap, PGSIZE);
+  8037b3:	48 b8 90 1f 01 00 00 	movabs $0x11f90,%rax
+  8037ba:	00 00 00 
+  8037bd:	48 8b 0c 03          	mov    (%rbx,%rax,1),%rcx
+  8037c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037c5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037ca:	48 89 ce             	mov    %rcx,%rsi
+  8037cd:	48 89 c7             	mov    %rax,%rdi
+  8037d0:	49 89 df             	mov    %rbx,%r15
+  8037d3:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  8037da:	ff ff ff 
+  8037dd:	48 01 d8             	add    %rbx,%rax
+  8037e0:	ff d0                	call   *%rax
+	// allocate block
+	if ((r = alloc_block()) < 0)
+  8037e2:	49 89 df             	mov    %rbx,%r15
+  8037e5:	48 b8 f8 c1 fe ff ff 	movabs $0xfffffffffffec1f8,%rax
+  8037ec:	ff ff ff 
+  8037ef:	48 01 d8             	add    %rbx,%rax
+  8037f2:	ff d0                	call   *%rax
+  8037f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037fb:	79 44                	jns    803841 <fs_test+0x123>
+		panic("alloc_block: %e", r);
+  8037fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803800:	89 c1                	mov    %eax,%ecx
+  803802:	48 b8 a3 54 ff ff ff 	movabs $0xffffffffffff54a3,%rax
+  803809:	ff ff ff 
+  80380c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803810:	48 89 c2             	mov    %rax,%rdx
+  803813:	be 17 00 00 00       	mov    $0x17,%esi
+  803818:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  80381f:	ff ff ff 
+  803822:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803826:	48 89 c7             	mov    %rax,%rdi
+  803829:	49 89 df             	mov    %rbx,%r15
+  80382c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803831:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803838:	ff ff ff 
+  80383b:	49 01 d8             	add    %rbx,%r8
+  80383e:	41 ff d0             	call   *%r8
+	// check that block was free
+	assert(bits[r/32] & (1 << (r%32)));
+  803841:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803844:	8d 50 1f             	lea    0x1f(%rax),%edx
+  803847:	85 c0                	test   %eax,%eax
+  803849:	0f 48 c2             	cmovs  %edx,%eax
+  80384c:	c1 f8 05             	sar    $0x5,%eax
+  80384f:	48 98                	cltq
+  803851:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  803858:	00 
+  803859:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80385d:	48 01 d0             	add    %rdx,%rax
+  803860:	8b 00                	mov    (%rax),%eax
+  803862:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803865:	83 e2 1f             	and    $0x1f,%edx
+  803868:	be 01 00 00 00       	mov    $0x1,%esi
+  80386d:	89 d1                	mov    %edx,%ecx
+  80386f:	d3 e6                	shl    %cl,%esi
+  803871:	89 f2                	mov    %esi,%edx
+  803873:	21 d0                	and    %edx,%eax
+  803875:	85 c0                	test   %eax,%eax
+  803877:	75 50                	jne    8038c9 <fs_test+0x1ab>
+  803879:	48 b8 b3 54 ff ff ff 	movabs $0xffffffffffff54b3,%rax
+  803880:	ff ff ff 
+  803883:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803887:	48 89 c1             	mov    %rax,%rcx
+  80388a:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  803891:	ff ff ff 
+  803894:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803898:	48 89 c2             	mov    %rax,%rdx
+  80389b:	be 19 00 00 00       	mov    $0x19,%esi
+  8038a0:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  8038a7:	ff ff ff 
+  8038aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038ae:	48 89 c7             	mov    %rax,%rdi
+  8038b1:	49 89 df             	mov    %rbx,%r15
+  8038b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b9:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  8038c0:	ff ff ff 
+  8038c3:	49 01 d8             	add    %rbx,%r8
+  8038c6:	41 ff d0             	call   *%r8
+	// and is not free any more
+	assert(!(bitmap[r/32] & (1 << (r%32))));
+  8038c9:	48 b8 90 1f 01 00 00 	movabs $0x11f90,%rax
+  8038d0:	00 00 00 
+  8038d3:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  8038d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038da:	8d 48 1f             	lea    0x1f(%rax),%ecx
+  8038dd:	85 c0                	test   %eax,%eax
+  8038df:	0f 48 c1             	cmovs  %ecx,%eax
+  8038e2:	c1 f8 05             	sar    $0x5,%eax
+  8038e5:	48 98                	cltq
+  8038e7:	48 c1 e0 02          	shl    $0x2,%rax
+  8038eb:	48 01 d0             	add    %rdx,%rax
+  8038ee:	8b 00                	mov    (%rax),%eax
+  8038f0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8038f3:	83 e2 1f             	and    $0x1f,%edx
+  8038f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8038fb:	89 d1                	mov    %edx,%ecx
+  8038fd:	d3 e6                	shl    %cl,%esi
+  8038ff:	89 f2                	mov    %esi,%edx
+  803901:	21 d0                	and    %edx,%eax
+  803903:	85 c0                	test   %eax,%eax
+  803905:	74 50                	je     803957 <fs_test+0x239>
+  803907:	48 b8 e8 54 ff ff ff 	movabs $0xffffffffffff54e8,%rax
+  80390e:	ff ff ff 
+  803911:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803915:	48 89 c1             	mov    %rax,%rcx
+  803918:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  80391f:	ff ff ff 
+  803922:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803926:	48 89 c2             	mov    %rax,%rdx
+  803929:	be 1b 00 00 00       	mov    $0x1b,%esi
+  80392e:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803935:	ff ff ff 
+  803938:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80393c:	48 89 c7             	mov    %rax,%rdi
+  80393f:	49 89 df             	mov    %rbx,%r15
+  803942:	b8 00 00 00 00       	mov    $0x0,%eax
+  803947:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  80394e:	ff ff ff 
+  803951:	49 01 d8             	add    %rbx,%r8
+  803954:	41 ff d0             	call   *%r8
+	cprintf("alloc_block is good\n");
+  803957:	48 b8 08 55 ff ff ff 	movabs $0xffffffffffff5508,%rax
+  80395e:	ff ff ff 
+  803961:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803965:	48 89 c7             	mov    %rax,%rdi
+  803968:	49 89 df             	mov    %rbx,%r15
+  80396b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803970:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  803977:	ff ff ff 
+  80397a:	48 01 da             	add    %rbx,%rdx
+  80397d:	ff d2                	call   *%rdx
+
+	if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  80397f:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  803983:	48 89 c6             	mov    %rax,%rsi
+  803986:	48 b8 1d 55 ff ff ff 	movabs $0xffffffffffff551d,%rax
+  80398d:	ff ff ff 
+  803990:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803994:	48 89 c7             	mov    %rax,%rdi
+  803997:	49 89 df             	mov    %rbx,%r15
+  80399a:	48 b8 cc ce fe ff ff 	movabs $0xfffffffffffececc,%rax
+  8039a1:	ff ff ff 
+  8039a4:	48 01 d8             	add    %rbx,%rax
+  8039a7:	ff d0                	call   *%rax
+  8039a9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039ac:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039b0:	79 4a                	jns    8039fc <fs_test+0x2de>
+  8039b2:	83 7d ec f4          	cmpl   $0xfffffff4,-0x14(%rbp)
+  8039b6:	74 44                	je     8039fc <fs_test+0x2de>
+		panic("file_open /not-found: %e", r);
+  8039b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039bb:	89 c1                	mov    %eax,%ecx
+  8039bd:	48 b8 28 55 ff ff ff 	movabs $0xffffffffffff5528,%rax
+  8039c4:	ff ff ff 
+  8039c7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039cb:	48 89 c2             	mov    %rax,%rdx
+  8039ce:	be 1f 00 00 00       	mov    $0x1f,%esi
+  8039d3:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  8039da:	ff ff ff 
+  8039dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039e1:	48 89 c7             	mov    %rax,%rdi
+  8039e4:	49 89 df             	mov    %rbx,%r15
+  8039e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ec:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  8039f3:	ff ff ff 
+  8039f6:	49 01 d8             	add    %rbx,%r8
+  8039f9:	41 ff d0             	call   *%r8
+	else if (r == 0)
+  8039fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a00:	75 3e                	jne    803a40 <fs_test+0x322>
+		panic("file_open /not-found succeeded!");
+  803a02:	48 b8 48 55 ff ff ff 	movabs $0xffffffffffff5548,%rax
+  803a09:	ff ff ff 
+  803a0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a10:	48 89 c2             	mov    %rax,%rdx
+  803a13:	be 21 00 00 00       	mov    $0x21,%esi
+  803a18:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803a1f:	ff ff ff 
+  803a22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a26:	48 89 c7             	mov    %rax,%rdi
+  803a29:	49 89 df             	mov    %rbx,%r15
+  803a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a31:	48 b9 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%rcx
+  803a38:	ff ff ff 
+  803a3b:	48 01 d9             	add    %rbx,%rcx
+  803a3e:	ff d1                	call   *%rcx
+	if ((r = file_open("/newmotd", &f)) < 0)
+  803a40:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  803a44:	48 89 c6             	mov    %rax,%rsi
+  803a47:	48 b8 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rax
+  803a4e:	ff ff ff 
+  803a51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a55:	48 89 c7             	mov    %rax,%rdi
+  803a58:	49 89 df             	mov    %rbx,%r15
+  803a5b:	48 b8 cc ce fe ff ff 	movabs $0xfffffffffffececc,%rax
+  803a62:	ff ff ff 
+  803a65:	48 01 d8             	add    %rbx,%rax
+  803a68:	ff d0                	call   *%rax
+  803a6a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a6d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a71:	79 44                	jns    803ab7 <fs_test+0x399>
+		panic("file_open /newmotd: %e", r);
+  803a73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a76:	89 c1                	mov    %eax,%ecx
+  803a78:	48 b8 71 55 ff ff ff 	movabs $0xffffffffffff5571,%rax
+  803a7f:	ff ff ff 
+  803a82:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a86:	48 89 c2             	mov    %rax,%rdx
+  803a89:	be 23 00 00 00       	mov    $0x23,%esi
+  803a8e:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803a95:	ff ff ff 
+  803a98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a9c:	48 89 c7             	mov    %rax,%rdi
+  803a9f:	49 89 df             	mov    %rbx,%r15
+  803aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa7:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803aae:	ff ff ff 
+  803ab1:	49 01 d8             	add    %rbx,%r8
+  803ab4:	41 ff d0             	call   *%r8
+	cprintf("file_open is good\n");
+  803ab7:	48 b8 88 55 ff ff ff 	movabs $0xffffffffffff5588,%rax
+  803abe:	ff ff ff 
+  803ac1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ac5:	48 89 c7             	mov    %rax,%rdi
+  803ac8:	49 89 df             	mov    %rbx,%r15
+  803acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad0:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  803ad7:	ff ff ff 
+  803ada:	48 01 da             	add    %rbx,%rdx
+  803add:	ff d2                	call   *%rdx
+
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  803adf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ae3:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803ae7:	be 00 00 00 00       	mov    $0x0,%esi
+  803aec:	48 89 c7             	mov    %rax,%rdi
+  803aef:	49 89 df             	mov    %rbx,%r15
+  803af2:	48 b8 21 c7 fe ff ff 	movabs $0xfffffffffffec721,%rax
+  803af9:	ff ff ff 
+  803afc:	48 01 d8             	add    %rbx,%rax
+  803aff:	ff d0                	call   *%rax
+  803b01:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b04:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b08:	79 44                	jns    803b4e <fs_test+0x430>
+		panic("file_get_block: %e", r);
+  803b0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b0d:	89 c1                	mov    %eax,%ecx
+  803b0f:	48 b8 9b 55 ff ff ff 	movabs $0xffffffffffff559b,%rax
+  803b16:	ff ff ff 
+  803b19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b1d:	48 89 c2             	mov    %rax,%rdx
+  803b20:	be 27 00 00 00       	mov    $0x27,%esi
+  803b25:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803b2c:	ff ff ff 
+  803b2f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b33:	48 89 c7             	mov    %rax,%rdi
+  803b36:	49 89 df             	mov    %rbx,%r15
+  803b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b3e:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803b45:	ff ff ff 
+  803b48:	49 01 d8             	add    %rbx,%r8
+  803b4b:	41 ff d0             	call   *%r8
+	if (strcmp(blk, msg) != 0)
+  803b4e:	48 b8 70 00 00 00 00 	movabs $0x70,%rax
+  803b55:	00 00 00 
+  803b58:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  803b5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b60:	48 89 d6             	mov    %rdx,%rsi
+  803b63:	48 89 c7             	mov    %rax,%rdi
+  803b66:	49 89 df             	mov    %rbx,%r15
+  803b69:	48 b8 a9 04 ff ff ff 	movabs $0xffffffffffff04a9,%rax
+  803b70:	ff ff ff 
+  803b73:	48 01 d8             	add    %rbx,%rax
+  803b76:	ff d0                	call   *%rax
+  803b78:	85 c0                	test   %eax,%eax
+  803b7a:	74 3e                	je     803bba <fs_test+0x49c>
+		panic("file_get_block returned wrong data");
+  803b7c:	48 b8 b0 55 ff ff ff 	movabs $0xffffffffffff55b0,%rax
+  803b83:	ff ff ff 
+  803b86:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b8a:	48 89 c2             	mov    %rax,%rdx
+  803b8d:	be 29 00 00 00       	mov    $0x29,%esi
+  803b92:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803b99:	ff ff ff 
+  803b9c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ba0:	48 89 c7             	mov    %rax,%rdi
+  803ba3:	49 89 df             	mov    %rbx,%r15
+  803ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bab:	48 b9 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%rcx
+  803bb2:	ff ff ff 
+  803bb5:	48 01 d9             	add    %rbx,%rcx
+  803bb8:	ff d1                	call   *%rcx
+	cprintf("file_get_block is good\n");
+  803bba:	48 b8 d3 55 ff ff ff 	movabs $0xffffffffffff55d3,%rax
+  803bc1:	ff ff ff 
+  803bc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bc8:	48 89 c7             	mov    %rax,%rdi
+  803bcb:	49 89 df             	mov    %rbx,%r15
+  803bce:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bd3:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  803bda:	ff ff ff 
+  803bdd:	48 01 da             	add    %rbx,%rdx
+  803be0:	ff d2                	call   *%rdx
+
+	*(volatile char*)blk = *(volatile char*)blk;
+  803be2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803be6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bea:	0f b6 12             	movzbl (%rdx),%edx
+  803bed:	88 10                	mov    %dl,(%rax)
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  803bef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bf3:	48 c1 e8 0c          	shr    $0xc,%rax
+  803bf7:	48 89 c2             	mov    %rax,%rdx
+  803bfa:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  803c01:	ff ff ff 
+  803c04:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c08:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c0c:	83 e0 40             	and    $0x40,%eax
+  803c0f:	48 85 c0             	test   %rax,%rax
+  803c12:	75 50                	jne    803c64 <fs_test+0x546>
+  803c14:	48 b8 eb 55 ff ff ff 	movabs $0xffffffffffff55eb,%rax
+  803c1b:	ff ff ff 
+  803c1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c22:	48 89 c1             	mov    %rax,%rcx
+  803c25:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  803c2c:	ff ff ff 
+  803c2f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c33:	48 89 c2             	mov    %rax,%rdx
+  803c36:	be 2d 00 00 00       	mov    $0x2d,%esi
+  803c3b:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803c42:	ff ff ff 
+  803c45:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c49:	48 89 c7             	mov    %rax,%rdi
+  803c4c:	49 89 df             	mov    %rbx,%r15
+  803c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c54:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803c5b:	ff ff ff 
+  803c5e:	49 01 d8             	add    %rbx,%r8
+  803c61:	41 ff d0             	call   *%r8
+	file_flush(f);
+  803c64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c68:	48 89 c7             	mov    %rax,%rdi
+  803c6b:	49 89 df             	mov    %rbx,%r15
+  803c6e:	48 b8 64 d5 fe ff ff 	movabs $0xfffffffffffed564,%rax
+  803c75:	ff ff ff 
+  803c78:	48 01 d8             	add    %rbx,%rax
+  803c7b:	ff d0                	call   *%rax
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  803c7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c81:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c85:	48 89 c2             	mov    %rax,%rdx
+  803c88:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  803c8f:	ff ff ff 
+  803c92:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c96:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c9a:	83 e0 40             	and    $0x40,%eax
+  803c9d:	48 85 c0             	test   %rax,%rax
+  803ca0:	74 50                	je     803cf2 <fs_test+0x5d4>
+  803ca2:	48 b8 06 56 ff ff ff 	movabs $0xffffffffffff5606,%rax
+  803ca9:	ff ff ff 
+  803cac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cb0:	48 89 c1             	mov    %rax,%rcx
+  803cb3:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  803cba:	ff ff ff 
+  803cbd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cc1:	48 89 c2             	mov    %rax,%rdx
+  803cc4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803cc9:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803cd0:	ff ff ff 
+  803cd3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cd7:	48 89 c7             	mov    %rax,%rdi
+  803cda:	49 89 df             	mov    %rbx,%r15
+  803cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce2:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803ce9:	ff ff ff 
+  803cec:	49 01 d8             	add    %rbx,%r8
+  803cef:	41 ff d0             	call   *%r8
+	cprintf("file_flush is good\n");
+  803cf2:	48 b8 22 56 ff ff ff 	movabs $0xffffffffffff5622,%rax
+  803cf9:	ff ff ff 
+  803cfc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d00:	48 89 c7             	mov    %rax,%rdi
+  803d03:	49 89 df             	mov    %rbx,%r15
+  803d06:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d0b:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  803d12:	ff ff ff 
+  803d15:	48 01 da             	add    %rbx,%rdx
+  803d18:	ff d2                	call   *%rdx
+
+	if ((r = file_set_size(f, 0)) < 0)
+  803d1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d1e:	be 00 00 00 00       	mov    $0x0,%esi
+  803d23:	48 89 c7             	mov    %rax,%rdi
+  803d26:	49 89 df             	mov    %rbx,%r15
+  803d29:	48 b8 c9 d3 fe ff ff 	movabs $0xfffffffffffed3c9,%rax
+  803d30:	ff ff ff 
+  803d33:	48 01 d8             	add    %rbx,%rax
+  803d36:	ff d0                	call   *%rax
+  803d38:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d3b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d3f:	79 44                	jns    803d85 <fs_test+0x667>
+		panic("file_set_size: %e", r);
+  803d41:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d44:	89 c1                	mov    %eax,%ecx
+  803d46:	48 b8 36 56 ff ff ff 	movabs $0xffffffffffff5636,%rax
+  803d4d:	ff ff ff 
+  803d50:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d54:	48 89 c2             	mov    %rax,%rdx
+  803d57:	be 33 00 00 00       	mov    $0x33,%esi
+  803d5c:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803d63:	ff ff ff 
+  803d66:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d6a:	48 89 c7             	mov    %rax,%rdi
+  803d6d:	49 89 df             	mov    %rbx,%r15
+  803d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d75:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803d7c:	ff ff ff 
+  803d7f:	49 01 d8             	add    %rbx,%r8
+  803d82:	41 ff d0             	call   *%r8
+	assert(f->f_direct[0] == 0);
+  803d85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d89:	8b 80 88 00 00 00    	mov    0x88(%rax),%eax
+  803d8f:	85 c0                	test   %eax,%eax
+  803d91:	74 50                	je     803de3 <fs_test+0x6c5>
+  803d93:	48 b8 48 56 ff ff ff 	movabs $0xffffffffffff5648,%rax
+  803d9a:	ff ff ff 
+  803d9d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803da1:	48 89 c1             	mov    %rax,%rcx
+  803da4:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  803dab:	ff ff ff 
+  803dae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803db2:	48 89 c2             	mov    %rax,%rdx
+  803db5:	be 34 00 00 00       	mov    $0x34,%esi
+  803dba:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803dc1:	ff ff ff 
+  803dc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dc8:	48 89 c7             	mov    %rax,%rdi
+  803dcb:	49 89 df             	mov    %rbx,%r15
+  803dce:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dd3:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803dda:	ff ff ff 
+  803ddd:	49 01 d8             	add    %rbx,%r8
+  803de0:	41 ff d0             	call   *%r8
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  803de3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803de7:	48 c1 e8 0c          	shr    $0xc,%rax
+  803deb:	48 89 c2             	mov    %rax,%rdx
+  803dee:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  803df5:	ff ff ff 
+  803df8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803dfc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803e00:	83 e0 40             	and    $0x40,%eax
+  803e03:	48 85 c0             	test   %rax,%rax
+  803e06:	74 50                	je     803e58 <fs_test+0x73a>
+  803e08:	48 b8 5c 56 ff ff ff 	movabs $0xffffffffffff565c,%rax
+  803e0f:	ff ff ff 
+  803e12:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e16:	48 89 c1             	mov    %rax,%rcx
+  803e19:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  803e20:	ff ff ff 
+  803e23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e27:	48 89 c2             	mov    %rax,%rdx
+  803e2a:	be 35 00 00 00       	mov    $0x35,%esi
+  803e2f:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803e36:	ff ff ff 
+  803e39:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e3d:	48 89 c7             	mov    %rax,%rdi
+  803e40:	49 89 df             	mov    %rbx,%r15
+  803e43:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e48:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803e4f:	ff ff ff 
+  803e52:	49 01 d8             	add    %rbx,%r8
+  803e55:	41 ff d0             	call   *%r8
+	cprintf("file_truncate is good\n");
+  803e58:	48 b8 76 56 ff ff ff 	movabs $0xffffffffffff5676,%rax
+  803e5f:	ff ff ff 
+  803e62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e66:	48 89 c7             	mov    %rax,%rdi
+  803e69:	49 89 df             	mov    %rbx,%r15
+  803e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e71:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  803e78:	ff ff ff 
+  803e7b:	48 01 da             	add    %rbx,%rdx
+  803e7e:	ff d2                	call   *%rdx
+
+	if ((r = file_set_size(f, strlen(msg))) < 0)
+  803e80:	48 b8 70 00 00 00 00 	movabs $0x70,%rax
+  803e87:	00 00 00 
+  803e8a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803e8e:	48 89 c7             	mov    %rax,%rdi
+  803e91:	49 89 df             	mov    %rbx,%r15
+  803e94:	48 b8 5c 02 ff ff ff 	movabs $0xffffffffffff025c,%rax
+  803e9b:	ff ff ff 
+  803e9e:	48 01 d8             	add    %rbx,%rax
+  803ea1:	ff d0                	call   *%rax
+  803ea3:	89 c2                	mov    %eax,%edx
+  803ea5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ea9:	89 d6                	mov    %edx,%esi
+  803eab:	48 89 c7             	mov    %rax,%rdi
+  803eae:	49 89 df             	mov    %rbx,%r15
+  803eb1:	48 b8 c9 d3 fe ff ff 	movabs $0xfffffffffffed3c9,%rax
+  803eb8:	ff ff ff 
+  803ebb:	48 01 d8             	add    %rbx,%rax
+  803ebe:	ff d0                	call   *%rax
+  803ec0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ec3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ec7:	79 44                	jns    803f0d <fs_test+0x7ef>
+		panic("file_set_size 2: %e", r);
+  803ec9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ecc:	89 c1                	mov    %eax,%ecx
+  803ece:	48 b8 8d 56 ff ff ff 	movabs $0xffffffffffff568d,%rax
+  803ed5:	ff ff ff 
+  803ed8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803edc:	48 89 c2             	mov    %rax,%rdx
+  803edf:	be 39 00 00 00       	mov    $0x39,%esi
+  803ee4:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803eeb:	ff ff ff 
+  803eee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ef2:	48 89 c7             	mov    %rax,%rdi
+  803ef5:	49 89 df             	mov    %rbx,%r15
+  803ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efd:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803f04:	ff ff ff 
+  803f07:	49 01 d8             	add    %rbx,%r8
+  803f0a:	41 ff d0             	call   *%r8
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  803f0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f11:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f15:	48 89 c2             	mov    %rax,%rdx
+  803f18:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  803f1f:	ff ff ff 
+  803f22:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f26:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803f2a:	83 e0 40             	and    $0x40,%eax
+  803f2d:	48 85 c0             	test   %rax,%rax
+  803f30:	74 50                	je     803f82 <fs_test+0x864>
+  803f32:	48 b8 5c 56 ff ff ff 	movabs $0xffffffffffff565c,%rax
+  803f39:	ff ff ff 
+  803f3c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f40:	48 89 c1             	mov    %rax,%rcx
+  803f43:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  803f4a:	ff ff ff 
+  803f4d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f51:	48 89 c2             	mov    %rax,%rdx
+  803f54:	be 3a 00 00 00       	mov    $0x3a,%esi
+  803f59:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803f60:	ff ff ff 
+  803f63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f67:	48 89 c7             	mov    %rax,%rdi
+  803f6a:	49 89 df             	mov    %rbx,%r15
+  803f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f72:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803f79:	ff ff ff 
+  803f7c:	49 01 d8             	add    %rbx,%r8
+  803f7f:	41 ff d0             	call   *%r8
+
+	if ((r = file_get_block(f, 0, &blk)) < 0)
+  803f82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f86:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803f8a:	be 00 00 00 00       	mov    $0x0,%esi
+  803f8f:	48 89 c7             	mov    %rax,%rdi
+  803f92:	49 89 df             	mov    %rbx,%r15
+  803f95:	48 b8 21 c7 fe ff ff 	movabs $0xfffffffffffec721,%rax
+  803f9c:	ff ff ff 
+  803f9f:	48 01 d8             	add    %rbx,%rax
+  803fa2:	ff d0                	call   *%rax
+  803fa4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fa7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fab:	79 44                	jns    803ff1 <fs_test+0x8d3>
+		panic("file_get_block 2: %e", r);
+  803fad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fb0:	89 c1                	mov    %eax,%ecx
+  803fb2:	48 b8 a1 56 ff ff ff 	movabs $0xffffffffffff56a1,%rax
+  803fb9:	ff ff ff 
+  803fbc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fc0:	48 89 c2             	mov    %rax,%rdx
+  803fc3:	be 3d 00 00 00       	mov    $0x3d,%esi
+  803fc8:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  803fcf:	ff ff ff 
+  803fd2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fd6:	48 89 c7             	mov    %rax,%rdi
+  803fd9:	49 89 df             	mov    %rbx,%r15
+  803fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe1:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  803fe8:	ff ff ff 
+  803feb:	49 01 d8             	add    %rbx,%r8
+  803fee:	41 ff d0             	call   *%r8
+	strcpy(blk, msg);
+  803ff1:	48 b8 70 00 00 00 00 	movabs $0x70,%rax
+  803ff8:	00 00 00 
+  803ffb:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  803fff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804003:	48 89 d6             	mov    %rdx,%rsi
+  804006:	48 89 c7             	mov    %rax,%rdi
+  804009:	49 89 df             	mov    %rbx,%r15
+  80400c:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  804013:	ff ff ff 
+  804016:	48 01 d8             	add    %rbx,%rax
+  804019:	ff d0                	call   *%rax
+	assert((uvpt[PGNUM(blk)] & PTE_D));
+  80401b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80401f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804023:	48 89 c2             	mov    %rax,%rdx
+  804026:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80402d:	ff ff ff 
+  804030:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804034:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804038:	83 e0 40             	and    $0x40,%eax
+  80403b:	48 85 c0             	test   %rax,%rax
+  80403e:	75 50                	jne    804090 <fs_test+0x972>
+  804040:	48 b8 eb 55 ff ff ff 	movabs $0xffffffffffff55eb,%rax
+  804047:	ff ff ff 
+  80404a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80404e:	48 89 c1             	mov    %rax,%rcx
+  804051:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  804058:	ff ff ff 
+  80405b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80405f:	48 89 c2             	mov    %rax,%rdx
+  804062:	be 3f 00 00 00       	mov    $0x3f,%esi
+  804067:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  80406e:	ff ff ff 
+  804071:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804075:	48 89 c7             	mov    %rax,%rdi
+  804078:	49 89 df             	mov    %rbx,%r15
+  80407b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804080:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  804087:	ff ff ff 
+  80408a:	49 01 d8             	add    %rbx,%r8
+  80408d:	41 ff d0             	call   *%r8
+	file_flush(f);
+  804090:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804094:	48 89 c7             	mov    %rax,%rdi
+  804097:	49 89 df             	mov    %rbx,%r15
+  80409a:	48 b8 64 d5 fe ff ff 	movabs $0xfffffffffffed564,%rax
+  8040a1:	ff ff ff 
+  8040a4:	48 01 d8             	add    %rbx,%rax
+  8040a7:	ff d0                	call   *%rax
+	assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  8040a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040ad:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040b1:	48 89 c2             	mov    %rax,%rdx
+  8040b4:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8040bb:	ff ff ff 
+  8040be:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8040c2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8040c6:	83 e0 40             	and    $0x40,%eax
+  8040c9:	48 85 c0             	test   %rax,%rax
+  8040cc:	74 50                	je     80411e <fs_test+0xa00>
+  8040ce:	48 b8 06 56 ff ff ff 	movabs $0xffffffffffff5606,%rax
+  8040d5:	ff ff ff 
+  8040d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040dc:	48 89 c1             	mov    %rax,%rcx
+  8040df:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  8040e6:	ff ff ff 
+  8040e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040ed:	48 89 c2             	mov    %rax,%rdx
+  8040f0:	be 41 00 00 00       	mov    $0x41,%esi
+  8040f5:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  8040fc:	ff ff ff 
+  8040ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804103:	48 89 c7             	mov    %rax,%rdi
+  804106:	49 89 df             	mov    %rbx,%r15
+  804109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410e:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  804115:	ff ff ff 
+  804118:	49 01 d8             	add    %rbx,%r8
+  80411b:	41 ff d0             	call   *%r8
+	
+	assert(!(uvpt[PGNUM(f)] & PTE_D));
+  80411e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804122:	48 c1 e8 0c          	shr    $0xc,%rax
+  804126:	48 89 c2             	mov    %rax,%rdx
+  804129:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  804130:	ff ff ff 
+  804133:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804137:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80413b:	83 e0 40             	and    $0x40,%eax
+  80413e:	48 85 c0             	test   %rax,%rax
+  804141:	74 50                	je     804193 <fs_test+0xa75>
+  804143:	48 b8 5c 56 ff ff ff 	movabs $0xffffffffffff565c,%rax
+  80414a:	ff ff ff 
+  80414d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804151:	48 89 c1             	mov    %rax,%rcx
+  804154:	48 b8 ce 54 ff ff ff 	movabs $0xffffffffffff54ce,%rax
+  80415b:	ff ff ff 
+  80415e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804162:	48 89 c2             	mov    %rax,%rdx
+  804165:	be 43 00 00 00       	mov    $0x43,%esi
+  80416a:	48 b8 99 54 ff ff ff 	movabs $0xffffffffffff5499,%rax
+  804171:	ff ff ff 
+  804174:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804178:	48 89 c7             	mov    %rax,%rdi
+  80417b:	49 89 df             	mov    %rbx,%r15
+  80417e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804183:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  80418a:	ff ff ff 
+  80418d:	49 01 d8             	add    %rbx,%r8
+  804190:	41 ff d0             	call   *%r8
+	cprintf("file rewrite is good\n");
+  804193:	48 b8 b6 56 ff ff ff 	movabs $0xffffffffffff56b6,%rax
+  80419a:	ff ff ff 
+  80419d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041a1:	48 89 c7             	mov    %rax,%rdi
+  8041a4:	49 89 df             	mov    %rbx,%r15
+  8041a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ac:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  8041b3:	ff ff ff 
+  8041b6:	48 01 da             	add    %rbx,%rdx
+  8041b9:	ff d2                	call   *%rdx
+}
+  8041bb:	90                   	nop
+  8041bc:	48 83 c4 20          	add    $0x20,%rsp
+  8041c0:	5b                   	pop    %rbx
+  8041c1:	41 5f                	pop    %r15
+  8041c3:	5d                   	pop    %rbp
+  8041c4:	c3                   	ret
+
+00000000008041c5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8041c5:	55                   	push   %rbp
+  8041c6:	48 89 e5             	mov    %rsp,%rbp
+  8041c9:	41 57                	push   %r15
+  8041cb:	53                   	push   %rbx
+  8041cc:	48 83 ec 20          	sub    $0x20,%rsp
+  8041d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041d0 <libmain+0xb>
+  8041d7:	49 bb a8 0e 01 00 00 	movabs $0x10ea8,%r11
+  8041de:	00 00 00 
+  8041e1:	4c 01 db             	add    %r11,%rbx
+  8041e4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8041e7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8041eb:	49 89 df             	mov    %rbx,%r15
+  8041ee:	48 b8 03 0f ff ff ff 	movabs $0xffffffffffff0f03,%rax
+  8041f5:	ff ff ff 
+  8041f8:	48 01 d8             	add    %rbx,%rax
+  8041fb:	ff d0                	call   *%rax
+  8041fd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  804200:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804203:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804208:	48 98                	cltq
+  80420a:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  804211:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  804218:	ff ff ff 
+  80421b:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80421f:	48 01 c2             	add    %rax,%rdx
+  804222:	48 b8 a0 1f 01 00 00 	movabs $0x11fa0,%rax
+  804229:	00 00 00 
+  80422c:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  804230:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804234:	7e 15                	jle    80424b <libmain+0x86>
+		binaryname = argv[0];
+  804236:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80423a:	48 8b 00             	mov    (%rax),%rax
+  80423d:	48 ba 78 00 00 00 00 	movabs $0x78,%rdx
+  804244:	00 00 00 
+  804247:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80424b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80424f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804252:	48 89 d6             	mov    %rdx,%rsi
+  804255:	89 c7                	mov    %eax,%edi
+  804257:	49 89 df             	mov    %rbx,%r15
+  80425a:	48 b8 a2 e5 fe ff ff 	movabs $0xfffffffffffee5a2,%rax
+  804261:	ff ff ff 
+  804264:	48 01 d8             	add    %rbx,%rax
+  804267:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  804269:	49 89 df             	mov    %rbx,%r15
+  80426c:	48 b8 0d f2 fe ff ff 	movabs $0xfffffffffffef20d,%rax
+  804273:	ff ff ff 
+  804276:	48 01 d8             	add    %rbx,%rax
+  804279:	ff d0                	call   *%rax
+}
+  80427b:	90                   	nop
+  80427c:	48 83 c4 20          	add    $0x20,%rsp
+  804280:	5b                   	pop    %rbx
+  804281:	41 5f                	pop    %r15
+  804283:	5d                   	pop    %rbp
+  804284:	c3                   	ret
+
+0000000000804285 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  804285:	55                   	push   %rbp
+  804286:	48 89 e5             	mov    %rsp,%rbp
+  804289:	41 57                	push   %r15
+  80428b:	53                   	push   %rbx
+  80428c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80428c <exit+0x7>
+  804293:	49 bb ec 0d 01 00 00 	movabs $0x10dec,%r11
+  80429a:	00 00 00 
+  80429d:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8042a0:	49 89 df             	mov    %rbx,%r15
+  8042a3:	48 b8 ce 24 ff ff ff 	movabs $0xffffffffffff24ce,%rax
+  8042aa:	ff ff ff 
+  8042ad:	48 01 d8             	add    %rbx,%rax
+  8042b0:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8042b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042b7:	49 89 df             	mov    %rbx,%r15
+  8042ba:	48 b8 a7 0e ff ff ff 	movabs $0xffffffffffff0ea7,%rax
+  8042c1:	ff ff ff 
+  8042c4:	48 01 d8             	add    %rbx,%rax
+  8042c7:	ff d0                	call   *%rax
+}
+  8042c9:	90                   	nop
+  8042ca:	5b                   	pop    %rbx
+  8042cb:	41 5f                	pop    %r15
+  8042cd:	5d                   	pop    %rbp
+  8042ce:	c3                   	ret
+
+00000000008042cf <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8042cf:	55                   	push   %rbp
+  8042d0:	48 89 e5             	mov    %rsp,%rbp
+  8042d3:	41 57                	push   %r15
+  8042d5:	41 54                	push   %r12
+  8042d7:	53                   	push   %rbx
+  8042d8:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8042df:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042df <_panic+0x10>
+  8042e6:	49 bb 99 0d 01 00 00 	movabs $0x10d99,%r11
+  8042ed:	00 00 00 
+  8042f0:	4c 01 db             	add    %r11,%rbx
+  8042f3:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8042fa:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  804300:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  804307:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80430e:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  804315:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80431c:	84 c0                	test   %al,%al
+  80431e:	74 26                	je     804346 <_panic+0x77>
+  804320:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  804327:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80432e:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  804332:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  804336:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80433a:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80433e:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  804342:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  804346:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80434d:	00 00 00 
+  804350:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  804357:	00 00 00 
+  80435a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80435e:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  804365:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80436c:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804373:	48 b8 b0 ff ff ff ff 	movabs $0xffffffffffffffb0,%rax
+  80437a:	ff ff ff 
+  80437d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804381:	4c 8b 20             	mov    (%rax),%r12
+  804384:	49 89 df             	mov    %rbx,%r15
+  804387:	48 b8 03 0f ff ff ff 	movabs $0xffffffffffff0f03,%rax
+  80438e:	ff ff ff 
+  804391:	48 01 d8             	add    %rbx,%rax
+  804394:	ff d0                	call   *%rax
+  804396:	89 c6                	mov    %eax,%esi
+  804398:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80439e:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8043a5:	41 89 d0             	mov    %edx,%r8d
+  8043a8:	48 89 c1             	mov    %rax,%rcx
+  8043ab:	4c 89 e2             	mov    %r12,%rdx
+  8043ae:	48 b8 d8 56 ff ff ff 	movabs $0xffffffffffff56d8,%rax
+  8043b5:	ff ff ff 
+  8043b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043bc:	48 89 c7             	mov    %rax,%rdi
+  8043bf:	49 89 df             	mov    %rbx,%r15
+  8043c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c7:	49 b9 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%r9
+  8043ce:	ff ff ff 
+  8043d1:	49 01 d9             	add    %rbx,%r9
+  8043d4:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8043d7:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8043de:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8043e5:	48 89 d6             	mov    %rdx,%rsi
+  8043e8:	48 89 c7             	mov    %rax,%rdi
+  8043eb:	49 89 df             	mov    %rbx,%r15
+  8043ee:	48 b8 4e f4 fe ff ff 	movabs $0xfffffffffffef44e,%rax
+  8043f5:	ff ff ff 
+  8043f8:	48 01 d8             	add    %rbx,%rax
+  8043fb:	ff d0                	call   *%rax
+	cprintf("\n");
+  8043fd:	48 b8 fb 56 ff ff ff 	movabs $0xffffffffffff56fb,%rax
+  804404:	ff ff ff 
+  804407:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80440b:	48 89 c7             	mov    %rax,%rdi
+  80440e:	49 89 df             	mov    %rbx,%r15
+  804411:	b8 00 00 00 00       	mov    $0x0,%eax
+  804416:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  80441d:	ff ff ff 
+  804420:	48 01 da             	add    %rbx,%rdx
+  804423:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  804425:	cc                   	int3
+  804426:	eb fd                	jmp    804425 <_panic+0x156>
+
+0000000000804428 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  804428:	55                   	push   %rbp
+  804429:	48 89 e5             	mov    %rsp,%rbp
+  80442c:	41 57                	push   %r15
+  80442e:	48 83 ec 18          	sub    $0x18,%rsp
+  804432:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804432 <putch+0xa>
+  804439:	49 bb 46 0c 01 00 00 	movabs $0x10c46,%r11
+  804440:	00 00 00 
+  804443:	4c 01 d8             	add    %r11,%rax
+  804446:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804449:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80444d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804451:	8b 12                	mov    (%rdx),%edx
+  804453:	8d 72 01             	lea    0x1(%rdx),%esi
+  804456:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80445a:	89 31                	mov    %esi,(%rcx)
+  80445c:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80445f:	89 ce                	mov    %ecx,%esi
+  804461:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804465:	48 63 d2             	movslq %edx,%rdx
+  804468:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80446d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804471:	8b 12                	mov    (%rdx),%edx
+  804473:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  804479:	75 33                	jne    8044ae <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80447b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80447f:	8b 12                	mov    (%rdx),%edx
+  804481:	48 63 d2             	movslq %edx,%rdx
+  804484:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804488:	48 83 c1 08          	add    $0x8,%rcx
+  80448c:	48 89 d6             	mov    %rdx,%rsi
+  80448f:	48 89 cf             	mov    %rcx,%rdi
+  804492:	49 89 c7             	mov    %rax,%r15
+  804495:	48 ba f4 0d ff ff ff 	movabs $0xffffffffffff0df4,%rdx
+  80449c:	ff ff ff 
+  80449f:	48 01 c2             	add    %rax,%rdx
+  8044a2:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8044a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044a8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8044ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b2:	8b 40 04             	mov    0x4(%rax),%eax
+  8044b5:	8d 50 01             	lea    0x1(%rax),%edx
+  8044b8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044bc:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8044bf:	90                   	nop
+  8044c0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8044c4:	c9                   	leave
+  8044c5:	c3                   	ret
+
+00000000008044c6 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8044c6:	55                   	push   %rbp
+  8044c7:	48 89 e5             	mov    %rsp,%rbp
+  8044ca:	41 57                	push   %r15
+  8044cc:	53                   	push   %rbx
+  8044cd:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8044d4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044d4 <vcprintf+0xe>
+  8044db:	49 bb a4 0b 01 00 00 	movabs $0x10ba4,%r11
+  8044e2:	00 00 00 
+  8044e5:	4c 01 db             	add    %r11,%rbx
+  8044e8:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8044ef:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8044f6:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8044fd:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  804504:	48 8b 06             	mov    (%rsi),%rax
+  804507:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80450b:	48 89 01             	mov    %rax,(%rcx)
+  80450e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804512:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804516:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80451a:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  804521:	00 00 00 
+    b.cnt = 0;
+  804524:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80452b:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  80452e:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  804535:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80453c:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804543:	48 89 c6             	mov    %rax,%rsi
+  804546:	48 b8 b0 f3 fe ff ff 	movabs $0xfffffffffffef3b0,%rax
+  80454d:	ff ff ff 
+  804550:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804554:	48 89 c7             	mov    %rax,%rdi
+  804557:	49 89 df             	mov    %rbx,%r15
+  80455a:	48 b8 72 f9 fe ff ff 	movabs $0xfffffffffffef972,%rax
+  804561:	ff ff ff 
+  804564:	48 01 d8             	add    %rbx,%rax
+  804567:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  804569:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80456f:	48 98                	cltq
+  804571:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  804578:	48 83 c2 08          	add    $0x8,%rdx
+  80457c:	48 89 c6             	mov    %rax,%rsi
+  80457f:	48 89 d7             	mov    %rdx,%rdi
+  804582:	49 89 df             	mov    %rbx,%r15
+  804585:	48 b8 f4 0d ff ff ff 	movabs $0xffffffffffff0df4,%rax
+  80458c:	ff ff ff 
+  80458f:	48 01 d8             	add    %rbx,%rax
+  804592:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  804594:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80459a:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8045a1:	5b                   	pop    %rbx
+  8045a2:	41 5f                	pop    %r15
+  8045a4:	5d                   	pop    %rbp
+  8045a5:	c3                   	ret
+
+00000000008045a6 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8045a6:	55                   	push   %rbp
+  8045a7:	48 89 e5             	mov    %rsp,%rbp
+  8045aa:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8045b1:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8045b1 <cprintf+0xb>
+  8045b8:	49 bb c7 0a 01 00 00 	movabs $0x10ac7,%r11
+  8045bf:	00 00 00 
+  8045c2:	4d 01 da             	add    %r11,%r10
+  8045c5:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8045cc:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8045d3:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8045da:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8045e1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8045e8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8045ef:	84 c0                	test   %al,%al
+  8045f1:	74 20                	je     804613 <cprintf+0x6d>
+  8045f3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8045f7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8045fb:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8045ff:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804603:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804607:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80460b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80460f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  804613:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80461a:	00 00 00 
+  80461d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804624:	00 00 00 
+  804627:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80462b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804632:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804639:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  804640:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  804647:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80464e:	48 8b 06             	mov    (%rsi),%rax
+  804651:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804655:	48 89 01             	mov    %rax,(%rcx)
+  804658:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80465c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804660:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  804664:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80466b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804672:	48 89 d6             	mov    %rdx,%rsi
+  804675:	48 89 c7             	mov    %rax,%rdi
+  804678:	48 b8 4e f4 fe ff ff 	movabs $0xfffffffffffef44e,%rax
+  80467f:	ff ff ff 
+  804682:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804686:	ff d0                	call   *%rax
+  804688:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80468e:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804694:	c9                   	leave
+  804695:	c3                   	ret
+
+0000000000804696 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  804696:	55                   	push   %rbp
+  804697:	48 89 e5             	mov    %rsp,%rbp
+  80469a:	53                   	push   %rbx
+  80469b:	48 83 ec 38          	sub    $0x38,%rsp
+  80469f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80469f <printnum+0x9>
+  8046a6:	49 bb d9 09 01 00 00 	movabs $0x109d9,%r11
+  8046ad:	00 00 00 
+  8046b0:	4c 01 db             	add    %r11,%rbx
+  8046b3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8046b7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8046bb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8046bf:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8046c2:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8046c6:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8046ca:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8046cd:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8046d1:	72 58                	jb     80472b <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8046d3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8046d6:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8046d9:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8046dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046e5:	48 f7 f6             	div    %rsi
+  8046e8:	49 89 c2             	mov    %rax,%r10
+  8046eb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8046ee:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8046f1:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8046f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f9:	41 89 c9             	mov    %ecx,%r9d
+  8046fc:	41 89 f8             	mov    %edi,%r8d
+  8046ff:	89 d1                	mov    %edx,%ecx
+  804701:	4c 89 d2             	mov    %r10,%rdx
+  804704:	48 89 c7             	mov    %rax,%rdi
+  804707:	48 b8 1e f6 fe ff ff 	movabs $0xfffffffffffef61e,%rax
+  80470e:	ff ff ff 
+  804711:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804715:	ff d0                	call   *%rax
+  804717:	eb 1c                	jmp    804735 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  804719:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80471d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804720:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804724:	48 89 d6             	mov    %rdx,%rsi
+  804727:	89 c7                	mov    %eax,%edi
+  804729:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80472b:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  80472f:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  804733:	7f e4                	jg     804719 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  804735:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804738:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80473c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804741:	48 f7 f1             	div    %rcx
+  804744:	48 b8 37 58 ff ff ff 	movabs $0xffffffffffff5837,%rax
+  80474b:	ff ff ff 
+  80474e:	48 01 d8             	add    %rbx,%rax
+  804751:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  804755:	0f be c0             	movsbl %al,%eax
+  804758:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80475c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804760:	48 89 d6             	mov    %rdx,%rsi
+  804763:	89 c7                	mov    %eax,%edi
+  804765:	ff d1                	call   *%rcx
+}
+  804767:	90                   	nop
+  804768:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80476c:	c9                   	leave
+  80476d:	c3                   	ret
+
+000000000080476e <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80476e:	55                   	push   %rbp
+  80476f:	48 89 e5             	mov    %rsp,%rbp
+  804772:	48 83 ec 20          	sub    $0x20,%rsp
+  804776:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804776 <getuint+0x8>
+  80477d:	49 bb 02 09 01 00 00 	movabs $0x10902,%r11
+  804784:	00 00 00 
+  804787:	4c 01 d8             	add    %r11,%rax
+  80478a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80478e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  804791:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  804795:	7e 4f                	jle    8047e6 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  804797:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80479b:	8b 00                	mov    (%rax),%eax
+  80479d:	83 f8 2f             	cmp    $0x2f,%eax
+  8047a0:	77 24                	ja     8047c6 <getuint+0x58>
+  8047a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047a6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8047aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ae:	8b 00                	mov    (%rax),%eax
+  8047b0:	89 c0                	mov    %eax,%eax
+  8047b2:	48 01 d0             	add    %rdx,%rax
+  8047b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8047b9:	8b 12                	mov    (%rdx),%edx
+  8047bb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8047be:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8047c2:	89 0a                	mov    %ecx,(%rdx)
+  8047c4:	eb 14                	jmp    8047da <getuint+0x6c>
+  8047c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8047ce:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8047d2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8047d6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8047da:	48 8b 00             	mov    (%rax),%rax
+  8047dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8047e1:	e9 9d 00 00 00       	jmp    804883 <getuint+0x115>
+	else if (lflag)
+  8047e6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8047ea:	74 4c                	je     804838 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8047ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047f0:	8b 00                	mov    (%rax),%eax
+  8047f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8047f5:	77 24                	ja     80481b <getuint+0xad>
+  8047f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047fb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8047ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804803:	8b 00                	mov    (%rax),%eax
+  804805:	89 c0                	mov    %eax,%eax
+  804807:	48 01 d0             	add    %rdx,%rax
+  80480a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80480e:	8b 12                	mov    (%rdx),%edx
+  804810:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804813:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804817:	89 0a                	mov    %ecx,(%rdx)
+  804819:	eb 14                	jmp    80482f <getuint+0xc1>
+  80481b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80481f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804823:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804827:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80482b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80482f:	48 8b 00             	mov    (%rax),%rax
+  804832:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804836:	eb 4b                	jmp    804883 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  804838:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80483c:	8b 00                	mov    (%rax),%eax
+  80483e:	83 f8 2f             	cmp    $0x2f,%eax
+  804841:	77 24                	ja     804867 <getuint+0xf9>
+  804843:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804847:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80484b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80484f:	8b 00                	mov    (%rax),%eax
+  804851:	89 c0                	mov    %eax,%eax
+  804853:	48 01 d0             	add    %rdx,%rax
+  804856:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80485a:	8b 12                	mov    (%rdx),%edx
+  80485c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80485f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804863:	89 0a                	mov    %ecx,(%rdx)
+  804865:	eb 14                	jmp    80487b <getuint+0x10d>
+  804867:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80486b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80486f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804873:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804877:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80487b:	8b 00                	mov    (%rax),%eax
+  80487d:	89 c0                	mov    %eax,%eax
+  80487f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  804883:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804887:	c9                   	leave
+  804888:	c3                   	ret
+
+0000000000804889 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  804889:	55                   	push   %rbp
+  80488a:	48 89 e5             	mov    %rsp,%rbp
+  80488d:	48 83 ec 20          	sub    $0x20,%rsp
+  804891:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804891 <printfloat+0x8>
+  804898:	49 bb e7 07 01 00 00 	movabs $0x107e7,%r11
+  80489f:	00 00 00 
+  8048a2:	4c 01 d8             	add    %r11,%rax
+  8048a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8048a9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8048ad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8048b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048b5:	48 85 c0             	test   %rax,%rax
+  8048b8:	79 12                	jns    8048cc <printfloat+0x43>
+		putch('-',putdat);
+  8048ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048be:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8048c2:	48 89 c6             	mov    %rax,%rsi
+  8048c5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8048ca:	ff d2                	call   *%rdx
+	
+}
+  8048cc:	90                   	nop
+  8048cd:	c9                   	leave
+  8048ce:	c3                   	ret
+
+00000000008048cf <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8048cf:	55                   	push   %rbp
+  8048d0:	48 89 e5             	mov    %rsp,%rbp
+  8048d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8048d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8048d7 <getint+0x8>
+  8048de:	49 bb a1 07 01 00 00 	movabs $0x107a1,%r11
+  8048e5:	00 00 00 
+  8048e8:	4c 01 d8             	add    %r11,%rax
+  8048eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8048ef:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8048f2:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8048f6:	7e 4f                	jle    804947 <getint+0x78>
+		x=va_arg(*ap, long long);
+  8048f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048fc:	8b 00                	mov    (%rax),%eax
+  8048fe:	83 f8 2f             	cmp    $0x2f,%eax
+  804901:	77 24                	ja     804927 <getint+0x58>
+  804903:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804907:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80490b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80490f:	8b 00                	mov    (%rax),%eax
+  804911:	89 c0                	mov    %eax,%eax
+  804913:	48 01 d0             	add    %rdx,%rax
+  804916:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80491a:	8b 12                	mov    (%rdx),%edx
+  80491c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80491f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804923:	89 0a                	mov    %ecx,(%rdx)
+  804925:	eb 14                	jmp    80493b <getint+0x6c>
+  804927:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80492b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80492f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804933:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804937:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80493b:	48 8b 00             	mov    (%rax),%rax
+  80493e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804942:	e9 9d 00 00 00       	jmp    8049e4 <getint+0x115>
+	else if (lflag)
+  804947:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80494b:	74 4c                	je     804999 <getint+0xca>
+		x=va_arg(*ap, long);
+  80494d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804951:	8b 00                	mov    (%rax),%eax
+  804953:	83 f8 2f             	cmp    $0x2f,%eax
+  804956:	77 24                	ja     80497c <getint+0xad>
+  804958:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80495c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804960:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804964:	8b 00                	mov    (%rax),%eax
+  804966:	89 c0                	mov    %eax,%eax
+  804968:	48 01 d0             	add    %rdx,%rax
+  80496b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80496f:	8b 12                	mov    (%rdx),%edx
+  804971:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804974:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804978:	89 0a                	mov    %ecx,(%rdx)
+  80497a:	eb 14                	jmp    804990 <getint+0xc1>
+  80497c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804980:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804984:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804988:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80498c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804990:	48 8b 00             	mov    (%rax),%rax
+  804993:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804997:	eb 4b                	jmp    8049e4 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  804999:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80499d:	8b 00                	mov    (%rax),%eax
+  80499f:	83 f8 2f             	cmp    $0x2f,%eax
+  8049a2:	77 24                	ja     8049c8 <getint+0xf9>
+  8049a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049a8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8049ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049b0:	8b 00                	mov    (%rax),%eax
+  8049b2:	89 c0                	mov    %eax,%eax
+  8049b4:	48 01 d0             	add    %rdx,%rax
+  8049b7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8049bb:	8b 12                	mov    (%rdx),%edx
+  8049bd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8049c0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8049c4:	89 0a                	mov    %ecx,(%rdx)
+  8049c6:	eb 14                	jmp    8049dc <getint+0x10d>
+  8049c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049cc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8049d0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8049d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8049d8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8049dc:	8b 00                	mov    (%rax),%eax
+  8049de:	48 98                	cltq
+  8049e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8049e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8049e8:	c9                   	leave
+  8049e9:	c3                   	ret
+
+00000000008049ea <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  8049ea:	55                   	push   %rbp
+  8049eb:	48 89 e5             	mov    %rsp,%rbp
+  8049ee:	41 57                	push   %r15
+  8049f0:	41 55                	push   %r13
+  8049f2:	41 54                	push   %r12
+  8049f4:	53                   	push   %rbx
+  8049f5:	48 83 ec 60          	sub    $0x60,%rsp
+  8049f9:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 8049f9 <vprintfmt+0xf>
+  804a00:	49 bb 7f 06 01 00 00 	movabs $0x1067f,%r11
+  804a07:	00 00 00 
+  804a0a:	4d 01 dc             	add    %r11,%r12
+  804a0d:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  804a11:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  804a15:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804a19:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  804a1d:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  804a24:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  804a28:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  804a2c:	48 8b 06             	mov    (%rsi),%rax
+  804a2f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804a33:	48 89 01             	mov    %rax,(%rcx)
+  804a36:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804a3a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804a3e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804a42:	eb 17                	jmp    804a5b <vprintfmt+0x71>
+			if (ch == '\0')
+  804a44:	85 db                	test   %ebx,%ebx
+  804a46:	0f 84 97 05 00 00    	je     804fe3 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  804a4c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804a50:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804a54:	48 89 c6             	mov    %rax,%rsi
+  804a57:	89 df                	mov    %ebx,%edi
+  804a59:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804a5b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804a5f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804a63:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804a67:	0f b6 00             	movzbl (%rax),%eax
+  804a6a:	0f b6 d8             	movzbl %al,%ebx
+  804a6d:	83 fb 25             	cmp    $0x25,%ebx
+  804a70:	75 d2                	jne    804a44 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  804a72:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  804a76:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  804a7d:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  804a84:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  804a8b:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  804a92:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804a96:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804a9a:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804a9e:	0f b6 00             	movzbl (%rax),%eax
+  804aa1:	0f b6 d8             	movzbl %al,%ebx
+  804aa4:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  804aa7:	83 f8 55             	cmp    $0x55,%eax
+  804aaa:	0f 87 00 05 00 00    	ja     804fb0 <vprintfmt+0x5c6>
+  804ab0:	89 c0                	mov    %eax,%eax
+  804ab2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804ab9:	00 
+  804aba:	48 8d 05 17 5e 00 00 	lea    0x5e17(%rip),%rax        # 80a8d8 <.LC18+0xc>
+  804ac1:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  804ac5:	48 8d 15 0c 5e 00 00 	lea    0x5e0c(%rip),%rdx        # 80a8d8 <.LC18+0xc>
+  804acc:	48 01 d0             	add    %rdx,%rax
+  804acf:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  804ad1:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  804ad5:	eb bb                	jmp    804a92 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  804ad7:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  804adb:	eb b5                	jmp    804a92 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  804add:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  804ae4:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804ae7:	89 d0                	mov    %edx,%eax
+  804ae9:	c1 e0 02             	shl    $0x2,%eax
+  804aec:	01 d0                	add    %edx,%eax
+  804aee:	01 c0                	add    %eax,%eax
+  804af0:	01 d8                	add    %ebx,%eax
+  804af2:	83 e8 30             	sub    $0x30,%eax
+  804af5:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  804af8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804afc:	0f b6 00             	movzbl (%rax),%eax
+  804aff:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  804b02:	83 fb 2f             	cmp    $0x2f,%ebx
+  804b05:	7e 60                	jle    804b67 <vprintfmt+0x17d>
+  804b07:	83 fb 39             	cmp    $0x39,%ebx
+  804b0a:	7f 5b                	jg     804b67 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  804b0c:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  804b11:	eb d1                	jmp    804ae4 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  804b13:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804b16:	83 f8 2f             	cmp    $0x2f,%eax
+  804b19:	77 17                	ja     804b32 <vprintfmt+0x148>
+  804b1b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804b1f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804b22:	89 d2                	mov    %edx,%edx
+  804b24:	48 01 d0             	add    %rdx,%rax
+  804b27:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804b2a:	83 c2 08             	add    $0x8,%edx
+  804b2d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804b30:	eb 0c                	jmp    804b3e <vprintfmt+0x154>
+  804b32:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804b36:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804b3a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804b3e:	8b 00                	mov    (%rax),%eax
+  804b40:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  804b43:	eb 23                	jmp    804b68 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  804b45:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b49:	0f 89 43 ff ff ff    	jns    804a92 <vprintfmt+0xa8>
+				width = 0;
+  804b4f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  804b56:	e9 37 ff ff ff       	jmp    804a92 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  804b5b:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  804b62:	e9 2b ff ff ff       	jmp    804a92 <vprintfmt+0xa8>
+			goto process_precision;
+  804b67:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  804b68:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804b6c:	0f 89 20 ff ff ff    	jns    804a92 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  804b72:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804b75:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  804b78:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  804b7f:	e9 0e ff ff ff       	jmp    804a92 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  804b84:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  804b88:	e9 05 ff ff ff       	jmp    804a92 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  804b8d:	83 fb 39             	cmp    $0x39,%ebx
+  804b90:	7f 0b                	jg     804b9d <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  804b92:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  804b95:	c1 e0 08             	shl    $0x8,%eax
+  804b98:	01 45 bc             	add    %eax,-0x44(%rbp)
+  804b9b:	eb 21                	jmp    804bbe <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  804b9d:	83 fb 60             	cmp    $0x60,%ebx
+  804ba0:	7e 10                	jle    804bb2 <vprintfmt+0x1c8>
+  804ba2:	83 fb 66             	cmp    $0x66,%ebx
+  804ba5:	7f 0b                	jg     804bb2 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  804ba7:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  804baa:	c1 e0 08             	shl    $0x8,%eax
+  804bad:	01 45 bc             	add    %eax,-0x44(%rbp)
+  804bb0:	eb 0c                	jmp    804bbe <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  804bb2:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  804bb9:	e9 04 01 00 00       	jmp    804cc2 <vprintfmt+0x2d8>
+  804bbe:	e9 ff 00 00 00       	jmp    804cc2 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  804bc3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804bc6:	83 f8 2f             	cmp    $0x2f,%eax
+  804bc9:	77 17                	ja     804be2 <vprintfmt+0x1f8>
+  804bcb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804bcf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804bd2:	89 d2                	mov    %edx,%edx
+  804bd4:	48 01 d0             	add    %rdx,%rax
+  804bd7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804bda:	83 c2 08             	add    $0x8,%edx
+  804bdd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804be0:	eb 0c                	jmp    804bee <vprintfmt+0x204>
+  804be2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804be6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804bea:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804bee:	8b 00                	mov    (%rax),%eax
+  804bf0:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  804bf4:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  804bf8:	48 89 d6             	mov    %rdx,%rsi
+  804bfb:	89 c7                	mov    %eax,%edi
+  804bfd:	ff d1                	call   *%rcx
+			break;
+  804bff:	e9 da 03 00 00       	jmp    804fde <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  804c04:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804c07:	83 f8 2f             	cmp    $0x2f,%eax
+  804c0a:	77 17                	ja     804c23 <vprintfmt+0x239>
+  804c0c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c10:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804c13:	89 d2                	mov    %edx,%edx
+  804c15:	48 01 d0             	add    %rdx,%rax
+  804c18:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804c1b:	83 c2 08             	add    $0x8,%edx
+  804c1e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804c21:	eb 0c                	jmp    804c2f <vprintfmt+0x245>
+  804c23:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804c27:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804c2b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804c2f:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  804c31:	85 db                	test   %ebx,%ebx
+  804c33:	79 02                	jns    804c37 <vprintfmt+0x24d>
+				err = -err;
+  804c35:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  804c37:	83 fb 15             	cmp    $0x15,%ebx
+  804c3a:	7f 19                	jg     804c55 <vprintfmt+0x26b>
+  804c3c:	48 ba 88 01 00 00 00 	movabs $0x188,%rdx
+  804c43:	00 00 00 
+  804c46:	48 63 c3             	movslq %ebx,%rax
+  804c49:	4c 01 e2             	add    %r12,%rdx
+  804c4c:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  804c50:	4d 85 ed             	test   %r13,%r13
+  804c53:	75 36                	jne    804c8b <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  804c55:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804c59:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804c5d:	89 d9                	mov    %ebx,%ecx
+  804c5f:	48 ba 48 58 ff ff ff 	movabs $0xffffffffffff5848,%rdx
+  804c66:	ff ff ff 
+  804c69:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  804c6d:	48 89 c7             	mov    %rax,%rdi
+  804c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c75:	49 b8 79 ff fe ff ff 	movabs $0xfffffffffffeff79,%r8
+  804c7c:	ff ff ff 
+  804c7f:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  804c83:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  804c86:	e9 53 03 00 00       	jmp    804fde <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  804c8b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804c8f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804c93:	4c 89 e9             	mov    %r13,%rcx
+  804c96:	48 ba 51 58 ff ff ff 	movabs $0xffffffffffff5851,%rdx
+  804c9d:	ff ff ff 
+  804ca0:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  804ca4:	48 89 c7             	mov    %rax,%rdi
+  804ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cac:	49 b8 79 ff fe ff ff 	movabs $0xfffffffffffeff79,%r8
+  804cb3:	ff ff ff 
+  804cb6:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  804cba:	41 ff d0             	call   *%r8
+			break;
+  804cbd:	e9 1c 03 00 00       	jmp    804fde <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  804cc2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804cc5:	83 f8 2f             	cmp    $0x2f,%eax
+  804cc8:	77 17                	ja     804ce1 <vprintfmt+0x2f7>
+  804cca:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804cce:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804cd1:	89 d2                	mov    %edx,%edx
+  804cd3:	48 01 d0             	add    %rdx,%rax
+  804cd6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804cd9:	83 c2 08             	add    $0x8,%edx
+  804cdc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804cdf:	eb 0c                	jmp    804ced <vprintfmt+0x303>
+  804ce1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804ce5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804ce9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804ced:	4c 8b 28             	mov    (%rax),%r13
+  804cf0:	4d 85 ed             	test   %r13,%r13
+  804cf3:	75 0e                	jne    804d03 <vprintfmt+0x319>
+				p = "(null)";
+  804cf5:	48 b8 54 58 ff ff ff 	movabs $0xffffffffffff5854,%rax
+  804cfc:	ff ff ff 
+  804cff:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  804d03:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804d07:	0f 8e 84 00 00 00    	jle    804d91 <vprintfmt+0x3a7>
+  804d0d:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  804d11:	74 7e                	je     804d91 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  804d13:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804d16:	48 98                	cltq
+  804d18:	48 89 c6             	mov    %rax,%rsi
+  804d1b:	4c 89 ef             	mov    %r13,%rdi
+  804d1e:	4d 89 e7             	mov    %r12,%r15
+  804d21:	48 b8 9e 02 ff ff ff 	movabs $0xffffffffffff029e,%rax
+  804d28:	ff ff ff 
+  804d2b:	4c 01 e0             	add    %r12,%rax
+  804d2e:	ff d0                	call   *%rax
+  804d30:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  804d33:	eb 17                	jmp    804d4c <vprintfmt+0x362>
+					putch(padc, putdat);
+  804d35:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  804d39:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  804d3d:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  804d41:	48 89 d6             	mov    %rdx,%rsi
+  804d44:	89 c7                	mov    %eax,%edi
+  804d46:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  804d48:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  804d4c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804d50:	7f e3                	jg     804d35 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  804d52:	eb 3d                	jmp    804d91 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  804d54:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  804d58:	74 1e                	je     804d78 <vprintfmt+0x38e>
+  804d5a:	83 fb 1f             	cmp    $0x1f,%ebx
+  804d5d:	7e 05                	jle    804d64 <vprintfmt+0x37a>
+  804d5f:	83 fb 7e             	cmp    $0x7e,%ebx
+  804d62:	7e 14                	jle    804d78 <vprintfmt+0x38e>
+					putch('?', putdat);
+  804d64:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804d68:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804d6c:	48 89 c6             	mov    %rax,%rsi
+  804d6f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  804d74:	ff d2                	call   *%rdx
+  804d76:	eb 15                	jmp    804d8d <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  804d78:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804d7b:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  804d7e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804d82:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804d86:	48 89 c6             	mov    %rax,%rsi
+  804d89:	89 cf                	mov    %ecx,%edi
+  804d8b:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  804d8d:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  804d91:	4c 89 e8             	mov    %r13,%rax
+  804d94:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  804d98:	0f b6 00             	movzbl (%rax),%eax
+  804d9b:	0f be d8             	movsbl %al,%ebx
+  804d9e:	85 db                	test   %ebx,%ebx
+  804da0:	74 28                	je     804dca <vprintfmt+0x3e0>
+  804da2:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804da6:	78 ac                	js     804d54 <vprintfmt+0x36a>
+  804da8:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  804dac:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804db0:	79 a2                	jns    804d54 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  804db2:	eb 16                	jmp    804dca <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  804db4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804db8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804dbc:	48 89 c6             	mov    %rax,%rsi
+  804dbf:	bf 20 00 00 00       	mov    $0x20,%edi
+  804dc4:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  804dc6:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  804dca:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804dce:	7f e4                	jg     804db4 <vprintfmt+0x3ca>
+			break;
+  804dd0:	e9 09 02 00 00       	jmp    804fde <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  804dd5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804dd9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804ddd:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804de1:	0f b6 00             	movzbl (%rax),%eax
+  804de4:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  804de7:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  804de8:	83 fb 2f             	cmp    $0x2f,%ebx
+  804deb:	0f 8e ac fd ff ff    	jle    804b9d <vprintfmt+0x1b3>
+  804df1:	e9 97 fd ff ff       	jmp    804b8d <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  804df6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804dfa:	be 03 00 00 00       	mov    $0x3,%esi
+  804dff:	48 89 c7             	mov    %rax,%rdi
+  804e02:	48 b8 57 f8 fe ff ff 	movabs $0xfffffffffffef857,%rax
+  804e09:	ff ff ff 
+  804e0c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804e10:	ff d0                	call   *%rax
+  804e12:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  804e16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e1a:	48 85 c0             	test   %rax,%rax
+  804e1d:	79 1d                	jns    804e3c <vprintfmt+0x452>
+				putch('-', putdat);
+  804e1f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804e23:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804e27:	48 89 c6             	mov    %rax,%rsi
+  804e2a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  804e2f:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  804e31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e35:	48 f7 d8             	neg    %rax
+  804e38:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  804e3c:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  804e43:	e9 de 00 00 00       	jmp    804f26 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  804e48:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804e4c:	be 03 00 00 00       	mov    $0x3,%esi
+  804e51:	48 89 c7             	mov    %rax,%rdi
+  804e54:	48 b8 f6 f6 fe ff ff 	movabs $0xfffffffffffef6f6,%rax
+  804e5b:	ff ff ff 
+  804e5e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804e62:	ff d0                	call   *%rax
+  804e64:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  804e68:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  804e6f:	e9 b2 00 00 00       	jmp    804f26 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  804e74:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804e78:	be 03 00 00 00       	mov    $0x3,%esi
+  804e7d:	48 89 c7             	mov    %rax,%rdi
+  804e80:	48 b8 f6 f6 fe ff ff 	movabs $0xfffffffffffef6f6,%rax
+  804e87:	ff ff ff 
+  804e8a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804e8e:	ff d0                	call   *%rax
+  804e90:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  804e94:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  804e9b:	e9 86 00 00 00       	jmp    804f26 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  804ea0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804ea4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804ea8:	48 89 c6             	mov    %rax,%rsi
+  804eab:	bf 30 00 00 00       	mov    $0x30,%edi
+  804eb0:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  804eb2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804eb6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804eba:	48 89 c6             	mov    %rax,%rsi
+  804ebd:	bf 78 00 00 00       	mov    $0x78,%edi
+  804ec2:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  804ec4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804ec7:	83 f8 2f             	cmp    $0x2f,%eax
+  804eca:	77 17                	ja     804ee3 <vprintfmt+0x4f9>
+  804ecc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804ed0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804ed3:	89 d2                	mov    %edx,%edx
+  804ed5:	48 01 d0             	add    %rdx,%rax
+  804ed8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804edb:	83 c2 08             	add    $0x8,%edx
+  804ede:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804ee1:	eb 0c                	jmp    804eef <vprintfmt+0x505>
+  804ee3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804ee7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804eeb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804eef:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  804ef2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  804ef6:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  804efd:	eb 27                	jmp    804f26 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  804eff:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804f03:	be 03 00 00 00       	mov    $0x3,%esi
+  804f08:	48 89 c7             	mov    %rax,%rdi
+  804f0b:	48 b8 f6 f6 fe ff ff 	movabs $0xfffffffffffef6f6,%rax
+  804f12:	ff ff ff 
+  804f15:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804f19:	ff d0                	call   *%rax
+  804f1b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  804f1f:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  804f26:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  804f2b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804f2e:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  804f31:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804f35:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804f39:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f3d:	45 89 c1             	mov    %r8d,%r9d
+  804f40:	41 89 f8             	mov    %edi,%r8d
+  804f43:	48 89 c7             	mov    %rax,%rdi
+  804f46:	48 b8 1e f6 fe ff ff 	movabs $0xfffffffffffef61e,%rax
+  804f4d:	ff ff ff 
+  804f50:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804f54:	ff d0                	call   *%rax
+			break;
+  804f56:	e9 83 00 00 00       	jmp    804fde <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  804f5b:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804f5f:	be 03 00 00 00       	mov    $0x3,%esi
+  804f64:	48 89 c7             	mov    %rax,%rdi
+  804f67:	48 b8 f6 f6 fe ff ff 	movabs $0xfffffffffffef6f6,%rax
+  804f6e:	ff ff ff 
+  804f71:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804f75:	ff d0                	call   *%rax
+  804f77:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  804f7b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804f7f:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  804f83:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f87:	48 89 ce             	mov    %rcx,%rsi
+  804f8a:	48 89 c7             	mov    %rax,%rdi
+  804f8d:	48 b8 11 f8 fe ff ff 	movabs $0xfffffffffffef811,%rax
+  804f94:	ff ff ff 
+  804f97:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804f9b:	ff d0                	call   *%rax
+	
+			break;
+  804f9d:	eb 3f                	jmp    804fde <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  804f9f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804fa3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804fa7:	48 89 c6             	mov    %rax,%rsi
+  804faa:	89 df                	mov    %ebx,%edi
+  804fac:	ff d2                	call   *%rdx
+			break;
+  804fae:	eb 2e                	jmp    804fde <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  804fb0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804fb4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804fb8:	48 89 c6             	mov    %rax,%rsi
+  804fbb:	bf 25 00 00 00       	mov    $0x25,%edi
+  804fc0:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  804fc2:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  804fc7:	eb 05                	jmp    804fce <vprintfmt+0x5e4>
+  804fc9:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  804fce:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804fd2:	48 83 e8 01          	sub    $0x1,%rax
+  804fd6:	0f b6 00             	movzbl (%rax),%eax
+  804fd9:	3c 25                	cmp    $0x25,%al
+  804fdb:	75 ec                	jne    804fc9 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  804fdd:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804fde:	e9 78 fa ff ff       	jmp    804a5b <vprintfmt+0x71>
+				return;
+  804fe3:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  804fe4:	48 83 c4 60          	add    $0x60,%rsp
+  804fe8:	5b                   	pop    %rbx
+  804fe9:	41 5c                	pop    %r12
+  804feb:	41 5d                	pop    %r13
+  804fed:	41 5f                	pop    %r15
+  804fef:	5d                   	pop    %rbp
+  804ff0:	c3                   	ret
+
+0000000000804ff1 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  804ff1:	55                   	push   %rbp
+  804ff2:	48 89 e5             	mov    %rsp,%rbp
+  804ff5:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  804ffc:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804ffc <printfmt+0xb>
+  805003:	49 bb 7c 00 01 00 00 	movabs $0x1007c,%r11
+  80500a:	00 00 00 
+  80500d:	4d 01 da             	add    %r11,%r10
+  805010:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  805017:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80501e:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  805025:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80502c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  805033:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80503a:	84 c0                	test   %al,%al
+  80503c:	74 20                	je     80505e <printfmt+0x6d>
+  80503e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  805042:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  805046:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80504a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80504e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  805052:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  805056:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80505a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80505e:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  805065:	00 00 00 
+  805068:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80506f:	00 00 00 
+  805072:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805076:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80507d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  805084:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80508b:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  805092:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  805099:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8050a0:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8050a7:	48 89 c7             	mov    %rax,%rdi
+  8050aa:	48 b8 72 f9 fe ff ff 	movabs $0xfffffffffffef972,%rax
+  8050b1:	ff ff ff 
+  8050b4:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8050b8:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8050ba:	90                   	nop
+  8050bb:	c9                   	leave
+  8050bc:	c3                   	ret
+
+00000000008050bd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8050bd:	55                   	push   %rbp
+  8050be:	48 89 e5             	mov    %rsp,%rbp
+  8050c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8050c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050c5 <sprintputch+0x8>
+  8050cc:	49 bb b3 ff 00 00 00 	movabs $0xffb3,%r11
+  8050d3:	00 00 00 
+  8050d6:	4c 01 d8             	add    %r11,%rax
+  8050d9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8050dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8050e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050e4:	8b 40 10             	mov    0x10(%rax),%eax
+  8050e7:	8d 50 01             	lea    0x1(%rax),%edx
+  8050ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050ee:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8050f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050f5:	48 8b 10             	mov    (%rax),%rdx
+  8050f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050fc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805100:	48 39 c2             	cmp    %rax,%rdx
+  805103:	73 17                	jae    80511c <sprintputch+0x5f>
+		*b->buf++ = ch;
+  805105:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805109:	48 8b 00             	mov    (%rax),%rax
+  80510c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  805110:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805114:	48 89 0a             	mov    %rcx,(%rdx)
+  805117:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80511a:	88 10                	mov    %dl,(%rax)
+}
+  80511c:	90                   	nop
+  80511d:	c9                   	leave
+  80511e:	c3                   	ret
+
+000000000080511f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80511f:	55                   	push   %rbp
+  805120:	48 89 e5             	mov    %rsp,%rbp
+  805123:	53                   	push   %rbx
+  805124:	48 83 ec 58          	sub    $0x58,%rsp
+  805128:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805128 <vsnprintf+0x9>
+  80512f:	49 bb 50 ff 00 00 00 	movabs $0xff50,%r11
+  805136:	00 00 00 
+  805139:	4c 01 d8             	add    %r11,%rax
+  80513c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  805140:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  805143:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  805147:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80514b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80514f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  805153:	48 8b 0e             	mov    (%rsi),%rcx
+  805156:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80515a:	48 89 0a             	mov    %rcx,(%rdx)
+  80515d:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  805161:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  805165:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  805169:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80516d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805171:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  805174:	48 63 d2             	movslq %edx,%rdx
+  805177:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80517b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80517f:	48 01 ca             	add    %rcx,%rdx
+  805182:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  805186:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80518d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805192:	74 06                	je     80519a <vsnprintf+0x7b>
+  805194:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  805198:	7f 07                	jg     8051a1 <vsnprintf+0x82>
+		return -E_INVAL;
+  80519a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80519f:	eb 34                	jmp    8051d5 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8051a1:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8051a5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8051a9:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8051ad:	48 bf 45 00 ff ff ff 	movabs $0xffffffffffff0045,%rdi
+  8051b4:	ff ff ff 
+  8051b7:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8051bb:	49 b8 72 f9 fe ff ff 	movabs $0xfffffffffffef972,%r8
+  8051c2:	ff ff ff 
+  8051c5:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8051c9:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8051cb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8051cf:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8051d2:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8051d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8051d9:	c9                   	leave
+  8051da:	c3                   	ret
+
+00000000008051db <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8051db:	55                   	push   %rbp
+  8051dc:	48 89 e5             	mov    %rsp,%rbp
+  8051df:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8051e6:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8051e6 <snprintf+0xb>
+  8051ed:	49 bb 92 fe 00 00 00 	movabs $0xfe92,%r11
+  8051f4:	00 00 00 
+  8051f7:	4d 01 da             	add    %r11,%r10
+  8051fa:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  805201:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  805207:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80520e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  805215:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80521c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  805223:	84 c0                	test   %al,%al
+  805225:	74 20                	je     805247 <snprintf+0x6c>
+  805227:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80522b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80522f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  805233:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  805237:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80523b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80523f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  805243:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  805247:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80524e:	00 00 00 
+  805251:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  805258:	00 00 00 
+  80525b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80525f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  805266:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80526d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  805274:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80527b:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  805282:	48 8b 06             	mov    (%rsi),%rax
+  805285:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  805289:	48 89 01             	mov    %rax,(%rcx)
+  80528c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  805290:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  805294:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  805298:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80529f:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8052a6:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8052ac:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8052b3:	48 89 c7             	mov    %rax,%rdi
+  8052b6:	48 b8 a7 00 ff ff ff 	movabs $0xffffffffffff00a7,%rax
+  8052bd:	ff ff ff 
+  8052c0:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8052c4:	ff d0                	call   *%rax
+  8052c6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8052cc:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8052d2:	c9                   	leave
+  8052d3:	c3                   	ret
+
+00000000008052d4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8052d4:	55                   	push   %rbp
+  8052d5:	48 89 e5             	mov    %rsp,%rbp
+  8052d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8052dc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8052dc <strlen+0x8>
+  8052e3:	49 bb 9c fd 00 00 00 	movabs $0xfd9c,%r11
+  8052ea:	00 00 00 
+  8052ed:	4c 01 d8             	add    %r11,%rax
+  8052f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8052f4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8052fb:	eb 09                	jmp    805306 <strlen+0x32>
+		n++;
+  8052fd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  805301:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805306:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80530a:	0f b6 00             	movzbl (%rax),%eax
+  80530d:	84 c0                	test   %al,%al
+  80530f:	75 ec                	jne    8052fd <strlen+0x29>
+	return n;
+  805311:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805314:	c9                   	leave
+  805315:	c3                   	ret
+
+0000000000805316 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  805316:	55                   	push   %rbp
+  805317:	48 89 e5             	mov    %rsp,%rbp
+  80531a:	48 83 ec 20          	sub    $0x20,%rsp
+  80531e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80531e <strnlen+0x8>
+  805325:	49 bb 5a fd 00 00 00 	movabs $0xfd5a,%r11
+  80532c:	00 00 00 
+  80532f:	4c 01 d8             	add    %r11,%rax
+  805332:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805336:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80533a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805341:	eb 0e                	jmp    805351 <strnlen+0x3b>
+		n++;
+  805343:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  805347:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80534c:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  805351:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805356:	74 0b                	je     805363 <strnlen+0x4d>
+  805358:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80535c:	0f b6 00             	movzbl (%rax),%eax
+  80535f:	84 c0                	test   %al,%al
+  805361:	75 e0                	jne    805343 <strnlen+0x2d>
+	return n;
+  805363:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805366:	c9                   	leave
+  805367:	c3                   	ret
+
+0000000000805368 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  805368:	55                   	push   %rbp
+  805369:	48 89 e5             	mov    %rsp,%rbp
+  80536c:	48 83 ec 20          	sub    $0x20,%rsp
+  805370:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805370 <strcpy+0x8>
+  805377:	49 bb 08 fd 00 00 00 	movabs $0xfd08,%r11
+  80537e:	00 00 00 
+  805381:	4c 01 d8             	add    %r11,%rax
+  805384:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805388:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80538c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805390:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  805394:	90                   	nop
+  805395:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805399:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80539d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8053a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053a5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8053a9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8053ad:	0f b6 12             	movzbl (%rdx),%edx
+  8053b0:	88 10                	mov    %dl,(%rax)
+  8053b2:	0f b6 00             	movzbl (%rax),%eax
+  8053b5:	84 c0                	test   %al,%al
+  8053b7:	75 dc                	jne    805395 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8053b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8053bd:	c9                   	leave
+  8053be:	c3                   	ret
+
+00000000008053bf <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8053bf:	55                   	push   %rbp
+  8053c0:	48 89 e5             	mov    %rsp,%rbp
+  8053c3:	53                   	push   %rbx
+  8053c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8053c8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053c8 <strcat+0x9>
+  8053cf:	49 bb b0 fc 00 00 00 	movabs $0xfcb0,%r11
+  8053d6:	00 00 00 
+  8053d9:	4c 01 db             	add    %r11,%rbx
+  8053dc:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8053e0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8053e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053e8:	48 89 c7             	mov    %rax,%rdi
+  8053eb:	48 b8 5c 02 ff ff ff 	movabs $0xffffffffffff025c,%rax
+  8053f2:	ff ff ff 
+  8053f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053f9:	ff d0                	call   *%rax
+  8053fb:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8053fe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805401:	48 63 d0             	movslq %eax,%rdx
+  805404:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805408:	48 01 c2             	add    %rax,%rdx
+  80540b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80540f:	48 89 c6             	mov    %rax,%rsi
+  805412:	48 89 d7             	mov    %rdx,%rdi
+  805415:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  80541c:	ff ff ff 
+  80541f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805423:	ff d0                	call   *%rax
+	return dst;
+  805425:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  805429:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80542d:	c9                   	leave
+  80542e:	c3                   	ret
+
+000000000080542f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80542f:	55                   	push   %rbp
+  805430:	48 89 e5             	mov    %rsp,%rbp
+  805433:	48 83 ec 28          	sub    $0x28,%rsp
+  805437:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805437 <strncpy+0x8>
+  80543e:	49 bb 41 fc 00 00 00 	movabs $0xfc41,%r11
+  805445:	00 00 00 
+  805448:	4c 01 d8             	add    %r11,%rax
+  80544b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80544f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805453:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  805457:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80545b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80545f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  805466:	00 
+  805467:	eb 2a                	jmp    805493 <strncpy+0x64>
+		*dst++ = *src;
+  805469:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80546d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  805471:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  805475:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805479:	0f b6 12             	movzbl (%rdx),%edx
+  80547c:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80547e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805482:	0f b6 00             	movzbl (%rax),%eax
+  805485:	84 c0                	test   %al,%al
+  805487:	74 05                	je     80548e <strncpy+0x5f>
+			src++;
+  805489:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80548e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  805493:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805497:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80549b:	72 cc                	jb     805469 <strncpy+0x3a>
+	}
+	return ret;
+  80549d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8054a1:	c9                   	leave
+  8054a2:	c3                   	ret
+
+00000000008054a3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8054a3:	55                   	push   %rbp
+  8054a4:	48 89 e5             	mov    %rsp,%rbp
+  8054a7:	48 83 ec 28          	sub    $0x28,%rsp
+  8054ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054ab <strlcpy+0x8>
+  8054b2:	49 bb cd fb 00 00 00 	movabs $0xfbcd,%r11
+  8054b9:	00 00 00 
+  8054bc:	4c 01 d8             	add    %r11,%rax
+  8054bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8054c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8054c7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8054cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054cf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8054d3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8054d8:	74 3d                	je     805517 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8054da:	eb 1d                	jmp    8054f9 <strlcpy+0x56>
+			*dst++ = *src++;
+  8054dc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8054e0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8054e4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8054e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054ec:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8054f0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8054f4:	0f b6 12             	movzbl (%rdx),%edx
+  8054f7:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8054f9:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8054fe:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805503:	74 0b                	je     805510 <strlcpy+0x6d>
+  805505:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805509:	0f b6 00             	movzbl (%rax),%eax
+  80550c:	84 c0                	test   %al,%al
+  80550e:	75 cc                	jne    8054dc <strlcpy+0x39>
+		*dst = '\0';
+  805510:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805514:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  805517:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80551b:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80551f:	c9                   	leave
+  805520:	c3                   	ret
+
+0000000000805521 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  805521:	55                   	push   %rbp
+  805522:	48 89 e5             	mov    %rsp,%rbp
+  805525:	48 83 ec 10          	sub    $0x10,%rsp
+  805529:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805529 <strcmp+0x8>
+  805530:	49 bb 4f fb 00 00 00 	movabs $0xfb4f,%r11
+  805537:	00 00 00 
+  80553a:	4c 01 d8             	add    %r11,%rax
+  80553d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805541:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  805545:	eb 0a                	jmp    805551 <strcmp+0x30>
+		p++, q++;
+  805547:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80554c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  805551:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805555:	0f b6 00             	movzbl (%rax),%eax
+  805558:	84 c0                	test   %al,%al
+  80555a:	74 12                	je     80556e <strcmp+0x4d>
+  80555c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805560:	0f b6 10             	movzbl (%rax),%edx
+  805563:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805567:	0f b6 00             	movzbl (%rax),%eax
+  80556a:	38 c2                	cmp    %al,%dl
+  80556c:	74 d9                	je     805547 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80556e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805572:	0f b6 00             	movzbl (%rax),%eax
+  805575:	0f b6 d0             	movzbl %al,%edx
+  805578:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80557c:	0f b6 00             	movzbl (%rax),%eax
+  80557f:	0f b6 c0             	movzbl %al,%eax
+  805582:	29 c2                	sub    %eax,%edx
+  805584:	89 d0                	mov    %edx,%eax
+}
+  805586:	c9                   	leave
+  805587:	c3                   	ret
+
+0000000000805588 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  805588:	55                   	push   %rbp
+  805589:	48 89 e5             	mov    %rsp,%rbp
+  80558c:	48 83 ec 18          	sub    $0x18,%rsp
+  805590:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805590 <strncmp+0x8>
+  805597:	49 bb e8 fa 00 00 00 	movabs $0xfae8,%r11
+  80559e:	00 00 00 
+  8055a1:	4c 01 d8             	add    %r11,%rax
+  8055a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8055a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8055ac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8055b0:	eb 0f                	jmp    8055c1 <strncmp+0x39>
+		n--, p++, q++;
+  8055b2:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8055b7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8055bc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8055c1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8055c6:	74 1d                	je     8055e5 <strncmp+0x5d>
+  8055c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055cc:	0f b6 00             	movzbl (%rax),%eax
+  8055cf:	84 c0                	test   %al,%al
+  8055d1:	74 12                	je     8055e5 <strncmp+0x5d>
+  8055d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055d7:	0f b6 10             	movzbl (%rax),%edx
+  8055da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055de:	0f b6 00             	movzbl (%rax),%eax
+  8055e1:	38 c2                	cmp    %al,%dl
+  8055e3:	74 cd                	je     8055b2 <strncmp+0x2a>
+	if (n == 0)
+  8055e5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8055ea:	75 07                	jne    8055f3 <strncmp+0x6b>
+		return 0;
+  8055ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055f1:	eb 16                	jmp    805609 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8055f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055f7:	0f b6 00             	movzbl (%rax),%eax
+  8055fa:	0f b6 d0             	movzbl %al,%edx
+  8055fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805601:	0f b6 00             	movzbl (%rax),%eax
+  805604:	0f b6 c0             	movzbl %al,%eax
+  805607:	29 c2                	sub    %eax,%edx
+}
+  805609:	89 d0                	mov    %edx,%eax
+  80560b:	c9                   	leave
+  80560c:	c3                   	ret
+
+000000000080560d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80560d:	55                   	push   %rbp
+  80560e:	48 89 e5             	mov    %rsp,%rbp
+  805611:	48 83 ec 10          	sub    $0x10,%rsp
+  805615:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805615 <strchr+0x8>
+  80561c:	49 bb 63 fa 00 00 00 	movabs $0xfa63,%r11
+  805623:	00 00 00 
+  805626:	4c 01 d8             	add    %r11,%rax
+  805629:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80562d:	89 f0                	mov    %esi,%eax
+  80562f:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  805632:	eb 17                	jmp    80564b <strchr+0x3e>
+		if (*s == c)
+  805634:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805638:	0f b6 00             	movzbl (%rax),%eax
+  80563b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80563e:	75 06                	jne    805646 <strchr+0x39>
+			return (char *) s;
+  805640:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805644:	eb 15                	jmp    80565b <strchr+0x4e>
+	for (; *s; s++)
+  805646:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80564b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80564f:	0f b6 00             	movzbl (%rax),%eax
+  805652:	84 c0                	test   %al,%al
+  805654:	75 de                	jne    805634 <strchr+0x27>
+	return 0;
+  805656:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80565b:	c9                   	leave
+  80565c:	c3                   	ret
+
+000000000080565d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80565d:	55                   	push   %rbp
+  80565e:	48 89 e5             	mov    %rsp,%rbp
+  805661:	48 83 ec 10          	sub    $0x10,%rsp
+  805665:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805665 <strfind+0x8>
+  80566c:	49 bb 13 fa 00 00 00 	movabs $0xfa13,%r11
+  805673:	00 00 00 
+  805676:	4c 01 d8             	add    %r11,%rax
+  805679:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80567d:	89 f0                	mov    %esi,%eax
+  80567f:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  805682:	eb 11                	jmp    805695 <strfind+0x38>
+		if (*s == c)
+  805684:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805688:	0f b6 00             	movzbl (%rax),%eax
+  80568b:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80568e:	74 12                	je     8056a2 <strfind+0x45>
+	for (; *s; s++)
+  805690:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  805695:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805699:	0f b6 00             	movzbl (%rax),%eax
+  80569c:	84 c0                	test   %al,%al
+  80569e:	75 e4                	jne    805684 <strfind+0x27>
+  8056a0:	eb 01                	jmp    8056a3 <strfind+0x46>
+			break;
+  8056a2:	90                   	nop
+	return (char *) s;
+  8056a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8056a7:	c9                   	leave
+  8056a8:	c3                   	ret
+
+00000000008056a9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8056a9:	55                   	push   %rbp
+  8056aa:	48 89 e5             	mov    %rsp,%rbp
+  8056ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8056b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8056b1 <memset+0x8>
+  8056b8:	49 bb c7 f9 00 00 00 	movabs $0xf9c7,%r11
+  8056bf:	00 00 00 
+  8056c2:	4c 01 d8             	add    %r11,%rax
+  8056c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8056c9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8056cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8056d0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8056d5:	75 06                	jne    8056dd <memset+0x34>
+		return v;
+  8056d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056db:	eb 69                	jmp    805746 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8056dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056e1:	83 e0 03             	and    $0x3,%eax
+  8056e4:	48 85 c0             	test   %rax,%rax
+  8056e7:	75 48                	jne    805731 <memset+0x88>
+  8056e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056ed:	83 e0 03             	and    $0x3,%eax
+  8056f0:	48 85 c0             	test   %rax,%rax
+  8056f3:	75 3c                	jne    805731 <memset+0x88>
+		c &= 0xFF;
+  8056f5:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8056fc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8056ff:	c1 e0 18             	shl    $0x18,%eax
+  805702:	89 c2                	mov    %eax,%edx
+  805704:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805707:	c1 e0 10             	shl    $0x10,%eax
+  80570a:	09 c2                	or     %eax,%edx
+  80570c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80570f:	c1 e0 08             	shl    $0x8,%eax
+  805712:	09 d0                	or     %edx,%eax
+  805714:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  805717:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80571b:	48 c1 e8 02          	shr    $0x2,%rax
+  80571f:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  805722:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805726:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805729:	48 89 d7             	mov    %rdx,%rdi
+  80572c:	fc                   	cld
+  80572d:	f3 ab                	rep stos %eax,%es:(%rdi)
+  80572f:	eb 11                	jmp    805742 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  805731:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805735:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805738:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80573c:	48 89 d7             	mov    %rdx,%rdi
+  80573f:	fc                   	cld
+  805740:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  805742:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805746:	c9                   	leave
+  805747:	c3                   	ret
+
+0000000000805748 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  805748:	55                   	push   %rbp
+  805749:	48 89 e5             	mov    %rsp,%rbp
+  80574c:	48 83 ec 28          	sub    $0x28,%rsp
+  805750:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805750 <memmove+0x8>
+  805757:	49 bb 28 f9 00 00 00 	movabs $0xf928,%r11
+  80575e:	00 00 00 
+  805761:	4c 01 d8             	add    %r11,%rax
+  805764:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805768:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80576c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  805770:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805774:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  805778:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80577c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  805780:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805784:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805788:	0f 83 88 00 00 00    	jae    805816 <memmove+0xce>
+  80578e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805792:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805796:	48 01 d0             	add    %rdx,%rax
+  805799:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80579d:	73 77                	jae    805816 <memmove+0xce>
+		s += n;
+  80579f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057a3:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8057a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057ab:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8057af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057b3:	83 e0 03             	and    $0x3,%eax
+  8057b6:	48 85 c0             	test   %rax,%rax
+  8057b9:	75 3b                	jne    8057f6 <memmove+0xae>
+  8057bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057bf:	83 e0 03             	and    $0x3,%eax
+  8057c2:	48 85 c0             	test   %rax,%rax
+  8057c5:	75 2f                	jne    8057f6 <memmove+0xae>
+  8057c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057cb:	83 e0 03             	and    $0x3,%eax
+  8057ce:	48 85 c0             	test   %rax,%rax
+  8057d1:	75 23                	jne    8057f6 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8057d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057d7:	48 83 e8 04          	sub    $0x4,%rax
+  8057db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8057df:	48 83 ea 04          	sub    $0x4,%rdx
+  8057e3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8057e7:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8057eb:	48 89 c7             	mov    %rax,%rdi
+  8057ee:	48 89 d6             	mov    %rdx,%rsi
+  8057f1:	fd                   	std
+  8057f2:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8057f4:	eb 1d                	jmp    805813 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8057f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057fa:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8057fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805802:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  805806:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80580a:	48 89 d7             	mov    %rdx,%rdi
+  80580d:	48 89 c1             	mov    %rax,%rcx
+  805810:	fd                   	std
+  805811:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  805813:	fc                   	cld
+  805814:	eb 57                	jmp    80586d <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  805816:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80581a:	83 e0 03             	and    $0x3,%eax
+  80581d:	48 85 c0             	test   %rax,%rax
+  805820:	75 36                	jne    805858 <memmove+0x110>
+  805822:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805826:	83 e0 03             	and    $0x3,%eax
+  805829:	48 85 c0             	test   %rax,%rax
+  80582c:	75 2a                	jne    805858 <memmove+0x110>
+  80582e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805832:	83 e0 03             	and    $0x3,%eax
+  805835:	48 85 c0             	test   %rax,%rax
+  805838:	75 1e                	jne    805858 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80583a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80583e:	48 c1 e8 02          	shr    $0x2,%rax
+  805842:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  805845:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805849:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80584d:	48 89 c7             	mov    %rax,%rdi
+  805850:	48 89 d6             	mov    %rdx,%rsi
+  805853:	fc                   	cld
+  805854:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  805856:	eb 15                	jmp    80586d <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  805858:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80585c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805860:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805864:	48 89 c7             	mov    %rax,%rdi
+  805867:	48 89 d6             	mov    %rdx,%rsi
+  80586a:	fc                   	cld
+  80586b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  80586d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805871:	c9                   	leave
+  805872:	c3                   	ret
+
+0000000000805873 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  805873:	55                   	push   %rbp
+  805874:	48 89 e5             	mov    %rsp,%rbp
+  805877:	48 83 ec 18          	sub    $0x18,%rsp
+  80587b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80587b <memcpy+0x8>
+  805882:	49 bb fd f7 00 00 00 	movabs $0xf7fd,%r11
+  805889:	00 00 00 
+  80588c:	4c 01 d8             	add    %r11,%rax
+  80588f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805893:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805897:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  80589b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80589f:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8058a3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8058a7:	48 89 cf             	mov    %rcx,%rdi
+  8058aa:	48 b9 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rcx
+  8058b1:	ff ff ff 
+  8058b4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8058b8:	ff d0                	call   *%rax
+}
+  8058ba:	c9                   	leave
+  8058bb:	c3                   	ret
+
+00000000008058bc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8058bc:	55                   	push   %rbp
+  8058bd:	48 89 e5             	mov    %rsp,%rbp
+  8058c0:	48 83 ec 28          	sub    $0x28,%rsp
+  8058c4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8058c4 <memcmp+0x8>
+  8058cb:	49 bb b4 f7 00 00 00 	movabs $0xf7b4,%r11
+  8058d2:	00 00 00 
+  8058d5:	4c 01 d8             	add    %r11,%rax
+  8058d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8058dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8058e0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  8058e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  8058ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  8058f4:	eb 34                	jmp    80592a <memcmp+0x6e>
+		if (*s1 != *s2)
+  8058f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058fa:	0f b6 10             	movzbl (%rax),%edx
+  8058fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805901:	0f b6 00             	movzbl (%rax),%eax
+  805904:	38 c2                	cmp    %al,%dl
+  805906:	74 18                	je     805920 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  805908:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80590c:	0f b6 00             	movzbl (%rax),%eax
+  80590f:	0f b6 d0             	movzbl %al,%edx
+  805912:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805916:	0f b6 00             	movzbl (%rax),%eax
+  805919:	0f b6 c0             	movzbl %al,%eax
+  80591c:	29 c2                	sub    %eax,%edx
+  80591e:	eb 20                	jmp    805940 <memcmp+0x84>
+		s1++, s2++;
+  805920:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  805925:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  80592a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80592e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805932:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805936:	48 85 c0             	test   %rax,%rax
+  805939:	75 bb                	jne    8058f6 <memcmp+0x3a>
+	}
+
+	return 0;
+  80593b:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  805940:	89 d0                	mov    %edx,%eax
+  805942:	c9                   	leave
+  805943:	c3                   	ret
+
+0000000000805944 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  805944:	55                   	push   %rbp
+  805945:	48 89 e5             	mov    %rsp,%rbp
+  805948:	48 83 ec 28          	sub    $0x28,%rsp
+  80594c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80594c <memfind+0x8>
+  805953:	49 bb 2c f7 00 00 00 	movabs $0xf72c,%r11
+  80595a:	00 00 00 
+  80595d:	4c 01 d8             	add    %r11,%rax
+  805960:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805964:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805967:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  80596b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80596f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805973:	48 01 d0             	add    %rdx,%rax
+  805976:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80597a:	eb 13                	jmp    80598f <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80597c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805980:	0f b6 00             	movzbl (%rax),%eax
+  805983:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805986:	38 d0                	cmp    %dl,%al
+  805988:	74 11                	je     80599b <memfind+0x57>
+	for (; s < ends; s++)
+  80598a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80598f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805993:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805997:	72 e3                	jb     80597c <memfind+0x38>
+  805999:	eb 01                	jmp    80599c <memfind+0x58>
+			break;
+  80599b:	90                   	nop
+	return (void *) s;
+  80599c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8059a0:	c9                   	leave
+  8059a1:	c3                   	ret
+
+00000000008059a2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8059a2:	55                   	push   %rbp
+  8059a3:	48 89 e5             	mov    %rsp,%rbp
+  8059a6:	48 83 ec 38          	sub    $0x38,%rsp
+  8059aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8059aa <strtol+0x8>
+  8059b1:	49 bb ce f6 00 00 00 	movabs $0xf6ce,%r11
+  8059b8:	00 00 00 
+  8059bb:	4c 01 d8             	add    %r11,%rax
+  8059be:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8059c2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8059c6:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8059c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8059d0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8059d7:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8059d8:	eb 05                	jmp    8059df <strtol+0x3d>
+		s++;
+  8059da:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8059df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059e3:	0f b6 00             	movzbl (%rax),%eax
+  8059e6:	3c 20                	cmp    $0x20,%al
+  8059e8:	74 f0                	je     8059da <strtol+0x38>
+  8059ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059ee:	0f b6 00             	movzbl (%rax),%eax
+  8059f1:	3c 09                	cmp    $0x9,%al
+  8059f3:	74 e5                	je     8059da <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  8059f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059f9:	0f b6 00             	movzbl (%rax),%eax
+  8059fc:	3c 2b                	cmp    $0x2b,%al
+  8059fe:	75 07                	jne    805a07 <strtol+0x65>
+		s++;
+  805a00:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  805a05:	eb 17                	jmp    805a1e <strtol+0x7c>
+	else if (*s == '-')
+  805a07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a0b:	0f b6 00             	movzbl (%rax),%eax
+  805a0e:	3c 2d                	cmp    $0x2d,%al
+  805a10:	75 0c                	jne    805a1e <strtol+0x7c>
+		s++, neg = 1;
+  805a12:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  805a17:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  805a1e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  805a22:	74 06                	je     805a2a <strtol+0x88>
+  805a24:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  805a28:	75 28                	jne    805a52 <strtol+0xb0>
+  805a2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a2e:	0f b6 00             	movzbl (%rax),%eax
+  805a31:	3c 30                	cmp    $0x30,%al
+  805a33:	75 1d                	jne    805a52 <strtol+0xb0>
+  805a35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a39:	48 83 c0 01          	add    $0x1,%rax
+  805a3d:	0f b6 00             	movzbl (%rax),%eax
+  805a40:	3c 78                	cmp    $0x78,%al
+  805a42:	75 0e                	jne    805a52 <strtol+0xb0>
+		s += 2, base = 16;
+  805a44:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  805a49:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  805a50:	eb 2c                	jmp    805a7e <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  805a52:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  805a56:	75 19                	jne    805a71 <strtol+0xcf>
+  805a58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a5c:	0f b6 00             	movzbl (%rax),%eax
+  805a5f:	3c 30                	cmp    $0x30,%al
+  805a61:	75 0e                	jne    805a71 <strtol+0xcf>
+		s++, base = 8;
+  805a63:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  805a68:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  805a6f:	eb 0d                	jmp    805a7e <strtol+0xdc>
+	else if (base == 0)
+  805a71:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  805a75:	75 07                	jne    805a7e <strtol+0xdc>
+		base = 10;
+  805a77:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  805a7e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a82:	0f b6 00             	movzbl (%rax),%eax
+  805a85:	3c 2f                	cmp    $0x2f,%al
+  805a87:	7e 1d                	jle    805aa6 <strtol+0x104>
+  805a89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a8d:	0f b6 00             	movzbl (%rax),%eax
+  805a90:	3c 39                	cmp    $0x39,%al
+  805a92:	7f 12                	jg     805aa6 <strtol+0x104>
+			dig = *s - '0';
+  805a94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a98:	0f b6 00             	movzbl (%rax),%eax
+  805a9b:	0f be c0             	movsbl %al,%eax
+  805a9e:	83 e8 30             	sub    $0x30,%eax
+  805aa1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805aa4:	eb 4e                	jmp    805af4 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  805aa6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805aaa:	0f b6 00             	movzbl (%rax),%eax
+  805aad:	3c 60                	cmp    $0x60,%al
+  805aaf:	7e 1d                	jle    805ace <strtol+0x12c>
+  805ab1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ab5:	0f b6 00             	movzbl (%rax),%eax
+  805ab8:	3c 7a                	cmp    $0x7a,%al
+  805aba:	7f 12                	jg     805ace <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  805abc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ac0:	0f b6 00             	movzbl (%rax),%eax
+  805ac3:	0f be c0             	movsbl %al,%eax
+  805ac6:	83 e8 57             	sub    $0x57,%eax
+  805ac9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805acc:	eb 26                	jmp    805af4 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  805ace:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ad2:	0f b6 00             	movzbl (%rax),%eax
+  805ad5:	3c 40                	cmp    $0x40,%al
+  805ad7:	7e 47                	jle    805b20 <strtol+0x17e>
+  805ad9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805add:	0f b6 00             	movzbl (%rax),%eax
+  805ae0:	3c 5a                	cmp    $0x5a,%al
+  805ae2:	7f 3c                	jg     805b20 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  805ae4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ae8:	0f b6 00             	movzbl (%rax),%eax
+  805aeb:	0f be c0             	movsbl %al,%eax
+  805aee:	83 e8 37             	sub    $0x37,%eax
+  805af1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  805af4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805af7:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  805afa:	7d 23                	jge    805b1f <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  805afc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  805b01:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805b04:	48 98                	cltq
+  805b06:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  805b0b:	48 89 c2             	mov    %rax,%rdx
+  805b0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b11:	48 98                	cltq
+  805b13:	48 01 d0             	add    %rdx,%rax
+  805b16:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  805b1a:	e9 5f ff ff ff       	jmp    805a7e <strtol+0xdc>
+			break;
+  805b1f:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  805b20:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805b25:	74 0b                	je     805b32 <strtol+0x190>
+		*endptr = (char *) s;
+  805b27:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b2b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805b2f:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  805b32:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b36:	74 09                	je     805b41 <strtol+0x19f>
+  805b38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b3c:	48 f7 d8             	neg    %rax
+  805b3f:	eb 04                	jmp    805b45 <strtol+0x1a3>
+  805b41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  805b45:	c9                   	leave
+  805b46:	c3                   	ret
+
+0000000000805b47 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  805b47:	55                   	push   %rbp
+  805b48:	48 89 e5             	mov    %rsp,%rbp
+  805b4b:	53                   	push   %rbx
+  805b4c:	48 83 ec 30          	sub    $0x30,%rsp
+  805b50:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b50 <strstr+0x9>
+  805b57:	49 bb 28 f5 00 00 00 	movabs $0xf528,%r11
+  805b5e:	00 00 00 
+  805b61:	4c 01 db             	add    %r11,%rbx
+  805b64:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  805b68:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  805b6c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b70:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  805b74:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  805b78:	0f b6 00             	movzbl (%rax),%eax
+  805b7b:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  805b7e:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  805b82:	75 06                	jne    805b8a <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  805b84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b88:	eb 73                	jmp    805bfd <strstr+0xb6>
+
+	len = strlen(str);
+  805b8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b8e:	48 89 c7             	mov    %rax,%rdi
+  805b91:	48 b8 5c 02 ff ff ff 	movabs $0xffffffffffff025c,%rax
+  805b98:	ff ff ff 
+  805b9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b9f:	ff d0                	call   *%rax
+  805ba1:	48 98                	cltq
+  805ba3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  805ba7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bab:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  805baf:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805bb3:	0f b6 00             	movzbl (%rax),%eax
+  805bb6:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  805bb9:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  805bbd:	75 07                	jne    805bc6 <strstr+0x7f>
+				return (char *) 0;
+  805bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bc4:	eb 37                	jmp    805bfd <strstr+0xb6>
+		} while (sc != c);
+  805bc6:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  805bca:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  805bcd:	75 d8                	jne    805ba7 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  805bcf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805bd3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  805bd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bdb:	48 89 ce             	mov    %rcx,%rsi
+  805bde:	48 89 c7             	mov    %rax,%rdi
+  805be1:	48 b8 10 05 ff ff ff 	movabs $0xffffffffffff0510,%rax
+  805be8:	ff ff ff 
+  805beb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805bef:	ff d0                	call   *%rax
+  805bf1:	85 c0                	test   %eax,%eax
+  805bf3:	75 b2                	jne    805ba7 <strstr+0x60>
+
+	return (char *) (in - 1);
+  805bf5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bf9:	48 83 e8 01          	sub    $0x1,%rax
+}
+  805bfd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805c01:	c9                   	leave
+  805c02:	c3                   	ret
+
+0000000000805c03 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  805c03:	55                   	push   %rbp
+  805c04:	48 89 e5             	mov    %rsp,%rbp
+  805c07:	41 57                	push   %r15
+  805c09:	53                   	push   %rbx
+  805c0a:	48 83 ec 40          	sub    $0x40,%rsp
+  805c0e:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 805c0e <syscall+0xb>
+  805c15:	49 bb 6a f4 00 00 00 	movabs $0xf46a,%r11
+  805c1c:	00 00 00 
+  805c1f:	4d 01 da             	add    %r11,%r10
+  805c22:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805c25:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805c28:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805c2c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805c30:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805c34:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  805c38:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c3b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805c3f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  805c43:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805c47:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805c4b:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  805c4f:	4c 89 c3             	mov    %r8,%rbx
+  805c52:	cd 30                	int    $0x30
+  805c54:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  805c58:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805c5c:	74 52                	je     805cb0 <syscall+0xad>
+  805c5e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805c63:	7e 4b                	jle    805cb0 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  805c65:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805c69:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c6c:	49 89 d0             	mov    %rdx,%r8
+  805c6f:	89 c1                	mov    %eax,%ecx
+  805c71:	48 b8 10 5b ff ff ff 	movabs $0xffffffffffff5b10,%rax
+  805c78:	ff ff ff 
+  805c7b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  805c7f:	48 89 c2             	mov    %rax,%rdx
+  805c82:	be 23 00 00 00       	mov    $0x23,%esi
+  805c87:	48 b8 2d 5b ff ff ff 	movabs $0xffffffffffff5b2d,%rax
+  805c8e:	ff ff ff 
+  805c91:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  805c95:	48 89 c7             	mov    %rax,%rdi
+  805c98:	4d 89 d7             	mov    %r10,%r15
+  805c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ca0:	49 b9 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r9
+  805ca7:	ff ff ff 
+  805caa:	4d 01 d1             	add    %r10,%r9
+  805cad:	41 ff d1             	call   *%r9
+
+	return ret;
+  805cb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805cb4:	48 83 c4 40          	add    $0x40,%rsp
+  805cb8:	5b                   	pop    %rbx
+  805cb9:	41 5f                	pop    %r15
+  805cbb:	5d                   	pop    %rbp
+  805cbc:	c3                   	ret
+
+0000000000805cbd <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  805cbd:	55                   	push   %rbp
+  805cbe:	48 89 e5             	mov    %rsp,%rbp
+  805cc1:	41 57                	push   %r15
+  805cc3:	41 56                	push   %r14
+  805cc5:	41 55                	push   %r13
+  805cc7:	41 54                	push   %r12
+  805cc9:	53                   	push   %rbx
+  805cca:	48 83 ec 48          	sub    $0x48,%rsp
+  805cce:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 805cce <syscall_words+0x11>
+  805cd5:	49 bb aa f3 00 00 00 	movabs $0xf3aa,%r11
+  805cdc:	00 00 00 
+  805cdf:	4d 01 de             	add    %r11,%r14
+  805ce2:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  805ce5:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  805ce8:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  805cec:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  805cf0:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  805cf4:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  805cf8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  805cfd:	74 09                	je     805d08 <syscall_words+0x4b>
+  805cff:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d03:	48 8b 00             	mov    (%rax),%rax
+  805d06:	eb 05                	jmp    805d0d <syscall_words+0x50>
+  805d08:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d0d:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  805d10:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  805d15:	74 0a                	je     805d21 <syscall_words+0x64>
+  805d17:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d1b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805d1f:	eb 05                	jmp    805d26 <syscall_words+0x69>
+  805d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d26:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  805d29:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  805d2e:	74 0a                	je     805d3a <syscall_words+0x7d>
+  805d30:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d34:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805d38:	eb 05                	jmp    805d3f <syscall_words+0x82>
+  805d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d3f:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  805d42:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  805d47:	74 0a                	je     805d53 <syscall_words+0x96>
+  805d49:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d4d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  805d51:	eb 05                	jmp    805d58 <syscall_words+0x9b>
+  805d53:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d58:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  805d5b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  805d60:	74 0a                	je     805d6c <syscall_words+0xaf>
+  805d62:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d66:	48 8b 40 20          	mov    0x20(%rax),%rax
+  805d6a:	eb 05                	jmp    805d71 <syscall_words+0xb4>
+  805d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d71:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  805d74:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  805d79:	74 0a                	je     805d85 <syscall_words+0xc8>
+  805d7b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d7f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  805d83:	eb 05                	jmp    805d8a <syscall_words+0xcd>
+  805d85:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d8a:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  805d8d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805d90:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  805d94:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  805d98:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  805d9c:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  805da0:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  805da4:	cd 30                	int    $0x30
+  805da6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  805daa:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  805daf:	74 50                	je     805e01 <syscall_words+0x144>
+		words[0] = r8;
+  805db1:	4c 89 c2             	mov    %r8,%rdx
+  805db4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805db8:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  805dbb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805dbf:	48 83 c0 08          	add    $0x8,%rax
+  805dc3:	4c 89 ca             	mov    %r9,%rdx
+  805dc6:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  805dc9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805dcd:	48 83 c0 10          	add    $0x10,%rax
+  805dd1:	4c 89 d2             	mov    %r10,%rdx
+  805dd4:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  805dd7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805ddb:	48 83 c0 18          	add    $0x18,%rax
+  805ddf:	4c 89 da             	mov    %r11,%rdx
+  805de2:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  805de5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805de9:	48 83 c0 20          	add    $0x20,%rax
+  805ded:	4c 89 e2             	mov    %r12,%rdx
+  805df0:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  805df3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805df7:	48 83 c0 28          	add    $0x28,%rax
+  805dfb:	4c 89 ea             	mov    %r13,%rdx
+  805dfe:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  805e01:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805e05:	74 52                	je     805e59 <syscall_words+0x19c>
+  805e07:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805e0c:	7e 4b                	jle    805e59 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  805e0e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805e12:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805e15:	49 89 d0             	mov    %rdx,%r8
+  805e18:	89 c1                	mov    %eax,%ecx
+  805e1a:	48 b8 10 5b ff ff ff 	movabs $0xffffffffffff5b10,%rax
+  805e21:	ff ff ff 
+  805e24:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  805e28:	48 89 c2             	mov    %rax,%rdx
+  805e2b:	be 4e 00 00 00       	mov    $0x4e,%esi
+  805e30:	48 b8 2d 5b ff ff ff 	movabs $0xffffffffffff5b2d,%rax
+  805e37:	ff ff ff 
+  805e3a:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  805e3e:	48 89 c7             	mov    %rax,%rdi
+  805e41:	4d 89 f7             	mov    %r14,%r15
+  805e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e49:	49 b9 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r9
+  805e50:	ff ff ff 
+  805e53:	4d 01 f1             	add    %r14,%r9
+  805e56:	41 ff d1             	call   *%r9
+
+	return ret;
+  805e59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  805e5d:	48 83 c4 48          	add    $0x48,%rsp
+  805e61:	5b                   	pop    %rbx
+  805e62:	41 5c                	pop    %r12
+  805e64:	41 5d                	pop    %r13
+  805e66:	41 5e                	pop    %r14
+  805e68:	41 5f                	pop    %r15
+  805e6a:	5d                   	pop    %rbp
+  805e6b:	c3                   	ret
+
+0000000000805e6c <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  805e6c:	55                   	push   %rbp
+  805e6d:	48 89 e5             	mov    %rsp,%rbp
+  805e70:	48 83 ec 10          	sub    $0x10,%rsp
+  805e74:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e74 <sys_cputs+0x8>
+  805e7b:	49 bb 04 f2 00 00 00 	movabs $0xf204,%r11
+  805e82:	00 00 00 
+  805e85:	4c 01 d8             	add    %r11,%rax
+  805e88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805e8c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  805e90:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805e94:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  805e98:	48 83 ec 08          	sub    $0x8,%rsp
+  805e9c:	6a 00                	push   $0x0
+  805e9e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805ea4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805eaa:	be 00 00 00 00       	mov    $0x0,%esi
+  805eaf:	bf 00 00 00 00       	mov    $0x0,%edi
+  805eb4:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  805ebb:	ff ff ff 
+  805ebe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  805ec2:	ff d0                	call   *%rax
+  805ec4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  805ec8:	90                   	nop
+  805ec9:	c9                   	leave
+  805eca:	c3                   	ret
+
+0000000000805ecb <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  805ecb:	55                   	push   %rbp
+  805ecc:	48 89 e5             	mov    %rsp,%rbp
+  805ecf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ecf <sys_cgetc+0x4>
+  805ed6:	49 bb a9 f1 00 00 00 	movabs $0xf1a9,%r11
+  805edd:	00 00 00 
+  805ee0:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  805ee3:	48 83 ec 08          	sub    $0x8,%rsp
+  805ee7:	6a 00                	push   $0x0
+  805ee9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805eef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805ef5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805efa:	ba 00 00 00 00       	mov    $0x0,%edx
+  805eff:	be 00 00 00 00       	mov    $0x0,%esi
+  805f04:	bf 01 00 00 00       	mov    $0x1,%edi
+  805f09:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  805f10:	ff ff ff 
+  805f13:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  805f17:	ff d0                	call   *%rax
+  805f19:	48 83 c4 10          	add    $0x10,%rsp
+}
+  805f1d:	c9                   	leave
+  805f1e:	c3                   	ret
+
+0000000000805f1f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  805f1f:	55                   	push   %rbp
+  805f20:	48 89 e5             	mov    %rsp,%rbp
+  805f23:	48 83 ec 10          	sub    $0x10,%rsp
+  805f27:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f27 <sys_env_destroy+0x8>
+  805f2e:	49 bb 51 f1 00 00 00 	movabs $0xf151,%r11
+  805f35:	00 00 00 
+  805f38:	4c 01 d8             	add    %r11,%rax
+  805f3b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  805f3e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805f41:	48 63 d2             	movslq %edx,%rdx
+  805f44:	48 83 ec 08          	sub    $0x8,%rsp
+  805f48:	6a 00                	push   $0x0
+  805f4a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805f50:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805f56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805f5b:	be 01 00 00 00       	mov    $0x1,%esi
+  805f60:	bf 03 00 00 00       	mov    $0x3,%edi
+  805f65:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  805f6c:	ff ff ff 
+  805f6f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  805f73:	ff d0                	call   *%rax
+  805f75:	48 83 c4 10          	add    $0x10,%rsp
+}
+  805f79:	c9                   	leave
+  805f7a:	c3                   	ret
+
+0000000000805f7b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  805f7b:	55                   	push   %rbp
+  805f7c:	48 89 e5             	mov    %rsp,%rbp
+  805f7f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f7f <sys_getenvid+0x4>
+  805f86:	49 bb f9 f0 00 00 00 	movabs $0xf0f9,%r11
+  805f8d:	00 00 00 
+  805f90:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  805f93:	48 83 ec 08          	sub    $0x8,%rsp
+  805f97:	6a 00                	push   $0x0
+  805f99:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805f9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805fa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805faa:	ba 00 00 00 00       	mov    $0x0,%edx
+  805faf:	be 00 00 00 00       	mov    $0x0,%esi
+  805fb4:	bf 02 00 00 00       	mov    $0x2,%edi
+  805fb9:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  805fc0:	ff ff ff 
+  805fc3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  805fc7:	ff d0                	call   *%rax
+  805fc9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  805fcd:	c9                   	leave
+  805fce:	c3                   	ret
+
+0000000000805fcf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  805fcf:	55                   	push   %rbp
+  805fd0:	48 89 e5             	mov    %rsp,%rbp
+  805fd3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805fd3 <sys_yield+0x4>
+  805fda:	49 bb a5 f0 00 00 00 	movabs $0xf0a5,%r11
+  805fe1:	00 00 00 
+  805fe4:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  805fe7:	48 83 ec 08          	sub    $0x8,%rsp
+  805feb:	6a 00                	push   $0x0
+  805fed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805ff3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805ff9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805ffe:	ba 00 00 00 00       	mov    $0x0,%edx
+  806003:	be 00 00 00 00       	mov    $0x0,%esi
+  806008:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80600d:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  806014:	ff ff ff 
+  806017:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80601b:	ff d0                	call   *%rax
+  80601d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  806021:	90                   	nop
+  806022:	c9                   	leave
+  806023:	c3                   	ret
+
+0000000000806024 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  806024:	55                   	push   %rbp
+  806025:	48 89 e5             	mov    %rsp,%rbp
+  806028:	48 83 ec 10          	sub    $0x10,%rsp
+  80602c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80602c <sys_page_alloc+0x8>
+  806033:	49 bb 4c f0 00 00 00 	movabs $0xf04c,%r11
+  80603a:	00 00 00 
+  80603d:	4c 01 d8             	add    %r11,%rax
+  806040:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806043:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  806047:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80604a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80604d:	48 63 f2             	movslq %edx,%rsi
+  806050:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806054:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806057:	48 63 d2             	movslq %edx,%rdx
+  80605a:	48 83 ec 08          	sub    $0x8,%rsp
+  80605e:	6a 00                	push   $0x0
+  806060:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806066:	49 89 f0             	mov    %rsi,%r8
+  806069:	be 01 00 00 00       	mov    $0x1,%esi
+  80606e:	bf 04 00 00 00       	mov    $0x4,%edi
+  806073:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  80607a:	ff ff ff 
+  80607d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806081:	ff d0                	call   *%rax
+  806083:	48 83 c4 10          	add    $0x10,%rsp
+}
+  806087:	c9                   	leave
+  806088:	c3                   	ret
+
+0000000000806089 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  806089:	55                   	push   %rbp
+  80608a:	48 89 e5             	mov    %rsp,%rbp
+  80608d:	48 83 ec 20          	sub    $0x20,%rsp
+  806091:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806091 <sys_page_map+0x8>
+  806098:	49 bb e7 ef 00 00 00 	movabs $0xefe7,%r11
+  80609f:	00 00 00 
+  8060a2:	4c 01 d8             	add    %r11,%rax
+  8060a5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8060a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8060ac:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8060af:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8060b3:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8060b7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8060ba:	48 63 f2             	movslq %edx,%rsi
+  8060bd:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8060c1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8060c4:	48 63 fa             	movslq %edx,%rdi
+  8060c7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8060cb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8060ce:	48 63 d2             	movslq %edx,%rdx
+  8060d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8060d5:	56                   	push   %rsi
+  8060d6:	4d 89 c1             	mov    %r8,%r9
+  8060d9:	49 89 f8             	mov    %rdi,%r8
+  8060dc:	be 01 00 00 00       	mov    $0x1,%esi
+  8060e1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8060e6:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  8060ed:	ff ff ff 
+  8060f0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8060f4:	ff d0                	call   *%rax
+  8060f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8060fa:	c9                   	leave
+  8060fb:	c3                   	ret
+
+00000000008060fc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8060fc:	55                   	push   %rbp
+  8060fd:	48 89 e5             	mov    %rsp,%rbp
+  806100:	48 83 ec 10          	sub    $0x10,%rsp
+  806104:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806104 <sys_page_unmap+0x8>
+  80610b:	49 bb 74 ef 00 00 00 	movabs $0xef74,%r11
+  806112:	00 00 00 
+  806115:	4c 01 d8             	add    %r11,%rax
+  806118:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80611b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  80611f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806123:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806126:	48 63 d2             	movslq %edx,%rdx
+  806129:	48 83 ec 08          	sub    $0x8,%rsp
+  80612d:	6a 00                	push   $0x0
+  80612f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806135:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80613b:	be 01 00 00 00       	mov    $0x1,%esi
+  806140:	bf 06 00 00 00       	mov    $0x6,%edi
+  806145:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  80614c:	ff ff ff 
+  80614f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806153:	ff d0                	call   *%rax
+  806155:	48 83 c4 10          	add    $0x10,%rsp
+}
+  806159:	c9                   	leave
+  80615a:	c3                   	ret
+
+000000000080615b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80615b:	55                   	push   %rbp
+  80615c:	48 89 e5             	mov    %rsp,%rbp
+  80615f:	48 83 ec 10          	sub    $0x10,%rsp
+  806163:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806163 <sys_env_set_status+0x8>
+  80616a:	49 bb 15 ef 00 00 00 	movabs $0xef15,%r11
+  806171:	00 00 00 
+  806174:	4c 01 d8             	add    %r11,%rax
+  806177:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80617a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80617d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  806180:	48 63 ca             	movslq %edx,%rcx
+  806183:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806186:	48 63 d2             	movslq %edx,%rdx
+  806189:	48 83 ec 08          	sub    $0x8,%rsp
+  80618d:	6a 00                	push   $0x0
+  80618f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806195:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80619b:	be 01 00 00 00       	mov    $0x1,%esi
+  8061a0:	bf 08 00 00 00       	mov    $0x8,%edi
+  8061a5:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  8061ac:	ff ff ff 
+  8061af:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8061b3:	ff d0                	call   *%rax
+  8061b5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8061b9:	c9                   	leave
+  8061ba:	c3                   	ret
+
+00000000008061bb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8061bb:	55                   	push   %rbp
+  8061bc:	48 89 e5             	mov    %rsp,%rbp
+  8061bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8061c3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8061c3 <sys_env_set_trapframe+0x8>
+  8061ca:	49 bb b5 ee 00 00 00 	movabs $0xeeb5,%r11
+  8061d1:	00 00 00 
+  8061d4:	4c 01 d8             	add    %r11,%rax
+  8061d7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8061da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8061de:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8061e2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8061e5:	48 63 d2             	movslq %edx,%rdx
+  8061e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8061ec:	6a 00                	push   $0x0
+  8061ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8061f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8061fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8061ff:	bf 09 00 00 00       	mov    $0x9,%edi
+  806204:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  80620b:	ff ff ff 
+  80620e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806212:	ff d0                	call   *%rax
+  806214:	48 83 c4 10          	add    $0x10,%rsp
+}
+  806218:	c9                   	leave
+  806219:	c3                   	ret
+
+000000000080621a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80621a:	55                   	push   %rbp
+  80621b:	48 89 e5             	mov    %rsp,%rbp
+  80621e:	48 83 ec 10          	sub    $0x10,%rsp
+  806222:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806222 <sys_env_set_pgfault_upcall+0x8>
+  806229:	49 bb 56 ee 00 00 00 	movabs $0xee56,%r11
+  806230:	00 00 00 
+  806233:	4c 01 d8             	add    %r11,%rax
+  806236:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806239:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80623d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806241:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806244:	48 63 d2             	movslq %edx,%rdx
+  806247:	48 83 ec 08          	sub    $0x8,%rsp
+  80624b:	6a 00                	push   $0x0
+  80624d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806253:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  806259:	be 01 00 00 00       	mov    $0x1,%esi
+  80625e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  806263:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  80626a:	ff ff ff 
+  80626d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806271:	ff d0                	call   *%rax
+  806273:	48 83 c4 10          	add    $0x10,%rsp
+}
+  806277:	c9                   	leave
+  806278:	c3                   	ret
+
+0000000000806279 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  806279:	55                   	push   %rbp
+  80627a:	48 89 e5             	mov    %rsp,%rbp
+  80627d:	48 83 ec 20          	sub    $0x20,%rsp
+  806281:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806281 <sys_ipc_try_send+0x8>
+  806288:	49 bb f7 ed 00 00 00 	movabs $0xedf7,%r11
+  80628f:	00 00 00 
+  806292:	4c 01 d8             	add    %r11,%rax
+  806295:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806298:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80629c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8062a0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8062a3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8062a6:	48 63 fa             	movslq %edx,%rdi
+  8062a9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8062ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8062b0:	48 63 d2             	movslq %edx,%rdx
+  8062b3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8062b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8062bb:	6a 00                	push   $0x0
+  8062bd:	49 89 f9             	mov    %rdi,%r9
+  8062c0:	49 89 f0             	mov    %rsi,%r8
+  8062c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8062c8:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8062cd:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  8062d4:	ff ff ff 
+  8062d7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8062db:	ff d0                	call   *%rax
+  8062dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8062e1:	c9                   	leave
+  8062e2:	c3                   	ret
+
+00000000008062e3 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8062e3:	55                   	push   %rbp
+  8062e4:	48 89 e5             	mov    %rsp,%rbp
+  8062e7:	48 83 ec 20          	sub    $0x20,%rsp
+  8062eb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8062eb <sys_ipc_send+0x8>
+  8062f2:	49 bb 8d ed 00 00 00 	movabs $0xed8d,%r11
+  8062f9:	00 00 00 
+  8062fc:	4c 01 d8             	add    %r11,%rax
+  8062ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806302:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  806306:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80630a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80630d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  806310:	48 63 fa             	movslq %edx,%rdi
+  806313:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  806317:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80631a:	48 63 d2             	movslq %edx,%rdx
+  80631d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806321:	48 83 ec 08          	sub    $0x8,%rsp
+  806325:	6a 00                	push   $0x0
+  806327:	49 89 f9             	mov    %rdi,%r9
+  80632a:	49 89 f0             	mov    %rsi,%r8
+  80632d:	be 00 00 00 00       	mov    $0x0,%esi
+  806332:	bf 17 00 00 00       	mov    $0x17,%edi
+  806337:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  80633e:	ff ff ff 
+  806341:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806345:	ff d0                	call   *%rax
+  806347:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80634b:	c9                   	leave
+  80634c:	c3                   	ret
+
+000000000080634d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80634d:	55                   	push   %rbp
+  80634e:	48 89 e5             	mov    %rsp,%rbp
+  806351:	48 83 ec 10          	sub    $0x10,%rsp
+  806355:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806355 <sys_ipc_recv+0x8>
+  80635c:	49 bb 23 ed 00 00 00 	movabs $0xed23,%r11
+  806363:	00 00 00 
+  806366:	4c 01 d8             	add    %r11,%rax
+  806369:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80636d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806371:	6a 00                	push   $0x0
+  806373:	6a 00                	push   $0x0
+  806375:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80637b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  806381:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806386:	be 01 00 00 00       	mov    $0x1,%esi
+  80638b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  806390:	49 ba 45 0c ff ff ff 	movabs $0xffffffffffff0c45,%r10
+  806397:	ff ff ff 
+  80639a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80639e:	ff d0                	call   *%rax
+  8063a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8063a4:	c9                   	leave
+  8063a5:	c3                   	ret
+
+00000000008063a6 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8063a6:	55                   	push   %rbp
+  8063a7:	48 89 e5             	mov    %rsp,%rbp
+  8063aa:	48 83 ec 30          	sub    $0x30,%rsp
+  8063ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8063ae <sys_ipc_call+0x8>
+  8063b5:	49 bb ca ec 00 00 00 	movabs $0xecca,%r11
+  8063bc:	00 00 00 
+  8063bf:	4c 01 d8             	add    %r11,%rax
+  8063c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8063c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8063c9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8063cd:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8063d0:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8063d4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8063d8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8063dc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8063df:	4c 63 c2             	movslq %edx,%r8
+  8063e2:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8063e6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8063e9:	48 63 d2             	movslq %edx,%rdx
+  8063ec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8063f0:	ff 75 d8             	push   -0x28(%rbp)
+  8063f3:	56                   	push   %rsi
+  8063f4:	4d 89 c1             	mov    %r8,%r9
+  8063f7:	49 89 f8             	mov    %rdi,%r8
+  8063fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8063ff:	bf 18 00 00 00       	mov    $0x18,%edi
+  806404:	49 ba 45 0c ff ff ff 	movabs $0xffffffffffff0c45,%r10
+  80640b:	ff ff ff 
+  80640e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806412:	ff d0                	call   *%rax
+  806414:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  806418:	c9                   	leave
+  806419:	c3                   	ret
+
+000000000080641a <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80641a:	55                   	push   %rbp
+  80641b:	48 89 e5             	mov    %rsp,%rbp
+  80641e:	48 83 ec 30          	sub    $0x30,%rsp
+  806422:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806422 <sys_ipc_reply_recv+0x8>
+  806429:	49 bb 56 ec 00 00 00 	movabs $0xec56,%r11
+  806430:	00 00 00 
+  806433:	4c 01 d8             	add    %r11,%rax
+  806436:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806439:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80643d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  806441:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  806444:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  806448:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80644c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  806450:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  806453:	4c 63 c2             	movslq %edx,%r8
+  806456:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80645a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80645d:	48 63 d2             	movslq %edx,%rdx
+  806460:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806464:	ff 75 d8             	push   -0x28(%rbp)
+  806467:	56                   	push   %rsi
+  806468:	4d 89 c1             	mov    %r8,%r9
+  80646b:	49 89 f8             	mov    %rdi,%r8
+  80646e:	be 00 00 00 00       	mov    $0x0,%esi
+  806473:	bf 19 00 00 00       	mov    $0x19,%edi
+  806478:	49 ba 45 0c ff ff ff 	movabs $0xffffffffffff0c45,%r10
+  80647f:	ff ff ff 
+  806482:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806486:	ff d0                	call   *%rax
+  806488:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80648c:	c9                   	leave
+  80648d:	c3                   	ret
+
+000000000080648e <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80648e:	55                   	push   %rbp
+  80648f:	48 89 e5             	mov    %rsp,%rbp
+  806492:	48 83 ec 10          	sub    $0x10,%rsp
+  806496:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806496 <sys_env_set_priority+0x8>
+  80649d:	49 bb e2 eb 00 00 00 	movabs $0xebe2,%r11
+  8064a4:	00 00 00 
+  8064a7:	4c 01 d8             	add    %r11,%rax
+  8064aa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8064ad:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8064b0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8064b3:	48 63 ca             	movslq %edx,%rcx
+  8064b6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8064b9:	48 63 d2             	movslq %edx,%rdx
+  8064bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8064c0:	6a 00                	push   $0x0
+  8064c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8064c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8064ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8064d3:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8064d8:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  8064df:	ff ff ff 
+  8064e2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8064e6:	ff d0                	call   *%rax
+  8064e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8064ec:	c9                   	leave
+  8064ed:	c3                   	ret
+
+00000000008064ee <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8064ee:	55                   	push   %rbp
+  8064ef:	48 89 e5             	mov    %rsp,%rbp
+  8064f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8064f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064f6 <sys_env_set_affinity+0x8>
+  8064fd:	49 bb 82 eb 00 00 00 	movabs $0xeb82,%r11
+  806504:	00 00 00 
+  806507:	4c 01 d8             	add    %r11,%rax
+  80650a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80650d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  806510:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  806513:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806516:	48 63 d2             	movslq %edx,%rdx
+  806519:	48 83 ec 08          	sub    $0x8,%rsp
+  80651d:	6a 00                	push   $0x0
+  80651f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80652b:	be 01 00 00 00       	mov    $0x1,%esi
+  806530:	bf 10 00 00 00       	mov    $0x10,%edi
+  806535:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  80653c:	ff ff ff 
+  80653f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806543:	ff d0                	call   *%rax
+  806545:	48 83 c4 10          	add    $0x10,%rsp
+}
+  806549:	c9                   	leave
+  80654a:	c3                   	ret
+
+000000000080654b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80654b:	55                   	push   %rbp
+  80654c:	48 89 e5             	mov    %rsp,%rbp
+  80654f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80654f <sys_time_msec+0x4>
+  806556:	49 bb 29 eb 00 00 00 	movabs $0xeb29,%r11
+  80655d:	00 00 00 
+  806560:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  806563:	48 83 ec 08          	sub    $0x8,%rsp
+  806567:	6a 00                	push   $0x0
+  806569:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80656f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  806575:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80657a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80657f:	be 00 00 00 00       	mov    $0x0,%esi
+  806584:	bf 0e 00 00 00       	mov    $0xe,%edi
+  806589:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  806590:	ff ff ff 
+  806593:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806597:	ff d0                	call   *%rax
+  806599:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80659d:	c9                   	leave
+  80659e:	c3                   	ret
+
+000000000080659f <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80659f:	55                   	push   %rbp
+  8065a0:	48 89 e5             	mov    %rsp,%rbp
+  8065a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8065a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8065a7 <sys_sleep_usec+0x8>
+  8065ae:	49 bb d1 ea 00 00 00 	movabs $0xead1,%r11
+  8065b5:	00 00 00 
+  8065b8:	4c 01 d8             	add    %r11,%rax
+  8065bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8065bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8065c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8065c7:	6a 00                	push   $0x0
+  8065c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8065cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8065d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8065da:	be 00 00 00 00       	mov    $0x0,%esi
+  8065df:	bf 11 00 00 00       	mov    $0x11,%edi
+  8065e4:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  8065eb:	ff ff ff 
+  8065ee:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8065f2:	ff d0                	call   *%rax
+  8065f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8065f8:	c9                   	leave
+  8065f9:	c3                   	ret
+
+00000000008065fa <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8065fa:	55                   	push   %rbp
+  8065fb:	48 89 e5             	mov    %rsp,%rbp
+  8065fe:	48 83 ec 10          	sub    $0x10,%rsp
+  806602:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806602 <sys_page_alloc_huge+0x8>
+  806609:	49 bb 76 ea 00 00 00 	movabs $0xea76,%r11
+  806610:	00 00 00 
+  806613:	4c 01 d8             	add    %r11,%rax
+  806616:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806619:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80661d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  806620:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  806623:	48 63 f2             	movslq %edx,%rsi
+  806626:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80662a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80662d:	48 63 d2             	movslq %edx,%rdx
+  806630:	48 83 ec 08          	sub    $0x8,%rsp
+  806634:	6a 00                	push   $0x0
+  806636:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80663c:	49 89 f0             	mov    %rsi,%r8
+  80663f:	be 01 00 00 00       	mov    $0x1,%esi
+  806644:	bf 12 00 00 00       	mov    $0x12,%edi
+  806649:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  806650:	ff ff ff 
+  806653:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806657:	ff d0                	call   *%rax
+  806659:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80665d:	c9                   	leave
+  80665e:	c3                   	ret
+
+000000000080665f <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80665f:	55                   	push   %rbp
+  806660:	48 89 e5             	mov    %rsp,%rbp
+  806663:	48 83 ec 10          	sub    $0x10,%rsp
+  806667:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806667 <sys_page_map_batch+0x8>
+  80666e:	49 bb 11 ea 00 00 00 	movabs $0xea11,%r11
+  806675:	00 00 00 
+  806678:	4c 01 d8             	add    %r11,%rax
+  80667b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80667f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  806683:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806687:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80668b:	48 83 ec 08          	sub    $0x8,%rsp
+  80668f:	6a 00                	push   $0x0
+  806691:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806697:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80669d:	be 01 00 00 00       	mov    $0x1,%esi
+  8066a2:	bf 13 00 00 00       	mov    $0x13,%edi
+  8066a7:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  8066ae:	ff ff ff 
+  8066b1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8066b5:	ff d0                	call   *%rax
+  8066b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8066bb:	c9                   	leave
+  8066bc:	c3                   	ret
+
+00000000008066bd <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8066bd:	55                   	push   %rbp
+  8066be:	48 89 e5             	mov    %rsp,%rbp
+  8066c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8066c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8066c5 <sys_page_alloc_batch+0x8>
+  8066cc:	49 bb b3 e9 00 00 00 	movabs $0xe9b3,%r11
+  8066d3:	00 00 00 
+  8066d6:	4c 01 d8             	add    %r11,%rax
+  8066d9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8066dd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8066e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8066e5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8066e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8066ed:	6a 00                	push   $0x0
+  8066ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8066f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8066fb:	be 01 00 00 00       	mov    $0x1,%esi
+  806700:	bf 14 00 00 00       	mov    $0x14,%edi
+  806705:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  80670c:	ff ff ff 
+  80670f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806713:	ff d0                	call   *%rax
+  806715:	48 83 c4 10          	add    $0x10,%rsp
+}
+  806719:	c9                   	leave
+  80671a:	c3                   	ret
+
+000000000080671b <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80671b:	55                   	push   %rbp
+  80671c:	48 89 e5             	mov    %rsp,%rbp
+  80671f:	48 83 ec 10          	sub    $0x10,%rsp
+  806723:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806723 <sys_page_unmap_batch+0x8>
+  80672a:	49 bb 55 e9 00 00 00 	movabs $0xe955,%r11
+  806731:	00 00 00 
+  806734:	4c 01 d8             	add    %r11,%rax
+  806737:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80673b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80673f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806743:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806747:	48 83 ec 08          	sub    $0x8,%rsp
+  80674b:	6a 00                	push   $0x0
+  80674d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806753:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  806759:	be 01 00 00 00       	mov    $0x1,%esi
+  80675e:	bf 15 00 00 00       	mov    $0x15,%edi
+  806763:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  80676a:	ff ff ff 
+  80676d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  806771:	ff d0                	call   *%rax
+  806773:	48 83 c4 10          	add    $0x10,%rsp
+}
+  806777:	c9                   	leave
+  806778:	c3                   	ret
+
+0000000000806779 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  806779:	55                   	push   %rbp
+  80677a:	48 89 e5             	mov    %rsp,%rbp
+  80677d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80677d <sys_fork+0x4>
+  806784:	49 bb fb e8 00 00 00 	movabs $0xe8fb,%r11
+  80678b:	00 00 00 
+  80678e:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  806791:	48 83 ec 08          	sub    $0x8,%rsp
+  806795:	6a 00                	push   $0x0
+  806797:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80679d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8067a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8067a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8067ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8067b2:	bf 16 00 00 00       	mov    $0x16,%edi
+  8067b7:	49 ba 8b 0b ff ff ff 	movabs $0xffffffffffff0b8b,%r10
+  8067be:	ff ff ff 
+  8067c1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8067c5:	ff d0                	call   *%rax
+  8067c7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8067cb:	c9                   	leave
+  8067cc:	c3                   	ret
+
+00000000008067cd <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8067cd:	55                   	push   %rbp
+  8067ce:	48 89 e5             	mov    %rsp,%rbp
+  8067d1:	41 57                	push   %r15
+  8067d3:	53                   	push   %rbx
+  8067d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8067d8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067d8 <set_pgfault_handler+0xb>
+  8067df:	49 bb a0 e8 00 00 00 	movabs $0xe8a0,%r11
+  8067e6:	00 00 00 
+  8067e9:	4c 01 db             	add    %r11,%rbx
+  8067ec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  8067f0:	49 89 df             	mov    %rbx,%r15
+  8067f3:	48 b8 03 0f ff ff ff 	movabs $0xffffffffffff0f03,%rax
+  8067fa:	ff ff ff 
+  8067fd:	48 01 d8             	add    %rbx,%rax
+  806800:	ff d0                	call   *%rax
+  806802:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806805:	48 b8 a8 1f 01 00 00 	movabs $0x11fa8,%rax
+  80680c:	00 00 00 
+  80680f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806813:	48 85 c0             	test   %rax,%rax
+  806816:	75 6b                	jne    806883 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806818:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80681b:	ba 07 00 00 00       	mov    $0x7,%edx
+  806820:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806825:	48 89 ce             	mov    %rcx,%rsi
+  806828:	89 c7                	mov    %eax,%edi
+  80682a:	49 89 df             	mov    %rbx,%r15
+  80682d:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  806834:	ff ff ff 
+  806837:	48 01 d8             	add    %rbx,%rax
+  80683a:	ff d0                	call   *%rax
+  80683c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  80683f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806843:	74 3e                	je     806883 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806845:	48 b8 40 5b ff ff ff 	movabs $0xffffffffffff5b40,%rax
+  80684c:	ff ff ff 
+  80684f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806853:	48 89 c2             	mov    %rax,%rdx
+  806856:	be 23 00 00 00       	mov    $0x23,%esi
+  80685b:	48 b8 6e 5b ff ff ff 	movabs $0xffffffffffff5b6e,%rax
+  806862:	ff ff ff 
+  806865:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806869:	48 89 c7             	mov    %rax,%rdi
+  80686c:	49 89 df             	mov    %rbx,%r15
+  80686f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806874:	48 b9 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%rcx
+  80687b:	ff ff ff 
+  80687e:	48 01 d9             	add    %rbx,%rcx
+  806881:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806883:	48 ba a8 1f 01 00 00 	movabs $0x11fa8,%rdx
+  80688a:	00 00 00 
+  80688d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806891:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806895:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806898:	48 ba b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rdx
+  80689f:	ff ff ff 
+  8068a2:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8068a6:	48 89 d6             	mov    %rdx,%rsi
+  8068a9:	89 c7                	mov    %eax,%edi
+  8068ab:	49 89 df             	mov    %rbx,%r15
+  8068ae:	48 b8 a2 11 ff ff ff 	movabs $0xffffffffffff11a2,%rax
+  8068b5:	ff ff ff 
+  8068b8:	48 01 d8             	add    %rbx,%rax
+  8068bb:	ff d0                	call   *%rax
+}
+  8068bd:	90                   	nop
+  8068be:	48 83 c4 20          	add    $0x20,%rsp
+  8068c2:	5b                   	pop    %rbx
+  8068c3:	41 5f                	pop    %r15
+  8068c5:	5d                   	pop    %rbp
+  8068c6:	c3                   	ret
+
+00000000008068c7 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  8068c7:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  8068ca:	48 a1 20 70 82 00 00 	movabs 0x827020,%rax
+  8068d1:	00 00 00 
+call *%rax
+  8068d4:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  8068d6:	58                   	pop    %rax
+	popq %rax;
+  8068d7:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  8068d8:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  8068df:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  8068e3:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  8068e7:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  8068eb:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  8068ef:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  8068f3:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  8068f6:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  8068fa:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8068fe:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806903:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806908:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80690d:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806912:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806917:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80691c:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806921:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806926:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80692b:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806930:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806935:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80693a:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80693f:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806944:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806948:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  80694c:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  80694d:	5c                   	pop    %rsp
+	ret;			//return
+  80694e:	c3                   	ret
+
+000000000080694f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80694f:	55                   	push   %rbp
+  806950:	48 89 e5             	mov    %rsp,%rbp
+  806953:	41 57                	push   %r15
+  806955:	53                   	push   %rbx
+  806956:	48 83 ec 30          	sub    $0x30,%rsp
+  80695a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80695a <ipc_recv+0xb>
+  806961:	49 bb 1e e7 00 00 00 	movabs $0xe71e,%r11
+  806968:	00 00 00 
+  80696b:	4c 01 db             	add    %r11,%rbx
+  80696e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806972:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806976:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80697a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80697f:	75 0e                	jne    80698f <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  806981:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806988:	00 00 00 
+  80698b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  80698f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806993:	48 89 c7             	mov    %rax,%rdi
+  806996:	49 89 df             	mov    %rbx,%r15
+  806999:	48 b8 d5 12 ff ff ff 	movabs $0xffffffffffff12d5,%rax
+  8069a0:	ff ff ff 
+  8069a3:	48 01 d8             	add    %rbx,%rax
+  8069a6:	ff d0                	call   *%rax
+  8069a8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8069ab:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8069b0:	74 2a                	je     8069dc <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8069b2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8069b6:	75 19                	jne    8069d1 <ipc_recv+0x82>
+  8069b8:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8069bf:	ff ff ff 
+  8069c2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8069c6:	48 8b 00             	mov    (%rax),%rax
+  8069c9:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8069cf:	eb 05                	jmp    8069d6 <ipc_recv+0x87>
+  8069d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8069d6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8069da:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8069dc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8069e1:	74 2a                	je     806a0d <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8069e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8069e7:	75 19                	jne    806a02 <ipc_recv+0xb3>
+  8069e9:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8069f0:	ff ff ff 
+  8069f3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8069f7:	48 8b 00             	mov    (%rax),%rax
+  8069fa:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806a00:	eb 05                	jmp    806a07 <ipc_recv+0xb8>
+  806a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a07:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806a0b:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806a0d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a11:	74 05                	je     806a18 <ipc_recv+0xc9>
+		return res;
+  806a13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a16:	eb 17                	jmp    806a2f <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806a18:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806a1f:	ff ff ff 
+  806a22:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a26:	48 8b 00             	mov    (%rax),%rax
+  806a29:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806a2f:	48 83 c4 30          	add    $0x30,%rsp
+  806a33:	5b                   	pop    %rbx
+  806a34:	41 5f                	pop    %r15
+  806a36:	5d                   	pop    %rbp
+  806a37:	c3                   	ret
+
+0000000000806a38 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806a38:	55                   	push   %rbp
+  806a39:	48 89 e5             	mov    %rsp,%rbp
+  806a3c:	41 57                	push   %r15
+  806a3e:	53                   	push   %rbx
+  806a3f:	48 83 ec 20          	sub    $0x20,%rsp
+  806a43:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a43 <ipc_send+0xb>
+  806a4a:	49 bb 35 e6 00 00 00 	movabs $0xe635,%r11
+  806a51:	00 00 00 
+  806a54:	4c 01 db             	add    %r11,%rbx
+  806a57:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806a5a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806a5d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806a61:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  806a64:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806a69:	75 0e                	jne    806a79 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806a6b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806a72:	00 00 00 
+  806a75:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  806a79:	90                   	nop
+  806a7a:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806a7d:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806a80:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806a84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a87:	89 c7                	mov    %eax,%edi
+  806a89:	49 89 df             	mov    %rbx,%r15
+  806a8c:	48 b8 6b 12 ff ff ff 	movabs $0xffffffffffff126b,%rax
+  806a93:	ff ff ff 
+  806a96:	48 01 d8             	add    %rbx,%rax
+  806a99:	ff d0                	call   *%rax
+  806a9b:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  806a9e:	74 da                	je     806a7a <ipc_send+0x42>
+		;
+}
+  806aa0:	90                   	nop
+  806aa1:	90                   	nop
+  806aa2:	48 83 c4 20          	add    $0x20,%rsp
+  806aa6:	5b                   	pop    %rbx
+  806aa7:	41 5f                	pop    %r15
+  806aa9:	5d                   	pop    %rbp
+  806aaa:	c3                   	ret
+
+0000000000806aab <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  806aab:	55                   	push   %rbp
+  806aac:	48 89 e5             	mov    %rsp,%rbp
+  806aaf:	41 57                	push   %r15
+  806ab1:	53                   	push   %rbx
+  806ab2:	48 83 ec 40          	sub    $0x40,%rsp
+  806ab6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ab6 <ipc_call+0xb>
+  806abd:	49 bb c2 e5 00 00 00 	movabs $0xe5c2,%r11
+  806ac4:	00 00 00 
+  806ac7:	4c 01 db             	add    %r11,%rbx
+  806aca:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806acd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806ad0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806ad4:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806ad7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806adb:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806adf:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806ae4:	75 0e                	jne    806af4 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806ae6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806aed:	00 00 00 
+  806af0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806af4:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806af9:	75 0e                	jne    806b09 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806afb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806b02:	00 00 00 
+  806b05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806b09:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806b0c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806b10:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806b13:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806b17:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b1a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806b20:	49 89 f8             	mov    %rdi,%r8
+  806b23:	89 c7                	mov    %eax,%edi
+  806b25:	49 89 df             	mov    %rbx,%r15
+  806b28:	48 b8 2e 13 ff ff ff 	movabs $0xffffffffffff132e,%rax
+  806b2f:	ff ff ff 
+  806b32:	48 01 d8             	add    %rbx,%rax
+  806b35:	ff d0                	call   *%rax
+  806b37:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806b3a:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806b3f:	74 2a                	je     806b6b <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806b41:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b45:	75 19                	jne    806b60 <ipc_call+0xb5>
+  806b47:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806b4e:	ff ff ff 
+  806b51:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b55:	48 8b 00             	mov    (%rax),%rax
+  806b58:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806b5e:	eb 05                	jmp    806b65 <ipc_call+0xba>
+  806b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b65:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806b69:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806b6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b6f:	74 05                	je     806b76 <ipc_call+0xcb>
+		return r;
+  806b71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b74:	eb 17                	jmp    806b8d <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806b76:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806b7d:	ff ff ff 
+  806b80:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b84:	48 8b 00             	mov    (%rax),%rax
+  806b87:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806b8d:	48 83 c4 40          	add    $0x40,%rsp
+  806b91:	5b                   	pop    %rbx
+  806b92:	41 5f                	pop    %r15
+  806b94:	5d                   	pop    %rbp
+  806b95:	c3                   	ret
+
+0000000000806b96 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806b96:	55                   	push   %rbp
+  806b97:	48 89 e5             	mov    %rsp,%rbp
+  806b9a:	41 57                	push   %r15
+  806b9c:	53                   	push   %rbx
+  806b9d:	48 83 ec 70          	sub    $0x70,%rsp
+  806ba1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ba1 <ipc_callw+0xb>
+  806ba8:	49 bb d7 e4 00 00 00 	movabs $0xe4d7,%r11
+  806baf:	00 00 00 
+  806bb2:	4c 01 db             	add    %r11,%rbx
+  806bb5:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806bb8:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806bbb:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806bbf:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806bc3:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806bc8:	76 0a                	jbe    806bd4 <ipc_callw+0x3e>
+		return -E_INVAL;
+  806bca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806bcf:	e9 b7 00 00 00       	jmp    806c8b <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806bd4:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806bd8:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806bdc:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806be0:	48 89 ce             	mov    %rcx,%rsi
+  806be3:	48 89 c7             	mov    %rax,%rdi
+  806be6:	49 89 df             	mov    %rbx,%r15
+  806be9:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  806bf0:	ff ff ff 
+  806bf3:	48 01 d8             	add    %rbx,%rax
+  806bf6:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806bf8:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806bff:	00 
+  806c00:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806c04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806c08:	48 01 d0             	add    %rdx,%rax
+  806c0b:	48 83 e8 01          	sub    $0x1,%rax
+  806c0f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806c13:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  806c1c:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806c20:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c24:	48 29 d0             	sub    %rdx,%rax
+  806c27:	48 c1 e8 03          	shr    $0x3,%rax
+  806c2b:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806c2f:	89 c1                	mov    %eax,%ecx
+  806c31:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806c34:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806c38:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806c3b:	49 89 d1             	mov    %rdx,%r9
+  806c3e:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806c45:	00 00 00 
+  806c48:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806c4f:	00 00 00 
+  806c52:	89 c7                	mov    %eax,%edi
+  806c54:	49 89 df             	mov    %rbx,%r15
+  806c57:	48 b8 2e 13 ff ff ff 	movabs $0xffffffffffff132e,%rax
+  806c5e:	ff ff ff 
+  806c61:	48 01 d8             	add    %rbx,%rax
+  806c64:	ff d0                	call   *%rax
+  806c66:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806c69:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806c6d:	74 05                	je     806c74 <ipc_callw+0xde>
+		return r;
+  806c6f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806c72:	eb 17                	jmp    806c8b <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806c74:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806c7b:	ff ff ff 
+  806c7e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c82:	48 8b 00             	mov    (%rax),%rax
+  806c85:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806c8b:	48 83 c4 70          	add    $0x70,%rsp
+  806c8f:	5b                   	pop    %rbx
+  806c90:	41 5f                	pop    %r15
+  806c92:	5d                   	pop    %rbp
+  806c93:	c3                   	ret
+
+0000000000806c94 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806c94:	55                   	push   %rbp
+  806c95:	48 89 e5             	mov    %rsp,%rbp
+  806c98:	41 57                	push   %r15
+  806c9a:	53                   	push   %rbx
+  806c9b:	48 83 ec 40          	sub    $0x40,%rsp
+  806c9f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c9f <ipc_callv+0xb>
+  806ca6:	49 bb d9 e3 00 00 00 	movabs $0xe3d9,%r11
+  806cad:	00 00 00 
+  806cb0:	4c 01 db             	add    %r11,%rbx
+  806cb3:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806cb6:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806cb9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806cbd:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806cc0:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806cc4:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806cc8:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806ccf:	00 00 00 
+  806cd2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806cd6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806cda:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806cde:	74 11                	je     806cf1 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806ce0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806ce4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806ce8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806ceb:	c1 e0 14             	shl    $0x14,%eax
+  806cee:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806cf1:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806cf5:	74 14                	je     806d0b <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806cf7:	8b 45 20             	mov    0x20(%rbp),%eax
+  806cfa:	83 e8 01             	sub    $0x1,%eax
+  806cfd:	48 63 d0             	movslq %eax,%rdx
+  806d00:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806d04:	48 09 d0             	or     %rdx,%rax
+  806d07:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806d0b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806d0e:	c1 e0 10             	shl    $0x10,%eax
+  806d11:	0b 45 10             	or     0x10(%rbp),%eax
+  806d14:	89 c1                	mov    %eax,%ecx
+  806d16:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806d19:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806d1d:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806d21:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806d25:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806d28:	4d 89 c1             	mov    %r8,%r9
+  806d2b:	49 89 f8             	mov    %rdi,%r8
+  806d2e:	89 c7                	mov    %eax,%edi
+  806d30:	49 89 df             	mov    %rbx,%r15
+  806d33:	48 b8 2e 13 ff ff ff 	movabs $0xffffffffffff132e,%rax
+  806d3a:	ff ff ff 
+  806d3d:	48 01 d8             	add    %rbx,%rax
+  806d40:	ff d0                	call   *%rax
+  806d42:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806d45:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806d49:	74 05                	je     806d50 <ipc_callv+0xbc>
+		return r;
+  806d4b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806d4e:	eb 17                	jmp    806d67 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806d50:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806d57:	ff ff ff 
+  806d5a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d5e:	48 8b 00             	mov    (%rax),%rax
+  806d61:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806d67:	48 83 c4 40          	add    $0x40,%rsp
+  806d6b:	5b                   	pop    %rbx
+  806d6c:	41 5f                	pop    %r15
+  806d6e:	5d                   	pop    %rbp
+  806d6f:	c3                   	ret
+
+0000000000806d70 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806d70:	55                   	push   %rbp
+  806d71:	48 89 e5             	mov    %rsp,%rbp
+  806d74:	41 57                	push   %r15
+  806d76:	53                   	push   %rbx
+  806d77:	48 83 ec 40          	sub    $0x40,%rsp
+  806d7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d7b <ipc_reply_recv+0xb>
+  806d82:	49 bb fd e2 00 00 00 	movabs $0xe2fd,%r11
+  806d89:	00 00 00 
+  806d8c:	4c 01 db             	add    %r11,%rbx
+  806d8f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806d92:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806d95:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806d99:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806d9c:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806da0:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806da4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806da9:	75 0e                	jne    806db9 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806dab:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806db2:	00 00 00 
+  806db5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806db9:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806dbe:	75 0e                	jne    806dce <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806dc0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806dc7:	00 00 00 
+  806dca:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806dce:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806dd1:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806dd5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806dd9:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806ddc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806de0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806de3:	4d 89 c1             	mov    %r8,%r9
+  806de6:	49 89 f8             	mov    %rdi,%r8
+  806de9:	89 c7                	mov    %eax,%edi
+  806deb:	49 89 df             	mov    %rbx,%r15
+  806dee:	48 b8 a2 13 ff ff ff 	movabs $0xffffffffffff13a2,%rax
+  806df5:	ff ff ff 
+  806df8:	48 01 d8             	add    %rbx,%rax
+  806dfb:	ff d0                	call   *%rax
+  806dfd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806e00:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806e05:	74 2a                	je     806e31 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806e07:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806e0b:	75 19                	jne    806e26 <ipc_reply_recv+0xb6>
+  806e0d:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806e14:	ff ff ff 
+  806e17:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e1b:	48 8b 00             	mov    (%rax),%rax
+  806e1e:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806e24:	eb 05                	jmp    806e2b <ipc_reply_recv+0xbb>
+  806e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806e2f:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806e31:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806e36:	74 2a                	je     806e62 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806e38:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806e3c:	75 19                	jne    806e57 <ipc_reply_recv+0xe7>
+  806e3e:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806e45:	ff ff ff 
+  806e48:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e4c:	48 8b 00             	mov    (%rax),%rax
+  806e4f:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806e55:	eb 05                	jmp    806e5c <ipc_reply_recv+0xec>
+  806e57:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e5c:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806e60:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806e62:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806e66:	74 05                	je     806e6d <ipc_reply_recv+0xfd>
+		return r;
+  806e68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e6b:	eb 17                	jmp    806e84 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806e6d:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806e74:	ff ff ff 
+  806e77:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e7b:	48 8b 00             	mov    (%rax),%rax
+  806e7e:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806e84:	48 83 c4 40          	add    $0x40,%rsp
+  806e88:	5b                   	pop    %rbx
+  806e89:	41 5f                	pop    %r15
+  806e8b:	5d                   	pop    %rbp
+  806e8c:	c3                   	ret
+
+0000000000806e8d <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806e8d:	55                   	push   %rbp
+  806e8e:	48 89 e5             	mov    %rsp,%rbp
+  806e91:	41 57                	push   %r15
+  806e93:	53                   	push   %rbx
+  806e94:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806e9b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806e9b <ipc_window_batch+0xe>
+  806ea2:	49 bb dd e1 00 00 00 	movabs $0xe1dd,%r11
+  806ea9:	00 00 00 
+  806eac:	4c 01 db             	add    %r11,%rbx
+  806eaf:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806eb5:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806ebc:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806ec2:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806ec8:	e9 15 01 00 00       	jmp    806fe2 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806ecd:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806ed3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806ed6:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806edd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806ee0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806ee3:	39 c2                	cmp    %eax,%edx
+  806ee5:	0f 4e c2             	cmovle %edx,%eax
+  806ee8:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806eeb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806ef2:	eb 6b                	jmp    806f5f <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806ef4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ef7:	48 98                	cltq
+  806ef9:	48 c1 e0 05          	shl    $0x5,%rax
+  806efd:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806f01:	48 01 e8             	add    %rbp,%rax
+  806f04:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806f0a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806f10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806f13:	c1 e0 0c             	shl    $0xc,%eax
+  806f16:	48 63 d0             	movslq %eax,%rdx
+  806f19:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806f20:	48 01 c2             	add    %rax,%rdx
+  806f23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806f26:	48 98                	cltq
+  806f28:	48 c1 e0 05          	shl    $0x5,%rax
+  806f2c:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806f30:	48 01 e8             	add    %rbp,%rax
+  806f33:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806f39:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806f3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806f3f:	48 98                	cltq
+  806f41:	48 c1 e0 05          	shl    $0x5,%rax
+  806f45:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806f49:	48 01 e8             	add    %rbp,%rax
+  806f4c:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806f53:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806f59:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806f5b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806f5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806f62:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806f65:	7c 8d                	jl     806ef4 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806f67:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806f6e:	74 27                	je     806f97 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806f70:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806f73:	48 63 d0             	movslq %eax,%rdx
+  806f76:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806f7d:	48 89 d6             	mov    %rdx,%rsi
+  806f80:	48 89 c7             	mov    %rax,%rdi
+  806f83:	49 89 df             	mov    %rbx,%r15
+  806f86:	48 b8 45 16 ff ff ff 	movabs $0xffffffffffff1645,%rax
+  806f8d:	ff ff ff 
+  806f90:	48 01 d8             	add    %rbx,%rax
+  806f93:	ff d0                	call   *%rax
+  806f95:	eb 25                	jmp    806fbc <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806f97:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806f9a:	48 63 d0             	movslq %eax,%rdx
+  806f9d:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806fa4:	48 89 d6             	mov    %rdx,%rsi
+  806fa7:	48 89 c7             	mov    %rax,%rdi
+  806faa:	49 89 df             	mov    %rbx,%r15
+  806fad:	48 b8 a3 16 ff ff ff 	movabs $0xffffffffffff16a3,%rax
+  806fb4:	ff ff ff 
+  806fb7:	48 01 d8             	add    %rbx,%rax
+  806fba:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806fbc:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806fbf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806fc3:	79 05                	jns    806fca <ipc_window_batch+0x13d>
+			return r;
+  806fc5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806fc8:	eb 2a                	jmp    806ff4 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806fca:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806fcd:	c1 e0 0c             	shl    $0xc,%eax
+  806fd0:	48 98                	cltq
+  806fd2:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806fd9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806fdc:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806fe2:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806fe9:	0f 8f de fe ff ff    	jg     806ecd <ipc_window_batch+0x40>
+	}
+	return 0;
+  806fef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806ff4:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806ffb:	5b                   	pop    %rbx
+  806ffc:	41 5f                	pop    %r15
+  806ffe:	5d                   	pop    %rbp
+  806fff:	c3                   	ret
+
+0000000000807000 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  807000:	55                   	push   %rbp
+  807001:	48 89 e5             	mov    %rsp,%rbp
+  807004:	48 83 ec 10          	sub    $0x10,%rsp
+  807008:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807008 <ipc_map_window+0x8>
+  80700f:	49 bb 70 e0 00 00 00 	movabs $0xe070,%r11
+  807016:	00 00 00 
+  807019:	4c 01 d8             	add    %r11,%rax
+  80701c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  807020:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  807023:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807026:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80702a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80702f:	bf 01 00 00 00       	mov    $0x1,%edi
+  807034:	49 b8 15 1e ff ff ff 	movabs $0xffffffffffff1e15,%r8
+  80703b:	ff ff ff 
+  80703e:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  807042:	ff d0                	call   *%rax
+}
+  807044:	c9                   	leave
+  807045:	c3                   	ret
+
+0000000000807046 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  807046:	55                   	push   %rbp
+  807047:	48 89 e5             	mov    %rsp,%rbp
+  80704a:	48 83 ec 10          	sub    $0x10,%rsp
+  80704e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80704e <ipc_unmap_window+0x8>
+  807055:	49 bb 2a e0 00 00 00 	movabs $0xe02a,%r11
+  80705c:	00 00 00 
+  80705f:	4c 01 d8             	add    %r11,%rax
+  807062:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  807066:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  807069:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80706c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  807070:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80707a:	49 b8 15 1e ff ff ff 	movabs $0xffffffffffff1e15,%r8
+  807081:	ff ff ff 
+  807084:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  807088:	ff d0                	call   *%rax
+}
+  80708a:	c9                   	leave
+  80708b:	c3                   	ret
+
+000000000080708c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80708c:	55                   	push   %rbp
+  80708d:	48 89 e5             	mov    %rsp,%rbp
+  807090:	48 83 ec 18          	sub    $0x18,%rsp
+  807094:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807094 <ipc_find_env+0x8>
+  80709b:	49 bb e4 df 00 00 00 	movabs $0xdfe4,%r11
+  8070a2:	00 00 00 
+  8070a5:	4c 01 d8             	add    %r11,%rax
+  8070a8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  8070ab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8070b2:	eb 57                	jmp    80710b <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  8070b4:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8070bb:	ff ff ff 
+  8070be:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8070c2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8070c5:	48 63 d2             	movslq %edx,%rdx
+  8070c8:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  8070cf:	48 01 ca             	add    %rcx,%rdx
+  8070d2:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  8070d9:	8b 12                	mov    (%rdx),%edx
+  8070db:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  8070de:	75 27                	jne    807107 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  8070e0:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8070e7:	ff ff ff 
+  8070ea:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8070ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8070f1:	48 98                	cltq
+  8070f3:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8070fa:	48 01 d0             	add    %rdx,%rax
+  8070fd:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  807103:	8b 00                	mov    (%rax),%eax
+  807105:	eb 12                	jmp    807119 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  807107:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80710b:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  807112:	7e a0                	jle    8070b4 <ipc_find_env+0x28>
+	}
+	return 0;
+  807114:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807119:	c9                   	leave
+  80711a:	c3                   	ret
+
+000000000080711b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80711b:	55                   	push   %rbp
+  80711c:	48 89 e5             	mov    %rsp,%rbp
+  80711f:	48 83 ec 08          	sub    $0x8,%rsp
+  807123:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807123 <fd2num+0x8>
+  80712a:	49 bb 55 df 00 00 00 	movabs $0xdf55,%r11
+  807131:	00 00 00 
+  807134:	4c 01 d8             	add    %r11,%rax
+  807137:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80713b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80713f:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  807146:	ff ff ff 
+  807149:	48 01 d0             	add    %rdx,%rax
+  80714c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  807150:	c9                   	leave
+  807151:	c3                   	ret
+
+0000000000807152 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  807152:	55                   	push   %rbp
+  807153:	48 89 e5             	mov    %rsp,%rbp
+  807156:	48 83 ec 08          	sub    $0x8,%rsp
+  80715a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80715a <fd2data+0x8>
+  807161:	49 bb 1e df 00 00 00 	movabs $0xdf1e,%r11
+  807168:	00 00 00 
+  80716b:	4c 01 d8             	add    %r11,%rax
+  80716e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  807172:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  807176:	48 89 d7             	mov    %rdx,%rdi
+  807179:	48 ba a3 20 ff ff ff 	movabs $0xffffffffffff20a3,%rdx
+  807180:	ff ff ff 
+  807183:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  807187:	ff d0                	call   *%rax
+  807189:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80718f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  807193:	c9                   	leave
+  807194:	c3                   	ret
+
+0000000000807195 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  807195:	55                   	push   %rbp
+  807196:	48 89 e5             	mov    %rsp,%rbp
+  807199:	48 83 ec 18          	sub    $0x18,%rsp
+  80719d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80719d <fd_alloc+0x8>
+  8071a4:	49 bb db de 00 00 00 	movabs $0xdedb,%r11
+  8071ab:	00 00 00 
+  8071ae:	4c 01 d8             	add    %r11,%rax
+  8071b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8071b5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8071bc:	eb 75                	jmp    807233 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8071be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8071c1:	48 63 d2             	movslq %edx,%rdx
+  8071c4:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8071cb:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8071cf:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8071d3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8071d7:	48 89 d1             	mov    %rdx,%rcx
+  8071da:	48 c1 e9 15          	shr    $0x15,%rcx
+  8071de:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8071e5:	ff ff ff 
+  8071e8:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8071ec:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8071f0:	83 e2 01             	and    $0x1,%edx
+  8071f3:	48 85 d2             	test   %rdx,%rdx
+  8071f6:	74 25                	je     80721d <fd_alloc+0x88>
+  8071f8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8071fc:	48 89 d1             	mov    %rdx,%rcx
+  8071ff:	48 c1 e9 0c          	shr    $0xc,%rcx
+  807203:	48 ba c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rdx
+  80720a:	ff ff ff 
+  80720d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807211:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807215:	83 e2 01             	and    $0x1,%edx
+  807218:	48 85 d2             	test   %rdx,%rdx
+  80721b:	75 12                	jne    80722f <fd_alloc+0x9a>
+			*fd_store = fd;
+  80721d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807221:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  807225:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  807228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80722d:	eb 1a                	jmp    807249 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  80722f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  807233:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  807237:	7e 85                	jle    8071be <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  807239:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80723d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  807244:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  807249:	c9                   	leave
+  80724a:	c3                   	ret
+
+000000000080724b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80724b:	55                   	push   %rbp
+  80724c:	48 89 e5             	mov    %rsp,%rbp
+  80724f:	48 83 ec 20          	sub    $0x20,%rsp
+  807253:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807253 <fd_lookup+0x8>
+  80725a:	49 bb 25 de 00 00 00 	movabs $0xde25,%r11
+  807261:	00 00 00 
+  807264:	4c 01 d8             	add    %r11,%rax
+  807267:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80726a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80726e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807272:	78 06                	js     80727a <fd_lookup+0x2f>
+  807274:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  807278:	7e 07                	jle    807281 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80727a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80727f:	eb 73                	jmp    8072f4 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  807281:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  807284:	48 63 d2             	movslq %edx,%rdx
+  807287:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  80728e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  807292:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  807296:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80729a:	48 89 d1             	mov    %rdx,%rcx
+  80729d:	48 c1 e9 15          	shr    $0x15,%rcx
+  8072a1:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8072a8:	ff ff ff 
+  8072ab:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8072af:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8072b3:	83 e2 01             	and    $0x1,%edx
+  8072b6:	48 85 d2             	test   %rdx,%rdx
+  8072b9:	74 22                	je     8072dd <fd_lookup+0x92>
+  8072bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8072bf:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8072c3:	48 b9 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rcx
+  8072ca:	ff ff ff 
+  8072cd:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8072d1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8072d5:	83 e0 01             	and    $0x1,%eax
+  8072d8:	48 85 c0             	test   %rax,%rax
+  8072db:	75 07                	jne    8072e4 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8072dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8072e2:	eb 10                	jmp    8072f4 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8072e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8072e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8072ec:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8072ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8072f4:	c9                   	leave
+  8072f5:	c3                   	ret
+
+00000000008072f6 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8072f6:	55                   	push   %rbp
+  8072f7:	48 89 e5             	mov    %rsp,%rbp
+  8072fa:	41 57                	push   %r15
+  8072fc:	53                   	push   %rbx
+  8072fd:	48 83 ec 30          	sub    $0x30,%rsp
+  807301:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807301 <fd_close+0xb>
+  807308:	49 bb 77 dd 00 00 00 	movabs $0xdd77,%r11
+  80730f:	00 00 00 
+  807312:	4c 01 db             	add    %r11,%rbx
+  807315:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  807319:	89 f0                	mov    %esi,%eax
+  80731b:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80731e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807322:	48 89 c7             	mov    %rax,%rdi
+  807325:	48 b8 a3 20 ff ff ff 	movabs $0xffffffffffff20a3,%rax
+  80732c:	ff ff ff 
+  80732f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807333:	ff d0                	call   *%rax
+  807335:	89 c2                	mov    %eax,%edx
+  807337:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80733b:	48 89 c6             	mov    %rax,%rsi
+  80733e:	89 d7                	mov    %edx,%edi
+  807340:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  807347:	ff ff ff 
+  80734a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80734e:	ff d0                	call   *%rax
+  807350:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807353:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807357:	78 0a                	js     807363 <fd_close+0x6d>
+	    || fd != fd2)
+  807359:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80735d:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  807361:	74 12                	je     807375 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  807363:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  807367:	74 05                	je     80736e <fd_close+0x78>
+  807369:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80736c:	eb 7a                	jmp    8073e8 <fd_close+0xf2>
+  80736e:	b8 00 00 00 00       	mov    $0x0,%eax
+  807373:	eb 73                	jmp    8073e8 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  807375:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807379:	8b 00                	mov    (%rax),%eax
+  80737b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80737f:	48 89 d6             	mov    %rdx,%rsi
+  807382:	89 c7                	mov    %eax,%edi
+  807384:	48 b8 79 23 ff ff ff 	movabs $0xffffffffffff2379,%rax
+  80738b:	ff ff ff 
+  80738e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807392:	ff d0                	call   *%rax
+  807394:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807397:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80739b:	78 2a                	js     8073c7 <fd_close+0xd1>
+		if (dev->dev_close)
+  80739d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8073a1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8073a5:	48 85 c0             	test   %rax,%rax
+  8073a8:	74 16                	je     8073c0 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8073aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8073ae:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8073b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8073b6:	48 89 c7             	mov    %rax,%rdi
+  8073b9:	ff d2                	call   *%rdx
+  8073bb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8073be:	eb 07                	jmp    8073c7 <fd_close+0xd1>
+		else
+			r = 0;
+  8073c0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8073c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8073cb:	48 89 c6             	mov    %rax,%rsi
+  8073ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8073d3:	49 89 df             	mov    %rbx,%r15
+  8073d6:	48 b8 84 10 ff ff ff 	movabs $0xffffffffffff1084,%rax
+  8073dd:	ff ff ff 
+  8073e0:	48 01 d8             	add    %rbx,%rax
+  8073e3:	ff d0                	call   *%rax
+	return r;
+  8073e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8073e8:	48 83 c4 30          	add    $0x30,%rsp
+  8073ec:	5b                   	pop    %rbx
+  8073ed:	41 5f                	pop    %r15
+  8073ef:	5d                   	pop    %rbp
+  8073f0:	c3                   	ret
+
+00000000008073f1 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8073f1:	55                   	push   %rbp
+  8073f2:	48 89 e5             	mov    %rsp,%rbp
+  8073f5:	41 57                	push   %r15
+  8073f7:	48 83 ec 28          	sub    $0x28,%rsp
+  8073fb:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8073fb <dev_lookup+0xa>
+  807402:	49 bb 7d dc 00 00 00 	movabs $0xdc7d,%r11
+  807409:	00 00 00 
+  80740c:	4c 01 d9             	add    %r11,%rcx
+  80740f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807412:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  807416:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80741d:	eb 45                	jmp    807464 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  80741f:	48 ba 48 02 00 00 00 	movabs $0x248,%rdx
+  807426:	00 00 00 
+  807429:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80742c:	48 98                	cltq
+  80742e:	48 01 ca             	add    %rcx,%rdx
+  807431:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  807435:	8b 00                	mov    (%rax),%eax
+  807437:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80743a:	75 24                	jne    807460 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  80743c:	48 ba 48 02 00 00 00 	movabs $0x248,%rdx
+  807443:	00 00 00 
+  807446:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807449:	48 98                	cltq
+  80744b:	48 01 ca             	add    %rcx,%rdx
+  80744e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  807452:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807456:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  807459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80745e:	eb 74                	jmp    8074d4 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  807460:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  807464:	48 ba 48 02 00 00 00 	movabs $0x248,%rdx
+  80746b:	00 00 00 
+  80746e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807471:	48 98                	cltq
+  807473:	48 01 ca             	add    %rcx,%rdx
+  807476:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80747a:	48 85 c0             	test   %rax,%rax
+  80747d:	75 a0                	jne    80741f <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80747f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  807486:	ff ff ff 
+  807489:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  80748d:	48 8b 00             	mov    (%rax),%rax
+  807490:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  807496:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  807499:	89 c6                	mov    %eax,%esi
+  80749b:	48 b8 80 5b ff ff ff 	movabs $0xffffffffffff5b80,%rax
+  8074a2:	ff ff ff 
+  8074a5:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8074a9:	48 89 c7             	mov    %rax,%rdi
+  8074ac:	49 89 cf             	mov    %rcx,%r15
+  8074af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8074b4:	49 b8 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%r8
+  8074bb:	ff ff ff 
+  8074be:	49 01 c8             	add    %rcx,%r8
+  8074c1:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8074c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8074c8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8074cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8074d4:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8074d8:	c9                   	leave
+  8074d9:	c3                   	ret
+
+00000000008074da <close>:
+
+int
+close(int fdnum)
+{
+  8074da:	55                   	push   %rbp
+  8074db:	48 89 e5             	mov    %rsp,%rbp
+  8074de:	53                   	push   %rbx
+  8074df:	48 83 ec 28          	sub    $0x28,%rsp
+  8074e3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8074e3 <close+0x9>
+  8074ea:	49 bb 95 db 00 00 00 	movabs $0xdb95,%r11
+  8074f1:	00 00 00 
+  8074f4:	4c 01 db             	add    %r11,%rbx
+  8074f7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8074fa:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8074fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807501:	48 89 d6             	mov    %rdx,%rsi
+  807504:	89 c7                	mov    %eax,%edi
+  807506:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  80750d:	ff ff ff 
+  807510:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807514:	ff d0                	call   *%rax
+  807516:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807519:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80751d:	79 05                	jns    807524 <close+0x4a>
+		return r;
+  80751f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807522:	eb 1c                	jmp    807540 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  807524:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807528:	be 01 00 00 00       	mov    $0x1,%esi
+  80752d:	48 89 c7             	mov    %rax,%rdi
+  807530:	48 b8 7e 22 ff ff ff 	movabs $0xffffffffffff227e,%rax
+  807537:	ff ff ff 
+  80753a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80753e:	ff d0                	call   *%rax
+}
+  807540:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807544:	c9                   	leave
+  807545:	c3                   	ret
+
+0000000000807546 <close_all>:
+
+void
+close_all(void)
+{
+  807546:	55                   	push   %rbp
+  807547:	48 89 e5             	mov    %rsp,%rbp
+  80754a:	53                   	push   %rbx
+  80754b:	48 83 ec 18          	sub    $0x18,%rsp
+  80754f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80754f <close_all+0x9>
+  807556:	49 bb 29 db 00 00 00 	movabs $0xdb29,%r11
+  80755d:	00 00 00 
+  807560:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  807563:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80756a:	eb 19                	jmp    807585 <close_all+0x3f>
+		close(i);
+  80756c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80756f:	89 c7                	mov    %eax,%edi
+  807571:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  807578:	ff ff ff 
+  80757b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80757f:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  807581:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  807585:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  807589:	7e e1                	jle    80756c <close_all+0x26>
+}
+  80758b:	90                   	nop
+  80758c:	90                   	nop
+  80758d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807591:	c9                   	leave
+  807592:	c3                   	ret
+
+0000000000807593 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  807593:	55                   	push   %rbp
+  807594:	48 89 e5             	mov    %rsp,%rbp
+  807597:	41 57                	push   %r15
+  807599:	53                   	push   %rbx
+  80759a:	48 83 ec 40          	sub    $0x40,%rsp
+  80759e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80759e <dup+0xb>
+  8075a5:	49 bb da da 00 00 00 	movabs $0xdada,%r11
+  8075ac:	00 00 00 
+  8075af:	4c 01 db             	add    %r11,%rbx
+  8075b2:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8075b5:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8075b8:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8075bc:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8075bf:	48 89 d6             	mov    %rdx,%rsi
+  8075c2:	89 c7                	mov    %eax,%edi
+  8075c4:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  8075cb:	ff ff ff 
+  8075ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8075d2:	ff d0                	call   *%rax
+  8075d4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8075d7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8075db:	79 08                	jns    8075e5 <dup+0x52>
+		return r;
+  8075dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8075e0:	e9 a4 01 00 00       	jmp    807789 <dup+0x1f6>
+	close(newfdnum);
+  8075e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8075e8:	89 c7                	mov    %eax,%edi
+  8075ea:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  8075f1:	ff ff ff 
+  8075f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8075f8:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8075fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8075fd:	48 98                	cltq
+  8075ff:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  807605:	48 c1 e0 0c          	shl    $0xc,%rax
+  807609:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  80760d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807611:	48 89 c7             	mov    %rax,%rdi
+  807614:	48 b8 da 20 ff ff ff 	movabs $0xffffffffffff20da,%rax
+  80761b:	ff ff ff 
+  80761e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807622:	ff d0                	call   *%rax
+  807624:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  807628:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80762c:	48 89 c7             	mov    %rax,%rdi
+  80762f:	48 b8 da 20 ff ff ff 	movabs $0xffffffffffff20da,%rax
+  807636:	ff ff ff 
+  807639:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80763d:	ff d0                	call   *%rax
+  80763f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  807643:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807647:	48 c1 e8 15          	shr    $0x15,%rax
+  80764b:	48 89 c2             	mov    %rax,%rdx
+  80764e:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  807655:	ff ff ff 
+  807658:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80765c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807660:	83 e0 01             	and    $0x1,%eax
+  807663:	48 85 c0             	test   %rax,%rax
+  807666:	74 7f                	je     8076e7 <dup+0x154>
+  807668:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80766c:	48 c1 e8 0c          	shr    $0xc,%rax
+  807670:	48 89 c2             	mov    %rax,%rdx
+  807673:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80767a:	ff ff ff 
+  80767d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807681:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807685:	83 e0 01             	and    $0x1,%eax
+  807688:	48 85 c0             	test   %rax,%rax
+  80768b:	74 5a                	je     8076e7 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80768d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807691:	48 c1 e8 0c          	shr    $0xc,%rax
+  807695:	48 89 c2             	mov    %rax,%rdx
+  807698:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80769f:	ff ff ff 
+  8076a2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8076a6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8076aa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8076af:	89 c1                	mov    %eax,%ecx
+  8076b1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8076b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8076b9:	41 89 c8             	mov    %ecx,%r8d
+  8076bc:	48 89 d1             	mov    %rdx,%rcx
+  8076bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8076c4:	48 89 c6             	mov    %rax,%rsi
+  8076c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8076cc:	49 89 df             	mov    %rbx,%r15
+  8076cf:	48 b8 11 10 ff ff ff 	movabs $0xffffffffffff1011,%rax
+  8076d6:	ff ff ff 
+  8076d9:	48 01 d8             	add    %rbx,%rax
+  8076dc:	ff d0                	call   *%rax
+  8076de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8076e1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8076e5:	78 5f                	js     807746 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8076e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8076eb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8076ef:	48 89 c2             	mov    %rax,%rdx
+  8076f2:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8076f9:	ff ff ff 
+  8076fc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807700:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807704:	25 07 0e 00 00       	and    $0xe07,%eax
+  807709:	89 c1                	mov    %eax,%ecx
+  80770b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80770f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807713:	41 89 c8             	mov    %ecx,%r8d
+  807716:	48 89 d1             	mov    %rdx,%rcx
+  807719:	ba 00 00 00 00       	mov    $0x0,%edx
+  80771e:	48 89 c6             	mov    %rax,%rsi
+  807721:	bf 00 00 00 00       	mov    $0x0,%edi
+  807726:	49 89 df             	mov    %rbx,%r15
+  807729:	48 b8 11 10 ff ff ff 	movabs $0xffffffffffff1011,%rax
+  807730:	ff ff ff 
+  807733:	48 01 d8             	add    %rbx,%rax
+  807736:	ff d0                	call   *%rax
+  807738:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80773b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80773f:	78 08                	js     807749 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  807741:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807744:	eb 43                	jmp    807789 <dup+0x1f6>
+			goto err;
+  807746:	90                   	nop
+  807747:	eb 01                	jmp    80774a <dup+0x1b7>
+		goto err;
+  807749:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80774a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80774e:	48 89 c6             	mov    %rax,%rsi
+  807751:	bf 00 00 00 00       	mov    $0x0,%edi
+  807756:	49 89 df             	mov    %rbx,%r15
+  807759:	48 b8 84 10 ff ff ff 	movabs $0xffffffffffff1084,%rax
+  807760:	ff ff ff 
+  807763:	48 01 d8             	add    %rbx,%rax
+  807766:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  807768:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80776c:	48 89 c6             	mov    %rax,%rsi
+  80776f:	bf 00 00 00 00       	mov    $0x0,%edi
+  807774:	49 89 df             	mov    %rbx,%r15
+  807777:	48 b8 84 10 ff ff ff 	movabs $0xffffffffffff1084,%rax
+  80777e:	ff ff ff 
+  807781:	48 01 d8             	add    %rbx,%rax
+  807784:	ff d0                	call   *%rax
+	return r;
+  807786:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  807789:	48 83 c4 40          	add    $0x40,%rsp
+  80778d:	5b                   	pop    %rbx
+  80778e:	41 5f                	pop    %r15
+  807790:	5d                   	pop    %rbp
+  807791:	c3                   	ret
+
+0000000000807792 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  807792:	55                   	push   %rbp
+  807793:	48 89 e5             	mov    %rsp,%rbp
+  807796:	41 57                	push   %r15
+  807798:	53                   	push   %rbx
+  807799:	48 83 ec 40          	sub    $0x40,%rsp
+  80779d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80779d <read+0xb>
+  8077a4:	49 bb db d8 00 00 00 	movabs $0xd8db,%r11
+  8077ab:	00 00 00 
+  8077ae:	4c 01 db             	add    %r11,%rbx
+  8077b1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8077b4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8077b8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8077bc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8077c0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8077c3:	48 89 d6             	mov    %rdx,%rsi
+  8077c6:	89 c7                	mov    %eax,%edi
+  8077c8:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  8077cf:	ff ff ff 
+  8077d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8077d6:	ff d0                	call   *%rax
+  8077d8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8077db:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8077df:	78 28                	js     807809 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8077e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8077e5:	8b 00                	mov    (%rax),%eax
+  8077e7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8077eb:	48 89 d6             	mov    %rdx,%rsi
+  8077ee:	89 c7                	mov    %eax,%edi
+  8077f0:	48 b8 79 23 ff ff ff 	movabs $0xffffffffffff2379,%rax
+  8077f7:	ff ff ff 
+  8077fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8077fe:	ff d0                	call   *%rax
+  807800:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807803:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807807:	79 08                	jns    807811 <read+0x7f>
+		return r;
+  807809:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80780c:	e9 8b 00 00 00       	jmp    80789c <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  807811:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807815:	8b 40 08             	mov    0x8(%rax),%eax
+  807818:	83 e0 03             	and    $0x3,%eax
+  80781b:	83 f8 01             	cmp    $0x1,%eax
+  80781e:	75 4b                	jne    80786b <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  807820:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  807827:	ff ff ff 
+  80782a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80782e:	48 8b 00             	mov    (%rax),%rax
+  807831:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  807837:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80783a:	89 c6                	mov    %eax,%esi
+  80783c:	48 b8 9f 5b ff ff ff 	movabs $0xffffffffffff5b9f,%rax
+  807843:	ff ff ff 
+  807846:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80784a:	48 89 c7             	mov    %rax,%rdi
+  80784d:	49 89 df             	mov    %rbx,%r15
+  807850:	b8 00 00 00 00       	mov    $0x0,%eax
+  807855:	48 b9 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rcx
+  80785c:	ff ff ff 
+  80785f:	48 01 d9             	add    %rbx,%rcx
+  807862:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  807864:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807869:	eb 31                	jmp    80789c <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80786b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80786f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  807873:	48 85 c0             	test   %rax,%rax
+  807876:	75 07                	jne    80787f <read+0xed>
+		return -E_NOT_SUPP;
+  807878:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80787d:	eb 1d                	jmp    80789c <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  80787f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807883:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  807887:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80788b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80788f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  807893:	48 89 ce             	mov    %rcx,%rsi
+  807896:	48 89 c7             	mov    %rax,%rdi
+  807899:	41 ff d0             	call   *%r8
+}
+  80789c:	48 83 c4 40          	add    $0x40,%rsp
+  8078a0:	5b                   	pop    %rbx
+  8078a1:	41 5f                	pop    %r15
+  8078a3:	5d                   	pop    %rbp
+  8078a4:	c3                   	ret
+
+00000000008078a5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8078a5:	55                   	push   %rbp
+  8078a6:	48 89 e5             	mov    %rsp,%rbp
+  8078a9:	53                   	push   %rbx
+  8078aa:	48 83 ec 38          	sub    $0x38,%rsp
+  8078ae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8078ae <readn+0x9>
+  8078b5:	49 bb ca d7 00 00 00 	movabs $0xd7ca,%r11
+  8078bc:	00 00 00 
+  8078bf:	4c 01 db             	add    %r11,%rbx
+  8078c2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8078c5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8078c9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8078cd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8078d4:	eb 4b                	jmp    807921 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8078d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8078d9:	48 98                	cltq
+  8078db:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8078df:	48 29 c2             	sub    %rax,%rdx
+  8078e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8078e5:	48 63 c8             	movslq %eax,%rcx
+  8078e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8078ec:	48 01 c1             	add    %rax,%rcx
+  8078ef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8078f2:	48 89 ce             	mov    %rcx,%rsi
+  8078f5:	89 c7                	mov    %eax,%edi
+  8078f7:	48 b8 1a 27 ff ff ff 	movabs $0xffffffffffff271a,%rax
+  8078fe:	ff ff ff 
+  807901:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807905:	ff d0                	call   *%rax
+  807907:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80790a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80790e:	79 05                	jns    807915 <readn+0x70>
+			return m;
+  807910:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  807913:	eb 1d                	jmp    807932 <readn+0x8d>
+		if (m == 0)
+  807915:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  807919:	74 13                	je     80792e <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80791b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80791e:	01 45 ec             	add    %eax,-0x14(%rbp)
+  807921:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807924:	48 98                	cltq
+  807926:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80792a:	72 aa                	jb     8078d6 <readn+0x31>
+  80792c:	eb 01                	jmp    80792f <readn+0x8a>
+			break;
+  80792e:	90                   	nop
+	}
+	return tot;
+  80792f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  807932:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807936:	c9                   	leave
+  807937:	c3                   	ret
+
+0000000000807938 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  807938:	55                   	push   %rbp
+  807939:	48 89 e5             	mov    %rsp,%rbp
+  80793c:	41 57                	push   %r15
+  80793e:	53                   	push   %rbx
+  80793f:	48 83 ec 40          	sub    $0x40,%rsp
+  807943:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807943 <write+0xb>
+  80794a:	49 bb 35 d7 00 00 00 	movabs $0xd735,%r11
+  807951:	00 00 00 
+  807954:	4c 01 db             	add    %r11,%rbx
+  807957:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80795a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80795e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  807962:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  807966:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  807969:	48 89 d6             	mov    %rdx,%rsi
+  80796c:	89 c7                	mov    %eax,%edi
+  80796e:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  807975:	ff ff ff 
+  807978:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80797c:	ff d0                	call   *%rax
+  80797e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807981:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807985:	78 28                	js     8079af <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  807987:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80798b:	8b 00                	mov    (%rax),%eax
+  80798d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  807991:	48 89 d6             	mov    %rdx,%rsi
+  807994:	89 c7                	mov    %eax,%edi
+  807996:	48 b8 79 23 ff ff ff 	movabs $0xffffffffffff2379,%rax
+  80799d:	ff ff ff 
+  8079a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8079a4:	ff d0                	call   *%rax
+  8079a6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8079a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8079ad:	79 08                	jns    8079b7 <write+0x7f>
+		return r;
+  8079af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8079b2:	e9 8a 00 00 00       	jmp    807a41 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8079b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8079bb:	8b 40 08             	mov    0x8(%rax),%eax
+  8079be:	83 e0 03             	and    $0x3,%eax
+  8079c1:	85 c0                	test   %eax,%eax
+  8079c3:	75 4b                	jne    807a10 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8079c5:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8079cc:	ff ff ff 
+  8079cf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8079d3:	48 8b 00             	mov    (%rax),%rax
+  8079d6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8079dc:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8079df:	89 c6                	mov    %eax,%esi
+  8079e1:	48 b8 bb 5b ff ff ff 	movabs $0xffffffffffff5bbb,%rax
+  8079e8:	ff ff ff 
+  8079eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8079ef:	48 89 c7             	mov    %rax,%rdi
+  8079f2:	49 89 df             	mov    %rbx,%r15
+  8079f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8079fa:	48 b9 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rcx
+  807a01:	ff ff ff 
+  807a04:	48 01 d9             	add    %rbx,%rcx
+  807a07:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  807a09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807a0e:	eb 31                	jmp    807a41 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  807a10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807a14:	48 8b 40 18          	mov    0x18(%rax),%rax
+  807a18:	48 85 c0             	test   %rax,%rax
+  807a1b:	75 07                	jne    807a24 <write+0xec>
+		return -E_NOT_SUPP;
+  807a1d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  807a22:	eb 1d                	jmp    807a41 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  807a24:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807a28:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  807a2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807a30:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  807a34:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  807a38:	48 89 ce             	mov    %rcx,%rsi
+  807a3b:	48 89 c7             	mov    %rax,%rdi
+  807a3e:	41 ff d0             	call   *%r8
+}
+  807a41:	48 83 c4 40          	add    $0x40,%rsp
+  807a45:	5b                   	pop    %rbx
+  807a46:	41 5f                	pop    %r15
+  807a48:	5d                   	pop    %rbp
+  807a49:	c3                   	ret
+
+0000000000807a4a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  807a4a:	55                   	push   %rbp
+  807a4b:	48 89 e5             	mov    %rsp,%rbp
+  807a4e:	48 83 ec 18          	sub    $0x18,%rsp
+  807a52:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807a52 <seek+0x8>
+  807a59:	49 bb 26 d6 00 00 00 	movabs $0xd626,%r11
+  807a60:	00 00 00 
+  807a63:	4c 01 d8             	add    %r11,%rax
+  807a66:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  807a69:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  807a6c:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  807a70:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  807a73:	48 89 ce             	mov    %rcx,%rsi
+  807a76:	89 d7                	mov    %edx,%edi
+  807a78:	48 ba d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rdx
+  807a7f:	ff ff ff 
+  807a82:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  807a86:	ff d0                	call   *%rax
+  807a88:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  807a8b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807a8f:	79 05                	jns    807a96 <seek+0x4c>
+		return r;
+  807a91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807a94:	eb 0f                	jmp    807aa5 <seek+0x5b>
+	fd->fd_offset = offset;
+  807a96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807a9a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  807a9d:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  807aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807aa5:	c9                   	leave
+  807aa6:	c3                   	ret
+
+0000000000807aa7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  807aa7:	55                   	push   %rbp
+  807aa8:	48 89 e5             	mov    %rsp,%rbp
+  807aab:	41 57                	push   %r15
+  807aad:	53                   	push   %rbx
+  807aae:	48 83 ec 30          	sub    $0x30,%rsp
+  807ab2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807ab2 <ftruncate+0xb>
+  807ab9:	49 bb c6 d5 00 00 00 	movabs $0xd5c6,%r11
+  807ac0:	00 00 00 
+  807ac3:	4c 01 db             	add    %r11,%rbx
+  807ac6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  807ac9:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  807acc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  807ad0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  807ad3:	48 89 d6             	mov    %rdx,%rsi
+  807ad6:	89 c7                	mov    %eax,%edi
+  807ad8:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  807adf:	ff ff ff 
+  807ae2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807ae6:	ff d0                	call   *%rax
+  807ae8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807aeb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807aef:	78 28                	js     807b19 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  807af1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807af5:	8b 00                	mov    (%rax),%eax
+  807af7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  807afb:	48 89 d6             	mov    %rdx,%rsi
+  807afe:	89 c7                	mov    %eax,%edi
+  807b00:	48 b8 79 23 ff ff ff 	movabs $0xffffffffffff2379,%rax
+  807b07:	ff ff ff 
+  807b0a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807b0e:	ff d0                	call   *%rax
+  807b10:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807b13:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807b17:	79 08                	jns    807b21 <ftruncate+0x7a>
+		return r;
+  807b19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807b1c:	e9 83 00 00 00       	jmp    807ba4 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  807b21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807b25:	8b 40 08             	mov    0x8(%rax),%eax
+  807b28:	83 e0 03             	and    $0x3,%eax
+  807b2b:	85 c0                	test   %eax,%eax
+  807b2d:	75 4b                	jne    807b7a <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  807b2f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  807b36:	ff ff ff 
+  807b39:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807b3d:	48 8b 00             	mov    (%rax),%rax
+  807b40:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  807b46:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  807b49:	89 c6                	mov    %eax,%esi
+  807b4b:	48 b8 d8 5b ff ff ff 	movabs $0xffffffffffff5bd8,%rax
+  807b52:	ff ff ff 
+  807b55:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807b59:	48 89 c7             	mov    %rax,%rdi
+  807b5c:	49 89 df             	mov    %rbx,%r15
+  807b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  807b64:	48 b9 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rcx
+  807b6b:	ff ff ff 
+  807b6e:	48 01 d9             	add    %rbx,%rcx
+  807b71:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  807b73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807b78:	eb 2a                	jmp    807ba4 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  807b7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807b7e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  807b82:	48 85 c0             	test   %rax,%rax
+  807b85:	75 07                	jne    807b8e <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  807b87:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  807b8c:	eb 16                	jmp    807ba4 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  807b8e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807b92:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  807b96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807b9a:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  807b9d:	89 d6                	mov    %edx,%esi
+  807b9f:	48 89 c7             	mov    %rax,%rdi
+  807ba2:	ff d1                	call   *%rcx
+}
+  807ba4:	48 83 c4 30          	add    $0x30,%rsp
+  807ba8:	5b                   	pop    %rbx
+  807ba9:	41 5f                	pop    %r15
+  807bab:	5d                   	pop    %rbp
+  807bac:	c3                   	ret
+
+0000000000807bad <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  807bad:	55                   	push   %rbp
+  807bae:	48 89 e5             	mov    %rsp,%rbp
+  807bb1:	53                   	push   %rbx
+  807bb2:	48 83 ec 38          	sub    $0x38,%rsp
+  807bb6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807bb6 <fstat+0x9>
+  807bbd:	49 bb c2 d4 00 00 00 	movabs $0xd4c2,%r11
+  807bc4:	00 00 00 
+  807bc7:	4c 01 db             	add    %r11,%rbx
+  807bca:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  807bcd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  807bd1:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  807bd5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  807bd8:	48 89 d6             	mov    %rdx,%rsi
+  807bdb:	89 c7                	mov    %eax,%edi
+  807bdd:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  807be4:	ff ff ff 
+  807be7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807beb:	ff d0                	call   *%rax
+  807bed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807bf0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807bf4:	78 28                	js     807c1e <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  807bf6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807bfa:	8b 00                	mov    (%rax),%eax
+  807bfc:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  807c00:	48 89 d6             	mov    %rdx,%rsi
+  807c03:	89 c7                	mov    %eax,%edi
+  807c05:	48 b8 79 23 ff ff ff 	movabs $0xffffffffffff2379,%rax
+  807c0c:	ff ff ff 
+  807c0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807c13:	ff d0                	call   *%rax
+  807c15:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807c18:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807c1c:	79 05                	jns    807c23 <fstat+0x76>
+		return r;
+  807c1e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807c21:	eb 5e                	jmp    807c81 <fstat+0xd4>
+	if (!dev->dev_stat)
+  807c23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807c27:	48 8b 40 28          	mov    0x28(%rax),%rax
+  807c2b:	48 85 c0             	test   %rax,%rax
+  807c2e:	75 07                	jne    807c37 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  807c30:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  807c35:	eb 4a                	jmp    807c81 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  807c37:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807c3b:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  807c3e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807c42:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  807c49:	00 00 00 
+	stat->st_isdir = 0;
+  807c4c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807c50:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  807c57:	00 00 00 
+	stat->st_dev = dev;
+  807c5a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807c5e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807c62:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  807c69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807c6d:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  807c71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807c75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807c79:	48 89 d6             	mov    %rdx,%rsi
+  807c7c:	48 89 c7             	mov    %rax,%rdi
+  807c7f:	ff d1                	call   *%rcx
+}
+  807c81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  807c85:	c9                   	leave
+  807c86:	c3                   	ret
+
+0000000000807c87 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  807c87:	55                   	push   %rbp
+  807c88:	48 89 e5             	mov    %rsp,%rbp
+  807c8b:	41 57                	push   %r15
+  807c8d:	53                   	push   %rbx
+  807c8e:	48 83 ec 20          	sub    $0x20,%rsp
+  807c92:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807c92 <stat+0xb>
+  807c99:	49 bb e6 d3 00 00 00 	movabs $0xd3e6,%r11
+  807ca0:	00 00 00 
+  807ca3:	4c 01 db             	add    %r11,%rbx
+  807ca6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  807caa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  807cae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807cb2:	be 00 00 00 00       	mov    $0x0,%esi
+  807cb7:	48 89 c7             	mov    %rax,%rdi
+  807cba:	49 89 df             	mov    %rbx,%r15
+  807cbd:	48 b8 e9 2e ff ff ff 	movabs $0xffffffffffff2ee9,%rax
+  807cc4:	ff ff ff 
+  807cc7:	48 01 d8             	add    %rbx,%rax
+  807cca:	ff d0                	call   *%rax
+  807ccc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807ccf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807cd3:	79 05                	jns    807cda <stat+0x53>
+		return fd;
+  807cd5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807cd8:	eb 37                	jmp    807d11 <stat+0x8a>
+	r = fstat(fd, stat);
+  807cda:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  807cde:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807ce1:	48 89 d6             	mov    %rdx,%rsi
+  807ce4:	89 c7                	mov    %eax,%edi
+  807ce6:	48 b8 35 2b ff ff ff 	movabs $0xffffffffffff2b35,%rax
+  807ced:	ff ff ff 
+  807cf0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807cf4:	ff d0                	call   *%rax
+  807cf6:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  807cf9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807cfc:	89 c7                	mov    %eax,%edi
+  807cfe:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  807d05:	ff ff ff 
+  807d08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807d0c:	ff d0                	call   *%rax
+	return r;
+  807d0e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  807d11:	48 83 c4 20          	add    $0x20,%rsp
+  807d15:	5b                   	pop    %rbx
+  807d16:	41 5f                	pop    %r15
+  807d18:	5d                   	pop    %rbp
+  807d19:	c3                   	ret
+
+0000000000807d1a <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  807d1a:	55                   	push   %rbp
+  807d1b:	48 89 e5             	mov    %rsp,%rbp
+  807d1e:	41 57                	push   %r15
+  807d20:	53                   	push   %rbx
+  807d21:	48 83 ec 10          	sub    $0x10,%rsp
+  807d25:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807d25 <fsipc+0xb>
+  807d2c:	49 bb 53 d3 00 00 00 	movabs $0xd353,%r11
+  807d33:	00 00 00 
+  807d36:	4c 01 db             	add    %r11,%rbx
+  807d39:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  807d3c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  807d40:	48 b8 88 13 00 00 00 	movabs $0x1388,%rax
+  807d47:	00 00 00 
+  807d4a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807d4d:	85 c0                	test   %eax,%eax
+  807d4f:	75 24                	jne    807d75 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  807d51:	bf 01 00 00 00       	mov    $0x1,%edi
+  807d56:	49 89 df             	mov    %rbx,%r15
+  807d59:	48 b8 14 20 ff ff ff 	movabs $0xffffffffffff2014,%rax
+  807d60:	ff ff ff 
+  807d63:	48 01 d8             	add    %rbx,%rax
+  807d66:	ff d0                	call   *%rax
+  807d68:	48 ba 88 13 00 00 00 	movabs $0x1388,%rdx
+  807d6f:	00 00 00 
+  807d72:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  807d75:	48 b8 88 13 00 00 00 	movabs $0x1388,%rax
+  807d7c:	00 00 00 
+  807d7f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807d82:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807d86:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  807d89:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  807d8f:	49 89 d0             	mov    %rdx,%r8
+  807d92:	b9 07 00 00 00       	mov    $0x7,%ecx
+  807d97:	48 ba 88 2f 01 00 00 	movabs $0x12f88,%rdx
+  807d9e:	00 00 00 
+  807da1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  807da5:	89 c7                	mov    %eax,%edi
+  807da7:	49 89 df             	mov    %rbx,%r15
+  807daa:	48 b8 33 1a ff ff ff 	movabs $0xffffffffffff1a33,%rax
+  807db1:	ff ff ff 
+  807db4:	48 01 d8             	add    %rbx,%rax
+  807db7:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  807db9:	48 83 c4 10          	add    $0x10,%rsp
+  807dbd:	5b                   	pop    %rbx
+  807dbe:	41 5f                	pop    %r15
+  807dc0:	5d                   	pop    %rbp
+  807dc1:	c3                   	ret
+
+0000000000807dc2 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  807dc2:	55                   	push   %rbp
+  807dc3:	48 89 e5             	mov    %rsp,%rbp
+  807dc6:	41 57                	push   %r15
+  807dc8:	53                   	push   %rbx
+  807dc9:	48 83 ec 20          	sub    $0x20,%rsp
+  807dcd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807dcd <fsipc_words+0xb>
+  807dd4:	49 bb ab d2 00 00 00 	movabs $0xd2ab,%r11
+  807ddb:	00 00 00 
+  807dde:	4c 01 db             	add    %r11,%rbx
+  807de1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  807de4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  807de8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  807dec:	48 b8 88 13 00 00 00 	movabs $0x1388,%rax
+  807df3:	00 00 00 
+  807df6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807df9:	85 c0                	test   %eax,%eax
+  807dfb:	75 24                	jne    807e21 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  807dfd:	bf 01 00 00 00       	mov    $0x1,%edi
+  807e02:	49 89 df             	mov    %rbx,%r15
+  807e05:	48 b8 14 20 ff ff ff 	movabs $0xffffffffffff2014,%rax
+  807e0c:	ff ff ff 
+  807e0f:	48 01 d8             	add    %rbx,%rax
+  807e12:	ff d0                	call   *%rax
+  807e14:	48 ba 88 13 00 00 00 	movabs $0x1388,%rdx
+  807e1b:	00 00 00 
+  807e1e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  807e21:	48 b8 88 13 00 00 00 	movabs $0x1388,%rax
+  807e28:	00 00 00 
+  807e2b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807e2e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  807e32:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807e36:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  807e39:	89 c7                	mov    %eax,%edi
+  807e3b:	49 89 df             	mov    %rbx,%r15
+  807e3e:	48 b8 1e 1b ff ff ff 	movabs $0xffffffffffff1b1e,%rax
+  807e45:	ff ff ff 
+  807e48:	48 01 d8             	add    %rbx,%rax
+  807e4b:	ff d0                	call   *%rax
+}
+  807e4d:	48 83 c4 20          	add    $0x20,%rsp
+  807e51:	5b                   	pop    %rbx
+  807e52:	41 5f                	pop    %r15
+  807e54:	5d                   	pop    %rbp
+  807e55:	c3                   	ret
+
+0000000000807e56 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  807e56:	55                   	push   %rbp
+  807e57:	48 89 e5             	mov    %rsp,%rbp
+  807e5a:	41 57                	push   %r15
+  807e5c:	53                   	push   %rbx
+  807e5d:	48 83 ec 40          	sub    $0x40,%rsp
+  807e61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807e61 <fsipc_pages+0xb>
+  807e68:	49 bb 17 d2 00 00 00 	movabs $0xd217,%r11
+  807e6f:	00 00 00 
+  807e72:	4c 01 db             	add    %r11,%rbx
+  807e75:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  807e78:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  807e7c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  807e80:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  807e83:	48 b8 88 13 00 00 00 	movabs $0x1388,%rax
+  807e8a:	00 00 00 
+  807e8d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807e90:	85 c0                	test   %eax,%eax
+  807e92:	75 24                	jne    807eb8 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  807e94:	bf 01 00 00 00       	mov    $0x1,%edi
+  807e99:	49 89 df             	mov    %rbx,%r15
+  807e9c:	48 b8 14 20 ff ff ff 	movabs $0xffffffffffff2014,%rax
+  807ea3:	ff ff ff 
+  807ea6:	48 01 d8             	add    %rbx,%rax
+  807ea9:	ff d0                	call   *%rax
+  807eab:	48 ba 88 13 00 00 00 	movabs $0x1388,%rdx
+  807eb2:	00 00 00 
+  807eb5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  807eb8:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  807ebd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  807ec1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  807ec4:	48 98                	cltq
+  807ec6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  807eca:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  807ece:	0f 95 c0             	setne  %al
+  807ed1:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  807ed4:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  807edb:	00 
+  807edc:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  807ee0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807ee4:	48 01 d0             	add    %rdx,%rax
+  807ee7:	48 83 e8 01          	sub    $0x1,%rax
+  807eeb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  807eef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807ef3:	ba 00 00 00 00       	mov    $0x0,%edx
+  807ef8:	48 f7 75 e8          	divq   -0x18(%rbp)
+  807efc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807f00:	48 29 d0             	sub    %rdx,%rax
+  807f03:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  807f07:	41 89 c2             	mov    %eax,%r10d
+  807f0a:	48 b8 88 13 00 00 00 	movabs $0x1388,%rax
+  807f11:	00 00 00 
+  807f14:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807f17:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  807f1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807f1f:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  807f22:	48 83 ec 08          	sub    $0x8,%rsp
+  807f26:	6a 40                	push   $0x40
+  807f28:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  807f2d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  807f34:	00 
+  807f35:	6a 05                	push   $0x5
+  807f37:	41 89 f9             	mov    %edi,%r9d
+  807f3a:	49 89 c8             	mov    %rcx,%r8
+  807f3d:	44 89 d1             	mov    %r10d,%ecx
+  807f40:	89 c7                	mov    %eax,%edi
+  807f42:	49 89 df             	mov    %rbx,%r15
+  807f45:	48 b8 1c 1c ff ff ff 	movabs $0xffffffffffff1c1c,%rax
+  807f4c:	ff ff ff 
+  807f4f:	48 01 d8             	add    %rbx,%rax
+  807f52:	ff d0                	call   *%rax
+  807f54:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  807f58:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  807f5c:	5b                   	pop    %rbx
+  807f5d:	41 5f                	pop    %r15
+  807f5f:	5d                   	pop    %rbp
+  807f60:	c3                   	ret
+
+0000000000807f61 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  807f61:	55                   	push   %rbp
+  807f62:	48 89 e5             	mov    %rsp,%rbp
+  807f65:	41 57                	push   %r15
+  807f67:	53                   	push   %rbx
+  807f68:	48 83 ec 20          	sub    $0x20,%rsp
+  807f6c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807f6c <open+0xb>
+  807f73:	49 bb 0c d1 00 00 00 	movabs $0xd10c,%r11
+  807f7a:	00 00 00 
+  807f7d:	4c 01 db             	add    %r11,%rbx
+  807f80:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  807f84:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  807f87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807f8b:	48 89 c7             	mov    %rax,%rdi
+  807f8e:	49 89 df             	mov    %rbx,%r15
+  807f91:	48 b8 5c 02 ff ff ff 	movabs $0xffffffffffff025c,%rax
+  807f98:	ff ff ff 
+  807f9b:	48 01 d8             	add    %rbx,%rax
+  807f9e:	ff d0                	call   *%rax
+  807fa0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  807fa5:	7e 0a                	jle    807fb1 <open+0x50>
+		return -E_BAD_PATH;
+  807fa7:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  807fac:	e9 18 01 00 00       	jmp    8080c9 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  807fb1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  807fb5:	48 89 c7             	mov    %rax,%rdi
+  807fb8:	49 89 df             	mov    %rbx,%r15
+  807fbb:	48 b8 1d 21 ff ff ff 	movabs $0xffffffffffff211d,%rax
+  807fc2:	ff ff ff 
+  807fc5:	48 01 d8             	add    %rbx,%rax
+  807fc8:	ff d0                	call   *%rax
+  807fca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807fcd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807fd1:	74 08                	je     807fdb <open+0x7a>
+		return r;
+  807fd3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807fd6:	e9 ee 00 00 00       	jmp    8080c9 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  807fdb:	48 ba 88 2f 01 00 00 	movabs $0x12f88,%rdx
+  807fe2:	00 00 00 
+  807fe5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  807fe8:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  807fef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807ff3:	48 89 c6             	mov    %rax,%rsi
+  807ff6:	48 b8 88 2f 01 00 00 	movabs $0x12f88,%rax
+  807ffd:	00 00 00 
+  808000:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808004:	48 89 c7             	mov    %rax,%rdi
+  808007:	49 89 df             	mov    %rbx,%r15
+  80800a:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  808011:	ff ff ff 
+  808014:	48 01 d8             	add    %rbx,%rax
+  808017:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  808019:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80801d:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  808022:	48 89 c6             	mov    %rax,%rsi
+  808025:	bf 00 00 00 00       	mov    $0x0,%edi
+  80802a:	49 89 df             	mov    %rbx,%r15
+  80802d:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  808034:	ff ff ff 
+  808037:	48 01 d8             	add    %rbx,%rax
+  80803a:	ff d0                	call   *%rax
+  80803c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80803f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808043:	74 23                	je     808068 <open+0x107>
+		fd_close(fd,0);
+  808045:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808049:	be 00 00 00 00       	mov    $0x0,%esi
+  80804e:	48 89 c7             	mov    %rax,%rdi
+  808051:	49 89 df             	mov    %rbx,%r15
+  808054:	48 b8 7e 22 ff ff ff 	movabs $0xffffffffffff227e,%rax
+  80805b:	ff ff ff 
+  80805e:	48 01 d8             	add    %rbx,%rax
+  808061:	ff d0                	call   *%rax
+		return r;
+  808063:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808066:	eb 61                	jmp    8080c9 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  808068:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80806c:	48 89 c6             	mov    %rax,%rsi
+  80806f:	bf 01 00 00 00       	mov    $0x1,%edi
+  808074:	48 b8 a2 2c ff ff ff 	movabs $0xffffffffffff2ca2,%rax
+  80807b:	ff ff ff 
+  80807e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808082:	ff d0                	call   *%rax
+  808084:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808087:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80808b:	74 23                	je     8080b0 <open+0x14f>
+		fd_close(fd,0);
+  80808d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808091:	be 00 00 00 00       	mov    $0x0,%esi
+  808096:	48 89 c7             	mov    %rax,%rdi
+  808099:	49 89 df             	mov    %rbx,%r15
+  80809c:	48 b8 7e 22 ff ff ff 	movabs $0xffffffffffff227e,%rax
+  8080a3:	ff ff ff 
+  8080a6:	48 01 d8             	add    %rbx,%rax
+  8080a9:	ff d0                	call   *%rax
+		return r;
+  8080ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8080ae:	eb 19                	jmp    8080c9 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8080b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8080b4:	48 89 c7             	mov    %rax,%rdi
+  8080b7:	49 89 df             	mov    %rbx,%r15
+  8080ba:	48 b8 a3 20 ff ff ff 	movabs $0xffffffffffff20a3,%rax
+  8080c1:	ff ff ff 
+  8080c4:	48 01 d8             	add    %rbx,%rax
+  8080c7:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8080c9:	48 83 c4 20          	add    $0x20,%rsp
+  8080cd:	5b                   	pop    %rbx
+  8080ce:	41 5f                	pop    %r15
+  8080d0:	5d                   	pop    %rbp
+  8080d1:	c3                   	ret
+
+00000000008080d2 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8080d2:	55                   	push   %rbp
+  8080d3:	48 89 e5             	mov    %rsp,%rbp
+  8080d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8080da:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8080da <devfile_flush+0x8>
+  8080e1:	49 bb 9e cf 00 00 00 	movabs $0xcf9e,%r11
+  8080e8:	00 00 00 
+  8080eb:	4c 01 d8             	add    %r11,%rax
+  8080ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8080f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8080f6:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8080f9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8080fc:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  808100:	ba 04 00 00 00       	mov    $0x4,%edx
+  808105:	48 89 ce             	mov    %rcx,%rsi
+  808108:	bf 06 00 00 00       	mov    $0x6,%edi
+  80810d:	48 b9 4a 2d ff ff ff 	movabs $0xffffffffffff2d4a,%rcx
+  808114:	ff ff ff 
+  808117:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80811b:	ff d0                	call   *%rax
+}
+  80811d:	c9                   	leave
+  80811e:	c3                   	ret
+
+000000000080811f <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  80811f:	55                   	push   %rbp
+  808120:	48 89 e5             	mov    %rsp,%rbp
+  808123:	41 57                	push   %r15
+  808125:	53                   	push   %rbx
+  808126:	48 83 ec 60          	sub    $0x60,%rsp
+  80812a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80812a <devfile_read+0xb>
+  808131:	49 bb 4e cf 00 00 00 	movabs $0xcf4e,%r11
+  808138:	00 00 00 
+  80813b:	4c 01 db             	add    %r11,%rbx
+  80813e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  808142:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  808146:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80814a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80814e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  808152:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  808156:	8b 50 0c             	mov    0xc(%rax),%edx
+  808159:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80815d:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80815f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808163:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  808167:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  80816b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80816f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  808174:	ba 10 00 00 00       	mov    $0x10,%edx
+  808179:	48 89 c6             	mov    %rax,%rsi
+  80817c:	bf 03 00 00 00       	mov    $0x3,%edi
+  808181:	48 b8 de 2d ff ff ff 	movabs $0xffffffffffff2dde,%rax
+  808188:	ff ff ff 
+  80818b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80818f:	ff d0                	call   *%rax
+  808191:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  808194:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  808198:	79 05                	jns    80819f <devfile_read+0x80>
+		return r;
+  80819a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80819d:	eb 64                	jmp    808203 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  80819f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8081a2:	48 63 d0             	movslq %eax,%rdx
+  8081a5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8081a9:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8081ae:	48 01 c1             	add    %rax,%rcx
+  8081b1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8081b5:	48 89 ce             	mov    %rcx,%rsi
+  8081b8:	48 89 c7             	mov    %rax,%rdi
+  8081bb:	49 89 df             	mov    %rbx,%r15
+  8081be:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  8081c5:	ff ff ff 
+  8081c8:	48 01 d8             	add    %rbx,%rax
+  8081cb:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8081cd:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8081d4:	ff ff ff 
+  8081d7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8081db:	48 8b 00             	mov    (%rax),%rax
+  8081de:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8081e4:	89 c6                	mov    %eax,%esi
+  8081e6:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8081eb:	48 89 c7             	mov    %rax,%rdi
+  8081ee:	49 89 df             	mov    %rbx,%r15
+  8081f1:	48 b8 ce 1f ff ff ff 	movabs $0xffffffffffff1fce,%rax
+  8081f8:	ff ff ff 
+  8081fb:	48 01 d8             	add    %rbx,%rax
+  8081fe:	ff d0                	call   *%rax
+	return r;
+  808200:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  808203:	48 83 c4 60          	add    $0x60,%rsp
+  808207:	5b                   	pop    %rbx
+  808208:	41 5f                	pop    %r15
+  80820a:	5d                   	pop    %rbp
+  80820b:	c3                   	ret
+
+000000000080820c <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80820c:	55                   	push   %rbp
+  80820d:	48 89 e5             	mov    %rsp,%rbp
+  808210:	41 57                	push   %r15
+  808212:	53                   	push   %rbx
+  808213:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  808217:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808217 <devfile_write+0xb>
+  80821e:	49 bb 61 ce 00 00 00 	movabs $0xce61,%r11
+  808225:	00 00 00 
+  808228:	4c 01 db             	add    %r11,%rbx
+  80822b:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80822f:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  808233:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  80823a:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80823e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  808242:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  808249:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80824d:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  808254:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808257:	48 63 d0             	movslq %eax,%rdx
+  80825a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80825e:	48 39 c2             	cmp    %rax,%rdx
+  808261:	48 0f 46 c2          	cmovbe %rdx,%rax
+  808265:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80826c:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  808273:	00 
+  808274:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80827b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80827f:	48 01 d0             	add    %rdx,%rax
+  808282:	48 83 e8 01          	sub    $0x1,%rax
+  808286:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80828a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80828e:	ba 00 00 00 00       	mov    $0x0,%edx
+  808293:	48 f7 75 d0          	divq   -0x30(%rbp)
+  808297:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80829b:	48 29 d0             	sub    %rdx,%rax
+  80829e:	48 c1 e8 0c          	shr    $0xc,%rax
+  8082a2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8082a5:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8082a8:	89 c6                	mov    %eax,%esi
+  8082aa:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8082af:	48 89 c7             	mov    %rax,%rdi
+  8082b2:	49 89 df             	mov    %rbx,%r15
+  8082b5:	48 b8 88 1f ff ff ff 	movabs $0xffffffffffff1f88,%rax
+  8082bc:	ff ff ff 
+  8082bf:	48 01 d8             	add    %rbx,%rax
+  8082c2:	ff d0                	call   *%rax
+  8082c4:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8082c7:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8082cb:	79 08                	jns    8082d5 <devfile_write+0xc9>
+		return r;
+  8082cd:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8082d0:	e9 8f 00 00 00       	jmp    808364 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8082d5:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8082dc:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8082e0:	48 89 c6             	mov    %rax,%rsi
+  8082e3:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8082e8:	48 89 c7             	mov    %rax,%rdi
+  8082eb:	49 89 df             	mov    %rbx,%r15
+  8082ee:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  8082f5:	ff ff ff 
+  8082f8:	48 01 d8             	add    %rbx,%rax
+  8082fb:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8082fd:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  808301:	8b 50 0c             	mov    0xc(%rax),%edx
+  808304:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808308:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80830a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80830e:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  808315:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  808319:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80831c:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  808320:	89 d1                	mov    %edx,%ecx
+  808322:	ba 10 00 00 00       	mov    $0x10,%edx
+  808327:	48 89 c6             	mov    %rax,%rsi
+  80832a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80832f:	48 b8 de 2d ff ff ff 	movabs $0xffffffffffff2dde,%rax
+  808336:	ff ff ff 
+  808339:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80833d:	ff d0                	call   *%rax
+  80833f:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  808342:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  808345:	89 c6                	mov    %eax,%esi
+  808347:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80834c:	48 89 c7             	mov    %rax,%rdi
+  80834f:	49 89 df             	mov    %rbx,%r15
+  808352:	48 b8 ce 1f ff ff ff 	movabs $0xffffffffffff1fce,%rax
+  808359:	ff ff ff 
+  80835c:	48 01 d8             	add    %rbx,%rax
+  80835f:	ff d0                	call   *%rax
+	return r;
+  808361:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  808364:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  808368:	5b                   	pop    %rbx
+  808369:	41 5f                	pop    %r15
+  80836b:	5d                   	pop    %rbp
+  80836c:	c3                   	ret
+
+000000000080836d <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  80836d:	55                   	push   %rbp
+  80836e:	48 89 e5             	mov    %rsp,%rbp
+  808371:	41 57                	push   %r15
+  808373:	53                   	push   %rbx
+  808374:	48 83 ec 20          	sub    $0x20,%rsp
+  808378:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808378 <devfile_stat+0xb>
+  80837f:	49 bb 00 cd 00 00 00 	movabs $0xcd00,%r11
+  808386:	00 00 00 
+  808389:	4c 01 db             	add    %r11,%rbx
+  80838c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  808390:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  808394:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  808398:	8b 40 0c             	mov    0xc(%rax),%eax
+  80839b:	48 ba 88 2f 01 00 00 	movabs $0x12f88,%rdx
+  8083a2:	00 00 00 
+  8083a5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8083a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8083ad:	bf 05 00 00 00       	mov    $0x5,%edi
+  8083b2:	48 b8 a2 2c ff ff ff 	movabs $0xffffffffffff2ca2,%rax
+  8083b9:	ff ff ff 
+  8083bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8083c0:	ff d0                	call   *%rax
+  8083c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8083c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8083c9:	79 05                	jns    8083d0 <devfile_stat+0x63>
+		return r;
+  8083cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8083ce:	eb 65                	jmp    808435 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8083d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8083d4:	48 ba 88 2f 01 00 00 	movabs $0x12f88,%rdx
+  8083db:	00 00 00 
+  8083de:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8083e2:	48 89 d6             	mov    %rdx,%rsi
+  8083e5:	48 89 c7             	mov    %rax,%rdi
+  8083e8:	49 89 df             	mov    %rbx,%r15
+  8083eb:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  8083f2:	ff ff ff 
+  8083f5:	48 01 d8             	add    %rbx,%rax
+  8083f8:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8083fa:	48 b8 88 2f 01 00 00 	movabs $0x12f88,%rax
+  808401:	00 00 00 
+  808404:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  80840b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80840f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  808415:	48 b8 88 2f 01 00 00 	movabs $0x12f88,%rax
+  80841c:	00 00 00 
+  80841f:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  808426:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80842a:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  808430:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808435:	48 83 c4 20          	add    $0x20,%rsp
+  808439:	5b                   	pop    %rbx
+  80843a:	41 5f                	pop    %r15
+  80843c:	5d                   	pop    %rbp
+  80843d:	c3                   	ret
+
+000000000080843e <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80843e:	55                   	push   %rbp
+  80843f:	48 89 e5             	mov    %rsp,%rbp
+  808442:	48 83 ec 20          	sub    $0x20,%rsp
+  808446:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808446 <devfile_trunc+0x8>
+  80844d:	49 bb 32 cc 00 00 00 	movabs $0xcc32,%r11
+  808454:	00 00 00 
+  808457:	4c 01 d8             	add    %r11,%rax
+  80845a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80845e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  808461:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  808465:	8b 52 0c             	mov    0xc(%rdx),%edx
+  808468:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  80846b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80846e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  808471:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  808475:	ba 08 00 00 00       	mov    $0x8,%edx
+  80847a:	48 89 ce             	mov    %rcx,%rsi
+  80847d:	bf 02 00 00 00       	mov    $0x2,%edi
+  808482:	48 b9 4a 2d ff ff ff 	movabs $0xffffffffffff2d4a,%rcx
+  808489:	ff ff ff 
+  80848c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  808490:	ff d0                	call   *%rax
+}
+  808492:	c9                   	leave
+  808493:	c3                   	ret
+
+0000000000808494 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  808494:	55                   	push   %rbp
+  808495:	48 89 e5             	mov    %rsp,%rbp
+  808498:	41 57                	push   %r15
+  80849a:	53                   	push   %rbx
+  80849b:	48 83 ec 10          	sub    $0x10,%rsp
+  80849f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80849f <remove+0xb>
+  8084a6:	49 bb d9 cb 00 00 00 	movabs $0xcbd9,%r11
+  8084ad:	00 00 00 
+  8084b0:	4c 01 db             	add    %r11,%rbx
+  8084b3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8084b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8084bb:	48 89 c7             	mov    %rax,%rdi
+  8084be:	49 89 df             	mov    %rbx,%r15
+  8084c1:	48 b8 5c 02 ff ff ff 	movabs $0xffffffffffff025c,%rax
+  8084c8:	ff ff ff 
+  8084cb:	48 01 d8             	add    %rbx,%rax
+  8084ce:	ff d0                	call   *%rax
+  8084d0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8084d5:	7e 07                	jle    8084de <remove+0x4a>
+		return -E_BAD_PATH;
+  8084d7:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8084dc:	eb 44                	jmp    808522 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8084de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8084e2:	48 89 c6             	mov    %rax,%rsi
+  8084e5:	48 b8 88 2f 01 00 00 	movabs $0x12f88,%rax
+  8084ec:	00 00 00 
+  8084ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8084f3:	48 89 c7             	mov    %rax,%rdi
+  8084f6:	49 89 df             	mov    %rbx,%r15
+  8084f9:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  808500:	ff ff ff 
+  808503:	48 01 d8             	add    %rbx,%rax
+  808506:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  808508:	be 00 00 00 00       	mov    $0x0,%esi
+  80850d:	bf 07 00 00 00       	mov    $0x7,%edi
+  808512:	48 b8 a2 2c ff ff ff 	movabs $0xffffffffffff2ca2,%rax
+  808519:	ff ff ff 
+  80851c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808520:	ff d0                	call   *%rax
+}
+  808522:	48 83 c4 10          	add    $0x10,%rsp
+  808526:	5b                   	pop    %rbx
+  808527:	41 5f                	pop    %r15
+  808529:	5d                   	pop    %rbp
+  80852a:	c3                   	ret
+
+000000000080852b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80852b:	55                   	push   %rbp
+  80852c:	48 89 e5             	mov    %rsp,%rbp
+  80852f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80852f <sync+0x4>
+  808536:	49 bb 49 cb 00 00 00 	movabs $0xcb49,%r11
+  80853d:	00 00 00 
+  808540:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  808543:	ba 00 00 00 00       	mov    $0x0,%edx
+  808548:	be 00 00 00 00       	mov    $0x0,%esi
+  80854d:	bf 08 00 00 00       	mov    $0x8,%edi
+  808552:	48 b9 4a 2d ff ff ff 	movabs $0xffffffffffff2d4a,%rcx
+  808559:	ff ff ff 
+  80855c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  808560:	ff d0                	call   *%rax
+}
+  808562:	5d                   	pop    %rbp
+  808563:	c3                   	ret
+
+0000000000808564 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  808564:	55                   	push   %rbp
+  808565:	48 89 e5             	mov    %rsp,%rbp
+  808568:	41 57                	push   %r15
+  80856a:	53                   	push   %rbx
+  80856b:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  808572:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808572 <copy+0xe>
+  808579:	49 bb 06 cb 00 00 00 	movabs $0xcb06,%r11
+  808580:	00 00 00 
+  808583:	4c 01 db             	add    %r11,%rbx
+  808586:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  80858d:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  808594:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  80859b:	be 00 00 00 00       	mov    $0x0,%esi
+  8085a0:	48 89 c7             	mov    %rax,%rdi
+  8085a3:	48 b8 e9 2e ff ff ff 	movabs $0xffffffffffff2ee9,%rax
+  8085aa:	ff ff ff 
+  8085ad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8085b1:	ff d0                	call   *%rax
+  8085b3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8085b6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8085ba:	79 35                	jns    8085f1 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8085bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8085bf:	89 c6                	mov    %eax,%esi
+  8085c1:	48 b8 fe 5b ff ff ff 	movabs $0xffffffffffff5bfe,%rax
+  8085c8:	ff ff ff 
+  8085cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8085cf:	48 89 c7             	mov    %rax,%rdi
+  8085d2:	49 89 df             	mov    %rbx,%r15
+  8085d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8085da:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  8085e1:	ff ff ff 
+  8085e4:	48 01 da             	add    %rbx,%rdx
+  8085e7:	ff d2                	call   *%rdx
+		return fd_src;
+  8085e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8085ec:	e9 d7 01 00 00       	jmp    8087c8 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8085f1:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8085f8:	be 01 01 00 00       	mov    $0x101,%esi
+  8085fd:	48 89 c7             	mov    %rax,%rdi
+  808600:	48 b8 e9 2e ff ff ff 	movabs $0xffffffffffff2ee9,%rax
+  808607:	ff ff ff 
+  80860a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80860e:	ff d0                	call   *%rax
+  808610:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  808613:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  808617:	0f 89 df 00 00 00    	jns    8086fc <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  80861d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  808620:	89 c6                	mov    %eax,%esi
+  808622:	48 b8 14 5c ff ff ff 	movabs $0xffffffffffff5c14,%rax
+  808629:	ff ff ff 
+  80862c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808630:	48 89 c7             	mov    %rax,%rdi
+  808633:	49 89 df             	mov    %rbx,%r15
+  808636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80863b:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  808642:	ff ff ff 
+  808645:	48 01 da             	add    %rbx,%rdx
+  808648:	ff d2                	call   *%rdx
+		close(fd_src);
+  80864a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80864d:	89 c7                	mov    %eax,%edi
+  80864f:	49 89 df             	mov    %rbx,%r15
+  808652:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  808659:	ff ff ff 
+  80865c:	48 01 d8             	add    %rbx,%rax
+  80865f:	ff d0                	call   *%rax
+		return fd_dest;
+  808661:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  808664:	e9 5f 01 00 00       	jmp    8087c8 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  808669:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80866c:	48 63 d0             	movslq %eax,%rdx
+  80866f:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  808676:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  808679:	48 89 ce             	mov    %rcx,%rsi
+  80867c:	89 c7                	mov    %eax,%edi
+  80867e:	49 89 df             	mov    %rbx,%r15
+  808681:	48 b8 c0 28 ff ff ff 	movabs $0xffffffffffff28c0,%rax
+  808688:	ff ff ff 
+  80868b:	48 01 d8             	add    %rbx,%rax
+  80868e:	ff d0                	call   *%rax
+  808690:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  808693:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  808697:	79 63                	jns    8086fc <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  808699:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80869c:	89 c6                	mov    %eax,%esi
+  80869e:	48 b8 2e 5c ff ff ff 	movabs $0xffffffffffff5c2e,%rax
+  8086a5:	ff ff ff 
+  8086a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8086ac:	48 89 c7             	mov    %rax,%rdi
+  8086af:	49 89 df             	mov    %rbx,%r15
+  8086b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8086b7:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  8086be:	ff ff ff 
+  8086c1:	48 01 da             	add    %rbx,%rdx
+  8086c4:	ff d2                	call   *%rdx
+			close(fd_src);
+  8086c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8086c9:	89 c7                	mov    %eax,%edi
+  8086cb:	49 89 df             	mov    %rbx,%r15
+  8086ce:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  8086d5:	ff ff ff 
+  8086d8:	48 01 d8             	add    %rbx,%rax
+  8086db:	ff d0                	call   *%rax
+			close(fd_dest);
+  8086dd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8086e0:	89 c7                	mov    %eax,%edi
+  8086e2:	49 89 df             	mov    %rbx,%r15
+  8086e5:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  8086ec:	ff ff ff 
+  8086ef:	48 01 d8             	add    %rbx,%rax
+  8086f2:	ff d0                	call   *%rax
+			return write_size;
+  8086f4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8086f7:	e9 cc 00 00 00       	jmp    8087c8 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  8086fc:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  808703:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808706:	ba 00 02 00 00       	mov    $0x200,%edx
+  80870b:	48 89 ce             	mov    %rcx,%rsi
+  80870e:	89 c7                	mov    %eax,%edi
+  808710:	49 89 df             	mov    %rbx,%r15
+  808713:	48 b8 1a 27 ff ff ff 	movabs $0xffffffffffff271a,%rax
+  80871a:	ff ff ff 
+  80871d:	48 01 d8             	add    %rbx,%rax
+  808720:	ff d0                	call   *%rax
+  808722:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  808725:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  808729:	0f 8f 3a ff ff ff    	jg     808669 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  80872f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  808733:	79 60                	jns    808795 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  808735:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  808738:	89 c6                	mov    %eax,%esi
+  80873a:	48 b8 41 5c ff ff ff 	movabs $0xffffffffffff5c41,%rax
+  808741:	ff ff ff 
+  808744:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808748:	48 89 c7             	mov    %rax,%rdi
+  80874b:	49 89 df             	mov    %rbx,%r15
+  80874e:	b8 00 00 00 00       	mov    $0x0,%eax
+  808753:	48 ba 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%rdx
+  80875a:	ff ff ff 
+  80875d:	48 01 da             	add    %rbx,%rdx
+  808760:	ff d2                	call   *%rdx
+		close(fd_src);
+  808762:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808765:	89 c7                	mov    %eax,%edi
+  808767:	49 89 df             	mov    %rbx,%r15
+  80876a:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  808771:	ff ff ff 
+  808774:	48 01 d8             	add    %rbx,%rax
+  808777:	ff d0                	call   *%rax
+		close(fd_dest);
+  808779:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80877c:	89 c7                	mov    %eax,%edi
+  80877e:	49 89 df             	mov    %rbx,%r15
+  808781:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  808788:	ff ff ff 
+  80878b:	48 01 d8             	add    %rbx,%rax
+  80878e:	ff d0                	call   *%rax
+		return read_size;
+  808790:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  808793:	eb 33                	jmp    8087c8 <copy+0x264>
+	}
+	close(fd_src);
+  808795:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808798:	89 c7                	mov    %eax,%edi
+  80879a:	49 89 df             	mov    %rbx,%r15
+  80879d:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  8087a4:	ff ff ff 
+  8087a7:	48 01 d8             	add    %rbx,%rax
+  8087aa:	ff d0                	call   *%rax
+	close(fd_dest);
+  8087ac:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8087af:	89 c7                	mov    %eax,%edi
+  8087b1:	49 89 df             	mov    %rbx,%r15
+  8087b4:	48 b8 62 24 ff ff ff 	movabs $0xffffffffffff2462,%rax
+  8087bb:	ff ff ff 
+  8087be:	48 01 d8             	add    %rbx,%rax
+  8087c1:	ff d0                	call   *%rax
+	return 0;
+  8087c3:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8087c8:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8087cf:	5b                   	pop    %rbx
+  8087d0:	41 5f                	pop    %r15
+  8087d2:	5d                   	pop    %rbp
+  8087d3:	c3                   	ret
+
+00000000008087d4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8087d4:	55                   	push   %rbp
+  8087d5:	48 89 e5             	mov    %rsp,%rbp
+  8087d8:	48 83 ec 18          	sub    $0x18,%rsp
+  8087dc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8087dc <pageref+0x8>
+  8087e3:	49 bb 9c c8 00 00 00 	movabs $0xc89c,%r11
+  8087ea:	00 00 00 
+  8087ed:	4c 01 d8             	add    %r11,%rax
+  8087f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  8087f4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8087f8:	48 89 d1             	mov    %rdx,%rcx
+  8087fb:	48 c1 e9 15          	shr    $0x15,%rcx
+  8087ff:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  808806:	ff ff ff 
+  808809:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80880d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  808811:	83 e2 01             	and    $0x1,%edx
+  808814:	48 85 d2             	test   %rdx,%rdx
+  808817:	75 07                	jne    808820 <pageref+0x4c>
+		return 0;
+  808819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80881e:	eb 64                	jmp    808884 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  808820:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  808824:	48 89 d1             	mov    %rdx,%rcx
+  808827:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80882b:	48 ba c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rdx
+  808832:	ff ff ff 
+  808835:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  808839:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80883d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  808841:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  808845:	83 e2 01             	and    $0x1,%edx
+  808848:	48 85 d2             	test   %rdx,%rdx
+  80884b:	75 07                	jne    808854 <pageref+0x80>
+		return 0;
+  80884d:	b8 00 00 00 00       	mov    $0x0,%eax
+  808852:	eb 30                	jmp    808884 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  808854:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  808858:	48 c1 ea 0c          	shr    $0xc,%rdx
+  80885c:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  808863:	ff ff ff 
+  808866:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  80886a:	48 89 d0             	mov    %rdx,%rax
+  80886d:	48 01 c0             	add    %rax,%rax
+  808870:	48 01 d0             	add    %rdx,%rax
+  808873:	48 c1 e0 03          	shl    $0x3,%rax
+  808877:	48 01 c8             	add    %rcx,%rax
+  80887a:	48 83 c0 08          	add    $0x8,%rax
+  80887e:	0f b7 00             	movzwl (%rax),%eax
+  808881:	0f b7 c0             	movzwl %ax,%eax
+}
+  808884:	c9                   	leave
+  808885:	c3                   	ret
+
+0000000000808886 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  808886:	55                   	push   %rbp
+  808887:	48 89 e5             	mov    %rsp,%rbp
+  80888a:	41 57                	push   %r15
+  80888c:	53                   	push   %rbx
+  80888d:	48 83 ec 20          	sub    $0x20,%rsp
+  808891:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808891 <fd2sockid+0xb>
+  808898:	49 bb e7 c7 00 00 00 	movabs $0xc7e7,%r11
+  80889f:	00 00 00 
+  8088a2:	4c 01 db             	add    %r11,%rbx
+  8088a5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8088a8:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8088ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8088af:	48 89 d6             	mov    %rdx,%rsi
+  8088b2:	89 c7                	mov    %eax,%edi
+  8088b4:	49 89 df             	mov    %rbx,%r15
+  8088b7:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  8088be:	ff ff ff 
+  8088c1:	48 01 d8             	add    %rbx,%rax
+  8088c4:	ff d0                	call   *%rax
+  8088c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8088c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8088cd:	79 05                	jns    8088d4 <fd2sockid+0x4e>
+		return r;
+  8088cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8088d2:	eb 25                	jmp    8088f9 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8088d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8088d8:	8b 10                	mov    (%rax),%edx
+  8088da:	48 b8 c8 00 00 00 00 	movabs $0xc8,%rax
+  8088e1:	00 00 00 
+  8088e4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8088e7:	39 c2                	cmp    %eax,%edx
+  8088e9:	74 07                	je     8088f2 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8088eb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8088f0:	eb 07                	jmp    8088f9 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8088f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8088f6:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8088f9:	48 83 c4 20          	add    $0x20,%rsp
+  8088fd:	5b                   	pop    %rbx
+  8088fe:	41 5f                	pop    %r15
+  808900:	5d                   	pop    %rbp
+  808901:	c3                   	ret
+
+0000000000808902 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  808902:	55                   	push   %rbp
+  808903:	48 89 e5             	mov    %rsp,%rbp
+  808906:	41 57                	push   %r15
+  808908:	53                   	push   %rbx
+  808909:	48 83 ec 20          	sub    $0x20,%rsp
+  80890d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80890d <alloc_sockfd+0xb>
+  808914:	49 bb 6b c7 00 00 00 	movabs $0xc76b,%r11
+  80891b:	00 00 00 
+  80891e:	4c 01 db             	add    %r11,%rbx
+  808921:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  808924:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  808928:	48 89 c7             	mov    %rax,%rdi
+  80892b:	49 89 df             	mov    %rbx,%r15
+  80892e:	48 b8 1d 21 ff ff ff 	movabs $0xffffffffffff211d,%rax
+  808935:	ff ff ff 
+  808938:	48 01 d8             	add    %rbx,%rax
+  80893b:	ff d0                	call   *%rax
+  80893d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808940:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808944:	78 2c                	js     808972 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  808946:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80894a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80894f:	48 89 c6             	mov    %rax,%rsi
+  808952:	bf 00 00 00 00       	mov    $0x0,%edi
+  808957:	49 89 df             	mov    %rbx,%r15
+  80895a:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  808961:	ff ff ff 
+  808964:	48 01 d8             	add    %rbx,%rax
+  808967:	ff d0                	call   *%rax
+  808969:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80896c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808970:	79 1c                	jns    80898e <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  808972:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808975:	89 c7                	mov    %eax,%edi
+  808977:	49 89 df             	mov    %rbx,%r15
+  80897a:	48 b8 7e 40 ff ff ff 	movabs $0xffffffffffff407e,%rax
+  808981:	ff ff ff 
+  808984:	48 01 d8             	add    %rbx,%rax
+  808987:	ff d0                	call   *%rax
+		return r;
+  808989:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80898c:	eb 41                	jmp    8089cf <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80898e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808992:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  808999:	00 00 00 
+  80899c:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80899f:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8089a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8089a5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  8089ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8089b0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8089b3:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8089b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8089ba:	48 89 c7             	mov    %rax,%rdi
+  8089bd:	49 89 df             	mov    %rbx,%r15
+  8089c0:	48 b8 a3 20 ff ff ff 	movabs $0xffffffffffff20a3,%rax
+  8089c7:	ff ff ff 
+  8089ca:	48 01 d8             	add    %rbx,%rax
+  8089cd:	ff d0                	call   *%rax
+}
+  8089cf:	48 83 c4 20          	add    $0x20,%rsp
+  8089d3:	5b                   	pop    %rbx
+  8089d4:	41 5f                	pop    %r15
+  8089d6:	5d                   	pop    %rbp
+  8089d7:	c3                   	ret
+
+00000000008089d8 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8089d8:	55                   	push   %rbp
+  8089d9:	48 89 e5             	mov    %rsp,%rbp
+  8089dc:	41 57                	push   %r15
+  8089de:	53                   	push   %rbx
+  8089df:	48 83 ec 30          	sub    $0x30,%rsp
+  8089e3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8089e3 <accept+0xb>
+  8089ea:	49 bb 95 c6 00 00 00 	movabs $0xc695,%r11
+  8089f1:	00 00 00 
+  8089f4:	4c 01 db             	add    %r11,%rbx
+  8089f7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8089fa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8089fe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  808a02:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808a05:	89 c7                	mov    %eax,%edi
+  808a07:	48 b8 0e 38 ff ff ff 	movabs $0xffffffffffff380e,%rax
+  808a0e:	ff ff ff 
+  808a11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808a15:	ff d0                	call   *%rax
+  808a17:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808a1a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808a1e:	79 05                	jns    808a25 <accept+0x4d>
+		return r;
+  808a20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808a23:	eb 45                	jmp    808a6a <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  808a25:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  808a29:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  808a2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808a30:	48 89 ce             	mov    %rcx,%rsi
+  808a33:	89 c7                	mov    %eax,%edi
+  808a35:	49 89 df             	mov    %rbx,%r15
+  808a38:	48 b8 ec 3e ff ff ff 	movabs $0xffffffffffff3eec,%rax
+  808a3f:	ff ff ff 
+  808a42:	48 01 d8             	add    %rbx,%rax
+  808a45:	ff d0                	call   *%rax
+  808a47:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808a4a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808a4e:	79 05                	jns    808a55 <accept+0x7d>
+		return r;
+  808a50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808a53:	eb 15                	jmp    808a6a <accept+0x92>
+	return alloc_sockfd(r);
+  808a55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808a58:	89 c7                	mov    %eax,%edi
+  808a5a:	48 b8 8a 38 ff ff ff 	movabs $0xffffffffffff388a,%rax
+  808a61:	ff ff ff 
+  808a64:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808a68:	ff d0                	call   *%rax
+}
+  808a6a:	48 83 c4 30          	add    $0x30,%rsp
+  808a6e:	5b                   	pop    %rbx
+  808a6f:	41 5f                	pop    %r15
+  808a71:	5d                   	pop    %rbp
+  808a72:	c3                   	ret
+
+0000000000808a73 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  808a73:	55                   	push   %rbp
+  808a74:	48 89 e5             	mov    %rsp,%rbp
+  808a77:	41 57                	push   %r15
+  808a79:	53                   	push   %rbx
+  808a7a:	48 83 ec 20          	sub    $0x20,%rsp
+  808a7e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808a7e <bind+0xb>
+  808a85:	49 bb fa c5 00 00 00 	movabs $0xc5fa,%r11
+  808a8c:	00 00 00 
+  808a8f:	4c 01 db             	add    %r11,%rbx
+  808a92:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  808a95:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  808a99:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  808a9c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808a9f:	89 c7                	mov    %eax,%edi
+  808aa1:	48 b8 0e 38 ff ff ff 	movabs $0xffffffffffff380e,%rax
+  808aa8:	ff ff ff 
+  808aab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808aaf:	ff d0                	call   *%rax
+  808ab1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808ab4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808ab8:	79 05                	jns    808abf <bind+0x4c>
+		return r;
+  808aba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808abd:	eb 21                	jmp    808ae0 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  808abf:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  808ac2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  808ac6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808ac9:	48 89 ce             	mov    %rcx,%rsi
+  808acc:	89 c7                	mov    %eax,%edi
+  808ace:	49 89 df             	mov    %rbx,%r15
+  808ad1:	48 b8 98 3f ff ff ff 	movabs $0xffffffffffff3f98,%rax
+  808ad8:	ff ff ff 
+  808adb:	48 01 d8             	add    %rbx,%rax
+  808ade:	ff d0                	call   *%rax
+}
+  808ae0:	48 83 c4 20          	add    $0x20,%rsp
+  808ae4:	5b                   	pop    %rbx
+  808ae5:	41 5f                	pop    %r15
+  808ae7:	5d                   	pop    %rbp
+  808ae8:	c3                   	ret
+
+0000000000808ae9 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  808ae9:	55                   	push   %rbp
+  808aea:	48 89 e5             	mov    %rsp,%rbp
+  808aed:	41 57                	push   %r15
+  808aef:	53                   	push   %rbx
+  808af0:	48 83 ec 20          	sub    $0x20,%rsp
+  808af4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808af4 <shutdown+0xb>
+  808afb:	49 bb 84 c5 00 00 00 	movabs $0xc584,%r11
+  808b02:	00 00 00 
+  808b05:	4c 01 db             	add    %r11,%rbx
+  808b08:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  808b0b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  808b0e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808b11:	89 c7                	mov    %eax,%edi
+  808b13:	48 b8 0e 38 ff ff ff 	movabs $0xffffffffffff380e,%rax
+  808b1a:	ff ff ff 
+  808b1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808b21:	ff d0                	call   *%rax
+  808b23:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808b26:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808b2a:	79 05                	jns    808b31 <shutdown+0x48>
+		return r;
+  808b2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808b2f:	eb 1c                	jmp    808b4d <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  808b31:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  808b34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808b37:	89 d6                	mov    %edx,%esi
+  808b39:	89 c7                	mov    %eax,%edi
+  808b3b:	49 89 df             	mov    %rbx,%r15
+  808b3e:	48 b8 2d 40 ff ff ff 	movabs $0xffffffffffff402d,%rax
+  808b45:	ff ff ff 
+  808b48:	48 01 d8             	add    %rbx,%rax
+  808b4b:	ff d0                	call   *%rax
+}
+  808b4d:	48 83 c4 20          	add    $0x20,%rsp
+  808b51:	5b                   	pop    %rbx
+  808b52:	41 5f                	pop    %r15
+  808b54:	5d                   	pop    %rbp
+  808b55:	c3                   	ret
+
+0000000000808b56 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  808b56:	55                   	push   %rbp
+  808b57:	48 89 e5             	mov    %rsp,%rbp
+  808b5a:	41 57                	push   %r15
+  808b5c:	53                   	push   %rbx
+  808b5d:	48 83 ec 10          	sub    $0x10,%rsp
+  808b61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808b61 <devsock_close+0xb>
+  808b68:	49 bb 17 c5 00 00 00 	movabs $0xc517,%r11
+  808b6f:	00 00 00 
+  808b72:	4c 01 db             	add    %r11,%rbx
+  808b75:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  808b79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808b7d:	48 89 c7             	mov    %rax,%rdi
+  808b80:	49 89 df             	mov    %rbx,%r15
+  808b83:	48 b8 5c 37 ff ff ff 	movabs $0xffffffffffff375c,%rax
+  808b8a:	ff ff ff 
+  808b8d:	48 01 d8             	add    %rbx,%rax
+  808b90:	ff d0                	call   *%rax
+  808b92:	83 f8 01             	cmp    $0x1,%eax
+  808b95:	75 1d                	jne    808bb4 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  808b97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808b9b:	8b 40 0c             	mov    0xc(%rax),%eax
+  808b9e:	89 c7                	mov    %eax,%edi
+  808ba0:	49 89 df             	mov    %rbx,%r15
+  808ba3:	48 b8 7e 40 ff ff ff 	movabs $0xffffffffffff407e,%rax
+  808baa:	ff ff ff 
+  808bad:	48 01 d8             	add    %rbx,%rax
+  808bb0:	ff d0                	call   *%rax
+  808bb2:	eb 05                	jmp    808bb9 <devsock_close+0x63>
+	else
+		return 0;
+  808bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808bb9:	48 83 c4 10          	add    $0x10,%rsp
+  808bbd:	5b                   	pop    %rbx
+  808bbe:	41 5f                	pop    %r15
+  808bc0:	5d                   	pop    %rbp
+  808bc1:	c3                   	ret
+
+0000000000808bc2 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  808bc2:	55                   	push   %rbp
+  808bc3:	48 89 e5             	mov    %rsp,%rbp
+  808bc6:	41 57                	push   %r15
+  808bc8:	53                   	push   %rbx
+  808bc9:	48 83 ec 20          	sub    $0x20,%rsp
+  808bcd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808bcd <connect+0xb>
+  808bd4:	49 bb ab c4 00 00 00 	movabs $0xc4ab,%r11
+  808bdb:	00 00 00 
+  808bde:	4c 01 db             	add    %r11,%rbx
+  808be1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  808be4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  808be8:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  808beb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808bee:	89 c7                	mov    %eax,%edi
+  808bf0:	48 b8 0e 38 ff ff ff 	movabs $0xffffffffffff380e,%rax
+  808bf7:	ff ff ff 
+  808bfa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808bfe:	ff d0                	call   *%rax
+  808c00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808c03:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808c07:	79 05                	jns    808c0e <connect+0x4c>
+		return r;
+  808c09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808c0c:	eb 21                	jmp    808c2f <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  808c0e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  808c11:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  808c15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808c18:	48 89 ce             	mov    %rcx,%rsi
+  808c1b:	89 c7                	mov    %eax,%edi
+  808c1d:	49 89 df             	mov    %rbx,%r15
+  808c20:	48 b8 c6 40 ff ff ff 	movabs $0xffffffffffff40c6,%rax
+  808c27:	ff ff ff 
+  808c2a:	48 01 d8             	add    %rbx,%rax
+  808c2d:	ff d0                	call   *%rax
+}
+  808c2f:	48 83 c4 20          	add    $0x20,%rsp
+  808c33:	5b                   	pop    %rbx
+  808c34:	41 5f                	pop    %r15
+  808c36:	5d                   	pop    %rbp
+  808c37:	c3                   	ret
+
+0000000000808c38 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  808c38:	55                   	push   %rbp
+  808c39:	48 89 e5             	mov    %rsp,%rbp
+  808c3c:	41 57                	push   %r15
+  808c3e:	53                   	push   %rbx
+  808c3f:	48 83 ec 20          	sub    $0x20,%rsp
+  808c43:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808c43 <listen+0xb>
+  808c4a:	49 bb 35 c4 00 00 00 	movabs $0xc435,%r11
+  808c51:	00 00 00 
+  808c54:	4c 01 db             	add    %r11,%rbx
+  808c57:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  808c5a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  808c5d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808c60:	89 c7                	mov    %eax,%edi
+  808c62:	48 b8 0e 38 ff ff ff 	movabs $0xffffffffffff380e,%rax
+  808c69:	ff ff ff 
+  808c6c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808c70:	ff d0                	call   *%rax
+  808c72:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808c75:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808c79:	79 05                	jns    808c80 <listen+0x48>
+		return r;
+  808c7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808c7e:	eb 1c                	jmp    808c9c <listen+0x64>
+	return nsipc_listen(r, backlog);
+  808c80:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  808c83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808c86:	89 d6                	mov    %edx,%esi
+  808c88:	89 c7                	mov    %eax,%edi
+  808c8a:	49 89 df             	mov    %rbx,%r15
+  808c8d:	48 b8 5b 41 ff ff ff 	movabs $0xffffffffffff415b,%rax
+  808c94:	ff ff ff 
+  808c97:	48 01 d8             	add    %rbx,%rax
+  808c9a:	ff d0                	call   *%rax
+}
+  808c9c:	48 83 c4 20          	add    $0x20,%rsp
+  808ca0:	5b                   	pop    %rbx
+  808ca1:	41 5f                	pop    %r15
+  808ca3:	5d                   	pop    %rbp
+  808ca4:	c3                   	ret
+
+0000000000808ca5 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  808ca5:	55                   	push   %rbp
+  808ca6:	48 89 e5             	mov    %rsp,%rbp
+  808ca9:	41 57                	push   %r15
+  808cab:	48 83 ec 28          	sub    $0x28,%rsp
+  808caf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808caf <devsock_read+0xa>
+  808cb6:	49 bb c9 c3 00 00 00 	movabs $0xc3c9,%r11
+  808cbd:	00 00 00 
+  808cc0:	4c 01 d8             	add    %r11,%rax
+  808cc3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  808cc7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  808ccb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  808ccf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  808cd3:	41 89 d0             	mov    %edx,%r8d
+  808cd6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  808cda:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  808cdd:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  808ce1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  808ce6:	44 89 c2             	mov    %r8d,%edx
+  808ce9:	49 89 c7             	mov    %rax,%r15
+  808cec:	49 b8 ac 41 ff ff ff 	movabs $0xffffffffffff41ac,%r8
+  808cf3:	ff ff ff 
+  808cf6:	49 01 c0             	add    %rax,%r8
+  808cf9:	41 ff d0             	call   *%r8
+}
+  808cfc:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  808d00:	c9                   	leave
+  808d01:	c3                   	ret
+
+0000000000808d02 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  808d02:	55                   	push   %rbp
+  808d03:	48 89 e5             	mov    %rsp,%rbp
+  808d06:	41 57                	push   %r15
+  808d08:	48 83 ec 28          	sub    $0x28,%rsp
+  808d0c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808d0c <devsock_write+0xa>
+  808d13:	49 bb 6c c3 00 00 00 	movabs $0xc36c,%r11
+  808d1a:	00 00 00 
+  808d1d:	4c 01 d8             	add    %r11,%rax
+  808d20:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  808d24:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  808d28:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  808d2c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  808d30:	41 89 d0             	mov    %edx,%r8d
+  808d33:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  808d37:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  808d3a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  808d3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  808d43:	44 89 c2             	mov    %r8d,%edx
+  808d46:	49 89 c7             	mov    %rax,%r15
+  808d49:	49 b8 c9 42 ff ff ff 	movabs $0xffffffffffff42c9,%r8
+  808d50:	ff ff ff 
+  808d53:	49 01 c0             	add    %rax,%r8
+  808d56:	41 ff d0             	call   *%r8
+}
+  808d59:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  808d5d:	c9                   	leave
+  808d5e:	c3                   	ret
+
+0000000000808d5f <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  808d5f:	55                   	push   %rbp
+  808d60:	48 89 e5             	mov    %rsp,%rbp
+  808d63:	41 57                	push   %r15
+  808d65:	48 83 ec 18          	sub    $0x18,%rsp
+  808d69:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808d69 <devsock_stat+0xa>
+  808d70:	49 bb 0f c3 00 00 00 	movabs $0xc30f,%r11
+  808d77:	00 00 00 
+  808d7a:	4c 01 d8             	add    %r11,%rax
+  808d7d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  808d81:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  808d85:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  808d89:	48 b9 5c 5c ff ff ff 	movabs $0xffffffffffff5c5c,%rcx
+  808d90:	ff ff ff 
+  808d93:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  808d97:	48 89 ce             	mov    %rcx,%rsi
+  808d9a:	48 89 d7             	mov    %rdx,%rdi
+  808d9d:	49 89 c7             	mov    %rax,%r15
+  808da0:	48 ba f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rdx
+  808da7:	ff ff ff 
+  808daa:	48 01 c2             	add    %rax,%rdx
+  808dad:	ff d2                	call   *%rdx
+	return 0;
+  808daf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808db4:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  808db8:	c9                   	leave
+  808db9:	c3                   	ret
+
+0000000000808dba <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  808dba:	55                   	push   %rbp
+  808dbb:	48 89 e5             	mov    %rsp,%rbp
+  808dbe:	41 57                	push   %r15
+  808dc0:	53                   	push   %rbx
+  808dc1:	48 83 ec 20          	sub    $0x20,%rsp
+  808dc5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808dc5 <socket+0xb>
+  808dcc:	49 bb b3 c2 00 00 00 	movabs $0xc2b3,%r11
+  808dd3:	00 00 00 
+  808dd6:	4c 01 db             	add    %r11,%rbx
+  808dd9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  808ddc:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  808ddf:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  808de2:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  808de5:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  808de8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808deb:	89 ce                	mov    %ecx,%esi
+  808ded:	89 c7                	mov    %eax,%edi
+  808def:	49 89 df             	mov    %rbx,%r15
+  808df2:	48 b8 a0 44 ff ff ff 	movabs $0xffffffffffff44a0,%rax
+  808df9:	ff ff ff 
+  808dfc:	48 01 d8             	add    %rbx,%rax
+  808dff:	ff d0                	call   *%rax
+  808e01:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808e04:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808e08:	79 05                	jns    808e0f <socket+0x55>
+		return r;
+  808e0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808e0d:	eb 15                	jmp    808e24 <socket+0x6a>
+	return alloc_sockfd(r);
+  808e0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808e12:	89 c7                	mov    %eax,%edi
+  808e14:	48 b8 8a 38 ff ff ff 	movabs $0xffffffffffff388a,%rax
+  808e1b:	ff ff ff 
+  808e1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808e22:	ff d0                	call   *%rax
+}
+  808e24:	48 83 c4 20          	add    $0x20,%rsp
+  808e28:	5b                   	pop    %rbx
+  808e29:	41 5f                	pop    %r15
+  808e2b:	5d                   	pop    %rbp
+  808e2c:	c3                   	ret
+
+0000000000808e2d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  808e2d:	55                   	push   %rbp
+  808e2e:	48 89 e5             	mov    %rsp,%rbp
+  808e31:	41 57                	push   %r15
+  808e33:	53                   	push   %rbx
+  808e34:	48 83 ec 10          	sub    $0x10,%rsp
+  808e38:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808e38 <nsipc+0xb>
+  808e3f:	49 bb 40 c2 00 00 00 	movabs $0xc240,%r11
+  808e46:	00 00 00 
+  808e49:	4c 01 db             	add    %r11,%rbx
+  808e4c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  808e4f:	48 b8 88 1f 01 00 00 	movabs $0x11f88,%rax
+  808e56:	00 00 00 
+  808e59:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  808e5c:	85 c0                	test   %eax,%eax
+  808e5e:	75 24                	jne    808e84 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  808e60:	bf 02 00 00 00       	mov    $0x2,%edi
+  808e65:	49 89 df             	mov    %rbx,%r15
+  808e68:	48 b8 14 20 ff ff ff 	movabs $0xffffffffffff2014,%rax
+  808e6f:	ff ff ff 
+  808e72:	48 01 d8             	add    %rbx,%rax
+  808e75:	ff d0                	call   *%rax
+  808e77:	48 ba 88 1f 01 00 00 	movabs $0x11f88,%rdx
+  808e7e:	00 00 00 
+  808e81:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  808e84:	48 b8 88 1f 01 00 00 	movabs $0x11f88,%rax
+  808e8b:	00 00 00 
+  808e8e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  808e91:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  808e94:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  808e9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808ea0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  808ea5:	48 ba 88 3f 01 00 00 	movabs $0x13f88,%rdx
+  808eac:	00 00 00 
+  808eaf:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  808eb3:	89 c7                	mov    %eax,%edi
+  808eb5:	49 89 df             	mov    %rbx,%r15
+  808eb8:	48 b8 33 1a ff ff ff 	movabs $0xffffffffffff1a33,%rax
+  808ebf:	ff ff ff 
+  808ec2:	48 01 d8             	add    %rbx,%rax
+  808ec5:	ff d0                	call   *%rax
+}
+  808ec7:	48 83 c4 10          	add    $0x10,%rsp
+  808ecb:	5b                   	pop    %rbx
+  808ecc:	41 5f                	pop    %r15
+  808ece:	5d                   	pop    %rbp
+  808ecf:	c3                   	ret
+
+0000000000808ed0 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  808ed0:	55                   	push   %rbp
+  808ed1:	48 89 e5             	mov    %rsp,%rbp
+  808ed4:	41 57                	push   %r15
+  808ed6:	53                   	push   %rbx
+  808ed7:	48 83 ec 20          	sub    $0x20,%rsp
+  808edb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808edb <nsipc_words+0xb>
+  808ee2:	49 bb 9d c1 00 00 00 	movabs $0xc19d,%r11
+  808ee9:	00 00 00 
+  808eec:	4c 01 db             	add    %r11,%rbx
+  808eef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  808ef2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  808ef6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  808efa:	48 b8 88 1f 01 00 00 	movabs $0x11f88,%rax
+  808f01:	00 00 00 
+  808f04:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  808f07:	85 c0                	test   %eax,%eax
+  808f09:	75 24                	jne    808f2f <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  808f0b:	bf 02 00 00 00       	mov    $0x2,%edi
+  808f10:	49 89 df             	mov    %rbx,%r15
+  808f13:	48 b8 14 20 ff ff ff 	movabs $0xffffffffffff2014,%rax
+  808f1a:	ff ff ff 
+  808f1d:	48 01 d8             	add    %rbx,%rax
+  808f20:	ff d0                	call   *%rax
+  808f22:	48 ba 88 1f 01 00 00 	movabs $0x11f88,%rdx
+  808f29:	00 00 00 
+  808f2c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  808f2f:	48 b8 88 1f 01 00 00 	movabs $0x11f88,%rax
+  808f36:	00 00 00 
+  808f39:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  808f3c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  808f40:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  808f44:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  808f47:	89 c7                	mov    %eax,%edi
+  808f49:	49 89 df             	mov    %rbx,%r15
+  808f4c:	48 b8 1e 1b ff ff ff 	movabs $0xffffffffffff1b1e,%rax
+  808f53:	ff ff ff 
+  808f56:	48 01 d8             	add    %rbx,%rax
+  808f59:	ff d0                	call   *%rax
+}
+  808f5b:	48 83 c4 20          	add    $0x20,%rsp
+  808f5f:	5b                   	pop    %rbx
+  808f60:	41 5f                	pop    %r15
+  808f62:	5d                   	pop    %rbp
+  808f63:	c3                   	ret
+
+0000000000808f64 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  808f64:	55                   	push   %rbp
+  808f65:	48 89 e5             	mov    %rsp,%rbp
+  808f68:	41 57                	push   %r15
+  808f6a:	53                   	push   %rbx
+  808f6b:	48 83 ec 30          	sub    $0x30,%rsp
+  808f6f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808f6f <nsipc_accept+0xb>
+  808f76:	49 bb 09 c1 00 00 00 	movabs $0xc109,%r11
+  808f7d:	00 00 00 
+  808f80:	4c 01 db             	add    %r11,%rbx
+  808f83:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  808f86:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  808f8a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  808f8e:	48 ba 88 3f 01 00 00 	movabs $0x13f88,%rdx
+  808f95:	00 00 00 
+  808f98:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808f9b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  808f9e:	bf 01 00 00 00       	mov    $0x1,%edi
+  808fa3:	48 b8 b5 3d ff ff ff 	movabs $0xffffffffffff3db5,%rax
+  808faa:	ff ff ff 
+  808fad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808fb1:	ff d0                	call   *%rax
+  808fb3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808fb6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808fba:	78 48                	js     809004 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  808fbc:	48 b8 88 3f 01 00 00 	movabs $0x13f88,%rax
+  808fc3:	00 00 00 
+  808fc6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808fca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  808fce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808fd2:	8b 40 10             	mov    0x10(%rax),%eax
+  808fd5:	89 c2                	mov    %eax,%edx
+  808fd7:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  808fdb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808fdf:	48 89 ce             	mov    %rcx,%rsi
+  808fe2:	48 89 c7             	mov    %rax,%rdi
+  808fe5:	49 89 df             	mov    %rbx,%r15
+  808fe8:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  808fef:	ff ff ff 
+  808ff2:	48 01 d8             	add    %rbx,%rax
+  808ff5:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  808ff7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808ffb:	8b 50 10             	mov    0x10(%rax),%edx
+  808ffe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809002:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  809004:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  809007:	48 83 c4 30          	add    $0x30,%rsp
+  80900b:	5b                   	pop    %rbx
+  80900c:	41 5f                	pop    %r15
+  80900e:	5d                   	pop    %rbp
+  80900f:	c3                   	ret
+
+0000000000809010 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  809010:	55                   	push   %rbp
+  809011:	48 89 e5             	mov    %rsp,%rbp
+  809014:	41 57                	push   %r15
+  809016:	53                   	push   %rbx
+  809017:	48 83 ec 10          	sub    $0x10,%rsp
+  80901b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80901b <nsipc_bind+0xb>
+  809022:	49 bb 5d c0 00 00 00 	movabs $0xc05d,%r11
+  809029:	00 00 00 
+  80902c:	4c 01 db             	add    %r11,%rbx
+  80902f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  809032:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  809036:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  809039:	48 ba 88 3f 01 00 00 	movabs $0x13f88,%rdx
+  809040:	00 00 00 
+  809043:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809046:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  809049:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80904c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809050:	48 89 c6             	mov    %rax,%rsi
+  809053:	48 b8 8c 3f 01 00 00 	movabs $0x13f8c,%rax
+  80905a:	00 00 00 
+  80905d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  809061:	48 89 c7             	mov    %rax,%rdi
+  809064:	49 89 df             	mov    %rbx,%r15
+  809067:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  80906e:	ff ff ff 
+  809071:	48 01 d8             	add    %rbx,%rax
+  809074:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  809076:	48 ba 88 3f 01 00 00 	movabs $0x13f88,%rdx
+  80907d:	00 00 00 
+  809080:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  809083:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  809087:	bf 02 00 00 00       	mov    $0x2,%edi
+  80908c:	48 b8 b5 3d ff ff ff 	movabs $0xffffffffffff3db5,%rax
+  809093:	ff ff ff 
+  809096:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80909a:	ff d0                	call   *%rax
+}
+  80909c:	48 83 c4 10          	add    $0x10,%rsp
+  8090a0:	5b                   	pop    %rbx
+  8090a1:	41 5f                	pop    %r15
+  8090a3:	5d                   	pop    %rbp
+  8090a4:	c3                   	ret
+
+00000000008090a5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8090a5:	55                   	push   %rbp
+  8090a6:	48 89 e5             	mov    %rsp,%rbp
+  8090a9:	48 83 ec 20          	sub    $0x20,%rsp
+  8090ad:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8090ad <nsipc_shutdown+0x8>
+  8090b4:	49 bb cb bf 00 00 00 	movabs $0xbfcb,%r11
+  8090bb:	00 00 00 
+  8090be:	4c 01 d8             	add    %r11,%rax
+  8090c1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8090c4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8090c7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8090ca:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8090cd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8090d0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8090d3:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8090d7:	ba 08 00 00 00       	mov    $0x8,%edx
+  8090dc:	48 89 ce             	mov    %rcx,%rsi
+  8090df:	bf 03 00 00 00       	mov    $0x3,%edi
+  8090e4:	48 b9 58 3e ff ff ff 	movabs $0xffffffffffff3e58,%rcx
+  8090eb:	ff ff ff 
+  8090ee:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8090f2:	ff d0                	call   *%rax
+}
+  8090f4:	c9                   	leave
+  8090f5:	c3                   	ret
+
+00000000008090f6 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8090f6:	55                   	push   %rbp
+  8090f7:	48 89 e5             	mov    %rsp,%rbp
+  8090fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8090fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8090fe <nsipc_close+0x8>
+  809105:	49 bb 7a bf 00 00 00 	movabs $0xbf7a,%r11
+  80910c:	00 00 00 
+  80910f:	4c 01 d8             	add    %r11,%rax
+  809112:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  809115:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  809118:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80911b:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80911f:	ba 04 00 00 00       	mov    $0x4,%edx
+  809124:	48 89 ce             	mov    %rcx,%rsi
+  809127:	bf 04 00 00 00       	mov    $0x4,%edi
+  80912c:	48 b9 58 3e ff ff ff 	movabs $0xffffffffffff3e58,%rcx
+  809133:	ff ff ff 
+  809136:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80913a:	ff d0                	call   *%rax
+}
+  80913c:	c9                   	leave
+  80913d:	c3                   	ret
+
+000000000080913e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80913e:	55                   	push   %rbp
+  80913f:	48 89 e5             	mov    %rsp,%rbp
+  809142:	41 57                	push   %r15
+  809144:	53                   	push   %rbx
+  809145:	48 83 ec 10          	sub    $0x10,%rsp
+  809149:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809149 <nsipc_connect+0xb>
+  809150:	49 bb 2f bf 00 00 00 	movabs $0xbf2f,%r11
+  809157:	00 00 00 
+  80915a:	4c 01 db             	add    %r11,%rbx
+  80915d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  809160:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  809164:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  809167:	48 ba 88 3f 01 00 00 	movabs $0x13f88,%rdx
+  80916e:	00 00 00 
+  809171:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809174:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  809177:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80917a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80917e:	48 89 c6             	mov    %rax,%rsi
+  809181:	48 b8 8c 3f 01 00 00 	movabs $0x13f8c,%rax
+  809188:	00 00 00 
+  80918b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80918f:	48 89 c7             	mov    %rax,%rdi
+  809192:	49 89 df             	mov    %rbx,%r15
+  809195:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  80919c:	ff ff ff 
+  80919f:	48 01 d8             	add    %rbx,%rax
+  8091a2:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8091a4:	48 ba 88 3f 01 00 00 	movabs $0x13f88,%rdx
+  8091ab:	00 00 00 
+  8091ae:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8091b1:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8091b5:	bf 05 00 00 00       	mov    $0x5,%edi
+  8091ba:	48 b8 b5 3d ff ff ff 	movabs $0xffffffffffff3db5,%rax
+  8091c1:	ff ff ff 
+  8091c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8091c8:	ff d0                	call   *%rax
+}
+  8091ca:	48 83 c4 10          	add    $0x10,%rsp
+  8091ce:	5b                   	pop    %rbx
+  8091cf:	41 5f                	pop    %r15
+  8091d1:	5d                   	pop    %rbp
+  8091d2:	c3                   	ret
+
+00000000008091d3 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8091d3:	55                   	push   %rbp
+  8091d4:	48 89 e5             	mov    %rsp,%rbp
+  8091d7:	48 83 ec 20          	sub    $0x20,%rsp
+  8091db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8091db <nsipc_listen+0x8>
+  8091e2:	49 bb 9d be 00 00 00 	movabs $0xbe9d,%r11
+  8091e9:	00 00 00 
+  8091ec:	4c 01 d8             	add    %r11,%rax
+  8091ef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8091f2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8091f5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8091f8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8091fb:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8091fe:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  809201:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  809205:	ba 08 00 00 00       	mov    $0x8,%edx
+  80920a:	48 89 ce             	mov    %rcx,%rsi
+  80920d:	bf 06 00 00 00       	mov    $0x6,%edi
+  809212:	48 b9 58 3e ff ff ff 	movabs $0xffffffffffff3e58,%rcx
+  809219:	ff ff ff 
+  80921c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  809220:	ff d0                	call   *%rax
+}
+  809222:	c9                   	leave
+  809223:	c3                   	ret
+
+0000000000809224 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  809224:	55                   	push   %rbp
+  809225:	48 89 e5             	mov    %rsp,%rbp
+  809228:	41 57                	push   %r15
+  80922a:	53                   	push   %rbx
+  80922b:	48 83 ec 30          	sub    $0x30,%rsp
+  80922f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80922f <nsipc_recv+0xb>
+  809236:	49 bb 49 be 00 00 00 	movabs $0xbe49,%r11
+  80923d:	00 00 00 
+  809240:	4c 01 db             	add    %r11,%rbx
+  809243:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  809246:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80924a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  80924d:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  809250:	48 ba 88 3f 01 00 00 	movabs $0x13f88,%rdx
+  809257:	00 00 00 
+  80925a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80925d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  809260:	48 ba 88 3f 01 00 00 	movabs $0x13f88,%rdx
+  809267:	00 00 00 
+  80926a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80926d:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  809271:	48 ba 88 3f 01 00 00 	movabs $0x13f88,%rdx
+  809278:	00 00 00 
+  80927b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80927e:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  809282:	bf 07 00 00 00       	mov    $0x7,%edi
+  809287:	48 b8 b5 3d ff ff ff 	movabs $0xffffffffffff3db5,%rax
+  80928e:	ff ff ff 
+  809291:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  809295:	ff d0                	call   *%rax
+  809297:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80929a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80929e:	0f 88 91 00 00 00    	js     809335 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8092a4:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8092ab:	7f 08                	jg     8092b5 <nsipc_recv+0x91>
+  8092ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8092b0:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8092b3:	7e 50                	jle    809305 <nsipc_recv+0xe1>
+  8092b5:	48 b8 63 5c ff ff ff 	movabs $0xffffffffffff5c63,%rax
+  8092bc:	ff ff ff 
+  8092bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8092c3:	48 89 c1             	mov    %rax,%rcx
+  8092c6:	48 b8 78 5c ff ff ff 	movabs $0xffffffffffff5c78,%rax
+  8092cd:	ff ff ff 
+  8092d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8092d4:	48 89 c2             	mov    %rax,%rdx
+  8092d7:	be 79 00 00 00       	mov    $0x79,%esi
+  8092dc:	48 b8 8d 5c ff ff ff 	movabs $0xffffffffffff5c8d,%rax
+  8092e3:	ff ff ff 
+  8092e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8092ea:	48 89 c7             	mov    %rax,%rdi
+  8092ed:	49 89 df             	mov    %rbx,%r15
+  8092f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8092f5:	49 b8 57 f2 fe ff ff 	movabs $0xfffffffffffef257,%r8
+  8092fc:	ff ff ff 
+  8092ff:	49 01 d8             	add    %rbx,%r8
+  809302:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  809305:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809308:	48 63 d0             	movslq %eax,%rdx
+  80930b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80930f:	48 b9 88 3f 01 00 00 	movabs $0x13f88,%rcx
+  809316:	00 00 00 
+  809319:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  80931d:	48 89 ce             	mov    %rcx,%rsi
+  809320:	48 89 c7             	mov    %rax,%rdi
+  809323:	49 89 df             	mov    %rbx,%r15
+  809326:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  80932d:	ff ff ff 
+  809330:	48 01 d8             	add    %rbx,%rax
+  809333:	ff d0                	call   *%rax
+	}
+
+	return r;
+  809335:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  809338:	48 83 c4 30          	add    $0x30,%rsp
+  80933c:	5b                   	pop    %rbx
+  80933d:	41 5f                	pop    %r15
+  80933f:	5d                   	pop    %rbp
+  809340:	c3                   	ret
+
+0000000000809341 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  809341:	55                   	push   %rbp
+  809342:	48 89 e5             	mov    %rsp,%rbp
+  809345:	41 57                	push   %r15
+  809347:	53                   	push   %rbx
+  809348:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80934f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80934f <nsipc_send+0xe>
+  809356:	49 bb 29 bd 00 00 00 	movabs $0xbd29,%r11
+  80935d:	00 00 00 
+  809360:	4c 01 db             	add    %r11,%rbx
+  809363:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  809369:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  809370:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  809376:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  80937c:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  809380:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  809384:	48 b8 88 1f 01 00 00 	movabs $0x11f88,%rax
+  80938b:	00 00 00 
+  80938e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  809391:	85 c0                	test   %eax,%eax
+  809393:	75 24                	jne    8093b9 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  809395:	bf 02 00 00 00       	mov    $0x2,%edi
+  80939a:	49 89 df             	mov    %rbx,%r15
+  80939d:	48 b8 14 20 ff ff ff 	movabs $0xffffffffffff2014,%rax
+  8093a4:	ff ff ff 
+  8093a7:	48 01 d8             	add    %rbx,%rax
+  8093aa:	ff d0                	call   *%rax
+  8093ac:	48 ba 88 1f 01 00 00 	movabs $0x11f88,%rdx
+  8093b3:	00 00 00 
+  8093b6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8093b9:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8093bf:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8093c2:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8093c9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8093cc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8093cf:	39 c2                	cmp    %eax,%edx
+  8093d1:	0f 4e c2             	cmovle %edx,%eax
+  8093d4:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8093da:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8093e0:	48 63 d0             	movslq %eax,%rdx
+  8093e3:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8093ea:	48 89 c6             	mov    %rax,%rsi
+  8093ed:	48 b8 88 1f 00 00 00 	movabs $0x1f88,%rax
+  8093f4:	00 00 00 
+  8093f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8093fb:	48 89 c7             	mov    %rax,%rdi
+  8093fe:	49 89 df             	mov    %rbx,%r15
+  809401:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  809408:	ff ff ff 
+  80940b:	48 01 d8             	add    %rbx,%rax
+  80940e:	ff d0                	call   *%rax
+	req->req_s = s;
+  809410:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809414:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80941a:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80941c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809420:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  809426:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  809429:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80942d:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  809433:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  809436:	48 b8 88 1f 00 00 00 	movabs $0x1f88,%rax
+  80943d:	00 00 00 
+  809440:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  809444:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  809448:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80944f:	00 
+  809450:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  809456:	48 63 d0             	movslq %eax,%rdx
+  809459:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80945d:	48 01 d0             	add    %rdx,%rax
+  809460:	48 83 e8 01          	sub    $0x1,%rax
+  809464:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  809468:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80946c:	ba 00 00 00 00       	mov    $0x0,%edx
+  809471:	48 f7 75 d8          	divq   -0x28(%rbp)
+  809475:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  809479:	48 29 d0             	sub    %rdx,%rax
+  80947c:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  809482:	85 c0                	test   %eax,%eax
+  809484:	0f 48 c2             	cmovs  %edx,%eax
+  809487:	c1 f8 0c             	sar    $0xc,%eax
+  80948a:	48 98                	cltq
+  80948c:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  809490:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  809494:	48 85 c0             	test   %rax,%rax
+  809497:	0f 95 c0             	setne  %al
+  80949a:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  80949d:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8094a4:	00 
+  8094a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8094a9:	48 83 c0 0b          	add    $0xb,%rax
+  8094ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8094b1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8094b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8094ba:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8094be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8094c2:	48 29 d0             	sub    %rdx,%rax
+  8094c5:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8094c9:	89 c7                	mov    %eax,%edi
+  8094cb:	48 b8 88 1f 01 00 00 	movabs $0x11f88,%rax
+  8094d2:	00 00 00 
+  8094d5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8094d8:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8094dc:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8094e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8094e4:	6a 00                	push   $0x0
+  8094e6:	6a 00                	push   $0x0
+  8094e8:	6a 05                	push   $0x5
+  8094ea:	41 89 f1             	mov    %esi,%r9d
+  8094ed:	49 89 c8             	mov    %rcx,%r8
+  8094f0:	89 f9                	mov    %edi,%ecx
+  8094f2:	be 08 00 00 00       	mov    $0x8,%esi
+  8094f7:	89 c7                	mov    %eax,%edi
+  8094f9:	49 89 df             	mov    %rbx,%r15
+  8094fc:	48 b8 1c 1c ff ff ff 	movabs $0xffffffffffff1c1c,%rax
+  809503:	ff ff ff 
+  809506:	48 01 d8             	add    %rbx,%rax
+  809509:	ff d0                	call   *%rax
+  80950b:	48 83 c4 20          	add    $0x20,%rsp
+}
+  80950f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  809513:	5b                   	pop    %rbx
+  809514:	41 5f                	pop    %r15
+  809516:	5d                   	pop    %rbp
+  809517:	c3                   	ret
+
+0000000000809518 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  809518:	55                   	push   %rbp
+  809519:	48 89 e5             	mov    %rsp,%rbp
+  80951c:	48 83 ec 10          	sub    $0x10,%rsp
+  809520:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 809520 <nsipc_socket+0x8>
+  809527:	49 bb 58 bb 00 00 00 	movabs $0xbb58,%r11
+  80952e:	00 00 00 
+  809531:	4c 01 d8             	add    %r11,%rax
+  809534:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  809537:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  80953a:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  80953d:	48 b9 88 3f 01 00 00 	movabs $0x13f88,%rcx
+  809544:	00 00 00 
+  809547:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80954a:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  80954d:	48 b9 88 3f 01 00 00 	movabs $0x13f88,%rcx
+  809554:	00 00 00 
+  809557:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80955a:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  80955e:	48 b9 88 3f 01 00 00 	movabs $0x13f88,%rcx
+  809565:	00 00 00 
+  809568:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80956b:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  80956f:	bf 09 00 00 00       	mov    $0x9,%edi
+  809574:	48 ba b5 3d ff ff ff 	movabs $0xffffffffffff3db5,%rdx
+  80957b:	ff ff ff 
+  80957e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  809582:	ff d0                	call   *%rax
+}
+  809584:	c9                   	leave
+  809585:	c3                   	ret
+
+0000000000809586 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  809586:	55                   	push   %rbp
+  809587:	48 89 e5             	mov    %rsp,%rbp
+  80958a:	41 57                	push   %r15
+  80958c:	53                   	push   %rbx
+  80958d:	48 83 ec 30          	sub    $0x30,%rsp
+  809591:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809591 <pipe+0xb>
+  809598:	49 bb e7 ba 00 00 00 	movabs $0xbae7,%r11
+  80959f:	00 00 00 
+  8095a2:	4c 01 db             	add    %r11,%rbx
+  8095a5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8095a9:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8095ad:	48 89 c7             	mov    %rax,%rdi
+  8095b0:	49 89 df             	mov    %rbx,%r15
+  8095b3:	48 b8 1d 21 ff ff ff 	movabs $0xffffffffffff211d,%rax
+  8095ba:	ff ff ff 
+  8095bd:	48 01 d8             	add    %rbx,%rax
+  8095c0:	ff d0                	call   *%rax
+  8095c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8095c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8095c9:	0f 88 12 02 00 00    	js     8097e1 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8095cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8095d3:	ba 07 04 00 00       	mov    $0x407,%edx
+  8095d8:	48 89 c6             	mov    %rax,%rsi
+  8095db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8095e0:	49 89 df             	mov    %rbx,%r15
+  8095e3:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  8095ea:	ff ff ff 
+  8095ed:	48 01 d8             	add    %rbx,%rax
+  8095f0:	ff d0                	call   *%rax
+  8095f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8095f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8095f9:	0f 88 e2 01 00 00    	js     8097e1 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8095ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  809603:	48 89 c7             	mov    %rax,%rdi
+  809606:	49 89 df             	mov    %rbx,%r15
+  809609:	48 b8 1d 21 ff ff ff 	movabs $0xffffffffffff211d,%rax
+  809610:	ff ff ff 
+  809613:	48 01 d8             	add    %rbx,%rax
+  809616:	ff d0                	call   *%rax
+  809618:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80961b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80961f:	0f 88 9b 01 00 00    	js     8097c0 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  809625:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  809629:	ba 07 04 00 00       	mov    $0x407,%edx
+  80962e:	48 89 c6             	mov    %rax,%rsi
+  809631:	bf 00 00 00 00       	mov    $0x0,%edi
+  809636:	49 89 df             	mov    %rbx,%r15
+  809639:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  809640:	ff ff ff 
+  809643:	48 01 d8             	add    %rbx,%rax
+  809646:	ff d0                	call   *%rax
+  809648:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80964b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80964f:	0f 88 6b 01 00 00    	js     8097c0 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  809655:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  809659:	48 89 c7             	mov    %rax,%rdi
+  80965c:	49 89 df             	mov    %rbx,%r15
+  80965f:	48 b8 da 20 ff ff ff 	movabs $0xffffffffffff20da,%rax
+  809666:	ff ff ff 
+  809669:	48 01 d8             	add    %rbx,%rax
+  80966c:	ff d0                	call   *%rax
+  80966e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  809672:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809676:	ba 07 04 00 00       	mov    $0x407,%edx
+  80967b:	48 89 c6             	mov    %rax,%rsi
+  80967e:	bf 00 00 00 00       	mov    $0x0,%edi
+  809683:	49 89 df             	mov    %rbx,%r15
+  809686:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  80968d:	ff ff ff 
+  809690:	48 01 d8             	add    %rbx,%rax
+  809693:	ff d0                	call   *%rax
+  809695:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  809698:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80969c:	0f 88 fd 00 00 00    	js     80979f <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8096a2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8096a6:	48 89 c7             	mov    %rax,%rdi
+  8096a9:	49 89 df             	mov    %rbx,%r15
+  8096ac:	48 b8 da 20 ff ff ff 	movabs $0xffffffffffff20da,%rax
+  8096b3:	ff ff ff 
+  8096b6:	48 01 d8             	add    %rbx,%rax
+  8096b9:	ff d0                	call   *%rax
+  8096bb:	48 89 c2             	mov    %rax,%rdx
+  8096be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8096c2:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8096c8:	48 89 d1             	mov    %rdx,%rcx
+  8096cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8096d0:	48 89 c6             	mov    %rax,%rsi
+  8096d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8096d8:	49 89 df             	mov    %rbx,%r15
+  8096db:	48 b8 11 10 ff ff ff 	movabs $0xffffffffffff1011,%rax
+  8096e2:	ff ff ff 
+  8096e5:	48 01 d8             	add    %rbx,%rax
+  8096e8:	ff d0                	call   *%rax
+  8096ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8096ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8096f1:	0f 88 87 00 00 00    	js     80977e <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8096f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8096fb:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  809702:	00 00 00 
+  809705:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  809708:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  80970a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80970e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  809715:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  809719:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  809720:	00 00 00 
+  809723:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  809726:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  809728:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80972c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  809733:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  809737:	48 89 c7             	mov    %rax,%rdi
+  80973a:	49 89 df             	mov    %rbx,%r15
+  80973d:	48 b8 a3 20 ff ff ff 	movabs $0xffffffffffff20a3,%rax
+  809744:	ff ff ff 
+  809747:	48 01 d8             	add    %rbx,%rax
+  80974a:	ff d0                	call   *%rax
+  80974c:	89 c2                	mov    %eax,%edx
+  80974e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809752:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  809754:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  809758:	48 89 c7             	mov    %rax,%rdi
+  80975b:	49 89 df             	mov    %rbx,%r15
+  80975e:	48 b8 a3 20 ff ff ff 	movabs $0xffffffffffff20a3,%rax
+  809765:	ff ff ff 
+  809768:	48 01 d8             	add    %rbx,%rax
+  80976b:	ff d0                	call   *%rax
+  80976d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  809771:	48 83 c2 04          	add    $0x4,%rdx
+  809775:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  809777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80977c:	eb 67                	jmp    8097e5 <pipe+0x25f>
+		goto err3;
+  80977e:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80977f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809783:	48 89 c6             	mov    %rax,%rsi
+  809786:	bf 00 00 00 00       	mov    $0x0,%edi
+  80978b:	49 89 df             	mov    %rbx,%r15
+  80978e:	48 b8 84 10 ff ff ff 	movabs $0xffffffffffff1084,%rax
+  809795:	ff ff ff 
+  809798:	48 01 d8             	add    %rbx,%rax
+  80979b:	ff d0                	call   *%rax
+  80979d:	eb 01                	jmp    8097a0 <pipe+0x21a>
+		goto err2;
+  80979f:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  8097a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8097a4:	48 89 c6             	mov    %rax,%rsi
+  8097a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8097ac:	49 89 df             	mov    %rbx,%r15
+  8097af:	48 b8 84 10 ff ff ff 	movabs $0xffffffffffff1084,%rax
+  8097b6:	ff ff ff 
+  8097b9:	48 01 d8             	add    %rbx,%rax
+  8097bc:	ff d0                	call   *%rax
+  8097be:	eb 01                	jmp    8097c1 <pipe+0x23b>
+		goto err1;
+  8097c0:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8097c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8097c5:	48 89 c6             	mov    %rax,%rsi
+  8097c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8097cd:	49 89 df             	mov    %rbx,%r15
+  8097d0:	48 b8 84 10 ff ff ff 	movabs $0xffffffffffff1084,%rax
+  8097d7:	ff ff ff 
+  8097da:	48 01 d8             	add    %rbx,%rax
+  8097dd:	ff d0                	call   *%rax
+  8097df:	eb 01                	jmp    8097e2 <pipe+0x25c>
+		goto err;
+  8097e1:	90                   	nop
+err:
+	return r;
+  8097e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8097e5:	48 83 c4 30          	add    $0x30,%rsp
+  8097e9:	5b                   	pop    %rbx
+  8097ea:	41 5f                	pop    %r15
+  8097ec:	5d                   	pop    %rbp
+  8097ed:	c3                   	ret
+
+00000000008097ee <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8097ee:	55                   	push   %rbp
+  8097ef:	48 89 e5             	mov    %rsp,%rbp
+  8097f2:	41 57                	push   %r15
+  8097f4:	41 54                	push   %r12
+  8097f6:	53                   	push   %rbx
+  8097f7:	48 83 ec 28          	sub    $0x28,%rsp
+  8097fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8097fb <_pipeisclosed+0xd>
+  809802:	49 bb 7d b8 00 00 00 	movabs $0xb87d,%r11
+  809809:	00 00 00 
+  80980c:	4c 01 db             	add    %r11,%rbx
+  80980f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  809813:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  809817:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80981e:	ff ff ff 
+  809821:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  809825:	48 8b 00             	mov    (%rax),%rax
+  809828:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80982e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  809831:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809835:	48 89 c7             	mov    %rax,%rdi
+  809838:	49 89 df             	mov    %rbx,%r15
+  80983b:	48 b8 5c 37 ff ff ff 	movabs $0xffffffffffff375c,%rax
+  809842:	ff ff ff 
+  809845:	48 01 d8             	add    %rbx,%rax
+  809848:	ff d0                	call   *%rax
+  80984a:	41 89 c4             	mov    %eax,%r12d
+  80984d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  809851:	48 89 c7             	mov    %rax,%rdi
+  809854:	49 89 df             	mov    %rbx,%r15
+  809857:	48 b8 5c 37 ff ff ff 	movabs $0xffffffffffff375c,%rax
+  80985e:	ff ff ff 
+  809861:	48 01 d8             	add    %rbx,%rax
+  809864:	ff d0                	call   *%rax
+  809866:	41 39 c4             	cmp    %eax,%r12d
+  809869:	0f 94 c0             	sete   %al
+  80986c:	0f b6 c0             	movzbl %al,%eax
+  80986f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  809872:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  809879:	ff ff ff 
+  80987c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  809880:	48 8b 00             	mov    (%rax),%rax
+  809883:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  809889:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80988c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80988f:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  809892:	75 05                	jne    809899 <_pipeisclosed+0xab>
+			return ret;
+  809894:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  809897:	eb 63                	jmp    8098fc <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  809899:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80989c:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80989f:	0f 84 72 ff ff ff    	je     809817 <_pipeisclosed+0x29>
+  8098a5:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  8098a9:	0f 85 68 ff ff ff    	jne    809817 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8098af:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8098b6:	ff ff ff 
+  8098b9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8098bd:	48 8b 00             	mov    (%rax),%rax
+  8098c0:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8098c6:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8098c9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8098cc:	89 c6                	mov    %eax,%esi
+  8098ce:	48 b8 9e 5c ff ff ff 	movabs $0xffffffffffff5c9e,%rax
+  8098d5:	ff ff ff 
+  8098d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8098dc:	48 89 c7             	mov    %rax,%rdi
+  8098df:	49 89 df             	mov    %rbx,%r15
+  8098e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8098e7:	49 b8 2e f5 fe ff ff 	movabs $0xfffffffffffef52e,%r8
+  8098ee:	ff ff ff 
+  8098f1:	49 01 d8             	add    %rbx,%r8
+  8098f4:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8098f7:	e9 1b ff ff ff       	jmp    809817 <_pipeisclosed+0x29>
+	}
+}
+  8098fc:	48 83 c4 28          	add    $0x28,%rsp
+  809900:	5b                   	pop    %rbx
+  809901:	41 5c                	pop    %r12
+  809903:	41 5f                	pop    %r15
+  809905:	5d                   	pop    %rbp
+  809906:	c3                   	ret
+
+0000000000809907 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  809907:	55                   	push   %rbp
+  809908:	48 89 e5             	mov    %rsp,%rbp
+  80990b:	41 57                	push   %r15
+  80990d:	53                   	push   %rbx
+  80990e:	48 83 ec 30          	sub    $0x30,%rsp
+  809912:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809912 <pipeisclosed+0xb>
+  809919:	49 bb 66 b7 00 00 00 	movabs $0xb766,%r11
+  809920:	00 00 00 
+  809923:	4c 01 db             	add    %r11,%rbx
+  809926:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  809929:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80992d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  809930:	48 89 d6             	mov    %rdx,%rsi
+  809933:	89 c7                	mov    %eax,%edi
+  809935:	49 89 df             	mov    %rbx,%r15
+  809938:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  80993f:	ff ff ff 
+  809942:	48 01 d8             	add    %rbx,%rax
+  809945:	ff d0                	call   *%rax
+  809947:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80994a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80994e:	79 05                	jns    809955 <pipeisclosed+0x4e>
+		return r;
+  809950:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809953:	eb 3b                	jmp    809990 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  809955:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  809959:	48 89 c7             	mov    %rax,%rdi
+  80995c:	49 89 df             	mov    %rbx,%r15
+  80995f:	48 b8 da 20 ff ff ff 	movabs $0xffffffffffff20da,%rax
+  809966:	ff ff ff 
+  809969:	48 01 d8             	add    %rbx,%rax
+  80996c:	ff d0                	call   *%rax
+  80996e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  809972:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  809976:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80997a:	48 89 d6             	mov    %rdx,%rsi
+  80997d:	48 89 c7             	mov    %rax,%rdi
+  809980:	48 b8 76 47 ff ff ff 	movabs $0xffffffffffff4776,%rax
+  809987:	ff ff ff 
+  80998a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80998e:	ff d0                	call   *%rax
+}
+  809990:	48 83 c4 30          	add    $0x30,%rsp
+  809994:	5b                   	pop    %rbx
+  809995:	41 5f                	pop    %r15
+  809997:	5d                   	pop    %rbp
+  809998:	c3                   	ret
+
+0000000000809999 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  809999:	55                   	push   %rbp
+  80999a:	48 89 e5             	mov    %rsp,%rbp
+  80999d:	41 57                	push   %r15
+  80999f:	53                   	push   %rbx
+  8099a0:	48 83 ec 40          	sub    $0x40,%rsp
+  8099a4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8099a4 <devpipe_read+0xb>
+  8099ab:	49 bb d4 b6 00 00 00 	movabs $0xb6d4,%r11
+  8099b2:	00 00 00 
+  8099b5:	4c 01 db             	add    %r11,%rbx
+  8099b8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8099bc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8099c0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8099c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8099c8:	48 89 c7             	mov    %rax,%rdi
+  8099cb:	49 89 df             	mov    %rbx,%r15
+  8099ce:	48 b8 da 20 ff ff ff 	movabs $0xffffffffffff20da,%rax
+  8099d5:	ff ff ff 
+  8099d8:	48 01 d8             	add    %rbx,%rax
+  8099db:	ff d0                	call   *%rax
+  8099dd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8099e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8099e5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8099e9:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8099f0:	00 
+  8099f1:	e9 a1 00 00 00       	jmp    809a97 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8099f6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8099fb:	74 09                	je     809a06 <devpipe_read+0x6d>
+				return i;
+  8099fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809a01:	e9 9f 00 00 00       	jmp    809aa5 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  809a06:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  809a0a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809a0e:	48 89 d6             	mov    %rdx,%rsi
+  809a11:	48 89 c7             	mov    %rax,%rdi
+  809a14:	48 b8 76 47 ff ff ff 	movabs $0xffffffffffff4776,%rax
+  809a1b:	ff ff ff 
+  809a1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  809a22:	ff d0                	call   *%rax
+  809a24:	85 c0                	test   %eax,%eax
+  809a26:	74 07                	je     809a2f <devpipe_read+0x96>
+				return 0;
+  809a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  809a2d:	eb 76                	jmp    809aa5 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  809a2f:	49 89 df             	mov    %rbx,%r15
+  809a32:	48 b8 57 0f ff ff ff 	movabs $0xffffffffffff0f57,%rax
+  809a39:	ff ff ff 
+  809a3c:	48 01 d8             	add    %rbx,%rax
+  809a3f:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  809a41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809a45:	8b 10                	mov    (%rax),%edx
+  809a47:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809a4b:	8b 40 04             	mov    0x4(%rax),%eax
+  809a4e:	39 c2                	cmp    %eax,%edx
+  809a50:	74 a4                	je     8099f6 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  809a52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809a56:	8b 10                	mov    (%rax),%edx
+  809a58:	89 d0                	mov    %edx,%eax
+  809a5a:	c1 f8 1f             	sar    $0x1f,%eax
+  809a5d:	c1 e8 1b             	shr    $0x1b,%eax
+  809a60:	01 c2                	add    %eax,%edx
+  809a62:	83 e2 1f             	and    $0x1f,%edx
+  809a65:	29 c2                	sub    %eax,%edx
+  809a67:	89 d6                	mov    %edx,%esi
+  809a69:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  809a6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809a71:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  809a75:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  809a79:	48 63 c6             	movslq %esi,%rax
+  809a7c:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  809a81:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  809a83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809a87:	8b 00                	mov    (%rax),%eax
+  809a89:	8d 50 01             	lea    0x1(%rax),%edx
+  809a8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809a90:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  809a92:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  809a97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809a9b:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  809a9f:	72 a0                	jb     809a41 <devpipe_read+0xa8>
+	}
+	return i;
+  809aa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  809aa5:	48 83 c4 40          	add    $0x40,%rsp
+  809aa9:	5b                   	pop    %rbx
+  809aaa:	41 5f                	pop    %r15
+  809aac:	5d                   	pop    %rbp
+  809aad:	c3                   	ret
+
+0000000000809aae <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  809aae:	55                   	push   %rbp
+  809aaf:	48 89 e5             	mov    %rsp,%rbp
+  809ab2:	41 57                	push   %r15
+  809ab4:	53                   	push   %rbx
+  809ab5:	48 83 ec 40          	sub    $0x40,%rsp
+  809ab9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809ab9 <devpipe_write+0xb>
+  809ac0:	49 bb bf b5 00 00 00 	movabs $0xb5bf,%r11
+  809ac7:	00 00 00 
+  809aca:	4c 01 db             	add    %r11,%rbx
+  809acd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  809ad1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  809ad5:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  809ad9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809add:	48 89 c7             	mov    %rax,%rdi
+  809ae0:	49 89 df             	mov    %rbx,%r15
+  809ae3:	48 b8 da 20 ff ff ff 	movabs $0xffffffffffff20da,%rax
+  809aea:	ff ff ff 
+  809aed:	48 01 d8             	add    %rbx,%rax
+  809af0:	ff d0                	call   *%rax
+  809af2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  809af6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  809afa:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  809afe:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  809b05:	00 
+  809b06:	e9 a0 00 00 00       	jmp    809bab <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  809b0b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  809b0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809b13:	48 89 d6             	mov    %rdx,%rsi
+  809b16:	48 89 c7             	mov    %rax,%rdi
+  809b19:	48 b8 76 47 ff ff ff 	movabs $0xffffffffffff4776,%rax
+  809b20:	ff ff ff 
+  809b23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  809b27:	ff d0                	call   *%rax
+  809b29:	85 c0                	test   %eax,%eax
+  809b2b:	74 0a                	je     809b37 <devpipe_write+0x89>
+				return 0;
+  809b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  809b32:	e9 82 00 00 00       	jmp    809bb9 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  809b37:	49 89 df             	mov    %rbx,%r15
+  809b3a:	48 b8 57 0f ff ff ff 	movabs $0xffffffffffff0f57,%rax
+  809b41:	ff ff ff 
+  809b44:	48 01 d8             	add    %rbx,%rax
+  809b47:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  809b49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809b4d:	8b 40 04             	mov    0x4(%rax),%eax
+  809b50:	48 63 d0             	movslq %eax,%rdx
+  809b53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809b57:	8b 00                	mov    (%rax),%eax
+  809b59:	48 98                	cltq
+  809b5b:	48 83 c0 20          	add    $0x20,%rax
+  809b5f:	48 39 c2             	cmp    %rax,%rdx
+  809b62:	73 a7                	jae    809b0b <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  809b64:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  809b68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809b6c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  809b70:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809b74:	8b 50 04             	mov    0x4(%rax),%edx
+  809b77:	89 d0                	mov    %edx,%eax
+  809b79:	c1 f8 1f             	sar    $0x1f,%eax
+  809b7c:	c1 e8 1b             	shr    $0x1b,%eax
+  809b7f:	01 c2                	add    %eax,%edx
+  809b81:	83 e2 1f             	and    $0x1f,%edx
+  809b84:	29 c2                	sub    %eax,%edx
+  809b86:	89 d0                	mov    %edx,%eax
+  809b88:	0f b6 09             	movzbl (%rcx),%ecx
+  809b8b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  809b8f:	48 98                	cltq
+  809b91:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  809b95:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809b99:	8b 40 04             	mov    0x4(%rax),%eax
+  809b9c:	8d 50 01             	lea    0x1(%rax),%edx
+  809b9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809ba3:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  809ba6:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  809bab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809baf:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  809bb3:	72 94                	jb     809b49 <devpipe_write+0x9b>
+	}
+
+	return i;
+  809bb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  809bb9:	48 83 c4 40          	add    $0x40,%rsp
+  809bbd:	5b                   	pop    %rbx
+  809bbe:	41 5f                	pop    %r15
+  809bc0:	5d                   	pop    %rbp
+  809bc1:	c3                   	ret
+
+0000000000809bc2 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  809bc2:	55                   	push   %rbp
+  809bc3:	48 89 e5             	mov    %rsp,%rbp
+  809bc6:	41 57                	push   %r15
+  809bc8:	53                   	push   %rbx
+  809bc9:	48 83 ec 20          	sub    $0x20,%rsp
+  809bcd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809bcd <devpipe_stat+0xb>
+  809bd4:	49 bb ab b4 00 00 00 	movabs $0xb4ab,%r11
+  809bdb:	00 00 00 
+  809bde:	4c 01 db             	add    %r11,%rbx
+  809be1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  809be5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  809be9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  809bed:	48 89 c7             	mov    %rax,%rdi
+  809bf0:	49 89 df             	mov    %rbx,%r15
+  809bf3:	48 b8 da 20 ff ff ff 	movabs $0xffffffffffff20da,%rax
+  809bfa:	ff ff ff 
+  809bfd:	48 01 d8             	add    %rbx,%rax
+  809c00:	ff d0                	call   *%rax
+  809c02:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  809c06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  809c0a:	48 ba b1 5c ff ff ff 	movabs $0xffffffffffff5cb1,%rdx
+  809c11:	ff ff ff 
+  809c14:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  809c18:	48 89 d6             	mov    %rdx,%rsi
+  809c1b:	48 89 c7             	mov    %rax,%rdi
+  809c1e:	49 89 df             	mov    %rbx,%r15
+  809c21:	48 b8 f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rax
+  809c28:	ff ff ff 
+  809c2b:	48 01 d8             	add    %rbx,%rax
+  809c2e:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  809c30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809c34:	8b 50 04             	mov    0x4(%rax),%edx
+  809c37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809c3b:	8b 00                	mov    (%rax),%eax
+  809c3d:	29 c2                	sub    %eax,%edx
+  809c3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  809c43:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  809c49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  809c4d:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  809c54:	00 00 00 
+	stat->st_dev = &devpipe;
+  809c57:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  809c5b:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  809c62:	00 00 00 
+  809c65:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  809c69:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  809c70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  809c75:	48 83 c4 20          	add    $0x20,%rsp
+  809c79:	5b                   	pop    %rbx
+  809c7a:	41 5f                	pop    %r15
+  809c7c:	5d                   	pop    %rbp
+  809c7d:	c3                   	ret
+
+0000000000809c7e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  809c7e:	55                   	push   %rbp
+  809c7f:	48 89 e5             	mov    %rsp,%rbp
+  809c82:	41 57                	push   %r15
+  809c84:	53                   	push   %rbx
+  809c85:	48 83 ec 10          	sub    $0x10,%rsp
+  809c89:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809c89 <devpipe_close+0xb>
+  809c90:	49 bb ef b3 00 00 00 	movabs $0xb3ef,%r11
+  809c97:	00 00 00 
+  809c9a:	4c 01 db             	add    %r11,%rbx
+  809c9d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  809ca1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809ca5:	48 89 c6             	mov    %rax,%rsi
+  809ca8:	bf 00 00 00 00       	mov    $0x0,%edi
+  809cad:	49 89 df             	mov    %rbx,%r15
+  809cb0:	48 b8 84 10 ff ff ff 	movabs $0xffffffffffff1084,%rax
+  809cb7:	ff ff ff 
+  809cba:	48 01 d8             	add    %rbx,%rax
+  809cbd:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  809cbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809cc3:	48 89 c7             	mov    %rax,%rdi
+  809cc6:	49 89 df             	mov    %rbx,%r15
+  809cc9:	48 b8 da 20 ff ff ff 	movabs $0xffffffffffff20da,%rax
+  809cd0:	ff ff ff 
+  809cd3:	48 01 d8             	add    %rbx,%rax
+  809cd6:	ff d0                	call   *%rax
+  809cd8:	48 89 c6             	mov    %rax,%rsi
+  809cdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  809ce0:	49 89 df             	mov    %rbx,%r15
+  809ce3:	48 b8 84 10 ff ff ff 	movabs $0xffffffffffff1084,%rax
+  809cea:	ff ff ff 
+  809ced:	48 01 d8             	add    %rbx,%rax
+  809cf0:	ff d0                	call   *%rax
+}
+  809cf2:	48 83 c4 10          	add    $0x10,%rsp
+  809cf6:	5b                   	pop    %rbx
+  809cf7:	41 5f                	pop    %r15
+  809cf9:	5d                   	pop    %rbp
+  809cfa:	c3                   	ret
+
+0000000000809cfb <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  809cfb:	55                   	push   %rbp
+  809cfc:	48 89 e5             	mov    %rsp,%rbp
+  809cff:	41 57                	push   %r15
+  809d01:	48 83 ec 28          	sub    $0x28,%rsp
+  809d05:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 809d05 <cputchar+0xa>
+  809d0c:	49 bb 73 b3 00 00 00 	movabs $0xb373,%r11
+  809d13:	00 00 00 
+  809d16:	4c 01 d8             	add    %r11,%rax
+  809d19:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  809d1c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  809d1f:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  809d22:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  809d26:	be 01 00 00 00       	mov    $0x1,%esi
+  809d2b:	48 89 d7             	mov    %rdx,%rdi
+  809d2e:	49 89 c7             	mov    %rax,%r15
+  809d31:	48 ba f4 0d ff ff ff 	movabs $0xffffffffffff0df4,%rdx
+  809d38:	ff ff ff 
+  809d3b:	48 01 c2             	add    %rax,%rdx
+  809d3e:	ff d2                	call   *%rdx
+}
+  809d40:	90                   	nop
+  809d41:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  809d45:	c9                   	leave
+  809d46:	c3                   	ret
+
+0000000000809d47 <getchar>:
+
+int
+getchar(void)
+{
+  809d47:	55                   	push   %rbp
+  809d48:	48 89 e5             	mov    %rsp,%rbp
+  809d4b:	41 57                	push   %r15
+  809d4d:	48 83 ec 18          	sub    $0x18,%rsp
+  809d51:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 809d51 <getchar+0xa>
+  809d58:	49 bb 27 b3 00 00 00 	movabs $0xb327,%r11
+  809d5f:	00 00 00 
+  809d62:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  809d65:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  809d69:	ba 01 00 00 00       	mov    $0x1,%edx
+  809d6e:	48 89 ce             	mov    %rcx,%rsi
+  809d71:	bf 00 00 00 00       	mov    $0x0,%edi
+  809d76:	49 89 c7             	mov    %rax,%r15
+  809d79:	48 b9 1a 27 ff ff ff 	movabs $0xffffffffffff271a,%rcx
+  809d80:	ff ff ff 
+  809d83:	48 01 c1             	add    %rax,%rcx
+  809d86:	ff d1                	call   *%rcx
+  809d88:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  809d8b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809d8f:	79 05                	jns    809d96 <getchar+0x4f>
+		return r;
+  809d91:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809d94:	eb 14                	jmp    809daa <getchar+0x63>
+	if (r < 1)
+  809d96:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809d9a:	7f 07                	jg     809da3 <getchar+0x5c>
+		return -E_EOF;
+  809d9c:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  809da1:	eb 07                	jmp    809daa <getchar+0x63>
+	return c;
+  809da3:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  809da7:	0f b6 c0             	movzbl %al,%eax
+}
+  809daa:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  809dae:	c9                   	leave
+  809daf:	c3                   	ret
+
+0000000000809db0 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  809db0:	55                   	push   %rbp
+  809db1:	48 89 e5             	mov    %rsp,%rbp
+  809db4:	41 57                	push   %r15
+  809db6:	53                   	push   %rbx
+  809db7:	48 83 ec 20          	sub    $0x20,%rsp
+  809dbb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809dbb <iscons+0xb>
+  809dc2:	49 bb bd b2 00 00 00 	movabs $0xb2bd,%r11
+  809dc9:	00 00 00 
+  809dcc:	4c 01 db             	add    %r11,%rbx
+  809dcf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  809dd2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  809dd6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  809dd9:	48 89 d6             	mov    %rdx,%rsi
+  809ddc:	89 c7                	mov    %eax,%edi
+  809dde:	49 89 df             	mov    %rbx,%r15
+  809de1:	48 b8 d3 21 ff ff ff 	movabs $0xffffffffffff21d3,%rax
+  809de8:	ff ff ff 
+  809deb:	48 01 d8             	add    %rbx,%rax
+  809dee:	ff d0                	call   *%rax
+  809df0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  809df3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809df7:	79 05                	jns    809dfe <iscons+0x4e>
+		return r;
+  809df9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809dfc:	eb 1b                	jmp    809e19 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  809dfe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809e02:	8b 10                	mov    (%rax),%edx
+  809e04:	48 b8 48 01 00 00 00 	movabs $0x148,%rax
+  809e0b:	00 00 00 
+  809e0e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  809e11:	39 c2                	cmp    %eax,%edx
+  809e13:	0f 94 c0             	sete   %al
+  809e16:	0f b6 c0             	movzbl %al,%eax
+}
+  809e19:	48 83 c4 20          	add    $0x20,%rsp
+  809e1d:	5b                   	pop    %rbx
+  809e1e:	41 5f                	pop    %r15
+  809e20:	5d                   	pop    %rbp
+  809e21:	c3                   	ret
+
+0000000000809e22 <opencons>:
+
+int
+opencons(void)
+{
+  809e22:	55                   	push   %rbp
+  809e23:	48 89 e5             	mov    %rsp,%rbp
+  809e26:	41 57                	push   %r15
+  809e28:	53                   	push   %rbx
+  809e29:	48 83 ec 10          	sub    $0x10,%rsp
+  809e2d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809e2d <opencons+0xb>
+  809e34:	49 bb 4b b2 00 00 00 	movabs $0xb24b,%r11
+  809e3b:	00 00 00 
+  809e3e:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  809e41:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  809e45:	48 89 c7             	mov    %rax,%rdi
+  809e48:	49 89 df             	mov    %rbx,%r15
+  809e4b:	48 b8 1d 21 ff ff ff 	movabs $0xffffffffffff211d,%rax
+  809e52:	ff ff ff 
+  809e55:	48 01 d8             	add    %rbx,%rax
+  809e58:	ff d0                	call   *%rax
+  809e5a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  809e5d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809e61:	79 05                	jns    809e68 <opencons+0x46>
+		return r;
+  809e63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809e66:	eb 68                	jmp    809ed0 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  809e68:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809e6c:	ba 07 04 00 00       	mov    $0x407,%edx
+  809e71:	48 89 c6             	mov    %rax,%rsi
+  809e74:	bf 00 00 00 00       	mov    $0x0,%edi
+  809e79:	49 89 df             	mov    %rbx,%r15
+  809e7c:	48 b8 ac 0f ff ff ff 	movabs $0xffffffffffff0fac,%rax
+  809e83:	ff ff ff 
+  809e86:	48 01 d8             	add    %rbx,%rax
+  809e89:	ff d0                	call   *%rax
+  809e8b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  809e8e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809e92:	79 05                	jns    809e99 <opencons+0x77>
+		return r;
+  809e94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809e97:	eb 37                	jmp    809ed0 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  809e99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809e9d:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  809ea4:	00 00 00 
+  809ea7:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  809eaa:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  809eac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809eb0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  809eb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809ebb:	48 89 c7             	mov    %rax,%rdi
+  809ebe:	49 89 df             	mov    %rbx,%r15
+  809ec1:	48 b8 a3 20 ff ff ff 	movabs $0xffffffffffff20a3,%rax
+  809ec8:	ff ff ff 
+  809ecb:	48 01 d8             	add    %rbx,%rax
+  809ece:	ff d0                	call   *%rax
+}
+  809ed0:	48 83 c4 10          	add    $0x10,%rsp
+  809ed4:	5b                   	pop    %rbx
+  809ed5:	41 5f                	pop    %r15
+  809ed7:	5d                   	pop    %rbp
+  809ed8:	c3                   	ret
+
+0000000000809ed9 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  809ed9:	55                   	push   %rbp
+  809eda:	48 89 e5             	mov    %rsp,%rbp
+  809edd:	41 57                	push   %r15
+  809edf:	53                   	push   %rbx
+  809ee0:	48 83 ec 30          	sub    $0x30,%rsp
+  809ee4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809ee4 <devcons_read+0xb>
+  809eeb:	49 bb 94 b1 00 00 00 	movabs $0xb194,%r11
+  809ef2:	00 00 00 
+  809ef5:	4c 01 db             	add    %r11,%rbx
+  809ef8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  809efc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  809f00:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  809f04:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  809f09:	75 19                	jne    809f24 <devcons_read+0x4b>
+		return 0;
+  809f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  809f10:	eb 55                	jmp    809f67 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  809f12:	49 89 df             	mov    %rbx,%r15
+  809f15:	48 b8 57 0f ff ff ff 	movabs $0xffffffffffff0f57,%rax
+  809f1c:	ff ff ff 
+  809f1f:	48 01 d8             	add    %rbx,%rax
+  809f22:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  809f24:	49 89 df             	mov    %rbx,%r15
+  809f27:	48 b8 53 0e ff ff ff 	movabs $0xffffffffffff0e53,%rax
+  809f2e:	ff ff ff 
+  809f31:	48 01 d8             	add    %rbx,%rax
+  809f34:	ff d0                	call   *%rax
+  809f36:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  809f39:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809f3d:	74 d3                	je     809f12 <devcons_read+0x39>
+	if (c < 0)
+  809f3f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809f43:	79 05                	jns    809f4a <devcons_read+0x71>
+		return c;
+  809f45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809f48:	eb 1d                	jmp    809f67 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  809f4a:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  809f4e:	75 07                	jne    809f57 <devcons_read+0x7e>
+		return 0;
+  809f50:	b8 00 00 00 00       	mov    $0x0,%eax
+  809f55:	eb 10                	jmp    809f67 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  809f57:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809f5a:	89 c2                	mov    %eax,%edx
+  809f5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  809f60:	88 10                	mov    %dl,(%rax)
+	return 1;
+  809f62:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  809f67:	48 83 c4 30          	add    $0x30,%rsp
+  809f6b:	5b                   	pop    %rbx
+  809f6c:	41 5f                	pop    %r15
+  809f6e:	5d                   	pop    %rbp
+  809f6f:	c3                   	ret
+
+0000000000809f70 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  809f70:	55                   	push   %rbp
+  809f71:	48 89 e5             	mov    %rsp,%rbp
+  809f74:	41 57                	push   %r15
+  809f76:	53                   	push   %rbx
+  809f77:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  809f7e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809f7e <devcons_write+0xe>
+  809f85:	49 bb fa b0 00 00 00 	movabs $0xb0fa,%r11
+  809f8c:	00 00 00 
+  809f8f:	4c 01 db             	add    %r11,%rbx
+  809f92:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  809f99:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  809fa0:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  809fa7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  809fae:	e9 80 00 00 00       	jmp    80a033 <devcons_write+0xc3>
+		m = n - tot;
+  809fb3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  809fba:	89 c2                	mov    %eax,%edx
+  809fbc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809fbf:	29 c2                	sub    %eax,%edx
+  809fc1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  809fc4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  809fc7:	83 f8 7f             	cmp    $0x7f,%eax
+  809fca:	76 07                	jbe    809fd3 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  809fcc:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  809fd3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  809fd6:	48 63 d0             	movslq %eax,%rdx
+  809fd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809fdc:	48 63 c8             	movslq %eax,%rcx
+  809fdf:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  809fe6:	48 01 c1             	add    %rax,%rcx
+  809fe9:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  809ff0:	48 89 ce             	mov    %rcx,%rsi
+  809ff3:	48 89 c7             	mov    %rax,%rdi
+  809ff6:	49 89 df             	mov    %rbx,%r15
+  809ff9:	48 b8 d0 06 ff ff ff 	movabs $0xffffffffffff06d0,%rax
+  80a000:	ff ff ff 
+  80a003:	48 01 d8             	add    %rbx,%rax
+  80a006:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  80a008:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80a00b:	48 63 d0             	movslq %eax,%rdx
+  80a00e:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80a015:	48 89 d6             	mov    %rdx,%rsi
+  80a018:	48 89 c7             	mov    %rax,%rdi
+  80a01b:	49 89 df             	mov    %rbx,%r15
+  80a01e:	48 b8 f4 0d ff ff ff 	movabs $0xffffffffffff0df4,%rax
+  80a025:	ff ff ff 
+  80a028:	48 01 d8             	add    %rbx,%rax
+  80a02b:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80a02d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80a030:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80a033:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80a036:	48 98                	cltq
+  80a038:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  80a03f:	0f 82 6e ff ff ff    	jb     809fb3 <devcons_write+0x43>
+	}
+	return tot;
+  80a045:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80a048:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  80a04f:	5b                   	pop    %rbx
+  80a050:	41 5f                	pop    %r15
+  80a052:	5d                   	pop    %rbp
+  80a053:	c3                   	ret
+
+000000000080a054 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  80a054:	55                   	push   %rbp
+  80a055:	48 89 e5             	mov    %rsp,%rbp
+  80a058:	48 83 ec 08          	sub    $0x8,%rsp
+  80a05c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80a05c <devcons_close+0x8>
+  80a063:	49 bb 1c b0 00 00 00 	movabs $0xb01c,%r11
+  80a06a:	00 00 00 
+  80a06d:	4c 01 d8             	add    %r11,%rax
+  80a070:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  80a074:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80a079:	c9                   	leave
+  80a07a:	c3                   	ret
+
+000000000080a07b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80a07b:	55                   	push   %rbp
+  80a07c:	48 89 e5             	mov    %rsp,%rbp
+  80a07f:	41 57                	push   %r15
+  80a081:	48 83 ec 18          	sub    $0x18,%rsp
+  80a085:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80a085 <devcons_stat+0xa>
+  80a08c:	49 bb f3 af 00 00 00 	movabs $0xaff3,%r11
+  80a093:	00 00 00 
+  80a096:	4c 01 d8             	add    %r11,%rax
+  80a099:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80a09d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80a0a1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80a0a5:	48 b9 bd 5c ff ff ff 	movabs $0xffffffffffff5cbd,%rcx
+  80a0ac:	ff ff ff 
+  80a0af:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80a0b3:	48 89 ce             	mov    %rcx,%rsi
+  80a0b6:	48 89 d7             	mov    %rdx,%rdi
+  80a0b9:	49 89 c7             	mov    %rax,%r15
+  80a0bc:	48 ba f0 02 ff ff ff 	movabs $0xffffffffffff02f0,%rdx
+  80a0c3:	ff ff ff 
+  80a0c6:	48 01 c2             	add    %rax,%rdx
+  80a0c9:	ff d2                	call   *%rdx
+	return 0;
+  80a0cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80a0d0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80a0d4:	c9                   	leave
+  80a0d5:	c3                   	ret
@@ -0,0 +1,11909 @@
+
+obj/net/testinput:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 ae 0a 00 00       	call   800aef <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <announce>:
+static struct jif_pkt *pkt = (struct jif_pkt*)REQVA;
+
+
+    static void
+announce(void)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <announce+0xb>
+  800055:	49 bb fa 9f 00 00 00 	movabs $0x9ffa,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+    // with ARP requests.  Ideally, we would use gratuitous ARP
+    // for this, but QEMU's ARP implementation is dumb and only
+    // listens for very specific ARP requests, such as requests
+    // for the gateway IP.
+
+    uint8_t mac[6] = {0x52, 0x54, 0x00, 0x12, 0x34, 0x56};
+  800062:	c7 45 da 52 54 00 12 	movl   $0x12005452,-0x26(%rbp)
+  800069:	66 c7 45 de 34 56    	movw   $0x5634,-0x22(%rbp)
+    uint32_t myip = inet_addr(IP);
+  80006f:	48 b8 80 da ff ff ff 	movabs $0xffffffffffffda80,%rax
+  800076:	ff ff ff 
+  800079:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80007d:	48 89 c7             	mov    %rax,%rdi
+  800080:	49 89 df             	mov    %rbx,%r15
+  800083:	48 b8 44 d5 ff ff ff 	movabs $0xffffffffffffd544,%rax
+  80008a:	ff ff ff 
+  80008d:	48 01 d8             	add    %rbx,%rax
+  800090:	ff d0                	call   *%rax
+  800092:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+    uint32_t gwip = inet_addr(DEFAULT);
+  800095:	48 b8 8a da ff ff ff 	movabs $0xffffffffffffda8a,%rax
+  80009c:	ff ff ff 
+  80009f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000a3:	48 89 c7             	mov    %rax,%rdi
+  8000a6:	49 89 df             	mov    %rbx,%r15
+  8000a9:	48 b8 44 d5 ff ff ff 	movabs $0xffffffffffffd544,%rax
+  8000b0:	ff ff ff 
+  8000b3:	48 01 d8             	add    %rbx,%rax
+  8000b6:	ff d0                	call   *%rax
+  8000b8:	89 45 d0             	mov    %eax,-0x30(%rbp)
+    int r;
+
+    if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  8000bb:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  8000c2:	ff ff ff 
+  8000c5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8000c9:	ba 07 00 00 00       	mov    $0x7,%edx
+  8000ce:	48 89 c6             	mov    %rax,%rsi
+  8000d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000d6:	49 89 df             	mov    %rbx,%r15
+  8000d9:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  8000e0:	ff ff ff 
+  8000e3:	48 01 d8             	add    %rbx,%rax
+  8000e6:	ff d0                	call   *%rax
+  8000e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8000eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000ef:	79 44                	jns    800135 <announce+0xf2>
+        panic("sys_page_map: %e", r);
+  8000f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000f4:	89 c1                	mov    %eax,%ecx
+  8000f6:	48 b8 93 da ff ff ff 	movabs $0xffffffffffffda93,%rax
+  8000fd:	ff ff ff 
+  800100:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800104:	48 89 c2             	mov    %rax,%rdx
+  800107:	be 19 00 00 00       	mov    $0x19,%esi
+  80010c:	48 b8 a4 da ff ff ff 	movabs $0xffffffffffffdaa4,%rax
+  800113:	ff ff ff 
+  800116:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80011a:	48 89 c7             	mov    %rax,%rdi
+  80011d:	49 89 df             	mov    %rbx,%r15
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+  800125:	49 b8 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r8
+  80012c:	ff ff ff 
+  80012f:	49 01 d8             	add    %rbx,%r8
+  800132:	41 ff d0             	call   *%r8
+
+    struct etharp_hdr *arp = (struct etharp_hdr*)pkt->jp_data;
+  800135:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  80013c:	ff ff ff 
+  80013f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800143:	48 83 c0 04          	add    $0x4,%rax
+  800147:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    pkt->jp_len = sizeof(*arp);
+  80014b:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  800152:	ff ff ff 
+  800155:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800159:	c7 00 2a 00 00 00    	movl   $0x2a,(%rax)
+
+    memset(arp->ethhdr.dest.addr, 0xff, ETHARP_HWADDR_LEN);
+  80015f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800163:	ba 06 00 00 00       	mov    $0x6,%edx
+  800168:	be ff 00 00 00       	mov    $0xff,%esi
+  80016d:	48 89 c7             	mov    %rax,%rdi
+  800170:	49 89 df             	mov    %rbx,%r15
+  800173:	48 b8 8b 7f ff ff ff 	movabs $0xffffffffffff7f8b,%rax
+  80017a:	ff ff ff 
+  80017d:	48 01 d8             	add    %rbx,%rax
+  800180:	ff d0                	call   *%rax
+    memcpy(arp->ethhdr.src.addr,  mac,  ETHARP_HWADDR_LEN);
+  800182:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800186:	48 8d 48 06          	lea    0x6(%rax),%rcx
+  80018a:	48 8d 45 da          	lea    -0x26(%rbp),%rax
+  80018e:	ba 06 00 00 00       	mov    $0x6,%edx
+  800193:	48 89 c6             	mov    %rax,%rsi
+  800196:	48 89 cf             	mov    %rcx,%rdi
+  800199:	49 89 df             	mov    %rbx,%r15
+  80019c:	48 b8 55 81 ff ff ff 	movabs $0xffffffffffff8155,%rax
+  8001a3:	ff ff ff 
+  8001a6:	48 01 d8             	add    %rbx,%rax
+  8001a9:	ff d0                	call   *%rax
+    arp->ethhdr.type = htons(ETHTYPE_ARP);
+  8001ab:	bf 06 08 00 00       	mov    $0x806,%edi
+  8001b0:	49 89 df             	mov    %rbx,%r15
+  8001b3:	48 b8 8d d9 ff ff ff 	movabs $0xffffffffffffd98d,%rax
+  8001ba:	ff ff ff 
+  8001bd:	48 01 d8             	add    %rbx,%rax
+  8001c0:	ff d0                	call   *%rax
+  8001c2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001c6:	66 89 42 0c          	mov    %ax,0xc(%rdx)
+    arp->hwtype = htons(1); // Ethernet
+  8001ca:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001cf:	49 89 df             	mov    %rbx,%r15
+  8001d2:	48 b8 8d d9 ff ff ff 	movabs $0xffffffffffffd98d,%rax
+  8001d9:	ff ff ff 
+  8001dc:	48 01 d8             	add    %rbx,%rax
+  8001df:	ff d0                	call   *%rax
+  8001e1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001e5:	66 89 42 0e          	mov    %ax,0xe(%rdx)
+    arp->proto = htons(ETHTYPE_IP);
+  8001e9:	bf 00 08 00 00       	mov    $0x800,%edi
+  8001ee:	49 89 df             	mov    %rbx,%r15
+  8001f1:	48 b8 8d d9 ff ff ff 	movabs $0xffffffffffffd98d,%rax
+  8001f8:	ff ff ff 
+  8001fb:	48 01 d8             	add    %rbx,%rax
+  8001fe:	ff d0                	call   *%rax
+  800200:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800204:	66 89 42 10          	mov    %ax,0x10(%rdx)
+    arp->_hwlen_protolen = htons((ETHARP_HWADDR_LEN << 8) | 4);
+  800208:	bf 04 06 00 00       	mov    $0x604,%edi
+  80020d:	49 89 df             	mov    %rbx,%r15
+  800210:	48 b8 8d d9 ff ff ff 	movabs $0xffffffffffffd98d,%rax
+  800217:	ff ff ff 
+  80021a:	48 01 d8             	add    %rbx,%rax
+  80021d:	ff d0                	call   *%rax
+  80021f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800223:	66 89 42 12          	mov    %ax,0x12(%rdx)
+    arp->opcode = htons(ARP_REQUEST);
+  800227:	bf 01 00 00 00       	mov    $0x1,%edi
+  80022c:	49 89 df             	mov    %rbx,%r15
+  80022f:	48 b8 8d d9 ff ff ff 	movabs $0xffffffffffffd98d,%rax
+  800236:	ff ff ff 
+  800239:	48 01 d8             	add    %rbx,%rax
+  80023c:	ff d0                	call   *%rax
+  80023e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800242:	66 89 42 14          	mov    %ax,0x14(%rdx)
+    memcpy(arp->shwaddr.addr,  mac,   ETHARP_HWADDR_LEN);
+  800246:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80024a:	48 8d 48 16          	lea    0x16(%rax),%rcx
+  80024e:	48 8d 45 da          	lea    -0x26(%rbp),%rax
+  800252:	ba 06 00 00 00       	mov    $0x6,%edx
+  800257:	48 89 c6             	mov    %rax,%rsi
+  80025a:	48 89 cf             	mov    %rcx,%rdi
+  80025d:	49 89 df             	mov    %rbx,%r15
+  800260:	48 b8 55 81 ff ff ff 	movabs $0xffffffffffff8155,%rax
+  800267:	ff ff ff 
+  80026a:	48 01 d8             	add    %rbx,%rax
+  80026d:	ff d0                	call   *%rax
+    memcpy(arp->sipaddr.addrw, &myip, 4);
+  80026f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800273:	48 8d 48 1c          	lea    0x1c(%rax),%rcx
+  800277:	48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+  80027b:	ba 04 00 00 00       	mov    $0x4,%edx
+  800280:	48 89 c6             	mov    %rax,%rsi
+  800283:	48 89 cf             	mov    %rcx,%rdi
+  800286:	49 89 df             	mov    %rbx,%r15
+  800289:	48 b8 55 81 ff ff ff 	movabs $0xffffffffffff8155,%rax
+  800290:	ff ff ff 
+  800293:	48 01 d8             	add    %rbx,%rax
+  800296:	ff d0                	call   *%rax
+    memset(arp->dhwaddr.addr,  0x00,  ETHARP_HWADDR_LEN);
+  800298:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80029c:	48 83 c0 20          	add    $0x20,%rax
+  8002a0:	ba 06 00 00 00       	mov    $0x6,%edx
+  8002a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8002aa:	48 89 c7             	mov    %rax,%rdi
+  8002ad:	49 89 df             	mov    %rbx,%r15
+  8002b0:	48 b8 8b 7f ff ff ff 	movabs $0xffffffffffff7f8b,%rax
+  8002b7:	ff ff ff 
+  8002ba:	48 01 d8             	add    %rbx,%rax
+  8002bd:	ff d0                	call   *%rax
+    memcpy(arp->dipaddr.addrw, &gwip, 4);
+  8002bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002c3:	48 8d 48 26          	lea    0x26(%rax),%rcx
+  8002c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002cb:	ba 04 00 00 00       	mov    $0x4,%edx
+  8002d0:	48 89 c6             	mov    %rax,%rsi
+  8002d3:	48 89 cf             	mov    %rcx,%rdi
+  8002d6:	49 89 df             	mov    %rbx,%r15
+  8002d9:	48 b8 55 81 ff ff ff 	movabs $0xffffffffffff8155,%rax
+  8002e0:	ff ff ff 
+  8002e3:	48 01 d8             	add    %rbx,%rax
+  8002e6:	ff d0                	call   *%rax
+
+    ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  8002e8:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  8002ef:	ff ff ff 
+  8002f2:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  8002f6:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  8002fd:	00 00 00 
+  800300:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800303:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800308:	be 0b 00 00 00       	mov    $0xb,%esi
+  80030d:	89 c7                	mov    %eax,%edi
+  80030f:	49 89 df             	mov    %rbx,%r15
+  800312:	48 b8 24 9d ff ff ff 	movabs $0xffffffffffff9d24,%rax
+  800319:	ff ff ff 
+  80031c:	48 01 d8             	add    %rbx,%rax
+  80031f:	ff d0                	call   *%rax
+    sys_page_unmap(0, pkt);
+  800321:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  800328:	ff ff ff 
+  80032b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80032f:	48 89 c6             	mov    %rax,%rsi
+  800332:	bf 00 00 00 00       	mov    $0x0,%edi
+  800337:	49 89 df             	mov    %rbx,%r15
+  80033a:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  800341:	ff ff ff 
+  800344:	48 01 d8             	add    %rbx,%rax
+  800347:	ff d0                	call   *%rax
+}
+  800349:	90                   	nop
+  80034a:	48 83 c4 20          	add    $0x20,%rsp
+  80034e:	5b                   	pop    %rbx
+  80034f:	41 5f                	pop    %r15
+  800351:	5d                   	pop    %rbp
+  800352:	c3                   	ret
+
+0000000000800353 <hexdump>:
+
+    static void
+hexdump(const char *prefix, const void *data, int len)
+{
+  800353:	55                   	push   %rbp
+  800354:	48 89 e5             	mov    %rsp,%rbp
+  800357:	41 57                	push   %r15
+  800359:	53                   	push   %rbx
+  80035a:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  800361:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800361 <hexdump+0xe>
+  800368:	49 bb e7 9c 00 00 00 	movabs $0x9ce7,%r11
+  80036f:	00 00 00 
+  800372:	4c 01 db             	add    %r11,%rbx
+  800375:	48 89 bd 78 ff ff ff 	mov    %rdi,-0x88(%rbp)
+  80037c:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  800383:	89 95 6c ff ff ff    	mov    %edx,-0x94(%rbp)
+    int i;
+    char buf[80];
+    char *end = buf + sizeof(buf);
+  800389:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+  80038d:	48 83 c0 50          	add    $0x50,%rax
+  800391:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    char *out = NULL;
+  800395:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80039c:	00 
+    for (i = 0; i < len; i++) {
+  80039d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8003a4:	e9 71 01 00 00       	jmp    80051a <hexdump+0x1c7>
+        if (i % 16 == 0)
+  8003a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003ac:	83 e0 0f             	and    $0xf,%eax
+  8003af:	85 c0                	test   %eax,%eax
+  8003b1:	75 57                	jne    80040a <hexdump+0xb7>
+            out = buf + snprintf(buf, end - buf,
+  8003b3:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+  8003b7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8003bb:	48 29 c2             	sub    %rax,%rdx
+  8003be:	89 d6                	mov    %edx,%esi
+  8003c0:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8003c3:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8003ca:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+  8003ce:	41 89 c8             	mov    %ecx,%r8d
+  8003d1:	48 89 d1             	mov    %rdx,%rcx
+  8003d4:	48 ba b4 da ff ff ff 	movabs $0xffffffffffffdab4,%rdx
+  8003db:	ff ff ff 
+  8003de:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8003e2:	48 89 c7             	mov    %rax,%rdi
+  8003e5:	49 89 df             	mov    %rbx,%r15
+  8003e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ed:	49 b9 bd 7a ff ff ff 	movabs $0xffffffffffff7abd,%r9
+  8003f4:	ff ff ff 
+  8003f7:	49 01 d9             	add    %rbx,%r9
+  8003fa:	41 ff d1             	call   *%r9
+  8003fd:	48 98                	cltq
+  8003ff:	48 8d 55 80          	lea    -0x80(%rbp),%rdx
+  800403:	48 01 d0             	add    %rdx,%rax
+  800406:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+                    "%s%04x   ", prefix, i);
+        out += snprintf(out, end - out, "%02x", ((uint8_t*)data)[i]);
+  80040a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80040d:	48 63 d0             	movslq %eax,%rdx
+  800410:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  800417:	48 01 d0             	add    %rdx,%rax
+  80041a:	0f b6 00             	movzbl (%rax),%eax
+  80041d:	0f b6 d0             	movzbl %al,%edx
+  800420:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800424:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  800428:	89 c6                	mov    %eax,%esi
+  80042a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80042e:	89 d1                	mov    %edx,%ecx
+  800430:	48 ba be da ff ff ff 	movabs $0xffffffffffffdabe,%rdx
+  800437:	ff ff ff 
+  80043a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80043e:	48 89 c7             	mov    %rax,%rdi
+  800441:	49 89 df             	mov    %rbx,%r15
+  800444:	b8 00 00 00 00       	mov    $0x0,%eax
+  800449:	49 b8 bd 7a ff ff ff 	movabs $0xffffffffffff7abd,%r8
+  800450:	ff ff ff 
+  800453:	49 01 d8             	add    %rbx,%r8
+  800456:	41 ff d0             	call   *%r8
+  800459:	48 98                	cltq
+  80045b:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+        if (i % 16 == 15 || i == len - 1)
+  80045f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800462:	89 d0                	mov    %edx,%eax
+  800464:	c1 f8 1f             	sar    $0x1f,%eax
+  800467:	c1 e8 1c             	shr    $0x1c,%eax
+  80046a:	01 c2                	add    %eax,%edx
+  80046c:	83 e2 0f             	and    $0xf,%edx
+  80046f:	29 c2                	sub    %eax,%edx
+  800471:	89 d0                	mov    %edx,%eax
+  800473:	83 f8 0f             	cmp    $0xf,%eax
+  800476:	74 0e                	je     800486 <hexdump+0x133>
+  800478:	8b 85 6c ff ff ff    	mov    -0x94(%rbp),%eax
+  80047e:	83 e8 01             	sub    $0x1,%eax
+  800481:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800484:	75 40                	jne    8004c6 <hexdump+0x173>
+            cprintf("%.*s\n", out - buf, buf);
+  800486:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+  80048a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80048e:	48 89 d1             	mov    %rdx,%rcx
+  800491:	48 29 c1             	sub    %rax,%rcx
+  800494:	48 8d 45 80          	lea    -0x80(%rbp),%rax
+  800498:	48 89 c2             	mov    %rax,%rdx
+  80049b:	48 89 ce             	mov    %rcx,%rsi
+  80049e:	48 b8 c3 da ff ff ff 	movabs $0xffffffffffffdac3,%rax
+  8004a5:	ff ff ff 
+  8004a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004ac:	48 89 c7             	mov    %rax,%rdi
+  8004af:	49 89 df             	mov    %rbx,%r15
+  8004b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b7:	48 b9 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rcx
+  8004be:	ff ff ff 
+  8004c1:	48 01 d9             	add    %rbx,%rcx
+  8004c4:	ff d1                	call   *%rcx
+        if (i % 2 == 1)
+  8004c6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8004c9:	89 d0                	mov    %edx,%eax
+  8004cb:	c1 f8 1f             	sar    $0x1f,%eax
+  8004ce:	c1 e8 1f             	shr    $0x1f,%eax
+  8004d1:	01 c2                	add    %eax,%edx
+  8004d3:	83 e2 01             	and    $0x1,%edx
+  8004d6:	29 c2                	sub    %eax,%edx
+  8004d8:	89 d0                	mov    %edx,%eax
+  8004da:	83 f8 01             	cmp    $0x1,%eax
+  8004dd:	75 0f                	jne    8004ee <hexdump+0x19b>
+            *(out++) = ' ';
+  8004df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004e3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004e7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004eb:	c6 00 20             	movb   $0x20,(%rax)
+        if (i % 16 == 7)
+  8004ee:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8004f1:	89 d0                	mov    %edx,%eax
+  8004f3:	c1 f8 1f             	sar    $0x1f,%eax
+  8004f6:	c1 e8 1c             	shr    $0x1c,%eax
+  8004f9:	01 c2                	add    %eax,%edx
+  8004fb:	83 e2 0f             	and    $0xf,%edx
+  8004fe:	29 c2                	sub    %eax,%edx
+  800500:	89 d0                	mov    %edx,%eax
+  800502:	83 f8 07             	cmp    $0x7,%eax
+  800505:	75 0f                	jne    800516 <hexdump+0x1c3>
+            *(out++) = ' ';
+  800507:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80050b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80050f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800513:	c6 00 20             	movb   $0x20,(%rax)
+    for (i = 0; i < len; i++) {
+  800516:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80051a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80051d:	3b 85 6c ff ff ff    	cmp    -0x94(%rbp),%eax
+  800523:	0f 8c 80 fe ff ff    	jl     8003a9 <hexdump+0x56>
+    }
+}
+  800529:	90                   	nop
+  80052a:	90                   	nop
+  80052b:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+  800532:	5b                   	pop    %rbx
+  800533:	41 5f                	pop    %r15
+  800535:	5d                   	pop    %rbp
+  800536:	c3                   	ret
+
+0000000000800537 <umain>:
+
+    void
+umain(int argc, char **argv)
+{
+  800537:	55                   	push   %rbp
+  800538:	48 89 e5             	mov    %rsp,%rbp
+  80053b:	41 57                	push   %r15
+  80053d:	53                   	push   %rbx
+  80053e:	48 83 ec 30          	sub    $0x30,%rsp
+  800542:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800542 <umain+0xb>
+  800549:	49 bb 06 9b 00 00 00 	movabs $0x9b06,%r11
+  800550:	00 00 00 
+  800553:	4c 01 db             	add    %r11,%rbx
+  800556:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800559:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    envid_t ns_envid = sys_getenvid();
+  80055d:	49 89 df             	mov    %rbx,%r15
+  800560:	48 b8 5d 88 ff ff ff 	movabs $0xffffffffffff885d,%rax
+  800567:	ff ff ff 
+  80056a:	48 01 d8             	add    %rbx,%rax
+  80056d:	ff d0                	call   *%rax
+  80056f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    int i, r, first = 1;
+  800572:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+
+    binaryname = "testinput";
+  800579:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800580:	ff ff ff 
+  800583:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800587:	48 ba c9 da ff ff ff 	movabs $0xffffffffffffdac9,%rdx
+  80058e:	ff ff ff 
+  800591:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800595:	48 89 10             	mov    %rdx,(%rax)
+
+    output_envid = fork();
+  800598:	49 89 df             	mov    %rbx,%r15
+  80059b:	48 b8 95 98 ff ff ff 	movabs $0xffffffffffff9895,%rax
+  8005a2:	ff ff ff 
+  8005a5:	48 01 d8             	add    %rbx,%rax
+  8005a8:	ff d0                	call   *%rax
+  8005aa:	48 ba b8 0f 00 00 00 	movabs $0xfb8,%rdx
+  8005b1:	00 00 00 
+  8005b4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+    if (output_envid < 0)
+  8005b7:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  8005be:	00 00 00 
+  8005c1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8005c4:	85 c0                	test   %eax,%eax
+  8005c6:	79 3e                	jns    800606 <umain+0xcf>
+        panic("error forking");
+  8005c8:	48 b8 d3 da ff ff ff 	movabs $0xffffffffffffdad3,%rax
+  8005cf:	ff ff ff 
+  8005d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005d6:	48 89 c2             	mov    %rax,%rdx
+  8005d9:	be 4d 00 00 00       	mov    $0x4d,%esi
+  8005de:	48 b8 a4 da ff ff ff 	movabs $0xffffffffffffdaa4,%rax
+  8005e5:	ff ff ff 
+  8005e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005ec:	48 89 c7             	mov    %rax,%rdi
+  8005ef:	49 89 df             	mov    %rbx,%r15
+  8005f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f7:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  8005fe:	ff ff ff 
+  800601:	48 01 d9             	add    %rbx,%rcx
+  800604:	ff d1                	call   *%rcx
+    else if (output_envid == 0) {
+  800606:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  80060d:	00 00 00 
+  800610:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800613:	85 c0                	test   %eax,%eax
+  800615:	75 1c                	jne    800633 <umain+0xfc>
+        output(ns_envid);
+  800617:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80061a:	89 c7                	mov    %eax,%edi
+  80061c:	49 89 df             	mov    %rbx,%r15
+  80061f:	48 b8 66 6a ff ff ff 	movabs $0xffffffffffff6a66,%rax
+  800626:	ff ff ff 
+  800629:	48 01 d8             	add    %rbx,%rax
+  80062c:	ff d0                	call   *%rax
+        return;
+  80062e:	e9 9a 02 00 00       	jmp    8008cd <umain+0x396>
+    }
+
+    input_envid = fork();
+  800633:	49 89 df             	mov    %rbx,%r15
+  800636:	48 b8 95 98 ff ff ff 	movabs $0xffffffffffff9895,%rax
+  80063d:	ff ff ff 
+  800640:	48 01 d8             	add    %rbx,%rax
+  800643:	ff d0                	call   *%rax
+  800645:	48 ba bc 0f 00 00 00 	movabs $0xfbc,%rdx
+  80064c:	00 00 00 
+  80064f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+    if (input_envid < 0)
+  800652:	48 b8 bc 0f 00 00 00 	movabs $0xfbc,%rax
+  800659:	00 00 00 
+  80065c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80065f:	85 c0                	test   %eax,%eax
+  800661:	79 3e                	jns    8006a1 <umain+0x16a>
+        panic("error forking");
+  800663:	48 b8 d3 da ff ff ff 	movabs $0xffffffffffffdad3,%rax
+  80066a:	ff ff ff 
+  80066d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800671:	48 89 c2             	mov    %rax,%rdx
+  800674:	be 55 00 00 00       	mov    $0x55,%esi
+  800679:	48 b8 a4 da ff ff ff 	movabs $0xffffffffffffdaa4,%rax
+  800680:	ff ff ff 
+  800683:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800687:	48 89 c7             	mov    %rax,%rdi
+  80068a:	49 89 df             	mov    %rbx,%r15
+  80068d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800692:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  800699:	ff ff ff 
+  80069c:	48 01 d9             	add    %rbx,%rcx
+  80069f:	ff d1                	call   *%rcx
+    else if (input_envid == 0) {
+  8006a1:	48 b8 bc 0f 00 00 00 	movabs $0xfbc,%rax
+  8006a8:	00 00 00 
+  8006ab:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8006ae:	85 c0                	test   %eax,%eax
+  8006b0:	75 1c                	jne    8006ce <umain+0x197>
+        input(ns_envid);
+  8006b2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8006b5:	89 c7                	mov    %eax,%edi
+  8006b7:	49 89 df             	mov    %rbx,%r15
+  8006ba:	48 b8 25 6a ff ff ff 	movabs $0xffffffffffff6a25,%rax
+  8006c1:	ff ff ff 
+  8006c4:	48 01 d8             	add    %rbx,%rax
+  8006c7:	ff d0                	call   *%rax
+        return;
+  8006c9:	e9 ff 01 00 00       	jmp    8008cd <umain+0x396>
+    }
+
+    cprintf("Sending ARP announcement...\n");
+  8006ce:	48 b8 e1 da ff ff ff 	movabs $0xffffffffffffdae1,%rax
+  8006d5:	ff ff ff 
+  8006d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006dc:	48 89 c7             	mov    %rax,%rdi
+  8006df:	49 89 df             	mov    %rbx,%r15
+  8006e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e7:	48 ba 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rdx
+  8006ee:	ff ff ff 
+  8006f1:	48 01 da             	add    %rbx,%rdx
+  8006f4:	ff d2                	call   *%rdx
+    announce();
+  8006f6:	48 b8 fb 5f ff ff ff 	movabs $0xffffffffffff5ffb,%rax
+  8006fd:	ff ff ff 
+  800700:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800704:	ff d0                	call   *%rax
+
+    while (1) {
+        envid_t whom;
+        int perm;
+
+        int32_t req = ipc_recv((int32_t *)&whom, pkt, &perm);
+  800706:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  80070d:	ff ff ff 
+  800710:	48 8b 0c 03          	mov    (%rbx,%rax,1),%rcx
+  800714:	48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+  800718:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80071c:	48 89 ce             	mov    %rcx,%rsi
+  80071f:	48 89 c7             	mov    %rax,%rdi
+  800722:	49 89 df             	mov    %rbx,%r15
+  800725:	48 b8 3b 9c ff ff ff 	movabs $0xffffffffffff9c3b,%rax
+  80072c:	ff ff ff 
+  80072f:	48 01 d8             	add    %rbx,%rax
+  800732:	ff d0                	call   *%rax
+  800734:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+        if (req < 0)
+  800737:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80073b:	79 44                	jns    800781 <umain+0x24a>
+            panic("ipc_recv: %e", req);
+  80073d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800740:	89 c1                	mov    %eax,%ecx
+  800742:	48 b8 fe da ff ff ff 	movabs $0xffffffffffffdafe,%rax
+  800749:	ff ff ff 
+  80074c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800750:	48 89 c2             	mov    %rax,%rdx
+  800753:	be 64 00 00 00       	mov    $0x64,%esi
+  800758:	48 b8 a4 da ff ff ff 	movabs $0xffffffffffffdaa4,%rax
+  80075f:	ff ff ff 
+  800762:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800766:	48 89 c7             	mov    %rax,%rdi
+  800769:	49 89 df             	mov    %rbx,%r15
+  80076c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800771:	49 b8 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r8
+  800778:	ff ff ff 
+  80077b:	49 01 d8             	add    %rbx,%r8
+  80077e:	41 ff d0             	call   *%r8
+        if (whom != input_envid)
+  800781:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800784:	48 b8 bc 0f 00 00 00 	movabs $0xfbc,%rax
+  80078b:	00 00 00 
+  80078e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800791:	39 c2                	cmp    %eax,%edx
+  800793:	74 44                	je     8007d9 <umain+0x2a2>
+            panic("IPC from unexpected environment %08x", whom);
+  800795:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800798:	89 c1                	mov    %eax,%ecx
+  80079a:	48 b8 10 db ff ff ff 	movabs $0xffffffffffffdb10,%rax
+  8007a1:	ff ff ff 
+  8007a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007a8:	48 89 c2             	mov    %rax,%rdx
+  8007ab:	be 66 00 00 00       	mov    $0x66,%esi
+  8007b0:	48 b8 a4 da ff ff ff 	movabs $0xffffffffffffdaa4,%rax
+  8007b7:	ff ff ff 
+  8007ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007be:	48 89 c7             	mov    %rax,%rdi
+  8007c1:	49 89 df             	mov    %rbx,%r15
+  8007c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c9:	49 b8 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r8
+  8007d0:	ff ff ff 
+  8007d3:	49 01 d8             	add    %rbx,%r8
+  8007d6:	41 ff d0             	call   *%r8
+        if (req != NSREQ_INPUT)
+  8007d9:	83 7d e4 0a          	cmpl   $0xa,-0x1c(%rbp)
+  8007dd:	74 44                	je     800823 <umain+0x2ec>
+            panic("Unexpected IPC %d", req);
+  8007df:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8007e2:	89 c1                	mov    %eax,%ecx
+  8007e4:	48 b8 35 db ff ff ff 	movabs $0xffffffffffffdb35,%rax
+  8007eb:	ff ff ff 
+  8007ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007f2:	48 89 c2             	mov    %rax,%rdx
+  8007f5:	be 68 00 00 00       	mov    $0x68,%esi
+  8007fa:	48 b8 a4 da ff ff ff 	movabs $0xffffffffffffdaa4,%rax
+  800801:	ff ff ff 
+  800804:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800808:	48 89 c7             	mov    %rax,%rdi
+  80080b:	49 89 df             	mov    %rbx,%r15
+  80080e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800813:	49 b8 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r8
+  80081a:	ff ff ff 
+  80081d:	49 01 d8             	add    %rbx,%r8
+  800820:	41 ff d0             	call   *%r8
+
+        hexdump("input: ", pkt->jp_data, pkt->jp_len);
+  800823:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  80082a:	ff ff ff 
+  80082d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800831:	8b 00                	mov    (%rax),%eax
+  800833:	48 ba b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rdx
+  80083a:	ff ff ff 
+  80083d:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800841:	48 8d 4a 04          	lea    0x4(%rdx),%rcx
+  800845:	89 c2                	mov    %eax,%edx
+  800847:	48 89 ce             	mov    %rcx,%rsi
+  80084a:	48 b8 47 db ff ff ff 	movabs $0xffffffffffffdb47,%rax
+  800851:	ff ff ff 
+  800854:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800858:	48 89 c7             	mov    %rax,%rdi
+  80085b:	48 b8 0b 63 ff ff ff 	movabs $0xffffffffffff630b,%rax
+  800862:	ff ff ff 
+  800865:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800869:	ff d0                	call   *%rax
+        cprintf("\n");
+  80086b:	48 b8 4f db ff ff ff 	movabs $0xffffffffffffdb4f,%rax
+  800872:	ff ff ff 
+  800875:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800879:	48 89 c7             	mov    %rax,%rdi
+  80087c:	49 89 df             	mov    %rbx,%r15
+  80087f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800884:	48 ba 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rdx
+  80088b:	ff ff ff 
+  80088e:	48 01 da             	add    %rbx,%rdx
+  800891:	ff d2                	call   *%rdx
+
+        // Only indicate that we're waiting for packets once
+        // we've received the ARP reply
+        if (first)
+  800893:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800897:	74 28                	je     8008c1 <umain+0x38a>
+            cprintf("Waiting for packets...\n");
+  800899:	48 b8 51 db ff ff ff 	movabs $0xffffffffffffdb51,%rax
+  8008a0:	ff ff ff 
+  8008a3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008a7:	48 89 c7             	mov    %rax,%rdi
+  8008aa:	49 89 df             	mov    %rbx,%r15
+  8008ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b2:	48 ba 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rdx
+  8008b9:	ff ff ff 
+  8008bc:	48 01 da             	add    %rbx,%rdx
+  8008bf:	ff d2                	call   *%rdx
+        first = 0;
+  8008c1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+    while (1) {
+  8008c8:	e9 39 fe ff ff       	jmp    800706 <umain+0x1cf>
+    }
+}
+  8008cd:	48 83 c4 30          	add    $0x30,%rsp
+  8008d1:	5b                   	pop    %rbx
+  8008d2:	41 5f                	pop    %r15
+  8008d4:	5d                   	pop    %rbp
+  8008d5:	c3                   	ret
+
+00000000008008d6 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  8008d6:	55                   	push   %rbp
+  8008d7:	48 89 e5             	mov    %rsp,%rbp
+  8008da:	41 57                	push   %r15
+  8008dc:	53                   	push   %rbx
+  8008dd:	48 83 ec 20          	sub    $0x20,%rsp
+  8008e1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8008e1 <timer+0xb>
+  8008e8:	49 bb 67 97 00 00 00 	movabs $0x9767,%r11
+  8008ef:	00 00 00 
+  8008f2:	4c 01 db             	add    %r11,%rbx
+  8008f5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8008f8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    int r;
+    uint32_t stop = sys_time_msec() + initial_to;
+  8008fb:	49 89 df             	mov    %rbx,%r15
+  8008fe:	48 b8 2d 8e ff ff ff 	movabs $0xffffffffffff8e2d,%rax
+  800905:	ff ff ff 
+  800908:	48 01 d8             	add    %rbx,%rax
+  80090b:	ff d0                	call   *%rax
+  80090d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800910:	01 d0                	add    %edx,%eax
+  800912:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+    binaryname = "ns_timer";
+  800915:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80091c:	ff ff ff 
+  80091f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800923:	48 ba 70 db ff ff ff 	movabs $0xffffffffffffdb70,%rdx
+  80092a:	ff ff ff 
+  80092d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800931:	48 89 10             	mov    %rdx,(%rax)
+
+    while (1) {
+        while((r = sys_time_msec()) < stop && r >= 0) {
+  800934:	eb 26                	jmp    80095c <timer+0x86>
+            sys_sleep_usec((uint64_t) (stop - r) * 1000);
+  800936:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800939:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80093c:	29 c2                	sub    %eax,%edx
+  80093e:	89 d0                	mov    %edx,%eax
+  800940:	48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+  800947:	48 89 c7             	mov    %rax,%rdi
+  80094a:	49 89 df             	mov    %rbx,%r15
+  80094d:	48 b8 81 8e ff ff ff 	movabs $0xffffffffffff8e81,%rax
+  800954:	ff ff ff 
+  800957:	48 01 d8             	add    %rbx,%rax
+  80095a:	ff d0                	call   *%rax
+        while((r = sys_time_msec()) < stop && r >= 0) {
+  80095c:	49 89 df             	mov    %rbx,%r15
+  80095f:	48 b8 2d 8e ff ff ff 	movabs $0xffffffffffff8e2d,%rax
+  800966:	ff ff ff 
+  800969:	48 01 d8             	add    %rbx,%rax
+  80096c:	ff d0                	call   *%rax
+  80096e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800971:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800974:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  800977:	73 06                	jae    80097f <timer+0xa9>
+  800979:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80097d:	79 b7                	jns    800936 <timer+0x60>
+        }
+        if (r < 0)
+  80097f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800983:	79 44                	jns    8009c9 <timer+0xf3>
+            panic("sys_time_msec: %e", r);
+  800985:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800988:	89 c1                	mov    %eax,%ecx
+  80098a:	48 b8 79 db ff ff ff 	movabs $0xffffffffffffdb79,%rax
+  800991:	ff ff ff 
+  800994:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800998:	48 89 c2             	mov    %rax,%rdx
+  80099b:	be 0f 00 00 00       	mov    $0xf,%esi
+  8009a0:	48 b8 8b db ff ff ff 	movabs $0xffffffffffffdb8b,%rax
+  8009a7:	ff ff ff 
+  8009aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009ae:	48 89 c7             	mov    %rax,%rdi
+  8009b1:	49 89 df             	mov    %rbx,%r15
+  8009b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b9:	49 b8 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r8
+  8009c0:	ff ff ff 
+  8009c3:	49 01 d8             	add    %rbx,%r8
+  8009c6:	41 ff d0             	call   *%r8
+
+        ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  8009c9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8009cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009d6:	be 0c 00 00 00       	mov    $0xc,%esi
+  8009db:	89 c7                	mov    %eax,%edi
+  8009dd:	49 89 df             	mov    %rbx,%r15
+  8009e0:	48 b8 24 9d ff ff ff 	movabs $0xffffffffffff9d24,%rax
+  8009e7:	ff ff ff 
+  8009ea:	48 01 d8             	add    %rbx,%rax
+  8009ed:	ff d0                	call   *%rax
+
+        while (1) {
+            uint32_t to, whom;
+            to = ipc_recv((int32_t *) &whom, 0, 0);
+  8009ef:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8009f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8009fd:	48 89 c7             	mov    %rax,%rdi
+  800a00:	49 89 df             	mov    %rbx,%r15
+  800a03:	48 b8 3b 9c ff ff ff 	movabs $0xffffffffffff9c3b,%rax
+  800a0a:	ff ff ff 
+  800a0d:	48 01 d8             	add    %rbx,%rax
+  800a10:	ff d0                	call   *%rax
+  800a12:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+
+            if (whom != ns_envid) {
+  800a15:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800a1b:	39 c2                	cmp    %eax,%edx
+  800a1d:	74 2f                	je     800a4e <timer+0x178>
+                cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  800a1f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800a22:	89 c6                	mov    %eax,%esi
+  800a24:	48 b8 98 db ff ff ff 	movabs $0xffffffffffffdb98,%rax
+  800a2b:	ff ff ff 
+  800a2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a32:	48 89 c7             	mov    %rax,%rdi
+  800a35:	49 89 df             	mov    %rbx,%r15
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3d:	48 ba 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rdx
+  800a44:	ff ff ff 
+  800a47:	48 01 da             	add    %rbx,%rdx
+  800a4a:	ff d2                	call   *%rdx
+        while (1) {
+  800a4c:	eb a1                	jmp    8009ef <timer+0x119>
+                continue;
+            }
+
+            stop = sys_time_msec() + to;
+  800a4e:	49 89 df             	mov    %rbx,%r15
+  800a51:	48 b8 2d 8e ff ff ff 	movabs $0xffffffffffff8e2d,%rax
+  800a58:	ff ff ff 
+  800a5b:	48 01 d8             	add    %rbx,%rax
+  800a5e:	ff d0                	call   *%rax
+  800a60:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800a63:	01 d0                	add    %edx,%eax
+  800a65:	89 45 ec             	mov    %eax,-0x14(%rbp)
+        while((r = sys_time_msec()) < stop && r >= 0) {
+  800a68:	e9 ef fe ff ff       	jmp    80095c <timer+0x86>
+
+0000000000800a6d <input>:
+
+extern union Nsipc nsipcbuf;
+
+    void
+input(envid_t ns_envid)
+{
+  800a6d:	55                   	push   %rbp
+  800a6e:	48 89 e5             	mov    %rsp,%rbp
+  800a71:	48 83 ec 08          	sub    $0x8,%rsp
+  800a75:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a75 <input+0x8>
+  800a7c:	49 bb d3 95 00 00 00 	movabs $0x95d3,%r11
+  800a83:	00 00 00 
+  800a86:	4c 01 d8             	add    %r11,%rax
+  800a89:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    binaryname = "ns_input";
+  800a8c:	48 ba c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rdx
+  800a93:	ff ff ff 
+  800a96:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800a9a:	48 b9 d3 db ff ff ff 	movabs $0xffffffffffffdbd3,%rcx
+  800aa1:	ff ff ff 
+  800aa4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  800aa8:	48 89 02             	mov    %rax,(%rdx)
+    // 	- read a packet from the device driver
+    //	- send it to the network server
+    // Hint: When you IPC a page to the network server, it will be
+    // reading from it for a while, so don't immediately receive
+    // another packet in to the same physical page.
+}
+  800aab:	90                   	nop
+  800aac:	c9                   	leave
+  800aad:	c3                   	ret
+
+0000000000800aae <output>:
+
+extern union Nsipc nsipcbuf;
+
+    void
+output(envid_t ns_envid)
+{
+  800aae:	55                   	push   %rbp
+  800aaf:	48 89 e5             	mov    %rsp,%rbp
+  800ab2:	48 83 ec 08          	sub    $0x8,%rsp
+  800ab6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ab6 <output+0x8>
+  800abd:	49 bb 92 95 00 00 00 	movabs $0x9592,%r11
+  800ac4:	00 00 00 
+  800ac7:	4c 01 d8             	add    %r11,%rax
+  800aca:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    binaryname = "ns_output";
+  800acd:	48 ba c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rdx
+  800ad4:	ff ff ff 
+  800ad7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800adb:	48 b9 dc db ff ff ff 	movabs $0xffffffffffffdbdc,%rcx
+  800ae2:	ff ff ff 
+  800ae5:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  800ae9:	48 89 02             	mov    %rax,(%rdx)
+
+    // LAB 6: Your code here:
+    // 	- read a packet from the network server
+    //	- send the packet to the device driver
+}
+  800aec:	90                   	nop
+  800aed:	c9                   	leave
+  800aee:	c3                   	ret
+
+0000000000800aef <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800aef:	55                   	push   %rbp
+  800af0:	48 89 e5             	mov    %rsp,%rbp
+  800af3:	41 57                	push   %r15
+  800af5:	53                   	push   %rbx
+  800af6:	48 83 ec 20          	sub    $0x20,%rsp
+  800afa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800afa <libmain+0xb>
+  800b01:	49 bb 4e 95 00 00 00 	movabs $0x954e,%r11
+  800b08:	00 00 00 
+  800b0b:	4c 01 db             	add    %r11,%rbx
+  800b0e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800b11:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800b15:	49 89 df             	mov    %rbx,%r15
+  800b18:	48 b8 5d 88 ff ff ff 	movabs $0xffffffffffff885d,%rax
+  800b1f:	ff ff ff 
+  800b22:	48 01 d8             	add    %rbx,%rax
+  800b25:	ff d0                	call   *%rax
+  800b27:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800b2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800b2d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800b32:	48 98                	cltq
+  800b34:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800b3b:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800b42:	ff ff ff 
+  800b45:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800b49:	48 01 c2             	add    %rax,%rdx
+  800b4c:	48 b8 d8 2f 01 00 00 	movabs $0x12fd8,%rax
+  800b53:	00 00 00 
+  800b56:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800b5a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b5e:	7e 15                	jle    800b75 <libmain+0x86>
+		binaryname = argv[0];
+  800b60:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b64:	48 8b 00             	mov    (%rax),%rax
+  800b67:	48 ba 18 00 00 00 00 	movabs $0x18,%rdx
+  800b6e:	00 00 00 
+  800b71:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800b75:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800b79:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800b7c:	48 89 d6             	mov    %rdx,%rsi
+  800b7f:	89 c7                	mov    %eax,%edi
+  800b81:	49 89 df             	mov    %rbx,%r15
+  800b84:	48 b8 ef 64 ff ff ff 	movabs $0xffffffffffff64ef,%rax
+  800b8b:	ff ff ff 
+  800b8e:	48 01 d8             	add    %rbx,%rax
+  800b91:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800b93:	49 89 df             	mov    %rbx,%r15
+  800b96:	48 b8 67 6b ff ff ff 	movabs $0xffffffffffff6b67,%rax
+  800b9d:	ff ff ff 
+  800ba0:	48 01 d8             	add    %rbx,%rax
+  800ba3:	ff d0                	call   *%rax
+}
+  800ba5:	90                   	nop
+  800ba6:	48 83 c4 20          	add    $0x20,%rsp
+  800baa:	5b                   	pop    %rbx
+  800bab:	41 5f                	pop    %r15
+  800bad:	5d                   	pop    %rbp
+  800bae:	c3                   	ret
+
+0000000000800baf <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800baf:	55                   	push   %rbp
+  800bb0:	48 89 e5             	mov    %rsp,%rbp
+  800bb3:	41 57                	push   %r15
+  800bb5:	53                   	push   %rbx
+  800bb6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800bb6 <exit+0x7>
+  800bbd:	49 bb 92 94 00 00 00 	movabs $0x9492,%r11
+  800bc4:	00 00 00 
+  800bc7:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800bca:	49 89 df             	mov    %rbx,%r15
+  800bcd:	48 b8 32 a8 ff ff ff 	movabs $0xffffffffffffa832,%rax
+  800bd4:	ff ff ff 
+  800bd7:	48 01 d8             	add    %rbx,%rax
+  800bda:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800bdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800be1:	49 89 df             	mov    %rbx,%r15
+  800be4:	48 b8 01 88 ff ff ff 	movabs $0xffffffffffff8801,%rax
+  800beb:	ff ff ff 
+  800bee:	48 01 d8             	add    %rbx,%rax
+  800bf1:	ff d0                	call   *%rax
+}
+  800bf3:	90                   	nop
+  800bf4:	5b                   	pop    %rbx
+  800bf5:	41 5f                	pop    %r15
+  800bf7:	5d                   	pop    %rbp
+  800bf8:	c3                   	ret
+
+0000000000800bf9 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800bf9:	55                   	push   %rbp
+  800bfa:	48 89 e5             	mov    %rsp,%rbp
+  800bfd:	41 57                	push   %r15
+  800bff:	41 54                	push   %r12
+  800c01:	53                   	push   %rbx
+  800c02:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800c09:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800c09 <_panic+0x10>
+  800c10:	49 bb 3f 94 00 00 00 	movabs $0x943f,%r11
+  800c17:	00 00 00 
+  800c1a:	4c 01 db             	add    %r11,%rbx
+  800c1d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800c24:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800c2a:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800c31:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800c38:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800c3f:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800c46:	84 c0                	test   %al,%al
+  800c48:	74 26                	je     800c70 <_panic+0x77>
+  800c4a:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800c51:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800c58:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800c5c:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800c60:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800c64:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800c68:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800c6c:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800c70:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800c77:	00 00 00 
+  800c7a:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800c81:	00 00 00 
+  800c84:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c88:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800c8f:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800c96:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800c9d:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800ca4:	ff ff ff 
+  800ca7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800cab:	4c 8b 20             	mov    (%rax),%r12
+  800cae:	49 89 df             	mov    %rbx,%r15
+  800cb1:	48 b8 5d 88 ff ff ff 	movabs $0xffffffffffff885d,%rax
+  800cb8:	ff ff ff 
+  800cbb:	48 01 d8             	add    %rbx,%rax
+  800cbe:	ff d0                	call   *%rax
+  800cc0:	89 c6                	mov    %eax,%esi
+  800cc2:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800cc8:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800ccf:	41 89 d0             	mov    %edx,%r8d
+  800cd2:	48 89 c1             	mov    %rax,%rcx
+  800cd5:	4c 89 e2             	mov    %r12,%rdx
+  800cd8:	48 b8 f0 db ff ff ff 	movabs $0xffffffffffffdbf0,%rax
+  800cdf:	ff ff ff 
+  800ce2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ce6:	48 89 c7             	mov    %rax,%rdi
+  800ce9:	49 89 df             	mov    %rbx,%r15
+  800cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf1:	49 b9 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%r9
+  800cf8:	ff ff ff 
+  800cfb:	49 01 d9             	add    %rbx,%r9
+  800cfe:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800d01:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800d08:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800d0f:	48 89 d6             	mov    %rdx,%rsi
+  800d12:	48 89 c7             	mov    %rax,%rdi
+  800d15:	49 89 df             	mov    %rbx,%r15
+  800d18:	48 b8 a8 6d ff ff ff 	movabs $0xffffffffffff6da8,%rax
+  800d1f:	ff ff ff 
+  800d22:	48 01 d8             	add    %rbx,%rax
+  800d25:	ff d0                	call   *%rax
+	cprintf("\n");
+  800d27:	48 b8 13 dc ff ff ff 	movabs $0xffffffffffffdc13,%rax
+  800d2e:	ff ff ff 
+  800d31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d35:	48 89 c7             	mov    %rax,%rdi
+  800d38:	49 89 df             	mov    %rbx,%r15
+  800d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d40:	48 ba 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rdx
+  800d47:	ff ff ff 
+  800d4a:	48 01 da             	add    %rbx,%rdx
+  800d4d:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800d4f:	cc                   	int3
+  800d50:	eb fd                	jmp    800d4f <_panic+0x156>
+
+0000000000800d52 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800d52:	55                   	push   %rbp
+  800d53:	48 89 e5             	mov    %rsp,%rbp
+  800d56:	41 57                	push   %r15
+  800d58:	48 83 ec 18          	sub    $0x18,%rsp
+  800d5c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800d5c <putch+0xa>
+  800d63:	49 bb ec 92 00 00 00 	movabs $0x92ec,%r11
+  800d6a:	00 00 00 
+  800d6d:	4c 01 d8             	add    %r11,%rax
+  800d70:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800d73:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800d77:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800d7b:	8b 12                	mov    (%rdx),%edx
+  800d7d:	8d 72 01             	lea    0x1(%rdx),%esi
+  800d80:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800d84:	89 31                	mov    %esi,(%rcx)
+  800d86:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800d89:	89 ce                	mov    %ecx,%esi
+  800d8b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800d8f:	48 63 d2             	movslq %edx,%rdx
+  800d92:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800d97:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800d9b:	8b 12                	mov    (%rdx),%edx
+  800d9d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800da3:	75 33                	jne    800dd8 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800da5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800da9:	8b 12                	mov    (%rdx),%edx
+  800dab:	48 63 d2             	movslq %edx,%rdx
+  800dae:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800db2:	48 83 c1 08          	add    $0x8,%rcx
+  800db6:	48 89 d6             	mov    %rdx,%rsi
+  800db9:	48 89 cf             	mov    %rcx,%rdi
+  800dbc:	49 89 c7             	mov    %rax,%r15
+  800dbf:	48 ba 4e 87 ff ff ff 	movabs $0xffffffffffff874e,%rdx
+  800dc6:	ff ff ff 
+  800dc9:	48 01 c2             	add    %rax,%rdx
+  800dcc:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800dce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800dd2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800dd8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ddc:	8b 40 04             	mov    0x4(%rax),%eax
+  800ddf:	8d 50 01             	lea    0x1(%rax),%edx
+  800de2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800de6:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800de9:	90                   	nop
+  800dea:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800dee:	c9                   	leave
+  800def:	c3                   	ret
+
+0000000000800df0 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800df0:	55                   	push   %rbp
+  800df1:	48 89 e5             	mov    %rsp,%rbp
+  800df4:	41 57                	push   %r15
+  800df6:	53                   	push   %rbx
+  800df7:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800dfe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800dfe <vcprintf+0xe>
+  800e05:	49 bb 4a 92 00 00 00 	movabs $0x924a,%r11
+  800e0c:	00 00 00 
+  800e0f:	4c 01 db             	add    %r11,%rbx
+  800e12:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800e19:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800e20:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800e27:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800e2e:	48 8b 06             	mov    (%rsi),%rax
+  800e31:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800e35:	48 89 01             	mov    %rax,(%rcx)
+  800e38:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800e3c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800e40:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800e44:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800e4b:	00 00 00 
+    b.cnt = 0;
+  800e4e:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800e55:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800e58:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800e5f:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800e66:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800e6d:	48 89 c6             	mov    %rax,%rsi
+  800e70:	48 b8 0a 6d ff ff ff 	movabs $0xffffffffffff6d0a,%rax
+  800e77:	ff ff ff 
+  800e7a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e7e:	48 89 c7             	mov    %rax,%rdi
+  800e81:	49 89 df             	mov    %rbx,%r15
+  800e84:	48 b8 cc 72 ff ff ff 	movabs $0xffffffffffff72cc,%rax
+  800e8b:	ff ff ff 
+  800e8e:	48 01 d8             	add    %rbx,%rax
+  800e91:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800e93:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800e99:	48 98                	cltq
+  800e9b:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800ea2:	48 83 c2 08          	add    $0x8,%rdx
+  800ea6:	48 89 c6             	mov    %rax,%rsi
+  800ea9:	48 89 d7             	mov    %rdx,%rdi
+  800eac:	49 89 df             	mov    %rbx,%r15
+  800eaf:	48 b8 4e 87 ff ff ff 	movabs $0xffffffffffff874e,%rax
+  800eb6:	ff ff ff 
+  800eb9:	48 01 d8             	add    %rbx,%rax
+  800ebc:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800ebe:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800ec4:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800ecb:	5b                   	pop    %rbx
+  800ecc:	41 5f                	pop    %r15
+  800ece:	5d                   	pop    %rbp
+  800ecf:	c3                   	ret
+
+0000000000800ed0 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800ed0:	55                   	push   %rbp
+  800ed1:	48 89 e5             	mov    %rsp,%rbp
+  800ed4:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800edb:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800edb <cprintf+0xb>
+  800ee2:	49 bb 6d 91 00 00 00 	movabs $0x916d,%r11
+  800ee9:	00 00 00 
+  800eec:	4d 01 da             	add    %r11,%r10
+  800eef:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800ef6:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800efd:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800f04:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f0b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f12:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f19:	84 c0                	test   %al,%al
+  800f1b:	74 20                	je     800f3d <cprintf+0x6d>
+  800f1d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f21:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f25:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f29:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f2d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f31:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f35:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f39:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800f3d:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800f44:	00 00 00 
+  800f47:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800f4e:	00 00 00 
+  800f51:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f55:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800f5c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f63:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800f6a:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800f71:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800f78:	48 8b 06             	mov    (%rsi),%rax
+  800f7b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800f7f:	48 89 01             	mov    %rax,(%rcx)
+  800f82:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800f86:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800f8a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800f8e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800f95:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800f9c:	48 89 d6             	mov    %rdx,%rsi
+  800f9f:	48 89 c7             	mov    %rax,%rdi
+  800fa2:	48 b8 a8 6d ff ff ff 	movabs $0xffffffffffff6da8,%rax
+  800fa9:	ff ff ff 
+  800fac:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800fb0:	ff d0                	call   *%rax
+  800fb2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800fb8:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800fbe:	c9                   	leave
+  800fbf:	c3                   	ret
+
+0000000000800fc0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800fc0:	55                   	push   %rbp
+  800fc1:	48 89 e5             	mov    %rsp,%rbp
+  800fc4:	53                   	push   %rbx
+  800fc5:	48 83 ec 38          	sub    $0x38,%rsp
+  800fc9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800fc9 <printnum+0x9>
+  800fd0:	49 bb 7f 90 00 00 00 	movabs $0x907f,%r11
+  800fd7:	00 00 00 
+  800fda:	4c 01 db             	add    %r11,%rbx
+  800fdd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fe1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800fe5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800fe9:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800fec:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800ff0:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800ff4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800ff7:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800ffb:	72 58                	jb     801055 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800ffd:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  801000:	8d 78 ff             	lea    -0x1(%rax),%edi
+  801003:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  801006:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80100a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100f:	48 f7 f6             	div    %rsi
+  801012:	49 89 c2             	mov    %rax,%r10
+  801015:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  801018:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80101b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80101f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801023:	41 89 c9             	mov    %ecx,%r9d
+  801026:	41 89 f8             	mov    %edi,%r8d
+  801029:	89 d1                	mov    %edx,%ecx
+  80102b:	4c 89 d2             	mov    %r10,%rdx
+  80102e:	48 89 c7             	mov    %rax,%rdi
+  801031:	48 b8 78 6f ff ff ff 	movabs $0xffffffffffff6f78,%rax
+  801038:	ff ff ff 
+  80103b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80103f:	ff d0                	call   *%rax
+  801041:	eb 1c                	jmp    80105f <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801043:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801047:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80104a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80104e:	48 89 d6             	mov    %rdx,%rsi
+  801051:	89 c7                	mov    %eax,%edi
+  801053:	ff d1                	call   *%rcx
+		while (--width > 0)
+  801055:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  801059:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80105d:	7f e4                	jg     801043 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80105f:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801062:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106b:	48 f7 f1             	div    %rcx
+  80106e:	48 b8 4f dd ff ff ff 	movabs $0xffffffffffffdd4f,%rax
+  801075:	ff ff ff 
+  801078:	48 01 d8             	add    %rbx,%rax
+  80107b:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80107f:	0f be c0             	movsbl %al,%eax
+  801082:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801086:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80108a:	48 89 d6             	mov    %rdx,%rsi
+  80108d:	89 c7                	mov    %eax,%edi
+  80108f:	ff d1                	call   *%rcx
+}
+  801091:	90                   	nop
+  801092:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801096:	c9                   	leave
+  801097:	c3                   	ret
+
+0000000000801098 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  801098:	55                   	push   %rbp
+  801099:	48 89 e5             	mov    %rsp,%rbp
+  80109c:	48 83 ec 20          	sub    $0x20,%rsp
+  8010a0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8010a0 <getuint+0x8>
+  8010a7:	49 bb a8 8f 00 00 00 	movabs $0x8fa8,%r11
+  8010ae:	00 00 00 
+  8010b1:	4c 01 d8             	add    %r11,%rax
+  8010b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010b8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8010bb:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8010bf:	7e 4f                	jle    801110 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8010c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010c5:	8b 00                	mov    (%rax),%eax
+  8010c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8010ca:	77 24                	ja     8010f0 <getuint+0x58>
+  8010cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010d0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8010d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010d8:	8b 00                	mov    (%rax),%eax
+  8010da:	89 c0                	mov    %eax,%eax
+  8010dc:	48 01 d0             	add    %rdx,%rax
+  8010df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010e3:	8b 12                	mov    (%rdx),%edx
+  8010e5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8010e8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010ec:	89 0a                	mov    %ecx,(%rdx)
+  8010ee:	eb 14                	jmp    801104 <getuint+0x6c>
+  8010f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010f4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8010f8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8010fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801100:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801104:	48 8b 00             	mov    (%rax),%rax
+  801107:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80110b:	e9 9d 00 00 00       	jmp    8011ad <getuint+0x115>
+	else if (lflag)
+  801110:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801114:	74 4c                	je     801162 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  801116:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80111a:	8b 00                	mov    (%rax),%eax
+  80111c:	83 f8 2f             	cmp    $0x2f,%eax
+  80111f:	77 24                	ja     801145 <getuint+0xad>
+  801121:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801125:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801129:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80112d:	8b 00                	mov    (%rax),%eax
+  80112f:	89 c0                	mov    %eax,%eax
+  801131:	48 01 d0             	add    %rdx,%rax
+  801134:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801138:	8b 12                	mov    (%rdx),%edx
+  80113a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80113d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801141:	89 0a                	mov    %ecx,(%rdx)
+  801143:	eb 14                	jmp    801159 <getuint+0xc1>
+  801145:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801149:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80114d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801151:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801155:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801159:	48 8b 00             	mov    (%rax),%rax
+  80115c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801160:	eb 4b                	jmp    8011ad <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  801162:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801166:	8b 00                	mov    (%rax),%eax
+  801168:	83 f8 2f             	cmp    $0x2f,%eax
+  80116b:	77 24                	ja     801191 <getuint+0xf9>
+  80116d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801171:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801175:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801179:	8b 00                	mov    (%rax),%eax
+  80117b:	89 c0                	mov    %eax,%eax
+  80117d:	48 01 d0             	add    %rdx,%rax
+  801180:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801184:	8b 12                	mov    (%rdx),%edx
+  801186:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801189:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80118d:	89 0a                	mov    %ecx,(%rdx)
+  80118f:	eb 14                	jmp    8011a5 <getuint+0x10d>
+  801191:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801195:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801199:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80119d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8011a1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8011a5:	8b 00                	mov    (%rax),%eax
+  8011a7:	89 c0                	mov    %eax,%eax
+  8011a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8011ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8011b1:	c9                   	leave
+  8011b2:	c3                   	ret
+
+00000000008011b3 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8011b3:	55                   	push   %rbp
+  8011b4:	48 89 e5             	mov    %rsp,%rbp
+  8011b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8011bb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011bb <printfloat+0x8>
+  8011c2:	49 bb 8d 8e 00 00 00 	movabs $0x8e8d,%r11
+  8011c9:	00 00 00 
+  8011cc:	4c 01 d8             	add    %r11,%rax
+  8011cf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8011d3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8011d7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8011db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011df:	48 85 c0             	test   %rax,%rax
+  8011e2:	79 12                	jns    8011f6 <printfloat+0x43>
+		putch('-',putdat);
+  8011e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8011ec:	48 89 c6             	mov    %rax,%rsi
+  8011ef:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8011f4:	ff d2                	call   *%rdx
+	
+}
+  8011f6:	90                   	nop
+  8011f7:	c9                   	leave
+  8011f8:	c3                   	ret
+
+00000000008011f9 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8011f9:	55                   	push   %rbp
+  8011fa:	48 89 e5             	mov    %rsp,%rbp
+  8011fd:	48 83 ec 20          	sub    $0x20,%rsp
+  801201:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801201 <getint+0x8>
+  801208:	49 bb 47 8e 00 00 00 	movabs $0x8e47,%r11
+  80120f:	00 00 00 
+  801212:	4c 01 d8             	add    %r11,%rax
+  801215:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801219:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80121c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801220:	7e 4f                	jle    801271 <getint+0x78>
+		x=va_arg(*ap, long long);
+  801222:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801226:	8b 00                	mov    (%rax),%eax
+  801228:	83 f8 2f             	cmp    $0x2f,%eax
+  80122b:	77 24                	ja     801251 <getint+0x58>
+  80122d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801231:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801235:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801239:	8b 00                	mov    (%rax),%eax
+  80123b:	89 c0                	mov    %eax,%eax
+  80123d:	48 01 d0             	add    %rdx,%rax
+  801240:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801244:	8b 12                	mov    (%rdx),%edx
+  801246:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801249:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80124d:	89 0a                	mov    %ecx,(%rdx)
+  80124f:	eb 14                	jmp    801265 <getint+0x6c>
+  801251:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801255:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801259:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80125d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801261:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801265:	48 8b 00             	mov    (%rax),%rax
+  801268:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80126c:	e9 9d 00 00 00       	jmp    80130e <getint+0x115>
+	else if (lflag)
+  801271:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801275:	74 4c                	je     8012c3 <getint+0xca>
+		x=va_arg(*ap, long);
+  801277:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80127b:	8b 00                	mov    (%rax),%eax
+  80127d:	83 f8 2f             	cmp    $0x2f,%eax
+  801280:	77 24                	ja     8012a6 <getint+0xad>
+  801282:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801286:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80128a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80128e:	8b 00                	mov    (%rax),%eax
+  801290:	89 c0                	mov    %eax,%eax
+  801292:	48 01 d0             	add    %rdx,%rax
+  801295:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801299:	8b 12                	mov    (%rdx),%edx
+  80129b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80129e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012a2:	89 0a                	mov    %ecx,(%rdx)
+  8012a4:	eb 14                	jmp    8012ba <getint+0xc1>
+  8012a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012aa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012ae:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8012b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012b6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8012ba:	48 8b 00             	mov    (%rax),%rax
+  8012bd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8012c1:	eb 4b                	jmp    80130e <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8012c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c7:	8b 00                	mov    (%rax),%eax
+  8012c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8012cc:	77 24                	ja     8012f2 <getint+0xf9>
+  8012ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8012d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012da:	8b 00                	mov    (%rax),%eax
+  8012dc:	89 c0                	mov    %eax,%eax
+  8012de:	48 01 d0             	add    %rdx,%rax
+  8012e1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012e5:	8b 12                	mov    (%rdx),%edx
+  8012e7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8012ea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012ee:	89 0a                	mov    %ecx,(%rdx)
+  8012f0:	eb 14                	jmp    801306 <getint+0x10d>
+  8012f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012fa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8012fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801302:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801306:	8b 00                	mov    (%rax),%eax
+  801308:	48 98                	cltq
+  80130a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80130e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801312:	c9                   	leave
+  801313:	c3                   	ret
+
+0000000000801314 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  801314:	55                   	push   %rbp
+  801315:	48 89 e5             	mov    %rsp,%rbp
+  801318:	41 57                	push   %r15
+  80131a:	41 55                	push   %r13
+  80131c:	41 54                	push   %r12
+  80131e:	53                   	push   %rbx
+  80131f:	48 83 ec 60          	sub    $0x60,%rsp
+  801323:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 801323 <vprintfmt+0xf>
+  80132a:	49 bb 25 8d 00 00 00 	movabs $0x8d25,%r11
+  801331:	00 00 00 
+  801334:	4d 01 dc             	add    %r11,%r12
+  801337:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  80133b:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  80133f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801343:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  801347:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  80134e:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  801352:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  801356:	48 8b 06             	mov    (%rsi),%rax
+  801359:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80135d:	48 89 01             	mov    %rax,(%rcx)
+  801360:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801364:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801368:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80136c:	eb 17                	jmp    801385 <vprintfmt+0x71>
+			if (ch == '\0')
+  80136e:	85 db                	test   %ebx,%ebx
+  801370:	0f 84 97 05 00 00    	je     80190d <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  801376:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80137a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80137e:	48 89 c6             	mov    %rax,%rsi
+  801381:	89 df                	mov    %ebx,%edi
+  801383:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801385:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801389:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80138d:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801391:	0f b6 00             	movzbl (%rax),%eax
+  801394:	0f b6 d8             	movzbl %al,%ebx
+  801397:	83 fb 25             	cmp    $0x25,%ebx
+  80139a:	75 d2                	jne    80136e <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  80139c:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  8013a0:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  8013a7:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8013ae:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  8013b5:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  8013bc:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8013c0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013c4:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8013c8:	0f b6 00             	movzbl (%rax),%eax
+  8013cb:	0f b6 d8             	movzbl %al,%ebx
+  8013ce:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8013d1:	83 f8 55             	cmp    $0x55,%eax
+  8013d4:	0f 87 00 05 00 00    	ja     8018da <vprintfmt+0x5c6>
+  8013da:	89 c0                	mov    %eax,%eax
+  8013dc:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8013e3:	00 
+  8013e4:	48 8d 05 d5 69 00 00 	lea    0x69d5(%rip),%rax        # 807dc0 <.LC18+0xc>
+  8013eb:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  8013ef:	48 8d 15 ca 69 00 00 	lea    0x69ca(%rip),%rdx        # 807dc0 <.LC18+0xc>
+  8013f6:	48 01 d0             	add    %rdx,%rax
+  8013f9:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  8013fb:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  8013ff:	eb bb                	jmp    8013bc <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  801401:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  801405:	eb b5                	jmp    8013bc <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  801407:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  80140e:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  801411:	89 d0                	mov    %edx,%eax
+  801413:	c1 e0 02             	shl    $0x2,%eax
+  801416:	01 d0                	add    %edx,%eax
+  801418:	01 c0                	add    %eax,%eax
+  80141a:	01 d8                	add    %ebx,%eax
+  80141c:	83 e8 30             	sub    $0x30,%eax
+  80141f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  801422:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801426:	0f b6 00             	movzbl (%rax),%eax
+  801429:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  80142c:	83 fb 2f             	cmp    $0x2f,%ebx
+  80142f:	7e 60                	jle    801491 <vprintfmt+0x17d>
+  801431:	83 fb 39             	cmp    $0x39,%ebx
+  801434:	7f 5b                	jg     801491 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  801436:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  80143b:	eb d1                	jmp    80140e <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  80143d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801440:	83 f8 2f             	cmp    $0x2f,%eax
+  801443:	77 17                	ja     80145c <vprintfmt+0x148>
+  801445:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801449:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80144c:	89 d2                	mov    %edx,%edx
+  80144e:	48 01 d0             	add    %rdx,%rax
+  801451:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801454:	83 c2 08             	add    $0x8,%edx
+  801457:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80145a:	eb 0c                	jmp    801468 <vprintfmt+0x154>
+  80145c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801460:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801464:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801468:	8b 00                	mov    (%rax),%eax
+  80146a:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  80146d:	eb 23                	jmp    801492 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  80146f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801473:	0f 89 43 ff ff ff    	jns    8013bc <vprintfmt+0xa8>
+				width = 0;
+  801479:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  801480:	e9 37 ff ff ff       	jmp    8013bc <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  801485:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  80148c:	e9 2b ff ff ff       	jmp    8013bc <vprintfmt+0xa8>
+			goto process_precision;
+  801491:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  801492:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801496:	0f 89 20 ff ff ff    	jns    8013bc <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  80149c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80149f:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8014a2:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  8014a9:	e9 0e ff ff ff       	jmp    8013bc <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8014ae:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  8014b2:	e9 05 ff ff ff       	jmp    8013bc <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  8014b7:	83 fb 39             	cmp    $0x39,%ebx
+  8014ba:	7f 0b                	jg     8014c7 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  8014bc:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  8014bf:	c1 e0 08             	shl    $0x8,%eax
+  8014c2:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8014c5:	eb 21                	jmp    8014e8 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  8014c7:	83 fb 60             	cmp    $0x60,%ebx
+  8014ca:	7e 10                	jle    8014dc <vprintfmt+0x1c8>
+  8014cc:	83 fb 66             	cmp    $0x66,%ebx
+  8014cf:	7f 0b                	jg     8014dc <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  8014d1:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  8014d4:	c1 e0 08             	shl    $0x8,%eax
+  8014d7:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8014da:	eb 0c                	jmp    8014e8 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  8014dc:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  8014e3:	e9 04 01 00 00       	jmp    8015ec <vprintfmt+0x2d8>
+  8014e8:	e9 ff 00 00 00       	jmp    8015ec <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8014ed:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8014f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8014f3:	77 17                	ja     80150c <vprintfmt+0x1f8>
+  8014f5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8014f9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8014fc:	89 d2                	mov    %edx,%edx
+  8014fe:	48 01 d0             	add    %rdx,%rax
+  801501:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801504:	83 c2 08             	add    $0x8,%edx
+  801507:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80150a:	eb 0c                	jmp    801518 <vprintfmt+0x204>
+  80150c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801510:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801514:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801518:	8b 00                	mov    (%rax),%eax
+  80151a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80151e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801522:	48 89 d6             	mov    %rdx,%rsi
+  801525:	89 c7                	mov    %eax,%edi
+  801527:	ff d1                	call   *%rcx
+			break;
+  801529:	e9 da 03 00 00       	jmp    801908 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80152e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801531:	83 f8 2f             	cmp    $0x2f,%eax
+  801534:	77 17                	ja     80154d <vprintfmt+0x239>
+  801536:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80153a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80153d:	89 d2                	mov    %edx,%edx
+  80153f:	48 01 d0             	add    %rdx,%rax
+  801542:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801545:	83 c2 08             	add    $0x8,%edx
+  801548:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80154b:	eb 0c                	jmp    801559 <vprintfmt+0x245>
+  80154d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801551:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801555:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801559:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  80155b:	85 db                	test   %ebx,%ebx
+  80155d:	79 02                	jns    801561 <vprintfmt+0x24d>
+				err = -err;
+  80155f:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801561:	83 fb 15             	cmp    $0x15,%ebx
+  801564:	7f 19                	jg     80157f <vprintfmt+0x26b>
+  801566:	48 ba 38 01 00 00 00 	movabs $0x138,%rdx
+  80156d:	00 00 00 
+  801570:	48 63 c3             	movslq %ebx,%rax
+  801573:	4c 01 e2             	add    %r12,%rdx
+  801576:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  80157a:	4d 85 ed             	test   %r13,%r13
+  80157d:	75 36                	jne    8015b5 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  80157f:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801583:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801587:	89 d9                	mov    %ebx,%ecx
+  801589:	48 ba 60 dd ff ff ff 	movabs $0xffffffffffffdd60,%rdx
+  801590:	ff ff ff 
+  801593:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  801597:	48 89 c7             	mov    %rax,%rdi
+  80159a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159f:	49 b8 d3 78 ff ff ff 	movabs $0xffffffffffff78d3,%r8
+  8015a6:	ff ff ff 
+  8015a9:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8015ad:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8015b0:	e9 53 03 00 00       	jmp    801908 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  8015b5:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8015b9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8015bd:	4c 89 e9             	mov    %r13,%rcx
+  8015c0:	48 ba 69 dd ff ff ff 	movabs $0xffffffffffffdd69,%rdx
+  8015c7:	ff ff ff 
+  8015ca:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8015ce:	48 89 c7             	mov    %rax,%rdi
+  8015d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d6:	49 b8 d3 78 ff ff ff 	movabs $0xffffffffffff78d3,%r8
+  8015dd:	ff ff ff 
+  8015e0:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8015e4:	41 ff d0             	call   *%r8
+			break;
+  8015e7:	e9 1c 03 00 00       	jmp    801908 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  8015ec:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8015ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8015f2:	77 17                	ja     80160b <vprintfmt+0x2f7>
+  8015f4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8015f8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8015fb:	89 d2                	mov    %edx,%edx
+  8015fd:	48 01 d0             	add    %rdx,%rax
+  801600:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801603:	83 c2 08             	add    $0x8,%edx
+  801606:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801609:	eb 0c                	jmp    801617 <vprintfmt+0x303>
+  80160b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80160f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801613:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801617:	4c 8b 28             	mov    (%rax),%r13
+  80161a:	4d 85 ed             	test   %r13,%r13
+  80161d:	75 0e                	jne    80162d <vprintfmt+0x319>
+				p = "(null)";
+  80161f:	48 b8 6c dd ff ff ff 	movabs $0xffffffffffffdd6c,%rax
+  801626:	ff ff ff 
+  801629:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  80162d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801631:	0f 8e 84 00 00 00    	jle    8016bb <vprintfmt+0x3a7>
+  801637:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  80163b:	74 7e                	je     8016bb <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80163d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801640:	48 98                	cltq
+  801642:	48 89 c6             	mov    %rax,%rsi
+  801645:	4c 89 ef             	mov    %r13,%rdi
+  801648:	4d 89 e7             	mov    %r12,%r15
+  80164b:	48 b8 f8 7b ff ff ff 	movabs $0xffffffffffff7bf8,%rax
+  801652:	ff ff ff 
+  801655:	4c 01 e0             	add    %r12,%rax
+  801658:	ff d0                	call   *%rax
+  80165a:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  80165d:	eb 17                	jmp    801676 <vprintfmt+0x362>
+					putch(padc, putdat);
+  80165f:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  801663:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  801667:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  80166b:	48 89 d6             	mov    %rdx,%rsi
+  80166e:	89 c7                	mov    %eax,%edi
+  801670:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801672:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801676:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80167a:	7f e3                	jg     80165f <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80167c:	eb 3d                	jmp    8016bb <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80167e:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  801682:	74 1e                	je     8016a2 <vprintfmt+0x38e>
+  801684:	83 fb 1f             	cmp    $0x1f,%ebx
+  801687:	7e 05                	jle    80168e <vprintfmt+0x37a>
+  801689:	83 fb 7e             	cmp    $0x7e,%ebx
+  80168c:	7e 14                	jle    8016a2 <vprintfmt+0x38e>
+					putch('?', putdat);
+  80168e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801692:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801696:	48 89 c6             	mov    %rax,%rsi
+  801699:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80169e:	ff d2                	call   *%rdx
+  8016a0:	eb 15                	jmp    8016b7 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  8016a2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8016a5:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  8016a8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8016ac:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8016b0:	48 89 c6             	mov    %rax,%rsi
+  8016b3:	89 cf                	mov    %ecx,%edi
+  8016b5:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8016b7:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8016bb:	4c 89 e8             	mov    %r13,%rax
+  8016be:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  8016c2:	0f b6 00             	movzbl (%rax),%eax
+  8016c5:	0f be d8             	movsbl %al,%ebx
+  8016c8:	85 db                	test   %ebx,%ebx
+  8016ca:	74 28                	je     8016f4 <vprintfmt+0x3e0>
+  8016cc:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8016d0:	78 ac                	js     80167e <vprintfmt+0x36a>
+  8016d2:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  8016d6:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8016da:	79 a2                	jns    80167e <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  8016dc:	eb 16                	jmp    8016f4 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  8016de:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8016e2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8016e6:	48 89 c6             	mov    %rax,%rsi
+  8016e9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8016ee:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8016f0:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8016f4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8016f8:	7f e4                	jg     8016de <vprintfmt+0x3ca>
+			break;
+  8016fa:	e9 09 02 00 00       	jmp    801908 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  8016ff:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801703:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801707:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80170b:	0f b6 00             	movzbl (%rax),%eax
+  80170e:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801711:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801712:	83 fb 2f             	cmp    $0x2f,%ebx
+  801715:	0f 8e ac fd ff ff    	jle    8014c7 <vprintfmt+0x1b3>
+  80171b:	e9 97 fd ff ff       	jmp    8014b7 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801720:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801724:	be 03 00 00 00       	mov    $0x3,%esi
+  801729:	48 89 c7             	mov    %rax,%rdi
+  80172c:	48 b8 b1 71 ff ff ff 	movabs $0xffffffffffff71b1,%rax
+  801733:	ff ff ff 
+  801736:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80173a:	ff d0                	call   *%rax
+  80173c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  801740:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801744:	48 85 c0             	test   %rax,%rax
+  801747:	79 1d                	jns    801766 <vprintfmt+0x452>
+				putch('-', putdat);
+  801749:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80174d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801751:	48 89 c6             	mov    %rax,%rsi
+  801754:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801759:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  80175b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80175f:	48 f7 d8             	neg    %rax
+  801762:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  801766:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80176d:	e9 de 00 00 00       	jmp    801850 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801772:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801776:	be 03 00 00 00       	mov    $0x3,%esi
+  80177b:	48 89 c7             	mov    %rax,%rdi
+  80177e:	48 b8 50 70 ff ff ff 	movabs $0xffffffffffff7050,%rax
+  801785:	ff ff ff 
+  801788:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80178c:	ff d0                	call   *%rax
+  80178e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801792:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801799:	e9 b2 00 00 00       	jmp    801850 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  80179e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8017a2:	be 03 00 00 00       	mov    $0x3,%esi
+  8017a7:	48 89 c7             	mov    %rax,%rdi
+  8017aa:	48 b8 50 70 ff ff ff 	movabs $0xffffffffffff7050,%rax
+  8017b1:	ff ff ff 
+  8017b4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8017b8:	ff d0                	call   *%rax
+  8017ba:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  8017be:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  8017c5:	e9 86 00 00 00       	jmp    801850 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  8017ca:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8017ce:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8017d2:	48 89 c6             	mov    %rax,%rsi
+  8017d5:	bf 30 00 00 00       	mov    $0x30,%edi
+  8017da:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  8017dc:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8017e0:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8017e4:	48 89 c6             	mov    %rax,%rsi
+  8017e7:	bf 78 00 00 00       	mov    $0x78,%edi
+  8017ec:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8017ee:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8017f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8017f4:	77 17                	ja     80180d <vprintfmt+0x4f9>
+  8017f6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8017fa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8017fd:	89 d2                	mov    %edx,%edx
+  8017ff:	48 01 d0             	add    %rdx,%rax
+  801802:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801805:	83 c2 08             	add    $0x8,%edx
+  801808:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80180b:	eb 0c                	jmp    801819 <vprintfmt+0x505>
+  80180d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801811:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801815:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801819:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80181c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801820:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801827:	eb 27                	jmp    801850 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801829:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80182d:	be 03 00 00 00       	mov    $0x3,%esi
+  801832:	48 89 c7             	mov    %rax,%rdi
+  801835:	48 b8 50 70 ff ff ff 	movabs $0xffffffffffff7050,%rax
+  80183c:	ff ff ff 
+  80183f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801843:	ff d0                	call   *%rax
+  801845:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801849:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801850:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801855:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801858:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80185b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80185f:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801863:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801867:	45 89 c1             	mov    %r8d,%r9d
+  80186a:	41 89 f8             	mov    %edi,%r8d
+  80186d:	48 89 c7             	mov    %rax,%rdi
+  801870:	48 b8 78 6f ff ff ff 	movabs $0xffffffffffff6f78,%rax
+  801877:	ff ff ff 
+  80187a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80187e:	ff d0                	call   *%rax
+			break;
+  801880:	e9 83 00 00 00       	jmp    801908 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801885:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801889:	be 03 00 00 00       	mov    $0x3,%esi
+  80188e:	48 89 c7             	mov    %rax,%rdi
+  801891:	48 b8 50 70 ff ff ff 	movabs $0xffffffffffff7050,%rax
+  801898:	ff ff ff 
+  80189b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80189f:	ff d0                	call   *%rax
+  8018a1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8018a5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8018a9:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8018ad:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8018b1:	48 89 ce             	mov    %rcx,%rsi
+  8018b4:	48 89 c7             	mov    %rax,%rdi
+  8018b7:	48 b8 6b 71 ff ff ff 	movabs $0xffffffffffff716b,%rax
+  8018be:	ff ff ff 
+  8018c1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8018c5:	ff d0                	call   *%rax
+	
+			break;
+  8018c7:	eb 3f                	jmp    801908 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8018c9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8018cd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8018d1:	48 89 c6             	mov    %rax,%rsi
+  8018d4:	89 df                	mov    %ebx,%edi
+  8018d6:	ff d2                	call   *%rdx
+			break;
+  8018d8:	eb 2e                	jmp    801908 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8018da:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8018de:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8018e2:	48 89 c6             	mov    %rax,%rsi
+  8018e5:	bf 25 00 00 00       	mov    $0x25,%edi
+  8018ea:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8018ec:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8018f1:	eb 05                	jmp    8018f8 <vprintfmt+0x5e4>
+  8018f3:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8018f8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8018fc:	48 83 e8 01          	sub    $0x1,%rax
+  801900:	0f b6 00             	movzbl (%rax),%eax
+  801903:	3c 25                	cmp    $0x25,%al
+  801905:	75 ec                	jne    8018f3 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801907:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801908:	e9 78 fa ff ff       	jmp    801385 <vprintfmt+0x71>
+				return;
+  80190d:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80190e:	48 83 c4 60          	add    $0x60,%rsp
+  801912:	5b                   	pop    %rbx
+  801913:	41 5c                	pop    %r12
+  801915:	41 5d                	pop    %r13
+  801917:	41 5f                	pop    %r15
+  801919:	5d                   	pop    %rbp
+  80191a:	c3                   	ret
+
+000000000080191b <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80191b:	55                   	push   %rbp
+  80191c:	48 89 e5             	mov    %rsp,%rbp
+  80191f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801926:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801926 <printfmt+0xb>
+  80192d:	49 bb 22 87 00 00 00 	movabs $0x8722,%r11
+  801934:	00 00 00 
+  801937:	4d 01 da             	add    %r11,%r10
+  80193a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801941:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801948:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80194f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801956:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80195d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801964:	84 c0                	test   %al,%al
+  801966:	74 20                	je     801988 <printfmt+0x6d>
+  801968:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80196c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801970:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801974:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801978:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80197c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801980:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801984:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801988:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80198f:	00 00 00 
+  801992:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801999:	00 00 00 
+  80199c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019a0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8019a7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8019ae:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8019b5:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8019bc:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8019c3:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8019ca:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8019d1:	48 89 c7             	mov    %rax,%rdi
+  8019d4:	48 b8 cc 72 ff ff ff 	movabs $0xffffffffffff72cc,%rax
+  8019db:	ff ff ff 
+  8019de:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8019e2:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8019e4:	90                   	nop
+  8019e5:	c9                   	leave
+  8019e6:	c3                   	ret
+
+00000000008019e7 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8019e7:	55                   	push   %rbp
+  8019e8:	48 89 e5             	mov    %rsp,%rbp
+  8019eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8019ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019ef <sprintputch+0x8>
+  8019f6:	49 bb 59 86 00 00 00 	movabs $0x8659,%r11
+  8019fd:	00 00 00 
+  801a00:	4c 01 d8             	add    %r11,%rax
+  801a03:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801a06:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801a0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a0e:	8b 40 10             	mov    0x10(%rax),%eax
+  801a11:	8d 50 01             	lea    0x1(%rax),%edx
+  801a14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a18:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801a1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a1f:	48 8b 10             	mov    (%rax),%rdx
+  801a22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a26:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801a2a:	48 39 c2             	cmp    %rax,%rdx
+  801a2d:	73 17                	jae    801a46 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801a2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a33:	48 8b 00             	mov    (%rax),%rax
+  801a36:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a3a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a3e:	48 89 0a             	mov    %rcx,(%rdx)
+  801a41:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801a44:	88 10                	mov    %dl,(%rax)
+}
+  801a46:	90                   	nop
+  801a47:	c9                   	leave
+  801a48:	c3                   	ret
+
+0000000000801a49 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801a49:	55                   	push   %rbp
+  801a4a:	48 89 e5             	mov    %rsp,%rbp
+  801a4d:	53                   	push   %rbx
+  801a4e:	48 83 ec 58          	sub    $0x58,%rsp
+  801a52:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a52 <vsnprintf+0x9>
+  801a59:	49 bb f6 85 00 00 00 	movabs $0x85f6,%r11
+  801a60:	00 00 00 
+  801a63:	4c 01 d8             	add    %r11,%rax
+  801a66:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801a6a:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801a6d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801a71:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801a75:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801a79:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801a7d:	48 8b 0e             	mov    (%rsi),%rcx
+  801a80:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801a84:	48 89 0a             	mov    %rcx,(%rdx)
+  801a87:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801a8b:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801a8f:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801a93:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801a97:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801a9b:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801a9e:	48 63 d2             	movslq %edx,%rdx
+  801aa1:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801aa5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801aa9:	48 01 ca             	add    %rcx,%rdx
+  801aac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ab0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801ab7:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801abc:	74 06                	je     801ac4 <vsnprintf+0x7b>
+  801abe:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801ac2:	7f 07                	jg     801acb <vsnprintf+0x82>
+		return -E_INVAL;
+  801ac4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ac9:	eb 34                	jmp    801aff <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801acb:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801acf:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801ad3:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801ad7:	48 bf 9f 79 ff ff ff 	movabs $0xffffffffffff799f,%rdi
+  801ade:	ff ff ff 
+  801ae1:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801ae5:	49 b8 cc 72 ff ff ff 	movabs $0xffffffffffff72cc,%r8
+  801aec:	ff ff ff 
+  801aef:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801af3:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801af5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801af9:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801afc:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801aff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b03:	c9                   	leave
+  801b04:	c3                   	ret
+
+0000000000801b05 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801b05:	55                   	push   %rbp
+  801b06:	48 89 e5             	mov    %rsp,%rbp
+  801b09:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801b10:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801b10 <snprintf+0xb>
+  801b17:	49 bb 38 85 00 00 00 	movabs $0x8538,%r11
+  801b1e:	00 00 00 
+  801b21:	4d 01 da             	add    %r11,%r10
+  801b24:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801b2b:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801b31:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801b38:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801b3f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801b46:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801b4d:	84 c0                	test   %al,%al
+  801b4f:	74 20                	je     801b71 <snprintf+0x6c>
+  801b51:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801b55:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801b59:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801b5d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801b61:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801b65:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801b69:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801b6d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801b71:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801b78:	00 00 00 
+  801b7b:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801b82:	00 00 00 
+  801b85:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b89:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801b90:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801b97:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801b9e:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801ba5:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801bac:	48 8b 06             	mov    (%rsi),%rax
+  801baf:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801bb3:	48 89 01             	mov    %rax,(%rcx)
+  801bb6:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801bba:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801bbe:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801bc2:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801bc9:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801bd0:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801bd6:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801bdd:	48 89 c7             	mov    %rax,%rdi
+  801be0:	48 b8 01 7a ff ff ff 	movabs $0xffffffffffff7a01,%rax
+  801be7:	ff ff ff 
+  801bea:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801bee:	ff d0                	call   *%rax
+  801bf0:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801bf6:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801bfc:	c9                   	leave
+  801bfd:	c3                   	ret
+
+0000000000801bfe <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801bfe:	55                   	push   %rbp
+  801bff:	48 89 e5             	mov    %rsp,%rbp
+  801c02:	48 83 ec 18          	sub    $0x18,%rsp
+  801c06:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c06 <strlen+0x8>
+  801c0d:	49 bb 42 84 00 00 00 	movabs $0x8442,%r11
+  801c14:	00 00 00 
+  801c17:	4c 01 d8             	add    %r11,%rax
+  801c1a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801c1e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801c25:	eb 09                	jmp    801c30 <strlen+0x32>
+		n++;
+  801c27:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801c2b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801c30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c34:	0f b6 00             	movzbl (%rax),%eax
+  801c37:	84 c0                	test   %al,%al
+  801c39:	75 ec                	jne    801c27 <strlen+0x29>
+	return n;
+  801c3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801c3e:	c9                   	leave
+  801c3f:	c3                   	ret
+
+0000000000801c40 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801c40:	55                   	push   %rbp
+  801c41:	48 89 e5             	mov    %rsp,%rbp
+  801c44:	48 83 ec 20          	sub    $0x20,%rsp
+  801c48:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c48 <strnlen+0x8>
+  801c4f:	49 bb 00 84 00 00 00 	movabs $0x8400,%r11
+  801c56:	00 00 00 
+  801c59:	4c 01 d8             	add    %r11,%rax
+  801c5c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c60:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801c64:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801c6b:	eb 0e                	jmp    801c7b <strnlen+0x3b>
+		n++;
+  801c6d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801c71:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801c76:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801c7b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801c80:	74 0b                	je     801c8d <strnlen+0x4d>
+  801c82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c86:	0f b6 00             	movzbl (%rax),%eax
+  801c89:	84 c0                	test   %al,%al
+  801c8b:	75 e0                	jne    801c6d <strnlen+0x2d>
+	return n;
+  801c8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801c90:	c9                   	leave
+  801c91:	c3                   	ret
+
+0000000000801c92 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801c92:	55                   	push   %rbp
+  801c93:	48 89 e5             	mov    %rsp,%rbp
+  801c96:	48 83 ec 20          	sub    $0x20,%rsp
+  801c9a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c9a <strcpy+0x8>
+  801ca1:	49 bb ae 83 00 00 00 	movabs $0x83ae,%r11
+  801ca8:	00 00 00 
+  801cab:	4c 01 d8             	add    %r11,%rax
+  801cae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801cb2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801cb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801cbe:	90                   	nop
+  801cbf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801cc3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801cc7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801ccb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ccf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801cd3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801cd7:	0f b6 12             	movzbl (%rdx),%edx
+  801cda:	88 10                	mov    %dl,(%rax)
+  801cdc:	0f b6 00             	movzbl (%rax),%eax
+  801cdf:	84 c0                	test   %al,%al
+  801ce1:	75 dc                	jne    801cbf <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801ce3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801ce7:	c9                   	leave
+  801ce8:	c3                   	ret
+
+0000000000801ce9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801ce9:	55                   	push   %rbp
+  801cea:	48 89 e5             	mov    %rsp,%rbp
+  801ced:	53                   	push   %rbx
+  801cee:	48 83 ec 20          	sub    $0x20,%rsp
+  801cf2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801cf2 <strcat+0x9>
+  801cf9:	49 bb 56 83 00 00 00 	movabs $0x8356,%r11
+  801d00:	00 00 00 
+  801d03:	4c 01 db             	add    %r11,%rbx
+  801d06:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801d0a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801d0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d12:	48 89 c7             	mov    %rax,%rdi
+  801d15:	48 b8 b6 7b ff ff ff 	movabs $0xffffffffffff7bb6,%rax
+  801d1c:	ff ff ff 
+  801d1f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d23:	ff d0                	call   *%rax
+  801d25:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801d28:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801d2b:	48 63 d0             	movslq %eax,%rdx
+  801d2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d32:	48 01 c2             	add    %rax,%rdx
+  801d35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d39:	48 89 c6             	mov    %rax,%rsi
+  801d3c:	48 89 d7             	mov    %rdx,%rdi
+  801d3f:	48 b8 4a 7c ff ff ff 	movabs $0xffffffffffff7c4a,%rax
+  801d46:	ff ff ff 
+  801d49:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d4d:	ff d0                	call   *%rax
+	return dst;
+  801d4f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801d53:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d57:	c9                   	leave
+  801d58:	c3                   	ret
+
+0000000000801d59 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801d59:	55                   	push   %rbp
+  801d5a:	48 89 e5             	mov    %rsp,%rbp
+  801d5d:	48 83 ec 28          	sub    $0x28,%rsp
+  801d61:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d61 <strncpy+0x8>
+  801d68:	49 bb e7 82 00 00 00 	movabs $0x82e7,%r11
+  801d6f:	00 00 00 
+  801d72:	4c 01 d8             	add    %r11,%rax
+  801d75:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d79:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801d7d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801d81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d85:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801d89:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801d90:	00 
+  801d91:	eb 2a                	jmp    801dbd <strncpy+0x64>
+		*dst++ = *src;
+  801d93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d97:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d9b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801d9f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801da3:	0f b6 12             	movzbl (%rdx),%edx
+  801da6:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801da8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dac:	0f b6 00             	movzbl (%rax),%eax
+  801daf:	84 c0                	test   %al,%al
+  801db1:	74 05                	je     801db8 <strncpy+0x5f>
+			src++;
+  801db3:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801db8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801dbd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dc1:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801dc5:	72 cc                	jb     801d93 <strncpy+0x3a>
+	}
+	return ret;
+  801dc7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801dcb:	c9                   	leave
+  801dcc:	c3                   	ret
+
+0000000000801dcd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801dcd:	55                   	push   %rbp
+  801dce:	48 89 e5             	mov    %rsp,%rbp
+  801dd1:	48 83 ec 28          	sub    $0x28,%rsp
+  801dd5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dd5 <strlcpy+0x8>
+  801ddc:	49 bb 73 82 00 00 00 	movabs $0x8273,%r11
+  801de3:	00 00 00 
+  801de6:	4c 01 d8             	add    %r11,%rax
+  801de9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ded:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801df1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801df5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801df9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801dfd:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801e02:	74 3d                	je     801e41 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801e04:	eb 1d                	jmp    801e23 <strlcpy+0x56>
+			*dst++ = *src++;
+  801e06:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801e0a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801e0e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801e12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e16:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801e1a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e1e:	0f b6 12             	movzbl (%rdx),%edx
+  801e21:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801e23:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801e28:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801e2d:	74 0b                	je     801e3a <strlcpy+0x6d>
+  801e2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e33:	0f b6 00             	movzbl (%rax),%eax
+  801e36:	84 c0                	test   %al,%al
+  801e38:	75 cc                	jne    801e06 <strlcpy+0x39>
+		*dst = '\0';
+  801e3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e3e:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801e41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e45:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801e49:	c9                   	leave
+  801e4a:	c3                   	ret
+
+0000000000801e4b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801e4b:	55                   	push   %rbp
+  801e4c:	48 89 e5             	mov    %rsp,%rbp
+  801e4f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e53:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e53 <strcmp+0x8>
+  801e5a:	49 bb f5 81 00 00 00 	movabs $0x81f5,%r11
+  801e61:	00 00 00 
+  801e64:	4c 01 d8             	add    %r11,%rax
+  801e67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e6b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801e6f:	eb 0a                	jmp    801e7b <strcmp+0x30>
+		p++, q++;
+  801e71:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e76:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801e7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e7f:	0f b6 00             	movzbl (%rax),%eax
+  801e82:	84 c0                	test   %al,%al
+  801e84:	74 12                	je     801e98 <strcmp+0x4d>
+  801e86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e8a:	0f b6 10             	movzbl (%rax),%edx
+  801e8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e91:	0f b6 00             	movzbl (%rax),%eax
+  801e94:	38 c2                	cmp    %al,%dl
+  801e96:	74 d9                	je     801e71 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801e98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e9c:	0f b6 00             	movzbl (%rax),%eax
+  801e9f:	0f b6 d0             	movzbl %al,%edx
+  801ea2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ea6:	0f b6 00             	movzbl (%rax),%eax
+  801ea9:	0f b6 c0             	movzbl %al,%eax
+  801eac:	29 c2                	sub    %eax,%edx
+  801eae:	89 d0                	mov    %edx,%eax
+}
+  801eb0:	c9                   	leave
+  801eb1:	c3                   	ret
+
+0000000000801eb2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801eb2:	55                   	push   %rbp
+  801eb3:	48 89 e5             	mov    %rsp,%rbp
+  801eb6:	48 83 ec 18          	sub    $0x18,%rsp
+  801eba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801eba <strncmp+0x8>
+  801ec1:	49 bb 8e 81 00 00 00 	movabs $0x818e,%r11
+  801ec8:	00 00 00 
+  801ecb:	4c 01 d8             	add    %r11,%rax
+  801ece:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ed2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ed6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801eda:	eb 0f                	jmp    801eeb <strncmp+0x39>
+		n--, p++, q++;
+  801edc:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801ee1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ee6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801eeb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ef0:	74 1d                	je     801f0f <strncmp+0x5d>
+  801ef2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ef6:	0f b6 00             	movzbl (%rax),%eax
+  801ef9:	84 c0                	test   %al,%al
+  801efb:	74 12                	je     801f0f <strncmp+0x5d>
+  801efd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f01:	0f b6 10             	movzbl (%rax),%edx
+  801f04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f08:	0f b6 00             	movzbl (%rax),%eax
+  801f0b:	38 c2                	cmp    %al,%dl
+  801f0d:	74 cd                	je     801edc <strncmp+0x2a>
+	if (n == 0)
+  801f0f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f14:	75 07                	jne    801f1d <strncmp+0x6b>
+		return 0;
+  801f16:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1b:	eb 16                	jmp    801f33 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801f1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f21:	0f b6 00             	movzbl (%rax),%eax
+  801f24:	0f b6 d0             	movzbl %al,%edx
+  801f27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f2b:	0f b6 00             	movzbl (%rax),%eax
+  801f2e:	0f b6 c0             	movzbl %al,%eax
+  801f31:	29 c2                	sub    %eax,%edx
+}
+  801f33:	89 d0                	mov    %edx,%eax
+  801f35:	c9                   	leave
+  801f36:	c3                   	ret
+
+0000000000801f37 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801f37:	55                   	push   %rbp
+  801f38:	48 89 e5             	mov    %rsp,%rbp
+  801f3b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f3f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f3f <strchr+0x8>
+  801f46:	49 bb 09 81 00 00 00 	movabs $0x8109,%r11
+  801f4d:	00 00 00 
+  801f50:	4c 01 d8             	add    %r11,%rax
+  801f53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f57:	89 f0                	mov    %esi,%eax
+  801f59:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801f5c:	eb 17                	jmp    801f75 <strchr+0x3e>
+		if (*s == c)
+  801f5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f62:	0f b6 00             	movzbl (%rax),%eax
+  801f65:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801f68:	75 06                	jne    801f70 <strchr+0x39>
+			return (char *) s;
+  801f6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f6e:	eb 15                	jmp    801f85 <strchr+0x4e>
+	for (; *s; s++)
+  801f70:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801f75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f79:	0f b6 00             	movzbl (%rax),%eax
+  801f7c:	84 c0                	test   %al,%al
+  801f7e:	75 de                	jne    801f5e <strchr+0x27>
+	return 0;
+  801f80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f85:	c9                   	leave
+  801f86:	c3                   	ret
+
+0000000000801f87 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801f87:	55                   	push   %rbp
+  801f88:	48 89 e5             	mov    %rsp,%rbp
+  801f8b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f8f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f8f <strfind+0x8>
+  801f96:	49 bb b9 80 00 00 00 	movabs $0x80b9,%r11
+  801f9d:	00 00 00 
+  801fa0:	4c 01 d8             	add    %r11,%rax
+  801fa3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801fa7:	89 f0                	mov    %esi,%eax
+  801fa9:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801fac:	eb 11                	jmp    801fbf <strfind+0x38>
+		if (*s == c)
+  801fae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fb2:	0f b6 00             	movzbl (%rax),%eax
+  801fb5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801fb8:	74 12                	je     801fcc <strfind+0x45>
+	for (; *s; s++)
+  801fba:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801fbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fc3:	0f b6 00             	movzbl (%rax),%eax
+  801fc6:	84 c0                	test   %al,%al
+  801fc8:	75 e4                	jne    801fae <strfind+0x27>
+  801fca:	eb 01                	jmp    801fcd <strfind+0x46>
+			break;
+  801fcc:	90                   	nop
+	return (char *) s;
+  801fcd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801fd1:	c9                   	leave
+  801fd2:	c3                   	ret
+
+0000000000801fd3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801fd3:	55                   	push   %rbp
+  801fd4:	48 89 e5             	mov    %rsp,%rbp
+  801fd7:	48 83 ec 18          	sub    $0x18,%rsp
+  801fdb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fdb <memset+0x8>
+  801fe2:	49 bb 6d 80 00 00 00 	movabs $0x806d,%r11
+  801fe9:	00 00 00 
+  801fec:	4c 01 d8             	add    %r11,%rax
+  801fef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ff3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801ff6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801ffa:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801fff:	75 06                	jne    802007 <memset+0x34>
+		return v;
+  802001:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802005:	eb 69                	jmp    802070 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  802007:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80200b:	83 e0 03             	and    $0x3,%eax
+  80200e:	48 85 c0             	test   %rax,%rax
+  802011:	75 48                	jne    80205b <memset+0x88>
+  802013:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802017:	83 e0 03             	and    $0x3,%eax
+  80201a:	48 85 c0             	test   %rax,%rax
+  80201d:	75 3c                	jne    80205b <memset+0x88>
+		c &= 0xFF;
+  80201f:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  802026:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802029:	c1 e0 18             	shl    $0x18,%eax
+  80202c:	89 c2                	mov    %eax,%edx
+  80202e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802031:	c1 e0 10             	shl    $0x10,%eax
+  802034:	09 c2                	or     %eax,%edx
+  802036:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802039:	c1 e0 08             	shl    $0x8,%eax
+  80203c:	09 d0                	or     %edx,%eax
+  80203e:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  802041:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802045:	48 c1 e8 02          	shr    $0x2,%rax
+  802049:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  80204c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802050:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802053:	48 89 d7             	mov    %rdx,%rdi
+  802056:	fc                   	cld
+  802057:	f3 ab                	rep stos %eax,%es:(%rdi)
+  802059:	eb 11                	jmp    80206c <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80205b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80205f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802062:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802066:	48 89 d7             	mov    %rdx,%rdi
+  802069:	fc                   	cld
+  80206a:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  80206c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802070:	c9                   	leave
+  802071:	c3                   	ret
+
+0000000000802072 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802072:	55                   	push   %rbp
+  802073:	48 89 e5             	mov    %rsp,%rbp
+  802076:	48 83 ec 28          	sub    $0x28,%rsp
+  80207a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80207a <memmove+0x8>
+  802081:	49 bb ce 7f 00 00 00 	movabs $0x7fce,%r11
+  802088:	00 00 00 
+  80208b:	4c 01 d8             	add    %r11,%rax
+  80208e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802092:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802096:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80209a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80209e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8020a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8020aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020ae:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8020b2:	0f 83 88 00 00 00    	jae    802140 <memmove+0xce>
+  8020b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020c0:	48 01 d0             	add    %rdx,%rax
+  8020c3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8020c7:	73 77                	jae    802140 <memmove+0xce>
+		s += n;
+  8020c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020cd:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8020d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020d5:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8020d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020dd:	83 e0 03             	and    $0x3,%eax
+  8020e0:	48 85 c0             	test   %rax,%rax
+  8020e3:	75 3b                	jne    802120 <memmove+0xae>
+  8020e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020e9:	83 e0 03             	and    $0x3,%eax
+  8020ec:	48 85 c0             	test   %rax,%rax
+  8020ef:	75 2f                	jne    802120 <memmove+0xae>
+  8020f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020f5:	83 e0 03             	and    $0x3,%eax
+  8020f8:	48 85 c0             	test   %rax,%rax
+  8020fb:	75 23                	jne    802120 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8020fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802101:	48 83 e8 04          	sub    $0x4,%rax
+  802105:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802109:	48 83 ea 04          	sub    $0x4,%rdx
+  80210d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802111:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  802115:	48 89 c7             	mov    %rax,%rdi
+  802118:	48 89 d6             	mov    %rdx,%rsi
+  80211b:	fd                   	std
+  80211c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80211e:	eb 1d                	jmp    80213d <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802120:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802124:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802128:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80212c:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  802130:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802134:	48 89 d7             	mov    %rdx,%rdi
+  802137:	48 89 c1             	mov    %rax,%rcx
+  80213a:	fd                   	std
+  80213b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80213d:	fc                   	cld
+  80213e:	eb 57                	jmp    802197 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  802140:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802144:	83 e0 03             	and    $0x3,%eax
+  802147:	48 85 c0             	test   %rax,%rax
+  80214a:	75 36                	jne    802182 <memmove+0x110>
+  80214c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802150:	83 e0 03             	and    $0x3,%eax
+  802153:	48 85 c0             	test   %rax,%rax
+  802156:	75 2a                	jne    802182 <memmove+0x110>
+  802158:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80215c:	83 e0 03             	and    $0x3,%eax
+  80215f:	48 85 c0             	test   %rax,%rax
+  802162:	75 1e                	jne    802182 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802164:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802168:	48 c1 e8 02          	shr    $0x2,%rax
+  80216c:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  80216f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802173:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802177:	48 89 c7             	mov    %rax,%rdi
+  80217a:	48 89 d6             	mov    %rdx,%rsi
+  80217d:	fc                   	cld
+  80217e:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  802180:	eb 15                	jmp    802197 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  802182:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802186:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80218a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80218e:	48 89 c7             	mov    %rax,%rdi
+  802191:	48 89 d6             	mov    %rdx,%rsi
+  802194:	fc                   	cld
+  802195:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  802197:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80219b:	c9                   	leave
+  80219c:	c3                   	ret
+
+000000000080219d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80219d:	55                   	push   %rbp
+  80219e:	48 89 e5             	mov    %rsp,%rbp
+  8021a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8021a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021a5 <memcpy+0x8>
+  8021ac:	49 bb a3 7e 00 00 00 	movabs $0x7ea3,%r11
+  8021b3:	00 00 00 
+  8021b6:	4c 01 d8             	add    %r11,%rax
+  8021b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8021bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021c1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8021c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8021c9:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8021cd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8021d1:	48 89 cf             	mov    %rcx,%rdi
+  8021d4:	48 b9 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rcx
+  8021db:	ff ff ff 
+  8021de:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8021e2:	ff d0                	call   *%rax
+}
+  8021e4:	c9                   	leave
+  8021e5:	c3                   	ret
+
+00000000008021e6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8021e6:	55                   	push   %rbp
+  8021e7:	48 89 e5             	mov    %rsp,%rbp
+  8021ea:	48 83 ec 28          	sub    $0x28,%rsp
+  8021ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021ee <memcmp+0x8>
+  8021f5:	49 bb 5a 7e 00 00 00 	movabs $0x7e5a,%r11
+  8021fc:	00 00 00 
+  8021ff:	4c 01 d8             	add    %r11,%rax
+  802202:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802206:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80220a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80220e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802212:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  802216:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80221a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80221e:	eb 34                	jmp    802254 <memcmp+0x6e>
+		if (*s1 != *s2)
+  802220:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802224:	0f b6 10             	movzbl (%rax),%edx
+  802227:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80222b:	0f b6 00             	movzbl (%rax),%eax
+  80222e:	38 c2                	cmp    %al,%dl
+  802230:	74 18                	je     80224a <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  802232:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802236:	0f b6 00             	movzbl (%rax),%eax
+  802239:	0f b6 d0             	movzbl %al,%edx
+  80223c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802240:	0f b6 00             	movzbl (%rax),%eax
+  802243:	0f b6 c0             	movzbl %al,%eax
+  802246:	29 c2                	sub    %eax,%edx
+  802248:	eb 20                	jmp    80226a <memcmp+0x84>
+		s1++, s2++;
+  80224a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80224f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  802254:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802258:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80225c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802260:	48 85 c0             	test   %rax,%rax
+  802263:	75 bb                	jne    802220 <memcmp+0x3a>
+	}
+
+	return 0;
+  802265:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80226a:	89 d0                	mov    %edx,%eax
+  80226c:	c9                   	leave
+  80226d:	c3                   	ret
+
+000000000080226e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80226e:	55                   	push   %rbp
+  80226f:	48 89 e5             	mov    %rsp,%rbp
+  802272:	48 83 ec 28          	sub    $0x28,%rsp
+  802276:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802276 <memfind+0x8>
+  80227d:	49 bb d2 7d 00 00 00 	movabs $0x7dd2,%r11
+  802284:	00 00 00 
+  802287:	4c 01 d8             	add    %r11,%rax
+  80228a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80228e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  802291:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  802295:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802299:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80229d:	48 01 d0             	add    %rdx,%rax
+  8022a0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8022a4:	eb 13                	jmp    8022b9 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8022a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022aa:	0f b6 00             	movzbl (%rax),%eax
+  8022ad:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8022b0:	38 d0                	cmp    %dl,%al
+  8022b2:	74 11                	je     8022c5 <memfind+0x57>
+	for (; s < ends; s++)
+  8022b4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8022b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022bd:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8022c1:	72 e3                	jb     8022a6 <memfind+0x38>
+  8022c3:	eb 01                	jmp    8022c6 <memfind+0x58>
+			break;
+  8022c5:	90                   	nop
+	return (void *) s;
+  8022c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8022ca:	c9                   	leave
+  8022cb:	c3                   	ret
+
+00000000008022cc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8022cc:	55                   	push   %rbp
+  8022cd:	48 89 e5             	mov    %rsp,%rbp
+  8022d0:	48 83 ec 38          	sub    $0x38,%rsp
+  8022d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d4 <strtol+0x8>
+  8022db:	49 bb 74 7d 00 00 00 	movabs $0x7d74,%r11
+  8022e2:	00 00 00 
+  8022e5:	4c 01 d8             	add    %r11,%rax
+  8022e8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8022ec:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8022f0:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8022f3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8022fa:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802301:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802302:	eb 05                	jmp    802309 <strtol+0x3d>
+		s++;
+  802304:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  802309:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80230d:	0f b6 00             	movzbl (%rax),%eax
+  802310:	3c 20                	cmp    $0x20,%al
+  802312:	74 f0                	je     802304 <strtol+0x38>
+  802314:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802318:	0f b6 00             	movzbl (%rax),%eax
+  80231b:	3c 09                	cmp    $0x9,%al
+  80231d:	74 e5                	je     802304 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  80231f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802323:	0f b6 00             	movzbl (%rax),%eax
+  802326:	3c 2b                	cmp    $0x2b,%al
+  802328:	75 07                	jne    802331 <strtol+0x65>
+		s++;
+  80232a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80232f:	eb 17                	jmp    802348 <strtol+0x7c>
+	else if (*s == '-')
+  802331:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802335:	0f b6 00             	movzbl (%rax),%eax
+  802338:	3c 2d                	cmp    $0x2d,%al
+  80233a:	75 0c                	jne    802348 <strtol+0x7c>
+		s++, neg = 1;
+  80233c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802341:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802348:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80234c:	74 06                	je     802354 <strtol+0x88>
+  80234e:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802352:	75 28                	jne    80237c <strtol+0xb0>
+  802354:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802358:	0f b6 00             	movzbl (%rax),%eax
+  80235b:	3c 30                	cmp    $0x30,%al
+  80235d:	75 1d                	jne    80237c <strtol+0xb0>
+  80235f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802363:	48 83 c0 01          	add    $0x1,%rax
+  802367:	0f b6 00             	movzbl (%rax),%eax
+  80236a:	3c 78                	cmp    $0x78,%al
+  80236c:	75 0e                	jne    80237c <strtol+0xb0>
+		s += 2, base = 16;
+  80236e:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802373:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80237a:	eb 2c                	jmp    8023a8 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  80237c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802380:	75 19                	jne    80239b <strtol+0xcf>
+  802382:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802386:	0f b6 00             	movzbl (%rax),%eax
+  802389:	3c 30                	cmp    $0x30,%al
+  80238b:	75 0e                	jne    80239b <strtol+0xcf>
+		s++, base = 8;
+  80238d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802392:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802399:	eb 0d                	jmp    8023a8 <strtol+0xdc>
+	else if (base == 0)
+  80239b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80239f:	75 07                	jne    8023a8 <strtol+0xdc>
+		base = 10;
+  8023a1:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8023a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023ac:	0f b6 00             	movzbl (%rax),%eax
+  8023af:	3c 2f                	cmp    $0x2f,%al
+  8023b1:	7e 1d                	jle    8023d0 <strtol+0x104>
+  8023b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023b7:	0f b6 00             	movzbl (%rax),%eax
+  8023ba:	3c 39                	cmp    $0x39,%al
+  8023bc:	7f 12                	jg     8023d0 <strtol+0x104>
+			dig = *s - '0';
+  8023be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023c2:	0f b6 00             	movzbl (%rax),%eax
+  8023c5:	0f be c0             	movsbl %al,%eax
+  8023c8:	83 e8 30             	sub    $0x30,%eax
+  8023cb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8023ce:	eb 4e                	jmp    80241e <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  8023d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023d4:	0f b6 00             	movzbl (%rax),%eax
+  8023d7:	3c 60                	cmp    $0x60,%al
+  8023d9:	7e 1d                	jle    8023f8 <strtol+0x12c>
+  8023db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023df:	0f b6 00             	movzbl (%rax),%eax
+  8023e2:	3c 7a                	cmp    $0x7a,%al
+  8023e4:	7f 12                	jg     8023f8 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  8023e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023ea:	0f b6 00             	movzbl (%rax),%eax
+  8023ed:	0f be c0             	movsbl %al,%eax
+  8023f0:	83 e8 57             	sub    $0x57,%eax
+  8023f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8023f6:	eb 26                	jmp    80241e <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  8023f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023fc:	0f b6 00             	movzbl (%rax),%eax
+  8023ff:	3c 40                	cmp    $0x40,%al
+  802401:	7e 47                	jle    80244a <strtol+0x17e>
+  802403:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802407:	0f b6 00             	movzbl (%rax),%eax
+  80240a:	3c 5a                	cmp    $0x5a,%al
+  80240c:	7f 3c                	jg     80244a <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  80240e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802412:	0f b6 00             	movzbl (%rax),%eax
+  802415:	0f be c0             	movsbl %al,%eax
+  802418:	83 e8 37             	sub    $0x37,%eax
+  80241b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80241e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802421:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802424:	7d 23                	jge    802449 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  802426:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80242b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80242e:	48 98                	cltq
+  802430:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802435:	48 89 c2             	mov    %rax,%rdx
+  802438:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80243b:	48 98                	cltq
+  80243d:	48 01 d0             	add    %rdx,%rax
+  802440:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  802444:	e9 5f ff ff ff       	jmp    8023a8 <strtol+0xdc>
+			break;
+  802449:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80244a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80244f:	74 0b                	je     80245c <strtol+0x190>
+		*endptr = (char *) s;
+  802451:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802455:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802459:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  80245c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802460:	74 09                	je     80246b <strtol+0x19f>
+  802462:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802466:	48 f7 d8             	neg    %rax
+  802469:	eb 04                	jmp    80246f <strtol+0x1a3>
+  80246b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80246f:	c9                   	leave
+  802470:	c3                   	ret
+
+0000000000802471 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  802471:	55                   	push   %rbp
+  802472:	48 89 e5             	mov    %rsp,%rbp
+  802475:	53                   	push   %rbx
+  802476:	48 83 ec 30          	sub    $0x30,%rsp
+  80247a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80247a <strstr+0x9>
+  802481:	49 bb ce 7b 00 00 00 	movabs $0x7bce,%r11
+  802488:	00 00 00 
+  80248b:	4c 01 db             	add    %r11,%rbx
+  80248e:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  802492:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  802496:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80249a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80249e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8024a2:	0f b6 00             	movzbl (%rax),%eax
+  8024a5:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  8024a8:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  8024ac:	75 06                	jne    8024b4 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  8024ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024b2:	eb 73                	jmp    802527 <strstr+0xb6>
+
+	len = strlen(str);
+  8024b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024b8:	48 89 c7             	mov    %rax,%rdi
+  8024bb:	48 b8 b6 7b ff ff ff 	movabs $0xffffffffffff7bb6,%rax
+  8024c2:	ff ff ff 
+  8024c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8024c9:	ff d0                	call   *%rax
+  8024cb:	48 98                	cltq
+  8024cd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  8024d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8024d5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8024d9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8024dd:	0f b6 00             	movzbl (%rax),%eax
+  8024e0:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  8024e3:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  8024e7:	75 07                	jne    8024f0 <strstr+0x7f>
+				return (char *) 0;
+  8024e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ee:	eb 37                	jmp    802527 <strstr+0xb6>
+		} while (sc != c);
+  8024f0:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  8024f4:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  8024f7:	75 d8                	jne    8024d1 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  8024f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8024fd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802501:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802505:	48 89 ce             	mov    %rcx,%rsi
+  802508:	48 89 c7             	mov    %rax,%rdi
+  80250b:	48 b8 6a 7e ff ff ff 	movabs $0xffffffffffff7e6a,%rax
+  802512:	ff ff ff 
+  802515:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802519:	ff d0                	call   *%rax
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	75 b2                	jne    8024d1 <strstr+0x60>
+
+	return (char *) (in - 1);
+  80251f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802523:	48 83 e8 01          	sub    $0x1,%rax
+}
+  802527:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80252b:	c9                   	leave
+  80252c:	c3                   	ret
+
+000000000080252d <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  80252d:	55                   	push   %rbp
+  80252e:	48 89 e5             	mov    %rsp,%rbp
+  802531:	41 57                	push   %r15
+  802533:	53                   	push   %rbx
+  802534:	48 83 ec 40          	sub    $0x40,%rsp
+  802538:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 802538 <syscall+0xb>
+  80253f:	49 bb 10 7b 00 00 00 	movabs $0x7b10,%r11
+  802546:	00 00 00 
+  802549:	4d 01 da             	add    %r11,%r10
+  80254c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80254f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  802552:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  802556:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80255a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80255e:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  802562:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802565:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802569:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80256d:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  802571:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802575:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802579:	4c 89 c3             	mov    %r8,%rbx
+  80257c:	cd 30                	int    $0x30
+  80257e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  802582:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  802586:	74 52                	je     8025da <syscall+0xad>
+  802588:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80258d:	7e 4b                	jle    8025da <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80258f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802593:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802596:	49 89 d0             	mov    %rdx,%r8
+  802599:	89 c1                	mov    %eax,%ecx
+  80259b:	48 b8 28 e0 ff ff ff 	movabs $0xffffffffffffe028,%rax
+  8025a2:	ff ff ff 
+  8025a5:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8025a9:	48 89 c2             	mov    %rax,%rdx
+  8025ac:	be 23 00 00 00       	mov    $0x23,%esi
+  8025b1:	48 b8 45 e0 ff ff ff 	movabs $0xffffffffffffe045,%rax
+  8025b8:	ff ff ff 
+  8025bb:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8025bf:	48 89 c7             	mov    %rax,%rdi
+  8025c2:	4d 89 d7             	mov    %r10,%r15
+  8025c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ca:	49 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r9
+  8025d1:	ff ff ff 
+  8025d4:	4d 01 d1             	add    %r10,%r9
+  8025d7:	41 ff d1             	call   *%r9
+
+	return ret;
+  8025da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8025de:	48 83 c4 40          	add    $0x40,%rsp
+  8025e2:	5b                   	pop    %rbx
+  8025e3:	41 5f                	pop    %r15
+  8025e5:	5d                   	pop    %rbp
+  8025e6:	c3                   	ret
+
+00000000008025e7 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  8025e7:	55                   	push   %rbp
+  8025e8:	48 89 e5             	mov    %rsp,%rbp
+  8025eb:	41 57                	push   %r15
+  8025ed:	41 56                	push   %r14
+  8025ef:	41 55                	push   %r13
+  8025f1:	41 54                	push   %r12
+  8025f3:	53                   	push   %rbx
+  8025f4:	48 83 ec 48          	sub    $0x48,%rsp
+  8025f8:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 8025f8 <syscall_words+0x11>
+  8025ff:	49 bb 50 7a 00 00 00 	movabs $0x7a50,%r11
+  802606:	00 00 00 
+  802609:	4d 01 de             	add    %r11,%r14
+  80260c:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80260f:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  802612:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802616:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80261a:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  80261e:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  802622:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802627:	74 09                	je     802632 <syscall_words+0x4b>
+  802629:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80262d:	48 8b 00             	mov    (%rax),%rax
+  802630:	eb 05                	jmp    802637 <syscall_words+0x50>
+  802632:	b8 00 00 00 00       	mov    $0x0,%eax
+  802637:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  80263a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80263f:	74 0a                	je     80264b <syscall_words+0x64>
+  802641:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802645:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802649:	eb 05                	jmp    802650 <syscall_words+0x69>
+  80264b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802650:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  802653:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802658:	74 0a                	je     802664 <syscall_words+0x7d>
+  80265a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80265e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802662:	eb 05                	jmp    802669 <syscall_words+0x82>
+  802664:	b8 00 00 00 00       	mov    $0x0,%eax
+  802669:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  80266c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802671:	74 0a                	je     80267d <syscall_words+0x96>
+  802673:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802677:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80267b:	eb 05                	jmp    802682 <syscall_words+0x9b>
+  80267d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802682:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  802685:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80268a:	74 0a                	je     802696 <syscall_words+0xaf>
+  80268c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802690:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802694:	eb 05                	jmp    80269b <syscall_words+0xb4>
+  802696:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269b:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  80269e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8026a3:	74 0a                	je     8026af <syscall_words+0xc8>
+  8026a5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8026a9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8026ad:	eb 05                	jmp    8026b4 <syscall_words+0xcd>
+  8026af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b4:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  8026b7:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8026ba:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8026be:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8026c2:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  8026c6:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8026ca:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8026ce:	cd 30                	int    $0x30
+  8026d0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  8026d4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8026d9:	74 50                	je     80272b <syscall_words+0x144>
+		words[0] = r8;
+  8026db:	4c 89 c2             	mov    %r8,%rdx
+  8026de:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8026e2:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  8026e5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8026e9:	48 83 c0 08          	add    $0x8,%rax
+  8026ed:	4c 89 ca             	mov    %r9,%rdx
+  8026f0:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  8026f3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8026f7:	48 83 c0 10          	add    $0x10,%rax
+  8026fb:	4c 89 d2             	mov    %r10,%rdx
+  8026fe:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  802701:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802705:	48 83 c0 18          	add    $0x18,%rax
+  802709:	4c 89 da             	mov    %r11,%rdx
+  80270c:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80270f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802713:	48 83 c0 20          	add    $0x20,%rax
+  802717:	4c 89 e2             	mov    %r12,%rdx
+  80271a:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80271d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802721:	48 83 c0 28          	add    $0x28,%rax
+  802725:	4c 89 ea             	mov    %r13,%rdx
+  802728:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  80272b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80272f:	74 52                	je     802783 <syscall_words+0x19c>
+  802731:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802736:	7e 4b                	jle    802783 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802738:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80273c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80273f:	49 89 d0             	mov    %rdx,%r8
+  802742:	89 c1                	mov    %eax,%ecx
+  802744:	48 b8 28 e0 ff ff ff 	movabs $0xffffffffffffe028,%rax
+  80274b:	ff ff ff 
+  80274e:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802752:	48 89 c2             	mov    %rax,%rdx
+  802755:	be 4e 00 00 00       	mov    $0x4e,%esi
+  80275a:	48 b8 45 e0 ff ff ff 	movabs $0xffffffffffffe045,%rax
+  802761:	ff ff ff 
+  802764:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802768:	48 89 c7             	mov    %rax,%rdi
+  80276b:	4d 89 f7             	mov    %r14,%r15
+  80276e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802773:	49 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r9
+  80277a:	ff ff ff 
+  80277d:	4d 01 f1             	add    %r14,%r9
+  802780:	41 ff d1             	call   *%r9
+
+	return ret;
+  802783:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802787:	48 83 c4 48          	add    $0x48,%rsp
+  80278b:	5b                   	pop    %rbx
+  80278c:	41 5c                	pop    %r12
+  80278e:	41 5d                	pop    %r13
+  802790:	41 5e                	pop    %r14
+  802792:	41 5f                	pop    %r15
+  802794:	5d                   	pop    %rbp
+  802795:	c3                   	ret
+
+0000000000802796 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802796:	55                   	push   %rbp
+  802797:	48 89 e5             	mov    %rsp,%rbp
+  80279a:	48 83 ec 10          	sub    $0x10,%rsp
+  80279e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80279e <sys_cputs+0x8>
+  8027a5:	49 bb aa 78 00 00 00 	movabs $0x78aa,%r11
+  8027ac:	00 00 00 
+  8027af:	4c 01 d8             	add    %r11,%rax
+  8027b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027b6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8027ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027be:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c6:	6a 00                	push   $0x0
+  8027c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027de:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  8027e5:	ff ff ff 
+  8027e8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027ec:	ff d0                	call   *%rax
+  8027ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027f2:	90                   	nop
+  8027f3:	c9                   	leave
+  8027f4:	c3                   	ret
+
+00000000008027f5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8027f5:	55                   	push   %rbp
+  8027f6:	48 89 e5             	mov    %rsp,%rbp
+  8027f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027f9 <sys_cgetc+0x4>
+  802800:	49 bb 4f 78 00 00 00 	movabs $0x784f,%r11
+  802807:	00 00 00 
+  80280a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80280d:	48 83 ec 08          	sub    $0x8,%rsp
+  802811:	6a 00                	push   $0x0
+  802813:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802819:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80281f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802824:	ba 00 00 00 00       	mov    $0x0,%edx
+  802829:	be 00 00 00 00       	mov    $0x0,%esi
+  80282e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802833:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  80283a:	ff ff ff 
+  80283d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802841:	ff d0                	call   *%rax
+  802843:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802847:	c9                   	leave
+  802848:	c3                   	ret
+
+0000000000802849 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802849:	55                   	push   %rbp
+  80284a:	48 89 e5             	mov    %rsp,%rbp
+  80284d:	48 83 ec 10          	sub    $0x10,%rsp
+  802851:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802851 <sys_env_destroy+0x8>
+  802858:	49 bb f7 77 00 00 00 	movabs $0x77f7,%r11
+  80285f:	00 00 00 
+  802862:	4c 01 d8             	add    %r11,%rax
+  802865:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802868:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80286b:	48 63 d2             	movslq %edx,%rdx
+  80286e:	48 83 ec 08          	sub    $0x8,%rsp
+  802872:	6a 00                	push   $0x0
+  802874:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80287a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802880:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802885:	be 01 00 00 00       	mov    $0x1,%esi
+  80288a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80288f:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802896:	ff ff ff 
+  802899:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80289d:	ff d0                	call   *%rax
+  80289f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028a3:	c9                   	leave
+  8028a4:	c3                   	ret
+
+00000000008028a5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8028a5:	55                   	push   %rbp
+  8028a6:	48 89 e5             	mov    %rsp,%rbp
+  8028a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028a9 <sys_getenvid+0x4>
+  8028b0:	49 bb 9f 77 00 00 00 	movabs $0x779f,%r11
+  8028b7:	00 00 00 
+  8028ba:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8028bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c1:	6a 00                	push   $0x0
+  8028c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028de:	bf 02 00 00 00       	mov    $0x2,%edi
+  8028e3:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  8028ea:	ff ff ff 
+  8028ed:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028f1:	ff d0                	call   *%rax
+  8028f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028f7:	c9                   	leave
+  8028f8:	c3                   	ret
+
+00000000008028f9 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8028f9:	55                   	push   %rbp
+  8028fa:	48 89 e5             	mov    %rsp,%rbp
+  8028fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028fd <sys_yield+0x4>
+  802904:	49 bb 4b 77 00 00 00 	movabs $0x774b,%r11
+  80290b:	00 00 00 
+  80290e:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802911:	48 83 ec 08          	sub    $0x8,%rsp
+  802915:	6a 00                	push   $0x0
+  802917:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802923:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802928:	ba 00 00 00 00       	mov    $0x0,%edx
+  80292d:	be 00 00 00 00       	mov    $0x0,%esi
+  802932:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802937:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  80293e:	ff ff ff 
+  802941:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802945:	ff d0                	call   *%rax
+  802947:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80294b:	90                   	nop
+  80294c:	c9                   	leave
+  80294d:	c3                   	ret
+
+000000000080294e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80294e:	55                   	push   %rbp
+  80294f:	48 89 e5             	mov    %rsp,%rbp
+  802952:	48 83 ec 10          	sub    $0x10,%rsp
+  802956:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802956 <sys_page_alloc+0x8>
+  80295d:	49 bb f2 76 00 00 00 	movabs $0x76f2,%r11
+  802964:	00 00 00 
+  802967:	4c 01 d8             	add    %r11,%rax
+  80296a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80296d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802971:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802974:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802977:	48 63 f2             	movslq %edx,%rsi
+  80297a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80297e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802981:	48 63 d2             	movslq %edx,%rdx
+  802984:	48 83 ec 08          	sub    $0x8,%rsp
+  802988:	6a 00                	push   $0x0
+  80298a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802990:	49 89 f0             	mov    %rsi,%r8
+  802993:	be 01 00 00 00       	mov    $0x1,%esi
+  802998:	bf 04 00 00 00       	mov    $0x4,%edi
+  80299d:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  8029a4:	ff ff ff 
+  8029a7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029ab:	ff d0                	call   *%rax
+  8029ad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029b1:	c9                   	leave
+  8029b2:	c3                   	ret
+
+00000000008029b3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8029b3:	55                   	push   %rbp
+  8029b4:	48 89 e5             	mov    %rsp,%rbp
+  8029b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8029bb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029bb <sys_page_map+0x8>
+  8029c2:	49 bb 8d 76 00 00 00 	movabs $0x768d,%r11
+  8029c9:	00 00 00 
+  8029cc:	4c 01 d8             	add    %r11,%rax
+  8029cf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029d6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8029d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8029dd:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8029e1:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8029e4:	48 63 f2             	movslq %edx,%rsi
+  8029e7:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8029eb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8029ee:	48 63 fa             	movslq %edx,%rdi
+  8029f1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029f5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029f8:	48 63 d2             	movslq %edx,%rdx
+  8029fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ff:	56                   	push   %rsi
+  802a00:	4d 89 c1             	mov    %r8,%r9
+  802a03:	49 89 f8             	mov    %rdi,%r8
+  802a06:	be 01 00 00 00       	mov    $0x1,%esi
+  802a0b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a10:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802a17:	ff ff ff 
+  802a1a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a1e:	ff d0                	call   *%rax
+  802a20:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a24:	c9                   	leave
+  802a25:	c3                   	ret
+
+0000000000802a26 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802a26:	55                   	push   %rbp
+  802a27:	48 89 e5             	mov    %rsp,%rbp
+  802a2a:	48 83 ec 10          	sub    $0x10,%rsp
+  802a2e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a2e <sys_page_unmap+0x8>
+  802a35:	49 bb 1a 76 00 00 00 	movabs $0x761a,%r11
+  802a3c:	00 00 00 
+  802a3f:	4c 01 d8             	add    %r11,%rax
+  802a42:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802a49:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a4d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a50:	48 63 d2             	movslq %edx,%rdx
+  802a53:	48 83 ec 08          	sub    $0x8,%rsp
+  802a57:	6a 00                	push   $0x0
+  802a59:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a65:	be 01 00 00 00       	mov    $0x1,%esi
+  802a6a:	bf 06 00 00 00       	mov    $0x6,%edi
+  802a6f:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802a76:	ff ff ff 
+  802a79:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a7d:	ff d0                	call   *%rax
+  802a7f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+
+0000000000802a85 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802a85:	55                   	push   %rbp
+  802a86:	48 89 e5             	mov    %rsp,%rbp
+  802a89:	48 83 ec 10          	sub    $0x10,%rsp
+  802a8d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a8d <sys_env_set_status+0x8>
+  802a94:	49 bb bb 75 00 00 00 	movabs $0x75bb,%r11
+  802a9b:	00 00 00 
+  802a9e:	4c 01 d8             	add    %r11,%rax
+  802aa1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802aa4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802aa7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802aaa:	48 63 ca             	movslq %edx,%rcx
+  802aad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802ab0:	48 63 d2             	movslq %edx,%rdx
+  802ab3:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab7:	6a 00                	push   $0x0
+  802ab9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802abf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ac5:	be 01 00 00 00       	mov    $0x1,%esi
+  802aca:	bf 08 00 00 00       	mov    $0x8,%edi
+  802acf:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802ad6:	ff ff ff 
+  802ad9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802add:	ff d0                	call   *%rax
+  802adf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ae3:	c9                   	leave
+  802ae4:	c3                   	ret
+
+0000000000802ae5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802ae5:	55                   	push   %rbp
+  802ae6:	48 89 e5             	mov    %rsp,%rbp
+  802ae9:	48 83 ec 10          	sub    $0x10,%rsp
+  802aed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802aed <sys_env_set_trapframe+0x8>
+  802af4:	49 bb 5b 75 00 00 00 	movabs $0x755b,%r11
+  802afb:	00 00 00 
+  802afe:	4c 01 d8             	add    %r11,%rax
+  802b01:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b04:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802b08:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802b0c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b0f:	48 63 d2             	movslq %edx,%rdx
+  802b12:	48 83 ec 08          	sub    $0x8,%rsp
+  802b16:	6a 00                	push   $0x0
+  802b18:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b24:	be 01 00 00 00       	mov    $0x1,%esi
+  802b29:	bf 09 00 00 00       	mov    $0x9,%edi
+  802b2e:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802b35:	ff ff ff 
+  802b38:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b3c:	ff d0                	call   *%rax
+  802b3e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b42:	c9                   	leave
+  802b43:	c3                   	ret
+
+0000000000802b44 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802b44:	55                   	push   %rbp
+  802b45:	48 89 e5             	mov    %rsp,%rbp
+  802b48:	48 83 ec 10          	sub    $0x10,%rsp
+  802b4c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b4c <sys_env_set_pgfault_upcall+0x8>
+  802b53:	49 bb fc 74 00 00 00 	movabs $0x74fc,%r11
+  802b5a:	00 00 00 
+  802b5d:	4c 01 d8             	add    %r11,%rax
+  802b60:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b63:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802b67:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802b6b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b6e:	48 63 d2             	movslq %edx,%rdx
+  802b71:	48 83 ec 08          	sub    $0x8,%rsp
+  802b75:	6a 00                	push   $0x0
+  802b77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b83:	be 01 00 00 00       	mov    $0x1,%esi
+  802b88:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802b8d:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802b94:	ff ff ff 
+  802b97:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b9b:	ff d0                	call   *%rax
+  802b9d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ba1:	c9                   	leave
+  802ba2:	c3                   	ret
+
+0000000000802ba3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802ba3:	55                   	push   %rbp
+  802ba4:	48 89 e5             	mov    %rsp,%rbp
+  802ba7:	48 83 ec 20          	sub    $0x20,%rsp
+  802bab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802bab <sys_ipc_try_send+0x8>
+  802bb2:	49 bb 9d 74 00 00 00 	movabs $0x749d,%r11
+  802bb9:	00 00 00 
+  802bbc:	4c 01 d8             	add    %r11,%rax
+  802bbf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802bc2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802bc6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802bca:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802bcd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802bd0:	48 63 fa             	movslq %edx,%rdi
+  802bd3:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802bd7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802bda:	48 63 d2             	movslq %edx,%rdx
+  802bdd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802be1:	48 83 ec 08          	sub    $0x8,%rsp
+  802be5:	6a 00                	push   $0x0
+  802be7:	49 89 f9             	mov    %rdi,%r9
+  802bea:	49 89 f0             	mov    %rsi,%r8
+  802bed:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf2:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802bf7:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802bfe:	ff ff ff 
+  802c01:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c05:	ff d0                	call   *%rax
+  802c07:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c0b:	c9                   	leave
+  802c0c:	c3                   	ret
+
+0000000000802c0d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802c0d:	55                   	push   %rbp
+  802c0e:	48 89 e5             	mov    %rsp,%rbp
+  802c11:	48 83 ec 20          	sub    $0x20,%rsp
+  802c15:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c15 <sys_ipc_send+0x8>
+  802c1c:	49 bb 33 74 00 00 00 	movabs $0x7433,%r11
+  802c23:	00 00 00 
+  802c26:	4c 01 d8             	add    %r11,%rax
+  802c29:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c2c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802c30:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802c34:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802c37:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802c3a:	48 63 fa             	movslq %edx,%rdi
+  802c3d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802c41:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802c44:	48 63 d2             	movslq %edx,%rdx
+  802c47:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802c4b:	48 83 ec 08          	sub    $0x8,%rsp
+  802c4f:	6a 00                	push   $0x0
+  802c51:	49 89 f9             	mov    %rdi,%r9
+  802c54:	49 89 f0             	mov    %rsi,%r8
+  802c57:	be 00 00 00 00       	mov    $0x0,%esi
+  802c5c:	bf 17 00 00 00       	mov    $0x17,%edi
+  802c61:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802c68:	ff ff ff 
+  802c6b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c6f:	ff d0                	call   *%rax
+  802c71:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c75:	c9                   	leave
+  802c76:	c3                   	ret
+
+0000000000802c77 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802c77:	55                   	push   %rbp
+  802c78:	48 89 e5             	mov    %rsp,%rbp
+  802c7b:	48 83 ec 10          	sub    $0x10,%rsp
+  802c7f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c7f <sys_ipc_recv+0x8>
+  802c86:	49 bb c9 73 00 00 00 	movabs $0x73c9,%r11
+  802c8d:	00 00 00 
+  802c90:	4c 01 d8             	add    %r11,%rax
+  802c93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802c97:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c9b:	6a 00                	push   $0x0
+  802c9d:	6a 00                	push   $0x0
+  802c9f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ca5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cb0:	be 01 00 00 00       	mov    $0x1,%esi
+  802cb5:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802cba:	49 ba 9f 85 ff ff ff 	movabs $0xffffffffffff859f,%r10
+  802cc1:	ff ff ff 
+  802cc4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802cc8:	ff d0                	call   *%rax
+  802cca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cce:	c9                   	leave
+  802ccf:	c3                   	ret
+
+0000000000802cd0 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802cd0:	55                   	push   %rbp
+  802cd1:	48 89 e5             	mov    %rsp,%rbp
+  802cd4:	48 83 ec 30          	sub    $0x30,%rsp
+  802cd8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802cd8 <sys_ipc_call+0x8>
+  802cdf:	49 bb 70 73 00 00 00 	movabs $0x7370,%r11
+  802ce6:	00 00 00 
+  802ce9:	4c 01 d8             	add    %r11,%rax
+  802cec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802cef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802cf3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802cf7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802cfa:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802cfe:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802d02:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802d06:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802d09:	4c 63 c2             	movslq %edx,%r8
+  802d0c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802d10:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802d13:	48 63 d2             	movslq %edx,%rdx
+  802d16:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802d1a:	ff 75 d8             	push   -0x28(%rbp)
+  802d1d:	56                   	push   %rsi
+  802d1e:	4d 89 c1             	mov    %r8,%r9
+  802d21:	49 89 f8             	mov    %rdi,%r8
+  802d24:	be 00 00 00 00       	mov    $0x0,%esi
+  802d29:	bf 18 00 00 00       	mov    $0x18,%edi
+  802d2e:	49 ba 9f 85 ff ff ff 	movabs $0xffffffffffff859f,%r10
+  802d35:	ff ff ff 
+  802d38:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d3c:	ff d0                	call   *%rax
+  802d3e:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802d42:	c9                   	leave
+  802d43:	c3                   	ret
+
+0000000000802d44 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802d44:	55                   	push   %rbp
+  802d45:	48 89 e5             	mov    %rsp,%rbp
+  802d48:	48 83 ec 30          	sub    $0x30,%rsp
+  802d4c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d4c <sys_ipc_reply_recv+0x8>
+  802d53:	49 bb fc 72 00 00 00 	movabs $0x72fc,%r11
+  802d5a:	00 00 00 
+  802d5d:	4c 01 d8             	add    %r11,%rax
+  802d60:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802d63:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d67:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802d6b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802d6e:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802d72:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802d76:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802d7a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802d7d:	4c 63 c2             	movslq %edx,%r8
+  802d80:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802d84:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802d87:	48 63 d2             	movslq %edx,%rdx
+  802d8a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802d8e:	ff 75 d8             	push   -0x28(%rbp)
+  802d91:	56                   	push   %rsi
+  802d92:	4d 89 c1             	mov    %r8,%r9
+  802d95:	49 89 f8             	mov    %rdi,%r8
+  802d98:	be 00 00 00 00       	mov    $0x0,%esi
+  802d9d:	bf 19 00 00 00       	mov    $0x19,%edi
+  802da2:	49 ba 9f 85 ff ff ff 	movabs $0xffffffffffff859f,%r10
+  802da9:	ff ff ff 
+  802dac:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802db0:	ff d0                	call   *%rax
+  802db2:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802db6:	c9                   	leave
+  802db7:	c3                   	ret
+
+0000000000802db8 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802db8:	55                   	push   %rbp
+  802db9:	48 89 e5             	mov    %rsp,%rbp
+  802dbc:	48 83 ec 10          	sub    $0x10,%rsp
+  802dc0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802dc0 <sys_env_set_priority+0x8>
+  802dc7:	49 bb 88 72 00 00 00 	movabs $0x7288,%r11
+  802dce:	00 00 00 
+  802dd1:	4c 01 d8             	add    %r11,%rax
+  802dd4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802dd7:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802dda:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802ddd:	48 63 ca             	movslq %edx,%rcx
+  802de0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802de3:	48 63 d2             	movslq %edx,%rdx
+  802de6:	48 83 ec 08          	sub    $0x8,%rsp
+  802dea:	6a 00                	push   $0x0
+  802dec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802df2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802df8:	be 01 00 00 00       	mov    $0x1,%esi
+  802dfd:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802e02:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802e09:	ff ff ff 
+  802e0c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e10:	ff d0                	call   *%rax
+  802e12:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e16:	c9                   	leave
+  802e17:	c3                   	ret
+
+0000000000802e18 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802e18:	55                   	push   %rbp
+  802e19:	48 89 e5             	mov    %rsp,%rbp
+  802e1c:	48 83 ec 10          	sub    $0x10,%rsp
+  802e20:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e20 <sys_env_set_affinity+0x8>
+  802e27:	49 bb 28 72 00 00 00 	movabs $0x7228,%r11
+  802e2e:	00 00 00 
+  802e31:	4c 01 d8             	add    %r11,%rax
+  802e34:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802e37:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802e3a:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802e3d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802e40:	48 63 d2             	movslq %edx,%rdx
+  802e43:	48 83 ec 08          	sub    $0x8,%rsp
+  802e47:	6a 00                	push   $0x0
+  802e49:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e55:	be 01 00 00 00       	mov    $0x1,%esi
+  802e5a:	bf 10 00 00 00       	mov    $0x10,%edi
+  802e5f:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802e66:	ff ff ff 
+  802e69:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e6d:	ff d0                	call   *%rax
+  802e6f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e73:	c9                   	leave
+  802e74:	c3                   	ret
+
+0000000000802e75 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802e75:	55                   	push   %rbp
+  802e76:	48 89 e5             	mov    %rsp,%rbp
+  802e79:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e79 <sys_time_msec+0x4>
+  802e80:	49 bb cf 71 00 00 00 	movabs $0x71cf,%r11
+  802e87:	00 00 00 
+  802e8a:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802e8d:	48 83 ec 08          	sub    $0x8,%rsp
+  802e91:	6a 00                	push   $0x0
+  802e93:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e99:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e9f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ea4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea9:	be 00 00 00 00       	mov    $0x0,%esi
+  802eae:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802eb3:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802eba:	ff ff ff 
+  802ebd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802ec1:	ff d0                	call   *%rax
+  802ec3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ec7:	c9                   	leave
+  802ec8:	c3                   	ret
+
+0000000000802ec9 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802ec9:	55                   	push   %rbp
+  802eca:	48 89 e5             	mov    %rsp,%rbp
+  802ecd:	48 83 ec 10          	sub    $0x10,%rsp
+  802ed1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ed1 <sys_sleep_usec+0x8>
+  802ed8:	49 bb 77 71 00 00 00 	movabs $0x7177,%r11
+  802edf:	00 00 00 
+  802ee2:	4c 01 d8             	add    %r11,%rax
+  802ee5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802ee9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802eed:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef1:	6a 00                	push   $0x0
+  802ef3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ef9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802eff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f04:	be 00 00 00 00       	mov    $0x0,%esi
+  802f09:	bf 11 00 00 00       	mov    $0x11,%edi
+  802f0e:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802f15:	ff ff ff 
+  802f18:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f1c:	ff d0                	call   *%rax
+  802f1e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f22:	c9                   	leave
+  802f23:	c3                   	ret
+
+0000000000802f24 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802f24:	55                   	push   %rbp
+  802f25:	48 89 e5             	mov    %rsp,%rbp
+  802f28:	48 83 ec 10          	sub    $0x10,%rsp
+  802f2c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f2c <sys_page_alloc_huge+0x8>
+  802f33:	49 bb 1c 71 00 00 00 	movabs $0x711c,%r11
+  802f3a:	00 00 00 
+  802f3d:	4c 01 d8             	add    %r11,%rax
+  802f40:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802f43:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802f47:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802f4a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802f4d:	48 63 f2             	movslq %edx,%rsi
+  802f50:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802f54:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802f57:	48 63 d2             	movslq %edx,%rdx
+  802f5a:	48 83 ec 08          	sub    $0x8,%rsp
+  802f5e:	6a 00                	push   $0x0
+  802f60:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f66:	49 89 f0             	mov    %rsi,%r8
+  802f69:	be 01 00 00 00       	mov    $0x1,%esi
+  802f6e:	bf 12 00 00 00       	mov    $0x12,%edi
+  802f73:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802f7a:	ff ff ff 
+  802f7d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f81:	ff d0                	call   *%rax
+  802f83:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f87:	c9                   	leave
+  802f88:	c3                   	ret
+
+0000000000802f89 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802f89:	55                   	push   %rbp
+  802f8a:	48 89 e5             	mov    %rsp,%rbp
+  802f8d:	48 83 ec 10          	sub    $0x10,%rsp
+  802f91:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f91 <sys_page_map_batch+0x8>
+  802f98:	49 bb b7 70 00 00 00 	movabs $0x70b7,%r11
+  802f9f:	00 00 00 
+  802fa2:	4c 01 d8             	add    %r11,%rax
+  802fa5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802fa9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802fad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802fb1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802fb5:	48 83 ec 08          	sub    $0x8,%rsp
+  802fb9:	6a 00                	push   $0x0
+  802fbb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802fc1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fc7:	be 01 00 00 00       	mov    $0x1,%esi
+  802fcc:	bf 13 00 00 00       	mov    $0x13,%edi
+  802fd1:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  802fd8:	ff ff ff 
+  802fdb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802fdf:	ff d0                	call   *%rax
+  802fe1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802fe5:	c9                   	leave
+  802fe6:	c3                   	ret
+
+0000000000802fe7 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802fe7:	55                   	push   %rbp
+  802fe8:	48 89 e5             	mov    %rsp,%rbp
+  802feb:	48 83 ec 10          	sub    $0x10,%rsp
+  802fef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802fef <sys_page_alloc_batch+0x8>
+  802ff6:	49 bb 59 70 00 00 00 	movabs $0x7059,%r11
+  802ffd:	00 00 00 
+  803000:	4c 01 d8             	add    %r11,%rax
+  803003:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803007:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80300b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80300f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803013:	48 83 ec 08          	sub    $0x8,%rsp
+  803017:	6a 00                	push   $0x0
+  803019:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80301f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803025:	be 01 00 00 00       	mov    $0x1,%esi
+  80302a:	bf 14 00 00 00       	mov    $0x14,%edi
+  80302f:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  803036:	ff ff ff 
+  803039:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80303d:	ff d0                	call   *%rax
+  80303f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803043:	c9                   	leave
+  803044:	c3                   	ret
+
+0000000000803045 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  803045:	55                   	push   %rbp
+  803046:	48 89 e5             	mov    %rsp,%rbp
+  803049:	48 83 ec 10          	sub    $0x10,%rsp
+  80304d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80304d <sys_page_unmap_batch+0x8>
+  803054:	49 bb fb 6f 00 00 00 	movabs $0x6ffb,%r11
+  80305b:	00 00 00 
+  80305e:	4c 01 d8             	add    %r11,%rax
+  803061:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803065:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  803069:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80306d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803071:	48 83 ec 08          	sub    $0x8,%rsp
+  803075:	6a 00                	push   $0x0
+  803077:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80307d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803083:	be 01 00 00 00       	mov    $0x1,%esi
+  803088:	bf 15 00 00 00       	mov    $0x15,%edi
+  80308d:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  803094:	ff ff ff 
+  803097:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80309b:	ff d0                	call   *%rax
+  80309d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8030a1:	c9                   	leave
+  8030a2:	c3                   	ret
+
+00000000008030a3 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8030a3:	55                   	push   %rbp
+  8030a4:	48 89 e5             	mov    %rsp,%rbp
+  8030a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8030a7 <sys_fork+0x4>
+  8030ae:	49 bb a1 6f 00 00 00 	movabs $0x6fa1,%r11
+  8030b5:	00 00 00 
+  8030b8:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8030bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8030bf:	6a 00                	push   $0x0
+  8030c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8030dc:	bf 16 00 00 00       	mov    $0x16,%edi
+  8030e1:	49 ba e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%r10
+  8030e8:	ff ff ff 
+  8030eb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8030ef:	ff d0                	call   *%rax
+  8030f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8030f5:	c9                   	leave
+  8030f6:	c3                   	ret
+
+00000000008030f7 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8030f7:	55                   	push   %rbp
+  8030f8:	48 89 e5             	mov    %rsp,%rbp
+  8030fb:	41 57                	push   %r15
+  8030fd:	53                   	push   %rbx
+  8030fe:	48 83 ec 40          	sub    $0x40,%rsp
+  803102:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803102 <pgfault+0xb>
+  803109:	49 bb 46 6f 00 00 00 	movabs $0x6f46,%r11
+  803110:	00 00 00 
+  803113:	4c 01 db             	add    %r11,%rbx
+  803116:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  80311a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80311e:	48 8b 00             	mov    (%rax),%rax
+  803121:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  803125:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803129:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80312d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  803130:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803134:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803138:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80313c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803142:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  803146:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803149:	83 e0 02             	and    $0x2,%eax
+  80314c:	85 c0                	test   %eax,%eax
+  80314e:	0f 84 91 03 00 00    	je     8034e5 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  803154:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803158:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80315c:	48 89 c2             	mov    %rax,%rdx
+  80315f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803166:	ff ff ff 
+  803169:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80316d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803171:	83 e0 01             	and    $0x1,%eax
+  803174:	48 85 c0             	test   %rax,%rax
+  803177:	0f 84 a7 01 00 00    	je     803324 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  80317d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803181:	48 c1 e8 15          	shr    $0x15,%rax
+  803185:	48 89 c2             	mov    %rax,%rdx
+  803188:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80318f:	ff ff ff 
+  803192:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803196:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80319a:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  80319f:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  8031a5:	0f 85 79 01 00 00    	jne    803324 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  8031ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031af:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8031b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031b7:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  8031bd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  8031c1:	ba 07 00 00 00       	mov    $0x7,%edx
+  8031c6:	be 00 00 60 00       	mov    $0x600000,%esi
+  8031cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d0:	49 89 df             	mov    %rbx,%r15
+  8031d3:	48 b8 dc 8e ff ff ff 	movabs $0xffffffffffff8edc,%rax
+  8031da:	ff ff ff 
+  8031dd:	48 01 d8             	add    %rbx,%rax
+  8031e0:	ff d0                	call   *%rax
+  8031e2:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8031e5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8031e9:	79 44                	jns    80322f <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  8031eb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8031ee:	89 c1                	mov    %eax,%ecx
+  8031f0:	48 b8 58 e0 ff ff ff 	movabs $0xffffffffffffe058,%rax
+  8031f7:	ff ff ff 
+  8031fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031fe:	48 89 c2             	mov    %rax,%rdx
+  803201:	be 20 00 00 00       	mov    $0x20,%esi
+  803206:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  80320d:	ff ff ff 
+  803210:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803214:	48 89 c7             	mov    %rax,%rdi
+  803217:	49 89 df             	mov    %rbx,%r15
+  80321a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321f:	49 b8 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r8
+  803226:	ff ff ff 
+  803229:	49 01 d8             	add    %rbx,%r8
+  80322c:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  80322f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803233:	ba 00 00 20 00       	mov    $0x200000,%edx
+  803238:	48 89 c6             	mov    %rax,%rsi
+  80323b:	bf 00 00 60 00       	mov    $0x600000,%edi
+  803240:	49 89 df             	mov    %rbx,%r15
+  803243:	48 b8 55 81 ff ff ff 	movabs $0xffffffffffff8155,%rax
+  80324a:	ff ff ff 
+  80324d:	48 01 d8             	add    %rbx,%rax
+  803250:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  803252:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803256:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80325c:	48 89 c1             	mov    %rax,%rcx
+  80325f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803264:	be 00 00 60 00       	mov    $0x600000,%esi
+  803269:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326e:	49 89 df             	mov    %rbx,%r15
+  803271:	48 b8 6b 89 ff ff ff 	movabs $0xffffffffffff896b,%rax
+  803278:	ff ff ff 
+  80327b:	48 01 d8             	add    %rbx,%rax
+  80327e:	ff d0                	call   *%rax
+  803280:	85 c0                	test   %eax,%eax
+  803282:	74 3e                	je     8032c2 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  803284:	48 b8 83 e0 ff ff ff 	movabs $0xffffffffffffe083,%rax
+  80328b:	ff ff ff 
+  80328e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803292:	48 89 c2             	mov    %rax,%rdx
+  803295:	be 23 00 00 00       	mov    $0x23,%esi
+  80329a:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  8032a1:	ff ff ff 
+  8032a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032a8:	48 89 c7             	mov    %rax,%rdi
+  8032ab:	49 89 df             	mov    %rbx,%r15
+  8032ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b3:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  8032ba:	ff ff ff 
+  8032bd:	48 01 d9             	add    %rbx,%rcx
+  8032c0:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  8032c2:	be 00 00 60 00       	mov    $0x600000,%esi
+  8032c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032cc:	49 89 df             	mov    %rbx,%r15
+  8032cf:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  8032d6:	ff ff ff 
+  8032d9:	48 01 d8             	add    %rbx,%rax
+  8032dc:	ff d0                	call   *%rax
+  8032de:	85 c0                	test   %eax,%eax
+  8032e0:	0f 84 3d 02 00 00    	je     803523 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  8032e6:	48 b8 98 e0 ff ff ff 	movabs $0xffffffffffffe098,%rax
+  8032ed:	ff ff ff 
+  8032f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032f4:	48 89 c2             	mov    %rax,%rdx
+  8032f7:	be 25 00 00 00       	mov    $0x25,%esi
+  8032fc:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  803303:	ff ff ff 
+  803306:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80330a:	48 89 c7             	mov    %rax,%rdi
+  80330d:	49 89 df             	mov    %rbx,%r15
+  803310:	b8 00 00 00 00       	mov    $0x0,%eax
+  803315:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  80331c:	ff ff ff 
+  80331f:	48 01 d9             	add    %rbx,%rcx
+  803322:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  803324:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803328:	48 c1 e8 0c          	shr    $0xc,%rax
+  80332c:	48 89 c2             	mov    %rax,%rdx
+  80332f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803336:	ff ff ff 
+  803339:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80333d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803341:	25 00 08 00 00       	and    $0x800,%eax
+  803346:	48 85 c0             	test   %rax,%rax
+  803349:	0f 84 58 01 00 00    	je     8034a7 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  80334f:	ba 07 00 00 00       	mov    $0x7,%edx
+  803354:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  803359:	bf 00 00 00 00       	mov    $0x0,%edi
+  80335e:	49 89 df             	mov    %rbx,%r15
+  803361:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  803368:	ff ff ff 
+  80336b:	48 01 d8             	add    %rbx,%rax
+  80336e:	ff d0                	call   *%rax
+  803370:	85 c0                	test   %eax,%eax
+  803372:	74 3e                	je     8033b2 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  803374:	48 b8 af e0 ff ff ff 	movabs $0xffffffffffffe0af,%rax
+  80337b:	ff ff ff 
+  80337e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803382:	48 89 c2             	mov    %rax,%rdx
+  803385:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80338a:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  803391:	ff ff ff 
+  803394:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803398:	48 89 c7             	mov    %rax,%rdi
+  80339b:	49 89 df             	mov    %rbx,%r15
+  80339e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a3:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  8033aa:	ff ff ff 
+  8033ad:	48 01 d9             	add    %rbx,%rcx
+  8033b0:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  8033b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033bb:	48 89 c6             	mov    %rax,%rsi
+  8033be:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8033c3:	49 89 df             	mov    %rbx,%r15
+  8033c6:	48 b8 55 81 ff ff ff 	movabs $0xffffffffffff8155,%rax
+  8033cd:	ff ff ff 
+  8033d0:	48 01 d8             	add    %rbx,%rax
+  8033d3:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  8033d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033d9:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8033df:	48 89 c1             	mov    %rax,%rcx
+  8033e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033e7:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8033ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033f1:	49 89 df             	mov    %rbx,%r15
+  8033f4:	48 b8 6b 89 ff ff ff 	movabs $0xffffffffffff896b,%rax
+  8033fb:	ff ff ff 
+  8033fe:	48 01 d8             	add    %rbx,%rax
+  803401:	ff d0                	call   *%rax
+  803403:	85 c0                	test   %eax,%eax
+  803405:	74 3e                	je     803445 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  803407:	48 b8 83 e0 ff ff ff 	movabs $0xffffffffffffe083,%rax
+  80340e:	ff ff ff 
+  803411:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803415:	48 89 c2             	mov    %rax,%rdx
+  803418:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80341d:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  803424:	ff ff ff 
+  803427:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80342b:	48 89 c7             	mov    %rax,%rdi
+  80342e:	49 89 df             	mov    %rbx,%r15
+  803431:	b8 00 00 00 00       	mov    $0x0,%eax
+  803436:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  80343d:	ff ff ff 
+  803440:	48 01 d9             	add    %rbx,%rcx
+  803443:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  803445:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80344a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80344f:	49 89 df             	mov    %rbx,%r15
+  803452:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  803459:	ff ff ff 
+  80345c:	48 01 d8             	add    %rbx,%rax
+  80345f:	ff d0                	call   *%rax
+  803461:	85 c0                	test   %eax,%eax
+  803463:	0f 84 bb 00 00 00    	je     803524 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  803469:	48 b8 98 e0 ff ff ff 	movabs $0xffffffffffffe098,%rax
+  803470:	ff ff ff 
+  803473:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803477:	48 89 c2             	mov    %rax,%rdx
+  80347a:	be 32 00 00 00       	mov    $0x32,%esi
+  80347f:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  803486:	ff ff ff 
+  803489:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80348d:	48 89 c7             	mov    %rax,%rdi
+  803490:	49 89 df             	mov    %rbx,%r15
+  803493:	b8 00 00 00 00       	mov    $0x0,%eax
+  803498:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  80349f:	ff ff ff 
+  8034a2:	48 01 d9             	add    %rbx,%rcx
+  8034a5:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  8034a7:	48 b8 c8 e0 ff ff ff 	movabs $0xffffffffffffe0c8,%rax
+  8034ae:	ff ff ff 
+  8034b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034b5:	48 89 c2             	mov    %rax,%rdx
+  8034b8:	be 36 00 00 00       	mov    $0x36,%esi
+  8034bd:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  8034c4:	ff ff ff 
+  8034c7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034cb:	48 89 c7             	mov    %rax,%rdi
+  8034ce:	49 89 df             	mov    %rbx,%r15
+  8034d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d6:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  8034dd:	ff ff ff 
+  8034e0:	48 01 d9             	add    %rbx,%rcx
+  8034e3:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  8034e5:	48 b8 e7 e0 ff ff ff 	movabs $0xffffffffffffe0e7,%rax
+  8034ec:	ff ff ff 
+  8034ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034f3:	48 89 c2             	mov    %rax,%rdx
+  8034f6:	be 3a 00 00 00       	mov    $0x3a,%esi
+  8034fb:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  803502:	ff ff ff 
+  803505:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803509:	48 89 c7             	mov    %rax,%rdi
+  80350c:	49 89 df             	mov    %rbx,%r15
+  80350f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803514:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  80351b:	ff ff ff 
+  80351e:	48 01 d9             	add    %rbx,%rcx
+  803521:	ff d1                	call   *%rcx
+			return;
+  803523:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  803524:	48 83 c4 40          	add    $0x40,%rsp
+  803528:	5b                   	pop    %rbx
+  803529:	41 5f                	pop    %r15
+  80352b:	5d                   	pop    %rbp
+  80352c:	c3                   	ret
+
+000000000080352d <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  80352d:	55                   	push   %rbp
+  80352e:	48 89 e5             	mov    %rsp,%rbp
+  803531:	41 57                	push   %r15
+  803533:	53                   	push   %rbx
+  803534:	48 83 ec 10          	sub    $0x10,%rsp
+  803538:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803538 <fork_flush+0xb>
+  80353f:	49 bb 10 6b 00 00 00 	movabs $0x6b10,%r11
+  803546:	00 00 00 
+  803549:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  80354c:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  803553:	00 00 00 
+  803556:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80355a:	48 85 c0             	test   %rax,%rax
+  80355d:	0f 84 81 00 00 00    	je     8035e4 <fork_flush+0xb7>
+  803563:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  80356a:	00 00 00 
+  80356d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803571:	48 89 c6             	mov    %rax,%rsi
+  803574:	48 b8 d8 0f 00 00 00 	movabs $0xfd8,%rax
+  80357b:	00 00 00 
+  80357e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803582:	48 89 c7             	mov    %rax,%rdi
+  803585:	49 89 df             	mov    %rbx,%r15
+  803588:	48 b8 41 8f ff ff ff 	movabs $0xffffffffffff8f41,%rax
+  80358f:	ff ff ff 
+  803592:	48 01 d8             	add    %rbx,%rax
+  803595:	ff d0                	call   *%rax
+  803597:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80359a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80359e:	79 44                	jns    8035e4 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  8035a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035a3:	89 c1                	mov    %eax,%ecx
+  8035a5:	48 b8 00 e1 ff ff ff 	movabs $0xffffffffffffe100,%rax
+  8035ac:	ff ff ff 
+  8035af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035b3:	48 89 c2             	mov    %rax,%rdx
+  8035b6:	be 56 00 00 00       	mov    $0x56,%esi
+  8035bb:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  8035c2:	ff ff ff 
+  8035c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035c9:	48 89 c7             	mov    %rax,%rdi
+  8035cc:	49 89 df             	mov    %rbx,%r15
+  8035cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d4:	49 b8 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r8
+  8035db:	ff ff ff 
+  8035de:	49 01 d8             	add    %rbx,%r8
+  8035e1:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  8035e4:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  8035eb:	00 00 00 
+  8035ee:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  8035f5:	00 
+}
+  8035f6:	90                   	nop
+  8035f7:	48 83 c4 10          	add    $0x10,%rsp
+  8035fb:	5b                   	pop    %rbx
+  8035fc:	41 5f                	pop    %r15
+  8035fe:	5d                   	pop    %rbp
+  8035ff:	c3                   	ret
+
+0000000000803600 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  803600:	55                   	push   %rbp
+  803601:	48 89 e5             	mov    %rsp,%rbp
+  803604:	53                   	push   %rbx
+  803605:	48 83 ec 28          	sub    $0x28,%rsp
+  803609:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803609 <fork_map+0x9>
+  803610:	49 bb 3f 6a 00 00 00 	movabs $0x6a3f,%r11
+  803617:	00 00 00 
+  80361a:	4c 01 db             	add    %r11,%rbx
+  80361d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803620:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803624:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  803627:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  80362e:	00 00 00 
+  803631:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803635:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  80363b:	75 10                	jne    80364d <fork_map+0x4d>
+		fork_flush();
+  80363d:	48 b8 e5 94 ff ff ff 	movabs $0xffffffffffff94e5,%rax
+  803644:	ff ff ff 
+  803647:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80364b:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  80364d:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  803654:	00 00 00 
+  803657:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80365b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80365f:	48 b9 d8 1f 00 00 00 	movabs $0x1fd8,%rcx
+  803666:	00 00 00 
+  803669:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  80366d:	48 c1 e0 05          	shl    $0x5,%rax
+  803671:	48 89 c2             	mov    %rax,%rdx
+  803674:	48 b8 d8 0f 00 00 00 	movabs $0xfd8,%rax
+  80367b:	00 00 00 
+  80367e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803682:	48 01 d0             	add    %rdx,%rax
+  803685:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  803689:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80368d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  803693:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803697:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80369b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  80369f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036a3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8036a6:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  8036a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036ad:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8036b1:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  8036b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036b9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8036bc:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  8036bf:	90                   	nop
+  8036c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036c4:	c9                   	leave
+  8036c5:	c3                   	ret
+
+00000000008036c6 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  8036c6:	55                   	push   %rbp
+  8036c7:	48 89 e5             	mov    %rsp,%rbp
+  8036ca:	53                   	push   %rbx
+  8036cb:	48 83 ec 28          	sub    $0x28,%rsp
+  8036cf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036cf <duppage+0x9>
+  8036d6:	49 bb 79 69 00 00 00 	movabs $0x6979,%r11
+  8036dd:	00 00 00 
+  8036e0:	4c 01 db             	add    %r11,%rbx
+  8036e3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8036e6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  8036e9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8036ec:	48 c1 e0 0c          	shl    $0xc,%rax
+  8036f0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  8036f4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8036fb:	ff ff ff 
+  8036fe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803702:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803705:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803709:	25 00 04 00 00       	and    $0x400,%eax
+  80370e:	48 85 c0             	test   %rax,%rax
+  803711:	74 42                	je     803755 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  803713:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80371a:	ff ff ff 
+  80371d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803721:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803724:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803728:	25 07 0e 00 00       	and    $0xe07,%eax
+  80372d:	89 c2                	mov    %eax,%edx
+  80372f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803733:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803736:	48 89 ce             	mov    %rcx,%rsi
+  803739:	89 c7                	mov    %eax,%edi
+  80373b:	48 b8 b8 95 ff ff ff 	movabs $0xffffffffffff95b8,%rax
+  803742:	ff ff ff 
+  803745:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803749:	ff d0                	call   *%rax
+		return 0;
+  80374b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803750:	e9 ae 00 00 00       	jmp    803803 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  803755:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80375c:	ff ff ff 
+  80375f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803763:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803766:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80376a:	83 e0 02             	and    $0x2,%eax
+  80376d:	48 85 c0             	test   %rax,%rax
+  803770:	75 1f                	jne    803791 <duppage+0xcb>
+  803772:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803779:	ff ff ff 
+  80377c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803780:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803783:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803787:	25 00 08 00 00       	and    $0x800,%eax
+  80378c:	48 85 c0             	test   %rax,%rax
+  80378f:	74 4c                	je     8037dd <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  803791:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  803798:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80379b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80379f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037a2:	48 89 ce             	mov    %rcx,%rsi
+  8037a5:	89 c7                	mov    %eax,%edi
+  8037a7:	48 b8 b8 95 ff ff ff 	movabs $0xffffffffffff95b8,%rax
+  8037ae:	ff ff ff 
+  8037b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037b5:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  8037b7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8037ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037be:	48 89 c6             	mov    %rax,%rsi
+  8037c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037c6:	48 b8 b8 95 ff ff ff 	movabs $0xffffffffffff95b8,%rax
+  8037cd:	ff ff ff 
+  8037d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037d4:	ff d0                	call   *%rax
+		return 0;
+  8037d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037db:	eb 26                	jmp    803803 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  8037dd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8037e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037e4:	ba 05 00 00 00       	mov    $0x5,%edx
+  8037e9:	48 89 ce             	mov    %rcx,%rsi
+  8037ec:	89 c7                	mov    %eax,%edi
+  8037ee:	48 b8 b8 95 ff ff ff 	movabs $0xffffffffffff95b8,%rax
+  8037f5:	ff ff ff 
+  8037f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037fc:	ff d0                	call   *%rax
+		return 0;
+  8037fe:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803803:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803807:	c9                   	leave
+  803808:	c3                   	ret
+
+0000000000803809 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  803809:	55                   	push   %rbp
+  80380a:	48 89 e5             	mov    %rsp,%rbp
+  80380d:	53                   	push   %rbx
+  80380e:	48 83 ec 28          	sub    $0x28,%rsp
+  803812:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803812 <duphuge+0x9>
+  803819:	49 bb 36 68 00 00 00 	movabs $0x6836,%r11
+  803820:	00 00 00 
+  803823:	4c 01 db             	add    %r11,%rbx
+  803826:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803829:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  80382d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803831:	48 c1 e8 15          	shr    $0x15,%rax
+  803835:	48 89 c2             	mov    %rax,%rdx
+  803838:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80383f:	ff ff ff 
+  803842:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803846:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80384a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  80384e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803852:	25 00 04 00 00       	and    $0x400,%eax
+  803857:	48 85 c0             	test   %rax,%rax
+  80385a:	74 0e                	je     80386a <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  80385c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803860:	25 07 0e 00 00       	and    $0xe07,%eax
+  803865:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803868:	eb 1e                	jmp    803888 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  80386a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80386e:	25 02 08 00 00       	and    $0x802,%eax
+  803873:	48 85 c0             	test   %rax,%rax
+  803876:	74 09                	je     803881 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  803878:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  80387f:	eb 07                	jmp    803888 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  803881:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  803888:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80388b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80388f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803892:	48 89 ce             	mov    %rcx,%rsi
+  803895:	89 c7                	mov    %eax,%edi
+  803897:	48 b8 b8 95 ff ff ff 	movabs $0xffffffffffff95b8,%rax
+  80389e:	ff ff ff 
+  8038a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038a5:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  8038a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038aa:	25 00 08 00 00       	and    $0x800,%eax
+  8038af:	85 c0                	test   %eax,%eax
+  8038b1:	74 1f                	je     8038d2 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  8038b3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8038b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038ba:	48 89 c6             	mov    %rax,%rsi
+  8038bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038c2:	48 b8 b8 95 ff ff ff 	movabs $0xffffffffffff95b8,%rax
+  8038c9:	ff ff ff 
+  8038cc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038d0:	ff d0                	call   *%rax
+	return 0;
+  8038d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038db:	c9                   	leave
+  8038dc:	c3                   	ret
+
+00000000008038dd <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8038dd:	55                   	push   %rbp
+  8038de:	48 89 e5             	mov    %rsp,%rbp
+  8038e1:	41 57                	push   %r15
+  8038e3:	53                   	push   %rbx
+  8038e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8038e8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038e8 <fork+0xb>
+  8038ef:	49 bb 60 67 00 00 00 	movabs $0x6760,%r11
+  8038f6:	00 00 00 
+  8038f9:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  8038fc:	49 89 df             	mov    %rbx,%r15
+  8038ff:	48 b8 5b 90 ff ff ff 	movabs $0xffffffffffff905b,%rax
+  803906:	ff ff ff 
+  803909:	48 01 d8             	add    %rbx,%rax
+  80390c:	ff d0                	call   *%rax
+  80390e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803911:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803915:	75 42                	jne    803959 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803917:	49 89 df             	mov    %rbx,%r15
+  80391a:	48 b8 5d 88 ff ff ff 	movabs $0xffffffffffff885d,%rax
+  803921:	ff ff ff 
+  803924:	48 01 d8             	add    %rbx,%rax
+  803927:	ff d0                	call   *%rax
+  803929:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80392e:	48 98                	cltq
+  803930:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803937:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80393e:	ff ff ff 
+  803941:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803945:	48 01 c2             	add    %rax,%rdx
+  803948:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80394f:	ff ff ff 
+  803952:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803956:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  803959:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80395c:	48 83 c4 10          	add    $0x10,%rsp
+  803960:	5b                   	pop    %rbx
+  803961:	41 5f                	pop    %r15
+  803963:	5d                   	pop    %rbp
+  803964:	c3                   	ret
+
+0000000000803965 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  803965:	55                   	push   %rbp
+  803966:	48 89 e5             	mov    %rsp,%rbp
+  803969:	41 57                	push   %r15
+  80396b:	53                   	push   %rbx
+  80396c:	48 83 ec 10          	sub    $0x10,%rsp
+  803970:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803970 <ufork+0xb>
+  803977:	49 bb d8 66 00 00 00 	movabs $0x66d8,%r11
+  80397e:	00 00 00 
+  803981:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  803984:	48 b8 af 90 ff ff ff 	movabs $0xffffffffffff90af,%rax
+  80398b:	ff ff ff 
+  80398e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803992:	48 89 c7             	mov    %rax,%rdi
+  803995:	49 89 df             	mov    %rbx,%r15
+  803998:	48 b8 10 d3 ff ff ff 	movabs $0xffffffffffffd310,%rax
+  80399f:	ff ff ff 
+  8039a2:	48 01 d8             	add    %rbx,%rax
+  8039a5:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8039a7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8039ac:	cd 30                	int    $0x30
+  8039ae:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8039b1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  8039b4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  8039b7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8039bb:	0f 84 03 02 00 00    	je     803bc4 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  8039c1:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8039c8:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  8039c9:	e9 28 01 00 00       	jmp    803af6 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  8039ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039d2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039d6:	48 89 c2             	mov    %rax,%rdx
+  8039d9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8039e0:	ff ff ff 
+  8039e3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039e7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039eb:	83 e0 01             	and    $0x1,%eax
+  8039ee:	48 85 c0             	test   %rax,%rax
+  8039f1:	0f 84 f7 00 00 00    	je     803aee <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  8039f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039fb:	48 c1 e8 15          	shr    $0x15,%rax
+  8039ff:	48 89 c2             	mov    %rax,%rdx
+  803a02:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803a09:	ff ff ff 
+  803a0c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a10:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a14:	25 81 00 00 00       	and    $0x81,%eax
+  803a19:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  803a1f:	75 29                	jne    803a4a <ufork+0xe5>
+					duphuge(child_envid, addr);
+  803a21:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a25:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a28:	48 89 d6             	mov    %rdx,%rsi
+  803a2b:	89 c7                	mov    %eax,%edi
+  803a2d:	48 b8 c1 97 ff ff ff 	movabs $0xffffffffffff97c1,%rax
+  803a34:	ff ff ff 
+  803a37:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a3b:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  803a3d:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803a44:	00 
+  803a45:	e9 ac 00 00 00       	jmp    803af6 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  803a4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a4e:	48 c1 e8 15          	shr    $0x15,%rax
+  803a52:	48 89 c2             	mov    %rax,%rdx
+  803a55:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803a5c:	ff ff ff 
+  803a5f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a67:	83 e0 01             	and    $0x1,%eax
+  803a6a:	48 85 c0             	test   %rax,%rax
+  803a6d:	74 75                	je     803ae4 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  803a6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a73:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a77:	48 89 c2             	mov    %rax,%rdx
+  803a7a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803a81:	ff ff ff 
+  803a84:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a88:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a8c:	83 e0 01             	and    $0x1,%eax
+  803a8f:	48 85 c0             	test   %rax,%rax
+  803a92:	74 46                	je     803ada <ufork+0x175>
+  803a94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a98:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a9c:	48 89 c2             	mov    %rax,%rdx
+  803a9f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803aa6:	ff ff ff 
+  803aa9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803aad:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ab1:	83 e0 04             	and    $0x4,%eax
+  803ab4:	48 85 c0             	test   %rax,%rax
+  803ab7:	74 21                	je     803ada <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  803ab9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803abd:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ac1:	89 c2                	mov    %eax,%edx
+  803ac3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ac6:	89 d6                	mov    %edx,%esi
+  803ac8:	89 c7                	mov    %eax,%edi
+  803aca:	48 b8 7e 96 ff ff ff 	movabs $0xffffffffffff967e,%rax
+  803ad1:	ff ff ff 
+  803ad4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ad8:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  803ada:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803ae1:	00 
+  803ae2:	eb 12                	jmp    803af6 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803ae4:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803aeb:	00 
+  803aec:	eb 08                	jmp    803af6 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  803aee:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803af5:	40 
+		for (; addr < USTACKTOP;){
+  803af6:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803afb:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  803aff:	0f 83 c9 fe ff ff    	jae    8039ce <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803b05:	48 b8 e5 94 ff ff ff 	movabs $0xffffffffffff94e5,%rax
+  803b0c:	ff ff ff 
+  803b0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b13:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803b15:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b18:	ba 07 00 00 00       	mov    $0x7,%edx
+  803b1d:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  803b22:	48 89 ce             	mov    %rcx,%rsi
+  803b25:	89 c7                	mov    %eax,%edi
+  803b27:	49 89 df             	mov    %rbx,%r15
+  803b2a:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  803b31:	ff ff ff 
+  803b34:	48 01 d8             	add    %rbx,%rax
+  803b37:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803b39:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b3c:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803b43:	ff ff ff 
+  803b46:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803b4a:	48 89 d6             	mov    %rdx,%rsi
+  803b4d:	89 c7                	mov    %eax,%edi
+  803b4f:	49 89 df             	mov    %rbx,%r15
+  803b52:	48 b8 fc 8a ff ff ff 	movabs $0xffffffffffff8afc,%rax
+  803b59:	ff ff ff 
+  803b5c:	48 01 d8             	add    %rbx,%rax
+  803b5f:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803b61:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b64:	be 02 00 00 00       	mov    $0x2,%esi
+  803b69:	89 c7                	mov    %eax,%edi
+  803b6b:	49 89 df             	mov    %rbx,%r15
+  803b6e:	48 b8 3d 8a ff ff ff 	movabs $0xffffffffffff8a3d,%rax
+  803b75:	ff ff ff 
+  803b78:	48 01 d8             	add    %rbx,%rax
+  803b7b:	ff d0                	call   *%rax
+  803b7d:	85 c0                	test   %eax,%eax
+  803b7f:	74 3e                	je     803bbf <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803b81:	48 b8 27 e1 ff ff ff 	movabs $0xffffffffffffe127,%rax
+  803b88:	ff ff ff 
+  803b8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b8f:	48 89 c2             	mov    %rax,%rdx
+  803b92:	be 07 01 00 00       	mov    $0x107,%esi
+  803b97:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  803b9e:	ff ff ff 
+  803ba1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ba5:	48 89 c7             	mov    %rax,%rdi
+  803ba8:	49 89 df             	mov    %rbx,%r15
+  803bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb0:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  803bb7:	ff ff ff 
+  803bba:	48 01 d9             	add    %rbx,%rcx
+  803bbd:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803bbf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803bc2:	eb 59                	jmp    803c1d <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803bc4:	49 89 df             	mov    %rbx,%r15
+  803bc7:	48 b8 5d 88 ff ff ff 	movabs $0xffffffffffff885d,%rax
+  803bce:	ff ff ff 
+  803bd1:	48 01 d8             	add    %rbx,%rax
+  803bd4:	ff d0                	call   *%rax
+  803bd6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803bdb:	48 98                	cltq
+  803bdd:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803be4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803beb:	ff ff ff 
+  803bee:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803bf2:	48 01 c2             	add    %rax,%rdx
+  803bf5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803bfc:	ff ff ff 
+  803bff:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c03:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803c06:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  803c0d:	00 00 00 
+  803c10:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803c17:	00 
+		return 0;
+  803c18:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  803c1d:	48 83 c4 10          	add    $0x10,%rsp
+  803c21:	5b                   	pop    %rbx
+  803c22:	41 5f                	pop    %r15
+  803c24:	5d                   	pop    %rbp
+  803c25:	c3                   	ret
+
+0000000000803c26 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803c26:	55                   	push   %rbp
+  803c27:	48 89 e5             	mov    %rsp,%rbp
+  803c2a:	41 57                	push   %r15
+  803c2c:	48 83 ec 08          	sub    $0x8,%rsp
+  803c30:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803c30 <sfork+0xa>
+  803c37:	49 bb 18 64 00 00 00 	movabs $0x6418,%r11
+  803c3e:	00 00 00 
+  803c41:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803c44:	48 b8 42 e1 ff ff ff 	movabs $0xffffffffffffe142,%rax
+  803c4b:	ff ff ff 
+  803c4e:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803c52:	48 89 c2             	mov    %rax,%rdx
+  803c55:	be 1a 01 00 00       	mov    $0x11a,%esi
+  803c5a:	48 b8 78 e0 ff ff ff 	movabs $0xffffffffffffe078,%rax
+  803c61:	ff ff ff 
+  803c64:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803c68:	48 89 c7             	mov    %rax,%rdi
+  803c6b:	49 89 cf             	mov    %rcx,%r15
+  803c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c73:	49 b8 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r8
+  803c7a:	ff ff ff 
+  803c7d:	49 01 c8             	add    %rcx,%r8
+  803c80:	41 ff d0             	call   *%r8
+
+0000000000803c83 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803c83:	55                   	push   %rbp
+  803c84:	48 89 e5             	mov    %rsp,%rbp
+  803c87:	41 57                	push   %r15
+  803c89:	53                   	push   %rbx
+  803c8a:	48 83 ec 30          	sub    $0x30,%rsp
+  803c8e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c8e <ipc_recv+0xb>
+  803c95:	49 bb ba 63 00 00 00 	movabs $0x63ba,%r11
+  803c9c:	00 00 00 
+  803c9f:	4c 01 db             	add    %r11,%rbx
+  803ca2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ca6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803caa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  803cae:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803cb3:	75 0e                	jne    803cc3 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  803cb5:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803cbc:	00 00 00 
+  803cbf:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  803cc3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cc7:	48 89 c7             	mov    %rax,%rdi
+  803cca:	49 89 df             	mov    %rbx,%r15
+  803ccd:	48 b8 2f 8c ff ff ff 	movabs $0xffffffffffff8c2f,%rax
+  803cd4:	ff ff ff 
+  803cd7:	48 01 d8             	add    %rbx,%rax
+  803cda:	ff d0                	call   *%rax
+  803cdc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  803cdf:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803ce4:	74 2a                	je     803d10 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  803ce6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cea:	75 19                	jne    803d05 <ipc_recv+0x82>
+  803cec:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803cf3:	ff ff ff 
+  803cf6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803cfa:	48 8b 00             	mov    (%rax),%rax
+  803cfd:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803d03:	eb 05                	jmp    803d0a <ipc_recv+0x87>
+  803d05:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d0a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d0e:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  803d10:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803d15:	74 2a                	je     803d41 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  803d17:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d1b:	75 19                	jne    803d36 <ipc_recv+0xb3>
+  803d1d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803d24:	ff ff ff 
+  803d27:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803d2b:	48 8b 00             	mov    (%rax),%rax
+  803d2e:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803d34:	eb 05                	jmp    803d3b <ipc_recv+0xb8>
+  803d36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d3b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803d3f:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  803d41:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d45:	74 05                	je     803d4c <ipc_recv+0xc9>
+		return res;
+  803d47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d4a:	eb 17                	jmp    803d63 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  803d4c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803d53:	ff ff ff 
+  803d56:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803d5a:	48 8b 00             	mov    (%rax),%rax
+  803d5d:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803d63:	48 83 c4 30          	add    $0x30,%rsp
+  803d67:	5b                   	pop    %rbx
+  803d68:	41 5f                	pop    %r15
+  803d6a:	5d                   	pop    %rbp
+  803d6b:	c3                   	ret
+
+0000000000803d6c <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803d6c:	55                   	push   %rbp
+  803d6d:	48 89 e5             	mov    %rsp,%rbp
+  803d70:	41 57                	push   %r15
+  803d72:	53                   	push   %rbx
+  803d73:	48 83 ec 20          	sub    $0x20,%rsp
+  803d77:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d77 <ipc_send+0xb>
+  803d7e:	49 bb d1 62 00 00 00 	movabs $0x62d1,%r11
+  803d85:	00 00 00 
+  803d88:	4c 01 db             	add    %r11,%rbx
+  803d8b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803d8e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  803d91:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d95:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  803d98:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803d9d:	75 0e                	jne    803dad <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  803d9f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803da6:	00 00 00 
+  803da9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  803dad:	90                   	nop
+  803dae:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  803db1:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803db4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803db8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dbb:	89 c7                	mov    %eax,%edi
+  803dbd:	49 89 df             	mov    %rbx,%r15
+  803dc0:	48 b8 c5 8b ff ff ff 	movabs $0xffffffffffff8bc5,%rax
+  803dc7:	ff ff ff 
+  803dca:	48 01 d8             	add    %rbx,%rax
+  803dcd:	ff d0                	call   *%rax
+  803dcf:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  803dd2:	74 da                	je     803dae <ipc_send+0x42>
+		;
+}
+  803dd4:	90                   	nop
+  803dd5:	90                   	nop
+  803dd6:	48 83 c4 20          	add    $0x20,%rsp
+  803dda:	5b                   	pop    %rbx
+  803ddb:	41 5f                	pop    %r15
+  803ddd:	5d                   	pop    %rbp
+  803dde:	c3                   	ret
+
+0000000000803ddf <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  803ddf:	55                   	push   %rbp
+  803de0:	48 89 e5             	mov    %rsp,%rbp
+  803de3:	41 57                	push   %r15
+  803de5:	53                   	push   %rbx
+  803de6:	48 83 ec 40          	sub    $0x40,%rsp
+  803dea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803dea <ipc_call+0xb>
+  803df1:	49 bb 5e 62 00 00 00 	movabs $0x625e,%r11
+  803df8:	00 00 00 
+  803dfb:	4c 01 db             	add    %r11,%rbx
+  803dfe:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e01:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803e04:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803e08:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803e0b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803e0f:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803e13:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803e18:	75 0e                	jne    803e28 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  803e1a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803e21:	00 00 00 
+  803e24:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803e28:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803e2d:	75 0e                	jne    803e3d <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803e2f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803e36:	00 00 00 
+  803e39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  803e3d:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803e40:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803e44:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803e47:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e4b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e4e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803e54:	49 89 f8             	mov    %rdi,%r8
+  803e57:	89 c7                	mov    %eax,%edi
+  803e59:	49 89 df             	mov    %rbx,%r15
+  803e5c:	48 b8 88 8c ff ff ff 	movabs $0xffffffffffff8c88,%rax
+  803e63:	ff ff ff 
+  803e66:	48 01 d8             	add    %rbx,%rax
+  803e69:	ff d0                	call   *%rax
+  803e6b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  803e6e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803e73:	74 2a                	je     803e9f <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803e75:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e79:	75 19                	jne    803e94 <ipc_call+0xb5>
+  803e7b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803e82:	ff ff ff 
+  803e85:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803e89:	48 8b 00             	mov    (%rax),%rax
+  803e8c:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803e92:	eb 05                	jmp    803e99 <ipc_call+0xba>
+  803e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e99:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e9d:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803e9f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ea3:	74 05                	je     803eaa <ipc_call+0xcb>
+		return r;
+  803ea5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ea8:	eb 17                	jmp    803ec1 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  803eaa:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803eb1:	ff ff ff 
+  803eb4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803eb8:	48 8b 00             	mov    (%rax),%rax
+  803ebb:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803ec1:	48 83 c4 40          	add    $0x40,%rsp
+  803ec5:	5b                   	pop    %rbx
+  803ec6:	41 5f                	pop    %r15
+  803ec8:	5d                   	pop    %rbp
+  803ec9:	c3                   	ret
+
+0000000000803eca <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  803eca:	55                   	push   %rbp
+  803ecb:	48 89 e5             	mov    %rsp,%rbp
+  803ece:	41 57                	push   %r15
+  803ed0:	53                   	push   %rbx
+  803ed1:	48 83 ec 70          	sub    $0x70,%rsp
+  803ed5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ed5 <ipc_callw+0xb>
+  803edc:	49 bb 73 61 00 00 00 	movabs $0x6173,%r11
+  803ee3:	00 00 00 
+  803ee6:	4c 01 db             	add    %r11,%rbx
+  803ee9:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  803eec:	89 75 98             	mov    %esi,-0x68(%rbp)
+  803eef:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  803ef3:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  803ef7:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  803efc:	76 0a                	jbe    803f08 <ipc_callw+0x3e>
+		return -E_INVAL;
+  803efe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f03:	e9 b7 00 00 00       	jmp    803fbf <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  803f08:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803f0c:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  803f10:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803f14:	48 89 ce             	mov    %rcx,%rsi
+  803f17:	48 89 c7             	mov    %rax,%rdi
+  803f1a:	49 89 df             	mov    %rbx,%r15
+  803f1d:	48 b8 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rax
+  803f24:	ff ff ff 
+  803f27:	48 01 d8             	add    %rbx,%rax
+  803f2a:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  803f2c:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803f33:	00 
+  803f34:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803f38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f3c:	48 01 d0             	add    %rdx,%rax
+  803f3f:	48 83 e8 01          	sub    $0x1,%rax
+  803f43:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803f47:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f50:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803f54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f58:	48 29 d0             	sub    %rdx,%rax
+  803f5b:	48 c1 e8 03          	shr    $0x3,%rax
+  803f5f:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  803f63:	89 c1                	mov    %eax,%ecx
+  803f65:	8b 75 98             	mov    -0x68(%rbp),%esi
+  803f68:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  803f6c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  803f6f:	49 89 d1             	mov    %rdx,%r9
+  803f72:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  803f79:	00 00 00 
+  803f7c:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  803f83:	00 00 00 
+  803f86:	89 c7                	mov    %eax,%edi
+  803f88:	49 89 df             	mov    %rbx,%r15
+  803f8b:	48 b8 88 8c ff ff ff 	movabs $0xffffffffffff8c88,%rax
+  803f92:	ff ff ff 
+  803f95:	48 01 d8             	add    %rbx,%rax
+  803f98:	ff d0                	call   *%rax
+  803f9a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  803f9d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803fa1:	74 05                	je     803fa8 <ipc_callw+0xde>
+		return r;
+  803fa3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803fa6:	eb 17                	jmp    803fbf <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  803fa8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803faf:	ff ff ff 
+  803fb2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803fb6:	48 8b 00             	mov    (%rax),%rax
+  803fb9:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803fbf:	48 83 c4 70          	add    $0x70,%rsp
+  803fc3:	5b                   	pop    %rbx
+  803fc4:	41 5f                	pop    %r15
+  803fc6:	5d                   	pop    %rbp
+  803fc7:	c3                   	ret
+
+0000000000803fc8 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  803fc8:	55                   	push   %rbp
+  803fc9:	48 89 e5             	mov    %rsp,%rbp
+  803fcc:	41 57                	push   %r15
+  803fce:	53                   	push   %rbx
+  803fcf:	48 83 ec 40          	sub    $0x40,%rsp
+  803fd3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fd3 <ipc_callv+0xb>
+  803fda:	49 bb 75 60 00 00 00 	movabs $0x6075,%r11
+  803fe1:	00 00 00 
+  803fe4:	4c 01 db             	add    %r11,%rbx
+  803fe7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803fea:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  803fed:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803ff1:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803ff4:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  803ff8:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  803ffc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  804003:	00 00 00 
+  804006:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  80400a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80400e:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  804012:	74 11                	je     804025 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  804014:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804018:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  80401c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80401f:	c1 e0 14             	shl    $0x14,%eax
+  804022:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  804025:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  804029:	74 14                	je     80403f <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  80402b:	8b 45 20             	mov    0x20(%rbp),%eax
+  80402e:	83 e8 01             	sub    $0x1,%eax
+  804031:	48 63 d0             	movslq %eax,%rdx
+  804034:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  804038:	48 09 d0             	or     %rdx,%rax
+  80403b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  80403f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804042:	c1 e0 10             	shl    $0x10,%eax
+  804045:	0b 45 10             	or     0x10(%rbp),%eax
+  804048:	89 c1                	mov    %eax,%ecx
+  80404a:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80404d:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804051:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  804055:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804059:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80405c:	4d 89 c1             	mov    %r8,%r9
+  80405f:	49 89 f8             	mov    %rdi,%r8
+  804062:	89 c7                	mov    %eax,%edi
+  804064:	49 89 df             	mov    %rbx,%r15
+  804067:	48 b8 88 8c ff ff ff 	movabs $0xffffffffffff8c88,%rax
+  80406e:	ff ff ff 
+  804071:	48 01 d8             	add    %rbx,%rax
+  804074:	ff d0                	call   *%rax
+  804076:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  804079:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80407d:	74 05                	je     804084 <ipc_callv+0xbc>
+		return r;
+  80407f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804082:	eb 17                	jmp    80409b <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  804084:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80408b:	ff ff ff 
+  80408e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804092:	48 8b 00             	mov    (%rax),%rax
+  804095:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80409b:	48 83 c4 40          	add    $0x40,%rsp
+  80409f:	5b                   	pop    %rbx
+  8040a0:	41 5f                	pop    %r15
+  8040a2:	5d                   	pop    %rbp
+  8040a3:	c3                   	ret
+
+00000000008040a4 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8040a4:	55                   	push   %rbp
+  8040a5:	48 89 e5             	mov    %rsp,%rbp
+  8040a8:	41 57                	push   %r15
+  8040aa:	53                   	push   %rbx
+  8040ab:	48 83 ec 40          	sub    $0x40,%rsp
+  8040af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040af <ipc_reply_recv+0xb>
+  8040b6:	49 bb 99 5f 00 00 00 	movabs $0x5f99,%r11
+  8040bd:	00 00 00 
+  8040c0:	4c 01 db             	add    %r11,%rbx
+  8040c3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8040c6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8040c9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8040cd:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8040d0:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8040d4:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8040d8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8040dd:	75 0e                	jne    8040ed <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  8040df:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8040e6:	00 00 00 
+  8040e9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8040ed:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8040f2:	75 0e                	jne    804102 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8040f4:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8040fb:	00 00 00 
+  8040fe:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  804102:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  804105:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  804109:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80410d:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  804110:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804114:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804117:	4d 89 c1             	mov    %r8,%r9
+  80411a:	49 89 f8             	mov    %rdi,%r8
+  80411d:	89 c7                	mov    %eax,%edi
+  80411f:	49 89 df             	mov    %rbx,%r15
+  804122:	48 b8 fc 8c ff ff ff 	movabs $0xffffffffffff8cfc,%rax
+  804129:	ff ff ff 
+  80412c:	48 01 d8             	add    %rbx,%rax
+  80412f:	ff d0                	call   *%rax
+  804131:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  804134:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804139:	74 2a                	je     804165 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80413b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80413f:	75 19                	jne    80415a <ipc_reply_recv+0xb6>
+  804141:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804148:	ff ff ff 
+  80414b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80414f:	48 8b 00             	mov    (%rax),%rax
+  804152:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  804158:	eb 05                	jmp    80415f <ipc_reply_recv+0xbb>
+  80415a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80415f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804163:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  804165:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  80416a:	74 2a                	je     804196 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80416c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804170:	75 19                	jne    80418b <ipc_reply_recv+0xe7>
+  804172:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804179:	ff ff ff 
+  80417c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804180:	48 8b 00             	mov    (%rax),%rax
+  804183:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804189:	eb 05                	jmp    804190 <ipc_reply_recv+0xec>
+  80418b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804190:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  804194:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  804196:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80419a:	74 05                	je     8041a1 <ipc_reply_recv+0xfd>
+		return r;
+  80419c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80419f:	eb 17                	jmp    8041b8 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8041a1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8041a8:	ff ff ff 
+  8041ab:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8041af:	48 8b 00             	mov    (%rax),%rax
+  8041b2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8041b8:	48 83 c4 40          	add    $0x40,%rsp
+  8041bc:	5b                   	pop    %rbx
+  8041bd:	41 5f                	pop    %r15
+  8041bf:	5d                   	pop    %rbp
+  8041c0:	c3                   	ret
+
+00000000008041c1 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  8041c1:	55                   	push   %rbp
+  8041c2:	48 89 e5             	mov    %rsp,%rbp
+  8041c5:	41 57                	push   %r15
+  8041c7:	53                   	push   %rbx
+  8041c8:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  8041cf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041cf <ipc_window_batch+0xe>
+  8041d6:	49 bb 79 5e 00 00 00 	movabs $0x5e79,%r11
+  8041dd:	00 00 00 
+  8041e0:	4c 01 db             	add    %r11,%rbx
+  8041e3:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  8041e9:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  8041f0:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  8041f6:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  8041fc:	e9 15 01 00 00       	jmp    804316 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  804201:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  804207:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80420a:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  804211:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804214:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804217:	39 c2                	cmp    %eax,%edx
+  804219:	0f 4e c2             	cmovle %edx,%eax
+  80421c:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  80421f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804226:	eb 6b                	jmp    804293 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  804228:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80422b:	48 98                	cltq
+  80422d:	48 c1 e0 05          	shl    $0x5,%rax
+  804231:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804235:	48 01 e8             	add    %rbp,%rax
+  804238:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  80423e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  804244:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804247:	c1 e0 0c             	shl    $0xc,%eax
+  80424a:	48 63 d0             	movslq %eax,%rdx
+  80424d:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  804254:	48 01 c2             	add    %rax,%rdx
+  804257:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80425a:	48 98                	cltq
+  80425c:	48 c1 e0 05          	shl    $0x5,%rax
+  804260:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804264:	48 01 e8             	add    %rbp,%rax
+  804267:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  80426d:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  804270:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804273:	48 98                	cltq
+  804275:	48 c1 e0 05          	shl    $0x5,%rax
+  804279:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80427d:	48 01 e8             	add    %rbp,%rax
+  804280:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  804287:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  80428d:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  80428f:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804293:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804296:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  804299:	7c 8d                	jl     804228 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  80429b:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8042a2:	74 27                	je     8042cb <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8042a4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8042a7:	48 63 d0             	movslq %eax,%rdx
+  8042aa:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8042b1:	48 89 d6             	mov    %rdx,%rsi
+  8042b4:	48 89 c7             	mov    %rax,%rdi
+  8042b7:	49 89 df             	mov    %rbx,%r15
+  8042ba:	48 b8 9f 8f ff ff ff 	movabs $0xffffffffffff8f9f,%rax
+  8042c1:	ff ff ff 
+  8042c4:	48 01 d8             	add    %rbx,%rax
+  8042c7:	ff d0                	call   *%rax
+  8042c9:	eb 25                	jmp    8042f0 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  8042cb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8042ce:	48 63 d0             	movslq %eax,%rdx
+  8042d1:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8042d8:	48 89 d6             	mov    %rdx,%rsi
+  8042db:	48 89 c7             	mov    %rax,%rdi
+  8042de:	49 89 df             	mov    %rbx,%r15
+  8042e1:	48 b8 fd 8f ff ff ff 	movabs $0xffffffffffff8ffd,%rax
+  8042e8:	ff ff ff 
+  8042eb:	48 01 d8             	add    %rbx,%rax
+  8042ee:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8042f0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  8042f3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8042f7:	79 05                	jns    8042fe <ipc_window_batch+0x13d>
+			return r;
+  8042f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8042fc:	eb 2a                	jmp    804328 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  8042fe:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804301:	c1 e0 0c             	shl    $0xc,%eax
+  804304:	48 98                	cltq
+  804306:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  80430d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804310:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  804316:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  80431d:	0f 8f de fe ff ff    	jg     804201 <ipc_window_batch+0x40>
+	}
+	return 0;
+  804323:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804328:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  80432f:	5b                   	pop    %rbx
+  804330:	41 5f                	pop    %r15
+  804332:	5d                   	pop    %rbp
+  804333:	c3                   	ret
+
+0000000000804334 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  804334:	55                   	push   %rbp
+  804335:	48 89 e5             	mov    %rsp,%rbp
+  804338:	48 83 ec 10          	sub    $0x10,%rsp
+  80433c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80433c <ipc_map_window+0x8>
+  804343:	49 bb 0c 5d 00 00 00 	movabs $0x5d0c,%r11
+  80434a:	00 00 00 
+  80434d:	4c 01 d8             	add    %r11,%rax
+  804350:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804354:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  804357:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80435a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80435e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804363:	bf 01 00 00 00       	mov    $0x1,%edi
+  804368:	49 b8 79 a1 ff ff ff 	movabs $0xffffffffffffa179,%r8
+  80436f:	ff ff ff 
+  804372:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  804376:	ff d0                	call   *%rax
+}
+  804378:	c9                   	leave
+  804379:	c3                   	ret
+
+000000000080437a <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  80437a:	55                   	push   %rbp
+  80437b:	48 89 e5             	mov    %rsp,%rbp
+  80437e:	48 83 ec 10          	sub    $0x10,%rsp
+  804382:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804382 <ipc_unmap_window+0x8>
+  804389:	49 bb c6 5c 00 00 00 	movabs $0x5cc6,%r11
+  804390:	00 00 00 
+  804393:	4c 01 d8             	add    %r11,%rax
+  804396:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80439a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  80439d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8043a0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8043a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043ae:	49 b8 79 a1 ff ff ff 	movabs $0xffffffffffffa179,%r8
+  8043b5:	ff ff ff 
+  8043b8:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8043bc:	ff d0                	call   *%rax
+}
+  8043be:	c9                   	leave
+  8043bf:	c3                   	ret
+
+00000000008043c0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8043c0:	55                   	push   %rbp
+  8043c1:	48 89 e5             	mov    %rsp,%rbp
+  8043c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8043c8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8043c8 <ipc_find_env+0x8>
+  8043cf:	49 bb 80 5c 00 00 00 	movabs $0x5c80,%r11
+  8043d6:	00 00 00 
+  8043d9:	4c 01 d8             	add    %r11,%rax
+  8043dc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  8043df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8043e6:	eb 57                	jmp    80443f <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  8043e8:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8043ef:	ff ff ff 
+  8043f2:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8043f6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8043f9:	48 63 d2             	movslq %edx,%rdx
+  8043fc:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  804403:	48 01 ca             	add    %rcx,%rdx
+  804406:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  80440d:	8b 12                	mov    (%rdx),%edx
+  80440f:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  804412:	75 27                	jne    80443b <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  804414:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80441b:	ff ff ff 
+  80441e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  804422:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804425:	48 98                	cltq
+  804427:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80442e:	48 01 d0             	add    %rdx,%rax
+  804431:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804437:	8b 00                	mov    (%rax),%eax
+  804439:	eb 12                	jmp    80444d <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  80443b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80443f:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804446:	7e a0                	jle    8043e8 <ipc_find_env+0x28>
+	}
+	return 0;
+  804448:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80444d:	c9                   	leave
+  80444e:	c3                   	ret
+
+000000000080444f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80444f:	55                   	push   %rbp
+  804450:	48 89 e5             	mov    %rsp,%rbp
+  804453:	48 83 ec 08          	sub    $0x8,%rsp
+  804457:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804457 <fd2num+0x8>
+  80445e:	49 bb f1 5b 00 00 00 	movabs $0x5bf1,%r11
+  804465:	00 00 00 
+  804468:	4c 01 d8             	add    %r11,%rax
+  80446b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80446f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804473:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80447a:	ff ff ff 
+  80447d:	48 01 d0             	add    %rdx,%rax
+  804480:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  804484:	c9                   	leave
+  804485:	c3                   	ret
+
+0000000000804486 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  804486:	55                   	push   %rbp
+  804487:	48 89 e5             	mov    %rsp,%rbp
+  80448a:	48 83 ec 08          	sub    $0x8,%rsp
+  80448e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80448e <fd2data+0x8>
+  804495:	49 bb ba 5b 00 00 00 	movabs $0x5bba,%r11
+  80449c:	00 00 00 
+  80449f:	4c 01 d8             	add    %r11,%rax
+  8044a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8044a6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044aa:	48 89 d7             	mov    %rdx,%rdi
+  8044ad:	48 ba 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rdx
+  8044b4:	ff ff ff 
+  8044b7:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8044bb:	ff d0                	call   *%rax
+  8044bd:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8044c3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8044c7:	c9                   	leave
+  8044c8:	c3                   	ret
+
+00000000008044c9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8044c9:	55                   	push   %rbp
+  8044ca:	48 89 e5             	mov    %rsp,%rbp
+  8044cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8044d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044d1 <fd_alloc+0x8>
+  8044d8:	49 bb 77 5b 00 00 00 	movabs $0x5b77,%r11
+  8044df:	00 00 00 
+  8044e2:	4c 01 d8             	add    %r11,%rax
+  8044e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8044e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8044f0:	eb 75                	jmp    804567 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8044f2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8044f5:	48 63 d2             	movslq %edx,%rdx
+  8044f8:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8044ff:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804503:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  804507:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80450b:	48 89 d1             	mov    %rdx,%rcx
+  80450e:	48 c1 e9 15          	shr    $0x15,%rcx
+  804512:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  804519:	ff ff ff 
+  80451c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  804520:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  804524:	83 e2 01             	and    $0x1,%edx
+  804527:	48 85 d2             	test   %rdx,%rdx
+  80452a:	74 25                	je     804551 <fd_alloc+0x88>
+  80452c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804530:	48 89 d1             	mov    %rdx,%rcx
+  804533:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804537:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80453e:	ff ff ff 
+  804541:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  804545:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  804549:	83 e2 01             	and    $0x1,%edx
+  80454c:	48 85 d2             	test   %rdx,%rdx
+  80454f:	75 12                	jne    804563 <fd_alloc+0x9a>
+			*fd_store = fd;
+  804551:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804555:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804559:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80455c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804561:	eb 1a                	jmp    80457d <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  804563:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804567:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80456b:	7e 85                	jle    8044f2 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  80456d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804571:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  804578:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  80457d:	c9                   	leave
+  80457e:	c3                   	ret
+
+000000000080457f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80457f:	55                   	push   %rbp
+  804580:	48 89 e5             	mov    %rsp,%rbp
+  804583:	48 83 ec 20          	sub    $0x20,%rsp
+  804587:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804587 <fd_lookup+0x8>
+  80458e:	49 bb c1 5a 00 00 00 	movabs $0x5ac1,%r11
+  804595:	00 00 00 
+  804598:	4c 01 d8             	add    %r11,%rax
+  80459b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80459e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8045a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045a6:	78 06                	js     8045ae <fd_lookup+0x2f>
+  8045a8:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8045ac:	7e 07                	jle    8045b5 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8045ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045b3:	eb 73                	jmp    804628 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8045b5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8045b8:	48 63 d2             	movslq %edx,%rdx
+  8045bb:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8045c2:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8045c6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8045ca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045ce:	48 89 d1             	mov    %rdx,%rcx
+  8045d1:	48 c1 e9 15          	shr    $0x15,%rcx
+  8045d5:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8045dc:	ff ff ff 
+  8045df:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8045e3:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8045e7:	83 e2 01             	and    $0x1,%edx
+  8045ea:	48 85 d2             	test   %rdx,%rdx
+  8045ed:	74 22                	je     804611 <fd_lookup+0x92>
+  8045ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045f3:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8045f7:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  8045fe:	ff ff ff 
+  804601:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  804605:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804609:	83 e0 01             	and    $0x1,%eax
+  80460c:	48 85 c0             	test   %rax,%rax
+  80460f:	75 07                	jne    804618 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  804611:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804616:	eb 10                	jmp    804628 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  804618:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80461c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804620:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  804623:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804628:	c9                   	leave
+  804629:	c3                   	ret
+
+000000000080462a <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  80462a:	55                   	push   %rbp
+  80462b:	48 89 e5             	mov    %rsp,%rbp
+  80462e:	41 57                	push   %r15
+  804630:	53                   	push   %rbx
+  804631:	48 83 ec 30          	sub    $0x30,%rsp
+  804635:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804635 <fd_close+0xb>
+  80463c:	49 bb 13 5a 00 00 00 	movabs $0x5a13,%r11
+  804643:	00 00 00 
+  804646:	4c 01 db             	add    %r11,%rbx
+  804649:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80464d:	89 f0                	mov    %esi,%eax
+  80464f:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  804652:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804656:	48 89 c7             	mov    %rax,%rdi
+  804659:	48 b8 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rax
+  804660:	ff ff ff 
+  804663:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804667:	ff d0                	call   *%rax
+  804669:	89 c2                	mov    %eax,%edx
+  80466b:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80466f:	48 89 c6             	mov    %rax,%rsi
+  804672:	89 d7                	mov    %edx,%edi
+  804674:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  80467b:	ff ff ff 
+  80467e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804682:	ff d0                	call   *%rax
+  804684:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804687:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80468b:	78 0a                	js     804697 <fd_close+0x6d>
+	    || fd != fd2)
+  80468d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804691:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  804695:	74 12                	je     8046a9 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  804697:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80469b:	74 05                	je     8046a2 <fd_close+0x78>
+  80469d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046a0:	eb 7a                	jmp    80471c <fd_close+0xf2>
+  8046a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046a7:	eb 73                	jmp    80471c <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8046a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ad:	8b 00                	mov    (%rax),%eax
+  8046af:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8046b3:	48 89 d6             	mov    %rdx,%rsi
+  8046b6:	89 c7                	mov    %eax,%edi
+  8046b8:	48 b8 dd a6 ff ff ff 	movabs $0xffffffffffffa6dd,%rax
+  8046bf:	ff ff ff 
+  8046c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046c6:	ff d0                	call   *%rax
+  8046c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046cf:	78 2a                	js     8046fb <fd_close+0xd1>
+		if (dev->dev_close)
+  8046d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046d5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8046d9:	48 85 c0             	test   %rax,%rax
+  8046dc:	74 16                	je     8046f4 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8046de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046e2:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8046e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ea:	48 89 c7             	mov    %rax,%rdi
+  8046ed:	ff d2                	call   *%rdx
+  8046ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046f2:	eb 07                	jmp    8046fb <fd_close+0xd1>
+		else
+			r = 0;
+  8046f4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8046fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ff:	48 89 c6             	mov    %rax,%rsi
+  804702:	bf 00 00 00 00       	mov    $0x0,%edi
+  804707:	49 89 df             	mov    %rbx,%r15
+  80470a:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  804711:	ff ff ff 
+  804714:	48 01 d8             	add    %rbx,%rax
+  804717:	ff d0                	call   *%rax
+	return r;
+  804719:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80471c:	48 83 c4 30          	add    $0x30,%rsp
+  804720:	5b                   	pop    %rbx
+  804721:	41 5f                	pop    %r15
+  804723:	5d                   	pop    %rbp
+  804724:	c3                   	ret
+
+0000000000804725 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  804725:	55                   	push   %rbp
+  804726:	48 89 e5             	mov    %rsp,%rbp
+  804729:	41 57                	push   %r15
+  80472b:	48 83 ec 28          	sub    $0x28,%rsp
+  80472f:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80472f <dev_lookup+0xa>
+  804736:	49 bb 19 59 00 00 00 	movabs $0x5919,%r11
+  80473d:	00 00 00 
+  804740:	4c 01 d9             	add    %r11,%rcx
+  804743:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804746:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80474a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804751:	eb 45                	jmp    804798 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  804753:	48 ba f8 01 00 00 00 	movabs $0x1f8,%rdx
+  80475a:	00 00 00 
+  80475d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804760:	48 98                	cltq
+  804762:	48 01 ca             	add    %rcx,%rdx
+  804765:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804769:	8b 00                	mov    (%rax),%eax
+  80476b:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80476e:	75 24                	jne    804794 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  804770:	48 ba f8 01 00 00 00 	movabs $0x1f8,%rdx
+  804777:	00 00 00 
+  80477a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80477d:	48 98                	cltq
+  80477f:	48 01 ca             	add    %rcx,%rdx
+  804782:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804786:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80478a:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80478d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804792:	eb 74                	jmp    804808 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  804794:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804798:	48 ba f8 01 00 00 00 	movabs $0x1f8,%rdx
+  80479f:	00 00 00 
+  8047a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047a5:	48 98                	cltq
+  8047a7:	48 01 ca             	add    %rcx,%rdx
+  8047aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8047ae:	48 85 c0             	test   %rax,%rax
+  8047b1:	75 a0                	jne    804753 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8047b3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8047ba:	ff ff ff 
+  8047bd:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8047c1:	48 8b 00             	mov    (%rax),%rax
+  8047c4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8047ca:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8047cd:	89 c6                	mov    %eax,%esi
+  8047cf:	48 b8 58 e1 ff ff ff 	movabs $0xffffffffffffe158,%rax
+  8047d6:	ff ff ff 
+  8047d9:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8047dd:	48 89 c7             	mov    %rax,%rdi
+  8047e0:	49 89 cf             	mov    %rcx,%r15
+  8047e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e8:	49 b8 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%r8
+  8047ef:	ff ff ff 
+  8047f2:	49 01 c8             	add    %rcx,%r8
+  8047f5:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8047f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047fc:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  804803:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  804808:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80480c:	c9                   	leave
+  80480d:	c3                   	ret
+
+000000000080480e <close>:
+
+int
+close(int fdnum)
+{
+  80480e:	55                   	push   %rbp
+  80480f:	48 89 e5             	mov    %rsp,%rbp
+  804812:	53                   	push   %rbx
+  804813:	48 83 ec 28          	sub    $0x28,%rsp
+  804817:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804817 <close+0x9>
+  80481e:	49 bb 31 58 00 00 00 	movabs $0x5831,%r11
+  804825:	00 00 00 
+  804828:	4c 01 db             	add    %r11,%rbx
+  80482b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80482e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804832:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804835:	48 89 d6             	mov    %rdx,%rsi
+  804838:	89 c7                	mov    %eax,%edi
+  80483a:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  804841:	ff ff ff 
+  804844:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804848:	ff d0                	call   *%rax
+  80484a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80484d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804851:	79 05                	jns    804858 <close+0x4a>
+		return r;
+  804853:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804856:	eb 1c                	jmp    804874 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  804858:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80485c:	be 01 00 00 00       	mov    $0x1,%esi
+  804861:	48 89 c7             	mov    %rax,%rdi
+  804864:	48 b8 e2 a5 ff ff ff 	movabs $0xffffffffffffa5e2,%rax
+  80486b:	ff ff ff 
+  80486e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804872:	ff d0                	call   *%rax
+}
+  804874:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804878:	c9                   	leave
+  804879:	c3                   	ret
+
+000000000080487a <close_all>:
+
+void
+close_all(void)
+{
+  80487a:	55                   	push   %rbp
+  80487b:	48 89 e5             	mov    %rsp,%rbp
+  80487e:	53                   	push   %rbx
+  80487f:	48 83 ec 18          	sub    $0x18,%rsp
+  804883:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804883 <close_all+0x9>
+  80488a:	49 bb c5 57 00 00 00 	movabs $0x57c5,%r11
+  804891:	00 00 00 
+  804894:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  804897:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80489e:	eb 19                	jmp    8048b9 <close_all+0x3f>
+		close(i);
+  8048a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048a3:	89 c7                	mov    %eax,%edi
+  8048a5:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  8048ac:	ff ff ff 
+  8048af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048b3:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8048b5:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8048b9:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8048bd:	7e e1                	jle    8048a0 <close_all+0x26>
+}
+  8048bf:	90                   	nop
+  8048c0:	90                   	nop
+  8048c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8048c5:	c9                   	leave
+  8048c6:	c3                   	ret
+
+00000000008048c7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8048c7:	55                   	push   %rbp
+  8048c8:	48 89 e5             	mov    %rsp,%rbp
+  8048cb:	41 57                	push   %r15
+  8048cd:	53                   	push   %rbx
+  8048ce:	48 83 ec 40          	sub    $0x40,%rsp
+  8048d2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048d2 <dup+0xb>
+  8048d9:	49 bb 76 57 00 00 00 	movabs $0x5776,%r11
+  8048e0:	00 00 00 
+  8048e3:	4c 01 db             	add    %r11,%rbx
+  8048e6:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8048e9:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8048ec:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8048f0:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8048f3:	48 89 d6             	mov    %rdx,%rsi
+  8048f6:	89 c7                	mov    %eax,%edi
+  8048f8:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  8048ff:	ff ff ff 
+  804902:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804906:	ff d0                	call   *%rax
+  804908:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80490b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80490f:	79 08                	jns    804919 <dup+0x52>
+		return r;
+  804911:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804914:	e9 a4 01 00 00       	jmp    804abd <dup+0x1f6>
+	close(newfdnum);
+  804919:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80491c:	89 c7                	mov    %eax,%edi
+  80491e:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  804925:	ff ff ff 
+  804928:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80492c:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  80492e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804931:	48 98                	cltq
+  804933:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  804939:	48 c1 e0 0c          	shl    $0xc,%rax
+  80493d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  804941:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804945:	48 89 c7             	mov    %rax,%rdi
+  804948:	48 b8 3e a4 ff ff ff 	movabs $0xffffffffffffa43e,%rax
+  80494f:	ff ff ff 
+  804952:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804956:	ff d0                	call   *%rax
+  804958:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  80495c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804960:	48 89 c7             	mov    %rax,%rdi
+  804963:	48 b8 3e a4 ff ff ff 	movabs $0xffffffffffffa43e,%rax
+  80496a:	ff ff ff 
+  80496d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804971:	ff d0                	call   *%rax
+  804973:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  804977:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80497b:	48 c1 e8 15          	shr    $0x15,%rax
+  80497f:	48 89 c2             	mov    %rax,%rdx
+  804982:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  804989:	ff ff ff 
+  80498c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804990:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804994:	83 e0 01             	and    $0x1,%eax
+  804997:	48 85 c0             	test   %rax,%rax
+  80499a:	74 7f                	je     804a1b <dup+0x154>
+  80499c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049a0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8049a4:	48 89 c2             	mov    %rax,%rdx
+  8049a7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8049ae:	ff ff ff 
+  8049b1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8049b5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8049b9:	83 e0 01             	and    $0x1,%eax
+  8049bc:	48 85 c0             	test   %rax,%rax
+  8049bf:	74 5a                	je     804a1b <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8049c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049c5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8049c9:	48 89 c2             	mov    %rax,%rdx
+  8049cc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8049d3:	ff ff ff 
+  8049d6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8049da:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8049de:	25 07 0e 00 00       	and    $0xe07,%eax
+  8049e3:	89 c1                	mov    %eax,%ecx
+  8049e5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8049e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049ed:	41 89 c8             	mov    %ecx,%r8d
+  8049f0:	48 89 d1             	mov    %rdx,%rcx
+  8049f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049f8:	48 89 c6             	mov    %rax,%rsi
+  8049fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a00:	49 89 df             	mov    %rbx,%r15
+  804a03:	48 b8 6b 89 ff ff ff 	movabs $0xffffffffffff896b,%rax
+  804a0a:	ff ff ff 
+  804a0d:	48 01 d8             	add    %rbx,%rax
+  804a10:	ff d0                	call   *%rax
+  804a12:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a15:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a19:	78 5f                	js     804a7a <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  804a1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a1f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a23:	48 89 c2             	mov    %rax,%rdx
+  804a26:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804a2d:	ff ff ff 
+  804a30:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804a34:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804a38:	25 07 0e 00 00       	and    $0xe07,%eax
+  804a3d:	89 c1                	mov    %eax,%ecx
+  804a3f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a43:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a47:	41 89 c8             	mov    %ecx,%r8d
+  804a4a:	48 89 d1             	mov    %rdx,%rcx
+  804a4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a52:	48 89 c6             	mov    %rax,%rsi
+  804a55:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a5a:	49 89 df             	mov    %rbx,%r15
+  804a5d:	48 b8 6b 89 ff ff ff 	movabs $0xffffffffffff896b,%rax
+  804a64:	ff ff ff 
+  804a67:	48 01 d8             	add    %rbx,%rax
+  804a6a:	ff d0                	call   *%rax
+  804a6c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a6f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a73:	78 08                	js     804a7d <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  804a75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804a78:	eb 43                	jmp    804abd <dup+0x1f6>
+			goto err;
+  804a7a:	90                   	nop
+  804a7b:	eb 01                	jmp    804a7e <dup+0x1b7>
+		goto err;
+  804a7d:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  804a7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a82:	48 89 c6             	mov    %rax,%rsi
+  804a85:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a8a:	49 89 df             	mov    %rbx,%r15
+  804a8d:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  804a94:	ff ff ff 
+  804a97:	48 01 d8             	add    %rbx,%rax
+  804a9a:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  804a9c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804aa0:	48 89 c6             	mov    %rax,%rsi
+  804aa3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aa8:	49 89 df             	mov    %rbx,%r15
+  804aab:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  804ab2:	ff ff ff 
+  804ab5:	48 01 d8             	add    %rbx,%rax
+  804ab8:	ff d0                	call   *%rax
+	return r;
+  804aba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804abd:	48 83 c4 40          	add    $0x40,%rsp
+  804ac1:	5b                   	pop    %rbx
+  804ac2:	41 5f                	pop    %r15
+  804ac4:	5d                   	pop    %rbp
+  804ac5:	c3                   	ret
+
+0000000000804ac6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  804ac6:	55                   	push   %rbp
+  804ac7:	48 89 e5             	mov    %rsp,%rbp
+  804aca:	41 57                	push   %r15
+  804acc:	53                   	push   %rbx
+  804acd:	48 83 ec 40          	sub    $0x40,%rsp
+  804ad1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ad1 <read+0xb>
+  804ad8:	49 bb 77 55 00 00 00 	movabs $0x5577,%r11
+  804adf:	00 00 00 
+  804ae2:	4c 01 db             	add    %r11,%rbx
+  804ae5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804ae8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804aec:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804af0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804af4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804af7:	48 89 d6             	mov    %rdx,%rsi
+  804afa:	89 c7                	mov    %eax,%edi
+  804afc:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  804b03:	ff ff ff 
+  804b06:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b0a:	ff d0                	call   *%rax
+  804b0c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b0f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b13:	78 28                	js     804b3d <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804b15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b19:	8b 00                	mov    (%rax),%eax
+  804b1b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804b1f:	48 89 d6             	mov    %rdx,%rsi
+  804b22:	89 c7                	mov    %eax,%edi
+  804b24:	48 b8 dd a6 ff ff ff 	movabs $0xffffffffffffa6dd,%rax
+  804b2b:	ff ff ff 
+  804b2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b32:	ff d0                	call   *%rax
+  804b34:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b37:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b3b:	79 08                	jns    804b45 <read+0x7f>
+		return r;
+  804b3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b40:	e9 8b 00 00 00       	jmp    804bd0 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804b45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b49:	8b 40 08             	mov    0x8(%rax),%eax
+  804b4c:	83 e0 03             	and    $0x3,%eax
+  804b4f:	83 f8 01             	cmp    $0x1,%eax
+  804b52:	75 4b                	jne    804b9f <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804b54:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804b5b:	ff ff ff 
+  804b5e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804b62:	48 8b 00             	mov    (%rax),%rax
+  804b65:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804b6b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804b6e:	89 c6                	mov    %eax,%esi
+  804b70:	48 b8 77 e1 ff ff ff 	movabs $0xffffffffffffe177,%rax
+  804b77:	ff ff ff 
+  804b7a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b7e:	48 89 c7             	mov    %rax,%rdi
+  804b81:	49 89 df             	mov    %rbx,%r15
+  804b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b89:	48 b9 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rcx
+  804b90:	ff ff ff 
+  804b93:	48 01 d9             	add    %rbx,%rcx
+  804b96:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804b98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804b9d:	eb 31                	jmp    804bd0 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  804b9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ba3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ba7:	48 85 c0             	test   %rax,%rax
+  804baa:	75 07                	jne    804bb3 <read+0xed>
+		return -E_NOT_SUPP;
+  804bac:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804bb1:	eb 1d                	jmp    804bd0 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  804bb3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bb7:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  804bbb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bbf:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804bc3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804bc7:	48 89 ce             	mov    %rcx,%rsi
+  804bca:	48 89 c7             	mov    %rax,%rdi
+  804bcd:	41 ff d0             	call   *%r8
+}
+  804bd0:	48 83 c4 40          	add    $0x40,%rsp
+  804bd4:	5b                   	pop    %rbx
+  804bd5:	41 5f                	pop    %r15
+  804bd7:	5d                   	pop    %rbp
+  804bd8:	c3                   	ret
+
+0000000000804bd9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  804bd9:	55                   	push   %rbp
+  804bda:	48 89 e5             	mov    %rsp,%rbp
+  804bdd:	53                   	push   %rbx
+  804bde:	48 83 ec 38          	sub    $0x38,%rsp
+  804be2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804be2 <readn+0x9>
+  804be9:	49 bb 66 54 00 00 00 	movabs $0x5466,%r11
+  804bf0:	00 00 00 
+  804bf3:	4c 01 db             	add    %r11,%rbx
+  804bf6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804bf9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804bfd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  804c01:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804c08:	eb 4b                	jmp    804c55 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  804c0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c0d:	48 98                	cltq
+  804c0f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804c13:	48 29 c2             	sub    %rax,%rdx
+  804c16:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c19:	48 63 c8             	movslq %eax,%rcx
+  804c1c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c20:	48 01 c1             	add    %rax,%rcx
+  804c23:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c26:	48 89 ce             	mov    %rcx,%rsi
+  804c29:	89 c7                	mov    %eax,%edi
+  804c2b:	48 b8 7e aa ff ff ff 	movabs $0xffffffffffffaa7e,%rax
+  804c32:	ff ff ff 
+  804c35:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c39:	ff d0                	call   *%rax
+  804c3b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  804c3e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804c42:	79 05                	jns    804c49 <readn+0x70>
+			return m;
+  804c44:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c47:	eb 1d                	jmp    804c66 <readn+0x8d>
+		if (m == 0)
+  804c49:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804c4d:	74 13                	je     804c62 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  804c4f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c52:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804c55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c58:	48 98                	cltq
+  804c5a:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  804c5e:	72 aa                	jb     804c0a <readn+0x31>
+  804c60:	eb 01                	jmp    804c63 <readn+0x8a>
+			break;
+  804c62:	90                   	nop
+	}
+	return tot;
+  804c63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804c66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804c6a:	c9                   	leave
+  804c6b:	c3                   	ret
+
+0000000000804c6c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  804c6c:	55                   	push   %rbp
+  804c6d:	48 89 e5             	mov    %rsp,%rbp
+  804c70:	41 57                	push   %r15
+  804c72:	53                   	push   %rbx
+  804c73:	48 83 ec 40          	sub    $0x40,%rsp
+  804c77:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c77 <write+0xb>
+  804c7e:	49 bb d1 53 00 00 00 	movabs $0x53d1,%r11
+  804c85:	00 00 00 
+  804c88:	4c 01 db             	add    %r11,%rbx
+  804c8b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804c8e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804c92:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804c96:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804c9a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804c9d:	48 89 d6             	mov    %rdx,%rsi
+  804ca0:	89 c7                	mov    %eax,%edi
+  804ca2:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  804ca9:	ff ff ff 
+  804cac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cb0:	ff d0                	call   *%rax
+  804cb2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cb5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cb9:	78 28                	js     804ce3 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804cbb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cbf:	8b 00                	mov    (%rax),%eax
+  804cc1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804cc5:	48 89 d6             	mov    %rdx,%rsi
+  804cc8:	89 c7                	mov    %eax,%edi
+  804cca:	48 b8 dd a6 ff ff ff 	movabs $0xffffffffffffa6dd,%rax
+  804cd1:	ff ff ff 
+  804cd4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cd8:	ff d0                	call   *%rax
+  804cda:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cdd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ce1:	79 08                	jns    804ceb <write+0x7f>
+		return r;
+  804ce3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ce6:	e9 8a 00 00 00       	jmp    804d75 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804ceb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cef:	8b 40 08             	mov    0x8(%rax),%eax
+  804cf2:	83 e0 03             	and    $0x3,%eax
+  804cf5:	85 c0                	test   %eax,%eax
+  804cf7:	75 4b                	jne    804d44 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  804cf9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804d00:	ff ff ff 
+  804d03:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804d07:	48 8b 00             	mov    (%rax),%rax
+  804d0a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804d10:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804d13:	89 c6                	mov    %eax,%esi
+  804d15:	48 b8 93 e1 ff ff ff 	movabs $0xffffffffffffe193,%rax
+  804d1c:	ff ff ff 
+  804d1f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d23:	48 89 c7             	mov    %rax,%rdi
+  804d26:	49 89 df             	mov    %rbx,%r15
+  804d29:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d2e:	48 b9 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rcx
+  804d35:	ff ff ff 
+  804d38:	48 01 d9             	add    %rbx,%rcx
+  804d3b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804d3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804d42:	eb 31                	jmp    804d75 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  804d44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d48:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804d4c:	48 85 c0             	test   %rax,%rax
+  804d4f:	75 07                	jne    804d58 <write+0xec>
+		return -E_NOT_SUPP;
+  804d51:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804d56:	eb 1d                	jmp    804d75 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  804d58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d5c:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  804d60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d64:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804d68:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804d6c:	48 89 ce             	mov    %rcx,%rsi
+  804d6f:	48 89 c7             	mov    %rax,%rdi
+  804d72:	41 ff d0             	call   *%r8
+}
+  804d75:	48 83 c4 40          	add    $0x40,%rsp
+  804d79:	5b                   	pop    %rbx
+  804d7a:	41 5f                	pop    %r15
+  804d7c:	5d                   	pop    %rbp
+  804d7d:	c3                   	ret
+
+0000000000804d7e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  804d7e:	55                   	push   %rbp
+  804d7f:	48 89 e5             	mov    %rsp,%rbp
+  804d82:	48 83 ec 18          	sub    $0x18,%rsp
+  804d86:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d86 <seek+0x8>
+  804d8d:	49 bb c2 52 00 00 00 	movabs $0x52c2,%r11
+  804d94:	00 00 00 
+  804d97:	4c 01 d8             	add    %r11,%rax
+  804d9a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804d9d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804da0:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  804da4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804da7:	48 89 ce             	mov    %rcx,%rsi
+  804daa:	89 d7                	mov    %edx,%edi
+  804dac:	48 ba 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rdx
+  804db3:	ff ff ff 
+  804db6:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804dba:	ff d0                	call   *%rax
+  804dbc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804dbf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dc3:	79 05                	jns    804dca <seek+0x4c>
+		return r;
+  804dc5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804dc8:	eb 0f                	jmp    804dd9 <seek+0x5b>
+	fd->fd_offset = offset;
+  804dca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804dce:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804dd1:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  804dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dd9:	c9                   	leave
+  804dda:	c3                   	ret
+
+0000000000804ddb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  804ddb:	55                   	push   %rbp
+  804ddc:	48 89 e5             	mov    %rsp,%rbp
+  804ddf:	41 57                	push   %r15
+  804de1:	53                   	push   %rbx
+  804de2:	48 83 ec 30          	sub    $0x30,%rsp
+  804de6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804de6 <ftruncate+0xb>
+  804ded:	49 bb 62 52 00 00 00 	movabs $0x5262,%r11
+  804df4:	00 00 00 
+  804df7:	4c 01 db             	add    %r11,%rbx
+  804dfa:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804dfd:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804e00:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804e04:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804e07:	48 89 d6             	mov    %rdx,%rsi
+  804e0a:	89 c7                	mov    %eax,%edi
+  804e0c:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  804e13:	ff ff ff 
+  804e16:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e1a:	ff d0                	call   *%rax
+  804e1c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e1f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e23:	78 28                	js     804e4d <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804e25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e29:	8b 00                	mov    (%rax),%eax
+  804e2b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804e2f:	48 89 d6             	mov    %rdx,%rsi
+  804e32:	89 c7                	mov    %eax,%edi
+  804e34:	48 b8 dd a6 ff ff ff 	movabs $0xffffffffffffa6dd,%rax
+  804e3b:	ff ff ff 
+  804e3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e42:	ff d0                	call   *%rax
+  804e44:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e47:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e4b:	79 08                	jns    804e55 <ftruncate+0x7a>
+		return r;
+  804e4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e50:	e9 83 00 00 00       	jmp    804ed8 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804e55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e59:	8b 40 08             	mov    0x8(%rax),%eax
+  804e5c:	83 e0 03             	and    $0x3,%eax
+  804e5f:	85 c0                	test   %eax,%eax
+  804e61:	75 4b                	jne    804eae <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804e63:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804e6a:	ff ff ff 
+  804e6d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804e71:	48 8b 00             	mov    (%rax),%rax
+  804e74:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804e7a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804e7d:	89 c6                	mov    %eax,%esi
+  804e7f:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  804e86:	ff ff ff 
+  804e89:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e8d:	48 89 c7             	mov    %rax,%rdi
+  804e90:	49 89 df             	mov    %rbx,%r15
+  804e93:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e98:	48 b9 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rcx
+  804e9f:	ff ff ff 
+  804ea2:	48 01 d9             	add    %rbx,%rcx
+  804ea5:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804ea7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804eac:	eb 2a                	jmp    804ed8 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  804eae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804eb2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  804eb6:	48 85 c0             	test   %rax,%rax
+  804eb9:	75 07                	jne    804ec2 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  804ebb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804ec0:	eb 16                	jmp    804ed8 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  804ec2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ec6:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804eca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ece:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804ed1:	89 d6                	mov    %edx,%esi
+  804ed3:	48 89 c7             	mov    %rax,%rdi
+  804ed6:	ff d1                	call   *%rcx
+}
+  804ed8:	48 83 c4 30          	add    $0x30,%rsp
+  804edc:	5b                   	pop    %rbx
+  804edd:	41 5f                	pop    %r15
+  804edf:	5d                   	pop    %rbp
+  804ee0:	c3                   	ret
+
+0000000000804ee1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804ee1:	55                   	push   %rbp
+  804ee2:	48 89 e5             	mov    %rsp,%rbp
+  804ee5:	53                   	push   %rbx
+  804ee6:	48 83 ec 38          	sub    $0x38,%rsp
+  804eea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804eea <fstat+0x9>
+  804ef1:	49 bb 5e 51 00 00 00 	movabs $0x515e,%r11
+  804ef8:	00 00 00 
+  804efb:	4c 01 db             	add    %r11,%rbx
+  804efe:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804f01:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804f05:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804f09:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804f0c:	48 89 d6             	mov    %rdx,%rsi
+  804f0f:	89 c7                	mov    %eax,%edi
+  804f11:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  804f18:	ff ff ff 
+  804f1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f1f:	ff d0                	call   *%rax
+  804f21:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f24:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f28:	78 28                	js     804f52 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804f2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f2e:	8b 00                	mov    (%rax),%eax
+  804f30:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804f34:	48 89 d6             	mov    %rdx,%rsi
+  804f37:	89 c7                	mov    %eax,%edi
+  804f39:	48 b8 dd a6 ff ff ff 	movabs $0xffffffffffffa6dd,%rax
+  804f40:	ff ff ff 
+  804f43:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f47:	ff d0                	call   *%rax
+  804f49:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f4c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f50:	79 05                	jns    804f57 <fstat+0x76>
+		return r;
+  804f52:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f55:	eb 5e                	jmp    804fb5 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804f57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f5b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804f5f:	48 85 c0             	test   %rax,%rax
+  804f62:	75 07                	jne    804f6b <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804f64:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804f69:	eb 4a                	jmp    804fb5 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804f6b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f6f:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804f72:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f76:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804f7d:	00 00 00 
+	stat->st_isdir = 0;
+  804f80:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f84:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804f8b:	00 00 00 
+	stat->st_dev = dev;
+  804f8e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f92:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f96:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804f9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fa1:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804fa5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fa9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804fad:	48 89 d6             	mov    %rdx,%rsi
+  804fb0:	48 89 c7             	mov    %rax,%rdi
+  804fb3:	ff d1                	call   *%rcx
+}
+  804fb5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804fb9:	c9                   	leave
+  804fba:	c3                   	ret
+
+0000000000804fbb <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804fbb:	55                   	push   %rbp
+  804fbc:	48 89 e5             	mov    %rsp,%rbp
+  804fbf:	41 57                	push   %r15
+  804fc1:	53                   	push   %rbx
+  804fc2:	48 83 ec 20          	sub    $0x20,%rsp
+  804fc6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fc6 <stat+0xb>
+  804fcd:	49 bb 82 50 00 00 00 	movabs $0x5082,%r11
+  804fd4:	00 00 00 
+  804fd7:	4c 01 db             	add    %r11,%rbx
+  804fda:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804fde:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804fe2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fe6:	be 00 00 00 00       	mov    $0x0,%esi
+  804feb:	48 89 c7             	mov    %rax,%rdi
+  804fee:	49 89 df             	mov    %rbx,%r15
+  804ff1:	48 b8 4d b2 ff ff ff 	movabs $0xffffffffffffb24d,%rax
+  804ff8:	ff ff ff 
+  804ffb:	48 01 d8             	add    %rbx,%rax
+  804ffe:	ff d0                	call   *%rax
+  805000:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805003:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805007:	79 05                	jns    80500e <stat+0x53>
+		return fd;
+  805009:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80500c:	eb 37                	jmp    805045 <stat+0x8a>
+	r = fstat(fd, stat);
+  80500e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805012:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805015:	48 89 d6             	mov    %rdx,%rsi
+  805018:	89 c7                	mov    %eax,%edi
+  80501a:	48 b8 99 ae ff ff ff 	movabs $0xffffffffffffae99,%rax
+  805021:	ff ff ff 
+  805024:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805028:	ff d0                	call   *%rax
+  80502a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80502d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805030:	89 c7                	mov    %eax,%edi
+  805032:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  805039:	ff ff ff 
+  80503c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805040:	ff d0                	call   *%rax
+	return r;
+  805042:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  805045:	48 83 c4 20          	add    $0x20,%rsp
+  805049:	5b                   	pop    %rbx
+  80504a:	41 5f                	pop    %r15
+  80504c:	5d                   	pop    %rbp
+  80504d:	c3                   	ret
+
+000000000080504e <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80504e:	55                   	push   %rbp
+  80504f:	48 89 e5             	mov    %rsp,%rbp
+  805052:	41 57                	push   %r15
+  805054:	53                   	push   %rbx
+  805055:	48 83 ec 10          	sub    $0x10,%rsp
+  805059:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805059 <fsipc+0xb>
+  805060:	49 bb ef 4f 00 00 00 	movabs $0x4fef,%r11
+  805067:	00 00 00 
+  80506a:	4c 01 db             	add    %r11,%rbx
+  80506d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805070:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  805074:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  80507b:	00 00 00 
+  80507e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805081:	85 c0                	test   %eax,%eax
+  805083:	75 24                	jne    8050a9 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  805085:	bf 01 00 00 00       	mov    $0x1,%edi
+  80508a:	49 89 df             	mov    %rbx,%r15
+  80508d:	48 b8 78 a3 ff ff ff 	movabs $0xffffffffffffa378,%rax
+  805094:	ff ff ff 
+  805097:	48 01 d8             	add    %rbx,%rax
+  80509a:	ff d0                	call   *%rax
+  80509c:	48 ba e0 1f 00 00 00 	movabs $0x1fe0,%rdx
+  8050a3:	00 00 00 
+  8050a6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8050a9:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  8050b0:	00 00 00 
+  8050b3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8050b6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8050ba:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8050bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8050c3:	49 89 d0             	mov    %rdx,%r8
+  8050c6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8050cb:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  8050d2:	00 00 00 
+  8050d5:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8050d9:	89 c7                	mov    %eax,%edi
+  8050db:	49 89 df             	mov    %rbx,%r15
+  8050de:	48 b8 97 9d ff ff ff 	movabs $0xffffffffffff9d97,%rax
+  8050e5:	ff ff ff 
+  8050e8:	48 01 d8             	add    %rbx,%rax
+  8050eb:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8050ed:	48 83 c4 10          	add    $0x10,%rsp
+  8050f1:	5b                   	pop    %rbx
+  8050f2:	41 5f                	pop    %r15
+  8050f4:	5d                   	pop    %rbp
+  8050f5:	c3                   	ret
+
+00000000008050f6 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8050f6:	55                   	push   %rbp
+  8050f7:	48 89 e5             	mov    %rsp,%rbp
+  8050fa:	41 57                	push   %r15
+  8050fc:	53                   	push   %rbx
+  8050fd:	48 83 ec 20          	sub    $0x20,%rsp
+  805101:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805101 <fsipc_words+0xb>
+  805108:	49 bb 47 4f 00 00 00 	movabs $0x4f47,%r11
+  80510f:	00 00 00 
+  805112:	4c 01 db             	add    %r11,%rbx
+  805115:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805118:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80511c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  805120:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  805127:	00 00 00 
+  80512a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80512d:	85 c0                	test   %eax,%eax
+  80512f:	75 24                	jne    805155 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  805131:	bf 01 00 00 00       	mov    $0x1,%edi
+  805136:	49 89 df             	mov    %rbx,%r15
+  805139:	48 b8 78 a3 ff ff ff 	movabs $0xffffffffffffa378,%rax
+  805140:	ff ff ff 
+  805143:	48 01 d8             	add    %rbx,%rax
+  805146:	ff d0                	call   *%rax
+  805148:	48 ba e0 1f 00 00 00 	movabs $0x1fe0,%rdx
+  80514f:	00 00 00 
+  805152:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  805155:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  80515c:	00 00 00 
+  80515f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805162:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805166:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80516a:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80516d:	89 c7                	mov    %eax,%edi
+  80516f:	49 89 df             	mov    %rbx,%r15
+  805172:	48 b8 82 9e ff ff ff 	movabs $0xffffffffffff9e82,%rax
+  805179:	ff ff ff 
+  80517c:	48 01 d8             	add    %rbx,%rax
+  80517f:	ff d0                	call   *%rax
+}
+  805181:	48 83 c4 20          	add    $0x20,%rsp
+  805185:	5b                   	pop    %rbx
+  805186:	41 5f                	pop    %r15
+  805188:	5d                   	pop    %rbp
+  805189:	c3                   	ret
+
+000000000080518a <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  80518a:	55                   	push   %rbp
+  80518b:	48 89 e5             	mov    %rsp,%rbp
+  80518e:	41 57                	push   %r15
+  805190:	53                   	push   %rbx
+  805191:	48 83 ec 40          	sub    $0x40,%rsp
+  805195:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805195 <fsipc_pages+0xb>
+  80519c:	49 bb b3 4e 00 00 00 	movabs $0x4eb3,%r11
+  8051a3:	00 00 00 
+  8051a6:	4c 01 db             	add    %r11,%rbx
+  8051a9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8051ac:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8051b0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8051b4:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8051b7:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  8051be:	00 00 00 
+  8051c1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8051c4:	85 c0                	test   %eax,%eax
+  8051c6:	75 24                	jne    8051ec <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8051c8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8051cd:	49 89 df             	mov    %rbx,%r15
+  8051d0:	48 b8 78 a3 ff ff ff 	movabs $0xffffffffffffa378,%rax
+  8051d7:	ff ff ff 
+  8051da:	48 01 d8             	add    %rbx,%rax
+  8051dd:	ff d0                	call   *%rax
+  8051df:	48 ba e0 1f 00 00 00 	movabs $0x1fe0,%rdx
+  8051e6:	00 00 00 
+  8051e9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8051ec:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8051f1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8051f5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8051f8:	48 98                	cltq
+  8051fa:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8051fe:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  805202:	0f 95 c0             	setne  %al
+  805205:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  805208:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80520f:	00 
+  805210:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805214:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805218:	48 01 d0             	add    %rdx,%rax
+  80521b:	48 83 e8 01          	sub    $0x1,%rax
+  80521f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805223:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805227:	ba 00 00 00 00       	mov    $0x0,%edx
+  80522c:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805230:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805234:	48 29 d0             	sub    %rdx,%rax
+  805237:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  80523b:	41 89 c2             	mov    %eax,%r10d
+  80523e:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  805245:	00 00 00 
+  805248:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80524b:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80524f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805253:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  805256:	48 83 ec 08          	sub    $0x8,%rsp
+  80525a:	6a 40                	push   $0x40
+  80525c:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  805261:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  805268:	00 
+  805269:	6a 05                	push   $0x5
+  80526b:	41 89 f9             	mov    %edi,%r9d
+  80526e:	49 89 c8             	mov    %rcx,%r8
+  805271:	44 89 d1             	mov    %r10d,%ecx
+  805274:	89 c7                	mov    %eax,%edi
+  805276:	49 89 df             	mov    %rbx,%r15
+  805279:	48 b8 80 9f ff ff ff 	movabs $0xffffffffffff9f80,%rax
+  805280:	ff ff ff 
+  805283:	48 01 d8             	add    %rbx,%rax
+  805286:	ff d0                	call   *%rax
+  805288:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80528c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805290:	5b                   	pop    %rbx
+  805291:	41 5f                	pop    %r15
+  805293:	5d                   	pop    %rbp
+  805294:	c3                   	ret
+
+0000000000805295 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  805295:	55                   	push   %rbp
+  805296:	48 89 e5             	mov    %rsp,%rbp
+  805299:	41 57                	push   %r15
+  80529b:	53                   	push   %rbx
+  80529c:	48 83 ec 20          	sub    $0x20,%rsp
+  8052a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052a0 <open+0xb>
+  8052a7:	49 bb a8 4d 00 00 00 	movabs $0x4da8,%r11
+  8052ae:	00 00 00 
+  8052b1:	4c 01 db             	add    %r11,%rbx
+  8052b4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8052b8:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8052bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052bf:	48 89 c7             	mov    %rax,%rdi
+  8052c2:	49 89 df             	mov    %rbx,%r15
+  8052c5:	48 b8 b6 7b ff ff ff 	movabs $0xffffffffffff7bb6,%rax
+  8052cc:	ff ff ff 
+  8052cf:	48 01 d8             	add    %rbx,%rax
+  8052d2:	ff d0                	call   *%rax
+  8052d4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8052d9:	7e 0a                	jle    8052e5 <open+0x50>
+		return -E_BAD_PATH;
+  8052db:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8052e0:	e9 18 01 00 00       	jmp    8053fd <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8052e5:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8052e9:	48 89 c7             	mov    %rax,%rdi
+  8052ec:	49 89 df             	mov    %rbx,%r15
+  8052ef:	48 b8 81 a4 ff ff ff 	movabs $0xffffffffffffa481,%rax
+  8052f6:	ff ff ff 
+  8052f9:	48 01 d8             	add    %rbx,%rax
+  8052fc:	ff d0                	call   *%rax
+  8052fe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805301:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805305:	74 08                	je     80530f <open+0x7a>
+		return r;
+  805307:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80530a:	e9 ee 00 00 00       	jmp    8053fd <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80530f:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  805316:	00 00 00 
+  805319:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80531c:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  805323:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805327:	48 89 c6             	mov    %rax,%rsi
+  80532a:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  805331:	00 00 00 
+  805334:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805338:	48 89 c7             	mov    %rax,%rdi
+  80533b:	49 89 df             	mov    %rbx,%r15
+  80533e:	48 b8 4a 7c ff ff ff 	movabs $0xffffffffffff7c4a,%rax
+  805345:	ff ff ff 
+  805348:	48 01 d8             	add    %rbx,%rax
+  80534b:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  80534d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805351:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  805356:	48 89 c6             	mov    %rax,%rsi
+  805359:	bf 00 00 00 00       	mov    $0x0,%edi
+  80535e:	49 89 df             	mov    %rbx,%r15
+  805361:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  805368:	ff ff ff 
+  80536b:	48 01 d8             	add    %rbx,%rax
+  80536e:	ff d0                	call   *%rax
+  805370:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805373:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805377:	74 23                	je     80539c <open+0x107>
+		fd_close(fd,0);
+  805379:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80537d:	be 00 00 00 00       	mov    $0x0,%esi
+  805382:	48 89 c7             	mov    %rax,%rdi
+  805385:	49 89 df             	mov    %rbx,%r15
+  805388:	48 b8 e2 a5 ff ff ff 	movabs $0xffffffffffffa5e2,%rax
+  80538f:	ff ff ff 
+  805392:	48 01 d8             	add    %rbx,%rax
+  805395:	ff d0                	call   *%rax
+		return r;
+  805397:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80539a:	eb 61                	jmp    8053fd <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80539c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053a0:	48 89 c6             	mov    %rax,%rsi
+  8053a3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8053a8:	48 b8 06 b0 ff ff ff 	movabs $0xffffffffffffb006,%rax
+  8053af:	ff ff ff 
+  8053b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053b6:	ff d0                	call   *%rax
+  8053b8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053bf:	74 23                	je     8053e4 <open+0x14f>
+		fd_close(fd,0);
+  8053c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8053ca:	48 89 c7             	mov    %rax,%rdi
+  8053cd:	49 89 df             	mov    %rbx,%r15
+  8053d0:	48 b8 e2 a5 ff ff ff 	movabs $0xffffffffffffa5e2,%rax
+  8053d7:	ff ff ff 
+  8053da:	48 01 d8             	add    %rbx,%rax
+  8053dd:	ff d0                	call   *%rax
+		return r;
+  8053df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053e2:	eb 19                	jmp    8053fd <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8053e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053e8:	48 89 c7             	mov    %rax,%rdi
+  8053eb:	49 89 df             	mov    %rbx,%r15
+  8053ee:	48 b8 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rax
+  8053f5:	ff ff ff 
+  8053f8:	48 01 d8             	add    %rbx,%rax
+  8053fb:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8053fd:	48 83 c4 20          	add    $0x20,%rsp
+  805401:	5b                   	pop    %rbx
+  805402:	41 5f                	pop    %r15
+  805404:	5d                   	pop    %rbp
+  805405:	c3                   	ret
+
+0000000000805406 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  805406:	55                   	push   %rbp
+  805407:	48 89 e5             	mov    %rsp,%rbp
+  80540a:	48 83 ec 20          	sub    $0x20,%rsp
+  80540e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80540e <devfile_flush+0x8>
+  805415:	49 bb 3a 4c 00 00 00 	movabs $0x4c3a,%r11
+  80541c:	00 00 00 
+  80541f:	4c 01 d8             	add    %r11,%rax
+  805422:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  805426:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80542a:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80542d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  805430:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805434:	ba 04 00 00 00       	mov    $0x4,%edx
+  805439:	48 89 ce             	mov    %rcx,%rsi
+  80543c:	bf 06 00 00 00       	mov    $0x6,%edi
+  805441:	48 b9 ae b0 ff ff ff 	movabs $0xffffffffffffb0ae,%rcx
+  805448:	ff ff ff 
+  80544b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80544f:	ff d0                	call   *%rax
+}
+  805451:	c9                   	leave
+  805452:	c3                   	ret
+
+0000000000805453 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  805453:	55                   	push   %rbp
+  805454:	48 89 e5             	mov    %rsp,%rbp
+  805457:	41 57                	push   %r15
+  805459:	53                   	push   %rbx
+  80545a:	48 83 ec 60          	sub    $0x60,%rsp
+  80545e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80545e <devfile_read+0xb>
+  805465:	49 bb ea 4b 00 00 00 	movabs $0x4bea,%r11
+  80546c:	00 00 00 
+  80546f:	4c 01 db             	add    %r11,%rbx
+  805472:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805476:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80547a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80547e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805482:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  805486:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80548a:	8b 50 0c             	mov    0xc(%rax),%edx
+  80548d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805491:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  805493:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805497:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80549b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  80549f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8054a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8054a8:	ba 10 00 00 00       	mov    $0x10,%edx
+  8054ad:	48 89 c6             	mov    %rax,%rsi
+  8054b0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8054b5:	48 b8 42 b1 ff ff ff 	movabs $0xffffffffffffb142,%rax
+  8054bc:	ff ff ff 
+  8054bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054c3:	ff d0                	call   *%rax
+  8054c5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8054c8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8054cc:	79 05                	jns    8054d3 <devfile_read+0x80>
+		return r;
+  8054ce:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8054d1:	eb 64                	jmp    805537 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8054d3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8054d6:	48 63 d0             	movslq %eax,%rdx
+  8054d9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8054dd:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8054e2:	48 01 c1             	add    %rax,%rcx
+  8054e5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8054e9:	48 89 ce             	mov    %rcx,%rsi
+  8054ec:	48 89 c7             	mov    %rax,%rdi
+  8054ef:	49 89 df             	mov    %rbx,%r15
+  8054f2:	48 b8 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rax
+  8054f9:	ff ff ff 
+  8054fc:	48 01 d8             	add    %rbx,%rax
+  8054ff:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  805501:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805508:	ff ff ff 
+  80550b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80550f:	48 8b 00             	mov    (%rax),%rax
+  805512:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  805518:	89 c6                	mov    %eax,%esi
+  80551a:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  80551f:	48 89 c7             	mov    %rax,%rdi
+  805522:	49 89 df             	mov    %rbx,%r15
+  805525:	48 b8 32 a3 ff ff ff 	movabs $0xffffffffffffa332,%rax
+  80552c:	ff ff ff 
+  80552f:	48 01 d8             	add    %rbx,%rax
+  805532:	ff d0                	call   *%rax
+	return r;
+  805534:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  805537:	48 83 c4 60          	add    $0x60,%rsp
+  80553b:	5b                   	pop    %rbx
+  80553c:	41 5f                	pop    %r15
+  80553e:	5d                   	pop    %rbp
+  80553f:	c3                   	ret
+
+0000000000805540 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805540:	55                   	push   %rbp
+  805541:	48 89 e5             	mov    %rsp,%rbp
+  805544:	41 57                	push   %r15
+  805546:	53                   	push   %rbx
+  805547:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  80554b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80554b <devfile_write+0xb>
+  805552:	49 bb fd 4a 00 00 00 	movabs $0x4afd,%r11
+  805559:	00 00 00 
+  80555c:	4c 01 db             	add    %r11,%rbx
+  80555f:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  805563:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  805567:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  80556e:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805572:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  805576:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  80557d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805581:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  805588:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80558b:	48 63 d0             	movslq %eax,%rdx
+  80558e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805592:	48 39 c2             	cmp    %rax,%rdx
+  805595:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805599:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8055a0:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  8055a7:	00 
+  8055a8:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8055af:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8055b3:	48 01 d0             	add    %rdx,%rax
+  8055b6:	48 83 e8 01          	sub    $0x1,%rax
+  8055ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8055be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055c7:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8055cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055cf:	48 29 d0             	sub    %rdx,%rax
+  8055d2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8055d6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8055d9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8055dc:	89 c6                	mov    %eax,%esi
+  8055de:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8055e3:	48 89 c7             	mov    %rax,%rdi
+  8055e6:	49 89 df             	mov    %rbx,%r15
+  8055e9:	48 b8 ec a2 ff ff ff 	movabs $0xffffffffffffa2ec,%rax
+  8055f0:	ff ff ff 
+  8055f3:	48 01 d8             	add    %rbx,%rax
+  8055f6:	ff d0                	call   *%rax
+  8055f8:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8055fb:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8055ff:	79 08                	jns    805609 <devfile_write+0xc9>
+		return r;
+  805601:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  805604:	e9 8f 00 00 00       	jmp    805698 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  805609:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  805610:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  805614:	48 89 c6             	mov    %rax,%rsi
+  805617:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80561c:	48 89 c7             	mov    %rax,%rdi
+  80561f:	49 89 df             	mov    %rbx,%r15
+  805622:	48 b8 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rax
+  805629:	ff ff ff 
+  80562c:	48 01 d8             	add    %rbx,%rax
+  80562f:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  805631:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  805635:	8b 50 0c             	mov    0xc(%rax),%edx
+  805638:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80563c:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80563e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805642:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  805649:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  80564d:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  805650:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805654:	89 d1                	mov    %edx,%ecx
+  805656:	ba 10 00 00 00       	mov    $0x10,%edx
+  80565b:	48 89 c6             	mov    %rax,%rsi
+  80565e:	bf 04 00 00 00       	mov    $0x4,%edi
+  805663:	48 b8 42 b1 ff ff ff 	movabs $0xffffffffffffb142,%rax
+  80566a:	ff ff ff 
+  80566d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805671:	ff d0                	call   *%rax
+  805673:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  805676:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805679:	89 c6                	mov    %eax,%esi
+  80567b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  805680:	48 89 c7             	mov    %rax,%rdi
+  805683:	49 89 df             	mov    %rbx,%r15
+  805686:	48 b8 32 a3 ff ff ff 	movabs $0xffffffffffffa332,%rax
+  80568d:	ff ff ff 
+  805690:	48 01 d8             	add    %rbx,%rax
+  805693:	ff d0                	call   *%rax
+	return r;
+  805695:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  805698:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  80569c:	5b                   	pop    %rbx
+  80569d:	41 5f                	pop    %r15
+  80569f:	5d                   	pop    %rbp
+  8056a0:	c3                   	ret
+
+00000000008056a1 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  8056a1:	55                   	push   %rbp
+  8056a2:	48 89 e5             	mov    %rsp,%rbp
+  8056a5:	41 57                	push   %r15
+  8056a7:	53                   	push   %rbx
+  8056a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8056ac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056ac <devfile_stat+0xb>
+  8056b3:	49 bb 9c 49 00 00 00 	movabs $0x499c,%r11
+  8056ba:	00 00 00 
+  8056bd:	4c 01 db             	add    %r11,%rbx
+  8056c0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8056c4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8056c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8056cc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8056cf:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  8056d6:	00 00 00 
+  8056d9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8056dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8056e1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8056e6:	48 b8 06 b0 ff ff ff 	movabs $0xffffffffffffb006,%rax
+  8056ed:	ff ff ff 
+  8056f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056f4:	ff d0                	call   *%rax
+  8056f6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056f9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056fd:	79 05                	jns    805704 <devfile_stat+0x63>
+		return r;
+  8056ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805702:	eb 65                	jmp    805769 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  805704:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805708:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  80570f:	00 00 00 
+  805712:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805716:	48 89 d6             	mov    %rdx,%rsi
+  805719:	48 89 c7             	mov    %rax,%rdi
+  80571c:	49 89 df             	mov    %rbx,%r15
+  80571f:	48 b8 4a 7c ff ff ff 	movabs $0xffffffffffff7c4a,%rax
+  805726:	ff ff ff 
+  805729:	48 01 d8             	add    %rbx,%rax
+  80572c:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80572e:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  805735:	00 00 00 
+  805738:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  80573f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805743:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  805749:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  805750:	00 00 00 
+  805753:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  80575a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80575e:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  805764:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805769:	48 83 c4 20          	add    $0x20,%rsp
+  80576d:	5b                   	pop    %rbx
+  80576e:	41 5f                	pop    %r15
+  805770:	5d                   	pop    %rbp
+  805771:	c3                   	ret
+
+0000000000805772 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  805772:	55                   	push   %rbp
+  805773:	48 89 e5             	mov    %rsp,%rbp
+  805776:	48 83 ec 20          	sub    $0x20,%rsp
+  80577a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80577a <devfile_trunc+0x8>
+  805781:	49 bb ce 48 00 00 00 	movabs $0x48ce,%r11
+  805788:	00 00 00 
+  80578b:	4c 01 d8             	add    %r11,%rax
+  80578e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805792:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  805795:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805799:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80579c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  80579f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8057a2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8057a5:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8057a9:	ba 08 00 00 00       	mov    $0x8,%edx
+  8057ae:	48 89 ce             	mov    %rcx,%rsi
+  8057b1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8057b6:	48 b9 ae b0 ff ff ff 	movabs $0xffffffffffffb0ae,%rcx
+  8057bd:	ff ff ff 
+  8057c0:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8057c4:	ff d0                	call   *%rax
+}
+  8057c6:	c9                   	leave
+  8057c7:	c3                   	ret
+
+00000000008057c8 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8057c8:	55                   	push   %rbp
+  8057c9:	48 89 e5             	mov    %rsp,%rbp
+  8057cc:	41 57                	push   %r15
+  8057ce:	53                   	push   %rbx
+  8057cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8057d3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057d3 <remove+0xb>
+  8057da:	49 bb 75 48 00 00 00 	movabs $0x4875,%r11
+  8057e1:	00 00 00 
+  8057e4:	4c 01 db             	add    %r11,%rbx
+  8057e7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8057eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057ef:	48 89 c7             	mov    %rax,%rdi
+  8057f2:	49 89 df             	mov    %rbx,%r15
+  8057f5:	48 b8 b6 7b ff ff ff 	movabs $0xffffffffffff7bb6,%rax
+  8057fc:	ff ff ff 
+  8057ff:	48 01 d8             	add    %rbx,%rax
+  805802:	ff d0                	call   *%rax
+  805804:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  805809:	7e 07                	jle    805812 <remove+0x4a>
+		return -E_BAD_PATH;
+  80580b:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  805810:	eb 44                	jmp    805856 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  805812:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805816:	48 89 c6             	mov    %rax,%rsi
+  805819:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  805820:	00 00 00 
+  805823:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805827:	48 89 c7             	mov    %rax,%rdi
+  80582a:	49 89 df             	mov    %rbx,%r15
+  80582d:	48 b8 4a 7c ff ff ff 	movabs $0xffffffffffff7c4a,%rax
+  805834:	ff ff ff 
+  805837:	48 01 d8             	add    %rbx,%rax
+  80583a:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  80583c:	be 00 00 00 00       	mov    $0x0,%esi
+  805841:	bf 07 00 00 00       	mov    $0x7,%edi
+  805846:	48 b8 06 b0 ff ff ff 	movabs $0xffffffffffffb006,%rax
+  80584d:	ff ff ff 
+  805850:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805854:	ff d0                	call   *%rax
+}
+  805856:	48 83 c4 10          	add    $0x10,%rsp
+  80585a:	5b                   	pop    %rbx
+  80585b:	41 5f                	pop    %r15
+  80585d:	5d                   	pop    %rbp
+  80585e:	c3                   	ret
+
+000000000080585f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80585f:	55                   	push   %rbp
+  805860:	48 89 e5             	mov    %rsp,%rbp
+  805863:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805863 <sync+0x4>
+  80586a:	49 bb e5 47 00 00 00 	movabs $0x47e5,%r11
+  805871:	00 00 00 
+  805874:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  805877:	ba 00 00 00 00       	mov    $0x0,%edx
+  80587c:	be 00 00 00 00       	mov    $0x0,%esi
+  805881:	bf 08 00 00 00       	mov    $0x8,%edi
+  805886:	48 b9 ae b0 ff ff ff 	movabs $0xffffffffffffb0ae,%rcx
+  80588d:	ff ff ff 
+  805890:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805894:	ff d0                	call   *%rax
+}
+  805896:	5d                   	pop    %rbp
+  805897:	c3                   	ret
+
+0000000000805898 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  805898:	55                   	push   %rbp
+  805899:	48 89 e5             	mov    %rsp,%rbp
+  80589c:	41 57                	push   %r15
+  80589e:	53                   	push   %rbx
+  80589f:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8058a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058a6 <copy+0xe>
+  8058ad:	49 bb a2 47 00 00 00 	movabs $0x47a2,%r11
+  8058b4:	00 00 00 
+  8058b7:	4c 01 db             	add    %r11,%rbx
+  8058ba:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8058c1:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8058c8:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8058cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8058d4:	48 89 c7             	mov    %rax,%rdi
+  8058d7:	48 b8 4d b2 ff ff ff 	movabs $0xffffffffffffb24d,%rax
+  8058de:	ff ff ff 
+  8058e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058e5:	ff d0                	call   *%rax
+  8058e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8058ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058ee:	79 35                	jns    805925 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8058f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058f3:	89 c6                	mov    %eax,%esi
+  8058f5:	48 b8 d6 e1 ff ff ff 	movabs $0xffffffffffffe1d6,%rax
+  8058fc:	ff ff ff 
+  8058ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805903:	48 89 c7             	mov    %rax,%rdi
+  805906:	49 89 df             	mov    %rbx,%r15
+  805909:	b8 00 00 00 00       	mov    $0x0,%eax
+  80590e:	48 ba 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rdx
+  805915:	ff ff ff 
+  805918:	48 01 da             	add    %rbx,%rdx
+  80591b:	ff d2                	call   *%rdx
+		return fd_src;
+  80591d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805920:	e9 d7 01 00 00       	jmp    805afc <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  805925:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  80592c:	be 01 01 00 00       	mov    $0x101,%esi
+  805931:	48 89 c7             	mov    %rax,%rdi
+  805934:	48 b8 4d b2 ff ff ff 	movabs $0xffffffffffffb24d,%rax
+  80593b:	ff ff ff 
+  80593e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805942:	ff d0                	call   *%rax
+  805944:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  805947:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80594b:	0f 89 df 00 00 00    	jns    805a30 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  805951:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805954:	89 c6                	mov    %eax,%esi
+  805956:	48 b8 ec e1 ff ff ff 	movabs $0xffffffffffffe1ec,%rax
+  80595d:	ff ff ff 
+  805960:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805964:	48 89 c7             	mov    %rax,%rdi
+  805967:	49 89 df             	mov    %rbx,%r15
+  80596a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80596f:	48 ba 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rdx
+  805976:	ff ff ff 
+  805979:	48 01 da             	add    %rbx,%rdx
+  80597c:	ff d2                	call   *%rdx
+		close(fd_src);
+  80597e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805981:	89 c7                	mov    %eax,%edi
+  805983:	49 89 df             	mov    %rbx,%r15
+  805986:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  80598d:	ff ff ff 
+  805990:	48 01 d8             	add    %rbx,%rax
+  805993:	ff d0                	call   *%rax
+		return fd_dest;
+  805995:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805998:	e9 5f 01 00 00       	jmp    805afc <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  80599d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8059a0:	48 63 d0             	movslq %eax,%rdx
+  8059a3:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8059aa:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8059ad:	48 89 ce             	mov    %rcx,%rsi
+  8059b0:	89 c7                	mov    %eax,%edi
+  8059b2:	49 89 df             	mov    %rbx,%r15
+  8059b5:	48 b8 24 ac ff ff ff 	movabs $0xffffffffffffac24,%rax
+  8059bc:	ff ff ff 
+  8059bf:	48 01 d8             	add    %rbx,%rax
+  8059c2:	ff d0                	call   *%rax
+  8059c4:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8059c7:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8059cb:	79 63                	jns    805a30 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8059cd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8059d0:	89 c6                	mov    %eax,%esi
+  8059d2:	48 b8 06 e2 ff ff ff 	movabs $0xffffffffffffe206,%rax
+  8059d9:	ff ff ff 
+  8059dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8059e0:	48 89 c7             	mov    %rax,%rdi
+  8059e3:	49 89 df             	mov    %rbx,%r15
+  8059e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059eb:	48 ba 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rdx
+  8059f2:	ff ff ff 
+  8059f5:	48 01 da             	add    %rbx,%rdx
+  8059f8:	ff d2                	call   *%rdx
+			close(fd_src);
+  8059fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059fd:	89 c7                	mov    %eax,%edi
+  8059ff:	49 89 df             	mov    %rbx,%r15
+  805a02:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  805a09:	ff ff ff 
+  805a0c:	48 01 d8             	add    %rbx,%rax
+  805a0f:	ff d0                	call   *%rax
+			close(fd_dest);
+  805a11:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a14:	89 c7                	mov    %eax,%edi
+  805a16:	49 89 df             	mov    %rbx,%r15
+  805a19:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  805a20:	ff ff ff 
+  805a23:	48 01 d8             	add    %rbx,%rax
+  805a26:	ff d0                	call   *%rax
+			return write_size;
+  805a28:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805a2b:	e9 cc 00 00 00       	jmp    805afc <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  805a30:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805a37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a3a:	ba 00 02 00 00       	mov    $0x200,%edx
+  805a3f:	48 89 ce             	mov    %rcx,%rsi
+  805a42:	89 c7                	mov    %eax,%edi
+  805a44:	49 89 df             	mov    %rbx,%r15
+  805a47:	48 b8 7e aa ff ff ff 	movabs $0xffffffffffffaa7e,%rax
+  805a4e:	ff ff ff 
+  805a51:	48 01 d8             	add    %rbx,%rax
+  805a54:	ff d0                	call   *%rax
+  805a56:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805a59:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805a5d:	0f 8f 3a ff ff ff    	jg     80599d <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805a63:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805a67:	79 60                	jns    805ac9 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  805a69:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805a6c:	89 c6                	mov    %eax,%esi
+  805a6e:	48 b8 19 e2 ff ff ff 	movabs $0xffffffffffffe219,%rax
+  805a75:	ff ff ff 
+  805a78:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a7c:	48 89 c7             	mov    %rax,%rdi
+  805a7f:	49 89 df             	mov    %rbx,%r15
+  805a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a87:	48 ba 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%rdx
+  805a8e:	ff ff ff 
+  805a91:	48 01 da             	add    %rbx,%rdx
+  805a94:	ff d2                	call   *%rdx
+		close(fd_src);
+  805a96:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a99:	89 c7                	mov    %eax,%edi
+  805a9b:	49 89 df             	mov    %rbx,%r15
+  805a9e:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  805aa5:	ff ff ff 
+  805aa8:	48 01 d8             	add    %rbx,%rax
+  805aab:	ff d0                	call   *%rax
+		close(fd_dest);
+  805aad:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805ab0:	89 c7                	mov    %eax,%edi
+  805ab2:	49 89 df             	mov    %rbx,%r15
+  805ab5:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  805abc:	ff ff ff 
+  805abf:	48 01 d8             	add    %rbx,%rax
+  805ac2:	ff d0                	call   *%rax
+		return read_size;
+  805ac4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805ac7:	eb 33                	jmp    805afc <copy+0x264>
+	}
+	close(fd_src);
+  805ac9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805acc:	89 c7                	mov    %eax,%edi
+  805ace:	49 89 df             	mov    %rbx,%r15
+  805ad1:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  805ad8:	ff ff ff 
+  805adb:	48 01 d8             	add    %rbx,%rax
+  805ade:	ff d0                	call   *%rax
+	close(fd_dest);
+  805ae0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805ae3:	89 c7                	mov    %eax,%edi
+  805ae5:	49 89 df             	mov    %rbx,%r15
+  805ae8:	48 b8 c6 a7 ff ff ff 	movabs $0xffffffffffffa7c6,%rax
+  805aef:	ff ff ff 
+  805af2:	48 01 d8             	add    %rbx,%rax
+  805af5:	ff d0                	call   *%rax
+	return 0;
+  805af7:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  805afc:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  805b03:	5b                   	pop    %rbx
+  805b04:	41 5f                	pop    %r15
+  805b06:	5d                   	pop    %rbp
+  805b07:	c3                   	ret
+
+0000000000805b08 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805b08:	55                   	push   %rbp
+  805b09:	48 89 e5             	mov    %rsp,%rbp
+  805b0c:	41 57                	push   %r15
+  805b0e:	53                   	push   %rbx
+  805b0f:	48 83 ec 20          	sub    $0x20,%rsp
+  805b13:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b13 <fd2sockid+0xb>
+  805b1a:	49 bb 35 45 00 00 00 	movabs $0x4535,%r11
+  805b21:	00 00 00 
+  805b24:	4c 01 db             	add    %r11,%rbx
+  805b27:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805b2a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805b2e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b31:	48 89 d6             	mov    %rdx,%rsi
+  805b34:	89 c7                	mov    %eax,%edi
+  805b36:	49 89 df             	mov    %rbx,%r15
+  805b39:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  805b40:	ff ff ff 
+  805b43:	48 01 d8             	add    %rbx,%rax
+  805b46:	ff d0                	call   *%rax
+  805b48:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b4b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b4f:	79 05                	jns    805b56 <fd2sockid+0x4e>
+		return r;
+  805b51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b54:	eb 25                	jmp    805b7b <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805b56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b5a:	8b 10                	mov    (%rax),%edx
+  805b5c:	48 b8 78 00 00 00 00 	movabs $0x78,%rax
+  805b63:	00 00 00 
+  805b66:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b69:	39 c2                	cmp    %eax,%edx
+  805b6b:	74 07                	je     805b74 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  805b6d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  805b72:	eb 07                	jmp    805b7b <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  805b74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b78:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  805b7b:	48 83 c4 20          	add    $0x20,%rsp
+  805b7f:	5b                   	pop    %rbx
+  805b80:	41 5f                	pop    %r15
+  805b82:	5d                   	pop    %rbp
+  805b83:	c3                   	ret
+
+0000000000805b84 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  805b84:	55                   	push   %rbp
+  805b85:	48 89 e5             	mov    %rsp,%rbp
+  805b88:	41 57                	push   %r15
+  805b8a:	53                   	push   %rbx
+  805b8b:	48 83 ec 20          	sub    $0x20,%rsp
+  805b8f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b8f <alloc_sockfd+0xb>
+  805b96:	49 bb b9 44 00 00 00 	movabs $0x44b9,%r11
+  805b9d:	00 00 00 
+  805ba0:	4c 01 db             	add    %r11,%rbx
+  805ba3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  805ba6:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805baa:	48 89 c7             	mov    %rax,%rdi
+  805bad:	49 89 df             	mov    %rbx,%r15
+  805bb0:	48 b8 81 a4 ff ff ff 	movabs $0xffffffffffffa481,%rax
+  805bb7:	ff ff ff 
+  805bba:	48 01 d8             	add    %rbx,%rax
+  805bbd:	ff d0                	call   *%rax
+  805bbf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805bc2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805bc6:	78 2c                	js     805bf4 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  805bc8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bcc:	ba 07 04 00 00       	mov    $0x407,%edx
+  805bd1:	48 89 c6             	mov    %rax,%rsi
+  805bd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bd9:	49 89 df             	mov    %rbx,%r15
+  805bdc:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  805be3:	ff ff ff 
+  805be6:	48 01 d8             	add    %rbx,%rax
+  805be9:	ff d0                	call   *%rax
+  805beb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805bee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805bf2:	79 1c                	jns    805c10 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805bf4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bf7:	89 c7                	mov    %eax,%edi
+  805bf9:	49 89 df             	mov    %rbx,%r15
+  805bfc:	48 b8 30 c3 ff ff ff 	movabs $0xffffffffffffc330,%rax
+  805c03:	ff ff ff 
+  805c06:	48 01 d8             	add    %rbx,%rax
+  805c09:	ff d0                	call   *%rax
+		return r;
+  805c0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c0e:	eb 41                	jmp    805c51 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  805c10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c14:	48 ba 78 00 00 00 00 	movabs $0x78,%rdx
+  805c1b:	00 00 00 
+  805c1e:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805c21:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805c23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c27:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  805c2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c32:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805c35:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805c38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c3c:	48 89 c7             	mov    %rax,%rdi
+  805c3f:	49 89 df             	mov    %rbx,%r15
+  805c42:	48 b8 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rax
+  805c49:	ff ff ff 
+  805c4c:	48 01 d8             	add    %rbx,%rax
+  805c4f:	ff d0                	call   *%rax
+}
+  805c51:	48 83 c4 20          	add    $0x20,%rsp
+  805c55:	5b                   	pop    %rbx
+  805c56:	41 5f                	pop    %r15
+  805c58:	5d                   	pop    %rbp
+  805c59:	c3                   	ret
+
+0000000000805c5a <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805c5a:	55                   	push   %rbp
+  805c5b:	48 89 e5             	mov    %rsp,%rbp
+  805c5e:	41 57                	push   %r15
+  805c60:	53                   	push   %rbx
+  805c61:	48 83 ec 30          	sub    $0x30,%rsp
+  805c65:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c65 <accept+0xb>
+  805c6c:	49 bb e3 43 00 00 00 	movabs $0x43e3,%r11
+  805c73:	00 00 00 
+  805c76:	4c 01 db             	add    %r11,%rbx
+  805c79:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805c7c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805c80:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805c84:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c87:	89 c7                	mov    %eax,%edi
+  805c89:	48 b8 c0 ba ff ff ff 	movabs $0xffffffffffffbac0,%rax
+  805c90:	ff ff ff 
+  805c93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c97:	ff d0                	call   *%rax
+  805c99:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c9c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ca0:	79 05                	jns    805ca7 <accept+0x4d>
+		return r;
+  805ca2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ca5:	eb 45                	jmp    805cec <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  805ca7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805cab:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805caf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cb2:	48 89 ce             	mov    %rcx,%rsi
+  805cb5:	89 c7                	mov    %eax,%edi
+  805cb7:	49 89 df             	mov    %rbx,%r15
+  805cba:	48 b8 9e c1 ff ff ff 	movabs $0xffffffffffffc19e,%rax
+  805cc1:	ff ff ff 
+  805cc4:	48 01 d8             	add    %rbx,%rax
+  805cc7:	ff d0                	call   *%rax
+  805cc9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ccc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805cd0:	79 05                	jns    805cd7 <accept+0x7d>
+		return r;
+  805cd2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cd5:	eb 15                	jmp    805cec <accept+0x92>
+	return alloc_sockfd(r);
+  805cd7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cda:	89 c7                	mov    %eax,%edi
+  805cdc:	48 b8 3c bb ff ff ff 	movabs $0xffffffffffffbb3c,%rax
+  805ce3:	ff ff ff 
+  805ce6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cea:	ff d0                	call   *%rax
+}
+  805cec:	48 83 c4 30          	add    $0x30,%rsp
+  805cf0:	5b                   	pop    %rbx
+  805cf1:	41 5f                	pop    %r15
+  805cf3:	5d                   	pop    %rbp
+  805cf4:	c3                   	ret
+
+0000000000805cf5 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805cf5:	55                   	push   %rbp
+  805cf6:	48 89 e5             	mov    %rsp,%rbp
+  805cf9:	41 57                	push   %r15
+  805cfb:	53                   	push   %rbx
+  805cfc:	48 83 ec 20          	sub    $0x20,%rsp
+  805d00:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d00 <bind+0xb>
+  805d07:	49 bb 48 43 00 00 00 	movabs $0x4348,%r11
+  805d0e:	00 00 00 
+  805d11:	4c 01 db             	add    %r11,%rbx
+  805d14:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805d17:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805d1b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805d1e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d21:	89 c7                	mov    %eax,%edi
+  805d23:	48 b8 c0 ba ff ff ff 	movabs $0xffffffffffffbac0,%rax
+  805d2a:	ff ff ff 
+  805d2d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d31:	ff d0                	call   *%rax
+  805d33:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d36:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d3a:	79 05                	jns    805d41 <bind+0x4c>
+		return r;
+  805d3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d3f:	eb 21                	jmp    805d62 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  805d41:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805d44:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805d48:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d4b:	48 89 ce             	mov    %rcx,%rsi
+  805d4e:	89 c7                	mov    %eax,%edi
+  805d50:	49 89 df             	mov    %rbx,%r15
+  805d53:	48 b8 4a c2 ff ff ff 	movabs $0xffffffffffffc24a,%rax
+  805d5a:	ff ff ff 
+  805d5d:	48 01 d8             	add    %rbx,%rax
+  805d60:	ff d0                	call   *%rax
+}
+  805d62:	48 83 c4 20          	add    $0x20,%rsp
+  805d66:	5b                   	pop    %rbx
+  805d67:	41 5f                	pop    %r15
+  805d69:	5d                   	pop    %rbp
+  805d6a:	c3                   	ret
+
+0000000000805d6b <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  805d6b:	55                   	push   %rbp
+  805d6c:	48 89 e5             	mov    %rsp,%rbp
+  805d6f:	41 57                	push   %r15
+  805d71:	53                   	push   %rbx
+  805d72:	48 83 ec 20          	sub    $0x20,%rsp
+  805d76:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d76 <shutdown+0xb>
+  805d7d:	49 bb d2 42 00 00 00 	movabs $0x42d2,%r11
+  805d84:	00 00 00 
+  805d87:	4c 01 db             	add    %r11,%rbx
+  805d8a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805d8d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805d90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d93:	89 c7                	mov    %eax,%edi
+  805d95:	48 b8 c0 ba ff ff ff 	movabs $0xffffffffffffbac0,%rax
+  805d9c:	ff ff ff 
+  805d9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805da3:	ff d0                	call   *%rax
+  805da5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805da8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805dac:	79 05                	jns    805db3 <shutdown+0x48>
+		return r;
+  805dae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805db1:	eb 1c                	jmp    805dcf <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  805db3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805db6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805db9:	89 d6                	mov    %edx,%esi
+  805dbb:	89 c7                	mov    %eax,%edi
+  805dbd:	49 89 df             	mov    %rbx,%r15
+  805dc0:	48 b8 df c2 ff ff ff 	movabs $0xffffffffffffc2df,%rax
+  805dc7:	ff ff ff 
+  805dca:	48 01 d8             	add    %rbx,%rax
+  805dcd:	ff d0                	call   *%rax
+}
+  805dcf:	48 83 c4 20          	add    $0x20,%rsp
+  805dd3:	5b                   	pop    %rbx
+  805dd4:	41 5f                	pop    %r15
+  805dd6:	5d                   	pop    %rbp
+  805dd7:	c3                   	ret
+
+0000000000805dd8 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805dd8:	55                   	push   %rbp
+  805dd9:	48 89 e5             	mov    %rsp,%rbp
+  805ddc:	41 57                	push   %r15
+  805dde:	53                   	push   %rbx
+  805ddf:	48 83 ec 10          	sub    $0x10,%rsp
+  805de3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805de3 <devsock_close+0xb>
+  805dea:	49 bb 65 42 00 00 00 	movabs $0x4265,%r11
+  805df1:	00 00 00 
+  805df4:	4c 01 db             	add    %r11,%rbx
+  805df7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805dfb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dff:	48 89 c7             	mov    %rax,%rdi
+  805e02:	49 89 df             	mov    %rbx,%r15
+  805e05:	48 b8 92 d4 ff ff ff 	movabs $0xffffffffffffd492,%rax
+  805e0c:	ff ff ff 
+  805e0f:	48 01 d8             	add    %rbx,%rax
+  805e12:	ff d0                	call   *%rax
+  805e14:	83 f8 01             	cmp    $0x1,%eax
+  805e17:	75 1d                	jne    805e36 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805e19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e1d:	8b 40 0c             	mov    0xc(%rax),%eax
+  805e20:	89 c7                	mov    %eax,%edi
+  805e22:	49 89 df             	mov    %rbx,%r15
+  805e25:	48 b8 30 c3 ff ff ff 	movabs $0xffffffffffffc330,%rax
+  805e2c:	ff ff ff 
+  805e2f:	48 01 d8             	add    %rbx,%rax
+  805e32:	ff d0                	call   *%rax
+  805e34:	eb 05                	jmp    805e3b <devsock_close+0x63>
+	else
+		return 0;
+  805e36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e3b:	48 83 c4 10          	add    $0x10,%rsp
+  805e3f:	5b                   	pop    %rbx
+  805e40:	41 5f                	pop    %r15
+  805e42:	5d                   	pop    %rbp
+  805e43:	c3                   	ret
+
+0000000000805e44 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805e44:	55                   	push   %rbp
+  805e45:	48 89 e5             	mov    %rsp,%rbp
+  805e48:	41 57                	push   %r15
+  805e4a:	53                   	push   %rbx
+  805e4b:	48 83 ec 20          	sub    $0x20,%rsp
+  805e4f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e4f <connect+0xb>
+  805e56:	49 bb f9 41 00 00 00 	movabs $0x41f9,%r11
+  805e5d:	00 00 00 
+  805e60:	4c 01 db             	add    %r11,%rbx
+  805e63:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805e66:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805e6a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805e6d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e70:	89 c7                	mov    %eax,%edi
+  805e72:	48 b8 c0 ba ff ff ff 	movabs $0xffffffffffffbac0,%rax
+  805e79:	ff ff ff 
+  805e7c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e80:	ff d0                	call   *%rax
+  805e82:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e85:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e89:	79 05                	jns    805e90 <connect+0x4c>
+		return r;
+  805e8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e8e:	eb 21                	jmp    805eb1 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  805e90:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805e93:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805e97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e9a:	48 89 ce             	mov    %rcx,%rsi
+  805e9d:	89 c7                	mov    %eax,%edi
+  805e9f:	49 89 df             	mov    %rbx,%r15
+  805ea2:	48 b8 78 c3 ff ff ff 	movabs $0xffffffffffffc378,%rax
+  805ea9:	ff ff ff 
+  805eac:	48 01 d8             	add    %rbx,%rax
+  805eaf:	ff d0                	call   *%rax
+}
+  805eb1:	48 83 c4 20          	add    $0x20,%rsp
+  805eb5:	5b                   	pop    %rbx
+  805eb6:	41 5f                	pop    %r15
+  805eb8:	5d                   	pop    %rbp
+  805eb9:	c3                   	ret
+
+0000000000805eba <listen>:
+
+int
+listen(int s, int backlog)
+{
+  805eba:	55                   	push   %rbp
+  805ebb:	48 89 e5             	mov    %rsp,%rbp
+  805ebe:	41 57                	push   %r15
+  805ec0:	53                   	push   %rbx
+  805ec1:	48 83 ec 20          	sub    $0x20,%rsp
+  805ec5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ec5 <listen+0xb>
+  805ecc:	49 bb 83 41 00 00 00 	movabs $0x4183,%r11
+  805ed3:	00 00 00 
+  805ed6:	4c 01 db             	add    %r11,%rbx
+  805ed9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805edc:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805edf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ee2:	89 c7                	mov    %eax,%edi
+  805ee4:	48 b8 c0 ba ff ff ff 	movabs $0xffffffffffffbac0,%rax
+  805eeb:	ff ff ff 
+  805eee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ef2:	ff d0                	call   *%rax
+  805ef4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ef7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805efb:	79 05                	jns    805f02 <listen+0x48>
+		return r;
+  805efd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f00:	eb 1c                	jmp    805f1e <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805f02:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805f05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f08:	89 d6                	mov    %edx,%esi
+  805f0a:	89 c7                	mov    %eax,%edi
+  805f0c:	49 89 df             	mov    %rbx,%r15
+  805f0f:	48 b8 0d c4 ff ff ff 	movabs $0xffffffffffffc40d,%rax
+  805f16:	ff ff ff 
+  805f19:	48 01 d8             	add    %rbx,%rax
+  805f1c:	ff d0                	call   *%rax
+}
+  805f1e:	48 83 c4 20          	add    $0x20,%rsp
+  805f22:	5b                   	pop    %rbx
+  805f23:	41 5f                	pop    %r15
+  805f25:	5d                   	pop    %rbp
+  805f26:	c3                   	ret
+
+0000000000805f27 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805f27:	55                   	push   %rbp
+  805f28:	48 89 e5             	mov    %rsp,%rbp
+  805f2b:	41 57                	push   %r15
+  805f2d:	48 83 ec 28          	sub    $0x28,%rsp
+  805f31:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f31 <devsock_read+0xa>
+  805f38:	49 bb 17 41 00 00 00 	movabs $0x4117,%r11
+  805f3f:	00 00 00 
+  805f42:	4c 01 d8             	add    %r11,%rax
+  805f45:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805f49:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805f4d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805f51:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805f55:	41 89 d0             	mov    %edx,%r8d
+  805f58:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805f5c:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805f5f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805f63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805f68:	44 89 c2             	mov    %r8d,%edx
+  805f6b:	49 89 c7             	mov    %rax,%r15
+  805f6e:	49 b8 5e c4 ff ff ff 	movabs $0xffffffffffffc45e,%r8
+  805f75:	ff ff ff 
+  805f78:	49 01 c0             	add    %rax,%r8
+  805f7b:	41 ff d0             	call   *%r8
+}
+  805f7e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805f82:	c9                   	leave
+  805f83:	c3                   	ret
+
+0000000000805f84 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805f84:	55                   	push   %rbp
+  805f85:	48 89 e5             	mov    %rsp,%rbp
+  805f88:	41 57                	push   %r15
+  805f8a:	48 83 ec 28          	sub    $0x28,%rsp
+  805f8e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f8e <devsock_write+0xa>
+  805f95:	49 bb ba 40 00 00 00 	movabs $0x40ba,%r11
+  805f9c:	00 00 00 
+  805f9f:	4c 01 d8             	add    %r11,%rax
+  805fa2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805fa6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805faa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805fae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805fb2:	41 89 d0             	mov    %edx,%r8d
+  805fb5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805fb9:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805fbc:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805fc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805fc5:	44 89 c2             	mov    %r8d,%edx
+  805fc8:	49 89 c7             	mov    %rax,%r15
+  805fcb:	49 b8 7b c5 ff ff ff 	movabs $0xffffffffffffc57b,%r8
+  805fd2:	ff ff ff 
+  805fd5:	49 01 c0             	add    %rax,%r8
+  805fd8:	41 ff d0             	call   *%r8
+}
+  805fdb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805fdf:	c9                   	leave
+  805fe0:	c3                   	ret
+
+0000000000805fe1 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805fe1:	55                   	push   %rbp
+  805fe2:	48 89 e5             	mov    %rsp,%rbp
+  805fe5:	41 57                	push   %r15
+  805fe7:	48 83 ec 18          	sub    $0x18,%rsp
+  805feb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805feb <devsock_stat+0xa>
+  805ff2:	49 bb 5d 40 00 00 00 	movabs $0x405d,%r11
+  805ff9:	00 00 00 
+  805ffc:	4c 01 d8             	add    %r11,%rax
+  805fff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806003:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  806007:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80600b:	48 b9 34 e2 ff ff ff 	movabs $0xffffffffffffe234,%rcx
+  806012:	ff ff ff 
+  806015:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806019:	48 89 ce             	mov    %rcx,%rsi
+  80601c:	48 89 d7             	mov    %rdx,%rdi
+  80601f:	49 89 c7             	mov    %rax,%r15
+  806022:	48 ba 4a 7c ff ff ff 	movabs $0xffffffffffff7c4a,%rdx
+  806029:	ff ff ff 
+  80602c:	48 01 c2             	add    %rax,%rdx
+  80602f:	ff d2                	call   *%rdx
+	return 0;
+  806031:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806036:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80603a:	c9                   	leave
+  80603b:	c3                   	ret
+
+000000000080603c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80603c:	55                   	push   %rbp
+  80603d:	48 89 e5             	mov    %rsp,%rbp
+  806040:	41 57                	push   %r15
+  806042:	53                   	push   %rbx
+  806043:	48 83 ec 20          	sub    $0x20,%rsp
+  806047:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806047 <socket+0xb>
+  80604e:	49 bb 01 40 00 00 00 	movabs $0x4001,%r11
+  806055:	00 00 00 
+  806058:	4c 01 db             	add    %r11,%rbx
+  80605b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80605e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806061:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  806064:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  806067:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80606a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80606d:	89 ce                	mov    %ecx,%esi
+  80606f:	89 c7                	mov    %eax,%edi
+  806071:	49 89 df             	mov    %rbx,%r15
+  806074:	48 b8 52 c7 ff ff ff 	movabs $0xffffffffffffc752,%rax
+  80607b:	ff ff ff 
+  80607e:	48 01 d8             	add    %rbx,%rax
+  806081:	ff d0                	call   *%rax
+  806083:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806086:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80608a:	79 05                	jns    806091 <socket+0x55>
+		return r;
+  80608c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80608f:	eb 15                	jmp    8060a6 <socket+0x6a>
+	return alloc_sockfd(r);
+  806091:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806094:	89 c7                	mov    %eax,%edi
+  806096:	48 b8 3c bb ff ff ff 	movabs $0xffffffffffffbb3c,%rax
+  80609d:	ff ff ff 
+  8060a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060a4:	ff d0                	call   *%rax
+}
+  8060a6:	48 83 c4 20          	add    $0x20,%rsp
+  8060aa:	5b                   	pop    %rbx
+  8060ab:	41 5f                	pop    %r15
+  8060ad:	5d                   	pop    %rbp
+  8060ae:	c3                   	ret
+
+00000000008060af <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8060af:	55                   	push   %rbp
+  8060b0:	48 89 e5             	mov    %rsp,%rbp
+  8060b3:	41 57                	push   %r15
+  8060b5:	53                   	push   %rbx
+  8060b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8060ba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060ba <nsipc+0xb>
+  8060c1:	49 bb 8e 3f 00 00 00 	movabs $0x3f8e,%r11
+  8060c8:	00 00 00 
+  8060cb:	4c 01 db             	add    %r11,%rbx
+  8060ce:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8060d1:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  8060d8:	00 00 00 
+  8060db:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8060de:	85 c0                	test   %eax,%eax
+  8060e0:	75 24                	jne    806106 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8060e2:	bf 02 00 00 00       	mov    $0x2,%edi
+  8060e7:	49 89 df             	mov    %rbx,%r15
+  8060ea:	48 b8 78 a3 ff ff ff 	movabs $0xffffffffffffa378,%rax
+  8060f1:	ff ff ff 
+  8060f4:	48 01 d8             	add    %rbx,%rax
+  8060f7:	ff d0                	call   *%rax
+  8060f9:	48 ba b8 2f 01 00 00 	movabs $0x12fb8,%rdx
+  806100:	00 00 00 
+  806103:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  806106:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  80610d:	00 00 00 
+  806110:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806113:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  806116:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80611c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  806122:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806127:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  80612e:	00 00 00 
+  806131:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806135:	89 c7                	mov    %eax,%edi
+  806137:	49 89 df             	mov    %rbx,%r15
+  80613a:	48 b8 97 9d ff ff ff 	movabs $0xffffffffffff9d97,%rax
+  806141:	ff ff ff 
+  806144:	48 01 d8             	add    %rbx,%rax
+  806147:	ff d0                	call   *%rax
+}
+  806149:	48 83 c4 10          	add    $0x10,%rsp
+  80614d:	5b                   	pop    %rbx
+  80614e:	41 5f                	pop    %r15
+  806150:	5d                   	pop    %rbp
+  806151:	c3                   	ret
+
+0000000000806152 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  806152:	55                   	push   %rbp
+  806153:	48 89 e5             	mov    %rsp,%rbp
+  806156:	41 57                	push   %r15
+  806158:	53                   	push   %rbx
+  806159:	48 83 ec 20          	sub    $0x20,%rsp
+  80615d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80615d <nsipc_words+0xb>
+  806164:	49 bb eb 3e 00 00 00 	movabs $0x3eeb,%r11
+  80616b:	00 00 00 
+  80616e:	4c 01 db             	add    %r11,%rbx
+  806171:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806174:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806178:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80617c:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  806183:	00 00 00 
+  806186:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806189:	85 c0                	test   %eax,%eax
+  80618b:	75 24                	jne    8061b1 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80618d:	bf 02 00 00 00       	mov    $0x2,%edi
+  806192:	49 89 df             	mov    %rbx,%r15
+  806195:	48 b8 78 a3 ff ff ff 	movabs $0xffffffffffffa378,%rax
+  80619c:	ff ff ff 
+  80619f:	48 01 d8             	add    %rbx,%rax
+  8061a2:	ff d0                	call   *%rax
+  8061a4:	48 ba b8 2f 01 00 00 	movabs $0x12fb8,%rdx
+  8061ab:	00 00 00 
+  8061ae:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8061b1:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  8061b8:	00 00 00 
+  8061bb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8061be:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8061c2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8061c6:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8061c9:	89 c7                	mov    %eax,%edi
+  8061cb:	49 89 df             	mov    %rbx,%r15
+  8061ce:	48 b8 82 9e ff ff ff 	movabs $0xffffffffffff9e82,%rax
+  8061d5:	ff ff ff 
+  8061d8:	48 01 d8             	add    %rbx,%rax
+  8061db:	ff d0                	call   *%rax
+}
+  8061dd:	48 83 c4 20          	add    $0x20,%rsp
+  8061e1:	5b                   	pop    %rbx
+  8061e2:	41 5f                	pop    %r15
+  8061e4:	5d                   	pop    %rbp
+  8061e5:	c3                   	ret
+
+00000000008061e6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8061e6:	55                   	push   %rbp
+  8061e7:	48 89 e5             	mov    %rsp,%rbp
+  8061ea:	41 57                	push   %r15
+  8061ec:	53                   	push   %rbx
+  8061ed:	48 83 ec 30          	sub    $0x30,%rsp
+  8061f1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061f1 <nsipc_accept+0xb>
+  8061f8:	49 bb 57 3e 00 00 00 	movabs $0x3e57,%r11
+  8061ff:	00 00 00 
+  806202:	4c 01 db             	add    %r11,%rbx
+  806205:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806208:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80620c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  806210:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  806217:	00 00 00 
+  80621a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80621d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  806220:	bf 01 00 00 00       	mov    $0x1,%edi
+  806225:	48 b8 67 c0 ff ff ff 	movabs $0xffffffffffffc067,%rax
+  80622c:	ff ff ff 
+  80622f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806233:	ff d0                	call   *%rax
+  806235:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806238:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80623c:	78 48                	js     806286 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80623e:	48 b8 b8 4f 01 00 00 	movabs $0x14fb8,%rax
+  806245:	00 00 00 
+  806248:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80624c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  806250:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806254:	8b 40 10             	mov    0x10(%rax),%eax
+  806257:	89 c2                	mov    %eax,%edx
+  806259:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80625d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806261:	48 89 ce             	mov    %rcx,%rsi
+  806264:	48 89 c7             	mov    %rax,%rdi
+  806267:	49 89 df             	mov    %rbx,%r15
+  80626a:	48 b8 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rax
+  806271:	ff ff ff 
+  806274:	48 01 d8             	add    %rbx,%rax
+  806277:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  806279:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80627d:	8b 50 10             	mov    0x10(%rax),%edx
+  806280:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806284:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  806286:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806289:	48 83 c4 30          	add    $0x30,%rsp
+  80628d:	5b                   	pop    %rbx
+  80628e:	41 5f                	pop    %r15
+  806290:	5d                   	pop    %rbp
+  806291:	c3                   	ret
+
+0000000000806292 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  806292:	55                   	push   %rbp
+  806293:	48 89 e5             	mov    %rsp,%rbp
+  806296:	41 57                	push   %r15
+  806298:	53                   	push   %rbx
+  806299:	48 83 ec 10          	sub    $0x10,%rsp
+  80629d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80629d <nsipc_bind+0xb>
+  8062a4:	49 bb ab 3d 00 00 00 	movabs $0x3dab,%r11
+  8062ab:	00 00 00 
+  8062ae:	4c 01 db             	add    %r11,%rbx
+  8062b1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8062b4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8062b8:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8062bb:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8062c2:	00 00 00 
+  8062c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062c8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8062cb:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8062ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062d2:	48 89 c6             	mov    %rax,%rsi
+  8062d5:	48 b8 bc 4f 01 00 00 	movabs $0x14fbc,%rax
+  8062dc:	00 00 00 
+  8062df:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8062e3:	48 89 c7             	mov    %rax,%rdi
+  8062e6:	49 89 df             	mov    %rbx,%r15
+  8062e9:	48 b8 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rax
+  8062f0:	ff ff ff 
+  8062f3:	48 01 d8             	add    %rbx,%rax
+  8062f6:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8062f8:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8062ff:	00 00 00 
+  806302:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806305:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  806309:	bf 02 00 00 00       	mov    $0x2,%edi
+  80630e:	48 b8 67 c0 ff ff ff 	movabs $0xffffffffffffc067,%rax
+  806315:	ff ff ff 
+  806318:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80631c:	ff d0                	call   *%rax
+}
+  80631e:	48 83 c4 10          	add    $0x10,%rsp
+  806322:	5b                   	pop    %rbx
+  806323:	41 5f                	pop    %r15
+  806325:	5d                   	pop    %rbp
+  806326:	c3                   	ret
+
+0000000000806327 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  806327:	55                   	push   %rbp
+  806328:	48 89 e5             	mov    %rsp,%rbp
+  80632b:	48 83 ec 20          	sub    $0x20,%rsp
+  80632f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80632f <nsipc_shutdown+0x8>
+  806336:	49 bb 19 3d 00 00 00 	movabs $0x3d19,%r11
+  80633d:	00 00 00 
+  806340:	4c 01 d8             	add    %r11,%rax
+  806343:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806346:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  806349:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80634c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  80634f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806352:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  806355:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  806359:	ba 08 00 00 00       	mov    $0x8,%edx
+  80635e:	48 89 ce             	mov    %rcx,%rsi
+  806361:	bf 03 00 00 00       	mov    $0x3,%edi
+  806366:	48 b9 0a c1 ff ff ff 	movabs $0xffffffffffffc10a,%rcx
+  80636d:	ff ff ff 
+  806370:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  806374:	ff d0                	call   *%rax
+}
+  806376:	c9                   	leave
+  806377:	c3                   	ret
+
+0000000000806378 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  806378:	55                   	push   %rbp
+  806379:	48 89 e5             	mov    %rsp,%rbp
+  80637c:	48 83 ec 20          	sub    $0x20,%rsp
+  806380:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806380 <nsipc_close+0x8>
+  806387:	49 bb c8 3c 00 00 00 	movabs $0x3cc8,%r11
+  80638e:	00 00 00 
+  806391:	4c 01 d8             	add    %r11,%rax
+  806394:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  806397:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80639a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80639d:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8063a1:	ba 04 00 00 00       	mov    $0x4,%edx
+  8063a6:	48 89 ce             	mov    %rcx,%rsi
+  8063a9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8063ae:	48 b9 0a c1 ff ff ff 	movabs $0xffffffffffffc10a,%rcx
+  8063b5:	ff ff ff 
+  8063b8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8063bc:	ff d0                	call   *%rax
+}
+  8063be:	c9                   	leave
+  8063bf:	c3                   	ret
+
+00000000008063c0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8063c0:	55                   	push   %rbp
+  8063c1:	48 89 e5             	mov    %rsp,%rbp
+  8063c4:	41 57                	push   %r15
+  8063c6:	53                   	push   %rbx
+  8063c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8063cb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063cb <nsipc_connect+0xb>
+  8063d2:	49 bb 7d 3c 00 00 00 	movabs $0x3c7d,%r11
+  8063d9:	00 00 00 
+  8063dc:	4c 01 db             	add    %r11,%rbx
+  8063df:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8063e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8063e6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8063e9:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8063f0:	00 00 00 
+  8063f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063f6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8063f9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8063fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806400:	48 89 c6             	mov    %rax,%rsi
+  806403:	48 b8 bc 4f 01 00 00 	movabs $0x14fbc,%rax
+  80640a:	00 00 00 
+  80640d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806411:	48 89 c7             	mov    %rax,%rdi
+  806414:	49 89 df             	mov    %rbx,%r15
+  806417:	48 b8 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rax
+  80641e:	ff ff ff 
+  806421:	48 01 d8             	add    %rbx,%rax
+  806424:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  806426:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  80642d:	00 00 00 
+  806430:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806433:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  806437:	bf 05 00 00 00       	mov    $0x5,%edi
+  80643c:	48 b8 67 c0 ff ff ff 	movabs $0xffffffffffffc067,%rax
+  806443:	ff ff ff 
+  806446:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80644a:	ff d0                	call   *%rax
+}
+  80644c:	48 83 c4 10          	add    $0x10,%rsp
+  806450:	5b                   	pop    %rbx
+  806451:	41 5f                	pop    %r15
+  806453:	5d                   	pop    %rbp
+  806454:	c3                   	ret
+
+0000000000806455 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  806455:	55                   	push   %rbp
+  806456:	48 89 e5             	mov    %rsp,%rbp
+  806459:	48 83 ec 20          	sub    $0x20,%rsp
+  80645d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80645d <nsipc_listen+0x8>
+  806464:	49 bb eb 3b 00 00 00 	movabs $0x3beb,%r11
+  80646b:	00 00 00 
+  80646e:	4c 01 d8             	add    %r11,%rax
+  806471:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806474:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  806477:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80647a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  80647d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806480:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  806483:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  806487:	ba 08 00 00 00       	mov    $0x8,%edx
+  80648c:	48 89 ce             	mov    %rcx,%rsi
+  80648f:	bf 06 00 00 00       	mov    $0x6,%edi
+  806494:	48 b9 0a c1 ff ff ff 	movabs $0xffffffffffffc10a,%rcx
+  80649b:	ff ff ff 
+  80649e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8064a2:	ff d0                	call   *%rax
+}
+  8064a4:	c9                   	leave
+  8064a5:	c3                   	ret
+
+00000000008064a6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8064a6:	55                   	push   %rbp
+  8064a7:	48 89 e5             	mov    %rsp,%rbp
+  8064aa:	41 57                	push   %r15
+  8064ac:	53                   	push   %rbx
+  8064ad:	48 83 ec 30          	sub    $0x30,%rsp
+  8064b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064b1 <nsipc_recv+0xb>
+  8064b8:	49 bb 97 3b 00 00 00 	movabs $0x3b97,%r11
+  8064bf:	00 00 00 
+  8064c2:	4c 01 db             	add    %r11,%rbx
+  8064c5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8064c8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8064cc:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8064cf:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8064d2:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8064d9:	00 00 00 
+  8064dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8064df:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8064e2:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8064e9:	00 00 00 
+  8064ec:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8064ef:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8064f3:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8064fa:	00 00 00 
+  8064fd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806500:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  806504:	bf 07 00 00 00       	mov    $0x7,%edi
+  806509:	48 b8 67 c0 ff ff ff 	movabs $0xffffffffffffc067,%rax
+  806510:	ff ff ff 
+  806513:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806517:	ff d0                	call   *%rax
+  806519:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80651c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806520:	0f 88 91 00 00 00    	js     8065b7 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  806526:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  80652d:	7f 08                	jg     806537 <nsipc_recv+0x91>
+  80652f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806532:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  806535:	7e 50                	jle    806587 <nsipc_recv+0xe1>
+  806537:	48 b8 3b e2 ff ff ff 	movabs $0xffffffffffffe23b,%rax
+  80653e:	ff ff ff 
+  806541:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806545:	48 89 c1             	mov    %rax,%rcx
+  806548:	48 b8 50 e2 ff ff ff 	movabs $0xffffffffffffe250,%rax
+  80654f:	ff ff ff 
+  806552:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806556:	48 89 c2             	mov    %rax,%rdx
+  806559:	be 79 00 00 00       	mov    $0x79,%esi
+  80655e:	48 b8 65 e2 ff ff ff 	movabs $0xffffffffffffe265,%rax
+  806565:	ff ff ff 
+  806568:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80656c:	48 89 c7             	mov    %rax,%rdi
+  80656f:	49 89 df             	mov    %rbx,%r15
+  806572:	b8 00 00 00 00       	mov    $0x0,%eax
+  806577:	49 b8 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%r8
+  80657e:	ff ff ff 
+  806581:	49 01 d8             	add    %rbx,%r8
+  806584:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  806587:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80658a:	48 63 d0             	movslq %eax,%rdx
+  80658d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806591:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  806598:	00 00 00 
+  80659b:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  80659f:	48 89 ce             	mov    %rcx,%rsi
+  8065a2:	48 89 c7             	mov    %rax,%rdi
+  8065a5:	49 89 df             	mov    %rbx,%r15
+  8065a8:	48 b8 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rax
+  8065af:	ff ff ff 
+  8065b2:	48 01 d8             	add    %rbx,%rax
+  8065b5:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8065b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8065ba:	48 83 c4 30          	add    $0x30,%rsp
+  8065be:	5b                   	pop    %rbx
+  8065bf:	41 5f                	pop    %r15
+  8065c1:	5d                   	pop    %rbp
+  8065c2:	c3                   	ret
+
+00000000008065c3 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8065c3:	55                   	push   %rbp
+  8065c4:	48 89 e5             	mov    %rsp,%rbp
+  8065c7:	41 57                	push   %r15
+  8065c9:	53                   	push   %rbx
+  8065ca:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8065d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065d1 <nsipc_send+0xe>
+  8065d8:	49 bb 77 3a 00 00 00 	movabs $0x3a77,%r11
+  8065df:	00 00 00 
+  8065e2:	4c 01 db             	add    %r11,%rbx
+  8065e5:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8065eb:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8065f2:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8065f8:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8065fe:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  806602:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  806606:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  80660d:	00 00 00 
+  806610:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806613:	85 c0                	test   %eax,%eax
+  806615:	75 24                	jne    80663b <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  806617:	bf 02 00 00 00       	mov    $0x2,%edi
+  80661c:	49 89 df             	mov    %rbx,%r15
+  80661f:	48 b8 78 a3 ff ff ff 	movabs $0xffffffffffffa378,%rax
+  806626:	ff ff ff 
+  806629:	48 01 d8             	add    %rbx,%rax
+  80662c:	ff d0                	call   *%rax
+  80662e:	48 ba b8 2f 01 00 00 	movabs $0x12fb8,%rdx
+  806635:	00 00 00 
+  806638:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  80663b:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  806641:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  806644:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  80664b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80664e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806651:	39 c2                	cmp    %eax,%edx
+  806653:	0f 4e c2             	cmovle %edx,%eax
+  806656:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  80665c:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  806662:	48 63 d0             	movslq %eax,%rdx
+  806665:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  80666c:	48 89 c6             	mov    %rax,%rsi
+  80666f:	48 b8 b8 2f 00 00 00 	movabs $0x2fb8,%rax
+  806676:	00 00 00 
+  806679:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80667d:	48 89 c7             	mov    %rax,%rdi
+  806680:	49 89 df             	mov    %rbx,%r15
+  806683:	48 b8 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rax
+  80668a:	ff ff ff 
+  80668d:	48 01 d8             	add    %rbx,%rax
+  806690:	ff d0                	call   *%rax
+	req->req_s = s;
+  806692:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806696:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80669c:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80669e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066a2:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8066a8:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  8066ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066af:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8066b5:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  8066b8:	48 b8 b8 2f 00 00 00 	movabs $0x2fb8,%rax
+  8066bf:	00 00 00 
+  8066c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8066c6:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8066ca:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8066d1:	00 
+  8066d2:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8066d8:	48 63 d0             	movslq %eax,%rdx
+  8066db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8066df:	48 01 d0             	add    %rdx,%rax
+  8066e2:	48 83 e8 01          	sub    $0x1,%rax
+  8066e6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8066ea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8066ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8066f3:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8066f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8066fb:	48 29 d0             	sub    %rdx,%rax
+  8066fe:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  806704:	85 c0                	test   %eax,%eax
+  806706:	0f 48 c2             	cmovs  %edx,%eax
+  806709:	c1 f8 0c             	sar    $0xc,%eax
+  80670c:	48 98                	cltq
+  80670e:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  806712:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806716:	48 85 c0             	test   %rax,%rax
+  806719:	0f 95 c0             	setne  %al
+  80671c:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  80671f:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  806726:	00 
+  806727:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80672b:	48 83 c0 0b          	add    $0xb,%rax
+  80672f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806733:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806737:	ba 00 00 00 00       	mov    $0x0,%edx
+  80673c:	48 f7 75 c8          	divq   -0x38(%rbp)
+  806740:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806744:	48 29 d0             	sub    %rdx,%rax
+  806747:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80674b:	89 c7                	mov    %eax,%edi
+  80674d:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  806754:	00 00 00 
+  806757:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80675a:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80675e:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  806762:	48 83 ec 08          	sub    $0x8,%rsp
+  806766:	6a 00                	push   $0x0
+  806768:	6a 00                	push   $0x0
+  80676a:	6a 05                	push   $0x5
+  80676c:	41 89 f1             	mov    %esi,%r9d
+  80676f:	49 89 c8             	mov    %rcx,%r8
+  806772:	89 f9                	mov    %edi,%ecx
+  806774:	be 08 00 00 00       	mov    $0x8,%esi
+  806779:	89 c7                	mov    %eax,%edi
+  80677b:	49 89 df             	mov    %rbx,%r15
+  80677e:	48 b8 80 9f ff ff ff 	movabs $0xffffffffffff9f80,%rax
+  806785:	ff ff ff 
+  806788:	48 01 d8             	add    %rbx,%rax
+  80678b:	ff d0                	call   *%rax
+  80678d:	48 83 c4 20          	add    $0x20,%rsp
+}
+  806791:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  806795:	5b                   	pop    %rbx
+  806796:	41 5f                	pop    %r15
+  806798:	5d                   	pop    %rbp
+  806799:	c3                   	ret
+
+000000000080679a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80679a:	55                   	push   %rbp
+  80679b:	48 89 e5             	mov    %rsp,%rbp
+  80679e:	48 83 ec 10          	sub    $0x10,%rsp
+  8067a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8067a2 <nsipc_socket+0x8>
+  8067a9:	49 bb a6 38 00 00 00 	movabs $0x38a6,%r11
+  8067b0:	00 00 00 
+  8067b3:	4c 01 d8             	add    %r11,%rax
+  8067b6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8067b9:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8067bc:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8067bf:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  8067c6:	00 00 00 
+  8067c9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8067cc:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8067cf:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  8067d6:	00 00 00 
+  8067d9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8067dc:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8067e0:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  8067e7:	00 00 00 
+  8067ea:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8067ed:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8067f1:	bf 09 00 00 00       	mov    $0x9,%edi
+  8067f6:	48 ba 67 c0 ff ff ff 	movabs $0xffffffffffffc067,%rdx
+  8067fd:	ff ff ff 
+  806800:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806804:	ff d0                	call   *%rax
+}
+  806806:	c9                   	leave
+  806807:	c3                   	ret
+
+0000000000806808 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  806808:	55                   	push   %rbp
+  806809:	48 89 e5             	mov    %rsp,%rbp
+  80680c:	41 57                	push   %r15
+  80680e:	53                   	push   %rbx
+  80680f:	48 83 ec 30          	sub    $0x30,%rsp
+  806813:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806813 <pipe+0xb>
+  80681a:	49 bb 35 38 00 00 00 	movabs $0x3835,%r11
+  806821:	00 00 00 
+  806824:	4c 01 db             	add    %r11,%rbx
+  806827:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  80682b:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  80682f:	48 89 c7             	mov    %rax,%rdi
+  806832:	49 89 df             	mov    %rbx,%r15
+  806835:	48 b8 81 a4 ff ff ff 	movabs $0xffffffffffffa481,%rax
+  80683c:	ff ff ff 
+  80683f:	48 01 d8             	add    %rbx,%rax
+  806842:	ff d0                	call   *%rax
+  806844:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806847:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80684b:	0f 88 12 02 00 00    	js     806a63 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806851:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806855:	ba 07 04 00 00       	mov    $0x407,%edx
+  80685a:	48 89 c6             	mov    %rax,%rsi
+  80685d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806862:	49 89 df             	mov    %rbx,%r15
+  806865:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  80686c:	ff ff ff 
+  80686f:	48 01 d8             	add    %rbx,%rax
+  806872:	ff d0                	call   *%rax
+  806874:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806877:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80687b:	0f 88 e2 01 00 00    	js     806a63 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  806881:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  806885:	48 89 c7             	mov    %rax,%rdi
+  806888:	49 89 df             	mov    %rbx,%r15
+  80688b:	48 b8 81 a4 ff ff ff 	movabs $0xffffffffffffa481,%rax
+  806892:	ff ff ff 
+  806895:	48 01 d8             	add    %rbx,%rax
+  806898:	ff d0                	call   *%rax
+  80689a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80689d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068a1:	0f 88 9b 01 00 00    	js     806a42 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8068a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068ab:	ba 07 04 00 00       	mov    $0x407,%edx
+  8068b0:	48 89 c6             	mov    %rax,%rsi
+  8068b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8068b8:	49 89 df             	mov    %rbx,%r15
+  8068bb:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  8068c2:	ff ff ff 
+  8068c5:	48 01 d8             	add    %rbx,%rax
+  8068c8:	ff d0                	call   *%rax
+  8068ca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8068cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068d1:	0f 88 6b 01 00 00    	js     806a42 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8068d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8068db:	48 89 c7             	mov    %rax,%rdi
+  8068de:	49 89 df             	mov    %rbx,%r15
+  8068e1:	48 b8 3e a4 ff ff ff 	movabs $0xffffffffffffa43e,%rax
+  8068e8:	ff ff ff 
+  8068eb:	48 01 d8             	add    %rbx,%rax
+  8068ee:	ff d0                	call   *%rax
+  8068f0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8068f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8068f8:	ba 07 04 00 00       	mov    $0x407,%edx
+  8068fd:	48 89 c6             	mov    %rax,%rsi
+  806900:	bf 00 00 00 00       	mov    $0x0,%edi
+  806905:	49 89 df             	mov    %rbx,%r15
+  806908:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  80690f:	ff ff ff 
+  806912:	48 01 d8             	add    %rbx,%rax
+  806915:	ff d0                	call   *%rax
+  806917:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80691a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80691e:	0f 88 fd 00 00 00    	js     806a21 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806924:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806928:	48 89 c7             	mov    %rax,%rdi
+  80692b:	49 89 df             	mov    %rbx,%r15
+  80692e:	48 b8 3e a4 ff ff ff 	movabs $0xffffffffffffa43e,%rax
+  806935:	ff ff ff 
+  806938:	48 01 d8             	add    %rbx,%rax
+  80693b:	ff d0                	call   *%rax
+  80693d:	48 89 c2             	mov    %rax,%rdx
+  806940:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806944:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80694a:	48 89 d1             	mov    %rdx,%rcx
+  80694d:	ba 00 00 00 00       	mov    $0x0,%edx
+  806952:	48 89 c6             	mov    %rax,%rsi
+  806955:	bf 00 00 00 00       	mov    $0x0,%edi
+  80695a:	49 89 df             	mov    %rbx,%r15
+  80695d:	48 b8 6b 89 ff ff ff 	movabs $0xffffffffffff896b,%rax
+  806964:	ff ff ff 
+  806967:	48 01 d8             	add    %rbx,%rax
+  80696a:	ff d0                	call   *%rax
+  80696c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80696f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806973:	0f 88 87 00 00 00    	js     806a00 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  806979:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80697d:	48 ba b8 00 00 00 00 	movabs $0xb8,%rdx
+  806984:	00 00 00 
+  806987:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80698a:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  80698c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806990:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  806997:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80699b:	48 ba b8 00 00 00 00 	movabs $0xb8,%rdx
+  8069a2:	00 00 00 
+  8069a5:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8069a8:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8069aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8069ae:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8069b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8069b9:	48 89 c7             	mov    %rax,%rdi
+  8069bc:	49 89 df             	mov    %rbx,%r15
+  8069bf:	48 b8 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rax
+  8069c6:	ff ff ff 
+  8069c9:	48 01 d8             	add    %rbx,%rax
+  8069cc:	ff d0                	call   *%rax
+  8069ce:	89 c2                	mov    %eax,%edx
+  8069d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8069d4:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8069d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8069da:	48 89 c7             	mov    %rax,%rdi
+  8069dd:	49 89 df             	mov    %rbx,%r15
+  8069e0:	48 b8 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rax
+  8069e7:	ff ff ff 
+  8069ea:	48 01 d8             	add    %rbx,%rax
+  8069ed:	ff d0                	call   *%rax
+  8069ef:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8069f3:	48 83 c2 04          	add    $0x4,%rdx
+  8069f7:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  8069f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8069fe:	eb 67                	jmp    806a67 <pipe+0x25f>
+		goto err3;
+  806a00:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806a01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a05:	48 89 c6             	mov    %rax,%rsi
+  806a08:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a0d:	49 89 df             	mov    %rbx,%r15
+  806a10:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  806a17:	ff ff ff 
+  806a1a:	48 01 d8             	add    %rbx,%rax
+  806a1d:	ff d0                	call   *%rax
+  806a1f:	eb 01                	jmp    806a22 <pipe+0x21a>
+		goto err2;
+  806a21:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  806a22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806a26:	48 89 c6             	mov    %rax,%rsi
+  806a29:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a2e:	49 89 df             	mov    %rbx,%r15
+  806a31:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  806a38:	ff ff ff 
+  806a3b:	48 01 d8             	add    %rbx,%rax
+  806a3e:	ff d0                	call   *%rax
+  806a40:	eb 01                	jmp    806a43 <pipe+0x23b>
+		goto err1;
+  806a42:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806a43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806a47:	48 89 c6             	mov    %rax,%rsi
+  806a4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a4f:	49 89 df             	mov    %rbx,%r15
+  806a52:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  806a59:	ff ff ff 
+  806a5c:	48 01 d8             	add    %rbx,%rax
+  806a5f:	ff d0                	call   *%rax
+  806a61:	eb 01                	jmp    806a64 <pipe+0x25c>
+		goto err;
+  806a63:	90                   	nop
+err:
+	return r;
+  806a64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806a67:	48 83 c4 30          	add    $0x30,%rsp
+  806a6b:	5b                   	pop    %rbx
+  806a6c:	41 5f                	pop    %r15
+  806a6e:	5d                   	pop    %rbp
+  806a6f:	c3                   	ret
+
+0000000000806a70 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  806a70:	55                   	push   %rbp
+  806a71:	48 89 e5             	mov    %rsp,%rbp
+  806a74:	41 57                	push   %r15
+  806a76:	41 54                	push   %r12
+  806a78:	53                   	push   %rbx
+  806a79:	48 83 ec 28          	sub    $0x28,%rsp
+  806a7d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a7d <_pipeisclosed+0xd>
+  806a84:	49 bb cb 35 00 00 00 	movabs $0x35cb,%r11
+  806a8b:	00 00 00 
+  806a8e:	4c 01 db             	add    %r11,%rbx
+  806a91:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806a95:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  806a99:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806aa0:	ff ff ff 
+  806aa3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806aa7:	48 8b 00             	mov    (%rax),%rax
+  806aaa:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806ab0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  806ab3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806ab7:	48 89 c7             	mov    %rax,%rdi
+  806aba:	49 89 df             	mov    %rbx,%r15
+  806abd:	48 b8 92 d4 ff ff ff 	movabs $0xffffffffffffd492,%rax
+  806ac4:	ff ff ff 
+  806ac7:	48 01 d8             	add    %rbx,%rax
+  806aca:	ff d0                	call   *%rax
+  806acc:	41 89 c4             	mov    %eax,%r12d
+  806acf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806ad3:	48 89 c7             	mov    %rax,%rdi
+  806ad6:	49 89 df             	mov    %rbx,%r15
+  806ad9:	48 b8 92 d4 ff ff ff 	movabs $0xffffffffffffd492,%rax
+  806ae0:	ff ff ff 
+  806ae3:	48 01 d8             	add    %rbx,%rax
+  806ae6:	ff d0                	call   *%rax
+  806ae8:	41 39 c4             	cmp    %eax,%r12d
+  806aeb:	0f 94 c0             	sete   %al
+  806aee:	0f b6 c0             	movzbl %al,%eax
+  806af1:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806af4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806afb:	ff ff ff 
+  806afe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b02:	48 8b 00             	mov    (%rax),%rax
+  806b05:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806b0b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  806b0e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b11:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806b14:	75 05                	jne    806b1b <_pipeisclosed+0xab>
+			return ret;
+  806b16:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806b19:	eb 63                	jmp    806b7e <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  806b1b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b1e:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806b21:	0f 84 72 ff ff ff    	je     806a99 <_pipeisclosed+0x29>
+  806b27:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  806b2b:	0f 85 68 ff ff ff    	jne    806a99 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  806b31:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b38:	ff ff ff 
+  806b3b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b3f:	48 8b 00             	mov    (%rax),%rax
+  806b42:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806b48:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  806b4b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b4e:	89 c6                	mov    %eax,%esi
+  806b50:	48 b8 76 e2 ff ff ff 	movabs $0xffffffffffffe276,%rax
+  806b57:	ff ff ff 
+  806b5a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b5e:	48 89 c7             	mov    %rax,%rdi
+  806b61:	49 89 df             	mov    %rbx,%r15
+  806b64:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b69:	49 b8 88 6e ff ff ff 	movabs $0xffffffffffff6e88,%r8
+  806b70:	ff ff ff 
+  806b73:	49 01 d8             	add    %rbx,%r8
+  806b76:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  806b79:	e9 1b ff ff ff       	jmp    806a99 <_pipeisclosed+0x29>
+	}
+}
+  806b7e:	48 83 c4 28          	add    $0x28,%rsp
+  806b82:	5b                   	pop    %rbx
+  806b83:	41 5c                	pop    %r12
+  806b85:	41 5f                	pop    %r15
+  806b87:	5d                   	pop    %rbp
+  806b88:	c3                   	ret
+
+0000000000806b89 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  806b89:	55                   	push   %rbp
+  806b8a:	48 89 e5             	mov    %rsp,%rbp
+  806b8d:	41 57                	push   %r15
+  806b8f:	53                   	push   %rbx
+  806b90:	48 83 ec 30          	sub    $0x30,%rsp
+  806b94:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b94 <pipeisclosed+0xb>
+  806b9b:	49 bb b4 34 00 00 00 	movabs $0x34b4,%r11
+  806ba2:	00 00 00 
+  806ba5:	4c 01 db             	add    %r11,%rbx
+  806ba8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806bab:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  806baf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806bb2:	48 89 d6             	mov    %rdx,%rsi
+  806bb5:	89 c7                	mov    %eax,%edi
+  806bb7:	49 89 df             	mov    %rbx,%r15
+  806bba:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  806bc1:	ff ff ff 
+  806bc4:	48 01 d8             	add    %rbx,%rax
+  806bc7:	ff d0                	call   *%rax
+  806bc9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806bcc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806bd0:	79 05                	jns    806bd7 <pipeisclosed+0x4e>
+		return r;
+  806bd2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bd5:	eb 3b                	jmp    806c12 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  806bd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806bdb:	48 89 c7             	mov    %rax,%rdi
+  806bde:	49 89 df             	mov    %rbx,%r15
+  806be1:	48 b8 3e a4 ff ff ff 	movabs $0xffffffffffffa43e,%rax
+  806be8:	ff ff ff 
+  806beb:	48 01 d8             	add    %rbx,%rax
+  806bee:	ff d0                	call   *%rax
+  806bf0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806bf4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806bf8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806bfc:	48 89 d6             	mov    %rdx,%rsi
+  806bff:	48 89 c7             	mov    %rax,%rdi
+  806c02:	48 b8 28 ca ff ff ff 	movabs $0xffffffffffffca28,%rax
+  806c09:	ff ff ff 
+  806c0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806c10:	ff d0                	call   *%rax
+}
+  806c12:	48 83 c4 30          	add    $0x30,%rsp
+  806c16:	5b                   	pop    %rbx
+  806c17:	41 5f                	pop    %r15
+  806c19:	5d                   	pop    %rbp
+  806c1a:	c3                   	ret
+
+0000000000806c1b <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806c1b:	55                   	push   %rbp
+  806c1c:	48 89 e5             	mov    %rsp,%rbp
+  806c1f:	41 57                	push   %r15
+  806c21:	53                   	push   %rbx
+  806c22:	48 83 ec 40          	sub    $0x40,%rsp
+  806c26:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c26 <devpipe_read+0xb>
+  806c2d:	49 bb 22 34 00 00 00 	movabs $0x3422,%r11
+  806c34:	00 00 00 
+  806c37:	4c 01 db             	add    %r11,%rbx
+  806c3a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806c3e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806c42:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806c46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806c4a:	48 89 c7             	mov    %rax,%rdi
+  806c4d:	49 89 df             	mov    %rbx,%r15
+  806c50:	48 b8 3e a4 ff ff ff 	movabs $0xffffffffffffa43e,%rax
+  806c57:	ff ff ff 
+  806c5a:	48 01 d8             	add    %rbx,%rax
+  806c5d:	ff d0                	call   *%rax
+  806c5f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806c63:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806c67:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806c6b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806c72:	00 
+  806c73:	e9 a1 00 00 00       	jmp    806d19 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  806c78:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806c7d:	74 09                	je     806c88 <devpipe_read+0x6d>
+				return i;
+  806c7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806c83:	e9 9f 00 00 00       	jmp    806d27 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  806c88:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806c8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806c90:	48 89 d6             	mov    %rdx,%rsi
+  806c93:	48 89 c7             	mov    %rax,%rdi
+  806c96:	48 b8 28 ca ff ff ff 	movabs $0xffffffffffffca28,%rax
+  806c9d:	ff ff ff 
+  806ca0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806ca4:	ff d0                	call   *%rax
+  806ca6:	85 c0                	test   %eax,%eax
+  806ca8:	74 07                	je     806cb1 <devpipe_read+0x96>
+				return 0;
+  806caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  806caf:	eb 76                	jmp    806d27 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  806cb1:	49 89 df             	mov    %rbx,%r15
+  806cb4:	48 b8 b1 88 ff ff ff 	movabs $0xffffffffffff88b1,%rax
+  806cbb:	ff ff ff 
+  806cbe:	48 01 d8             	add    %rbx,%rax
+  806cc1:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  806cc3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806cc7:	8b 10                	mov    (%rax),%edx
+  806cc9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ccd:	8b 40 04             	mov    0x4(%rax),%eax
+  806cd0:	39 c2                	cmp    %eax,%edx
+  806cd2:	74 a4                	je     806c78 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  806cd4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806cd8:	8b 10                	mov    (%rax),%edx
+  806cda:	89 d0                	mov    %edx,%eax
+  806cdc:	c1 f8 1f             	sar    $0x1f,%eax
+  806cdf:	c1 e8 1b             	shr    $0x1b,%eax
+  806ce2:	01 c2                	add    %eax,%edx
+  806ce4:	83 e2 1f             	and    $0x1f,%edx
+  806ce7:	29 c2                	sub    %eax,%edx
+  806ce9:	89 d6                	mov    %edx,%esi
+  806ceb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806cef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806cf3:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806cf7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806cfb:	48 63 c6             	movslq %esi,%rax
+  806cfe:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806d03:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806d05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d09:	8b 00                	mov    (%rax),%eax
+  806d0b:	8d 50 01             	lea    0x1(%rax),%edx
+  806d0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d12:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806d14:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806d19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806d1d:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806d21:	72 a0                	jb     806cc3 <devpipe_read+0xa8>
+	}
+	return i;
+  806d23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806d27:	48 83 c4 40          	add    $0x40,%rsp
+  806d2b:	5b                   	pop    %rbx
+  806d2c:	41 5f                	pop    %r15
+  806d2e:	5d                   	pop    %rbp
+  806d2f:	c3                   	ret
+
+0000000000806d30 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806d30:	55                   	push   %rbp
+  806d31:	48 89 e5             	mov    %rsp,%rbp
+  806d34:	41 57                	push   %r15
+  806d36:	53                   	push   %rbx
+  806d37:	48 83 ec 40          	sub    $0x40,%rsp
+  806d3b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d3b <devpipe_write+0xb>
+  806d42:	49 bb 0d 33 00 00 00 	movabs $0x330d,%r11
+  806d49:	00 00 00 
+  806d4c:	4c 01 db             	add    %r11,%rbx
+  806d4f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806d53:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806d57:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  806d5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806d5f:	48 89 c7             	mov    %rax,%rdi
+  806d62:	49 89 df             	mov    %rbx,%r15
+  806d65:	48 b8 3e a4 ff ff ff 	movabs $0xffffffffffffa43e,%rax
+  806d6c:	ff ff ff 
+  806d6f:	48 01 d8             	add    %rbx,%rax
+  806d72:	ff d0                	call   *%rax
+  806d74:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806d78:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806d7c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806d80:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806d87:	00 
+  806d88:	e9 a0 00 00 00       	jmp    806e2d <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  806d8d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806d91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806d95:	48 89 d6             	mov    %rdx,%rsi
+  806d98:	48 89 c7             	mov    %rax,%rdi
+  806d9b:	48 b8 28 ca ff ff ff 	movabs $0xffffffffffffca28,%rax
+  806da2:	ff ff ff 
+  806da5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806da9:	ff d0                	call   *%rax
+  806dab:	85 c0                	test   %eax,%eax
+  806dad:	74 0a                	je     806db9 <devpipe_write+0x89>
+				return 0;
+  806daf:	b8 00 00 00 00       	mov    $0x0,%eax
+  806db4:	e9 82 00 00 00       	jmp    806e3b <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  806db9:	49 89 df             	mov    %rbx,%r15
+  806dbc:	48 b8 b1 88 ff ff ff 	movabs $0xffffffffffff88b1,%rax
+  806dc3:	ff ff ff 
+  806dc6:	48 01 d8             	add    %rbx,%rax
+  806dc9:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  806dcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806dcf:	8b 40 04             	mov    0x4(%rax),%eax
+  806dd2:	48 63 d0             	movslq %eax,%rdx
+  806dd5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806dd9:	8b 00                	mov    (%rax),%eax
+  806ddb:	48 98                	cltq
+  806ddd:	48 83 c0 20          	add    $0x20,%rax
+  806de1:	48 39 c2             	cmp    %rax,%rdx
+  806de4:	73 a7                	jae    806d8d <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806de6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806dee:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806df2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806df6:	8b 50 04             	mov    0x4(%rax),%edx
+  806df9:	89 d0                	mov    %edx,%eax
+  806dfb:	c1 f8 1f             	sar    $0x1f,%eax
+  806dfe:	c1 e8 1b             	shr    $0x1b,%eax
+  806e01:	01 c2                	add    %eax,%edx
+  806e03:	83 e2 1f             	and    $0x1f,%edx
+  806e06:	29 c2                	sub    %eax,%edx
+  806e08:	89 d0                	mov    %edx,%eax
+  806e0a:	0f b6 09             	movzbl (%rcx),%ecx
+  806e0d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806e11:	48 98                	cltq
+  806e13:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806e17:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806e1b:	8b 40 04             	mov    0x4(%rax),%eax
+  806e1e:	8d 50 01             	lea    0x1(%rax),%edx
+  806e21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806e25:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806e28:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806e2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806e31:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806e35:	72 94                	jb     806dcb <devpipe_write+0x9b>
+	}
+
+	return i;
+  806e37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806e3b:	48 83 c4 40          	add    $0x40,%rsp
+  806e3f:	5b                   	pop    %rbx
+  806e40:	41 5f                	pop    %r15
+  806e42:	5d                   	pop    %rbp
+  806e43:	c3                   	ret
+
+0000000000806e44 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806e44:	55                   	push   %rbp
+  806e45:	48 89 e5             	mov    %rsp,%rbp
+  806e48:	41 57                	push   %r15
+  806e4a:	53                   	push   %rbx
+  806e4b:	48 83 ec 20          	sub    $0x20,%rsp
+  806e4f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806e4f <devpipe_stat+0xb>
+  806e56:	49 bb f9 31 00 00 00 	movabs $0x31f9,%r11
+  806e5d:	00 00 00 
+  806e60:	4c 01 db             	add    %r11,%rbx
+  806e63:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806e67:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  806e6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806e6f:	48 89 c7             	mov    %rax,%rdi
+  806e72:	49 89 df             	mov    %rbx,%r15
+  806e75:	48 b8 3e a4 ff ff ff 	movabs $0xffffffffffffa43e,%rax
+  806e7c:	ff ff ff 
+  806e7f:	48 01 d8             	add    %rbx,%rax
+  806e82:	ff d0                	call   *%rax
+  806e84:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  806e88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806e8c:	48 ba 89 e2 ff ff ff 	movabs $0xffffffffffffe289,%rdx
+  806e93:	ff ff ff 
+  806e96:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806e9a:	48 89 d6             	mov    %rdx,%rsi
+  806e9d:	48 89 c7             	mov    %rax,%rdi
+  806ea0:	49 89 df             	mov    %rbx,%r15
+  806ea3:	48 b8 4a 7c ff ff ff 	movabs $0xffffffffffff7c4a,%rax
+  806eaa:	ff ff ff 
+  806ead:	48 01 d8             	add    %rbx,%rax
+  806eb0:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  806eb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806eb6:	8b 50 04             	mov    0x4(%rax),%edx
+  806eb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806ebd:	8b 00                	mov    (%rax),%eax
+  806ebf:	29 c2                	sub    %eax,%edx
+  806ec1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806ec5:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  806ecb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806ecf:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806ed6:	00 00 00 
+	stat->st_dev = &devpipe;
+  806ed9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806edd:	48 ba b8 00 00 00 00 	movabs $0xb8,%rdx
+  806ee4:	00 00 00 
+  806ee7:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806eeb:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806ef7:	48 83 c4 20          	add    $0x20,%rsp
+  806efb:	5b                   	pop    %rbx
+  806efc:	41 5f                	pop    %r15
+  806efe:	5d                   	pop    %rbp
+  806eff:	c3                   	ret
+
+0000000000806f00 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806f00:	55                   	push   %rbp
+  806f01:	48 89 e5             	mov    %rsp,%rbp
+  806f04:	41 57                	push   %r15
+  806f06:	53                   	push   %rbx
+  806f07:	48 83 ec 10          	sub    $0x10,%rsp
+  806f0b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806f0b <devpipe_close+0xb>
+  806f12:	49 bb 3d 31 00 00 00 	movabs $0x313d,%r11
+  806f19:	00 00 00 
+  806f1c:	4c 01 db             	add    %r11,%rbx
+  806f1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806f23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806f27:	48 89 c6             	mov    %rax,%rsi
+  806f2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  806f2f:	49 89 df             	mov    %rbx,%r15
+  806f32:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  806f39:	ff ff ff 
+  806f3c:	48 01 d8             	add    %rbx,%rax
+  806f3f:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  806f41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806f45:	48 89 c7             	mov    %rax,%rdi
+  806f48:	49 89 df             	mov    %rbx,%r15
+  806f4b:	48 b8 3e a4 ff ff ff 	movabs $0xffffffffffffa43e,%rax
+  806f52:	ff ff ff 
+  806f55:	48 01 d8             	add    %rbx,%rax
+  806f58:	ff d0                	call   *%rax
+  806f5a:	48 89 c6             	mov    %rax,%rsi
+  806f5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806f62:	49 89 df             	mov    %rbx,%r15
+  806f65:	48 b8 de 89 ff ff ff 	movabs $0xffffffffffff89de,%rax
+  806f6c:	ff ff ff 
+  806f6f:	48 01 d8             	add    %rbx,%rax
+  806f72:	ff d0                	call   *%rax
+}
+  806f74:	48 83 c4 10          	add    $0x10,%rsp
+  806f78:	5b                   	pop    %rbx
+  806f79:	41 5f                	pop    %r15
+  806f7b:	5d                   	pop    %rbp
+  806f7c:	c3                   	ret
+
+0000000000806f7d <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  806f7d:	55                   	push   %rbp
+  806f7e:	48 89 e5             	mov    %rsp,%rbp
+  806f81:	41 57                	push   %r15
+  806f83:	48 83 ec 28          	sub    $0x28,%rsp
+  806f87:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806f87 <cputchar+0xa>
+  806f8e:	49 bb c1 30 00 00 00 	movabs $0x30c1,%r11
+  806f95:	00 00 00 
+  806f98:	4c 01 d8             	add    %r11,%rax
+  806f9b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806f9e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806fa1:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806fa4:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806fa8:	be 01 00 00 00       	mov    $0x1,%esi
+  806fad:	48 89 d7             	mov    %rdx,%rdi
+  806fb0:	49 89 c7             	mov    %rax,%r15
+  806fb3:	48 ba 4e 87 ff ff ff 	movabs $0xffffffffffff874e,%rdx
+  806fba:	ff ff ff 
+  806fbd:	48 01 c2             	add    %rax,%rdx
+  806fc0:	ff d2                	call   *%rdx
+}
+  806fc2:	90                   	nop
+  806fc3:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806fc7:	c9                   	leave
+  806fc8:	c3                   	ret
+
+0000000000806fc9 <getchar>:
+
+int
+getchar(void)
+{
+  806fc9:	55                   	push   %rbp
+  806fca:	48 89 e5             	mov    %rsp,%rbp
+  806fcd:	41 57                	push   %r15
+  806fcf:	48 83 ec 18          	sub    $0x18,%rsp
+  806fd3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806fd3 <getchar+0xa>
+  806fda:	49 bb 75 30 00 00 00 	movabs $0x3075,%r11
+  806fe1:	00 00 00 
+  806fe4:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806fe7:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806feb:	ba 01 00 00 00       	mov    $0x1,%edx
+  806ff0:	48 89 ce             	mov    %rcx,%rsi
+  806ff3:	bf 00 00 00 00       	mov    $0x0,%edi
+  806ff8:	49 89 c7             	mov    %rax,%r15
+  806ffb:	48 b9 7e aa ff ff ff 	movabs $0xffffffffffffaa7e,%rcx
+  807002:	ff ff ff 
+  807005:	48 01 c1             	add    %rax,%rcx
+  807008:	ff d1                	call   *%rcx
+  80700a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80700d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807011:	79 05                	jns    807018 <getchar+0x4f>
+		return r;
+  807013:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807016:	eb 14                	jmp    80702c <getchar+0x63>
+	if (r < 1)
+  807018:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80701c:	7f 07                	jg     807025 <getchar+0x5c>
+		return -E_EOF;
+  80701e:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  807023:	eb 07                	jmp    80702c <getchar+0x63>
+	return c;
+  807025:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  807029:	0f b6 c0             	movzbl %al,%eax
+}
+  80702c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  807030:	c9                   	leave
+  807031:	c3                   	ret
+
+0000000000807032 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  807032:	55                   	push   %rbp
+  807033:	48 89 e5             	mov    %rsp,%rbp
+  807036:	41 57                	push   %r15
+  807038:	53                   	push   %rbx
+  807039:	48 83 ec 20          	sub    $0x20,%rsp
+  80703d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80703d <iscons+0xb>
+  807044:	49 bb 0b 30 00 00 00 	movabs $0x300b,%r11
+  80704b:	00 00 00 
+  80704e:	4c 01 db             	add    %r11,%rbx
+  807051:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  807054:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  807058:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80705b:	48 89 d6             	mov    %rdx,%rsi
+  80705e:	89 c7                	mov    %eax,%edi
+  807060:	49 89 df             	mov    %rbx,%r15
+  807063:	48 b8 37 a5 ff ff ff 	movabs $0xffffffffffffa537,%rax
+  80706a:	ff ff ff 
+  80706d:	48 01 d8             	add    %rbx,%rax
+  807070:	ff d0                	call   *%rax
+  807072:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807075:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807079:	79 05                	jns    807080 <iscons+0x4e>
+		return r;
+  80707b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80707e:	eb 1b                	jmp    80709b <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  807080:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807084:	8b 10                	mov    (%rax),%edx
+  807086:	48 b8 f8 00 00 00 00 	movabs $0xf8,%rax
+  80708d:	00 00 00 
+  807090:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807093:	39 c2                	cmp    %eax,%edx
+  807095:	0f 94 c0             	sete   %al
+  807098:	0f b6 c0             	movzbl %al,%eax
+}
+  80709b:	48 83 c4 20          	add    $0x20,%rsp
+  80709f:	5b                   	pop    %rbx
+  8070a0:	41 5f                	pop    %r15
+  8070a2:	5d                   	pop    %rbp
+  8070a3:	c3                   	ret
+
+00000000008070a4 <opencons>:
+
+int
+opencons(void)
+{
+  8070a4:	55                   	push   %rbp
+  8070a5:	48 89 e5             	mov    %rsp,%rbp
+  8070a8:	41 57                	push   %r15
+  8070aa:	53                   	push   %rbx
+  8070ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8070af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8070af <opencons+0xb>
+  8070b6:	49 bb 99 2f 00 00 00 	movabs $0x2f99,%r11
+  8070bd:	00 00 00 
+  8070c0:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8070c3:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8070c7:	48 89 c7             	mov    %rax,%rdi
+  8070ca:	49 89 df             	mov    %rbx,%r15
+  8070cd:	48 b8 81 a4 ff ff ff 	movabs $0xffffffffffffa481,%rax
+  8070d4:	ff ff ff 
+  8070d7:	48 01 d8             	add    %rbx,%rax
+  8070da:	ff d0                	call   *%rax
+  8070dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8070df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8070e3:	79 05                	jns    8070ea <opencons+0x46>
+		return r;
+  8070e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8070e8:	eb 68                	jmp    807152 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8070ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8070ee:	ba 07 04 00 00       	mov    $0x407,%edx
+  8070f3:	48 89 c6             	mov    %rax,%rsi
+  8070f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8070fb:	49 89 df             	mov    %rbx,%r15
+  8070fe:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  807105:	ff ff ff 
+  807108:	48 01 d8             	add    %rbx,%rax
+  80710b:	ff d0                	call   *%rax
+  80710d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807110:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807114:	79 05                	jns    80711b <opencons+0x77>
+		return r;
+  807116:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807119:	eb 37                	jmp    807152 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80711b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80711f:	48 ba f8 00 00 00 00 	movabs $0xf8,%rdx
+  807126:	00 00 00 
+  807129:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80712c:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80712e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807132:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  807139:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80713d:	48 89 c7             	mov    %rax,%rdi
+  807140:	49 89 df             	mov    %rbx,%r15
+  807143:	48 b8 07 a4 ff ff ff 	movabs $0xffffffffffffa407,%rax
+  80714a:	ff ff ff 
+  80714d:	48 01 d8             	add    %rbx,%rax
+  807150:	ff d0                	call   *%rax
+}
+  807152:	48 83 c4 10          	add    $0x10,%rsp
+  807156:	5b                   	pop    %rbx
+  807157:	41 5f                	pop    %r15
+  807159:	5d                   	pop    %rbp
+  80715a:	c3                   	ret
+
+000000000080715b <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80715b:	55                   	push   %rbp
+  80715c:	48 89 e5             	mov    %rsp,%rbp
+  80715f:	41 57                	push   %r15
+  807161:	53                   	push   %rbx
+  807162:	48 83 ec 30          	sub    $0x30,%rsp
+  807166:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807166 <devcons_read+0xb>
+  80716d:	49 bb e2 2e 00 00 00 	movabs $0x2ee2,%r11
+  807174:	00 00 00 
+  807177:	4c 01 db             	add    %r11,%rbx
+  80717a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80717e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  807182:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  807186:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80718b:	75 19                	jne    8071a6 <devcons_read+0x4b>
+		return 0;
+  80718d:	b8 00 00 00 00       	mov    $0x0,%eax
+  807192:	eb 55                	jmp    8071e9 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  807194:	49 89 df             	mov    %rbx,%r15
+  807197:	48 b8 b1 88 ff ff ff 	movabs $0xffffffffffff88b1,%rax
+  80719e:	ff ff ff 
+  8071a1:	48 01 d8             	add    %rbx,%rax
+  8071a4:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8071a6:	49 89 df             	mov    %rbx,%r15
+  8071a9:	48 b8 ad 87 ff ff ff 	movabs $0xffffffffffff87ad,%rax
+  8071b0:	ff ff ff 
+  8071b3:	48 01 d8             	add    %rbx,%rax
+  8071b6:	ff d0                	call   *%rax
+  8071b8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8071bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8071bf:	74 d3                	je     807194 <devcons_read+0x39>
+	if (c < 0)
+  8071c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8071c5:	79 05                	jns    8071cc <devcons_read+0x71>
+		return c;
+  8071c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8071ca:	eb 1d                	jmp    8071e9 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8071cc:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8071d0:	75 07                	jne    8071d9 <devcons_read+0x7e>
+		return 0;
+  8071d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8071d7:	eb 10                	jmp    8071e9 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8071d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8071dc:	89 c2                	mov    %eax,%edx
+  8071de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8071e2:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8071e4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8071e9:	48 83 c4 30          	add    $0x30,%rsp
+  8071ed:	5b                   	pop    %rbx
+  8071ee:	41 5f                	pop    %r15
+  8071f0:	5d                   	pop    %rbp
+  8071f1:	c3                   	ret
+
+00000000008071f2 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8071f2:	55                   	push   %rbp
+  8071f3:	48 89 e5             	mov    %rsp,%rbp
+  8071f6:	41 57                	push   %r15
+  8071f8:	53                   	push   %rbx
+  8071f9:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  807200:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807200 <devcons_write+0xe>
+  807207:	49 bb 48 2e 00 00 00 	movabs $0x2e48,%r11
+  80720e:	00 00 00 
+  807211:	4c 01 db             	add    %r11,%rbx
+  807214:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80721b:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  807222:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  807229:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  807230:	e9 80 00 00 00       	jmp    8072b5 <devcons_write+0xc3>
+		m = n - tot;
+  807235:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80723c:	89 c2                	mov    %eax,%edx
+  80723e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807241:	29 c2                	sub    %eax,%edx
+  807243:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  807246:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  807249:	83 f8 7f             	cmp    $0x7f,%eax
+  80724c:	76 07                	jbe    807255 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  80724e:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  807255:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  807258:	48 63 d0             	movslq %eax,%rdx
+  80725b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80725e:	48 63 c8             	movslq %eax,%rcx
+  807261:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  807268:	48 01 c1             	add    %rax,%rcx
+  80726b:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  807272:	48 89 ce             	mov    %rcx,%rsi
+  807275:	48 89 c7             	mov    %rax,%rdi
+  807278:	49 89 df             	mov    %rbx,%r15
+  80727b:	48 b8 2a 80 ff ff ff 	movabs $0xffffffffffff802a,%rax
+  807282:	ff ff ff 
+  807285:	48 01 d8             	add    %rbx,%rax
+  807288:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  80728a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80728d:	48 63 d0             	movslq %eax,%rdx
+  807290:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  807297:	48 89 d6             	mov    %rdx,%rsi
+  80729a:	48 89 c7             	mov    %rax,%rdi
+  80729d:	49 89 df             	mov    %rbx,%r15
+  8072a0:	48 b8 4e 87 ff ff ff 	movabs $0xffffffffffff874e,%rax
+  8072a7:	ff ff ff 
+  8072aa:	48 01 d8             	add    %rbx,%rax
+  8072ad:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8072af:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8072b2:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8072b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8072b8:	48 98                	cltq
+  8072ba:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8072c1:	0f 82 6e ff ff ff    	jb     807235 <devcons_write+0x43>
+	}
+	return tot;
+  8072c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8072ca:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8072d1:	5b                   	pop    %rbx
+  8072d2:	41 5f                	pop    %r15
+  8072d4:	5d                   	pop    %rbp
+  8072d5:	c3                   	ret
+
+00000000008072d6 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8072d6:	55                   	push   %rbp
+  8072d7:	48 89 e5             	mov    %rsp,%rbp
+  8072da:	48 83 ec 08          	sub    $0x8,%rsp
+  8072de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8072de <devcons_close+0x8>
+  8072e5:	49 bb 6a 2d 00 00 00 	movabs $0x2d6a,%r11
+  8072ec:	00 00 00 
+  8072ef:	4c 01 d8             	add    %r11,%rax
+  8072f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8072f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8072fb:	c9                   	leave
+  8072fc:	c3                   	ret
+
+00000000008072fd <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8072fd:	55                   	push   %rbp
+  8072fe:	48 89 e5             	mov    %rsp,%rbp
+  807301:	41 57                	push   %r15
+  807303:	48 83 ec 18          	sub    $0x18,%rsp
+  807307:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807307 <devcons_stat+0xa>
+  80730e:	49 bb 41 2d 00 00 00 	movabs $0x2d41,%r11
+  807315:	00 00 00 
+  807318:	4c 01 d8             	add    %r11,%rax
+  80731b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80731f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  807323:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807327:	48 b9 95 e2 ff ff ff 	movabs $0xffffffffffffe295,%rcx
+  80732e:	ff ff ff 
+  807331:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  807335:	48 89 ce             	mov    %rcx,%rsi
+  807338:	48 89 d7             	mov    %rdx,%rdi
+  80733b:	49 89 c7             	mov    %rax,%r15
+  80733e:	48 ba 4a 7c ff ff ff 	movabs $0xffffffffffff7c4a,%rdx
+  807345:	ff ff ff 
+  807348:	48 01 c2             	add    %rax,%rdx
+  80734b:	ff d2                	call   *%rdx
+	return 0;
+  80734d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807352:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  807356:	c9                   	leave
+  807357:	c3                   	ret
+
+0000000000807358 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  807358:	55                   	push   %rbp
+  807359:	48 89 e5             	mov    %rsp,%rbp
+  80735c:	41 57                	push   %r15
+  80735e:	53                   	push   %rbx
+  80735f:	48 83 ec 20          	sub    $0x20,%rsp
+  807363:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807363 <set_pgfault_handler+0xb>
+  80736a:	49 bb e5 2c 00 00 00 	movabs $0x2ce5,%r11
+  807371:	00 00 00 
+  807374:	4c 01 db             	add    %r11,%rbx
+  807377:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  80737b:	49 89 df             	mov    %rbx,%r15
+  80737e:	48 b8 5d 88 ff ff ff 	movabs $0xffffffffffff885d,%rax
+  807385:	ff ff ff 
+  807388:	48 01 d8             	add    %rbx,%rax
+  80738b:	ff d0                	call   *%rax
+  80738d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  807390:	48 b8 b8 5f 01 00 00 	movabs $0x15fb8,%rax
+  807397:	00 00 00 
+  80739a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80739e:	48 85 c0             	test   %rax,%rax
+  8073a1:	75 6b                	jne    80740e <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  8073a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8073a6:	ba 07 00 00 00       	mov    $0x7,%edx
+  8073ab:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8073b0:	48 89 ce             	mov    %rcx,%rsi
+  8073b3:	89 c7                	mov    %eax,%edi
+  8073b5:	49 89 df             	mov    %rbx,%r15
+  8073b8:	48 b8 06 89 ff ff ff 	movabs $0xffffffffffff8906,%rax
+  8073bf:	ff ff ff 
+  8073c2:	48 01 d8             	add    %rbx,%rax
+  8073c5:	ff d0                	call   *%rax
+  8073c7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  8073ca:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8073ce:	74 3e                	je     80740e <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  8073d0:	48 b8 a0 e2 ff ff ff 	movabs $0xffffffffffffe2a0,%rax
+  8073d7:	ff ff ff 
+  8073da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8073de:	48 89 c2             	mov    %rax,%rdx
+  8073e1:	be 23 00 00 00       	mov    $0x23,%esi
+  8073e6:	48 b8 ce e2 ff ff ff 	movabs $0xffffffffffffe2ce,%rax
+  8073ed:	ff ff ff 
+  8073f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8073f4:	48 89 c7             	mov    %rax,%rdi
+  8073f7:	49 89 df             	mov    %rbx,%r15
+  8073fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8073ff:	48 b9 b1 6b ff ff ff 	movabs $0xffffffffffff6bb1,%rcx
+  807406:	ff ff ff 
+  807409:	48 01 d9             	add    %rbx,%rcx
+  80740c:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80740e:	48 ba b8 5f 01 00 00 	movabs $0x15fb8,%rdx
+  807415:	00 00 00 
+  807418:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80741c:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  807420:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807423:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  80742a:	ff ff ff 
+  80742d:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  807431:	48 89 d6             	mov    %rdx,%rsi
+  807434:	89 c7                	mov    %eax,%edi
+  807436:	49 89 df             	mov    %rbx,%r15
+  807439:	48 b8 fc 8a ff ff ff 	movabs $0xffffffffffff8afc,%rax
+  807440:	ff ff ff 
+  807443:	48 01 d8             	add    %rbx,%rax
+  807446:	ff d0                	call   *%rax
+}
+  807448:	90                   	nop
+  807449:	48 83 c4 20          	add    $0x20,%rsp
+  80744d:	5b                   	pop    %rbx
+  80744e:	41 5f                	pop    %r15
+  807450:	5d                   	pop    %rbp
+  807451:	c3                   	ret
+
+0000000000807452 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  807452:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  807455:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80745c:	00 00 00 
+call *%rax
+  80745f:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  807461:	58                   	pop    %rax
+	popq %rax;
+  807462:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  807463:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  80746a:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  80746e:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  807472:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  807476:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  80747a:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  80747e:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  807481:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  807485:	4c 8b 3c 24          	mov    (%rsp),%r15
+  807489:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80748e:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  807493:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  807498:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80749d:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8074a2:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8074a7:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8074ac:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8074b1:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8074b6:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8074bb:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8074c0:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8074c5:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8074ca:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8074cf:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  8074d3:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  8074d7:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  8074d8:	5c                   	pop    %rsp
+	ret;			//return
+  8074d9:	c3                   	ret
+
+00000000008074da <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8074da:	55                   	push   %rbp
+  8074db:	48 89 e5             	mov    %rsp,%rbp
+  8074de:	48 83 ec 18          	sub    $0x18,%rsp
+  8074e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8074e2 <pageref+0x8>
+  8074e9:	49 bb 66 2b 00 00 00 	movabs $0x2b66,%r11
+  8074f0:	00 00 00 
+  8074f3:	4c 01 d8             	add    %r11,%rax
+  8074f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  8074fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8074fe:	48 89 d1             	mov    %rdx,%rcx
+  807501:	48 c1 e9 15          	shr    $0x15,%rcx
+  807505:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80750c:	ff ff ff 
+  80750f:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807513:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807517:	83 e2 01             	and    $0x1,%edx
+  80751a:	48 85 d2             	test   %rdx,%rdx
+  80751d:	75 07                	jne    807526 <pageref+0x4c>
+		return 0;
+  80751f:	b8 00 00 00 00       	mov    $0x0,%eax
+  807524:	eb 64                	jmp    80758a <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  807526:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80752a:	48 89 d1             	mov    %rdx,%rcx
+  80752d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  807531:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  807538:	ff ff ff 
+  80753b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80753f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807543:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  807547:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80754b:	83 e2 01             	and    $0x1,%edx
+  80754e:	48 85 d2             	test   %rdx,%rdx
+  807551:	75 07                	jne    80755a <pageref+0x80>
+		return 0;
+  807553:	b8 00 00 00 00       	mov    $0x0,%eax
+  807558:	eb 30                	jmp    80758a <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  80755a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80755e:	48 c1 ea 0c          	shr    $0xc,%rdx
+  807562:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  807569:	ff ff ff 
+  80756c:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  807570:	48 89 d0             	mov    %rdx,%rax
+  807573:	48 01 c0             	add    %rax,%rax
+  807576:	48 01 d0             	add    %rdx,%rax
+  807579:	48 c1 e0 03          	shl    $0x3,%rax
+  80757d:	48 01 c8             	add    %rcx,%rax
+  807580:	48 83 c0 08          	add    $0x8,%rax
+  807584:	0f b7 00             	movzwl (%rax),%eax
+  807587:	0f b7 c0             	movzwl %ax,%eax
+}
+  80758a:	c9                   	leave
+  80758b:	c3                   	ret
+
+000000000080758c <inet_addr>:
+ * @param cp IP address in ascii represenation (e.g. "127.0.0.1")
+ * @return ip address in network order
+ */
+u32_t
+inet_addr(const char *cp)
+{
+  80758c:	55                   	push   %rbp
+  80758d:	48 89 e5             	mov    %rsp,%rbp
+  807590:	48 83 ec 20          	sub    $0x20,%rsp
+  807594:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807594 <inet_addr+0x8>
+  80759b:	49 bb b4 2a 00 00 00 	movabs $0x2ab4,%r11
+  8075a2:	00 00 00 
+  8075a5:	4c 01 d8             	add    %r11,%rax
+  8075a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct in_addr val;
+
+  if (inet_aton(cp, &val)) {
+  8075ac:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8075b0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8075b4:	48 89 ce             	mov    %rcx,%rsi
+  8075b7:	48 89 d7             	mov    %rdx,%rdi
+  8075ba:	48 ba 92 d5 ff ff ff 	movabs $0xffffffffffffd592,%rdx
+  8075c1:	ff ff ff 
+  8075c4:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8075c8:	ff d0                	call   *%rax
+  8075ca:	85 c0                	test   %eax,%eax
+  8075cc:	74 05                	je     8075d3 <inet_addr+0x47>
+    return (val.s_addr);
+  8075ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8075d1:	eb 05                	jmp    8075d8 <inet_addr+0x4c>
+  }
+  return (INADDR_NONE);
+  8075d3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  8075d8:	c9                   	leave
+  8075d9:	c3                   	ret
+
+00000000008075da <inet_aton>:
+ * @param addr pointer to which to save the ip address in network order
+ * @return 1 if cp could be converted to addr, 0 on failure
+ */
+int
+inet_aton(const char *cp, struct in_addr *addr)
+{
+  8075da:	55                   	push   %rbp
+  8075db:	48 89 e5             	mov    %rsp,%rbp
+  8075de:	48 83 ec 40          	sub    $0x40,%rsp
+  8075e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8075e2 <inet_aton+0x8>
+  8075e9:	49 bb 66 2a 00 00 00 	movabs $0x2a66,%r11
+  8075f0:	00 00 00 
+  8075f3:	4c 01 d8             	add    %r11,%rax
+  8075f6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8075fa:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  u32_t val;
+  int base, n, c;
+  u32_t parts[4];
+  u32_t *pp = parts;
+  8075fe:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  807602:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+
+  c = *cp;
+  807606:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80760a:	0f b6 12             	movzbl (%rdx),%edx
+  80760d:	0f be d2             	movsbl %dl,%edx
+  807610:	89 55 f4             	mov    %edx,-0xc(%rbp)
+    /*
+     * Collect number up to ``.''.
+     * Values are specified as for C:
+     * 0x=hex, 0=octal, 1-9=decimal.
+     */
+    if (!isdigit(c))
+  807613:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807616:	80 fa 2f             	cmp    $0x2f,%dl
+  807619:	76 08                	jbe    807623 <inet_aton+0x49>
+  80761b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80761e:	80 fa 39             	cmp    $0x39,%dl
+  807621:	76 0a                	jbe    80762d <inet_aton+0x53>
+      return (0);
+  807623:	b8 00 00 00 00       	mov    $0x0,%eax
+  807628:	e9 7c 02 00 00       	jmp    8078a9 <inet_aton+0x2cf>
+    val = 0;
+  80762d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    base = 10;
+  807634:	c7 45 f8 0a 00 00 00 	movl   $0xa,-0x8(%rbp)
+    if (c == '0') {
+  80763b:	83 7d f4 30          	cmpl   $0x30,-0xc(%rbp)
+  80763f:	75 40                	jne    807681 <inet_aton+0xa7>
+      c = *++cp;
+  807641:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  807646:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80764a:	0f b6 12             	movzbl (%rdx),%edx
+  80764d:	0f be d2             	movsbl %dl,%edx
+  807650:	89 55 f4             	mov    %edx,-0xc(%rbp)
+      if (c == 'x' || c == 'X') {
+  807653:	83 7d f4 78          	cmpl   $0x78,-0xc(%rbp)
+  807657:	74 06                	je     80765f <inet_aton+0x85>
+  807659:	83 7d f4 58          	cmpl   $0x58,-0xc(%rbp)
+  80765d:	75 1b                	jne    80767a <inet_aton+0xa0>
+        base = 16;
+  80765f:	c7 45 f8 10 00 00 00 	movl   $0x10,-0x8(%rbp)
+        c = *++cp;
+  807666:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  80766b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80766f:	0f b6 12             	movzbl (%rdx),%edx
+  807672:	0f be d2             	movsbl %dl,%edx
+  807675:	89 55 f4             	mov    %edx,-0xc(%rbp)
+  807678:	eb 07                	jmp    807681 <inet_aton+0xa7>
+      } else
+        base = 8;
+  80767a:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+    }
+    for (;;) {
+      if (isdigit(c)) {
+  807681:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807684:	80 fa 2f             	cmp    $0x2f,%dl
+  807687:	76 30                	jbe    8076b9 <inet_aton+0xdf>
+  807689:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80768c:	80 fa 39             	cmp    $0x39,%dl
+  80768f:	77 28                	ja     8076b9 <inet_aton+0xdf>
+        val = (val * base) + (int)(c - '0');
+  807691:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  807694:	89 d1                	mov    %edx,%ecx
+  807696:	0f af 4d fc          	imul   -0x4(%rbp),%ecx
+  80769a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80769d:	01 ca                	add    %ecx,%edx
+  80769f:	83 ea 30             	sub    $0x30,%edx
+  8076a2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        c = *++cp;
+  8076a5:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8076aa:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8076ae:	0f b6 12             	movzbl (%rdx),%edx
+  8076b1:	0f be d2             	movsbl %dl,%edx
+  8076b4:	89 55 f4             	mov    %edx,-0xc(%rbp)
+  8076b7:	eb 7b                	jmp    807734 <inet_aton+0x15a>
+      } else if (base == 16 && isxdigit(c)) {
+  8076b9:	83 7d f8 10          	cmpl   $0x10,-0x8(%rbp)
+  8076bd:	75 7a                	jne    807739 <inet_aton+0x15f>
+  8076bf:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8076c2:	80 fa 2f             	cmp    $0x2f,%dl
+  8076c5:	76 08                	jbe    8076cf <inet_aton+0xf5>
+  8076c7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8076ca:	80 fa 39             	cmp    $0x39,%dl
+  8076cd:	76 20                	jbe    8076ef <inet_aton+0x115>
+  8076cf:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8076d2:	80 fa 60             	cmp    $0x60,%dl
+  8076d5:	76 08                	jbe    8076df <inet_aton+0x105>
+  8076d7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8076da:	80 fa 66             	cmp    $0x66,%dl
+  8076dd:	76 10                	jbe    8076ef <inet_aton+0x115>
+  8076df:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8076e2:	80 fa 40             	cmp    $0x40,%dl
+  8076e5:	76 52                	jbe    807739 <inet_aton+0x15f>
+  8076e7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8076ea:	80 fa 46             	cmp    $0x46,%dl
+  8076ed:	77 4a                	ja     807739 <inet_aton+0x15f>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  8076ef:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8076f2:	89 d1                	mov    %edx,%ecx
+  8076f4:	c1 e1 04             	shl    $0x4,%ecx
+  8076f7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8076fa:	83 c2 0a             	add    $0xa,%edx
+  8076fd:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  807700:	40 80 fe 60          	cmp    $0x60,%sil
+  807704:	76 10                	jbe    807716 <inet_aton+0x13c>
+  807706:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  807709:	40 80 fe 7a          	cmp    $0x7a,%sil
+  80770d:	77 07                	ja     807716 <inet_aton+0x13c>
+  80770f:	be 61 00 00 00       	mov    $0x61,%esi
+  807714:	eb 05                	jmp    80771b <inet_aton+0x141>
+  807716:	be 41 00 00 00       	mov    $0x41,%esi
+  80771b:	29 f2                	sub    %esi,%edx
+  80771d:	09 ca                	or     %ecx,%edx
+  80771f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        c = *++cp;
+  807722:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  807727:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80772b:	0f b6 12             	movzbl (%rdx),%edx
+  80772e:	0f be d2             	movsbl %dl,%edx
+  807731:	89 55 f4             	mov    %edx,-0xc(%rbp)
+      if (isdigit(c)) {
+  807734:	e9 48 ff ff ff       	jmp    807681 <inet_aton+0xa7>
+      } else
+        break;
+    }
+    if (c == '.') {
+  807739:	83 7d f4 2e          	cmpl   $0x2e,-0xc(%rbp)
+  80773d:	75 40                	jne    80777f <inet_aton+0x1a5>
+       * Internet format:
+       *  a.b.c.d
+       *  a.b.c   (with c treated as 16 bits)
+       *  a.b (with b treated as 24 bits)
+       */
+      if (pp >= parts + 3)
+  80773f:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  807743:	48 83 c2 0c          	add    $0xc,%rdx
+  807747:	48 39 55 e8          	cmp    %rdx,-0x18(%rbp)
+  80774b:	72 0a                	jb     807757 <inet_aton+0x17d>
+        return (0);
+  80774d:	b8 00 00 00 00       	mov    $0x0,%eax
+  807752:	e9 52 01 00 00       	jmp    8078a9 <inet_aton+0x2cf>
+      *pp++ = val;
+  807757:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80775b:	48 8d 4a 04          	lea    0x4(%rdx),%rcx
+  80775f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  807763:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  807766:	89 0a                	mov    %ecx,(%rdx)
+      c = *++cp;
+  807768:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  80776d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  807771:	0f b6 12             	movzbl (%rdx),%edx
+  807774:	0f be d2             	movsbl %dl,%edx
+  807777:	89 55 f4             	mov    %edx,-0xc(%rbp)
+    if (!isdigit(c))
+  80777a:	e9 94 fe ff ff       	jmp    807613 <inet_aton+0x39>
+    } else
+      break;
+  80777f:	90                   	nop
+  }
+  /*
+   * Check for trailing characters.
+   */
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  807780:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  807784:	74 3d                	je     8077c3 <inet_aton+0x1e9>
+  807786:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807789:	80 fa 1f             	cmp    $0x1f,%dl
+  80778c:	76 2b                	jbe    8077b9 <inet_aton+0x1df>
+  80778e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807791:	84 d2                	test   %dl,%dl
+  807793:	78 24                	js     8077b9 <inet_aton+0x1df>
+  807795:	83 7d f4 20          	cmpl   $0x20,-0xc(%rbp)
+  807799:	74 28                	je     8077c3 <inet_aton+0x1e9>
+  80779b:	83 7d f4 0c          	cmpl   $0xc,-0xc(%rbp)
+  80779f:	74 22                	je     8077c3 <inet_aton+0x1e9>
+  8077a1:	83 7d f4 0a          	cmpl   $0xa,-0xc(%rbp)
+  8077a5:	74 1c                	je     8077c3 <inet_aton+0x1e9>
+  8077a7:	83 7d f4 0d          	cmpl   $0xd,-0xc(%rbp)
+  8077ab:	74 16                	je     8077c3 <inet_aton+0x1e9>
+  8077ad:	83 7d f4 09          	cmpl   $0x9,-0xc(%rbp)
+  8077b1:	74 10                	je     8077c3 <inet_aton+0x1e9>
+  8077b3:	83 7d f4 0b          	cmpl   $0xb,-0xc(%rbp)
+  8077b7:	74 0a                	je     8077c3 <inet_aton+0x1e9>
+    return (0);
+  8077b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8077be:	e9 e6 00 00 00       	jmp    8078a9 <inet_aton+0x2cf>
+  /*
+   * Concoct the address according to
+   * the number of parts specified.
+   */
+  n = pp - parts + 1;
+  8077c3:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8077c7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8077cb:	48 29 d1             	sub    %rdx,%rcx
+  8077ce:	48 c1 f9 02          	sar    $0x2,%rcx
+  8077d2:	48 89 ca             	mov    %rcx,%rdx
+  8077d5:	83 c2 01             	add    $0x1,%edx
+  8077d8:	89 55 e4             	mov    %edx,-0x1c(%rbp)
+  switch (n) {
+  8077db:	83 7d e4 04          	cmpl   $0x4,-0x1c(%rbp)
+  8077df:	0f 87 9d 00 00 00    	ja     807882 <inet_aton+0x2a8>
+  8077e5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8077e8:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+  8077ef:	00 
+  8077f0:	48 8d 15 31 0b 00 00 	lea    0xb31(%rip),%rdx        # 808328 <.LC1+0x12>
+  8077f7:	48 8b 14 11          	mov    (%rcx,%rdx,1),%rdx
+  8077fb:	48 8d 0d 26 0b 00 00 	lea    0xb26(%rip),%rcx        # 808328 <.LC1+0x12>
+  807802:	48 01 ca             	add    %rcx,%rdx
+  807805:	ff e2                	jmp    *%rdx
+
+  case 0:
+    return (0);       /* initial nondigit */
+  807807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80780c:	e9 98 00 00 00       	jmp    8078a9 <inet_aton+0x2cf>
+
+  case 1:             /* a -- 32 bits */
+    break;
+
+  case 2:             /* a.b -- 8.24 bits */
+    if (val > 0xffffffUL)
+  807811:	81 7d fc ff ff ff 00 	cmpl   $0xffffff,-0x4(%rbp)
+  807818:	76 0a                	jbe    807824 <inet_aton+0x24a>
+      return (0);
+  80781a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80781f:	e9 85 00 00 00       	jmp    8078a9 <inet_aton+0x2cf>
+    val |= parts[0] << 24;
+  807824:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  807827:	c1 e2 18             	shl    $0x18,%edx
+  80782a:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  80782d:	eb 53                	jmp    807882 <inet_aton+0x2a8>
+
+  case 3:             /* a.b.c -- 8.8.16 bits */
+    if (val > 0xffff)
+  80782f:	81 7d fc ff ff 00 00 	cmpl   $0xffff,-0x4(%rbp)
+  807836:	76 07                	jbe    80783f <inet_aton+0x265>
+      return (0);
+  807838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80783d:	eb 6a                	jmp    8078a9 <inet_aton+0x2cf>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  80783f:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  807842:	89 d1                	mov    %edx,%ecx
+  807844:	c1 e1 18             	shl    $0x18,%ecx
+  807847:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80784a:	c1 e2 10             	shl    $0x10,%edx
+  80784d:	09 ca                	or     %ecx,%edx
+  80784f:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  807852:	eb 2e                	jmp    807882 <inet_aton+0x2a8>
+
+  case 4:             /* a.b.c.d -- 8.8.8.8 bits */
+    if (val > 0xff)
+  807854:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%rbp)
+  80785b:	76 07                	jbe    807864 <inet_aton+0x28a>
+      return (0);
+  80785d:	b8 00 00 00 00       	mov    $0x0,%eax
+  807862:	eb 45                	jmp    8078a9 <inet_aton+0x2cf>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  807864:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  807867:	89 d1                	mov    %edx,%ecx
+  807869:	c1 e1 18             	shl    $0x18,%ecx
+  80786c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80786f:	c1 e2 10             	shl    $0x10,%edx
+  807872:	09 d1                	or     %edx,%ecx
+  807874:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  807877:	c1 e2 08             	shl    $0x8,%edx
+  80787a:	09 ca                	or     %ecx,%edx
+  80787c:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  80787f:	eb 01                	jmp    807882 <inet_aton+0x2a8>
+    break;
+  807881:	90                   	nop
+  }
+  if (addr)
+  807882:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  807887:	74 1b                	je     8078a4 <inet_aton+0x2ca>
+    addr->s_addr = htonl(val);
+  807889:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80788c:	89 d7                	mov    %edx,%edi
+  80788e:	48 ba fe d9 ff ff ff 	movabs $0xffffffffffffd9fe,%rdx
+  807895:	ff ff ff 
+  807898:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80789c:	ff d0                	call   *%rax
+  80789e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8078a2:	89 02                	mov    %eax,(%rdx)
+  return (1);
+  8078a4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8078a9:	c9                   	leave
+  8078aa:	c3                   	ret
+
+00000000008078ab <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  8078ab:	55                   	push   %rbp
+  8078ac:	48 89 e5             	mov    %rsp,%rbp
+  8078af:	48 83 ec 28          	sub    $0x28,%rsp
+  8078b3:	48 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%rdx        # 8078b3 <inet_ntoa+0x8>
+  8078ba:	49 bb 95 27 00 00 00 	movabs $0x2795,%r11
+  8078c1:	00 00 00 
+  8078c4:	4c 01 da             	add    %r11,%rdx
+  8078c7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  8078ca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8078cd:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  u8_t *ap;
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  8078d0:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8078d7:	00 00 00 
+  8078da:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  8078de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  ap = (u8_t *)&s_addr;
+  8078e2:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8078e6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(n = 0; n < 4; n++) {
+  8078ea:	c6 45 ef 00          	movb   $0x0,-0x11(%rbp)
+  8078ee:	e9 bc 00 00 00       	jmp    8079af <inet_ntoa+0x104>
+    i = 0;
+  8078f3:	c6 45 ee 00          	movb   $0x0,-0x12(%rbp)
+    do {
+      rem = *ap % (u8_t)10;
+  8078f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8078fb:	0f b6 08             	movzbl (%rax),%ecx
+  8078fe:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  807903:	89 f0                	mov    %esi,%eax
+  807905:	f6 e1                	mul    %cl
+  807907:	66 c1 e8 08          	shr    $0x8,%ax
+  80790b:	c0 e8 03             	shr    $0x3,%al
+  80790e:	88 45 ed             	mov    %al,-0x13(%rbp)
+  807911:	0f b6 75 ed          	movzbl -0x13(%rbp),%esi
+  807915:	89 f0                	mov    %esi,%eax
+  807917:	c1 e0 02             	shl    $0x2,%eax
+  80791a:	01 f0                	add    %esi,%eax
+  80791c:	01 c0                	add    %eax,%eax
+  80791e:	29 c1                	sub    %eax,%ecx
+  807920:	88 4d ed             	mov    %cl,-0x13(%rbp)
+      *ap /= (u8_t)10;
+  807923:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807927:	0f b6 00             	movzbl (%rax),%eax
+  80792a:	b9 cd ff ff ff       	mov    $0xffffffcd,%ecx
+  80792f:	f6 e1                	mul    %cl
+  807931:	66 c1 e8 08          	shr    $0x8,%ax
+  807935:	89 c1                	mov    %eax,%ecx
+  807937:	c0 e9 03             	shr    $0x3,%cl
+  80793a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80793e:	88 08                	mov    %cl,(%rax)
+      inv[i++] = '0' + rem;
+  807940:	0f b6 45 ed          	movzbl -0x13(%rbp),%eax
+  807944:	8d 70 30             	lea    0x30(%rax),%esi
+  807947:	0f b6 45 ee          	movzbl -0x12(%rbp),%eax
+  80794b:	8d 48 01             	lea    0x1(%rax),%ecx
+  80794e:	88 4d ee             	mov    %cl,-0x12(%rbp)
+  807951:	0f b6 c0             	movzbl %al,%eax
+  807954:	89 f1                	mov    %esi,%ecx
+  807956:	48 98                	cltq
+  807958:	88 4c 05 e5          	mov    %cl,-0x1b(%rbp,%rax,1)
+    } while(*ap);
+  80795c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807960:	0f b6 00             	movzbl (%rax),%eax
+  807963:	84 c0                	test   %al,%al
+  807965:	75 90                	jne    8078f7 <inet_ntoa+0x4c>
+    while(i--)
+  807967:	eb 1a                	jmp    807983 <inet_ntoa+0xd8>
+      *rp++ = inv[i];
+  807969:	0f b6 75 ee          	movzbl -0x12(%rbp),%esi
+  80796d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807971:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  807975:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  807979:	48 63 ce             	movslq %esi,%rcx
+  80797c:	0f b6 4c 0d e5       	movzbl -0x1b(%rbp,%rcx,1),%ecx
+  807981:	88 08                	mov    %cl,(%rax)
+    while(i--)
+  807983:	0f b6 45 ee          	movzbl -0x12(%rbp),%eax
+  807987:	8d 48 ff             	lea    -0x1(%rax),%ecx
+  80798a:	88 4d ee             	mov    %cl,-0x12(%rbp)
+  80798d:	84 c0                	test   %al,%al
+  80798f:	75 d8                	jne    807969 <inet_ntoa+0xbe>
+    *rp++ = '.';
+  807991:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807995:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  807999:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  80799d:	c6 00 2e             	movb   $0x2e,(%rax)
+    ap++;
+  8079a0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  for(n = 0; n < 4; n++) {
+  8079a5:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  8079a9:	83 c0 01             	add    $0x1,%eax
+  8079ac:	88 45 ef             	mov    %al,-0x11(%rbp)
+  8079af:	80 7d ef 03          	cmpb   $0x3,-0x11(%rbp)
+  8079b3:	0f 86 3a ff ff ff    	jbe    8078f3 <inet_ntoa+0x48>
+  }
+  *--rp = 0;
+  8079b9:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8079be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8079c2:	c6 00 00             	movb   $0x0,(%rax)
+  return str;
+  8079c5:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8079cc:	00 00 00 
+  8079cf:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+}
+  8079d3:	c9                   	leave
+  8079d4:	c3                   	ret
+
+00000000008079d5 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  8079d5:	55                   	push   %rbp
+  8079d6:	48 89 e5             	mov    %rsp,%rbp
+  8079d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8079dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8079dd <htons+0x8>
+  8079e4:	49 bb 6b 26 00 00 00 	movabs $0x266b,%r11
+  8079eb:	00 00 00 
+  8079ee:	4c 01 d8             	add    %r11,%rax
+  8079f1:	89 f8                	mov    %edi,%eax
+  8079f3:	66 89 45 fc          	mov    %ax,-0x4(%rbp)
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8079f7:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+  8079fb:	c1 e0 08             	shl    $0x8,%eax
+  8079fe:	89 c2                	mov    %eax,%edx
+  807a00:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+  807a04:	66 c1 e8 08          	shr    $0x8,%ax
+  807a08:	09 d0                	or     %edx,%eax
+}
+  807a0a:	c9                   	leave
+  807a0b:	c3                   	ret
+
+0000000000807a0c <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  807a0c:	55                   	push   %rbp
+  807a0d:	48 89 e5             	mov    %rsp,%rbp
+  807a10:	48 83 ec 08          	sub    $0x8,%rsp
+  807a14:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807a14 <ntohs+0x8>
+  807a1b:	49 bb 34 26 00 00 00 	movabs $0x2634,%r11
+  807a22:	00 00 00 
+  807a25:	4c 01 d8             	add    %r11,%rax
+  807a28:	89 fa                	mov    %edi,%edx
+  807a2a:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+  return htons(n);
+  807a2e:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+  807a32:	89 d7                	mov    %edx,%edi
+  807a34:	48 ba 8d d9 ff ff ff 	movabs $0xffffffffffffd98d,%rdx
+  807a3b:	ff ff ff 
+  807a3e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  807a42:	ff d0                	call   *%rax
+}
+  807a44:	c9                   	leave
+  807a45:	c3                   	ret
+
+0000000000807a46 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  807a46:	55                   	push   %rbp
+  807a47:	48 89 e5             	mov    %rsp,%rbp
+  807a4a:	48 83 ec 08          	sub    $0x8,%rsp
+  807a4e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807a4e <htonl+0x8>
+  807a55:	49 bb fa 25 00 00 00 	movabs $0x25fa,%r11
+  807a5c:	00 00 00 
+  807a5f:	4c 01 d8             	add    %r11,%rax
+  807a62:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return ((n & 0xff) << 24) |
+  807a65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807a68:	c1 e0 18             	shl    $0x18,%eax
+  807a6b:	89 c2                	mov    %eax,%edx
+    ((n & 0xff00) << 8) |
+  807a6d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807a70:	c1 e0 08             	shl    $0x8,%eax
+  807a73:	25 00 00 ff 00       	and    $0xff0000,%eax
+  return ((n & 0xff) << 24) |
+  807a78:	09 c2                	or     %eax,%edx
+    ((n & 0xff0000UL) >> 8) |
+  807a7a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807a7d:	48 c1 e8 08          	shr    $0x8,%rax
+  807a81:	25 00 ff 00 00       	and    $0xff00,%eax
+    ((n & 0xff00) << 8) |
+  807a86:	09 c2                	or     %eax,%edx
+    ((n & 0xff000000UL) >> 24);
+  807a88:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807a8b:	c1 e8 18             	shr    $0x18,%eax
+    ((n & 0xff0000UL) >> 8) |
+  807a8e:	09 d0                	or     %edx,%eax
+}
+  807a90:	c9                   	leave
+  807a91:	c3                   	ret
+
+0000000000807a92 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  807a92:	55                   	push   %rbp
+  807a93:	48 89 e5             	mov    %rsp,%rbp
+  807a96:	48 83 ec 08          	sub    $0x8,%rsp
+  807a9a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807a9a <ntohl+0x8>
+  807aa1:	49 bb ae 25 00 00 00 	movabs $0x25ae,%r11
+  807aa8:	00 00 00 
+  807aab:	4c 01 d8             	add    %r11,%rax
+  807aae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return htonl(n);
+  807ab1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  807ab4:	89 d7                	mov    %edx,%edi
+  807ab6:	48 ba fe d9 ff ff ff 	movabs $0xffffffffffffd9fe,%rdx
+  807abd:	ff ff ff 
+  807ac0:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  807ac4:	ff d0                	call   *%rax
+}
+  807ac6:	c9                   	leave
+  807ac7:	c3                   	ret
@@ -0,0 +1,10829 @@
+
+obj/net/testoutput:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 bb 04 00 00       	call   8004fc <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+static struct jif_pkt *pkt = (struct jif_pkt*)REQVA;
+
+
+    void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	41 54                	push   %r12
+  80004b:	53                   	push   %rbx
+  80004c:	48 83 ec 28          	sub    $0x28,%rsp
+  800050:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800050 <umain+0xd>
+  800057:	49 bb f8 8f 00 00 00 	movabs $0x8ff8,%r11
+  80005e:	00 00 00 
+  800061:	4c 01 db             	add    %r11,%rbx
+  800064:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800067:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+    envid_t ns_envid = sys_getenvid();
+  80006b:	49 89 df             	mov    %rbx,%r15
+  80006e:	48 b8 6a 92 ff ff ff 	movabs $0xffffffffffff926a,%rax
+  800075:	ff ff ff 
+  800078:	48 01 d8             	add    %rbx,%rax
+  80007b:	ff d0                	call   *%rax
+  80007d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+    int i, r;
+
+    binaryname = "testoutput";
+  800080:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800087:	ff ff ff 
+  80008a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80008e:	48 ba 58 df ff ff ff 	movabs $0xffffffffffffdf58,%rdx
+  800095:	ff ff ff 
+  800098:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80009c:	48 89 10             	mov    %rdx,(%rax)
+
+    output_envid = fork();
+  80009f:	49 89 df             	mov    %rbx,%r15
+  8000a2:	48 b8 a2 a2 ff ff ff 	movabs $0xffffffffffffa2a2,%rax
+  8000a9:	ff ff ff 
+  8000ac:	48 01 d8             	add    %rbx,%rax
+  8000af:	ff d0                	call   *%rax
+  8000b1:	48 ba b8 0f 00 00 00 	movabs $0xfb8,%rdx
+  8000b8:	00 00 00 
+  8000bb:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+    if (output_envid < 0)
+  8000be:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  8000c5:	00 00 00 
+  8000c8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8000cb:	85 c0                	test   %eax,%eax
+  8000cd:	79 3e                	jns    80010d <umain+0xca>
+        panic("error forking");
+  8000cf:	48 b8 63 df ff ff ff 	movabs $0xffffffffffffdf63,%rax
+  8000d6:	ff ff ff 
+  8000d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000dd:	48 89 c2             	mov    %rax,%rdx
+  8000e0:	be 16 00 00 00       	mov    $0x16,%esi
+  8000e5:	48 b8 71 df ff ff ff 	movabs $0xffffffffffffdf71,%rax
+  8000ec:	ff ff ff 
+  8000ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000f3:	48 89 c7             	mov    %rax,%rdi
+  8000f6:	49 89 df             	mov    %rbx,%r15
+  8000f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fe:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  800105:	ff ff ff 
+  800108:	48 01 d9             	add    %rbx,%rcx
+  80010b:	ff d1                	call   *%rcx
+    else if (output_envid == 0) {
+  80010d:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  800114:	00 00 00 
+  800117:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80011a:	85 c0                	test   %eax,%eax
+  80011c:	75 1c                	jne    80013a <umain+0xf7>
+        output(ns_envid);
+  80011e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800121:	89 c7                	mov    %eax,%edi
+  800123:	49 89 df             	mov    %rbx,%r15
+  800126:	48 b8 73 74 ff ff ff 	movabs $0xffffffffffff7473,%rax
+  80012d:	ff ff ff 
+  800130:	48 01 d8             	add    %rbx,%rax
+  800133:	ff d0                	call   *%rax
+        return;
+  800135:	e9 9e 01 00 00       	jmp    8002d8 <umain+0x295>
+    }
+
+    for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  80013a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+  800141:	e9 63 01 00 00       	jmp    8002a9 <umain+0x266>
+        if ((r = sys_page_alloc(0, pkt, PTE_P|PTE_U|PTE_W)) < 0)
+  800146:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  80014d:	ff ff ff 
+  800150:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800154:	ba 07 00 00 00       	mov    $0x7,%edx
+  800159:	48 89 c6             	mov    %rax,%rsi
+  80015c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800161:	49 89 df             	mov    %rbx,%r15
+  800164:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  80016b:	ff ff ff 
+  80016e:	48 01 d8             	add    %rbx,%rax
+  800171:	ff d0                	call   *%rax
+  800173:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  800176:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80017a:	79 44                	jns    8001c0 <umain+0x17d>
+            panic("sys_page_alloc: %e", r);
+  80017c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80017f:	89 c1                	mov    %eax,%ecx
+  800181:	48 b8 82 df ff ff ff 	movabs $0xffffffffffffdf82,%rax
+  800188:	ff ff ff 
+  80018b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80018f:	48 89 c2             	mov    %rax,%rdx
+  800192:	be 1e 00 00 00       	mov    $0x1e,%esi
+  800197:	48 b8 71 df ff ff ff 	movabs $0xffffffffffffdf71,%rax
+  80019e:	ff ff ff 
+  8001a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001a5:	48 89 c7             	mov    %rax,%rdi
+  8001a8:	49 89 df             	mov    %rbx,%r15
+  8001ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b0:	49 b8 be 75 ff ff ff 	movabs $0xffffffffffff75be,%r8
+  8001b7:	ff ff ff 
+  8001ba:	49 01 d8             	add    %rbx,%r8
+  8001bd:	41 ff d0             	call   *%r8
+        pkt->jp_len = snprintf(pkt->jp_data,
+  8001c0:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  8001c7:	ff ff ff 
+  8001ca:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8001ce:	48 8d 78 04          	lea    0x4(%rax),%rdi
+  8001d2:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  8001d9:	ff ff ff 
+  8001dc:	4c 8b 24 03          	mov    (%rbx,%rax,1),%r12
+  8001e0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001e3:	89 c1                	mov    %eax,%ecx
+  8001e5:	48 b8 95 df ff ff ff 	movabs $0xffffffffffffdf95,%rax
+  8001ec:	ff ff ff 
+  8001ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f3:	48 89 c2             	mov    %rax,%rdx
+  8001f6:	be fc 0f 00 00       	mov    $0xffc,%esi
+  8001fb:	49 89 df             	mov    %rbx,%r15
+  8001fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800203:	49 b8 ca 84 ff ff ff 	movabs $0xffffffffffff84ca,%r8
+  80020a:	ff ff ff 
+  80020d:	49 01 d8             	add    %rbx,%r8
+  800210:	41 ff d0             	call   *%r8
+  800213:	41 89 04 24          	mov    %eax,(%r12)
+                PGSIZE - sizeof(pkt->jp_len),
+                "Packet %02d", i);
+        cprintf("Transmitting packet %d\n", i);
+  800217:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80021a:	89 c6                	mov    %eax,%esi
+  80021c:	48 b8 a1 df ff ff ff 	movabs $0xffffffffffffdfa1,%rax
+  800223:	ff ff ff 
+  800226:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80022a:	48 89 c7             	mov    %rax,%rdi
+  80022d:	49 89 df             	mov    %rbx,%r15
+  800230:	b8 00 00 00 00       	mov    $0x0,%eax
+  800235:	48 ba 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rdx
+  80023c:	ff ff ff 
+  80023f:	48 01 da             	add    %rbx,%rdx
+  800242:	ff d2                	call   *%rdx
+        ipc_send(output_envid, NSREQ_OUTPUT, pkt, PTE_P|PTE_W|PTE_U);
+  800244:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  80024b:	ff ff ff 
+  80024e:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  800252:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  800259:	00 00 00 
+  80025c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80025f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800264:	be 0b 00 00 00       	mov    $0xb,%esi
+  800269:	89 c7                	mov    %eax,%edi
+  80026b:	49 89 df             	mov    %rbx,%r15
+  80026e:	48 b8 31 a7 ff ff ff 	movabs $0xffffffffffffa731,%rax
+  800275:	ff ff ff 
+  800278:	48 01 d8             	add    %rbx,%rax
+  80027b:	ff d0                	call   *%rax
+        sys_page_unmap(0, pkt);
+  80027d:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  800284:	ff ff ff 
+  800287:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80028b:	48 89 c6             	mov    %rax,%rsi
+  80028e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800293:	49 89 df             	mov    %rbx,%r15
+  800296:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  80029d:	ff ff ff 
+  8002a0:	48 01 d8             	add    %rbx,%rax
+  8002a3:	ff d0                	call   *%rax
+    for (i = 0; i < TESTOUTPUT_COUNT; i++) {
+  8002a5:	83 45 dc 01          	addl   $0x1,-0x24(%rbp)
+  8002a9:	83 7d dc 09          	cmpl   $0x9,-0x24(%rbp)
+  8002ad:	0f 8e 93 fe ff ff    	jle    800146 <umain+0x103>
+    }
+
+    // Spin for a while, just in case IPC's or packets need to be flushed
+    for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+  8002b3:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+  8002ba:	eb 16                	jmp    8002d2 <umain+0x28f>
+        sys_yield();
+  8002bc:	49 89 df             	mov    %rbx,%r15
+  8002bf:	48 b8 be 92 ff ff ff 	movabs $0xffffffffffff92be,%rax
+  8002c6:	ff ff ff 
+  8002c9:	48 01 d8             	add    %rbx,%rax
+  8002cc:	ff d0                	call   *%rax
+    for (i = 0; i < TESTOUTPUT_COUNT*2; i++)
+  8002ce:	83 45 dc 01          	addl   $0x1,-0x24(%rbp)
+  8002d2:	83 7d dc 13          	cmpl   $0x13,-0x24(%rbp)
+  8002d6:	7e e4                	jle    8002bc <umain+0x279>
+}
+  8002d8:	48 83 c4 28          	add    $0x28,%rsp
+  8002dc:	5b                   	pop    %rbx
+  8002dd:	41 5c                	pop    %r12
+  8002df:	41 5f                	pop    %r15
+  8002e1:	5d                   	pop    %rbp
+  8002e2:	c3                   	ret
+
+00000000008002e3 <timer>:
+#include "ns.h"
+
+void
+timer(envid_t ns_envid, uint32_t initial_to) {
+  8002e3:	55                   	push   %rbp
+  8002e4:	48 89 e5             	mov    %rsp,%rbp
+  8002e7:	41 57                	push   %r15
+  8002e9:	53                   	push   %rbx
+  8002ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8002ee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8002ee <timer+0xb>
+  8002f5:	49 bb 5a 8d 00 00 00 	movabs $0x8d5a,%r11
+  8002fc:	00 00 00 
+  8002ff:	4c 01 db             	add    %r11,%rbx
+  800302:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800305:	89 75 d8             	mov    %esi,-0x28(%rbp)
+    int r;
+    uint32_t stop = sys_time_msec() + initial_to;
+  800308:	49 89 df             	mov    %rbx,%r15
+  80030b:	48 b8 3a 98 ff ff ff 	movabs $0xffffffffffff983a,%rax
+  800312:	ff ff ff 
+  800315:	48 01 d8             	add    %rbx,%rax
+  800318:	ff d0                	call   *%rax
+  80031a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80031d:	01 d0                	add    %edx,%eax
+  80031f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+    binaryname = "ns_timer";
+  800322:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800329:	ff ff ff 
+  80032c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800330:	48 ba c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rdx
+  800337:	ff ff ff 
+  80033a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80033e:	48 89 10             	mov    %rdx,(%rax)
+
+    while (1) {
+        while((r = sys_time_msec()) < stop && r >= 0) {
+  800341:	eb 26                	jmp    800369 <timer+0x86>
+            sys_sleep_usec((uint64_t) (stop - r) * 1000);
+  800343:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800346:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800349:	29 c2                	sub    %eax,%edx
+  80034b:	89 d0                	mov    %edx,%eax
+  80034d:	48 69 c0 e8 03 00 00 	imul   $0x3e8,%rax,%rax
+  800354:	48 89 c7             	mov    %rax,%rdi
+  800357:	49 89 df             	mov    %rbx,%r15
+  80035a:	48 b8 8e 98 ff ff ff 	movabs $0xffffffffffff988e,%rax
+  800361:	ff ff ff 
+  800364:	48 01 d8             	add    %rbx,%rax
+  800367:	ff d0                	call   *%rax
+        while((r = sys_time_msec()) < stop && r >= 0) {
+  800369:	49 89 df             	mov    %rbx,%r15
+  80036c:	48 b8 3a 98 ff ff ff 	movabs $0xffffffffffff983a,%rax
+  800373:	ff ff ff 
+  800376:	48 01 d8             	add    %rbx,%rax
+  800379:	ff d0                	call   *%rax
+  80037b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80037e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800381:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  800384:	73 06                	jae    80038c <timer+0xa9>
+  800386:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80038a:	79 b7                	jns    800343 <timer+0x60>
+        }
+        if (r < 0)
+  80038c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800390:	79 44                	jns    8003d6 <timer+0xf3>
+            panic("sys_time_msec: %e", r);
+  800392:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800395:	89 c1                	mov    %eax,%ecx
+  800397:	48 b8 c9 df ff ff ff 	movabs $0xffffffffffffdfc9,%rax
+  80039e:	ff ff ff 
+  8003a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003a5:	48 89 c2             	mov    %rax,%rdx
+  8003a8:	be 0f 00 00 00       	mov    $0xf,%esi
+  8003ad:	48 b8 db df ff ff ff 	movabs $0xffffffffffffdfdb,%rax
+  8003b4:	ff ff ff 
+  8003b7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003bb:	48 89 c7             	mov    %rax,%rdi
+  8003be:	49 89 df             	mov    %rbx,%r15
+  8003c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c6:	49 b8 be 75 ff ff ff 	movabs $0xffffffffffff75be,%r8
+  8003cd:	ff ff ff 
+  8003d0:	49 01 d8             	add    %rbx,%r8
+  8003d3:	41 ff d0             	call   *%r8
+
+        ipc_send(ns_envid, NSREQ_TIMER, 0, 0);
+  8003d6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8003d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e3:	be 0c 00 00 00       	mov    $0xc,%esi
+  8003e8:	89 c7                	mov    %eax,%edi
+  8003ea:	49 89 df             	mov    %rbx,%r15
+  8003ed:	48 b8 31 a7 ff ff ff 	movabs $0xffffffffffffa731,%rax
+  8003f4:	ff ff ff 
+  8003f7:	48 01 d8             	add    %rbx,%rax
+  8003fa:	ff d0                	call   *%rax
+
+        while (1) {
+            uint32_t to, whom;
+            to = ipc_recv((int32_t *) &whom, 0, 0);
+  8003fc:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800400:	ba 00 00 00 00       	mov    $0x0,%edx
+  800405:	be 00 00 00 00       	mov    $0x0,%esi
+  80040a:	48 89 c7             	mov    %rax,%rdi
+  80040d:	49 89 df             	mov    %rbx,%r15
+  800410:	48 b8 48 a6 ff ff ff 	movabs $0xffffffffffffa648,%rax
+  800417:	ff ff ff 
+  80041a:	48 01 d8             	add    %rbx,%rax
+  80041d:	ff d0                	call   *%rax
+  80041f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+
+            if (whom != ns_envid) {
+  800422:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800425:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800428:	39 c2                	cmp    %eax,%edx
+  80042a:	74 2f                	je     80045b <timer+0x178>
+                cprintf("NS TIMER: timer thread got IPC message from env %x not NS\n", whom);
+  80042c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80042f:	89 c6                	mov    %eax,%esi
+  800431:	48 b8 e8 df ff ff ff 	movabs $0xffffffffffffdfe8,%rax
+  800438:	ff ff ff 
+  80043b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80043f:	48 89 c7             	mov    %rax,%rdi
+  800442:	49 89 df             	mov    %rbx,%r15
+  800445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044a:	48 ba 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rdx
+  800451:	ff ff ff 
+  800454:	48 01 da             	add    %rbx,%rdx
+  800457:	ff d2                	call   *%rdx
+        while (1) {
+  800459:	eb a1                	jmp    8003fc <timer+0x119>
+                continue;
+            }
+
+            stop = sys_time_msec() + to;
+  80045b:	49 89 df             	mov    %rbx,%r15
+  80045e:	48 b8 3a 98 ff ff ff 	movabs $0xffffffffffff983a,%rax
+  800465:	ff ff ff 
+  800468:	48 01 d8             	add    %rbx,%rax
+  80046b:	ff d0                	call   *%rax
+  80046d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800470:	01 d0                	add    %edx,%eax
+  800472:	89 45 ec             	mov    %eax,-0x14(%rbp)
+        while((r = sys_time_msec()) < stop && r >= 0) {
+  800475:	e9 ef fe ff ff       	jmp    800369 <timer+0x86>
+
+000000000080047a <input>:
+
+extern union Nsipc nsipcbuf;
+
+    void
+input(envid_t ns_envid)
+{
+  80047a:	55                   	push   %rbp
+  80047b:	48 89 e5             	mov    %rsp,%rbp
+  80047e:	48 83 ec 08          	sub    $0x8,%rsp
+  800482:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800482 <input+0x8>
+  800489:	49 bb c6 8b 00 00 00 	movabs $0x8bc6,%r11
+  800490:	00 00 00 
+  800493:	4c 01 d8             	add    %r11,%rax
+  800496:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    binaryname = "ns_input";
+  800499:	48 ba c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rdx
+  8004a0:	ff ff ff 
+  8004a3:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8004a7:	48 b9 23 e0 ff ff ff 	movabs $0xffffffffffffe023,%rcx
+  8004ae:	ff ff ff 
+  8004b1:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8004b5:	48 89 02             	mov    %rax,(%rdx)
+    // 	- read a packet from the device driver
+    //	- send it to the network server
+    // Hint: When you IPC a page to the network server, it will be
+    // reading from it for a while, so don't immediately receive
+    // another packet in to the same physical page.
+}
+  8004b8:	90                   	nop
+  8004b9:	c9                   	leave
+  8004ba:	c3                   	ret
+
+00000000008004bb <output>:
+
+extern union Nsipc nsipcbuf;
+
+    void
+output(envid_t ns_envid)
+{
+  8004bb:	55                   	push   %rbp
+  8004bc:	48 89 e5             	mov    %rsp,%rbp
+  8004bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8004c3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8004c3 <output+0x8>
+  8004ca:	49 bb 85 8b 00 00 00 	movabs $0x8b85,%r11
+  8004d1:	00 00 00 
+  8004d4:	4c 01 d8             	add    %r11,%rax
+  8004d7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+    binaryname = "ns_output";
+  8004da:	48 ba c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rdx
+  8004e1:	ff ff ff 
+  8004e4:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8004e8:	48 b9 2c e0 ff ff ff 	movabs $0xffffffffffffe02c,%rcx
+  8004ef:	ff ff ff 
+  8004f2:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8004f6:	48 89 02             	mov    %rax,(%rdx)
+
+    // LAB 6: Your code here:
+    // 	- read a packet from the network server
+    //	- send the packet to the device driver
+}
+  8004f9:	90                   	nop
+  8004fa:	c9                   	leave
+  8004fb:	c3                   	ret
+
+00000000008004fc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004fc:	55                   	push   %rbp
+  8004fd:	48 89 e5             	mov    %rsp,%rbp
+  800500:	41 57                	push   %r15
+  800502:	53                   	push   %rbx
+  800503:	48 83 ec 20          	sub    $0x20,%rsp
+  800507:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800507 <libmain+0xb>
+  80050e:	49 bb 41 8b 00 00 00 	movabs $0x8b41,%r11
+  800515:	00 00 00 
+  800518:	4c 01 db             	add    %r11,%rbx
+  80051b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80051e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800522:	49 89 df             	mov    %rbx,%r15
+  800525:	48 b8 6a 92 ff ff ff 	movabs $0xffffffffffff926a,%rax
+  80052c:	ff ff ff 
+  80052f:	48 01 d8             	add    %rbx,%rax
+  800532:	ff d0                	call   *%rax
+  800534:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800537:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80053a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80053f:	48 98                	cltq
+  800541:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800548:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80054f:	ff ff ff 
+  800552:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800556:	48 01 c2             	add    %rax,%rdx
+  800559:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  800560:	00 00 00 
+  800563:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800567:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80056b:	7e 15                	jle    800582 <libmain+0x86>
+		binaryname = argv[0];
+  80056d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800571:	48 8b 00             	mov    (%rax),%rax
+  800574:	48 ba 18 00 00 00 00 	movabs $0x18,%rdx
+  80057b:	00 00 00 
+  80057e:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800582:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800586:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800589:	48 89 d6             	mov    %rdx,%rsi
+  80058c:	89 c7                	mov    %eax,%edi
+  80058e:	49 89 df             	mov    %rbx,%r15
+  800591:	48 b8 fb 6f ff ff ff 	movabs $0xffffffffffff6ffb,%rax
+  800598:	ff ff ff 
+  80059b:	48 01 d8             	add    %rbx,%rax
+  80059e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8005a0:	49 89 df             	mov    %rbx,%r15
+  8005a3:	48 b8 74 75 ff ff ff 	movabs $0xffffffffffff7574,%rax
+  8005aa:	ff ff ff 
+  8005ad:	48 01 d8             	add    %rbx,%rax
+  8005b0:	ff d0                	call   *%rax
+}
+  8005b2:	90                   	nop
+  8005b3:	48 83 c4 20          	add    $0x20,%rsp
+  8005b7:	5b                   	pop    %rbx
+  8005b8:	41 5f                	pop    %r15
+  8005ba:	5d                   	pop    %rbp
+  8005bb:	c3                   	ret
+
+00000000008005bc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8005bc:	55                   	push   %rbp
+  8005bd:	48 89 e5             	mov    %rsp,%rbp
+  8005c0:	41 57                	push   %r15
+  8005c2:	53                   	push   %rbx
+  8005c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8005c3 <exit+0x7>
+  8005ca:	49 bb 85 8a 00 00 00 	movabs $0x8a85,%r11
+  8005d1:	00 00 00 
+  8005d4:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8005d7:	49 89 df             	mov    %rbx,%r15
+  8005da:	48 b8 3f b2 ff ff ff 	movabs $0xffffffffffffb23f,%rax
+  8005e1:	ff ff ff 
+  8005e4:	48 01 d8             	add    %rbx,%rax
+  8005e7:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8005e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005ee:	49 89 df             	mov    %rbx,%r15
+  8005f1:	48 b8 0e 92 ff ff ff 	movabs $0xffffffffffff920e,%rax
+  8005f8:	ff ff ff 
+  8005fb:	48 01 d8             	add    %rbx,%rax
+  8005fe:	ff d0                	call   *%rax
+}
+  800600:	90                   	nop
+  800601:	5b                   	pop    %rbx
+  800602:	41 5f                	pop    %r15
+  800604:	5d                   	pop    %rbp
+  800605:	c3                   	ret
+
+0000000000800606 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800606:	55                   	push   %rbp
+  800607:	48 89 e5             	mov    %rsp,%rbp
+  80060a:	41 57                	push   %r15
+  80060c:	41 54                	push   %r12
+  80060e:	53                   	push   %rbx
+  80060f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800616:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800616 <_panic+0x10>
+  80061d:	49 bb 32 8a 00 00 00 	movabs $0x8a32,%r11
+  800624:	00 00 00 
+  800627:	4c 01 db             	add    %r11,%rbx
+  80062a:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800631:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800637:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80063e:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800645:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80064c:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800653:	84 c0                	test   %al,%al
+  800655:	74 26                	je     80067d <_panic+0x77>
+  800657:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80065e:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800665:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800669:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80066d:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800671:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800675:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800679:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80067d:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800684:	00 00 00 
+  800687:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80068e:	00 00 00 
+  800691:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800695:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80069c:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8006a3:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006aa:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8006b1:	ff ff ff 
+  8006b4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8006b8:	4c 8b 20             	mov    (%rax),%r12
+  8006bb:	49 89 df             	mov    %rbx,%r15
+  8006be:	48 b8 6a 92 ff ff ff 	movabs $0xffffffffffff926a,%rax
+  8006c5:	ff ff ff 
+  8006c8:	48 01 d8             	add    %rbx,%rax
+  8006cb:	ff d0                	call   *%rax
+  8006cd:	89 c6                	mov    %eax,%esi
+  8006cf:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8006d5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8006dc:	41 89 d0             	mov    %edx,%r8d
+  8006df:	48 89 c1             	mov    %rax,%rcx
+  8006e2:	4c 89 e2             	mov    %r12,%rdx
+  8006e5:	48 b8 40 e0 ff ff ff 	movabs $0xffffffffffffe040,%rax
+  8006ec:	ff ff ff 
+  8006ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006f3:	48 89 c7             	mov    %rax,%rdi
+  8006f6:	49 89 df             	mov    %rbx,%r15
+  8006f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fe:	49 b9 95 78 ff ff ff 	movabs $0xffffffffffff7895,%r9
+  800705:	ff ff ff 
+  800708:	49 01 d9             	add    %rbx,%r9
+  80070b:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80070e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800715:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80071c:	48 89 d6             	mov    %rdx,%rsi
+  80071f:	48 89 c7             	mov    %rax,%rdi
+  800722:	49 89 df             	mov    %rbx,%r15
+  800725:	48 b8 b5 77 ff ff ff 	movabs $0xffffffffffff77b5,%rax
+  80072c:	ff ff ff 
+  80072f:	48 01 d8             	add    %rbx,%rax
+  800732:	ff d0                	call   *%rax
+	cprintf("\n");
+  800734:	48 b8 63 e0 ff ff ff 	movabs $0xffffffffffffe063,%rax
+  80073b:	ff ff ff 
+  80073e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800742:	48 89 c7             	mov    %rax,%rdi
+  800745:	49 89 df             	mov    %rbx,%r15
+  800748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074d:	48 ba 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rdx
+  800754:	ff ff ff 
+  800757:	48 01 da             	add    %rbx,%rdx
+  80075a:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80075c:	cc                   	int3
+  80075d:	eb fd                	jmp    80075c <_panic+0x156>
+
+000000000080075f <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  80075f:	55                   	push   %rbp
+  800760:	48 89 e5             	mov    %rsp,%rbp
+  800763:	41 57                	push   %r15
+  800765:	48 83 ec 18          	sub    $0x18,%rsp
+  800769:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800769 <putch+0xa>
+  800770:	49 bb df 88 00 00 00 	movabs $0x88df,%r11
+  800777:	00 00 00 
+  80077a:	4c 01 d8             	add    %r11,%rax
+  80077d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800780:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800784:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800788:	8b 12                	mov    (%rdx),%edx
+  80078a:	8d 72 01             	lea    0x1(%rdx),%esi
+  80078d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800791:	89 31                	mov    %esi,(%rcx)
+  800793:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800796:	89 ce                	mov    %ecx,%esi
+  800798:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80079c:	48 63 d2             	movslq %edx,%rdx
+  80079f:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8007a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007a8:	8b 12                	mov    (%rdx),%edx
+  8007aa:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8007b0:	75 33                	jne    8007e5 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8007b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007b6:	8b 12                	mov    (%rdx),%edx
+  8007b8:	48 63 d2             	movslq %edx,%rdx
+  8007bb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8007bf:	48 83 c1 08          	add    $0x8,%rcx
+  8007c3:	48 89 d6             	mov    %rdx,%rsi
+  8007c6:	48 89 cf             	mov    %rcx,%rdi
+  8007c9:	49 89 c7             	mov    %rax,%r15
+  8007cc:	48 ba 5b 91 ff ff ff 	movabs $0xffffffffffff915b,%rdx
+  8007d3:	ff ff ff 
+  8007d6:	48 01 c2             	add    %rax,%rdx
+  8007d9:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8007db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8007df:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8007e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8007e9:	8b 40 04             	mov    0x4(%rax),%eax
+  8007ec:	8d 50 01             	lea    0x1(%rax),%edx
+  8007ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8007f3:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8007f6:	90                   	nop
+  8007f7:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8007fb:	c9                   	leave
+  8007fc:	c3                   	ret
+
+00000000008007fd <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8007fd:	55                   	push   %rbp
+  8007fe:	48 89 e5             	mov    %rsp,%rbp
+  800801:	41 57                	push   %r15
+  800803:	53                   	push   %rbx
+  800804:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80080b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80080b <vcprintf+0xe>
+  800812:	49 bb 3d 88 00 00 00 	movabs $0x883d,%r11
+  800819:	00 00 00 
+  80081c:	4c 01 db             	add    %r11,%rbx
+  80081f:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800826:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80082d:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800834:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80083b:	48 8b 06             	mov    (%rsi),%rax
+  80083e:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800842:	48 89 01             	mov    %rax,(%rcx)
+  800845:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800849:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80084d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800851:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800858:	00 00 00 
+    b.cnt = 0;
+  80085b:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800862:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800865:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80086c:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800873:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80087a:	48 89 c6             	mov    %rax,%rsi
+  80087d:	48 b8 17 77 ff ff ff 	movabs $0xffffffffffff7717,%rax
+  800884:	ff ff ff 
+  800887:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80088b:	48 89 c7             	mov    %rax,%rdi
+  80088e:	49 89 df             	mov    %rbx,%r15
+  800891:	48 b8 d9 7c ff ff ff 	movabs $0xffffffffffff7cd9,%rax
+  800898:	ff ff ff 
+  80089b:	48 01 d8             	add    %rbx,%rax
+  80089e:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8008a0:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8008a6:	48 98                	cltq
+  8008a8:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8008af:	48 83 c2 08          	add    $0x8,%rdx
+  8008b3:	48 89 c6             	mov    %rax,%rsi
+  8008b6:	48 89 d7             	mov    %rdx,%rdi
+  8008b9:	49 89 df             	mov    %rbx,%r15
+  8008bc:	48 b8 5b 91 ff ff ff 	movabs $0xffffffffffff915b,%rax
+  8008c3:	ff ff ff 
+  8008c6:	48 01 d8             	add    %rbx,%rax
+  8008c9:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8008cb:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8008d1:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8008d8:	5b                   	pop    %rbx
+  8008d9:	41 5f                	pop    %r15
+  8008db:	5d                   	pop    %rbp
+  8008dc:	c3                   	ret
+
+00000000008008dd <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8008dd:	55                   	push   %rbp
+  8008de:	48 89 e5             	mov    %rsp,%rbp
+  8008e1:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8008e8:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8008e8 <cprintf+0xb>
+  8008ef:	49 bb 60 87 00 00 00 	movabs $0x8760,%r11
+  8008f6:	00 00 00 
+  8008f9:	4d 01 da             	add    %r11,%r10
+  8008fc:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800903:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80090a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800911:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800918:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80091f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800926:	84 c0                	test   %al,%al
+  800928:	74 20                	je     80094a <cprintf+0x6d>
+  80092a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80092e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800932:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800936:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80093a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80093e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800942:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800946:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80094a:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800951:	00 00 00 
+  800954:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80095b:	00 00 00 
+  80095e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800962:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800969:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800970:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800977:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80097e:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800985:	48 8b 06             	mov    (%rsi),%rax
+  800988:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80098c:	48 89 01             	mov    %rax,(%rcx)
+  80098f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800993:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800997:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80099b:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8009a2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8009a9:	48 89 d6             	mov    %rdx,%rsi
+  8009ac:	48 89 c7             	mov    %rax,%rdi
+  8009af:	48 b8 b5 77 ff ff ff 	movabs $0xffffffffffff77b5,%rax
+  8009b6:	ff ff ff 
+  8009b9:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8009bd:	ff d0                	call   *%rax
+  8009bf:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8009c5:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8009cb:	c9                   	leave
+  8009cc:	c3                   	ret
+
+00000000008009cd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8009cd:	55                   	push   %rbp
+  8009ce:	48 89 e5             	mov    %rsp,%rbp
+  8009d1:	53                   	push   %rbx
+  8009d2:	48 83 ec 38          	sub    $0x38,%rsp
+  8009d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8009d6 <printnum+0x9>
+  8009dd:	49 bb 72 86 00 00 00 	movabs $0x8672,%r11
+  8009e4:	00 00 00 
+  8009e7:	4c 01 db             	add    %r11,%rbx
+  8009ea:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009ee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8009f2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8009f6:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8009f9:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8009fd:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800a01:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800a04:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800a08:	72 58                	jb     800a62 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800a0a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800a0d:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800a10:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800a13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a1c:	48 f7 f6             	div    %rsi
+  800a1f:	49 89 c2             	mov    %rax,%r10
+  800a22:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800a25:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800a28:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800a2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a30:	41 89 c9             	mov    %ecx,%r9d
+  800a33:	41 89 f8             	mov    %edi,%r8d
+  800a36:	89 d1                	mov    %edx,%ecx
+  800a38:	4c 89 d2             	mov    %r10,%rdx
+  800a3b:	48 89 c7             	mov    %rax,%rdi
+  800a3e:	48 b8 85 79 ff ff ff 	movabs $0xffffffffffff7985,%rax
+  800a45:	ff ff ff 
+  800a48:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a4c:	ff d0                	call   *%rax
+  800a4e:	eb 1c                	jmp    800a6c <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800a50:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a54:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800a57:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a5b:	48 89 d6             	mov    %rdx,%rsi
+  800a5e:	89 c7                	mov    %eax,%edi
+  800a60:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800a62:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800a66:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800a6a:	7f e4                	jg     800a50 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800a6c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800a6f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a78:	48 f7 f1             	div    %rcx
+  800a7b:	48 b8 9f e1 ff ff ff 	movabs $0xffffffffffffe19f,%rax
+  800a82:	ff ff ff 
+  800a85:	48 01 d8             	add    %rbx,%rax
+  800a88:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800a8c:	0f be c0             	movsbl %al,%eax
+  800a8f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a93:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a97:	48 89 d6             	mov    %rdx,%rsi
+  800a9a:	89 c7                	mov    %eax,%edi
+  800a9c:	ff d1                	call   *%rcx
+}
+  800a9e:	90                   	nop
+  800a9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800aa3:	c9                   	leave
+  800aa4:	c3                   	ret
+
+0000000000800aa5 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800aa5:	55                   	push   %rbp
+  800aa6:	48 89 e5             	mov    %rsp,%rbp
+  800aa9:	48 83 ec 20          	sub    $0x20,%rsp
+  800aad:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800aad <getuint+0x8>
+  800ab4:	49 bb 9b 85 00 00 00 	movabs $0x859b,%r11
+  800abb:	00 00 00 
+  800abe:	4c 01 d8             	add    %r11,%rax
+  800ac1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ac5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800ac8:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800acc:	7e 4f                	jle    800b1d <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800ace:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad2:	8b 00                	mov    (%rax),%eax
+  800ad4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad7:	77 24                	ja     800afd <getuint+0x58>
+  800ad9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800add:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ae1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae5:	8b 00                	mov    (%rax),%eax
+  800ae7:	89 c0                	mov    %eax,%eax
+  800ae9:	48 01 d0             	add    %rdx,%rax
+  800aec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800af0:	8b 12                	mov    (%rdx),%edx
+  800af2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800af5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800af9:	89 0a                	mov    %ecx,(%rdx)
+  800afb:	eb 14                	jmp    800b11 <getuint+0x6c>
+  800afd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b01:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b05:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b09:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b0d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b11:	48 8b 00             	mov    (%rax),%rax
+  800b14:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b18:	e9 9d 00 00 00       	jmp    800bba <getuint+0x115>
+	else if (lflag)
+  800b1d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800b21:	74 4c                	je     800b6f <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b27:	8b 00                	mov    (%rax),%eax
+  800b29:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2c:	77 24                	ja     800b52 <getuint+0xad>
+  800b2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b32:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b3a:	8b 00                	mov    (%rax),%eax
+  800b3c:	89 c0                	mov    %eax,%eax
+  800b3e:	48 01 d0             	add    %rdx,%rax
+  800b41:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b45:	8b 12                	mov    (%rdx),%edx
+  800b47:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b4a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b4e:	89 0a                	mov    %ecx,(%rdx)
+  800b50:	eb 14                	jmp    800b66 <getuint+0xc1>
+  800b52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b56:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b5a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b5e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b62:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b66:	48 8b 00             	mov    (%rax),%rax
+  800b69:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b6d:	eb 4b                	jmp    800bba <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800b6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b73:	8b 00                	mov    (%rax),%eax
+  800b75:	83 f8 2f             	cmp    $0x2f,%eax
+  800b78:	77 24                	ja     800b9e <getuint+0xf9>
+  800b7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b7e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b86:	8b 00                	mov    (%rax),%eax
+  800b88:	89 c0                	mov    %eax,%eax
+  800b8a:	48 01 d0             	add    %rdx,%rax
+  800b8d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b91:	8b 12                	mov    (%rdx),%edx
+  800b93:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b96:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b9a:	89 0a                	mov    %ecx,(%rdx)
+  800b9c:	eb 14                	jmp    800bb2 <getuint+0x10d>
+  800b9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ba6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800baa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bae:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bb2:	8b 00                	mov    (%rax),%eax
+  800bb4:	89 c0                	mov    %eax,%eax
+  800bb6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800bba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800bbe:	c9                   	leave
+  800bbf:	c3                   	ret
+
+0000000000800bc0 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800bc0:	55                   	push   %rbp
+  800bc1:	48 89 e5             	mov    %rsp,%rbp
+  800bc4:	48 83 ec 20          	sub    $0x20,%rsp
+  800bc8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800bc8 <printfloat+0x8>
+  800bcf:	49 bb 80 84 00 00 00 	movabs $0x8480,%r11
+  800bd6:	00 00 00 
+  800bd9:	4c 01 d8             	add    %r11,%rax
+  800bdc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800be0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800be4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800be8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bec:	48 85 c0             	test   %rax,%rax
+  800bef:	79 12                	jns    800c03 <printfloat+0x43>
+		putch('-',putdat);
+  800bf1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800bf5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800bf9:	48 89 c6             	mov    %rax,%rsi
+  800bfc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c01:	ff d2                	call   *%rdx
+	
+}
+  800c03:	90                   	nop
+  800c04:	c9                   	leave
+  800c05:	c3                   	ret
+
+0000000000800c06 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800c06:	55                   	push   %rbp
+  800c07:	48 89 e5             	mov    %rsp,%rbp
+  800c0a:	48 83 ec 20          	sub    $0x20,%rsp
+  800c0e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c0e <getint+0x8>
+  800c15:	49 bb 3a 84 00 00 00 	movabs $0x843a,%r11
+  800c1c:	00 00 00 
+  800c1f:	4c 01 d8             	add    %r11,%rax
+  800c22:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c26:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800c29:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800c2d:	7e 4f                	jle    800c7e <getint+0x78>
+		x=va_arg(*ap, long long);
+  800c2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c33:	8b 00                	mov    (%rax),%eax
+  800c35:	83 f8 2f             	cmp    $0x2f,%eax
+  800c38:	77 24                	ja     800c5e <getint+0x58>
+  800c3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c3e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c46:	8b 00                	mov    (%rax),%eax
+  800c48:	89 c0                	mov    %eax,%eax
+  800c4a:	48 01 d0             	add    %rdx,%rax
+  800c4d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c51:	8b 12                	mov    (%rdx),%edx
+  800c53:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c56:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c5a:	89 0a                	mov    %ecx,(%rdx)
+  800c5c:	eb 14                	jmp    800c72 <getint+0x6c>
+  800c5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c62:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c66:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c6a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c6e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c72:	48 8b 00             	mov    (%rax),%rax
+  800c75:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c79:	e9 9d 00 00 00       	jmp    800d1b <getint+0x115>
+	else if (lflag)
+  800c7e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800c82:	74 4c                	je     800cd0 <getint+0xca>
+		x=va_arg(*ap, long);
+  800c84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c88:	8b 00                	mov    (%rax),%eax
+  800c8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8d:	77 24                	ja     800cb3 <getint+0xad>
+  800c8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c93:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c9b:	8b 00                	mov    (%rax),%eax
+  800c9d:	89 c0                	mov    %eax,%eax
+  800c9f:	48 01 d0             	add    %rdx,%rax
+  800ca2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ca6:	8b 12                	mov    (%rdx),%edx
+  800ca8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800caf:	89 0a                	mov    %ecx,(%rdx)
+  800cb1:	eb 14                	jmp    800cc7 <getint+0xc1>
+  800cb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cbb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800cbf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cc3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cc7:	48 8b 00             	mov    (%rax),%rax
+  800cca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800cce:	eb 4b                	jmp    800d1b <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800cd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cd4:	8b 00                	mov    (%rax),%eax
+  800cd6:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd9:	77 24                	ja     800cff <getint+0xf9>
+  800cdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cdf:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ce3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce7:	8b 00                	mov    (%rax),%eax
+  800ce9:	89 c0                	mov    %eax,%eax
+  800ceb:	48 01 d0             	add    %rdx,%rax
+  800cee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cf2:	8b 12                	mov    (%rdx),%edx
+  800cf4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cf7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cfb:	89 0a                	mov    %ecx,(%rdx)
+  800cfd:	eb 14                	jmp    800d13 <getint+0x10d>
+  800cff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d03:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d07:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d0b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d0f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d13:	8b 00                	mov    (%rax),%eax
+  800d15:	48 98                	cltq
+  800d17:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800d1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800d1f:	c9                   	leave
+  800d20:	c3                   	ret
+
+0000000000800d21 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800d21:	55                   	push   %rbp
+  800d22:	48 89 e5             	mov    %rsp,%rbp
+  800d25:	41 57                	push   %r15
+  800d27:	41 55                	push   %r13
+  800d29:	41 54                	push   %r12
+  800d2b:	53                   	push   %rbx
+  800d2c:	48 83 ec 60          	sub    $0x60,%rsp
+  800d30:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800d30 <vprintfmt+0xf>
+  800d37:	49 bb 18 83 00 00 00 	movabs $0x8318,%r11
+  800d3e:	00 00 00 
+  800d41:	4d 01 dc             	add    %r11,%r12
+  800d44:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800d48:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800d4c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d50:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800d54:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800d5b:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800d5f:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800d63:	48 8b 06             	mov    (%rsi),%rax
+  800d66:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800d6a:	48 89 01             	mov    %rax,(%rcx)
+  800d6d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d71:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800d75:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d79:	eb 17                	jmp    800d92 <vprintfmt+0x71>
+			if (ch == '\0')
+  800d7b:	85 db                	test   %ebx,%ebx
+  800d7d:	0f 84 97 05 00 00    	je     80131a <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800d83:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d87:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d8b:	48 89 c6             	mov    %rax,%rsi
+  800d8e:	89 df                	mov    %ebx,%edi
+  800d90:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d92:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d96:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d9a:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d9e:	0f b6 00             	movzbl (%rax),%eax
+  800da1:	0f b6 d8             	movzbl %al,%ebx
+  800da4:	83 fb 25             	cmp    $0x25,%ebx
+  800da7:	75 d2                	jne    800d7b <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800da9:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800dad:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800db4:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800dbb:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800dc2:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800dc9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800dcd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800dd1:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800dd5:	0f b6 00             	movzbl (%rax),%eax
+  800dd8:	0f b6 d8             	movzbl %al,%ebx
+  800ddb:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800dde:	83 f8 55             	cmp    $0x55,%eax
+  800de1:	0f 87 00 05 00 00    	ja     8012e7 <vprintfmt+0x5c6>
+  800de7:	89 c0                	mov    %eax,%eax
+  800de9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800df0:	00 
+  800df1:	48 8d 05 18 64 00 00 	lea    0x6418(%rip),%rax        # 807210 <.LC18+0xc>
+  800df8:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800dfc:	48 8d 15 0d 64 00 00 	lea    0x640d(%rip),%rdx        # 807210 <.LC18+0xc>
+  800e03:	48 01 d0             	add    %rdx,%rax
+  800e06:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800e08:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800e0c:	eb bb                	jmp    800dc9 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800e0e:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800e12:	eb b5                	jmp    800dc9 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800e14:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800e1b:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800e1e:	89 d0                	mov    %edx,%eax
+  800e20:	c1 e0 02             	shl    $0x2,%eax
+  800e23:	01 d0                	add    %edx,%eax
+  800e25:	01 c0                	add    %eax,%eax
+  800e27:	01 d8                	add    %ebx,%eax
+  800e29:	83 e8 30             	sub    $0x30,%eax
+  800e2c:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800e2f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e33:	0f b6 00             	movzbl (%rax),%eax
+  800e36:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800e39:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e3c:	7e 60                	jle    800e9e <vprintfmt+0x17d>
+  800e3e:	83 fb 39             	cmp    $0x39,%ebx
+  800e41:	7f 5b                	jg     800e9e <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800e43:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800e48:	eb d1                	jmp    800e1b <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800e4a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e50:	77 17                	ja     800e69 <vprintfmt+0x148>
+  800e52:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e56:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e59:	89 d2                	mov    %edx,%edx
+  800e5b:	48 01 d0             	add    %rdx,%rax
+  800e5e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e61:	83 c2 08             	add    $0x8,%edx
+  800e64:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e67:	eb 0c                	jmp    800e75 <vprintfmt+0x154>
+  800e69:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e6d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e71:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e75:	8b 00                	mov    (%rax),%eax
+  800e77:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800e7a:	eb 23                	jmp    800e9f <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800e7c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e80:	0f 89 43 ff ff ff    	jns    800dc9 <vprintfmt+0xa8>
+				width = 0;
+  800e86:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800e8d:	e9 37 ff ff ff       	jmp    800dc9 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800e92:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800e99:	e9 2b ff ff ff       	jmp    800dc9 <vprintfmt+0xa8>
+			goto process_precision;
+  800e9e:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800e9f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ea3:	0f 89 20 ff ff ff    	jns    800dc9 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800ea9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800eac:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800eaf:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800eb6:	e9 0e ff ff ff       	jmp    800dc9 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800ebb:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800ebf:	e9 05 ff ff ff       	jmp    800dc9 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800ec4:	83 fb 39             	cmp    $0x39,%ebx
+  800ec7:	7f 0b                	jg     800ed4 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800ec9:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800ecc:	c1 e0 08             	shl    $0x8,%eax
+  800ecf:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ed2:	eb 21                	jmp    800ef5 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800ed4:	83 fb 60             	cmp    $0x60,%ebx
+  800ed7:	7e 10                	jle    800ee9 <vprintfmt+0x1c8>
+  800ed9:	83 fb 66             	cmp    $0x66,%ebx
+  800edc:	7f 0b                	jg     800ee9 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800ede:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800ee1:	c1 e0 08             	shl    $0x8,%eax
+  800ee4:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ee7:	eb 0c                	jmp    800ef5 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800ee9:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800ef0:	e9 04 01 00 00       	jmp    800ff9 <vprintfmt+0x2d8>
+  800ef5:	e9 ff 00 00 00       	jmp    800ff9 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800efa:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800efd:	83 f8 2f             	cmp    $0x2f,%eax
+  800f00:	77 17                	ja     800f19 <vprintfmt+0x1f8>
+  800f02:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f06:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f09:	89 d2                	mov    %edx,%edx
+  800f0b:	48 01 d0             	add    %rdx,%rax
+  800f0e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f11:	83 c2 08             	add    $0x8,%edx
+  800f14:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f17:	eb 0c                	jmp    800f25 <vprintfmt+0x204>
+  800f19:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f1d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f21:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f25:	8b 00                	mov    (%rax),%eax
+  800f27:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800f2b:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800f2f:	48 89 d6             	mov    %rdx,%rsi
+  800f32:	89 c7                	mov    %eax,%edi
+  800f34:	ff d1                	call   *%rcx
+			break;
+  800f36:	e9 da 03 00 00       	jmp    801315 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800f3b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f41:	77 17                	ja     800f5a <vprintfmt+0x239>
+  800f43:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f47:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f4a:	89 d2                	mov    %edx,%edx
+  800f4c:	48 01 d0             	add    %rdx,%rax
+  800f4f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f52:	83 c2 08             	add    $0x8,%edx
+  800f55:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f58:	eb 0c                	jmp    800f66 <vprintfmt+0x245>
+  800f5a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f5e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f62:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f66:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800f68:	85 db                	test   %ebx,%ebx
+  800f6a:	79 02                	jns    800f6e <vprintfmt+0x24d>
+				err = -err;
+  800f6c:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800f6e:	83 fb 15             	cmp    $0x15,%ebx
+  800f71:	7f 19                	jg     800f8c <vprintfmt+0x26b>
+  800f73:	48 ba 38 01 00 00 00 	movabs $0x138,%rdx
+  800f7a:	00 00 00 
+  800f7d:	48 63 c3             	movslq %ebx,%rax
+  800f80:	4c 01 e2             	add    %r12,%rdx
+  800f83:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800f87:	4d 85 ed             	test   %r13,%r13
+  800f8a:	75 36                	jne    800fc2 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800f8c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f90:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f94:	89 d9                	mov    %ebx,%ecx
+  800f96:	48 ba b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rdx
+  800f9d:	ff ff ff 
+  800fa0:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800fa4:	48 89 c7             	mov    %rax,%rdi
+  800fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fac:	49 b8 e0 82 ff ff ff 	movabs $0xffffffffffff82e0,%r8
+  800fb3:	ff ff ff 
+  800fb6:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800fba:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800fbd:	e9 53 03 00 00       	jmp    801315 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800fc2:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800fc6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fca:	4c 89 e9             	mov    %r13,%rcx
+  800fcd:	48 ba b9 e1 ff ff ff 	movabs $0xffffffffffffe1b9,%rdx
+  800fd4:	ff ff ff 
+  800fd7:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800fdb:	48 89 c7             	mov    %rax,%rdi
+  800fde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe3:	49 b8 e0 82 ff ff ff 	movabs $0xffffffffffff82e0,%r8
+  800fea:	ff ff ff 
+  800fed:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800ff1:	41 ff d0             	call   *%r8
+			break;
+  800ff4:	e9 1c 03 00 00       	jmp    801315 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ff9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ffc:	83 f8 2f             	cmp    $0x2f,%eax
+  800fff:	77 17                	ja     801018 <vprintfmt+0x2f7>
+  801001:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801005:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801008:	89 d2                	mov    %edx,%edx
+  80100a:	48 01 d0             	add    %rdx,%rax
+  80100d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801010:	83 c2 08             	add    $0x8,%edx
+  801013:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801016:	eb 0c                	jmp    801024 <vprintfmt+0x303>
+  801018:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80101c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801020:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801024:	4c 8b 28             	mov    (%rax),%r13
+  801027:	4d 85 ed             	test   %r13,%r13
+  80102a:	75 0e                	jne    80103a <vprintfmt+0x319>
+				p = "(null)";
+  80102c:	48 b8 bc e1 ff ff ff 	movabs $0xffffffffffffe1bc,%rax
+  801033:	ff ff ff 
+  801036:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  80103a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80103e:	0f 8e 84 00 00 00    	jle    8010c8 <vprintfmt+0x3a7>
+  801044:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  801048:	74 7e                	je     8010c8 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80104a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80104d:	48 98                	cltq
+  80104f:	48 89 c6             	mov    %rax,%rsi
+  801052:	4c 89 ef             	mov    %r13,%rdi
+  801055:	4d 89 e7             	mov    %r12,%r15
+  801058:	48 b8 05 86 ff ff ff 	movabs $0xffffffffffff8605,%rax
+  80105f:	ff ff ff 
+  801062:	4c 01 e0             	add    %r12,%rax
+  801065:	ff d0                	call   *%rax
+  801067:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  80106a:	eb 17                	jmp    801083 <vprintfmt+0x362>
+					putch(padc, putdat);
+  80106c:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  801070:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  801074:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801078:	48 89 d6             	mov    %rdx,%rsi
+  80107b:	89 c7                	mov    %eax,%edi
+  80107d:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80107f:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801083:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801087:	7f e3                	jg     80106c <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801089:	eb 3d                	jmp    8010c8 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80108b:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80108f:	74 1e                	je     8010af <vprintfmt+0x38e>
+  801091:	83 fb 1f             	cmp    $0x1f,%ebx
+  801094:	7e 05                	jle    80109b <vprintfmt+0x37a>
+  801096:	83 fb 7e             	cmp    $0x7e,%ebx
+  801099:	7e 14                	jle    8010af <vprintfmt+0x38e>
+					putch('?', putdat);
+  80109b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80109f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010a3:	48 89 c6             	mov    %rax,%rsi
+  8010a6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8010ab:	ff d2                	call   *%rdx
+  8010ad:	eb 15                	jmp    8010c4 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  8010af:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8010b2:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  8010b5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010b9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010bd:	48 89 c6             	mov    %rax,%rsi
+  8010c0:	89 cf                	mov    %ecx,%edi
+  8010c2:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8010c4:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8010c8:	4c 89 e8             	mov    %r13,%rax
+  8010cb:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  8010cf:	0f b6 00             	movzbl (%rax),%eax
+  8010d2:	0f be d8             	movsbl %al,%ebx
+  8010d5:	85 db                	test   %ebx,%ebx
+  8010d7:	74 28                	je     801101 <vprintfmt+0x3e0>
+  8010d9:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8010dd:	78 ac                	js     80108b <vprintfmt+0x36a>
+  8010df:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  8010e3:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8010e7:	79 a2                	jns    80108b <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  8010e9:	eb 16                	jmp    801101 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  8010eb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010ef:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010f3:	48 89 c6             	mov    %rax,%rsi
+  8010f6:	bf 20 00 00 00       	mov    $0x20,%edi
+  8010fb:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8010fd:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801101:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801105:	7f e4                	jg     8010eb <vprintfmt+0x3ca>
+			break;
+  801107:	e9 09 02 00 00       	jmp    801315 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80110c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801110:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801114:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801118:	0f b6 00             	movzbl (%rax),%eax
+  80111b:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  80111e:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  80111f:	83 fb 2f             	cmp    $0x2f,%ebx
+  801122:	0f 8e ac fd ff ff    	jle    800ed4 <vprintfmt+0x1b3>
+  801128:	e9 97 fd ff ff       	jmp    800ec4 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  80112d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801131:	be 03 00 00 00       	mov    $0x3,%esi
+  801136:	48 89 c7             	mov    %rax,%rdi
+  801139:	48 b8 be 7b ff ff ff 	movabs $0xffffffffffff7bbe,%rax
+  801140:	ff ff ff 
+  801143:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801147:	ff d0                	call   *%rax
+  801149:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  80114d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801151:	48 85 c0             	test   %rax,%rax
+  801154:	79 1d                	jns    801173 <vprintfmt+0x452>
+				putch('-', putdat);
+  801156:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80115a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80115e:	48 89 c6             	mov    %rax,%rsi
+  801161:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801166:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  801168:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80116c:	48 f7 d8             	neg    %rax
+  80116f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  801173:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80117a:	e9 de 00 00 00       	jmp    80125d <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  80117f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801183:	be 03 00 00 00       	mov    $0x3,%esi
+  801188:	48 89 c7             	mov    %rax,%rdi
+  80118b:	48 b8 5d 7a ff ff ff 	movabs $0xffffffffffff7a5d,%rax
+  801192:	ff ff ff 
+  801195:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801199:	ff d0                	call   *%rax
+  80119b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  80119f:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8011a6:	e9 b2 00 00 00       	jmp    80125d <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8011ab:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011af:	be 03 00 00 00       	mov    $0x3,%esi
+  8011b4:	48 89 c7             	mov    %rax,%rdi
+  8011b7:	48 b8 5d 7a ff ff ff 	movabs $0xffffffffffff7a5d,%rax
+  8011be:	ff ff ff 
+  8011c1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011c5:	ff d0                	call   *%rax
+  8011c7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  8011cb:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  8011d2:	e9 86 00 00 00       	jmp    80125d <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  8011d7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011db:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011df:	48 89 c6             	mov    %rax,%rsi
+  8011e2:	bf 30 00 00 00       	mov    $0x30,%edi
+  8011e7:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  8011e9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011ed:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011f1:	48 89 c6             	mov    %rax,%rsi
+  8011f4:	bf 78 00 00 00       	mov    $0x78,%edi
+  8011f9:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8011fb:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8011fe:	83 f8 2f             	cmp    $0x2f,%eax
+  801201:	77 17                	ja     80121a <vprintfmt+0x4f9>
+  801203:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801207:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80120a:	89 d2                	mov    %edx,%edx
+  80120c:	48 01 d0             	add    %rdx,%rax
+  80120f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801212:	83 c2 08             	add    $0x8,%edx
+  801215:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801218:	eb 0c                	jmp    801226 <vprintfmt+0x505>
+  80121a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80121e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801222:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801226:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801229:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80122d:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801234:	eb 27                	jmp    80125d <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801236:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80123a:	be 03 00 00 00       	mov    $0x3,%esi
+  80123f:	48 89 c7             	mov    %rax,%rdi
+  801242:	48 b8 5d 7a ff ff ff 	movabs $0xffffffffffff7a5d,%rax
+  801249:	ff ff ff 
+  80124c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801250:	ff d0                	call   *%rax
+  801252:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801256:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  80125d:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801262:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801265:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801268:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80126c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801270:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801274:	45 89 c1             	mov    %r8d,%r9d
+  801277:	41 89 f8             	mov    %edi,%r8d
+  80127a:	48 89 c7             	mov    %rax,%rdi
+  80127d:	48 b8 85 79 ff ff ff 	movabs $0xffffffffffff7985,%rax
+  801284:	ff ff ff 
+  801287:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80128b:	ff d0                	call   *%rax
+			break;
+  80128d:	e9 83 00 00 00       	jmp    801315 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801292:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801296:	be 03 00 00 00       	mov    $0x3,%esi
+  80129b:	48 89 c7             	mov    %rax,%rdi
+  80129e:	48 b8 5d 7a ff ff ff 	movabs $0xffffffffffff7a5d,%rax
+  8012a5:	ff ff ff 
+  8012a8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012ac:	ff d0                	call   *%rax
+  8012ae:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8012b2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8012b6:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8012ba:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8012be:	48 89 ce             	mov    %rcx,%rsi
+  8012c1:	48 89 c7             	mov    %rax,%rdi
+  8012c4:	48 b8 78 7b ff ff ff 	movabs $0xffffffffffff7b78,%rax
+  8012cb:	ff ff ff 
+  8012ce:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012d2:	ff d0                	call   *%rax
+	
+			break;
+  8012d4:	eb 3f                	jmp    801315 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8012d6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8012da:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8012de:	48 89 c6             	mov    %rax,%rsi
+  8012e1:	89 df                	mov    %ebx,%edi
+  8012e3:	ff d2                	call   *%rdx
+			break;
+  8012e5:	eb 2e                	jmp    801315 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8012e7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8012eb:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8012ef:	48 89 c6             	mov    %rax,%rsi
+  8012f2:	bf 25 00 00 00       	mov    $0x25,%edi
+  8012f7:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8012f9:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8012fe:	eb 05                	jmp    801305 <vprintfmt+0x5e4>
+  801300:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801305:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801309:	48 83 e8 01          	sub    $0x1,%rax
+  80130d:	0f b6 00             	movzbl (%rax),%eax
+  801310:	3c 25                	cmp    $0x25,%al
+  801312:	75 ec                	jne    801300 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801314:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801315:	e9 78 fa ff ff       	jmp    800d92 <vprintfmt+0x71>
+				return;
+  80131a:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80131b:	48 83 c4 60          	add    $0x60,%rsp
+  80131f:	5b                   	pop    %rbx
+  801320:	41 5c                	pop    %r12
+  801322:	41 5d                	pop    %r13
+  801324:	41 5f                	pop    %r15
+  801326:	5d                   	pop    %rbp
+  801327:	c3                   	ret
+
+0000000000801328 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801328:	55                   	push   %rbp
+  801329:	48 89 e5             	mov    %rsp,%rbp
+  80132c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801333:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801333 <printfmt+0xb>
+  80133a:	49 bb 15 7d 00 00 00 	movabs $0x7d15,%r11
+  801341:	00 00 00 
+  801344:	4d 01 da             	add    %r11,%r10
+  801347:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80134e:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801355:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80135c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801363:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80136a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801371:	84 c0                	test   %al,%al
+  801373:	74 20                	je     801395 <printfmt+0x6d>
+  801375:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801379:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80137d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801381:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801385:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801389:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80138d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801391:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801395:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80139c:	00 00 00 
+  80139f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8013a6:	00 00 00 
+  8013a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8013ad:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8013b4:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8013bb:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8013c2:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8013c9:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8013d0:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8013d7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8013de:	48 89 c7             	mov    %rax,%rdi
+  8013e1:	48 b8 d9 7c ff ff ff 	movabs $0xffffffffffff7cd9,%rax
+  8013e8:	ff ff ff 
+  8013eb:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8013ef:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8013f1:	90                   	nop
+  8013f2:	c9                   	leave
+  8013f3:	c3                   	ret
+
+00000000008013f4 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8013f4:	55                   	push   %rbp
+  8013f5:	48 89 e5             	mov    %rsp,%rbp
+  8013f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8013fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013fc <sprintputch+0x8>
+  801403:	49 bb 4c 7c 00 00 00 	movabs $0x7c4c,%r11
+  80140a:	00 00 00 
+  80140d:	4c 01 d8             	add    %r11,%rax
+  801410:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801413:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801417:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80141b:	8b 40 10             	mov    0x10(%rax),%eax
+  80141e:	8d 50 01             	lea    0x1(%rax),%edx
+  801421:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801425:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801428:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80142c:	48 8b 10             	mov    (%rax),%rdx
+  80142f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801433:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801437:	48 39 c2             	cmp    %rax,%rdx
+  80143a:	73 17                	jae    801453 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80143c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801440:	48 8b 00             	mov    (%rax),%rax
+  801443:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801447:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80144b:	48 89 0a             	mov    %rcx,(%rdx)
+  80144e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801451:	88 10                	mov    %dl,(%rax)
+}
+  801453:	90                   	nop
+  801454:	c9                   	leave
+  801455:	c3                   	ret
+
+0000000000801456 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801456:	55                   	push   %rbp
+  801457:	48 89 e5             	mov    %rsp,%rbp
+  80145a:	53                   	push   %rbx
+  80145b:	48 83 ec 58          	sub    $0x58,%rsp
+  80145f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80145f <vsnprintf+0x9>
+  801466:	49 bb e9 7b 00 00 00 	movabs $0x7be9,%r11
+  80146d:	00 00 00 
+  801470:	4c 01 d8             	add    %r11,%rax
+  801473:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801477:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80147a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80147e:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801482:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801486:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80148a:	48 8b 0e             	mov    (%rsi),%rcx
+  80148d:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801491:	48 89 0a             	mov    %rcx,(%rdx)
+  801494:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801498:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  80149c:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8014a0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8014a4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8014a8:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8014ab:	48 63 d2             	movslq %edx,%rdx
+  8014ae:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8014b2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8014b6:	48 01 ca             	add    %rcx,%rdx
+  8014b9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8014bd:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8014c4:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8014c9:	74 06                	je     8014d1 <vsnprintf+0x7b>
+  8014cb:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8014cf:	7f 07                	jg     8014d8 <vsnprintf+0x82>
+		return -E_INVAL;
+  8014d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d6:	eb 34                	jmp    80150c <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8014d8:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8014dc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8014e0:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8014e4:	48 bf ac 83 ff ff ff 	movabs $0xffffffffffff83ac,%rdi
+  8014eb:	ff ff ff 
+  8014ee:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8014f2:	49 b8 d9 7c ff ff ff 	movabs $0xffffffffffff7cd9,%r8
+  8014f9:	ff ff ff 
+  8014fc:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801500:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801502:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801506:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801509:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80150c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801510:	c9                   	leave
+  801511:	c3                   	ret
+
+0000000000801512 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801512:	55                   	push   %rbp
+  801513:	48 89 e5             	mov    %rsp,%rbp
+  801516:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80151d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80151d <snprintf+0xb>
+  801524:	49 bb 2b 7b 00 00 00 	movabs $0x7b2b,%r11
+  80152b:	00 00 00 
+  80152e:	4d 01 da             	add    %r11,%r10
+  801531:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801538:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80153e:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801545:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80154c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801553:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80155a:	84 c0                	test   %al,%al
+  80155c:	74 20                	je     80157e <snprintf+0x6c>
+  80155e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801562:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801566:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80156a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80156e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801572:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801576:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80157a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80157e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801585:	00 00 00 
+  801588:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80158f:	00 00 00 
+  801592:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801596:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80159d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8015a4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8015ab:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8015b2:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8015b9:	48 8b 06             	mov    (%rsi),%rax
+  8015bc:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8015c0:	48 89 01             	mov    %rax,(%rcx)
+  8015c3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8015c7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8015cb:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8015cf:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8015d6:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8015dd:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8015e3:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8015ea:	48 89 c7             	mov    %rax,%rdi
+  8015ed:	48 b8 0e 84 ff ff ff 	movabs $0xffffffffffff840e,%rax
+  8015f4:	ff ff ff 
+  8015f7:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8015fb:	ff d0                	call   *%rax
+  8015fd:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801603:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801609:	c9                   	leave
+  80160a:	c3                   	ret
+
+000000000080160b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80160b:	55                   	push   %rbp
+  80160c:	48 89 e5             	mov    %rsp,%rbp
+  80160f:	48 83 ec 18          	sub    $0x18,%rsp
+  801613:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801613 <strlen+0x8>
+  80161a:	49 bb 35 7a 00 00 00 	movabs $0x7a35,%r11
+  801621:	00 00 00 
+  801624:	4c 01 d8             	add    %r11,%rax
+  801627:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80162b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801632:	eb 09                	jmp    80163d <strlen+0x32>
+		n++;
+  801634:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801638:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80163d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801641:	0f b6 00             	movzbl (%rax),%eax
+  801644:	84 c0                	test   %al,%al
+  801646:	75 ec                	jne    801634 <strlen+0x29>
+	return n;
+  801648:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80164b:	c9                   	leave
+  80164c:	c3                   	ret
+
+000000000080164d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80164d:	55                   	push   %rbp
+  80164e:	48 89 e5             	mov    %rsp,%rbp
+  801651:	48 83 ec 20          	sub    $0x20,%rsp
+  801655:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801655 <strnlen+0x8>
+  80165c:	49 bb f3 79 00 00 00 	movabs $0x79f3,%r11
+  801663:	00 00 00 
+  801666:	4c 01 d8             	add    %r11,%rax
+  801669:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80166d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801671:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801678:	eb 0e                	jmp    801688 <strnlen+0x3b>
+		n++;
+  80167a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80167e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801683:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801688:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80168d:	74 0b                	je     80169a <strnlen+0x4d>
+  80168f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801693:	0f b6 00             	movzbl (%rax),%eax
+  801696:	84 c0                	test   %al,%al
+  801698:	75 e0                	jne    80167a <strnlen+0x2d>
+	return n;
+  80169a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80169d:	c9                   	leave
+  80169e:	c3                   	ret
+
+000000000080169f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8016a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016a7 <strcpy+0x8>
+  8016ae:	49 bb a1 79 00 00 00 	movabs $0x79a1,%r11
+  8016b5:	00 00 00 
+  8016b8:	4c 01 d8             	add    %r11,%rax
+  8016bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016bf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8016c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8016cb:	90                   	nop
+  8016cc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016d0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016d4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016dc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016e4:	0f b6 12             	movzbl (%rdx),%edx
+  8016e7:	88 10                	mov    %dl,(%rax)
+  8016e9:	0f b6 00             	movzbl (%rax),%eax
+  8016ec:	84 c0                	test   %al,%al
+  8016ee:	75 dc                	jne    8016cc <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8016f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016f4:	c9                   	leave
+  8016f5:	c3                   	ret
+
+00000000008016f6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8016f6:	55                   	push   %rbp
+  8016f7:	48 89 e5             	mov    %rsp,%rbp
+  8016fa:	53                   	push   %rbx
+  8016fb:	48 83 ec 20          	sub    $0x20,%rsp
+  8016ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8016ff <strcat+0x9>
+  801706:	49 bb 49 79 00 00 00 	movabs $0x7949,%r11
+  80170d:	00 00 00 
+  801710:	4c 01 db             	add    %r11,%rbx
+  801713:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801717:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80171b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80171f:	48 89 c7             	mov    %rax,%rdi
+  801722:	48 b8 c3 85 ff ff ff 	movabs $0xffffffffffff85c3,%rax
+  801729:	ff ff ff 
+  80172c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801730:	ff d0                	call   *%rax
+  801732:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801735:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801738:	48 63 d0             	movslq %eax,%rdx
+  80173b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80173f:	48 01 c2             	add    %rax,%rdx
+  801742:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801746:	48 89 c6             	mov    %rax,%rsi
+  801749:	48 89 d7             	mov    %rdx,%rdi
+  80174c:	48 b8 57 86 ff ff ff 	movabs $0xffffffffffff8657,%rax
+  801753:	ff ff ff 
+  801756:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80175a:	ff d0                	call   *%rax
+	return dst;
+  80175c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801760:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801764:	c9                   	leave
+  801765:	c3                   	ret
+
+0000000000801766 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801766:	55                   	push   %rbp
+  801767:	48 89 e5             	mov    %rsp,%rbp
+  80176a:	48 83 ec 28          	sub    $0x28,%rsp
+  80176e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80176e <strncpy+0x8>
+  801775:	49 bb da 78 00 00 00 	movabs $0x78da,%r11
+  80177c:	00 00 00 
+  80177f:	4c 01 d8             	add    %r11,%rax
+  801782:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801786:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80178a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80178e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801792:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801796:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80179d:	00 
+  80179e:	eb 2a                	jmp    8017ca <strncpy+0x64>
+		*dst++ = *src;
+  8017a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017a4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017a8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8017ac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017b0:	0f b6 12             	movzbl (%rdx),%edx
+  8017b3:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8017b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017b9:	0f b6 00             	movzbl (%rax),%eax
+  8017bc:	84 c0                	test   %al,%al
+  8017be:	74 05                	je     8017c5 <strncpy+0x5f>
+			src++;
+  8017c0:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8017c5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ce:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8017d2:	72 cc                	jb     8017a0 <strncpy+0x3a>
+	}
+	return ret;
+  8017d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8017d8:	c9                   	leave
+  8017d9:	c3                   	ret
+
+00000000008017da <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8017da:	55                   	push   %rbp
+  8017db:	48 89 e5             	mov    %rsp,%rbp
+  8017de:	48 83 ec 28          	sub    $0x28,%rsp
+  8017e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e2 <strlcpy+0x8>
+  8017e9:	49 bb 66 78 00 00 00 	movabs $0x7866,%r11
+  8017f0:	00 00 00 
+  8017f3:	4c 01 d8             	add    %r11,%rax
+  8017f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017fa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017fe:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801802:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801806:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80180a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80180f:	74 3d                	je     80184e <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801811:	eb 1d                	jmp    801830 <strlcpy+0x56>
+			*dst++ = *src++;
+  801813:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801817:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80181b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80181f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801823:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801827:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80182b:	0f b6 12             	movzbl (%rdx),%edx
+  80182e:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801830:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801835:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80183a:	74 0b                	je     801847 <strlcpy+0x6d>
+  80183c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801840:	0f b6 00             	movzbl (%rax),%eax
+  801843:	84 c0                	test   %al,%al
+  801845:	75 cc                	jne    801813 <strlcpy+0x39>
+		*dst = '\0';
+  801847:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80184b:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80184e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801852:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801856:	c9                   	leave
+  801857:	c3                   	ret
+
+0000000000801858 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801858:	55                   	push   %rbp
+  801859:	48 89 e5             	mov    %rsp,%rbp
+  80185c:	48 83 ec 10          	sub    $0x10,%rsp
+  801860:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801860 <strcmp+0x8>
+  801867:	49 bb e8 77 00 00 00 	movabs $0x77e8,%r11
+  80186e:	00 00 00 
+  801871:	4c 01 d8             	add    %r11,%rax
+  801874:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801878:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  80187c:	eb 0a                	jmp    801888 <strcmp+0x30>
+		p++, q++;
+  80187e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801883:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801888:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80188c:	0f b6 00             	movzbl (%rax),%eax
+  80188f:	84 c0                	test   %al,%al
+  801891:	74 12                	je     8018a5 <strcmp+0x4d>
+  801893:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801897:	0f b6 10             	movzbl (%rax),%edx
+  80189a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80189e:	0f b6 00             	movzbl (%rax),%eax
+  8018a1:	38 c2                	cmp    %al,%dl
+  8018a3:	74 d9                	je     80187e <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8018a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a9:	0f b6 00             	movzbl (%rax),%eax
+  8018ac:	0f b6 d0             	movzbl %al,%edx
+  8018af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018b3:	0f b6 00             	movzbl (%rax),%eax
+  8018b6:	0f b6 c0             	movzbl %al,%eax
+  8018b9:	29 c2                	sub    %eax,%edx
+  8018bb:	89 d0                	mov    %edx,%eax
+}
+  8018bd:	c9                   	leave
+  8018be:	c3                   	ret
+
+00000000008018bf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8018bf:	55                   	push   %rbp
+  8018c0:	48 89 e5             	mov    %rsp,%rbp
+  8018c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8018c7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018c7 <strncmp+0x8>
+  8018ce:	49 bb 81 77 00 00 00 	movabs $0x7781,%r11
+  8018d5:	00 00 00 
+  8018d8:	4c 01 d8             	add    %r11,%rax
+  8018db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018df:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018e3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8018e7:	eb 0f                	jmp    8018f8 <strncmp+0x39>
+		n--, p++, q++;
+  8018e9:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8018ee:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018f3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8018f8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018fd:	74 1d                	je     80191c <strncmp+0x5d>
+  8018ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801903:	0f b6 00             	movzbl (%rax),%eax
+  801906:	84 c0                	test   %al,%al
+  801908:	74 12                	je     80191c <strncmp+0x5d>
+  80190a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80190e:	0f b6 10             	movzbl (%rax),%edx
+  801911:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801915:	0f b6 00             	movzbl (%rax),%eax
+  801918:	38 c2                	cmp    %al,%dl
+  80191a:	74 cd                	je     8018e9 <strncmp+0x2a>
+	if (n == 0)
+  80191c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801921:	75 07                	jne    80192a <strncmp+0x6b>
+		return 0;
+  801923:	ba 00 00 00 00       	mov    $0x0,%edx
+  801928:	eb 16                	jmp    801940 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80192a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80192e:	0f b6 00             	movzbl (%rax),%eax
+  801931:	0f b6 d0             	movzbl %al,%edx
+  801934:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801938:	0f b6 00             	movzbl (%rax),%eax
+  80193b:	0f b6 c0             	movzbl %al,%eax
+  80193e:	29 c2                	sub    %eax,%edx
+}
+  801940:	89 d0                	mov    %edx,%eax
+  801942:	c9                   	leave
+  801943:	c3                   	ret
+
+0000000000801944 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801944:	55                   	push   %rbp
+  801945:	48 89 e5             	mov    %rsp,%rbp
+  801948:	48 83 ec 10          	sub    $0x10,%rsp
+  80194c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80194c <strchr+0x8>
+  801953:	49 bb fc 76 00 00 00 	movabs $0x76fc,%r11
+  80195a:	00 00 00 
+  80195d:	4c 01 d8             	add    %r11,%rax
+  801960:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801964:	89 f0                	mov    %esi,%eax
+  801966:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801969:	eb 17                	jmp    801982 <strchr+0x3e>
+		if (*s == c)
+  80196b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80196f:	0f b6 00             	movzbl (%rax),%eax
+  801972:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801975:	75 06                	jne    80197d <strchr+0x39>
+			return (char *) s;
+  801977:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80197b:	eb 15                	jmp    801992 <strchr+0x4e>
+	for (; *s; s++)
+  80197d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801982:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801986:	0f b6 00             	movzbl (%rax),%eax
+  801989:	84 c0                	test   %al,%al
+  80198b:	75 de                	jne    80196b <strchr+0x27>
+	return 0;
+  80198d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801992:	c9                   	leave
+  801993:	c3                   	ret
+
+0000000000801994 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801994:	55                   	push   %rbp
+  801995:	48 89 e5             	mov    %rsp,%rbp
+  801998:	48 83 ec 10          	sub    $0x10,%rsp
+  80199c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80199c <strfind+0x8>
+  8019a3:	49 bb ac 76 00 00 00 	movabs $0x76ac,%r11
+  8019aa:	00 00 00 
+  8019ad:	4c 01 d8             	add    %r11,%rax
+  8019b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019b4:	89 f0                	mov    %esi,%eax
+  8019b6:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8019b9:	eb 11                	jmp    8019cc <strfind+0x38>
+		if (*s == c)
+  8019bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019bf:	0f b6 00             	movzbl (%rax),%eax
+  8019c2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8019c5:	74 12                	je     8019d9 <strfind+0x45>
+	for (; *s; s++)
+  8019c7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019d0:	0f b6 00             	movzbl (%rax),%eax
+  8019d3:	84 c0                	test   %al,%al
+  8019d5:	75 e4                	jne    8019bb <strfind+0x27>
+  8019d7:	eb 01                	jmp    8019da <strfind+0x46>
+			break;
+  8019d9:	90                   	nop
+	return (char *) s;
+  8019da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8019de:	c9                   	leave
+  8019df:	c3                   	ret
+
+00000000008019e0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8019e0:	55                   	push   %rbp
+  8019e1:	48 89 e5             	mov    %rsp,%rbp
+  8019e4:	48 83 ec 18          	sub    $0x18,%rsp
+  8019e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019e8 <memset+0x8>
+  8019ef:	49 bb 60 76 00 00 00 	movabs $0x7660,%r11
+  8019f6:	00 00 00 
+  8019f9:	4c 01 d8             	add    %r11,%rax
+  8019fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a00:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801a03:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801a07:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a0c:	75 06                	jne    801a14 <memset+0x34>
+		return v;
+  801a0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a12:	eb 69                	jmp    801a7d <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801a14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a18:	83 e0 03             	and    $0x3,%eax
+  801a1b:	48 85 c0             	test   %rax,%rax
+  801a1e:	75 48                	jne    801a68 <memset+0x88>
+  801a20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a24:	83 e0 03             	and    $0x3,%eax
+  801a27:	48 85 c0             	test   %rax,%rax
+  801a2a:	75 3c                	jne    801a68 <memset+0x88>
+		c &= 0xFF;
+  801a2c:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801a33:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a36:	c1 e0 18             	shl    $0x18,%eax
+  801a39:	89 c2                	mov    %eax,%edx
+  801a3b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a3e:	c1 e0 10             	shl    $0x10,%eax
+  801a41:	09 c2                	or     %eax,%edx
+  801a43:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a46:	c1 e0 08             	shl    $0x8,%eax
+  801a49:	09 d0                	or     %edx,%eax
+  801a4b:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801a4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a52:	48 c1 e8 02          	shr    $0x2,%rax
+  801a56:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801a59:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a5d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a60:	48 89 d7             	mov    %rdx,%rdi
+  801a63:	fc                   	cld
+  801a64:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801a66:	eb 11                	jmp    801a79 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801a68:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a6c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a6f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801a73:	48 89 d7             	mov    %rdx,%rdi
+  801a76:	fc                   	cld
+  801a77:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801a79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a7d:	c9                   	leave
+  801a7e:	c3                   	ret
+
+0000000000801a7f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801a7f:	55                   	push   %rbp
+  801a80:	48 89 e5             	mov    %rsp,%rbp
+  801a83:	48 83 ec 28          	sub    $0x28,%rsp
+  801a87:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a87 <memmove+0x8>
+  801a8e:	49 bb c1 75 00 00 00 	movabs $0x75c1,%r11
+  801a95:	00 00 00 
+  801a98:	4c 01 d8             	add    %r11,%rax
+  801a9b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a9f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801aa3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801aa7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801aab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801aaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ab3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801ab7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801abb:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801abf:	0f 83 88 00 00 00    	jae    801b4d <memmove+0xce>
+  801ac5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ac9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801acd:	48 01 d0             	add    %rdx,%rax
+  801ad0:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801ad4:	73 77                	jae    801b4d <memmove+0xce>
+		s += n;
+  801ad6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ada:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801ade:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae2:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801ae6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aea:	83 e0 03             	and    $0x3,%eax
+  801aed:	48 85 c0             	test   %rax,%rax
+  801af0:	75 3b                	jne    801b2d <memmove+0xae>
+  801af2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af6:	83 e0 03             	and    $0x3,%eax
+  801af9:	48 85 c0             	test   %rax,%rax
+  801afc:	75 2f                	jne    801b2d <memmove+0xae>
+  801afe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b02:	83 e0 03             	and    $0x3,%eax
+  801b05:	48 85 c0             	test   %rax,%rax
+  801b08:	75 23                	jne    801b2d <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801b0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b0e:	48 83 e8 04          	sub    $0x4,%rax
+  801b12:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b16:	48 83 ea 04          	sub    $0x4,%rdx
+  801b1a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b1e:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801b22:	48 89 c7             	mov    %rax,%rdi
+  801b25:	48 89 d6             	mov    %rdx,%rsi
+  801b28:	fd                   	std
+  801b29:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801b2b:	eb 1d                	jmp    801b4a <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801b2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b31:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b39:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801b3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b41:	48 89 d7             	mov    %rdx,%rdi
+  801b44:	48 89 c1             	mov    %rax,%rcx
+  801b47:	fd                   	std
+  801b48:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801b4a:	fc                   	cld
+  801b4b:	eb 57                	jmp    801ba4 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801b4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b51:	83 e0 03             	and    $0x3,%eax
+  801b54:	48 85 c0             	test   %rax,%rax
+  801b57:	75 36                	jne    801b8f <memmove+0x110>
+  801b59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b5d:	83 e0 03             	and    $0x3,%eax
+  801b60:	48 85 c0             	test   %rax,%rax
+  801b63:	75 2a                	jne    801b8f <memmove+0x110>
+  801b65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b69:	83 e0 03             	and    $0x3,%eax
+  801b6c:	48 85 c0             	test   %rax,%rax
+  801b6f:	75 1e                	jne    801b8f <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801b71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b75:	48 c1 e8 02          	shr    $0x2,%rax
+  801b79:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801b7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b80:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b84:	48 89 c7             	mov    %rax,%rdi
+  801b87:	48 89 d6             	mov    %rdx,%rsi
+  801b8a:	fc                   	cld
+  801b8b:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801b8d:	eb 15                	jmp    801ba4 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801b8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b93:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b97:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b9b:	48 89 c7             	mov    %rax,%rdi
+  801b9e:	48 89 d6             	mov    %rdx,%rsi
+  801ba1:	fc                   	cld
+  801ba2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801ba4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ba8:	c9                   	leave
+  801ba9:	c3                   	ret
+
+0000000000801baa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801baa:	55                   	push   %rbp
+  801bab:	48 89 e5             	mov    %rsp,%rbp
+  801bae:	48 83 ec 18          	sub    $0x18,%rsp
+  801bb2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bb2 <memcpy+0x8>
+  801bb9:	49 bb 96 74 00 00 00 	movabs $0x7496,%r11
+  801bc0:	00 00 00 
+  801bc3:	4c 01 d8             	add    %r11,%rax
+  801bc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801bca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801bce:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801bd2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801bd6:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801bda:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801bde:	48 89 cf             	mov    %rcx,%rdi
+  801be1:	48 b9 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rcx
+  801be8:	ff ff ff 
+  801beb:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801bef:	ff d0                	call   *%rax
+}
+  801bf1:	c9                   	leave
+  801bf2:	c3                   	ret
+
+0000000000801bf3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801bf3:	55                   	push   %rbp
+  801bf4:	48 89 e5             	mov    %rsp,%rbp
+  801bf7:	48 83 ec 28          	sub    $0x28,%rsp
+  801bfb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bfb <memcmp+0x8>
+  801c02:	49 bb 4d 74 00 00 00 	movabs $0x744d,%r11
+  801c09:	00 00 00 
+  801c0c:	4c 01 d8             	add    %r11,%rax
+  801c0f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c13:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c17:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801c1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c1f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801c23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c27:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801c2b:	eb 34                	jmp    801c61 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801c2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c31:	0f b6 10             	movzbl (%rax),%edx
+  801c34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c38:	0f b6 00             	movzbl (%rax),%eax
+  801c3b:	38 c2                	cmp    %al,%dl
+  801c3d:	74 18                	je     801c57 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801c3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c43:	0f b6 00             	movzbl (%rax),%eax
+  801c46:	0f b6 d0             	movzbl %al,%edx
+  801c49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c4d:	0f b6 00             	movzbl (%rax),%eax
+  801c50:	0f b6 c0             	movzbl %al,%eax
+  801c53:	29 c2                	sub    %eax,%edx
+  801c55:	eb 20                	jmp    801c77 <memcmp+0x84>
+		s1++, s2++;
+  801c57:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c5c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801c61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c65:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c69:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801c6d:	48 85 c0             	test   %rax,%rax
+  801c70:	75 bb                	jne    801c2d <memcmp+0x3a>
+	}
+
+	return 0;
+  801c72:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801c77:	89 d0                	mov    %edx,%eax
+  801c79:	c9                   	leave
+  801c7a:	c3                   	ret
+
+0000000000801c7b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801c7b:	55                   	push   %rbp
+  801c7c:	48 89 e5             	mov    %rsp,%rbp
+  801c7f:	48 83 ec 28          	sub    $0x28,%rsp
+  801c83:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c83 <memfind+0x8>
+  801c8a:	49 bb c5 73 00 00 00 	movabs $0x73c5,%r11
+  801c91:	00 00 00 
+  801c94:	4c 01 d8             	add    %r11,%rax
+  801c97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c9b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801c9e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801ca2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ca6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801caa:	48 01 d0             	add    %rdx,%rax
+  801cad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801cb1:	eb 13                	jmp    801cc6 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801cb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cb7:	0f b6 00             	movzbl (%rax),%eax
+  801cba:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801cbd:	38 d0                	cmp    %dl,%al
+  801cbf:	74 11                	je     801cd2 <memfind+0x57>
+	for (; s < ends; s++)
+  801cc1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801cc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cca:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801cce:	72 e3                	jb     801cb3 <memfind+0x38>
+  801cd0:	eb 01                	jmp    801cd3 <memfind+0x58>
+			break;
+  801cd2:	90                   	nop
+	return (void *) s;
+  801cd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801cd7:	c9                   	leave
+  801cd8:	c3                   	ret
+
+0000000000801cd9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801cd9:	55                   	push   %rbp
+  801cda:	48 89 e5             	mov    %rsp,%rbp
+  801cdd:	48 83 ec 38          	sub    $0x38,%rsp
+  801ce1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ce1 <strtol+0x8>
+  801ce8:	49 bb 67 73 00 00 00 	movabs $0x7367,%r11
+  801cef:	00 00 00 
+  801cf2:	4c 01 d8             	add    %r11,%rax
+  801cf5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cf9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801cfd:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801d00:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801d07:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801d0e:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801d0f:	eb 05                	jmp    801d16 <strtol+0x3d>
+		s++;
+  801d11:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801d16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d1a:	0f b6 00             	movzbl (%rax),%eax
+  801d1d:	3c 20                	cmp    $0x20,%al
+  801d1f:	74 f0                	je     801d11 <strtol+0x38>
+  801d21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d25:	0f b6 00             	movzbl (%rax),%eax
+  801d28:	3c 09                	cmp    $0x9,%al
+  801d2a:	74 e5                	je     801d11 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801d2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d30:	0f b6 00             	movzbl (%rax),%eax
+  801d33:	3c 2b                	cmp    $0x2b,%al
+  801d35:	75 07                	jne    801d3e <strtol+0x65>
+		s++;
+  801d37:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d3c:	eb 17                	jmp    801d55 <strtol+0x7c>
+	else if (*s == '-')
+  801d3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d42:	0f b6 00             	movzbl (%rax),%eax
+  801d45:	3c 2d                	cmp    $0x2d,%al
+  801d47:	75 0c                	jne    801d55 <strtol+0x7c>
+		s++, neg = 1;
+  801d49:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d4e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801d55:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d59:	74 06                	je     801d61 <strtol+0x88>
+  801d5b:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801d5f:	75 28                	jne    801d89 <strtol+0xb0>
+  801d61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d65:	0f b6 00             	movzbl (%rax),%eax
+  801d68:	3c 30                	cmp    $0x30,%al
+  801d6a:	75 1d                	jne    801d89 <strtol+0xb0>
+  801d6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d70:	48 83 c0 01          	add    $0x1,%rax
+  801d74:	0f b6 00             	movzbl (%rax),%eax
+  801d77:	3c 78                	cmp    $0x78,%al
+  801d79:	75 0e                	jne    801d89 <strtol+0xb0>
+		s += 2, base = 16;
+  801d7b:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801d80:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801d87:	eb 2c                	jmp    801db5 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801d89:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d8d:	75 19                	jne    801da8 <strtol+0xcf>
+  801d8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d93:	0f b6 00             	movzbl (%rax),%eax
+  801d96:	3c 30                	cmp    $0x30,%al
+  801d98:	75 0e                	jne    801da8 <strtol+0xcf>
+		s++, base = 8;
+  801d9a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d9f:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801da6:	eb 0d                	jmp    801db5 <strtol+0xdc>
+	else if (base == 0)
+  801da8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801dac:	75 07                	jne    801db5 <strtol+0xdc>
+		base = 10;
+  801dae:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801db5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db9:	0f b6 00             	movzbl (%rax),%eax
+  801dbc:	3c 2f                	cmp    $0x2f,%al
+  801dbe:	7e 1d                	jle    801ddd <strtol+0x104>
+  801dc0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dc4:	0f b6 00             	movzbl (%rax),%eax
+  801dc7:	3c 39                	cmp    $0x39,%al
+  801dc9:	7f 12                	jg     801ddd <strtol+0x104>
+			dig = *s - '0';
+  801dcb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dcf:	0f b6 00             	movzbl (%rax),%eax
+  801dd2:	0f be c0             	movsbl %al,%eax
+  801dd5:	83 e8 30             	sub    $0x30,%eax
+  801dd8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ddb:	eb 4e                	jmp    801e2b <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801ddd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801de1:	0f b6 00             	movzbl (%rax),%eax
+  801de4:	3c 60                	cmp    $0x60,%al
+  801de6:	7e 1d                	jle    801e05 <strtol+0x12c>
+  801de8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dec:	0f b6 00             	movzbl (%rax),%eax
+  801def:	3c 7a                	cmp    $0x7a,%al
+  801df1:	7f 12                	jg     801e05 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801df3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801df7:	0f b6 00             	movzbl (%rax),%eax
+  801dfa:	0f be c0             	movsbl %al,%eax
+  801dfd:	83 e8 57             	sub    $0x57,%eax
+  801e00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e03:	eb 26                	jmp    801e2b <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801e05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e09:	0f b6 00             	movzbl (%rax),%eax
+  801e0c:	3c 40                	cmp    $0x40,%al
+  801e0e:	7e 47                	jle    801e57 <strtol+0x17e>
+  801e10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e14:	0f b6 00             	movzbl (%rax),%eax
+  801e17:	3c 5a                	cmp    $0x5a,%al
+  801e19:	7f 3c                	jg     801e57 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801e1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e1f:	0f b6 00             	movzbl (%rax),%eax
+  801e22:	0f be c0             	movsbl %al,%eax
+  801e25:	83 e8 37             	sub    $0x37,%eax
+  801e28:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801e2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e2e:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801e31:	7d 23                	jge    801e56 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801e33:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e38:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e3b:	48 98                	cltq
+  801e3d:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801e42:	48 89 c2             	mov    %rax,%rdx
+  801e45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e48:	48 98                	cltq
+  801e4a:	48 01 d0             	add    %rdx,%rax
+  801e4d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801e51:	e9 5f ff ff ff       	jmp    801db5 <strtol+0xdc>
+			break;
+  801e56:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801e57:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e5c:	74 0b                	je     801e69 <strtol+0x190>
+		*endptr = (char *) s;
+  801e5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e62:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801e66:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801e69:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801e6d:	74 09                	je     801e78 <strtol+0x19f>
+  801e6f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e73:	48 f7 d8             	neg    %rax
+  801e76:	eb 04                	jmp    801e7c <strtol+0x1a3>
+  801e78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801e7c:	c9                   	leave
+  801e7d:	c3                   	ret
+
+0000000000801e7e <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801e7e:	55                   	push   %rbp
+  801e7f:	48 89 e5             	mov    %rsp,%rbp
+  801e82:	53                   	push   %rbx
+  801e83:	48 83 ec 30          	sub    $0x30,%rsp
+  801e87:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801e87 <strstr+0x9>
+  801e8e:	49 bb c1 71 00 00 00 	movabs $0x71c1,%r11
+  801e95:	00 00 00 
+  801e98:	4c 01 db             	add    %r11,%rbx
+  801e9b:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801e9f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801ea3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ea7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801eab:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801eaf:	0f b6 00             	movzbl (%rax),%eax
+  801eb2:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801eb5:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801eb9:	75 06                	jne    801ec1 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801ebb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ebf:	eb 73                	jmp    801f34 <strstr+0xb6>
+
+	len = strlen(str);
+  801ec1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ec5:	48 89 c7             	mov    %rax,%rdi
+  801ec8:	48 b8 c3 85 ff ff ff 	movabs $0xffffffffffff85c3,%rax
+  801ecf:	ff ff ff 
+  801ed2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ed6:	ff d0                	call   *%rax
+  801ed8:	48 98                	cltq
+  801eda:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801ede:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ee2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ee6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801eea:	0f b6 00             	movzbl (%rax),%eax
+  801eed:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801ef0:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801ef4:	75 07                	jne    801efd <strstr+0x7f>
+				return (char *) 0;
+  801ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efb:	eb 37                	jmp    801f34 <strstr+0xb6>
+		} while (sc != c);
+  801efd:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801f01:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801f04:	75 d8                	jne    801ede <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801f06:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f0a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f12:	48 89 ce             	mov    %rcx,%rsi
+  801f15:	48 89 c7             	mov    %rax,%rdi
+  801f18:	48 b8 77 88 ff ff ff 	movabs $0xffffffffffff8877,%rax
+  801f1f:	ff ff ff 
+  801f22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f26:	ff d0                	call   *%rax
+  801f28:	85 c0                	test   %eax,%eax
+  801f2a:	75 b2                	jne    801ede <strstr+0x60>
+
+	return (char *) (in - 1);
+  801f2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f30:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801f34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f38:	c9                   	leave
+  801f39:	c3                   	ret
+
+0000000000801f3a <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801f3a:	55                   	push   %rbp
+  801f3b:	48 89 e5             	mov    %rsp,%rbp
+  801f3e:	41 57                	push   %r15
+  801f40:	53                   	push   %rbx
+  801f41:	48 83 ec 40          	sub    $0x40,%rsp
+  801f45:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801f45 <syscall+0xb>
+  801f4c:	49 bb 03 71 00 00 00 	movabs $0x7103,%r11
+  801f53:	00 00 00 
+  801f56:	4d 01 da             	add    %r11,%r10
+  801f59:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801f5c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801f5f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801f63:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801f67:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801f6b:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801f6f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f72:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801f76:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f7a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801f7e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801f82:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f86:	4c 89 c3             	mov    %r8,%rbx
+  801f89:	cd 30                	int    $0x30
+  801f8b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801f8f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801f93:	74 52                	je     801fe7 <syscall+0xad>
+  801f95:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f9a:	7e 4b                	jle    801fe7 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f9c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801fa0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801fa3:	49 89 d0             	mov    %rdx,%r8
+  801fa6:	89 c1                	mov    %eax,%ecx
+  801fa8:	48 b8 78 e4 ff ff ff 	movabs $0xffffffffffffe478,%rax
+  801faf:	ff ff ff 
+  801fb2:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801fb6:	48 89 c2             	mov    %rax,%rdx
+  801fb9:	be 23 00 00 00       	mov    $0x23,%esi
+  801fbe:	48 b8 95 e4 ff ff ff 	movabs $0xffffffffffffe495,%rax
+  801fc5:	ff ff ff 
+  801fc8:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801fcc:	48 89 c7             	mov    %rax,%rdi
+  801fcf:	4d 89 d7             	mov    %r10,%r15
+  801fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd7:	49 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%r9
+  801fde:	ff ff ff 
+  801fe1:	4d 01 d1             	add    %r10,%r9
+  801fe4:	41 ff d1             	call   *%r9
+
+	return ret;
+  801fe7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801feb:	48 83 c4 40          	add    $0x40,%rsp
+  801fef:	5b                   	pop    %rbx
+  801ff0:	41 5f                	pop    %r15
+  801ff2:	5d                   	pop    %rbp
+  801ff3:	c3                   	ret
+
+0000000000801ff4 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801ff4:	55                   	push   %rbp
+  801ff5:	48 89 e5             	mov    %rsp,%rbp
+  801ff8:	41 57                	push   %r15
+  801ffa:	41 56                	push   %r14
+  801ffc:	41 55                	push   %r13
+  801ffe:	41 54                	push   %r12
+  802000:	53                   	push   %rbx
+  802001:	48 83 ec 48          	sub    $0x48,%rsp
+  802005:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 802005 <syscall_words+0x11>
+  80200c:	49 bb 43 70 00 00 00 	movabs $0x7043,%r11
+  802013:	00 00 00 
+  802016:	4d 01 de             	add    %r11,%r14
+  802019:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80201c:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  80201f:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802023:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802027:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  80202b:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  80202f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802034:	74 09                	je     80203f <syscall_words+0x4b>
+  802036:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80203a:	48 8b 00             	mov    (%rax),%rax
+  80203d:	eb 05                	jmp    802044 <syscall_words+0x50>
+  80203f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802044:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  802047:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80204c:	74 0a                	je     802058 <syscall_words+0x64>
+  80204e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802052:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802056:	eb 05                	jmp    80205d <syscall_words+0x69>
+  802058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205d:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  802060:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802065:	74 0a                	je     802071 <syscall_words+0x7d>
+  802067:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80206b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80206f:	eb 05                	jmp    802076 <syscall_words+0x82>
+  802071:	b8 00 00 00 00       	mov    $0x0,%eax
+  802076:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  802079:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80207e:	74 0a                	je     80208a <syscall_words+0x96>
+  802080:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802084:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802088:	eb 05                	jmp    80208f <syscall_words+0x9b>
+  80208a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208f:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  802092:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802097:	74 0a                	je     8020a3 <syscall_words+0xaf>
+  802099:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80209d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8020a1:	eb 05                	jmp    8020a8 <syscall_words+0xb4>
+  8020a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a8:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  8020ab:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020b0:	74 0a                	je     8020bc <syscall_words+0xc8>
+  8020b2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020b6:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8020ba:	eb 05                	jmp    8020c1 <syscall_words+0xcd>
+  8020bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c1:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  8020c4:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8020c7:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8020cb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8020cf:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  8020d3:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8020d7:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8020db:	cd 30                	int    $0x30
+  8020dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  8020e1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020e6:	74 50                	je     802138 <syscall_words+0x144>
+		words[0] = r8;
+  8020e8:	4c 89 c2             	mov    %r8,%rdx
+  8020eb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020ef:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  8020f2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020f6:	48 83 c0 08          	add    $0x8,%rax
+  8020fa:	4c 89 ca             	mov    %r9,%rdx
+  8020fd:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802100:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802104:	48 83 c0 10          	add    $0x10,%rax
+  802108:	4c 89 d2             	mov    %r10,%rdx
+  80210b:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  80210e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802112:	48 83 c0 18          	add    $0x18,%rax
+  802116:	4c 89 da             	mov    %r11,%rdx
+  802119:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80211c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802120:	48 83 c0 20          	add    $0x20,%rax
+  802124:	4c 89 e2             	mov    %r12,%rdx
+  802127:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80212a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80212e:	48 83 c0 28          	add    $0x28,%rax
+  802132:	4c 89 ea             	mov    %r13,%rdx
+  802135:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  802138:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80213c:	74 52                	je     802190 <syscall_words+0x19c>
+  80213e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802143:	7e 4b                	jle    802190 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802145:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802149:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80214c:	49 89 d0             	mov    %rdx,%r8
+  80214f:	89 c1                	mov    %eax,%ecx
+  802151:	48 b8 78 e4 ff ff ff 	movabs $0xffffffffffffe478,%rax
+  802158:	ff ff ff 
+  80215b:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80215f:	48 89 c2             	mov    %rax,%rdx
+  802162:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802167:	48 b8 95 e4 ff ff ff 	movabs $0xffffffffffffe495,%rax
+  80216e:	ff ff ff 
+  802171:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802175:	48 89 c7             	mov    %rax,%rdi
+  802178:	4d 89 f7             	mov    %r14,%r15
+  80217b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802180:	49 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%r9
+  802187:	ff ff ff 
+  80218a:	4d 01 f1             	add    %r14,%r9
+  80218d:	41 ff d1             	call   *%r9
+
+	return ret;
+  802190:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802194:	48 83 c4 48          	add    $0x48,%rsp
+  802198:	5b                   	pop    %rbx
+  802199:	41 5c                	pop    %r12
+  80219b:	41 5d                	pop    %r13
+  80219d:	41 5e                	pop    %r14
+  80219f:	41 5f                	pop    %r15
+  8021a1:	5d                   	pop    %rbp
+  8021a2:	c3                   	ret
+
+00000000008021a3 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8021a3:	55                   	push   %rbp
+  8021a4:	48 89 e5             	mov    %rsp,%rbp
+  8021a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021ab <sys_cputs+0x8>
+  8021b2:	49 bb 9d 6e 00 00 00 	movabs $0x6e9d,%r11
+  8021b9:	00 00 00 
+  8021bc:	4c 01 d8             	add    %r11,%rax
+  8021bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8021c3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8021c7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8021cb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8021d3:	6a 00                	push   $0x0
+  8021d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021eb:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  8021f2:	ff ff ff 
+  8021f5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021f9:	ff d0                	call   *%rax
+  8021fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ff:	90                   	nop
+  802200:	c9                   	leave
+  802201:	c3                   	ret
+
+0000000000802202 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802202:	55                   	push   %rbp
+  802203:	48 89 e5             	mov    %rsp,%rbp
+  802206:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802206 <sys_cgetc+0x4>
+  80220d:	49 bb 42 6e 00 00 00 	movabs $0x6e42,%r11
+  802214:	00 00 00 
+  802217:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80221a:	48 83 ec 08          	sub    $0x8,%rsp
+  80221e:	6a 00                	push   $0x0
+  802220:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802226:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80222c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802231:	ba 00 00 00 00       	mov    $0x0,%edx
+  802236:	be 00 00 00 00       	mov    $0x0,%esi
+  80223b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802240:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802247:	ff ff ff 
+  80224a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80224e:	ff d0                	call   *%rax
+  802250:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802254:	c9                   	leave
+  802255:	c3                   	ret
+
+0000000000802256 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802256:	55                   	push   %rbp
+  802257:	48 89 e5             	mov    %rsp,%rbp
+  80225a:	48 83 ec 10          	sub    $0x10,%rsp
+  80225e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80225e <sys_env_destroy+0x8>
+  802265:	49 bb ea 6d 00 00 00 	movabs $0x6dea,%r11
+  80226c:	00 00 00 
+  80226f:	4c 01 d8             	add    %r11,%rax
+  802272:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802275:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802278:	48 63 d2             	movslq %edx,%rdx
+  80227b:	48 83 ec 08          	sub    $0x8,%rsp
+  80227f:	6a 00                	push   $0x0
+  802281:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802287:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80228d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802292:	be 01 00 00 00       	mov    $0x1,%esi
+  802297:	bf 03 00 00 00       	mov    $0x3,%edi
+  80229c:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  8022a3:	ff ff ff 
+  8022a6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022aa:	ff d0                	call   *%rax
+  8022ac:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022b0:	c9                   	leave
+  8022b1:	c3                   	ret
+
+00000000008022b2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8022b2:	55                   	push   %rbp
+  8022b3:	48 89 e5             	mov    %rsp,%rbp
+  8022b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022b6 <sys_getenvid+0x4>
+  8022bd:	49 bb 92 6d 00 00 00 	movabs $0x6d92,%r11
+  8022c4:	00 00 00 
+  8022c7:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8022ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ce:	6a 00                	push   $0x0
+  8022d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022eb:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022f0:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  8022f7:	ff ff ff 
+  8022fa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022fe:	ff d0                	call   *%rax
+  802300:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802304:	c9                   	leave
+  802305:	c3                   	ret
+
+0000000000802306 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802306:	55                   	push   %rbp
+  802307:	48 89 e5             	mov    %rsp,%rbp
+  80230a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80230a <sys_yield+0x4>
+  802311:	49 bb 3e 6d 00 00 00 	movabs $0x6d3e,%r11
+  802318:	00 00 00 
+  80231b:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80231e:	48 83 ec 08          	sub    $0x8,%rsp
+  802322:	6a 00                	push   $0x0
+  802324:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80232a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233a:	be 00 00 00 00       	mov    $0x0,%esi
+  80233f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802344:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  80234b:	ff ff ff 
+  80234e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802352:	ff d0                	call   *%rax
+  802354:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802358:	90                   	nop
+  802359:	c9                   	leave
+  80235a:	c3                   	ret
+
+000000000080235b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80235b:	55                   	push   %rbp
+  80235c:	48 89 e5             	mov    %rsp,%rbp
+  80235f:	48 83 ec 10          	sub    $0x10,%rsp
+  802363:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802363 <sys_page_alloc+0x8>
+  80236a:	49 bb e5 6c 00 00 00 	movabs $0x6ce5,%r11
+  802371:	00 00 00 
+  802374:	4c 01 d8             	add    %r11,%rax
+  802377:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80237a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80237e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802381:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802384:	48 63 f2             	movslq %edx,%rsi
+  802387:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80238b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80238e:	48 63 d2             	movslq %edx,%rdx
+  802391:	48 83 ec 08          	sub    $0x8,%rsp
+  802395:	6a 00                	push   $0x0
+  802397:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80239d:	49 89 f0             	mov    %rsi,%r8
+  8023a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8023a5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023aa:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  8023b1:	ff ff ff 
+  8023b4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023b8:	ff d0                	call   *%rax
+  8023ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023be:	c9                   	leave
+  8023bf:	c3                   	ret
+
+00000000008023c0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8023c0:	55                   	push   %rbp
+  8023c1:	48 89 e5             	mov    %rsp,%rbp
+  8023c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8023c8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023c8 <sys_page_map+0x8>
+  8023cf:	49 bb 80 6c 00 00 00 	movabs $0x6c80,%r11
+  8023d6:	00 00 00 
+  8023d9:	4c 01 d8             	add    %r11,%rax
+  8023dc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023df:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023e3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8023e6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023ea:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8023ee:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8023f1:	48 63 f2             	movslq %edx,%rsi
+  8023f4:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8023f8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023fb:	48 63 fa             	movslq %edx,%rdi
+  8023fe:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802402:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802405:	48 63 d2             	movslq %edx,%rdx
+  802408:	48 83 ec 08          	sub    $0x8,%rsp
+  80240c:	56                   	push   %rsi
+  80240d:	4d 89 c1             	mov    %r8,%r9
+  802410:	49 89 f8             	mov    %rdi,%r8
+  802413:	be 01 00 00 00       	mov    $0x1,%esi
+  802418:	bf 05 00 00 00       	mov    $0x5,%edi
+  80241d:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802424:	ff ff ff 
+  802427:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80242b:	ff d0                	call   *%rax
+  80242d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802431:	c9                   	leave
+  802432:	c3                   	ret
+
+0000000000802433 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802433:	55                   	push   %rbp
+  802434:	48 89 e5             	mov    %rsp,%rbp
+  802437:	48 83 ec 10          	sub    $0x10,%rsp
+  80243b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80243b <sys_page_unmap+0x8>
+  802442:	49 bb 0d 6c 00 00 00 	movabs $0x6c0d,%r11
+  802449:	00 00 00 
+  80244c:	4c 01 d8             	add    %r11,%rax
+  80244f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802452:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802456:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80245a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80245d:	48 63 d2             	movslq %edx,%rdx
+  802460:	48 83 ec 08          	sub    $0x8,%rsp
+  802464:	6a 00                	push   $0x0
+  802466:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80246c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802472:	be 01 00 00 00       	mov    $0x1,%esi
+  802477:	bf 06 00 00 00       	mov    $0x6,%edi
+  80247c:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802483:	ff ff ff 
+  802486:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80248a:	ff d0                	call   *%rax
+  80248c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802490:	c9                   	leave
+  802491:	c3                   	ret
+
+0000000000802492 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802492:	55                   	push   %rbp
+  802493:	48 89 e5             	mov    %rsp,%rbp
+  802496:	48 83 ec 10          	sub    $0x10,%rsp
+  80249a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80249a <sys_env_set_status+0x8>
+  8024a1:	49 bb ae 6b 00 00 00 	movabs $0x6bae,%r11
+  8024a8:	00 00 00 
+  8024ab:	4c 01 d8             	add    %r11,%rax
+  8024ae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024b1:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8024b4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024b7:	48 63 ca             	movslq %edx,%rcx
+  8024ba:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024bd:	48 63 d2             	movslq %edx,%rdx
+  8024c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024c4:	6a 00                	push   $0x0
+  8024c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8024d7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024dc:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  8024e3:	ff ff ff 
+  8024e6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024ea:	ff d0                	call   *%rax
+  8024ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f0:	c9                   	leave
+  8024f1:	c3                   	ret
+
+00000000008024f2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8024f2:	55                   	push   %rbp
+  8024f3:	48 89 e5             	mov    %rsp,%rbp
+  8024f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8024fa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024fa <sys_env_set_trapframe+0x8>
+  802501:	49 bb 4e 6b 00 00 00 	movabs $0x6b4e,%r11
+  802508:	00 00 00 
+  80250b:	4c 01 d8             	add    %r11,%rax
+  80250e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802511:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802515:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802519:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80251c:	48 63 d2             	movslq %edx,%rdx
+  80251f:	48 83 ec 08          	sub    $0x8,%rsp
+  802523:	6a 00                	push   $0x0
+  802525:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80252b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802531:	be 01 00 00 00       	mov    $0x1,%esi
+  802536:	bf 09 00 00 00       	mov    $0x9,%edi
+  80253b:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802542:	ff ff ff 
+  802545:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802549:	ff d0                	call   *%rax
+  80254b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80254f:	c9                   	leave
+  802550:	c3                   	ret
+
+0000000000802551 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802551:	55                   	push   %rbp
+  802552:	48 89 e5             	mov    %rsp,%rbp
+  802555:	48 83 ec 10          	sub    $0x10,%rsp
+  802559:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802559 <sys_env_set_pgfault_upcall+0x8>
+  802560:	49 bb ef 6a 00 00 00 	movabs $0x6aef,%r11
+  802567:	00 00 00 
+  80256a:	4c 01 d8             	add    %r11,%rax
+  80256d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802570:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802574:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802578:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80257b:	48 63 d2             	movslq %edx,%rdx
+  80257e:	48 83 ec 08          	sub    $0x8,%rsp
+  802582:	6a 00                	push   $0x0
+  802584:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80258a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802590:	be 01 00 00 00       	mov    $0x1,%esi
+  802595:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80259a:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  8025a1:	ff ff ff 
+  8025a4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025a8:	ff d0                	call   *%rax
+  8025aa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ae:	c9                   	leave
+  8025af:	c3                   	ret
+
+00000000008025b0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8025b0:	55                   	push   %rbp
+  8025b1:	48 89 e5             	mov    %rsp,%rbp
+  8025b4:	48 83 ec 20          	sub    $0x20,%rsp
+  8025b8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025b8 <sys_ipc_try_send+0x8>
+  8025bf:	49 bb 90 6a 00 00 00 	movabs $0x6a90,%r11
+  8025c6:	00 00 00 
+  8025c9:	4c 01 d8             	add    %r11,%rax
+  8025cc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025d3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025d7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8025da:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025dd:	48 63 fa             	movslq %edx,%rdi
+  8025e0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025e4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025e7:	48 63 d2             	movslq %edx,%rdx
+  8025ea:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f2:	6a 00                	push   $0x0
+  8025f4:	49 89 f9             	mov    %rdi,%r9
+  8025f7:	49 89 f0             	mov    %rsi,%r8
+  8025fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ff:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802604:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  80260b:	ff ff ff 
+  80260e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802612:	ff d0                	call   *%rax
+  802614:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802618:	c9                   	leave
+  802619:	c3                   	ret
+
+000000000080261a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80261a:	55                   	push   %rbp
+  80261b:	48 89 e5             	mov    %rsp,%rbp
+  80261e:	48 83 ec 20          	sub    $0x20,%rsp
+  802622:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802622 <sys_ipc_send+0x8>
+  802629:	49 bb 26 6a 00 00 00 	movabs $0x6a26,%r11
+  802630:	00 00 00 
+  802633:	4c 01 d8             	add    %r11,%rax
+  802636:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802639:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80263d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802641:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802644:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802647:	48 63 fa             	movslq %edx,%rdi
+  80264a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80264e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802651:	48 63 d2             	movslq %edx,%rdx
+  802654:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802658:	48 83 ec 08          	sub    $0x8,%rsp
+  80265c:	6a 00                	push   $0x0
+  80265e:	49 89 f9             	mov    %rdi,%r9
+  802661:	49 89 f0             	mov    %rsi,%r8
+  802664:	be 00 00 00 00       	mov    $0x0,%esi
+  802669:	bf 17 00 00 00       	mov    $0x17,%edi
+  80266e:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802675:	ff ff ff 
+  802678:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80267c:	ff d0                	call   *%rax
+  80267e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802682:	c9                   	leave
+  802683:	c3                   	ret
+
+0000000000802684 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802684:	55                   	push   %rbp
+  802685:	48 89 e5             	mov    %rsp,%rbp
+  802688:	48 83 ec 10          	sub    $0x10,%rsp
+  80268c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80268c <sys_ipc_recv+0x8>
+  802693:	49 bb bc 69 00 00 00 	movabs $0x69bc,%r11
+  80269a:	00 00 00 
+  80269d:	4c 01 d8             	add    %r11,%rax
+  8026a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8026a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026a8:	6a 00                	push   $0x0
+  8026aa:	6a 00                	push   $0x0
+  8026ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8026c2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8026c7:	49 ba ac 8f ff ff ff 	movabs $0xffffffffffff8fac,%r10
+  8026ce:	ff ff ff 
+  8026d1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026d5:	ff d0                	call   *%rax
+  8026d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026db:	c9                   	leave
+  8026dc:	c3                   	ret
+
+00000000008026dd <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8026dd:	55                   	push   %rbp
+  8026de:	48 89 e5             	mov    %rsp,%rbp
+  8026e1:	48 83 ec 30          	sub    $0x30,%rsp
+  8026e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026e5 <sys_ipc_call+0x8>
+  8026ec:	49 bb 63 69 00 00 00 	movabs $0x6963,%r11
+  8026f3:	00 00 00 
+  8026f6:	4c 01 d8             	add    %r11,%rax
+  8026f9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802700:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802704:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802707:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80270b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80270f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802713:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802716:	4c 63 c2             	movslq %edx,%r8
+  802719:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80271d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802720:	48 63 d2             	movslq %edx,%rdx
+  802723:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802727:	ff 75 d8             	push   -0x28(%rbp)
+  80272a:	56                   	push   %rsi
+  80272b:	4d 89 c1             	mov    %r8,%r9
+  80272e:	49 89 f8             	mov    %rdi,%r8
+  802731:	be 00 00 00 00       	mov    $0x0,%esi
+  802736:	bf 18 00 00 00       	mov    $0x18,%edi
+  80273b:	49 ba ac 8f ff ff ff 	movabs $0xffffffffffff8fac,%r10
+  802742:	ff ff ff 
+  802745:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802749:	ff d0                	call   *%rax
+  80274b:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80274f:	c9                   	leave
+  802750:	c3                   	ret
+
+0000000000802751 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802751:	55                   	push   %rbp
+  802752:	48 89 e5             	mov    %rsp,%rbp
+  802755:	48 83 ec 30          	sub    $0x30,%rsp
+  802759:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802759 <sys_ipc_reply_recv+0x8>
+  802760:	49 bb ef 68 00 00 00 	movabs $0x68ef,%r11
+  802767:	00 00 00 
+  80276a:	4c 01 d8             	add    %r11,%rax
+  80276d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802770:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802774:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802778:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80277b:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80277f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802783:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802787:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80278a:	4c 63 c2             	movslq %edx,%r8
+  80278d:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802791:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802794:	48 63 d2             	movslq %edx,%rdx
+  802797:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80279b:	ff 75 d8             	push   -0x28(%rbp)
+  80279e:	56                   	push   %rsi
+  80279f:	4d 89 c1             	mov    %r8,%r9
+  8027a2:	49 89 f8             	mov    %rdi,%r8
+  8027a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8027aa:	bf 19 00 00 00       	mov    $0x19,%edi
+  8027af:	49 ba ac 8f ff ff ff 	movabs $0xffffffffffff8fac,%r10
+  8027b6:	ff ff ff 
+  8027b9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027bd:	ff d0                	call   *%rax
+  8027bf:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8027c3:	c9                   	leave
+  8027c4:	c3                   	ret
+
+00000000008027c5 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8027c5:	55                   	push   %rbp
+  8027c6:	48 89 e5             	mov    %rsp,%rbp
+  8027c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8027cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027cd <sys_env_set_priority+0x8>
+  8027d4:	49 bb 7b 68 00 00 00 	movabs $0x687b,%r11
+  8027db:	00 00 00 
+  8027de:	4c 01 d8             	add    %r11,%rax
+  8027e1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027e4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8027e7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027ea:	48 63 ca             	movslq %edx,%rcx
+  8027ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027f0:	48 63 d2             	movslq %edx,%rdx
+  8027f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f7:	6a 00                	push   $0x0
+  8027f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802805:	be 01 00 00 00       	mov    $0x1,%esi
+  80280a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80280f:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802816:	ff ff ff 
+  802819:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80281d:	ff d0                	call   *%rax
+  80281f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802823:	c9                   	leave
+  802824:	c3                   	ret
+
+0000000000802825 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802825:	55                   	push   %rbp
+  802826:	48 89 e5             	mov    %rsp,%rbp
+  802829:	48 83 ec 10          	sub    $0x10,%rsp
+  80282d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80282d <sys_env_set_affinity+0x8>
+  802834:	49 bb 1b 68 00 00 00 	movabs $0x681b,%r11
+  80283b:	00 00 00 
+  80283e:	4c 01 d8             	add    %r11,%rax
+  802841:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802844:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802847:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  80284a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80284d:	48 63 d2             	movslq %edx,%rdx
+  802850:	48 83 ec 08          	sub    $0x8,%rsp
+  802854:	6a 00                	push   $0x0
+  802856:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80285c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802862:	be 01 00 00 00       	mov    $0x1,%esi
+  802867:	bf 10 00 00 00       	mov    $0x10,%edi
+  80286c:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802873:	ff ff ff 
+  802876:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80287a:	ff d0                	call   *%rax
+  80287c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802880:	c9                   	leave
+  802881:	c3                   	ret
+
+0000000000802882 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802882:	55                   	push   %rbp
+  802883:	48 89 e5             	mov    %rsp,%rbp
+  802886:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802886 <sys_time_msec+0x4>
+  80288d:	49 bb c2 67 00 00 00 	movabs $0x67c2,%r11
+  802894:	00 00 00 
+  802897:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80289a:	48 83 ec 08          	sub    $0x8,%rsp
+  80289e:	6a 00                	push   $0x0
+  8028a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8028bb:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8028c0:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  8028c7:	ff ff ff 
+  8028ca:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028ce:	ff d0                	call   *%rax
+  8028d0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028d4:	c9                   	leave
+  8028d5:	c3                   	ret
+
+00000000008028d6 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8028d6:	55                   	push   %rbp
+  8028d7:	48 89 e5             	mov    %rsp,%rbp
+  8028da:	48 83 ec 10          	sub    $0x10,%rsp
+  8028de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028de <sys_sleep_usec+0x8>
+  8028e5:	49 bb 6a 67 00 00 00 	movabs $0x676a,%r11
+  8028ec:	00 00 00 
+  8028ef:	4c 01 d8             	add    %r11,%rax
+  8028f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8028f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8028fe:	6a 00                	push   $0x0
+  802900:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802906:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80290c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802911:	be 00 00 00 00       	mov    $0x0,%esi
+  802916:	bf 11 00 00 00       	mov    $0x11,%edi
+  80291b:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802922:	ff ff ff 
+  802925:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802929:	ff d0                	call   *%rax
+  80292b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80292f:	c9                   	leave
+  802930:	c3                   	ret
+
+0000000000802931 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802931:	55                   	push   %rbp
+  802932:	48 89 e5             	mov    %rsp,%rbp
+  802935:	48 83 ec 10          	sub    $0x10,%rsp
+  802939:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802939 <sys_page_alloc_huge+0x8>
+  802940:	49 bb 0f 67 00 00 00 	movabs $0x670f,%r11
+  802947:	00 00 00 
+  80294a:	4c 01 d8             	add    %r11,%rax
+  80294d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802950:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802954:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802957:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80295a:	48 63 f2             	movslq %edx,%rsi
+  80295d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802961:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802964:	48 63 d2             	movslq %edx,%rdx
+  802967:	48 83 ec 08          	sub    $0x8,%rsp
+  80296b:	6a 00                	push   $0x0
+  80296d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802973:	49 89 f0             	mov    %rsi,%r8
+  802976:	be 01 00 00 00       	mov    $0x1,%esi
+  80297b:	bf 12 00 00 00       	mov    $0x12,%edi
+  802980:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802987:	ff ff ff 
+  80298a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80298e:	ff d0                	call   *%rax
+  802990:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802994:	c9                   	leave
+  802995:	c3                   	ret
+
+0000000000802996 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802996:	55                   	push   %rbp
+  802997:	48 89 e5             	mov    %rsp,%rbp
+  80299a:	48 83 ec 10          	sub    $0x10,%rsp
+  80299e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80299e <sys_page_map_batch+0x8>
+  8029a5:	49 bb aa 66 00 00 00 	movabs $0x66aa,%r11
+  8029ac:	00 00 00 
+  8029af:	4c 01 d8             	add    %r11,%rax
+  8029b2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029b6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8029ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029be:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c6:	6a 00                	push   $0x0
+  8029c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029d4:	be 01 00 00 00       	mov    $0x1,%esi
+  8029d9:	bf 13 00 00 00       	mov    $0x13,%edi
+  8029de:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  8029e5:	ff ff ff 
+  8029e8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029ec:	ff d0                	call   *%rax
+  8029ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029f2:	c9                   	leave
+  8029f3:	c3                   	ret
+
+00000000008029f4 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8029f4:	55                   	push   %rbp
+  8029f5:	48 89 e5             	mov    %rsp,%rbp
+  8029f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8029fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029fc <sys_page_alloc_batch+0x8>
+  802a03:	49 bb 4c 66 00 00 00 	movabs $0x664c,%r11
+  802a0a:	00 00 00 
+  802a0d:	4c 01 d8             	add    %r11,%rax
+  802a10:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a14:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802a18:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a1c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a20:	48 83 ec 08          	sub    $0x8,%rsp
+  802a24:	6a 00                	push   $0x0
+  802a26:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a32:	be 01 00 00 00       	mov    $0x1,%esi
+  802a37:	bf 14 00 00 00       	mov    $0x14,%edi
+  802a3c:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802a43:	ff ff ff 
+  802a46:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a4a:	ff d0                	call   *%rax
+  802a4c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a50:	c9                   	leave
+  802a51:	c3                   	ret
+
+0000000000802a52 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802a52:	55                   	push   %rbp
+  802a53:	48 89 e5             	mov    %rsp,%rbp
+  802a56:	48 83 ec 10          	sub    $0x10,%rsp
+  802a5a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a5a <sys_page_unmap_batch+0x8>
+  802a61:	49 bb ee 65 00 00 00 	movabs $0x65ee,%r11
+  802a68:	00 00 00 
+  802a6b:	4c 01 d8             	add    %r11,%rax
+  802a6e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a72:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802a76:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a7a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a7e:	48 83 ec 08          	sub    $0x8,%rsp
+  802a82:	6a 00                	push   $0x0
+  802a84:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a8a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a90:	be 01 00 00 00       	mov    $0x1,%esi
+  802a95:	bf 15 00 00 00       	mov    $0x15,%edi
+  802a9a:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802aa1:	ff ff ff 
+  802aa4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802aa8:	ff d0                	call   *%rax
+  802aaa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aae:	c9                   	leave
+  802aaf:	c3                   	ret
+
+0000000000802ab0 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802ab0:	55                   	push   %rbp
+  802ab1:	48 89 e5             	mov    %rsp,%rbp
+  802ab4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ab4 <sys_fork+0x4>
+  802abb:	49 bb 94 65 00 00 00 	movabs $0x6594,%r11
+  802ac2:	00 00 00 
+  802ac5:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802ac8:	48 83 ec 08          	sub    $0x8,%rsp
+  802acc:	6a 00                	push   $0x0
+  802ace:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ad4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ada:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802adf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ae9:	bf 16 00 00 00       	mov    $0x16,%edi
+  802aee:	49 ba f2 8e ff ff ff 	movabs $0xffffffffffff8ef2,%r10
+  802af5:	ff ff ff 
+  802af8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802afc:	ff d0                	call   *%rax
+  802afe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b02:	c9                   	leave
+  802b03:	c3                   	ret
+
+0000000000802b04 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802b04:	55                   	push   %rbp
+  802b05:	48 89 e5             	mov    %rsp,%rbp
+  802b08:	41 57                	push   %r15
+  802b0a:	53                   	push   %rbx
+  802b0b:	48 83 ec 40          	sub    $0x40,%rsp
+  802b0f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b0f <pgfault+0xb>
+  802b16:	49 bb 39 65 00 00 00 	movabs $0x6539,%r11
+  802b1d:	00 00 00 
+  802b20:	4c 01 db             	add    %r11,%rbx
+  802b23:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802b27:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b2b:	48 8b 00             	mov    (%rax),%rax
+  802b2e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802b32:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b36:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b3a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802b3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b41:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802b45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b49:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b4f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802b53:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802b56:	83 e0 02             	and    $0x2,%eax
+  802b59:	85 c0                	test   %eax,%eax
+  802b5b:	0f 84 91 03 00 00    	je     802ef2 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802b61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b65:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802b69:	48 89 c2             	mov    %rax,%rdx
+  802b6c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802b73:	ff ff ff 
+  802b76:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b7a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b7e:	83 e0 01             	and    $0x1,%eax
+  802b81:	48 85 c0             	test   %rax,%rax
+  802b84:	0f 84 a7 01 00 00    	je     802d31 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802b8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b8e:	48 c1 e8 15          	shr    $0x15,%rax
+  802b92:	48 89 c2             	mov    %rax,%rdx
+  802b95:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802b9c:	ff ff ff 
+  802b9f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ba3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ba7:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802bac:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802bb2:	0f 85 79 01 00 00    	jne    802d31 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802bb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bbc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802bc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bc4:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802bca:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802bce:	ba 07 00 00 00       	mov    $0x7,%edx
+  802bd3:	be 00 00 60 00       	mov    $0x600000,%esi
+  802bd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bdd:	49 89 df             	mov    %rbx,%r15
+  802be0:	48 b8 e9 98 ff ff ff 	movabs $0xffffffffffff98e9,%rax
+  802be7:	ff ff ff 
+  802bea:	48 01 d8             	add    %rbx,%rax
+  802bed:	ff d0                	call   *%rax
+  802bef:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802bf2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802bf6:	79 44                	jns    802c3c <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802bf8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802bfb:	89 c1                	mov    %eax,%ecx
+  802bfd:	48 b8 a8 e4 ff ff ff 	movabs $0xffffffffffffe4a8,%rax
+  802c04:	ff ff ff 
+  802c07:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c0b:	48 89 c2             	mov    %rax,%rdx
+  802c0e:	be 20 00 00 00       	mov    $0x20,%esi
+  802c13:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  802c1a:	ff ff ff 
+  802c1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c21:	48 89 c7             	mov    %rax,%rdi
+  802c24:	49 89 df             	mov    %rbx,%r15
+  802c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2c:	49 b8 be 75 ff ff ff 	movabs $0xffffffffffff75be,%r8
+  802c33:	ff ff ff 
+  802c36:	49 01 d8             	add    %rbx,%r8
+  802c39:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802c3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c40:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802c45:	48 89 c6             	mov    %rax,%rsi
+  802c48:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802c4d:	49 89 df             	mov    %rbx,%r15
+  802c50:	48 b8 62 8b ff ff ff 	movabs $0xffffffffffff8b62,%rax
+  802c57:	ff ff ff 
+  802c5a:	48 01 d8             	add    %rbx,%rax
+  802c5d:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802c5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c63:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c69:	48 89 c1             	mov    %rax,%rcx
+  802c6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c71:	be 00 00 60 00       	mov    $0x600000,%esi
+  802c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c7b:	49 89 df             	mov    %rbx,%r15
+  802c7e:	48 b8 78 93 ff ff ff 	movabs $0xffffffffffff9378,%rax
+  802c85:	ff ff ff 
+  802c88:	48 01 d8             	add    %rbx,%rax
+  802c8b:	ff d0                	call   *%rax
+  802c8d:	85 c0                	test   %eax,%eax
+  802c8f:	74 3e                	je     802ccf <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802c91:	48 b8 d3 e4 ff ff ff 	movabs $0xffffffffffffe4d3,%rax
+  802c98:	ff ff ff 
+  802c9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c9f:	48 89 c2             	mov    %rax,%rdx
+  802ca2:	be 23 00 00 00       	mov    $0x23,%esi
+  802ca7:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  802cae:	ff ff ff 
+  802cb1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cb5:	48 89 c7             	mov    %rax,%rdi
+  802cb8:	49 89 df             	mov    %rbx,%r15
+  802cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc0:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  802cc7:	ff ff ff 
+  802cca:	48 01 d9             	add    %rbx,%rcx
+  802ccd:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802ccf:	be 00 00 60 00       	mov    $0x600000,%esi
+  802cd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd9:	49 89 df             	mov    %rbx,%r15
+  802cdc:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  802ce3:	ff ff ff 
+  802ce6:	48 01 d8             	add    %rbx,%rax
+  802ce9:	ff d0                	call   *%rax
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	0f 84 3d 02 00 00    	je     802f30 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802cf3:	48 b8 e8 e4 ff ff ff 	movabs $0xffffffffffffe4e8,%rax
+  802cfa:	ff ff ff 
+  802cfd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d01:	48 89 c2             	mov    %rax,%rdx
+  802d04:	be 25 00 00 00       	mov    $0x25,%esi
+  802d09:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  802d10:	ff ff ff 
+  802d13:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d17:	48 89 c7             	mov    %rax,%rdi
+  802d1a:	49 89 df             	mov    %rbx,%r15
+  802d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d22:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  802d29:	ff ff ff 
+  802d2c:	48 01 d9             	add    %rbx,%rcx
+  802d2f:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802d31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d35:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d39:	48 89 c2             	mov    %rax,%rdx
+  802d3c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d43:	ff ff ff 
+  802d46:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d4a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d4e:	25 00 08 00 00       	and    $0x800,%eax
+  802d53:	48 85 c0             	test   %rax,%rax
+  802d56:	0f 84 58 01 00 00    	je     802eb4 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802d5c:	ba 07 00 00 00       	mov    $0x7,%edx
+  802d61:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802d66:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6b:	49 89 df             	mov    %rbx,%r15
+  802d6e:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  802d75:	ff ff ff 
+  802d78:	48 01 d8             	add    %rbx,%rax
+  802d7b:	ff d0                	call   *%rax
+  802d7d:	85 c0                	test   %eax,%eax
+  802d7f:	74 3e                	je     802dbf <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802d81:	48 b8 ff e4 ff ff ff 	movabs $0xffffffffffffe4ff,%rax
+  802d88:	ff ff ff 
+  802d8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d8f:	48 89 c2             	mov    %rax,%rdx
+  802d92:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802d97:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  802d9e:	ff ff ff 
+  802da1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802da5:	48 89 c7             	mov    %rax,%rdi
+  802da8:	49 89 df             	mov    %rbx,%r15
+  802dab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db0:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  802db7:	ff ff ff 
+  802dba:	48 01 d9             	add    %rbx,%rcx
+  802dbd:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802dbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dc3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802dc8:	48 89 c6             	mov    %rax,%rsi
+  802dcb:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802dd0:	49 89 df             	mov    %rbx,%r15
+  802dd3:	48 b8 62 8b ff ff ff 	movabs $0xffffffffffff8b62,%rax
+  802dda:	ff ff ff 
+  802ddd:	48 01 d8             	add    %rbx,%rax
+  802de0:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802de2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802de6:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802dec:	48 89 c1             	mov    %rax,%rcx
+  802def:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df4:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802df9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dfe:	49 89 df             	mov    %rbx,%r15
+  802e01:	48 b8 78 93 ff ff ff 	movabs $0xffffffffffff9378,%rax
+  802e08:	ff ff ff 
+  802e0b:	48 01 d8             	add    %rbx,%rax
+  802e0e:	ff d0                	call   *%rax
+  802e10:	85 c0                	test   %eax,%eax
+  802e12:	74 3e                	je     802e52 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802e14:	48 b8 d3 e4 ff ff ff 	movabs $0xffffffffffffe4d3,%rax
+  802e1b:	ff ff ff 
+  802e1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e22:	48 89 c2             	mov    %rax,%rdx
+  802e25:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802e2a:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  802e31:	ff ff ff 
+  802e34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e38:	48 89 c7             	mov    %rax,%rdi
+  802e3b:	49 89 df             	mov    %rbx,%r15
+  802e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e43:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  802e4a:	ff ff ff 
+  802e4d:	48 01 d9             	add    %rbx,%rcx
+  802e50:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802e52:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802e57:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e5c:	49 89 df             	mov    %rbx,%r15
+  802e5f:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  802e66:	ff ff ff 
+  802e69:	48 01 d8             	add    %rbx,%rax
+  802e6c:	ff d0                	call   *%rax
+  802e6e:	85 c0                	test   %eax,%eax
+  802e70:	0f 84 bb 00 00 00    	je     802f31 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802e76:	48 b8 e8 e4 ff ff ff 	movabs $0xffffffffffffe4e8,%rax
+  802e7d:	ff ff ff 
+  802e80:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e84:	48 89 c2             	mov    %rax,%rdx
+  802e87:	be 32 00 00 00       	mov    $0x32,%esi
+  802e8c:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  802e93:	ff ff ff 
+  802e96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e9a:	48 89 c7             	mov    %rax,%rdi
+  802e9d:	49 89 df             	mov    %rbx,%r15
+  802ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea5:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  802eac:	ff ff ff 
+  802eaf:	48 01 d9             	add    %rbx,%rcx
+  802eb2:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802eb4:	48 b8 18 e5 ff ff ff 	movabs $0xffffffffffffe518,%rax
+  802ebb:	ff ff ff 
+  802ebe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ec2:	48 89 c2             	mov    %rax,%rdx
+  802ec5:	be 36 00 00 00       	mov    $0x36,%esi
+  802eca:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  802ed1:	ff ff ff 
+  802ed4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ed8:	48 89 c7             	mov    %rax,%rdi
+  802edb:	49 89 df             	mov    %rbx,%r15
+  802ede:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee3:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  802eea:	ff ff ff 
+  802eed:	48 01 d9             	add    %rbx,%rcx
+  802ef0:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802ef2:	48 b8 37 e5 ff ff ff 	movabs $0xffffffffffffe537,%rax
+  802ef9:	ff ff ff 
+  802efc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f00:	48 89 c2             	mov    %rax,%rdx
+  802f03:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802f08:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  802f0f:	ff ff ff 
+  802f12:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f16:	48 89 c7             	mov    %rax,%rdi
+  802f19:	49 89 df             	mov    %rbx,%r15
+  802f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f21:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  802f28:	ff ff ff 
+  802f2b:	48 01 d9             	add    %rbx,%rcx
+  802f2e:	ff d1                	call   *%rcx
+			return;
+  802f30:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802f31:	48 83 c4 40          	add    $0x40,%rsp
+  802f35:	5b                   	pop    %rbx
+  802f36:	41 5f                	pop    %r15
+  802f38:	5d                   	pop    %rbp
+  802f39:	c3                   	ret
+
+0000000000802f3a <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802f3a:	55                   	push   %rbp
+  802f3b:	48 89 e5             	mov    %rsp,%rbp
+  802f3e:	41 57                	push   %r15
+  802f40:	53                   	push   %rbx
+  802f41:	48 83 ec 10          	sub    $0x10,%rsp
+  802f45:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f45 <fork_flush+0xb>
+  802f4c:	49 bb 03 61 00 00 00 	movabs $0x6103,%r11
+  802f53:	00 00 00 
+  802f56:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802f59:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  802f60:	00 00 00 
+  802f63:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f67:	48 85 c0             	test   %rax,%rax
+  802f6a:	0f 84 81 00 00 00    	je     802ff1 <fork_flush+0xb7>
+  802f70:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  802f77:	00 00 00 
+  802f7a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f7e:	48 89 c6             	mov    %rax,%rsi
+  802f81:	48 b8 d8 0f 00 00 00 	movabs $0xfd8,%rax
+  802f88:	00 00 00 
+  802f8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f8f:	48 89 c7             	mov    %rax,%rdi
+  802f92:	49 89 df             	mov    %rbx,%r15
+  802f95:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  802f9c:	ff ff ff 
+  802f9f:	48 01 d8             	add    %rbx,%rax
+  802fa2:	ff d0                	call   *%rax
+  802fa4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fa7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fab:	79 44                	jns    802ff1 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802fad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fb0:	89 c1                	mov    %eax,%ecx
+  802fb2:	48 b8 50 e5 ff ff ff 	movabs $0xffffffffffffe550,%rax
+  802fb9:	ff ff ff 
+  802fbc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fc0:	48 89 c2             	mov    %rax,%rdx
+  802fc3:	be 56 00 00 00       	mov    $0x56,%esi
+  802fc8:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  802fcf:	ff ff ff 
+  802fd2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fd6:	48 89 c7             	mov    %rax,%rdi
+  802fd9:	49 89 df             	mov    %rbx,%r15
+  802fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe1:	49 b8 be 75 ff ff ff 	movabs $0xffffffffffff75be,%r8
+  802fe8:	ff ff ff 
+  802feb:	49 01 d8             	add    %rbx,%r8
+  802fee:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802ff1:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  802ff8:	00 00 00 
+  802ffb:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803002:	00 
+}
+  803003:	90                   	nop
+  803004:	48 83 c4 10          	add    $0x10,%rsp
+  803008:	5b                   	pop    %rbx
+  803009:	41 5f                	pop    %r15
+  80300b:	5d                   	pop    %rbp
+  80300c:	c3                   	ret
+
+000000000080300d <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  80300d:	55                   	push   %rbp
+  80300e:	48 89 e5             	mov    %rsp,%rbp
+  803011:	53                   	push   %rbx
+  803012:	48 83 ec 28          	sub    $0x28,%rsp
+  803016:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803016 <fork_map+0x9>
+  80301d:	49 bb 32 60 00 00 00 	movabs $0x6032,%r11
+  803024:	00 00 00 
+  803027:	4c 01 db             	add    %r11,%rbx
+  80302a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80302d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803031:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  803034:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  80303b:	00 00 00 
+  80303e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803042:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  803048:	75 10                	jne    80305a <fork_map+0x4d>
+		fork_flush();
+  80304a:	48 b8 f2 9e ff ff ff 	movabs $0xffffffffffff9ef2,%rax
+  803051:	ff ff ff 
+  803054:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803058:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  80305a:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  803061:	00 00 00 
+  803064:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803068:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80306c:	48 b9 d8 1f 00 00 00 	movabs $0x1fd8,%rcx
+  803073:	00 00 00 
+  803076:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  80307a:	48 c1 e0 05          	shl    $0x5,%rax
+  80307e:	48 89 c2             	mov    %rax,%rdx
+  803081:	48 b8 d8 0f 00 00 00 	movabs $0xfd8,%rax
+  803088:	00 00 00 
+  80308b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80308f:	48 01 d0             	add    %rdx,%rax
+  803092:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  803096:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80309a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  8030a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030a4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8030a8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  8030ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030b0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8030b3:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  8030b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030ba:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8030be:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  8030c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030c6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030c9:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  8030cc:	90                   	nop
+  8030cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030d1:	c9                   	leave
+  8030d2:	c3                   	ret
+
+00000000008030d3 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  8030d3:	55                   	push   %rbp
+  8030d4:	48 89 e5             	mov    %rsp,%rbp
+  8030d7:	53                   	push   %rbx
+  8030d8:	48 83 ec 28          	sub    $0x28,%rsp
+  8030dc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030dc <duppage+0x9>
+  8030e3:	49 bb 6c 5f 00 00 00 	movabs $0x5f6c,%r11
+  8030ea:	00 00 00 
+  8030ed:	4c 01 db             	add    %r11,%rbx
+  8030f0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030f3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  8030f6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8030f9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030fd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  803101:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803108:	ff ff ff 
+  80310b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80310f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803112:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803116:	25 00 04 00 00       	and    $0x400,%eax
+  80311b:	48 85 c0             	test   %rax,%rax
+  80311e:	74 42                	je     803162 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  803120:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803127:	ff ff ff 
+  80312a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80312e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803131:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803135:	25 07 0e 00 00       	and    $0xe07,%eax
+  80313a:	89 c2                	mov    %eax,%edx
+  80313c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803140:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803143:	48 89 ce             	mov    %rcx,%rsi
+  803146:	89 c7                	mov    %eax,%edi
+  803148:	48 b8 c5 9f ff ff ff 	movabs $0xffffffffffff9fc5,%rax
+  80314f:	ff ff ff 
+  803152:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803156:	ff d0                	call   *%rax
+		return 0;
+  803158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315d:	e9 ae 00 00 00       	jmp    803210 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  803162:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803169:	ff ff ff 
+  80316c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803170:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803173:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803177:	83 e0 02             	and    $0x2,%eax
+  80317a:	48 85 c0             	test   %rax,%rax
+  80317d:	75 1f                	jne    80319e <duppage+0xcb>
+  80317f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803186:	ff ff ff 
+  803189:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80318d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803190:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803194:	25 00 08 00 00       	and    $0x800,%eax
+  803199:	48 85 c0             	test   %rax,%rax
+  80319c:	74 4c                	je     8031ea <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  80319e:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  8031a5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8031a8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8031ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031af:	48 89 ce             	mov    %rcx,%rsi
+  8031b2:	89 c7                	mov    %eax,%edi
+  8031b4:	48 b8 c5 9f ff ff ff 	movabs $0xffffffffffff9fc5,%rax
+  8031bb:	ff ff ff 
+  8031be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031c2:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  8031c4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8031c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031cb:	48 89 c6             	mov    %rax,%rsi
+  8031ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d3:	48 b8 c5 9f ff ff ff 	movabs $0xffffffffffff9fc5,%rax
+  8031da:	ff ff ff 
+  8031dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031e1:	ff d0                	call   *%rax
+		return 0;
+  8031e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e8:	eb 26                	jmp    803210 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  8031ea:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8031ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031f1:	ba 05 00 00 00       	mov    $0x5,%edx
+  8031f6:	48 89 ce             	mov    %rcx,%rsi
+  8031f9:	89 c7                	mov    %eax,%edi
+  8031fb:	48 b8 c5 9f ff ff ff 	movabs $0xffffffffffff9fc5,%rax
+  803202:	ff ff ff 
+  803205:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803209:	ff d0                	call   *%rax
+		return 0;
+  80320b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803210:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803214:	c9                   	leave
+  803215:	c3                   	ret
+
+0000000000803216 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  803216:	55                   	push   %rbp
+  803217:	48 89 e5             	mov    %rsp,%rbp
+  80321a:	53                   	push   %rbx
+  80321b:	48 83 ec 28          	sub    $0x28,%rsp
+  80321f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80321f <duphuge+0x9>
+  803226:	49 bb 29 5e 00 00 00 	movabs $0x5e29,%r11
+  80322d:	00 00 00 
+  803230:	4c 01 db             	add    %r11,%rbx
+  803233:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803236:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  80323a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80323e:	48 c1 e8 15          	shr    $0x15,%rax
+  803242:	48 89 c2             	mov    %rax,%rdx
+  803245:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80324c:	ff ff ff 
+  80324f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803253:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803257:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  80325b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80325f:	25 00 04 00 00       	and    $0x400,%eax
+  803264:	48 85 c0             	test   %rax,%rax
+  803267:	74 0e                	je     803277 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  803269:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80326d:	25 07 0e 00 00       	and    $0xe07,%eax
+  803272:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803275:	eb 1e                	jmp    803295 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  803277:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80327b:	25 02 08 00 00       	and    $0x802,%eax
+  803280:	48 85 c0             	test   %rax,%rax
+  803283:	74 09                	je     80328e <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  803285:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  80328c:	eb 07                	jmp    803295 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  80328e:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  803295:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803298:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80329c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80329f:	48 89 ce             	mov    %rcx,%rsi
+  8032a2:	89 c7                	mov    %eax,%edi
+  8032a4:	48 b8 c5 9f ff ff ff 	movabs $0xffffffffffff9fc5,%rax
+  8032ab:	ff ff ff 
+  8032ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032b2:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  8032b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032b7:	25 00 08 00 00       	and    $0x800,%eax
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	74 1f                	je     8032df <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  8032c0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032c7:	48 89 c6             	mov    %rax,%rsi
+  8032ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032cf:	48 b8 c5 9f ff ff ff 	movabs $0xffffffffffff9fc5,%rax
+  8032d6:	ff ff ff 
+  8032d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032dd:	ff d0                	call   *%rax
+	return 0;
+  8032df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032e8:	c9                   	leave
+  8032e9:	c3                   	ret
+
+00000000008032ea <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8032ea:	55                   	push   %rbp
+  8032eb:	48 89 e5             	mov    %rsp,%rbp
+  8032ee:	41 57                	push   %r15
+  8032f0:	53                   	push   %rbx
+  8032f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8032f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032f5 <fork+0xb>
+  8032fc:	49 bb 53 5d 00 00 00 	movabs $0x5d53,%r11
+  803303:	00 00 00 
+  803306:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  803309:	49 89 df             	mov    %rbx,%r15
+  80330c:	48 b8 68 9a ff ff ff 	movabs $0xffffffffffff9a68,%rax
+  803313:	ff ff ff 
+  803316:	48 01 d8             	add    %rbx,%rax
+  803319:	ff d0                	call   *%rax
+  80331b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80331e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803322:	75 42                	jne    803366 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803324:	49 89 df             	mov    %rbx,%r15
+  803327:	48 b8 6a 92 ff ff ff 	movabs $0xffffffffffff926a,%rax
+  80332e:	ff ff ff 
+  803331:	48 01 d8             	add    %rbx,%rax
+  803334:	ff d0                	call   *%rax
+  803336:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80333b:	48 98                	cltq
+  80333d:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803344:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80334b:	ff ff ff 
+  80334e:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803352:	48 01 c2             	add    %rax,%rdx
+  803355:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80335c:	ff ff ff 
+  80335f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803363:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  803366:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803369:	48 83 c4 10          	add    $0x10,%rsp
+  80336d:	5b                   	pop    %rbx
+  80336e:	41 5f                	pop    %r15
+  803370:	5d                   	pop    %rbp
+  803371:	c3                   	ret
+
+0000000000803372 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  803372:	55                   	push   %rbp
+  803373:	48 89 e5             	mov    %rsp,%rbp
+  803376:	41 57                	push   %r15
+  803378:	53                   	push   %rbx
+  803379:	48 83 ec 10          	sub    $0x10,%rsp
+  80337d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80337d <ufork+0xb>
+  803384:	49 bb cb 5c 00 00 00 	movabs $0x5ccb,%r11
+  80338b:	00 00 00 
+  80338e:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  803391:	48 b8 bc 9a ff ff ff 	movabs $0xffffffffffff9abc,%rax
+  803398:	ff ff ff 
+  80339b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80339f:	48 89 c7             	mov    %rax,%rdi
+  8033a2:	49 89 df             	mov    %rbx,%r15
+  8033a5:	48 b8 1d dd ff ff ff 	movabs $0xffffffffffffdd1d,%rax
+  8033ac:	ff ff ff 
+  8033af:	48 01 d8             	add    %rbx,%rax
+  8033b2:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8033b4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8033b9:	cd 30                	int    $0x30
+  8033bb:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8033be:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  8033c1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  8033c4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8033c8:	0f 84 03 02 00 00    	je     8035d1 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  8033ce:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8033d5:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  8033d6:	e9 28 01 00 00       	jmp    803503 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  8033db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033df:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033e3:	48 89 c2             	mov    %rax,%rdx
+  8033e6:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8033ed:	ff ff ff 
+  8033f0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033f4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033f8:	83 e0 01             	and    $0x1,%eax
+  8033fb:	48 85 c0             	test   %rax,%rax
+  8033fe:	0f 84 f7 00 00 00    	je     8034fb <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803404:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803408:	48 c1 e8 15          	shr    $0x15,%rax
+  80340c:	48 89 c2             	mov    %rax,%rdx
+  80340f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803416:	ff ff ff 
+  803419:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80341d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803421:	25 81 00 00 00       	and    $0x81,%eax
+  803426:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  80342c:	75 29                	jne    803457 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  80342e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803432:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803435:	48 89 d6             	mov    %rdx,%rsi
+  803438:	89 c7                	mov    %eax,%edi
+  80343a:	48 b8 ce a1 ff ff ff 	movabs $0xffffffffffffa1ce,%rax
+  803441:	ff ff ff 
+  803444:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803448:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  80344a:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803451:	00 
+  803452:	e9 ac 00 00 00       	jmp    803503 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  803457:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80345b:	48 c1 e8 15          	shr    $0x15,%rax
+  80345f:	48 89 c2             	mov    %rax,%rdx
+  803462:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803469:	ff ff ff 
+  80346c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803470:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803474:	83 e0 01             	and    $0x1,%eax
+  803477:	48 85 c0             	test   %rax,%rax
+  80347a:	74 75                	je     8034f1 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  80347c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803480:	48 c1 e8 0c          	shr    $0xc,%rax
+  803484:	48 89 c2             	mov    %rax,%rdx
+  803487:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80348e:	ff ff ff 
+  803491:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803495:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803499:	83 e0 01             	and    $0x1,%eax
+  80349c:	48 85 c0             	test   %rax,%rax
+  80349f:	74 46                	je     8034e7 <ufork+0x175>
+  8034a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034a5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034a9:	48 89 c2             	mov    %rax,%rdx
+  8034ac:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8034b3:	ff ff ff 
+  8034b6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034ba:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034be:	83 e0 04             	and    $0x4,%eax
+  8034c1:	48 85 c0             	test   %rax,%rax
+  8034c4:	74 21                	je     8034e7 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  8034c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034ca:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034ce:	89 c2                	mov    %eax,%edx
+  8034d0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8034d3:	89 d6                	mov    %edx,%esi
+  8034d5:	89 c7                	mov    %eax,%edi
+  8034d7:	48 b8 8b a0 ff ff ff 	movabs $0xffffffffffffa08b,%rax
+  8034de:	ff ff ff 
+  8034e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034e5:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  8034e7:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8034ee:	00 
+  8034ef:	eb 12                	jmp    803503 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  8034f1:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8034f8:	00 
+  8034f9:	eb 08                	jmp    803503 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  8034fb:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803502:	40 
+		for (; addr < USTACKTOP;){
+  803503:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803508:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80350c:	0f 83 c9 fe ff ff    	jae    8033db <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803512:	48 b8 f2 9e ff ff ff 	movabs $0xffffffffffff9ef2,%rax
+  803519:	ff ff ff 
+  80351c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803520:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803522:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803525:	ba 07 00 00 00       	mov    $0x7,%edx
+  80352a:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80352f:	48 89 ce             	mov    %rcx,%rsi
+  803532:	89 c7                	mov    %eax,%edi
+  803534:	49 89 df             	mov    %rbx,%r15
+  803537:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  80353e:	ff ff ff 
+  803541:	48 01 d8             	add    %rbx,%rax
+  803544:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803546:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803549:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803550:	ff ff ff 
+  803553:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803557:	48 89 d6             	mov    %rdx,%rsi
+  80355a:	89 c7                	mov    %eax,%edi
+  80355c:	49 89 df             	mov    %rbx,%r15
+  80355f:	48 b8 09 95 ff ff ff 	movabs $0xffffffffffff9509,%rax
+  803566:	ff ff ff 
+  803569:	48 01 d8             	add    %rbx,%rax
+  80356c:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  80356e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803571:	be 02 00 00 00       	mov    $0x2,%esi
+  803576:	89 c7                	mov    %eax,%edi
+  803578:	49 89 df             	mov    %rbx,%r15
+  80357b:	48 b8 4a 94 ff ff ff 	movabs $0xffffffffffff944a,%rax
+  803582:	ff ff ff 
+  803585:	48 01 d8             	add    %rbx,%rax
+  803588:	ff d0                	call   *%rax
+  80358a:	85 c0                	test   %eax,%eax
+  80358c:	74 3e                	je     8035cc <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  80358e:	48 b8 77 e5 ff ff ff 	movabs $0xffffffffffffe577,%rax
+  803595:	ff ff ff 
+  803598:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80359c:	48 89 c2             	mov    %rax,%rdx
+  80359f:	be 07 01 00 00       	mov    $0x107,%esi
+  8035a4:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  8035ab:	ff ff ff 
+  8035ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035b2:	48 89 c7             	mov    %rax,%rdi
+  8035b5:	49 89 df             	mov    %rbx,%r15
+  8035b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035bd:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  8035c4:	ff ff ff 
+  8035c7:	48 01 d9             	add    %rbx,%rcx
+  8035ca:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  8035cc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8035cf:	eb 59                	jmp    80362a <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8035d1:	49 89 df             	mov    %rbx,%r15
+  8035d4:	48 b8 6a 92 ff ff ff 	movabs $0xffffffffffff926a,%rax
+  8035db:	ff ff ff 
+  8035de:	48 01 d8             	add    %rbx,%rax
+  8035e1:	ff d0                	call   *%rax
+  8035e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8035e8:	48 98                	cltq
+  8035ea:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8035f1:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8035f8:	ff ff ff 
+  8035fb:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8035ff:	48 01 c2             	add    %rax,%rdx
+  803602:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803609:	ff ff ff 
+  80360c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803610:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803613:	48 b8 d8 1f 00 00 00 	movabs $0x1fd8,%rax
+  80361a:	00 00 00 
+  80361d:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803624:	00 
+		return 0;
+  803625:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  80362a:	48 83 c4 10          	add    $0x10,%rsp
+  80362e:	5b                   	pop    %rbx
+  80362f:	41 5f                	pop    %r15
+  803631:	5d                   	pop    %rbp
+  803632:	c3                   	ret
+
+0000000000803633 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803633:	55                   	push   %rbp
+  803634:	48 89 e5             	mov    %rsp,%rbp
+  803637:	41 57                	push   %r15
+  803639:	48 83 ec 08          	sub    $0x8,%rsp
+  80363d:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80363d <sfork+0xa>
+  803644:	49 bb 0b 5a 00 00 00 	movabs $0x5a0b,%r11
+  80364b:	00 00 00 
+  80364e:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803651:	48 b8 92 e5 ff ff ff 	movabs $0xffffffffffffe592,%rax
+  803658:	ff ff ff 
+  80365b:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80365f:	48 89 c2             	mov    %rax,%rdx
+  803662:	be 1a 01 00 00       	mov    $0x11a,%esi
+  803667:	48 b8 c8 e4 ff ff ff 	movabs $0xffffffffffffe4c8,%rax
+  80366e:	ff ff ff 
+  803671:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803675:	48 89 c7             	mov    %rax,%rdi
+  803678:	49 89 cf             	mov    %rcx,%r15
+  80367b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803680:	49 b8 be 75 ff ff ff 	movabs $0xffffffffffff75be,%r8
+  803687:	ff ff ff 
+  80368a:	49 01 c8             	add    %rcx,%r8
+  80368d:	41 ff d0             	call   *%r8
+
+0000000000803690 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803690:	55                   	push   %rbp
+  803691:	48 89 e5             	mov    %rsp,%rbp
+  803694:	41 57                	push   %r15
+  803696:	53                   	push   %rbx
+  803697:	48 83 ec 30          	sub    $0x30,%rsp
+  80369b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80369b <ipc_recv+0xb>
+  8036a2:	49 bb ad 59 00 00 00 	movabs $0x59ad,%r11
+  8036a9:	00 00 00 
+  8036ac:	4c 01 db             	add    %r11,%rbx
+  8036af:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8036b3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8036b7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8036bb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8036c0:	75 0e                	jne    8036d0 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8036c2:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8036c9:	00 00 00 
+  8036cc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8036d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036d4:	48 89 c7             	mov    %rax,%rdi
+  8036d7:	49 89 df             	mov    %rbx,%r15
+  8036da:	48 b8 3c 96 ff ff ff 	movabs $0xffffffffffff963c,%rax
+  8036e1:	ff ff ff 
+  8036e4:	48 01 d8             	add    %rbx,%rax
+  8036e7:	ff d0                	call   *%rax
+  8036e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8036ec:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8036f1:	74 2a                	je     80371d <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8036f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036f7:	75 19                	jne    803712 <ipc_recv+0x82>
+  8036f9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803700:	ff ff ff 
+  803703:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803707:	48 8b 00             	mov    (%rax),%rax
+  80370a:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803710:	eb 05                	jmp    803717 <ipc_recv+0x87>
+  803712:	b8 00 00 00 00       	mov    $0x0,%eax
+  803717:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80371b:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80371d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803722:	74 2a                	je     80374e <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  803724:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803728:	75 19                	jne    803743 <ipc_recv+0xb3>
+  80372a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803731:	ff ff ff 
+  803734:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803738:	48 8b 00             	mov    (%rax),%rax
+  80373b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803741:	eb 05                	jmp    803748 <ipc_recv+0xb8>
+  803743:	b8 00 00 00 00       	mov    $0x0,%eax
+  803748:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80374c:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80374e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803752:	74 05                	je     803759 <ipc_recv+0xc9>
+		return res;
+  803754:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803757:	eb 17                	jmp    803770 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  803759:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803760:	ff ff ff 
+  803763:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803767:	48 8b 00             	mov    (%rax),%rax
+  80376a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803770:	48 83 c4 30          	add    $0x30,%rsp
+  803774:	5b                   	pop    %rbx
+  803775:	41 5f                	pop    %r15
+  803777:	5d                   	pop    %rbp
+  803778:	c3                   	ret
+
+0000000000803779 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803779:	55                   	push   %rbp
+  80377a:	48 89 e5             	mov    %rsp,%rbp
+  80377d:	41 57                	push   %r15
+  80377f:	53                   	push   %rbx
+  803780:	48 83 ec 20          	sub    $0x20,%rsp
+  803784:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803784 <ipc_send+0xb>
+  80378b:	49 bb c4 58 00 00 00 	movabs $0x58c4,%r11
+  803792:	00 00 00 
+  803795:	4c 01 db             	add    %r11,%rbx
+  803798:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80379b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80379e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8037a2:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8037a5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8037aa:	75 0e                	jne    8037ba <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8037ac:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8037b3:	00 00 00 
+  8037b6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8037ba:	90                   	nop
+  8037bb:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8037be:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8037c1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037c8:	89 c7                	mov    %eax,%edi
+  8037ca:	49 89 df             	mov    %rbx,%r15
+  8037cd:	48 b8 d2 95 ff ff ff 	movabs $0xffffffffffff95d2,%rax
+  8037d4:	ff ff ff 
+  8037d7:	48 01 d8             	add    %rbx,%rax
+  8037da:	ff d0                	call   *%rax
+  8037dc:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8037df:	74 da                	je     8037bb <ipc_send+0x42>
+		;
+}
+  8037e1:	90                   	nop
+  8037e2:	90                   	nop
+  8037e3:	48 83 c4 20          	add    $0x20,%rsp
+  8037e7:	5b                   	pop    %rbx
+  8037e8:	41 5f                	pop    %r15
+  8037ea:	5d                   	pop    %rbp
+  8037eb:	c3                   	ret
+
+00000000008037ec <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8037ec:	55                   	push   %rbp
+  8037ed:	48 89 e5             	mov    %rsp,%rbp
+  8037f0:	41 57                	push   %r15
+  8037f2:	53                   	push   %rbx
+  8037f3:	48 83 ec 40          	sub    $0x40,%rsp
+  8037f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037f7 <ipc_call+0xb>
+  8037fe:	49 bb 51 58 00 00 00 	movabs $0x5851,%r11
+  803805:	00 00 00 
+  803808:	4c 01 db             	add    %r11,%rbx
+  80380b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80380e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803811:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803815:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803818:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80381c:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803820:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803825:	75 0e                	jne    803835 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  803827:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80382e:	00 00 00 
+  803831:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803835:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80383a:	75 0e                	jne    80384a <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80383c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803843:	00 00 00 
+  803846:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80384a:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80384d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803851:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803854:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803858:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80385b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803861:	49 89 f8             	mov    %rdi,%r8
+  803864:	89 c7                	mov    %eax,%edi
+  803866:	49 89 df             	mov    %rbx,%r15
+  803869:	48 b8 95 96 ff ff ff 	movabs $0xffffffffffff9695,%rax
+  803870:	ff ff ff 
+  803873:	48 01 d8             	add    %rbx,%rax
+  803876:	ff d0                	call   *%rax
+  803878:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80387b:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803880:	74 2a                	je     8038ac <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803882:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803886:	75 19                	jne    8038a1 <ipc_call+0xb5>
+  803888:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80388f:	ff ff ff 
+  803892:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803896:	48 8b 00             	mov    (%rax),%rax
+  803899:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80389f:	eb 05                	jmp    8038a6 <ipc_call+0xba>
+  8038a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8038aa:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8038ac:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038b0:	74 05                	je     8038b7 <ipc_call+0xcb>
+		return r;
+  8038b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038b5:	eb 17                	jmp    8038ce <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8038b7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8038be:	ff ff ff 
+  8038c1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8038c5:	48 8b 00             	mov    (%rax),%rax
+  8038c8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8038ce:	48 83 c4 40          	add    $0x40,%rsp
+  8038d2:	5b                   	pop    %rbx
+  8038d3:	41 5f                	pop    %r15
+  8038d5:	5d                   	pop    %rbp
+  8038d6:	c3                   	ret
+
+00000000008038d7 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8038d7:	55                   	push   %rbp
+  8038d8:	48 89 e5             	mov    %rsp,%rbp
+  8038db:	41 57                	push   %r15
+  8038dd:	53                   	push   %rbx
+  8038de:	48 83 ec 70          	sub    $0x70,%rsp
+  8038e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038e2 <ipc_callw+0xb>
+  8038e9:	49 bb 66 57 00 00 00 	movabs $0x5766,%r11
+  8038f0:	00 00 00 
+  8038f3:	4c 01 db             	add    %r11,%rbx
+  8038f6:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8038f9:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8038fc:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  803900:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  803904:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  803909:	76 0a                	jbe    803915 <ipc_callw+0x3e>
+		return -E_INVAL;
+  80390b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803910:	e9 b7 00 00 00       	jmp    8039cc <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  803915:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803919:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80391d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803921:	48 89 ce             	mov    %rcx,%rsi
+  803924:	48 89 c7             	mov    %rax,%rdi
+  803927:	49 89 df             	mov    %rbx,%r15
+  80392a:	48 b8 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rax
+  803931:	ff ff ff 
+  803934:	48 01 d8             	add    %rbx,%rax
+  803937:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  803939:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803940:	00 
+  803941:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803945:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803949:	48 01 d0             	add    %rdx,%rax
+  80394c:	48 83 e8 01          	sub    $0x1,%rax
+  803950:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803954:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803958:	ba 00 00 00 00       	mov    $0x0,%edx
+  80395d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803961:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803965:	48 29 d0             	sub    %rdx,%rax
+  803968:	48 c1 e8 03          	shr    $0x3,%rax
+  80396c:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  803970:	89 c1                	mov    %eax,%ecx
+  803972:	8b 75 98             	mov    -0x68(%rbp),%esi
+  803975:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  803979:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80397c:	49 89 d1             	mov    %rdx,%r9
+  80397f:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  803986:	00 00 00 
+  803989:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  803990:	00 00 00 
+  803993:	89 c7                	mov    %eax,%edi
+  803995:	49 89 df             	mov    %rbx,%r15
+  803998:	48 b8 95 96 ff ff ff 	movabs $0xffffffffffff9695,%rax
+  80399f:	ff ff ff 
+  8039a2:	48 01 d8             	add    %rbx,%rax
+  8039a5:	ff d0                	call   *%rax
+  8039a7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8039aa:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8039ae:	74 05                	je     8039b5 <ipc_callw+0xde>
+		return r;
+  8039b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039b3:	eb 17                	jmp    8039cc <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8039b5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8039bc:	ff ff ff 
+  8039bf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039c3:	48 8b 00             	mov    (%rax),%rax
+  8039c6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8039cc:	48 83 c4 70          	add    $0x70,%rsp
+  8039d0:	5b                   	pop    %rbx
+  8039d1:	41 5f                	pop    %r15
+  8039d3:	5d                   	pop    %rbp
+  8039d4:	c3                   	ret
+
+00000000008039d5 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8039d5:	55                   	push   %rbp
+  8039d6:	48 89 e5             	mov    %rsp,%rbp
+  8039d9:	41 57                	push   %r15
+  8039db:	53                   	push   %rbx
+  8039dc:	48 83 ec 40          	sub    $0x40,%rsp
+  8039e0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039e0 <ipc_callv+0xb>
+  8039e7:	49 bb 68 56 00 00 00 	movabs $0x5668,%r11
+  8039ee:	00 00 00 
+  8039f1:	4c 01 db             	add    %r11,%rbx
+  8039f4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8039f7:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8039fa:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8039fe:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803a01:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  803a05:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  803a09:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803a10:	00 00 00 
+  803a13:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  803a17:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  803a1b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  803a1f:	74 11                	je     803a32 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  803a21:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a25:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  803a29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a2c:	c1 e0 14             	shl    $0x14,%eax
+  803a2f:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  803a32:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  803a36:	74 14                	je     803a4c <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  803a38:	8b 45 20             	mov    0x20(%rbp),%eax
+  803a3b:	83 e8 01             	sub    $0x1,%eax
+  803a3e:	48 63 d0             	movslq %eax,%rdx
+  803a41:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803a45:	48 09 d0             	or     %rdx,%rax
+  803a48:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  803a4c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803a4f:	c1 e0 10             	shl    $0x10,%eax
+  803a52:	0b 45 10             	or     0x10(%rbp),%eax
+  803a55:	89 c1                	mov    %eax,%ecx
+  803a57:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  803a5a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  803a5e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  803a62:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a66:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803a69:	4d 89 c1             	mov    %r8,%r9
+  803a6c:	49 89 f8             	mov    %rdi,%r8
+  803a6f:	89 c7                	mov    %eax,%edi
+  803a71:	49 89 df             	mov    %rbx,%r15
+  803a74:	48 b8 95 96 ff ff ff 	movabs $0xffffffffffff9695,%rax
+  803a7b:	ff ff ff 
+  803a7e:	48 01 d8             	add    %rbx,%rax
+  803a81:	ff d0                	call   *%rax
+  803a83:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  803a86:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803a8a:	74 05                	je     803a91 <ipc_callv+0xbc>
+		return r;
+  803a8c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a8f:	eb 17                	jmp    803aa8 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  803a91:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803a98:	ff ff ff 
+  803a9b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a9f:	48 8b 00             	mov    (%rax),%rax
+  803aa2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803aa8:	48 83 c4 40          	add    $0x40,%rsp
+  803aac:	5b                   	pop    %rbx
+  803aad:	41 5f                	pop    %r15
+  803aaf:	5d                   	pop    %rbp
+  803ab0:	c3                   	ret
+
+0000000000803ab1 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  803ab1:	55                   	push   %rbp
+  803ab2:	48 89 e5             	mov    %rsp,%rbp
+  803ab5:	41 57                	push   %r15
+  803ab7:	53                   	push   %rbx
+  803ab8:	48 83 ec 40          	sub    $0x40,%rsp
+  803abc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803abc <ipc_reply_recv+0xb>
+  803ac3:	49 bb 8c 55 00 00 00 	movabs $0x558c,%r11
+  803aca:	00 00 00 
+  803acd:	4c 01 db             	add    %r11,%rbx
+  803ad0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ad3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803ad6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803ada:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803add:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803ae1:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803ae5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803aea:	75 0e                	jne    803afa <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  803aec:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803af3:	00 00 00 
+  803af6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803afa:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803aff:	75 0e                	jne    803b0f <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803b01:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803b08:	00 00 00 
+  803b0b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803b0f:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803b12:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  803b16:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803b1a:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803b1d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803b21:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b24:	4d 89 c1             	mov    %r8,%r9
+  803b27:	49 89 f8             	mov    %rdi,%r8
+  803b2a:	89 c7                	mov    %eax,%edi
+  803b2c:	49 89 df             	mov    %rbx,%r15
+  803b2f:	48 b8 09 97 ff ff ff 	movabs $0xffffffffffff9709,%rax
+  803b36:	ff ff ff 
+  803b39:	48 01 d8             	add    %rbx,%rax
+  803b3c:	ff d0                	call   *%rax
+  803b3e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  803b41:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803b46:	74 2a                	je     803b72 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803b48:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b4c:	75 19                	jne    803b67 <ipc_reply_recv+0xb6>
+  803b4e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803b55:	ff ff ff 
+  803b58:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b5c:	48 8b 00             	mov    (%rax),%rax
+  803b5f:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803b65:	eb 05                	jmp    803b6c <ipc_reply_recv+0xbb>
+  803b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b70:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  803b72:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  803b77:	74 2a                	je     803ba3 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803b79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b7d:	75 19                	jne    803b98 <ipc_reply_recv+0xe7>
+  803b7f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803b86:	ff ff ff 
+  803b89:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b8d:	48 8b 00             	mov    (%rax),%rax
+  803b90:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803b96:	eb 05                	jmp    803b9d <ipc_reply_recv+0xec>
+  803b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  803ba1:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803ba3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ba7:	74 05                	je     803bae <ipc_reply_recv+0xfd>
+		return r;
+  803ba9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bac:	eb 17                	jmp    803bc5 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  803bae:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803bb5:	ff ff ff 
+  803bb8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803bbc:	48 8b 00             	mov    (%rax),%rax
+  803bbf:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803bc5:	48 83 c4 40          	add    $0x40,%rsp
+  803bc9:	5b                   	pop    %rbx
+  803bca:	41 5f                	pop    %r15
+  803bcc:	5d                   	pop    %rbp
+  803bcd:	c3                   	ret
+
+0000000000803bce <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  803bce:	55                   	push   %rbp
+  803bcf:	48 89 e5             	mov    %rsp,%rbp
+  803bd2:	41 57                	push   %r15
+  803bd4:	53                   	push   %rbx
+  803bd5:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  803bdc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bdc <ipc_window_batch+0xe>
+  803be3:	49 bb 6c 54 00 00 00 	movabs $0x546c,%r11
+  803bea:	00 00 00 
+  803bed:	4c 01 db             	add    %r11,%rbx
+  803bf0:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  803bf6:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  803bfd:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803c03:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  803c09:	e9 15 01 00 00       	jmp    803d23 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803c0e:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803c14:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803c17:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803c1e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c21:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c24:	39 c2                	cmp    %eax,%edx
+  803c26:	0f 4e c2             	cmovle %edx,%eax
+  803c29:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  803c2c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803c33:	eb 6b                	jmp    803ca0 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803c35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c38:	48 98                	cltq
+  803c3a:	48 c1 e0 05          	shl    $0x5,%rax
+  803c3e:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803c42:	48 01 e8             	add    %rbp,%rax
+  803c45:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  803c4b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803c51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c54:	c1 e0 0c             	shl    $0xc,%eax
+  803c57:	48 63 d0             	movslq %eax,%rdx
+  803c5a:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803c61:	48 01 c2             	add    %rax,%rdx
+  803c64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c67:	48 98                	cltq
+  803c69:	48 c1 e0 05          	shl    $0x5,%rax
+  803c6d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803c71:	48 01 e8             	add    %rbp,%rax
+  803c74:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  803c7a:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  803c7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c80:	48 98                	cltq
+  803c82:	48 c1 e0 05          	shl    $0x5,%rax
+  803c86:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803c8a:	48 01 e8             	add    %rbp,%rax
+  803c8d:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  803c94:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  803c9a:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  803c9c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803ca0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ca3:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  803ca6:	7c 8d                	jl     803c35 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  803ca8:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  803caf:	74 27                	je     803cd8 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803cb1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803cb4:	48 63 d0             	movslq %eax,%rdx
+  803cb7:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803cbe:	48 89 d6             	mov    %rdx,%rsi
+  803cc1:	48 89 c7             	mov    %rax,%rdi
+  803cc4:	49 89 df             	mov    %rbx,%r15
+  803cc7:	48 b8 ac 99 ff ff ff 	movabs $0xffffffffffff99ac,%rax
+  803cce:	ff ff ff 
+  803cd1:	48 01 d8             	add    %rbx,%rax
+  803cd4:	ff d0                	call   *%rax
+  803cd6:	eb 25                	jmp    803cfd <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  803cd8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803cdb:	48 63 d0             	movslq %eax,%rdx
+  803cde:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803ce5:	48 89 d6             	mov    %rdx,%rsi
+  803ce8:	48 89 c7             	mov    %rax,%rdi
+  803ceb:	49 89 df             	mov    %rbx,%r15
+  803cee:	48 b8 0a 9a ff ff ff 	movabs $0xffffffffffff9a0a,%rax
+  803cf5:	ff ff ff 
+  803cf8:	48 01 d8             	add    %rbx,%rax
+  803cfb:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803cfd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803d00:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803d04:	79 05                	jns    803d0b <ipc_window_batch+0x13d>
+			return r;
+  803d06:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d09:	eb 2a                	jmp    803d35 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  803d0b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803d0e:	c1 e0 0c             	shl    $0xc,%eax
+  803d11:	48 98                	cltq
+  803d13:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  803d1a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803d1d:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803d23:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  803d2a:	0f 8f de fe ff ff    	jg     803c0e <ipc_window_batch+0x40>
+	}
+	return 0;
+  803d30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d35:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  803d3c:	5b                   	pop    %rbx
+  803d3d:	41 5f                	pop    %r15
+  803d3f:	5d                   	pop    %rbp
+  803d40:	c3                   	ret
+
+0000000000803d41 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803d41:	55                   	push   %rbp
+  803d42:	48 89 e5             	mov    %rsp,%rbp
+  803d45:	48 83 ec 10          	sub    $0x10,%rsp
+  803d49:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d49 <ipc_map_window+0x8>
+  803d50:	49 bb ff 52 00 00 00 	movabs $0x52ff,%r11
+  803d57:	00 00 00 
+  803d5a:	4c 01 d8             	add    %r11,%rax
+  803d5d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d61:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803d64:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803d67:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d6b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803d70:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d75:	49 b8 86 ab ff ff ff 	movabs $0xffffffffffffab86,%r8
+  803d7c:	ff ff ff 
+  803d7f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803d83:	ff d0                	call   *%rax
+}
+  803d85:	c9                   	leave
+  803d86:	c3                   	ret
+
+0000000000803d87 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803d87:	55                   	push   %rbp
+  803d88:	48 89 e5             	mov    %rsp,%rbp
+  803d8b:	48 83 ec 10          	sub    $0x10,%rsp
+  803d8f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d8f <ipc_unmap_window+0x8>
+  803d96:	49 bb b9 52 00 00 00 	movabs $0x52b9,%r11
+  803d9d:	00 00 00 
+  803da0:	4c 01 d8             	add    %r11,%rax
+  803da3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803da7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  803daa:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803dad:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803db1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803db6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dbb:	49 b8 86 ab ff ff ff 	movabs $0xffffffffffffab86,%r8
+  803dc2:	ff ff ff 
+  803dc5:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803dc9:	ff d0                	call   *%rax
+}
+  803dcb:	c9                   	leave
+  803dcc:	c3                   	ret
+
+0000000000803dcd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803dcd:	55                   	push   %rbp
+  803dce:	48 89 e5             	mov    %rsp,%rbp
+  803dd1:	48 83 ec 18          	sub    $0x18,%rsp
+  803dd5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803dd5 <ipc_find_env+0x8>
+  803ddc:	49 bb 73 52 00 00 00 	movabs $0x5273,%r11
+  803de3:	00 00 00 
+  803de6:	4c 01 d8             	add    %r11,%rax
+  803de9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803dec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803df3:	eb 57                	jmp    803e4c <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803df5:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803dfc:	ff ff ff 
+  803dff:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803e03:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803e06:	48 63 d2             	movslq %edx,%rdx
+  803e09:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803e10:	48 01 ca             	add    %rcx,%rdx
+  803e13:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803e1a:	8b 12                	mov    (%rdx),%edx
+  803e1c:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803e1f:	75 27                	jne    803e48 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803e21:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803e28:	ff ff ff 
+  803e2b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803e2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e32:	48 98                	cltq
+  803e34:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803e3b:	48 01 d0             	add    %rdx,%rax
+  803e3e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803e44:	8b 00                	mov    (%rax),%eax
+  803e46:	eb 12                	jmp    803e5a <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803e48:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803e4c:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803e53:	7e a0                	jle    803df5 <ipc_find_env+0x28>
+	}
+	return 0;
+  803e55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e5a:	c9                   	leave
+  803e5b:	c3                   	ret
+
+0000000000803e5c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803e5c:	55                   	push   %rbp
+  803e5d:	48 89 e5             	mov    %rsp,%rbp
+  803e60:	48 83 ec 08          	sub    $0x8,%rsp
+  803e64:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e64 <fd2num+0x8>
+  803e6b:	49 bb e4 51 00 00 00 	movabs $0x51e4,%r11
+  803e72:	00 00 00 
+  803e75:	4c 01 d8             	add    %r11,%rax
+  803e78:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803e7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e80:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803e87:	ff ff ff 
+  803e8a:	48 01 d0             	add    %rdx,%rax
+  803e8d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803e91:	c9                   	leave
+  803e92:	c3                   	ret
+
+0000000000803e93 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803e93:	55                   	push   %rbp
+  803e94:	48 89 e5             	mov    %rsp,%rbp
+  803e97:	48 83 ec 08          	sub    $0x8,%rsp
+  803e9b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e9b <fd2data+0x8>
+  803ea2:	49 bb ad 51 00 00 00 	movabs $0x51ad,%r11
+  803ea9:	00 00 00 
+  803eac:	4c 01 d8             	add    %r11,%rax
+  803eaf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803eb3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803eb7:	48 89 d7             	mov    %rdx,%rdi
+  803eba:	48 ba 14 ae ff ff ff 	movabs $0xffffffffffffae14,%rdx
+  803ec1:	ff ff ff 
+  803ec4:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803ec8:	ff d0                	call   *%rax
+  803eca:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803ed0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803ed4:	c9                   	leave
+  803ed5:	c3                   	ret
+
+0000000000803ed6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803ed6:	55                   	push   %rbp
+  803ed7:	48 89 e5             	mov    %rsp,%rbp
+  803eda:	48 83 ec 18          	sub    $0x18,%rsp
+  803ede:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ede <fd_alloc+0x8>
+  803ee5:	49 bb 6a 51 00 00 00 	movabs $0x516a,%r11
+  803eec:	00 00 00 
+  803eef:	4c 01 d8             	add    %r11,%rax
+  803ef2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803ef6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803efd:	eb 75                	jmp    803f74 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803eff:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803f02:	48 63 d2             	movslq %edx,%rdx
+  803f05:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803f0c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803f10:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803f14:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f18:	48 89 d1             	mov    %rdx,%rcx
+  803f1b:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f1f:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803f26:	ff ff ff 
+  803f29:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803f2d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803f31:	83 e2 01             	and    $0x1,%edx
+  803f34:	48 85 d2             	test   %rdx,%rdx
+  803f37:	74 25                	je     803f5e <fd_alloc+0x88>
+  803f39:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f3d:	48 89 d1             	mov    %rdx,%rcx
+  803f40:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f44:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803f4b:	ff ff ff 
+  803f4e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803f52:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803f56:	83 e2 01             	and    $0x1,%edx
+  803f59:	48 85 d2             	test   %rdx,%rdx
+  803f5c:	75 12                	jne    803f70 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803f5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f62:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f66:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6e:	eb 1a                	jmp    803f8a <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803f70:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803f74:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803f78:	7e 85                	jle    803eff <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803f7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f7e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803f85:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803f8a:	c9                   	leave
+  803f8b:	c3                   	ret
+
+0000000000803f8c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803f8c:	55                   	push   %rbp
+  803f8d:	48 89 e5             	mov    %rsp,%rbp
+  803f90:	48 83 ec 20          	sub    $0x20,%rsp
+  803f94:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803f94 <fd_lookup+0x8>
+  803f9b:	49 bb b4 50 00 00 00 	movabs $0x50b4,%r11
+  803fa2:	00 00 00 
+  803fa5:	4c 01 d8             	add    %r11,%rax
+  803fa8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803fab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803faf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fb3:	78 06                	js     803fbb <fd_lookup+0x2f>
+  803fb5:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803fb9:	7e 07                	jle    803fc2 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803fbb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fc0:	eb 73                	jmp    804035 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803fc2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803fc5:	48 63 d2             	movslq %edx,%rdx
+  803fc8:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803fcf:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803fd3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803fd7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803fdb:	48 89 d1             	mov    %rdx,%rcx
+  803fde:	48 c1 e9 15          	shr    $0x15,%rcx
+  803fe2:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803fe9:	ff ff ff 
+  803fec:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803ff0:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803ff4:	83 e2 01             	and    $0x1,%edx
+  803ff7:	48 85 d2             	test   %rdx,%rdx
+  803ffa:	74 22                	je     80401e <fd_lookup+0x92>
+  803ffc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804000:	48 c1 ea 0c          	shr    $0xc,%rdx
+  804004:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  80400b:	ff ff ff 
+  80400e:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  804012:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804016:	83 e0 01             	and    $0x1,%eax
+  804019:	48 85 c0             	test   %rax,%rax
+  80401c:	75 07                	jne    804025 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80401e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804023:	eb 10                	jmp    804035 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  804025:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804029:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80402d:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  804030:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804035:	c9                   	leave
+  804036:	c3                   	ret
+
+0000000000804037 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  804037:	55                   	push   %rbp
+  804038:	48 89 e5             	mov    %rsp,%rbp
+  80403b:	41 57                	push   %r15
+  80403d:	53                   	push   %rbx
+  80403e:	48 83 ec 30          	sub    $0x30,%rsp
+  804042:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804042 <fd_close+0xb>
+  804049:	49 bb 06 50 00 00 00 	movabs $0x5006,%r11
+  804050:	00 00 00 
+  804053:	4c 01 db             	add    %r11,%rbx
+  804056:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80405a:	89 f0                	mov    %esi,%eax
+  80405c:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80405f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804063:	48 89 c7             	mov    %rax,%rdi
+  804066:	48 b8 14 ae ff ff ff 	movabs $0xffffffffffffae14,%rax
+  80406d:	ff ff ff 
+  804070:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804074:	ff d0                	call   *%rax
+  804076:	89 c2                	mov    %eax,%edx
+  804078:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80407c:	48 89 c6             	mov    %rax,%rsi
+  80407f:	89 d7                	mov    %edx,%edi
+  804081:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  804088:	ff ff ff 
+  80408b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80408f:	ff d0                	call   *%rax
+  804091:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804094:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804098:	78 0a                	js     8040a4 <fd_close+0x6d>
+	    || fd != fd2)
+  80409a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80409e:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  8040a2:	74 12                	je     8040b6 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  8040a4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8040a8:	74 05                	je     8040af <fd_close+0x78>
+  8040aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040ad:	eb 7a                	jmp    804129 <fd_close+0xf2>
+  8040af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b4:	eb 73                	jmp    804129 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8040b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040ba:	8b 00                	mov    (%rax),%eax
+  8040bc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8040c0:	48 89 d6             	mov    %rdx,%rsi
+  8040c3:	89 c7                	mov    %eax,%edi
+  8040c5:	48 b8 ea b0 ff ff ff 	movabs $0xffffffffffffb0ea,%rax
+  8040cc:	ff ff ff 
+  8040cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040d3:	ff d0                	call   *%rax
+  8040d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040dc:	78 2a                	js     804108 <fd_close+0xd1>
+		if (dev->dev_close)
+  8040de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8040e6:	48 85 c0             	test   %rax,%rax
+  8040e9:	74 16                	je     804101 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8040eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040ef:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8040f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040f7:	48 89 c7             	mov    %rax,%rdi
+  8040fa:	ff d2                	call   *%rdx
+  8040fc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040ff:	eb 07                	jmp    804108 <fd_close+0xd1>
+		else
+			r = 0;
+  804101:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  804108:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80410c:	48 89 c6             	mov    %rax,%rsi
+  80410f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804114:	49 89 df             	mov    %rbx,%r15
+  804117:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  80411e:	ff ff ff 
+  804121:	48 01 d8             	add    %rbx,%rax
+  804124:	ff d0                	call   *%rax
+	return r;
+  804126:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804129:	48 83 c4 30          	add    $0x30,%rsp
+  80412d:	5b                   	pop    %rbx
+  80412e:	41 5f                	pop    %r15
+  804130:	5d                   	pop    %rbp
+  804131:	c3                   	ret
+
+0000000000804132 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  804132:	55                   	push   %rbp
+  804133:	48 89 e5             	mov    %rsp,%rbp
+  804136:	41 57                	push   %r15
+  804138:	48 83 ec 28          	sub    $0x28,%rsp
+  80413c:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80413c <dev_lookup+0xa>
+  804143:	49 bb 0c 4f 00 00 00 	movabs $0x4f0c,%r11
+  80414a:	00 00 00 
+  80414d:	4c 01 d9             	add    %r11,%rcx
+  804150:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804153:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  804157:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80415e:	eb 45                	jmp    8041a5 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  804160:	48 ba f8 01 00 00 00 	movabs $0x1f8,%rdx
+  804167:	00 00 00 
+  80416a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80416d:	48 98                	cltq
+  80416f:	48 01 ca             	add    %rcx,%rdx
+  804172:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804176:	8b 00                	mov    (%rax),%eax
+  804178:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80417b:	75 24                	jne    8041a1 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  80417d:	48 ba f8 01 00 00 00 	movabs $0x1f8,%rdx
+  804184:	00 00 00 
+  804187:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80418a:	48 98                	cltq
+  80418c:	48 01 ca             	add    %rcx,%rdx
+  80418f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804193:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804197:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80419a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419f:	eb 74                	jmp    804215 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  8041a1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8041a5:	48 ba f8 01 00 00 00 	movabs $0x1f8,%rdx
+  8041ac:	00 00 00 
+  8041af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041b2:	48 98                	cltq
+  8041b4:	48 01 ca             	add    %rcx,%rdx
+  8041b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041bb:	48 85 c0             	test   %rax,%rax
+  8041be:	75 a0                	jne    804160 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8041c0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8041c7:	ff ff ff 
+  8041ca:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8041ce:	48 8b 00             	mov    (%rax),%rax
+  8041d1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8041d7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8041da:	89 c6                	mov    %eax,%esi
+  8041dc:	48 b8 a8 e5 ff ff ff 	movabs $0xffffffffffffe5a8,%rax
+  8041e3:	ff ff ff 
+  8041e6:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8041ea:	48 89 c7             	mov    %rax,%rdi
+  8041ed:	49 89 cf             	mov    %rcx,%r15
+  8041f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f5:	49 b8 95 78 ff ff ff 	movabs $0xffffffffffff7895,%r8
+  8041fc:	ff ff ff 
+  8041ff:	49 01 c8             	add    %rcx,%r8
+  804202:	41 ff d0             	call   *%r8
+	*dev = 0;
+  804205:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804209:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  804210:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  804215:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804219:	c9                   	leave
+  80421a:	c3                   	ret
+
+000000000080421b <close>:
+
+int
+close(int fdnum)
+{
+  80421b:	55                   	push   %rbp
+  80421c:	48 89 e5             	mov    %rsp,%rbp
+  80421f:	53                   	push   %rbx
+  804220:	48 83 ec 28          	sub    $0x28,%rsp
+  804224:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804224 <close+0x9>
+  80422b:	49 bb 24 4e 00 00 00 	movabs $0x4e24,%r11
+  804232:	00 00 00 
+  804235:	4c 01 db             	add    %r11,%rbx
+  804238:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80423b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80423f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804242:	48 89 d6             	mov    %rdx,%rsi
+  804245:	89 c7                	mov    %eax,%edi
+  804247:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  80424e:	ff ff ff 
+  804251:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804255:	ff d0                	call   *%rax
+  804257:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80425a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80425e:	79 05                	jns    804265 <close+0x4a>
+		return r;
+  804260:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804263:	eb 1c                	jmp    804281 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  804265:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804269:	be 01 00 00 00       	mov    $0x1,%esi
+  80426e:	48 89 c7             	mov    %rax,%rdi
+  804271:	48 b8 ef af ff ff ff 	movabs $0xffffffffffffafef,%rax
+  804278:	ff ff ff 
+  80427b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80427f:	ff d0                	call   *%rax
+}
+  804281:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804285:	c9                   	leave
+  804286:	c3                   	ret
+
+0000000000804287 <close_all>:
+
+void
+close_all(void)
+{
+  804287:	55                   	push   %rbp
+  804288:	48 89 e5             	mov    %rsp,%rbp
+  80428b:	53                   	push   %rbx
+  80428c:	48 83 ec 18          	sub    $0x18,%rsp
+  804290:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804290 <close_all+0x9>
+  804297:	49 bb b8 4d 00 00 00 	movabs $0x4db8,%r11
+  80429e:	00 00 00 
+  8042a1:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8042a4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8042ab:	eb 19                	jmp    8042c6 <close_all+0x3f>
+		close(i);
+  8042ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042b0:	89 c7                	mov    %eax,%edi
+  8042b2:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  8042b9:	ff ff ff 
+  8042bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042c0:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8042c2:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8042c6:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8042ca:	7e e1                	jle    8042ad <close_all+0x26>
+}
+  8042cc:	90                   	nop
+  8042cd:	90                   	nop
+  8042ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8042d2:	c9                   	leave
+  8042d3:	c3                   	ret
+
+00000000008042d4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8042d4:	55                   	push   %rbp
+  8042d5:	48 89 e5             	mov    %rsp,%rbp
+  8042d8:	41 57                	push   %r15
+  8042da:	53                   	push   %rbx
+  8042db:	48 83 ec 40          	sub    $0x40,%rsp
+  8042df:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042df <dup+0xb>
+  8042e6:	49 bb 69 4d 00 00 00 	movabs $0x4d69,%r11
+  8042ed:	00 00 00 
+  8042f0:	4c 01 db             	add    %r11,%rbx
+  8042f3:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8042f6:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8042f9:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8042fd:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804300:	48 89 d6             	mov    %rdx,%rsi
+  804303:	89 c7                	mov    %eax,%edi
+  804305:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  80430c:	ff ff ff 
+  80430f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804313:	ff d0                	call   *%rax
+  804315:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804318:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80431c:	79 08                	jns    804326 <dup+0x52>
+		return r;
+  80431e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804321:	e9 a4 01 00 00       	jmp    8044ca <dup+0x1f6>
+	close(newfdnum);
+  804326:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804329:	89 c7                	mov    %eax,%edi
+  80432b:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  804332:	ff ff ff 
+  804335:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804339:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  80433b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80433e:	48 98                	cltq
+  804340:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  804346:	48 c1 e0 0c          	shl    $0xc,%rax
+  80434a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  80434e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804352:	48 89 c7             	mov    %rax,%rdi
+  804355:	48 b8 4b ae ff ff ff 	movabs $0xffffffffffffae4b,%rax
+  80435c:	ff ff ff 
+  80435f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804363:	ff d0                	call   *%rax
+  804365:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  804369:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80436d:	48 89 c7             	mov    %rax,%rdi
+  804370:	48 b8 4b ae ff ff ff 	movabs $0xffffffffffffae4b,%rax
+  804377:	ff ff ff 
+  80437a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80437e:	ff d0                	call   *%rax
+  804380:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  804384:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804388:	48 c1 e8 15          	shr    $0x15,%rax
+  80438c:	48 89 c2             	mov    %rax,%rdx
+  80438f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  804396:	ff ff ff 
+  804399:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80439d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8043a1:	83 e0 01             	and    $0x1,%eax
+  8043a4:	48 85 c0             	test   %rax,%rax
+  8043a7:	74 7f                	je     804428 <dup+0x154>
+  8043a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043ad:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043b1:	48 89 c2             	mov    %rax,%rdx
+  8043b4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8043bb:	ff ff ff 
+  8043be:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8043c2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8043c6:	83 e0 01             	and    $0x1,%eax
+  8043c9:	48 85 c0             	test   %rax,%rax
+  8043cc:	74 5a                	je     804428 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8043ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043d2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043d6:	48 89 c2             	mov    %rax,%rdx
+  8043d9:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8043e0:	ff ff ff 
+  8043e3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8043e7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8043eb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8043f0:	89 c1                	mov    %eax,%ecx
+  8043f2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8043f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043fa:	41 89 c8             	mov    %ecx,%r8d
+  8043fd:	48 89 d1             	mov    %rdx,%rcx
+  804400:	ba 00 00 00 00       	mov    $0x0,%edx
+  804405:	48 89 c6             	mov    %rax,%rsi
+  804408:	bf 00 00 00 00       	mov    $0x0,%edi
+  80440d:	49 89 df             	mov    %rbx,%r15
+  804410:	48 b8 78 93 ff ff ff 	movabs $0xffffffffffff9378,%rax
+  804417:	ff ff ff 
+  80441a:	48 01 d8             	add    %rbx,%rax
+  80441d:	ff d0                	call   *%rax
+  80441f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804422:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804426:	78 5f                	js     804487 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  804428:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80442c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804430:	48 89 c2             	mov    %rax,%rdx
+  804433:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80443a:	ff ff ff 
+  80443d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804441:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804445:	25 07 0e 00 00       	and    $0xe07,%eax
+  80444a:	89 c1                	mov    %eax,%ecx
+  80444c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804450:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804454:	41 89 c8             	mov    %ecx,%r8d
+  804457:	48 89 d1             	mov    %rdx,%rcx
+  80445a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80445f:	48 89 c6             	mov    %rax,%rsi
+  804462:	bf 00 00 00 00       	mov    $0x0,%edi
+  804467:	49 89 df             	mov    %rbx,%r15
+  80446a:	48 b8 78 93 ff ff ff 	movabs $0xffffffffffff9378,%rax
+  804471:	ff ff ff 
+  804474:	48 01 d8             	add    %rbx,%rax
+  804477:	ff d0                	call   *%rax
+  804479:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80447c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804480:	78 08                	js     80448a <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  804482:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804485:	eb 43                	jmp    8044ca <dup+0x1f6>
+			goto err;
+  804487:	90                   	nop
+  804488:	eb 01                	jmp    80448b <dup+0x1b7>
+		goto err;
+  80448a:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80448b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80448f:	48 89 c6             	mov    %rax,%rsi
+  804492:	bf 00 00 00 00       	mov    $0x0,%edi
+  804497:	49 89 df             	mov    %rbx,%r15
+  80449a:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  8044a1:	ff ff ff 
+  8044a4:	48 01 d8             	add    %rbx,%rax
+  8044a7:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8044a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044ad:	48 89 c6             	mov    %rax,%rsi
+  8044b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044b5:	49 89 df             	mov    %rbx,%r15
+  8044b8:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  8044bf:	ff ff ff 
+  8044c2:	48 01 d8             	add    %rbx,%rax
+  8044c5:	ff d0                	call   *%rax
+	return r;
+  8044c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8044ca:	48 83 c4 40          	add    $0x40,%rsp
+  8044ce:	5b                   	pop    %rbx
+  8044cf:	41 5f                	pop    %r15
+  8044d1:	5d                   	pop    %rbp
+  8044d2:	c3                   	ret
+
+00000000008044d3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8044d3:	55                   	push   %rbp
+  8044d4:	48 89 e5             	mov    %rsp,%rbp
+  8044d7:	41 57                	push   %r15
+  8044d9:	53                   	push   %rbx
+  8044da:	48 83 ec 40          	sub    $0x40,%rsp
+  8044de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044de <read+0xb>
+  8044e5:	49 bb 6a 4b 00 00 00 	movabs $0x4b6a,%r11
+  8044ec:	00 00 00 
+  8044ef:	4c 01 db             	add    %r11,%rbx
+  8044f2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8044f5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044f9:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8044fd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804501:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804504:	48 89 d6             	mov    %rdx,%rsi
+  804507:	89 c7                	mov    %eax,%edi
+  804509:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  804510:	ff ff ff 
+  804513:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804517:	ff d0                	call   *%rax
+  804519:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80451c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804520:	78 28                	js     80454a <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804522:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804526:	8b 00                	mov    (%rax),%eax
+  804528:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80452c:	48 89 d6             	mov    %rdx,%rsi
+  80452f:	89 c7                	mov    %eax,%edi
+  804531:	48 b8 ea b0 ff ff ff 	movabs $0xffffffffffffb0ea,%rax
+  804538:	ff ff ff 
+  80453b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80453f:	ff d0                	call   *%rax
+  804541:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804544:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804548:	79 08                	jns    804552 <read+0x7f>
+		return r;
+  80454a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80454d:	e9 8b 00 00 00       	jmp    8045dd <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804552:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804556:	8b 40 08             	mov    0x8(%rax),%eax
+  804559:	83 e0 03             	and    $0x3,%eax
+  80455c:	83 f8 01             	cmp    $0x1,%eax
+  80455f:	75 4b                	jne    8045ac <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804561:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804568:	ff ff ff 
+  80456b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80456f:	48 8b 00             	mov    (%rax),%rax
+  804572:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804578:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80457b:	89 c6                	mov    %eax,%esi
+  80457d:	48 b8 c7 e5 ff ff ff 	movabs $0xffffffffffffe5c7,%rax
+  804584:	ff ff ff 
+  804587:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80458b:	48 89 c7             	mov    %rax,%rdi
+  80458e:	49 89 df             	mov    %rbx,%r15
+  804591:	b8 00 00 00 00       	mov    $0x0,%eax
+  804596:	48 b9 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rcx
+  80459d:	ff ff ff 
+  8045a0:	48 01 d9             	add    %rbx,%rcx
+  8045a3:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8045a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045aa:	eb 31                	jmp    8045dd <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8045ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045b0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8045b4:	48 85 c0             	test   %rax,%rax
+  8045b7:	75 07                	jne    8045c0 <read+0xed>
+		return -E_NOT_SUPP;
+  8045b9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8045be:	eb 1d                	jmp    8045dd <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8045c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045c4:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8045c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045cc:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8045d0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8045d4:	48 89 ce             	mov    %rcx,%rsi
+  8045d7:	48 89 c7             	mov    %rax,%rdi
+  8045da:	41 ff d0             	call   *%r8
+}
+  8045dd:	48 83 c4 40          	add    $0x40,%rsp
+  8045e1:	5b                   	pop    %rbx
+  8045e2:	41 5f                	pop    %r15
+  8045e4:	5d                   	pop    %rbp
+  8045e5:	c3                   	ret
+
+00000000008045e6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8045e6:	55                   	push   %rbp
+  8045e7:	48 89 e5             	mov    %rsp,%rbp
+  8045ea:	53                   	push   %rbx
+  8045eb:	48 83 ec 38          	sub    $0x38,%rsp
+  8045ef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045ef <readn+0x9>
+  8045f6:	49 bb 59 4a 00 00 00 	movabs $0x4a59,%r11
+  8045fd:	00 00 00 
+  804600:	4c 01 db             	add    %r11,%rbx
+  804603:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804606:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80460a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80460e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804615:	eb 4b                	jmp    804662 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  804617:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80461a:	48 98                	cltq
+  80461c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804620:	48 29 c2             	sub    %rax,%rdx
+  804623:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804626:	48 63 c8             	movslq %eax,%rcx
+  804629:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80462d:	48 01 c1             	add    %rax,%rcx
+  804630:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804633:	48 89 ce             	mov    %rcx,%rsi
+  804636:	89 c7                	mov    %eax,%edi
+  804638:	48 b8 8b b4 ff ff ff 	movabs $0xffffffffffffb48b,%rax
+  80463f:	ff ff ff 
+  804642:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804646:	ff d0                	call   *%rax
+  804648:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80464b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80464f:	79 05                	jns    804656 <readn+0x70>
+			return m;
+  804651:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804654:	eb 1d                	jmp    804673 <readn+0x8d>
+		if (m == 0)
+  804656:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80465a:	74 13                	je     80466f <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80465c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80465f:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804662:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804665:	48 98                	cltq
+  804667:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80466b:	72 aa                	jb     804617 <readn+0x31>
+  80466d:	eb 01                	jmp    804670 <readn+0x8a>
+			break;
+  80466f:	90                   	nop
+	}
+	return tot;
+  804670:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804673:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804677:	c9                   	leave
+  804678:	c3                   	ret
+
+0000000000804679 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  804679:	55                   	push   %rbp
+  80467a:	48 89 e5             	mov    %rsp,%rbp
+  80467d:	41 57                	push   %r15
+  80467f:	53                   	push   %rbx
+  804680:	48 83 ec 40          	sub    $0x40,%rsp
+  804684:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804684 <write+0xb>
+  80468b:	49 bb c4 49 00 00 00 	movabs $0x49c4,%r11
+  804692:	00 00 00 
+  804695:	4c 01 db             	add    %r11,%rbx
+  804698:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80469b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80469f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8046a3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8046a7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8046aa:	48 89 d6             	mov    %rdx,%rsi
+  8046ad:	89 c7                	mov    %eax,%edi
+  8046af:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  8046b6:	ff ff ff 
+  8046b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046bd:	ff d0                	call   *%rax
+  8046bf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046c6:	78 28                	js     8046f0 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8046c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046cc:	8b 00                	mov    (%rax),%eax
+  8046ce:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8046d2:	48 89 d6             	mov    %rdx,%rsi
+  8046d5:	89 c7                	mov    %eax,%edi
+  8046d7:	48 b8 ea b0 ff ff ff 	movabs $0xffffffffffffb0ea,%rax
+  8046de:	ff ff ff 
+  8046e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046e5:	ff d0                	call   *%rax
+  8046e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046ee:	79 08                	jns    8046f8 <write+0x7f>
+		return r;
+  8046f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046f3:	e9 8a 00 00 00       	jmp    804782 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8046f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046fc:	8b 40 08             	mov    0x8(%rax),%eax
+  8046ff:	83 e0 03             	and    $0x3,%eax
+  804702:	85 c0                	test   %eax,%eax
+  804704:	75 4b                	jne    804751 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  804706:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80470d:	ff ff ff 
+  804710:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804714:	48 8b 00             	mov    (%rax),%rax
+  804717:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80471d:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804720:	89 c6                	mov    %eax,%esi
+  804722:	48 b8 e3 e5 ff ff ff 	movabs $0xffffffffffffe5e3,%rax
+  804729:	ff ff ff 
+  80472c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804730:	48 89 c7             	mov    %rax,%rdi
+  804733:	49 89 df             	mov    %rbx,%r15
+  804736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80473b:	48 b9 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rcx
+  804742:	ff ff ff 
+  804745:	48 01 d9             	add    %rbx,%rcx
+  804748:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80474a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80474f:	eb 31                	jmp    804782 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  804751:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804755:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804759:	48 85 c0             	test   %rax,%rax
+  80475c:	75 07                	jne    804765 <write+0xec>
+		return -E_NOT_SUPP;
+  80475e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804763:	eb 1d                	jmp    804782 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  804765:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804769:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80476d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804771:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804775:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804779:	48 89 ce             	mov    %rcx,%rsi
+  80477c:	48 89 c7             	mov    %rax,%rdi
+  80477f:	41 ff d0             	call   *%r8
+}
+  804782:	48 83 c4 40          	add    $0x40,%rsp
+  804786:	5b                   	pop    %rbx
+  804787:	41 5f                	pop    %r15
+  804789:	5d                   	pop    %rbp
+  80478a:	c3                   	ret
+
+000000000080478b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80478b:	55                   	push   %rbp
+  80478c:	48 89 e5             	mov    %rsp,%rbp
+  80478f:	48 83 ec 18          	sub    $0x18,%rsp
+  804793:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804793 <seek+0x8>
+  80479a:	49 bb b5 48 00 00 00 	movabs $0x48b5,%r11
+  8047a1:	00 00 00 
+  8047a4:	4c 01 d8             	add    %r11,%rax
+  8047a7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8047aa:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8047ad:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8047b1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8047b4:	48 89 ce             	mov    %rcx,%rsi
+  8047b7:	89 d7                	mov    %edx,%edi
+  8047b9:	48 ba 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rdx
+  8047c0:	ff ff ff 
+  8047c3:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8047c7:	ff d0                	call   *%rax
+  8047c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047cc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047d0:	79 05                	jns    8047d7 <seek+0x4c>
+		return r;
+  8047d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047d5:	eb 0f                	jmp    8047e6 <seek+0x5b>
+	fd->fd_offset = offset;
+  8047d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047db:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8047de:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8047e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047e6:	c9                   	leave
+  8047e7:	c3                   	ret
+
+00000000008047e8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8047e8:	55                   	push   %rbp
+  8047e9:	48 89 e5             	mov    %rsp,%rbp
+  8047ec:	41 57                	push   %r15
+  8047ee:	53                   	push   %rbx
+  8047ef:	48 83 ec 30          	sub    $0x30,%rsp
+  8047f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047f3 <ftruncate+0xb>
+  8047fa:	49 bb 55 48 00 00 00 	movabs $0x4855,%r11
+  804801:	00 00 00 
+  804804:	4c 01 db             	add    %r11,%rbx
+  804807:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80480a:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80480d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804811:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804814:	48 89 d6             	mov    %rdx,%rsi
+  804817:	89 c7                	mov    %eax,%edi
+  804819:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  804820:	ff ff ff 
+  804823:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804827:	ff d0                	call   *%rax
+  804829:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80482c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804830:	78 28                	js     80485a <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804832:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804836:	8b 00                	mov    (%rax),%eax
+  804838:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80483c:	48 89 d6             	mov    %rdx,%rsi
+  80483f:	89 c7                	mov    %eax,%edi
+  804841:	48 b8 ea b0 ff ff ff 	movabs $0xffffffffffffb0ea,%rax
+  804848:	ff ff ff 
+  80484b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80484f:	ff d0                	call   *%rax
+  804851:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804854:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804858:	79 08                	jns    804862 <ftruncate+0x7a>
+		return r;
+  80485a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80485d:	e9 83 00 00 00       	jmp    8048e5 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804862:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804866:	8b 40 08             	mov    0x8(%rax),%eax
+  804869:	83 e0 03             	and    $0x3,%eax
+  80486c:	85 c0                	test   %eax,%eax
+  80486e:	75 4b                	jne    8048bb <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804870:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804877:	ff ff ff 
+  80487a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80487e:	48 8b 00             	mov    (%rax),%rax
+  804881:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804887:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80488a:	89 c6                	mov    %eax,%esi
+  80488c:	48 b8 00 e6 ff ff ff 	movabs $0xffffffffffffe600,%rax
+  804893:	ff ff ff 
+  804896:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80489a:	48 89 c7             	mov    %rax,%rdi
+  80489d:	49 89 df             	mov    %rbx,%r15
+  8048a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048a5:	48 b9 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rcx
+  8048ac:	ff ff ff 
+  8048af:	48 01 d9             	add    %rbx,%rcx
+  8048b2:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8048b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8048b9:	eb 2a                	jmp    8048e5 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8048bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048bf:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8048c3:	48 85 c0             	test   %rax,%rax
+  8048c6:	75 07                	jne    8048cf <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8048c8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8048cd:	eb 16                	jmp    8048e5 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8048cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048d3:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8048d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048db:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8048de:	89 d6                	mov    %edx,%esi
+  8048e0:	48 89 c7             	mov    %rax,%rdi
+  8048e3:	ff d1                	call   *%rcx
+}
+  8048e5:	48 83 c4 30          	add    $0x30,%rsp
+  8048e9:	5b                   	pop    %rbx
+  8048ea:	41 5f                	pop    %r15
+  8048ec:	5d                   	pop    %rbp
+  8048ed:	c3                   	ret
+
+00000000008048ee <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8048ee:	55                   	push   %rbp
+  8048ef:	48 89 e5             	mov    %rsp,%rbp
+  8048f2:	53                   	push   %rbx
+  8048f3:	48 83 ec 38          	sub    $0x38,%rsp
+  8048f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048f7 <fstat+0x9>
+  8048fe:	49 bb 51 47 00 00 00 	movabs $0x4751,%r11
+  804905:	00 00 00 
+  804908:	4c 01 db             	add    %r11,%rbx
+  80490b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80490e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804912:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804916:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804919:	48 89 d6             	mov    %rdx,%rsi
+  80491c:	89 c7                	mov    %eax,%edi
+  80491e:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  804925:	ff ff ff 
+  804928:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80492c:	ff d0                	call   *%rax
+  80492e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804931:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804935:	78 28                	js     80495f <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804937:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80493b:	8b 00                	mov    (%rax),%eax
+  80493d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804941:	48 89 d6             	mov    %rdx,%rsi
+  804944:	89 c7                	mov    %eax,%edi
+  804946:	48 b8 ea b0 ff ff ff 	movabs $0xffffffffffffb0ea,%rax
+  80494d:	ff ff ff 
+  804950:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804954:	ff d0                	call   *%rax
+  804956:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804959:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80495d:	79 05                	jns    804964 <fstat+0x76>
+		return r;
+  80495f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804962:	eb 5e                	jmp    8049c2 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804964:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804968:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80496c:	48 85 c0             	test   %rax,%rax
+  80496f:	75 07                	jne    804978 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804971:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804976:	eb 4a                	jmp    8049c2 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804978:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80497c:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80497f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804983:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80498a:	00 00 00 
+	stat->st_isdir = 0;
+  80498d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804991:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804998:	00 00 00 
+	stat->st_dev = dev;
+  80499b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80499f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049a3:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8049aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049ae:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8049b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8049ba:	48 89 d6             	mov    %rdx,%rsi
+  8049bd:	48 89 c7             	mov    %rax,%rdi
+  8049c0:	ff d1                	call   *%rcx
+}
+  8049c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8049c6:	c9                   	leave
+  8049c7:	c3                   	ret
+
+00000000008049c8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8049c8:	55                   	push   %rbp
+  8049c9:	48 89 e5             	mov    %rsp,%rbp
+  8049cc:	41 57                	push   %r15
+  8049ce:	53                   	push   %rbx
+  8049cf:	48 83 ec 20          	sub    $0x20,%rsp
+  8049d3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049d3 <stat+0xb>
+  8049da:	49 bb 75 46 00 00 00 	movabs $0x4675,%r11
+  8049e1:	00 00 00 
+  8049e4:	4c 01 db             	add    %r11,%rbx
+  8049e7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8049eb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8049ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8049f8:	48 89 c7             	mov    %rax,%rdi
+  8049fb:	49 89 df             	mov    %rbx,%r15
+  8049fe:	48 b8 5a bc ff ff ff 	movabs $0xffffffffffffbc5a,%rax
+  804a05:	ff ff ff 
+  804a08:	48 01 d8             	add    %rbx,%rax
+  804a0b:	ff d0                	call   *%rax
+  804a0d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a10:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a14:	79 05                	jns    804a1b <stat+0x53>
+		return fd;
+  804a16:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a19:	eb 37                	jmp    804a52 <stat+0x8a>
+	r = fstat(fd, stat);
+  804a1b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804a1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a22:	48 89 d6             	mov    %rdx,%rsi
+  804a25:	89 c7                	mov    %eax,%edi
+  804a27:	48 b8 a6 b8 ff ff ff 	movabs $0xffffffffffffb8a6,%rax
+  804a2e:	ff ff ff 
+  804a31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a35:	ff d0                	call   *%rax
+  804a37:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  804a3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a3d:	89 c7                	mov    %eax,%edi
+  804a3f:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  804a46:	ff ff ff 
+  804a49:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a4d:	ff d0                	call   *%rax
+	return r;
+  804a4f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804a52:	48 83 c4 20          	add    $0x20,%rsp
+  804a56:	5b                   	pop    %rbx
+  804a57:	41 5f                	pop    %r15
+  804a59:	5d                   	pop    %rbp
+  804a5a:	c3                   	ret
+
+0000000000804a5b <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  804a5b:	55                   	push   %rbp
+  804a5c:	48 89 e5             	mov    %rsp,%rbp
+  804a5f:	41 57                	push   %r15
+  804a61:	53                   	push   %rbx
+  804a62:	48 83 ec 10          	sub    $0x10,%rsp
+  804a66:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a66 <fsipc+0xb>
+  804a6d:	49 bb e2 45 00 00 00 	movabs $0x45e2,%r11
+  804a74:	00 00 00 
+  804a77:	4c 01 db             	add    %r11,%rbx
+  804a7a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804a7d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804a81:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  804a88:	00 00 00 
+  804a8b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a8e:	85 c0                	test   %eax,%eax
+  804a90:	75 24                	jne    804ab6 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804a92:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a97:	49 89 df             	mov    %rbx,%r15
+  804a9a:	48 b8 85 ad ff ff ff 	movabs $0xffffffffffffad85,%rax
+  804aa1:	ff ff ff 
+  804aa4:	48 01 d8             	add    %rbx,%rax
+  804aa7:	ff d0                	call   *%rax
+  804aa9:	48 ba e0 1f 00 00 00 	movabs $0x1fe0,%rdx
+  804ab0:	00 00 00 
+  804ab3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  804ab6:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  804abd:	00 00 00 
+  804ac0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ac3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804ac7:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804aca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804ad0:	49 89 d0             	mov    %rdx,%r8
+  804ad3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804ad8:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  804adf:	00 00 00 
+  804ae2:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804ae6:	89 c7                	mov    %eax,%edi
+  804ae8:	49 89 df             	mov    %rbx,%r15
+  804aeb:	48 b8 a4 a7 ff ff ff 	movabs $0xffffffffffffa7a4,%rax
+  804af2:	ff ff ff 
+  804af5:	48 01 d8             	add    %rbx,%rax
+  804af8:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804afa:	48 83 c4 10          	add    $0x10,%rsp
+  804afe:	5b                   	pop    %rbx
+  804aff:	41 5f                	pop    %r15
+  804b01:	5d                   	pop    %rbp
+  804b02:	c3                   	ret
+
+0000000000804b03 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804b03:	55                   	push   %rbp
+  804b04:	48 89 e5             	mov    %rsp,%rbp
+  804b07:	41 57                	push   %r15
+  804b09:	53                   	push   %rbx
+  804b0a:	48 83 ec 20          	sub    $0x20,%rsp
+  804b0e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b0e <fsipc_words+0xb>
+  804b15:	49 bb 3a 45 00 00 00 	movabs $0x453a,%r11
+  804b1c:	00 00 00 
+  804b1f:	4c 01 db             	add    %r11,%rbx
+  804b22:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804b25:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804b29:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804b2d:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  804b34:	00 00 00 
+  804b37:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b3a:	85 c0                	test   %eax,%eax
+  804b3c:	75 24                	jne    804b62 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804b3e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804b43:	49 89 df             	mov    %rbx,%r15
+  804b46:	48 b8 85 ad ff ff ff 	movabs $0xffffffffffffad85,%rax
+  804b4d:	ff ff ff 
+  804b50:	48 01 d8             	add    %rbx,%rax
+  804b53:	ff d0                	call   *%rax
+  804b55:	48 ba e0 1f 00 00 00 	movabs $0x1fe0,%rdx
+  804b5c:	00 00 00 
+  804b5f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804b62:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  804b69:	00 00 00 
+  804b6c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b6f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804b73:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804b77:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804b7a:	89 c7                	mov    %eax,%edi
+  804b7c:	49 89 df             	mov    %rbx,%r15
+  804b7f:	48 b8 8f a8 ff ff ff 	movabs $0xffffffffffffa88f,%rax
+  804b86:	ff ff ff 
+  804b89:	48 01 d8             	add    %rbx,%rax
+  804b8c:	ff d0                	call   *%rax
+}
+  804b8e:	48 83 c4 20          	add    $0x20,%rsp
+  804b92:	5b                   	pop    %rbx
+  804b93:	41 5f                	pop    %r15
+  804b95:	5d                   	pop    %rbp
+  804b96:	c3                   	ret
+
+0000000000804b97 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804b97:	55                   	push   %rbp
+  804b98:	48 89 e5             	mov    %rsp,%rbp
+  804b9b:	41 57                	push   %r15
+  804b9d:	53                   	push   %rbx
+  804b9e:	48 83 ec 40          	sub    $0x40,%rsp
+  804ba2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ba2 <fsipc_pages+0xb>
+  804ba9:	49 bb a6 44 00 00 00 	movabs $0x44a6,%r11
+  804bb0:	00 00 00 
+  804bb3:	4c 01 db             	add    %r11,%rbx
+  804bb6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804bb9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804bbd:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804bc1:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804bc4:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  804bcb:	00 00 00 
+  804bce:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804bd1:	85 c0                	test   %eax,%eax
+  804bd3:	75 24                	jne    804bf9 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804bd5:	bf 01 00 00 00       	mov    $0x1,%edi
+  804bda:	49 89 df             	mov    %rbx,%r15
+  804bdd:	48 b8 85 ad ff ff ff 	movabs $0xffffffffffffad85,%rax
+  804be4:	ff ff ff 
+  804be7:	48 01 d8             	add    %rbx,%rax
+  804bea:	ff d0                	call   *%rax
+  804bec:	48 ba e0 1f 00 00 00 	movabs $0x1fe0,%rdx
+  804bf3:	00 00 00 
+  804bf6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804bf9:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804bfe:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804c02:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804c05:	48 98                	cltq
+  804c07:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804c0b:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804c0f:	0f 95 c0             	setne  %al
+  804c12:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804c15:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804c1c:	00 
+  804c1d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804c21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c25:	48 01 d0             	add    %rdx,%rax
+  804c28:	48 83 e8 01          	sub    $0x1,%rax
+  804c2c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804c30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c39:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804c3d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c41:	48 29 d0             	sub    %rdx,%rax
+  804c44:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804c48:	41 89 c2             	mov    %eax,%r10d
+  804c4b:	48 b8 e0 1f 00 00 00 	movabs $0x1fe0,%rax
+  804c52:	00 00 00 
+  804c55:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c58:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804c5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804c60:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804c63:	48 83 ec 08          	sub    $0x8,%rsp
+  804c67:	6a 40                	push   $0x40
+  804c69:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804c6e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804c75:	00 
+  804c76:	6a 05                	push   $0x5
+  804c78:	41 89 f9             	mov    %edi,%r9d
+  804c7b:	49 89 c8             	mov    %rcx,%r8
+  804c7e:	44 89 d1             	mov    %r10d,%ecx
+  804c81:	89 c7                	mov    %eax,%edi
+  804c83:	49 89 df             	mov    %rbx,%r15
+  804c86:	48 b8 8d a9 ff ff ff 	movabs $0xffffffffffffa98d,%rax
+  804c8d:	ff ff ff 
+  804c90:	48 01 d8             	add    %rbx,%rax
+  804c93:	ff d0                	call   *%rax
+  804c95:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804c99:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804c9d:	5b                   	pop    %rbx
+  804c9e:	41 5f                	pop    %r15
+  804ca0:	5d                   	pop    %rbp
+  804ca1:	c3                   	ret
+
+0000000000804ca2 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804ca2:	55                   	push   %rbp
+  804ca3:	48 89 e5             	mov    %rsp,%rbp
+  804ca6:	41 57                	push   %r15
+  804ca8:	53                   	push   %rbx
+  804ca9:	48 83 ec 20          	sub    $0x20,%rsp
+  804cad:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cad <open+0xb>
+  804cb4:	49 bb 9b 43 00 00 00 	movabs $0x439b,%r11
+  804cbb:	00 00 00 
+  804cbe:	4c 01 db             	add    %r11,%rbx
+  804cc1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804cc5:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804cc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ccc:	48 89 c7             	mov    %rax,%rdi
+  804ccf:	49 89 df             	mov    %rbx,%r15
+  804cd2:	48 b8 c3 85 ff ff ff 	movabs $0xffffffffffff85c3,%rax
+  804cd9:	ff ff ff 
+  804cdc:	48 01 d8             	add    %rbx,%rax
+  804cdf:	ff d0                	call   *%rax
+  804ce1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804ce6:	7e 0a                	jle    804cf2 <open+0x50>
+		return -E_BAD_PATH;
+  804ce8:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804ced:	e9 18 01 00 00       	jmp    804e0a <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804cf2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804cf6:	48 89 c7             	mov    %rax,%rdi
+  804cf9:	49 89 df             	mov    %rbx,%r15
+  804cfc:	48 b8 8e ae ff ff ff 	movabs $0xffffffffffffae8e,%rax
+  804d03:	ff ff ff 
+  804d06:	48 01 d8             	add    %rbx,%rax
+  804d09:	ff d0                	call   *%rax
+  804d0b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d0e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d12:	74 08                	je     804d1c <open+0x7a>
+		return r;
+  804d14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d17:	e9 ee 00 00 00       	jmp    804e0a <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804d1c:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  804d23:	00 00 00 
+  804d26:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804d29:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804d30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d34:	48 89 c6             	mov    %rax,%rsi
+  804d37:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  804d3e:	00 00 00 
+  804d41:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d45:	48 89 c7             	mov    %rax,%rdi
+  804d48:	49 89 df             	mov    %rbx,%r15
+  804d4b:	48 b8 57 86 ff ff ff 	movabs $0xffffffffffff8657,%rax
+  804d52:	ff ff ff 
+  804d55:	48 01 d8             	add    %rbx,%rax
+  804d58:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804d5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d5e:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804d63:	48 89 c6             	mov    %rax,%rsi
+  804d66:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d6b:	49 89 df             	mov    %rbx,%r15
+  804d6e:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  804d75:	ff ff ff 
+  804d78:	48 01 d8             	add    %rbx,%rax
+  804d7b:	ff d0                	call   *%rax
+  804d7d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d80:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d84:	74 23                	je     804da9 <open+0x107>
+		fd_close(fd,0);
+  804d86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d8a:	be 00 00 00 00       	mov    $0x0,%esi
+  804d8f:	48 89 c7             	mov    %rax,%rdi
+  804d92:	49 89 df             	mov    %rbx,%r15
+  804d95:	48 b8 ef af ff ff ff 	movabs $0xffffffffffffafef,%rax
+  804d9c:	ff ff ff 
+  804d9f:	48 01 d8             	add    %rbx,%rax
+  804da2:	ff d0                	call   *%rax
+		return r;
+  804da4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804da7:	eb 61                	jmp    804e0a <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804da9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804dad:	48 89 c6             	mov    %rax,%rsi
+  804db0:	bf 01 00 00 00       	mov    $0x1,%edi
+  804db5:	48 b8 13 ba ff ff ff 	movabs $0xffffffffffffba13,%rax
+  804dbc:	ff ff ff 
+  804dbf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804dc3:	ff d0                	call   *%rax
+  804dc5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804dc8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804dcc:	74 23                	je     804df1 <open+0x14f>
+		fd_close(fd,0);
+  804dce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804dd2:	be 00 00 00 00       	mov    $0x0,%esi
+  804dd7:	48 89 c7             	mov    %rax,%rdi
+  804dda:	49 89 df             	mov    %rbx,%r15
+  804ddd:	48 b8 ef af ff ff ff 	movabs $0xffffffffffffafef,%rax
+  804de4:	ff ff ff 
+  804de7:	48 01 d8             	add    %rbx,%rax
+  804dea:	ff d0                	call   *%rax
+		return r;
+  804dec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804def:	eb 19                	jmp    804e0a <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804df1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804df5:	48 89 c7             	mov    %rax,%rdi
+  804df8:	49 89 df             	mov    %rbx,%r15
+  804dfb:	48 b8 14 ae ff ff ff 	movabs $0xffffffffffffae14,%rax
+  804e02:	ff ff ff 
+  804e05:	48 01 d8             	add    %rbx,%rax
+  804e08:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804e0a:	48 83 c4 20          	add    $0x20,%rsp
+  804e0e:	5b                   	pop    %rbx
+  804e0f:	41 5f                	pop    %r15
+  804e11:	5d                   	pop    %rbp
+  804e12:	c3                   	ret
+
+0000000000804e13 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804e13:	55                   	push   %rbp
+  804e14:	48 89 e5             	mov    %rsp,%rbp
+  804e17:	48 83 ec 20          	sub    $0x20,%rsp
+  804e1b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e1b <devfile_flush+0x8>
+  804e22:	49 bb 2d 42 00 00 00 	movabs $0x422d,%r11
+  804e29:	00 00 00 
+  804e2c:	4c 01 d8             	add    %r11,%rax
+  804e2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804e33:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804e37:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804e3a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804e3d:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804e41:	ba 04 00 00 00       	mov    $0x4,%edx
+  804e46:	48 89 ce             	mov    %rcx,%rsi
+  804e49:	bf 06 00 00 00       	mov    $0x6,%edi
+  804e4e:	48 b9 bb ba ff ff ff 	movabs $0xffffffffffffbabb,%rcx
+  804e55:	ff ff ff 
+  804e58:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804e5c:	ff d0                	call   *%rax
+}
+  804e5e:	c9                   	leave
+  804e5f:	c3                   	ret
+
+0000000000804e60 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804e60:	55                   	push   %rbp
+  804e61:	48 89 e5             	mov    %rsp,%rbp
+  804e64:	41 57                	push   %r15
+  804e66:	53                   	push   %rbx
+  804e67:	48 83 ec 60          	sub    $0x60,%rsp
+  804e6b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e6b <devfile_read+0xb>
+  804e72:	49 bb dd 41 00 00 00 	movabs $0x41dd,%r11
+  804e79:	00 00 00 
+  804e7c:	4c 01 db             	add    %r11,%rbx
+  804e7f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804e83:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804e87:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804e8b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804e8f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804e93:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e97:	8b 50 0c             	mov    0xc(%rax),%edx
+  804e9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e9e:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804ea0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ea4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804ea8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804eac:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804eb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804eb5:	ba 10 00 00 00       	mov    $0x10,%edx
+  804eba:	48 89 c6             	mov    %rax,%rsi
+  804ebd:	bf 03 00 00 00       	mov    $0x3,%edi
+  804ec2:	48 b8 4f bb ff ff ff 	movabs $0xffffffffffffbb4f,%rax
+  804ec9:	ff ff ff 
+  804ecc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ed0:	ff d0                	call   *%rax
+  804ed2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804ed5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804ed9:	79 05                	jns    804ee0 <devfile_read+0x80>
+		return r;
+  804edb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ede:	eb 64                	jmp    804f44 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804ee0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ee3:	48 63 d0             	movslq %eax,%rdx
+  804ee6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804eea:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804eef:	48 01 c1             	add    %rax,%rcx
+  804ef2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804ef6:	48 89 ce             	mov    %rcx,%rsi
+  804ef9:	48 89 c7             	mov    %rax,%rdi
+  804efc:	49 89 df             	mov    %rbx,%r15
+  804eff:	48 b8 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rax
+  804f06:	ff ff ff 
+  804f09:	48 01 d8             	add    %rbx,%rax
+  804f0c:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804f0e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804f15:	ff ff ff 
+  804f18:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f1c:	48 8b 00             	mov    (%rax),%rax
+  804f1f:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804f25:	89 c6                	mov    %eax,%esi
+  804f27:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804f2c:	48 89 c7             	mov    %rax,%rdi
+  804f2f:	49 89 df             	mov    %rbx,%r15
+  804f32:	48 b8 3f ad ff ff ff 	movabs $0xffffffffffffad3f,%rax
+  804f39:	ff ff ff 
+  804f3c:	48 01 d8             	add    %rbx,%rax
+  804f3f:	ff d0                	call   *%rax
+	return r;
+  804f41:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804f44:	48 83 c4 60          	add    $0x60,%rsp
+  804f48:	5b                   	pop    %rbx
+  804f49:	41 5f                	pop    %r15
+  804f4b:	5d                   	pop    %rbp
+  804f4c:	c3                   	ret
+
+0000000000804f4d <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804f4d:	55                   	push   %rbp
+  804f4e:	48 89 e5             	mov    %rsp,%rbp
+  804f51:	41 57                	push   %r15
+  804f53:	53                   	push   %rbx
+  804f54:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804f58:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f58 <devfile_write+0xb>
+  804f5f:	49 bb f0 40 00 00 00 	movabs $0x40f0,%r11
+  804f66:	00 00 00 
+  804f69:	4c 01 db             	add    %r11,%rbx
+  804f6c:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804f70:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804f74:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804f7b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804f7f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804f83:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804f8a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804f8e:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804f95:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f98:	48 63 d0             	movslq %eax,%rdx
+  804f9b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f9f:	48 39 c2             	cmp    %rax,%rdx
+  804fa2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804fa6:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804fad:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804fb4:	00 
+  804fb5:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804fbc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fc0:	48 01 d0             	add    %rdx,%rax
+  804fc3:	48 83 e8 01          	sub    $0x1,%rax
+  804fc7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804fcb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fd4:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804fd8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fdc:	48 29 d0             	sub    %rdx,%rax
+  804fdf:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fe3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804fe6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804fe9:	89 c6                	mov    %eax,%esi
+  804feb:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804ff0:	48 89 c7             	mov    %rax,%rdi
+  804ff3:	49 89 df             	mov    %rbx,%r15
+  804ff6:	48 b8 f9 ac ff ff ff 	movabs $0xffffffffffffacf9,%rax
+  804ffd:	ff ff ff 
+  805000:	48 01 d8             	add    %rbx,%rax
+  805003:	ff d0                	call   *%rax
+  805005:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  805008:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  80500c:	79 08                	jns    805016 <devfile_write+0xc9>
+		return r;
+  80500e:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  805011:	e9 8f 00 00 00       	jmp    8050a5 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  805016:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80501d:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  805021:	48 89 c6             	mov    %rax,%rsi
+  805024:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  805029:	48 89 c7             	mov    %rax,%rdi
+  80502c:	49 89 df             	mov    %rbx,%r15
+  80502f:	48 b8 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rax
+  805036:	ff ff ff 
+  805039:	48 01 d8             	add    %rbx,%rax
+  80503c:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  80503e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  805042:	8b 50 0c             	mov    0xc(%rax),%edx
+  805045:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805049:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80504b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80504f:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  805056:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  80505a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80505d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805061:	89 d1                	mov    %edx,%ecx
+  805063:	ba 10 00 00 00       	mov    $0x10,%edx
+  805068:	48 89 c6             	mov    %rax,%rsi
+  80506b:	bf 04 00 00 00       	mov    $0x4,%edi
+  805070:	48 b8 4f bb ff ff ff 	movabs $0xffffffffffffbb4f,%rax
+  805077:	ff ff ff 
+  80507a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80507e:	ff d0                	call   *%rax
+  805080:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  805083:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805086:	89 c6                	mov    %eax,%esi
+  805088:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80508d:	48 89 c7             	mov    %rax,%rdi
+  805090:	49 89 df             	mov    %rbx,%r15
+  805093:	48 b8 3f ad ff ff ff 	movabs $0xffffffffffffad3f,%rax
+  80509a:	ff ff ff 
+  80509d:	48 01 d8             	add    %rbx,%rax
+  8050a0:	ff d0                	call   *%rax
+	return r;
+  8050a2:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  8050a5:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  8050a9:	5b                   	pop    %rbx
+  8050aa:	41 5f                	pop    %r15
+  8050ac:	5d                   	pop    %rbp
+  8050ad:	c3                   	ret
+
+00000000008050ae <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  8050ae:	55                   	push   %rbp
+  8050af:	48 89 e5             	mov    %rsp,%rbp
+  8050b2:	41 57                	push   %r15
+  8050b4:	53                   	push   %rbx
+  8050b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8050b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050b9 <devfile_stat+0xb>
+  8050c0:	49 bb 8f 3f 00 00 00 	movabs $0x3f8f,%r11
+  8050c7:	00 00 00 
+  8050ca:	4c 01 db             	add    %r11,%rbx
+  8050cd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8050d1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8050d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050d9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8050dc:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  8050e3:	00 00 00 
+  8050e6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8050e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8050ee:	bf 05 00 00 00       	mov    $0x5,%edi
+  8050f3:	48 b8 13 ba ff ff ff 	movabs $0xffffffffffffba13,%rax
+  8050fa:	ff ff ff 
+  8050fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805101:	ff d0                	call   *%rax
+  805103:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805106:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80510a:	79 05                	jns    805111 <devfile_stat+0x63>
+		return r;
+  80510c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80510f:	eb 65                	jmp    805176 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  805111:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805115:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  80511c:	00 00 00 
+  80511f:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805123:	48 89 d6             	mov    %rdx,%rsi
+  805126:	48 89 c7             	mov    %rax,%rdi
+  805129:	49 89 df             	mov    %rbx,%r15
+  80512c:	48 b8 57 86 ff ff ff 	movabs $0xffffffffffff8657,%rax
+  805133:	ff ff ff 
+  805136:	48 01 d8             	add    %rbx,%rax
+  805139:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80513b:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  805142:	00 00 00 
+  805145:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  80514c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805150:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  805156:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  80515d:	00 00 00 
+  805160:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  805167:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80516b:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  805171:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805176:	48 83 c4 20          	add    $0x20,%rsp
+  80517a:	5b                   	pop    %rbx
+  80517b:	41 5f                	pop    %r15
+  80517d:	5d                   	pop    %rbp
+  80517e:	c3                   	ret
+
+000000000080517f <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80517f:	55                   	push   %rbp
+  805180:	48 89 e5             	mov    %rsp,%rbp
+  805183:	48 83 ec 20          	sub    $0x20,%rsp
+  805187:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805187 <devfile_trunc+0x8>
+  80518e:	49 bb c1 3e 00 00 00 	movabs $0x3ec1,%r11
+  805195:	00 00 00 
+  805198:	4c 01 d8             	add    %r11,%rax
+  80519b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80519f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  8051a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8051a6:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8051a9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  8051ac:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8051af:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8051b2:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8051b6:	ba 08 00 00 00       	mov    $0x8,%edx
+  8051bb:	48 89 ce             	mov    %rcx,%rsi
+  8051be:	bf 02 00 00 00       	mov    $0x2,%edi
+  8051c3:	48 b9 bb ba ff ff ff 	movabs $0xffffffffffffbabb,%rcx
+  8051ca:	ff ff ff 
+  8051cd:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8051d1:	ff d0                	call   *%rax
+}
+  8051d3:	c9                   	leave
+  8051d4:	c3                   	ret
+
+00000000008051d5 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8051d5:	55                   	push   %rbp
+  8051d6:	48 89 e5             	mov    %rsp,%rbp
+  8051d9:	41 57                	push   %r15
+  8051db:	53                   	push   %rbx
+  8051dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8051e0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051e0 <remove+0xb>
+  8051e7:	49 bb 68 3e 00 00 00 	movabs $0x3e68,%r11
+  8051ee:	00 00 00 
+  8051f1:	4c 01 db             	add    %r11,%rbx
+  8051f4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8051f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051fc:	48 89 c7             	mov    %rax,%rdi
+  8051ff:	49 89 df             	mov    %rbx,%r15
+  805202:	48 b8 c3 85 ff ff ff 	movabs $0xffffffffffff85c3,%rax
+  805209:	ff ff ff 
+  80520c:	48 01 d8             	add    %rbx,%rax
+  80520f:	ff d0                	call   *%rax
+  805211:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  805216:	7e 07                	jle    80521f <remove+0x4a>
+		return -E_BAD_PATH;
+  805218:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80521d:	eb 44                	jmp    805263 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80521f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805223:	48 89 c6             	mov    %rax,%rsi
+  805226:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  80522d:	00 00 00 
+  805230:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805234:	48 89 c7             	mov    %rax,%rdi
+  805237:	49 89 df             	mov    %rbx,%r15
+  80523a:	48 b8 57 86 ff ff ff 	movabs $0xffffffffffff8657,%rax
+  805241:	ff ff ff 
+  805244:	48 01 d8             	add    %rbx,%rax
+  805247:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  805249:	be 00 00 00 00       	mov    $0x0,%esi
+  80524e:	bf 07 00 00 00       	mov    $0x7,%edi
+  805253:	48 b8 13 ba ff ff ff 	movabs $0xffffffffffffba13,%rax
+  80525a:	ff ff ff 
+  80525d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805261:	ff d0                	call   *%rax
+}
+  805263:	48 83 c4 10          	add    $0x10,%rsp
+  805267:	5b                   	pop    %rbx
+  805268:	41 5f                	pop    %r15
+  80526a:	5d                   	pop    %rbp
+  80526b:	c3                   	ret
+
+000000000080526c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80526c:	55                   	push   %rbp
+  80526d:	48 89 e5             	mov    %rsp,%rbp
+  805270:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805270 <sync+0x4>
+  805277:	49 bb d8 3d 00 00 00 	movabs $0x3dd8,%r11
+  80527e:	00 00 00 
+  805281:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  805284:	ba 00 00 00 00       	mov    $0x0,%edx
+  805289:	be 00 00 00 00       	mov    $0x0,%esi
+  80528e:	bf 08 00 00 00       	mov    $0x8,%edi
+  805293:	48 b9 bb ba ff ff ff 	movabs $0xffffffffffffbabb,%rcx
+  80529a:	ff ff ff 
+  80529d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8052a1:	ff d0                	call   *%rax
+}
+  8052a3:	5d                   	pop    %rbp
+  8052a4:	c3                   	ret
+
+00000000008052a5 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  8052a5:	55                   	push   %rbp
+  8052a6:	48 89 e5             	mov    %rsp,%rbp
+  8052a9:	41 57                	push   %r15
+  8052ab:	53                   	push   %rbx
+  8052ac:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8052b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052b3 <copy+0xe>
+  8052ba:	49 bb 95 3d 00 00 00 	movabs $0x3d95,%r11
+  8052c1:	00 00 00 
+  8052c4:	4c 01 db             	add    %r11,%rbx
+  8052c7:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8052ce:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8052d5:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8052dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8052e1:	48 89 c7             	mov    %rax,%rdi
+  8052e4:	48 b8 5a bc ff ff ff 	movabs $0xffffffffffffbc5a,%rax
+  8052eb:	ff ff ff 
+  8052ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052f2:	ff d0                	call   *%rax
+  8052f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8052f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052fb:	79 35                	jns    805332 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8052fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805300:	89 c6                	mov    %eax,%esi
+  805302:	48 b8 26 e6 ff ff ff 	movabs $0xffffffffffffe626,%rax
+  805309:	ff ff ff 
+  80530c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805310:	48 89 c7             	mov    %rax,%rdi
+  805313:	49 89 df             	mov    %rbx,%r15
+  805316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80531b:	48 ba 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rdx
+  805322:	ff ff ff 
+  805325:	48 01 da             	add    %rbx,%rdx
+  805328:	ff d2                	call   *%rdx
+		return fd_src;
+  80532a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80532d:	e9 d7 01 00 00       	jmp    805509 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  805332:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  805339:	be 01 01 00 00       	mov    $0x101,%esi
+  80533e:	48 89 c7             	mov    %rax,%rdi
+  805341:	48 b8 5a bc ff ff ff 	movabs $0xffffffffffffbc5a,%rax
+  805348:	ff ff ff 
+  80534b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80534f:	ff d0                	call   *%rax
+  805351:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  805354:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  805358:	0f 89 df 00 00 00    	jns    80543d <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  80535e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805361:	89 c6                	mov    %eax,%esi
+  805363:	48 b8 3c e6 ff ff ff 	movabs $0xffffffffffffe63c,%rax
+  80536a:	ff ff ff 
+  80536d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805371:	48 89 c7             	mov    %rax,%rdi
+  805374:	49 89 df             	mov    %rbx,%r15
+  805377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80537c:	48 ba 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rdx
+  805383:	ff ff ff 
+  805386:	48 01 da             	add    %rbx,%rdx
+  805389:	ff d2                	call   *%rdx
+		close(fd_src);
+  80538b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80538e:	89 c7                	mov    %eax,%edi
+  805390:	49 89 df             	mov    %rbx,%r15
+  805393:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  80539a:	ff ff ff 
+  80539d:	48 01 d8             	add    %rbx,%rax
+  8053a0:	ff d0                	call   *%rax
+		return fd_dest;
+  8053a2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053a5:	e9 5f 01 00 00       	jmp    805509 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  8053aa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8053ad:	48 63 d0             	movslq %eax,%rdx
+  8053b0:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8053b7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053ba:	48 89 ce             	mov    %rcx,%rsi
+  8053bd:	89 c7                	mov    %eax,%edi
+  8053bf:	49 89 df             	mov    %rbx,%r15
+  8053c2:	48 b8 31 b6 ff ff ff 	movabs $0xffffffffffffb631,%rax
+  8053c9:	ff ff ff 
+  8053cc:	48 01 d8             	add    %rbx,%rax
+  8053cf:	ff d0                	call   *%rax
+  8053d1:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8053d4:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8053d8:	79 63                	jns    80543d <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8053da:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8053dd:	89 c6                	mov    %eax,%esi
+  8053df:	48 b8 56 e6 ff ff ff 	movabs $0xffffffffffffe656,%rax
+  8053e6:	ff ff ff 
+  8053e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053ed:	48 89 c7             	mov    %rax,%rdi
+  8053f0:	49 89 df             	mov    %rbx,%r15
+  8053f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053f8:	48 ba 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rdx
+  8053ff:	ff ff ff 
+  805402:	48 01 da             	add    %rbx,%rdx
+  805405:	ff d2                	call   *%rdx
+			close(fd_src);
+  805407:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80540a:	89 c7                	mov    %eax,%edi
+  80540c:	49 89 df             	mov    %rbx,%r15
+  80540f:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  805416:	ff ff ff 
+  805419:	48 01 d8             	add    %rbx,%rax
+  80541c:	ff d0                	call   *%rax
+			close(fd_dest);
+  80541e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805421:	89 c7                	mov    %eax,%edi
+  805423:	49 89 df             	mov    %rbx,%r15
+  805426:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  80542d:	ff ff ff 
+  805430:	48 01 d8             	add    %rbx,%rax
+  805433:	ff d0                	call   *%rax
+			return write_size;
+  805435:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805438:	e9 cc 00 00 00       	jmp    805509 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  80543d:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805444:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805447:	ba 00 02 00 00       	mov    $0x200,%edx
+  80544c:	48 89 ce             	mov    %rcx,%rsi
+  80544f:	89 c7                	mov    %eax,%edi
+  805451:	49 89 df             	mov    %rbx,%r15
+  805454:	48 b8 8b b4 ff ff ff 	movabs $0xffffffffffffb48b,%rax
+  80545b:	ff ff ff 
+  80545e:	48 01 d8             	add    %rbx,%rax
+  805461:	ff d0                	call   *%rax
+  805463:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805466:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80546a:	0f 8f 3a ff ff ff    	jg     8053aa <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805470:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805474:	79 60                	jns    8054d6 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  805476:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805479:	89 c6                	mov    %eax,%esi
+  80547b:	48 b8 69 e6 ff ff ff 	movabs $0xffffffffffffe669,%rax
+  805482:	ff ff ff 
+  805485:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805489:	48 89 c7             	mov    %rax,%rdi
+  80548c:	49 89 df             	mov    %rbx,%r15
+  80548f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805494:	48 ba 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rdx
+  80549b:	ff ff ff 
+  80549e:	48 01 da             	add    %rbx,%rdx
+  8054a1:	ff d2                	call   *%rdx
+		close(fd_src);
+  8054a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054a6:	89 c7                	mov    %eax,%edi
+  8054a8:	49 89 df             	mov    %rbx,%r15
+  8054ab:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  8054b2:	ff ff ff 
+  8054b5:	48 01 d8             	add    %rbx,%rax
+  8054b8:	ff d0                	call   *%rax
+		close(fd_dest);
+  8054ba:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8054bd:	89 c7                	mov    %eax,%edi
+  8054bf:	49 89 df             	mov    %rbx,%r15
+  8054c2:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  8054c9:	ff ff ff 
+  8054cc:	48 01 d8             	add    %rbx,%rax
+  8054cf:	ff d0                	call   *%rax
+		return read_size;
+  8054d1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8054d4:	eb 33                	jmp    805509 <copy+0x264>
+	}
+	close(fd_src);
+  8054d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054d9:	89 c7                	mov    %eax,%edi
+  8054db:	49 89 df             	mov    %rbx,%r15
+  8054de:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  8054e5:	ff ff ff 
+  8054e8:	48 01 d8             	add    %rbx,%rax
+  8054eb:	ff d0                	call   *%rax
+	close(fd_dest);
+  8054ed:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8054f0:	89 c7                	mov    %eax,%edi
+  8054f2:	49 89 df             	mov    %rbx,%r15
+  8054f5:	48 b8 d3 b1 ff ff ff 	movabs $0xffffffffffffb1d3,%rax
+  8054fc:	ff ff ff 
+  8054ff:	48 01 d8             	add    %rbx,%rax
+  805502:	ff d0                	call   *%rax
+	return 0;
+  805504:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  805509:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  805510:	5b                   	pop    %rbx
+  805511:	41 5f                	pop    %r15
+  805513:	5d                   	pop    %rbp
+  805514:	c3                   	ret
+
+0000000000805515 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805515:	55                   	push   %rbp
+  805516:	48 89 e5             	mov    %rsp,%rbp
+  805519:	41 57                	push   %r15
+  80551b:	53                   	push   %rbx
+  80551c:	48 83 ec 20          	sub    $0x20,%rsp
+  805520:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805520 <fd2sockid+0xb>
+  805527:	49 bb 28 3b 00 00 00 	movabs $0x3b28,%r11
+  80552e:	00 00 00 
+  805531:	4c 01 db             	add    %r11,%rbx
+  805534:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805537:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80553b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80553e:	48 89 d6             	mov    %rdx,%rsi
+  805541:	89 c7                	mov    %eax,%edi
+  805543:	49 89 df             	mov    %rbx,%r15
+  805546:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  80554d:	ff ff ff 
+  805550:	48 01 d8             	add    %rbx,%rax
+  805553:	ff d0                	call   *%rax
+  805555:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805558:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80555c:	79 05                	jns    805563 <fd2sockid+0x4e>
+		return r;
+  80555e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805561:	eb 25                	jmp    805588 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805563:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805567:	8b 10                	mov    (%rax),%edx
+  805569:	48 b8 78 00 00 00 00 	movabs $0x78,%rax
+  805570:	00 00 00 
+  805573:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805576:	39 c2                	cmp    %eax,%edx
+  805578:	74 07                	je     805581 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80557a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80557f:	eb 07                	jmp    805588 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  805581:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805585:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  805588:	48 83 c4 20          	add    $0x20,%rsp
+  80558c:	5b                   	pop    %rbx
+  80558d:	41 5f                	pop    %r15
+  80558f:	5d                   	pop    %rbp
+  805590:	c3                   	ret
+
+0000000000805591 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  805591:	55                   	push   %rbp
+  805592:	48 89 e5             	mov    %rsp,%rbp
+  805595:	41 57                	push   %r15
+  805597:	53                   	push   %rbx
+  805598:	48 83 ec 20          	sub    $0x20,%rsp
+  80559c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80559c <alloc_sockfd+0xb>
+  8055a3:	49 bb ac 3a 00 00 00 	movabs $0x3aac,%r11
+  8055aa:	00 00 00 
+  8055ad:	4c 01 db             	add    %r11,%rbx
+  8055b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8055b3:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8055b7:	48 89 c7             	mov    %rax,%rdi
+  8055ba:	49 89 df             	mov    %rbx,%r15
+  8055bd:	48 b8 8e ae ff ff ff 	movabs $0xffffffffffffae8e,%rax
+  8055c4:	ff ff ff 
+  8055c7:	48 01 d8             	add    %rbx,%rax
+  8055ca:	ff d0                	call   *%rax
+  8055cc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055cf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055d3:	78 2c                	js     805601 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8055d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055d9:	ba 07 04 00 00       	mov    $0x407,%edx
+  8055de:	48 89 c6             	mov    %rax,%rsi
+  8055e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055e6:	49 89 df             	mov    %rbx,%r15
+  8055e9:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  8055f0:	ff ff ff 
+  8055f3:	48 01 d8             	add    %rbx,%rax
+  8055f6:	ff d0                	call   *%rax
+  8055f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055ff:	79 1c                	jns    80561d <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805601:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805604:	89 c7                	mov    %eax,%edi
+  805606:	49 89 df             	mov    %rbx,%r15
+  805609:	48 b8 3d cd ff ff ff 	movabs $0xffffffffffffcd3d,%rax
+  805610:	ff ff ff 
+  805613:	48 01 d8             	add    %rbx,%rax
+  805616:	ff d0                	call   *%rax
+		return r;
+  805618:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80561b:	eb 41                	jmp    80565e <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80561d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805621:	48 ba 78 00 00 00 00 	movabs $0x78,%rdx
+  805628:	00 00 00 
+  80562b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80562e:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805630:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805634:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80563b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80563f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805642:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805645:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805649:	48 89 c7             	mov    %rax,%rdi
+  80564c:	49 89 df             	mov    %rbx,%r15
+  80564f:	48 b8 14 ae ff ff ff 	movabs $0xffffffffffffae14,%rax
+  805656:	ff ff ff 
+  805659:	48 01 d8             	add    %rbx,%rax
+  80565c:	ff d0                	call   *%rax
+}
+  80565e:	48 83 c4 20          	add    $0x20,%rsp
+  805662:	5b                   	pop    %rbx
+  805663:	41 5f                	pop    %r15
+  805665:	5d                   	pop    %rbp
+  805666:	c3                   	ret
+
+0000000000805667 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805667:	55                   	push   %rbp
+  805668:	48 89 e5             	mov    %rsp,%rbp
+  80566b:	41 57                	push   %r15
+  80566d:	53                   	push   %rbx
+  80566e:	48 83 ec 30          	sub    $0x30,%rsp
+  805672:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805672 <accept+0xb>
+  805679:	49 bb d6 39 00 00 00 	movabs $0x39d6,%r11
+  805680:	00 00 00 
+  805683:	4c 01 db             	add    %r11,%rbx
+  805686:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805689:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80568d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805691:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805694:	89 c7                	mov    %eax,%edi
+  805696:	48 b8 cd c4 ff ff ff 	movabs $0xffffffffffffc4cd,%rax
+  80569d:	ff ff ff 
+  8056a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056a4:	ff d0                	call   *%rax
+  8056a6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056ad:	79 05                	jns    8056b4 <accept+0x4d>
+		return r;
+  8056af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056b2:	eb 45                	jmp    8056f9 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8056b4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8056b8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8056bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056bf:	48 89 ce             	mov    %rcx,%rsi
+  8056c2:	89 c7                	mov    %eax,%edi
+  8056c4:	49 89 df             	mov    %rbx,%r15
+  8056c7:	48 b8 ab cb ff ff ff 	movabs $0xffffffffffffcbab,%rax
+  8056ce:	ff ff ff 
+  8056d1:	48 01 d8             	add    %rbx,%rax
+  8056d4:	ff d0                	call   *%rax
+  8056d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056dd:	79 05                	jns    8056e4 <accept+0x7d>
+		return r;
+  8056df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056e2:	eb 15                	jmp    8056f9 <accept+0x92>
+	return alloc_sockfd(r);
+  8056e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056e7:	89 c7                	mov    %eax,%edi
+  8056e9:	48 b8 49 c5 ff ff ff 	movabs $0xffffffffffffc549,%rax
+  8056f0:	ff ff ff 
+  8056f3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056f7:	ff d0                	call   *%rax
+}
+  8056f9:	48 83 c4 30          	add    $0x30,%rsp
+  8056fd:	5b                   	pop    %rbx
+  8056fe:	41 5f                	pop    %r15
+  805700:	5d                   	pop    %rbp
+  805701:	c3                   	ret
+
+0000000000805702 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805702:	55                   	push   %rbp
+  805703:	48 89 e5             	mov    %rsp,%rbp
+  805706:	41 57                	push   %r15
+  805708:	53                   	push   %rbx
+  805709:	48 83 ec 20          	sub    $0x20,%rsp
+  80570d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80570d <bind+0xb>
+  805714:	49 bb 3b 39 00 00 00 	movabs $0x393b,%r11
+  80571b:	00 00 00 
+  80571e:	4c 01 db             	add    %r11,%rbx
+  805721:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805724:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805728:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80572b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80572e:	89 c7                	mov    %eax,%edi
+  805730:	48 b8 cd c4 ff ff ff 	movabs $0xffffffffffffc4cd,%rax
+  805737:	ff ff ff 
+  80573a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80573e:	ff d0                	call   *%rax
+  805740:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805743:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805747:	79 05                	jns    80574e <bind+0x4c>
+		return r;
+  805749:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80574c:	eb 21                	jmp    80576f <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80574e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805751:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805755:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805758:	48 89 ce             	mov    %rcx,%rsi
+  80575b:	89 c7                	mov    %eax,%edi
+  80575d:	49 89 df             	mov    %rbx,%r15
+  805760:	48 b8 57 cc ff ff ff 	movabs $0xffffffffffffcc57,%rax
+  805767:	ff ff ff 
+  80576a:	48 01 d8             	add    %rbx,%rax
+  80576d:	ff d0                	call   *%rax
+}
+  80576f:	48 83 c4 20          	add    $0x20,%rsp
+  805773:	5b                   	pop    %rbx
+  805774:	41 5f                	pop    %r15
+  805776:	5d                   	pop    %rbp
+  805777:	c3                   	ret
+
+0000000000805778 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  805778:	55                   	push   %rbp
+  805779:	48 89 e5             	mov    %rsp,%rbp
+  80577c:	41 57                	push   %r15
+  80577e:	53                   	push   %rbx
+  80577f:	48 83 ec 20          	sub    $0x20,%rsp
+  805783:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805783 <shutdown+0xb>
+  80578a:	49 bb c5 38 00 00 00 	movabs $0x38c5,%r11
+  805791:	00 00 00 
+  805794:	4c 01 db             	add    %r11,%rbx
+  805797:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80579a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80579d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8057a0:	89 c7                	mov    %eax,%edi
+  8057a2:	48 b8 cd c4 ff ff ff 	movabs $0xffffffffffffc4cd,%rax
+  8057a9:	ff ff ff 
+  8057ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057b0:	ff d0                	call   *%rax
+  8057b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057b9:	79 05                	jns    8057c0 <shutdown+0x48>
+		return r;
+  8057bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057be:	eb 1c                	jmp    8057dc <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8057c0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8057c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057c6:	89 d6                	mov    %edx,%esi
+  8057c8:	89 c7                	mov    %eax,%edi
+  8057ca:	49 89 df             	mov    %rbx,%r15
+  8057cd:	48 b8 ec cc ff ff ff 	movabs $0xffffffffffffccec,%rax
+  8057d4:	ff ff ff 
+  8057d7:	48 01 d8             	add    %rbx,%rax
+  8057da:	ff d0                	call   *%rax
+}
+  8057dc:	48 83 c4 20          	add    $0x20,%rsp
+  8057e0:	5b                   	pop    %rbx
+  8057e1:	41 5f                	pop    %r15
+  8057e3:	5d                   	pop    %rbp
+  8057e4:	c3                   	ret
+
+00000000008057e5 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8057e5:	55                   	push   %rbp
+  8057e6:	48 89 e5             	mov    %rsp,%rbp
+  8057e9:	41 57                	push   %r15
+  8057eb:	53                   	push   %rbx
+  8057ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8057f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057f0 <devsock_close+0xb>
+  8057f7:	49 bb 58 38 00 00 00 	movabs $0x3858,%r11
+  8057fe:	00 00 00 
+  805801:	4c 01 db             	add    %r11,%rbx
+  805804:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805808:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80580c:	48 89 c7             	mov    %rax,%rdi
+  80580f:	49 89 df             	mov    %rbx,%r15
+  805812:	48 b8 9f de ff ff ff 	movabs $0xffffffffffffde9f,%rax
+  805819:	ff ff ff 
+  80581c:	48 01 d8             	add    %rbx,%rax
+  80581f:	ff d0                	call   *%rax
+  805821:	83 f8 01             	cmp    $0x1,%eax
+  805824:	75 1d                	jne    805843 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805826:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80582a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80582d:	89 c7                	mov    %eax,%edi
+  80582f:	49 89 df             	mov    %rbx,%r15
+  805832:	48 b8 3d cd ff ff ff 	movabs $0xffffffffffffcd3d,%rax
+  805839:	ff ff ff 
+  80583c:	48 01 d8             	add    %rbx,%rax
+  80583f:	ff d0                	call   *%rax
+  805841:	eb 05                	jmp    805848 <devsock_close+0x63>
+	else
+		return 0;
+  805843:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805848:	48 83 c4 10          	add    $0x10,%rsp
+  80584c:	5b                   	pop    %rbx
+  80584d:	41 5f                	pop    %r15
+  80584f:	5d                   	pop    %rbp
+  805850:	c3                   	ret
+
+0000000000805851 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805851:	55                   	push   %rbp
+  805852:	48 89 e5             	mov    %rsp,%rbp
+  805855:	41 57                	push   %r15
+  805857:	53                   	push   %rbx
+  805858:	48 83 ec 20          	sub    $0x20,%rsp
+  80585c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80585c <connect+0xb>
+  805863:	49 bb ec 37 00 00 00 	movabs $0x37ec,%r11
+  80586a:	00 00 00 
+  80586d:	4c 01 db             	add    %r11,%rbx
+  805870:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805873:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805877:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80587a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80587d:	89 c7                	mov    %eax,%edi
+  80587f:	48 b8 cd c4 ff ff ff 	movabs $0xffffffffffffc4cd,%rax
+  805886:	ff ff ff 
+  805889:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80588d:	ff d0                	call   *%rax
+  80588f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805892:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805896:	79 05                	jns    80589d <connect+0x4c>
+		return r;
+  805898:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80589b:	eb 21                	jmp    8058be <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80589d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8058a0:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8058a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058a7:	48 89 ce             	mov    %rcx,%rsi
+  8058aa:	89 c7                	mov    %eax,%edi
+  8058ac:	49 89 df             	mov    %rbx,%r15
+  8058af:	48 b8 85 cd ff ff ff 	movabs $0xffffffffffffcd85,%rax
+  8058b6:	ff ff ff 
+  8058b9:	48 01 d8             	add    %rbx,%rax
+  8058bc:	ff d0                	call   *%rax
+}
+  8058be:	48 83 c4 20          	add    $0x20,%rsp
+  8058c2:	5b                   	pop    %rbx
+  8058c3:	41 5f                	pop    %r15
+  8058c5:	5d                   	pop    %rbp
+  8058c6:	c3                   	ret
+
+00000000008058c7 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8058c7:	55                   	push   %rbp
+  8058c8:	48 89 e5             	mov    %rsp,%rbp
+  8058cb:	41 57                	push   %r15
+  8058cd:	53                   	push   %rbx
+  8058ce:	48 83 ec 20          	sub    $0x20,%rsp
+  8058d2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058d2 <listen+0xb>
+  8058d9:	49 bb 76 37 00 00 00 	movabs $0x3776,%r11
+  8058e0:	00 00 00 
+  8058e3:	4c 01 db             	add    %r11,%rbx
+  8058e6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8058e9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8058ec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058ef:	89 c7                	mov    %eax,%edi
+  8058f1:	48 b8 cd c4 ff ff ff 	movabs $0xffffffffffffc4cd,%rax
+  8058f8:	ff ff ff 
+  8058fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058ff:	ff d0                	call   *%rax
+  805901:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805904:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805908:	79 05                	jns    80590f <listen+0x48>
+		return r;
+  80590a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80590d:	eb 1c                	jmp    80592b <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80590f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805912:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805915:	89 d6                	mov    %edx,%esi
+  805917:	89 c7                	mov    %eax,%edi
+  805919:	49 89 df             	mov    %rbx,%r15
+  80591c:	48 b8 1a ce ff ff ff 	movabs $0xffffffffffffce1a,%rax
+  805923:	ff ff ff 
+  805926:	48 01 d8             	add    %rbx,%rax
+  805929:	ff d0                	call   *%rax
+}
+  80592b:	48 83 c4 20          	add    $0x20,%rsp
+  80592f:	5b                   	pop    %rbx
+  805930:	41 5f                	pop    %r15
+  805932:	5d                   	pop    %rbp
+  805933:	c3                   	ret
+
+0000000000805934 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805934:	55                   	push   %rbp
+  805935:	48 89 e5             	mov    %rsp,%rbp
+  805938:	41 57                	push   %r15
+  80593a:	48 83 ec 28          	sub    $0x28,%rsp
+  80593e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80593e <devsock_read+0xa>
+  805945:	49 bb 0a 37 00 00 00 	movabs $0x370a,%r11
+  80594c:	00 00 00 
+  80594f:	4c 01 d8             	add    %r11,%rax
+  805952:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805956:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80595a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80595e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805962:	41 89 d0             	mov    %edx,%r8d
+  805965:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805969:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80596c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805970:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805975:	44 89 c2             	mov    %r8d,%edx
+  805978:	49 89 c7             	mov    %rax,%r15
+  80597b:	49 b8 6b ce ff ff ff 	movabs $0xffffffffffffce6b,%r8
+  805982:	ff ff ff 
+  805985:	49 01 c0             	add    %rax,%r8
+  805988:	41 ff d0             	call   *%r8
+}
+  80598b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80598f:	c9                   	leave
+  805990:	c3                   	ret
+
+0000000000805991 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805991:	55                   	push   %rbp
+  805992:	48 89 e5             	mov    %rsp,%rbp
+  805995:	41 57                	push   %r15
+  805997:	48 83 ec 28          	sub    $0x28,%rsp
+  80599b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80599b <devsock_write+0xa>
+  8059a2:	49 bb ad 36 00 00 00 	movabs $0x36ad,%r11
+  8059a9:	00 00 00 
+  8059ac:	4c 01 d8             	add    %r11,%rax
+  8059af:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8059b3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8059b7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8059bb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8059bf:	41 89 d0             	mov    %edx,%r8d
+  8059c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8059c6:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8059c9:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8059cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8059d2:	44 89 c2             	mov    %r8d,%edx
+  8059d5:	49 89 c7             	mov    %rax,%r15
+  8059d8:	49 b8 88 cf ff ff ff 	movabs $0xffffffffffffcf88,%r8
+  8059df:	ff ff ff 
+  8059e2:	49 01 c0             	add    %rax,%r8
+  8059e5:	41 ff d0             	call   *%r8
+}
+  8059e8:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8059ec:	c9                   	leave
+  8059ed:	c3                   	ret
+
+00000000008059ee <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8059ee:	55                   	push   %rbp
+  8059ef:	48 89 e5             	mov    %rsp,%rbp
+  8059f2:	41 57                	push   %r15
+  8059f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8059f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8059f8 <devsock_stat+0xa>
+  8059ff:	49 bb 50 36 00 00 00 	movabs $0x3650,%r11
+  805a06:	00 00 00 
+  805a09:	4c 01 d8             	add    %r11,%rax
+  805a0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805a10:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805a14:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a18:	48 b9 84 e6 ff ff ff 	movabs $0xffffffffffffe684,%rcx
+  805a1f:	ff ff ff 
+  805a22:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805a26:	48 89 ce             	mov    %rcx,%rsi
+  805a29:	48 89 d7             	mov    %rdx,%rdi
+  805a2c:	49 89 c7             	mov    %rax,%r15
+  805a2f:	48 ba 57 86 ff ff ff 	movabs $0xffffffffffff8657,%rdx
+  805a36:	ff ff ff 
+  805a39:	48 01 c2             	add    %rax,%rdx
+  805a3c:	ff d2                	call   *%rdx
+	return 0;
+  805a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a43:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805a47:	c9                   	leave
+  805a48:	c3                   	ret
+
+0000000000805a49 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  805a49:	55                   	push   %rbp
+  805a4a:	48 89 e5             	mov    %rsp,%rbp
+  805a4d:	41 57                	push   %r15
+  805a4f:	53                   	push   %rbx
+  805a50:	48 83 ec 20          	sub    $0x20,%rsp
+  805a54:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a54 <socket+0xb>
+  805a5b:	49 bb f4 35 00 00 00 	movabs $0x35f4,%r11
+  805a62:	00 00 00 
+  805a65:	4c 01 db             	add    %r11,%rbx
+  805a68:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805a6b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805a6e:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805a71:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805a74:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805a77:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a7a:	89 ce                	mov    %ecx,%esi
+  805a7c:	89 c7                	mov    %eax,%edi
+  805a7e:	49 89 df             	mov    %rbx,%r15
+  805a81:	48 b8 5f d1 ff ff ff 	movabs $0xffffffffffffd15f,%rax
+  805a88:	ff ff ff 
+  805a8b:	48 01 d8             	add    %rbx,%rax
+  805a8e:	ff d0                	call   *%rax
+  805a90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a93:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a97:	79 05                	jns    805a9e <socket+0x55>
+		return r;
+  805a99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a9c:	eb 15                	jmp    805ab3 <socket+0x6a>
+	return alloc_sockfd(r);
+  805a9e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805aa1:	89 c7                	mov    %eax,%edi
+  805aa3:	48 b8 49 c5 ff ff ff 	movabs $0xffffffffffffc549,%rax
+  805aaa:	ff ff ff 
+  805aad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ab1:	ff d0                	call   *%rax
+}
+  805ab3:	48 83 c4 20          	add    $0x20,%rsp
+  805ab7:	5b                   	pop    %rbx
+  805ab8:	41 5f                	pop    %r15
+  805aba:	5d                   	pop    %rbp
+  805abb:	c3                   	ret
+
+0000000000805abc <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805abc:	55                   	push   %rbp
+  805abd:	48 89 e5             	mov    %rsp,%rbp
+  805ac0:	41 57                	push   %r15
+  805ac2:	53                   	push   %rbx
+  805ac3:	48 83 ec 10          	sub    $0x10,%rsp
+  805ac7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ac7 <nsipc+0xb>
+  805ace:	49 bb 81 35 00 00 00 	movabs $0x3581,%r11
+  805ad5:	00 00 00 
+  805ad8:	4c 01 db             	add    %r11,%rbx
+  805adb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805ade:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  805ae5:	00 00 00 
+  805ae8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805aeb:	85 c0                	test   %eax,%eax
+  805aed:	75 24                	jne    805b13 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805aef:	bf 02 00 00 00       	mov    $0x2,%edi
+  805af4:	49 89 df             	mov    %rbx,%r15
+  805af7:	48 b8 85 ad ff ff ff 	movabs $0xffffffffffffad85,%rax
+  805afe:	ff ff ff 
+  805b01:	48 01 d8             	add    %rbx,%rax
+  805b04:	ff d0                	call   *%rax
+  805b06:	48 ba b8 2f 01 00 00 	movabs $0x12fb8,%rdx
+  805b0d:	00 00 00 
+  805b10:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805b13:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  805b1a:	00 00 00 
+  805b1d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b20:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805b23:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805b29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805b2f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805b34:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  805b3b:	00 00 00 
+  805b3e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805b42:	89 c7                	mov    %eax,%edi
+  805b44:	49 89 df             	mov    %rbx,%r15
+  805b47:	48 b8 a4 a7 ff ff ff 	movabs $0xffffffffffffa7a4,%rax
+  805b4e:	ff ff ff 
+  805b51:	48 01 d8             	add    %rbx,%rax
+  805b54:	ff d0                	call   *%rax
+}
+  805b56:	48 83 c4 10          	add    $0x10,%rsp
+  805b5a:	5b                   	pop    %rbx
+  805b5b:	41 5f                	pop    %r15
+  805b5d:	5d                   	pop    %rbp
+  805b5e:	c3                   	ret
+
+0000000000805b5f <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805b5f:	55                   	push   %rbp
+  805b60:	48 89 e5             	mov    %rsp,%rbp
+  805b63:	41 57                	push   %r15
+  805b65:	53                   	push   %rbx
+  805b66:	48 83 ec 20          	sub    $0x20,%rsp
+  805b6a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b6a <nsipc_words+0xb>
+  805b71:	49 bb de 34 00 00 00 	movabs $0x34de,%r11
+  805b78:	00 00 00 
+  805b7b:	4c 01 db             	add    %r11,%rbx
+  805b7e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805b81:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805b85:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805b89:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  805b90:	00 00 00 
+  805b93:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b96:	85 c0                	test   %eax,%eax
+  805b98:	75 24                	jne    805bbe <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805b9a:	bf 02 00 00 00       	mov    $0x2,%edi
+  805b9f:	49 89 df             	mov    %rbx,%r15
+  805ba2:	48 b8 85 ad ff ff ff 	movabs $0xffffffffffffad85,%rax
+  805ba9:	ff ff ff 
+  805bac:	48 01 d8             	add    %rbx,%rax
+  805baf:	ff d0                	call   *%rax
+  805bb1:	48 ba b8 2f 01 00 00 	movabs $0x12fb8,%rdx
+  805bb8:	00 00 00 
+  805bbb:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805bbe:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  805bc5:	00 00 00 
+  805bc8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805bcb:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805bcf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805bd3:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805bd6:	89 c7                	mov    %eax,%edi
+  805bd8:	49 89 df             	mov    %rbx,%r15
+  805bdb:	48 b8 8f a8 ff ff ff 	movabs $0xffffffffffffa88f,%rax
+  805be2:	ff ff ff 
+  805be5:	48 01 d8             	add    %rbx,%rax
+  805be8:	ff d0                	call   *%rax
+}
+  805bea:	48 83 c4 20          	add    $0x20,%rsp
+  805bee:	5b                   	pop    %rbx
+  805bef:	41 5f                	pop    %r15
+  805bf1:	5d                   	pop    %rbp
+  805bf2:	c3                   	ret
+
+0000000000805bf3 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805bf3:	55                   	push   %rbp
+  805bf4:	48 89 e5             	mov    %rsp,%rbp
+  805bf7:	41 57                	push   %r15
+  805bf9:	53                   	push   %rbx
+  805bfa:	48 83 ec 30          	sub    $0x30,%rsp
+  805bfe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bfe <nsipc_accept+0xb>
+  805c05:	49 bb 4a 34 00 00 00 	movabs $0x344a,%r11
+  805c0c:	00 00 00 
+  805c0f:	4c 01 db             	add    %r11,%rbx
+  805c12:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805c15:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805c19:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805c1d:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  805c24:	00 00 00 
+  805c27:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c2a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805c2d:	bf 01 00 00 00       	mov    $0x1,%edi
+  805c32:	48 b8 74 ca ff ff ff 	movabs $0xffffffffffffca74,%rax
+  805c39:	ff ff ff 
+  805c3c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c40:	ff d0                	call   *%rax
+  805c42:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c49:	78 48                	js     805c93 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805c4b:	48 b8 b8 4f 01 00 00 	movabs $0x14fb8,%rax
+  805c52:	00 00 00 
+  805c55:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c59:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805c5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c61:	8b 40 10             	mov    0x10(%rax),%eax
+  805c64:	89 c2                	mov    %eax,%edx
+  805c66:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805c6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c6e:	48 89 ce             	mov    %rcx,%rsi
+  805c71:	48 89 c7             	mov    %rax,%rdi
+  805c74:	49 89 df             	mov    %rbx,%r15
+  805c77:	48 b8 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rax
+  805c7e:	ff ff ff 
+  805c81:	48 01 d8             	add    %rbx,%rax
+  805c84:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805c86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c8a:	8b 50 10             	mov    0x10(%rax),%edx
+  805c8d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c91:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805c93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805c96:	48 83 c4 30          	add    $0x30,%rsp
+  805c9a:	5b                   	pop    %rbx
+  805c9b:	41 5f                	pop    %r15
+  805c9d:	5d                   	pop    %rbp
+  805c9e:	c3                   	ret
+
+0000000000805c9f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805c9f:	55                   	push   %rbp
+  805ca0:	48 89 e5             	mov    %rsp,%rbp
+  805ca3:	41 57                	push   %r15
+  805ca5:	53                   	push   %rbx
+  805ca6:	48 83 ec 10          	sub    $0x10,%rsp
+  805caa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805caa <nsipc_bind+0xb>
+  805cb1:	49 bb 9e 33 00 00 00 	movabs $0x339e,%r11
+  805cb8:	00 00 00 
+  805cbb:	4c 01 db             	add    %r11,%rbx
+  805cbe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805cc1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805cc5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805cc8:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  805ccf:	00 00 00 
+  805cd2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cd5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805cd8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805cdb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805cdf:	48 89 c6             	mov    %rax,%rsi
+  805ce2:	48 b8 bc 4f 01 00 00 	movabs $0x14fbc,%rax
+  805ce9:	00 00 00 
+  805cec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cf0:	48 89 c7             	mov    %rax,%rdi
+  805cf3:	49 89 df             	mov    %rbx,%r15
+  805cf6:	48 b8 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rax
+  805cfd:	ff ff ff 
+  805d00:	48 01 d8             	add    %rbx,%rax
+  805d03:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805d05:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  805d0c:	00 00 00 
+  805d0f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805d12:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805d16:	bf 02 00 00 00       	mov    $0x2,%edi
+  805d1b:	48 b8 74 ca ff ff ff 	movabs $0xffffffffffffca74,%rax
+  805d22:	ff ff ff 
+  805d25:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d29:	ff d0                	call   *%rax
+}
+  805d2b:	48 83 c4 10          	add    $0x10,%rsp
+  805d2f:	5b                   	pop    %rbx
+  805d30:	41 5f                	pop    %r15
+  805d32:	5d                   	pop    %rbp
+  805d33:	c3                   	ret
+
+0000000000805d34 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805d34:	55                   	push   %rbp
+  805d35:	48 89 e5             	mov    %rsp,%rbp
+  805d38:	48 83 ec 20          	sub    $0x20,%rsp
+  805d3c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d3c <nsipc_shutdown+0x8>
+  805d43:	49 bb 0c 33 00 00 00 	movabs $0x330c,%r11
+  805d4a:	00 00 00 
+  805d4d:	4c 01 d8             	add    %r11,%rax
+  805d50:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805d53:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805d56:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805d59:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805d5c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d5f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805d62:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805d66:	ba 08 00 00 00       	mov    $0x8,%edx
+  805d6b:	48 89 ce             	mov    %rcx,%rsi
+  805d6e:	bf 03 00 00 00       	mov    $0x3,%edi
+  805d73:	48 b9 17 cb ff ff ff 	movabs $0xffffffffffffcb17,%rcx
+  805d7a:	ff ff ff 
+  805d7d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805d81:	ff d0                	call   *%rax
+}
+  805d83:	c9                   	leave
+  805d84:	c3                   	ret
+
+0000000000805d85 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805d85:	55                   	push   %rbp
+  805d86:	48 89 e5             	mov    %rsp,%rbp
+  805d89:	48 83 ec 20          	sub    $0x20,%rsp
+  805d8d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d8d <nsipc_close+0x8>
+  805d94:	49 bb bb 32 00 00 00 	movabs $0x32bb,%r11
+  805d9b:	00 00 00 
+  805d9e:	4c 01 d8             	add    %r11,%rax
+  805da1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805da4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805da7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805daa:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805dae:	ba 04 00 00 00       	mov    $0x4,%edx
+  805db3:	48 89 ce             	mov    %rcx,%rsi
+  805db6:	bf 04 00 00 00       	mov    $0x4,%edi
+  805dbb:	48 b9 17 cb ff ff ff 	movabs $0xffffffffffffcb17,%rcx
+  805dc2:	ff ff ff 
+  805dc5:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805dc9:	ff d0                	call   *%rax
+}
+  805dcb:	c9                   	leave
+  805dcc:	c3                   	ret
+
+0000000000805dcd <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805dcd:	55                   	push   %rbp
+  805dce:	48 89 e5             	mov    %rsp,%rbp
+  805dd1:	41 57                	push   %r15
+  805dd3:	53                   	push   %rbx
+  805dd4:	48 83 ec 10          	sub    $0x10,%rsp
+  805dd8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805dd8 <nsipc_connect+0xb>
+  805ddf:	49 bb 70 32 00 00 00 	movabs $0x3270,%r11
+  805de6:	00 00 00 
+  805de9:	4c 01 db             	add    %r11,%rbx
+  805dec:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805def:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805df3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805df6:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  805dfd:	00 00 00 
+  805e00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e03:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805e06:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805e09:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e0d:	48 89 c6             	mov    %rax,%rsi
+  805e10:	48 b8 bc 4f 01 00 00 	movabs $0x14fbc,%rax
+  805e17:	00 00 00 
+  805e1a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e1e:	48 89 c7             	mov    %rax,%rdi
+  805e21:	49 89 df             	mov    %rbx,%r15
+  805e24:	48 b8 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rax
+  805e2b:	ff ff ff 
+  805e2e:	48 01 d8             	add    %rbx,%rax
+  805e31:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805e33:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  805e3a:	00 00 00 
+  805e3d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805e40:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805e44:	bf 05 00 00 00       	mov    $0x5,%edi
+  805e49:	48 b8 74 ca ff ff ff 	movabs $0xffffffffffffca74,%rax
+  805e50:	ff ff ff 
+  805e53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e57:	ff d0                	call   *%rax
+}
+  805e59:	48 83 c4 10          	add    $0x10,%rsp
+  805e5d:	5b                   	pop    %rbx
+  805e5e:	41 5f                	pop    %r15
+  805e60:	5d                   	pop    %rbp
+  805e61:	c3                   	ret
+
+0000000000805e62 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805e62:	55                   	push   %rbp
+  805e63:	48 89 e5             	mov    %rsp,%rbp
+  805e66:	48 83 ec 20          	sub    $0x20,%rsp
+  805e6a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e6a <nsipc_listen+0x8>
+  805e71:	49 bb de 31 00 00 00 	movabs $0x31de,%r11
+  805e78:	00 00 00 
+  805e7b:	4c 01 d8             	add    %r11,%rax
+  805e7e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805e81:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805e84:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805e87:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805e8a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805e8d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805e90:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805e94:	ba 08 00 00 00       	mov    $0x8,%edx
+  805e99:	48 89 ce             	mov    %rcx,%rsi
+  805e9c:	bf 06 00 00 00       	mov    $0x6,%edi
+  805ea1:	48 b9 17 cb ff ff ff 	movabs $0xffffffffffffcb17,%rcx
+  805ea8:	ff ff ff 
+  805eab:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805eaf:	ff d0                	call   *%rax
+}
+  805eb1:	c9                   	leave
+  805eb2:	c3                   	ret
+
+0000000000805eb3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805eb3:	55                   	push   %rbp
+  805eb4:	48 89 e5             	mov    %rsp,%rbp
+  805eb7:	41 57                	push   %r15
+  805eb9:	53                   	push   %rbx
+  805eba:	48 83 ec 30          	sub    $0x30,%rsp
+  805ebe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ebe <nsipc_recv+0xb>
+  805ec5:	49 bb 8a 31 00 00 00 	movabs $0x318a,%r11
+  805ecc:	00 00 00 
+  805ecf:	4c 01 db             	add    %r11,%rbx
+  805ed2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805ed5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805ed9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805edc:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805edf:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  805ee6:	00 00 00 
+  805ee9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805eec:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805eef:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  805ef6:	00 00 00 
+  805ef9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805efc:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805f00:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  805f07:	00 00 00 
+  805f0a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805f0d:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805f11:	bf 07 00 00 00       	mov    $0x7,%edi
+  805f16:	48 b8 74 ca ff ff ff 	movabs $0xffffffffffffca74,%rax
+  805f1d:	ff ff ff 
+  805f20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f24:	ff d0                	call   *%rax
+  805f26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f2d:	0f 88 91 00 00 00    	js     805fc4 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805f33:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805f3a:	7f 08                	jg     805f44 <nsipc_recv+0x91>
+  805f3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f3f:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805f42:	7e 50                	jle    805f94 <nsipc_recv+0xe1>
+  805f44:	48 b8 8b e6 ff ff ff 	movabs $0xffffffffffffe68b,%rax
+  805f4b:	ff ff ff 
+  805f4e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f52:	48 89 c1             	mov    %rax,%rcx
+  805f55:	48 b8 a0 e6 ff ff ff 	movabs $0xffffffffffffe6a0,%rax
+  805f5c:	ff ff ff 
+  805f5f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f63:	48 89 c2             	mov    %rax,%rdx
+  805f66:	be 79 00 00 00       	mov    $0x79,%esi
+  805f6b:	48 b8 b5 e6 ff ff ff 	movabs $0xffffffffffffe6b5,%rax
+  805f72:	ff ff ff 
+  805f75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f79:	48 89 c7             	mov    %rax,%rdi
+  805f7c:	49 89 df             	mov    %rbx,%r15
+  805f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f84:	49 b8 be 75 ff ff ff 	movabs $0xffffffffffff75be,%r8
+  805f8b:	ff ff ff 
+  805f8e:	49 01 d8             	add    %rbx,%r8
+  805f91:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805f94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f97:	48 63 d0             	movslq %eax,%rdx
+  805f9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f9e:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  805fa5:	00 00 00 
+  805fa8:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805fac:	48 89 ce             	mov    %rcx,%rsi
+  805faf:	48 89 c7             	mov    %rax,%rdi
+  805fb2:	49 89 df             	mov    %rbx,%r15
+  805fb5:	48 b8 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rax
+  805fbc:	ff ff ff 
+  805fbf:	48 01 d8             	add    %rbx,%rax
+  805fc2:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805fc4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805fc7:	48 83 c4 30          	add    $0x30,%rsp
+  805fcb:	5b                   	pop    %rbx
+  805fcc:	41 5f                	pop    %r15
+  805fce:	5d                   	pop    %rbp
+  805fcf:	c3                   	ret
+
+0000000000805fd0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805fd0:	55                   	push   %rbp
+  805fd1:	48 89 e5             	mov    %rsp,%rbp
+  805fd4:	41 57                	push   %r15
+  805fd6:	53                   	push   %rbx
+  805fd7:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805fde:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fde <nsipc_send+0xe>
+  805fe5:	49 bb 6a 30 00 00 00 	movabs $0x306a,%r11
+  805fec:	00 00 00 
+  805fef:	4c 01 db             	add    %r11,%rbx
+  805ff2:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805ff8:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805fff:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  806005:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  80600b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80600f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  806013:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  80601a:	00 00 00 
+  80601d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806020:	85 c0                	test   %eax,%eax
+  806022:	75 24                	jne    806048 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  806024:	bf 02 00 00 00       	mov    $0x2,%edi
+  806029:	49 89 df             	mov    %rbx,%r15
+  80602c:	48 b8 85 ad ff ff ff 	movabs $0xffffffffffffad85,%rax
+  806033:	ff ff ff 
+  806036:	48 01 d8             	add    %rbx,%rax
+  806039:	ff d0                	call   *%rax
+  80603b:	48 ba b8 2f 01 00 00 	movabs $0x12fb8,%rdx
+  806042:	00 00 00 
+  806045:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  806048:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80604e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  806051:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  806058:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80605b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80605e:	39 c2                	cmp    %eax,%edx
+  806060:	0f 4e c2             	cmovle %edx,%eax
+  806063:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  806069:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80606f:	48 63 d0             	movslq %eax,%rdx
+  806072:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  806079:	48 89 c6             	mov    %rax,%rsi
+  80607c:	48 b8 b8 2f 00 00 00 	movabs $0x2fb8,%rax
+  806083:	00 00 00 
+  806086:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80608a:	48 89 c7             	mov    %rax,%rdi
+  80608d:	49 89 df             	mov    %rbx,%r15
+  806090:	48 b8 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rax
+  806097:	ff ff ff 
+  80609a:	48 01 d8             	add    %rbx,%rax
+  80609d:	ff d0                	call   *%rax
+	req->req_s = s;
+  80609f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060a3:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  8060a9:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  8060ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060af:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8060b5:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  8060b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060bc:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8060c2:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  8060c5:	48 b8 b8 2f 00 00 00 	movabs $0x2fb8,%rax
+  8060cc:	00 00 00 
+  8060cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060d3:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8060d7:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8060de:	00 
+  8060df:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8060e5:	48 63 d0             	movslq %eax,%rdx
+  8060e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060ec:	48 01 d0             	add    %rdx,%rax
+  8060ef:	48 83 e8 01          	sub    $0x1,%rax
+  8060f3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8060f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  806100:	48 f7 75 d8          	divq   -0x28(%rbp)
+  806104:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806108:	48 29 d0             	sub    %rdx,%rax
+  80610b:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  806111:	85 c0                	test   %eax,%eax
+  806113:	0f 48 c2             	cmovs  %edx,%eax
+  806116:	c1 f8 0c             	sar    $0xc,%eax
+  806119:	48 98                	cltq
+  80611b:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  80611f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806123:	48 85 c0             	test   %rax,%rax
+  806126:	0f 95 c0             	setne  %al
+  806129:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  80612c:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  806133:	00 
+  806134:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806138:	48 83 c0 0b          	add    $0xb,%rax
+  80613c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806140:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806144:	ba 00 00 00 00       	mov    $0x0,%edx
+  806149:	48 f7 75 c8          	divq   -0x38(%rbp)
+  80614d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806151:	48 29 d0             	sub    %rdx,%rax
+  806154:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806158:	89 c7                	mov    %eax,%edi
+  80615a:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  806161:	00 00 00 
+  806164:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806167:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80616b:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  80616f:	48 83 ec 08          	sub    $0x8,%rsp
+  806173:	6a 00                	push   $0x0
+  806175:	6a 00                	push   $0x0
+  806177:	6a 05                	push   $0x5
+  806179:	41 89 f1             	mov    %esi,%r9d
+  80617c:	49 89 c8             	mov    %rcx,%r8
+  80617f:	89 f9                	mov    %edi,%ecx
+  806181:	be 08 00 00 00       	mov    $0x8,%esi
+  806186:	89 c7                	mov    %eax,%edi
+  806188:	49 89 df             	mov    %rbx,%r15
+  80618b:	48 b8 8d a9 ff ff ff 	movabs $0xffffffffffffa98d,%rax
+  806192:	ff ff ff 
+  806195:	48 01 d8             	add    %rbx,%rax
+  806198:	ff d0                	call   *%rax
+  80619a:	48 83 c4 20          	add    $0x20,%rsp
+}
+  80619e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8061a2:	5b                   	pop    %rbx
+  8061a3:	41 5f                	pop    %r15
+  8061a5:	5d                   	pop    %rbp
+  8061a6:	c3                   	ret
+
+00000000008061a7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8061a7:	55                   	push   %rbp
+  8061a8:	48 89 e5             	mov    %rsp,%rbp
+  8061ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8061af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8061af <nsipc_socket+0x8>
+  8061b6:	49 bb 99 2e 00 00 00 	movabs $0x2e99,%r11
+  8061bd:	00 00 00 
+  8061c0:	4c 01 d8             	add    %r11,%rax
+  8061c3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8061c6:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8061c9:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8061cc:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  8061d3:	00 00 00 
+  8061d6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8061d9:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8061dc:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  8061e3:	00 00 00 
+  8061e6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8061e9:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8061ed:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  8061f4:	00 00 00 
+  8061f7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8061fa:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8061fe:	bf 09 00 00 00       	mov    $0x9,%edi
+  806203:	48 ba 74 ca ff ff ff 	movabs $0xffffffffffffca74,%rdx
+  80620a:	ff ff ff 
+  80620d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806211:	ff d0                	call   *%rax
+}
+  806213:	c9                   	leave
+  806214:	c3                   	ret
+
+0000000000806215 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  806215:	55                   	push   %rbp
+  806216:	48 89 e5             	mov    %rsp,%rbp
+  806219:	41 57                	push   %r15
+  80621b:	53                   	push   %rbx
+  80621c:	48 83 ec 30          	sub    $0x30,%rsp
+  806220:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806220 <pipe+0xb>
+  806227:	49 bb 28 2e 00 00 00 	movabs $0x2e28,%r11
+  80622e:	00 00 00 
+  806231:	4c 01 db             	add    %r11,%rbx
+  806234:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  806238:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  80623c:	48 89 c7             	mov    %rax,%rdi
+  80623f:	49 89 df             	mov    %rbx,%r15
+  806242:	48 b8 8e ae ff ff ff 	movabs $0xffffffffffffae8e,%rax
+  806249:	ff ff ff 
+  80624c:	48 01 d8             	add    %rbx,%rax
+  80624f:	ff d0                	call   *%rax
+  806251:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806254:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806258:	0f 88 12 02 00 00    	js     806470 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80625e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806262:	ba 07 04 00 00       	mov    $0x407,%edx
+  806267:	48 89 c6             	mov    %rax,%rsi
+  80626a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80626f:	49 89 df             	mov    %rbx,%r15
+  806272:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  806279:	ff ff ff 
+  80627c:	48 01 d8             	add    %rbx,%rax
+  80627f:	ff d0                	call   *%rax
+  806281:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806284:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806288:	0f 88 e2 01 00 00    	js     806470 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  80628e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  806292:	48 89 c7             	mov    %rax,%rdi
+  806295:	49 89 df             	mov    %rbx,%r15
+  806298:	48 b8 8e ae ff ff ff 	movabs $0xffffffffffffae8e,%rax
+  80629f:	ff ff ff 
+  8062a2:	48 01 d8             	add    %rbx,%rax
+  8062a5:	ff d0                	call   *%rax
+  8062a7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062aa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062ae:	0f 88 9b 01 00 00    	js     80644f <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8062b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062b8:	ba 07 04 00 00       	mov    $0x407,%edx
+  8062bd:	48 89 c6             	mov    %rax,%rsi
+  8062c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8062c5:	49 89 df             	mov    %rbx,%r15
+  8062c8:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  8062cf:	ff ff ff 
+  8062d2:	48 01 d8             	add    %rbx,%rax
+  8062d5:	ff d0                	call   *%rax
+  8062d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062da:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062de:	0f 88 6b 01 00 00    	js     80644f <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8062e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062e8:	48 89 c7             	mov    %rax,%rdi
+  8062eb:	49 89 df             	mov    %rbx,%r15
+  8062ee:	48 b8 4b ae ff ff ff 	movabs $0xffffffffffffae4b,%rax
+  8062f5:	ff ff ff 
+  8062f8:	48 01 d8             	add    %rbx,%rax
+  8062fb:	ff d0                	call   *%rax
+  8062fd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806301:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806305:	ba 07 04 00 00       	mov    $0x407,%edx
+  80630a:	48 89 c6             	mov    %rax,%rsi
+  80630d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806312:	49 89 df             	mov    %rbx,%r15
+  806315:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  80631c:	ff ff ff 
+  80631f:	48 01 d8             	add    %rbx,%rax
+  806322:	ff d0                	call   *%rax
+  806324:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806327:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80632b:	0f 88 fd 00 00 00    	js     80642e <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806331:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806335:	48 89 c7             	mov    %rax,%rdi
+  806338:	49 89 df             	mov    %rbx,%r15
+  80633b:	48 b8 4b ae ff ff ff 	movabs $0xffffffffffffae4b,%rax
+  806342:	ff ff ff 
+  806345:	48 01 d8             	add    %rbx,%rax
+  806348:	ff d0                	call   *%rax
+  80634a:	48 89 c2             	mov    %rax,%rdx
+  80634d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806351:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  806357:	48 89 d1             	mov    %rdx,%rcx
+  80635a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80635f:	48 89 c6             	mov    %rax,%rsi
+  806362:	bf 00 00 00 00       	mov    $0x0,%edi
+  806367:	49 89 df             	mov    %rbx,%r15
+  80636a:	48 b8 78 93 ff ff ff 	movabs $0xffffffffffff9378,%rax
+  806371:	ff ff ff 
+  806374:	48 01 d8             	add    %rbx,%rax
+  806377:	ff d0                	call   *%rax
+  806379:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80637c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806380:	0f 88 87 00 00 00    	js     80640d <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  806386:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80638a:	48 ba b8 00 00 00 00 	movabs $0xb8,%rdx
+  806391:	00 00 00 
+  806394:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806397:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  806399:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80639d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8063a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063a8:	48 ba b8 00 00 00 00 	movabs $0xb8,%rdx
+  8063af:	00 00 00 
+  8063b2:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8063b5:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8063b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063bb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8063c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063c6:	48 89 c7             	mov    %rax,%rdi
+  8063c9:	49 89 df             	mov    %rbx,%r15
+  8063cc:	48 b8 14 ae ff ff ff 	movabs $0xffffffffffffae14,%rax
+  8063d3:	ff ff ff 
+  8063d6:	48 01 d8             	add    %rbx,%rax
+  8063d9:	ff d0                	call   *%rax
+  8063db:	89 c2                	mov    %eax,%edx
+  8063dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063e1:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8063e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063e7:	48 89 c7             	mov    %rax,%rdi
+  8063ea:	49 89 df             	mov    %rbx,%r15
+  8063ed:	48 b8 14 ae ff ff ff 	movabs $0xffffffffffffae14,%rax
+  8063f4:	ff ff ff 
+  8063f7:	48 01 d8             	add    %rbx,%rax
+  8063fa:	ff d0                	call   *%rax
+  8063fc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806400:	48 83 c2 04          	add    $0x4,%rdx
+  806404:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  806406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80640b:	eb 67                	jmp    806474 <pipe+0x25f>
+		goto err3;
+  80640d:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80640e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806412:	48 89 c6             	mov    %rax,%rsi
+  806415:	bf 00 00 00 00       	mov    $0x0,%edi
+  80641a:	49 89 df             	mov    %rbx,%r15
+  80641d:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  806424:	ff ff ff 
+  806427:	48 01 d8             	add    %rbx,%rax
+  80642a:	ff d0                	call   *%rax
+  80642c:	eb 01                	jmp    80642f <pipe+0x21a>
+		goto err2;
+  80642e:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80642f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806433:	48 89 c6             	mov    %rax,%rsi
+  806436:	bf 00 00 00 00       	mov    $0x0,%edi
+  80643b:	49 89 df             	mov    %rbx,%r15
+  80643e:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  806445:	ff ff ff 
+  806448:	48 01 d8             	add    %rbx,%rax
+  80644b:	ff d0                	call   *%rax
+  80644d:	eb 01                	jmp    806450 <pipe+0x23b>
+		goto err1;
+  80644f:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806450:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806454:	48 89 c6             	mov    %rax,%rsi
+  806457:	bf 00 00 00 00       	mov    $0x0,%edi
+  80645c:	49 89 df             	mov    %rbx,%r15
+  80645f:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  806466:	ff ff ff 
+  806469:	48 01 d8             	add    %rbx,%rax
+  80646c:	ff d0                	call   *%rax
+  80646e:	eb 01                	jmp    806471 <pipe+0x25c>
+		goto err;
+  806470:	90                   	nop
+err:
+	return r;
+  806471:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806474:	48 83 c4 30          	add    $0x30,%rsp
+  806478:	5b                   	pop    %rbx
+  806479:	41 5f                	pop    %r15
+  80647b:	5d                   	pop    %rbp
+  80647c:	c3                   	ret
+
+000000000080647d <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80647d:	55                   	push   %rbp
+  80647e:	48 89 e5             	mov    %rsp,%rbp
+  806481:	41 57                	push   %r15
+  806483:	41 54                	push   %r12
+  806485:	53                   	push   %rbx
+  806486:	48 83 ec 28          	sub    $0x28,%rsp
+  80648a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80648a <_pipeisclosed+0xd>
+  806491:	49 bb be 2b 00 00 00 	movabs $0x2bbe,%r11
+  806498:	00 00 00 
+  80649b:	4c 01 db             	add    %r11,%rbx
+  80649e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8064a2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8064a6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8064ad:	ff ff ff 
+  8064b0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064b4:	48 8b 00             	mov    (%rax),%rax
+  8064b7:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8064bd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8064c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8064c4:	48 89 c7             	mov    %rax,%rdi
+  8064c7:	49 89 df             	mov    %rbx,%r15
+  8064ca:	48 b8 9f de ff ff ff 	movabs $0xffffffffffffde9f,%rax
+  8064d1:	ff ff ff 
+  8064d4:	48 01 d8             	add    %rbx,%rax
+  8064d7:	ff d0                	call   *%rax
+  8064d9:	41 89 c4             	mov    %eax,%r12d
+  8064dc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8064e0:	48 89 c7             	mov    %rax,%rdi
+  8064e3:	49 89 df             	mov    %rbx,%r15
+  8064e6:	48 b8 9f de ff ff ff 	movabs $0xffffffffffffde9f,%rax
+  8064ed:	ff ff ff 
+  8064f0:	48 01 d8             	add    %rbx,%rax
+  8064f3:	ff d0                	call   *%rax
+  8064f5:	41 39 c4             	cmp    %eax,%r12d
+  8064f8:	0f 94 c0             	sete   %al
+  8064fb:	0f b6 c0             	movzbl %al,%eax
+  8064fe:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806501:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806508:	ff ff ff 
+  80650b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80650f:	48 8b 00             	mov    (%rax),%rax
+  806512:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806518:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80651b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80651e:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806521:	75 05                	jne    806528 <_pipeisclosed+0xab>
+			return ret;
+  806523:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806526:	eb 63                	jmp    80658b <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  806528:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80652b:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80652e:	0f 84 72 ff ff ff    	je     8064a6 <_pipeisclosed+0x29>
+  806534:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  806538:	0f 85 68 ff ff ff    	jne    8064a6 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80653e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806545:	ff ff ff 
+  806548:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80654c:	48 8b 00             	mov    (%rax),%rax
+  80654f:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806555:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  806558:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80655b:	89 c6                	mov    %eax,%esi
+  80655d:	48 b8 c6 e6 ff ff ff 	movabs $0xffffffffffffe6c6,%rax
+  806564:	ff ff ff 
+  806567:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80656b:	48 89 c7             	mov    %rax,%rdi
+  80656e:	49 89 df             	mov    %rbx,%r15
+  806571:	b8 00 00 00 00       	mov    $0x0,%eax
+  806576:	49 b8 95 78 ff ff ff 	movabs $0xffffffffffff7895,%r8
+  80657d:	ff ff ff 
+  806580:	49 01 d8             	add    %rbx,%r8
+  806583:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  806586:	e9 1b ff ff ff       	jmp    8064a6 <_pipeisclosed+0x29>
+	}
+}
+  80658b:	48 83 c4 28          	add    $0x28,%rsp
+  80658f:	5b                   	pop    %rbx
+  806590:	41 5c                	pop    %r12
+  806592:	41 5f                	pop    %r15
+  806594:	5d                   	pop    %rbp
+  806595:	c3                   	ret
+
+0000000000806596 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  806596:	55                   	push   %rbp
+  806597:	48 89 e5             	mov    %rsp,%rbp
+  80659a:	41 57                	push   %r15
+  80659c:	53                   	push   %rbx
+  80659d:	48 83 ec 30          	sub    $0x30,%rsp
+  8065a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065a1 <pipeisclosed+0xb>
+  8065a8:	49 bb a7 2a 00 00 00 	movabs $0x2aa7,%r11
+  8065af:	00 00 00 
+  8065b2:	4c 01 db             	add    %r11,%rbx
+  8065b5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8065b8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8065bc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8065bf:	48 89 d6             	mov    %rdx,%rsi
+  8065c2:	89 c7                	mov    %eax,%edi
+  8065c4:	49 89 df             	mov    %rbx,%r15
+  8065c7:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  8065ce:	ff ff ff 
+  8065d1:	48 01 d8             	add    %rbx,%rax
+  8065d4:	ff d0                	call   *%rax
+  8065d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8065d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065dd:	79 05                	jns    8065e4 <pipeisclosed+0x4e>
+		return r;
+  8065df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065e2:	eb 3b                	jmp    80661f <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8065e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065e8:	48 89 c7             	mov    %rax,%rdi
+  8065eb:	49 89 df             	mov    %rbx,%r15
+  8065ee:	48 b8 4b ae ff ff ff 	movabs $0xffffffffffffae4b,%rax
+  8065f5:	ff ff ff 
+  8065f8:	48 01 d8             	add    %rbx,%rax
+  8065fb:	ff d0                	call   *%rax
+  8065fd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806601:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806605:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806609:	48 89 d6             	mov    %rdx,%rsi
+  80660c:	48 89 c7             	mov    %rax,%rdi
+  80660f:	48 b8 35 d4 ff ff ff 	movabs $0xffffffffffffd435,%rax
+  806616:	ff ff ff 
+  806619:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80661d:	ff d0                	call   *%rax
+}
+  80661f:	48 83 c4 30          	add    $0x30,%rsp
+  806623:	5b                   	pop    %rbx
+  806624:	41 5f                	pop    %r15
+  806626:	5d                   	pop    %rbp
+  806627:	c3                   	ret
+
+0000000000806628 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806628:	55                   	push   %rbp
+  806629:	48 89 e5             	mov    %rsp,%rbp
+  80662c:	41 57                	push   %r15
+  80662e:	53                   	push   %rbx
+  80662f:	48 83 ec 40          	sub    $0x40,%rsp
+  806633:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806633 <devpipe_read+0xb>
+  80663a:	49 bb 15 2a 00 00 00 	movabs $0x2a15,%r11
+  806641:	00 00 00 
+  806644:	4c 01 db             	add    %r11,%rbx
+  806647:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80664b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80664f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806653:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806657:	48 89 c7             	mov    %rax,%rdi
+  80665a:	49 89 df             	mov    %rbx,%r15
+  80665d:	48 b8 4b ae ff ff ff 	movabs $0xffffffffffffae4b,%rax
+  806664:	ff ff ff 
+  806667:	48 01 d8             	add    %rbx,%rax
+  80666a:	ff d0                	call   *%rax
+  80666c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806670:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806674:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806678:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80667f:	00 
+  806680:	e9 a1 00 00 00       	jmp    806726 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  806685:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80668a:	74 09                	je     806695 <devpipe_read+0x6d>
+				return i;
+  80668c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806690:	e9 9f 00 00 00       	jmp    806734 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  806695:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806699:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80669d:	48 89 d6             	mov    %rdx,%rsi
+  8066a0:	48 89 c7             	mov    %rax,%rdi
+  8066a3:	48 b8 35 d4 ff ff ff 	movabs $0xffffffffffffd435,%rax
+  8066aa:	ff ff ff 
+  8066ad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8066b1:	ff d0                	call   *%rax
+  8066b3:	85 c0                	test   %eax,%eax
+  8066b5:	74 07                	je     8066be <devpipe_read+0x96>
+				return 0;
+  8066b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8066bc:	eb 76                	jmp    806734 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8066be:	49 89 df             	mov    %rbx,%r15
+  8066c1:	48 b8 be 92 ff ff ff 	movabs $0xffffffffffff92be,%rax
+  8066c8:	ff ff ff 
+  8066cb:	48 01 d8             	add    %rbx,%rax
+  8066ce:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8066d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066d4:	8b 10                	mov    (%rax),%edx
+  8066d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066da:	8b 40 04             	mov    0x4(%rax),%eax
+  8066dd:	39 c2                	cmp    %eax,%edx
+  8066df:	74 a4                	je     806685 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8066e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066e5:	8b 10                	mov    (%rax),%edx
+  8066e7:	89 d0                	mov    %edx,%eax
+  8066e9:	c1 f8 1f             	sar    $0x1f,%eax
+  8066ec:	c1 e8 1b             	shr    $0x1b,%eax
+  8066ef:	01 c2                	add    %eax,%edx
+  8066f1:	83 e2 1f             	and    $0x1f,%edx
+  8066f4:	29 c2                	sub    %eax,%edx
+  8066f6:	89 d6                	mov    %edx,%esi
+  8066f8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8066fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806700:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806704:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806708:	48 63 c6             	movslq %esi,%rax
+  80670b:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806710:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806712:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806716:	8b 00                	mov    (%rax),%eax
+  806718:	8d 50 01             	lea    0x1(%rax),%edx
+  80671b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80671f:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806721:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806726:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80672a:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80672e:	72 a0                	jb     8066d0 <devpipe_read+0xa8>
+	}
+	return i;
+  806730:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806734:	48 83 c4 40          	add    $0x40,%rsp
+  806738:	5b                   	pop    %rbx
+  806739:	41 5f                	pop    %r15
+  80673b:	5d                   	pop    %rbp
+  80673c:	c3                   	ret
+
+000000000080673d <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80673d:	55                   	push   %rbp
+  80673e:	48 89 e5             	mov    %rsp,%rbp
+  806741:	41 57                	push   %r15
+  806743:	53                   	push   %rbx
+  806744:	48 83 ec 40          	sub    $0x40,%rsp
+  806748:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806748 <devpipe_write+0xb>
+  80674f:	49 bb 00 29 00 00 00 	movabs $0x2900,%r11
+  806756:	00 00 00 
+  806759:	4c 01 db             	add    %r11,%rbx
+  80675c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806760:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806764:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  806768:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80676c:	48 89 c7             	mov    %rax,%rdi
+  80676f:	49 89 df             	mov    %rbx,%r15
+  806772:	48 b8 4b ae ff ff ff 	movabs $0xffffffffffffae4b,%rax
+  806779:	ff ff ff 
+  80677c:	48 01 d8             	add    %rbx,%rax
+  80677f:	ff d0                	call   *%rax
+  806781:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806785:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806789:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80678d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806794:	00 
+  806795:	e9 a0 00 00 00       	jmp    80683a <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80679a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80679e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8067a2:	48 89 d6             	mov    %rdx,%rsi
+  8067a5:	48 89 c7             	mov    %rax,%rdi
+  8067a8:	48 b8 35 d4 ff ff ff 	movabs $0xffffffffffffd435,%rax
+  8067af:	ff ff ff 
+  8067b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8067b6:	ff d0                	call   *%rax
+  8067b8:	85 c0                	test   %eax,%eax
+  8067ba:	74 0a                	je     8067c6 <devpipe_write+0x89>
+				return 0;
+  8067bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067c1:	e9 82 00 00 00       	jmp    806848 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8067c6:	49 89 df             	mov    %rbx,%r15
+  8067c9:	48 b8 be 92 ff ff ff 	movabs $0xffffffffffff92be,%rax
+  8067d0:	ff ff ff 
+  8067d3:	48 01 d8             	add    %rbx,%rax
+  8067d6:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8067d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067dc:	8b 40 04             	mov    0x4(%rax),%eax
+  8067df:	48 63 d0             	movslq %eax,%rdx
+  8067e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067e6:	8b 00                	mov    (%rax),%eax
+  8067e8:	48 98                	cltq
+  8067ea:	48 83 c0 20          	add    $0x20,%rax
+  8067ee:	48 39 c2             	cmp    %rax,%rdx
+  8067f1:	73 a7                	jae    80679a <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8067f3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8067f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8067fb:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8067ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806803:	8b 50 04             	mov    0x4(%rax),%edx
+  806806:	89 d0                	mov    %edx,%eax
+  806808:	c1 f8 1f             	sar    $0x1f,%eax
+  80680b:	c1 e8 1b             	shr    $0x1b,%eax
+  80680e:	01 c2                	add    %eax,%edx
+  806810:	83 e2 1f             	and    $0x1f,%edx
+  806813:	29 c2                	sub    %eax,%edx
+  806815:	89 d0                	mov    %edx,%eax
+  806817:	0f b6 09             	movzbl (%rcx),%ecx
+  80681a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80681e:	48 98                	cltq
+  806820:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806824:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806828:	8b 40 04             	mov    0x4(%rax),%eax
+  80682b:	8d 50 01             	lea    0x1(%rax),%edx
+  80682e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806832:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806835:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80683a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80683e:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806842:	72 94                	jb     8067d8 <devpipe_write+0x9b>
+	}
+
+	return i;
+  806844:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806848:	48 83 c4 40          	add    $0x40,%rsp
+  80684c:	5b                   	pop    %rbx
+  80684d:	41 5f                	pop    %r15
+  80684f:	5d                   	pop    %rbp
+  806850:	c3                   	ret
+
+0000000000806851 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806851:	55                   	push   %rbp
+  806852:	48 89 e5             	mov    %rsp,%rbp
+  806855:	41 57                	push   %r15
+  806857:	53                   	push   %rbx
+  806858:	48 83 ec 20          	sub    $0x20,%rsp
+  80685c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80685c <devpipe_stat+0xb>
+  806863:	49 bb ec 27 00 00 00 	movabs $0x27ec,%r11
+  80686a:	00 00 00 
+  80686d:	4c 01 db             	add    %r11,%rbx
+  806870:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806874:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  806878:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80687c:	48 89 c7             	mov    %rax,%rdi
+  80687f:	49 89 df             	mov    %rbx,%r15
+  806882:	48 b8 4b ae ff ff ff 	movabs $0xffffffffffffae4b,%rax
+  806889:	ff ff ff 
+  80688c:	48 01 d8             	add    %rbx,%rax
+  80688f:	ff d0                	call   *%rax
+  806891:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  806895:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806899:	48 ba d9 e6 ff ff ff 	movabs $0xffffffffffffe6d9,%rdx
+  8068a0:	ff ff ff 
+  8068a3:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8068a7:	48 89 d6             	mov    %rdx,%rsi
+  8068aa:	48 89 c7             	mov    %rax,%rdi
+  8068ad:	49 89 df             	mov    %rbx,%r15
+  8068b0:	48 b8 57 86 ff ff ff 	movabs $0xffffffffffff8657,%rax
+  8068b7:	ff ff ff 
+  8068ba:	48 01 d8             	add    %rbx,%rax
+  8068bd:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8068bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8068c3:	8b 50 04             	mov    0x4(%rax),%edx
+  8068c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8068ca:	8b 00                	mov    (%rax),%eax
+  8068cc:	29 c2                	sub    %eax,%edx
+  8068ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068d2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8068d8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068dc:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8068e3:	00 00 00 
+	stat->st_dev = &devpipe;
+  8068e6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068ea:	48 ba b8 00 00 00 00 	movabs $0xb8,%rdx
+  8068f1:	00 00 00 
+  8068f4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8068f8:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8068ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806904:	48 83 c4 20          	add    $0x20,%rsp
+  806908:	5b                   	pop    %rbx
+  806909:	41 5f                	pop    %r15
+  80690b:	5d                   	pop    %rbp
+  80690c:	c3                   	ret
+
+000000000080690d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80690d:	55                   	push   %rbp
+  80690e:	48 89 e5             	mov    %rsp,%rbp
+  806911:	41 57                	push   %r15
+  806913:	53                   	push   %rbx
+  806914:	48 83 ec 10          	sub    $0x10,%rsp
+  806918:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806918 <devpipe_close+0xb>
+  80691f:	49 bb 30 27 00 00 00 	movabs $0x2730,%r11
+  806926:	00 00 00 
+  806929:	4c 01 db             	add    %r11,%rbx
+  80692c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806930:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806934:	48 89 c6             	mov    %rax,%rsi
+  806937:	bf 00 00 00 00       	mov    $0x0,%edi
+  80693c:	49 89 df             	mov    %rbx,%r15
+  80693f:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  806946:	ff ff ff 
+  806949:	48 01 d8             	add    %rbx,%rax
+  80694c:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80694e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806952:	48 89 c7             	mov    %rax,%rdi
+  806955:	49 89 df             	mov    %rbx,%r15
+  806958:	48 b8 4b ae ff ff ff 	movabs $0xffffffffffffae4b,%rax
+  80695f:	ff ff ff 
+  806962:	48 01 d8             	add    %rbx,%rax
+  806965:	ff d0                	call   *%rax
+  806967:	48 89 c6             	mov    %rax,%rsi
+  80696a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80696f:	49 89 df             	mov    %rbx,%r15
+  806972:	48 b8 eb 93 ff ff ff 	movabs $0xffffffffffff93eb,%rax
+  806979:	ff ff ff 
+  80697c:	48 01 d8             	add    %rbx,%rax
+  80697f:	ff d0                	call   *%rax
+}
+  806981:	48 83 c4 10          	add    $0x10,%rsp
+  806985:	5b                   	pop    %rbx
+  806986:	41 5f                	pop    %r15
+  806988:	5d                   	pop    %rbp
+  806989:	c3                   	ret
+
+000000000080698a <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80698a:	55                   	push   %rbp
+  80698b:	48 89 e5             	mov    %rsp,%rbp
+  80698e:	41 57                	push   %r15
+  806990:	48 83 ec 28          	sub    $0x28,%rsp
+  806994:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806994 <cputchar+0xa>
+  80699b:	49 bb b4 26 00 00 00 	movabs $0x26b4,%r11
+  8069a2:	00 00 00 
+  8069a5:	4c 01 d8             	add    %r11,%rax
+  8069a8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8069ab:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8069ae:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8069b1:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8069b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8069ba:	48 89 d7             	mov    %rdx,%rdi
+  8069bd:	49 89 c7             	mov    %rax,%r15
+  8069c0:	48 ba 5b 91 ff ff ff 	movabs $0xffffffffffff915b,%rdx
+  8069c7:	ff ff ff 
+  8069ca:	48 01 c2             	add    %rax,%rdx
+  8069cd:	ff d2                	call   *%rdx
+}
+  8069cf:	90                   	nop
+  8069d0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8069d4:	c9                   	leave
+  8069d5:	c3                   	ret
+
+00000000008069d6 <getchar>:
+
+int
+getchar(void)
+{
+  8069d6:	55                   	push   %rbp
+  8069d7:	48 89 e5             	mov    %rsp,%rbp
+  8069da:	41 57                	push   %r15
+  8069dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8069e0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8069e0 <getchar+0xa>
+  8069e7:	49 bb 68 26 00 00 00 	movabs $0x2668,%r11
+  8069ee:	00 00 00 
+  8069f1:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8069f4:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8069f8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8069fd:	48 89 ce             	mov    %rcx,%rsi
+  806a00:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a05:	49 89 c7             	mov    %rax,%r15
+  806a08:	48 b9 8b b4 ff ff ff 	movabs $0xffffffffffffb48b,%rcx
+  806a0f:	ff ff ff 
+  806a12:	48 01 c1             	add    %rax,%rcx
+  806a15:	ff d1                	call   *%rcx
+  806a17:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806a1a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a1e:	79 05                	jns    806a25 <getchar+0x4f>
+		return r;
+  806a20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a23:	eb 14                	jmp    806a39 <getchar+0x63>
+	if (r < 1)
+  806a25:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a29:	7f 07                	jg     806a32 <getchar+0x5c>
+		return -E_EOF;
+  806a2b:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806a30:	eb 07                	jmp    806a39 <getchar+0x63>
+	return c;
+  806a32:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806a36:	0f b6 c0             	movzbl %al,%eax
+}
+  806a39:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806a3d:	c9                   	leave
+  806a3e:	c3                   	ret
+
+0000000000806a3f <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806a3f:	55                   	push   %rbp
+  806a40:	48 89 e5             	mov    %rsp,%rbp
+  806a43:	41 57                	push   %r15
+  806a45:	53                   	push   %rbx
+  806a46:	48 83 ec 20          	sub    $0x20,%rsp
+  806a4a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a4a <iscons+0xb>
+  806a51:	49 bb fe 25 00 00 00 	movabs $0x25fe,%r11
+  806a58:	00 00 00 
+  806a5b:	4c 01 db             	add    %r11,%rbx
+  806a5e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806a61:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806a65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a68:	48 89 d6             	mov    %rdx,%rsi
+  806a6b:	89 c7                	mov    %eax,%edi
+  806a6d:	49 89 df             	mov    %rbx,%r15
+  806a70:	48 b8 44 af ff ff ff 	movabs $0xffffffffffffaf44,%rax
+  806a77:	ff ff ff 
+  806a7a:	48 01 d8             	add    %rbx,%rax
+  806a7d:	ff d0                	call   *%rax
+  806a7f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806a82:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a86:	79 05                	jns    806a8d <iscons+0x4e>
+		return r;
+  806a88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a8b:	eb 1b                	jmp    806aa8 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  806a8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a91:	8b 10                	mov    (%rax),%edx
+  806a93:	48 b8 f8 00 00 00 00 	movabs $0xf8,%rax
+  806a9a:	00 00 00 
+  806a9d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806aa0:	39 c2                	cmp    %eax,%edx
+  806aa2:	0f 94 c0             	sete   %al
+  806aa5:	0f b6 c0             	movzbl %al,%eax
+}
+  806aa8:	48 83 c4 20          	add    $0x20,%rsp
+  806aac:	5b                   	pop    %rbx
+  806aad:	41 5f                	pop    %r15
+  806aaf:	5d                   	pop    %rbp
+  806ab0:	c3                   	ret
+
+0000000000806ab1 <opencons>:
+
+int
+opencons(void)
+{
+  806ab1:	55                   	push   %rbp
+  806ab2:	48 89 e5             	mov    %rsp,%rbp
+  806ab5:	41 57                	push   %r15
+  806ab7:	53                   	push   %rbx
+  806ab8:	48 83 ec 10          	sub    $0x10,%rsp
+  806abc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806abc <opencons+0xb>
+  806ac3:	49 bb 8c 25 00 00 00 	movabs $0x258c,%r11
+  806aca:	00 00 00 
+  806acd:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806ad0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806ad4:	48 89 c7             	mov    %rax,%rdi
+  806ad7:	49 89 df             	mov    %rbx,%r15
+  806ada:	48 b8 8e ae ff ff ff 	movabs $0xffffffffffffae8e,%rax
+  806ae1:	ff ff ff 
+  806ae4:	48 01 d8             	add    %rbx,%rax
+  806ae7:	ff d0                	call   *%rax
+  806ae9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806aec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806af0:	79 05                	jns    806af7 <opencons+0x46>
+		return r;
+  806af2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806af5:	eb 68                	jmp    806b5f <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806af7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806afb:	ba 07 04 00 00       	mov    $0x407,%edx
+  806b00:	48 89 c6             	mov    %rax,%rsi
+  806b03:	bf 00 00 00 00       	mov    $0x0,%edi
+  806b08:	49 89 df             	mov    %rbx,%r15
+  806b0b:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  806b12:	ff ff ff 
+  806b15:	48 01 d8             	add    %rbx,%rax
+  806b18:	ff d0                	call   *%rax
+  806b1a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b1d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b21:	79 05                	jns    806b28 <opencons+0x77>
+		return r;
+  806b23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b26:	eb 37                	jmp    806b5f <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806b28:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b2c:	48 ba f8 00 00 00 00 	movabs $0xf8,%rdx
+  806b33:	00 00 00 
+  806b36:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806b39:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806b3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b3f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806b46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b4a:	48 89 c7             	mov    %rax,%rdi
+  806b4d:	49 89 df             	mov    %rbx,%r15
+  806b50:	48 b8 14 ae ff ff ff 	movabs $0xffffffffffffae14,%rax
+  806b57:	ff ff ff 
+  806b5a:	48 01 d8             	add    %rbx,%rax
+  806b5d:	ff d0                	call   *%rax
+}
+  806b5f:	48 83 c4 10          	add    $0x10,%rsp
+  806b63:	5b                   	pop    %rbx
+  806b64:	41 5f                	pop    %r15
+  806b66:	5d                   	pop    %rbp
+  806b67:	c3                   	ret
+
+0000000000806b68 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806b68:	55                   	push   %rbp
+  806b69:	48 89 e5             	mov    %rsp,%rbp
+  806b6c:	41 57                	push   %r15
+  806b6e:	53                   	push   %rbx
+  806b6f:	48 83 ec 30          	sub    $0x30,%rsp
+  806b73:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b73 <devcons_read+0xb>
+  806b7a:	49 bb d5 24 00 00 00 	movabs $0x24d5,%r11
+  806b81:	00 00 00 
+  806b84:	4c 01 db             	add    %r11,%rbx
+  806b87:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806b8b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806b8f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806b93:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806b98:	75 19                	jne    806bb3 <devcons_read+0x4b>
+		return 0;
+  806b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b9f:	eb 55                	jmp    806bf6 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806ba1:	49 89 df             	mov    %rbx,%r15
+  806ba4:	48 b8 be 92 ff ff ff 	movabs $0xffffffffffff92be,%rax
+  806bab:	ff ff ff 
+  806bae:	48 01 d8             	add    %rbx,%rax
+  806bb1:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806bb3:	49 89 df             	mov    %rbx,%r15
+  806bb6:	48 b8 ba 91 ff ff ff 	movabs $0xffffffffffff91ba,%rax
+  806bbd:	ff ff ff 
+  806bc0:	48 01 d8             	add    %rbx,%rax
+  806bc3:	ff d0                	call   *%rax
+  806bc5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806bc8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806bcc:	74 d3                	je     806ba1 <devcons_read+0x39>
+	if (c < 0)
+  806bce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806bd2:	79 05                	jns    806bd9 <devcons_read+0x71>
+		return c;
+  806bd4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bd7:	eb 1d                	jmp    806bf6 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806bd9:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806bdd:	75 07                	jne    806be6 <devcons_read+0x7e>
+		return 0;
+  806bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  806be4:	eb 10                	jmp    806bf6 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806be6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806be9:	89 c2                	mov    %eax,%edx
+  806beb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806bef:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806bf1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806bf6:	48 83 c4 30          	add    $0x30,%rsp
+  806bfa:	5b                   	pop    %rbx
+  806bfb:	41 5f                	pop    %r15
+  806bfd:	5d                   	pop    %rbp
+  806bfe:	c3                   	ret
+
+0000000000806bff <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806bff:	55                   	push   %rbp
+  806c00:	48 89 e5             	mov    %rsp,%rbp
+  806c03:	41 57                	push   %r15
+  806c05:	53                   	push   %rbx
+  806c06:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806c0d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c0d <devcons_write+0xe>
+  806c14:	49 bb 3b 24 00 00 00 	movabs $0x243b,%r11
+  806c1b:	00 00 00 
+  806c1e:	4c 01 db             	add    %r11,%rbx
+  806c21:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806c28:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806c2f:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806c36:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806c3d:	e9 80 00 00 00       	jmp    806cc2 <devcons_write+0xc3>
+		m = n - tot;
+  806c42:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806c49:	89 c2                	mov    %eax,%edx
+  806c4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c4e:	29 c2                	sub    %eax,%edx
+  806c50:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806c53:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806c56:	83 f8 7f             	cmp    $0x7f,%eax
+  806c59:	76 07                	jbe    806c62 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806c5b:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806c62:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806c65:	48 63 d0             	movslq %eax,%rdx
+  806c68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c6b:	48 63 c8             	movslq %eax,%rcx
+  806c6e:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806c75:	48 01 c1             	add    %rax,%rcx
+  806c78:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806c7f:	48 89 ce             	mov    %rcx,%rsi
+  806c82:	48 89 c7             	mov    %rax,%rdi
+  806c85:	49 89 df             	mov    %rbx,%r15
+  806c88:	48 b8 37 8a ff ff ff 	movabs $0xffffffffffff8a37,%rax
+  806c8f:	ff ff ff 
+  806c92:	48 01 d8             	add    %rbx,%rax
+  806c95:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806c97:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806c9a:	48 63 d0             	movslq %eax,%rdx
+  806c9d:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806ca4:	48 89 d6             	mov    %rdx,%rsi
+  806ca7:	48 89 c7             	mov    %rax,%rdi
+  806caa:	49 89 df             	mov    %rbx,%r15
+  806cad:	48 b8 5b 91 ff ff ff 	movabs $0xffffffffffff915b,%rax
+  806cb4:	ff ff ff 
+  806cb7:	48 01 d8             	add    %rbx,%rax
+  806cba:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806cbc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806cbf:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806cc2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806cc5:	48 98                	cltq
+  806cc7:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806cce:	0f 82 6e ff ff ff    	jb     806c42 <devcons_write+0x43>
+	}
+	return tot;
+  806cd4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806cd7:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806cde:	5b                   	pop    %rbx
+  806cdf:	41 5f                	pop    %r15
+  806ce1:	5d                   	pop    %rbp
+  806ce2:	c3                   	ret
+
+0000000000806ce3 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806ce3:	55                   	push   %rbp
+  806ce4:	48 89 e5             	mov    %rsp,%rbp
+  806ce7:	48 83 ec 08          	sub    $0x8,%rsp
+  806ceb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806ceb <devcons_close+0x8>
+  806cf2:	49 bb 5d 23 00 00 00 	movabs $0x235d,%r11
+  806cf9:	00 00 00 
+  806cfc:	4c 01 d8             	add    %r11,%rax
+  806cff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806d03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806d08:	c9                   	leave
+  806d09:	c3                   	ret
+
+0000000000806d0a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806d0a:	55                   	push   %rbp
+  806d0b:	48 89 e5             	mov    %rsp,%rbp
+  806d0e:	41 57                	push   %r15
+  806d10:	48 83 ec 18          	sub    $0x18,%rsp
+  806d14:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d14 <devcons_stat+0xa>
+  806d1b:	49 bb 34 23 00 00 00 	movabs $0x2334,%r11
+  806d22:	00 00 00 
+  806d25:	4c 01 d8             	add    %r11,%rax
+  806d28:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806d2c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806d30:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806d34:	48 b9 e5 e6 ff ff ff 	movabs $0xffffffffffffe6e5,%rcx
+  806d3b:	ff ff ff 
+  806d3e:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806d42:	48 89 ce             	mov    %rcx,%rsi
+  806d45:	48 89 d7             	mov    %rdx,%rdi
+  806d48:	49 89 c7             	mov    %rax,%r15
+  806d4b:	48 ba 57 86 ff ff ff 	movabs $0xffffffffffff8657,%rdx
+  806d52:	ff ff ff 
+  806d55:	48 01 c2             	add    %rax,%rdx
+  806d58:	ff d2                	call   *%rdx
+	return 0;
+  806d5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806d5f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806d63:	c9                   	leave
+  806d64:	c3                   	ret
+
+0000000000806d65 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806d65:	55                   	push   %rbp
+  806d66:	48 89 e5             	mov    %rsp,%rbp
+  806d69:	41 57                	push   %r15
+  806d6b:	53                   	push   %rbx
+  806d6c:	48 83 ec 20          	sub    $0x20,%rsp
+  806d70:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d70 <set_pgfault_handler+0xb>
+  806d77:	49 bb d8 22 00 00 00 	movabs $0x22d8,%r11
+  806d7e:	00 00 00 
+  806d81:	4c 01 db             	add    %r11,%rbx
+  806d84:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806d88:	49 89 df             	mov    %rbx,%r15
+  806d8b:	48 b8 6a 92 ff ff ff 	movabs $0xffffffffffff926a,%rax
+  806d92:	ff ff ff 
+  806d95:	48 01 d8             	add    %rbx,%rax
+  806d98:	ff d0                	call   *%rax
+  806d9a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806d9d:	48 b8 b8 5f 01 00 00 	movabs $0x15fb8,%rax
+  806da4:	00 00 00 
+  806da7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806dab:	48 85 c0             	test   %rax,%rax
+  806dae:	75 6b                	jne    806e1b <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806db0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806db3:	ba 07 00 00 00       	mov    $0x7,%edx
+  806db8:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806dbd:	48 89 ce             	mov    %rcx,%rsi
+  806dc0:	89 c7                	mov    %eax,%edi
+  806dc2:	49 89 df             	mov    %rbx,%r15
+  806dc5:	48 b8 13 93 ff ff ff 	movabs $0xffffffffffff9313,%rax
+  806dcc:	ff ff ff 
+  806dcf:	48 01 d8             	add    %rbx,%rax
+  806dd2:	ff d0                	call   *%rax
+  806dd4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806dd7:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806ddb:	74 3e                	je     806e1b <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806ddd:	48 b8 f0 e6 ff ff ff 	movabs $0xffffffffffffe6f0,%rax
+  806de4:	ff ff ff 
+  806de7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806deb:	48 89 c2             	mov    %rax,%rdx
+  806dee:	be 23 00 00 00       	mov    $0x23,%esi
+  806df3:	48 b8 1e e7 ff ff ff 	movabs $0xffffffffffffe71e,%rax
+  806dfa:	ff ff ff 
+  806dfd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806e01:	48 89 c7             	mov    %rax,%rdi
+  806e04:	49 89 df             	mov    %rbx,%r15
+  806e07:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e0c:	48 b9 be 75 ff ff ff 	movabs $0xffffffffffff75be,%rcx
+  806e13:	ff ff ff 
+  806e16:	48 01 d9             	add    %rbx,%rcx
+  806e19:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806e1b:	48 ba b8 5f 01 00 00 	movabs $0x15fb8,%rdx
+  806e22:	00 00 00 
+  806e25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806e29:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806e2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e30:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806e37:	ff ff ff 
+  806e3a:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806e3e:	48 89 d6             	mov    %rdx,%rsi
+  806e41:	89 c7                	mov    %eax,%edi
+  806e43:	49 89 df             	mov    %rbx,%r15
+  806e46:	48 b8 09 95 ff ff ff 	movabs $0xffffffffffff9509,%rax
+  806e4d:	ff ff ff 
+  806e50:	48 01 d8             	add    %rbx,%rax
+  806e53:	ff d0                	call   *%rax
+}
+  806e55:	90                   	nop
+  806e56:	48 83 c4 20          	add    $0x20,%rsp
+  806e5a:	5b                   	pop    %rbx
+  806e5b:	41 5f                	pop    %r15
+  806e5d:	5d                   	pop    %rbp
+  806e5e:	c3                   	ret
+
+0000000000806e5f <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806e5f:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806e62:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806e69:	00 00 00 
+call *%rax
+  806e6c:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806e6e:	58                   	pop    %rax
+	popq %rax;
+  806e6f:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806e70:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806e77:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806e7b:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806e7f:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806e83:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806e87:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806e8b:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806e8e:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806e92:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806e96:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806e9b:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806ea0:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806ea5:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806eaa:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806eaf:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806eb4:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806eb9:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806ebe:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806ec3:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806ec8:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806ecd:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806ed2:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806ed7:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806edc:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806ee0:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806ee4:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806ee5:	5c                   	pop    %rsp
+	ret;			//return
+  806ee6:	c3                   	ret
+
+0000000000806ee7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806ee7:	55                   	push   %rbp
+  806ee8:	48 89 e5             	mov    %rsp,%rbp
+  806eeb:	48 83 ec 18          	sub    $0x18,%rsp
+  806eef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806eef <pageref+0x8>
+  806ef6:	49 bb 59 21 00 00 00 	movabs $0x2159,%r11
+  806efd:	00 00 00 
+  806f00:	4c 01 d8             	add    %r11,%rax
+  806f03:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806f07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806f0b:	48 89 d1             	mov    %rdx,%rcx
+  806f0e:	48 c1 e9 15          	shr    $0x15,%rcx
+  806f12:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806f19:	ff ff ff 
+  806f1c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806f20:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806f24:	83 e2 01             	and    $0x1,%edx
+  806f27:	48 85 d2             	test   %rdx,%rdx
+  806f2a:	75 07                	jne    806f33 <pageref+0x4c>
+		return 0;
+  806f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f31:	eb 64                	jmp    806f97 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806f33:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806f37:	48 89 d1             	mov    %rdx,%rcx
+  806f3a:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806f3e:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806f45:	ff ff ff 
+  806f48:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806f4c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806f50:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806f54:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806f58:	83 e2 01             	and    $0x1,%edx
+  806f5b:	48 85 d2             	test   %rdx,%rdx
+  806f5e:	75 07                	jne    806f67 <pageref+0x80>
+		return 0;
+  806f60:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f65:	eb 30                	jmp    806f97 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806f67:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806f6b:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806f6f:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806f76:	ff ff ff 
+  806f79:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806f7d:	48 89 d0             	mov    %rdx,%rax
+  806f80:	48 01 c0             	add    %rax,%rax
+  806f83:	48 01 d0             	add    %rdx,%rax
+  806f86:	48 c1 e0 03          	shl    $0x3,%rax
+  806f8a:	48 01 c8             	add    %rcx,%rax
+  806f8d:	48 83 c0 08          	add    $0x8,%rax
+  806f91:	0f b7 00             	movzwl (%rax),%eax
+  806f94:	0f b7 c0             	movzwl %ax,%eax
+}
+  806f97:	c9                   	leave
+  806f98:	c3                   	ret
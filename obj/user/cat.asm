@@ -0,0 +1,9758 @@
+
+obj/user/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 b5 02 00 00       	call   8002f6 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <cat>:
+
+char buf[8192];
+
+void
+cat(int f, char *s)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <cat+0xb>
+  800055:	49 bb e2 7f 00 00 00 	movabs $0x7fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	long n;
+	int r;
+
+	while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  800069:	e9 89 00 00 00       	jmp    8000f7 <cat+0xb4>
+		if ((r = write(1, buf, n)) != n)
+  80006e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800072:	48 89 c2             	mov    %rax,%rdx
+  800075:	48 b8 f0 1f 01 00 00 	movabs $0x11ff0,%rax
+  80007c:	00 00 00 
+  80007f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800083:	48 89 c6             	mov    %rax,%rsi
+  800086:	bf 01 00 00 00       	mov    $0x1,%edi
+  80008b:	49 89 df             	mov    %rbx,%r15
+  80008e:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  800095:	ff ff ff 
+  800098:	48 01 d8             	add    %rbx,%rax
+  80009b:	ff d0                	call   *%rax
+  80009d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8000a0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8000a3:	48 98                	cltq
+  8000a5:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8000a9:	74 4c                	je     8000f7 <cat+0xb4>
+			panic("write error copying %s: %e", s, r);
+  8000ab:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8000ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8000b2:	41 89 d0             	mov    %edx,%r8d
+  8000b5:	48 89 c1             	mov    %rax,%rcx
+  8000b8:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  8000bf:	ff ff ff 
+  8000c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c6:	48 89 c2             	mov    %rax,%rdx
+  8000c9:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000ce:	48 b8 13 e4 ff ff ff 	movabs $0xffffffffffffe413,%rax
+  8000d5:	ff ff ff 
+  8000d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000dc:	48 89 c7             	mov    %rax,%rdi
+  8000df:	49 89 df             	mov    %rbx,%r15
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	49 b9 d0 83 ff ff ff 	movabs $0xffffffffffff83d0,%r9
+  8000ee:	ff ff ff 
+  8000f1:	49 01 d9             	add    %rbx,%r9
+  8000f4:	41 ff d1             	call   *%r9
+	while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  8000f7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8000fa:	ba 00 20 00 00       	mov    $0x2000,%edx
+  8000ff:	48 b9 f0 1f 01 00 00 	movabs $0x11ff0,%rcx
+  800106:	00 00 00 
+  800109:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  80010d:	48 89 ce             	mov    %rcx,%rsi
+  800110:	89 c7                	mov    %eax,%edi
+  800112:	49 89 df             	mov    %rbx,%r15
+  800115:	48 b8 45 af ff ff ff 	movabs $0xffffffffffffaf45,%rax
+  80011c:	ff ff ff 
+  80011f:	48 01 d8             	add    %rbx,%rax
+  800122:	ff d0                	call   *%rax
+  800124:	48 98                	cltq
+  800126:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  80012a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80012f:	0f 8f 39 ff ff ff    	jg     80006e <cat+0x2b>
+	if (n < 0)
+  800135:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80013a:	79 4d                	jns    800189 <cat+0x146>
+		panic("error reading %s: %e", s, n);
+  80013c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800140:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800144:	49 89 d0             	mov    %rdx,%r8
+  800147:	48 89 c1             	mov    %rax,%rcx
+  80014a:	48 b8 1e e4 ff ff ff 	movabs $0xffffffffffffe41e,%rax
+  800151:	ff ff ff 
+  800154:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800158:	48 89 c2             	mov    %rax,%rdx
+  80015b:	be 0f 00 00 00       	mov    $0xf,%esi
+  800160:	48 b8 13 e4 ff ff ff 	movabs $0xffffffffffffe413,%rax
+  800167:	ff ff ff 
+  80016a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80016e:	48 89 c7             	mov    %rax,%rdi
+  800171:	49 89 df             	mov    %rbx,%r15
+  800174:	b8 00 00 00 00       	mov    $0x0,%eax
+  800179:	49 b9 d0 83 ff ff ff 	movabs $0xffffffffffff83d0,%r9
+  800180:	ff ff ff 
+  800183:	49 01 d9             	add    %rbx,%r9
+  800186:	41 ff d1             	call   *%r9
+}
+  800189:	90                   	nop
+  80018a:	48 83 c4 20          	add    $0x20,%rsp
+  80018e:	5b                   	pop    %rbx
+  80018f:	41 5f                	pop    %r15
+  800191:	5d                   	pop    %rbp
+  800192:	c3                   	ret
+
+0000000000800193 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+  800197:	41 57                	push   %r15
+  800199:	53                   	push   %rbx
+  80019a:	48 83 ec 20          	sub    $0x20,%rsp
+  80019e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80019e <umain+0xb>
+  8001a5:	49 bb 92 7e 00 00 00 	movabs $0x7e92,%r11
+  8001ac:	00 00 00 
+  8001af:	4c 01 db             	add    %r11,%rbx
+  8001b2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8001b5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int f, i;
+
+	binaryname = "cat";
+  8001b9:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8001c0:	ff ff ff 
+  8001c3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8001c7:	48 ba 33 e4 ff ff ff 	movabs $0xffffffffffffe433,%rdx
+  8001ce:	ff ff ff 
+  8001d1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8001d5:	48 89 10             	mov    %rdx,(%rax)
+	if (argc == 1)
+  8001d8:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  8001dc:	75 2b                	jne    800209 <umain+0x76>
+		cat(0, "<stdin>");
+  8001de:	48 b8 37 e4 ff ff ff 	movabs $0xffffffffffffe437,%rax
+  8001e5:	ff ff ff 
+  8001e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001ec:	48 89 c6             	mov    %rax,%rsi
+  8001ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f4:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  8001fb:	ff ff ff 
+  8001fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800202:	ff d0                	call   *%rax
+			else {
+				cat(f, argv[i]);
+				close(f);
+			}
+		}
+}
+  800204:	e9 e3 00 00 00       	jmp    8002ec <umain+0x159>
+		for (i = 1; i < argc; i++) {
+  800209:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+  800210:	e9 cb 00 00 00       	jmp    8002e0 <umain+0x14d>
+			f = open(argv[i], O_RDONLY);
+  800215:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800218:	48 98                	cltq
+  80021a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800221:	00 
+  800222:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800226:	48 01 d0             	add    %rdx,%rax
+  800229:	48 8b 00             	mov    (%rax),%rax
+  80022c:	be 00 00 00 00       	mov    $0x0,%esi
+  800231:	48 89 c7             	mov    %rax,%rdi
+  800234:	49 89 df             	mov    %rbx,%r15
+  800237:	48 b8 14 b7 ff ff ff 	movabs $0xffffffffffffb714,%rax
+  80023e:	ff ff ff 
+  800241:	48 01 d8             	add    %rbx,%rax
+  800244:	ff d0                	call   *%rax
+  800246:	89 45 e8             	mov    %eax,-0x18(%rbp)
+			if (f < 0)
+  800249:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80024d:	79 47                	jns    800296 <umain+0x103>
+				printf("can't open %s: %e\n", argv[i], f);
+  80024f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800252:	48 98                	cltq
+  800254:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80025b:	00 
+  80025c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800260:	48 01 d0             	add    %rdx,%rax
+  800263:	48 8b 00             	mov    (%rax),%rax
+  800266:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800269:	48 89 c6             	mov    %rax,%rsi
+  80026c:	48 b8 3f e4 ff ff ff 	movabs $0xffffffffffffe43f,%rax
+  800273:	ff ff ff 
+  800276:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80027a:	48 89 c7             	mov    %rax,%rdi
+  80027d:	49 89 df             	mov    %rbx,%r15
+  800280:	b8 00 00 00 00       	mov    $0x0,%eax
+  800285:	48 b9 57 c2 ff ff ff 	movabs $0xffffffffffffc257,%rcx
+  80028c:	ff ff ff 
+  80028f:	48 01 d9             	add    %rbx,%rcx
+  800292:	ff d1                	call   *%rcx
+  800294:	eb 46                	jmp    8002dc <umain+0x149>
+				cat(f, argv[i]);
+  800296:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800299:	48 98                	cltq
+  80029b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8002a2:	00 
+  8002a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8002a7:	48 01 d0             	add    %rdx,%rax
+  8002aa:	48 8b 10             	mov    (%rax),%rdx
+  8002ad:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8002b0:	48 89 d6             	mov    %rdx,%rsi
+  8002b3:	89 c7                	mov    %eax,%edi
+  8002b5:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  8002bc:	ff ff ff 
+  8002bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002c3:	ff d0                	call   *%rax
+				close(f);
+  8002c5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8002c8:	89 c7                	mov    %eax,%edi
+  8002ca:	49 89 df             	mov    %rbx,%r15
+  8002cd:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  8002d4:	ff ff ff 
+  8002d7:	48 01 d8             	add    %rbx,%rax
+  8002da:	ff d0                	call   *%rax
+		for (i = 1; i < argc; i++) {
+  8002dc:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8002e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002e3:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  8002e6:	0f 8c 29 ff ff ff    	jl     800215 <umain+0x82>
+}
+  8002ec:	90                   	nop
+  8002ed:	48 83 c4 20          	add    $0x20,%rsp
+  8002f1:	5b                   	pop    %rbx
+  8002f2:	41 5f                	pop    %r15
+  8002f4:	5d                   	pop    %rbp
+  8002f5:	c3                   	ret
+
+00000000008002f6 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002f6:	55                   	push   %rbp
+  8002f7:	48 89 e5             	mov    %rsp,%rbp
+  8002fa:	41 57                	push   %r15
+  8002fc:	53                   	push   %rbx
+  8002fd:	48 83 ec 20          	sub    $0x20,%rsp
+  800301:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800301 <libmain+0xb>
+  800308:	49 bb 2f 7d 00 00 00 	movabs $0x7d2f,%r11
+  80030f:	00 00 00 
+  800312:	4c 01 db             	add    %r11,%rbx
+  800315:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800318:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80031c:	49 89 df             	mov    %rbx,%r15
+  80031f:	48 b8 7c a0 ff ff ff 	movabs $0xffffffffffffa07c,%rax
+  800326:	ff ff ff 
+  800329:	48 01 d8             	add    %rbx,%rax
+  80032c:	ff d0                	call   *%rax
+  80032e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800331:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800334:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800339:	48 98                	cltq
+  80033b:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800342:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  800349:	ff ff ff 
+  80034c:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800350:	48 01 c2             	add    %rax,%rdx
+  800353:	48 b8 f0 3f 01 00 00 	movabs $0x13ff0,%rax
+  80035a:	00 00 00 
+  80035d:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800361:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800365:	7e 15                	jle    80037c <libmain+0x86>
+		binaryname = argv[0];
+  800367:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80036b:	48 8b 00             	mov    (%rax),%rax
+  80036e:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  800375:	00 00 00 
+  800378:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80037c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800380:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800383:	48 89 d6             	mov    %rdx,%rsi
+  800386:	89 c7                	mov    %eax,%edi
+  800388:	49 89 df             	mov    %rbx,%r15
+  80038b:	48 b8 63 81 ff ff ff 	movabs $0xffffffffffff8163,%rax
+  800392:	ff ff ff 
+  800395:	48 01 d8             	add    %rbx,%rax
+  800398:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80039a:	49 89 df             	mov    %rbx,%r15
+  80039d:	48 b8 86 83 ff ff ff 	movabs $0xffffffffffff8386,%rax
+  8003a4:	ff ff ff 
+  8003a7:	48 01 d8             	add    %rbx,%rax
+  8003aa:	ff d0                	call   *%rax
+}
+  8003ac:	90                   	nop
+  8003ad:	48 83 c4 20          	add    $0x20,%rsp
+  8003b1:	5b                   	pop    %rbx
+  8003b2:	41 5f                	pop    %r15
+  8003b4:	5d                   	pop    %rbp
+  8003b5:	c3                   	ret
+
+00000000008003b6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003b6:	55                   	push   %rbp
+  8003b7:	48 89 e5             	mov    %rsp,%rbp
+  8003ba:	41 57                	push   %r15
+  8003bc:	53                   	push   %rbx
+  8003bd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8003bd <exit+0x7>
+  8003c4:	49 bb 73 7c 00 00 00 	movabs $0x7c73,%r11
+  8003cb:	00 00 00 
+  8003ce:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8003d1:	49 89 df             	mov    %rbx,%r15
+  8003d4:	48 b8 f9 ac ff ff ff 	movabs $0xffffffffffffacf9,%rax
+  8003db:	ff ff ff 
+  8003de:	48 01 d8             	add    %rbx,%rax
+  8003e1:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8003e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003e8:	49 89 df             	mov    %rbx,%r15
+  8003eb:	48 b8 20 a0 ff ff ff 	movabs $0xffffffffffffa020,%rax
+  8003f2:	ff ff ff 
+  8003f5:	48 01 d8             	add    %rbx,%rax
+  8003f8:	ff d0                	call   *%rax
+}
+  8003fa:	90                   	nop
+  8003fb:	5b                   	pop    %rbx
+  8003fc:	41 5f                	pop    %r15
+  8003fe:	5d                   	pop    %rbp
+  8003ff:	c3                   	ret
+
+0000000000800400 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800400:	55                   	push   %rbp
+  800401:	48 89 e5             	mov    %rsp,%rbp
+  800404:	41 57                	push   %r15
+  800406:	41 54                	push   %r12
+  800408:	53                   	push   %rbx
+  800409:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800410:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800410 <_panic+0x10>
+  800417:	49 bb 20 7c 00 00 00 	movabs $0x7c20,%r11
+  80041e:	00 00 00 
+  800421:	4c 01 db             	add    %r11,%rbx
+  800424:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80042b:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800431:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800438:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80043f:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800446:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80044d:	84 c0                	test   %al,%al
+  80044f:	74 26                	je     800477 <_panic+0x77>
+  800451:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800458:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80045f:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800463:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800467:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80046b:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80046f:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800473:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800477:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80047e:	00 00 00 
+  800481:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800488:	00 00 00 
+  80048b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80048f:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800496:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80049d:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004a4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8004ab:	ff ff ff 
+  8004ae:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8004b2:	4c 8b 20             	mov    (%rax),%r12
+  8004b5:	49 89 df             	mov    %rbx,%r15
+  8004b8:	48 b8 7c a0 ff ff ff 	movabs $0xffffffffffffa07c,%rax
+  8004bf:	ff ff ff 
+  8004c2:	48 01 d8             	add    %rbx,%rax
+  8004c5:	ff d0                	call   *%rax
+  8004c7:	89 c6                	mov    %eax,%esi
+  8004c9:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8004cf:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8004d6:	41 89 d0             	mov    %edx,%r8d
+  8004d9:	48 89 c1             	mov    %rax,%rcx
+  8004dc:	4c 89 e2             	mov    %r12,%rdx
+  8004df:	48 b8 60 e4 ff ff ff 	movabs $0xffffffffffffe460,%rax
+  8004e6:	ff ff ff 
+  8004e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004ed:	48 89 c7             	mov    %rax,%rdi
+  8004f0:	49 89 df             	mov    %rbx,%r15
+  8004f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f8:	49 b9 a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%r9
+  8004ff:	ff ff ff 
+  800502:	49 01 d9             	add    %rbx,%r9
+  800505:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800508:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80050f:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800516:	48 89 d6             	mov    %rdx,%rsi
+  800519:	48 89 c7             	mov    %rax,%rdi
+  80051c:	49 89 df             	mov    %rbx,%r15
+  80051f:	48 b8 c7 85 ff ff ff 	movabs $0xffffffffffff85c7,%rax
+  800526:	ff ff ff 
+  800529:	48 01 d8             	add    %rbx,%rax
+  80052c:	ff d0                	call   *%rax
+	cprintf("\n");
+  80052e:	48 b8 83 e4 ff ff ff 	movabs $0xffffffffffffe483,%rax
+  800535:	ff ff ff 
+  800538:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80053c:	48 89 c7             	mov    %rax,%rdi
+  80053f:	49 89 df             	mov    %rbx,%r15
+  800542:	b8 00 00 00 00       	mov    $0x0,%eax
+  800547:	48 ba a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%rdx
+  80054e:	ff ff ff 
+  800551:	48 01 da             	add    %rbx,%rdx
+  800554:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800556:	cc                   	int3
+  800557:	eb fd                	jmp    800556 <_panic+0x156>
+
+0000000000800559 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800559:	55                   	push   %rbp
+  80055a:	48 89 e5             	mov    %rsp,%rbp
+  80055d:	41 57                	push   %r15
+  80055f:	48 83 ec 18          	sub    $0x18,%rsp
+  800563:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800563 <putch+0xa>
+  80056a:	49 bb cd 7a 00 00 00 	movabs $0x7acd,%r11
+  800571:	00 00 00 
+  800574:	4c 01 d8             	add    %r11,%rax
+  800577:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80057a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80057e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800582:	8b 12                	mov    (%rdx),%edx
+  800584:	8d 72 01             	lea    0x1(%rdx),%esi
+  800587:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80058b:	89 31                	mov    %esi,(%rcx)
+  80058d:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800590:	89 ce                	mov    %ecx,%esi
+  800592:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800596:	48 63 d2             	movslq %edx,%rdx
+  800599:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80059e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005a2:	8b 12                	mov    (%rdx),%edx
+  8005a4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005aa:	75 33                	jne    8005df <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8005ac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005b0:	8b 12                	mov    (%rdx),%edx
+  8005b2:	48 63 d2             	movslq %edx,%rdx
+  8005b5:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8005b9:	48 83 c1 08          	add    $0x8,%rcx
+  8005bd:	48 89 d6             	mov    %rdx,%rsi
+  8005c0:	48 89 cf             	mov    %rcx,%rdi
+  8005c3:	49 89 c7             	mov    %rax,%r15
+  8005c6:	48 ba 6d 9f ff ff ff 	movabs $0xffffffffffff9f6d,%rdx
+  8005cd:	ff ff ff 
+  8005d0:	48 01 c2             	add    %rax,%rdx
+  8005d3:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8005d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005d9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8005df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005e3:	8b 40 04             	mov    0x4(%rax),%eax
+  8005e6:	8d 50 01             	lea    0x1(%rax),%edx
+  8005e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005ed:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8005f0:	90                   	nop
+  8005f1:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8005f5:	c9                   	leave
+  8005f6:	c3                   	ret
+
+00000000008005f7 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005f7:	55                   	push   %rbp
+  8005f8:	48 89 e5             	mov    %rsp,%rbp
+  8005fb:	41 57                	push   %r15
+  8005fd:	53                   	push   %rbx
+  8005fe:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800605:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800605 <vcprintf+0xe>
+  80060c:	49 bb 2b 7a 00 00 00 	movabs $0x7a2b,%r11
+  800613:	00 00 00 
+  800616:	4c 01 db             	add    %r11,%rbx
+  800619:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800620:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800627:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80062e:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800635:	48 8b 06             	mov    (%rsi),%rax
+  800638:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80063c:	48 89 01             	mov    %rax,(%rcx)
+  80063f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800643:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800647:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80064b:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800652:	00 00 00 
+    b.cnt = 0;
+  800655:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80065c:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  80065f:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800666:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80066d:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800674:	48 89 c6             	mov    %rax,%rsi
+  800677:	48 b8 29 85 ff ff ff 	movabs $0xffffffffffff8529,%rax
+  80067e:	ff ff ff 
+  800681:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800685:	48 89 c7             	mov    %rax,%rdi
+  800688:	49 89 df             	mov    %rbx,%r15
+  80068b:	48 b8 eb 8a ff ff ff 	movabs $0xffffffffffff8aeb,%rax
+  800692:	ff ff ff 
+  800695:	48 01 d8             	add    %rbx,%rax
+  800698:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  80069a:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8006a0:	48 98                	cltq
+  8006a2:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8006a9:	48 83 c2 08          	add    $0x8,%rdx
+  8006ad:	48 89 c6             	mov    %rax,%rsi
+  8006b0:	48 89 d7             	mov    %rdx,%rdi
+  8006b3:	49 89 df             	mov    %rbx,%r15
+  8006b6:	48 b8 6d 9f ff ff ff 	movabs $0xffffffffffff9f6d,%rax
+  8006bd:	ff ff ff 
+  8006c0:	48 01 d8             	add    %rbx,%rax
+  8006c3:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8006c5:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8006cb:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8006d2:	5b                   	pop    %rbx
+  8006d3:	41 5f                	pop    %r15
+  8006d5:	5d                   	pop    %rbp
+  8006d6:	c3                   	ret
+
+00000000008006d7 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8006d7:	55                   	push   %rbp
+  8006d8:	48 89 e5             	mov    %rsp,%rbp
+  8006db:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8006e2:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8006e2 <cprintf+0xb>
+  8006e9:	49 bb 4e 79 00 00 00 	movabs $0x794e,%r11
+  8006f0:	00 00 00 
+  8006f3:	4d 01 da             	add    %r11,%r10
+  8006f6:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8006fd:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800704:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80070b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800712:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800719:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800720:	84 c0                	test   %al,%al
+  800722:	74 20                	je     800744 <cprintf+0x6d>
+  800724:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800728:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80072c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800730:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800734:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800738:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80073c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800740:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800744:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80074b:	00 00 00 
+  80074e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800755:	00 00 00 
+  800758:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80075c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800763:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80076a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800771:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800778:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80077f:	48 8b 06             	mov    (%rsi),%rax
+  800782:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800786:	48 89 01             	mov    %rax,(%rcx)
+  800789:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80078d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800791:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800795:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80079c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8007a3:	48 89 d6             	mov    %rdx,%rsi
+  8007a6:	48 89 c7             	mov    %rax,%rdi
+  8007a9:	48 b8 c7 85 ff ff ff 	movabs $0xffffffffffff85c7,%rax
+  8007b0:	ff ff ff 
+  8007b3:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8007b7:	ff d0                	call   *%rax
+  8007b9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8007bf:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8007c5:	c9                   	leave
+  8007c6:	c3                   	ret
+
+00000000008007c7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8007c7:	55                   	push   %rbp
+  8007c8:	48 89 e5             	mov    %rsp,%rbp
+  8007cb:	53                   	push   %rbx
+  8007cc:	48 83 ec 38          	sub    $0x38,%rsp
+  8007d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8007d0 <printnum+0x9>
+  8007d7:	49 bb 60 78 00 00 00 	movabs $0x7860,%r11
+  8007de:	00 00 00 
+  8007e1:	4c 01 db             	add    %r11,%rbx
+  8007e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8007ec:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8007f0:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8007f3:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8007f7:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8007fb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8007fe:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800802:	72 58                	jb     80085c <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800804:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800807:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80080a:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  80080d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800811:	ba 00 00 00 00       	mov    $0x0,%edx
+  800816:	48 f7 f6             	div    %rsi
+  800819:	49 89 c2             	mov    %rax,%r10
+  80081c:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80081f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800822:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800826:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80082a:	41 89 c9             	mov    %ecx,%r9d
+  80082d:	41 89 f8             	mov    %edi,%r8d
+  800830:	89 d1                	mov    %edx,%ecx
+  800832:	4c 89 d2             	mov    %r10,%rdx
+  800835:	48 89 c7             	mov    %rax,%rdi
+  800838:	48 b8 97 87 ff ff ff 	movabs $0xffffffffffff8797,%rax
+  80083f:	ff ff ff 
+  800842:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800846:	ff d0                	call   *%rax
+  800848:	eb 1c                	jmp    800866 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80084a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80084e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800851:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800855:	48 89 d6             	mov    %rdx,%rsi
+  800858:	89 c7                	mov    %eax,%edi
+  80085a:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80085c:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800860:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800864:	7f e4                	jg     80084a <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800866:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800869:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80086d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800872:	48 f7 f1             	div    %rcx
+  800875:	48 b8 bf e5 ff ff ff 	movabs $0xffffffffffffe5bf,%rax
+  80087c:	ff ff ff 
+  80087f:	48 01 d8             	add    %rbx,%rax
+  800882:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800886:	0f be c0             	movsbl %al,%eax
+  800889:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80088d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800891:	48 89 d6             	mov    %rdx,%rsi
+  800894:	89 c7                	mov    %eax,%edi
+  800896:	ff d1                	call   *%rcx
+}
+  800898:	90                   	nop
+  800899:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80089d:	c9                   	leave
+  80089e:	c3                   	ret
+
+000000000080089f <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80089f:	55                   	push   %rbp
+  8008a0:	48 89 e5             	mov    %rsp,%rbp
+  8008a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8008a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008a7 <getuint+0x8>
+  8008ae:	49 bb 89 77 00 00 00 	movabs $0x7789,%r11
+  8008b5:	00 00 00 
+  8008b8:	4c 01 d8             	add    %r11,%rax
+  8008bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008bf:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8008c2:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8008c6:	7e 4f                	jle    800917 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8008c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008cc:	8b 00                	mov    (%rax),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	77 24                	ja     8008f7 <getuint+0x58>
+  8008d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008d7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008df:	8b 00                	mov    (%rax),%eax
+  8008e1:	89 c0                	mov    %eax,%eax
+  8008e3:	48 01 d0             	add    %rdx,%rax
+  8008e6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008ea:	8b 12                	mov    (%rdx),%edx
+  8008ec:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008ef:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008f3:	89 0a                	mov    %ecx,(%rdx)
+  8008f5:	eb 14                	jmp    80090b <getuint+0x6c>
+  8008f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008fb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008ff:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800903:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800907:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80090b:	48 8b 00             	mov    (%rax),%rax
+  80090e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800912:	e9 9d 00 00 00       	jmp    8009b4 <getuint+0x115>
+	else if (lflag)
+  800917:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80091b:	74 4c                	je     800969 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  80091d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800921:	8b 00                	mov    (%rax),%eax
+  800923:	83 f8 2f             	cmp    $0x2f,%eax
+  800926:	77 24                	ja     80094c <getuint+0xad>
+  800928:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80092c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800930:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800934:	8b 00                	mov    (%rax),%eax
+  800936:	89 c0                	mov    %eax,%eax
+  800938:	48 01 d0             	add    %rdx,%rax
+  80093b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80093f:	8b 12                	mov    (%rdx),%edx
+  800941:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800944:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800948:	89 0a                	mov    %ecx,(%rdx)
+  80094a:	eb 14                	jmp    800960 <getuint+0xc1>
+  80094c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800950:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800954:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800958:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80095c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800960:	48 8b 00             	mov    (%rax),%rax
+  800963:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800967:	eb 4b                	jmp    8009b4 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800969:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80096d:	8b 00                	mov    (%rax),%eax
+  80096f:	83 f8 2f             	cmp    $0x2f,%eax
+  800972:	77 24                	ja     800998 <getuint+0xf9>
+  800974:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800978:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80097c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800980:	8b 00                	mov    (%rax),%eax
+  800982:	89 c0                	mov    %eax,%eax
+  800984:	48 01 d0             	add    %rdx,%rax
+  800987:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80098b:	8b 12                	mov    (%rdx),%edx
+  80098d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800990:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800994:	89 0a                	mov    %ecx,(%rdx)
+  800996:	eb 14                	jmp    8009ac <getuint+0x10d>
+  800998:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80099c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009a0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009a4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009a8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009ac:	8b 00                	mov    (%rax),%eax
+  8009ae:	89 c0                	mov    %eax,%eax
+  8009b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8009b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8009b8:	c9                   	leave
+  8009b9:	c3                   	ret
+
+00000000008009ba <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8009ba:	55                   	push   %rbp
+  8009bb:	48 89 e5             	mov    %rsp,%rbp
+  8009be:	48 83 ec 20          	sub    $0x20,%rsp
+  8009c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8009c2 <printfloat+0x8>
+  8009c9:	49 bb 6e 76 00 00 00 	movabs $0x766e,%r11
+  8009d0:	00 00 00 
+  8009d3:	4c 01 d8             	add    %r11,%rax
+  8009d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009de:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8009e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e6:	48 85 c0             	test   %rax,%rax
+  8009e9:	79 12                	jns    8009fd <printfloat+0x43>
+		putch('-',putdat);
+  8009eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8009ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009f3:	48 89 c6             	mov    %rax,%rsi
+  8009f6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009fb:	ff d2                	call   *%rdx
+	
+}
+  8009fd:	90                   	nop
+  8009fe:	c9                   	leave
+  8009ff:	c3                   	ret
+
+0000000000800a00 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800a00:	55                   	push   %rbp
+  800a01:	48 89 e5             	mov    %rsp,%rbp
+  800a04:	48 83 ec 20          	sub    $0x20,%rsp
+  800a08:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a08 <getint+0x8>
+  800a0f:	49 bb 28 76 00 00 00 	movabs $0x7628,%r11
+  800a16:	00 00 00 
+  800a19:	4c 01 d8             	add    %r11,%rax
+  800a1c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a20:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800a23:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a27:	7e 4f                	jle    800a78 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800a29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a2d:	8b 00                	mov    (%rax),%eax
+  800a2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a32:	77 24                	ja     800a58 <getint+0x58>
+  800a34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a38:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a40:	8b 00                	mov    (%rax),%eax
+  800a42:	89 c0                	mov    %eax,%eax
+  800a44:	48 01 d0             	add    %rdx,%rax
+  800a47:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a4b:	8b 12                	mov    (%rdx),%edx
+  800a4d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a50:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a54:	89 0a                	mov    %ecx,(%rdx)
+  800a56:	eb 14                	jmp    800a6c <getint+0x6c>
+  800a58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a60:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a64:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a68:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a6c:	48 8b 00             	mov    (%rax),%rax
+  800a6f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a73:	e9 9d 00 00 00       	jmp    800b15 <getint+0x115>
+	else if (lflag)
+  800a78:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800a7c:	74 4c                	je     800aca <getint+0xca>
+		x=va_arg(*ap, long);
+  800a7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a82:	8b 00                	mov    (%rax),%eax
+  800a84:	83 f8 2f             	cmp    $0x2f,%eax
+  800a87:	77 24                	ja     800aad <getint+0xad>
+  800a89:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a8d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a95:	8b 00                	mov    (%rax),%eax
+  800a97:	89 c0                	mov    %eax,%eax
+  800a99:	48 01 d0             	add    %rdx,%rax
+  800a9c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aa0:	8b 12                	mov    (%rdx),%edx
+  800aa2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800aa5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aa9:	89 0a                	mov    %ecx,(%rdx)
+  800aab:	eb 14                	jmp    800ac1 <getint+0xc1>
+  800aad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ab5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ab9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800abd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ac1:	48 8b 00             	mov    (%rax),%rax
+  800ac4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800ac8:	eb 4b                	jmp    800b15 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800aca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ace:	8b 00                	mov    (%rax),%eax
+  800ad0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad3:	77 24                	ja     800af9 <getint+0xf9>
+  800ad5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800add:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae1:	8b 00                	mov    (%rax),%eax
+  800ae3:	89 c0                	mov    %eax,%eax
+  800ae5:	48 01 d0             	add    %rdx,%rax
+  800ae8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aec:	8b 12                	mov    (%rdx),%edx
+  800aee:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800af1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800af5:	89 0a                	mov    %ecx,(%rdx)
+  800af7:	eb 14                	jmp    800b0d <getint+0x10d>
+  800af9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b01:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b09:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b0d:	8b 00                	mov    (%rax),%eax
+  800b0f:	48 98                	cltq
+  800b11:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b19:	c9                   	leave
+  800b1a:	c3                   	ret
+
+0000000000800b1b <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800b1b:	55                   	push   %rbp
+  800b1c:	48 89 e5             	mov    %rsp,%rbp
+  800b1f:	41 57                	push   %r15
+  800b21:	41 55                	push   %r13
+  800b23:	41 54                	push   %r12
+  800b25:	53                   	push   %rbx
+  800b26:	48 83 ec 60          	sub    $0x60,%rsp
+  800b2a:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800b2a <vprintfmt+0xf>
+  800b31:	49 bb 06 75 00 00 00 	movabs $0x7506,%r11
+  800b38:	00 00 00 
+  800b3b:	4d 01 dc             	add    %r11,%r12
+  800b3e:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800b42:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800b46:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b4a:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800b4e:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800b55:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800b59:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800b5d:	48 8b 06             	mov    (%rsi),%rax
+  800b60:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800b64:	48 89 01             	mov    %rax,(%rcx)
+  800b67:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800b6b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800b6f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800b73:	eb 17                	jmp    800b8c <vprintfmt+0x71>
+			if (ch == '\0')
+  800b75:	85 db                	test   %ebx,%ebx
+  800b77:	0f 84 97 05 00 00    	je     801114 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800b7d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800b81:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800b85:	48 89 c6             	mov    %rax,%rsi
+  800b88:	89 df                	mov    %ebx,%edi
+  800b8a:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800b8c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b90:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b94:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b98:	0f b6 00             	movzbl (%rax),%eax
+  800b9b:	0f b6 d8             	movzbl %al,%ebx
+  800b9e:	83 fb 25             	cmp    $0x25,%ebx
+  800ba1:	75 d2                	jne    800b75 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800ba3:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800ba7:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800bae:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800bb5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800bbc:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800bc3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800bc7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bcb:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800bcf:	0f b6 00             	movzbl (%rax),%eax
+  800bd2:	0f b6 d8             	movzbl %al,%ebx
+  800bd5:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800bd8:	83 f8 55             	cmp    $0x55,%eax
+  800bdb:	0f 87 00 05 00 00    	ja     8010e1 <vprintfmt+0x5c6>
+  800be1:	89 c0                	mov    %eax,%eax
+  800be3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800bea:	00 
+  800beb:	48 8d 05 26 5a 00 00 	lea    0x5a26(%rip),%rax        # 806618 <.LC18+0xc>
+  800bf2:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800bf6:	48 8d 15 1b 5a 00 00 	lea    0x5a1b(%rip),%rdx        # 806618 <.LC18+0xc>
+  800bfd:	48 01 d0             	add    %rdx,%rax
+  800c00:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800c02:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800c06:	eb bb                	jmp    800bc3 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800c08:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800c0c:	eb b5                	jmp    800bc3 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800c0e:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c15:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800c18:	89 d0                	mov    %edx,%eax
+  800c1a:	c1 e0 02             	shl    $0x2,%eax
+  800c1d:	01 d0                	add    %edx,%eax
+  800c1f:	01 c0                	add    %eax,%eax
+  800c21:	01 d8                	add    %ebx,%eax
+  800c23:	83 e8 30             	sub    $0x30,%eax
+  800c26:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800c29:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c2d:	0f b6 00             	movzbl (%rax),%eax
+  800c30:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800c33:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c36:	7e 60                	jle    800c98 <vprintfmt+0x17d>
+  800c38:	83 fb 39             	cmp    $0x39,%ebx
+  800c3b:	7f 5b                	jg     800c98 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800c3d:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c42:	eb d1                	jmp    800c15 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800c44:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c47:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4a:	77 17                	ja     800c63 <vprintfmt+0x148>
+  800c4c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c50:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c53:	89 d2                	mov    %edx,%edx
+  800c55:	48 01 d0             	add    %rdx,%rax
+  800c58:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c5b:	83 c2 08             	add    $0x8,%edx
+  800c5e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c61:	eb 0c                	jmp    800c6f <vprintfmt+0x154>
+  800c63:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c67:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c6b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c6f:	8b 00                	mov    (%rax),%eax
+  800c71:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800c74:	eb 23                	jmp    800c99 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800c76:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c7a:	0f 89 43 ff ff ff    	jns    800bc3 <vprintfmt+0xa8>
+				width = 0;
+  800c80:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800c87:	e9 37 ff ff ff       	jmp    800bc3 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800c8c:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800c93:	e9 2b ff ff ff       	jmp    800bc3 <vprintfmt+0xa8>
+			goto process_precision;
+  800c98:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800c99:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c9d:	0f 89 20 ff ff ff    	jns    800bc3 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800ca3:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ca6:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800ca9:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800cb0:	e9 0e ff ff ff       	jmp    800bc3 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800cb5:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800cb9:	e9 05 ff ff ff       	jmp    800bc3 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800cbe:	83 fb 39             	cmp    $0x39,%ebx
+  800cc1:	7f 0b                	jg     800cce <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800cc3:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800cc6:	c1 e0 08             	shl    $0x8,%eax
+  800cc9:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ccc:	eb 21                	jmp    800cef <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800cce:	83 fb 60             	cmp    $0x60,%ebx
+  800cd1:	7e 10                	jle    800ce3 <vprintfmt+0x1c8>
+  800cd3:	83 fb 66             	cmp    $0x66,%ebx
+  800cd6:	7f 0b                	jg     800ce3 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800cd8:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800cdb:	c1 e0 08             	shl    $0x8,%eax
+  800cde:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ce1:	eb 0c                	jmp    800cef <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800ce3:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800cea:	e9 04 01 00 00       	jmp    800df3 <vprintfmt+0x2d8>
+  800cef:	e9 ff 00 00 00       	jmp    800df3 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800cf4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800cf7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfa:	77 17                	ja     800d13 <vprintfmt+0x1f8>
+  800cfc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d00:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d03:	89 d2                	mov    %edx,%edx
+  800d05:	48 01 d0             	add    %rdx,%rax
+  800d08:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d0b:	83 c2 08             	add    $0x8,%edx
+  800d0e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d11:	eb 0c                	jmp    800d1f <vprintfmt+0x204>
+  800d13:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d17:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d1b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d1f:	8b 00                	mov    (%rax),%eax
+  800d21:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800d25:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800d29:	48 89 d6             	mov    %rdx,%rsi
+  800d2c:	89 c7                	mov    %eax,%edi
+  800d2e:	ff d1                	call   *%rcx
+			break;
+  800d30:	e9 da 03 00 00       	jmp    80110f <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800d35:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d38:	83 f8 2f             	cmp    $0x2f,%eax
+  800d3b:	77 17                	ja     800d54 <vprintfmt+0x239>
+  800d3d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d41:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d44:	89 d2                	mov    %edx,%edx
+  800d46:	48 01 d0             	add    %rdx,%rax
+  800d49:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d4c:	83 c2 08             	add    $0x8,%edx
+  800d4f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d52:	eb 0c                	jmp    800d60 <vprintfmt+0x245>
+  800d54:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d58:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d5c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d60:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800d62:	85 db                	test   %ebx,%ebx
+  800d64:	79 02                	jns    800d68 <vprintfmt+0x24d>
+				err = -err;
+  800d66:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d68:	83 fb 15             	cmp    $0x15,%ebx
+  800d6b:	7f 19                	jg     800d86 <vprintfmt+0x26b>
+  800d6d:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800d74:	00 00 00 
+  800d77:	48 63 c3             	movslq %ebx,%rax
+  800d7a:	4c 01 e2             	add    %r12,%rdx
+  800d7d:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800d81:	4d 85 ed             	test   %r13,%r13
+  800d84:	75 36                	jne    800dbc <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800d86:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800d8a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d8e:	89 d9                	mov    %ebx,%ecx
+  800d90:	48 ba d0 e5 ff ff ff 	movabs $0xffffffffffffe5d0,%rdx
+  800d97:	ff ff ff 
+  800d9a:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800d9e:	48 89 c7             	mov    %rax,%rdi
+  800da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da6:	49 b8 f2 90 ff ff ff 	movabs $0xffffffffffff90f2,%r8
+  800dad:	ff ff ff 
+  800db0:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800db4:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800db7:	e9 53 03 00 00       	jmp    80110f <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800dbc:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800dc0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800dc4:	4c 89 e9             	mov    %r13,%rcx
+  800dc7:	48 ba d9 e5 ff ff ff 	movabs $0xffffffffffffe5d9,%rdx
+  800dce:	ff ff ff 
+  800dd1:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800dd5:	48 89 c7             	mov    %rax,%rdi
+  800dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ddd:	49 b8 f2 90 ff ff ff 	movabs $0xffffffffffff90f2,%r8
+  800de4:	ff ff ff 
+  800de7:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800deb:	41 ff d0             	call   *%r8
+			break;
+  800dee:	e9 1c 03 00 00       	jmp    80110f <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800df3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800df6:	83 f8 2f             	cmp    $0x2f,%eax
+  800df9:	77 17                	ja     800e12 <vprintfmt+0x2f7>
+  800dfb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dff:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e02:	89 d2                	mov    %edx,%edx
+  800e04:	48 01 d0             	add    %rdx,%rax
+  800e07:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e0a:	83 c2 08             	add    $0x8,%edx
+  800e0d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e10:	eb 0c                	jmp    800e1e <vprintfmt+0x303>
+  800e12:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e16:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e1a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e1e:	4c 8b 28             	mov    (%rax),%r13
+  800e21:	4d 85 ed             	test   %r13,%r13
+  800e24:	75 0e                	jne    800e34 <vprintfmt+0x319>
+				p = "(null)";
+  800e26:	48 b8 dc e5 ff ff ff 	movabs $0xffffffffffffe5dc,%rax
+  800e2d:	ff ff ff 
+  800e30:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800e34:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e38:	0f 8e 84 00 00 00    	jle    800ec2 <vprintfmt+0x3a7>
+  800e3e:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800e42:	74 7e                	je     800ec2 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e44:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800e47:	48 98                	cltq
+  800e49:	48 89 c6             	mov    %rax,%rsi
+  800e4c:	4c 89 ef             	mov    %r13,%rdi
+  800e4f:	4d 89 e7             	mov    %r12,%r15
+  800e52:	48 b8 17 94 ff ff ff 	movabs $0xffffffffffff9417,%rax
+  800e59:	ff ff ff 
+  800e5c:	4c 01 e0             	add    %r12,%rax
+  800e5f:	ff d0                	call   *%rax
+  800e61:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800e64:	eb 17                	jmp    800e7d <vprintfmt+0x362>
+					putch(padc, putdat);
+  800e66:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800e6a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800e6e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800e72:	48 89 d6             	mov    %rdx,%rsi
+  800e75:	89 c7                	mov    %eax,%edi
+  800e77:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e79:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e7d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e81:	7f e3                	jg     800e66 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e83:	eb 3d                	jmp    800ec2 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800e85:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800e89:	74 1e                	je     800ea9 <vprintfmt+0x38e>
+  800e8b:	83 fb 1f             	cmp    $0x1f,%ebx
+  800e8e:	7e 05                	jle    800e95 <vprintfmt+0x37a>
+  800e90:	83 fb 7e             	cmp    $0x7e,%ebx
+  800e93:	7e 14                	jle    800ea9 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800e95:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e99:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e9d:	48 89 c6             	mov    %rax,%rsi
+  800ea0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ea5:	ff d2                	call   *%rdx
+  800ea7:	eb 15                	jmp    800ebe <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800ea9:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800eac:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800eaf:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800eb3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800eb7:	48 89 c6             	mov    %rax,%rsi
+  800eba:	89 cf                	mov    %ecx,%edi
+  800ebc:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ebe:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ec2:	4c 89 e8             	mov    %r13,%rax
+  800ec5:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800ec9:	0f b6 00             	movzbl (%rax),%eax
+  800ecc:	0f be d8             	movsbl %al,%ebx
+  800ecf:	85 db                	test   %ebx,%ebx
+  800ed1:	74 28                	je     800efb <vprintfmt+0x3e0>
+  800ed3:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800ed7:	78 ac                	js     800e85 <vprintfmt+0x36a>
+  800ed9:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800edd:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800ee1:	79 a2                	jns    800e85 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800ee3:	eb 16                	jmp    800efb <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800ee5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ee9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800eed:	48 89 c6             	mov    %rax,%rsi
+  800ef0:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ef5:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800ef7:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800efb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800eff:	7f e4                	jg     800ee5 <vprintfmt+0x3ca>
+			break;
+  800f01:	e9 09 02 00 00       	jmp    80110f <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800f06:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f0a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f0e:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f12:	0f b6 00             	movzbl (%rax),%eax
+  800f15:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800f18:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800f19:	83 fb 2f             	cmp    $0x2f,%ebx
+  800f1c:	0f 8e ac fd ff ff    	jle    800cce <vprintfmt+0x1b3>
+  800f22:	e9 97 fd ff ff       	jmp    800cbe <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800f27:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f2b:	be 03 00 00 00       	mov    $0x3,%esi
+  800f30:	48 89 c7             	mov    %rax,%rdi
+  800f33:	48 b8 d0 89 ff ff ff 	movabs $0xffffffffffff89d0,%rax
+  800f3a:	ff ff ff 
+  800f3d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f41:	ff d0                	call   *%rax
+  800f43:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800f47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f4b:	48 85 c0             	test   %rax,%rax
+  800f4e:	79 1d                	jns    800f6d <vprintfmt+0x452>
+				putch('-', putdat);
+  800f50:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f54:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f58:	48 89 c6             	mov    %rax,%rsi
+  800f5b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800f60:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800f62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f66:	48 f7 d8             	neg    %rax
+  800f69:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800f6d:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800f74:	e9 de 00 00 00       	jmp    801057 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800f79:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f7d:	be 03 00 00 00       	mov    $0x3,%esi
+  800f82:	48 89 c7             	mov    %rax,%rdi
+  800f85:	48 b8 6f 88 ff ff ff 	movabs $0xffffffffffff886f,%rax
+  800f8c:	ff ff ff 
+  800f8f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f93:	ff d0                	call   *%rax
+  800f95:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800f99:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800fa0:	e9 b2 00 00 00       	jmp    801057 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800fa5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fa9:	be 03 00 00 00       	mov    $0x3,%esi
+  800fae:	48 89 c7             	mov    %rax,%rdi
+  800fb1:	48 b8 6f 88 ff ff ff 	movabs $0xffffffffffff886f,%rax
+  800fb8:	ff ff ff 
+  800fbb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fbf:	ff d0                	call   *%rax
+  800fc1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800fc5:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800fcc:	e9 86 00 00 00       	jmp    801057 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800fd1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fd5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fd9:	48 89 c6             	mov    %rax,%rsi
+  800fdc:	bf 30 00 00 00       	mov    $0x30,%edi
+  800fe1:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800fe3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fe7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800feb:	48 89 c6             	mov    %rax,%rsi
+  800fee:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ff3:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800ff5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ff8:	83 f8 2f             	cmp    $0x2f,%eax
+  800ffb:	77 17                	ja     801014 <vprintfmt+0x4f9>
+  800ffd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801001:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801004:	89 d2                	mov    %edx,%edx
+  801006:	48 01 d0             	add    %rdx,%rax
+  801009:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80100c:	83 c2 08             	add    $0x8,%edx
+  80100f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801012:	eb 0c                	jmp    801020 <vprintfmt+0x505>
+  801014:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801018:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80101c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801020:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801023:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801027:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  80102e:	eb 27                	jmp    801057 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801030:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801034:	be 03 00 00 00       	mov    $0x3,%esi
+  801039:	48 89 c7             	mov    %rax,%rdi
+  80103c:	48 b8 6f 88 ff ff ff 	movabs $0xffffffffffff886f,%rax
+  801043:	ff ff ff 
+  801046:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80104a:	ff d0                	call   *%rax
+  80104c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801050:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801057:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  80105c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80105f:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801062:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801066:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80106a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80106e:	45 89 c1             	mov    %r8d,%r9d
+  801071:	41 89 f8             	mov    %edi,%r8d
+  801074:	48 89 c7             	mov    %rax,%rdi
+  801077:	48 b8 97 87 ff ff ff 	movabs $0xffffffffffff8797,%rax
+  80107e:	ff ff ff 
+  801081:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801085:	ff d0                	call   *%rax
+			break;
+  801087:	e9 83 00 00 00       	jmp    80110f <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80108c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801090:	be 03 00 00 00       	mov    $0x3,%esi
+  801095:	48 89 c7             	mov    %rax,%rdi
+  801098:	48 b8 6f 88 ff ff ff 	movabs $0xffffffffffff886f,%rax
+  80109f:	ff ff ff 
+  8010a2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010a6:	ff d0                	call   *%rax
+  8010a8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8010ac:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010b0:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8010b4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010b8:	48 89 ce             	mov    %rcx,%rsi
+  8010bb:	48 89 c7             	mov    %rax,%rdi
+  8010be:	48 b8 8a 89 ff ff ff 	movabs $0xffffffffffff898a,%rax
+  8010c5:	ff ff ff 
+  8010c8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010cc:	ff d0                	call   *%rax
+	
+			break;
+  8010ce:	eb 3f                	jmp    80110f <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8010d0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010d4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010d8:	48 89 c6             	mov    %rax,%rsi
+  8010db:	89 df                	mov    %ebx,%edi
+  8010dd:	ff d2                	call   *%rdx
+			break;
+  8010df:	eb 2e                	jmp    80110f <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8010e1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010e5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010e9:	48 89 c6             	mov    %rax,%rsi
+  8010ec:	bf 25 00 00 00       	mov    $0x25,%edi
+  8010f1:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8010f3:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8010f8:	eb 05                	jmp    8010ff <vprintfmt+0x5e4>
+  8010fa:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8010ff:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801103:	48 83 e8 01          	sub    $0x1,%rax
+  801107:	0f b6 00             	movzbl (%rax),%eax
+  80110a:	3c 25                	cmp    $0x25,%al
+  80110c:	75 ec                	jne    8010fa <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  80110e:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80110f:	e9 78 fa ff ff       	jmp    800b8c <vprintfmt+0x71>
+				return;
+  801114:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801115:	48 83 c4 60          	add    $0x60,%rsp
+  801119:	5b                   	pop    %rbx
+  80111a:	41 5c                	pop    %r12
+  80111c:	41 5d                	pop    %r13
+  80111e:	41 5f                	pop    %r15
+  801120:	5d                   	pop    %rbp
+  801121:	c3                   	ret
+
+0000000000801122 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801122:	55                   	push   %rbp
+  801123:	48 89 e5             	mov    %rsp,%rbp
+  801126:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80112d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80112d <printfmt+0xb>
+  801134:	49 bb 03 6f 00 00 00 	movabs $0x6f03,%r11
+  80113b:	00 00 00 
+  80113e:	4d 01 da             	add    %r11,%r10
+  801141:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801148:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80114f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801156:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80115d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801164:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80116b:	84 c0                	test   %al,%al
+  80116d:	74 20                	je     80118f <printfmt+0x6d>
+  80116f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801173:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801177:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80117b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80117f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801183:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801187:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80118b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80118f:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801196:	00 00 00 
+  801199:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8011a0:	00 00 00 
+  8011a3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011a7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8011ae:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8011b5:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8011bc:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8011c3:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8011ca:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8011d1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8011d8:	48 89 c7             	mov    %rax,%rdi
+  8011db:	48 b8 eb 8a ff ff ff 	movabs $0xffffffffffff8aeb,%rax
+  8011e2:	ff ff ff 
+  8011e5:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8011e9:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8011eb:	90                   	nop
+  8011ec:	c9                   	leave
+  8011ed:	c3                   	ret
+
+00000000008011ee <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8011ee:	55                   	push   %rbp
+  8011ef:	48 89 e5             	mov    %rsp,%rbp
+  8011f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8011f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011f6 <sprintputch+0x8>
+  8011fd:	49 bb 3a 6e 00 00 00 	movabs $0x6e3a,%r11
+  801204:	00 00 00 
+  801207:	4c 01 d8             	add    %r11,%rax
+  80120a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80120d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801211:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801215:	8b 40 10             	mov    0x10(%rax),%eax
+  801218:	8d 50 01             	lea    0x1(%rax),%edx
+  80121b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80121f:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801222:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801226:	48 8b 10             	mov    (%rax),%rdx
+  801229:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80122d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801231:	48 39 c2             	cmp    %rax,%rdx
+  801234:	73 17                	jae    80124d <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801236:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80123a:	48 8b 00             	mov    (%rax),%rax
+  80123d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801241:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801245:	48 89 0a             	mov    %rcx,(%rdx)
+  801248:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80124b:	88 10                	mov    %dl,(%rax)
+}
+  80124d:	90                   	nop
+  80124e:	c9                   	leave
+  80124f:	c3                   	ret
+
+0000000000801250 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801250:	55                   	push   %rbp
+  801251:	48 89 e5             	mov    %rsp,%rbp
+  801254:	53                   	push   %rbx
+  801255:	48 83 ec 58          	sub    $0x58,%rsp
+  801259:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801259 <vsnprintf+0x9>
+  801260:	49 bb d7 6d 00 00 00 	movabs $0x6dd7,%r11
+  801267:	00 00 00 
+  80126a:	4c 01 d8             	add    %r11,%rax
+  80126d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801271:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801274:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801278:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80127c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801280:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801284:	48 8b 0e             	mov    (%rsi),%rcx
+  801287:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80128b:	48 89 0a             	mov    %rcx,(%rdx)
+  80128e:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801292:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801296:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80129a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80129e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8012a2:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8012a5:	48 63 d2             	movslq %edx,%rdx
+  8012a8:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8012ac:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8012b0:	48 01 ca             	add    %rcx,%rdx
+  8012b3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8012b7:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8012be:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8012c3:	74 06                	je     8012cb <vsnprintf+0x7b>
+  8012c5:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8012c9:	7f 07                	jg     8012d2 <vsnprintf+0x82>
+		return -E_INVAL;
+  8012cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012d0:	eb 34                	jmp    801306 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8012d2:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8012d6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8012da:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8012de:	48 bf be 91 ff ff ff 	movabs $0xffffffffffff91be,%rdi
+  8012e5:	ff ff ff 
+  8012e8:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8012ec:	49 b8 eb 8a ff ff ff 	movabs $0xffffffffffff8aeb,%r8
+  8012f3:	ff ff ff 
+  8012f6:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8012fa:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8012fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801300:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801303:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801306:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130a:	c9                   	leave
+  80130b:	c3                   	ret
+
+000000000080130c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80130c:	55                   	push   %rbp
+  80130d:	48 89 e5             	mov    %rsp,%rbp
+  801310:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801317:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801317 <snprintf+0xb>
+  80131e:	49 bb 19 6d 00 00 00 	movabs $0x6d19,%r11
+  801325:	00 00 00 
+  801328:	4d 01 da             	add    %r11,%r10
+  80132b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801332:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801338:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80133f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801346:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80134d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801354:	84 c0                	test   %al,%al
+  801356:	74 20                	je     801378 <snprintf+0x6c>
+  801358:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80135c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801360:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801364:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801368:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80136c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801370:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801374:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801378:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80137f:	00 00 00 
+  801382:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801389:	00 00 00 
+  80138c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801390:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801397:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80139e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8013a5:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8013ac:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8013b3:	48 8b 06             	mov    (%rsi),%rax
+  8013b6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013ba:	48 89 01             	mov    %rax,(%rcx)
+  8013bd:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8013c1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8013c5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8013c9:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8013d0:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8013d7:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8013dd:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8013e4:	48 89 c7             	mov    %rax,%rdi
+  8013e7:	48 b8 20 92 ff ff ff 	movabs $0xffffffffffff9220,%rax
+  8013ee:	ff ff ff 
+  8013f1:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8013f5:	ff d0                	call   *%rax
+  8013f7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8013fd:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801403:	c9                   	leave
+  801404:	c3                   	ret
+
+0000000000801405 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801405:	55                   	push   %rbp
+  801406:	48 89 e5             	mov    %rsp,%rbp
+  801409:	48 83 ec 18          	sub    $0x18,%rsp
+  80140d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80140d <strlen+0x8>
+  801414:	49 bb 23 6c 00 00 00 	movabs $0x6c23,%r11
+  80141b:	00 00 00 
+  80141e:	4c 01 d8             	add    %r11,%rax
+  801421:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801425:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80142c:	eb 09                	jmp    801437 <strlen+0x32>
+		n++;
+  80142e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801432:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801437:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143b:	0f b6 00             	movzbl (%rax),%eax
+  80143e:	84 c0                	test   %al,%al
+  801440:	75 ec                	jne    80142e <strlen+0x29>
+	return n;
+  801442:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801445:	c9                   	leave
+  801446:	c3                   	ret
+
+0000000000801447 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801447:	55                   	push   %rbp
+  801448:	48 89 e5             	mov    %rsp,%rbp
+  80144b:	48 83 ec 20          	sub    $0x20,%rsp
+  80144f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80144f <strnlen+0x8>
+  801456:	49 bb e1 6b 00 00 00 	movabs $0x6be1,%r11
+  80145d:	00 00 00 
+  801460:	4c 01 d8             	add    %r11,%rax
+  801463:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801467:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80146b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801472:	eb 0e                	jmp    801482 <strnlen+0x3b>
+		n++;
+  801474:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801478:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80147d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801482:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801487:	74 0b                	je     801494 <strnlen+0x4d>
+  801489:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80148d:	0f b6 00             	movzbl (%rax),%eax
+  801490:	84 c0                	test   %al,%al
+  801492:	75 e0                	jne    801474 <strnlen+0x2d>
+	return n;
+  801494:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801497:	c9                   	leave
+  801498:	c3                   	ret
+
+0000000000801499 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801499:	55                   	push   %rbp
+  80149a:	48 89 e5             	mov    %rsp,%rbp
+  80149d:	48 83 ec 20          	sub    $0x20,%rsp
+  8014a1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014a1 <strcpy+0x8>
+  8014a8:	49 bb 8f 6b 00 00 00 	movabs $0x6b8f,%r11
+  8014af:	00 00 00 
+  8014b2:	4c 01 d8             	add    %r11,%rax
+  8014b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8014bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8014c5:	90                   	nop
+  8014c6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014ca:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014ce:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8014da:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014de:	0f b6 12             	movzbl (%rdx),%edx
+  8014e1:	88 10                	mov    %dl,(%rax)
+  8014e3:	0f b6 00             	movzbl (%rax),%eax
+  8014e6:	84 c0                	test   %al,%al
+  8014e8:	75 dc                	jne    8014c6 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8014ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8014ee:	c9                   	leave
+  8014ef:	c3                   	ret
+
+00000000008014f0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8014f0:	55                   	push   %rbp
+  8014f1:	48 89 e5             	mov    %rsp,%rbp
+  8014f4:	53                   	push   %rbx
+  8014f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8014f9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8014f9 <strcat+0x9>
+  801500:	49 bb 37 6b 00 00 00 	movabs $0x6b37,%r11
+  801507:	00 00 00 
+  80150a:	4c 01 db             	add    %r11,%rbx
+  80150d:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801511:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801515:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801519:	48 89 c7             	mov    %rax,%rdi
+  80151c:	48 b8 d5 93 ff ff ff 	movabs $0xffffffffffff93d5,%rax
+  801523:	ff ff ff 
+  801526:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80152a:	ff d0                	call   *%rax
+  80152c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  80152f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801532:	48 63 d0             	movslq %eax,%rdx
+  801535:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801539:	48 01 c2             	add    %rax,%rdx
+  80153c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801540:	48 89 c6             	mov    %rax,%rsi
+  801543:	48 89 d7             	mov    %rdx,%rdi
+  801546:	48 b8 69 94 ff ff ff 	movabs $0xffffffffffff9469,%rax
+  80154d:	ff ff ff 
+  801550:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801554:	ff d0                	call   *%rax
+	return dst;
+  801556:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  80155a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155e:	c9                   	leave
+  80155f:	c3                   	ret
+
+0000000000801560 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801560:	55                   	push   %rbp
+  801561:	48 89 e5             	mov    %rsp,%rbp
+  801564:	48 83 ec 28          	sub    $0x28,%rsp
+  801568:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801568 <strncpy+0x8>
+  80156f:	49 bb c8 6a 00 00 00 	movabs $0x6ac8,%r11
+  801576:	00 00 00 
+  801579:	4c 01 d8             	add    %r11,%rax
+  80157c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801580:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801584:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801588:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80158c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801590:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801597:	00 
+  801598:	eb 2a                	jmp    8015c4 <strncpy+0x64>
+		*dst++ = *src;
+  80159a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80159e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015a2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8015a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015aa:	0f b6 12             	movzbl (%rdx),%edx
+  8015ad:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8015af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b3:	0f b6 00             	movzbl (%rax),%eax
+  8015b6:	84 c0                	test   %al,%al
+  8015b8:	74 05                	je     8015bf <strncpy+0x5f>
+			src++;
+  8015ba:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8015bf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8015cc:	72 cc                	jb     80159a <strncpy+0x3a>
+	}
+	return ret;
+  8015ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8015d2:	c9                   	leave
+  8015d3:	c3                   	ret
+
+00000000008015d4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8015d4:	55                   	push   %rbp
+  8015d5:	48 89 e5             	mov    %rsp,%rbp
+  8015d8:	48 83 ec 28          	sub    $0x28,%rsp
+  8015dc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015dc <strlcpy+0x8>
+  8015e3:	49 bb 54 6a 00 00 00 	movabs $0x6a54,%r11
+  8015ea:	00 00 00 
+  8015ed:	4c 01 d8             	add    %r11,%rax
+  8015f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015f4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015f8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8015fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801600:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801604:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801609:	74 3d                	je     801648 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  80160b:	eb 1d                	jmp    80162a <strlcpy+0x56>
+			*dst++ = *src++;
+  80160d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801611:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801615:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801619:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80161d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801621:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801625:	0f b6 12             	movzbl (%rdx),%edx
+  801628:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80162a:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80162f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801634:	74 0b                	je     801641 <strlcpy+0x6d>
+  801636:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80163a:	0f b6 00             	movzbl (%rax),%eax
+  80163d:	84 c0                	test   %al,%al
+  80163f:	75 cc                	jne    80160d <strlcpy+0x39>
+		*dst = '\0';
+  801641:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801645:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80164c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801650:	c9                   	leave
+  801651:	c3                   	ret
+
+0000000000801652 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801652:	55                   	push   %rbp
+  801653:	48 89 e5             	mov    %rsp,%rbp
+  801656:	48 83 ec 10          	sub    $0x10,%rsp
+  80165a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80165a <strcmp+0x8>
+  801661:	49 bb d6 69 00 00 00 	movabs $0x69d6,%r11
+  801668:	00 00 00 
+  80166b:	4c 01 d8             	add    %r11,%rax
+  80166e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801672:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801676:	eb 0a                	jmp    801682 <strcmp+0x30>
+		p++, q++;
+  801678:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80167d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801682:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801686:	0f b6 00             	movzbl (%rax),%eax
+  801689:	84 c0                	test   %al,%al
+  80168b:	74 12                	je     80169f <strcmp+0x4d>
+  80168d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801691:	0f b6 10             	movzbl (%rax),%edx
+  801694:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801698:	0f b6 00             	movzbl (%rax),%eax
+  80169b:	38 c2                	cmp    %al,%dl
+  80169d:	74 d9                	je     801678 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80169f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a3:	0f b6 00             	movzbl (%rax),%eax
+  8016a6:	0f b6 d0             	movzbl %al,%edx
+  8016a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016ad:	0f b6 00             	movzbl (%rax),%eax
+  8016b0:	0f b6 c0             	movzbl %al,%eax
+  8016b3:	29 c2                	sub    %eax,%edx
+  8016b5:	89 d0                	mov    %edx,%eax
+}
+  8016b7:	c9                   	leave
+  8016b8:	c3                   	ret
+
+00000000008016b9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8016b9:	55                   	push   %rbp
+  8016ba:	48 89 e5             	mov    %rsp,%rbp
+  8016bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8016c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016c1 <strncmp+0x8>
+  8016c8:	49 bb 6f 69 00 00 00 	movabs $0x696f,%r11
+  8016cf:	00 00 00 
+  8016d2:	4c 01 d8             	add    %r11,%rax
+  8016d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016dd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8016e1:	eb 0f                	jmp    8016f2 <strncmp+0x39>
+		n--, p++, q++;
+  8016e3:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8016e8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016ed:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8016f2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016f7:	74 1d                	je     801716 <strncmp+0x5d>
+  8016f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016fd:	0f b6 00             	movzbl (%rax),%eax
+  801700:	84 c0                	test   %al,%al
+  801702:	74 12                	je     801716 <strncmp+0x5d>
+  801704:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801708:	0f b6 10             	movzbl (%rax),%edx
+  80170b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80170f:	0f b6 00             	movzbl (%rax),%eax
+  801712:	38 c2                	cmp    %al,%dl
+  801714:	74 cd                	je     8016e3 <strncmp+0x2a>
+	if (n == 0)
+  801716:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80171b:	75 07                	jne    801724 <strncmp+0x6b>
+		return 0;
+  80171d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801722:	eb 16                	jmp    80173a <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801724:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801728:	0f b6 00             	movzbl (%rax),%eax
+  80172b:	0f b6 d0             	movzbl %al,%edx
+  80172e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801732:	0f b6 00             	movzbl (%rax),%eax
+  801735:	0f b6 c0             	movzbl %al,%eax
+  801738:	29 c2                	sub    %eax,%edx
+}
+  80173a:	89 d0                	mov    %edx,%eax
+  80173c:	c9                   	leave
+  80173d:	c3                   	ret
+
+000000000080173e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80173e:	55                   	push   %rbp
+  80173f:	48 89 e5             	mov    %rsp,%rbp
+  801742:	48 83 ec 10          	sub    $0x10,%rsp
+  801746:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801746 <strchr+0x8>
+  80174d:	49 bb ea 68 00 00 00 	movabs $0x68ea,%r11
+  801754:	00 00 00 
+  801757:	4c 01 d8             	add    %r11,%rax
+  80175a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80175e:	89 f0                	mov    %esi,%eax
+  801760:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801763:	eb 17                	jmp    80177c <strchr+0x3e>
+		if (*s == c)
+  801765:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801769:	0f b6 00             	movzbl (%rax),%eax
+  80176c:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80176f:	75 06                	jne    801777 <strchr+0x39>
+			return (char *) s;
+  801771:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801775:	eb 15                	jmp    80178c <strchr+0x4e>
+	for (; *s; s++)
+  801777:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80177c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801780:	0f b6 00             	movzbl (%rax),%eax
+  801783:	84 c0                	test   %al,%al
+  801785:	75 de                	jne    801765 <strchr+0x27>
+	return 0;
+  801787:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80178c:	c9                   	leave
+  80178d:	c3                   	ret
+
+000000000080178e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80178e:	55                   	push   %rbp
+  80178f:	48 89 e5             	mov    %rsp,%rbp
+  801792:	48 83 ec 10          	sub    $0x10,%rsp
+  801796:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801796 <strfind+0x8>
+  80179d:	49 bb 9a 68 00 00 00 	movabs $0x689a,%r11
+  8017a4:	00 00 00 
+  8017a7:	4c 01 d8             	add    %r11,%rax
+  8017aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017ae:	89 f0                	mov    %esi,%eax
+  8017b0:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8017b3:	eb 11                	jmp    8017c6 <strfind+0x38>
+		if (*s == c)
+  8017b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b9:	0f b6 00             	movzbl (%rax),%eax
+  8017bc:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8017bf:	74 12                	je     8017d3 <strfind+0x45>
+	for (; *s; s++)
+  8017c1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ca:	0f b6 00             	movzbl (%rax),%eax
+  8017cd:	84 c0                	test   %al,%al
+  8017cf:	75 e4                	jne    8017b5 <strfind+0x27>
+  8017d1:	eb 01                	jmp    8017d4 <strfind+0x46>
+			break;
+  8017d3:	90                   	nop
+	return (char *) s;
+  8017d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017d8:	c9                   	leave
+  8017d9:	c3                   	ret
+
+00000000008017da <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8017da:	55                   	push   %rbp
+  8017db:	48 89 e5             	mov    %rsp,%rbp
+  8017de:	48 83 ec 18          	sub    $0x18,%rsp
+  8017e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e2 <memset+0x8>
+  8017e9:	49 bb 4e 68 00 00 00 	movabs $0x684e,%r11
+  8017f0:	00 00 00 
+  8017f3:	4c 01 d8             	add    %r11,%rax
+  8017f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017fa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8017fd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801801:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801806:	75 06                	jne    80180e <memset+0x34>
+		return v;
+  801808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180c:	eb 69                	jmp    801877 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  80180e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801812:	83 e0 03             	and    $0x3,%eax
+  801815:	48 85 c0             	test   %rax,%rax
+  801818:	75 48                	jne    801862 <memset+0x88>
+  80181a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80181e:	83 e0 03             	and    $0x3,%eax
+  801821:	48 85 c0             	test   %rax,%rax
+  801824:	75 3c                	jne    801862 <memset+0x88>
+		c &= 0xFF;
+  801826:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  80182d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801830:	c1 e0 18             	shl    $0x18,%eax
+  801833:	89 c2                	mov    %eax,%edx
+  801835:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801838:	c1 e0 10             	shl    $0x10,%eax
+  80183b:	09 c2                	or     %eax,%edx
+  80183d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801840:	c1 e0 08             	shl    $0x8,%eax
+  801843:	09 d0                	or     %edx,%eax
+  801845:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801848:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80184c:	48 c1 e8 02          	shr    $0x2,%rax
+  801850:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801853:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801857:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80185a:	48 89 d7             	mov    %rdx,%rdi
+  80185d:	fc                   	cld
+  80185e:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801860:	eb 11                	jmp    801873 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801862:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801866:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801869:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80186d:	48 89 d7             	mov    %rdx,%rdi
+  801870:	fc                   	cld
+  801871:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801873:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801877:	c9                   	leave
+  801878:	c3                   	ret
+
+0000000000801879 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801879:	55                   	push   %rbp
+  80187a:	48 89 e5             	mov    %rsp,%rbp
+  80187d:	48 83 ec 28          	sub    $0x28,%rsp
+  801881:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801881 <memmove+0x8>
+  801888:	49 bb af 67 00 00 00 	movabs $0x67af,%r11
+  80188f:	00 00 00 
+  801892:	4c 01 d8             	add    %r11,%rax
+  801895:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801899:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80189d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8018a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018a5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8018a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018ad:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8018b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018b5:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8018b9:	0f 83 88 00 00 00    	jae    801947 <memmove+0xce>
+  8018bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c7:	48 01 d0             	add    %rdx,%rax
+  8018ca:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8018ce:	73 77                	jae    801947 <memmove+0xce>
+		s += n;
+  8018d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8018d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018dc:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8018e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e4:	83 e0 03             	and    $0x3,%eax
+  8018e7:	48 85 c0             	test   %rax,%rax
+  8018ea:	75 3b                	jne    801927 <memmove+0xae>
+  8018ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f0:	83 e0 03             	and    $0x3,%eax
+  8018f3:	48 85 c0             	test   %rax,%rax
+  8018f6:	75 2f                	jne    801927 <memmove+0xae>
+  8018f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018fc:	83 e0 03             	and    $0x3,%eax
+  8018ff:	48 85 c0             	test   %rax,%rax
+  801902:	75 23                	jne    801927 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801904:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801908:	48 83 e8 04          	sub    $0x4,%rax
+  80190c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801910:	48 83 ea 04          	sub    $0x4,%rdx
+  801914:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801918:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80191c:	48 89 c7             	mov    %rax,%rdi
+  80191f:	48 89 d6             	mov    %rdx,%rsi
+  801922:	fd                   	std
+  801923:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801925:	eb 1d                	jmp    801944 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801927:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80192b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80192f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801933:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801937:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80193b:	48 89 d7             	mov    %rdx,%rdi
+  80193e:	48 89 c1             	mov    %rax,%rcx
+  801941:	fd                   	std
+  801942:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801944:	fc                   	cld
+  801945:	eb 57                	jmp    80199e <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801947:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80194b:	83 e0 03             	and    $0x3,%eax
+  80194e:	48 85 c0             	test   %rax,%rax
+  801951:	75 36                	jne    801989 <memmove+0x110>
+  801953:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801957:	83 e0 03             	and    $0x3,%eax
+  80195a:	48 85 c0             	test   %rax,%rax
+  80195d:	75 2a                	jne    801989 <memmove+0x110>
+  80195f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801963:	83 e0 03             	and    $0x3,%eax
+  801966:	48 85 c0             	test   %rax,%rax
+  801969:	75 1e                	jne    801989 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80196b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80196f:	48 c1 e8 02          	shr    $0x2,%rax
+  801973:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801976:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80197a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80197e:	48 89 c7             	mov    %rax,%rdi
+  801981:	48 89 d6             	mov    %rdx,%rsi
+  801984:	fc                   	cld
+  801985:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801987:	eb 15                	jmp    80199e <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801989:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80198d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801991:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801995:	48 89 c7             	mov    %rax,%rdi
+  801998:	48 89 d6             	mov    %rdx,%rsi
+  80199b:	fc                   	cld
+  80199c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  80199e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019a2:	c9                   	leave
+  8019a3:	c3                   	ret
+
+00000000008019a4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8019a4:	55                   	push   %rbp
+  8019a5:	48 89 e5             	mov    %rsp,%rbp
+  8019a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8019ac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019ac <memcpy+0x8>
+  8019b3:	49 bb 84 66 00 00 00 	movabs $0x6684,%r11
+  8019ba:	00 00 00 
+  8019bd:	4c 01 d8             	add    %r11,%rax
+  8019c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8019c8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8019cc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019d0:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8019d4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8019d8:	48 89 cf             	mov    %rcx,%rdi
+  8019db:	48 b9 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rcx
+  8019e2:	ff ff ff 
+  8019e5:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8019e9:	ff d0                	call   *%rax
+}
+  8019eb:	c9                   	leave
+  8019ec:	c3                   	ret
+
+00000000008019ed <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8019ed:	55                   	push   %rbp
+  8019ee:	48 89 e5             	mov    %rsp,%rbp
+  8019f1:	48 83 ec 28          	sub    $0x28,%rsp
+  8019f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019f5 <memcmp+0x8>
+  8019fc:	49 bb 3b 66 00 00 00 	movabs $0x663b,%r11
+  801a03:	00 00 00 
+  801a06:	4c 01 d8             	add    %r11,%rax
+  801a09:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a0d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a11:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801a15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a19:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801a1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a21:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801a25:	eb 34                	jmp    801a5b <memcmp+0x6e>
+		if (*s1 != *s2)
+  801a27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a2b:	0f b6 10             	movzbl (%rax),%edx
+  801a2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a32:	0f b6 00             	movzbl (%rax),%eax
+  801a35:	38 c2                	cmp    %al,%dl
+  801a37:	74 18                	je     801a51 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801a39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a3d:	0f b6 00             	movzbl (%rax),%eax
+  801a40:	0f b6 d0             	movzbl %al,%edx
+  801a43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a47:	0f b6 00             	movzbl (%rax),%eax
+  801a4a:	0f b6 c0             	movzbl %al,%eax
+  801a4d:	29 c2                	sub    %eax,%edx
+  801a4f:	eb 20                	jmp    801a71 <memcmp+0x84>
+		s1++, s2++;
+  801a51:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a56:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801a5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a5f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a63:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801a67:	48 85 c0             	test   %rax,%rax
+  801a6a:	75 bb                	jne    801a27 <memcmp+0x3a>
+	}
+
+	return 0;
+  801a6c:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801a71:	89 d0                	mov    %edx,%eax
+  801a73:	c9                   	leave
+  801a74:	c3                   	ret
+
+0000000000801a75 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801a75:	55                   	push   %rbp
+  801a76:	48 89 e5             	mov    %rsp,%rbp
+  801a79:	48 83 ec 28          	sub    $0x28,%rsp
+  801a7d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a7d <memfind+0x8>
+  801a84:	49 bb b3 65 00 00 00 	movabs $0x65b3,%r11
+  801a8b:	00 00 00 
+  801a8e:	4c 01 d8             	add    %r11,%rax
+  801a91:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a95:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801a98:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801a9c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801aa0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa4:	48 01 d0             	add    %rdx,%rax
+  801aa7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801aab:	eb 13                	jmp    801ac0 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801aad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ab1:	0f b6 00             	movzbl (%rax),%eax
+  801ab4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801ab7:	38 d0                	cmp    %dl,%al
+  801ab9:	74 11                	je     801acc <memfind+0x57>
+	for (; s < ends; s++)
+  801abb:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ac0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ac4:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801ac8:	72 e3                	jb     801aad <memfind+0x38>
+  801aca:	eb 01                	jmp    801acd <memfind+0x58>
+			break;
+  801acc:	90                   	nop
+	return (void *) s;
+  801acd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ad1:	c9                   	leave
+  801ad2:	c3                   	ret
+
+0000000000801ad3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801ad3:	55                   	push   %rbp
+  801ad4:	48 89 e5             	mov    %rsp,%rbp
+  801ad7:	48 83 ec 38          	sub    $0x38,%rsp
+  801adb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801adb <strtol+0x8>
+  801ae2:	49 bb 55 65 00 00 00 	movabs $0x6555,%r11
+  801ae9:	00 00 00 
+  801aec:	4c 01 d8             	add    %r11,%rax
+  801aef:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801af3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801af7:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801afa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b01:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b08:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801b09:	eb 05                	jmp    801b10 <strtol+0x3d>
+		s++;
+  801b0b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801b10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b14:	0f b6 00             	movzbl (%rax),%eax
+  801b17:	3c 20                	cmp    $0x20,%al
+  801b19:	74 f0                	je     801b0b <strtol+0x38>
+  801b1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b1f:	0f b6 00             	movzbl (%rax),%eax
+  801b22:	3c 09                	cmp    $0x9,%al
+  801b24:	74 e5                	je     801b0b <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801b26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b2a:	0f b6 00             	movzbl (%rax),%eax
+  801b2d:	3c 2b                	cmp    $0x2b,%al
+  801b2f:	75 07                	jne    801b38 <strtol+0x65>
+		s++;
+  801b31:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b36:	eb 17                	jmp    801b4f <strtol+0x7c>
+	else if (*s == '-')
+  801b38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b3c:	0f b6 00             	movzbl (%rax),%eax
+  801b3f:	3c 2d                	cmp    $0x2d,%al
+  801b41:	75 0c                	jne    801b4f <strtol+0x7c>
+		s++, neg = 1;
+  801b43:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b48:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801b4f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b53:	74 06                	je     801b5b <strtol+0x88>
+  801b55:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801b59:	75 28                	jne    801b83 <strtol+0xb0>
+  801b5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b5f:	0f b6 00             	movzbl (%rax),%eax
+  801b62:	3c 30                	cmp    $0x30,%al
+  801b64:	75 1d                	jne    801b83 <strtol+0xb0>
+  801b66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b6a:	48 83 c0 01          	add    $0x1,%rax
+  801b6e:	0f b6 00             	movzbl (%rax),%eax
+  801b71:	3c 78                	cmp    $0x78,%al
+  801b73:	75 0e                	jne    801b83 <strtol+0xb0>
+		s += 2, base = 16;
+  801b75:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801b7a:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801b81:	eb 2c                	jmp    801baf <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801b83:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b87:	75 19                	jne    801ba2 <strtol+0xcf>
+  801b89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b8d:	0f b6 00             	movzbl (%rax),%eax
+  801b90:	3c 30                	cmp    $0x30,%al
+  801b92:	75 0e                	jne    801ba2 <strtol+0xcf>
+		s++, base = 8;
+  801b94:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b99:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801ba0:	eb 0d                	jmp    801baf <strtol+0xdc>
+	else if (base == 0)
+  801ba2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ba6:	75 07                	jne    801baf <strtol+0xdc>
+		base = 10;
+  801ba8:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801baf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb3:	0f b6 00             	movzbl (%rax),%eax
+  801bb6:	3c 2f                	cmp    $0x2f,%al
+  801bb8:	7e 1d                	jle    801bd7 <strtol+0x104>
+  801bba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bbe:	0f b6 00             	movzbl (%rax),%eax
+  801bc1:	3c 39                	cmp    $0x39,%al
+  801bc3:	7f 12                	jg     801bd7 <strtol+0x104>
+			dig = *s - '0';
+  801bc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc9:	0f b6 00             	movzbl (%rax),%eax
+  801bcc:	0f be c0             	movsbl %al,%eax
+  801bcf:	83 e8 30             	sub    $0x30,%eax
+  801bd2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801bd5:	eb 4e                	jmp    801c25 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801bd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bdb:	0f b6 00             	movzbl (%rax),%eax
+  801bde:	3c 60                	cmp    $0x60,%al
+  801be0:	7e 1d                	jle    801bff <strtol+0x12c>
+  801be2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be6:	0f b6 00             	movzbl (%rax),%eax
+  801be9:	3c 7a                	cmp    $0x7a,%al
+  801beb:	7f 12                	jg     801bff <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801bed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bf1:	0f b6 00             	movzbl (%rax),%eax
+  801bf4:	0f be c0             	movsbl %al,%eax
+  801bf7:	83 e8 57             	sub    $0x57,%eax
+  801bfa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801bfd:	eb 26                	jmp    801c25 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801bff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c03:	0f b6 00             	movzbl (%rax),%eax
+  801c06:	3c 40                	cmp    $0x40,%al
+  801c08:	7e 47                	jle    801c51 <strtol+0x17e>
+  801c0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c0e:	0f b6 00             	movzbl (%rax),%eax
+  801c11:	3c 5a                	cmp    $0x5a,%al
+  801c13:	7f 3c                	jg     801c51 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801c15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c19:	0f b6 00             	movzbl (%rax),%eax
+  801c1c:	0f be c0             	movsbl %al,%eax
+  801c1f:	83 e8 37             	sub    $0x37,%eax
+  801c22:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801c25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c28:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801c2b:	7d 23                	jge    801c50 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801c2d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c32:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801c35:	48 98                	cltq
+  801c37:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801c3c:	48 89 c2             	mov    %rax,%rdx
+  801c3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c42:	48 98                	cltq
+  801c44:	48 01 d0             	add    %rdx,%rax
+  801c47:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801c4b:	e9 5f ff ff ff       	jmp    801baf <strtol+0xdc>
+			break;
+  801c50:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801c51:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801c56:	74 0b                	je     801c63 <strtol+0x190>
+		*endptr = (char *) s;
+  801c58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c5c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801c60:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801c63:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801c67:	74 09                	je     801c72 <strtol+0x19f>
+  801c69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c6d:	48 f7 d8             	neg    %rax
+  801c70:	eb 04                	jmp    801c76 <strtol+0x1a3>
+  801c72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801c76:	c9                   	leave
+  801c77:	c3                   	ret
+
+0000000000801c78 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801c78:	55                   	push   %rbp
+  801c79:	48 89 e5             	mov    %rsp,%rbp
+  801c7c:	53                   	push   %rbx
+  801c7d:	48 83 ec 30          	sub    $0x30,%rsp
+  801c81:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801c81 <strstr+0x9>
+  801c88:	49 bb af 63 00 00 00 	movabs $0x63af,%r11
+  801c8f:	00 00 00 
+  801c92:	4c 01 db             	add    %r11,%rbx
+  801c95:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801c99:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801c9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ca1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ca5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ca9:	0f b6 00             	movzbl (%rax),%eax
+  801cac:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801caf:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801cb3:	75 06                	jne    801cbb <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801cb5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cb9:	eb 73                	jmp    801d2e <strstr+0xb6>
+
+	len = strlen(str);
+  801cbb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cbf:	48 89 c7             	mov    %rax,%rdi
+  801cc2:	48 b8 d5 93 ff ff ff 	movabs $0xffffffffffff93d5,%rax
+  801cc9:	ff ff ff 
+  801ccc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801cd0:	ff d0                	call   *%rax
+  801cd2:	48 98                	cltq
+  801cd4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801cd8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cdc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ce0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ce4:	0f b6 00             	movzbl (%rax),%eax
+  801ce7:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801cea:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801cee:	75 07                	jne    801cf7 <strstr+0x7f>
+				return (char *) 0;
+  801cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf5:	eb 37                	jmp    801d2e <strstr+0xb6>
+		} while (sc != c);
+  801cf7:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801cfb:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801cfe:	75 d8                	jne    801cd8 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801d00:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d04:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d0c:	48 89 ce             	mov    %rcx,%rsi
+  801d0f:	48 89 c7             	mov    %rax,%rdi
+  801d12:	48 b8 89 96 ff ff ff 	movabs $0xffffffffffff9689,%rax
+  801d19:	ff ff ff 
+  801d1c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d20:	ff d0                	call   *%rax
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	75 b2                	jne    801cd8 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801d26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d2a:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801d2e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d32:	c9                   	leave
+  801d33:	c3                   	ret
+
+0000000000801d34 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801d34:	55                   	push   %rbp
+  801d35:	48 89 e5             	mov    %rsp,%rbp
+  801d38:	41 57                	push   %r15
+  801d3a:	53                   	push   %rbx
+  801d3b:	48 83 ec 40          	sub    $0x40,%rsp
+  801d3f:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801d3f <syscall+0xb>
+  801d46:	49 bb f1 62 00 00 00 	movabs $0x62f1,%r11
+  801d4d:	00 00 00 
+  801d50:	4d 01 da             	add    %r11,%r10
+  801d53:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801d56:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801d59:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d5d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801d61:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801d65:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801d69:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d6c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801d70:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d74:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801d78:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801d7c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d80:	4c 89 c3             	mov    %r8,%rbx
+  801d83:	cd 30                	int    $0x30
+  801d85:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801d89:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801d8d:	74 52                	je     801de1 <syscall+0xad>
+  801d8f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d94:	7e 4b                	jle    801de1 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d96:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d9a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d9d:	49 89 d0             	mov    %rdx,%r8
+  801da0:	89 c1                	mov    %eax,%ecx
+  801da2:	48 b8 98 e8 ff ff ff 	movabs $0xffffffffffffe898,%rax
+  801da9:	ff ff ff 
+  801dac:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801db0:	48 89 c2             	mov    %rax,%rdx
+  801db3:	be 23 00 00 00       	mov    $0x23,%esi
+  801db8:	48 b8 b5 e8 ff ff ff 	movabs $0xffffffffffffe8b5,%rax
+  801dbf:	ff ff ff 
+  801dc2:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801dc6:	48 89 c7             	mov    %rax,%rdi
+  801dc9:	4d 89 d7             	mov    %r10,%r15
+  801dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd1:	49 b9 d0 83 ff ff ff 	movabs $0xffffffffffff83d0,%r9
+  801dd8:	ff ff ff 
+  801ddb:	4d 01 d1             	add    %r10,%r9
+  801dde:	41 ff d1             	call   *%r9
+
+	return ret;
+  801de1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801de5:	48 83 c4 40          	add    $0x40,%rsp
+  801de9:	5b                   	pop    %rbx
+  801dea:	41 5f                	pop    %r15
+  801dec:	5d                   	pop    %rbp
+  801ded:	c3                   	ret
+
+0000000000801dee <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801dee:	55                   	push   %rbp
+  801def:	48 89 e5             	mov    %rsp,%rbp
+  801df2:	41 57                	push   %r15
+  801df4:	41 56                	push   %r14
+  801df6:	41 55                	push   %r13
+  801df8:	41 54                	push   %r12
+  801dfa:	53                   	push   %rbx
+  801dfb:	48 83 ec 48          	sub    $0x48,%rsp
+  801dff:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801dff <syscall_words+0x11>
+  801e06:	49 bb 31 62 00 00 00 	movabs $0x6231,%r11
+  801e0d:	00 00 00 
+  801e10:	4d 01 de             	add    %r11,%r14
+  801e13:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801e16:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801e19:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801e1d:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801e21:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801e25:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801e29:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e2e:	74 09                	je     801e39 <syscall_words+0x4b>
+  801e30:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e34:	48 8b 00             	mov    (%rax),%rax
+  801e37:	eb 05                	jmp    801e3e <syscall_words+0x50>
+  801e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3e:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801e41:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e46:	74 0a                	je     801e52 <syscall_words+0x64>
+  801e48:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e50:	eb 05                	jmp    801e57 <syscall_words+0x69>
+  801e52:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e57:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801e5a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e5f:	74 0a                	je     801e6b <syscall_words+0x7d>
+  801e61:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e65:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e69:	eb 05                	jmp    801e70 <syscall_words+0x82>
+  801e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e70:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801e73:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e78:	74 0a                	je     801e84 <syscall_words+0x96>
+  801e7a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e7e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e82:	eb 05                	jmp    801e89 <syscall_words+0x9b>
+  801e84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e89:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801e8c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e91:	74 0a                	je     801e9d <syscall_words+0xaf>
+  801e93:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e97:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e9b:	eb 05                	jmp    801ea2 <syscall_words+0xb4>
+  801e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea2:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801ea5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801eaa:	74 0a                	je     801eb6 <syscall_words+0xc8>
+  801eac:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801eb0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801eb4:	eb 05                	jmp    801ebb <syscall_words+0xcd>
+  801eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebb:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801ebe:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801ec1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801ec5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801ec9:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801ecd:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801ed1:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ed5:	cd 30                	int    $0x30
+  801ed7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801edb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ee0:	74 50                	je     801f32 <syscall_words+0x144>
+		words[0] = r8;
+  801ee2:	4c 89 c2             	mov    %r8,%rdx
+  801ee5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ee9:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801eec:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ef0:	48 83 c0 08          	add    $0x8,%rax
+  801ef4:	4c 89 ca             	mov    %r9,%rdx
+  801ef7:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801efa:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801efe:	48 83 c0 10          	add    $0x10,%rax
+  801f02:	4c 89 d2             	mov    %r10,%rdx
+  801f05:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801f08:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f0c:	48 83 c0 18          	add    $0x18,%rax
+  801f10:	4c 89 da             	mov    %r11,%rdx
+  801f13:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801f16:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f1a:	48 83 c0 20          	add    $0x20,%rax
+  801f1e:	4c 89 e2             	mov    %r12,%rdx
+  801f21:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801f24:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f28:	48 83 c0 28          	add    $0x28,%rax
+  801f2c:	4c 89 ea             	mov    %r13,%rdx
+  801f2f:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801f32:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801f36:	74 52                	je     801f8a <syscall_words+0x19c>
+  801f38:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801f3d:	7e 4b                	jle    801f8a <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f3f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f43:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f46:	49 89 d0             	mov    %rdx,%r8
+  801f49:	89 c1                	mov    %eax,%ecx
+  801f4b:	48 b8 98 e8 ff ff ff 	movabs $0xffffffffffffe898,%rax
+  801f52:	ff ff ff 
+  801f55:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801f59:	48 89 c2             	mov    %rax,%rdx
+  801f5c:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801f61:	48 b8 b5 e8 ff ff ff 	movabs $0xffffffffffffe8b5,%rax
+  801f68:	ff ff ff 
+  801f6b:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801f6f:	48 89 c7             	mov    %rax,%rdi
+  801f72:	4d 89 f7             	mov    %r14,%r15
+  801f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7a:	49 b9 d0 83 ff ff ff 	movabs $0xffffffffffff83d0,%r9
+  801f81:	ff ff ff 
+  801f84:	4d 01 f1             	add    %r14,%r9
+  801f87:	41 ff d1             	call   *%r9
+
+	return ret;
+  801f8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801f8e:	48 83 c4 48          	add    $0x48,%rsp
+  801f92:	5b                   	pop    %rbx
+  801f93:	41 5c                	pop    %r12
+  801f95:	41 5d                	pop    %r13
+  801f97:	41 5e                	pop    %r14
+  801f99:	41 5f                	pop    %r15
+  801f9b:	5d                   	pop    %rbp
+  801f9c:	c3                   	ret
+
+0000000000801f9d <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801f9d:	55                   	push   %rbp
+  801f9e:	48 89 e5             	mov    %rsp,%rbp
+  801fa1:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fa5 <sys_cputs+0x8>
+  801fac:	49 bb 8b 60 00 00 00 	movabs $0x608b,%r11
+  801fb3:	00 00 00 
+  801fb6:	4c 01 d8             	add    %r11,%rax
+  801fb9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801fbd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801fc1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801fc5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fc9:	48 83 ec 08          	sub    $0x8,%rsp
+  801fcd:	6a 00                	push   $0x0
+  801fcf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fd5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fdb:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fe5:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  801fec:	ff ff ff 
+  801fef:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ff3:	ff d0                	call   *%rax
+  801ff5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ff9:	90                   	nop
+  801ffa:	c9                   	leave
+  801ffb:	c3                   	ret
+
+0000000000801ffc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801ffc:	55                   	push   %rbp
+  801ffd:	48 89 e5             	mov    %rsp,%rbp
+  802000:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802000 <sys_cgetc+0x4>
+  802007:	49 bb 30 60 00 00 00 	movabs $0x6030,%r11
+  80200e:	00 00 00 
+  802011:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802014:	48 83 ec 08          	sub    $0x8,%rsp
+  802018:	6a 00                	push   $0x0
+  80201a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802020:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802026:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80202b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802030:	be 00 00 00 00       	mov    $0x0,%esi
+  802035:	bf 01 00 00 00       	mov    $0x1,%edi
+  80203a:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  802041:	ff ff ff 
+  802044:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802048:	ff d0                	call   *%rax
+  80204a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80204e:	c9                   	leave
+  80204f:	c3                   	ret
+
+0000000000802050 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802050:	55                   	push   %rbp
+  802051:	48 89 e5             	mov    %rsp,%rbp
+  802054:	48 83 ec 10          	sub    $0x10,%rsp
+  802058:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802058 <sys_env_destroy+0x8>
+  80205f:	49 bb d8 5f 00 00 00 	movabs $0x5fd8,%r11
+  802066:	00 00 00 
+  802069:	4c 01 d8             	add    %r11,%rax
+  80206c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80206f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802072:	48 63 d2             	movslq %edx,%rdx
+  802075:	48 83 ec 08          	sub    $0x8,%rsp
+  802079:	6a 00                	push   $0x0
+  80207b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802081:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802087:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208c:	be 01 00 00 00       	mov    $0x1,%esi
+  802091:	bf 03 00 00 00       	mov    $0x3,%edi
+  802096:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80209d:	ff ff ff 
+  8020a0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020a4:	ff d0                	call   *%rax
+  8020a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020aa:	c9                   	leave
+  8020ab:	c3                   	ret
+
+00000000008020ac <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8020ac:	55                   	push   %rbp
+  8020ad:	48 89 e5             	mov    %rsp,%rbp
+  8020b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020b0 <sys_getenvid+0x4>
+  8020b7:	49 bb 80 5f 00 00 00 	movabs $0x5f80,%r11
+  8020be:	00 00 00 
+  8020c1:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8020c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c8:	6a 00                	push   $0x0
+  8020ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020ea:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  8020f1:	ff ff ff 
+  8020f4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020f8:	ff d0                	call   *%rax
+  8020fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020fe:	c9                   	leave
+  8020ff:	c3                   	ret
+
+0000000000802100 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802100:	55                   	push   %rbp
+  802101:	48 89 e5             	mov    %rsp,%rbp
+  802104:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802104 <sys_yield+0x4>
+  80210b:	49 bb 2c 5f 00 00 00 	movabs $0x5f2c,%r11
+  802112:	00 00 00 
+  802115:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802118:	48 83 ec 08          	sub    $0x8,%rsp
+  80211c:	6a 00                	push   $0x0
+  80211e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802124:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80212a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80212f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802134:	be 00 00 00 00       	mov    $0x0,%esi
+  802139:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80213e:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  802145:	ff ff ff 
+  802148:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80214c:	ff d0                	call   *%rax
+  80214e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802152:	90                   	nop
+  802153:	c9                   	leave
+  802154:	c3                   	ret
+
+0000000000802155 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802155:	55                   	push   %rbp
+  802156:	48 89 e5             	mov    %rsp,%rbp
+  802159:	48 83 ec 10          	sub    $0x10,%rsp
+  80215d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80215d <sys_page_alloc+0x8>
+  802164:	49 bb d3 5e 00 00 00 	movabs $0x5ed3,%r11
+  80216b:	00 00 00 
+  80216e:	4c 01 d8             	add    %r11,%rax
+  802171:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802174:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802178:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80217b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80217e:	48 63 f2             	movslq %edx,%rsi
+  802181:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802185:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802188:	48 63 d2             	movslq %edx,%rdx
+  80218b:	48 83 ec 08          	sub    $0x8,%rsp
+  80218f:	6a 00                	push   $0x0
+  802191:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802197:	49 89 f0             	mov    %rsi,%r8
+  80219a:	be 01 00 00 00       	mov    $0x1,%esi
+  80219f:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021a4:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  8021ab:	ff ff ff 
+  8021ae:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021b2:	ff d0                	call   *%rax
+  8021b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021b8:	c9                   	leave
+  8021b9:	c3                   	ret
+
+00000000008021ba <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8021ba:	55                   	push   %rbp
+  8021bb:	48 89 e5             	mov    %rsp,%rbp
+  8021be:	48 83 ec 20          	sub    $0x20,%rsp
+  8021c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021c2 <sys_page_map+0x8>
+  8021c9:	49 bb 6e 5e 00 00 00 	movabs $0x5e6e,%r11
+  8021d0:	00 00 00 
+  8021d3:	4c 01 d8             	add    %r11,%rax
+  8021d6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021dd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8021e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021e4:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8021e8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8021eb:	48 63 f2             	movslq %edx,%rsi
+  8021ee:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8021f2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021f5:	48 63 fa             	movslq %edx,%rdi
+  8021f8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021fc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021ff:	48 63 d2             	movslq %edx,%rdx
+  802202:	48 83 ec 08          	sub    $0x8,%rsp
+  802206:	56                   	push   %rsi
+  802207:	4d 89 c1             	mov    %r8,%r9
+  80220a:	49 89 f8             	mov    %rdi,%r8
+  80220d:	be 01 00 00 00       	mov    $0x1,%esi
+  802212:	bf 05 00 00 00       	mov    $0x5,%edi
+  802217:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80221e:	ff ff ff 
+  802221:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802225:	ff d0                	call   *%rax
+  802227:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80222b:	c9                   	leave
+  80222c:	c3                   	ret
+
+000000000080222d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80222d:	55                   	push   %rbp
+  80222e:	48 89 e5             	mov    %rsp,%rbp
+  802231:	48 83 ec 10          	sub    $0x10,%rsp
+  802235:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802235 <sys_page_unmap+0x8>
+  80223c:	49 bb fb 5d 00 00 00 	movabs $0x5dfb,%r11
+  802243:	00 00 00 
+  802246:	4c 01 d8             	add    %r11,%rax
+  802249:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80224c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802250:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802254:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802257:	48 63 d2             	movslq %edx,%rdx
+  80225a:	48 83 ec 08          	sub    $0x8,%rsp
+  80225e:	6a 00                	push   $0x0
+  802260:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802266:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80226c:	be 01 00 00 00       	mov    $0x1,%esi
+  802271:	bf 06 00 00 00       	mov    $0x6,%edi
+  802276:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80227d:	ff ff ff 
+  802280:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802284:	ff d0                	call   *%rax
+  802286:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80228a:	c9                   	leave
+  80228b:	c3                   	ret
+
+000000000080228c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80228c:	55                   	push   %rbp
+  80228d:	48 89 e5             	mov    %rsp,%rbp
+  802290:	48 83 ec 10          	sub    $0x10,%rsp
+  802294:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802294 <sys_env_set_status+0x8>
+  80229b:	49 bb 9c 5d 00 00 00 	movabs $0x5d9c,%r11
+  8022a2:	00 00 00 
+  8022a5:	4c 01 d8             	add    %r11,%rax
+  8022a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ab:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8022ae:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022b1:	48 63 ca             	movslq %edx,%rcx
+  8022b4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022b7:	48 63 d2             	movslq %edx,%rdx
+  8022ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8022be:	6a 00                	push   $0x0
+  8022c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022cc:	be 01 00 00 00       	mov    $0x1,%esi
+  8022d1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022d6:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  8022dd:	ff ff ff 
+  8022e0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022e4:	ff d0                	call   *%rax
+  8022e6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ea:	c9                   	leave
+  8022eb:	c3                   	ret
+
+00000000008022ec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8022ec:	55                   	push   %rbp
+  8022ed:	48 89 e5             	mov    %rsp,%rbp
+  8022f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8022f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022f4 <sys_env_set_trapframe+0x8>
+  8022fb:	49 bb 3c 5d 00 00 00 	movabs $0x5d3c,%r11
+  802302:	00 00 00 
+  802305:	4c 01 d8             	add    %r11,%rax
+  802308:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80230b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80230f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802313:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802316:	48 63 d2             	movslq %edx,%rdx
+  802319:	48 83 ec 08          	sub    $0x8,%rsp
+  80231d:	6a 00                	push   $0x0
+  80231f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802325:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80232b:	be 01 00 00 00       	mov    $0x1,%esi
+  802330:	bf 09 00 00 00       	mov    $0x9,%edi
+  802335:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80233c:	ff ff ff 
+  80233f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802343:	ff d0                	call   *%rax
+  802345:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802349:	c9                   	leave
+  80234a:	c3                   	ret
+
+000000000080234b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80234b:	55                   	push   %rbp
+  80234c:	48 89 e5             	mov    %rsp,%rbp
+  80234f:	48 83 ec 10          	sub    $0x10,%rsp
+  802353:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802353 <sys_env_set_pgfault_upcall+0x8>
+  80235a:	49 bb dd 5c 00 00 00 	movabs $0x5cdd,%r11
+  802361:	00 00 00 
+  802364:	4c 01 d8             	add    %r11,%rax
+  802367:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80236a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80236e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802372:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802375:	48 63 d2             	movslq %edx,%rdx
+  802378:	48 83 ec 08          	sub    $0x8,%rsp
+  80237c:	6a 00                	push   $0x0
+  80237e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802384:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80238a:	be 01 00 00 00       	mov    $0x1,%esi
+  80238f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802394:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80239b:	ff ff ff 
+  80239e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023a2:	ff d0                	call   *%rax
+  8023a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a8:	c9                   	leave
+  8023a9:	c3                   	ret
+
+00000000008023aa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8023aa:	55                   	push   %rbp
+  8023ab:	48 89 e5             	mov    %rsp,%rbp
+  8023ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8023b2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023b2 <sys_ipc_try_send+0x8>
+  8023b9:	49 bb 7e 5c 00 00 00 	movabs $0x5c7e,%r11
+  8023c0:	00 00 00 
+  8023c3:	4c 01 d8             	add    %r11,%rax
+  8023c6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023c9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023cd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023d1:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8023d4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023d7:	48 63 fa             	movslq %edx,%rdi
+  8023da:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8023de:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023e1:	48 63 d2             	movslq %edx,%rdx
+  8023e4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ec:	6a 00                	push   $0x0
+  8023ee:	49 89 f9             	mov    %rdi,%r9
+  8023f1:	49 89 f0             	mov    %rsi,%r8
+  8023f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f9:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8023fe:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  802405:	ff ff ff 
+  802408:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80240c:	ff d0                	call   *%rax
+  80240e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802412:	c9                   	leave
+  802413:	c3                   	ret
+
+0000000000802414 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802414:	55                   	push   %rbp
+  802415:	48 89 e5             	mov    %rsp,%rbp
+  802418:	48 83 ec 20          	sub    $0x20,%rsp
+  80241c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80241c <sys_ipc_send+0x8>
+  802423:	49 bb 14 5c 00 00 00 	movabs $0x5c14,%r11
+  80242a:	00 00 00 
+  80242d:	4c 01 d8             	add    %r11,%rax
+  802430:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802433:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802437:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80243b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80243e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802441:	48 63 fa             	movslq %edx,%rdi
+  802444:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802448:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80244b:	48 63 d2             	movslq %edx,%rdx
+  80244e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802452:	48 83 ec 08          	sub    $0x8,%rsp
+  802456:	6a 00                	push   $0x0
+  802458:	49 89 f9             	mov    %rdi,%r9
+  80245b:	49 89 f0             	mov    %rsi,%r8
+  80245e:	be 00 00 00 00       	mov    $0x0,%esi
+  802463:	bf 17 00 00 00       	mov    $0x17,%edi
+  802468:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80246f:	ff ff ff 
+  802472:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802476:	ff d0                	call   *%rax
+  802478:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80247c:	c9                   	leave
+  80247d:	c3                   	ret
+
+000000000080247e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80247e:	55                   	push   %rbp
+  80247f:	48 89 e5             	mov    %rsp,%rbp
+  802482:	48 83 ec 10          	sub    $0x10,%rsp
+  802486:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802486 <sys_ipc_recv+0x8>
+  80248d:	49 bb aa 5b 00 00 00 	movabs $0x5baa,%r11
+  802494:	00 00 00 
+  802497:	4c 01 d8             	add    %r11,%rax
+  80249a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80249e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024a2:	6a 00                	push   $0x0
+  8024a4:	6a 00                	push   $0x0
+  8024a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8024bc:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8024c1:	49 ba be 9d ff ff ff 	movabs $0xffffffffffff9dbe,%r10
+  8024c8:	ff ff ff 
+  8024cb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024cf:	ff d0                	call   *%rax
+  8024d1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d5:	c9                   	leave
+  8024d6:	c3                   	ret
+
+00000000008024d7 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8024d7:	55                   	push   %rbp
+  8024d8:	48 89 e5             	mov    %rsp,%rbp
+  8024db:	48 83 ec 30          	sub    $0x30,%rsp
+  8024df:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024df <sys_ipc_call+0x8>
+  8024e6:	49 bb 51 5b 00 00 00 	movabs $0x5b51,%r11
+  8024ed:	00 00 00 
+  8024f0:	4c 01 d8             	add    %r11,%rax
+  8024f3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024fa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024fe:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802501:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802505:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802509:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80250d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802510:	4c 63 c2             	movslq %edx,%r8
+  802513:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802517:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80251a:	48 63 d2             	movslq %edx,%rdx
+  80251d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802521:	ff 75 d8             	push   -0x28(%rbp)
+  802524:	56                   	push   %rsi
+  802525:	4d 89 c1             	mov    %r8,%r9
+  802528:	49 89 f8             	mov    %rdi,%r8
+  80252b:	be 00 00 00 00       	mov    $0x0,%esi
+  802530:	bf 18 00 00 00       	mov    $0x18,%edi
+  802535:	49 ba be 9d ff ff ff 	movabs $0xffffffffffff9dbe,%r10
+  80253c:	ff ff ff 
+  80253f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802543:	ff d0                	call   *%rax
+  802545:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802549:	c9                   	leave
+  80254a:	c3                   	ret
+
+000000000080254b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80254b:	55                   	push   %rbp
+  80254c:	48 89 e5             	mov    %rsp,%rbp
+  80254f:	48 83 ec 30          	sub    $0x30,%rsp
+  802553:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802553 <sys_ipc_reply_recv+0x8>
+  80255a:	49 bb dd 5a 00 00 00 	movabs $0x5add,%r11
+  802561:	00 00 00 
+  802564:	4c 01 d8             	add    %r11,%rax
+  802567:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80256a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80256e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802572:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802575:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802579:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80257d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802581:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802584:	4c 63 c2             	movslq %edx,%r8
+  802587:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80258b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80258e:	48 63 d2             	movslq %edx,%rdx
+  802591:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802595:	ff 75 d8             	push   -0x28(%rbp)
+  802598:	56                   	push   %rsi
+  802599:	4d 89 c1             	mov    %r8,%r9
+  80259c:	49 89 f8             	mov    %rdi,%r8
+  80259f:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a4:	bf 19 00 00 00       	mov    $0x19,%edi
+  8025a9:	49 ba be 9d ff ff ff 	movabs $0xffffffffffff9dbe,%r10
+  8025b0:	ff ff ff 
+  8025b3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025b7:	ff d0                	call   *%rax
+  8025b9:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8025bd:	c9                   	leave
+  8025be:	c3                   	ret
+
+00000000008025bf <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8025bf:	55                   	push   %rbp
+  8025c0:	48 89 e5             	mov    %rsp,%rbp
+  8025c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8025c7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025c7 <sys_env_set_priority+0x8>
+  8025ce:	49 bb 69 5a 00 00 00 	movabs $0x5a69,%r11
+  8025d5:	00 00 00 
+  8025d8:	4c 01 d8             	add    %r11,%rax
+  8025db:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025de:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8025e1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025e4:	48 63 ca             	movslq %edx,%rcx
+  8025e7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025ea:	48 63 d2             	movslq %edx,%rdx
+  8025ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f1:	6a 00                	push   $0x0
+  8025f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025ff:	be 01 00 00 00       	mov    $0x1,%esi
+  802604:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802609:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  802610:	ff ff ff 
+  802613:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802617:	ff d0                	call   *%rax
+  802619:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80261d:	c9                   	leave
+  80261e:	c3                   	ret
+
+000000000080261f <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80261f:	55                   	push   %rbp
+  802620:	48 89 e5             	mov    %rsp,%rbp
+  802623:	48 83 ec 10          	sub    $0x10,%rsp
+  802627:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802627 <sys_env_set_affinity+0x8>
+  80262e:	49 bb 09 5a 00 00 00 	movabs $0x5a09,%r11
+  802635:	00 00 00 
+  802638:	4c 01 d8             	add    %r11,%rax
+  80263b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80263e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802641:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802644:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802647:	48 63 d2             	movslq %edx,%rdx
+  80264a:	48 83 ec 08          	sub    $0x8,%rsp
+  80264e:	6a 00                	push   $0x0
+  802650:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802656:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80265c:	be 01 00 00 00       	mov    $0x1,%esi
+  802661:	bf 10 00 00 00       	mov    $0x10,%edi
+  802666:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80266d:	ff ff ff 
+  802670:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802674:	ff d0                	call   *%rax
+  802676:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80267a:	c9                   	leave
+  80267b:	c3                   	ret
+
+000000000080267c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80267c:	55                   	push   %rbp
+  80267d:	48 89 e5             	mov    %rsp,%rbp
+  802680:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802680 <sys_time_msec+0x4>
+  802687:	49 bb b0 59 00 00 00 	movabs $0x59b0,%r11
+  80268e:	00 00 00 
+  802691:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802694:	48 83 ec 08          	sub    $0x8,%rsp
+  802698:	6a 00                	push   $0x0
+  80269a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b5:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8026ba:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  8026c1:	ff ff ff 
+  8026c4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026c8:	ff d0                	call   *%rax
+  8026ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026ce:	c9                   	leave
+  8026cf:	c3                   	ret
+
+00000000008026d0 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8026d0:	55                   	push   %rbp
+  8026d1:	48 89 e5             	mov    %rsp,%rbp
+  8026d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8026d8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026d8 <sys_sleep_usec+0x8>
+  8026df:	49 bb 58 59 00 00 00 	movabs $0x5958,%r11
+  8026e6:	00 00 00 
+  8026e9:	4c 01 d8             	add    %r11,%rax
+  8026ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8026f0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8026f8:	6a 00                	push   $0x0
+  8026fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802700:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802706:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80270b:	be 00 00 00 00       	mov    $0x0,%esi
+  802710:	bf 11 00 00 00       	mov    $0x11,%edi
+  802715:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80271c:	ff ff ff 
+  80271f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802723:	ff d0                	call   *%rax
+  802725:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802729:	c9                   	leave
+  80272a:	c3                   	ret
+
+000000000080272b <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80272b:	55                   	push   %rbp
+  80272c:	48 89 e5             	mov    %rsp,%rbp
+  80272f:	48 83 ec 10          	sub    $0x10,%rsp
+  802733:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802733 <sys_page_alloc_huge+0x8>
+  80273a:	49 bb fd 58 00 00 00 	movabs $0x58fd,%r11
+  802741:	00 00 00 
+  802744:	4c 01 d8             	add    %r11,%rax
+  802747:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80274a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80274e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802751:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802754:	48 63 f2             	movslq %edx,%rsi
+  802757:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80275b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80275e:	48 63 d2             	movslq %edx,%rdx
+  802761:	48 83 ec 08          	sub    $0x8,%rsp
+  802765:	6a 00                	push   $0x0
+  802767:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80276d:	49 89 f0             	mov    %rsi,%r8
+  802770:	be 01 00 00 00       	mov    $0x1,%esi
+  802775:	bf 12 00 00 00       	mov    $0x12,%edi
+  80277a:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  802781:	ff ff ff 
+  802784:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802788:	ff d0                	call   *%rax
+  80278a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80278e:	c9                   	leave
+  80278f:	c3                   	ret
+
+0000000000802790 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802790:	55                   	push   %rbp
+  802791:	48 89 e5             	mov    %rsp,%rbp
+  802794:	48 83 ec 10          	sub    $0x10,%rsp
+  802798:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802798 <sys_page_map_batch+0x8>
+  80279f:	49 bb 98 58 00 00 00 	movabs $0x5898,%r11
+  8027a6:	00 00 00 
+  8027a9:	4c 01 d8             	add    %r11,%rax
+  8027ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8027b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027b8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c0:	6a 00                	push   $0x0
+  8027c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8027d3:	bf 13 00 00 00       	mov    $0x13,%edi
+  8027d8:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  8027df:	ff ff ff 
+  8027e2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027e6:	ff d0                	call   *%rax
+  8027e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027ec:	c9                   	leave
+  8027ed:	c3                   	ret
+
+00000000008027ee <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8027ee:	55                   	push   %rbp
+  8027ef:	48 89 e5             	mov    %rsp,%rbp
+  8027f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027f6 <sys_page_alloc_batch+0x8>
+  8027fd:	49 bb 3a 58 00 00 00 	movabs $0x583a,%r11
+  802804:	00 00 00 
+  802807:	4c 01 d8             	add    %r11,%rax
+  80280a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80280e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802812:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802816:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80281a:	48 83 ec 08          	sub    $0x8,%rsp
+  80281e:	6a 00                	push   $0x0
+  802820:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802826:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80282c:	be 01 00 00 00       	mov    $0x1,%esi
+  802831:	bf 14 00 00 00       	mov    $0x14,%edi
+  802836:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80283d:	ff ff ff 
+  802840:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802844:	ff d0                	call   *%rax
+  802846:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80284a:	c9                   	leave
+  80284b:	c3                   	ret
+
+000000000080284c <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80284c:	55                   	push   %rbp
+  80284d:	48 89 e5             	mov    %rsp,%rbp
+  802850:	48 83 ec 10          	sub    $0x10,%rsp
+  802854:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802854 <sys_page_unmap_batch+0x8>
+  80285b:	49 bb dc 57 00 00 00 	movabs $0x57dc,%r11
+  802862:	00 00 00 
+  802865:	4c 01 d8             	add    %r11,%rax
+  802868:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80286c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802870:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802874:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802878:	48 83 ec 08          	sub    $0x8,%rsp
+  80287c:	6a 00                	push   $0x0
+  80287e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802884:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80288a:	be 01 00 00 00       	mov    $0x1,%esi
+  80288f:	bf 15 00 00 00       	mov    $0x15,%edi
+  802894:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  80289b:	ff ff ff 
+  80289e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028a2:	ff d0                	call   *%rax
+  8028a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028a8:	c9                   	leave
+  8028a9:	c3                   	ret
+
+00000000008028aa <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8028aa:	55                   	push   %rbp
+  8028ab:	48 89 e5             	mov    %rsp,%rbp
+  8028ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028ae <sys_fork+0x4>
+  8028b5:	49 bb 82 57 00 00 00 	movabs $0x5782,%r11
+  8028bc:	00 00 00 
+  8028bf:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8028c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c6:	6a 00                	push   $0x0
+  8028c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028de:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e3:	bf 16 00 00 00       	mov    $0x16,%edi
+  8028e8:	49 ba 04 9d ff ff ff 	movabs $0xffffffffffff9d04,%r10
+  8028ef:	ff ff ff 
+  8028f2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028f6:	ff d0                	call   *%rax
+  8028f8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028fc:	c9                   	leave
+  8028fd:	c3                   	ret
+
+00000000008028fe <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  8028fe:	55                   	push   %rbp
+  8028ff:	48 89 e5             	mov    %rsp,%rbp
+  802902:	48 83 ec 08          	sub    $0x8,%rsp
+  802906:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802906 <fd2num+0x8>
+  80290d:	49 bb 2a 57 00 00 00 	movabs $0x572a,%r11
+  802914:	00 00 00 
+  802917:	4c 01 d8             	add    %r11,%rax
+  80291a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80291e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802922:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802929:	ff ff ff 
+  80292c:	48 01 d0             	add    %rdx,%rax
+  80292f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802933:	c9                   	leave
+  802934:	c3                   	ret
+
+0000000000802935 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802935:	55                   	push   %rbp
+  802936:	48 89 e5             	mov    %rsp,%rbp
+  802939:	48 83 ec 08          	sub    $0x8,%rsp
+  80293d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80293d <fd2data+0x8>
+  802944:	49 bb f3 56 00 00 00 	movabs $0x56f3,%r11
+  80294b:	00 00 00 
+  80294e:	4c 01 d8             	add    %r11,%rax
+  802951:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802955:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802959:	48 89 d7             	mov    %rdx,%rdi
+  80295c:	48 ba ce a8 ff ff ff 	movabs $0xffffffffffffa8ce,%rdx
+  802963:	ff ff ff 
+  802966:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80296a:	ff d0                	call   *%rax
+  80296c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802972:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802976:	c9                   	leave
+  802977:	c3                   	ret
+
+0000000000802978 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802978:	55                   	push   %rbp
+  802979:	48 89 e5             	mov    %rsp,%rbp
+  80297c:	48 83 ec 18          	sub    $0x18,%rsp
+  802980:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802980 <fd_alloc+0x8>
+  802987:	49 bb b0 56 00 00 00 	movabs $0x56b0,%r11
+  80298e:	00 00 00 
+  802991:	4c 01 d8             	add    %r11,%rax
+  802994:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802998:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80299f:	eb 75                	jmp    802a16 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8029a1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029a4:	48 63 d2             	movslq %edx,%rdx
+  8029a7:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8029ae:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8029b2:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8029b6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029ba:	48 89 d1             	mov    %rdx,%rcx
+  8029bd:	48 c1 e9 15          	shr    $0x15,%rcx
+  8029c1:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8029c8:	ff ff ff 
+  8029cb:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8029cf:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8029d3:	83 e2 01             	and    $0x1,%edx
+  8029d6:	48 85 d2             	test   %rdx,%rdx
+  8029d9:	74 25                	je     802a00 <fd_alloc+0x88>
+  8029db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029df:	48 89 d1             	mov    %rdx,%rcx
+  8029e2:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8029e6:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8029ed:	ff ff ff 
+  8029f0:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8029f4:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8029f8:	83 e2 01             	and    $0x1,%edx
+  8029fb:	48 85 d2             	test   %rdx,%rdx
+  8029fe:	75 12                	jne    802a12 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802a00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a04:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a08:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a10:	eb 1a                	jmp    802a2c <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802a12:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a16:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a1a:	7e 85                	jle    8029a1 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802a1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a20:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802a27:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802a2c:	c9                   	leave
+  802a2d:	c3                   	ret
+
+0000000000802a2e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802a2e:	55                   	push   %rbp
+  802a2f:	48 89 e5             	mov    %rsp,%rbp
+  802a32:	48 83 ec 20          	sub    $0x20,%rsp
+  802a36:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a36 <fd_lookup+0x8>
+  802a3d:	49 bb fa 55 00 00 00 	movabs $0x55fa,%r11
+  802a44:	00 00 00 
+  802a47:	4c 01 d8             	add    %r11,%rax
+  802a4a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802a4d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802a51:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a55:	78 06                	js     802a5d <fd_lookup+0x2f>
+  802a57:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802a5b:	7e 07                	jle    802a64 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802a5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a62:	eb 73                	jmp    802ad7 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802a64:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802a67:	48 63 d2             	movslq %edx,%rdx
+  802a6a:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802a71:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802a75:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802a79:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a7d:	48 89 d1             	mov    %rdx,%rcx
+  802a80:	48 c1 e9 15          	shr    $0x15,%rcx
+  802a84:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802a8b:	ff ff ff 
+  802a8e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a92:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a96:	83 e2 01             	and    $0x1,%edx
+  802a99:	48 85 d2             	test   %rdx,%rdx
+  802a9c:	74 22                	je     802ac0 <fd_lookup+0x92>
+  802a9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802aa2:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802aa6:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802aad:	ff ff ff 
+  802ab0:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802ab4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ab8:	83 e0 01             	and    $0x1,%eax
+  802abb:	48 85 c0             	test   %rax,%rax
+  802abe:	75 07                	jne    802ac7 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802ac0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac5:	eb 10                	jmp    802ad7 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802ac7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802acb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802acf:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ad7:	c9                   	leave
+  802ad8:	c3                   	ret
+
+0000000000802ad9 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802ad9:	55                   	push   %rbp
+  802ada:	48 89 e5             	mov    %rsp,%rbp
+  802add:	41 57                	push   %r15
+  802adf:	53                   	push   %rbx
+  802ae0:	48 83 ec 30          	sub    $0x30,%rsp
+  802ae4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ae4 <fd_close+0xb>
+  802aeb:	49 bb 4c 55 00 00 00 	movabs $0x554c,%r11
+  802af2:	00 00 00 
+  802af5:	4c 01 db             	add    %r11,%rbx
+  802af8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802afc:	89 f0                	mov    %esi,%eax
+  802afe:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802b01:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b05:	48 89 c7             	mov    %rax,%rdi
+  802b08:	48 b8 ce a8 ff ff ff 	movabs $0xffffffffffffa8ce,%rax
+  802b0f:	ff ff ff 
+  802b12:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b16:	ff d0                	call   *%rax
+  802b18:	89 c2                	mov    %eax,%edx
+  802b1a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802b1e:	48 89 c6             	mov    %rax,%rsi
+  802b21:	89 d7                	mov    %edx,%edi
+  802b23:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  802b2a:	ff ff ff 
+  802b2d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b31:	ff d0                	call   *%rax
+  802b33:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b36:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b3a:	78 0a                	js     802b46 <fd_close+0x6d>
+	    || fd != fd2)
+  802b3c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b40:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802b44:	74 12                	je     802b58 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802b46:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802b4a:	74 05                	je     802b51 <fd_close+0x78>
+  802b4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b4f:	eb 7a                	jmp    802bcb <fd_close+0xf2>
+  802b51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b56:	eb 73                	jmp    802bcb <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802b58:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b5c:	8b 00                	mov    (%rax),%eax
+  802b5e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802b62:	48 89 d6             	mov    %rdx,%rsi
+  802b65:	89 c7                	mov    %eax,%edi
+  802b67:	48 b8 a4 ab ff ff ff 	movabs $0xffffffffffffaba4,%rax
+  802b6e:	ff ff ff 
+  802b71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b75:	ff d0                	call   *%rax
+  802b77:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b7a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b7e:	78 2a                	js     802baa <fd_close+0xd1>
+		if (dev->dev_close)
+  802b80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b84:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802b88:	48 85 c0             	test   %rax,%rax
+  802b8b:	74 16                	je     802ba3 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802b8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b91:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802b95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b99:	48 89 c7             	mov    %rax,%rdi
+  802b9c:	ff d2                	call   *%rdx
+  802b9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ba1:	eb 07                	jmp    802baa <fd_close+0xd1>
+		else
+			r = 0;
+  802ba3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802baa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bae:	48 89 c6             	mov    %rax,%rsi
+  802bb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bb6:	49 89 df             	mov    %rbx,%r15
+  802bb9:	48 b8 fd a1 ff ff ff 	movabs $0xffffffffffffa1fd,%rax
+  802bc0:	ff ff ff 
+  802bc3:	48 01 d8             	add    %rbx,%rax
+  802bc6:	ff d0                	call   *%rax
+	return r;
+  802bc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802bcb:	48 83 c4 30          	add    $0x30,%rsp
+  802bcf:	5b                   	pop    %rbx
+  802bd0:	41 5f                	pop    %r15
+  802bd2:	5d                   	pop    %rbp
+  802bd3:	c3                   	ret
+
+0000000000802bd4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802bd4:	55                   	push   %rbp
+  802bd5:	48 89 e5             	mov    %rsp,%rbp
+  802bd8:	41 57                	push   %r15
+  802bda:	48 83 ec 28          	sub    $0x28,%rsp
+  802bde:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802bde <dev_lookup+0xa>
+  802be5:	49 bb 52 54 00 00 00 	movabs $0x5452,%r11
+  802bec:	00 00 00 
+  802bef:	4c 01 d9             	add    %r11,%rcx
+  802bf2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802bf5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802bf9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802c00:	eb 45                	jmp    802c47 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802c02:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802c09:	00 00 00 
+  802c0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c0f:	48 98                	cltq
+  802c11:	48 01 ca             	add    %rcx,%rdx
+  802c14:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c18:	8b 00                	mov    (%rax),%eax
+  802c1a:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802c1d:	75 24                	jne    802c43 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802c1f:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802c26:	00 00 00 
+  802c29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c2c:	48 98                	cltq
+  802c2e:	48 01 ca             	add    %rcx,%rdx
+  802c31:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c39:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c41:	eb 74                	jmp    802cb7 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802c43:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802c47:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802c4e:	00 00 00 
+  802c51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c54:	48 98                	cltq
+  802c56:	48 01 ca             	add    %rcx,%rdx
+  802c59:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c5d:	48 85 c0             	test   %rax,%rax
+  802c60:	75 a0                	jne    802c02 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802c62:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802c69:	ff ff ff 
+  802c6c:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802c70:	48 8b 00             	mov    (%rax),%rax
+  802c73:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802c79:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802c7c:	89 c6                	mov    %eax,%esi
+  802c7e:	48 b8 c8 e8 ff ff ff 	movabs $0xffffffffffffe8c8,%rax
+  802c85:	ff ff ff 
+  802c88:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802c8c:	48 89 c7             	mov    %rax,%rdi
+  802c8f:	49 89 cf             	mov    %rcx,%r15
+  802c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c97:	49 b8 a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%r8
+  802c9e:	ff ff ff 
+  802ca1:	49 01 c8             	add    %rcx,%r8
+  802ca4:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802ca7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cab:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802cb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802cb7:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802cbb:	c9                   	leave
+  802cbc:	c3                   	ret
+
+0000000000802cbd <close>:
+
+int
+close(int fdnum)
+{
+  802cbd:	55                   	push   %rbp
+  802cbe:	48 89 e5             	mov    %rsp,%rbp
+  802cc1:	53                   	push   %rbx
+  802cc2:	48 83 ec 28          	sub    $0x28,%rsp
+  802cc6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802cc6 <close+0x9>
+  802ccd:	49 bb 6a 53 00 00 00 	movabs $0x536a,%r11
+  802cd4:	00 00 00 
+  802cd7:	4c 01 db             	add    %r11,%rbx
+  802cda:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cdd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802ce1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ce4:	48 89 d6             	mov    %rdx,%rsi
+  802ce7:	89 c7                	mov    %eax,%edi
+  802ce9:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  802cf0:	ff ff ff 
+  802cf3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cf7:	ff d0                	call   *%rax
+  802cf9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802cfc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d00:	79 05                	jns    802d07 <close+0x4a>
+		return r;
+  802d02:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d05:	eb 1c                	jmp    802d23 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802d07:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d0b:	be 01 00 00 00       	mov    $0x1,%esi
+  802d10:	48 89 c7             	mov    %rax,%rdi
+  802d13:	48 b8 a9 aa ff ff ff 	movabs $0xffffffffffffaaa9,%rax
+  802d1a:	ff ff ff 
+  802d1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d21:	ff d0                	call   *%rax
+}
+  802d23:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d27:	c9                   	leave
+  802d28:	c3                   	ret
+
+0000000000802d29 <close_all>:
+
+void
+close_all(void)
+{
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	53                   	push   %rbx
+  802d2e:	48 83 ec 18          	sub    $0x18,%rsp
+  802d32:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d32 <close_all+0x9>
+  802d39:	49 bb fe 52 00 00 00 	movabs $0x52fe,%r11
+  802d40:	00 00 00 
+  802d43:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802d46:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802d4d:	eb 19                	jmp    802d68 <close_all+0x3f>
+		close(i);
+  802d4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d52:	89 c7                	mov    %eax,%edi
+  802d54:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  802d5b:	ff ff ff 
+  802d5e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d62:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802d64:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802d68:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802d6c:	7e e1                	jle    802d4f <close_all+0x26>
+}
+  802d6e:	90                   	nop
+  802d6f:	90                   	nop
+  802d70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d74:	c9                   	leave
+  802d75:	c3                   	ret
+
+0000000000802d76 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802d76:	55                   	push   %rbp
+  802d77:	48 89 e5             	mov    %rsp,%rbp
+  802d7a:	41 57                	push   %r15
+  802d7c:	53                   	push   %rbx
+  802d7d:	48 83 ec 40          	sub    $0x40,%rsp
+  802d81:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d81 <dup+0xb>
+  802d88:	49 bb af 52 00 00 00 	movabs $0x52af,%r11
+  802d8f:	00 00 00 
+  802d92:	4c 01 db             	add    %r11,%rbx
+  802d95:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802d98:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802d9b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802d9f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802da2:	48 89 d6             	mov    %rdx,%rsi
+  802da5:	89 c7                	mov    %eax,%edi
+  802da7:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  802dae:	ff ff ff 
+  802db1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802db5:	ff d0                	call   *%rax
+  802db7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802dba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802dbe:	79 08                	jns    802dc8 <dup+0x52>
+		return r;
+  802dc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dc3:	e9 a4 01 00 00       	jmp    802f6c <dup+0x1f6>
+	close(newfdnum);
+  802dc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dcb:	89 c7                	mov    %eax,%edi
+  802dcd:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  802dd4:	ff ff ff 
+  802dd7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ddb:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802ddd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802de0:	48 98                	cltq
+  802de2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802de8:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dec:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802df0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df4:	48 89 c7             	mov    %rax,%rdi
+  802df7:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  802dfe:	ff ff ff 
+  802e01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e05:	ff d0                	call   *%rax
+  802e07:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802e0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e0f:	48 89 c7             	mov    %rax,%rdi
+  802e12:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  802e19:	ff ff ff 
+  802e1c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e20:	ff d0                	call   *%rax
+  802e22:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802e26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e2a:	48 c1 e8 15          	shr    $0x15,%rax
+  802e2e:	48 89 c2             	mov    %rax,%rdx
+  802e31:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802e38:	ff ff ff 
+  802e3b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e3f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e43:	83 e0 01             	and    $0x1,%eax
+  802e46:	48 85 c0             	test   %rax,%rax
+  802e49:	74 7f                	je     802eca <dup+0x154>
+  802e4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e4f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e53:	48 89 c2             	mov    %rax,%rdx
+  802e56:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e5d:	ff ff ff 
+  802e60:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e64:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e68:	83 e0 01             	and    $0x1,%eax
+  802e6b:	48 85 c0             	test   %rax,%rax
+  802e6e:	74 5a                	je     802eca <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802e70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e74:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e78:	48 89 c2             	mov    %rax,%rdx
+  802e7b:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e82:	ff ff ff 
+  802e85:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e89:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e8d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e92:	89 c1                	mov    %eax,%ecx
+  802e94:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802e98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e9c:	41 89 c8             	mov    %ecx,%r8d
+  802e9f:	48 89 d1             	mov    %rdx,%rcx
+  802ea2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea7:	48 89 c6             	mov    %rax,%rsi
+  802eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eaf:	49 89 df             	mov    %rbx,%r15
+  802eb2:	48 b8 8a a1 ff ff ff 	movabs $0xffffffffffffa18a,%rax
+  802eb9:	ff ff ff 
+  802ebc:	48 01 d8             	add    %rbx,%rax
+  802ebf:	ff d0                	call   *%rax
+  802ec1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ec4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ec8:	78 5f                	js     802f29 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802eca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ece:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ed2:	48 89 c2             	mov    %rax,%rdx
+  802ed5:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802edc:	ff ff ff 
+  802edf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ee3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ee7:	25 07 0e 00 00       	and    $0xe07,%eax
+  802eec:	89 c1                	mov    %eax,%ecx
+  802eee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ef2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ef6:	41 89 c8             	mov    %ecx,%r8d
+  802ef9:	48 89 d1             	mov    %rdx,%rcx
+  802efc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f01:	48 89 c6             	mov    %rax,%rsi
+  802f04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f09:	49 89 df             	mov    %rbx,%r15
+  802f0c:	48 b8 8a a1 ff ff ff 	movabs $0xffffffffffffa18a,%rax
+  802f13:	ff ff ff 
+  802f16:	48 01 d8             	add    %rbx,%rax
+  802f19:	ff d0                	call   *%rax
+  802f1b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f1e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f22:	78 08                	js     802f2c <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802f24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f27:	eb 43                	jmp    802f6c <dup+0x1f6>
+			goto err;
+  802f29:	90                   	nop
+  802f2a:	eb 01                	jmp    802f2d <dup+0x1b7>
+		goto err;
+  802f2c:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802f2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f31:	48 89 c6             	mov    %rax,%rsi
+  802f34:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f39:	49 89 df             	mov    %rbx,%r15
+  802f3c:	48 b8 fd a1 ff ff ff 	movabs $0xffffffffffffa1fd,%rax
+  802f43:	ff ff ff 
+  802f46:	48 01 d8             	add    %rbx,%rax
+  802f49:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802f4b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f4f:	48 89 c6             	mov    %rax,%rsi
+  802f52:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f57:	49 89 df             	mov    %rbx,%r15
+  802f5a:	48 b8 fd a1 ff ff ff 	movabs $0xffffffffffffa1fd,%rax
+  802f61:	ff ff ff 
+  802f64:	48 01 d8             	add    %rbx,%rax
+  802f67:	ff d0                	call   *%rax
+	return r;
+  802f69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f6c:	48 83 c4 40          	add    $0x40,%rsp
+  802f70:	5b                   	pop    %rbx
+  802f71:	41 5f                	pop    %r15
+  802f73:	5d                   	pop    %rbp
+  802f74:	c3                   	ret
+
+0000000000802f75 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802f75:	55                   	push   %rbp
+  802f76:	48 89 e5             	mov    %rsp,%rbp
+  802f79:	41 57                	push   %r15
+  802f7b:	53                   	push   %rbx
+  802f7c:	48 83 ec 40          	sub    $0x40,%rsp
+  802f80:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f80 <read+0xb>
+  802f87:	49 bb b0 50 00 00 00 	movabs $0x50b0,%r11
+  802f8e:	00 00 00 
+  802f91:	4c 01 db             	add    %r11,%rbx
+  802f94:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802f97:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802f9b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802f9f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802fa3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802fa6:	48 89 d6             	mov    %rdx,%rsi
+  802fa9:	89 c7                	mov    %eax,%edi
+  802fab:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  802fb2:	ff ff ff 
+  802fb5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fb9:	ff d0                	call   *%rax
+  802fbb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fbe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fc2:	78 28                	js     802fec <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fc8:	8b 00                	mov    (%rax),%eax
+  802fca:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802fce:	48 89 d6             	mov    %rdx,%rsi
+  802fd1:	89 c7                	mov    %eax,%edi
+  802fd3:	48 b8 a4 ab ff ff ff 	movabs $0xffffffffffffaba4,%rax
+  802fda:	ff ff ff 
+  802fdd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fe1:	ff d0                	call   *%rax
+  802fe3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fe6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fea:	79 08                	jns    802ff4 <read+0x7f>
+		return r;
+  802fec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fef:	e9 8b 00 00 00       	jmp    80307f <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802ff4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ff8:	8b 40 08             	mov    0x8(%rax),%eax
+  802ffb:	83 e0 03             	and    $0x3,%eax
+  802ffe:	83 f8 01             	cmp    $0x1,%eax
+  803001:	75 4b                	jne    80304e <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803003:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80300a:	ff ff ff 
+  80300d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803011:	48 8b 00             	mov    (%rax),%rax
+  803014:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80301a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80301d:	89 c6                	mov    %eax,%esi
+  80301f:	48 b8 e7 e8 ff ff ff 	movabs $0xffffffffffffe8e7,%rax
+  803026:	ff ff ff 
+  803029:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80302d:	48 89 c7             	mov    %rax,%rdi
+  803030:	49 89 df             	mov    %rbx,%r15
+  803033:	b8 00 00 00 00       	mov    $0x0,%eax
+  803038:	48 b9 a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%rcx
+  80303f:	ff ff ff 
+  803042:	48 01 d9             	add    %rbx,%rcx
+  803045:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803047:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80304c:	eb 31                	jmp    80307f <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80304e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803052:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803056:	48 85 c0             	test   %rax,%rax
+  803059:	75 07                	jne    803062 <read+0xed>
+		return -E_NOT_SUPP;
+  80305b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803060:	eb 1d                	jmp    80307f <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803062:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803066:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80306a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80306e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803072:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803076:	48 89 ce             	mov    %rcx,%rsi
+  803079:	48 89 c7             	mov    %rax,%rdi
+  80307c:	41 ff d0             	call   *%r8
+}
+  80307f:	48 83 c4 40          	add    $0x40,%rsp
+  803083:	5b                   	pop    %rbx
+  803084:	41 5f                	pop    %r15
+  803086:	5d                   	pop    %rbp
+  803087:	c3                   	ret
+
+0000000000803088 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803088:	55                   	push   %rbp
+  803089:	48 89 e5             	mov    %rsp,%rbp
+  80308c:	53                   	push   %rbx
+  80308d:	48 83 ec 38          	sub    $0x38,%rsp
+  803091:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803091 <readn+0x9>
+  803098:	49 bb 9f 4f 00 00 00 	movabs $0x4f9f,%r11
+  80309f:	00 00 00 
+  8030a2:	4c 01 db             	add    %r11,%rbx
+  8030a5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030a8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8030ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8030b0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8030b7:	eb 4b                	jmp    803104 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8030b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030bc:	48 98                	cltq
+  8030be:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8030c2:	48 29 c2             	sub    %rax,%rdx
+  8030c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030c8:	48 63 c8             	movslq %eax,%rcx
+  8030cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030cf:	48 01 c1             	add    %rax,%rcx
+  8030d2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030d5:	48 89 ce             	mov    %rcx,%rsi
+  8030d8:	89 c7                	mov    %eax,%edi
+  8030da:	48 b8 45 af ff ff ff 	movabs $0xffffffffffffaf45,%rax
+  8030e1:	ff ff ff 
+  8030e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030e8:	ff d0                	call   *%rax
+  8030ea:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  8030ed:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8030f1:	79 05                	jns    8030f8 <readn+0x70>
+			return m;
+  8030f3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8030f6:	eb 1d                	jmp    803115 <readn+0x8d>
+		if (m == 0)
+  8030f8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8030fc:	74 13                	je     803111 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  8030fe:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803101:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803104:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803107:	48 98                	cltq
+  803109:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80310d:	72 aa                	jb     8030b9 <readn+0x31>
+  80310f:	eb 01                	jmp    803112 <readn+0x8a>
+			break;
+  803111:	90                   	nop
+	}
+	return tot;
+  803112:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803115:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803119:	c9                   	leave
+  80311a:	c3                   	ret
+
+000000000080311b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80311b:	55                   	push   %rbp
+  80311c:	48 89 e5             	mov    %rsp,%rbp
+  80311f:	41 57                	push   %r15
+  803121:	53                   	push   %rbx
+  803122:	48 83 ec 40          	sub    $0x40,%rsp
+  803126:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803126 <write+0xb>
+  80312d:	49 bb 0a 4f 00 00 00 	movabs $0x4f0a,%r11
+  803134:	00 00 00 
+  803137:	4c 01 db             	add    %r11,%rbx
+  80313a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80313d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803141:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803145:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803149:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80314c:	48 89 d6             	mov    %rdx,%rsi
+  80314f:	89 c7                	mov    %eax,%edi
+  803151:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  803158:	ff ff ff 
+  80315b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80315f:	ff d0                	call   *%rax
+  803161:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803164:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803168:	78 28                	js     803192 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80316a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80316e:	8b 00                	mov    (%rax),%eax
+  803170:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803174:	48 89 d6             	mov    %rdx,%rsi
+  803177:	89 c7                	mov    %eax,%edi
+  803179:	48 b8 a4 ab ff ff ff 	movabs $0xffffffffffffaba4,%rax
+  803180:	ff ff ff 
+  803183:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803187:	ff d0                	call   *%rax
+  803189:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80318c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803190:	79 08                	jns    80319a <write+0x7f>
+		return r;
+  803192:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803195:	e9 8a 00 00 00       	jmp    803224 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80319a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80319e:	8b 40 08             	mov    0x8(%rax),%eax
+  8031a1:	83 e0 03             	and    $0x3,%eax
+  8031a4:	85 c0                	test   %eax,%eax
+  8031a6:	75 4b                	jne    8031f3 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031a8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8031af:	ff ff ff 
+  8031b2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031b6:	48 8b 00             	mov    (%rax),%rax
+  8031b9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8031bf:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8031c2:	89 c6                	mov    %eax,%esi
+  8031c4:	48 b8 03 e9 ff ff ff 	movabs $0xffffffffffffe903,%rax
+  8031cb:	ff ff ff 
+  8031ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031d2:	48 89 c7             	mov    %rax,%rdi
+  8031d5:	49 89 df             	mov    %rbx,%r15
+  8031d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031dd:	48 b9 a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%rcx
+  8031e4:	ff ff ff 
+  8031e7:	48 01 d9             	add    %rbx,%rcx
+  8031ea:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8031ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031f1:	eb 31                	jmp    803224 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8031f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031f7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8031fb:	48 85 c0             	test   %rax,%rax
+  8031fe:	75 07                	jne    803207 <write+0xec>
+		return -E_NOT_SUPP;
+  803200:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803205:	eb 1d                	jmp    803224 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803207:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80320b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80320f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803213:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803217:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80321b:	48 89 ce             	mov    %rcx,%rsi
+  80321e:	48 89 c7             	mov    %rax,%rdi
+  803221:	41 ff d0             	call   *%r8
+}
+  803224:	48 83 c4 40          	add    $0x40,%rsp
+  803228:	5b                   	pop    %rbx
+  803229:	41 5f                	pop    %r15
+  80322b:	5d                   	pop    %rbp
+  80322c:	c3                   	ret
+
+000000000080322d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80322d:	55                   	push   %rbp
+  80322e:	48 89 e5             	mov    %rsp,%rbp
+  803231:	48 83 ec 18          	sub    $0x18,%rsp
+  803235:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803235 <seek+0x8>
+  80323c:	49 bb fb 4d 00 00 00 	movabs $0x4dfb,%r11
+  803243:	00 00 00 
+  803246:	4c 01 d8             	add    %r11,%rax
+  803249:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80324c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80324f:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803253:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803256:	48 89 ce             	mov    %rcx,%rsi
+  803259:	89 d7                	mov    %edx,%edi
+  80325b:	48 ba fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rdx
+  803262:	ff ff ff 
+  803265:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803269:	ff d0                	call   *%rax
+  80326b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80326e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803272:	79 05                	jns    803279 <seek+0x4c>
+		return r;
+  803274:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803277:	eb 0f                	jmp    803288 <seek+0x5b>
+	fd->fd_offset = offset;
+  803279:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80327d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803280:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803283:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803288:	c9                   	leave
+  803289:	c3                   	ret
+
+000000000080328a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80328a:	55                   	push   %rbp
+  80328b:	48 89 e5             	mov    %rsp,%rbp
+  80328e:	41 57                	push   %r15
+  803290:	53                   	push   %rbx
+  803291:	48 83 ec 30          	sub    $0x30,%rsp
+  803295:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803295 <ftruncate+0xb>
+  80329c:	49 bb 9b 4d 00 00 00 	movabs $0x4d9b,%r11
+  8032a3:	00 00 00 
+  8032a6:	4c 01 db             	add    %r11,%rbx
+  8032a9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8032ac:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8032af:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8032b3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8032b6:	48 89 d6             	mov    %rdx,%rsi
+  8032b9:	89 c7                	mov    %eax,%edi
+  8032bb:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  8032c2:	ff ff ff 
+  8032c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032c9:	ff d0                	call   *%rax
+  8032cb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032d2:	78 28                	js     8032fc <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8032d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032d8:	8b 00                	mov    (%rax),%eax
+  8032da:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8032de:	48 89 d6             	mov    %rdx,%rsi
+  8032e1:	89 c7                	mov    %eax,%edi
+  8032e3:	48 b8 a4 ab ff ff ff 	movabs $0xffffffffffffaba4,%rax
+  8032ea:	ff ff ff 
+  8032ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032f1:	ff d0                	call   *%rax
+  8032f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032fa:	79 08                	jns    803304 <ftruncate+0x7a>
+		return r;
+  8032fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032ff:	e9 83 00 00 00       	jmp    803387 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803304:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803308:	8b 40 08             	mov    0x8(%rax),%eax
+  80330b:	83 e0 03             	and    $0x3,%eax
+  80330e:	85 c0                	test   %eax,%eax
+  803310:	75 4b                	jne    80335d <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803312:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803319:	ff ff ff 
+  80331c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803320:	48 8b 00             	mov    (%rax),%rax
+  803323:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803329:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80332c:	89 c6                	mov    %eax,%esi
+  80332e:	48 b8 20 e9 ff ff ff 	movabs $0xffffffffffffe920,%rax
+  803335:	ff ff ff 
+  803338:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80333c:	48 89 c7             	mov    %rax,%rdi
+  80333f:	49 89 df             	mov    %rbx,%r15
+  803342:	b8 00 00 00 00       	mov    $0x0,%eax
+  803347:	48 b9 a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%rcx
+  80334e:	ff ff ff 
+  803351:	48 01 d9             	add    %rbx,%rcx
+  803354:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803356:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80335b:	eb 2a                	jmp    803387 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80335d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803361:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803365:	48 85 c0             	test   %rax,%rax
+  803368:	75 07                	jne    803371 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  80336a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80336f:	eb 16                	jmp    803387 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803371:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803375:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803379:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80337d:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803380:	89 d6                	mov    %edx,%esi
+  803382:	48 89 c7             	mov    %rax,%rdi
+  803385:	ff d1                	call   *%rcx
+}
+  803387:	48 83 c4 30          	add    $0x30,%rsp
+  80338b:	5b                   	pop    %rbx
+  80338c:	41 5f                	pop    %r15
+  80338e:	5d                   	pop    %rbp
+  80338f:	c3                   	ret
+
+0000000000803390 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803390:	55                   	push   %rbp
+  803391:	48 89 e5             	mov    %rsp,%rbp
+  803394:	53                   	push   %rbx
+  803395:	48 83 ec 38          	sub    $0x38,%rsp
+  803399:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803399 <fstat+0x9>
+  8033a0:	49 bb 97 4c 00 00 00 	movabs $0x4c97,%r11
+  8033a7:	00 00 00 
+  8033aa:	4c 01 db             	add    %r11,%rbx
+  8033ad:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8033b0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8033b4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8033b8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8033bb:	48 89 d6             	mov    %rdx,%rsi
+  8033be:	89 c7                	mov    %eax,%edi
+  8033c0:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  8033c7:	ff ff ff 
+  8033ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033ce:	ff d0                	call   *%rax
+  8033d0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8033d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033d7:	78 28                	js     803401 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8033d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033dd:	8b 00                	mov    (%rax),%eax
+  8033df:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8033e3:	48 89 d6             	mov    %rdx,%rsi
+  8033e6:	89 c7                	mov    %eax,%edi
+  8033e8:	48 b8 a4 ab ff ff ff 	movabs $0xffffffffffffaba4,%rax
+  8033ef:	ff ff ff 
+  8033f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033f6:	ff d0                	call   *%rax
+  8033f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8033fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033ff:	79 05                	jns    803406 <fstat+0x76>
+		return r;
+  803401:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803404:	eb 5e                	jmp    803464 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803406:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80340a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80340e:	48 85 c0             	test   %rax,%rax
+  803411:	75 07                	jne    80341a <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803413:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803418:	eb 4a                	jmp    803464 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80341a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80341e:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803421:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803425:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80342c:	00 00 00 
+	stat->st_isdir = 0;
+  80342f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803433:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80343a:	00 00 00 
+	stat->st_dev = dev;
+  80343d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803441:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803445:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80344c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803450:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803454:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803458:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80345c:	48 89 d6             	mov    %rdx,%rsi
+  80345f:	48 89 c7             	mov    %rax,%rdi
+  803462:	ff d1                	call   *%rcx
+}
+  803464:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803468:	c9                   	leave
+  803469:	c3                   	ret
+
+000000000080346a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80346a:	55                   	push   %rbp
+  80346b:	48 89 e5             	mov    %rsp,%rbp
+  80346e:	41 57                	push   %r15
+  803470:	53                   	push   %rbx
+  803471:	48 83 ec 20          	sub    $0x20,%rsp
+  803475:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803475 <stat+0xb>
+  80347c:	49 bb bb 4b 00 00 00 	movabs $0x4bbb,%r11
+  803483:	00 00 00 
+  803486:	4c 01 db             	add    %r11,%rbx
+  803489:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80348d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803491:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803495:	be 00 00 00 00       	mov    $0x0,%esi
+  80349a:	48 89 c7             	mov    %rax,%rdi
+  80349d:	49 89 df             	mov    %rbx,%r15
+  8034a0:	48 b8 14 b7 ff ff ff 	movabs $0xffffffffffffb714,%rax
+  8034a7:	ff ff ff 
+  8034aa:	48 01 d8             	add    %rbx,%rax
+  8034ad:	ff d0                	call   *%rax
+  8034af:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034b2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034b6:	79 05                	jns    8034bd <stat+0x53>
+		return fd;
+  8034b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034bb:	eb 37                	jmp    8034f4 <stat+0x8a>
+	r = fstat(fd, stat);
+  8034bd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034c4:	48 89 d6             	mov    %rdx,%rsi
+  8034c7:	89 c7                	mov    %eax,%edi
+  8034c9:	48 b8 60 b3 ff ff ff 	movabs $0xffffffffffffb360,%rax
+  8034d0:	ff ff ff 
+  8034d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034d7:	ff d0                	call   *%rax
+  8034d9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8034dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034df:	89 c7                	mov    %eax,%edi
+  8034e1:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  8034e8:	ff ff ff 
+  8034eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034ef:	ff d0                	call   *%rax
+	return r;
+  8034f1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8034f4:	48 83 c4 20          	add    $0x20,%rsp
+  8034f8:	5b                   	pop    %rbx
+  8034f9:	41 5f                	pop    %r15
+  8034fb:	5d                   	pop    %rbp
+  8034fc:	c3                   	ret
+
+00000000008034fd <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8034fd:	55                   	push   %rbp
+  8034fe:	48 89 e5             	mov    %rsp,%rbp
+  803501:	41 57                	push   %r15
+  803503:	53                   	push   %rbx
+  803504:	48 83 ec 10          	sub    $0x10,%rsp
+  803508:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803508 <fsipc+0xb>
+  80350f:	49 bb 28 4b 00 00 00 	movabs $0x4b28,%r11
+  803516:	00 00 00 
+  803519:	4c 01 db             	add    %r11,%rbx
+  80351c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80351f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803523:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80352a:	00 00 00 
+  80352d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803530:	85 c0                	test   %eax,%eax
+  803532:	75 24                	jne    803558 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803534:	bf 01 00 00 00       	mov    $0x1,%edi
+  803539:	49 89 df             	mov    %rbx,%r15
+  80353c:	48 b8 b2 e2 ff ff ff 	movabs $0xffffffffffffe2b2,%rax
+  803543:	ff ff ff 
+  803546:	48 01 d8             	add    %rbx,%rax
+  803549:	ff d0                	call   *%rax
+  80354b:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803552:	00 00 00 
+  803555:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803558:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80355f:	00 00 00 
+  803562:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803565:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803569:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80356c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803572:	49 89 d0             	mov    %rdx,%r8
+  803575:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80357a:	48 ba d0 4f 01 00 00 	movabs $0x14fd0,%rdx
+  803581:	00 00 00 
+  803584:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803588:	89 c7                	mov    %eax,%edi
+  80358a:	49 89 df             	mov    %rbx,%r15
+  80358d:	48 b8 d1 dc ff ff ff 	movabs $0xffffffffffffdcd1,%rax
+  803594:	ff ff ff 
+  803597:	48 01 d8             	add    %rbx,%rax
+  80359a:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  80359c:	48 83 c4 10          	add    $0x10,%rsp
+  8035a0:	5b                   	pop    %rbx
+  8035a1:	41 5f                	pop    %r15
+  8035a3:	5d                   	pop    %rbp
+  8035a4:	c3                   	ret
+
+00000000008035a5 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8035a5:	55                   	push   %rbp
+  8035a6:	48 89 e5             	mov    %rsp,%rbp
+  8035a9:	41 57                	push   %r15
+  8035ab:	53                   	push   %rbx
+  8035ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8035b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035b0 <fsipc_words+0xb>
+  8035b7:	49 bb 80 4a 00 00 00 	movabs $0x4a80,%r11
+  8035be:	00 00 00 
+  8035c1:	4c 01 db             	add    %r11,%rbx
+  8035c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8035cb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8035cf:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8035d6:	00 00 00 
+  8035d9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8035dc:	85 c0                	test   %eax,%eax
+  8035de:	75 24                	jne    803604 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8035e0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035e5:	49 89 df             	mov    %rbx,%r15
+  8035e8:	48 b8 b2 e2 ff ff ff 	movabs $0xffffffffffffe2b2,%rax
+  8035ef:	ff ff ff 
+  8035f2:	48 01 d8             	add    %rbx,%rax
+  8035f5:	ff d0                	call   *%rax
+  8035f7:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8035fe:	00 00 00 
+  803601:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803604:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80360b:	00 00 00 
+  80360e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803611:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803615:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803619:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80361c:	89 c7                	mov    %eax,%edi
+  80361e:	49 89 df             	mov    %rbx,%r15
+  803621:	48 b8 bc dd ff ff ff 	movabs $0xffffffffffffddbc,%rax
+  803628:	ff ff ff 
+  80362b:	48 01 d8             	add    %rbx,%rax
+  80362e:	ff d0                	call   *%rax
+}
+  803630:	48 83 c4 20          	add    $0x20,%rsp
+  803634:	5b                   	pop    %rbx
+  803635:	41 5f                	pop    %r15
+  803637:	5d                   	pop    %rbp
+  803638:	c3                   	ret
+
+0000000000803639 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803639:	55                   	push   %rbp
+  80363a:	48 89 e5             	mov    %rsp,%rbp
+  80363d:	41 57                	push   %r15
+  80363f:	53                   	push   %rbx
+  803640:	48 83 ec 40          	sub    $0x40,%rsp
+  803644:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803644 <fsipc_pages+0xb>
+  80364b:	49 bb ec 49 00 00 00 	movabs $0x49ec,%r11
+  803652:	00 00 00 
+  803655:	4c 01 db             	add    %r11,%rbx
+  803658:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80365b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80365f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803663:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803666:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80366d:	00 00 00 
+  803670:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803673:	85 c0                	test   %eax,%eax
+  803675:	75 24                	jne    80369b <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803677:	bf 01 00 00 00       	mov    $0x1,%edi
+  80367c:	49 89 df             	mov    %rbx,%r15
+  80367f:	48 b8 b2 e2 ff ff ff 	movabs $0xffffffffffffe2b2,%rax
+  803686:	ff ff ff 
+  803689:	48 01 d8             	add    %rbx,%rax
+  80368c:	ff d0                	call   *%rax
+  80368e:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803695:	00 00 00 
+  803698:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  80369b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8036a0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8036a4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8036a7:	48 98                	cltq
+  8036a9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8036ad:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8036b1:	0f 95 c0             	setne  %al
+  8036b4:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  8036b7:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8036be:	00 
+  8036bf:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8036c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036c7:	48 01 d0             	add    %rdx,%rax
+  8036ca:	48 83 e8 01          	sub    $0x1,%rax
+  8036ce:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8036d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036db:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8036df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036e3:	48 29 d0             	sub    %rdx,%rax
+  8036e6:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8036ea:	41 89 c2             	mov    %eax,%r10d
+  8036ed:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8036f4:	00 00 00 
+  8036f7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036fa:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8036fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803702:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803705:	48 83 ec 08          	sub    $0x8,%rsp
+  803709:	6a 40                	push   $0x40
+  80370b:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803710:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803717:	00 
+  803718:	6a 05                	push   $0x5
+  80371a:	41 89 f9             	mov    %edi,%r9d
+  80371d:	49 89 c8             	mov    %rcx,%r8
+  803720:	44 89 d1             	mov    %r10d,%ecx
+  803723:	89 c7                	mov    %eax,%edi
+  803725:	49 89 df             	mov    %rbx,%r15
+  803728:	48 b8 ba de ff ff ff 	movabs $0xffffffffffffdeba,%rax
+  80372f:	ff ff ff 
+  803732:	48 01 d8             	add    %rbx,%rax
+  803735:	ff d0                	call   *%rax
+  803737:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80373b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80373f:	5b                   	pop    %rbx
+  803740:	41 5f                	pop    %r15
+  803742:	5d                   	pop    %rbp
+  803743:	c3                   	ret
+
+0000000000803744 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  803744:	55                   	push   %rbp
+  803745:	48 89 e5             	mov    %rsp,%rbp
+  803748:	41 57                	push   %r15
+  80374a:	53                   	push   %rbx
+  80374b:	48 83 ec 20          	sub    $0x20,%rsp
+  80374f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80374f <open+0xb>
+  803756:	49 bb e1 48 00 00 00 	movabs $0x48e1,%r11
+  80375d:	00 00 00 
+  803760:	4c 01 db             	add    %r11,%rbx
+  803763:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803767:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  80376a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80376e:	48 89 c7             	mov    %rax,%rdi
+  803771:	49 89 df             	mov    %rbx,%r15
+  803774:	48 b8 d5 93 ff ff ff 	movabs $0xffffffffffff93d5,%rax
+  80377b:	ff ff ff 
+  80377e:	48 01 d8             	add    %rbx,%rax
+  803781:	ff d0                	call   *%rax
+  803783:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803788:	7e 0a                	jle    803794 <open+0x50>
+		return -E_BAD_PATH;
+  80378a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80378f:	e9 18 01 00 00       	jmp    8038ac <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803794:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803798:	48 89 c7             	mov    %rax,%rdi
+  80379b:	49 89 df             	mov    %rbx,%r15
+  80379e:	48 b8 48 a9 ff ff ff 	movabs $0xffffffffffffa948,%rax
+  8037a5:	ff ff ff 
+  8037a8:	48 01 d8             	add    %rbx,%rax
+  8037ab:	ff d0                	call   *%rax
+  8037ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037b4:	74 08                	je     8037be <open+0x7a>
+		return r;
+  8037b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037b9:	e9 ee 00 00 00       	jmp    8038ac <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8037be:	48 ba d0 4f 01 00 00 	movabs $0x14fd0,%rdx
+  8037c5:	00 00 00 
+  8037c8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8037cb:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8037d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037d6:	48 89 c6             	mov    %rax,%rsi
+  8037d9:	48 b8 d0 4f 01 00 00 	movabs $0x14fd0,%rax
+  8037e0:	00 00 00 
+  8037e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037e7:	48 89 c7             	mov    %rax,%rdi
+  8037ea:	49 89 df             	mov    %rbx,%r15
+  8037ed:	48 b8 69 94 ff ff ff 	movabs $0xffffffffffff9469,%rax
+  8037f4:	ff ff ff 
+  8037f7:	48 01 d8             	add    %rbx,%rax
+  8037fa:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8037fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803800:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803805:	48 89 c6             	mov    %rax,%rsi
+  803808:	bf 00 00 00 00       	mov    $0x0,%edi
+  80380d:	49 89 df             	mov    %rbx,%r15
+  803810:	48 b8 25 a1 ff ff ff 	movabs $0xffffffffffffa125,%rax
+  803817:	ff ff ff 
+  80381a:	48 01 d8             	add    %rbx,%rax
+  80381d:	ff d0                	call   *%rax
+  80381f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803822:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803826:	74 23                	je     80384b <open+0x107>
+		fd_close(fd,0);
+  803828:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80382c:	be 00 00 00 00       	mov    $0x0,%esi
+  803831:	48 89 c7             	mov    %rax,%rdi
+  803834:	49 89 df             	mov    %rbx,%r15
+  803837:	48 b8 a9 aa ff ff ff 	movabs $0xffffffffffffaaa9,%rax
+  80383e:	ff ff ff 
+  803841:	48 01 d8             	add    %rbx,%rax
+  803844:	ff d0                	call   *%rax
+		return r;
+  803846:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803849:	eb 61                	jmp    8038ac <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80384b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80384f:	48 89 c6             	mov    %rax,%rsi
+  803852:	bf 01 00 00 00       	mov    $0x1,%edi
+  803857:	48 b8 cd b4 ff ff ff 	movabs $0xffffffffffffb4cd,%rax
+  80385e:	ff ff ff 
+  803861:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803865:	ff d0                	call   *%rax
+  803867:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80386a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80386e:	74 23                	je     803893 <open+0x14f>
+		fd_close(fd,0);
+  803870:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803874:	be 00 00 00 00       	mov    $0x0,%esi
+  803879:	48 89 c7             	mov    %rax,%rdi
+  80387c:	49 89 df             	mov    %rbx,%r15
+  80387f:	48 b8 a9 aa ff ff ff 	movabs $0xffffffffffffaaa9,%rax
+  803886:	ff ff ff 
+  803889:	48 01 d8             	add    %rbx,%rax
+  80388c:	ff d0                	call   *%rax
+		return r;
+  80388e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803891:	eb 19                	jmp    8038ac <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803893:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803897:	48 89 c7             	mov    %rax,%rdi
+  80389a:	49 89 df             	mov    %rbx,%r15
+  80389d:	48 b8 ce a8 ff ff ff 	movabs $0xffffffffffffa8ce,%rax
+  8038a4:	ff ff ff 
+  8038a7:	48 01 d8             	add    %rbx,%rax
+  8038aa:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8038ac:	48 83 c4 20          	add    $0x20,%rsp
+  8038b0:	5b                   	pop    %rbx
+  8038b1:	41 5f                	pop    %r15
+  8038b3:	5d                   	pop    %rbp
+  8038b4:	c3                   	ret
+
+00000000008038b5 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8038b5:	55                   	push   %rbp
+  8038b6:	48 89 e5             	mov    %rsp,%rbp
+  8038b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8038bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038bd <devfile_flush+0x8>
+  8038c4:	49 bb 73 47 00 00 00 	movabs $0x4773,%r11
+  8038cb:	00 00 00 
+  8038ce:	4c 01 d8             	add    %r11,%rax
+  8038d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8038d5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8038d9:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8038dc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8038df:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8038e3:	ba 04 00 00 00       	mov    $0x4,%edx
+  8038e8:	48 89 ce             	mov    %rcx,%rsi
+  8038eb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8038f0:	48 b9 75 b5 ff ff ff 	movabs $0xffffffffffffb575,%rcx
+  8038f7:	ff ff ff 
+  8038fa:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8038fe:	ff d0                	call   *%rax
+}
+  803900:	c9                   	leave
+  803901:	c3                   	ret
+
+0000000000803902 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803902:	55                   	push   %rbp
+  803903:	48 89 e5             	mov    %rsp,%rbp
+  803906:	41 57                	push   %r15
+  803908:	53                   	push   %rbx
+  803909:	48 83 ec 60          	sub    $0x60,%rsp
+  80390d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80390d <devfile_read+0xb>
+  803914:	49 bb 23 47 00 00 00 	movabs $0x4723,%r11
+  80391b:	00 00 00 
+  80391e:	4c 01 db             	add    %r11,%rbx
+  803921:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803925:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803929:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80392d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803931:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803935:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803939:	8b 50 0c             	mov    0xc(%rax),%edx
+  80393c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803940:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803942:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803946:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80394a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  80394e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803952:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803957:	ba 10 00 00 00       	mov    $0x10,%edx
+  80395c:	48 89 c6             	mov    %rax,%rsi
+  80395f:	bf 03 00 00 00       	mov    $0x3,%edi
+  803964:	48 b8 09 b6 ff ff ff 	movabs $0xffffffffffffb609,%rax
+  80396b:	ff ff ff 
+  80396e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803972:	ff d0                	call   *%rax
+  803974:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803977:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80397b:	79 05                	jns    803982 <devfile_read+0x80>
+		return r;
+  80397d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803980:	eb 64                	jmp    8039e6 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803982:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803985:	48 63 d0             	movslq %eax,%rdx
+  803988:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80398c:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803991:	48 01 c1             	add    %rax,%rcx
+  803994:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803998:	48 89 ce             	mov    %rcx,%rsi
+  80399b:	48 89 c7             	mov    %rax,%rdi
+  80399e:	49 89 df             	mov    %rbx,%r15
+  8039a1:	48 b8 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rax
+  8039a8:	ff ff ff 
+  8039ab:	48 01 d8             	add    %rbx,%rax
+  8039ae:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8039b0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8039b7:	ff ff ff 
+  8039ba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039be:	48 8b 00             	mov    (%rax),%rax
+  8039c1:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8039c7:	89 c6                	mov    %eax,%esi
+  8039c9:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8039ce:	48 89 c7             	mov    %rax,%rdi
+  8039d1:	49 89 df             	mov    %rbx,%r15
+  8039d4:	48 b8 6c e2 ff ff ff 	movabs $0xffffffffffffe26c,%rax
+  8039db:	ff ff ff 
+  8039de:	48 01 d8             	add    %rbx,%rax
+  8039e1:	ff d0                	call   *%rax
+	return r;
+  8039e3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8039e6:	48 83 c4 60          	add    $0x60,%rsp
+  8039ea:	5b                   	pop    %rbx
+  8039eb:	41 5f                	pop    %r15
+  8039ed:	5d                   	pop    %rbp
+  8039ee:	c3                   	ret
+
+00000000008039ef <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8039ef:	55                   	push   %rbp
+  8039f0:	48 89 e5             	mov    %rsp,%rbp
+  8039f3:	41 57                	push   %r15
+  8039f5:	53                   	push   %rbx
+  8039f6:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  8039fa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039fa <devfile_write+0xb>
+  803a01:	49 bb 36 46 00 00 00 	movabs $0x4636,%r11
+  803a08:	00 00 00 
+  803a0b:	4c 01 db             	add    %r11,%rbx
+  803a0e:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803a12:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803a16:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803a1d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803a21:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803a25:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803a2c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803a30:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803a37:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a3a:	48 63 d0             	movslq %eax,%rdx
+  803a3d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a41:	48 39 c2             	cmp    %rax,%rdx
+  803a44:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803a48:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803a4f:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803a56:	00 
+  803a57:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803a5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a62:	48 01 d0             	add    %rdx,%rax
+  803a65:	48 83 e8 01          	sub    $0x1,%rax
+  803a69:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803a6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a71:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a76:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803a7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a7e:	48 29 d0             	sub    %rdx,%rax
+  803a81:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a85:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803a88:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803a8b:	89 c6                	mov    %eax,%esi
+  803a8d:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803a92:	48 89 c7             	mov    %rax,%rdi
+  803a95:	49 89 df             	mov    %rbx,%r15
+  803a98:	48 b8 26 e2 ff ff ff 	movabs $0xffffffffffffe226,%rax
+  803a9f:	ff ff ff 
+  803aa2:	48 01 d8             	add    %rbx,%rax
+  803aa5:	ff d0                	call   *%rax
+  803aa7:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803aaa:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803aae:	79 08                	jns    803ab8 <devfile_write+0xc9>
+		return r;
+  803ab0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803ab3:	e9 8f 00 00 00       	jmp    803b47 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803ab8:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803abf:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803ac3:	48 89 c6             	mov    %rax,%rsi
+  803ac6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803acb:	48 89 c7             	mov    %rax,%rdi
+  803ace:	49 89 df             	mov    %rbx,%r15
+  803ad1:	48 b8 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rax
+  803ad8:	ff ff ff 
+  803adb:	48 01 d8             	add    %rbx,%rax
+  803ade:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803ae0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803ae4:	8b 50 0c             	mov    0xc(%rax),%edx
+  803ae7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803aeb:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803aed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803af1:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803af8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803afc:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803aff:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803b03:	89 d1                	mov    %edx,%ecx
+  803b05:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b0a:	48 89 c6             	mov    %rax,%rsi
+  803b0d:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b12:	48 b8 09 b6 ff ff ff 	movabs $0xffffffffffffb609,%rax
+  803b19:	ff ff ff 
+  803b1c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b20:	ff d0                	call   *%rax
+  803b22:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803b25:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803b28:	89 c6                	mov    %eax,%esi
+  803b2a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b2f:	48 89 c7             	mov    %rax,%rdi
+  803b32:	49 89 df             	mov    %rbx,%r15
+  803b35:	48 b8 6c e2 ff ff ff 	movabs $0xffffffffffffe26c,%rax
+  803b3c:	ff ff ff 
+  803b3f:	48 01 d8             	add    %rbx,%rax
+  803b42:	ff d0                	call   *%rax
+	return r;
+  803b44:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803b47:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803b4b:	5b                   	pop    %rbx
+  803b4c:	41 5f                	pop    %r15
+  803b4e:	5d                   	pop    %rbp
+  803b4f:	c3                   	ret
+
+0000000000803b50 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803b50:	55                   	push   %rbp
+  803b51:	48 89 e5             	mov    %rsp,%rbp
+  803b54:	41 57                	push   %r15
+  803b56:	53                   	push   %rbx
+  803b57:	48 83 ec 20          	sub    $0x20,%rsp
+  803b5b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b5b <devfile_stat+0xb>
+  803b62:	49 bb d5 44 00 00 00 	movabs $0x44d5,%r11
+  803b69:	00 00 00 
+  803b6c:	4c 01 db             	add    %r11,%rbx
+  803b6f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803b73:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803b77:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b7b:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b7e:	48 ba d0 4f 01 00 00 	movabs $0x14fd0,%rdx
+  803b85:	00 00 00 
+  803b88:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803b8b:	be 00 00 00 00       	mov    $0x0,%esi
+  803b90:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b95:	48 b8 cd b4 ff ff ff 	movabs $0xffffffffffffb4cd,%rax
+  803b9c:	ff ff ff 
+  803b9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ba3:	ff d0                	call   *%rax
+  803ba5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ba8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bac:	79 05                	jns    803bb3 <devfile_stat+0x63>
+		return r;
+  803bae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bb1:	eb 65                	jmp    803c18 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803bb3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bb7:	48 ba d0 4f 01 00 00 	movabs $0x14fd0,%rdx
+  803bbe:	00 00 00 
+  803bc1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803bc5:	48 89 d6             	mov    %rdx,%rsi
+  803bc8:	48 89 c7             	mov    %rax,%rdi
+  803bcb:	49 89 df             	mov    %rbx,%r15
+  803bce:	48 b8 69 94 ff ff ff 	movabs $0xffffffffffff9469,%rax
+  803bd5:	ff ff ff 
+  803bd8:	48 01 d8             	add    %rbx,%rax
+  803bdb:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803bdd:	48 b8 d0 4f 01 00 00 	movabs $0x14fd0,%rax
+  803be4:	00 00 00 
+  803be7:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803bee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bf2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803bf8:	48 b8 d0 4f 01 00 00 	movabs $0x14fd0,%rax
+  803bff:	00 00 00 
+  803c02:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803c09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c0d:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803c13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c18:	48 83 c4 20          	add    $0x20,%rsp
+  803c1c:	5b                   	pop    %rbx
+  803c1d:	41 5f                	pop    %r15
+  803c1f:	5d                   	pop    %rbp
+  803c20:	c3                   	ret
+
+0000000000803c21 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803c21:	55                   	push   %rbp
+  803c22:	48 89 e5             	mov    %rsp,%rbp
+  803c25:	48 83 ec 20          	sub    $0x20,%rsp
+  803c29:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c29 <devfile_trunc+0x8>
+  803c30:	49 bb 07 44 00 00 00 	movabs $0x4407,%r11
+  803c37:	00 00 00 
+  803c3a:	4c 01 d8             	add    %r11,%rax
+  803c3d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c41:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803c44:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803c48:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803c4b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803c4e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803c51:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803c54:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803c58:	ba 08 00 00 00       	mov    $0x8,%edx
+  803c5d:	48 89 ce             	mov    %rcx,%rsi
+  803c60:	bf 02 00 00 00       	mov    $0x2,%edi
+  803c65:	48 b9 75 b5 ff ff ff 	movabs $0xffffffffffffb575,%rcx
+  803c6c:	ff ff ff 
+  803c6f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803c73:	ff d0                	call   *%rax
+}
+  803c75:	c9                   	leave
+  803c76:	c3                   	ret
+
+0000000000803c77 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803c77:	55                   	push   %rbp
+  803c78:	48 89 e5             	mov    %rsp,%rbp
+  803c7b:	41 57                	push   %r15
+  803c7d:	53                   	push   %rbx
+  803c7e:	48 83 ec 10          	sub    $0x10,%rsp
+  803c82:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c82 <remove+0xb>
+  803c89:	49 bb ae 43 00 00 00 	movabs $0x43ae,%r11
+  803c90:	00 00 00 
+  803c93:	4c 01 db             	add    %r11,%rbx
+  803c96:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803c9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c9e:	48 89 c7             	mov    %rax,%rdi
+  803ca1:	49 89 df             	mov    %rbx,%r15
+  803ca4:	48 b8 d5 93 ff ff ff 	movabs $0xffffffffffff93d5,%rax
+  803cab:	ff ff ff 
+  803cae:	48 01 d8             	add    %rbx,%rax
+  803cb1:	ff d0                	call   *%rax
+  803cb3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803cb8:	7e 07                	jle    803cc1 <remove+0x4a>
+		return -E_BAD_PATH;
+  803cba:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803cbf:	eb 44                	jmp    803d05 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803cc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cc5:	48 89 c6             	mov    %rax,%rsi
+  803cc8:	48 b8 d0 4f 01 00 00 	movabs $0x14fd0,%rax
+  803ccf:	00 00 00 
+  803cd2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cd6:	48 89 c7             	mov    %rax,%rdi
+  803cd9:	49 89 df             	mov    %rbx,%r15
+  803cdc:	48 b8 69 94 ff ff ff 	movabs $0xffffffffffff9469,%rax
+  803ce3:	ff ff ff 
+  803ce6:	48 01 d8             	add    %rbx,%rax
+  803ce9:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803ceb:	be 00 00 00 00       	mov    $0x0,%esi
+  803cf0:	bf 07 00 00 00       	mov    $0x7,%edi
+  803cf5:	48 b8 cd b4 ff ff ff 	movabs $0xffffffffffffb4cd,%rax
+  803cfc:	ff ff ff 
+  803cff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d03:	ff d0                	call   *%rax
+}
+  803d05:	48 83 c4 10          	add    $0x10,%rsp
+  803d09:	5b                   	pop    %rbx
+  803d0a:	41 5f                	pop    %r15
+  803d0c:	5d                   	pop    %rbp
+  803d0d:	c3                   	ret
+
+0000000000803d0e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803d0e:	55                   	push   %rbp
+  803d0f:	48 89 e5             	mov    %rsp,%rbp
+  803d12:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d12 <sync+0x4>
+  803d19:	49 bb 1e 43 00 00 00 	movabs $0x431e,%r11
+  803d20:	00 00 00 
+  803d23:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803d26:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d2b:	be 00 00 00 00       	mov    $0x0,%esi
+  803d30:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d35:	48 b9 75 b5 ff ff ff 	movabs $0xffffffffffffb575,%rcx
+  803d3c:	ff ff ff 
+  803d3f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803d43:	ff d0                	call   *%rax
+}
+  803d45:	5d                   	pop    %rbp
+  803d46:	c3                   	ret
+
+0000000000803d47 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803d47:	55                   	push   %rbp
+  803d48:	48 89 e5             	mov    %rsp,%rbp
+  803d4b:	41 57                	push   %r15
+  803d4d:	53                   	push   %rbx
+  803d4e:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803d55:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d55 <copy+0xe>
+  803d5c:	49 bb db 42 00 00 00 	movabs $0x42db,%r11
+  803d63:	00 00 00 
+  803d66:	4c 01 db             	add    %r11,%rbx
+  803d69:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803d70:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803d77:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803d7e:	be 00 00 00 00       	mov    $0x0,%esi
+  803d83:	48 89 c7             	mov    %rax,%rdi
+  803d86:	48 b8 14 b7 ff ff ff 	movabs $0xffffffffffffb714,%rax
+  803d8d:	ff ff ff 
+  803d90:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d94:	ff d0                	call   *%rax
+  803d96:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803d99:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d9d:	79 35                	jns    803dd4 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803d9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803da2:	89 c6                	mov    %eax,%esi
+  803da4:	48 b8 46 e9 ff ff ff 	movabs $0xffffffffffffe946,%rax
+  803dab:	ff ff ff 
+  803dae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803db2:	48 89 c7             	mov    %rax,%rdi
+  803db5:	49 89 df             	mov    %rbx,%r15
+  803db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dbd:	48 ba a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%rdx
+  803dc4:	ff ff ff 
+  803dc7:	48 01 da             	add    %rbx,%rdx
+  803dca:	ff d2                	call   *%rdx
+		return fd_src;
+  803dcc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dcf:	e9 d7 01 00 00       	jmp    803fab <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803dd4:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803ddb:	be 01 01 00 00       	mov    $0x101,%esi
+  803de0:	48 89 c7             	mov    %rax,%rdi
+  803de3:	48 b8 14 b7 ff ff ff 	movabs $0xffffffffffffb714,%rax
+  803dea:	ff ff ff 
+  803ded:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803df1:	ff d0                	call   *%rax
+  803df3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803df6:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803dfa:	0f 89 df 00 00 00    	jns    803edf <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803e00:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e03:	89 c6                	mov    %eax,%esi
+  803e05:	48 b8 5c e9 ff ff ff 	movabs $0xffffffffffffe95c,%rax
+  803e0c:	ff ff ff 
+  803e0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e13:	48 89 c7             	mov    %rax,%rdi
+  803e16:	49 89 df             	mov    %rbx,%r15
+  803e19:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e1e:	48 ba a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%rdx
+  803e25:	ff ff ff 
+  803e28:	48 01 da             	add    %rbx,%rdx
+  803e2b:	ff d2                	call   *%rdx
+		close(fd_src);
+  803e2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e30:	89 c7                	mov    %eax,%edi
+  803e32:	49 89 df             	mov    %rbx,%r15
+  803e35:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  803e3c:	ff ff ff 
+  803e3f:	48 01 d8             	add    %rbx,%rax
+  803e42:	ff d0                	call   *%rax
+		return fd_dest;
+  803e44:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e47:	e9 5f 01 00 00       	jmp    803fab <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803e4c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803e4f:	48 63 d0             	movslq %eax,%rdx
+  803e52:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803e59:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e5c:	48 89 ce             	mov    %rcx,%rsi
+  803e5f:	89 c7                	mov    %eax,%edi
+  803e61:	49 89 df             	mov    %rbx,%r15
+  803e64:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  803e6b:	ff ff ff 
+  803e6e:	48 01 d8             	add    %rbx,%rax
+  803e71:	ff d0                	call   *%rax
+  803e73:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803e76:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803e7a:	79 63                	jns    803edf <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803e7c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803e7f:	89 c6                	mov    %eax,%esi
+  803e81:	48 b8 76 e9 ff ff ff 	movabs $0xffffffffffffe976,%rax
+  803e88:	ff ff ff 
+  803e8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e8f:	48 89 c7             	mov    %rax,%rdi
+  803e92:	49 89 df             	mov    %rbx,%r15
+  803e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e9a:	48 ba a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%rdx
+  803ea1:	ff ff ff 
+  803ea4:	48 01 da             	add    %rbx,%rdx
+  803ea7:	ff d2                	call   *%rdx
+			close(fd_src);
+  803ea9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803eac:	89 c7                	mov    %eax,%edi
+  803eae:	49 89 df             	mov    %rbx,%r15
+  803eb1:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  803eb8:	ff ff ff 
+  803ebb:	48 01 d8             	add    %rbx,%rax
+  803ebe:	ff d0                	call   *%rax
+			close(fd_dest);
+  803ec0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ec3:	89 c7                	mov    %eax,%edi
+  803ec5:	49 89 df             	mov    %rbx,%r15
+  803ec8:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  803ecf:	ff ff ff 
+  803ed2:	48 01 d8             	add    %rbx,%rax
+  803ed5:	ff d0                	call   *%rax
+			return write_size;
+  803ed7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803eda:	e9 cc 00 00 00       	jmp    803fab <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803edf:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803ee6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ee9:	ba 00 02 00 00       	mov    $0x200,%edx
+  803eee:	48 89 ce             	mov    %rcx,%rsi
+  803ef1:	89 c7                	mov    %eax,%edi
+  803ef3:	49 89 df             	mov    %rbx,%r15
+  803ef6:	48 b8 45 af ff ff ff 	movabs $0xffffffffffffaf45,%rax
+  803efd:	ff ff ff 
+  803f00:	48 01 d8             	add    %rbx,%rax
+  803f03:	ff d0                	call   *%rax
+  803f05:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803f08:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f0c:	0f 8f 3a ff ff ff    	jg     803e4c <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803f12:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f16:	79 60                	jns    803f78 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803f18:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f1b:	89 c6                	mov    %eax,%esi
+  803f1d:	48 b8 89 e9 ff ff ff 	movabs $0xffffffffffffe989,%rax
+  803f24:	ff ff ff 
+  803f27:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f2b:	48 89 c7             	mov    %rax,%rdi
+  803f2e:	49 89 df             	mov    %rbx,%r15
+  803f31:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f36:	48 ba a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%rdx
+  803f3d:	ff ff ff 
+  803f40:	48 01 da             	add    %rbx,%rdx
+  803f43:	ff d2                	call   *%rdx
+		close(fd_src);
+  803f45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f48:	89 c7                	mov    %eax,%edi
+  803f4a:	49 89 df             	mov    %rbx,%r15
+  803f4d:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  803f54:	ff ff ff 
+  803f57:	48 01 d8             	add    %rbx,%rax
+  803f5a:	ff d0                	call   *%rax
+		close(fd_dest);
+  803f5c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f5f:	89 c7                	mov    %eax,%edi
+  803f61:	49 89 df             	mov    %rbx,%r15
+  803f64:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  803f6b:	ff ff ff 
+  803f6e:	48 01 d8             	add    %rbx,%rax
+  803f71:	ff d0                	call   *%rax
+		return read_size;
+  803f73:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f76:	eb 33                	jmp    803fab <copy+0x264>
+	}
+	close(fd_src);
+  803f78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f7b:	89 c7                	mov    %eax,%edi
+  803f7d:	49 89 df             	mov    %rbx,%r15
+  803f80:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  803f87:	ff ff ff 
+  803f8a:	48 01 d8             	add    %rbx,%rax
+  803f8d:	ff d0                	call   *%rax
+	close(fd_dest);
+  803f8f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f92:	89 c7                	mov    %eax,%edi
+  803f94:	49 89 df             	mov    %rbx,%r15
+  803f97:	48 b8 8d ac ff ff ff 	movabs $0xffffffffffffac8d,%rax
+  803f9e:	ff ff ff 
+  803fa1:	48 01 d8             	add    %rbx,%rax
+  803fa4:	ff d0                	call   *%rax
+	return 0;
+  803fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803fab:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803fb2:	5b                   	pop    %rbx
+  803fb3:	41 5f                	pop    %r15
+  803fb5:	5d                   	pop    %rbp
+  803fb6:	c3                   	ret
+
+0000000000803fb7 <writebuf>:
+};
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  803fb7:	55                   	push   %rbp
+  803fb8:	48 89 e5             	mov    %rsp,%rbp
+  803fbb:	41 57                	push   %r15
+  803fbd:	48 83 ec 28          	sub    $0x28,%rsp
+  803fc1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803fc1 <writebuf+0xa>
+  803fc8:	49 bb 6f 40 00 00 00 	movabs $0x406f,%r11
+  803fcf:	00 00 00 
+  803fd2:	4c 01 d8             	add    %r11,%rax
+  803fd5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	if (b->error > 0) {
+  803fd9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fdd:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803fe0:	85 d2                	test   %edx,%edx
+  803fe2:	7e 68                	jle    80404c <writebuf+0x95>
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  803fe4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fe8:	8b 52 04             	mov    0x4(%rdx),%edx
+  803feb:	48 63 d2             	movslq %edx,%rdx
+  803fee:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803ff2:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  803ff6:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803ffa:	8b 09                	mov    (%rcx),%ecx
+  803ffc:	89 cf                	mov    %ecx,%edi
+  803ffe:	49 89 c7             	mov    %rax,%r15
+  804001:	48 b9 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rcx
+  804008:	ff ff ff 
+  80400b:	48 01 c1             	add    %rax,%rcx
+  80400e:	ff d1                	call   *%rcx
+  804010:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		if (result > 0)
+  804013:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804017:	7e 13                	jle    80402c <writebuf+0x75>
+			b->result += result;
+  804019:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80401d:	8b 50 08             	mov    0x8(%rax),%edx
+  804020:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804023:	01 c2                	add    %eax,%edx
+  804025:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804029:	89 50 08             	mov    %edx,0x8(%rax)
+		if (result != b->idx) // error, or wrote less than supplied
+  80402c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804030:	8b 40 04             	mov    0x4(%rax),%eax
+  804033:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804036:	74 14                	je     80404c <writebuf+0x95>
+			b->error = (result < 0 ? result : 0);
+  804038:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80403b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804040:	85 c0                	test   %eax,%eax
+  804042:	0f 4e d0             	cmovle %eax,%edx
+  804045:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804049:	89 50 0c             	mov    %edx,0xc(%rax)
+	}
+}
+  80404c:	90                   	nop
+  80404d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804051:	c9                   	leave
+  804052:	c3                   	ret
+
+0000000000804053 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  804053:	55                   	push   %rbp
+  804054:	48 89 e5             	mov    %rsp,%rbp
+  804057:	48 83 ec 20          	sub    $0x20,%rsp
+  80405b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80405b <putch+0x8>
+  804062:	49 bb d5 3f 00 00 00 	movabs $0x3fd5,%r11
+  804069:	00 00 00 
+  80406c:	4c 01 d8             	add    %r11,%rax
+  80406f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804072:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct printbuf *b = (struct printbuf *) thunk;
+  804076:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80407a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	b->buf[b->idx++] = ch;
+  80407e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804082:	8b 52 04             	mov    0x4(%rdx),%edx
+  804085:	8d 72 01             	lea    0x1(%rdx),%esi
+  804088:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80408c:	89 71 04             	mov    %esi,0x4(%rcx)
+  80408f:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  804092:	89 ce                	mov    %ecx,%esi
+  804094:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804098:	48 63 d2             	movslq %edx,%rdx
+  80409b:	40 88 74 11 10       	mov    %sil,0x10(%rcx,%rdx,1)
+	if (b->idx == 256) {
+  8040a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040a4:	8b 52 04             	mov    0x4(%rdx),%edx
+  8040a7:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8040ad:	75 22                	jne    8040d1 <putch+0x7e>
+		writebuf(b);
+  8040af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040b3:	48 89 d7             	mov    %rdx,%rdi
+  8040b6:	48 ba 87 bf ff ff ff 	movabs $0xffffffffffffbf87,%rdx
+  8040bd:	ff ff ff 
+  8040c0:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8040c4:	ff d0                	call   *%rax
+		b->idx = 0;
+  8040c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040ca:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+	}
+}
+  8040d1:	90                   	nop
+  8040d2:	c9                   	leave
+  8040d3:	c3                   	ret
+
+00000000008040d4 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8040d4:	55                   	push   %rbp
+  8040d5:	48 89 e5             	mov    %rsp,%rbp
+  8040d8:	41 57                	push   %r15
+  8040da:	53                   	push   %rbx
+  8040db:	48 81 ec 30 01 00 00 	sub    $0x130,%rsp
+  8040e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040e2 <vfprintf+0xe>
+  8040e9:	49 bb 4e 3f 00 00 00 	movabs $0x3f4e,%r11
+  8040f0:	00 00 00 
+  8040f3:	4c 01 db             	add    %r11,%rbx
+  8040f6:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  8040fc:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  804103:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+	struct printbuf b;
+
+	b.fd = fd;
+  80410a:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  804110:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+	b.idx = 0;
+  804116:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80411d:	00 00 00 
+	b.result = 0;
+  804120:	c7 85 e8 fe ff ff 00 	movl   $0x0,-0x118(%rbp)
+  804127:	00 00 00 
+	b.error = 1;
+  80412a:	c7 85 ec fe ff ff 01 	movl   $0x1,-0x114(%rbp)
+  804131:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  804134:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  80413b:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  804142:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804149:	48 89 c6             	mov    %rax,%rsi
+  80414c:	48 b8 23 c0 ff ff ff 	movabs $0xffffffffffffc023,%rax
+  804153:	ff ff ff 
+  804156:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80415a:	48 89 c7             	mov    %rax,%rdi
+  80415d:	49 89 df             	mov    %rbx,%r15
+  804160:	48 b8 eb 8a ff ff ff 	movabs $0xffffffffffff8aeb,%rax
+  804167:	ff ff ff 
+  80416a:	48 01 d8             	add    %rbx,%rax
+  80416d:	ff d0                	call   *%rax
+	if (b.idx > 0)
+  80416f:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  804175:	85 c0                	test   %eax,%eax
+  804177:	7e 1a                	jle    804193 <vfprintf+0xbf>
+		writebuf(&b);
+  804179:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804180:	48 89 c7             	mov    %rax,%rdi
+  804183:	48 b8 87 bf ff ff ff 	movabs $0xffffffffffffbf87,%rax
+  80418a:	ff ff ff 
+  80418d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804191:	ff d0                	call   *%rax
+
+	return (b.result ? b.result : b.error);
+  804193:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  804199:	85 c0                	test   %eax,%eax
+  80419b:	74 08                	je     8041a5 <vfprintf+0xd1>
+  80419d:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  8041a3:	eb 06                	jmp    8041ab <vfprintf+0xd7>
+  8041a5:	8b 85 ec fe ff ff    	mov    -0x114(%rbp),%eax
+}
+  8041ab:	48 81 c4 30 01 00 00 	add    $0x130,%rsp
+  8041b2:	5b                   	pop    %rbx
+  8041b3:	41 5f                	pop    %r15
+  8041b5:	5d                   	pop    %rbp
+  8041b6:	c3                   	ret
+
+00000000008041b7 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8041b7:	55                   	push   %rbp
+  8041b8:	48 89 e5             	mov    %rsp,%rbp
+  8041bb:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8041c2:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8041c2 <fprintf+0xb>
+  8041c9:	49 bb 6e 3e 00 00 00 	movabs $0x3e6e,%r11
+  8041d0:	00 00 00 
+  8041d3:	4d 01 da             	add    %r11,%r10
+  8041d6:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  8041dc:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8041e3:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8041ea:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8041f1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8041f8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8041ff:	84 c0                	test   %al,%al
+  804201:	74 20                	je     804223 <fprintf+0x6c>
+  804203:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804207:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80420b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80420f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804213:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804217:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80421b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80421f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  804223:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  80422a:	00 00 00 
+  80422d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804234:	00 00 00 
+  804237:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80423b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804242:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804249:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(fd, fmt, ap);
+  804250:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804257:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  80425e:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804264:	48 89 ce             	mov    %rcx,%rsi
+  804267:	89 c7                	mov    %eax,%edi
+  804269:	48 b8 a4 c0 ff ff ff 	movabs $0xffffffffffffc0a4,%rax
+  804270:	ff ff ff 
+  804273:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804277:	ff d0                	call   *%rax
+  804279:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  80427f:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804285:	c9                   	leave
+  804286:	c3                   	ret
+
+0000000000804287 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  804287:	55                   	push   %rbp
+  804288:	48 89 e5             	mov    %rsp,%rbp
+  80428b:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804292:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804292 <printf+0xb>
+  804299:	49 bb 9e 3d 00 00 00 	movabs $0x3d9e,%r11
+  8042a0:	00 00 00 
+  8042a3:	4d 01 da             	add    %r11,%r10
+  8042a6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8042ad:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8042b4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8042bb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8042c2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8042c9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8042d0:	84 c0                	test   %al,%al
+  8042d2:	74 20                	je     8042f4 <printf+0x6d>
+  8042d4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8042d8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8042dc:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8042e0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8042e4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8042e8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8042ec:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8042f0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8042f4:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8042fb:	00 00 00 
+  8042fe:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804305:	00 00 00 
+  804308:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80430c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804313:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80431a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(1, fmt, ap);
+  804321:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804328:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80432f:	48 89 c6             	mov    %rax,%rsi
+  804332:	bf 01 00 00 00       	mov    $0x1,%edi
+  804337:	48 b8 a4 c0 ff ff ff 	movabs $0xffffffffffffc0a4,%rax
+  80433e:	ff ff ff 
+  804341:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804345:	ff d0                	call   *%rax
+  804347:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  80434d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804353:	c9                   	leave
+  804354:	c3                   	ret
+
+0000000000804355 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804355:	55                   	push   %rbp
+  804356:	48 89 e5             	mov    %rsp,%rbp
+  804359:	41 57                	push   %r15
+  80435b:	53                   	push   %rbx
+  80435c:	48 83 ec 20          	sub    $0x20,%rsp
+  804360:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804360 <fd2sockid+0xb>
+  804367:	49 bb d0 3c 00 00 00 	movabs $0x3cd0,%r11
+  80436e:	00 00 00 
+  804371:	4c 01 db             	add    %r11,%rbx
+  804374:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804377:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80437b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80437e:	48 89 d6             	mov    %rdx,%rsi
+  804381:	89 c7                	mov    %eax,%edi
+  804383:	49 89 df             	mov    %rbx,%r15
+  804386:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  80438d:	ff ff ff 
+  804390:	48 01 d8             	add    %rbx,%rax
+  804393:	ff d0                	call   *%rax
+  804395:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804398:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80439c:	79 05                	jns    8043a3 <fd2sockid+0x4e>
+		return r;
+  80439e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043a1:	eb 25                	jmp    8043c8 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8043a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043a7:	8b 10                	mov    (%rax),%edx
+  8043a9:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  8043b0:	00 00 00 
+  8043b3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8043b6:	39 c2                	cmp    %eax,%edx
+  8043b8:	74 07                	je     8043c1 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8043ba:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8043bf:	eb 07                	jmp    8043c8 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8043c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043c5:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8043c8:	48 83 c4 20          	add    $0x20,%rsp
+  8043cc:	5b                   	pop    %rbx
+  8043cd:	41 5f                	pop    %r15
+  8043cf:	5d                   	pop    %rbp
+  8043d0:	c3                   	ret
+
+00000000008043d1 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8043d1:	55                   	push   %rbp
+  8043d2:	48 89 e5             	mov    %rsp,%rbp
+  8043d5:	41 57                	push   %r15
+  8043d7:	53                   	push   %rbx
+  8043d8:	48 83 ec 20          	sub    $0x20,%rsp
+  8043dc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043dc <alloc_sockfd+0xb>
+  8043e3:	49 bb 54 3c 00 00 00 	movabs $0x3c54,%r11
+  8043ea:	00 00 00 
+  8043ed:	4c 01 db             	add    %r11,%rbx
+  8043f0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8043f3:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8043f7:	48 89 c7             	mov    %rax,%rdi
+  8043fa:	49 89 df             	mov    %rbx,%r15
+  8043fd:	48 b8 48 a9 ff ff ff 	movabs $0xffffffffffffa948,%rax
+  804404:	ff ff ff 
+  804407:	48 01 d8             	add    %rbx,%rax
+  80440a:	ff d0                	call   *%rax
+  80440c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80440f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804413:	78 2c                	js     804441 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804415:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804419:	ba 07 04 00 00       	mov    $0x407,%edx
+  80441e:	48 89 c6             	mov    %rax,%rsi
+  804421:	bf 00 00 00 00       	mov    $0x0,%edi
+  804426:	49 89 df             	mov    %rbx,%r15
+  804429:	48 b8 25 a1 ff ff ff 	movabs $0xffffffffffffa125,%rax
+  804430:	ff ff ff 
+  804433:	48 01 d8             	add    %rbx,%rax
+  804436:	ff d0                	call   *%rax
+  804438:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80443b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80443f:	79 1c                	jns    80445d <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804441:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804444:	89 c7                	mov    %eax,%edi
+  804446:	49 89 df             	mov    %rbx,%r15
+  804449:	48 b8 95 cb ff ff ff 	movabs $0xffffffffffffcb95,%rax
+  804450:	ff ff ff 
+  804453:	48 01 d8             	add    %rbx,%rax
+  804456:	ff d0                	call   *%rax
+		return r;
+  804458:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80445b:	eb 41                	jmp    80449e <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80445d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804461:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  804468:	00 00 00 
+  80446b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80446e:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804470:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804474:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80447b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80447f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804482:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804485:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804489:	48 89 c7             	mov    %rax,%rdi
+  80448c:	49 89 df             	mov    %rbx,%r15
+  80448f:	48 b8 ce a8 ff ff ff 	movabs $0xffffffffffffa8ce,%rax
+  804496:	ff ff ff 
+  804499:	48 01 d8             	add    %rbx,%rax
+  80449c:	ff d0                	call   *%rax
+}
+  80449e:	48 83 c4 20          	add    $0x20,%rsp
+  8044a2:	5b                   	pop    %rbx
+  8044a3:	41 5f                	pop    %r15
+  8044a5:	5d                   	pop    %rbp
+  8044a6:	c3                   	ret
+
+00000000008044a7 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8044a7:	55                   	push   %rbp
+  8044a8:	48 89 e5             	mov    %rsp,%rbp
+  8044ab:	41 57                	push   %r15
+  8044ad:	53                   	push   %rbx
+  8044ae:	48 83 ec 30          	sub    $0x30,%rsp
+  8044b2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044b2 <accept+0xb>
+  8044b9:	49 bb 7e 3b 00 00 00 	movabs $0x3b7e,%r11
+  8044c0:	00 00 00 
+  8044c3:	4c 01 db             	add    %r11,%rbx
+  8044c6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8044c9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8044cd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8044d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044d4:	89 c7                	mov    %eax,%edi
+  8044d6:	48 b8 25 c3 ff ff ff 	movabs $0xffffffffffffc325,%rax
+  8044dd:	ff ff ff 
+  8044e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044e4:	ff d0                	call   *%rax
+  8044e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044ed:	79 05                	jns    8044f4 <accept+0x4d>
+		return r;
+  8044ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044f2:	eb 45                	jmp    804539 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8044f4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044f8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8044fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044ff:	48 89 ce             	mov    %rcx,%rsi
+  804502:	89 c7                	mov    %eax,%edi
+  804504:	49 89 df             	mov    %rbx,%r15
+  804507:	48 b8 03 ca ff ff ff 	movabs $0xffffffffffffca03,%rax
+  80450e:	ff ff ff 
+  804511:	48 01 d8             	add    %rbx,%rax
+  804514:	ff d0                	call   *%rax
+  804516:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804519:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80451d:	79 05                	jns    804524 <accept+0x7d>
+		return r;
+  80451f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804522:	eb 15                	jmp    804539 <accept+0x92>
+	return alloc_sockfd(r);
+  804524:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804527:	89 c7                	mov    %eax,%edi
+  804529:	48 b8 a1 c3 ff ff ff 	movabs $0xffffffffffffc3a1,%rax
+  804530:	ff ff ff 
+  804533:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804537:	ff d0                	call   *%rax
+}
+  804539:	48 83 c4 30          	add    $0x30,%rsp
+  80453d:	5b                   	pop    %rbx
+  80453e:	41 5f                	pop    %r15
+  804540:	5d                   	pop    %rbp
+  804541:	c3                   	ret
+
+0000000000804542 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804542:	55                   	push   %rbp
+  804543:	48 89 e5             	mov    %rsp,%rbp
+  804546:	41 57                	push   %r15
+  804548:	53                   	push   %rbx
+  804549:	48 83 ec 20          	sub    $0x20,%rsp
+  80454d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80454d <bind+0xb>
+  804554:	49 bb e3 3a 00 00 00 	movabs $0x3ae3,%r11
+  80455b:	00 00 00 
+  80455e:	4c 01 db             	add    %r11,%rbx
+  804561:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804564:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804568:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80456b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80456e:	89 c7                	mov    %eax,%edi
+  804570:	48 b8 25 c3 ff ff ff 	movabs $0xffffffffffffc325,%rax
+  804577:	ff ff ff 
+  80457a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80457e:	ff d0                	call   *%rax
+  804580:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804583:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804587:	79 05                	jns    80458e <bind+0x4c>
+		return r;
+  804589:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80458c:	eb 21                	jmp    8045af <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80458e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804591:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804595:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804598:	48 89 ce             	mov    %rcx,%rsi
+  80459b:	89 c7                	mov    %eax,%edi
+  80459d:	49 89 df             	mov    %rbx,%r15
+  8045a0:	48 b8 af ca ff ff ff 	movabs $0xffffffffffffcaaf,%rax
+  8045a7:	ff ff ff 
+  8045aa:	48 01 d8             	add    %rbx,%rax
+  8045ad:	ff d0                	call   *%rax
+}
+  8045af:	48 83 c4 20          	add    $0x20,%rsp
+  8045b3:	5b                   	pop    %rbx
+  8045b4:	41 5f                	pop    %r15
+  8045b6:	5d                   	pop    %rbp
+  8045b7:	c3                   	ret
+
+00000000008045b8 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8045b8:	55                   	push   %rbp
+  8045b9:	48 89 e5             	mov    %rsp,%rbp
+  8045bc:	41 57                	push   %r15
+  8045be:	53                   	push   %rbx
+  8045bf:	48 83 ec 20          	sub    $0x20,%rsp
+  8045c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045c3 <shutdown+0xb>
+  8045ca:	49 bb 6d 3a 00 00 00 	movabs $0x3a6d,%r11
+  8045d1:	00 00 00 
+  8045d4:	4c 01 db             	add    %r11,%rbx
+  8045d7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8045da:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8045dd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045e0:	89 c7                	mov    %eax,%edi
+  8045e2:	48 b8 25 c3 ff ff ff 	movabs $0xffffffffffffc325,%rax
+  8045e9:	ff ff ff 
+  8045ec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045f0:	ff d0                	call   *%rax
+  8045f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8045f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045f9:	79 05                	jns    804600 <shutdown+0x48>
+		return r;
+  8045fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045fe:	eb 1c                	jmp    80461c <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804600:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804603:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804606:	89 d6                	mov    %edx,%esi
+  804608:	89 c7                	mov    %eax,%edi
+  80460a:	49 89 df             	mov    %rbx,%r15
+  80460d:	48 b8 44 cb ff ff ff 	movabs $0xffffffffffffcb44,%rax
+  804614:	ff ff ff 
+  804617:	48 01 d8             	add    %rbx,%rax
+  80461a:	ff d0                	call   *%rax
+}
+  80461c:	48 83 c4 20          	add    $0x20,%rsp
+  804620:	5b                   	pop    %rbx
+  804621:	41 5f                	pop    %r15
+  804623:	5d                   	pop    %rbp
+  804624:	c3                   	ret
+
+0000000000804625 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804625:	55                   	push   %rbp
+  804626:	48 89 e5             	mov    %rsp,%rbp
+  804629:	41 57                	push   %r15
+  80462b:	53                   	push   %rbx
+  80462c:	48 83 ec 10          	sub    $0x10,%rsp
+  804630:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804630 <devsock_close+0xb>
+  804637:	49 bb 00 3a 00 00 00 	movabs $0x3a00,%r11
+  80463e:	00 00 00 
+  804641:	4c 01 db             	add    %r11,%rbx
+  804644:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80464c:	48 89 c7             	mov    %rax,%rdi
+  80464f:	49 89 df             	mov    %rbx,%r15
+  804652:	48 b8 41 e3 ff ff ff 	movabs $0xffffffffffffe341,%rax
+  804659:	ff ff ff 
+  80465c:	48 01 d8             	add    %rbx,%rax
+  80465f:	ff d0                	call   *%rax
+  804661:	83 f8 01             	cmp    $0x1,%eax
+  804664:	75 1d                	jne    804683 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804666:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80466a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80466d:	89 c7                	mov    %eax,%edi
+  80466f:	49 89 df             	mov    %rbx,%r15
+  804672:	48 b8 95 cb ff ff ff 	movabs $0xffffffffffffcb95,%rax
+  804679:	ff ff ff 
+  80467c:	48 01 d8             	add    %rbx,%rax
+  80467f:	ff d0                	call   *%rax
+  804681:	eb 05                	jmp    804688 <devsock_close+0x63>
+	else
+		return 0;
+  804683:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804688:	48 83 c4 10          	add    $0x10,%rsp
+  80468c:	5b                   	pop    %rbx
+  80468d:	41 5f                	pop    %r15
+  80468f:	5d                   	pop    %rbp
+  804690:	c3                   	ret
+
+0000000000804691 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804691:	55                   	push   %rbp
+  804692:	48 89 e5             	mov    %rsp,%rbp
+  804695:	41 57                	push   %r15
+  804697:	53                   	push   %rbx
+  804698:	48 83 ec 20          	sub    $0x20,%rsp
+  80469c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80469c <connect+0xb>
+  8046a3:	49 bb 94 39 00 00 00 	movabs $0x3994,%r11
+  8046aa:	00 00 00 
+  8046ad:	4c 01 db             	add    %r11,%rbx
+  8046b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8046b3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8046b7:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8046ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046bd:	89 c7                	mov    %eax,%edi
+  8046bf:	48 b8 25 c3 ff ff ff 	movabs $0xffffffffffffc325,%rax
+  8046c6:	ff ff ff 
+  8046c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046cd:	ff d0                	call   *%rax
+  8046cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046d6:	79 05                	jns    8046dd <connect+0x4c>
+		return r;
+  8046d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046db:	eb 21                	jmp    8046fe <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8046dd:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8046e0:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8046e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046e7:	48 89 ce             	mov    %rcx,%rsi
+  8046ea:	89 c7                	mov    %eax,%edi
+  8046ec:	49 89 df             	mov    %rbx,%r15
+  8046ef:	48 b8 dd cb ff ff ff 	movabs $0xffffffffffffcbdd,%rax
+  8046f6:	ff ff ff 
+  8046f9:	48 01 d8             	add    %rbx,%rax
+  8046fc:	ff d0                	call   *%rax
+}
+  8046fe:	48 83 c4 20          	add    $0x20,%rsp
+  804702:	5b                   	pop    %rbx
+  804703:	41 5f                	pop    %r15
+  804705:	5d                   	pop    %rbp
+  804706:	c3                   	ret
+
+0000000000804707 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804707:	55                   	push   %rbp
+  804708:	48 89 e5             	mov    %rsp,%rbp
+  80470b:	41 57                	push   %r15
+  80470d:	53                   	push   %rbx
+  80470e:	48 83 ec 20          	sub    $0x20,%rsp
+  804712:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804712 <listen+0xb>
+  804719:	49 bb 1e 39 00 00 00 	movabs $0x391e,%r11
+  804720:	00 00 00 
+  804723:	4c 01 db             	add    %r11,%rbx
+  804726:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804729:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80472c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80472f:	89 c7                	mov    %eax,%edi
+  804731:	48 b8 25 c3 ff ff ff 	movabs $0xffffffffffffc325,%rax
+  804738:	ff ff ff 
+  80473b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80473f:	ff d0                	call   *%rax
+  804741:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804744:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804748:	79 05                	jns    80474f <listen+0x48>
+		return r;
+  80474a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80474d:	eb 1c                	jmp    80476b <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80474f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804752:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804755:	89 d6                	mov    %edx,%esi
+  804757:	89 c7                	mov    %eax,%edi
+  804759:	49 89 df             	mov    %rbx,%r15
+  80475c:	48 b8 72 cc ff ff ff 	movabs $0xffffffffffffcc72,%rax
+  804763:	ff ff ff 
+  804766:	48 01 d8             	add    %rbx,%rax
+  804769:	ff d0                	call   *%rax
+}
+  80476b:	48 83 c4 20          	add    $0x20,%rsp
+  80476f:	5b                   	pop    %rbx
+  804770:	41 5f                	pop    %r15
+  804772:	5d                   	pop    %rbp
+  804773:	c3                   	ret
+
+0000000000804774 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804774:	55                   	push   %rbp
+  804775:	48 89 e5             	mov    %rsp,%rbp
+  804778:	41 57                	push   %r15
+  80477a:	48 83 ec 28          	sub    $0x28,%rsp
+  80477e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80477e <devsock_read+0xa>
+  804785:	49 bb b2 38 00 00 00 	movabs $0x38b2,%r11
+  80478c:	00 00 00 
+  80478f:	4c 01 d8             	add    %r11,%rax
+  804792:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804796:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80479a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80479e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8047a2:	41 89 d0             	mov    %edx,%r8d
+  8047a5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8047a9:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8047ac:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8047b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8047b5:	44 89 c2             	mov    %r8d,%edx
+  8047b8:	49 89 c7             	mov    %rax,%r15
+  8047bb:	49 b8 c3 cc ff ff ff 	movabs $0xffffffffffffccc3,%r8
+  8047c2:	ff ff ff 
+  8047c5:	49 01 c0             	add    %rax,%r8
+  8047c8:	41 ff d0             	call   *%r8
+}
+  8047cb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8047cf:	c9                   	leave
+  8047d0:	c3                   	ret
+
+00000000008047d1 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8047d1:	55                   	push   %rbp
+  8047d2:	48 89 e5             	mov    %rsp,%rbp
+  8047d5:	41 57                	push   %r15
+  8047d7:	48 83 ec 28          	sub    $0x28,%rsp
+  8047db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8047db <devsock_write+0xa>
+  8047e2:	49 bb 55 38 00 00 00 	movabs $0x3855,%r11
+  8047e9:	00 00 00 
+  8047ec:	4c 01 d8             	add    %r11,%rax
+  8047ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8047f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8047f7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8047fb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8047ff:	41 89 d0             	mov    %edx,%r8d
+  804802:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804806:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804809:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80480d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804812:	44 89 c2             	mov    %r8d,%edx
+  804815:	49 89 c7             	mov    %rax,%r15
+  804818:	49 b8 e0 cd ff ff ff 	movabs $0xffffffffffffcde0,%r8
+  80481f:	ff ff ff 
+  804822:	49 01 c0             	add    %rax,%r8
+  804825:	41 ff d0             	call   *%r8
+}
+  804828:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80482c:	c9                   	leave
+  80482d:	c3                   	ret
+
+000000000080482e <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80482e:	55                   	push   %rbp
+  80482f:	48 89 e5             	mov    %rsp,%rbp
+  804832:	41 57                	push   %r15
+  804834:	48 83 ec 18          	sub    $0x18,%rsp
+  804838:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804838 <devsock_stat+0xa>
+  80483f:	49 bb f8 37 00 00 00 	movabs $0x37f8,%r11
+  804846:	00 00 00 
+  804849:	4c 01 d8             	add    %r11,%rax
+  80484c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804850:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804854:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804858:	48 b9 a4 e9 ff ff ff 	movabs $0xffffffffffffe9a4,%rcx
+  80485f:	ff ff ff 
+  804862:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804866:	48 89 ce             	mov    %rcx,%rsi
+  804869:	48 89 d7             	mov    %rdx,%rdi
+  80486c:	49 89 c7             	mov    %rax,%r15
+  80486f:	48 ba 69 94 ff ff ff 	movabs $0xffffffffffff9469,%rdx
+  804876:	ff ff ff 
+  804879:	48 01 c2             	add    %rax,%rdx
+  80487c:	ff d2                	call   *%rdx
+	return 0;
+  80487e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804883:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804887:	c9                   	leave
+  804888:	c3                   	ret
+
+0000000000804889 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804889:	55                   	push   %rbp
+  80488a:	48 89 e5             	mov    %rsp,%rbp
+  80488d:	41 57                	push   %r15
+  80488f:	53                   	push   %rbx
+  804890:	48 83 ec 20          	sub    $0x20,%rsp
+  804894:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804894 <socket+0xb>
+  80489b:	49 bb 9c 37 00 00 00 	movabs $0x379c,%r11
+  8048a2:	00 00 00 
+  8048a5:	4c 01 db             	add    %r11,%rbx
+  8048a8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8048ab:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8048ae:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8048b1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8048b4:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8048b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048ba:	89 ce                	mov    %ecx,%esi
+  8048bc:	89 c7                	mov    %eax,%edi
+  8048be:	49 89 df             	mov    %rbx,%r15
+  8048c1:	48 b8 b7 cf ff ff ff 	movabs $0xffffffffffffcfb7,%rax
+  8048c8:	ff ff ff 
+  8048cb:	48 01 d8             	add    %rbx,%rax
+  8048ce:	ff d0                	call   *%rax
+  8048d0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048d7:	79 05                	jns    8048de <socket+0x55>
+		return r;
+  8048d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048dc:	eb 15                	jmp    8048f3 <socket+0x6a>
+	return alloc_sockfd(r);
+  8048de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048e1:	89 c7                	mov    %eax,%edi
+  8048e3:	48 b8 a1 c3 ff ff ff 	movabs $0xffffffffffffc3a1,%rax
+  8048ea:	ff ff ff 
+  8048ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048f1:	ff d0                	call   *%rax
+}
+  8048f3:	48 83 c4 20          	add    $0x20,%rsp
+  8048f7:	5b                   	pop    %rbx
+  8048f8:	41 5f                	pop    %r15
+  8048fa:	5d                   	pop    %rbp
+  8048fb:	c3                   	ret
+
+00000000008048fc <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8048fc:	55                   	push   %rbp
+  8048fd:	48 89 e5             	mov    %rsp,%rbp
+  804900:	41 57                	push   %r15
+  804902:	53                   	push   %rbx
+  804903:	48 83 ec 10          	sub    $0x10,%rsp
+  804907:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804907 <nsipc+0xb>
+  80490e:	49 bb 29 37 00 00 00 	movabs $0x3729,%r11
+  804915:	00 00 00 
+  804918:	4c 01 db             	add    %r11,%rbx
+  80491b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  80491e:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804925:	00 00 00 
+  804928:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80492b:	85 c0                	test   %eax,%eax
+  80492d:	75 24                	jne    804953 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80492f:	bf 02 00 00 00       	mov    $0x2,%edi
+  804934:	49 89 df             	mov    %rbx,%r15
+  804937:	48 b8 b2 e2 ff ff ff 	movabs $0xffffffffffffe2b2,%rax
+  80493e:	ff ff ff 
+  804941:	48 01 d8             	add    %rbx,%rax
+  804944:	ff d0                	call   *%rax
+  804946:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  80494d:	00 00 00 
+  804950:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804953:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80495a:	00 00 00 
+  80495d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804960:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804963:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804969:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80496f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804974:	48 ba d0 5f 01 00 00 	movabs $0x15fd0,%rdx
+  80497b:	00 00 00 
+  80497e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804982:	89 c7                	mov    %eax,%edi
+  804984:	49 89 df             	mov    %rbx,%r15
+  804987:	48 b8 d1 dc ff ff ff 	movabs $0xffffffffffffdcd1,%rax
+  80498e:	ff ff ff 
+  804991:	48 01 d8             	add    %rbx,%rax
+  804994:	ff d0                	call   *%rax
+}
+  804996:	48 83 c4 10          	add    $0x10,%rsp
+  80499a:	5b                   	pop    %rbx
+  80499b:	41 5f                	pop    %r15
+  80499d:	5d                   	pop    %rbp
+  80499e:	c3                   	ret
+
+000000000080499f <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  80499f:	55                   	push   %rbp
+  8049a0:	48 89 e5             	mov    %rsp,%rbp
+  8049a3:	41 57                	push   %r15
+  8049a5:	53                   	push   %rbx
+  8049a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8049aa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049aa <nsipc_words+0xb>
+  8049b1:	49 bb 86 36 00 00 00 	movabs $0x3686,%r11
+  8049b8:	00 00 00 
+  8049bb:	4c 01 db             	add    %r11,%rbx
+  8049be:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8049c1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8049c5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8049c9:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8049d0:	00 00 00 
+  8049d3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049d6:	85 c0                	test   %eax,%eax
+  8049d8:	75 24                	jne    8049fe <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8049da:	bf 02 00 00 00       	mov    $0x2,%edi
+  8049df:	49 89 df             	mov    %rbx,%r15
+  8049e2:	48 b8 b2 e2 ff ff ff 	movabs $0xffffffffffffe2b2,%rax
+  8049e9:	ff ff ff 
+  8049ec:	48 01 d8             	add    %rbx,%rax
+  8049ef:	ff d0                	call   *%rax
+  8049f1:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8049f8:	00 00 00 
+  8049fb:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8049fe:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804a05:	00 00 00 
+  804a08:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a0b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804a0f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a13:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804a16:	89 c7                	mov    %eax,%edi
+  804a18:	49 89 df             	mov    %rbx,%r15
+  804a1b:	48 b8 bc dd ff ff ff 	movabs $0xffffffffffffddbc,%rax
+  804a22:	ff ff ff 
+  804a25:	48 01 d8             	add    %rbx,%rax
+  804a28:	ff d0                	call   *%rax
+}
+  804a2a:	48 83 c4 20          	add    $0x20,%rsp
+  804a2e:	5b                   	pop    %rbx
+  804a2f:	41 5f                	pop    %r15
+  804a31:	5d                   	pop    %rbp
+  804a32:	c3                   	ret
+
+0000000000804a33 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804a33:	55                   	push   %rbp
+  804a34:	48 89 e5             	mov    %rsp,%rbp
+  804a37:	41 57                	push   %r15
+  804a39:	53                   	push   %rbx
+  804a3a:	48 83 ec 30          	sub    $0x30,%rsp
+  804a3e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a3e <nsipc_accept+0xb>
+  804a45:	49 bb f2 35 00 00 00 	movabs $0x35f2,%r11
+  804a4c:	00 00 00 
+  804a4f:	4c 01 db             	add    %r11,%rbx
+  804a52:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804a55:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a59:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  804a5d:	48 ba d0 5f 01 00 00 	movabs $0x15fd0,%rdx
+  804a64:	00 00 00 
+  804a67:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a6a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  804a6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a72:	48 b8 cc c8 ff ff ff 	movabs $0xffffffffffffc8cc,%rax
+  804a79:	ff ff ff 
+  804a7c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a80:	ff d0                	call   *%rax
+  804a82:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a85:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a89:	78 48                	js     804ad3 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  804a8b:	48 b8 d0 5f 01 00 00 	movabs $0x15fd0,%rax
+  804a92:	00 00 00 
+  804a95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a99:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804a9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804aa1:	8b 40 10             	mov    0x10(%rax),%eax
+  804aa4:	89 c2                	mov    %eax,%edx
+  804aa6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804aaa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804aae:	48 89 ce             	mov    %rcx,%rsi
+  804ab1:	48 89 c7             	mov    %rax,%rdi
+  804ab4:	49 89 df             	mov    %rbx,%r15
+  804ab7:	48 b8 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rax
+  804abe:	ff ff ff 
+  804ac1:	48 01 d8             	add    %rbx,%rax
+  804ac4:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  804ac6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804aca:	8b 50 10             	mov    0x10(%rax),%edx
+  804acd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ad1:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  804ad3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804ad6:	48 83 c4 30          	add    $0x30,%rsp
+  804ada:	5b                   	pop    %rbx
+  804adb:	41 5f                	pop    %r15
+  804add:	5d                   	pop    %rbp
+  804ade:	c3                   	ret
+
+0000000000804adf <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804adf:	55                   	push   %rbp
+  804ae0:	48 89 e5             	mov    %rsp,%rbp
+  804ae3:	41 57                	push   %r15
+  804ae5:	53                   	push   %rbx
+  804ae6:	48 83 ec 10          	sub    $0x10,%rsp
+  804aea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804aea <nsipc_bind+0xb>
+  804af1:	49 bb 46 35 00 00 00 	movabs $0x3546,%r11
+  804af8:	00 00 00 
+  804afb:	4c 01 db             	add    %r11,%rbx
+  804afe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804b01:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804b05:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  804b08:	48 ba d0 5f 01 00 00 	movabs $0x15fd0,%rdx
+  804b0f:	00 00 00 
+  804b12:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b15:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804b18:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804b1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b1f:	48 89 c6             	mov    %rax,%rsi
+  804b22:	48 b8 d4 5f 01 00 00 	movabs $0x15fd4,%rax
+  804b29:	00 00 00 
+  804b2c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b30:	48 89 c7             	mov    %rax,%rdi
+  804b33:	49 89 df             	mov    %rbx,%r15
+  804b36:	48 b8 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rax
+  804b3d:	ff ff ff 
+  804b40:	48 01 d8             	add    %rbx,%rax
+  804b43:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804b45:	48 ba d0 5f 01 00 00 	movabs $0x15fd0,%rdx
+  804b4c:	00 00 00 
+  804b4f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b52:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804b56:	bf 02 00 00 00       	mov    $0x2,%edi
+  804b5b:	48 b8 cc c8 ff ff ff 	movabs $0xffffffffffffc8cc,%rax
+  804b62:	ff ff ff 
+  804b65:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b69:	ff d0                	call   *%rax
+}
+  804b6b:	48 83 c4 10          	add    $0x10,%rsp
+  804b6f:	5b                   	pop    %rbx
+  804b70:	41 5f                	pop    %r15
+  804b72:	5d                   	pop    %rbp
+  804b73:	c3                   	ret
+
+0000000000804b74 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804b74:	55                   	push   %rbp
+  804b75:	48 89 e5             	mov    %rsp,%rbp
+  804b78:	48 83 ec 20          	sub    $0x20,%rsp
+  804b7c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804b7c <nsipc_shutdown+0x8>
+  804b83:	49 bb b4 34 00 00 00 	movabs $0x34b4,%r11
+  804b8a:	00 00 00 
+  804b8d:	4c 01 d8             	add    %r11,%rax
+  804b90:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804b93:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  804b96:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804b99:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  804b9c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804b9f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  804ba2:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804ba6:	ba 08 00 00 00       	mov    $0x8,%edx
+  804bab:	48 89 ce             	mov    %rcx,%rsi
+  804bae:	bf 03 00 00 00       	mov    $0x3,%edi
+  804bb3:	48 b9 6f c9 ff ff ff 	movabs $0xffffffffffffc96f,%rcx
+  804bba:	ff ff ff 
+  804bbd:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804bc1:	ff d0                	call   *%rax
+}
+  804bc3:	c9                   	leave
+  804bc4:	c3                   	ret
+
+0000000000804bc5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  804bc5:	55                   	push   %rbp
+  804bc6:	48 89 e5             	mov    %rsp,%rbp
+  804bc9:	48 83 ec 20          	sub    $0x20,%rsp
+  804bcd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804bcd <nsipc_close+0x8>
+  804bd4:	49 bb 63 34 00 00 00 	movabs $0x3463,%r11
+  804bdb:	00 00 00 
+  804bde:	4c 01 d8             	add    %r11,%rax
+  804be1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  804be4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804be7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  804bea:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804bee:	ba 04 00 00 00       	mov    $0x4,%edx
+  804bf3:	48 89 ce             	mov    %rcx,%rsi
+  804bf6:	bf 04 00 00 00       	mov    $0x4,%edi
+  804bfb:	48 b9 6f c9 ff ff ff 	movabs $0xffffffffffffc96f,%rcx
+  804c02:	ff ff ff 
+  804c05:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804c09:	ff d0                	call   *%rax
+}
+  804c0b:	c9                   	leave
+  804c0c:	c3                   	ret
+
+0000000000804c0d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804c0d:	55                   	push   %rbp
+  804c0e:	48 89 e5             	mov    %rsp,%rbp
+  804c11:	41 57                	push   %r15
+  804c13:	53                   	push   %rbx
+  804c14:	48 83 ec 10          	sub    $0x10,%rsp
+  804c18:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c18 <nsipc_connect+0xb>
+  804c1f:	49 bb 18 34 00 00 00 	movabs $0x3418,%r11
+  804c26:	00 00 00 
+  804c29:	4c 01 db             	add    %r11,%rbx
+  804c2c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804c2f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c33:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804c36:	48 ba d0 5f 01 00 00 	movabs $0x15fd0,%rdx
+  804c3d:	00 00 00 
+  804c40:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c43:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804c46:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804c49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c4d:	48 89 c6             	mov    %rax,%rsi
+  804c50:	48 b8 d4 5f 01 00 00 	movabs $0x15fd4,%rax
+  804c57:	00 00 00 
+  804c5a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c5e:	48 89 c7             	mov    %rax,%rdi
+  804c61:	49 89 df             	mov    %rbx,%r15
+  804c64:	48 b8 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rax
+  804c6b:	ff ff ff 
+  804c6e:	48 01 d8             	add    %rbx,%rax
+  804c71:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  804c73:	48 ba d0 5f 01 00 00 	movabs $0x15fd0,%rdx
+  804c7a:	00 00 00 
+  804c7d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c80:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  804c84:	bf 05 00 00 00       	mov    $0x5,%edi
+  804c89:	48 b8 cc c8 ff ff ff 	movabs $0xffffffffffffc8cc,%rax
+  804c90:	ff ff ff 
+  804c93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c97:	ff d0                	call   *%rax
+}
+  804c99:	48 83 c4 10          	add    $0x10,%rsp
+  804c9d:	5b                   	pop    %rbx
+  804c9e:	41 5f                	pop    %r15
+  804ca0:	5d                   	pop    %rbp
+  804ca1:	c3                   	ret
+
+0000000000804ca2 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804ca2:	55                   	push   %rbp
+  804ca3:	48 89 e5             	mov    %rsp,%rbp
+  804ca6:	48 83 ec 20          	sub    $0x20,%rsp
+  804caa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804caa <nsipc_listen+0x8>
+  804cb1:	49 bb 86 33 00 00 00 	movabs $0x3386,%r11
+  804cb8:	00 00 00 
+  804cbb:	4c 01 d8             	add    %r11,%rax
+  804cbe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804cc1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804cc4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804cc7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  804cca:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804ccd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804cd0:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804cd4:	ba 08 00 00 00       	mov    $0x8,%edx
+  804cd9:	48 89 ce             	mov    %rcx,%rsi
+  804cdc:	bf 06 00 00 00       	mov    $0x6,%edi
+  804ce1:	48 b9 6f c9 ff ff ff 	movabs $0xffffffffffffc96f,%rcx
+  804ce8:	ff ff ff 
+  804ceb:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804cef:	ff d0                	call   *%rax
+}
+  804cf1:	c9                   	leave
+  804cf2:	c3                   	ret
+
+0000000000804cf3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  804cf3:	55                   	push   %rbp
+  804cf4:	48 89 e5             	mov    %rsp,%rbp
+  804cf7:	41 57                	push   %r15
+  804cf9:	53                   	push   %rbx
+  804cfa:	48 83 ec 30          	sub    $0x30,%rsp
+  804cfe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cfe <nsipc_recv+0xb>
+  804d05:	49 bb 32 33 00 00 00 	movabs $0x3332,%r11
+  804d0c:	00 00 00 
+  804d0f:	4c 01 db             	add    %r11,%rbx
+  804d12:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804d15:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804d19:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  804d1c:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804d1f:	48 ba d0 5f 01 00 00 	movabs $0x15fd0,%rdx
+  804d26:	00 00 00 
+  804d29:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804d2c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  804d2f:	48 ba d0 5f 01 00 00 	movabs $0x15fd0,%rdx
+  804d36:	00 00 00 
+  804d39:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804d3c:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804d40:	48 ba d0 5f 01 00 00 	movabs $0x15fd0,%rdx
+  804d47:	00 00 00 
+  804d4a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804d4d:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804d51:	bf 07 00 00 00       	mov    $0x7,%edi
+  804d56:	48 b8 cc c8 ff ff ff 	movabs $0xffffffffffffc8cc,%rax
+  804d5d:	ff ff ff 
+  804d60:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d64:	ff d0                	call   *%rax
+  804d66:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d69:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d6d:	0f 88 91 00 00 00    	js     804e04 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804d73:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804d7a:	7f 08                	jg     804d84 <nsipc_recv+0x91>
+  804d7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d7f:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804d82:	7e 50                	jle    804dd4 <nsipc_recv+0xe1>
+  804d84:	48 b8 ab e9 ff ff ff 	movabs $0xffffffffffffe9ab,%rax
+  804d8b:	ff ff ff 
+  804d8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d92:	48 89 c1             	mov    %rax,%rcx
+  804d95:	48 b8 c0 e9 ff ff ff 	movabs $0xffffffffffffe9c0,%rax
+  804d9c:	ff ff ff 
+  804d9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804da3:	48 89 c2             	mov    %rax,%rdx
+  804da6:	be 79 00 00 00       	mov    $0x79,%esi
+  804dab:	48 b8 d5 e9 ff ff ff 	movabs $0xffffffffffffe9d5,%rax
+  804db2:	ff ff ff 
+  804db5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804db9:	48 89 c7             	mov    %rax,%rdi
+  804dbc:	49 89 df             	mov    %rbx,%r15
+  804dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dc4:	49 b8 d0 83 ff ff ff 	movabs $0xffffffffffff83d0,%r8
+  804dcb:	ff ff ff 
+  804dce:	49 01 d8             	add    %rbx,%r8
+  804dd1:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804dd4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dd7:	48 63 d0             	movslq %eax,%rdx
+  804dda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804dde:	48 b9 d0 5f 01 00 00 	movabs $0x15fd0,%rcx
+  804de5:	00 00 00 
+  804de8:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  804dec:	48 89 ce             	mov    %rcx,%rsi
+  804def:	48 89 c7             	mov    %rax,%rdi
+  804df2:	49 89 df             	mov    %rbx,%r15
+  804df5:	48 b8 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rax
+  804dfc:	ff ff ff 
+  804dff:	48 01 d8             	add    %rbx,%rax
+  804e02:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804e04:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804e07:	48 83 c4 30          	add    $0x30,%rsp
+  804e0b:	5b                   	pop    %rbx
+  804e0c:	41 5f                	pop    %r15
+  804e0e:	5d                   	pop    %rbp
+  804e0f:	c3                   	ret
+
+0000000000804e10 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804e10:	55                   	push   %rbp
+  804e11:	48 89 e5             	mov    %rsp,%rbp
+  804e14:	41 57                	push   %r15
+  804e16:	53                   	push   %rbx
+  804e17:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804e1e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e1e <nsipc_send+0xe>
+  804e25:	49 bb 12 32 00 00 00 	movabs $0x3212,%r11
+  804e2c:	00 00 00 
+  804e2f:	4c 01 db             	add    %r11,%rbx
+  804e32:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804e38:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804e3f:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804e45:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804e4b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804e4f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804e53:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804e5a:	00 00 00 
+  804e5d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804e60:	85 c0                	test   %eax,%eax
+  804e62:	75 24                	jne    804e88 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804e64:	bf 02 00 00 00       	mov    $0x2,%edi
+  804e69:	49 89 df             	mov    %rbx,%r15
+  804e6c:	48 b8 b2 e2 ff ff ff 	movabs $0xffffffffffffe2b2,%rax
+  804e73:	ff ff ff 
+  804e76:	48 01 d8             	add    %rbx,%rax
+  804e79:	ff d0                	call   *%rax
+  804e7b:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804e82:	00 00 00 
+  804e85:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804e88:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804e8e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804e91:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804e98:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804e9b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804e9e:	39 c2                	cmp    %eax,%edx
+  804ea0:	0f 4e c2             	cmovle %edx,%eax
+  804ea3:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804ea9:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804eaf:	48 63 d0             	movslq %eax,%rdx
+  804eb2:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804eb9:	48 89 c6             	mov    %rax,%rsi
+  804ebc:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804ec3:	00 00 00 
+  804ec6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804eca:	48 89 c7             	mov    %rax,%rdi
+  804ecd:	49 89 df             	mov    %rbx,%r15
+  804ed0:	48 b8 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rax
+  804ed7:	ff ff ff 
+  804eda:	48 01 d8             	add    %rbx,%rax
+  804edd:	ff d0                	call   *%rax
+	req->req_s = s;
+  804edf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee3:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804ee9:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804eeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eef:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804ef5:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804ef8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804efc:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804f02:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804f05:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804f0c:	00 00 00 
+  804f0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f13:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804f17:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804f1e:	00 
+  804f1f:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804f25:	48 63 d0             	movslq %eax,%rdx
+  804f28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f2c:	48 01 d0             	add    %rdx,%rax
+  804f2f:	48 83 e8 01          	sub    $0x1,%rax
+  804f33:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804f37:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f40:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804f44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f48:	48 29 d0             	sub    %rdx,%rax
+  804f4b:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804f51:	85 c0                	test   %eax,%eax
+  804f53:	0f 48 c2             	cmovs  %edx,%eax
+  804f56:	c1 f8 0c             	sar    $0xc,%eax
+  804f59:	48 98                	cltq
+  804f5b:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804f5f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804f63:	48 85 c0             	test   %rax,%rax
+  804f66:	0f 95 c0             	setne  %al
+  804f69:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804f6c:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804f73:	00 
+  804f74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f78:	48 83 c0 0b          	add    $0xb,%rax
+  804f7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804f80:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f84:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f89:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804f8d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f91:	48 29 d0             	sub    %rdx,%rax
+  804f94:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804f98:	89 c7                	mov    %eax,%edi
+  804f9a:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804fa1:	00 00 00 
+  804fa4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804fa7:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804fab:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804faf:	48 83 ec 08          	sub    $0x8,%rsp
+  804fb3:	6a 00                	push   $0x0
+  804fb5:	6a 00                	push   $0x0
+  804fb7:	6a 05                	push   $0x5
+  804fb9:	41 89 f1             	mov    %esi,%r9d
+  804fbc:	49 89 c8             	mov    %rcx,%r8
+  804fbf:	89 f9                	mov    %edi,%ecx
+  804fc1:	be 08 00 00 00       	mov    $0x8,%esi
+  804fc6:	89 c7                	mov    %eax,%edi
+  804fc8:	49 89 df             	mov    %rbx,%r15
+  804fcb:	48 b8 ba de ff ff ff 	movabs $0xffffffffffffdeba,%rax
+  804fd2:	ff ff ff 
+  804fd5:	48 01 d8             	add    %rbx,%rax
+  804fd8:	ff d0                	call   *%rax
+  804fda:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804fde:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804fe2:	5b                   	pop    %rbx
+  804fe3:	41 5f                	pop    %r15
+  804fe5:	5d                   	pop    %rbp
+  804fe6:	c3                   	ret
+
+0000000000804fe7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804fe7:	55                   	push   %rbp
+  804fe8:	48 89 e5             	mov    %rsp,%rbp
+  804feb:	48 83 ec 10          	sub    $0x10,%rsp
+  804fef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804fef <nsipc_socket+0x8>
+  804ff6:	49 bb 41 30 00 00 00 	movabs $0x3041,%r11
+  804ffd:	00 00 00 
+  805000:	4c 01 d8             	add    %r11,%rax
+  805003:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805006:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805009:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  80500c:	48 b9 d0 5f 01 00 00 	movabs $0x15fd0,%rcx
+  805013:	00 00 00 
+  805016:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805019:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  80501c:	48 b9 d0 5f 01 00 00 	movabs $0x15fd0,%rcx
+  805023:	00 00 00 
+  805026:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805029:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  80502d:	48 b9 d0 5f 01 00 00 	movabs $0x15fd0,%rcx
+  805034:	00 00 00 
+  805037:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80503a:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  80503e:	bf 09 00 00 00       	mov    $0x9,%edi
+  805043:	48 ba cc c8 ff ff ff 	movabs $0xffffffffffffc8cc,%rdx
+  80504a:	ff ff ff 
+  80504d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805051:	ff d0                	call   *%rax
+}
+  805053:	c9                   	leave
+  805054:	c3                   	ret
+
+0000000000805055 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805055:	55                   	push   %rbp
+  805056:	48 89 e5             	mov    %rsp,%rbp
+  805059:	41 57                	push   %r15
+  80505b:	53                   	push   %rbx
+  80505c:	48 83 ec 30          	sub    $0x30,%rsp
+  805060:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805060 <pipe+0xb>
+  805067:	49 bb d0 2f 00 00 00 	movabs $0x2fd0,%r11
+  80506e:	00 00 00 
+  805071:	4c 01 db             	add    %r11,%rbx
+  805074:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805078:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  80507c:	48 89 c7             	mov    %rax,%rdi
+  80507f:	49 89 df             	mov    %rbx,%r15
+  805082:	48 b8 48 a9 ff ff ff 	movabs $0xffffffffffffa948,%rax
+  805089:	ff ff ff 
+  80508c:	48 01 d8             	add    %rbx,%rax
+  80508f:	ff d0                	call   *%rax
+  805091:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805094:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805098:	0f 88 12 02 00 00    	js     8052b0 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80509e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050a2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8050a7:	48 89 c6             	mov    %rax,%rsi
+  8050aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050af:	49 89 df             	mov    %rbx,%r15
+  8050b2:	48 b8 25 a1 ff ff ff 	movabs $0xffffffffffffa125,%rax
+  8050b9:	ff ff ff 
+  8050bc:	48 01 d8             	add    %rbx,%rax
+  8050bf:	ff d0                	call   *%rax
+  8050c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050c8:	0f 88 e2 01 00 00    	js     8052b0 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8050ce:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8050d2:	48 89 c7             	mov    %rax,%rdi
+  8050d5:	49 89 df             	mov    %rbx,%r15
+  8050d8:	48 b8 48 a9 ff ff ff 	movabs $0xffffffffffffa948,%rax
+  8050df:	ff ff ff 
+  8050e2:	48 01 d8             	add    %rbx,%rax
+  8050e5:	ff d0                	call   *%rax
+  8050e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050ee:	0f 88 9b 01 00 00    	js     80528f <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8050f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050f8:	ba 07 04 00 00       	mov    $0x407,%edx
+  8050fd:	48 89 c6             	mov    %rax,%rsi
+  805100:	bf 00 00 00 00       	mov    $0x0,%edi
+  805105:	49 89 df             	mov    %rbx,%r15
+  805108:	48 b8 25 a1 ff ff ff 	movabs $0xffffffffffffa125,%rax
+  80510f:	ff ff ff 
+  805112:	48 01 d8             	add    %rbx,%rax
+  805115:	ff d0                	call   *%rax
+  805117:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80511a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80511e:	0f 88 6b 01 00 00    	js     80528f <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805124:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805128:	48 89 c7             	mov    %rax,%rdi
+  80512b:	49 89 df             	mov    %rbx,%r15
+  80512e:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  805135:	ff ff ff 
+  805138:	48 01 d8             	add    %rbx,%rax
+  80513b:	ff d0                	call   *%rax
+  80513d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805141:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805145:	ba 07 04 00 00       	mov    $0x407,%edx
+  80514a:	48 89 c6             	mov    %rax,%rsi
+  80514d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805152:	49 89 df             	mov    %rbx,%r15
+  805155:	48 b8 25 a1 ff ff ff 	movabs $0xffffffffffffa125,%rax
+  80515c:	ff ff ff 
+  80515f:	48 01 d8             	add    %rbx,%rax
+  805162:	ff d0                	call   *%rax
+  805164:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805167:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80516b:	0f 88 fd 00 00 00    	js     80526e <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805171:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805175:	48 89 c7             	mov    %rax,%rdi
+  805178:	49 89 df             	mov    %rbx,%r15
+  80517b:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  805182:	ff ff ff 
+  805185:	48 01 d8             	add    %rbx,%rax
+  805188:	ff d0                	call   *%rax
+  80518a:	48 89 c2             	mov    %rax,%rdx
+  80518d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805191:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805197:	48 89 d1             	mov    %rdx,%rcx
+  80519a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80519f:	48 89 c6             	mov    %rax,%rsi
+  8051a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051a7:	49 89 df             	mov    %rbx,%r15
+  8051aa:	48 b8 8a a1 ff ff ff 	movabs $0xffffffffffffa18a,%rax
+  8051b1:	ff ff ff 
+  8051b4:	48 01 d8             	add    %rbx,%rax
+  8051b7:	ff d0                	call   *%rax
+  8051b9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051c0:	0f 88 87 00 00 00    	js     80524d <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8051c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051ca:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  8051d1:	00 00 00 
+  8051d4:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8051d7:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  8051d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051dd:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8051e4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051e8:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  8051ef:	00 00 00 
+  8051f2:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8051f5:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8051f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051fb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805202:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805206:	48 89 c7             	mov    %rax,%rdi
+  805209:	49 89 df             	mov    %rbx,%r15
+  80520c:	48 b8 ce a8 ff ff ff 	movabs $0xffffffffffffa8ce,%rax
+  805213:	ff ff ff 
+  805216:	48 01 d8             	add    %rbx,%rax
+  805219:	ff d0                	call   *%rax
+  80521b:	89 c2                	mov    %eax,%edx
+  80521d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805221:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805223:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805227:	48 89 c7             	mov    %rax,%rdi
+  80522a:	49 89 df             	mov    %rbx,%r15
+  80522d:	48 b8 ce a8 ff ff ff 	movabs $0xffffffffffffa8ce,%rax
+  805234:	ff ff ff 
+  805237:	48 01 d8             	add    %rbx,%rax
+  80523a:	ff d0                	call   *%rax
+  80523c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805240:	48 83 c2 04          	add    $0x4,%rdx
+  805244:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80524b:	eb 67                	jmp    8052b4 <pipe+0x25f>
+		goto err3;
+  80524d:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80524e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805252:	48 89 c6             	mov    %rax,%rsi
+  805255:	bf 00 00 00 00       	mov    $0x0,%edi
+  80525a:	49 89 df             	mov    %rbx,%r15
+  80525d:	48 b8 fd a1 ff ff ff 	movabs $0xffffffffffffa1fd,%rax
+  805264:	ff ff ff 
+  805267:	48 01 d8             	add    %rbx,%rax
+  80526a:	ff d0                	call   *%rax
+  80526c:	eb 01                	jmp    80526f <pipe+0x21a>
+		goto err2;
+  80526e:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80526f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805273:	48 89 c6             	mov    %rax,%rsi
+  805276:	bf 00 00 00 00       	mov    $0x0,%edi
+  80527b:	49 89 df             	mov    %rbx,%r15
+  80527e:	48 b8 fd a1 ff ff ff 	movabs $0xffffffffffffa1fd,%rax
+  805285:	ff ff ff 
+  805288:	48 01 d8             	add    %rbx,%rax
+  80528b:	ff d0                	call   *%rax
+  80528d:	eb 01                	jmp    805290 <pipe+0x23b>
+		goto err1;
+  80528f:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805290:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805294:	48 89 c6             	mov    %rax,%rsi
+  805297:	bf 00 00 00 00       	mov    $0x0,%edi
+  80529c:	49 89 df             	mov    %rbx,%r15
+  80529f:	48 b8 fd a1 ff ff ff 	movabs $0xffffffffffffa1fd,%rax
+  8052a6:	ff ff ff 
+  8052a9:	48 01 d8             	add    %rbx,%rax
+  8052ac:	ff d0                	call   *%rax
+  8052ae:	eb 01                	jmp    8052b1 <pipe+0x25c>
+		goto err;
+  8052b0:	90                   	nop
+err:
+	return r;
+  8052b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8052b4:	48 83 c4 30          	add    $0x30,%rsp
+  8052b8:	5b                   	pop    %rbx
+  8052b9:	41 5f                	pop    %r15
+  8052bb:	5d                   	pop    %rbp
+  8052bc:	c3                   	ret
+
+00000000008052bd <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8052bd:	55                   	push   %rbp
+  8052be:	48 89 e5             	mov    %rsp,%rbp
+  8052c1:	41 57                	push   %r15
+  8052c3:	41 54                	push   %r12
+  8052c5:	53                   	push   %rbx
+  8052c6:	48 83 ec 28          	sub    $0x28,%rsp
+  8052ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052ca <_pipeisclosed+0xd>
+  8052d1:	49 bb 66 2d 00 00 00 	movabs $0x2d66,%r11
+  8052d8:	00 00 00 
+  8052db:	4c 01 db             	add    %r11,%rbx
+  8052de:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8052e2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8052e6:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8052ed:	ff ff ff 
+  8052f0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8052f4:	48 8b 00             	mov    (%rax),%rax
+  8052f7:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8052fd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805300:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805304:	48 89 c7             	mov    %rax,%rdi
+  805307:	49 89 df             	mov    %rbx,%r15
+  80530a:	48 b8 41 e3 ff ff ff 	movabs $0xffffffffffffe341,%rax
+  805311:	ff ff ff 
+  805314:	48 01 d8             	add    %rbx,%rax
+  805317:	ff d0                	call   *%rax
+  805319:	41 89 c4             	mov    %eax,%r12d
+  80531c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805320:	48 89 c7             	mov    %rax,%rdi
+  805323:	49 89 df             	mov    %rbx,%r15
+  805326:	48 b8 41 e3 ff ff ff 	movabs $0xffffffffffffe341,%rax
+  80532d:	ff ff ff 
+  805330:	48 01 d8             	add    %rbx,%rax
+  805333:	ff d0                	call   *%rax
+  805335:	41 39 c4             	cmp    %eax,%r12d
+  805338:	0f 94 c0             	sete   %al
+  80533b:	0f b6 c0             	movzbl %al,%eax
+  80533e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805341:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805348:	ff ff ff 
+  80534b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80534f:	48 8b 00             	mov    (%rax),%rax
+  805352:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805358:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80535b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80535e:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805361:	75 05                	jne    805368 <_pipeisclosed+0xab>
+			return ret;
+  805363:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805366:	eb 63                	jmp    8053cb <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805368:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80536b:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80536e:	0f 84 72 ff ff ff    	je     8052e6 <_pipeisclosed+0x29>
+  805374:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805378:	0f 85 68 ff ff ff    	jne    8052e6 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80537e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805385:	ff ff ff 
+  805388:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80538c:	48 8b 00             	mov    (%rax),%rax
+  80538f:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805395:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805398:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80539b:	89 c6                	mov    %eax,%esi
+  80539d:	48 b8 e6 e9 ff ff ff 	movabs $0xffffffffffffe9e6,%rax
+  8053a4:	ff ff ff 
+  8053a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053ab:	48 89 c7             	mov    %rax,%rdi
+  8053ae:	49 89 df             	mov    %rbx,%r15
+  8053b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053b6:	49 b8 a7 86 ff ff ff 	movabs $0xffffffffffff86a7,%r8
+  8053bd:	ff ff ff 
+  8053c0:	49 01 d8             	add    %rbx,%r8
+  8053c3:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8053c6:	e9 1b ff ff ff       	jmp    8052e6 <_pipeisclosed+0x29>
+	}
+}
+  8053cb:	48 83 c4 28          	add    $0x28,%rsp
+  8053cf:	5b                   	pop    %rbx
+  8053d0:	41 5c                	pop    %r12
+  8053d2:	41 5f                	pop    %r15
+  8053d4:	5d                   	pop    %rbp
+  8053d5:	c3                   	ret
+
+00000000008053d6 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8053d6:	55                   	push   %rbp
+  8053d7:	48 89 e5             	mov    %rsp,%rbp
+  8053da:	41 57                	push   %r15
+  8053dc:	53                   	push   %rbx
+  8053dd:	48 83 ec 30          	sub    $0x30,%rsp
+  8053e1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053e1 <pipeisclosed+0xb>
+  8053e8:	49 bb 4f 2c 00 00 00 	movabs $0x2c4f,%r11
+  8053ef:	00 00 00 
+  8053f2:	4c 01 db             	add    %r11,%rbx
+  8053f5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8053f8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8053fc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8053ff:	48 89 d6             	mov    %rdx,%rsi
+  805402:	89 c7                	mov    %eax,%edi
+  805404:	49 89 df             	mov    %rbx,%r15
+  805407:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  80540e:	ff ff ff 
+  805411:	48 01 d8             	add    %rbx,%rax
+  805414:	ff d0                	call   *%rax
+  805416:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805419:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80541d:	79 05                	jns    805424 <pipeisclosed+0x4e>
+		return r;
+  80541f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805422:	eb 3b                	jmp    80545f <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805424:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805428:	48 89 c7             	mov    %rax,%rdi
+  80542b:	49 89 df             	mov    %rbx,%r15
+  80542e:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  805435:	ff ff ff 
+  805438:	48 01 d8             	add    %rbx,%rax
+  80543b:	ff d0                	call   *%rax
+  80543d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805441:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805445:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805449:	48 89 d6             	mov    %rdx,%rsi
+  80544c:	48 89 c7             	mov    %rax,%rdi
+  80544f:	48 b8 8d d2 ff ff ff 	movabs $0xffffffffffffd28d,%rax
+  805456:	ff ff ff 
+  805459:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80545d:	ff d0                	call   *%rax
+}
+  80545f:	48 83 c4 30          	add    $0x30,%rsp
+  805463:	5b                   	pop    %rbx
+  805464:	41 5f                	pop    %r15
+  805466:	5d                   	pop    %rbp
+  805467:	c3                   	ret
+
+0000000000805468 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805468:	55                   	push   %rbp
+  805469:	48 89 e5             	mov    %rsp,%rbp
+  80546c:	41 57                	push   %r15
+  80546e:	53                   	push   %rbx
+  80546f:	48 83 ec 40          	sub    $0x40,%rsp
+  805473:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805473 <devpipe_read+0xb>
+  80547a:	49 bb bd 2b 00 00 00 	movabs $0x2bbd,%r11
+  805481:	00 00 00 
+  805484:	4c 01 db             	add    %r11,%rbx
+  805487:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80548b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80548f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805493:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805497:	48 89 c7             	mov    %rax,%rdi
+  80549a:	49 89 df             	mov    %rbx,%r15
+  80549d:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  8054a4:	ff ff ff 
+  8054a7:	48 01 d8             	add    %rbx,%rax
+  8054aa:	ff d0                	call   *%rax
+  8054ac:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8054b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8054b4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8054b8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8054bf:	00 
+  8054c0:	e9 a1 00 00 00       	jmp    805566 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8054c5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8054ca:	74 09                	je     8054d5 <devpipe_read+0x6d>
+				return i;
+  8054cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054d0:	e9 9f 00 00 00       	jmp    805574 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8054d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8054d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8054dd:	48 89 d6             	mov    %rdx,%rsi
+  8054e0:	48 89 c7             	mov    %rax,%rdi
+  8054e3:	48 b8 8d d2 ff ff ff 	movabs $0xffffffffffffd28d,%rax
+  8054ea:	ff ff ff 
+  8054ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054f1:	ff d0                	call   *%rax
+  8054f3:	85 c0                	test   %eax,%eax
+  8054f5:	74 07                	je     8054fe <devpipe_read+0x96>
+				return 0;
+  8054f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054fc:	eb 76                	jmp    805574 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8054fe:	49 89 df             	mov    %rbx,%r15
+  805501:	48 b8 d0 a0 ff ff ff 	movabs $0xffffffffffffa0d0,%rax
+  805508:	ff ff ff 
+  80550b:	48 01 d8             	add    %rbx,%rax
+  80550e:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805510:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805514:	8b 10                	mov    (%rax),%edx
+  805516:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80551a:	8b 40 04             	mov    0x4(%rax),%eax
+  80551d:	39 c2                	cmp    %eax,%edx
+  80551f:	74 a4                	je     8054c5 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805521:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805525:	8b 10                	mov    (%rax),%edx
+  805527:	89 d0                	mov    %edx,%eax
+  805529:	c1 f8 1f             	sar    $0x1f,%eax
+  80552c:	c1 e8 1b             	shr    $0x1b,%eax
+  80552f:	01 c2                	add    %eax,%edx
+  805531:	83 e2 1f             	and    $0x1f,%edx
+  805534:	29 c2                	sub    %eax,%edx
+  805536:	89 d6                	mov    %edx,%esi
+  805538:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80553c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805540:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805544:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805548:	48 63 c6             	movslq %esi,%rax
+  80554b:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805550:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805552:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805556:	8b 00                	mov    (%rax),%eax
+  805558:	8d 50 01             	lea    0x1(%rax),%edx
+  80555b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80555f:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805561:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805566:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80556a:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80556e:	72 a0                	jb     805510 <devpipe_read+0xa8>
+	}
+	return i;
+  805570:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805574:	48 83 c4 40          	add    $0x40,%rsp
+  805578:	5b                   	pop    %rbx
+  805579:	41 5f                	pop    %r15
+  80557b:	5d                   	pop    %rbp
+  80557c:	c3                   	ret
+
+000000000080557d <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80557d:	55                   	push   %rbp
+  80557e:	48 89 e5             	mov    %rsp,%rbp
+  805581:	41 57                	push   %r15
+  805583:	53                   	push   %rbx
+  805584:	48 83 ec 40          	sub    $0x40,%rsp
+  805588:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805588 <devpipe_write+0xb>
+  80558f:	49 bb a8 2a 00 00 00 	movabs $0x2aa8,%r11
+  805596:	00 00 00 
+  805599:	4c 01 db             	add    %r11,%rbx
+  80559c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8055a0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8055a4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8055a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055ac:	48 89 c7             	mov    %rax,%rdi
+  8055af:	49 89 df             	mov    %rbx,%r15
+  8055b2:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  8055b9:	ff ff ff 
+  8055bc:	48 01 d8             	add    %rbx,%rax
+  8055bf:	ff d0                	call   *%rax
+  8055c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8055c5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8055c9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8055cd:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8055d4:	00 
+  8055d5:	e9 a0 00 00 00       	jmp    80567a <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8055da:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8055de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055e2:	48 89 d6             	mov    %rdx,%rsi
+  8055e5:	48 89 c7             	mov    %rax,%rdi
+  8055e8:	48 b8 8d d2 ff ff ff 	movabs $0xffffffffffffd28d,%rax
+  8055ef:	ff ff ff 
+  8055f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055f6:	ff d0                	call   *%rax
+  8055f8:	85 c0                	test   %eax,%eax
+  8055fa:	74 0a                	je     805606 <devpipe_write+0x89>
+				return 0;
+  8055fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  805601:	e9 82 00 00 00       	jmp    805688 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805606:	49 89 df             	mov    %rbx,%r15
+  805609:	48 b8 d0 a0 ff ff ff 	movabs $0xffffffffffffa0d0,%rax
+  805610:	ff ff ff 
+  805613:	48 01 d8             	add    %rbx,%rax
+  805616:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805618:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80561c:	8b 40 04             	mov    0x4(%rax),%eax
+  80561f:	48 63 d0             	movslq %eax,%rdx
+  805622:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805626:	8b 00                	mov    (%rax),%eax
+  805628:	48 98                	cltq
+  80562a:	48 83 c0 20          	add    $0x20,%rax
+  80562e:	48 39 c2             	cmp    %rax,%rdx
+  805631:	73 a7                	jae    8055da <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805633:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805637:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80563b:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80563f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805643:	8b 50 04             	mov    0x4(%rax),%edx
+  805646:	89 d0                	mov    %edx,%eax
+  805648:	c1 f8 1f             	sar    $0x1f,%eax
+  80564b:	c1 e8 1b             	shr    $0x1b,%eax
+  80564e:	01 c2                	add    %eax,%edx
+  805650:	83 e2 1f             	and    $0x1f,%edx
+  805653:	29 c2                	sub    %eax,%edx
+  805655:	89 d0                	mov    %edx,%eax
+  805657:	0f b6 09             	movzbl (%rcx),%ecx
+  80565a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80565e:	48 98                	cltq
+  805660:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805664:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805668:	8b 40 04             	mov    0x4(%rax),%eax
+  80566b:	8d 50 01             	lea    0x1(%rax),%edx
+  80566e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805672:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805675:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80567a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80567e:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805682:	72 94                	jb     805618 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805684:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805688:	48 83 c4 40          	add    $0x40,%rsp
+  80568c:	5b                   	pop    %rbx
+  80568d:	41 5f                	pop    %r15
+  80568f:	5d                   	pop    %rbp
+  805690:	c3                   	ret
+
+0000000000805691 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805691:	55                   	push   %rbp
+  805692:	48 89 e5             	mov    %rsp,%rbp
+  805695:	41 57                	push   %r15
+  805697:	53                   	push   %rbx
+  805698:	48 83 ec 20          	sub    $0x20,%rsp
+  80569c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80569c <devpipe_stat+0xb>
+  8056a3:	49 bb 94 29 00 00 00 	movabs $0x2994,%r11
+  8056aa:	00 00 00 
+  8056ad:	4c 01 db             	add    %r11,%rbx
+  8056b0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8056b4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8056b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8056bc:	48 89 c7             	mov    %rax,%rdi
+  8056bf:	49 89 df             	mov    %rbx,%r15
+  8056c2:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  8056c9:	ff ff ff 
+  8056cc:	48 01 d8             	add    %rbx,%rax
+  8056cf:	ff d0                	call   *%rax
+  8056d1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8056d5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056d9:	48 ba f9 e9 ff ff ff 	movabs $0xffffffffffffe9f9,%rdx
+  8056e0:	ff ff ff 
+  8056e3:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8056e7:	48 89 d6             	mov    %rdx,%rsi
+  8056ea:	48 89 c7             	mov    %rax,%rdi
+  8056ed:	49 89 df             	mov    %rbx,%r15
+  8056f0:	48 b8 69 94 ff ff ff 	movabs $0xffffffffffff9469,%rax
+  8056f7:	ff ff ff 
+  8056fa:	48 01 d8             	add    %rbx,%rax
+  8056fd:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8056ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805703:	8b 50 04             	mov    0x4(%rax),%edx
+  805706:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80570a:	8b 00                	mov    (%rax),%eax
+  80570c:	29 c2                	sub    %eax,%edx
+  80570e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805712:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805718:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80571c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805723:	00 00 00 
+	stat->st_dev = &devpipe;
+  805726:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80572a:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805731:	00 00 00 
+  805734:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805738:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80573f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805744:	48 83 c4 20          	add    $0x20,%rsp
+  805748:	5b                   	pop    %rbx
+  805749:	41 5f                	pop    %r15
+  80574b:	5d                   	pop    %rbp
+  80574c:	c3                   	ret
+
+000000000080574d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80574d:	55                   	push   %rbp
+  80574e:	48 89 e5             	mov    %rsp,%rbp
+  805751:	41 57                	push   %r15
+  805753:	53                   	push   %rbx
+  805754:	48 83 ec 10          	sub    $0x10,%rsp
+  805758:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805758 <devpipe_close+0xb>
+  80575f:	49 bb d8 28 00 00 00 	movabs $0x28d8,%r11
+  805766:	00 00 00 
+  805769:	4c 01 db             	add    %r11,%rbx
+  80576c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805770:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805774:	48 89 c6             	mov    %rax,%rsi
+  805777:	bf 00 00 00 00       	mov    $0x0,%edi
+  80577c:	49 89 df             	mov    %rbx,%r15
+  80577f:	48 b8 fd a1 ff ff ff 	movabs $0xffffffffffffa1fd,%rax
+  805786:	ff ff ff 
+  805789:	48 01 d8             	add    %rbx,%rax
+  80578c:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80578e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805792:	48 89 c7             	mov    %rax,%rdi
+  805795:	49 89 df             	mov    %rbx,%r15
+  805798:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  80579f:	ff ff ff 
+  8057a2:	48 01 d8             	add    %rbx,%rax
+  8057a5:	ff d0                	call   *%rax
+  8057a7:	48 89 c6             	mov    %rax,%rsi
+  8057aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057af:	49 89 df             	mov    %rbx,%r15
+  8057b2:	48 b8 fd a1 ff ff ff 	movabs $0xffffffffffffa1fd,%rax
+  8057b9:	ff ff ff 
+  8057bc:	48 01 d8             	add    %rbx,%rax
+  8057bf:	ff d0                	call   *%rax
+}
+  8057c1:	48 83 c4 10          	add    $0x10,%rsp
+  8057c5:	5b                   	pop    %rbx
+  8057c6:	41 5f                	pop    %r15
+  8057c8:	5d                   	pop    %rbp
+  8057c9:	c3                   	ret
+
+00000000008057ca <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8057ca:	55                   	push   %rbp
+  8057cb:	48 89 e5             	mov    %rsp,%rbp
+  8057ce:	41 57                	push   %r15
+  8057d0:	48 83 ec 28          	sub    $0x28,%rsp
+  8057d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8057d4 <cputchar+0xa>
+  8057db:	49 bb 5c 28 00 00 00 	movabs $0x285c,%r11
+  8057e2:	00 00 00 
+  8057e5:	4c 01 d8             	add    %r11,%rax
+  8057e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8057eb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8057ee:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8057f1:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8057f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8057fa:	48 89 d7             	mov    %rdx,%rdi
+  8057fd:	49 89 c7             	mov    %rax,%r15
+  805800:	48 ba 6d 9f ff ff ff 	movabs $0xffffffffffff9f6d,%rdx
+  805807:	ff ff ff 
+  80580a:	48 01 c2             	add    %rax,%rdx
+  80580d:	ff d2                	call   *%rdx
+}
+  80580f:	90                   	nop
+  805810:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805814:	c9                   	leave
+  805815:	c3                   	ret
+
+0000000000805816 <getchar>:
+
+int
+getchar(void)
+{
+  805816:	55                   	push   %rbp
+  805817:	48 89 e5             	mov    %rsp,%rbp
+  80581a:	41 57                	push   %r15
+  80581c:	48 83 ec 18          	sub    $0x18,%rsp
+  805820:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805820 <getchar+0xa>
+  805827:	49 bb 10 28 00 00 00 	movabs $0x2810,%r11
+  80582e:	00 00 00 
+  805831:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805834:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805838:	ba 01 00 00 00       	mov    $0x1,%edx
+  80583d:	48 89 ce             	mov    %rcx,%rsi
+  805840:	bf 00 00 00 00       	mov    $0x0,%edi
+  805845:	49 89 c7             	mov    %rax,%r15
+  805848:	48 b9 45 af ff ff ff 	movabs $0xffffffffffffaf45,%rcx
+  80584f:	ff ff ff 
+  805852:	48 01 c1             	add    %rax,%rcx
+  805855:	ff d1                	call   *%rcx
+  805857:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80585a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80585e:	79 05                	jns    805865 <getchar+0x4f>
+		return r;
+  805860:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805863:	eb 14                	jmp    805879 <getchar+0x63>
+	if (r < 1)
+  805865:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805869:	7f 07                	jg     805872 <getchar+0x5c>
+		return -E_EOF;
+  80586b:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  805870:	eb 07                	jmp    805879 <getchar+0x63>
+	return c;
+  805872:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805876:	0f b6 c0             	movzbl %al,%eax
+}
+  805879:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80587d:	c9                   	leave
+  80587e:	c3                   	ret
+
+000000000080587f <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80587f:	55                   	push   %rbp
+  805880:	48 89 e5             	mov    %rsp,%rbp
+  805883:	41 57                	push   %r15
+  805885:	53                   	push   %rbx
+  805886:	48 83 ec 20          	sub    $0x20,%rsp
+  80588a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80588a <iscons+0xb>
+  805891:	49 bb a6 27 00 00 00 	movabs $0x27a6,%r11
+  805898:	00 00 00 
+  80589b:	4c 01 db             	add    %r11,%rbx
+  80589e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8058a1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8058a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058a8:	48 89 d6             	mov    %rdx,%rsi
+  8058ab:	89 c7                	mov    %eax,%edi
+  8058ad:	49 89 df             	mov    %rbx,%r15
+  8058b0:	48 b8 fe a9 ff ff ff 	movabs $0xffffffffffffa9fe,%rax
+  8058b7:	ff ff ff 
+  8058ba:	48 01 d8             	add    %rbx,%rax
+  8058bd:	ff d0                	call   *%rax
+  8058bf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058c6:	79 05                	jns    8058cd <iscons+0x4e>
+		return r;
+  8058c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058cb:	eb 1b                	jmp    8058e8 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8058cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058d1:	8b 10                	mov    (%rax),%edx
+  8058d3:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  8058da:	00 00 00 
+  8058dd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8058e0:	39 c2                	cmp    %eax,%edx
+  8058e2:	0f 94 c0             	sete   %al
+  8058e5:	0f b6 c0             	movzbl %al,%eax
+}
+  8058e8:	48 83 c4 20          	add    $0x20,%rsp
+  8058ec:	5b                   	pop    %rbx
+  8058ed:	41 5f                	pop    %r15
+  8058ef:	5d                   	pop    %rbp
+  8058f0:	c3                   	ret
+
+00000000008058f1 <opencons>:
+
+int
+opencons(void)
+{
+  8058f1:	55                   	push   %rbp
+  8058f2:	48 89 e5             	mov    %rsp,%rbp
+  8058f5:	41 57                	push   %r15
+  8058f7:	53                   	push   %rbx
+  8058f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8058fc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058fc <opencons+0xb>
+  805903:	49 bb 34 27 00 00 00 	movabs $0x2734,%r11
+  80590a:	00 00 00 
+  80590d:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805910:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805914:	48 89 c7             	mov    %rax,%rdi
+  805917:	49 89 df             	mov    %rbx,%r15
+  80591a:	48 b8 48 a9 ff ff ff 	movabs $0xffffffffffffa948,%rax
+  805921:	ff ff ff 
+  805924:	48 01 d8             	add    %rbx,%rax
+  805927:	ff d0                	call   *%rax
+  805929:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80592c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805930:	79 05                	jns    805937 <opencons+0x46>
+		return r;
+  805932:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805935:	eb 68                	jmp    80599f <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805937:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80593b:	ba 07 04 00 00       	mov    $0x407,%edx
+  805940:	48 89 c6             	mov    %rax,%rsi
+  805943:	bf 00 00 00 00       	mov    $0x0,%edi
+  805948:	49 89 df             	mov    %rbx,%r15
+  80594b:	48 b8 25 a1 ff ff ff 	movabs $0xffffffffffffa125,%rax
+  805952:	ff ff ff 
+  805955:	48 01 d8             	add    %rbx,%rax
+  805958:	ff d0                	call   *%rax
+  80595a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80595d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805961:	79 05                	jns    805968 <opencons+0x77>
+		return r;
+  805963:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805966:	eb 37                	jmp    80599f <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805968:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80596c:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  805973:	00 00 00 
+  805976:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805979:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80597b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80597f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805986:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80598a:	48 89 c7             	mov    %rax,%rdi
+  80598d:	49 89 df             	mov    %rbx,%r15
+  805990:	48 b8 ce a8 ff ff ff 	movabs $0xffffffffffffa8ce,%rax
+  805997:	ff ff ff 
+  80599a:	48 01 d8             	add    %rbx,%rax
+  80599d:	ff d0                	call   *%rax
+}
+  80599f:	48 83 c4 10          	add    $0x10,%rsp
+  8059a3:	5b                   	pop    %rbx
+  8059a4:	41 5f                	pop    %r15
+  8059a6:	5d                   	pop    %rbp
+  8059a7:	c3                   	ret
+
+00000000008059a8 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8059a8:	55                   	push   %rbp
+  8059a9:	48 89 e5             	mov    %rsp,%rbp
+  8059ac:	41 57                	push   %r15
+  8059ae:	53                   	push   %rbx
+  8059af:	48 83 ec 30          	sub    $0x30,%rsp
+  8059b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059b3 <devcons_read+0xb>
+  8059ba:	49 bb 7d 26 00 00 00 	movabs $0x267d,%r11
+  8059c1:	00 00 00 
+  8059c4:	4c 01 db             	add    %r11,%rbx
+  8059c7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8059cb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8059cf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8059d3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8059d8:	75 19                	jne    8059f3 <devcons_read+0x4b>
+		return 0;
+  8059da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059df:	eb 55                	jmp    805a36 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8059e1:	49 89 df             	mov    %rbx,%r15
+  8059e4:	48 b8 d0 a0 ff ff ff 	movabs $0xffffffffffffa0d0,%rax
+  8059eb:	ff ff ff 
+  8059ee:	48 01 d8             	add    %rbx,%rax
+  8059f1:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8059f3:	49 89 df             	mov    %rbx,%r15
+  8059f6:	48 b8 cc 9f ff ff ff 	movabs $0xffffffffffff9fcc,%rax
+  8059fd:	ff ff ff 
+  805a00:	48 01 d8             	add    %rbx,%rax
+  805a03:	ff d0                	call   *%rax
+  805a05:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a08:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a0c:	74 d3                	je     8059e1 <devcons_read+0x39>
+	if (c < 0)
+  805a0e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a12:	79 05                	jns    805a19 <devcons_read+0x71>
+		return c;
+  805a14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a17:	eb 1d                	jmp    805a36 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  805a19:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  805a1d:	75 07                	jne    805a26 <devcons_read+0x7e>
+		return 0;
+  805a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a24:	eb 10                	jmp    805a36 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805a26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a29:	89 c2                	mov    %eax,%edx
+  805a2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a2f:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805a31:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805a36:	48 83 c4 30          	add    $0x30,%rsp
+  805a3a:	5b                   	pop    %rbx
+  805a3b:	41 5f                	pop    %r15
+  805a3d:	5d                   	pop    %rbp
+  805a3e:	c3                   	ret
+
+0000000000805a3f <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805a3f:	55                   	push   %rbp
+  805a40:	48 89 e5             	mov    %rsp,%rbp
+  805a43:	41 57                	push   %r15
+  805a45:	53                   	push   %rbx
+  805a46:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805a4d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a4d <devcons_write+0xe>
+  805a54:	49 bb e3 25 00 00 00 	movabs $0x25e3,%r11
+  805a5b:	00 00 00 
+  805a5e:	4c 01 db             	add    %r11,%rbx
+  805a61:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  805a68:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  805a6f:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805a76:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805a7d:	e9 80 00 00 00       	jmp    805b02 <devcons_write+0xc3>
+		m = n - tot;
+  805a82:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805a89:	89 c2                	mov    %eax,%edx
+  805a8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a8e:	29 c2                	sub    %eax,%edx
+  805a90:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  805a93:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a96:	83 f8 7f             	cmp    $0x7f,%eax
+  805a99:	76 07                	jbe    805aa2 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  805a9b:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  805aa2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805aa5:	48 63 d0             	movslq %eax,%rdx
+  805aa8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805aab:	48 63 c8             	movslq %eax,%rcx
+  805aae:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  805ab5:	48 01 c1             	add    %rax,%rcx
+  805ab8:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805abf:	48 89 ce             	mov    %rcx,%rsi
+  805ac2:	48 89 c7             	mov    %rax,%rdi
+  805ac5:	49 89 df             	mov    %rbx,%r15
+  805ac8:	48 b8 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rax
+  805acf:	ff ff ff 
+  805ad2:	48 01 d8             	add    %rbx,%rax
+  805ad5:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  805ad7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805ada:	48 63 d0             	movslq %eax,%rdx
+  805add:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805ae4:	48 89 d6             	mov    %rdx,%rsi
+  805ae7:	48 89 c7             	mov    %rax,%rdi
+  805aea:	49 89 df             	mov    %rbx,%r15
+  805aed:	48 b8 6d 9f ff ff ff 	movabs $0xffffffffffff9f6d,%rax
+  805af4:	ff ff ff 
+  805af7:	48 01 d8             	add    %rbx,%rax
+  805afa:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  805afc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805aff:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805b02:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b05:	48 98                	cltq
+  805b07:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  805b0e:	0f 82 6e ff ff ff    	jb     805a82 <devcons_write+0x43>
+	}
+	return tot;
+  805b14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805b17:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  805b1e:	5b                   	pop    %rbx
+  805b1f:	41 5f                	pop    %r15
+  805b21:	5d                   	pop    %rbp
+  805b22:	c3                   	ret
+
+0000000000805b23 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  805b23:	55                   	push   %rbp
+  805b24:	48 89 e5             	mov    %rsp,%rbp
+  805b27:	48 83 ec 08          	sub    $0x8,%rsp
+  805b2b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805b2b <devcons_close+0x8>
+  805b32:	49 bb 05 25 00 00 00 	movabs $0x2505,%r11
+  805b39:	00 00 00 
+  805b3c:	4c 01 d8             	add    %r11,%rax
+  805b3f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  805b43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b48:	c9                   	leave
+  805b49:	c3                   	ret
+
+0000000000805b4a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805b4a:	55                   	push   %rbp
+  805b4b:	48 89 e5             	mov    %rsp,%rbp
+  805b4e:	41 57                	push   %r15
+  805b50:	48 83 ec 18          	sub    $0x18,%rsp
+  805b54:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805b54 <devcons_stat+0xa>
+  805b5b:	49 bb dc 24 00 00 00 	movabs $0x24dc,%r11
+  805b62:	00 00 00 
+  805b65:	4c 01 d8             	add    %r11,%rax
+  805b68:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805b6c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  805b70:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805b74:	48 b9 05 ea ff ff ff 	movabs $0xffffffffffffea05,%rcx
+  805b7b:	ff ff ff 
+  805b7e:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805b82:	48 89 ce             	mov    %rcx,%rsi
+  805b85:	48 89 d7             	mov    %rdx,%rdi
+  805b88:	49 89 c7             	mov    %rax,%r15
+  805b8b:	48 ba 69 94 ff ff ff 	movabs $0xffffffffffff9469,%rdx
+  805b92:	ff ff ff 
+  805b95:	48 01 c2             	add    %rax,%rdx
+  805b98:	ff d2                	call   *%rdx
+	return 0;
+  805b9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b9f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805ba3:	c9                   	leave
+  805ba4:	c3                   	ret
+
+0000000000805ba5 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805ba5:	55                   	push   %rbp
+  805ba6:	48 89 e5             	mov    %rsp,%rbp
+  805ba9:	41 57                	push   %r15
+  805bab:	53                   	push   %rbx
+  805bac:	48 83 ec 30          	sub    $0x30,%rsp
+  805bb0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bb0 <ipc_recv+0xb>
+  805bb7:	49 bb 80 24 00 00 00 	movabs $0x2480,%r11
+  805bbe:	00 00 00 
+  805bc1:	4c 01 db             	add    %r11,%rbx
+  805bc4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805bc8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805bcc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  805bd0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805bd5:	75 0e                	jne    805be5 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805bd7:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805bde:	00 00 00 
+  805be1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  805be5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805be9:	48 89 c7             	mov    %rax,%rdi
+  805bec:	49 89 df             	mov    %rbx,%r15
+  805bef:	48 b8 4e a4 ff ff ff 	movabs $0xffffffffffffa44e,%rax
+  805bf6:	ff ff ff 
+  805bf9:	48 01 d8             	add    %rbx,%rax
+  805bfc:	ff d0                	call   *%rax
+  805bfe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  805c01:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805c06:	74 2a                	je     805c32 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805c08:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c0c:	75 19                	jne    805c27 <ipc_recv+0x82>
+  805c0e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c15:	ff ff ff 
+  805c18:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c1c:	48 8b 00             	mov    (%rax),%rax
+  805c1f:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805c25:	eb 05                	jmp    805c2c <ipc_recv+0x87>
+  805c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c2c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805c30:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  805c32:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805c37:	74 2a                	je     805c63 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805c39:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c3d:	75 19                	jne    805c58 <ipc_recv+0xb3>
+  805c3f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c46:	ff ff ff 
+  805c49:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c4d:	48 8b 00             	mov    (%rax),%rax
+  805c50:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805c56:	eb 05                	jmp    805c5d <ipc_recv+0xb8>
+  805c58:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c5d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805c61:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805c63:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c67:	74 05                	je     805c6e <ipc_recv+0xc9>
+		return res;
+  805c69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c6c:	eb 17                	jmp    805c85 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805c6e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c75:	ff ff ff 
+  805c78:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c7c:	48 8b 00             	mov    (%rax),%rax
+  805c7f:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805c85:	48 83 c4 30          	add    $0x30,%rsp
+  805c89:	5b                   	pop    %rbx
+  805c8a:	41 5f                	pop    %r15
+  805c8c:	5d                   	pop    %rbp
+  805c8d:	c3                   	ret
+
+0000000000805c8e <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805c8e:	55                   	push   %rbp
+  805c8f:	48 89 e5             	mov    %rsp,%rbp
+  805c92:	41 57                	push   %r15
+  805c94:	53                   	push   %rbx
+  805c95:	48 83 ec 20          	sub    $0x20,%rsp
+  805c99:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c99 <ipc_send+0xb>
+  805ca0:	49 bb 97 23 00 00 00 	movabs $0x2397,%r11
+  805ca7:	00 00 00 
+  805caa:	4c 01 db             	add    %r11,%rbx
+  805cad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805cb0:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805cb3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805cb7:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805cba:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805cbf:	75 0e                	jne    805ccf <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805cc1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805cc8:	00 00 00 
+  805ccb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805ccf:	90                   	nop
+  805cd0:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805cd3:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805cd6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805cda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cdd:	89 c7                	mov    %eax,%edi
+  805cdf:	49 89 df             	mov    %rbx,%r15
+  805ce2:	48 b8 e4 a3 ff ff ff 	movabs $0xffffffffffffa3e4,%rax
+  805ce9:	ff ff ff 
+  805cec:	48 01 d8             	add    %rbx,%rax
+  805cef:	ff d0                	call   *%rax
+  805cf1:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805cf4:	74 da                	je     805cd0 <ipc_send+0x42>
+		;
+}
+  805cf6:	90                   	nop
+  805cf7:	90                   	nop
+  805cf8:	48 83 c4 20          	add    $0x20,%rsp
+  805cfc:	5b                   	pop    %rbx
+  805cfd:	41 5f                	pop    %r15
+  805cff:	5d                   	pop    %rbp
+  805d00:	c3                   	ret
+
+0000000000805d01 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805d01:	55                   	push   %rbp
+  805d02:	48 89 e5             	mov    %rsp,%rbp
+  805d05:	41 57                	push   %r15
+  805d07:	53                   	push   %rbx
+  805d08:	48 83 ec 40          	sub    $0x40,%rsp
+  805d0c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d0c <ipc_call+0xb>
+  805d13:	49 bb 24 23 00 00 00 	movabs $0x2324,%r11
+  805d1a:	00 00 00 
+  805d1d:	4c 01 db             	add    %r11,%rbx
+  805d20:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805d23:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805d26:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805d2a:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805d2d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805d31:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805d35:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805d3a:	75 0e                	jne    805d4a <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805d3c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805d43:	00 00 00 
+  805d46:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805d4a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805d4f:	75 0e                	jne    805d5f <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805d51:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805d58:	00 00 00 
+  805d5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805d5f:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805d62:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805d66:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805d69:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805d6d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d70:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805d76:	49 89 f8             	mov    %rdi,%r8
+  805d79:	89 c7                	mov    %eax,%edi
+  805d7b:	49 89 df             	mov    %rbx,%r15
+  805d7e:	48 b8 a7 a4 ff ff ff 	movabs $0xffffffffffffa4a7,%rax
+  805d85:	ff ff ff 
+  805d88:	48 01 d8             	add    %rbx,%rax
+  805d8b:	ff d0                	call   *%rax
+  805d8d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805d90:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805d95:	74 2a                	je     805dc1 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805d97:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d9b:	75 19                	jne    805db6 <ipc_call+0xb5>
+  805d9d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805da4:	ff ff ff 
+  805da7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805dab:	48 8b 00             	mov    (%rax),%rax
+  805dae:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805db4:	eb 05                	jmp    805dbb <ipc_call+0xba>
+  805db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dbb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805dbf:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805dc1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805dc5:	74 05                	je     805dcc <ipc_call+0xcb>
+		return r;
+  805dc7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dca:	eb 17                	jmp    805de3 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805dcc:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805dd3:	ff ff ff 
+  805dd6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805dda:	48 8b 00             	mov    (%rax),%rax
+  805ddd:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805de3:	48 83 c4 40          	add    $0x40,%rsp
+  805de7:	5b                   	pop    %rbx
+  805de8:	41 5f                	pop    %r15
+  805dea:	5d                   	pop    %rbp
+  805deb:	c3                   	ret
+
+0000000000805dec <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805dec:	55                   	push   %rbp
+  805ded:	48 89 e5             	mov    %rsp,%rbp
+  805df0:	41 57                	push   %r15
+  805df2:	53                   	push   %rbx
+  805df3:	48 83 ec 70          	sub    $0x70,%rsp
+  805df7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805df7 <ipc_callw+0xb>
+  805dfe:	49 bb 39 22 00 00 00 	movabs $0x2239,%r11
+  805e05:	00 00 00 
+  805e08:	4c 01 db             	add    %r11,%rbx
+  805e0b:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805e0e:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805e11:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805e15:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805e19:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805e1e:	76 0a                	jbe    805e2a <ipc_callw+0x3e>
+		return -E_INVAL;
+  805e20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805e25:	e9 b7 00 00 00       	jmp    805ee1 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805e2a:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805e2e:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805e32:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805e36:	48 89 ce             	mov    %rcx,%rsi
+  805e39:	48 89 c7             	mov    %rax,%rdi
+  805e3c:	49 89 df             	mov    %rbx,%r15
+  805e3f:	48 b8 49 98 ff ff ff 	movabs $0xffffffffffff9849,%rax
+  805e46:	ff ff ff 
+  805e49:	48 01 d8             	add    %rbx,%rax
+  805e4c:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805e4e:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805e55:	00 
+  805e56:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805e5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e5e:	48 01 d0             	add    %rdx,%rax
+  805e61:	48 83 e8 01          	sub    $0x1,%rax
+  805e65:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805e69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e72:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805e76:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e7a:	48 29 d0             	sub    %rdx,%rax
+  805e7d:	48 c1 e8 03          	shr    $0x3,%rax
+  805e81:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805e85:	89 c1                	mov    %eax,%ecx
+  805e87:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805e8a:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805e8e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805e91:	49 89 d1             	mov    %rdx,%r9
+  805e94:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805e9b:	00 00 00 
+  805e9e:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805ea5:	00 00 00 
+  805ea8:	89 c7                	mov    %eax,%edi
+  805eaa:	49 89 df             	mov    %rbx,%r15
+  805ead:	48 b8 a7 a4 ff ff ff 	movabs $0xffffffffffffa4a7,%rax
+  805eb4:	ff ff ff 
+  805eb7:	48 01 d8             	add    %rbx,%rax
+  805eba:	ff d0                	call   *%rax
+  805ebc:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805ebf:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ec3:	74 05                	je     805eca <ipc_callw+0xde>
+		return r;
+  805ec5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ec8:	eb 17                	jmp    805ee1 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805eca:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ed1:	ff ff ff 
+  805ed4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ed8:	48 8b 00             	mov    (%rax),%rax
+  805edb:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805ee1:	48 83 c4 70          	add    $0x70,%rsp
+  805ee5:	5b                   	pop    %rbx
+  805ee6:	41 5f                	pop    %r15
+  805ee8:	5d                   	pop    %rbp
+  805ee9:	c3                   	ret
+
+0000000000805eea <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805eea:	55                   	push   %rbp
+  805eeb:	48 89 e5             	mov    %rsp,%rbp
+  805eee:	41 57                	push   %r15
+  805ef0:	53                   	push   %rbx
+  805ef1:	48 83 ec 40          	sub    $0x40,%rsp
+  805ef5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ef5 <ipc_callv+0xb>
+  805efc:	49 bb 3b 21 00 00 00 	movabs $0x213b,%r11
+  805f03:	00 00 00 
+  805f06:	4c 01 db             	add    %r11,%rbx
+  805f09:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805f0c:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805f0f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805f13:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805f16:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805f1a:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805f1e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805f25:	00 00 00 
+  805f28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805f2c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805f30:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805f34:	74 11                	je     805f47 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805f36:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805f3a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805f3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805f41:	c1 e0 14             	shl    $0x14,%eax
+  805f44:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805f47:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805f4b:	74 14                	je     805f61 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805f4d:	8b 45 20             	mov    0x20(%rbp),%eax
+  805f50:	83 e8 01             	sub    $0x1,%eax
+  805f53:	48 63 d0             	movslq %eax,%rdx
+  805f56:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805f5a:	48 09 d0             	or     %rdx,%rax
+  805f5d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805f61:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805f64:	c1 e0 10             	shl    $0x10,%eax
+  805f67:	0b 45 10             	or     0x10(%rbp),%eax
+  805f6a:	89 c1                	mov    %eax,%ecx
+  805f6c:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805f6f:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805f73:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805f77:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805f7b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805f7e:	4d 89 c1             	mov    %r8,%r9
+  805f81:	49 89 f8             	mov    %rdi,%r8
+  805f84:	89 c7                	mov    %eax,%edi
+  805f86:	49 89 df             	mov    %rbx,%r15
+  805f89:	48 b8 a7 a4 ff ff ff 	movabs $0xffffffffffffa4a7,%rax
+  805f90:	ff ff ff 
+  805f93:	48 01 d8             	add    %rbx,%rax
+  805f96:	ff d0                	call   *%rax
+  805f98:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805f9b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805f9f:	74 05                	je     805fa6 <ipc_callv+0xbc>
+		return r;
+  805fa1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805fa4:	eb 17                	jmp    805fbd <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805fa6:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805fad:	ff ff ff 
+  805fb0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805fb4:	48 8b 00             	mov    (%rax),%rax
+  805fb7:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805fbd:	48 83 c4 40          	add    $0x40,%rsp
+  805fc1:	5b                   	pop    %rbx
+  805fc2:	41 5f                	pop    %r15
+  805fc4:	5d                   	pop    %rbp
+  805fc5:	c3                   	ret
+
+0000000000805fc6 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805fc6:	55                   	push   %rbp
+  805fc7:	48 89 e5             	mov    %rsp,%rbp
+  805fca:	41 57                	push   %r15
+  805fcc:	53                   	push   %rbx
+  805fcd:	48 83 ec 40          	sub    $0x40,%rsp
+  805fd1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fd1 <ipc_reply_recv+0xb>
+  805fd8:	49 bb 5f 20 00 00 00 	movabs $0x205f,%r11
+  805fdf:	00 00 00 
+  805fe2:	4c 01 db             	add    %r11,%rbx
+  805fe5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805fe8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805feb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805fef:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805ff2:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805ff6:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805ffa:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805fff:	75 0e                	jne    80600f <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806001:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806008:	00 00 00 
+  80600b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80600f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806014:	75 0e                	jne    806024 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806016:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80601d:	00 00 00 
+  806020:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806024:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806027:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  80602b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80602f:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806032:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806036:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806039:	4d 89 c1             	mov    %r8,%r9
+  80603c:	49 89 f8             	mov    %rdi,%r8
+  80603f:	89 c7                	mov    %eax,%edi
+  806041:	49 89 df             	mov    %rbx,%r15
+  806044:	48 b8 1b a5 ff ff ff 	movabs $0xffffffffffffa51b,%rax
+  80604b:	ff ff ff 
+  80604e:	48 01 d8             	add    %rbx,%rax
+  806051:	ff d0                	call   *%rax
+  806053:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806056:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80605b:	74 2a                	je     806087 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80605d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806061:	75 19                	jne    80607c <ipc_reply_recv+0xb6>
+  806063:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80606a:	ff ff ff 
+  80606d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806071:	48 8b 00             	mov    (%rax),%rax
+  806074:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80607a:	eb 05                	jmp    806081 <ipc_reply_recv+0xbb>
+  80607c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806081:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806085:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806087:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  80608c:	74 2a                	je     8060b8 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80608e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806092:	75 19                	jne    8060ad <ipc_reply_recv+0xe7>
+  806094:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80609b:	ff ff ff 
+  80609e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8060a2:	48 8b 00             	mov    (%rax),%rax
+  8060a5:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8060ab:	eb 05                	jmp    8060b2 <ipc_reply_recv+0xec>
+  8060ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060b2:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  8060b6:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8060b8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060bc:	74 05                	je     8060c3 <ipc_reply_recv+0xfd>
+		return r;
+  8060be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060c1:	eb 17                	jmp    8060da <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8060c3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8060ca:	ff ff ff 
+  8060cd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8060d1:	48 8b 00             	mov    (%rax),%rax
+  8060d4:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8060da:	48 83 c4 40          	add    $0x40,%rsp
+  8060de:	5b                   	pop    %rbx
+  8060df:	41 5f                	pop    %r15
+  8060e1:	5d                   	pop    %rbp
+  8060e2:	c3                   	ret
+
+00000000008060e3 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  8060e3:	55                   	push   %rbp
+  8060e4:	48 89 e5             	mov    %rsp,%rbp
+  8060e7:	41 57                	push   %r15
+  8060e9:	53                   	push   %rbx
+  8060ea:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  8060f1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060f1 <ipc_window_batch+0xe>
+  8060f8:	49 bb 3f 1f 00 00 00 	movabs $0x1f3f,%r11
+  8060ff:	00 00 00 
+  806102:	4c 01 db             	add    %r11,%rbx
+  806105:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  80610b:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806112:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806118:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  80611e:	e9 15 01 00 00       	jmp    806238 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806123:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806129:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80612c:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806133:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806136:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806139:	39 c2                	cmp    %eax,%edx
+  80613b:	0f 4e c2             	cmovle %edx,%eax
+  80613e:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806141:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806148:	eb 6b                	jmp    8061b5 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  80614a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80614d:	48 98                	cltq
+  80614f:	48 c1 e0 05          	shl    $0x5,%rax
+  806153:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806157:	48 01 e8             	add    %rbp,%rax
+  80615a:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806160:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806166:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806169:	c1 e0 0c             	shl    $0xc,%eax
+  80616c:	48 63 d0             	movslq %eax,%rdx
+  80616f:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806176:	48 01 c2             	add    %rax,%rdx
+  806179:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80617c:	48 98                	cltq
+  80617e:	48 c1 e0 05          	shl    $0x5,%rax
+  806182:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806186:	48 01 e8             	add    %rbp,%rax
+  806189:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  80618f:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806192:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806195:	48 98                	cltq
+  806197:	48 c1 e0 05          	shl    $0x5,%rax
+  80619b:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80619f:	48 01 e8             	add    %rbp,%rax
+  8061a2:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  8061a9:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  8061af:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  8061b1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8061b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061b8:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  8061bb:	7c 8d                	jl     80614a <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  8061bd:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8061c4:	74 27                	je     8061ed <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8061c6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8061c9:	48 63 d0             	movslq %eax,%rdx
+  8061cc:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8061d3:	48 89 d6             	mov    %rdx,%rsi
+  8061d6:	48 89 c7             	mov    %rax,%rdi
+  8061d9:	49 89 df             	mov    %rbx,%r15
+  8061dc:	48 b8 be a7 ff ff ff 	movabs $0xffffffffffffa7be,%rax
+  8061e3:	ff ff ff 
+  8061e6:	48 01 d8             	add    %rbx,%rax
+  8061e9:	ff d0                	call   *%rax
+  8061eb:	eb 25                	jmp    806212 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  8061ed:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8061f0:	48 63 d0             	movslq %eax,%rdx
+  8061f3:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8061fa:	48 89 d6             	mov    %rdx,%rsi
+  8061fd:	48 89 c7             	mov    %rax,%rdi
+  806200:	49 89 df             	mov    %rbx,%r15
+  806203:	48 b8 1c a8 ff ff ff 	movabs $0xffffffffffffa81c,%rax
+  80620a:	ff ff ff 
+  80620d:	48 01 d8             	add    %rbx,%rax
+  806210:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806212:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806215:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806219:	79 05                	jns    806220 <ipc_window_batch+0x13d>
+			return r;
+  80621b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80621e:	eb 2a                	jmp    80624a <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806220:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806223:	c1 e0 0c             	shl    $0xc,%eax
+  806226:	48 98                	cltq
+  806228:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  80622f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806232:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806238:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  80623f:	0f 8f de fe ff ff    	jg     806123 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806245:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80624a:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806251:	5b                   	pop    %rbx
+  806252:	41 5f                	pop    %r15
+  806254:	5d                   	pop    %rbp
+  806255:	c3                   	ret
+
+0000000000806256 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806256:	55                   	push   %rbp
+  806257:	48 89 e5             	mov    %rsp,%rbp
+  80625a:	48 83 ec 10          	sub    $0x10,%rsp
+  80625e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80625e <ipc_map_window+0x8>
+  806265:	49 bb d2 1d 00 00 00 	movabs $0x1dd2,%r11
+  80626c:	00 00 00 
+  80626f:	4c 01 d8             	add    %r11,%rax
+  806272:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806276:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806279:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80627c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806280:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806285:	bf 01 00 00 00       	mov    $0x1,%edi
+  80628a:	49 b8 b3 e0 ff ff ff 	movabs $0xffffffffffffe0b3,%r8
+  806291:	ff ff ff 
+  806294:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806298:	ff d0                	call   *%rax
+}
+  80629a:	c9                   	leave
+  80629b:	c3                   	ret
+
+000000000080629c <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  80629c:	55                   	push   %rbp
+  80629d:	48 89 e5             	mov    %rsp,%rbp
+  8062a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8062a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8062a4 <ipc_unmap_window+0x8>
+  8062ab:	49 bb 8c 1d 00 00 00 	movabs $0x1d8c,%r11
+  8062b2:	00 00 00 
+  8062b5:	4c 01 d8             	add    %r11,%rax
+  8062b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8062bc:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8062bf:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8062c2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8062c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8062cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8062d0:	49 b8 b3 e0 ff ff ff 	movabs $0xffffffffffffe0b3,%r8
+  8062d7:	ff ff ff 
+  8062da:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8062de:	ff d0                	call   *%rax
+}
+  8062e0:	c9                   	leave
+  8062e1:	c3                   	ret
+
+00000000008062e2 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8062e2:	55                   	push   %rbp
+  8062e3:	48 89 e5             	mov    %rsp,%rbp
+  8062e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8062ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8062ea <ipc_find_env+0x8>
+  8062f1:	49 bb 46 1d 00 00 00 	movabs $0x1d46,%r11
+  8062f8:	00 00 00 
+  8062fb:	4c 01 d8             	add    %r11,%rax
+  8062fe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806301:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806308:	eb 57                	jmp    806361 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  80630a:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  806311:	ff ff ff 
+  806314:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806318:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80631b:	48 63 d2             	movslq %edx,%rdx
+  80631e:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806325:	48 01 ca             	add    %rcx,%rdx
+  806328:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  80632f:	8b 12                	mov    (%rdx),%edx
+  806331:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806334:	75 27                	jne    80635d <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806336:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  80633d:	ff ff ff 
+  806340:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806344:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806347:	48 98                	cltq
+  806349:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806350:	48 01 d0             	add    %rdx,%rax
+  806353:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806359:	8b 00                	mov    (%rax),%eax
+  80635b:	eb 12                	jmp    80636f <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  80635d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806361:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806368:	7e a0                	jle    80630a <ipc_find_env+0x28>
+	}
+	return 0;
+  80636a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80636f:	c9                   	leave
+  806370:	c3                   	ret
+
+0000000000806371 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806371:	55                   	push   %rbp
+  806372:	48 89 e5             	mov    %rsp,%rbp
+  806375:	48 83 ec 18          	sub    $0x18,%rsp
+  806379:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806379 <pageref+0x8>
+  806380:	49 bb b7 1c 00 00 00 	movabs $0x1cb7,%r11
+  806387:	00 00 00 
+  80638a:	4c 01 d8             	add    %r11,%rax
+  80638d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806391:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806395:	48 89 d1             	mov    %rdx,%rcx
+  806398:	48 c1 e9 15          	shr    $0x15,%rcx
+  80639c:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8063a3:	ff ff ff 
+  8063a6:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8063aa:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8063ae:	83 e2 01             	and    $0x1,%edx
+  8063b1:	48 85 d2             	test   %rdx,%rdx
+  8063b4:	75 07                	jne    8063bd <pageref+0x4c>
+		return 0;
+  8063b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063bb:	eb 64                	jmp    806421 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  8063bd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8063c1:	48 89 d1             	mov    %rdx,%rcx
+  8063c4:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8063c8:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8063cf:	ff ff ff 
+  8063d2:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8063d6:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8063da:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8063de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8063e2:	83 e2 01             	and    $0x1,%edx
+  8063e5:	48 85 d2             	test   %rdx,%rdx
+  8063e8:	75 07                	jne    8063f1 <pageref+0x80>
+		return 0;
+  8063ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063ef:	eb 30                	jmp    806421 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8063f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8063f5:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8063f9:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806400:	ff ff ff 
+  806403:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806407:	48 89 d0             	mov    %rdx,%rax
+  80640a:	48 01 c0             	add    %rax,%rax
+  80640d:	48 01 d0             	add    %rdx,%rax
+  806410:	48 c1 e0 03          	shl    $0x3,%rax
+  806414:	48 01 c8             	add    %rcx,%rax
+  806417:	48 83 c0 08          	add    $0x8,%rax
+  80641b:	0f b7 00             	movzwl (%rax),%eax
+  80641e:	0f b7 c0             	movzwl %ax,%eax
+}
+  806421:	c9                   	leave
+  806422:	c3                   	ret
@@ -0,0 +1,9603 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 30 04 00 00       	call   800471 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+envid_t dumbfork(void);
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb ea 7f 00 00 00 	movabs $0x7fea,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	envid_t who;
+	int i;
+
+	// fork a child process
+	who = dumbfork();
+  800069:	48 b8 81 82 ff ff ff 	movabs $0xffffffffffff8281,%rax
+  800070:	ff ff ff 
+  800073:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800077:	ff d0                	call   *%rax
+  800079:	89 45 e8             	mov    %eax,-0x18(%rbp)
+
+	// print a message and yield to the other a few times
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  80007c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800083:	eb 6a                	jmp    8000ef <umain+0xac>
+		cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800085:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800089:	74 10                	je     80009b <umain+0x58>
+  80008b:	48 b8 c8 e1 ff ff ff 	movabs $0xffffffffffffe1c8,%rax
+  800092:	ff ff ff 
+  800095:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800099:	eb 0e                	jmp    8000a9 <umain+0x66>
+  80009b:	48 b8 cf e1 ff ff ff 	movabs $0xffffffffffffe1cf,%rax
+  8000a2:	ff ff ff 
+  8000a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000a9:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8000ac:	48 89 c2             	mov    %rax,%rdx
+  8000af:	89 ce                	mov    %ecx,%esi
+  8000b1:	48 b8 d5 e1 ff ff ff 	movabs $0xffffffffffffe1d5,%rax
+  8000b8:	ff ff ff 
+  8000bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000bf:	48 89 c7             	mov    %rax,%rdi
+  8000c2:	49 89 df             	mov    %rbx,%r15
+  8000c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ca:	48 b9 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%rcx
+  8000d1:	ff ff ff 
+  8000d4:	48 01 d9             	add    %rbx,%rcx
+  8000d7:	ff d1                	call   *%rcx
+		sys_yield();
+  8000d9:	49 89 df             	mov    %rbx,%r15
+  8000dc:	48 b8 43 a2 ff ff ff 	movabs $0xffffffffffffa243,%rax
+  8000e3:	ff ff ff 
+  8000e6:	48 01 d8             	add    %rbx,%rax
+  8000e9:	ff d0                	call   *%rax
+	for (i = 0; i < (who ? 10 : 20); i++) {
+  8000eb:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8000ef:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8000f3:	74 07                	je     8000fc <umain+0xb9>
+  8000f5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8000fa:	eb 05                	jmp    800101 <umain+0xbe>
+  8000fc:	b8 14 00 00 00       	mov    $0x14,%eax
+  800101:	3b 45 ec             	cmp    -0x14(%rbp),%eax
+  800104:	0f 8f 7b ff ff ff    	jg     800085 <umain+0x42>
+	}
+}
+  80010a:	90                   	nop
+  80010b:	90                   	nop
+  80010c:	48 83 c4 20          	add    $0x20,%rsp
+  800110:	5b                   	pop    %rbx
+  800111:	41 5f                	pop    %r15
+  800113:	5d                   	pop    %rbp
+  800114:	c3                   	ret
+
+0000000000800115 <duppage>:
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800115:	55                   	push   %rbp
+  800116:	48 89 e5             	mov    %rsp,%rbp
+  800119:	41 57                	push   %r15
+  80011b:	53                   	push   %rbx
+  80011c:	48 83 ec 20          	sub    $0x20,%rsp
+  800120:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800120 <duppage+0xb>
+  800127:	49 bb 18 7f 00 00 00 	movabs $0x7f18,%r11
+  80012e:	00 00 00 
+  800131:	4c 01 db             	add    %r11,%rbx
+  800134:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800137:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	// This is NOT what you should do in your fork.
+	if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  80013b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80013f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800142:	ba 07 00 00 00       	mov    $0x7,%edx
+  800147:	48 89 ce             	mov    %rcx,%rsi
+  80014a:	89 c7                	mov    %eax,%edi
+  80014c:	49 89 df             	mov    %rbx,%r15
+  80014f:	48 b8 98 a2 ff ff ff 	movabs $0xffffffffffffa298,%rax
+  800156:	ff ff ff 
+  800159:	48 01 d8             	add    %rbx,%rax
+  80015c:	ff d0                	call   *%rax
+  80015e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800161:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800165:	79 44                	jns    8001ab <duppage+0x96>
+		panic("sys_page_alloc: %e", r);
+  800167:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80016a:	89 c1                	mov    %eax,%ecx
+  80016c:	48 b8 e7 e1 ff ff ff 	movabs $0xffffffffffffe1e7,%rax
+  800173:	ff ff ff 
+  800176:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80017a:	48 89 c2             	mov    %rax,%rdx
+  80017d:	be 20 00 00 00       	mov    $0x20,%esi
+  800182:	48 b8 fa e1 ff ff ff 	movabs $0xffffffffffffe1fa,%rax
+  800189:	ff ff ff 
+  80018c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800190:	48 89 c7             	mov    %rax,%rdi
+  800193:	49 89 df             	mov    %rbx,%r15
+  800196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019b:	49 b8 43 85 ff ff ff 	movabs $0xffffffffffff8543,%r8
+  8001a2:	ff ff ff 
+  8001a5:	49 01 d8             	add    %rbx,%r8
+  8001a8:	41 ff d0             	call   *%r8
+	if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8001ab:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8001af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001b2:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8001b8:	b9 00 00 40 00       	mov    $0x400000,%ecx
+  8001bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c2:	89 c7                	mov    %eax,%edi
+  8001c4:	49 89 df             	mov    %rbx,%r15
+  8001c7:	48 b8 fd a2 ff ff ff 	movabs $0xffffffffffffa2fd,%rax
+  8001ce:	ff ff ff 
+  8001d1:	48 01 d8             	add    %rbx,%rax
+  8001d4:	ff d0                	call   *%rax
+  8001d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8001d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001dd:	79 44                	jns    800223 <duppage+0x10e>
+		panic("sys_page_map: %e", r);
+  8001df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001e2:	89 c1                	mov    %eax,%ecx
+  8001e4:	48 b8 0a e2 ff ff ff 	movabs $0xffffffffffffe20a,%rax
+  8001eb:	ff ff ff 
+  8001ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f2:	48 89 c2             	mov    %rax,%rdx
+  8001f5:	be 22 00 00 00       	mov    $0x22,%esi
+  8001fa:	48 b8 fa e1 ff ff ff 	movabs $0xffffffffffffe1fa,%rax
+  800201:	ff ff ff 
+  800204:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800208:	48 89 c7             	mov    %rax,%rdi
+  80020b:	49 89 df             	mov    %rbx,%r15
+  80020e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800213:	49 b8 43 85 ff ff ff 	movabs $0xffffffffffff8543,%r8
+  80021a:	ff ff ff 
+  80021d:	49 01 d8             	add    %rbx,%r8
+  800220:	41 ff d0             	call   *%r8
+	memmove(UTEMP, addr, PGSIZE);
+  800223:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800227:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80022c:	48 89 c6             	mov    %rax,%rsi
+  80022f:	bf 00 00 40 00       	mov    $0x400000,%edi
+  800234:	49 89 df             	mov    %rbx,%r15
+  800237:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  80023e:	ff ff ff 
+  800241:	48 01 d8             	add    %rbx,%rax
+  800244:	ff d0                	call   *%rax
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  800246:	be 00 00 40 00       	mov    $0x400000,%esi
+  80024b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800250:	49 89 df             	mov    %rbx,%r15
+  800253:	48 b8 70 a3 ff ff ff 	movabs $0xffffffffffffa370,%rax
+  80025a:	ff ff ff 
+  80025d:	48 01 d8             	add    %rbx,%rax
+  800260:	ff d0                	call   *%rax
+  800262:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800265:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800269:	79 44                	jns    8002af <duppage+0x19a>
+		panic("sys_page_unmap: %e", r);
+  80026b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80026e:	89 c1                	mov    %eax,%ecx
+  800270:	48 b8 1b e2 ff ff ff 	movabs $0xffffffffffffe21b,%rax
+  800277:	ff ff ff 
+  80027a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80027e:	48 89 c2             	mov    %rax,%rdx
+  800281:	be 25 00 00 00       	mov    $0x25,%esi
+  800286:	48 b8 fa e1 ff ff ff 	movabs $0xffffffffffffe1fa,%rax
+  80028d:	ff ff ff 
+  800290:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800294:	48 89 c7             	mov    %rax,%rdi
+  800297:	49 89 df             	mov    %rbx,%r15
+  80029a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029f:	49 b8 43 85 ff ff ff 	movabs $0xffffffffffff8543,%r8
+  8002a6:	ff ff ff 
+  8002a9:	49 01 d8             	add    %rbx,%r8
+  8002ac:	41 ff d0             	call   *%r8
+}
+  8002af:	90                   	nop
+  8002b0:	48 83 c4 20          	add    $0x20,%rsp
+  8002b4:	5b                   	pop    %rbx
+  8002b5:	41 5f                	pop    %r15
+  8002b7:	5d                   	pop    %rbp
+  8002b8:	c3                   	ret
+
+00000000008002b9 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8002b9:	55                   	push   %rbp
+  8002ba:	48 89 e5             	mov    %rsp,%rbp
+  8002bd:	41 57                	push   %r15
+  8002bf:	53                   	push   %rbx
+  8002c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8002c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8002c4 <dumbfork+0xb>
+  8002cb:	49 bb 74 7d 00 00 00 	movabs $0x7d74,%r11
+  8002d2:	00 00 00 
+  8002d5:	4c 01 db             	add    %r11,%rbx
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8002d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8002dd:	cd 30                	int    $0x30
+  8002df:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8002e2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+	// Allocate a new child environment.
+	// The kernel will initialize it with a copy of our register state,
+	// so that the child will appear to have called sys_exofork() too -
+	// except that in the child, this "fake" call to sys_exofork()
+	// will return 0 instead of the envid of the child.
+	envid = sys_exofork();
+  8002e5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (envid < 0)
+  8002e8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8002ec:	79 44                	jns    800332 <dumbfork+0x79>
+		panic("sys_exofork: %e", envid);
+  8002ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002f1:	89 c1                	mov    %eax,%ecx
+  8002f3:	48 b8 2e e2 ff ff ff 	movabs $0xffffffffffffe22e,%rax
+  8002fa:	ff ff ff 
+  8002fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800301:	48 89 c2             	mov    %rax,%rdx
+  800304:	be 37 00 00 00       	mov    $0x37,%esi
+  800309:	48 b8 fa e1 ff ff ff 	movabs $0xffffffffffffe1fa,%rax
+  800310:	ff ff ff 
+  800313:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800317:	48 89 c7             	mov    %rax,%rdi
+  80031a:	49 89 df             	mov    %rbx,%r15
+  80031d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800322:	49 b8 43 85 ff ff ff 	movabs $0xffffffffffff8543,%r8
+  800329:	ff ff ff 
+  80032c:	49 01 d8             	add    %rbx,%r8
+  80032f:	41 ff d0             	call   *%r8
+	if (envid == 0) {
+  800332:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800336:	75 4c                	jne    800384 <dumbfork+0xcb>
+		// We're the child.
+		// The copied value of the global variable 'thisenv'
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+  800338:	49 89 df             	mov    %rbx,%r15
+  80033b:	48 b8 ef a1 ff ff ff 	movabs $0xffffffffffffa1ef,%rax
+  800342:	ff ff ff 
+  800345:	48 01 d8             	add    %rbx,%rax
+  800348:	ff d0                	call   *%rax
+  80034a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80034f:	48 98                	cltq
+  800351:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800358:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80035f:	ff ff ff 
+  800362:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800366:	48 01 c2             	add    %rax,%rdx
+  800369:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  800370:	ff ff ff 
+  800373:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800377:	48 89 10             	mov    %rdx,(%rax)
+		return 0;
+  80037a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037f:	e9 e4 00 00 00       	jmp    800468 <dumbfork+0x1af>
+	}
+
+	// We're the parent.
+	// Eagerly copy our entire address space into the child.
+	// This is NOT what you should do in your fork implementation.
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  800384:	48 c7 45 d0 00 00 80 	movq   $0x800000,-0x30(%rbp)
+  80038b:	00 
+  80038c:	eb 2a                	jmp    8003b8 <dumbfork+0xff>
+		duppage(envid, addr);
+  80038e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800392:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800395:	48 89 d6             	mov    %rdx,%rsi
+  800398:	89 c7                	mov    %eax,%edi
+  80039a:	48 b8 dd 80 ff ff ff 	movabs $0xffffffffffff80dd,%rax
+  8003a1:	ff ff ff 
+  8003a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003a8:	ff d0                	call   *%rax
+	for (addr = (uint8_t*) UTEXT; addr < end; addr += PGSIZE)
+  8003aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8003ae:	48 05 00 10 00 00    	add    $0x1000,%rax
+  8003b4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8003b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8003bc:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8003c3:	ff ff ff 
+  8003c6:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8003ca:	48 39 d0             	cmp    %rdx,%rax
+  8003cd:	72 bf                	jb     80038e <dumbfork+0xd5>
+
+	// Also copy the stack we are currently running on.
+	duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  8003cf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003d3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8003d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003db:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8003e1:	48 89 c2             	mov    %rax,%rdx
+  8003e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003e7:	48 89 d6             	mov    %rdx,%rsi
+  8003ea:	89 c7                	mov    %eax,%edi
+  8003ec:	48 b8 dd 80 ff ff ff 	movabs $0xffffffffffff80dd,%rax
+  8003f3:	ff ff ff 
+  8003f6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003fa:	ff d0                	call   *%rax
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8003fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003ff:	be 02 00 00 00       	mov    $0x2,%esi
+  800404:	89 c7                	mov    %eax,%edi
+  800406:	49 89 df             	mov    %rbx,%r15
+  800409:	48 b8 cf a3 ff ff ff 	movabs $0xffffffffffffa3cf,%rax
+  800410:	ff ff ff 
+  800413:	48 01 d8             	add    %rbx,%rax
+  800416:	ff d0                	call   *%rax
+  800418:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80041b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80041f:	79 44                	jns    800465 <dumbfork+0x1ac>
+		panic("sys_env_set_status: %e", r);
+  800421:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800424:	89 c1                	mov    %eax,%ecx
+  800426:	48 b8 3e e2 ff ff ff 	movabs $0xffffffffffffe23e,%rax
+  80042d:	ff ff ff 
+  800430:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800434:	48 89 c2             	mov    %rax,%rdx
+  800437:	be 4c 00 00 00       	mov    $0x4c,%esi
+  80043c:	48 b8 fa e1 ff ff ff 	movabs $0xffffffffffffe1fa,%rax
+  800443:	ff ff ff 
+  800446:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80044a:	48 89 c7             	mov    %rax,%rdi
+  80044d:	49 89 df             	mov    %rbx,%r15
+  800450:	b8 00 00 00 00       	mov    $0x0,%eax
+  800455:	49 b8 43 85 ff ff ff 	movabs $0xffffffffffff8543,%r8
+  80045c:	ff ff ff 
+  80045f:	49 01 d8             	add    %rbx,%r8
+  800462:	41 ff d0             	call   *%r8
+
+	return envid;
+  800465:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  800468:	48 83 c4 20          	add    $0x20,%rsp
+  80046c:	5b                   	pop    %rbx
+  80046d:	41 5f                	pop    %r15
+  80046f:	5d                   	pop    %rbp
+  800470:	c3                   	ret
+
+0000000000800471 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800471:	55                   	push   %rbp
+  800472:	48 89 e5             	mov    %rsp,%rbp
+  800475:	41 57                	push   %r15
+  800477:	53                   	push   %rbx
+  800478:	48 83 ec 20          	sub    $0x20,%rsp
+  80047c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80047c <libmain+0xb>
+  800483:	49 bb bc 7b 00 00 00 	movabs $0x7bbc,%r11
+  80048a:	00 00 00 
+  80048d:	4c 01 db             	add    %r11,%rbx
+  800490:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800493:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800497:	49 89 df             	mov    %rbx,%r15
+  80049a:	48 b8 ef a1 ff ff ff 	movabs $0xffffffffffffa1ef,%rax
+  8004a1:	ff ff ff 
+  8004a4:	48 01 d8             	add    %rbx,%rax
+  8004a7:	ff d0                	call   *%rax
+  8004a9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8004ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004af:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004b4:	48 98                	cltq
+  8004b6:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8004bd:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8004c4:	ff ff ff 
+  8004c7:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8004cb:	48 01 c2             	add    %rax,%rdx
+  8004ce:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8004d5:	00 00 00 
+  8004d8:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004dc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8004e0:	7e 15                	jle    8004f7 <libmain+0x86>
+		binaryname = argv[0];
+  8004e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004e6:	48 8b 00             	mov    (%rax),%rax
+  8004e9:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  8004f0:	00 00 00 
+  8004f3:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8004f7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8004fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004fe:	48 89 d6             	mov    %rdx,%rsi
+  800501:	89 c7                	mov    %eax,%edi
+  800503:	49 89 df             	mov    %rbx,%r15
+  800506:	48 b8 0b 80 ff ff ff 	movabs $0xffffffffffff800b,%rax
+  80050d:	ff ff ff 
+  800510:	48 01 d8             	add    %rbx,%rax
+  800513:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800515:	49 89 df             	mov    %rbx,%r15
+  800518:	48 b8 f9 84 ff ff ff 	movabs $0xffffffffffff84f9,%rax
+  80051f:	ff ff ff 
+  800522:	48 01 d8             	add    %rbx,%rax
+  800525:	ff d0                	call   *%rax
+}
+  800527:	90                   	nop
+  800528:	48 83 c4 20          	add    $0x20,%rsp
+  80052c:	5b                   	pop    %rbx
+  80052d:	41 5f                	pop    %r15
+  80052f:	5d                   	pop    %rbp
+  800530:	c3                   	ret
+
+0000000000800531 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800531:	55                   	push   %rbp
+  800532:	48 89 e5             	mov    %rsp,%rbp
+  800535:	41 57                	push   %r15
+  800537:	53                   	push   %rbx
+  800538:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800538 <exit+0x7>
+  80053f:	49 bb 00 7b 00 00 00 	movabs $0x7b00,%r11
+  800546:	00 00 00 
+  800549:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80054c:	49 89 df             	mov    %rbx,%r15
+  80054f:	48 b8 6c ae ff ff ff 	movabs $0xffffffffffffae6c,%rax
+  800556:	ff ff ff 
+  800559:	48 01 d8             	add    %rbx,%rax
+  80055c:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80055e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800563:	49 89 df             	mov    %rbx,%r15
+  800566:	48 b8 93 a1 ff ff ff 	movabs $0xffffffffffffa193,%rax
+  80056d:	ff ff ff 
+  800570:	48 01 d8             	add    %rbx,%rax
+  800573:	ff d0                	call   *%rax
+}
+  800575:	90                   	nop
+  800576:	5b                   	pop    %rbx
+  800577:	41 5f                	pop    %r15
+  800579:	5d                   	pop    %rbp
+  80057a:	c3                   	ret
+
+000000000080057b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80057b:	55                   	push   %rbp
+  80057c:	48 89 e5             	mov    %rsp,%rbp
+  80057f:	41 57                	push   %r15
+  800581:	41 54                	push   %r12
+  800583:	53                   	push   %rbx
+  800584:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80058b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80058b <_panic+0x10>
+  800592:	49 bb ad 7a 00 00 00 	movabs $0x7aad,%r11
+  800599:	00 00 00 
+  80059c:	4c 01 db             	add    %r11,%rbx
+  80059f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8005a6:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8005ac:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8005b3:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8005ba:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8005c1:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8005c8:	84 c0                	test   %al,%al
+  8005ca:	74 26                	je     8005f2 <_panic+0x77>
+  8005cc:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8005d3:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8005da:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8005de:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8005e2:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8005e6:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8005ea:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8005ee:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005f2:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8005f9:	00 00 00 
+  8005fc:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800603:	00 00 00 
+  800606:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80060a:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800611:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800618:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80061f:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  800626:	ff ff ff 
+  800629:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80062d:	4c 8b 20             	mov    (%rax),%r12
+  800630:	49 89 df             	mov    %rbx,%r15
+  800633:	48 b8 ef a1 ff ff ff 	movabs $0xffffffffffffa1ef,%rax
+  80063a:	ff ff ff 
+  80063d:	48 01 d8             	add    %rbx,%rax
+  800640:	ff d0                	call   *%rax
+  800642:	89 c6                	mov    %eax,%esi
+  800644:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80064a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800651:	41 89 d0             	mov    %edx,%r8d
+  800654:	48 89 c1             	mov    %rax,%rcx
+  800657:	4c 89 e2             	mov    %r12,%rdx
+  80065a:	48 b8 60 e2 ff ff ff 	movabs $0xffffffffffffe260,%rax
+  800661:	ff ff ff 
+  800664:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800668:	48 89 c7             	mov    %rax,%rdi
+  80066b:	49 89 df             	mov    %rbx,%r15
+  80066e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800673:	49 b9 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%r9
+  80067a:	ff ff ff 
+  80067d:	49 01 d9             	add    %rbx,%r9
+  800680:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800683:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80068a:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800691:	48 89 d6             	mov    %rdx,%rsi
+  800694:	48 89 c7             	mov    %rax,%rdi
+  800697:	49 89 df             	mov    %rbx,%r15
+  80069a:	48 b8 3a 87 ff ff ff 	movabs $0xffffffffffff873a,%rax
+  8006a1:	ff ff ff 
+  8006a4:	48 01 d8             	add    %rbx,%rax
+  8006a7:	ff d0                	call   *%rax
+	cprintf("\n");
+  8006a9:	48 b8 83 e2 ff ff ff 	movabs $0xffffffffffffe283,%rax
+  8006b0:	ff ff ff 
+  8006b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006b7:	48 89 c7             	mov    %rax,%rdi
+  8006ba:	49 89 df             	mov    %rbx,%r15
+  8006bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c2:	48 ba 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%rdx
+  8006c9:	ff ff ff 
+  8006cc:	48 01 da             	add    %rbx,%rdx
+  8006cf:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006d1:	cc                   	int3
+  8006d2:	eb fd                	jmp    8006d1 <_panic+0x156>
+
+00000000008006d4 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8006d4:	55                   	push   %rbp
+  8006d5:	48 89 e5             	mov    %rsp,%rbp
+  8006d8:	41 57                	push   %r15
+  8006da:	48 83 ec 18          	sub    $0x18,%rsp
+  8006de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006de <putch+0xa>
+  8006e5:	49 bb 5a 79 00 00 00 	movabs $0x795a,%r11
+  8006ec:	00 00 00 
+  8006ef:	4c 01 d8             	add    %r11,%rax
+  8006f2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8006f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8006f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006fd:	8b 12                	mov    (%rdx),%edx
+  8006ff:	8d 72 01             	lea    0x1(%rdx),%esi
+  800702:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800706:	89 31                	mov    %esi,(%rcx)
+  800708:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80070b:	89 ce                	mov    %ecx,%esi
+  80070d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800711:	48 63 d2             	movslq %edx,%rdx
+  800714:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800719:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80071d:	8b 12                	mov    (%rdx),%edx
+  80071f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800725:	75 33                	jne    80075a <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800727:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80072b:	8b 12                	mov    (%rdx),%edx
+  80072d:	48 63 d2             	movslq %edx,%rdx
+  800730:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800734:	48 83 c1 08          	add    $0x8,%rcx
+  800738:	48 89 d6             	mov    %rdx,%rsi
+  80073b:	48 89 cf             	mov    %rcx,%rdi
+  80073e:	49 89 c7             	mov    %rax,%r15
+  800741:	48 ba e0 a0 ff ff ff 	movabs $0xffffffffffffa0e0,%rdx
+  800748:	ff ff ff 
+  80074b:	48 01 c2             	add    %rax,%rdx
+  80074e:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800750:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800754:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80075a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80075e:	8b 40 04             	mov    0x4(%rax),%eax
+  800761:	8d 50 01             	lea    0x1(%rax),%edx
+  800764:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800768:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80076b:	90                   	nop
+  80076c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800770:	c9                   	leave
+  800771:	c3                   	ret
+
+0000000000800772 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800772:	55                   	push   %rbp
+  800773:	48 89 e5             	mov    %rsp,%rbp
+  800776:	41 57                	push   %r15
+  800778:	53                   	push   %rbx
+  800779:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800780:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800780 <vcprintf+0xe>
+  800787:	49 bb b8 78 00 00 00 	movabs $0x78b8,%r11
+  80078e:	00 00 00 
+  800791:	4c 01 db             	add    %r11,%rbx
+  800794:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80079b:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8007a2:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8007a9:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8007b0:	48 8b 06             	mov    (%rsi),%rax
+  8007b3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007b7:	48 89 01             	mov    %rax,(%rcx)
+  8007ba:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007be:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007c2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8007c6:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8007cd:	00 00 00 
+    b.cnt = 0;
+  8007d0:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8007d7:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8007da:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8007e1:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8007e8:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8007ef:	48 89 c6             	mov    %rax,%rsi
+  8007f2:	48 b8 9c 86 ff ff ff 	movabs $0xffffffffffff869c,%rax
+  8007f9:	ff ff ff 
+  8007fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800800:	48 89 c7             	mov    %rax,%rdi
+  800803:	49 89 df             	mov    %rbx,%r15
+  800806:	48 b8 5e 8c ff ff ff 	movabs $0xffffffffffff8c5e,%rax
+  80080d:	ff ff ff 
+  800810:	48 01 d8             	add    %rbx,%rax
+  800813:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800815:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80081b:	48 98                	cltq
+  80081d:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800824:	48 83 c2 08          	add    $0x8,%rdx
+  800828:	48 89 c6             	mov    %rax,%rsi
+  80082b:	48 89 d7             	mov    %rdx,%rdi
+  80082e:	49 89 df             	mov    %rbx,%r15
+  800831:	48 b8 e0 a0 ff ff ff 	movabs $0xffffffffffffa0e0,%rax
+  800838:	ff ff ff 
+  80083b:	48 01 d8             	add    %rbx,%rax
+  80083e:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800840:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800846:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80084d:	5b                   	pop    %rbx
+  80084e:	41 5f                	pop    %r15
+  800850:	5d                   	pop    %rbp
+  800851:	c3                   	ret
+
+0000000000800852 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800852:	55                   	push   %rbp
+  800853:	48 89 e5             	mov    %rsp,%rbp
+  800856:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80085d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80085d <cprintf+0xb>
+  800864:	49 bb db 77 00 00 00 	movabs $0x77db,%r11
+  80086b:	00 00 00 
+  80086e:	4d 01 da             	add    %r11,%r10
+  800871:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800878:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80087f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800886:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80088d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800894:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80089b:	84 c0                	test   %al,%al
+  80089d:	74 20                	je     8008bf <cprintf+0x6d>
+  80089f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8008a3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8008a7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8008ab:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8008af:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8008b3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8008b7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8008bb:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8008bf:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8008c6:	00 00 00 
+  8008c9:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8008d0:	00 00 00 
+  8008d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008d7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8008de:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8008e5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8008ec:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8008f3:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8008fa:	48 8b 06             	mov    (%rsi),%rax
+  8008fd:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800901:	48 89 01             	mov    %rax,(%rcx)
+  800904:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800908:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80090c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800910:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800917:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80091e:	48 89 d6             	mov    %rdx,%rsi
+  800921:	48 89 c7             	mov    %rax,%rdi
+  800924:	48 b8 3a 87 ff ff ff 	movabs $0xffffffffffff873a,%rax
+  80092b:	ff ff ff 
+  80092e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800932:	ff d0                	call   *%rax
+  800934:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80093a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800940:	c9                   	leave
+  800941:	c3                   	ret
+
+0000000000800942 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800942:	55                   	push   %rbp
+  800943:	48 89 e5             	mov    %rsp,%rbp
+  800946:	53                   	push   %rbx
+  800947:	48 83 ec 38          	sub    $0x38,%rsp
+  80094b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80094b <printnum+0x9>
+  800952:	49 bb ed 76 00 00 00 	movabs $0x76ed,%r11
+  800959:	00 00 00 
+  80095c:	4c 01 db             	add    %r11,%rbx
+  80095f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800963:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800967:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80096b:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80096e:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800972:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800976:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800979:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80097d:	72 58                	jb     8009d7 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80097f:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800982:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800985:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800988:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80098c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800991:	48 f7 f6             	div    %rsi
+  800994:	49 89 c2             	mov    %rax,%r10
+  800997:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80099a:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80099d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8009a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a5:	41 89 c9             	mov    %ecx,%r9d
+  8009a8:	41 89 f8             	mov    %edi,%r8d
+  8009ab:	89 d1                	mov    %edx,%ecx
+  8009ad:	4c 89 d2             	mov    %r10,%rdx
+  8009b0:	48 89 c7             	mov    %rax,%rdi
+  8009b3:	48 b8 0a 89 ff ff ff 	movabs $0xffffffffffff890a,%rax
+  8009ba:	ff ff ff 
+  8009bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009c1:	ff d0                	call   *%rax
+  8009c3:	eb 1c                	jmp    8009e1 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8009c9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8009cc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009d0:	48 89 d6             	mov    %rdx,%rsi
+  8009d3:	89 c7                	mov    %eax,%edi
+  8009d5:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8009d7:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8009db:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8009df:	7f e4                	jg     8009c5 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8009e1:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8009e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ed:	48 f7 f1             	div    %rcx
+  8009f0:	48 b8 bf e3 ff ff ff 	movabs $0xffffffffffffe3bf,%rax
+  8009f7:	ff ff ff 
+  8009fa:	48 01 d8             	add    %rbx,%rax
+  8009fd:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800a01:	0f be c0             	movsbl %al,%eax
+  800a04:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a08:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a0c:	48 89 d6             	mov    %rdx,%rsi
+  800a0f:	89 c7                	mov    %eax,%edi
+  800a11:	ff d1                	call   *%rcx
+}
+  800a13:	90                   	nop
+  800a14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a18:	c9                   	leave
+  800a19:	c3                   	ret
+
+0000000000800a1a <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800a1a:	55                   	push   %rbp
+  800a1b:	48 89 e5             	mov    %rsp,%rbp
+  800a1e:	48 83 ec 20          	sub    $0x20,%rsp
+  800a22:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a22 <getuint+0x8>
+  800a29:	49 bb 16 76 00 00 00 	movabs $0x7616,%r11
+  800a30:	00 00 00 
+  800a33:	4c 01 d8             	add    %r11,%rax
+  800a36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a3a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800a3d:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a41:	7e 4f                	jle    800a92 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800a43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a47:	8b 00                	mov    (%rax),%eax
+  800a49:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4c:	77 24                	ja     800a72 <getuint+0x58>
+  800a4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a52:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5a:	8b 00                	mov    (%rax),%eax
+  800a5c:	89 c0                	mov    %eax,%eax
+  800a5e:	48 01 d0             	add    %rdx,%rax
+  800a61:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a65:	8b 12                	mov    (%rdx),%edx
+  800a67:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a6a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a6e:	89 0a                	mov    %ecx,(%rdx)
+  800a70:	eb 14                	jmp    800a86 <getuint+0x6c>
+  800a72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a76:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a7a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a82:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a86:	48 8b 00             	mov    (%rax),%rax
+  800a89:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a8d:	e9 9d 00 00 00       	jmp    800b2f <getuint+0x115>
+	else if (lflag)
+  800a92:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800a96:	74 4c                	je     800ae4 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800a98:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a9c:	8b 00                	mov    (%rax),%eax
+  800a9e:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa1:	77 24                	ja     800ac7 <getuint+0xad>
+  800aa3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800aab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aaf:	8b 00                	mov    (%rax),%eax
+  800ab1:	89 c0                	mov    %eax,%eax
+  800ab3:	48 01 d0             	add    %rdx,%rax
+  800ab6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aba:	8b 12                	mov    (%rdx),%edx
+  800abc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800abf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ac3:	89 0a                	mov    %ecx,(%rdx)
+  800ac5:	eb 14                	jmp    800adb <getuint+0xc1>
+  800ac7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800acb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800acf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ad3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ad7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800adb:	48 8b 00             	mov    (%rax),%rax
+  800ade:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800ae2:	eb 4b                	jmp    800b2f <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800ae4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae8:	8b 00                	mov    (%rax),%eax
+  800aea:	83 f8 2f             	cmp    $0x2f,%eax
+  800aed:	77 24                	ja     800b13 <getuint+0xf9>
+  800aef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800af7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afb:	8b 00                	mov    (%rax),%eax
+  800afd:	89 c0                	mov    %eax,%eax
+  800aff:	48 01 d0             	add    %rdx,%rax
+  800b02:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b06:	8b 12                	mov    (%rdx),%edx
+  800b08:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b0b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b0f:	89 0a                	mov    %ecx,(%rdx)
+  800b11:	eb 14                	jmp    800b27 <getuint+0x10d>
+  800b13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b17:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b1b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b1f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b23:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b27:	8b 00                	mov    (%rax),%eax
+  800b29:	89 c0                	mov    %eax,%eax
+  800b2b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b33:	c9                   	leave
+  800b34:	c3                   	ret
+
+0000000000800b35 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800b35:	55                   	push   %rbp
+  800b36:	48 89 e5             	mov    %rsp,%rbp
+  800b39:	48 83 ec 20          	sub    $0x20,%rsp
+  800b3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b3d <printfloat+0x8>
+  800b44:	49 bb fb 74 00 00 00 	movabs $0x74fb,%r11
+  800b4b:	00 00 00 
+  800b4e:	4c 01 d8             	add    %r11,%rax
+  800b51:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800b55:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800b59:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800b5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b61:	48 85 c0             	test   %rax,%rax
+  800b64:	79 12                	jns    800b78 <printfloat+0x43>
+		putch('-',putdat);
+  800b66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b6a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b6e:	48 89 c6             	mov    %rax,%rsi
+  800b71:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b76:	ff d2                	call   *%rdx
+	
+}
+  800b78:	90                   	nop
+  800b79:	c9                   	leave
+  800b7a:	c3                   	ret
+
+0000000000800b7b <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800b7b:	55                   	push   %rbp
+  800b7c:	48 89 e5             	mov    %rsp,%rbp
+  800b7f:	48 83 ec 20          	sub    $0x20,%rsp
+  800b83:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b83 <getint+0x8>
+  800b8a:	49 bb b5 74 00 00 00 	movabs $0x74b5,%r11
+  800b91:	00 00 00 
+  800b94:	4c 01 d8             	add    %r11,%rax
+  800b97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b9b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800b9e:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800ba2:	7e 4f                	jle    800bf3 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800ba4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba8:	8b 00                	mov    (%rax),%eax
+  800baa:	83 f8 2f             	cmp    $0x2f,%eax
+  800bad:	77 24                	ja     800bd3 <getint+0x58>
+  800baf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bb3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800bb7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bbb:	8b 00                	mov    (%rax),%eax
+  800bbd:	89 c0                	mov    %eax,%eax
+  800bbf:	48 01 d0             	add    %rdx,%rax
+  800bc2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bc6:	8b 12                	mov    (%rdx),%edx
+  800bc8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bcb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bcf:	89 0a                	mov    %ecx,(%rdx)
+  800bd1:	eb 14                	jmp    800be7 <getint+0x6c>
+  800bd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bd7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bdb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bdf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800be3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800be7:	48 8b 00             	mov    (%rax),%rax
+  800bea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800bee:	e9 9d 00 00 00       	jmp    800c90 <getint+0x115>
+	else if (lflag)
+  800bf3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800bf7:	74 4c                	je     800c45 <getint+0xca>
+		x=va_arg(*ap, long);
+  800bf9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bfd:	8b 00                	mov    (%rax),%eax
+  800bff:	83 f8 2f             	cmp    $0x2f,%eax
+  800c02:	77 24                	ja     800c28 <getint+0xad>
+  800c04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c08:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c10:	8b 00                	mov    (%rax),%eax
+  800c12:	89 c0                	mov    %eax,%eax
+  800c14:	48 01 d0             	add    %rdx,%rax
+  800c17:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c1b:	8b 12                	mov    (%rdx),%edx
+  800c1d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c24:	89 0a                	mov    %ecx,(%rdx)
+  800c26:	eb 14                	jmp    800c3c <getint+0xc1>
+  800c28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c2c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c30:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c34:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c38:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c3c:	48 8b 00             	mov    (%rax),%rax
+  800c3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c43:	eb 4b                	jmp    800c90 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800c45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c49:	8b 00                	mov    (%rax),%eax
+  800c4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4e:	77 24                	ja     800c74 <getint+0xf9>
+  800c50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c54:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c5c:	8b 00                	mov    (%rax),%eax
+  800c5e:	89 c0                	mov    %eax,%eax
+  800c60:	48 01 d0             	add    %rdx,%rax
+  800c63:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c67:	8b 12                	mov    (%rdx),%edx
+  800c69:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c6c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c70:	89 0a                	mov    %ecx,(%rdx)
+  800c72:	eb 14                	jmp    800c88 <getint+0x10d>
+  800c74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c78:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c7c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c80:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c84:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c88:	8b 00                	mov    (%rax),%eax
+  800c8a:	48 98                	cltq
+  800c8c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800c90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800c94:	c9                   	leave
+  800c95:	c3                   	ret
+
+0000000000800c96 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800c96:	55                   	push   %rbp
+  800c97:	48 89 e5             	mov    %rsp,%rbp
+  800c9a:	41 57                	push   %r15
+  800c9c:	41 55                	push   %r13
+  800c9e:	41 54                	push   %r12
+  800ca0:	53                   	push   %rbx
+  800ca1:	48 83 ec 60          	sub    $0x60,%rsp
+  800ca5:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800ca5 <vprintfmt+0xf>
+  800cac:	49 bb 93 73 00 00 00 	movabs $0x7393,%r11
+  800cb3:	00 00 00 
+  800cb6:	4d 01 dc             	add    %r11,%r12
+  800cb9:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800cbd:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800cc1:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800cc5:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800cc9:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800cd0:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800cd4:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800cd8:	48 8b 06             	mov    (%rsi),%rax
+  800cdb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800cdf:	48 89 01             	mov    %rax,(%rcx)
+  800ce2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ce6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800cea:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800cee:	eb 17                	jmp    800d07 <vprintfmt+0x71>
+			if (ch == '\0')
+  800cf0:	85 db                	test   %ebx,%ebx
+  800cf2:	0f 84 97 05 00 00    	je     80128f <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800cf8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cfc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d00:	48 89 c6             	mov    %rax,%rsi
+  800d03:	89 df                	mov    %ebx,%edi
+  800d05:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d07:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d0b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d0f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d13:	0f b6 00             	movzbl (%rax),%eax
+  800d16:	0f b6 d8             	movzbl %al,%ebx
+  800d19:	83 fb 25             	cmp    $0x25,%ebx
+  800d1c:	75 d2                	jne    800cf0 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800d1e:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800d22:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800d29:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800d30:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800d37:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800d3e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d42:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d46:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d4a:	0f b6 00             	movzbl (%rax),%eax
+  800d4d:	0f b6 d8             	movzbl %al,%ebx
+  800d50:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800d53:	83 f8 55             	cmp    $0x55,%eax
+  800d56:	0f 87 00 05 00 00    	ja     80125c <vprintfmt+0x5c6>
+  800d5c:	89 c0                	mov    %eax,%eax
+  800d5e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800d65:	00 
+  800d66:	48 8d 05 b3 56 00 00 	lea    0x56b3(%rip),%rax        # 806420 <.LC18+0xc>
+  800d6d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800d71:	48 8d 15 a8 56 00 00 	lea    0x56a8(%rip),%rdx        # 806420 <.LC18+0xc>
+  800d78:	48 01 d0             	add    %rdx,%rax
+  800d7b:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800d7d:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800d81:	eb bb                	jmp    800d3e <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800d83:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800d87:	eb b5                	jmp    800d3e <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800d89:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800d90:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800d93:	89 d0                	mov    %edx,%eax
+  800d95:	c1 e0 02             	shl    $0x2,%eax
+  800d98:	01 d0                	add    %edx,%eax
+  800d9a:	01 c0                	add    %eax,%eax
+  800d9c:	01 d8                	add    %ebx,%eax
+  800d9e:	83 e8 30             	sub    $0x30,%eax
+  800da1:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800da4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800da8:	0f b6 00             	movzbl (%rax),%eax
+  800dab:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800dae:	83 fb 2f             	cmp    $0x2f,%ebx
+  800db1:	7e 60                	jle    800e13 <vprintfmt+0x17d>
+  800db3:	83 fb 39             	cmp    $0x39,%ebx
+  800db6:	7f 5b                	jg     800e13 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800db8:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800dbd:	eb d1                	jmp    800d90 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800dbf:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800dc2:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc5:	77 17                	ja     800dde <vprintfmt+0x148>
+  800dc7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dcb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dce:	89 d2                	mov    %edx,%edx
+  800dd0:	48 01 d0             	add    %rdx,%rax
+  800dd3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dd6:	83 c2 08             	add    $0x8,%edx
+  800dd9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ddc:	eb 0c                	jmp    800dea <vprintfmt+0x154>
+  800dde:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800de2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800de6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800dea:	8b 00                	mov    (%rax),%eax
+  800dec:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800def:	eb 23                	jmp    800e14 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800df1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800df5:	0f 89 43 ff ff ff    	jns    800d3e <vprintfmt+0xa8>
+				width = 0;
+  800dfb:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800e02:	e9 37 ff ff ff       	jmp    800d3e <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800e07:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800e0e:	e9 2b ff ff ff       	jmp    800d3e <vprintfmt+0xa8>
+			goto process_precision;
+  800e13:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800e14:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e18:	0f 89 20 ff ff ff    	jns    800d3e <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800e1e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800e21:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800e24:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800e2b:	e9 0e ff ff ff       	jmp    800d3e <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800e30:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800e34:	e9 05 ff ff ff       	jmp    800d3e <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800e39:	83 fb 39             	cmp    $0x39,%ebx
+  800e3c:	7f 0b                	jg     800e49 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800e3e:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800e41:	c1 e0 08             	shl    $0x8,%eax
+  800e44:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e47:	eb 21                	jmp    800e6a <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800e49:	83 fb 60             	cmp    $0x60,%ebx
+  800e4c:	7e 10                	jle    800e5e <vprintfmt+0x1c8>
+  800e4e:	83 fb 66             	cmp    $0x66,%ebx
+  800e51:	7f 0b                	jg     800e5e <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800e53:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800e56:	c1 e0 08             	shl    $0x8,%eax
+  800e59:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e5c:	eb 0c                	jmp    800e6a <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800e5e:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800e65:	e9 04 01 00 00       	jmp    800f6e <vprintfmt+0x2d8>
+  800e6a:	e9 ff 00 00 00       	jmp    800f6e <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800e6f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e72:	83 f8 2f             	cmp    $0x2f,%eax
+  800e75:	77 17                	ja     800e8e <vprintfmt+0x1f8>
+  800e77:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e7b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e7e:	89 d2                	mov    %edx,%edx
+  800e80:	48 01 d0             	add    %rdx,%rax
+  800e83:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e86:	83 c2 08             	add    $0x8,%edx
+  800e89:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e8c:	eb 0c                	jmp    800e9a <vprintfmt+0x204>
+  800e8e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e92:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e96:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e9a:	8b 00                	mov    (%rax),%eax
+  800e9c:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800ea0:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800ea4:	48 89 d6             	mov    %rdx,%rsi
+  800ea7:	89 c7                	mov    %eax,%edi
+  800ea9:	ff d1                	call   *%rcx
+			break;
+  800eab:	e9 da 03 00 00       	jmp    80128a <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800eb0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800eb3:	83 f8 2f             	cmp    $0x2f,%eax
+  800eb6:	77 17                	ja     800ecf <vprintfmt+0x239>
+  800eb8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ebc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ebf:	89 d2                	mov    %edx,%edx
+  800ec1:	48 01 d0             	add    %rdx,%rax
+  800ec4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ec7:	83 c2 08             	add    $0x8,%edx
+  800eca:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ecd:	eb 0c                	jmp    800edb <vprintfmt+0x245>
+  800ecf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ed3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ed7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800edb:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800edd:	85 db                	test   %ebx,%ebx
+  800edf:	79 02                	jns    800ee3 <vprintfmt+0x24d>
+				err = -err;
+  800ee1:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800ee3:	83 fb 15             	cmp    $0x15,%ebx
+  800ee6:	7f 19                	jg     800f01 <vprintfmt+0x26b>
+  800ee8:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  800eef:	00 00 00 
+  800ef2:	48 63 c3             	movslq %ebx,%rax
+  800ef5:	4c 01 e2             	add    %r12,%rdx
+  800ef8:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800efc:	4d 85 ed             	test   %r13,%r13
+  800eff:	75 36                	jne    800f37 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800f01:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f05:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f09:	89 d9                	mov    %ebx,%ecx
+  800f0b:	48 ba d0 e3 ff ff ff 	movabs $0xffffffffffffe3d0,%rdx
+  800f12:	ff ff ff 
+  800f15:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f19:	48 89 c7             	mov    %rax,%rdi
+  800f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f21:	49 b8 65 92 ff ff ff 	movabs $0xffffffffffff9265,%r8
+  800f28:	ff ff ff 
+  800f2b:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f2f:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800f32:	e9 53 03 00 00       	jmp    80128a <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800f37:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f3b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f3f:	4c 89 e9             	mov    %r13,%rcx
+  800f42:	48 ba d9 e3 ff ff ff 	movabs $0xffffffffffffe3d9,%rdx
+  800f49:	ff ff ff 
+  800f4c:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f50:	48 89 c7             	mov    %rax,%rdi
+  800f53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f58:	49 b8 65 92 ff ff ff 	movabs $0xffffffffffff9265,%r8
+  800f5f:	ff ff ff 
+  800f62:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f66:	41 ff d0             	call   *%r8
+			break;
+  800f69:	e9 1c 03 00 00       	jmp    80128a <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800f6e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f71:	83 f8 2f             	cmp    $0x2f,%eax
+  800f74:	77 17                	ja     800f8d <vprintfmt+0x2f7>
+  800f76:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f7a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f7d:	89 d2                	mov    %edx,%edx
+  800f7f:	48 01 d0             	add    %rdx,%rax
+  800f82:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f85:	83 c2 08             	add    $0x8,%edx
+  800f88:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f8b:	eb 0c                	jmp    800f99 <vprintfmt+0x303>
+  800f8d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f91:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f95:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f99:	4c 8b 28             	mov    (%rax),%r13
+  800f9c:	4d 85 ed             	test   %r13,%r13
+  800f9f:	75 0e                	jne    800faf <vprintfmt+0x319>
+				p = "(null)";
+  800fa1:	48 b8 dc e3 ff ff ff 	movabs $0xffffffffffffe3dc,%rax
+  800fa8:	ff ff ff 
+  800fab:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800faf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800fb3:	0f 8e 84 00 00 00    	jle    80103d <vprintfmt+0x3a7>
+  800fb9:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800fbd:	74 7e                	je     80103d <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800fbf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800fc2:	48 98                	cltq
+  800fc4:	48 89 c6             	mov    %rax,%rsi
+  800fc7:	4c 89 ef             	mov    %r13,%rdi
+  800fca:	4d 89 e7             	mov    %r12,%r15
+  800fcd:	48 b8 8a 95 ff ff ff 	movabs $0xffffffffffff958a,%rax
+  800fd4:	ff ff ff 
+  800fd7:	4c 01 e0             	add    %r12,%rax
+  800fda:	ff d0                	call   *%rax
+  800fdc:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800fdf:	eb 17                	jmp    800ff8 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800fe1:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800fe5:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800fe9:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800fed:	48 89 d6             	mov    %rdx,%rsi
+  800ff0:	89 c7                	mov    %eax,%edi
+  800ff2:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ff4:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ff8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ffc:	7f e3                	jg     800fe1 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ffe:	eb 3d                	jmp    80103d <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801000:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  801004:	74 1e                	je     801024 <vprintfmt+0x38e>
+  801006:	83 fb 1f             	cmp    $0x1f,%ebx
+  801009:	7e 05                	jle    801010 <vprintfmt+0x37a>
+  80100b:	83 fb 7e             	cmp    $0x7e,%ebx
+  80100e:	7e 14                	jle    801024 <vprintfmt+0x38e>
+					putch('?', putdat);
+  801010:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801014:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801018:	48 89 c6             	mov    %rax,%rsi
+  80101b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801020:	ff d2                	call   *%rdx
+  801022:	eb 15                	jmp    801039 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  801024:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801027:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  80102a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80102e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801032:	48 89 c6             	mov    %rax,%rsi
+  801035:	89 cf                	mov    %ecx,%edi
+  801037:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801039:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80103d:	4c 89 e8             	mov    %r13,%rax
+  801040:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801044:	0f b6 00             	movzbl (%rax),%eax
+  801047:	0f be d8             	movsbl %al,%ebx
+  80104a:	85 db                	test   %ebx,%ebx
+  80104c:	74 28                	je     801076 <vprintfmt+0x3e0>
+  80104e:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801052:	78 ac                	js     801000 <vprintfmt+0x36a>
+  801054:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801058:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80105c:	79 a2                	jns    801000 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  80105e:	eb 16                	jmp    801076 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  801060:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801064:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801068:	48 89 c6             	mov    %rax,%rsi
+  80106b:	bf 20 00 00 00       	mov    $0x20,%edi
+  801070:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801072:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801076:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80107a:	7f e4                	jg     801060 <vprintfmt+0x3ca>
+			break;
+  80107c:	e9 09 02 00 00       	jmp    80128a <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  801081:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801085:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801089:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80108d:	0f b6 00             	movzbl (%rax),%eax
+  801090:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801093:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801094:	83 fb 2f             	cmp    $0x2f,%ebx
+  801097:	0f 8e ac fd ff ff    	jle    800e49 <vprintfmt+0x1b3>
+  80109d:	e9 97 fd ff ff       	jmp    800e39 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8010a2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010a6:	be 03 00 00 00       	mov    $0x3,%esi
+  8010ab:	48 89 c7             	mov    %rax,%rdi
+  8010ae:	48 b8 43 8b ff ff ff 	movabs $0xffffffffffff8b43,%rax
+  8010b5:	ff ff ff 
+  8010b8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010bc:	ff d0                	call   *%rax
+  8010be:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8010c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010c6:	48 85 c0             	test   %rax,%rax
+  8010c9:	79 1d                	jns    8010e8 <vprintfmt+0x452>
+				putch('-', putdat);
+  8010cb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010cf:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010d3:	48 89 c6             	mov    %rax,%rsi
+  8010d6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8010db:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8010dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010e1:	48 f7 d8             	neg    %rax
+  8010e4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8010e8:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8010ef:	e9 de 00 00 00       	jmp    8011d2 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8010f4:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010f8:	be 03 00 00 00       	mov    $0x3,%esi
+  8010fd:	48 89 c7             	mov    %rax,%rdi
+  801100:	48 b8 e2 89 ff ff ff 	movabs $0xffffffffffff89e2,%rax
+  801107:	ff ff ff 
+  80110a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80110e:	ff d0                	call   *%rax
+  801110:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801114:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80111b:	e9 b2 00 00 00       	jmp    8011d2 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801120:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801124:	be 03 00 00 00       	mov    $0x3,%esi
+  801129:	48 89 c7             	mov    %rax,%rdi
+  80112c:	48 b8 e2 89 ff ff ff 	movabs $0xffffffffffff89e2,%rax
+  801133:	ff ff ff 
+  801136:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80113a:	ff d0                	call   *%rax
+  80113c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801140:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801147:	e9 86 00 00 00       	jmp    8011d2 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80114c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801150:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801154:	48 89 c6             	mov    %rax,%rsi
+  801157:	bf 30 00 00 00       	mov    $0x30,%edi
+  80115c:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80115e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801162:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801166:	48 89 c6             	mov    %rax,%rsi
+  801169:	bf 78 00 00 00       	mov    $0x78,%edi
+  80116e:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801170:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801173:	83 f8 2f             	cmp    $0x2f,%eax
+  801176:	77 17                	ja     80118f <vprintfmt+0x4f9>
+  801178:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80117c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80117f:	89 d2                	mov    %edx,%edx
+  801181:	48 01 d0             	add    %rdx,%rax
+  801184:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801187:	83 c2 08             	add    $0x8,%edx
+  80118a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80118d:	eb 0c                	jmp    80119b <vprintfmt+0x505>
+  80118f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801193:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801197:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80119b:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80119e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8011a2:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8011a9:	eb 27                	jmp    8011d2 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8011ab:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011af:	be 03 00 00 00       	mov    $0x3,%esi
+  8011b4:	48 89 c7             	mov    %rax,%rdi
+  8011b7:	48 b8 e2 89 ff ff ff 	movabs $0xffffffffffff89e2,%rax
+  8011be:	ff ff ff 
+  8011c1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011c5:	ff d0                	call   *%rax
+  8011c7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8011cb:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8011d2:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8011d7:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8011da:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8011dd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8011e1:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8011e5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8011e9:	45 89 c1             	mov    %r8d,%r9d
+  8011ec:	41 89 f8             	mov    %edi,%r8d
+  8011ef:	48 89 c7             	mov    %rax,%rdi
+  8011f2:	48 b8 0a 89 ff ff ff 	movabs $0xffffffffffff890a,%rax
+  8011f9:	ff ff ff 
+  8011fc:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801200:	ff d0                	call   *%rax
+			break;
+  801202:	e9 83 00 00 00       	jmp    80128a <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801207:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80120b:	be 03 00 00 00       	mov    $0x3,%esi
+  801210:	48 89 c7             	mov    %rax,%rdi
+  801213:	48 b8 e2 89 ff ff ff 	movabs $0xffffffffffff89e2,%rax
+  80121a:	ff ff ff 
+  80121d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801221:	ff d0                	call   *%rax
+  801223:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801227:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80122b:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80122f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801233:	48 89 ce             	mov    %rcx,%rsi
+  801236:	48 89 c7             	mov    %rax,%rdi
+  801239:	48 b8 fd 8a ff ff ff 	movabs $0xffffffffffff8afd,%rax
+  801240:	ff ff ff 
+  801243:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801247:	ff d0                	call   *%rax
+	
+			break;
+  801249:	eb 3f                	jmp    80128a <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80124b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80124f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801253:	48 89 c6             	mov    %rax,%rsi
+  801256:	89 df                	mov    %ebx,%edi
+  801258:	ff d2                	call   *%rdx
+			break;
+  80125a:	eb 2e                	jmp    80128a <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80125c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801260:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801264:	48 89 c6             	mov    %rax,%rsi
+  801267:	bf 25 00 00 00       	mov    $0x25,%edi
+  80126c:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80126e:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801273:	eb 05                	jmp    80127a <vprintfmt+0x5e4>
+  801275:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80127a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80127e:	48 83 e8 01          	sub    $0x1,%rax
+  801282:	0f b6 00             	movzbl (%rax),%eax
+  801285:	3c 25                	cmp    $0x25,%al
+  801287:	75 ec                	jne    801275 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801289:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80128a:	e9 78 fa ff ff       	jmp    800d07 <vprintfmt+0x71>
+				return;
+  80128f:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801290:	48 83 c4 60          	add    $0x60,%rsp
+  801294:	5b                   	pop    %rbx
+  801295:	41 5c                	pop    %r12
+  801297:	41 5d                	pop    %r13
+  801299:	41 5f                	pop    %r15
+  80129b:	5d                   	pop    %rbp
+  80129c:	c3                   	ret
+
+000000000080129d <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80129d:	55                   	push   %rbp
+  80129e:	48 89 e5             	mov    %rsp,%rbp
+  8012a1:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8012a8:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8012a8 <printfmt+0xb>
+  8012af:	49 bb 90 6d 00 00 00 	movabs $0x6d90,%r11
+  8012b6:	00 00 00 
+  8012b9:	4d 01 da             	add    %r11,%r10
+  8012bc:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8012c3:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8012ca:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8012d1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8012d8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8012df:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8012e6:	84 c0                	test   %al,%al
+  8012e8:	74 20                	je     80130a <printfmt+0x6d>
+  8012ea:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8012ee:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8012f2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012f6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8012fa:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012fe:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801302:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801306:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80130a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801311:	00 00 00 
+  801314:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80131b:	00 00 00 
+  80131e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801322:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801329:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801330:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801337:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80133e:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801345:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80134c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801353:	48 89 c7             	mov    %rax,%rdi
+  801356:	48 b8 5e 8c ff ff ff 	movabs $0xffffffffffff8c5e,%rax
+  80135d:	ff ff ff 
+  801360:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801364:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801366:	90                   	nop
+  801367:	c9                   	leave
+  801368:	c3                   	ret
+
+0000000000801369 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801369:	55                   	push   %rbp
+  80136a:	48 89 e5             	mov    %rsp,%rbp
+  80136d:	48 83 ec 10          	sub    $0x10,%rsp
+  801371:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801371 <sprintputch+0x8>
+  801378:	49 bb c7 6c 00 00 00 	movabs $0x6cc7,%r11
+  80137f:	00 00 00 
+  801382:	4c 01 d8             	add    %r11,%rax
+  801385:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801388:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80138c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801390:	8b 40 10             	mov    0x10(%rax),%eax
+  801393:	8d 50 01             	lea    0x1(%rax),%edx
+  801396:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80139a:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80139d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013a1:	48 8b 10             	mov    (%rax),%rdx
+  8013a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013a8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013ac:	48 39 c2             	cmp    %rax,%rdx
+  8013af:	73 17                	jae    8013c8 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8013b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013b5:	48 8b 00             	mov    (%rax),%rax
+  8013b8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013c0:	48 89 0a             	mov    %rcx,(%rdx)
+  8013c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8013c6:	88 10                	mov    %dl,(%rax)
+}
+  8013c8:	90                   	nop
+  8013c9:	c9                   	leave
+  8013ca:	c3                   	ret
+
+00000000008013cb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8013cb:	55                   	push   %rbp
+  8013cc:	48 89 e5             	mov    %rsp,%rbp
+  8013cf:	53                   	push   %rbx
+  8013d0:	48 83 ec 58          	sub    $0x58,%rsp
+  8013d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013d4 <vsnprintf+0x9>
+  8013db:	49 bb 64 6c 00 00 00 	movabs $0x6c64,%r11
+  8013e2:	00 00 00 
+  8013e5:	4c 01 d8             	add    %r11,%rax
+  8013e8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8013ec:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8013ef:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8013f3:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8013f7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8013fb:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8013ff:	48 8b 0e             	mov    (%rsi),%rcx
+  801402:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801406:	48 89 0a             	mov    %rcx,(%rdx)
+  801409:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80140d:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801411:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801415:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801419:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80141d:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801420:	48 63 d2             	movslq %edx,%rdx
+  801423:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801427:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80142b:	48 01 ca             	add    %rcx,%rdx
+  80142e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801432:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801439:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80143e:	74 06                	je     801446 <vsnprintf+0x7b>
+  801440:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801444:	7f 07                	jg     80144d <vsnprintf+0x82>
+		return -E_INVAL;
+  801446:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80144b:	eb 34                	jmp    801481 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80144d:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801451:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801455:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801459:	48 bf 31 93 ff ff ff 	movabs $0xffffffffffff9331,%rdi
+  801460:	ff ff ff 
+  801463:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801467:	49 b8 5e 8c ff ff ff 	movabs $0xffffffffffff8c5e,%r8
+  80146e:	ff ff ff 
+  801471:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801475:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801477:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80147b:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80147e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801481:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801485:	c9                   	leave
+  801486:	c3                   	ret
+
+0000000000801487 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801487:	55                   	push   %rbp
+  801488:	48 89 e5             	mov    %rsp,%rbp
+  80148b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801492:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801492 <snprintf+0xb>
+  801499:	49 bb a6 6b 00 00 00 	movabs $0x6ba6,%r11
+  8014a0:	00 00 00 
+  8014a3:	4d 01 da             	add    %r11,%r10
+  8014a6:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8014ad:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8014b3:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8014ba:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8014c1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8014c8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8014cf:	84 c0                	test   %al,%al
+  8014d1:	74 20                	je     8014f3 <snprintf+0x6c>
+  8014d3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8014d7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8014db:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8014df:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8014e3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8014e7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8014eb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8014ef:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8014f3:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8014fa:	00 00 00 
+  8014fd:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801504:	00 00 00 
+  801507:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80150b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801512:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801519:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801520:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801527:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80152e:	48 8b 06             	mov    (%rsi),%rax
+  801531:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801535:	48 89 01             	mov    %rax,(%rcx)
+  801538:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80153c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801540:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801544:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80154b:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801552:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801558:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80155f:	48 89 c7             	mov    %rax,%rdi
+  801562:	48 b8 93 93 ff ff ff 	movabs $0xffffffffffff9393,%rax
+  801569:	ff ff ff 
+  80156c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801570:	ff d0                	call   *%rax
+  801572:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801578:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80157e:	c9                   	leave
+  80157f:	c3                   	ret
+
+0000000000801580 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+  801584:	48 83 ec 18          	sub    $0x18,%rsp
+  801588:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801588 <strlen+0x8>
+  80158f:	49 bb b0 6a 00 00 00 	movabs $0x6ab0,%r11
+  801596:	00 00 00 
+  801599:	4c 01 d8             	add    %r11,%rax
+  80159c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8015a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015a7:	eb 09                	jmp    8015b2 <strlen+0x32>
+		n++;
+  8015a9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8015ad:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b6:	0f b6 00             	movzbl (%rax),%eax
+  8015b9:	84 c0                	test   %al,%al
+  8015bb:	75 ec                	jne    8015a9 <strlen+0x29>
+	return n;
+  8015bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015c0:	c9                   	leave
+  8015c1:	c3                   	ret
+
+00000000008015c2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8015c2:	55                   	push   %rbp
+  8015c3:	48 89 e5             	mov    %rsp,%rbp
+  8015c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8015ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015ca <strnlen+0x8>
+  8015d1:	49 bb 6e 6a 00 00 00 	movabs $0x6a6e,%r11
+  8015d8:	00 00 00 
+  8015db:	4c 01 d8             	add    %r11,%rax
+  8015de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015e6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015ed:	eb 0e                	jmp    8015fd <strnlen+0x3b>
+		n++;
+  8015ef:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015f3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015f8:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8015fd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801602:	74 0b                	je     80160f <strnlen+0x4d>
+  801604:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801608:	0f b6 00             	movzbl (%rax),%eax
+  80160b:	84 c0                	test   %al,%al
+  80160d:	75 e0                	jne    8015ef <strnlen+0x2d>
+	return n;
+  80160f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801612:	c9                   	leave
+  801613:	c3                   	ret
+
+0000000000801614 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801614:	55                   	push   %rbp
+  801615:	48 89 e5             	mov    %rsp,%rbp
+  801618:	48 83 ec 20          	sub    $0x20,%rsp
+  80161c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80161c <strcpy+0x8>
+  801623:	49 bb 1c 6a 00 00 00 	movabs $0x6a1c,%r11
+  80162a:	00 00 00 
+  80162d:	4c 01 d8             	add    %r11,%rax
+  801630:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801634:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801638:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80163c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801640:	90                   	nop
+  801641:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801645:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801649:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80164d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801651:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801655:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801659:	0f b6 12             	movzbl (%rdx),%edx
+  80165c:	88 10                	mov    %dl,(%rax)
+  80165e:	0f b6 00             	movzbl (%rax),%eax
+  801661:	84 c0                	test   %al,%al
+  801663:	75 dc                	jne    801641 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801665:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801669:	c9                   	leave
+  80166a:	c3                   	ret
+
+000000000080166b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80166b:	55                   	push   %rbp
+  80166c:	48 89 e5             	mov    %rsp,%rbp
+  80166f:	53                   	push   %rbx
+  801670:	48 83 ec 20          	sub    $0x20,%rsp
+  801674:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801674 <strcat+0x9>
+  80167b:	49 bb c4 69 00 00 00 	movabs $0x69c4,%r11
+  801682:	00 00 00 
+  801685:	4c 01 db             	add    %r11,%rbx
+  801688:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80168c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801690:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801694:	48 89 c7             	mov    %rax,%rdi
+  801697:	48 b8 48 95 ff ff ff 	movabs $0xffffffffffff9548,%rax
+  80169e:	ff ff ff 
+  8016a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016a5:	ff d0                	call   *%rax
+  8016a7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8016aa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016ad:	48 63 d0             	movslq %eax,%rdx
+  8016b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016b4:	48 01 c2             	add    %rax,%rdx
+  8016b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016bb:	48 89 c6             	mov    %rax,%rsi
+  8016be:	48 89 d7             	mov    %rdx,%rdi
+  8016c1:	48 b8 dc 95 ff ff ff 	movabs $0xffffffffffff95dc,%rax
+  8016c8:	ff ff ff 
+  8016cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016cf:	ff d0                	call   *%rax
+	return dst;
+  8016d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8016d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d9:	c9                   	leave
+  8016da:	c3                   	ret
+
+00000000008016db <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8016db:	55                   	push   %rbp
+  8016dc:	48 89 e5             	mov    %rsp,%rbp
+  8016df:	48 83 ec 28          	sub    $0x28,%rsp
+  8016e3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016e3 <strncpy+0x8>
+  8016ea:	49 bb 55 69 00 00 00 	movabs $0x6955,%r11
+  8016f1:	00 00 00 
+  8016f4:	4c 01 d8             	add    %r11,%rax
+  8016f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016ff:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801703:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801707:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80170b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801712:	00 
+  801713:	eb 2a                	jmp    80173f <strncpy+0x64>
+		*dst++ = *src;
+  801715:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801719:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80171d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801721:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801725:	0f b6 12             	movzbl (%rdx),%edx
+  801728:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80172a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80172e:	0f b6 00             	movzbl (%rax),%eax
+  801731:	84 c0                	test   %al,%al
+  801733:	74 05                	je     80173a <strncpy+0x5f>
+			src++;
+  801735:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80173a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80173f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801743:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801747:	72 cc                	jb     801715 <strncpy+0x3a>
+	}
+	return ret;
+  801749:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80174d:	c9                   	leave
+  80174e:	c3                   	ret
+
+000000000080174f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80174f:	55                   	push   %rbp
+  801750:	48 89 e5             	mov    %rsp,%rbp
+  801753:	48 83 ec 28          	sub    $0x28,%rsp
+  801757:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801757 <strlcpy+0x8>
+  80175e:	49 bb e1 68 00 00 00 	movabs $0x68e1,%r11
+  801765:	00 00 00 
+  801768:	4c 01 d8             	add    %r11,%rax
+  80176b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80176f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801773:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801777:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80177b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80177f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801784:	74 3d                	je     8017c3 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801786:	eb 1d                	jmp    8017a5 <strlcpy+0x56>
+			*dst++ = *src++;
+  801788:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80178c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801790:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801794:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801798:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80179c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017a0:	0f b6 12             	movzbl (%rdx),%edx
+  8017a3:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8017a5:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8017aa:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017af:	74 0b                	je     8017bc <strlcpy+0x6d>
+  8017b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017b5:	0f b6 00             	movzbl (%rax),%eax
+  8017b8:	84 c0                	test   %al,%al
+  8017ba:	75 cc                	jne    801788 <strlcpy+0x39>
+		*dst = '\0';
+  8017bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c0:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8017c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c7:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8017cb:	c9                   	leave
+  8017cc:	c3                   	ret
+
+00000000008017cd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8017d5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017d5 <strcmp+0x8>
+  8017dc:	49 bb 63 68 00 00 00 	movabs $0x6863,%r11
+  8017e3:	00 00 00 
+  8017e6:	4c 01 d8             	add    %r11,%rax
+  8017e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017ed:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8017f1:	eb 0a                	jmp    8017fd <strcmp+0x30>
+		p++, q++;
+  8017f3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017f8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8017fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801801:	0f b6 00             	movzbl (%rax),%eax
+  801804:	84 c0                	test   %al,%al
+  801806:	74 12                	je     80181a <strcmp+0x4d>
+  801808:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180c:	0f b6 10             	movzbl (%rax),%edx
+  80180f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801813:	0f b6 00             	movzbl (%rax),%eax
+  801816:	38 c2                	cmp    %al,%dl
+  801818:	74 d9                	je     8017f3 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80181a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181e:	0f b6 00             	movzbl (%rax),%eax
+  801821:	0f b6 d0             	movzbl %al,%edx
+  801824:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801828:	0f b6 00             	movzbl (%rax),%eax
+  80182b:	0f b6 c0             	movzbl %al,%eax
+  80182e:	29 c2                	sub    %eax,%edx
+  801830:	89 d0                	mov    %edx,%eax
+}
+  801832:	c9                   	leave
+  801833:	c3                   	ret
+
+0000000000801834 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801834:	55                   	push   %rbp
+  801835:	48 89 e5             	mov    %rsp,%rbp
+  801838:	48 83 ec 18          	sub    $0x18,%rsp
+  80183c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80183c <strncmp+0x8>
+  801843:	49 bb fc 67 00 00 00 	movabs $0x67fc,%r11
+  80184a:	00 00 00 
+  80184d:	4c 01 d8             	add    %r11,%rax
+  801850:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801854:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801858:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80185c:	eb 0f                	jmp    80186d <strncmp+0x39>
+		n--, p++, q++;
+  80185e:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801863:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801868:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80186d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801872:	74 1d                	je     801891 <strncmp+0x5d>
+  801874:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801878:	0f b6 00             	movzbl (%rax),%eax
+  80187b:	84 c0                	test   %al,%al
+  80187d:	74 12                	je     801891 <strncmp+0x5d>
+  80187f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801883:	0f b6 10             	movzbl (%rax),%edx
+  801886:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80188a:	0f b6 00             	movzbl (%rax),%eax
+  80188d:	38 c2                	cmp    %al,%dl
+  80188f:	74 cd                	je     80185e <strncmp+0x2a>
+	if (n == 0)
+  801891:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801896:	75 07                	jne    80189f <strncmp+0x6b>
+		return 0;
+  801898:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189d:	eb 16                	jmp    8018b5 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80189f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a3:	0f b6 00             	movzbl (%rax),%eax
+  8018a6:	0f b6 d0             	movzbl %al,%edx
+  8018a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ad:	0f b6 00             	movzbl (%rax),%eax
+  8018b0:	0f b6 c0             	movzbl %al,%eax
+  8018b3:	29 c2                	sub    %eax,%edx
+}
+  8018b5:	89 d0                	mov    %edx,%eax
+  8018b7:	c9                   	leave
+  8018b8:	c3                   	ret
+
+00000000008018b9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8018b9:	55                   	push   %rbp
+  8018ba:	48 89 e5             	mov    %rsp,%rbp
+  8018bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8018c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018c1 <strchr+0x8>
+  8018c8:	49 bb 77 67 00 00 00 	movabs $0x6777,%r11
+  8018cf:	00 00 00 
+  8018d2:	4c 01 d8             	add    %r11,%rax
+  8018d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018d9:	89 f0                	mov    %esi,%eax
+  8018db:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8018de:	eb 17                	jmp    8018f7 <strchr+0x3e>
+		if (*s == c)
+  8018e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e4:	0f b6 00             	movzbl (%rax),%eax
+  8018e7:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8018ea:	75 06                	jne    8018f2 <strchr+0x39>
+			return (char *) s;
+  8018ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f0:	eb 15                	jmp    801907 <strchr+0x4e>
+	for (; *s; s++)
+  8018f2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018fb:	0f b6 00             	movzbl (%rax),%eax
+  8018fe:	84 c0                	test   %al,%al
+  801900:	75 de                	jne    8018e0 <strchr+0x27>
+	return 0;
+  801902:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801907:	c9                   	leave
+  801908:	c3                   	ret
+
+0000000000801909 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801909:	55                   	push   %rbp
+  80190a:	48 89 e5             	mov    %rsp,%rbp
+  80190d:	48 83 ec 10          	sub    $0x10,%rsp
+  801911:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801911 <strfind+0x8>
+  801918:	49 bb 27 67 00 00 00 	movabs $0x6727,%r11
+  80191f:	00 00 00 
+  801922:	4c 01 d8             	add    %r11,%rax
+  801925:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801929:	89 f0                	mov    %esi,%eax
+  80192b:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80192e:	eb 11                	jmp    801941 <strfind+0x38>
+		if (*s == c)
+  801930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801934:	0f b6 00             	movzbl (%rax),%eax
+  801937:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80193a:	74 12                	je     80194e <strfind+0x45>
+	for (; *s; s++)
+  80193c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801941:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801945:	0f b6 00             	movzbl (%rax),%eax
+  801948:	84 c0                	test   %al,%al
+  80194a:	75 e4                	jne    801930 <strfind+0x27>
+  80194c:	eb 01                	jmp    80194f <strfind+0x46>
+			break;
+  80194e:	90                   	nop
+	return (char *) s;
+  80194f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+0000000000801955 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801955:	55                   	push   %rbp
+  801956:	48 89 e5             	mov    %rsp,%rbp
+  801959:	48 83 ec 18          	sub    $0x18,%rsp
+  80195d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80195d <memset+0x8>
+  801964:	49 bb db 66 00 00 00 	movabs $0x66db,%r11
+  80196b:	00 00 00 
+  80196e:	4c 01 d8             	add    %r11,%rax
+  801971:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801975:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801978:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80197c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801981:	75 06                	jne    801989 <memset+0x34>
+		return v;
+  801983:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801987:	eb 69                	jmp    8019f2 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801989:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80198d:	83 e0 03             	and    $0x3,%eax
+  801990:	48 85 c0             	test   %rax,%rax
+  801993:	75 48                	jne    8019dd <memset+0x88>
+  801995:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801999:	83 e0 03             	and    $0x3,%eax
+  80199c:	48 85 c0             	test   %rax,%rax
+  80199f:	75 3c                	jne    8019dd <memset+0x88>
+		c &= 0xFF;
+  8019a1:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8019a8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019ab:	c1 e0 18             	shl    $0x18,%eax
+  8019ae:	89 c2                	mov    %eax,%edx
+  8019b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019b3:	c1 e0 10             	shl    $0x10,%eax
+  8019b6:	09 c2                	or     %eax,%edx
+  8019b8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019bb:	c1 e0 08             	shl    $0x8,%eax
+  8019be:	09 d0                	or     %edx,%eax
+  8019c0:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8019c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019c7:	48 c1 e8 02          	shr    $0x2,%rax
+  8019cb:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8019ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019d2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019d5:	48 89 d7             	mov    %rdx,%rdi
+  8019d8:	fc                   	cld
+  8019d9:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8019db:	eb 11                	jmp    8019ee <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8019dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019e1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019e4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019e8:	48 89 d7             	mov    %rdx,%rdi
+  8019eb:	fc                   	cld
+  8019ec:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8019ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8019f2:	c9                   	leave
+  8019f3:	c3                   	ret
+
+00000000008019f4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8019f4:	55                   	push   %rbp
+  8019f5:	48 89 e5             	mov    %rsp,%rbp
+  8019f8:	48 83 ec 28          	sub    $0x28,%rsp
+  8019fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019fc <memmove+0x8>
+  801a03:	49 bb 3c 66 00 00 00 	movabs $0x663c,%r11
+  801a0a:	00 00 00 
+  801a0d:	4c 01 d8             	add    %r11,%rax
+  801a10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a14:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a18:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801a1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a20:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801a24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a28:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801a2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a30:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801a34:	0f 83 88 00 00 00    	jae    801ac2 <memmove+0xce>
+  801a3a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a42:	48 01 d0             	add    %rdx,%rax
+  801a45:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801a49:	73 77                	jae    801ac2 <memmove+0xce>
+		s += n;
+  801a4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a4f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801a53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a57:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801a5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a5f:	83 e0 03             	and    $0x3,%eax
+  801a62:	48 85 c0             	test   %rax,%rax
+  801a65:	75 3b                	jne    801aa2 <memmove+0xae>
+  801a67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a6b:	83 e0 03             	and    $0x3,%eax
+  801a6e:	48 85 c0             	test   %rax,%rax
+  801a71:	75 2f                	jne    801aa2 <memmove+0xae>
+  801a73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a77:	83 e0 03             	and    $0x3,%eax
+  801a7a:	48 85 c0             	test   %rax,%rax
+  801a7d:	75 23                	jne    801aa2 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801a7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a83:	48 83 e8 04          	sub    $0x4,%rax
+  801a87:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a8b:	48 83 ea 04          	sub    $0x4,%rdx
+  801a8f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a93:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801a97:	48 89 c7             	mov    %rax,%rdi
+  801a9a:	48 89 d6             	mov    %rdx,%rsi
+  801a9d:	fd                   	std
+  801a9e:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801aa0:	eb 1d                	jmp    801abf <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801aa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801aaa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aae:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801ab2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ab6:	48 89 d7             	mov    %rdx,%rdi
+  801ab9:	48 89 c1             	mov    %rax,%rcx
+  801abc:	fd                   	std
+  801abd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801abf:	fc                   	cld
+  801ac0:	eb 57                	jmp    801b19 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801ac2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac6:	83 e0 03             	and    $0x3,%eax
+  801ac9:	48 85 c0             	test   %rax,%rax
+  801acc:	75 36                	jne    801b04 <memmove+0x110>
+  801ace:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ad2:	83 e0 03             	and    $0x3,%eax
+  801ad5:	48 85 c0             	test   %rax,%rax
+  801ad8:	75 2a                	jne    801b04 <memmove+0x110>
+  801ada:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ade:	83 e0 03             	and    $0x3,%eax
+  801ae1:	48 85 c0             	test   %rax,%rax
+  801ae4:	75 1e                	jne    801b04 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801ae6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aea:	48 c1 e8 02          	shr    $0x2,%rax
+  801aee:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801af1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801af9:	48 89 c7             	mov    %rax,%rdi
+  801afc:	48 89 d6             	mov    %rdx,%rsi
+  801aff:	fc                   	cld
+  801b00:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801b02:	eb 15                	jmp    801b19 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801b04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b08:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b0c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b10:	48 89 c7             	mov    %rax,%rdi
+  801b13:	48 89 d6             	mov    %rdx,%rsi
+  801b16:	fc                   	cld
+  801b17:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801b19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b1d:	c9                   	leave
+  801b1e:	c3                   	ret
+
+0000000000801b1f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801b1f:	55                   	push   %rbp
+  801b20:	48 89 e5             	mov    %rsp,%rbp
+  801b23:	48 83 ec 18          	sub    $0x18,%rsp
+  801b27:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b27 <memcpy+0x8>
+  801b2e:	49 bb 11 65 00 00 00 	movabs $0x6511,%r11
+  801b35:	00 00 00 
+  801b38:	4c 01 d8             	add    %r11,%rax
+  801b3b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b3f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b43:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801b47:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b4b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801b4f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b53:	48 89 cf             	mov    %rcx,%rdi
+  801b56:	48 b9 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rcx
+  801b5d:	ff ff ff 
+  801b60:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801b64:	ff d0                	call   *%rax
+}
+  801b66:	c9                   	leave
+  801b67:	c3                   	ret
+
+0000000000801b68 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801b68:	55                   	push   %rbp
+  801b69:	48 89 e5             	mov    %rsp,%rbp
+  801b6c:	48 83 ec 28          	sub    $0x28,%rsp
+  801b70:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b70 <memcmp+0x8>
+  801b77:	49 bb c8 64 00 00 00 	movabs $0x64c8,%r11
+  801b7e:	00 00 00 
+  801b81:	4c 01 d8             	add    %r11,%rax
+  801b84:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b88:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b8c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801b90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801b98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801ba0:	eb 34                	jmp    801bd6 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801ba2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ba6:	0f b6 10             	movzbl (%rax),%edx
+  801ba9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bad:	0f b6 00             	movzbl (%rax),%eax
+  801bb0:	38 c2                	cmp    %al,%dl
+  801bb2:	74 18                	je     801bcc <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801bb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bb8:	0f b6 00             	movzbl (%rax),%eax
+  801bbb:	0f b6 d0             	movzbl %al,%edx
+  801bbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bc2:	0f b6 00             	movzbl (%rax),%eax
+  801bc5:	0f b6 c0             	movzbl %al,%eax
+  801bc8:	29 c2                	sub    %eax,%edx
+  801bca:	eb 20                	jmp    801bec <memcmp+0x84>
+		s1++, s2++;
+  801bcc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bd1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801bd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bda:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bde:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801be2:	48 85 c0             	test   %rax,%rax
+  801be5:	75 bb                	jne    801ba2 <memcmp+0x3a>
+	}
+
+	return 0;
+  801be7:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801bec:	89 d0                	mov    %edx,%eax
+  801bee:	c9                   	leave
+  801bef:	c3                   	ret
+
+0000000000801bf0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801bf0:	55                   	push   %rbp
+  801bf1:	48 89 e5             	mov    %rsp,%rbp
+  801bf4:	48 83 ec 28          	sub    $0x28,%rsp
+  801bf8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bf8 <memfind+0x8>
+  801bff:	49 bb 40 64 00 00 00 	movabs $0x6440,%r11
+  801c06:	00 00 00 
+  801c09:	4c 01 d8             	add    %r11,%rax
+  801c0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c10:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801c13:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801c17:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c1f:	48 01 d0             	add    %rdx,%rax
+  801c22:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801c26:	eb 13                	jmp    801c3b <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801c28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c2c:	0f b6 00             	movzbl (%rax),%eax
+  801c2f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801c32:	38 d0                	cmp    %dl,%al
+  801c34:	74 11                	je     801c47 <memfind+0x57>
+	for (; s < ends; s++)
+  801c36:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801c3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c3f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c43:	72 e3                	jb     801c28 <memfind+0x38>
+  801c45:	eb 01                	jmp    801c48 <memfind+0x58>
+			break;
+  801c47:	90                   	nop
+	return (void *) s;
+  801c48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c4c:	c9                   	leave
+  801c4d:	c3                   	ret
+
+0000000000801c4e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801c4e:	55                   	push   %rbp
+  801c4f:	48 89 e5             	mov    %rsp,%rbp
+  801c52:	48 83 ec 38          	sub    $0x38,%rsp
+  801c56:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c56 <strtol+0x8>
+  801c5d:	49 bb e2 63 00 00 00 	movabs $0x63e2,%r11
+  801c64:	00 00 00 
+  801c67:	4c 01 d8             	add    %r11,%rax
+  801c6a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c6e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c72:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801c75:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801c7c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c83:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801c84:	eb 05                	jmp    801c8b <strtol+0x3d>
+		s++;
+  801c86:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801c8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8f:	0f b6 00             	movzbl (%rax),%eax
+  801c92:	3c 20                	cmp    $0x20,%al
+  801c94:	74 f0                	je     801c86 <strtol+0x38>
+  801c96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c9a:	0f b6 00             	movzbl (%rax),%eax
+  801c9d:	3c 09                	cmp    $0x9,%al
+  801c9f:	74 e5                	je     801c86 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801ca1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca5:	0f b6 00             	movzbl (%rax),%eax
+  801ca8:	3c 2b                	cmp    $0x2b,%al
+  801caa:	75 07                	jne    801cb3 <strtol+0x65>
+		s++;
+  801cac:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cb1:	eb 17                	jmp    801cca <strtol+0x7c>
+	else if (*s == '-')
+  801cb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb7:	0f b6 00             	movzbl (%rax),%eax
+  801cba:	3c 2d                	cmp    $0x2d,%al
+  801cbc:	75 0c                	jne    801cca <strtol+0x7c>
+		s++, neg = 1;
+  801cbe:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cc3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801cca:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cce:	74 06                	je     801cd6 <strtol+0x88>
+  801cd0:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801cd4:	75 28                	jne    801cfe <strtol+0xb0>
+  801cd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cda:	0f b6 00             	movzbl (%rax),%eax
+  801cdd:	3c 30                	cmp    $0x30,%al
+  801cdf:	75 1d                	jne    801cfe <strtol+0xb0>
+  801ce1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce5:	48 83 c0 01          	add    $0x1,%rax
+  801ce9:	0f b6 00             	movzbl (%rax),%eax
+  801cec:	3c 78                	cmp    $0x78,%al
+  801cee:	75 0e                	jne    801cfe <strtol+0xb0>
+		s += 2, base = 16;
+  801cf0:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801cf5:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801cfc:	eb 2c                	jmp    801d2a <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801cfe:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d02:	75 19                	jne    801d1d <strtol+0xcf>
+  801d04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d08:	0f b6 00             	movzbl (%rax),%eax
+  801d0b:	3c 30                	cmp    $0x30,%al
+  801d0d:	75 0e                	jne    801d1d <strtol+0xcf>
+		s++, base = 8;
+  801d0f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d14:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801d1b:	eb 0d                	jmp    801d2a <strtol+0xdc>
+	else if (base == 0)
+  801d1d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d21:	75 07                	jne    801d2a <strtol+0xdc>
+		base = 10;
+  801d23:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801d2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d2e:	0f b6 00             	movzbl (%rax),%eax
+  801d31:	3c 2f                	cmp    $0x2f,%al
+  801d33:	7e 1d                	jle    801d52 <strtol+0x104>
+  801d35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d39:	0f b6 00             	movzbl (%rax),%eax
+  801d3c:	3c 39                	cmp    $0x39,%al
+  801d3e:	7f 12                	jg     801d52 <strtol+0x104>
+			dig = *s - '0';
+  801d40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d44:	0f b6 00             	movzbl (%rax),%eax
+  801d47:	0f be c0             	movsbl %al,%eax
+  801d4a:	83 e8 30             	sub    $0x30,%eax
+  801d4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d50:	eb 4e                	jmp    801da0 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801d52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d56:	0f b6 00             	movzbl (%rax),%eax
+  801d59:	3c 60                	cmp    $0x60,%al
+  801d5b:	7e 1d                	jle    801d7a <strtol+0x12c>
+  801d5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d61:	0f b6 00             	movzbl (%rax),%eax
+  801d64:	3c 7a                	cmp    $0x7a,%al
+  801d66:	7f 12                	jg     801d7a <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801d68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d6c:	0f b6 00             	movzbl (%rax),%eax
+  801d6f:	0f be c0             	movsbl %al,%eax
+  801d72:	83 e8 57             	sub    $0x57,%eax
+  801d75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d78:	eb 26                	jmp    801da0 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801d7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d7e:	0f b6 00             	movzbl (%rax),%eax
+  801d81:	3c 40                	cmp    $0x40,%al
+  801d83:	7e 47                	jle    801dcc <strtol+0x17e>
+  801d85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d89:	0f b6 00             	movzbl (%rax),%eax
+  801d8c:	3c 5a                	cmp    $0x5a,%al
+  801d8e:	7f 3c                	jg     801dcc <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801d90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d94:	0f b6 00             	movzbl (%rax),%eax
+  801d97:	0f be c0             	movsbl %al,%eax
+  801d9a:	83 e8 37             	sub    $0x37,%eax
+  801d9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801da0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801da3:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801da6:	7d 23                	jge    801dcb <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801da8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801dad:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801db0:	48 98                	cltq
+  801db2:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801db7:	48 89 c2             	mov    %rax,%rdx
+  801dba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801dbd:	48 98                	cltq
+  801dbf:	48 01 d0             	add    %rdx,%rax
+  801dc2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801dc6:	e9 5f ff ff ff       	jmp    801d2a <strtol+0xdc>
+			break;
+  801dcb:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801dcc:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801dd1:	74 0b                	je     801dde <strtol+0x190>
+		*endptr = (char *) s;
+  801dd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dd7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801ddb:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801dde:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801de2:	74 09                	je     801ded <strtol+0x19f>
+  801de4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801de8:	48 f7 d8             	neg    %rax
+  801deb:	eb 04                	jmp    801df1 <strtol+0x1a3>
+  801ded:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801df1:	c9                   	leave
+  801df2:	c3                   	ret
+
+0000000000801df3 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801df3:	55                   	push   %rbp
+  801df4:	48 89 e5             	mov    %rsp,%rbp
+  801df7:	53                   	push   %rbx
+  801df8:	48 83 ec 30          	sub    $0x30,%rsp
+  801dfc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801dfc <strstr+0x9>
+  801e03:	49 bb 3c 62 00 00 00 	movabs $0x623c,%r11
+  801e0a:	00 00 00 
+  801e0d:	4c 01 db             	add    %r11,%rbx
+  801e10:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801e14:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801e18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e1c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e20:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e24:	0f b6 00             	movzbl (%rax),%eax
+  801e27:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801e2a:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801e2e:	75 06                	jne    801e36 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801e30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e34:	eb 73                	jmp    801ea9 <strstr+0xb6>
+
+	len = strlen(str);
+  801e36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e3a:	48 89 c7             	mov    %rax,%rdi
+  801e3d:	48 b8 48 95 ff ff ff 	movabs $0xffffffffffff9548,%rax
+  801e44:	ff ff ff 
+  801e47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e4b:	ff d0                	call   *%rax
+  801e4d:	48 98                	cltq
+  801e4f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801e53:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e57:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e5b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801e5f:	0f b6 00             	movzbl (%rax),%eax
+  801e62:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801e65:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801e69:	75 07                	jne    801e72 <strstr+0x7f>
+				return (char *) 0;
+  801e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e70:	eb 37                	jmp    801ea9 <strstr+0xb6>
+		} while (sc != c);
+  801e72:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801e76:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801e79:	75 d8                	jne    801e53 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801e7b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e7f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e83:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e87:	48 89 ce             	mov    %rcx,%rsi
+  801e8a:	48 89 c7             	mov    %rax,%rdi
+  801e8d:	48 b8 fc 97 ff ff ff 	movabs $0xffffffffffff97fc,%rax
+  801e94:	ff ff ff 
+  801e97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e9b:	ff d0                	call   *%rax
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	75 b2                	jne    801e53 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801ea1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ea5:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801ea9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ead:	c9                   	leave
+  801eae:	c3                   	ret
+
+0000000000801eaf <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801eaf:	55                   	push   %rbp
+  801eb0:	48 89 e5             	mov    %rsp,%rbp
+  801eb3:	41 57                	push   %r15
+  801eb5:	53                   	push   %rbx
+  801eb6:	48 83 ec 40          	sub    $0x40,%rsp
+  801eba:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801eba <syscall+0xb>
+  801ec1:	49 bb 7e 61 00 00 00 	movabs $0x617e,%r11
+  801ec8:	00 00 00 
+  801ecb:	4d 01 da             	add    %r11,%r10
+  801ece:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801ed1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801ed4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ed8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801edc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801ee0:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801ee4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ee7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801eeb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801eef:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801ef3:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801ef7:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801efb:	4c 89 c3             	mov    %r8,%rbx
+  801efe:	cd 30                	int    $0x30
+  801f00:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801f04:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801f08:	74 52                	je     801f5c <syscall+0xad>
+  801f0a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f0f:	7e 4b                	jle    801f5c <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f11:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f18:	49 89 d0             	mov    %rdx,%r8
+  801f1b:	89 c1                	mov    %eax,%ecx
+  801f1d:	48 b8 98 e6 ff ff ff 	movabs $0xffffffffffffe698,%rax
+  801f24:	ff ff ff 
+  801f27:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f2b:	48 89 c2             	mov    %rax,%rdx
+  801f2e:	be 23 00 00 00       	mov    $0x23,%esi
+  801f33:	48 b8 b5 e6 ff ff ff 	movabs $0xffffffffffffe6b5,%rax
+  801f3a:	ff ff ff 
+  801f3d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f41:	48 89 c7             	mov    %rax,%rdi
+  801f44:	4d 89 d7             	mov    %r10,%r15
+  801f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4c:	49 b9 43 85 ff ff ff 	movabs $0xffffffffffff8543,%r9
+  801f53:	ff ff ff 
+  801f56:	4d 01 d1             	add    %r10,%r9
+  801f59:	41 ff d1             	call   *%r9
+
+	return ret;
+  801f5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f60:	48 83 c4 40          	add    $0x40,%rsp
+  801f64:	5b                   	pop    %rbx
+  801f65:	41 5f                	pop    %r15
+  801f67:	5d                   	pop    %rbp
+  801f68:	c3                   	ret
+
+0000000000801f69 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801f69:	55                   	push   %rbp
+  801f6a:	48 89 e5             	mov    %rsp,%rbp
+  801f6d:	41 57                	push   %r15
+  801f6f:	41 56                	push   %r14
+  801f71:	41 55                	push   %r13
+  801f73:	41 54                	push   %r12
+  801f75:	53                   	push   %rbx
+  801f76:	48 83 ec 48          	sub    $0x48,%rsp
+  801f7a:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801f7a <syscall_words+0x11>
+  801f81:	49 bb be 60 00 00 00 	movabs $0x60be,%r11
+  801f88:	00 00 00 
+  801f8b:	4d 01 de             	add    %r11,%r14
+  801f8e:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801f91:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801f94:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801f98:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801f9c:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801fa0:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801fa4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fa9:	74 09                	je     801fb4 <syscall_words+0x4b>
+  801fab:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801faf:	48 8b 00             	mov    (%rax),%rax
+  801fb2:	eb 05                	jmp    801fb9 <syscall_words+0x50>
+  801fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb9:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801fbc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fc1:	74 0a                	je     801fcd <syscall_words+0x64>
+  801fc3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fc7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fcb:	eb 05                	jmp    801fd2 <syscall_words+0x69>
+  801fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd2:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801fd5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fda:	74 0a                	je     801fe6 <syscall_words+0x7d>
+  801fdc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fe0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fe4:	eb 05                	jmp    801feb <syscall_words+0x82>
+  801fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801feb:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801fee:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ff3:	74 0a                	je     801fff <syscall_words+0x96>
+  801ff5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ff9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ffd:	eb 05                	jmp    802004 <syscall_words+0x9b>
+  801fff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802004:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  802007:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80200c:	74 0a                	je     802018 <syscall_words+0xaf>
+  80200e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802012:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802016:	eb 05                	jmp    80201d <syscall_words+0xb4>
+  802018:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201d:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  802020:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802025:	74 0a                	je     802031 <syscall_words+0xc8>
+  802027:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80202b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80202f:	eb 05                	jmp    802036 <syscall_words+0xcd>
+  802031:	b8 00 00 00 00       	mov    $0x0,%eax
+  802036:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  802039:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80203c:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802040:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802044:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802048:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80204c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802050:	cd 30                	int    $0x30
+  802052:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802056:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80205b:	74 50                	je     8020ad <syscall_words+0x144>
+		words[0] = r8;
+  80205d:	4c 89 c2             	mov    %r8,%rdx
+  802060:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802064:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802067:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80206b:	48 83 c0 08          	add    $0x8,%rax
+  80206f:	4c 89 ca             	mov    %r9,%rdx
+  802072:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802075:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802079:	48 83 c0 10          	add    $0x10,%rax
+  80207d:	4c 89 d2             	mov    %r10,%rdx
+  802080:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  802083:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802087:	48 83 c0 18          	add    $0x18,%rax
+  80208b:	4c 89 da             	mov    %r11,%rdx
+  80208e:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  802091:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802095:	48 83 c0 20          	add    $0x20,%rax
+  802099:	4c 89 e2             	mov    %r12,%rdx
+  80209c:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80209f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020a3:	48 83 c0 28          	add    $0x28,%rax
+  8020a7:	4c 89 ea             	mov    %r13,%rdx
+  8020aa:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  8020ad:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8020b1:	74 52                	je     802105 <syscall_words+0x19c>
+  8020b3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8020b8:	7e 4b                	jle    802105 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020ba:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020be:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8020c1:	49 89 d0             	mov    %rdx,%r8
+  8020c4:	89 c1                	mov    %eax,%ecx
+  8020c6:	48 b8 98 e6 ff ff ff 	movabs $0xffffffffffffe698,%rax
+  8020cd:	ff ff ff 
+  8020d0:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8020d4:	48 89 c2             	mov    %rax,%rdx
+  8020d7:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8020dc:	48 b8 b5 e6 ff ff ff 	movabs $0xffffffffffffe6b5,%rax
+  8020e3:	ff ff ff 
+  8020e6:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8020ea:	48 89 c7             	mov    %rax,%rdi
+  8020ed:	4d 89 f7             	mov    %r14,%r15
+  8020f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f5:	49 b9 43 85 ff ff ff 	movabs $0xffffffffffff8543,%r9
+  8020fc:	ff ff ff 
+  8020ff:	4d 01 f1             	add    %r14,%r9
+  802102:	41 ff d1             	call   *%r9
+
+	return ret;
+  802105:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802109:	48 83 c4 48          	add    $0x48,%rsp
+  80210d:	5b                   	pop    %rbx
+  80210e:	41 5c                	pop    %r12
+  802110:	41 5d                	pop    %r13
+  802112:	41 5e                	pop    %r14
+  802114:	41 5f                	pop    %r15
+  802116:	5d                   	pop    %rbp
+  802117:	c3                   	ret
+
+0000000000802118 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802118:	55                   	push   %rbp
+  802119:	48 89 e5             	mov    %rsp,%rbp
+  80211c:	48 83 ec 10          	sub    $0x10,%rsp
+  802120:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802120 <sys_cputs+0x8>
+  802127:	49 bb 18 5f 00 00 00 	movabs $0x5f18,%r11
+  80212e:	00 00 00 
+  802131:	4c 01 d8             	add    %r11,%rax
+  802134:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802138:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80213c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802140:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802144:	48 83 ec 08          	sub    $0x8,%rsp
+  802148:	6a 00                	push   $0x0
+  80214a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802150:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802156:	be 00 00 00 00       	mov    $0x0,%esi
+  80215b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802160:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802167:	ff ff ff 
+  80216a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80216e:	ff d0                	call   *%rax
+  802170:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802174:	90                   	nop
+  802175:	c9                   	leave
+  802176:	c3                   	ret
+
+0000000000802177 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802177:	55                   	push   %rbp
+  802178:	48 89 e5             	mov    %rsp,%rbp
+  80217b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80217b <sys_cgetc+0x4>
+  802182:	49 bb bd 5e 00 00 00 	movabs $0x5ebd,%r11
+  802189:	00 00 00 
+  80218c:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80218f:	48 83 ec 08          	sub    $0x8,%rsp
+  802193:	6a 00                	push   $0x0
+  802195:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80219b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021b5:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  8021bc:	ff ff ff 
+  8021bf:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021c3:	ff d0                	call   *%rax
+  8021c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021c9:	c9                   	leave
+  8021ca:	c3                   	ret
+
+00000000008021cb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8021cb:	55                   	push   %rbp
+  8021cc:	48 89 e5             	mov    %rsp,%rbp
+  8021cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021d3 <sys_env_destroy+0x8>
+  8021da:	49 bb 65 5e 00 00 00 	movabs $0x5e65,%r11
+  8021e1:	00 00 00 
+  8021e4:	4c 01 d8             	add    %r11,%rax
+  8021e7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8021ea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021ed:	48 63 d2             	movslq %edx,%rdx
+  8021f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8021f4:	6a 00                	push   $0x0
+  8021f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802202:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802207:	be 01 00 00 00       	mov    $0x1,%esi
+  80220c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802211:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802218:	ff ff ff 
+  80221b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80221f:	ff d0                	call   *%rax
+  802221:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802225:	c9                   	leave
+  802226:	c3                   	ret
+
+0000000000802227 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802227:	55                   	push   %rbp
+  802228:	48 89 e5             	mov    %rsp,%rbp
+  80222b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80222b <sys_getenvid+0x4>
+  802232:	49 bb 0d 5e 00 00 00 	movabs $0x5e0d,%r11
+  802239:	00 00 00 
+  80223c:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80223f:	48 83 ec 08          	sub    $0x8,%rsp
+  802243:	6a 00                	push   $0x0
+  802245:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80224b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802251:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225b:	be 00 00 00 00       	mov    $0x0,%esi
+  802260:	bf 02 00 00 00       	mov    $0x2,%edi
+  802265:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  80226c:	ff ff ff 
+  80226f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802273:	ff d0                	call   *%rax
+  802275:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802279:	c9                   	leave
+  80227a:	c3                   	ret
+
+000000000080227b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80227b:	55                   	push   %rbp
+  80227c:	48 89 e5             	mov    %rsp,%rbp
+  80227f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80227f <sys_yield+0x4>
+  802286:	49 bb b9 5d 00 00 00 	movabs $0x5db9,%r11
+  80228d:	00 00 00 
+  802290:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802293:	48 83 ec 08          	sub    $0x8,%rsp
+  802297:	6a 00                	push   $0x0
+  802299:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80229f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022af:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b4:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8022b9:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  8022c0:	ff ff ff 
+  8022c3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c7:	ff d0                	call   *%rax
+  8022c9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022cd:	90                   	nop
+  8022ce:	c9                   	leave
+  8022cf:	c3                   	ret
+
+00000000008022d0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8022d0:	55                   	push   %rbp
+  8022d1:	48 89 e5             	mov    %rsp,%rbp
+  8022d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d8 <sys_page_alloc+0x8>
+  8022df:	49 bb 60 5d 00 00 00 	movabs $0x5d60,%r11
+  8022e6:	00 00 00 
+  8022e9:	4c 01 d8             	add    %r11,%rax
+  8022ec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022f3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8022f6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022f9:	48 63 f2             	movslq %edx,%rsi
+  8022fc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802300:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802303:	48 63 d2             	movslq %edx,%rdx
+  802306:	48 83 ec 08          	sub    $0x8,%rsp
+  80230a:	6a 00                	push   $0x0
+  80230c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802312:	49 89 f0             	mov    %rsi,%r8
+  802315:	be 01 00 00 00       	mov    $0x1,%esi
+  80231a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80231f:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802326:	ff ff ff 
+  802329:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80232d:	ff d0                	call   *%rax
+  80232f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802333:	c9                   	leave
+  802334:	c3                   	ret
+
+0000000000802335 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802335:	55                   	push   %rbp
+  802336:	48 89 e5             	mov    %rsp,%rbp
+  802339:	48 83 ec 20          	sub    $0x20,%rsp
+  80233d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80233d <sys_page_map+0x8>
+  802344:	49 bb fb 5c 00 00 00 	movabs $0x5cfb,%r11
+  80234b:	00 00 00 
+  80234e:	4c 01 d8             	add    %r11,%rax
+  802351:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802354:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802358:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80235b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80235f:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802363:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802366:	48 63 f2             	movslq %edx,%rsi
+  802369:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80236d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802370:	48 63 fa             	movslq %edx,%rdi
+  802373:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802377:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80237a:	48 63 d2             	movslq %edx,%rdx
+  80237d:	48 83 ec 08          	sub    $0x8,%rsp
+  802381:	56                   	push   %rsi
+  802382:	4d 89 c1             	mov    %r8,%r9
+  802385:	49 89 f8             	mov    %rdi,%r8
+  802388:	be 01 00 00 00       	mov    $0x1,%esi
+  80238d:	bf 05 00 00 00       	mov    $0x5,%edi
+  802392:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802399:	ff ff ff 
+  80239c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023a0:	ff d0                	call   *%rax
+  8023a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a6:	c9                   	leave
+  8023a7:	c3                   	ret
+
+00000000008023a8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8023a8:	55                   	push   %rbp
+  8023a9:	48 89 e5             	mov    %rsp,%rbp
+  8023ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023b0 <sys_page_unmap+0x8>
+  8023b7:	49 bb 88 5c 00 00 00 	movabs $0x5c88,%r11
+  8023be:	00 00 00 
+  8023c1:	4c 01 d8             	add    %r11,%rax
+  8023c4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8023cb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023cf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023d2:	48 63 d2             	movslq %edx,%rdx
+  8023d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d9:	6a 00                	push   $0x0
+  8023db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ec:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023f1:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  8023f8:	ff ff ff 
+  8023fb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023ff:	ff d0                	call   *%rax
+  802401:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802405:	c9                   	leave
+  802406:	c3                   	ret
+
+0000000000802407 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	48 83 ec 10          	sub    $0x10,%rsp
+  80240f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80240f <sys_env_set_status+0x8>
+  802416:	49 bb 29 5c 00 00 00 	movabs $0x5c29,%r11
+  80241d:	00 00 00 
+  802420:	4c 01 d8             	add    %r11,%rax
+  802423:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802426:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802429:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80242c:	48 63 ca             	movslq %edx,%rcx
+  80242f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802432:	48 63 d2             	movslq %edx,%rdx
+  802435:	48 83 ec 08          	sub    $0x8,%rsp
+  802439:	6a 00                	push   $0x0
+  80243b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802441:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802447:	be 01 00 00 00       	mov    $0x1,%esi
+  80244c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802451:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802458:	ff ff ff 
+  80245b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80245f:	ff d0                	call   *%rax
+  802461:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802465:	c9                   	leave
+  802466:	c3                   	ret
+
+0000000000802467 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802467:	55                   	push   %rbp
+  802468:	48 89 e5             	mov    %rsp,%rbp
+  80246b:	48 83 ec 10          	sub    $0x10,%rsp
+  80246f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80246f <sys_env_set_trapframe+0x8>
+  802476:	49 bb c9 5b 00 00 00 	movabs $0x5bc9,%r11
+  80247d:	00 00 00 
+  802480:	4c 01 d8             	add    %r11,%rax
+  802483:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802486:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80248a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80248e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802491:	48 63 d2             	movslq %edx,%rdx
+  802494:	48 83 ec 08          	sub    $0x8,%rsp
+  802498:	6a 00                	push   $0x0
+  80249a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8024ab:	bf 09 00 00 00       	mov    $0x9,%edi
+  8024b0:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  8024b7:	ff ff ff 
+  8024ba:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024be:	ff d0                	call   *%rax
+  8024c0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024c4:	c9                   	leave
+  8024c5:	c3                   	ret
+
+00000000008024c6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8024c6:	55                   	push   %rbp
+  8024c7:	48 89 e5             	mov    %rsp,%rbp
+  8024ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024ce <sys_env_set_pgfault_upcall+0x8>
+  8024d5:	49 bb 6a 5b 00 00 00 	movabs $0x5b6a,%r11
+  8024dc:	00 00 00 
+  8024df:	4c 01 d8             	add    %r11,%rax
+  8024e2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024e5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8024e9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024f0:	48 63 d2             	movslq %edx,%rdx
+  8024f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f7:	6a 00                	push   $0x0
+  8024f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802505:	be 01 00 00 00       	mov    $0x1,%esi
+  80250a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80250f:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802516:	ff ff ff 
+  802519:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80251d:	ff d0                	call   *%rax
+  80251f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802523:	c9                   	leave
+  802524:	c3                   	ret
+
+0000000000802525 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802525:	55                   	push   %rbp
+  802526:	48 89 e5             	mov    %rsp,%rbp
+  802529:	48 83 ec 20          	sub    $0x20,%rsp
+  80252d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80252d <sys_ipc_try_send+0x8>
+  802534:	49 bb 0b 5b 00 00 00 	movabs $0x5b0b,%r11
+  80253b:	00 00 00 
+  80253e:	4c 01 d8             	add    %r11,%rax
+  802541:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802544:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802548:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80254c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80254f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802552:	48 63 fa             	movslq %edx,%rdi
+  802555:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802559:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80255c:	48 63 d2             	movslq %edx,%rdx
+  80255f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802563:	48 83 ec 08          	sub    $0x8,%rsp
+  802567:	6a 00                	push   $0x0
+  802569:	49 89 f9             	mov    %rdi,%r9
+  80256c:	49 89 f0             	mov    %rsi,%r8
+  80256f:	be 00 00 00 00       	mov    $0x0,%esi
+  802574:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802579:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802580:	ff ff ff 
+  802583:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802587:	ff d0                	call   *%rax
+  802589:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80258d:	c9                   	leave
+  80258e:	c3                   	ret
+
+000000000080258f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80258f:	55                   	push   %rbp
+  802590:	48 89 e5             	mov    %rsp,%rbp
+  802593:	48 83 ec 20          	sub    $0x20,%rsp
+  802597:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802597 <sys_ipc_send+0x8>
+  80259e:	49 bb a1 5a 00 00 00 	movabs $0x5aa1,%r11
+  8025a5:	00 00 00 
+  8025a8:	4c 01 d8             	add    %r11,%rax
+  8025ab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025b2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025b6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8025b9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025bc:	48 63 fa             	movslq %edx,%rdi
+  8025bf:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025c6:	48 63 d2             	movslq %edx,%rdx
+  8025c9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d1:	6a 00                	push   $0x0
+  8025d3:	49 89 f9             	mov    %rdi,%r9
+  8025d6:	49 89 f0             	mov    %rsi,%r8
+  8025d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8025de:	bf 17 00 00 00       	mov    $0x17,%edi
+  8025e3:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  8025ea:	ff ff ff 
+  8025ed:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025f1:	ff d0                	call   *%rax
+  8025f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f7:	c9                   	leave
+  8025f8:	c3                   	ret
+
+00000000008025f9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8025f9:	55                   	push   %rbp
+  8025fa:	48 89 e5             	mov    %rsp,%rbp
+  8025fd:	48 83 ec 10          	sub    $0x10,%rsp
+  802601:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802601 <sys_ipc_recv+0x8>
+  802608:	49 bb 37 5a 00 00 00 	movabs $0x5a37,%r11
+  80260f:	00 00 00 
+  802612:	4c 01 d8             	add    %r11,%rax
+  802615:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802619:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80261d:	6a 00                	push   $0x0
+  80261f:	6a 00                	push   $0x0
+  802621:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802627:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80262d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802632:	be 01 00 00 00       	mov    $0x1,%esi
+  802637:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80263c:	49 ba 31 9f ff ff ff 	movabs $0xffffffffffff9f31,%r10
+  802643:	ff ff ff 
+  802646:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80264a:	ff d0                	call   *%rax
+  80264c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802650:	c9                   	leave
+  802651:	c3                   	ret
+
+0000000000802652 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802652:	55                   	push   %rbp
+  802653:	48 89 e5             	mov    %rsp,%rbp
+  802656:	48 83 ec 30          	sub    $0x30,%rsp
+  80265a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80265a <sys_ipc_call+0x8>
+  802661:	49 bb de 59 00 00 00 	movabs $0x59de,%r11
+  802668:	00 00 00 
+  80266b:	4c 01 d8             	add    %r11,%rax
+  80266e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802671:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802675:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802679:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80267c:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802680:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802684:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802688:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80268b:	4c 63 c2             	movslq %edx,%r8
+  80268e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802692:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802695:	48 63 d2             	movslq %edx,%rdx
+  802698:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80269c:	ff 75 d8             	push   -0x28(%rbp)
+  80269f:	56                   	push   %rsi
+  8026a0:	4d 89 c1             	mov    %r8,%r9
+  8026a3:	49 89 f8             	mov    %rdi,%r8
+  8026a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ab:	bf 18 00 00 00       	mov    $0x18,%edi
+  8026b0:	49 ba 31 9f ff ff ff 	movabs $0xffffffffffff9f31,%r10
+  8026b7:	ff ff ff 
+  8026ba:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026be:	ff d0                	call   *%rax
+  8026c0:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8026c4:	c9                   	leave
+  8026c5:	c3                   	ret
+
+00000000008026c6 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8026c6:	55                   	push   %rbp
+  8026c7:	48 89 e5             	mov    %rsp,%rbp
+  8026ca:	48 83 ec 30          	sub    $0x30,%rsp
+  8026ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026ce <sys_ipc_reply_recv+0x8>
+  8026d5:	49 bb 6a 59 00 00 00 	movabs $0x596a,%r11
+  8026dc:	00 00 00 
+  8026df:	4c 01 d8             	add    %r11,%rax
+  8026e2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026e5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026e9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026ed:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8026f0:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8026f4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8026f8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8026fc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026ff:	4c 63 c2             	movslq %edx,%r8
+  802702:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802706:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802709:	48 63 d2             	movslq %edx,%rdx
+  80270c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802710:	ff 75 d8             	push   -0x28(%rbp)
+  802713:	56                   	push   %rsi
+  802714:	4d 89 c1             	mov    %r8,%r9
+  802717:	49 89 f8             	mov    %rdi,%r8
+  80271a:	be 00 00 00 00       	mov    $0x0,%esi
+  80271f:	bf 19 00 00 00       	mov    $0x19,%edi
+  802724:	49 ba 31 9f ff ff ff 	movabs $0xffffffffffff9f31,%r10
+  80272b:	ff ff ff 
+  80272e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802732:	ff d0                	call   *%rax
+  802734:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802738:	c9                   	leave
+  802739:	c3                   	ret
+
+000000000080273a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80273a:	55                   	push   %rbp
+  80273b:	48 89 e5             	mov    %rsp,%rbp
+  80273e:	48 83 ec 10          	sub    $0x10,%rsp
+  802742:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802742 <sys_env_set_priority+0x8>
+  802749:	49 bb f6 58 00 00 00 	movabs $0x58f6,%r11
+  802750:	00 00 00 
+  802753:	4c 01 d8             	add    %r11,%rax
+  802756:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802759:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80275c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80275f:	48 63 ca             	movslq %edx,%rcx
+  802762:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802765:	48 63 d2             	movslq %edx,%rdx
+  802768:	48 83 ec 08          	sub    $0x8,%rsp
+  80276c:	6a 00                	push   $0x0
+  80276e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802774:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80277a:	be 01 00 00 00       	mov    $0x1,%esi
+  80277f:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802784:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  80278b:	ff ff ff 
+  80278e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802792:	ff d0                	call   *%rax
+  802794:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802798:	c9                   	leave
+  802799:	c3                   	ret
+
+000000000080279a <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80279a:	55                   	push   %rbp
+  80279b:	48 89 e5             	mov    %rsp,%rbp
+  80279e:	48 83 ec 10          	sub    $0x10,%rsp
+  8027a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027a2 <sys_env_set_affinity+0x8>
+  8027a9:	49 bb 96 58 00 00 00 	movabs $0x5896,%r11
+  8027b0:	00 00 00 
+  8027b3:	4c 01 d8             	add    %r11,%rax
+  8027b6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027b9:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8027bc:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8027bf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027c2:	48 63 d2             	movslq %edx,%rdx
+  8027c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c9:	6a 00                	push   $0x0
+  8027cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8027dc:	bf 10 00 00 00       	mov    $0x10,%edi
+  8027e1:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  8027e8:	ff ff ff 
+  8027eb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027ef:	ff d0                	call   *%rax
+  8027f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027f5:	c9                   	leave
+  8027f6:	c3                   	ret
+
+00000000008027f7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8027f7:	55                   	push   %rbp
+  8027f8:	48 89 e5             	mov    %rsp,%rbp
+  8027fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027fb <sys_time_msec+0x4>
+  802802:	49 bb 3d 58 00 00 00 	movabs $0x583d,%r11
+  802809:	00 00 00 
+  80280c:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80280f:	48 83 ec 08          	sub    $0x8,%rsp
+  802813:	6a 00                	push   $0x0
+  802815:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80281b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802821:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802826:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282b:	be 00 00 00 00       	mov    $0x0,%esi
+  802830:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802835:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  80283c:	ff ff ff 
+  80283f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802843:	ff d0                	call   *%rax
+  802845:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802849:	c9                   	leave
+  80284a:	c3                   	ret
+
+000000000080284b <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80284b:	55                   	push   %rbp
+  80284c:	48 89 e5             	mov    %rsp,%rbp
+  80284f:	48 83 ec 10          	sub    $0x10,%rsp
+  802853:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802853 <sys_sleep_usec+0x8>
+  80285a:	49 bb e5 57 00 00 00 	movabs $0x57e5,%r11
+  802861:	00 00 00 
+  802864:	4c 01 d8             	add    %r11,%rax
+  802867:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80286b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80286f:	48 83 ec 08          	sub    $0x8,%rsp
+  802873:	6a 00                	push   $0x0
+  802875:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80287b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802881:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802886:	be 00 00 00 00       	mov    $0x0,%esi
+  80288b:	bf 11 00 00 00       	mov    $0x11,%edi
+  802890:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802897:	ff ff ff 
+  80289a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80289e:	ff d0                	call   *%rax
+  8028a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028a4:	c9                   	leave
+  8028a5:	c3                   	ret
+
+00000000008028a6 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8028a6:	55                   	push   %rbp
+  8028a7:	48 89 e5             	mov    %rsp,%rbp
+  8028aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8028ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028ae <sys_page_alloc_huge+0x8>
+  8028b5:	49 bb 8a 57 00 00 00 	movabs $0x578a,%r11
+  8028bc:	00 00 00 
+  8028bf:	4c 01 d8             	add    %r11,%rax
+  8028c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028c9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8028cc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8028cf:	48 63 f2             	movslq %edx,%rsi
+  8028d2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028d6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8028d9:	48 63 d2             	movslq %edx,%rdx
+  8028dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e0:	6a 00                	push   $0x0
+  8028e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028e8:	49 89 f0             	mov    %rsi,%r8
+  8028eb:	be 01 00 00 00       	mov    $0x1,%esi
+  8028f0:	bf 12 00 00 00       	mov    $0x12,%edi
+  8028f5:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  8028fc:	ff ff ff 
+  8028ff:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802903:	ff d0                	call   *%rax
+  802905:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802909:	c9                   	leave
+  80290a:	c3                   	ret
+
+000000000080290b <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80290b:	55                   	push   %rbp
+  80290c:	48 89 e5             	mov    %rsp,%rbp
+  80290f:	48 83 ec 10          	sub    $0x10,%rsp
+  802913:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802913 <sys_page_map_batch+0x8>
+  80291a:	49 bb 25 57 00 00 00 	movabs $0x5725,%r11
+  802921:	00 00 00 
+  802924:	4c 01 d8             	add    %r11,%rax
+  802927:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80292b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80292f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802933:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802937:	48 83 ec 08          	sub    $0x8,%rsp
+  80293b:	6a 00                	push   $0x0
+  80293d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802943:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802949:	be 01 00 00 00       	mov    $0x1,%esi
+  80294e:	bf 13 00 00 00       	mov    $0x13,%edi
+  802953:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  80295a:	ff ff ff 
+  80295d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802961:	ff d0                	call   *%rax
+  802963:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802967:	c9                   	leave
+  802968:	c3                   	ret
+
+0000000000802969 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802969:	55                   	push   %rbp
+  80296a:	48 89 e5             	mov    %rsp,%rbp
+  80296d:	48 83 ec 10          	sub    $0x10,%rsp
+  802971:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802971 <sys_page_alloc_batch+0x8>
+  802978:	49 bb c7 56 00 00 00 	movabs $0x56c7,%r11
+  80297f:	00 00 00 
+  802982:	4c 01 d8             	add    %r11,%rax
+  802985:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802989:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80298d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802991:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802995:	48 83 ec 08          	sub    $0x8,%rsp
+  802999:	6a 00                	push   $0x0
+  80299b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8029ac:	bf 14 00 00 00       	mov    $0x14,%edi
+  8029b1:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  8029b8:	ff ff ff 
+  8029bb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029bf:	ff d0                	call   *%rax
+  8029c1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029c5:	c9                   	leave
+  8029c6:	c3                   	ret
+
+00000000008029c7 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8029c7:	55                   	push   %rbp
+  8029c8:	48 89 e5             	mov    %rsp,%rbp
+  8029cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8029cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029cf <sys_page_unmap_batch+0x8>
+  8029d6:	49 bb 69 56 00 00 00 	movabs $0x5669,%r11
+  8029dd:	00 00 00 
+  8029e0:	4c 01 d8             	add    %r11,%rax
+  8029e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8029eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029ef:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8029f7:	6a 00                	push   $0x0
+  8029f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a05:	be 01 00 00 00       	mov    $0x1,%esi
+  802a0a:	bf 15 00 00 00       	mov    $0x15,%edi
+  802a0f:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802a16:	ff ff ff 
+  802a19:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a1d:	ff d0                	call   *%rax
+  802a1f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a23:	c9                   	leave
+  802a24:	c3                   	ret
+
+0000000000802a25 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802a25:	55                   	push   %rbp
+  802a26:	48 89 e5             	mov    %rsp,%rbp
+  802a29:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a29 <sys_fork+0x4>
+  802a30:	49 bb 0f 56 00 00 00 	movabs $0x560f,%r11
+  802a37:	00 00 00 
+  802a3a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802a3d:	48 83 ec 08          	sub    $0x8,%rsp
+  802a41:	6a 00                	push   $0x0
+  802a43:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a49:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a54:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a59:	be 00 00 00 00       	mov    $0x0,%esi
+  802a5e:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a63:	49 ba 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%r10
+  802a6a:	ff ff ff 
+  802a6d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a71:	ff d0                	call   *%rax
+  802a73:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a77:	c9                   	leave
+  802a78:	c3                   	ret
+
+0000000000802a79 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802a79:	55                   	push   %rbp
+  802a7a:	48 89 e5             	mov    %rsp,%rbp
+  802a7d:	48 83 ec 08          	sub    $0x8,%rsp
+  802a81:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a81 <fd2num+0x8>
+  802a88:	49 bb b7 55 00 00 00 	movabs $0x55b7,%r11
+  802a8f:	00 00 00 
+  802a92:	4c 01 d8             	add    %r11,%rax
+  802a95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802a99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a9d:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802aa4:	ff ff ff 
+  802aa7:	48 01 d0             	add    %rdx,%rax
+  802aaa:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802aae:	c9                   	leave
+  802aaf:	c3                   	ret
+
+0000000000802ab0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802ab0:	55                   	push   %rbp
+  802ab1:	48 89 e5             	mov    %rsp,%rbp
+  802ab4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ab8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ab8 <fd2data+0x8>
+  802abf:	49 bb 80 55 00 00 00 	movabs $0x5580,%r11
+  802ac6:	00 00 00 
+  802ac9:	4c 01 d8             	add    %r11,%rax
+  802acc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802ad0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ad4:	48 89 d7             	mov    %rdx,%rdi
+  802ad7:	48 ba 41 aa ff ff ff 	movabs $0xffffffffffffaa41,%rdx
+  802ade:	ff ff ff 
+  802ae1:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802ae5:	ff d0                	call   *%rax
+  802ae7:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802aed:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802af1:	c9                   	leave
+  802af2:	c3                   	ret
+
+0000000000802af3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802af3:	55                   	push   %rbp
+  802af4:	48 89 e5             	mov    %rsp,%rbp
+  802af7:	48 83 ec 18          	sub    $0x18,%rsp
+  802afb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802afb <fd_alloc+0x8>
+  802b02:	49 bb 3d 55 00 00 00 	movabs $0x553d,%r11
+  802b09:	00 00 00 
+  802b0c:	4c 01 d8             	add    %r11,%rax
+  802b0f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802b13:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802b1a:	eb 75                	jmp    802b91 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802b1c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b1f:	48 63 d2             	movslq %edx,%rdx
+  802b22:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802b29:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802b2d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802b31:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b35:	48 89 d1             	mov    %rdx,%rcx
+  802b38:	48 c1 e9 15          	shr    $0x15,%rcx
+  802b3c:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802b43:	ff ff ff 
+  802b46:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802b4a:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802b4e:	83 e2 01             	and    $0x1,%edx
+  802b51:	48 85 d2             	test   %rdx,%rdx
+  802b54:	74 25                	je     802b7b <fd_alloc+0x88>
+  802b56:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b5a:	48 89 d1             	mov    %rdx,%rcx
+  802b5d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802b61:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  802b68:	ff ff ff 
+  802b6b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802b6f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802b73:	83 e2 01             	and    $0x1,%edx
+  802b76:	48 85 d2             	test   %rdx,%rdx
+  802b79:	75 12                	jne    802b8d <fd_alloc+0x9a>
+			*fd_store = fd;
+  802b7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b7f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b83:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8b:	eb 1a                	jmp    802ba7 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802b8d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802b91:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802b95:	7e 85                	jle    802b1c <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802b97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b9b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802ba2:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802ba7:	c9                   	leave
+  802ba8:	c3                   	ret
+
+0000000000802ba9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802ba9:	55                   	push   %rbp
+  802baa:	48 89 e5             	mov    %rsp,%rbp
+  802bad:	48 83 ec 20          	sub    $0x20,%rsp
+  802bb1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802bb1 <fd_lookup+0x8>
+  802bb8:	49 bb 87 54 00 00 00 	movabs $0x5487,%r11
+  802bbf:	00 00 00 
+  802bc2:	4c 01 d8             	add    %r11,%rax
+  802bc5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802bc8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802bcc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802bd0:	78 06                	js     802bd8 <fd_lookup+0x2f>
+  802bd2:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802bd6:	7e 07                	jle    802bdf <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802bd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bdd:	eb 73                	jmp    802c52 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802bdf:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802be2:	48 63 d2             	movslq %edx,%rdx
+  802be5:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802bec:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802bf0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802bf4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bf8:	48 89 d1             	mov    %rdx,%rcx
+  802bfb:	48 c1 e9 15          	shr    $0x15,%rcx
+  802bff:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802c06:	ff ff ff 
+  802c09:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802c0d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802c11:	83 e2 01             	and    $0x1,%edx
+  802c14:	48 85 d2             	test   %rdx,%rdx
+  802c17:	74 22                	je     802c3b <fd_lookup+0x92>
+  802c19:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c1d:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802c21:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  802c28:	ff ff ff 
+  802c2b:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802c2f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c33:	83 e0 01             	and    $0x1,%eax
+  802c36:	48 85 c0             	test   %rax,%rax
+  802c39:	75 07                	jne    802c42 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802c3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c40:	eb 10                	jmp    802c52 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802c42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c46:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c4a:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c52:	c9                   	leave
+  802c53:	c3                   	ret
+
+0000000000802c54 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802c54:	55                   	push   %rbp
+  802c55:	48 89 e5             	mov    %rsp,%rbp
+  802c58:	41 57                	push   %r15
+  802c5a:	53                   	push   %rbx
+  802c5b:	48 83 ec 30          	sub    $0x30,%rsp
+  802c5f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c5f <fd_close+0xb>
+  802c66:	49 bb d9 53 00 00 00 	movabs $0x53d9,%r11
+  802c6d:	00 00 00 
+  802c70:	4c 01 db             	add    %r11,%rbx
+  802c73:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802c77:	89 f0                	mov    %esi,%eax
+  802c79:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802c7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c80:	48 89 c7             	mov    %rax,%rdi
+  802c83:	48 b8 41 aa ff ff ff 	movabs $0xffffffffffffaa41,%rax
+  802c8a:	ff ff ff 
+  802c8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c91:	ff d0                	call   *%rax
+  802c93:	89 c2                	mov    %eax,%edx
+  802c95:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802c99:	48 89 c6             	mov    %rax,%rsi
+  802c9c:	89 d7                	mov    %edx,%edi
+  802c9e:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  802ca5:	ff ff ff 
+  802ca8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cac:	ff d0                	call   *%rax
+  802cae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802cb1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802cb5:	78 0a                	js     802cc1 <fd_close+0x6d>
+	    || fd != fd2)
+  802cb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cbb:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802cbf:	74 12                	je     802cd3 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802cc1:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802cc5:	74 05                	je     802ccc <fd_close+0x78>
+  802cc7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cca:	eb 7a                	jmp    802d46 <fd_close+0xf2>
+  802ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd1:	eb 73                	jmp    802d46 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802cd3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cd7:	8b 00                	mov    (%rax),%eax
+  802cd9:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802cdd:	48 89 d6             	mov    %rdx,%rsi
+  802ce0:	89 c7                	mov    %eax,%edi
+  802ce2:	48 b8 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rax
+  802ce9:	ff ff ff 
+  802cec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cf0:	ff d0                	call   *%rax
+  802cf2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802cf5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802cf9:	78 2a                	js     802d25 <fd_close+0xd1>
+		if (dev->dev_close)
+  802cfb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cff:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802d03:	48 85 c0             	test   %rax,%rax
+  802d06:	74 16                	je     802d1e <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802d08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d0c:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802d10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d14:	48 89 c7             	mov    %rax,%rdi
+  802d17:	ff d2                	call   *%rdx
+  802d19:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d1c:	eb 07                	jmp    802d25 <fd_close+0xd1>
+		else
+			r = 0;
+  802d1e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802d25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d29:	48 89 c6             	mov    %rax,%rsi
+  802d2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d31:	49 89 df             	mov    %rbx,%r15
+  802d34:	48 b8 70 a3 ff ff ff 	movabs $0xffffffffffffa370,%rax
+  802d3b:	ff ff ff 
+  802d3e:	48 01 d8             	add    %rbx,%rax
+  802d41:	ff d0                	call   *%rax
+	return r;
+  802d43:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802d46:	48 83 c4 30          	add    $0x30,%rsp
+  802d4a:	5b                   	pop    %rbx
+  802d4b:	41 5f                	pop    %r15
+  802d4d:	5d                   	pop    %rbp
+  802d4e:	c3                   	ret
+
+0000000000802d4f <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802d4f:	55                   	push   %rbp
+  802d50:	48 89 e5             	mov    %rsp,%rbp
+  802d53:	41 57                	push   %r15
+  802d55:	48 83 ec 28          	sub    $0x28,%rsp
+  802d59:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802d59 <dev_lookup+0xa>
+  802d60:	49 bb df 52 00 00 00 	movabs $0x52df,%r11
+  802d67:	00 00 00 
+  802d6a:	4c 01 d9             	add    %r11,%rcx
+  802d6d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d70:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802d74:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802d7b:	eb 45                	jmp    802dc2 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802d7d:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802d84:	00 00 00 
+  802d87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d8a:	48 98                	cltq
+  802d8c:	48 01 ca             	add    %rcx,%rdx
+  802d8f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d93:	8b 00                	mov    (%rax),%eax
+  802d95:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802d98:	75 24                	jne    802dbe <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802d9a:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802da1:	00 00 00 
+  802da4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802da7:	48 98                	cltq
+  802da9:	48 01 ca             	add    %rcx,%rdx
+  802dac:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802db0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802db4:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbc:	eb 74                	jmp    802e32 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802dbe:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802dc2:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802dc9:	00 00 00 
+  802dcc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dcf:	48 98                	cltq
+  802dd1:	48 01 ca             	add    %rcx,%rdx
+  802dd4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802dd8:	48 85 c0             	test   %rax,%rax
+  802ddb:	75 a0                	jne    802d7d <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802ddd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802de4:	ff ff ff 
+  802de7:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802deb:	48 8b 00             	mov    (%rax),%rax
+  802dee:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802df4:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802df7:	89 c6                	mov    %eax,%esi
+  802df9:	48 b8 c8 e6 ff ff ff 	movabs $0xffffffffffffe6c8,%rax
+  802e00:	ff ff ff 
+  802e03:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802e07:	48 89 c7             	mov    %rax,%rdi
+  802e0a:	49 89 cf             	mov    %rcx,%r15
+  802e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e12:	49 b8 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%r8
+  802e19:	ff ff ff 
+  802e1c:	49 01 c8             	add    %rcx,%r8
+  802e1f:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802e22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e26:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802e2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e32:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802e36:	c9                   	leave
+  802e37:	c3                   	ret
+
+0000000000802e38 <close>:
+
+int
+close(int fdnum)
+{
+  802e38:	55                   	push   %rbp
+  802e39:	48 89 e5             	mov    %rsp,%rbp
+  802e3c:	53                   	push   %rbx
+  802e3d:	48 83 ec 28          	sub    $0x28,%rsp
+  802e41:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e41 <close+0x9>
+  802e48:	49 bb f7 51 00 00 00 	movabs $0x51f7,%r11
+  802e4f:	00 00 00 
+  802e52:	4c 01 db             	add    %r11,%rbx
+  802e55:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e58:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802e5c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e5f:	48 89 d6             	mov    %rdx,%rsi
+  802e62:	89 c7                	mov    %eax,%edi
+  802e64:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  802e6b:	ff ff ff 
+  802e6e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e72:	ff d0                	call   *%rax
+  802e74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e77:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e7b:	79 05                	jns    802e82 <close+0x4a>
+		return r;
+  802e7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e80:	eb 1c                	jmp    802e9e <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802e82:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e86:	be 01 00 00 00       	mov    $0x1,%esi
+  802e8b:	48 89 c7             	mov    %rax,%rdi
+  802e8e:	48 b8 1c ac ff ff ff 	movabs $0xffffffffffffac1c,%rax
+  802e95:	ff ff ff 
+  802e98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e9c:	ff d0                	call   *%rax
+}
+  802e9e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ea2:	c9                   	leave
+  802ea3:	c3                   	ret
+
+0000000000802ea4 <close_all>:
+
+void
+close_all(void)
+{
+  802ea4:	55                   	push   %rbp
+  802ea5:	48 89 e5             	mov    %rsp,%rbp
+  802ea8:	53                   	push   %rbx
+  802ea9:	48 83 ec 18          	sub    $0x18,%rsp
+  802ead:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ead <close_all+0x9>
+  802eb4:	49 bb 8b 51 00 00 00 	movabs $0x518b,%r11
+  802ebb:	00 00 00 
+  802ebe:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802ec1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802ec8:	eb 19                	jmp    802ee3 <close_all+0x3f>
+		close(i);
+  802eca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ecd:	89 c7                	mov    %eax,%edi
+  802ecf:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  802ed6:	ff ff ff 
+  802ed9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802edd:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802edf:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802ee3:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802ee7:	7e e1                	jle    802eca <close_all+0x26>
+}
+  802ee9:	90                   	nop
+  802eea:	90                   	nop
+  802eeb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eef:	c9                   	leave
+  802ef0:	c3                   	ret
+
+0000000000802ef1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802ef1:	55                   	push   %rbp
+  802ef2:	48 89 e5             	mov    %rsp,%rbp
+  802ef5:	41 57                	push   %r15
+  802ef7:	53                   	push   %rbx
+  802ef8:	48 83 ec 40          	sub    $0x40,%rsp
+  802efc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802efc <dup+0xb>
+  802f03:	49 bb 3c 51 00 00 00 	movabs $0x513c,%r11
+  802f0a:	00 00 00 
+  802f0d:	4c 01 db             	add    %r11,%rbx
+  802f10:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802f13:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802f16:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f1a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802f1d:	48 89 d6             	mov    %rdx,%rsi
+  802f20:	89 c7                	mov    %eax,%edi
+  802f22:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  802f29:	ff ff ff 
+  802f2c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f30:	ff d0                	call   *%rax
+  802f32:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f35:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f39:	79 08                	jns    802f43 <dup+0x52>
+		return r;
+  802f3b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f3e:	e9 a4 01 00 00       	jmp    8030e7 <dup+0x1f6>
+	close(newfdnum);
+  802f43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f46:	89 c7                	mov    %eax,%edi
+  802f48:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  802f4f:	ff ff ff 
+  802f52:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f56:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802f58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f5b:	48 98                	cltq
+  802f5d:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802f63:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f67:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802f6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f6f:	48 89 c7             	mov    %rax,%rdi
+  802f72:	48 b8 78 aa ff ff ff 	movabs $0xffffffffffffaa78,%rax
+  802f79:	ff ff ff 
+  802f7c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f80:	ff d0                	call   *%rax
+  802f82:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802f86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f8a:	48 89 c7             	mov    %rax,%rdi
+  802f8d:	48 b8 78 aa ff ff ff 	movabs $0xffffffffffffaa78,%rax
+  802f94:	ff ff ff 
+  802f97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f9b:	ff d0                	call   *%rax
+  802f9d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802fa1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fa5:	48 c1 e8 15          	shr    $0x15,%rax
+  802fa9:	48 89 c2             	mov    %rax,%rdx
+  802fac:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802fb3:	ff ff ff 
+  802fb6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fba:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fbe:	83 e0 01             	and    $0x1,%eax
+  802fc1:	48 85 c0             	test   %rax,%rax
+  802fc4:	74 7f                	je     803045 <dup+0x154>
+  802fc6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fca:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fce:	48 89 c2             	mov    %rax,%rdx
+  802fd1:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802fd8:	ff ff ff 
+  802fdb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fdf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fe3:	83 e0 01             	and    $0x1,%eax
+  802fe6:	48 85 c0             	test   %rax,%rax
+  802fe9:	74 5a                	je     803045 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802feb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fef:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ff3:	48 89 c2             	mov    %rax,%rdx
+  802ff6:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ffd:	ff ff ff 
+  803000:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803004:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803008:	25 07 0e 00 00       	and    $0xe07,%eax
+  80300d:	89 c1                	mov    %eax,%ecx
+  80300f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803013:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803017:	41 89 c8             	mov    %ecx,%r8d
+  80301a:	48 89 d1             	mov    %rdx,%rcx
+  80301d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803022:	48 89 c6             	mov    %rax,%rsi
+  803025:	bf 00 00 00 00       	mov    $0x0,%edi
+  80302a:	49 89 df             	mov    %rbx,%r15
+  80302d:	48 b8 fd a2 ff ff ff 	movabs $0xffffffffffffa2fd,%rax
+  803034:	ff ff ff 
+  803037:	48 01 d8             	add    %rbx,%rax
+  80303a:	ff d0                	call   *%rax
+  80303c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80303f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803043:	78 5f                	js     8030a4 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803045:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803049:	48 c1 e8 0c          	shr    $0xc,%rax
+  80304d:	48 89 c2             	mov    %rax,%rdx
+  803050:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803057:	ff ff ff 
+  80305a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80305e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803062:	25 07 0e 00 00       	and    $0xe07,%eax
+  803067:	89 c1                	mov    %eax,%ecx
+  803069:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80306d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803071:	41 89 c8             	mov    %ecx,%r8d
+  803074:	48 89 d1             	mov    %rdx,%rcx
+  803077:	ba 00 00 00 00       	mov    $0x0,%edx
+  80307c:	48 89 c6             	mov    %rax,%rsi
+  80307f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803084:	49 89 df             	mov    %rbx,%r15
+  803087:	48 b8 fd a2 ff ff ff 	movabs $0xffffffffffffa2fd,%rax
+  80308e:	ff ff ff 
+  803091:	48 01 d8             	add    %rbx,%rax
+  803094:	ff d0                	call   *%rax
+  803096:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803099:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80309d:	78 08                	js     8030a7 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  80309f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8030a2:	eb 43                	jmp    8030e7 <dup+0x1f6>
+			goto err;
+  8030a4:	90                   	nop
+  8030a5:	eb 01                	jmp    8030a8 <dup+0x1b7>
+		goto err;
+  8030a7:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  8030a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030ac:	48 89 c6             	mov    %rax,%rsi
+  8030af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b4:	49 89 df             	mov    %rbx,%r15
+  8030b7:	48 b8 70 a3 ff ff ff 	movabs $0xffffffffffffa370,%rax
+  8030be:	ff ff ff 
+  8030c1:	48 01 d8             	add    %rbx,%rax
+  8030c4:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8030c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030ca:	48 89 c6             	mov    %rax,%rsi
+  8030cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d2:	49 89 df             	mov    %rbx,%r15
+  8030d5:	48 b8 70 a3 ff ff ff 	movabs $0xffffffffffffa370,%rax
+  8030dc:	ff ff ff 
+  8030df:	48 01 d8             	add    %rbx,%rax
+  8030e2:	ff d0                	call   *%rax
+	return r;
+  8030e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8030e7:	48 83 c4 40          	add    $0x40,%rsp
+  8030eb:	5b                   	pop    %rbx
+  8030ec:	41 5f                	pop    %r15
+  8030ee:	5d                   	pop    %rbp
+  8030ef:	c3                   	ret
+
+00000000008030f0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8030f0:	55                   	push   %rbp
+  8030f1:	48 89 e5             	mov    %rsp,%rbp
+  8030f4:	41 57                	push   %r15
+  8030f6:	53                   	push   %rbx
+  8030f7:	48 83 ec 40          	sub    $0x40,%rsp
+  8030fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030fb <read+0xb>
+  803102:	49 bb 3d 4f 00 00 00 	movabs $0x4f3d,%r11
+  803109:	00 00 00 
+  80310c:	4c 01 db             	add    %r11,%rbx
+  80310f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803112:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803116:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80311a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80311e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803121:	48 89 d6             	mov    %rdx,%rsi
+  803124:	89 c7                	mov    %eax,%edi
+  803126:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  80312d:	ff ff ff 
+  803130:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803134:	ff d0                	call   *%rax
+  803136:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803139:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80313d:	78 28                	js     803167 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80313f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803143:	8b 00                	mov    (%rax),%eax
+  803145:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803149:	48 89 d6             	mov    %rdx,%rsi
+  80314c:	89 c7                	mov    %eax,%edi
+  80314e:	48 b8 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rax
+  803155:	ff ff ff 
+  803158:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80315c:	ff d0                	call   *%rax
+  80315e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803161:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803165:	79 08                	jns    80316f <read+0x7f>
+		return r;
+  803167:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80316a:	e9 8b 00 00 00       	jmp    8031fa <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80316f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803173:	8b 40 08             	mov    0x8(%rax),%eax
+  803176:	83 e0 03             	and    $0x3,%eax
+  803179:	83 f8 01             	cmp    $0x1,%eax
+  80317c:	75 4b                	jne    8031c9 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80317e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803185:	ff ff ff 
+  803188:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80318c:	48 8b 00             	mov    (%rax),%rax
+  80318f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803195:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803198:	89 c6                	mov    %eax,%esi
+  80319a:	48 b8 e7 e6 ff ff ff 	movabs $0xffffffffffffe6e7,%rax
+  8031a1:	ff ff ff 
+  8031a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031a8:	48 89 c7             	mov    %rax,%rdi
+  8031ab:	49 89 df             	mov    %rbx,%r15
+  8031ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b3:	48 b9 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%rcx
+  8031ba:	ff ff ff 
+  8031bd:	48 01 d9             	add    %rbx,%rcx
+  8031c0:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8031c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031c7:	eb 31                	jmp    8031fa <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8031c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031cd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8031d1:	48 85 c0             	test   %rax,%rax
+  8031d4:	75 07                	jne    8031dd <read+0xed>
+		return -E_NOT_SUPP;
+  8031d6:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8031db:	eb 1d                	jmp    8031fa <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8031dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031e1:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8031e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031e9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8031ed:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8031f1:	48 89 ce             	mov    %rcx,%rsi
+  8031f4:	48 89 c7             	mov    %rax,%rdi
+  8031f7:	41 ff d0             	call   *%r8
+}
+  8031fa:	48 83 c4 40          	add    $0x40,%rsp
+  8031fe:	5b                   	pop    %rbx
+  8031ff:	41 5f                	pop    %r15
+  803201:	5d                   	pop    %rbp
+  803202:	c3                   	ret
+
+0000000000803203 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803203:	55                   	push   %rbp
+  803204:	48 89 e5             	mov    %rsp,%rbp
+  803207:	53                   	push   %rbx
+  803208:	48 83 ec 38          	sub    $0x38,%rsp
+  80320c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80320c <readn+0x9>
+  803213:	49 bb 2c 4e 00 00 00 	movabs $0x4e2c,%r11
+  80321a:	00 00 00 
+  80321d:	4c 01 db             	add    %r11,%rbx
+  803220:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803223:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803227:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80322b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803232:	eb 4b                	jmp    80327f <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803234:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803237:	48 98                	cltq
+  803239:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80323d:	48 29 c2             	sub    %rax,%rdx
+  803240:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803243:	48 63 c8             	movslq %eax,%rcx
+  803246:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80324a:	48 01 c1             	add    %rax,%rcx
+  80324d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803250:	48 89 ce             	mov    %rcx,%rsi
+  803253:	89 c7                	mov    %eax,%edi
+  803255:	48 b8 b8 b0 ff ff ff 	movabs $0xffffffffffffb0b8,%rax
+  80325c:	ff ff ff 
+  80325f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803263:	ff d0                	call   *%rax
+  803265:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803268:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80326c:	79 05                	jns    803273 <readn+0x70>
+			return m;
+  80326e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803271:	eb 1d                	jmp    803290 <readn+0x8d>
+		if (m == 0)
+  803273:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803277:	74 13                	je     80328c <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803279:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80327c:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80327f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803282:	48 98                	cltq
+  803284:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803288:	72 aa                	jb     803234 <readn+0x31>
+  80328a:	eb 01                	jmp    80328d <readn+0x8a>
+			break;
+  80328c:	90                   	nop
+	}
+	return tot;
+  80328d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803290:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803294:	c9                   	leave
+  803295:	c3                   	ret
+
+0000000000803296 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803296:	55                   	push   %rbp
+  803297:	48 89 e5             	mov    %rsp,%rbp
+  80329a:	41 57                	push   %r15
+  80329c:	53                   	push   %rbx
+  80329d:	48 83 ec 40          	sub    $0x40,%rsp
+  8032a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032a1 <write+0xb>
+  8032a8:	49 bb 97 4d 00 00 00 	movabs $0x4d97,%r11
+  8032af:	00 00 00 
+  8032b2:	4c 01 db             	add    %r11,%rbx
+  8032b5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8032b8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8032bc:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8032c0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8032c4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8032c7:	48 89 d6             	mov    %rdx,%rsi
+  8032ca:	89 c7                	mov    %eax,%edi
+  8032cc:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  8032d3:	ff ff ff 
+  8032d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032da:	ff d0                	call   *%rax
+  8032dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032e3:	78 28                	js     80330d <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8032e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032e9:	8b 00                	mov    (%rax),%eax
+  8032eb:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8032ef:	48 89 d6             	mov    %rdx,%rsi
+  8032f2:	89 c7                	mov    %eax,%edi
+  8032f4:	48 b8 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rax
+  8032fb:	ff ff ff 
+  8032fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803302:	ff d0                	call   *%rax
+  803304:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803307:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80330b:	79 08                	jns    803315 <write+0x7f>
+		return r;
+  80330d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803310:	e9 8a 00 00 00       	jmp    80339f <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803315:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803319:	8b 40 08             	mov    0x8(%rax),%eax
+  80331c:	83 e0 03             	and    $0x3,%eax
+  80331f:	85 c0                	test   %eax,%eax
+  803321:	75 4b                	jne    80336e <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803323:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80332a:	ff ff ff 
+  80332d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803331:	48 8b 00             	mov    (%rax),%rax
+  803334:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80333a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80333d:	89 c6                	mov    %eax,%esi
+  80333f:	48 b8 03 e7 ff ff ff 	movabs $0xffffffffffffe703,%rax
+  803346:	ff ff ff 
+  803349:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80334d:	48 89 c7             	mov    %rax,%rdi
+  803350:	49 89 df             	mov    %rbx,%r15
+  803353:	b8 00 00 00 00       	mov    $0x0,%eax
+  803358:	48 b9 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%rcx
+  80335f:	ff ff ff 
+  803362:	48 01 d9             	add    %rbx,%rcx
+  803365:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803367:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80336c:	eb 31                	jmp    80339f <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80336e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803372:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803376:	48 85 c0             	test   %rax,%rax
+  803379:	75 07                	jne    803382 <write+0xec>
+		return -E_NOT_SUPP;
+  80337b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803380:	eb 1d                	jmp    80339f <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803382:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803386:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80338a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80338e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803392:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803396:	48 89 ce             	mov    %rcx,%rsi
+  803399:	48 89 c7             	mov    %rax,%rdi
+  80339c:	41 ff d0             	call   *%r8
+}
+  80339f:	48 83 c4 40          	add    $0x40,%rsp
+  8033a3:	5b                   	pop    %rbx
+  8033a4:	41 5f                	pop    %r15
+  8033a6:	5d                   	pop    %rbp
+  8033a7:	c3                   	ret
+
+00000000008033a8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8033a8:	55                   	push   %rbp
+  8033a9:	48 89 e5             	mov    %rsp,%rbp
+  8033ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8033b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8033b0 <seek+0x8>
+  8033b7:	49 bb 88 4c 00 00 00 	movabs $0x4c88,%r11
+  8033be:	00 00 00 
+  8033c1:	4c 01 d8             	add    %r11,%rax
+  8033c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8033c7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033ca:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8033ce:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8033d1:	48 89 ce             	mov    %rcx,%rsi
+  8033d4:	89 d7                	mov    %edx,%edi
+  8033d6:	48 ba 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rdx
+  8033dd:	ff ff ff 
+  8033e0:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8033e4:	ff d0                	call   *%rax
+  8033e6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033e9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033ed:	79 05                	jns    8033f4 <seek+0x4c>
+		return r;
+  8033ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033f2:	eb 0f                	jmp    803403 <seek+0x5b>
+	fd->fd_offset = offset;
+  8033f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033f8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8033fb:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8033fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803403:	c9                   	leave
+  803404:	c3                   	ret
+
+0000000000803405 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803405:	55                   	push   %rbp
+  803406:	48 89 e5             	mov    %rsp,%rbp
+  803409:	41 57                	push   %r15
+  80340b:	53                   	push   %rbx
+  80340c:	48 83 ec 30          	sub    $0x30,%rsp
+  803410:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803410 <ftruncate+0xb>
+  803417:	49 bb 28 4c 00 00 00 	movabs $0x4c28,%r11
+  80341e:	00 00 00 
+  803421:	4c 01 db             	add    %r11,%rbx
+  803424:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803427:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80342a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80342e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803431:	48 89 d6             	mov    %rdx,%rsi
+  803434:	89 c7                	mov    %eax,%edi
+  803436:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  80343d:	ff ff ff 
+  803440:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803444:	ff d0                	call   *%rax
+  803446:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803449:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80344d:	78 28                	js     803477 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80344f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803453:	8b 00                	mov    (%rax),%eax
+  803455:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803459:	48 89 d6             	mov    %rdx,%rsi
+  80345c:	89 c7                	mov    %eax,%edi
+  80345e:	48 b8 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rax
+  803465:	ff ff ff 
+  803468:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80346c:	ff d0                	call   *%rax
+  80346e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803471:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803475:	79 08                	jns    80347f <ftruncate+0x7a>
+		return r;
+  803477:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80347a:	e9 83 00 00 00       	jmp    803502 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80347f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803483:	8b 40 08             	mov    0x8(%rax),%eax
+  803486:	83 e0 03             	and    $0x3,%eax
+  803489:	85 c0                	test   %eax,%eax
+  80348b:	75 4b                	jne    8034d8 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  80348d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803494:	ff ff ff 
+  803497:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80349b:	48 8b 00             	mov    (%rax),%rax
+  80349e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8034a4:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8034a7:	89 c6                	mov    %eax,%esi
+  8034a9:	48 b8 20 e7 ff ff ff 	movabs $0xffffffffffffe720,%rax
+  8034b0:	ff ff ff 
+  8034b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034b7:	48 89 c7             	mov    %rax,%rdi
+  8034ba:	49 89 df             	mov    %rbx,%r15
+  8034bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c2:	48 b9 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%rcx
+  8034c9:	ff ff ff 
+  8034cc:	48 01 d9             	add    %rbx,%rcx
+  8034cf:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8034d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034d6:	eb 2a                	jmp    803502 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8034d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034dc:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8034e0:	48 85 c0             	test   %rax,%rax
+  8034e3:	75 07                	jne    8034ec <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8034e5:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034ea:	eb 16                	jmp    803502 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8034ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034f0:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8034f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034f8:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8034fb:	89 d6                	mov    %edx,%esi
+  8034fd:	48 89 c7             	mov    %rax,%rdi
+  803500:	ff d1                	call   *%rcx
+}
+  803502:	48 83 c4 30          	add    $0x30,%rsp
+  803506:	5b                   	pop    %rbx
+  803507:	41 5f                	pop    %r15
+  803509:	5d                   	pop    %rbp
+  80350a:	c3                   	ret
+
+000000000080350b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80350b:	55                   	push   %rbp
+  80350c:	48 89 e5             	mov    %rsp,%rbp
+  80350f:	53                   	push   %rbx
+  803510:	48 83 ec 38          	sub    $0x38,%rsp
+  803514:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803514 <fstat+0x9>
+  80351b:	49 bb 24 4b 00 00 00 	movabs $0x4b24,%r11
+  803522:	00 00 00 
+  803525:	4c 01 db             	add    %r11,%rbx
+  803528:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80352b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80352f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803533:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803536:	48 89 d6             	mov    %rdx,%rsi
+  803539:	89 c7                	mov    %eax,%edi
+  80353b:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  803542:	ff ff ff 
+  803545:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803549:	ff d0                	call   *%rax
+  80354b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80354e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803552:	78 28                	js     80357c <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803554:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803558:	8b 00                	mov    (%rax),%eax
+  80355a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80355e:	48 89 d6             	mov    %rdx,%rsi
+  803561:	89 c7                	mov    %eax,%edi
+  803563:	48 b8 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rax
+  80356a:	ff ff ff 
+  80356d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803571:	ff d0                	call   *%rax
+  803573:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803576:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80357a:	79 05                	jns    803581 <fstat+0x76>
+		return r;
+  80357c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80357f:	eb 5e                	jmp    8035df <fstat+0xd4>
+	if (!dev->dev_stat)
+  803581:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803585:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803589:	48 85 c0             	test   %rax,%rax
+  80358c:	75 07                	jne    803595 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80358e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803593:	eb 4a                	jmp    8035df <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803595:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803599:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80359c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035a0:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8035a7:	00 00 00 
+	stat->st_isdir = 0;
+  8035aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035ae:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8035b5:	00 00 00 
+	stat->st_dev = dev;
+  8035b8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035bc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035c0:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8035c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035cb:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8035cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035d7:	48 89 d6             	mov    %rdx,%rsi
+  8035da:	48 89 c7             	mov    %rax,%rdi
+  8035dd:	ff d1                	call   *%rcx
+}
+  8035df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035e3:	c9                   	leave
+  8035e4:	c3                   	ret
+
+00000000008035e5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8035e5:	55                   	push   %rbp
+  8035e6:	48 89 e5             	mov    %rsp,%rbp
+  8035e9:	41 57                	push   %r15
+  8035eb:	53                   	push   %rbx
+  8035ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8035f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035f0 <stat+0xb>
+  8035f7:	49 bb 48 4a 00 00 00 	movabs $0x4a48,%r11
+  8035fe:	00 00 00 
+  803601:	4c 01 db             	add    %r11,%rbx
+  803604:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803608:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80360c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803610:	be 00 00 00 00       	mov    $0x0,%esi
+  803615:	48 89 c7             	mov    %rax,%rdi
+  803618:	49 89 df             	mov    %rbx,%r15
+  80361b:	48 b8 87 b8 ff ff ff 	movabs $0xffffffffffffb887,%rax
+  803622:	ff ff ff 
+  803625:	48 01 d8             	add    %rbx,%rax
+  803628:	ff d0                	call   *%rax
+  80362a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80362d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803631:	79 05                	jns    803638 <stat+0x53>
+		return fd;
+  803633:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803636:	eb 37                	jmp    80366f <stat+0x8a>
+	r = fstat(fd, stat);
+  803638:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80363c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80363f:	48 89 d6             	mov    %rdx,%rsi
+  803642:	89 c7                	mov    %eax,%edi
+  803644:	48 b8 d3 b4 ff ff ff 	movabs $0xffffffffffffb4d3,%rax
+  80364b:	ff ff ff 
+  80364e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803652:	ff d0                	call   *%rax
+  803654:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803657:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80365a:	89 c7                	mov    %eax,%edi
+  80365c:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  803663:	ff ff ff 
+  803666:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80366a:	ff d0                	call   *%rax
+	return r;
+  80366c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  80366f:	48 83 c4 20          	add    $0x20,%rsp
+  803673:	5b                   	pop    %rbx
+  803674:	41 5f                	pop    %r15
+  803676:	5d                   	pop    %rbp
+  803677:	c3                   	ret
+
+0000000000803678 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803678:	55                   	push   %rbp
+  803679:	48 89 e5             	mov    %rsp,%rbp
+  80367c:	41 57                	push   %r15
+  80367e:	53                   	push   %rbx
+  80367f:	48 83 ec 10          	sub    $0x10,%rsp
+  803683:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803683 <fsipc+0xb>
+  80368a:	49 bb b5 49 00 00 00 	movabs $0x49b5,%r11
+  803691:	00 00 00 
+  803694:	4c 01 db             	add    %r11,%rbx
+  803697:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80369a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80369e:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8036a5:	00 00 00 
+  8036a8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036ab:	85 c0                	test   %eax,%eax
+  8036ad:	75 24                	jne    8036d3 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036af:	bf 01 00 00 00       	mov    $0x1,%edi
+  8036b4:	49 89 df             	mov    %rbx,%r15
+  8036b7:	48 b8 87 e0 ff ff ff 	movabs $0xffffffffffffe087,%rax
+  8036be:	ff ff ff 
+  8036c1:	48 01 d8             	add    %rbx,%rax
+  8036c4:	ff d0                	call   *%rax
+  8036c6:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  8036cd:	00 00 00 
+  8036d0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8036d3:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8036da:	00 00 00 
+  8036dd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036e0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036e4:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8036e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8036ed:	49 89 d0             	mov    %rdx,%r8
+  8036f0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8036f5:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  8036fc:	00 00 00 
+  8036ff:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803703:	89 c7                	mov    %eax,%edi
+  803705:	49 89 df             	mov    %rbx,%r15
+  803708:	48 b8 a6 da ff ff ff 	movabs $0xffffffffffffdaa6,%rax
+  80370f:	ff ff ff 
+  803712:	48 01 d8             	add    %rbx,%rax
+  803715:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803717:	48 83 c4 10          	add    $0x10,%rsp
+  80371b:	5b                   	pop    %rbx
+  80371c:	41 5f                	pop    %r15
+  80371e:	5d                   	pop    %rbp
+  80371f:	c3                   	ret
+
+0000000000803720 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803720:	55                   	push   %rbp
+  803721:	48 89 e5             	mov    %rsp,%rbp
+  803724:	41 57                	push   %r15
+  803726:	53                   	push   %rbx
+  803727:	48 83 ec 20          	sub    $0x20,%rsp
+  80372b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80372b <fsipc_words+0xb>
+  803732:	49 bb 0d 49 00 00 00 	movabs $0x490d,%r11
+  803739:	00 00 00 
+  80373c:	4c 01 db             	add    %r11,%rbx
+  80373f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803742:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803746:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80374a:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803751:	00 00 00 
+  803754:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803757:	85 c0                	test   %eax,%eax
+  803759:	75 24                	jne    80377f <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80375b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803760:	49 89 df             	mov    %rbx,%r15
+  803763:	48 b8 87 e0 ff ff ff 	movabs $0xffffffffffffe087,%rax
+  80376a:	ff ff ff 
+  80376d:	48 01 d8             	add    %rbx,%rax
+  803770:	ff d0                	call   *%rax
+  803772:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  803779:	00 00 00 
+  80377c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  80377f:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803786:	00 00 00 
+  803789:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80378c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803790:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803794:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803797:	89 c7                	mov    %eax,%edi
+  803799:	49 89 df             	mov    %rbx,%r15
+  80379c:	48 b8 91 db ff ff ff 	movabs $0xffffffffffffdb91,%rax
+  8037a3:	ff ff ff 
+  8037a6:	48 01 d8             	add    %rbx,%rax
+  8037a9:	ff d0                	call   *%rax
+}
+  8037ab:	48 83 c4 20          	add    $0x20,%rsp
+  8037af:	5b                   	pop    %rbx
+  8037b0:	41 5f                	pop    %r15
+  8037b2:	5d                   	pop    %rbp
+  8037b3:	c3                   	ret
+
+00000000008037b4 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8037b4:	55                   	push   %rbp
+  8037b5:	48 89 e5             	mov    %rsp,%rbp
+  8037b8:	41 57                	push   %r15
+  8037ba:	53                   	push   %rbx
+  8037bb:	48 83 ec 40          	sub    $0x40,%rsp
+  8037bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037bf <fsipc_pages+0xb>
+  8037c6:	49 bb 79 48 00 00 00 	movabs $0x4879,%r11
+  8037cd:	00 00 00 
+  8037d0:	4c 01 db             	add    %r11,%rbx
+  8037d3:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8037d6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8037da:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8037de:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8037e1:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8037e8:	00 00 00 
+  8037eb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8037ee:	85 c0                	test   %eax,%eax
+  8037f0:	75 24                	jne    803816 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8037f2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8037f7:	49 89 df             	mov    %rbx,%r15
+  8037fa:	48 b8 87 e0 ff ff ff 	movabs $0xffffffffffffe087,%rax
+  803801:	ff ff ff 
+  803804:	48 01 d8             	add    %rbx,%rax
+  803807:	ff d0                	call   *%rax
+  803809:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  803810:	00 00 00 
+  803813:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803816:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80381b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  80381f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803822:	48 98                	cltq
+  803824:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  803828:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80382c:	0f 95 c0             	setne  %al
+  80382f:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803832:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803839:	00 
+  80383a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80383e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803842:	48 01 d0             	add    %rdx,%rax
+  803845:	48 83 e8 01          	sub    $0x1,%rax
+  803849:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80384d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803851:	ba 00 00 00 00       	mov    $0x0,%edx
+  803856:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80385a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80385e:	48 29 d0             	sub    %rdx,%rax
+  803861:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803865:	41 89 c2             	mov    %eax,%r10d
+  803868:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80386f:	00 00 00 
+  803872:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803875:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  803879:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80387d:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803880:	48 83 ec 08          	sub    $0x8,%rsp
+  803884:	6a 40                	push   $0x40
+  803886:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  80388b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803892:	00 
+  803893:	6a 05                	push   $0x5
+  803895:	41 89 f9             	mov    %edi,%r9d
+  803898:	49 89 c8             	mov    %rcx,%r8
+  80389b:	44 89 d1             	mov    %r10d,%ecx
+  80389e:	89 c7                	mov    %eax,%edi
+  8038a0:	49 89 df             	mov    %rbx,%r15
+  8038a3:	48 b8 8f dc ff ff ff 	movabs $0xffffffffffffdc8f,%rax
+  8038aa:	ff ff ff 
+  8038ad:	48 01 d8             	add    %rbx,%rax
+  8038b0:	ff d0                	call   *%rax
+  8038b2:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8038b6:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8038ba:	5b                   	pop    %rbx
+  8038bb:	41 5f                	pop    %r15
+  8038bd:	5d                   	pop    %rbp
+  8038be:	c3                   	ret
+
+00000000008038bf <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8038bf:	55                   	push   %rbp
+  8038c0:	48 89 e5             	mov    %rsp,%rbp
+  8038c3:	41 57                	push   %r15
+  8038c5:	53                   	push   %rbx
+  8038c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8038ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038ca <open+0xb>
+  8038d1:	49 bb 6e 47 00 00 00 	movabs $0x476e,%r11
+  8038d8:	00 00 00 
+  8038db:	4c 01 db             	add    %r11,%rbx
+  8038de:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8038e2:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8038e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8038e9:	48 89 c7             	mov    %rax,%rdi
+  8038ec:	49 89 df             	mov    %rbx,%r15
+  8038ef:	48 b8 48 95 ff ff ff 	movabs $0xffffffffffff9548,%rax
+  8038f6:	ff ff ff 
+  8038f9:	48 01 d8             	add    %rbx,%rax
+  8038fc:	ff d0                	call   *%rax
+  8038fe:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803903:	7e 0a                	jle    80390f <open+0x50>
+		return -E_BAD_PATH;
+  803905:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80390a:	e9 18 01 00 00       	jmp    803a27 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  80390f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803913:	48 89 c7             	mov    %rax,%rdi
+  803916:	49 89 df             	mov    %rbx,%r15
+  803919:	48 b8 bb aa ff ff ff 	movabs $0xffffffffffffaabb,%rax
+  803920:	ff ff ff 
+  803923:	48 01 d8             	add    %rbx,%rax
+  803926:	ff d0                	call   *%rax
+  803928:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80392b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80392f:	74 08                	je     803939 <open+0x7a>
+		return r;
+  803931:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803934:	e9 ee 00 00 00       	jmp    803a27 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  803939:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803940:	00 00 00 
+  803943:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803946:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80394d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803951:	48 89 c6             	mov    %rax,%rsi
+  803954:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  80395b:	00 00 00 
+  80395e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803962:	48 89 c7             	mov    %rax,%rdi
+  803965:	49 89 df             	mov    %rbx,%r15
+  803968:	48 b8 dc 95 ff ff ff 	movabs $0xffffffffffff95dc,%rax
+  80396f:	ff ff ff 
+  803972:	48 01 d8             	add    %rbx,%rax
+  803975:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803977:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80397b:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803980:	48 89 c6             	mov    %rax,%rsi
+  803983:	bf 00 00 00 00       	mov    $0x0,%edi
+  803988:	49 89 df             	mov    %rbx,%r15
+  80398b:	48 b8 98 a2 ff ff ff 	movabs $0xffffffffffffa298,%rax
+  803992:	ff ff ff 
+  803995:	48 01 d8             	add    %rbx,%rax
+  803998:	ff d0                	call   *%rax
+  80399a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80399d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039a1:	74 23                	je     8039c6 <open+0x107>
+		fd_close(fd,0);
+  8039a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ac:	48 89 c7             	mov    %rax,%rdi
+  8039af:	49 89 df             	mov    %rbx,%r15
+  8039b2:	48 b8 1c ac ff ff ff 	movabs $0xffffffffffffac1c,%rax
+  8039b9:	ff ff ff 
+  8039bc:	48 01 d8             	add    %rbx,%rax
+  8039bf:	ff d0                	call   *%rax
+		return r;
+  8039c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039c4:	eb 61                	jmp    803a27 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8039c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ca:	48 89 c6             	mov    %rax,%rsi
+  8039cd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8039d2:	48 b8 40 b6 ff ff ff 	movabs $0xffffffffffffb640,%rax
+  8039d9:	ff ff ff 
+  8039dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039e0:	ff d0                	call   *%rax
+  8039e2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039e9:	74 23                	je     803a0e <open+0x14f>
+		fd_close(fd,0);
+  8039eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8039f4:	48 89 c7             	mov    %rax,%rdi
+  8039f7:	49 89 df             	mov    %rbx,%r15
+  8039fa:	48 b8 1c ac ff ff ff 	movabs $0xffffffffffffac1c,%rax
+  803a01:	ff ff ff 
+  803a04:	48 01 d8             	add    %rbx,%rax
+  803a07:	ff d0                	call   *%rax
+		return r;
+  803a09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a0c:	eb 19                	jmp    803a27 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803a0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a12:	48 89 c7             	mov    %rax,%rdi
+  803a15:	49 89 df             	mov    %rbx,%r15
+  803a18:	48 b8 41 aa ff ff ff 	movabs $0xffffffffffffaa41,%rax
+  803a1f:	ff ff ff 
+  803a22:	48 01 d8             	add    %rbx,%rax
+  803a25:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  803a27:	48 83 c4 20          	add    $0x20,%rsp
+  803a2b:	5b                   	pop    %rbx
+  803a2c:	41 5f                	pop    %r15
+  803a2e:	5d                   	pop    %rbp
+  803a2f:	c3                   	ret
+
+0000000000803a30 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803a30:	55                   	push   %rbp
+  803a31:	48 89 e5             	mov    %rsp,%rbp
+  803a34:	48 83 ec 20          	sub    $0x20,%rsp
+  803a38:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a38 <devfile_flush+0x8>
+  803a3f:	49 bb 00 46 00 00 00 	movabs $0x4600,%r11
+  803a46:	00 00 00 
+  803a49:	4c 01 d8             	add    %r11,%rax
+  803a4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803a50:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a54:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803a57:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803a5a:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803a5e:	ba 04 00 00 00       	mov    $0x4,%edx
+  803a63:	48 89 ce             	mov    %rcx,%rsi
+  803a66:	bf 06 00 00 00       	mov    $0x6,%edi
+  803a6b:	48 b9 e8 b6 ff ff ff 	movabs $0xffffffffffffb6e8,%rcx
+  803a72:	ff ff ff 
+  803a75:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803a79:	ff d0                	call   *%rax
+}
+  803a7b:	c9                   	leave
+  803a7c:	c3                   	ret
+
+0000000000803a7d <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803a7d:	55                   	push   %rbp
+  803a7e:	48 89 e5             	mov    %rsp,%rbp
+  803a81:	41 57                	push   %r15
+  803a83:	53                   	push   %rbx
+  803a84:	48 83 ec 60          	sub    $0x60,%rsp
+  803a88:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a88 <devfile_read+0xb>
+  803a8f:	49 bb b0 45 00 00 00 	movabs $0x45b0,%r11
+  803a96:	00 00 00 
+  803a99:	4c 01 db             	add    %r11,%rbx
+  803a9c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803aa0:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803aa4:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  803aa8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803aac:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803ab0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803ab4:	8b 50 0c             	mov    0xc(%rax),%edx
+  803ab7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803abb:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803abd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ac1:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  803ac5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  803ac9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803acd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ad2:	ba 10 00 00 00       	mov    $0x10,%edx
+  803ad7:	48 89 c6             	mov    %rax,%rsi
+  803ada:	bf 03 00 00 00       	mov    $0x3,%edi
+  803adf:	48 b8 7c b7 ff ff ff 	movabs $0xffffffffffffb77c,%rax
+  803ae6:	ff ff ff 
+  803ae9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803aed:	ff d0                	call   *%rax
+  803aef:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803af2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803af6:	79 05                	jns    803afd <devfile_read+0x80>
+		return r;
+  803af8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803afb:	eb 64                	jmp    803b61 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803afd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b00:	48 63 d0             	movslq %eax,%rdx
+  803b03:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803b07:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803b0c:	48 01 c1             	add    %rax,%rcx
+  803b0f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803b13:	48 89 ce             	mov    %rcx,%rsi
+  803b16:	48 89 c7             	mov    %rax,%rdi
+  803b19:	49 89 df             	mov    %rbx,%r15
+  803b1c:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  803b23:	ff ff ff 
+  803b26:	48 01 d8             	add    %rbx,%rax
+  803b29:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803b2b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803b32:	ff ff ff 
+  803b35:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b39:	48 8b 00             	mov    (%rax),%rax
+  803b3c:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803b42:	89 c6                	mov    %eax,%esi
+  803b44:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803b49:	48 89 c7             	mov    %rax,%rdi
+  803b4c:	49 89 df             	mov    %rbx,%r15
+  803b4f:	48 b8 41 e0 ff ff ff 	movabs $0xffffffffffffe041,%rax
+  803b56:	ff ff ff 
+  803b59:	48 01 d8             	add    %rbx,%rax
+  803b5c:	ff d0                	call   *%rax
+	return r;
+  803b5e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803b61:	48 83 c4 60          	add    $0x60,%rsp
+  803b65:	5b                   	pop    %rbx
+  803b66:	41 5f                	pop    %r15
+  803b68:	5d                   	pop    %rbp
+  803b69:	c3                   	ret
+
+0000000000803b6a <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803b6a:	55                   	push   %rbp
+  803b6b:	48 89 e5             	mov    %rsp,%rbp
+  803b6e:	41 57                	push   %r15
+  803b70:	53                   	push   %rbx
+  803b71:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803b75:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b75 <devfile_write+0xb>
+  803b7c:	49 bb c3 44 00 00 00 	movabs $0x44c3,%r11
+  803b83:	00 00 00 
+  803b86:	4c 01 db             	add    %r11,%rbx
+  803b89:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803b8d:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803b91:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803b98:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803b9c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803ba0:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803ba7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803bab:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803bb2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803bb5:	48 63 d0             	movslq %eax,%rdx
+  803bb8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bbc:	48 39 c2             	cmp    %rax,%rdx
+  803bbf:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803bc3:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803bca:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803bd1:	00 
+  803bd2:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803bd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bdd:	48 01 d0             	add    %rdx,%rax
+  803be0:	48 83 e8 01          	sub    $0x1,%rax
+  803be4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803be8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bec:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bf1:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803bf5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bf9:	48 29 d0             	sub    %rdx,%rax
+  803bfc:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c00:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803c03:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803c06:	89 c6                	mov    %eax,%esi
+  803c08:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803c0d:	48 89 c7             	mov    %rax,%rdi
+  803c10:	49 89 df             	mov    %rbx,%r15
+  803c13:	48 b8 fb df ff ff ff 	movabs $0xffffffffffffdffb,%rax
+  803c1a:	ff ff ff 
+  803c1d:	48 01 d8             	add    %rbx,%rax
+  803c20:	ff d0                	call   *%rax
+  803c22:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803c25:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803c29:	79 08                	jns    803c33 <devfile_write+0xc9>
+		return r;
+  803c2b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803c2e:	e9 8f 00 00 00       	jmp    803cc2 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803c33:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803c3a:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803c3e:	48 89 c6             	mov    %rax,%rsi
+  803c41:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803c46:	48 89 c7             	mov    %rax,%rdi
+  803c49:	49 89 df             	mov    %rbx,%r15
+  803c4c:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  803c53:	ff ff ff 
+  803c56:	48 01 d8             	add    %rbx,%rax
+  803c59:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803c5b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803c5f:	8b 50 0c             	mov    0xc(%rax),%edx
+  803c62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c66:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803c68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c6c:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803c73:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803c77:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803c7a:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803c7e:	89 d1                	mov    %edx,%ecx
+  803c80:	ba 10 00 00 00       	mov    $0x10,%edx
+  803c85:	48 89 c6             	mov    %rax,%rsi
+  803c88:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c8d:	48 b8 7c b7 ff ff ff 	movabs $0xffffffffffffb77c,%rax
+  803c94:	ff ff ff 
+  803c97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c9b:	ff d0                	call   *%rax
+  803c9d:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803ca0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803ca3:	89 c6                	mov    %eax,%esi
+  803ca5:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803caa:	48 89 c7             	mov    %rax,%rdi
+  803cad:	49 89 df             	mov    %rbx,%r15
+  803cb0:	48 b8 41 e0 ff ff ff 	movabs $0xffffffffffffe041,%rax
+  803cb7:	ff ff ff 
+  803cba:	48 01 d8             	add    %rbx,%rax
+  803cbd:	ff d0                	call   *%rax
+	return r;
+  803cbf:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803cc2:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803cc6:	5b                   	pop    %rbx
+  803cc7:	41 5f                	pop    %r15
+  803cc9:	5d                   	pop    %rbp
+  803cca:	c3                   	ret
+
+0000000000803ccb <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803ccb:	55                   	push   %rbp
+  803ccc:	48 89 e5             	mov    %rsp,%rbp
+  803ccf:	41 57                	push   %r15
+  803cd1:	53                   	push   %rbx
+  803cd2:	48 83 ec 20          	sub    $0x20,%rsp
+  803cd6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cd6 <devfile_stat+0xb>
+  803cdd:	49 bb 62 43 00 00 00 	movabs $0x4362,%r11
+  803ce4:	00 00 00 
+  803ce7:	4c 01 db             	add    %r11,%rbx
+  803cea:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803cee:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803cf2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cf6:	8b 40 0c             	mov    0xc(%rax),%eax
+  803cf9:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803d00:	00 00 00 
+  803d03:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803d06:	be 00 00 00 00       	mov    $0x0,%esi
+  803d0b:	bf 05 00 00 00       	mov    $0x5,%edi
+  803d10:	48 b8 40 b6 ff ff ff 	movabs $0xffffffffffffb640,%rax
+  803d17:	ff ff ff 
+  803d1a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d1e:	ff d0                	call   *%rax
+  803d20:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d23:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d27:	79 05                	jns    803d2e <devfile_stat+0x63>
+		return r;
+  803d29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d2c:	eb 65                	jmp    803d93 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d2e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d32:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803d39:	00 00 00 
+  803d3c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803d40:	48 89 d6             	mov    %rdx,%rsi
+  803d43:	48 89 c7             	mov    %rax,%rdi
+  803d46:	49 89 df             	mov    %rbx,%r15
+  803d49:	48 b8 dc 95 ff ff ff 	movabs $0xffffffffffff95dc,%rax
+  803d50:	ff ff ff 
+  803d53:	48 01 d8             	add    %rbx,%rax
+  803d56:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803d58:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803d5f:	00 00 00 
+  803d62:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803d69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d6d:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803d73:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803d7a:	00 00 00 
+  803d7d:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803d84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d88:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d93:	48 83 c4 20          	add    $0x20,%rsp
+  803d97:	5b                   	pop    %rbx
+  803d98:	41 5f                	pop    %r15
+  803d9a:	5d                   	pop    %rbp
+  803d9b:	c3                   	ret
+
+0000000000803d9c <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803d9c:	55                   	push   %rbp
+  803d9d:	48 89 e5             	mov    %rsp,%rbp
+  803da0:	48 83 ec 20          	sub    $0x20,%rsp
+  803da4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803da4 <devfile_trunc+0x8>
+  803dab:	49 bb 94 42 00 00 00 	movabs $0x4294,%r11
+  803db2:	00 00 00 
+  803db5:	4c 01 d8             	add    %r11,%rax
+  803db8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803dbc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803dbf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803dc3:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803dc6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803dc9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803dcc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803dcf:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803dd3:	ba 08 00 00 00       	mov    $0x8,%edx
+  803dd8:	48 89 ce             	mov    %rcx,%rsi
+  803ddb:	bf 02 00 00 00       	mov    $0x2,%edi
+  803de0:	48 b9 e8 b6 ff ff ff 	movabs $0xffffffffffffb6e8,%rcx
+  803de7:	ff ff ff 
+  803dea:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803dee:	ff d0                	call   *%rax
+}
+  803df0:	c9                   	leave
+  803df1:	c3                   	ret
+
+0000000000803df2 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803df2:	55                   	push   %rbp
+  803df3:	48 89 e5             	mov    %rsp,%rbp
+  803df6:	41 57                	push   %r15
+  803df8:	53                   	push   %rbx
+  803df9:	48 83 ec 10          	sub    $0x10,%rsp
+  803dfd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803dfd <remove+0xb>
+  803e04:	49 bb 3b 42 00 00 00 	movabs $0x423b,%r11
+  803e0b:	00 00 00 
+  803e0e:	4c 01 db             	add    %r11,%rbx
+  803e11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803e15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e19:	48 89 c7             	mov    %rax,%rdi
+  803e1c:	49 89 df             	mov    %rbx,%r15
+  803e1f:	48 b8 48 95 ff ff ff 	movabs $0xffffffffffff9548,%rax
+  803e26:	ff ff ff 
+  803e29:	48 01 d8             	add    %rbx,%rax
+  803e2c:	ff d0                	call   *%rax
+  803e2e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803e33:	7e 07                	jle    803e3c <remove+0x4a>
+		return -E_BAD_PATH;
+  803e35:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803e3a:	eb 44                	jmp    803e80 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803e3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e40:	48 89 c6             	mov    %rax,%rsi
+  803e43:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803e4a:	00 00 00 
+  803e4d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e51:	48 89 c7             	mov    %rax,%rdi
+  803e54:	49 89 df             	mov    %rbx,%r15
+  803e57:	48 b8 dc 95 ff ff ff 	movabs $0xffffffffffff95dc,%rax
+  803e5e:	ff ff ff 
+  803e61:	48 01 d8             	add    %rbx,%rax
+  803e64:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803e66:	be 00 00 00 00       	mov    $0x0,%esi
+  803e6b:	bf 07 00 00 00       	mov    $0x7,%edi
+  803e70:	48 b8 40 b6 ff ff ff 	movabs $0xffffffffffffb640,%rax
+  803e77:	ff ff ff 
+  803e7a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e7e:	ff d0                	call   *%rax
+}
+  803e80:	48 83 c4 10          	add    $0x10,%rsp
+  803e84:	5b                   	pop    %rbx
+  803e85:	41 5f                	pop    %r15
+  803e87:	5d                   	pop    %rbp
+  803e88:	c3                   	ret
+
+0000000000803e89 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803e89:	55                   	push   %rbp
+  803e8a:	48 89 e5             	mov    %rsp,%rbp
+  803e8d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e8d <sync+0x4>
+  803e94:	49 bb ab 41 00 00 00 	movabs $0x41ab,%r11
+  803e9b:	00 00 00 
+  803e9e:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803ea1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ea6:	be 00 00 00 00       	mov    $0x0,%esi
+  803eab:	bf 08 00 00 00       	mov    $0x8,%edi
+  803eb0:	48 b9 e8 b6 ff ff ff 	movabs $0xffffffffffffb6e8,%rcx
+  803eb7:	ff ff ff 
+  803eba:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803ebe:	ff d0                	call   *%rax
+}
+  803ec0:	5d                   	pop    %rbp
+  803ec1:	c3                   	ret
+
+0000000000803ec2 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803ec2:	55                   	push   %rbp
+  803ec3:	48 89 e5             	mov    %rsp,%rbp
+  803ec6:	41 57                	push   %r15
+  803ec8:	53                   	push   %rbx
+  803ec9:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803ed0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ed0 <copy+0xe>
+  803ed7:	49 bb 68 41 00 00 00 	movabs $0x4168,%r11
+  803ede:	00 00 00 
+  803ee1:	4c 01 db             	add    %r11,%rbx
+  803ee4:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803eeb:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803ef2:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803ef9:	be 00 00 00 00       	mov    $0x0,%esi
+  803efe:	48 89 c7             	mov    %rax,%rdi
+  803f01:	48 b8 87 b8 ff ff ff 	movabs $0xffffffffffffb887,%rax
+  803f08:	ff ff ff 
+  803f0b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f0f:	ff d0                	call   *%rax
+  803f11:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803f14:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f18:	79 35                	jns    803f4f <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803f1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f1d:	89 c6                	mov    %eax,%esi
+  803f1f:	48 b8 46 e7 ff ff ff 	movabs $0xffffffffffffe746,%rax
+  803f26:	ff ff ff 
+  803f29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f2d:	48 89 c7             	mov    %rax,%rdi
+  803f30:	49 89 df             	mov    %rbx,%r15
+  803f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f38:	48 ba 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%rdx
+  803f3f:	ff ff ff 
+  803f42:	48 01 da             	add    %rbx,%rdx
+  803f45:	ff d2                	call   *%rdx
+		return fd_src;
+  803f47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f4a:	e9 d7 01 00 00       	jmp    804126 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803f4f:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803f56:	be 01 01 00 00       	mov    $0x101,%esi
+  803f5b:	48 89 c7             	mov    %rax,%rdi
+  803f5e:	48 b8 87 b8 ff ff ff 	movabs $0xffffffffffffb887,%rax
+  803f65:	ff ff ff 
+  803f68:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f6c:	ff d0                	call   *%rax
+  803f6e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803f71:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803f75:	0f 89 df 00 00 00    	jns    80405a <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803f7b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f7e:	89 c6                	mov    %eax,%esi
+  803f80:	48 b8 5c e7 ff ff ff 	movabs $0xffffffffffffe75c,%rax
+  803f87:	ff ff ff 
+  803f8a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f8e:	48 89 c7             	mov    %rax,%rdi
+  803f91:	49 89 df             	mov    %rbx,%r15
+  803f94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f99:	48 ba 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%rdx
+  803fa0:	ff ff ff 
+  803fa3:	48 01 da             	add    %rbx,%rdx
+  803fa6:	ff d2                	call   *%rdx
+		close(fd_src);
+  803fa8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fab:	89 c7                	mov    %eax,%edi
+  803fad:	49 89 df             	mov    %rbx,%r15
+  803fb0:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  803fb7:	ff ff ff 
+  803fba:	48 01 d8             	add    %rbx,%rax
+  803fbd:	ff d0                	call   *%rax
+		return fd_dest;
+  803fbf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803fc2:	e9 5f 01 00 00       	jmp    804126 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803fc7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fca:	48 63 d0             	movslq %eax,%rdx
+  803fcd:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803fd4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803fd7:	48 89 ce             	mov    %rcx,%rsi
+  803fda:	89 c7                	mov    %eax,%edi
+  803fdc:	49 89 df             	mov    %rbx,%r15
+  803fdf:	48 b8 5e b2 ff ff ff 	movabs $0xffffffffffffb25e,%rax
+  803fe6:	ff ff ff 
+  803fe9:	48 01 d8             	add    %rbx,%rax
+  803fec:	ff d0                	call   *%rax
+  803fee:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803ff1:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803ff5:	79 63                	jns    80405a <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803ff7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803ffa:	89 c6                	mov    %eax,%esi
+  803ffc:	48 b8 76 e7 ff ff ff 	movabs $0xffffffffffffe776,%rax
+  804003:	ff ff ff 
+  804006:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80400a:	48 89 c7             	mov    %rax,%rdi
+  80400d:	49 89 df             	mov    %rbx,%r15
+  804010:	b8 00 00 00 00       	mov    $0x0,%eax
+  804015:	48 ba 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%rdx
+  80401c:	ff ff ff 
+  80401f:	48 01 da             	add    %rbx,%rdx
+  804022:	ff d2                	call   *%rdx
+			close(fd_src);
+  804024:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804027:	89 c7                	mov    %eax,%edi
+  804029:	49 89 df             	mov    %rbx,%r15
+  80402c:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  804033:	ff ff ff 
+  804036:	48 01 d8             	add    %rbx,%rax
+  804039:	ff d0                	call   *%rax
+			close(fd_dest);
+  80403b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80403e:	89 c7                	mov    %eax,%edi
+  804040:	49 89 df             	mov    %rbx,%r15
+  804043:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  80404a:	ff ff ff 
+  80404d:	48 01 d8             	add    %rbx,%rax
+  804050:	ff d0                	call   *%rax
+			return write_size;
+  804052:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804055:	e9 cc 00 00 00       	jmp    804126 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  80405a:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804061:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804064:	ba 00 02 00 00       	mov    $0x200,%edx
+  804069:	48 89 ce             	mov    %rcx,%rsi
+  80406c:	89 c7                	mov    %eax,%edi
+  80406e:	49 89 df             	mov    %rbx,%r15
+  804071:	48 b8 b8 b0 ff ff ff 	movabs $0xffffffffffffb0b8,%rax
+  804078:	ff ff ff 
+  80407b:	48 01 d8             	add    %rbx,%rax
+  80407e:	ff d0                	call   *%rax
+  804080:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804083:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804087:	0f 8f 3a ff ff ff    	jg     803fc7 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  80408d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804091:	79 60                	jns    8040f3 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804093:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804096:	89 c6                	mov    %eax,%esi
+  804098:	48 b8 89 e7 ff ff ff 	movabs $0xffffffffffffe789,%rax
+  80409f:	ff ff ff 
+  8040a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040a6:	48 89 c7             	mov    %rax,%rdi
+  8040a9:	49 89 df             	mov    %rbx,%r15
+  8040ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b1:	48 ba 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%rdx
+  8040b8:	ff ff ff 
+  8040bb:	48 01 da             	add    %rbx,%rdx
+  8040be:	ff d2                	call   *%rdx
+		close(fd_src);
+  8040c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040c3:	89 c7                	mov    %eax,%edi
+  8040c5:	49 89 df             	mov    %rbx,%r15
+  8040c8:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  8040cf:	ff ff ff 
+  8040d2:	48 01 d8             	add    %rbx,%rax
+  8040d5:	ff d0                	call   *%rax
+		close(fd_dest);
+  8040d7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8040da:	89 c7                	mov    %eax,%edi
+  8040dc:	49 89 df             	mov    %rbx,%r15
+  8040df:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  8040e6:	ff ff ff 
+  8040e9:	48 01 d8             	add    %rbx,%rax
+  8040ec:	ff d0                	call   *%rax
+		return read_size;
+  8040ee:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8040f1:	eb 33                	jmp    804126 <copy+0x264>
+	}
+	close(fd_src);
+  8040f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040f6:	89 c7                	mov    %eax,%edi
+  8040f8:	49 89 df             	mov    %rbx,%r15
+  8040fb:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  804102:	ff ff ff 
+  804105:	48 01 d8             	add    %rbx,%rax
+  804108:	ff d0                	call   *%rax
+	close(fd_dest);
+  80410a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80410d:	89 c7                	mov    %eax,%edi
+  80410f:	49 89 df             	mov    %rbx,%r15
+  804112:	48 b8 00 ae ff ff ff 	movabs $0xffffffffffffae00,%rax
+  804119:	ff ff ff 
+  80411c:	48 01 d8             	add    %rbx,%rax
+  80411f:	ff d0                	call   *%rax
+	return 0;
+  804121:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804126:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  80412d:	5b                   	pop    %rbx
+  80412e:	41 5f                	pop    %r15
+  804130:	5d                   	pop    %rbp
+  804131:	c3                   	ret
+
+0000000000804132 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804132:	55                   	push   %rbp
+  804133:	48 89 e5             	mov    %rsp,%rbp
+  804136:	41 57                	push   %r15
+  804138:	53                   	push   %rbx
+  804139:	48 83 ec 20          	sub    $0x20,%rsp
+  80413d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80413d <fd2sockid+0xb>
+  804144:	49 bb fb 3e 00 00 00 	movabs $0x3efb,%r11
+  80414b:	00 00 00 
+  80414e:	4c 01 db             	add    %r11,%rbx
+  804151:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804154:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804158:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80415b:	48 89 d6             	mov    %rdx,%rsi
+  80415e:	89 c7                	mov    %eax,%edi
+  804160:	49 89 df             	mov    %rbx,%r15
+  804163:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  80416a:	ff ff ff 
+  80416d:	48 01 d8             	add    %rbx,%rax
+  804170:	ff d0                	call   *%rax
+  804172:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804175:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804179:	79 05                	jns    804180 <fd2sockid+0x4e>
+		return r;
+  80417b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80417e:	eb 25                	jmp    8041a5 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804180:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804184:	8b 10                	mov    (%rax),%edx
+  804186:	48 b8 88 00 00 00 00 	movabs $0x88,%rax
+  80418d:	00 00 00 
+  804190:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804193:	39 c2                	cmp    %eax,%edx
+  804195:	74 07                	je     80419e <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804197:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80419c:	eb 07                	jmp    8041a5 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  80419e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041a2:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8041a5:	48 83 c4 20          	add    $0x20,%rsp
+  8041a9:	5b                   	pop    %rbx
+  8041aa:	41 5f                	pop    %r15
+  8041ac:	5d                   	pop    %rbp
+  8041ad:	c3                   	ret
+
+00000000008041ae <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8041ae:	55                   	push   %rbp
+  8041af:	48 89 e5             	mov    %rsp,%rbp
+  8041b2:	41 57                	push   %r15
+  8041b4:	53                   	push   %rbx
+  8041b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8041b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041b9 <alloc_sockfd+0xb>
+  8041c0:	49 bb 7f 3e 00 00 00 	movabs $0x3e7f,%r11
+  8041c7:	00 00 00 
+  8041ca:	4c 01 db             	add    %r11,%rbx
+  8041cd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8041d0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8041d4:	48 89 c7             	mov    %rax,%rdi
+  8041d7:	49 89 df             	mov    %rbx,%r15
+  8041da:	48 b8 bb aa ff ff ff 	movabs $0xffffffffffffaabb,%rax
+  8041e1:	ff ff ff 
+  8041e4:	48 01 d8             	add    %rbx,%rax
+  8041e7:	ff d0                	call   *%rax
+  8041e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041f0:	78 2c                	js     80421e <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8041f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041f6:	ba 07 04 00 00       	mov    $0x407,%edx
+  8041fb:	48 89 c6             	mov    %rax,%rsi
+  8041fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  804203:	49 89 df             	mov    %rbx,%r15
+  804206:	48 b8 98 a2 ff ff ff 	movabs $0xffffffffffffa298,%rax
+  80420d:	ff ff ff 
+  804210:	48 01 d8             	add    %rbx,%rax
+  804213:	ff d0                	call   *%rax
+  804215:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804218:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80421c:	79 1c                	jns    80423a <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80421e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804221:	89 c7                	mov    %eax,%edi
+  804223:	49 89 df             	mov    %rbx,%r15
+  804226:	48 b8 6a c9 ff ff ff 	movabs $0xffffffffffffc96a,%rax
+  80422d:	ff ff ff 
+  804230:	48 01 d8             	add    %rbx,%rax
+  804233:	ff d0                	call   *%rax
+		return r;
+  804235:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804238:	eb 41                	jmp    80427b <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80423a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80423e:	48 ba 88 00 00 00 00 	movabs $0x88,%rdx
+  804245:	00 00 00 
+  804248:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80424b:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  80424d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804251:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804258:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80425c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80425f:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804262:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804266:	48 89 c7             	mov    %rax,%rdi
+  804269:	49 89 df             	mov    %rbx,%r15
+  80426c:	48 b8 41 aa ff ff ff 	movabs $0xffffffffffffaa41,%rax
+  804273:	ff ff ff 
+  804276:	48 01 d8             	add    %rbx,%rax
+  804279:	ff d0                	call   *%rax
+}
+  80427b:	48 83 c4 20          	add    $0x20,%rsp
+  80427f:	5b                   	pop    %rbx
+  804280:	41 5f                	pop    %r15
+  804282:	5d                   	pop    %rbp
+  804283:	c3                   	ret
+
+0000000000804284 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804284:	55                   	push   %rbp
+  804285:	48 89 e5             	mov    %rsp,%rbp
+  804288:	41 57                	push   %r15
+  80428a:	53                   	push   %rbx
+  80428b:	48 83 ec 30          	sub    $0x30,%rsp
+  80428f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80428f <accept+0xb>
+  804296:	49 bb a9 3d 00 00 00 	movabs $0x3da9,%r11
+  80429d:	00 00 00 
+  8042a0:	4c 01 db             	add    %r11,%rbx
+  8042a3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8042a6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8042aa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8042ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8042b1:	89 c7                	mov    %eax,%edi
+  8042b3:	48 b8 fa c0 ff ff ff 	movabs $0xffffffffffffc0fa,%rax
+  8042ba:	ff ff ff 
+  8042bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042c1:	ff d0                	call   *%rax
+  8042c3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042ca:	79 05                	jns    8042d1 <accept+0x4d>
+		return r;
+  8042cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042cf:	eb 45                	jmp    804316 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8042d1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8042d5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8042d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042dc:	48 89 ce             	mov    %rcx,%rsi
+  8042df:	89 c7                	mov    %eax,%edi
+  8042e1:	49 89 df             	mov    %rbx,%r15
+  8042e4:	48 b8 d8 c7 ff ff ff 	movabs $0xffffffffffffc7d8,%rax
+  8042eb:	ff ff ff 
+  8042ee:	48 01 d8             	add    %rbx,%rax
+  8042f1:	ff d0                	call   *%rax
+  8042f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042fa:	79 05                	jns    804301 <accept+0x7d>
+		return r;
+  8042fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042ff:	eb 15                	jmp    804316 <accept+0x92>
+	return alloc_sockfd(r);
+  804301:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804304:	89 c7                	mov    %eax,%edi
+  804306:	48 b8 76 c1 ff ff ff 	movabs $0xffffffffffffc176,%rax
+  80430d:	ff ff ff 
+  804310:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804314:	ff d0                	call   *%rax
+}
+  804316:	48 83 c4 30          	add    $0x30,%rsp
+  80431a:	5b                   	pop    %rbx
+  80431b:	41 5f                	pop    %r15
+  80431d:	5d                   	pop    %rbp
+  80431e:	c3                   	ret
+
+000000000080431f <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80431f:	55                   	push   %rbp
+  804320:	48 89 e5             	mov    %rsp,%rbp
+  804323:	41 57                	push   %r15
+  804325:	53                   	push   %rbx
+  804326:	48 83 ec 20          	sub    $0x20,%rsp
+  80432a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80432a <bind+0xb>
+  804331:	49 bb 0e 3d 00 00 00 	movabs $0x3d0e,%r11
+  804338:	00 00 00 
+  80433b:	4c 01 db             	add    %r11,%rbx
+  80433e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804341:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804345:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804348:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80434b:	89 c7                	mov    %eax,%edi
+  80434d:	48 b8 fa c0 ff ff ff 	movabs $0xffffffffffffc0fa,%rax
+  804354:	ff ff ff 
+  804357:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80435b:	ff d0                	call   *%rax
+  80435d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804360:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804364:	79 05                	jns    80436b <bind+0x4c>
+		return r;
+  804366:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804369:	eb 21                	jmp    80438c <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80436b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80436e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804372:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804375:	48 89 ce             	mov    %rcx,%rsi
+  804378:	89 c7                	mov    %eax,%edi
+  80437a:	49 89 df             	mov    %rbx,%r15
+  80437d:	48 b8 84 c8 ff ff ff 	movabs $0xffffffffffffc884,%rax
+  804384:	ff ff ff 
+  804387:	48 01 d8             	add    %rbx,%rax
+  80438a:	ff d0                	call   *%rax
+}
+  80438c:	48 83 c4 20          	add    $0x20,%rsp
+  804390:	5b                   	pop    %rbx
+  804391:	41 5f                	pop    %r15
+  804393:	5d                   	pop    %rbp
+  804394:	c3                   	ret
+
+0000000000804395 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804395:	55                   	push   %rbp
+  804396:	48 89 e5             	mov    %rsp,%rbp
+  804399:	41 57                	push   %r15
+  80439b:	53                   	push   %rbx
+  80439c:	48 83 ec 20          	sub    $0x20,%rsp
+  8043a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043a0 <shutdown+0xb>
+  8043a7:	49 bb 98 3c 00 00 00 	movabs $0x3c98,%r11
+  8043ae:	00 00 00 
+  8043b1:	4c 01 db             	add    %r11,%rbx
+  8043b4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8043b7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8043ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043bd:	89 c7                	mov    %eax,%edi
+  8043bf:	48 b8 fa c0 ff ff ff 	movabs $0xffffffffffffc0fa,%rax
+  8043c6:	ff ff ff 
+  8043c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043cd:	ff d0                	call   *%rax
+  8043cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043d6:	79 05                	jns    8043dd <shutdown+0x48>
+		return r;
+  8043d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043db:	eb 1c                	jmp    8043f9 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8043dd:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8043e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043e3:	89 d6                	mov    %edx,%esi
+  8043e5:	89 c7                	mov    %eax,%edi
+  8043e7:	49 89 df             	mov    %rbx,%r15
+  8043ea:	48 b8 19 c9 ff ff ff 	movabs $0xffffffffffffc919,%rax
+  8043f1:	ff ff ff 
+  8043f4:	48 01 d8             	add    %rbx,%rax
+  8043f7:	ff d0                	call   *%rax
+}
+  8043f9:	48 83 c4 20          	add    $0x20,%rsp
+  8043fd:	5b                   	pop    %rbx
+  8043fe:	41 5f                	pop    %r15
+  804400:	5d                   	pop    %rbp
+  804401:	c3                   	ret
+
+0000000000804402 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804402:	55                   	push   %rbp
+  804403:	48 89 e5             	mov    %rsp,%rbp
+  804406:	41 57                	push   %r15
+  804408:	53                   	push   %rbx
+  804409:	48 83 ec 10          	sub    $0x10,%rsp
+  80440d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80440d <devsock_close+0xb>
+  804414:	49 bb 2b 3c 00 00 00 	movabs $0x3c2b,%r11
+  80441b:	00 00 00 
+  80441e:	4c 01 db             	add    %r11,%rbx
+  804421:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804425:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804429:	48 89 c7             	mov    %rax,%rdi
+  80442c:	49 89 df             	mov    %rbx,%r15
+  80442f:	48 b8 16 e1 ff ff ff 	movabs $0xffffffffffffe116,%rax
+  804436:	ff ff ff 
+  804439:	48 01 d8             	add    %rbx,%rax
+  80443c:	ff d0                	call   *%rax
+  80443e:	83 f8 01             	cmp    $0x1,%eax
+  804441:	75 1d                	jne    804460 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804443:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804447:	8b 40 0c             	mov    0xc(%rax),%eax
+  80444a:	89 c7                	mov    %eax,%edi
+  80444c:	49 89 df             	mov    %rbx,%r15
+  80444f:	48 b8 6a c9 ff ff ff 	movabs $0xffffffffffffc96a,%rax
+  804456:	ff ff ff 
+  804459:	48 01 d8             	add    %rbx,%rax
+  80445c:	ff d0                	call   *%rax
+  80445e:	eb 05                	jmp    804465 <devsock_close+0x63>
+	else
+		return 0;
+  804460:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804465:	48 83 c4 10          	add    $0x10,%rsp
+  804469:	5b                   	pop    %rbx
+  80446a:	41 5f                	pop    %r15
+  80446c:	5d                   	pop    %rbp
+  80446d:	c3                   	ret
+
+000000000080446e <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80446e:	55                   	push   %rbp
+  80446f:	48 89 e5             	mov    %rsp,%rbp
+  804472:	41 57                	push   %r15
+  804474:	53                   	push   %rbx
+  804475:	48 83 ec 20          	sub    $0x20,%rsp
+  804479:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804479 <connect+0xb>
+  804480:	49 bb bf 3b 00 00 00 	movabs $0x3bbf,%r11
+  804487:	00 00 00 
+  80448a:	4c 01 db             	add    %r11,%rbx
+  80448d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804490:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804494:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804497:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80449a:	89 c7                	mov    %eax,%edi
+  80449c:	48 b8 fa c0 ff ff ff 	movabs $0xffffffffffffc0fa,%rax
+  8044a3:	ff ff ff 
+  8044a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044aa:	ff d0                	call   *%rax
+  8044ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044b3:	79 05                	jns    8044ba <connect+0x4c>
+		return r;
+  8044b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044b8:	eb 21                	jmp    8044db <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8044ba:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8044bd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8044c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044c4:	48 89 ce             	mov    %rcx,%rsi
+  8044c7:	89 c7                	mov    %eax,%edi
+  8044c9:	49 89 df             	mov    %rbx,%r15
+  8044cc:	48 b8 b2 c9 ff ff ff 	movabs $0xffffffffffffc9b2,%rax
+  8044d3:	ff ff ff 
+  8044d6:	48 01 d8             	add    %rbx,%rax
+  8044d9:	ff d0                	call   *%rax
+}
+  8044db:	48 83 c4 20          	add    $0x20,%rsp
+  8044df:	5b                   	pop    %rbx
+  8044e0:	41 5f                	pop    %r15
+  8044e2:	5d                   	pop    %rbp
+  8044e3:	c3                   	ret
+
+00000000008044e4 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8044e4:	55                   	push   %rbp
+  8044e5:	48 89 e5             	mov    %rsp,%rbp
+  8044e8:	41 57                	push   %r15
+  8044ea:	53                   	push   %rbx
+  8044eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8044ef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044ef <listen+0xb>
+  8044f6:	49 bb 49 3b 00 00 00 	movabs $0x3b49,%r11
+  8044fd:	00 00 00 
+  804500:	4c 01 db             	add    %r11,%rbx
+  804503:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804506:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804509:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80450c:	89 c7                	mov    %eax,%edi
+  80450e:	48 b8 fa c0 ff ff ff 	movabs $0xffffffffffffc0fa,%rax
+  804515:	ff ff ff 
+  804518:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80451c:	ff d0                	call   *%rax
+  80451e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804521:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804525:	79 05                	jns    80452c <listen+0x48>
+		return r;
+  804527:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80452a:	eb 1c                	jmp    804548 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80452c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80452f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804532:	89 d6                	mov    %edx,%esi
+  804534:	89 c7                	mov    %eax,%edi
+  804536:	49 89 df             	mov    %rbx,%r15
+  804539:	48 b8 47 ca ff ff ff 	movabs $0xffffffffffffca47,%rax
+  804540:	ff ff ff 
+  804543:	48 01 d8             	add    %rbx,%rax
+  804546:	ff d0                	call   *%rax
+}
+  804548:	48 83 c4 20          	add    $0x20,%rsp
+  80454c:	5b                   	pop    %rbx
+  80454d:	41 5f                	pop    %r15
+  80454f:	5d                   	pop    %rbp
+  804550:	c3                   	ret
+
+0000000000804551 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804551:	55                   	push   %rbp
+  804552:	48 89 e5             	mov    %rsp,%rbp
+  804555:	41 57                	push   %r15
+  804557:	48 83 ec 28          	sub    $0x28,%rsp
+  80455b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80455b <devsock_read+0xa>
+  804562:	49 bb dd 3a 00 00 00 	movabs $0x3add,%r11
+  804569:	00 00 00 
+  80456c:	4c 01 d8             	add    %r11,%rax
+  80456f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804573:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804577:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80457b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80457f:	41 89 d0             	mov    %edx,%r8d
+  804582:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804586:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804589:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80458d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804592:	44 89 c2             	mov    %r8d,%edx
+  804595:	49 89 c7             	mov    %rax,%r15
+  804598:	49 b8 98 ca ff ff ff 	movabs $0xffffffffffffca98,%r8
+  80459f:	ff ff ff 
+  8045a2:	49 01 c0             	add    %rax,%r8
+  8045a5:	41 ff d0             	call   *%r8
+}
+  8045a8:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8045ac:	c9                   	leave
+  8045ad:	c3                   	ret
+
+00000000008045ae <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8045ae:	55                   	push   %rbp
+  8045af:	48 89 e5             	mov    %rsp,%rbp
+  8045b2:	41 57                	push   %r15
+  8045b4:	48 83 ec 28          	sub    $0x28,%rsp
+  8045b8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8045b8 <devsock_write+0xa>
+  8045bf:	49 bb 80 3a 00 00 00 	movabs $0x3a80,%r11
+  8045c6:	00 00 00 
+  8045c9:	4c 01 d8             	add    %r11,%rax
+  8045cc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8045d0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8045d4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8045d8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8045dc:	41 89 d0             	mov    %edx,%r8d
+  8045df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045e3:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8045e6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8045ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8045ef:	44 89 c2             	mov    %r8d,%edx
+  8045f2:	49 89 c7             	mov    %rax,%r15
+  8045f5:	49 b8 b5 cb ff ff ff 	movabs $0xffffffffffffcbb5,%r8
+  8045fc:	ff ff ff 
+  8045ff:	49 01 c0             	add    %rax,%r8
+  804602:	41 ff d0             	call   *%r8
+}
+  804605:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804609:	c9                   	leave
+  80460a:	c3                   	ret
+
+000000000080460b <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80460b:	55                   	push   %rbp
+  80460c:	48 89 e5             	mov    %rsp,%rbp
+  80460f:	41 57                	push   %r15
+  804611:	48 83 ec 18          	sub    $0x18,%rsp
+  804615:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804615 <devsock_stat+0xa>
+  80461c:	49 bb 23 3a 00 00 00 	movabs $0x3a23,%r11
+  804623:	00 00 00 
+  804626:	4c 01 d8             	add    %r11,%rax
+  804629:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80462d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804631:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804635:	48 b9 a4 e7 ff ff ff 	movabs $0xffffffffffffe7a4,%rcx
+  80463c:	ff ff ff 
+  80463f:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804643:	48 89 ce             	mov    %rcx,%rsi
+  804646:	48 89 d7             	mov    %rdx,%rdi
+  804649:	49 89 c7             	mov    %rax,%r15
+  80464c:	48 ba dc 95 ff ff ff 	movabs $0xffffffffffff95dc,%rdx
+  804653:	ff ff ff 
+  804656:	48 01 c2             	add    %rax,%rdx
+  804659:	ff d2                	call   *%rdx
+	return 0;
+  80465b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804660:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804664:	c9                   	leave
+  804665:	c3                   	ret
+
+0000000000804666 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804666:	55                   	push   %rbp
+  804667:	48 89 e5             	mov    %rsp,%rbp
+  80466a:	41 57                	push   %r15
+  80466c:	53                   	push   %rbx
+  80466d:	48 83 ec 20          	sub    $0x20,%rsp
+  804671:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804671 <socket+0xb>
+  804678:	49 bb c7 39 00 00 00 	movabs $0x39c7,%r11
+  80467f:	00 00 00 
+  804682:	4c 01 db             	add    %r11,%rbx
+  804685:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804688:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80468b:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80468e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804691:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804694:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804697:	89 ce                	mov    %ecx,%esi
+  804699:	89 c7                	mov    %eax,%edi
+  80469b:	49 89 df             	mov    %rbx,%r15
+  80469e:	48 b8 8c cd ff ff ff 	movabs $0xffffffffffffcd8c,%rax
+  8046a5:	ff ff ff 
+  8046a8:	48 01 d8             	add    %rbx,%rax
+  8046ab:	ff d0                	call   *%rax
+  8046ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046b4:	79 05                	jns    8046bb <socket+0x55>
+		return r;
+  8046b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046b9:	eb 15                	jmp    8046d0 <socket+0x6a>
+	return alloc_sockfd(r);
+  8046bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046be:	89 c7                	mov    %eax,%edi
+  8046c0:	48 b8 76 c1 ff ff ff 	movabs $0xffffffffffffc176,%rax
+  8046c7:	ff ff ff 
+  8046ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046ce:	ff d0                	call   *%rax
+}
+  8046d0:	48 83 c4 20          	add    $0x20,%rsp
+  8046d4:	5b                   	pop    %rbx
+  8046d5:	41 5f                	pop    %r15
+  8046d7:	5d                   	pop    %rbp
+  8046d8:	c3                   	ret
+
+00000000008046d9 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8046d9:	55                   	push   %rbp
+  8046da:	48 89 e5             	mov    %rsp,%rbp
+  8046dd:	41 57                	push   %r15
+  8046df:	53                   	push   %rbx
+  8046e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8046e4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046e4 <nsipc+0xb>
+  8046eb:	49 bb 54 39 00 00 00 	movabs $0x3954,%r11
+  8046f2:	00 00 00 
+  8046f5:	4c 01 db             	add    %r11,%rbx
+  8046f8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8046fb:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804702:	00 00 00 
+  804705:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804708:	85 c0                	test   %eax,%eax
+  80470a:	75 24                	jne    804730 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80470c:	bf 02 00 00 00       	mov    $0x2,%edi
+  804711:	49 89 df             	mov    %rbx,%r15
+  804714:	48 b8 87 e0 ff ff ff 	movabs $0xffffffffffffe087,%rax
+  80471b:	ff ff ff 
+  80471e:	48 01 d8             	add    %rbx,%rax
+  804721:	ff d0                	call   *%rax
+  804723:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  80472a:	00 00 00 
+  80472d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804730:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804737:	00 00 00 
+  80473a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80473d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804740:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804746:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80474c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804751:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804758:	00 00 00 
+  80475b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80475f:	89 c7                	mov    %eax,%edi
+  804761:	49 89 df             	mov    %rbx,%r15
+  804764:	48 b8 a6 da ff ff ff 	movabs $0xffffffffffffdaa6,%rax
+  80476b:	ff ff ff 
+  80476e:	48 01 d8             	add    %rbx,%rax
+  804771:	ff d0                	call   *%rax
+}
+  804773:	48 83 c4 10          	add    $0x10,%rsp
+  804777:	5b                   	pop    %rbx
+  804778:	41 5f                	pop    %r15
+  80477a:	5d                   	pop    %rbp
+  80477b:	c3                   	ret
+
+000000000080477c <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  80477c:	55                   	push   %rbp
+  80477d:	48 89 e5             	mov    %rsp,%rbp
+  804780:	41 57                	push   %r15
+  804782:	53                   	push   %rbx
+  804783:	48 83 ec 20          	sub    $0x20,%rsp
+  804787:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804787 <nsipc_words+0xb>
+  80478e:	49 bb b1 38 00 00 00 	movabs $0x38b1,%r11
+  804795:	00 00 00 
+  804798:	4c 01 db             	add    %r11,%rbx
+  80479b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80479e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8047a2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8047a6:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8047ad:	00 00 00 
+  8047b0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8047b3:	85 c0                	test   %eax,%eax
+  8047b5:	75 24                	jne    8047db <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8047b7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8047bc:	49 89 df             	mov    %rbx,%r15
+  8047bf:	48 b8 87 e0 ff ff ff 	movabs $0xffffffffffffe087,%rax
+  8047c6:	ff ff ff 
+  8047c9:	48 01 d8             	add    %rbx,%rax
+  8047cc:	ff d0                	call   *%rax
+  8047ce:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  8047d5:	00 00 00 
+  8047d8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8047db:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8047e2:	00 00 00 
+  8047e5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8047e8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8047ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8047f0:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8047f3:	89 c7                	mov    %eax,%edi
+  8047f5:	49 89 df             	mov    %rbx,%r15
+  8047f8:	48 b8 91 db ff ff ff 	movabs $0xffffffffffffdb91,%rax
+  8047ff:	ff ff ff 
+  804802:	48 01 d8             	add    %rbx,%rax
+  804805:	ff d0                	call   *%rax
+}
+  804807:	48 83 c4 20          	add    $0x20,%rsp
+  80480b:	5b                   	pop    %rbx
+  80480c:	41 5f                	pop    %r15
+  80480e:	5d                   	pop    %rbp
+  80480f:	c3                   	ret
+
+0000000000804810 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804810:	55                   	push   %rbp
+  804811:	48 89 e5             	mov    %rsp,%rbp
+  804814:	41 57                	push   %r15
+  804816:	53                   	push   %rbx
+  804817:	48 83 ec 30          	sub    $0x30,%rsp
+  80481b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80481b <nsipc_accept+0xb>
+  804822:	49 bb 1d 38 00 00 00 	movabs $0x381d,%r11
+  804829:	00 00 00 
+  80482c:	4c 01 db             	add    %r11,%rbx
+  80482f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804832:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804836:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80483a:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804841:	00 00 00 
+  804844:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804847:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80484a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80484f:	48 b8 a1 c6 ff ff ff 	movabs $0xffffffffffffc6a1,%rax
+  804856:	ff ff ff 
+  804859:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80485d:	ff d0                	call   *%rax
+  80485f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804862:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804866:	78 48                	js     8048b0 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  804868:	48 b8 c8 3f 01 00 00 	movabs $0x13fc8,%rax
+  80486f:	00 00 00 
+  804872:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804876:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80487a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80487e:	8b 40 10             	mov    0x10(%rax),%eax
+  804881:	89 c2                	mov    %eax,%edx
+  804883:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804887:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80488b:	48 89 ce             	mov    %rcx,%rsi
+  80488e:	48 89 c7             	mov    %rax,%rdi
+  804891:	49 89 df             	mov    %rbx,%r15
+  804894:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  80489b:	ff ff ff 
+  80489e:	48 01 d8             	add    %rbx,%rax
+  8048a1:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8048a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048a7:	8b 50 10             	mov    0x10(%rax),%edx
+  8048aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048ae:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8048b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8048b3:	48 83 c4 30          	add    $0x30,%rsp
+  8048b7:	5b                   	pop    %rbx
+  8048b8:	41 5f                	pop    %r15
+  8048ba:	5d                   	pop    %rbp
+  8048bb:	c3                   	ret
+
+00000000008048bc <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8048bc:	55                   	push   %rbp
+  8048bd:	48 89 e5             	mov    %rsp,%rbp
+  8048c0:	41 57                	push   %r15
+  8048c2:	53                   	push   %rbx
+  8048c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8048c7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048c7 <nsipc_bind+0xb>
+  8048ce:	49 bb 71 37 00 00 00 	movabs $0x3771,%r11
+  8048d5:	00 00 00 
+  8048d8:	4c 01 db             	add    %r11,%rbx
+  8048db:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8048de:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8048e2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8048e5:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8048ec:	00 00 00 
+  8048ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048f2:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8048f5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8048f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048fc:	48 89 c6             	mov    %rax,%rsi
+  8048ff:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  804906:	00 00 00 
+  804909:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80490d:	48 89 c7             	mov    %rax,%rdi
+  804910:	49 89 df             	mov    %rbx,%r15
+  804913:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  80491a:	ff ff ff 
+  80491d:	48 01 d8             	add    %rbx,%rax
+  804920:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804922:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804929:	00 00 00 
+  80492c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80492f:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804933:	bf 02 00 00 00       	mov    $0x2,%edi
+  804938:	48 b8 a1 c6 ff ff ff 	movabs $0xffffffffffffc6a1,%rax
+  80493f:	ff ff ff 
+  804942:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804946:	ff d0                	call   *%rax
+}
+  804948:	48 83 c4 10          	add    $0x10,%rsp
+  80494c:	5b                   	pop    %rbx
+  80494d:	41 5f                	pop    %r15
+  80494f:	5d                   	pop    %rbp
+  804950:	c3                   	ret
+
+0000000000804951 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804951:	55                   	push   %rbp
+  804952:	48 89 e5             	mov    %rsp,%rbp
+  804955:	48 83 ec 20          	sub    $0x20,%rsp
+  804959:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804959 <nsipc_shutdown+0x8>
+  804960:	49 bb df 36 00 00 00 	movabs $0x36df,%r11
+  804967:	00 00 00 
+  80496a:	4c 01 d8             	add    %r11,%rax
+  80496d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804970:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  804973:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804976:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  804979:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80497c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80497f:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804983:	ba 08 00 00 00       	mov    $0x8,%edx
+  804988:	48 89 ce             	mov    %rcx,%rsi
+  80498b:	bf 03 00 00 00       	mov    $0x3,%edi
+  804990:	48 b9 44 c7 ff ff ff 	movabs $0xffffffffffffc744,%rcx
+  804997:	ff ff ff 
+  80499a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80499e:	ff d0                	call   *%rax
+}
+  8049a0:	c9                   	leave
+  8049a1:	c3                   	ret
+
+00000000008049a2 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8049a2:	55                   	push   %rbp
+  8049a3:	48 89 e5             	mov    %rsp,%rbp
+  8049a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8049aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8049aa <nsipc_close+0x8>
+  8049b1:	49 bb 8e 36 00 00 00 	movabs $0x368e,%r11
+  8049b8:	00 00 00 
+  8049bb:	4c 01 d8             	add    %r11,%rax
+  8049be:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8049c1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8049c4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8049c7:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8049cb:	ba 04 00 00 00       	mov    $0x4,%edx
+  8049d0:	48 89 ce             	mov    %rcx,%rsi
+  8049d3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8049d8:	48 b9 44 c7 ff ff ff 	movabs $0xffffffffffffc744,%rcx
+  8049df:	ff ff ff 
+  8049e2:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8049e6:	ff d0                	call   *%rax
+}
+  8049e8:	c9                   	leave
+  8049e9:	c3                   	ret
+
+00000000008049ea <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8049ea:	55                   	push   %rbp
+  8049eb:	48 89 e5             	mov    %rsp,%rbp
+  8049ee:	41 57                	push   %r15
+  8049f0:	53                   	push   %rbx
+  8049f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8049f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049f5 <nsipc_connect+0xb>
+  8049fc:	49 bb 43 36 00 00 00 	movabs $0x3643,%r11
+  804a03:	00 00 00 
+  804a06:	4c 01 db             	add    %r11,%rbx
+  804a09:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804a0c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804a10:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804a13:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804a1a:	00 00 00 
+  804a1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a20:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804a23:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804a26:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a2a:	48 89 c6             	mov    %rax,%rsi
+  804a2d:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  804a34:	00 00 00 
+  804a37:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a3b:	48 89 c7             	mov    %rax,%rdi
+  804a3e:	49 89 df             	mov    %rbx,%r15
+  804a41:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  804a48:	ff ff ff 
+  804a4b:	48 01 d8             	add    %rbx,%rax
+  804a4e:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  804a50:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804a57:	00 00 00 
+  804a5a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a5d:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  804a61:	bf 05 00 00 00       	mov    $0x5,%edi
+  804a66:	48 b8 a1 c6 ff ff ff 	movabs $0xffffffffffffc6a1,%rax
+  804a6d:	ff ff ff 
+  804a70:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a74:	ff d0                	call   *%rax
+}
+  804a76:	48 83 c4 10          	add    $0x10,%rsp
+  804a7a:	5b                   	pop    %rbx
+  804a7b:	41 5f                	pop    %r15
+  804a7d:	5d                   	pop    %rbp
+  804a7e:	c3                   	ret
+
+0000000000804a7f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804a7f:	55                   	push   %rbp
+  804a80:	48 89 e5             	mov    %rsp,%rbp
+  804a83:	48 83 ec 20          	sub    $0x20,%rsp
+  804a87:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a87 <nsipc_listen+0x8>
+  804a8e:	49 bb b1 35 00 00 00 	movabs $0x35b1,%r11
+  804a95:	00 00 00 
+  804a98:	4c 01 d8             	add    %r11,%rax
+  804a9b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804a9e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804aa1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804aa4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  804aa7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804aaa:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804aad:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804ab1:	ba 08 00 00 00       	mov    $0x8,%edx
+  804ab6:	48 89 ce             	mov    %rcx,%rsi
+  804ab9:	bf 06 00 00 00       	mov    $0x6,%edi
+  804abe:	48 b9 44 c7 ff ff ff 	movabs $0xffffffffffffc744,%rcx
+  804ac5:	ff ff ff 
+  804ac8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804acc:	ff d0                	call   *%rax
+}
+  804ace:	c9                   	leave
+  804acf:	c3                   	ret
+
+0000000000804ad0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  804ad0:	55                   	push   %rbp
+  804ad1:	48 89 e5             	mov    %rsp,%rbp
+  804ad4:	41 57                	push   %r15
+  804ad6:	53                   	push   %rbx
+  804ad7:	48 83 ec 30          	sub    $0x30,%rsp
+  804adb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804adb <nsipc_recv+0xb>
+  804ae2:	49 bb 5d 35 00 00 00 	movabs $0x355d,%r11
+  804ae9:	00 00 00 
+  804aec:	4c 01 db             	add    %r11,%rbx
+  804aef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804af2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804af6:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  804af9:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804afc:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804b03:	00 00 00 
+  804b06:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b09:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  804b0c:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804b13:	00 00 00 
+  804b16:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804b19:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804b1d:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804b24:	00 00 00 
+  804b27:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804b2a:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804b2e:	bf 07 00 00 00       	mov    $0x7,%edi
+  804b33:	48 b8 a1 c6 ff ff ff 	movabs $0xffffffffffffc6a1,%rax
+  804b3a:	ff ff ff 
+  804b3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b41:	ff d0                	call   *%rax
+  804b43:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b46:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b4a:	0f 88 91 00 00 00    	js     804be1 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804b50:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804b57:	7f 08                	jg     804b61 <nsipc_recv+0x91>
+  804b59:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b5c:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804b5f:	7e 50                	jle    804bb1 <nsipc_recv+0xe1>
+  804b61:	48 b8 ab e7 ff ff ff 	movabs $0xffffffffffffe7ab,%rax
+  804b68:	ff ff ff 
+  804b6b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b6f:	48 89 c1             	mov    %rax,%rcx
+  804b72:	48 b8 c0 e7 ff ff ff 	movabs $0xffffffffffffe7c0,%rax
+  804b79:	ff ff ff 
+  804b7c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b80:	48 89 c2             	mov    %rax,%rdx
+  804b83:	be 79 00 00 00       	mov    $0x79,%esi
+  804b88:	48 b8 d5 e7 ff ff ff 	movabs $0xffffffffffffe7d5,%rax
+  804b8f:	ff ff ff 
+  804b92:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b96:	48 89 c7             	mov    %rax,%rdi
+  804b99:	49 89 df             	mov    %rbx,%r15
+  804b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba1:	49 b8 43 85 ff ff ff 	movabs $0xffffffffffff8543,%r8
+  804ba8:	ff ff ff 
+  804bab:	49 01 d8             	add    %rbx,%r8
+  804bae:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804bb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bb4:	48 63 d0             	movslq %eax,%rdx
+  804bb7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bbb:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804bc2:	00 00 00 
+  804bc5:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  804bc9:	48 89 ce             	mov    %rcx,%rsi
+  804bcc:	48 89 c7             	mov    %rax,%rdi
+  804bcf:	49 89 df             	mov    %rbx,%r15
+  804bd2:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  804bd9:	ff ff ff 
+  804bdc:	48 01 d8             	add    %rbx,%rax
+  804bdf:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804be1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804be4:	48 83 c4 30          	add    $0x30,%rsp
+  804be8:	5b                   	pop    %rbx
+  804be9:	41 5f                	pop    %r15
+  804beb:	5d                   	pop    %rbp
+  804bec:	c3                   	ret
+
+0000000000804bed <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804bed:	55                   	push   %rbp
+  804bee:	48 89 e5             	mov    %rsp,%rbp
+  804bf1:	41 57                	push   %r15
+  804bf3:	53                   	push   %rbx
+  804bf4:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804bfb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804bfb <nsipc_send+0xe>
+  804c02:	49 bb 3d 34 00 00 00 	movabs $0x343d,%r11
+  804c09:	00 00 00 
+  804c0c:	4c 01 db             	add    %r11,%rbx
+  804c0f:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804c15:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804c1c:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804c22:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804c28:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804c2c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804c30:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804c37:	00 00 00 
+  804c3a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c3d:	85 c0                	test   %eax,%eax
+  804c3f:	75 24                	jne    804c65 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804c41:	bf 02 00 00 00       	mov    $0x2,%edi
+  804c46:	49 89 df             	mov    %rbx,%r15
+  804c49:	48 b8 87 e0 ff ff ff 	movabs $0xffffffffffffe087,%rax
+  804c50:	ff ff ff 
+  804c53:	48 01 d8             	add    %rbx,%rax
+  804c56:	ff d0                	call   *%rax
+  804c58:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  804c5f:	00 00 00 
+  804c62:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804c65:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804c6b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804c6e:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804c75:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804c78:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804c7b:	39 c2                	cmp    %eax,%edx
+  804c7d:	0f 4e c2             	cmovle %edx,%eax
+  804c80:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804c86:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804c8c:	48 63 d0             	movslq %eax,%rdx
+  804c8f:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804c96:	48 89 c6             	mov    %rax,%rsi
+  804c99:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804ca0:	00 00 00 
+  804ca3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ca7:	48 89 c7             	mov    %rax,%rdi
+  804caa:	49 89 df             	mov    %rbx,%r15
+  804cad:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  804cb4:	ff ff ff 
+  804cb7:	48 01 d8             	add    %rbx,%rax
+  804cba:	ff d0                	call   *%rax
+	req->req_s = s;
+  804cbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cc0:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804cc6:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804cc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ccc:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804cd2:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804cd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cd9:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804cdf:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804ce2:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804ce9:	00 00 00 
+  804cec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cf0:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804cf4:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804cfb:	00 
+  804cfc:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804d02:	48 63 d0             	movslq %eax,%rdx
+  804d05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d09:	48 01 d0             	add    %rdx,%rax
+  804d0c:	48 83 e8 01          	sub    $0x1,%rax
+  804d10:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804d14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d18:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d1d:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804d21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d25:	48 29 d0             	sub    %rdx,%rax
+  804d28:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804d2e:	85 c0                	test   %eax,%eax
+  804d30:	0f 48 c2             	cmovs  %edx,%eax
+  804d33:	c1 f8 0c             	sar    $0xc,%eax
+  804d36:	48 98                	cltq
+  804d38:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804d3c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804d40:	48 85 c0             	test   %rax,%rax
+  804d43:	0f 95 c0             	setne  %al
+  804d46:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804d49:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804d50:	00 
+  804d51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d55:	48 83 c0 0b          	add    $0xb,%rax
+  804d59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d5d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d61:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d66:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804d6a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d6e:	48 29 d0             	sub    %rdx,%rax
+  804d71:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804d75:	89 c7                	mov    %eax,%edi
+  804d77:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804d7e:	00 00 00 
+  804d81:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804d84:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804d88:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804d8c:	48 83 ec 08          	sub    $0x8,%rsp
+  804d90:	6a 00                	push   $0x0
+  804d92:	6a 00                	push   $0x0
+  804d94:	6a 05                	push   $0x5
+  804d96:	41 89 f1             	mov    %esi,%r9d
+  804d99:	49 89 c8             	mov    %rcx,%r8
+  804d9c:	89 f9                	mov    %edi,%ecx
+  804d9e:	be 08 00 00 00       	mov    $0x8,%esi
+  804da3:	89 c7                	mov    %eax,%edi
+  804da5:	49 89 df             	mov    %rbx,%r15
+  804da8:	48 b8 8f dc ff ff ff 	movabs $0xffffffffffffdc8f,%rax
+  804daf:	ff ff ff 
+  804db2:	48 01 d8             	add    %rbx,%rax
+  804db5:	ff d0                	call   *%rax
+  804db7:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804dbb:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804dbf:	5b                   	pop    %rbx
+  804dc0:	41 5f                	pop    %r15
+  804dc2:	5d                   	pop    %rbp
+  804dc3:	c3                   	ret
+
+0000000000804dc4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804dc4:	55                   	push   %rbp
+  804dc5:	48 89 e5             	mov    %rsp,%rbp
+  804dc8:	48 83 ec 10          	sub    $0x10,%rsp
+  804dcc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804dcc <nsipc_socket+0x8>
+  804dd3:	49 bb 6c 32 00 00 00 	movabs $0x326c,%r11
+  804dda:	00 00 00 
+  804ddd:	4c 01 d8             	add    %r11,%rax
+  804de0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804de3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804de6:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804de9:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804df0:	00 00 00 
+  804df3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804df6:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804df9:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804e00:	00 00 00 
+  804e03:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804e06:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804e0a:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804e11:	00 00 00 
+  804e14:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804e17:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804e1b:	bf 09 00 00 00       	mov    $0x9,%edi
+  804e20:	48 ba a1 c6 ff ff ff 	movabs $0xffffffffffffc6a1,%rdx
+  804e27:	ff ff ff 
+  804e2a:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804e2e:	ff d0                	call   *%rax
+}
+  804e30:	c9                   	leave
+  804e31:	c3                   	ret
+
+0000000000804e32 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804e32:	55                   	push   %rbp
+  804e33:	48 89 e5             	mov    %rsp,%rbp
+  804e36:	41 57                	push   %r15
+  804e38:	53                   	push   %rbx
+  804e39:	48 83 ec 30          	sub    $0x30,%rsp
+  804e3d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e3d <pipe+0xb>
+  804e44:	49 bb fb 31 00 00 00 	movabs $0x31fb,%r11
+  804e4b:	00 00 00 
+  804e4e:	4c 01 db             	add    %r11,%rbx
+  804e51:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804e55:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804e59:	48 89 c7             	mov    %rax,%rdi
+  804e5c:	49 89 df             	mov    %rbx,%r15
+  804e5f:	48 b8 bb aa ff ff ff 	movabs $0xffffffffffffaabb,%rax
+  804e66:	ff ff ff 
+  804e69:	48 01 d8             	add    %rbx,%rax
+  804e6c:	ff d0                	call   *%rax
+  804e6e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e71:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e75:	0f 88 12 02 00 00    	js     80508d <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804e7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e7f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804e84:	48 89 c6             	mov    %rax,%rsi
+  804e87:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e8c:	49 89 df             	mov    %rbx,%r15
+  804e8f:	48 b8 98 a2 ff ff ff 	movabs $0xffffffffffffa298,%rax
+  804e96:	ff ff ff 
+  804e99:	48 01 d8             	add    %rbx,%rax
+  804e9c:	ff d0                	call   *%rax
+  804e9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ea1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ea5:	0f 88 e2 01 00 00    	js     80508d <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804eab:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804eaf:	48 89 c7             	mov    %rax,%rdi
+  804eb2:	49 89 df             	mov    %rbx,%r15
+  804eb5:	48 b8 bb aa ff ff ff 	movabs $0xffffffffffffaabb,%rax
+  804ebc:	ff ff ff 
+  804ebf:	48 01 d8             	add    %rbx,%rax
+  804ec2:	ff d0                	call   *%rax
+  804ec4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ec7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ecb:	0f 88 9b 01 00 00    	js     80506c <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804ed1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ed5:	ba 07 04 00 00       	mov    $0x407,%edx
+  804eda:	48 89 c6             	mov    %rax,%rsi
+  804edd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ee2:	49 89 df             	mov    %rbx,%r15
+  804ee5:	48 b8 98 a2 ff ff ff 	movabs $0xffffffffffffa298,%rax
+  804eec:	ff ff ff 
+  804eef:	48 01 d8             	add    %rbx,%rax
+  804ef2:	ff d0                	call   *%rax
+  804ef4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ef7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804efb:	0f 88 6b 01 00 00    	js     80506c <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804f01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f05:	48 89 c7             	mov    %rax,%rdi
+  804f08:	49 89 df             	mov    %rbx,%r15
+  804f0b:	48 b8 78 aa ff ff ff 	movabs $0xffffffffffffaa78,%rax
+  804f12:	ff ff ff 
+  804f15:	48 01 d8             	add    %rbx,%rax
+  804f18:	ff d0                	call   *%rax
+  804f1a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804f1e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f22:	ba 07 04 00 00       	mov    $0x407,%edx
+  804f27:	48 89 c6             	mov    %rax,%rsi
+  804f2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f2f:	49 89 df             	mov    %rbx,%r15
+  804f32:	48 b8 98 a2 ff ff ff 	movabs $0xffffffffffffa298,%rax
+  804f39:	ff ff ff 
+  804f3c:	48 01 d8             	add    %rbx,%rax
+  804f3f:	ff d0                	call   *%rax
+  804f41:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f44:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f48:	0f 88 fd 00 00 00    	js     80504b <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804f4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f52:	48 89 c7             	mov    %rax,%rdi
+  804f55:	49 89 df             	mov    %rbx,%r15
+  804f58:	48 b8 78 aa ff ff ff 	movabs $0xffffffffffffaa78,%rax
+  804f5f:	ff ff ff 
+  804f62:	48 01 d8             	add    %rbx,%rax
+  804f65:	ff d0                	call   *%rax
+  804f67:	48 89 c2             	mov    %rax,%rdx
+  804f6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f6e:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804f74:	48 89 d1             	mov    %rdx,%rcx
+  804f77:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f7c:	48 89 c6             	mov    %rax,%rsi
+  804f7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f84:	49 89 df             	mov    %rbx,%r15
+  804f87:	48 b8 fd a2 ff ff ff 	movabs $0xffffffffffffa2fd,%rax
+  804f8e:	ff ff ff 
+  804f91:	48 01 d8             	add    %rbx,%rax
+  804f94:	ff d0                	call   *%rax
+  804f96:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f99:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f9d:	0f 88 87 00 00 00    	js     80502a <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804fa3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fa7:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  804fae:	00 00 00 
+  804fb1:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804fb4:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804fb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fba:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804fc1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fc5:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  804fcc:	00 00 00 
+  804fcf:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804fd2:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804fd4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fd8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804fdf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fe3:	48 89 c7             	mov    %rax,%rdi
+  804fe6:	49 89 df             	mov    %rbx,%r15
+  804fe9:	48 b8 41 aa ff ff ff 	movabs $0xffffffffffffaa41,%rax
+  804ff0:	ff ff ff 
+  804ff3:	48 01 d8             	add    %rbx,%rax
+  804ff6:	ff d0                	call   *%rax
+  804ff8:	89 c2                	mov    %eax,%edx
+  804ffa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ffe:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805000:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805004:	48 89 c7             	mov    %rax,%rdi
+  805007:	49 89 df             	mov    %rbx,%r15
+  80500a:	48 b8 41 aa ff ff ff 	movabs $0xffffffffffffaa41,%rax
+  805011:	ff ff ff 
+  805014:	48 01 d8             	add    %rbx,%rax
+  805017:	ff d0                	call   *%rax
+  805019:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80501d:	48 83 c2 04          	add    $0x4,%rdx
+  805021:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805023:	b8 00 00 00 00       	mov    $0x0,%eax
+  805028:	eb 67                	jmp    805091 <pipe+0x25f>
+		goto err3;
+  80502a:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80502b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80502f:	48 89 c6             	mov    %rax,%rsi
+  805032:	bf 00 00 00 00       	mov    $0x0,%edi
+  805037:	49 89 df             	mov    %rbx,%r15
+  80503a:	48 b8 70 a3 ff ff ff 	movabs $0xffffffffffffa370,%rax
+  805041:	ff ff ff 
+  805044:	48 01 d8             	add    %rbx,%rax
+  805047:	ff d0                	call   *%rax
+  805049:	eb 01                	jmp    80504c <pipe+0x21a>
+		goto err2;
+  80504b:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80504c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805050:	48 89 c6             	mov    %rax,%rsi
+  805053:	bf 00 00 00 00       	mov    $0x0,%edi
+  805058:	49 89 df             	mov    %rbx,%r15
+  80505b:	48 b8 70 a3 ff ff ff 	movabs $0xffffffffffffa370,%rax
+  805062:	ff ff ff 
+  805065:	48 01 d8             	add    %rbx,%rax
+  805068:	ff d0                	call   *%rax
+  80506a:	eb 01                	jmp    80506d <pipe+0x23b>
+		goto err1;
+  80506c:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  80506d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805071:	48 89 c6             	mov    %rax,%rsi
+  805074:	bf 00 00 00 00       	mov    $0x0,%edi
+  805079:	49 89 df             	mov    %rbx,%r15
+  80507c:	48 b8 70 a3 ff ff ff 	movabs $0xffffffffffffa370,%rax
+  805083:	ff ff ff 
+  805086:	48 01 d8             	add    %rbx,%rax
+  805089:	ff d0                	call   *%rax
+  80508b:	eb 01                	jmp    80508e <pipe+0x25c>
+		goto err;
+  80508d:	90                   	nop
+err:
+	return r;
+  80508e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805091:	48 83 c4 30          	add    $0x30,%rsp
+  805095:	5b                   	pop    %rbx
+  805096:	41 5f                	pop    %r15
+  805098:	5d                   	pop    %rbp
+  805099:	c3                   	ret
+
+000000000080509a <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80509a:	55                   	push   %rbp
+  80509b:	48 89 e5             	mov    %rsp,%rbp
+  80509e:	41 57                	push   %r15
+  8050a0:	41 54                	push   %r12
+  8050a2:	53                   	push   %rbx
+  8050a3:	48 83 ec 28          	sub    $0x28,%rsp
+  8050a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050a7 <_pipeisclosed+0xd>
+  8050ae:	49 bb 91 2f 00 00 00 	movabs $0x2f91,%r11
+  8050b5:	00 00 00 
+  8050b8:	4c 01 db             	add    %r11,%rbx
+  8050bb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8050bf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8050c3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8050ca:	ff ff ff 
+  8050cd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8050d1:	48 8b 00             	mov    (%rax),%rax
+  8050d4:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8050da:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8050dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050e1:	48 89 c7             	mov    %rax,%rdi
+  8050e4:	49 89 df             	mov    %rbx,%r15
+  8050e7:	48 b8 16 e1 ff ff ff 	movabs $0xffffffffffffe116,%rax
+  8050ee:	ff ff ff 
+  8050f1:	48 01 d8             	add    %rbx,%rax
+  8050f4:	ff d0                	call   *%rax
+  8050f6:	41 89 c4             	mov    %eax,%r12d
+  8050f9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8050fd:	48 89 c7             	mov    %rax,%rdi
+  805100:	49 89 df             	mov    %rbx,%r15
+  805103:	48 b8 16 e1 ff ff ff 	movabs $0xffffffffffffe116,%rax
+  80510a:	ff ff ff 
+  80510d:	48 01 d8             	add    %rbx,%rax
+  805110:	ff d0                	call   *%rax
+  805112:	41 39 c4             	cmp    %eax,%r12d
+  805115:	0f 94 c0             	sete   %al
+  805118:	0f b6 c0             	movzbl %al,%eax
+  80511b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  80511e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805125:	ff ff ff 
+  805128:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80512c:	48 8b 00             	mov    (%rax),%rax
+  80512f:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805135:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805138:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80513b:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80513e:	75 05                	jne    805145 <_pipeisclosed+0xab>
+			return ret;
+  805140:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805143:	eb 63                	jmp    8051a8 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805145:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805148:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80514b:	0f 84 72 ff ff ff    	je     8050c3 <_pipeisclosed+0x29>
+  805151:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805155:	0f 85 68 ff ff ff    	jne    8050c3 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80515b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805162:	ff ff ff 
+  805165:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805169:	48 8b 00             	mov    (%rax),%rax
+  80516c:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805172:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805175:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805178:	89 c6                	mov    %eax,%esi
+  80517a:	48 b8 e6 e7 ff ff ff 	movabs $0xffffffffffffe7e6,%rax
+  805181:	ff ff ff 
+  805184:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805188:	48 89 c7             	mov    %rax,%rdi
+  80518b:	49 89 df             	mov    %rbx,%r15
+  80518e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805193:	49 b8 1a 88 ff ff ff 	movabs $0xffffffffffff881a,%r8
+  80519a:	ff ff ff 
+  80519d:	49 01 d8             	add    %rbx,%r8
+  8051a0:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8051a3:	e9 1b ff ff ff       	jmp    8050c3 <_pipeisclosed+0x29>
+	}
+}
+  8051a8:	48 83 c4 28          	add    $0x28,%rsp
+  8051ac:	5b                   	pop    %rbx
+  8051ad:	41 5c                	pop    %r12
+  8051af:	41 5f                	pop    %r15
+  8051b1:	5d                   	pop    %rbp
+  8051b2:	c3                   	ret
+
+00000000008051b3 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8051b3:	55                   	push   %rbp
+  8051b4:	48 89 e5             	mov    %rsp,%rbp
+  8051b7:	41 57                	push   %r15
+  8051b9:	53                   	push   %rbx
+  8051ba:	48 83 ec 30          	sub    $0x30,%rsp
+  8051be:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051be <pipeisclosed+0xb>
+  8051c5:	49 bb 7a 2e 00 00 00 	movabs $0x2e7a,%r11
+  8051cc:	00 00 00 
+  8051cf:	4c 01 db             	add    %r11,%rbx
+  8051d2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8051d5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8051d9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8051dc:	48 89 d6             	mov    %rdx,%rsi
+  8051df:	89 c7                	mov    %eax,%edi
+  8051e1:	49 89 df             	mov    %rbx,%r15
+  8051e4:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  8051eb:	ff ff ff 
+  8051ee:	48 01 d8             	add    %rbx,%rax
+  8051f1:	ff d0                	call   *%rax
+  8051f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051fa:	79 05                	jns    805201 <pipeisclosed+0x4e>
+		return r;
+  8051fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051ff:	eb 3b                	jmp    80523c <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805201:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805205:	48 89 c7             	mov    %rax,%rdi
+  805208:	49 89 df             	mov    %rbx,%r15
+  80520b:	48 b8 78 aa ff ff ff 	movabs $0xffffffffffffaa78,%rax
+  805212:	ff ff ff 
+  805215:	48 01 d8             	add    %rbx,%rax
+  805218:	ff d0                	call   *%rax
+  80521a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80521e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805222:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805226:	48 89 d6             	mov    %rdx,%rsi
+  805229:	48 89 c7             	mov    %rax,%rdi
+  80522c:	48 b8 62 d0 ff ff ff 	movabs $0xffffffffffffd062,%rax
+  805233:	ff ff ff 
+  805236:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80523a:	ff d0                	call   *%rax
+}
+  80523c:	48 83 c4 30          	add    $0x30,%rsp
+  805240:	5b                   	pop    %rbx
+  805241:	41 5f                	pop    %r15
+  805243:	5d                   	pop    %rbp
+  805244:	c3                   	ret
+
+0000000000805245 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805245:	55                   	push   %rbp
+  805246:	48 89 e5             	mov    %rsp,%rbp
+  805249:	41 57                	push   %r15
+  80524b:	53                   	push   %rbx
+  80524c:	48 83 ec 40          	sub    $0x40,%rsp
+  805250:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805250 <devpipe_read+0xb>
+  805257:	49 bb e8 2d 00 00 00 	movabs $0x2de8,%r11
+  80525e:	00 00 00 
+  805261:	4c 01 db             	add    %r11,%rbx
+  805264:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805268:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80526c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805270:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805274:	48 89 c7             	mov    %rax,%rdi
+  805277:	49 89 df             	mov    %rbx,%r15
+  80527a:	48 b8 78 aa ff ff ff 	movabs $0xffffffffffffaa78,%rax
+  805281:	ff ff ff 
+  805284:	48 01 d8             	add    %rbx,%rax
+  805287:	ff d0                	call   *%rax
+  805289:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80528d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805291:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805295:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80529c:	00 
+  80529d:	e9 a1 00 00 00       	jmp    805343 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8052a2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8052a7:	74 09                	je     8052b2 <devpipe_read+0x6d>
+				return i;
+  8052a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052ad:	e9 9f 00 00 00       	jmp    805351 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8052b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8052b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052ba:	48 89 d6             	mov    %rdx,%rsi
+  8052bd:	48 89 c7             	mov    %rax,%rdi
+  8052c0:	48 b8 62 d0 ff ff ff 	movabs $0xffffffffffffd062,%rax
+  8052c7:	ff ff ff 
+  8052ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052ce:	ff d0                	call   *%rax
+  8052d0:	85 c0                	test   %eax,%eax
+  8052d2:	74 07                	je     8052db <devpipe_read+0x96>
+				return 0;
+  8052d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052d9:	eb 76                	jmp    805351 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8052db:	49 89 df             	mov    %rbx,%r15
+  8052de:	48 b8 43 a2 ff ff ff 	movabs $0xffffffffffffa243,%rax
+  8052e5:	ff ff ff 
+  8052e8:	48 01 d8             	add    %rbx,%rax
+  8052eb:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8052ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052f1:	8b 10                	mov    (%rax),%edx
+  8052f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052f7:	8b 40 04             	mov    0x4(%rax),%eax
+  8052fa:	39 c2                	cmp    %eax,%edx
+  8052fc:	74 a4                	je     8052a2 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8052fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805302:	8b 10                	mov    (%rax),%edx
+  805304:	89 d0                	mov    %edx,%eax
+  805306:	c1 f8 1f             	sar    $0x1f,%eax
+  805309:	c1 e8 1b             	shr    $0x1b,%eax
+  80530c:	01 c2                	add    %eax,%edx
+  80530e:	83 e2 1f             	and    $0x1f,%edx
+  805311:	29 c2                	sub    %eax,%edx
+  805313:	89 d6                	mov    %edx,%esi
+  805315:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805319:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80531d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805321:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805325:	48 63 c6             	movslq %esi,%rax
+  805328:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  80532d:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  80532f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805333:	8b 00                	mov    (%rax),%eax
+  805335:	8d 50 01             	lea    0x1(%rax),%edx
+  805338:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80533c:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80533e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805343:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805347:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80534b:	72 a0                	jb     8052ed <devpipe_read+0xa8>
+	}
+	return i;
+  80534d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805351:	48 83 c4 40          	add    $0x40,%rsp
+  805355:	5b                   	pop    %rbx
+  805356:	41 5f                	pop    %r15
+  805358:	5d                   	pop    %rbp
+  805359:	c3                   	ret
+
+000000000080535a <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80535a:	55                   	push   %rbp
+  80535b:	48 89 e5             	mov    %rsp,%rbp
+  80535e:	41 57                	push   %r15
+  805360:	53                   	push   %rbx
+  805361:	48 83 ec 40          	sub    $0x40,%rsp
+  805365:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805365 <devpipe_write+0xb>
+  80536c:	49 bb d3 2c 00 00 00 	movabs $0x2cd3,%r11
+  805373:	00 00 00 
+  805376:	4c 01 db             	add    %r11,%rbx
+  805379:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80537d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805381:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805385:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805389:	48 89 c7             	mov    %rax,%rdi
+  80538c:	49 89 df             	mov    %rbx,%r15
+  80538f:	48 b8 78 aa ff ff ff 	movabs $0xffffffffffffaa78,%rax
+  805396:	ff ff ff 
+  805399:	48 01 d8             	add    %rbx,%rax
+  80539c:	ff d0                	call   *%rax
+  80539e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8053a2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8053a6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8053aa:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8053b1:	00 
+  8053b2:	e9 a0 00 00 00       	jmp    805457 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8053b7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8053bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053bf:	48 89 d6             	mov    %rdx,%rsi
+  8053c2:	48 89 c7             	mov    %rax,%rdi
+  8053c5:	48 b8 62 d0 ff ff ff 	movabs $0xffffffffffffd062,%rax
+  8053cc:	ff ff ff 
+  8053cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053d3:	ff d0                	call   *%rax
+  8053d5:	85 c0                	test   %eax,%eax
+  8053d7:	74 0a                	je     8053e3 <devpipe_write+0x89>
+				return 0;
+  8053d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053de:	e9 82 00 00 00       	jmp    805465 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8053e3:	49 89 df             	mov    %rbx,%r15
+  8053e6:	48 b8 43 a2 ff ff ff 	movabs $0xffffffffffffa243,%rax
+  8053ed:	ff ff ff 
+  8053f0:	48 01 d8             	add    %rbx,%rax
+  8053f3:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8053f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053f9:	8b 40 04             	mov    0x4(%rax),%eax
+  8053fc:	48 63 d0             	movslq %eax,%rdx
+  8053ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805403:	8b 00                	mov    (%rax),%eax
+  805405:	48 98                	cltq
+  805407:	48 83 c0 20          	add    $0x20,%rax
+  80540b:	48 39 c2             	cmp    %rax,%rdx
+  80540e:	73 a7                	jae    8053b7 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805410:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805414:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805418:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80541c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805420:	8b 50 04             	mov    0x4(%rax),%edx
+  805423:	89 d0                	mov    %edx,%eax
+  805425:	c1 f8 1f             	sar    $0x1f,%eax
+  805428:	c1 e8 1b             	shr    $0x1b,%eax
+  80542b:	01 c2                	add    %eax,%edx
+  80542d:	83 e2 1f             	and    $0x1f,%edx
+  805430:	29 c2                	sub    %eax,%edx
+  805432:	89 d0                	mov    %edx,%eax
+  805434:	0f b6 09             	movzbl (%rcx),%ecx
+  805437:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80543b:	48 98                	cltq
+  80543d:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805441:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805445:	8b 40 04             	mov    0x4(%rax),%eax
+  805448:	8d 50 01             	lea    0x1(%rax),%edx
+  80544b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80544f:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805452:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805457:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80545b:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80545f:	72 94                	jb     8053f5 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805461:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805465:	48 83 c4 40          	add    $0x40,%rsp
+  805469:	5b                   	pop    %rbx
+  80546a:	41 5f                	pop    %r15
+  80546c:	5d                   	pop    %rbp
+  80546d:	c3                   	ret
+
+000000000080546e <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80546e:	55                   	push   %rbp
+  80546f:	48 89 e5             	mov    %rsp,%rbp
+  805472:	41 57                	push   %r15
+  805474:	53                   	push   %rbx
+  805475:	48 83 ec 20          	sub    $0x20,%rsp
+  805479:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805479 <devpipe_stat+0xb>
+  805480:	49 bb bf 2b 00 00 00 	movabs $0x2bbf,%r11
+  805487:	00 00 00 
+  80548a:	4c 01 db             	add    %r11,%rbx
+  80548d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805491:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805495:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805499:	48 89 c7             	mov    %rax,%rdi
+  80549c:	49 89 df             	mov    %rbx,%r15
+  80549f:	48 b8 78 aa ff ff ff 	movabs $0xffffffffffffaa78,%rax
+  8054a6:	ff ff ff 
+  8054a9:	48 01 d8             	add    %rbx,%rax
+  8054ac:	ff d0                	call   *%rax
+  8054ae:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8054b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054b6:	48 ba f9 e7 ff ff ff 	movabs $0xffffffffffffe7f9,%rdx
+  8054bd:	ff ff ff 
+  8054c0:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8054c4:	48 89 d6             	mov    %rdx,%rsi
+  8054c7:	48 89 c7             	mov    %rax,%rdi
+  8054ca:	49 89 df             	mov    %rbx,%r15
+  8054cd:	48 b8 dc 95 ff ff ff 	movabs $0xffffffffffff95dc,%rax
+  8054d4:	ff ff ff 
+  8054d7:	48 01 d8             	add    %rbx,%rax
+  8054da:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8054dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054e0:	8b 50 04             	mov    0x4(%rax),%edx
+  8054e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054e7:	8b 00                	mov    (%rax),%eax
+  8054e9:	29 c2                	sub    %eax,%edx
+  8054eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054ef:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8054f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054f9:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805500:	00 00 00 
+	stat->st_dev = &devpipe;
+  805503:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805507:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  80550e:	00 00 00 
+  805511:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805515:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80551c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805521:	48 83 c4 20          	add    $0x20,%rsp
+  805525:	5b                   	pop    %rbx
+  805526:	41 5f                	pop    %r15
+  805528:	5d                   	pop    %rbp
+  805529:	c3                   	ret
+
+000000000080552a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80552a:	55                   	push   %rbp
+  80552b:	48 89 e5             	mov    %rsp,%rbp
+  80552e:	41 57                	push   %r15
+  805530:	53                   	push   %rbx
+  805531:	48 83 ec 10          	sub    $0x10,%rsp
+  805535:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805535 <devpipe_close+0xb>
+  80553c:	49 bb 03 2b 00 00 00 	movabs $0x2b03,%r11
+  805543:	00 00 00 
+  805546:	4c 01 db             	add    %r11,%rbx
+  805549:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80554d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805551:	48 89 c6             	mov    %rax,%rsi
+  805554:	bf 00 00 00 00       	mov    $0x0,%edi
+  805559:	49 89 df             	mov    %rbx,%r15
+  80555c:	48 b8 70 a3 ff ff ff 	movabs $0xffffffffffffa370,%rax
+  805563:	ff ff ff 
+  805566:	48 01 d8             	add    %rbx,%rax
+  805569:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80556b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80556f:	48 89 c7             	mov    %rax,%rdi
+  805572:	49 89 df             	mov    %rbx,%r15
+  805575:	48 b8 78 aa ff ff ff 	movabs $0xffffffffffffaa78,%rax
+  80557c:	ff ff ff 
+  80557f:	48 01 d8             	add    %rbx,%rax
+  805582:	ff d0                	call   *%rax
+  805584:	48 89 c6             	mov    %rax,%rsi
+  805587:	bf 00 00 00 00       	mov    $0x0,%edi
+  80558c:	49 89 df             	mov    %rbx,%r15
+  80558f:	48 b8 70 a3 ff ff ff 	movabs $0xffffffffffffa370,%rax
+  805596:	ff ff ff 
+  805599:	48 01 d8             	add    %rbx,%rax
+  80559c:	ff d0                	call   *%rax
+}
+  80559e:	48 83 c4 10          	add    $0x10,%rsp
+  8055a2:	5b                   	pop    %rbx
+  8055a3:	41 5f                	pop    %r15
+  8055a5:	5d                   	pop    %rbp
+  8055a6:	c3                   	ret
+
+00000000008055a7 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8055a7:	55                   	push   %rbp
+  8055a8:	48 89 e5             	mov    %rsp,%rbp
+  8055ab:	41 57                	push   %r15
+  8055ad:	48 83 ec 28          	sub    $0x28,%rsp
+  8055b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055b1 <cputchar+0xa>
+  8055b8:	49 bb 87 2a 00 00 00 	movabs $0x2a87,%r11
+  8055bf:	00 00 00 
+  8055c2:	4c 01 d8             	add    %r11,%rax
+  8055c5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8055c8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8055cb:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8055ce:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8055d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8055d7:	48 89 d7             	mov    %rdx,%rdi
+  8055da:	49 89 c7             	mov    %rax,%r15
+  8055dd:	48 ba e0 a0 ff ff ff 	movabs $0xffffffffffffa0e0,%rdx
+  8055e4:	ff ff ff 
+  8055e7:	48 01 c2             	add    %rax,%rdx
+  8055ea:	ff d2                	call   *%rdx
+}
+  8055ec:	90                   	nop
+  8055ed:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8055f1:	c9                   	leave
+  8055f2:	c3                   	ret
+
+00000000008055f3 <getchar>:
+
+int
+getchar(void)
+{
+  8055f3:	55                   	push   %rbp
+  8055f4:	48 89 e5             	mov    %rsp,%rbp
+  8055f7:	41 57                	push   %r15
+  8055f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8055fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055fd <getchar+0xa>
+  805604:	49 bb 3b 2a 00 00 00 	movabs $0x2a3b,%r11
+  80560b:	00 00 00 
+  80560e:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805611:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805615:	ba 01 00 00 00       	mov    $0x1,%edx
+  80561a:	48 89 ce             	mov    %rcx,%rsi
+  80561d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805622:	49 89 c7             	mov    %rax,%r15
+  805625:	48 b9 b8 b0 ff ff ff 	movabs $0xffffffffffffb0b8,%rcx
+  80562c:	ff ff ff 
+  80562f:	48 01 c1             	add    %rax,%rcx
+  805632:	ff d1                	call   *%rcx
+  805634:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  805637:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80563b:	79 05                	jns    805642 <getchar+0x4f>
+		return r;
+  80563d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805640:	eb 14                	jmp    805656 <getchar+0x63>
+	if (r < 1)
+  805642:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805646:	7f 07                	jg     80564f <getchar+0x5c>
+		return -E_EOF;
+  805648:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80564d:	eb 07                	jmp    805656 <getchar+0x63>
+	return c;
+  80564f:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805653:	0f b6 c0             	movzbl %al,%eax
+}
+  805656:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80565a:	c9                   	leave
+  80565b:	c3                   	ret
+
+000000000080565c <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80565c:	55                   	push   %rbp
+  80565d:	48 89 e5             	mov    %rsp,%rbp
+  805660:	41 57                	push   %r15
+  805662:	53                   	push   %rbx
+  805663:	48 83 ec 20          	sub    $0x20,%rsp
+  805667:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805667 <iscons+0xb>
+  80566e:	49 bb d1 29 00 00 00 	movabs $0x29d1,%r11
+  805675:	00 00 00 
+  805678:	4c 01 db             	add    %r11,%rbx
+  80567b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80567e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805682:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805685:	48 89 d6             	mov    %rdx,%rsi
+  805688:	89 c7                	mov    %eax,%edi
+  80568a:	49 89 df             	mov    %rbx,%r15
+  80568d:	48 b8 71 ab ff ff ff 	movabs $0xffffffffffffab71,%rax
+  805694:	ff ff ff 
+  805697:	48 01 d8             	add    %rbx,%rax
+  80569a:	ff d0                	call   *%rax
+  80569c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80569f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056a3:	79 05                	jns    8056aa <iscons+0x4e>
+		return r;
+  8056a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056a8:	eb 1b                	jmp    8056c5 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8056aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056ae:	8b 10                	mov    (%rax),%edx
+  8056b0:	48 b8 08 01 00 00 00 	movabs $0x108,%rax
+  8056b7:	00 00 00 
+  8056ba:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056bd:	39 c2                	cmp    %eax,%edx
+  8056bf:	0f 94 c0             	sete   %al
+  8056c2:	0f b6 c0             	movzbl %al,%eax
+}
+  8056c5:	48 83 c4 20          	add    $0x20,%rsp
+  8056c9:	5b                   	pop    %rbx
+  8056ca:	41 5f                	pop    %r15
+  8056cc:	5d                   	pop    %rbp
+  8056cd:	c3                   	ret
+
+00000000008056ce <opencons>:
+
+int
+opencons(void)
+{
+  8056ce:	55                   	push   %rbp
+  8056cf:	48 89 e5             	mov    %rsp,%rbp
+  8056d2:	41 57                	push   %r15
+  8056d4:	53                   	push   %rbx
+  8056d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8056d9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056d9 <opencons+0xb>
+  8056e0:	49 bb 5f 29 00 00 00 	movabs $0x295f,%r11
+  8056e7:	00 00 00 
+  8056ea:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8056ed:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8056f1:	48 89 c7             	mov    %rax,%rdi
+  8056f4:	49 89 df             	mov    %rbx,%r15
+  8056f7:	48 b8 bb aa ff ff ff 	movabs $0xffffffffffffaabb,%rax
+  8056fe:	ff ff ff 
+  805701:	48 01 d8             	add    %rbx,%rax
+  805704:	ff d0                	call   *%rax
+  805706:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805709:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80570d:	79 05                	jns    805714 <opencons+0x46>
+		return r;
+  80570f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805712:	eb 68                	jmp    80577c <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805714:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805718:	ba 07 04 00 00       	mov    $0x407,%edx
+  80571d:	48 89 c6             	mov    %rax,%rsi
+  805720:	bf 00 00 00 00       	mov    $0x0,%edi
+  805725:	49 89 df             	mov    %rbx,%r15
+  805728:	48 b8 98 a2 ff ff ff 	movabs $0xffffffffffffa298,%rax
+  80572f:	ff ff ff 
+  805732:	48 01 d8             	add    %rbx,%rax
+  805735:	ff d0                	call   *%rax
+  805737:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80573a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80573e:	79 05                	jns    805745 <opencons+0x77>
+		return r;
+  805740:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805743:	eb 37                	jmp    80577c <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805745:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805749:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  805750:	00 00 00 
+  805753:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805756:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  805758:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80575c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805763:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805767:	48 89 c7             	mov    %rax,%rdi
+  80576a:	49 89 df             	mov    %rbx,%r15
+  80576d:	48 b8 41 aa ff ff ff 	movabs $0xffffffffffffaa41,%rax
+  805774:	ff ff ff 
+  805777:	48 01 d8             	add    %rbx,%rax
+  80577a:	ff d0                	call   *%rax
+}
+  80577c:	48 83 c4 10          	add    $0x10,%rsp
+  805780:	5b                   	pop    %rbx
+  805781:	41 5f                	pop    %r15
+  805783:	5d                   	pop    %rbp
+  805784:	c3                   	ret
+
+0000000000805785 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805785:	55                   	push   %rbp
+  805786:	48 89 e5             	mov    %rsp,%rbp
+  805789:	41 57                	push   %r15
+  80578b:	53                   	push   %rbx
+  80578c:	48 83 ec 30          	sub    $0x30,%rsp
+  805790:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805790 <devcons_read+0xb>
+  805797:	49 bb a8 28 00 00 00 	movabs $0x28a8,%r11
+  80579e:	00 00 00 
+  8057a1:	4c 01 db             	add    %r11,%rbx
+  8057a4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8057a8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8057ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8057b0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8057b5:	75 19                	jne    8057d0 <devcons_read+0x4b>
+		return 0;
+  8057b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057bc:	eb 55                	jmp    805813 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8057be:	49 89 df             	mov    %rbx,%r15
+  8057c1:	48 b8 43 a2 ff ff ff 	movabs $0xffffffffffffa243,%rax
+  8057c8:	ff ff ff 
+  8057cb:	48 01 d8             	add    %rbx,%rax
+  8057ce:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8057d0:	49 89 df             	mov    %rbx,%r15
+  8057d3:	48 b8 3f a1 ff ff ff 	movabs $0xffffffffffffa13f,%rax
+  8057da:	ff ff ff 
+  8057dd:	48 01 d8             	add    %rbx,%rax
+  8057e0:	ff d0                	call   *%rax
+  8057e2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057e9:	74 d3                	je     8057be <devcons_read+0x39>
+	if (c < 0)
+  8057eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057ef:	79 05                	jns    8057f6 <devcons_read+0x71>
+		return c;
+  8057f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057f4:	eb 1d                	jmp    805813 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8057f6:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8057fa:	75 07                	jne    805803 <devcons_read+0x7e>
+		return 0;
+  8057fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  805801:	eb 10                	jmp    805813 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805803:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805806:	89 c2                	mov    %eax,%edx
+  805808:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80580c:	88 10                	mov    %dl,(%rax)
+	return 1;
+  80580e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805813:	48 83 c4 30          	add    $0x30,%rsp
+  805817:	5b                   	pop    %rbx
+  805818:	41 5f                	pop    %r15
+  80581a:	5d                   	pop    %rbp
+  80581b:	c3                   	ret
+
+000000000080581c <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80581c:	55                   	push   %rbp
+  80581d:	48 89 e5             	mov    %rsp,%rbp
+  805820:	41 57                	push   %r15
+  805822:	53                   	push   %rbx
+  805823:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80582a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80582a <devcons_write+0xe>
+  805831:	49 bb 0e 28 00 00 00 	movabs $0x280e,%r11
+  805838:	00 00 00 
+  80583b:	4c 01 db             	add    %r11,%rbx
+  80583e:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  805845:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  80584c:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805853:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80585a:	e9 80 00 00 00       	jmp    8058df <devcons_write+0xc3>
+		m = n - tot;
+  80585f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805866:	89 c2                	mov    %eax,%edx
+  805868:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80586b:	29 c2                	sub    %eax,%edx
+  80586d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  805870:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805873:	83 f8 7f             	cmp    $0x7f,%eax
+  805876:	76 07                	jbe    80587f <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  805878:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80587f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805882:	48 63 d0             	movslq %eax,%rdx
+  805885:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805888:	48 63 c8             	movslq %eax,%rcx
+  80588b:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  805892:	48 01 c1             	add    %rax,%rcx
+  805895:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80589c:	48 89 ce             	mov    %rcx,%rsi
+  80589f:	48 89 c7             	mov    %rax,%rdi
+  8058a2:	49 89 df             	mov    %rbx,%r15
+  8058a5:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  8058ac:	ff ff ff 
+  8058af:	48 01 d8             	add    %rbx,%rax
+  8058b2:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8058b4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8058b7:	48 63 d0             	movslq %eax,%rdx
+  8058ba:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8058c1:	48 89 d6             	mov    %rdx,%rsi
+  8058c4:	48 89 c7             	mov    %rax,%rdi
+  8058c7:	49 89 df             	mov    %rbx,%r15
+  8058ca:	48 b8 e0 a0 ff ff ff 	movabs $0xffffffffffffa0e0,%rax
+  8058d1:	ff ff ff 
+  8058d4:	48 01 d8             	add    %rbx,%rax
+  8058d7:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8058d9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8058dc:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8058df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058e2:	48 98                	cltq
+  8058e4:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8058eb:	0f 82 6e ff ff ff    	jb     80585f <devcons_write+0x43>
+	}
+	return tot;
+  8058f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8058f4:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8058fb:	5b                   	pop    %rbx
+  8058fc:	41 5f                	pop    %r15
+  8058fe:	5d                   	pop    %rbp
+  8058ff:	c3                   	ret
+
+0000000000805900 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  805900:	55                   	push   %rbp
+  805901:	48 89 e5             	mov    %rsp,%rbp
+  805904:	48 83 ec 08          	sub    $0x8,%rsp
+  805908:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805908 <devcons_close+0x8>
+  80590f:	49 bb 30 27 00 00 00 	movabs $0x2730,%r11
+  805916:	00 00 00 
+  805919:	4c 01 d8             	add    %r11,%rax
+  80591c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  805920:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805925:	c9                   	leave
+  805926:	c3                   	ret
+
+0000000000805927 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805927:	55                   	push   %rbp
+  805928:	48 89 e5             	mov    %rsp,%rbp
+  80592b:	41 57                	push   %r15
+  80592d:	48 83 ec 18          	sub    $0x18,%rsp
+  805931:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805931 <devcons_stat+0xa>
+  805938:	49 bb 07 27 00 00 00 	movabs $0x2707,%r11
+  80593f:	00 00 00 
+  805942:	4c 01 d8             	add    %r11,%rax
+  805945:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805949:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80594d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805951:	48 b9 05 e8 ff ff ff 	movabs $0xffffffffffffe805,%rcx
+  805958:	ff ff ff 
+  80595b:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80595f:	48 89 ce             	mov    %rcx,%rsi
+  805962:	48 89 d7             	mov    %rdx,%rdi
+  805965:	49 89 c7             	mov    %rax,%r15
+  805968:	48 ba dc 95 ff ff ff 	movabs $0xffffffffffff95dc,%rdx
+  80596f:	ff ff ff 
+  805972:	48 01 c2             	add    %rax,%rdx
+  805975:	ff d2                	call   *%rdx
+	return 0;
+  805977:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80597c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805980:	c9                   	leave
+  805981:	c3                   	ret
+
+0000000000805982 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805982:	55                   	push   %rbp
+  805983:	48 89 e5             	mov    %rsp,%rbp
+  805986:	41 57                	push   %r15
+  805988:	53                   	push   %rbx
+  805989:	48 83 ec 30          	sub    $0x30,%rsp
+  80598d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80598d <ipc_recv+0xb>
+  805994:	49 bb ab 26 00 00 00 	movabs $0x26ab,%r11
+  80599b:	00 00 00 
+  80599e:	4c 01 db             	add    %r11,%rbx
+  8059a1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8059a5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8059a9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8059ad:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8059b2:	75 0e                	jne    8059c2 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8059b4:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8059bb:	00 00 00 
+  8059be:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8059c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059c6:	48 89 c7             	mov    %rax,%rdi
+  8059c9:	49 89 df             	mov    %rbx,%r15
+  8059cc:	48 b8 c1 a5 ff ff ff 	movabs $0xffffffffffffa5c1,%rax
+  8059d3:	ff ff ff 
+  8059d6:	48 01 d8             	add    %rbx,%rax
+  8059d9:	ff d0                	call   *%rax
+  8059db:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8059de:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8059e3:	74 2a                	je     805a0f <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8059e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059e9:	75 19                	jne    805a04 <ipc_recv+0x82>
+  8059eb:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8059f2:	ff ff ff 
+  8059f5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059f9:	48 8b 00             	mov    (%rax),%rax
+  8059fc:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805a02:	eb 05                	jmp    805a09 <ipc_recv+0x87>
+  805a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a09:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805a0d:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  805a0f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805a14:	74 2a                	je     805a40 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805a16:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a1a:	75 19                	jne    805a35 <ipc_recv+0xb3>
+  805a1c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a23:	ff ff ff 
+  805a26:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a2a:	48 8b 00             	mov    (%rax),%rax
+  805a2d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805a33:	eb 05                	jmp    805a3a <ipc_recv+0xb8>
+  805a35:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a3a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805a3e:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805a40:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a44:	74 05                	je     805a4b <ipc_recv+0xc9>
+		return res;
+  805a46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a49:	eb 17                	jmp    805a62 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805a4b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a52:	ff ff ff 
+  805a55:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a59:	48 8b 00             	mov    (%rax),%rax
+  805a5c:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805a62:	48 83 c4 30          	add    $0x30,%rsp
+  805a66:	5b                   	pop    %rbx
+  805a67:	41 5f                	pop    %r15
+  805a69:	5d                   	pop    %rbp
+  805a6a:	c3                   	ret
+
+0000000000805a6b <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805a6b:	55                   	push   %rbp
+  805a6c:	48 89 e5             	mov    %rsp,%rbp
+  805a6f:	41 57                	push   %r15
+  805a71:	53                   	push   %rbx
+  805a72:	48 83 ec 20          	sub    $0x20,%rsp
+  805a76:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a76 <ipc_send+0xb>
+  805a7d:	49 bb c2 25 00 00 00 	movabs $0x25c2,%r11
+  805a84:	00 00 00 
+  805a87:	4c 01 db             	add    %r11,%rbx
+  805a8a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a8d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805a90:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805a94:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805a97:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805a9c:	75 0e                	jne    805aac <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805a9e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805aa5:	00 00 00 
+  805aa8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805aac:	90                   	nop
+  805aad:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805ab0:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805ab3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ab7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805aba:	89 c7                	mov    %eax,%edi
+  805abc:	49 89 df             	mov    %rbx,%r15
+  805abf:	48 b8 57 a5 ff ff ff 	movabs $0xffffffffffffa557,%rax
+  805ac6:	ff ff ff 
+  805ac9:	48 01 d8             	add    %rbx,%rax
+  805acc:	ff d0                	call   *%rax
+  805ace:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805ad1:	74 da                	je     805aad <ipc_send+0x42>
+		;
+}
+  805ad3:	90                   	nop
+  805ad4:	90                   	nop
+  805ad5:	48 83 c4 20          	add    $0x20,%rsp
+  805ad9:	5b                   	pop    %rbx
+  805ada:	41 5f                	pop    %r15
+  805adc:	5d                   	pop    %rbp
+  805add:	c3                   	ret
+
+0000000000805ade <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805ade:	55                   	push   %rbp
+  805adf:	48 89 e5             	mov    %rsp,%rbp
+  805ae2:	41 57                	push   %r15
+  805ae4:	53                   	push   %rbx
+  805ae5:	48 83 ec 40          	sub    $0x40,%rsp
+  805ae9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ae9 <ipc_call+0xb>
+  805af0:	49 bb 4f 25 00 00 00 	movabs $0x254f,%r11
+  805af7:	00 00 00 
+  805afa:	4c 01 db             	add    %r11,%rbx
+  805afd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805b00:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805b03:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805b07:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805b0a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805b0e:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805b12:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805b17:	75 0e                	jne    805b27 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805b19:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b20:	00 00 00 
+  805b23:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805b27:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805b2c:	75 0e                	jne    805b3c <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805b2e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b35:	00 00 00 
+  805b38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805b3c:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805b3f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805b43:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805b46:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b4a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b4d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805b53:	49 89 f8             	mov    %rdi,%r8
+  805b56:	89 c7                	mov    %eax,%edi
+  805b58:	49 89 df             	mov    %rbx,%r15
+  805b5b:	48 b8 1a a6 ff ff ff 	movabs $0xffffffffffffa61a,%rax
+  805b62:	ff ff ff 
+  805b65:	48 01 d8             	add    %rbx,%rax
+  805b68:	ff d0                	call   *%rax
+  805b6a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805b6d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805b72:	74 2a                	je     805b9e <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805b74:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b78:	75 19                	jne    805b93 <ipc_call+0xb5>
+  805b7a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b81:	ff ff ff 
+  805b84:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b88:	48 8b 00             	mov    (%rax),%rax
+  805b8b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805b91:	eb 05                	jmp    805b98 <ipc_call+0xba>
+  805b93:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b98:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805b9c:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805b9e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ba2:	74 05                	je     805ba9 <ipc_call+0xcb>
+		return r;
+  805ba4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ba7:	eb 17                	jmp    805bc0 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805ba9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bb0:	ff ff ff 
+  805bb3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bb7:	48 8b 00             	mov    (%rax),%rax
+  805bba:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805bc0:	48 83 c4 40          	add    $0x40,%rsp
+  805bc4:	5b                   	pop    %rbx
+  805bc5:	41 5f                	pop    %r15
+  805bc7:	5d                   	pop    %rbp
+  805bc8:	c3                   	ret
+
+0000000000805bc9 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805bc9:	55                   	push   %rbp
+  805bca:	48 89 e5             	mov    %rsp,%rbp
+  805bcd:	41 57                	push   %r15
+  805bcf:	53                   	push   %rbx
+  805bd0:	48 83 ec 70          	sub    $0x70,%rsp
+  805bd4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bd4 <ipc_callw+0xb>
+  805bdb:	49 bb 64 24 00 00 00 	movabs $0x2464,%r11
+  805be2:	00 00 00 
+  805be5:	4c 01 db             	add    %r11,%rbx
+  805be8:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805beb:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805bee:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805bf2:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805bf6:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805bfb:	76 0a                	jbe    805c07 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805bfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805c02:	e9 b7 00 00 00       	jmp    805cbe <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805c07:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805c0b:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805c0f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805c13:	48 89 ce             	mov    %rcx,%rsi
+  805c16:	48 89 c7             	mov    %rax,%rdi
+  805c19:	49 89 df             	mov    %rbx,%r15
+  805c1c:	48 b8 bc 99 ff ff ff 	movabs $0xffffffffffff99bc,%rax
+  805c23:	ff ff ff 
+  805c26:	48 01 d8             	add    %rbx,%rax
+  805c29:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805c2b:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805c32:	00 
+  805c33:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805c37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c3b:	48 01 d0             	add    %rdx,%rax
+  805c3e:	48 83 e8 01          	sub    $0x1,%rax
+  805c42:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805c46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c4f:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805c53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c57:	48 29 d0             	sub    %rdx,%rax
+  805c5a:	48 c1 e8 03          	shr    $0x3,%rax
+  805c5e:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805c62:	89 c1                	mov    %eax,%ecx
+  805c64:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805c67:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805c6b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805c6e:	49 89 d1             	mov    %rdx,%r9
+  805c71:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805c78:	00 00 00 
+  805c7b:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805c82:	00 00 00 
+  805c85:	89 c7                	mov    %eax,%edi
+  805c87:	49 89 df             	mov    %rbx,%r15
+  805c8a:	48 b8 1a a6 ff ff ff 	movabs $0xffffffffffffa61a,%rax
+  805c91:	ff ff ff 
+  805c94:	48 01 d8             	add    %rbx,%rax
+  805c97:	ff d0                	call   *%rax
+  805c99:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805c9c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ca0:	74 05                	je     805ca7 <ipc_callw+0xde>
+		return r;
+  805ca2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ca5:	eb 17                	jmp    805cbe <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805ca7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805cae:	ff ff ff 
+  805cb1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805cb5:	48 8b 00             	mov    (%rax),%rax
+  805cb8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805cbe:	48 83 c4 70          	add    $0x70,%rsp
+  805cc2:	5b                   	pop    %rbx
+  805cc3:	41 5f                	pop    %r15
+  805cc5:	5d                   	pop    %rbp
+  805cc6:	c3                   	ret
+
+0000000000805cc7 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805cc7:	55                   	push   %rbp
+  805cc8:	48 89 e5             	mov    %rsp,%rbp
+  805ccb:	41 57                	push   %r15
+  805ccd:	53                   	push   %rbx
+  805cce:	48 83 ec 40          	sub    $0x40,%rsp
+  805cd2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cd2 <ipc_callv+0xb>
+  805cd9:	49 bb 66 23 00 00 00 	movabs $0x2366,%r11
+  805ce0:	00 00 00 
+  805ce3:	4c 01 db             	add    %r11,%rbx
+  805ce6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805ce9:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805cec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805cf0:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805cf3:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805cf7:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805cfb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805d02:	00 00 00 
+  805d05:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805d09:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805d0d:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805d11:	74 11                	je     805d24 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805d13:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805d17:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805d1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805d1e:	c1 e0 14             	shl    $0x14,%eax
+  805d21:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805d24:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805d28:	74 14                	je     805d3e <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805d2a:	8b 45 20             	mov    0x20(%rbp),%eax
+  805d2d:	83 e8 01             	sub    $0x1,%eax
+  805d30:	48 63 d0             	movslq %eax,%rdx
+  805d33:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d37:	48 09 d0             	or     %rdx,%rax
+  805d3a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805d3e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805d41:	c1 e0 10             	shl    $0x10,%eax
+  805d44:	0b 45 10             	or     0x10(%rbp),%eax
+  805d47:	89 c1                	mov    %eax,%ecx
+  805d49:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805d4c:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805d50:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805d54:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805d58:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805d5b:	4d 89 c1             	mov    %r8,%r9
+  805d5e:	49 89 f8             	mov    %rdi,%r8
+  805d61:	89 c7                	mov    %eax,%edi
+  805d63:	49 89 df             	mov    %rbx,%r15
+  805d66:	48 b8 1a a6 ff ff ff 	movabs $0xffffffffffffa61a,%rax
+  805d6d:	ff ff ff 
+  805d70:	48 01 d8             	add    %rbx,%rax
+  805d73:	ff d0                	call   *%rax
+  805d75:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805d78:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805d7c:	74 05                	je     805d83 <ipc_callv+0xbc>
+		return r;
+  805d7e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d81:	eb 17                	jmp    805d9a <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805d83:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d8a:	ff ff ff 
+  805d8d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d91:	48 8b 00             	mov    (%rax),%rax
+  805d94:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805d9a:	48 83 c4 40          	add    $0x40,%rsp
+  805d9e:	5b                   	pop    %rbx
+  805d9f:	41 5f                	pop    %r15
+  805da1:	5d                   	pop    %rbp
+  805da2:	c3                   	ret
+
+0000000000805da3 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805da3:	55                   	push   %rbp
+  805da4:	48 89 e5             	mov    %rsp,%rbp
+  805da7:	41 57                	push   %r15
+  805da9:	53                   	push   %rbx
+  805daa:	48 83 ec 40          	sub    $0x40,%rsp
+  805dae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805dae <ipc_reply_recv+0xb>
+  805db5:	49 bb 8a 22 00 00 00 	movabs $0x228a,%r11
+  805dbc:	00 00 00 
+  805dbf:	4c 01 db             	add    %r11,%rbx
+  805dc2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805dc5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805dc8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805dcc:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805dcf:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805dd3:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805dd7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805ddc:	75 0e                	jne    805dec <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805dde:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805de5:	00 00 00 
+  805de8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805dec:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805df1:	75 0e                	jne    805e01 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805df3:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805dfa:	00 00 00 
+  805dfd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805e01:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805e04:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805e08:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805e0c:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805e0f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805e13:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e16:	4d 89 c1             	mov    %r8,%r9
+  805e19:	49 89 f8             	mov    %rdi,%r8
+  805e1c:	89 c7                	mov    %eax,%edi
+  805e1e:	49 89 df             	mov    %rbx,%r15
+  805e21:	48 b8 8e a6 ff ff ff 	movabs $0xffffffffffffa68e,%rax
+  805e28:	ff ff ff 
+  805e2b:	48 01 d8             	add    %rbx,%rax
+  805e2e:	ff d0                	call   *%rax
+  805e30:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805e33:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805e38:	74 2a                	je     805e64 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805e3a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e3e:	75 19                	jne    805e59 <ipc_reply_recv+0xb6>
+  805e40:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e47:	ff ff ff 
+  805e4a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e4e:	48 8b 00             	mov    (%rax),%rax
+  805e51:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805e57:	eb 05                	jmp    805e5e <ipc_reply_recv+0xbb>
+  805e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805e62:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805e64:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805e69:	74 2a                	je     805e95 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805e6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e6f:	75 19                	jne    805e8a <ipc_reply_recv+0xe7>
+  805e71:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e78:	ff ff ff 
+  805e7b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e7f:	48 8b 00             	mov    (%rax),%rax
+  805e82:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805e88:	eb 05                	jmp    805e8f <ipc_reply_recv+0xec>
+  805e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e8f:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805e93:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805e95:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e99:	74 05                	je     805ea0 <ipc_reply_recv+0xfd>
+		return r;
+  805e9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e9e:	eb 17                	jmp    805eb7 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805ea0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ea7:	ff ff ff 
+  805eaa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805eae:	48 8b 00             	mov    (%rax),%rax
+  805eb1:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805eb7:	48 83 c4 40          	add    $0x40,%rsp
+  805ebb:	5b                   	pop    %rbx
+  805ebc:	41 5f                	pop    %r15
+  805ebe:	5d                   	pop    %rbp
+  805ebf:	c3                   	ret
+
+0000000000805ec0 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805ec0:	55                   	push   %rbp
+  805ec1:	48 89 e5             	mov    %rsp,%rbp
+  805ec4:	41 57                	push   %r15
+  805ec6:	53                   	push   %rbx
+  805ec7:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805ece:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ece <ipc_window_batch+0xe>
+  805ed5:	49 bb 6a 21 00 00 00 	movabs $0x216a,%r11
+  805edc:	00 00 00 
+  805edf:	4c 01 db             	add    %r11,%rbx
+  805ee2:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805ee8:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805eef:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805ef5:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805efb:	e9 15 01 00 00       	jmp    806015 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805f00:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805f06:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805f09:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805f10:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805f13:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f16:	39 c2                	cmp    %eax,%edx
+  805f18:	0f 4e c2             	cmovle %edx,%eax
+  805f1b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805f1e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805f25:	eb 6b                	jmp    805f92 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805f27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f2a:	48 98                	cltq
+  805f2c:	48 c1 e0 05          	shl    $0x5,%rax
+  805f30:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f34:	48 01 e8             	add    %rbp,%rax
+  805f37:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805f3d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805f43:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f46:	c1 e0 0c             	shl    $0xc,%eax
+  805f49:	48 63 d0             	movslq %eax,%rdx
+  805f4c:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805f53:	48 01 c2             	add    %rax,%rdx
+  805f56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f59:	48 98                	cltq
+  805f5b:	48 c1 e0 05          	shl    $0x5,%rax
+  805f5f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f63:	48 01 e8             	add    %rbp,%rax
+  805f66:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805f6c:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805f6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f72:	48 98                	cltq
+  805f74:	48 c1 e0 05          	shl    $0x5,%rax
+  805f78:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f7c:	48 01 e8             	add    %rbp,%rax
+  805f7f:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805f86:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805f8c:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805f8e:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805f92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f95:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805f98:	7c 8d                	jl     805f27 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805f9a:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805fa1:	74 27                	je     805fca <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805fa3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805fa6:	48 63 d0             	movslq %eax,%rdx
+  805fa9:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805fb0:	48 89 d6             	mov    %rdx,%rsi
+  805fb3:	48 89 c7             	mov    %rax,%rdi
+  805fb6:	49 89 df             	mov    %rbx,%r15
+  805fb9:	48 b8 31 a9 ff ff ff 	movabs $0xffffffffffffa931,%rax
+  805fc0:	ff ff ff 
+  805fc3:	48 01 d8             	add    %rbx,%rax
+  805fc6:	ff d0                	call   *%rax
+  805fc8:	eb 25                	jmp    805fef <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805fca:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805fcd:	48 63 d0             	movslq %eax,%rdx
+  805fd0:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805fd7:	48 89 d6             	mov    %rdx,%rsi
+  805fda:	48 89 c7             	mov    %rax,%rdi
+  805fdd:	49 89 df             	mov    %rbx,%r15
+  805fe0:	48 b8 8f a9 ff ff ff 	movabs $0xffffffffffffa98f,%rax
+  805fe7:	ff ff ff 
+  805fea:	48 01 d8             	add    %rbx,%rax
+  805fed:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805fef:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805ff2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ff6:	79 05                	jns    805ffd <ipc_window_batch+0x13d>
+			return r;
+  805ff8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ffb:	eb 2a                	jmp    806027 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805ffd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806000:	c1 e0 0c             	shl    $0xc,%eax
+  806003:	48 98                	cltq
+  806005:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  80600c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80600f:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806015:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  80601c:	0f 8f de fe ff ff    	jg     805f00 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806022:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806027:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  80602e:	5b                   	pop    %rbx
+  80602f:	41 5f                	pop    %r15
+  806031:	5d                   	pop    %rbp
+  806032:	c3                   	ret
+
+0000000000806033 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806033:	55                   	push   %rbp
+  806034:	48 89 e5             	mov    %rsp,%rbp
+  806037:	48 83 ec 10          	sub    $0x10,%rsp
+  80603b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80603b <ipc_map_window+0x8>
+  806042:	49 bb fd 1f 00 00 00 	movabs $0x1ffd,%r11
+  806049:	00 00 00 
+  80604c:	4c 01 d8             	add    %r11,%rax
+  80604f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806053:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806056:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806059:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80605d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806062:	bf 01 00 00 00       	mov    $0x1,%edi
+  806067:	49 b8 88 de ff ff ff 	movabs $0xffffffffffffde88,%r8
+  80606e:	ff ff ff 
+  806071:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806075:	ff d0                	call   *%rax
+}
+  806077:	c9                   	leave
+  806078:	c3                   	ret
+
+0000000000806079 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806079:	55                   	push   %rbp
+  80607a:	48 89 e5             	mov    %rsp,%rbp
+  80607d:	48 83 ec 10          	sub    $0x10,%rsp
+  806081:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806081 <ipc_unmap_window+0x8>
+  806088:	49 bb b7 1f 00 00 00 	movabs $0x1fb7,%r11
+  80608f:	00 00 00 
+  806092:	4c 01 d8             	add    %r11,%rax
+  806095:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806099:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  80609c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80609f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8060a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8060a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060ad:	49 b8 88 de ff ff ff 	movabs $0xffffffffffffde88,%r8
+  8060b4:	ff ff ff 
+  8060b7:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8060bb:	ff d0                	call   *%rax
+}
+  8060bd:	c9                   	leave
+  8060be:	c3                   	ret
+
+00000000008060bf <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8060bf:	55                   	push   %rbp
+  8060c0:	48 89 e5             	mov    %rsp,%rbp
+  8060c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8060c7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060c7 <ipc_find_env+0x8>
+  8060ce:	49 bb 71 1f 00 00 00 	movabs $0x1f71,%r11
+  8060d5:	00 00 00 
+  8060d8:	4c 01 d8             	add    %r11,%rax
+  8060db:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  8060de:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8060e5:	eb 57                	jmp    80613e <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  8060e7:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8060ee:	ff ff ff 
+  8060f1:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8060f5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8060f8:	48 63 d2             	movslq %edx,%rdx
+  8060fb:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806102:	48 01 ca             	add    %rcx,%rdx
+  806105:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  80610c:	8b 12                	mov    (%rdx),%edx
+  80610e:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806111:	75 27                	jne    80613a <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806113:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80611a:	ff ff ff 
+  80611d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806121:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806124:	48 98                	cltq
+  806126:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80612d:	48 01 d0             	add    %rdx,%rax
+  806130:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806136:	8b 00                	mov    (%rax),%eax
+  806138:	eb 12                	jmp    80614c <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  80613a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80613e:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806145:	7e a0                	jle    8060e7 <ipc_find_env+0x28>
+	}
+	return 0;
+  806147:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80614c:	c9                   	leave
+  80614d:	c3                   	ret
+
+000000000080614e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80614e:	55                   	push   %rbp
+  80614f:	48 89 e5             	mov    %rsp,%rbp
+  806152:	48 83 ec 18          	sub    $0x18,%rsp
+  806156:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806156 <pageref+0x8>
+  80615d:	49 bb e2 1e 00 00 00 	movabs $0x1ee2,%r11
+  806164:	00 00 00 
+  806167:	4c 01 d8             	add    %r11,%rax
+  80616a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80616e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806172:	48 89 d1             	mov    %rdx,%rcx
+  806175:	48 c1 e9 15          	shr    $0x15,%rcx
+  806179:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806180:	ff ff ff 
+  806183:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806187:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80618b:	83 e2 01             	and    $0x1,%edx
+  80618e:	48 85 d2             	test   %rdx,%rdx
+  806191:	75 07                	jne    80619a <pageref+0x4c>
+		return 0;
+  806193:	b8 00 00 00 00       	mov    $0x0,%eax
+  806198:	eb 64                	jmp    8061fe <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  80619a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80619e:	48 89 d1             	mov    %rdx,%rcx
+  8061a1:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8061a5:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8061ac:	ff ff ff 
+  8061af:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8061b3:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8061b7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8061bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8061bf:	83 e2 01             	and    $0x1,%edx
+  8061c2:	48 85 d2             	test   %rdx,%rdx
+  8061c5:	75 07                	jne    8061ce <pageref+0x80>
+		return 0;
+  8061c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061cc:	eb 30                	jmp    8061fe <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8061ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8061d2:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8061d6:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  8061dd:	ff ff ff 
+  8061e0:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8061e4:	48 89 d0             	mov    %rdx,%rax
+  8061e7:	48 01 c0             	add    %rax,%rax
+  8061ea:	48 01 d0             	add    %rdx,%rax
+  8061ed:	48 c1 e0 03          	shl    $0x3,%rax
+  8061f1:	48 01 c8             	add    %rcx,%rax
+  8061f4:	48 83 c0 08          	add    $0x8,%rax
+  8061f8:	0f b7 00             	movzwl (%rax),%eax
+  8061fb:	0f b7 c0             	movzwl %ax,%eax
+}
+  8061fe:	c9                   	leave
+  8061ff:	c3                   	ret
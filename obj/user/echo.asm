@@ -0,0 +1,9344 @@
+
+obj/user/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 66 01 00 00       	call   8001a7 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb e2 7f 00 00 00 	movabs $0x7fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i, nflag;
+
+	nflag = 0;
+  800069:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+	if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800070:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  800074:	7e 45                	jle    8000bb <umain+0x78>
+  800076:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80007a:	48 83 c0 08          	add    $0x8,%rax
+  80007e:	48 8b 00             	mov    (%rax),%rax
+  800081:	48 ba 08 df ff ff ff 	movabs $0xffffffffffffdf08,%rdx
+  800088:	ff ff ff 
+  80008b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80008f:	48 89 d6             	mov    %rdx,%rsi
+  800092:	48 89 c7             	mov    %rax,%rdi
+  800095:	49 89 df             	mov    %rbx,%r15
+  800098:	48 b8 ce 84 ff ff ff 	movabs $0xffffffffffff84ce,%rax
+  80009f:	ff ff ff 
+  8000a2:	48 01 d8             	add    %rbx,%rax
+  8000a5:	ff d0                	call   *%rax
+  8000a7:	85 c0                	test   %eax,%eax
+  8000a9:	75 10                	jne    8000bb <umain+0x78>
+		nflag = 1;
+  8000ab:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%rbp)
+		argc--;
+  8000b2:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+		argv++;
+  8000b6:	48 83 45 d0 08       	addq   $0x8,-0x30(%rbp)
+	}
+	for (i = 1; i < argc; i++) {
+  8000bb:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+  8000c2:	e9 97 00 00 00       	jmp    80015e <umain+0x11b>
+		if (i > 1)
+  8000c7:	83 7d ec 01          	cmpl   $0x1,-0x14(%rbp)
+  8000cb:	7e 2d                	jle    8000fa <umain+0xb7>
+			write(1, " ", 1);
+  8000cd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000d2:	48 b8 0b df ff ff ff 	movabs $0xffffffffffffdf0b,%rax
+  8000d9:	ff ff ff 
+  8000dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000e0:	48 89 c6             	mov    %rax,%rsi
+  8000e3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000e8:	49 89 df             	mov    %rbx,%r15
+  8000eb:	48 b8 97 9f ff ff ff 	movabs $0xffffffffffff9f97,%rax
+  8000f2:	ff ff ff 
+  8000f5:	48 01 d8             	add    %rbx,%rax
+  8000f8:	ff d0                	call   *%rax
+		write(1, argv[i], strlen(argv[i]));
+  8000fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000fd:	48 98                	cltq
+  8000ff:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800106:	00 
+  800107:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80010b:	48 01 d0             	add    %rdx,%rax
+  80010e:	48 8b 00             	mov    (%rax),%rax
+  800111:	48 89 c7             	mov    %rax,%rdi
+  800114:	49 89 df             	mov    %rbx,%r15
+  800117:	48 b8 81 82 ff ff ff 	movabs $0xffffffffffff8281,%rax
+  80011e:	ff ff ff 
+  800121:	48 01 d8             	add    %rbx,%rax
+  800124:	ff d0                	call   *%rax
+  800126:	48 63 d0             	movslq %eax,%rdx
+  800129:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80012c:	48 98                	cltq
+  80012e:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  800135:	00 
+  800136:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80013a:	48 01 c8             	add    %rcx,%rax
+  80013d:	48 8b 00             	mov    (%rax),%rax
+  800140:	48 89 c6             	mov    %rax,%rsi
+  800143:	bf 01 00 00 00       	mov    $0x1,%edi
+  800148:	49 89 df             	mov    %rbx,%r15
+  80014b:	48 b8 97 9f ff ff ff 	movabs $0xffffffffffff9f97,%rax
+  800152:	ff ff ff 
+  800155:	48 01 d8             	add    %rbx,%rax
+  800158:	ff d0                	call   *%rax
+	for (i = 1; i < argc; i++) {
+  80015a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80015e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800161:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  800164:	0f 8c 5d ff ff ff    	jl     8000c7 <umain+0x84>
+	}
+	if (!nflag)
+  80016a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80016e:	75 2d                	jne    80019d <umain+0x15a>
+		write(1, "\n", 1);
+  800170:	ba 01 00 00 00       	mov    $0x1,%edx
+  800175:	48 b8 0d df ff ff ff 	movabs $0xffffffffffffdf0d,%rax
+  80017c:	ff ff ff 
+  80017f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800183:	48 89 c6             	mov    %rax,%rsi
+  800186:	bf 01 00 00 00       	mov    $0x1,%edi
+  80018b:	49 89 df             	mov    %rbx,%r15
+  80018e:	48 b8 97 9f ff ff ff 	movabs $0xffffffffffff9f97,%rax
+  800195:	ff ff ff 
+  800198:	48 01 d8             	add    %rbx,%rax
+  80019b:	ff d0                	call   *%rax
+}
+  80019d:	90                   	nop
+  80019e:	48 83 c4 20          	add    $0x20,%rsp
+  8001a2:	5b                   	pop    %rbx
+  8001a3:	41 5f                	pop    %r15
+  8001a5:	5d                   	pop    %rbp
+  8001a6:	c3                   	ret
+
+00000000008001a7 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001a7:	55                   	push   %rbp
+  8001a8:	48 89 e5             	mov    %rsp,%rbp
+  8001ab:	41 57                	push   %r15
+  8001ad:	53                   	push   %rbx
+  8001ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8001b2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8001b2 <libmain+0xb>
+  8001b9:	49 bb 7e 7e 00 00 00 	movabs $0x7e7e,%r11
+  8001c0:	00 00 00 
+  8001c3:	4c 01 db             	add    %r11,%rbx
+  8001c6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8001c9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8001cd:	49 89 df             	mov    %rbx,%r15
+  8001d0:	48 b8 28 8f ff ff ff 	movabs $0xffffffffffff8f28,%rax
+  8001d7:	ff ff ff 
+  8001da:	48 01 d8             	add    %rbx,%rax
+  8001dd:	ff d0                	call   *%rax
+  8001df:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8001e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001ea:	48 98                	cltq
+  8001ec:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8001f3:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8001fa:	ff ff ff 
+  8001fd:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800201:	48 01 c2             	add    %rax,%rdx
+  800204:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  80020b:	00 00 00 
+  80020e:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800212:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800216:	7e 15                	jle    80022d <libmain+0x86>
+		binaryname = argv[0];
+  800218:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80021c:	48 8b 00             	mov    (%rax),%rax
+  80021f:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  800226:	00 00 00 
+  800229:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80022d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800231:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800234:	48 89 d6             	mov    %rdx,%rsi
+  800237:	89 c7                	mov    %eax,%edi
+  800239:	49 89 df             	mov    %rbx,%r15
+  80023c:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  800243:	ff ff ff 
+  800246:	48 01 d8             	add    %rbx,%rax
+  800249:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80024b:	49 89 df             	mov    %rbx,%r15
+  80024e:	48 b8 37 82 ff ff ff 	movabs $0xffffffffffff8237,%rax
+  800255:	ff ff ff 
+  800258:	48 01 d8             	add    %rbx,%rax
+  80025b:	ff d0                	call   *%rax
+}
+  80025d:	90                   	nop
+  80025e:	48 83 c4 20          	add    $0x20,%rsp
+  800262:	5b                   	pop    %rbx
+  800263:	41 5f                	pop    %r15
+  800265:	5d                   	pop    %rbp
+  800266:	c3                   	ret
+
+0000000000800267 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800267:	55                   	push   %rbp
+  800268:	48 89 e5             	mov    %rsp,%rbp
+  80026b:	41 57                	push   %r15
+  80026d:	53                   	push   %rbx
+  80026e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80026e <exit+0x7>
+  800275:	49 bb c2 7d 00 00 00 	movabs $0x7dc2,%r11
+  80027c:	00 00 00 
+  80027f:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800282:	49 89 df             	mov    %rbx,%r15
+  800285:	48 b8 a5 9b ff ff ff 	movabs $0xffffffffffff9ba5,%rax
+  80028c:	ff ff ff 
+  80028f:	48 01 d8             	add    %rbx,%rax
+  800292:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800294:	bf 00 00 00 00       	mov    $0x0,%edi
+  800299:	49 89 df             	mov    %rbx,%r15
+  80029c:	48 b8 cc 8e ff ff ff 	movabs $0xffffffffffff8ecc,%rax
+  8002a3:	ff ff ff 
+  8002a6:	48 01 d8             	add    %rbx,%rax
+  8002a9:	ff d0                	call   *%rax
+}
+  8002ab:	90                   	nop
+  8002ac:	5b                   	pop    %rbx
+  8002ad:	41 5f                	pop    %r15
+  8002af:	5d                   	pop    %rbp
+  8002b0:	c3                   	ret
+
+00000000008002b1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8002b1:	55                   	push   %rbp
+  8002b2:	48 89 e5             	mov    %rsp,%rbp
+  8002b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8002b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8002b9 <strlen+0x8>
+  8002c0:	49 bb 77 7d 00 00 00 	movabs $0x7d77,%r11
+  8002c7:	00 00 00 
+  8002ca:	4c 01 d8             	add    %r11,%rax
+  8002cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8002d1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8002d8:	eb 09                	jmp    8002e3 <strlen+0x32>
+		n++;
+  8002da:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8002de:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8002e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8002e7:	0f b6 00             	movzbl (%rax),%eax
+  8002ea:	84 c0                	test   %al,%al
+  8002ec:	75 ec                	jne    8002da <strlen+0x29>
+	return n;
+  8002ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8002f1:	c9                   	leave
+  8002f2:	c3                   	ret
+
+00000000008002f3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8002f3:	55                   	push   %rbp
+  8002f4:	48 89 e5             	mov    %rsp,%rbp
+  8002f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8002fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8002fb <strnlen+0x8>
+  800302:	49 bb 35 7d 00 00 00 	movabs $0x7d35,%r11
+  800309:	00 00 00 
+  80030c:	4c 01 d8             	add    %r11,%rax
+  80030f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800313:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800317:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80031e:	eb 0e                	jmp    80032e <strnlen+0x3b>
+		n++;
+  800320:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800324:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800329:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80032e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  800333:	74 0b                	je     800340 <strnlen+0x4d>
+  800335:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800339:	0f b6 00             	movzbl (%rax),%eax
+  80033c:	84 c0                	test   %al,%al
+  80033e:	75 e0                	jne    800320 <strnlen+0x2d>
+	return n;
+  800340:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  800343:	c9                   	leave
+  800344:	c3                   	ret
+
+0000000000800345 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800345:	55                   	push   %rbp
+  800346:	48 89 e5             	mov    %rsp,%rbp
+  800349:	48 83 ec 20          	sub    $0x20,%rsp
+  80034d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80034d <strcpy+0x8>
+  800354:	49 bb e3 7c 00 00 00 	movabs $0x7ce3,%r11
+  80035b:	00 00 00 
+  80035e:	4c 01 d8             	add    %r11,%rax
+  800361:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800365:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  800369:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80036d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  800371:	90                   	nop
+  800372:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800376:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80037a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80037e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800382:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800386:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80038a:	0f b6 12             	movzbl (%rdx),%edx
+  80038d:	88 10                	mov    %dl,(%rax)
+  80038f:	0f b6 00             	movzbl (%rax),%eax
+  800392:	84 c0                	test   %al,%al
+  800394:	75 dc                	jne    800372 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  800396:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80039a:	c9                   	leave
+  80039b:	c3                   	ret
+
+000000000080039c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80039c:	55                   	push   %rbp
+  80039d:	48 89 e5             	mov    %rsp,%rbp
+  8003a0:	53                   	push   %rbx
+  8003a1:	48 83 ec 20          	sub    $0x20,%rsp
+  8003a5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8003a5 <strcat+0x9>
+  8003ac:	49 bb 8b 7c 00 00 00 	movabs $0x7c8b,%r11
+  8003b3:	00 00 00 
+  8003b6:	4c 01 db             	add    %r11,%rbx
+  8003b9:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8003bd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8003c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003c5:	48 89 c7             	mov    %rax,%rdi
+  8003c8:	48 b8 81 82 ff ff ff 	movabs $0xffffffffffff8281,%rax
+  8003cf:	ff ff ff 
+  8003d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003d6:	ff d0                	call   *%rax
+  8003d8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8003db:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8003de:	48 63 d0             	movslq %eax,%rdx
+  8003e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003e5:	48 01 c2             	add    %rax,%rdx
+  8003e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003ec:	48 89 c6             	mov    %rax,%rsi
+  8003ef:	48 89 d7             	mov    %rdx,%rdi
+  8003f2:	48 b8 15 83 ff ff ff 	movabs $0xffffffffffff8315,%rax
+  8003f9:	ff ff ff 
+  8003fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800400:	ff d0                	call   *%rax
+	return dst;
+  800402:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  800406:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80040a:	c9                   	leave
+  80040b:	c3                   	ret
+
+000000000080040c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80040c:	55                   	push   %rbp
+  80040d:	48 89 e5             	mov    %rsp,%rbp
+  800410:	48 83 ec 28          	sub    $0x28,%rsp
+  800414:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800414 <strncpy+0x8>
+  80041b:	49 bb 1c 7c 00 00 00 	movabs $0x7c1c,%r11
+  800422:	00 00 00 
+  800425:	4c 01 d8             	add    %r11,%rax
+  800428:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80042c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800430:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  800434:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800438:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80043c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800443:	00 
+  800444:	eb 2a                	jmp    800470 <strncpy+0x64>
+		*dst++ = *src;
+  800446:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80044a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80044e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800452:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800456:	0f b6 12             	movzbl (%rdx),%edx
+  800459:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80045b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80045f:	0f b6 00             	movzbl (%rax),%eax
+  800462:	84 c0                	test   %al,%al
+  800464:	74 05                	je     80046b <strncpy+0x5f>
+			src++;
+  800466:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80046b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800470:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800474:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  800478:	72 cc                	jb     800446 <strncpy+0x3a>
+	}
+	return ret;
+  80047a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80047e:	c9                   	leave
+  80047f:	c3                   	ret
+
+0000000000800480 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800480:	55                   	push   %rbp
+  800481:	48 89 e5             	mov    %rsp,%rbp
+  800484:	48 83 ec 28          	sub    $0x28,%rsp
+  800488:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800488 <strlcpy+0x8>
+  80048f:	49 bb a8 7b 00 00 00 	movabs $0x7ba8,%r11
+  800496:	00 00 00 
+  800499:	4c 01 d8             	add    %r11,%rax
+  80049c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8004a0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8004a4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8004a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8004b0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8004b5:	74 3d                	je     8004f4 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8004b7:	eb 1d                	jmp    8004d6 <strlcpy+0x56>
+			*dst++ = *src++;
+  8004b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004bd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8004c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8004c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004c9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8004cd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004d1:	0f b6 12             	movzbl (%rdx),%edx
+  8004d4:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8004d6:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8004db:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8004e0:	74 0b                	je     8004ed <strlcpy+0x6d>
+  8004e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004e6:	0f b6 00             	movzbl (%rax),%eax
+  8004e9:	84 c0                	test   %al,%al
+  8004eb:	75 cc                	jne    8004b9 <strlcpy+0x39>
+		*dst = '\0';
+  8004ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004f1:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8004f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004f8:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8004fc:	c9                   	leave
+  8004fd:	c3                   	ret
+
+00000000008004fe <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8004fe:	55                   	push   %rbp
+  8004ff:	48 89 e5             	mov    %rsp,%rbp
+  800502:	48 83 ec 10          	sub    $0x10,%rsp
+  800506:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800506 <strcmp+0x8>
+  80050d:	49 bb 2a 7b 00 00 00 	movabs $0x7b2a,%r11
+  800514:	00 00 00 
+  800517:	4c 01 d8             	add    %r11,%rax
+  80051a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80051e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  800522:	eb 0a                	jmp    80052e <strcmp+0x30>
+		p++, q++;
+  800524:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800529:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80052e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800532:	0f b6 00             	movzbl (%rax),%eax
+  800535:	84 c0                	test   %al,%al
+  800537:	74 12                	je     80054b <strcmp+0x4d>
+  800539:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80053d:	0f b6 10             	movzbl (%rax),%edx
+  800540:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800544:	0f b6 00             	movzbl (%rax),%eax
+  800547:	38 c2                	cmp    %al,%dl
+  800549:	74 d9                	je     800524 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80054b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80054f:	0f b6 00             	movzbl (%rax),%eax
+  800552:	0f b6 d0             	movzbl %al,%edx
+  800555:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800559:	0f b6 00             	movzbl (%rax),%eax
+  80055c:	0f b6 c0             	movzbl %al,%eax
+  80055f:	29 c2                	sub    %eax,%edx
+  800561:	89 d0                	mov    %edx,%eax
+}
+  800563:	c9                   	leave
+  800564:	c3                   	ret
+
+0000000000800565 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	48 83 ec 18          	sub    $0x18,%rsp
+  80056d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80056d <strncmp+0x8>
+  800574:	49 bb c3 7a 00 00 00 	movabs $0x7ac3,%r11
+  80057b:	00 00 00 
+  80057e:	4c 01 d8             	add    %r11,%rax
+  800581:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800585:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800589:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80058d:	eb 0f                	jmp    80059e <strncmp+0x39>
+		n--, p++, q++;
+  80058f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  800594:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800599:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80059e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8005a3:	74 1d                	je     8005c2 <strncmp+0x5d>
+  8005a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005a9:	0f b6 00             	movzbl (%rax),%eax
+  8005ac:	84 c0                	test   %al,%al
+  8005ae:	74 12                	je     8005c2 <strncmp+0x5d>
+  8005b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005b4:	0f b6 10             	movzbl (%rax),%edx
+  8005b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005bb:	0f b6 00             	movzbl (%rax),%eax
+  8005be:	38 c2                	cmp    %al,%dl
+  8005c0:	74 cd                	je     80058f <strncmp+0x2a>
+	if (n == 0)
+  8005c2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8005c7:	75 07                	jne    8005d0 <strncmp+0x6b>
+		return 0;
+  8005c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ce:	eb 16                	jmp    8005e6 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8005d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005d4:	0f b6 00             	movzbl (%rax),%eax
+  8005d7:	0f b6 d0             	movzbl %al,%edx
+  8005da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005de:	0f b6 00             	movzbl (%rax),%eax
+  8005e1:	0f b6 c0             	movzbl %al,%eax
+  8005e4:	29 c2                	sub    %eax,%edx
+}
+  8005e6:	89 d0                	mov    %edx,%eax
+  8005e8:	c9                   	leave
+  8005e9:	c3                   	ret
+
+00000000008005ea <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8005ea:	55                   	push   %rbp
+  8005eb:	48 89 e5             	mov    %rsp,%rbp
+  8005ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8005f2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005f2 <strchr+0x8>
+  8005f9:	49 bb 3e 7a 00 00 00 	movabs $0x7a3e,%r11
+  800600:	00 00 00 
+  800603:	4c 01 d8             	add    %r11,%rax
+  800606:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80060a:	89 f0                	mov    %esi,%eax
+  80060c:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80060f:	eb 17                	jmp    800628 <strchr+0x3e>
+		if (*s == c)
+  800611:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800615:	0f b6 00             	movzbl (%rax),%eax
+  800618:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80061b:	75 06                	jne    800623 <strchr+0x39>
+			return (char *) s;
+  80061d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800621:	eb 15                	jmp    800638 <strchr+0x4e>
+	for (; *s; s++)
+  800623:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800628:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80062c:	0f b6 00             	movzbl (%rax),%eax
+  80062f:	84 c0                	test   %al,%al
+  800631:	75 de                	jne    800611 <strchr+0x27>
+	return 0;
+  800633:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800638:	c9                   	leave
+  800639:	c3                   	ret
+
+000000000080063a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80063a:	55                   	push   %rbp
+  80063b:	48 89 e5             	mov    %rsp,%rbp
+  80063e:	48 83 ec 10          	sub    $0x10,%rsp
+  800642:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800642 <strfind+0x8>
+  800649:	49 bb ee 79 00 00 00 	movabs $0x79ee,%r11
+  800650:	00 00 00 
+  800653:	4c 01 d8             	add    %r11,%rax
+  800656:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80065a:	89 f0                	mov    %esi,%eax
+  80065c:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80065f:	eb 11                	jmp    800672 <strfind+0x38>
+		if (*s == c)
+  800661:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800665:	0f b6 00             	movzbl (%rax),%eax
+  800668:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80066b:	74 12                	je     80067f <strfind+0x45>
+	for (; *s; s++)
+  80066d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800672:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800676:	0f b6 00             	movzbl (%rax),%eax
+  800679:	84 c0                	test   %al,%al
+  80067b:	75 e4                	jne    800661 <strfind+0x27>
+  80067d:	eb 01                	jmp    800680 <strfind+0x46>
+			break;
+  80067f:	90                   	nop
+	return (char *) s;
+  800680:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800684:	c9                   	leave
+  800685:	c3                   	ret
+
+0000000000800686 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800686:	55                   	push   %rbp
+  800687:	48 89 e5             	mov    %rsp,%rbp
+  80068a:	48 83 ec 18          	sub    $0x18,%rsp
+  80068e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80068e <memset+0x8>
+  800695:	49 bb a2 79 00 00 00 	movabs $0x79a2,%r11
+  80069c:	00 00 00 
+  80069f:	4c 01 d8             	add    %r11,%rax
+  8006a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006a6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8006a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8006ad:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8006b2:	75 06                	jne    8006ba <memset+0x34>
+		return v;
+  8006b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006b8:	eb 69                	jmp    800723 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8006ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8006be:	83 e0 03             	and    $0x3,%eax
+  8006c1:	48 85 c0             	test   %rax,%rax
+  8006c4:	75 48                	jne    80070e <memset+0x88>
+  8006c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ca:	83 e0 03             	and    $0x3,%eax
+  8006cd:	48 85 c0             	test   %rax,%rax
+  8006d0:	75 3c                	jne    80070e <memset+0x88>
+		c &= 0xFF;
+  8006d2:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8006d9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8006dc:	c1 e0 18             	shl    $0x18,%eax
+  8006df:	89 c2                	mov    %eax,%edx
+  8006e1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8006e4:	c1 e0 10             	shl    $0x10,%eax
+  8006e7:	09 c2                	or     %eax,%edx
+  8006e9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8006ec:	c1 e0 08             	shl    $0x8,%eax
+  8006ef:	09 d0                	or     %edx,%eax
+  8006f1:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8006f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006f8:	48 c1 e8 02          	shr    $0x2,%rax
+  8006fc:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8006ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800703:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800706:	48 89 d7             	mov    %rdx,%rdi
+  800709:	fc                   	cld
+  80070a:	f3 ab                	rep stos %eax,%es:(%rdi)
+  80070c:	eb 11                	jmp    80071f <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80070e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800712:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800715:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800719:	48 89 d7             	mov    %rdx,%rdi
+  80071c:	fc                   	cld
+  80071d:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  80071f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800723:	c9                   	leave
+  800724:	c3                   	ret
+
+0000000000800725 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800725:	55                   	push   %rbp
+  800726:	48 89 e5             	mov    %rsp,%rbp
+  800729:	48 83 ec 28          	sub    $0x28,%rsp
+  80072d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80072d <memmove+0x8>
+  800734:	49 bb 03 79 00 00 00 	movabs $0x7903,%r11
+  80073b:	00 00 00 
+  80073e:	4c 01 d8             	add    %r11,%rax
+  800741:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800745:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800749:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80074d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800751:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  800755:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800759:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80075d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800761:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  800765:	0f 83 88 00 00 00    	jae    8007f3 <memmove+0xce>
+  80076b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80076f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800773:	48 01 d0             	add    %rdx,%rax
+  800776:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80077a:	73 77                	jae    8007f3 <memmove+0xce>
+		s += n;
+  80077c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800780:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  800784:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800788:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80078c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800790:	83 e0 03             	and    $0x3,%eax
+  800793:	48 85 c0             	test   %rax,%rax
+  800796:	75 3b                	jne    8007d3 <memmove+0xae>
+  800798:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80079c:	83 e0 03             	and    $0x3,%eax
+  80079f:	48 85 c0             	test   %rax,%rax
+  8007a2:	75 2f                	jne    8007d3 <memmove+0xae>
+  8007a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8007a8:	83 e0 03             	and    $0x3,%eax
+  8007ab:	48 85 c0             	test   %rax,%rax
+  8007ae:	75 23                	jne    8007d3 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8007b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007b4:	48 83 e8 04          	sub    $0x4,%rax
+  8007b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007bc:	48 83 ea 04          	sub    $0x4,%rdx
+  8007c0:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8007c4:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8007c8:	48 89 c7             	mov    %rax,%rdi
+  8007cb:	48 89 d6             	mov    %rdx,%rsi
+  8007ce:	fd                   	std
+  8007cf:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8007d1:	eb 1d                	jmp    8007f0 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8007d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007d7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8007db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007df:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8007e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8007e7:	48 89 d7             	mov    %rdx,%rdi
+  8007ea:	48 89 c1             	mov    %rax,%rcx
+  8007ed:	fd                   	std
+  8007ee:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8007f0:	fc                   	cld
+  8007f1:	eb 57                	jmp    80084a <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8007f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007f7:	83 e0 03             	and    $0x3,%eax
+  8007fa:	48 85 c0             	test   %rax,%rax
+  8007fd:	75 36                	jne    800835 <memmove+0x110>
+  8007ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800803:	83 e0 03             	and    $0x3,%eax
+  800806:	48 85 c0             	test   %rax,%rax
+  800809:	75 2a                	jne    800835 <memmove+0x110>
+  80080b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80080f:	83 e0 03             	and    $0x3,%eax
+  800812:	48 85 c0             	test   %rax,%rax
+  800815:	75 1e                	jne    800835 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800817:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80081b:	48 c1 e8 02          	shr    $0x2,%rax
+  80081f:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  800822:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800826:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80082a:	48 89 c7             	mov    %rax,%rdi
+  80082d:	48 89 d6             	mov    %rdx,%rsi
+  800830:	fc                   	cld
+  800831:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  800833:	eb 15                	jmp    80084a <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  800835:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800839:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80083d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  800841:	48 89 c7             	mov    %rax,%rdi
+  800844:	48 89 d6             	mov    %rdx,%rsi
+  800847:	fc                   	cld
+  800848:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  80084a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80084e:	c9                   	leave
+  80084f:	c3                   	ret
+
+0000000000800850 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800850:	55                   	push   %rbp
+  800851:	48 89 e5             	mov    %rsp,%rbp
+  800854:	48 83 ec 18          	sub    $0x18,%rsp
+  800858:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800858 <memcpy+0x8>
+  80085f:	49 bb d8 77 00 00 00 	movabs $0x77d8,%r11
+  800866:	00 00 00 
+  800869:	4c 01 d8             	add    %r11,%rax
+  80086c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800870:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800874:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  800878:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80087c:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800880:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800884:	48 89 cf             	mov    %rcx,%rdi
+  800887:	48 b9 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rcx
+  80088e:	ff ff ff 
+  800891:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  800895:	ff d0                	call   *%rax
+}
+  800897:	c9                   	leave
+  800898:	c3                   	ret
+
+0000000000800899 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800899:	55                   	push   %rbp
+  80089a:	48 89 e5             	mov    %rsp,%rbp
+  80089d:	48 83 ec 28          	sub    $0x28,%rsp
+  8008a1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008a1 <memcmp+0x8>
+  8008a8:	49 bb 8f 77 00 00 00 	movabs $0x778f,%r11
+  8008af:	00 00 00 
+  8008b2:	4c 01 d8             	add    %r11,%rax
+  8008b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8008bd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  8008c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008c5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  8008c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8008cd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  8008d1:	eb 34                	jmp    800907 <memcmp+0x6e>
+		if (*s1 != *s2)
+  8008d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008d7:	0f b6 10             	movzbl (%rax),%edx
+  8008da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8008de:	0f b6 00             	movzbl (%rax),%eax
+  8008e1:	38 c2                	cmp    %al,%dl
+  8008e3:	74 18                	je     8008fd <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  8008e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008e9:	0f b6 00             	movzbl (%rax),%eax
+  8008ec:	0f b6 d0             	movzbl %al,%edx
+  8008ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8008f3:	0f b6 00             	movzbl (%rax),%eax
+  8008f6:	0f b6 c0             	movzbl %al,%eax
+  8008f9:	29 c2                	sub    %eax,%edx
+  8008fb:	eb 20                	jmp    80091d <memcmp+0x84>
+		s1++, s2++;
+  8008fd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800902:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  800907:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80090b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80090f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800913:	48 85 c0             	test   %rax,%rax
+  800916:	75 bb                	jne    8008d3 <memcmp+0x3a>
+	}
+
+	return 0;
+  800918:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80091d:	89 d0                	mov    %edx,%eax
+  80091f:	c9                   	leave
+  800920:	c3                   	ret
+
+0000000000800921 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800921:	55                   	push   %rbp
+  800922:	48 89 e5             	mov    %rsp,%rbp
+  800925:	48 83 ec 28          	sub    $0x28,%rsp
+  800929:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800929 <memfind+0x8>
+  800930:	49 bb 07 77 00 00 00 	movabs $0x7707,%r11
+  800937:	00 00 00 
+  80093a:	4c 01 d8             	add    %r11,%rax
+  80093d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800941:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  800944:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  800948:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80094c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800950:	48 01 d0             	add    %rdx,%rax
+  800953:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  800957:	eb 13                	jmp    80096c <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800959:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80095d:	0f b6 00             	movzbl (%rax),%eax
+  800960:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800963:	38 d0                	cmp    %dl,%al
+  800965:	74 11                	je     800978 <memfind+0x57>
+	for (; s < ends; s++)
+  800967:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80096c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800970:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  800974:	72 e3                	jb     800959 <memfind+0x38>
+  800976:	eb 01                	jmp    800979 <memfind+0x58>
+			break;
+  800978:	90                   	nop
+	return (void *) s;
+  800979:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80097d:	c9                   	leave
+  80097e:	c3                   	ret
+
+000000000080097f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80097f:	55                   	push   %rbp
+  800980:	48 89 e5             	mov    %rsp,%rbp
+  800983:	48 83 ec 38          	sub    $0x38,%rsp
+  800987:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800987 <strtol+0x8>
+  80098e:	49 bb a9 76 00 00 00 	movabs $0x76a9,%r11
+  800995:	00 00 00 
+  800998:	4c 01 d8             	add    %r11,%rax
+  80099b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80099f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8009a3:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8009a6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8009ad:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8009b4:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009b5:	eb 05                	jmp    8009bc <strtol+0x3d>
+		s++;
+  8009b7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8009bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009c0:	0f b6 00             	movzbl (%rax),%eax
+  8009c3:	3c 20                	cmp    $0x20,%al
+  8009c5:	74 f0                	je     8009b7 <strtol+0x38>
+  8009c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009cb:	0f b6 00             	movzbl (%rax),%eax
+  8009ce:	3c 09                	cmp    $0x9,%al
+  8009d0:	74 e5                	je     8009b7 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009d6:	0f b6 00             	movzbl (%rax),%eax
+  8009d9:	3c 2b                	cmp    $0x2b,%al
+  8009db:	75 07                	jne    8009e4 <strtol+0x65>
+		s++;
+  8009dd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8009e2:	eb 17                	jmp    8009fb <strtol+0x7c>
+	else if (*s == '-')
+  8009e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009e8:	0f b6 00             	movzbl (%rax),%eax
+  8009eb:	3c 2d                	cmp    $0x2d,%al
+  8009ed:	75 0c                	jne    8009fb <strtol+0x7c>
+		s++, neg = 1;
+  8009ef:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8009f4:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009fb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8009ff:	74 06                	je     800a07 <strtol+0x88>
+  800a01:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  800a05:	75 28                	jne    800a2f <strtol+0xb0>
+  800a07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a0b:	0f b6 00             	movzbl (%rax),%eax
+  800a0e:	3c 30                	cmp    $0x30,%al
+  800a10:	75 1d                	jne    800a2f <strtol+0xb0>
+  800a12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a16:	48 83 c0 01          	add    $0x1,%rax
+  800a1a:	0f b6 00             	movzbl (%rax),%eax
+  800a1d:	3c 78                	cmp    $0x78,%al
+  800a1f:	75 0e                	jne    800a2f <strtol+0xb0>
+		s += 2, base = 16;
+  800a21:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  800a26:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  800a2d:	eb 2c                	jmp    800a5b <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  800a2f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a33:	75 19                	jne    800a4e <strtol+0xcf>
+  800a35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a39:	0f b6 00             	movzbl (%rax),%eax
+  800a3c:	3c 30                	cmp    $0x30,%al
+  800a3e:	75 0e                	jne    800a4e <strtol+0xcf>
+		s++, base = 8;
+  800a40:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800a45:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  800a4c:	eb 0d                	jmp    800a5b <strtol+0xdc>
+	else if (base == 0)
+  800a4e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a52:	75 07                	jne    800a5b <strtol+0xdc>
+		base = 10;
+  800a54:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  800a5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a5f:	0f b6 00             	movzbl (%rax),%eax
+  800a62:	3c 2f                	cmp    $0x2f,%al
+  800a64:	7e 1d                	jle    800a83 <strtol+0x104>
+  800a66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a6a:	0f b6 00             	movzbl (%rax),%eax
+  800a6d:	3c 39                	cmp    $0x39,%al
+  800a6f:	7f 12                	jg     800a83 <strtol+0x104>
+			dig = *s - '0';
+  800a71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a75:	0f b6 00             	movzbl (%rax),%eax
+  800a78:	0f be c0             	movsbl %al,%eax
+  800a7b:	83 e8 30             	sub    $0x30,%eax
+  800a7e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800a81:	eb 4e                	jmp    800ad1 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  800a83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a87:	0f b6 00             	movzbl (%rax),%eax
+  800a8a:	3c 60                	cmp    $0x60,%al
+  800a8c:	7e 1d                	jle    800aab <strtol+0x12c>
+  800a8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a92:	0f b6 00             	movzbl (%rax),%eax
+  800a95:	3c 7a                	cmp    $0x7a,%al
+  800a97:	7f 12                	jg     800aab <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  800a99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a9d:	0f b6 00             	movzbl (%rax),%eax
+  800aa0:	0f be c0             	movsbl %al,%eax
+  800aa3:	83 e8 57             	sub    $0x57,%eax
+  800aa6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800aa9:	eb 26                	jmp    800ad1 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  800aab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800aaf:	0f b6 00             	movzbl (%rax),%eax
+  800ab2:	3c 40                	cmp    $0x40,%al
+  800ab4:	7e 47                	jle    800afd <strtol+0x17e>
+  800ab6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800aba:	0f b6 00             	movzbl (%rax),%eax
+  800abd:	3c 5a                	cmp    $0x5a,%al
+  800abf:	7f 3c                	jg     800afd <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  800ac1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ac5:	0f b6 00             	movzbl (%rax),%eax
+  800ac8:	0f be c0             	movsbl %al,%eax
+  800acb:	83 e8 37             	sub    $0x37,%eax
+  800ace:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  800ad1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800ad4:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  800ad7:	7d 23                	jge    800afc <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  800ad9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  800ade:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800ae1:	48 98                	cltq
+  800ae3:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  800ae8:	48 89 c2             	mov    %rax,%rdx
+  800aeb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800aee:	48 98                	cltq
+  800af0:	48 01 d0             	add    %rdx,%rax
+  800af3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  800af7:	e9 5f ff ff ff       	jmp    800a5b <strtol+0xdc>
+			break;
+  800afc:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800afd:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800b02:	74 0b                	je     800b0f <strtol+0x190>
+		*endptr = (char *) s;
+  800b04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b08:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800b0c:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  800b0f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800b13:	74 09                	je     800b1e <strtol+0x19f>
+  800b15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b19:	48 f7 d8             	neg    %rax
+  800b1c:	eb 04                	jmp    800b22 <strtol+0x1a3>
+  800b1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  800b22:	c9                   	leave
+  800b23:	c3                   	ret
+
+0000000000800b24 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  800b24:	55                   	push   %rbp
+  800b25:	48 89 e5             	mov    %rsp,%rbp
+  800b28:	53                   	push   %rbx
+  800b29:	48 83 ec 30          	sub    $0x30,%rsp
+  800b2d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800b2d <strstr+0x9>
+  800b34:	49 bb 03 75 00 00 00 	movabs $0x7503,%r11
+  800b3b:	00 00 00 
+  800b3e:	4c 01 db             	add    %r11,%rbx
+  800b41:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  800b45:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  800b49:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b4d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b51:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800b55:	0f b6 00             	movzbl (%rax),%eax
+  800b58:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  800b5b:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  800b5f:	75 06                	jne    800b67 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  800b61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b65:	eb 73                	jmp    800bda <strstr+0xb6>
+
+	len = strlen(str);
+  800b67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b6b:	48 89 c7             	mov    %rax,%rdi
+  800b6e:	48 b8 81 82 ff ff ff 	movabs $0xffffffffffff8281,%rax
+  800b75:	ff ff ff 
+  800b78:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b7c:	ff d0                	call   *%rax
+  800b7e:	48 98                	cltq
+  800b80:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  800b84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b88:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b8c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800b90:	0f b6 00             	movzbl (%rax),%eax
+  800b93:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  800b96:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  800b9a:	75 07                	jne    800ba3 <strstr+0x7f>
+				return (char *) 0;
+  800b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba1:	eb 37                	jmp    800bda <strstr+0xb6>
+		} while (sc != c);
+  800ba3:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  800ba7:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  800baa:	75 d8                	jne    800b84 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  800bac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bb0:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  800bb4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bb8:	48 89 ce             	mov    %rcx,%rsi
+  800bbb:	48 89 c7             	mov    %rax,%rdi
+  800bbe:	48 b8 35 85 ff ff ff 	movabs $0xffffffffffff8535,%rax
+  800bc5:	ff ff ff 
+  800bc8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800bcc:	ff d0                	call   *%rax
+  800bce:	85 c0                	test   %eax,%eax
+  800bd0:	75 b2                	jne    800b84 <strstr+0x60>
+
+	return (char *) (in - 1);
+  800bd2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bd6:	48 83 e8 01          	sub    $0x1,%rax
+}
+  800bda:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800bde:	c9                   	leave
+  800bdf:	c3                   	ret
+
+0000000000800be0 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  800be0:	55                   	push   %rbp
+  800be1:	48 89 e5             	mov    %rsp,%rbp
+  800be4:	41 57                	push   %r15
+  800be6:	53                   	push   %rbx
+  800be7:	48 83 ec 40          	sub    $0x40,%rsp
+  800beb:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800beb <syscall+0xb>
+  800bf2:	49 bb 45 74 00 00 00 	movabs $0x7445,%r11
+  800bf9:	00 00 00 
+  800bfc:	4d 01 da             	add    %r11,%r10
+  800bff:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800c02:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  800c05:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800c09:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800c0d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  800c11:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  800c15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800c18:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800c1c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  800c20:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  800c24:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  800c28:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800c2c:	4c 89 c3             	mov    %r8,%rbx
+  800c2f:	cd 30                	int    $0x30
+  800c31:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  800c35:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c39:	74 52                	je     800c8d <syscall+0xad>
+  800c3b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800c40:	7e 4b                	jle    800c8d <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c42:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c46:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800c49:	49 89 d0             	mov    %rdx,%r8
+  800c4c:	89 c1                	mov    %eax,%ecx
+  800c4e:	48 b8 19 df ff ff ff 	movabs $0xffffffffffffdf19,%rax
+  800c55:	ff ff ff 
+  800c58:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800c5c:	48 89 c2             	mov    %rax,%rdx
+  800c5f:	be 23 00 00 00       	mov    $0x23,%esi
+  800c64:	48 b8 36 df ff ff ff 	movabs $0xffffffffffffdf36,%rax
+  800c6b:	ff ff ff 
+  800c6e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800c72:	48 89 c7             	mov    %rax,%rdi
+  800c75:	4d 89 d7             	mov    %r10,%r15
+  800c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7d:	49 b9 83 c6 ff ff ff 	movabs $0xffffffffffffc683,%r9
+  800c84:	ff ff ff 
+  800c87:	4d 01 d1             	add    %r10,%r9
+  800c8a:	41 ff d1             	call   *%r9
+
+	return ret;
+  800c8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800c91:	48 83 c4 40          	add    $0x40,%rsp
+  800c95:	5b                   	pop    %rbx
+  800c96:	41 5f                	pop    %r15
+  800c98:	5d                   	pop    %rbp
+  800c99:	c3                   	ret
+
+0000000000800c9a <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  800c9a:	55                   	push   %rbp
+  800c9b:	48 89 e5             	mov    %rsp,%rbp
+  800c9e:	41 57                	push   %r15
+  800ca0:	41 56                	push   %r14
+  800ca2:	41 55                	push   %r13
+  800ca4:	41 54                	push   %r12
+  800ca6:	53                   	push   %rbx
+  800ca7:	48 83 ec 48          	sub    $0x48,%rsp
+  800cab:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 800cab <syscall_words+0x11>
+  800cb2:	49 bb 85 73 00 00 00 	movabs $0x7385,%r11
+  800cb9:	00 00 00 
+  800cbc:	4d 01 de             	add    %r11,%r14
+  800cbf:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  800cc2:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  800cc5:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  800cc9:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  800ccd:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  800cd1:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  800cd5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800cda:	74 09                	je     800ce5 <syscall_words+0x4b>
+  800cdc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800ce0:	48 8b 00             	mov    (%rax),%rax
+  800ce3:	eb 05                	jmp    800cea <syscall_words+0x50>
+  800ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cea:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  800ced:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800cf2:	74 0a                	je     800cfe <syscall_words+0x64>
+  800cf4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800cf8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cfc:	eb 05                	jmp    800d03 <syscall_words+0x69>
+  800cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d03:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  800d06:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800d0b:	74 0a                	je     800d17 <syscall_words+0x7d>
+  800d0d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800d11:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800d15:	eb 05                	jmp    800d1c <syscall_words+0x82>
+  800d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1c:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  800d1f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800d24:	74 0a                	je     800d30 <syscall_words+0x96>
+  800d26:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800d2a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800d2e:	eb 05                	jmp    800d35 <syscall_words+0x9b>
+  800d30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d35:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  800d38:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800d3d:	74 0a                	je     800d49 <syscall_words+0xaf>
+  800d3f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800d43:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d47:	eb 05                	jmp    800d4e <syscall_words+0xb4>
+  800d49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4e:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  800d51:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800d56:	74 0a                	je     800d62 <syscall_words+0xc8>
+  800d58:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800d5c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800d60:	eb 05                	jmp    800d67 <syscall_words+0xcd>
+  800d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d67:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  800d6a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800d6d:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  800d71:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d75:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  800d79:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800d7d:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800d81:	cd 30                	int    $0x30
+  800d83:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  800d87:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800d8c:	74 50                	je     800dde <syscall_words+0x144>
+		words[0] = r8;
+  800d8e:	4c 89 c2             	mov    %r8,%rdx
+  800d91:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800d95:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  800d98:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800d9c:	48 83 c0 08          	add    $0x8,%rax
+  800da0:	4c 89 ca             	mov    %r9,%rdx
+  800da3:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  800da6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800daa:	48 83 c0 10          	add    $0x10,%rax
+  800dae:	4c 89 d2             	mov    %r10,%rdx
+  800db1:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  800db4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800db8:	48 83 c0 18          	add    $0x18,%rax
+  800dbc:	4c 89 da             	mov    %r11,%rdx
+  800dbf:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  800dc2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800dc6:	48 83 c0 20          	add    $0x20,%rax
+  800dca:	4c 89 e2             	mov    %r12,%rdx
+  800dcd:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  800dd0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800dd4:	48 83 c0 28          	add    $0x28,%rax
+  800dd8:	4c 89 ea             	mov    %r13,%rdx
+  800ddb:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  800dde:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  800de2:	74 52                	je     800e36 <syscall_words+0x19c>
+  800de4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800de9:	7e 4b                	jle    800e36 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800deb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800def:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800df2:	49 89 d0             	mov    %rdx,%r8
+  800df5:	89 c1                	mov    %eax,%ecx
+  800df7:	48 b8 19 df ff ff ff 	movabs $0xffffffffffffdf19,%rax
+  800dfe:	ff ff ff 
+  800e01:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  800e05:	48 89 c2             	mov    %rax,%rdx
+  800e08:	be 4e 00 00 00       	mov    $0x4e,%esi
+  800e0d:	48 b8 36 df ff ff ff 	movabs $0xffffffffffffdf36,%rax
+  800e14:	ff ff ff 
+  800e17:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  800e1b:	48 89 c7             	mov    %rax,%rdi
+  800e1e:	4d 89 f7             	mov    %r14,%r15
+  800e21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e26:	49 b9 83 c6 ff ff ff 	movabs $0xffffffffffffc683,%r9
+  800e2d:	ff ff ff 
+  800e30:	4d 01 f1             	add    %r14,%r9
+  800e33:	41 ff d1             	call   *%r9
+
+	return ret;
+  800e36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  800e3a:	48 83 c4 48          	add    $0x48,%rsp
+  800e3e:	5b                   	pop    %rbx
+  800e3f:	41 5c                	pop    %r12
+  800e41:	41 5d                	pop    %r13
+  800e43:	41 5e                	pop    %r14
+  800e45:	41 5f                	pop    %r15
+  800e47:	5d                   	pop    %rbp
+  800e48:	c3                   	ret
+
+0000000000800e49 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e49:	55                   	push   %rbp
+  800e4a:	48 89 e5             	mov    %rsp,%rbp
+  800e4d:	48 83 ec 10          	sub    $0x10,%rsp
+  800e51:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800e51 <sys_cputs+0x8>
+  800e58:	49 bb df 71 00 00 00 	movabs $0x71df,%r11
+  800e5f:	00 00 00 
+  800e62:	4c 01 d8             	add    %r11,%rax
+  800e65:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800e69:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800e6d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800e71:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800e75:	48 83 ec 08          	sub    $0x8,%rsp
+  800e79:	6a 00                	push   $0x0
+  800e7b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800e81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e87:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e91:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  800e98:	ff ff ff 
+  800e9b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800e9f:	ff d0                	call   *%rax
+  800ea1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ea5:	90                   	nop
+  800ea6:	c9                   	leave
+  800ea7:	c3                   	ret
+
+0000000000800ea8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ea8:	55                   	push   %rbp
+  800ea9:	48 89 e5             	mov    %rsp,%rbp
+  800eac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800eac <sys_cgetc+0x4>
+  800eb3:	49 bb 84 71 00 00 00 	movabs $0x7184,%r11
+  800eba:	00 00 00 
+  800ebd:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800ec0:	48 83 ec 08          	sub    $0x8,%rsp
+  800ec4:	6a 00                	push   $0x0
+  800ec6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ecc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ed2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ed7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800edc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee1:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ee6:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  800eed:	ff ff ff 
+  800ef0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800ef4:	ff d0                	call   *%rax
+  800ef6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800efa:	c9                   	leave
+  800efb:	c3                   	ret
+
+0000000000800efc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800efc:	55                   	push   %rbp
+  800efd:	48 89 e5             	mov    %rsp,%rbp
+  800f00:	48 83 ec 10          	sub    $0x10,%rsp
+  800f04:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800f04 <sys_env_destroy+0x8>
+  800f0b:	49 bb 2c 71 00 00 00 	movabs $0x712c,%r11
+  800f12:	00 00 00 
+  800f15:	4c 01 d8             	add    %r11,%rax
+  800f18:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800f1b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f1e:	48 63 d2             	movslq %edx,%rdx
+  800f21:	48 83 ec 08          	sub    $0x8,%rsp
+  800f25:	6a 00                	push   $0x0
+  800f27:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800f2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f38:	be 01 00 00 00       	mov    $0x1,%esi
+  800f3d:	bf 03 00 00 00       	mov    $0x3,%edi
+  800f42:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  800f49:	ff ff ff 
+  800f4c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800f50:	ff d0                	call   *%rax
+  800f52:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800f56:	c9                   	leave
+  800f57:	c3                   	ret
+
+0000000000800f58 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f58:	55                   	push   %rbp
+  800f59:	48 89 e5             	mov    %rsp,%rbp
+  800f5c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800f5c <sys_getenvid+0x4>
+  800f63:	49 bb d4 70 00 00 00 	movabs $0x70d4,%r11
+  800f6a:	00 00 00 
+  800f6d:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800f70:	48 83 ec 08          	sub    $0x8,%rsp
+  800f74:	6a 00                	push   $0x0
+  800f76:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800f7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f87:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f8c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f91:	bf 02 00 00 00       	mov    $0x2,%edi
+  800f96:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  800f9d:	ff ff ff 
+  800fa0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800fa4:	ff d0                	call   *%rax
+  800fa6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800faa:	c9                   	leave
+  800fab:	c3                   	ret
+
+0000000000800fac <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800fac:	55                   	push   %rbp
+  800fad:	48 89 e5             	mov    %rsp,%rbp
+  800fb0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800fb0 <sys_yield+0x4>
+  800fb7:	49 bb 80 70 00 00 00 	movabs $0x7080,%r11
+  800fbe:	00 00 00 
+  800fc1:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800fc4:	48 83 ec 08          	sub    $0x8,%rsp
+  800fc8:	6a 00                	push   $0x0
+  800fca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800fd0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe0:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  800fea:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  800ff1:	ff ff ff 
+  800ff4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800ff8:	ff d0                	call   *%rax
+  800ffa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ffe:	90                   	nop
+  800fff:	c9                   	leave
+  801000:	c3                   	ret
+
+0000000000801001 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801001:	55                   	push   %rbp
+  801002:	48 89 e5             	mov    %rsp,%rbp
+  801005:	48 83 ec 10          	sub    $0x10,%rsp
+  801009:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801009 <sys_page_alloc+0x8>
+  801010:	49 bb 27 70 00 00 00 	movabs $0x7027,%r11
+  801017:	00 00 00 
+  80101a:	4c 01 d8             	add    %r11,%rax
+  80101d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801020:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801024:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801027:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80102a:	48 63 f2             	movslq %edx,%rsi
+  80102d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801031:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801034:	48 63 d2             	movslq %edx,%rdx
+  801037:	48 83 ec 08          	sub    $0x8,%rsp
+  80103b:	6a 00                	push   $0x0
+  80103d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801043:	49 89 f0             	mov    %rsi,%r8
+  801046:	be 01 00 00 00       	mov    $0x1,%esi
+  80104b:	bf 04 00 00 00       	mov    $0x4,%edi
+  801050:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  801057:	ff ff ff 
+  80105a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80105e:	ff d0                	call   *%rax
+  801060:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801064:	c9                   	leave
+  801065:	c3                   	ret
+
+0000000000801066 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801066:	55                   	push   %rbp
+  801067:	48 89 e5             	mov    %rsp,%rbp
+  80106a:	48 83 ec 20          	sub    $0x20,%rsp
+  80106e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80106e <sys_page_map+0x8>
+  801075:	49 bb c2 6f 00 00 00 	movabs $0x6fc2,%r11
+  80107c:	00 00 00 
+  80107f:	4c 01 d8             	add    %r11,%rax
+  801082:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801085:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801089:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80108c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801090:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801094:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801097:	48 63 f2             	movslq %edx,%rsi
+  80109a:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80109e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8010a1:	48 63 fa             	movslq %edx,%rdi
+  8010a4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8010a8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8010ab:	48 63 d2             	movslq %edx,%rdx
+  8010ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b2:	56                   	push   %rsi
+  8010b3:	4d 89 c1             	mov    %r8,%r9
+  8010b6:	49 89 f8             	mov    %rdi,%r8
+  8010b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8010be:	bf 05 00 00 00       	mov    $0x5,%edi
+  8010c3:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  8010ca:	ff ff ff 
+  8010cd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8010d1:	ff d0                	call   *%rax
+  8010d3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8010d7:	c9                   	leave
+  8010d8:	c3                   	ret
+
+00000000008010d9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010d9:	55                   	push   %rbp
+  8010da:	48 89 e5             	mov    %rsp,%rbp
+  8010dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8010e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8010e1 <sys_page_unmap+0x8>
+  8010e8:	49 bb 4f 6f 00 00 00 	movabs $0x6f4f,%r11
+  8010ef:	00 00 00 
+  8010f2:	4c 01 d8             	add    %r11,%rax
+  8010f5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8010f8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8010fc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801100:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801103:	48 63 d2             	movslq %edx,%rdx
+  801106:	48 83 ec 08          	sub    $0x8,%rsp
+  80110a:	6a 00                	push   $0x0
+  80110c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801112:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801118:	be 01 00 00 00       	mov    $0x1,%esi
+  80111d:	bf 06 00 00 00       	mov    $0x6,%edi
+  801122:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  801129:	ff ff ff 
+  80112c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801130:	ff d0                	call   *%rax
+  801132:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801136:	c9                   	leave
+  801137:	c3                   	ret
+
+0000000000801138 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801138:	55                   	push   %rbp
+  801139:	48 89 e5             	mov    %rsp,%rbp
+  80113c:	48 83 ec 10          	sub    $0x10,%rsp
+  801140:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801140 <sys_env_set_status+0x8>
+  801147:	49 bb f0 6e 00 00 00 	movabs $0x6ef0,%r11
+  80114e:	00 00 00 
+  801151:	4c 01 d8             	add    %r11,%rax
+  801154:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801157:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80115a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80115d:	48 63 ca             	movslq %edx,%rcx
+  801160:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801163:	48 63 d2             	movslq %edx,%rdx
+  801166:	48 83 ec 08          	sub    $0x8,%rsp
+  80116a:	6a 00                	push   $0x0
+  80116c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801172:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801178:	be 01 00 00 00       	mov    $0x1,%esi
+  80117d:	bf 08 00 00 00       	mov    $0x8,%edi
+  801182:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  801189:	ff ff ff 
+  80118c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801190:	ff d0                	call   *%rax
+  801192:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801196:	c9                   	leave
+  801197:	c3                   	ret
+
+0000000000801198 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801198:	55                   	push   %rbp
+  801199:	48 89 e5             	mov    %rsp,%rbp
+  80119c:	48 83 ec 10          	sub    $0x10,%rsp
+  8011a0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011a0 <sys_env_set_trapframe+0x8>
+  8011a7:	49 bb 90 6e 00 00 00 	movabs $0x6e90,%r11
+  8011ae:	00 00 00 
+  8011b1:	4c 01 d8             	add    %r11,%rax
+  8011b4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8011b7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8011bb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8011bf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8011c2:	48 63 d2             	movslq %edx,%rdx
+  8011c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8011c9:	6a 00                	push   $0x0
+  8011cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8011d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8011dc:	bf 09 00 00 00       	mov    $0x9,%edi
+  8011e1:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  8011e8:	ff ff ff 
+  8011eb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8011ef:	ff d0                	call   *%rax
+  8011f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8011f5:	c9                   	leave
+  8011f6:	c3                   	ret
+
+00000000008011f7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011f7:	55                   	push   %rbp
+  8011f8:	48 89 e5             	mov    %rsp,%rbp
+  8011fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8011ff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011ff <sys_env_set_pgfault_upcall+0x8>
+  801206:	49 bb 31 6e 00 00 00 	movabs $0x6e31,%r11
+  80120d:	00 00 00 
+  801210:	4c 01 d8             	add    %r11,%rax
+  801213:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801216:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80121a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80121e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801221:	48 63 d2             	movslq %edx,%rdx
+  801224:	48 83 ec 08          	sub    $0x8,%rsp
+  801228:	6a 00                	push   $0x0
+  80122a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801236:	be 01 00 00 00       	mov    $0x1,%esi
+  80123b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801240:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  801247:	ff ff ff 
+  80124a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80124e:	ff d0                	call   *%rax
+  801250:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801254:	c9                   	leave
+  801255:	c3                   	ret
+
+0000000000801256 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  801256:	55                   	push   %rbp
+  801257:	48 89 e5             	mov    %rsp,%rbp
+  80125a:	48 83 ec 20          	sub    $0x20,%rsp
+  80125e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80125e <sys_ipc_try_send+0x8>
+  801265:	49 bb d2 6d 00 00 00 	movabs $0x6dd2,%r11
+  80126c:	00 00 00 
+  80126f:	4c 01 d8             	add    %r11,%rax
+  801272:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801275:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801279:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80127d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  801280:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801283:	48 63 fa             	movslq %edx,%rdi
+  801286:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80128a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80128d:	48 63 d2             	movslq %edx,%rdx
+  801290:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801294:	48 83 ec 08          	sub    $0x8,%rsp
+  801298:	6a 00                	push   $0x0
+  80129a:	49 89 f9             	mov    %rdi,%r9
+  80129d:	49 89 f0             	mov    %rsi,%r8
+  8012a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a5:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8012aa:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  8012b1:	ff ff ff 
+  8012b4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8012b8:	ff d0                	call   *%rax
+  8012ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8012be:	c9                   	leave
+  8012bf:	c3                   	ret
+
+00000000008012c0 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8012c0:	55                   	push   %rbp
+  8012c1:	48 89 e5             	mov    %rsp,%rbp
+  8012c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8012c8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012c8 <sys_ipc_send+0x8>
+  8012cf:	49 bb 68 6d 00 00 00 	movabs $0x6d68,%r11
+  8012d6:	00 00 00 
+  8012d9:	4c 01 d8             	add    %r11,%rax
+  8012dc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8012df:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8012e3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8012e7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8012ea:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8012ed:	48 63 fa             	movslq %edx,%rdi
+  8012f0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8012f4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8012f7:	48 63 d2             	movslq %edx,%rdx
+  8012fa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8012fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801302:	6a 00                	push   $0x0
+  801304:	49 89 f9             	mov    %rdi,%r9
+  801307:	49 89 f0             	mov    %rsi,%r8
+  80130a:	be 00 00 00 00       	mov    $0x0,%esi
+  80130f:	bf 17 00 00 00       	mov    $0x17,%edi
+  801314:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  80131b:	ff ff ff 
+  80131e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801322:	ff d0                	call   *%rax
+  801324:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801328:	c9                   	leave
+  801329:	c3                   	ret
+
+000000000080132a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80132a:	55                   	push   %rbp
+  80132b:	48 89 e5             	mov    %rsp,%rbp
+  80132e:	48 83 ec 10          	sub    $0x10,%rsp
+  801332:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801332 <sys_ipc_recv+0x8>
+  801339:	49 bb fe 6c 00 00 00 	movabs $0x6cfe,%r11
+  801340:	00 00 00 
+  801343:	4c 01 d8             	add    %r11,%rax
+  801346:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80134a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80134e:	6a 00                	push   $0x0
+  801350:	6a 00                	push   $0x0
+  801352:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801358:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80135e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801363:	be 01 00 00 00       	mov    $0x1,%esi
+  801368:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80136d:	49 ba 6a 8c ff ff ff 	movabs $0xffffffffffff8c6a,%r10
+  801374:	ff ff ff 
+  801377:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80137b:	ff d0                	call   *%rax
+  80137d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801381:	c9                   	leave
+  801382:	c3                   	ret
+
+0000000000801383 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  801383:	55                   	push   %rbp
+  801384:	48 89 e5             	mov    %rsp,%rbp
+  801387:	48 83 ec 30          	sub    $0x30,%rsp
+  80138b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80138b <sys_ipc_call+0x8>
+  801392:	49 bb a5 6c 00 00 00 	movabs $0x6ca5,%r11
+  801399:	00 00 00 
+  80139c:	4c 01 d8             	add    %r11,%rax
+  80139f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8013a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8013a6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8013aa:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8013ad:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8013b1:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8013b5:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8013b9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8013bc:	4c 63 c2             	movslq %edx,%r8
+  8013bf:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8013c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8013c6:	48 63 d2             	movslq %edx,%rdx
+  8013c9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8013cd:	ff 75 d8             	push   -0x28(%rbp)
+  8013d0:	56                   	push   %rsi
+  8013d1:	4d 89 c1             	mov    %r8,%r9
+  8013d4:	49 89 f8             	mov    %rdi,%r8
+  8013d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013dc:	bf 18 00 00 00       	mov    $0x18,%edi
+  8013e1:	49 ba 6a 8c ff ff ff 	movabs $0xffffffffffff8c6a,%r10
+  8013e8:	ff ff ff 
+  8013eb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8013ef:	ff d0                	call   *%rax
+  8013f1:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8013f5:	c9                   	leave
+  8013f6:	c3                   	ret
+
+00000000008013f7 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8013f7:	55                   	push   %rbp
+  8013f8:	48 89 e5             	mov    %rsp,%rbp
+  8013fb:	48 83 ec 30          	sub    $0x30,%rsp
+  8013ff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013ff <sys_ipc_reply_recv+0x8>
+  801406:	49 bb 31 6c 00 00 00 	movabs $0x6c31,%r11
+  80140d:	00 00 00 
+  801410:	4c 01 d8             	add    %r11,%rax
+  801413:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801416:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80141a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80141e:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  801421:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  801425:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  801429:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80142d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801430:	4c 63 c2             	movslq %edx,%r8
+  801433:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  801437:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80143a:	48 63 d2             	movslq %edx,%rdx
+  80143d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801441:	ff 75 d8             	push   -0x28(%rbp)
+  801444:	56                   	push   %rsi
+  801445:	4d 89 c1             	mov    %r8,%r9
+  801448:	49 89 f8             	mov    %rdi,%r8
+  80144b:	be 00 00 00 00       	mov    $0x0,%esi
+  801450:	bf 19 00 00 00       	mov    $0x19,%edi
+  801455:	49 ba 6a 8c ff ff ff 	movabs $0xffffffffffff8c6a,%r10
+  80145c:	ff ff ff 
+  80145f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801463:	ff d0                	call   *%rax
+  801465:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  801469:	c9                   	leave
+  80146a:	c3                   	ret
+
+000000000080146b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80146b:	55                   	push   %rbp
+  80146c:	48 89 e5             	mov    %rsp,%rbp
+  80146f:	48 83 ec 10          	sub    $0x10,%rsp
+  801473:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801473 <sys_env_set_priority+0x8>
+  80147a:	49 bb bd 6b 00 00 00 	movabs $0x6bbd,%r11
+  801481:	00 00 00 
+  801484:	4c 01 d8             	add    %r11,%rax
+  801487:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80148a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80148d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801490:	48 63 ca             	movslq %edx,%rcx
+  801493:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801496:	48 63 d2             	movslq %edx,%rdx
+  801499:	48 83 ec 08          	sub    $0x8,%rsp
+  80149d:	6a 00                	push   $0x0
+  80149f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8014a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8014b0:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8014b5:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  8014bc:	ff ff ff 
+  8014bf:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8014c3:	ff d0                	call   *%rax
+  8014c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8014c9:	c9                   	leave
+  8014ca:	c3                   	ret
+
+00000000008014cb <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8014cb:	55                   	push   %rbp
+  8014cc:	48 89 e5             	mov    %rsp,%rbp
+  8014cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8014d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014d3 <sys_env_set_affinity+0x8>
+  8014da:	49 bb 5d 6b 00 00 00 	movabs $0x6b5d,%r11
+  8014e1:	00 00 00 
+  8014e4:	4c 01 d8             	add    %r11,%rax
+  8014e7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8014ea:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8014ed:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8014f0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8014f3:	48 63 d2             	movslq %edx,%rdx
+  8014f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8014fa:	6a 00                	push   $0x0
+  8014fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801502:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801508:	be 01 00 00 00       	mov    $0x1,%esi
+  80150d:	bf 10 00 00 00       	mov    $0x10,%edi
+  801512:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  801519:	ff ff ff 
+  80151c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801520:	ff d0                	call   *%rax
+  801522:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801526:	c9                   	leave
+  801527:	c3                   	ret
+
+0000000000801528 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801528:	55                   	push   %rbp
+  801529:	48 89 e5             	mov    %rsp,%rbp
+  80152c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80152c <sys_time_msec+0x4>
+  801533:	49 bb 04 6b 00 00 00 	movabs $0x6b04,%r11
+  80153a:	00 00 00 
+  80153d:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  801540:	48 83 ec 08          	sub    $0x8,%rsp
+  801544:	6a 00                	push   $0x0
+  801546:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80154c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801552:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801557:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155c:	be 00 00 00 00       	mov    $0x0,%esi
+  801561:	bf 0e 00 00 00       	mov    $0xe,%edi
+  801566:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  80156d:	ff ff ff 
+  801570:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801574:	ff d0                	call   *%rax
+  801576:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80157a:	c9                   	leave
+  80157b:	c3                   	ret
+
+000000000080157c <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80157c:	55                   	push   %rbp
+  80157d:	48 89 e5             	mov    %rsp,%rbp
+  801580:	48 83 ec 10          	sub    $0x10,%rsp
+  801584:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801584 <sys_sleep_usec+0x8>
+  80158b:	49 bb ac 6a 00 00 00 	movabs $0x6aac,%r11
+  801592:	00 00 00 
+  801595:	4c 01 d8             	add    %r11,%rax
+  801598:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80159c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8015a4:	6a 00                	push   $0x0
+  8015a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8015ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bc:	bf 11 00 00 00       	mov    $0x11,%edi
+  8015c1:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  8015c8:	ff ff ff 
+  8015cb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8015cf:	ff d0                	call   *%rax
+  8015d1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8015d5:	c9                   	leave
+  8015d6:	c3                   	ret
+
+00000000008015d7 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8015d7:	55                   	push   %rbp
+  8015d8:	48 89 e5             	mov    %rsp,%rbp
+  8015db:	48 83 ec 10          	sub    $0x10,%rsp
+  8015df:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015df <sys_page_alloc_huge+0x8>
+  8015e6:	49 bb 51 6a 00 00 00 	movabs $0x6a51,%r11
+  8015ed:	00 00 00 
+  8015f0:	4c 01 d8             	add    %r11,%rax
+  8015f3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8015f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8015fa:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8015fd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801600:	48 63 f2             	movslq %edx,%rsi
+  801603:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801607:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80160a:	48 63 d2             	movslq %edx,%rdx
+  80160d:	48 83 ec 08          	sub    $0x8,%rsp
+  801611:	6a 00                	push   $0x0
+  801613:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801619:	49 89 f0             	mov    %rsi,%r8
+  80161c:	be 01 00 00 00       	mov    $0x1,%esi
+  801621:	bf 12 00 00 00       	mov    $0x12,%edi
+  801626:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  80162d:	ff ff ff 
+  801630:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801634:	ff d0                	call   *%rax
+  801636:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80163a:	c9                   	leave
+  80163b:	c3                   	ret
+
+000000000080163c <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80163c:	55                   	push   %rbp
+  80163d:	48 89 e5             	mov    %rsp,%rbp
+  801640:	48 83 ec 10          	sub    $0x10,%rsp
+  801644:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801644 <sys_page_map_batch+0x8>
+  80164b:	49 bb ec 69 00 00 00 	movabs $0x69ec,%r11
+  801652:	00 00 00 
+  801655:	4c 01 d8             	add    %r11,%rax
+  801658:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80165c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  801660:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801664:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801668:	48 83 ec 08          	sub    $0x8,%rsp
+  80166c:	6a 00                	push   $0x0
+  80166e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801674:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80167a:	be 01 00 00 00       	mov    $0x1,%esi
+  80167f:	bf 13 00 00 00       	mov    $0x13,%edi
+  801684:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  80168b:	ff ff ff 
+  80168e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801692:	ff d0                	call   *%rax
+  801694:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801698:	c9                   	leave
+  801699:	c3                   	ret
+
+000000000080169a <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80169a:	55                   	push   %rbp
+  80169b:	48 89 e5             	mov    %rsp,%rbp
+  80169e:	48 83 ec 10          	sub    $0x10,%rsp
+  8016a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016a2 <sys_page_alloc_batch+0x8>
+  8016a9:	49 bb 8e 69 00 00 00 	movabs $0x698e,%r11
+  8016b0:	00 00 00 
+  8016b3:	4c 01 d8             	add    %r11,%rax
+  8016b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8016be:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016c2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8016c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ca:	6a 00                	push   $0x0
+  8016cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8016d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8016dd:	bf 14 00 00 00       	mov    $0x14,%edi
+  8016e2:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  8016e9:	ff ff ff 
+  8016ec:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8016f0:	ff d0                	call   *%rax
+  8016f2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8016f6:	c9                   	leave
+  8016f7:	c3                   	ret
+
+00000000008016f8 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8016f8:	55                   	push   %rbp
+  8016f9:	48 89 e5             	mov    %rsp,%rbp
+  8016fc:	48 83 ec 10          	sub    $0x10,%rsp
+  801700:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801700 <sys_page_unmap_batch+0x8>
+  801707:	49 bb 30 69 00 00 00 	movabs $0x6930,%r11
+  80170e:	00 00 00 
+  801711:	4c 01 d8             	add    %r11,%rax
+  801714:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801718:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80171c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801720:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801724:	48 83 ec 08          	sub    $0x8,%rsp
+  801728:	6a 00                	push   $0x0
+  80172a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801730:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801736:	be 01 00 00 00       	mov    $0x1,%esi
+  80173b:	bf 15 00 00 00       	mov    $0x15,%edi
+  801740:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  801747:	ff ff ff 
+  80174a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80174e:	ff d0                	call   *%rax
+  801750:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801754:	c9                   	leave
+  801755:	c3                   	ret
+
+0000000000801756 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  801756:	55                   	push   %rbp
+  801757:	48 89 e5             	mov    %rsp,%rbp
+  80175a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80175a <sys_fork+0x4>
+  801761:	49 bb d6 68 00 00 00 	movabs $0x68d6,%r11
+  801768:	00 00 00 
+  80176b:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80176e:	48 83 ec 08          	sub    $0x8,%rsp
+  801772:	6a 00                	push   $0x0
+  801774:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80177a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801780:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801785:	ba 00 00 00 00       	mov    $0x0,%edx
+  80178a:	be 00 00 00 00       	mov    $0x0,%esi
+  80178f:	bf 16 00 00 00       	mov    $0x16,%edi
+  801794:	49 ba b0 8b ff ff ff 	movabs $0xffffffffffff8bb0,%r10
+  80179b:	ff ff ff 
+  80179e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8017a2:	ff d0                	call   *%rax
+  8017a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8017a8:	c9                   	leave
+  8017a9:	c3                   	ret
+
+00000000008017aa <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  8017aa:	55                   	push   %rbp
+  8017ab:	48 89 e5             	mov    %rsp,%rbp
+  8017ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8017b2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017b2 <fd2num+0x8>
+  8017b9:	49 bb 7e 68 00 00 00 	movabs $0x687e,%r11
+  8017c0:	00 00 00 
+  8017c3:	4c 01 d8             	add    %r11,%rax
+  8017c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8017ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ce:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8017d5:	ff ff ff 
+  8017d8:	48 01 d0             	add    %rdx,%rax
+  8017db:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017df:	c9                   	leave
+  8017e0:	c3                   	ret
+
+00000000008017e1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8017e1:	55                   	push   %rbp
+  8017e2:	48 89 e5             	mov    %rsp,%rbp
+  8017e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e9 <fd2data+0x8>
+  8017f0:	49 bb 47 68 00 00 00 	movabs $0x6847,%r11
+  8017f7:	00 00 00 
+  8017fa:	4c 01 d8             	add    %r11,%rax
+  8017fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  801801:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801805:	48 89 d7             	mov    %rdx,%rdi
+  801808:	48 ba 7a 97 ff ff ff 	movabs $0xffffffffffff977a,%rdx
+  80180f:	ff ff ff 
+  801812:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  801816:	ff d0                	call   *%rax
+  801818:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80181e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801822:	c9                   	leave
+  801823:	c3                   	ret
+
+0000000000801824 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801824:	55                   	push   %rbp
+  801825:	48 89 e5             	mov    %rsp,%rbp
+  801828:	48 83 ec 18          	sub    $0x18,%rsp
+  80182c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80182c <fd_alloc+0x8>
+  801833:	49 bb 04 68 00 00 00 	movabs $0x6804,%r11
+  80183a:	00 00 00 
+  80183d:	4c 01 d8             	add    %r11,%rax
+  801840:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801844:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80184b:	eb 75                	jmp    8018c2 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  80184d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801850:	48 63 d2             	movslq %edx,%rdx
+  801853:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  80185a:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80185e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801862:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801866:	48 89 d1             	mov    %rdx,%rcx
+  801869:	48 c1 e9 15          	shr    $0x15,%rcx
+  80186d:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  801874:	ff ff ff 
+  801877:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80187b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80187f:	83 e2 01             	and    $0x1,%edx
+  801882:	48 85 d2             	test   %rdx,%rdx
+  801885:	74 25                	je     8018ac <fd_alloc+0x88>
+  801887:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80188b:	48 89 d1             	mov    %rdx,%rcx
+  80188e:	48 c1 e9 0c          	shr    $0xc,%rcx
+  801892:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  801899:	ff ff ff 
+  80189c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8018a0:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8018a4:	83 e2 01             	and    $0x1,%edx
+  8018a7:	48 85 d2             	test   %rdx,%rdx
+  8018aa:	75 12                	jne    8018be <fd_alloc+0x9a>
+			*fd_store = fd;
+  8018ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8018b4:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8018b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018bc:	eb 1a                	jmp    8018d8 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  8018be:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8018c2:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8018c6:	7e 85                	jle    80184d <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  8018c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018cc:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  8018d3:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  8018d8:	c9                   	leave
+  8018d9:	c3                   	ret
+
+00000000008018da <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018da:	55                   	push   %rbp
+  8018db:	48 89 e5             	mov    %rsp,%rbp
+  8018de:	48 83 ec 20          	sub    $0x20,%rsp
+  8018e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018e2 <fd_lookup+0x8>
+  8018e9:	49 bb 4e 67 00 00 00 	movabs $0x674e,%r11
+  8018f0:	00 00 00 
+  8018f3:	4c 01 d8             	add    %r11,%rax
+  8018f6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8018f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8018fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801901:	78 06                	js     801909 <fd_lookup+0x2f>
+  801903:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  801907:	7e 07                	jle    801910 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  801909:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80190e:	eb 73                	jmp    801983 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  801910:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801913:	48 63 d2             	movslq %edx,%rdx
+  801916:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  80191d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  801921:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801925:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801929:	48 89 d1             	mov    %rdx,%rcx
+  80192c:	48 c1 e9 15          	shr    $0x15,%rcx
+  801930:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  801937:	ff ff ff 
+  80193a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80193e:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  801942:	83 e2 01             	and    $0x1,%edx
+  801945:	48 85 d2             	test   %rdx,%rdx
+  801948:	74 22                	je     80196c <fd_lookup+0x92>
+  80194a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80194e:	48 c1 ea 0c          	shr    $0xc,%rdx
+  801952:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  801959:	ff ff ff 
+  80195c:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  801960:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801964:	83 e0 01             	and    $0x1,%eax
+  801967:	48 85 c0             	test   %rax,%rax
+  80196a:	75 07                	jne    801973 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80196c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801971:	eb 10                	jmp    801983 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  801973:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801977:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80197b:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  80197e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801983:	c9                   	leave
+  801984:	c3                   	ret
+
+0000000000801985 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  801985:	55                   	push   %rbp
+  801986:	48 89 e5             	mov    %rsp,%rbp
+  801989:	41 57                	push   %r15
+  80198b:	53                   	push   %rbx
+  80198c:	48 83 ec 30          	sub    $0x30,%rsp
+  801990:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801990 <fd_close+0xb>
+  801997:	49 bb a0 66 00 00 00 	movabs $0x66a0,%r11
+  80199e:	00 00 00 
+  8019a1:	4c 01 db             	add    %r11,%rbx
+  8019a4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8019a8:	89 f0                	mov    %esi,%eax
+  8019aa:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019b1:	48 89 c7             	mov    %rax,%rdi
+  8019b4:	48 b8 7a 97 ff ff ff 	movabs $0xffffffffffff977a,%rax
+  8019bb:	ff ff ff 
+  8019be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8019c2:	ff d0                	call   *%rax
+  8019c4:	89 c2                	mov    %eax,%edx
+  8019c6:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8019ca:	48 89 c6             	mov    %rax,%rsi
+  8019cd:	89 d7                	mov    %edx,%edi
+  8019cf:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  8019d6:	ff ff ff 
+  8019d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8019dd:	ff d0                	call   *%rax
+  8019df:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8019e6:	78 0a                	js     8019f2 <fd_close+0x6d>
+	    || fd != fd2)
+  8019e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019ec:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  8019f0:	74 12                	je     801a04 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  8019f2:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8019f6:	74 05                	je     8019fd <fd_close+0x78>
+  8019f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019fb:	eb 7a                	jmp    801a77 <fd_close+0xf2>
+  8019fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a02:	eb 73                	jmp    801a77 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a08:	8b 00                	mov    (%rax),%eax
+  801a0a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801a0e:	48 89 d6             	mov    %rdx,%rsi
+  801a11:	89 c7                	mov    %eax,%edi
+  801a13:	48 b8 50 9a ff ff ff 	movabs $0xffffffffffff9a50,%rax
+  801a1a:	ff ff ff 
+  801a1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a21:	ff d0                	call   *%rax
+  801a23:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a26:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801a2a:	78 2a                	js     801a56 <fd_close+0xd1>
+		if (dev->dev_close)
+  801a2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a30:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a34:	48 85 c0             	test   %rax,%rax
+  801a37:	74 16                	je     801a4f <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  801a39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a3d:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  801a41:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a45:	48 89 c7             	mov    %rax,%rdi
+  801a48:	ff d2                	call   *%rdx
+  801a4a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a4d:	eb 07                	jmp    801a56 <fd_close+0xd1>
+		else
+			r = 0;
+  801a4f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  801a56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a5a:	48 89 c6             	mov    %rax,%rsi
+  801a5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a62:	49 89 df             	mov    %rbx,%r15
+  801a65:	48 b8 a9 90 ff ff ff 	movabs $0xffffffffffff90a9,%rax
+  801a6c:	ff ff ff 
+  801a6f:	48 01 d8             	add    %rbx,%rax
+  801a72:	ff d0                	call   *%rax
+	return r;
+  801a74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  801a77:	48 83 c4 30          	add    $0x30,%rsp
+  801a7b:	5b                   	pop    %rbx
+  801a7c:	41 5f                	pop    %r15
+  801a7e:	5d                   	pop    %rbp
+  801a7f:	c3                   	ret
+
+0000000000801a80 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a80:	55                   	push   %rbp
+  801a81:	48 89 e5             	mov    %rsp,%rbp
+  801a84:	41 57                	push   %r15
+  801a86:	48 83 ec 28          	sub    $0x28,%rsp
+  801a8a:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 801a8a <dev_lookup+0xa>
+  801a91:	49 bb a6 65 00 00 00 	movabs $0x65a6,%r11
+  801a98:	00 00 00 
+  801a9b:	4c 01 d9             	add    %r11,%rcx
+  801a9e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801aa1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801aa5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801aac:	eb 45                	jmp    801af3 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  801aae:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  801ab5:	00 00 00 
+  801ab8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801abb:	48 98                	cltq
+  801abd:	48 01 ca             	add    %rcx,%rdx
+  801ac0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801ac4:	8b 00                	mov    (%rax),%eax
+  801ac6:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  801ac9:	75 24                	jne    801aef <dev_lookup+0x6f>
+			*dev = devtab[i];
+  801acb:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  801ad2:	00 00 00 
+  801ad5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ad8:	48 98                	cltq
+  801ada:	48 01 ca             	add    %rcx,%rdx
+  801add:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801ae1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae5:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aed:	eb 74                	jmp    801b63 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  801aef:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  801af3:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  801afa:	00 00 00 
+  801afd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b00:	48 98                	cltq
+  801b02:	48 01 ca             	add    %rcx,%rdx
+  801b05:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b09:	48 85 c0             	test   %rax,%rax
+  801b0c:	75 a0                	jne    801aae <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b0e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801b15:	ff ff ff 
+  801b18:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  801b1c:	48 8b 00             	mov    (%rax),%rax
+  801b1f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801b25:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801b28:	89 c6                	mov    %eax,%esi
+  801b2a:	48 b8 48 df ff ff ff 	movabs $0xffffffffffffdf48,%rax
+  801b31:	ff ff ff 
+  801b34:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  801b38:	48 89 c7             	mov    %rax,%rdi
+  801b3b:	49 89 cf             	mov    %rcx,%r15
+  801b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b43:	49 b8 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%r8
+  801b4a:	ff ff ff 
+  801b4d:	49 01 c8             	add    %rcx,%r8
+  801b50:	41 ff d0             	call   *%r8
+	*dev = 0;
+  801b53:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b57:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  801b5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b63:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  801b67:	c9                   	leave
+  801b68:	c3                   	ret
+
+0000000000801b69 <close>:
+
+int
+close(int fdnum)
+{
+  801b69:	55                   	push   %rbp
+  801b6a:	48 89 e5             	mov    %rsp,%rbp
+  801b6d:	53                   	push   %rbx
+  801b6e:	48 83 ec 28          	sub    $0x28,%rsp
+  801b72:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801b72 <close+0x9>
+  801b79:	49 bb be 64 00 00 00 	movabs $0x64be,%r11
+  801b80:	00 00 00 
+  801b83:	4c 01 db             	add    %r11,%rbx
+  801b86:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b89:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801b8d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b90:	48 89 d6             	mov    %rdx,%rsi
+  801b93:	89 c7                	mov    %eax,%edi
+  801b95:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  801b9c:	ff ff ff 
+  801b9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ba3:	ff d0                	call   *%rax
+  801ba5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ba8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801bac:	79 05                	jns    801bb3 <close+0x4a>
+		return r;
+  801bae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801bb1:	eb 1c                	jmp    801bcf <close+0x66>
+	else
+		return fd_close(fd, 1);
+  801bb3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bb7:	be 01 00 00 00       	mov    $0x1,%esi
+  801bbc:	48 89 c7             	mov    %rax,%rdi
+  801bbf:	48 b8 55 99 ff ff ff 	movabs $0xffffffffffff9955,%rax
+  801bc6:	ff ff ff 
+  801bc9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801bcd:	ff d0                	call   *%rax
+}
+  801bcf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bd3:	c9                   	leave
+  801bd4:	c3                   	ret
+
+0000000000801bd5 <close_all>:
+
+void
+close_all(void)
+{
+  801bd5:	55                   	push   %rbp
+  801bd6:	48 89 e5             	mov    %rsp,%rbp
+  801bd9:	53                   	push   %rbx
+  801bda:	48 83 ec 18          	sub    $0x18,%rsp
+  801bde:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801bde <close_all+0x9>
+  801be5:	49 bb 52 64 00 00 00 	movabs $0x6452,%r11
+  801bec:	00 00 00 
+  801bef:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801bf2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801bf9:	eb 19                	jmp    801c14 <close_all+0x3f>
+		close(i);
+  801bfb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801bfe:	89 c7                	mov    %eax,%edi
+  801c00:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  801c07:	ff ff ff 
+  801c0a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c0e:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  801c10:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  801c14:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  801c18:	7e e1                	jle    801bfb <close_all+0x26>
+}
+  801c1a:	90                   	nop
+  801c1b:	90                   	nop
+  801c1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c20:	c9                   	leave
+  801c21:	c3                   	ret
+
+0000000000801c22 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c22:	55                   	push   %rbp
+  801c23:	48 89 e5             	mov    %rsp,%rbp
+  801c26:	41 57                	push   %r15
+  801c28:	53                   	push   %rbx
+  801c29:	48 83 ec 40          	sub    $0x40,%rsp
+  801c2d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801c2d <dup+0xb>
+  801c34:	49 bb 03 64 00 00 00 	movabs $0x6403,%r11
+  801c3b:	00 00 00 
+  801c3e:	4c 01 db             	add    %r11,%rbx
+  801c41:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801c44:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c47:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801c4b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801c4e:	48 89 d6             	mov    %rdx,%rsi
+  801c51:	89 c7                	mov    %eax,%edi
+  801c53:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  801c5a:	ff ff ff 
+  801c5d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c61:	ff d0                	call   *%rax
+  801c63:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c66:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801c6a:	79 08                	jns    801c74 <dup+0x52>
+		return r;
+  801c6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c6f:	e9 a4 01 00 00       	jmp    801e18 <dup+0x1f6>
+	close(newfdnum);
+  801c74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c77:	89 c7                	mov    %eax,%edi
+  801c79:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  801c80:	ff ff ff 
+  801c83:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c87:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  801c89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c8c:	48 98                	cltq
+  801c8e:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801c94:	48 c1 e0 0c          	shl    $0xc,%rax
+  801c98:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  801c9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ca0:	48 89 c7             	mov    %rax,%rdi
+  801ca3:	48 b8 b1 97 ff ff ff 	movabs $0xffffffffffff97b1,%rax
+  801caa:	ff ff ff 
+  801cad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801cb1:	ff d0                	call   *%rax
+  801cb3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  801cb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cbb:	48 89 c7             	mov    %rax,%rdi
+  801cbe:	48 b8 b1 97 ff ff ff 	movabs $0xffffffffffff97b1,%rax
+  801cc5:	ff ff ff 
+  801cc8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ccc:	ff d0                	call   *%rax
+  801cce:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801cd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd6:	48 c1 e8 15          	shr    $0x15,%rax
+  801cda:	48 89 c2             	mov    %rax,%rdx
+  801cdd:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  801ce4:	ff ff ff 
+  801ce7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801ceb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801cef:	83 e0 01             	and    $0x1,%eax
+  801cf2:	48 85 c0             	test   %rax,%rax
+  801cf5:	74 7f                	je     801d76 <dup+0x154>
+  801cf7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cfb:	48 c1 e8 0c          	shr    $0xc,%rax
+  801cff:	48 89 c2             	mov    %rax,%rdx
+  801d02:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  801d09:	ff ff ff 
+  801d0c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801d10:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801d14:	83 e0 01             	and    $0x1,%eax
+  801d17:	48 85 c0             	test   %rax,%rax
+  801d1a:	74 5a                	je     801d76 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801d1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d20:	48 c1 e8 0c          	shr    $0xc,%rax
+  801d24:	48 89 c2             	mov    %rax,%rdx
+  801d27:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  801d2e:	ff ff ff 
+  801d31:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801d35:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801d39:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d3e:	89 c1                	mov    %eax,%ecx
+  801d40:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801d44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d48:	41 89 c8             	mov    %ecx,%r8d
+  801d4b:	48 89 d1             	mov    %rdx,%rcx
+  801d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d53:	48 89 c6             	mov    %rax,%rsi
+  801d56:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5b:	49 89 df             	mov    %rbx,%r15
+  801d5e:	48 b8 36 90 ff ff ff 	movabs $0xffffffffffff9036,%rax
+  801d65:	ff ff ff 
+  801d68:	48 01 d8             	add    %rbx,%rax
+  801d6b:	ff d0                	call   *%rax
+  801d6d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d70:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801d74:	78 5f                	js     801dd5 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801d76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d7a:	48 c1 e8 0c          	shr    $0xc,%rax
+  801d7e:	48 89 c2             	mov    %rax,%rdx
+  801d81:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  801d88:	ff ff ff 
+  801d8b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801d8f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801d93:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d98:	89 c1                	mov    %eax,%ecx
+  801d9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d9e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801da2:	41 89 c8             	mov    %ecx,%r8d
+  801da5:	48 89 d1             	mov    %rdx,%rcx
+  801da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dad:	48 89 c6             	mov    %rax,%rsi
+  801db0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db5:	49 89 df             	mov    %rbx,%r15
+  801db8:	48 b8 36 90 ff ff ff 	movabs $0xffffffffffff9036,%rax
+  801dbf:	ff ff ff 
+  801dc2:	48 01 d8             	add    %rbx,%rax
+  801dc5:	ff d0                	call   *%rax
+  801dc7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801dca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801dce:	78 08                	js     801dd8 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  801dd0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dd3:	eb 43                	jmp    801e18 <dup+0x1f6>
+			goto err;
+  801dd5:	90                   	nop
+  801dd6:	eb 01                	jmp    801dd9 <dup+0x1b7>
+		goto err;
+  801dd8:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  801dd9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ddd:	48 89 c6             	mov    %rax,%rsi
+  801de0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de5:	49 89 df             	mov    %rbx,%r15
+  801de8:	48 b8 a9 90 ff ff ff 	movabs $0xffffffffffff90a9,%rax
+  801def:	ff ff ff 
+  801df2:	48 01 d8             	add    %rbx,%rax
+  801df5:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  801df7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dfb:	48 89 c6             	mov    %rax,%rsi
+  801dfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e03:	49 89 df             	mov    %rbx,%r15
+  801e06:	48 b8 a9 90 ff ff ff 	movabs $0xffffffffffff90a9,%rax
+  801e0d:	ff ff ff 
+  801e10:	48 01 d8             	add    %rbx,%rax
+  801e13:	ff d0                	call   *%rax
+	return r;
+  801e15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  801e18:	48 83 c4 40          	add    $0x40,%rsp
+  801e1c:	5b                   	pop    %rbx
+  801e1d:	41 5f                	pop    %r15
+  801e1f:	5d                   	pop    %rbp
+  801e20:	c3                   	ret
+
+0000000000801e21 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801e21:	55                   	push   %rbp
+  801e22:	48 89 e5             	mov    %rsp,%rbp
+  801e25:	41 57                	push   %r15
+  801e27:	53                   	push   %rbx
+  801e28:	48 83 ec 40          	sub    $0x40,%rsp
+  801e2c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801e2c <read+0xb>
+  801e33:	49 bb 04 62 00 00 00 	movabs $0x6204,%r11
+  801e3a:	00 00 00 
+  801e3d:	4c 01 db             	add    %r11,%rbx
+  801e40:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801e43:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801e47:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e4b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801e4f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e52:	48 89 d6             	mov    %rdx,%rsi
+  801e55:	89 c7                	mov    %eax,%edi
+  801e57:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  801e5e:	ff ff ff 
+  801e61:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e65:	ff d0                	call   *%rax
+  801e67:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e6a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801e6e:	78 28                	js     801e98 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e74:	8b 00                	mov    (%rax),%eax
+  801e76:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801e7a:	48 89 d6             	mov    %rdx,%rsi
+  801e7d:	89 c7                	mov    %eax,%edi
+  801e7f:	48 b8 50 9a ff ff ff 	movabs $0xffffffffffff9a50,%rax
+  801e86:	ff ff ff 
+  801e89:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e8d:	ff d0                	call   *%rax
+  801e8f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e92:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801e96:	79 08                	jns    801ea0 <read+0x7f>
+		return r;
+  801e98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e9b:	e9 8b 00 00 00       	jmp    801f2b <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ea0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ea4:	8b 40 08             	mov    0x8(%rax),%eax
+  801ea7:	83 e0 03             	and    $0x3,%eax
+  801eaa:	83 f8 01             	cmp    $0x1,%eax
+  801ead:	75 4b                	jne    801efa <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eaf:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801eb6:	ff ff ff 
+  801eb9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801ebd:	48 8b 00             	mov    (%rax),%rax
+  801ec0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801ec6:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  801ec9:	89 c6                	mov    %eax,%esi
+  801ecb:	48 b8 67 df ff ff ff 	movabs $0xffffffffffffdf67,%rax
+  801ed2:	ff ff ff 
+  801ed5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ed9:	48 89 c7             	mov    %rax,%rdi
+  801edc:	49 89 df             	mov    %rbx,%r15
+  801edf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee4:	48 b9 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%rcx
+  801eeb:	ff ff ff 
+  801eee:	48 01 d9             	add    %rbx,%rcx
+  801ef1:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  801ef3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef8:	eb 31                	jmp    801f2b <read+0x10a>
+	}
+	if (!dev->dev_read)
+  801efa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801efe:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f02:	48 85 c0             	test   %rax,%rax
+  801f05:	75 07                	jne    801f0e <read+0xed>
+		return -E_NOT_SUPP;
+  801f07:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  801f0c:	eb 1d                	jmp    801f2b <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  801f0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f12:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  801f16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f1a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801f1e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801f22:	48 89 ce             	mov    %rcx,%rsi
+  801f25:	48 89 c7             	mov    %rax,%rdi
+  801f28:	41 ff d0             	call   *%r8
+}
+  801f2b:	48 83 c4 40          	add    $0x40,%rsp
+  801f2f:	5b                   	pop    %rbx
+  801f30:	41 5f                	pop    %r15
+  801f32:	5d                   	pop    %rbp
+  801f33:	c3                   	ret
+
+0000000000801f34 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f34:	55                   	push   %rbp
+  801f35:	48 89 e5             	mov    %rsp,%rbp
+  801f38:	53                   	push   %rbx
+  801f39:	48 83 ec 38          	sub    $0x38,%rsp
+  801f3d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801f3d <readn+0x9>
+  801f44:	49 bb f3 60 00 00 00 	movabs $0x60f3,%r11
+  801f4b:	00 00 00 
+  801f4e:	4c 01 db             	add    %r11,%rbx
+  801f51:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801f54:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f58:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f5c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801f63:	eb 4b                	jmp    801fb0 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f68:	48 98                	cltq
+  801f6a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f6e:	48 29 c2             	sub    %rax,%rdx
+  801f71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f74:	48 63 c8             	movslq %eax,%rcx
+  801f77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f7b:	48 01 c1             	add    %rax,%rcx
+  801f7e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f81:	48 89 ce             	mov    %rcx,%rsi
+  801f84:	89 c7                	mov    %eax,%edi
+  801f86:	48 b8 f1 9d ff ff ff 	movabs $0xffffffffffff9df1,%rax
+  801f8d:	ff ff ff 
+  801f90:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f94:	ff d0                	call   *%rax
+  801f96:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  801f99:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  801f9d:	79 05                	jns    801fa4 <readn+0x70>
+			return m;
+  801f9f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801fa2:	eb 1d                	jmp    801fc1 <readn+0x8d>
+		if (m == 0)
+  801fa4:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  801fa8:	74 13                	je     801fbd <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  801faa:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801fad:	01 45 ec             	add    %eax,-0x14(%rbp)
+  801fb0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fb3:	48 98                	cltq
+  801fb5:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  801fb9:	72 aa                	jb     801f65 <readn+0x31>
+  801fbb:	eb 01                	jmp    801fbe <readn+0x8a>
+			break;
+  801fbd:	90                   	nop
+	}
+	return tot;
+  801fbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  801fc1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fc5:	c9                   	leave
+  801fc6:	c3                   	ret
+
+0000000000801fc7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801fc7:	55                   	push   %rbp
+  801fc8:	48 89 e5             	mov    %rsp,%rbp
+  801fcb:	41 57                	push   %r15
+  801fcd:	53                   	push   %rbx
+  801fce:	48 83 ec 40          	sub    $0x40,%rsp
+  801fd2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801fd2 <write+0xb>
+  801fd9:	49 bb 5e 60 00 00 00 	movabs $0x605e,%r11
+  801fe0:	00 00 00 
+  801fe3:	4c 01 db             	add    %r11,%rbx
+  801fe6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801fe9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801fed:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ff1:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801ff5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801ff8:	48 89 d6             	mov    %rdx,%rsi
+  801ffb:	89 c7                	mov    %eax,%edi
+  801ffd:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  802004:	ff ff ff 
+  802007:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80200b:	ff d0                	call   *%rax
+  80200d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802010:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802014:	78 28                	js     80203e <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802016:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80201a:	8b 00                	mov    (%rax),%eax
+  80201c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802020:	48 89 d6             	mov    %rdx,%rsi
+  802023:	89 c7                	mov    %eax,%edi
+  802025:	48 b8 50 9a ff ff ff 	movabs $0xffffffffffff9a50,%rax
+  80202c:	ff ff ff 
+  80202f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802033:	ff d0                	call   *%rax
+  802035:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802038:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80203c:	79 08                	jns    802046 <write+0x7f>
+		return r;
+  80203e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802041:	e9 8a 00 00 00       	jmp    8020d0 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802046:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80204a:	8b 40 08             	mov    0x8(%rax),%eax
+  80204d:	83 e0 03             	and    $0x3,%eax
+  802050:	85 c0                	test   %eax,%eax
+  802052:	75 4b                	jne    80209f <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802054:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80205b:	ff ff ff 
+  80205e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802062:	48 8b 00             	mov    (%rax),%rax
+  802065:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80206b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80206e:	89 c6                	mov    %eax,%esi
+  802070:	48 b8 83 df ff ff ff 	movabs $0xffffffffffffdf83,%rax
+  802077:	ff ff ff 
+  80207a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80207e:	48 89 c7             	mov    %rax,%rdi
+  802081:	49 89 df             	mov    %rbx,%r15
+  802084:	b8 00 00 00 00       	mov    $0x0,%eax
+  802089:	48 b9 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%rcx
+  802090:	ff ff ff 
+  802093:	48 01 d9             	add    %rbx,%rcx
+  802096:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802098:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80209d:	eb 31                	jmp    8020d0 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80209f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020a3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8020a7:	48 85 c0             	test   %rax,%rax
+  8020aa:	75 07                	jne    8020b3 <write+0xec>
+		return -E_NOT_SUPP;
+  8020ac:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8020b1:	eb 1d                	jmp    8020d0 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  8020b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020b7:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8020bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020bf:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8020c3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020c7:	48 89 ce             	mov    %rcx,%rsi
+  8020ca:	48 89 c7             	mov    %rax,%rdi
+  8020cd:	41 ff d0             	call   *%r8
+}
+  8020d0:	48 83 c4 40          	add    $0x40,%rsp
+  8020d4:	5b                   	pop    %rbx
+  8020d5:	41 5f                	pop    %r15
+  8020d7:	5d                   	pop    %rbp
+  8020d8:	c3                   	ret
+
+00000000008020d9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8020d9:	55                   	push   %rbp
+  8020da:	48 89 e5             	mov    %rsp,%rbp
+  8020dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8020e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020e1 <seek+0x8>
+  8020e8:	49 bb 4f 5f 00 00 00 	movabs $0x5f4f,%r11
+  8020ef:	00 00 00 
+  8020f2:	4c 01 d8             	add    %r11,%rax
+  8020f5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8020f8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020fb:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8020ff:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802102:	48 89 ce             	mov    %rcx,%rsi
+  802105:	89 d7                	mov    %edx,%edi
+  802107:	48 ba aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rdx
+  80210e:	ff ff ff 
+  802111:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802115:	ff d0                	call   *%rax
+  802117:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80211a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80211e:	79 05                	jns    802125 <seek+0x4c>
+		return r;
+  802120:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802123:	eb 0f                	jmp    802134 <seek+0x5b>
+	fd->fd_offset = offset;
+  802125:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802129:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80212c:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  80212f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802134:	c9                   	leave
+  802135:	c3                   	ret
+
+0000000000802136 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802136:	55                   	push   %rbp
+  802137:	48 89 e5             	mov    %rsp,%rbp
+  80213a:	41 57                	push   %r15
+  80213c:	53                   	push   %rbx
+  80213d:	48 83 ec 30          	sub    $0x30,%rsp
+  802141:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802141 <ftruncate+0xb>
+  802148:	49 bb ef 5e 00 00 00 	movabs $0x5eef,%r11
+  80214f:	00 00 00 
+  802152:	4c 01 db             	add    %r11,%rbx
+  802155:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802158:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80215b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80215f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802162:	48 89 d6             	mov    %rdx,%rsi
+  802165:	89 c7                	mov    %eax,%edi
+  802167:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  80216e:	ff ff ff 
+  802171:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802175:	ff d0                	call   *%rax
+  802177:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80217a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80217e:	78 28                	js     8021a8 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802180:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802184:	8b 00                	mov    (%rax),%eax
+  802186:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80218a:	48 89 d6             	mov    %rdx,%rsi
+  80218d:	89 c7                	mov    %eax,%edi
+  80218f:	48 b8 50 9a ff ff ff 	movabs $0xffffffffffff9a50,%rax
+  802196:	ff ff ff 
+  802199:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80219d:	ff d0                	call   *%rax
+  80219f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8021a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8021a6:	79 08                	jns    8021b0 <ftruncate+0x7a>
+		return r;
+  8021a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021ab:	e9 83 00 00 00       	jmp    802233 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021b4:	8b 40 08             	mov    0x8(%rax),%eax
+  8021b7:	83 e0 03             	and    $0x3,%eax
+  8021ba:	85 c0                	test   %eax,%eax
+  8021bc:	75 4b                	jne    802209 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8021be:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8021c5:	ff ff ff 
+  8021c8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8021cc:	48 8b 00             	mov    (%rax),%rax
+  8021cf:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021d5:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8021d8:	89 c6                	mov    %eax,%esi
+  8021da:	48 b8 a0 df ff ff ff 	movabs $0xffffffffffffdfa0,%rax
+  8021e1:	ff ff ff 
+  8021e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8021e8:	48 89 c7             	mov    %rax,%rdi
+  8021eb:	49 89 df             	mov    %rbx,%r15
+  8021ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f3:	48 b9 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%rcx
+  8021fa:	ff ff ff 
+  8021fd:	48 01 d9             	add    %rbx,%rcx
+  802200:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802202:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802207:	eb 2a                	jmp    802233 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  802209:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80220d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802211:	48 85 c0             	test   %rax,%rax
+  802214:	75 07                	jne    80221d <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  802216:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80221b:	eb 16                	jmp    802233 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  80221d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802221:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  802225:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802229:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80222c:	89 d6                	mov    %edx,%esi
+  80222e:	48 89 c7             	mov    %rax,%rdi
+  802231:	ff d1                	call   *%rcx
+}
+  802233:	48 83 c4 30          	add    $0x30,%rsp
+  802237:	5b                   	pop    %rbx
+  802238:	41 5f                	pop    %r15
+  80223a:	5d                   	pop    %rbp
+  80223b:	c3                   	ret
+
+000000000080223c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80223c:	55                   	push   %rbp
+  80223d:	48 89 e5             	mov    %rsp,%rbp
+  802240:	53                   	push   %rbx
+  802241:	48 83 ec 38          	sub    $0x38,%rsp
+  802245:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802245 <fstat+0x9>
+  80224c:	49 bb eb 5d 00 00 00 	movabs $0x5deb,%r11
+  802253:	00 00 00 
+  802256:	4c 01 db             	add    %r11,%rbx
+  802259:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80225c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802260:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802264:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802267:	48 89 d6             	mov    %rdx,%rsi
+  80226a:	89 c7                	mov    %eax,%edi
+  80226c:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  802273:	ff ff ff 
+  802276:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80227a:	ff d0                	call   *%rax
+  80227c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80227f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802283:	78 28                	js     8022ad <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802285:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802289:	8b 00                	mov    (%rax),%eax
+  80228b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80228f:	48 89 d6             	mov    %rdx,%rsi
+  802292:	89 c7                	mov    %eax,%edi
+  802294:	48 b8 50 9a ff ff ff 	movabs $0xffffffffffff9a50,%rax
+  80229b:	ff ff ff 
+  80229e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8022a2:	ff d0                	call   *%rax
+  8022a4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8022a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8022ab:	79 05                	jns    8022b2 <fstat+0x76>
+		return r;
+  8022ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022b0:	eb 5e                	jmp    802310 <fstat+0xd4>
+	if (!dev->dev_stat)
+  8022b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022b6:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8022ba:	48 85 c0             	test   %rax,%rax
+  8022bd:	75 07                	jne    8022c6 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8022bf:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8022c4:	eb 4a                	jmp    802310 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8022c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022ca:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8022cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022d1:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8022d8:	00 00 00 
+	stat->st_isdir = 0;
+  8022db:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022df:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8022e6:	00 00 00 
+	stat->st_dev = dev;
+  8022e9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8022ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022f1:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8022f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022fc:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  802300:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802304:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802308:	48 89 d6             	mov    %rdx,%rsi
+  80230b:	48 89 c7             	mov    %rax,%rdi
+  80230e:	ff d1                	call   *%rcx
+}
+  802310:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802314:	c9                   	leave
+  802315:	c3                   	ret
+
+0000000000802316 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802316:	55                   	push   %rbp
+  802317:	48 89 e5             	mov    %rsp,%rbp
+  80231a:	41 57                	push   %r15
+  80231c:	53                   	push   %rbx
+  80231d:	48 83 ec 20          	sub    $0x20,%rsp
+  802321:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802321 <stat+0xb>
+  802328:	49 bb 0f 5d 00 00 00 	movabs $0x5d0f,%r11
+  80232f:	00 00 00 
+  802332:	4c 01 db             	add    %r11,%rbx
+  802335:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802339:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80233d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802341:	be 00 00 00 00       	mov    $0x0,%esi
+  802346:	48 89 c7             	mov    %rax,%rdi
+  802349:	49 89 df             	mov    %rbx,%r15
+  80234c:	48 b8 c0 a5 ff ff ff 	movabs $0xffffffffffffa5c0,%rax
+  802353:	ff ff ff 
+  802356:	48 01 d8             	add    %rbx,%rax
+  802359:	ff d0                	call   *%rax
+  80235b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80235e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802362:	79 05                	jns    802369 <stat+0x53>
+		return fd;
+  802364:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802367:	eb 37                	jmp    8023a0 <stat+0x8a>
+	r = fstat(fd, stat);
+  802369:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80236d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802370:	48 89 d6             	mov    %rdx,%rsi
+  802373:	89 c7                	mov    %eax,%edi
+  802375:	48 b8 0c a2 ff ff ff 	movabs $0xffffffffffffa20c,%rax
+  80237c:	ff ff ff 
+  80237f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802383:	ff d0                	call   *%rax
+  802385:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  802388:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80238b:	89 c7                	mov    %eax,%edi
+  80238d:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  802394:	ff ff ff 
+  802397:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80239b:	ff d0                	call   *%rax
+	return r;
+  80239d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8023a0:	48 83 c4 20          	add    $0x20,%rsp
+  8023a4:	5b                   	pop    %rbx
+  8023a5:	41 5f                	pop    %r15
+  8023a7:	5d                   	pop    %rbp
+  8023a8:	c3                   	ret
+
+00000000008023a9 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8023a9:	55                   	push   %rbp
+  8023aa:	48 89 e5             	mov    %rsp,%rbp
+  8023ad:	41 57                	push   %r15
+  8023af:	53                   	push   %rbx
+  8023b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8023b4 <fsipc+0xb>
+  8023bb:	49 bb 7c 5c 00 00 00 	movabs $0x5c7c,%r11
+  8023c2:	00 00 00 
+  8023c5:	4c 01 db             	add    %r11,%rbx
+  8023c8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8023cb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8023cf:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8023d6:	00 00 00 
+  8023d9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8023dc:	85 c0                	test   %eax,%eax
+  8023de:	75 24                	jne    802404 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023e0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023e5:	49 89 df             	mov    %rbx,%r15
+  8023e8:	48 b8 c5 dd ff ff ff 	movabs $0xffffffffffffddc5,%rax
+  8023ef:	ff ff ff 
+  8023f2:	48 01 d8             	add    %rbx,%rax
+  8023f5:	ff d0                	call   *%rax
+  8023f7:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8023fe:	00 00 00 
+  802401:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  802404:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80240b:	00 00 00 
+  80240e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802411:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802415:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802418:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80241e:	49 89 d0             	mov    %rdx,%r8
+  802421:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802426:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  80242d:	00 00 00 
+  802430:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  802434:	89 c7                	mov    %eax,%edi
+  802436:	49 89 df             	mov    %rbx,%r15
+  802439:	48 b8 e4 d7 ff ff ff 	movabs $0xffffffffffffd7e4,%rax
+  802440:	ff ff ff 
+  802443:	48 01 d8             	add    %rbx,%rax
+  802446:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  802448:	48 83 c4 10          	add    $0x10,%rsp
+  80244c:	5b                   	pop    %rbx
+  80244d:	41 5f                	pop    %r15
+  80244f:	5d                   	pop    %rbp
+  802450:	c3                   	ret
+
+0000000000802451 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  802451:	55                   	push   %rbp
+  802452:	48 89 e5             	mov    %rsp,%rbp
+  802455:	41 57                	push   %r15
+  802457:	53                   	push   %rbx
+  802458:	48 83 ec 20          	sub    $0x20,%rsp
+  80245c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80245c <fsipc_words+0xb>
+  802463:	49 bb d4 5b 00 00 00 	movabs $0x5bd4,%r11
+  80246a:	00 00 00 
+  80246d:	4c 01 db             	add    %r11,%rbx
+  802470:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802473:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802477:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80247b:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  802482:	00 00 00 
+  802485:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802488:	85 c0                	test   %eax,%eax
+  80248a:	75 24                	jne    8024b0 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80248c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802491:	49 89 df             	mov    %rbx,%r15
+  802494:	48 b8 c5 dd ff ff ff 	movabs $0xffffffffffffddc5,%rax
+  80249b:	ff ff ff 
+  80249e:	48 01 d8             	add    %rbx,%rax
+  8024a1:	ff d0                	call   *%rax
+  8024a3:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8024aa:	00 00 00 
+  8024ad:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8024b0:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8024b7:	00 00 00 
+  8024ba:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8024bd:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8024c1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8024c5:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8024c8:	89 c7                	mov    %eax,%edi
+  8024ca:	49 89 df             	mov    %rbx,%r15
+  8024cd:	48 b8 cf d8 ff ff ff 	movabs $0xffffffffffffd8cf,%rax
+  8024d4:	ff ff ff 
+  8024d7:	48 01 d8             	add    %rbx,%rax
+  8024da:	ff d0                	call   *%rax
+}
+  8024dc:	48 83 c4 20          	add    $0x20,%rsp
+  8024e0:	5b                   	pop    %rbx
+  8024e1:	41 5f                	pop    %r15
+  8024e3:	5d                   	pop    %rbp
+  8024e4:	c3                   	ret
+
+00000000008024e5 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	41 57                	push   %r15
+  8024eb:	53                   	push   %rbx
+  8024ec:	48 83 ec 40          	sub    $0x40,%rsp
+  8024f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8024f0 <fsipc_pages+0xb>
+  8024f7:	49 bb 40 5b 00 00 00 	movabs $0x5b40,%r11
+  8024fe:	00 00 00 
+  802501:	4c 01 db             	add    %r11,%rbx
+  802504:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802507:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80250b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  80250f:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  802512:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  802519:	00 00 00 
+  80251c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80251f:	85 c0                	test   %eax,%eax
+  802521:	75 24                	jne    802547 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802523:	bf 01 00 00 00       	mov    $0x1,%edi
+  802528:	49 89 df             	mov    %rbx,%r15
+  80252b:	48 b8 c5 dd ff ff ff 	movabs $0xffffffffffffddc5,%rax
+  802532:	ff ff ff 
+  802535:	48 01 d8             	add    %rbx,%rax
+  802538:	ff d0                	call   *%rax
+  80253a:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  802541:	00 00 00 
+  802544:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  802547:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80254c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  802550:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802553:	48 98                	cltq
+  802555:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  802559:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80255d:	0f 95 c0             	setne  %al
+  802560:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  802563:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80256a:	00 
+  80256b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80256f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802573:	48 01 d0             	add    %rdx,%rax
+  802576:	48 83 e8 01          	sub    $0x1,%rax
+  80257a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80257e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802582:	ba 00 00 00 00       	mov    $0x0,%edx
+  802587:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80258b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80258f:	48 29 d0             	sub    %rdx,%rax
+  802592:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  802596:	41 89 c2             	mov    %eax,%r10d
+  802599:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8025a0:	00 00 00 
+  8025a3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8025a6:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8025aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8025ae:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8025b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b5:	6a 40                	push   $0x40
+  8025b7:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8025bc:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8025c3:	00 
+  8025c4:	6a 05                	push   $0x5
+  8025c6:	41 89 f9             	mov    %edi,%r9d
+  8025c9:	49 89 c8             	mov    %rcx,%r8
+  8025cc:	44 89 d1             	mov    %r10d,%ecx
+  8025cf:	89 c7                	mov    %eax,%edi
+  8025d1:	49 89 df             	mov    %rbx,%r15
+  8025d4:	48 b8 cd d9 ff ff ff 	movabs $0xffffffffffffd9cd,%rax
+  8025db:	ff ff ff 
+  8025de:	48 01 d8             	add    %rbx,%rax
+  8025e1:	ff d0                	call   *%rax
+  8025e3:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8025e7:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8025eb:	5b                   	pop    %rbx
+  8025ec:	41 5f                	pop    %r15
+  8025ee:	5d                   	pop    %rbp
+  8025ef:	c3                   	ret
+
+00000000008025f0 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8025f0:	55                   	push   %rbp
+  8025f1:	48 89 e5             	mov    %rsp,%rbp
+  8025f4:	41 57                	push   %r15
+  8025f6:	53                   	push   %rbx
+  8025f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8025fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8025fb <open+0xb>
+  802602:	49 bb 35 5a 00 00 00 	movabs $0x5a35,%r11
+  802609:	00 00 00 
+  80260c:	4c 01 db             	add    %r11,%rbx
+  80260f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802613:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  802616:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80261a:	48 89 c7             	mov    %rax,%rdi
+  80261d:	49 89 df             	mov    %rbx,%r15
+  802620:	48 b8 81 82 ff ff ff 	movabs $0xffffffffffff8281,%rax
+  802627:	ff ff ff 
+  80262a:	48 01 d8             	add    %rbx,%rax
+  80262d:	ff d0                	call   *%rax
+  80262f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802634:	7e 0a                	jle    802640 <open+0x50>
+		return -E_BAD_PATH;
+  802636:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80263b:	e9 18 01 00 00       	jmp    802758 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  802640:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802644:	48 89 c7             	mov    %rax,%rdi
+  802647:	49 89 df             	mov    %rbx,%r15
+  80264a:	48 b8 f4 97 ff ff ff 	movabs $0xffffffffffff97f4,%rax
+  802651:	ff ff ff 
+  802654:	48 01 d8             	add    %rbx,%rax
+  802657:	ff d0                	call   *%rax
+  802659:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80265c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802660:	74 08                	je     80266a <open+0x7a>
+		return r;
+  802662:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802665:	e9 ee 00 00 00       	jmp    802758 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80266a:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  802671:	00 00 00 
+  802674:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802677:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80267e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802682:	48 89 c6             	mov    %rax,%rsi
+  802685:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80268c:	00 00 00 
+  80268f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802693:	48 89 c7             	mov    %rax,%rdi
+  802696:	49 89 df             	mov    %rbx,%r15
+  802699:	48 b8 15 83 ff ff ff 	movabs $0xffffffffffff8315,%rax
+  8026a0:	ff ff ff 
+  8026a3:	48 01 d8             	add    %rbx,%rax
+  8026a6:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8026a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8026ac:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  8026b1:	48 89 c6             	mov    %rax,%rsi
+  8026b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026b9:	49 89 df             	mov    %rbx,%r15
+  8026bc:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  8026c3:	ff ff ff 
+  8026c6:	48 01 d8             	add    %rbx,%rax
+  8026c9:	ff d0                	call   *%rax
+  8026cb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8026ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8026d2:	74 23                	je     8026f7 <open+0x107>
+		fd_close(fd,0);
+  8026d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8026d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026dd:	48 89 c7             	mov    %rax,%rdi
+  8026e0:	49 89 df             	mov    %rbx,%r15
+  8026e3:	48 b8 55 99 ff ff ff 	movabs $0xffffffffffff9955,%rax
+  8026ea:	ff ff ff 
+  8026ed:	48 01 d8             	add    %rbx,%rax
+  8026f0:	ff d0                	call   *%rax
+		return r;
+  8026f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026f5:	eb 61                	jmp    802758 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8026f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8026fb:	48 89 c6             	mov    %rax,%rsi
+  8026fe:	bf 01 00 00 00       	mov    $0x1,%edi
+  802703:	48 b8 79 a3 ff ff ff 	movabs $0xffffffffffffa379,%rax
+  80270a:	ff ff ff 
+  80270d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802711:	ff d0                	call   *%rax
+  802713:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802716:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80271a:	74 23                	je     80273f <open+0x14f>
+		fd_close(fd,0);
+  80271c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802720:	be 00 00 00 00       	mov    $0x0,%esi
+  802725:	48 89 c7             	mov    %rax,%rdi
+  802728:	49 89 df             	mov    %rbx,%r15
+  80272b:	48 b8 55 99 ff ff ff 	movabs $0xffffffffffff9955,%rax
+  802732:	ff ff ff 
+  802735:	48 01 d8             	add    %rbx,%rax
+  802738:	ff d0                	call   *%rax
+		return r;
+  80273a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80273d:	eb 19                	jmp    802758 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  80273f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802743:	48 89 c7             	mov    %rax,%rdi
+  802746:	49 89 df             	mov    %rbx,%r15
+  802749:	48 b8 7a 97 ff ff ff 	movabs $0xffffffffffff977a,%rax
+  802750:	ff ff ff 
+  802753:	48 01 d8             	add    %rbx,%rax
+  802756:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  802758:	48 83 c4 20          	add    $0x20,%rsp
+  80275c:	5b                   	pop    %rbx
+  80275d:	41 5f                	pop    %r15
+  80275f:	5d                   	pop    %rbp
+  802760:	c3                   	ret
+
+0000000000802761 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  802761:	55                   	push   %rbp
+  802762:	48 89 e5             	mov    %rsp,%rbp
+  802765:	48 83 ec 20          	sub    $0x20,%rsp
+  802769:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802769 <devfile_flush+0x8>
+  802770:	49 bb c7 58 00 00 00 	movabs $0x58c7,%r11
+  802777:	00 00 00 
+  80277a:	4c 01 d8             	add    %r11,%rax
+  80277d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  802781:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802785:	8b 52 0c             	mov    0xc(%rdx),%edx
+  802788:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  80278b:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80278f:	ba 04 00 00 00       	mov    $0x4,%edx
+  802794:	48 89 ce             	mov    %rcx,%rsi
+  802797:	bf 06 00 00 00       	mov    $0x6,%edi
+  80279c:	48 b9 21 a4 ff ff ff 	movabs $0xffffffffffffa421,%rcx
+  8027a3:	ff ff ff 
+  8027a6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8027aa:	ff d0                	call   *%rax
+}
+  8027ac:	c9                   	leave
+  8027ad:	c3                   	ret
+
+00000000008027ae <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  8027ae:	55                   	push   %rbp
+  8027af:	48 89 e5             	mov    %rsp,%rbp
+  8027b2:	41 57                	push   %r15
+  8027b4:	53                   	push   %rbx
+  8027b5:	48 83 ec 60          	sub    $0x60,%rsp
+  8027b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8027b9 <devfile_read+0xb>
+  8027c0:	49 bb 77 58 00 00 00 	movabs $0x5877,%r11
+  8027c7:	00 00 00 
+  8027ca:	4c 01 db             	add    %r11,%rbx
+  8027cd:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8027d1:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8027d5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  8027d9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8027dd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  8027e1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8027e5:	8b 50 0c             	mov    0xc(%rax),%edx
+  8027e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027ec:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8027ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027f2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8027f6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8027fa:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8027fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802803:	ba 10 00 00 00       	mov    $0x10,%edx
+  802808:	48 89 c6             	mov    %rax,%rsi
+  80280b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802810:	48 b8 b5 a4 ff ff ff 	movabs $0xffffffffffffa4b5,%rax
+  802817:	ff ff ff 
+  80281a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80281e:	ff d0                	call   *%rax
+  802820:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802823:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802827:	79 05                	jns    80282e <devfile_read+0x80>
+		return r;
+  802829:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80282c:	eb 64                	jmp    802892 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  80282e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802831:	48 63 d0             	movslq %eax,%rdx
+  802834:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802838:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  80283d:	48 01 c1             	add    %rax,%rcx
+  802840:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802844:	48 89 ce             	mov    %rcx,%rsi
+  802847:	48 89 c7             	mov    %rax,%rdi
+  80284a:	49 89 df             	mov    %rbx,%r15
+  80284d:	48 b8 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rax
+  802854:	ff ff ff 
+  802857:	48 01 d8             	add    %rbx,%rax
+  80285a:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  80285c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802863:	ff ff ff 
+  802866:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80286a:	48 8b 00             	mov    (%rax),%rax
+  80286d:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  802873:	89 c6                	mov    %eax,%esi
+  802875:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  80287a:	48 89 c7             	mov    %rax,%rdi
+  80287d:	49 89 df             	mov    %rbx,%r15
+  802880:	48 b8 7f dd ff ff ff 	movabs $0xffffffffffffdd7f,%rax
+  802887:	ff ff ff 
+  80288a:	48 01 d8             	add    %rbx,%rax
+  80288d:	ff d0                	call   *%rax
+	return r;
+  80288f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  802892:	48 83 c4 60          	add    $0x60,%rsp
+  802896:	5b                   	pop    %rbx
+  802897:	41 5f                	pop    %r15
+  802899:	5d                   	pop    %rbp
+  80289a:	c3                   	ret
+
+000000000080289b <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80289b:	55                   	push   %rbp
+  80289c:	48 89 e5             	mov    %rsp,%rbp
+  80289f:	41 57                	push   %r15
+  8028a1:	53                   	push   %rbx
+  8028a2:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  8028a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8028a6 <devfile_write+0xb>
+  8028ad:	49 bb 8a 57 00 00 00 	movabs $0x578a,%r11
+  8028b4:	00 00 00 
+  8028b7:	4c 01 db             	add    %r11,%rbx
+  8028ba:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  8028be:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  8028c2:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  8028c9:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8028cd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  8028d1:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  8028d8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8028dc:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  8028e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8028e6:	48 63 d0             	movslq %eax,%rdx
+  8028e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028ed:	48 39 c2             	cmp    %rax,%rdx
+  8028f0:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8028f4:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8028fb:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  802902:	00 
+  802903:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80290a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80290e:	48 01 d0             	add    %rdx,%rax
+  802911:	48 83 e8 01          	sub    $0x1,%rax
+  802915:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802919:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80291d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802922:	48 f7 75 d0          	divq   -0x30(%rbp)
+  802926:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80292a:	48 29 d0             	sub    %rdx,%rax
+  80292d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802931:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  802934:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802937:	89 c6                	mov    %eax,%esi
+  802939:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80293e:	48 89 c7             	mov    %rax,%rdi
+  802941:	49 89 df             	mov    %rbx,%r15
+  802944:	48 b8 39 dd ff ff ff 	movabs $0xffffffffffffdd39,%rax
+  80294b:	ff ff ff 
+  80294e:	48 01 d8             	add    %rbx,%rax
+  802951:	ff d0                	call   *%rax
+  802953:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  802956:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  80295a:	79 08                	jns    802964 <devfile_write+0xc9>
+		return r;
+  80295c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80295f:	e9 8f 00 00 00       	jmp    8029f3 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  802964:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80296b:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  80296f:	48 89 c6             	mov    %rax,%rsi
+  802972:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  802977:	48 89 c7             	mov    %rax,%rdi
+  80297a:	49 89 df             	mov    %rbx,%r15
+  80297d:	48 b8 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rax
+  802984:	ff ff ff 
+  802987:	48 01 d8             	add    %rbx,%rax
+  80298a:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  80298c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  802990:	8b 50 0c             	mov    0xc(%rax),%edx
+  802993:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802997:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  802999:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80299d:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8029a4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  8029a8:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  8029ab:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8029af:	89 d1                	mov    %edx,%ecx
+  8029b1:	ba 10 00 00 00       	mov    $0x10,%edx
+  8029b6:	48 89 c6             	mov    %rax,%rsi
+  8029b9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8029be:	48 b8 b5 a4 ff ff ff 	movabs $0xffffffffffffa4b5,%rax
+  8029c5:	ff ff ff 
+  8029c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029cc:	ff d0                	call   *%rax
+  8029ce:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  8029d1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8029d4:	89 c6                	mov    %eax,%esi
+  8029d6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8029db:	48 89 c7             	mov    %rax,%rdi
+  8029de:	49 89 df             	mov    %rbx,%r15
+  8029e1:	48 b8 7f dd ff ff ff 	movabs $0xffffffffffffdd7f,%rax
+  8029e8:	ff ff ff 
+  8029eb:	48 01 d8             	add    %rbx,%rax
+  8029ee:	ff d0                	call   *%rax
+	return r;
+  8029f0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  8029f3:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  8029f7:	5b                   	pop    %rbx
+  8029f8:	41 5f                	pop    %r15
+  8029fa:	5d                   	pop    %rbp
+  8029fb:	c3                   	ret
+
+00000000008029fc <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  8029fc:	55                   	push   %rbp
+  8029fd:	48 89 e5             	mov    %rsp,%rbp
+  802a00:	41 57                	push   %r15
+  802a02:	53                   	push   %rbx
+  802a03:	48 83 ec 20          	sub    $0x20,%rsp
+  802a07:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a07 <devfile_stat+0xb>
+  802a0e:	49 bb 29 56 00 00 00 	movabs $0x5629,%r11
+  802a15:	00 00 00 
+  802a18:	4c 01 db             	add    %r11,%rbx
+  802a1b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802a1f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802a23:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a27:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a2a:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  802a31:	00 00 00 
+  802a34:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802a37:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802a41:	48 b8 79 a3 ff ff ff 	movabs $0xffffffffffffa379,%rax
+  802a48:	ff ff ff 
+  802a4b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a4f:	ff d0                	call   *%rax
+  802a51:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802a54:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a58:	79 05                	jns    802a5f <devfile_stat+0x63>
+		return r;
+  802a5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a5d:	eb 65                	jmp    802ac4 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802a5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a63:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  802a6a:	00 00 00 
+  802a6d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  802a71:	48 89 d6             	mov    %rdx,%rsi
+  802a74:	48 89 c7             	mov    %rax,%rdi
+  802a77:	49 89 df             	mov    %rbx,%r15
+  802a7a:	48 b8 15 83 ff ff ff 	movabs $0xffffffffffff8315,%rax
+  802a81:	ff ff ff 
+  802a84:	48 01 d8             	add    %rbx,%rax
+  802a87:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802a89:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  802a90:	00 00 00 
+  802a93:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  802a9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a9e:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802aa4:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  802aab:	00 00 00 
+  802aae:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  802ab5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ab9:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  802abf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ac4:	48 83 c4 20          	add    $0x20,%rsp
+  802ac8:	5b                   	pop    %rbx
+  802ac9:	41 5f                	pop    %r15
+  802acb:	5d                   	pop    %rbp
+  802acc:	c3                   	ret
+
+0000000000802acd <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802acd:	55                   	push   %rbp
+  802ace:	48 89 e5             	mov    %rsp,%rbp
+  802ad1:	48 83 ec 20          	sub    $0x20,%rsp
+  802ad5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ad5 <devfile_trunc+0x8>
+  802adc:	49 bb 5b 55 00 00 00 	movabs $0x555b,%r11
+  802ae3:	00 00 00 
+  802ae6:	4c 01 d8             	add    %r11,%rax
+  802ae9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802aed:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  802af0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802af4:	8b 52 0c             	mov    0xc(%rdx),%edx
+  802af7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  802afa:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802afd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  802b00:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  802b04:	ba 08 00 00 00       	mov    $0x8,%edx
+  802b09:	48 89 ce             	mov    %rcx,%rsi
+  802b0c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802b11:	48 b9 21 a4 ff ff ff 	movabs $0xffffffffffffa421,%rcx
+  802b18:	ff ff ff 
+  802b1b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802b1f:	ff d0                	call   *%rax
+}
+  802b21:	c9                   	leave
+  802b22:	c3                   	ret
+
+0000000000802b23 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802b23:	55                   	push   %rbp
+  802b24:	48 89 e5             	mov    %rsp,%rbp
+  802b27:	41 57                	push   %r15
+  802b29:	53                   	push   %rbx
+  802b2a:	48 83 ec 10          	sub    $0x10,%rsp
+  802b2e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b2e <remove+0xb>
+  802b35:	49 bb 02 55 00 00 00 	movabs $0x5502,%r11
+  802b3c:	00 00 00 
+  802b3f:	4c 01 db             	add    %r11,%rbx
+  802b42:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  802b46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b4a:	48 89 c7             	mov    %rax,%rdi
+  802b4d:	49 89 df             	mov    %rbx,%r15
+  802b50:	48 b8 81 82 ff ff ff 	movabs $0xffffffffffff8281,%rax
+  802b57:	ff ff ff 
+  802b5a:	48 01 d8             	add    %rbx,%rax
+  802b5d:	ff d0                	call   *%rax
+  802b5f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b64:	7e 07                	jle    802b6d <remove+0x4a>
+		return -E_BAD_PATH;
+  802b66:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802b6b:	eb 44                	jmp    802bb1 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802b6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b71:	48 89 c6             	mov    %rax,%rsi
+  802b74:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  802b7b:	00 00 00 
+  802b7e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b82:	48 89 c7             	mov    %rax,%rdi
+  802b85:	49 89 df             	mov    %rbx,%r15
+  802b88:	48 b8 15 83 ff ff ff 	movabs $0xffffffffffff8315,%rax
+  802b8f:	ff ff ff 
+  802b92:	48 01 d8             	add    %rbx,%rax
+  802b95:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  802b97:	be 00 00 00 00       	mov    $0x0,%esi
+  802b9c:	bf 07 00 00 00       	mov    $0x7,%edi
+  802ba1:	48 b8 79 a3 ff ff ff 	movabs $0xffffffffffffa379,%rax
+  802ba8:	ff ff ff 
+  802bab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802baf:	ff d0                	call   *%rax
+}
+  802bb1:	48 83 c4 10          	add    $0x10,%rsp
+  802bb5:	5b                   	pop    %rbx
+  802bb6:	41 5f                	pop    %r15
+  802bb8:	5d                   	pop    %rbp
+  802bb9:	c3                   	ret
+
+0000000000802bba <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802bba:	55                   	push   %rbp
+  802bbb:	48 89 e5             	mov    %rsp,%rbp
+  802bbe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802bbe <sync+0x4>
+  802bc5:	49 bb 72 54 00 00 00 	movabs $0x5472,%r11
+  802bcc:	00 00 00 
+  802bcf:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  802bd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bd7:	be 00 00 00 00       	mov    $0x0,%esi
+  802bdc:	bf 08 00 00 00       	mov    $0x8,%edi
+  802be1:	48 b9 21 a4 ff ff ff 	movabs $0xffffffffffffa421,%rcx
+  802be8:	ff ff ff 
+  802beb:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802bef:	ff d0                	call   *%rax
+}
+  802bf1:	5d                   	pop    %rbp
+  802bf2:	c3                   	ret
+
+0000000000802bf3 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  802bf3:	55                   	push   %rbp
+  802bf4:	48 89 e5             	mov    %rsp,%rbp
+  802bf7:	41 57                	push   %r15
+  802bf9:	53                   	push   %rbx
+  802bfa:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  802c01:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c01 <copy+0xe>
+  802c08:	49 bb 2f 54 00 00 00 	movabs $0x542f,%r11
+  802c0f:	00 00 00 
+  802c12:	4c 01 db             	add    %r11,%rbx
+  802c15:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  802c1c:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  802c23:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  802c2a:	be 00 00 00 00       	mov    $0x0,%esi
+  802c2f:	48 89 c7             	mov    %rax,%rdi
+  802c32:	48 b8 c0 a5 ff ff ff 	movabs $0xffffffffffffa5c0,%rax
+  802c39:	ff ff ff 
+  802c3c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c40:	ff d0                	call   *%rax
+  802c42:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  802c45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c49:	79 35                	jns    802c80 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  802c4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c4e:	89 c6                	mov    %eax,%esi
+  802c50:	48 b8 c6 df ff ff ff 	movabs $0xffffffffffffdfc6,%rax
+  802c57:	ff ff ff 
+  802c5a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c5e:	48 89 c7             	mov    %rax,%rdi
+  802c61:	49 89 df             	mov    %rbx,%r15
+  802c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c69:	48 ba 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%rdx
+  802c70:	ff ff ff 
+  802c73:	48 01 da             	add    %rbx,%rdx
+  802c76:	ff d2                	call   *%rdx
+		return fd_src;
+  802c78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c7b:	e9 d7 01 00 00       	jmp    802e57 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  802c80:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  802c87:	be 01 01 00 00       	mov    $0x101,%esi
+  802c8c:	48 89 c7             	mov    %rax,%rdi
+  802c8f:	48 b8 c0 a5 ff ff ff 	movabs $0xffffffffffffa5c0,%rax
+  802c96:	ff ff ff 
+  802c99:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c9d:	ff d0                	call   *%rax
+  802c9f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  802ca2:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802ca6:	0f 89 df 00 00 00    	jns    802d8b <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  802cac:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802caf:	89 c6                	mov    %eax,%esi
+  802cb1:	48 b8 dc df ff ff ff 	movabs $0xffffffffffffdfdc,%rax
+  802cb8:	ff ff ff 
+  802cbb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cbf:	48 89 c7             	mov    %rax,%rdi
+  802cc2:	49 89 df             	mov    %rbx,%r15
+  802cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cca:	48 ba 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%rdx
+  802cd1:	ff ff ff 
+  802cd4:	48 01 da             	add    %rbx,%rdx
+  802cd7:	ff d2                	call   *%rdx
+		close(fd_src);
+  802cd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cdc:	89 c7                	mov    %eax,%edi
+  802cde:	49 89 df             	mov    %rbx,%r15
+  802ce1:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  802ce8:	ff ff ff 
+  802ceb:	48 01 d8             	add    %rbx,%rax
+  802cee:	ff d0                	call   *%rax
+		return fd_dest;
+  802cf0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802cf3:	e9 5f 01 00 00       	jmp    802e57 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  802cf8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802cfb:	48 63 d0             	movslq %eax,%rdx
+  802cfe:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  802d05:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802d08:	48 89 ce             	mov    %rcx,%rsi
+  802d0b:	89 c7                	mov    %eax,%edi
+  802d0d:	49 89 df             	mov    %rbx,%r15
+  802d10:	48 b8 97 9f ff ff ff 	movabs $0xffffffffffff9f97,%rax
+  802d17:	ff ff ff 
+  802d1a:	48 01 d8             	add    %rbx,%rax
+  802d1d:	ff d0                	call   *%rax
+  802d1f:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  802d22:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  802d26:	79 63                	jns    802d8b <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  802d28:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  802d2b:	89 c6                	mov    %eax,%esi
+  802d2d:	48 b8 f6 df ff ff ff 	movabs $0xffffffffffffdff6,%rax
+  802d34:	ff ff ff 
+  802d37:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d3b:	48 89 c7             	mov    %rax,%rdi
+  802d3e:	49 89 df             	mov    %rbx,%r15
+  802d41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d46:	48 ba 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%rdx
+  802d4d:	ff ff ff 
+  802d50:	48 01 da             	add    %rbx,%rdx
+  802d53:	ff d2                	call   *%rdx
+			close(fd_src);
+  802d55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d58:	89 c7                	mov    %eax,%edi
+  802d5a:	49 89 df             	mov    %rbx,%r15
+  802d5d:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  802d64:	ff ff ff 
+  802d67:	48 01 d8             	add    %rbx,%rax
+  802d6a:	ff d0                	call   *%rax
+			close(fd_dest);
+  802d6c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802d6f:	89 c7                	mov    %eax,%edi
+  802d71:	49 89 df             	mov    %rbx,%r15
+  802d74:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  802d7b:	ff ff ff 
+  802d7e:	48 01 d8             	add    %rbx,%rax
+  802d81:	ff d0                	call   *%rax
+			return write_size;
+  802d83:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  802d86:	e9 cc 00 00 00       	jmp    802e57 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  802d8b:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  802d92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d95:	ba 00 02 00 00       	mov    $0x200,%edx
+  802d9a:	48 89 ce             	mov    %rcx,%rsi
+  802d9d:	89 c7                	mov    %eax,%edi
+  802d9f:	49 89 df             	mov    %rbx,%r15
+  802da2:	48 b8 f1 9d ff ff ff 	movabs $0xffffffffffff9df1,%rax
+  802da9:	ff ff ff 
+  802dac:	48 01 d8             	add    %rbx,%rax
+  802daf:	ff d0                	call   *%rax
+  802db1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802db4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802db8:	0f 8f 3a ff ff ff    	jg     802cf8 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  802dbe:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802dc2:	79 60                	jns    802e24 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  802dc4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802dc7:	89 c6                	mov    %eax,%esi
+  802dc9:	48 b8 09 e0 ff ff ff 	movabs $0xffffffffffffe009,%rax
+  802dd0:	ff ff ff 
+  802dd3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dd7:	48 89 c7             	mov    %rax,%rdi
+  802dda:	49 89 df             	mov    %rbx,%r15
+  802ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de2:	48 ba 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%rdx
+  802de9:	ff ff ff 
+  802dec:	48 01 da             	add    %rbx,%rdx
+  802def:	ff d2                	call   *%rdx
+		close(fd_src);
+  802df1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802df4:	89 c7                	mov    %eax,%edi
+  802df6:	49 89 df             	mov    %rbx,%r15
+  802df9:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  802e00:	ff ff ff 
+  802e03:	48 01 d8             	add    %rbx,%rax
+  802e06:	ff d0                	call   *%rax
+		close(fd_dest);
+  802e08:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802e0b:	89 c7                	mov    %eax,%edi
+  802e0d:	49 89 df             	mov    %rbx,%r15
+  802e10:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  802e17:	ff ff ff 
+  802e1a:	48 01 d8             	add    %rbx,%rax
+  802e1d:	ff d0                	call   *%rax
+		return read_size;
+  802e1f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802e22:	eb 33                	jmp    802e57 <copy+0x264>
+	}
+	close(fd_src);
+  802e24:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e27:	89 c7                	mov    %eax,%edi
+  802e29:	49 89 df             	mov    %rbx,%r15
+  802e2c:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  802e33:	ff ff ff 
+  802e36:	48 01 d8             	add    %rbx,%rax
+  802e39:	ff d0                	call   *%rax
+	close(fd_dest);
+  802e3b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802e3e:	89 c7                	mov    %eax,%edi
+  802e40:	49 89 df             	mov    %rbx,%r15
+  802e43:	48 b8 39 9b ff ff ff 	movabs $0xffffffffffff9b39,%rax
+  802e4a:	ff ff ff 
+  802e4d:	48 01 d8             	add    %rbx,%rax
+  802e50:	ff d0                	call   *%rax
+	return 0;
+  802e52:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  802e57:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  802e5e:	5b                   	pop    %rbx
+  802e5f:	41 5f                	pop    %r15
+  802e61:	5d                   	pop    %rbp
+  802e62:	c3                   	ret
+
+0000000000802e63 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  802e63:	55                   	push   %rbp
+  802e64:	48 89 e5             	mov    %rsp,%rbp
+  802e67:	41 57                	push   %r15
+  802e69:	53                   	push   %rbx
+  802e6a:	48 83 ec 20          	sub    $0x20,%rsp
+  802e6e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e6e <fd2sockid+0xb>
+  802e75:	49 bb c2 51 00 00 00 	movabs $0x51c2,%r11
+  802e7c:	00 00 00 
+  802e7f:	4c 01 db             	add    %r11,%rbx
+  802e82:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802e85:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802e89:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e8c:	48 89 d6             	mov    %rdx,%rsi
+  802e8f:	89 c7                	mov    %eax,%edi
+  802e91:	49 89 df             	mov    %rbx,%r15
+  802e94:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  802e9b:	ff ff ff 
+  802e9e:	48 01 d8             	add    %rbx,%rax
+  802ea1:	ff d0                	call   *%rax
+  802ea3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ea6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802eaa:	79 05                	jns    802eb1 <fd2sockid+0x4e>
+		return r;
+  802eac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eaf:	eb 25                	jmp    802ed6 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802eb1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802eb5:	8b 10                	mov    (%rax),%edx
+  802eb7:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  802ebe:	00 00 00 
+  802ec1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802ec4:	39 c2                	cmp    %eax,%edx
+  802ec6:	74 07                	je     802ecf <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  802ec8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802ecd:	eb 07                	jmp    802ed6 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  802ecf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ed3:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  802ed6:	48 83 c4 20          	add    $0x20,%rsp
+  802eda:	5b                   	pop    %rbx
+  802edb:	41 5f                	pop    %r15
+  802edd:	5d                   	pop    %rbp
+  802ede:	c3                   	ret
+
+0000000000802edf <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  802edf:	55                   	push   %rbp
+  802ee0:	48 89 e5             	mov    %rsp,%rbp
+  802ee3:	41 57                	push   %r15
+  802ee5:	53                   	push   %rbx
+  802ee6:	48 83 ec 20          	sub    $0x20,%rsp
+  802eea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802eea <alloc_sockfd+0xb>
+  802ef1:	49 bb 46 51 00 00 00 	movabs $0x5146,%r11
+  802ef8:	00 00 00 
+  802efb:	4c 01 db             	add    %r11,%rbx
+  802efe:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  802f01:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802f05:	48 89 c7             	mov    %rax,%rdi
+  802f08:	49 89 df             	mov    %rbx,%r15
+  802f0b:	48 b8 f4 97 ff ff ff 	movabs $0xffffffffffff97f4,%rax
+  802f12:	ff ff ff 
+  802f15:	48 01 d8             	add    %rbx,%rax
+  802f18:	ff d0                	call   *%rax
+  802f1a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f1d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f21:	78 2c                	js     802f4f <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802f23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f27:	ba 07 04 00 00       	mov    $0x407,%edx
+  802f2c:	48 89 c6             	mov    %rax,%rsi
+  802f2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f34:	49 89 df             	mov    %rbx,%r15
+  802f37:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  802f3e:	ff ff ff 
+  802f41:	48 01 d8             	add    %rbx,%rax
+  802f44:	ff d0                	call   *%rax
+  802f46:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f49:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f4d:	79 1c                	jns    802f6b <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  802f4f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802f52:	89 c7                	mov    %eax,%edi
+  802f54:	49 89 df             	mov    %rbx,%r15
+  802f57:	48 b8 a3 b6 ff ff ff 	movabs $0xffffffffffffb6a3,%rax
+  802f5e:	ff ff ff 
+  802f61:	48 01 d8             	add    %rbx,%rax
+  802f64:	ff d0                	call   *%rax
+		return r;
+  802f66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f69:	eb 41                	jmp    802fac <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  802f6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f6f:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  802f76:	00 00 00 
+  802f79:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  802f7c:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  802f7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f82:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  802f89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f8d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f90:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  802f93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f97:	48 89 c7             	mov    %rax,%rdi
+  802f9a:	49 89 df             	mov    %rbx,%r15
+  802f9d:	48 b8 7a 97 ff ff ff 	movabs $0xffffffffffff977a,%rax
+  802fa4:	ff ff ff 
+  802fa7:	48 01 d8             	add    %rbx,%rax
+  802faa:	ff d0                	call   *%rax
+}
+  802fac:	48 83 c4 20          	add    $0x20,%rsp
+  802fb0:	5b                   	pop    %rbx
+  802fb1:	41 5f                	pop    %r15
+  802fb3:	5d                   	pop    %rbp
+  802fb4:	c3                   	ret
+
+0000000000802fb5 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802fb5:	55                   	push   %rbp
+  802fb6:	48 89 e5             	mov    %rsp,%rbp
+  802fb9:	41 57                	push   %r15
+  802fbb:	53                   	push   %rbx
+  802fbc:	48 83 ec 30          	sub    $0x30,%rsp
+  802fc0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802fc0 <accept+0xb>
+  802fc7:	49 bb 70 50 00 00 00 	movabs $0x5070,%r11
+  802fce:	00 00 00 
+  802fd1:	4c 01 db             	add    %r11,%rbx
+  802fd4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802fd7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802fdb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  802fdf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fe2:	89 c7                	mov    %eax,%edi
+  802fe4:	48 b8 33 ae ff ff ff 	movabs $0xffffffffffffae33,%rax
+  802feb:	ff ff ff 
+  802fee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ff2:	ff d0                	call   *%rax
+  802ff4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ff7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ffb:	79 05                	jns    803002 <accept+0x4d>
+		return r;
+  802ffd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803000:	eb 45                	jmp    803047 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803002:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803006:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80300a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80300d:	48 89 ce             	mov    %rcx,%rsi
+  803010:	89 c7                	mov    %eax,%edi
+  803012:	49 89 df             	mov    %rbx,%r15
+  803015:	48 b8 11 b5 ff ff ff 	movabs $0xffffffffffffb511,%rax
+  80301c:	ff ff ff 
+  80301f:	48 01 d8             	add    %rbx,%rax
+  803022:	ff d0                	call   *%rax
+  803024:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803027:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80302b:	79 05                	jns    803032 <accept+0x7d>
+		return r;
+  80302d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803030:	eb 15                	jmp    803047 <accept+0x92>
+	return alloc_sockfd(r);
+  803032:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803035:	89 c7                	mov    %eax,%edi
+  803037:	48 b8 af ae ff ff ff 	movabs $0xffffffffffffaeaf,%rax
+  80303e:	ff ff ff 
+  803041:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803045:	ff d0                	call   *%rax
+}
+  803047:	48 83 c4 30          	add    $0x30,%rsp
+  80304b:	5b                   	pop    %rbx
+  80304c:	41 5f                	pop    %r15
+  80304e:	5d                   	pop    %rbp
+  80304f:	c3                   	ret
+
+0000000000803050 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803050:	55                   	push   %rbp
+  803051:	48 89 e5             	mov    %rsp,%rbp
+  803054:	41 57                	push   %r15
+  803056:	53                   	push   %rbx
+  803057:	48 83 ec 20          	sub    $0x20,%rsp
+  80305b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80305b <bind+0xb>
+  803062:	49 bb d5 4f 00 00 00 	movabs $0x4fd5,%r11
+  803069:	00 00 00 
+  80306c:	4c 01 db             	add    %r11,%rbx
+  80306f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803072:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803076:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  803079:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80307c:	89 c7                	mov    %eax,%edi
+  80307e:	48 b8 33 ae ff ff ff 	movabs $0xffffffffffffae33,%rax
+  803085:	ff ff ff 
+  803088:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80308c:	ff d0                	call   *%rax
+  80308e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803091:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803095:	79 05                	jns    80309c <bind+0x4c>
+		return r;
+  803097:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80309a:	eb 21                	jmp    8030bd <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80309c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80309f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8030a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030a6:	48 89 ce             	mov    %rcx,%rsi
+  8030a9:	89 c7                	mov    %eax,%edi
+  8030ab:	49 89 df             	mov    %rbx,%r15
+  8030ae:	48 b8 bd b5 ff ff ff 	movabs $0xffffffffffffb5bd,%rax
+  8030b5:	ff ff ff 
+  8030b8:	48 01 d8             	add    %rbx,%rax
+  8030bb:	ff d0                	call   *%rax
+}
+  8030bd:	48 83 c4 20          	add    $0x20,%rsp
+  8030c1:	5b                   	pop    %rbx
+  8030c2:	41 5f                	pop    %r15
+  8030c4:	5d                   	pop    %rbp
+  8030c5:	c3                   	ret
+
+00000000008030c6 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8030c6:	55                   	push   %rbp
+  8030c7:	48 89 e5             	mov    %rsp,%rbp
+  8030ca:	41 57                	push   %r15
+  8030cc:	53                   	push   %rbx
+  8030cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8030d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030d1 <shutdown+0xb>
+  8030d8:	49 bb 5f 4f 00 00 00 	movabs $0x4f5f,%r11
+  8030df:	00 00 00 
+  8030e2:	4c 01 db             	add    %r11,%rbx
+  8030e5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030e8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8030eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030ee:	89 c7                	mov    %eax,%edi
+  8030f0:	48 b8 33 ae ff ff ff 	movabs $0xffffffffffffae33,%rax
+  8030f7:	ff ff ff 
+  8030fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030fe:	ff d0                	call   *%rax
+  803100:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803103:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803107:	79 05                	jns    80310e <shutdown+0x48>
+		return r;
+  803109:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80310c:	eb 1c                	jmp    80312a <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  80310e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803111:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803114:	89 d6                	mov    %edx,%esi
+  803116:	89 c7                	mov    %eax,%edi
+  803118:	49 89 df             	mov    %rbx,%r15
+  80311b:	48 b8 52 b6 ff ff ff 	movabs $0xffffffffffffb652,%rax
+  803122:	ff ff ff 
+  803125:	48 01 d8             	add    %rbx,%rax
+  803128:	ff d0                	call   *%rax
+}
+  80312a:	48 83 c4 20          	add    $0x20,%rsp
+  80312e:	5b                   	pop    %rbx
+  80312f:	41 5f                	pop    %r15
+  803131:	5d                   	pop    %rbp
+  803132:	c3                   	ret
+
+0000000000803133 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  803133:	55                   	push   %rbp
+  803134:	48 89 e5             	mov    %rsp,%rbp
+  803137:	41 57                	push   %r15
+  803139:	53                   	push   %rbx
+  80313a:	48 83 ec 10          	sub    $0x10,%rsp
+  80313e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80313e <devsock_close+0xb>
+  803145:	49 bb f2 4e 00 00 00 	movabs $0x4ef2,%r11
+  80314c:	00 00 00 
+  80314f:	4c 01 db             	add    %r11,%rbx
+  803152:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  803156:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80315a:	48 89 c7             	mov    %rax,%rdi
+  80315d:	49 89 df             	mov    %rbx,%r15
+  803160:	48 b8 54 de ff ff ff 	movabs $0xffffffffffffde54,%rax
+  803167:	ff ff ff 
+  80316a:	48 01 d8             	add    %rbx,%rax
+  80316d:	ff d0                	call   *%rax
+  80316f:	83 f8 01             	cmp    $0x1,%eax
+  803172:	75 1d                	jne    803191 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  803174:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803178:	8b 40 0c             	mov    0xc(%rax),%eax
+  80317b:	89 c7                	mov    %eax,%edi
+  80317d:	49 89 df             	mov    %rbx,%r15
+  803180:	48 b8 a3 b6 ff ff ff 	movabs $0xffffffffffffb6a3,%rax
+  803187:	ff ff ff 
+  80318a:	48 01 d8             	add    %rbx,%rax
+  80318d:	ff d0                	call   *%rax
+  80318f:	eb 05                	jmp    803196 <devsock_close+0x63>
+	else
+		return 0;
+  803191:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803196:	48 83 c4 10          	add    $0x10,%rsp
+  80319a:	5b                   	pop    %rbx
+  80319b:	41 5f                	pop    %r15
+  80319d:	5d                   	pop    %rbp
+  80319e:	c3                   	ret
+
+000000000080319f <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80319f:	55                   	push   %rbp
+  8031a0:	48 89 e5             	mov    %rsp,%rbp
+  8031a3:	41 57                	push   %r15
+  8031a5:	53                   	push   %rbx
+  8031a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8031aa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031aa <connect+0xb>
+  8031b1:	49 bb 86 4e 00 00 00 	movabs $0x4e86,%r11
+  8031b8:	00 00 00 
+  8031bb:	4c 01 db             	add    %r11,%rbx
+  8031be:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031c1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8031c5:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8031c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031cb:	89 c7                	mov    %eax,%edi
+  8031cd:	48 b8 33 ae ff ff ff 	movabs $0xffffffffffffae33,%rax
+  8031d4:	ff ff ff 
+  8031d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031db:	ff d0                	call   *%rax
+  8031dd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031e0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031e4:	79 05                	jns    8031eb <connect+0x4c>
+		return r;
+  8031e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031e9:	eb 21                	jmp    80320c <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8031eb:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8031ee:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8031f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031f5:	48 89 ce             	mov    %rcx,%rsi
+  8031f8:	89 c7                	mov    %eax,%edi
+  8031fa:	49 89 df             	mov    %rbx,%r15
+  8031fd:	48 b8 eb b6 ff ff ff 	movabs $0xffffffffffffb6eb,%rax
+  803204:	ff ff ff 
+  803207:	48 01 d8             	add    %rbx,%rax
+  80320a:	ff d0                	call   *%rax
+}
+  80320c:	48 83 c4 20          	add    $0x20,%rsp
+  803210:	5b                   	pop    %rbx
+  803211:	41 5f                	pop    %r15
+  803213:	5d                   	pop    %rbp
+  803214:	c3                   	ret
+
+0000000000803215 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  803215:	55                   	push   %rbp
+  803216:	48 89 e5             	mov    %rsp,%rbp
+  803219:	41 57                	push   %r15
+  80321b:	53                   	push   %rbx
+  80321c:	48 83 ec 20          	sub    $0x20,%rsp
+  803220:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803220 <listen+0xb>
+  803227:	49 bb 10 4e 00 00 00 	movabs $0x4e10,%r11
+  80322e:	00 00 00 
+  803231:	4c 01 db             	add    %r11,%rbx
+  803234:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803237:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80323a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80323d:	89 c7                	mov    %eax,%edi
+  80323f:	48 b8 33 ae ff ff ff 	movabs $0xffffffffffffae33,%rax
+  803246:	ff ff ff 
+  803249:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80324d:	ff d0                	call   *%rax
+  80324f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803252:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803256:	79 05                	jns    80325d <listen+0x48>
+		return r;
+  803258:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80325b:	eb 1c                	jmp    803279 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80325d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803260:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803263:	89 d6                	mov    %edx,%esi
+  803265:	89 c7                	mov    %eax,%edi
+  803267:	49 89 df             	mov    %rbx,%r15
+  80326a:	48 b8 80 b7 ff ff ff 	movabs $0xffffffffffffb780,%rax
+  803271:	ff ff ff 
+  803274:	48 01 d8             	add    %rbx,%rax
+  803277:	ff d0                	call   *%rax
+}
+  803279:	48 83 c4 20          	add    $0x20,%rsp
+  80327d:	5b                   	pop    %rbx
+  80327e:	41 5f                	pop    %r15
+  803280:	5d                   	pop    %rbp
+  803281:	c3                   	ret
+
+0000000000803282 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  803282:	55                   	push   %rbp
+  803283:	48 89 e5             	mov    %rsp,%rbp
+  803286:	41 57                	push   %r15
+  803288:	48 83 ec 28          	sub    $0x28,%rsp
+  80328c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80328c <devsock_read+0xa>
+  803293:	49 bb a4 4d 00 00 00 	movabs $0x4da4,%r11
+  80329a:	00 00 00 
+  80329d:	4c 01 d8             	add    %r11,%rax
+  8032a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8032a4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8032a8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8032ac:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032b0:	41 89 d0             	mov    %edx,%r8d
+  8032b3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8032b7:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8032ba:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8032be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032c3:	44 89 c2             	mov    %r8d,%edx
+  8032c6:	49 89 c7             	mov    %rax,%r15
+  8032c9:	49 b8 d1 b7 ff ff ff 	movabs $0xffffffffffffb7d1,%r8
+  8032d0:	ff ff ff 
+  8032d3:	49 01 c0             	add    %rax,%r8
+  8032d6:	41 ff d0             	call   *%r8
+}
+  8032d9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8032dd:	c9                   	leave
+  8032de:	c3                   	ret
+
+00000000008032df <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8032df:	55                   	push   %rbp
+  8032e0:	48 89 e5             	mov    %rsp,%rbp
+  8032e3:	41 57                	push   %r15
+  8032e5:	48 83 ec 28          	sub    $0x28,%rsp
+  8032e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8032e9 <devsock_write+0xa>
+  8032f0:	49 bb 47 4d 00 00 00 	movabs $0x4d47,%r11
+  8032f7:	00 00 00 
+  8032fa:	4c 01 d8             	add    %r11,%rax
+  8032fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803301:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803305:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  803309:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80330d:	41 89 d0             	mov    %edx,%r8d
+  803310:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803314:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  803317:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80331b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803320:	44 89 c2             	mov    %r8d,%edx
+  803323:	49 89 c7             	mov    %rax,%r15
+  803326:	49 b8 ee b8 ff ff ff 	movabs $0xffffffffffffb8ee,%r8
+  80332d:	ff ff ff 
+  803330:	49 01 c0             	add    %rax,%r8
+  803333:	41 ff d0             	call   *%r8
+}
+  803336:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80333a:	c9                   	leave
+  80333b:	c3                   	ret
+
+000000000080333c <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80333c:	55                   	push   %rbp
+  80333d:	48 89 e5             	mov    %rsp,%rbp
+  803340:	41 57                	push   %r15
+  803342:	48 83 ec 18          	sub    $0x18,%rsp
+  803346:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803346 <devsock_stat+0xa>
+  80334d:	49 bb ea 4c 00 00 00 	movabs $0x4cea,%r11
+  803354:	00 00 00 
+  803357:	4c 01 d8             	add    %r11,%rax
+  80335a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80335e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  803362:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803366:	48 b9 24 e0 ff ff ff 	movabs $0xffffffffffffe024,%rcx
+  80336d:	ff ff ff 
+  803370:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  803374:	48 89 ce             	mov    %rcx,%rsi
+  803377:	48 89 d7             	mov    %rdx,%rdi
+  80337a:	49 89 c7             	mov    %rax,%r15
+  80337d:	48 ba 15 83 ff ff ff 	movabs $0xffffffffffff8315,%rdx
+  803384:	ff ff ff 
+  803387:	48 01 c2             	add    %rax,%rdx
+  80338a:	ff d2                	call   *%rdx
+	return 0;
+  80338c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803391:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803395:	c9                   	leave
+  803396:	c3                   	ret
+
+0000000000803397 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803397:	55                   	push   %rbp
+  803398:	48 89 e5             	mov    %rsp,%rbp
+  80339b:	41 57                	push   %r15
+  80339d:	53                   	push   %rbx
+  80339e:	48 83 ec 20          	sub    $0x20,%rsp
+  8033a2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033a2 <socket+0xb>
+  8033a9:	49 bb 8e 4c 00 00 00 	movabs $0x4c8e,%r11
+  8033b0:	00 00 00 
+  8033b3:	4c 01 db             	add    %r11,%rbx
+  8033b6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8033b9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8033bc:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8033bf:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8033c2:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8033c5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8033c8:	89 ce                	mov    %ecx,%esi
+  8033ca:	89 c7                	mov    %eax,%edi
+  8033cc:	49 89 df             	mov    %rbx,%r15
+  8033cf:	48 b8 c5 ba ff ff ff 	movabs $0xffffffffffffbac5,%rax
+  8033d6:	ff ff ff 
+  8033d9:	48 01 d8             	add    %rbx,%rax
+  8033dc:	ff d0                	call   *%rax
+  8033de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8033e1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033e5:	79 05                	jns    8033ec <socket+0x55>
+		return r;
+  8033e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033ea:	eb 15                	jmp    803401 <socket+0x6a>
+	return alloc_sockfd(r);
+  8033ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033ef:	89 c7                	mov    %eax,%edi
+  8033f1:	48 b8 af ae ff ff ff 	movabs $0xffffffffffffaeaf,%rax
+  8033f8:	ff ff ff 
+  8033fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033ff:	ff d0                	call   *%rax
+}
+  803401:	48 83 c4 20          	add    $0x20,%rsp
+  803405:	5b                   	pop    %rbx
+  803406:	41 5f                	pop    %r15
+  803408:	5d                   	pop    %rbp
+  803409:	c3                   	ret
+
+000000000080340a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80340a:	55                   	push   %rbp
+  80340b:	48 89 e5             	mov    %rsp,%rbp
+  80340e:	41 57                	push   %r15
+  803410:	53                   	push   %rbx
+  803411:	48 83 ec 10          	sub    $0x10,%rsp
+  803415:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803415 <nsipc+0xb>
+  80341c:	49 bb 1b 4c 00 00 00 	movabs $0x4c1b,%r11
+  803423:	00 00 00 
+  803426:	4c 01 db             	add    %r11,%rbx
+  803429:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  80342c:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  803433:	00 00 00 
+  803436:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803439:	85 c0                	test   %eax,%eax
+  80343b:	75 24                	jne    803461 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80343d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803442:	49 89 df             	mov    %rbx,%r15
+  803445:	48 b8 c5 dd ff ff ff 	movabs $0xffffffffffffddc5,%rax
+  80344c:	ff ff ff 
+  80344f:	48 01 d8             	add    %rbx,%rax
+  803452:	ff d0                	call   *%rax
+  803454:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  80345b:	00 00 00 
+  80345e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  803461:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  803468:	00 00 00 
+  80346b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80346e:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803471:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803477:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80347d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803482:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  803489:	00 00 00 
+  80348c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803490:	89 c7                	mov    %eax,%edi
+  803492:	49 89 df             	mov    %rbx,%r15
+  803495:	48 b8 e4 d7 ff ff ff 	movabs $0xffffffffffffd7e4,%rax
+  80349c:	ff ff ff 
+  80349f:	48 01 d8             	add    %rbx,%rax
+  8034a2:	ff d0                	call   *%rax
+}
+  8034a4:	48 83 c4 10          	add    $0x10,%rsp
+  8034a8:	5b                   	pop    %rbx
+  8034a9:	41 5f                	pop    %r15
+  8034ab:	5d                   	pop    %rbp
+  8034ac:	c3                   	ret
+
+00000000008034ad <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8034ad:	55                   	push   %rbp
+  8034ae:	48 89 e5             	mov    %rsp,%rbp
+  8034b1:	41 57                	push   %r15
+  8034b3:	53                   	push   %rbx
+  8034b4:	48 83 ec 20          	sub    $0x20,%rsp
+  8034b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034b8 <nsipc_words+0xb>
+  8034bf:	49 bb 78 4b 00 00 00 	movabs $0x4b78,%r11
+  8034c6:	00 00 00 
+  8034c9:	4c 01 db             	add    %r11,%rbx
+  8034cc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8034cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8034d3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8034d7:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8034de:	00 00 00 
+  8034e1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8034e4:	85 c0                	test   %eax,%eax
+  8034e6:	75 24                	jne    80350c <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8034e8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8034ed:	49 89 df             	mov    %rbx,%r15
+  8034f0:	48 b8 c5 dd ff ff ff 	movabs $0xffffffffffffddc5,%rax
+  8034f7:	ff ff ff 
+  8034fa:	48 01 d8             	add    %rbx,%rax
+  8034fd:	ff d0                	call   *%rax
+  8034ff:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  803506:	00 00 00 
+  803509:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  80350c:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  803513:	00 00 00 
+  803516:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803519:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80351d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803521:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803524:	89 c7                	mov    %eax,%edi
+  803526:	49 89 df             	mov    %rbx,%r15
+  803529:	48 b8 cf d8 ff ff ff 	movabs $0xffffffffffffd8cf,%rax
+  803530:	ff ff ff 
+  803533:	48 01 d8             	add    %rbx,%rax
+  803536:	ff d0                	call   *%rax
+}
+  803538:	48 83 c4 20          	add    $0x20,%rsp
+  80353c:	5b                   	pop    %rbx
+  80353d:	41 5f                	pop    %r15
+  80353f:	5d                   	pop    %rbp
+  803540:	c3                   	ret
+
+0000000000803541 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803541:	55                   	push   %rbp
+  803542:	48 89 e5             	mov    %rsp,%rbp
+  803545:	41 57                	push   %r15
+  803547:	53                   	push   %rbx
+  803548:	48 83 ec 30          	sub    $0x30,%rsp
+  80354c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80354c <nsipc_accept+0xb>
+  803553:	49 bb e4 4a 00 00 00 	movabs $0x4ae4,%r11
+  80355a:	00 00 00 
+  80355d:	4c 01 db             	add    %r11,%rbx
+  803560:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803563:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803567:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80356b:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  803572:	00 00 00 
+  803575:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803578:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80357b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803580:	48 b8 da b3 ff ff ff 	movabs $0xffffffffffffb3da,%rax
+  803587:	ff ff ff 
+  80358a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80358e:	ff d0                	call   *%rax
+  803590:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803593:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803597:	78 48                	js     8035e1 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  803599:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  8035a0:	00 00 00 
+  8035a3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035a7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8035ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035af:	8b 40 10             	mov    0x10(%rax),%eax
+  8035b2:	89 c2                	mov    %eax,%edx
+  8035b4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8035b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035bc:	48 89 ce             	mov    %rcx,%rsi
+  8035bf:	48 89 c7             	mov    %rax,%rdi
+  8035c2:	49 89 df             	mov    %rbx,%r15
+  8035c5:	48 b8 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rax
+  8035cc:	ff ff ff 
+  8035cf:	48 01 d8             	add    %rbx,%rax
+  8035d2:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8035d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035d8:	8b 50 10             	mov    0x10(%rax),%edx
+  8035db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035df:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8035e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8035e4:	48 83 c4 30          	add    $0x30,%rsp
+  8035e8:	5b                   	pop    %rbx
+  8035e9:	41 5f                	pop    %r15
+  8035eb:	5d                   	pop    %rbp
+  8035ec:	c3                   	ret
+
+00000000008035ed <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8035ed:	55                   	push   %rbp
+  8035ee:	48 89 e5             	mov    %rsp,%rbp
+  8035f1:	41 57                	push   %r15
+  8035f3:	53                   	push   %rbx
+  8035f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8035f8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035f8 <nsipc_bind+0xb>
+  8035ff:	49 bb 38 4a 00 00 00 	movabs $0x4a38,%r11
+  803606:	00 00 00 
+  803609:	4c 01 db             	add    %r11,%rbx
+  80360c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80360f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803613:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  803616:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80361d:	00 00 00 
+  803620:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803623:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803626:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803629:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80362d:	48 89 c6             	mov    %rax,%rsi
+  803630:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  803637:	00 00 00 
+  80363a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80363e:	48 89 c7             	mov    %rax,%rdi
+  803641:	49 89 df             	mov    %rbx,%r15
+  803644:	48 b8 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rax
+  80364b:	ff ff ff 
+  80364e:	48 01 d8             	add    %rbx,%rax
+  803651:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  803653:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80365a:	00 00 00 
+  80365d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803660:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  803664:	bf 02 00 00 00       	mov    $0x2,%edi
+  803669:	48 b8 da b3 ff ff ff 	movabs $0xffffffffffffb3da,%rax
+  803670:	ff ff ff 
+  803673:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803677:	ff d0                	call   *%rax
+}
+  803679:	48 83 c4 10          	add    $0x10,%rsp
+  80367d:	5b                   	pop    %rbx
+  80367e:	41 5f                	pop    %r15
+  803680:	5d                   	pop    %rbp
+  803681:	c3                   	ret
+
+0000000000803682 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803682:	55                   	push   %rbp
+  803683:	48 89 e5             	mov    %rsp,%rbp
+  803686:	48 83 ec 20          	sub    $0x20,%rsp
+  80368a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80368a <nsipc_shutdown+0x8>
+  803691:	49 bb a6 49 00 00 00 	movabs $0x49a6,%r11
+  803698:	00 00 00 
+  80369b:	4c 01 d8             	add    %r11,%rax
+  80369e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8036a1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8036a4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8036a7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8036aa:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8036ad:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8036b0:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8036b4:	ba 08 00 00 00       	mov    $0x8,%edx
+  8036b9:	48 89 ce             	mov    %rcx,%rsi
+  8036bc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8036c1:	48 b9 7d b4 ff ff ff 	movabs $0xffffffffffffb47d,%rcx
+  8036c8:	ff ff ff 
+  8036cb:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8036cf:	ff d0                	call   *%rax
+}
+  8036d1:	c9                   	leave
+  8036d2:	c3                   	ret
+
+00000000008036d3 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8036d3:	55                   	push   %rbp
+  8036d4:	48 89 e5             	mov    %rsp,%rbp
+  8036d7:	48 83 ec 20          	sub    $0x20,%rsp
+  8036db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8036db <nsipc_close+0x8>
+  8036e2:	49 bb 55 49 00 00 00 	movabs $0x4955,%r11
+  8036e9:	00 00 00 
+  8036ec:	4c 01 d8             	add    %r11,%rax
+  8036ef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8036f2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8036f5:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8036f8:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8036fc:	ba 04 00 00 00       	mov    $0x4,%edx
+  803701:	48 89 ce             	mov    %rcx,%rsi
+  803704:	bf 04 00 00 00       	mov    $0x4,%edi
+  803709:	48 b9 7d b4 ff ff ff 	movabs $0xffffffffffffb47d,%rcx
+  803710:	ff ff ff 
+  803713:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803717:	ff d0                	call   *%rax
+}
+  803719:	c9                   	leave
+  80371a:	c3                   	ret
+
+000000000080371b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80371b:	55                   	push   %rbp
+  80371c:	48 89 e5             	mov    %rsp,%rbp
+  80371f:	41 57                	push   %r15
+  803721:	53                   	push   %rbx
+  803722:	48 83 ec 10          	sub    $0x10,%rsp
+  803726:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803726 <nsipc_connect+0xb>
+  80372d:	49 bb 0a 49 00 00 00 	movabs $0x490a,%r11
+  803734:	00 00 00 
+  803737:	4c 01 db             	add    %r11,%rbx
+  80373a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80373d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803741:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  803744:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80374b:	00 00 00 
+  80374e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803751:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803754:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803757:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80375b:	48 89 c6             	mov    %rax,%rsi
+  80375e:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  803765:	00 00 00 
+  803768:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80376c:	48 89 c7             	mov    %rax,%rdi
+  80376f:	49 89 df             	mov    %rbx,%r15
+  803772:	48 b8 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rax
+  803779:	ff ff ff 
+  80377c:	48 01 d8             	add    %rbx,%rax
+  80377f:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  803781:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  803788:	00 00 00 
+  80378b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80378e:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  803792:	bf 05 00 00 00       	mov    $0x5,%edi
+  803797:	48 b8 da b3 ff ff ff 	movabs $0xffffffffffffb3da,%rax
+  80379e:	ff ff ff 
+  8037a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037a5:	ff d0                	call   *%rax
+}
+  8037a7:	48 83 c4 10          	add    $0x10,%rsp
+  8037ab:	5b                   	pop    %rbx
+  8037ac:	41 5f                	pop    %r15
+  8037ae:	5d                   	pop    %rbp
+  8037af:	c3                   	ret
+
+00000000008037b0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8037b0:	55                   	push   %rbp
+  8037b1:	48 89 e5             	mov    %rsp,%rbp
+  8037b4:	48 83 ec 20          	sub    $0x20,%rsp
+  8037b8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8037b8 <nsipc_listen+0x8>
+  8037bf:	49 bb 78 48 00 00 00 	movabs $0x4878,%r11
+  8037c6:	00 00 00 
+  8037c9:	4c 01 d8             	add    %r11,%rax
+  8037cc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8037cf:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8037d2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8037d5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8037d8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8037db:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8037de:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8037e2:	ba 08 00 00 00       	mov    $0x8,%edx
+  8037e7:	48 89 ce             	mov    %rcx,%rsi
+  8037ea:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037ef:	48 b9 7d b4 ff ff ff 	movabs $0xffffffffffffb47d,%rcx
+  8037f6:	ff ff ff 
+  8037f9:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8037fd:	ff d0                	call   *%rax
+}
+  8037ff:	c9                   	leave
+  803800:	c3                   	ret
+
+0000000000803801 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803801:	55                   	push   %rbp
+  803802:	48 89 e5             	mov    %rsp,%rbp
+  803805:	41 57                	push   %r15
+  803807:	53                   	push   %rbx
+  803808:	48 83 ec 30          	sub    $0x30,%rsp
+  80380c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80380c <nsipc_recv+0xb>
+  803813:	49 bb 24 48 00 00 00 	movabs $0x4824,%r11
+  80381a:	00 00 00 
+  80381d:	4c 01 db             	add    %r11,%rbx
+  803820:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803823:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803827:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  80382a:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80382d:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  803834:	00 00 00 
+  803837:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80383a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  80383d:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  803844:	00 00 00 
+  803847:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80384a:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  80384e:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  803855:	00 00 00 
+  803858:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80385b:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80385f:	bf 07 00 00 00       	mov    $0x7,%edi
+  803864:	48 b8 da b3 ff ff ff 	movabs $0xffffffffffffb3da,%rax
+  80386b:	ff ff ff 
+  80386e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803872:	ff d0                	call   *%rax
+  803874:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803877:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80387b:	0f 88 91 00 00 00    	js     803912 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  803881:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  803888:	7f 08                	jg     803892 <nsipc_recv+0x91>
+  80388a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80388d:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  803890:	7e 50                	jle    8038e2 <nsipc_recv+0xe1>
+  803892:	48 b8 2b e0 ff ff ff 	movabs $0xffffffffffffe02b,%rax
+  803899:	ff ff ff 
+  80389c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038a0:	48 89 c1             	mov    %rax,%rcx
+  8038a3:	48 b8 40 e0 ff ff ff 	movabs $0xffffffffffffe040,%rax
+  8038aa:	ff ff ff 
+  8038ad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038b1:	48 89 c2             	mov    %rax,%rdx
+  8038b4:	be 79 00 00 00       	mov    $0x79,%esi
+  8038b9:	48 b8 55 e0 ff ff ff 	movabs $0xffffffffffffe055,%rax
+  8038c0:	ff ff ff 
+  8038c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038c7:	48 89 c7             	mov    %rax,%rdi
+  8038ca:	49 89 df             	mov    %rbx,%r15
+  8038cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d2:	49 b8 83 c6 ff ff ff 	movabs $0xffffffffffffc683,%r8
+  8038d9:	ff ff ff 
+  8038dc:	49 01 d8             	add    %rbx,%r8
+  8038df:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8038e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038e5:	48 63 d0             	movslq %eax,%rdx
+  8038e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038ec:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  8038f3:	00 00 00 
+  8038f6:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8038fa:	48 89 ce             	mov    %rcx,%rsi
+  8038fd:	48 89 c7             	mov    %rax,%rdi
+  803900:	49 89 df             	mov    %rbx,%r15
+  803903:	48 b8 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rax
+  80390a:	ff ff ff 
+  80390d:	48 01 d8             	add    %rbx,%rax
+  803910:	ff d0                	call   *%rax
+	}
+
+	return r;
+  803912:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803915:	48 83 c4 30          	add    $0x30,%rsp
+  803919:	5b                   	pop    %rbx
+  80391a:	41 5f                	pop    %r15
+  80391c:	5d                   	pop    %rbp
+  80391d:	c3                   	ret
+
+000000000080391e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80391e:	55                   	push   %rbp
+  80391f:	48 89 e5             	mov    %rsp,%rbp
+  803922:	41 57                	push   %r15
+  803924:	53                   	push   %rbx
+  803925:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80392c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80392c <nsipc_send+0xe>
+  803933:	49 bb 04 47 00 00 00 	movabs $0x4704,%r11
+  80393a:	00 00 00 
+  80393d:	4c 01 db             	add    %r11,%rbx
+  803940:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  803946:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  80394d:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  803953:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  803959:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80395d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  803961:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  803968:	00 00 00 
+  80396b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80396e:	85 c0                	test   %eax,%eax
+  803970:	75 24                	jne    803996 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803972:	bf 02 00 00 00       	mov    $0x2,%edi
+  803977:	49 89 df             	mov    %rbx,%r15
+  80397a:	48 b8 c5 dd ff ff ff 	movabs $0xffffffffffffddc5,%rax
+  803981:	ff ff ff 
+  803984:	48 01 d8             	add    %rbx,%rax
+  803987:	ff d0                	call   *%rax
+  803989:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  803990:	00 00 00 
+  803993:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  803996:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80399c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80399f:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8039a6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8039a9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8039ac:	39 c2                	cmp    %eax,%edx
+  8039ae:	0f 4e c2             	cmovle %edx,%eax
+  8039b1:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8039b7:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8039bd:	48 63 d0             	movslq %eax,%rdx
+  8039c0:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8039c7:	48 89 c6             	mov    %rax,%rsi
+  8039ca:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  8039d1:	00 00 00 
+  8039d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039d8:	48 89 c7             	mov    %rax,%rdi
+  8039db:	49 89 df             	mov    %rbx,%r15
+  8039de:	48 b8 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rax
+  8039e5:	ff ff ff 
+  8039e8:	48 01 d8             	add    %rbx,%rax
+  8039eb:	ff d0                	call   *%rax
+	req->req_s = s;
+  8039ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039f1:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  8039f7:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  8039f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039fd:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  803a03:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  803a06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a0a:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  803a10:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  803a13:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  803a1a:	00 00 00 
+  803a1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a21:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  803a25:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  803a2c:	00 
+  803a2d:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  803a33:	48 63 d0             	movslq %eax,%rdx
+  803a36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a3a:	48 01 d0             	add    %rdx,%rax
+  803a3d:	48 83 e8 01          	sub    $0x1,%rax
+  803a41:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  803a45:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a49:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a4e:	48 f7 75 d8          	divq   -0x28(%rbp)
+  803a52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a56:	48 29 d0             	sub    %rdx,%rax
+  803a59:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  803a5f:	85 c0                	test   %eax,%eax
+  803a61:	0f 48 c2             	cmovs  %edx,%eax
+  803a64:	c1 f8 0c             	sar    $0xc,%eax
+  803a67:	48 98                	cltq
+  803a69:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  803a6d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  803a71:	48 85 c0             	test   %rax,%rax
+  803a74:	0f 95 c0             	setne  %al
+  803a77:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  803a7a:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  803a81:	00 
+  803a82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a86:	48 83 c0 0b          	add    $0xb,%rax
+  803a8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a8e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a92:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a97:	48 f7 75 c8          	divq   -0x38(%rbp)
+  803a9b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a9f:	48 29 d0             	sub    %rdx,%rax
+  803aa2:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  803aa6:	89 c7                	mov    %eax,%edi
+  803aa8:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  803aaf:	00 00 00 
+  803ab2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803ab5:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  803ab9:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  803abd:	48 83 ec 08          	sub    $0x8,%rsp
+  803ac1:	6a 00                	push   $0x0
+  803ac3:	6a 00                	push   $0x0
+  803ac5:	6a 05                	push   $0x5
+  803ac7:	41 89 f1             	mov    %esi,%r9d
+  803aca:	49 89 c8             	mov    %rcx,%r8
+  803acd:	89 f9                	mov    %edi,%ecx
+  803acf:	be 08 00 00 00       	mov    $0x8,%esi
+  803ad4:	89 c7                	mov    %eax,%edi
+  803ad6:	49 89 df             	mov    %rbx,%r15
+  803ad9:	48 b8 cd d9 ff ff ff 	movabs $0xffffffffffffd9cd,%rax
+  803ae0:	ff ff ff 
+  803ae3:	48 01 d8             	add    %rbx,%rax
+  803ae6:	ff d0                	call   *%rax
+  803ae8:	48 83 c4 20          	add    $0x20,%rsp
+}
+  803aec:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803af0:	5b                   	pop    %rbx
+  803af1:	41 5f                	pop    %r15
+  803af3:	5d                   	pop    %rbp
+  803af4:	c3                   	ret
+
+0000000000803af5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803af5:	55                   	push   %rbp
+  803af6:	48 89 e5             	mov    %rsp,%rbp
+  803af9:	48 83 ec 10          	sub    $0x10,%rsp
+  803afd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803afd <nsipc_socket+0x8>
+  803b04:	49 bb 33 45 00 00 00 	movabs $0x4533,%r11
+  803b0b:	00 00 00 
+  803b0e:	4c 01 d8             	add    %r11,%rax
+  803b11:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803b14:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  803b17:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  803b1a:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  803b21:	00 00 00 
+  803b24:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803b27:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  803b2a:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  803b31:	00 00 00 
+  803b34:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803b37:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  803b3b:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  803b42:	00 00 00 
+  803b45:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803b48:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  803b4c:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b51:	48 ba da b3 ff ff ff 	movabs $0xffffffffffffb3da,%rdx
+  803b58:	ff ff ff 
+  803b5b:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803b5f:	ff d0                	call   *%rax
+}
+  803b61:	c9                   	leave
+  803b62:	c3                   	ret
+
+0000000000803b63 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  803b63:	55                   	push   %rbp
+  803b64:	48 89 e5             	mov    %rsp,%rbp
+  803b67:	41 57                	push   %r15
+  803b69:	53                   	push   %rbx
+  803b6a:	48 83 ec 30          	sub    $0x30,%rsp
+  803b6e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b6e <pipe+0xb>
+  803b75:	49 bb c2 44 00 00 00 	movabs $0x44c2,%r11
+  803b7c:	00 00 00 
+  803b7f:	4c 01 db             	add    %r11,%rbx
+  803b82:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  803b86:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  803b8a:	48 89 c7             	mov    %rax,%rdi
+  803b8d:	49 89 df             	mov    %rbx,%r15
+  803b90:	48 b8 f4 97 ff ff ff 	movabs $0xffffffffffff97f4,%rax
+  803b97:	ff ff ff 
+  803b9a:	48 01 d8             	add    %rbx,%rax
+  803b9d:	ff d0                	call   *%rax
+  803b9f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ba2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ba6:	0f 88 12 02 00 00    	js     803dbe <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803bac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bb0:	ba 07 04 00 00       	mov    $0x407,%edx
+  803bb5:	48 89 c6             	mov    %rax,%rsi
+  803bb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bbd:	49 89 df             	mov    %rbx,%r15
+  803bc0:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  803bc7:	ff ff ff 
+  803bca:	48 01 d8             	add    %rbx,%rax
+  803bcd:	ff d0                	call   *%rax
+  803bcf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bd2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bd6:	0f 88 e2 01 00 00    	js     803dbe <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  803bdc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803be0:	48 89 c7             	mov    %rax,%rdi
+  803be3:	49 89 df             	mov    %rbx,%r15
+  803be6:	48 b8 f4 97 ff ff ff 	movabs $0xffffffffffff97f4,%rax
+  803bed:	ff ff ff 
+  803bf0:	48 01 d8             	add    %rbx,%rax
+  803bf3:	ff d0                	call   *%rax
+  803bf5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bf8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bfc:	0f 88 9b 01 00 00    	js     803d9d <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c02:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c06:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c0b:	48 89 c6             	mov    %rax,%rsi
+  803c0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c13:	49 89 df             	mov    %rbx,%r15
+  803c16:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  803c1d:	ff ff ff 
+  803c20:	48 01 d8             	add    %rbx,%rax
+  803c23:	ff d0                	call   *%rax
+  803c25:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c28:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c2c:	0f 88 6b 01 00 00    	js     803d9d <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  803c32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c36:	48 89 c7             	mov    %rax,%rdi
+  803c39:	49 89 df             	mov    %rbx,%r15
+  803c3c:	48 b8 b1 97 ff ff ff 	movabs $0xffffffffffff97b1,%rax
+  803c43:	ff ff ff 
+  803c46:	48 01 d8             	add    %rbx,%rax
+  803c49:	ff d0                	call   *%rax
+  803c4b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c4f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c53:	ba 07 04 00 00       	mov    $0x407,%edx
+  803c58:	48 89 c6             	mov    %rax,%rsi
+  803c5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c60:	49 89 df             	mov    %rbx,%r15
+  803c63:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  803c6a:	ff ff ff 
+  803c6d:	48 01 d8             	add    %rbx,%rax
+  803c70:	ff d0                	call   *%rax
+  803c72:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c75:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c79:	0f 88 fd 00 00 00    	js     803d7c <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c7f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c83:	48 89 c7             	mov    %rax,%rdi
+  803c86:	49 89 df             	mov    %rbx,%r15
+  803c89:	48 b8 b1 97 ff ff ff 	movabs $0xffffffffffff97b1,%rax
+  803c90:	ff ff ff 
+  803c93:	48 01 d8             	add    %rbx,%rax
+  803c96:	ff d0                	call   *%rax
+  803c98:	48 89 c2             	mov    %rax,%rdx
+  803c9b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c9f:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803ca5:	48 89 d1             	mov    %rdx,%rcx
+  803ca8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cad:	48 89 c6             	mov    %rax,%rsi
+  803cb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb5:	49 89 df             	mov    %rbx,%r15
+  803cb8:	48 b8 36 90 ff ff ff 	movabs $0xffffffffffff9036,%rax
+  803cbf:	ff ff ff 
+  803cc2:	48 01 d8             	add    %rbx,%rax
+  803cc5:	ff d0                	call   *%rax
+  803cc7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cce:	0f 88 87 00 00 00    	js     803d5b <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  803cd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cd8:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  803cdf:	00 00 00 
+  803ce2:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803ce5:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  803ce7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ceb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  803cf2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cf6:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  803cfd:	00 00 00 
+  803d00:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803d03:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  803d05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d09:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  803d10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d14:	48 89 c7             	mov    %rax,%rdi
+  803d17:	49 89 df             	mov    %rbx,%r15
+  803d1a:	48 b8 7a 97 ff ff ff 	movabs $0xffffffffffff977a,%rax
+  803d21:	ff ff ff 
+  803d24:	48 01 d8             	add    %rbx,%rax
+  803d27:	ff d0                	call   *%rax
+  803d29:	89 c2                	mov    %eax,%edx
+  803d2b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d2f:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  803d31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d35:	48 89 c7             	mov    %rax,%rdi
+  803d38:	49 89 df             	mov    %rbx,%r15
+  803d3b:	48 b8 7a 97 ff ff ff 	movabs $0xffffffffffff977a,%rax
+  803d42:	ff ff ff 
+  803d45:	48 01 d8             	add    %rbx,%rax
+  803d48:	ff d0                	call   *%rax
+  803d4a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803d4e:	48 83 c2 04          	add    $0x4,%rdx
+  803d52:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  803d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d59:	eb 67                	jmp    803dc2 <pipe+0x25f>
+		goto err3;
+  803d5b:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  803d5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d60:	48 89 c6             	mov    %rax,%rsi
+  803d63:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d68:	49 89 df             	mov    %rbx,%r15
+  803d6b:	48 b8 a9 90 ff ff ff 	movabs $0xffffffffffff90a9,%rax
+  803d72:	ff ff ff 
+  803d75:	48 01 d8             	add    %rbx,%rax
+  803d78:	ff d0                	call   *%rax
+  803d7a:	eb 01                	jmp    803d7d <pipe+0x21a>
+		goto err2;
+  803d7c:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  803d7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d81:	48 89 c6             	mov    %rax,%rsi
+  803d84:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d89:	49 89 df             	mov    %rbx,%r15
+  803d8c:	48 b8 a9 90 ff ff ff 	movabs $0xffffffffffff90a9,%rax
+  803d93:	ff ff ff 
+  803d96:	48 01 d8             	add    %rbx,%rax
+  803d99:	ff d0                	call   *%rax
+  803d9b:	eb 01                	jmp    803d9e <pipe+0x23b>
+		goto err1;
+  803d9d:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  803d9e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803da2:	48 89 c6             	mov    %rax,%rsi
+  803da5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803daa:	49 89 df             	mov    %rbx,%r15
+  803dad:	48 b8 a9 90 ff ff ff 	movabs $0xffffffffffff90a9,%rax
+  803db4:	ff ff ff 
+  803db7:	48 01 d8             	add    %rbx,%rax
+  803dba:	ff d0                	call   *%rax
+  803dbc:	eb 01                	jmp    803dbf <pipe+0x25c>
+		goto err;
+  803dbe:	90                   	nop
+err:
+	return r;
+  803dbf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803dc2:	48 83 c4 30          	add    $0x30,%rsp
+  803dc6:	5b                   	pop    %rbx
+  803dc7:	41 5f                	pop    %r15
+  803dc9:	5d                   	pop    %rbp
+  803dca:	c3                   	ret
+
+0000000000803dcb <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803dcb:	55                   	push   %rbp
+  803dcc:	48 89 e5             	mov    %rsp,%rbp
+  803dcf:	41 57                	push   %r15
+  803dd1:	41 54                	push   %r12
+  803dd3:	53                   	push   %rbx
+  803dd4:	48 83 ec 28          	sub    $0x28,%rsp
+  803dd8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803dd8 <_pipeisclosed+0xd>
+  803ddf:	49 bb 58 42 00 00 00 	movabs $0x4258,%r11
+  803de6:	00 00 00 
+  803de9:	4c 01 db             	add    %r11,%rbx
+  803dec:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803df0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803df4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803dfb:	ff ff ff 
+  803dfe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803e02:	48 8b 00             	mov    (%rax),%rax
+  803e05:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  803e0b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  803e0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e12:	48 89 c7             	mov    %rax,%rdi
+  803e15:	49 89 df             	mov    %rbx,%r15
+  803e18:	48 b8 54 de ff ff ff 	movabs $0xffffffffffffde54,%rax
+  803e1f:	ff ff ff 
+  803e22:	48 01 d8             	add    %rbx,%rax
+  803e25:	ff d0                	call   *%rax
+  803e27:	41 89 c4             	mov    %eax,%r12d
+  803e2a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e2e:	48 89 c7             	mov    %rax,%rdi
+  803e31:	49 89 df             	mov    %rbx,%r15
+  803e34:	48 b8 54 de ff ff ff 	movabs $0xffffffffffffde54,%rax
+  803e3b:	ff ff ff 
+  803e3e:	48 01 d8             	add    %rbx,%rax
+  803e41:	ff d0                	call   *%rax
+  803e43:	41 39 c4             	cmp    %eax,%r12d
+  803e46:	0f 94 c0             	sete   %al
+  803e49:	0f b6 c0             	movzbl %al,%eax
+  803e4c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  803e4f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803e56:	ff ff ff 
+  803e59:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803e5d:	48 8b 00             	mov    (%rax),%rax
+  803e60:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  803e66:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  803e69:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e6c:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  803e6f:	75 05                	jne    803e76 <_pipeisclosed+0xab>
+			return ret;
+  803e71:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803e74:	eb 63                	jmp    803ed9 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  803e76:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e79:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  803e7c:	0f 84 72 ff ff ff    	je     803df4 <_pipeisclosed+0x29>
+  803e82:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  803e86:	0f 85 68 ff ff ff    	jne    803df4 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803e8c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803e93:	ff ff ff 
+  803e96:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803e9a:	48 8b 00             	mov    (%rax),%rax
+  803e9d:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  803ea3:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  803ea6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ea9:	89 c6                	mov    %eax,%esi
+  803eab:	48 b8 66 e0 ff ff ff 	movabs $0xffffffffffffe066,%rax
+  803eb2:	ff ff ff 
+  803eb5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eb9:	48 89 c7             	mov    %rax,%rdi
+  803ebc:	49 89 df             	mov    %rbx,%r15
+  803ebf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec4:	49 b8 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%r8
+  803ecb:	ff ff ff 
+  803ece:	49 01 d8             	add    %rbx,%r8
+  803ed1:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  803ed4:	e9 1b ff ff ff       	jmp    803df4 <_pipeisclosed+0x29>
+	}
+}
+  803ed9:	48 83 c4 28          	add    $0x28,%rsp
+  803edd:	5b                   	pop    %rbx
+  803ede:	41 5c                	pop    %r12
+  803ee0:	41 5f                	pop    %r15
+  803ee2:	5d                   	pop    %rbp
+  803ee3:	c3                   	ret
+
+0000000000803ee4 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  803ee4:	55                   	push   %rbp
+  803ee5:	48 89 e5             	mov    %rsp,%rbp
+  803ee8:	41 57                	push   %r15
+  803eea:	53                   	push   %rbx
+  803eeb:	48 83 ec 30          	sub    $0x30,%rsp
+  803eef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803eef <pipeisclosed+0xb>
+  803ef6:	49 bb 41 41 00 00 00 	movabs $0x4141,%r11
+  803efd:	00 00 00 
+  803f00:	4c 01 db             	add    %r11,%rbx
+  803f03:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803f06:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803f0a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803f0d:	48 89 d6             	mov    %rdx,%rsi
+  803f10:	89 c7                	mov    %eax,%edi
+  803f12:	49 89 df             	mov    %rbx,%r15
+  803f15:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  803f1c:	ff ff ff 
+  803f1f:	48 01 d8             	add    %rbx,%rax
+  803f22:	ff d0                	call   *%rax
+  803f24:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f27:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f2b:	79 05                	jns    803f32 <pipeisclosed+0x4e>
+		return r;
+  803f2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f30:	eb 3b                	jmp    803f6d <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  803f32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f36:	48 89 c7             	mov    %rax,%rdi
+  803f39:	49 89 df             	mov    %rbx,%r15
+  803f3c:	48 b8 b1 97 ff ff ff 	movabs $0xffffffffffff97b1,%rax
+  803f43:	ff ff ff 
+  803f46:	48 01 d8             	add    %rbx,%rax
+  803f49:	ff d0                	call   *%rax
+  803f4b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  803f4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f53:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803f57:	48 89 d6             	mov    %rdx,%rsi
+  803f5a:	48 89 c7             	mov    %rax,%rdi
+  803f5d:	48 b8 9b bd ff ff ff 	movabs $0xffffffffffffbd9b,%rax
+  803f64:	ff ff ff 
+  803f67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f6b:	ff d0                	call   *%rax
+}
+  803f6d:	48 83 c4 30          	add    $0x30,%rsp
+  803f71:	5b                   	pop    %rbx
+  803f72:	41 5f                	pop    %r15
+  803f74:	5d                   	pop    %rbp
+  803f75:	c3                   	ret
+
+0000000000803f76 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  803f76:	55                   	push   %rbp
+  803f77:	48 89 e5             	mov    %rsp,%rbp
+  803f7a:	41 57                	push   %r15
+  803f7c:	53                   	push   %rbx
+  803f7d:	48 83 ec 40          	sub    $0x40,%rsp
+  803f81:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f81 <devpipe_read+0xb>
+  803f88:	49 bb af 40 00 00 00 	movabs $0x40af,%r11
+  803f8f:	00 00 00 
+  803f92:	4c 01 db             	add    %r11,%rbx
+  803f95:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803f99:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803f9d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  803fa1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fa5:	48 89 c7             	mov    %rax,%rdi
+  803fa8:	49 89 df             	mov    %rbx,%r15
+  803fab:	48 b8 b1 97 ff ff ff 	movabs $0xffffffffffff97b1,%rax
+  803fb2:	ff ff ff 
+  803fb5:	48 01 d8             	add    %rbx,%rax
+  803fb8:	ff d0                	call   *%rax
+  803fba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  803fbe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fc2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  803fc6:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803fcd:	00 
+  803fce:	e9 a1 00 00 00       	jmp    804074 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  803fd3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803fd8:	74 09                	je     803fe3 <devpipe_read+0x6d>
+				return i;
+  803fda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fde:	e9 9f 00 00 00       	jmp    804082 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  803fe3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803fe7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803feb:	48 89 d6             	mov    %rdx,%rsi
+  803fee:	48 89 c7             	mov    %rax,%rdi
+  803ff1:	48 b8 9b bd ff ff ff 	movabs $0xffffffffffffbd9b,%rax
+  803ff8:	ff ff ff 
+  803ffb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fff:	ff d0                	call   *%rax
+  804001:	85 c0                	test   %eax,%eax
+  804003:	74 07                	je     80400c <devpipe_read+0x96>
+				return 0;
+  804005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80400a:	eb 76                	jmp    804082 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  80400c:	49 89 df             	mov    %rbx,%r15
+  80400f:	48 b8 7c 8f ff ff ff 	movabs $0xffffffffffff8f7c,%rax
+  804016:	ff ff ff 
+  804019:	48 01 d8             	add    %rbx,%rax
+  80401c:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  80401e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804022:	8b 10                	mov    (%rax),%edx
+  804024:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804028:	8b 40 04             	mov    0x4(%rax),%eax
+  80402b:	39 c2                	cmp    %eax,%edx
+  80402d:	74 a4                	je     803fd3 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80402f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804033:	8b 10                	mov    (%rax),%edx
+  804035:	89 d0                	mov    %edx,%eax
+  804037:	c1 f8 1f             	sar    $0x1f,%eax
+  80403a:	c1 e8 1b             	shr    $0x1b,%eax
+  80403d:	01 c2                	add    %eax,%edx
+  80403f:	83 e2 1f             	and    $0x1f,%edx
+  804042:	29 c2                	sub    %eax,%edx
+  804044:	89 d6                	mov    %edx,%esi
+  804046:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80404a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80404e:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804052:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804056:	48 63 c6             	movslq %esi,%rax
+  804059:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  80405e:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  804060:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804064:	8b 00                	mov    (%rax),%eax
+  804066:	8d 50 01             	lea    0x1(%rax),%edx
+  804069:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80406d:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80406f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804074:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804078:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80407c:	72 a0                	jb     80401e <devpipe_read+0xa8>
+	}
+	return i;
+  80407e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804082:	48 83 c4 40          	add    $0x40,%rsp
+  804086:	5b                   	pop    %rbx
+  804087:	41 5f                	pop    %r15
+  804089:	5d                   	pop    %rbp
+  80408a:	c3                   	ret
+
+000000000080408b <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80408b:	55                   	push   %rbp
+  80408c:	48 89 e5             	mov    %rsp,%rbp
+  80408f:	41 57                	push   %r15
+  804091:	53                   	push   %rbx
+  804092:	48 83 ec 40          	sub    $0x40,%rsp
+  804096:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804096 <devpipe_write+0xb>
+  80409d:	49 bb 9a 3f 00 00 00 	movabs $0x3f9a,%r11
+  8040a4:	00 00 00 
+  8040a7:	4c 01 db             	add    %r11,%rbx
+  8040aa:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8040ae:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8040b2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8040b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040ba:	48 89 c7             	mov    %rax,%rdi
+  8040bd:	49 89 df             	mov    %rbx,%r15
+  8040c0:	48 b8 b1 97 ff ff ff 	movabs $0xffffffffffff97b1,%rax
+  8040c7:	ff ff ff 
+  8040ca:	48 01 d8             	add    %rbx,%rax
+  8040cd:	ff d0                	call   *%rax
+  8040cf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8040d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040d7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8040db:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8040e2:	00 
+  8040e3:	e9 a0 00 00 00       	jmp    804188 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8040e8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8040ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040f0:	48 89 d6             	mov    %rdx,%rsi
+  8040f3:	48 89 c7             	mov    %rax,%rdi
+  8040f6:	48 b8 9b bd ff ff ff 	movabs $0xffffffffffffbd9b,%rax
+  8040fd:	ff ff ff 
+  804100:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804104:	ff d0                	call   *%rax
+  804106:	85 c0                	test   %eax,%eax
+  804108:	74 0a                	je     804114 <devpipe_write+0x89>
+				return 0;
+  80410a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410f:	e9 82 00 00 00       	jmp    804196 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  804114:	49 89 df             	mov    %rbx,%r15
+  804117:	48 b8 7c 8f ff ff ff 	movabs $0xffffffffffff8f7c,%rax
+  80411e:	ff ff ff 
+  804121:	48 01 d8             	add    %rbx,%rax
+  804124:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  804126:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80412a:	8b 40 04             	mov    0x4(%rax),%eax
+  80412d:	48 63 d0             	movslq %eax,%rdx
+  804130:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804134:	8b 00                	mov    (%rax),%eax
+  804136:	48 98                	cltq
+  804138:	48 83 c0 20          	add    $0x20,%rax
+  80413c:	48 39 c2             	cmp    %rax,%rdx
+  80413f:	73 a7                	jae    8040e8 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804141:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804145:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804149:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80414d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804151:	8b 50 04             	mov    0x4(%rax),%edx
+  804154:	89 d0                	mov    %edx,%eax
+  804156:	c1 f8 1f             	sar    $0x1f,%eax
+  804159:	c1 e8 1b             	shr    $0x1b,%eax
+  80415c:	01 c2                	add    %eax,%edx
+  80415e:	83 e2 1f             	and    $0x1f,%edx
+  804161:	29 c2                	sub    %eax,%edx
+  804163:	89 d0                	mov    %edx,%eax
+  804165:	0f b6 09             	movzbl (%rcx),%ecx
+  804168:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80416c:	48 98                	cltq
+  80416e:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  804172:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804176:	8b 40 04             	mov    0x4(%rax),%eax
+  804179:	8d 50 01             	lea    0x1(%rax),%edx
+  80417c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804180:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  804183:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804188:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80418c:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  804190:	72 94                	jb     804126 <devpipe_write+0x9b>
+	}
+
+	return i;
+  804192:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804196:	48 83 c4 40          	add    $0x40,%rsp
+  80419a:	5b                   	pop    %rbx
+  80419b:	41 5f                	pop    %r15
+  80419d:	5d                   	pop    %rbp
+  80419e:	c3                   	ret
+
+000000000080419f <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80419f:	55                   	push   %rbp
+  8041a0:	48 89 e5             	mov    %rsp,%rbp
+  8041a3:	41 57                	push   %r15
+  8041a5:	53                   	push   %rbx
+  8041a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8041aa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041aa <devpipe_stat+0xb>
+  8041b1:	49 bb 86 3e 00 00 00 	movabs $0x3e86,%r11
+  8041b8:	00 00 00 
+  8041bb:	4c 01 db             	add    %r11,%rbx
+  8041be:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8041c2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8041c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041ca:	48 89 c7             	mov    %rax,%rdi
+  8041cd:	49 89 df             	mov    %rbx,%r15
+  8041d0:	48 b8 b1 97 ff ff ff 	movabs $0xffffffffffff97b1,%rax
+  8041d7:	ff ff ff 
+  8041da:	48 01 d8             	add    %rbx,%rax
+  8041dd:	ff d0                	call   *%rax
+  8041df:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8041e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8041e7:	48 ba 79 e0 ff ff ff 	movabs $0xffffffffffffe079,%rdx
+  8041ee:	ff ff ff 
+  8041f1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8041f5:	48 89 d6             	mov    %rdx,%rsi
+  8041f8:	48 89 c7             	mov    %rax,%rdi
+  8041fb:	49 89 df             	mov    %rbx,%r15
+  8041fe:	48 b8 15 83 ff ff ff 	movabs $0xffffffffffff8315,%rax
+  804205:	ff ff ff 
+  804208:	48 01 d8             	add    %rbx,%rax
+  80420b:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80420d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804211:	8b 50 04             	mov    0x4(%rax),%edx
+  804214:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804218:	8b 00                	mov    (%rax),%eax
+  80421a:	29 c2                	sub    %eax,%edx
+  80421c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804220:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  804226:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80422a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804231:	00 00 00 
+	stat->st_dev = &devpipe;
+  804234:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804238:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  80423f:	00 00 00 
+  804242:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804246:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80424d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804252:	48 83 c4 20          	add    $0x20,%rsp
+  804256:	5b                   	pop    %rbx
+  804257:	41 5f                	pop    %r15
+  804259:	5d                   	pop    %rbp
+  80425a:	c3                   	ret
+
+000000000080425b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80425b:	55                   	push   %rbp
+  80425c:	48 89 e5             	mov    %rsp,%rbp
+  80425f:	41 57                	push   %r15
+  804261:	53                   	push   %rbx
+  804262:	48 83 ec 10          	sub    $0x10,%rsp
+  804266:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804266 <devpipe_close+0xb>
+  80426d:	49 bb ca 3d 00 00 00 	movabs $0x3dca,%r11
+  804274:	00 00 00 
+  804277:	4c 01 db             	add    %r11,%rbx
+  80427a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80427e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804282:	48 89 c6             	mov    %rax,%rsi
+  804285:	bf 00 00 00 00       	mov    $0x0,%edi
+  80428a:	49 89 df             	mov    %rbx,%r15
+  80428d:	48 b8 a9 90 ff ff ff 	movabs $0xffffffffffff90a9,%rax
+  804294:	ff ff ff 
+  804297:	48 01 d8             	add    %rbx,%rax
+  80429a:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80429c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042a0:	48 89 c7             	mov    %rax,%rdi
+  8042a3:	49 89 df             	mov    %rbx,%r15
+  8042a6:	48 b8 b1 97 ff ff ff 	movabs $0xffffffffffff97b1,%rax
+  8042ad:	ff ff ff 
+  8042b0:	48 01 d8             	add    %rbx,%rax
+  8042b3:	ff d0                	call   *%rax
+  8042b5:	48 89 c6             	mov    %rax,%rsi
+  8042b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042bd:	49 89 df             	mov    %rbx,%r15
+  8042c0:	48 b8 a9 90 ff ff ff 	movabs $0xffffffffffff90a9,%rax
+  8042c7:	ff ff ff 
+  8042ca:	48 01 d8             	add    %rbx,%rax
+  8042cd:	ff d0                	call   *%rax
+}
+  8042cf:	48 83 c4 10          	add    $0x10,%rsp
+  8042d3:	5b                   	pop    %rbx
+  8042d4:	41 5f                	pop    %r15
+  8042d6:	5d                   	pop    %rbp
+  8042d7:	c3                   	ret
+
+00000000008042d8 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8042d8:	55                   	push   %rbp
+  8042d9:	48 89 e5             	mov    %rsp,%rbp
+  8042dc:	41 57                	push   %r15
+  8042de:	48 83 ec 28          	sub    $0x28,%rsp
+  8042e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8042e2 <cputchar+0xa>
+  8042e9:	49 bb 4e 3d 00 00 00 	movabs $0x3d4e,%r11
+  8042f0:	00 00 00 
+  8042f3:	4c 01 d8             	add    %r11,%rax
+  8042f6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8042f9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8042fc:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8042ff:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  804303:	be 01 00 00 00       	mov    $0x1,%esi
+  804308:	48 89 d7             	mov    %rdx,%rdi
+  80430b:	49 89 c7             	mov    %rax,%r15
+  80430e:	48 ba 19 8e ff ff ff 	movabs $0xffffffffffff8e19,%rdx
+  804315:	ff ff ff 
+  804318:	48 01 c2             	add    %rax,%rdx
+  80431b:	ff d2                	call   *%rdx
+}
+  80431d:	90                   	nop
+  80431e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804322:	c9                   	leave
+  804323:	c3                   	ret
+
+0000000000804324 <getchar>:
+
+int
+getchar(void)
+{
+  804324:	55                   	push   %rbp
+  804325:	48 89 e5             	mov    %rsp,%rbp
+  804328:	41 57                	push   %r15
+  80432a:	48 83 ec 18          	sub    $0x18,%rsp
+  80432e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80432e <getchar+0xa>
+  804335:	49 bb 02 3d 00 00 00 	movabs $0x3d02,%r11
+  80433c:	00 00 00 
+  80433f:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  804342:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  804346:	ba 01 00 00 00       	mov    $0x1,%edx
+  80434b:	48 89 ce             	mov    %rcx,%rsi
+  80434e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804353:	49 89 c7             	mov    %rax,%r15
+  804356:	48 b9 f1 9d ff ff ff 	movabs $0xffffffffffff9df1,%rcx
+  80435d:	ff ff ff 
+  804360:	48 01 c1             	add    %rax,%rcx
+  804363:	ff d1                	call   *%rcx
+  804365:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  804368:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80436c:	79 05                	jns    804373 <getchar+0x4f>
+		return r;
+  80436e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804371:	eb 14                	jmp    804387 <getchar+0x63>
+	if (r < 1)
+  804373:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804377:	7f 07                	jg     804380 <getchar+0x5c>
+		return -E_EOF;
+  804379:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80437e:	eb 07                	jmp    804387 <getchar+0x63>
+	return c;
+  804380:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  804384:	0f b6 c0             	movzbl %al,%eax
+}
+  804387:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80438b:	c9                   	leave
+  80438c:	c3                   	ret
+
+000000000080438d <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80438d:	55                   	push   %rbp
+  80438e:	48 89 e5             	mov    %rsp,%rbp
+  804391:	41 57                	push   %r15
+  804393:	53                   	push   %rbx
+  804394:	48 83 ec 20          	sub    $0x20,%rsp
+  804398:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804398 <iscons+0xb>
+  80439f:	49 bb 98 3c 00 00 00 	movabs $0x3c98,%r11
+  8043a6:	00 00 00 
+  8043a9:	4c 01 db             	add    %r11,%rbx
+  8043ac:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8043af:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8043b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043b6:	48 89 d6             	mov    %rdx,%rsi
+  8043b9:	89 c7                	mov    %eax,%edi
+  8043bb:	49 89 df             	mov    %rbx,%r15
+  8043be:	48 b8 aa 98 ff ff ff 	movabs $0xffffffffffff98aa,%rax
+  8043c5:	ff ff ff 
+  8043c8:	48 01 d8             	add    %rbx,%rax
+  8043cb:	ff d0                	call   *%rax
+  8043cd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043d4:	79 05                	jns    8043db <iscons+0x4e>
+		return r;
+  8043d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043d9:	eb 1b                	jmp    8043f6 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8043db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043df:	8b 10                	mov    (%rax),%edx
+  8043e1:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  8043e8:	00 00 00 
+  8043eb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8043ee:	39 c2                	cmp    %eax,%edx
+  8043f0:	0f 94 c0             	sete   %al
+  8043f3:	0f b6 c0             	movzbl %al,%eax
+}
+  8043f6:	48 83 c4 20          	add    $0x20,%rsp
+  8043fa:	5b                   	pop    %rbx
+  8043fb:	41 5f                	pop    %r15
+  8043fd:	5d                   	pop    %rbp
+  8043fe:	c3                   	ret
+
+00000000008043ff <opencons>:
+
+int
+opencons(void)
+{
+  8043ff:	55                   	push   %rbp
+  804400:	48 89 e5             	mov    %rsp,%rbp
+  804403:	41 57                	push   %r15
+  804405:	53                   	push   %rbx
+  804406:	48 83 ec 10          	sub    $0x10,%rsp
+  80440a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80440a <opencons+0xb>
+  804411:	49 bb 26 3c 00 00 00 	movabs $0x3c26,%r11
+  804418:	00 00 00 
+  80441b:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  80441e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804422:	48 89 c7             	mov    %rax,%rdi
+  804425:	49 89 df             	mov    %rbx,%r15
+  804428:	48 b8 f4 97 ff ff ff 	movabs $0xffffffffffff97f4,%rax
+  80442f:	ff ff ff 
+  804432:	48 01 d8             	add    %rbx,%rax
+  804435:	ff d0                	call   *%rax
+  804437:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80443a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80443e:	79 05                	jns    804445 <opencons+0x46>
+		return r;
+  804440:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804443:	eb 68                	jmp    8044ad <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804445:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804449:	ba 07 04 00 00       	mov    $0x407,%edx
+  80444e:	48 89 c6             	mov    %rax,%rsi
+  804451:	bf 00 00 00 00       	mov    $0x0,%edi
+  804456:	49 89 df             	mov    %rbx,%r15
+  804459:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  804460:	ff ff ff 
+  804463:	48 01 d8             	add    %rbx,%rax
+  804466:	ff d0                	call   *%rax
+  804468:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80446b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80446f:	79 05                	jns    804476 <opencons+0x77>
+		return r;
+  804471:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804474:	eb 37                	jmp    8044ad <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  804476:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80447a:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  804481:	00 00 00 
+  804484:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804487:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  804489:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80448d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  804494:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804498:	48 89 c7             	mov    %rax,%rdi
+  80449b:	49 89 df             	mov    %rbx,%r15
+  80449e:	48 b8 7a 97 ff ff ff 	movabs $0xffffffffffff977a,%rax
+  8044a5:	ff ff ff 
+  8044a8:	48 01 d8             	add    %rbx,%rax
+  8044ab:	ff d0                	call   *%rax
+}
+  8044ad:	48 83 c4 10          	add    $0x10,%rsp
+  8044b1:	5b                   	pop    %rbx
+  8044b2:	41 5f                	pop    %r15
+  8044b4:	5d                   	pop    %rbp
+  8044b5:	c3                   	ret
+
+00000000008044b6 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8044b6:	55                   	push   %rbp
+  8044b7:	48 89 e5             	mov    %rsp,%rbp
+  8044ba:	41 57                	push   %r15
+  8044bc:	53                   	push   %rbx
+  8044bd:	48 83 ec 30          	sub    $0x30,%rsp
+  8044c1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044c1 <devcons_read+0xb>
+  8044c8:	49 bb 6f 3b 00 00 00 	movabs $0x3b6f,%r11
+  8044cf:	00 00 00 
+  8044d2:	4c 01 db             	add    %r11,%rbx
+  8044d5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044d9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8044dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8044e1:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8044e6:	75 19                	jne    804501 <devcons_read+0x4b>
+		return 0;
+  8044e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ed:	eb 55                	jmp    804544 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8044ef:	49 89 df             	mov    %rbx,%r15
+  8044f2:	48 b8 7c 8f ff ff ff 	movabs $0xffffffffffff8f7c,%rax
+  8044f9:	ff ff ff 
+  8044fc:	48 01 d8             	add    %rbx,%rax
+  8044ff:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  804501:	49 89 df             	mov    %rbx,%r15
+  804504:	48 b8 78 8e ff ff ff 	movabs $0xffffffffffff8e78,%rax
+  80450b:	ff ff ff 
+  80450e:	48 01 d8             	add    %rbx,%rax
+  804511:	ff d0                	call   *%rax
+  804513:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804516:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80451a:	74 d3                	je     8044ef <devcons_read+0x39>
+	if (c < 0)
+  80451c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804520:	79 05                	jns    804527 <devcons_read+0x71>
+		return c;
+  804522:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804525:	eb 1d                	jmp    804544 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  804527:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80452b:	75 07                	jne    804534 <devcons_read+0x7e>
+		return 0;
+  80452d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804532:	eb 10                	jmp    804544 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  804534:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804537:	89 c2                	mov    %eax,%edx
+  804539:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80453d:	88 10                	mov    %dl,(%rax)
+	return 1;
+  80453f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804544:	48 83 c4 30          	add    $0x30,%rsp
+  804548:	5b                   	pop    %rbx
+  804549:	41 5f                	pop    %r15
+  80454b:	5d                   	pop    %rbp
+  80454c:	c3                   	ret
+
+000000000080454d <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80454d:	55                   	push   %rbp
+  80454e:	48 89 e5             	mov    %rsp,%rbp
+  804551:	41 57                	push   %r15
+  804553:	53                   	push   %rbx
+  804554:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80455b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80455b <devcons_write+0xe>
+  804562:	49 bb d5 3a 00 00 00 	movabs $0x3ad5,%r11
+  804569:	00 00 00 
+  80456c:	4c 01 db             	add    %r11,%rbx
+  80456f:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  804576:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  80457d:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  804584:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80458b:	e9 80 00 00 00       	jmp    804610 <devcons_write+0xc3>
+		m = n - tot;
+  804590:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804597:	89 c2                	mov    %eax,%edx
+  804599:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80459c:	29 c2                	sub    %eax,%edx
+  80459e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8045a1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045a4:	83 f8 7f             	cmp    $0x7f,%eax
+  8045a7:	76 07                	jbe    8045b0 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8045a9:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8045b0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045b3:	48 63 d0             	movslq %eax,%rdx
+  8045b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045b9:	48 63 c8             	movslq %eax,%rcx
+  8045bc:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8045c3:	48 01 c1             	add    %rax,%rcx
+  8045c6:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8045cd:	48 89 ce             	mov    %rcx,%rsi
+  8045d0:	48 89 c7             	mov    %rax,%rdi
+  8045d3:	49 89 df             	mov    %rbx,%r15
+  8045d6:	48 b8 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rax
+  8045dd:	ff ff ff 
+  8045e0:	48 01 d8             	add    %rbx,%rax
+  8045e3:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8045e5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045e8:	48 63 d0             	movslq %eax,%rdx
+  8045eb:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8045f2:	48 89 d6             	mov    %rdx,%rsi
+  8045f5:	48 89 c7             	mov    %rax,%rdi
+  8045f8:	49 89 df             	mov    %rbx,%r15
+  8045fb:	48 b8 19 8e ff ff ff 	movabs $0xffffffffffff8e19,%rax
+  804602:	ff ff ff 
+  804605:	48 01 d8             	add    %rbx,%rax
+  804608:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80460a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80460d:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804610:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804613:	48 98                	cltq
+  804615:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  80461c:	0f 82 6e ff ff ff    	jb     804590 <devcons_write+0x43>
+	}
+	return tot;
+  804622:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804625:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  80462c:	5b                   	pop    %rbx
+  80462d:	41 5f                	pop    %r15
+  80462f:	5d                   	pop    %rbp
+  804630:	c3                   	ret
+
+0000000000804631 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  804631:	55                   	push   %rbp
+  804632:	48 89 e5             	mov    %rsp,%rbp
+  804635:	48 83 ec 08          	sub    $0x8,%rsp
+  804639:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804639 <devcons_close+0x8>
+  804640:	49 bb f7 39 00 00 00 	movabs $0x39f7,%r11
+  804647:	00 00 00 
+  80464a:	4c 01 d8             	add    %r11,%rax
+  80464d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  804651:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804656:	c9                   	leave
+  804657:	c3                   	ret
+
+0000000000804658 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804658:	55                   	push   %rbp
+  804659:	48 89 e5             	mov    %rsp,%rbp
+  80465c:	41 57                	push   %r15
+  80465e:	48 83 ec 18          	sub    $0x18,%rsp
+  804662:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804662 <devcons_stat+0xa>
+  804669:	49 bb ce 39 00 00 00 	movabs $0x39ce,%r11
+  804670:	00 00 00 
+  804673:	4c 01 d8             	add    %r11,%rax
+  804676:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80467a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80467e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804682:	48 b9 85 e0 ff ff ff 	movabs $0xffffffffffffe085,%rcx
+  804689:	ff ff ff 
+  80468c:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804690:	48 89 ce             	mov    %rcx,%rsi
+  804693:	48 89 d7             	mov    %rdx,%rdi
+  804696:	49 89 c7             	mov    %rax,%r15
+  804699:	48 ba 15 83 ff ff ff 	movabs $0xffffffffffff8315,%rdx
+  8046a0:	ff ff ff 
+  8046a3:	48 01 c2             	add    %rax,%rdx
+  8046a6:	ff d2                	call   *%rdx
+	return 0;
+  8046a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046ad:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8046b1:	c9                   	leave
+  8046b2:	c3                   	ret
+
+00000000008046b3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8046b3:	55                   	push   %rbp
+  8046b4:	48 89 e5             	mov    %rsp,%rbp
+  8046b7:	41 57                	push   %r15
+  8046b9:	41 54                	push   %r12
+  8046bb:	53                   	push   %rbx
+  8046bc:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8046c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046c3 <_panic+0x10>
+  8046ca:	49 bb 6d 39 00 00 00 	movabs $0x396d,%r11
+  8046d1:	00 00 00 
+  8046d4:	4c 01 db             	add    %r11,%rbx
+  8046d7:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8046de:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8046e4:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8046eb:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8046f2:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8046f9:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  804700:	84 c0                	test   %al,%al
+  804702:	74 26                	je     80472a <_panic+0x77>
+  804704:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80470b:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  804712:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  804716:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80471a:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80471e:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  804722:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  804726:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80472a:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  804731:	00 00 00 
+  804734:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80473b:	00 00 00 
+  80473e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804742:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  804749:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  804750:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  804757:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80475e:	ff ff ff 
+  804761:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804765:	4c 8b 20             	mov    (%rax),%r12
+  804768:	49 89 df             	mov    %rbx,%r15
+  80476b:	48 b8 28 8f ff ff ff 	movabs $0xffffffffffff8f28,%rax
+  804772:	ff ff ff 
+  804775:	48 01 d8             	add    %rbx,%rax
+  804778:	ff d0                	call   *%rax
+  80477a:	89 c6                	mov    %eax,%esi
+  80477c:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  804782:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804789:	41 89 d0             	mov    %edx,%r8d
+  80478c:	48 89 c1             	mov    %rax,%rcx
+  80478f:	4c 89 e2             	mov    %r12,%rdx
+  804792:	48 b8 90 e0 ff ff ff 	movabs $0xffffffffffffe090,%rax
+  804799:	ff ff ff 
+  80479c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047a0:	48 89 c7             	mov    %rax,%rdi
+  8047a3:	49 89 df             	mov    %rbx,%r15
+  8047a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047ab:	49 b9 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%r9
+  8047b2:	ff ff ff 
+  8047b5:	49 01 d9             	add    %rbx,%r9
+  8047b8:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8047bb:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8047c2:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8047c9:	48 89 d6             	mov    %rdx,%rsi
+  8047cc:	48 89 c7             	mov    %rax,%rdi
+  8047cf:	49 89 df             	mov    %rbx,%r15
+  8047d2:	48 b8 7a c8 ff ff ff 	movabs $0xffffffffffffc87a,%rax
+  8047d9:	ff ff ff 
+  8047dc:	48 01 d8             	add    %rbx,%rax
+  8047df:	ff d0                	call   *%rax
+	cprintf("\n");
+  8047e1:	48 b8 b3 e0 ff ff ff 	movabs $0xffffffffffffe0b3,%rax
+  8047e8:	ff ff ff 
+  8047eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047ef:	48 89 c7             	mov    %rax,%rdi
+  8047f2:	49 89 df             	mov    %rbx,%r15
+  8047f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047fa:	48 ba 5a c9 ff ff ff 	movabs $0xffffffffffffc95a,%rdx
+  804801:	ff ff ff 
+  804804:	48 01 da             	add    %rbx,%rdx
+  804807:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  804809:	cc                   	int3
+  80480a:	eb fd                	jmp    804809 <_panic+0x156>
+
+000000000080480c <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  80480c:	55                   	push   %rbp
+  80480d:	48 89 e5             	mov    %rsp,%rbp
+  804810:	41 57                	push   %r15
+  804812:	48 83 ec 18          	sub    $0x18,%rsp
+  804816:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804816 <putch+0xa>
+  80481d:	49 bb 1a 38 00 00 00 	movabs $0x381a,%r11
+  804824:	00 00 00 
+  804827:	4c 01 d8             	add    %r11,%rax
+  80482a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80482d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  804831:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804835:	8b 12                	mov    (%rdx),%edx
+  804837:	8d 72 01             	lea    0x1(%rdx),%esi
+  80483a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80483e:	89 31                	mov    %esi,(%rcx)
+  804840:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  804843:	89 ce                	mov    %ecx,%esi
+  804845:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804849:	48 63 d2             	movslq %edx,%rdx
+  80484c:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  804851:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804855:	8b 12                	mov    (%rdx),%edx
+  804857:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80485d:	75 33                	jne    804892 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80485f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804863:	8b 12                	mov    (%rdx),%edx
+  804865:	48 63 d2             	movslq %edx,%rdx
+  804868:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80486c:	48 83 c1 08          	add    $0x8,%rcx
+  804870:	48 89 d6             	mov    %rdx,%rsi
+  804873:	48 89 cf             	mov    %rcx,%rdi
+  804876:	49 89 c7             	mov    %rax,%r15
+  804879:	48 ba 19 8e ff ff ff 	movabs $0xffffffffffff8e19,%rdx
+  804880:	ff ff ff 
+  804883:	48 01 c2             	add    %rax,%rdx
+  804886:	ff d2                	call   *%rdx
+        b->idx = 0;
+  804888:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80488c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  804892:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804896:	8b 40 04             	mov    0x4(%rax),%eax
+  804899:	8d 50 01             	lea    0x1(%rax),%edx
+  80489c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048a0:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8048a3:	90                   	nop
+  8048a4:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8048a8:	c9                   	leave
+  8048a9:	c3                   	ret
+
+00000000008048aa <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8048aa:	55                   	push   %rbp
+  8048ab:	48 89 e5             	mov    %rsp,%rbp
+  8048ae:	41 57                	push   %r15
+  8048b0:	53                   	push   %rbx
+  8048b1:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8048b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048b8 <vcprintf+0xe>
+  8048bf:	49 bb 78 37 00 00 00 	movabs $0x3778,%r11
+  8048c6:	00 00 00 
+  8048c9:	4c 01 db             	add    %r11,%rbx
+  8048cc:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8048d3:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8048da:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8048e1:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8048e8:	48 8b 06             	mov    (%rsi),%rax
+  8048eb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8048ef:	48 89 01             	mov    %rax,(%rcx)
+  8048f2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8048f6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8048fa:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8048fe:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  804905:	00 00 00 
+    b.cnt = 0;
+  804908:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80490f:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  804912:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  804919:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  804920:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804927:	48 89 c6             	mov    %rax,%rsi
+  80492a:	48 b8 dc c7 ff ff ff 	movabs $0xffffffffffffc7dc,%rax
+  804931:	ff ff ff 
+  804934:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804938:	48 89 c7             	mov    %rax,%rdi
+  80493b:	49 89 df             	mov    %rbx,%r15
+  80493e:	48 b8 9e cd ff ff ff 	movabs $0xffffffffffffcd9e,%rax
+  804945:	ff ff ff 
+  804948:	48 01 d8             	add    %rbx,%rax
+  80494b:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  80494d:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  804953:	48 98                	cltq
+  804955:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  80495c:	48 83 c2 08          	add    $0x8,%rdx
+  804960:	48 89 c6             	mov    %rax,%rsi
+  804963:	48 89 d7             	mov    %rdx,%rdi
+  804966:	49 89 df             	mov    %rbx,%r15
+  804969:	48 b8 19 8e ff ff ff 	movabs $0xffffffffffff8e19,%rax
+  804970:	ff ff ff 
+  804973:	48 01 d8             	add    %rbx,%rax
+  804976:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  804978:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80497e:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  804985:	5b                   	pop    %rbx
+  804986:	41 5f                	pop    %r15
+  804988:	5d                   	pop    %rbp
+  804989:	c3                   	ret
+
+000000000080498a <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  80498a:	55                   	push   %rbp
+  80498b:	48 89 e5             	mov    %rsp,%rbp
+  80498e:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  804995:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804995 <cprintf+0xb>
+  80499c:	49 bb 9b 36 00 00 00 	movabs $0x369b,%r11
+  8049a3:	00 00 00 
+  8049a6:	4d 01 da             	add    %r11,%r10
+  8049a9:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8049b0:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8049b7:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8049be:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8049c5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8049cc:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8049d3:	84 c0                	test   %al,%al
+  8049d5:	74 20                	je     8049f7 <cprintf+0x6d>
+  8049d7:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8049db:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8049df:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8049e3:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8049e7:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8049eb:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8049ef:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8049f3:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8049f7:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8049fe:	00 00 00 
+  804a01:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804a08:	00 00 00 
+  804a0b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a0f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804a16:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804a1d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  804a24:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  804a2b:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  804a32:	48 8b 06             	mov    (%rsi),%rax
+  804a35:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804a39:	48 89 01             	mov    %rax,(%rcx)
+  804a3c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804a40:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804a44:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  804a48:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  804a4f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804a56:	48 89 d6             	mov    %rdx,%rsi
+  804a59:	48 89 c7             	mov    %rax,%rdi
+  804a5c:	48 b8 7a c8 ff ff ff 	movabs $0xffffffffffffc87a,%rax
+  804a63:	ff ff ff 
+  804a66:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804a6a:	ff d0                	call   *%rax
+  804a6c:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  804a72:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804a78:	c9                   	leave
+  804a79:	c3                   	ret
+
+0000000000804a7a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  804a7a:	55                   	push   %rbp
+  804a7b:	48 89 e5             	mov    %rsp,%rbp
+  804a7e:	53                   	push   %rbx
+  804a7f:	48 83 ec 38          	sub    $0x38,%rsp
+  804a83:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a83 <printnum+0x9>
+  804a8a:	49 bb ad 35 00 00 00 	movabs $0x35ad,%r11
+  804a91:	00 00 00 
+  804a94:	4c 01 db             	add    %r11,%rbx
+  804a97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804a9b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804a9f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804aa3:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  804aa6:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  804aaa:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  804aae:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804ab1:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  804ab5:	72 58                	jb     804b0f <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  804ab7:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  804aba:	8d 78 ff             	lea    -0x1(%rax),%edi
+  804abd:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  804ac0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ac4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ac9:	48 f7 f6             	div    %rsi
+  804acc:	49 89 c2             	mov    %rax,%r10
+  804acf:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  804ad2:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804ad5:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804ad9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804add:	41 89 c9             	mov    %ecx,%r9d
+  804ae0:	41 89 f8             	mov    %edi,%r8d
+  804ae3:	89 d1                	mov    %edx,%ecx
+  804ae5:	4c 89 d2             	mov    %r10,%rdx
+  804ae8:	48 89 c7             	mov    %rax,%rdi
+  804aeb:	48 b8 4a ca ff ff ff 	movabs $0xffffffffffffca4a,%rax
+  804af2:	ff ff ff 
+  804af5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804af9:	ff d0                	call   *%rax
+  804afb:	eb 1c                	jmp    804b19 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  804afd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804b01:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804b04:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804b08:	48 89 d6             	mov    %rdx,%rsi
+  804b0b:	89 c7                	mov    %eax,%edi
+  804b0d:	ff d1                	call   *%rcx
+		while (--width > 0)
+  804b0f:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  804b13:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  804b17:	7f e4                	jg     804afd <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  804b19:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804b1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b20:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b25:	48 f7 f1             	div    %rcx
+  804b28:	48 b8 ef e1 ff ff ff 	movabs $0xffffffffffffe1ef,%rax
+  804b2f:	ff ff ff 
+  804b32:	48 01 d8             	add    %rbx,%rax
+  804b35:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  804b39:	0f be c0             	movsbl %al,%eax
+  804b3c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804b40:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804b44:	48 89 d6             	mov    %rdx,%rsi
+  804b47:	89 c7                	mov    %eax,%edi
+  804b49:	ff d1                	call   *%rcx
+}
+  804b4b:	90                   	nop
+  804b4c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804b50:	c9                   	leave
+  804b51:	c3                   	ret
+
+0000000000804b52 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  804b52:	55                   	push   %rbp
+  804b53:	48 89 e5             	mov    %rsp,%rbp
+  804b56:	48 83 ec 20          	sub    $0x20,%rsp
+  804b5a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804b5a <getuint+0x8>
+  804b61:	49 bb d6 34 00 00 00 	movabs $0x34d6,%r11
+  804b68:	00 00 00 
+  804b6b:	4c 01 d8             	add    %r11,%rax
+  804b6e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804b72:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  804b75:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  804b79:	7e 4f                	jle    804bca <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  804b7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b7f:	8b 00                	mov    (%rax),%eax
+  804b81:	83 f8 2f             	cmp    $0x2f,%eax
+  804b84:	77 24                	ja     804baa <getuint+0x58>
+  804b86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b8a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804b8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b92:	8b 00                	mov    (%rax),%eax
+  804b94:	89 c0                	mov    %eax,%eax
+  804b96:	48 01 d0             	add    %rdx,%rax
+  804b99:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804b9d:	8b 12                	mov    (%rdx),%edx
+  804b9f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804ba2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ba6:	89 0a                	mov    %ecx,(%rdx)
+  804ba8:	eb 14                	jmp    804bbe <getuint+0x6c>
+  804baa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804bb2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804bb6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804bba:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804bbe:	48 8b 00             	mov    (%rax),%rax
+  804bc1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804bc5:	e9 9d 00 00 00       	jmp    804c67 <getuint+0x115>
+	else if (lflag)
+  804bca:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804bce:	74 4c                	je     804c1c <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  804bd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bd4:	8b 00                	mov    (%rax),%eax
+  804bd6:	83 f8 2f             	cmp    $0x2f,%eax
+  804bd9:	77 24                	ja     804bff <getuint+0xad>
+  804bdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bdf:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804be3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804be7:	8b 00                	mov    (%rax),%eax
+  804be9:	89 c0                	mov    %eax,%eax
+  804beb:	48 01 d0             	add    %rdx,%rax
+  804bee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804bf2:	8b 12                	mov    (%rdx),%edx
+  804bf4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804bf7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804bfb:	89 0a                	mov    %ecx,(%rdx)
+  804bfd:	eb 14                	jmp    804c13 <getuint+0xc1>
+  804bff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c03:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c07:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804c0b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c0f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804c13:	48 8b 00             	mov    (%rax),%rax
+  804c16:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804c1a:	eb 4b                	jmp    804c67 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  804c1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c20:	8b 00                	mov    (%rax),%eax
+  804c22:	83 f8 2f             	cmp    $0x2f,%eax
+  804c25:	77 24                	ja     804c4b <getuint+0xf9>
+  804c27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c2b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804c2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c33:	8b 00                	mov    (%rax),%eax
+  804c35:	89 c0                	mov    %eax,%eax
+  804c37:	48 01 d0             	add    %rdx,%rax
+  804c3a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c3e:	8b 12                	mov    (%rdx),%edx
+  804c40:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804c43:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c47:	89 0a                	mov    %ecx,(%rdx)
+  804c49:	eb 14                	jmp    804c5f <getuint+0x10d>
+  804c4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c4f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c53:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804c57:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c5b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804c5f:	8b 00                	mov    (%rax),%eax
+  804c61:	89 c0                	mov    %eax,%eax
+  804c63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  804c67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804c6b:	c9                   	leave
+  804c6c:	c3                   	ret
+
+0000000000804c6d <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  804c6d:	55                   	push   %rbp
+  804c6e:	48 89 e5             	mov    %rsp,%rbp
+  804c71:	48 83 ec 20          	sub    $0x20,%rsp
+  804c75:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c75 <printfloat+0x8>
+  804c7c:	49 bb bb 33 00 00 00 	movabs $0x33bb,%r11
+  804c83:	00 00 00 
+  804c86:	4c 01 d8             	add    %r11,%rax
+  804c89:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c8d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804c91:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  804c95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c99:	48 85 c0             	test   %rax,%rax
+  804c9c:	79 12                	jns    804cb0 <printfloat+0x43>
+		putch('-',putdat);
+  804c9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ca2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ca6:	48 89 c6             	mov    %rax,%rsi
+  804ca9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  804cae:	ff d2                	call   *%rdx
+	
+}
+  804cb0:	90                   	nop
+  804cb1:	c9                   	leave
+  804cb2:	c3                   	ret
+
+0000000000804cb3 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  804cb3:	55                   	push   %rbp
+  804cb4:	48 89 e5             	mov    %rsp,%rbp
+  804cb7:	48 83 ec 20          	sub    $0x20,%rsp
+  804cbb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804cbb <getint+0x8>
+  804cc2:	49 bb 75 33 00 00 00 	movabs $0x3375,%r11
+  804cc9:	00 00 00 
+  804ccc:	4c 01 d8             	add    %r11,%rax
+  804ccf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804cd3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  804cd6:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  804cda:	7e 4f                	jle    804d2b <getint+0x78>
+		x=va_arg(*ap, long long);
+  804cdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ce0:	8b 00                	mov    (%rax),%eax
+  804ce2:	83 f8 2f             	cmp    $0x2f,%eax
+  804ce5:	77 24                	ja     804d0b <getint+0x58>
+  804ce7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ceb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804cef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cf3:	8b 00                	mov    (%rax),%eax
+  804cf5:	89 c0                	mov    %eax,%eax
+  804cf7:	48 01 d0             	add    %rdx,%rax
+  804cfa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804cfe:	8b 12                	mov    (%rdx),%edx
+  804d00:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804d03:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d07:	89 0a                	mov    %ecx,(%rdx)
+  804d09:	eb 14                	jmp    804d1f <getint+0x6c>
+  804d0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d0f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d13:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804d17:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d1b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804d1f:	48 8b 00             	mov    (%rax),%rax
+  804d22:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804d26:	e9 9d 00 00 00       	jmp    804dc8 <getint+0x115>
+	else if (lflag)
+  804d2b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804d2f:	74 4c                	je     804d7d <getint+0xca>
+		x=va_arg(*ap, long);
+  804d31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d35:	8b 00                	mov    (%rax),%eax
+  804d37:	83 f8 2f             	cmp    $0x2f,%eax
+  804d3a:	77 24                	ja     804d60 <getint+0xad>
+  804d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d40:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804d44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d48:	8b 00                	mov    (%rax),%eax
+  804d4a:	89 c0                	mov    %eax,%eax
+  804d4c:	48 01 d0             	add    %rdx,%rax
+  804d4f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d53:	8b 12                	mov    (%rdx),%edx
+  804d55:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804d58:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d5c:	89 0a                	mov    %ecx,(%rdx)
+  804d5e:	eb 14                	jmp    804d74 <getint+0xc1>
+  804d60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d64:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d68:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804d6c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d70:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804d74:	48 8b 00             	mov    (%rax),%rax
+  804d77:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804d7b:	eb 4b                	jmp    804dc8 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  804d7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d81:	8b 00                	mov    (%rax),%eax
+  804d83:	83 f8 2f             	cmp    $0x2f,%eax
+  804d86:	77 24                	ja     804dac <getint+0xf9>
+  804d88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d8c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804d90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d94:	8b 00                	mov    (%rax),%eax
+  804d96:	89 c0                	mov    %eax,%eax
+  804d98:	48 01 d0             	add    %rdx,%rax
+  804d9b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d9f:	8b 12                	mov    (%rdx),%edx
+  804da1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804da4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804da8:	89 0a                	mov    %ecx,(%rdx)
+  804daa:	eb 14                	jmp    804dc0 <getint+0x10d>
+  804dac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804db0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804db4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804db8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804dbc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804dc0:	8b 00                	mov    (%rax),%eax
+  804dc2:	48 98                	cltq
+  804dc4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  804dc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804dcc:	c9                   	leave
+  804dcd:	c3                   	ret
+
+0000000000804dce <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  804dce:	55                   	push   %rbp
+  804dcf:	48 89 e5             	mov    %rsp,%rbp
+  804dd2:	41 57                	push   %r15
+  804dd4:	41 55                	push   %r13
+  804dd6:	41 54                	push   %r12
+  804dd8:	53                   	push   %rbx
+  804dd9:	48 83 ec 60          	sub    $0x60,%rsp
+  804ddd:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 804ddd <vprintfmt+0xf>
+  804de4:	49 bb 53 32 00 00 00 	movabs $0x3253,%r11
+  804deb:	00 00 00 
+  804dee:	4d 01 dc             	add    %r11,%r12
+  804df1:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  804df5:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  804df9:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804dfd:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  804e01:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  804e08:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  804e0c:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  804e10:	48 8b 06             	mov    (%rsi),%rax
+  804e13:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804e17:	48 89 01             	mov    %rax,(%rcx)
+  804e1a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804e1e:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804e22:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804e26:	eb 17                	jmp    804e3f <vprintfmt+0x71>
+			if (ch == '\0')
+  804e28:	85 db                	test   %ebx,%ebx
+  804e2a:	0f 84 97 05 00 00    	je     8053c7 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  804e30:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804e34:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804e38:	48 89 c6             	mov    %rax,%rsi
+  804e3b:	89 df                	mov    %ebx,%edi
+  804e3d:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804e3f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804e43:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804e47:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804e4b:	0f b6 00             	movzbl (%rax),%eax
+  804e4e:	0f b6 d8             	movzbl %al,%ebx
+  804e51:	83 fb 25             	cmp    $0x25,%ebx
+  804e54:	75 d2                	jne    804e28 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  804e56:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  804e5a:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  804e61:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  804e68:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  804e6f:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  804e76:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804e7a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804e7e:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804e82:	0f b6 00             	movzbl (%rax),%eax
+  804e85:	0f b6 d8             	movzbl %al,%ebx
+  804e88:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  804e8b:	83 f8 55             	cmp    $0x55,%eax
+  804e8e:	0f 87 00 05 00 00    	ja     805394 <vprintfmt+0x5c6>
+  804e94:	89 c0                	mov    %eax,%eax
+  804e96:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804e9d:	00 
+  804e9e:	48 8d 05 a3 13 00 00 	lea    0x13a3(%rip),%rax        # 806248 <.LC18+0xc>
+  804ea5:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  804ea9:	48 8d 15 98 13 00 00 	lea    0x1398(%rip),%rdx        # 806248 <.LC18+0xc>
+  804eb0:	48 01 d0             	add    %rdx,%rax
+  804eb3:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  804eb5:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  804eb9:	eb bb                	jmp    804e76 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  804ebb:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  804ebf:	eb b5                	jmp    804e76 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  804ec1:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  804ec8:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804ecb:	89 d0                	mov    %edx,%eax
+  804ecd:	c1 e0 02             	shl    $0x2,%eax
+  804ed0:	01 d0                	add    %edx,%eax
+  804ed2:	01 c0                	add    %eax,%eax
+  804ed4:	01 d8                	add    %ebx,%eax
+  804ed6:	83 e8 30             	sub    $0x30,%eax
+  804ed9:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  804edc:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804ee0:	0f b6 00             	movzbl (%rax),%eax
+  804ee3:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  804ee6:	83 fb 2f             	cmp    $0x2f,%ebx
+  804ee9:	7e 60                	jle    804f4b <vprintfmt+0x17d>
+  804eeb:	83 fb 39             	cmp    $0x39,%ebx
+  804eee:	7f 5b                	jg     804f4b <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  804ef0:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  804ef5:	eb d1                	jmp    804ec8 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  804ef7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804efa:	83 f8 2f             	cmp    $0x2f,%eax
+  804efd:	77 17                	ja     804f16 <vprintfmt+0x148>
+  804eff:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f03:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804f06:	89 d2                	mov    %edx,%edx
+  804f08:	48 01 d0             	add    %rdx,%rax
+  804f0b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804f0e:	83 c2 08             	add    $0x8,%edx
+  804f11:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804f14:	eb 0c                	jmp    804f22 <vprintfmt+0x154>
+  804f16:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f1a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804f1e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804f22:	8b 00                	mov    (%rax),%eax
+  804f24:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  804f27:	eb 23                	jmp    804f4c <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  804f29:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804f2d:	0f 89 43 ff ff ff    	jns    804e76 <vprintfmt+0xa8>
+				width = 0;
+  804f33:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  804f3a:	e9 37 ff ff ff       	jmp    804e76 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  804f3f:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  804f46:	e9 2b ff ff ff       	jmp    804e76 <vprintfmt+0xa8>
+			goto process_precision;
+  804f4b:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  804f4c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804f50:	0f 89 20 ff ff ff    	jns    804e76 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  804f56:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804f59:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  804f5c:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  804f63:	e9 0e ff ff ff       	jmp    804e76 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  804f68:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  804f6c:	e9 05 ff ff ff       	jmp    804e76 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  804f71:	83 fb 39             	cmp    $0x39,%ebx
+  804f74:	7f 0b                	jg     804f81 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  804f76:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  804f79:	c1 e0 08             	shl    $0x8,%eax
+  804f7c:	01 45 bc             	add    %eax,-0x44(%rbp)
+  804f7f:	eb 21                	jmp    804fa2 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  804f81:	83 fb 60             	cmp    $0x60,%ebx
+  804f84:	7e 10                	jle    804f96 <vprintfmt+0x1c8>
+  804f86:	83 fb 66             	cmp    $0x66,%ebx
+  804f89:	7f 0b                	jg     804f96 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  804f8b:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  804f8e:	c1 e0 08             	shl    $0x8,%eax
+  804f91:	01 45 bc             	add    %eax,-0x44(%rbp)
+  804f94:	eb 0c                	jmp    804fa2 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  804f96:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  804f9d:	e9 04 01 00 00       	jmp    8050a6 <vprintfmt+0x2d8>
+  804fa2:	e9 ff 00 00 00       	jmp    8050a6 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  804fa7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804faa:	83 f8 2f             	cmp    $0x2f,%eax
+  804fad:	77 17                	ja     804fc6 <vprintfmt+0x1f8>
+  804faf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804fb3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804fb6:	89 d2                	mov    %edx,%edx
+  804fb8:	48 01 d0             	add    %rdx,%rax
+  804fbb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804fbe:	83 c2 08             	add    $0x8,%edx
+  804fc1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804fc4:	eb 0c                	jmp    804fd2 <vprintfmt+0x204>
+  804fc6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804fca:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804fce:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804fd2:	8b 00                	mov    (%rax),%eax
+  804fd4:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  804fd8:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  804fdc:	48 89 d6             	mov    %rdx,%rsi
+  804fdf:	89 c7                	mov    %eax,%edi
+  804fe1:	ff d1                	call   *%rcx
+			break;
+  804fe3:	e9 da 03 00 00       	jmp    8053c2 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  804fe8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804feb:	83 f8 2f             	cmp    $0x2f,%eax
+  804fee:	77 17                	ja     805007 <vprintfmt+0x239>
+  804ff0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804ff4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804ff7:	89 d2                	mov    %edx,%edx
+  804ff9:	48 01 d0             	add    %rdx,%rax
+  804ffc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804fff:	83 c2 08             	add    $0x8,%edx
+  805002:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  805005:	eb 0c                	jmp    805013 <vprintfmt+0x245>
+  805007:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80500b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80500f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  805013:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  805015:	85 db                	test   %ebx,%ebx
+  805017:	79 02                	jns    80501b <vprintfmt+0x24d>
+				err = -err;
+  805019:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80501b:	83 fb 15             	cmp    $0x15,%ebx
+  80501e:	7f 19                	jg     805039 <vprintfmt+0x26b>
+  805020:	48 ba 90 01 00 00 00 	movabs $0x190,%rdx
+  805027:	00 00 00 
+  80502a:	48 63 c3             	movslq %ebx,%rax
+  80502d:	4c 01 e2             	add    %r12,%rdx
+  805030:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  805034:	4d 85 ed             	test   %r13,%r13
+  805037:	75 36                	jne    80506f <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  805039:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80503d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805041:	89 d9                	mov    %ebx,%ecx
+  805043:	48 ba 00 e2 ff ff ff 	movabs $0xffffffffffffe200,%rdx
+  80504a:	ff ff ff 
+  80504d:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  805051:	48 89 c7             	mov    %rax,%rdi
+  805054:	b8 00 00 00 00       	mov    $0x0,%eax
+  805059:	49 b8 a5 d3 ff ff ff 	movabs $0xffffffffffffd3a5,%r8
+  805060:	ff ff ff 
+  805063:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  805067:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  80506a:	e9 53 03 00 00       	jmp    8053c2 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  80506f:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  805073:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805077:	4c 89 e9             	mov    %r13,%rcx
+  80507a:	48 ba 09 e2 ff ff ff 	movabs $0xffffffffffffe209,%rdx
+  805081:	ff ff ff 
+  805084:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  805088:	48 89 c7             	mov    %rax,%rdi
+  80508b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805090:	49 b8 a5 d3 ff ff ff 	movabs $0xffffffffffffd3a5,%r8
+  805097:	ff ff ff 
+  80509a:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  80509e:	41 ff d0             	call   *%r8
+			break;
+  8050a1:	e9 1c 03 00 00       	jmp    8053c2 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  8050a6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8050a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8050ac:	77 17                	ja     8050c5 <vprintfmt+0x2f7>
+  8050ae:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8050b2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8050b5:	89 d2                	mov    %edx,%edx
+  8050b7:	48 01 d0             	add    %rdx,%rax
+  8050ba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8050bd:	83 c2 08             	add    $0x8,%edx
+  8050c0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8050c3:	eb 0c                	jmp    8050d1 <vprintfmt+0x303>
+  8050c5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8050c9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8050cd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8050d1:	4c 8b 28             	mov    (%rax),%r13
+  8050d4:	4d 85 ed             	test   %r13,%r13
+  8050d7:	75 0e                	jne    8050e7 <vprintfmt+0x319>
+				p = "(null)";
+  8050d9:	48 b8 0c e2 ff ff ff 	movabs $0xffffffffffffe20c,%rax
+  8050e0:	ff ff ff 
+  8050e3:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  8050e7:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8050eb:	0f 8e 84 00 00 00    	jle    805175 <vprintfmt+0x3a7>
+  8050f1:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  8050f5:	74 7e                	je     805175 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8050f7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8050fa:	48 98                	cltq
+  8050fc:	48 89 c6             	mov    %rax,%rsi
+  8050ff:	4c 89 ef             	mov    %r13,%rdi
+  805102:	4d 89 e7             	mov    %r12,%r15
+  805105:	48 b8 c3 82 ff ff ff 	movabs $0xffffffffffff82c3,%rax
+  80510c:	ff ff ff 
+  80510f:	4c 01 e0             	add    %r12,%rax
+  805112:	ff d0                	call   *%rax
+  805114:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  805117:	eb 17                	jmp    805130 <vprintfmt+0x362>
+					putch(padc, putdat);
+  805119:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  80511d:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  805121:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  805125:	48 89 d6             	mov    %rdx,%rsi
+  805128:	89 c7                	mov    %eax,%edi
+  80512a:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80512c:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  805130:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  805134:	7f e3                	jg     805119 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  805136:	eb 3d                	jmp    805175 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  805138:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80513c:	74 1e                	je     80515c <vprintfmt+0x38e>
+  80513e:	83 fb 1f             	cmp    $0x1f,%ebx
+  805141:	7e 05                	jle    805148 <vprintfmt+0x37a>
+  805143:	83 fb 7e             	cmp    $0x7e,%ebx
+  805146:	7e 14                	jle    80515c <vprintfmt+0x38e>
+					putch('?', putdat);
+  805148:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80514c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  805150:	48 89 c6             	mov    %rax,%rsi
+  805153:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  805158:	ff d2                	call   *%rdx
+  80515a:	eb 15                	jmp    805171 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  80515c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80515f:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  805162:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  805166:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80516a:	48 89 c6             	mov    %rax,%rsi
+  80516d:	89 cf                	mov    %ecx,%edi
+  80516f:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  805171:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  805175:	4c 89 e8             	mov    %r13,%rax
+  805178:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  80517c:	0f b6 00             	movzbl (%rax),%eax
+  80517f:	0f be d8             	movsbl %al,%ebx
+  805182:	85 db                	test   %ebx,%ebx
+  805184:	74 28                	je     8051ae <vprintfmt+0x3e0>
+  805186:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80518a:	78 ac                	js     805138 <vprintfmt+0x36a>
+  80518c:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  805190:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  805194:	79 a2                	jns    805138 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  805196:	eb 16                	jmp    8051ae <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  805198:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80519c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8051a0:	48 89 c6             	mov    %rax,%rsi
+  8051a3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8051a8:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8051aa:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8051ae:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8051b2:	7f e4                	jg     805198 <vprintfmt+0x3ca>
+			break;
+  8051b4:	e9 09 02 00 00       	jmp    8053c2 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  8051b9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8051bd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8051c1:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8051c5:	0f b6 00             	movzbl (%rax),%eax
+  8051c8:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  8051cb:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  8051cc:	83 fb 2f             	cmp    $0x2f,%ebx
+  8051cf:	0f 8e ac fd ff ff    	jle    804f81 <vprintfmt+0x1b3>
+  8051d5:	e9 97 fd ff ff       	jmp    804f71 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8051da:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8051de:	be 03 00 00 00       	mov    $0x3,%esi
+  8051e3:	48 89 c7             	mov    %rax,%rdi
+  8051e6:	48 b8 83 cc ff ff ff 	movabs $0xffffffffffffcc83,%rax
+  8051ed:	ff ff ff 
+  8051f0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8051f4:	ff d0                	call   *%rax
+  8051f6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8051fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051fe:	48 85 c0             	test   %rax,%rax
+  805201:	79 1d                	jns    805220 <vprintfmt+0x452>
+				putch('-', putdat);
+  805203:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  805207:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80520b:	48 89 c6             	mov    %rax,%rsi
+  80520e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  805213:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  805215:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805219:	48 f7 d8             	neg    %rax
+  80521c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  805220:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  805227:	e9 de 00 00 00       	jmp    80530a <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  80522c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805230:	be 03 00 00 00       	mov    $0x3,%esi
+  805235:	48 89 c7             	mov    %rax,%rdi
+  805238:	48 b8 22 cb ff ff ff 	movabs $0xffffffffffffcb22,%rax
+  80523f:	ff ff ff 
+  805242:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  805246:	ff d0                	call   *%rax
+  805248:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  80524c:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  805253:	e9 b2 00 00 00       	jmp    80530a <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  805258:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80525c:	be 03 00 00 00       	mov    $0x3,%esi
+  805261:	48 89 c7             	mov    %rax,%rdi
+  805264:	48 b8 22 cb ff ff ff 	movabs $0xffffffffffffcb22,%rax
+  80526b:	ff ff ff 
+  80526e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  805272:	ff d0                	call   *%rax
+  805274:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  805278:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  80527f:	e9 86 00 00 00       	jmp    80530a <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  805284:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  805288:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80528c:	48 89 c6             	mov    %rax,%rsi
+  80528f:	bf 30 00 00 00       	mov    $0x30,%edi
+  805294:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  805296:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80529a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80529e:	48 89 c6             	mov    %rax,%rsi
+  8052a1:	bf 78 00 00 00       	mov    $0x78,%edi
+  8052a6:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8052a8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8052ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8052ae:	77 17                	ja     8052c7 <vprintfmt+0x4f9>
+  8052b0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8052b4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8052b7:	89 d2                	mov    %edx,%edx
+  8052b9:	48 01 d0             	add    %rdx,%rax
+  8052bc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8052bf:	83 c2 08             	add    $0x8,%edx
+  8052c2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8052c5:	eb 0c                	jmp    8052d3 <vprintfmt+0x505>
+  8052c7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8052cb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8052cf:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8052d3:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8052d6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8052da:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8052e1:	eb 27                	jmp    80530a <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8052e3:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8052e7:	be 03 00 00 00       	mov    $0x3,%esi
+  8052ec:	48 89 c7             	mov    %rax,%rdi
+  8052ef:	48 b8 22 cb ff ff ff 	movabs $0xffffffffffffcb22,%rax
+  8052f6:	ff ff ff 
+  8052f9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8052fd:	ff d0                	call   *%rax
+  8052ff:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  805303:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  80530a:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  80530f:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  805312:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  805315:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805319:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80531d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805321:	45 89 c1             	mov    %r8d,%r9d
+  805324:	41 89 f8             	mov    %edi,%r8d
+  805327:	48 89 c7             	mov    %rax,%rdi
+  80532a:	48 b8 4a ca ff ff ff 	movabs $0xffffffffffffca4a,%rax
+  805331:	ff ff ff 
+  805334:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  805338:	ff d0                	call   *%rax
+			break;
+  80533a:	e9 83 00 00 00       	jmp    8053c2 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80533f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805343:	be 03 00 00 00       	mov    $0x3,%esi
+  805348:	48 89 c7             	mov    %rax,%rdi
+  80534b:	48 b8 22 cb ff ff ff 	movabs $0xffffffffffffcb22,%rax
+  805352:	ff ff ff 
+  805355:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  805359:	ff d0                	call   *%rax
+  80535b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80535f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805363:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805367:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80536b:	48 89 ce             	mov    %rcx,%rsi
+  80536e:	48 89 c7             	mov    %rax,%rdi
+  805371:	48 b8 3d cc ff ff ff 	movabs $0xffffffffffffcc3d,%rax
+  805378:	ff ff ff 
+  80537b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80537f:	ff d0                	call   *%rax
+	
+			break;
+  805381:	eb 3f                	jmp    8053c2 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  805383:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  805387:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80538b:	48 89 c6             	mov    %rax,%rsi
+  80538e:	89 df                	mov    %ebx,%edi
+  805390:	ff d2                	call   *%rdx
+			break;
+  805392:	eb 2e                	jmp    8053c2 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  805394:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  805398:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80539c:	48 89 c6             	mov    %rax,%rsi
+  80539f:	bf 25 00 00 00       	mov    $0x25,%edi
+  8053a4:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8053a6:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8053ab:	eb 05                	jmp    8053b2 <vprintfmt+0x5e4>
+  8053ad:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8053b2:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8053b6:	48 83 e8 01          	sub    $0x1,%rax
+  8053ba:	0f b6 00             	movzbl (%rax),%eax
+  8053bd:	3c 25                	cmp    $0x25,%al
+  8053bf:	75 ec                	jne    8053ad <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8053c1:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8053c2:	e9 78 fa ff ff       	jmp    804e3f <vprintfmt+0x71>
+				return;
+  8053c7:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8053c8:	48 83 c4 60          	add    $0x60,%rsp
+  8053cc:	5b                   	pop    %rbx
+  8053cd:	41 5c                	pop    %r12
+  8053cf:	41 5d                	pop    %r13
+  8053d1:	41 5f                	pop    %r15
+  8053d3:	5d                   	pop    %rbp
+  8053d4:	c3                   	ret
+
+00000000008053d5 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8053d5:	55                   	push   %rbp
+  8053d6:	48 89 e5             	mov    %rsp,%rbp
+  8053d9:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8053e0:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8053e0 <printfmt+0xb>
+  8053e7:	49 bb 50 2c 00 00 00 	movabs $0x2c50,%r11
+  8053ee:	00 00 00 
+  8053f1:	4d 01 da             	add    %r11,%r10
+  8053f4:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8053fb:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  805402:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  805409:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  805410:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  805417:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80541e:	84 c0                	test   %al,%al
+  805420:	74 20                	je     805442 <printfmt+0x6d>
+  805422:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  805426:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80542a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80542e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  805432:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  805436:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80543a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80543e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  805442:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  805449:	00 00 00 
+  80544c:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  805453:	00 00 00 
+  805456:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80545a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  805461:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  805468:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80546f:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  805476:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80547d:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  805484:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80548b:	48 89 c7             	mov    %rax,%rdi
+  80548e:	48 b8 9e cd ff ff ff 	movabs $0xffffffffffffcd9e,%rax
+  805495:	ff ff ff 
+  805498:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80549c:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  80549e:	90                   	nop
+  80549f:	c9                   	leave
+  8054a0:	c3                   	ret
+
+00000000008054a1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8054a1:	55                   	push   %rbp
+  8054a2:	48 89 e5             	mov    %rsp,%rbp
+  8054a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8054a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054a9 <sprintputch+0x8>
+  8054b0:	49 bb 87 2b 00 00 00 	movabs $0x2b87,%r11
+  8054b7:	00 00 00 
+  8054ba:	4c 01 d8             	add    %r11,%rax
+  8054bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8054c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8054c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054c8:	8b 40 10             	mov    0x10(%rax),%eax
+  8054cb:	8d 50 01             	lea    0x1(%rax),%edx
+  8054ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054d2:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8054d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054d9:	48 8b 10             	mov    (%rax),%rdx
+  8054dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054e0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8054e4:	48 39 c2             	cmp    %rax,%rdx
+  8054e7:	73 17                	jae    805500 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8054e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054ed:	48 8b 00             	mov    (%rax),%rax
+  8054f0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8054f4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8054f8:	48 89 0a             	mov    %rcx,(%rdx)
+  8054fb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8054fe:	88 10                	mov    %dl,(%rax)
+}
+  805500:	90                   	nop
+  805501:	c9                   	leave
+  805502:	c3                   	ret
+
+0000000000805503 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  805503:	55                   	push   %rbp
+  805504:	48 89 e5             	mov    %rsp,%rbp
+  805507:	53                   	push   %rbx
+  805508:	48 83 ec 58          	sub    $0x58,%rsp
+  80550c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80550c <vsnprintf+0x9>
+  805513:	49 bb 24 2b 00 00 00 	movabs $0x2b24,%r11
+  80551a:	00 00 00 
+  80551d:	4c 01 d8             	add    %r11,%rax
+  805520:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  805524:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  805527:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80552b:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80552f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805533:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  805537:	48 8b 0e             	mov    (%rsi),%rcx
+  80553a:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80553e:	48 89 0a             	mov    %rcx,(%rdx)
+  805541:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  805545:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  805549:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80554d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805551:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805555:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  805558:	48 63 d2             	movslq %edx,%rdx
+  80555b:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80555f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805563:	48 01 ca             	add    %rcx,%rdx
+  805566:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80556a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  805571:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805576:	74 06                	je     80557e <vsnprintf+0x7b>
+  805578:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  80557c:	7f 07                	jg     805585 <vsnprintf+0x82>
+		return -E_INVAL;
+  80557e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805583:	eb 34                	jmp    8055b9 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  805585:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  805589:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80558d:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  805591:	48 bf 71 d4 ff ff ff 	movabs $0xffffffffffffd471,%rdi
+  805598:	ff ff ff 
+  80559b:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  80559f:	49 b8 9e cd ff ff ff 	movabs $0xffffffffffffcd9e,%r8
+  8055a6:	ff ff ff 
+  8055a9:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8055ad:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8055af:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8055b3:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8055b6:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8055b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055bd:	c9                   	leave
+  8055be:	c3                   	ret
+
+00000000008055bf <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8055bf:	55                   	push   %rbp
+  8055c0:	48 89 e5             	mov    %rsp,%rbp
+  8055c3:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8055ca:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8055ca <snprintf+0xb>
+  8055d1:	49 bb 66 2a 00 00 00 	movabs $0x2a66,%r11
+  8055d8:	00 00 00 
+  8055db:	4d 01 da             	add    %r11,%r10
+  8055de:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8055e5:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8055eb:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8055f2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8055f9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  805600:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  805607:	84 c0                	test   %al,%al
+  805609:	74 20                	je     80562b <snprintf+0x6c>
+  80560b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80560f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  805613:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  805617:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80561b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80561f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  805623:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  805627:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80562b:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  805632:	00 00 00 
+  805635:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80563c:	00 00 00 
+  80563f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805643:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80564a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  805651:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  805658:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80565f:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  805666:	48 8b 06             	mov    (%rsi),%rax
+  805669:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80566d:	48 89 01             	mov    %rax,(%rcx)
+  805670:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  805674:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  805678:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80567c:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  805683:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80568a:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  805690:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805697:	48 89 c7             	mov    %rax,%rdi
+  80569a:	48 b8 d3 d4 ff ff ff 	movabs $0xffffffffffffd4d3,%rax
+  8056a1:	ff ff ff 
+  8056a4:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8056a8:	ff d0                	call   *%rax
+  8056aa:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8056b0:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8056b6:	c9                   	leave
+  8056b7:	c3                   	ret
+
+00000000008056b8 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8056b8:	55                   	push   %rbp
+  8056b9:	48 89 e5             	mov    %rsp,%rbp
+  8056bc:	41 57                	push   %r15
+  8056be:	53                   	push   %rbx
+  8056bf:	48 83 ec 30          	sub    $0x30,%rsp
+  8056c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056c3 <ipc_recv+0xb>
+  8056ca:	49 bb 6d 29 00 00 00 	movabs $0x296d,%r11
+  8056d1:	00 00 00 
+  8056d4:	4c 01 db             	add    %r11,%rbx
+  8056d7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8056db:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8056df:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8056e3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8056e8:	75 0e                	jne    8056f8 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8056ea:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8056f1:	00 00 00 
+  8056f4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8056f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056fc:	48 89 c7             	mov    %rax,%rdi
+  8056ff:	49 89 df             	mov    %rbx,%r15
+  805702:	48 b8 fa 92 ff ff ff 	movabs $0xffffffffffff92fa,%rax
+  805709:	ff ff ff 
+  80570c:	48 01 d8             	add    %rbx,%rax
+  80570f:	ff d0                	call   *%rax
+  805711:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  805714:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805719:	74 2a                	je     805745 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  80571b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80571f:	75 19                	jne    80573a <ipc_recv+0x82>
+  805721:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805728:	ff ff ff 
+  80572b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80572f:	48 8b 00             	mov    (%rax),%rax
+  805732:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805738:	eb 05                	jmp    80573f <ipc_recv+0x87>
+  80573a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80573f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805743:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  805745:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80574a:	74 2a                	je     805776 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  80574c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805750:	75 19                	jne    80576b <ipc_recv+0xb3>
+  805752:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805759:	ff ff ff 
+  80575c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805760:	48 8b 00             	mov    (%rax),%rax
+  805763:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805769:	eb 05                	jmp    805770 <ipc_recv+0xb8>
+  80576b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805770:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805774:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805776:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80577a:	74 05                	je     805781 <ipc_recv+0xc9>
+		return res;
+  80577c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80577f:	eb 17                	jmp    805798 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805781:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805788:	ff ff ff 
+  80578b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80578f:	48 8b 00             	mov    (%rax),%rax
+  805792:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805798:	48 83 c4 30          	add    $0x30,%rsp
+  80579c:	5b                   	pop    %rbx
+  80579d:	41 5f                	pop    %r15
+  80579f:	5d                   	pop    %rbp
+  8057a0:	c3                   	ret
+
+00000000008057a1 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8057a1:	55                   	push   %rbp
+  8057a2:	48 89 e5             	mov    %rsp,%rbp
+  8057a5:	41 57                	push   %r15
+  8057a7:	53                   	push   %rbx
+  8057a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8057ac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057ac <ipc_send+0xb>
+  8057b3:	49 bb 84 28 00 00 00 	movabs $0x2884,%r11
+  8057ba:	00 00 00 
+  8057bd:	4c 01 db             	add    %r11,%rbx
+  8057c0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8057c3:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8057c6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8057ca:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8057cd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8057d2:	75 0e                	jne    8057e2 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8057d4:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8057db:	00 00 00 
+  8057de:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8057e2:	90                   	nop
+  8057e3:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8057e6:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8057e9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8057ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057f0:	89 c7                	mov    %eax,%edi
+  8057f2:	49 89 df             	mov    %rbx,%r15
+  8057f5:	48 b8 90 92 ff ff ff 	movabs $0xffffffffffff9290,%rax
+  8057fc:	ff ff ff 
+  8057ff:	48 01 d8             	add    %rbx,%rax
+  805802:	ff d0                	call   *%rax
+  805804:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805807:	74 da                	je     8057e3 <ipc_send+0x42>
+		;
+}
+  805809:	90                   	nop
+  80580a:	90                   	nop
+  80580b:	48 83 c4 20          	add    $0x20,%rsp
+  80580f:	5b                   	pop    %rbx
+  805810:	41 5f                	pop    %r15
+  805812:	5d                   	pop    %rbp
+  805813:	c3                   	ret
+
+0000000000805814 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805814:	55                   	push   %rbp
+  805815:	48 89 e5             	mov    %rsp,%rbp
+  805818:	41 57                	push   %r15
+  80581a:	53                   	push   %rbx
+  80581b:	48 83 ec 40          	sub    $0x40,%rsp
+  80581f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80581f <ipc_call+0xb>
+  805826:	49 bb 11 28 00 00 00 	movabs $0x2811,%r11
+  80582d:	00 00 00 
+  805830:	4c 01 db             	add    %r11,%rbx
+  805833:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805836:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805839:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80583d:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805840:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805844:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805848:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80584d:	75 0e                	jne    80585d <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  80584f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805856:	00 00 00 
+  805859:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80585d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805862:	75 0e                	jne    805872 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805864:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80586b:	00 00 00 
+  80586e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805872:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805875:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805879:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80587c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805880:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805883:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805889:	49 89 f8             	mov    %rdi,%r8
+  80588c:	89 c7                	mov    %eax,%edi
+  80588e:	49 89 df             	mov    %rbx,%r15
+  805891:	48 b8 53 93 ff ff ff 	movabs $0xffffffffffff9353,%rax
+  805898:	ff ff ff 
+  80589b:	48 01 d8             	add    %rbx,%rax
+  80589e:	ff d0                	call   *%rax
+  8058a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8058a3:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8058a8:	74 2a                	je     8058d4 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8058aa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058ae:	75 19                	jne    8058c9 <ipc_call+0xb5>
+  8058b0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8058b7:	ff ff ff 
+  8058ba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058be:	48 8b 00             	mov    (%rax),%rax
+  8058c1:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8058c7:	eb 05                	jmp    8058ce <ipc_call+0xba>
+  8058c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058ce:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8058d2:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8058d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058d8:	74 05                	je     8058df <ipc_call+0xcb>
+		return r;
+  8058da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058dd:	eb 17                	jmp    8058f6 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8058df:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8058e6:	ff ff ff 
+  8058e9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058ed:	48 8b 00             	mov    (%rax),%rax
+  8058f0:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8058f6:	48 83 c4 40          	add    $0x40,%rsp
+  8058fa:	5b                   	pop    %rbx
+  8058fb:	41 5f                	pop    %r15
+  8058fd:	5d                   	pop    %rbp
+  8058fe:	c3                   	ret
+
+00000000008058ff <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8058ff:	55                   	push   %rbp
+  805900:	48 89 e5             	mov    %rsp,%rbp
+  805903:	41 57                	push   %r15
+  805905:	53                   	push   %rbx
+  805906:	48 83 ec 70          	sub    $0x70,%rsp
+  80590a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80590a <ipc_callw+0xb>
+  805911:	49 bb 26 27 00 00 00 	movabs $0x2726,%r11
+  805918:	00 00 00 
+  80591b:	4c 01 db             	add    %r11,%rbx
+  80591e:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805921:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805924:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805928:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  80592c:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805931:	76 0a                	jbe    80593d <ipc_callw+0x3e>
+		return -E_INVAL;
+  805933:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805938:	e9 b7 00 00 00       	jmp    8059f4 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  80593d:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805941:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805945:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805949:	48 89 ce             	mov    %rcx,%rsi
+  80594c:	48 89 c7             	mov    %rax,%rdi
+  80594f:	49 89 df             	mov    %rbx,%r15
+  805952:	48 b8 f5 86 ff ff ff 	movabs $0xffffffffffff86f5,%rax
+  805959:	ff ff ff 
+  80595c:	48 01 d8             	add    %rbx,%rax
+  80595f:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805961:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805968:	00 
+  805969:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80596d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805971:	48 01 d0             	add    %rdx,%rax
+  805974:	48 83 e8 01          	sub    $0x1,%rax
+  805978:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80597c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805980:	ba 00 00 00 00       	mov    $0x0,%edx
+  805985:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805989:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80598d:	48 29 d0             	sub    %rdx,%rax
+  805990:	48 c1 e8 03          	shr    $0x3,%rax
+  805994:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805998:	89 c1                	mov    %eax,%ecx
+  80599a:	8b 75 98             	mov    -0x68(%rbp),%esi
+  80599d:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  8059a1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8059a4:	49 89 d1             	mov    %rdx,%r9
+  8059a7:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8059ae:	00 00 00 
+  8059b1:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8059b8:	00 00 00 
+  8059bb:	89 c7                	mov    %eax,%edi
+  8059bd:	49 89 df             	mov    %rbx,%r15
+  8059c0:	48 b8 53 93 ff ff ff 	movabs $0xffffffffffff9353,%rax
+  8059c7:	ff ff ff 
+  8059ca:	48 01 d8             	add    %rbx,%rax
+  8059cd:	ff d0                	call   *%rax
+  8059cf:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8059d2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8059d6:	74 05                	je     8059dd <ipc_callw+0xde>
+		return r;
+  8059d8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8059db:	eb 17                	jmp    8059f4 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8059dd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8059e4:	ff ff ff 
+  8059e7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059eb:	48 8b 00             	mov    (%rax),%rax
+  8059ee:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8059f4:	48 83 c4 70          	add    $0x70,%rsp
+  8059f8:	5b                   	pop    %rbx
+  8059f9:	41 5f                	pop    %r15
+  8059fb:	5d                   	pop    %rbp
+  8059fc:	c3                   	ret
+
+00000000008059fd <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8059fd:	55                   	push   %rbp
+  8059fe:	48 89 e5             	mov    %rsp,%rbp
+  805a01:	41 57                	push   %r15
+  805a03:	53                   	push   %rbx
+  805a04:	48 83 ec 40          	sub    $0x40,%rsp
+  805a08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a08 <ipc_callv+0xb>
+  805a0f:	49 bb 28 26 00 00 00 	movabs $0x2628,%r11
+  805a16:	00 00 00 
+  805a19:	4c 01 db             	add    %r11,%rbx
+  805a1c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805a1f:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805a22:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805a26:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805a29:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805a2d:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805a31:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a38:	00 00 00 
+  805a3b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805a3f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805a43:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805a47:	74 11                	je     805a5a <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805a49:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805a4d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805a51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805a54:	c1 e0 14             	shl    $0x14,%eax
+  805a57:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805a5a:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805a5e:	74 14                	je     805a74 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805a60:	8b 45 20             	mov    0x20(%rbp),%eax
+  805a63:	83 e8 01             	sub    $0x1,%eax
+  805a66:	48 63 d0             	movslq %eax,%rdx
+  805a69:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805a6d:	48 09 d0             	or     %rdx,%rax
+  805a70:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805a74:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805a77:	c1 e0 10             	shl    $0x10,%eax
+  805a7a:	0b 45 10             	or     0x10(%rbp),%eax
+  805a7d:	89 c1                	mov    %eax,%ecx
+  805a7f:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805a82:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805a86:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805a8a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805a8e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805a91:	4d 89 c1             	mov    %r8,%r9
+  805a94:	49 89 f8             	mov    %rdi,%r8
+  805a97:	89 c7                	mov    %eax,%edi
+  805a99:	49 89 df             	mov    %rbx,%r15
+  805a9c:	48 b8 53 93 ff ff ff 	movabs $0xffffffffffff9353,%rax
+  805aa3:	ff ff ff 
+  805aa6:	48 01 d8             	add    %rbx,%rax
+  805aa9:	ff d0                	call   *%rax
+  805aab:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805aae:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ab2:	74 05                	je     805ab9 <ipc_callv+0xbc>
+		return r;
+  805ab4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ab7:	eb 17                	jmp    805ad0 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805ab9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ac0:	ff ff ff 
+  805ac3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ac7:	48 8b 00             	mov    (%rax),%rax
+  805aca:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805ad0:	48 83 c4 40          	add    $0x40,%rsp
+  805ad4:	5b                   	pop    %rbx
+  805ad5:	41 5f                	pop    %r15
+  805ad7:	5d                   	pop    %rbp
+  805ad8:	c3                   	ret
+
+0000000000805ad9 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805ad9:	55                   	push   %rbp
+  805ada:	48 89 e5             	mov    %rsp,%rbp
+  805add:	41 57                	push   %r15
+  805adf:	53                   	push   %rbx
+  805ae0:	48 83 ec 40          	sub    $0x40,%rsp
+  805ae4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ae4 <ipc_reply_recv+0xb>
+  805aeb:	49 bb 4c 25 00 00 00 	movabs $0x254c,%r11
+  805af2:	00 00 00 
+  805af5:	4c 01 db             	add    %r11,%rbx
+  805af8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805afb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805afe:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805b02:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805b05:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805b09:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805b0d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805b12:	75 0e                	jne    805b22 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805b14:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b1b:	00 00 00 
+  805b1e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805b22:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805b27:	75 0e                	jne    805b37 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805b29:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b30:	00 00 00 
+  805b33:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805b37:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805b3a:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805b3e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805b42:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805b45:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b49:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b4c:	4d 89 c1             	mov    %r8,%r9
+  805b4f:	49 89 f8             	mov    %rdi,%r8
+  805b52:	89 c7                	mov    %eax,%edi
+  805b54:	49 89 df             	mov    %rbx,%r15
+  805b57:	48 b8 c7 93 ff ff ff 	movabs $0xffffffffffff93c7,%rax
+  805b5e:	ff ff ff 
+  805b61:	48 01 d8             	add    %rbx,%rax
+  805b64:	ff d0                	call   *%rax
+  805b66:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805b69:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805b6e:	74 2a                	je     805b9a <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805b70:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b74:	75 19                	jne    805b8f <ipc_reply_recv+0xb6>
+  805b76:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b7d:	ff ff ff 
+  805b80:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b84:	48 8b 00             	mov    (%rax),%rax
+  805b87:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805b8d:	eb 05                	jmp    805b94 <ipc_reply_recv+0xbb>
+  805b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805b98:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805b9a:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805b9f:	74 2a                	je     805bcb <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805ba1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ba5:	75 19                	jne    805bc0 <ipc_reply_recv+0xe7>
+  805ba7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bae:	ff ff ff 
+  805bb1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bb5:	48 8b 00             	mov    (%rax),%rax
+  805bb8:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805bbe:	eb 05                	jmp    805bc5 <ipc_reply_recv+0xec>
+  805bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bc5:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805bc9:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805bcb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805bcf:	74 05                	je     805bd6 <ipc_reply_recv+0xfd>
+		return r;
+  805bd1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bd4:	eb 17                	jmp    805bed <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805bd6:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bdd:	ff ff ff 
+  805be0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805be4:	48 8b 00             	mov    (%rax),%rax
+  805be7:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805bed:	48 83 c4 40          	add    $0x40,%rsp
+  805bf1:	5b                   	pop    %rbx
+  805bf2:	41 5f                	pop    %r15
+  805bf4:	5d                   	pop    %rbp
+  805bf5:	c3                   	ret
+
+0000000000805bf6 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805bf6:	55                   	push   %rbp
+  805bf7:	48 89 e5             	mov    %rsp,%rbp
+  805bfa:	41 57                	push   %r15
+  805bfc:	53                   	push   %rbx
+  805bfd:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805c04:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c04 <ipc_window_batch+0xe>
+  805c0b:	49 bb 2c 24 00 00 00 	movabs $0x242c,%r11
+  805c12:	00 00 00 
+  805c15:	4c 01 db             	add    %r11,%rbx
+  805c18:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805c1e:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805c25:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805c2b:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805c31:	e9 15 01 00 00       	jmp    805d4b <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805c36:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805c3c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805c3f:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805c46:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805c49:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805c4c:	39 c2                	cmp    %eax,%edx
+  805c4e:	0f 4e c2             	cmovle %edx,%eax
+  805c51:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805c54:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805c5b:	eb 6b                	jmp    805cc8 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805c5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c60:	48 98                	cltq
+  805c62:	48 c1 e0 05          	shl    $0x5,%rax
+  805c66:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805c6a:	48 01 e8             	add    %rbp,%rax
+  805c6d:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805c73:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805c79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c7c:	c1 e0 0c             	shl    $0xc,%eax
+  805c7f:	48 63 d0             	movslq %eax,%rdx
+  805c82:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805c89:	48 01 c2             	add    %rax,%rdx
+  805c8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c8f:	48 98                	cltq
+  805c91:	48 c1 e0 05          	shl    $0x5,%rax
+  805c95:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805c99:	48 01 e8             	add    %rbp,%rax
+  805c9c:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805ca2:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805ca5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ca8:	48 98                	cltq
+  805caa:	48 c1 e0 05          	shl    $0x5,%rax
+  805cae:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805cb2:	48 01 e8             	add    %rbp,%rax
+  805cb5:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805cbc:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805cc2:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805cc4:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805cc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ccb:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805cce:	7c 8d                	jl     805c5d <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805cd0:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805cd7:	74 27                	je     805d00 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805cd9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805cdc:	48 63 d0             	movslq %eax,%rdx
+  805cdf:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805ce6:	48 89 d6             	mov    %rdx,%rsi
+  805ce9:	48 89 c7             	mov    %rax,%rdi
+  805cec:	49 89 df             	mov    %rbx,%r15
+  805cef:	48 b8 6a 96 ff ff ff 	movabs $0xffffffffffff966a,%rax
+  805cf6:	ff ff ff 
+  805cf9:	48 01 d8             	add    %rbx,%rax
+  805cfc:	ff d0                	call   *%rax
+  805cfe:	eb 25                	jmp    805d25 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805d00:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805d03:	48 63 d0             	movslq %eax,%rdx
+  805d06:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805d0d:	48 89 d6             	mov    %rdx,%rsi
+  805d10:	48 89 c7             	mov    %rax,%rdi
+  805d13:	49 89 df             	mov    %rbx,%r15
+  805d16:	48 b8 c8 96 ff ff ff 	movabs $0xffffffffffff96c8,%rax
+  805d1d:	ff ff ff 
+  805d20:	48 01 d8             	add    %rbx,%rax
+  805d23:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805d25:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805d28:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805d2c:	79 05                	jns    805d33 <ipc_window_batch+0x13d>
+			return r;
+  805d2e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d31:	eb 2a                	jmp    805d5d <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805d33:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805d36:	c1 e0 0c             	shl    $0xc,%eax
+  805d39:	48 98                	cltq
+  805d3b:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805d42:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805d45:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805d4b:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805d52:	0f 8f de fe ff ff    	jg     805c36 <ipc_window_batch+0x40>
+	}
+	return 0;
+  805d58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d5d:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805d64:	5b                   	pop    %rbx
+  805d65:	41 5f                	pop    %r15
+  805d67:	5d                   	pop    %rbp
+  805d68:	c3                   	ret
+
+0000000000805d69 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805d69:	55                   	push   %rbp
+  805d6a:	48 89 e5             	mov    %rsp,%rbp
+  805d6d:	48 83 ec 10          	sub    $0x10,%rsp
+  805d71:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d71 <ipc_map_window+0x8>
+  805d78:	49 bb bf 22 00 00 00 	movabs $0x22bf,%r11
+  805d7f:	00 00 00 
+  805d82:	4c 01 d8             	add    %r11,%rax
+  805d85:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805d89:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805d8c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805d8f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805d93:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805d98:	bf 01 00 00 00       	mov    $0x1,%edi
+  805d9d:	49 b8 c6 db ff ff ff 	movabs $0xffffffffffffdbc6,%r8
+  805da4:	ff ff ff 
+  805da7:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805dab:	ff d0                	call   *%rax
+}
+  805dad:	c9                   	leave
+  805dae:	c3                   	ret
+
+0000000000805daf <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805daf:	55                   	push   %rbp
+  805db0:	48 89 e5             	mov    %rsp,%rbp
+  805db3:	48 83 ec 10          	sub    $0x10,%rsp
+  805db7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805db7 <ipc_unmap_window+0x8>
+  805dbe:	49 bb 79 22 00 00 00 	movabs $0x2279,%r11
+  805dc5:	00 00 00 
+  805dc8:	4c 01 d8             	add    %r11,%rax
+  805dcb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805dcf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805dd2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805dd5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805dd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805dde:	bf 00 00 00 00       	mov    $0x0,%edi
+  805de3:	49 b8 c6 db ff ff ff 	movabs $0xffffffffffffdbc6,%r8
+  805dea:	ff ff ff 
+  805ded:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805df1:	ff d0                	call   *%rax
+}
+  805df3:	c9                   	leave
+  805df4:	c3                   	ret
+
+0000000000805df5 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805df5:	55                   	push   %rbp
+  805df6:	48 89 e5             	mov    %rsp,%rbp
+  805df9:	48 83 ec 18          	sub    $0x18,%rsp
+  805dfd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805dfd <ipc_find_env+0x8>
+  805e04:	49 bb 33 22 00 00 00 	movabs $0x2233,%r11
+  805e0b:	00 00 00 
+  805e0e:	4c 01 d8             	add    %r11,%rax
+  805e11:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805e14:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805e1b:	eb 57                	jmp    805e74 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805e1d:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805e24:	ff ff ff 
+  805e27:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805e2b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805e2e:	48 63 d2             	movslq %edx,%rdx
+  805e31:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805e38:	48 01 ca             	add    %rcx,%rdx
+  805e3b:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805e42:	8b 12                	mov    (%rdx),%edx
+  805e44:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805e47:	75 27                	jne    805e70 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805e49:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805e50:	ff ff ff 
+  805e53:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805e57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e5a:	48 98                	cltq
+  805e5c:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  805e63:	48 01 d0             	add    %rdx,%rax
+  805e66:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805e6c:	8b 00                	mov    (%rax),%eax
+  805e6e:	eb 12                	jmp    805e82 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  805e70:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805e74:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805e7b:	7e a0                	jle    805e1d <ipc_find_env+0x28>
+	}
+	return 0;
+  805e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e82:	c9                   	leave
+  805e83:	c3                   	ret
+
+0000000000805e84 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805e84:	55                   	push   %rbp
+  805e85:	48 89 e5             	mov    %rsp,%rbp
+  805e88:	48 83 ec 18          	sub    $0x18,%rsp
+  805e8c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e8c <pageref+0x8>
+  805e93:	49 bb a4 21 00 00 00 	movabs $0x21a4,%r11
+  805e9a:	00 00 00 
+  805e9d:	4c 01 d8             	add    %r11,%rax
+  805ea0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  805ea4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805ea8:	48 89 d1             	mov    %rdx,%rcx
+  805eab:	48 c1 e9 15          	shr    $0x15,%rcx
+  805eaf:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  805eb6:	ff ff ff 
+  805eb9:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805ebd:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805ec1:	83 e2 01             	and    $0x1,%edx
+  805ec4:	48 85 d2             	test   %rdx,%rdx
+  805ec7:	75 07                	jne    805ed0 <pageref+0x4c>
+		return 0;
+  805ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ece:	eb 64                	jmp    805f34 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  805ed0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805ed4:	48 89 d1             	mov    %rdx,%rcx
+  805ed7:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805edb:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  805ee2:	ff ff ff 
+  805ee5:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805ee9:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805eed:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  805ef1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805ef5:	83 e2 01             	and    $0x1,%edx
+  805ef8:	48 85 d2             	test   %rdx,%rdx
+  805efb:	75 07                	jne    805f04 <pageref+0x80>
+		return 0;
+  805efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f02:	eb 30                	jmp    805f34 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  805f04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805f08:	48 c1 ea 0c          	shr    $0xc,%rdx
+  805f0c:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  805f13:	ff ff ff 
+  805f16:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  805f1a:	48 89 d0             	mov    %rdx,%rax
+  805f1d:	48 01 c0             	add    %rax,%rax
+  805f20:	48 01 d0             	add    %rdx,%rax
+  805f23:	48 c1 e0 03          	shl    $0x3,%rax
+  805f27:	48 01 c8             	add    %rcx,%rax
+  805f2a:	48 83 c0 08          	add    $0x8,%rax
+  805f2e:	0f b7 00             	movzwl (%rax),%eax
+  805f31:	0f b7 c0             	movzwl %ax,%eax
+}
+  805f34:	c9                   	leave
+  805f35:	c3                   	ret
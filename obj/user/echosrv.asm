@@ -0,0 +1,10194 @@
+
+obj/user/echosrv:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 35 04 00 00       	call   800476 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <die>:
+#define BUFFSIZE 32
+#define MAXPENDING 5    // Max connection requests
+
+static void
+die(char *m)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 10          	sub    $0x10,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <die+0xb>
+  800055:	49 bb e2 8f 00 00 00 	movabs $0x8fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	cprintf("%s\n", m);
+  800066:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80006a:	48 89 c6             	mov    %rax,%rsi
+  80006d:	48 b8 18 d7 ff ff ff 	movabs $0xffffffffffffd718,%rax
+  800074:	ff ff ff 
+  800077:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80007b:	48 89 c7             	mov    %rax,%rdi
+  80007e:	49 89 df             	mov    %rbx,%r15
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  80008d:	ff ff ff 
+  800090:	48 01 da             	add    %rbx,%rdx
+  800093:	ff d2                	call   *%rdx
+	exit();
+  800095:	49 89 df             	mov    %rbx,%r15
+  800098:	48 b8 06 75 ff ff ff 	movabs $0xffffffffffff7506,%rax
+  80009f:	ff ff ff 
+  8000a2:	48 01 d8             	add    %rbx,%rax
+  8000a5:	ff d0                	call   *%rax
+}
+  8000a7:	90                   	nop
+  8000a8:	48 83 c4 10          	add    $0x10,%rsp
+  8000ac:	5b                   	pop    %rbx
+  8000ad:	41 5f                	pop    %r15
+  8000af:	5d                   	pop    %rbp
+  8000b0:	c3                   	ret
+
+00000000008000b1 <handle_client>:
+
+void
+handle_client(int sock)
+{
+  8000b1:	55                   	push   %rbp
+  8000b2:	48 89 e5             	mov    %rsp,%rbp
+  8000b5:	41 57                	push   %r15
+  8000b7:	53                   	push   %rbx
+  8000b8:	48 83 ec 40          	sub    $0x40,%rsp
+  8000bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000bc <handle_client+0xb>
+  8000c3:	49 bb 74 8f 00 00 00 	movabs $0x8f74,%r11
+  8000ca:	00 00 00 
+  8000cd:	4c 01 db             	add    %r11,%rbx
+  8000d0:	89 7d bc             	mov    %edi,-0x44(%rbp)
+	char buffer[BUFFSIZE];
+	int received = -1;
+  8000d3:	c7 45 ec ff ff ff ff 	movl   $0xffffffff,-0x14(%rbp)
+	// Receive message
+	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  8000da:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+  8000de:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8000e1:	ba 20 00 00 00       	mov    $0x20,%edx
+  8000e6:	48 89 ce             	mov    %rcx,%rsi
+  8000e9:	89 c7                	mov    %eax,%edi
+  8000eb:	49 89 df             	mov    %rbx,%r15
+  8000ee:	48 b8 6c 9f ff ff ff 	movabs $0xffffffffffff9f6c,%rax
+  8000f5:	ff ff ff 
+  8000f8:	48 01 d8             	add    %rbx,%rax
+  8000fb:	ff d0                	call   *%rax
+  8000fd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800100:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800104:	0f 89 bd 00 00 00    	jns    8001c7 <handle_client+0x116>
+		die("Failed to receive initial bytes from client");
+  80010a:	48 b8 20 d7 ff ff ff 	movabs $0xffffffffffffd720,%rax
+  800111:	ff ff ff 
+  800114:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800118:	48 89 c7             	mov    %rax,%rdi
+  80011b:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  800122:	ff ff ff 
+  800125:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800129:	ff d0                	call   *%rax
+
+	// Send bytes and check for more incoming data in loop
+	while (received > 0) {
+  80012b:	e9 97 00 00 00       	jmp    8001c7 <handle_client+0x116>
+		// Send back received data
+		if (write(sock, buffer, received) != received)
+  800130:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800133:	48 63 d0             	movslq %eax,%rdx
+  800136:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+  80013a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80013d:	48 89 ce             	mov    %rcx,%rsi
+  800140:	89 c7                	mov    %eax,%edi
+  800142:	49 89 df             	mov    %rbx,%r15
+  800145:	48 b8 12 a1 ff ff ff 	movabs $0xffffffffffffa112,%rax
+  80014c:	ff ff ff 
+  80014f:	48 01 d8             	add    %rbx,%rax
+  800152:	ff d0                	call   *%rax
+  800154:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800157:	74 21                	je     80017a <handle_client+0xc9>
+			die("Failed to send bytes to client");
+  800159:	48 b8 50 d7 ff ff ff 	movabs $0xffffffffffffd750,%rax
+  800160:	ff ff ff 
+  800163:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800167:	48 89 c7             	mov    %rax,%rdi
+  80016a:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  800171:	ff ff ff 
+  800174:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800178:	ff d0                	call   *%rax
+
+		// Check for more data
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  80017a:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+  80017e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800181:	ba 20 00 00 00       	mov    $0x20,%edx
+  800186:	48 89 ce             	mov    %rcx,%rsi
+  800189:	89 c7                	mov    %eax,%edi
+  80018b:	49 89 df             	mov    %rbx,%r15
+  80018e:	48 b8 6c 9f ff ff ff 	movabs $0xffffffffffff9f6c,%rax
+  800195:	ff ff ff 
+  800198:	48 01 d8             	add    %rbx,%rax
+  80019b:	ff d0                	call   *%rax
+  80019d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8001a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001a4:	79 21                	jns    8001c7 <handle_client+0x116>
+			die("Failed to receive additional bytes from client");
+  8001a6:	48 b8 70 d7 ff ff ff 	movabs $0xffffffffffffd770,%rax
+  8001ad:	ff ff ff 
+  8001b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001b4:	48 89 c7             	mov    %rax,%rdi
+  8001b7:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  8001be:	ff ff ff 
+  8001c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001c5:	ff d0                	call   *%rax
+	while (received > 0) {
+  8001c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001cb:	0f 8f 5f ff ff ff    	jg     800130 <handle_client+0x7f>
+	}
+	close(sock);
+  8001d1:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8001d4:	89 c7                	mov    %eax,%edi
+  8001d6:	49 89 df             	mov    %rbx,%r15
+  8001d9:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  8001e0:	ff ff ff 
+  8001e3:	48 01 d8             	add    %rbx,%rax
+  8001e6:	ff d0                	call   *%rax
+}
+  8001e8:	90                   	nop
+  8001e9:	48 83 c4 40          	add    $0x40,%rsp
+  8001ed:	5b                   	pop    %rbx
+  8001ee:	41 5f                	pop    %r15
+  8001f0:	5d                   	pop    %rbp
+  8001f1:	c3                   	ret
+
+00000000008001f2 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001f2:	55                   	push   %rbp
+  8001f3:	48 89 e5             	mov    %rsp,%rbp
+  8001f6:	41 57                	push   %r15
+  8001f8:	53                   	push   %rbx
+  8001f9:	48 83 ec 70          	sub    $0x70,%rsp
+  8001fd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8001fd <umain+0xb>
+  800204:	49 bb 33 8e 00 00 00 	movabs $0x8e33,%r11
+  80020b:	00 00 00 
+  80020e:	4c 01 db             	add    %r11,%rbx
+  800211:	89 7d 8c             	mov    %edi,-0x74(%rbp)
+  800214:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+	int serversock, clientsock;
+	struct sockaddr_in echoserver, echoclient;
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+  800218:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  80021f:	ba 06 00 00 00       	mov    $0x6,%edx
+  800224:	be 01 00 00 00       	mov    $0x1,%esi
+  800229:	bf 02 00 00 00       	mov    $0x2,%edi
+  80022e:	49 89 df             	mov    %rbx,%r15
+  800231:	48 b8 e2 b4 ff ff ff 	movabs $0xffffffffffffb4e2,%rax
+  800238:	ff ff ff 
+  80023b:	48 01 d8             	add    %rbx,%rax
+  80023e:	ff d0                	call   *%rax
+  800240:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800243:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800247:	79 21                	jns    80026a <umain+0x78>
+		die("Failed to create socket");
+  800249:	48 b8 9f d7 ff ff ff 	movabs $0xffffffffffffd79f,%rax
+  800250:	ff ff ff 
+  800253:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800257:	48 89 c7             	mov    %rax,%rdi
+  80025a:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  800261:	ff ff ff 
+  800264:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800268:	ff d0                	call   *%rax
+
+	cprintf("opened socket\n");
+  80026a:	48 b8 b7 d7 ff ff ff 	movabs $0xffffffffffffd7b7,%rax
+  800271:	ff ff ff 
+  800274:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800278:	48 89 c7             	mov    %rax,%rdi
+  80027b:	49 89 df             	mov    %rbx,%r15
+  80027e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800283:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  80028a:	ff ff ff 
+  80028d:	48 01 da             	add    %rbx,%rdx
+  800290:	ff d2                	call   *%rdx
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  800292:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800296:	ba 10 00 00 00       	mov    $0x10,%edx
+  80029b:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a0:	48 89 c7             	mov    %rax,%rdi
+  8002a3:	49 89 df             	mov    %rbx,%r15
+  8002a6:	48 b8 d1 87 ff ff ff 	movabs $0xffffffffffff87d1,%rax
+  8002ad:	ff ff ff 
+  8002b0:	48 01 d8             	add    %rbx,%rax
+  8002b3:	ff d0                	call   *%rax
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  8002b5:	c6 45 d1 02          	movb   $0x2,-0x2f(%rbp)
+	echoserver.sin_addr.s_addr = htonl(INADDR_ANY);   // IP address
+  8002b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002be:	49 89 df             	mov    %rbx,%r15
+  8002c1:	48 b8 8f d6 ff ff ff 	movabs $0xffffffffffffd68f,%rax
+  8002c8:	ff ff ff 
+  8002cb:	48 01 d8             	add    %rbx,%rax
+  8002ce:	ff d0                	call   *%rax
+  8002d0:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  8002d3:	bf 07 00 00 00       	mov    $0x7,%edi
+  8002d8:	49 89 df             	mov    %rbx,%r15
+  8002db:	48 b8 1e d6 ff ff ff 	movabs $0xffffffffffffd61e,%rax
+  8002e2:	ff ff ff 
+  8002e5:	48 01 d8             	add    %rbx,%rax
+  8002e8:	ff d0                	call   *%rax
+  8002ea:	66 89 45 d2          	mov    %ax,-0x2e(%rbp)
+
+	cprintf("trying to bind\n");
+  8002ee:	48 b8 c6 d7 ff ff ff 	movabs $0xffffffffffffd7c6,%rax
+  8002f5:	ff ff ff 
+  8002f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002fc:	48 89 c7             	mov    %rax,%rdi
+  8002ff:	49 89 df             	mov    %rbx,%r15
+  800302:	b8 00 00 00 00       	mov    $0x0,%eax
+  800307:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  80030e:	ff ff ff 
+  800311:	48 01 da             	add    %rbx,%rdx
+  800314:	ff d2                	call   *%rdx
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &echoserver,
+  800316:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80031a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80031d:	ba 10 00 00 00       	mov    $0x10,%edx
+  800322:	48 89 ce             	mov    %rcx,%rsi
+  800325:	89 c7                	mov    %eax,%edi
+  800327:	49 89 df             	mov    %rbx,%r15
+  80032a:	48 b8 9b b1 ff ff ff 	movabs $0xffffffffffffb19b,%rax
+  800331:	ff ff ff 
+  800334:	48 01 d8             	add    %rbx,%rax
+  800337:	ff d0                	call   *%rax
+  800339:	85 c0                	test   %eax,%eax
+  80033b:	79 21                	jns    80035e <umain+0x16c>
+		 sizeof(echoserver)) < 0) {
+		die("Failed to bind the server socket");
+  80033d:	48 b8 d8 d7 ff ff ff 	movabs $0xffffffffffffd7d8,%rax
+  800344:	ff ff ff 
+  800347:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80034b:	48 89 c7             	mov    %rax,%rdi
+  80034e:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  800355:	ff ff ff 
+  800358:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80035c:	ff d0                	call   *%rax
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  80035e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800361:	be 05 00 00 00       	mov    $0x5,%esi
+  800366:	89 c7                	mov    %eax,%edi
+  800368:	49 89 df             	mov    %rbx,%r15
+  80036b:	48 b8 60 b3 ff ff ff 	movabs $0xffffffffffffb360,%rax
+  800372:	ff ff ff 
+  800375:	48 01 d8             	add    %rbx,%rax
+  800378:	ff d0                	call   *%rax
+  80037a:	85 c0                	test   %eax,%eax
+  80037c:	79 21                	jns    80039f <umain+0x1ad>
+		die("Failed to listen on server socket");
+  80037e:	48 b8 00 d8 ff ff ff 	movabs $0xffffffffffffd800,%rax
+  800385:	ff ff ff 
+  800388:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80038c:	48 89 c7             	mov    %rax,%rdi
+  80038f:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  800396:	ff ff ff 
+  800399:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80039d:	ff d0                	call   *%rax
+
+	cprintf("bound\n");
+  80039f:	48 b8 22 d8 ff ff ff 	movabs $0xffffffffffffd822,%rax
+  8003a6:	ff ff ff 
+  8003a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003ad:	48 89 c7             	mov    %rax,%rdi
+  8003b0:	49 89 df             	mov    %rbx,%r15
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  8003bf:	ff ff ff 
+  8003c2:	48 01 da             	add    %rbx,%rdx
+  8003c5:	ff d2                	call   *%rdx
+
+	// Run until canceled
+	while (1) {
+		unsigned int clientlen = sizeof(echoclient);
+  8003c7:	c7 45 9c 10 00 00 00 	movl   $0x10,-0x64(%rbp)
+		// Wait for client connection
+		if ((clientsock =
+		     accept(serversock, (struct sockaddr *) &echoclient,
+  8003ce:	48 8d 55 9c          	lea    -0x64(%rbp),%rdx
+  8003d2:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+  8003d6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003d9:	48 89 ce             	mov    %rcx,%rsi
+  8003dc:	89 c7                	mov    %eax,%edi
+  8003de:	49 89 df             	mov    %rbx,%r15
+  8003e1:	48 b8 00 b1 ff ff ff 	movabs $0xffffffffffffb100,%rax
+  8003e8:	ff ff ff 
+  8003eb:	48 01 d8             	add    %rbx,%rax
+  8003ee:	ff d0                	call   *%rax
+  8003f0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+		if ((clientsock =
+  8003f3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8003f7:	79 21                	jns    80041a <umain+0x228>
+			    &clientlen)) < 0) {
+			die("Failed to accept client connection");
+  8003f9:	48 b8 30 d8 ff ff ff 	movabs $0xffffffffffffd830,%rax
+  800400:	ff ff ff 
+  800403:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800407:	48 89 c7             	mov    %rax,%rdi
+  80040a:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  800411:	ff ff ff 
+  800414:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800418:	ff d0                	call   *%rax
+		}
+		cprintf("Client connected: %s\n", inet_ntoa(echoclient.sin_addr));
+  80041a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80041d:	89 c7                	mov    %eax,%edi
+  80041f:	49 89 df             	mov    %rbx,%r15
+  800422:	48 b8 f4 d4 ff ff ff 	movabs $0xffffffffffffd4f4,%rax
+  800429:	ff ff ff 
+  80042c:	48 01 d8             	add    %rbx,%rax
+  80042f:	ff d0                	call   *%rax
+  800431:	48 89 c6             	mov    %rax,%rsi
+  800434:	48 b8 53 d8 ff ff ff 	movabs $0xffffffffffffd853,%rax
+  80043b:	ff ff ff 
+  80043e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800442:	48 89 c7             	mov    %rax,%rdi
+  800445:	49 89 df             	mov    %rbx,%r15
+  800448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044d:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  800454:	ff ff ff 
+  800457:	48 01 da             	add    %rbx,%rdx
+  80045a:	ff d2                	call   *%rdx
+		handle_client(clientsock);
+  80045c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80045f:	89 c7                	mov    %eax,%edi
+  800461:	48 b8 81 70 ff ff ff 	movabs $0xffffffffffff7081,%rax
+  800468:	ff ff ff 
+  80046b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80046f:	ff d0                	call   *%rax
+	while (1) {
+  800471:	e9 51 ff ff ff       	jmp    8003c7 <umain+0x1d5>
+
+0000000000800476 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800476:	55                   	push   %rbp
+  800477:	48 89 e5             	mov    %rsp,%rbp
+  80047a:	41 57                	push   %r15
+  80047c:	53                   	push   %rbx
+  80047d:	48 83 ec 20          	sub    $0x20,%rsp
+  800481:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800481 <libmain+0xb>
+  800488:	49 bb af 8b 00 00 00 	movabs $0x8baf,%r11
+  80048f:	00 00 00 
+  800492:	4c 01 db             	add    %r11,%rbx
+  800495:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800498:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80049c:	49 89 df             	mov    %rbx,%r15
+  80049f:	48 b8 a3 90 ff ff ff 	movabs $0xffffffffffff90a3,%rax
+  8004a6:	ff ff ff 
+  8004a9:	48 01 d8             	add    %rbx,%rax
+  8004ac:	ff d0                	call   *%rax
+  8004ae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8004b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004b9:	48 98                	cltq
+  8004bb:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8004c2:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8004c9:	ff ff ff 
+  8004cc:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8004d0:	48 01 c2             	add    %rax,%rdx
+  8004d3:	48 b8 f0 1f 01 00 00 	movabs $0x11ff0,%rax
+  8004da:	00 00 00 
+  8004dd:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004e1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8004e5:	7e 15                	jle    8004fc <libmain+0x86>
+		binaryname = argv[0];
+  8004e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004eb:	48 8b 00             	mov    (%rax),%rax
+  8004ee:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  8004f5:	00 00 00 
+  8004f8:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8004fc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800500:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800503:	48 89 d6             	mov    %rdx,%rsi
+  800506:	89 c7                	mov    %eax,%edi
+  800508:	49 89 df             	mov    %rbx,%r15
+  80050b:	48 b8 c2 71 ff ff ff 	movabs $0xffffffffffff71c2,%rax
+  800512:	ff ff ff 
+  800515:	48 01 d8             	add    %rbx,%rax
+  800518:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80051a:	49 89 df             	mov    %rbx,%r15
+  80051d:	48 b8 06 75 ff ff ff 	movabs $0xffffffffffff7506,%rax
+  800524:	ff ff ff 
+  800527:	48 01 d8             	add    %rbx,%rax
+  80052a:	ff d0                	call   *%rax
+}
+  80052c:	90                   	nop
+  80052d:	48 83 c4 20          	add    $0x20,%rsp
+  800531:	5b                   	pop    %rbx
+  800532:	41 5f                	pop    %r15
+  800534:	5d                   	pop    %rbp
+  800535:	c3                   	ret
+
+0000000000800536 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800536:	55                   	push   %rbp
+  800537:	48 89 e5             	mov    %rsp,%rbp
+  80053a:	41 57                	push   %r15
+  80053c:	53                   	push   %rbx
+  80053d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80053d <exit+0x7>
+  800544:	49 bb f3 8a 00 00 00 	movabs $0x8af3,%r11
+  80054b:	00 00 00 
+  80054e:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800551:	49 89 df             	mov    %rbx,%r15
+  800554:	48 b8 20 9d ff ff ff 	movabs $0xffffffffffff9d20,%rax
+  80055b:	ff ff ff 
+  80055e:	48 01 d8             	add    %rbx,%rax
+  800561:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800563:	bf 00 00 00 00       	mov    $0x0,%edi
+  800568:	49 89 df             	mov    %rbx,%r15
+  80056b:	48 b8 47 90 ff ff ff 	movabs $0xffffffffffff9047,%rax
+  800572:	ff ff ff 
+  800575:	48 01 d8             	add    %rbx,%rax
+  800578:	ff d0                	call   *%rax
+}
+  80057a:	90                   	nop
+  80057b:	5b                   	pop    %rbx
+  80057c:	41 5f                	pop    %r15
+  80057e:	5d                   	pop    %rbp
+  80057f:	c3                   	ret
+
+0000000000800580 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800580:	55                   	push   %rbp
+  800581:	48 89 e5             	mov    %rsp,%rbp
+  800584:	41 57                	push   %r15
+  800586:	48 83 ec 18          	sub    $0x18,%rsp
+  80058a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80058a <putch+0xa>
+  800591:	49 bb a6 8a 00 00 00 	movabs $0x8aa6,%r11
+  800598:	00 00 00 
+  80059b:	4c 01 d8             	add    %r11,%rax
+  80059e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8005a1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8005a5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005a9:	8b 12                	mov    (%rdx),%edx
+  8005ab:	8d 72 01             	lea    0x1(%rdx),%esi
+  8005ae:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8005b2:	89 31                	mov    %esi,(%rcx)
+  8005b4:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8005b7:	89 ce                	mov    %ecx,%esi
+  8005b9:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8005bd:	48 63 d2             	movslq %edx,%rdx
+  8005c0:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8005c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005c9:	8b 12                	mov    (%rdx),%edx
+  8005cb:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005d1:	75 33                	jne    800606 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8005d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005d7:	8b 12                	mov    (%rdx),%edx
+  8005d9:	48 63 d2             	movslq %edx,%rdx
+  8005dc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8005e0:	48 83 c1 08          	add    $0x8,%rcx
+  8005e4:	48 89 d6             	mov    %rdx,%rsi
+  8005e7:	48 89 cf             	mov    %rcx,%rdi
+  8005ea:	49 89 c7             	mov    %rax,%r15
+  8005ed:	48 ba 94 8f ff ff ff 	movabs $0xffffffffffff8f94,%rdx
+  8005f4:	ff ff ff 
+  8005f7:	48 01 c2             	add    %rax,%rdx
+  8005fa:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8005fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800600:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800606:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80060a:	8b 40 04             	mov    0x4(%rax),%eax
+  80060d:	8d 50 01             	lea    0x1(%rax),%edx
+  800610:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800614:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800617:	90                   	nop
+  800618:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80061c:	c9                   	leave
+  80061d:	c3                   	ret
+
+000000000080061e <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80061e:	55                   	push   %rbp
+  80061f:	48 89 e5             	mov    %rsp,%rbp
+  800622:	41 57                	push   %r15
+  800624:	53                   	push   %rbx
+  800625:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80062c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80062c <vcprintf+0xe>
+  800633:	49 bb 04 8a 00 00 00 	movabs $0x8a04,%r11
+  80063a:	00 00 00 
+  80063d:	4c 01 db             	add    %r11,%rbx
+  800640:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800647:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80064e:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800655:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80065c:	48 8b 06             	mov    (%rsi),%rax
+  80065f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800663:	48 89 01             	mov    %rax,(%rcx)
+  800666:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80066a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80066e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800672:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800679:	00 00 00 
+    b.cnt = 0;
+  80067c:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800683:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800686:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80068d:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800694:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80069b:	48 89 c6             	mov    %rax,%rsi
+  80069e:	48 b8 50 75 ff ff ff 	movabs $0xffffffffffff7550,%rax
+  8006a5:	ff ff ff 
+  8006a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006ac:	48 89 c7             	mov    %rax,%rdi
+  8006af:	49 89 df             	mov    %rbx,%r15
+  8006b2:	48 b8 12 7b ff ff ff 	movabs $0xffffffffffff7b12,%rax
+  8006b9:	ff ff ff 
+  8006bc:	48 01 d8             	add    %rbx,%rax
+  8006bf:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8006c1:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8006c7:	48 98                	cltq
+  8006c9:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8006d0:	48 83 c2 08          	add    $0x8,%rdx
+  8006d4:	48 89 c6             	mov    %rax,%rsi
+  8006d7:	48 89 d7             	mov    %rdx,%rdi
+  8006da:	49 89 df             	mov    %rbx,%r15
+  8006dd:	48 b8 94 8f ff ff ff 	movabs $0xffffffffffff8f94,%rax
+  8006e4:	ff ff ff 
+  8006e7:	48 01 d8             	add    %rbx,%rax
+  8006ea:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8006ec:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8006f2:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8006f9:	5b                   	pop    %rbx
+  8006fa:	41 5f                	pop    %r15
+  8006fc:	5d                   	pop    %rbp
+  8006fd:	c3                   	ret
+
+00000000008006fe <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8006fe:	55                   	push   %rbp
+  8006ff:	48 89 e5             	mov    %rsp,%rbp
+  800702:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800709:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800709 <cprintf+0xb>
+  800710:	49 bb 27 89 00 00 00 	movabs $0x8927,%r11
+  800717:	00 00 00 
+  80071a:	4d 01 da             	add    %r11,%r10
+  80071d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800724:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80072b:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800732:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800739:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800740:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800747:	84 c0                	test   %al,%al
+  800749:	74 20                	je     80076b <cprintf+0x6d>
+  80074b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80074f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800753:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800757:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80075b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80075f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800763:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800767:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80076b:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800772:	00 00 00 
+  800775:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80077c:	00 00 00 
+  80077f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800783:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80078a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800791:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800798:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80079f:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8007a6:	48 8b 06             	mov    (%rsi),%rax
+  8007a9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007ad:	48 89 01             	mov    %rax,(%rcx)
+  8007b0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007b4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007b8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8007bc:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8007c3:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8007ca:	48 89 d6             	mov    %rdx,%rsi
+  8007cd:	48 89 c7             	mov    %rax,%rdi
+  8007d0:	48 b8 ee 75 ff ff ff 	movabs $0xffffffffffff75ee,%rax
+  8007d7:	ff ff ff 
+  8007da:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8007de:	ff d0                	call   *%rax
+  8007e0:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8007e6:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8007ec:	c9                   	leave
+  8007ed:	c3                   	ret
+
+00000000008007ee <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8007ee:	55                   	push   %rbp
+  8007ef:	48 89 e5             	mov    %rsp,%rbp
+  8007f2:	53                   	push   %rbx
+  8007f3:	48 83 ec 38          	sub    $0x38,%rsp
+  8007f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8007f7 <printnum+0x9>
+  8007fe:	49 bb 39 88 00 00 00 	movabs $0x8839,%r11
+  800805:	00 00 00 
+  800808:	4c 01 db             	add    %r11,%rbx
+  80080b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80080f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800813:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800817:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80081a:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  80081e:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800822:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800825:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800829:	72 58                	jb     800883 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80082b:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80082e:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800831:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800834:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800838:	ba 00 00 00 00       	mov    $0x0,%edx
+  80083d:	48 f7 f6             	div    %rsi
+  800840:	49 89 c2             	mov    %rax,%r10
+  800843:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800846:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800849:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80084d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800851:	41 89 c9             	mov    %ecx,%r9d
+  800854:	41 89 f8             	mov    %edi,%r8d
+  800857:	89 d1                	mov    %edx,%ecx
+  800859:	4c 89 d2             	mov    %r10,%rdx
+  80085c:	48 89 c7             	mov    %rax,%rdi
+  80085f:	48 b8 be 77 ff ff ff 	movabs $0xffffffffffff77be,%rax
+  800866:	ff ff ff 
+  800869:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80086d:	ff d0                	call   *%rax
+  80086f:	eb 1c                	jmp    80088d <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800871:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800875:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800878:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80087c:	48 89 d6             	mov    %rdx,%rsi
+  80087f:	89 c7                	mov    %eax,%edi
+  800881:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800883:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800887:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80088b:	7f e4                	jg     800871 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80088d:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800890:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800894:	ba 00 00 00 00       	mov    $0x0,%edx
+  800899:	48 f7 f1             	div    %rcx
+  80089c:	48 b8 af d9 ff ff ff 	movabs $0xffffffffffffd9af,%rax
+  8008a3:	ff ff ff 
+  8008a6:	48 01 d8             	add    %rbx,%rax
+  8008a9:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8008ad:	0f be c0             	movsbl %al,%eax
+  8008b0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008b4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8008b8:	48 89 d6             	mov    %rdx,%rsi
+  8008bb:	89 c7                	mov    %eax,%edi
+  8008bd:	ff d1                	call   *%rcx
+}
+  8008bf:	90                   	nop
+  8008c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008c4:	c9                   	leave
+  8008c5:	c3                   	ret
+
+00000000008008c6 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8008c6:	55                   	push   %rbp
+  8008c7:	48 89 e5             	mov    %rsp,%rbp
+  8008ca:	48 83 ec 20          	sub    $0x20,%rsp
+  8008ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008ce <getuint+0x8>
+  8008d5:	49 bb 62 87 00 00 00 	movabs $0x8762,%r11
+  8008dc:	00 00 00 
+  8008df:	4c 01 d8             	add    %r11,%rax
+  8008e2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008e6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8008e9:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8008ed:	7e 4f                	jle    80093e <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8008ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008f3:	8b 00                	mov    (%rax),%eax
+  8008f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f8:	77 24                	ja     80091e <getuint+0x58>
+  8008fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008fe:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800902:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800906:	8b 00                	mov    (%rax),%eax
+  800908:	89 c0                	mov    %eax,%eax
+  80090a:	48 01 d0             	add    %rdx,%rax
+  80090d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800911:	8b 12                	mov    (%rdx),%edx
+  800913:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800916:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80091a:	89 0a                	mov    %ecx,(%rdx)
+  80091c:	eb 14                	jmp    800932 <getuint+0x6c>
+  80091e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800922:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800926:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80092a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80092e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800932:	48 8b 00             	mov    (%rax),%rax
+  800935:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800939:	e9 9d 00 00 00       	jmp    8009db <getuint+0x115>
+	else if (lflag)
+  80093e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800942:	74 4c                	je     800990 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800944:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800948:	8b 00                	mov    (%rax),%eax
+  80094a:	83 f8 2f             	cmp    $0x2f,%eax
+  80094d:	77 24                	ja     800973 <getuint+0xad>
+  80094f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800953:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800957:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80095b:	8b 00                	mov    (%rax),%eax
+  80095d:	89 c0                	mov    %eax,%eax
+  80095f:	48 01 d0             	add    %rdx,%rax
+  800962:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800966:	8b 12                	mov    (%rdx),%edx
+  800968:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80096b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80096f:	89 0a                	mov    %ecx,(%rdx)
+  800971:	eb 14                	jmp    800987 <getuint+0xc1>
+  800973:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800977:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80097b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80097f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800983:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800987:	48 8b 00             	mov    (%rax),%rax
+  80098a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80098e:	eb 4b                	jmp    8009db <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800990:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800994:	8b 00                	mov    (%rax),%eax
+  800996:	83 f8 2f             	cmp    $0x2f,%eax
+  800999:	77 24                	ja     8009bf <getuint+0xf9>
+  80099b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80099f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a7:	8b 00                	mov    (%rax),%eax
+  8009a9:	89 c0                	mov    %eax,%eax
+  8009ab:	48 01 d0             	add    %rdx,%rax
+  8009ae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009b2:	8b 12                	mov    (%rdx),%edx
+  8009b4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009b7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009bb:	89 0a                	mov    %ecx,(%rdx)
+  8009bd:	eb 14                	jmp    8009d3 <getuint+0x10d>
+  8009bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009c7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009cb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009cf:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009d3:	8b 00                	mov    (%rax),%eax
+  8009d5:	89 c0                	mov    %eax,%eax
+  8009d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8009db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8009df:	c9                   	leave
+  8009e0:	c3                   	ret
+
+00000000008009e1 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8009e1:	55                   	push   %rbp
+  8009e2:	48 89 e5             	mov    %rsp,%rbp
+  8009e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8009e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8009e9 <printfloat+0x8>
+  8009f0:	49 bb 47 86 00 00 00 	movabs $0x8647,%r11
+  8009f7:	00 00 00 
+  8009fa:	4c 01 d8             	add    %r11,%rax
+  8009fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a01:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a05:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800a09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a0d:	48 85 c0             	test   %rax,%rax
+  800a10:	79 12                	jns    800a24 <printfloat+0x43>
+		putch('-',putdat);
+  800a12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a16:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a1a:	48 89 c6             	mov    %rax,%rsi
+  800a1d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a22:	ff d2                	call   *%rdx
+	
+}
+  800a24:	90                   	nop
+  800a25:	c9                   	leave
+  800a26:	c3                   	ret
+
+0000000000800a27 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800a27:	55                   	push   %rbp
+  800a28:	48 89 e5             	mov    %rsp,%rbp
+  800a2b:	48 83 ec 20          	sub    $0x20,%rsp
+  800a2f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a2f <getint+0x8>
+  800a36:	49 bb 01 86 00 00 00 	movabs $0x8601,%r11
+  800a3d:	00 00 00 
+  800a40:	4c 01 d8             	add    %r11,%rax
+  800a43:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a47:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800a4a:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a4e:	7e 4f                	jle    800a9f <getint+0x78>
+		x=va_arg(*ap, long long);
+  800a50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a54:	8b 00                	mov    (%rax),%eax
+  800a56:	83 f8 2f             	cmp    $0x2f,%eax
+  800a59:	77 24                	ja     800a7f <getint+0x58>
+  800a5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a67:	8b 00                	mov    (%rax),%eax
+  800a69:	89 c0                	mov    %eax,%eax
+  800a6b:	48 01 d0             	add    %rdx,%rax
+  800a6e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a72:	8b 12                	mov    (%rdx),%edx
+  800a74:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a77:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a7b:	89 0a                	mov    %ecx,(%rdx)
+  800a7d:	eb 14                	jmp    800a93 <getint+0x6c>
+  800a7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a83:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a87:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a8b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a8f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a93:	48 8b 00             	mov    (%rax),%rax
+  800a96:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a9a:	e9 9d 00 00 00       	jmp    800b3c <getint+0x115>
+	else if (lflag)
+  800a9f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800aa3:	74 4c                	je     800af1 <getint+0xca>
+		x=va_arg(*ap, long);
+  800aa5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa9:	8b 00                	mov    (%rax),%eax
+  800aab:	83 f8 2f             	cmp    $0x2f,%eax
+  800aae:	77 24                	ja     800ad4 <getint+0xad>
+  800ab0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ab8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800abc:	8b 00                	mov    (%rax),%eax
+  800abe:	89 c0                	mov    %eax,%eax
+  800ac0:	48 01 d0             	add    %rdx,%rax
+  800ac3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ac7:	8b 12                	mov    (%rdx),%edx
+  800ac9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800acc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ad0:	89 0a                	mov    %ecx,(%rdx)
+  800ad2:	eb 14                	jmp    800ae8 <getint+0xc1>
+  800ad4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800adc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ae0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ae4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ae8:	48 8b 00             	mov    (%rax),%rax
+  800aeb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800aef:	eb 4b                	jmp    800b3c <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800af1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af5:	8b 00                	mov    (%rax),%eax
+  800af7:	83 f8 2f             	cmp    $0x2f,%eax
+  800afa:	77 24                	ja     800b20 <getint+0xf9>
+  800afc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b00:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b08:	8b 00                	mov    (%rax),%eax
+  800b0a:	89 c0                	mov    %eax,%eax
+  800b0c:	48 01 d0             	add    %rdx,%rax
+  800b0f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b13:	8b 12                	mov    (%rdx),%edx
+  800b15:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b18:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b1c:	89 0a                	mov    %ecx,(%rdx)
+  800b1e:	eb 14                	jmp    800b34 <getint+0x10d>
+  800b20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b24:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b28:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b2c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b30:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b34:	8b 00                	mov    (%rax),%eax
+  800b36:	48 98                	cltq
+  800b38:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b40:	c9                   	leave
+  800b41:	c3                   	ret
+
+0000000000800b42 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800b42:	55                   	push   %rbp
+  800b43:	48 89 e5             	mov    %rsp,%rbp
+  800b46:	41 57                	push   %r15
+  800b48:	41 55                	push   %r13
+  800b4a:	41 54                	push   %r12
+  800b4c:	53                   	push   %rbx
+  800b4d:	48 83 ec 60          	sub    $0x60,%rsp
+  800b51:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800b51 <vprintfmt+0xf>
+  800b58:	49 bb df 84 00 00 00 	movabs $0x84df,%r11
+  800b5f:	00 00 00 
+  800b62:	4d 01 dc             	add    %r11,%r12
+  800b65:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800b69:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800b6d:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b71:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800b75:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800b7c:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800b80:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800b84:	48 8b 06             	mov    (%rsi),%rax
+  800b87:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800b8b:	48 89 01             	mov    %rax,(%rcx)
+  800b8e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800b92:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800b96:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800b9a:	eb 17                	jmp    800bb3 <vprintfmt+0x71>
+			if (ch == '\0')
+  800b9c:	85 db                	test   %ebx,%ebx
+  800b9e:	0f 84 97 05 00 00    	je     80113b <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800ba4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ba8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800bac:	48 89 c6             	mov    %rax,%rsi
+  800baf:	89 df                	mov    %ebx,%edi
+  800bb1:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800bb3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800bb7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bbb:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800bbf:	0f b6 00             	movzbl (%rax),%eax
+  800bc2:	0f b6 d8             	movzbl %al,%ebx
+  800bc5:	83 fb 25             	cmp    $0x25,%ebx
+  800bc8:	75 d2                	jne    800b9c <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800bca:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800bce:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800bd5:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800bdc:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800be3:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800bea:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800bee:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bf2:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800bf6:	0f b6 00             	movzbl (%rax),%eax
+  800bf9:	0f b6 d8             	movzbl %al,%ebx
+  800bfc:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800bff:	83 f8 55             	cmp    $0x55,%eax
+  800c02:	0f 87 00 05 00 00    	ja     801108 <vprintfmt+0x5c6>
+  800c08:	89 c0                	mov    %eax,%eax
+  800c0a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c11:	00 
+  800c12:	48 8d 05 ef 5d 00 00 	lea    0x5def(%rip),%rax        # 806a08 <.LC18+0xc>
+  800c19:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800c1d:	48 8d 15 e4 5d 00 00 	lea    0x5de4(%rip),%rdx        # 806a08 <.LC18+0xc>
+  800c24:	48 01 d0             	add    %rdx,%rax
+  800c27:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800c29:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800c2d:	eb bb                	jmp    800bea <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800c2f:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800c33:	eb b5                	jmp    800bea <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800c35:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c3c:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800c3f:	89 d0                	mov    %edx,%eax
+  800c41:	c1 e0 02             	shl    $0x2,%eax
+  800c44:	01 d0                	add    %edx,%eax
+  800c46:	01 c0                	add    %eax,%eax
+  800c48:	01 d8                	add    %ebx,%eax
+  800c4a:	83 e8 30             	sub    $0x30,%eax
+  800c4d:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800c50:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c54:	0f b6 00             	movzbl (%rax),%eax
+  800c57:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800c5a:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c5d:	7e 60                	jle    800cbf <vprintfmt+0x17d>
+  800c5f:	83 fb 39             	cmp    $0x39,%ebx
+  800c62:	7f 5b                	jg     800cbf <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800c64:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c69:	eb d1                	jmp    800c3c <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800c6b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c6e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c71:	77 17                	ja     800c8a <vprintfmt+0x148>
+  800c73:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c77:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c7a:	89 d2                	mov    %edx,%edx
+  800c7c:	48 01 d0             	add    %rdx,%rax
+  800c7f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c82:	83 c2 08             	add    $0x8,%edx
+  800c85:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c88:	eb 0c                	jmp    800c96 <vprintfmt+0x154>
+  800c8a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c8e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c92:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c96:	8b 00                	mov    (%rax),%eax
+  800c98:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800c9b:	eb 23                	jmp    800cc0 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800c9d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ca1:	0f 89 43 ff ff ff    	jns    800bea <vprintfmt+0xa8>
+				width = 0;
+  800ca7:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800cae:	e9 37 ff ff ff       	jmp    800bea <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800cb3:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800cba:	e9 2b ff ff ff       	jmp    800bea <vprintfmt+0xa8>
+			goto process_precision;
+  800cbf:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800cc0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800cc4:	0f 89 20 ff ff ff    	jns    800bea <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800cca:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ccd:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800cd0:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800cd7:	e9 0e ff ff ff       	jmp    800bea <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800cdc:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800ce0:	e9 05 ff ff ff       	jmp    800bea <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800ce5:	83 fb 39             	cmp    $0x39,%ebx
+  800ce8:	7f 0b                	jg     800cf5 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800cea:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800ced:	c1 e0 08             	shl    $0x8,%eax
+  800cf0:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800cf3:	eb 21                	jmp    800d16 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800cf5:	83 fb 60             	cmp    $0x60,%ebx
+  800cf8:	7e 10                	jle    800d0a <vprintfmt+0x1c8>
+  800cfa:	83 fb 66             	cmp    $0x66,%ebx
+  800cfd:	7f 0b                	jg     800d0a <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800cff:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800d02:	c1 e0 08             	shl    $0x8,%eax
+  800d05:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d08:	eb 0c                	jmp    800d16 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800d0a:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800d11:	e9 04 01 00 00       	jmp    800e1a <vprintfmt+0x2d8>
+  800d16:	e9 ff 00 00 00       	jmp    800e1a <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800d1b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d21:	77 17                	ja     800d3a <vprintfmt+0x1f8>
+  800d23:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d27:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d2a:	89 d2                	mov    %edx,%edx
+  800d2c:	48 01 d0             	add    %rdx,%rax
+  800d2f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d32:	83 c2 08             	add    $0x8,%edx
+  800d35:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d38:	eb 0c                	jmp    800d46 <vprintfmt+0x204>
+  800d3a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d3e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d42:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d46:	8b 00                	mov    (%rax),%eax
+  800d48:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800d4c:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800d50:	48 89 d6             	mov    %rdx,%rsi
+  800d53:	89 c7                	mov    %eax,%edi
+  800d55:	ff d1                	call   *%rcx
+			break;
+  800d57:	e9 da 03 00 00       	jmp    801136 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800d5c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d62:	77 17                	ja     800d7b <vprintfmt+0x239>
+  800d64:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d68:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d6b:	89 d2                	mov    %edx,%edx
+  800d6d:	48 01 d0             	add    %rdx,%rax
+  800d70:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d73:	83 c2 08             	add    $0x8,%edx
+  800d76:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d79:	eb 0c                	jmp    800d87 <vprintfmt+0x245>
+  800d7b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d7f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d83:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d87:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800d89:	85 db                	test   %ebx,%ebx
+  800d8b:	79 02                	jns    800d8f <vprintfmt+0x24d>
+				err = -err;
+  800d8d:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d8f:	83 fb 15             	cmp    $0x15,%ebx
+  800d92:	7f 19                	jg     800dad <vprintfmt+0x26b>
+  800d94:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800d9b:	00 00 00 
+  800d9e:	48 63 c3             	movslq %ebx,%rax
+  800da1:	4c 01 e2             	add    %r12,%rdx
+  800da4:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800da8:	4d 85 ed             	test   %r13,%r13
+  800dab:	75 36                	jne    800de3 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800dad:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800db1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800db5:	89 d9                	mov    %ebx,%ecx
+  800db7:	48 ba c0 d9 ff ff ff 	movabs $0xffffffffffffd9c0,%rdx
+  800dbe:	ff ff ff 
+  800dc1:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800dc5:	48 89 c7             	mov    %rax,%rdi
+  800dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dcd:	49 b8 19 81 ff ff ff 	movabs $0xffffffffffff8119,%r8
+  800dd4:	ff ff ff 
+  800dd7:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800ddb:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800dde:	e9 53 03 00 00       	jmp    801136 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800de3:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800de7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800deb:	4c 89 e9             	mov    %r13,%rcx
+  800dee:	48 ba c9 d9 ff ff ff 	movabs $0xffffffffffffd9c9,%rdx
+  800df5:	ff ff ff 
+  800df8:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800dfc:	48 89 c7             	mov    %rax,%rdi
+  800dff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e04:	49 b8 19 81 ff ff ff 	movabs $0xffffffffffff8119,%r8
+  800e0b:	ff ff ff 
+  800e0e:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e12:	41 ff d0             	call   *%r8
+			break;
+  800e15:	e9 1c 03 00 00       	jmp    801136 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800e1a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e20:	77 17                	ja     800e39 <vprintfmt+0x2f7>
+  800e22:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e26:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e29:	89 d2                	mov    %edx,%edx
+  800e2b:	48 01 d0             	add    %rdx,%rax
+  800e2e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e31:	83 c2 08             	add    $0x8,%edx
+  800e34:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e37:	eb 0c                	jmp    800e45 <vprintfmt+0x303>
+  800e39:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e3d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e41:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e45:	4c 8b 28             	mov    (%rax),%r13
+  800e48:	4d 85 ed             	test   %r13,%r13
+  800e4b:	75 0e                	jne    800e5b <vprintfmt+0x319>
+				p = "(null)";
+  800e4d:	48 b8 cc d9 ff ff ff 	movabs $0xffffffffffffd9cc,%rax
+  800e54:	ff ff ff 
+  800e57:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800e5b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e5f:	0f 8e 84 00 00 00    	jle    800ee9 <vprintfmt+0x3a7>
+  800e65:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800e69:	74 7e                	je     800ee9 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e6b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800e6e:	48 98                	cltq
+  800e70:	48 89 c6             	mov    %rax,%rsi
+  800e73:	4c 89 ef             	mov    %r13,%rdi
+  800e76:	4d 89 e7             	mov    %r12,%r15
+  800e79:	48 b8 3e 84 ff ff ff 	movabs $0xffffffffffff843e,%rax
+  800e80:	ff ff ff 
+  800e83:	4c 01 e0             	add    %r12,%rax
+  800e86:	ff d0                	call   *%rax
+  800e88:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800e8b:	eb 17                	jmp    800ea4 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800e8d:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800e91:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800e95:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800e99:	48 89 d6             	mov    %rdx,%rsi
+  800e9c:	89 c7                	mov    %eax,%edi
+  800e9e:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ea0:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ea4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ea8:	7f e3                	jg     800e8d <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800eaa:	eb 3d                	jmp    800ee9 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800eac:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800eb0:	74 1e                	je     800ed0 <vprintfmt+0x38e>
+  800eb2:	83 fb 1f             	cmp    $0x1f,%ebx
+  800eb5:	7e 05                	jle    800ebc <vprintfmt+0x37a>
+  800eb7:	83 fb 7e             	cmp    $0x7e,%ebx
+  800eba:	7e 14                	jle    800ed0 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800ebc:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ec0:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ec4:	48 89 c6             	mov    %rax,%rsi
+  800ec7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ecc:	ff d2                	call   *%rdx
+  800ece:	eb 15                	jmp    800ee5 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800ed0:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800ed3:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800ed6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800eda:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ede:	48 89 c6             	mov    %rax,%rsi
+  800ee1:	89 cf                	mov    %ecx,%edi
+  800ee3:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ee5:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ee9:	4c 89 e8             	mov    %r13,%rax
+  800eec:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800ef0:	0f b6 00             	movzbl (%rax),%eax
+  800ef3:	0f be d8             	movsbl %al,%ebx
+  800ef6:	85 db                	test   %ebx,%ebx
+  800ef8:	74 28                	je     800f22 <vprintfmt+0x3e0>
+  800efa:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800efe:	78 ac                	js     800eac <vprintfmt+0x36a>
+  800f00:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800f04:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f08:	79 a2                	jns    800eac <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800f0a:	eb 16                	jmp    800f22 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800f0c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f10:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f14:	48 89 c6             	mov    %rax,%rsi
+  800f17:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f1c:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800f1e:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f22:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f26:	7f e4                	jg     800f0c <vprintfmt+0x3ca>
+			break;
+  800f28:	e9 09 02 00 00       	jmp    801136 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800f2d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f31:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f35:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f39:	0f b6 00             	movzbl (%rax),%eax
+  800f3c:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800f3f:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800f40:	83 fb 2f             	cmp    $0x2f,%ebx
+  800f43:	0f 8e ac fd ff ff    	jle    800cf5 <vprintfmt+0x1b3>
+  800f49:	e9 97 fd ff ff       	jmp    800ce5 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800f4e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f52:	be 03 00 00 00       	mov    $0x3,%esi
+  800f57:	48 89 c7             	mov    %rax,%rdi
+  800f5a:	48 b8 f7 79 ff ff ff 	movabs $0xffffffffffff79f7,%rax
+  800f61:	ff ff ff 
+  800f64:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f68:	ff d0                	call   *%rax
+  800f6a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800f6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f72:	48 85 c0             	test   %rax,%rax
+  800f75:	79 1d                	jns    800f94 <vprintfmt+0x452>
+				putch('-', putdat);
+  800f77:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f7b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f7f:	48 89 c6             	mov    %rax,%rsi
+  800f82:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800f87:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800f89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f8d:	48 f7 d8             	neg    %rax
+  800f90:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800f94:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800f9b:	e9 de 00 00 00       	jmp    80107e <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800fa0:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fa4:	be 03 00 00 00       	mov    $0x3,%esi
+  800fa9:	48 89 c7             	mov    %rax,%rdi
+  800fac:	48 b8 96 78 ff ff ff 	movabs $0xffffffffffff7896,%rax
+  800fb3:	ff ff ff 
+  800fb6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fba:	ff d0                	call   *%rax
+  800fbc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800fc0:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800fc7:	e9 b2 00 00 00       	jmp    80107e <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800fcc:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fd0:	be 03 00 00 00       	mov    $0x3,%esi
+  800fd5:	48 89 c7             	mov    %rax,%rdi
+  800fd8:	48 b8 96 78 ff ff ff 	movabs $0xffffffffffff7896,%rax
+  800fdf:	ff ff ff 
+  800fe2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fe6:	ff d0                	call   *%rax
+  800fe8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800fec:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800ff3:	e9 86 00 00 00       	jmp    80107e <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800ff8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ffc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801000:	48 89 c6             	mov    %rax,%rsi
+  801003:	bf 30 00 00 00       	mov    $0x30,%edi
+  801008:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80100a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80100e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801012:	48 89 c6             	mov    %rax,%rsi
+  801015:	bf 78 00 00 00       	mov    $0x78,%edi
+  80101a:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80101c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80101f:	83 f8 2f             	cmp    $0x2f,%eax
+  801022:	77 17                	ja     80103b <vprintfmt+0x4f9>
+  801024:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801028:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80102b:	89 d2                	mov    %edx,%edx
+  80102d:	48 01 d0             	add    %rdx,%rax
+  801030:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801033:	83 c2 08             	add    $0x8,%edx
+  801036:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801039:	eb 0c                	jmp    801047 <vprintfmt+0x505>
+  80103b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80103f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801043:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801047:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80104a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80104e:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801055:	eb 27                	jmp    80107e <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801057:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80105b:	be 03 00 00 00       	mov    $0x3,%esi
+  801060:	48 89 c7             	mov    %rax,%rdi
+  801063:	48 b8 96 78 ff ff ff 	movabs $0xffffffffffff7896,%rax
+  80106a:	ff ff ff 
+  80106d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801071:	ff d0                	call   *%rax
+  801073:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801077:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  80107e:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801083:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801086:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801089:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80108d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801091:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801095:	45 89 c1             	mov    %r8d,%r9d
+  801098:	41 89 f8             	mov    %edi,%r8d
+  80109b:	48 89 c7             	mov    %rax,%rdi
+  80109e:	48 b8 be 77 ff ff ff 	movabs $0xffffffffffff77be,%rax
+  8010a5:	ff ff ff 
+  8010a8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010ac:	ff d0                	call   *%rax
+			break;
+  8010ae:	e9 83 00 00 00       	jmp    801136 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8010b3:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010b7:	be 03 00 00 00       	mov    $0x3,%esi
+  8010bc:	48 89 c7             	mov    %rax,%rdi
+  8010bf:	48 b8 96 78 ff ff ff 	movabs $0xffffffffffff7896,%rax
+  8010c6:	ff ff ff 
+  8010c9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010cd:	ff d0                	call   *%rax
+  8010cf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8010d3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010d7:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8010db:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010df:	48 89 ce             	mov    %rcx,%rsi
+  8010e2:	48 89 c7             	mov    %rax,%rdi
+  8010e5:	48 b8 b1 79 ff ff ff 	movabs $0xffffffffffff79b1,%rax
+  8010ec:	ff ff ff 
+  8010ef:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010f3:	ff d0                	call   *%rax
+	
+			break;
+  8010f5:	eb 3f                	jmp    801136 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8010f7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010fb:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010ff:	48 89 c6             	mov    %rax,%rsi
+  801102:	89 df                	mov    %ebx,%edi
+  801104:	ff d2                	call   *%rdx
+			break;
+  801106:	eb 2e                	jmp    801136 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801108:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80110c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801110:	48 89 c6             	mov    %rax,%rsi
+  801113:	bf 25 00 00 00       	mov    $0x25,%edi
+  801118:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80111a:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80111f:	eb 05                	jmp    801126 <vprintfmt+0x5e4>
+  801121:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801126:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80112a:	48 83 e8 01          	sub    $0x1,%rax
+  80112e:	0f b6 00             	movzbl (%rax),%eax
+  801131:	3c 25                	cmp    $0x25,%al
+  801133:	75 ec                	jne    801121 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801135:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801136:	e9 78 fa ff ff       	jmp    800bb3 <vprintfmt+0x71>
+				return;
+  80113b:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80113c:	48 83 c4 60          	add    $0x60,%rsp
+  801140:	5b                   	pop    %rbx
+  801141:	41 5c                	pop    %r12
+  801143:	41 5d                	pop    %r13
+  801145:	41 5f                	pop    %r15
+  801147:	5d                   	pop    %rbp
+  801148:	c3                   	ret
+
+0000000000801149 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801149:	55                   	push   %rbp
+  80114a:	48 89 e5             	mov    %rsp,%rbp
+  80114d:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801154:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801154 <printfmt+0xb>
+  80115b:	49 bb dc 7e 00 00 00 	movabs $0x7edc,%r11
+  801162:	00 00 00 
+  801165:	4d 01 da             	add    %r11,%r10
+  801168:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80116f:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801176:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80117d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801184:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80118b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801192:	84 c0                	test   %al,%al
+  801194:	74 20                	je     8011b6 <printfmt+0x6d>
+  801196:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80119a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80119e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8011a2:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8011a6:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8011aa:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8011ae:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8011b2:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8011b6:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8011bd:	00 00 00 
+  8011c0:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8011c7:	00 00 00 
+  8011ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011ce:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8011d5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8011dc:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8011e3:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8011ea:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8011f1:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8011f8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8011ff:	48 89 c7             	mov    %rax,%rdi
+  801202:	48 b8 12 7b ff ff ff 	movabs $0xffffffffffff7b12,%rax
+  801209:	ff ff ff 
+  80120c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801210:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801212:	90                   	nop
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+
+0000000000801215 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801215:	55                   	push   %rbp
+  801216:	48 89 e5             	mov    %rsp,%rbp
+  801219:	48 83 ec 10          	sub    $0x10,%rsp
+  80121d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80121d <sprintputch+0x8>
+  801224:	49 bb 13 7e 00 00 00 	movabs $0x7e13,%r11
+  80122b:	00 00 00 
+  80122e:	4c 01 d8             	add    %r11,%rax
+  801231:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801234:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801238:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80123c:	8b 40 10             	mov    0x10(%rax),%eax
+  80123f:	8d 50 01             	lea    0x1(%rax),%edx
+  801242:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801246:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801249:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80124d:	48 8b 10             	mov    (%rax),%rdx
+  801250:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801254:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801258:	48 39 c2             	cmp    %rax,%rdx
+  80125b:	73 17                	jae    801274 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80125d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801261:	48 8b 00             	mov    (%rax),%rax
+  801264:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801268:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80126c:	48 89 0a             	mov    %rcx,(%rdx)
+  80126f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801272:	88 10                	mov    %dl,(%rax)
+}
+  801274:	90                   	nop
+  801275:	c9                   	leave
+  801276:	c3                   	ret
+
+0000000000801277 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801277:	55                   	push   %rbp
+  801278:	48 89 e5             	mov    %rsp,%rbp
+  80127b:	53                   	push   %rbx
+  80127c:	48 83 ec 58          	sub    $0x58,%rsp
+  801280:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801280 <vsnprintf+0x9>
+  801287:	49 bb b0 7d 00 00 00 	movabs $0x7db0,%r11
+  80128e:	00 00 00 
+  801291:	4c 01 d8             	add    %r11,%rax
+  801294:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801298:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80129b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80129f:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8012a3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8012a7:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8012ab:	48 8b 0e             	mov    (%rsi),%rcx
+  8012ae:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8012b2:	48 89 0a             	mov    %rcx,(%rdx)
+  8012b5:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8012b9:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8012bd:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8012c1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8012c5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8012c9:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8012cc:	48 63 d2             	movslq %edx,%rdx
+  8012cf:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8012d3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8012d7:	48 01 ca             	add    %rcx,%rdx
+  8012da:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8012de:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8012e5:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8012ea:	74 06                	je     8012f2 <vsnprintf+0x7b>
+  8012ec:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8012f0:	7f 07                	jg     8012f9 <vsnprintf+0x82>
+		return -E_INVAL;
+  8012f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f7:	eb 34                	jmp    80132d <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8012f9:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8012fd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801301:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801305:	48 bf e5 81 ff ff ff 	movabs $0xffffffffffff81e5,%rdi
+  80130c:	ff ff ff 
+  80130f:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801313:	49 b8 12 7b ff ff ff 	movabs $0xffffffffffff7b12,%r8
+  80131a:	ff ff ff 
+  80131d:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801321:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801323:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801327:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80132a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80132d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801331:	c9                   	leave
+  801332:	c3                   	ret
+
+0000000000801333 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801333:	55                   	push   %rbp
+  801334:	48 89 e5             	mov    %rsp,%rbp
+  801337:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80133e:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80133e <snprintf+0xb>
+  801345:	49 bb f2 7c 00 00 00 	movabs $0x7cf2,%r11
+  80134c:	00 00 00 
+  80134f:	4d 01 da             	add    %r11,%r10
+  801352:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801359:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80135f:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801366:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80136d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801374:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80137b:	84 c0                	test   %al,%al
+  80137d:	74 20                	je     80139f <snprintf+0x6c>
+  80137f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801383:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801387:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80138b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80138f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801393:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801397:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80139b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80139f:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8013a6:	00 00 00 
+  8013a9:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8013b0:	00 00 00 
+  8013b3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8013b7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8013be:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8013c5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8013cc:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8013d3:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8013da:	48 8b 06             	mov    (%rsi),%rax
+  8013dd:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013e1:	48 89 01             	mov    %rax,(%rcx)
+  8013e4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8013e8:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8013ec:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8013f0:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8013f7:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8013fe:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801404:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80140b:	48 89 c7             	mov    %rax,%rdi
+  80140e:	48 b8 47 82 ff ff ff 	movabs $0xffffffffffff8247,%rax
+  801415:	ff ff ff 
+  801418:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80141c:	ff d0                	call   *%rax
+  80141e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801424:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80142a:	c9                   	leave
+  80142b:	c3                   	ret
+
+000000000080142c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80142c:	55                   	push   %rbp
+  80142d:	48 89 e5             	mov    %rsp,%rbp
+  801430:	48 83 ec 18          	sub    $0x18,%rsp
+  801434:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801434 <strlen+0x8>
+  80143b:	49 bb fc 7b 00 00 00 	movabs $0x7bfc,%r11
+  801442:	00 00 00 
+  801445:	4c 01 d8             	add    %r11,%rax
+  801448:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80144c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801453:	eb 09                	jmp    80145e <strlen+0x32>
+		n++;
+  801455:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801459:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80145e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801462:	0f b6 00             	movzbl (%rax),%eax
+  801465:	84 c0                	test   %al,%al
+  801467:	75 ec                	jne    801455 <strlen+0x29>
+	return n;
+  801469:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80146c:	c9                   	leave
+  80146d:	c3                   	ret
+
+000000000080146e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80146e:	55                   	push   %rbp
+  80146f:	48 89 e5             	mov    %rsp,%rbp
+  801472:	48 83 ec 20          	sub    $0x20,%rsp
+  801476:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801476 <strnlen+0x8>
+  80147d:	49 bb ba 7b 00 00 00 	movabs $0x7bba,%r11
+  801484:	00 00 00 
+  801487:	4c 01 d8             	add    %r11,%rax
+  80148a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80148e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801492:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801499:	eb 0e                	jmp    8014a9 <strnlen+0x3b>
+		n++;
+  80149b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80149f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014a4:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8014a9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8014ae:	74 0b                	je     8014bb <strnlen+0x4d>
+  8014b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b4:	0f b6 00             	movzbl (%rax),%eax
+  8014b7:	84 c0                	test   %al,%al
+  8014b9:	75 e0                	jne    80149b <strnlen+0x2d>
+	return n;
+  8014bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+
+00000000008014c0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8014c0:	55                   	push   %rbp
+  8014c1:	48 89 e5             	mov    %rsp,%rbp
+  8014c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8014c8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014c8 <strcpy+0x8>
+  8014cf:	49 bb 68 7b 00 00 00 	movabs $0x7b68,%r11
+  8014d6:	00 00 00 
+  8014d9:	4c 01 d8             	add    %r11,%rax
+  8014dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8014e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8014ec:	90                   	nop
+  8014ed:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014f1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014f5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014fd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801501:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801505:	0f b6 12             	movzbl (%rdx),%edx
+  801508:	88 10                	mov    %dl,(%rax)
+  80150a:	0f b6 00             	movzbl (%rax),%eax
+  80150d:	84 c0                	test   %al,%al
+  80150f:	75 dc                	jne    8014ed <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801511:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801515:	c9                   	leave
+  801516:	c3                   	ret
+
+0000000000801517 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801517:	55                   	push   %rbp
+  801518:	48 89 e5             	mov    %rsp,%rbp
+  80151b:	53                   	push   %rbx
+  80151c:	48 83 ec 20          	sub    $0x20,%rsp
+  801520:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801520 <strcat+0x9>
+  801527:	49 bb 10 7b 00 00 00 	movabs $0x7b10,%r11
+  80152e:	00 00 00 
+  801531:	4c 01 db             	add    %r11,%rbx
+  801534:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801538:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80153c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801540:	48 89 c7             	mov    %rax,%rdi
+  801543:	48 b8 fc 83 ff ff ff 	movabs $0xffffffffffff83fc,%rax
+  80154a:	ff ff ff 
+  80154d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801551:	ff d0                	call   *%rax
+  801553:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801556:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801559:	48 63 d0             	movslq %eax,%rdx
+  80155c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801560:	48 01 c2             	add    %rax,%rdx
+  801563:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801567:	48 89 c6             	mov    %rax,%rsi
+  80156a:	48 89 d7             	mov    %rdx,%rdi
+  80156d:	48 b8 90 84 ff ff ff 	movabs $0xffffffffffff8490,%rax
+  801574:	ff ff ff 
+  801577:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80157b:	ff d0                	call   *%rax
+	return dst;
+  80157d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801581:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801585:	c9                   	leave
+  801586:	c3                   	ret
+
+0000000000801587 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801587:	55                   	push   %rbp
+  801588:	48 89 e5             	mov    %rsp,%rbp
+  80158b:	48 83 ec 28          	sub    $0x28,%rsp
+  80158f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80158f <strncpy+0x8>
+  801596:	49 bb a1 7a 00 00 00 	movabs $0x7aa1,%r11
+  80159d:	00 00 00 
+  8015a0:	4c 01 d8             	add    %r11,%rax
+  8015a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015a7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015ab:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8015af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8015b7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8015be:	00 
+  8015bf:	eb 2a                	jmp    8015eb <strncpy+0x64>
+		*dst++ = *src;
+  8015c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015c5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015c9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8015cd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015d1:	0f b6 12             	movzbl (%rdx),%edx
+  8015d4:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8015d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015da:	0f b6 00             	movzbl (%rax),%eax
+  8015dd:	84 c0                	test   %al,%al
+  8015df:	74 05                	je     8015e6 <strncpy+0x5f>
+			src++;
+  8015e1:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8015e6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ef:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8015f3:	72 cc                	jb     8015c1 <strncpy+0x3a>
+	}
+	return ret;
+  8015f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+
+00000000008015fb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8015fb:	55                   	push   %rbp
+  8015fc:	48 89 e5             	mov    %rsp,%rbp
+  8015ff:	48 83 ec 28          	sub    $0x28,%rsp
+  801603:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801603 <strlcpy+0x8>
+  80160a:	49 bb 2d 7a 00 00 00 	movabs $0x7a2d,%r11
+  801611:	00 00 00 
+  801614:	4c 01 d8             	add    %r11,%rax
+  801617:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80161b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80161f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801623:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801627:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80162b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801630:	74 3d                	je     80166f <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801632:	eb 1d                	jmp    801651 <strlcpy+0x56>
+			*dst++ = *src++;
+  801634:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801638:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80163c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801640:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801644:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801648:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80164c:	0f b6 12             	movzbl (%rdx),%edx
+  80164f:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801651:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801656:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80165b:	74 0b                	je     801668 <strlcpy+0x6d>
+  80165d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801661:	0f b6 00             	movzbl (%rax),%eax
+  801664:	84 c0                	test   %al,%al
+  801666:	75 cc                	jne    801634 <strlcpy+0x39>
+		*dst = '\0';
+  801668:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80166c:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80166f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801673:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801677:	c9                   	leave
+  801678:	c3                   	ret
+
+0000000000801679 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801679:	55                   	push   %rbp
+  80167a:	48 89 e5             	mov    %rsp,%rbp
+  80167d:	48 83 ec 10          	sub    $0x10,%rsp
+  801681:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801681 <strcmp+0x8>
+  801688:	49 bb af 79 00 00 00 	movabs $0x79af,%r11
+  80168f:	00 00 00 
+  801692:	4c 01 d8             	add    %r11,%rax
+  801695:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801699:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  80169d:	eb 0a                	jmp    8016a9 <strcmp+0x30>
+		p++, q++;
+  80169f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016a4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8016a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ad:	0f b6 00             	movzbl (%rax),%eax
+  8016b0:	84 c0                	test   %al,%al
+  8016b2:	74 12                	je     8016c6 <strcmp+0x4d>
+  8016b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b8:	0f b6 10             	movzbl (%rax),%edx
+  8016bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016bf:	0f b6 00             	movzbl (%rax),%eax
+  8016c2:	38 c2                	cmp    %al,%dl
+  8016c4:	74 d9                	je     80169f <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8016c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ca:	0f b6 00             	movzbl (%rax),%eax
+  8016cd:	0f b6 d0             	movzbl %al,%edx
+  8016d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016d4:	0f b6 00             	movzbl (%rax),%eax
+  8016d7:	0f b6 c0             	movzbl %al,%eax
+  8016da:	29 c2                	sub    %eax,%edx
+  8016dc:	89 d0                	mov    %edx,%eax
+}
+  8016de:	c9                   	leave
+  8016df:	c3                   	ret
+
+00000000008016e0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8016e0:	55                   	push   %rbp
+  8016e1:	48 89 e5             	mov    %rsp,%rbp
+  8016e4:	48 83 ec 18          	sub    $0x18,%rsp
+  8016e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016e8 <strncmp+0x8>
+  8016ef:	49 bb 48 79 00 00 00 	movabs $0x7948,%r11
+  8016f6:	00 00 00 
+  8016f9:	4c 01 d8             	add    %r11,%rax
+  8016fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801700:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801704:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801708:	eb 0f                	jmp    801719 <strncmp+0x39>
+		n--, p++, q++;
+  80170a:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80170f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801714:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801719:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80171e:	74 1d                	je     80173d <strncmp+0x5d>
+  801720:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801724:	0f b6 00             	movzbl (%rax),%eax
+  801727:	84 c0                	test   %al,%al
+  801729:	74 12                	je     80173d <strncmp+0x5d>
+  80172b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172f:	0f b6 10             	movzbl (%rax),%edx
+  801732:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801736:	0f b6 00             	movzbl (%rax),%eax
+  801739:	38 c2                	cmp    %al,%dl
+  80173b:	74 cd                	je     80170a <strncmp+0x2a>
+	if (n == 0)
+  80173d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801742:	75 07                	jne    80174b <strncmp+0x6b>
+		return 0;
+  801744:	ba 00 00 00 00       	mov    $0x0,%edx
+  801749:	eb 16                	jmp    801761 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80174b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80174f:	0f b6 00             	movzbl (%rax),%eax
+  801752:	0f b6 d0             	movzbl %al,%edx
+  801755:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801759:	0f b6 00             	movzbl (%rax),%eax
+  80175c:	0f b6 c0             	movzbl %al,%eax
+  80175f:	29 c2                	sub    %eax,%edx
+}
+  801761:	89 d0                	mov    %edx,%eax
+  801763:	c9                   	leave
+  801764:	c3                   	ret
+
+0000000000801765 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801765:	55                   	push   %rbp
+  801766:	48 89 e5             	mov    %rsp,%rbp
+  801769:	48 83 ec 10          	sub    $0x10,%rsp
+  80176d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80176d <strchr+0x8>
+  801774:	49 bb c3 78 00 00 00 	movabs $0x78c3,%r11
+  80177b:	00 00 00 
+  80177e:	4c 01 d8             	add    %r11,%rax
+  801781:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801785:	89 f0                	mov    %esi,%eax
+  801787:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80178a:	eb 17                	jmp    8017a3 <strchr+0x3e>
+		if (*s == c)
+  80178c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801790:	0f b6 00             	movzbl (%rax),%eax
+  801793:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801796:	75 06                	jne    80179e <strchr+0x39>
+			return (char *) s;
+  801798:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179c:	eb 15                	jmp    8017b3 <strchr+0x4e>
+	for (; *s; s++)
+  80179e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017a7:	0f b6 00             	movzbl (%rax),%eax
+  8017aa:	84 c0                	test   %al,%al
+  8017ac:	75 de                	jne    80178c <strchr+0x27>
+	return 0;
+  8017ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017b3:	c9                   	leave
+  8017b4:	c3                   	ret
+
+00000000008017b5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8017b5:	55                   	push   %rbp
+  8017b6:	48 89 e5             	mov    %rsp,%rbp
+  8017b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8017bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017bd <strfind+0x8>
+  8017c4:	49 bb 73 78 00 00 00 	movabs $0x7873,%r11
+  8017cb:	00 00 00 
+  8017ce:	4c 01 d8             	add    %r11,%rax
+  8017d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017d5:	89 f0                	mov    %esi,%eax
+  8017d7:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8017da:	eb 11                	jmp    8017ed <strfind+0x38>
+		if (*s == c)
+  8017dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017e0:	0f b6 00             	movzbl (%rax),%eax
+  8017e3:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8017e6:	74 12                	je     8017fa <strfind+0x45>
+	for (; *s; s++)
+  8017e8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f1:	0f b6 00             	movzbl (%rax),%eax
+  8017f4:	84 c0                	test   %al,%al
+  8017f6:	75 e4                	jne    8017dc <strfind+0x27>
+  8017f8:	eb 01                	jmp    8017fb <strfind+0x46>
+			break;
+  8017fa:	90                   	nop
+	return (char *) s;
+  8017fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017ff:	c9                   	leave
+  801800:	c3                   	ret
+
+0000000000801801 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801801:	55                   	push   %rbp
+  801802:	48 89 e5             	mov    %rsp,%rbp
+  801805:	48 83 ec 18          	sub    $0x18,%rsp
+  801809:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801809 <memset+0x8>
+  801810:	49 bb 27 78 00 00 00 	movabs $0x7827,%r11
+  801817:	00 00 00 
+  80181a:	4c 01 d8             	add    %r11,%rax
+  80181d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801821:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801824:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801828:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80182d:	75 06                	jne    801835 <memset+0x34>
+		return v;
+  80182f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801833:	eb 69                	jmp    80189e <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801835:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801839:	83 e0 03             	and    $0x3,%eax
+  80183c:	48 85 c0             	test   %rax,%rax
+  80183f:	75 48                	jne    801889 <memset+0x88>
+  801841:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801845:	83 e0 03             	and    $0x3,%eax
+  801848:	48 85 c0             	test   %rax,%rax
+  80184b:	75 3c                	jne    801889 <memset+0x88>
+		c &= 0xFF;
+  80184d:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801854:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801857:	c1 e0 18             	shl    $0x18,%eax
+  80185a:	89 c2                	mov    %eax,%edx
+  80185c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80185f:	c1 e0 10             	shl    $0x10,%eax
+  801862:	09 c2                	or     %eax,%edx
+  801864:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801867:	c1 e0 08             	shl    $0x8,%eax
+  80186a:	09 d0                	or     %edx,%eax
+  80186c:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  80186f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801873:	48 c1 e8 02          	shr    $0x2,%rax
+  801877:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  80187a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80187e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801881:	48 89 d7             	mov    %rdx,%rdi
+  801884:	fc                   	cld
+  801885:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801887:	eb 11                	jmp    80189a <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801889:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80188d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801890:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801894:	48 89 d7             	mov    %rdx,%rdi
+  801897:	fc                   	cld
+  801898:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  80189a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80189e:	c9                   	leave
+  80189f:	c3                   	ret
+
+00000000008018a0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8018a0:	55                   	push   %rbp
+  8018a1:	48 89 e5             	mov    %rsp,%rbp
+  8018a4:	48 83 ec 28          	sub    $0x28,%rsp
+  8018a8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018a8 <memmove+0x8>
+  8018af:	49 bb 88 77 00 00 00 	movabs $0x7788,%r11
+  8018b6:	00 00 00 
+  8018b9:	4c 01 d8             	add    %r11,%rax
+  8018bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018c4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8018c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8018d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018d4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8018d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018dc:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8018e0:	0f 83 88 00 00 00    	jae    80196e <memmove+0xce>
+  8018e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ee:	48 01 d0             	add    %rdx,%rax
+  8018f1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8018f5:	73 77                	jae    80196e <memmove+0xce>
+		s += n;
+  8018f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018fb:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8018ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801903:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801907:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80190b:	83 e0 03             	and    $0x3,%eax
+  80190e:	48 85 c0             	test   %rax,%rax
+  801911:	75 3b                	jne    80194e <memmove+0xae>
+  801913:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801917:	83 e0 03             	and    $0x3,%eax
+  80191a:	48 85 c0             	test   %rax,%rax
+  80191d:	75 2f                	jne    80194e <memmove+0xae>
+  80191f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801923:	83 e0 03             	and    $0x3,%eax
+  801926:	48 85 c0             	test   %rax,%rax
+  801929:	75 23                	jne    80194e <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80192b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80192f:	48 83 e8 04          	sub    $0x4,%rax
+  801933:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801937:	48 83 ea 04          	sub    $0x4,%rdx
+  80193b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80193f:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801943:	48 89 c7             	mov    %rax,%rdi
+  801946:	48 89 d6             	mov    %rdx,%rsi
+  801949:	fd                   	std
+  80194a:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80194c:	eb 1d                	jmp    80196b <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80194e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801952:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801956:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80195a:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  80195e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801962:	48 89 d7             	mov    %rdx,%rdi
+  801965:	48 89 c1             	mov    %rax,%rcx
+  801968:	fd                   	std
+  801969:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80196b:	fc                   	cld
+  80196c:	eb 57                	jmp    8019c5 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80196e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801972:	83 e0 03             	and    $0x3,%eax
+  801975:	48 85 c0             	test   %rax,%rax
+  801978:	75 36                	jne    8019b0 <memmove+0x110>
+  80197a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80197e:	83 e0 03             	and    $0x3,%eax
+  801981:	48 85 c0             	test   %rax,%rax
+  801984:	75 2a                	jne    8019b0 <memmove+0x110>
+  801986:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80198a:	83 e0 03             	and    $0x3,%eax
+  80198d:	48 85 c0             	test   %rax,%rax
+  801990:	75 1e                	jne    8019b0 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801992:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801996:	48 c1 e8 02          	shr    $0x2,%rax
+  80199a:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  80199d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019a5:	48 89 c7             	mov    %rax,%rdi
+  8019a8:	48 89 d6             	mov    %rdx,%rsi
+  8019ab:	fc                   	cld
+  8019ac:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8019ae:	eb 15                	jmp    8019c5 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8019b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019b8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8019bc:	48 89 c7             	mov    %rax,%rdi
+  8019bf:	48 89 d6             	mov    %rdx,%rsi
+  8019c2:	fc                   	cld
+  8019c3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8019c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019c9:	c9                   	leave
+  8019ca:	c3                   	ret
+
+00000000008019cb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8019cb:	55                   	push   %rbp
+  8019cc:	48 89 e5             	mov    %rsp,%rbp
+  8019cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8019d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019d3 <memcpy+0x8>
+  8019da:	49 bb 5d 76 00 00 00 	movabs $0x765d,%r11
+  8019e1:	00 00 00 
+  8019e4:	4c 01 d8             	add    %r11,%rax
+  8019e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019eb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8019ef:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8019f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019f7:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8019fb:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8019ff:	48 89 cf             	mov    %rcx,%rdi
+  801a02:	48 b9 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rcx
+  801a09:	ff ff ff 
+  801a0c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801a10:	ff d0                	call   *%rax
+}
+  801a12:	c9                   	leave
+  801a13:	c3                   	ret
+
+0000000000801a14 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801a14:	55                   	push   %rbp
+  801a15:	48 89 e5             	mov    %rsp,%rbp
+  801a18:	48 83 ec 28          	sub    $0x28,%rsp
+  801a1c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a1c <memcmp+0x8>
+  801a23:	49 bb 14 76 00 00 00 	movabs $0x7614,%r11
+  801a2a:	00 00 00 
+  801a2d:	4c 01 d8             	add    %r11,%rax
+  801a30:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a34:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a38:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801a3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a40:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801a44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a48:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801a4c:	eb 34                	jmp    801a82 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801a4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a52:	0f b6 10             	movzbl (%rax),%edx
+  801a55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a59:	0f b6 00             	movzbl (%rax),%eax
+  801a5c:	38 c2                	cmp    %al,%dl
+  801a5e:	74 18                	je     801a78 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801a60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a64:	0f b6 00             	movzbl (%rax),%eax
+  801a67:	0f b6 d0             	movzbl %al,%edx
+  801a6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a6e:	0f b6 00             	movzbl (%rax),%eax
+  801a71:	0f b6 c0             	movzbl %al,%eax
+  801a74:	29 c2                	sub    %eax,%edx
+  801a76:	eb 20                	jmp    801a98 <memcmp+0x84>
+		s1++, s2++;
+  801a78:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a7d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801a82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a86:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a8a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801a8e:	48 85 c0             	test   %rax,%rax
+  801a91:	75 bb                	jne    801a4e <memcmp+0x3a>
+	}
+
+	return 0;
+  801a93:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801a98:	89 d0                	mov    %edx,%eax
+  801a9a:	c9                   	leave
+  801a9b:	c3                   	ret
+
+0000000000801a9c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801a9c:	55                   	push   %rbp
+  801a9d:	48 89 e5             	mov    %rsp,%rbp
+  801aa0:	48 83 ec 28          	sub    $0x28,%rsp
+  801aa4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801aa4 <memfind+0x8>
+  801aab:	49 bb 8c 75 00 00 00 	movabs $0x758c,%r11
+  801ab2:	00 00 00 
+  801ab5:	4c 01 d8             	add    %r11,%rax
+  801ab8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801abc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801abf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801ac3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ac7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801acb:	48 01 d0             	add    %rdx,%rax
+  801ace:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801ad2:	eb 13                	jmp    801ae7 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801ad4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ad8:	0f b6 00             	movzbl (%rax),%eax
+  801adb:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801ade:	38 d0                	cmp    %dl,%al
+  801ae0:	74 11                	je     801af3 <memfind+0x57>
+	for (; s < ends; s++)
+  801ae2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ae7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aeb:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801aef:	72 e3                	jb     801ad4 <memfind+0x38>
+  801af1:	eb 01                	jmp    801af4 <memfind+0x58>
+			break;
+  801af3:	90                   	nop
+	return (void *) s;
+  801af4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801af8:	c9                   	leave
+  801af9:	c3                   	ret
+
+0000000000801afa <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801afa:	55                   	push   %rbp
+  801afb:	48 89 e5             	mov    %rsp,%rbp
+  801afe:	48 83 ec 38          	sub    $0x38,%rsp
+  801b02:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b02 <strtol+0x8>
+  801b09:	49 bb 2e 75 00 00 00 	movabs $0x752e,%r11
+  801b10:	00 00 00 
+  801b13:	4c 01 d8             	add    %r11,%rax
+  801b16:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b1a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b1e:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801b21:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b28:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b2f:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801b30:	eb 05                	jmp    801b37 <strtol+0x3d>
+		s++;
+  801b32:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801b37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b3b:	0f b6 00             	movzbl (%rax),%eax
+  801b3e:	3c 20                	cmp    $0x20,%al
+  801b40:	74 f0                	je     801b32 <strtol+0x38>
+  801b42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b46:	0f b6 00             	movzbl (%rax),%eax
+  801b49:	3c 09                	cmp    $0x9,%al
+  801b4b:	74 e5                	je     801b32 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801b4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b51:	0f b6 00             	movzbl (%rax),%eax
+  801b54:	3c 2b                	cmp    $0x2b,%al
+  801b56:	75 07                	jne    801b5f <strtol+0x65>
+		s++;
+  801b58:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b5d:	eb 17                	jmp    801b76 <strtol+0x7c>
+	else if (*s == '-')
+  801b5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b63:	0f b6 00             	movzbl (%rax),%eax
+  801b66:	3c 2d                	cmp    $0x2d,%al
+  801b68:	75 0c                	jne    801b76 <strtol+0x7c>
+		s++, neg = 1;
+  801b6a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b6f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801b76:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b7a:	74 06                	je     801b82 <strtol+0x88>
+  801b7c:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801b80:	75 28                	jne    801baa <strtol+0xb0>
+  801b82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b86:	0f b6 00             	movzbl (%rax),%eax
+  801b89:	3c 30                	cmp    $0x30,%al
+  801b8b:	75 1d                	jne    801baa <strtol+0xb0>
+  801b8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b91:	48 83 c0 01          	add    $0x1,%rax
+  801b95:	0f b6 00             	movzbl (%rax),%eax
+  801b98:	3c 78                	cmp    $0x78,%al
+  801b9a:	75 0e                	jne    801baa <strtol+0xb0>
+		s += 2, base = 16;
+  801b9c:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801ba1:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801ba8:	eb 2c                	jmp    801bd6 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801baa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bae:	75 19                	jne    801bc9 <strtol+0xcf>
+  801bb0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb4:	0f b6 00             	movzbl (%rax),%eax
+  801bb7:	3c 30                	cmp    $0x30,%al
+  801bb9:	75 0e                	jne    801bc9 <strtol+0xcf>
+		s++, base = 8;
+  801bbb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bc0:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801bc7:	eb 0d                	jmp    801bd6 <strtol+0xdc>
+	else if (base == 0)
+  801bc9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bcd:	75 07                	jne    801bd6 <strtol+0xdc>
+		base = 10;
+  801bcf:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801bd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bda:	0f b6 00             	movzbl (%rax),%eax
+  801bdd:	3c 2f                	cmp    $0x2f,%al
+  801bdf:	7e 1d                	jle    801bfe <strtol+0x104>
+  801be1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be5:	0f b6 00             	movzbl (%rax),%eax
+  801be8:	3c 39                	cmp    $0x39,%al
+  801bea:	7f 12                	jg     801bfe <strtol+0x104>
+			dig = *s - '0';
+  801bec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bf0:	0f b6 00             	movzbl (%rax),%eax
+  801bf3:	0f be c0             	movsbl %al,%eax
+  801bf6:	83 e8 30             	sub    $0x30,%eax
+  801bf9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801bfc:	eb 4e                	jmp    801c4c <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801bfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c02:	0f b6 00             	movzbl (%rax),%eax
+  801c05:	3c 60                	cmp    $0x60,%al
+  801c07:	7e 1d                	jle    801c26 <strtol+0x12c>
+  801c09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c0d:	0f b6 00             	movzbl (%rax),%eax
+  801c10:	3c 7a                	cmp    $0x7a,%al
+  801c12:	7f 12                	jg     801c26 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801c14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c18:	0f b6 00             	movzbl (%rax),%eax
+  801c1b:	0f be c0             	movsbl %al,%eax
+  801c1e:	83 e8 57             	sub    $0x57,%eax
+  801c21:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c24:	eb 26                	jmp    801c4c <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2a:	0f b6 00             	movzbl (%rax),%eax
+  801c2d:	3c 40                	cmp    $0x40,%al
+  801c2f:	7e 47                	jle    801c78 <strtol+0x17e>
+  801c31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c35:	0f b6 00             	movzbl (%rax),%eax
+  801c38:	3c 5a                	cmp    $0x5a,%al
+  801c3a:	7f 3c                	jg     801c78 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801c3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c40:	0f b6 00             	movzbl (%rax),%eax
+  801c43:	0f be c0             	movsbl %al,%eax
+  801c46:	83 e8 37             	sub    $0x37,%eax
+  801c49:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801c4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c4f:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801c52:	7d 23                	jge    801c77 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801c54:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c59:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801c5c:	48 98                	cltq
+  801c5e:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801c63:	48 89 c2             	mov    %rax,%rdx
+  801c66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c69:	48 98                	cltq
+  801c6b:	48 01 d0             	add    %rdx,%rax
+  801c6e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801c72:	e9 5f ff ff ff       	jmp    801bd6 <strtol+0xdc>
+			break;
+  801c77:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801c78:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801c7d:	74 0b                	je     801c8a <strtol+0x190>
+		*endptr = (char *) s;
+  801c7f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c83:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801c87:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801c8a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801c8e:	74 09                	je     801c99 <strtol+0x19f>
+  801c90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c94:	48 f7 d8             	neg    %rax
+  801c97:	eb 04                	jmp    801c9d <strtol+0x1a3>
+  801c99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801c9d:	c9                   	leave
+  801c9e:	c3                   	ret
+
+0000000000801c9f <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801c9f:	55                   	push   %rbp
+  801ca0:	48 89 e5             	mov    %rsp,%rbp
+  801ca3:	53                   	push   %rbx
+  801ca4:	48 83 ec 30          	sub    $0x30,%rsp
+  801ca8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801ca8 <strstr+0x9>
+  801caf:	49 bb 88 73 00 00 00 	movabs $0x7388,%r11
+  801cb6:	00 00 00 
+  801cb9:	4c 01 db             	add    %r11,%rbx
+  801cbc:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801cc0:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801cc4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cc8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ccc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cd0:	0f b6 00             	movzbl (%rax),%eax
+  801cd3:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801cd6:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801cda:	75 06                	jne    801ce2 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801cdc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ce0:	eb 73                	jmp    801d55 <strstr+0xb6>
+
+	len = strlen(str);
+  801ce2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ce6:	48 89 c7             	mov    %rax,%rdi
+  801ce9:	48 b8 fc 83 ff ff ff 	movabs $0xffffffffffff83fc,%rax
+  801cf0:	ff ff ff 
+  801cf3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801cf7:	ff d0                	call   *%rax
+  801cf9:	48 98                	cltq
+  801cfb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801cff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d03:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d07:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d0b:	0f b6 00             	movzbl (%rax),%eax
+  801d0e:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801d11:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801d15:	75 07                	jne    801d1e <strstr+0x7f>
+				return (char *) 0;
+  801d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1c:	eb 37                	jmp    801d55 <strstr+0xb6>
+		} while (sc != c);
+  801d1e:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801d22:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801d25:	75 d8                	jne    801cff <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801d27:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d2b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d33:	48 89 ce             	mov    %rcx,%rsi
+  801d36:	48 89 c7             	mov    %rax,%rdi
+  801d39:	48 b8 b0 86 ff ff ff 	movabs $0xffffffffffff86b0,%rax
+  801d40:	ff ff ff 
+  801d43:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d47:	ff d0                	call   *%rax
+  801d49:	85 c0                	test   %eax,%eax
+  801d4b:	75 b2                	jne    801cff <strstr+0x60>
+
+	return (char *) (in - 1);
+  801d4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d51:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801d55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d59:	c9                   	leave
+  801d5a:	c3                   	ret
+
+0000000000801d5b <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801d5b:	55                   	push   %rbp
+  801d5c:	48 89 e5             	mov    %rsp,%rbp
+  801d5f:	41 57                	push   %r15
+  801d61:	53                   	push   %rbx
+  801d62:	48 83 ec 40          	sub    $0x40,%rsp
+  801d66:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801d66 <syscall+0xb>
+  801d6d:	49 bb ca 72 00 00 00 	movabs $0x72ca,%r11
+  801d74:	00 00 00 
+  801d77:	4d 01 da             	add    %r11,%r10
+  801d7a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801d7d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801d80:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d84:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801d88:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801d8c:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801d90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d93:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801d97:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d9b:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801d9f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801da3:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801da7:	4c 89 c3             	mov    %r8,%rbx
+  801daa:	cd 30                	int    $0x30
+  801dac:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801db0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801db4:	74 52                	je     801e08 <syscall+0xad>
+  801db6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801dbb:	7e 4b                	jle    801e08 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801dbd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801dc1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dc4:	49 89 d0             	mov    %rdx,%r8
+  801dc7:	89 c1                	mov    %eax,%ecx
+  801dc9:	48 b8 88 dc ff ff ff 	movabs $0xffffffffffffdc88,%rax
+  801dd0:	ff ff ff 
+  801dd3:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801dd7:	48 89 c2             	mov    %rax,%rdx
+  801dda:	be 23 00 00 00       	mov    $0x23,%esi
+  801ddf:	48 b8 a5 dc ff ff ff 	movabs $0xffffffffffffdca5,%rax
+  801de6:	ff ff ff 
+  801de9:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801ded:	48 89 c7             	mov    %rax,%rdi
+  801df0:	4d 89 d7             	mov    %r10,%r15
+  801df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df8:	49 b9 fe c7 ff ff ff 	movabs $0xffffffffffffc7fe,%r9
+  801dff:	ff ff ff 
+  801e02:	4d 01 d1             	add    %r10,%r9
+  801e05:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e0c:	48 83 c4 40          	add    $0x40,%rsp
+  801e10:	5b                   	pop    %rbx
+  801e11:	41 5f                	pop    %r15
+  801e13:	5d                   	pop    %rbp
+  801e14:	c3                   	ret
+
+0000000000801e15 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801e15:	55                   	push   %rbp
+  801e16:	48 89 e5             	mov    %rsp,%rbp
+  801e19:	41 57                	push   %r15
+  801e1b:	41 56                	push   %r14
+  801e1d:	41 55                	push   %r13
+  801e1f:	41 54                	push   %r12
+  801e21:	53                   	push   %rbx
+  801e22:	48 83 ec 48          	sub    $0x48,%rsp
+  801e26:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801e26 <syscall_words+0x11>
+  801e2d:	49 bb 0a 72 00 00 00 	movabs $0x720a,%r11
+  801e34:	00 00 00 
+  801e37:	4d 01 de             	add    %r11,%r14
+  801e3a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801e3d:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801e40:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801e44:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801e48:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801e4c:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801e50:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e55:	74 09                	je     801e60 <syscall_words+0x4b>
+  801e57:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e5b:	48 8b 00             	mov    (%rax),%rax
+  801e5e:	eb 05                	jmp    801e65 <syscall_words+0x50>
+  801e60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e65:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801e68:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e6d:	74 0a                	je     801e79 <syscall_words+0x64>
+  801e6f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e73:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e77:	eb 05                	jmp    801e7e <syscall_words+0x69>
+  801e79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e7e:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801e81:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e86:	74 0a                	je     801e92 <syscall_words+0x7d>
+  801e88:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e8c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e90:	eb 05                	jmp    801e97 <syscall_words+0x82>
+  801e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e97:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801e9a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e9f:	74 0a                	je     801eab <syscall_words+0x96>
+  801ea1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ea5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ea9:	eb 05                	jmp    801eb0 <syscall_words+0x9b>
+  801eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb0:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801eb3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801eb8:	74 0a                	je     801ec4 <syscall_words+0xaf>
+  801eba:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ebe:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ec2:	eb 05                	jmp    801ec9 <syscall_words+0xb4>
+  801ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec9:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801ecc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ed1:	74 0a                	je     801edd <syscall_words+0xc8>
+  801ed3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ed7:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801edb:	eb 05                	jmp    801ee2 <syscall_words+0xcd>
+  801edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee2:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801ee5:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801ee8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801eec:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801ef0:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801ef4:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801ef8:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801efc:	cd 30                	int    $0x30
+  801efe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801f02:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f07:	74 50                	je     801f59 <syscall_words+0x144>
+		words[0] = r8;
+  801f09:	4c 89 c2             	mov    %r8,%rdx
+  801f0c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f10:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801f13:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f17:	48 83 c0 08          	add    $0x8,%rax
+  801f1b:	4c 89 ca             	mov    %r9,%rdx
+  801f1e:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801f21:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f25:	48 83 c0 10          	add    $0x10,%rax
+  801f29:	4c 89 d2             	mov    %r10,%rdx
+  801f2c:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801f2f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f33:	48 83 c0 18          	add    $0x18,%rax
+  801f37:	4c 89 da             	mov    %r11,%rdx
+  801f3a:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801f3d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f41:	48 83 c0 20          	add    $0x20,%rax
+  801f45:	4c 89 e2             	mov    %r12,%rdx
+  801f48:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801f4b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f4f:	48 83 c0 28          	add    $0x28,%rax
+  801f53:	4c 89 ea             	mov    %r13,%rdx
+  801f56:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801f59:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801f5d:	74 52                	je     801fb1 <syscall_words+0x19c>
+  801f5f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801f64:	7e 4b                	jle    801fb1 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f66:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f6a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f6d:	49 89 d0             	mov    %rdx,%r8
+  801f70:	89 c1                	mov    %eax,%ecx
+  801f72:	48 b8 88 dc ff ff ff 	movabs $0xffffffffffffdc88,%rax
+  801f79:	ff ff ff 
+  801f7c:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801f80:	48 89 c2             	mov    %rax,%rdx
+  801f83:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801f88:	48 b8 a5 dc ff ff ff 	movabs $0xffffffffffffdca5,%rax
+  801f8f:	ff ff ff 
+  801f92:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801f96:	48 89 c7             	mov    %rax,%rdi
+  801f99:	4d 89 f7             	mov    %r14,%r15
+  801f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa1:	49 b9 fe c7 ff ff ff 	movabs $0xffffffffffffc7fe,%r9
+  801fa8:	ff ff ff 
+  801fab:	4d 01 f1             	add    %r14,%r9
+  801fae:	41 ff d1             	call   *%r9
+
+	return ret;
+  801fb1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801fb5:	48 83 c4 48          	add    $0x48,%rsp
+  801fb9:	5b                   	pop    %rbx
+  801fba:	41 5c                	pop    %r12
+  801fbc:	41 5d                	pop    %r13
+  801fbe:	41 5e                	pop    %r14
+  801fc0:	41 5f                	pop    %r15
+  801fc2:	5d                   	pop    %rbp
+  801fc3:	c3                   	ret
+
+0000000000801fc4 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801fc4:	55                   	push   %rbp
+  801fc5:	48 89 e5             	mov    %rsp,%rbp
+  801fc8:	48 83 ec 10          	sub    $0x10,%rsp
+  801fcc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fcc <sys_cputs+0x8>
+  801fd3:	49 bb 64 70 00 00 00 	movabs $0x7064,%r11
+  801fda:	00 00 00 
+  801fdd:	4c 01 d8             	add    %r11,%rax
+  801fe0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801fe4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801fe8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801fec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ff0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ff4:	6a 00                	push   $0x0
+  801ff6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ffc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802002:	be 00 00 00 00       	mov    $0x0,%esi
+  802007:	bf 00 00 00 00       	mov    $0x0,%edi
+  80200c:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802013:	ff ff ff 
+  802016:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80201a:	ff d0                	call   *%rax
+  80201c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802020:	90                   	nop
+  802021:	c9                   	leave
+  802022:	c3                   	ret
+
+0000000000802023 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802023:	55                   	push   %rbp
+  802024:	48 89 e5             	mov    %rsp,%rbp
+  802027:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802027 <sys_cgetc+0x4>
+  80202e:	49 bb 09 70 00 00 00 	movabs $0x7009,%r11
+  802035:	00 00 00 
+  802038:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80203b:	48 83 ec 08          	sub    $0x8,%rsp
+  80203f:	6a 00                	push   $0x0
+  802041:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802047:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80204d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802052:	ba 00 00 00 00       	mov    $0x0,%edx
+  802057:	be 00 00 00 00       	mov    $0x0,%esi
+  80205c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802061:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802068:	ff ff ff 
+  80206b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80206f:	ff d0                	call   *%rax
+  802071:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+
+0000000000802077 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802077:	55                   	push   %rbp
+  802078:	48 89 e5             	mov    %rsp,%rbp
+  80207b:	48 83 ec 10          	sub    $0x10,%rsp
+  80207f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80207f <sys_env_destroy+0x8>
+  802086:	49 bb b1 6f 00 00 00 	movabs $0x6fb1,%r11
+  80208d:	00 00 00 
+  802090:	4c 01 d8             	add    %r11,%rax
+  802093:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802096:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802099:	48 63 d2             	movslq %edx,%rdx
+  80209c:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a0:	6a 00                	push   $0x0
+  8020a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8020b8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020bd:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  8020c4:	ff ff ff 
+  8020c7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020cb:	ff d0                	call   *%rax
+  8020cd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020d1:	c9                   	leave
+  8020d2:	c3                   	ret
+
+00000000008020d3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8020d3:	55                   	push   %rbp
+  8020d4:	48 89 e5             	mov    %rsp,%rbp
+  8020d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020d7 <sys_getenvid+0x4>
+  8020de:	49 bb 59 6f 00 00 00 	movabs $0x6f59,%r11
+  8020e5:	00 00 00 
+  8020e8:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8020eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ef:	6a 00                	push   $0x0
+  8020f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802102:	ba 00 00 00 00       	mov    $0x0,%edx
+  802107:	be 00 00 00 00       	mov    $0x0,%esi
+  80210c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802111:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802118:	ff ff ff 
+  80211b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80211f:	ff d0                	call   *%rax
+  802121:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802125:	c9                   	leave
+  802126:	c3                   	ret
+
+0000000000802127 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802127:	55                   	push   %rbp
+  802128:	48 89 e5             	mov    %rsp,%rbp
+  80212b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80212b <sys_yield+0x4>
+  802132:	49 bb 05 6f 00 00 00 	movabs $0x6f05,%r11
+  802139:	00 00 00 
+  80213c:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80213f:	48 83 ec 08          	sub    $0x8,%rsp
+  802143:	6a 00                	push   $0x0
+  802145:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80214b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802151:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802156:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215b:	be 00 00 00 00       	mov    $0x0,%esi
+  802160:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802165:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  80216c:	ff ff ff 
+  80216f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802173:	ff d0                	call   *%rax
+  802175:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802179:	90                   	nop
+  80217a:	c9                   	leave
+  80217b:	c3                   	ret
+
+000000000080217c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80217c:	55                   	push   %rbp
+  80217d:	48 89 e5             	mov    %rsp,%rbp
+  802180:	48 83 ec 10          	sub    $0x10,%rsp
+  802184:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802184 <sys_page_alloc+0x8>
+  80218b:	49 bb ac 6e 00 00 00 	movabs $0x6eac,%r11
+  802192:	00 00 00 
+  802195:	4c 01 d8             	add    %r11,%rax
+  802198:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80219b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80219f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8021a2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021a5:	48 63 f2             	movslq %edx,%rsi
+  8021a8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021ac:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021af:	48 63 d2             	movslq %edx,%rdx
+  8021b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b6:	6a 00                	push   $0x0
+  8021b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021be:	49 89 f0             	mov    %rsi,%r8
+  8021c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8021c6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021cb:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  8021d2:	ff ff ff 
+  8021d5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021d9:	ff d0                	call   *%rax
+  8021db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021df:	c9                   	leave
+  8021e0:	c3                   	ret
+
+00000000008021e1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8021e1:	55                   	push   %rbp
+  8021e2:	48 89 e5             	mov    %rsp,%rbp
+  8021e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8021e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021e9 <sys_page_map+0x8>
+  8021f0:	49 bb 47 6e 00 00 00 	movabs $0x6e47,%r11
+  8021f7:	00 00 00 
+  8021fa:	4c 01 d8             	add    %r11,%rax
+  8021fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802200:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802204:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802207:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80220b:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80220f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802212:	48 63 f2             	movslq %edx,%rsi
+  802215:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802219:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80221c:	48 63 fa             	movslq %edx,%rdi
+  80221f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802223:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802226:	48 63 d2             	movslq %edx,%rdx
+  802229:	48 83 ec 08          	sub    $0x8,%rsp
+  80222d:	56                   	push   %rsi
+  80222e:	4d 89 c1             	mov    %r8,%r9
+  802231:	49 89 f8             	mov    %rdi,%r8
+  802234:	be 01 00 00 00       	mov    $0x1,%esi
+  802239:	bf 05 00 00 00       	mov    $0x5,%edi
+  80223e:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802245:	ff ff ff 
+  802248:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80224c:	ff d0                	call   *%rax
+  80224e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802252:	c9                   	leave
+  802253:	c3                   	ret
+
+0000000000802254 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802254:	55                   	push   %rbp
+  802255:	48 89 e5             	mov    %rsp,%rbp
+  802258:	48 83 ec 10          	sub    $0x10,%rsp
+  80225c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80225c <sys_page_unmap+0x8>
+  802263:	49 bb d4 6d 00 00 00 	movabs $0x6dd4,%r11
+  80226a:	00 00 00 
+  80226d:	4c 01 d8             	add    %r11,%rax
+  802270:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802273:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802277:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80227b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80227e:	48 63 d2             	movslq %edx,%rdx
+  802281:	48 83 ec 08          	sub    $0x8,%rsp
+  802285:	6a 00                	push   $0x0
+  802287:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80228d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802293:	be 01 00 00 00       	mov    $0x1,%esi
+  802298:	bf 06 00 00 00       	mov    $0x6,%edi
+  80229d:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  8022a4:	ff ff ff 
+  8022a7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022ab:	ff d0                	call   *%rax
+  8022ad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022b1:	c9                   	leave
+  8022b2:	c3                   	ret
+
+00000000008022b3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8022b3:	55                   	push   %rbp
+  8022b4:	48 89 e5             	mov    %rsp,%rbp
+  8022b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8022bb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022bb <sys_env_set_status+0x8>
+  8022c2:	49 bb 75 6d 00 00 00 	movabs $0x6d75,%r11
+  8022c9:	00 00 00 
+  8022cc:	4c 01 d8             	add    %r11,%rax
+  8022cf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022d2:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8022d5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022d8:	48 63 ca             	movslq %edx,%rcx
+  8022db:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022de:	48 63 d2             	movslq %edx,%rdx
+  8022e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e5:	6a 00                	push   $0x0
+  8022e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8022f8:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022fd:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802304:	ff ff ff 
+  802307:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80230b:	ff d0                	call   *%rax
+  80230d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802311:	c9                   	leave
+  802312:	c3                   	ret
+
+0000000000802313 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802313:	55                   	push   %rbp
+  802314:	48 89 e5             	mov    %rsp,%rbp
+  802317:	48 83 ec 10          	sub    $0x10,%rsp
+  80231b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80231b <sys_env_set_trapframe+0x8>
+  802322:	49 bb 15 6d 00 00 00 	movabs $0x6d15,%r11
+  802329:	00 00 00 
+  80232c:	4c 01 d8             	add    %r11,%rax
+  80232f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802332:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802336:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80233a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80233d:	48 63 d2             	movslq %edx,%rdx
+  802340:	48 83 ec 08          	sub    $0x8,%rsp
+  802344:	6a 00                	push   $0x0
+  802346:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80234c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802352:	be 01 00 00 00       	mov    $0x1,%esi
+  802357:	bf 09 00 00 00       	mov    $0x9,%edi
+  80235c:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802363:	ff ff ff 
+  802366:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80236a:	ff d0                	call   *%rax
+  80236c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802370:	c9                   	leave
+  802371:	c3                   	ret
+
+0000000000802372 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802372:	55                   	push   %rbp
+  802373:	48 89 e5             	mov    %rsp,%rbp
+  802376:	48 83 ec 10          	sub    $0x10,%rsp
+  80237a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80237a <sys_env_set_pgfault_upcall+0x8>
+  802381:	49 bb b6 6c 00 00 00 	movabs $0x6cb6,%r11
+  802388:	00 00 00 
+  80238b:	4c 01 d8             	add    %r11,%rax
+  80238e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802391:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802395:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802399:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80239c:	48 63 d2             	movslq %edx,%rdx
+  80239f:	48 83 ec 08          	sub    $0x8,%rsp
+  8023a3:	6a 00                	push   $0x0
+  8023a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8023b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8023bb:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  8023c2:	ff ff ff 
+  8023c5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023c9:	ff d0                	call   *%rax
+  8023cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023cf:	c9                   	leave
+  8023d0:	c3                   	ret
+
+00000000008023d1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8023d1:	55                   	push   %rbp
+  8023d2:	48 89 e5             	mov    %rsp,%rbp
+  8023d5:	48 83 ec 20          	sub    $0x20,%rsp
+  8023d9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023d9 <sys_ipc_try_send+0x8>
+  8023e0:	49 bb 57 6c 00 00 00 	movabs $0x6c57,%r11
+  8023e7:	00 00 00 
+  8023ea:	4c 01 d8             	add    %r11,%rax
+  8023ed:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023f4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023f8:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8023fb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023fe:	48 63 fa             	movslq %edx,%rdi
+  802401:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802405:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802408:	48 63 d2             	movslq %edx,%rdx
+  80240b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80240f:	48 83 ec 08          	sub    $0x8,%rsp
+  802413:	6a 00                	push   $0x0
+  802415:	49 89 f9             	mov    %rdi,%r9
+  802418:	49 89 f0             	mov    %rsi,%r8
+  80241b:	be 00 00 00 00       	mov    $0x0,%esi
+  802420:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802425:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  80242c:	ff ff ff 
+  80242f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802433:	ff d0                	call   *%rax
+  802435:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+000000000080243b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80243b:	55                   	push   %rbp
+  80243c:	48 89 e5             	mov    %rsp,%rbp
+  80243f:	48 83 ec 20          	sub    $0x20,%rsp
+  802443:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802443 <sys_ipc_send+0x8>
+  80244a:	49 bb ed 6b 00 00 00 	movabs $0x6bed,%r11
+  802451:	00 00 00 
+  802454:	4c 01 d8             	add    %r11,%rax
+  802457:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80245a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80245e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802462:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802465:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802468:	48 63 fa             	movslq %edx,%rdi
+  80246b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80246f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802472:	48 63 d2             	movslq %edx,%rdx
+  802475:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802479:	48 83 ec 08          	sub    $0x8,%rsp
+  80247d:	6a 00                	push   $0x0
+  80247f:	49 89 f9             	mov    %rdi,%r9
+  802482:	49 89 f0             	mov    %rsi,%r8
+  802485:	be 00 00 00 00       	mov    $0x0,%esi
+  80248a:	bf 17 00 00 00       	mov    $0x17,%edi
+  80248f:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802496:	ff ff ff 
+  802499:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80249d:	ff d0                	call   *%rax
+  80249f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024a3:	c9                   	leave
+  8024a4:	c3                   	ret
+
+00000000008024a5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8024a5:	55                   	push   %rbp
+  8024a6:	48 89 e5             	mov    %rsp,%rbp
+  8024a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ad:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024ad <sys_ipc_recv+0x8>
+  8024b4:	49 bb 83 6b 00 00 00 	movabs $0x6b83,%r11
+  8024bb:	00 00 00 
+  8024be:	4c 01 d8             	add    %r11,%rax
+  8024c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8024c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024c9:	6a 00                	push   $0x0
+  8024cb:	6a 00                	push   $0x0
+  8024cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024de:	be 01 00 00 00       	mov    $0x1,%esi
+  8024e3:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8024e8:	49 ba e5 8d ff ff ff 	movabs $0xffffffffffff8de5,%r10
+  8024ef:	ff ff ff 
+  8024f2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024f6:	ff d0                	call   *%rax
+  8024f8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024fc:	c9                   	leave
+  8024fd:	c3                   	ret
+
+00000000008024fe <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8024fe:	55                   	push   %rbp
+  8024ff:	48 89 e5             	mov    %rsp,%rbp
+  802502:	48 83 ec 30          	sub    $0x30,%rsp
+  802506:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802506 <sys_ipc_call+0x8>
+  80250d:	49 bb 2a 6b 00 00 00 	movabs $0x6b2a,%r11
+  802514:	00 00 00 
+  802517:	4c 01 d8             	add    %r11,%rax
+  80251a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80251d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802521:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802525:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802528:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80252c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802530:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802534:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802537:	4c 63 c2             	movslq %edx,%r8
+  80253a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80253e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802541:	48 63 d2             	movslq %edx,%rdx
+  802544:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802548:	ff 75 d8             	push   -0x28(%rbp)
+  80254b:	56                   	push   %rsi
+  80254c:	4d 89 c1             	mov    %r8,%r9
+  80254f:	49 89 f8             	mov    %rdi,%r8
+  802552:	be 00 00 00 00       	mov    $0x0,%esi
+  802557:	bf 18 00 00 00       	mov    $0x18,%edi
+  80255c:	49 ba e5 8d ff ff ff 	movabs $0xffffffffffff8de5,%r10
+  802563:	ff ff ff 
+  802566:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80256a:	ff d0                	call   *%rax
+  80256c:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802570:	c9                   	leave
+  802571:	c3                   	ret
+
+0000000000802572 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802572:	55                   	push   %rbp
+  802573:	48 89 e5             	mov    %rsp,%rbp
+  802576:	48 83 ec 30          	sub    $0x30,%rsp
+  80257a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80257a <sys_ipc_reply_recv+0x8>
+  802581:	49 bb b6 6a 00 00 00 	movabs $0x6ab6,%r11
+  802588:	00 00 00 
+  80258b:	4c 01 d8             	add    %r11,%rax
+  80258e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802591:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802595:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802599:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80259c:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8025a0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8025a4:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8025a8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025ab:	4c 63 c2             	movslq %edx,%r8
+  8025ae:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8025b2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025b5:	48 63 d2             	movslq %edx,%rdx
+  8025b8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025bc:	ff 75 d8             	push   -0x28(%rbp)
+  8025bf:	56                   	push   %rsi
+  8025c0:	4d 89 c1             	mov    %r8,%r9
+  8025c3:	49 89 f8             	mov    %rdi,%r8
+  8025c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8025cb:	bf 19 00 00 00       	mov    $0x19,%edi
+  8025d0:	49 ba e5 8d ff ff ff 	movabs $0xffffffffffff8de5,%r10
+  8025d7:	ff ff ff 
+  8025da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025de:	ff d0                	call   *%rax
+  8025e0:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8025e4:	c9                   	leave
+  8025e5:	c3                   	ret
+
+00000000008025e6 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8025e6:	55                   	push   %rbp
+  8025e7:	48 89 e5             	mov    %rsp,%rbp
+  8025ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025ee <sys_env_set_priority+0x8>
+  8025f5:	49 bb 42 6a 00 00 00 	movabs $0x6a42,%r11
+  8025fc:	00 00 00 
+  8025ff:	4c 01 d8             	add    %r11,%rax
+  802602:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802605:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802608:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80260b:	48 63 ca             	movslq %edx,%rcx
+  80260e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802611:	48 63 d2             	movslq %edx,%rdx
+  802614:	48 83 ec 08          	sub    $0x8,%rsp
+  802618:	6a 00                	push   $0x0
+  80261a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802620:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802626:	be 01 00 00 00       	mov    $0x1,%esi
+  80262b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802630:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802637:	ff ff ff 
+  80263a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80263e:	ff d0                	call   *%rax
+  802640:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802644:	c9                   	leave
+  802645:	c3                   	ret
+
+0000000000802646 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802646:	55                   	push   %rbp
+  802647:	48 89 e5             	mov    %rsp,%rbp
+  80264a:	48 83 ec 10          	sub    $0x10,%rsp
+  80264e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80264e <sys_env_set_affinity+0x8>
+  802655:	49 bb e2 69 00 00 00 	movabs $0x69e2,%r11
+  80265c:	00 00 00 
+  80265f:	4c 01 d8             	add    %r11,%rax
+  802662:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802665:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802668:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  80266b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80266e:	48 63 d2             	movslq %edx,%rdx
+  802671:	48 83 ec 08          	sub    $0x8,%rsp
+  802675:	6a 00                	push   $0x0
+  802677:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80267d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802683:	be 01 00 00 00       	mov    $0x1,%esi
+  802688:	bf 10 00 00 00       	mov    $0x10,%edi
+  80268d:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802694:	ff ff ff 
+  802697:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80269b:	ff d0                	call   *%rax
+  80269d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026a1:	c9                   	leave
+  8026a2:	c3                   	ret
+
+00000000008026a3 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8026a3:	55                   	push   %rbp
+  8026a4:	48 89 e5             	mov    %rsp,%rbp
+  8026a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026a7 <sys_time_msec+0x4>
+  8026ae:	49 bb 89 69 00 00 00 	movabs $0x6989,%r11
+  8026b5:	00 00 00 
+  8026b8:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8026bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8026bf:	6a 00                	push   $0x0
+  8026c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026dc:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8026e1:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  8026e8:	ff ff ff 
+  8026eb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026ef:	ff d0                	call   *%rax
+  8026f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f5:	c9                   	leave
+  8026f6:	c3                   	ret
+
+00000000008026f7 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8026f7:	55                   	push   %rbp
+  8026f8:	48 89 e5             	mov    %rsp,%rbp
+  8026fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8026ff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026ff <sys_sleep_usec+0x8>
+  802706:	49 bb 31 69 00 00 00 	movabs $0x6931,%r11
+  80270d:	00 00 00 
+  802710:	4c 01 d8             	add    %r11,%rax
+  802713:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802717:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80271b:	48 83 ec 08          	sub    $0x8,%rsp
+  80271f:	6a 00                	push   $0x0
+  802721:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802727:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80272d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802732:	be 00 00 00 00       	mov    $0x0,%esi
+  802737:	bf 11 00 00 00       	mov    $0x11,%edi
+  80273c:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802743:	ff ff ff 
+  802746:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80274a:	ff d0                	call   *%rax
+  80274c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802750:	c9                   	leave
+  802751:	c3                   	ret
+
+0000000000802752 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802752:	55                   	push   %rbp
+  802753:	48 89 e5             	mov    %rsp,%rbp
+  802756:	48 83 ec 10          	sub    $0x10,%rsp
+  80275a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80275a <sys_page_alloc_huge+0x8>
+  802761:	49 bb d6 68 00 00 00 	movabs $0x68d6,%r11
+  802768:	00 00 00 
+  80276b:	4c 01 d8             	add    %r11,%rax
+  80276e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802771:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802775:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802778:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80277b:	48 63 f2             	movslq %edx,%rsi
+  80277e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802782:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802785:	48 63 d2             	movslq %edx,%rdx
+  802788:	48 83 ec 08          	sub    $0x8,%rsp
+  80278c:	6a 00                	push   $0x0
+  80278e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802794:	49 89 f0             	mov    %rsi,%r8
+  802797:	be 01 00 00 00       	mov    $0x1,%esi
+  80279c:	bf 12 00 00 00       	mov    $0x12,%edi
+  8027a1:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  8027a8:	ff ff ff 
+  8027ab:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027af:	ff d0                	call   *%rax
+  8027b1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027b5:	c9                   	leave
+  8027b6:	c3                   	ret
+
+00000000008027b7 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8027b7:	55                   	push   %rbp
+  8027b8:	48 89 e5             	mov    %rsp,%rbp
+  8027bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8027bf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027bf <sys_page_map_batch+0x8>
+  8027c6:	49 bb 71 68 00 00 00 	movabs $0x6871,%r11
+  8027cd:	00 00 00 
+  8027d0:	4c 01 d8             	add    %r11,%rax
+  8027d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8027db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027df:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e7:	6a 00                	push   $0x0
+  8027e9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8027fa:	bf 13 00 00 00       	mov    $0x13,%edi
+  8027ff:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802806:	ff ff ff 
+  802809:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80280d:	ff d0                	call   *%rax
+  80280f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802813:	c9                   	leave
+  802814:	c3                   	ret
+
+0000000000802815 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802815:	55                   	push   %rbp
+  802816:	48 89 e5             	mov    %rsp,%rbp
+  802819:	48 83 ec 10          	sub    $0x10,%rsp
+  80281d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80281d <sys_page_alloc_batch+0x8>
+  802824:	49 bb 13 68 00 00 00 	movabs $0x6813,%r11
+  80282b:	00 00 00 
+  80282e:	4c 01 d8             	add    %r11,%rax
+  802831:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802835:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802839:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80283d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802841:	48 83 ec 08          	sub    $0x8,%rsp
+  802845:	6a 00                	push   $0x0
+  802847:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80284d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802853:	be 01 00 00 00       	mov    $0x1,%esi
+  802858:	bf 14 00 00 00       	mov    $0x14,%edi
+  80285d:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802864:	ff ff ff 
+  802867:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80286b:	ff d0                	call   *%rax
+  80286d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802871:	c9                   	leave
+  802872:	c3                   	ret
+
+0000000000802873 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802873:	55                   	push   %rbp
+  802874:	48 89 e5             	mov    %rsp,%rbp
+  802877:	48 83 ec 10          	sub    $0x10,%rsp
+  80287b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80287b <sys_page_unmap_batch+0x8>
+  802882:	49 bb b5 67 00 00 00 	movabs $0x67b5,%r11
+  802889:	00 00 00 
+  80288c:	4c 01 d8             	add    %r11,%rax
+  80288f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802893:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802897:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80289b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80289f:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a3:	6a 00                	push   $0x0
+  8028a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8028b6:	bf 15 00 00 00       	mov    $0x15,%edi
+  8028bb:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  8028c2:	ff ff ff 
+  8028c5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028c9:	ff d0                	call   *%rax
+  8028cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028cf:	c9                   	leave
+  8028d0:	c3                   	ret
+
+00000000008028d1 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8028d1:	55                   	push   %rbp
+  8028d2:	48 89 e5             	mov    %rsp,%rbp
+  8028d5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028d5 <sys_fork+0x4>
+  8028dc:	49 bb 5b 67 00 00 00 	movabs $0x675b,%r11
+  8028e3:	00 00 00 
+  8028e6:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8028e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ed:	6a 00                	push   $0x0
+  8028ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802900:	ba 00 00 00 00       	mov    $0x0,%edx
+  802905:	be 00 00 00 00       	mov    $0x0,%esi
+  80290a:	bf 16 00 00 00       	mov    $0x16,%edi
+  80290f:	49 ba 2b 8d ff ff ff 	movabs $0xffffffffffff8d2b,%r10
+  802916:	ff ff ff 
+  802919:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80291d:	ff d0                	call   *%rax
+  80291f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+
+0000000000802925 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802925:	55                   	push   %rbp
+  802926:	48 89 e5             	mov    %rsp,%rbp
+  802929:	48 83 ec 08          	sub    $0x8,%rsp
+  80292d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80292d <fd2num+0x8>
+  802934:	49 bb 03 67 00 00 00 	movabs $0x6703,%r11
+  80293b:	00 00 00 
+  80293e:	4c 01 d8             	add    %r11,%rax
+  802941:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802945:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802949:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802950:	ff ff ff 
+  802953:	48 01 d0             	add    %rdx,%rax
+  802956:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80295a:	c9                   	leave
+  80295b:	c3                   	ret
+
+000000000080295c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80295c:	55                   	push   %rbp
+  80295d:	48 89 e5             	mov    %rsp,%rbp
+  802960:	48 83 ec 08          	sub    $0x8,%rsp
+  802964:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802964 <fd2data+0x8>
+  80296b:	49 bb cc 66 00 00 00 	movabs $0x66cc,%r11
+  802972:	00 00 00 
+  802975:	4c 01 d8             	add    %r11,%rax
+  802978:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80297c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802980:	48 89 d7             	mov    %rdx,%rdi
+  802983:	48 ba f5 98 ff ff ff 	movabs $0xffffffffffff98f5,%rdx
+  80298a:	ff ff ff 
+  80298d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802991:	ff d0                	call   *%rax
+  802993:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802999:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80299d:	c9                   	leave
+  80299e:	c3                   	ret
+
+000000000080299f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80299f:	55                   	push   %rbp
+  8029a0:	48 89 e5             	mov    %rsp,%rbp
+  8029a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8029a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029a7 <fd_alloc+0x8>
+  8029ae:	49 bb 89 66 00 00 00 	movabs $0x6689,%r11
+  8029b5:	00 00 00 
+  8029b8:	4c 01 d8             	add    %r11,%rax
+  8029bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8029bf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029c6:	eb 75                	jmp    802a3d <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8029c8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029cb:	48 63 d2             	movslq %edx,%rdx
+  8029ce:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8029d5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8029d9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8029dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029e1:	48 89 d1             	mov    %rdx,%rcx
+  8029e4:	48 c1 e9 15          	shr    $0x15,%rcx
+  8029e8:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8029ef:	ff ff ff 
+  8029f2:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8029f6:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8029fa:	83 e2 01             	and    $0x1,%edx
+  8029fd:	48 85 d2             	test   %rdx,%rdx
+  802a00:	74 25                	je     802a27 <fd_alloc+0x88>
+  802a02:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a06:	48 89 d1             	mov    %rdx,%rcx
+  802a09:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802a0d:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802a14:	ff ff ff 
+  802a17:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a1b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a1f:	83 e2 01             	and    $0x1,%edx
+  802a22:	48 85 d2             	test   %rdx,%rdx
+  802a25:	75 12                	jne    802a39 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802a27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a2b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a2f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a37:	eb 1a                	jmp    802a53 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802a39:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a3d:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a41:	7e 85                	jle    8029c8 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802a43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a47:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802a4e:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802a53:	c9                   	leave
+  802a54:	c3                   	ret
+
+0000000000802a55 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802a55:	55                   	push   %rbp
+  802a56:	48 89 e5             	mov    %rsp,%rbp
+  802a59:	48 83 ec 20          	sub    $0x20,%rsp
+  802a5d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a5d <fd_lookup+0x8>
+  802a64:	49 bb d3 65 00 00 00 	movabs $0x65d3,%r11
+  802a6b:	00 00 00 
+  802a6e:	4c 01 d8             	add    %r11,%rax
+  802a71:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802a74:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802a78:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a7c:	78 06                	js     802a84 <fd_lookup+0x2f>
+  802a7e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802a82:	7e 07                	jle    802a8b <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802a84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a89:	eb 73                	jmp    802afe <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802a8b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802a8e:	48 63 d2             	movslq %edx,%rdx
+  802a91:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802a98:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802a9c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802aa0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802aa4:	48 89 d1             	mov    %rdx,%rcx
+  802aa7:	48 c1 e9 15          	shr    $0x15,%rcx
+  802aab:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802ab2:	ff ff ff 
+  802ab5:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802ab9:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802abd:	83 e2 01             	and    $0x1,%edx
+  802ac0:	48 85 d2             	test   %rdx,%rdx
+  802ac3:	74 22                	je     802ae7 <fd_lookup+0x92>
+  802ac5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ac9:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802acd:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802ad4:	ff ff ff 
+  802ad7:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802adb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802adf:	83 e0 01             	and    $0x1,%eax
+  802ae2:	48 85 c0             	test   %rax,%rax
+  802ae5:	75 07                	jne    802aee <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802ae7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aec:	eb 10                	jmp    802afe <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802aee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802af2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802af6:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802af9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802afe:	c9                   	leave
+  802aff:	c3                   	ret
+
+0000000000802b00 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802b00:	55                   	push   %rbp
+  802b01:	48 89 e5             	mov    %rsp,%rbp
+  802b04:	41 57                	push   %r15
+  802b06:	53                   	push   %rbx
+  802b07:	48 83 ec 30          	sub    $0x30,%rsp
+  802b0b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b0b <fd_close+0xb>
+  802b12:	49 bb 25 65 00 00 00 	movabs $0x6525,%r11
+  802b19:	00 00 00 
+  802b1c:	4c 01 db             	add    %r11,%rbx
+  802b1f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802b23:	89 f0                	mov    %esi,%eax
+  802b25:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802b28:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b2c:	48 89 c7             	mov    %rax,%rdi
+  802b2f:	48 b8 f5 98 ff ff ff 	movabs $0xffffffffffff98f5,%rax
+  802b36:	ff ff ff 
+  802b39:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b3d:	ff d0                	call   *%rax
+  802b3f:	89 c2                	mov    %eax,%edx
+  802b41:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802b45:	48 89 c6             	mov    %rax,%rsi
+  802b48:	89 d7                	mov    %edx,%edi
+  802b4a:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  802b51:	ff ff ff 
+  802b54:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b58:	ff d0                	call   *%rax
+  802b5a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b5d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b61:	78 0a                	js     802b6d <fd_close+0x6d>
+	    || fd != fd2)
+  802b63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b67:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802b6b:	74 12                	je     802b7f <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802b6d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802b71:	74 05                	je     802b78 <fd_close+0x78>
+  802b73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b76:	eb 7a                	jmp    802bf2 <fd_close+0xf2>
+  802b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b7d:	eb 73                	jmp    802bf2 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802b7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b83:	8b 00                	mov    (%rax),%eax
+  802b85:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802b89:	48 89 d6             	mov    %rdx,%rsi
+  802b8c:	89 c7                	mov    %eax,%edi
+  802b8e:	48 b8 cb 9b ff ff ff 	movabs $0xffffffffffff9bcb,%rax
+  802b95:	ff ff ff 
+  802b98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b9c:	ff d0                	call   *%rax
+  802b9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ba1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ba5:	78 2a                	js     802bd1 <fd_close+0xd1>
+		if (dev->dev_close)
+  802ba7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bab:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802baf:	48 85 c0             	test   %rax,%rax
+  802bb2:	74 16                	je     802bca <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802bb4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bb8:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802bbc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bc0:	48 89 c7             	mov    %rax,%rdi
+  802bc3:	ff d2                	call   *%rdx
+  802bc5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bc8:	eb 07                	jmp    802bd1 <fd_close+0xd1>
+		else
+			r = 0;
+  802bca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802bd1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bd5:	48 89 c6             	mov    %rax,%rsi
+  802bd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bdd:	49 89 df             	mov    %rbx,%r15
+  802be0:	48 b8 24 92 ff ff ff 	movabs $0xffffffffffff9224,%rax
+  802be7:	ff ff ff 
+  802bea:	48 01 d8             	add    %rbx,%rax
+  802bed:	ff d0                	call   *%rax
+	return r;
+  802bef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802bf2:	48 83 c4 30          	add    $0x30,%rsp
+  802bf6:	5b                   	pop    %rbx
+  802bf7:	41 5f                	pop    %r15
+  802bf9:	5d                   	pop    %rbp
+  802bfa:	c3                   	ret
+
+0000000000802bfb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802bfb:	55                   	push   %rbp
+  802bfc:	48 89 e5             	mov    %rsp,%rbp
+  802bff:	41 57                	push   %r15
+  802c01:	48 83 ec 28          	sub    $0x28,%rsp
+  802c05:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802c05 <dev_lookup+0xa>
+  802c0c:	49 bb 2b 64 00 00 00 	movabs $0x642b,%r11
+  802c13:	00 00 00 
+  802c16:	4c 01 d9             	add    %r11,%rcx
+  802c19:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c1c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802c20:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802c27:	eb 45                	jmp    802c6e <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802c29:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802c30:	00 00 00 
+  802c33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c36:	48 98                	cltq
+  802c38:	48 01 ca             	add    %rcx,%rdx
+  802c3b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c3f:	8b 00                	mov    (%rax),%eax
+  802c41:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802c44:	75 24                	jne    802c6a <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802c46:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802c4d:	00 00 00 
+  802c50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c53:	48 98                	cltq
+  802c55:	48 01 ca             	add    %rcx,%rdx
+  802c58:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c60:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c68:	eb 74                	jmp    802cde <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802c6a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802c6e:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802c75:	00 00 00 
+  802c78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c7b:	48 98                	cltq
+  802c7d:	48 01 ca             	add    %rcx,%rdx
+  802c80:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c84:	48 85 c0             	test   %rax,%rax
+  802c87:	75 a0                	jne    802c29 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802c89:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802c90:	ff ff ff 
+  802c93:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802c97:	48 8b 00             	mov    (%rax),%rax
+  802c9a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802ca0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ca3:	89 c6                	mov    %eax,%esi
+  802ca5:	48 b8 b8 dc ff ff ff 	movabs $0xffffffffffffdcb8,%rax
+  802cac:	ff ff ff 
+  802caf:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802cb3:	48 89 c7             	mov    %rax,%rdi
+  802cb6:	49 89 cf             	mov    %rcx,%r15
+  802cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbe:	49 b8 ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%r8
+  802cc5:	ff ff ff 
+  802cc8:	49 01 c8             	add    %rcx,%r8
+  802ccb:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802cce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cd2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802cd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802cde:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802ce2:	c9                   	leave
+  802ce3:	c3                   	ret
+
+0000000000802ce4 <close>:
+
+int
+close(int fdnum)
+{
+  802ce4:	55                   	push   %rbp
+  802ce5:	48 89 e5             	mov    %rsp,%rbp
+  802ce8:	53                   	push   %rbx
+  802ce9:	48 83 ec 28          	sub    $0x28,%rsp
+  802ced:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ced <close+0x9>
+  802cf4:	49 bb 43 63 00 00 00 	movabs $0x6343,%r11
+  802cfb:	00 00 00 
+  802cfe:	4c 01 db             	add    %r11,%rbx
+  802d01:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d04:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802d08:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d0b:	48 89 d6             	mov    %rdx,%rsi
+  802d0e:	89 c7                	mov    %eax,%edi
+  802d10:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  802d17:	ff ff ff 
+  802d1a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d1e:	ff d0                	call   *%rax
+  802d20:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d23:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d27:	79 05                	jns    802d2e <close+0x4a>
+		return r;
+  802d29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d2c:	eb 1c                	jmp    802d4a <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802d2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d32:	be 01 00 00 00       	mov    $0x1,%esi
+  802d37:	48 89 c7             	mov    %rax,%rdi
+  802d3a:	48 b8 d0 9a ff ff ff 	movabs $0xffffffffffff9ad0,%rax
+  802d41:	ff ff ff 
+  802d44:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d48:	ff d0                	call   *%rax
+}
+  802d4a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4e:	c9                   	leave
+  802d4f:	c3                   	ret
+
+0000000000802d50 <close_all>:
+
+void
+close_all(void)
+{
+  802d50:	55                   	push   %rbp
+  802d51:	48 89 e5             	mov    %rsp,%rbp
+  802d54:	53                   	push   %rbx
+  802d55:	48 83 ec 18          	sub    $0x18,%rsp
+  802d59:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d59 <close_all+0x9>
+  802d60:	49 bb d7 62 00 00 00 	movabs $0x62d7,%r11
+  802d67:	00 00 00 
+  802d6a:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802d6d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802d74:	eb 19                	jmp    802d8f <close_all+0x3f>
+		close(i);
+  802d76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d79:	89 c7                	mov    %eax,%edi
+  802d7b:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  802d82:	ff ff ff 
+  802d85:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d89:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802d8b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802d8f:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802d93:	7e e1                	jle    802d76 <close_all+0x26>
+}
+  802d95:	90                   	nop
+  802d96:	90                   	nop
+  802d97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d9b:	c9                   	leave
+  802d9c:	c3                   	ret
+
+0000000000802d9d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802d9d:	55                   	push   %rbp
+  802d9e:	48 89 e5             	mov    %rsp,%rbp
+  802da1:	41 57                	push   %r15
+  802da3:	53                   	push   %rbx
+  802da4:	48 83 ec 40          	sub    $0x40,%rsp
+  802da8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802da8 <dup+0xb>
+  802daf:	49 bb 88 62 00 00 00 	movabs $0x6288,%r11
+  802db6:	00 00 00 
+  802db9:	4c 01 db             	add    %r11,%rbx
+  802dbc:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802dbf:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802dc2:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802dc6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802dc9:	48 89 d6             	mov    %rdx,%rsi
+  802dcc:	89 c7                	mov    %eax,%edi
+  802dce:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  802dd5:	ff ff ff 
+  802dd8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ddc:	ff d0                	call   *%rax
+  802dde:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802de1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802de5:	79 08                	jns    802def <dup+0x52>
+		return r;
+  802de7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dea:	e9 a4 01 00 00       	jmp    802f93 <dup+0x1f6>
+	close(newfdnum);
+  802def:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802df2:	89 c7                	mov    %eax,%edi
+  802df4:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  802dfb:	ff ff ff 
+  802dfe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e02:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802e04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e07:	48 98                	cltq
+  802e09:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802e0f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e13:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802e17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e1b:	48 89 c7             	mov    %rax,%rdi
+  802e1e:	48 b8 2c 99 ff ff ff 	movabs $0xffffffffffff992c,%rax
+  802e25:	ff ff ff 
+  802e28:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e2c:	ff d0                	call   *%rax
+  802e2e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802e32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e36:	48 89 c7             	mov    %rax,%rdi
+  802e39:	48 b8 2c 99 ff ff ff 	movabs $0xffffffffffff992c,%rax
+  802e40:	ff ff ff 
+  802e43:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e47:	ff d0                	call   *%rax
+  802e49:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802e4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e51:	48 c1 e8 15          	shr    $0x15,%rax
+  802e55:	48 89 c2             	mov    %rax,%rdx
+  802e58:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802e5f:	ff ff ff 
+  802e62:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e66:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e6a:	83 e0 01             	and    $0x1,%eax
+  802e6d:	48 85 c0             	test   %rax,%rax
+  802e70:	74 7f                	je     802ef1 <dup+0x154>
+  802e72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e76:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e7a:	48 89 c2             	mov    %rax,%rdx
+  802e7d:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e84:	ff ff ff 
+  802e87:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e8b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e8f:	83 e0 01             	and    $0x1,%eax
+  802e92:	48 85 c0             	test   %rax,%rax
+  802e95:	74 5a                	je     802ef1 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802e97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e9b:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e9f:	48 89 c2             	mov    %rax,%rdx
+  802ea2:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802ea9:	ff ff ff 
+  802eac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802eb0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eb4:	25 07 0e 00 00       	and    $0xe07,%eax
+  802eb9:	89 c1                	mov    %eax,%ecx
+  802ebb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ebf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ec3:	41 89 c8             	mov    %ecx,%r8d
+  802ec6:	48 89 d1             	mov    %rdx,%rcx
+  802ec9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ece:	48 89 c6             	mov    %rax,%rsi
+  802ed1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ed6:	49 89 df             	mov    %rbx,%r15
+  802ed9:	48 b8 b1 91 ff ff ff 	movabs $0xffffffffffff91b1,%rax
+  802ee0:	ff ff ff 
+  802ee3:	48 01 d8             	add    %rbx,%rax
+  802ee6:	ff d0                	call   *%rax
+  802ee8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802eeb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802eef:	78 5f                	js     802f50 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802ef1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ef5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ef9:	48 89 c2             	mov    %rax,%rdx
+  802efc:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f03:	ff ff ff 
+  802f06:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f0a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f0e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f13:	89 c1                	mov    %eax,%ecx
+  802f15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f19:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f1d:	41 89 c8             	mov    %ecx,%r8d
+  802f20:	48 89 d1             	mov    %rdx,%rcx
+  802f23:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f28:	48 89 c6             	mov    %rax,%rsi
+  802f2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f30:	49 89 df             	mov    %rbx,%r15
+  802f33:	48 b8 b1 91 ff ff ff 	movabs $0xffffffffffff91b1,%rax
+  802f3a:	ff ff ff 
+  802f3d:	48 01 d8             	add    %rbx,%rax
+  802f40:	ff d0                	call   *%rax
+  802f42:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f49:	78 08                	js     802f53 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802f4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f4e:	eb 43                	jmp    802f93 <dup+0x1f6>
+			goto err;
+  802f50:	90                   	nop
+  802f51:	eb 01                	jmp    802f54 <dup+0x1b7>
+		goto err;
+  802f53:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802f54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f58:	48 89 c6             	mov    %rax,%rsi
+  802f5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f60:	49 89 df             	mov    %rbx,%r15
+  802f63:	48 b8 24 92 ff ff ff 	movabs $0xffffffffffff9224,%rax
+  802f6a:	ff ff ff 
+  802f6d:	48 01 d8             	add    %rbx,%rax
+  802f70:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802f72:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f76:	48 89 c6             	mov    %rax,%rsi
+  802f79:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7e:	49 89 df             	mov    %rbx,%r15
+  802f81:	48 b8 24 92 ff ff ff 	movabs $0xffffffffffff9224,%rax
+  802f88:	ff ff ff 
+  802f8b:	48 01 d8             	add    %rbx,%rax
+  802f8e:	ff d0                	call   *%rax
+	return r;
+  802f90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f93:	48 83 c4 40          	add    $0x40,%rsp
+  802f97:	5b                   	pop    %rbx
+  802f98:	41 5f                	pop    %r15
+  802f9a:	5d                   	pop    %rbp
+  802f9b:	c3                   	ret
+
+0000000000802f9c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802f9c:	55                   	push   %rbp
+  802f9d:	48 89 e5             	mov    %rsp,%rbp
+  802fa0:	41 57                	push   %r15
+  802fa2:	53                   	push   %rbx
+  802fa3:	48 83 ec 40          	sub    $0x40,%rsp
+  802fa7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802fa7 <read+0xb>
+  802fae:	49 bb 89 60 00 00 00 	movabs $0x6089,%r11
+  802fb5:	00 00 00 
+  802fb8:	4c 01 db             	add    %r11,%rbx
+  802fbb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802fbe:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802fc2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802fc6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802fca:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802fcd:	48 89 d6             	mov    %rdx,%rsi
+  802fd0:	89 c7                	mov    %eax,%edi
+  802fd2:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  802fd9:	ff ff ff 
+  802fdc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fe0:	ff d0                	call   *%rax
+  802fe2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fe5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fe9:	78 28                	js     803013 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802feb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fef:	8b 00                	mov    (%rax),%eax
+  802ff1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802ff5:	48 89 d6             	mov    %rdx,%rsi
+  802ff8:	89 c7                	mov    %eax,%edi
+  802ffa:	48 b8 cb 9b ff ff ff 	movabs $0xffffffffffff9bcb,%rax
+  803001:	ff ff ff 
+  803004:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803008:	ff d0                	call   *%rax
+  80300a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80300d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803011:	79 08                	jns    80301b <read+0x7f>
+		return r;
+  803013:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803016:	e9 8b 00 00 00       	jmp    8030a6 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80301b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80301f:	8b 40 08             	mov    0x8(%rax),%eax
+  803022:	83 e0 03             	and    $0x3,%eax
+  803025:	83 f8 01             	cmp    $0x1,%eax
+  803028:	75 4b                	jne    803075 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80302a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803031:	ff ff ff 
+  803034:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803038:	48 8b 00             	mov    (%rax),%rax
+  80303b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803041:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803044:	89 c6                	mov    %eax,%esi
+  803046:	48 b8 d7 dc ff ff ff 	movabs $0xffffffffffffdcd7,%rax
+  80304d:	ff ff ff 
+  803050:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803054:	48 89 c7             	mov    %rax,%rdi
+  803057:	49 89 df             	mov    %rbx,%r15
+  80305a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305f:	48 b9 ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rcx
+  803066:	ff ff ff 
+  803069:	48 01 d9             	add    %rbx,%rcx
+  80306c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80306e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803073:	eb 31                	jmp    8030a6 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803075:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803079:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80307d:	48 85 c0             	test   %rax,%rax
+  803080:	75 07                	jne    803089 <read+0xed>
+		return -E_NOT_SUPP;
+  803082:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803087:	eb 1d                	jmp    8030a6 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803089:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80308d:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803091:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803095:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803099:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80309d:	48 89 ce             	mov    %rcx,%rsi
+  8030a0:	48 89 c7             	mov    %rax,%rdi
+  8030a3:	41 ff d0             	call   *%r8
+}
+  8030a6:	48 83 c4 40          	add    $0x40,%rsp
+  8030aa:	5b                   	pop    %rbx
+  8030ab:	41 5f                	pop    %r15
+  8030ad:	5d                   	pop    %rbp
+  8030ae:	c3                   	ret
+
+00000000008030af <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8030af:	55                   	push   %rbp
+  8030b0:	48 89 e5             	mov    %rsp,%rbp
+  8030b3:	53                   	push   %rbx
+  8030b4:	48 83 ec 38          	sub    $0x38,%rsp
+  8030b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030b8 <readn+0x9>
+  8030bf:	49 bb 78 5f 00 00 00 	movabs $0x5f78,%r11
+  8030c6:	00 00 00 
+  8030c9:	4c 01 db             	add    %r11,%rbx
+  8030cc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030cf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8030d3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8030d7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8030de:	eb 4b                	jmp    80312b <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8030e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030e3:	48 98                	cltq
+  8030e5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8030e9:	48 29 c2             	sub    %rax,%rdx
+  8030ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030ef:	48 63 c8             	movslq %eax,%rcx
+  8030f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030f6:	48 01 c1             	add    %rax,%rcx
+  8030f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030fc:	48 89 ce             	mov    %rcx,%rsi
+  8030ff:	89 c7                	mov    %eax,%edi
+  803101:	48 b8 6c 9f ff ff ff 	movabs $0xffffffffffff9f6c,%rax
+  803108:	ff ff ff 
+  80310b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80310f:	ff d0                	call   *%rax
+  803111:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803114:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803118:	79 05                	jns    80311f <readn+0x70>
+			return m;
+  80311a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80311d:	eb 1d                	jmp    80313c <readn+0x8d>
+		if (m == 0)
+  80311f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803123:	74 13                	je     803138 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803125:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803128:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80312b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80312e:	48 98                	cltq
+  803130:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803134:	72 aa                	jb     8030e0 <readn+0x31>
+  803136:	eb 01                	jmp    803139 <readn+0x8a>
+			break;
+  803138:	90                   	nop
+	}
+	return tot;
+  803139:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80313c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803140:	c9                   	leave
+  803141:	c3                   	ret
+
+0000000000803142 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803142:	55                   	push   %rbp
+  803143:	48 89 e5             	mov    %rsp,%rbp
+  803146:	41 57                	push   %r15
+  803148:	53                   	push   %rbx
+  803149:	48 83 ec 40          	sub    $0x40,%rsp
+  80314d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80314d <write+0xb>
+  803154:	49 bb e3 5e 00 00 00 	movabs $0x5ee3,%r11
+  80315b:	00 00 00 
+  80315e:	4c 01 db             	add    %r11,%rbx
+  803161:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803164:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803168:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80316c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803170:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803173:	48 89 d6             	mov    %rdx,%rsi
+  803176:	89 c7                	mov    %eax,%edi
+  803178:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  80317f:	ff ff ff 
+  803182:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803186:	ff d0                	call   *%rax
+  803188:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80318b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80318f:	78 28                	js     8031b9 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803191:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803195:	8b 00                	mov    (%rax),%eax
+  803197:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80319b:	48 89 d6             	mov    %rdx,%rsi
+  80319e:	89 c7                	mov    %eax,%edi
+  8031a0:	48 b8 cb 9b ff ff ff 	movabs $0xffffffffffff9bcb,%rax
+  8031a7:	ff ff ff 
+  8031aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031ae:	ff d0                	call   *%rax
+  8031b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031b7:	79 08                	jns    8031c1 <write+0x7f>
+		return r;
+  8031b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031bc:	e9 8a 00 00 00       	jmp    80324b <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8031c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031c5:	8b 40 08             	mov    0x8(%rax),%eax
+  8031c8:	83 e0 03             	and    $0x3,%eax
+  8031cb:	85 c0                	test   %eax,%eax
+  8031cd:	75 4b                	jne    80321a <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031cf:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8031d6:	ff ff ff 
+  8031d9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031dd:	48 8b 00             	mov    (%rax),%rax
+  8031e0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8031e6:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8031e9:	89 c6                	mov    %eax,%esi
+  8031eb:	48 b8 f3 dc ff ff ff 	movabs $0xffffffffffffdcf3,%rax
+  8031f2:	ff ff ff 
+  8031f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031f9:	48 89 c7             	mov    %rax,%rdi
+  8031fc:	49 89 df             	mov    %rbx,%r15
+  8031ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803204:	48 b9 ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rcx
+  80320b:	ff ff ff 
+  80320e:	48 01 d9             	add    %rbx,%rcx
+  803211:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803213:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803218:	eb 31                	jmp    80324b <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80321a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80321e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803222:	48 85 c0             	test   %rax,%rax
+  803225:	75 07                	jne    80322e <write+0xec>
+		return -E_NOT_SUPP;
+  803227:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80322c:	eb 1d                	jmp    80324b <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  80322e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803232:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803236:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80323a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80323e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803242:	48 89 ce             	mov    %rcx,%rsi
+  803245:	48 89 c7             	mov    %rax,%rdi
+  803248:	41 ff d0             	call   *%r8
+}
+  80324b:	48 83 c4 40          	add    $0x40,%rsp
+  80324f:	5b                   	pop    %rbx
+  803250:	41 5f                	pop    %r15
+  803252:	5d                   	pop    %rbp
+  803253:	c3                   	ret
+
+0000000000803254 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803254:	55                   	push   %rbp
+  803255:	48 89 e5             	mov    %rsp,%rbp
+  803258:	48 83 ec 18          	sub    $0x18,%rsp
+  80325c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80325c <seek+0x8>
+  803263:	49 bb d4 5d 00 00 00 	movabs $0x5dd4,%r11
+  80326a:	00 00 00 
+  80326d:	4c 01 d8             	add    %r11,%rax
+  803270:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803273:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803276:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  80327a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80327d:	48 89 ce             	mov    %rcx,%rsi
+  803280:	89 d7                	mov    %edx,%edi
+  803282:	48 ba 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rdx
+  803289:	ff ff ff 
+  80328c:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803290:	ff d0                	call   *%rax
+  803292:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803295:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803299:	79 05                	jns    8032a0 <seek+0x4c>
+		return r;
+  80329b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80329e:	eb 0f                	jmp    8032af <seek+0x5b>
+	fd->fd_offset = offset;
+  8032a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032a4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8032a7:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8032aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032af:	c9                   	leave
+  8032b0:	c3                   	ret
+
+00000000008032b1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8032b1:	55                   	push   %rbp
+  8032b2:	48 89 e5             	mov    %rsp,%rbp
+  8032b5:	41 57                	push   %r15
+  8032b7:	53                   	push   %rbx
+  8032b8:	48 83 ec 30          	sub    $0x30,%rsp
+  8032bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032bc <ftruncate+0xb>
+  8032c3:	49 bb 74 5d 00 00 00 	movabs $0x5d74,%r11
+  8032ca:	00 00 00 
+  8032cd:	4c 01 db             	add    %r11,%rbx
+  8032d0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8032d3:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8032d6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8032da:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8032dd:	48 89 d6             	mov    %rdx,%rsi
+  8032e0:	89 c7                	mov    %eax,%edi
+  8032e2:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  8032e9:	ff ff ff 
+  8032ec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032f0:	ff d0                	call   *%rax
+  8032f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032f9:	78 28                	js     803323 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8032fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032ff:	8b 00                	mov    (%rax),%eax
+  803301:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803305:	48 89 d6             	mov    %rdx,%rsi
+  803308:	89 c7                	mov    %eax,%edi
+  80330a:	48 b8 cb 9b ff ff ff 	movabs $0xffffffffffff9bcb,%rax
+  803311:	ff ff ff 
+  803314:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803318:	ff d0                	call   *%rax
+  80331a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80331d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803321:	79 08                	jns    80332b <ftruncate+0x7a>
+		return r;
+  803323:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803326:	e9 83 00 00 00       	jmp    8033ae <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80332b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80332f:	8b 40 08             	mov    0x8(%rax),%eax
+  803332:	83 e0 03             	and    $0x3,%eax
+  803335:	85 c0                	test   %eax,%eax
+  803337:	75 4b                	jne    803384 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803339:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803340:	ff ff ff 
+  803343:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803347:	48 8b 00             	mov    (%rax),%rax
+  80334a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803350:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803353:	89 c6                	mov    %eax,%esi
+  803355:	48 b8 10 dd ff ff ff 	movabs $0xffffffffffffdd10,%rax
+  80335c:	ff ff ff 
+  80335f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803363:	48 89 c7             	mov    %rax,%rdi
+  803366:	49 89 df             	mov    %rbx,%r15
+  803369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80336e:	48 b9 ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rcx
+  803375:	ff ff ff 
+  803378:	48 01 d9             	add    %rbx,%rcx
+  80337b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80337d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803382:	eb 2a                	jmp    8033ae <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803384:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803388:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80338c:	48 85 c0             	test   %rax,%rax
+  80338f:	75 07                	jne    803398 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803391:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803396:	eb 16                	jmp    8033ae <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803398:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80339c:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8033a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033a4:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8033a7:	89 d6                	mov    %edx,%esi
+  8033a9:	48 89 c7             	mov    %rax,%rdi
+  8033ac:	ff d1                	call   *%rcx
+}
+  8033ae:	48 83 c4 30          	add    $0x30,%rsp
+  8033b2:	5b                   	pop    %rbx
+  8033b3:	41 5f                	pop    %r15
+  8033b5:	5d                   	pop    %rbp
+  8033b6:	c3                   	ret
+
+00000000008033b7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8033b7:	55                   	push   %rbp
+  8033b8:	48 89 e5             	mov    %rsp,%rbp
+  8033bb:	53                   	push   %rbx
+  8033bc:	48 83 ec 38          	sub    $0x38,%rsp
+  8033c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033c0 <fstat+0x9>
+  8033c7:	49 bb 70 5c 00 00 00 	movabs $0x5c70,%r11
+  8033ce:	00 00 00 
+  8033d1:	4c 01 db             	add    %r11,%rbx
+  8033d4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8033d7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8033db:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8033df:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8033e2:	48 89 d6             	mov    %rdx,%rsi
+  8033e5:	89 c7                	mov    %eax,%edi
+  8033e7:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  8033ee:	ff ff ff 
+  8033f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033f5:	ff d0                	call   *%rax
+  8033f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8033fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033fe:	78 28                	js     803428 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803400:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803404:	8b 00                	mov    (%rax),%eax
+  803406:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80340a:	48 89 d6             	mov    %rdx,%rsi
+  80340d:	89 c7                	mov    %eax,%edi
+  80340f:	48 b8 cb 9b ff ff ff 	movabs $0xffffffffffff9bcb,%rax
+  803416:	ff ff ff 
+  803419:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80341d:	ff d0                	call   *%rax
+  80341f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803422:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803426:	79 05                	jns    80342d <fstat+0x76>
+		return r;
+  803428:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80342b:	eb 5e                	jmp    80348b <fstat+0xd4>
+	if (!dev->dev_stat)
+  80342d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803431:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803435:	48 85 c0             	test   %rax,%rax
+  803438:	75 07                	jne    803441 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80343a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80343f:	eb 4a                	jmp    80348b <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803441:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803445:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803448:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80344c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803453:	00 00 00 
+	stat->st_isdir = 0;
+  803456:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80345a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803461:	00 00 00 
+	stat->st_dev = dev;
+  803464:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803468:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80346c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  803473:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803477:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80347b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80347f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803483:	48 89 d6             	mov    %rdx,%rsi
+  803486:	48 89 c7             	mov    %rax,%rdi
+  803489:	ff d1                	call   *%rcx
+}
+  80348b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80348f:	c9                   	leave
+  803490:	c3                   	ret
+
+0000000000803491 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803491:	55                   	push   %rbp
+  803492:	48 89 e5             	mov    %rsp,%rbp
+  803495:	41 57                	push   %r15
+  803497:	53                   	push   %rbx
+  803498:	48 83 ec 20          	sub    $0x20,%rsp
+  80349c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80349c <stat+0xb>
+  8034a3:	49 bb 94 5b 00 00 00 	movabs $0x5b94,%r11
+  8034aa:	00 00 00 
+  8034ad:	4c 01 db             	add    %r11,%rbx
+  8034b0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8034b4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8034b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8034c1:	48 89 c7             	mov    %rax,%rdi
+  8034c4:	49 89 df             	mov    %rbx,%r15
+  8034c7:	48 b8 3b a7 ff ff ff 	movabs $0xffffffffffffa73b,%rax
+  8034ce:	ff ff ff 
+  8034d1:	48 01 d8             	add    %rbx,%rax
+  8034d4:	ff d0                	call   *%rax
+  8034d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034dd:	79 05                	jns    8034e4 <stat+0x53>
+		return fd;
+  8034df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034e2:	eb 37                	jmp    80351b <stat+0x8a>
+	r = fstat(fd, stat);
+  8034e4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034eb:	48 89 d6             	mov    %rdx,%rsi
+  8034ee:	89 c7                	mov    %eax,%edi
+  8034f0:	48 b8 87 a3 ff ff ff 	movabs $0xffffffffffffa387,%rax
+  8034f7:	ff ff ff 
+  8034fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034fe:	ff d0                	call   *%rax
+  803500:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803503:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803506:	89 c7                	mov    %eax,%edi
+  803508:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  80350f:	ff ff ff 
+  803512:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803516:	ff d0                	call   *%rax
+	return r;
+  803518:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  80351b:	48 83 c4 20          	add    $0x20,%rsp
+  80351f:	5b                   	pop    %rbx
+  803520:	41 5f                	pop    %r15
+  803522:	5d                   	pop    %rbp
+  803523:	c3                   	ret
+
+0000000000803524 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803524:	55                   	push   %rbp
+  803525:	48 89 e5             	mov    %rsp,%rbp
+  803528:	41 57                	push   %r15
+  80352a:	53                   	push   %rbx
+  80352b:	48 83 ec 10          	sub    $0x10,%rsp
+  80352f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80352f <fsipc+0xb>
+  803536:	49 bb 01 5b 00 00 00 	movabs $0x5b01,%r11
+  80353d:	00 00 00 
+  803540:	4c 01 db             	add    %r11,%rbx
+  803543:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803546:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80354a:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803551:	00 00 00 
+  803554:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803557:	85 c0                	test   %eax,%eax
+  803559:	75 24                	jne    80357f <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80355b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803560:	49 89 df             	mov    %rbx,%r15
+  803563:	48 b8 94 d0 ff ff ff 	movabs $0xffffffffffffd094,%rax
+  80356a:	ff ff ff 
+  80356d:	48 01 d8             	add    %rbx,%rax
+  803570:	ff d0                	call   *%rax
+  803572:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803579:	00 00 00 
+  80357c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  80357f:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803586:	00 00 00 
+  803589:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80358c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803590:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803593:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803599:	49 89 d0             	mov    %rdx,%r8
+  80359c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8035a1:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8035a8:	00 00 00 
+  8035ab:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8035af:	89 c7                	mov    %eax,%edi
+  8035b1:	49 89 df             	mov    %rbx,%r15
+  8035b4:	48 b8 b3 ca ff ff ff 	movabs $0xffffffffffffcab3,%rax
+  8035bb:	ff ff ff 
+  8035be:	48 01 d8             	add    %rbx,%rax
+  8035c1:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8035c3:	48 83 c4 10          	add    $0x10,%rsp
+  8035c7:	5b                   	pop    %rbx
+  8035c8:	41 5f                	pop    %r15
+  8035ca:	5d                   	pop    %rbp
+  8035cb:	c3                   	ret
+
+00000000008035cc <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8035cc:	55                   	push   %rbp
+  8035cd:	48 89 e5             	mov    %rsp,%rbp
+  8035d0:	41 57                	push   %r15
+  8035d2:	53                   	push   %rbx
+  8035d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8035d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035d7 <fsipc_words+0xb>
+  8035de:	49 bb 59 5a 00 00 00 	movabs $0x5a59,%r11
+  8035e5:	00 00 00 
+  8035e8:	4c 01 db             	add    %r11,%rbx
+  8035eb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035ee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8035f2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8035f6:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8035fd:	00 00 00 
+  803600:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803603:	85 c0                	test   %eax,%eax
+  803605:	75 24                	jne    80362b <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803607:	bf 01 00 00 00       	mov    $0x1,%edi
+  80360c:	49 89 df             	mov    %rbx,%r15
+  80360f:	48 b8 94 d0 ff ff ff 	movabs $0xffffffffffffd094,%rax
+  803616:	ff ff ff 
+  803619:	48 01 d8             	add    %rbx,%rax
+  80361c:	ff d0                	call   *%rax
+  80361e:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803625:	00 00 00 
+  803628:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  80362b:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803632:	00 00 00 
+  803635:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803638:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80363c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803640:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803643:	89 c7                	mov    %eax,%edi
+  803645:	49 89 df             	mov    %rbx,%r15
+  803648:	48 b8 9e cb ff ff ff 	movabs $0xffffffffffffcb9e,%rax
+  80364f:	ff ff ff 
+  803652:	48 01 d8             	add    %rbx,%rax
+  803655:	ff d0                	call   *%rax
+}
+  803657:	48 83 c4 20          	add    $0x20,%rsp
+  80365b:	5b                   	pop    %rbx
+  80365c:	41 5f                	pop    %r15
+  80365e:	5d                   	pop    %rbp
+  80365f:	c3                   	ret
+
+0000000000803660 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803660:	55                   	push   %rbp
+  803661:	48 89 e5             	mov    %rsp,%rbp
+  803664:	41 57                	push   %r15
+  803666:	53                   	push   %rbx
+  803667:	48 83 ec 40          	sub    $0x40,%rsp
+  80366b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80366b <fsipc_pages+0xb>
+  803672:	49 bb c5 59 00 00 00 	movabs $0x59c5,%r11
+  803679:	00 00 00 
+  80367c:	4c 01 db             	add    %r11,%rbx
+  80367f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803682:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803686:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  80368a:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  80368d:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803694:	00 00 00 
+  803697:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80369a:	85 c0                	test   %eax,%eax
+  80369c:	75 24                	jne    8036c2 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80369e:	bf 01 00 00 00       	mov    $0x1,%edi
+  8036a3:	49 89 df             	mov    %rbx,%r15
+  8036a6:	48 b8 94 d0 ff ff ff 	movabs $0xffffffffffffd094,%rax
+  8036ad:	ff ff ff 
+  8036b0:	48 01 d8             	add    %rbx,%rax
+  8036b3:	ff d0                	call   *%rax
+  8036b5:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8036bc:	00 00 00 
+  8036bf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8036c2:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8036c7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8036cb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8036ce:	48 98                	cltq
+  8036d0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8036d4:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8036d8:	0f 95 c0             	setne  %al
+  8036db:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  8036de:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8036e5:	00 
+  8036e6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8036ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036ee:	48 01 d0             	add    %rdx,%rax
+  8036f1:	48 83 e8 01          	sub    $0x1,%rax
+  8036f5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8036f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803702:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803706:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80370a:	48 29 d0             	sub    %rdx,%rax
+  80370d:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803711:	41 89 c2             	mov    %eax,%r10d
+  803714:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80371b:	00 00 00 
+  80371e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803721:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  803725:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803729:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80372c:	48 83 ec 08          	sub    $0x8,%rsp
+  803730:	6a 40                	push   $0x40
+  803732:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803737:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  80373e:	00 
+  80373f:	6a 05                	push   $0x5
+  803741:	41 89 f9             	mov    %edi,%r9d
+  803744:	49 89 c8             	mov    %rcx,%r8
+  803747:	44 89 d1             	mov    %r10d,%ecx
+  80374a:	89 c7                	mov    %eax,%edi
+  80374c:	49 89 df             	mov    %rbx,%r15
+  80374f:	48 b8 9c cc ff ff ff 	movabs $0xffffffffffffcc9c,%rax
+  803756:	ff ff ff 
+  803759:	48 01 d8             	add    %rbx,%rax
+  80375c:	ff d0                	call   *%rax
+  80375e:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  803762:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803766:	5b                   	pop    %rbx
+  803767:	41 5f                	pop    %r15
+  803769:	5d                   	pop    %rbp
+  80376a:	c3                   	ret
+
+000000000080376b <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  80376b:	55                   	push   %rbp
+  80376c:	48 89 e5             	mov    %rsp,%rbp
+  80376f:	41 57                	push   %r15
+  803771:	53                   	push   %rbx
+  803772:	48 83 ec 20          	sub    $0x20,%rsp
+  803776:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803776 <open+0xb>
+  80377d:	49 bb ba 58 00 00 00 	movabs $0x58ba,%r11
+  803784:	00 00 00 
+  803787:	4c 01 db             	add    %r11,%rbx
+  80378a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80378e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  803791:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803795:	48 89 c7             	mov    %rax,%rdi
+  803798:	49 89 df             	mov    %rbx,%r15
+  80379b:	48 b8 fc 83 ff ff ff 	movabs $0xffffffffffff83fc,%rax
+  8037a2:	ff ff ff 
+  8037a5:	48 01 d8             	add    %rbx,%rax
+  8037a8:	ff d0                	call   *%rax
+  8037aa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8037af:	7e 0a                	jle    8037bb <open+0x50>
+		return -E_BAD_PATH;
+  8037b1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8037b6:	e9 18 01 00 00       	jmp    8038d3 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8037bb:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8037bf:	48 89 c7             	mov    %rax,%rdi
+  8037c2:	49 89 df             	mov    %rbx,%r15
+  8037c5:	48 b8 6f 99 ff ff ff 	movabs $0xffffffffffff996f,%rax
+  8037cc:	ff ff ff 
+  8037cf:	48 01 d8             	add    %rbx,%rax
+  8037d2:	ff d0                	call   *%rax
+  8037d4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037d7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037db:	74 08                	je     8037e5 <open+0x7a>
+		return r;
+  8037dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037e0:	e9 ee 00 00 00       	jmp    8038d3 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8037e5:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8037ec:	00 00 00 
+  8037ef:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8037f2:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8037f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037fd:	48 89 c6             	mov    %rax,%rsi
+  803800:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803807:	00 00 00 
+  80380a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80380e:	48 89 c7             	mov    %rax,%rdi
+  803811:	49 89 df             	mov    %rbx,%r15
+  803814:	48 b8 90 84 ff ff ff 	movabs $0xffffffffffff8490,%rax
+  80381b:	ff ff ff 
+  80381e:	48 01 d8             	add    %rbx,%rax
+  803821:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803823:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803827:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  80382c:	48 89 c6             	mov    %rax,%rsi
+  80382f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803834:	49 89 df             	mov    %rbx,%r15
+  803837:	48 b8 4c 91 ff ff ff 	movabs $0xffffffffffff914c,%rax
+  80383e:	ff ff ff 
+  803841:	48 01 d8             	add    %rbx,%rax
+  803844:	ff d0                	call   *%rax
+  803846:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803849:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80384d:	74 23                	je     803872 <open+0x107>
+		fd_close(fd,0);
+  80384f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803853:	be 00 00 00 00       	mov    $0x0,%esi
+  803858:	48 89 c7             	mov    %rax,%rdi
+  80385b:	49 89 df             	mov    %rbx,%r15
+  80385e:	48 b8 d0 9a ff ff ff 	movabs $0xffffffffffff9ad0,%rax
+  803865:	ff ff ff 
+  803868:	48 01 d8             	add    %rbx,%rax
+  80386b:	ff d0                	call   *%rax
+		return r;
+  80386d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803870:	eb 61                	jmp    8038d3 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  803872:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803876:	48 89 c6             	mov    %rax,%rsi
+  803879:	bf 01 00 00 00       	mov    $0x1,%edi
+  80387e:	48 b8 f4 a4 ff ff ff 	movabs $0xffffffffffffa4f4,%rax
+  803885:	ff ff ff 
+  803888:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80388c:	ff d0                	call   *%rax
+  80388e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803891:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803895:	74 23                	je     8038ba <open+0x14f>
+		fd_close(fd,0);
+  803897:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80389b:	be 00 00 00 00       	mov    $0x0,%esi
+  8038a0:	48 89 c7             	mov    %rax,%rdi
+  8038a3:	49 89 df             	mov    %rbx,%r15
+  8038a6:	48 b8 d0 9a ff ff ff 	movabs $0xffffffffffff9ad0,%rax
+  8038ad:	ff ff ff 
+  8038b0:	48 01 d8             	add    %rbx,%rax
+  8038b3:	ff d0                	call   *%rax
+		return r;
+  8038b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038b8:	eb 19                	jmp    8038d3 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8038ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038be:	48 89 c7             	mov    %rax,%rdi
+  8038c1:	49 89 df             	mov    %rbx,%r15
+  8038c4:	48 b8 f5 98 ff ff ff 	movabs $0xffffffffffff98f5,%rax
+  8038cb:	ff ff ff 
+  8038ce:	48 01 d8             	add    %rbx,%rax
+  8038d1:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8038d3:	48 83 c4 20          	add    $0x20,%rsp
+  8038d7:	5b                   	pop    %rbx
+  8038d8:	41 5f                	pop    %r15
+  8038da:	5d                   	pop    %rbp
+  8038db:	c3                   	ret
+
+00000000008038dc <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8038dc:	55                   	push   %rbp
+  8038dd:	48 89 e5             	mov    %rsp,%rbp
+  8038e0:	48 83 ec 20          	sub    $0x20,%rsp
+  8038e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038e4 <devfile_flush+0x8>
+  8038eb:	49 bb 4c 57 00 00 00 	movabs $0x574c,%r11
+  8038f2:	00 00 00 
+  8038f5:	4c 01 d8             	add    %r11,%rax
+  8038f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8038fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803900:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803903:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803906:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80390a:	ba 04 00 00 00       	mov    $0x4,%edx
+  80390f:	48 89 ce             	mov    %rcx,%rsi
+  803912:	bf 06 00 00 00       	mov    $0x6,%edi
+  803917:	48 b9 9c a5 ff ff ff 	movabs $0xffffffffffffa59c,%rcx
+  80391e:	ff ff ff 
+  803921:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803925:	ff d0                	call   *%rax
+}
+  803927:	c9                   	leave
+  803928:	c3                   	ret
+
+0000000000803929 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803929:	55                   	push   %rbp
+  80392a:	48 89 e5             	mov    %rsp,%rbp
+  80392d:	41 57                	push   %r15
+  80392f:	53                   	push   %rbx
+  803930:	48 83 ec 60          	sub    $0x60,%rsp
+  803934:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803934 <devfile_read+0xb>
+  80393b:	49 bb fc 56 00 00 00 	movabs $0x56fc,%r11
+  803942:	00 00 00 
+  803945:	4c 01 db             	add    %r11,%rbx
+  803948:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80394c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803950:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  803954:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803958:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  80395c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803960:	8b 50 0c             	mov    0xc(%rax),%edx
+  803963:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803967:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803969:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80396d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  803971:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  803975:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803979:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80397e:	ba 10 00 00 00       	mov    $0x10,%edx
+  803983:	48 89 c6             	mov    %rax,%rsi
+  803986:	bf 03 00 00 00       	mov    $0x3,%edi
+  80398b:	48 b8 30 a6 ff ff ff 	movabs $0xffffffffffffa630,%rax
+  803992:	ff ff ff 
+  803995:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803999:	ff d0                	call   *%rax
+  80399b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80399e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8039a2:	79 05                	jns    8039a9 <devfile_read+0x80>
+		return r;
+  8039a4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8039a7:	eb 64                	jmp    803a0d <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8039a9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8039ac:	48 63 d0             	movslq %eax,%rdx
+  8039af:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039b3:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8039b8:	48 01 c1             	add    %rax,%rcx
+  8039bb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8039bf:	48 89 ce             	mov    %rcx,%rsi
+  8039c2:	48 89 c7             	mov    %rax,%rdi
+  8039c5:	49 89 df             	mov    %rbx,%r15
+  8039c8:	48 b8 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rax
+  8039cf:	ff ff ff 
+  8039d2:	48 01 d8             	add    %rbx,%rax
+  8039d5:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8039d7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8039de:	ff ff ff 
+  8039e1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039e5:	48 8b 00             	mov    (%rax),%rax
+  8039e8:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8039ee:	89 c6                	mov    %eax,%esi
+  8039f0:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8039f5:	48 89 c7             	mov    %rax,%rdi
+  8039f8:	49 89 df             	mov    %rbx,%r15
+  8039fb:	48 b8 4e d0 ff ff ff 	movabs $0xffffffffffffd04e,%rax
+  803a02:	ff ff ff 
+  803a05:	48 01 d8             	add    %rbx,%rax
+  803a08:	ff d0                	call   *%rax
+	return r;
+  803a0a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803a0d:	48 83 c4 60          	add    $0x60,%rsp
+  803a11:	5b                   	pop    %rbx
+  803a12:	41 5f                	pop    %r15
+  803a14:	5d                   	pop    %rbp
+  803a15:	c3                   	ret
+
+0000000000803a16 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803a16:	55                   	push   %rbp
+  803a17:	48 89 e5             	mov    %rsp,%rbp
+  803a1a:	41 57                	push   %r15
+  803a1c:	53                   	push   %rbx
+  803a1d:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803a21:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a21 <devfile_write+0xb>
+  803a28:	49 bb 0f 56 00 00 00 	movabs $0x560f,%r11
+  803a2f:	00 00 00 
+  803a32:	4c 01 db             	add    %r11,%rbx
+  803a35:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803a39:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803a3d:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803a44:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803a48:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803a4c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803a53:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803a57:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803a5e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a61:	48 63 d0             	movslq %eax,%rdx
+  803a64:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a68:	48 39 c2             	cmp    %rax,%rdx
+  803a6b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803a6f:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803a76:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803a7d:	00 
+  803a7e:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803a85:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a89:	48 01 d0             	add    %rdx,%rax
+  803a8c:	48 83 e8 01          	sub    $0x1,%rax
+  803a90:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803a94:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a98:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a9d:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803aa1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803aa5:	48 29 d0             	sub    %rdx,%rax
+  803aa8:	48 c1 e8 0c          	shr    $0xc,%rax
+  803aac:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803aaf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803ab2:	89 c6                	mov    %eax,%esi
+  803ab4:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803ab9:	48 89 c7             	mov    %rax,%rdi
+  803abc:	49 89 df             	mov    %rbx,%r15
+  803abf:	48 b8 08 d0 ff ff ff 	movabs $0xffffffffffffd008,%rax
+  803ac6:	ff ff ff 
+  803ac9:	48 01 d8             	add    %rbx,%rax
+  803acc:	ff d0                	call   *%rax
+  803ace:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803ad1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803ad5:	79 08                	jns    803adf <devfile_write+0xc9>
+		return r;
+  803ad7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803ada:	e9 8f 00 00 00       	jmp    803b6e <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803adf:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803ae6:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803aea:	48 89 c6             	mov    %rax,%rsi
+  803aed:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803af2:	48 89 c7             	mov    %rax,%rdi
+  803af5:	49 89 df             	mov    %rbx,%r15
+  803af8:	48 b8 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rax
+  803aff:	ff ff ff 
+  803b02:	48 01 d8             	add    %rbx,%rax
+  803b05:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803b07:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803b0b:	8b 50 0c             	mov    0xc(%rax),%edx
+  803b0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b12:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b18:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b1f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803b23:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803b26:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803b2a:	89 d1                	mov    %edx,%ecx
+  803b2c:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b31:	48 89 c6             	mov    %rax,%rsi
+  803b34:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b39:	48 b8 30 a6 ff ff ff 	movabs $0xffffffffffffa630,%rax
+  803b40:	ff ff ff 
+  803b43:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b47:	ff d0                	call   *%rax
+  803b49:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803b4c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803b4f:	89 c6                	mov    %eax,%esi
+  803b51:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b56:	48 89 c7             	mov    %rax,%rdi
+  803b59:	49 89 df             	mov    %rbx,%r15
+  803b5c:	48 b8 4e d0 ff ff ff 	movabs $0xffffffffffffd04e,%rax
+  803b63:	ff ff ff 
+  803b66:	48 01 d8             	add    %rbx,%rax
+  803b69:	ff d0                	call   *%rax
+	return r;
+  803b6b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803b6e:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803b72:	5b                   	pop    %rbx
+  803b73:	41 5f                	pop    %r15
+  803b75:	5d                   	pop    %rbp
+  803b76:	c3                   	ret
+
+0000000000803b77 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803b77:	55                   	push   %rbp
+  803b78:	48 89 e5             	mov    %rsp,%rbp
+  803b7b:	41 57                	push   %r15
+  803b7d:	53                   	push   %rbx
+  803b7e:	48 83 ec 20          	sub    $0x20,%rsp
+  803b82:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b82 <devfile_stat+0xb>
+  803b89:	49 bb ae 54 00 00 00 	movabs $0x54ae,%r11
+  803b90:	00 00 00 
+  803b93:	4c 01 db             	add    %r11,%rbx
+  803b96:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803b9a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803b9e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ba2:	8b 40 0c             	mov    0xc(%rax),%eax
+  803ba5:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803bac:	00 00 00 
+  803baf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803bb2:	be 00 00 00 00       	mov    $0x0,%esi
+  803bb7:	bf 05 00 00 00       	mov    $0x5,%edi
+  803bbc:	48 b8 f4 a4 ff ff ff 	movabs $0xffffffffffffa4f4,%rax
+  803bc3:	ff ff ff 
+  803bc6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bca:	ff d0                	call   *%rax
+  803bcc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bcf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bd3:	79 05                	jns    803bda <devfile_stat+0x63>
+		return r;
+  803bd5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bd8:	eb 65                	jmp    803c3f <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803bda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bde:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803be5:	00 00 00 
+  803be8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803bec:	48 89 d6             	mov    %rdx,%rsi
+  803bef:	48 89 c7             	mov    %rax,%rdi
+  803bf2:	49 89 df             	mov    %rbx,%r15
+  803bf5:	48 b8 90 84 ff ff ff 	movabs $0xffffffffffff8490,%rax
+  803bfc:	ff ff ff 
+  803bff:	48 01 d8             	add    %rbx,%rax
+  803c02:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803c04:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803c0b:	00 00 00 
+  803c0e:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803c15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c19:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c1f:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803c26:	00 00 00 
+  803c29:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803c30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c34:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c3f:	48 83 c4 20          	add    $0x20,%rsp
+  803c43:	5b                   	pop    %rbx
+  803c44:	41 5f                	pop    %r15
+  803c46:	5d                   	pop    %rbp
+  803c47:	c3                   	ret
+
+0000000000803c48 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803c48:	55                   	push   %rbp
+  803c49:	48 89 e5             	mov    %rsp,%rbp
+  803c4c:	48 83 ec 20          	sub    $0x20,%rsp
+  803c50:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c50 <devfile_trunc+0x8>
+  803c57:	49 bb e0 53 00 00 00 	movabs $0x53e0,%r11
+  803c5e:	00 00 00 
+  803c61:	4c 01 d8             	add    %r11,%rax
+  803c64:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c68:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803c6b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803c6f:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803c72:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803c75:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803c78:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803c7b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803c7f:	ba 08 00 00 00       	mov    $0x8,%edx
+  803c84:	48 89 ce             	mov    %rcx,%rsi
+  803c87:	bf 02 00 00 00       	mov    $0x2,%edi
+  803c8c:	48 b9 9c a5 ff ff ff 	movabs $0xffffffffffffa59c,%rcx
+  803c93:	ff ff ff 
+  803c96:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803c9a:	ff d0                	call   *%rax
+}
+  803c9c:	c9                   	leave
+  803c9d:	c3                   	ret
+
+0000000000803c9e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803c9e:	55                   	push   %rbp
+  803c9f:	48 89 e5             	mov    %rsp,%rbp
+  803ca2:	41 57                	push   %r15
+  803ca4:	53                   	push   %rbx
+  803ca5:	48 83 ec 10          	sub    $0x10,%rsp
+  803ca9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ca9 <remove+0xb>
+  803cb0:	49 bb 87 53 00 00 00 	movabs $0x5387,%r11
+  803cb7:	00 00 00 
+  803cba:	4c 01 db             	add    %r11,%rbx
+  803cbd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803cc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cc5:	48 89 c7             	mov    %rax,%rdi
+  803cc8:	49 89 df             	mov    %rbx,%r15
+  803ccb:	48 b8 fc 83 ff ff ff 	movabs $0xffffffffffff83fc,%rax
+  803cd2:	ff ff ff 
+  803cd5:	48 01 d8             	add    %rbx,%rax
+  803cd8:	ff d0                	call   *%rax
+  803cda:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803cdf:	7e 07                	jle    803ce8 <remove+0x4a>
+		return -E_BAD_PATH;
+  803ce1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803ce6:	eb 44                	jmp    803d2c <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803ce8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cec:	48 89 c6             	mov    %rax,%rsi
+  803cef:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803cf6:	00 00 00 
+  803cf9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cfd:	48 89 c7             	mov    %rax,%rdi
+  803d00:	49 89 df             	mov    %rbx,%r15
+  803d03:	48 b8 90 84 ff ff ff 	movabs $0xffffffffffff8490,%rax
+  803d0a:	ff ff ff 
+  803d0d:	48 01 d8             	add    %rbx,%rax
+  803d10:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803d12:	be 00 00 00 00       	mov    $0x0,%esi
+  803d17:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d1c:	48 b8 f4 a4 ff ff ff 	movabs $0xffffffffffffa4f4,%rax
+  803d23:	ff ff ff 
+  803d26:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d2a:	ff d0                	call   *%rax
+}
+  803d2c:	48 83 c4 10          	add    $0x10,%rsp
+  803d30:	5b                   	pop    %rbx
+  803d31:	41 5f                	pop    %r15
+  803d33:	5d                   	pop    %rbp
+  803d34:	c3                   	ret
+
+0000000000803d35 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803d35:	55                   	push   %rbp
+  803d36:	48 89 e5             	mov    %rsp,%rbp
+  803d39:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d39 <sync+0x4>
+  803d40:	49 bb f7 52 00 00 00 	movabs $0x52f7,%r11
+  803d47:	00 00 00 
+  803d4a:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803d4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d52:	be 00 00 00 00       	mov    $0x0,%esi
+  803d57:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d5c:	48 b9 9c a5 ff ff ff 	movabs $0xffffffffffffa59c,%rcx
+  803d63:	ff ff ff 
+  803d66:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803d6a:	ff d0                	call   *%rax
+}
+  803d6c:	5d                   	pop    %rbp
+  803d6d:	c3                   	ret
+
+0000000000803d6e <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803d6e:	55                   	push   %rbp
+  803d6f:	48 89 e5             	mov    %rsp,%rbp
+  803d72:	41 57                	push   %r15
+  803d74:	53                   	push   %rbx
+  803d75:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803d7c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d7c <copy+0xe>
+  803d83:	49 bb b4 52 00 00 00 	movabs $0x52b4,%r11
+  803d8a:	00 00 00 
+  803d8d:	4c 01 db             	add    %r11,%rbx
+  803d90:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803d97:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803d9e:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803da5:	be 00 00 00 00       	mov    $0x0,%esi
+  803daa:	48 89 c7             	mov    %rax,%rdi
+  803dad:	48 b8 3b a7 ff ff ff 	movabs $0xffffffffffffa73b,%rax
+  803db4:	ff ff ff 
+  803db7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dbb:	ff d0                	call   *%rax
+  803dbd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803dc0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803dc4:	79 35                	jns    803dfb <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803dc6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dc9:	89 c6                	mov    %eax,%esi
+  803dcb:	48 b8 36 dd ff ff ff 	movabs $0xffffffffffffdd36,%rax
+  803dd2:	ff ff ff 
+  803dd5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dd9:	48 89 c7             	mov    %rax,%rdi
+  803ddc:	49 89 df             	mov    %rbx,%r15
+  803ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de4:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  803deb:	ff ff ff 
+  803dee:	48 01 da             	add    %rbx,%rdx
+  803df1:	ff d2                	call   *%rdx
+		return fd_src;
+  803df3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803df6:	e9 d7 01 00 00       	jmp    803fd2 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803dfb:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803e02:	be 01 01 00 00       	mov    $0x101,%esi
+  803e07:	48 89 c7             	mov    %rax,%rdi
+  803e0a:	48 b8 3b a7 ff ff ff 	movabs $0xffffffffffffa73b,%rax
+  803e11:	ff ff ff 
+  803e14:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e18:	ff d0                	call   *%rax
+  803e1a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803e1d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803e21:	0f 89 df 00 00 00    	jns    803f06 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803e27:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e2a:	89 c6                	mov    %eax,%esi
+  803e2c:	48 b8 4c dd ff ff ff 	movabs $0xffffffffffffdd4c,%rax
+  803e33:	ff ff ff 
+  803e36:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e3a:	48 89 c7             	mov    %rax,%rdi
+  803e3d:	49 89 df             	mov    %rbx,%r15
+  803e40:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e45:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  803e4c:	ff ff ff 
+  803e4f:	48 01 da             	add    %rbx,%rdx
+  803e52:	ff d2                	call   *%rdx
+		close(fd_src);
+  803e54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e57:	89 c7                	mov    %eax,%edi
+  803e59:	49 89 df             	mov    %rbx,%r15
+  803e5c:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  803e63:	ff ff ff 
+  803e66:	48 01 d8             	add    %rbx,%rax
+  803e69:	ff d0                	call   *%rax
+		return fd_dest;
+  803e6b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e6e:	e9 5f 01 00 00       	jmp    803fd2 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803e73:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803e76:	48 63 d0             	movslq %eax,%rdx
+  803e79:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803e80:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e83:	48 89 ce             	mov    %rcx,%rsi
+  803e86:	89 c7                	mov    %eax,%edi
+  803e88:	49 89 df             	mov    %rbx,%r15
+  803e8b:	48 b8 12 a1 ff ff ff 	movabs $0xffffffffffffa112,%rax
+  803e92:	ff ff ff 
+  803e95:	48 01 d8             	add    %rbx,%rax
+  803e98:	ff d0                	call   *%rax
+  803e9a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803e9d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803ea1:	79 63                	jns    803f06 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803ea3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803ea6:	89 c6                	mov    %eax,%esi
+  803ea8:	48 b8 66 dd ff ff ff 	movabs $0xffffffffffffdd66,%rax
+  803eaf:	ff ff ff 
+  803eb2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eb6:	48 89 c7             	mov    %rax,%rdi
+  803eb9:	49 89 df             	mov    %rbx,%r15
+  803ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec1:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  803ec8:	ff ff ff 
+  803ecb:	48 01 da             	add    %rbx,%rdx
+  803ece:	ff d2                	call   *%rdx
+			close(fd_src);
+  803ed0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ed3:	89 c7                	mov    %eax,%edi
+  803ed5:	49 89 df             	mov    %rbx,%r15
+  803ed8:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  803edf:	ff ff ff 
+  803ee2:	48 01 d8             	add    %rbx,%rax
+  803ee5:	ff d0                	call   *%rax
+			close(fd_dest);
+  803ee7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803eea:	89 c7                	mov    %eax,%edi
+  803eec:	49 89 df             	mov    %rbx,%r15
+  803eef:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  803ef6:	ff ff ff 
+  803ef9:	48 01 d8             	add    %rbx,%rax
+  803efc:	ff d0                	call   *%rax
+			return write_size;
+  803efe:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803f01:	e9 cc 00 00 00       	jmp    803fd2 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803f06:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803f0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f10:	ba 00 02 00 00       	mov    $0x200,%edx
+  803f15:	48 89 ce             	mov    %rcx,%rsi
+  803f18:	89 c7                	mov    %eax,%edi
+  803f1a:	49 89 df             	mov    %rbx,%r15
+  803f1d:	48 b8 6c 9f ff ff ff 	movabs $0xffffffffffff9f6c,%rax
+  803f24:	ff ff ff 
+  803f27:	48 01 d8             	add    %rbx,%rax
+  803f2a:	ff d0                	call   *%rax
+  803f2c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803f2f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f33:	0f 8f 3a ff ff ff    	jg     803e73 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803f39:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f3d:	79 60                	jns    803f9f <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803f3f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f42:	89 c6                	mov    %eax,%esi
+  803f44:	48 b8 79 dd ff ff ff 	movabs $0xffffffffffffdd79,%rax
+  803f4b:	ff ff ff 
+  803f4e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f52:	48 89 c7             	mov    %rax,%rdi
+  803f55:	49 89 df             	mov    %rbx,%r15
+  803f58:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f5d:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  803f64:	ff ff ff 
+  803f67:	48 01 da             	add    %rbx,%rdx
+  803f6a:	ff d2                	call   *%rdx
+		close(fd_src);
+  803f6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f6f:	89 c7                	mov    %eax,%edi
+  803f71:	49 89 df             	mov    %rbx,%r15
+  803f74:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  803f7b:	ff ff ff 
+  803f7e:	48 01 d8             	add    %rbx,%rax
+  803f81:	ff d0                	call   *%rax
+		close(fd_dest);
+  803f83:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f86:	89 c7                	mov    %eax,%edi
+  803f88:	49 89 df             	mov    %rbx,%r15
+  803f8b:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  803f92:	ff ff ff 
+  803f95:	48 01 d8             	add    %rbx,%rax
+  803f98:	ff d0                	call   *%rax
+		return read_size;
+  803f9a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f9d:	eb 33                	jmp    803fd2 <copy+0x264>
+	}
+	close(fd_src);
+  803f9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fa2:	89 c7                	mov    %eax,%edi
+  803fa4:	49 89 df             	mov    %rbx,%r15
+  803fa7:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  803fae:	ff ff ff 
+  803fb1:	48 01 d8             	add    %rbx,%rax
+  803fb4:	ff d0                	call   *%rax
+	close(fd_dest);
+  803fb6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803fb9:	89 c7                	mov    %eax,%edi
+  803fbb:	49 89 df             	mov    %rbx,%r15
+  803fbe:	48 b8 b4 9c ff ff ff 	movabs $0xffffffffffff9cb4,%rax
+  803fc5:	ff ff ff 
+  803fc8:	48 01 d8             	add    %rbx,%rax
+  803fcb:	ff d0                	call   *%rax
+	return 0;
+  803fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803fd2:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803fd9:	5b                   	pop    %rbx
+  803fda:	41 5f                	pop    %r15
+  803fdc:	5d                   	pop    %rbp
+  803fdd:	c3                   	ret
+
+0000000000803fde <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  803fde:	55                   	push   %rbp
+  803fdf:	48 89 e5             	mov    %rsp,%rbp
+  803fe2:	41 57                	push   %r15
+  803fe4:	53                   	push   %rbx
+  803fe5:	48 83 ec 20          	sub    $0x20,%rsp
+  803fe9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fe9 <fd2sockid+0xb>
+  803ff0:	49 bb 47 50 00 00 00 	movabs $0x5047,%r11
+  803ff7:	00 00 00 
+  803ffa:	4c 01 db             	add    %r11,%rbx
+  803ffd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804000:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804004:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804007:	48 89 d6             	mov    %rdx,%rsi
+  80400a:	89 c7                	mov    %eax,%edi
+  80400c:	49 89 df             	mov    %rbx,%r15
+  80400f:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  804016:	ff ff ff 
+  804019:	48 01 d8             	add    %rbx,%rax
+  80401c:	ff d0                	call   *%rax
+  80401e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804021:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804025:	79 05                	jns    80402c <fd2sockid+0x4e>
+		return r;
+  804027:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80402a:	eb 25                	jmp    804051 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80402c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804030:	8b 10                	mov    (%rax),%edx
+  804032:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  804039:	00 00 00 
+  80403c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80403f:	39 c2                	cmp    %eax,%edx
+  804041:	74 07                	je     80404a <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804043:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804048:	eb 07                	jmp    804051 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  80404a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80404e:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804051:	48 83 c4 20          	add    $0x20,%rsp
+  804055:	5b                   	pop    %rbx
+  804056:	41 5f                	pop    %r15
+  804058:	5d                   	pop    %rbp
+  804059:	c3                   	ret
+
+000000000080405a <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  80405a:	55                   	push   %rbp
+  80405b:	48 89 e5             	mov    %rsp,%rbp
+  80405e:	41 57                	push   %r15
+  804060:	53                   	push   %rbx
+  804061:	48 83 ec 20          	sub    $0x20,%rsp
+  804065:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804065 <alloc_sockfd+0xb>
+  80406c:	49 bb cb 4f 00 00 00 	movabs $0x4fcb,%r11
+  804073:	00 00 00 
+  804076:	4c 01 db             	add    %r11,%rbx
+  804079:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  80407c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804080:	48 89 c7             	mov    %rax,%rdi
+  804083:	49 89 df             	mov    %rbx,%r15
+  804086:	48 b8 6f 99 ff ff ff 	movabs $0xffffffffffff996f,%rax
+  80408d:	ff ff ff 
+  804090:	48 01 d8             	add    %rbx,%rax
+  804093:	ff d0                	call   *%rax
+  804095:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804098:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80409c:	78 2c                	js     8040ca <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80409e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040a2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8040a7:	48 89 c6             	mov    %rax,%rsi
+  8040aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040af:	49 89 df             	mov    %rbx,%r15
+  8040b2:	48 b8 4c 91 ff ff ff 	movabs $0xffffffffffff914c,%rax
+  8040b9:	ff ff ff 
+  8040bc:	48 01 d8             	add    %rbx,%rax
+  8040bf:	ff d0                	call   *%rax
+  8040c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040c8:	79 1c                	jns    8040e6 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8040ca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040cd:	89 c7                	mov    %eax,%edi
+  8040cf:	49 89 df             	mov    %rbx,%r15
+  8040d2:	48 b8 1e b8 ff ff ff 	movabs $0xffffffffffffb81e,%rax
+  8040d9:	ff ff ff 
+  8040dc:	48 01 d8             	add    %rbx,%rax
+  8040df:	ff d0                	call   *%rax
+		return r;
+  8040e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040e4:	eb 41                	jmp    804127 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  8040e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040ea:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  8040f1:	00 00 00 
+  8040f4:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8040f7:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8040f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040fd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804104:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804108:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80410b:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  80410e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804112:	48 89 c7             	mov    %rax,%rdi
+  804115:	49 89 df             	mov    %rbx,%r15
+  804118:	48 b8 f5 98 ff ff ff 	movabs $0xffffffffffff98f5,%rax
+  80411f:	ff ff ff 
+  804122:	48 01 d8             	add    %rbx,%rax
+  804125:	ff d0                	call   *%rax
+}
+  804127:	48 83 c4 20          	add    $0x20,%rsp
+  80412b:	5b                   	pop    %rbx
+  80412c:	41 5f                	pop    %r15
+  80412e:	5d                   	pop    %rbp
+  80412f:	c3                   	ret
+
+0000000000804130 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804130:	55                   	push   %rbp
+  804131:	48 89 e5             	mov    %rsp,%rbp
+  804134:	41 57                	push   %r15
+  804136:	53                   	push   %rbx
+  804137:	48 83 ec 30          	sub    $0x30,%rsp
+  80413b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80413b <accept+0xb>
+  804142:	49 bb f5 4e 00 00 00 	movabs $0x4ef5,%r11
+  804149:	00 00 00 
+  80414c:	4c 01 db             	add    %r11,%rbx
+  80414f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804152:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804156:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80415a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80415d:	89 c7                	mov    %eax,%edi
+  80415f:	48 b8 ae af ff ff ff 	movabs $0xffffffffffffafae,%rax
+  804166:	ff ff ff 
+  804169:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80416d:	ff d0                	call   *%rax
+  80416f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804172:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804176:	79 05                	jns    80417d <accept+0x4d>
+		return r;
+  804178:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80417b:	eb 45                	jmp    8041c2 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80417d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804181:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804185:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804188:	48 89 ce             	mov    %rcx,%rsi
+  80418b:	89 c7                	mov    %eax,%edi
+  80418d:	49 89 df             	mov    %rbx,%r15
+  804190:	48 b8 8c b6 ff ff ff 	movabs $0xffffffffffffb68c,%rax
+  804197:	ff ff ff 
+  80419a:	48 01 d8             	add    %rbx,%rax
+  80419d:	ff d0                	call   *%rax
+  80419f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041a6:	79 05                	jns    8041ad <accept+0x7d>
+		return r;
+  8041a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041ab:	eb 15                	jmp    8041c2 <accept+0x92>
+	return alloc_sockfd(r);
+  8041ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041b0:	89 c7                	mov    %eax,%edi
+  8041b2:	48 b8 2a b0 ff ff ff 	movabs $0xffffffffffffb02a,%rax
+  8041b9:	ff ff ff 
+  8041bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041c0:	ff d0                	call   *%rax
+}
+  8041c2:	48 83 c4 30          	add    $0x30,%rsp
+  8041c6:	5b                   	pop    %rbx
+  8041c7:	41 5f                	pop    %r15
+  8041c9:	5d                   	pop    %rbp
+  8041ca:	c3                   	ret
+
+00000000008041cb <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8041cb:	55                   	push   %rbp
+  8041cc:	48 89 e5             	mov    %rsp,%rbp
+  8041cf:	41 57                	push   %r15
+  8041d1:	53                   	push   %rbx
+  8041d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8041d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041d6 <bind+0xb>
+  8041dd:	49 bb 5a 4e 00 00 00 	movabs $0x4e5a,%r11
+  8041e4:	00 00 00 
+  8041e7:	4c 01 db             	add    %r11,%rbx
+  8041ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8041ed:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8041f1:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8041f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041f7:	89 c7                	mov    %eax,%edi
+  8041f9:	48 b8 ae af ff ff ff 	movabs $0xffffffffffffafae,%rax
+  804200:	ff ff ff 
+  804203:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804207:	ff d0                	call   *%rax
+  804209:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80420c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804210:	79 05                	jns    804217 <bind+0x4c>
+		return r;
+  804212:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804215:	eb 21                	jmp    804238 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804217:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80421a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80421e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804221:	48 89 ce             	mov    %rcx,%rsi
+  804224:	89 c7                	mov    %eax,%edi
+  804226:	49 89 df             	mov    %rbx,%r15
+  804229:	48 b8 38 b7 ff ff ff 	movabs $0xffffffffffffb738,%rax
+  804230:	ff ff ff 
+  804233:	48 01 d8             	add    %rbx,%rax
+  804236:	ff d0                	call   *%rax
+}
+  804238:	48 83 c4 20          	add    $0x20,%rsp
+  80423c:	5b                   	pop    %rbx
+  80423d:	41 5f                	pop    %r15
+  80423f:	5d                   	pop    %rbp
+  804240:	c3                   	ret
+
+0000000000804241 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804241:	55                   	push   %rbp
+  804242:	48 89 e5             	mov    %rsp,%rbp
+  804245:	41 57                	push   %r15
+  804247:	53                   	push   %rbx
+  804248:	48 83 ec 20          	sub    $0x20,%rsp
+  80424c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80424c <shutdown+0xb>
+  804253:	49 bb e4 4d 00 00 00 	movabs $0x4de4,%r11
+  80425a:	00 00 00 
+  80425d:	4c 01 db             	add    %r11,%rbx
+  804260:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804263:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804266:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804269:	89 c7                	mov    %eax,%edi
+  80426b:	48 b8 ae af ff ff ff 	movabs $0xffffffffffffafae,%rax
+  804272:	ff ff ff 
+  804275:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804279:	ff d0                	call   *%rax
+  80427b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80427e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804282:	79 05                	jns    804289 <shutdown+0x48>
+		return r;
+  804284:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804287:	eb 1c                	jmp    8042a5 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804289:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80428c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80428f:	89 d6                	mov    %edx,%esi
+  804291:	89 c7                	mov    %eax,%edi
+  804293:	49 89 df             	mov    %rbx,%r15
+  804296:	48 b8 cd b7 ff ff ff 	movabs $0xffffffffffffb7cd,%rax
+  80429d:	ff ff ff 
+  8042a0:	48 01 d8             	add    %rbx,%rax
+  8042a3:	ff d0                	call   *%rax
+}
+  8042a5:	48 83 c4 20          	add    $0x20,%rsp
+  8042a9:	5b                   	pop    %rbx
+  8042aa:	41 5f                	pop    %r15
+  8042ac:	5d                   	pop    %rbp
+  8042ad:	c3                   	ret
+
+00000000008042ae <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8042ae:	55                   	push   %rbp
+  8042af:	48 89 e5             	mov    %rsp,%rbp
+  8042b2:	41 57                	push   %r15
+  8042b4:	53                   	push   %rbx
+  8042b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8042b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042b9 <devsock_close+0xb>
+  8042c0:	49 bb 77 4d 00 00 00 	movabs $0x4d77,%r11
+  8042c7:	00 00 00 
+  8042ca:	4c 01 db             	add    %r11,%rbx
+  8042cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  8042d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d5:	48 89 c7             	mov    %rax,%rdi
+  8042d8:	49 89 df             	mov    %rbx,%r15
+  8042db:	48 b8 23 d1 ff ff ff 	movabs $0xffffffffffffd123,%rax
+  8042e2:	ff ff ff 
+  8042e5:	48 01 d8             	add    %rbx,%rax
+  8042e8:	ff d0                	call   *%rax
+  8042ea:	83 f8 01             	cmp    $0x1,%eax
+  8042ed:	75 1d                	jne    80430c <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  8042ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042f3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8042f6:	89 c7                	mov    %eax,%edi
+  8042f8:	49 89 df             	mov    %rbx,%r15
+  8042fb:	48 b8 1e b8 ff ff ff 	movabs $0xffffffffffffb81e,%rax
+  804302:	ff ff ff 
+  804305:	48 01 d8             	add    %rbx,%rax
+  804308:	ff d0                	call   *%rax
+  80430a:	eb 05                	jmp    804311 <devsock_close+0x63>
+	else
+		return 0;
+  80430c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804311:	48 83 c4 10          	add    $0x10,%rsp
+  804315:	5b                   	pop    %rbx
+  804316:	41 5f                	pop    %r15
+  804318:	5d                   	pop    %rbp
+  804319:	c3                   	ret
+
+000000000080431a <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80431a:	55                   	push   %rbp
+  80431b:	48 89 e5             	mov    %rsp,%rbp
+  80431e:	41 57                	push   %r15
+  804320:	53                   	push   %rbx
+  804321:	48 83 ec 20          	sub    $0x20,%rsp
+  804325:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804325 <connect+0xb>
+  80432c:	49 bb 0b 4d 00 00 00 	movabs $0x4d0b,%r11
+  804333:	00 00 00 
+  804336:	4c 01 db             	add    %r11,%rbx
+  804339:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80433c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804340:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804343:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804346:	89 c7                	mov    %eax,%edi
+  804348:	48 b8 ae af ff ff ff 	movabs $0xffffffffffffafae,%rax
+  80434f:	ff ff ff 
+  804352:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804356:	ff d0                	call   *%rax
+  804358:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80435b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80435f:	79 05                	jns    804366 <connect+0x4c>
+		return r;
+  804361:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804364:	eb 21                	jmp    804387 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804366:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804369:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80436d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804370:	48 89 ce             	mov    %rcx,%rsi
+  804373:	89 c7                	mov    %eax,%edi
+  804375:	49 89 df             	mov    %rbx,%r15
+  804378:	48 b8 66 b8 ff ff ff 	movabs $0xffffffffffffb866,%rax
+  80437f:	ff ff ff 
+  804382:	48 01 d8             	add    %rbx,%rax
+  804385:	ff d0                	call   *%rax
+}
+  804387:	48 83 c4 20          	add    $0x20,%rsp
+  80438b:	5b                   	pop    %rbx
+  80438c:	41 5f                	pop    %r15
+  80438e:	5d                   	pop    %rbp
+  80438f:	c3                   	ret
+
+0000000000804390 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804390:	55                   	push   %rbp
+  804391:	48 89 e5             	mov    %rsp,%rbp
+  804394:	41 57                	push   %r15
+  804396:	53                   	push   %rbx
+  804397:	48 83 ec 20          	sub    $0x20,%rsp
+  80439b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80439b <listen+0xb>
+  8043a2:	49 bb 95 4c 00 00 00 	movabs $0x4c95,%r11
+  8043a9:	00 00 00 
+  8043ac:	4c 01 db             	add    %r11,%rbx
+  8043af:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8043b2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8043b5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043b8:	89 c7                	mov    %eax,%edi
+  8043ba:	48 b8 ae af ff ff ff 	movabs $0xffffffffffffafae,%rax
+  8043c1:	ff ff ff 
+  8043c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043c8:	ff d0                	call   *%rax
+  8043ca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043d1:	79 05                	jns    8043d8 <listen+0x48>
+		return r;
+  8043d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043d6:	eb 1c                	jmp    8043f4 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  8043d8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8043db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043de:	89 d6                	mov    %edx,%esi
+  8043e0:	89 c7                	mov    %eax,%edi
+  8043e2:	49 89 df             	mov    %rbx,%r15
+  8043e5:	48 b8 fb b8 ff ff ff 	movabs $0xffffffffffffb8fb,%rax
+  8043ec:	ff ff ff 
+  8043ef:	48 01 d8             	add    %rbx,%rax
+  8043f2:	ff d0                	call   *%rax
+}
+  8043f4:	48 83 c4 20          	add    $0x20,%rsp
+  8043f8:	5b                   	pop    %rbx
+  8043f9:	41 5f                	pop    %r15
+  8043fb:	5d                   	pop    %rbp
+  8043fc:	c3                   	ret
+
+00000000008043fd <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8043fd:	55                   	push   %rbp
+  8043fe:	48 89 e5             	mov    %rsp,%rbp
+  804401:	41 57                	push   %r15
+  804403:	48 83 ec 28          	sub    $0x28,%rsp
+  804407:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804407 <devsock_read+0xa>
+  80440e:	49 bb 29 4c 00 00 00 	movabs $0x4c29,%r11
+  804415:	00 00 00 
+  804418:	4c 01 d8             	add    %r11,%rax
+  80441b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80441f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804423:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804427:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80442b:	41 89 d0             	mov    %edx,%r8d
+  80442e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804432:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804435:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804439:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80443e:	44 89 c2             	mov    %r8d,%edx
+  804441:	49 89 c7             	mov    %rax,%r15
+  804444:	49 b8 4c b9 ff ff ff 	movabs $0xffffffffffffb94c,%r8
+  80444b:	ff ff ff 
+  80444e:	49 01 c0             	add    %rax,%r8
+  804451:	41 ff d0             	call   *%r8
+}
+  804454:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804458:	c9                   	leave
+  804459:	c3                   	ret
+
+000000000080445a <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80445a:	55                   	push   %rbp
+  80445b:	48 89 e5             	mov    %rsp,%rbp
+  80445e:	41 57                	push   %r15
+  804460:	48 83 ec 28          	sub    $0x28,%rsp
+  804464:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804464 <devsock_write+0xa>
+  80446b:	49 bb cc 4b 00 00 00 	movabs $0x4bcc,%r11
+  804472:	00 00 00 
+  804475:	4c 01 d8             	add    %r11,%rax
+  804478:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80447c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804480:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804484:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804488:	41 89 d0             	mov    %edx,%r8d
+  80448b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80448f:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804492:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804496:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80449b:	44 89 c2             	mov    %r8d,%edx
+  80449e:	49 89 c7             	mov    %rax,%r15
+  8044a1:	49 b8 69 ba ff ff ff 	movabs $0xffffffffffffba69,%r8
+  8044a8:	ff ff ff 
+  8044ab:	49 01 c0             	add    %rax,%r8
+  8044ae:	41 ff d0             	call   *%r8
+}
+  8044b1:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8044b5:	c9                   	leave
+  8044b6:	c3                   	ret
+
+00000000008044b7 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8044b7:	55                   	push   %rbp
+  8044b8:	48 89 e5             	mov    %rsp,%rbp
+  8044bb:	41 57                	push   %r15
+  8044bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8044c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044c1 <devsock_stat+0xa>
+  8044c8:	49 bb 6f 4b 00 00 00 	movabs $0x4b6f,%r11
+  8044cf:	00 00 00 
+  8044d2:	4c 01 d8             	add    %r11,%rax
+  8044d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8044d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8044dd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8044e1:	48 b9 94 dd ff ff ff 	movabs $0xffffffffffffdd94,%rcx
+  8044e8:	ff ff ff 
+  8044eb:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8044ef:	48 89 ce             	mov    %rcx,%rsi
+  8044f2:	48 89 d7             	mov    %rdx,%rdi
+  8044f5:	49 89 c7             	mov    %rax,%r15
+  8044f8:	48 ba 90 84 ff ff ff 	movabs $0xffffffffffff8490,%rdx
+  8044ff:	ff ff ff 
+  804502:	48 01 c2             	add    %rax,%rdx
+  804505:	ff d2                	call   *%rdx
+	return 0;
+  804507:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80450c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804510:	c9                   	leave
+  804511:	c3                   	ret
+
+0000000000804512 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804512:	55                   	push   %rbp
+  804513:	48 89 e5             	mov    %rsp,%rbp
+  804516:	41 57                	push   %r15
+  804518:	53                   	push   %rbx
+  804519:	48 83 ec 20          	sub    $0x20,%rsp
+  80451d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80451d <socket+0xb>
+  804524:	49 bb 13 4b 00 00 00 	movabs $0x4b13,%r11
+  80452b:	00 00 00 
+  80452e:	4c 01 db             	add    %r11,%rbx
+  804531:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804534:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804537:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80453a:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80453d:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804540:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804543:	89 ce                	mov    %ecx,%esi
+  804545:	89 c7                	mov    %eax,%edi
+  804547:	49 89 df             	mov    %rbx,%r15
+  80454a:	48 b8 40 bc ff ff ff 	movabs $0xffffffffffffbc40,%rax
+  804551:	ff ff ff 
+  804554:	48 01 d8             	add    %rbx,%rax
+  804557:	ff d0                	call   *%rax
+  804559:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80455c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804560:	79 05                	jns    804567 <socket+0x55>
+		return r;
+  804562:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804565:	eb 15                	jmp    80457c <socket+0x6a>
+	return alloc_sockfd(r);
+  804567:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80456a:	89 c7                	mov    %eax,%edi
+  80456c:	48 b8 2a b0 ff ff ff 	movabs $0xffffffffffffb02a,%rax
+  804573:	ff ff ff 
+  804576:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80457a:	ff d0                	call   *%rax
+}
+  80457c:	48 83 c4 20          	add    $0x20,%rsp
+  804580:	5b                   	pop    %rbx
+  804581:	41 5f                	pop    %r15
+  804583:	5d                   	pop    %rbp
+  804584:	c3                   	ret
+
+0000000000804585 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  804585:	55                   	push   %rbp
+  804586:	48 89 e5             	mov    %rsp,%rbp
+  804589:	41 57                	push   %r15
+  80458b:	53                   	push   %rbx
+  80458c:	48 83 ec 10          	sub    $0x10,%rsp
+  804590:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804590 <nsipc+0xb>
+  804597:	49 bb a0 4a 00 00 00 	movabs $0x4aa0,%r11
+  80459e:	00 00 00 
+  8045a1:	4c 01 db             	add    %r11,%rbx
+  8045a4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8045a7:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8045ae:	00 00 00 
+  8045b1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8045b4:	85 c0                	test   %eax,%eax
+  8045b6:	75 24                	jne    8045dc <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8045b8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8045bd:	49 89 df             	mov    %rbx,%r15
+  8045c0:	48 b8 94 d0 ff ff ff 	movabs $0xffffffffffffd094,%rax
+  8045c7:	ff ff ff 
+  8045ca:	48 01 d8             	add    %rbx,%rax
+  8045cd:	ff d0                	call   *%rax
+  8045cf:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8045d6:	00 00 00 
+  8045d9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  8045dc:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8045e3:	00 00 00 
+  8045e6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8045e9:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8045ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045f8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8045fd:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804604:	00 00 00 
+  804607:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80460b:	89 c7                	mov    %eax,%edi
+  80460d:	49 89 df             	mov    %rbx,%r15
+  804610:	48 b8 b3 ca ff ff ff 	movabs $0xffffffffffffcab3,%rax
+  804617:	ff ff ff 
+  80461a:	48 01 d8             	add    %rbx,%rax
+  80461d:	ff d0                	call   *%rax
+}
+  80461f:	48 83 c4 10          	add    $0x10,%rsp
+  804623:	5b                   	pop    %rbx
+  804624:	41 5f                	pop    %r15
+  804626:	5d                   	pop    %rbp
+  804627:	c3                   	ret
+
+0000000000804628 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804628:	55                   	push   %rbp
+  804629:	48 89 e5             	mov    %rsp,%rbp
+  80462c:	41 57                	push   %r15
+  80462e:	53                   	push   %rbx
+  80462f:	48 83 ec 20          	sub    $0x20,%rsp
+  804633:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804633 <nsipc_words+0xb>
+  80463a:	49 bb fd 49 00 00 00 	movabs $0x49fd,%r11
+  804641:	00 00 00 
+  804644:	4c 01 db             	add    %r11,%rbx
+  804647:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80464a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80464e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  804652:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804659:	00 00 00 
+  80465c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80465f:	85 c0                	test   %eax,%eax
+  804661:	75 24                	jne    804687 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804663:	bf 02 00 00 00       	mov    $0x2,%edi
+  804668:	49 89 df             	mov    %rbx,%r15
+  80466b:	48 b8 94 d0 ff ff ff 	movabs $0xffffffffffffd094,%rax
+  804672:	ff ff ff 
+  804675:	48 01 d8             	add    %rbx,%rax
+  804678:	ff d0                	call   *%rax
+  80467a:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804681:	00 00 00 
+  804684:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804687:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80468e:	00 00 00 
+  804691:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804694:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804698:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80469c:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80469f:	89 c7                	mov    %eax,%edi
+  8046a1:	49 89 df             	mov    %rbx,%r15
+  8046a4:	48 b8 9e cb ff ff ff 	movabs $0xffffffffffffcb9e,%rax
+  8046ab:	ff ff ff 
+  8046ae:	48 01 d8             	add    %rbx,%rax
+  8046b1:	ff d0                	call   *%rax
+}
+  8046b3:	48 83 c4 20          	add    $0x20,%rsp
+  8046b7:	5b                   	pop    %rbx
+  8046b8:	41 5f                	pop    %r15
+  8046ba:	5d                   	pop    %rbp
+  8046bb:	c3                   	ret
+
+00000000008046bc <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8046bc:	55                   	push   %rbp
+  8046bd:	48 89 e5             	mov    %rsp,%rbp
+  8046c0:	41 57                	push   %r15
+  8046c2:	53                   	push   %rbx
+  8046c3:	48 83 ec 30          	sub    $0x30,%rsp
+  8046c7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046c7 <nsipc_accept+0xb>
+  8046ce:	49 bb 69 49 00 00 00 	movabs $0x4969,%r11
+  8046d5:	00 00 00 
+  8046d8:	4c 01 db             	add    %r11,%rbx
+  8046db:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8046de:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8046e2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8046e6:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8046ed:	00 00 00 
+  8046f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046f3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8046f6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8046fb:	48 b8 55 b5 ff ff ff 	movabs $0xffffffffffffb555,%rax
+  804702:	ff ff ff 
+  804705:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804709:	ff d0                	call   *%rax
+  80470b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80470e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804712:	78 48                	js     80475c <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  804714:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  80471b:	00 00 00 
+  80471e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804722:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804726:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80472a:	8b 40 10             	mov    0x10(%rax),%eax
+  80472d:	89 c2                	mov    %eax,%edx
+  80472f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804733:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804737:	48 89 ce             	mov    %rcx,%rsi
+  80473a:	48 89 c7             	mov    %rax,%rdi
+  80473d:	49 89 df             	mov    %rbx,%r15
+  804740:	48 b8 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rax
+  804747:	ff ff ff 
+  80474a:	48 01 d8             	add    %rbx,%rax
+  80474d:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80474f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804753:	8b 50 10             	mov    0x10(%rax),%edx
+  804756:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80475a:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  80475c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80475f:	48 83 c4 30          	add    $0x30,%rsp
+  804763:	5b                   	pop    %rbx
+  804764:	41 5f                	pop    %r15
+  804766:	5d                   	pop    %rbp
+  804767:	c3                   	ret
+
+0000000000804768 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804768:	55                   	push   %rbp
+  804769:	48 89 e5             	mov    %rsp,%rbp
+  80476c:	41 57                	push   %r15
+  80476e:	53                   	push   %rbx
+  80476f:	48 83 ec 10          	sub    $0x10,%rsp
+  804773:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804773 <nsipc_bind+0xb>
+  80477a:	49 bb bd 48 00 00 00 	movabs $0x48bd,%r11
+  804781:	00 00 00 
+  804784:	4c 01 db             	add    %r11,%rbx
+  804787:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80478a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80478e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  804791:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804798:	00 00 00 
+  80479b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80479e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8047a1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8047a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047a8:	48 89 c6             	mov    %rax,%rsi
+  8047ab:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  8047b2:	00 00 00 
+  8047b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047b9:	48 89 c7             	mov    %rax,%rdi
+  8047bc:	49 89 df             	mov    %rbx,%r15
+  8047bf:	48 b8 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rax
+  8047c6:	ff ff ff 
+  8047c9:	48 01 d8             	add    %rbx,%rax
+  8047cc:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8047ce:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8047d5:	00 00 00 
+  8047d8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8047db:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8047df:	bf 02 00 00 00       	mov    $0x2,%edi
+  8047e4:	48 b8 55 b5 ff ff ff 	movabs $0xffffffffffffb555,%rax
+  8047eb:	ff ff ff 
+  8047ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047f2:	ff d0                	call   *%rax
+}
+  8047f4:	48 83 c4 10          	add    $0x10,%rsp
+  8047f8:	5b                   	pop    %rbx
+  8047f9:	41 5f                	pop    %r15
+  8047fb:	5d                   	pop    %rbp
+  8047fc:	c3                   	ret
+
+00000000008047fd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8047fd:	55                   	push   %rbp
+  8047fe:	48 89 e5             	mov    %rsp,%rbp
+  804801:	48 83 ec 20          	sub    $0x20,%rsp
+  804805:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804805 <nsipc_shutdown+0x8>
+  80480c:	49 bb 2b 48 00 00 00 	movabs $0x482b,%r11
+  804813:	00 00 00 
+  804816:	4c 01 d8             	add    %r11,%rax
+  804819:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80481c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  80481f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804822:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  804825:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804828:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80482b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80482f:	ba 08 00 00 00       	mov    $0x8,%edx
+  804834:	48 89 ce             	mov    %rcx,%rsi
+  804837:	bf 03 00 00 00       	mov    $0x3,%edi
+  80483c:	48 b9 f8 b5 ff ff ff 	movabs $0xffffffffffffb5f8,%rcx
+  804843:	ff ff ff 
+  804846:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80484a:	ff d0                	call   *%rax
+}
+  80484c:	c9                   	leave
+  80484d:	c3                   	ret
+
+000000000080484e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80484e:	55                   	push   %rbp
+  80484f:	48 89 e5             	mov    %rsp,%rbp
+  804852:	48 83 ec 20          	sub    $0x20,%rsp
+  804856:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804856 <nsipc_close+0x8>
+  80485d:	49 bb da 47 00 00 00 	movabs $0x47da,%r11
+  804864:	00 00 00 
+  804867:	4c 01 d8             	add    %r11,%rax
+  80486a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80486d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804870:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  804873:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804877:	ba 04 00 00 00       	mov    $0x4,%edx
+  80487c:	48 89 ce             	mov    %rcx,%rsi
+  80487f:	bf 04 00 00 00       	mov    $0x4,%edi
+  804884:	48 b9 f8 b5 ff ff ff 	movabs $0xffffffffffffb5f8,%rcx
+  80488b:	ff ff ff 
+  80488e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804892:	ff d0                	call   *%rax
+}
+  804894:	c9                   	leave
+  804895:	c3                   	ret
+
+0000000000804896 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804896:	55                   	push   %rbp
+  804897:	48 89 e5             	mov    %rsp,%rbp
+  80489a:	41 57                	push   %r15
+  80489c:	53                   	push   %rbx
+  80489d:	48 83 ec 10          	sub    $0x10,%rsp
+  8048a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048a1 <nsipc_connect+0xb>
+  8048a8:	49 bb 8f 47 00 00 00 	movabs $0x478f,%r11
+  8048af:	00 00 00 
+  8048b2:	4c 01 db             	add    %r11,%rbx
+  8048b5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8048b8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8048bc:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8048bf:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8048c6:	00 00 00 
+  8048c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048cc:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8048cf:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8048d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048d6:	48 89 c6             	mov    %rax,%rsi
+  8048d9:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  8048e0:	00 00 00 
+  8048e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048e7:	48 89 c7             	mov    %rax,%rdi
+  8048ea:	49 89 df             	mov    %rbx,%r15
+  8048ed:	48 b8 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rax
+  8048f4:	ff ff ff 
+  8048f7:	48 01 d8             	add    %rbx,%rax
+  8048fa:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8048fc:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804903:	00 00 00 
+  804906:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804909:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  80490d:	bf 05 00 00 00       	mov    $0x5,%edi
+  804912:	48 b8 55 b5 ff ff ff 	movabs $0xffffffffffffb555,%rax
+  804919:	ff ff ff 
+  80491c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804920:	ff d0                	call   *%rax
+}
+  804922:	48 83 c4 10          	add    $0x10,%rsp
+  804926:	5b                   	pop    %rbx
+  804927:	41 5f                	pop    %r15
+  804929:	5d                   	pop    %rbp
+  80492a:	c3                   	ret
+
+000000000080492b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80492b:	55                   	push   %rbp
+  80492c:	48 89 e5             	mov    %rsp,%rbp
+  80492f:	48 83 ec 20          	sub    $0x20,%rsp
+  804933:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804933 <nsipc_listen+0x8>
+  80493a:	49 bb fd 46 00 00 00 	movabs $0x46fd,%r11
+  804941:	00 00 00 
+  804944:	4c 01 d8             	add    %r11,%rax
+  804947:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80494a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  80494d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804950:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  804953:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804956:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804959:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80495d:	ba 08 00 00 00       	mov    $0x8,%edx
+  804962:	48 89 ce             	mov    %rcx,%rsi
+  804965:	bf 06 00 00 00       	mov    $0x6,%edi
+  80496a:	48 b9 f8 b5 ff ff ff 	movabs $0xffffffffffffb5f8,%rcx
+  804971:	ff ff ff 
+  804974:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804978:	ff d0                	call   *%rax
+}
+  80497a:	c9                   	leave
+  80497b:	c3                   	ret
+
+000000000080497c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80497c:	55                   	push   %rbp
+  80497d:	48 89 e5             	mov    %rsp,%rbp
+  804980:	41 57                	push   %r15
+  804982:	53                   	push   %rbx
+  804983:	48 83 ec 30          	sub    $0x30,%rsp
+  804987:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804987 <nsipc_recv+0xb>
+  80498e:	49 bb a9 46 00 00 00 	movabs $0x46a9,%r11
+  804995:	00 00 00 
+  804998:	4c 01 db             	add    %r11,%rbx
+  80499b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80499e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8049a2:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8049a5:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8049a8:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8049af:	00 00 00 
+  8049b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8049b5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8049b8:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8049bf:	00 00 00 
+  8049c2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8049c5:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8049c9:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8049d0:	00 00 00 
+  8049d3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8049d6:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8049da:	bf 07 00 00 00       	mov    $0x7,%edi
+  8049df:	48 b8 55 b5 ff ff ff 	movabs $0xffffffffffffb555,%rax
+  8049e6:	ff ff ff 
+  8049e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049ed:	ff d0                	call   *%rax
+  8049ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049f6:	0f 88 91 00 00 00    	js     804a8d <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8049fc:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804a03:	7f 08                	jg     804a0d <nsipc_recv+0x91>
+  804a05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a08:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804a0b:	7e 50                	jle    804a5d <nsipc_recv+0xe1>
+  804a0d:	48 b8 9b dd ff ff ff 	movabs $0xffffffffffffdd9b,%rax
+  804a14:	ff ff ff 
+  804a17:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a1b:	48 89 c1             	mov    %rax,%rcx
+  804a1e:	48 b8 b0 dd ff ff ff 	movabs $0xffffffffffffddb0,%rax
+  804a25:	ff ff ff 
+  804a28:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a2c:	48 89 c2             	mov    %rax,%rdx
+  804a2f:	be 79 00 00 00       	mov    $0x79,%esi
+  804a34:	48 b8 c5 dd ff ff ff 	movabs $0xffffffffffffddc5,%rax
+  804a3b:	ff ff ff 
+  804a3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a42:	48 89 c7             	mov    %rax,%rdi
+  804a45:	49 89 df             	mov    %rbx,%r15
+  804a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a4d:	49 b8 fe c7 ff ff ff 	movabs $0xffffffffffffc7fe,%r8
+  804a54:	ff ff ff 
+  804a57:	49 01 d8             	add    %rbx,%r8
+  804a5a:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804a5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a60:	48 63 d0             	movslq %eax,%rdx
+  804a63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a67:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804a6e:	00 00 00 
+  804a71:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  804a75:	48 89 ce             	mov    %rcx,%rsi
+  804a78:	48 89 c7             	mov    %rax,%rdi
+  804a7b:	49 89 df             	mov    %rbx,%r15
+  804a7e:	48 b8 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rax
+  804a85:	ff ff ff 
+  804a88:	48 01 d8             	add    %rbx,%rax
+  804a8b:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804a8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804a90:	48 83 c4 30          	add    $0x30,%rsp
+  804a94:	5b                   	pop    %rbx
+  804a95:	41 5f                	pop    %r15
+  804a97:	5d                   	pop    %rbp
+  804a98:	c3                   	ret
+
+0000000000804a99 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804a99:	55                   	push   %rbp
+  804a9a:	48 89 e5             	mov    %rsp,%rbp
+  804a9d:	41 57                	push   %r15
+  804a9f:	53                   	push   %rbx
+  804aa0:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804aa7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804aa7 <nsipc_send+0xe>
+  804aae:	49 bb 89 45 00 00 00 	movabs $0x4589,%r11
+  804ab5:	00 00 00 
+  804ab8:	4c 01 db             	add    %r11,%rbx
+  804abb:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804ac1:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804ac8:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804ace:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804ad4:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804ad8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804adc:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804ae3:	00 00 00 
+  804ae6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ae9:	85 c0                	test   %eax,%eax
+  804aeb:	75 24                	jne    804b11 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804aed:	bf 02 00 00 00       	mov    $0x2,%edi
+  804af2:	49 89 df             	mov    %rbx,%r15
+  804af5:	48 b8 94 d0 ff ff ff 	movabs $0xffffffffffffd094,%rax
+  804afc:	ff ff ff 
+  804aff:	48 01 d8             	add    %rbx,%rax
+  804b02:	ff d0                	call   *%rax
+  804b04:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804b0b:	00 00 00 
+  804b0e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804b11:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804b17:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804b1a:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804b21:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804b24:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804b27:	39 c2                	cmp    %eax,%edx
+  804b29:	0f 4e c2             	cmovle %edx,%eax
+  804b2c:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804b32:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804b38:	48 63 d0             	movslq %eax,%rdx
+  804b3b:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804b42:	48 89 c6             	mov    %rax,%rsi
+  804b45:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804b4c:	00 00 00 
+  804b4f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b53:	48 89 c7             	mov    %rax,%rdi
+  804b56:	49 89 df             	mov    %rbx,%r15
+  804b59:	48 b8 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rax
+  804b60:	ff ff ff 
+  804b63:	48 01 d8             	add    %rbx,%rax
+  804b66:	ff d0                	call   *%rax
+	req->req_s = s;
+  804b68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b6c:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804b72:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804b74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b78:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804b7e:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804b81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b85:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804b8b:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804b8e:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804b95:	00 00 00 
+  804b98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b9c:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804ba0:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804ba7:	00 
+  804ba8:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804bae:	48 63 d0             	movslq %eax,%rdx
+  804bb1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb5:	48 01 d0             	add    %rdx,%rax
+  804bb8:	48 83 e8 01          	sub    $0x1,%rax
+  804bbc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804bc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bc9:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804bcd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bd1:	48 29 d0             	sub    %rdx,%rax
+  804bd4:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804bda:	85 c0                	test   %eax,%eax
+  804bdc:	0f 48 c2             	cmovs  %edx,%eax
+  804bdf:	c1 f8 0c             	sar    $0xc,%eax
+  804be2:	48 98                	cltq
+  804be4:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804be8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804bec:	48 85 c0             	test   %rax,%rax
+  804bef:	0f 95 c0             	setne  %al
+  804bf2:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804bf5:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804bfc:	00 
+  804bfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c01:	48 83 c0 0b          	add    $0xb,%rax
+  804c05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804c09:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c12:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804c16:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c1a:	48 29 d0             	sub    %rdx,%rax
+  804c1d:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804c21:	89 c7                	mov    %eax,%edi
+  804c23:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804c2a:	00 00 00 
+  804c2d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c30:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804c34:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804c38:	48 83 ec 08          	sub    $0x8,%rsp
+  804c3c:	6a 00                	push   $0x0
+  804c3e:	6a 00                	push   $0x0
+  804c40:	6a 05                	push   $0x5
+  804c42:	41 89 f1             	mov    %esi,%r9d
+  804c45:	49 89 c8             	mov    %rcx,%r8
+  804c48:	89 f9                	mov    %edi,%ecx
+  804c4a:	be 08 00 00 00       	mov    $0x8,%esi
+  804c4f:	89 c7                	mov    %eax,%edi
+  804c51:	49 89 df             	mov    %rbx,%r15
+  804c54:	48 b8 9c cc ff ff ff 	movabs $0xffffffffffffcc9c,%rax
+  804c5b:	ff ff ff 
+  804c5e:	48 01 d8             	add    %rbx,%rax
+  804c61:	ff d0                	call   *%rax
+  804c63:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804c67:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804c6b:	5b                   	pop    %rbx
+  804c6c:	41 5f                	pop    %r15
+  804c6e:	5d                   	pop    %rbp
+  804c6f:	c3                   	ret
+
+0000000000804c70 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804c70:	55                   	push   %rbp
+  804c71:	48 89 e5             	mov    %rsp,%rbp
+  804c74:	48 83 ec 10          	sub    $0x10,%rsp
+  804c78:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c78 <nsipc_socket+0x8>
+  804c7f:	49 bb b8 43 00 00 00 	movabs $0x43b8,%r11
+  804c86:	00 00 00 
+  804c89:	4c 01 d8             	add    %r11,%rax
+  804c8c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804c8f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804c92:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804c95:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804c9c:	00 00 00 
+  804c9f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804ca2:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804ca5:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804cac:	00 00 00 
+  804caf:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804cb2:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804cb6:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804cbd:	00 00 00 
+  804cc0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804cc3:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804cc7:	bf 09 00 00 00       	mov    $0x9,%edi
+  804ccc:	48 ba 55 b5 ff ff ff 	movabs $0xffffffffffffb555,%rdx
+  804cd3:	ff ff ff 
+  804cd6:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804cda:	ff d0                	call   *%rax
+}
+  804cdc:	c9                   	leave
+  804cdd:	c3                   	ret
+
+0000000000804cde <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804cde:	55                   	push   %rbp
+  804cdf:	48 89 e5             	mov    %rsp,%rbp
+  804ce2:	41 57                	push   %r15
+  804ce4:	53                   	push   %rbx
+  804ce5:	48 83 ec 30          	sub    $0x30,%rsp
+  804ce9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ce9 <pipe+0xb>
+  804cf0:	49 bb 47 43 00 00 00 	movabs $0x4347,%r11
+  804cf7:	00 00 00 
+  804cfa:	4c 01 db             	add    %r11,%rbx
+  804cfd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804d01:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804d05:	48 89 c7             	mov    %rax,%rdi
+  804d08:	49 89 df             	mov    %rbx,%r15
+  804d0b:	48 b8 6f 99 ff ff ff 	movabs $0xffffffffffff996f,%rax
+  804d12:	ff ff ff 
+  804d15:	48 01 d8             	add    %rbx,%rax
+  804d18:	ff d0                	call   *%rax
+  804d1a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d1d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d21:	0f 88 12 02 00 00    	js     804f39 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804d27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d2b:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d30:	48 89 c6             	mov    %rax,%rsi
+  804d33:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d38:	49 89 df             	mov    %rbx,%r15
+  804d3b:	48 b8 4c 91 ff ff ff 	movabs $0xffffffffffff914c,%rax
+  804d42:	ff ff ff 
+  804d45:	48 01 d8             	add    %rbx,%rax
+  804d48:	ff d0                	call   *%rax
+  804d4a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d4d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d51:	0f 88 e2 01 00 00    	js     804f39 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804d57:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804d5b:	48 89 c7             	mov    %rax,%rdi
+  804d5e:	49 89 df             	mov    %rbx,%r15
+  804d61:	48 b8 6f 99 ff ff ff 	movabs $0xffffffffffff996f,%rax
+  804d68:	ff ff ff 
+  804d6b:	48 01 d8             	add    %rbx,%rax
+  804d6e:	ff d0                	call   *%rax
+  804d70:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d73:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d77:	0f 88 9b 01 00 00    	js     804f18 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804d7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d81:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d86:	48 89 c6             	mov    %rax,%rsi
+  804d89:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d8e:	49 89 df             	mov    %rbx,%r15
+  804d91:	48 b8 4c 91 ff ff ff 	movabs $0xffffffffffff914c,%rax
+  804d98:	ff ff ff 
+  804d9b:	48 01 d8             	add    %rbx,%rax
+  804d9e:	ff d0                	call   *%rax
+  804da0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804da3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804da7:	0f 88 6b 01 00 00    	js     804f18 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804dad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804db1:	48 89 c7             	mov    %rax,%rdi
+  804db4:	49 89 df             	mov    %rbx,%r15
+  804db7:	48 b8 2c 99 ff ff ff 	movabs $0xffffffffffff992c,%rax
+  804dbe:	ff ff ff 
+  804dc1:	48 01 d8             	add    %rbx,%rax
+  804dc4:	ff d0                	call   *%rax
+  804dc6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804dca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804dce:	ba 07 04 00 00       	mov    $0x407,%edx
+  804dd3:	48 89 c6             	mov    %rax,%rsi
+  804dd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ddb:	49 89 df             	mov    %rbx,%r15
+  804dde:	48 b8 4c 91 ff ff ff 	movabs $0xffffffffffff914c,%rax
+  804de5:	ff ff ff 
+  804de8:	48 01 d8             	add    %rbx,%rax
+  804deb:	ff d0                	call   *%rax
+  804ded:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804df0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804df4:	0f 88 fd 00 00 00    	js     804ef7 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804dfa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804dfe:	48 89 c7             	mov    %rax,%rdi
+  804e01:	49 89 df             	mov    %rbx,%r15
+  804e04:	48 b8 2c 99 ff ff ff 	movabs $0xffffffffffff992c,%rax
+  804e0b:	ff ff ff 
+  804e0e:	48 01 d8             	add    %rbx,%rax
+  804e11:	ff d0                	call   *%rax
+  804e13:	48 89 c2             	mov    %rax,%rdx
+  804e16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e1a:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804e20:	48 89 d1             	mov    %rdx,%rcx
+  804e23:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e28:	48 89 c6             	mov    %rax,%rsi
+  804e2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e30:	49 89 df             	mov    %rbx,%r15
+  804e33:	48 b8 b1 91 ff ff ff 	movabs $0xffffffffffff91b1,%rax
+  804e3a:	ff ff ff 
+  804e3d:	48 01 d8             	add    %rbx,%rax
+  804e40:	ff d0                	call   *%rax
+  804e42:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e49:	0f 88 87 00 00 00    	js     804ed6 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804e4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e53:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804e5a:	00 00 00 
+  804e5d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804e60:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804e62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e66:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804e6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e71:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804e78:	00 00 00 
+  804e7b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804e7e:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804e80:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e84:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804e8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e8f:	48 89 c7             	mov    %rax,%rdi
+  804e92:	49 89 df             	mov    %rbx,%r15
+  804e95:	48 b8 f5 98 ff ff ff 	movabs $0xffffffffffff98f5,%rax
+  804e9c:	ff ff ff 
+  804e9f:	48 01 d8             	add    %rbx,%rax
+  804ea2:	ff d0                	call   *%rax
+  804ea4:	89 c2                	mov    %eax,%edx
+  804ea6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804eaa:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804eac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804eb0:	48 89 c7             	mov    %rax,%rdi
+  804eb3:	49 89 df             	mov    %rbx,%r15
+  804eb6:	48 b8 f5 98 ff ff ff 	movabs $0xffffffffffff98f5,%rax
+  804ebd:	ff ff ff 
+  804ec0:	48 01 d8             	add    %rbx,%rax
+  804ec3:	ff d0                	call   *%rax
+  804ec5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ec9:	48 83 c2 04          	add    $0x4,%rdx
+  804ecd:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ed4:	eb 67                	jmp    804f3d <pipe+0x25f>
+		goto err3;
+  804ed6:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804ed7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804edb:	48 89 c6             	mov    %rax,%rsi
+  804ede:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ee3:	49 89 df             	mov    %rbx,%r15
+  804ee6:	48 b8 24 92 ff ff ff 	movabs $0xffffffffffff9224,%rax
+  804eed:	ff ff ff 
+  804ef0:	48 01 d8             	add    %rbx,%rax
+  804ef3:	ff d0                	call   *%rax
+  804ef5:	eb 01                	jmp    804ef8 <pipe+0x21a>
+		goto err2;
+  804ef7:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804ef8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804efc:	48 89 c6             	mov    %rax,%rsi
+  804eff:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f04:	49 89 df             	mov    %rbx,%r15
+  804f07:	48 b8 24 92 ff ff ff 	movabs $0xffffffffffff9224,%rax
+  804f0e:	ff ff ff 
+  804f11:	48 01 d8             	add    %rbx,%rax
+  804f14:	ff d0                	call   *%rax
+  804f16:	eb 01                	jmp    804f19 <pipe+0x23b>
+		goto err1;
+  804f18:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804f19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f1d:	48 89 c6             	mov    %rax,%rsi
+  804f20:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f25:	49 89 df             	mov    %rbx,%r15
+  804f28:	48 b8 24 92 ff ff ff 	movabs $0xffffffffffff9224,%rax
+  804f2f:	ff ff ff 
+  804f32:	48 01 d8             	add    %rbx,%rax
+  804f35:	ff d0                	call   *%rax
+  804f37:	eb 01                	jmp    804f3a <pipe+0x25c>
+		goto err;
+  804f39:	90                   	nop
+err:
+	return r;
+  804f3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804f3d:	48 83 c4 30          	add    $0x30,%rsp
+  804f41:	5b                   	pop    %rbx
+  804f42:	41 5f                	pop    %r15
+  804f44:	5d                   	pop    %rbp
+  804f45:	c3                   	ret
+
+0000000000804f46 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804f46:	55                   	push   %rbp
+  804f47:	48 89 e5             	mov    %rsp,%rbp
+  804f4a:	41 57                	push   %r15
+  804f4c:	41 54                	push   %r12
+  804f4e:	53                   	push   %rbx
+  804f4f:	48 83 ec 28          	sub    $0x28,%rsp
+  804f53:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f53 <_pipeisclosed+0xd>
+  804f5a:	49 bb dd 40 00 00 00 	movabs $0x40dd,%r11
+  804f61:	00 00 00 
+  804f64:	4c 01 db             	add    %r11,%rbx
+  804f67:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804f6b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804f6f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804f76:	ff ff ff 
+  804f79:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f7d:	48 8b 00             	mov    (%rax),%rax
+  804f80:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804f86:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  804f89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f8d:	48 89 c7             	mov    %rax,%rdi
+  804f90:	49 89 df             	mov    %rbx,%r15
+  804f93:	48 b8 23 d1 ff ff ff 	movabs $0xffffffffffffd123,%rax
+  804f9a:	ff ff ff 
+  804f9d:	48 01 d8             	add    %rbx,%rax
+  804fa0:	ff d0                	call   *%rax
+  804fa2:	41 89 c4             	mov    %eax,%r12d
+  804fa5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804fa9:	48 89 c7             	mov    %rax,%rdi
+  804fac:	49 89 df             	mov    %rbx,%r15
+  804faf:	48 b8 23 d1 ff ff ff 	movabs $0xffffffffffffd123,%rax
+  804fb6:	ff ff ff 
+  804fb9:	48 01 d8             	add    %rbx,%rax
+  804fbc:	ff d0                	call   *%rax
+  804fbe:	41 39 c4             	cmp    %eax,%r12d
+  804fc1:	0f 94 c0             	sete   %al
+  804fc4:	0f b6 c0             	movzbl %al,%eax
+  804fc7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  804fca:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804fd1:	ff ff ff 
+  804fd4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804fd8:	48 8b 00             	mov    (%rax),%rax
+  804fdb:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804fe1:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  804fe4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fe7:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804fea:	75 05                	jne    804ff1 <_pipeisclosed+0xab>
+			return ret;
+  804fec:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804fef:	eb 63                	jmp    805054 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  804ff1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ff4:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804ff7:	0f 84 72 ff ff ff    	je     804f6f <_pipeisclosed+0x29>
+  804ffd:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805001:	0f 85 68 ff ff ff    	jne    804f6f <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805007:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80500e:	ff ff ff 
+  805011:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805015:	48 8b 00             	mov    (%rax),%rax
+  805018:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  80501e:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805021:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805024:	89 c6                	mov    %eax,%esi
+  805026:	48 b8 d6 dd ff ff ff 	movabs $0xffffffffffffddd6,%rax
+  80502d:	ff ff ff 
+  805030:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805034:	48 89 c7             	mov    %rax,%rdi
+  805037:	49 89 df             	mov    %rbx,%r15
+  80503a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80503f:	49 b8 ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%r8
+  805046:	ff ff ff 
+  805049:	49 01 d8             	add    %rbx,%r8
+  80504c:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  80504f:	e9 1b ff ff ff       	jmp    804f6f <_pipeisclosed+0x29>
+	}
+}
+  805054:	48 83 c4 28          	add    $0x28,%rsp
+  805058:	5b                   	pop    %rbx
+  805059:	41 5c                	pop    %r12
+  80505b:	41 5f                	pop    %r15
+  80505d:	5d                   	pop    %rbp
+  80505e:	c3                   	ret
+
+000000000080505f <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  80505f:	55                   	push   %rbp
+  805060:	48 89 e5             	mov    %rsp,%rbp
+  805063:	41 57                	push   %r15
+  805065:	53                   	push   %rbx
+  805066:	48 83 ec 30          	sub    $0x30,%rsp
+  80506a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80506a <pipeisclosed+0xb>
+  805071:	49 bb c6 3f 00 00 00 	movabs $0x3fc6,%r11
+  805078:	00 00 00 
+  80507b:	4c 01 db             	add    %r11,%rbx
+  80507e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805081:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805085:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805088:	48 89 d6             	mov    %rdx,%rsi
+  80508b:	89 c7                	mov    %eax,%edi
+  80508d:	49 89 df             	mov    %rbx,%r15
+  805090:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  805097:	ff ff ff 
+  80509a:	48 01 d8             	add    %rbx,%rax
+  80509d:	ff d0                	call   *%rax
+  80509f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050a6:	79 05                	jns    8050ad <pipeisclosed+0x4e>
+		return r;
+  8050a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050ab:	eb 3b                	jmp    8050e8 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8050ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050b1:	48 89 c7             	mov    %rax,%rdi
+  8050b4:	49 89 df             	mov    %rbx,%r15
+  8050b7:	48 b8 2c 99 ff ff ff 	movabs $0xffffffffffff992c,%rax
+  8050be:	ff ff ff 
+  8050c1:	48 01 d8             	add    %rbx,%rax
+  8050c4:	ff d0                	call   *%rax
+  8050c6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  8050ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050ce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8050d2:	48 89 d6             	mov    %rdx,%rsi
+  8050d5:	48 89 c7             	mov    %rax,%rdi
+  8050d8:	48 b8 16 bf ff ff ff 	movabs $0xffffffffffffbf16,%rax
+  8050df:	ff ff ff 
+  8050e2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050e6:	ff d0                	call   *%rax
+}
+  8050e8:	48 83 c4 30          	add    $0x30,%rsp
+  8050ec:	5b                   	pop    %rbx
+  8050ed:	41 5f                	pop    %r15
+  8050ef:	5d                   	pop    %rbp
+  8050f0:	c3                   	ret
+
+00000000008050f1 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8050f1:	55                   	push   %rbp
+  8050f2:	48 89 e5             	mov    %rsp,%rbp
+  8050f5:	41 57                	push   %r15
+  8050f7:	53                   	push   %rbx
+  8050f8:	48 83 ec 40          	sub    $0x40,%rsp
+  8050fc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050fc <devpipe_read+0xb>
+  805103:	49 bb 34 3f 00 00 00 	movabs $0x3f34,%r11
+  80510a:	00 00 00 
+  80510d:	4c 01 db             	add    %r11,%rbx
+  805110:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805114:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805118:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  80511c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805120:	48 89 c7             	mov    %rax,%rdi
+  805123:	49 89 df             	mov    %rbx,%r15
+  805126:	48 b8 2c 99 ff ff ff 	movabs $0xffffffffffff992c,%rax
+  80512d:	ff ff ff 
+  805130:	48 01 d8             	add    %rbx,%rax
+  805133:	ff d0                	call   *%rax
+  805135:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805139:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80513d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805141:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805148:	00 
+  805149:	e9 a1 00 00 00       	jmp    8051ef <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  80514e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805153:	74 09                	je     80515e <devpipe_read+0x6d>
+				return i;
+  805155:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805159:	e9 9f 00 00 00       	jmp    8051fd <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  80515e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805162:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805166:	48 89 d6             	mov    %rdx,%rsi
+  805169:	48 89 c7             	mov    %rax,%rdi
+  80516c:	48 b8 16 bf ff ff ff 	movabs $0xffffffffffffbf16,%rax
+  805173:	ff ff ff 
+  805176:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80517a:	ff d0                	call   *%rax
+  80517c:	85 c0                	test   %eax,%eax
+  80517e:	74 07                	je     805187 <devpipe_read+0x96>
+				return 0;
+  805180:	b8 00 00 00 00       	mov    $0x0,%eax
+  805185:	eb 76                	jmp    8051fd <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805187:	49 89 df             	mov    %rbx,%r15
+  80518a:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  805191:	ff ff ff 
+  805194:	48 01 d8             	add    %rbx,%rax
+  805197:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805199:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80519d:	8b 10                	mov    (%rax),%edx
+  80519f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051a3:	8b 40 04             	mov    0x4(%rax),%eax
+  8051a6:	39 c2                	cmp    %eax,%edx
+  8051a8:	74 a4                	je     80514e <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8051aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051ae:	8b 10                	mov    (%rax),%edx
+  8051b0:	89 d0                	mov    %edx,%eax
+  8051b2:	c1 f8 1f             	sar    $0x1f,%eax
+  8051b5:	c1 e8 1b             	shr    $0x1b,%eax
+  8051b8:	01 c2                	add    %eax,%edx
+  8051ba:	83 e2 1f             	and    $0x1f,%edx
+  8051bd:	29 c2                	sub    %eax,%edx
+  8051bf:	89 d6                	mov    %edx,%esi
+  8051c1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8051c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051c9:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8051cd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051d1:	48 63 c6             	movslq %esi,%rax
+  8051d4:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  8051d9:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  8051db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051df:	8b 00                	mov    (%rax),%eax
+  8051e1:	8d 50 01             	lea    0x1(%rax),%edx
+  8051e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051e8:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  8051ea:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8051ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051f3:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8051f7:	72 a0                	jb     805199 <devpipe_read+0xa8>
+	}
+	return i;
+  8051f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8051fd:	48 83 c4 40          	add    $0x40,%rsp
+  805201:	5b                   	pop    %rbx
+  805202:	41 5f                	pop    %r15
+  805204:	5d                   	pop    %rbp
+  805205:	c3                   	ret
+
+0000000000805206 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805206:	55                   	push   %rbp
+  805207:	48 89 e5             	mov    %rsp,%rbp
+  80520a:	41 57                	push   %r15
+  80520c:	53                   	push   %rbx
+  80520d:	48 83 ec 40          	sub    $0x40,%rsp
+  805211:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805211 <devpipe_write+0xb>
+  805218:	49 bb 1f 3e 00 00 00 	movabs $0x3e1f,%r11
+  80521f:	00 00 00 
+  805222:	4c 01 db             	add    %r11,%rbx
+  805225:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805229:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80522d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805231:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805235:	48 89 c7             	mov    %rax,%rdi
+  805238:	49 89 df             	mov    %rbx,%r15
+  80523b:	48 b8 2c 99 ff ff ff 	movabs $0xffffffffffff992c,%rax
+  805242:	ff ff ff 
+  805245:	48 01 d8             	add    %rbx,%rax
+  805248:	ff d0                	call   *%rax
+  80524a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80524e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805252:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805256:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80525d:	00 
+  80525e:	e9 a0 00 00 00       	jmp    805303 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805263:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805267:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80526b:	48 89 d6             	mov    %rdx,%rsi
+  80526e:	48 89 c7             	mov    %rax,%rdi
+  805271:	48 b8 16 bf ff ff ff 	movabs $0xffffffffffffbf16,%rax
+  805278:	ff ff ff 
+  80527b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80527f:	ff d0                	call   *%rax
+  805281:	85 c0                	test   %eax,%eax
+  805283:	74 0a                	je     80528f <devpipe_write+0x89>
+				return 0;
+  805285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80528a:	e9 82 00 00 00       	jmp    805311 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  80528f:	49 89 df             	mov    %rbx,%r15
+  805292:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  805299:	ff ff ff 
+  80529c:	48 01 d8             	add    %rbx,%rax
+  80529f:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8052a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052a5:	8b 40 04             	mov    0x4(%rax),%eax
+  8052a8:	48 63 d0             	movslq %eax,%rdx
+  8052ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052af:	8b 00                	mov    (%rax),%eax
+  8052b1:	48 98                	cltq
+  8052b3:	48 83 c0 20          	add    $0x20,%rax
+  8052b7:	48 39 c2             	cmp    %rax,%rdx
+  8052ba:	73 a7                	jae    805263 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8052bc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8052c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052c4:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8052c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052cc:	8b 50 04             	mov    0x4(%rax),%edx
+  8052cf:	89 d0                	mov    %edx,%eax
+  8052d1:	c1 f8 1f             	sar    $0x1f,%eax
+  8052d4:	c1 e8 1b             	shr    $0x1b,%eax
+  8052d7:	01 c2                	add    %eax,%edx
+  8052d9:	83 e2 1f             	and    $0x1f,%edx
+  8052dc:	29 c2                	sub    %eax,%edx
+  8052de:	89 d0                	mov    %edx,%eax
+  8052e0:	0f b6 09             	movzbl (%rcx),%ecx
+  8052e3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8052e7:	48 98                	cltq
+  8052e9:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  8052ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052f1:	8b 40 04             	mov    0x4(%rax),%eax
+  8052f4:	8d 50 01             	lea    0x1(%rax),%edx
+  8052f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052fb:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8052fe:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805303:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805307:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80530b:	72 94                	jb     8052a1 <devpipe_write+0x9b>
+	}
+
+	return i;
+  80530d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805311:	48 83 c4 40          	add    $0x40,%rsp
+  805315:	5b                   	pop    %rbx
+  805316:	41 5f                	pop    %r15
+  805318:	5d                   	pop    %rbp
+  805319:	c3                   	ret
+
+000000000080531a <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80531a:	55                   	push   %rbp
+  80531b:	48 89 e5             	mov    %rsp,%rbp
+  80531e:	41 57                	push   %r15
+  805320:	53                   	push   %rbx
+  805321:	48 83 ec 20          	sub    $0x20,%rsp
+  805325:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805325 <devpipe_stat+0xb>
+  80532c:	49 bb 0b 3d 00 00 00 	movabs $0x3d0b,%r11
+  805333:	00 00 00 
+  805336:	4c 01 db             	add    %r11,%rbx
+  805339:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80533d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805341:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805345:	48 89 c7             	mov    %rax,%rdi
+  805348:	49 89 df             	mov    %rbx,%r15
+  80534b:	48 b8 2c 99 ff ff ff 	movabs $0xffffffffffff992c,%rax
+  805352:	ff ff ff 
+  805355:	48 01 d8             	add    %rbx,%rax
+  805358:	ff d0                	call   *%rax
+  80535a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  80535e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805362:	48 ba e9 dd ff ff ff 	movabs $0xffffffffffffdde9,%rdx
+  805369:	ff ff ff 
+  80536c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805370:	48 89 d6             	mov    %rdx,%rsi
+  805373:	48 89 c7             	mov    %rax,%rdi
+  805376:	49 89 df             	mov    %rbx,%r15
+  805379:	48 b8 90 84 ff ff ff 	movabs $0xffffffffffff8490,%rax
+  805380:	ff ff ff 
+  805383:	48 01 d8             	add    %rbx,%rax
+  805386:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805388:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80538c:	8b 50 04             	mov    0x4(%rax),%edx
+  80538f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805393:	8b 00                	mov    (%rax),%eax
+  805395:	29 c2                	sub    %eax,%edx
+  805397:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80539b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8053a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053a5:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8053ac:	00 00 00 
+	stat->st_dev = &devpipe;
+  8053af:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053b3:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  8053ba:	00 00 00 
+  8053bd:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8053c1:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8053c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8053cd:	48 83 c4 20          	add    $0x20,%rsp
+  8053d1:	5b                   	pop    %rbx
+  8053d2:	41 5f                	pop    %r15
+  8053d4:	5d                   	pop    %rbp
+  8053d5:	c3                   	ret
+
+00000000008053d6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8053d6:	55                   	push   %rbp
+  8053d7:	48 89 e5             	mov    %rsp,%rbp
+  8053da:	41 57                	push   %r15
+  8053dc:	53                   	push   %rbx
+  8053dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8053e1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053e1 <devpipe_close+0xb>
+  8053e8:	49 bb 4f 3c 00 00 00 	movabs $0x3c4f,%r11
+  8053ef:	00 00 00 
+  8053f2:	4c 01 db             	add    %r11,%rbx
+  8053f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8053f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053fd:	48 89 c6             	mov    %rax,%rsi
+  805400:	bf 00 00 00 00       	mov    $0x0,%edi
+  805405:	49 89 df             	mov    %rbx,%r15
+  805408:	48 b8 24 92 ff ff ff 	movabs $0xffffffffffff9224,%rax
+  80540f:	ff ff ff 
+  805412:	48 01 d8             	add    %rbx,%rax
+  805415:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805417:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80541b:	48 89 c7             	mov    %rax,%rdi
+  80541e:	49 89 df             	mov    %rbx,%r15
+  805421:	48 b8 2c 99 ff ff ff 	movabs $0xffffffffffff992c,%rax
+  805428:	ff ff ff 
+  80542b:	48 01 d8             	add    %rbx,%rax
+  80542e:	ff d0                	call   *%rax
+  805430:	48 89 c6             	mov    %rax,%rsi
+  805433:	bf 00 00 00 00       	mov    $0x0,%edi
+  805438:	49 89 df             	mov    %rbx,%r15
+  80543b:	48 b8 24 92 ff ff ff 	movabs $0xffffffffffff9224,%rax
+  805442:	ff ff ff 
+  805445:	48 01 d8             	add    %rbx,%rax
+  805448:	ff d0                	call   *%rax
+}
+  80544a:	48 83 c4 10          	add    $0x10,%rsp
+  80544e:	5b                   	pop    %rbx
+  80544f:	41 5f                	pop    %r15
+  805451:	5d                   	pop    %rbp
+  805452:	c3                   	ret
+
+0000000000805453 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  805453:	55                   	push   %rbp
+  805454:	48 89 e5             	mov    %rsp,%rbp
+  805457:	41 57                	push   %r15
+  805459:	48 83 ec 28          	sub    $0x28,%rsp
+  80545d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80545d <cputchar+0xa>
+  805464:	49 bb d3 3b 00 00 00 	movabs $0x3bd3,%r11
+  80546b:	00 00 00 
+  80546e:	4c 01 d8             	add    %r11,%rax
+  805471:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  805474:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805477:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  80547a:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  80547e:	be 01 00 00 00       	mov    $0x1,%esi
+  805483:	48 89 d7             	mov    %rdx,%rdi
+  805486:	49 89 c7             	mov    %rax,%r15
+  805489:	48 ba 94 8f ff ff ff 	movabs $0xffffffffffff8f94,%rdx
+  805490:	ff ff ff 
+  805493:	48 01 c2             	add    %rax,%rdx
+  805496:	ff d2                	call   *%rdx
+}
+  805498:	90                   	nop
+  805499:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80549d:	c9                   	leave
+  80549e:	c3                   	ret
+
+000000000080549f <getchar>:
+
+int
+getchar(void)
+{
+  80549f:	55                   	push   %rbp
+  8054a0:	48 89 e5             	mov    %rsp,%rbp
+  8054a3:	41 57                	push   %r15
+  8054a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8054a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054a9 <getchar+0xa>
+  8054b0:	49 bb 87 3b 00 00 00 	movabs $0x3b87,%r11
+  8054b7:	00 00 00 
+  8054ba:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8054bd:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8054c1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8054c6:	48 89 ce             	mov    %rcx,%rsi
+  8054c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054ce:	49 89 c7             	mov    %rax,%r15
+  8054d1:	48 b9 6c 9f ff ff ff 	movabs $0xffffffffffff9f6c,%rcx
+  8054d8:	ff ff ff 
+  8054db:	48 01 c1             	add    %rax,%rcx
+  8054de:	ff d1                	call   *%rcx
+  8054e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8054e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054e7:	79 05                	jns    8054ee <getchar+0x4f>
+		return r;
+  8054e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054ec:	eb 14                	jmp    805502 <getchar+0x63>
+	if (r < 1)
+  8054ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054f2:	7f 07                	jg     8054fb <getchar+0x5c>
+		return -E_EOF;
+  8054f4:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8054f9:	eb 07                	jmp    805502 <getchar+0x63>
+	return c;
+  8054fb:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8054ff:	0f b6 c0             	movzbl %al,%eax
+}
+  805502:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805506:	c9                   	leave
+  805507:	c3                   	ret
+
+0000000000805508 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  805508:	55                   	push   %rbp
+  805509:	48 89 e5             	mov    %rsp,%rbp
+  80550c:	41 57                	push   %r15
+  80550e:	53                   	push   %rbx
+  80550f:	48 83 ec 20          	sub    $0x20,%rsp
+  805513:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805513 <iscons+0xb>
+  80551a:	49 bb 1d 3b 00 00 00 	movabs $0x3b1d,%r11
+  805521:	00 00 00 
+  805524:	4c 01 db             	add    %r11,%rbx
+  805527:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80552a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80552e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805531:	48 89 d6             	mov    %rdx,%rsi
+  805534:	89 c7                	mov    %eax,%edi
+  805536:	49 89 df             	mov    %rbx,%r15
+  805539:	48 b8 25 9a ff ff ff 	movabs $0xffffffffffff9a25,%rax
+  805540:	ff ff ff 
+  805543:	48 01 d8             	add    %rbx,%rax
+  805546:	ff d0                	call   *%rax
+  805548:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80554b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80554f:	79 05                	jns    805556 <iscons+0x4e>
+		return r;
+  805551:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805554:	eb 1b                	jmp    805571 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  805556:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80555a:	8b 10                	mov    (%rax),%edx
+  80555c:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  805563:	00 00 00 
+  805566:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805569:	39 c2                	cmp    %eax,%edx
+  80556b:	0f 94 c0             	sete   %al
+  80556e:	0f b6 c0             	movzbl %al,%eax
+}
+  805571:	48 83 c4 20          	add    $0x20,%rsp
+  805575:	5b                   	pop    %rbx
+  805576:	41 5f                	pop    %r15
+  805578:	5d                   	pop    %rbp
+  805579:	c3                   	ret
+
+000000000080557a <opencons>:
+
+int
+opencons(void)
+{
+  80557a:	55                   	push   %rbp
+  80557b:	48 89 e5             	mov    %rsp,%rbp
+  80557e:	41 57                	push   %r15
+  805580:	53                   	push   %rbx
+  805581:	48 83 ec 10          	sub    $0x10,%rsp
+  805585:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805585 <opencons+0xb>
+  80558c:	49 bb ab 3a 00 00 00 	movabs $0x3aab,%r11
+  805593:	00 00 00 
+  805596:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805599:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80559d:	48 89 c7             	mov    %rax,%rdi
+  8055a0:	49 89 df             	mov    %rbx,%r15
+  8055a3:	48 b8 6f 99 ff ff ff 	movabs $0xffffffffffff996f,%rax
+  8055aa:	ff ff ff 
+  8055ad:	48 01 d8             	add    %rbx,%rax
+  8055b0:	ff d0                	call   *%rax
+  8055b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055b9:	79 05                	jns    8055c0 <opencons+0x46>
+		return r;
+  8055bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055be:	eb 68                	jmp    805628 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8055c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055c4:	ba 07 04 00 00       	mov    $0x407,%edx
+  8055c9:	48 89 c6             	mov    %rax,%rsi
+  8055cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055d1:	49 89 df             	mov    %rbx,%r15
+  8055d4:	48 b8 4c 91 ff ff ff 	movabs $0xffffffffffff914c,%rax
+  8055db:	ff ff ff 
+  8055de:	48 01 d8             	add    %rbx,%rax
+  8055e1:	ff d0                	call   *%rax
+  8055e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055ea:	79 05                	jns    8055f1 <opencons+0x77>
+		return r;
+  8055ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055ef:	eb 37                	jmp    805628 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8055f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055f5:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  8055fc:	00 00 00 
+  8055ff:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805602:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  805604:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805608:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  80560f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805613:	48 89 c7             	mov    %rax,%rdi
+  805616:	49 89 df             	mov    %rbx,%r15
+  805619:	48 b8 f5 98 ff ff ff 	movabs $0xffffffffffff98f5,%rax
+  805620:	ff ff ff 
+  805623:	48 01 d8             	add    %rbx,%rax
+  805626:	ff d0                	call   *%rax
+}
+  805628:	48 83 c4 10          	add    $0x10,%rsp
+  80562c:	5b                   	pop    %rbx
+  80562d:	41 5f                	pop    %r15
+  80562f:	5d                   	pop    %rbp
+  805630:	c3                   	ret
+
+0000000000805631 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805631:	55                   	push   %rbp
+  805632:	48 89 e5             	mov    %rsp,%rbp
+  805635:	41 57                	push   %r15
+  805637:	53                   	push   %rbx
+  805638:	48 83 ec 30          	sub    $0x30,%rsp
+  80563c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80563c <devcons_read+0xb>
+  805643:	49 bb f4 39 00 00 00 	movabs $0x39f4,%r11
+  80564a:	00 00 00 
+  80564d:	4c 01 db             	add    %r11,%rbx
+  805650:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805654:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805658:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  80565c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805661:	75 19                	jne    80567c <devcons_read+0x4b>
+		return 0;
+  805663:	b8 00 00 00 00       	mov    $0x0,%eax
+  805668:	eb 55                	jmp    8056bf <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  80566a:	49 89 df             	mov    %rbx,%r15
+  80566d:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  805674:	ff ff ff 
+  805677:	48 01 d8             	add    %rbx,%rax
+  80567a:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  80567c:	49 89 df             	mov    %rbx,%r15
+  80567f:	48 b8 f3 8f ff ff ff 	movabs $0xffffffffffff8ff3,%rax
+  805686:	ff ff ff 
+  805689:	48 01 d8             	add    %rbx,%rax
+  80568c:	ff d0                	call   *%rax
+  80568e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805691:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805695:	74 d3                	je     80566a <devcons_read+0x39>
+	if (c < 0)
+  805697:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80569b:	79 05                	jns    8056a2 <devcons_read+0x71>
+		return c;
+  80569d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056a0:	eb 1d                	jmp    8056bf <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8056a2:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8056a6:	75 07                	jne    8056af <devcons_read+0x7e>
+		return 0;
+  8056a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056ad:	eb 10                	jmp    8056bf <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8056af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056b2:	89 c2                	mov    %eax,%edx
+  8056b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056b8:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8056ba:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8056bf:	48 83 c4 30          	add    $0x30,%rsp
+  8056c3:	5b                   	pop    %rbx
+  8056c4:	41 5f                	pop    %r15
+  8056c6:	5d                   	pop    %rbp
+  8056c7:	c3                   	ret
+
+00000000008056c8 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8056c8:	55                   	push   %rbp
+  8056c9:	48 89 e5             	mov    %rsp,%rbp
+  8056cc:	41 57                	push   %r15
+  8056ce:	53                   	push   %rbx
+  8056cf:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8056d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056d6 <devcons_write+0xe>
+  8056dd:	49 bb 5a 39 00 00 00 	movabs $0x395a,%r11
+  8056e4:	00 00 00 
+  8056e7:	4c 01 db             	add    %r11,%rbx
+  8056ea:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8056f1:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8056f8:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8056ff:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805706:	e9 80 00 00 00       	jmp    80578b <devcons_write+0xc3>
+		m = n - tot;
+  80570b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805712:	89 c2                	mov    %eax,%edx
+  805714:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805717:	29 c2                	sub    %eax,%edx
+  805719:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  80571c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80571f:	83 f8 7f             	cmp    $0x7f,%eax
+  805722:	76 07                	jbe    80572b <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  805724:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80572b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80572e:	48 63 d0             	movslq %eax,%rdx
+  805731:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805734:	48 63 c8             	movslq %eax,%rcx
+  805737:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80573e:	48 01 c1             	add    %rax,%rcx
+  805741:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805748:	48 89 ce             	mov    %rcx,%rsi
+  80574b:	48 89 c7             	mov    %rax,%rdi
+  80574e:	49 89 df             	mov    %rbx,%r15
+  805751:	48 b8 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rax
+  805758:	ff ff ff 
+  80575b:	48 01 d8             	add    %rbx,%rax
+  80575e:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  805760:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805763:	48 63 d0             	movslq %eax,%rdx
+  805766:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80576d:	48 89 d6             	mov    %rdx,%rsi
+  805770:	48 89 c7             	mov    %rax,%rdi
+  805773:	49 89 df             	mov    %rbx,%r15
+  805776:	48 b8 94 8f ff ff ff 	movabs $0xffffffffffff8f94,%rax
+  80577d:	ff ff ff 
+  805780:	48 01 d8             	add    %rbx,%rax
+  805783:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  805785:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805788:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80578b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80578e:	48 98                	cltq
+  805790:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  805797:	0f 82 6e ff ff ff    	jb     80570b <devcons_write+0x43>
+	}
+	return tot;
+  80579d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8057a0:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8057a7:	5b                   	pop    %rbx
+  8057a8:	41 5f                	pop    %r15
+  8057aa:	5d                   	pop    %rbp
+  8057ab:	c3                   	ret
+
+00000000008057ac <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8057ac:	55                   	push   %rbp
+  8057ad:	48 89 e5             	mov    %rsp,%rbp
+  8057b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8057b4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8057b4 <devcons_close+0x8>
+  8057bb:	49 bb 7c 38 00 00 00 	movabs $0x387c,%r11
+  8057c2:	00 00 00 
+  8057c5:	4c 01 d8             	add    %r11,%rax
+  8057c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8057cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057d1:	c9                   	leave
+  8057d2:	c3                   	ret
+
+00000000008057d3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8057d3:	55                   	push   %rbp
+  8057d4:	48 89 e5             	mov    %rsp,%rbp
+  8057d7:	41 57                	push   %r15
+  8057d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8057dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8057dd <devcons_stat+0xa>
+  8057e4:	49 bb 53 38 00 00 00 	movabs $0x3853,%r11
+  8057eb:	00 00 00 
+  8057ee:	4c 01 d8             	add    %r11,%rax
+  8057f1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8057f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8057f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8057fd:	48 b9 f5 dd ff ff ff 	movabs $0xffffffffffffddf5,%rcx
+  805804:	ff ff ff 
+  805807:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80580b:	48 89 ce             	mov    %rcx,%rsi
+  80580e:	48 89 d7             	mov    %rdx,%rdi
+  805811:	49 89 c7             	mov    %rax,%r15
+  805814:	48 ba 90 84 ff ff ff 	movabs $0xffffffffffff8490,%rdx
+  80581b:	ff ff ff 
+  80581e:	48 01 c2             	add    %rax,%rdx
+  805821:	ff d2                	call   *%rdx
+	return 0;
+  805823:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805828:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80582c:	c9                   	leave
+  80582d:	c3                   	ret
+
+000000000080582e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80582e:	55                   	push   %rbp
+  80582f:	48 89 e5             	mov    %rsp,%rbp
+  805832:	41 57                	push   %r15
+  805834:	41 54                	push   %r12
+  805836:	53                   	push   %rbx
+  805837:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80583e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80583e <_panic+0x10>
+  805845:	49 bb f2 37 00 00 00 	movabs $0x37f2,%r11
+  80584c:	00 00 00 
+  80584f:	4c 01 db             	add    %r11,%rbx
+  805852:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  805859:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80585f:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  805866:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80586d:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  805874:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80587b:	84 c0                	test   %al,%al
+  80587d:	74 26                	je     8058a5 <_panic+0x77>
+  80587f:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  805886:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80588d:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  805891:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  805895:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  805899:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80589d:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8058a1:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8058a5:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8058ac:	00 00 00 
+  8058af:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8058b6:	00 00 00 
+  8058b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8058bd:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8058c4:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8058cb:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8058d2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8058d9:	ff ff ff 
+  8058dc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058e0:	4c 8b 20             	mov    (%rax),%r12
+  8058e3:	49 89 df             	mov    %rbx,%r15
+  8058e6:	48 b8 a3 90 ff ff ff 	movabs $0xffffffffffff90a3,%rax
+  8058ed:	ff ff ff 
+  8058f0:	48 01 d8             	add    %rbx,%rax
+  8058f3:	ff d0                	call   *%rax
+  8058f5:	89 c6                	mov    %eax,%esi
+  8058f7:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8058fd:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805904:	41 89 d0             	mov    %edx,%r8d
+  805907:	48 89 c1             	mov    %rax,%rcx
+  80590a:	4c 89 e2             	mov    %r12,%rdx
+  80590d:	48 b8 00 de ff ff ff 	movabs $0xffffffffffffde00,%rax
+  805914:	ff ff ff 
+  805917:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80591b:	48 89 c7             	mov    %rax,%rdi
+  80591e:	49 89 df             	mov    %rbx,%r15
+  805921:	b8 00 00 00 00       	mov    $0x0,%eax
+  805926:	49 b9 ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%r9
+  80592d:	ff ff ff 
+  805930:	49 01 d9             	add    %rbx,%r9
+  805933:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  805936:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80593d:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  805944:	48 89 d6             	mov    %rdx,%rsi
+  805947:	48 89 c7             	mov    %rax,%rdi
+  80594a:	49 89 df             	mov    %rbx,%r15
+  80594d:	48 b8 ee 75 ff ff ff 	movabs $0xffffffffffff75ee,%rax
+  805954:	ff ff ff 
+  805957:	48 01 d8             	add    %rbx,%rax
+  80595a:	ff d0                	call   *%rax
+	cprintf("\n");
+  80595c:	48 b8 23 de ff ff ff 	movabs $0xffffffffffffde23,%rax
+  805963:	ff ff ff 
+  805966:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80596a:	48 89 c7             	mov    %rax,%rdi
+  80596d:	49 89 df             	mov    %rbx,%r15
+  805970:	b8 00 00 00 00       	mov    $0x0,%eax
+  805975:	48 ba ce 76 ff ff ff 	movabs $0xffffffffffff76ce,%rdx
+  80597c:	ff ff ff 
+  80597f:	48 01 da             	add    %rbx,%rdx
+  805982:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  805984:	cc                   	int3
+  805985:	eb fd                	jmp    805984 <_panic+0x156>
+
+0000000000805987 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805987:	55                   	push   %rbp
+  805988:	48 89 e5             	mov    %rsp,%rbp
+  80598b:	41 57                	push   %r15
+  80598d:	53                   	push   %rbx
+  80598e:	48 83 ec 30          	sub    $0x30,%rsp
+  805992:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805992 <ipc_recv+0xb>
+  805999:	49 bb 9e 36 00 00 00 	movabs $0x369e,%r11
+  8059a0:	00 00 00 
+  8059a3:	4c 01 db             	add    %r11,%rbx
+  8059a6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8059aa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8059ae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8059b2:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8059b7:	75 0e                	jne    8059c7 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8059b9:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8059c0:	00 00 00 
+  8059c3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8059c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059cb:	48 89 c7             	mov    %rax,%rdi
+  8059ce:	49 89 df             	mov    %rbx,%r15
+  8059d1:	48 b8 75 94 ff ff ff 	movabs $0xffffffffffff9475,%rax
+  8059d8:	ff ff ff 
+  8059db:	48 01 d8             	add    %rbx,%rax
+  8059de:	ff d0                	call   *%rax
+  8059e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8059e3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8059e8:	74 2a                	je     805a14 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8059ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059ee:	75 19                	jne    805a09 <ipc_recv+0x82>
+  8059f0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8059f7:	ff ff ff 
+  8059fa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059fe:	48 8b 00             	mov    (%rax),%rax
+  805a01:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805a07:	eb 05                	jmp    805a0e <ipc_recv+0x87>
+  805a09:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a0e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805a12:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  805a14:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805a19:	74 2a                	je     805a45 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805a1b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a1f:	75 19                	jne    805a3a <ipc_recv+0xb3>
+  805a21:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a28:	ff ff ff 
+  805a2b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a2f:	48 8b 00             	mov    (%rax),%rax
+  805a32:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805a38:	eb 05                	jmp    805a3f <ipc_recv+0xb8>
+  805a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a3f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805a43:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805a45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a49:	74 05                	je     805a50 <ipc_recv+0xc9>
+		return res;
+  805a4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a4e:	eb 17                	jmp    805a67 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805a50:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a57:	ff ff ff 
+  805a5a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a5e:	48 8b 00             	mov    (%rax),%rax
+  805a61:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805a67:	48 83 c4 30          	add    $0x30,%rsp
+  805a6b:	5b                   	pop    %rbx
+  805a6c:	41 5f                	pop    %r15
+  805a6e:	5d                   	pop    %rbp
+  805a6f:	c3                   	ret
+
+0000000000805a70 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805a70:	55                   	push   %rbp
+  805a71:	48 89 e5             	mov    %rsp,%rbp
+  805a74:	41 57                	push   %r15
+  805a76:	53                   	push   %rbx
+  805a77:	48 83 ec 20          	sub    $0x20,%rsp
+  805a7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a7b <ipc_send+0xb>
+  805a82:	49 bb b5 35 00 00 00 	movabs $0x35b5,%r11
+  805a89:	00 00 00 
+  805a8c:	4c 01 db             	add    %r11,%rbx
+  805a8f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a92:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805a95:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805a99:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805a9c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805aa1:	75 0e                	jne    805ab1 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805aa3:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805aaa:	00 00 00 
+  805aad:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805ab1:	90                   	nop
+  805ab2:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805ab5:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805ab8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805abc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805abf:	89 c7                	mov    %eax,%edi
+  805ac1:	49 89 df             	mov    %rbx,%r15
+  805ac4:	48 b8 0b 94 ff ff ff 	movabs $0xffffffffffff940b,%rax
+  805acb:	ff ff ff 
+  805ace:	48 01 d8             	add    %rbx,%rax
+  805ad1:	ff d0                	call   *%rax
+  805ad3:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805ad6:	74 da                	je     805ab2 <ipc_send+0x42>
+		;
+}
+  805ad8:	90                   	nop
+  805ad9:	90                   	nop
+  805ada:	48 83 c4 20          	add    $0x20,%rsp
+  805ade:	5b                   	pop    %rbx
+  805adf:	41 5f                	pop    %r15
+  805ae1:	5d                   	pop    %rbp
+  805ae2:	c3                   	ret
+
+0000000000805ae3 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805ae3:	55                   	push   %rbp
+  805ae4:	48 89 e5             	mov    %rsp,%rbp
+  805ae7:	41 57                	push   %r15
+  805ae9:	53                   	push   %rbx
+  805aea:	48 83 ec 40          	sub    $0x40,%rsp
+  805aee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805aee <ipc_call+0xb>
+  805af5:	49 bb 42 35 00 00 00 	movabs $0x3542,%r11
+  805afc:	00 00 00 
+  805aff:	4c 01 db             	add    %r11,%rbx
+  805b02:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805b05:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805b08:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805b0c:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805b0f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805b13:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805b17:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805b1c:	75 0e                	jne    805b2c <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805b1e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b25:	00 00 00 
+  805b28:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805b2c:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805b31:	75 0e                	jne    805b41 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805b33:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b3a:	00 00 00 
+  805b3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805b41:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805b44:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805b48:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805b4b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b4f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805b58:	49 89 f8             	mov    %rdi,%r8
+  805b5b:	89 c7                	mov    %eax,%edi
+  805b5d:	49 89 df             	mov    %rbx,%r15
+  805b60:	48 b8 ce 94 ff ff ff 	movabs $0xffffffffffff94ce,%rax
+  805b67:	ff ff ff 
+  805b6a:	48 01 d8             	add    %rbx,%rax
+  805b6d:	ff d0                	call   *%rax
+  805b6f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805b72:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805b77:	74 2a                	je     805ba3 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805b79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b7d:	75 19                	jne    805b98 <ipc_call+0xb5>
+  805b7f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b86:	ff ff ff 
+  805b89:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b8d:	48 8b 00             	mov    (%rax),%rax
+  805b90:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805b96:	eb 05                	jmp    805b9d <ipc_call+0xba>
+  805b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b9d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805ba1:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805ba3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ba7:	74 05                	je     805bae <ipc_call+0xcb>
+		return r;
+  805ba9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bac:	eb 17                	jmp    805bc5 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805bae:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bb5:	ff ff ff 
+  805bb8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bbc:	48 8b 00             	mov    (%rax),%rax
+  805bbf:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805bc5:	48 83 c4 40          	add    $0x40,%rsp
+  805bc9:	5b                   	pop    %rbx
+  805bca:	41 5f                	pop    %r15
+  805bcc:	5d                   	pop    %rbp
+  805bcd:	c3                   	ret
+
+0000000000805bce <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805bce:	55                   	push   %rbp
+  805bcf:	48 89 e5             	mov    %rsp,%rbp
+  805bd2:	41 57                	push   %r15
+  805bd4:	53                   	push   %rbx
+  805bd5:	48 83 ec 70          	sub    $0x70,%rsp
+  805bd9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bd9 <ipc_callw+0xb>
+  805be0:	49 bb 57 34 00 00 00 	movabs $0x3457,%r11
+  805be7:	00 00 00 
+  805bea:	4c 01 db             	add    %r11,%rbx
+  805bed:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805bf0:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805bf3:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805bf7:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805bfb:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805c00:	76 0a                	jbe    805c0c <ipc_callw+0x3e>
+		return -E_INVAL;
+  805c02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805c07:	e9 b7 00 00 00       	jmp    805cc3 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805c0c:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805c10:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805c14:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805c18:	48 89 ce             	mov    %rcx,%rsi
+  805c1b:	48 89 c7             	mov    %rax,%rdi
+  805c1e:	49 89 df             	mov    %rbx,%r15
+  805c21:	48 b8 70 88 ff ff ff 	movabs $0xffffffffffff8870,%rax
+  805c28:	ff ff ff 
+  805c2b:	48 01 d8             	add    %rbx,%rax
+  805c2e:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805c30:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805c37:	00 
+  805c38:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805c3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c40:	48 01 d0             	add    %rdx,%rax
+  805c43:	48 83 e8 01          	sub    $0x1,%rax
+  805c47:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805c4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c54:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805c58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c5c:	48 29 d0             	sub    %rdx,%rax
+  805c5f:	48 c1 e8 03          	shr    $0x3,%rax
+  805c63:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805c67:	89 c1                	mov    %eax,%ecx
+  805c69:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805c6c:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805c70:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805c73:	49 89 d1             	mov    %rdx,%r9
+  805c76:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805c7d:	00 00 00 
+  805c80:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805c87:	00 00 00 
+  805c8a:	89 c7                	mov    %eax,%edi
+  805c8c:	49 89 df             	mov    %rbx,%r15
+  805c8f:	48 b8 ce 94 ff ff ff 	movabs $0xffffffffffff94ce,%rax
+  805c96:	ff ff ff 
+  805c99:	48 01 d8             	add    %rbx,%rax
+  805c9c:	ff d0                	call   *%rax
+  805c9e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805ca1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ca5:	74 05                	je     805cac <ipc_callw+0xde>
+		return r;
+  805ca7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805caa:	eb 17                	jmp    805cc3 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805cac:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805cb3:	ff ff ff 
+  805cb6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805cba:	48 8b 00             	mov    (%rax),%rax
+  805cbd:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805cc3:	48 83 c4 70          	add    $0x70,%rsp
+  805cc7:	5b                   	pop    %rbx
+  805cc8:	41 5f                	pop    %r15
+  805cca:	5d                   	pop    %rbp
+  805ccb:	c3                   	ret
+
+0000000000805ccc <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805ccc:	55                   	push   %rbp
+  805ccd:	48 89 e5             	mov    %rsp,%rbp
+  805cd0:	41 57                	push   %r15
+  805cd2:	53                   	push   %rbx
+  805cd3:	48 83 ec 40          	sub    $0x40,%rsp
+  805cd7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cd7 <ipc_callv+0xb>
+  805cde:	49 bb 59 33 00 00 00 	movabs $0x3359,%r11
+  805ce5:	00 00 00 
+  805ce8:	4c 01 db             	add    %r11,%rbx
+  805ceb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805cee:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805cf1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805cf5:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805cf8:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805cfc:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805d00:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805d07:	00 00 00 
+  805d0a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805d0e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805d12:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805d16:	74 11                	je     805d29 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805d18:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805d1c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805d20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805d23:	c1 e0 14             	shl    $0x14,%eax
+  805d26:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805d29:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805d2d:	74 14                	je     805d43 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805d2f:	8b 45 20             	mov    0x20(%rbp),%eax
+  805d32:	83 e8 01             	sub    $0x1,%eax
+  805d35:	48 63 d0             	movslq %eax,%rdx
+  805d38:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d3c:	48 09 d0             	or     %rdx,%rax
+  805d3f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805d43:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805d46:	c1 e0 10             	shl    $0x10,%eax
+  805d49:	0b 45 10             	or     0x10(%rbp),%eax
+  805d4c:	89 c1                	mov    %eax,%ecx
+  805d4e:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805d51:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805d55:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805d59:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805d5d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805d60:	4d 89 c1             	mov    %r8,%r9
+  805d63:	49 89 f8             	mov    %rdi,%r8
+  805d66:	89 c7                	mov    %eax,%edi
+  805d68:	49 89 df             	mov    %rbx,%r15
+  805d6b:	48 b8 ce 94 ff ff ff 	movabs $0xffffffffffff94ce,%rax
+  805d72:	ff ff ff 
+  805d75:	48 01 d8             	add    %rbx,%rax
+  805d78:	ff d0                	call   *%rax
+  805d7a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805d7d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805d81:	74 05                	je     805d88 <ipc_callv+0xbc>
+		return r;
+  805d83:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d86:	eb 17                	jmp    805d9f <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805d88:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d8f:	ff ff ff 
+  805d92:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d96:	48 8b 00             	mov    (%rax),%rax
+  805d99:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805d9f:	48 83 c4 40          	add    $0x40,%rsp
+  805da3:	5b                   	pop    %rbx
+  805da4:	41 5f                	pop    %r15
+  805da6:	5d                   	pop    %rbp
+  805da7:	c3                   	ret
+
+0000000000805da8 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805da8:	55                   	push   %rbp
+  805da9:	48 89 e5             	mov    %rsp,%rbp
+  805dac:	41 57                	push   %r15
+  805dae:	53                   	push   %rbx
+  805daf:	48 83 ec 40          	sub    $0x40,%rsp
+  805db3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805db3 <ipc_reply_recv+0xb>
+  805dba:	49 bb 7d 32 00 00 00 	movabs $0x327d,%r11
+  805dc1:	00 00 00 
+  805dc4:	4c 01 db             	add    %r11,%rbx
+  805dc7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805dca:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805dcd:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805dd1:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805dd4:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805dd8:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805ddc:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805de1:	75 0e                	jne    805df1 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805de3:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805dea:	00 00 00 
+  805ded:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805df1:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805df6:	75 0e                	jne    805e06 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805df8:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805dff:	00 00 00 
+  805e02:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805e06:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805e09:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805e0d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805e11:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805e14:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805e18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e1b:	4d 89 c1             	mov    %r8,%r9
+  805e1e:	49 89 f8             	mov    %rdi,%r8
+  805e21:	89 c7                	mov    %eax,%edi
+  805e23:	49 89 df             	mov    %rbx,%r15
+  805e26:	48 b8 42 95 ff ff ff 	movabs $0xffffffffffff9542,%rax
+  805e2d:	ff ff ff 
+  805e30:	48 01 d8             	add    %rbx,%rax
+  805e33:	ff d0                	call   *%rax
+  805e35:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805e38:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805e3d:	74 2a                	je     805e69 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805e3f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e43:	75 19                	jne    805e5e <ipc_reply_recv+0xb6>
+  805e45:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e4c:	ff ff ff 
+  805e4f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e53:	48 8b 00             	mov    (%rax),%rax
+  805e56:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805e5c:	eb 05                	jmp    805e63 <ipc_reply_recv+0xbb>
+  805e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805e67:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805e69:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805e6e:	74 2a                	je     805e9a <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805e70:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e74:	75 19                	jne    805e8f <ipc_reply_recv+0xe7>
+  805e76:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e7d:	ff ff ff 
+  805e80:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e84:	48 8b 00             	mov    (%rax),%rax
+  805e87:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805e8d:	eb 05                	jmp    805e94 <ipc_reply_recv+0xec>
+  805e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e94:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805e98:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805e9a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e9e:	74 05                	je     805ea5 <ipc_reply_recv+0xfd>
+		return r;
+  805ea0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ea3:	eb 17                	jmp    805ebc <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805ea5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805eac:	ff ff ff 
+  805eaf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805eb3:	48 8b 00             	mov    (%rax),%rax
+  805eb6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805ebc:	48 83 c4 40          	add    $0x40,%rsp
+  805ec0:	5b                   	pop    %rbx
+  805ec1:	41 5f                	pop    %r15
+  805ec3:	5d                   	pop    %rbp
+  805ec4:	c3                   	ret
+
+0000000000805ec5 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805ec5:	55                   	push   %rbp
+  805ec6:	48 89 e5             	mov    %rsp,%rbp
+  805ec9:	41 57                	push   %r15
+  805ecb:	53                   	push   %rbx
+  805ecc:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805ed3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ed3 <ipc_window_batch+0xe>
+  805eda:	49 bb 5d 31 00 00 00 	movabs $0x315d,%r11
+  805ee1:	00 00 00 
+  805ee4:	4c 01 db             	add    %r11,%rbx
+  805ee7:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805eed:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805ef4:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805efa:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805f00:	e9 15 01 00 00       	jmp    80601a <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805f05:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805f0b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805f0e:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805f15:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805f18:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f1b:	39 c2                	cmp    %eax,%edx
+  805f1d:	0f 4e c2             	cmovle %edx,%eax
+  805f20:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805f23:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805f2a:	eb 6b                	jmp    805f97 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805f2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f2f:	48 98                	cltq
+  805f31:	48 c1 e0 05          	shl    $0x5,%rax
+  805f35:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f39:	48 01 e8             	add    %rbp,%rax
+  805f3c:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805f42:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805f48:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f4b:	c1 e0 0c             	shl    $0xc,%eax
+  805f4e:	48 63 d0             	movslq %eax,%rdx
+  805f51:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805f58:	48 01 c2             	add    %rax,%rdx
+  805f5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f5e:	48 98                	cltq
+  805f60:	48 c1 e0 05          	shl    $0x5,%rax
+  805f64:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f68:	48 01 e8             	add    %rbp,%rax
+  805f6b:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805f71:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805f74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f77:	48 98                	cltq
+  805f79:	48 c1 e0 05          	shl    $0x5,%rax
+  805f7d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f81:	48 01 e8             	add    %rbp,%rax
+  805f84:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805f8b:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805f91:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805f93:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805f97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f9a:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805f9d:	7c 8d                	jl     805f2c <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805f9f:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805fa6:	74 27                	je     805fcf <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805fa8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805fab:	48 63 d0             	movslq %eax,%rdx
+  805fae:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805fb5:	48 89 d6             	mov    %rdx,%rsi
+  805fb8:	48 89 c7             	mov    %rax,%rdi
+  805fbb:	49 89 df             	mov    %rbx,%r15
+  805fbe:	48 b8 e5 97 ff ff ff 	movabs $0xffffffffffff97e5,%rax
+  805fc5:	ff ff ff 
+  805fc8:	48 01 d8             	add    %rbx,%rax
+  805fcb:	ff d0                	call   *%rax
+  805fcd:	eb 25                	jmp    805ff4 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805fcf:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805fd2:	48 63 d0             	movslq %eax,%rdx
+  805fd5:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805fdc:	48 89 d6             	mov    %rdx,%rsi
+  805fdf:	48 89 c7             	mov    %rax,%rdi
+  805fe2:	49 89 df             	mov    %rbx,%r15
+  805fe5:	48 b8 43 98 ff ff ff 	movabs $0xffffffffffff9843,%rax
+  805fec:	ff ff ff 
+  805fef:	48 01 d8             	add    %rbx,%rax
+  805ff2:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805ff4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805ff7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ffb:	79 05                	jns    806002 <ipc_window_batch+0x13d>
+			return r;
+  805ffd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806000:	eb 2a                	jmp    80602c <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806002:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806005:	c1 e0 0c             	shl    $0xc,%eax
+  806008:	48 98                	cltq
+  80600a:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806011:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806014:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  80601a:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806021:	0f 8f de fe ff ff    	jg     805f05 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806027:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80602c:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806033:	5b                   	pop    %rbx
+  806034:	41 5f                	pop    %r15
+  806036:	5d                   	pop    %rbp
+  806037:	c3                   	ret
+
+0000000000806038 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806038:	55                   	push   %rbp
+  806039:	48 89 e5             	mov    %rsp,%rbp
+  80603c:	48 83 ec 10          	sub    $0x10,%rsp
+  806040:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806040 <ipc_map_window+0x8>
+  806047:	49 bb f0 2f 00 00 00 	movabs $0x2ff0,%r11
+  80604e:	00 00 00 
+  806051:	4c 01 d8             	add    %r11,%rax
+  806054:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806058:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  80605b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80605e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806062:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806067:	bf 01 00 00 00       	mov    $0x1,%edi
+  80606c:	49 b8 95 ce ff ff ff 	movabs $0xffffffffffffce95,%r8
+  806073:	ff ff ff 
+  806076:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80607a:	ff d0                	call   *%rax
+}
+  80607c:	c9                   	leave
+  80607d:	c3                   	ret
+
+000000000080607e <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  80607e:	55                   	push   %rbp
+  80607f:	48 89 e5             	mov    %rsp,%rbp
+  806082:	48 83 ec 10          	sub    $0x10,%rsp
+  806086:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806086 <ipc_unmap_window+0x8>
+  80608d:	49 bb aa 2f 00 00 00 	movabs $0x2faa,%r11
+  806094:	00 00 00 
+  806097:	4c 01 d8             	add    %r11,%rax
+  80609a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80609e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8060a1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8060a4:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8060a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8060ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060b2:	49 b8 95 ce ff ff ff 	movabs $0xffffffffffffce95,%r8
+  8060b9:	ff ff ff 
+  8060bc:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8060c0:	ff d0                	call   *%rax
+}
+  8060c2:	c9                   	leave
+  8060c3:	c3                   	ret
+
+00000000008060c4 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8060c4:	55                   	push   %rbp
+  8060c5:	48 89 e5             	mov    %rsp,%rbp
+  8060c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8060cc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060cc <ipc_find_env+0x8>
+  8060d3:	49 bb 64 2f 00 00 00 	movabs $0x2f64,%r11
+  8060da:	00 00 00 
+  8060dd:	4c 01 d8             	add    %r11,%rax
+  8060e0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  8060e3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8060ea:	eb 57                	jmp    806143 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  8060ec:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8060f3:	ff ff ff 
+  8060f6:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8060fa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8060fd:	48 63 d2             	movslq %edx,%rdx
+  806100:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806107:	48 01 ca             	add    %rcx,%rdx
+  80610a:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806111:	8b 12                	mov    (%rdx),%edx
+  806113:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806116:	75 27                	jne    80613f <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806118:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  80611f:	ff ff ff 
+  806122:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806126:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806129:	48 98                	cltq
+  80612b:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806132:	48 01 d0             	add    %rdx,%rax
+  806135:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80613b:	8b 00                	mov    (%rax),%eax
+  80613d:	eb 12                	jmp    806151 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  80613f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806143:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80614a:	7e a0                	jle    8060ec <ipc_find_env+0x28>
+	}
+	return 0;
+  80614c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806151:	c9                   	leave
+  806152:	c3                   	ret
+
+0000000000806153 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806153:	55                   	push   %rbp
+  806154:	48 89 e5             	mov    %rsp,%rbp
+  806157:	48 83 ec 18          	sub    $0x18,%rsp
+  80615b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80615b <pageref+0x8>
+  806162:	49 bb d5 2e 00 00 00 	movabs $0x2ed5,%r11
+  806169:	00 00 00 
+  80616c:	4c 01 d8             	add    %r11,%rax
+  80616f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806173:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806177:	48 89 d1             	mov    %rdx,%rcx
+  80617a:	48 c1 e9 15          	shr    $0x15,%rcx
+  80617e:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806185:	ff ff ff 
+  806188:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80618c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806190:	83 e2 01             	and    $0x1,%edx
+  806193:	48 85 d2             	test   %rdx,%rdx
+  806196:	75 07                	jne    80619f <pageref+0x4c>
+		return 0;
+  806198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80619d:	eb 64                	jmp    806203 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  80619f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8061a3:	48 89 d1             	mov    %rdx,%rcx
+  8061a6:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8061aa:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8061b1:	ff ff ff 
+  8061b4:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8061b8:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8061bc:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8061c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8061c4:	83 e2 01             	and    $0x1,%edx
+  8061c7:	48 85 d2             	test   %rdx,%rdx
+  8061ca:	75 07                	jne    8061d3 <pageref+0x80>
+		return 0;
+  8061cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061d1:	eb 30                	jmp    806203 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8061d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8061d7:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8061db:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  8061e2:	ff ff ff 
+  8061e5:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8061e9:	48 89 d0             	mov    %rdx,%rax
+  8061ec:	48 01 c0             	add    %rax,%rax
+  8061ef:	48 01 d0             	add    %rdx,%rax
+  8061f2:	48 c1 e0 03          	shl    $0x3,%rax
+  8061f6:	48 01 c8             	add    %rcx,%rax
+  8061f9:	48 83 c0 08          	add    $0x8,%rax
+  8061fd:	0f b7 00             	movzwl (%rax),%eax
+  806200:	0f b7 c0             	movzwl %ax,%eax
+}
+  806203:	c9                   	leave
+  806204:	c3                   	ret
+
+0000000000806205 <inet_addr>:
+ * @param cp IP address in ascii represenation (e.g. "127.0.0.1")
+ * @return ip address in network order
+ */
+u32_t
+inet_addr(const char *cp)
+{
+  806205:	55                   	push   %rbp
+  806206:	48 89 e5             	mov    %rsp,%rbp
+  806209:	48 83 ec 20          	sub    $0x20,%rsp
+  80620d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80620d <inet_addr+0x8>
+  806214:	49 bb 23 2e 00 00 00 	movabs $0x2e23,%r11
+  80621b:	00 00 00 
+  80621e:	4c 01 d8             	add    %r11,%rax
+  806221:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct in_addr val;
+
+  if (inet_aton(cp, &val)) {
+  806225:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  806229:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80622d:	48 89 ce             	mov    %rcx,%rsi
+  806230:	48 89 d7             	mov    %rdx,%rdi
+  806233:	48 ba 23 d2 ff ff ff 	movabs $0xffffffffffffd223,%rdx
+  80623a:	ff ff ff 
+  80623d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806241:	ff d0                	call   *%rax
+  806243:	85 c0                	test   %eax,%eax
+  806245:	74 05                	je     80624c <inet_addr+0x47>
+    return (val.s_addr);
+  806247:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80624a:	eb 05                	jmp    806251 <inet_addr+0x4c>
+  }
+  return (INADDR_NONE);
+  80624c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  806251:	c9                   	leave
+  806252:	c3                   	ret
+
+0000000000806253 <inet_aton>:
+ * @param addr pointer to which to save the ip address in network order
+ * @return 1 if cp could be converted to addr, 0 on failure
+ */
+int
+inet_aton(const char *cp, struct in_addr *addr)
+{
+  806253:	55                   	push   %rbp
+  806254:	48 89 e5             	mov    %rsp,%rbp
+  806257:	48 83 ec 40          	sub    $0x40,%rsp
+  80625b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80625b <inet_aton+0x8>
+  806262:	49 bb d5 2d 00 00 00 	movabs $0x2dd5,%r11
+  806269:	00 00 00 
+  80626c:	4c 01 d8             	add    %r11,%rax
+  80626f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806273:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  u32_t val;
+  int base, n, c;
+  u32_t parts[4];
+  u32_t *pp = parts;
+  806277:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  80627b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+
+  c = *cp;
+  80627f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806283:	0f b6 12             	movzbl (%rdx),%edx
+  806286:	0f be d2             	movsbl %dl,%edx
+  806289:	89 55 f4             	mov    %edx,-0xc(%rbp)
+    /*
+     * Collect number up to ``.''.
+     * Values are specified as for C:
+     * 0x=hex, 0=octal, 1-9=decimal.
+     */
+    if (!isdigit(c))
+  80628c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80628f:	80 fa 2f             	cmp    $0x2f,%dl
+  806292:	76 08                	jbe    80629c <inet_aton+0x49>
+  806294:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806297:	80 fa 39             	cmp    $0x39,%dl
+  80629a:	76 0a                	jbe    8062a6 <inet_aton+0x53>
+      return (0);
+  80629c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062a1:	e9 7c 02 00 00       	jmp    806522 <inet_aton+0x2cf>
+    val = 0;
+  8062a6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    base = 10;
+  8062ad:	c7 45 f8 0a 00 00 00 	movl   $0xa,-0x8(%rbp)
+    if (c == '0') {
+  8062b4:	83 7d f4 30          	cmpl   $0x30,-0xc(%rbp)
+  8062b8:	75 40                	jne    8062fa <inet_aton+0xa7>
+      c = *++cp;
+  8062ba:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8062bf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8062c3:	0f b6 12             	movzbl (%rdx),%edx
+  8062c6:	0f be d2             	movsbl %dl,%edx
+  8062c9:	89 55 f4             	mov    %edx,-0xc(%rbp)
+      if (c == 'x' || c == 'X') {
+  8062cc:	83 7d f4 78          	cmpl   $0x78,-0xc(%rbp)
+  8062d0:	74 06                	je     8062d8 <inet_aton+0x85>
+  8062d2:	83 7d f4 58          	cmpl   $0x58,-0xc(%rbp)
+  8062d6:	75 1b                	jne    8062f3 <inet_aton+0xa0>
+        base = 16;
+  8062d8:	c7 45 f8 10 00 00 00 	movl   $0x10,-0x8(%rbp)
+        c = *++cp;
+  8062df:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8062e4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8062e8:	0f b6 12             	movzbl (%rdx),%edx
+  8062eb:	0f be d2             	movsbl %dl,%edx
+  8062ee:	89 55 f4             	mov    %edx,-0xc(%rbp)
+  8062f1:	eb 07                	jmp    8062fa <inet_aton+0xa7>
+      } else
+        base = 8;
+  8062f3:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+    }
+    for (;;) {
+      if (isdigit(c)) {
+  8062fa:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8062fd:	80 fa 2f             	cmp    $0x2f,%dl
+  806300:	76 30                	jbe    806332 <inet_aton+0xdf>
+  806302:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806305:	80 fa 39             	cmp    $0x39,%dl
+  806308:	77 28                	ja     806332 <inet_aton+0xdf>
+        val = (val * base) + (int)(c - '0');
+  80630a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80630d:	89 d1                	mov    %edx,%ecx
+  80630f:	0f af 4d fc          	imul   -0x4(%rbp),%ecx
+  806313:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806316:	01 ca                	add    %ecx,%edx
+  806318:	83 ea 30             	sub    $0x30,%edx
+  80631b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        c = *++cp;
+  80631e:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  806323:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806327:	0f b6 12             	movzbl (%rdx),%edx
+  80632a:	0f be d2             	movsbl %dl,%edx
+  80632d:	89 55 f4             	mov    %edx,-0xc(%rbp)
+  806330:	eb 7b                	jmp    8063ad <inet_aton+0x15a>
+      } else if (base == 16 && isxdigit(c)) {
+  806332:	83 7d f8 10          	cmpl   $0x10,-0x8(%rbp)
+  806336:	75 7a                	jne    8063b2 <inet_aton+0x15f>
+  806338:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80633b:	80 fa 2f             	cmp    $0x2f,%dl
+  80633e:	76 08                	jbe    806348 <inet_aton+0xf5>
+  806340:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806343:	80 fa 39             	cmp    $0x39,%dl
+  806346:	76 20                	jbe    806368 <inet_aton+0x115>
+  806348:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80634b:	80 fa 60             	cmp    $0x60,%dl
+  80634e:	76 08                	jbe    806358 <inet_aton+0x105>
+  806350:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806353:	80 fa 66             	cmp    $0x66,%dl
+  806356:	76 10                	jbe    806368 <inet_aton+0x115>
+  806358:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80635b:	80 fa 40             	cmp    $0x40,%dl
+  80635e:	76 52                	jbe    8063b2 <inet_aton+0x15f>
+  806360:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806363:	80 fa 46             	cmp    $0x46,%dl
+  806366:	77 4a                	ja     8063b2 <inet_aton+0x15f>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  806368:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80636b:	89 d1                	mov    %edx,%ecx
+  80636d:	c1 e1 04             	shl    $0x4,%ecx
+  806370:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806373:	83 c2 0a             	add    $0xa,%edx
+  806376:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  806379:	40 80 fe 60          	cmp    $0x60,%sil
+  80637d:	76 10                	jbe    80638f <inet_aton+0x13c>
+  80637f:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  806382:	40 80 fe 7a          	cmp    $0x7a,%sil
+  806386:	77 07                	ja     80638f <inet_aton+0x13c>
+  806388:	be 61 00 00 00       	mov    $0x61,%esi
+  80638d:	eb 05                	jmp    806394 <inet_aton+0x141>
+  80638f:	be 41 00 00 00       	mov    $0x41,%esi
+  806394:	29 f2                	sub    %esi,%edx
+  806396:	09 ca                	or     %ecx,%edx
+  806398:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        c = *++cp;
+  80639b:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8063a0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8063a4:	0f b6 12             	movzbl (%rdx),%edx
+  8063a7:	0f be d2             	movsbl %dl,%edx
+  8063aa:	89 55 f4             	mov    %edx,-0xc(%rbp)
+      if (isdigit(c)) {
+  8063ad:	e9 48 ff ff ff       	jmp    8062fa <inet_aton+0xa7>
+      } else
+        break;
+    }
+    if (c == '.') {
+  8063b2:	83 7d f4 2e          	cmpl   $0x2e,-0xc(%rbp)
+  8063b6:	75 40                	jne    8063f8 <inet_aton+0x1a5>
+       * Internet format:
+       *  a.b.c.d
+       *  a.b.c   (with c treated as 16 bits)
+       *  a.b (with b treated as 24 bits)
+       */
+      if (pp >= parts + 3)
+  8063b8:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8063bc:	48 83 c2 0c          	add    $0xc,%rdx
+  8063c0:	48 39 55 e8          	cmp    %rdx,-0x18(%rbp)
+  8063c4:	72 0a                	jb     8063d0 <inet_aton+0x17d>
+        return (0);
+  8063c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063cb:	e9 52 01 00 00       	jmp    806522 <inet_aton+0x2cf>
+      *pp++ = val;
+  8063d0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8063d4:	48 8d 4a 04          	lea    0x4(%rdx),%rcx
+  8063d8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8063dc:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8063df:	89 0a                	mov    %ecx,(%rdx)
+      c = *++cp;
+  8063e1:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8063e6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8063ea:	0f b6 12             	movzbl (%rdx),%edx
+  8063ed:	0f be d2             	movsbl %dl,%edx
+  8063f0:	89 55 f4             	mov    %edx,-0xc(%rbp)
+    if (!isdigit(c))
+  8063f3:	e9 94 fe ff ff       	jmp    80628c <inet_aton+0x39>
+    } else
+      break;
+  8063f8:	90                   	nop
+  }
+  /*
+   * Check for trailing characters.
+   */
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8063f9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8063fd:	74 3d                	je     80643c <inet_aton+0x1e9>
+  8063ff:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806402:	80 fa 1f             	cmp    $0x1f,%dl
+  806405:	76 2b                	jbe    806432 <inet_aton+0x1df>
+  806407:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80640a:	84 d2                	test   %dl,%dl
+  80640c:	78 24                	js     806432 <inet_aton+0x1df>
+  80640e:	83 7d f4 20          	cmpl   $0x20,-0xc(%rbp)
+  806412:	74 28                	je     80643c <inet_aton+0x1e9>
+  806414:	83 7d f4 0c          	cmpl   $0xc,-0xc(%rbp)
+  806418:	74 22                	je     80643c <inet_aton+0x1e9>
+  80641a:	83 7d f4 0a          	cmpl   $0xa,-0xc(%rbp)
+  80641e:	74 1c                	je     80643c <inet_aton+0x1e9>
+  806420:	83 7d f4 0d          	cmpl   $0xd,-0xc(%rbp)
+  806424:	74 16                	je     80643c <inet_aton+0x1e9>
+  806426:	83 7d f4 09          	cmpl   $0x9,-0xc(%rbp)
+  80642a:	74 10                	je     80643c <inet_aton+0x1e9>
+  80642c:	83 7d f4 0b          	cmpl   $0xb,-0xc(%rbp)
+  806430:	74 0a                	je     80643c <inet_aton+0x1e9>
+    return (0);
+  806432:	b8 00 00 00 00       	mov    $0x0,%eax
+  806437:	e9 e6 00 00 00       	jmp    806522 <inet_aton+0x2cf>
+  /*
+   * Concoct the address according to
+   * the number of parts specified.
+   */
+  n = pp - parts + 1;
+  80643c:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  806440:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806444:	48 29 d1             	sub    %rdx,%rcx
+  806447:	48 c1 f9 02          	sar    $0x2,%rcx
+  80644b:	48 89 ca             	mov    %rcx,%rdx
+  80644e:	83 c2 01             	add    $0x1,%edx
+  806451:	89 55 e4             	mov    %edx,-0x1c(%rbp)
+  switch (n) {
+  806454:	83 7d e4 04          	cmpl   $0x4,-0x1c(%rbp)
+  806458:	0f 87 9d 00 00 00    	ja     8064fb <inet_aton+0x2a8>
+  80645e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  806461:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+  806468:	00 
+  806469:	48 8d 15 e8 09 00 00 	lea    0x9e8(%rip),%rdx        # 806e58 <.LC1+0x5>
+  806470:	48 8b 14 11          	mov    (%rcx,%rdx,1),%rdx
+  806474:	48 8d 0d dd 09 00 00 	lea    0x9dd(%rip),%rcx        # 806e58 <.LC1+0x5>
+  80647b:	48 01 ca             	add    %rcx,%rdx
+  80647e:	ff e2                	jmp    *%rdx
+
+  case 0:
+    return (0);       /* initial nondigit */
+  806480:	b8 00 00 00 00       	mov    $0x0,%eax
+  806485:	e9 98 00 00 00       	jmp    806522 <inet_aton+0x2cf>
+
+  case 1:             /* a -- 32 bits */
+    break;
+
+  case 2:             /* a.b -- 8.24 bits */
+    if (val > 0xffffffUL)
+  80648a:	81 7d fc ff ff ff 00 	cmpl   $0xffffff,-0x4(%rbp)
+  806491:	76 0a                	jbe    80649d <inet_aton+0x24a>
+      return (0);
+  806493:	b8 00 00 00 00       	mov    $0x0,%eax
+  806498:	e9 85 00 00 00       	jmp    806522 <inet_aton+0x2cf>
+    val |= parts[0] << 24;
+  80649d:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8064a0:	c1 e2 18             	shl    $0x18,%edx
+  8064a3:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  8064a6:	eb 53                	jmp    8064fb <inet_aton+0x2a8>
+
+  case 3:             /* a.b.c -- 8.8.16 bits */
+    if (val > 0xffff)
+  8064a8:	81 7d fc ff ff 00 00 	cmpl   $0xffff,-0x4(%rbp)
+  8064af:	76 07                	jbe    8064b8 <inet_aton+0x265>
+      return (0);
+  8064b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064b6:	eb 6a                	jmp    806522 <inet_aton+0x2cf>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  8064b8:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8064bb:	89 d1                	mov    %edx,%ecx
+  8064bd:	c1 e1 18             	shl    $0x18,%ecx
+  8064c0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8064c3:	c1 e2 10             	shl    $0x10,%edx
+  8064c6:	09 ca                	or     %ecx,%edx
+  8064c8:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  8064cb:	eb 2e                	jmp    8064fb <inet_aton+0x2a8>
+
+  case 4:             /* a.b.c.d -- 8.8.8.8 bits */
+    if (val > 0xff)
+  8064cd:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%rbp)
+  8064d4:	76 07                	jbe    8064dd <inet_aton+0x28a>
+      return (0);
+  8064d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064db:	eb 45                	jmp    806522 <inet_aton+0x2cf>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  8064dd:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8064e0:	89 d1                	mov    %edx,%ecx
+  8064e2:	c1 e1 18             	shl    $0x18,%ecx
+  8064e5:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8064e8:	c1 e2 10             	shl    $0x10,%edx
+  8064eb:	09 d1                	or     %edx,%ecx
+  8064ed:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8064f0:	c1 e2 08             	shl    $0x8,%edx
+  8064f3:	09 ca                	or     %ecx,%edx
+  8064f5:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  8064f8:	eb 01                	jmp    8064fb <inet_aton+0x2a8>
+    break;
+  8064fa:	90                   	nop
+  }
+  if (addr)
+  8064fb:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806500:	74 1b                	je     80651d <inet_aton+0x2ca>
+    addr->s_addr = htonl(val);
+  806502:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806505:	89 d7                	mov    %edx,%edi
+  806507:	48 ba 8f d6 ff ff ff 	movabs $0xffffffffffffd68f,%rdx
+  80650e:	ff ff ff 
+  806511:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806515:	ff d0                	call   *%rax
+  806517:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80651b:	89 02                	mov    %eax,(%rdx)
+  return (1);
+  80651d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806522:	c9                   	leave
+  806523:	c3                   	ret
+
+0000000000806524 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  806524:	55                   	push   %rbp
+  806525:	48 89 e5             	mov    %rsp,%rbp
+  806528:	48 83 ec 28          	sub    $0x28,%rsp
+  80652c:	48 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%rdx        # 80652c <inet_ntoa+0x8>
+  806533:	49 bb 04 2b 00 00 00 	movabs $0x2b04,%r11
+  80653a:	00 00 00 
+  80653d:	4c 01 da             	add    %r11,%rdx
+  806540:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  806543:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806546:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  u8_t *ap;
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  806549:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  806550:	00 00 00 
+  806553:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  806557:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  ap = (u8_t *)&s_addr;
+  80655b:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80655f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(n = 0; n < 4; n++) {
+  806563:	c6 45 ef 00          	movb   $0x0,-0x11(%rbp)
+  806567:	e9 bc 00 00 00       	jmp    806628 <inet_ntoa+0x104>
+    i = 0;
+  80656c:	c6 45 ee 00          	movb   $0x0,-0x12(%rbp)
+    do {
+      rem = *ap % (u8_t)10;
+  806570:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806574:	0f b6 08             	movzbl (%rax),%ecx
+  806577:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  80657c:	89 f0                	mov    %esi,%eax
+  80657e:	f6 e1                	mul    %cl
+  806580:	66 c1 e8 08          	shr    $0x8,%ax
+  806584:	c0 e8 03             	shr    $0x3,%al
+  806587:	88 45 ed             	mov    %al,-0x13(%rbp)
+  80658a:	0f b6 75 ed          	movzbl -0x13(%rbp),%esi
+  80658e:	89 f0                	mov    %esi,%eax
+  806590:	c1 e0 02             	shl    $0x2,%eax
+  806593:	01 f0                	add    %esi,%eax
+  806595:	01 c0                	add    %eax,%eax
+  806597:	29 c1                	sub    %eax,%ecx
+  806599:	88 4d ed             	mov    %cl,-0x13(%rbp)
+      *ap /= (u8_t)10;
+  80659c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065a0:	0f b6 00             	movzbl (%rax),%eax
+  8065a3:	b9 cd ff ff ff       	mov    $0xffffffcd,%ecx
+  8065a8:	f6 e1                	mul    %cl
+  8065aa:	66 c1 e8 08          	shr    $0x8,%ax
+  8065ae:	89 c1                	mov    %eax,%ecx
+  8065b0:	c0 e9 03             	shr    $0x3,%cl
+  8065b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065b7:	88 08                	mov    %cl,(%rax)
+      inv[i++] = '0' + rem;
+  8065b9:	0f b6 45 ed          	movzbl -0x13(%rbp),%eax
+  8065bd:	8d 70 30             	lea    0x30(%rax),%esi
+  8065c0:	0f b6 45 ee          	movzbl -0x12(%rbp),%eax
+  8065c4:	8d 48 01             	lea    0x1(%rax),%ecx
+  8065c7:	88 4d ee             	mov    %cl,-0x12(%rbp)
+  8065ca:	0f b6 c0             	movzbl %al,%eax
+  8065cd:	89 f1                	mov    %esi,%ecx
+  8065cf:	48 98                	cltq
+  8065d1:	88 4c 05 e5          	mov    %cl,-0x1b(%rbp,%rax,1)
+    } while(*ap);
+  8065d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065d9:	0f b6 00             	movzbl (%rax),%eax
+  8065dc:	84 c0                	test   %al,%al
+  8065de:	75 90                	jne    806570 <inet_ntoa+0x4c>
+    while(i--)
+  8065e0:	eb 1a                	jmp    8065fc <inet_ntoa+0xd8>
+      *rp++ = inv[i];
+  8065e2:	0f b6 75 ee          	movzbl -0x12(%rbp),%esi
+  8065e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065ea:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8065ee:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  8065f2:	48 63 ce             	movslq %esi,%rcx
+  8065f5:	0f b6 4c 0d e5       	movzbl -0x1b(%rbp,%rcx,1),%ecx
+  8065fa:	88 08                	mov    %cl,(%rax)
+    while(i--)
+  8065fc:	0f b6 45 ee          	movzbl -0x12(%rbp),%eax
+  806600:	8d 48 ff             	lea    -0x1(%rax),%ecx
+  806603:	88 4d ee             	mov    %cl,-0x12(%rbp)
+  806606:	84 c0                	test   %al,%al
+  806608:	75 d8                	jne    8065e2 <inet_ntoa+0xbe>
+    *rp++ = '.';
+  80660a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80660e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  806612:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  806616:	c6 00 2e             	movb   $0x2e,(%rax)
+    ap++;
+  806619:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  for(n = 0; n < 4; n++) {
+  80661e:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  806622:	83 c0 01             	add    $0x1,%eax
+  806625:	88 45 ef             	mov    %al,-0x11(%rbp)
+  806628:	80 7d ef 03          	cmpb   $0x3,-0x11(%rbp)
+  80662c:	0f 86 3a ff ff ff    	jbe    80656c <inet_ntoa+0x48>
+  }
+  *--rp = 0;
+  806632:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  806637:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80663b:	c6 00 00             	movb   $0x0,(%rax)
+  return str;
+  80663e:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  806645:	00 00 00 
+  806648:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+}
+  80664c:	c9                   	leave
+  80664d:	c3                   	ret
+
+000000000080664e <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  80664e:	55                   	push   %rbp
+  80664f:	48 89 e5             	mov    %rsp,%rbp
+  806652:	48 83 ec 08          	sub    $0x8,%rsp
+  806656:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806656 <htons+0x8>
+  80665d:	49 bb da 29 00 00 00 	movabs $0x29da,%r11
+  806664:	00 00 00 
+  806667:	4c 01 d8             	add    %r11,%rax
+  80666a:	89 f8                	mov    %edi,%eax
+  80666c:	66 89 45 fc          	mov    %ax,-0x4(%rbp)
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  806670:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+  806674:	c1 e0 08             	shl    $0x8,%eax
+  806677:	89 c2                	mov    %eax,%edx
+  806679:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+  80667d:	66 c1 e8 08          	shr    $0x8,%ax
+  806681:	09 d0                	or     %edx,%eax
+}
+  806683:	c9                   	leave
+  806684:	c3                   	ret
+
+0000000000806685 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  806685:	55                   	push   %rbp
+  806686:	48 89 e5             	mov    %rsp,%rbp
+  806689:	48 83 ec 08          	sub    $0x8,%rsp
+  80668d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80668d <ntohs+0x8>
+  806694:	49 bb a3 29 00 00 00 	movabs $0x29a3,%r11
+  80669b:	00 00 00 
+  80669e:	4c 01 d8             	add    %r11,%rax
+  8066a1:	89 fa                	mov    %edi,%edx
+  8066a3:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+  return htons(n);
+  8066a7:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+  8066ab:	89 d7                	mov    %edx,%edi
+  8066ad:	48 ba 1e d6 ff ff ff 	movabs $0xffffffffffffd61e,%rdx
+  8066b4:	ff ff ff 
+  8066b7:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8066bb:	ff d0                	call   *%rax
+}
+  8066bd:	c9                   	leave
+  8066be:	c3                   	ret
+
+00000000008066bf <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  8066bf:	55                   	push   %rbp
+  8066c0:	48 89 e5             	mov    %rsp,%rbp
+  8066c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8066c7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8066c7 <htonl+0x8>
+  8066ce:	49 bb 69 29 00 00 00 	movabs $0x2969,%r11
+  8066d5:	00 00 00 
+  8066d8:	4c 01 d8             	add    %r11,%rax
+  8066db:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return ((n & 0xff) << 24) |
+  8066de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8066e1:	c1 e0 18             	shl    $0x18,%eax
+  8066e4:	89 c2                	mov    %eax,%edx
+    ((n & 0xff00) << 8) |
+  8066e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8066e9:	c1 e0 08             	shl    $0x8,%eax
+  8066ec:	25 00 00 ff 00       	and    $0xff0000,%eax
+  return ((n & 0xff) << 24) |
+  8066f1:	09 c2                	or     %eax,%edx
+    ((n & 0xff0000UL) >> 8) |
+  8066f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8066f6:	48 c1 e8 08          	shr    $0x8,%rax
+  8066fa:	25 00 ff 00 00       	and    $0xff00,%eax
+    ((n & 0xff00) << 8) |
+  8066ff:	09 c2                	or     %eax,%edx
+    ((n & 0xff000000UL) >> 24);
+  806701:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806704:	c1 e8 18             	shr    $0x18,%eax
+    ((n & 0xff0000UL) >> 8) |
+  806707:	09 d0                	or     %edx,%eax
+}
+  806709:	c9                   	leave
+  80670a:	c3                   	ret
+
+000000000080670b <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  80670b:	55                   	push   %rbp
+  80670c:	48 89 e5             	mov    %rsp,%rbp
+  80670f:	48 83 ec 08          	sub    $0x8,%rsp
+  806713:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806713 <ntohl+0x8>
+  80671a:	49 bb 1d 29 00 00 00 	movabs $0x291d,%r11
+  806721:	00 00 00 
+  806724:	4c 01 d8             	add    %r11,%rax
+  806727:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return htonl(n);
+  80672a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80672d:	89 d7                	mov    %edx,%edi
+  80672f:	48 ba 8f d6 ff ff ff 	movabs $0xffffffffffffd68f,%rdx
+  806736:	ff ff ff 
+  806739:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80673d:	ff d0                	call   *%rax
+}
+  80673f:	c9                   	leave
+  806740:	c3                   	ret
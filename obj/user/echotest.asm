@@ -0,0 +1,10159 @@
+
+obj/user/echotest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 11 04 00 00       	call   800452 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <die>:
+
+const char *msg = "Hello world!\n";
+
+static void
+die(char *m)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 10          	sub    $0x10,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <die+0xb>
+  800055:	49 bb e2 8f 00 00 00 	movabs $0x8fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	cprintf("%s\n", m);
+  800066:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80006a:	48 89 c6             	mov    %rax,%rsi
+  80006d:	48 b8 fe d6 ff ff ff 	movabs $0xffffffffffffd6fe,%rax
+  800074:	ff ff ff 
+  800077:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80007b:	48 89 c7             	mov    %rax,%rdi
+  80007e:	49 89 df             	mov    %rbx,%r15
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  80008d:	ff ff ff 
+  800090:	48 01 da             	add    %rbx,%rdx
+  800093:	ff d2                	call   *%rdx
+	exit();
+  800095:	49 89 df             	mov    %rbx,%r15
+  800098:	48 b8 e2 74 ff ff ff 	movabs $0xffffffffffff74e2,%rax
+  80009f:	ff ff ff 
+  8000a2:	48 01 d8             	add    %rbx,%rax
+  8000a5:	ff d0                	call   *%rax
+}
+  8000a7:	90                   	nop
+  8000a8:	48 83 c4 10          	add    $0x10,%rsp
+  8000ac:	5b                   	pop    %rbx
+  8000ad:	41 5f                	pop    %r15
+  8000af:	5d                   	pop    %rbp
+  8000b0:	c3                   	ret
+
+00000000008000b1 <umain>:
+
+void umain(int argc, char **argv)
+{
+  8000b1:	55                   	push   %rbp
+  8000b2:	48 89 e5             	mov    %rsp,%rbp
+  8000b5:	41 57                	push   %r15
+  8000b7:	53                   	push   %rbx
+  8000b8:	48 83 ec 50          	sub    $0x50,%rsp
+  8000bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000bc <umain+0xb>
+  8000c3:	49 bb 74 8f 00 00 00 	movabs $0x8f74,%r11
+  8000ca:	00 00 00 
+  8000cd:	4c 01 db             	add    %r11,%rbx
+  8000d0:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  8000d3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+	int sock;
+	struct sockaddr_in echoserver;
+	char buffer[BUFFSIZE];
+	unsigned int echolen;
+	int received = 0;
+  8000d7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+	cprintf("Connecting to:\n");
+  8000de:	48 b8 02 d7 ff ff ff 	movabs $0xffffffffffffd702,%rax
+  8000e5:	ff ff ff 
+  8000e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000ec:	48 89 c7             	mov    %rax,%rdi
+  8000ef:	49 89 df             	mov    %rbx,%r15
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  8000fe:	ff ff ff 
+  800101:	48 01 da             	add    %rbx,%rdx
+  800104:	ff d2                	call   *%rdx
+	cprintf("\tip address %s = %x\n", IPADDR, inet_addr(IPADDR));
+  800106:	48 b8 12 d7 ff ff ff 	movabs $0xffffffffffffd712,%rax
+  80010d:	ff ff ff 
+  800110:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800114:	48 89 c7             	mov    %rax,%rdi
+  800117:	49 89 df             	mov    %rbx,%r15
+  80011a:	48 b8 b1 d1 ff ff ff 	movabs $0xffffffffffffd1b1,%rax
+  800121:	ff ff ff 
+  800124:	48 01 d8             	add    %rbx,%rax
+  800127:	ff d0                	call   *%rax
+  800129:	89 c2                	mov    %eax,%edx
+  80012b:	48 b8 12 d7 ff ff ff 	movabs $0xffffffffffffd712,%rax
+  800132:	ff ff ff 
+  800135:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800139:	48 89 c6             	mov    %rax,%rsi
+  80013c:	48 b8 1c d7 ff ff ff 	movabs $0xffffffffffffd71c,%rax
+  800143:	ff ff ff 
+  800146:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80014a:	48 89 c7             	mov    %rax,%rdi
+  80014d:	49 89 df             	mov    %rbx,%r15
+  800150:	b8 00 00 00 00       	mov    $0x0,%eax
+  800155:	48 b9 aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rcx
+  80015c:	ff ff ff 
+  80015f:	48 01 d9             	add    %rbx,%rcx
+  800162:	ff d1                	call   *%rcx
+
+	// Create the TCP socket
+	if ((sock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800164:	ba 06 00 00 00       	mov    $0x6,%edx
+  800169:	be 01 00 00 00       	mov    $0x1,%esi
+  80016e:	bf 02 00 00 00       	mov    $0x2,%edi
+  800173:	49 89 df             	mov    %rbx,%r15
+  800176:	48 b8 be b4 ff ff ff 	movabs $0xffffffffffffb4be,%rax
+  80017d:	ff ff ff 
+  800180:	48 01 d8             	add    %rbx,%rax
+  800183:	ff d0                	call   *%rax
+  800185:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800188:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80018c:	79 21                	jns    8001af <umain+0xfe>
+		die("Failed to create socket");
+  80018e:	48 b8 31 d7 ff ff ff 	movabs $0xffffffffffffd731,%rax
+  800195:	ff ff ff 
+  800198:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80019c:	48 89 c7             	mov    %rax,%rdi
+  80019f:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  8001a6:	ff ff ff 
+  8001a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001ad:	ff d0                	call   *%rax
+
+	cprintf("opened socket\n");
+  8001af:	48 b8 49 d7 ff ff ff 	movabs $0xffffffffffffd749,%rax
+  8001b6:	ff ff ff 
+  8001b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001bd:	48 89 c7             	mov    %rax,%rdi
+  8001c0:	49 89 df             	mov    %rbx,%r15
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  8001cf:	ff ff ff 
+  8001d2:	48 01 da             	add    %rbx,%rdx
+  8001d5:	ff d2                	call   *%rdx
+
+	// Construct the server sockaddr_in structure
+	memset(&echoserver, 0, sizeof(echoserver));       // Clear struct
+  8001d7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001db:	ba 10 00 00 00       	mov    $0x10,%edx
+  8001e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e5:	48 89 c7             	mov    %rax,%rdi
+  8001e8:	49 89 df             	mov    %rbx,%r15
+  8001eb:	48 b8 ad 87 ff ff ff 	movabs $0xffffffffffff87ad,%rax
+  8001f2:	ff ff ff 
+  8001f5:	48 01 d8             	add    %rbx,%rax
+  8001f8:	ff d0                	call   *%rax
+	echoserver.sin_family = AF_INET;                  // Internet/IP
+  8001fa:	c6 45 d1 02          	movb   $0x2,-0x2f(%rbp)
+	echoserver.sin_addr.s_addr = inet_addr(IPADDR);   // IP address
+  8001fe:	48 b8 12 d7 ff ff ff 	movabs $0xffffffffffffd712,%rax
+  800205:	ff ff ff 
+  800208:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80020c:	48 89 c7             	mov    %rax,%rdi
+  80020f:	49 89 df             	mov    %rbx,%r15
+  800212:	48 b8 b1 d1 ff ff ff 	movabs $0xffffffffffffd1b1,%rax
+  800219:	ff ff ff 
+  80021c:	48 01 d8             	add    %rbx,%rax
+  80021f:	ff d0                	call   *%rax
+  800221:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+	echoserver.sin_port = htons(PORT);		  // server port
+  800224:	bf 10 27 00 00       	mov    $0x2710,%edi
+  800229:	49 89 df             	mov    %rbx,%r15
+  80022c:	48 b8 fa d5 ff ff ff 	movabs $0xffffffffffffd5fa,%rax
+  800233:	ff ff ff 
+  800236:	48 01 d8             	add    %rbx,%rax
+  800239:	ff d0                	call   *%rax
+  80023b:	66 89 45 d2          	mov    %ax,-0x2e(%rbp)
+
+	cprintf("trying to connect to server\n");
+  80023f:	48 b8 58 d7 ff ff ff 	movabs $0xffffffffffffd758,%rax
+  800246:	ff ff ff 
+  800249:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80024d:	48 89 c7             	mov    %rax,%rdi
+  800250:	49 89 df             	mov    %rbx,%r15
+  800253:	b8 00 00 00 00       	mov    $0x0,%eax
+  800258:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  80025f:	ff ff ff 
+  800262:	48 01 da             	add    %rbx,%rdx
+  800265:	ff d2                	call   *%rdx
+
+	// Establish connection
+	if (connect(sock, (struct sockaddr *) &echoserver, sizeof(echoserver)) < 0)
+  800267:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80026b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80026e:	ba 10 00 00 00       	mov    $0x10,%edx
+  800273:	48 89 ce             	mov    %rcx,%rsi
+  800276:	89 c7                	mov    %eax,%edi
+  800278:	49 89 df             	mov    %rbx,%r15
+  80027b:	48 b8 c6 b2 ff ff ff 	movabs $0xffffffffffffb2c6,%rax
+  800282:	ff ff ff 
+  800285:	48 01 d8             	add    %rbx,%rax
+  800288:	ff d0                	call   *%rax
+  80028a:	85 c0                	test   %eax,%eax
+  80028c:	79 21                	jns    8002af <umain+0x1fe>
+		die("Failed to connect with server");
+  80028e:	48 b8 75 d7 ff ff ff 	movabs $0xffffffffffffd775,%rax
+  800295:	ff ff ff 
+  800298:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80029c:	48 89 c7             	mov    %rax,%rdi
+  80029f:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  8002a6:	ff ff ff 
+  8002a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002ad:	ff d0                	call   *%rax
+
+	cprintf("connected to server\n");
+  8002af:	48 b8 93 d7 ff ff ff 	movabs $0xffffffffffffd793,%rax
+  8002b6:	ff ff ff 
+  8002b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002bd:	48 89 c7             	mov    %rax,%rdi
+  8002c0:	49 89 df             	mov    %rbx,%r15
+  8002c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c8:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  8002cf:	ff ff ff 
+  8002d2:	48 01 da             	add    %rbx,%rdx
+  8002d5:	ff d2                	call   *%rdx
+
+	// Send the word to the server
+	echolen = strlen(msg);
+  8002d7:	48 b8 30 00 00 00 00 	movabs $0x30,%rax
+  8002de:	00 00 00 
+  8002e1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002e5:	48 89 c7             	mov    %rax,%rdi
+  8002e8:	49 89 df             	mov    %rbx,%r15
+  8002eb:	48 b8 d8 83 ff ff ff 	movabs $0xffffffffffff83d8,%rax
+  8002f2:	ff ff ff 
+  8002f5:	48 01 d8             	add    %rbx,%rax
+  8002f8:	ff d0                	call   *%rax
+  8002fa:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (write(sock, msg, echolen) != echolen)
+  8002fd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800300:	48 b8 30 00 00 00 00 	movabs $0x30,%rax
+  800307:	00 00 00 
+  80030a:	48 8b 0c 03          	mov    (%rbx,%rax,1),%rcx
+  80030e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800311:	48 89 ce             	mov    %rcx,%rsi
+  800314:	89 c7                	mov    %eax,%edi
+  800316:	49 89 df             	mov    %rbx,%r15
+  800319:	48 b8 ee a0 ff ff ff 	movabs $0xffffffffffffa0ee,%rax
+  800320:	ff ff ff 
+  800323:	48 01 d8             	add    %rbx,%rax
+  800326:	ff d0                	call   *%rax
+  800328:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+  80032b:	74 21                	je     80034e <umain+0x29d>
+		die("Mismatch in number of sent bytes");
+  80032d:	48 b8 a8 d7 ff ff ff 	movabs $0xffffffffffffd7a8,%rax
+  800334:	ff ff ff 
+  800337:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80033b:	48 89 c7             	mov    %rax,%rdi
+  80033e:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  800345:	ff ff ff 
+  800348:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80034c:	ff d0                	call   *%rax
+
+	// Receive the word back from the server
+	cprintf("Received: \n");
+  80034e:	48 b8 c9 d7 ff ff ff 	movabs $0xffffffffffffd7c9,%rax
+  800355:	ff ff ff 
+  800358:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80035c:	48 89 c7             	mov    %rax,%rdi
+  80035f:	49 89 df             	mov    %rbx,%r15
+  800362:	b8 00 00 00 00       	mov    $0x0,%eax
+  800367:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  80036e:	ff ff ff 
+  800371:	48 01 da             	add    %rbx,%rdx
+  800374:	ff d2                	call   *%rdx
+	while (received < echolen) {
+  800376:	e9 82 00 00 00       	jmp    8003fd <umain+0x34c>
+		int bytes = 0;
+  80037b:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+		if ((bytes = read(sock, buffer, BUFFSIZE-1)) < 1) {
+  800382:	48 8d 4d b0          	lea    -0x50(%rbp),%rcx
+  800386:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800389:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  80038e:	48 89 ce             	mov    %rcx,%rsi
+  800391:	89 c7                	mov    %eax,%edi
+  800393:	49 89 df             	mov    %rbx,%r15
+  800396:	48 b8 48 9f ff ff ff 	movabs $0xffffffffffff9f48,%rax
+  80039d:	ff ff ff 
+  8003a0:	48 01 d8             	add    %rbx,%rax
+  8003a3:	ff d0                	call   *%rax
+  8003a5:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8003a8:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8003ac:	7f 21                	jg     8003cf <umain+0x31e>
+			die("Failed to receive bytes from server");
+  8003ae:	48 b8 d8 d7 ff ff ff 	movabs $0xffffffffffffd7d8,%rax
+  8003b5:	ff ff ff 
+  8003b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003bc:	48 89 c7             	mov    %rax,%rdi
+  8003bf:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  8003c6:	ff ff ff 
+  8003c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003cd:	ff d0                	call   *%rax
+		}
+		received += bytes;
+  8003cf:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003d2:	01 45 ec             	add    %eax,-0x14(%rbp)
+		buffer[bytes] = '\0';        // Assure null terminated string
+  8003d5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003d8:	48 98                	cltq
+  8003da:	c6 44 05 b0 00       	movb   $0x0,-0x50(%rbp,%rax,1)
+		cprintf(buffer);
+  8003df:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003e3:	48 89 c7             	mov    %rax,%rdi
+  8003e6:	49 89 df             	mov    %rbx,%r15
+  8003e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ee:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  8003f5:	ff ff ff 
+  8003f8:	48 01 da             	add    %rbx,%rdx
+  8003fb:	ff d2                	call   *%rdx
+	while (received < echolen) {
+  8003fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800400:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  800403:	0f 82 72 ff ff ff    	jb     80037b <umain+0x2ca>
+	}
+	cprintf("\n");
+  800409:	48 b8 fc d7 ff ff ff 	movabs $0xffffffffffffd7fc,%rax
+  800410:	ff ff ff 
+  800413:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800417:	48 89 c7             	mov    %rax,%rdi
+  80041a:	49 89 df             	mov    %rbx,%r15
+  80041d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800422:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  800429:	ff ff ff 
+  80042c:	48 01 da             	add    %rbx,%rdx
+  80042f:	ff d2                	call   *%rdx
+
+	close(sock);
+  800431:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800434:	89 c7                	mov    %eax,%edi
+  800436:	49 89 df             	mov    %rbx,%r15
+  800439:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  800440:	ff ff ff 
+  800443:	48 01 d8             	add    %rbx,%rax
+  800446:	ff d0                	call   *%rax
+}
+  800448:	90                   	nop
+  800449:	48 83 c4 50          	add    $0x50,%rsp
+  80044d:	5b                   	pop    %rbx
+  80044e:	41 5f                	pop    %r15
+  800450:	5d                   	pop    %rbp
+  800451:	c3                   	ret
+
+0000000000800452 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800452:	55                   	push   %rbp
+  800453:	48 89 e5             	mov    %rsp,%rbp
+  800456:	41 57                	push   %r15
+  800458:	53                   	push   %rbx
+  800459:	48 83 ec 20          	sub    $0x20,%rsp
+  80045d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80045d <libmain+0xb>
+  800464:	49 bb d3 8b 00 00 00 	movabs $0x8bd3,%r11
+  80046b:	00 00 00 
+  80046e:	4c 01 db             	add    %r11,%rbx
+  800471:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800474:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800478:	49 89 df             	mov    %rbx,%r15
+  80047b:	48 b8 7f 90 ff ff ff 	movabs $0xffffffffffff907f,%rax
+  800482:	ff ff ff 
+  800485:	48 01 d8             	add    %rbx,%rax
+  800488:	ff d0                	call   *%rax
+  80048a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  80048d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800490:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800495:	48 98                	cltq
+  800497:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80049e:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8004a5:	ff ff ff 
+  8004a8:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8004ac:	48 01 c2             	add    %rax,%rdx
+  8004af:	48 b8 f0 1f 01 00 00 	movabs $0x11ff0,%rax
+  8004b6:	00 00 00 
+  8004b9:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004bd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8004c1:	7e 15                	jle    8004d8 <libmain+0x86>
+		binaryname = argv[0];
+  8004c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004c7:	48 8b 00             	mov    (%rax),%rax
+  8004ca:	48 ba 38 00 00 00 00 	movabs $0x38,%rdx
+  8004d1:	00 00 00 
+  8004d4:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8004d8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8004dc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004df:	48 89 d6             	mov    %rdx,%rsi
+  8004e2:	89 c7                	mov    %eax,%edi
+  8004e4:	49 89 df             	mov    %rbx,%r15
+  8004e7:	48 b8 81 70 ff ff ff 	movabs $0xffffffffffff7081,%rax
+  8004ee:	ff ff ff 
+  8004f1:	48 01 d8             	add    %rbx,%rax
+  8004f4:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8004f6:	49 89 df             	mov    %rbx,%r15
+  8004f9:	48 b8 e2 74 ff ff ff 	movabs $0xffffffffffff74e2,%rax
+  800500:	ff ff ff 
+  800503:	48 01 d8             	add    %rbx,%rax
+  800506:	ff d0                	call   *%rax
+}
+  800508:	90                   	nop
+  800509:	48 83 c4 20          	add    $0x20,%rsp
+  80050d:	5b                   	pop    %rbx
+  80050e:	41 5f                	pop    %r15
+  800510:	5d                   	pop    %rbp
+  800511:	c3                   	ret
+
+0000000000800512 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800512:	55                   	push   %rbp
+  800513:	48 89 e5             	mov    %rsp,%rbp
+  800516:	41 57                	push   %r15
+  800518:	53                   	push   %rbx
+  800519:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800519 <exit+0x7>
+  800520:	49 bb 17 8b 00 00 00 	movabs $0x8b17,%r11
+  800527:	00 00 00 
+  80052a:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80052d:	49 89 df             	mov    %rbx,%r15
+  800530:	48 b8 fc 9c ff ff ff 	movabs $0xffffffffffff9cfc,%rax
+  800537:	ff ff ff 
+  80053a:	48 01 d8             	add    %rbx,%rax
+  80053d:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80053f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800544:	49 89 df             	mov    %rbx,%r15
+  800547:	48 b8 23 90 ff ff ff 	movabs $0xffffffffffff9023,%rax
+  80054e:	ff ff ff 
+  800551:	48 01 d8             	add    %rbx,%rax
+  800554:	ff d0                	call   *%rax
+}
+  800556:	90                   	nop
+  800557:	5b                   	pop    %rbx
+  800558:	41 5f                	pop    %r15
+  80055a:	5d                   	pop    %rbp
+  80055b:	c3                   	ret
+
+000000000080055c <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  80055c:	55                   	push   %rbp
+  80055d:	48 89 e5             	mov    %rsp,%rbp
+  800560:	41 57                	push   %r15
+  800562:	48 83 ec 18          	sub    $0x18,%rsp
+  800566:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800566 <putch+0xa>
+  80056d:	49 bb ca 8a 00 00 00 	movabs $0x8aca,%r11
+  800574:	00 00 00 
+  800577:	4c 01 d8             	add    %r11,%rax
+  80057a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80057d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800581:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800585:	8b 12                	mov    (%rdx),%edx
+  800587:	8d 72 01             	lea    0x1(%rdx),%esi
+  80058a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80058e:	89 31                	mov    %esi,(%rcx)
+  800590:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800593:	89 ce                	mov    %ecx,%esi
+  800595:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800599:	48 63 d2             	movslq %edx,%rdx
+  80059c:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8005a1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005a5:	8b 12                	mov    (%rdx),%edx
+  8005a7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005ad:	75 33                	jne    8005e2 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8005af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005b3:	8b 12                	mov    (%rdx),%edx
+  8005b5:	48 63 d2             	movslq %edx,%rdx
+  8005b8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8005bc:	48 83 c1 08          	add    $0x8,%rcx
+  8005c0:	48 89 d6             	mov    %rdx,%rsi
+  8005c3:	48 89 cf             	mov    %rcx,%rdi
+  8005c6:	49 89 c7             	mov    %rax,%r15
+  8005c9:	48 ba 70 8f ff ff ff 	movabs $0xffffffffffff8f70,%rdx
+  8005d0:	ff ff ff 
+  8005d3:	48 01 c2             	add    %rax,%rdx
+  8005d6:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8005d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005dc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8005e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005e6:	8b 40 04             	mov    0x4(%rax),%eax
+  8005e9:	8d 50 01             	lea    0x1(%rax),%edx
+  8005ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005f0:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8005f3:	90                   	nop
+  8005f4:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8005f8:	c9                   	leave
+  8005f9:	c3                   	ret
+
+00000000008005fa <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005fa:	55                   	push   %rbp
+  8005fb:	48 89 e5             	mov    %rsp,%rbp
+  8005fe:	41 57                	push   %r15
+  800600:	53                   	push   %rbx
+  800601:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800608:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800608 <vcprintf+0xe>
+  80060f:	49 bb 28 8a 00 00 00 	movabs $0x8a28,%r11
+  800616:	00 00 00 
+  800619:	4c 01 db             	add    %r11,%rbx
+  80061c:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800623:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80062a:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800631:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800638:	48 8b 06             	mov    (%rsi),%rax
+  80063b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80063f:	48 89 01             	mov    %rax,(%rcx)
+  800642:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800646:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80064a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80064e:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800655:	00 00 00 
+    b.cnt = 0;
+  800658:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80065f:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800662:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800669:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800670:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800677:	48 89 c6             	mov    %rax,%rsi
+  80067a:	48 b8 2c 75 ff ff ff 	movabs $0xffffffffffff752c,%rax
+  800681:	ff ff ff 
+  800684:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800688:	48 89 c7             	mov    %rax,%rdi
+  80068b:	49 89 df             	mov    %rbx,%r15
+  80068e:	48 b8 ee 7a ff ff ff 	movabs $0xffffffffffff7aee,%rax
+  800695:	ff ff ff 
+  800698:	48 01 d8             	add    %rbx,%rax
+  80069b:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  80069d:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8006a3:	48 98                	cltq
+  8006a5:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8006ac:	48 83 c2 08          	add    $0x8,%rdx
+  8006b0:	48 89 c6             	mov    %rax,%rsi
+  8006b3:	48 89 d7             	mov    %rdx,%rdi
+  8006b6:	49 89 df             	mov    %rbx,%r15
+  8006b9:	48 b8 70 8f ff ff ff 	movabs $0xffffffffffff8f70,%rax
+  8006c0:	ff ff ff 
+  8006c3:	48 01 d8             	add    %rbx,%rax
+  8006c6:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8006c8:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8006ce:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8006d5:	5b                   	pop    %rbx
+  8006d6:	41 5f                	pop    %r15
+  8006d8:	5d                   	pop    %rbp
+  8006d9:	c3                   	ret
+
+00000000008006da <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8006da:	55                   	push   %rbp
+  8006db:	48 89 e5             	mov    %rsp,%rbp
+  8006de:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8006e5:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8006e5 <cprintf+0xb>
+  8006ec:	49 bb 4b 89 00 00 00 	movabs $0x894b,%r11
+  8006f3:	00 00 00 
+  8006f6:	4d 01 da             	add    %r11,%r10
+  8006f9:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800700:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800707:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80070e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800715:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80071c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800723:	84 c0                	test   %al,%al
+  800725:	74 20                	je     800747 <cprintf+0x6d>
+  800727:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80072b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80072f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800733:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800737:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80073b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80073f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800743:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800747:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80074e:	00 00 00 
+  800751:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800758:	00 00 00 
+  80075b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80075f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800766:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80076d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800774:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80077b:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800782:	48 8b 06             	mov    (%rsi),%rax
+  800785:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800789:	48 89 01             	mov    %rax,(%rcx)
+  80078c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800790:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800794:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800798:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80079f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8007a6:	48 89 d6             	mov    %rdx,%rsi
+  8007a9:	48 89 c7             	mov    %rax,%rdi
+  8007ac:	48 b8 ca 75 ff ff ff 	movabs $0xffffffffffff75ca,%rax
+  8007b3:	ff ff ff 
+  8007b6:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8007ba:	ff d0                	call   *%rax
+  8007bc:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8007c2:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8007c8:	c9                   	leave
+  8007c9:	c3                   	ret
+
+00000000008007ca <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8007ca:	55                   	push   %rbp
+  8007cb:	48 89 e5             	mov    %rsp,%rbp
+  8007ce:	53                   	push   %rbx
+  8007cf:	48 83 ec 38          	sub    $0x38,%rsp
+  8007d3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8007d3 <printnum+0x9>
+  8007da:	49 bb 5d 88 00 00 00 	movabs $0x885d,%r11
+  8007e1:	00 00 00 
+  8007e4:	4c 01 db             	add    %r11,%rbx
+  8007e7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007eb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8007ef:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8007f3:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8007f6:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8007fa:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8007fe:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800801:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800805:	72 58                	jb     80085f <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800807:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80080a:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80080d:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800810:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800814:	ba 00 00 00 00       	mov    $0x0,%edx
+  800819:	48 f7 f6             	div    %rsi
+  80081c:	49 89 c2             	mov    %rax,%r10
+  80081f:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800822:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800825:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800829:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80082d:	41 89 c9             	mov    %ecx,%r9d
+  800830:	41 89 f8             	mov    %edi,%r8d
+  800833:	89 d1                	mov    %edx,%ecx
+  800835:	4c 89 d2             	mov    %r10,%rdx
+  800838:	48 89 c7             	mov    %rax,%rdi
+  80083b:	48 b8 9a 77 ff ff ff 	movabs $0xffffffffffff779a,%rax
+  800842:	ff ff ff 
+  800845:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800849:	ff d0                	call   *%rax
+  80084b:	eb 1c                	jmp    800869 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80084d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800851:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800854:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800858:	48 89 d6             	mov    %rdx,%rsi
+  80085b:	89 c7                	mov    %eax,%edi
+  80085d:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80085f:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800863:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800867:	7f e4                	jg     80084d <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800869:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80086c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800870:	ba 00 00 00 00       	mov    $0x0,%edx
+  800875:	48 f7 f1             	div    %rcx
+  800878:	48 b8 3f d9 ff ff ff 	movabs $0xffffffffffffd93f,%rax
+  80087f:	ff ff ff 
+  800882:	48 01 d8             	add    %rbx,%rax
+  800885:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800889:	0f be c0             	movsbl %al,%eax
+  80088c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800890:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800894:	48 89 d6             	mov    %rdx,%rsi
+  800897:	89 c7                	mov    %eax,%edi
+  800899:	ff d1                	call   *%rcx
+}
+  80089b:	90                   	nop
+  80089c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008a0:	c9                   	leave
+  8008a1:	c3                   	ret
+
+00000000008008a2 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8008a2:	55                   	push   %rbp
+  8008a3:	48 89 e5             	mov    %rsp,%rbp
+  8008a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8008aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008aa <getuint+0x8>
+  8008b1:	49 bb 86 87 00 00 00 	movabs $0x8786,%r11
+  8008b8:	00 00 00 
+  8008bb:	4c 01 d8             	add    %r11,%rax
+  8008be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008c2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8008c5:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8008c9:	7e 4f                	jle    80091a <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8008cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008cf:	8b 00                	mov    (%rax),%eax
+  8008d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d4:	77 24                	ja     8008fa <getuint+0x58>
+  8008d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008da:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008e2:	8b 00                	mov    (%rax),%eax
+  8008e4:	89 c0                	mov    %eax,%eax
+  8008e6:	48 01 d0             	add    %rdx,%rax
+  8008e9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008ed:	8b 12                	mov    (%rdx),%edx
+  8008ef:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008f6:	89 0a                	mov    %ecx,(%rdx)
+  8008f8:	eb 14                	jmp    80090e <getuint+0x6c>
+  8008fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008fe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800902:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800906:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80090a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80090e:	48 8b 00             	mov    (%rax),%rax
+  800911:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800915:	e9 9d 00 00 00       	jmp    8009b7 <getuint+0x115>
+	else if (lflag)
+  80091a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80091e:	74 4c                	je     80096c <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800920:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800924:	8b 00                	mov    (%rax),%eax
+  800926:	83 f8 2f             	cmp    $0x2f,%eax
+  800929:	77 24                	ja     80094f <getuint+0xad>
+  80092b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80092f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800933:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800937:	8b 00                	mov    (%rax),%eax
+  800939:	89 c0                	mov    %eax,%eax
+  80093b:	48 01 d0             	add    %rdx,%rax
+  80093e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800942:	8b 12                	mov    (%rdx),%edx
+  800944:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800947:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80094b:	89 0a                	mov    %ecx,(%rdx)
+  80094d:	eb 14                	jmp    800963 <getuint+0xc1>
+  80094f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800953:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800957:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80095b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80095f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800963:	48 8b 00             	mov    (%rax),%rax
+  800966:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80096a:	eb 4b                	jmp    8009b7 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  80096c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800970:	8b 00                	mov    (%rax),%eax
+  800972:	83 f8 2f             	cmp    $0x2f,%eax
+  800975:	77 24                	ja     80099b <getuint+0xf9>
+  800977:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80097b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80097f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800983:	8b 00                	mov    (%rax),%eax
+  800985:	89 c0                	mov    %eax,%eax
+  800987:	48 01 d0             	add    %rdx,%rax
+  80098a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80098e:	8b 12                	mov    (%rdx),%edx
+  800990:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800993:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800997:	89 0a                	mov    %ecx,(%rdx)
+  800999:	eb 14                	jmp    8009af <getuint+0x10d>
+  80099b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80099f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009a3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009ab:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009af:	8b 00                	mov    (%rax),%eax
+  8009b1:	89 c0                	mov    %eax,%eax
+  8009b3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8009b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8009bb:	c9                   	leave
+  8009bc:	c3                   	ret
+
+00000000008009bd <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8009bd:	55                   	push   %rbp
+  8009be:	48 89 e5             	mov    %rsp,%rbp
+  8009c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8009c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8009c5 <printfloat+0x8>
+  8009cc:	49 bb 6b 86 00 00 00 	movabs $0x866b,%r11
+  8009d3:	00 00 00 
+  8009d6:	4c 01 d8             	add    %r11,%rax
+  8009d9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009dd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009e1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8009e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e9:	48 85 c0             	test   %rax,%rax
+  8009ec:	79 12                	jns    800a00 <printfloat+0x43>
+		putch('-',putdat);
+  8009ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8009f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009f6:	48 89 c6             	mov    %rax,%rsi
+  8009f9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009fe:	ff d2                	call   *%rdx
+	
+}
+  800a00:	90                   	nop
+  800a01:	c9                   	leave
+  800a02:	c3                   	ret
+
+0000000000800a03 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800a03:	55                   	push   %rbp
+  800a04:	48 89 e5             	mov    %rsp,%rbp
+  800a07:	48 83 ec 20          	sub    $0x20,%rsp
+  800a0b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a0b <getint+0x8>
+  800a12:	49 bb 25 86 00 00 00 	movabs $0x8625,%r11
+  800a19:	00 00 00 
+  800a1c:	4c 01 d8             	add    %r11,%rax
+  800a1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a23:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800a26:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a2a:	7e 4f                	jle    800a7b <getint+0x78>
+		x=va_arg(*ap, long long);
+  800a2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a30:	8b 00                	mov    (%rax),%eax
+  800a32:	83 f8 2f             	cmp    $0x2f,%eax
+  800a35:	77 24                	ja     800a5b <getint+0x58>
+  800a37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a3b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a43:	8b 00                	mov    (%rax),%eax
+  800a45:	89 c0                	mov    %eax,%eax
+  800a47:	48 01 d0             	add    %rdx,%rax
+  800a4a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a4e:	8b 12                	mov    (%rdx),%edx
+  800a50:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a53:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a57:	89 0a                	mov    %ecx,(%rdx)
+  800a59:	eb 14                	jmp    800a6f <getint+0x6c>
+  800a5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a63:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a67:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a6b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a6f:	48 8b 00             	mov    (%rax),%rax
+  800a72:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a76:	e9 9d 00 00 00       	jmp    800b18 <getint+0x115>
+	else if (lflag)
+  800a7b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800a7f:	74 4c                	je     800acd <getint+0xca>
+		x=va_arg(*ap, long);
+  800a81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a85:	8b 00                	mov    (%rax),%eax
+  800a87:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8a:	77 24                	ja     800ab0 <getint+0xad>
+  800a8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a90:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a98:	8b 00                	mov    (%rax),%eax
+  800a9a:	89 c0                	mov    %eax,%eax
+  800a9c:	48 01 d0             	add    %rdx,%rax
+  800a9f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aa3:	8b 12                	mov    (%rdx),%edx
+  800aa5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800aa8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aac:	89 0a                	mov    %ecx,(%rdx)
+  800aae:	eb 14                	jmp    800ac4 <getint+0xc1>
+  800ab0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ab8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800abc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ac0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ac4:	48 8b 00             	mov    (%rax),%rax
+  800ac7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800acb:	eb 4b                	jmp    800b18 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800acd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad1:	8b 00                	mov    (%rax),%eax
+  800ad3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad6:	77 24                	ja     800afc <getint+0xf9>
+  800ad8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800adc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ae0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae4:	8b 00                	mov    (%rax),%eax
+  800ae6:	89 c0                	mov    %eax,%eax
+  800ae8:	48 01 d0             	add    %rdx,%rax
+  800aeb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aef:	8b 12                	mov    (%rdx),%edx
+  800af1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800af4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800af8:	89 0a                	mov    %ecx,(%rdx)
+  800afa:	eb 14                	jmp    800b10 <getint+0x10d>
+  800afc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b00:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b04:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b08:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b0c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b10:	8b 00                	mov    (%rax),%eax
+  800b12:	48 98                	cltq
+  800b14:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b1c:	c9                   	leave
+  800b1d:	c3                   	ret
+
+0000000000800b1e <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800b1e:	55                   	push   %rbp
+  800b1f:	48 89 e5             	mov    %rsp,%rbp
+  800b22:	41 57                	push   %r15
+  800b24:	41 55                	push   %r13
+  800b26:	41 54                	push   %r12
+  800b28:	53                   	push   %rbx
+  800b29:	48 83 ec 60          	sub    $0x60,%rsp
+  800b2d:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800b2d <vprintfmt+0xf>
+  800b34:	49 bb 03 85 00 00 00 	movabs $0x8503,%r11
+  800b3b:	00 00 00 
+  800b3e:	4d 01 dc             	add    %r11,%r12
+  800b41:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800b45:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800b49:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b4d:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800b51:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800b58:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800b5c:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800b60:	48 8b 06             	mov    (%rsi),%rax
+  800b63:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800b67:	48 89 01             	mov    %rax,(%rcx)
+  800b6a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800b6e:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800b72:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800b76:	eb 17                	jmp    800b8f <vprintfmt+0x71>
+			if (ch == '\0')
+  800b78:	85 db                	test   %ebx,%ebx
+  800b7a:	0f 84 97 05 00 00    	je     801117 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800b80:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800b84:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800b88:	48 89 c6             	mov    %rax,%rsi
+  800b8b:	89 df                	mov    %ebx,%edi
+  800b8d:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800b8f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b93:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b97:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b9b:	0f b6 00             	movzbl (%rax),%eax
+  800b9e:	0f b6 d8             	movzbl %al,%ebx
+  800ba1:	83 fb 25             	cmp    $0x25,%ebx
+  800ba4:	75 d2                	jne    800b78 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800ba6:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800baa:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800bb1:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800bb8:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800bbf:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800bc6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800bca:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bce:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800bd2:	0f b6 00             	movzbl (%rax),%eax
+  800bd5:	0f b6 d8             	movzbl %al,%ebx
+  800bd8:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800bdb:	83 f8 55             	cmp    $0x55,%eax
+  800bde:	0f 87 00 05 00 00    	ja     8010e4 <vprintfmt+0x5c6>
+  800be4:	89 c0                	mov    %eax,%eax
+  800be6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800bed:	00 
+  800bee:	48 8d 05 a3 5d 00 00 	lea    0x5da3(%rip),%rax        # 806998 <.LC18+0xc>
+  800bf5:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800bf9:	48 8d 15 98 5d 00 00 	lea    0x5d98(%rip),%rdx        # 806998 <.LC18+0xc>
+  800c00:	48 01 d0             	add    %rdx,%rax
+  800c03:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800c05:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800c09:	eb bb                	jmp    800bc6 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800c0b:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800c0f:	eb b5                	jmp    800bc6 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800c11:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c18:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800c1b:	89 d0                	mov    %edx,%eax
+  800c1d:	c1 e0 02             	shl    $0x2,%eax
+  800c20:	01 d0                	add    %edx,%eax
+  800c22:	01 c0                	add    %eax,%eax
+  800c24:	01 d8                	add    %ebx,%eax
+  800c26:	83 e8 30             	sub    $0x30,%eax
+  800c29:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800c2c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c30:	0f b6 00             	movzbl (%rax),%eax
+  800c33:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800c36:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c39:	7e 60                	jle    800c9b <vprintfmt+0x17d>
+  800c3b:	83 fb 39             	cmp    $0x39,%ebx
+  800c3e:	7f 5b                	jg     800c9b <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800c40:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c45:	eb d1                	jmp    800c18 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800c47:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4d:	77 17                	ja     800c66 <vprintfmt+0x148>
+  800c4f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c53:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c56:	89 d2                	mov    %edx,%edx
+  800c58:	48 01 d0             	add    %rdx,%rax
+  800c5b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c5e:	83 c2 08             	add    $0x8,%edx
+  800c61:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c64:	eb 0c                	jmp    800c72 <vprintfmt+0x154>
+  800c66:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c6a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c6e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c72:	8b 00                	mov    (%rax),%eax
+  800c74:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800c77:	eb 23                	jmp    800c9c <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800c79:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c7d:	0f 89 43 ff ff ff    	jns    800bc6 <vprintfmt+0xa8>
+				width = 0;
+  800c83:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800c8a:	e9 37 ff ff ff       	jmp    800bc6 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800c8f:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800c96:	e9 2b ff ff ff       	jmp    800bc6 <vprintfmt+0xa8>
+			goto process_precision;
+  800c9b:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800c9c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ca0:	0f 89 20 ff ff ff    	jns    800bc6 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800ca6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ca9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800cac:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800cb3:	e9 0e ff ff ff       	jmp    800bc6 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800cb8:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800cbc:	e9 05 ff ff ff       	jmp    800bc6 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800cc1:	83 fb 39             	cmp    $0x39,%ebx
+  800cc4:	7f 0b                	jg     800cd1 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800cc6:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800cc9:	c1 e0 08             	shl    $0x8,%eax
+  800ccc:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ccf:	eb 21                	jmp    800cf2 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800cd1:	83 fb 60             	cmp    $0x60,%ebx
+  800cd4:	7e 10                	jle    800ce6 <vprintfmt+0x1c8>
+  800cd6:	83 fb 66             	cmp    $0x66,%ebx
+  800cd9:	7f 0b                	jg     800ce6 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800cdb:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800cde:	c1 e0 08             	shl    $0x8,%eax
+  800ce1:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ce4:	eb 0c                	jmp    800cf2 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800ce6:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800ced:	e9 04 01 00 00       	jmp    800df6 <vprintfmt+0x2d8>
+  800cf2:	e9 ff 00 00 00       	jmp    800df6 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800cf7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800cfa:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfd:	77 17                	ja     800d16 <vprintfmt+0x1f8>
+  800cff:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d03:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d06:	89 d2                	mov    %edx,%edx
+  800d08:	48 01 d0             	add    %rdx,%rax
+  800d0b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d0e:	83 c2 08             	add    $0x8,%edx
+  800d11:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d14:	eb 0c                	jmp    800d22 <vprintfmt+0x204>
+  800d16:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d1a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d1e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d22:	8b 00                	mov    (%rax),%eax
+  800d24:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800d28:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800d2c:	48 89 d6             	mov    %rdx,%rsi
+  800d2f:	89 c7                	mov    %eax,%edi
+  800d31:	ff d1                	call   *%rcx
+			break;
+  800d33:	e9 da 03 00 00       	jmp    801112 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800d38:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d3b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d3e:	77 17                	ja     800d57 <vprintfmt+0x239>
+  800d40:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d44:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d47:	89 d2                	mov    %edx,%edx
+  800d49:	48 01 d0             	add    %rdx,%rax
+  800d4c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d4f:	83 c2 08             	add    $0x8,%edx
+  800d52:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d55:	eb 0c                	jmp    800d63 <vprintfmt+0x245>
+  800d57:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d5b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d5f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d63:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800d65:	85 db                	test   %ebx,%ebx
+  800d67:	79 02                	jns    800d6b <vprintfmt+0x24d>
+				err = -err;
+  800d69:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d6b:	83 fb 15             	cmp    $0x15,%ebx
+  800d6e:	7f 19                	jg     800d89 <vprintfmt+0x26b>
+  800d70:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800d77:	00 00 00 
+  800d7a:	48 63 c3             	movslq %ebx,%rax
+  800d7d:	4c 01 e2             	add    %r12,%rdx
+  800d80:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800d84:	4d 85 ed             	test   %r13,%r13
+  800d87:	75 36                	jne    800dbf <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800d89:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800d8d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d91:	89 d9                	mov    %ebx,%ecx
+  800d93:	48 ba 50 d9 ff ff ff 	movabs $0xffffffffffffd950,%rdx
+  800d9a:	ff ff ff 
+  800d9d:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800da1:	48 89 c7             	mov    %rax,%rdi
+  800da4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da9:	49 b8 f5 80 ff ff ff 	movabs $0xffffffffffff80f5,%r8
+  800db0:	ff ff ff 
+  800db3:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800db7:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800dba:	e9 53 03 00 00       	jmp    801112 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800dbf:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800dc3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800dc7:	4c 89 e9             	mov    %r13,%rcx
+  800dca:	48 ba 59 d9 ff ff ff 	movabs $0xffffffffffffd959,%rdx
+  800dd1:	ff ff ff 
+  800dd4:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800dd8:	48 89 c7             	mov    %rax,%rdi
+  800ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de0:	49 b8 f5 80 ff ff ff 	movabs $0xffffffffffff80f5,%r8
+  800de7:	ff ff ff 
+  800dea:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800dee:	41 ff d0             	call   *%r8
+			break;
+  800df1:	e9 1c 03 00 00       	jmp    801112 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800df6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800df9:	83 f8 2f             	cmp    $0x2f,%eax
+  800dfc:	77 17                	ja     800e15 <vprintfmt+0x2f7>
+  800dfe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e02:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e05:	89 d2                	mov    %edx,%edx
+  800e07:	48 01 d0             	add    %rdx,%rax
+  800e0a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e0d:	83 c2 08             	add    $0x8,%edx
+  800e10:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e13:	eb 0c                	jmp    800e21 <vprintfmt+0x303>
+  800e15:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e19:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e1d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e21:	4c 8b 28             	mov    (%rax),%r13
+  800e24:	4d 85 ed             	test   %r13,%r13
+  800e27:	75 0e                	jne    800e37 <vprintfmt+0x319>
+				p = "(null)";
+  800e29:	48 b8 5c d9 ff ff ff 	movabs $0xffffffffffffd95c,%rax
+  800e30:	ff ff ff 
+  800e33:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800e37:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e3b:	0f 8e 84 00 00 00    	jle    800ec5 <vprintfmt+0x3a7>
+  800e41:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800e45:	74 7e                	je     800ec5 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e47:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800e4a:	48 98                	cltq
+  800e4c:	48 89 c6             	mov    %rax,%rsi
+  800e4f:	4c 89 ef             	mov    %r13,%rdi
+  800e52:	4d 89 e7             	mov    %r12,%r15
+  800e55:	48 b8 1a 84 ff ff ff 	movabs $0xffffffffffff841a,%rax
+  800e5c:	ff ff ff 
+  800e5f:	4c 01 e0             	add    %r12,%rax
+  800e62:	ff d0                	call   *%rax
+  800e64:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800e67:	eb 17                	jmp    800e80 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800e69:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800e6d:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800e71:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800e75:	48 89 d6             	mov    %rdx,%rsi
+  800e78:	89 c7                	mov    %eax,%edi
+  800e7a:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e7c:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e80:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e84:	7f e3                	jg     800e69 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e86:	eb 3d                	jmp    800ec5 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800e88:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800e8c:	74 1e                	je     800eac <vprintfmt+0x38e>
+  800e8e:	83 fb 1f             	cmp    $0x1f,%ebx
+  800e91:	7e 05                	jle    800e98 <vprintfmt+0x37a>
+  800e93:	83 fb 7e             	cmp    $0x7e,%ebx
+  800e96:	7e 14                	jle    800eac <vprintfmt+0x38e>
+					putch('?', putdat);
+  800e98:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e9c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ea0:	48 89 c6             	mov    %rax,%rsi
+  800ea3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ea8:	ff d2                	call   *%rdx
+  800eaa:	eb 15                	jmp    800ec1 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800eac:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800eaf:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800eb2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800eb6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800eba:	48 89 c6             	mov    %rax,%rsi
+  800ebd:	89 cf                	mov    %ecx,%edi
+  800ebf:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ec1:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ec5:	4c 89 e8             	mov    %r13,%rax
+  800ec8:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800ecc:	0f b6 00             	movzbl (%rax),%eax
+  800ecf:	0f be d8             	movsbl %al,%ebx
+  800ed2:	85 db                	test   %ebx,%ebx
+  800ed4:	74 28                	je     800efe <vprintfmt+0x3e0>
+  800ed6:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800eda:	78 ac                	js     800e88 <vprintfmt+0x36a>
+  800edc:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800ee0:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800ee4:	79 a2                	jns    800e88 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800ee6:	eb 16                	jmp    800efe <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800ee8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800eec:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ef0:	48 89 c6             	mov    %rax,%rsi
+  800ef3:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ef8:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800efa:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800efe:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f02:	7f e4                	jg     800ee8 <vprintfmt+0x3ca>
+			break;
+  800f04:	e9 09 02 00 00       	jmp    801112 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800f09:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f0d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f11:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f15:	0f b6 00             	movzbl (%rax),%eax
+  800f18:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800f1b:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800f1c:	83 fb 2f             	cmp    $0x2f,%ebx
+  800f1f:	0f 8e ac fd ff ff    	jle    800cd1 <vprintfmt+0x1b3>
+  800f25:	e9 97 fd ff ff       	jmp    800cc1 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800f2a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f2e:	be 03 00 00 00       	mov    $0x3,%esi
+  800f33:	48 89 c7             	mov    %rax,%rdi
+  800f36:	48 b8 d3 79 ff ff ff 	movabs $0xffffffffffff79d3,%rax
+  800f3d:	ff ff ff 
+  800f40:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f44:	ff d0                	call   *%rax
+  800f46:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800f4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f4e:	48 85 c0             	test   %rax,%rax
+  800f51:	79 1d                	jns    800f70 <vprintfmt+0x452>
+				putch('-', putdat);
+  800f53:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f57:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f5b:	48 89 c6             	mov    %rax,%rsi
+  800f5e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800f63:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800f65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f69:	48 f7 d8             	neg    %rax
+  800f6c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800f70:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800f77:	e9 de 00 00 00       	jmp    80105a <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800f7c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f80:	be 03 00 00 00       	mov    $0x3,%esi
+  800f85:	48 89 c7             	mov    %rax,%rdi
+  800f88:	48 b8 72 78 ff ff ff 	movabs $0xffffffffffff7872,%rax
+  800f8f:	ff ff ff 
+  800f92:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f96:	ff d0                	call   *%rax
+  800f98:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800f9c:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800fa3:	e9 b2 00 00 00       	jmp    80105a <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800fa8:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fac:	be 03 00 00 00       	mov    $0x3,%esi
+  800fb1:	48 89 c7             	mov    %rax,%rdi
+  800fb4:	48 b8 72 78 ff ff ff 	movabs $0xffffffffffff7872,%rax
+  800fbb:	ff ff ff 
+  800fbe:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fc2:	ff d0                	call   *%rax
+  800fc4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800fc8:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800fcf:	e9 86 00 00 00       	jmp    80105a <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800fd4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fd8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fdc:	48 89 c6             	mov    %rax,%rsi
+  800fdf:	bf 30 00 00 00       	mov    $0x30,%edi
+  800fe4:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800fe6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fea:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fee:	48 89 c6             	mov    %rax,%rsi
+  800ff1:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ff6:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800ff8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ffb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ffe:	77 17                	ja     801017 <vprintfmt+0x4f9>
+  801000:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801004:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801007:	89 d2                	mov    %edx,%edx
+  801009:	48 01 d0             	add    %rdx,%rax
+  80100c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80100f:	83 c2 08             	add    $0x8,%edx
+  801012:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801015:	eb 0c                	jmp    801023 <vprintfmt+0x505>
+  801017:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80101b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80101f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801023:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801026:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80102a:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801031:	eb 27                	jmp    80105a <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801033:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801037:	be 03 00 00 00       	mov    $0x3,%esi
+  80103c:	48 89 c7             	mov    %rax,%rdi
+  80103f:	48 b8 72 78 ff ff ff 	movabs $0xffffffffffff7872,%rax
+  801046:	ff ff ff 
+  801049:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80104d:	ff d0                	call   *%rax
+  80104f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801053:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  80105a:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  80105f:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801062:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801065:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801069:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80106d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801071:	45 89 c1             	mov    %r8d,%r9d
+  801074:	41 89 f8             	mov    %edi,%r8d
+  801077:	48 89 c7             	mov    %rax,%rdi
+  80107a:	48 b8 9a 77 ff ff ff 	movabs $0xffffffffffff779a,%rax
+  801081:	ff ff ff 
+  801084:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801088:	ff d0                	call   *%rax
+			break;
+  80108a:	e9 83 00 00 00       	jmp    801112 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80108f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801093:	be 03 00 00 00       	mov    $0x3,%esi
+  801098:	48 89 c7             	mov    %rax,%rdi
+  80109b:	48 b8 72 78 ff ff ff 	movabs $0xffffffffffff7872,%rax
+  8010a2:	ff ff ff 
+  8010a5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010a9:	ff d0                	call   *%rax
+  8010ab:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8010af:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010b3:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8010b7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010bb:	48 89 ce             	mov    %rcx,%rsi
+  8010be:	48 89 c7             	mov    %rax,%rdi
+  8010c1:	48 b8 8d 79 ff ff ff 	movabs $0xffffffffffff798d,%rax
+  8010c8:	ff ff ff 
+  8010cb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010cf:	ff d0                	call   *%rax
+	
+			break;
+  8010d1:	eb 3f                	jmp    801112 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8010d3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010d7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010db:	48 89 c6             	mov    %rax,%rsi
+  8010de:	89 df                	mov    %ebx,%edi
+  8010e0:	ff d2                	call   *%rdx
+			break;
+  8010e2:	eb 2e                	jmp    801112 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8010e4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010e8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010ec:	48 89 c6             	mov    %rax,%rsi
+  8010ef:	bf 25 00 00 00       	mov    $0x25,%edi
+  8010f4:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8010f6:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8010fb:	eb 05                	jmp    801102 <vprintfmt+0x5e4>
+  8010fd:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801102:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801106:	48 83 e8 01          	sub    $0x1,%rax
+  80110a:	0f b6 00             	movzbl (%rax),%eax
+  80110d:	3c 25                	cmp    $0x25,%al
+  80110f:	75 ec                	jne    8010fd <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801111:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801112:	e9 78 fa ff ff       	jmp    800b8f <vprintfmt+0x71>
+				return;
+  801117:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801118:	48 83 c4 60          	add    $0x60,%rsp
+  80111c:	5b                   	pop    %rbx
+  80111d:	41 5c                	pop    %r12
+  80111f:	41 5d                	pop    %r13
+  801121:	41 5f                	pop    %r15
+  801123:	5d                   	pop    %rbp
+  801124:	c3                   	ret
+
+0000000000801125 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801125:	55                   	push   %rbp
+  801126:	48 89 e5             	mov    %rsp,%rbp
+  801129:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801130:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801130 <printfmt+0xb>
+  801137:	49 bb 00 7f 00 00 00 	movabs $0x7f00,%r11
+  80113e:	00 00 00 
+  801141:	4d 01 da             	add    %r11,%r10
+  801144:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80114b:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801152:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801159:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801160:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801167:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80116e:	84 c0                	test   %al,%al
+  801170:	74 20                	je     801192 <printfmt+0x6d>
+  801172:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801176:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80117a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80117e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801182:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801186:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80118a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80118e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801192:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801199:	00 00 00 
+  80119c:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8011a3:	00 00 00 
+  8011a6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011aa:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8011b1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8011b8:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8011bf:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8011c6:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8011cd:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8011d4:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8011db:	48 89 c7             	mov    %rax,%rdi
+  8011de:	48 b8 ee 7a ff ff ff 	movabs $0xffffffffffff7aee,%rax
+  8011e5:	ff ff ff 
+  8011e8:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8011ec:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8011ee:	90                   	nop
+  8011ef:	c9                   	leave
+  8011f0:	c3                   	ret
+
+00000000008011f1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8011f1:	55                   	push   %rbp
+  8011f2:	48 89 e5             	mov    %rsp,%rbp
+  8011f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8011f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011f9 <sprintputch+0x8>
+  801200:	49 bb 37 7e 00 00 00 	movabs $0x7e37,%r11
+  801207:	00 00 00 
+  80120a:	4c 01 d8             	add    %r11,%rax
+  80120d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801210:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801214:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801218:	8b 40 10             	mov    0x10(%rax),%eax
+  80121b:	8d 50 01             	lea    0x1(%rax),%edx
+  80121e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801222:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801225:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801229:	48 8b 10             	mov    (%rax),%rdx
+  80122c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801230:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801234:	48 39 c2             	cmp    %rax,%rdx
+  801237:	73 17                	jae    801250 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801239:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80123d:	48 8b 00             	mov    (%rax),%rax
+  801240:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801244:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801248:	48 89 0a             	mov    %rcx,(%rdx)
+  80124b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80124e:	88 10                	mov    %dl,(%rax)
+}
+  801250:	90                   	nop
+  801251:	c9                   	leave
+  801252:	c3                   	ret
+
+0000000000801253 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801253:	55                   	push   %rbp
+  801254:	48 89 e5             	mov    %rsp,%rbp
+  801257:	53                   	push   %rbx
+  801258:	48 83 ec 58          	sub    $0x58,%rsp
+  80125c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80125c <vsnprintf+0x9>
+  801263:	49 bb d4 7d 00 00 00 	movabs $0x7dd4,%r11
+  80126a:	00 00 00 
+  80126d:	4c 01 d8             	add    %r11,%rax
+  801270:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801274:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801277:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80127b:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80127f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801283:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801287:	48 8b 0e             	mov    (%rsi),%rcx
+  80128a:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80128e:	48 89 0a             	mov    %rcx,(%rdx)
+  801291:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801295:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801299:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80129d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8012a1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8012a5:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8012a8:	48 63 d2             	movslq %edx,%rdx
+  8012ab:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8012af:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8012b3:	48 01 ca             	add    %rcx,%rdx
+  8012b6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8012ba:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8012c1:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8012c6:	74 06                	je     8012ce <vsnprintf+0x7b>
+  8012c8:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8012cc:	7f 07                	jg     8012d5 <vsnprintf+0x82>
+		return -E_INVAL;
+  8012ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012d3:	eb 34                	jmp    801309 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8012d5:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8012d9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8012dd:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8012e1:	48 bf c1 81 ff ff ff 	movabs $0xffffffffffff81c1,%rdi
+  8012e8:	ff ff ff 
+  8012eb:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8012ef:	49 b8 ee 7a ff ff ff 	movabs $0xffffffffffff7aee,%r8
+  8012f6:	ff ff ff 
+  8012f9:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8012fd:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8012ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801303:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801306:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+000000000080130f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+  801313:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80131a:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80131a <snprintf+0xb>
+  801321:	49 bb 16 7d 00 00 00 	movabs $0x7d16,%r11
+  801328:	00 00 00 
+  80132b:	4d 01 da             	add    %r11,%r10
+  80132e:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801335:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80133b:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801342:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801349:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801350:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801357:	84 c0                	test   %al,%al
+  801359:	74 20                	je     80137b <snprintf+0x6c>
+  80135b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80135f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801363:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801367:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80136b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80136f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801373:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801377:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80137b:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801382:	00 00 00 
+  801385:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80138c:	00 00 00 
+  80138f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801393:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80139a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8013a1:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8013a8:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8013af:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8013b6:	48 8b 06             	mov    (%rsi),%rax
+  8013b9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013bd:	48 89 01             	mov    %rax,(%rcx)
+  8013c0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8013c4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8013c8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8013cc:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8013d3:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8013da:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8013e0:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8013e7:	48 89 c7             	mov    %rax,%rdi
+  8013ea:	48 b8 23 82 ff ff ff 	movabs $0xffffffffffff8223,%rax
+  8013f1:	ff ff ff 
+  8013f4:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8013f8:	ff d0                	call   *%rax
+  8013fa:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801400:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801406:	c9                   	leave
+  801407:	c3                   	ret
+
+0000000000801408 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801408:	55                   	push   %rbp
+  801409:	48 89 e5             	mov    %rsp,%rbp
+  80140c:	48 83 ec 18          	sub    $0x18,%rsp
+  801410:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801410 <strlen+0x8>
+  801417:	49 bb 20 7c 00 00 00 	movabs $0x7c20,%r11
+  80141e:	00 00 00 
+  801421:	4c 01 d8             	add    %r11,%rax
+  801424:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801428:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80142f:	eb 09                	jmp    80143a <strlen+0x32>
+		n++;
+  801431:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801435:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80143a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143e:	0f b6 00             	movzbl (%rax),%eax
+  801441:	84 c0                	test   %al,%al
+  801443:	75 ec                	jne    801431 <strlen+0x29>
+	return n;
+  801445:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801448:	c9                   	leave
+  801449:	c3                   	ret
+
+000000000080144a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+  80144e:	48 83 ec 20          	sub    $0x20,%rsp
+  801452:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801452 <strnlen+0x8>
+  801459:	49 bb de 7b 00 00 00 	movabs $0x7bde,%r11
+  801460:	00 00 00 
+  801463:	4c 01 d8             	add    %r11,%rax
+  801466:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80146a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80146e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801475:	eb 0e                	jmp    801485 <strnlen+0x3b>
+		n++;
+  801477:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80147b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801480:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801485:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80148a:	74 0b                	je     801497 <strnlen+0x4d>
+  80148c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801490:	0f b6 00             	movzbl (%rax),%eax
+  801493:	84 c0                	test   %al,%al
+  801495:	75 e0                	jne    801477 <strnlen+0x2d>
+	return n;
+  801497:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80149a:	c9                   	leave
+  80149b:	c3                   	ret
+
+000000000080149c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80149c:	55                   	push   %rbp
+  80149d:	48 89 e5             	mov    %rsp,%rbp
+  8014a0:	48 83 ec 20          	sub    $0x20,%rsp
+  8014a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014a4 <strcpy+0x8>
+  8014ab:	49 bb 8c 7b 00 00 00 	movabs $0x7b8c,%r11
+  8014b2:	00 00 00 
+  8014b5:	4c 01 d8             	add    %r11,%rax
+  8014b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014bc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8014c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8014c8:	90                   	nop
+  8014c9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014cd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014d1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8014dd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014e1:	0f b6 12             	movzbl (%rdx),%edx
+  8014e4:	88 10                	mov    %dl,(%rax)
+  8014e6:	0f b6 00             	movzbl (%rax),%eax
+  8014e9:	84 c0                	test   %al,%al
+  8014eb:	75 dc                	jne    8014c9 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8014ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8014f1:	c9                   	leave
+  8014f2:	c3                   	ret
+
+00000000008014f3 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	53                   	push   %rbx
+  8014f8:	48 83 ec 20          	sub    $0x20,%rsp
+  8014fc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8014fc <strcat+0x9>
+  801503:	49 bb 34 7b 00 00 00 	movabs $0x7b34,%r11
+  80150a:	00 00 00 
+  80150d:	4c 01 db             	add    %r11,%rbx
+  801510:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801514:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801518:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80151c:	48 89 c7             	mov    %rax,%rdi
+  80151f:	48 b8 d8 83 ff ff ff 	movabs $0xffffffffffff83d8,%rax
+  801526:	ff ff ff 
+  801529:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80152d:	ff d0                	call   *%rax
+  80152f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801532:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801535:	48 63 d0             	movslq %eax,%rdx
+  801538:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80153c:	48 01 c2             	add    %rax,%rdx
+  80153f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801543:	48 89 c6             	mov    %rax,%rsi
+  801546:	48 89 d7             	mov    %rdx,%rdi
+  801549:	48 b8 6c 84 ff ff ff 	movabs $0xffffffffffff846c,%rax
+  801550:	ff ff ff 
+  801553:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801557:	ff d0                	call   *%rax
+	return dst;
+  801559:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  80155d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801561:	c9                   	leave
+  801562:	c3                   	ret
+
+0000000000801563 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801563:	55                   	push   %rbp
+  801564:	48 89 e5             	mov    %rsp,%rbp
+  801567:	48 83 ec 28          	sub    $0x28,%rsp
+  80156b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80156b <strncpy+0x8>
+  801572:	49 bb c5 7a 00 00 00 	movabs $0x7ac5,%r11
+  801579:	00 00 00 
+  80157c:	4c 01 d8             	add    %r11,%rax
+  80157f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801583:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801587:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80158b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80158f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801593:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80159a:	00 
+  80159b:	eb 2a                	jmp    8015c7 <strncpy+0x64>
+		*dst++ = *src;
+  80159d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015a1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015a5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8015a9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015ad:	0f b6 12             	movzbl (%rdx),%edx
+  8015b0:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8015b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b6:	0f b6 00             	movzbl (%rax),%eax
+  8015b9:	84 c0                	test   %al,%al
+  8015bb:	74 05                	je     8015c2 <strncpy+0x5f>
+			src++;
+  8015bd:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8015c2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015cb:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8015cf:	72 cc                	jb     80159d <strncpy+0x3a>
+	}
+	return ret;
+  8015d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8015d5:	c9                   	leave
+  8015d6:	c3                   	ret
+
+00000000008015d7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8015d7:	55                   	push   %rbp
+  8015d8:	48 89 e5             	mov    %rsp,%rbp
+  8015db:	48 83 ec 28          	sub    $0x28,%rsp
+  8015df:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015df <strlcpy+0x8>
+  8015e6:	49 bb 51 7a 00 00 00 	movabs $0x7a51,%r11
+  8015ed:	00 00 00 
+  8015f0:	4c 01 d8             	add    %r11,%rax
+  8015f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015f7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015fb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8015ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801603:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801607:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80160c:	74 3d                	je     80164b <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  80160e:	eb 1d                	jmp    80162d <strlcpy+0x56>
+			*dst++ = *src++;
+  801610:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801614:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801618:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80161c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801620:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801624:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801628:	0f b6 12             	movzbl (%rdx),%edx
+  80162b:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80162d:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801632:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801637:	74 0b                	je     801644 <strlcpy+0x6d>
+  801639:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80163d:	0f b6 00             	movzbl (%rax),%eax
+  801640:	84 c0                	test   %al,%al
+  801642:	75 cc                	jne    801610 <strlcpy+0x39>
+		*dst = '\0';
+  801644:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801648:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80164b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80164f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801653:	c9                   	leave
+  801654:	c3                   	ret
+
+0000000000801655 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801655:	55                   	push   %rbp
+  801656:	48 89 e5             	mov    %rsp,%rbp
+  801659:	48 83 ec 10          	sub    $0x10,%rsp
+  80165d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80165d <strcmp+0x8>
+  801664:	49 bb d3 79 00 00 00 	movabs $0x79d3,%r11
+  80166b:	00 00 00 
+  80166e:	4c 01 d8             	add    %r11,%rax
+  801671:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801675:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801679:	eb 0a                	jmp    801685 <strcmp+0x30>
+		p++, q++;
+  80167b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801680:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801689:	0f b6 00             	movzbl (%rax),%eax
+  80168c:	84 c0                	test   %al,%al
+  80168e:	74 12                	je     8016a2 <strcmp+0x4d>
+  801690:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801694:	0f b6 10             	movzbl (%rax),%edx
+  801697:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80169b:	0f b6 00             	movzbl (%rax),%eax
+  80169e:	38 c2                	cmp    %al,%dl
+  8016a0:	74 d9                	je     80167b <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8016a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a6:	0f b6 00             	movzbl (%rax),%eax
+  8016a9:	0f b6 d0             	movzbl %al,%edx
+  8016ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016b0:	0f b6 00             	movzbl (%rax),%eax
+  8016b3:	0f b6 c0             	movzbl %al,%eax
+  8016b6:	29 c2                	sub    %eax,%edx
+  8016b8:	89 d0                	mov    %edx,%eax
+}
+  8016ba:	c9                   	leave
+  8016bb:	c3                   	ret
+
+00000000008016bc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8016bc:	55                   	push   %rbp
+  8016bd:	48 89 e5             	mov    %rsp,%rbp
+  8016c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8016c4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016c4 <strncmp+0x8>
+  8016cb:	49 bb 6c 79 00 00 00 	movabs $0x796c,%r11
+  8016d2:	00 00 00 
+  8016d5:	4c 01 d8             	add    %r11,%rax
+  8016d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016e0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8016e4:	eb 0f                	jmp    8016f5 <strncmp+0x39>
+		n--, p++, q++;
+  8016e6:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8016eb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016f0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8016f5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016fa:	74 1d                	je     801719 <strncmp+0x5d>
+  8016fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801700:	0f b6 00             	movzbl (%rax),%eax
+  801703:	84 c0                	test   %al,%al
+  801705:	74 12                	je     801719 <strncmp+0x5d>
+  801707:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80170b:	0f b6 10             	movzbl (%rax),%edx
+  80170e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801712:	0f b6 00             	movzbl (%rax),%eax
+  801715:	38 c2                	cmp    %al,%dl
+  801717:	74 cd                	je     8016e6 <strncmp+0x2a>
+	if (n == 0)
+  801719:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80171e:	75 07                	jne    801727 <strncmp+0x6b>
+		return 0;
+  801720:	ba 00 00 00 00       	mov    $0x0,%edx
+  801725:	eb 16                	jmp    80173d <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801727:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172b:	0f b6 00             	movzbl (%rax),%eax
+  80172e:	0f b6 d0             	movzbl %al,%edx
+  801731:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801735:	0f b6 00             	movzbl (%rax),%eax
+  801738:	0f b6 c0             	movzbl %al,%eax
+  80173b:	29 c2                	sub    %eax,%edx
+}
+  80173d:	89 d0                	mov    %edx,%eax
+  80173f:	c9                   	leave
+  801740:	c3                   	ret
+
+0000000000801741 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801741:	55                   	push   %rbp
+  801742:	48 89 e5             	mov    %rsp,%rbp
+  801745:	48 83 ec 10          	sub    $0x10,%rsp
+  801749:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801749 <strchr+0x8>
+  801750:	49 bb e7 78 00 00 00 	movabs $0x78e7,%r11
+  801757:	00 00 00 
+  80175a:	4c 01 d8             	add    %r11,%rax
+  80175d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801761:	89 f0                	mov    %esi,%eax
+  801763:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801766:	eb 17                	jmp    80177f <strchr+0x3e>
+		if (*s == c)
+  801768:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80176c:	0f b6 00             	movzbl (%rax),%eax
+  80176f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801772:	75 06                	jne    80177a <strchr+0x39>
+			return (char *) s;
+  801774:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801778:	eb 15                	jmp    80178f <strchr+0x4e>
+	for (; *s; s++)
+  80177a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80177f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801783:	0f b6 00             	movzbl (%rax),%eax
+  801786:	84 c0                	test   %al,%al
+  801788:	75 de                	jne    801768 <strchr+0x27>
+	return 0;
+  80178a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80178f:	c9                   	leave
+  801790:	c3                   	ret
+
+0000000000801791 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801791:	55                   	push   %rbp
+  801792:	48 89 e5             	mov    %rsp,%rbp
+  801795:	48 83 ec 10          	sub    $0x10,%rsp
+  801799:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801799 <strfind+0x8>
+  8017a0:	49 bb 97 78 00 00 00 	movabs $0x7897,%r11
+  8017a7:	00 00 00 
+  8017aa:	4c 01 d8             	add    %r11,%rax
+  8017ad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017b1:	89 f0                	mov    %esi,%eax
+  8017b3:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8017b6:	eb 11                	jmp    8017c9 <strfind+0x38>
+		if (*s == c)
+  8017b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017bc:	0f b6 00             	movzbl (%rax),%eax
+  8017bf:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8017c2:	74 12                	je     8017d6 <strfind+0x45>
+	for (; *s; s++)
+  8017c4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017cd:	0f b6 00             	movzbl (%rax),%eax
+  8017d0:	84 c0                	test   %al,%al
+  8017d2:	75 e4                	jne    8017b8 <strfind+0x27>
+  8017d4:	eb 01                	jmp    8017d7 <strfind+0x46>
+			break;
+  8017d6:	90                   	nop
+	return (char *) s;
+  8017d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017db:	c9                   	leave
+  8017dc:	c3                   	ret
+
+00000000008017dd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8017dd:	55                   	push   %rbp
+  8017de:	48 89 e5             	mov    %rsp,%rbp
+  8017e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8017e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e5 <memset+0x8>
+  8017ec:	49 bb 4b 78 00 00 00 	movabs $0x784b,%r11
+  8017f3:	00 00 00 
+  8017f6:	4c 01 d8             	add    %r11,%rax
+  8017f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017fd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801800:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801804:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801809:	75 06                	jne    801811 <memset+0x34>
+		return v;
+  80180b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180f:	eb 69                	jmp    80187a <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801811:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801815:	83 e0 03             	and    $0x3,%eax
+  801818:	48 85 c0             	test   %rax,%rax
+  80181b:	75 48                	jne    801865 <memset+0x88>
+  80181d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801821:	83 e0 03             	and    $0x3,%eax
+  801824:	48 85 c0             	test   %rax,%rax
+  801827:	75 3c                	jne    801865 <memset+0x88>
+		c &= 0xFF;
+  801829:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801830:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801833:	c1 e0 18             	shl    $0x18,%eax
+  801836:	89 c2                	mov    %eax,%edx
+  801838:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80183b:	c1 e0 10             	shl    $0x10,%eax
+  80183e:	09 c2                	or     %eax,%edx
+  801840:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801843:	c1 e0 08             	shl    $0x8,%eax
+  801846:	09 d0                	or     %edx,%eax
+  801848:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  80184b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80184f:	48 c1 e8 02          	shr    $0x2,%rax
+  801853:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801856:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80185a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80185d:	48 89 d7             	mov    %rdx,%rdi
+  801860:	fc                   	cld
+  801861:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801863:	eb 11                	jmp    801876 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801865:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801869:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80186c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801870:	48 89 d7             	mov    %rdx,%rdi
+  801873:	fc                   	cld
+  801874:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801876:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80187a:	c9                   	leave
+  80187b:	c3                   	ret
+
+000000000080187c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80187c:	55                   	push   %rbp
+  80187d:	48 89 e5             	mov    %rsp,%rbp
+  801880:	48 83 ec 28          	sub    $0x28,%rsp
+  801884:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801884 <memmove+0x8>
+  80188b:	49 bb ac 77 00 00 00 	movabs $0x77ac,%r11
+  801892:	00 00 00 
+  801895:	4c 01 d8             	add    %r11,%rax
+  801898:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80189c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018a0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8018a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018a8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8018ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8018b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018b8:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8018bc:	0f 83 88 00 00 00    	jae    80194a <memmove+0xce>
+  8018c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ca:	48 01 d0             	add    %rdx,%rax
+  8018cd:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8018d1:	73 77                	jae    80194a <memmove+0xce>
+		s += n;
+  8018d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8018db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018df:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8018e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e7:	83 e0 03             	and    $0x3,%eax
+  8018ea:	48 85 c0             	test   %rax,%rax
+  8018ed:	75 3b                	jne    80192a <memmove+0xae>
+  8018ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f3:	83 e0 03             	and    $0x3,%eax
+  8018f6:	48 85 c0             	test   %rax,%rax
+  8018f9:	75 2f                	jne    80192a <memmove+0xae>
+  8018fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ff:	83 e0 03             	and    $0x3,%eax
+  801902:	48 85 c0             	test   %rax,%rax
+  801905:	75 23                	jne    80192a <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801907:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80190b:	48 83 e8 04          	sub    $0x4,%rax
+  80190f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801913:	48 83 ea 04          	sub    $0x4,%rdx
+  801917:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80191b:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80191f:	48 89 c7             	mov    %rax,%rdi
+  801922:	48 89 d6             	mov    %rdx,%rsi
+  801925:	fd                   	std
+  801926:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801928:	eb 1d                	jmp    801947 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80192a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80192e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801932:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801936:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  80193a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80193e:	48 89 d7             	mov    %rdx,%rdi
+  801941:	48 89 c1             	mov    %rax,%rcx
+  801944:	fd                   	std
+  801945:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801947:	fc                   	cld
+  801948:	eb 57                	jmp    8019a1 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80194a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80194e:	83 e0 03             	and    $0x3,%eax
+  801951:	48 85 c0             	test   %rax,%rax
+  801954:	75 36                	jne    80198c <memmove+0x110>
+  801956:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80195a:	83 e0 03             	and    $0x3,%eax
+  80195d:	48 85 c0             	test   %rax,%rax
+  801960:	75 2a                	jne    80198c <memmove+0x110>
+  801962:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801966:	83 e0 03             	and    $0x3,%eax
+  801969:	48 85 c0             	test   %rax,%rax
+  80196c:	75 1e                	jne    80198c <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80196e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801972:	48 c1 e8 02          	shr    $0x2,%rax
+  801976:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801979:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80197d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801981:	48 89 c7             	mov    %rax,%rdi
+  801984:	48 89 d6             	mov    %rdx,%rsi
+  801987:	fc                   	cld
+  801988:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80198a:	eb 15                	jmp    8019a1 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  80198c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801990:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801994:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801998:	48 89 c7             	mov    %rax,%rdi
+  80199b:	48 89 d6             	mov    %rdx,%rsi
+  80199e:	fc                   	cld
+  80199f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8019a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019a5:	c9                   	leave
+  8019a6:	c3                   	ret
+
+00000000008019a7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8019a7:	55                   	push   %rbp
+  8019a8:	48 89 e5             	mov    %rsp,%rbp
+  8019ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8019af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019af <memcpy+0x8>
+  8019b6:	49 bb 81 76 00 00 00 	movabs $0x7681,%r11
+  8019bd:	00 00 00 
+  8019c0:	4c 01 d8             	add    %r11,%rax
+  8019c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8019cb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8019cf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019d3:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8019d7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8019db:	48 89 cf             	mov    %rcx,%rdi
+  8019de:	48 b9 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rcx
+  8019e5:	ff ff ff 
+  8019e8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8019ec:	ff d0                	call   *%rax
+}
+  8019ee:	c9                   	leave
+  8019ef:	c3                   	ret
+
+00000000008019f0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8019f0:	55                   	push   %rbp
+  8019f1:	48 89 e5             	mov    %rsp,%rbp
+  8019f4:	48 83 ec 28          	sub    $0x28,%rsp
+  8019f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019f8 <memcmp+0x8>
+  8019ff:	49 bb 38 76 00 00 00 	movabs $0x7638,%r11
+  801a06:	00 00 00 
+  801a09:	4c 01 d8             	add    %r11,%rax
+  801a0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a10:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a14:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801a18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a1c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801a20:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a24:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801a28:	eb 34                	jmp    801a5e <memcmp+0x6e>
+		if (*s1 != *s2)
+  801a2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a2e:	0f b6 10             	movzbl (%rax),%edx
+  801a31:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a35:	0f b6 00             	movzbl (%rax),%eax
+  801a38:	38 c2                	cmp    %al,%dl
+  801a3a:	74 18                	je     801a54 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801a3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a40:	0f b6 00             	movzbl (%rax),%eax
+  801a43:	0f b6 d0             	movzbl %al,%edx
+  801a46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a4a:	0f b6 00             	movzbl (%rax),%eax
+  801a4d:	0f b6 c0             	movzbl %al,%eax
+  801a50:	29 c2                	sub    %eax,%edx
+  801a52:	eb 20                	jmp    801a74 <memcmp+0x84>
+		s1++, s2++;
+  801a54:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a59:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801a5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a62:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a66:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801a6a:	48 85 c0             	test   %rax,%rax
+  801a6d:	75 bb                	jne    801a2a <memcmp+0x3a>
+	}
+
+	return 0;
+  801a6f:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801a74:	89 d0                	mov    %edx,%eax
+  801a76:	c9                   	leave
+  801a77:	c3                   	ret
+
+0000000000801a78 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801a78:	55                   	push   %rbp
+  801a79:	48 89 e5             	mov    %rsp,%rbp
+  801a7c:	48 83 ec 28          	sub    $0x28,%rsp
+  801a80:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a80 <memfind+0x8>
+  801a87:	49 bb b0 75 00 00 00 	movabs $0x75b0,%r11
+  801a8e:	00 00 00 
+  801a91:	4c 01 d8             	add    %r11,%rax
+  801a94:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a98:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801a9b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801a9f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801aa3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa7:	48 01 d0             	add    %rdx,%rax
+  801aaa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801aae:	eb 13                	jmp    801ac3 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801ab0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ab4:	0f b6 00             	movzbl (%rax),%eax
+  801ab7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801aba:	38 d0                	cmp    %dl,%al
+  801abc:	74 11                	je     801acf <memfind+0x57>
+	for (; s < ends; s++)
+  801abe:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ac3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ac7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801acb:	72 e3                	jb     801ab0 <memfind+0x38>
+  801acd:	eb 01                	jmp    801ad0 <memfind+0x58>
+			break;
+  801acf:	90                   	nop
+	return (void *) s;
+  801ad0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ad4:	c9                   	leave
+  801ad5:	c3                   	ret
+
+0000000000801ad6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801ad6:	55                   	push   %rbp
+  801ad7:	48 89 e5             	mov    %rsp,%rbp
+  801ada:	48 83 ec 38          	sub    $0x38,%rsp
+  801ade:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ade <strtol+0x8>
+  801ae5:	49 bb 52 75 00 00 00 	movabs $0x7552,%r11
+  801aec:	00 00 00 
+  801aef:	4c 01 d8             	add    %r11,%rax
+  801af2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801af6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801afa:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801afd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b04:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b0b:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801b0c:	eb 05                	jmp    801b13 <strtol+0x3d>
+		s++;
+  801b0e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801b13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b17:	0f b6 00             	movzbl (%rax),%eax
+  801b1a:	3c 20                	cmp    $0x20,%al
+  801b1c:	74 f0                	je     801b0e <strtol+0x38>
+  801b1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b22:	0f b6 00             	movzbl (%rax),%eax
+  801b25:	3c 09                	cmp    $0x9,%al
+  801b27:	74 e5                	je     801b0e <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801b29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b2d:	0f b6 00             	movzbl (%rax),%eax
+  801b30:	3c 2b                	cmp    $0x2b,%al
+  801b32:	75 07                	jne    801b3b <strtol+0x65>
+		s++;
+  801b34:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b39:	eb 17                	jmp    801b52 <strtol+0x7c>
+	else if (*s == '-')
+  801b3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b3f:	0f b6 00             	movzbl (%rax),%eax
+  801b42:	3c 2d                	cmp    $0x2d,%al
+  801b44:	75 0c                	jne    801b52 <strtol+0x7c>
+		s++, neg = 1;
+  801b46:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b4b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801b52:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b56:	74 06                	je     801b5e <strtol+0x88>
+  801b58:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801b5c:	75 28                	jne    801b86 <strtol+0xb0>
+  801b5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b62:	0f b6 00             	movzbl (%rax),%eax
+  801b65:	3c 30                	cmp    $0x30,%al
+  801b67:	75 1d                	jne    801b86 <strtol+0xb0>
+  801b69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b6d:	48 83 c0 01          	add    $0x1,%rax
+  801b71:	0f b6 00             	movzbl (%rax),%eax
+  801b74:	3c 78                	cmp    $0x78,%al
+  801b76:	75 0e                	jne    801b86 <strtol+0xb0>
+		s += 2, base = 16;
+  801b78:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801b7d:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801b84:	eb 2c                	jmp    801bb2 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801b86:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b8a:	75 19                	jne    801ba5 <strtol+0xcf>
+  801b8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b90:	0f b6 00             	movzbl (%rax),%eax
+  801b93:	3c 30                	cmp    $0x30,%al
+  801b95:	75 0e                	jne    801ba5 <strtol+0xcf>
+		s++, base = 8;
+  801b97:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b9c:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801ba3:	eb 0d                	jmp    801bb2 <strtol+0xdc>
+	else if (base == 0)
+  801ba5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ba9:	75 07                	jne    801bb2 <strtol+0xdc>
+		base = 10;
+  801bab:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801bb2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb6:	0f b6 00             	movzbl (%rax),%eax
+  801bb9:	3c 2f                	cmp    $0x2f,%al
+  801bbb:	7e 1d                	jle    801bda <strtol+0x104>
+  801bbd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc1:	0f b6 00             	movzbl (%rax),%eax
+  801bc4:	3c 39                	cmp    $0x39,%al
+  801bc6:	7f 12                	jg     801bda <strtol+0x104>
+			dig = *s - '0';
+  801bc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bcc:	0f b6 00             	movzbl (%rax),%eax
+  801bcf:	0f be c0             	movsbl %al,%eax
+  801bd2:	83 e8 30             	sub    $0x30,%eax
+  801bd5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801bd8:	eb 4e                	jmp    801c28 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801bda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bde:	0f b6 00             	movzbl (%rax),%eax
+  801be1:	3c 60                	cmp    $0x60,%al
+  801be3:	7e 1d                	jle    801c02 <strtol+0x12c>
+  801be5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be9:	0f b6 00             	movzbl (%rax),%eax
+  801bec:	3c 7a                	cmp    $0x7a,%al
+  801bee:	7f 12                	jg     801c02 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801bf0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bf4:	0f b6 00             	movzbl (%rax),%eax
+  801bf7:	0f be c0             	movsbl %al,%eax
+  801bfa:	83 e8 57             	sub    $0x57,%eax
+  801bfd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c00:	eb 26                	jmp    801c28 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c02:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c06:	0f b6 00             	movzbl (%rax),%eax
+  801c09:	3c 40                	cmp    $0x40,%al
+  801c0b:	7e 47                	jle    801c54 <strtol+0x17e>
+  801c0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c11:	0f b6 00             	movzbl (%rax),%eax
+  801c14:	3c 5a                	cmp    $0x5a,%al
+  801c16:	7f 3c                	jg     801c54 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801c18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c1c:	0f b6 00             	movzbl (%rax),%eax
+  801c1f:	0f be c0             	movsbl %al,%eax
+  801c22:	83 e8 37             	sub    $0x37,%eax
+  801c25:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801c28:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c2b:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801c2e:	7d 23                	jge    801c53 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801c30:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c35:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801c38:	48 98                	cltq
+  801c3a:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801c3f:	48 89 c2             	mov    %rax,%rdx
+  801c42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c45:	48 98                	cltq
+  801c47:	48 01 d0             	add    %rdx,%rax
+  801c4a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801c4e:	e9 5f ff ff ff       	jmp    801bb2 <strtol+0xdc>
+			break;
+  801c53:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801c54:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801c59:	74 0b                	je     801c66 <strtol+0x190>
+		*endptr = (char *) s;
+  801c5b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c5f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801c63:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801c66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801c6a:	74 09                	je     801c75 <strtol+0x19f>
+  801c6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c70:	48 f7 d8             	neg    %rax
+  801c73:	eb 04                	jmp    801c79 <strtol+0x1a3>
+  801c75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801c79:	c9                   	leave
+  801c7a:	c3                   	ret
+
+0000000000801c7b <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801c7b:	55                   	push   %rbp
+  801c7c:	48 89 e5             	mov    %rsp,%rbp
+  801c7f:	53                   	push   %rbx
+  801c80:	48 83 ec 30          	sub    $0x30,%rsp
+  801c84:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801c84 <strstr+0x9>
+  801c8b:	49 bb ac 73 00 00 00 	movabs $0x73ac,%r11
+  801c92:	00 00 00 
+  801c95:	4c 01 db             	add    %r11,%rbx
+  801c98:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801c9c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801ca0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ca4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ca8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cac:	0f b6 00             	movzbl (%rax),%eax
+  801caf:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801cb2:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801cb6:	75 06                	jne    801cbe <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801cb8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cbc:	eb 73                	jmp    801d31 <strstr+0xb6>
+
+	len = strlen(str);
+  801cbe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cc2:	48 89 c7             	mov    %rax,%rdi
+  801cc5:	48 b8 d8 83 ff ff ff 	movabs $0xffffffffffff83d8,%rax
+  801ccc:	ff ff ff 
+  801ccf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801cd3:	ff d0                	call   *%rax
+  801cd5:	48 98                	cltq
+  801cd7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801cdb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cdf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ce3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ce7:	0f b6 00             	movzbl (%rax),%eax
+  801cea:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801ced:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801cf1:	75 07                	jne    801cfa <strstr+0x7f>
+				return (char *) 0;
+  801cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf8:	eb 37                	jmp    801d31 <strstr+0xb6>
+		} while (sc != c);
+  801cfa:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801cfe:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801d01:	75 d8                	jne    801cdb <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801d03:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d07:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d0f:	48 89 ce             	mov    %rcx,%rsi
+  801d12:	48 89 c7             	mov    %rax,%rdi
+  801d15:	48 b8 8c 86 ff ff ff 	movabs $0xffffffffffff868c,%rax
+  801d1c:	ff ff ff 
+  801d1f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d23:	ff d0                	call   *%rax
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	75 b2                	jne    801cdb <strstr+0x60>
+
+	return (char *) (in - 1);
+  801d29:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d2d:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801d31:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d35:	c9                   	leave
+  801d36:	c3                   	ret
+
+0000000000801d37 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801d37:	55                   	push   %rbp
+  801d38:	48 89 e5             	mov    %rsp,%rbp
+  801d3b:	41 57                	push   %r15
+  801d3d:	53                   	push   %rbx
+  801d3e:	48 83 ec 40          	sub    $0x40,%rsp
+  801d42:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801d42 <syscall+0xb>
+  801d49:	49 bb ee 72 00 00 00 	movabs $0x72ee,%r11
+  801d50:	00 00 00 
+  801d53:	4d 01 da             	add    %r11,%r10
+  801d56:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801d59:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801d5c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d60:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801d64:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801d68:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801d6c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d6f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801d73:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d77:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801d7b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801d7f:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d83:	4c 89 c3             	mov    %r8,%rbx
+  801d86:	cd 30                	int    $0x30
+  801d88:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801d8c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801d90:	74 52                	je     801de4 <syscall+0xad>
+  801d92:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d97:	7e 4b                	jle    801de4 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d99:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d9d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801da0:	49 89 d0             	mov    %rdx,%r8
+  801da3:	89 c1                	mov    %eax,%ecx
+  801da5:	48 b8 18 dc ff ff ff 	movabs $0xffffffffffffdc18,%rax
+  801dac:	ff ff ff 
+  801daf:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801db3:	48 89 c2             	mov    %rax,%rdx
+  801db6:	be 23 00 00 00       	mov    $0x23,%esi
+  801dbb:	48 b8 35 dc ff ff ff 	movabs $0xffffffffffffdc35,%rax
+  801dc2:	ff ff ff 
+  801dc5:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801dc9:	48 89 c7             	mov    %rax,%rdi
+  801dcc:	4d 89 d7             	mov    %r10,%r15
+  801dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd4:	49 b9 da c7 ff ff ff 	movabs $0xffffffffffffc7da,%r9
+  801ddb:	ff ff ff 
+  801dde:	4d 01 d1             	add    %r10,%r9
+  801de1:	41 ff d1             	call   *%r9
+
+	return ret;
+  801de4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801de8:	48 83 c4 40          	add    $0x40,%rsp
+  801dec:	5b                   	pop    %rbx
+  801ded:	41 5f                	pop    %r15
+  801def:	5d                   	pop    %rbp
+  801df0:	c3                   	ret
+
+0000000000801df1 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801df1:	55                   	push   %rbp
+  801df2:	48 89 e5             	mov    %rsp,%rbp
+  801df5:	41 57                	push   %r15
+  801df7:	41 56                	push   %r14
+  801df9:	41 55                	push   %r13
+  801dfb:	41 54                	push   %r12
+  801dfd:	53                   	push   %rbx
+  801dfe:	48 83 ec 48          	sub    $0x48,%rsp
+  801e02:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801e02 <syscall_words+0x11>
+  801e09:	49 bb 2e 72 00 00 00 	movabs $0x722e,%r11
+  801e10:	00 00 00 
+  801e13:	4d 01 de             	add    %r11,%r14
+  801e16:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801e19:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801e1c:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801e20:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801e24:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801e28:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801e2c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e31:	74 09                	je     801e3c <syscall_words+0x4b>
+  801e33:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e37:	48 8b 00             	mov    (%rax),%rax
+  801e3a:	eb 05                	jmp    801e41 <syscall_words+0x50>
+  801e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e41:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801e44:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e49:	74 0a                	je     801e55 <syscall_words+0x64>
+  801e4b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e4f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e53:	eb 05                	jmp    801e5a <syscall_words+0x69>
+  801e55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5a:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801e5d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e62:	74 0a                	je     801e6e <syscall_words+0x7d>
+  801e64:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e68:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e6c:	eb 05                	jmp    801e73 <syscall_words+0x82>
+  801e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e73:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801e76:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e7b:	74 0a                	je     801e87 <syscall_words+0x96>
+  801e7d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e81:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e85:	eb 05                	jmp    801e8c <syscall_words+0x9b>
+  801e87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8c:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801e8f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e94:	74 0a                	je     801ea0 <syscall_words+0xaf>
+  801e96:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e9a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e9e:	eb 05                	jmp    801ea5 <syscall_words+0xb4>
+  801ea0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea5:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801ea8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ead:	74 0a                	je     801eb9 <syscall_words+0xc8>
+  801eaf:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801eb3:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801eb7:	eb 05                	jmp    801ebe <syscall_words+0xcd>
+  801eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebe:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801ec1:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801ec4:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801ec8:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801ecc:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801ed0:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801ed4:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ed8:	cd 30                	int    $0x30
+  801eda:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801ede:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ee3:	74 50                	je     801f35 <syscall_words+0x144>
+		words[0] = r8;
+  801ee5:	4c 89 c2             	mov    %r8,%rdx
+  801ee8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801eec:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801eef:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ef3:	48 83 c0 08          	add    $0x8,%rax
+  801ef7:	4c 89 ca             	mov    %r9,%rdx
+  801efa:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801efd:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f01:	48 83 c0 10          	add    $0x10,%rax
+  801f05:	4c 89 d2             	mov    %r10,%rdx
+  801f08:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801f0b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f0f:	48 83 c0 18          	add    $0x18,%rax
+  801f13:	4c 89 da             	mov    %r11,%rdx
+  801f16:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801f19:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f1d:	48 83 c0 20          	add    $0x20,%rax
+  801f21:	4c 89 e2             	mov    %r12,%rdx
+  801f24:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801f27:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f2b:	48 83 c0 28          	add    $0x28,%rax
+  801f2f:	4c 89 ea             	mov    %r13,%rdx
+  801f32:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801f35:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801f39:	74 52                	je     801f8d <syscall_words+0x19c>
+  801f3b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801f40:	7e 4b                	jle    801f8d <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f42:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f46:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f49:	49 89 d0             	mov    %rdx,%r8
+  801f4c:	89 c1                	mov    %eax,%ecx
+  801f4e:	48 b8 18 dc ff ff ff 	movabs $0xffffffffffffdc18,%rax
+  801f55:	ff ff ff 
+  801f58:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801f5c:	48 89 c2             	mov    %rax,%rdx
+  801f5f:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801f64:	48 b8 35 dc ff ff ff 	movabs $0xffffffffffffdc35,%rax
+  801f6b:	ff ff ff 
+  801f6e:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801f72:	48 89 c7             	mov    %rax,%rdi
+  801f75:	4d 89 f7             	mov    %r14,%r15
+  801f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7d:	49 b9 da c7 ff ff ff 	movabs $0xffffffffffffc7da,%r9
+  801f84:	ff ff ff 
+  801f87:	4d 01 f1             	add    %r14,%r9
+  801f8a:	41 ff d1             	call   *%r9
+
+	return ret;
+  801f8d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801f91:	48 83 c4 48          	add    $0x48,%rsp
+  801f95:	5b                   	pop    %rbx
+  801f96:	41 5c                	pop    %r12
+  801f98:	41 5d                	pop    %r13
+  801f9a:	41 5e                	pop    %r14
+  801f9c:	41 5f                	pop    %r15
+  801f9e:	5d                   	pop    %rbp
+  801f9f:	c3                   	ret
+
+0000000000801fa0 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801fa0:	55                   	push   %rbp
+  801fa1:	48 89 e5             	mov    %rsp,%rbp
+  801fa4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fa8 <sys_cputs+0x8>
+  801faf:	49 bb 88 70 00 00 00 	movabs $0x7088,%r11
+  801fb6:	00 00 00 
+  801fb9:	4c 01 d8             	add    %r11,%rax
+  801fbc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801fc0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801fc4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801fc8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fcc:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd0:	6a 00                	push   $0x0
+  801fd2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fd8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fde:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fe8:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  801fef:	ff ff ff 
+  801ff2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ff6:	ff d0                	call   *%rax
+  801ff8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ffc:	90                   	nop
+  801ffd:	c9                   	leave
+  801ffe:	c3                   	ret
+
+0000000000801fff <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801fff:	55                   	push   %rbp
+  802000:	48 89 e5             	mov    %rsp,%rbp
+  802003:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802003 <sys_cgetc+0x4>
+  80200a:	49 bb 2d 70 00 00 00 	movabs $0x702d,%r11
+  802011:	00 00 00 
+  802014:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802017:	48 83 ec 08          	sub    $0x8,%rsp
+  80201b:	6a 00                	push   $0x0
+  80201d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802023:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802029:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80202e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802033:	be 00 00 00 00       	mov    $0x0,%esi
+  802038:	bf 01 00 00 00       	mov    $0x1,%edi
+  80203d:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802044:	ff ff ff 
+  802047:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80204b:	ff d0                	call   *%rax
+  80204d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802051:	c9                   	leave
+  802052:	c3                   	ret
+
+0000000000802053 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802053:	55                   	push   %rbp
+  802054:	48 89 e5             	mov    %rsp,%rbp
+  802057:	48 83 ec 10          	sub    $0x10,%rsp
+  80205b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80205b <sys_env_destroy+0x8>
+  802062:	49 bb d5 6f 00 00 00 	movabs $0x6fd5,%r11
+  802069:	00 00 00 
+  80206c:	4c 01 d8             	add    %r11,%rax
+  80206f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802072:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802075:	48 63 d2             	movslq %edx,%rdx
+  802078:	48 83 ec 08          	sub    $0x8,%rsp
+  80207c:	6a 00                	push   $0x0
+  80207e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802084:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80208a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208f:	be 01 00 00 00       	mov    $0x1,%esi
+  802094:	bf 03 00 00 00       	mov    $0x3,%edi
+  802099:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  8020a0:	ff ff ff 
+  8020a3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020a7:	ff d0                	call   *%rax
+  8020a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020ad:	c9                   	leave
+  8020ae:	c3                   	ret
+
+00000000008020af <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8020af:	55                   	push   %rbp
+  8020b0:	48 89 e5             	mov    %rsp,%rbp
+  8020b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020b3 <sys_getenvid+0x4>
+  8020ba:	49 bb 7d 6f 00 00 00 	movabs $0x6f7d,%r11
+  8020c1:	00 00 00 
+  8020c4:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8020c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8020cb:	6a 00                	push   $0x0
+  8020cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020ed:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  8020f4:	ff ff ff 
+  8020f7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020fb:	ff d0                	call   *%rax
+  8020fd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802101:	c9                   	leave
+  802102:	c3                   	ret
+
+0000000000802103 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802103:	55                   	push   %rbp
+  802104:	48 89 e5             	mov    %rsp,%rbp
+  802107:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802107 <sys_yield+0x4>
+  80210e:	49 bb 29 6f 00 00 00 	movabs $0x6f29,%r11
+  802115:	00 00 00 
+  802118:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80211b:	48 83 ec 08          	sub    $0x8,%rsp
+  80211f:	6a 00                	push   $0x0
+  802121:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802127:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80212d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802132:	ba 00 00 00 00       	mov    $0x0,%edx
+  802137:	be 00 00 00 00       	mov    $0x0,%esi
+  80213c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802141:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802148:	ff ff ff 
+  80214b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80214f:	ff d0                	call   *%rax
+  802151:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802155:	90                   	nop
+  802156:	c9                   	leave
+  802157:	c3                   	ret
+
+0000000000802158 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802158:	55                   	push   %rbp
+  802159:	48 89 e5             	mov    %rsp,%rbp
+  80215c:	48 83 ec 10          	sub    $0x10,%rsp
+  802160:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802160 <sys_page_alloc+0x8>
+  802167:	49 bb d0 6e 00 00 00 	movabs $0x6ed0,%r11
+  80216e:	00 00 00 
+  802171:	4c 01 d8             	add    %r11,%rax
+  802174:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802177:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80217b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80217e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802181:	48 63 f2             	movslq %edx,%rsi
+  802184:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802188:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80218b:	48 63 d2             	movslq %edx,%rdx
+  80218e:	48 83 ec 08          	sub    $0x8,%rsp
+  802192:	6a 00                	push   $0x0
+  802194:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80219a:	49 89 f0             	mov    %rsi,%r8
+  80219d:	be 01 00 00 00       	mov    $0x1,%esi
+  8021a2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021a7:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  8021ae:	ff ff ff 
+  8021b1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021b5:	ff d0                	call   *%rax
+  8021b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021bb:	c9                   	leave
+  8021bc:	c3                   	ret
+
+00000000008021bd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8021c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021c5 <sys_page_map+0x8>
+  8021cc:	49 bb 6b 6e 00 00 00 	movabs $0x6e6b,%r11
+  8021d3:	00 00 00 
+  8021d6:	4c 01 d8             	add    %r11,%rax
+  8021d9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021e0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8021e3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021e7:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8021eb:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8021ee:	48 63 f2             	movslq %edx,%rsi
+  8021f1:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8021f5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021f8:	48 63 fa             	movslq %edx,%rdi
+  8021fb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021ff:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802202:	48 63 d2             	movslq %edx,%rdx
+  802205:	48 83 ec 08          	sub    $0x8,%rsp
+  802209:	56                   	push   %rsi
+  80220a:	4d 89 c1             	mov    %r8,%r9
+  80220d:	49 89 f8             	mov    %rdi,%r8
+  802210:	be 01 00 00 00       	mov    $0x1,%esi
+  802215:	bf 05 00 00 00       	mov    $0x5,%edi
+  80221a:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802221:	ff ff ff 
+  802224:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802228:	ff d0                	call   *%rax
+  80222a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80222e:	c9                   	leave
+  80222f:	c3                   	ret
+
+0000000000802230 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802230:	55                   	push   %rbp
+  802231:	48 89 e5             	mov    %rsp,%rbp
+  802234:	48 83 ec 10          	sub    $0x10,%rsp
+  802238:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802238 <sys_page_unmap+0x8>
+  80223f:	49 bb f8 6d 00 00 00 	movabs $0x6df8,%r11
+  802246:	00 00 00 
+  802249:	4c 01 d8             	add    %r11,%rax
+  80224c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80224f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802253:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802257:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80225a:	48 63 d2             	movslq %edx,%rdx
+  80225d:	48 83 ec 08          	sub    $0x8,%rsp
+  802261:	6a 00                	push   $0x0
+  802263:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80226f:	be 01 00 00 00       	mov    $0x1,%esi
+  802274:	bf 06 00 00 00       	mov    $0x6,%edi
+  802279:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802280:	ff ff ff 
+  802283:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802287:	ff d0                	call   *%rax
+  802289:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80228d:	c9                   	leave
+  80228e:	c3                   	ret
+
+000000000080228f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80228f:	55                   	push   %rbp
+  802290:	48 89 e5             	mov    %rsp,%rbp
+  802293:	48 83 ec 10          	sub    $0x10,%rsp
+  802297:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802297 <sys_env_set_status+0x8>
+  80229e:	49 bb 99 6d 00 00 00 	movabs $0x6d99,%r11
+  8022a5:	00 00 00 
+  8022a8:	4c 01 d8             	add    %r11,%rax
+  8022ab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ae:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8022b1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022b4:	48 63 ca             	movslq %edx,%rcx
+  8022b7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022ba:	48 63 d2             	movslq %edx,%rdx
+  8022bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8022c1:	6a 00                	push   $0x0
+  8022c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8022d4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8022d9:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  8022e0:	ff ff ff 
+  8022e3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022e7:	ff d0                	call   *%rax
+  8022e9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ed:	c9                   	leave
+  8022ee:	c3                   	ret
+
+00000000008022ef <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8022ef:	55                   	push   %rbp
+  8022f0:	48 89 e5             	mov    %rsp,%rbp
+  8022f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8022f7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022f7 <sys_env_set_trapframe+0x8>
+  8022fe:	49 bb 39 6d 00 00 00 	movabs $0x6d39,%r11
+  802305:	00 00 00 
+  802308:	4c 01 d8             	add    %r11,%rax
+  80230b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80230e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802312:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802316:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802319:	48 63 d2             	movslq %edx,%rdx
+  80231c:	48 83 ec 08          	sub    $0x8,%rsp
+  802320:	6a 00                	push   $0x0
+  802322:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802328:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80232e:	be 01 00 00 00       	mov    $0x1,%esi
+  802333:	bf 09 00 00 00       	mov    $0x9,%edi
+  802338:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  80233f:	ff ff ff 
+  802342:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802346:	ff d0                	call   *%rax
+  802348:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80234c:	c9                   	leave
+  80234d:	c3                   	ret
+
+000000000080234e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80234e:	55                   	push   %rbp
+  80234f:	48 89 e5             	mov    %rsp,%rbp
+  802352:	48 83 ec 10          	sub    $0x10,%rsp
+  802356:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802356 <sys_env_set_pgfault_upcall+0x8>
+  80235d:	49 bb da 6c 00 00 00 	movabs $0x6cda,%r11
+  802364:	00 00 00 
+  802367:	4c 01 d8             	add    %r11,%rax
+  80236a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80236d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802371:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802375:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802378:	48 63 d2             	movslq %edx,%rdx
+  80237b:	48 83 ec 08          	sub    $0x8,%rsp
+  80237f:	6a 00                	push   $0x0
+  802381:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802387:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80238d:	be 01 00 00 00       	mov    $0x1,%esi
+  802392:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802397:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  80239e:	ff ff ff 
+  8023a1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023a5:	ff d0                	call   *%rax
+  8023a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ab:	c9                   	leave
+  8023ac:	c3                   	ret
+
+00000000008023ad <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8023ad:	55                   	push   %rbp
+  8023ae:	48 89 e5             	mov    %rsp,%rbp
+  8023b1:	48 83 ec 20          	sub    $0x20,%rsp
+  8023b5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023b5 <sys_ipc_try_send+0x8>
+  8023bc:	49 bb 7b 6c 00 00 00 	movabs $0x6c7b,%r11
+  8023c3:	00 00 00 
+  8023c6:	4c 01 d8             	add    %r11,%rax
+  8023c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023d0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023d4:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8023d7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023da:	48 63 fa             	movslq %edx,%rdi
+  8023dd:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8023e1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023e4:	48 63 d2             	movslq %edx,%rdx
+  8023e7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ef:	6a 00                	push   $0x0
+  8023f1:	49 89 f9             	mov    %rdi,%r9
+  8023f4:	49 89 f0             	mov    %rsi,%r8
+  8023f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023fc:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802401:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802408:	ff ff ff 
+  80240b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80240f:	ff d0                	call   *%rax
+  802411:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802415:	c9                   	leave
+  802416:	c3                   	ret
+
+0000000000802417 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802417:	55                   	push   %rbp
+  802418:	48 89 e5             	mov    %rsp,%rbp
+  80241b:	48 83 ec 20          	sub    $0x20,%rsp
+  80241f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80241f <sys_ipc_send+0x8>
+  802426:	49 bb 11 6c 00 00 00 	movabs $0x6c11,%r11
+  80242d:	00 00 00 
+  802430:	4c 01 d8             	add    %r11,%rax
+  802433:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802436:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80243a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80243e:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802441:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802444:	48 63 fa             	movslq %edx,%rdi
+  802447:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80244b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80244e:	48 63 d2             	movslq %edx,%rdx
+  802451:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802455:	48 83 ec 08          	sub    $0x8,%rsp
+  802459:	6a 00                	push   $0x0
+  80245b:	49 89 f9             	mov    %rdi,%r9
+  80245e:	49 89 f0             	mov    %rsi,%r8
+  802461:	be 00 00 00 00       	mov    $0x0,%esi
+  802466:	bf 17 00 00 00       	mov    $0x17,%edi
+  80246b:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802472:	ff ff ff 
+  802475:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802479:	ff d0                	call   *%rax
+  80247b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80247f:	c9                   	leave
+  802480:	c3                   	ret
+
+0000000000802481 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802481:	55                   	push   %rbp
+  802482:	48 89 e5             	mov    %rsp,%rbp
+  802485:	48 83 ec 10          	sub    $0x10,%rsp
+  802489:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802489 <sys_ipc_recv+0x8>
+  802490:	49 bb a7 6b 00 00 00 	movabs $0x6ba7,%r11
+  802497:	00 00 00 
+  80249a:	4c 01 d8             	add    %r11,%rax
+  80249d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8024a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024a5:	6a 00                	push   $0x0
+  8024a7:	6a 00                	push   $0x0
+  8024a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024ba:	be 01 00 00 00       	mov    $0x1,%esi
+  8024bf:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8024c4:	49 ba c1 8d ff ff ff 	movabs $0xffffffffffff8dc1,%r10
+  8024cb:	ff ff ff 
+  8024ce:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024d2:	ff d0                	call   *%rax
+  8024d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d8:	c9                   	leave
+  8024d9:	c3                   	ret
+
+00000000008024da <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8024da:	55                   	push   %rbp
+  8024db:	48 89 e5             	mov    %rsp,%rbp
+  8024de:	48 83 ec 30          	sub    $0x30,%rsp
+  8024e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024e2 <sys_ipc_call+0x8>
+  8024e9:	49 bb 4e 6b 00 00 00 	movabs $0x6b4e,%r11
+  8024f0:	00 00 00 
+  8024f3:	4c 01 d8             	add    %r11,%rax
+  8024f6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024fd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802501:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802504:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802508:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80250c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802510:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802513:	4c 63 c2             	movslq %edx,%r8
+  802516:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80251a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80251d:	48 63 d2             	movslq %edx,%rdx
+  802520:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802524:	ff 75 d8             	push   -0x28(%rbp)
+  802527:	56                   	push   %rsi
+  802528:	4d 89 c1             	mov    %r8,%r9
+  80252b:	49 89 f8             	mov    %rdi,%r8
+  80252e:	be 00 00 00 00       	mov    $0x0,%esi
+  802533:	bf 18 00 00 00       	mov    $0x18,%edi
+  802538:	49 ba c1 8d ff ff ff 	movabs $0xffffffffffff8dc1,%r10
+  80253f:	ff ff ff 
+  802542:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802546:	ff d0                	call   *%rax
+  802548:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80254c:	c9                   	leave
+  80254d:	c3                   	ret
+
+000000000080254e <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80254e:	55                   	push   %rbp
+  80254f:	48 89 e5             	mov    %rsp,%rbp
+  802552:	48 83 ec 30          	sub    $0x30,%rsp
+  802556:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802556 <sys_ipc_reply_recv+0x8>
+  80255d:	49 bb da 6a 00 00 00 	movabs $0x6ada,%r11
+  802564:	00 00 00 
+  802567:	4c 01 d8             	add    %r11,%rax
+  80256a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80256d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802571:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802575:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802578:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80257c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802580:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802584:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802587:	4c 63 c2             	movslq %edx,%r8
+  80258a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80258e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802591:	48 63 d2             	movslq %edx,%rdx
+  802594:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802598:	ff 75 d8             	push   -0x28(%rbp)
+  80259b:	56                   	push   %rsi
+  80259c:	4d 89 c1             	mov    %r8,%r9
+  80259f:	49 89 f8             	mov    %rdi,%r8
+  8025a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8025a7:	bf 19 00 00 00       	mov    $0x19,%edi
+  8025ac:	49 ba c1 8d ff ff ff 	movabs $0xffffffffffff8dc1,%r10
+  8025b3:	ff ff ff 
+  8025b6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025ba:	ff d0                	call   *%rax
+  8025bc:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8025c0:	c9                   	leave
+  8025c1:	c3                   	ret
+
+00000000008025c2 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8025c2:	55                   	push   %rbp
+  8025c3:	48 89 e5             	mov    %rsp,%rbp
+  8025c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025ca <sys_env_set_priority+0x8>
+  8025d1:	49 bb 66 6a 00 00 00 	movabs $0x6a66,%r11
+  8025d8:	00 00 00 
+  8025db:	4c 01 d8             	add    %r11,%rax
+  8025de:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025e1:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8025e4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025e7:	48 63 ca             	movslq %edx,%rcx
+  8025ea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025ed:	48 63 d2             	movslq %edx,%rdx
+  8025f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f4:	6a 00                	push   $0x0
+  8025f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802602:	be 01 00 00 00       	mov    $0x1,%esi
+  802607:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80260c:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802613:	ff ff ff 
+  802616:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80261a:	ff d0                	call   *%rax
+  80261c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802620:	c9                   	leave
+  802621:	c3                   	ret
+
+0000000000802622 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802622:	55                   	push   %rbp
+  802623:	48 89 e5             	mov    %rsp,%rbp
+  802626:	48 83 ec 10          	sub    $0x10,%rsp
+  80262a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80262a <sys_env_set_affinity+0x8>
+  802631:	49 bb 06 6a 00 00 00 	movabs $0x6a06,%r11
+  802638:	00 00 00 
+  80263b:	4c 01 d8             	add    %r11,%rax
+  80263e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802641:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802644:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802647:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80264a:	48 63 d2             	movslq %edx,%rdx
+  80264d:	48 83 ec 08          	sub    $0x8,%rsp
+  802651:	6a 00                	push   $0x0
+  802653:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802659:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80265f:	be 01 00 00 00       	mov    $0x1,%esi
+  802664:	bf 10 00 00 00       	mov    $0x10,%edi
+  802669:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802670:	ff ff ff 
+  802673:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802677:	ff d0                	call   *%rax
+  802679:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80267d:	c9                   	leave
+  80267e:	c3                   	ret
+
+000000000080267f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80267f:	55                   	push   %rbp
+  802680:	48 89 e5             	mov    %rsp,%rbp
+  802683:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802683 <sys_time_msec+0x4>
+  80268a:	49 bb ad 69 00 00 00 	movabs $0x69ad,%r11
+  802691:	00 00 00 
+  802694:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802697:	48 83 ec 08          	sub    $0x8,%rsp
+  80269b:	6a 00                	push   $0x0
+  80269d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b8:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8026bd:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  8026c4:	ff ff ff 
+  8026c7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026cb:	ff d0                	call   *%rax
+  8026cd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+
+00000000008026d3 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8026d3:	55                   	push   %rbp
+  8026d4:	48 89 e5             	mov    %rsp,%rbp
+  8026d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8026db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026db <sys_sleep_usec+0x8>
+  8026e2:	49 bb 55 69 00 00 00 	movabs $0x6955,%r11
+  8026e9:	00 00 00 
+  8026ec:	4c 01 d8             	add    %r11,%rax
+  8026ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8026f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8026fb:	6a 00                	push   $0x0
+  8026fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802703:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802709:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80270e:	be 00 00 00 00       	mov    $0x0,%esi
+  802713:	bf 11 00 00 00       	mov    $0x11,%edi
+  802718:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  80271f:	ff ff ff 
+  802722:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802726:	ff d0                	call   *%rax
+  802728:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80272c:	c9                   	leave
+  80272d:	c3                   	ret
+
+000000000080272e <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80272e:	55                   	push   %rbp
+  80272f:	48 89 e5             	mov    %rsp,%rbp
+  802732:	48 83 ec 10          	sub    $0x10,%rsp
+  802736:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802736 <sys_page_alloc_huge+0x8>
+  80273d:	49 bb fa 68 00 00 00 	movabs $0x68fa,%r11
+  802744:	00 00 00 
+  802747:	4c 01 d8             	add    %r11,%rax
+  80274a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80274d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802751:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802754:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802757:	48 63 f2             	movslq %edx,%rsi
+  80275a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80275e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802761:	48 63 d2             	movslq %edx,%rdx
+  802764:	48 83 ec 08          	sub    $0x8,%rsp
+  802768:	6a 00                	push   $0x0
+  80276a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802770:	49 89 f0             	mov    %rsi,%r8
+  802773:	be 01 00 00 00       	mov    $0x1,%esi
+  802778:	bf 12 00 00 00       	mov    $0x12,%edi
+  80277d:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802784:	ff ff ff 
+  802787:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80278b:	ff d0                	call   *%rax
+  80278d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802791:	c9                   	leave
+  802792:	c3                   	ret
+
+0000000000802793 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802793:	55                   	push   %rbp
+  802794:	48 89 e5             	mov    %rsp,%rbp
+  802797:	48 83 ec 10          	sub    $0x10,%rsp
+  80279b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80279b <sys_page_map_batch+0x8>
+  8027a2:	49 bb 95 68 00 00 00 	movabs $0x6895,%r11
+  8027a9:	00 00 00 
+  8027ac:	4c 01 d8             	add    %r11,%rax
+  8027af:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027b3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8027b7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027bb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c3:	6a 00                	push   $0x0
+  8027c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027d1:	be 01 00 00 00       	mov    $0x1,%esi
+  8027d6:	bf 13 00 00 00       	mov    $0x13,%edi
+  8027db:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  8027e2:	ff ff ff 
+  8027e5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027e9:	ff d0                	call   *%rax
+  8027eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027ef:	c9                   	leave
+  8027f0:	c3                   	ret
+
+00000000008027f1 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8027f1:	55                   	push   %rbp
+  8027f2:	48 89 e5             	mov    %rsp,%rbp
+  8027f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027f9 <sys_page_alloc_batch+0x8>
+  802800:	49 bb 37 68 00 00 00 	movabs $0x6837,%r11
+  802807:	00 00 00 
+  80280a:	4c 01 d8             	add    %r11,%rax
+  80280d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802811:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802815:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802819:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80281d:	48 83 ec 08          	sub    $0x8,%rsp
+  802821:	6a 00                	push   $0x0
+  802823:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802829:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80282f:	be 01 00 00 00       	mov    $0x1,%esi
+  802834:	bf 14 00 00 00       	mov    $0x14,%edi
+  802839:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  802840:	ff ff ff 
+  802843:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802847:	ff d0                	call   *%rax
+  802849:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80284d:	c9                   	leave
+  80284e:	c3                   	ret
+
+000000000080284f <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80284f:	55                   	push   %rbp
+  802850:	48 89 e5             	mov    %rsp,%rbp
+  802853:	48 83 ec 10          	sub    $0x10,%rsp
+  802857:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802857 <sys_page_unmap_batch+0x8>
+  80285e:	49 bb d9 67 00 00 00 	movabs $0x67d9,%r11
+  802865:	00 00 00 
+  802868:	4c 01 d8             	add    %r11,%rax
+  80286b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80286f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802873:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802877:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80287b:	48 83 ec 08          	sub    $0x8,%rsp
+  80287f:	6a 00                	push   $0x0
+  802881:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802887:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80288d:	be 01 00 00 00       	mov    $0x1,%esi
+  802892:	bf 15 00 00 00       	mov    $0x15,%edi
+  802897:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  80289e:	ff ff ff 
+  8028a1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028a5:	ff d0                	call   *%rax
+  8028a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028ab:	c9                   	leave
+  8028ac:	c3                   	ret
+
+00000000008028ad <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8028ad:	55                   	push   %rbp
+  8028ae:	48 89 e5             	mov    %rsp,%rbp
+  8028b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028b1 <sys_fork+0x4>
+  8028b8:	49 bb 7f 67 00 00 00 	movabs $0x677f,%r11
+  8028bf:	00 00 00 
+  8028c2:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8028c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c9:	6a 00                	push   $0x0
+  8028cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e6:	bf 16 00 00 00       	mov    $0x16,%edi
+  8028eb:	49 ba 07 8d ff ff ff 	movabs $0xffffffffffff8d07,%r10
+  8028f2:	ff ff ff 
+  8028f5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028f9:	ff d0                	call   *%rax
+  8028fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028ff:	c9                   	leave
+  802900:	c3                   	ret
+
+0000000000802901 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802901:	55                   	push   %rbp
+  802902:	48 89 e5             	mov    %rsp,%rbp
+  802905:	48 83 ec 08          	sub    $0x8,%rsp
+  802909:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802909 <fd2num+0x8>
+  802910:	49 bb 27 67 00 00 00 	movabs $0x6727,%r11
+  802917:	00 00 00 
+  80291a:	4c 01 d8             	add    %r11,%rax
+  80291d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802921:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802925:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80292c:	ff ff ff 
+  80292f:	48 01 d0             	add    %rdx,%rax
+  802932:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802936:	c9                   	leave
+  802937:	c3                   	ret
+
+0000000000802938 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802938:	55                   	push   %rbp
+  802939:	48 89 e5             	mov    %rsp,%rbp
+  80293c:	48 83 ec 08          	sub    $0x8,%rsp
+  802940:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802940 <fd2data+0x8>
+  802947:	49 bb f0 66 00 00 00 	movabs $0x66f0,%r11
+  80294e:	00 00 00 
+  802951:	4c 01 d8             	add    %r11,%rax
+  802954:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802958:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80295c:	48 89 d7             	mov    %rdx,%rdi
+  80295f:	48 ba d1 98 ff ff ff 	movabs $0xffffffffffff98d1,%rdx
+  802966:	ff ff ff 
+  802969:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80296d:	ff d0                	call   *%rax
+  80296f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802975:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802979:	c9                   	leave
+  80297a:	c3                   	ret
+
+000000000080297b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80297b:	55                   	push   %rbp
+  80297c:	48 89 e5             	mov    %rsp,%rbp
+  80297f:	48 83 ec 18          	sub    $0x18,%rsp
+  802983:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802983 <fd_alloc+0x8>
+  80298a:	49 bb ad 66 00 00 00 	movabs $0x66ad,%r11
+  802991:	00 00 00 
+  802994:	4c 01 d8             	add    %r11,%rax
+  802997:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80299b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029a2:	eb 75                	jmp    802a19 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8029a4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029a7:	48 63 d2             	movslq %edx,%rdx
+  8029aa:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8029b1:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8029b5:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8029b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029bd:	48 89 d1             	mov    %rdx,%rcx
+  8029c0:	48 c1 e9 15          	shr    $0x15,%rcx
+  8029c4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8029cb:	ff ff ff 
+  8029ce:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8029d2:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8029d6:	83 e2 01             	and    $0x1,%edx
+  8029d9:	48 85 d2             	test   %rdx,%rdx
+  8029dc:	74 25                	je     802a03 <fd_alloc+0x88>
+  8029de:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029e2:	48 89 d1             	mov    %rdx,%rcx
+  8029e5:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8029e9:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8029f0:	ff ff ff 
+  8029f3:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8029f7:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8029fb:	83 e2 01             	and    $0x1,%edx
+  8029fe:	48 85 d2             	test   %rdx,%rdx
+  802a01:	75 12                	jne    802a15 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802a03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a07:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a0b:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a13:	eb 1a                	jmp    802a2f <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802a15:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a19:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a1d:	7e 85                	jle    8029a4 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802a1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a23:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802a2a:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802a2f:	c9                   	leave
+  802a30:	c3                   	ret
+
+0000000000802a31 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802a31:	55                   	push   %rbp
+  802a32:	48 89 e5             	mov    %rsp,%rbp
+  802a35:	48 83 ec 20          	sub    $0x20,%rsp
+  802a39:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a39 <fd_lookup+0x8>
+  802a40:	49 bb f7 65 00 00 00 	movabs $0x65f7,%r11
+  802a47:	00 00 00 
+  802a4a:	4c 01 d8             	add    %r11,%rax
+  802a4d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802a50:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802a54:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a58:	78 06                	js     802a60 <fd_lookup+0x2f>
+  802a5a:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802a5e:	7e 07                	jle    802a67 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802a60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a65:	eb 73                	jmp    802ada <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802a67:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802a6a:	48 63 d2             	movslq %edx,%rdx
+  802a6d:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802a74:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802a78:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802a7c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a80:	48 89 d1             	mov    %rdx,%rcx
+  802a83:	48 c1 e9 15          	shr    $0x15,%rcx
+  802a87:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802a8e:	ff ff ff 
+  802a91:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a95:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a99:	83 e2 01             	and    $0x1,%edx
+  802a9c:	48 85 d2             	test   %rdx,%rdx
+  802a9f:	74 22                	je     802ac3 <fd_lookup+0x92>
+  802aa1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802aa5:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802aa9:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802ab0:	ff ff ff 
+  802ab3:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802ab7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802abb:	83 e0 01             	and    $0x1,%eax
+  802abe:	48 85 c0             	test   %rax,%rax
+  802ac1:	75 07                	jne    802aca <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802ac3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac8:	eb 10                	jmp    802ada <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802aca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ace:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ad2:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ada:	c9                   	leave
+  802adb:	c3                   	ret
+
+0000000000802adc <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802adc:	55                   	push   %rbp
+  802add:	48 89 e5             	mov    %rsp,%rbp
+  802ae0:	41 57                	push   %r15
+  802ae2:	53                   	push   %rbx
+  802ae3:	48 83 ec 30          	sub    $0x30,%rsp
+  802ae7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ae7 <fd_close+0xb>
+  802aee:	49 bb 49 65 00 00 00 	movabs $0x6549,%r11
+  802af5:	00 00 00 
+  802af8:	4c 01 db             	add    %r11,%rbx
+  802afb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802aff:	89 f0                	mov    %esi,%eax
+  802b01:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802b04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b08:	48 89 c7             	mov    %rax,%rdi
+  802b0b:	48 b8 d1 98 ff ff ff 	movabs $0xffffffffffff98d1,%rax
+  802b12:	ff ff ff 
+  802b15:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b19:	ff d0                	call   *%rax
+  802b1b:	89 c2                	mov    %eax,%edx
+  802b1d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802b21:	48 89 c6             	mov    %rax,%rsi
+  802b24:	89 d7                	mov    %edx,%edi
+  802b26:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  802b2d:	ff ff ff 
+  802b30:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b34:	ff d0                	call   *%rax
+  802b36:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b39:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b3d:	78 0a                	js     802b49 <fd_close+0x6d>
+	    || fd != fd2)
+  802b3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b43:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802b47:	74 12                	je     802b5b <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802b49:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802b4d:	74 05                	je     802b54 <fd_close+0x78>
+  802b4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b52:	eb 7a                	jmp    802bce <fd_close+0xf2>
+  802b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b59:	eb 73                	jmp    802bce <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802b5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b5f:	8b 00                	mov    (%rax),%eax
+  802b61:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802b65:	48 89 d6             	mov    %rdx,%rsi
+  802b68:	89 c7                	mov    %eax,%edi
+  802b6a:	48 b8 a7 9b ff ff ff 	movabs $0xffffffffffff9ba7,%rax
+  802b71:	ff ff ff 
+  802b74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b78:	ff d0                	call   *%rax
+  802b7a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b7d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b81:	78 2a                	js     802bad <fd_close+0xd1>
+		if (dev->dev_close)
+  802b83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b87:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802b8b:	48 85 c0             	test   %rax,%rax
+  802b8e:	74 16                	je     802ba6 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802b90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b94:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802b98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b9c:	48 89 c7             	mov    %rax,%rdi
+  802b9f:	ff d2                	call   *%rdx
+  802ba1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ba4:	eb 07                	jmp    802bad <fd_close+0xd1>
+		else
+			r = 0;
+  802ba6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802bad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bb1:	48 89 c6             	mov    %rax,%rsi
+  802bb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bb9:	49 89 df             	mov    %rbx,%r15
+  802bbc:	48 b8 00 92 ff ff ff 	movabs $0xffffffffffff9200,%rax
+  802bc3:	ff ff ff 
+  802bc6:	48 01 d8             	add    %rbx,%rax
+  802bc9:	ff d0                	call   *%rax
+	return r;
+  802bcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802bce:	48 83 c4 30          	add    $0x30,%rsp
+  802bd2:	5b                   	pop    %rbx
+  802bd3:	41 5f                	pop    %r15
+  802bd5:	5d                   	pop    %rbp
+  802bd6:	c3                   	ret
+
+0000000000802bd7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802bd7:	55                   	push   %rbp
+  802bd8:	48 89 e5             	mov    %rsp,%rbp
+  802bdb:	41 57                	push   %r15
+  802bdd:	48 83 ec 28          	sub    $0x28,%rsp
+  802be1:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802be1 <dev_lookup+0xa>
+  802be8:	49 bb 4f 64 00 00 00 	movabs $0x644f,%r11
+  802bef:	00 00 00 
+  802bf2:	4c 01 d9             	add    %r11,%rcx
+  802bf5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802bf8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802bfc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802c03:	eb 45                	jmp    802c4a <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802c05:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802c0c:	00 00 00 
+  802c0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c12:	48 98                	cltq
+  802c14:	48 01 ca             	add    %rcx,%rdx
+  802c17:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c1b:	8b 00                	mov    (%rax),%eax
+  802c1d:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802c20:	75 24                	jne    802c46 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802c22:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802c29:	00 00 00 
+  802c2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c2f:	48 98                	cltq
+  802c31:	48 01 ca             	add    %rcx,%rdx
+  802c34:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c3c:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c44:	eb 74                	jmp    802cba <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802c46:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802c4a:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802c51:	00 00 00 
+  802c54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c57:	48 98                	cltq
+  802c59:	48 01 ca             	add    %rcx,%rdx
+  802c5c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c60:	48 85 c0             	test   %rax,%rax
+  802c63:	75 a0                	jne    802c05 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802c65:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802c6c:	ff ff ff 
+  802c6f:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802c73:	48 8b 00             	mov    (%rax),%rax
+  802c76:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802c7c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802c7f:	89 c6                	mov    %eax,%esi
+  802c81:	48 b8 48 dc ff ff ff 	movabs $0xffffffffffffdc48,%rax
+  802c88:	ff ff ff 
+  802c8b:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802c8f:	48 89 c7             	mov    %rax,%rdi
+  802c92:	49 89 cf             	mov    %rcx,%r15
+  802c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c9a:	49 b8 aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%r8
+  802ca1:	ff ff ff 
+  802ca4:	49 01 c8             	add    %rcx,%r8
+  802ca7:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802caa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cae:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802cb5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802cba:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802cbe:	c9                   	leave
+  802cbf:	c3                   	ret
+
+0000000000802cc0 <close>:
+
+int
+close(int fdnum)
+{
+  802cc0:	55                   	push   %rbp
+  802cc1:	48 89 e5             	mov    %rsp,%rbp
+  802cc4:	53                   	push   %rbx
+  802cc5:	48 83 ec 28          	sub    $0x28,%rsp
+  802cc9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802cc9 <close+0x9>
+  802cd0:	49 bb 67 63 00 00 00 	movabs $0x6367,%r11
+  802cd7:	00 00 00 
+  802cda:	4c 01 db             	add    %r11,%rbx
+  802cdd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ce0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802ce4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ce7:	48 89 d6             	mov    %rdx,%rsi
+  802cea:	89 c7                	mov    %eax,%edi
+  802cec:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  802cf3:	ff ff ff 
+  802cf6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cfa:	ff d0                	call   *%rax
+  802cfc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802cff:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d03:	79 05                	jns    802d0a <close+0x4a>
+		return r;
+  802d05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d08:	eb 1c                	jmp    802d26 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802d0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d0e:	be 01 00 00 00       	mov    $0x1,%esi
+  802d13:	48 89 c7             	mov    %rax,%rdi
+  802d16:	48 b8 ac 9a ff ff ff 	movabs $0xffffffffffff9aac,%rax
+  802d1d:	ff ff ff 
+  802d20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d24:	ff d0                	call   *%rax
+}
+  802d26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d2a:	c9                   	leave
+  802d2b:	c3                   	ret
+
+0000000000802d2c <close_all>:
+
+void
+close_all(void)
+{
+  802d2c:	55                   	push   %rbp
+  802d2d:	48 89 e5             	mov    %rsp,%rbp
+  802d30:	53                   	push   %rbx
+  802d31:	48 83 ec 18          	sub    $0x18,%rsp
+  802d35:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d35 <close_all+0x9>
+  802d3c:	49 bb fb 62 00 00 00 	movabs $0x62fb,%r11
+  802d43:	00 00 00 
+  802d46:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802d49:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802d50:	eb 19                	jmp    802d6b <close_all+0x3f>
+		close(i);
+  802d52:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d55:	89 c7                	mov    %eax,%edi
+  802d57:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  802d5e:	ff ff ff 
+  802d61:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d65:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802d67:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802d6b:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802d6f:	7e e1                	jle    802d52 <close_all+0x26>
+}
+  802d71:	90                   	nop
+  802d72:	90                   	nop
+  802d73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d77:	c9                   	leave
+  802d78:	c3                   	ret
+
+0000000000802d79 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802d79:	55                   	push   %rbp
+  802d7a:	48 89 e5             	mov    %rsp,%rbp
+  802d7d:	41 57                	push   %r15
+  802d7f:	53                   	push   %rbx
+  802d80:	48 83 ec 40          	sub    $0x40,%rsp
+  802d84:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d84 <dup+0xb>
+  802d8b:	49 bb ac 62 00 00 00 	movabs $0x62ac,%r11
+  802d92:	00 00 00 
+  802d95:	4c 01 db             	add    %r11,%rbx
+  802d98:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802d9b:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802d9e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802da2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802da5:	48 89 d6             	mov    %rdx,%rsi
+  802da8:	89 c7                	mov    %eax,%edi
+  802daa:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  802db1:	ff ff ff 
+  802db4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802db8:	ff d0                	call   *%rax
+  802dba:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802dbd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802dc1:	79 08                	jns    802dcb <dup+0x52>
+		return r;
+  802dc3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dc6:	e9 a4 01 00 00       	jmp    802f6f <dup+0x1f6>
+	close(newfdnum);
+  802dcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802dce:	89 c7                	mov    %eax,%edi
+  802dd0:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  802dd7:	ff ff ff 
+  802dda:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dde:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802de0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802de3:	48 98                	cltq
+  802de5:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802deb:	48 c1 e0 0c          	shl    $0xc,%rax
+  802def:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802df3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df7:	48 89 c7             	mov    %rax,%rdi
+  802dfa:	48 b8 08 99 ff ff ff 	movabs $0xffffffffffff9908,%rax
+  802e01:	ff ff ff 
+  802e04:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e08:	ff d0                	call   *%rax
+  802e0a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802e0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e12:	48 89 c7             	mov    %rax,%rdi
+  802e15:	48 b8 08 99 ff ff ff 	movabs $0xffffffffffff9908,%rax
+  802e1c:	ff ff ff 
+  802e1f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e23:	ff d0                	call   *%rax
+  802e25:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802e29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e2d:	48 c1 e8 15          	shr    $0x15,%rax
+  802e31:	48 89 c2             	mov    %rax,%rdx
+  802e34:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802e3b:	ff ff ff 
+  802e3e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e42:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e46:	83 e0 01             	and    $0x1,%eax
+  802e49:	48 85 c0             	test   %rax,%rax
+  802e4c:	74 7f                	je     802ecd <dup+0x154>
+  802e4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e52:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e56:	48 89 c2             	mov    %rax,%rdx
+  802e59:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e60:	ff ff ff 
+  802e63:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e67:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e6b:	83 e0 01             	and    $0x1,%eax
+  802e6e:	48 85 c0             	test   %rax,%rax
+  802e71:	74 5a                	je     802ecd <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802e73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e77:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e7b:	48 89 c2             	mov    %rax,%rdx
+  802e7e:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e85:	ff ff ff 
+  802e88:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e8c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e90:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e95:	89 c1                	mov    %eax,%ecx
+  802e97:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802e9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e9f:	41 89 c8             	mov    %ecx,%r8d
+  802ea2:	48 89 d1             	mov    %rdx,%rcx
+  802ea5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eaa:	48 89 c6             	mov    %rax,%rsi
+  802ead:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb2:	49 89 df             	mov    %rbx,%r15
+  802eb5:	48 b8 8d 91 ff ff ff 	movabs $0xffffffffffff918d,%rax
+  802ebc:	ff ff ff 
+  802ebf:	48 01 d8             	add    %rbx,%rax
+  802ec2:	ff d0                	call   *%rax
+  802ec4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ec7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ecb:	78 5f                	js     802f2c <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802ecd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ed1:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ed5:	48 89 c2             	mov    %rax,%rdx
+  802ed8:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802edf:	ff ff ff 
+  802ee2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ee6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eea:	25 07 0e 00 00       	and    $0xe07,%eax
+  802eef:	89 c1                	mov    %eax,%ecx
+  802ef1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ef5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ef9:	41 89 c8             	mov    %ecx,%r8d
+  802efc:	48 89 d1             	mov    %rdx,%rcx
+  802eff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f04:	48 89 c6             	mov    %rax,%rsi
+  802f07:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f0c:	49 89 df             	mov    %rbx,%r15
+  802f0f:	48 b8 8d 91 ff ff ff 	movabs $0xffffffffffff918d,%rax
+  802f16:	ff ff ff 
+  802f19:	48 01 d8             	add    %rbx,%rax
+  802f1c:	ff d0                	call   *%rax
+  802f1e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f21:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f25:	78 08                	js     802f2f <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802f27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f2a:	eb 43                	jmp    802f6f <dup+0x1f6>
+			goto err;
+  802f2c:	90                   	nop
+  802f2d:	eb 01                	jmp    802f30 <dup+0x1b7>
+		goto err;
+  802f2f:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802f30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f34:	48 89 c6             	mov    %rax,%rsi
+  802f37:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f3c:	49 89 df             	mov    %rbx,%r15
+  802f3f:	48 b8 00 92 ff ff ff 	movabs $0xffffffffffff9200,%rax
+  802f46:	ff ff ff 
+  802f49:	48 01 d8             	add    %rbx,%rax
+  802f4c:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802f4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f52:	48 89 c6             	mov    %rax,%rsi
+  802f55:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5a:	49 89 df             	mov    %rbx,%r15
+  802f5d:	48 b8 00 92 ff ff ff 	movabs $0xffffffffffff9200,%rax
+  802f64:	ff ff ff 
+  802f67:	48 01 d8             	add    %rbx,%rax
+  802f6a:	ff d0                	call   *%rax
+	return r;
+  802f6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f6f:	48 83 c4 40          	add    $0x40,%rsp
+  802f73:	5b                   	pop    %rbx
+  802f74:	41 5f                	pop    %r15
+  802f76:	5d                   	pop    %rbp
+  802f77:	c3                   	ret
+
+0000000000802f78 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802f78:	55                   	push   %rbp
+  802f79:	48 89 e5             	mov    %rsp,%rbp
+  802f7c:	41 57                	push   %r15
+  802f7e:	53                   	push   %rbx
+  802f7f:	48 83 ec 40          	sub    $0x40,%rsp
+  802f83:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f83 <read+0xb>
+  802f8a:	49 bb ad 60 00 00 00 	movabs $0x60ad,%r11
+  802f91:	00 00 00 
+  802f94:	4c 01 db             	add    %r11,%rbx
+  802f97:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802f9a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802f9e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802fa2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802fa6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802fa9:	48 89 d6             	mov    %rdx,%rsi
+  802fac:	89 c7                	mov    %eax,%edi
+  802fae:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  802fb5:	ff ff ff 
+  802fb8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fbc:	ff d0                	call   *%rax
+  802fbe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fc1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fc5:	78 28                	js     802fef <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fcb:	8b 00                	mov    (%rax),%eax
+  802fcd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802fd1:	48 89 d6             	mov    %rdx,%rsi
+  802fd4:	89 c7                	mov    %eax,%edi
+  802fd6:	48 b8 a7 9b ff ff ff 	movabs $0xffffffffffff9ba7,%rax
+  802fdd:	ff ff ff 
+  802fe0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fe4:	ff d0                	call   *%rax
+  802fe6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fe9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fed:	79 08                	jns    802ff7 <read+0x7f>
+		return r;
+  802fef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ff2:	e9 8b 00 00 00       	jmp    803082 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802ff7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ffb:	8b 40 08             	mov    0x8(%rax),%eax
+  802ffe:	83 e0 03             	and    $0x3,%eax
+  803001:	83 f8 01             	cmp    $0x1,%eax
+  803004:	75 4b                	jne    803051 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803006:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80300d:	ff ff ff 
+  803010:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803014:	48 8b 00             	mov    (%rax),%rax
+  803017:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80301d:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803020:	89 c6                	mov    %eax,%esi
+  803022:	48 b8 67 dc ff ff ff 	movabs $0xffffffffffffdc67,%rax
+  803029:	ff ff ff 
+  80302c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803030:	48 89 c7             	mov    %rax,%rdi
+  803033:	49 89 df             	mov    %rbx,%r15
+  803036:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303b:	48 b9 aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rcx
+  803042:	ff ff ff 
+  803045:	48 01 d9             	add    %rbx,%rcx
+  803048:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80304a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80304f:	eb 31                	jmp    803082 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803051:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803055:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803059:	48 85 c0             	test   %rax,%rax
+  80305c:	75 07                	jne    803065 <read+0xed>
+		return -E_NOT_SUPP;
+  80305e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803063:	eb 1d                	jmp    803082 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803065:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803069:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80306d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803071:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803075:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803079:	48 89 ce             	mov    %rcx,%rsi
+  80307c:	48 89 c7             	mov    %rax,%rdi
+  80307f:	41 ff d0             	call   *%r8
+}
+  803082:	48 83 c4 40          	add    $0x40,%rsp
+  803086:	5b                   	pop    %rbx
+  803087:	41 5f                	pop    %r15
+  803089:	5d                   	pop    %rbp
+  80308a:	c3                   	ret
+
+000000000080308b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80308b:	55                   	push   %rbp
+  80308c:	48 89 e5             	mov    %rsp,%rbp
+  80308f:	53                   	push   %rbx
+  803090:	48 83 ec 38          	sub    $0x38,%rsp
+  803094:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803094 <readn+0x9>
+  80309b:	49 bb 9c 5f 00 00 00 	movabs $0x5f9c,%r11
+  8030a2:	00 00 00 
+  8030a5:	4c 01 db             	add    %r11,%rbx
+  8030a8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030ab:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8030af:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8030b3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8030ba:	eb 4b                	jmp    803107 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8030bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030bf:	48 98                	cltq
+  8030c1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8030c5:	48 29 c2             	sub    %rax,%rdx
+  8030c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030cb:	48 63 c8             	movslq %eax,%rcx
+  8030ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030d2:	48 01 c1             	add    %rax,%rcx
+  8030d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030d8:	48 89 ce             	mov    %rcx,%rsi
+  8030db:	89 c7                	mov    %eax,%edi
+  8030dd:	48 b8 48 9f ff ff ff 	movabs $0xffffffffffff9f48,%rax
+  8030e4:	ff ff ff 
+  8030e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030eb:	ff d0                	call   *%rax
+  8030ed:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  8030f0:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8030f4:	79 05                	jns    8030fb <readn+0x70>
+			return m;
+  8030f6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8030f9:	eb 1d                	jmp    803118 <readn+0x8d>
+		if (m == 0)
+  8030fb:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8030ff:	74 13                	je     803114 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803101:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803104:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803107:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80310a:	48 98                	cltq
+  80310c:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803110:	72 aa                	jb     8030bc <readn+0x31>
+  803112:	eb 01                	jmp    803115 <readn+0x8a>
+			break;
+  803114:	90                   	nop
+	}
+	return tot;
+  803115:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803118:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80311c:	c9                   	leave
+  80311d:	c3                   	ret
+
+000000000080311e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80311e:	55                   	push   %rbp
+  80311f:	48 89 e5             	mov    %rsp,%rbp
+  803122:	41 57                	push   %r15
+  803124:	53                   	push   %rbx
+  803125:	48 83 ec 40          	sub    $0x40,%rsp
+  803129:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803129 <write+0xb>
+  803130:	49 bb 07 5f 00 00 00 	movabs $0x5f07,%r11
+  803137:	00 00 00 
+  80313a:	4c 01 db             	add    %r11,%rbx
+  80313d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803140:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803144:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803148:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80314c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80314f:	48 89 d6             	mov    %rdx,%rsi
+  803152:	89 c7                	mov    %eax,%edi
+  803154:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  80315b:	ff ff ff 
+  80315e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803162:	ff d0                	call   *%rax
+  803164:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803167:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80316b:	78 28                	js     803195 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80316d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803171:	8b 00                	mov    (%rax),%eax
+  803173:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803177:	48 89 d6             	mov    %rdx,%rsi
+  80317a:	89 c7                	mov    %eax,%edi
+  80317c:	48 b8 a7 9b ff ff ff 	movabs $0xffffffffffff9ba7,%rax
+  803183:	ff ff ff 
+  803186:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80318a:	ff d0                	call   *%rax
+  80318c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80318f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803193:	79 08                	jns    80319d <write+0x7f>
+		return r;
+  803195:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803198:	e9 8a 00 00 00       	jmp    803227 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80319d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031a1:	8b 40 08             	mov    0x8(%rax),%eax
+  8031a4:	83 e0 03             	and    $0x3,%eax
+  8031a7:	85 c0                	test   %eax,%eax
+  8031a9:	75 4b                	jne    8031f6 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031ab:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8031b2:	ff ff ff 
+  8031b5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031b9:	48 8b 00             	mov    (%rax),%rax
+  8031bc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8031c2:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8031c5:	89 c6                	mov    %eax,%esi
+  8031c7:	48 b8 83 dc ff ff ff 	movabs $0xffffffffffffdc83,%rax
+  8031ce:	ff ff ff 
+  8031d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031d5:	48 89 c7             	mov    %rax,%rdi
+  8031d8:	49 89 df             	mov    %rbx,%r15
+  8031db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e0:	48 b9 aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rcx
+  8031e7:	ff ff ff 
+  8031ea:	48 01 d9             	add    %rbx,%rcx
+  8031ed:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8031ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031f4:	eb 31                	jmp    803227 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8031f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031fa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8031fe:	48 85 c0             	test   %rax,%rax
+  803201:	75 07                	jne    80320a <write+0xec>
+		return -E_NOT_SUPP;
+  803203:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803208:	eb 1d                	jmp    803227 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  80320a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80320e:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803212:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803216:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80321a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80321e:	48 89 ce             	mov    %rcx,%rsi
+  803221:	48 89 c7             	mov    %rax,%rdi
+  803224:	41 ff d0             	call   *%r8
+}
+  803227:	48 83 c4 40          	add    $0x40,%rsp
+  80322b:	5b                   	pop    %rbx
+  80322c:	41 5f                	pop    %r15
+  80322e:	5d                   	pop    %rbp
+  80322f:	c3                   	ret
+
+0000000000803230 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803230:	55                   	push   %rbp
+  803231:	48 89 e5             	mov    %rsp,%rbp
+  803234:	48 83 ec 18          	sub    $0x18,%rsp
+  803238:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803238 <seek+0x8>
+  80323f:	49 bb f8 5d 00 00 00 	movabs $0x5df8,%r11
+  803246:	00 00 00 
+  803249:	4c 01 d8             	add    %r11,%rax
+  80324c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80324f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803252:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803256:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803259:	48 89 ce             	mov    %rcx,%rsi
+  80325c:	89 d7                	mov    %edx,%edi
+  80325e:	48 ba 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rdx
+  803265:	ff ff ff 
+  803268:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80326c:	ff d0                	call   *%rax
+  80326e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803271:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803275:	79 05                	jns    80327c <seek+0x4c>
+		return r;
+  803277:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80327a:	eb 0f                	jmp    80328b <seek+0x5b>
+	fd->fd_offset = offset;
+  80327c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803280:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803283:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803286:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80328b:	c9                   	leave
+  80328c:	c3                   	ret
+
+000000000080328d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80328d:	55                   	push   %rbp
+  80328e:	48 89 e5             	mov    %rsp,%rbp
+  803291:	41 57                	push   %r15
+  803293:	53                   	push   %rbx
+  803294:	48 83 ec 30          	sub    $0x30,%rsp
+  803298:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803298 <ftruncate+0xb>
+  80329f:	49 bb 98 5d 00 00 00 	movabs $0x5d98,%r11
+  8032a6:	00 00 00 
+  8032a9:	4c 01 db             	add    %r11,%rbx
+  8032ac:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8032af:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8032b2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8032b6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8032b9:	48 89 d6             	mov    %rdx,%rsi
+  8032bc:	89 c7                	mov    %eax,%edi
+  8032be:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  8032c5:	ff ff ff 
+  8032c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032cc:	ff d0                	call   *%rax
+  8032ce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032d1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032d5:	78 28                	js     8032ff <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8032d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032db:	8b 00                	mov    (%rax),%eax
+  8032dd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8032e1:	48 89 d6             	mov    %rdx,%rsi
+  8032e4:	89 c7                	mov    %eax,%edi
+  8032e6:	48 b8 a7 9b ff ff ff 	movabs $0xffffffffffff9ba7,%rax
+  8032ed:	ff ff ff 
+  8032f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032f4:	ff d0                	call   *%rax
+  8032f6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032f9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032fd:	79 08                	jns    803307 <ftruncate+0x7a>
+		return r;
+  8032ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803302:	e9 83 00 00 00       	jmp    80338a <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803307:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80330b:	8b 40 08             	mov    0x8(%rax),%eax
+  80330e:	83 e0 03             	and    $0x3,%eax
+  803311:	85 c0                	test   %eax,%eax
+  803313:	75 4b                	jne    803360 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803315:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80331c:	ff ff ff 
+  80331f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803323:	48 8b 00             	mov    (%rax),%rax
+  803326:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80332c:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80332f:	89 c6                	mov    %eax,%esi
+  803331:	48 b8 a0 dc ff ff ff 	movabs $0xffffffffffffdca0,%rax
+  803338:	ff ff ff 
+  80333b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80333f:	48 89 c7             	mov    %rax,%rdi
+  803342:	49 89 df             	mov    %rbx,%r15
+  803345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334a:	48 b9 aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rcx
+  803351:	ff ff ff 
+  803354:	48 01 d9             	add    %rbx,%rcx
+  803357:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803359:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80335e:	eb 2a                	jmp    80338a <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803360:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803364:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803368:	48 85 c0             	test   %rax,%rax
+  80336b:	75 07                	jne    803374 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  80336d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803372:	eb 16                	jmp    80338a <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803374:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803378:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80337c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803380:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803383:	89 d6                	mov    %edx,%esi
+  803385:	48 89 c7             	mov    %rax,%rdi
+  803388:	ff d1                	call   *%rcx
+}
+  80338a:	48 83 c4 30          	add    $0x30,%rsp
+  80338e:	5b                   	pop    %rbx
+  80338f:	41 5f                	pop    %r15
+  803391:	5d                   	pop    %rbp
+  803392:	c3                   	ret
+
+0000000000803393 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803393:	55                   	push   %rbp
+  803394:	48 89 e5             	mov    %rsp,%rbp
+  803397:	53                   	push   %rbx
+  803398:	48 83 ec 38          	sub    $0x38,%rsp
+  80339c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80339c <fstat+0x9>
+  8033a3:	49 bb 94 5c 00 00 00 	movabs $0x5c94,%r11
+  8033aa:	00 00 00 
+  8033ad:	4c 01 db             	add    %r11,%rbx
+  8033b0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8033b3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8033b7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8033bb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8033be:	48 89 d6             	mov    %rdx,%rsi
+  8033c1:	89 c7                	mov    %eax,%edi
+  8033c3:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  8033ca:	ff ff ff 
+  8033cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033d1:	ff d0                	call   *%rax
+  8033d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8033d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033da:	78 28                	js     803404 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8033dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033e0:	8b 00                	mov    (%rax),%eax
+  8033e2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8033e6:	48 89 d6             	mov    %rdx,%rsi
+  8033e9:	89 c7                	mov    %eax,%edi
+  8033eb:	48 b8 a7 9b ff ff ff 	movabs $0xffffffffffff9ba7,%rax
+  8033f2:	ff ff ff 
+  8033f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033f9:	ff d0                	call   *%rax
+  8033fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8033fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803402:	79 05                	jns    803409 <fstat+0x76>
+		return r;
+  803404:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803407:	eb 5e                	jmp    803467 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803409:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80340d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803411:	48 85 c0             	test   %rax,%rax
+  803414:	75 07                	jne    80341d <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803416:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80341b:	eb 4a                	jmp    803467 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80341d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803421:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803424:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803428:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80342f:	00 00 00 
+	stat->st_isdir = 0;
+  803432:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803436:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80343d:	00 00 00 
+	stat->st_dev = dev;
+  803440:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803444:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803448:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80344f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803453:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803457:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80345b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80345f:	48 89 d6             	mov    %rdx,%rsi
+  803462:	48 89 c7             	mov    %rax,%rdi
+  803465:	ff d1                	call   *%rcx
+}
+  803467:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80346b:	c9                   	leave
+  80346c:	c3                   	ret
+
+000000000080346d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80346d:	55                   	push   %rbp
+  80346e:	48 89 e5             	mov    %rsp,%rbp
+  803471:	41 57                	push   %r15
+  803473:	53                   	push   %rbx
+  803474:	48 83 ec 20          	sub    $0x20,%rsp
+  803478:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803478 <stat+0xb>
+  80347f:	49 bb b8 5b 00 00 00 	movabs $0x5bb8,%r11
+  803486:	00 00 00 
+  803489:	4c 01 db             	add    %r11,%rbx
+  80348c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803490:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803494:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803498:	be 00 00 00 00       	mov    $0x0,%esi
+  80349d:	48 89 c7             	mov    %rax,%rdi
+  8034a0:	49 89 df             	mov    %rbx,%r15
+  8034a3:	48 b8 17 a7 ff ff ff 	movabs $0xffffffffffffa717,%rax
+  8034aa:	ff ff ff 
+  8034ad:	48 01 d8             	add    %rbx,%rax
+  8034b0:	ff d0                	call   *%rax
+  8034b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034b9:	79 05                	jns    8034c0 <stat+0x53>
+		return fd;
+  8034bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034be:	eb 37                	jmp    8034f7 <stat+0x8a>
+	r = fstat(fd, stat);
+  8034c0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034c7:	48 89 d6             	mov    %rdx,%rsi
+  8034ca:	89 c7                	mov    %eax,%edi
+  8034cc:	48 b8 63 a3 ff ff ff 	movabs $0xffffffffffffa363,%rax
+  8034d3:	ff ff ff 
+  8034d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034da:	ff d0                	call   *%rax
+  8034dc:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8034df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034e2:	89 c7                	mov    %eax,%edi
+  8034e4:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  8034eb:	ff ff ff 
+  8034ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034f2:	ff d0                	call   *%rax
+	return r;
+  8034f4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8034f7:	48 83 c4 20          	add    $0x20,%rsp
+  8034fb:	5b                   	pop    %rbx
+  8034fc:	41 5f                	pop    %r15
+  8034fe:	5d                   	pop    %rbp
+  8034ff:	c3                   	ret
+
+0000000000803500 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803500:	55                   	push   %rbp
+  803501:	48 89 e5             	mov    %rsp,%rbp
+  803504:	41 57                	push   %r15
+  803506:	53                   	push   %rbx
+  803507:	48 83 ec 10          	sub    $0x10,%rsp
+  80350b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80350b <fsipc+0xb>
+  803512:	49 bb 25 5b 00 00 00 	movabs $0x5b25,%r11
+  803519:	00 00 00 
+  80351c:	4c 01 db             	add    %r11,%rbx
+  80351f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803522:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803526:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80352d:	00 00 00 
+  803530:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803533:	85 c0                	test   %eax,%eax
+  803535:	75 24                	jne    80355b <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803537:	bf 01 00 00 00       	mov    $0x1,%edi
+  80353c:	49 89 df             	mov    %rbx,%r15
+  80353f:	48 b8 70 d0 ff ff ff 	movabs $0xffffffffffffd070,%rax
+  803546:	ff ff ff 
+  803549:	48 01 d8             	add    %rbx,%rax
+  80354c:	ff d0                	call   *%rax
+  80354e:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803555:	00 00 00 
+  803558:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  80355b:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803562:	00 00 00 
+  803565:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803568:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80356c:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80356f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803575:	49 89 d0             	mov    %rdx,%r8
+  803578:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80357d:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803584:	00 00 00 
+  803587:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80358b:	89 c7                	mov    %eax,%edi
+  80358d:	49 89 df             	mov    %rbx,%r15
+  803590:	48 b8 8f ca ff ff ff 	movabs $0xffffffffffffca8f,%rax
+  803597:	ff ff ff 
+  80359a:	48 01 d8             	add    %rbx,%rax
+  80359d:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  80359f:	48 83 c4 10          	add    $0x10,%rsp
+  8035a3:	5b                   	pop    %rbx
+  8035a4:	41 5f                	pop    %r15
+  8035a6:	5d                   	pop    %rbp
+  8035a7:	c3                   	ret
+
+00000000008035a8 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8035a8:	55                   	push   %rbp
+  8035a9:	48 89 e5             	mov    %rsp,%rbp
+  8035ac:	41 57                	push   %r15
+  8035ae:	53                   	push   %rbx
+  8035af:	48 83 ec 20          	sub    $0x20,%rsp
+  8035b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035b3 <fsipc_words+0xb>
+  8035ba:	49 bb 7d 5a 00 00 00 	movabs $0x5a7d,%r11
+  8035c1:	00 00 00 
+  8035c4:	4c 01 db             	add    %r11,%rbx
+  8035c7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8035ce:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8035d2:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8035d9:	00 00 00 
+  8035dc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8035df:	85 c0                	test   %eax,%eax
+  8035e1:	75 24                	jne    803607 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8035e3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035e8:	49 89 df             	mov    %rbx,%r15
+  8035eb:	48 b8 70 d0 ff ff ff 	movabs $0xffffffffffffd070,%rax
+  8035f2:	ff ff ff 
+  8035f5:	48 01 d8             	add    %rbx,%rax
+  8035f8:	ff d0                	call   *%rax
+  8035fa:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803601:	00 00 00 
+  803604:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803607:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80360e:	00 00 00 
+  803611:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803614:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803618:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80361c:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80361f:	89 c7                	mov    %eax,%edi
+  803621:	49 89 df             	mov    %rbx,%r15
+  803624:	48 b8 7a cb ff ff ff 	movabs $0xffffffffffffcb7a,%rax
+  80362b:	ff ff ff 
+  80362e:	48 01 d8             	add    %rbx,%rax
+  803631:	ff d0                	call   *%rax
+}
+  803633:	48 83 c4 20          	add    $0x20,%rsp
+  803637:	5b                   	pop    %rbx
+  803638:	41 5f                	pop    %r15
+  80363a:	5d                   	pop    %rbp
+  80363b:	c3                   	ret
+
+000000000080363c <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  80363c:	55                   	push   %rbp
+  80363d:	48 89 e5             	mov    %rsp,%rbp
+  803640:	41 57                	push   %r15
+  803642:	53                   	push   %rbx
+  803643:	48 83 ec 40          	sub    $0x40,%rsp
+  803647:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803647 <fsipc_pages+0xb>
+  80364e:	49 bb e9 59 00 00 00 	movabs $0x59e9,%r11
+  803655:	00 00 00 
+  803658:	4c 01 db             	add    %r11,%rbx
+  80365b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80365e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803662:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803666:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803669:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803670:	00 00 00 
+  803673:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803676:	85 c0                	test   %eax,%eax
+  803678:	75 24                	jne    80369e <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80367a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80367f:	49 89 df             	mov    %rbx,%r15
+  803682:	48 b8 70 d0 ff ff ff 	movabs $0xffffffffffffd070,%rax
+  803689:	ff ff ff 
+  80368c:	48 01 d8             	add    %rbx,%rax
+  80368f:	ff d0                	call   *%rax
+  803691:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803698:	00 00 00 
+  80369b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  80369e:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8036a3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8036a7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8036aa:	48 98                	cltq
+  8036ac:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8036b0:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8036b4:	0f 95 c0             	setne  %al
+  8036b7:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  8036ba:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8036c1:	00 
+  8036c2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8036c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036ca:	48 01 d0             	add    %rdx,%rax
+  8036cd:	48 83 e8 01          	sub    $0x1,%rax
+  8036d1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8036d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036de:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8036e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036e6:	48 29 d0             	sub    %rdx,%rax
+  8036e9:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8036ed:	41 89 c2             	mov    %eax,%r10d
+  8036f0:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8036f7:	00 00 00 
+  8036fa:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036fd:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  803701:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803705:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803708:	48 83 ec 08          	sub    $0x8,%rsp
+  80370c:	6a 40                	push   $0x40
+  80370e:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803713:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  80371a:	00 
+  80371b:	6a 05                	push   $0x5
+  80371d:	41 89 f9             	mov    %edi,%r9d
+  803720:	49 89 c8             	mov    %rcx,%r8
+  803723:	44 89 d1             	mov    %r10d,%ecx
+  803726:	89 c7                	mov    %eax,%edi
+  803728:	49 89 df             	mov    %rbx,%r15
+  80372b:	48 b8 78 cc ff ff ff 	movabs $0xffffffffffffcc78,%rax
+  803732:	ff ff ff 
+  803735:	48 01 d8             	add    %rbx,%rax
+  803738:	ff d0                	call   *%rax
+  80373a:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80373e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803742:	5b                   	pop    %rbx
+  803743:	41 5f                	pop    %r15
+  803745:	5d                   	pop    %rbp
+  803746:	c3                   	ret
+
+0000000000803747 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  803747:	55                   	push   %rbp
+  803748:	48 89 e5             	mov    %rsp,%rbp
+  80374b:	41 57                	push   %r15
+  80374d:	53                   	push   %rbx
+  80374e:	48 83 ec 20          	sub    $0x20,%rsp
+  803752:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803752 <open+0xb>
+  803759:	49 bb de 58 00 00 00 	movabs $0x58de,%r11
+  803760:	00 00 00 
+  803763:	4c 01 db             	add    %r11,%rbx
+  803766:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80376a:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  80376d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803771:	48 89 c7             	mov    %rax,%rdi
+  803774:	49 89 df             	mov    %rbx,%r15
+  803777:	48 b8 d8 83 ff ff ff 	movabs $0xffffffffffff83d8,%rax
+  80377e:	ff ff ff 
+  803781:	48 01 d8             	add    %rbx,%rax
+  803784:	ff d0                	call   *%rax
+  803786:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80378b:	7e 0a                	jle    803797 <open+0x50>
+		return -E_BAD_PATH;
+  80378d:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803792:	e9 18 01 00 00       	jmp    8038af <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803797:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80379b:	48 89 c7             	mov    %rax,%rdi
+  80379e:	49 89 df             	mov    %rbx,%r15
+  8037a1:	48 b8 4b 99 ff ff ff 	movabs $0xffffffffffff994b,%rax
+  8037a8:	ff ff ff 
+  8037ab:	48 01 d8             	add    %rbx,%rax
+  8037ae:	ff d0                	call   *%rax
+  8037b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037b7:	74 08                	je     8037c1 <open+0x7a>
+		return r;
+  8037b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037bc:	e9 ee 00 00 00       	jmp    8038af <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8037c1:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8037c8:	00 00 00 
+  8037cb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8037ce:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8037d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037d9:	48 89 c6             	mov    %rax,%rsi
+  8037dc:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  8037e3:	00 00 00 
+  8037e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037ea:	48 89 c7             	mov    %rax,%rdi
+  8037ed:	49 89 df             	mov    %rbx,%r15
+  8037f0:	48 b8 6c 84 ff ff ff 	movabs $0xffffffffffff846c,%rax
+  8037f7:	ff ff ff 
+  8037fa:	48 01 d8             	add    %rbx,%rax
+  8037fd:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8037ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803803:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803808:	48 89 c6             	mov    %rax,%rsi
+  80380b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803810:	49 89 df             	mov    %rbx,%r15
+  803813:	48 b8 28 91 ff ff ff 	movabs $0xffffffffffff9128,%rax
+  80381a:	ff ff ff 
+  80381d:	48 01 d8             	add    %rbx,%rax
+  803820:	ff d0                	call   *%rax
+  803822:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803825:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803829:	74 23                	je     80384e <open+0x107>
+		fd_close(fd,0);
+  80382b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80382f:	be 00 00 00 00       	mov    $0x0,%esi
+  803834:	48 89 c7             	mov    %rax,%rdi
+  803837:	49 89 df             	mov    %rbx,%r15
+  80383a:	48 b8 ac 9a ff ff ff 	movabs $0xffffffffffff9aac,%rax
+  803841:	ff ff ff 
+  803844:	48 01 d8             	add    %rbx,%rax
+  803847:	ff d0                	call   *%rax
+		return r;
+  803849:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80384c:	eb 61                	jmp    8038af <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80384e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803852:	48 89 c6             	mov    %rax,%rsi
+  803855:	bf 01 00 00 00       	mov    $0x1,%edi
+  80385a:	48 b8 d0 a4 ff ff ff 	movabs $0xffffffffffffa4d0,%rax
+  803861:	ff ff ff 
+  803864:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803868:	ff d0                	call   *%rax
+  80386a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80386d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803871:	74 23                	je     803896 <open+0x14f>
+		fd_close(fd,0);
+  803873:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803877:	be 00 00 00 00       	mov    $0x0,%esi
+  80387c:	48 89 c7             	mov    %rax,%rdi
+  80387f:	49 89 df             	mov    %rbx,%r15
+  803882:	48 b8 ac 9a ff ff ff 	movabs $0xffffffffffff9aac,%rax
+  803889:	ff ff ff 
+  80388c:	48 01 d8             	add    %rbx,%rax
+  80388f:	ff d0                	call   *%rax
+		return r;
+  803891:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803894:	eb 19                	jmp    8038af <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803896:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80389a:	48 89 c7             	mov    %rax,%rdi
+  80389d:	49 89 df             	mov    %rbx,%r15
+  8038a0:	48 b8 d1 98 ff ff ff 	movabs $0xffffffffffff98d1,%rax
+  8038a7:	ff ff ff 
+  8038aa:	48 01 d8             	add    %rbx,%rax
+  8038ad:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8038af:	48 83 c4 20          	add    $0x20,%rsp
+  8038b3:	5b                   	pop    %rbx
+  8038b4:	41 5f                	pop    %r15
+  8038b6:	5d                   	pop    %rbp
+  8038b7:	c3                   	ret
+
+00000000008038b8 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8038b8:	55                   	push   %rbp
+  8038b9:	48 89 e5             	mov    %rsp,%rbp
+  8038bc:	48 83 ec 20          	sub    $0x20,%rsp
+  8038c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038c0 <devfile_flush+0x8>
+  8038c7:	49 bb 70 57 00 00 00 	movabs $0x5770,%r11
+  8038ce:	00 00 00 
+  8038d1:	4c 01 d8             	add    %r11,%rax
+  8038d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8038d8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8038dc:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8038df:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8038e2:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8038e6:	ba 04 00 00 00       	mov    $0x4,%edx
+  8038eb:	48 89 ce             	mov    %rcx,%rsi
+  8038ee:	bf 06 00 00 00       	mov    $0x6,%edi
+  8038f3:	48 b9 78 a5 ff ff ff 	movabs $0xffffffffffffa578,%rcx
+  8038fa:	ff ff ff 
+  8038fd:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803901:	ff d0                	call   *%rax
+}
+  803903:	c9                   	leave
+  803904:	c3                   	ret
+
+0000000000803905 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803905:	55                   	push   %rbp
+  803906:	48 89 e5             	mov    %rsp,%rbp
+  803909:	41 57                	push   %r15
+  80390b:	53                   	push   %rbx
+  80390c:	48 83 ec 60          	sub    $0x60,%rsp
+  803910:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803910 <devfile_read+0xb>
+  803917:	49 bb 20 57 00 00 00 	movabs $0x5720,%r11
+  80391e:	00 00 00 
+  803921:	4c 01 db             	add    %r11,%rbx
+  803924:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803928:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80392c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  803930:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803934:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803938:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80393c:	8b 50 0c             	mov    0xc(%rax),%edx
+  80393f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803943:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803945:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803949:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80394d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  803951:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803955:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80395a:	ba 10 00 00 00       	mov    $0x10,%edx
+  80395f:	48 89 c6             	mov    %rax,%rsi
+  803962:	bf 03 00 00 00       	mov    $0x3,%edi
+  803967:	48 b8 0c a6 ff ff ff 	movabs $0xffffffffffffa60c,%rax
+  80396e:	ff ff ff 
+  803971:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803975:	ff d0                	call   *%rax
+  803977:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80397a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80397e:	79 05                	jns    803985 <devfile_read+0x80>
+		return r;
+  803980:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803983:	eb 64                	jmp    8039e9 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803985:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803988:	48 63 d0             	movslq %eax,%rdx
+  80398b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80398f:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803994:	48 01 c1             	add    %rax,%rcx
+  803997:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80399b:	48 89 ce             	mov    %rcx,%rsi
+  80399e:	48 89 c7             	mov    %rax,%rdi
+  8039a1:	49 89 df             	mov    %rbx,%r15
+  8039a4:	48 b8 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rax
+  8039ab:	ff ff ff 
+  8039ae:	48 01 d8             	add    %rbx,%rax
+  8039b1:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8039b3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8039ba:	ff ff ff 
+  8039bd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039c1:	48 8b 00             	mov    (%rax),%rax
+  8039c4:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8039ca:	89 c6                	mov    %eax,%esi
+  8039cc:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8039d1:	48 89 c7             	mov    %rax,%rdi
+  8039d4:	49 89 df             	mov    %rbx,%r15
+  8039d7:	48 b8 2a d0 ff ff ff 	movabs $0xffffffffffffd02a,%rax
+  8039de:	ff ff ff 
+  8039e1:	48 01 d8             	add    %rbx,%rax
+  8039e4:	ff d0                	call   *%rax
+	return r;
+  8039e6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8039e9:	48 83 c4 60          	add    $0x60,%rsp
+  8039ed:	5b                   	pop    %rbx
+  8039ee:	41 5f                	pop    %r15
+  8039f0:	5d                   	pop    %rbp
+  8039f1:	c3                   	ret
+
+00000000008039f2 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8039f2:	55                   	push   %rbp
+  8039f3:	48 89 e5             	mov    %rsp,%rbp
+  8039f6:	41 57                	push   %r15
+  8039f8:	53                   	push   %rbx
+  8039f9:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  8039fd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039fd <devfile_write+0xb>
+  803a04:	49 bb 33 56 00 00 00 	movabs $0x5633,%r11
+  803a0b:	00 00 00 
+  803a0e:	4c 01 db             	add    %r11,%rbx
+  803a11:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803a15:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803a19:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803a20:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803a24:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803a28:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803a2f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803a33:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803a3a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a3d:	48 63 d0             	movslq %eax,%rdx
+  803a40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a44:	48 39 c2             	cmp    %rax,%rdx
+  803a47:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803a4b:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803a52:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803a59:	00 
+  803a5a:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803a61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a65:	48 01 d0             	add    %rdx,%rax
+  803a68:	48 83 e8 01          	sub    $0x1,%rax
+  803a6c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803a70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a74:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a79:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803a7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a81:	48 29 d0             	sub    %rdx,%rax
+  803a84:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a88:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803a8b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803a8e:	89 c6                	mov    %eax,%esi
+  803a90:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803a95:	48 89 c7             	mov    %rax,%rdi
+  803a98:	49 89 df             	mov    %rbx,%r15
+  803a9b:	48 b8 e4 cf ff ff ff 	movabs $0xffffffffffffcfe4,%rax
+  803aa2:	ff ff ff 
+  803aa5:	48 01 d8             	add    %rbx,%rax
+  803aa8:	ff d0                	call   *%rax
+  803aaa:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803aad:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803ab1:	79 08                	jns    803abb <devfile_write+0xc9>
+		return r;
+  803ab3:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803ab6:	e9 8f 00 00 00       	jmp    803b4a <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803abb:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803ac2:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803ac6:	48 89 c6             	mov    %rax,%rsi
+  803ac9:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803ace:	48 89 c7             	mov    %rax,%rdi
+  803ad1:	49 89 df             	mov    %rbx,%r15
+  803ad4:	48 b8 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rax
+  803adb:	ff ff ff 
+  803ade:	48 01 d8             	add    %rbx,%rax
+  803ae1:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803ae3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803ae7:	8b 50 0c             	mov    0xc(%rax),%edx
+  803aea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803aee:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803af0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803af4:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803afb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803aff:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803b02:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803b06:	89 d1                	mov    %edx,%ecx
+  803b08:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b0d:	48 89 c6             	mov    %rax,%rsi
+  803b10:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b15:	48 b8 0c a6 ff ff ff 	movabs $0xffffffffffffa60c,%rax
+  803b1c:	ff ff ff 
+  803b1f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b23:	ff d0                	call   *%rax
+  803b25:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803b28:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803b2b:	89 c6                	mov    %eax,%esi
+  803b2d:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b32:	48 89 c7             	mov    %rax,%rdi
+  803b35:	49 89 df             	mov    %rbx,%r15
+  803b38:	48 b8 2a d0 ff ff ff 	movabs $0xffffffffffffd02a,%rax
+  803b3f:	ff ff ff 
+  803b42:	48 01 d8             	add    %rbx,%rax
+  803b45:	ff d0                	call   *%rax
+	return r;
+  803b47:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803b4a:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803b4e:	5b                   	pop    %rbx
+  803b4f:	41 5f                	pop    %r15
+  803b51:	5d                   	pop    %rbp
+  803b52:	c3                   	ret
+
+0000000000803b53 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803b53:	55                   	push   %rbp
+  803b54:	48 89 e5             	mov    %rsp,%rbp
+  803b57:	41 57                	push   %r15
+  803b59:	53                   	push   %rbx
+  803b5a:	48 83 ec 20          	sub    $0x20,%rsp
+  803b5e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b5e <devfile_stat+0xb>
+  803b65:	49 bb d2 54 00 00 00 	movabs $0x54d2,%r11
+  803b6c:	00 00 00 
+  803b6f:	4c 01 db             	add    %r11,%rbx
+  803b72:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803b76:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803b7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b7e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b81:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803b88:	00 00 00 
+  803b8b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803b8e:	be 00 00 00 00       	mov    $0x0,%esi
+  803b93:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b98:	48 b8 d0 a4 ff ff ff 	movabs $0xffffffffffffa4d0,%rax
+  803b9f:	ff ff ff 
+  803ba2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ba6:	ff d0                	call   *%rax
+  803ba8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803baf:	79 05                	jns    803bb6 <devfile_stat+0x63>
+		return r;
+  803bb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bb4:	eb 65                	jmp    803c1b <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803bb6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bba:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803bc1:	00 00 00 
+  803bc4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803bc8:	48 89 d6             	mov    %rdx,%rsi
+  803bcb:	48 89 c7             	mov    %rax,%rdi
+  803bce:	49 89 df             	mov    %rbx,%r15
+  803bd1:	48 b8 6c 84 ff ff ff 	movabs $0xffffffffffff846c,%rax
+  803bd8:	ff ff ff 
+  803bdb:	48 01 d8             	add    %rbx,%rax
+  803bde:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803be0:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803be7:	00 00 00 
+  803bea:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803bf1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803bf5:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803bfb:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803c02:	00 00 00 
+  803c05:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803c0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c10:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803c16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c1b:	48 83 c4 20          	add    $0x20,%rsp
+  803c1f:	5b                   	pop    %rbx
+  803c20:	41 5f                	pop    %r15
+  803c22:	5d                   	pop    %rbp
+  803c23:	c3                   	ret
+
+0000000000803c24 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803c24:	55                   	push   %rbp
+  803c25:	48 89 e5             	mov    %rsp,%rbp
+  803c28:	48 83 ec 20          	sub    $0x20,%rsp
+  803c2c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c2c <devfile_trunc+0x8>
+  803c33:	49 bb 04 54 00 00 00 	movabs $0x5404,%r11
+  803c3a:	00 00 00 
+  803c3d:	4c 01 d8             	add    %r11,%rax
+  803c40:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c44:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803c47:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803c4b:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803c4e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803c51:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803c54:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803c57:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803c5b:	ba 08 00 00 00       	mov    $0x8,%edx
+  803c60:	48 89 ce             	mov    %rcx,%rsi
+  803c63:	bf 02 00 00 00       	mov    $0x2,%edi
+  803c68:	48 b9 78 a5 ff ff ff 	movabs $0xffffffffffffa578,%rcx
+  803c6f:	ff ff ff 
+  803c72:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803c76:	ff d0                	call   *%rax
+}
+  803c78:	c9                   	leave
+  803c79:	c3                   	ret
+
+0000000000803c7a <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803c7a:	55                   	push   %rbp
+  803c7b:	48 89 e5             	mov    %rsp,%rbp
+  803c7e:	41 57                	push   %r15
+  803c80:	53                   	push   %rbx
+  803c81:	48 83 ec 10          	sub    $0x10,%rsp
+  803c85:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c85 <remove+0xb>
+  803c8c:	49 bb ab 53 00 00 00 	movabs $0x53ab,%r11
+  803c93:	00 00 00 
+  803c96:	4c 01 db             	add    %r11,%rbx
+  803c99:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803c9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ca1:	48 89 c7             	mov    %rax,%rdi
+  803ca4:	49 89 df             	mov    %rbx,%r15
+  803ca7:	48 b8 d8 83 ff ff ff 	movabs $0xffffffffffff83d8,%rax
+  803cae:	ff ff ff 
+  803cb1:	48 01 d8             	add    %rbx,%rax
+  803cb4:	ff d0                	call   *%rax
+  803cb6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803cbb:	7e 07                	jle    803cc4 <remove+0x4a>
+		return -E_BAD_PATH;
+  803cbd:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803cc2:	eb 44                	jmp    803d08 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803cc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cc8:	48 89 c6             	mov    %rax,%rsi
+  803ccb:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803cd2:	00 00 00 
+  803cd5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cd9:	48 89 c7             	mov    %rax,%rdi
+  803cdc:	49 89 df             	mov    %rbx,%r15
+  803cdf:	48 b8 6c 84 ff ff ff 	movabs $0xffffffffffff846c,%rax
+  803ce6:	ff ff ff 
+  803ce9:	48 01 d8             	add    %rbx,%rax
+  803cec:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803cee:	be 00 00 00 00       	mov    $0x0,%esi
+  803cf3:	bf 07 00 00 00       	mov    $0x7,%edi
+  803cf8:	48 b8 d0 a4 ff ff ff 	movabs $0xffffffffffffa4d0,%rax
+  803cff:	ff ff ff 
+  803d02:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d06:	ff d0                	call   *%rax
+}
+  803d08:	48 83 c4 10          	add    $0x10,%rsp
+  803d0c:	5b                   	pop    %rbx
+  803d0d:	41 5f                	pop    %r15
+  803d0f:	5d                   	pop    %rbp
+  803d10:	c3                   	ret
+
+0000000000803d11 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803d11:	55                   	push   %rbp
+  803d12:	48 89 e5             	mov    %rsp,%rbp
+  803d15:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d15 <sync+0x4>
+  803d1c:	49 bb 1b 53 00 00 00 	movabs $0x531b,%r11
+  803d23:	00 00 00 
+  803d26:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803d29:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d2e:	be 00 00 00 00       	mov    $0x0,%esi
+  803d33:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d38:	48 b9 78 a5 ff ff ff 	movabs $0xffffffffffffa578,%rcx
+  803d3f:	ff ff ff 
+  803d42:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803d46:	ff d0                	call   *%rax
+}
+  803d48:	5d                   	pop    %rbp
+  803d49:	c3                   	ret
+
+0000000000803d4a <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803d4a:	55                   	push   %rbp
+  803d4b:	48 89 e5             	mov    %rsp,%rbp
+  803d4e:	41 57                	push   %r15
+  803d50:	53                   	push   %rbx
+  803d51:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803d58:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d58 <copy+0xe>
+  803d5f:	49 bb d8 52 00 00 00 	movabs $0x52d8,%r11
+  803d66:	00 00 00 
+  803d69:	4c 01 db             	add    %r11,%rbx
+  803d6c:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803d73:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803d7a:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803d81:	be 00 00 00 00       	mov    $0x0,%esi
+  803d86:	48 89 c7             	mov    %rax,%rdi
+  803d89:	48 b8 17 a7 ff ff ff 	movabs $0xffffffffffffa717,%rax
+  803d90:	ff ff ff 
+  803d93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d97:	ff d0                	call   *%rax
+  803d99:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803d9c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803da0:	79 35                	jns    803dd7 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803da2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803da5:	89 c6                	mov    %eax,%esi
+  803da7:	48 b8 c6 dc ff ff ff 	movabs $0xffffffffffffdcc6,%rax
+  803dae:	ff ff ff 
+  803db1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803db5:	48 89 c7             	mov    %rax,%rdi
+  803db8:	49 89 df             	mov    %rbx,%r15
+  803dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc0:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  803dc7:	ff ff ff 
+  803dca:	48 01 da             	add    %rbx,%rdx
+  803dcd:	ff d2                	call   *%rdx
+		return fd_src;
+  803dcf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dd2:	e9 d7 01 00 00       	jmp    803fae <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803dd7:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803dde:	be 01 01 00 00       	mov    $0x101,%esi
+  803de3:	48 89 c7             	mov    %rax,%rdi
+  803de6:	48 b8 17 a7 ff ff ff 	movabs $0xffffffffffffa717,%rax
+  803ded:	ff ff ff 
+  803df0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803df4:	ff d0                	call   *%rax
+  803df6:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803df9:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803dfd:	0f 89 df 00 00 00    	jns    803ee2 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803e03:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e06:	89 c6                	mov    %eax,%esi
+  803e08:	48 b8 dc dc ff ff ff 	movabs $0xffffffffffffdcdc,%rax
+  803e0f:	ff ff ff 
+  803e12:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e16:	48 89 c7             	mov    %rax,%rdi
+  803e19:	49 89 df             	mov    %rbx,%r15
+  803e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e21:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  803e28:	ff ff ff 
+  803e2b:	48 01 da             	add    %rbx,%rdx
+  803e2e:	ff d2                	call   *%rdx
+		close(fd_src);
+  803e30:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e33:	89 c7                	mov    %eax,%edi
+  803e35:	49 89 df             	mov    %rbx,%r15
+  803e38:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  803e3f:	ff ff ff 
+  803e42:	48 01 d8             	add    %rbx,%rax
+  803e45:	ff d0                	call   *%rax
+		return fd_dest;
+  803e47:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e4a:	e9 5f 01 00 00       	jmp    803fae <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803e4f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803e52:	48 63 d0             	movslq %eax,%rdx
+  803e55:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803e5c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e5f:	48 89 ce             	mov    %rcx,%rsi
+  803e62:	89 c7                	mov    %eax,%edi
+  803e64:	49 89 df             	mov    %rbx,%r15
+  803e67:	48 b8 ee a0 ff ff ff 	movabs $0xffffffffffffa0ee,%rax
+  803e6e:	ff ff ff 
+  803e71:	48 01 d8             	add    %rbx,%rax
+  803e74:	ff d0                	call   *%rax
+  803e76:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803e79:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803e7d:	79 63                	jns    803ee2 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803e7f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803e82:	89 c6                	mov    %eax,%esi
+  803e84:	48 b8 f6 dc ff ff ff 	movabs $0xffffffffffffdcf6,%rax
+  803e8b:	ff ff ff 
+  803e8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e92:	48 89 c7             	mov    %rax,%rdi
+  803e95:	49 89 df             	mov    %rbx,%r15
+  803e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e9d:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  803ea4:	ff ff ff 
+  803ea7:	48 01 da             	add    %rbx,%rdx
+  803eaa:	ff d2                	call   *%rdx
+			close(fd_src);
+  803eac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803eaf:	89 c7                	mov    %eax,%edi
+  803eb1:	49 89 df             	mov    %rbx,%r15
+  803eb4:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  803ebb:	ff ff ff 
+  803ebe:	48 01 d8             	add    %rbx,%rax
+  803ec1:	ff d0                	call   *%rax
+			close(fd_dest);
+  803ec3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ec6:	89 c7                	mov    %eax,%edi
+  803ec8:	49 89 df             	mov    %rbx,%r15
+  803ecb:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  803ed2:	ff ff ff 
+  803ed5:	48 01 d8             	add    %rbx,%rax
+  803ed8:	ff d0                	call   *%rax
+			return write_size;
+  803eda:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803edd:	e9 cc 00 00 00       	jmp    803fae <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803ee2:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803ee9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803eec:	ba 00 02 00 00       	mov    $0x200,%edx
+  803ef1:	48 89 ce             	mov    %rcx,%rsi
+  803ef4:	89 c7                	mov    %eax,%edi
+  803ef6:	49 89 df             	mov    %rbx,%r15
+  803ef9:	48 b8 48 9f ff ff ff 	movabs $0xffffffffffff9f48,%rax
+  803f00:	ff ff ff 
+  803f03:	48 01 d8             	add    %rbx,%rax
+  803f06:	ff d0                	call   *%rax
+  803f08:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803f0b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f0f:	0f 8f 3a ff ff ff    	jg     803e4f <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803f15:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f19:	79 60                	jns    803f7b <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803f1b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f1e:	89 c6                	mov    %eax,%esi
+  803f20:	48 b8 09 dd ff ff ff 	movabs $0xffffffffffffdd09,%rax
+  803f27:	ff ff ff 
+  803f2a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f2e:	48 89 c7             	mov    %rax,%rdi
+  803f31:	49 89 df             	mov    %rbx,%r15
+  803f34:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f39:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  803f40:	ff ff ff 
+  803f43:	48 01 da             	add    %rbx,%rdx
+  803f46:	ff d2                	call   *%rdx
+		close(fd_src);
+  803f48:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f4b:	89 c7                	mov    %eax,%edi
+  803f4d:	49 89 df             	mov    %rbx,%r15
+  803f50:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  803f57:	ff ff ff 
+  803f5a:	48 01 d8             	add    %rbx,%rax
+  803f5d:	ff d0                	call   *%rax
+		close(fd_dest);
+  803f5f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f62:	89 c7                	mov    %eax,%edi
+  803f64:	49 89 df             	mov    %rbx,%r15
+  803f67:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  803f6e:	ff ff ff 
+  803f71:	48 01 d8             	add    %rbx,%rax
+  803f74:	ff d0                	call   *%rax
+		return read_size;
+  803f76:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f79:	eb 33                	jmp    803fae <copy+0x264>
+	}
+	close(fd_src);
+  803f7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f7e:	89 c7                	mov    %eax,%edi
+  803f80:	49 89 df             	mov    %rbx,%r15
+  803f83:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  803f8a:	ff ff ff 
+  803f8d:	48 01 d8             	add    %rbx,%rax
+  803f90:	ff d0                	call   *%rax
+	close(fd_dest);
+  803f92:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f95:	89 c7                	mov    %eax,%edi
+  803f97:	49 89 df             	mov    %rbx,%r15
+  803f9a:	48 b8 90 9c ff ff ff 	movabs $0xffffffffffff9c90,%rax
+  803fa1:	ff ff ff 
+  803fa4:	48 01 d8             	add    %rbx,%rax
+  803fa7:	ff d0                	call   *%rax
+	return 0;
+  803fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803fae:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803fb5:	5b                   	pop    %rbx
+  803fb6:	41 5f                	pop    %r15
+  803fb8:	5d                   	pop    %rbp
+  803fb9:	c3                   	ret
+
+0000000000803fba <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  803fba:	55                   	push   %rbp
+  803fbb:	48 89 e5             	mov    %rsp,%rbp
+  803fbe:	41 57                	push   %r15
+  803fc0:	53                   	push   %rbx
+  803fc1:	48 83 ec 20          	sub    $0x20,%rsp
+  803fc5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fc5 <fd2sockid+0xb>
+  803fcc:	49 bb 6b 50 00 00 00 	movabs $0x506b,%r11
+  803fd3:	00 00 00 
+  803fd6:	4c 01 db             	add    %r11,%rbx
+  803fd9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803fdc:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803fe0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803fe3:	48 89 d6             	mov    %rdx,%rsi
+  803fe6:	89 c7                	mov    %eax,%edi
+  803fe8:	49 89 df             	mov    %rbx,%r15
+  803feb:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  803ff2:	ff ff ff 
+  803ff5:	48 01 d8             	add    %rbx,%rax
+  803ff8:	ff d0                	call   *%rax
+  803ffa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ffd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804001:	79 05                	jns    804008 <fd2sockid+0x4e>
+		return r;
+  804003:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804006:	eb 25                	jmp    80402d <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804008:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80400c:	8b 10                	mov    (%rax),%edx
+  80400e:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  804015:	00 00 00 
+  804018:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80401b:	39 c2                	cmp    %eax,%edx
+  80401d:	74 07                	je     804026 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80401f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804024:	eb 07                	jmp    80402d <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804026:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80402a:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  80402d:	48 83 c4 20          	add    $0x20,%rsp
+  804031:	5b                   	pop    %rbx
+  804032:	41 5f                	pop    %r15
+  804034:	5d                   	pop    %rbp
+  804035:	c3                   	ret
+
+0000000000804036 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804036:	55                   	push   %rbp
+  804037:	48 89 e5             	mov    %rsp,%rbp
+  80403a:	41 57                	push   %r15
+  80403c:	53                   	push   %rbx
+  80403d:	48 83 ec 20          	sub    $0x20,%rsp
+  804041:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804041 <alloc_sockfd+0xb>
+  804048:	49 bb ef 4f 00 00 00 	movabs $0x4fef,%r11
+  80404f:	00 00 00 
+  804052:	4c 01 db             	add    %r11,%rbx
+  804055:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804058:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80405c:	48 89 c7             	mov    %rax,%rdi
+  80405f:	49 89 df             	mov    %rbx,%r15
+  804062:	48 b8 4b 99 ff ff ff 	movabs $0xffffffffffff994b,%rax
+  804069:	ff ff ff 
+  80406c:	48 01 d8             	add    %rbx,%rax
+  80406f:	ff d0                	call   *%rax
+  804071:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804074:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804078:	78 2c                	js     8040a6 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80407a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80407e:	ba 07 04 00 00       	mov    $0x407,%edx
+  804083:	48 89 c6             	mov    %rax,%rsi
+  804086:	bf 00 00 00 00       	mov    $0x0,%edi
+  80408b:	49 89 df             	mov    %rbx,%r15
+  80408e:	48 b8 28 91 ff ff ff 	movabs $0xffffffffffff9128,%rax
+  804095:	ff ff ff 
+  804098:	48 01 d8             	add    %rbx,%rax
+  80409b:	ff d0                	call   *%rax
+  80409d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040a4:	79 1c                	jns    8040c2 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8040a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040a9:	89 c7                	mov    %eax,%edi
+  8040ab:	49 89 df             	mov    %rbx,%r15
+  8040ae:	48 b8 fa b7 ff ff ff 	movabs $0xffffffffffffb7fa,%rax
+  8040b5:	ff ff ff 
+  8040b8:	48 01 d8             	add    %rbx,%rax
+  8040bb:	ff d0                	call   *%rax
+		return r;
+  8040bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040c0:	eb 41                	jmp    804103 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  8040c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040c6:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  8040cd:	00 00 00 
+  8040d0:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8040d3:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8040d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040d9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  8040e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040e4:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8040e7:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8040ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040ee:	48 89 c7             	mov    %rax,%rdi
+  8040f1:	49 89 df             	mov    %rbx,%r15
+  8040f4:	48 b8 d1 98 ff ff ff 	movabs $0xffffffffffff98d1,%rax
+  8040fb:	ff ff ff 
+  8040fe:	48 01 d8             	add    %rbx,%rax
+  804101:	ff d0                	call   *%rax
+}
+  804103:	48 83 c4 20          	add    $0x20,%rsp
+  804107:	5b                   	pop    %rbx
+  804108:	41 5f                	pop    %r15
+  80410a:	5d                   	pop    %rbp
+  80410b:	c3                   	ret
+
+000000000080410c <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80410c:	55                   	push   %rbp
+  80410d:	48 89 e5             	mov    %rsp,%rbp
+  804110:	41 57                	push   %r15
+  804112:	53                   	push   %rbx
+  804113:	48 83 ec 30          	sub    $0x30,%rsp
+  804117:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804117 <accept+0xb>
+  80411e:	49 bb 19 4f 00 00 00 	movabs $0x4f19,%r11
+  804125:	00 00 00 
+  804128:	4c 01 db             	add    %r11,%rbx
+  80412b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80412e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804132:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804136:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804139:	89 c7                	mov    %eax,%edi
+  80413b:	48 b8 8a af ff ff ff 	movabs $0xffffffffffffaf8a,%rax
+  804142:	ff ff ff 
+  804145:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804149:	ff d0                	call   *%rax
+  80414b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80414e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804152:	79 05                	jns    804159 <accept+0x4d>
+		return r;
+  804154:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804157:	eb 45                	jmp    80419e <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804159:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80415d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804161:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804164:	48 89 ce             	mov    %rcx,%rsi
+  804167:	89 c7                	mov    %eax,%edi
+  804169:	49 89 df             	mov    %rbx,%r15
+  80416c:	48 b8 68 b6 ff ff ff 	movabs $0xffffffffffffb668,%rax
+  804173:	ff ff ff 
+  804176:	48 01 d8             	add    %rbx,%rax
+  804179:	ff d0                	call   *%rax
+  80417b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80417e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804182:	79 05                	jns    804189 <accept+0x7d>
+		return r;
+  804184:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804187:	eb 15                	jmp    80419e <accept+0x92>
+	return alloc_sockfd(r);
+  804189:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80418c:	89 c7                	mov    %eax,%edi
+  80418e:	48 b8 06 b0 ff ff ff 	movabs $0xffffffffffffb006,%rax
+  804195:	ff ff ff 
+  804198:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80419c:	ff d0                	call   *%rax
+}
+  80419e:	48 83 c4 30          	add    $0x30,%rsp
+  8041a2:	5b                   	pop    %rbx
+  8041a3:	41 5f                	pop    %r15
+  8041a5:	5d                   	pop    %rbp
+  8041a6:	c3                   	ret
+
+00000000008041a7 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8041a7:	55                   	push   %rbp
+  8041a8:	48 89 e5             	mov    %rsp,%rbp
+  8041ab:	41 57                	push   %r15
+  8041ad:	53                   	push   %rbx
+  8041ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8041b2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041b2 <bind+0xb>
+  8041b9:	49 bb 7e 4e 00 00 00 	movabs $0x4e7e,%r11
+  8041c0:	00 00 00 
+  8041c3:	4c 01 db             	add    %r11,%rbx
+  8041c6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8041c9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8041cd:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8041d0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041d3:	89 c7                	mov    %eax,%edi
+  8041d5:	48 b8 8a af ff ff ff 	movabs $0xffffffffffffaf8a,%rax
+  8041dc:	ff ff ff 
+  8041df:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041e3:	ff d0                	call   *%rax
+  8041e5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041e8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041ec:	79 05                	jns    8041f3 <bind+0x4c>
+		return r;
+  8041ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041f1:	eb 21                	jmp    804214 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  8041f3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8041f6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8041fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041fd:	48 89 ce             	mov    %rcx,%rsi
+  804200:	89 c7                	mov    %eax,%edi
+  804202:	49 89 df             	mov    %rbx,%r15
+  804205:	48 b8 14 b7 ff ff ff 	movabs $0xffffffffffffb714,%rax
+  80420c:	ff ff ff 
+  80420f:	48 01 d8             	add    %rbx,%rax
+  804212:	ff d0                	call   *%rax
+}
+  804214:	48 83 c4 20          	add    $0x20,%rsp
+  804218:	5b                   	pop    %rbx
+  804219:	41 5f                	pop    %r15
+  80421b:	5d                   	pop    %rbp
+  80421c:	c3                   	ret
+
+000000000080421d <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80421d:	55                   	push   %rbp
+  80421e:	48 89 e5             	mov    %rsp,%rbp
+  804221:	41 57                	push   %r15
+  804223:	53                   	push   %rbx
+  804224:	48 83 ec 20          	sub    $0x20,%rsp
+  804228:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804228 <shutdown+0xb>
+  80422f:	49 bb 08 4e 00 00 00 	movabs $0x4e08,%r11
+  804236:	00 00 00 
+  804239:	4c 01 db             	add    %r11,%rbx
+  80423c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80423f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804242:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804245:	89 c7                	mov    %eax,%edi
+  804247:	48 b8 8a af ff ff ff 	movabs $0xffffffffffffaf8a,%rax
+  80424e:	ff ff ff 
+  804251:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804255:	ff d0                	call   *%rax
+  804257:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80425a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80425e:	79 05                	jns    804265 <shutdown+0x48>
+		return r;
+  804260:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804263:	eb 1c                	jmp    804281 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804265:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804268:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80426b:	89 d6                	mov    %edx,%esi
+  80426d:	89 c7                	mov    %eax,%edi
+  80426f:	49 89 df             	mov    %rbx,%r15
+  804272:	48 b8 a9 b7 ff ff ff 	movabs $0xffffffffffffb7a9,%rax
+  804279:	ff ff ff 
+  80427c:	48 01 d8             	add    %rbx,%rax
+  80427f:	ff d0                	call   *%rax
+}
+  804281:	48 83 c4 20          	add    $0x20,%rsp
+  804285:	5b                   	pop    %rbx
+  804286:	41 5f                	pop    %r15
+  804288:	5d                   	pop    %rbp
+  804289:	c3                   	ret
+
+000000000080428a <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  80428a:	55                   	push   %rbp
+  80428b:	48 89 e5             	mov    %rsp,%rbp
+  80428e:	41 57                	push   %r15
+  804290:	53                   	push   %rbx
+  804291:	48 83 ec 10          	sub    $0x10,%rsp
+  804295:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804295 <devsock_close+0xb>
+  80429c:	49 bb 9b 4d 00 00 00 	movabs $0x4d9b,%r11
+  8042a3:	00 00 00 
+  8042a6:	4c 01 db             	add    %r11,%rbx
+  8042a9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  8042ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042b1:	48 89 c7             	mov    %rax,%rdi
+  8042b4:	49 89 df             	mov    %rbx,%r15
+  8042b7:	48 b8 ff d0 ff ff ff 	movabs $0xffffffffffffd0ff,%rax
+  8042be:	ff ff ff 
+  8042c1:	48 01 d8             	add    %rbx,%rax
+  8042c4:	ff d0                	call   *%rax
+  8042c6:	83 f8 01             	cmp    $0x1,%eax
+  8042c9:	75 1d                	jne    8042e8 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  8042cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042cf:	8b 40 0c             	mov    0xc(%rax),%eax
+  8042d2:	89 c7                	mov    %eax,%edi
+  8042d4:	49 89 df             	mov    %rbx,%r15
+  8042d7:	48 b8 fa b7 ff ff ff 	movabs $0xffffffffffffb7fa,%rax
+  8042de:	ff ff ff 
+  8042e1:	48 01 d8             	add    %rbx,%rax
+  8042e4:	ff d0                	call   *%rax
+  8042e6:	eb 05                	jmp    8042ed <devsock_close+0x63>
+	else
+		return 0;
+  8042e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042ed:	48 83 c4 10          	add    $0x10,%rsp
+  8042f1:	5b                   	pop    %rbx
+  8042f2:	41 5f                	pop    %r15
+  8042f4:	5d                   	pop    %rbp
+  8042f5:	c3                   	ret
+
+00000000008042f6 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8042f6:	55                   	push   %rbp
+  8042f7:	48 89 e5             	mov    %rsp,%rbp
+  8042fa:	41 57                	push   %r15
+  8042fc:	53                   	push   %rbx
+  8042fd:	48 83 ec 20          	sub    $0x20,%rsp
+  804301:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804301 <connect+0xb>
+  804308:	49 bb 2f 4d 00 00 00 	movabs $0x4d2f,%r11
+  80430f:	00 00 00 
+  804312:	4c 01 db             	add    %r11,%rbx
+  804315:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804318:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80431c:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80431f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804322:	89 c7                	mov    %eax,%edi
+  804324:	48 b8 8a af ff ff ff 	movabs $0xffffffffffffaf8a,%rax
+  80432b:	ff ff ff 
+  80432e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804332:	ff d0                	call   *%rax
+  804334:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804337:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80433b:	79 05                	jns    804342 <connect+0x4c>
+		return r;
+  80433d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804340:	eb 21                	jmp    804363 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804342:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804345:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804349:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80434c:	48 89 ce             	mov    %rcx,%rsi
+  80434f:	89 c7                	mov    %eax,%edi
+  804351:	49 89 df             	mov    %rbx,%r15
+  804354:	48 b8 42 b8 ff ff ff 	movabs $0xffffffffffffb842,%rax
+  80435b:	ff ff ff 
+  80435e:	48 01 d8             	add    %rbx,%rax
+  804361:	ff d0                	call   *%rax
+}
+  804363:	48 83 c4 20          	add    $0x20,%rsp
+  804367:	5b                   	pop    %rbx
+  804368:	41 5f                	pop    %r15
+  80436a:	5d                   	pop    %rbp
+  80436b:	c3                   	ret
+
+000000000080436c <listen>:
+
+int
+listen(int s, int backlog)
+{
+  80436c:	55                   	push   %rbp
+  80436d:	48 89 e5             	mov    %rsp,%rbp
+  804370:	41 57                	push   %r15
+  804372:	53                   	push   %rbx
+  804373:	48 83 ec 20          	sub    $0x20,%rsp
+  804377:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804377 <listen+0xb>
+  80437e:	49 bb b9 4c 00 00 00 	movabs $0x4cb9,%r11
+  804385:	00 00 00 
+  804388:	4c 01 db             	add    %r11,%rbx
+  80438b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80438e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804391:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804394:	89 c7                	mov    %eax,%edi
+  804396:	48 b8 8a af ff ff ff 	movabs $0xffffffffffffaf8a,%rax
+  80439d:	ff ff ff 
+  8043a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043a4:	ff d0                	call   *%rax
+  8043a6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043ad:	79 05                	jns    8043b4 <listen+0x48>
+		return r;
+  8043af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043b2:	eb 1c                	jmp    8043d0 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  8043b4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8043b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043ba:	89 d6                	mov    %edx,%esi
+  8043bc:	89 c7                	mov    %eax,%edi
+  8043be:	49 89 df             	mov    %rbx,%r15
+  8043c1:	48 b8 d7 b8 ff ff ff 	movabs $0xffffffffffffb8d7,%rax
+  8043c8:	ff ff ff 
+  8043cb:	48 01 d8             	add    %rbx,%rax
+  8043ce:	ff d0                	call   *%rax
+}
+  8043d0:	48 83 c4 20          	add    $0x20,%rsp
+  8043d4:	5b                   	pop    %rbx
+  8043d5:	41 5f                	pop    %r15
+  8043d7:	5d                   	pop    %rbp
+  8043d8:	c3                   	ret
+
+00000000008043d9 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8043d9:	55                   	push   %rbp
+  8043da:	48 89 e5             	mov    %rsp,%rbp
+  8043dd:	41 57                	push   %r15
+  8043df:	48 83 ec 28          	sub    $0x28,%rsp
+  8043e3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8043e3 <devsock_read+0xa>
+  8043ea:	49 bb 4d 4c 00 00 00 	movabs $0x4c4d,%r11
+  8043f1:	00 00 00 
+  8043f4:	4c 01 d8             	add    %r11,%rax
+  8043f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8043fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8043ff:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804403:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804407:	41 89 d0             	mov    %edx,%r8d
+  80440a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80440e:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804411:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804415:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80441a:	44 89 c2             	mov    %r8d,%edx
+  80441d:	49 89 c7             	mov    %rax,%r15
+  804420:	49 b8 28 b9 ff ff ff 	movabs $0xffffffffffffb928,%r8
+  804427:	ff ff ff 
+  80442a:	49 01 c0             	add    %rax,%r8
+  80442d:	41 ff d0             	call   *%r8
+}
+  804430:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804434:	c9                   	leave
+  804435:	c3                   	ret
+
+0000000000804436 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804436:	55                   	push   %rbp
+  804437:	48 89 e5             	mov    %rsp,%rbp
+  80443a:	41 57                	push   %r15
+  80443c:	48 83 ec 28          	sub    $0x28,%rsp
+  804440:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804440 <devsock_write+0xa>
+  804447:	49 bb f0 4b 00 00 00 	movabs $0x4bf0,%r11
+  80444e:	00 00 00 
+  804451:	4c 01 d8             	add    %r11,%rax
+  804454:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804458:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80445c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804460:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804464:	41 89 d0             	mov    %edx,%r8d
+  804467:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80446b:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80446e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804472:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804477:	44 89 c2             	mov    %r8d,%edx
+  80447a:	49 89 c7             	mov    %rax,%r15
+  80447d:	49 b8 45 ba ff ff ff 	movabs $0xffffffffffffba45,%r8
+  804484:	ff ff ff 
+  804487:	49 01 c0             	add    %rax,%r8
+  80448a:	41 ff d0             	call   *%r8
+}
+  80448d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804491:	c9                   	leave
+  804492:	c3                   	ret
+
+0000000000804493 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  804493:	55                   	push   %rbp
+  804494:	48 89 e5             	mov    %rsp,%rbp
+  804497:	41 57                	push   %r15
+  804499:	48 83 ec 18          	sub    $0x18,%rsp
+  80449d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80449d <devsock_stat+0xa>
+  8044a4:	49 bb 93 4b 00 00 00 	movabs $0x4b93,%r11
+  8044ab:	00 00 00 
+  8044ae:	4c 01 d8             	add    %r11,%rax
+  8044b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8044b5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8044b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8044bd:	48 b9 24 dd ff ff ff 	movabs $0xffffffffffffdd24,%rcx
+  8044c4:	ff ff ff 
+  8044c7:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8044cb:	48 89 ce             	mov    %rcx,%rsi
+  8044ce:	48 89 d7             	mov    %rdx,%rdi
+  8044d1:	49 89 c7             	mov    %rax,%r15
+  8044d4:	48 ba 6c 84 ff ff ff 	movabs $0xffffffffffff846c,%rdx
+  8044db:	ff ff ff 
+  8044de:	48 01 c2             	add    %rax,%rdx
+  8044e1:	ff d2                	call   *%rdx
+	return 0;
+  8044e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044e8:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8044ec:	c9                   	leave
+  8044ed:	c3                   	ret
+
+00000000008044ee <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8044ee:	55                   	push   %rbp
+  8044ef:	48 89 e5             	mov    %rsp,%rbp
+  8044f2:	41 57                	push   %r15
+  8044f4:	53                   	push   %rbx
+  8044f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8044f9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044f9 <socket+0xb>
+  804500:	49 bb 37 4b 00 00 00 	movabs $0x4b37,%r11
+  804507:	00 00 00 
+  80450a:	4c 01 db             	add    %r11,%rbx
+  80450d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804510:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804513:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804516:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804519:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80451c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80451f:	89 ce                	mov    %ecx,%esi
+  804521:	89 c7                	mov    %eax,%edi
+  804523:	49 89 df             	mov    %rbx,%r15
+  804526:	48 b8 1c bc ff ff ff 	movabs $0xffffffffffffbc1c,%rax
+  80452d:	ff ff ff 
+  804530:	48 01 d8             	add    %rbx,%rax
+  804533:	ff d0                	call   *%rax
+  804535:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804538:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80453c:	79 05                	jns    804543 <socket+0x55>
+		return r;
+  80453e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804541:	eb 15                	jmp    804558 <socket+0x6a>
+	return alloc_sockfd(r);
+  804543:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804546:	89 c7                	mov    %eax,%edi
+  804548:	48 b8 06 b0 ff ff ff 	movabs $0xffffffffffffb006,%rax
+  80454f:	ff ff ff 
+  804552:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804556:	ff d0                	call   *%rax
+}
+  804558:	48 83 c4 20          	add    $0x20,%rsp
+  80455c:	5b                   	pop    %rbx
+  80455d:	41 5f                	pop    %r15
+  80455f:	5d                   	pop    %rbp
+  804560:	c3                   	ret
+
+0000000000804561 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  804561:	55                   	push   %rbp
+  804562:	48 89 e5             	mov    %rsp,%rbp
+  804565:	41 57                	push   %r15
+  804567:	53                   	push   %rbx
+  804568:	48 83 ec 10          	sub    $0x10,%rsp
+  80456c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80456c <nsipc+0xb>
+  804573:	49 bb c4 4a 00 00 00 	movabs $0x4ac4,%r11
+  80457a:	00 00 00 
+  80457d:	4c 01 db             	add    %r11,%rbx
+  804580:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  804583:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80458a:	00 00 00 
+  80458d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804590:	85 c0                	test   %eax,%eax
+  804592:	75 24                	jne    8045b8 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804594:	bf 02 00 00 00       	mov    $0x2,%edi
+  804599:	49 89 df             	mov    %rbx,%r15
+  80459c:	48 b8 70 d0 ff ff ff 	movabs $0xffffffffffffd070,%rax
+  8045a3:	ff ff ff 
+  8045a6:	48 01 d8             	add    %rbx,%rax
+  8045a9:	ff d0                	call   *%rax
+  8045ab:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8045b2:	00 00 00 
+  8045b5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  8045b8:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8045bf:	00 00 00 
+  8045c2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8045c5:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8045c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045d4:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8045d9:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8045e0:	00 00 00 
+  8045e3:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8045e7:	89 c7                	mov    %eax,%edi
+  8045e9:	49 89 df             	mov    %rbx,%r15
+  8045ec:	48 b8 8f ca ff ff ff 	movabs $0xffffffffffffca8f,%rax
+  8045f3:	ff ff ff 
+  8045f6:	48 01 d8             	add    %rbx,%rax
+  8045f9:	ff d0                	call   *%rax
+}
+  8045fb:	48 83 c4 10          	add    $0x10,%rsp
+  8045ff:	5b                   	pop    %rbx
+  804600:	41 5f                	pop    %r15
+  804602:	5d                   	pop    %rbp
+  804603:	c3                   	ret
+
+0000000000804604 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804604:	55                   	push   %rbp
+  804605:	48 89 e5             	mov    %rsp,%rbp
+  804608:	41 57                	push   %r15
+  80460a:	53                   	push   %rbx
+  80460b:	48 83 ec 20          	sub    $0x20,%rsp
+  80460f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80460f <nsipc_words+0xb>
+  804616:	49 bb 21 4a 00 00 00 	movabs $0x4a21,%r11
+  80461d:	00 00 00 
+  804620:	4c 01 db             	add    %r11,%rbx
+  804623:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804626:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80462a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80462e:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804635:	00 00 00 
+  804638:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80463b:	85 c0                	test   %eax,%eax
+  80463d:	75 24                	jne    804663 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80463f:	bf 02 00 00 00       	mov    $0x2,%edi
+  804644:	49 89 df             	mov    %rbx,%r15
+  804647:	48 b8 70 d0 ff ff ff 	movabs $0xffffffffffffd070,%rax
+  80464e:	ff ff ff 
+  804651:	48 01 d8             	add    %rbx,%rax
+  804654:	ff d0                	call   *%rax
+  804656:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  80465d:	00 00 00 
+  804660:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804663:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80466a:	00 00 00 
+  80466d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804670:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804674:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804678:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80467b:	89 c7                	mov    %eax,%edi
+  80467d:	49 89 df             	mov    %rbx,%r15
+  804680:	48 b8 7a cb ff ff ff 	movabs $0xffffffffffffcb7a,%rax
+  804687:	ff ff ff 
+  80468a:	48 01 d8             	add    %rbx,%rax
+  80468d:	ff d0                	call   *%rax
+}
+  80468f:	48 83 c4 20          	add    $0x20,%rsp
+  804693:	5b                   	pop    %rbx
+  804694:	41 5f                	pop    %r15
+  804696:	5d                   	pop    %rbp
+  804697:	c3                   	ret
+
+0000000000804698 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804698:	55                   	push   %rbp
+  804699:	48 89 e5             	mov    %rsp,%rbp
+  80469c:	41 57                	push   %r15
+  80469e:	53                   	push   %rbx
+  80469f:	48 83 ec 30          	sub    $0x30,%rsp
+  8046a3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046a3 <nsipc_accept+0xb>
+  8046aa:	49 bb 8d 49 00 00 00 	movabs $0x498d,%r11
+  8046b1:	00 00 00 
+  8046b4:	4c 01 db             	add    %r11,%rbx
+  8046b7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8046ba:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8046be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8046c2:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8046c9:	00 00 00 
+  8046cc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046cf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8046d2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8046d7:	48 b8 31 b5 ff ff ff 	movabs $0xffffffffffffb531,%rax
+  8046de:	ff ff ff 
+  8046e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046e5:	ff d0                	call   *%rax
+  8046e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046ee:	78 48                	js     804738 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8046f0:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  8046f7:	00 00 00 
+  8046fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046fe:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804702:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804706:	8b 40 10             	mov    0x10(%rax),%eax
+  804709:	89 c2                	mov    %eax,%edx
+  80470b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80470f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804713:	48 89 ce             	mov    %rcx,%rsi
+  804716:	48 89 c7             	mov    %rax,%rdi
+  804719:	49 89 df             	mov    %rbx,%r15
+  80471c:	48 b8 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rax
+  804723:	ff ff ff 
+  804726:	48 01 d8             	add    %rbx,%rax
+  804729:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80472b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80472f:	8b 50 10             	mov    0x10(%rax),%edx
+  804732:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804736:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  804738:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80473b:	48 83 c4 30          	add    $0x30,%rsp
+  80473f:	5b                   	pop    %rbx
+  804740:	41 5f                	pop    %r15
+  804742:	5d                   	pop    %rbp
+  804743:	c3                   	ret
+
+0000000000804744 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804744:	55                   	push   %rbp
+  804745:	48 89 e5             	mov    %rsp,%rbp
+  804748:	41 57                	push   %r15
+  80474a:	53                   	push   %rbx
+  80474b:	48 83 ec 10          	sub    $0x10,%rsp
+  80474f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80474f <nsipc_bind+0xb>
+  804756:	49 bb e1 48 00 00 00 	movabs $0x48e1,%r11
+  80475d:	00 00 00 
+  804760:	4c 01 db             	add    %r11,%rbx
+  804763:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804766:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80476a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  80476d:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804774:	00 00 00 
+  804777:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80477a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80477d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804780:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804784:	48 89 c6             	mov    %rax,%rsi
+  804787:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  80478e:	00 00 00 
+  804791:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804795:	48 89 c7             	mov    %rax,%rdi
+  804798:	49 89 df             	mov    %rbx,%r15
+  80479b:	48 b8 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rax
+  8047a2:	ff ff ff 
+  8047a5:	48 01 d8             	add    %rbx,%rax
+  8047a8:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8047aa:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8047b1:	00 00 00 
+  8047b4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8047b7:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8047bb:	bf 02 00 00 00       	mov    $0x2,%edi
+  8047c0:	48 b8 31 b5 ff ff ff 	movabs $0xffffffffffffb531,%rax
+  8047c7:	ff ff ff 
+  8047ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047ce:	ff d0                	call   *%rax
+}
+  8047d0:	48 83 c4 10          	add    $0x10,%rsp
+  8047d4:	5b                   	pop    %rbx
+  8047d5:	41 5f                	pop    %r15
+  8047d7:	5d                   	pop    %rbp
+  8047d8:	c3                   	ret
+
+00000000008047d9 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8047d9:	55                   	push   %rbp
+  8047da:	48 89 e5             	mov    %rsp,%rbp
+  8047dd:	48 83 ec 20          	sub    $0x20,%rsp
+  8047e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8047e1 <nsipc_shutdown+0x8>
+  8047e8:	49 bb 4f 48 00 00 00 	movabs $0x484f,%r11
+  8047ef:	00 00 00 
+  8047f2:	4c 01 d8             	add    %r11,%rax
+  8047f5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8047f8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8047fb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8047fe:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  804801:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804804:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  804807:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80480b:	ba 08 00 00 00       	mov    $0x8,%edx
+  804810:	48 89 ce             	mov    %rcx,%rsi
+  804813:	bf 03 00 00 00       	mov    $0x3,%edi
+  804818:	48 b9 d4 b5 ff ff ff 	movabs $0xffffffffffffb5d4,%rcx
+  80481f:	ff ff ff 
+  804822:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804826:	ff d0                	call   *%rax
+}
+  804828:	c9                   	leave
+  804829:	c3                   	ret
+
+000000000080482a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80482a:	55                   	push   %rbp
+  80482b:	48 89 e5             	mov    %rsp,%rbp
+  80482e:	48 83 ec 20          	sub    $0x20,%rsp
+  804832:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804832 <nsipc_close+0x8>
+  804839:	49 bb fe 47 00 00 00 	movabs $0x47fe,%r11
+  804840:	00 00 00 
+  804843:	4c 01 d8             	add    %r11,%rax
+  804846:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  804849:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80484c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80484f:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804853:	ba 04 00 00 00       	mov    $0x4,%edx
+  804858:	48 89 ce             	mov    %rcx,%rsi
+  80485b:	bf 04 00 00 00       	mov    $0x4,%edi
+  804860:	48 b9 d4 b5 ff ff ff 	movabs $0xffffffffffffb5d4,%rcx
+  804867:	ff ff ff 
+  80486a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80486e:	ff d0                	call   *%rax
+}
+  804870:	c9                   	leave
+  804871:	c3                   	ret
+
+0000000000804872 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804872:	55                   	push   %rbp
+  804873:	48 89 e5             	mov    %rsp,%rbp
+  804876:	41 57                	push   %r15
+  804878:	53                   	push   %rbx
+  804879:	48 83 ec 10          	sub    $0x10,%rsp
+  80487d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80487d <nsipc_connect+0xb>
+  804884:	49 bb b3 47 00 00 00 	movabs $0x47b3,%r11
+  80488b:	00 00 00 
+  80488e:	4c 01 db             	add    %r11,%rbx
+  804891:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804894:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804898:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  80489b:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8048a2:	00 00 00 
+  8048a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048a8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8048ab:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8048ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048b2:	48 89 c6             	mov    %rax,%rsi
+  8048b5:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  8048bc:	00 00 00 
+  8048bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048c3:	48 89 c7             	mov    %rax,%rdi
+  8048c6:	49 89 df             	mov    %rbx,%r15
+  8048c9:	48 b8 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rax
+  8048d0:	ff ff ff 
+  8048d3:	48 01 d8             	add    %rbx,%rax
+  8048d6:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8048d8:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8048df:	00 00 00 
+  8048e2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8048e5:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8048e9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8048ee:	48 b8 31 b5 ff ff ff 	movabs $0xffffffffffffb531,%rax
+  8048f5:	ff ff ff 
+  8048f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048fc:	ff d0                	call   *%rax
+}
+  8048fe:	48 83 c4 10          	add    $0x10,%rsp
+  804902:	5b                   	pop    %rbx
+  804903:	41 5f                	pop    %r15
+  804905:	5d                   	pop    %rbp
+  804906:	c3                   	ret
+
+0000000000804907 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804907:	55                   	push   %rbp
+  804908:	48 89 e5             	mov    %rsp,%rbp
+  80490b:	48 83 ec 20          	sub    $0x20,%rsp
+  80490f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80490f <nsipc_listen+0x8>
+  804916:	49 bb 21 47 00 00 00 	movabs $0x4721,%r11
+  80491d:	00 00 00 
+  804920:	4c 01 d8             	add    %r11,%rax
+  804923:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804926:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804929:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80492c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  80492f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804932:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804935:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804939:	ba 08 00 00 00       	mov    $0x8,%edx
+  80493e:	48 89 ce             	mov    %rcx,%rsi
+  804941:	bf 06 00 00 00       	mov    $0x6,%edi
+  804946:	48 b9 d4 b5 ff ff ff 	movabs $0xffffffffffffb5d4,%rcx
+  80494d:	ff ff ff 
+  804950:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804954:	ff d0                	call   *%rax
+}
+  804956:	c9                   	leave
+  804957:	c3                   	ret
+
+0000000000804958 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  804958:	55                   	push   %rbp
+  804959:	48 89 e5             	mov    %rsp,%rbp
+  80495c:	41 57                	push   %r15
+  80495e:	53                   	push   %rbx
+  80495f:	48 83 ec 30          	sub    $0x30,%rsp
+  804963:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804963 <nsipc_recv+0xb>
+  80496a:	49 bb cd 46 00 00 00 	movabs $0x46cd,%r11
+  804971:	00 00 00 
+  804974:	4c 01 db             	add    %r11,%rbx
+  804977:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80497a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80497e:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  804981:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804984:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80498b:	00 00 00 
+  80498e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804991:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  804994:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80499b:	00 00 00 
+  80499e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8049a1:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8049a5:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8049ac:	00 00 00 
+  8049af:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8049b2:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8049b6:	bf 07 00 00 00       	mov    $0x7,%edi
+  8049bb:	48 b8 31 b5 ff ff ff 	movabs $0xffffffffffffb531,%rax
+  8049c2:	ff ff ff 
+  8049c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049c9:	ff d0                	call   *%rax
+  8049cb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049d2:	0f 88 91 00 00 00    	js     804a69 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8049d8:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8049df:	7f 08                	jg     8049e9 <nsipc_recv+0x91>
+  8049e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049e4:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8049e7:	7e 50                	jle    804a39 <nsipc_recv+0xe1>
+  8049e9:	48 b8 2b dd ff ff ff 	movabs $0xffffffffffffdd2b,%rax
+  8049f0:	ff ff ff 
+  8049f3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049f7:	48 89 c1             	mov    %rax,%rcx
+  8049fa:	48 b8 40 dd ff ff ff 	movabs $0xffffffffffffdd40,%rax
+  804a01:	ff ff ff 
+  804a04:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a08:	48 89 c2             	mov    %rax,%rdx
+  804a0b:	be 79 00 00 00       	mov    $0x79,%esi
+  804a10:	48 b8 55 dd ff ff ff 	movabs $0xffffffffffffdd55,%rax
+  804a17:	ff ff ff 
+  804a1a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a1e:	48 89 c7             	mov    %rax,%rdi
+  804a21:	49 89 df             	mov    %rbx,%r15
+  804a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a29:	49 b8 da c7 ff ff ff 	movabs $0xffffffffffffc7da,%r8
+  804a30:	ff ff ff 
+  804a33:	49 01 d8             	add    %rbx,%r8
+  804a36:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804a39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a3c:	48 63 d0             	movslq %eax,%rdx
+  804a3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a43:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804a4a:	00 00 00 
+  804a4d:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  804a51:	48 89 ce             	mov    %rcx,%rsi
+  804a54:	48 89 c7             	mov    %rax,%rdi
+  804a57:	49 89 df             	mov    %rbx,%r15
+  804a5a:	48 b8 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rax
+  804a61:	ff ff ff 
+  804a64:	48 01 d8             	add    %rbx,%rax
+  804a67:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804a69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804a6c:	48 83 c4 30          	add    $0x30,%rsp
+  804a70:	5b                   	pop    %rbx
+  804a71:	41 5f                	pop    %r15
+  804a73:	5d                   	pop    %rbp
+  804a74:	c3                   	ret
+
+0000000000804a75 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804a75:	55                   	push   %rbp
+  804a76:	48 89 e5             	mov    %rsp,%rbp
+  804a79:	41 57                	push   %r15
+  804a7b:	53                   	push   %rbx
+  804a7c:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804a83:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a83 <nsipc_send+0xe>
+  804a8a:	49 bb ad 45 00 00 00 	movabs $0x45ad,%r11
+  804a91:	00 00 00 
+  804a94:	4c 01 db             	add    %r11,%rbx
+  804a97:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804a9d:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804aa4:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804aaa:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804ab0:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804ab4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804ab8:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804abf:	00 00 00 
+  804ac2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ac5:	85 c0                	test   %eax,%eax
+  804ac7:	75 24                	jne    804aed <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804ac9:	bf 02 00 00 00       	mov    $0x2,%edi
+  804ace:	49 89 df             	mov    %rbx,%r15
+  804ad1:	48 b8 70 d0 ff ff ff 	movabs $0xffffffffffffd070,%rax
+  804ad8:	ff ff ff 
+  804adb:	48 01 d8             	add    %rbx,%rax
+  804ade:	ff d0                	call   *%rax
+  804ae0:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804ae7:	00 00 00 
+  804aea:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804aed:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804af3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804af6:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804afd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804b00:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804b03:	39 c2                	cmp    %eax,%edx
+  804b05:	0f 4e c2             	cmovle %edx,%eax
+  804b08:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804b0e:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804b14:	48 63 d0             	movslq %eax,%rdx
+  804b17:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804b1e:	48 89 c6             	mov    %rax,%rsi
+  804b21:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804b28:	00 00 00 
+  804b2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b2f:	48 89 c7             	mov    %rax,%rdi
+  804b32:	49 89 df             	mov    %rbx,%r15
+  804b35:	48 b8 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rax
+  804b3c:	ff ff ff 
+  804b3f:	48 01 d8             	add    %rbx,%rax
+  804b42:	ff d0                	call   *%rax
+	req->req_s = s;
+  804b44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b48:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804b4e:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b54:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804b5a:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804b5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b61:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804b67:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804b6a:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804b71:	00 00 00 
+  804b74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b78:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804b7c:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804b83:	00 
+  804b84:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804b8a:	48 63 d0             	movslq %eax,%rdx
+  804b8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b91:	48 01 d0             	add    %rdx,%rax
+  804b94:	48 83 e8 01          	sub    $0x1,%rax
+  804b98:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804b9c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ba0:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ba5:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804ba9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bad:	48 29 d0             	sub    %rdx,%rax
+  804bb0:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804bb6:	85 c0                	test   %eax,%eax
+  804bb8:	0f 48 c2             	cmovs  %edx,%eax
+  804bbb:	c1 f8 0c             	sar    $0xc,%eax
+  804bbe:	48 98                	cltq
+  804bc0:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804bc4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804bc8:	48 85 c0             	test   %rax,%rax
+  804bcb:	0f 95 c0             	setne  %al
+  804bce:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804bd1:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804bd8:	00 
+  804bd9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bdd:	48 83 c0 0b          	add    $0xb,%rax
+  804be1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804be5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804be9:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bee:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804bf2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804bf6:	48 29 d0             	sub    %rdx,%rax
+  804bf9:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804bfd:	89 c7                	mov    %eax,%edi
+  804bff:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804c06:	00 00 00 
+  804c09:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c0c:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804c10:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804c14:	48 83 ec 08          	sub    $0x8,%rsp
+  804c18:	6a 00                	push   $0x0
+  804c1a:	6a 00                	push   $0x0
+  804c1c:	6a 05                	push   $0x5
+  804c1e:	41 89 f1             	mov    %esi,%r9d
+  804c21:	49 89 c8             	mov    %rcx,%r8
+  804c24:	89 f9                	mov    %edi,%ecx
+  804c26:	be 08 00 00 00       	mov    $0x8,%esi
+  804c2b:	89 c7                	mov    %eax,%edi
+  804c2d:	49 89 df             	mov    %rbx,%r15
+  804c30:	48 b8 78 cc ff ff ff 	movabs $0xffffffffffffcc78,%rax
+  804c37:	ff ff ff 
+  804c3a:	48 01 d8             	add    %rbx,%rax
+  804c3d:	ff d0                	call   *%rax
+  804c3f:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804c43:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804c47:	5b                   	pop    %rbx
+  804c48:	41 5f                	pop    %r15
+  804c4a:	5d                   	pop    %rbp
+  804c4b:	c3                   	ret
+
+0000000000804c4c <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804c4c:	55                   	push   %rbp
+  804c4d:	48 89 e5             	mov    %rsp,%rbp
+  804c50:	48 83 ec 10          	sub    $0x10,%rsp
+  804c54:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c54 <nsipc_socket+0x8>
+  804c5b:	49 bb dc 43 00 00 00 	movabs $0x43dc,%r11
+  804c62:	00 00 00 
+  804c65:	4c 01 d8             	add    %r11,%rax
+  804c68:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804c6b:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804c6e:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804c71:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804c78:	00 00 00 
+  804c7b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804c7e:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804c81:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804c88:	00 00 00 
+  804c8b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804c8e:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804c92:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804c99:	00 00 00 
+  804c9c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804c9f:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804ca3:	bf 09 00 00 00       	mov    $0x9,%edi
+  804ca8:	48 ba 31 b5 ff ff ff 	movabs $0xffffffffffffb531,%rdx
+  804caf:	ff ff ff 
+  804cb2:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804cb6:	ff d0                	call   *%rax
+}
+  804cb8:	c9                   	leave
+  804cb9:	c3                   	ret
+
+0000000000804cba <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804cba:	55                   	push   %rbp
+  804cbb:	48 89 e5             	mov    %rsp,%rbp
+  804cbe:	41 57                	push   %r15
+  804cc0:	53                   	push   %rbx
+  804cc1:	48 83 ec 30          	sub    $0x30,%rsp
+  804cc5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cc5 <pipe+0xb>
+  804ccc:	49 bb 6b 43 00 00 00 	movabs $0x436b,%r11
+  804cd3:	00 00 00 
+  804cd6:	4c 01 db             	add    %r11,%rbx
+  804cd9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804cdd:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804ce1:	48 89 c7             	mov    %rax,%rdi
+  804ce4:	49 89 df             	mov    %rbx,%r15
+  804ce7:	48 b8 4b 99 ff ff ff 	movabs $0xffffffffffff994b,%rax
+  804cee:	ff ff ff 
+  804cf1:	48 01 d8             	add    %rbx,%rax
+  804cf4:	ff d0                	call   *%rax
+  804cf6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cf9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cfd:	0f 88 12 02 00 00    	js     804f15 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804d03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d07:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d0c:	48 89 c6             	mov    %rax,%rsi
+  804d0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d14:	49 89 df             	mov    %rbx,%r15
+  804d17:	48 b8 28 91 ff ff ff 	movabs $0xffffffffffff9128,%rax
+  804d1e:	ff ff ff 
+  804d21:	48 01 d8             	add    %rbx,%rax
+  804d24:	ff d0                	call   *%rax
+  804d26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d2d:	0f 88 e2 01 00 00    	js     804f15 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804d33:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804d37:	48 89 c7             	mov    %rax,%rdi
+  804d3a:	49 89 df             	mov    %rbx,%r15
+  804d3d:	48 b8 4b 99 ff ff ff 	movabs $0xffffffffffff994b,%rax
+  804d44:	ff ff ff 
+  804d47:	48 01 d8             	add    %rbx,%rax
+  804d4a:	ff d0                	call   *%rax
+  804d4c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d4f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d53:	0f 88 9b 01 00 00    	js     804ef4 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804d59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d5d:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d62:	48 89 c6             	mov    %rax,%rsi
+  804d65:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d6a:	49 89 df             	mov    %rbx,%r15
+  804d6d:	48 b8 28 91 ff ff ff 	movabs $0xffffffffffff9128,%rax
+  804d74:	ff ff ff 
+  804d77:	48 01 d8             	add    %rbx,%rax
+  804d7a:	ff d0                	call   *%rax
+  804d7c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d7f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d83:	0f 88 6b 01 00 00    	js     804ef4 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804d89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d8d:	48 89 c7             	mov    %rax,%rdi
+  804d90:	49 89 df             	mov    %rbx,%r15
+  804d93:	48 b8 08 99 ff ff ff 	movabs $0xffffffffffff9908,%rax
+  804d9a:	ff ff ff 
+  804d9d:	48 01 d8             	add    %rbx,%rax
+  804da0:	ff d0                	call   *%rax
+  804da2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804da6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804daa:	ba 07 04 00 00       	mov    $0x407,%edx
+  804daf:	48 89 c6             	mov    %rax,%rsi
+  804db2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804db7:	49 89 df             	mov    %rbx,%r15
+  804dba:	48 b8 28 91 ff ff ff 	movabs $0xffffffffffff9128,%rax
+  804dc1:	ff ff ff 
+  804dc4:	48 01 d8             	add    %rbx,%rax
+  804dc7:	ff d0                	call   *%rax
+  804dc9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804dcc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804dd0:	0f 88 fd 00 00 00    	js     804ed3 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804dd6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804dda:	48 89 c7             	mov    %rax,%rdi
+  804ddd:	49 89 df             	mov    %rbx,%r15
+  804de0:	48 b8 08 99 ff ff ff 	movabs $0xffffffffffff9908,%rax
+  804de7:	ff ff ff 
+  804dea:	48 01 d8             	add    %rbx,%rax
+  804ded:	ff d0                	call   *%rax
+  804def:	48 89 c2             	mov    %rax,%rdx
+  804df2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804df6:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804dfc:	48 89 d1             	mov    %rdx,%rcx
+  804dff:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e04:	48 89 c6             	mov    %rax,%rsi
+  804e07:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e0c:	49 89 df             	mov    %rbx,%r15
+  804e0f:	48 b8 8d 91 ff ff ff 	movabs $0xffffffffffff918d,%rax
+  804e16:	ff ff ff 
+  804e19:	48 01 d8             	add    %rbx,%rax
+  804e1c:	ff d0                	call   *%rax
+  804e1e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e21:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e25:	0f 88 87 00 00 00    	js     804eb2 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804e2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e2f:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804e36:	00 00 00 
+  804e39:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804e3c:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804e3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e42:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804e49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e4d:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804e54:	00 00 00 
+  804e57:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804e5a:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804e5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e60:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804e67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e6b:	48 89 c7             	mov    %rax,%rdi
+  804e6e:	49 89 df             	mov    %rbx,%r15
+  804e71:	48 b8 d1 98 ff ff ff 	movabs $0xffffffffffff98d1,%rax
+  804e78:	ff ff ff 
+  804e7b:	48 01 d8             	add    %rbx,%rax
+  804e7e:	ff d0                	call   *%rax
+  804e80:	89 c2                	mov    %eax,%edx
+  804e82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e86:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804e88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e8c:	48 89 c7             	mov    %rax,%rdi
+  804e8f:	49 89 df             	mov    %rbx,%r15
+  804e92:	48 b8 d1 98 ff ff ff 	movabs $0xffffffffffff98d1,%rax
+  804e99:	ff ff ff 
+  804e9c:	48 01 d8             	add    %rbx,%rax
+  804e9f:	ff d0                	call   *%rax
+  804ea1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ea5:	48 83 c2 04          	add    $0x4,%rdx
+  804ea9:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eb0:	eb 67                	jmp    804f19 <pipe+0x25f>
+		goto err3;
+  804eb2:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804eb3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804eb7:	48 89 c6             	mov    %rax,%rsi
+  804eba:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ebf:	49 89 df             	mov    %rbx,%r15
+  804ec2:	48 b8 00 92 ff ff ff 	movabs $0xffffffffffff9200,%rax
+  804ec9:	ff ff ff 
+  804ecc:	48 01 d8             	add    %rbx,%rax
+  804ecf:	ff d0                	call   *%rax
+  804ed1:	eb 01                	jmp    804ed4 <pipe+0x21a>
+		goto err2;
+  804ed3:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804ed4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ed8:	48 89 c6             	mov    %rax,%rsi
+  804edb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ee0:	49 89 df             	mov    %rbx,%r15
+  804ee3:	48 b8 00 92 ff ff ff 	movabs $0xffffffffffff9200,%rax
+  804eea:	ff ff ff 
+  804eed:	48 01 d8             	add    %rbx,%rax
+  804ef0:	ff d0                	call   *%rax
+  804ef2:	eb 01                	jmp    804ef5 <pipe+0x23b>
+		goto err1;
+  804ef4:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804ef5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ef9:	48 89 c6             	mov    %rax,%rsi
+  804efc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f01:	49 89 df             	mov    %rbx,%r15
+  804f04:	48 b8 00 92 ff ff ff 	movabs $0xffffffffffff9200,%rax
+  804f0b:	ff ff ff 
+  804f0e:	48 01 d8             	add    %rbx,%rax
+  804f11:	ff d0                	call   *%rax
+  804f13:	eb 01                	jmp    804f16 <pipe+0x25c>
+		goto err;
+  804f15:	90                   	nop
+err:
+	return r;
+  804f16:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804f19:	48 83 c4 30          	add    $0x30,%rsp
+  804f1d:	5b                   	pop    %rbx
+  804f1e:	41 5f                	pop    %r15
+  804f20:	5d                   	pop    %rbp
+  804f21:	c3                   	ret
+
+0000000000804f22 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804f22:	55                   	push   %rbp
+  804f23:	48 89 e5             	mov    %rsp,%rbp
+  804f26:	41 57                	push   %r15
+  804f28:	41 54                	push   %r12
+  804f2a:	53                   	push   %rbx
+  804f2b:	48 83 ec 28          	sub    $0x28,%rsp
+  804f2f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f2f <_pipeisclosed+0xd>
+  804f36:	49 bb 01 41 00 00 00 	movabs $0x4101,%r11
+  804f3d:	00 00 00 
+  804f40:	4c 01 db             	add    %r11,%rbx
+  804f43:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804f47:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804f4b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804f52:	ff ff ff 
+  804f55:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f59:	48 8b 00             	mov    (%rax),%rax
+  804f5c:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804f62:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  804f65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f69:	48 89 c7             	mov    %rax,%rdi
+  804f6c:	49 89 df             	mov    %rbx,%r15
+  804f6f:	48 b8 ff d0 ff ff ff 	movabs $0xffffffffffffd0ff,%rax
+  804f76:	ff ff ff 
+  804f79:	48 01 d8             	add    %rbx,%rax
+  804f7c:	ff d0                	call   *%rax
+  804f7e:	41 89 c4             	mov    %eax,%r12d
+  804f81:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f85:	48 89 c7             	mov    %rax,%rdi
+  804f88:	49 89 df             	mov    %rbx,%r15
+  804f8b:	48 b8 ff d0 ff ff ff 	movabs $0xffffffffffffd0ff,%rax
+  804f92:	ff ff ff 
+  804f95:	48 01 d8             	add    %rbx,%rax
+  804f98:	ff d0                	call   *%rax
+  804f9a:	41 39 c4             	cmp    %eax,%r12d
+  804f9d:	0f 94 c0             	sete   %al
+  804fa0:	0f b6 c0             	movzbl %al,%eax
+  804fa3:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  804fa6:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804fad:	ff ff ff 
+  804fb0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804fb4:	48 8b 00             	mov    (%rax),%rax
+  804fb7:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804fbd:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  804fc0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fc3:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804fc6:	75 05                	jne    804fcd <_pipeisclosed+0xab>
+			return ret;
+  804fc8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804fcb:	eb 63                	jmp    805030 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  804fcd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fd0:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804fd3:	0f 84 72 ff ff ff    	je     804f4b <_pipeisclosed+0x29>
+  804fd9:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  804fdd:	0f 85 68 ff ff ff    	jne    804f4b <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804fe3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804fea:	ff ff ff 
+  804fed:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804ff1:	48 8b 00             	mov    (%rax),%rax
+  804ff4:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  804ffa:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804ffd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805000:	89 c6                	mov    %eax,%esi
+  805002:	48 b8 66 dd ff ff ff 	movabs $0xffffffffffffdd66,%rax
+  805009:	ff ff ff 
+  80500c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805010:	48 89 c7             	mov    %rax,%rdi
+  805013:	49 89 df             	mov    %rbx,%r15
+  805016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80501b:	49 b8 aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%r8
+  805022:	ff ff ff 
+  805025:	49 01 d8             	add    %rbx,%r8
+  805028:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  80502b:	e9 1b ff ff ff       	jmp    804f4b <_pipeisclosed+0x29>
+	}
+}
+  805030:	48 83 c4 28          	add    $0x28,%rsp
+  805034:	5b                   	pop    %rbx
+  805035:	41 5c                	pop    %r12
+  805037:	41 5f                	pop    %r15
+  805039:	5d                   	pop    %rbp
+  80503a:	c3                   	ret
+
+000000000080503b <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  80503b:	55                   	push   %rbp
+  80503c:	48 89 e5             	mov    %rsp,%rbp
+  80503f:	41 57                	push   %r15
+  805041:	53                   	push   %rbx
+  805042:	48 83 ec 30          	sub    $0x30,%rsp
+  805046:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805046 <pipeisclosed+0xb>
+  80504d:	49 bb ea 3f 00 00 00 	movabs $0x3fea,%r11
+  805054:	00 00 00 
+  805057:	4c 01 db             	add    %r11,%rbx
+  80505a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80505d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805061:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805064:	48 89 d6             	mov    %rdx,%rsi
+  805067:	89 c7                	mov    %eax,%edi
+  805069:	49 89 df             	mov    %rbx,%r15
+  80506c:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  805073:	ff ff ff 
+  805076:	48 01 d8             	add    %rbx,%rax
+  805079:	ff d0                	call   *%rax
+  80507b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80507e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805082:	79 05                	jns    805089 <pipeisclosed+0x4e>
+		return r;
+  805084:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805087:	eb 3b                	jmp    8050c4 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805089:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80508d:	48 89 c7             	mov    %rax,%rdi
+  805090:	49 89 df             	mov    %rbx,%r15
+  805093:	48 b8 08 99 ff ff ff 	movabs $0xffffffffffff9908,%rax
+  80509a:	ff ff ff 
+  80509d:	48 01 d8             	add    %rbx,%rax
+  8050a0:	ff d0                	call   *%rax
+  8050a2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  8050a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050aa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8050ae:	48 89 d6             	mov    %rdx,%rsi
+  8050b1:	48 89 c7             	mov    %rax,%rdi
+  8050b4:	48 b8 f2 be ff ff ff 	movabs $0xffffffffffffbef2,%rax
+  8050bb:	ff ff ff 
+  8050be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050c2:	ff d0                	call   *%rax
+}
+  8050c4:	48 83 c4 30          	add    $0x30,%rsp
+  8050c8:	5b                   	pop    %rbx
+  8050c9:	41 5f                	pop    %r15
+  8050cb:	5d                   	pop    %rbp
+  8050cc:	c3                   	ret
+
+00000000008050cd <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8050cd:	55                   	push   %rbp
+  8050ce:	48 89 e5             	mov    %rsp,%rbp
+  8050d1:	41 57                	push   %r15
+  8050d3:	53                   	push   %rbx
+  8050d4:	48 83 ec 40          	sub    $0x40,%rsp
+  8050d8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050d8 <devpipe_read+0xb>
+  8050df:	49 bb 58 3f 00 00 00 	movabs $0x3f58,%r11
+  8050e6:	00 00 00 
+  8050e9:	4c 01 db             	add    %r11,%rbx
+  8050ec:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8050f0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8050f4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8050f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050fc:	48 89 c7             	mov    %rax,%rdi
+  8050ff:	49 89 df             	mov    %rbx,%r15
+  805102:	48 b8 08 99 ff ff ff 	movabs $0xffffffffffff9908,%rax
+  805109:	ff ff ff 
+  80510c:	48 01 d8             	add    %rbx,%rax
+  80510f:	ff d0                	call   *%rax
+  805111:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805115:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805119:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80511d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805124:	00 
+  805125:	e9 a1 00 00 00       	jmp    8051cb <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  80512a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80512f:	74 09                	je     80513a <devpipe_read+0x6d>
+				return i;
+  805131:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805135:	e9 9f 00 00 00       	jmp    8051d9 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  80513a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80513e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805142:	48 89 d6             	mov    %rdx,%rsi
+  805145:	48 89 c7             	mov    %rax,%rdi
+  805148:	48 b8 f2 be ff ff ff 	movabs $0xffffffffffffbef2,%rax
+  80514f:	ff ff ff 
+  805152:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805156:	ff d0                	call   *%rax
+  805158:	85 c0                	test   %eax,%eax
+  80515a:	74 07                	je     805163 <devpipe_read+0x96>
+				return 0;
+  80515c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805161:	eb 76                	jmp    8051d9 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805163:	49 89 df             	mov    %rbx,%r15
+  805166:	48 b8 d3 90 ff ff ff 	movabs $0xffffffffffff90d3,%rax
+  80516d:	ff ff ff 
+  805170:	48 01 d8             	add    %rbx,%rax
+  805173:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805175:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805179:	8b 10                	mov    (%rax),%edx
+  80517b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80517f:	8b 40 04             	mov    0x4(%rax),%eax
+  805182:	39 c2                	cmp    %eax,%edx
+  805184:	74 a4                	je     80512a <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805186:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80518a:	8b 10                	mov    (%rax),%edx
+  80518c:	89 d0                	mov    %edx,%eax
+  80518e:	c1 f8 1f             	sar    $0x1f,%eax
+  805191:	c1 e8 1b             	shr    $0x1b,%eax
+  805194:	01 c2                	add    %eax,%edx
+  805196:	83 e2 1f             	and    $0x1f,%edx
+  805199:	29 c2                	sub    %eax,%edx
+  80519b:	89 d6                	mov    %edx,%esi
+  80519d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8051a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051a5:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8051a9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051ad:	48 63 c6             	movslq %esi,%rax
+  8051b0:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  8051b5:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  8051b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051bb:	8b 00                	mov    (%rax),%eax
+  8051bd:	8d 50 01             	lea    0x1(%rax),%edx
+  8051c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051c4:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  8051c6:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8051cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051cf:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8051d3:	72 a0                	jb     805175 <devpipe_read+0xa8>
+	}
+	return i;
+  8051d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8051d9:	48 83 c4 40          	add    $0x40,%rsp
+  8051dd:	5b                   	pop    %rbx
+  8051de:	41 5f                	pop    %r15
+  8051e0:	5d                   	pop    %rbp
+  8051e1:	c3                   	ret
+
+00000000008051e2 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8051e2:	55                   	push   %rbp
+  8051e3:	48 89 e5             	mov    %rsp,%rbp
+  8051e6:	41 57                	push   %r15
+  8051e8:	53                   	push   %rbx
+  8051e9:	48 83 ec 40          	sub    $0x40,%rsp
+  8051ed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051ed <devpipe_write+0xb>
+  8051f4:	49 bb 43 3e 00 00 00 	movabs $0x3e43,%r11
+  8051fb:	00 00 00 
+  8051fe:	4c 01 db             	add    %r11,%rbx
+  805201:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805205:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805209:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80520d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805211:	48 89 c7             	mov    %rax,%rdi
+  805214:	49 89 df             	mov    %rbx,%r15
+  805217:	48 b8 08 99 ff ff ff 	movabs $0xffffffffffff9908,%rax
+  80521e:	ff ff ff 
+  805221:	48 01 d8             	add    %rbx,%rax
+  805224:	ff d0                	call   *%rax
+  805226:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80522a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80522e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805232:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805239:	00 
+  80523a:	e9 a0 00 00 00       	jmp    8052df <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80523f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805243:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805247:	48 89 d6             	mov    %rdx,%rsi
+  80524a:	48 89 c7             	mov    %rax,%rdi
+  80524d:	48 b8 f2 be ff ff ff 	movabs $0xffffffffffffbef2,%rax
+  805254:	ff ff ff 
+  805257:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80525b:	ff d0                	call   *%rax
+  80525d:	85 c0                	test   %eax,%eax
+  80525f:	74 0a                	je     80526b <devpipe_write+0x89>
+				return 0;
+  805261:	b8 00 00 00 00       	mov    $0x0,%eax
+  805266:	e9 82 00 00 00       	jmp    8052ed <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  80526b:	49 89 df             	mov    %rbx,%r15
+  80526e:	48 b8 d3 90 ff ff ff 	movabs $0xffffffffffff90d3,%rax
+  805275:	ff ff ff 
+  805278:	48 01 d8             	add    %rbx,%rax
+  80527b:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80527d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805281:	8b 40 04             	mov    0x4(%rax),%eax
+  805284:	48 63 d0             	movslq %eax,%rdx
+  805287:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80528b:	8b 00                	mov    (%rax),%eax
+  80528d:	48 98                	cltq
+  80528f:	48 83 c0 20          	add    $0x20,%rax
+  805293:	48 39 c2             	cmp    %rax,%rdx
+  805296:	73 a7                	jae    80523f <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805298:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80529c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052a0:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8052a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052a8:	8b 50 04             	mov    0x4(%rax),%edx
+  8052ab:	89 d0                	mov    %edx,%eax
+  8052ad:	c1 f8 1f             	sar    $0x1f,%eax
+  8052b0:	c1 e8 1b             	shr    $0x1b,%eax
+  8052b3:	01 c2                	add    %eax,%edx
+  8052b5:	83 e2 1f             	and    $0x1f,%edx
+  8052b8:	29 c2                	sub    %eax,%edx
+  8052ba:	89 d0                	mov    %edx,%eax
+  8052bc:	0f b6 09             	movzbl (%rcx),%ecx
+  8052bf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8052c3:	48 98                	cltq
+  8052c5:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  8052c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052cd:	8b 40 04             	mov    0x4(%rax),%eax
+  8052d0:	8d 50 01             	lea    0x1(%rax),%edx
+  8052d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052d7:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8052da:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8052df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052e3:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8052e7:	72 94                	jb     80527d <devpipe_write+0x9b>
+	}
+
+	return i;
+  8052e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8052ed:	48 83 c4 40          	add    $0x40,%rsp
+  8052f1:	5b                   	pop    %rbx
+  8052f2:	41 5f                	pop    %r15
+  8052f4:	5d                   	pop    %rbp
+  8052f5:	c3                   	ret
+
+00000000008052f6 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8052f6:	55                   	push   %rbp
+  8052f7:	48 89 e5             	mov    %rsp,%rbp
+  8052fa:	41 57                	push   %r15
+  8052fc:	53                   	push   %rbx
+  8052fd:	48 83 ec 20          	sub    $0x20,%rsp
+  805301:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805301 <devpipe_stat+0xb>
+  805308:	49 bb 2f 3d 00 00 00 	movabs $0x3d2f,%r11
+  80530f:	00 00 00 
+  805312:	4c 01 db             	add    %r11,%rbx
+  805315:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805319:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80531d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805321:	48 89 c7             	mov    %rax,%rdi
+  805324:	49 89 df             	mov    %rbx,%r15
+  805327:	48 b8 08 99 ff ff ff 	movabs $0xffffffffffff9908,%rax
+  80532e:	ff ff ff 
+  805331:	48 01 d8             	add    %rbx,%rax
+  805334:	ff d0                	call   *%rax
+  805336:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  80533a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80533e:	48 ba 79 dd ff ff ff 	movabs $0xffffffffffffdd79,%rdx
+  805345:	ff ff ff 
+  805348:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80534c:	48 89 d6             	mov    %rdx,%rsi
+  80534f:	48 89 c7             	mov    %rax,%rdi
+  805352:	49 89 df             	mov    %rbx,%r15
+  805355:	48 b8 6c 84 ff ff ff 	movabs $0xffffffffffff846c,%rax
+  80535c:	ff ff ff 
+  80535f:	48 01 d8             	add    %rbx,%rax
+  805362:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805364:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805368:	8b 50 04             	mov    0x4(%rax),%edx
+  80536b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80536f:	8b 00                	mov    (%rax),%eax
+  805371:	29 c2                	sub    %eax,%edx
+  805373:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805377:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  80537d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805381:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805388:	00 00 00 
+	stat->st_dev = &devpipe;
+  80538b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80538f:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805396:	00 00 00 
+  805399:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80539d:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8053a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8053a9:	48 83 c4 20          	add    $0x20,%rsp
+  8053ad:	5b                   	pop    %rbx
+  8053ae:	41 5f                	pop    %r15
+  8053b0:	5d                   	pop    %rbp
+  8053b1:	c3                   	ret
+
+00000000008053b2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8053b2:	55                   	push   %rbp
+  8053b3:	48 89 e5             	mov    %rsp,%rbp
+  8053b6:	41 57                	push   %r15
+  8053b8:	53                   	push   %rbx
+  8053b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8053bd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053bd <devpipe_close+0xb>
+  8053c4:	49 bb 73 3c 00 00 00 	movabs $0x3c73,%r11
+  8053cb:	00 00 00 
+  8053ce:	4c 01 db             	add    %r11,%rbx
+  8053d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8053d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053d9:	48 89 c6             	mov    %rax,%rsi
+  8053dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053e1:	49 89 df             	mov    %rbx,%r15
+  8053e4:	48 b8 00 92 ff ff ff 	movabs $0xffffffffffff9200,%rax
+  8053eb:	ff ff ff 
+  8053ee:	48 01 d8             	add    %rbx,%rax
+  8053f1:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8053f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053f7:	48 89 c7             	mov    %rax,%rdi
+  8053fa:	49 89 df             	mov    %rbx,%r15
+  8053fd:	48 b8 08 99 ff ff ff 	movabs $0xffffffffffff9908,%rax
+  805404:	ff ff ff 
+  805407:	48 01 d8             	add    %rbx,%rax
+  80540a:	ff d0                	call   *%rax
+  80540c:	48 89 c6             	mov    %rax,%rsi
+  80540f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805414:	49 89 df             	mov    %rbx,%r15
+  805417:	48 b8 00 92 ff ff ff 	movabs $0xffffffffffff9200,%rax
+  80541e:	ff ff ff 
+  805421:	48 01 d8             	add    %rbx,%rax
+  805424:	ff d0                	call   *%rax
+}
+  805426:	48 83 c4 10          	add    $0x10,%rsp
+  80542a:	5b                   	pop    %rbx
+  80542b:	41 5f                	pop    %r15
+  80542d:	5d                   	pop    %rbp
+  80542e:	c3                   	ret
+
+000000000080542f <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80542f:	55                   	push   %rbp
+  805430:	48 89 e5             	mov    %rsp,%rbp
+  805433:	41 57                	push   %r15
+  805435:	48 83 ec 28          	sub    $0x28,%rsp
+  805439:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805439 <cputchar+0xa>
+  805440:	49 bb f7 3b 00 00 00 	movabs $0x3bf7,%r11
+  805447:	00 00 00 
+  80544a:	4c 01 d8             	add    %r11,%rax
+  80544d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  805450:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805453:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  805456:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  80545a:	be 01 00 00 00       	mov    $0x1,%esi
+  80545f:	48 89 d7             	mov    %rdx,%rdi
+  805462:	49 89 c7             	mov    %rax,%r15
+  805465:	48 ba 70 8f ff ff ff 	movabs $0xffffffffffff8f70,%rdx
+  80546c:	ff ff ff 
+  80546f:	48 01 c2             	add    %rax,%rdx
+  805472:	ff d2                	call   *%rdx
+}
+  805474:	90                   	nop
+  805475:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805479:	c9                   	leave
+  80547a:	c3                   	ret
+
+000000000080547b <getchar>:
+
+int
+getchar(void)
+{
+  80547b:	55                   	push   %rbp
+  80547c:	48 89 e5             	mov    %rsp,%rbp
+  80547f:	41 57                	push   %r15
+  805481:	48 83 ec 18          	sub    $0x18,%rsp
+  805485:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805485 <getchar+0xa>
+  80548c:	49 bb ab 3b 00 00 00 	movabs $0x3bab,%r11
+  805493:	00 00 00 
+  805496:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805499:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80549d:	ba 01 00 00 00       	mov    $0x1,%edx
+  8054a2:	48 89 ce             	mov    %rcx,%rsi
+  8054a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054aa:	49 89 c7             	mov    %rax,%r15
+  8054ad:	48 b9 48 9f ff ff ff 	movabs $0xffffffffffff9f48,%rcx
+  8054b4:	ff ff ff 
+  8054b7:	48 01 c1             	add    %rax,%rcx
+  8054ba:	ff d1                	call   *%rcx
+  8054bc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8054bf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054c3:	79 05                	jns    8054ca <getchar+0x4f>
+		return r;
+  8054c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054c8:	eb 14                	jmp    8054de <getchar+0x63>
+	if (r < 1)
+  8054ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054ce:	7f 07                	jg     8054d7 <getchar+0x5c>
+		return -E_EOF;
+  8054d0:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8054d5:	eb 07                	jmp    8054de <getchar+0x63>
+	return c;
+  8054d7:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8054db:	0f b6 c0             	movzbl %al,%eax
+}
+  8054de:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8054e2:	c9                   	leave
+  8054e3:	c3                   	ret
+
+00000000008054e4 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8054e4:	55                   	push   %rbp
+  8054e5:	48 89 e5             	mov    %rsp,%rbp
+  8054e8:	41 57                	push   %r15
+  8054ea:	53                   	push   %rbx
+  8054eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8054ef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054ef <iscons+0xb>
+  8054f6:	49 bb 41 3b 00 00 00 	movabs $0x3b41,%r11
+  8054fd:	00 00 00 
+  805500:	4c 01 db             	add    %r11,%rbx
+  805503:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805506:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80550a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80550d:	48 89 d6             	mov    %rdx,%rsi
+  805510:	89 c7                	mov    %eax,%edi
+  805512:	49 89 df             	mov    %rbx,%r15
+  805515:	48 b8 01 9a ff ff ff 	movabs $0xffffffffffff9a01,%rax
+  80551c:	ff ff ff 
+  80551f:	48 01 d8             	add    %rbx,%rax
+  805522:	ff d0                	call   *%rax
+  805524:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805527:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80552b:	79 05                	jns    805532 <iscons+0x4e>
+		return r;
+  80552d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805530:	eb 1b                	jmp    80554d <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  805532:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805536:	8b 10                	mov    (%rax),%edx
+  805538:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  80553f:	00 00 00 
+  805542:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805545:	39 c2                	cmp    %eax,%edx
+  805547:	0f 94 c0             	sete   %al
+  80554a:	0f b6 c0             	movzbl %al,%eax
+}
+  80554d:	48 83 c4 20          	add    $0x20,%rsp
+  805551:	5b                   	pop    %rbx
+  805552:	41 5f                	pop    %r15
+  805554:	5d                   	pop    %rbp
+  805555:	c3                   	ret
+
+0000000000805556 <opencons>:
+
+int
+opencons(void)
+{
+  805556:	55                   	push   %rbp
+  805557:	48 89 e5             	mov    %rsp,%rbp
+  80555a:	41 57                	push   %r15
+  80555c:	53                   	push   %rbx
+  80555d:	48 83 ec 10          	sub    $0x10,%rsp
+  805561:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805561 <opencons+0xb>
+  805568:	49 bb cf 3a 00 00 00 	movabs $0x3acf,%r11
+  80556f:	00 00 00 
+  805572:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805575:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805579:	48 89 c7             	mov    %rax,%rdi
+  80557c:	49 89 df             	mov    %rbx,%r15
+  80557f:	48 b8 4b 99 ff ff ff 	movabs $0xffffffffffff994b,%rax
+  805586:	ff ff ff 
+  805589:	48 01 d8             	add    %rbx,%rax
+  80558c:	ff d0                	call   *%rax
+  80558e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805591:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805595:	79 05                	jns    80559c <opencons+0x46>
+		return r;
+  805597:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80559a:	eb 68                	jmp    805604 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80559c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055a0:	ba 07 04 00 00       	mov    $0x407,%edx
+  8055a5:	48 89 c6             	mov    %rax,%rsi
+  8055a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055ad:	49 89 df             	mov    %rbx,%r15
+  8055b0:	48 b8 28 91 ff ff ff 	movabs $0xffffffffffff9128,%rax
+  8055b7:	ff ff ff 
+  8055ba:	48 01 d8             	add    %rbx,%rax
+  8055bd:	ff d0                	call   *%rax
+  8055bf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055c6:	79 05                	jns    8055cd <opencons+0x77>
+		return r;
+  8055c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055cb:	eb 37                	jmp    805604 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8055cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055d1:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  8055d8:	00 00 00 
+  8055db:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8055de:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8055e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055e4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8055eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055ef:	48 89 c7             	mov    %rax,%rdi
+  8055f2:	49 89 df             	mov    %rbx,%r15
+  8055f5:	48 b8 d1 98 ff ff ff 	movabs $0xffffffffffff98d1,%rax
+  8055fc:	ff ff ff 
+  8055ff:	48 01 d8             	add    %rbx,%rax
+  805602:	ff d0                	call   *%rax
+}
+  805604:	48 83 c4 10          	add    $0x10,%rsp
+  805608:	5b                   	pop    %rbx
+  805609:	41 5f                	pop    %r15
+  80560b:	5d                   	pop    %rbp
+  80560c:	c3                   	ret
+
+000000000080560d <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80560d:	55                   	push   %rbp
+  80560e:	48 89 e5             	mov    %rsp,%rbp
+  805611:	41 57                	push   %r15
+  805613:	53                   	push   %rbx
+  805614:	48 83 ec 30          	sub    $0x30,%rsp
+  805618:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805618 <devcons_read+0xb>
+  80561f:	49 bb 18 3a 00 00 00 	movabs $0x3a18,%r11
+  805626:	00 00 00 
+  805629:	4c 01 db             	add    %r11,%rbx
+  80562c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805630:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805634:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  805638:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80563d:	75 19                	jne    805658 <devcons_read+0x4b>
+		return 0;
+  80563f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805644:	eb 55                	jmp    80569b <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  805646:	49 89 df             	mov    %rbx,%r15
+  805649:	48 b8 d3 90 ff ff ff 	movabs $0xffffffffffff90d3,%rax
+  805650:	ff ff ff 
+  805653:	48 01 d8             	add    %rbx,%rax
+  805656:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  805658:	49 89 df             	mov    %rbx,%r15
+  80565b:	48 b8 cf 8f ff ff ff 	movabs $0xffffffffffff8fcf,%rax
+  805662:	ff ff ff 
+  805665:	48 01 d8             	add    %rbx,%rax
+  805668:	ff d0                	call   *%rax
+  80566a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80566d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805671:	74 d3                	je     805646 <devcons_read+0x39>
+	if (c < 0)
+  805673:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805677:	79 05                	jns    80567e <devcons_read+0x71>
+		return c;
+  805679:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80567c:	eb 1d                	jmp    80569b <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  80567e:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  805682:	75 07                	jne    80568b <devcons_read+0x7e>
+		return 0;
+  805684:	b8 00 00 00 00       	mov    $0x0,%eax
+  805689:	eb 10                	jmp    80569b <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  80568b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80568e:	89 c2                	mov    %eax,%edx
+  805690:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805694:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805696:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80569b:	48 83 c4 30          	add    $0x30,%rsp
+  80569f:	5b                   	pop    %rbx
+  8056a0:	41 5f                	pop    %r15
+  8056a2:	5d                   	pop    %rbp
+  8056a3:	c3                   	ret
+
+00000000008056a4 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8056a4:	55                   	push   %rbp
+  8056a5:	48 89 e5             	mov    %rsp,%rbp
+  8056a8:	41 57                	push   %r15
+  8056aa:	53                   	push   %rbx
+  8056ab:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8056b2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056b2 <devcons_write+0xe>
+  8056b9:	49 bb 7e 39 00 00 00 	movabs $0x397e,%r11
+  8056c0:	00 00 00 
+  8056c3:	4c 01 db             	add    %r11,%rbx
+  8056c6:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8056cd:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8056d4:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8056db:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8056e2:	e9 80 00 00 00       	jmp    805767 <devcons_write+0xc3>
+		m = n - tot;
+  8056e7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8056ee:	89 c2                	mov    %eax,%edx
+  8056f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056f3:	29 c2                	sub    %eax,%edx
+  8056f5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8056f8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8056fb:	83 f8 7f             	cmp    $0x7f,%eax
+  8056fe:	76 07                	jbe    805707 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  805700:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  805707:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80570a:	48 63 d0             	movslq %eax,%rdx
+  80570d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805710:	48 63 c8             	movslq %eax,%rcx
+  805713:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80571a:	48 01 c1             	add    %rax,%rcx
+  80571d:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805724:	48 89 ce             	mov    %rcx,%rsi
+  805727:	48 89 c7             	mov    %rax,%rdi
+  80572a:	49 89 df             	mov    %rbx,%r15
+  80572d:	48 b8 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rax
+  805734:	ff ff ff 
+  805737:	48 01 d8             	add    %rbx,%rax
+  80573a:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  80573c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80573f:	48 63 d0             	movslq %eax,%rdx
+  805742:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805749:	48 89 d6             	mov    %rdx,%rsi
+  80574c:	48 89 c7             	mov    %rax,%rdi
+  80574f:	49 89 df             	mov    %rbx,%r15
+  805752:	48 b8 70 8f ff ff ff 	movabs $0xffffffffffff8f70,%rax
+  805759:	ff ff ff 
+  80575c:	48 01 d8             	add    %rbx,%rax
+  80575f:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  805761:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805764:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805767:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80576a:	48 98                	cltq
+  80576c:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  805773:	0f 82 6e ff ff ff    	jb     8056e7 <devcons_write+0x43>
+	}
+	return tot;
+  805779:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80577c:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  805783:	5b                   	pop    %rbx
+  805784:	41 5f                	pop    %r15
+  805786:	5d                   	pop    %rbp
+  805787:	c3                   	ret
+
+0000000000805788 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  805788:	55                   	push   %rbp
+  805789:	48 89 e5             	mov    %rsp,%rbp
+  80578c:	48 83 ec 08          	sub    $0x8,%rsp
+  805790:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805790 <devcons_close+0x8>
+  805797:	49 bb a0 38 00 00 00 	movabs $0x38a0,%r11
+  80579e:	00 00 00 
+  8057a1:	4c 01 d8             	add    %r11,%rax
+  8057a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8057a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057ad:	c9                   	leave
+  8057ae:	c3                   	ret
+
+00000000008057af <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8057af:	55                   	push   %rbp
+  8057b0:	48 89 e5             	mov    %rsp,%rbp
+  8057b3:	41 57                	push   %r15
+  8057b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8057b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8057b9 <devcons_stat+0xa>
+  8057c0:	49 bb 77 38 00 00 00 	movabs $0x3877,%r11
+  8057c7:	00 00 00 
+  8057ca:	4c 01 d8             	add    %r11,%rax
+  8057cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8057d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8057d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8057d9:	48 b9 85 dd ff ff ff 	movabs $0xffffffffffffdd85,%rcx
+  8057e0:	ff ff ff 
+  8057e3:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8057e7:	48 89 ce             	mov    %rcx,%rsi
+  8057ea:	48 89 d7             	mov    %rdx,%rdi
+  8057ed:	49 89 c7             	mov    %rax,%r15
+  8057f0:	48 ba 6c 84 ff ff ff 	movabs $0xffffffffffff846c,%rdx
+  8057f7:	ff ff ff 
+  8057fa:	48 01 c2             	add    %rax,%rdx
+  8057fd:	ff d2                	call   *%rdx
+	return 0;
+  8057ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805804:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805808:	c9                   	leave
+  805809:	c3                   	ret
+
+000000000080580a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80580a:	55                   	push   %rbp
+  80580b:	48 89 e5             	mov    %rsp,%rbp
+  80580e:	41 57                	push   %r15
+  805810:	41 54                	push   %r12
+  805812:	53                   	push   %rbx
+  805813:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80581a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80581a <_panic+0x10>
+  805821:	49 bb 16 38 00 00 00 	movabs $0x3816,%r11
+  805828:	00 00 00 
+  80582b:	4c 01 db             	add    %r11,%rbx
+  80582e:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  805835:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80583b:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  805842:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  805849:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  805850:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  805857:	84 c0                	test   %al,%al
+  805859:	74 26                	je     805881 <_panic+0x77>
+  80585b:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  805862:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  805869:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80586d:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  805871:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  805875:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  805879:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80587d:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  805881:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  805888:	00 00 00 
+  80588b:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  805892:	00 00 00 
+  805895:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805899:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8058a0:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8058a7:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8058ae:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8058b5:	ff ff ff 
+  8058b8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058bc:	4c 8b 20             	mov    (%rax),%r12
+  8058bf:	49 89 df             	mov    %rbx,%r15
+  8058c2:	48 b8 7f 90 ff ff ff 	movabs $0xffffffffffff907f,%rax
+  8058c9:	ff ff ff 
+  8058cc:	48 01 d8             	add    %rbx,%rax
+  8058cf:	ff d0                	call   *%rax
+  8058d1:	89 c6                	mov    %eax,%esi
+  8058d3:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8058d9:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8058e0:	41 89 d0             	mov    %edx,%r8d
+  8058e3:	48 89 c1             	mov    %rax,%rcx
+  8058e6:	4c 89 e2             	mov    %r12,%rdx
+  8058e9:	48 b8 90 dd ff ff ff 	movabs $0xffffffffffffdd90,%rax
+  8058f0:	ff ff ff 
+  8058f3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058f7:	48 89 c7             	mov    %rax,%rdi
+  8058fa:	49 89 df             	mov    %rbx,%r15
+  8058fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  805902:	49 b9 aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%r9
+  805909:	ff ff ff 
+  80590c:	49 01 d9             	add    %rbx,%r9
+  80590f:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  805912:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  805919:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  805920:	48 89 d6             	mov    %rdx,%rsi
+  805923:	48 89 c7             	mov    %rax,%rdi
+  805926:	49 89 df             	mov    %rbx,%r15
+  805929:	48 b8 ca 75 ff ff ff 	movabs $0xffffffffffff75ca,%rax
+  805930:	ff ff ff 
+  805933:	48 01 d8             	add    %rbx,%rax
+  805936:	ff d0                	call   *%rax
+	cprintf("\n");
+  805938:	48 b8 b3 dd ff ff ff 	movabs $0xffffffffffffddb3,%rax
+  80593f:	ff ff ff 
+  805942:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805946:	48 89 c7             	mov    %rax,%rdi
+  805949:	49 89 df             	mov    %rbx,%r15
+  80594c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805951:	48 ba aa 76 ff ff ff 	movabs $0xffffffffffff76aa,%rdx
+  805958:	ff ff ff 
+  80595b:	48 01 da             	add    %rbx,%rdx
+  80595e:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  805960:	cc                   	int3
+  805961:	eb fd                	jmp    805960 <_panic+0x156>
+
+0000000000805963 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805963:	55                   	push   %rbp
+  805964:	48 89 e5             	mov    %rsp,%rbp
+  805967:	41 57                	push   %r15
+  805969:	53                   	push   %rbx
+  80596a:	48 83 ec 30          	sub    $0x30,%rsp
+  80596e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80596e <ipc_recv+0xb>
+  805975:	49 bb c2 36 00 00 00 	movabs $0x36c2,%r11
+  80597c:	00 00 00 
+  80597f:	4c 01 db             	add    %r11,%rbx
+  805982:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805986:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80598a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80598e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805993:	75 0e                	jne    8059a3 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805995:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80599c:	00 00 00 
+  80599f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8059a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059a7:	48 89 c7             	mov    %rax,%rdi
+  8059aa:	49 89 df             	mov    %rbx,%r15
+  8059ad:	48 b8 51 94 ff ff ff 	movabs $0xffffffffffff9451,%rax
+  8059b4:	ff ff ff 
+  8059b7:	48 01 d8             	add    %rbx,%rax
+  8059ba:	ff d0                	call   *%rax
+  8059bc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8059bf:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8059c4:	74 2a                	je     8059f0 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8059c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059ca:	75 19                	jne    8059e5 <ipc_recv+0x82>
+  8059cc:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8059d3:	ff ff ff 
+  8059d6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059da:	48 8b 00             	mov    (%rax),%rax
+  8059dd:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8059e3:	eb 05                	jmp    8059ea <ipc_recv+0x87>
+  8059e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059ea:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8059ee:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8059f0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8059f5:	74 2a                	je     805a21 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8059f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059fb:	75 19                	jne    805a16 <ipc_recv+0xb3>
+  8059fd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a04:	ff ff ff 
+  805a07:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a0b:	48 8b 00             	mov    (%rax),%rax
+  805a0e:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805a14:	eb 05                	jmp    805a1b <ipc_recv+0xb8>
+  805a16:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a1b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805a1f:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805a21:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a25:	74 05                	je     805a2c <ipc_recv+0xc9>
+		return res;
+  805a27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a2a:	eb 17                	jmp    805a43 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805a2c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a33:	ff ff ff 
+  805a36:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a3a:	48 8b 00             	mov    (%rax),%rax
+  805a3d:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805a43:	48 83 c4 30          	add    $0x30,%rsp
+  805a47:	5b                   	pop    %rbx
+  805a48:	41 5f                	pop    %r15
+  805a4a:	5d                   	pop    %rbp
+  805a4b:	c3                   	ret
+
+0000000000805a4c <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805a4c:	55                   	push   %rbp
+  805a4d:	48 89 e5             	mov    %rsp,%rbp
+  805a50:	41 57                	push   %r15
+  805a52:	53                   	push   %rbx
+  805a53:	48 83 ec 20          	sub    $0x20,%rsp
+  805a57:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a57 <ipc_send+0xb>
+  805a5e:	49 bb d9 35 00 00 00 	movabs $0x35d9,%r11
+  805a65:	00 00 00 
+  805a68:	4c 01 db             	add    %r11,%rbx
+  805a6b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a6e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805a71:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805a75:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805a78:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805a7d:	75 0e                	jne    805a8d <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805a7f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a86:	00 00 00 
+  805a89:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805a8d:	90                   	nop
+  805a8e:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805a91:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805a94:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a9b:	89 c7                	mov    %eax,%edi
+  805a9d:	49 89 df             	mov    %rbx,%r15
+  805aa0:	48 b8 e7 93 ff ff ff 	movabs $0xffffffffffff93e7,%rax
+  805aa7:	ff ff ff 
+  805aaa:	48 01 d8             	add    %rbx,%rax
+  805aad:	ff d0                	call   *%rax
+  805aaf:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805ab2:	74 da                	je     805a8e <ipc_send+0x42>
+		;
+}
+  805ab4:	90                   	nop
+  805ab5:	90                   	nop
+  805ab6:	48 83 c4 20          	add    $0x20,%rsp
+  805aba:	5b                   	pop    %rbx
+  805abb:	41 5f                	pop    %r15
+  805abd:	5d                   	pop    %rbp
+  805abe:	c3                   	ret
+
+0000000000805abf <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805abf:	55                   	push   %rbp
+  805ac0:	48 89 e5             	mov    %rsp,%rbp
+  805ac3:	41 57                	push   %r15
+  805ac5:	53                   	push   %rbx
+  805ac6:	48 83 ec 40          	sub    $0x40,%rsp
+  805aca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805aca <ipc_call+0xb>
+  805ad1:	49 bb 66 35 00 00 00 	movabs $0x3566,%r11
+  805ad8:	00 00 00 
+  805adb:	4c 01 db             	add    %r11,%rbx
+  805ade:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805ae1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805ae4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805ae8:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805aeb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805aef:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805af3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805af8:	75 0e                	jne    805b08 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805afa:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b01:	00 00 00 
+  805b04:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805b08:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805b0d:	75 0e                	jne    805b1d <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805b0f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b16:	00 00 00 
+  805b19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805b1d:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805b20:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805b24:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805b27:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b2b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b2e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805b34:	49 89 f8             	mov    %rdi,%r8
+  805b37:	89 c7                	mov    %eax,%edi
+  805b39:	49 89 df             	mov    %rbx,%r15
+  805b3c:	48 b8 aa 94 ff ff ff 	movabs $0xffffffffffff94aa,%rax
+  805b43:	ff ff ff 
+  805b46:	48 01 d8             	add    %rbx,%rax
+  805b49:	ff d0                	call   *%rax
+  805b4b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805b4e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805b53:	74 2a                	je     805b7f <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805b55:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b59:	75 19                	jne    805b74 <ipc_call+0xb5>
+  805b5b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b62:	ff ff ff 
+  805b65:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b69:	48 8b 00             	mov    (%rax),%rax
+  805b6c:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805b72:	eb 05                	jmp    805b79 <ipc_call+0xba>
+  805b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b79:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805b7d:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805b7f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b83:	74 05                	je     805b8a <ipc_call+0xcb>
+		return r;
+  805b85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b88:	eb 17                	jmp    805ba1 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805b8a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b91:	ff ff ff 
+  805b94:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b98:	48 8b 00             	mov    (%rax),%rax
+  805b9b:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805ba1:	48 83 c4 40          	add    $0x40,%rsp
+  805ba5:	5b                   	pop    %rbx
+  805ba6:	41 5f                	pop    %r15
+  805ba8:	5d                   	pop    %rbp
+  805ba9:	c3                   	ret
+
+0000000000805baa <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805baa:	55                   	push   %rbp
+  805bab:	48 89 e5             	mov    %rsp,%rbp
+  805bae:	41 57                	push   %r15
+  805bb0:	53                   	push   %rbx
+  805bb1:	48 83 ec 70          	sub    $0x70,%rsp
+  805bb5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bb5 <ipc_callw+0xb>
+  805bbc:	49 bb 7b 34 00 00 00 	movabs $0x347b,%r11
+  805bc3:	00 00 00 
+  805bc6:	4c 01 db             	add    %r11,%rbx
+  805bc9:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805bcc:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805bcf:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805bd3:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805bd7:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805bdc:	76 0a                	jbe    805be8 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805bde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805be3:	e9 b7 00 00 00       	jmp    805c9f <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805be8:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805bec:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805bf0:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805bf4:	48 89 ce             	mov    %rcx,%rsi
+  805bf7:	48 89 c7             	mov    %rax,%rdi
+  805bfa:	49 89 df             	mov    %rbx,%r15
+  805bfd:	48 b8 4c 88 ff ff ff 	movabs $0xffffffffffff884c,%rax
+  805c04:	ff ff ff 
+  805c07:	48 01 d8             	add    %rbx,%rax
+  805c0a:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805c0c:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805c13:	00 
+  805c14:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805c18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c1c:	48 01 d0             	add    %rdx,%rax
+  805c1f:	48 83 e8 01          	sub    $0x1,%rax
+  805c23:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805c27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c30:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805c34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c38:	48 29 d0             	sub    %rdx,%rax
+  805c3b:	48 c1 e8 03          	shr    $0x3,%rax
+  805c3f:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805c43:	89 c1                	mov    %eax,%ecx
+  805c45:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805c48:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805c4c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805c4f:	49 89 d1             	mov    %rdx,%r9
+  805c52:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805c59:	00 00 00 
+  805c5c:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805c63:	00 00 00 
+  805c66:	89 c7                	mov    %eax,%edi
+  805c68:	49 89 df             	mov    %rbx,%r15
+  805c6b:	48 b8 aa 94 ff ff ff 	movabs $0xffffffffffff94aa,%rax
+  805c72:	ff ff ff 
+  805c75:	48 01 d8             	add    %rbx,%rax
+  805c78:	ff d0                	call   *%rax
+  805c7a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805c7d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805c81:	74 05                	je     805c88 <ipc_callw+0xde>
+		return r;
+  805c83:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c86:	eb 17                	jmp    805c9f <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805c88:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c8f:	ff ff ff 
+  805c92:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c96:	48 8b 00             	mov    (%rax),%rax
+  805c99:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805c9f:	48 83 c4 70          	add    $0x70,%rsp
+  805ca3:	5b                   	pop    %rbx
+  805ca4:	41 5f                	pop    %r15
+  805ca6:	5d                   	pop    %rbp
+  805ca7:	c3                   	ret
+
+0000000000805ca8 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805ca8:	55                   	push   %rbp
+  805ca9:	48 89 e5             	mov    %rsp,%rbp
+  805cac:	41 57                	push   %r15
+  805cae:	53                   	push   %rbx
+  805caf:	48 83 ec 40          	sub    $0x40,%rsp
+  805cb3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cb3 <ipc_callv+0xb>
+  805cba:	49 bb 7d 33 00 00 00 	movabs $0x337d,%r11
+  805cc1:	00 00 00 
+  805cc4:	4c 01 db             	add    %r11,%rbx
+  805cc7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805cca:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805ccd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805cd1:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805cd4:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805cd8:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805cdc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805ce3:	00 00 00 
+  805ce6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805cea:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805cee:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805cf2:	74 11                	je     805d05 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805cf4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805cf8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805cfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805cff:	c1 e0 14             	shl    $0x14,%eax
+  805d02:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805d05:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805d09:	74 14                	je     805d1f <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805d0b:	8b 45 20             	mov    0x20(%rbp),%eax
+  805d0e:	83 e8 01             	sub    $0x1,%eax
+  805d11:	48 63 d0             	movslq %eax,%rdx
+  805d14:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805d18:	48 09 d0             	or     %rdx,%rax
+  805d1b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805d1f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805d22:	c1 e0 10             	shl    $0x10,%eax
+  805d25:	0b 45 10             	or     0x10(%rbp),%eax
+  805d28:	89 c1                	mov    %eax,%ecx
+  805d2a:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805d2d:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805d31:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805d35:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805d39:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805d3c:	4d 89 c1             	mov    %r8,%r9
+  805d3f:	49 89 f8             	mov    %rdi,%r8
+  805d42:	89 c7                	mov    %eax,%edi
+  805d44:	49 89 df             	mov    %rbx,%r15
+  805d47:	48 b8 aa 94 ff ff ff 	movabs $0xffffffffffff94aa,%rax
+  805d4e:	ff ff ff 
+  805d51:	48 01 d8             	add    %rbx,%rax
+  805d54:	ff d0                	call   *%rax
+  805d56:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805d59:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805d5d:	74 05                	je     805d64 <ipc_callv+0xbc>
+		return r;
+  805d5f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d62:	eb 17                	jmp    805d7b <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805d64:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d6b:	ff ff ff 
+  805d6e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d72:	48 8b 00             	mov    (%rax),%rax
+  805d75:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805d7b:	48 83 c4 40          	add    $0x40,%rsp
+  805d7f:	5b                   	pop    %rbx
+  805d80:	41 5f                	pop    %r15
+  805d82:	5d                   	pop    %rbp
+  805d83:	c3                   	ret
+
+0000000000805d84 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805d84:	55                   	push   %rbp
+  805d85:	48 89 e5             	mov    %rsp,%rbp
+  805d88:	41 57                	push   %r15
+  805d8a:	53                   	push   %rbx
+  805d8b:	48 83 ec 40          	sub    $0x40,%rsp
+  805d8f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d8f <ipc_reply_recv+0xb>
+  805d96:	49 bb a1 32 00 00 00 	movabs $0x32a1,%r11
+  805d9d:	00 00 00 
+  805da0:	4c 01 db             	add    %r11,%rbx
+  805da3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805da6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805da9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805dad:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805db0:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805db4:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805db8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805dbd:	75 0e                	jne    805dcd <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805dbf:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805dc6:	00 00 00 
+  805dc9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805dcd:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805dd2:	75 0e                	jne    805de2 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805dd4:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805ddb:	00 00 00 
+  805dde:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805de2:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805de5:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805de9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805ded:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805df0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805df4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805df7:	4d 89 c1             	mov    %r8,%r9
+  805dfa:	49 89 f8             	mov    %rdi,%r8
+  805dfd:	89 c7                	mov    %eax,%edi
+  805dff:	49 89 df             	mov    %rbx,%r15
+  805e02:	48 b8 1e 95 ff ff ff 	movabs $0xffffffffffff951e,%rax
+  805e09:	ff ff ff 
+  805e0c:	48 01 d8             	add    %rbx,%rax
+  805e0f:	ff d0                	call   *%rax
+  805e11:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805e14:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805e19:	74 2a                	je     805e45 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805e1b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e1f:	75 19                	jne    805e3a <ipc_reply_recv+0xb6>
+  805e21:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e28:	ff ff ff 
+  805e2b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e2f:	48 8b 00             	mov    (%rax),%rax
+  805e32:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805e38:	eb 05                	jmp    805e3f <ipc_reply_recv+0xbb>
+  805e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805e43:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805e45:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805e4a:	74 2a                	je     805e76 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805e4c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e50:	75 19                	jne    805e6b <ipc_reply_recv+0xe7>
+  805e52:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e59:	ff ff ff 
+  805e5c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e60:	48 8b 00             	mov    (%rax),%rax
+  805e63:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805e69:	eb 05                	jmp    805e70 <ipc_reply_recv+0xec>
+  805e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e70:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805e74:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805e76:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e7a:	74 05                	je     805e81 <ipc_reply_recv+0xfd>
+		return r;
+  805e7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e7f:	eb 17                	jmp    805e98 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805e81:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e88:	ff ff ff 
+  805e8b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e8f:	48 8b 00             	mov    (%rax),%rax
+  805e92:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805e98:	48 83 c4 40          	add    $0x40,%rsp
+  805e9c:	5b                   	pop    %rbx
+  805e9d:	41 5f                	pop    %r15
+  805e9f:	5d                   	pop    %rbp
+  805ea0:	c3                   	ret
+
+0000000000805ea1 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805ea1:	55                   	push   %rbp
+  805ea2:	48 89 e5             	mov    %rsp,%rbp
+  805ea5:	41 57                	push   %r15
+  805ea7:	53                   	push   %rbx
+  805ea8:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805eaf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805eaf <ipc_window_batch+0xe>
+  805eb6:	49 bb 81 31 00 00 00 	movabs $0x3181,%r11
+  805ebd:	00 00 00 
+  805ec0:	4c 01 db             	add    %r11,%rbx
+  805ec3:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805ec9:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805ed0:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805ed6:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805edc:	e9 15 01 00 00       	jmp    805ff6 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805ee1:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805ee7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805eea:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805ef1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805ef4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805ef7:	39 c2                	cmp    %eax,%edx
+  805ef9:	0f 4e c2             	cmovle %edx,%eax
+  805efc:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805eff:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805f06:	eb 6b                	jmp    805f73 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805f08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f0b:	48 98                	cltq
+  805f0d:	48 c1 e0 05          	shl    $0x5,%rax
+  805f11:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f15:	48 01 e8             	add    %rbp,%rax
+  805f18:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805f1e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805f24:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f27:	c1 e0 0c             	shl    $0xc,%eax
+  805f2a:	48 63 d0             	movslq %eax,%rdx
+  805f2d:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805f34:	48 01 c2             	add    %rax,%rdx
+  805f37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f3a:	48 98                	cltq
+  805f3c:	48 c1 e0 05          	shl    $0x5,%rax
+  805f40:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f44:	48 01 e8             	add    %rbp,%rax
+  805f47:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805f4d:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805f50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f53:	48 98                	cltq
+  805f55:	48 c1 e0 05          	shl    $0x5,%rax
+  805f59:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805f5d:	48 01 e8             	add    %rbp,%rax
+  805f60:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805f67:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805f6d:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805f6f:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805f73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f76:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805f79:	7c 8d                	jl     805f08 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805f7b:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805f82:	74 27                	je     805fab <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805f84:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805f87:	48 63 d0             	movslq %eax,%rdx
+  805f8a:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805f91:	48 89 d6             	mov    %rdx,%rsi
+  805f94:	48 89 c7             	mov    %rax,%rdi
+  805f97:	49 89 df             	mov    %rbx,%r15
+  805f9a:	48 b8 c1 97 ff ff ff 	movabs $0xffffffffffff97c1,%rax
+  805fa1:	ff ff ff 
+  805fa4:	48 01 d8             	add    %rbx,%rax
+  805fa7:	ff d0                	call   *%rax
+  805fa9:	eb 25                	jmp    805fd0 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805fab:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805fae:	48 63 d0             	movslq %eax,%rdx
+  805fb1:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805fb8:	48 89 d6             	mov    %rdx,%rsi
+  805fbb:	48 89 c7             	mov    %rax,%rdi
+  805fbe:	49 89 df             	mov    %rbx,%r15
+  805fc1:	48 b8 1f 98 ff ff ff 	movabs $0xffffffffffff981f,%rax
+  805fc8:	ff ff ff 
+  805fcb:	48 01 d8             	add    %rbx,%rax
+  805fce:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805fd0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805fd3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805fd7:	79 05                	jns    805fde <ipc_window_batch+0x13d>
+			return r;
+  805fd9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805fdc:	eb 2a                	jmp    806008 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805fde:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805fe1:	c1 e0 0c             	shl    $0xc,%eax
+  805fe4:	48 98                	cltq
+  805fe6:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805fed:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805ff0:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805ff6:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805ffd:	0f 8f de fe ff ff    	jg     805ee1 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806003:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806008:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  80600f:	5b                   	pop    %rbx
+  806010:	41 5f                	pop    %r15
+  806012:	5d                   	pop    %rbp
+  806013:	c3                   	ret
+
+0000000000806014 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806014:	55                   	push   %rbp
+  806015:	48 89 e5             	mov    %rsp,%rbp
+  806018:	48 83 ec 10          	sub    $0x10,%rsp
+  80601c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80601c <ipc_map_window+0x8>
+  806023:	49 bb 14 30 00 00 00 	movabs $0x3014,%r11
+  80602a:	00 00 00 
+  80602d:	4c 01 d8             	add    %r11,%rax
+  806030:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806034:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806037:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80603a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80603e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806043:	bf 01 00 00 00       	mov    $0x1,%edi
+  806048:	49 b8 71 ce ff ff ff 	movabs $0xffffffffffffce71,%r8
+  80604f:	ff ff ff 
+  806052:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806056:	ff d0                	call   *%rax
+}
+  806058:	c9                   	leave
+  806059:	c3                   	ret
+
+000000000080605a <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  80605a:	55                   	push   %rbp
+  80605b:	48 89 e5             	mov    %rsp,%rbp
+  80605e:	48 83 ec 10          	sub    $0x10,%rsp
+  806062:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806062 <ipc_unmap_window+0x8>
+  806069:	49 bb ce 2f 00 00 00 	movabs $0x2fce,%r11
+  806070:	00 00 00 
+  806073:	4c 01 d8             	add    %r11,%rax
+  806076:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80607a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  80607d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806080:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806084:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806089:	bf 00 00 00 00       	mov    $0x0,%edi
+  80608e:	49 b8 71 ce ff ff ff 	movabs $0xffffffffffffce71,%r8
+  806095:	ff ff ff 
+  806098:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80609c:	ff d0                	call   *%rax
+}
+  80609e:	c9                   	leave
+  80609f:	c3                   	ret
+
+00000000008060a0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8060a0:	55                   	push   %rbp
+  8060a1:	48 89 e5             	mov    %rsp,%rbp
+  8060a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8060a8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060a8 <ipc_find_env+0x8>
+  8060af:	49 bb 88 2f 00 00 00 	movabs $0x2f88,%r11
+  8060b6:	00 00 00 
+  8060b9:	4c 01 d8             	add    %r11,%rax
+  8060bc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  8060bf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8060c6:	eb 57                	jmp    80611f <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  8060c8:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8060cf:	ff ff ff 
+  8060d2:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8060d6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8060d9:	48 63 d2             	movslq %edx,%rdx
+  8060dc:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  8060e3:	48 01 ca             	add    %rcx,%rdx
+  8060e6:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  8060ed:	8b 12                	mov    (%rdx),%edx
+  8060ef:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  8060f2:	75 27                	jne    80611b <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  8060f4:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8060fb:	ff ff ff 
+  8060fe:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806102:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806105:	48 98                	cltq
+  806107:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80610e:	48 01 d0             	add    %rdx,%rax
+  806111:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806117:	8b 00                	mov    (%rax),%eax
+  806119:	eb 12                	jmp    80612d <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  80611b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80611f:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806126:	7e a0                	jle    8060c8 <ipc_find_env+0x28>
+	}
+	return 0;
+  806128:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80612d:	c9                   	leave
+  80612e:	c3                   	ret
+
+000000000080612f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80612f:	55                   	push   %rbp
+  806130:	48 89 e5             	mov    %rsp,%rbp
+  806133:	48 83 ec 18          	sub    $0x18,%rsp
+  806137:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806137 <pageref+0x8>
+  80613e:	49 bb f9 2e 00 00 00 	movabs $0x2ef9,%r11
+  806145:	00 00 00 
+  806148:	4c 01 d8             	add    %r11,%rax
+  80614b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80614f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806153:	48 89 d1             	mov    %rdx,%rcx
+  806156:	48 c1 e9 15          	shr    $0x15,%rcx
+  80615a:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806161:	ff ff ff 
+  806164:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806168:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80616c:	83 e2 01             	and    $0x1,%edx
+  80616f:	48 85 d2             	test   %rdx,%rdx
+  806172:	75 07                	jne    80617b <pageref+0x4c>
+		return 0;
+  806174:	b8 00 00 00 00       	mov    $0x0,%eax
+  806179:	eb 64                	jmp    8061df <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  80617b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80617f:	48 89 d1             	mov    %rdx,%rcx
+  806182:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806186:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80618d:	ff ff ff 
+  806190:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806194:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806198:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  80619c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8061a0:	83 e2 01             	and    $0x1,%edx
+  8061a3:	48 85 d2             	test   %rdx,%rdx
+  8061a6:	75 07                	jne    8061af <pageref+0x80>
+		return 0;
+  8061a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061ad:	eb 30                	jmp    8061df <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8061af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8061b3:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8061b7:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  8061be:	ff ff ff 
+  8061c1:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8061c5:	48 89 d0             	mov    %rdx,%rax
+  8061c8:	48 01 c0             	add    %rax,%rax
+  8061cb:	48 01 d0             	add    %rdx,%rax
+  8061ce:	48 c1 e0 03          	shl    $0x3,%rax
+  8061d2:	48 01 c8             	add    %rcx,%rax
+  8061d5:	48 83 c0 08          	add    $0x8,%rax
+  8061d9:	0f b7 00             	movzwl (%rax),%eax
+  8061dc:	0f b7 c0             	movzwl %ax,%eax
+}
+  8061df:	c9                   	leave
+  8061e0:	c3                   	ret
+
+00000000008061e1 <inet_addr>:
+ * @param cp IP address in ascii represenation (e.g. "127.0.0.1")
+ * @return ip address in network order
+ */
+u32_t
+inet_addr(const char *cp)
+{
+  8061e1:	55                   	push   %rbp
+  8061e2:	48 89 e5             	mov    %rsp,%rbp
+  8061e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8061e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8061e9 <inet_addr+0x8>
+  8061f0:	49 bb 47 2e 00 00 00 	movabs $0x2e47,%r11
+  8061f7:	00 00 00 
+  8061fa:	4c 01 d8             	add    %r11,%rax
+  8061fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct in_addr val;
+
+  if (inet_aton(cp, &val)) {
+  806201:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  806205:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806209:	48 89 ce             	mov    %rcx,%rsi
+  80620c:	48 89 d7             	mov    %rdx,%rdi
+  80620f:	48 ba ff d1 ff ff ff 	movabs $0xffffffffffffd1ff,%rdx
+  806216:	ff ff ff 
+  806219:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80621d:	ff d0                	call   *%rax
+  80621f:	85 c0                	test   %eax,%eax
+  806221:	74 05                	je     806228 <inet_addr+0x47>
+    return (val.s_addr);
+  806223:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806226:	eb 05                	jmp    80622d <inet_addr+0x4c>
+  }
+  return (INADDR_NONE);
+  806228:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  80622d:	c9                   	leave
+  80622e:	c3                   	ret
+
+000000000080622f <inet_aton>:
+ * @param addr pointer to which to save the ip address in network order
+ * @return 1 if cp could be converted to addr, 0 on failure
+ */
+int
+inet_aton(const char *cp, struct in_addr *addr)
+{
+  80622f:	55                   	push   %rbp
+  806230:	48 89 e5             	mov    %rsp,%rbp
+  806233:	48 83 ec 40          	sub    $0x40,%rsp
+  806237:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806237 <inet_aton+0x8>
+  80623e:	49 bb f9 2d 00 00 00 	movabs $0x2df9,%r11
+  806245:	00 00 00 
+  806248:	4c 01 d8             	add    %r11,%rax
+  80624b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80624f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  u32_t val;
+  int base, n, c;
+  u32_t parts[4];
+  u32_t *pp = parts;
+  806253:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  806257:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+
+  c = *cp;
+  80625b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80625f:	0f b6 12             	movzbl (%rdx),%edx
+  806262:	0f be d2             	movsbl %dl,%edx
+  806265:	89 55 f4             	mov    %edx,-0xc(%rbp)
+    /*
+     * Collect number up to ``.''.
+     * Values are specified as for C:
+     * 0x=hex, 0=octal, 1-9=decimal.
+     */
+    if (!isdigit(c))
+  806268:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80626b:	80 fa 2f             	cmp    $0x2f,%dl
+  80626e:	76 08                	jbe    806278 <inet_aton+0x49>
+  806270:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806273:	80 fa 39             	cmp    $0x39,%dl
+  806276:	76 0a                	jbe    806282 <inet_aton+0x53>
+      return (0);
+  806278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80627d:	e9 7c 02 00 00       	jmp    8064fe <inet_aton+0x2cf>
+    val = 0;
+  806282:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    base = 10;
+  806289:	c7 45 f8 0a 00 00 00 	movl   $0xa,-0x8(%rbp)
+    if (c == '0') {
+  806290:	83 7d f4 30          	cmpl   $0x30,-0xc(%rbp)
+  806294:	75 40                	jne    8062d6 <inet_aton+0xa7>
+      c = *++cp;
+  806296:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  80629b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80629f:	0f b6 12             	movzbl (%rdx),%edx
+  8062a2:	0f be d2             	movsbl %dl,%edx
+  8062a5:	89 55 f4             	mov    %edx,-0xc(%rbp)
+      if (c == 'x' || c == 'X') {
+  8062a8:	83 7d f4 78          	cmpl   $0x78,-0xc(%rbp)
+  8062ac:	74 06                	je     8062b4 <inet_aton+0x85>
+  8062ae:	83 7d f4 58          	cmpl   $0x58,-0xc(%rbp)
+  8062b2:	75 1b                	jne    8062cf <inet_aton+0xa0>
+        base = 16;
+  8062b4:	c7 45 f8 10 00 00 00 	movl   $0x10,-0x8(%rbp)
+        c = *++cp;
+  8062bb:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8062c0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8062c4:	0f b6 12             	movzbl (%rdx),%edx
+  8062c7:	0f be d2             	movsbl %dl,%edx
+  8062ca:	89 55 f4             	mov    %edx,-0xc(%rbp)
+  8062cd:	eb 07                	jmp    8062d6 <inet_aton+0xa7>
+      } else
+        base = 8;
+  8062cf:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+    }
+    for (;;) {
+      if (isdigit(c)) {
+  8062d6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8062d9:	80 fa 2f             	cmp    $0x2f,%dl
+  8062dc:	76 30                	jbe    80630e <inet_aton+0xdf>
+  8062de:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8062e1:	80 fa 39             	cmp    $0x39,%dl
+  8062e4:	77 28                	ja     80630e <inet_aton+0xdf>
+        val = (val * base) + (int)(c - '0');
+  8062e6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8062e9:	89 d1                	mov    %edx,%ecx
+  8062eb:	0f af 4d fc          	imul   -0x4(%rbp),%ecx
+  8062ef:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8062f2:	01 ca                	add    %ecx,%edx
+  8062f4:	83 ea 30             	sub    $0x30,%edx
+  8062f7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        c = *++cp;
+  8062fa:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8062ff:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806303:	0f b6 12             	movzbl (%rdx),%edx
+  806306:	0f be d2             	movsbl %dl,%edx
+  806309:	89 55 f4             	mov    %edx,-0xc(%rbp)
+  80630c:	eb 7b                	jmp    806389 <inet_aton+0x15a>
+      } else if (base == 16 && isxdigit(c)) {
+  80630e:	83 7d f8 10          	cmpl   $0x10,-0x8(%rbp)
+  806312:	75 7a                	jne    80638e <inet_aton+0x15f>
+  806314:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806317:	80 fa 2f             	cmp    $0x2f,%dl
+  80631a:	76 08                	jbe    806324 <inet_aton+0xf5>
+  80631c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80631f:	80 fa 39             	cmp    $0x39,%dl
+  806322:	76 20                	jbe    806344 <inet_aton+0x115>
+  806324:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806327:	80 fa 60             	cmp    $0x60,%dl
+  80632a:	76 08                	jbe    806334 <inet_aton+0x105>
+  80632c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80632f:	80 fa 66             	cmp    $0x66,%dl
+  806332:	76 10                	jbe    806344 <inet_aton+0x115>
+  806334:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806337:	80 fa 40             	cmp    $0x40,%dl
+  80633a:	76 52                	jbe    80638e <inet_aton+0x15f>
+  80633c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80633f:	80 fa 46             	cmp    $0x46,%dl
+  806342:	77 4a                	ja     80638e <inet_aton+0x15f>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  806344:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806347:	89 d1                	mov    %edx,%ecx
+  806349:	c1 e1 04             	shl    $0x4,%ecx
+  80634c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80634f:	83 c2 0a             	add    $0xa,%edx
+  806352:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  806355:	40 80 fe 60          	cmp    $0x60,%sil
+  806359:	76 10                	jbe    80636b <inet_aton+0x13c>
+  80635b:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  80635e:	40 80 fe 7a          	cmp    $0x7a,%sil
+  806362:	77 07                	ja     80636b <inet_aton+0x13c>
+  806364:	be 61 00 00 00       	mov    $0x61,%esi
+  806369:	eb 05                	jmp    806370 <inet_aton+0x141>
+  80636b:	be 41 00 00 00       	mov    $0x41,%esi
+  806370:	29 f2                	sub    %esi,%edx
+  806372:	09 ca                	or     %ecx,%edx
+  806374:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        c = *++cp;
+  806377:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  80637c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806380:	0f b6 12             	movzbl (%rdx),%edx
+  806383:	0f be d2             	movsbl %dl,%edx
+  806386:	89 55 f4             	mov    %edx,-0xc(%rbp)
+      if (isdigit(c)) {
+  806389:	e9 48 ff ff ff       	jmp    8062d6 <inet_aton+0xa7>
+      } else
+        break;
+    }
+    if (c == '.') {
+  80638e:	83 7d f4 2e          	cmpl   $0x2e,-0xc(%rbp)
+  806392:	75 40                	jne    8063d4 <inet_aton+0x1a5>
+       * Internet format:
+       *  a.b.c.d
+       *  a.b.c   (with c treated as 16 bits)
+       *  a.b (with b treated as 24 bits)
+       */
+      if (pp >= parts + 3)
+  806394:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  806398:	48 83 c2 0c          	add    $0xc,%rdx
+  80639c:	48 39 55 e8          	cmp    %rdx,-0x18(%rbp)
+  8063a0:	72 0a                	jb     8063ac <inet_aton+0x17d>
+        return (0);
+  8063a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063a7:	e9 52 01 00 00       	jmp    8064fe <inet_aton+0x2cf>
+      *pp++ = val;
+  8063ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8063b0:	48 8d 4a 04          	lea    0x4(%rdx),%rcx
+  8063b4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8063b8:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8063bb:	89 0a                	mov    %ecx,(%rdx)
+      c = *++cp;
+  8063bd:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8063c2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8063c6:	0f b6 12             	movzbl (%rdx),%edx
+  8063c9:	0f be d2             	movsbl %dl,%edx
+  8063cc:	89 55 f4             	mov    %edx,-0xc(%rbp)
+    if (!isdigit(c))
+  8063cf:	e9 94 fe ff ff       	jmp    806268 <inet_aton+0x39>
+    } else
+      break;
+  8063d4:	90                   	nop
+  }
+  /*
+   * Check for trailing characters.
+   */
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  8063d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8063d9:	74 3d                	je     806418 <inet_aton+0x1e9>
+  8063db:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8063de:	80 fa 1f             	cmp    $0x1f,%dl
+  8063e1:	76 2b                	jbe    80640e <inet_aton+0x1df>
+  8063e3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8063e6:	84 d2                	test   %dl,%dl
+  8063e8:	78 24                	js     80640e <inet_aton+0x1df>
+  8063ea:	83 7d f4 20          	cmpl   $0x20,-0xc(%rbp)
+  8063ee:	74 28                	je     806418 <inet_aton+0x1e9>
+  8063f0:	83 7d f4 0c          	cmpl   $0xc,-0xc(%rbp)
+  8063f4:	74 22                	je     806418 <inet_aton+0x1e9>
+  8063f6:	83 7d f4 0a          	cmpl   $0xa,-0xc(%rbp)
+  8063fa:	74 1c                	je     806418 <inet_aton+0x1e9>
+  8063fc:	83 7d f4 0d          	cmpl   $0xd,-0xc(%rbp)
+  806400:	74 16                	je     806418 <inet_aton+0x1e9>
+  806402:	83 7d f4 09          	cmpl   $0x9,-0xc(%rbp)
+  806406:	74 10                	je     806418 <inet_aton+0x1e9>
+  806408:	83 7d f4 0b          	cmpl   $0xb,-0xc(%rbp)
+  80640c:	74 0a                	je     806418 <inet_aton+0x1e9>
+    return (0);
+  80640e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806413:	e9 e6 00 00 00       	jmp    8064fe <inet_aton+0x2cf>
+  /*
+   * Concoct the address according to
+   * the number of parts specified.
+   */
+  n = pp - parts + 1;
+  806418:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  80641c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806420:	48 29 d1             	sub    %rdx,%rcx
+  806423:	48 c1 f9 02          	sar    $0x2,%rcx
+  806427:	48 89 ca             	mov    %rcx,%rdx
+  80642a:	83 c2 01             	add    $0x1,%edx
+  80642d:	89 55 e4             	mov    %edx,-0x1c(%rbp)
+  switch (n) {
+  806430:	83 7d e4 04          	cmpl   $0x4,-0x1c(%rbp)
+  806434:	0f 87 9d 00 00 00    	ja     8064d7 <inet_aton+0x2a8>
+  80643a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80643d:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+  806444:	00 
+  806445:	48 8d 15 9c 09 00 00 	lea    0x99c(%rip),%rdx        # 806de8 <.LC1+0x5>
+  80644c:	48 8b 14 11          	mov    (%rcx,%rdx,1),%rdx
+  806450:	48 8d 0d 91 09 00 00 	lea    0x991(%rip),%rcx        # 806de8 <.LC1+0x5>
+  806457:	48 01 ca             	add    %rcx,%rdx
+  80645a:	ff e2                	jmp    *%rdx
+
+  case 0:
+    return (0);       /* initial nondigit */
+  80645c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806461:	e9 98 00 00 00       	jmp    8064fe <inet_aton+0x2cf>
+
+  case 1:             /* a -- 32 bits */
+    break;
+
+  case 2:             /* a.b -- 8.24 bits */
+    if (val > 0xffffffUL)
+  806466:	81 7d fc ff ff ff 00 	cmpl   $0xffffff,-0x4(%rbp)
+  80646d:	76 0a                	jbe    806479 <inet_aton+0x24a>
+      return (0);
+  80646f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806474:	e9 85 00 00 00       	jmp    8064fe <inet_aton+0x2cf>
+    val |= parts[0] << 24;
+  806479:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  80647c:	c1 e2 18             	shl    $0x18,%edx
+  80647f:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  806482:	eb 53                	jmp    8064d7 <inet_aton+0x2a8>
+
+  case 3:             /* a.b.c -- 8.8.16 bits */
+    if (val > 0xffff)
+  806484:	81 7d fc ff ff 00 00 	cmpl   $0xffff,-0x4(%rbp)
+  80648b:	76 07                	jbe    806494 <inet_aton+0x265>
+      return (0);
+  80648d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806492:	eb 6a                	jmp    8064fe <inet_aton+0x2cf>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  806494:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  806497:	89 d1                	mov    %edx,%ecx
+  806499:	c1 e1 18             	shl    $0x18,%ecx
+  80649c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80649f:	c1 e2 10             	shl    $0x10,%edx
+  8064a2:	09 ca                	or     %ecx,%edx
+  8064a4:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  8064a7:	eb 2e                	jmp    8064d7 <inet_aton+0x2a8>
+
+  case 4:             /* a.b.c.d -- 8.8.8.8 bits */
+    if (val > 0xff)
+  8064a9:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%rbp)
+  8064b0:	76 07                	jbe    8064b9 <inet_aton+0x28a>
+      return (0);
+  8064b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064b7:	eb 45                	jmp    8064fe <inet_aton+0x2cf>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  8064b9:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8064bc:	89 d1                	mov    %edx,%ecx
+  8064be:	c1 e1 18             	shl    $0x18,%ecx
+  8064c1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8064c4:	c1 e2 10             	shl    $0x10,%edx
+  8064c7:	09 d1                	or     %edx,%ecx
+  8064c9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8064cc:	c1 e2 08             	shl    $0x8,%edx
+  8064cf:	09 ca                	or     %ecx,%edx
+  8064d1:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  8064d4:	eb 01                	jmp    8064d7 <inet_aton+0x2a8>
+    break;
+  8064d6:	90                   	nop
+  }
+  if (addr)
+  8064d7:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8064dc:	74 1b                	je     8064f9 <inet_aton+0x2ca>
+    addr->s_addr = htonl(val);
+  8064de:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8064e1:	89 d7                	mov    %edx,%edi
+  8064e3:	48 ba 6b d6 ff ff ff 	movabs $0xffffffffffffd66b,%rdx
+  8064ea:	ff ff ff 
+  8064ed:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8064f1:	ff d0                	call   *%rax
+  8064f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8064f7:	89 02                	mov    %eax,(%rdx)
+  return (1);
+  8064f9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8064fe:	c9                   	leave
+  8064ff:	c3                   	ret
+
+0000000000806500 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  806500:	55                   	push   %rbp
+  806501:	48 89 e5             	mov    %rsp,%rbp
+  806504:	48 83 ec 28          	sub    $0x28,%rsp
+  806508:	48 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%rdx        # 806508 <inet_ntoa+0x8>
+  80650f:	49 bb 28 2b 00 00 00 	movabs $0x2b28,%r11
+  806516:	00 00 00 
+  806519:	4c 01 da             	add    %r11,%rdx
+  80651c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  80651f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806522:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  u8_t *ap;
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  806525:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  80652c:	00 00 00 
+  80652f:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  806533:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  ap = (u8_t *)&s_addr;
+  806537:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80653b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(n = 0; n < 4; n++) {
+  80653f:	c6 45 ef 00          	movb   $0x0,-0x11(%rbp)
+  806543:	e9 bc 00 00 00       	jmp    806604 <inet_ntoa+0x104>
+    i = 0;
+  806548:	c6 45 ee 00          	movb   $0x0,-0x12(%rbp)
+    do {
+      rem = *ap % (u8_t)10;
+  80654c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806550:	0f b6 08             	movzbl (%rax),%ecx
+  806553:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  806558:	89 f0                	mov    %esi,%eax
+  80655a:	f6 e1                	mul    %cl
+  80655c:	66 c1 e8 08          	shr    $0x8,%ax
+  806560:	c0 e8 03             	shr    $0x3,%al
+  806563:	88 45 ed             	mov    %al,-0x13(%rbp)
+  806566:	0f b6 75 ed          	movzbl -0x13(%rbp),%esi
+  80656a:	89 f0                	mov    %esi,%eax
+  80656c:	c1 e0 02             	shl    $0x2,%eax
+  80656f:	01 f0                	add    %esi,%eax
+  806571:	01 c0                	add    %eax,%eax
+  806573:	29 c1                	sub    %eax,%ecx
+  806575:	88 4d ed             	mov    %cl,-0x13(%rbp)
+      *ap /= (u8_t)10;
+  806578:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80657c:	0f b6 00             	movzbl (%rax),%eax
+  80657f:	b9 cd ff ff ff       	mov    $0xffffffcd,%ecx
+  806584:	f6 e1                	mul    %cl
+  806586:	66 c1 e8 08          	shr    $0x8,%ax
+  80658a:	89 c1                	mov    %eax,%ecx
+  80658c:	c0 e9 03             	shr    $0x3,%cl
+  80658f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806593:	88 08                	mov    %cl,(%rax)
+      inv[i++] = '0' + rem;
+  806595:	0f b6 45 ed          	movzbl -0x13(%rbp),%eax
+  806599:	8d 70 30             	lea    0x30(%rax),%esi
+  80659c:	0f b6 45 ee          	movzbl -0x12(%rbp),%eax
+  8065a0:	8d 48 01             	lea    0x1(%rax),%ecx
+  8065a3:	88 4d ee             	mov    %cl,-0x12(%rbp)
+  8065a6:	0f b6 c0             	movzbl %al,%eax
+  8065a9:	89 f1                	mov    %esi,%ecx
+  8065ab:	48 98                	cltq
+  8065ad:	88 4c 05 e5          	mov    %cl,-0x1b(%rbp,%rax,1)
+    } while(*ap);
+  8065b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065b5:	0f b6 00             	movzbl (%rax),%eax
+  8065b8:	84 c0                	test   %al,%al
+  8065ba:	75 90                	jne    80654c <inet_ntoa+0x4c>
+    while(i--)
+  8065bc:	eb 1a                	jmp    8065d8 <inet_ntoa+0xd8>
+      *rp++ = inv[i];
+  8065be:	0f b6 75 ee          	movzbl -0x12(%rbp),%esi
+  8065c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065c6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8065ca:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  8065ce:	48 63 ce             	movslq %esi,%rcx
+  8065d1:	0f b6 4c 0d e5       	movzbl -0x1b(%rbp,%rcx,1),%ecx
+  8065d6:	88 08                	mov    %cl,(%rax)
+    while(i--)
+  8065d8:	0f b6 45 ee          	movzbl -0x12(%rbp),%eax
+  8065dc:	8d 48 ff             	lea    -0x1(%rax),%ecx
+  8065df:	88 4d ee             	mov    %cl,-0x12(%rbp)
+  8065e2:	84 c0                	test   %al,%al
+  8065e4:	75 d8                	jne    8065be <inet_ntoa+0xbe>
+    *rp++ = '.';
+  8065e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065ea:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8065ee:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  8065f2:	c6 00 2e             	movb   $0x2e,(%rax)
+    ap++;
+  8065f5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  for(n = 0; n < 4; n++) {
+  8065fa:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  8065fe:	83 c0 01             	add    $0x1,%eax
+  806601:	88 45 ef             	mov    %al,-0x11(%rbp)
+  806604:	80 7d ef 03          	cmpb   $0x3,-0x11(%rbp)
+  806608:	0f 86 3a ff ff ff    	jbe    806548 <inet_ntoa+0x48>
+  }
+  *--rp = 0;
+  80660e:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  806613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806617:	c6 00 00             	movb   $0x0,(%rax)
+  return str;
+  80661a:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  806621:	00 00 00 
+  806624:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+}
+  806628:	c9                   	leave
+  806629:	c3                   	ret
+
+000000000080662a <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  80662a:	55                   	push   %rbp
+  80662b:	48 89 e5             	mov    %rsp,%rbp
+  80662e:	48 83 ec 08          	sub    $0x8,%rsp
+  806632:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806632 <htons+0x8>
+  806639:	49 bb fe 29 00 00 00 	movabs $0x29fe,%r11
+  806640:	00 00 00 
+  806643:	4c 01 d8             	add    %r11,%rax
+  806646:	89 f8                	mov    %edi,%eax
+  806648:	66 89 45 fc          	mov    %ax,-0x4(%rbp)
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  80664c:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+  806650:	c1 e0 08             	shl    $0x8,%eax
+  806653:	89 c2                	mov    %eax,%edx
+  806655:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+  806659:	66 c1 e8 08          	shr    $0x8,%ax
+  80665d:	09 d0                	or     %edx,%eax
+}
+  80665f:	c9                   	leave
+  806660:	c3                   	ret
+
+0000000000806661 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  806661:	55                   	push   %rbp
+  806662:	48 89 e5             	mov    %rsp,%rbp
+  806665:	48 83 ec 08          	sub    $0x8,%rsp
+  806669:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806669 <ntohs+0x8>
+  806670:	49 bb c7 29 00 00 00 	movabs $0x29c7,%r11
+  806677:	00 00 00 
+  80667a:	4c 01 d8             	add    %r11,%rax
+  80667d:	89 fa                	mov    %edi,%edx
+  80667f:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+  return htons(n);
+  806683:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+  806687:	89 d7                	mov    %edx,%edi
+  806689:	48 ba fa d5 ff ff ff 	movabs $0xffffffffffffd5fa,%rdx
+  806690:	ff ff ff 
+  806693:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806697:	ff d0                	call   *%rax
+}
+  806699:	c9                   	leave
+  80669a:	c3                   	ret
+
+000000000080669b <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  80669b:	55                   	push   %rbp
+  80669c:	48 89 e5             	mov    %rsp,%rbp
+  80669f:	48 83 ec 08          	sub    $0x8,%rsp
+  8066a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8066a3 <htonl+0x8>
+  8066aa:	49 bb 8d 29 00 00 00 	movabs $0x298d,%r11
+  8066b1:	00 00 00 
+  8066b4:	4c 01 d8             	add    %r11,%rax
+  8066b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return ((n & 0xff) << 24) |
+  8066ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8066bd:	c1 e0 18             	shl    $0x18,%eax
+  8066c0:	89 c2                	mov    %eax,%edx
+    ((n & 0xff00) << 8) |
+  8066c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8066c5:	c1 e0 08             	shl    $0x8,%eax
+  8066c8:	25 00 00 ff 00       	and    $0xff0000,%eax
+  return ((n & 0xff) << 24) |
+  8066cd:	09 c2                	or     %eax,%edx
+    ((n & 0xff0000UL) >> 8) |
+  8066cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8066d2:	48 c1 e8 08          	shr    $0x8,%rax
+  8066d6:	25 00 ff 00 00       	and    $0xff00,%eax
+    ((n & 0xff00) << 8) |
+  8066db:	09 c2                	or     %eax,%edx
+    ((n & 0xff000000UL) >> 24);
+  8066dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8066e0:	c1 e8 18             	shr    $0x18,%eax
+    ((n & 0xff0000UL) >> 8) |
+  8066e3:	09 d0                	or     %edx,%eax
+}
+  8066e5:	c9                   	leave
+  8066e6:	c3                   	ret
+
+00000000008066e7 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8066e7:	55                   	push   %rbp
+  8066e8:	48 89 e5             	mov    %rsp,%rbp
+  8066eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8066ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8066ef <ntohl+0x8>
+  8066f6:	49 bb 41 29 00 00 00 	movabs $0x2941,%r11
+  8066fd:	00 00 00 
+  806700:	4c 01 d8             	add    %r11,%rax
+  806703:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return htonl(n);
+  806706:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806709:	89 d7                	mov    %edx,%edi
+  80670b:	48 ba 6b d6 ff ff ff 	movabs $0xffffffffffffd66b,%rdx
+  806712:	ff ff ff 
+  806715:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806719:	ff d0                	call   *%rax
+}
+  80671b:	c9                   	leave
+  80671c:	c3                   	ret
@@ -0,0 +1,10568 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 06 02 00 00       	call   800247 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	41 54                	push   %r12
+  80004b:	53                   	push   %rbx
+  80004c:	48 83 ec 28          	sub    $0x28,%rsp
+  800050:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800050 <umain+0xd>
+  800057:	49 bb f0 8f 00 00 00 	movabs $0x8ff0,%r11
+  80005e:	00 00 00 
+  800061:	4c 01 db             	add    %r11,%rbx
+  800064:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800067:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	envid_t who, id;
+	uint32_t n;
+
+	id = sys_getenvid();
+  80006b:	49 89 df             	mov    %rbx,%r15
+  80006e:	48 b8 64 8e ff ff ff 	movabs $0xffffffffffff8e64,%rax
+  800075:	ff ff ff 
+  800078:	48 01 d8             	add    %rbx,%rax
+  80007b:	ff d0                	call   *%rax
+  80007d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+
+	if (thisenv == &envs[1]) {
+  800080:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800087:	ff ff ff 
+  80008a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80008e:	48 8b 10             	mov    (%rax),%rdx
+  800091:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  800098:	ff ff ff 
+  80009b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80009f:	48 8d 80 b8 01 00 00 	lea    0x1b8(%rax),%rax
+  8000a6:	48 39 c2             	cmp    %rax,%rdx
+  8000a9:	75 6d                	jne    800118 <umain+0xd5>
+		while (1) {
+			ipc_recv(&who, 0, 0);
+  8000ab:	48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+  8000af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b9:	48 89 c7             	mov    %rax,%rdi
+  8000bc:	49 89 df             	mov    %rbx,%r15
+  8000bf:	48 b8 42 a2 ff ff ff 	movabs $0xffffffffffffa242,%rax
+  8000c6:	ff ff ff 
+  8000c9:	48 01 d8             	add    %rbx,%rax
+  8000cc:	ff d0                	call   *%rax
+			cprintf("%x recv from %x (prio %d)\n", id, who, thisenv->env_prio);
+  8000ce:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8000d5:	ff ff ff 
+  8000d8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8000dc:	48 8b 00             	mov    (%rax),%rax
+  8000df:	8b 88 ec 00 00 00    	mov    0xec(%rax),%ecx
+  8000e5:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8000e8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8000eb:	89 c6                	mov    %eax,%esi
+  8000ed:	48 b8 a8 dc ff ff ff 	movabs $0xffffffffffffdca8,%rax
+  8000f4:	ff ff ff 
+  8000f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000fb:	48 89 c7             	mov    %rax,%rdi
+  8000fe:	49 89 df             	mov    %rbx,%r15
+  800101:	b8 00 00 00 00       	mov    $0x0,%eax
+  800106:	49 b8 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%r8
+  80010d:	ff ff ff 
+  800110:	49 01 d8             	add    %rbx,%r8
+  800113:	41 ff d0             	call   *%r8
+			ipc_recv(&who, 0, 0);
+  800116:	eb 93                	jmp    8000ab <umain+0x68>
+		}
+	} else {
+		if (thisenv == &envs[2] && fork() == 0) {
+  800118:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80011f:	ff ff ff 
+  800122:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800126:	48 8b 10             	mov    (%rax),%rdx
+  800129:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  800130:	ff ff ff 
+  800133:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800137:	48 8d 80 70 03 00 00 	lea    0x370(%rax),%rax
+  80013e:	48 39 c2             	cmp    %rax,%rdx
+  800141:	0f 85 86 00 00 00    	jne    8001cd <umain+0x18a>
+  800147:	49 89 df             	mov    %rbx,%r15
+  80014a:	48 b8 9c 9e ff ff ff 	movabs $0xffffffffffff9e9c,%rax
+  800151:	ff ff ff 
+  800154:	48 01 d8             	add    %rbx,%rax
+  800157:	ff d0                	call   *%rax
+  800159:	85 c0                	test   %eax,%eax
+  80015b:	75 70                	jne    8001cd <umain+0x18a>
+			for (n = 1; ; n++)
+  80015d:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%rbp)
+				if ((n & 0xffffff) == 0)
+  800164:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800167:	25 ff ff ff 00       	and    $0xffffff,%eax
+  80016c:	85 c0                	test   %eax,%eax
+  80016e:	75 57                	jne    8001c7 <umain+0x184>
+					cprintf("%x spinning (prio %d)\n",
+						sys_getenvid(), thisenv->env_prio);
+  800170:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800177:	ff ff ff 
+  80017a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80017e:	48 8b 00             	mov    (%rax),%rax
+  800181:	44 8b a0 ec 00 00 00 	mov    0xec(%rax),%r12d
+					cprintf("%x spinning (prio %d)\n",
+  800188:	49 89 df             	mov    %rbx,%r15
+  80018b:	48 b8 64 8e ff ff ff 	movabs $0xffffffffffff8e64,%rax
+  800192:	ff ff ff 
+  800195:	48 01 d8             	add    %rbx,%rax
+  800198:	ff d0                	call   *%rax
+  80019a:	44 89 e2             	mov    %r12d,%edx
+  80019d:	89 c6                	mov    %eax,%esi
+  80019f:	48 b8 c3 dc ff ff ff 	movabs $0xffffffffffffdcc3,%rax
+  8001a6:	ff ff ff 
+  8001a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001ad:	48 89 c7             	mov    %rax,%rdi
+  8001b0:	49 89 df             	mov    %rbx,%r15
+  8001b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b8:	48 b9 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rcx
+  8001bf:	ff ff ff 
+  8001c2:	48 01 d9             	add    %rbx,%rcx
+  8001c5:	ff d1                	call   *%rcx
+			for (n = 1; ; n++)
+  8001c7:	83 45 dc 01          	addl   $0x1,-0x24(%rbp)
+				if ((n & 0xffffff) == 0)
+  8001cb:	eb 97                	jmp    800164 <umain+0x121>
+		}
+		cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  8001cd:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8001d4:	ff ff ff 
+  8001d7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8001db:	8b 90 80 02 00 00    	mov    0x280(%rax),%edx
+  8001e1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8001e4:	89 c6                	mov    %eax,%esi
+  8001e6:	48 b8 da dc ff ff ff 	movabs $0xffffffffffffdcda,%rax
+  8001ed:	ff ff ff 
+  8001f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f4:	48 89 c7             	mov    %rax,%rdi
+  8001f7:	49 89 df             	mov    %rbx,%r15
+  8001fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ff:	48 b9 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rcx
+  800206:	ff ff ff 
+  800209:	48 01 d9             	add    %rbx,%rcx
+  80020c:	ff d1                	call   *%rcx
+		while (1)
+			ipc_send(envs[1].env_id, 0, 0, 0);
+  80020e:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  800215:	ff ff ff 
+  800218:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80021c:	8b 80 80 02 00 00    	mov    0x280(%rax),%eax
+  800222:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800227:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022c:	be 00 00 00 00       	mov    $0x0,%esi
+  800231:	89 c7                	mov    %eax,%edi
+  800233:	49 89 df             	mov    %rbx,%r15
+  800236:	48 b8 2b a3 ff ff ff 	movabs $0xffffffffffffa32b,%rax
+  80023d:	ff ff ff 
+  800240:	48 01 d8             	add    %rbx,%rax
+  800243:	ff d0                	call   *%rax
+  800245:	eb c7                	jmp    80020e <umain+0x1cb>
+
+0000000000800247 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800247:	55                   	push   %rbp
+  800248:	48 89 e5             	mov    %rsp,%rbp
+  80024b:	41 57                	push   %r15
+  80024d:	53                   	push   %rbx
+  80024e:	48 83 ec 20          	sub    $0x20,%rsp
+  800252:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800252 <libmain+0xb>
+  800259:	49 bb ee 8d 00 00 00 	movabs $0x8dee,%r11
+  800260:	00 00 00 
+  800263:	4c 01 db             	add    %r11,%rbx
+  800266:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800269:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80026d:	49 89 df             	mov    %rbx,%r15
+  800270:	48 b8 64 8e ff ff ff 	movabs $0xffffffffffff8e64,%rax
+  800277:	ff ff ff 
+  80027a:	48 01 d8             	add    %rbx,%rax
+  80027d:	ff d0                	call   *%rax
+  80027f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800282:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800285:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80028a:	48 98                	cltq
+  80028c:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800293:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80029a:	ff ff ff 
+  80029d:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8002a1:	48 01 c2             	add    %rax,%rdx
+  8002a4:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8002ab:	00 00 00 
+  8002ae:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002b2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8002b6:	7e 15                	jle    8002cd <libmain+0x86>
+		binaryname = argv[0];
+  8002b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8002bc:	48 8b 00             	mov    (%rax),%rax
+  8002bf:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8002c6:	00 00 00 
+  8002c9:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8002cd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8002d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8002d4:	48 89 d6             	mov    %rdx,%rsi
+  8002d7:	89 c7                	mov    %eax,%edi
+  8002d9:	49 89 df             	mov    %rbx,%r15
+  8002dc:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8002e3:	ff ff ff 
+  8002e6:	48 01 d8             	add    %rbx,%rax
+  8002e9:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8002eb:	49 89 df             	mov    %rbx,%r15
+  8002ee:	48 b8 c7 72 ff ff ff 	movabs $0xffffffffffff72c7,%rax
+  8002f5:	ff ff ff 
+  8002f8:	48 01 d8             	add    %rbx,%rax
+  8002fb:	ff d0                	call   *%rax
+}
+  8002fd:	90                   	nop
+  8002fe:	48 83 c4 20          	add    $0x20,%rsp
+  800302:	5b                   	pop    %rbx
+  800303:	41 5f                	pop    %r15
+  800305:	5d                   	pop    %rbp
+  800306:	c3                   	ret
+
+0000000000800307 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800307:	55                   	push   %rbp
+  800308:	48 89 e5             	mov    %rsp,%rbp
+  80030b:	41 57                	push   %r15
+  80030d:	53                   	push   %rbx
+  80030e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80030e <exit+0x7>
+  800315:	49 bb 32 8d 00 00 00 	movabs $0x8d32,%r11
+  80031c:	00 00 00 
+  80031f:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800322:	49 89 df             	mov    %rbx,%r15
+  800325:	48 b8 39 ae ff ff ff 	movabs $0xffffffffffffae39,%rax
+  80032c:	ff ff ff 
+  80032f:	48 01 d8             	add    %rbx,%rax
+  800332:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800334:	bf 00 00 00 00       	mov    $0x0,%edi
+  800339:	49 89 df             	mov    %rbx,%r15
+  80033c:	48 b8 08 8e ff ff ff 	movabs $0xffffffffffff8e08,%rax
+  800343:	ff ff ff 
+  800346:	48 01 d8             	add    %rbx,%rax
+  800349:	ff d0                	call   *%rax
+}
+  80034b:	90                   	nop
+  80034c:	5b                   	pop    %rbx
+  80034d:	41 5f                	pop    %r15
+  80034f:	5d                   	pop    %rbp
+  800350:	c3                   	ret
+
+0000000000800351 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800351:	55                   	push   %rbp
+  800352:	48 89 e5             	mov    %rsp,%rbp
+  800355:	41 57                	push   %r15
+  800357:	48 83 ec 18          	sub    $0x18,%rsp
+  80035b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80035b <putch+0xa>
+  800362:	49 bb e5 8c 00 00 00 	movabs $0x8ce5,%r11
+  800369:	00 00 00 
+  80036c:	4c 01 d8             	add    %r11,%rax
+  80036f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800372:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800376:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80037a:	8b 12                	mov    (%rdx),%edx
+  80037c:	8d 72 01             	lea    0x1(%rdx),%esi
+  80037f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800383:	89 31                	mov    %esi,(%rcx)
+  800385:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800388:	89 ce                	mov    %ecx,%esi
+  80038a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80038e:	48 63 d2             	movslq %edx,%rdx
+  800391:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800396:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80039a:	8b 12                	mov    (%rdx),%edx
+  80039c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003a2:	75 33                	jne    8003d7 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8003a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003a8:	8b 12                	mov    (%rdx),%edx
+  8003aa:	48 63 d2             	movslq %edx,%rdx
+  8003ad:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8003b1:	48 83 c1 08          	add    $0x8,%rcx
+  8003b5:	48 89 d6             	mov    %rdx,%rsi
+  8003b8:	48 89 cf             	mov    %rcx,%rdi
+  8003bb:	49 89 c7             	mov    %rax,%r15
+  8003be:	48 ba 55 8d ff ff ff 	movabs $0xffffffffffff8d55,%rdx
+  8003c5:	ff ff ff 
+  8003c8:	48 01 c2             	add    %rax,%rdx
+  8003cb:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8003cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003d1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8003d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003db:	8b 40 04             	mov    0x4(%rax),%eax
+  8003de:	8d 50 01             	lea    0x1(%rax),%edx
+  8003e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003e5:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8003e8:	90                   	nop
+  8003e9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8003ed:	c9                   	leave
+  8003ee:	c3                   	ret
+
+00000000008003ef <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003ef:	55                   	push   %rbp
+  8003f0:	48 89 e5             	mov    %rsp,%rbp
+  8003f3:	41 57                	push   %r15
+  8003f5:	53                   	push   %rbx
+  8003f6:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8003fd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8003fd <vcprintf+0xe>
+  800404:	49 bb 43 8c 00 00 00 	movabs $0x8c43,%r11
+  80040b:	00 00 00 
+  80040e:	4c 01 db             	add    %r11,%rbx
+  800411:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800418:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80041f:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800426:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80042d:	48 8b 06             	mov    (%rsi),%rax
+  800430:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800434:	48 89 01             	mov    %rax,(%rcx)
+  800437:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80043b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80043f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800443:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  80044a:	00 00 00 
+    b.cnt = 0;
+  80044d:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800454:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800457:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80045e:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800465:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80046c:	48 89 c6             	mov    %rax,%rsi
+  80046f:	48 b8 11 73 ff ff ff 	movabs $0xffffffffffff7311,%rax
+  800476:	ff ff ff 
+  800479:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80047d:	48 89 c7             	mov    %rax,%rdi
+  800480:	49 89 df             	mov    %rbx,%r15
+  800483:	48 b8 d3 78 ff ff ff 	movabs $0xffffffffffff78d3,%rax
+  80048a:	ff ff ff 
+  80048d:	48 01 d8             	add    %rbx,%rax
+  800490:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800492:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800498:	48 98                	cltq
+  80049a:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8004a1:	48 83 c2 08          	add    $0x8,%rdx
+  8004a5:	48 89 c6             	mov    %rax,%rsi
+  8004a8:	48 89 d7             	mov    %rdx,%rdi
+  8004ab:	49 89 df             	mov    %rbx,%r15
+  8004ae:	48 b8 55 8d ff ff ff 	movabs $0xffffffffffff8d55,%rax
+  8004b5:	ff ff ff 
+  8004b8:	48 01 d8             	add    %rbx,%rax
+  8004bb:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8004bd:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8004c3:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8004ca:	5b                   	pop    %rbx
+  8004cb:	41 5f                	pop    %r15
+  8004cd:	5d                   	pop    %rbp
+  8004ce:	c3                   	ret
+
+00000000008004cf <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8004cf:	55                   	push   %rbp
+  8004d0:	48 89 e5             	mov    %rsp,%rbp
+  8004d3:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8004da:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8004da <cprintf+0xb>
+  8004e1:	49 bb 66 8b 00 00 00 	movabs $0x8b66,%r11
+  8004e8:	00 00 00 
+  8004eb:	4d 01 da             	add    %r11,%r10
+  8004ee:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004f5:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8004fc:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800503:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80050a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800511:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800518:	84 c0                	test   %al,%al
+  80051a:	74 20                	je     80053c <cprintf+0x6d>
+  80051c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800520:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800524:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800528:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80052c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800530:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800534:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800538:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80053c:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800543:	00 00 00 
+  800546:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80054d:	00 00 00 
+  800550:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800554:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80055b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800562:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800569:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800570:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800577:	48 8b 06             	mov    (%rsi),%rax
+  80057a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80057e:	48 89 01             	mov    %rax,(%rcx)
+  800581:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800585:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800589:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80058d:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800594:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80059b:	48 89 d6             	mov    %rdx,%rsi
+  80059e:	48 89 c7             	mov    %rax,%rdi
+  8005a1:	48 b8 af 73 ff ff ff 	movabs $0xffffffffffff73af,%rax
+  8005a8:	ff ff ff 
+  8005ab:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8005af:	ff d0                	call   *%rax
+  8005b1:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8005b7:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8005bd:	c9                   	leave
+  8005be:	c3                   	ret
+
+00000000008005bf <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005bf:	55                   	push   %rbp
+  8005c0:	48 89 e5             	mov    %rsp,%rbp
+  8005c3:	53                   	push   %rbx
+  8005c4:	48 83 ec 38          	sub    $0x38,%rsp
+  8005c8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8005c8 <printnum+0x9>
+  8005cf:	49 bb 78 8a 00 00 00 	movabs $0x8a78,%r11
+  8005d6:	00 00 00 
+  8005d9:	4c 01 db             	add    %r11,%rbx
+  8005dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8005e4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8005e8:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8005eb:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8005ef:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005f3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8005f6:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8005fa:	72 58                	jb     800654 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005fc:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8005ff:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800602:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800605:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800609:	ba 00 00 00 00       	mov    $0x0,%edx
+  80060e:	48 f7 f6             	div    %rsi
+  800611:	49 89 c2             	mov    %rax,%r10
+  800614:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800617:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80061a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80061e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800622:	41 89 c9             	mov    %ecx,%r9d
+  800625:	41 89 f8             	mov    %edi,%r8d
+  800628:	89 d1                	mov    %edx,%ecx
+  80062a:	4c 89 d2             	mov    %r10,%rdx
+  80062d:	48 89 c7             	mov    %rax,%rdi
+  800630:	48 b8 7f 75 ff ff ff 	movabs $0xffffffffffff757f,%rax
+  800637:	ff ff ff 
+  80063a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80063e:	ff d0                	call   *%rax
+  800640:	eb 1c                	jmp    80065e <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800642:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800646:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800649:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80064d:	48 89 d6             	mov    %rdx,%rsi
+  800650:	89 c7                	mov    %eax,%edi
+  800652:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800654:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800658:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80065c:	7f e4                	jg     800642 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80065e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800661:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800665:	ba 00 00 00 00       	mov    $0x0,%edx
+  80066a:	48 f7 f1             	div    %rcx
+  80066d:	48 b8 37 de ff ff ff 	movabs $0xffffffffffffde37,%rax
+  800674:	ff ff ff 
+  800677:	48 01 d8             	add    %rbx,%rax
+  80067a:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80067e:	0f be c0             	movsbl %al,%eax
+  800681:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800685:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800689:	48 89 d6             	mov    %rdx,%rsi
+  80068c:	89 c7                	mov    %eax,%edi
+  80068e:	ff d1                	call   *%rcx
+}
+  800690:	90                   	nop
+  800691:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800695:	c9                   	leave
+  800696:	c3                   	ret
+
+0000000000800697 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800697:	55                   	push   %rbp
+  800698:	48 89 e5             	mov    %rsp,%rbp
+  80069b:	48 83 ec 20          	sub    $0x20,%rsp
+  80069f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80069f <getuint+0x8>
+  8006a6:	49 bb a1 89 00 00 00 	movabs $0x89a1,%r11
+  8006ad:	00 00 00 
+  8006b0:	4c 01 d8             	add    %r11,%rax
+  8006b3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8006b7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8006ba:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8006be:	7e 4f                	jle    80070f <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8006c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006c4:	8b 00                	mov    (%rax),%eax
+  8006c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c9:	77 24                	ja     8006ef <getuint+0x58>
+  8006cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006cf:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d7:	8b 00                	mov    (%rax),%eax
+  8006d9:	89 c0                	mov    %eax,%eax
+  8006db:	48 01 d0             	add    %rdx,%rax
+  8006de:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e2:	8b 12                	mov    (%rdx),%edx
+  8006e4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006e7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006eb:	89 0a                	mov    %ecx,(%rdx)
+  8006ed:	eb 14                	jmp    800703 <getuint+0x6c>
+  8006ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006f3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006f7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006ff:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800703:	48 8b 00             	mov    (%rax),%rax
+  800706:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80070a:	e9 9d 00 00 00       	jmp    8007ac <getuint+0x115>
+	else if (lflag)
+  80070f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800713:	74 4c                	je     800761 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800715:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800719:	8b 00                	mov    (%rax),%eax
+  80071b:	83 f8 2f             	cmp    $0x2f,%eax
+  80071e:	77 24                	ja     800744 <getuint+0xad>
+  800720:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800724:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800728:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80072c:	8b 00                	mov    (%rax),%eax
+  80072e:	89 c0                	mov    %eax,%eax
+  800730:	48 01 d0             	add    %rdx,%rax
+  800733:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800737:	8b 12                	mov    (%rdx),%edx
+  800739:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80073c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800740:	89 0a                	mov    %ecx,(%rdx)
+  800742:	eb 14                	jmp    800758 <getuint+0xc1>
+  800744:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800748:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80074c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800750:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800754:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800758:	48 8b 00             	mov    (%rax),%rax
+  80075b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80075f:	eb 4b                	jmp    8007ac <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800761:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800765:	8b 00                	mov    (%rax),%eax
+  800767:	83 f8 2f             	cmp    $0x2f,%eax
+  80076a:	77 24                	ja     800790 <getuint+0xf9>
+  80076c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800770:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800774:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800778:	8b 00                	mov    (%rax),%eax
+  80077a:	89 c0                	mov    %eax,%eax
+  80077c:	48 01 d0             	add    %rdx,%rax
+  80077f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800783:	8b 12                	mov    (%rdx),%edx
+  800785:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800788:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80078c:	89 0a                	mov    %ecx,(%rdx)
+  80078e:	eb 14                	jmp    8007a4 <getuint+0x10d>
+  800790:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800794:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800798:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80079c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007a0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007a4:	8b 00                	mov    (%rax),%eax
+  8007a6:	89 c0                	mov    %eax,%eax
+  8007a8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8007ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8007b0:	c9                   	leave
+  8007b1:	c3                   	ret
+
+00000000008007b2 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8007b2:	55                   	push   %rbp
+  8007b3:	48 89 e5             	mov    %rsp,%rbp
+  8007b6:	48 83 ec 20          	sub    $0x20,%rsp
+  8007ba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007ba <printfloat+0x8>
+  8007c1:	49 bb 86 88 00 00 00 	movabs $0x8886,%r11
+  8007c8:	00 00 00 
+  8007cb:	4c 01 d8             	add    %r11,%rax
+  8007ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8007d6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8007da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007de:	48 85 c0             	test   %rax,%rax
+  8007e1:	79 12                	jns    8007f5 <printfloat+0x43>
+		putch('-',putdat);
+  8007e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007e7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007eb:	48 89 c6             	mov    %rax,%rsi
+  8007ee:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007f3:	ff d2                	call   *%rdx
+	
+}
+  8007f5:	90                   	nop
+  8007f6:	c9                   	leave
+  8007f7:	c3                   	ret
+
+00000000008007f8 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8007f8:	55                   	push   %rbp
+  8007f9:	48 89 e5             	mov    %rsp,%rbp
+  8007fc:	48 83 ec 20          	sub    $0x20,%rsp
+  800800:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800800 <getint+0x8>
+  800807:	49 bb 40 88 00 00 00 	movabs $0x8840,%r11
+  80080e:	00 00 00 
+  800811:	4c 01 d8             	add    %r11,%rax
+  800814:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800818:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80081b:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80081f:	7e 4f                	jle    800870 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800821:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800825:	8b 00                	mov    (%rax),%eax
+  800827:	83 f8 2f             	cmp    $0x2f,%eax
+  80082a:	77 24                	ja     800850 <getint+0x58>
+  80082c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800830:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800834:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800838:	8b 00                	mov    (%rax),%eax
+  80083a:	89 c0                	mov    %eax,%eax
+  80083c:	48 01 d0             	add    %rdx,%rax
+  80083f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800843:	8b 12                	mov    (%rdx),%edx
+  800845:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800848:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80084c:	89 0a                	mov    %ecx,(%rdx)
+  80084e:	eb 14                	jmp    800864 <getint+0x6c>
+  800850:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800854:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800858:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80085c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800860:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800864:	48 8b 00             	mov    (%rax),%rax
+  800867:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80086b:	e9 9d 00 00 00       	jmp    80090d <getint+0x115>
+	else if (lflag)
+  800870:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800874:	74 4c                	je     8008c2 <getint+0xca>
+		x=va_arg(*ap, long);
+  800876:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80087a:	8b 00                	mov    (%rax),%eax
+  80087c:	83 f8 2f             	cmp    $0x2f,%eax
+  80087f:	77 24                	ja     8008a5 <getint+0xad>
+  800881:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800885:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800889:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80088d:	8b 00                	mov    (%rax),%eax
+  80088f:	89 c0                	mov    %eax,%eax
+  800891:	48 01 d0             	add    %rdx,%rax
+  800894:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800898:	8b 12                	mov    (%rdx),%edx
+  80089a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80089d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008a1:	89 0a                	mov    %ecx,(%rdx)
+  8008a3:	eb 14                	jmp    8008b9 <getint+0xc1>
+  8008a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008a9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008ad:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008b5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008b9:	48 8b 00             	mov    (%rax),%rax
+  8008bc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8008c0:	eb 4b                	jmp    80090d <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8008c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008c6:	8b 00                	mov    (%rax),%eax
+  8008c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cb:	77 24                	ja     8008f1 <getint+0xf9>
+  8008cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008d1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008d9:	8b 00                	mov    (%rax),%eax
+  8008db:	89 c0                	mov    %eax,%eax
+  8008dd:	48 01 d0             	add    %rdx,%rax
+  8008e0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008e4:	8b 12                	mov    (%rdx),%edx
+  8008e6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008e9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008ed:	89 0a                	mov    %ecx,(%rdx)
+  8008ef:	eb 14                	jmp    800905 <getint+0x10d>
+  8008f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008f5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008f9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008fd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800901:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800905:	8b 00                	mov    (%rax),%eax
+  800907:	48 98                	cltq
+  800909:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80090d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800911:	c9                   	leave
+  800912:	c3                   	ret
+
+0000000000800913 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800913:	55                   	push   %rbp
+  800914:	48 89 e5             	mov    %rsp,%rbp
+  800917:	41 57                	push   %r15
+  800919:	41 55                	push   %r13
+  80091b:	41 54                	push   %r12
+  80091d:	53                   	push   %rbx
+  80091e:	48 83 ec 60          	sub    $0x60,%rsp
+  800922:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800922 <vprintfmt+0xf>
+  800929:	49 bb 1e 87 00 00 00 	movabs $0x871e,%r11
+  800930:	00 00 00 
+  800933:	4d 01 dc             	add    %r11,%r12
+  800936:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  80093a:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  80093e:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800942:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800946:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  80094d:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800951:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800955:	48 8b 06             	mov    (%rsi),%rax
+  800958:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80095c:	48 89 01             	mov    %rax,(%rcx)
+  80095f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800963:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800967:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80096b:	eb 17                	jmp    800984 <vprintfmt+0x71>
+			if (ch == '\0')
+  80096d:	85 db                	test   %ebx,%ebx
+  80096f:	0f 84 97 05 00 00    	je     800f0c <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800975:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800979:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80097d:	48 89 c6             	mov    %rax,%rsi
+  800980:	89 df                	mov    %ebx,%edi
+  800982:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800984:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800988:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80098c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800990:	0f b6 00             	movzbl (%rax),%eax
+  800993:	0f b6 d8             	movzbl %al,%ebx
+  800996:	83 fb 25             	cmp    $0x25,%ebx
+  800999:	75 d2                	jne    80096d <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  80099b:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  80099f:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  8009a6:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8009ad:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  8009b4:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  8009bb:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8009bf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009c3:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8009c7:	0f b6 00             	movzbl (%rax),%eax
+  8009ca:	0f b6 d8             	movzbl %al,%ebx
+  8009cd:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8009d0:	83 f8 55             	cmp    $0x55,%eax
+  8009d3:	0f 87 00 05 00 00    	ja     800ed9 <vprintfmt+0x5c6>
+  8009d9:	89 c0                	mov    %eax,%eax
+  8009db:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8009e2:	00 
+  8009e3:	48 8d 05 b6 64 00 00 	lea    0x64b6(%rip),%rax        # 806ea0 <.LC18+0xc>
+  8009ea:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  8009ee:	48 8d 15 ab 64 00 00 	lea    0x64ab(%rip),%rdx        # 806ea0 <.LC18+0xc>
+  8009f5:	48 01 d0             	add    %rdx,%rax
+  8009f8:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  8009fa:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  8009fe:	eb bb                	jmp    8009bb <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800a00:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800a04:	eb b5                	jmp    8009bb <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800a06:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800a0d:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800a10:	89 d0                	mov    %edx,%eax
+  800a12:	c1 e0 02             	shl    $0x2,%eax
+  800a15:	01 d0                	add    %edx,%eax
+  800a17:	01 c0                	add    %eax,%eax
+  800a19:	01 d8                	add    %ebx,%eax
+  800a1b:	83 e8 30             	sub    $0x30,%eax
+  800a1e:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800a21:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800a25:	0f b6 00             	movzbl (%rax),%eax
+  800a28:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800a2b:	83 fb 2f             	cmp    $0x2f,%ebx
+  800a2e:	7e 60                	jle    800a90 <vprintfmt+0x17d>
+  800a30:	83 fb 39             	cmp    $0x39,%ebx
+  800a33:	7f 5b                	jg     800a90 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800a35:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800a3a:	eb d1                	jmp    800a0d <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800a3c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a42:	77 17                	ja     800a5b <vprintfmt+0x148>
+  800a44:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a48:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a4b:	89 d2                	mov    %edx,%edx
+  800a4d:	48 01 d0             	add    %rdx,%rax
+  800a50:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a53:	83 c2 08             	add    $0x8,%edx
+  800a56:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800a59:	eb 0c                	jmp    800a67 <vprintfmt+0x154>
+  800a5b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a5f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a63:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800a67:	8b 00                	mov    (%rax),%eax
+  800a69:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800a6c:	eb 23                	jmp    800a91 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800a6e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a72:	0f 89 43 ff ff ff    	jns    8009bb <vprintfmt+0xa8>
+				width = 0;
+  800a78:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800a7f:	e9 37 ff ff ff       	jmp    8009bb <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800a84:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800a8b:	e9 2b ff ff ff       	jmp    8009bb <vprintfmt+0xa8>
+			goto process_precision;
+  800a90:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800a91:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a95:	0f 89 20 ff ff ff    	jns    8009bb <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800a9b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800a9e:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800aa1:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800aa8:	e9 0e ff ff ff       	jmp    8009bb <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800aad:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800ab1:	e9 05 ff ff ff       	jmp    8009bb <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800ab6:	83 fb 39             	cmp    $0x39,%ebx
+  800ab9:	7f 0b                	jg     800ac6 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800abb:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800abe:	c1 e0 08             	shl    $0x8,%eax
+  800ac1:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ac4:	eb 21                	jmp    800ae7 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800ac6:	83 fb 60             	cmp    $0x60,%ebx
+  800ac9:	7e 10                	jle    800adb <vprintfmt+0x1c8>
+  800acb:	83 fb 66             	cmp    $0x66,%ebx
+  800ace:	7f 0b                	jg     800adb <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800ad0:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800ad3:	c1 e0 08             	shl    $0x8,%eax
+  800ad6:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ad9:	eb 0c                	jmp    800ae7 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800adb:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800ae2:	e9 04 01 00 00       	jmp    800beb <vprintfmt+0x2d8>
+  800ae7:	e9 ff 00 00 00       	jmp    800beb <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800aec:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800aef:	83 f8 2f             	cmp    $0x2f,%eax
+  800af2:	77 17                	ja     800b0b <vprintfmt+0x1f8>
+  800af4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800af8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800afb:	89 d2                	mov    %edx,%edx
+  800afd:	48 01 d0             	add    %rdx,%rax
+  800b00:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b03:	83 c2 08             	add    $0x8,%edx
+  800b06:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b09:	eb 0c                	jmp    800b17 <vprintfmt+0x204>
+  800b0b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b0f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b13:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b17:	8b 00                	mov    (%rax),%eax
+  800b19:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800b1d:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800b21:	48 89 d6             	mov    %rdx,%rsi
+  800b24:	89 c7                	mov    %eax,%edi
+  800b26:	ff d1                	call   *%rcx
+			break;
+  800b28:	e9 da 03 00 00       	jmp    800f07 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800b2d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b30:	83 f8 2f             	cmp    $0x2f,%eax
+  800b33:	77 17                	ja     800b4c <vprintfmt+0x239>
+  800b35:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b39:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b3c:	89 d2                	mov    %edx,%edx
+  800b3e:	48 01 d0             	add    %rdx,%rax
+  800b41:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b44:	83 c2 08             	add    $0x8,%edx
+  800b47:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b4a:	eb 0c                	jmp    800b58 <vprintfmt+0x245>
+  800b4c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b50:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b54:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b58:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800b5a:	85 db                	test   %ebx,%ebx
+  800b5c:	79 02                	jns    800b60 <vprintfmt+0x24d>
+				err = -err;
+  800b5e:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b60:	83 fb 15             	cmp    $0x15,%ebx
+  800b63:	7f 19                	jg     800b7e <vprintfmt+0x26b>
+  800b65:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800b6c:	00 00 00 
+  800b6f:	48 63 c3             	movslq %ebx,%rax
+  800b72:	4c 01 e2             	add    %r12,%rdx
+  800b75:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800b79:	4d 85 ed             	test   %r13,%r13
+  800b7c:	75 36                	jne    800bb4 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800b7e:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b82:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b86:	89 d9                	mov    %ebx,%ecx
+  800b88:	48 ba 48 de ff ff ff 	movabs $0xffffffffffffde48,%rdx
+  800b8f:	ff ff ff 
+  800b92:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800b96:	48 89 c7             	mov    %rax,%rdi
+  800b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9e:	49 b8 da 7e ff ff ff 	movabs $0xffffffffffff7eda,%r8
+  800ba5:	ff ff ff 
+  800ba8:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800bac:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800baf:	e9 53 03 00 00       	jmp    800f07 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800bb4:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800bb8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bbc:	4c 89 e9             	mov    %r13,%rcx
+  800bbf:	48 ba 51 de ff ff ff 	movabs $0xffffffffffffde51,%rdx
+  800bc6:	ff ff ff 
+  800bc9:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800bcd:	48 89 c7             	mov    %rax,%rdi
+  800bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd5:	49 b8 da 7e ff ff ff 	movabs $0xffffffffffff7eda,%r8
+  800bdc:	ff ff ff 
+  800bdf:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800be3:	41 ff d0             	call   *%r8
+			break;
+  800be6:	e9 1c 03 00 00       	jmp    800f07 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800beb:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800bee:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf1:	77 17                	ja     800c0a <vprintfmt+0x2f7>
+  800bf3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800bf7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bfa:	89 d2                	mov    %edx,%edx
+  800bfc:	48 01 d0             	add    %rdx,%rax
+  800bff:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c02:	83 c2 08             	add    $0x8,%edx
+  800c05:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c08:	eb 0c                	jmp    800c16 <vprintfmt+0x303>
+  800c0a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c0e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c12:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c16:	4c 8b 28             	mov    (%rax),%r13
+  800c19:	4d 85 ed             	test   %r13,%r13
+  800c1c:	75 0e                	jne    800c2c <vprintfmt+0x319>
+				p = "(null)";
+  800c1e:	48 b8 54 de ff ff ff 	movabs $0xffffffffffffde54,%rax
+  800c25:	ff ff ff 
+  800c28:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800c2c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c30:	0f 8e 84 00 00 00    	jle    800cba <vprintfmt+0x3a7>
+  800c36:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800c3a:	74 7e                	je     800cba <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c3c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800c3f:	48 98                	cltq
+  800c41:	48 89 c6             	mov    %rax,%rsi
+  800c44:	4c 89 ef             	mov    %r13,%rdi
+  800c47:	4d 89 e7             	mov    %r12,%r15
+  800c4a:	48 b8 ff 81 ff ff ff 	movabs $0xffffffffffff81ff,%rax
+  800c51:	ff ff ff 
+  800c54:	4c 01 e0             	add    %r12,%rax
+  800c57:	ff d0                	call   *%rax
+  800c59:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800c5c:	eb 17                	jmp    800c75 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800c5e:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800c62:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c66:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c6a:	48 89 d6             	mov    %rdx,%rsi
+  800c6d:	89 c7                	mov    %eax,%edi
+  800c6f:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c71:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800c75:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c79:	7f e3                	jg     800c5e <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c7b:	eb 3d                	jmp    800cba <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800c7d:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800c81:	74 1e                	je     800ca1 <vprintfmt+0x38e>
+  800c83:	83 fb 1f             	cmp    $0x1f,%ebx
+  800c86:	7e 05                	jle    800c8d <vprintfmt+0x37a>
+  800c88:	83 fb 7e             	cmp    $0x7e,%ebx
+  800c8b:	7e 14                	jle    800ca1 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800c8d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c91:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c95:	48 89 c6             	mov    %rax,%rsi
+  800c98:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c9d:	ff d2                	call   *%rdx
+  800c9f:	eb 15                	jmp    800cb6 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800ca1:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800ca4:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800ca7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cab:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800caf:	48 89 c6             	mov    %rax,%rsi
+  800cb2:	89 cf                	mov    %ecx,%edi
+  800cb4:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800cb6:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800cba:	4c 89 e8             	mov    %r13,%rax
+  800cbd:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800cc1:	0f b6 00             	movzbl (%rax),%eax
+  800cc4:	0f be d8             	movsbl %al,%ebx
+  800cc7:	85 db                	test   %ebx,%ebx
+  800cc9:	74 28                	je     800cf3 <vprintfmt+0x3e0>
+  800ccb:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800ccf:	78 ac                	js     800c7d <vprintfmt+0x36a>
+  800cd1:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800cd5:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800cd9:	79 a2                	jns    800c7d <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800cdb:	eb 16                	jmp    800cf3 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800cdd:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ce1:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ce5:	48 89 c6             	mov    %rax,%rsi
+  800ce8:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ced:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800cef:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800cf3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800cf7:	7f e4                	jg     800cdd <vprintfmt+0x3ca>
+			break;
+  800cf9:	e9 09 02 00 00       	jmp    800f07 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800cfe:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d02:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d06:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d0a:	0f b6 00             	movzbl (%rax),%eax
+  800d0d:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800d10:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800d11:	83 fb 2f             	cmp    $0x2f,%ebx
+  800d14:	0f 8e ac fd ff ff    	jle    800ac6 <vprintfmt+0x1b3>
+  800d1a:	e9 97 fd ff ff       	jmp    800ab6 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800d1f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d23:	be 03 00 00 00       	mov    $0x3,%esi
+  800d28:	48 89 c7             	mov    %rax,%rdi
+  800d2b:	48 b8 b8 77 ff ff ff 	movabs $0xffffffffffff77b8,%rax
+  800d32:	ff ff ff 
+  800d35:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d39:	ff d0                	call   *%rax
+  800d3b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800d3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d43:	48 85 c0             	test   %rax,%rax
+  800d46:	79 1d                	jns    800d65 <vprintfmt+0x452>
+				putch('-', putdat);
+  800d48:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d4c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d50:	48 89 c6             	mov    %rax,%rsi
+  800d53:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d58:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800d5a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d5e:	48 f7 d8             	neg    %rax
+  800d61:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800d65:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800d6c:	e9 de 00 00 00       	jmp    800e4f <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800d71:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d75:	be 03 00 00 00       	mov    $0x3,%esi
+  800d7a:	48 89 c7             	mov    %rax,%rdi
+  800d7d:	48 b8 57 76 ff ff ff 	movabs $0xffffffffffff7657,%rax
+  800d84:	ff ff ff 
+  800d87:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d8b:	ff d0                	call   *%rax
+  800d8d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800d91:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800d98:	e9 b2 00 00 00       	jmp    800e4f <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800d9d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800da1:	be 03 00 00 00       	mov    $0x3,%esi
+  800da6:	48 89 c7             	mov    %rax,%rdi
+  800da9:	48 b8 57 76 ff ff ff 	movabs $0xffffffffffff7657,%rax
+  800db0:	ff ff ff 
+  800db3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800db7:	ff d0                	call   *%rax
+  800db9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800dbd:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800dc4:	e9 86 00 00 00       	jmp    800e4f <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800dc9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dcd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dd1:	48 89 c6             	mov    %rax,%rsi
+  800dd4:	bf 30 00 00 00       	mov    $0x30,%edi
+  800dd9:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800ddb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ddf:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800de3:	48 89 c6             	mov    %rax,%rsi
+  800de6:	bf 78 00 00 00       	mov    $0x78,%edi
+  800deb:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800ded:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800df0:	83 f8 2f             	cmp    $0x2f,%eax
+  800df3:	77 17                	ja     800e0c <vprintfmt+0x4f9>
+  800df5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800df9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dfc:	89 d2                	mov    %edx,%edx
+  800dfe:	48 01 d0             	add    %rdx,%rax
+  800e01:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e04:	83 c2 08             	add    $0x8,%edx
+  800e07:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e0a:	eb 0c                	jmp    800e18 <vprintfmt+0x505>
+  800e0c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e10:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e14:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e18:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800e1b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800e1f:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800e26:	eb 27                	jmp    800e4f <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800e28:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e2c:	be 03 00 00 00       	mov    $0x3,%esi
+  800e31:	48 89 c7             	mov    %rax,%rdi
+  800e34:	48 b8 57 76 ff ff ff 	movabs $0xffffffffffff7657,%rax
+  800e3b:	ff ff ff 
+  800e3e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e42:	ff d0                	call   *%rax
+  800e44:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800e48:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800e4f:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800e54:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800e57:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800e5a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800e5e:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e62:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e66:	45 89 c1             	mov    %r8d,%r9d
+  800e69:	41 89 f8             	mov    %edi,%r8d
+  800e6c:	48 89 c7             	mov    %rax,%rdi
+  800e6f:	48 b8 7f 75 ff ff ff 	movabs $0xffffffffffff757f,%rax
+  800e76:	ff ff ff 
+  800e79:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e7d:	ff d0                	call   *%rax
+			break;
+  800e7f:	e9 83 00 00 00       	jmp    800f07 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800e84:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e88:	be 03 00 00 00       	mov    $0x3,%esi
+  800e8d:	48 89 c7             	mov    %rax,%rdi
+  800e90:	48 b8 57 76 ff ff ff 	movabs $0xffffffffffff7657,%rax
+  800e97:	ff ff ff 
+  800e9a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e9e:	ff d0                	call   *%rax
+  800ea0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800ea4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800ea8:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800eac:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800eb0:	48 89 ce             	mov    %rcx,%rsi
+  800eb3:	48 89 c7             	mov    %rax,%rdi
+  800eb6:	48 b8 72 77 ff ff ff 	movabs $0xffffffffffff7772,%rax
+  800ebd:	ff ff ff 
+  800ec0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ec4:	ff d0                	call   *%rax
+	
+			break;
+  800ec6:	eb 3f                	jmp    800f07 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800ec8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ecc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ed0:	48 89 c6             	mov    %rax,%rsi
+  800ed3:	89 df                	mov    %ebx,%edi
+  800ed5:	ff d2                	call   *%rdx
+			break;
+  800ed7:	eb 2e                	jmp    800f07 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800ed9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800edd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ee1:	48 89 c6             	mov    %rax,%rsi
+  800ee4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ee9:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800eeb:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800ef0:	eb 05                	jmp    800ef7 <vprintfmt+0x5e4>
+  800ef2:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800ef7:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800efb:	48 83 e8 01          	sub    $0x1,%rax
+  800eff:	0f b6 00             	movzbl (%rax),%eax
+  800f02:	3c 25                	cmp    $0x25,%al
+  800f04:	75 ec                	jne    800ef2 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800f06:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f07:	e9 78 fa ff ff       	jmp    800984 <vprintfmt+0x71>
+				return;
+  800f0c:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800f0d:	48 83 c4 60          	add    $0x60,%rsp
+  800f11:	5b                   	pop    %rbx
+  800f12:	41 5c                	pop    %r12
+  800f14:	41 5d                	pop    %r13
+  800f16:	41 5f                	pop    %r15
+  800f18:	5d                   	pop    %rbp
+  800f19:	c3                   	ret
+
+0000000000800f1a <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  800f1a:	55                   	push   %rbp
+  800f1b:	48 89 e5             	mov    %rsp,%rbp
+  800f1e:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f25:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800f25 <printfmt+0xb>
+  800f2c:	49 bb 1b 81 00 00 00 	movabs $0x811b,%r11
+  800f33:	00 00 00 
+  800f36:	4d 01 da             	add    %r11,%r10
+  800f39:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f40:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f47:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f4e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f55:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f5c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f63:	84 c0                	test   %al,%al
+  800f65:	74 20                	je     800f87 <printfmt+0x6d>
+  800f67:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f6b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f6f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f73:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f77:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f7b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f7f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f83:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800f87:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f8e:	00 00 00 
+  800f91:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f98:	00 00 00 
+  800f9b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f9f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800fa6:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800fad:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800fb4:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800fbb:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800fc2:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800fc9:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800fd0:	48 89 c7             	mov    %rax,%rdi
+  800fd3:	48 b8 d3 78 ff ff ff 	movabs $0xffffffffffff78d3,%rax
+  800fda:	ff ff ff 
+  800fdd:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800fe1:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800fe3:	90                   	nop
+  800fe4:	c9                   	leave
+  800fe5:	c3                   	ret
+
+0000000000800fe6 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800fe6:	55                   	push   %rbp
+  800fe7:	48 89 e5             	mov    %rsp,%rbp
+  800fea:	48 83 ec 10          	sub    $0x10,%rsp
+  800fee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800fee <sprintputch+0x8>
+  800ff5:	49 bb 52 80 00 00 00 	movabs $0x8052,%r11
+  800ffc:	00 00 00 
+  800fff:	4c 01 d8             	add    %r11,%rax
+  801002:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801005:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801009:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80100d:	8b 40 10             	mov    0x10(%rax),%eax
+  801010:	8d 50 01             	lea    0x1(%rax),%edx
+  801013:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801017:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80101a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80101e:	48 8b 10             	mov    (%rax),%rdx
+  801021:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801025:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801029:	48 39 c2             	cmp    %rax,%rdx
+  80102c:	73 17                	jae    801045 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80102e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801032:	48 8b 00             	mov    (%rax),%rax
+  801035:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801039:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80103d:	48 89 0a             	mov    %rcx,(%rdx)
+  801040:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801043:	88 10                	mov    %dl,(%rax)
+}
+  801045:	90                   	nop
+  801046:	c9                   	leave
+  801047:	c3                   	ret
+
+0000000000801048 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801048:	55                   	push   %rbp
+  801049:	48 89 e5             	mov    %rsp,%rbp
+  80104c:	53                   	push   %rbx
+  80104d:	48 83 ec 58          	sub    $0x58,%rsp
+  801051:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801051 <vsnprintf+0x9>
+  801058:	49 bb ef 7f 00 00 00 	movabs $0x7fef,%r11
+  80105f:	00 00 00 
+  801062:	4c 01 d8             	add    %r11,%rax
+  801065:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801069:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80106c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801070:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801074:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801078:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80107c:	48 8b 0e             	mov    (%rsi),%rcx
+  80107f:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801083:	48 89 0a             	mov    %rcx,(%rdx)
+  801086:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80108a:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  80108e:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801092:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801096:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80109a:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80109d:	48 63 d2             	movslq %edx,%rdx
+  8010a0:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8010a4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8010a8:	48 01 ca             	add    %rcx,%rdx
+  8010ab:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8010af:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8010b6:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8010bb:	74 06                	je     8010c3 <vsnprintf+0x7b>
+  8010bd:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8010c1:	7f 07                	jg     8010ca <vsnprintf+0x82>
+		return -E_INVAL;
+  8010c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010c8:	eb 34                	jmp    8010fe <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8010ca:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8010ce:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8010d2:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8010d6:	48 bf a6 7f ff ff ff 	movabs $0xffffffffffff7fa6,%rdi
+  8010dd:	ff ff ff 
+  8010e0:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8010e4:	49 b8 d3 78 ff ff ff 	movabs $0xffffffffffff78d3,%r8
+  8010eb:	ff ff ff 
+  8010ee:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8010f2:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8010f4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8010f8:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8010fb:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8010fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801102:	c9                   	leave
+  801103:	c3                   	ret
+
+0000000000801104 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801104:	55                   	push   %rbp
+  801105:	48 89 e5             	mov    %rsp,%rbp
+  801108:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80110f:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80110f <snprintf+0xb>
+  801116:	49 bb 31 7f 00 00 00 	movabs $0x7f31,%r11
+  80111d:	00 00 00 
+  801120:	4d 01 da             	add    %r11,%r10
+  801123:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80112a:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801130:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801137:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80113e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801145:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80114c:	84 c0                	test   %al,%al
+  80114e:	74 20                	je     801170 <snprintf+0x6c>
+  801150:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801154:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801158:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80115c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801160:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801164:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801168:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80116c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801170:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801177:	00 00 00 
+  80117a:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801181:	00 00 00 
+  801184:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801188:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80118f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801196:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80119d:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8011a4:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8011ab:	48 8b 06             	mov    (%rsi),%rax
+  8011ae:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8011b2:	48 89 01             	mov    %rax,(%rcx)
+  8011b5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8011b9:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8011bd:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8011c1:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8011c8:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8011cf:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8011d5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8011dc:	48 89 c7             	mov    %rax,%rdi
+  8011df:	48 b8 08 80 ff ff ff 	movabs $0xffffffffffff8008,%rax
+  8011e6:	ff ff ff 
+  8011e9:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8011ed:	ff d0                	call   *%rax
+  8011ef:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8011f5:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8011fb:	c9                   	leave
+  8011fc:	c3                   	ret
+
+00000000008011fd <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8011fd:	55                   	push   %rbp
+  8011fe:	48 89 e5             	mov    %rsp,%rbp
+  801201:	48 83 ec 18          	sub    $0x18,%rsp
+  801205:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801205 <strlen+0x8>
+  80120c:	49 bb 3b 7e 00 00 00 	movabs $0x7e3b,%r11
+  801213:	00 00 00 
+  801216:	4c 01 d8             	add    %r11,%rax
+  801219:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80121d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801224:	eb 09                	jmp    80122f <strlen+0x32>
+		n++;
+  801226:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  80122a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80122f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801233:	0f b6 00             	movzbl (%rax),%eax
+  801236:	84 c0                	test   %al,%al
+  801238:	75 ec                	jne    801226 <strlen+0x29>
+	return n;
+  80123a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80123d:	c9                   	leave
+  80123e:	c3                   	ret
+
+000000000080123f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80123f:	55                   	push   %rbp
+  801240:	48 89 e5             	mov    %rsp,%rbp
+  801243:	48 83 ec 20          	sub    $0x20,%rsp
+  801247:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801247 <strnlen+0x8>
+  80124e:	49 bb f9 7d 00 00 00 	movabs $0x7df9,%r11
+  801255:	00 00 00 
+  801258:	4c 01 d8             	add    %r11,%rax
+  80125b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80125f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801263:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80126a:	eb 0e                	jmp    80127a <strnlen+0x3b>
+		n++;
+  80126c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801270:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801275:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80127a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80127f:	74 0b                	je     80128c <strnlen+0x4d>
+  801281:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801285:	0f b6 00             	movzbl (%rax),%eax
+  801288:	84 c0                	test   %al,%al
+  80128a:	75 e0                	jne    80126c <strnlen+0x2d>
+	return n;
+  80128c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80128f:	c9                   	leave
+  801290:	c3                   	ret
+
+0000000000801291 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801291:	55                   	push   %rbp
+  801292:	48 89 e5             	mov    %rsp,%rbp
+  801295:	48 83 ec 20          	sub    $0x20,%rsp
+  801299:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801299 <strcpy+0x8>
+  8012a0:	49 bb a7 7d 00 00 00 	movabs $0x7da7,%r11
+  8012a7:	00 00 00 
+  8012aa:	4c 01 d8             	add    %r11,%rax
+  8012ad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012b1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8012b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012b9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8012bd:	90                   	nop
+  8012be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012c2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012c6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ce:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012d2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012d6:	0f b6 12             	movzbl (%rdx),%edx
+  8012d9:	88 10                	mov    %dl,(%rax)
+  8012db:	0f b6 00             	movzbl (%rax),%eax
+  8012de:	84 c0                	test   %al,%al
+  8012e0:	75 dc                	jne    8012be <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8012e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8012e6:	c9                   	leave
+  8012e7:	c3                   	ret
+
+00000000008012e8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8012e8:	55                   	push   %rbp
+  8012e9:	48 89 e5             	mov    %rsp,%rbp
+  8012ec:	53                   	push   %rbx
+  8012ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8012f1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8012f1 <strcat+0x9>
+  8012f8:	49 bb 4f 7d 00 00 00 	movabs $0x7d4f,%r11
+  8012ff:	00 00 00 
+  801302:	4c 01 db             	add    %r11,%rbx
+  801305:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801309:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80130d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801311:	48 89 c7             	mov    %rax,%rdi
+  801314:	48 b8 bd 81 ff ff ff 	movabs $0xffffffffffff81bd,%rax
+  80131b:	ff ff ff 
+  80131e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801322:	ff d0                	call   *%rax
+  801324:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801327:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80132a:	48 63 d0             	movslq %eax,%rdx
+  80132d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801331:	48 01 c2             	add    %rax,%rdx
+  801334:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801338:	48 89 c6             	mov    %rax,%rsi
+  80133b:	48 89 d7             	mov    %rdx,%rdi
+  80133e:	48 b8 51 82 ff ff ff 	movabs $0xffffffffffff8251,%rax
+  801345:	ff ff ff 
+  801348:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80134c:	ff d0                	call   *%rax
+	return dst;
+  80134e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801352:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801356:	c9                   	leave
+  801357:	c3                   	ret
+
+0000000000801358 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801358:	55                   	push   %rbp
+  801359:	48 89 e5             	mov    %rsp,%rbp
+  80135c:	48 83 ec 28          	sub    $0x28,%rsp
+  801360:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801360 <strncpy+0x8>
+  801367:	49 bb e0 7c 00 00 00 	movabs $0x7ce0,%r11
+  80136e:	00 00 00 
+  801371:	4c 01 d8             	add    %r11,%rax
+  801374:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801378:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80137c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801380:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801384:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801388:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80138f:	00 
+  801390:	eb 2a                	jmp    8013bc <strncpy+0x64>
+		*dst++ = *src;
+  801392:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801396:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80139a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80139e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013a2:	0f b6 12             	movzbl (%rdx),%edx
+  8013a5:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8013a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013ab:	0f b6 00             	movzbl (%rax),%eax
+  8013ae:	84 c0                	test   %al,%al
+  8013b0:	74 05                	je     8013b7 <strncpy+0x5f>
+			src++;
+  8013b2:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8013b7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013c0:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8013c4:	72 cc                	jb     801392 <strncpy+0x3a>
+	}
+	return ret;
+  8013c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8013ca:	c9                   	leave
+  8013cb:	c3                   	ret
+
+00000000008013cc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8013cc:	55                   	push   %rbp
+  8013cd:	48 89 e5             	mov    %rsp,%rbp
+  8013d0:	48 83 ec 28          	sub    $0x28,%rsp
+  8013d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013d4 <strlcpy+0x8>
+  8013db:	49 bb 6c 7c 00 00 00 	movabs $0x7c6c,%r11
+  8013e2:	00 00 00 
+  8013e5:	4c 01 d8             	add    %r11,%rax
+  8013e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013f0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8013f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013f8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8013fc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801401:	74 3d                	je     801440 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801403:	eb 1d                	jmp    801422 <strlcpy+0x56>
+			*dst++ = *src++;
+  801405:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801409:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80140d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801411:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801415:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801419:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80141d:	0f b6 12             	movzbl (%rdx),%edx
+  801420:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801422:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801427:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80142c:	74 0b                	je     801439 <strlcpy+0x6d>
+  80142e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801432:	0f b6 00             	movzbl (%rax),%eax
+  801435:	84 c0                	test   %al,%al
+  801437:	75 cc                	jne    801405 <strlcpy+0x39>
+		*dst = '\0';
+  801439:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143d:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801440:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801444:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801448:	c9                   	leave
+  801449:	c3                   	ret
+
+000000000080144a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+  80144e:	48 83 ec 10          	sub    $0x10,%rsp
+  801452:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801452 <strcmp+0x8>
+  801459:	49 bb ee 7b 00 00 00 	movabs $0x7bee,%r11
+  801460:	00 00 00 
+  801463:	4c 01 d8             	add    %r11,%rax
+  801466:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80146a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  80146e:	eb 0a                	jmp    80147a <strcmp+0x30>
+		p++, q++;
+  801470:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801475:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80147a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80147e:	0f b6 00             	movzbl (%rax),%eax
+  801481:	84 c0                	test   %al,%al
+  801483:	74 12                	je     801497 <strcmp+0x4d>
+  801485:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801489:	0f b6 10             	movzbl (%rax),%edx
+  80148c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801490:	0f b6 00             	movzbl (%rax),%eax
+  801493:	38 c2                	cmp    %al,%dl
+  801495:	74 d9                	je     801470 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801497:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80149b:	0f b6 00             	movzbl (%rax),%eax
+  80149e:	0f b6 d0             	movzbl %al,%edx
+  8014a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014a5:	0f b6 00             	movzbl (%rax),%eax
+  8014a8:	0f b6 c0             	movzbl %al,%eax
+  8014ab:	29 c2                	sub    %eax,%edx
+  8014ad:	89 d0                	mov    %edx,%eax
+}
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+
+00000000008014b1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8014b1:	55                   	push   %rbp
+  8014b2:	48 89 e5             	mov    %rsp,%rbp
+  8014b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8014b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014b9 <strncmp+0x8>
+  8014c0:	49 bb 87 7b 00 00 00 	movabs $0x7b87,%r11
+  8014c7:	00 00 00 
+  8014ca:	4c 01 d8             	add    %r11,%rax
+  8014cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8014d5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8014d9:	eb 0f                	jmp    8014ea <strncmp+0x39>
+		n--, p++, q++;
+  8014db:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8014e0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014e5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8014ea:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014ef:	74 1d                	je     80150e <strncmp+0x5d>
+  8014f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014f5:	0f b6 00             	movzbl (%rax),%eax
+  8014f8:	84 c0                	test   %al,%al
+  8014fa:	74 12                	je     80150e <strncmp+0x5d>
+  8014fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801500:	0f b6 10             	movzbl (%rax),%edx
+  801503:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801507:	0f b6 00             	movzbl (%rax),%eax
+  80150a:	38 c2                	cmp    %al,%dl
+  80150c:	74 cd                	je     8014db <strncmp+0x2a>
+	if (n == 0)
+  80150e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801513:	75 07                	jne    80151c <strncmp+0x6b>
+		return 0;
+  801515:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151a:	eb 16                	jmp    801532 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80151c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801520:	0f b6 00             	movzbl (%rax),%eax
+  801523:	0f b6 d0             	movzbl %al,%edx
+  801526:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80152a:	0f b6 00             	movzbl (%rax),%eax
+  80152d:	0f b6 c0             	movzbl %al,%eax
+  801530:	29 c2                	sub    %eax,%edx
+}
+  801532:	89 d0                	mov    %edx,%eax
+  801534:	c9                   	leave
+  801535:	c3                   	ret
+
+0000000000801536 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801536:	55                   	push   %rbp
+  801537:	48 89 e5             	mov    %rsp,%rbp
+  80153a:	48 83 ec 10          	sub    $0x10,%rsp
+  80153e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80153e <strchr+0x8>
+  801545:	49 bb 02 7b 00 00 00 	movabs $0x7b02,%r11
+  80154c:	00 00 00 
+  80154f:	4c 01 d8             	add    %r11,%rax
+  801552:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801556:	89 f0                	mov    %esi,%eax
+  801558:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80155b:	eb 17                	jmp    801574 <strchr+0x3e>
+		if (*s == c)
+  80155d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801561:	0f b6 00             	movzbl (%rax),%eax
+  801564:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801567:	75 06                	jne    80156f <strchr+0x39>
+			return (char *) s;
+  801569:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80156d:	eb 15                	jmp    801584 <strchr+0x4e>
+	for (; *s; s++)
+  80156f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801574:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801578:	0f b6 00             	movzbl (%rax),%eax
+  80157b:	84 c0                	test   %al,%al
+  80157d:	75 de                	jne    80155d <strchr+0x27>
+	return 0;
+  80157f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801584:	c9                   	leave
+  801585:	c3                   	ret
+
+0000000000801586 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801586:	55                   	push   %rbp
+  801587:	48 89 e5             	mov    %rsp,%rbp
+  80158a:	48 83 ec 10          	sub    $0x10,%rsp
+  80158e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80158e <strfind+0x8>
+  801595:	49 bb b2 7a 00 00 00 	movabs $0x7ab2,%r11
+  80159c:	00 00 00 
+  80159f:	4c 01 d8             	add    %r11,%rax
+  8015a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015a6:	89 f0                	mov    %esi,%eax
+  8015a8:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8015ab:	eb 11                	jmp    8015be <strfind+0x38>
+		if (*s == c)
+  8015ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b1:	0f b6 00             	movzbl (%rax),%eax
+  8015b4:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8015b7:	74 12                	je     8015cb <strfind+0x45>
+	for (; *s; s++)
+  8015b9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c2:	0f b6 00             	movzbl (%rax),%eax
+  8015c5:	84 c0                	test   %al,%al
+  8015c7:	75 e4                	jne    8015ad <strfind+0x27>
+  8015c9:	eb 01                	jmp    8015cc <strfind+0x46>
+			break;
+  8015cb:	90                   	nop
+	return (char *) s;
+  8015cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8015d0:	c9                   	leave
+  8015d1:	c3                   	ret
+
+00000000008015d2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8015d2:	55                   	push   %rbp
+  8015d3:	48 89 e5             	mov    %rsp,%rbp
+  8015d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8015da:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015da <memset+0x8>
+  8015e1:	49 bb 66 7a 00 00 00 	movabs $0x7a66,%r11
+  8015e8:	00 00 00 
+  8015eb:	4c 01 d8             	add    %r11,%rax
+  8015ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015f2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8015f5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8015f9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8015fe:	75 06                	jne    801606 <memset+0x34>
+		return v;
+  801600:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801604:	eb 69                	jmp    80166f <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801606:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80160a:	83 e0 03             	and    $0x3,%eax
+  80160d:	48 85 c0             	test   %rax,%rax
+  801610:	75 48                	jne    80165a <memset+0x88>
+  801612:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801616:	83 e0 03             	and    $0x3,%eax
+  801619:	48 85 c0             	test   %rax,%rax
+  80161c:	75 3c                	jne    80165a <memset+0x88>
+		c &= 0xFF;
+  80161e:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801625:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801628:	c1 e0 18             	shl    $0x18,%eax
+  80162b:	89 c2                	mov    %eax,%edx
+  80162d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801630:	c1 e0 10             	shl    $0x10,%eax
+  801633:	09 c2                	or     %eax,%edx
+  801635:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801638:	c1 e0 08             	shl    $0x8,%eax
+  80163b:	09 d0                	or     %edx,%eax
+  80163d:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801640:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801644:	48 c1 e8 02          	shr    $0x2,%rax
+  801648:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  80164b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80164f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801652:	48 89 d7             	mov    %rdx,%rdi
+  801655:	fc                   	cld
+  801656:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801658:	eb 11                	jmp    80166b <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80165a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80165e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801661:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801665:	48 89 d7             	mov    %rdx,%rdi
+  801668:	fc                   	cld
+  801669:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  80166b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80166f:	c9                   	leave
+  801670:	c3                   	ret
+
+0000000000801671 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801671:	55                   	push   %rbp
+  801672:	48 89 e5             	mov    %rsp,%rbp
+  801675:	48 83 ec 28          	sub    $0x28,%rsp
+  801679:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801679 <memmove+0x8>
+  801680:	49 bb c7 79 00 00 00 	movabs $0x79c7,%r11
+  801687:	00 00 00 
+  80168a:	4c 01 d8             	add    %r11,%rax
+  80168d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801691:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801695:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801699:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80169d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8016a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8016a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ad:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8016b1:	0f 83 88 00 00 00    	jae    80173f <memmove+0xce>
+  8016b7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016bf:	48 01 d0             	add    %rdx,%rax
+  8016c2:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8016c6:	73 77                	jae    80173f <memmove+0xce>
+		s += n;
+  8016c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016cc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8016d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016d4:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8016d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016dc:	83 e0 03             	and    $0x3,%eax
+  8016df:	48 85 c0             	test   %rax,%rax
+  8016e2:	75 3b                	jne    80171f <memmove+0xae>
+  8016e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016e8:	83 e0 03             	and    $0x3,%eax
+  8016eb:	48 85 c0             	test   %rax,%rax
+  8016ee:	75 2f                	jne    80171f <memmove+0xae>
+  8016f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016f4:	83 e0 03             	and    $0x3,%eax
+  8016f7:	48 85 c0             	test   %rax,%rax
+  8016fa:	75 23                	jne    80171f <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8016fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801700:	48 83 e8 04          	sub    $0x4,%rax
+  801704:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801708:	48 83 ea 04          	sub    $0x4,%rdx
+  80170c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801710:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801714:	48 89 c7             	mov    %rax,%rdi
+  801717:	48 89 d6             	mov    %rdx,%rsi
+  80171a:	fd                   	std
+  80171b:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80171d:	eb 1d                	jmp    80173c <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80171f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801723:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801727:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172b:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  80172f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801733:	48 89 d7             	mov    %rdx,%rdi
+  801736:	48 89 c1             	mov    %rax,%rcx
+  801739:	fd                   	std
+  80173a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80173c:	fc                   	cld
+  80173d:	eb 57                	jmp    801796 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80173f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801743:	83 e0 03             	and    $0x3,%eax
+  801746:	48 85 c0             	test   %rax,%rax
+  801749:	75 36                	jne    801781 <memmove+0x110>
+  80174b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80174f:	83 e0 03             	and    $0x3,%eax
+  801752:	48 85 c0             	test   %rax,%rax
+  801755:	75 2a                	jne    801781 <memmove+0x110>
+  801757:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80175b:	83 e0 03             	and    $0x3,%eax
+  80175e:	48 85 c0             	test   %rax,%rax
+  801761:	75 1e                	jne    801781 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801763:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801767:	48 c1 e8 02          	shr    $0x2,%rax
+  80176b:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  80176e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801772:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801776:	48 89 c7             	mov    %rax,%rdi
+  801779:	48 89 d6             	mov    %rdx,%rsi
+  80177c:	fc                   	cld
+  80177d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80177f:	eb 15                	jmp    801796 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801781:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801785:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801789:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80178d:	48 89 c7             	mov    %rax,%rdi
+  801790:	48 89 d6             	mov    %rdx,%rsi
+  801793:	fc                   	cld
+  801794:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801796:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80179a:	c9                   	leave
+  80179b:	c3                   	ret
+
+000000000080179c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80179c:	55                   	push   %rbp
+  80179d:	48 89 e5             	mov    %rsp,%rbp
+  8017a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8017a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017a4 <memcpy+0x8>
+  8017ab:	49 bb 9c 78 00 00 00 	movabs $0x789c,%r11
+  8017b2:	00 00 00 
+  8017b5:	4c 01 d8             	add    %r11,%rax
+  8017b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8017c0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8017c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017c8:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8017cc:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8017d0:	48 89 cf             	mov    %rcx,%rdi
+  8017d3:	48 b9 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rcx
+  8017da:	ff ff ff 
+  8017dd:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8017e1:	ff d0                	call   *%rax
+}
+  8017e3:	c9                   	leave
+  8017e4:	c3                   	ret
+
+00000000008017e5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8017e5:	55                   	push   %rbp
+  8017e6:	48 89 e5             	mov    %rsp,%rbp
+  8017e9:	48 83 ec 28          	sub    $0x28,%rsp
+  8017ed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017ed <memcmp+0x8>
+  8017f4:	49 bb 53 78 00 00 00 	movabs $0x7853,%r11
+  8017fb:	00 00 00 
+  8017fe:	4c 01 d8             	add    %r11,%rax
+  801801:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801805:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801809:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80180d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801811:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801815:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801819:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80181d:	eb 34                	jmp    801853 <memcmp+0x6e>
+		if (*s1 != *s2)
+  80181f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801823:	0f b6 10             	movzbl (%rax),%edx
+  801826:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80182a:	0f b6 00             	movzbl (%rax),%eax
+  80182d:	38 c2                	cmp    %al,%dl
+  80182f:	74 18                	je     801849 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801831:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801835:	0f b6 00             	movzbl (%rax),%eax
+  801838:	0f b6 d0             	movzbl %al,%edx
+  80183b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80183f:	0f b6 00             	movzbl (%rax),%eax
+  801842:	0f b6 c0             	movzbl %al,%eax
+  801845:	29 c2                	sub    %eax,%edx
+  801847:	eb 20                	jmp    801869 <memcmp+0x84>
+		s1++, s2++;
+  801849:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80184e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801853:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801857:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80185b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80185f:	48 85 c0             	test   %rax,%rax
+  801862:	75 bb                	jne    80181f <memcmp+0x3a>
+	}
+
+	return 0;
+  801864:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801869:	89 d0                	mov    %edx,%eax
+  80186b:	c9                   	leave
+  80186c:	c3                   	ret
+
+000000000080186d <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80186d:	55                   	push   %rbp
+  80186e:	48 89 e5             	mov    %rsp,%rbp
+  801871:	48 83 ec 28          	sub    $0x28,%rsp
+  801875:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801875 <memfind+0x8>
+  80187c:	49 bb cb 77 00 00 00 	movabs $0x77cb,%r11
+  801883:	00 00 00 
+  801886:	4c 01 d8             	add    %r11,%rax
+  801889:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80188d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801890:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801894:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801898:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80189c:	48 01 d0             	add    %rdx,%rax
+  80189f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8018a3:	eb 13                	jmp    8018b8 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8018a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018a9:	0f b6 00             	movzbl (%rax),%eax
+  8018ac:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8018af:	38 d0                	cmp    %dl,%al
+  8018b1:	74 11                	je     8018c4 <memfind+0x57>
+	for (; s < ends; s++)
+  8018b3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8018b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018bc:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8018c0:	72 e3                	jb     8018a5 <memfind+0x38>
+  8018c2:	eb 01                	jmp    8018c5 <memfind+0x58>
+			break;
+  8018c4:	90                   	nop
+	return (void *) s;
+  8018c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018c9:	c9                   	leave
+  8018ca:	c3                   	ret
+
+00000000008018cb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8018cb:	55                   	push   %rbp
+  8018cc:	48 89 e5             	mov    %rsp,%rbp
+  8018cf:	48 83 ec 38          	sub    $0x38,%rsp
+  8018d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018d3 <strtol+0x8>
+  8018da:	49 bb 6d 77 00 00 00 	movabs $0x776d,%r11
+  8018e1:	00 00 00 
+  8018e4:	4c 01 d8             	add    %r11,%rax
+  8018e7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8018eb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8018ef:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8018f2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8018f9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801900:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801901:	eb 05                	jmp    801908 <strtol+0x3d>
+		s++;
+  801903:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801908:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80190c:	0f b6 00             	movzbl (%rax),%eax
+  80190f:	3c 20                	cmp    $0x20,%al
+  801911:	74 f0                	je     801903 <strtol+0x38>
+  801913:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801917:	0f b6 00             	movzbl (%rax),%eax
+  80191a:	3c 09                	cmp    $0x9,%al
+  80191c:	74 e5                	je     801903 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  80191e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801922:	0f b6 00             	movzbl (%rax),%eax
+  801925:	3c 2b                	cmp    $0x2b,%al
+  801927:	75 07                	jne    801930 <strtol+0x65>
+		s++;
+  801929:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80192e:	eb 17                	jmp    801947 <strtol+0x7c>
+	else if (*s == '-')
+  801930:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801934:	0f b6 00             	movzbl (%rax),%eax
+  801937:	3c 2d                	cmp    $0x2d,%al
+  801939:	75 0c                	jne    801947 <strtol+0x7c>
+		s++, neg = 1;
+  80193b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801940:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801947:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80194b:	74 06                	je     801953 <strtol+0x88>
+  80194d:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801951:	75 28                	jne    80197b <strtol+0xb0>
+  801953:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801957:	0f b6 00             	movzbl (%rax),%eax
+  80195a:	3c 30                	cmp    $0x30,%al
+  80195c:	75 1d                	jne    80197b <strtol+0xb0>
+  80195e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801962:	48 83 c0 01          	add    $0x1,%rax
+  801966:	0f b6 00             	movzbl (%rax),%eax
+  801969:	3c 78                	cmp    $0x78,%al
+  80196b:	75 0e                	jne    80197b <strtol+0xb0>
+		s += 2, base = 16;
+  80196d:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801972:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801979:	eb 2c                	jmp    8019a7 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  80197b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80197f:	75 19                	jne    80199a <strtol+0xcf>
+  801981:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801985:	0f b6 00             	movzbl (%rax),%eax
+  801988:	3c 30                	cmp    $0x30,%al
+  80198a:	75 0e                	jne    80199a <strtol+0xcf>
+		s++, base = 8;
+  80198c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801991:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801998:	eb 0d                	jmp    8019a7 <strtol+0xdc>
+	else if (base == 0)
+  80199a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80199e:	75 07                	jne    8019a7 <strtol+0xdc>
+		base = 10;
+  8019a0:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8019a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ab:	0f b6 00             	movzbl (%rax),%eax
+  8019ae:	3c 2f                	cmp    $0x2f,%al
+  8019b0:	7e 1d                	jle    8019cf <strtol+0x104>
+  8019b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b6:	0f b6 00             	movzbl (%rax),%eax
+  8019b9:	3c 39                	cmp    $0x39,%al
+  8019bb:	7f 12                	jg     8019cf <strtol+0x104>
+			dig = *s - '0';
+  8019bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c1:	0f b6 00             	movzbl (%rax),%eax
+  8019c4:	0f be c0             	movsbl %al,%eax
+  8019c7:	83 e8 30             	sub    $0x30,%eax
+  8019ca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019cd:	eb 4e                	jmp    801a1d <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  8019cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d3:	0f b6 00             	movzbl (%rax),%eax
+  8019d6:	3c 60                	cmp    $0x60,%al
+  8019d8:	7e 1d                	jle    8019f7 <strtol+0x12c>
+  8019da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019de:	0f b6 00             	movzbl (%rax),%eax
+  8019e1:	3c 7a                	cmp    $0x7a,%al
+  8019e3:	7f 12                	jg     8019f7 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  8019e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e9:	0f b6 00             	movzbl (%rax),%eax
+  8019ec:	0f be c0             	movsbl %al,%eax
+  8019ef:	83 e8 57             	sub    $0x57,%eax
+  8019f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019f5:	eb 26                	jmp    801a1d <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  8019f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019fb:	0f b6 00             	movzbl (%rax),%eax
+  8019fe:	3c 40                	cmp    $0x40,%al
+  801a00:	7e 47                	jle    801a49 <strtol+0x17e>
+  801a02:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a06:	0f b6 00             	movzbl (%rax),%eax
+  801a09:	3c 5a                	cmp    $0x5a,%al
+  801a0b:	7f 3c                	jg     801a49 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801a0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a11:	0f b6 00             	movzbl (%rax),%eax
+  801a14:	0f be c0             	movsbl %al,%eax
+  801a17:	83 e8 37             	sub    $0x37,%eax
+  801a1a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801a1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a20:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801a23:	7d 23                	jge    801a48 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801a25:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a2a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801a2d:	48 98                	cltq
+  801a2f:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801a34:	48 89 c2             	mov    %rax,%rdx
+  801a37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a3a:	48 98                	cltq
+  801a3c:	48 01 d0             	add    %rdx,%rax
+  801a3f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801a43:	e9 5f ff ff ff       	jmp    8019a7 <strtol+0xdc>
+			break;
+  801a48:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801a49:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801a4e:	74 0b                	je     801a5b <strtol+0x190>
+		*endptr = (char *) s;
+  801a50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a54:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801a58:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801a5b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a5f:	74 09                	je     801a6a <strtol+0x19f>
+  801a61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a65:	48 f7 d8             	neg    %rax
+  801a68:	eb 04                	jmp    801a6e <strtol+0x1a3>
+  801a6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801a6e:	c9                   	leave
+  801a6f:	c3                   	ret
+
+0000000000801a70 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801a70:	55                   	push   %rbp
+  801a71:	48 89 e5             	mov    %rsp,%rbp
+  801a74:	53                   	push   %rbx
+  801a75:	48 83 ec 30          	sub    $0x30,%rsp
+  801a79:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801a79 <strstr+0x9>
+  801a80:	49 bb c7 75 00 00 00 	movabs $0x75c7,%r11
+  801a87:	00 00 00 
+  801a8a:	4c 01 db             	add    %r11,%rbx
+  801a8d:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801a91:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801a95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a99:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a9d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801aa1:	0f b6 00             	movzbl (%rax),%eax
+  801aa4:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801aa7:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801aab:	75 06                	jne    801ab3 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801aad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ab1:	eb 73                	jmp    801b26 <strstr+0xb6>
+
+	len = strlen(str);
+  801ab3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ab7:	48 89 c7             	mov    %rax,%rdi
+  801aba:	48 b8 bd 81 ff ff ff 	movabs $0xffffffffffff81bd,%rax
+  801ac1:	ff ff ff 
+  801ac4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ac8:	ff d0                	call   *%rax
+  801aca:	48 98                	cltq
+  801acc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801ad0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ad4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ad8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801adc:	0f b6 00             	movzbl (%rax),%eax
+  801adf:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801ae2:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801ae6:	75 07                	jne    801aef <strstr+0x7f>
+				return (char *) 0;
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aed:	eb 37                	jmp    801b26 <strstr+0xb6>
+		} while (sc != c);
+  801aef:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801af3:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801af6:	75 d8                	jne    801ad0 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801af8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801afc:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801b00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b04:	48 89 ce             	mov    %rcx,%rsi
+  801b07:	48 89 c7             	mov    %rax,%rdi
+  801b0a:	48 b8 71 84 ff ff ff 	movabs $0xffffffffffff8471,%rax
+  801b11:	ff ff ff 
+  801b14:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801b18:	ff d0                	call   *%rax
+  801b1a:	85 c0                	test   %eax,%eax
+  801b1c:	75 b2                	jne    801ad0 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801b1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b22:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801b26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b2a:	c9                   	leave
+  801b2b:	c3                   	ret
+
+0000000000801b2c <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801b2c:	55                   	push   %rbp
+  801b2d:	48 89 e5             	mov    %rsp,%rbp
+  801b30:	41 57                	push   %r15
+  801b32:	53                   	push   %rbx
+  801b33:	48 83 ec 40          	sub    $0x40,%rsp
+  801b37:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801b37 <syscall+0xb>
+  801b3e:	49 bb 09 75 00 00 00 	movabs $0x7509,%r11
+  801b45:	00 00 00 
+  801b48:	4d 01 da             	add    %r11,%r10
+  801b4b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801b4e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801b51:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b55:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b59:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801b5d:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801b61:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b64:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801b68:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801b6c:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801b70:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b74:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801b78:	4c 89 c3             	mov    %r8,%rbx
+  801b7b:	cd 30                	int    $0x30
+  801b7d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801b81:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801b85:	74 52                	je     801bd9 <syscall+0xad>
+  801b87:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b8c:	7e 4b                	jle    801bd9 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b8e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b92:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b95:	49 89 d0             	mov    %rdx,%r8
+  801b98:	89 c1                	mov    %eax,%ecx
+  801b9a:	48 b8 10 e1 ff ff ff 	movabs $0xffffffffffffe110,%rax
+  801ba1:	ff ff ff 
+  801ba4:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801ba8:	48 89 c2             	mov    %rax,%rdx
+  801bab:	be 23 00 00 00       	mov    $0x23,%esi
+  801bb0:	48 b8 2d e1 ff ff ff 	movabs $0xffffffffffffe12d,%rax
+  801bb7:	ff ff ff 
+  801bba:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801bbe:	48 89 c7             	mov    %rax,%rdi
+  801bc1:	4d 89 d7             	mov    %r10,%r15
+  801bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc9:	49 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%r9
+  801bd0:	ff ff ff 
+  801bd3:	4d 01 d1             	add    %r10,%r9
+  801bd6:	41 ff d1             	call   *%r9
+
+	return ret;
+  801bd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801bdd:	48 83 c4 40          	add    $0x40,%rsp
+  801be1:	5b                   	pop    %rbx
+  801be2:	41 5f                	pop    %r15
+  801be4:	5d                   	pop    %rbp
+  801be5:	c3                   	ret
+
+0000000000801be6 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801be6:	55                   	push   %rbp
+  801be7:	48 89 e5             	mov    %rsp,%rbp
+  801bea:	41 57                	push   %r15
+  801bec:	41 56                	push   %r14
+  801bee:	41 55                	push   %r13
+  801bf0:	41 54                	push   %r12
+  801bf2:	53                   	push   %rbx
+  801bf3:	48 83 ec 48          	sub    $0x48,%rsp
+  801bf7:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801bf7 <syscall_words+0x11>
+  801bfe:	49 bb 49 74 00 00 00 	movabs $0x7449,%r11
+  801c05:	00 00 00 
+  801c08:	4d 01 de             	add    %r11,%r14
+  801c0b:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801c0e:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801c11:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801c15:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801c19:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801c1d:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801c21:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c26:	74 09                	je     801c31 <syscall_words+0x4b>
+  801c28:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c2c:	48 8b 00             	mov    (%rax),%rax
+  801c2f:	eb 05                	jmp    801c36 <syscall_words+0x50>
+  801c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c36:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801c39:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c3e:	74 0a                	je     801c4a <syscall_words+0x64>
+  801c40:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c44:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c48:	eb 05                	jmp    801c4f <syscall_words+0x69>
+  801c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c4f:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801c52:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c57:	74 0a                	je     801c63 <syscall_words+0x7d>
+  801c59:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c5d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c61:	eb 05                	jmp    801c68 <syscall_words+0x82>
+  801c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c68:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801c6b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c70:	74 0a                	je     801c7c <syscall_words+0x96>
+  801c72:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c76:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c7a:	eb 05                	jmp    801c81 <syscall_words+0x9b>
+  801c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c81:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801c84:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c89:	74 0a                	je     801c95 <syscall_words+0xaf>
+  801c8b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c8f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c93:	eb 05                	jmp    801c9a <syscall_words+0xb4>
+  801c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9a:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801c9d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ca2:	74 0a                	je     801cae <syscall_words+0xc8>
+  801ca4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ca8:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801cac:	eb 05                	jmp    801cb3 <syscall_words+0xcd>
+  801cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb3:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801cb6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801cb9:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801cbd:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801cc1:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801cc5:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801cc9:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ccd:	cd 30                	int    $0x30
+  801ccf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801cd3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801cd8:	74 50                	je     801d2a <syscall_words+0x144>
+		words[0] = r8;
+  801cda:	4c 89 c2             	mov    %r8,%rdx
+  801cdd:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ce1:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801ce4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ce8:	48 83 c0 08          	add    $0x8,%rax
+  801cec:	4c 89 ca             	mov    %r9,%rdx
+  801cef:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801cf2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cf6:	48 83 c0 10          	add    $0x10,%rax
+  801cfa:	4c 89 d2             	mov    %r10,%rdx
+  801cfd:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801d00:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d04:	48 83 c0 18          	add    $0x18,%rax
+  801d08:	4c 89 da             	mov    %r11,%rdx
+  801d0b:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801d0e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d12:	48 83 c0 20          	add    $0x20,%rax
+  801d16:	4c 89 e2             	mov    %r12,%rdx
+  801d19:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801d1c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d20:	48 83 c0 28          	add    $0x28,%rax
+  801d24:	4c 89 ea             	mov    %r13,%rdx
+  801d27:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801d2a:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801d2e:	74 52                	je     801d82 <syscall_words+0x19c>
+  801d30:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801d35:	7e 4b                	jle    801d82 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d37:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d3b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801d3e:	49 89 d0             	mov    %rdx,%r8
+  801d41:	89 c1                	mov    %eax,%ecx
+  801d43:	48 b8 10 e1 ff ff ff 	movabs $0xffffffffffffe110,%rax
+  801d4a:	ff ff ff 
+  801d4d:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801d51:	48 89 c2             	mov    %rax,%rdx
+  801d54:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801d59:	48 b8 2d e1 ff ff ff 	movabs $0xffffffffffffe12d,%rax
+  801d60:	ff ff ff 
+  801d63:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801d67:	48 89 c7             	mov    %rax,%rdi
+  801d6a:	4d 89 f7             	mov    %r14,%r15
+  801d6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d72:	49 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%r9
+  801d79:	ff ff ff 
+  801d7c:	4d 01 f1             	add    %r14,%r9
+  801d7f:	41 ff d1             	call   *%r9
+
+	return ret;
+  801d82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801d86:	48 83 c4 48          	add    $0x48,%rsp
+  801d8a:	5b                   	pop    %rbx
+  801d8b:	41 5c                	pop    %r12
+  801d8d:	41 5d                	pop    %r13
+  801d8f:	41 5e                	pop    %r14
+  801d91:	41 5f                	pop    %r15
+  801d93:	5d                   	pop    %rbp
+  801d94:	c3                   	ret
+
+0000000000801d95 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801d95:	55                   	push   %rbp
+  801d96:	48 89 e5             	mov    %rsp,%rbp
+  801d99:	48 83 ec 10          	sub    $0x10,%rsp
+  801d9d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d9d <sys_cputs+0x8>
+  801da4:	49 bb a3 72 00 00 00 	movabs $0x72a3,%r11
+  801dab:	00 00 00 
+  801dae:	4c 01 d8             	add    %r11,%rax
+  801db1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801db5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801db9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801dbd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801dc1:	48 83 ec 08          	sub    $0x8,%rsp
+  801dc5:	6a 00                	push   $0x0
+  801dc7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dcd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dd3:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ddd:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  801de4:	ff ff ff 
+  801de7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801deb:	ff d0                	call   *%rax
+  801ded:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801df1:	90                   	nop
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+
+0000000000801df4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801df4:	55                   	push   %rbp
+  801df5:	48 89 e5             	mov    %rsp,%rbp
+  801df8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801df8 <sys_cgetc+0x4>
+  801dff:	49 bb 48 72 00 00 00 	movabs $0x7248,%r11
+  801e06:	00 00 00 
+  801e09:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801e0c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e10:	6a 00                	push   $0x0
+  801e12:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e28:	be 00 00 00 00       	mov    $0x0,%esi
+  801e2d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e32:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  801e39:	ff ff ff 
+  801e3c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e40:	ff d0                	call   *%rax
+  801e42:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e46:	c9                   	leave
+  801e47:	c3                   	ret
+
+0000000000801e48 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801e48:	55                   	push   %rbp
+  801e49:	48 89 e5             	mov    %rsp,%rbp
+  801e4c:	48 83 ec 10          	sub    $0x10,%rsp
+  801e50:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e50 <sys_env_destroy+0x8>
+  801e57:	49 bb f0 71 00 00 00 	movabs $0x71f0,%r11
+  801e5e:	00 00 00 
+  801e61:	4c 01 d8             	add    %r11,%rax
+  801e64:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e67:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801e6a:	48 63 d2             	movslq %edx,%rdx
+  801e6d:	48 83 ec 08          	sub    $0x8,%rsp
+  801e71:	6a 00                	push   $0x0
+  801e73:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e84:	be 01 00 00 00       	mov    $0x1,%esi
+  801e89:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e8e:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  801e95:	ff ff ff 
+  801e98:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e9c:	ff d0                	call   *%rax
+  801e9e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ea2:	c9                   	leave
+  801ea3:	c3                   	ret
+
+0000000000801ea4 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801ea4:	55                   	push   %rbp
+  801ea5:	48 89 e5             	mov    %rsp,%rbp
+  801ea8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ea8 <sys_getenvid+0x4>
+  801eaf:	49 bb 98 71 00 00 00 	movabs $0x7198,%r11
+  801eb6:	00 00 00 
+  801eb9:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801ebc:	48 83 ec 08          	sub    $0x8,%rsp
+  801ec0:	6a 00                	push   $0x0
+  801ec2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ec8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ece:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ed3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed8:	be 00 00 00 00       	mov    $0x0,%esi
+  801edd:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ee2:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  801ee9:	ff ff ff 
+  801eec:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ef0:	ff d0                	call   *%rax
+  801ef2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ef6:	c9                   	leave
+  801ef7:	c3                   	ret
+
+0000000000801ef8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801ef8:	55                   	push   %rbp
+  801ef9:	48 89 e5             	mov    %rsp,%rbp
+  801efc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801efc <sys_yield+0x4>
+  801f03:	49 bb 44 71 00 00 00 	movabs $0x7144,%r11
+  801f0a:	00 00 00 
+  801f0d:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f10:	48 83 ec 08          	sub    $0x8,%rsp
+  801f14:	6a 00                	push   $0x0
+  801f16:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801f31:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801f36:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  801f3d:	ff ff ff 
+  801f40:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f44:	ff d0                	call   *%rax
+  801f46:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f4a:	90                   	nop
+  801f4b:	c9                   	leave
+  801f4c:	c3                   	ret
+
+0000000000801f4d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801f4d:	55                   	push   %rbp
+  801f4e:	48 89 e5             	mov    %rsp,%rbp
+  801f51:	48 83 ec 10          	sub    $0x10,%rsp
+  801f55:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f55 <sys_page_alloc+0x8>
+  801f5c:	49 bb eb 70 00 00 00 	movabs $0x70eb,%r11
+  801f63:	00 00 00 
+  801f66:	4c 01 d8             	add    %r11,%rax
+  801f69:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f70:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801f73:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801f76:	48 63 f2             	movslq %edx,%rsi
+  801f79:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f7d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f80:	48 63 d2             	movslq %edx,%rdx
+  801f83:	48 83 ec 08          	sub    $0x8,%rsp
+  801f87:	6a 00                	push   $0x0
+  801f89:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f8f:	49 89 f0             	mov    %rsi,%r8
+  801f92:	be 01 00 00 00       	mov    $0x1,%esi
+  801f97:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f9c:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  801fa3:	ff ff ff 
+  801fa6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801faa:	ff d0                	call   *%rax
+  801fac:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fb0:	c9                   	leave
+  801fb1:	c3                   	ret
+
+0000000000801fb2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801fb2:	55                   	push   %rbp
+  801fb3:	48 89 e5             	mov    %rsp,%rbp
+  801fb6:	48 83 ec 20          	sub    $0x20,%rsp
+  801fba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fba <sys_page_map+0x8>
+  801fc1:	49 bb 86 70 00 00 00 	movabs $0x7086,%r11
+  801fc8:	00 00 00 
+  801fcb:	4c 01 d8             	add    %r11,%rax
+  801fce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fd1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801fd5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801fd8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801fdc:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801fe0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801fe3:	48 63 f2             	movslq %edx,%rsi
+  801fe6:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  801fea:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801fed:	48 63 fa             	movslq %edx,%rdi
+  801ff0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ff4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801ff7:	48 63 d2             	movslq %edx,%rdx
+  801ffa:	48 83 ec 08          	sub    $0x8,%rsp
+  801ffe:	56                   	push   %rsi
+  801fff:	4d 89 c1             	mov    %r8,%r9
+  802002:	49 89 f8             	mov    %rdi,%r8
+  802005:	be 01 00 00 00       	mov    $0x1,%esi
+  80200a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80200f:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802016:	ff ff ff 
+  802019:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80201d:	ff d0                	call   *%rax
+  80201f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802023:	c9                   	leave
+  802024:	c3                   	ret
+
+0000000000802025 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802025:	55                   	push   %rbp
+  802026:	48 89 e5             	mov    %rsp,%rbp
+  802029:	48 83 ec 10          	sub    $0x10,%rsp
+  80202d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80202d <sys_page_unmap+0x8>
+  802034:	49 bb 13 70 00 00 00 	movabs $0x7013,%r11
+  80203b:	00 00 00 
+  80203e:	4c 01 d8             	add    %r11,%rax
+  802041:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802044:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802048:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80204c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80204f:	48 63 d2             	movslq %edx,%rdx
+  802052:	48 83 ec 08          	sub    $0x8,%rsp
+  802056:	6a 00                	push   $0x0
+  802058:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80205e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802064:	be 01 00 00 00       	mov    $0x1,%esi
+  802069:	bf 06 00 00 00       	mov    $0x6,%edi
+  80206e:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802075:	ff ff ff 
+  802078:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80207c:	ff d0                	call   *%rax
+  80207e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802082:	c9                   	leave
+  802083:	c3                   	ret
+
+0000000000802084 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802084:	55                   	push   %rbp
+  802085:	48 89 e5             	mov    %rsp,%rbp
+  802088:	48 83 ec 10          	sub    $0x10,%rsp
+  80208c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80208c <sys_env_set_status+0x8>
+  802093:	49 bb b4 6f 00 00 00 	movabs $0x6fb4,%r11
+  80209a:	00 00 00 
+  80209d:	4c 01 d8             	add    %r11,%rax
+  8020a0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020a3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8020a6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020a9:	48 63 ca             	movslq %edx,%rcx
+  8020ac:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020af:	48 63 d2             	movslq %edx,%rdx
+  8020b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b6:	6a 00                	push   $0x0
+  8020b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8020c9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8020ce:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  8020d5:	ff ff ff 
+  8020d8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020dc:	ff d0                	call   *%rax
+  8020de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020e2:	c9                   	leave
+  8020e3:	c3                   	ret
+
+00000000008020e4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8020e4:	55                   	push   %rbp
+  8020e5:	48 89 e5             	mov    %rsp,%rbp
+  8020e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020ec <sys_env_set_trapframe+0x8>
+  8020f3:	49 bb 54 6f 00 00 00 	movabs $0x6f54,%r11
+  8020fa:	00 00 00 
+  8020fd:	4c 01 d8             	add    %r11,%rax
+  802100:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802103:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802107:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80210b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80210e:	48 63 d2             	movslq %edx,%rdx
+  802111:	48 83 ec 08          	sub    $0x8,%rsp
+  802115:	6a 00                	push   $0x0
+  802117:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80211d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802123:	be 01 00 00 00       	mov    $0x1,%esi
+  802128:	bf 09 00 00 00       	mov    $0x9,%edi
+  80212d:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802134:	ff ff ff 
+  802137:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80213b:	ff d0                	call   *%rax
+  80213d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802141:	c9                   	leave
+  802142:	c3                   	ret
+
+0000000000802143 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802143:	55                   	push   %rbp
+  802144:	48 89 e5             	mov    %rsp,%rbp
+  802147:	48 83 ec 10          	sub    $0x10,%rsp
+  80214b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80214b <sys_env_set_pgfault_upcall+0x8>
+  802152:	49 bb f5 6e 00 00 00 	movabs $0x6ef5,%r11
+  802159:	00 00 00 
+  80215c:	4c 01 d8             	add    %r11,%rax
+  80215f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802162:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802166:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80216a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80216d:	48 63 d2             	movslq %edx,%rdx
+  802170:	48 83 ec 08          	sub    $0x8,%rsp
+  802174:	6a 00                	push   $0x0
+  802176:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80217c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802182:	be 01 00 00 00       	mov    $0x1,%esi
+  802187:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80218c:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802193:	ff ff ff 
+  802196:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80219a:	ff d0                	call   *%rax
+  80219c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021a0:	c9                   	leave
+  8021a1:	c3                   	ret
+
+00000000008021a2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8021a2:	55                   	push   %rbp
+  8021a3:	48 89 e5             	mov    %rsp,%rbp
+  8021a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8021aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021aa <sys_ipc_try_send+0x8>
+  8021b1:	49 bb 96 6e 00 00 00 	movabs $0x6e96,%r11
+  8021b8:	00 00 00 
+  8021bb:	4c 01 d8             	add    %r11,%rax
+  8021be:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021c1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021c5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021c9:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8021cc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021cf:	48 63 fa             	movslq %edx,%rdi
+  8021d2:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8021d6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021d9:	48 63 d2             	movslq %edx,%rdx
+  8021dc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e4:	6a 00                	push   $0x0
+  8021e6:	49 89 f9             	mov    %rdi,%r9
+  8021e9:	49 89 f0             	mov    %rsi,%r8
+  8021ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021f6:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  8021fd:	ff ff ff 
+  802200:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802204:	ff d0                	call   *%rax
+  802206:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80220a:	c9                   	leave
+  80220b:	c3                   	ret
+
+000000000080220c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80220c:	55                   	push   %rbp
+  80220d:	48 89 e5             	mov    %rsp,%rbp
+  802210:	48 83 ec 20          	sub    $0x20,%rsp
+  802214:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802214 <sys_ipc_send+0x8>
+  80221b:	49 bb 2c 6e 00 00 00 	movabs $0x6e2c,%r11
+  802222:	00 00 00 
+  802225:	4c 01 d8             	add    %r11,%rax
+  802228:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80222b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80222f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802233:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802236:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802239:	48 63 fa             	movslq %edx,%rdi
+  80223c:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802240:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802243:	48 63 d2             	movslq %edx,%rdx
+  802246:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80224a:	48 83 ec 08          	sub    $0x8,%rsp
+  80224e:	6a 00                	push   $0x0
+  802250:	49 89 f9             	mov    %rdi,%r9
+  802253:	49 89 f0             	mov    %rsi,%r8
+  802256:	be 00 00 00 00       	mov    $0x0,%esi
+  80225b:	bf 17 00 00 00       	mov    $0x17,%edi
+  802260:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802267:	ff ff ff 
+  80226a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80226e:	ff d0                	call   *%rax
+  802270:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802274:	c9                   	leave
+  802275:	c3                   	ret
+
+0000000000802276 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802276:	55                   	push   %rbp
+  802277:	48 89 e5             	mov    %rsp,%rbp
+  80227a:	48 83 ec 10          	sub    $0x10,%rsp
+  80227e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80227e <sys_ipc_recv+0x8>
+  802285:	49 bb c2 6d 00 00 00 	movabs $0x6dc2,%r11
+  80228c:	00 00 00 
+  80228f:	4c 01 d8             	add    %r11,%rax
+  802292:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802296:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80229a:	6a 00                	push   $0x0
+  80229c:	6a 00                	push   $0x0
+  80229e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022af:	be 01 00 00 00       	mov    $0x1,%esi
+  8022b4:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8022b9:	49 ba a6 8b ff ff ff 	movabs $0xffffffffffff8ba6,%r10
+  8022c0:	ff ff ff 
+  8022c3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c7:	ff d0                	call   *%rax
+  8022c9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022cd:	c9                   	leave
+  8022ce:	c3                   	ret
+
+00000000008022cf <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8022cf:	55                   	push   %rbp
+  8022d0:	48 89 e5             	mov    %rsp,%rbp
+  8022d3:	48 83 ec 30          	sub    $0x30,%rsp
+  8022d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d7 <sys_ipc_call+0x8>
+  8022de:	49 bb 69 6d 00 00 00 	movabs $0x6d69,%r11
+  8022e5:	00 00 00 
+  8022e8:	4c 01 d8             	add    %r11,%rax
+  8022eb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022f2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8022f6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8022f9:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8022fd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802301:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802305:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802308:	4c 63 c2             	movslq %edx,%r8
+  80230b:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80230f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802312:	48 63 d2             	movslq %edx,%rdx
+  802315:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802319:	ff 75 d8             	push   -0x28(%rbp)
+  80231c:	56                   	push   %rsi
+  80231d:	4d 89 c1             	mov    %r8,%r9
+  802320:	49 89 f8             	mov    %rdi,%r8
+  802323:	be 00 00 00 00       	mov    $0x0,%esi
+  802328:	bf 18 00 00 00       	mov    $0x18,%edi
+  80232d:	49 ba a6 8b ff ff ff 	movabs $0xffffffffffff8ba6,%r10
+  802334:	ff ff ff 
+  802337:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80233b:	ff d0                	call   *%rax
+  80233d:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802341:	c9                   	leave
+  802342:	c3                   	ret
+
+0000000000802343 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802343:	55                   	push   %rbp
+  802344:	48 89 e5             	mov    %rsp,%rbp
+  802347:	48 83 ec 30          	sub    $0x30,%rsp
+  80234b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80234b <sys_ipc_reply_recv+0x8>
+  802352:	49 bb f5 6c 00 00 00 	movabs $0x6cf5,%r11
+  802359:	00 00 00 
+  80235c:	4c 01 d8             	add    %r11,%rax
+  80235f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802362:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802366:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80236a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80236d:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802371:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802375:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802379:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80237c:	4c 63 c2             	movslq %edx,%r8
+  80237f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802383:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802386:	48 63 d2             	movslq %edx,%rdx
+  802389:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80238d:	ff 75 d8             	push   -0x28(%rbp)
+  802390:	56                   	push   %rsi
+  802391:	4d 89 c1             	mov    %r8,%r9
+  802394:	49 89 f8             	mov    %rdi,%r8
+  802397:	be 00 00 00 00       	mov    $0x0,%esi
+  80239c:	bf 19 00 00 00       	mov    $0x19,%edi
+  8023a1:	49 ba a6 8b ff ff ff 	movabs $0xffffffffffff8ba6,%r10
+  8023a8:	ff ff ff 
+  8023ab:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023af:	ff d0                	call   *%rax
+  8023b1:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8023b5:	c9                   	leave
+  8023b6:	c3                   	ret
+
+00000000008023b7 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8023b7:	55                   	push   %rbp
+  8023b8:	48 89 e5             	mov    %rsp,%rbp
+  8023bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8023bf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023bf <sys_env_set_priority+0x8>
+  8023c6:	49 bb 81 6c 00 00 00 	movabs $0x6c81,%r11
+  8023cd:	00 00 00 
+  8023d0:	4c 01 d8             	add    %r11,%rax
+  8023d3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023d6:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8023d9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023dc:	48 63 ca             	movslq %edx,%rcx
+  8023df:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023e2:	48 63 d2             	movslq %edx,%rdx
+  8023e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e9:	6a 00                	push   $0x0
+  8023eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8023fc:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802401:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802408:	ff ff ff 
+  80240b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80240f:	ff d0                	call   *%rax
+  802411:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802415:	c9                   	leave
+  802416:	c3                   	ret
+
+0000000000802417 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802417:	55                   	push   %rbp
+  802418:	48 89 e5             	mov    %rsp,%rbp
+  80241b:	48 83 ec 10          	sub    $0x10,%rsp
+  80241f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80241f <sys_env_set_affinity+0x8>
+  802426:	49 bb 21 6c 00 00 00 	movabs $0x6c21,%r11
+  80242d:	00 00 00 
+  802430:	4c 01 d8             	add    %r11,%rax
+  802433:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802436:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802439:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  80243c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80243f:	48 63 d2             	movslq %edx,%rdx
+  802442:	48 83 ec 08          	sub    $0x8,%rsp
+  802446:	6a 00                	push   $0x0
+  802448:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80244e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802454:	be 01 00 00 00       	mov    $0x1,%esi
+  802459:	bf 10 00 00 00       	mov    $0x10,%edi
+  80245e:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802465:	ff ff ff 
+  802468:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80246c:	ff d0                	call   *%rax
+  80246e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802472:	c9                   	leave
+  802473:	c3                   	ret
+
+0000000000802474 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802474:	55                   	push   %rbp
+  802475:	48 89 e5             	mov    %rsp,%rbp
+  802478:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802478 <sys_time_msec+0x4>
+  80247f:	49 bb c8 6b 00 00 00 	movabs $0x6bc8,%r11
+  802486:	00 00 00 
+  802489:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80248c:	48 83 ec 08          	sub    $0x8,%rsp
+  802490:	6a 00                	push   $0x0
+  802492:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802498:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80249e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ad:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8024b2:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  8024b9:	ff ff ff 
+  8024bc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024c0:	ff d0                	call   *%rax
+  8024c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024c6:	c9                   	leave
+  8024c7:	c3                   	ret
+
+00000000008024c8 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8024c8:	55                   	push   %rbp
+  8024c9:	48 89 e5             	mov    %rsp,%rbp
+  8024cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024d0 <sys_sleep_usec+0x8>
+  8024d7:	49 bb 70 6b 00 00 00 	movabs $0x6b70,%r11
+  8024de:	00 00 00 
+  8024e1:	4c 01 d8             	add    %r11,%rax
+  8024e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8024e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f0:	6a 00                	push   $0x0
+  8024f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802503:	be 00 00 00 00       	mov    $0x0,%esi
+  802508:	bf 11 00 00 00       	mov    $0x11,%edi
+  80250d:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802514:	ff ff ff 
+  802517:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80251b:	ff d0                	call   *%rax
+  80251d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802521:	c9                   	leave
+  802522:	c3                   	ret
+
+0000000000802523 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802523:	55                   	push   %rbp
+  802524:	48 89 e5             	mov    %rsp,%rbp
+  802527:	48 83 ec 10          	sub    $0x10,%rsp
+  80252b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80252b <sys_page_alloc_huge+0x8>
+  802532:	49 bb 15 6b 00 00 00 	movabs $0x6b15,%r11
+  802539:	00 00 00 
+  80253c:	4c 01 d8             	add    %r11,%rax
+  80253f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802542:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802546:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802549:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80254c:	48 63 f2             	movslq %edx,%rsi
+  80254f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802553:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802556:	48 63 d2             	movslq %edx,%rdx
+  802559:	48 83 ec 08          	sub    $0x8,%rsp
+  80255d:	6a 00                	push   $0x0
+  80255f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802565:	49 89 f0             	mov    %rsi,%r8
+  802568:	be 01 00 00 00       	mov    $0x1,%esi
+  80256d:	bf 12 00 00 00       	mov    $0x12,%edi
+  802572:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802579:	ff ff ff 
+  80257c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802580:	ff d0                	call   *%rax
+  802582:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802586:	c9                   	leave
+  802587:	c3                   	ret
+
+0000000000802588 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802588:	55                   	push   %rbp
+  802589:	48 89 e5             	mov    %rsp,%rbp
+  80258c:	48 83 ec 10          	sub    $0x10,%rsp
+  802590:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802590 <sys_page_map_batch+0x8>
+  802597:	49 bb b0 6a 00 00 00 	movabs $0x6ab0,%r11
+  80259e:	00 00 00 
+  8025a1:	4c 01 d8             	add    %r11,%rax
+  8025a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8025ac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025b0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b8:	6a 00                	push   $0x0
+  8025ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8025cb:	bf 13 00 00 00       	mov    $0x13,%edi
+  8025d0:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  8025d7:	ff ff ff 
+  8025da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025de:	ff d0                	call   *%rax
+  8025e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e4:	c9                   	leave
+  8025e5:	c3                   	ret
+
+00000000008025e6 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8025e6:	55                   	push   %rbp
+  8025e7:	48 89 e5             	mov    %rsp,%rbp
+  8025ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025ee <sys_page_alloc_batch+0x8>
+  8025f5:	49 bb 52 6a 00 00 00 	movabs $0x6a52,%r11
+  8025fc:	00 00 00 
+  8025ff:	4c 01 d8             	add    %r11,%rax
+  802602:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802606:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80260a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80260e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802612:	48 83 ec 08          	sub    $0x8,%rsp
+  802616:	6a 00                	push   $0x0
+  802618:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80261e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802624:	be 01 00 00 00       	mov    $0x1,%esi
+  802629:	bf 14 00 00 00       	mov    $0x14,%edi
+  80262e:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802635:	ff ff ff 
+  802638:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80263c:	ff d0                	call   *%rax
+  80263e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802642:	c9                   	leave
+  802643:	c3                   	ret
+
+0000000000802644 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802644:	55                   	push   %rbp
+  802645:	48 89 e5             	mov    %rsp,%rbp
+  802648:	48 83 ec 10          	sub    $0x10,%rsp
+  80264c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80264c <sys_page_unmap_batch+0x8>
+  802653:	49 bb f4 69 00 00 00 	movabs $0x69f4,%r11
+  80265a:	00 00 00 
+  80265d:	4c 01 d8             	add    %r11,%rax
+  802660:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802664:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802668:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80266c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802670:	48 83 ec 08          	sub    $0x8,%rsp
+  802674:	6a 00                	push   $0x0
+  802676:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80267c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802682:	be 01 00 00 00       	mov    $0x1,%esi
+  802687:	bf 15 00 00 00       	mov    $0x15,%edi
+  80268c:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  802693:	ff ff ff 
+  802696:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80269a:	ff d0                	call   *%rax
+  80269c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026a0:	c9                   	leave
+  8026a1:	c3                   	ret
+
+00000000008026a2 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8026a2:	55                   	push   %rbp
+  8026a3:	48 89 e5             	mov    %rsp,%rbp
+  8026a6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026a6 <sys_fork+0x4>
+  8026ad:	49 bb 9a 69 00 00 00 	movabs $0x699a,%r11
+  8026b4:	00 00 00 
+  8026b7:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8026ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8026be:	6a 00                	push   $0x0
+  8026c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8026db:	bf 16 00 00 00       	mov    $0x16,%edi
+  8026e0:	49 ba ec 8a ff ff ff 	movabs $0xffffffffffff8aec,%r10
+  8026e7:	ff ff ff 
+  8026ea:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026ee:	ff d0                	call   *%rax
+  8026f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f4:	c9                   	leave
+  8026f5:	c3                   	ret
+
+00000000008026f6 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8026f6:	55                   	push   %rbp
+  8026f7:	48 89 e5             	mov    %rsp,%rbp
+  8026fa:	41 57                	push   %r15
+  8026fc:	53                   	push   %rbx
+  8026fd:	48 83 ec 40          	sub    $0x40,%rsp
+  802701:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802701 <pgfault+0xb>
+  802708:	49 bb 3f 69 00 00 00 	movabs $0x693f,%r11
+  80270f:	00 00 00 
+  802712:	4c 01 db             	add    %r11,%rbx
+  802715:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802719:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80271d:	48 8b 00             	mov    (%rax),%rax
+  802720:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802724:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802728:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80272c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  80272f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802733:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802737:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80273b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802741:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802745:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802748:	83 e0 02             	and    $0x2,%eax
+  80274b:	85 c0                	test   %eax,%eax
+  80274d:	0f 84 91 03 00 00    	je     802ae4 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802753:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802757:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80275b:	48 89 c2             	mov    %rax,%rdx
+  80275e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802765:	ff ff ff 
+  802768:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80276c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802770:	83 e0 01             	and    $0x1,%eax
+  802773:	48 85 c0             	test   %rax,%rax
+  802776:	0f 84 a7 01 00 00    	je     802923 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  80277c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802780:	48 c1 e8 15          	shr    $0x15,%rax
+  802784:	48 89 c2             	mov    %rax,%rdx
+  802787:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80278e:	ff ff ff 
+  802791:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802795:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802799:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  80279e:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  8027a4:	0f 85 79 01 00 00    	jne    802923 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  8027aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027ae:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8027b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027b6:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  8027bc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  8027c0:	ba 07 00 00 00       	mov    $0x7,%edx
+  8027c5:	be 00 00 60 00       	mov    $0x600000,%esi
+  8027ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027cf:	49 89 df             	mov    %rbx,%r15
+  8027d2:	48 b8 e3 94 ff ff ff 	movabs $0xffffffffffff94e3,%rax
+  8027d9:	ff ff ff 
+  8027dc:	48 01 d8             	add    %rbx,%rax
+  8027df:	ff d0                	call   *%rax
+  8027e1:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8027e4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8027e8:	79 44                	jns    80282e <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  8027ea:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8027ed:	89 c1                	mov    %eax,%ecx
+  8027ef:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  8027f6:	ff ff ff 
+  8027f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8027fd:	48 89 c2             	mov    %rax,%rdx
+  802800:	be 20 00 00 00       	mov    $0x20,%esi
+  802805:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  80280c:	ff ff ff 
+  80280f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802813:	48 89 c7             	mov    %rax,%rdi
+  802816:	49 89 df             	mov    %rbx,%r15
+  802819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281e:	49 b8 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%r8
+  802825:	ff ff ff 
+  802828:	49 01 d8             	add    %rbx,%r8
+  80282b:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  80282e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802832:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802837:	48 89 c6             	mov    %rax,%rsi
+  80283a:	bf 00 00 60 00       	mov    $0x600000,%edi
+  80283f:	49 89 df             	mov    %rbx,%r15
+  802842:	48 b8 5c 87 ff ff ff 	movabs $0xffffffffffff875c,%rax
+  802849:	ff ff ff 
+  80284c:	48 01 d8             	add    %rbx,%rax
+  80284f:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802851:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802855:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80285b:	48 89 c1             	mov    %rax,%rcx
+  80285e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802863:	be 00 00 60 00       	mov    $0x600000,%esi
+  802868:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286d:	49 89 df             	mov    %rbx,%r15
+  802870:	48 b8 72 8f ff ff ff 	movabs $0xffffffffffff8f72,%rax
+  802877:	ff ff ff 
+  80287a:	48 01 d8             	add    %rbx,%rax
+  80287d:	ff d0                	call   *%rax
+  80287f:	85 c0                	test   %eax,%eax
+  802881:	74 3e                	je     8028c1 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802883:	48 b8 6b e1 ff ff ff 	movabs $0xffffffffffffe16b,%rax
+  80288a:	ff ff ff 
+  80288d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802891:	48 89 c2             	mov    %rax,%rdx
+  802894:	be 23 00 00 00       	mov    $0x23,%esi
+  802899:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  8028a0:	ff ff ff 
+  8028a3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8028a7:	48 89 c7             	mov    %rax,%rdi
+  8028aa:	49 89 df             	mov    %rbx,%r15
+  8028ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b2:	48 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%rcx
+  8028b9:	ff ff ff 
+  8028bc:	48 01 d9             	add    %rbx,%rcx
+  8028bf:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  8028c1:	be 00 00 60 00       	mov    $0x600000,%esi
+  8028c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028cb:	49 89 df             	mov    %rbx,%r15
+  8028ce:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  8028d5:	ff ff ff 
+  8028d8:	48 01 d8             	add    %rbx,%rax
+  8028db:	ff d0                	call   *%rax
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	0f 84 3d 02 00 00    	je     802b22 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  8028e5:	48 b8 80 e1 ff ff ff 	movabs $0xffffffffffffe180,%rax
+  8028ec:	ff ff ff 
+  8028ef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8028f3:	48 89 c2             	mov    %rax,%rdx
+  8028f6:	be 25 00 00 00       	mov    $0x25,%esi
+  8028fb:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  802902:	ff ff ff 
+  802905:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802909:	48 89 c7             	mov    %rax,%rdi
+  80290c:	49 89 df             	mov    %rbx,%r15
+  80290f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802914:	48 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%rcx
+  80291b:	ff ff ff 
+  80291e:	48 01 d9             	add    %rbx,%rcx
+  802921:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802923:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802927:	48 c1 e8 0c          	shr    $0xc,%rax
+  80292b:	48 89 c2             	mov    %rax,%rdx
+  80292e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802935:	ff ff ff 
+  802938:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80293c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802940:	25 00 08 00 00       	and    $0x800,%eax
+  802945:	48 85 c0             	test   %rax,%rax
+  802948:	0f 84 58 01 00 00    	je     802aa6 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  80294e:	ba 07 00 00 00       	mov    $0x7,%edx
+  802953:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802958:	bf 00 00 00 00       	mov    $0x0,%edi
+  80295d:	49 89 df             	mov    %rbx,%r15
+  802960:	48 b8 0d 8f ff ff ff 	movabs $0xffffffffffff8f0d,%rax
+  802967:	ff ff ff 
+  80296a:	48 01 d8             	add    %rbx,%rax
+  80296d:	ff d0                	call   *%rax
+  80296f:	85 c0                	test   %eax,%eax
+  802971:	74 3e                	je     8029b1 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802973:	48 b8 97 e1 ff ff ff 	movabs $0xffffffffffffe197,%rax
+  80297a:	ff ff ff 
+  80297d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802981:	48 89 c2             	mov    %rax,%rdx
+  802984:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802989:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  802990:	ff ff ff 
+  802993:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802997:	48 89 c7             	mov    %rax,%rdi
+  80299a:	49 89 df             	mov    %rbx,%r15
+  80299d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a2:	48 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%rcx
+  8029a9:	ff ff ff 
+  8029ac:	48 01 d9             	add    %rbx,%rcx
+  8029af:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  8029b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029ba:	48 89 c6             	mov    %rax,%rsi
+  8029bd:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8029c2:	49 89 df             	mov    %rbx,%r15
+  8029c5:	48 b8 5c 87 ff ff ff 	movabs $0xffffffffffff875c,%rax
+  8029cc:	ff ff ff 
+  8029cf:	48 01 d8             	add    %rbx,%rax
+  8029d2:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  8029d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029d8:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8029de:	48 89 c1             	mov    %rax,%rcx
+  8029e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e6:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8029eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f0:	49 89 df             	mov    %rbx,%r15
+  8029f3:	48 b8 72 8f ff ff ff 	movabs $0xffffffffffff8f72,%rax
+  8029fa:	ff ff ff 
+  8029fd:	48 01 d8             	add    %rbx,%rax
+  802a00:	ff d0                	call   *%rax
+  802a02:	85 c0                	test   %eax,%eax
+  802a04:	74 3e                	je     802a44 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802a06:	48 b8 6b e1 ff ff ff 	movabs $0xffffffffffffe16b,%rax
+  802a0d:	ff ff ff 
+  802a10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a14:	48 89 c2             	mov    %rax,%rdx
+  802a17:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802a1c:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  802a23:	ff ff ff 
+  802a26:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a2a:	48 89 c7             	mov    %rax,%rdi
+  802a2d:	49 89 df             	mov    %rbx,%r15
+  802a30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a35:	48 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%rcx
+  802a3c:	ff ff ff 
+  802a3f:	48 01 d9             	add    %rbx,%rcx
+  802a42:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802a44:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802a49:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a4e:	49 89 df             	mov    %rbx,%r15
+  802a51:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  802a58:	ff ff ff 
+  802a5b:	48 01 d8             	add    %rbx,%rax
+  802a5e:	ff d0                	call   *%rax
+  802a60:	85 c0                	test   %eax,%eax
+  802a62:	0f 84 bb 00 00 00    	je     802b23 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802a68:	48 b8 80 e1 ff ff ff 	movabs $0xffffffffffffe180,%rax
+  802a6f:	ff ff ff 
+  802a72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a76:	48 89 c2             	mov    %rax,%rdx
+  802a79:	be 32 00 00 00       	mov    $0x32,%esi
+  802a7e:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  802a85:	ff ff ff 
+  802a88:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a8c:	48 89 c7             	mov    %rax,%rdi
+  802a8f:	49 89 df             	mov    %rbx,%r15
+  802a92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a97:	48 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%rcx
+  802a9e:	ff ff ff 
+  802aa1:	48 01 d9             	add    %rbx,%rcx
+  802aa4:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802aa6:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  802aad:	ff ff ff 
+  802ab0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ab4:	48 89 c2             	mov    %rax,%rdx
+  802ab7:	be 36 00 00 00       	mov    $0x36,%esi
+  802abc:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  802ac3:	ff ff ff 
+  802ac6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aca:	48 89 c7             	mov    %rax,%rdi
+  802acd:	49 89 df             	mov    %rbx,%r15
+  802ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad5:	48 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%rcx
+  802adc:	ff ff ff 
+  802adf:	48 01 d9             	add    %rbx,%rcx
+  802ae2:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802ae4:	48 b8 cf e1 ff ff ff 	movabs $0xffffffffffffe1cf,%rax
+  802aeb:	ff ff ff 
+  802aee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802af2:	48 89 c2             	mov    %rax,%rdx
+  802af5:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802afa:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  802b01:	ff ff ff 
+  802b04:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b08:	48 89 c7             	mov    %rax,%rdi
+  802b0b:	49 89 df             	mov    %rbx,%r15
+  802b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b13:	48 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%rcx
+  802b1a:	ff ff ff 
+  802b1d:	48 01 d9             	add    %rbx,%rcx
+  802b20:	ff d1                	call   *%rcx
+			return;
+  802b22:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802b23:	48 83 c4 40          	add    $0x40,%rsp
+  802b27:	5b                   	pop    %rbx
+  802b28:	41 5f                	pop    %r15
+  802b2a:	5d                   	pop    %rbp
+  802b2b:	c3                   	ret
+
+0000000000802b2c <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802b2c:	55                   	push   %rbp
+  802b2d:	48 89 e5             	mov    %rsp,%rbp
+  802b30:	41 57                	push   %r15
+  802b32:	53                   	push   %rbx
+  802b33:	48 83 ec 10          	sub    $0x10,%rsp
+  802b37:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b37 <fork_flush+0xb>
+  802b3e:	49 bb 09 65 00 00 00 	movabs $0x6509,%r11
+  802b45:	00 00 00 
+  802b48:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802b4b:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802b52:	00 00 00 
+  802b55:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b59:	48 85 c0             	test   %rax,%rax
+  802b5c:	0f 84 81 00 00 00    	je     802be3 <fork_flush+0xb7>
+  802b62:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802b69:	00 00 00 
+  802b6c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b70:	48 89 c6             	mov    %rax,%rsi
+  802b73:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802b7a:	00 00 00 
+  802b7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b81:	48 89 c7             	mov    %rax,%rdi
+  802b84:	49 89 df             	mov    %rbx,%r15
+  802b87:	48 b8 48 95 ff ff ff 	movabs $0xffffffffffff9548,%rax
+  802b8e:	ff ff ff 
+  802b91:	48 01 d8             	add    %rbx,%rax
+  802b94:	ff d0                	call   *%rax
+  802b96:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b99:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b9d:	79 44                	jns    802be3 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802b9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ba2:	89 c1                	mov    %eax,%ecx
+  802ba4:	48 b8 e8 e1 ff ff ff 	movabs $0xffffffffffffe1e8,%rax
+  802bab:	ff ff ff 
+  802bae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bb2:	48 89 c2             	mov    %rax,%rdx
+  802bb5:	be 56 00 00 00       	mov    $0x56,%esi
+  802bba:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  802bc1:	ff ff ff 
+  802bc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bc8:	48 89 c7             	mov    %rax,%rdi
+  802bcb:	49 89 df             	mov    %rbx,%r15
+  802bce:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd3:	49 b8 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%r8
+  802bda:	ff ff ff 
+  802bdd:	49 01 d8             	add    %rbx,%r8
+  802be0:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802be3:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802bea:	00 00 00 
+  802bed:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802bf4:	00 
+}
+  802bf5:	90                   	nop
+  802bf6:	48 83 c4 10          	add    $0x10,%rsp
+  802bfa:	5b                   	pop    %rbx
+  802bfb:	41 5f                	pop    %r15
+  802bfd:	5d                   	pop    %rbp
+  802bfe:	c3                   	ret
+
+0000000000802bff <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802bff:	55                   	push   %rbp
+  802c00:	48 89 e5             	mov    %rsp,%rbp
+  802c03:	53                   	push   %rbx
+  802c04:	48 83 ec 28          	sub    $0x28,%rsp
+  802c08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c08 <fork_map+0x9>
+  802c0f:	49 bb 38 64 00 00 00 	movabs $0x6438,%r11
+  802c16:	00 00 00 
+  802c19:	4c 01 db             	add    %r11,%rbx
+  802c1c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c1f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802c23:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802c26:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802c2d:	00 00 00 
+  802c30:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c34:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802c3a:	75 10                	jne    802c4c <fork_map+0x4d>
+		fork_flush();
+  802c3c:	48 b8 ec 9a ff ff ff 	movabs $0xffffffffffff9aec,%rax
+  802c43:	ff ff ff 
+  802c46:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c4a:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802c4c:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802c53:	00 00 00 
+  802c56:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c5a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802c5e:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802c65:	00 00 00 
+  802c68:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802c6c:	48 c1 e0 05          	shl    $0x5,%rax
+  802c70:	48 89 c2             	mov    %rax,%rdx
+  802c73:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802c7a:	00 00 00 
+  802c7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c81:	48 01 d0             	add    %rdx,%rax
+  802c84:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802c88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c8c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802c92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c96:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c9a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802c9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ca2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ca5:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802ca8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cac:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802cb0:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802cb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cb8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802cbb:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802cbe:	90                   	nop
+  802cbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc3:	c9                   	leave
+  802cc4:	c3                   	ret
+
+0000000000802cc5 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802cc5:	55                   	push   %rbp
+  802cc6:	48 89 e5             	mov    %rsp,%rbp
+  802cc9:	53                   	push   %rbx
+  802cca:	48 83 ec 28          	sub    $0x28,%rsp
+  802cce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802cce <duppage+0x9>
+  802cd5:	49 bb 72 63 00 00 00 	movabs $0x6372,%r11
+  802cdc:	00 00 00 
+  802cdf:	4c 01 db             	add    %r11,%rbx
+  802ce2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ce5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802ce8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802ceb:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802cf3:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802cfa:	ff ff ff 
+  802cfd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d01:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d04:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d08:	25 00 04 00 00       	and    $0x400,%eax
+  802d0d:	48 85 c0             	test   %rax,%rax
+  802d10:	74 42                	je     802d54 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802d12:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d19:	ff ff ff 
+  802d1c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d20:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d23:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d27:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d2c:	89 c2                	mov    %eax,%edx
+  802d2e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d32:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d35:	48 89 ce             	mov    %rcx,%rsi
+  802d38:	89 c7                	mov    %eax,%edi
+  802d3a:	48 b8 bf 9b ff ff ff 	movabs $0xffffffffffff9bbf,%rax
+  802d41:	ff ff ff 
+  802d44:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d48:	ff d0                	call   *%rax
+		return 0;
+  802d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4f:	e9 ae 00 00 00       	jmp    802e02 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802d54:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d5b:	ff ff ff 
+  802d5e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d62:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d65:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d69:	83 e0 02             	and    $0x2,%eax
+  802d6c:	48 85 c0             	test   %rax,%rax
+  802d6f:	75 1f                	jne    802d90 <duppage+0xcb>
+  802d71:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d78:	ff ff ff 
+  802d7b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d7f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d82:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d86:	25 00 08 00 00       	and    $0x800,%eax
+  802d8b:	48 85 c0             	test   %rax,%rax
+  802d8e:	74 4c                	je     802ddc <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  802d90:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  802d97:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802d9a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d9e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802da1:	48 89 ce             	mov    %rcx,%rsi
+  802da4:	89 c7                	mov    %eax,%edi
+  802da6:	48 b8 bf 9b ff ff ff 	movabs $0xffffffffffff9bbf,%rax
+  802dad:	ff ff ff 
+  802db0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802db4:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  802db6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802db9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dbd:	48 89 c6             	mov    %rax,%rsi
+  802dc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc5:	48 b8 bf 9b ff ff ff 	movabs $0xffffffffffff9bbf,%rax
+  802dcc:	ff ff ff 
+  802dcf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dd3:	ff d0                	call   *%rax
+		return 0;
+  802dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dda:	eb 26                	jmp    802e02 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  802ddc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802de0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802de3:	ba 05 00 00 00       	mov    $0x5,%edx
+  802de8:	48 89 ce             	mov    %rcx,%rsi
+  802deb:	89 c7                	mov    %eax,%edi
+  802ded:	48 b8 bf 9b ff ff ff 	movabs $0xffffffffffff9bbf,%rax
+  802df4:	ff ff ff 
+  802df7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dfb:	ff d0                	call   *%rax
+		return 0;
+  802dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  802e02:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e06:	c9                   	leave
+  802e07:	c3                   	ret
+
+0000000000802e08 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  802e08:	55                   	push   %rbp
+  802e09:	48 89 e5             	mov    %rsp,%rbp
+  802e0c:	53                   	push   %rbx
+  802e0d:	48 83 ec 28          	sub    $0x28,%rsp
+  802e11:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e11 <duphuge+0x9>
+  802e18:	49 bb 2f 62 00 00 00 	movabs $0x622f,%r11
+  802e1f:	00 00 00 
+  802e22:	4c 01 db             	add    %r11,%rbx
+  802e25:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e28:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  802e2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e30:	48 c1 e8 15          	shr    $0x15,%rax
+  802e34:	48 89 c2             	mov    %rax,%rdx
+  802e37:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e3e:	ff ff ff 
+  802e41:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e45:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e49:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  802e4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e51:	25 00 04 00 00       	and    $0x400,%eax
+  802e56:	48 85 c0             	test   %rax,%rax
+  802e59:	74 0e                	je     802e69 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  802e5b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e5f:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e64:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e67:	eb 1e                	jmp    802e87 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  802e69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e6d:	25 02 08 00 00       	and    $0x802,%eax
+  802e72:	48 85 c0             	test   %rax,%rax
+  802e75:	74 09                	je     802e80 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  802e77:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  802e7e:	eb 07                	jmp    802e87 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  802e80:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  802e87:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e8a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802e8e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e91:	48 89 ce             	mov    %rcx,%rsi
+  802e94:	89 c7                	mov    %eax,%edi
+  802e96:	48 b8 bf 9b ff ff ff 	movabs $0xffffffffffff9bbf,%rax
+  802e9d:	ff ff ff 
+  802ea0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ea4:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  802ea6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ea9:	25 00 08 00 00       	and    $0x800,%eax
+  802eae:	85 c0                	test   %eax,%eax
+  802eb0:	74 1f                	je     802ed1 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  802eb2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802eb5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802eb9:	48 89 c6             	mov    %rax,%rsi
+  802ebc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec1:	48 b8 bf 9b ff ff ff 	movabs $0xffffffffffff9bbf,%rax
+  802ec8:	ff ff ff 
+  802ecb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ecf:	ff d0                	call   *%rax
+	return 0;
+  802ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eda:	c9                   	leave
+  802edb:	c3                   	ret
+
+0000000000802edc <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802edc:	55                   	push   %rbp
+  802edd:	48 89 e5             	mov    %rsp,%rbp
+  802ee0:	41 57                	push   %r15
+  802ee2:	53                   	push   %rbx
+  802ee3:	48 83 ec 10          	sub    $0x10,%rsp
+  802ee7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ee7 <fork+0xb>
+  802eee:	49 bb 59 61 00 00 00 	movabs $0x6159,%r11
+  802ef5:	00 00 00 
+  802ef8:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  802efb:	49 89 df             	mov    %rbx,%r15
+  802efe:	48 b8 62 96 ff ff ff 	movabs $0xffffffffffff9662,%rax
+  802f05:	ff ff ff 
+  802f08:	48 01 d8             	add    %rbx,%rax
+  802f0b:	ff d0                	call   *%rax
+  802f0d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f10:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f14:	75 42                	jne    802f58 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802f16:	49 89 df             	mov    %rbx,%r15
+  802f19:	48 b8 64 8e ff ff ff 	movabs $0xffffffffffff8e64,%rax
+  802f20:	ff ff ff 
+  802f23:	48 01 d8             	add    %rbx,%rax
+  802f26:	ff d0                	call   *%rax
+  802f28:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f2d:	48 98                	cltq
+  802f2f:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  802f36:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802f3d:	ff ff ff 
+  802f40:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  802f44:	48 01 c2             	add    %rax,%rdx
+  802f47:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802f4e:	ff ff ff 
+  802f51:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f55:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  802f58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f5b:	48 83 c4 10          	add    $0x10,%rsp
+  802f5f:	5b                   	pop    %rbx
+  802f60:	41 5f                	pop    %r15
+  802f62:	5d                   	pop    %rbp
+  802f63:	c3                   	ret
+
+0000000000802f64 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  802f64:	55                   	push   %rbp
+  802f65:	48 89 e5             	mov    %rsp,%rbp
+  802f68:	41 57                	push   %r15
+  802f6a:	53                   	push   %rbx
+  802f6b:	48 83 ec 10          	sub    $0x10,%rsp
+  802f6f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f6f <ufork+0xb>
+  802f76:	49 bb d1 60 00 00 00 	movabs $0x60d1,%r11
+  802f7d:	00 00 00 
+  802f80:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  802f83:	48 b8 b6 96 ff ff ff 	movabs $0xffffffffffff96b6,%rax
+  802f8a:	ff ff ff 
+  802f8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f91:	48 89 c7             	mov    %rax,%rdi
+  802f94:	49 89 df             	mov    %rbx,%r15
+  802f97:	48 b8 70 da ff ff ff 	movabs $0xffffffffffffda70,%rax
+  802f9e:	ff ff ff 
+  802fa1:	48 01 d8             	add    %rbx,%rax
+  802fa4:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802fa6:	b8 07 00 00 00       	mov    $0x7,%eax
+  802fab:	cd 30                	int    $0x30
+  802fad:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  802fb0:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  802fb3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  802fb6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802fba:	0f 84 03 02 00 00    	je     8031c3 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  802fc0:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802fc7:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  802fc8:	e9 28 01 00 00       	jmp    8030f5 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  802fcd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fd1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fd5:	48 89 c2             	mov    %rax,%rdx
+  802fd8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802fdf:	ff ff ff 
+  802fe2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fe6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fea:	83 e0 01             	and    $0x1,%eax
+  802fed:	48 85 c0             	test   %rax,%rax
+  802ff0:	0f 84 f7 00 00 00    	je     8030ed <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  802ff6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ffa:	48 c1 e8 15          	shr    $0x15,%rax
+  802ffe:	48 89 c2             	mov    %rax,%rdx
+  803001:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803008:	ff ff ff 
+  80300b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80300f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803013:	25 81 00 00 00       	and    $0x81,%eax
+  803018:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  80301e:	75 29                	jne    803049 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  803020:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803024:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803027:	48 89 d6             	mov    %rdx,%rsi
+  80302a:	89 c7                	mov    %eax,%edi
+  80302c:	48 b8 c8 9d ff ff ff 	movabs $0xffffffffffff9dc8,%rax
+  803033:	ff ff ff 
+  803036:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80303a:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  80303c:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803043:	00 
+  803044:	e9 ac 00 00 00       	jmp    8030f5 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  803049:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80304d:	48 c1 e8 15          	shr    $0x15,%rax
+  803051:	48 89 c2             	mov    %rax,%rdx
+  803054:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80305b:	ff ff ff 
+  80305e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803062:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803066:	83 e0 01             	and    $0x1,%eax
+  803069:	48 85 c0             	test   %rax,%rax
+  80306c:	74 75                	je     8030e3 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  80306e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803072:	48 c1 e8 0c          	shr    $0xc,%rax
+  803076:	48 89 c2             	mov    %rax,%rdx
+  803079:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803080:	ff ff ff 
+  803083:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803087:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80308b:	83 e0 01             	and    $0x1,%eax
+  80308e:	48 85 c0             	test   %rax,%rax
+  803091:	74 46                	je     8030d9 <ufork+0x175>
+  803093:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803097:	48 c1 e8 0c          	shr    $0xc,%rax
+  80309b:	48 89 c2             	mov    %rax,%rdx
+  80309e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030a5:	ff ff ff 
+  8030a8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030ac:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030b0:	83 e0 04             	and    $0x4,%eax
+  8030b3:	48 85 c0             	test   %rax,%rax
+  8030b6:	74 21                	je     8030d9 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  8030b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030bc:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030c0:	89 c2                	mov    %eax,%edx
+  8030c2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8030c5:	89 d6                	mov    %edx,%esi
+  8030c7:	89 c7                	mov    %eax,%edi
+  8030c9:	48 b8 85 9c ff ff ff 	movabs $0xffffffffffff9c85,%rax
+  8030d0:	ff ff ff 
+  8030d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030d7:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  8030d9:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8030e0:	00 
+  8030e1:	eb 12                	jmp    8030f5 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  8030e3:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8030ea:	00 
+  8030eb:	eb 08                	jmp    8030f5 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  8030ed:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  8030f4:	40 
+		for (; addr < USTACKTOP;){
+  8030f5:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  8030fa:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8030fe:	0f 83 c9 fe ff ff    	jae    802fcd <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803104:	48 b8 ec 9a ff ff ff 	movabs $0xffffffffffff9aec,%rax
+  80310b:	ff ff ff 
+  80310e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803112:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803114:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803117:	ba 07 00 00 00       	mov    $0x7,%edx
+  80311c:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  803121:	48 89 ce             	mov    %rcx,%rsi
+  803124:	89 c7                	mov    %eax,%edi
+  803126:	49 89 df             	mov    %rbx,%r15
+  803129:	48 b8 0d 8f ff ff ff 	movabs $0xffffffffffff8f0d,%rax
+  803130:	ff ff ff 
+  803133:	48 01 d8             	add    %rbx,%rax
+  803136:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803138:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80313b:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803142:	ff ff ff 
+  803145:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803149:	48 89 d6             	mov    %rdx,%rsi
+  80314c:	89 c7                	mov    %eax,%edi
+  80314e:	49 89 df             	mov    %rbx,%r15
+  803151:	48 b8 03 91 ff ff ff 	movabs $0xffffffffffff9103,%rax
+  803158:	ff ff ff 
+  80315b:	48 01 d8             	add    %rbx,%rax
+  80315e:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803160:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803163:	be 02 00 00 00       	mov    $0x2,%esi
+  803168:	89 c7                	mov    %eax,%edi
+  80316a:	49 89 df             	mov    %rbx,%r15
+  80316d:	48 b8 44 90 ff ff ff 	movabs $0xffffffffffff9044,%rax
+  803174:	ff ff ff 
+  803177:	48 01 d8             	add    %rbx,%rax
+  80317a:	ff d0                	call   *%rax
+  80317c:	85 c0                	test   %eax,%eax
+  80317e:	74 3e                	je     8031be <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803180:	48 b8 0f e2 ff ff ff 	movabs $0xffffffffffffe20f,%rax
+  803187:	ff ff ff 
+  80318a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80318e:	48 89 c2             	mov    %rax,%rdx
+  803191:	be 07 01 00 00       	mov    $0x107,%esi
+  803196:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  80319d:	ff ff ff 
+  8031a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031a4:	48 89 c7             	mov    %rax,%rdi
+  8031a7:	49 89 df             	mov    %rbx,%r15
+  8031aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031af:	48 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%rcx
+  8031b6:	ff ff ff 
+  8031b9:	48 01 d9             	add    %rbx,%rcx
+  8031bc:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  8031be:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8031c1:	eb 59                	jmp    80321c <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8031c3:	49 89 df             	mov    %rbx,%r15
+  8031c6:	48 b8 64 8e ff ff ff 	movabs $0xffffffffffff8e64,%rax
+  8031cd:	ff ff ff 
+  8031d0:	48 01 d8             	add    %rbx,%rax
+  8031d3:	ff d0                	call   *%rax
+  8031d5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031da:	48 98                	cltq
+  8031dc:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8031e3:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8031ea:	ff ff ff 
+  8031ed:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8031f1:	48 01 c2             	add    %rax,%rdx
+  8031f4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8031fb:	ff ff ff 
+  8031fe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803202:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803205:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80320c:	00 00 00 
+  80320f:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803216:	00 
+		return 0;
+  803217:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  80321c:	48 83 c4 10          	add    $0x10,%rsp
+  803220:	5b                   	pop    %rbx
+  803221:	41 5f                	pop    %r15
+  803223:	5d                   	pop    %rbp
+  803224:	c3                   	ret
+
+0000000000803225 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803225:	55                   	push   %rbp
+  803226:	48 89 e5             	mov    %rsp,%rbp
+  803229:	41 57                	push   %r15
+  80322b:	48 83 ec 08          	sub    $0x8,%rsp
+  80322f:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80322f <sfork+0xa>
+  803236:	49 bb 11 5e 00 00 00 	movabs $0x5e11,%r11
+  80323d:	00 00 00 
+  803240:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803243:	48 b8 2a e2 ff ff ff 	movabs $0xffffffffffffe22a,%rax
+  80324a:	ff ff ff 
+  80324d:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803251:	48 89 c2             	mov    %rax,%rdx
+  803254:	be 1a 01 00 00       	mov    $0x11a,%esi
+  803259:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  803260:	ff ff ff 
+  803263:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803267:	48 89 c7             	mov    %rax,%rdi
+  80326a:	49 89 cf             	mov    %rcx,%r15
+  80326d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803272:	49 b8 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%r8
+  803279:	ff ff ff 
+  80327c:	49 01 c8             	add    %rcx,%r8
+  80327f:	41 ff d0             	call   *%r8
+
+0000000000803282 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803282:	55                   	push   %rbp
+  803283:	48 89 e5             	mov    %rsp,%rbp
+  803286:	41 57                	push   %r15
+  803288:	53                   	push   %rbx
+  803289:	48 83 ec 30          	sub    $0x30,%rsp
+  80328d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80328d <ipc_recv+0xb>
+  803294:	49 bb b3 5d 00 00 00 	movabs $0x5db3,%r11
+  80329b:	00 00 00 
+  80329e:	4c 01 db             	add    %r11,%rbx
+  8032a1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8032a5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8032a9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8032ad:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8032b2:	75 0e                	jne    8032c2 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8032b4:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8032bb:	00 00 00 
+  8032be:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8032c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032c6:	48 89 c7             	mov    %rax,%rdi
+  8032c9:	49 89 df             	mov    %rbx,%r15
+  8032cc:	48 b8 36 92 ff ff ff 	movabs $0xffffffffffff9236,%rax
+  8032d3:	ff ff ff 
+  8032d6:	48 01 d8             	add    %rbx,%rax
+  8032d9:	ff d0                	call   *%rax
+  8032db:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8032de:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8032e3:	74 2a                	je     80330f <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8032e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032e9:	75 19                	jne    803304 <ipc_recv+0x82>
+  8032eb:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8032f2:	ff ff ff 
+  8032f5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032f9:	48 8b 00             	mov    (%rax),%rax
+  8032fc:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803302:	eb 05                	jmp    803309 <ipc_recv+0x87>
+  803304:	b8 00 00 00 00       	mov    $0x0,%eax
+  803309:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80330d:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80330f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803314:	74 2a                	je     803340 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  803316:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80331a:	75 19                	jne    803335 <ipc_recv+0xb3>
+  80331c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803323:	ff ff ff 
+  803326:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80332a:	48 8b 00             	mov    (%rax),%rax
+  80332d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803333:	eb 05                	jmp    80333a <ipc_recv+0xb8>
+  803335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80333e:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  803340:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803344:	74 05                	je     80334b <ipc_recv+0xc9>
+		return res;
+  803346:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803349:	eb 17                	jmp    803362 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  80334b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803352:	ff ff ff 
+  803355:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803359:	48 8b 00             	mov    (%rax),%rax
+  80335c:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803362:	48 83 c4 30          	add    $0x30,%rsp
+  803366:	5b                   	pop    %rbx
+  803367:	41 5f                	pop    %r15
+  803369:	5d                   	pop    %rbp
+  80336a:	c3                   	ret
+
+000000000080336b <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80336b:	55                   	push   %rbp
+  80336c:	48 89 e5             	mov    %rsp,%rbp
+  80336f:	41 57                	push   %r15
+  803371:	53                   	push   %rbx
+  803372:	48 83 ec 20          	sub    $0x20,%rsp
+  803376:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803376 <ipc_send+0xb>
+  80337d:	49 bb ca 5c 00 00 00 	movabs $0x5cca,%r11
+  803384:	00 00 00 
+  803387:	4c 01 db             	add    %r11,%rbx
+  80338a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80338d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  803390:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803394:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  803397:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80339c:	75 0e                	jne    8033ac <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  80339e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8033a5:	00 00 00 
+  8033a8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8033ac:	90                   	nop
+  8033ad:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8033b0:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8033b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033ba:	89 c7                	mov    %eax,%edi
+  8033bc:	49 89 df             	mov    %rbx,%r15
+  8033bf:	48 b8 cc 91 ff ff ff 	movabs $0xffffffffffff91cc,%rax
+  8033c6:	ff ff ff 
+  8033c9:	48 01 d8             	add    %rbx,%rax
+  8033cc:	ff d0                	call   *%rax
+  8033ce:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8033d1:	74 da                	je     8033ad <ipc_send+0x42>
+		;
+}
+  8033d3:	90                   	nop
+  8033d4:	90                   	nop
+  8033d5:	48 83 c4 20          	add    $0x20,%rsp
+  8033d9:	5b                   	pop    %rbx
+  8033da:	41 5f                	pop    %r15
+  8033dc:	5d                   	pop    %rbp
+  8033dd:	c3                   	ret
+
+00000000008033de <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8033de:	55                   	push   %rbp
+  8033df:	48 89 e5             	mov    %rsp,%rbp
+  8033e2:	41 57                	push   %r15
+  8033e4:	53                   	push   %rbx
+  8033e5:	48 83 ec 40          	sub    $0x40,%rsp
+  8033e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033e9 <ipc_call+0xb>
+  8033f0:	49 bb 57 5c 00 00 00 	movabs $0x5c57,%r11
+  8033f7:	00 00 00 
+  8033fa:	4c 01 db             	add    %r11,%rbx
+  8033fd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803400:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803403:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803407:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80340a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80340e:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803412:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803417:	75 0e                	jne    803427 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  803419:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803420:	00 00 00 
+  803423:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803427:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80342c:	75 0e                	jne    80343c <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80342e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803435:	00 00 00 
+  803438:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80343c:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80343f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803443:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803446:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80344a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80344d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803453:	49 89 f8             	mov    %rdi,%r8
+  803456:	89 c7                	mov    %eax,%edi
+  803458:	49 89 df             	mov    %rbx,%r15
+  80345b:	48 b8 8f 92 ff ff ff 	movabs $0xffffffffffff928f,%rax
+  803462:	ff ff ff 
+  803465:	48 01 d8             	add    %rbx,%rax
+  803468:	ff d0                	call   *%rax
+  80346a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80346d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803472:	74 2a                	je     80349e <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803474:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803478:	75 19                	jne    803493 <ipc_call+0xb5>
+  80347a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803481:	ff ff ff 
+  803484:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803488:	48 8b 00             	mov    (%rax),%rax
+  80348b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803491:	eb 05                	jmp    803498 <ipc_call+0xba>
+  803493:	b8 00 00 00 00       	mov    $0x0,%eax
+  803498:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80349c:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  80349e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034a2:	74 05                	je     8034a9 <ipc_call+0xcb>
+		return r;
+  8034a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034a7:	eb 17                	jmp    8034c0 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8034a9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8034b0:	ff ff ff 
+  8034b3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034b7:	48 8b 00             	mov    (%rax),%rax
+  8034ba:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8034c0:	48 83 c4 40          	add    $0x40,%rsp
+  8034c4:	5b                   	pop    %rbx
+  8034c5:	41 5f                	pop    %r15
+  8034c7:	5d                   	pop    %rbp
+  8034c8:	c3                   	ret
+
+00000000008034c9 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8034c9:	55                   	push   %rbp
+  8034ca:	48 89 e5             	mov    %rsp,%rbp
+  8034cd:	41 57                	push   %r15
+  8034cf:	53                   	push   %rbx
+  8034d0:	48 83 ec 70          	sub    $0x70,%rsp
+  8034d4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034d4 <ipc_callw+0xb>
+  8034db:	49 bb 6c 5b 00 00 00 	movabs $0x5b6c,%r11
+  8034e2:	00 00 00 
+  8034e5:	4c 01 db             	add    %r11,%rbx
+  8034e8:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8034eb:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8034ee:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8034f2:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8034f6:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8034fb:	76 0a                	jbe    803507 <ipc_callw+0x3e>
+		return -E_INVAL;
+  8034fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803502:	e9 b7 00 00 00       	jmp    8035be <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  803507:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80350b:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80350f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803513:	48 89 ce             	mov    %rcx,%rsi
+  803516:	48 89 c7             	mov    %rax,%rdi
+  803519:	49 89 df             	mov    %rbx,%r15
+  80351c:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  803523:	ff ff ff 
+  803526:	48 01 d8             	add    %rbx,%rax
+  803529:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  80352b:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803532:	00 
+  803533:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803537:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80353b:	48 01 d0             	add    %rdx,%rax
+  80353e:	48 83 e8 01          	sub    $0x1,%rax
+  803542:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803546:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80354a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354f:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803553:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803557:	48 29 d0             	sub    %rdx,%rax
+  80355a:	48 c1 e8 03          	shr    $0x3,%rax
+  80355e:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  803562:	89 c1                	mov    %eax,%ecx
+  803564:	8b 75 98             	mov    -0x68(%rbp),%esi
+  803567:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  80356b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80356e:	49 89 d1             	mov    %rdx,%r9
+  803571:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  803578:	00 00 00 
+  80357b:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  803582:	00 00 00 
+  803585:	89 c7                	mov    %eax,%edi
+  803587:	49 89 df             	mov    %rbx,%r15
+  80358a:	48 b8 8f 92 ff ff ff 	movabs $0xffffffffffff928f,%rax
+  803591:	ff ff ff 
+  803594:	48 01 d8             	add    %rbx,%rax
+  803597:	ff d0                	call   *%rax
+  803599:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  80359c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035a0:	74 05                	je     8035a7 <ipc_callw+0xde>
+		return r;
+  8035a2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035a5:	eb 17                	jmp    8035be <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8035a7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8035ae:	ff ff ff 
+  8035b1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035b5:	48 8b 00             	mov    (%rax),%rax
+  8035b8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8035be:	48 83 c4 70          	add    $0x70,%rsp
+  8035c2:	5b                   	pop    %rbx
+  8035c3:	41 5f                	pop    %r15
+  8035c5:	5d                   	pop    %rbp
+  8035c6:	c3                   	ret
+
+00000000008035c7 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8035c7:	55                   	push   %rbp
+  8035c8:	48 89 e5             	mov    %rsp,%rbp
+  8035cb:	41 57                	push   %r15
+  8035cd:	53                   	push   %rbx
+  8035ce:	48 83 ec 40          	sub    $0x40,%rsp
+  8035d2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035d2 <ipc_callv+0xb>
+  8035d9:	49 bb 6e 5a 00 00 00 	movabs $0x5a6e,%r11
+  8035e0:	00 00 00 
+  8035e3:	4c 01 db             	add    %r11,%rbx
+  8035e6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8035e9:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8035ec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8035f0:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8035f3:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8035f7:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  8035fb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803602:	00 00 00 
+  803605:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  803609:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80360d:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  803611:	74 11                	je     803624 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  803613:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803617:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  80361b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80361e:	c1 e0 14             	shl    $0x14,%eax
+  803621:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  803624:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  803628:	74 14                	je     80363e <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  80362a:	8b 45 20             	mov    0x20(%rbp),%eax
+  80362d:	83 e8 01             	sub    $0x1,%eax
+  803630:	48 63 d0             	movslq %eax,%rdx
+  803633:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803637:	48 09 d0             	or     %rdx,%rax
+  80363a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  80363e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803641:	c1 e0 10             	shl    $0x10,%eax
+  803644:	0b 45 10             	or     0x10(%rbp),%eax
+  803647:	89 c1                	mov    %eax,%ecx
+  803649:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80364c:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  803650:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  803654:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803658:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80365b:	4d 89 c1             	mov    %r8,%r9
+  80365e:	49 89 f8             	mov    %rdi,%r8
+  803661:	89 c7                	mov    %eax,%edi
+  803663:	49 89 df             	mov    %rbx,%r15
+  803666:	48 b8 8f 92 ff ff ff 	movabs $0xffffffffffff928f,%rax
+  80366d:	ff ff ff 
+  803670:	48 01 d8             	add    %rbx,%rax
+  803673:	ff d0                	call   *%rax
+  803675:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  803678:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80367c:	74 05                	je     803683 <ipc_callv+0xbc>
+		return r;
+  80367e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803681:	eb 17                	jmp    80369a <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  803683:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80368a:	ff ff ff 
+  80368d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803691:	48 8b 00             	mov    (%rax),%rax
+  803694:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80369a:	48 83 c4 40          	add    $0x40,%rsp
+  80369e:	5b                   	pop    %rbx
+  80369f:	41 5f                	pop    %r15
+  8036a1:	5d                   	pop    %rbp
+  8036a2:	c3                   	ret
+
+00000000008036a3 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8036a3:	55                   	push   %rbp
+  8036a4:	48 89 e5             	mov    %rsp,%rbp
+  8036a7:	41 57                	push   %r15
+  8036a9:	53                   	push   %rbx
+  8036aa:	48 83 ec 40          	sub    $0x40,%rsp
+  8036ae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036ae <ipc_reply_recv+0xb>
+  8036b5:	49 bb 92 59 00 00 00 	movabs $0x5992,%r11
+  8036bc:	00 00 00 
+  8036bf:	4c 01 db             	add    %r11,%rbx
+  8036c2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8036c5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8036c8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8036cc:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8036cf:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8036d3:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8036d7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8036dc:	75 0e                	jne    8036ec <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  8036de:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8036e5:	00 00 00 
+  8036e8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8036ec:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8036f1:	75 0e                	jne    803701 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8036f3:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8036fa:	00 00 00 
+  8036fd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803701:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803704:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  803708:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80370c:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80370f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803713:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803716:	4d 89 c1             	mov    %r8,%r9
+  803719:	49 89 f8             	mov    %rdi,%r8
+  80371c:	89 c7                	mov    %eax,%edi
+  80371e:	49 89 df             	mov    %rbx,%r15
+  803721:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  803728:	ff ff ff 
+  80372b:	48 01 d8             	add    %rbx,%rax
+  80372e:	ff d0                	call   *%rax
+  803730:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  803733:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803738:	74 2a                	je     803764 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80373a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80373e:	75 19                	jne    803759 <ipc_reply_recv+0xb6>
+  803740:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803747:	ff ff ff 
+  80374a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80374e:	48 8b 00             	mov    (%rax),%rax
+  803751:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803757:	eb 05                	jmp    80375e <ipc_reply_recv+0xbb>
+  803759:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803762:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  803764:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  803769:	74 2a                	je     803795 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80376b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80376f:	75 19                	jne    80378a <ipc_reply_recv+0xe7>
+  803771:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803778:	ff ff ff 
+  80377b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80377f:	48 8b 00             	mov    (%rax),%rax
+  803782:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803788:	eb 05                	jmp    80378f <ipc_reply_recv+0xec>
+  80378a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378f:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  803793:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803795:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803799:	74 05                	je     8037a0 <ipc_reply_recv+0xfd>
+		return r;
+  80379b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80379e:	eb 17                	jmp    8037b7 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8037a0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8037a7:	ff ff ff 
+  8037aa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037ae:	48 8b 00             	mov    (%rax),%rax
+  8037b1:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8037b7:	48 83 c4 40          	add    $0x40,%rsp
+  8037bb:	5b                   	pop    %rbx
+  8037bc:	41 5f                	pop    %r15
+  8037be:	5d                   	pop    %rbp
+  8037bf:	c3                   	ret
+
+00000000008037c0 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  8037c0:	55                   	push   %rbp
+  8037c1:	48 89 e5             	mov    %rsp,%rbp
+  8037c4:	41 57                	push   %r15
+  8037c6:	53                   	push   %rbx
+  8037c7:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  8037ce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037ce <ipc_window_batch+0xe>
+  8037d5:	49 bb 72 58 00 00 00 	movabs $0x5872,%r11
+  8037dc:	00 00 00 
+  8037df:	4c 01 db             	add    %r11,%rbx
+  8037e2:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  8037e8:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  8037ef:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  8037f5:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  8037fb:	e9 15 01 00 00       	jmp    803915 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803800:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803806:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803809:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803810:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803813:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803816:	39 c2                	cmp    %eax,%edx
+  803818:	0f 4e c2             	cmovle %edx,%eax
+  80381b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  80381e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803825:	eb 6b                	jmp    803892 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803827:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80382a:	48 98                	cltq
+  80382c:	48 c1 e0 05          	shl    $0x5,%rax
+  803830:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803834:	48 01 e8             	add    %rbp,%rax
+  803837:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  80383d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803843:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803846:	c1 e0 0c             	shl    $0xc,%eax
+  803849:	48 63 d0             	movslq %eax,%rdx
+  80384c:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803853:	48 01 c2             	add    %rax,%rdx
+  803856:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803859:	48 98                	cltq
+  80385b:	48 c1 e0 05          	shl    $0x5,%rax
+  80385f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803863:	48 01 e8             	add    %rbp,%rax
+  803866:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  80386c:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  80386f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803872:	48 98                	cltq
+  803874:	48 c1 e0 05          	shl    $0x5,%rax
+  803878:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80387c:	48 01 e8             	add    %rbp,%rax
+  80387f:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  803886:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  80388c:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  80388e:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803892:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803895:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  803898:	7c 8d                	jl     803827 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  80389a:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8038a1:	74 27                	je     8038ca <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8038a3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8038a6:	48 63 d0             	movslq %eax,%rdx
+  8038a9:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8038b0:	48 89 d6             	mov    %rdx,%rsi
+  8038b3:	48 89 c7             	mov    %rax,%rdi
+  8038b6:	49 89 df             	mov    %rbx,%r15
+  8038b9:	48 b8 a6 95 ff ff ff 	movabs $0xffffffffffff95a6,%rax
+  8038c0:	ff ff ff 
+  8038c3:	48 01 d8             	add    %rbx,%rax
+  8038c6:	ff d0                	call   *%rax
+  8038c8:	eb 25                	jmp    8038ef <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  8038ca:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8038cd:	48 63 d0             	movslq %eax,%rdx
+  8038d0:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8038d7:	48 89 d6             	mov    %rdx,%rsi
+  8038da:	48 89 c7             	mov    %rax,%rdi
+  8038dd:	49 89 df             	mov    %rbx,%r15
+  8038e0:	48 b8 04 96 ff ff ff 	movabs $0xffffffffffff9604,%rax
+  8038e7:	ff ff ff 
+  8038ea:	48 01 d8             	add    %rbx,%rax
+  8038ed:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8038ef:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  8038f2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8038f6:	79 05                	jns    8038fd <ipc_window_batch+0x13d>
+			return r;
+  8038f8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038fb:	eb 2a                	jmp    803927 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  8038fd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803900:	c1 e0 0c             	shl    $0xc,%eax
+  803903:	48 98                	cltq
+  803905:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  80390c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80390f:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803915:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  80391c:	0f 8f de fe ff ff    	jg     803800 <ipc_window_batch+0x40>
+	}
+	return 0;
+  803922:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803927:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  80392e:	5b                   	pop    %rbx
+  80392f:	41 5f                	pop    %r15
+  803931:	5d                   	pop    %rbp
+  803932:	c3                   	ret
+
+0000000000803933 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803933:	55                   	push   %rbp
+  803934:	48 89 e5             	mov    %rsp,%rbp
+  803937:	48 83 ec 10          	sub    $0x10,%rsp
+  80393b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80393b <ipc_map_window+0x8>
+  803942:	49 bb 05 57 00 00 00 	movabs $0x5705,%r11
+  803949:	00 00 00 
+  80394c:	4c 01 d8             	add    %r11,%rax
+  80394f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803953:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803956:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803959:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80395d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803962:	bf 01 00 00 00       	mov    $0x1,%edi
+  803967:	49 b8 80 a7 ff ff ff 	movabs $0xffffffffffffa780,%r8
+  80396e:	ff ff ff 
+  803971:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803975:	ff d0                	call   *%rax
+}
+  803977:	c9                   	leave
+  803978:	c3                   	ret
+
+0000000000803979 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803979:	55                   	push   %rbp
+  80397a:	48 89 e5             	mov    %rsp,%rbp
+  80397d:	48 83 ec 10          	sub    $0x10,%rsp
+  803981:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803981 <ipc_unmap_window+0x8>
+  803988:	49 bb bf 56 00 00 00 	movabs $0x56bf,%r11
+  80398f:	00 00 00 
+  803992:	4c 01 d8             	add    %r11,%rax
+  803995:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803999:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  80399c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80399f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8039a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8039a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039ad:	49 b8 80 a7 ff ff ff 	movabs $0xffffffffffffa780,%r8
+  8039b4:	ff ff ff 
+  8039b7:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8039bb:	ff d0                	call   *%rax
+}
+  8039bd:	c9                   	leave
+  8039be:	c3                   	ret
+
+00000000008039bf <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8039bf:	55                   	push   %rbp
+  8039c0:	48 89 e5             	mov    %rsp,%rbp
+  8039c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8039c7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8039c7 <ipc_find_env+0x8>
+  8039ce:	49 bb 79 56 00 00 00 	movabs $0x5679,%r11
+  8039d5:	00 00 00 
+  8039d8:	4c 01 d8             	add    %r11,%rax
+  8039db:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  8039de:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8039e5:	eb 57                	jmp    803a3e <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  8039e7:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8039ee:	ff ff ff 
+  8039f1:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8039f5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8039f8:	48 63 d2             	movslq %edx,%rdx
+  8039fb:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803a02:	48 01 ca             	add    %rcx,%rdx
+  803a05:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803a0c:	8b 12                	mov    (%rdx),%edx
+  803a0e:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803a11:	75 27                	jne    803a3a <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803a13:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803a1a:	ff ff ff 
+  803a1d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803a21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a24:	48 98                	cltq
+  803a26:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803a2d:	48 01 d0             	add    %rdx,%rax
+  803a30:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803a36:	8b 00                	mov    (%rax),%eax
+  803a38:	eb 12                	jmp    803a4c <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803a3a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803a3e:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803a45:	7e a0                	jle    8039e7 <ipc_find_env+0x28>
+	}
+	return 0;
+  803a47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a4c:	c9                   	leave
+  803a4d:	c3                   	ret
+
+0000000000803a4e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803a4e:	55                   	push   %rbp
+  803a4f:	48 89 e5             	mov    %rsp,%rbp
+  803a52:	48 83 ec 08          	sub    $0x8,%rsp
+  803a56:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a56 <fd2num+0x8>
+  803a5d:	49 bb ea 55 00 00 00 	movabs $0x55ea,%r11
+  803a64:	00 00 00 
+  803a67:	4c 01 d8             	add    %r11,%rax
+  803a6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803a6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a72:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803a79:	ff ff ff 
+  803a7c:	48 01 d0             	add    %rdx,%rax
+  803a7f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803a83:	c9                   	leave
+  803a84:	c3                   	ret
+
+0000000000803a85 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803a85:	55                   	push   %rbp
+  803a86:	48 89 e5             	mov    %rsp,%rbp
+  803a89:	48 83 ec 08          	sub    $0x8,%rsp
+  803a8d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a8d <fd2data+0x8>
+  803a94:	49 bb b3 55 00 00 00 	movabs $0x55b3,%r11
+  803a9b:	00 00 00 
+  803a9e:	4c 01 d8             	add    %r11,%rax
+  803aa1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803aa5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803aa9:	48 89 d7             	mov    %rdx,%rdi
+  803aac:	48 ba 0e aa ff ff ff 	movabs $0xffffffffffffaa0e,%rdx
+  803ab3:	ff ff ff 
+  803ab6:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803aba:	ff d0                	call   *%rax
+  803abc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803ac2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803ac6:	c9                   	leave
+  803ac7:	c3                   	ret
+
+0000000000803ac8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803ac8:	55                   	push   %rbp
+  803ac9:	48 89 e5             	mov    %rsp,%rbp
+  803acc:	48 83 ec 18          	sub    $0x18,%rsp
+  803ad0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ad0 <fd_alloc+0x8>
+  803ad7:	49 bb 70 55 00 00 00 	movabs $0x5570,%r11
+  803ade:	00 00 00 
+  803ae1:	4c 01 d8             	add    %r11,%rax
+  803ae4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803ae8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803aef:	eb 75                	jmp    803b66 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803af1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803af4:	48 63 d2             	movslq %edx,%rdx
+  803af7:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803afe:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803b02:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803b06:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b0a:	48 89 d1             	mov    %rdx,%rcx
+  803b0d:	48 c1 e9 15          	shr    $0x15,%rcx
+  803b11:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803b18:	ff ff ff 
+  803b1b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803b1f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803b23:	83 e2 01             	and    $0x1,%edx
+  803b26:	48 85 d2             	test   %rdx,%rdx
+  803b29:	74 25                	je     803b50 <fd_alloc+0x88>
+  803b2b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b2f:	48 89 d1             	mov    %rdx,%rcx
+  803b32:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b36:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803b3d:	ff ff ff 
+  803b40:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803b44:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803b48:	83 e2 01             	and    $0x1,%edx
+  803b4b:	48 85 d2             	test   %rdx,%rdx
+  803b4e:	75 12                	jne    803b62 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b54:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b58:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b60:	eb 1a                	jmp    803b7c <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803b62:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803b66:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803b6a:	7e 85                	jle    803af1 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803b6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b70:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803b77:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803b7c:	c9                   	leave
+  803b7d:	c3                   	ret
+
+0000000000803b7e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803b7e:	55                   	push   %rbp
+  803b7f:	48 89 e5             	mov    %rsp,%rbp
+  803b82:	48 83 ec 20          	sub    $0x20,%rsp
+  803b86:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b86 <fd_lookup+0x8>
+  803b8d:	49 bb ba 54 00 00 00 	movabs $0x54ba,%r11
+  803b94:	00 00 00 
+  803b97:	4c 01 d8             	add    %r11,%rax
+  803b9a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b9d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803ba1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ba5:	78 06                	js     803bad <fd_lookup+0x2f>
+  803ba7:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803bab:	7e 07                	jle    803bb4 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803bad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bb2:	eb 73                	jmp    803c27 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803bb4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803bb7:	48 63 d2             	movslq %edx,%rdx
+  803bba:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803bc1:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803bc5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803bc9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803bcd:	48 89 d1             	mov    %rdx,%rcx
+  803bd0:	48 c1 e9 15          	shr    $0x15,%rcx
+  803bd4:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803bdb:	ff ff ff 
+  803bde:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803be2:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803be6:	83 e2 01             	and    $0x1,%edx
+  803be9:	48 85 d2             	test   %rdx,%rdx
+  803bec:	74 22                	je     803c10 <fd_lookup+0x92>
+  803bee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803bf2:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803bf6:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803bfd:	ff ff ff 
+  803c00:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803c04:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c08:	83 e0 01             	and    $0x1,%eax
+  803c0b:	48 85 c0             	test   %rax,%rax
+  803c0e:	75 07                	jne    803c17 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803c10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c15:	eb 10                	jmp    803c27 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803c17:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c1b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803c1f:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803c22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c27:	c9                   	leave
+  803c28:	c3                   	ret
+
+0000000000803c29 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803c29:	55                   	push   %rbp
+  803c2a:	48 89 e5             	mov    %rsp,%rbp
+  803c2d:	41 57                	push   %r15
+  803c2f:	53                   	push   %rbx
+  803c30:	48 83 ec 30          	sub    $0x30,%rsp
+  803c34:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c34 <fd_close+0xb>
+  803c3b:	49 bb 0c 54 00 00 00 	movabs $0x540c,%r11
+  803c42:	00 00 00 
+  803c45:	4c 01 db             	add    %r11,%rbx
+  803c48:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c4c:	89 f0                	mov    %esi,%eax
+  803c4e:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803c51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c55:	48 89 c7             	mov    %rax,%rdi
+  803c58:	48 b8 0e aa ff ff ff 	movabs $0xffffffffffffaa0e,%rax
+  803c5f:	ff ff ff 
+  803c62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c66:	ff d0                	call   *%rax
+  803c68:	89 c2                	mov    %eax,%edx
+  803c6a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803c6e:	48 89 c6             	mov    %rax,%rsi
+  803c71:	89 d7                	mov    %edx,%edi
+  803c73:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  803c7a:	ff ff ff 
+  803c7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c81:	ff d0                	call   *%rax
+  803c83:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c86:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c8a:	78 0a                	js     803c96 <fd_close+0x6d>
+	    || fd != fd2)
+  803c8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c90:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803c94:	74 12                	je     803ca8 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803c96:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803c9a:	74 05                	je     803ca1 <fd_close+0x78>
+  803c9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c9f:	eb 7a                	jmp    803d1b <fd_close+0xf2>
+  803ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca6:	eb 73                	jmp    803d1b <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803ca8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cac:	8b 00                	mov    (%rax),%eax
+  803cae:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803cb2:	48 89 d6             	mov    %rdx,%rsi
+  803cb5:	89 c7                	mov    %eax,%edi
+  803cb7:	48 b8 e4 ac ff ff ff 	movabs $0xfffffffffffface4,%rax
+  803cbe:	ff ff ff 
+  803cc1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cc5:	ff d0                	call   *%rax
+  803cc7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cce:	78 2a                	js     803cfa <fd_close+0xd1>
+		if (dev->dev_close)
+  803cd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cd4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803cd8:	48 85 c0             	test   %rax,%rax
+  803cdb:	74 16                	je     803cf3 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803cdd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ce1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803ce5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ce9:	48 89 c7             	mov    %rax,%rdi
+  803cec:	ff d2                	call   *%rdx
+  803cee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cf1:	eb 07                	jmp    803cfa <fd_close+0xd1>
+		else
+			r = 0;
+  803cf3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  803cfa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cfe:	48 89 c6             	mov    %rax,%rsi
+  803d01:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d06:	49 89 df             	mov    %rbx,%r15
+  803d09:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  803d10:	ff ff ff 
+  803d13:	48 01 d8             	add    %rbx,%rax
+  803d16:	ff d0                	call   *%rax
+	return r;
+  803d18:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803d1b:	48 83 c4 30          	add    $0x30,%rsp
+  803d1f:	5b                   	pop    %rbx
+  803d20:	41 5f                	pop    %r15
+  803d22:	5d                   	pop    %rbp
+  803d23:	c3                   	ret
+
+0000000000803d24 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803d24:	55                   	push   %rbp
+  803d25:	48 89 e5             	mov    %rsp,%rbp
+  803d28:	41 57                	push   %r15
+  803d2a:	48 83 ec 28          	sub    $0x28,%rsp
+  803d2e:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803d2e <dev_lookup+0xa>
+  803d35:	49 bb 12 53 00 00 00 	movabs $0x5312,%r11
+  803d3c:	00 00 00 
+  803d3f:	4c 01 d9             	add    %r11,%rcx
+  803d42:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d45:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803d49:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803d50:	eb 45                	jmp    803d97 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803d52:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803d59:	00 00 00 
+  803d5c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d5f:	48 98                	cltq
+  803d61:	48 01 ca             	add    %rcx,%rdx
+  803d64:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d68:	8b 00                	mov    (%rax),%eax
+  803d6a:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803d6d:	75 24                	jne    803d93 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803d6f:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803d76:	00 00 00 
+  803d79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d7c:	48 98                	cltq
+  803d7e:	48 01 ca             	add    %rcx,%rdx
+  803d81:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d85:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d89:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d91:	eb 74                	jmp    803e07 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803d93:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803d97:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803d9e:	00 00 00 
+  803da1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803da4:	48 98                	cltq
+  803da6:	48 01 ca             	add    %rcx,%rdx
+  803da9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dad:	48 85 c0             	test   %rax,%rax
+  803db0:	75 a0                	jne    803d52 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803db2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803db9:	ff ff ff 
+  803dbc:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803dc0:	48 8b 00             	mov    (%rax),%rax
+  803dc3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803dc9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803dcc:	89 c6                	mov    %eax,%esi
+  803dce:	48 b8 40 e2 ff ff ff 	movabs $0xffffffffffffe240,%rax
+  803dd5:	ff ff ff 
+  803dd8:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803ddc:	48 89 c7             	mov    %rax,%rdi
+  803ddf:	49 89 cf             	mov    %rcx,%r15
+  803de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de7:	49 b8 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%r8
+  803dee:	ff ff ff 
+  803df1:	49 01 c8             	add    %rcx,%r8
+  803df4:	41 ff d0             	call   *%r8
+	*dev = 0;
+  803df7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803dfb:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  803e02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803e07:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803e0b:	c9                   	leave
+  803e0c:	c3                   	ret
+
+0000000000803e0d <close>:
+
+int
+close(int fdnum)
+{
+  803e0d:	55                   	push   %rbp
+  803e0e:	48 89 e5             	mov    %rsp,%rbp
+  803e11:	53                   	push   %rbx
+  803e12:	48 83 ec 28          	sub    $0x28,%rsp
+  803e16:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e16 <close+0x9>
+  803e1d:	49 bb 2a 52 00 00 00 	movabs $0x522a,%r11
+  803e24:	00 00 00 
+  803e27:	4c 01 db             	add    %r11,%rbx
+  803e2a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e2d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803e31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e34:	48 89 d6             	mov    %rdx,%rsi
+  803e37:	89 c7                	mov    %eax,%edi
+  803e39:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  803e40:	ff ff ff 
+  803e43:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e47:	ff d0                	call   *%rax
+  803e49:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e4c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e50:	79 05                	jns    803e57 <close+0x4a>
+		return r;
+  803e52:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e55:	eb 1c                	jmp    803e73 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803e57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e5b:	be 01 00 00 00       	mov    $0x1,%esi
+  803e60:	48 89 c7             	mov    %rax,%rdi
+  803e63:	48 b8 e9 ab ff ff ff 	movabs $0xffffffffffffabe9,%rax
+  803e6a:	ff ff ff 
+  803e6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e71:	ff d0                	call   *%rax
+}
+  803e73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e77:	c9                   	leave
+  803e78:	c3                   	ret
+
+0000000000803e79 <close_all>:
+
+void
+close_all(void)
+{
+  803e79:	55                   	push   %rbp
+  803e7a:	48 89 e5             	mov    %rsp,%rbp
+  803e7d:	53                   	push   %rbx
+  803e7e:	48 83 ec 18          	sub    $0x18,%rsp
+  803e82:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e82 <close_all+0x9>
+  803e89:	49 bb be 51 00 00 00 	movabs $0x51be,%r11
+  803e90:	00 00 00 
+  803e93:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803e96:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803e9d:	eb 19                	jmp    803eb8 <close_all+0x3f>
+		close(i);
+  803e9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ea2:	89 c7                	mov    %eax,%edi
+  803ea4:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  803eab:	ff ff ff 
+  803eae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eb2:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803eb4:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803eb8:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803ebc:	7e e1                	jle    803e9f <close_all+0x26>
+}
+  803ebe:	90                   	nop
+  803ebf:	90                   	nop
+  803ec0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ec4:	c9                   	leave
+  803ec5:	c3                   	ret
+
+0000000000803ec6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803ec6:	55                   	push   %rbp
+  803ec7:	48 89 e5             	mov    %rsp,%rbp
+  803eca:	41 57                	push   %r15
+  803ecc:	53                   	push   %rbx
+  803ecd:	48 83 ec 40          	sub    $0x40,%rsp
+  803ed1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ed1 <dup+0xb>
+  803ed8:	49 bb 6f 51 00 00 00 	movabs $0x516f,%r11
+  803edf:	00 00 00 
+  803ee2:	4c 01 db             	add    %r11,%rbx
+  803ee5:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803ee8:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803eeb:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803eef:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803ef2:	48 89 d6             	mov    %rdx,%rsi
+  803ef5:	89 c7                	mov    %eax,%edi
+  803ef7:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  803efe:	ff ff ff 
+  803f01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f05:	ff d0                	call   *%rax
+  803f07:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f0a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f0e:	79 08                	jns    803f18 <dup+0x52>
+		return r;
+  803f10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f13:	e9 a4 01 00 00       	jmp    8040bc <dup+0x1f6>
+	close(newfdnum);
+  803f18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f1b:	89 c7                	mov    %eax,%edi
+  803f1d:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  803f24:	ff ff ff 
+  803f27:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f2b:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803f2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f30:	48 98                	cltq
+  803f32:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803f38:	48 c1 e0 0c          	shl    $0xc,%rax
+  803f3c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803f40:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f44:	48 89 c7             	mov    %rax,%rdi
+  803f47:	48 b8 45 aa ff ff ff 	movabs $0xffffffffffffaa45,%rax
+  803f4e:	ff ff ff 
+  803f51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f55:	ff d0                	call   *%rax
+  803f57:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803f5b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f5f:	48 89 c7             	mov    %rax,%rdi
+  803f62:	48 b8 45 aa ff ff ff 	movabs $0xffffffffffffaa45,%rax
+  803f69:	ff ff ff 
+  803f6c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f70:	ff d0                	call   *%rax
+  803f72:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803f76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f7a:	48 c1 e8 15          	shr    $0x15,%rax
+  803f7e:	48 89 c2             	mov    %rax,%rdx
+  803f81:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803f88:	ff ff ff 
+  803f8b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f8f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803f93:	83 e0 01             	and    $0x1,%eax
+  803f96:	48 85 c0             	test   %rax,%rax
+  803f99:	74 7f                	je     80401a <dup+0x154>
+  803f9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f9f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803fa3:	48 89 c2             	mov    %rax,%rdx
+  803fa6:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803fad:	ff ff ff 
+  803fb0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803fb4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803fb8:	83 e0 01             	and    $0x1,%eax
+  803fbb:	48 85 c0             	test   %rax,%rax
+  803fbe:	74 5a                	je     80401a <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803fc0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fc4:	48 c1 e8 0c          	shr    $0xc,%rax
+  803fc8:	48 89 c2             	mov    %rax,%rdx
+  803fcb:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803fd2:	ff ff ff 
+  803fd5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803fd9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803fdd:	25 07 0e 00 00       	and    $0xe07,%eax
+  803fe2:	89 c1                	mov    %eax,%ecx
+  803fe4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803fe8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fec:	41 89 c8             	mov    %ecx,%r8d
+  803fef:	48 89 d1             	mov    %rdx,%rcx
+  803ff2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ff7:	48 89 c6             	mov    %rax,%rsi
+  803ffa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fff:	49 89 df             	mov    %rbx,%r15
+  804002:	48 b8 72 8f ff ff ff 	movabs $0xffffffffffff8f72,%rax
+  804009:	ff ff ff 
+  80400c:	48 01 d8             	add    %rbx,%rax
+  80400f:	ff d0                	call   *%rax
+  804011:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804014:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804018:	78 5f                	js     804079 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80401a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80401e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804022:	48 89 c2             	mov    %rax,%rdx
+  804025:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80402c:	ff ff ff 
+  80402f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804033:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804037:	25 07 0e 00 00       	and    $0xe07,%eax
+  80403c:	89 c1                	mov    %eax,%ecx
+  80403e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804042:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804046:	41 89 c8             	mov    %ecx,%r8d
+  804049:	48 89 d1             	mov    %rdx,%rcx
+  80404c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804051:	48 89 c6             	mov    %rax,%rsi
+  804054:	bf 00 00 00 00       	mov    $0x0,%edi
+  804059:	49 89 df             	mov    %rbx,%r15
+  80405c:	48 b8 72 8f ff ff ff 	movabs $0xffffffffffff8f72,%rax
+  804063:	ff ff ff 
+  804066:	48 01 d8             	add    %rbx,%rax
+  804069:	ff d0                	call   *%rax
+  80406b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80406e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804072:	78 08                	js     80407c <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  804074:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804077:	eb 43                	jmp    8040bc <dup+0x1f6>
+			goto err;
+  804079:	90                   	nop
+  80407a:	eb 01                	jmp    80407d <dup+0x1b7>
+		goto err;
+  80407c:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80407d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804081:	48 89 c6             	mov    %rax,%rsi
+  804084:	bf 00 00 00 00       	mov    $0x0,%edi
+  804089:	49 89 df             	mov    %rbx,%r15
+  80408c:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  804093:	ff ff ff 
+  804096:	48 01 d8             	add    %rbx,%rax
+  804099:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  80409b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80409f:	48 89 c6             	mov    %rax,%rsi
+  8040a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040a7:	49 89 df             	mov    %rbx,%r15
+  8040aa:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  8040b1:	ff ff ff 
+  8040b4:	48 01 d8             	add    %rbx,%rax
+  8040b7:	ff d0                	call   *%rax
+	return r;
+  8040b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8040bc:	48 83 c4 40          	add    $0x40,%rsp
+  8040c0:	5b                   	pop    %rbx
+  8040c1:	41 5f                	pop    %r15
+  8040c3:	5d                   	pop    %rbp
+  8040c4:	c3                   	ret
+
+00000000008040c5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8040c5:	55                   	push   %rbp
+  8040c6:	48 89 e5             	mov    %rsp,%rbp
+  8040c9:	41 57                	push   %r15
+  8040cb:	53                   	push   %rbx
+  8040cc:	48 83 ec 40          	sub    $0x40,%rsp
+  8040d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040d0 <read+0xb>
+  8040d7:	49 bb 70 4f 00 00 00 	movabs $0x4f70,%r11
+  8040de:	00 00 00 
+  8040e1:	4c 01 db             	add    %r11,%rbx
+  8040e4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8040e7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8040eb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8040ef:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8040f3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8040f6:	48 89 d6             	mov    %rdx,%rsi
+  8040f9:	89 c7                	mov    %eax,%edi
+  8040fb:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  804102:	ff ff ff 
+  804105:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804109:	ff d0                	call   *%rax
+  80410b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80410e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804112:	78 28                	js     80413c <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804114:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804118:	8b 00                	mov    (%rax),%eax
+  80411a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80411e:	48 89 d6             	mov    %rdx,%rsi
+  804121:	89 c7                	mov    %eax,%edi
+  804123:	48 b8 e4 ac ff ff ff 	movabs $0xfffffffffffface4,%rax
+  80412a:	ff ff ff 
+  80412d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804131:	ff d0                	call   *%rax
+  804133:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804136:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80413a:	79 08                	jns    804144 <read+0x7f>
+		return r;
+  80413c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80413f:	e9 8b 00 00 00       	jmp    8041cf <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804144:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804148:	8b 40 08             	mov    0x8(%rax),%eax
+  80414b:	83 e0 03             	and    $0x3,%eax
+  80414e:	83 f8 01             	cmp    $0x1,%eax
+  804151:	75 4b                	jne    80419e <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804153:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80415a:	ff ff ff 
+  80415d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804161:	48 8b 00             	mov    (%rax),%rax
+  804164:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80416a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80416d:	89 c6                	mov    %eax,%esi
+  80416f:	48 b8 5f e2 ff ff ff 	movabs $0xffffffffffffe25f,%rax
+  804176:	ff ff ff 
+  804179:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80417d:	48 89 c7             	mov    %rax,%rdi
+  804180:	49 89 df             	mov    %rbx,%r15
+  804183:	b8 00 00 00 00       	mov    $0x0,%eax
+  804188:	48 b9 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rcx
+  80418f:	ff ff ff 
+  804192:	48 01 d9             	add    %rbx,%rcx
+  804195:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804197:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80419c:	eb 31                	jmp    8041cf <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80419e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041a2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8041a6:	48 85 c0             	test   %rax,%rax
+  8041a9:	75 07                	jne    8041b2 <read+0xed>
+		return -E_NOT_SUPP;
+  8041ab:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8041b0:	eb 1d                	jmp    8041cf <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8041b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041b6:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8041ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041be:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8041c2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041c6:	48 89 ce             	mov    %rcx,%rsi
+  8041c9:	48 89 c7             	mov    %rax,%rdi
+  8041cc:	41 ff d0             	call   *%r8
+}
+  8041cf:	48 83 c4 40          	add    $0x40,%rsp
+  8041d3:	5b                   	pop    %rbx
+  8041d4:	41 5f                	pop    %r15
+  8041d6:	5d                   	pop    %rbp
+  8041d7:	c3                   	ret
+
+00000000008041d8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8041d8:	55                   	push   %rbp
+  8041d9:	48 89 e5             	mov    %rsp,%rbp
+  8041dc:	53                   	push   %rbx
+  8041dd:	48 83 ec 38          	sub    $0x38,%rsp
+  8041e1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041e1 <readn+0x9>
+  8041e8:	49 bb 5f 4e 00 00 00 	movabs $0x4e5f,%r11
+  8041ef:	00 00 00 
+  8041f2:	4c 01 db             	add    %r11,%rbx
+  8041f5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8041f8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8041fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  804200:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804207:	eb 4b                	jmp    804254 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  804209:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80420c:	48 98                	cltq
+  80420e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804212:	48 29 c2             	sub    %rax,%rdx
+  804215:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804218:	48 63 c8             	movslq %eax,%rcx
+  80421b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80421f:	48 01 c1             	add    %rax,%rcx
+  804222:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804225:	48 89 ce             	mov    %rcx,%rsi
+  804228:	89 c7                	mov    %eax,%edi
+  80422a:	48 b8 85 b0 ff ff ff 	movabs $0xffffffffffffb085,%rax
+  804231:	ff ff ff 
+  804234:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804238:	ff d0                	call   *%rax
+  80423a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80423d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804241:	79 05                	jns    804248 <readn+0x70>
+			return m;
+  804243:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804246:	eb 1d                	jmp    804265 <readn+0x8d>
+		if (m == 0)
+  804248:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80424c:	74 13                	je     804261 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80424e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804251:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804254:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804257:	48 98                	cltq
+  804259:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80425d:	72 aa                	jb     804209 <readn+0x31>
+  80425f:	eb 01                	jmp    804262 <readn+0x8a>
+			break;
+  804261:	90                   	nop
+	}
+	return tot;
+  804262:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804265:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804269:	c9                   	leave
+  80426a:	c3                   	ret
+
+000000000080426b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80426b:	55                   	push   %rbp
+  80426c:	48 89 e5             	mov    %rsp,%rbp
+  80426f:	41 57                	push   %r15
+  804271:	53                   	push   %rbx
+  804272:	48 83 ec 40          	sub    $0x40,%rsp
+  804276:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804276 <write+0xb>
+  80427d:	49 bb ca 4d 00 00 00 	movabs $0x4dca,%r11
+  804284:	00 00 00 
+  804287:	4c 01 db             	add    %r11,%rbx
+  80428a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80428d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804291:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804295:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804299:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80429c:	48 89 d6             	mov    %rdx,%rsi
+  80429f:	89 c7                	mov    %eax,%edi
+  8042a1:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  8042a8:	ff ff ff 
+  8042ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042af:	ff d0                	call   *%rax
+  8042b1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042b4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042b8:	78 28                	js     8042e2 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8042ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042be:	8b 00                	mov    (%rax),%eax
+  8042c0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8042c4:	48 89 d6             	mov    %rdx,%rsi
+  8042c7:	89 c7                	mov    %eax,%edi
+  8042c9:	48 b8 e4 ac ff ff ff 	movabs $0xfffffffffffface4,%rax
+  8042d0:	ff ff ff 
+  8042d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042d7:	ff d0                	call   *%rax
+  8042d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042dc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042e0:	79 08                	jns    8042ea <write+0x7f>
+		return r;
+  8042e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042e5:	e9 8a 00 00 00       	jmp    804374 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8042ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042ee:	8b 40 08             	mov    0x8(%rax),%eax
+  8042f1:	83 e0 03             	and    $0x3,%eax
+  8042f4:	85 c0                	test   %eax,%eax
+  8042f6:	75 4b                	jne    804343 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8042f8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8042ff:	ff ff ff 
+  804302:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804306:	48 8b 00             	mov    (%rax),%rax
+  804309:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80430f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804312:	89 c6                	mov    %eax,%esi
+  804314:	48 b8 7b e2 ff ff ff 	movabs $0xffffffffffffe27b,%rax
+  80431b:	ff ff ff 
+  80431e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804322:	48 89 c7             	mov    %rax,%rdi
+  804325:	49 89 df             	mov    %rbx,%r15
+  804328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80432d:	48 b9 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rcx
+  804334:	ff ff ff 
+  804337:	48 01 d9             	add    %rbx,%rcx
+  80433a:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80433c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804341:	eb 31                	jmp    804374 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  804343:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804347:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80434b:	48 85 c0             	test   %rax,%rax
+  80434e:	75 07                	jne    804357 <write+0xec>
+		return -E_NOT_SUPP;
+  804350:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804355:	eb 1d                	jmp    804374 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  804357:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80435b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80435f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804363:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804367:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80436b:	48 89 ce             	mov    %rcx,%rsi
+  80436e:	48 89 c7             	mov    %rax,%rdi
+  804371:	41 ff d0             	call   *%r8
+}
+  804374:	48 83 c4 40          	add    $0x40,%rsp
+  804378:	5b                   	pop    %rbx
+  804379:	41 5f                	pop    %r15
+  80437b:	5d                   	pop    %rbp
+  80437c:	c3                   	ret
+
+000000000080437d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80437d:	55                   	push   %rbp
+  80437e:	48 89 e5             	mov    %rsp,%rbp
+  804381:	48 83 ec 18          	sub    $0x18,%rsp
+  804385:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804385 <seek+0x8>
+  80438c:	49 bb bb 4c 00 00 00 	movabs $0x4cbb,%r11
+  804393:	00 00 00 
+  804396:	4c 01 d8             	add    %r11,%rax
+  804399:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80439c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80439f:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8043a3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8043a6:	48 89 ce             	mov    %rcx,%rsi
+  8043a9:	89 d7                	mov    %edx,%edi
+  8043ab:	48 ba 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rdx
+  8043b2:	ff ff ff 
+  8043b5:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8043b9:	ff d0                	call   *%rax
+  8043bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043c2:	79 05                	jns    8043c9 <seek+0x4c>
+		return r;
+  8043c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043c7:	eb 0f                	jmp    8043d8 <seek+0x5b>
+	fd->fd_offset = offset;
+  8043c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043cd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8043d0:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8043d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043d8:	c9                   	leave
+  8043d9:	c3                   	ret
+
+00000000008043da <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8043da:	55                   	push   %rbp
+  8043db:	48 89 e5             	mov    %rsp,%rbp
+  8043de:	41 57                	push   %r15
+  8043e0:	53                   	push   %rbx
+  8043e1:	48 83 ec 30          	sub    $0x30,%rsp
+  8043e5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043e5 <ftruncate+0xb>
+  8043ec:	49 bb 5b 4c 00 00 00 	movabs $0x4c5b,%r11
+  8043f3:	00 00 00 
+  8043f6:	4c 01 db             	add    %r11,%rbx
+  8043f9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8043fc:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8043ff:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804403:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804406:	48 89 d6             	mov    %rdx,%rsi
+  804409:	89 c7                	mov    %eax,%edi
+  80440b:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  804412:	ff ff ff 
+  804415:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804419:	ff d0                	call   *%rax
+  80441b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80441e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804422:	78 28                	js     80444c <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804424:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804428:	8b 00                	mov    (%rax),%eax
+  80442a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80442e:	48 89 d6             	mov    %rdx,%rsi
+  804431:	89 c7                	mov    %eax,%edi
+  804433:	48 b8 e4 ac ff ff ff 	movabs $0xfffffffffffface4,%rax
+  80443a:	ff ff ff 
+  80443d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804441:	ff d0                	call   *%rax
+  804443:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804446:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80444a:	79 08                	jns    804454 <ftruncate+0x7a>
+		return r;
+  80444c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80444f:	e9 83 00 00 00       	jmp    8044d7 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804454:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804458:	8b 40 08             	mov    0x8(%rax),%eax
+  80445b:	83 e0 03             	and    $0x3,%eax
+  80445e:	85 c0                	test   %eax,%eax
+  804460:	75 4b                	jne    8044ad <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804462:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804469:	ff ff ff 
+  80446c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804470:	48 8b 00             	mov    (%rax),%rax
+  804473:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804479:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80447c:	89 c6                	mov    %eax,%esi
+  80447e:	48 b8 98 e2 ff ff ff 	movabs $0xffffffffffffe298,%rax
+  804485:	ff ff ff 
+  804488:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80448c:	48 89 c7             	mov    %rax,%rdi
+  80448f:	49 89 df             	mov    %rbx,%r15
+  804492:	b8 00 00 00 00       	mov    $0x0,%eax
+  804497:	48 b9 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rcx
+  80449e:	ff ff ff 
+  8044a1:	48 01 d9             	add    %rbx,%rcx
+  8044a4:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8044a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8044ab:	eb 2a                	jmp    8044d7 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8044ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b1:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8044b5:	48 85 c0             	test   %rax,%rax
+  8044b8:	75 07                	jne    8044c1 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8044ba:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8044bf:	eb 16                	jmp    8044d7 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8044c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044c5:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8044c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044cd:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8044d0:	89 d6                	mov    %edx,%esi
+  8044d2:	48 89 c7             	mov    %rax,%rdi
+  8044d5:	ff d1                	call   *%rcx
+}
+  8044d7:	48 83 c4 30          	add    $0x30,%rsp
+  8044db:	5b                   	pop    %rbx
+  8044dc:	41 5f                	pop    %r15
+  8044de:	5d                   	pop    %rbp
+  8044df:	c3                   	ret
+
+00000000008044e0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8044e0:	55                   	push   %rbp
+  8044e1:	48 89 e5             	mov    %rsp,%rbp
+  8044e4:	53                   	push   %rbx
+  8044e5:	48 83 ec 38          	sub    $0x38,%rsp
+  8044e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044e9 <fstat+0x9>
+  8044f0:	49 bb 57 4b 00 00 00 	movabs $0x4b57,%r11
+  8044f7:	00 00 00 
+  8044fa:	4c 01 db             	add    %r11,%rbx
+  8044fd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804500:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804504:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804508:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80450b:	48 89 d6             	mov    %rdx,%rsi
+  80450e:	89 c7                	mov    %eax,%edi
+  804510:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  804517:	ff ff ff 
+  80451a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80451e:	ff d0                	call   *%rax
+  804520:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804523:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804527:	78 28                	js     804551 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804529:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80452d:	8b 00                	mov    (%rax),%eax
+  80452f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804533:	48 89 d6             	mov    %rdx,%rsi
+  804536:	89 c7                	mov    %eax,%edi
+  804538:	48 b8 e4 ac ff ff ff 	movabs $0xfffffffffffface4,%rax
+  80453f:	ff ff ff 
+  804542:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804546:	ff d0                	call   *%rax
+  804548:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80454b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80454f:	79 05                	jns    804556 <fstat+0x76>
+		return r;
+  804551:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804554:	eb 5e                	jmp    8045b4 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804556:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80455a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80455e:	48 85 c0             	test   %rax,%rax
+  804561:	75 07                	jne    80456a <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804563:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804568:	eb 4a                	jmp    8045b4 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80456a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80456e:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804571:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804575:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80457c:	00 00 00 
+	stat->st_isdir = 0;
+  80457f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804583:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80458a:	00 00 00 
+	stat->st_dev = dev;
+  80458d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804591:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804595:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80459c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045a0:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8045a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8045ac:	48 89 d6             	mov    %rdx,%rsi
+  8045af:	48 89 c7             	mov    %rax,%rdi
+  8045b2:	ff d1                	call   *%rcx
+}
+  8045b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045b8:	c9                   	leave
+  8045b9:	c3                   	ret
+
+00000000008045ba <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8045ba:	55                   	push   %rbp
+  8045bb:	48 89 e5             	mov    %rsp,%rbp
+  8045be:	41 57                	push   %r15
+  8045c0:	53                   	push   %rbx
+  8045c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8045c5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045c5 <stat+0xb>
+  8045cc:	49 bb 7b 4a 00 00 00 	movabs $0x4a7b,%r11
+  8045d3:	00 00 00 
+  8045d6:	4c 01 db             	add    %r11,%rbx
+  8045d9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8045dd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8045e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8045ea:	48 89 c7             	mov    %rax,%rdi
+  8045ed:	49 89 df             	mov    %rbx,%r15
+  8045f0:	48 b8 54 b8 ff ff ff 	movabs $0xffffffffffffb854,%rax
+  8045f7:	ff ff ff 
+  8045fa:	48 01 d8             	add    %rbx,%rax
+  8045fd:	ff d0                	call   *%rax
+  8045ff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804602:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804606:	79 05                	jns    80460d <stat+0x53>
+		return fd;
+  804608:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80460b:	eb 37                	jmp    804644 <stat+0x8a>
+	r = fstat(fd, stat);
+  80460d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804611:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804614:	48 89 d6             	mov    %rdx,%rsi
+  804617:	89 c7                	mov    %eax,%edi
+  804619:	48 b8 a0 b4 ff ff ff 	movabs $0xffffffffffffb4a0,%rax
+  804620:	ff ff ff 
+  804623:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804627:	ff d0                	call   *%rax
+  804629:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80462c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80462f:	89 c7                	mov    %eax,%edi
+  804631:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  804638:	ff ff ff 
+  80463b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80463f:	ff d0                	call   *%rax
+	return r;
+  804641:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804644:	48 83 c4 20          	add    $0x20,%rsp
+  804648:	5b                   	pop    %rbx
+  804649:	41 5f                	pop    %r15
+  80464b:	5d                   	pop    %rbp
+  80464c:	c3                   	ret
+
+000000000080464d <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80464d:	55                   	push   %rbp
+  80464e:	48 89 e5             	mov    %rsp,%rbp
+  804651:	41 57                	push   %r15
+  804653:	53                   	push   %rbx
+  804654:	48 83 ec 10          	sub    $0x10,%rsp
+  804658:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804658 <fsipc+0xb>
+  80465f:	49 bb e8 49 00 00 00 	movabs $0x49e8,%r11
+  804666:	00 00 00 
+  804669:	4c 01 db             	add    %r11,%rbx
+  80466c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80466f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804673:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80467a:	00 00 00 
+  80467d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804680:	85 c0                	test   %eax,%eax
+  804682:	75 24                	jne    8046a8 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804684:	bf 01 00 00 00       	mov    $0x1,%edi
+  804689:	49 89 df             	mov    %rbx,%r15
+  80468c:	48 b8 7f a9 ff ff ff 	movabs $0xffffffffffffa97f,%rax
+  804693:	ff ff ff 
+  804696:	48 01 d8             	add    %rbx,%rax
+  804699:	ff d0                	call   *%rax
+  80469b:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8046a2:	00 00 00 
+  8046a5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8046a8:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8046af:	00 00 00 
+  8046b2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8046b5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8046b9:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8046bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8046c2:	49 89 d0             	mov    %rdx,%r8
+  8046c5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8046ca:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8046d1:	00 00 00 
+  8046d4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8046d8:	89 c7                	mov    %eax,%edi
+  8046da:	49 89 df             	mov    %rbx,%r15
+  8046dd:	48 b8 9e a3 ff ff ff 	movabs $0xffffffffffffa39e,%rax
+  8046e4:	ff ff ff 
+  8046e7:	48 01 d8             	add    %rbx,%rax
+  8046ea:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8046ec:	48 83 c4 10          	add    $0x10,%rsp
+  8046f0:	5b                   	pop    %rbx
+  8046f1:	41 5f                	pop    %r15
+  8046f3:	5d                   	pop    %rbp
+  8046f4:	c3                   	ret
+
+00000000008046f5 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8046f5:	55                   	push   %rbp
+  8046f6:	48 89 e5             	mov    %rsp,%rbp
+  8046f9:	41 57                	push   %r15
+  8046fb:	53                   	push   %rbx
+  8046fc:	48 83 ec 20          	sub    $0x20,%rsp
+  804700:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804700 <fsipc_words+0xb>
+  804707:	49 bb 40 49 00 00 00 	movabs $0x4940,%r11
+  80470e:	00 00 00 
+  804711:	4c 01 db             	add    %r11,%rbx
+  804714:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804717:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80471b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80471f:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804726:	00 00 00 
+  804729:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80472c:	85 c0                	test   %eax,%eax
+  80472e:	75 24                	jne    804754 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804730:	bf 01 00 00 00       	mov    $0x1,%edi
+  804735:	49 89 df             	mov    %rbx,%r15
+  804738:	48 b8 7f a9 ff ff ff 	movabs $0xffffffffffffa97f,%rax
+  80473f:	ff ff ff 
+  804742:	48 01 d8             	add    %rbx,%rax
+  804745:	ff d0                	call   *%rax
+  804747:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80474e:	00 00 00 
+  804751:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804754:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80475b:	00 00 00 
+  80475e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804761:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804765:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804769:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80476c:	89 c7                	mov    %eax,%edi
+  80476e:	49 89 df             	mov    %rbx,%r15
+  804771:	48 b8 89 a4 ff ff ff 	movabs $0xffffffffffffa489,%rax
+  804778:	ff ff ff 
+  80477b:	48 01 d8             	add    %rbx,%rax
+  80477e:	ff d0                	call   *%rax
+}
+  804780:	48 83 c4 20          	add    $0x20,%rsp
+  804784:	5b                   	pop    %rbx
+  804785:	41 5f                	pop    %r15
+  804787:	5d                   	pop    %rbp
+  804788:	c3                   	ret
+
+0000000000804789 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804789:	55                   	push   %rbp
+  80478a:	48 89 e5             	mov    %rsp,%rbp
+  80478d:	41 57                	push   %r15
+  80478f:	53                   	push   %rbx
+  804790:	48 83 ec 40          	sub    $0x40,%rsp
+  804794:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804794 <fsipc_pages+0xb>
+  80479b:	49 bb ac 48 00 00 00 	movabs $0x48ac,%r11
+  8047a2:	00 00 00 
+  8047a5:	4c 01 db             	add    %r11,%rbx
+  8047a8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8047ab:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8047af:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8047b3:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8047b6:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8047bd:	00 00 00 
+  8047c0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8047c3:	85 c0                	test   %eax,%eax
+  8047c5:	75 24                	jne    8047eb <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8047c7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8047cc:	49 89 df             	mov    %rbx,%r15
+  8047cf:	48 b8 7f a9 ff ff ff 	movabs $0xffffffffffffa97f,%rax
+  8047d6:	ff ff ff 
+  8047d9:	48 01 d8             	add    %rbx,%rax
+  8047dc:	ff d0                	call   *%rax
+  8047de:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8047e5:	00 00 00 
+  8047e8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8047eb:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8047f0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8047f4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8047f7:	48 98                	cltq
+  8047f9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8047fd:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804801:	0f 95 c0             	setne  %al
+  804804:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804807:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80480e:	00 
+  80480f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804813:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804817:	48 01 d0             	add    %rdx,%rax
+  80481a:	48 83 e8 01          	sub    $0x1,%rax
+  80481e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804822:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804826:	ba 00 00 00 00       	mov    $0x0,%edx
+  80482b:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80482f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804833:	48 29 d0             	sub    %rdx,%rax
+  804836:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  80483a:	41 89 c2             	mov    %eax,%r10d
+  80483d:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804844:	00 00 00 
+  804847:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80484a:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80484e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804852:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804855:	48 83 ec 08          	sub    $0x8,%rsp
+  804859:	6a 40                	push   $0x40
+  80485b:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804860:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804867:	00 
+  804868:	6a 05                	push   $0x5
+  80486a:	41 89 f9             	mov    %edi,%r9d
+  80486d:	49 89 c8             	mov    %rcx,%r8
+  804870:	44 89 d1             	mov    %r10d,%ecx
+  804873:	89 c7                	mov    %eax,%edi
+  804875:	49 89 df             	mov    %rbx,%r15
+  804878:	48 b8 87 a5 ff ff ff 	movabs $0xffffffffffffa587,%rax
+  80487f:	ff ff ff 
+  804882:	48 01 d8             	add    %rbx,%rax
+  804885:	ff d0                	call   *%rax
+  804887:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80488b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80488f:	5b                   	pop    %rbx
+  804890:	41 5f                	pop    %r15
+  804892:	5d                   	pop    %rbp
+  804893:	c3                   	ret
+
+0000000000804894 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804894:	55                   	push   %rbp
+  804895:	48 89 e5             	mov    %rsp,%rbp
+  804898:	41 57                	push   %r15
+  80489a:	53                   	push   %rbx
+  80489b:	48 83 ec 20          	sub    $0x20,%rsp
+  80489f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80489f <open+0xb>
+  8048a6:	49 bb a1 47 00 00 00 	movabs $0x47a1,%r11
+  8048ad:	00 00 00 
+  8048b0:	4c 01 db             	add    %r11,%rbx
+  8048b3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048b7:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8048ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048be:	48 89 c7             	mov    %rax,%rdi
+  8048c1:	49 89 df             	mov    %rbx,%r15
+  8048c4:	48 b8 bd 81 ff ff ff 	movabs $0xffffffffffff81bd,%rax
+  8048cb:	ff ff ff 
+  8048ce:	48 01 d8             	add    %rbx,%rax
+  8048d1:	ff d0                	call   *%rax
+  8048d3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8048d8:	7e 0a                	jle    8048e4 <open+0x50>
+		return -E_BAD_PATH;
+  8048da:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8048df:	e9 18 01 00 00       	jmp    8049fc <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8048e4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8048e8:	48 89 c7             	mov    %rax,%rdi
+  8048eb:	49 89 df             	mov    %rbx,%r15
+  8048ee:	48 b8 88 aa ff ff ff 	movabs $0xffffffffffffaa88,%rax
+  8048f5:	ff ff ff 
+  8048f8:	48 01 d8             	add    %rbx,%rax
+  8048fb:	ff d0                	call   *%rax
+  8048fd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804900:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804904:	74 08                	je     80490e <open+0x7a>
+		return r;
+  804906:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804909:	e9 ee 00 00 00       	jmp    8049fc <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80490e:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804915:	00 00 00 
+  804918:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80491b:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804922:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804926:	48 89 c6             	mov    %rax,%rsi
+  804929:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804930:	00 00 00 
+  804933:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804937:	48 89 c7             	mov    %rax,%rdi
+  80493a:	49 89 df             	mov    %rbx,%r15
+  80493d:	48 b8 51 82 ff ff ff 	movabs $0xffffffffffff8251,%rax
+  804944:	ff ff ff 
+  804947:	48 01 d8             	add    %rbx,%rax
+  80494a:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  80494c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804950:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804955:	48 89 c6             	mov    %rax,%rsi
+  804958:	bf 00 00 00 00       	mov    $0x0,%edi
+  80495d:	49 89 df             	mov    %rbx,%r15
+  804960:	48 b8 0d 8f ff ff ff 	movabs $0xffffffffffff8f0d,%rax
+  804967:	ff ff ff 
+  80496a:	48 01 d8             	add    %rbx,%rax
+  80496d:	ff d0                	call   *%rax
+  80496f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804972:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804976:	74 23                	je     80499b <open+0x107>
+		fd_close(fd,0);
+  804978:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80497c:	be 00 00 00 00       	mov    $0x0,%esi
+  804981:	48 89 c7             	mov    %rax,%rdi
+  804984:	49 89 df             	mov    %rbx,%r15
+  804987:	48 b8 e9 ab ff ff ff 	movabs $0xffffffffffffabe9,%rax
+  80498e:	ff ff ff 
+  804991:	48 01 d8             	add    %rbx,%rax
+  804994:	ff d0                	call   *%rax
+		return r;
+  804996:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804999:	eb 61                	jmp    8049fc <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80499b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80499f:	48 89 c6             	mov    %rax,%rsi
+  8049a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8049a7:	48 b8 0d b6 ff ff ff 	movabs $0xffffffffffffb60d,%rax
+  8049ae:	ff ff ff 
+  8049b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049b5:	ff d0                	call   *%rax
+  8049b7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049be:	74 23                	je     8049e3 <open+0x14f>
+		fd_close(fd,0);
+  8049c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8049c9:	48 89 c7             	mov    %rax,%rdi
+  8049cc:	49 89 df             	mov    %rbx,%r15
+  8049cf:	48 b8 e9 ab ff ff ff 	movabs $0xffffffffffffabe9,%rax
+  8049d6:	ff ff ff 
+  8049d9:	48 01 d8             	add    %rbx,%rax
+  8049dc:	ff d0                	call   *%rax
+		return r;
+  8049de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049e1:	eb 19                	jmp    8049fc <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8049e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049e7:	48 89 c7             	mov    %rax,%rdi
+  8049ea:	49 89 df             	mov    %rbx,%r15
+  8049ed:	48 b8 0e aa ff ff ff 	movabs $0xffffffffffffaa0e,%rax
+  8049f4:	ff ff ff 
+  8049f7:	48 01 d8             	add    %rbx,%rax
+  8049fa:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8049fc:	48 83 c4 20          	add    $0x20,%rsp
+  804a00:	5b                   	pop    %rbx
+  804a01:	41 5f                	pop    %r15
+  804a03:	5d                   	pop    %rbp
+  804a04:	c3                   	ret
+
+0000000000804a05 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804a05:	55                   	push   %rbp
+  804a06:	48 89 e5             	mov    %rsp,%rbp
+  804a09:	48 83 ec 20          	sub    $0x20,%rsp
+  804a0d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a0d <devfile_flush+0x8>
+  804a14:	49 bb 33 46 00 00 00 	movabs $0x4633,%r11
+  804a1b:	00 00 00 
+  804a1e:	4c 01 d8             	add    %r11,%rax
+  804a21:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804a25:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a29:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804a2c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804a2f:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804a33:	ba 04 00 00 00       	mov    $0x4,%edx
+  804a38:	48 89 ce             	mov    %rcx,%rsi
+  804a3b:	bf 06 00 00 00       	mov    $0x6,%edi
+  804a40:	48 b9 b5 b6 ff ff ff 	movabs $0xffffffffffffb6b5,%rcx
+  804a47:	ff ff ff 
+  804a4a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804a4e:	ff d0                	call   *%rax
+}
+  804a50:	c9                   	leave
+  804a51:	c3                   	ret
+
+0000000000804a52 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804a52:	55                   	push   %rbp
+  804a53:	48 89 e5             	mov    %rsp,%rbp
+  804a56:	41 57                	push   %r15
+  804a58:	53                   	push   %rbx
+  804a59:	48 83 ec 60          	sub    $0x60,%rsp
+  804a5d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a5d <devfile_read+0xb>
+  804a64:	49 bb e3 45 00 00 00 	movabs $0x45e3,%r11
+  804a6b:	00 00 00 
+  804a6e:	4c 01 db             	add    %r11,%rbx
+  804a71:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804a75:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804a79:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804a7d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804a81:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804a85:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804a89:	8b 50 0c             	mov    0xc(%rax),%edx
+  804a8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a90:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804a92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a96:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804a9a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804a9e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804aa2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804aa7:	ba 10 00 00 00       	mov    $0x10,%edx
+  804aac:	48 89 c6             	mov    %rax,%rsi
+  804aaf:	bf 03 00 00 00       	mov    $0x3,%edi
+  804ab4:	48 b8 49 b7 ff ff ff 	movabs $0xffffffffffffb749,%rax
+  804abb:	ff ff ff 
+  804abe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ac2:	ff d0                	call   *%rax
+  804ac4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804ac7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804acb:	79 05                	jns    804ad2 <devfile_read+0x80>
+		return r;
+  804acd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ad0:	eb 64                	jmp    804b36 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804ad2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ad5:	48 63 d0             	movslq %eax,%rdx
+  804ad8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804adc:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804ae1:	48 01 c1             	add    %rax,%rcx
+  804ae4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804ae8:	48 89 ce             	mov    %rcx,%rsi
+  804aeb:	48 89 c7             	mov    %rax,%rdi
+  804aee:	49 89 df             	mov    %rbx,%r15
+  804af1:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  804af8:	ff ff ff 
+  804afb:	48 01 d8             	add    %rbx,%rax
+  804afe:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804b00:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804b07:	ff ff ff 
+  804b0a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804b0e:	48 8b 00             	mov    (%rax),%rax
+  804b11:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804b17:	89 c6                	mov    %eax,%esi
+  804b19:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804b1e:	48 89 c7             	mov    %rax,%rdi
+  804b21:	49 89 df             	mov    %rbx,%r15
+  804b24:	48 b8 39 a9 ff ff ff 	movabs $0xffffffffffffa939,%rax
+  804b2b:	ff ff ff 
+  804b2e:	48 01 d8             	add    %rbx,%rax
+  804b31:	ff d0                	call   *%rax
+	return r;
+  804b33:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804b36:	48 83 c4 60          	add    $0x60,%rsp
+  804b3a:	5b                   	pop    %rbx
+  804b3b:	41 5f                	pop    %r15
+  804b3d:	5d                   	pop    %rbp
+  804b3e:	c3                   	ret
+
+0000000000804b3f <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804b3f:	55                   	push   %rbp
+  804b40:	48 89 e5             	mov    %rsp,%rbp
+  804b43:	41 57                	push   %r15
+  804b45:	53                   	push   %rbx
+  804b46:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804b4a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b4a <devfile_write+0xb>
+  804b51:	49 bb f6 44 00 00 00 	movabs $0x44f6,%r11
+  804b58:	00 00 00 
+  804b5b:	4c 01 db             	add    %r11,%rbx
+  804b5e:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804b62:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804b66:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804b6d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804b71:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804b75:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804b7c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804b80:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804b87:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b8a:	48 63 d0             	movslq %eax,%rdx
+  804b8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b91:	48 39 c2             	cmp    %rax,%rdx
+  804b94:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804b98:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804b9f:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804ba6:	00 
+  804ba7:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804bae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bb2:	48 01 d0             	add    %rdx,%rax
+  804bb5:	48 83 e8 01          	sub    $0x1,%rax
+  804bb9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804bbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bc6:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804bca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bce:	48 29 d0             	sub    %rdx,%rax
+  804bd1:	48 c1 e8 0c          	shr    $0xc,%rax
+  804bd5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804bd8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804bdb:	89 c6                	mov    %eax,%esi
+  804bdd:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804be2:	48 89 c7             	mov    %rax,%rdi
+  804be5:	49 89 df             	mov    %rbx,%r15
+  804be8:	48 b8 f3 a8 ff ff ff 	movabs $0xffffffffffffa8f3,%rax
+  804bef:	ff ff ff 
+  804bf2:	48 01 d8             	add    %rbx,%rax
+  804bf5:	ff d0                	call   *%rax
+  804bf7:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804bfa:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804bfe:	79 08                	jns    804c08 <devfile_write+0xc9>
+		return r;
+  804c00:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804c03:	e9 8f 00 00 00       	jmp    804c97 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804c08:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804c0f:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804c13:	48 89 c6             	mov    %rax,%rsi
+  804c16:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804c1b:	48 89 c7             	mov    %rax,%rdi
+  804c1e:	49 89 df             	mov    %rbx,%r15
+  804c21:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  804c28:	ff ff ff 
+  804c2b:	48 01 d8             	add    %rbx,%rax
+  804c2e:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804c30:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804c34:	8b 50 0c             	mov    0xc(%rax),%edx
+  804c37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c3b:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804c3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c41:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804c48:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804c4c:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804c4f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804c53:	89 d1                	mov    %edx,%ecx
+  804c55:	ba 10 00 00 00       	mov    $0x10,%edx
+  804c5a:	48 89 c6             	mov    %rax,%rsi
+  804c5d:	bf 04 00 00 00       	mov    $0x4,%edi
+  804c62:	48 b8 49 b7 ff ff ff 	movabs $0xffffffffffffb749,%rax
+  804c69:	ff ff ff 
+  804c6c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c70:	ff d0                	call   *%rax
+  804c72:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804c75:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804c78:	89 c6                	mov    %eax,%esi
+  804c7a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804c7f:	48 89 c7             	mov    %rax,%rdi
+  804c82:	49 89 df             	mov    %rbx,%r15
+  804c85:	48 b8 39 a9 ff ff ff 	movabs $0xffffffffffffa939,%rax
+  804c8c:	ff ff ff 
+  804c8f:	48 01 d8             	add    %rbx,%rax
+  804c92:	ff d0                	call   *%rax
+	return r;
+  804c94:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804c97:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804c9b:	5b                   	pop    %rbx
+  804c9c:	41 5f                	pop    %r15
+  804c9e:	5d                   	pop    %rbp
+  804c9f:	c3                   	ret
+
+0000000000804ca0 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804ca0:	55                   	push   %rbp
+  804ca1:	48 89 e5             	mov    %rsp,%rbp
+  804ca4:	41 57                	push   %r15
+  804ca6:	53                   	push   %rbx
+  804ca7:	48 83 ec 20          	sub    $0x20,%rsp
+  804cab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cab <devfile_stat+0xb>
+  804cb2:	49 bb 95 43 00 00 00 	movabs $0x4395,%r11
+  804cb9:	00 00 00 
+  804cbc:	4c 01 db             	add    %r11,%rbx
+  804cbf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804cc3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804cc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ccb:	8b 40 0c             	mov    0xc(%rax),%eax
+  804cce:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804cd5:	00 00 00 
+  804cd8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804cdb:	be 00 00 00 00       	mov    $0x0,%esi
+  804ce0:	bf 05 00 00 00       	mov    $0x5,%edi
+  804ce5:	48 b8 0d b6 ff ff ff 	movabs $0xffffffffffffb60d,%rax
+  804cec:	ff ff ff 
+  804cef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cf3:	ff d0                	call   *%rax
+  804cf5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cf8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cfc:	79 05                	jns    804d03 <devfile_stat+0x63>
+		return r;
+  804cfe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d01:	eb 65                	jmp    804d68 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804d03:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d07:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804d0e:	00 00 00 
+  804d11:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804d15:	48 89 d6             	mov    %rdx,%rsi
+  804d18:	48 89 c7             	mov    %rax,%rdi
+  804d1b:	49 89 df             	mov    %rbx,%r15
+  804d1e:	48 b8 51 82 ff ff ff 	movabs $0xffffffffffff8251,%rax
+  804d25:	ff ff ff 
+  804d28:	48 01 d8             	add    %rbx,%rax
+  804d2b:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804d2d:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804d34:	00 00 00 
+  804d37:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804d3e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d42:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804d48:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804d4f:	00 00 00 
+  804d52:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804d59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d5d:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804d63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d68:	48 83 c4 20          	add    $0x20,%rsp
+  804d6c:	5b                   	pop    %rbx
+  804d6d:	41 5f                	pop    %r15
+  804d6f:	5d                   	pop    %rbp
+  804d70:	c3                   	ret
+
+0000000000804d71 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804d71:	55                   	push   %rbp
+  804d72:	48 89 e5             	mov    %rsp,%rbp
+  804d75:	48 83 ec 20          	sub    $0x20,%rsp
+  804d79:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d79 <devfile_trunc+0x8>
+  804d80:	49 bb c7 42 00 00 00 	movabs $0x42c7,%r11
+  804d87:	00 00 00 
+  804d8a:	4c 01 d8             	add    %r11,%rax
+  804d8d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d91:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804d94:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d98:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804d9b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804d9e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804da1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804da4:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804da8:	ba 08 00 00 00       	mov    $0x8,%edx
+  804dad:	48 89 ce             	mov    %rcx,%rsi
+  804db0:	bf 02 00 00 00       	mov    $0x2,%edi
+  804db5:	48 b9 b5 b6 ff ff ff 	movabs $0xffffffffffffb6b5,%rcx
+  804dbc:	ff ff ff 
+  804dbf:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804dc3:	ff d0                	call   *%rax
+}
+  804dc5:	c9                   	leave
+  804dc6:	c3                   	ret
+
+0000000000804dc7 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  804dc7:	55                   	push   %rbp
+  804dc8:	48 89 e5             	mov    %rsp,%rbp
+  804dcb:	41 57                	push   %r15
+  804dcd:	53                   	push   %rbx
+  804dce:	48 83 ec 10          	sub    $0x10,%rsp
+  804dd2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804dd2 <remove+0xb>
+  804dd9:	49 bb 6e 42 00 00 00 	movabs $0x426e,%r11
+  804de0:	00 00 00 
+  804de3:	4c 01 db             	add    %r11,%rbx
+  804de6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  804dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804dee:	48 89 c7             	mov    %rax,%rdi
+  804df1:	49 89 df             	mov    %rbx,%r15
+  804df4:	48 b8 bd 81 ff ff ff 	movabs $0xffffffffffff81bd,%rax
+  804dfb:	ff ff ff 
+  804dfe:	48 01 d8             	add    %rbx,%rax
+  804e01:	ff d0                	call   *%rax
+  804e03:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804e08:	7e 07                	jle    804e11 <remove+0x4a>
+		return -E_BAD_PATH;
+  804e0a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804e0f:	eb 44                	jmp    804e55 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804e11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e15:	48 89 c6             	mov    %rax,%rsi
+  804e18:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804e1f:	00 00 00 
+  804e22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e26:	48 89 c7             	mov    %rax,%rdi
+  804e29:	49 89 df             	mov    %rbx,%r15
+  804e2c:	48 b8 51 82 ff ff ff 	movabs $0xffffffffffff8251,%rax
+  804e33:	ff ff ff 
+  804e36:	48 01 d8             	add    %rbx,%rax
+  804e39:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804e3b:	be 00 00 00 00       	mov    $0x0,%esi
+  804e40:	bf 07 00 00 00       	mov    $0x7,%edi
+  804e45:	48 b8 0d b6 ff ff ff 	movabs $0xffffffffffffb60d,%rax
+  804e4c:	ff ff ff 
+  804e4f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e53:	ff d0                	call   *%rax
+}
+  804e55:	48 83 c4 10          	add    $0x10,%rsp
+  804e59:	5b                   	pop    %rbx
+  804e5a:	41 5f                	pop    %r15
+  804e5c:	5d                   	pop    %rbp
+  804e5d:	c3                   	ret
+
+0000000000804e5e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804e5e:	55                   	push   %rbp
+  804e5f:	48 89 e5             	mov    %rsp,%rbp
+  804e62:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e62 <sync+0x4>
+  804e69:	49 bb de 41 00 00 00 	movabs $0x41de,%r11
+  804e70:	00 00 00 
+  804e73:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e7b:	be 00 00 00 00       	mov    $0x0,%esi
+  804e80:	bf 08 00 00 00       	mov    $0x8,%edi
+  804e85:	48 b9 b5 b6 ff ff ff 	movabs $0xffffffffffffb6b5,%rcx
+  804e8c:	ff ff ff 
+  804e8f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804e93:	ff d0                	call   *%rax
+}
+  804e95:	5d                   	pop    %rbp
+  804e96:	c3                   	ret
+
+0000000000804e97 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804e97:	55                   	push   %rbp
+  804e98:	48 89 e5             	mov    %rsp,%rbp
+  804e9b:	41 57                	push   %r15
+  804e9d:	53                   	push   %rbx
+  804e9e:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804ea5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ea5 <copy+0xe>
+  804eac:	49 bb 9b 41 00 00 00 	movabs $0x419b,%r11
+  804eb3:	00 00 00 
+  804eb6:	4c 01 db             	add    %r11,%rbx
+  804eb9:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804ec0:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  804ec7:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804ece:	be 00 00 00 00       	mov    $0x0,%esi
+  804ed3:	48 89 c7             	mov    %rax,%rdi
+  804ed6:	48 b8 54 b8 ff ff ff 	movabs $0xffffffffffffb854,%rax
+  804edd:	ff ff ff 
+  804ee0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ee4:	ff d0                	call   *%rax
+  804ee6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  804ee9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804eed:	79 35                	jns    804f24 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  804eef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ef2:	89 c6                	mov    %eax,%esi
+  804ef4:	48 b8 be e2 ff ff ff 	movabs $0xffffffffffffe2be,%rax
+  804efb:	ff ff ff 
+  804efe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f02:	48 89 c7             	mov    %rax,%rdi
+  804f05:	49 89 df             	mov    %rbx,%r15
+  804f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f0d:	48 ba 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rdx
+  804f14:	ff ff ff 
+  804f17:	48 01 da             	add    %rbx,%rdx
+  804f1a:	ff d2                	call   *%rdx
+		return fd_src;
+  804f1c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f1f:	e9 d7 01 00 00       	jmp    8050fb <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804f24:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804f2b:	be 01 01 00 00       	mov    $0x101,%esi
+  804f30:	48 89 c7             	mov    %rax,%rdi
+  804f33:	48 b8 54 b8 ff ff ff 	movabs $0xffffffffffffb854,%rax
+  804f3a:	ff ff ff 
+  804f3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f41:	ff d0                	call   *%rax
+  804f43:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804f46:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804f4a:	0f 89 df 00 00 00    	jns    80502f <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804f50:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804f53:	89 c6                	mov    %eax,%esi
+  804f55:	48 b8 d4 e2 ff ff ff 	movabs $0xffffffffffffe2d4,%rax
+  804f5c:	ff ff ff 
+  804f5f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f63:	48 89 c7             	mov    %rax,%rdi
+  804f66:	49 89 df             	mov    %rbx,%r15
+  804f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6e:	48 ba 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rdx
+  804f75:	ff ff ff 
+  804f78:	48 01 da             	add    %rbx,%rdx
+  804f7b:	ff d2                	call   *%rdx
+		close(fd_src);
+  804f7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f80:	89 c7                	mov    %eax,%edi
+  804f82:	49 89 df             	mov    %rbx,%r15
+  804f85:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  804f8c:	ff ff ff 
+  804f8f:	48 01 d8             	add    %rbx,%rax
+  804f92:	ff d0                	call   *%rax
+		return fd_dest;
+  804f94:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804f97:	e9 5f 01 00 00       	jmp    8050fb <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804f9c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804f9f:	48 63 d0             	movslq %eax,%rdx
+  804fa2:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804fa9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804fac:	48 89 ce             	mov    %rcx,%rsi
+  804faf:	89 c7                	mov    %eax,%edi
+  804fb1:	49 89 df             	mov    %rbx,%r15
+  804fb4:	48 b8 2b b2 ff ff ff 	movabs $0xffffffffffffb22b,%rax
+  804fbb:	ff ff ff 
+  804fbe:	48 01 d8             	add    %rbx,%rax
+  804fc1:	ff d0                	call   *%rax
+  804fc3:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804fc6:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804fca:	79 63                	jns    80502f <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804fcc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804fcf:	89 c6                	mov    %eax,%esi
+  804fd1:	48 b8 ee e2 ff ff ff 	movabs $0xffffffffffffe2ee,%rax
+  804fd8:	ff ff ff 
+  804fdb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fdf:	48 89 c7             	mov    %rax,%rdi
+  804fe2:	49 89 df             	mov    %rbx,%r15
+  804fe5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fea:	48 ba 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rdx
+  804ff1:	ff ff ff 
+  804ff4:	48 01 da             	add    %rbx,%rdx
+  804ff7:	ff d2                	call   *%rdx
+			close(fd_src);
+  804ff9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ffc:	89 c7                	mov    %eax,%edi
+  804ffe:	49 89 df             	mov    %rbx,%r15
+  805001:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  805008:	ff ff ff 
+  80500b:	48 01 d8             	add    %rbx,%rax
+  80500e:	ff d0                	call   *%rax
+			close(fd_dest);
+  805010:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805013:	89 c7                	mov    %eax,%edi
+  805015:	49 89 df             	mov    %rbx,%r15
+  805018:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  80501f:	ff ff ff 
+  805022:	48 01 d8             	add    %rbx,%rax
+  805025:	ff d0                	call   *%rax
+			return write_size;
+  805027:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80502a:	e9 cc 00 00 00       	jmp    8050fb <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  80502f:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805036:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805039:	ba 00 02 00 00       	mov    $0x200,%edx
+  80503e:	48 89 ce             	mov    %rcx,%rsi
+  805041:	89 c7                	mov    %eax,%edi
+  805043:	49 89 df             	mov    %rbx,%r15
+  805046:	48 b8 85 b0 ff ff ff 	movabs $0xffffffffffffb085,%rax
+  80504d:	ff ff ff 
+  805050:	48 01 d8             	add    %rbx,%rax
+  805053:	ff d0                	call   *%rax
+  805055:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805058:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80505c:	0f 8f 3a ff ff ff    	jg     804f9c <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805062:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805066:	79 60                	jns    8050c8 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  805068:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80506b:	89 c6                	mov    %eax,%esi
+  80506d:	48 b8 01 e3 ff ff ff 	movabs $0xffffffffffffe301,%rax
+  805074:	ff ff ff 
+  805077:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80507b:	48 89 c7             	mov    %rax,%rdi
+  80507e:	49 89 df             	mov    %rbx,%r15
+  805081:	b8 00 00 00 00       	mov    $0x0,%eax
+  805086:	48 ba 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rdx
+  80508d:	ff ff ff 
+  805090:	48 01 da             	add    %rbx,%rdx
+  805093:	ff d2                	call   *%rdx
+		close(fd_src);
+  805095:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805098:	89 c7                	mov    %eax,%edi
+  80509a:	49 89 df             	mov    %rbx,%r15
+  80509d:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  8050a4:	ff ff ff 
+  8050a7:	48 01 d8             	add    %rbx,%rax
+  8050aa:	ff d0                	call   *%rax
+		close(fd_dest);
+  8050ac:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8050af:	89 c7                	mov    %eax,%edi
+  8050b1:	49 89 df             	mov    %rbx,%r15
+  8050b4:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  8050bb:	ff ff ff 
+  8050be:	48 01 d8             	add    %rbx,%rax
+  8050c1:	ff d0                	call   *%rax
+		return read_size;
+  8050c3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8050c6:	eb 33                	jmp    8050fb <copy+0x264>
+	}
+	close(fd_src);
+  8050c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050cb:	89 c7                	mov    %eax,%edi
+  8050cd:	49 89 df             	mov    %rbx,%r15
+  8050d0:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  8050d7:	ff ff ff 
+  8050da:	48 01 d8             	add    %rbx,%rax
+  8050dd:	ff d0                	call   *%rax
+	close(fd_dest);
+  8050df:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8050e2:	89 c7                	mov    %eax,%edi
+  8050e4:	49 89 df             	mov    %rbx,%r15
+  8050e7:	48 b8 cd ad ff ff ff 	movabs $0xffffffffffffadcd,%rax
+  8050ee:	ff ff ff 
+  8050f1:	48 01 d8             	add    %rbx,%rax
+  8050f4:	ff d0                	call   *%rax
+	return 0;
+  8050f6:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8050fb:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  805102:	5b                   	pop    %rbx
+  805103:	41 5f                	pop    %r15
+  805105:	5d                   	pop    %rbp
+  805106:	c3                   	ret
+
+0000000000805107 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805107:	55                   	push   %rbp
+  805108:	48 89 e5             	mov    %rsp,%rbp
+  80510b:	41 57                	push   %r15
+  80510d:	53                   	push   %rbx
+  80510e:	48 83 ec 20          	sub    $0x20,%rsp
+  805112:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805112 <fd2sockid+0xb>
+  805119:	49 bb 2e 3f 00 00 00 	movabs $0x3f2e,%r11
+  805120:	00 00 00 
+  805123:	4c 01 db             	add    %r11,%rbx
+  805126:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805129:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80512d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805130:	48 89 d6             	mov    %rdx,%rsi
+  805133:	89 c7                	mov    %eax,%edi
+  805135:	49 89 df             	mov    %rbx,%r15
+  805138:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  80513f:	ff ff ff 
+  805142:	48 01 d8             	add    %rbx,%rax
+  805145:	ff d0                	call   *%rax
+  805147:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80514a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80514e:	79 05                	jns    805155 <fd2sockid+0x4e>
+		return r;
+  805150:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805153:	eb 25                	jmp    80517a <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805155:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805159:	8b 10                	mov    (%rax),%edx
+  80515b:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  805162:	00 00 00 
+  805165:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805168:	39 c2                	cmp    %eax,%edx
+  80516a:	74 07                	je     805173 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80516c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  805171:	eb 07                	jmp    80517a <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  805173:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805177:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  80517a:	48 83 c4 20          	add    $0x20,%rsp
+  80517e:	5b                   	pop    %rbx
+  80517f:	41 5f                	pop    %r15
+  805181:	5d                   	pop    %rbp
+  805182:	c3                   	ret
+
+0000000000805183 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  805183:	55                   	push   %rbp
+  805184:	48 89 e5             	mov    %rsp,%rbp
+  805187:	41 57                	push   %r15
+  805189:	53                   	push   %rbx
+  80518a:	48 83 ec 20          	sub    $0x20,%rsp
+  80518e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80518e <alloc_sockfd+0xb>
+  805195:	49 bb b2 3e 00 00 00 	movabs $0x3eb2,%r11
+  80519c:	00 00 00 
+  80519f:	4c 01 db             	add    %r11,%rbx
+  8051a2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8051a5:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8051a9:	48 89 c7             	mov    %rax,%rdi
+  8051ac:	49 89 df             	mov    %rbx,%r15
+  8051af:	48 b8 88 aa ff ff ff 	movabs $0xffffffffffffaa88,%rax
+  8051b6:	ff ff ff 
+  8051b9:	48 01 d8             	add    %rbx,%rax
+  8051bc:	ff d0                	call   *%rax
+  8051be:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051c5:	78 2c                	js     8051f3 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8051c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051cb:	ba 07 04 00 00       	mov    $0x407,%edx
+  8051d0:	48 89 c6             	mov    %rax,%rsi
+  8051d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051d8:	49 89 df             	mov    %rbx,%r15
+  8051db:	48 b8 0d 8f ff ff ff 	movabs $0xffffffffffff8f0d,%rax
+  8051e2:	ff ff ff 
+  8051e5:	48 01 d8             	add    %rbx,%rax
+  8051e8:	ff d0                	call   *%rax
+  8051ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051f1:	79 1c                	jns    80520f <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8051f3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8051f6:	89 c7                	mov    %eax,%edi
+  8051f8:	49 89 df             	mov    %rbx,%r15
+  8051fb:	48 b8 37 c9 ff ff ff 	movabs $0xffffffffffffc937,%rax
+  805202:	ff ff ff 
+  805205:	48 01 d8             	add    %rbx,%rax
+  805208:	ff d0                	call   *%rax
+		return r;
+  80520a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80520d:	eb 41                	jmp    805250 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80520f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805213:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  80521a:	00 00 00 
+  80521d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805220:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805222:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805226:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80522d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805231:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805234:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805237:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80523b:	48 89 c7             	mov    %rax,%rdi
+  80523e:	49 89 df             	mov    %rbx,%r15
+  805241:	48 b8 0e aa ff ff ff 	movabs $0xffffffffffffaa0e,%rax
+  805248:	ff ff ff 
+  80524b:	48 01 d8             	add    %rbx,%rax
+  80524e:	ff d0                	call   *%rax
+}
+  805250:	48 83 c4 20          	add    $0x20,%rsp
+  805254:	5b                   	pop    %rbx
+  805255:	41 5f                	pop    %r15
+  805257:	5d                   	pop    %rbp
+  805258:	c3                   	ret
+
+0000000000805259 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805259:	55                   	push   %rbp
+  80525a:	48 89 e5             	mov    %rsp,%rbp
+  80525d:	41 57                	push   %r15
+  80525f:	53                   	push   %rbx
+  805260:	48 83 ec 30          	sub    $0x30,%rsp
+  805264:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805264 <accept+0xb>
+  80526b:	49 bb dc 3d 00 00 00 	movabs $0x3ddc,%r11
+  805272:	00 00 00 
+  805275:	4c 01 db             	add    %r11,%rbx
+  805278:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80527b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80527f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805283:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805286:	89 c7                	mov    %eax,%edi
+  805288:	48 b8 c7 c0 ff ff ff 	movabs $0xffffffffffffc0c7,%rax
+  80528f:	ff ff ff 
+  805292:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805296:	ff d0                	call   *%rax
+  805298:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80529b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80529f:	79 05                	jns    8052a6 <accept+0x4d>
+		return r;
+  8052a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052a4:	eb 45                	jmp    8052eb <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8052a6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8052aa:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8052ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052b1:	48 89 ce             	mov    %rcx,%rsi
+  8052b4:	89 c7                	mov    %eax,%edi
+  8052b6:	49 89 df             	mov    %rbx,%r15
+  8052b9:	48 b8 a5 c7 ff ff ff 	movabs $0xffffffffffffc7a5,%rax
+  8052c0:	ff ff ff 
+  8052c3:	48 01 d8             	add    %rbx,%rax
+  8052c6:	ff d0                	call   *%rax
+  8052c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052cf:	79 05                	jns    8052d6 <accept+0x7d>
+		return r;
+  8052d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052d4:	eb 15                	jmp    8052eb <accept+0x92>
+	return alloc_sockfd(r);
+  8052d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052d9:	89 c7                	mov    %eax,%edi
+  8052db:	48 b8 43 c1 ff ff ff 	movabs $0xffffffffffffc143,%rax
+  8052e2:	ff ff ff 
+  8052e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052e9:	ff d0                	call   *%rax
+}
+  8052eb:	48 83 c4 30          	add    $0x30,%rsp
+  8052ef:	5b                   	pop    %rbx
+  8052f0:	41 5f                	pop    %r15
+  8052f2:	5d                   	pop    %rbp
+  8052f3:	c3                   	ret
+
+00000000008052f4 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8052f4:	55                   	push   %rbp
+  8052f5:	48 89 e5             	mov    %rsp,%rbp
+  8052f8:	41 57                	push   %r15
+  8052fa:	53                   	push   %rbx
+  8052fb:	48 83 ec 20          	sub    $0x20,%rsp
+  8052ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052ff <bind+0xb>
+  805306:	49 bb 41 3d 00 00 00 	movabs $0x3d41,%r11
+  80530d:	00 00 00 
+  805310:	4c 01 db             	add    %r11,%rbx
+  805313:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805316:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80531a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80531d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805320:	89 c7                	mov    %eax,%edi
+  805322:	48 b8 c7 c0 ff ff ff 	movabs $0xffffffffffffc0c7,%rax
+  805329:	ff ff ff 
+  80532c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805330:	ff d0                	call   *%rax
+  805332:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805335:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805339:	79 05                	jns    805340 <bind+0x4c>
+		return r;
+  80533b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80533e:	eb 21                	jmp    805361 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  805340:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805343:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805347:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80534a:	48 89 ce             	mov    %rcx,%rsi
+  80534d:	89 c7                	mov    %eax,%edi
+  80534f:	49 89 df             	mov    %rbx,%r15
+  805352:	48 b8 51 c8 ff ff ff 	movabs $0xffffffffffffc851,%rax
+  805359:	ff ff ff 
+  80535c:	48 01 d8             	add    %rbx,%rax
+  80535f:	ff d0                	call   *%rax
+}
+  805361:	48 83 c4 20          	add    $0x20,%rsp
+  805365:	5b                   	pop    %rbx
+  805366:	41 5f                	pop    %r15
+  805368:	5d                   	pop    %rbp
+  805369:	c3                   	ret
+
+000000000080536a <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80536a:	55                   	push   %rbp
+  80536b:	48 89 e5             	mov    %rsp,%rbp
+  80536e:	41 57                	push   %r15
+  805370:	53                   	push   %rbx
+  805371:	48 83 ec 20          	sub    $0x20,%rsp
+  805375:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805375 <shutdown+0xb>
+  80537c:	49 bb cb 3c 00 00 00 	movabs $0x3ccb,%r11
+  805383:	00 00 00 
+  805386:	4c 01 db             	add    %r11,%rbx
+  805389:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80538c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80538f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805392:	89 c7                	mov    %eax,%edi
+  805394:	48 b8 c7 c0 ff ff ff 	movabs $0xffffffffffffc0c7,%rax
+  80539b:	ff ff ff 
+  80539e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053a2:	ff d0                	call   *%rax
+  8053a4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053ab:	79 05                	jns    8053b2 <shutdown+0x48>
+		return r;
+  8053ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b0:	eb 1c                	jmp    8053ce <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8053b2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8053b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b8:	89 d6                	mov    %edx,%esi
+  8053ba:	89 c7                	mov    %eax,%edi
+  8053bc:	49 89 df             	mov    %rbx,%r15
+  8053bf:	48 b8 e6 c8 ff ff ff 	movabs $0xffffffffffffc8e6,%rax
+  8053c6:	ff ff ff 
+  8053c9:	48 01 d8             	add    %rbx,%rax
+  8053cc:	ff d0                	call   *%rax
+}
+  8053ce:	48 83 c4 20          	add    $0x20,%rsp
+  8053d2:	5b                   	pop    %rbx
+  8053d3:	41 5f                	pop    %r15
+  8053d5:	5d                   	pop    %rbp
+  8053d6:	c3                   	ret
+
+00000000008053d7 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8053d7:	55                   	push   %rbp
+  8053d8:	48 89 e5             	mov    %rsp,%rbp
+  8053db:	41 57                	push   %r15
+  8053dd:	53                   	push   %rbx
+  8053de:	48 83 ec 10          	sub    $0x10,%rsp
+  8053e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053e2 <devsock_close+0xb>
+  8053e9:	49 bb 5e 3c 00 00 00 	movabs $0x3c5e,%r11
+  8053f0:	00 00 00 
+  8053f3:	4c 01 db             	add    %r11,%rbx
+  8053f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  8053fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053fe:	48 89 c7             	mov    %rax,%rdi
+  805401:	49 89 df             	mov    %rbx,%r15
+  805404:	48 b8 f2 db ff ff ff 	movabs $0xffffffffffffdbf2,%rax
+  80540b:	ff ff ff 
+  80540e:	48 01 d8             	add    %rbx,%rax
+  805411:	ff d0                	call   *%rax
+  805413:	83 f8 01             	cmp    $0x1,%eax
+  805416:	75 1d                	jne    805435 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805418:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80541c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80541f:	89 c7                	mov    %eax,%edi
+  805421:	49 89 df             	mov    %rbx,%r15
+  805424:	48 b8 37 c9 ff ff ff 	movabs $0xffffffffffffc937,%rax
+  80542b:	ff ff ff 
+  80542e:	48 01 d8             	add    %rbx,%rax
+  805431:	ff d0                	call   *%rax
+  805433:	eb 05                	jmp    80543a <devsock_close+0x63>
+	else
+		return 0;
+  805435:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80543a:	48 83 c4 10          	add    $0x10,%rsp
+  80543e:	5b                   	pop    %rbx
+  80543f:	41 5f                	pop    %r15
+  805441:	5d                   	pop    %rbp
+  805442:	c3                   	ret
+
+0000000000805443 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805443:	55                   	push   %rbp
+  805444:	48 89 e5             	mov    %rsp,%rbp
+  805447:	41 57                	push   %r15
+  805449:	53                   	push   %rbx
+  80544a:	48 83 ec 20          	sub    $0x20,%rsp
+  80544e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80544e <connect+0xb>
+  805455:	49 bb f2 3b 00 00 00 	movabs $0x3bf2,%r11
+  80545c:	00 00 00 
+  80545f:	4c 01 db             	add    %r11,%rbx
+  805462:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805465:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805469:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80546c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80546f:	89 c7                	mov    %eax,%edi
+  805471:	48 b8 c7 c0 ff ff ff 	movabs $0xffffffffffffc0c7,%rax
+  805478:	ff ff ff 
+  80547b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80547f:	ff d0                	call   *%rax
+  805481:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805484:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805488:	79 05                	jns    80548f <connect+0x4c>
+		return r;
+  80548a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80548d:	eb 21                	jmp    8054b0 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80548f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805492:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805496:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805499:	48 89 ce             	mov    %rcx,%rsi
+  80549c:	89 c7                	mov    %eax,%edi
+  80549e:	49 89 df             	mov    %rbx,%r15
+  8054a1:	48 b8 7f c9 ff ff ff 	movabs $0xffffffffffffc97f,%rax
+  8054a8:	ff ff ff 
+  8054ab:	48 01 d8             	add    %rbx,%rax
+  8054ae:	ff d0                	call   *%rax
+}
+  8054b0:	48 83 c4 20          	add    $0x20,%rsp
+  8054b4:	5b                   	pop    %rbx
+  8054b5:	41 5f                	pop    %r15
+  8054b7:	5d                   	pop    %rbp
+  8054b8:	c3                   	ret
+
+00000000008054b9 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8054b9:	55                   	push   %rbp
+  8054ba:	48 89 e5             	mov    %rsp,%rbp
+  8054bd:	41 57                	push   %r15
+  8054bf:	53                   	push   %rbx
+  8054c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8054c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054c4 <listen+0xb>
+  8054cb:	49 bb 7c 3b 00 00 00 	movabs $0x3b7c,%r11
+  8054d2:	00 00 00 
+  8054d5:	4c 01 db             	add    %r11,%rbx
+  8054d8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8054db:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8054de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054e1:	89 c7                	mov    %eax,%edi
+  8054e3:	48 b8 c7 c0 ff ff ff 	movabs $0xffffffffffffc0c7,%rax
+  8054ea:	ff ff ff 
+  8054ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054f1:	ff d0                	call   *%rax
+  8054f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054fa:	79 05                	jns    805501 <listen+0x48>
+		return r;
+  8054fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054ff:	eb 1c                	jmp    80551d <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805501:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805504:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805507:	89 d6                	mov    %edx,%esi
+  805509:	89 c7                	mov    %eax,%edi
+  80550b:	49 89 df             	mov    %rbx,%r15
+  80550e:	48 b8 14 ca ff ff ff 	movabs $0xffffffffffffca14,%rax
+  805515:	ff ff ff 
+  805518:	48 01 d8             	add    %rbx,%rax
+  80551b:	ff d0                	call   *%rax
+}
+  80551d:	48 83 c4 20          	add    $0x20,%rsp
+  805521:	5b                   	pop    %rbx
+  805522:	41 5f                	pop    %r15
+  805524:	5d                   	pop    %rbp
+  805525:	c3                   	ret
+
+0000000000805526 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805526:	55                   	push   %rbp
+  805527:	48 89 e5             	mov    %rsp,%rbp
+  80552a:	41 57                	push   %r15
+  80552c:	48 83 ec 28          	sub    $0x28,%rsp
+  805530:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805530 <devsock_read+0xa>
+  805537:	49 bb 10 3b 00 00 00 	movabs $0x3b10,%r11
+  80553e:	00 00 00 
+  805541:	4c 01 d8             	add    %r11,%rax
+  805544:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805548:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80554c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805550:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805554:	41 89 d0             	mov    %edx,%r8d
+  805557:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80555b:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80555e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805562:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805567:	44 89 c2             	mov    %r8d,%edx
+  80556a:	49 89 c7             	mov    %rax,%r15
+  80556d:	49 b8 65 ca ff ff ff 	movabs $0xffffffffffffca65,%r8
+  805574:	ff ff ff 
+  805577:	49 01 c0             	add    %rax,%r8
+  80557a:	41 ff d0             	call   *%r8
+}
+  80557d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805581:	c9                   	leave
+  805582:	c3                   	ret
+
+0000000000805583 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805583:	55                   	push   %rbp
+  805584:	48 89 e5             	mov    %rsp,%rbp
+  805587:	41 57                	push   %r15
+  805589:	48 83 ec 28          	sub    $0x28,%rsp
+  80558d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80558d <devsock_write+0xa>
+  805594:	49 bb b3 3a 00 00 00 	movabs $0x3ab3,%r11
+  80559b:	00 00 00 
+  80559e:	4c 01 d8             	add    %r11,%rax
+  8055a1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8055a5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8055a9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8055ad:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8055b1:	41 89 d0             	mov    %edx,%r8d
+  8055b4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8055b8:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8055bb:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8055bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055c4:	44 89 c2             	mov    %r8d,%edx
+  8055c7:	49 89 c7             	mov    %rax,%r15
+  8055ca:	49 b8 82 cb ff ff ff 	movabs $0xffffffffffffcb82,%r8
+  8055d1:	ff ff ff 
+  8055d4:	49 01 c0             	add    %rax,%r8
+  8055d7:	41 ff d0             	call   *%r8
+}
+  8055da:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8055de:	c9                   	leave
+  8055df:	c3                   	ret
+
+00000000008055e0 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8055e0:	55                   	push   %rbp
+  8055e1:	48 89 e5             	mov    %rsp,%rbp
+  8055e4:	41 57                	push   %r15
+  8055e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8055ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055ea <devsock_stat+0xa>
+  8055f1:	49 bb 56 3a 00 00 00 	movabs $0x3a56,%r11
+  8055f8:	00 00 00 
+  8055fb:	4c 01 d8             	add    %r11,%rax
+  8055fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805602:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805606:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80560a:	48 b9 1c e3 ff ff ff 	movabs $0xffffffffffffe31c,%rcx
+  805611:	ff ff ff 
+  805614:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805618:	48 89 ce             	mov    %rcx,%rsi
+  80561b:	48 89 d7             	mov    %rdx,%rdi
+  80561e:	49 89 c7             	mov    %rax,%r15
+  805621:	48 ba 51 82 ff ff ff 	movabs $0xffffffffffff8251,%rdx
+  805628:	ff ff ff 
+  80562b:	48 01 c2             	add    %rax,%rdx
+  80562e:	ff d2                	call   *%rdx
+	return 0;
+  805630:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805635:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805639:	c9                   	leave
+  80563a:	c3                   	ret
+
+000000000080563b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80563b:	55                   	push   %rbp
+  80563c:	48 89 e5             	mov    %rsp,%rbp
+  80563f:	41 57                	push   %r15
+  805641:	53                   	push   %rbx
+  805642:	48 83 ec 20          	sub    $0x20,%rsp
+  805646:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805646 <socket+0xb>
+  80564d:	49 bb fa 39 00 00 00 	movabs $0x39fa,%r11
+  805654:	00 00 00 
+  805657:	4c 01 db             	add    %r11,%rbx
+  80565a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80565d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805660:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805663:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805666:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805669:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80566c:	89 ce                	mov    %ecx,%esi
+  80566e:	89 c7                	mov    %eax,%edi
+  805670:	49 89 df             	mov    %rbx,%r15
+  805673:	48 b8 59 cd ff ff ff 	movabs $0xffffffffffffcd59,%rax
+  80567a:	ff ff ff 
+  80567d:	48 01 d8             	add    %rbx,%rax
+  805680:	ff d0                	call   *%rax
+  805682:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805685:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805689:	79 05                	jns    805690 <socket+0x55>
+		return r;
+  80568b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80568e:	eb 15                	jmp    8056a5 <socket+0x6a>
+	return alloc_sockfd(r);
+  805690:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805693:	89 c7                	mov    %eax,%edi
+  805695:	48 b8 43 c1 ff ff ff 	movabs $0xffffffffffffc143,%rax
+  80569c:	ff ff ff 
+  80569f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056a3:	ff d0                	call   *%rax
+}
+  8056a5:	48 83 c4 20          	add    $0x20,%rsp
+  8056a9:	5b                   	pop    %rbx
+  8056aa:	41 5f                	pop    %r15
+  8056ac:	5d                   	pop    %rbp
+  8056ad:	c3                   	ret
+
+00000000008056ae <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8056ae:	55                   	push   %rbp
+  8056af:	48 89 e5             	mov    %rsp,%rbp
+  8056b2:	41 57                	push   %r15
+  8056b4:	53                   	push   %rbx
+  8056b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8056b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056b9 <nsipc+0xb>
+  8056c0:	49 bb 87 39 00 00 00 	movabs $0x3987,%r11
+  8056c7:	00 00 00 
+  8056ca:	4c 01 db             	add    %r11,%rbx
+  8056cd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8056d0:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8056d7:	00 00 00 
+  8056da:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056dd:	85 c0                	test   %eax,%eax
+  8056df:	75 24                	jne    805705 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8056e1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8056e6:	49 89 df             	mov    %rbx,%r15
+  8056e9:	48 b8 7f a9 ff ff ff 	movabs $0xffffffffffffa97f,%rax
+  8056f0:	ff ff ff 
+  8056f3:	48 01 d8             	add    %rbx,%rax
+  8056f6:	ff d0                	call   *%rax
+  8056f8:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8056ff:	00 00 00 
+  805702:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805705:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80570c:	00 00 00 
+  80570f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805712:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805715:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80571b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805721:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805726:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80572d:	00 00 00 
+  805730:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805734:	89 c7                	mov    %eax,%edi
+  805736:	49 89 df             	mov    %rbx,%r15
+  805739:	48 b8 9e a3 ff ff ff 	movabs $0xffffffffffffa39e,%rax
+  805740:	ff ff ff 
+  805743:	48 01 d8             	add    %rbx,%rax
+  805746:	ff d0                	call   *%rax
+}
+  805748:	48 83 c4 10          	add    $0x10,%rsp
+  80574c:	5b                   	pop    %rbx
+  80574d:	41 5f                	pop    %r15
+  80574f:	5d                   	pop    %rbp
+  805750:	c3                   	ret
+
+0000000000805751 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805751:	55                   	push   %rbp
+  805752:	48 89 e5             	mov    %rsp,%rbp
+  805755:	41 57                	push   %r15
+  805757:	53                   	push   %rbx
+  805758:	48 83 ec 20          	sub    $0x20,%rsp
+  80575c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80575c <nsipc_words+0xb>
+  805763:	49 bb e4 38 00 00 00 	movabs $0x38e4,%r11
+  80576a:	00 00 00 
+  80576d:	4c 01 db             	add    %r11,%rbx
+  805770:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805773:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805777:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80577b:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805782:	00 00 00 
+  805785:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805788:	85 c0                	test   %eax,%eax
+  80578a:	75 24                	jne    8057b0 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80578c:	bf 02 00 00 00       	mov    $0x2,%edi
+  805791:	49 89 df             	mov    %rbx,%r15
+  805794:	48 b8 7f a9 ff ff ff 	movabs $0xffffffffffffa97f,%rax
+  80579b:	ff ff ff 
+  80579e:	48 01 d8             	add    %rbx,%rax
+  8057a1:	ff d0                	call   *%rax
+  8057a3:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8057aa:	00 00 00 
+  8057ad:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8057b0:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8057b7:	00 00 00 
+  8057ba:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8057bd:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8057c1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8057c5:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8057c8:	89 c7                	mov    %eax,%edi
+  8057ca:	49 89 df             	mov    %rbx,%r15
+  8057cd:	48 b8 89 a4 ff ff ff 	movabs $0xffffffffffffa489,%rax
+  8057d4:	ff ff ff 
+  8057d7:	48 01 d8             	add    %rbx,%rax
+  8057da:	ff d0                	call   *%rax
+}
+  8057dc:	48 83 c4 20          	add    $0x20,%rsp
+  8057e0:	5b                   	pop    %rbx
+  8057e1:	41 5f                	pop    %r15
+  8057e3:	5d                   	pop    %rbp
+  8057e4:	c3                   	ret
+
+00000000008057e5 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8057e5:	55                   	push   %rbp
+  8057e6:	48 89 e5             	mov    %rsp,%rbp
+  8057e9:	41 57                	push   %r15
+  8057eb:	53                   	push   %rbx
+  8057ec:	48 83 ec 30          	sub    $0x30,%rsp
+  8057f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057f0 <nsipc_accept+0xb>
+  8057f7:	49 bb 50 38 00 00 00 	movabs $0x3850,%r11
+  8057fe:	00 00 00 
+  805801:	4c 01 db             	add    %r11,%rbx
+  805804:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805807:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80580b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80580f:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805816:	00 00 00 
+  805819:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80581c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80581f:	bf 01 00 00 00       	mov    $0x1,%edi
+  805824:	48 b8 6e c6 ff ff ff 	movabs $0xffffffffffffc66e,%rax
+  80582b:	ff ff ff 
+  80582e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805832:	ff d0                	call   *%rax
+  805834:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805837:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80583b:	78 48                	js     805885 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80583d:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805844:	00 00 00 
+  805847:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80584b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80584f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805853:	8b 40 10             	mov    0x10(%rax),%eax
+  805856:	89 c2                	mov    %eax,%edx
+  805858:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80585c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805860:	48 89 ce             	mov    %rcx,%rsi
+  805863:	48 89 c7             	mov    %rax,%rdi
+  805866:	49 89 df             	mov    %rbx,%r15
+  805869:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  805870:	ff ff ff 
+  805873:	48 01 d8             	add    %rbx,%rax
+  805876:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805878:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80587c:	8b 50 10             	mov    0x10(%rax),%edx
+  80587f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805883:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805885:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805888:	48 83 c4 30          	add    $0x30,%rsp
+  80588c:	5b                   	pop    %rbx
+  80588d:	41 5f                	pop    %r15
+  80588f:	5d                   	pop    %rbp
+  805890:	c3                   	ret
+
+0000000000805891 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805891:	55                   	push   %rbp
+  805892:	48 89 e5             	mov    %rsp,%rbp
+  805895:	41 57                	push   %r15
+  805897:	53                   	push   %rbx
+  805898:	48 83 ec 10          	sub    $0x10,%rsp
+  80589c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80589c <nsipc_bind+0xb>
+  8058a3:	49 bb a4 37 00 00 00 	movabs $0x37a4,%r11
+  8058aa:	00 00 00 
+  8058ad:	4c 01 db             	add    %r11,%rbx
+  8058b0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8058b3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8058b7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8058ba:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8058c1:	00 00 00 
+  8058c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058c7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8058ca:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8058cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058d1:	48 89 c6             	mov    %rax,%rsi
+  8058d4:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  8058db:	00 00 00 
+  8058de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058e2:	48 89 c7             	mov    %rax,%rdi
+  8058e5:	49 89 df             	mov    %rbx,%r15
+  8058e8:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  8058ef:	ff ff ff 
+  8058f2:	48 01 d8             	add    %rbx,%rax
+  8058f5:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8058f7:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8058fe:	00 00 00 
+  805901:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805904:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805908:	bf 02 00 00 00       	mov    $0x2,%edi
+  80590d:	48 b8 6e c6 ff ff ff 	movabs $0xffffffffffffc66e,%rax
+  805914:	ff ff ff 
+  805917:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80591b:	ff d0                	call   *%rax
+}
+  80591d:	48 83 c4 10          	add    $0x10,%rsp
+  805921:	5b                   	pop    %rbx
+  805922:	41 5f                	pop    %r15
+  805924:	5d                   	pop    %rbp
+  805925:	c3                   	ret
+
+0000000000805926 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805926:	55                   	push   %rbp
+  805927:	48 89 e5             	mov    %rsp,%rbp
+  80592a:	48 83 ec 20          	sub    $0x20,%rsp
+  80592e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80592e <nsipc_shutdown+0x8>
+  805935:	49 bb 12 37 00 00 00 	movabs $0x3712,%r11
+  80593c:	00 00 00 
+  80593f:	4c 01 d8             	add    %r11,%rax
+  805942:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805945:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805948:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80594b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  80594e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805951:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805954:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805958:	ba 08 00 00 00       	mov    $0x8,%edx
+  80595d:	48 89 ce             	mov    %rcx,%rsi
+  805960:	bf 03 00 00 00       	mov    $0x3,%edi
+  805965:	48 b9 11 c7 ff ff ff 	movabs $0xffffffffffffc711,%rcx
+  80596c:	ff ff ff 
+  80596f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805973:	ff d0                	call   *%rax
+}
+  805975:	c9                   	leave
+  805976:	c3                   	ret
+
+0000000000805977 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805977:	55                   	push   %rbp
+  805978:	48 89 e5             	mov    %rsp,%rbp
+  80597b:	48 83 ec 20          	sub    $0x20,%rsp
+  80597f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80597f <nsipc_close+0x8>
+  805986:	49 bb c1 36 00 00 00 	movabs $0x36c1,%r11
+  80598d:	00 00 00 
+  805990:	4c 01 d8             	add    %r11,%rax
+  805993:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805996:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805999:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80599c:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8059a0:	ba 04 00 00 00       	mov    $0x4,%edx
+  8059a5:	48 89 ce             	mov    %rcx,%rsi
+  8059a8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8059ad:	48 b9 11 c7 ff ff ff 	movabs $0xffffffffffffc711,%rcx
+  8059b4:	ff ff ff 
+  8059b7:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8059bb:	ff d0                	call   *%rax
+}
+  8059bd:	c9                   	leave
+  8059be:	c3                   	ret
+
+00000000008059bf <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8059bf:	55                   	push   %rbp
+  8059c0:	48 89 e5             	mov    %rsp,%rbp
+  8059c3:	41 57                	push   %r15
+  8059c5:	53                   	push   %rbx
+  8059c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8059ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059ca <nsipc_connect+0xb>
+  8059d1:	49 bb 76 36 00 00 00 	movabs $0x3676,%r11
+  8059d8:	00 00 00 
+  8059db:	4c 01 db             	add    %r11,%rbx
+  8059de:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8059e1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8059e5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8059e8:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8059ef:	00 00 00 
+  8059f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059f5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8059f8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8059fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059ff:	48 89 c6             	mov    %rax,%rsi
+  805a02:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805a09:	00 00 00 
+  805a0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a10:	48 89 c7             	mov    %rax,%rdi
+  805a13:	49 89 df             	mov    %rbx,%r15
+  805a16:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  805a1d:	ff ff ff 
+  805a20:	48 01 d8             	add    %rbx,%rax
+  805a23:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805a25:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805a2c:	00 00 00 
+  805a2f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a32:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805a36:	bf 05 00 00 00       	mov    $0x5,%edi
+  805a3b:	48 b8 6e c6 ff ff ff 	movabs $0xffffffffffffc66e,%rax
+  805a42:	ff ff ff 
+  805a45:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a49:	ff d0                	call   *%rax
+}
+  805a4b:	48 83 c4 10          	add    $0x10,%rsp
+  805a4f:	5b                   	pop    %rbx
+  805a50:	41 5f                	pop    %r15
+  805a52:	5d                   	pop    %rbp
+  805a53:	c3                   	ret
+
+0000000000805a54 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805a54:	55                   	push   %rbp
+  805a55:	48 89 e5             	mov    %rsp,%rbp
+  805a58:	48 83 ec 20          	sub    $0x20,%rsp
+  805a5c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a5c <nsipc_listen+0x8>
+  805a63:	49 bb e4 35 00 00 00 	movabs $0x35e4,%r11
+  805a6a:	00 00 00 
+  805a6d:	4c 01 d8             	add    %r11,%rax
+  805a70:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a73:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805a76:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805a79:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805a7c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a7f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805a82:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805a86:	ba 08 00 00 00       	mov    $0x8,%edx
+  805a8b:	48 89 ce             	mov    %rcx,%rsi
+  805a8e:	bf 06 00 00 00       	mov    $0x6,%edi
+  805a93:	48 b9 11 c7 ff ff ff 	movabs $0xffffffffffffc711,%rcx
+  805a9a:	ff ff ff 
+  805a9d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805aa1:	ff d0                	call   *%rax
+}
+  805aa3:	c9                   	leave
+  805aa4:	c3                   	ret
+
+0000000000805aa5 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805aa5:	55                   	push   %rbp
+  805aa6:	48 89 e5             	mov    %rsp,%rbp
+  805aa9:	41 57                	push   %r15
+  805aab:	53                   	push   %rbx
+  805aac:	48 83 ec 30          	sub    $0x30,%rsp
+  805ab0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ab0 <nsipc_recv+0xb>
+  805ab7:	49 bb 90 35 00 00 00 	movabs $0x3590,%r11
+  805abe:	00 00 00 
+  805ac1:	4c 01 db             	add    %r11,%rbx
+  805ac4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805ac7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805acb:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805ace:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805ad1:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805ad8:	00 00 00 
+  805adb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ade:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805ae1:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805ae8:	00 00 00 
+  805aeb:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805aee:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805af2:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805af9:	00 00 00 
+  805afc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805aff:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805b03:	bf 07 00 00 00       	mov    $0x7,%edi
+  805b08:	48 b8 6e c6 ff ff ff 	movabs $0xffffffffffffc66e,%rax
+  805b0f:	ff ff ff 
+  805b12:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b16:	ff d0                	call   *%rax
+  805b18:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b1b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b1f:	0f 88 91 00 00 00    	js     805bb6 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805b25:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805b2c:	7f 08                	jg     805b36 <nsipc_recv+0x91>
+  805b2e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b31:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805b34:	7e 50                	jle    805b86 <nsipc_recv+0xe1>
+  805b36:	48 b8 23 e3 ff ff ff 	movabs $0xffffffffffffe323,%rax
+  805b3d:	ff ff ff 
+  805b40:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b44:	48 89 c1             	mov    %rax,%rcx
+  805b47:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  805b4e:	ff ff ff 
+  805b51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b55:	48 89 c2             	mov    %rax,%rdx
+  805b58:	be 79 00 00 00       	mov    $0x79,%esi
+  805b5d:	48 b8 4d e3 ff ff ff 	movabs $0xffffffffffffe34d,%rax
+  805b64:	ff ff ff 
+  805b67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b6b:	48 89 c7             	mov    %rax,%rdi
+  805b6e:	49 89 df             	mov    %rbx,%r15
+  805b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b76:	49 b8 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%r8
+  805b7d:	ff ff ff 
+  805b80:	49 01 d8             	add    %rbx,%r8
+  805b83:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805b86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b89:	48 63 d0             	movslq %eax,%rdx
+  805b8c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b90:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805b97:	00 00 00 
+  805b9a:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805b9e:	48 89 ce             	mov    %rcx,%rsi
+  805ba1:	48 89 c7             	mov    %rax,%rdi
+  805ba4:	49 89 df             	mov    %rbx,%r15
+  805ba7:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  805bae:	ff ff ff 
+  805bb1:	48 01 d8             	add    %rbx,%rax
+  805bb4:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805bb6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805bb9:	48 83 c4 30          	add    $0x30,%rsp
+  805bbd:	5b                   	pop    %rbx
+  805bbe:	41 5f                	pop    %r15
+  805bc0:	5d                   	pop    %rbp
+  805bc1:	c3                   	ret
+
+0000000000805bc2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805bc2:	55                   	push   %rbp
+  805bc3:	48 89 e5             	mov    %rsp,%rbp
+  805bc6:	41 57                	push   %r15
+  805bc8:	53                   	push   %rbx
+  805bc9:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805bd0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bd0 <nsipc_send+0xe>
+  805bd7:	49 bb 70 34 00 00 00 	movabs $0x3470,%r11
+  805bde:	00 00 00 
+  805be1:	4c 01 db             	add    %r11,%rbx
+  805be4:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805bea:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805bf1:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805bf7:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805bfd:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805c01:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805c05:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805c0c:	00 00 00 
+  805c0f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805c12:	85 c0                	test   %eax,%eax
+  805c14:	75 24                	jne    805c3a <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805c16:	bf 02 00 00 00       	mov    $0x2,%edi
+  805c1b:	49 89 df             	mov    %rbx,%r15
+  805c1e:	48 b8 7f a9 ff ff ff 	movabs $0xffffffffffffa97f,%rax
+  805c25:	ff ff ff 
+  805c28:	48 01 d8             	add    %rbx,%rax
+  805c2b:	ff d0                	call   *%rax
+  805c2d:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805c34:	00 00 00 
+  805c37:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805c3a:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805c40:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805c43:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805c4a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805c4d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c50:	39 c2                	cmp    %eax,%edx
+  805c52:	0f 4e c2             	cmovle %edx,%eax
+  805c55:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805c5b:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805c61:	48 63 d0             	movslq %eax,%rdx
+  805c64:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805c6b:	48 89 c6             	mov    %rax,%rsi
+  805c6e:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805c75:	00 00 00 
+  805c78:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c7c:	48 89 c7             	mov    %rax,%rdi
+  805c7f:	49 89 df             	mov    %rbx,%r15
+  805c82:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  805c89:	ff ff ff 
+  805c8c:	48 01 d8             	add    %rbx,%rax
+  805c8f:	ff d0                	call   *%rax
+	req->req_s = s;
+  805c91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c95:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805c9b:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805c9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ca1:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805ca7:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805caa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cae:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805cb4:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805cb7:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805cbe:	00 00 00 
+  805cc1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cc5:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805cc9:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805cd0:	00 
+  805cd1:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805cd7:	48 63 d0             	movslq %eax,%rdx
+  805cda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cde:	48 01 d0             	add    %rdx,%rax
+  805ce1:	48 83 e8 01          	sub    $0x1,%rax
+  805ce5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805ce9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ced:	ba 00 00 00 00       	mov    $0x0,%edx
+  805cf2:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805cf6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cfa:	48 29 d0             	sub    %rdx,%rax
+  805cfd:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805d03:	85 c0                	test   %eax,%eax
+  805d05:	0f 48 c2             	cmovs  %edx,%eax
+  805d08:	c1 f8 0c             	sar    $0xc,%eax
+  805d0b:	48 98                	cltq
+  805d0d:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805d11:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805d15:	48 85 c0             	test   %rax,%rax
+  805d18:	0f 95 c0             	setne  %al
+  805d1b:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805d1e:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  805d25:	00 
+  805d26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d2a:	48 83 c0 0b          	add    $0xb,%rax
+  805d2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805d32:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d36:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d3b:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805d3f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d43:	48 29 d0             	sub    %rdx,%rax
+  805d46:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805d4a:	89 c7                	mov    %eax,%edi
+  805d4c:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805d53:	00 00 00 
+  805d56:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805d59:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805d5d:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805d61:	48 83 ec 08          	sub    $0x8,%rsp
+  805d65:	6a 00                	push   $0x0
+  805d67:	6a 00                	push   $0x0
+  805d69:	6a 05                	push   $0x5
+  805d6b:	41 89 f1             	mov    %esi,%r9d
+  805d6e:	49 89 c8             	mov    %rcx,%r8
+  805d71:	89 f9                	mov    %edi,%ecx
+  805d73:	be 08 00 00 00       	mov    $0x8,%esi
+  805d78:	89 c7                	mov    %eax,%edi
+  805d7a:	49 89 df             	mov    %rbx,%r15
+  805d7d:	48 b8 87 a5 ff ff ff 	movabs $0xffffffffffffa587,%rax
+  805d84:	ff ff ff 
+  805d87:	48 01 d8             	add    %rbx,%rax
+  805d8a:	ff d0                	call   *%rax
+  805d8c:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805d90:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805d94:	5b                   	pop    %rbx
+  805d95:	41 5f                	pop    %r15
+  805d97:	5d                   	pop    %rbp
+  805d98:	c3                   	ret
+
+0000000000805d99 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805d99:	55                   	push   %rbp
+  805d9a:	48 89 e5             	mov    %rsp,%rbp
+  805d9d:	48 83 ec 10          	sub    $0x10,%rsp
+  805da1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805da1 <nsipc_socket+0x8>
+  805da8:	49 bb 9f 32 00 00 00 	movabs $0x329f,%r11
+  805daf:	00 00 00 
+  805db2:	4c 01 d8             	add    %r11,%rax
+  805db5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805db8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805dbb:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805dbe:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805dc5:	00 00 00 
+  805dc8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805dcb:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805dce:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805dd5:	00 00 00 
+  805dd8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805ddb:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805ddf:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805de6:	00 00 00 
+  805de9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805dec:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805df0:	bf 09 00 00 00       	mov    $0x9,%edi
+  805df5:	48 ba 6e c6 ff ff ff 	movabs $0xffffffffffffc66e,%rdx
+  805dfc:	ff ff ff 
+  805dff:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805e03:	ff d0                	call   *%rax
+}
+  805e05:	c9                   	leave
+  805e06:	c3                   	ret
+
+0000000000805e07 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805e07:	55                   	push   %rbp
+  805e08:	48 89 e5             	mov    %rsp,%rbp
+  805e0b:	41 57                	push   %r15
+  805e0d:	53                   	push   %rbx
+  805e0e:	48 83 ec 30          	sub    $0x30,%rsp
+  805e12:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e12 <pipe+0xb>
+  805e19:	49 bb 2e 32 00 00 00 	movabs $0x322e,%r11
+  805e20:	00 00 00 
+  805e23:	4c 01 db             	add    %r11,%rbx
+  805e26:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805e2a:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805e2e:	48 89 c7             	mov    %rax,%rdi
+  805e31:	49 89 df             	mov    %rbx,%r15
+  805e34:	48 b8 88 aa ff ff ff 	movabs $0xffffffffffffaa88,%rax
+  805e3b:	ff ff ff 
+  805e3e:	48 01 d8             	add    %rbx,%rax
+  805e41:	ff d0                	call   *%rax
+  805e43:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e46:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e4a:	0f 88 12 02 00 00    	js     806062 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805e50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e54:	ba 07 04 00 00       	mov    $0x407,%edx
+  805e59:	48 89 c6             	mov    %rax,%rsi
+  805e5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e61:	49 89 df             	mov    %rbx,%r15
+  805e64:	48 b8 0d 8f ff ff ff 	movabs $0xffffffffffff8f0d,%rax
+  805e6b:	ff ff ff 
+  805e6e:	48 01 d8             	add    %rbx,%rax
+  805e71:	ff d0                	call   *%rax
+  805e73:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e76:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e7a:	0f 88 e2 01 00 00    	js     806062 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805e80:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805e84:	48 89 c7             	mov    %rax,%rdi
+  805e87:	49 89 df             	mov    %rbx,%r15
+  805e8a:	48 b8 88 aa ff ff ff 	movabs $0xffffffffffffaa88,%rax
+  805e91:	ff ff ff 
+  805e94:	48 01 d8             	add    %rbx,%rax
+  805e97:	ff d0                	call   *%rax
+  805e99:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e9c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ea0:	0f 88 9b 01 00 00    	js     806041 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805ea6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805eaa:	ba 07 04 00 00       	mov    $0x407,%edx
+  805eaf:	48 89 c6             	mov    %rax,%rsi
+  805eb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  805eb7:	49 89 df             	mov    %rbx,%r15
+  805eba:	48 b8 0d 8f ff ff ff 	movabs $0xffffffffffff8f0d,%rax
+  805ec1:	ff ff ff 
+  805ec4:	48 01 d8             	add    %rbx,%rax
+  805ec7:	ff d0                	call   *%rax
+  805ec9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ecc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ed0:	0f 88 6b 01 00 00    	js     806041 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805ed6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805eda:	48 89 c7             	mov    %rax,%rdi
+  805edd:	49 89 df             	mov    %rbx,%r15
+  805ee0:	48 b8 45 aa ff ff ff 	movabs $0xffffffffffffaa45,%rax
+  805ee7:	ff ff ff 
+  805eea:	48 01 d8             	add    %rbx,%rax
+  805eed:	ff d0                	call   *%rax
+  805eef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805ef3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ef7:	ba 07 04 00 00       	mov    $0x407,%edx
+  805efc:	48 89 c6             	mov    %rax,%rsi
+  805eff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f04:	49 89 df             	mov    %rbx,%r15
+  805f07:	48 b8 0d 8f ff ff ff 	movabs $0xffffffffffff8f0d,%rax
+  805f0e:	ff ff ff 
+  805f11:	48 01 d8             	add    %rbx,%rax
+  805f14:	ff d0                	call   *%rax
+  805f16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f19:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f1d:	0f 88 fd 00 00 00    	js     806020 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805f23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f27:	48 89 c7             	mov    %rax,%rdi
+  805f2a:	49 89 df             	mov    %rbx,%r15
+  805f2d:	48 b8 45 aa ff ff ff 	movabs $0xffffffffffffaa45,%rax
+  805f34:	ff ff ff 
+  805f37:	48 01 d8             	add    %rbx,%rax
+  805f3a:	ff d0                	call   *%rax
+  805f3c:	48 89 c2             	mov    %rax,%rdx
+  805f3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f43:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805f49:	48 89 d1             	mov    %rdx,%rcx
+  805f4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f51:	48 89 c6             	mov    %rax,%rsi
+  805f54:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f59:	49 89 df             	mov    %rbx,%r15
+  805f5c:	48 b8 72 8f ff ff ff 	movabs $0xffffffffffff8f72,%rax
+  805f63:	ff ff ff 
+  805f66:	48 01 d8             	add    %rbx,%rax
+  805f69:	ff d0                	call   *%rax
+  805f6b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f6e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f72:	0f 88 87 00 00 00    	js     805fff <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805f78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f7c:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805f83:	00 00 00 
+  805f86:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805f89:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805f8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f8f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805f96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f9a:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805fa1:	00 00 00 
+  805fa4:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805fa7:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805fa9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fad:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805fb4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fb8:	48 89 c7             	mov    %rax,%rdi
+  805fbb:	49 89 df             	mov    %rbx,%r15
+  805fbe:	48 b8 0e aa ff ff ff 	movabs $0xffffffffffffaa0e,%rax
+  805fc5:	ff ff ff 
+  805fc8:	48 01 d8             	add    %rbx,%rax
+  805fcb:	ff d0                	call   *%rax
+  805fcd:	89 c2                	mov    %eax,%edx
+  805fcf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805fd3:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805fd5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fd9:	48 89 c7             	mov    %rax,%rdi
+  805fdc:	49 89 df             	mov    %rbx,%r15
+  805fdf:	48 b8 0e aa ff ff ff 	movabs $0xffffffffffffaa0e,%rax
+  805fe6:	ff ff ff 
+  805fe9:	48 01 d8             	add    %rbx,%rax
+  805fec:	ff d0                	call   *%rax
+  805fee:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805ff2:	48 83 c2 04          	add    $0x4,%rdx
+  805ff6:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ffd:	eb 67                	jmp    806066 <pipe+0x25f>
+		goto err3;
+  805fff:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806000:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806004:	48 89 c6             	mov    %rax,%rsi
+  806007:	bf 00 00 00 00       	mov    $0x0,%edi
+  80600c:	49 89 df             	mov    %rbx,%r15
+  80600f:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  806016:	ff ff ff 
+  806019:	48 01 d8             	add    %rbx,%rax
+  80601c:	ff d0                	call   *%rax
+  80601e:	eb 01                	jmp    806021 <pipe+0x21a>
+		goto err2;
+  806020:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  806021:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806025:	48 89 c6             	mov    %rax,%rsi
+  806028:	bf 00 00 00 00       	mov    $0x0,%edi
+  80602d:	49 89 df             	mov    %rbx,%r15
+  806030:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  806037:	ff ff ff 
+  80603a:	48 01 d8             	add    %rbx,%rax
+  80603d:	ff d0                	call   *%rax
+  80603f:	eb 01                	jmp    806042 <pipe+0x23b>
+		goto err1;
+  806041:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806042:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806046:	48 89 c6             	mov    %rax,%rsi
+  806049:	bf 00 00 00 00       	mov    $0x0,%edi
+  80604e:	49 89 df             	mov    %rbx,%r15
+  806051:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  806058:	ff ff ff 
+  80605b:	48 01 d8             	add    %rbx,%rax
+  80605e:	ff d0                	call   *%rax
+  806060:	eb 01                	jmp    806063 <pipe+0x25c>
+		goto err;
+  806062:	90                   	nop
+err:
+	return r;
+  806063:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806066:	48 83 c4 30          	add    $0x30,%rsp
+  80606a:	5b                   	pop    %rbx
+  80606b:	41 5f                	pop    %r15
+  80606d:	5d                   	pop    %rbp
+  80606e:	c3                   	ret
+
+000000000080606f <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80606f:	55                   	push   %rbp
+  806070:	48 89 e5             	mov    %rsp,%rbp
+  806073:	41 57                	push   %r15
+  806075:	41 54                	push   %r12
+  806077:	53                   	push   %rbx
+  806078:	48 83 ec 28          	sub    $0x28,%rsp
+  80607c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80607c <_pipeisclosed+0xd>
+  806083:	49 bb c4 2f 00 00 00 	movabs $0x2fc4,%r11
+  80608a:	00 00 00 
+  80608d:	4c 01 db             	add    %r11,%rbx
+  806090:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806094:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  806098:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80609f:	ff ff ff 
+  8060a2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8060a6:	48 8b 00             	mov    (%rax),%rax
+  8060a9:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8060af:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8060b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8060b6:	48 89 c7             	mov    %rax,%rdi
+  8060b9:	49 89 df             	mov    %rbx,%r15
+  8060bc:	48 b8 f2 db ff ff ff 	movabs $0xffffffffffffdbf2,%rax
+  8060c3:	ff ff ff 
+  8060c6:	48 01 d8             	add    %rbx,%rax
+  8060c9:	ff d0                	call   *%rax
+  8060cb:	41 89 c4             	mov    %eax,%r12d
+  8060ce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8060d2:	48 89 c7             	mov    %rax,%rdi
+  8060d5:	49 89 df             	mov    %rbx,%r15
+  8060d8:	48 b8 f2 db ff ff ff 	movabs $0xffffffffffffdbf2,%rax
+  8060df:	ff ff ff 
+  8060e2:	48 01 d8             	add    %rbx,%rax
+  8060e5:	ff d0                	call   *%rax
+  8060e7:	41 39 c4             	cmp    %eax,%r12d
+  8060ea:	0f 94 c0             	sete   %al
+  8060ed:	0f b6 c0             	movzbl %al,%eax
+  8060f0:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  8060f3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8060fa:	ff ff ff 
+  8060fd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806101:	48 8b 00             	mov    (%rax),%rax
+  806104:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80610a:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80610d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806110:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806113:	75 05                	jne    80611a <_pipeisclosed+0xab>
+			return ret;
+  806115:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806118:	eb 63                	jmp    80617d <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  80611a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80611d:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806120:	0f 84 72 ff ff ff    	je     806098 <_pipeisclosed+0x29>
+  806126:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  80612a:	0f 85 68 ff ff ff    	jne    806098 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  806130:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806137:	ff ff ff 
+  80613a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80613e:	48 8b 00             	mov    (%rax),%rax
+  806141:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806147:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80614a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80614d:	89 c6                	mov    %eax,%esi
+  80614f:	48 b8 5e e3 ff ff ff 	movabs $0xffffffffffffe35e,%rax
+  806156:	ff ff ff 
+  806159:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80615d:	48 89 c7             	mov    %rax,%rdi
+  806160:	49 89 df             	mov    %rbx,%r15
+  806163:	b8 00 00 00 00       	mov    $0x0,%eax
+  806168:	49 b8 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%r8
+  80616f:	ff ff ff 
+  806172:	49 01 d8             	add    %rbx,%r8
+  806175:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  806178:	e9 1b ff ff ff       	jmp    806098 <_pipeisclosed+0x29>
+	}
+}
+  80617d:	48 83 c4 28          	add    $0x28,%rsp
+  806181:	5b                   	pop    %rbx
+  806182:	41 5c                	pop    %r12
+  806184:	41 5f                	pop    %r15
+  806186:	5d                   	pop    %rbp
+  806187:	c3                   	ret
+
+0000000000806188 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  806188:	55                   	push   %rbp
+  806189:	48 89 e5             	mov    %rsp,%rbp
+  80618c:	41 57                	push   %r15
+  80618e:	53                   	push   %rbx
+  80618f:	48 83 ec 30          	sub    $0x30,%rsp
+  806193:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806193 <pipeisclosed+0xb>
+  80619a:	49 bb ad 2e 00 00 00 	movabs $0x2ead,%r11
+  8061a1:	00 00 00 
+  8061a4:	4c 01 db             	add    %r11,%rbx
+  8061a7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8061aa:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8061ae:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8061b1:	48 89 d6             	mov    %rdx,%rsi
+  8061b4:	89 c7                	mov    %eax,%edi
+  8061b6:	49 89 df             	mov    %rbx,%r15
+  8061b9:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  8061c0:	ff ff ff 
+  8061c3:	48 01 d8             	add    %rbx,%rax
+  8061c6:	ff d0                	call   *%rax
+  8061c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061cf:	79 05                	jns    8061d6 <pipeisclosed+0x4e>
+		return r;
+  8061d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061d4:	eb 3b                	jmp    806211 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8061d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8061da:	48 89 c7             	mov    %rax,%rdi
+  8061dd:	49 89 df             	mov    %rbx,%r15
+  8061e0:	48 b8 45 aa ff ff ff 	movabs $0xffffffffffffaa45,%rax
+  8061e7:	ff ff ff 
+  8061ea:	48 01 d8             	add    %rbx,%rax
+  8061ed:	ff d0                	call   *%rax
+  8061ef:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  8061f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8061f7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8061fb:	48 89 d6             	mov    %rdx,%rsi
+  8061fe:	48 89 c7             	mov    %rax,%rdi
+  806201:	48 b8 2f d0 ff ff ff 	movabs $0xffffffffffffd02f,%rax
+  806208:	ff ff ff 
+  80620b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80620f:	ff d0                	call   *%rax
+}
+  806211:	48 83 c4 30          	add    $0x30,%rsp
+  806215:	5b                   	pop    %rbx
+  806216:	41 5f                	pop    %r15
+  806218:	5d                   	pop    %rbp
+  806219:	c3                   	ret
+
+000000000080621a <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80621a:	55                   	push   %rbp
+  80621b:	48 89 e5             	mov    %rsp,%rbp
+  80621e:	41 57                	push   %r15
+  806220:	53                   	push   %rbx
+  806221:	48 83 ec 40          	sub    $0x40,%rsp
+  806225:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806225 <devpipe_read+0xb>
+  80622c:	49 bb 1b 2e 00 00 00 	movabs $0x2e1b,%r11
+  806233:	00 00 00 
+  806236:	4c 01 db             	add    %r11,%rbx
+  806239:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80623d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806241:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806245:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806249:	48 89 c7             	mov    %rax,%rdi
+  80624c:	49 89 df             	mov    %rbx,%r15
+  80624f:	48 b8 45 aa ff ff ff 	movabs $0xffffffffffffaa45,%rax
+  806256:	ff ff ff 
+  806259:	48 01 d8             	add    %rbx,%rax
+  80625c:	ff d0                	call   *%rax
+  80625e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806262:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806266:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80626a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806271:	00 
+  806272:	e9 a1 00 00 00       	jmp    806318 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  806277:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80627c:	74 09                	je     806287 <devpipe_read+0x6d>
+				return i;
+  80627e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806282:	e9 9f 00 00 00       	jmp    806326 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  806287:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80628b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80628f:	48 89 d6             	mov    %rdx,%rsi
+  806292:	48 89 c7             	mov    %rax,%rdi
+  806295:	48 b8 2f d0 ff ff ff 	movabs $0xffffffffffffd02f,%rax
+  80629c:	ff ff ff 
+  80629f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8062a3:	ff d0                	call   *%rax
+  8062a5:	85 c0                	test   %eax,%eax
+  8062a7:	74 07                	je     8062b0 <devpipe_read+0x96>
+				return 0;
+  8062a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062ae:	eb 76                	jmp    806326 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8062b0:	49 89 df             	mov    %rbx,%r15
+  8062b3:	48 b8 b8 8e ff ff ff 	movabs $0xffffffffffff8eb8,%rax
+  8062ba:	ff ff ff 
+  8062bd:	48 01 d8             	add    %rbx,%rax
+  8062c0:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8062c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062c6:	8b 10                	mov    (%rax),%edx
+  8062c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062cc:	8b 40 04             	mov    0x4(%rax),%eax
+  8062cf:	39 c2                	cmp    %eax,%edx
+  8062d1:	74 a4                	je     806277 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8062d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062d7:	8b 10                	mov    (%rax),%edx
+  8062d9:	89 d0                	mov    %edx,%eax
+  8062db:	c1 f8 1f             	sar    $0x1f,%eax
+  8062de:	c1 e8 1b             	shr    $0x1b,%eax
+  8062e1:	01 c2                	add    %eax,%edx
+  8062e3:	83 e2 1f             	and    $0x1f,%edx
+  8062e6:	29 c2                	sub    %eax,%edx
+  8062e8:	89 d6                	mov    %edx,%esi
+  8062ea:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8062ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062f2:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8062f6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8062fa:	48 63 c6             	movslq %esi,%rax
+  8062fd:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806302:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806304:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806308:	8b 00                	mov    (%rax),%eax
+  80630a:	8d 50 01             	lea    0x1(%rax),%edx
+  80630d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806311:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806313:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806318:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80631c:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806320:	72 a0                	jb     8062c2 <devpipe_read+0xa8>
+	}
+	return i;
+  806322:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806326:	48 83 c4 40          	add    $0x40,%rsp
+  80632a:	5b                   	pop    %rbx
+  80632b:	41 5f                	pop    %r15
+  80632d:	5d                   	pop    %rbp
+  80632e:	c3                   	ret
+
+000000000080632f <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80632f:	55                   	push   %rbp
+  806330:	48 89 e5             	mov    %rsp,%rbp
+  806333:	41 57                	push   %r15
+  806335:	53                   	push   %rbx
+  806336:	48 83 ec 40          	sub    $0x40,%rsp
+  80633a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80633a <devpipe_write+0xb>
+  806341:	49 bb 06 2d 00 00 00 	movabs $0x2d06,%r11
+  806348:	00 00 00 
+  80634b:	4c 01 db             	add    %r11,%rbx
+  80634e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806352:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806356:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80635a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80635e:	48 89 c7             	mov    %rax,%rdi
+  806361:	49 89 df             	mov    %rbx,%r15
+  806364:	48 b8 45 aa ff ff ff 	movabs $0xffffffffffffaa45,%rax
+  80636b:	ff ff ff 
+  80636e:	48 01 d8             	add    %rbx,%rax
+  806371:	ff d0                	call   *%rax
+  806373:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806377:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80637b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80637f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806386:	00 
+  806387:	e9 a0 00 00 00       	jmp    80642c <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80638c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806390:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806394:	48 89 d6             	mov    %rdx,%rsi
+  806397:	48 89 c7             	mov    %rax,%rdi
+  80639a:	48 b8 2f d0 ff ff ff 	movabs $0xffffffffffffd02f,%rax
+  8063a1:	ff ff ff 
+  8063a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063a8:	ff d0                	call   *%rax
+  8063aa:	85 c0                	test   %eax,%eax
+  8063ac:	74 0a                	je     8063b8 <devpipe_write+0x89>
+				return 0;
+  8063ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063b3:	e9 82 00 00 00       	jmp    80643a <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8063b8:	49 89 df             	mov    %rbx,%r15
+  8063bb:	48 b8 b8 8e ff ff ff 	movabs $0xffffffffffff8eb8,%rax
+  8063c2:	ff ff ff 
+  8063c5:	48 01 d8             	add    %rbx,%rax
+  8063c8:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8063ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063ce:	8b 40 04             	mov    0x4(%rax),%eax
+  8063d1:	48 63 d0             	movslq %eax,%rdx
+  8063d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063d8:	8b 00                	mov    (%rax),%eax
+  8063da:	48 98                	cltq
+  8063dc:	48 83 c0 20          	add    $0x20,%rax
+  8063e0:	48 39 c2             	cmp    %rax,%rdx
+  8063e3:	73 a7                	jae    80638c <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8063e5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8063e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063ed:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8063f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063f5:	8b 50 04             	mov    0x4(%rax),%edx
+  8063f8:	89 d0                	mov    %edx,%eax
+  8063fa:	c1 f8 1f             	sar    $0x1f,%eax
+  8063fd:	c1 e8 1b             	shr    $0x1b,%eax
+  806400:	01 c2                	add    %eax,%edx
+  806402:	83 e2 1f             	and    $0x1f,%edx
+  806405:	29 c2                	sub    %eax,%edx
+  806407:	89 d0                	mov    %edx,%eax
+  806409:	0f b6 09             	movzbl (%rcx),%ecx
+  80640c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806410:	48 98                	cltq
+  806412:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806416:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80641a:	8b 40 04             	mov    0x4(%rax),%eax
+  80641d:	8d 50 01             	lea    0x1(%rax),%edx
+  806420:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806424:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806427:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80642c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806430:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806434:	72 94                	jb     8063ca <devpipe_write+0x9b>
+	}
+
+	return i;
+  806436:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80643a:	48 83 c4 40          	add    $0x40,%rsp
+  80643e:	5b                   	pop    %rbx
+  80643f:	41 5f                	pop    %r15
+  806441:	5d                   	pop    %rbp
+  806442:	c3                   	ret
+
+0000000000806443 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806443:	55                   	push   %rbp
+  806444:	48 89 e5             	mov    %rsp,%rbp
+  806447:	41 57                	push   %r15
+  806449:	53                   	push   %rbx
+  80644a:	48 83 ec 20          	sub    $0x20,%rsp
+  80644e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80644e <devpipe_stat+0xb>
+  806455:	49 bb f2 2b 00 00 00 	movabs $0x2bf2,%r11
+  80645c:	00 00 00 
+  80645f:	4c 01 db             	add    %r11,%rbx
+  806462:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806466:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80646a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80646e:	48 89 c7             	mov    %rax,%rdi
+  806471:	49 89 df             	mov    %rbx,%r15
+  806474:	48 b8 45 aa ff ff ff 	movabs $0xffffffffffffaa45,%rax
+  80647b:	ff ff ff 
+  80647e:	48 01 d8             	add    %rbx,%rax
+  806481:	ff d0                	call   *%rax
+  806483:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  806487:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80648b:	48 ba 71 e3 ff ff ff 	movabs $0xffffffffffffe371,%rdx
+  806492:	ff ff ff 
+  806495:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806499:	48 89 d6             	mov    %rdx,%rsi
+  80649c:	48 89 c7             	mov    %rax,%rdi
+  80649f:	49 89 df             	mov    %rbx,%r15
+  8064a2:	48 b8 51 82 ff ff ff 	movabs $0xffffffffffff8251,%rax
+  8064a9:	ff ff ff 
+  8064ac:	48 01 d8             	add    %rbx,%rax
+  8064af:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8064b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8064b5:	8b 50 04             	mov    0x4(%rax),%edx
+  8064b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8064bc:	8b 00                	mov    (%rax),%eax
+  8064be:	29 c2                	sub    %eax,%edx
+  8064c0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064c4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8064ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064ce:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8064d5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8064d8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064dc:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8064e3:	00 00 00 
+  8064e6:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8064ea:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8064f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8064f6:	48 83 c4 20          	add    $0x20,%rsp
+  8064fa:	5b                   	pop    %rbx
+  8064fb:	41 5f                	pop    %r15
+  8064fd:	5d                   	pop    %rbp
+  8064fe:	c3                   	ret
+
+00000000008064ff <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8064ff:	55                   	push   %rbp
+  806500:	48 89 e5             	mov    %rsp,%rbp
+  806503:	41 57                	push   %r15
+  806505:	53                   	push   %rbx
+  806506:	48 83 ec 10          	sub    $0x10,%rsp
+  80650a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80650a <devpipe_close+0xb>
+  806511:	49 bb 36 2b 00 00 00 	movabs $0x2b36,%r11
+  806518:	00 00 00 
+  80651b:	4c 01 db             	add    %r11,%rbx
+  80651e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806522:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806526:	48 89 c6             	mov    %rax,%rsi
+  806529:	bf 00 00 00 00       	mov    $0x0,%edi
+  80652e:	49 89 df             	mov    %rbx,%r15
+  806531:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  806538:	ff ff ff 
+  80653b:	48 01 d8             	add    %rbx,%rax
+  80653e:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  806540:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806544:	48 89 c7             	mov    %rax,%rdi
+  806547:	49 89 df             	mov    %rbx,%r15
+  80654a:	48 b8 45 aa ff ff ff 	movabs $0xffffffffffffaa45,%rax
+  806551:	ff ff ff 
+  806554:	48 01 d8             	add    %rbx,%rax
+  806557:	ff d0                	call   *%rax
+  806559:	48 89 c6             	mov    %rax,%rsi
+  80655c:	bf 00 00 00 00       	mov    $0x0,%edi
+  806561:	49 89 df             	mov    %rbx,%r15
+  806564:	48 b8 e5 8f ff ff ff 	movabs $0xffffffffffff8fe5,%rax
+  80656b:	ff ff ff 
+  80656e:	48 01 d8             	add    %rbx,%rax
+  806571:	ff d0                	call   *%rax
+}
+  806573:	48 83 c4 10          	add    $0x10,%rsp
+  806577:	5b                   	pop    %rbx
+  806578:	41 5f                	pop    %r15
+  80657a:	5d                   	pop    %rbp
+  80657b:	c3                   	ret
+
+000000000080657c <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80657c:	55                   	push   %rbp
+  80657d:	48 89 e5             	mov    %rsp,%rbp
+  806580:	41 57                	push   %r15
+  806582:	48 83 ec 28          	sub    $0x28,%rsp
+  806586:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806586 <cputchar+0xa>
+  80658d:	49 bb ba 2a 00 00 00 	movabs $0x2aba,%r11
+  806594:	00 00 00 
+  806597:	4c 01 d8             	add    %r11,%rax
+  80659a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80659d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8065a0:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8065a3:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8065a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8065ac:	48 89 d7             	mov    %rdx,%rdi
+  8065af:	49 89 c7             	mov    %rax,%r15
+  8065b2:	48 ba 55 8d ff ff ff 	movabs $0xffffffffffff8d55,%rdx
+  8065b9:	ff ff ff 
+  8065bc:	48 01 c2             	add    %rax,%rdx
+  8065bf:	ff d2                	call   *%rdx
+}
+  8065c1:	90                   	nop
+  8065c2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8065c6:	c9                   	leave
+  8065c7:	c3                   	ret
+
+00000000008065c8 <getchar>:
+
+int
+getchar(void)
+{
+  8065c8:	55                   	push   %rbp
+  8065c9:	48 89 e5             	mov    %rsp,%rbp
+  8065cc:	41 57                	push   %r15
+  8065ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8065d2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8065d2 <getchar+0xa>
+  8065d9:	49 bb 6e 2a 00 00 00 	movabs $0x2a6e,%r11
+  8065e0:	00 00 00 
+  8065e3:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8065e6:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8065ea:	ba 01 00 00 00       	mov    $0x1,%edx
+  8065ef:	48 89 ce             	mov    %rcx,%rsi
+  8065f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8065f7:	49 89 c7             	mov    %rax,%r15
+  8065fa:	48 b9 85 b0 ff ff ff 	movabs $0xffffffffffffb085,%rcx
+  806601:	ff ff ff 
+  806604:	48 01 c1             	add    %rax,%rcx
+  806607:	ff d1                	call   *%rcx
+  806609:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80660c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806610:	79 05                	jns    806617 <getchar+0x4f>
+		return r;
+  806612:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806615:	eb 14                	jmp    80662b <getchar+0x63>
+	if (r < 1)
+  806617:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80661b:	7f 07                	jg     806624 <getchar+0x5c>
+		return -E_EOF;
+  80661d:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806622:	eb 07                	jmp    80662b <getchar+0x63>
+	return c;
+  806624:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806628:	0f b6 c0             	movzbl %al,%eax
+}
+  80662b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80662f:	c9                   	leave
+  806630:	c3                   	ret
+
+0000000000806631 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806631:	55                   	push   %rbp
+  806632:	48 89 e5             	mov    %rsp,%rbp
+  806635:	41 57                	push   %r15
+  806637:	53                   	push   %rbx
+  806638:	48 83 ec 20          	sub    $0x20,%rsp
+  80663c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80663c <iscons+0xb>
+  806643:	49 bb 04 2a 00 00 00 	movabs $0x2a04,%r11
+  80664a:	00 00 00 
+  80664d:	4c 01 db             	add    %r11,%rbx
+  806650:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806653:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806657:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80665a:	48 89 d6             	mov    %rdx,%rsi
+  80665d:	89 c7                	mov    %eax,%edi
+  80665f:	49 89 df             	mov    %rbx,%r15
+  806662:	48 b8 3e ab ff ff ff 	movabs $0xffffffffffffab3e,%rax
+  806669:	ff ff ff 
+  80666c:	48 01 d8             	add    %rbx,%rax
+  80666f:	ff d0                	call   *%rax
+  806671:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806674:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806678:	79 05                	jns    80667f <iscons+0x4e>
+		return r;
+  80667a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80667d:	eb 1b                	jmp    80669a <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80667f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806683:	8b 10                	mov    (%rax),%edx
+  806685:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  80668c:	00 00 00 
+  80668f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806692:	39 c2                	cmp    %eax,%edx
+  806694:	0f 94 c0             	sete   %al
+  806697:	0f b6 c0             	movzbl %al,%eax
+}
+  80669a:	48 83 c4 20          	add    $0x20,%rsp
+  80669e:	5b                   	pop    %rbx
+  80669f:	41 5f                	pop    %r15
+  8066a1:	5d                   	pop    %rbp
+  8066a2:	c3                   	ret
+
+00000000008066a3 <opencons>:
+
+int
+opencons(void)
+{
+  8066a3:	55                   	push   %rbp
+  8066a4:	48 89 e5             	mov    %rsp,%rbp
+  8066a7:	41 57                	push   %r15
+  8066a9:	53                   	push   %rbx
+  8066aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8066ae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8066ae <opencons+0xb>
+  8066b5:	49 bb 92 29 00 00 00 	movabs $0x2992,%r11
+  8066bc:	00 00 00 
+  8066bf:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8066c2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8066c6:	48 89 c7             	mov    %rax,%rdi
+  8066c9:	49 89 df             	mov    %rbx,%r15
+  8066cc:	48 b8 88 aa ff ff ff 	movabs $0xffffffffffffaa88,%rax
+  8066d3:	ff ff ff 
+  8066d6:	48 01 d8             	add    %rbx,%rax
+  8066d9:	ff d0                	call   *%rax
+  8066db:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8066de:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066e2:	79 05                	jns    8066e9 <opencons+0x46>
+		return r;
+  8066e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066e7:	eb 68                	jmp    806751 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8066e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066ed:	ba 07 04 00 00       	mov    $0x407,%edx
+  8066f2:	48 89 c6             	mov    %rax,%rsi
+  8066f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8066fa:	49 89 df             	mov    %rbx,%r15
+  8066fd:	48 b8 0d 8f ff ff ff 	movabs $0xffffffffffff8f0d,%rax
+  806704:	ff ff ff 
+  806707:	48 01 d8             	add    %rbx,%rax
+  80670a:	ff d0                	call   *%rax
+  80670c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80670f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806713:	79 05                	jns    80671a <opencons+0x77>
+		return r;
+  806715:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806718:	eb 37                	jmp    806751 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80671a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80671e:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806725:	00 00 00 
+  806728:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80672b:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80672d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806731:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806738:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80673c:	48 89 c7             	mov    %rax,%rdi
+  80673f:	49 89 df             	mov    %rbx,%r15
+  806742:	48 b8 0e aa ff ff ff 	movabs $0xffffffffffffaa0e,%rax
+  806749:	ff ff ff 
+  80674c:	48 01 d8             	add    %rbx,%rax
+  80674f:	ff d0                	call   *%rax
+}
+  806751:	48 83 c4 10          	add    $0x10,%rsp
+  806755:	5b                   	pop    %rbx
+  806756:	41 5f                	pop    %r15
+  806758:	5d                   	pop    %rbp
+  806759:	c3                   	ret
+
+000000000080675a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80675a:	55                   	push   %rbp
+  80675b:	48 89 e5             	mov    %rsp,%rbp
+  80675e:	41 57                	push   %r15
+  806760:	53                   	push   %rbx
+  806761:	48 83 ec 30          	sub    $0x30,%rsp
+  806765:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806765 <devcons_read+0xb>
+  80676c:	49 bb db 28 00 00 00 	movabs $0x28db,%r11
+  806773:	00 00 00 
+  806776:	4c 01 db             	add    %r11,%rbx
+  806779:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80677d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806781:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806785:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80678a:	75 19                	jne    8067a5 <devcons_read+0x4b>
+		return 0;
+  80678c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806791:	eb 55                	jmp    8067e8 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806793:	49 89 df             	mov    %rbx,%r15
+  806796:	48 b8 b8 8e ff ff ff 	movabs $0xffffffffffff8eb8,%rax
+  80679d:	ff ff ff 
+  8067a0:	48 01 d8             	add    %rbx,%rax
+  8067a3:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8067a5:	49 89 df             	mov    %rbx,%r15
+  8067a8:	48 b8 b4 8d ff ff ff 	movabs $0xffffffffffff8db4,%rax
+  8067af:	ff ff ff 
+  8067b2:	48 01 d8             	add    %rbx,%rax
+  8067b5:	ff d0                	call   *%rax
+  8067b7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8067ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067be:	74 d3                	je     806793 <devcons_read+0x39>
+	if (c < 0)
+  8067c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067c4:	79 05                	jns    8067cb <devcons_read+0x71>
+		return c;
+  8067c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067c9:	eb 1d                	jmp    8067e8 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8067cb:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8067cf:	75 07                	jne    8067d8 <devcons_read+0x7e>
+		return 0;
+  8067d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067d6:	eb 10                	jmp    8067e8 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8067d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067db:	89 c2                	mov    %eax,%edx
+  8067dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8067e1:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8067e3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8067e8:	48 83 c4 30          	add    $0x30,%rsp
+  8067ec:	5b                   	pop    %rbx
+  8067ed:	41 5f                	pop    %r15
+  8067ef:	5d                   	pop    %rbp
+  8067f0:	c3                   	ret
+
+00000000008067f1 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8067f1:	55                   	push   %rbp
+  8067f2:	48 89 e5             	mov    %rsp,%rbp
+  8067f5:	41 57                	push   %r15
+  8067f7:	53                   	push   %rbx
+  8067f8:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8067ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067ff <devcons_write+0xe>
+  806806:	49 bb 41 28 00 00 00 	movabs $0x2841,%r11
+  80680d:	00 00 00 
+  806810:	4c 01 db             	add    %r11,%rbx
+  806813:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80681a:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806821:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806828:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80682f:	e9 80 00 00 00       	jmp    8068b4 <devcons_write+0xc3>
+		m = n - tot;
+  806834:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80683b:	89 c2                	mov    %eax,%edx
+  80683d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806840:	29 c2                	sub    %eax,%edx
+  806842:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806845:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806848:	83 f8 7f             	cmp    $0x7f,%eax
+  80684b:	76 07                	jbe    806854 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  80684d:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806854:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806857:	48 63 d0             	movslq %eax,%rdx
+  80685a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80685d:	48 63 c8             	movslq %eax,%rcx
+  806860:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806867:	48 01 c1             	add    %rax,%rcx
+  80686a:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806871:	48 89 ce             	mov    %rcx,%rsi
+  806874:	48 89 c7             	mov    %rax,%rdi
+  806877:	49 89 df             	mov    %rbx,%r15
+  80687a:	48 b8 31 86 ff ff ff 	movabs $0xffffffffffff8631,%rax
+  806881:	ff ff ff 
+  806884:	48 01 d8             	add    %rbx,%rax
+  806887:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806889:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80688c:	48 63 d0             	movslq %eax,%rdx
+  80688f:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806896:	48 89 d6             	mov    %rdx,%rsi
+  806899:	48 89 c7             	mov    %rax,%rdi
+  80689c:	49 89 df             	mov    %rbx,%r15
+  80689f:	48 b8 55 8d ff ff ff 	movabs $0xffffffffffff8d55,%rax
+  8068a6:	ff ff ff 
+  8068a9:	48 01 d8             	add    %rbx,%rax
+  8068ac:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8068ae:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8068b1:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8068b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068b7:	48 98                	cltq
+  8068b9:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8068c0:	0f 82 6e ff ff ff    	jb     806834 <devcons_write+0x43>
+	}
+	return tot;
+  8068c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8068c9:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8068d0:	5b                   	pop    %rbx
+  8068d1:	41 5f                	pop    %r15
+  8068d3:	5d                   	pop    %rbp
+  8068d4:	c3                   	ret
+
+00000000008068d5 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8068d5:	55                   	push   %rbp
+  8068d6:	48 89 e5             	mov    %rsp,%rbp
+  8068d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8068dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8068dd <devcons_close+0x8>
+  8068e4:	49 bb 63 27 00 00 00 	movabs $0x2763,%r11
+  8068eb:	00 00 00 
+  8068ee:	4c 01 d8             	add    %r11,%rax
+  8068f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8068f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8068fa:	c9                   	leave
+  8068fb:	c3                   	ret
+
+00000000008068fc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8068fc:	55                   	push   %rbp
+  8068fd:	48 89 e5             	mov    %rsp,%rbp
+  806900:	41 57                	push   %r15
+  806902:	48 83 ec 18          	sub    $0x18,%rsp
+  806906:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806906 <devcons_stat+0xa>
+  80690d:	49 bb 3a 27 00 00 00 	movabs $0x273a,%r11
+  806914:	00 00 00 
+  806917:	4c 01 d8             	add    %r11,%rax
+  80691a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80691e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806922:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806926:	48 b9 7d e3 ff ff ff 	movabs $0xffffffffffffe37d,%rcx
+  80692d:	ff ff ff 
+  806930:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806934:	48 89 ce             	mov    %rcx,%rsi
+  806937:	48 89 d7             	mov    %rdx,%rdi
+  80693a:	49 89 c7             	mov    %rax,%r15
+  80693d:	48 ba 51 82 ff ff ff 	movabs $0xffffffffffff8251,%rdx
+  806944:	ff ff ff 
+  806947:	48 01 c2             	add    %rax,%rdx
+  80694a:	ff d2                	call   *%rdx
+	return 0;
+  80694c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806951:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806955:	c9                   	leave
+  806956:	c3                   	ret
+
+0000000000806957 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  806957:	55                   	push   %rbp
+  806958:	48 89 e5             	mov    %rsp,%rbp
+  80695b:	41 57                	push   %r15
+  80695d:	41 54                	push   %r12
+  80695f:	53                   	push   %rbx
+  806960:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  806967:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806967 <_panic+0x10>
+  80696e:	49 bb d9 26 00 00 00 	movabs $0x26d9,%r11
+  806975:	00 00 00 
+  806978:	4c 01 db             	add    %r11,%rbx
+  80697b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  806982:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  806988:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80698f:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  806996:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80699d:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8069a4:	84 c0                	test   %al,%al
+  8069a6:	74 26                	je     8069ce <_panic+0x77>
+  8069a8:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8069af:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8069b6:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8069ba:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8069be:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8069c2:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8069c6:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8069ca:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8069ce:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8069d5:	00 00 00 
+  8069d8:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8069df:	00 00 00 
+  8069e2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8069e6:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8069ed:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8069f4:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8069fb:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  806a02:	ff ff ff 
+  806a05:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a09:	4c 8b 20             	mov    (%rax),%r12
+  806a0c:	49 89 df             	mov    %rbx,%r15
+  806a0f:	48 b8 64 8e ff ff ff 	movabs $0xffffffffffff8e64,%rax
+  806a16:	ff ff ff 
+  806a19:	48 01 d8             	add    %rbx,%rax
+  806a1c:	ff d0                	call   *%rax
+  806a1e:	89 c6                	mov    %eax,%esi
+  806a20:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  806a26:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  806a2d:	41 89 d0             	mov    %edx,%r8d
+  806a30:	48 89 c1             	mov    %rax,%rcx
+  806a33:	4c 89 e2             	mov    %r12,%rdx
+  806a36:	48 b8 88 e3 ff ff ff 	movabs $0xffffffffffffe388,%rax
+  806a3d:	ff ff ff 
+  806a40:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806a44:	48 89 c7             	mov    %rax,%rdi
+  806a47:	49 89 df             	mov    %rbx,%r15
+  806a4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a4f:	49 b9 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%r9
+  806a56:	ff ff ff 
+  806a59:	49 01 d9             	add    %rbx,%r9
+  806a5c:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  806a5f:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  806a66:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  806a6d:	48 89 d6             	mov    %rdx,%rsi
+  806a70:	48 89 c7             	mov    %rax,%rdi
+  806a73:	49 89 df             	mov    %rbx,%r15
+  806a76:	48 b8 af 73 ff ff ff 	movabs $0xffffffffffff73af,%rax
+  806a7d:	ff ff ff 
+  806a80:	48 01 d8             	add    %rbx,%rax
+  806a83:	ff d0                	call   *%rax
+	cprintf("\n");
+  806a85:	48 b8 ab e3 ff ff ff 	movabs $0xffffffffffffe3ab,%rax
+  806a8c:	ff ff ff 
+  806a8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806a93:	48 89 c7             	mov    %rax,%rdi
+  806a96:	49 89 df             	mov    %rbx,%r15
+  806a99:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a9e:	48 ba 8f 74 ff ff ff 	movabs $0xffffffffffff748f,%rdx
+  806aa5:	ff ff ff 
+  806aa8:	48 01 da             	add    %rbx,%rdx
+  806aab:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  806aad:	cc                   	int3
+  806aae:	eb fd                	jmp    806aad <_panic+0x156>
+
+0000000000806ab0 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806ab0:	55                   	push   %rbp
+  806ab1:	48 89 e5             	mov    %rsp,%rbp
+  806ab4:	41 57                	push   %r15
+  806ab6:	53                   	push   %rbx
+  806ab7:	48 83 ec 20          	sub    $0x20,%rsp
+  806abb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806abb <set_pgfault_handler+0xb>
+  806ac2:	49 bb 85 25 00 00 00 	movabs $0x2585,%r11
+  806ac9:	00 00 00 
+  806acc:	4c 01 db             	add    %r11,%rbx
+  806acf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806ad3:	49 89 df             	mov    %rbx,%r15
+  806ad6:	48 b8 64 8e ff ff ff 	movabs $0xffffffffffff8e64,%rax
+  806add:	ff ff ff 
+  806ae0:	48 01 d8             	add    %rbx,%rax
+  806ae3:	ff d0                	call   *%rax
+  806ae5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806ae8:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806aef:	00 00 00 
+  806af2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806af6:	48 85 c0             	test   %rax,%rax
+  806af9:	75 6b                	jne    806b66 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806afb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806afe:	ba 07 00 00 00       	mov    $0x7,%edx
+  806b03:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806b08:	48 89 ce             	mov    %rcx,%rsi
+  806b0b:	89 c7                	mov    %eax,%edi
+  806b0d:	49 89 df             	mov    %rbx,%r15
+  806b10:	48 b8 0d 8f ff ff ff 	movabs $0xffffffffffff8f0d,%rax
+  806b17:	ff ff ff 
+  806b1a:	48 01 d8             	add    %rbx,%rax
+  806b1d:	ff d0                	call   *%rax
+  806b1f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806b22:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806b26:	74 3e                	je     806b66 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806b28:	48 b8 b0 e3 ff ff ff 	movabs $0xffffffffffffe3b0,%rax
+  806b2f:	ff ff ff 
+  806b32:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b36:	48 89 c2             	mov    %rax,%rdx
+  806b39:	be 23 00 00 00       	mov    $0x23,%esi
+  806b3e:	48 b8 de e3 ff ff ff 	movabs $0xffffffffffffe3de,%rax
+  806b45:	ff ff ff 
+  806b48:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b4c:	48 89 c7             	mov    %rax,%rdi
+  806b4f:	49 89 df             	mov    %rbx,%r15
+  806b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b57:	48 b9 17 d9 ff ff ff 	movabs $0xffffffffffffd917,%rcx
+  806b5e:	ff ff ff 
+  806b61:	48 01 d9             	add    %rbx,%rcx
+  806b64:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806b66:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806b6d:	00 00 00 
+  806b70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806b74:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806b78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b7b:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806b82:	ff ff ff 
+  806b85:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806b89:	48 89 d6             	mov    %rdx,%rsi
+  806b8c:	89 c7                	mov    %eax,%edi
+  806b8e:	49 89 df             	mov    %rbx,%r15
+  806b91:	48 b8 03 91 ff ff ff 	movabs $0xffffffffffff9103,%rax
+  806b98:	ff ff ff 
+  806b9b:	48 01 d8             	add    %rbx,%rax
+  806b9e:	ff d0                	call   *%rax
+}
+  806ba0:	90                   	nop
+  806ba1:	48 83 c4 20          	add    $0x20,%rsp
+  806ba5:	5b                   	pop    %rbx
+  806ba6:	41 5f                	pop    %r15
+  806ba8:	5d                   	pop    %rbp
+  806ba9:	c3                   	ret
+
+0000000000806baa <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806baa:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806bad:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806bb4:	00 00 00 
+call *%rax
+  806bb7:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806bb9:	58                   	pop    %rax
+	popq %rax;
+  806bba:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806bbb:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806bc2:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806bc6:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806bca:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806bce:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806bd2:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806bd6:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806bd9:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806bdd:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806be1:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806be6:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806beb:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806bf0:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806bf5:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806bfa:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806bff:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806c04:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806c09:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806c0e:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806c13:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806c18:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806c1d:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806c22:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806c27:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806c2b:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806c2f:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806c30:	5c                   	pop    %rsp
+	ret;			//return
+  806c31:	c3                   	ret
+
+0000000000806c32 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806c32:	55                   	push   %rbp
+  806c33:	48 89 e5             	mov    %rsp,%rbp
+  806c36:	48 83 ec 18          	sub    $0x18,%rsp
+  806c3a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806c3a <pageref+0x8>
+  806c41:	49 bb 06 24 00 00 00 	movabs $0x2406,%r11
+  806c48:	00 00 00 
+  806c4b:	4c 01 d8             	add    %r11,%rax
+  806c4e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806c52:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c56:	48 89 d1             	mov    %rdx,%rcx
+  806c59:	48 c1 e9 15          	shr    $0x15,%rcx
+  806c5d:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806c64:	ff ff ff 
+  806c67:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806c6b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806c6f:	83 e2 01             	and    $0x1,%edx
+  806c72:	48 85 d2             	test   %rdx,%rdx
+  806c75:	75 07                	jne    806c7e <pageref+0x4c>
+		return 0;
+  806c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c7c:	eb 64                	jmp    806ce2 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806c7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c82:	48 89 d1             	mov    %rdx,%rcx
+  806c85:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806c89:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806c90:	ff ff ff 
+  806c93:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806c97:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806c9b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806c9f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806ca3:	83 e2 01             	and    $0x1,%edx
+  806ca6:	48 85 d2             	test   %rdx,%rdx
+  806ca9:	75 07                	jne    806cb2 <pageref+0x80>
+		return 0;
+  806cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cb0:	eb 30                	jmp    806ce2 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806cb2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806cb6:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806cba:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806cc1:	ff ff ff 
+  806cc4:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806cc8:	48 89 d0             	mov    %rdx,%rax
+  806ccb:	48 01 c0             	add    %rax,%rax
+  806cce:	48 01 d0             	add    %rdx,%rax
+  806cd1:	48 c1 e0 03          	shl    $0x3,%rax
+  806cd5:	48 01 c8             	add    %rcx,%rax
+  806cd8:	48 83 c0 08          	add    $0x8,%rax
+  806cdc:	0f b7 00             	movzwl (%rax),%eax
+  806cdf:	0f b7 c0             	movzwl %ax,%eax
+}
+  806ce2:	c9                   	leave
+  806ce3:	c3                   	ret
@@ -0,0 +1,9541 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 db 01 00 00       	call   80021c <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 30          	sub    $0x30,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <handler+0xb>
+  800055:	49 bb ea 7f 00 00 00 	movabs $0x7fea,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  800066:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80006a:	48 8b 00             	mov    (%rax),%rax
+  80006d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	cprintf("fault %x\n", addr);
+  800071:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800075:	48 89 c6             	mov    %rax,%rsi
+  800078:	48 b8 f8 e0 ff ff ff 	movabs $0xffffffffffffe0f8,%rax
+  80007f:	ff ff ff 
+  800082:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800086:	48 89 c7             	mov    %rax,%rdi
+  800089:	49 89 df             	mov    %rbx,%r15
+  80008c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800091:	48 ba c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rdx
+  800098:	ff ff ff 
+  80009b:	48 01 da             	add    %rbx,%rdx
+  80009e:	ff d2                	call   *%rdx
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  8000a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000a4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8000a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000ac:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8000b2:	ba 07 00 00 00       	mov    $0x7,%edx
+  8000b7:	48 89 c6             	mov    %rax,%rsi
+  8000ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000bf:	49 89 df             	mov    %rbx,%r15
+  8000c2:	48 b8 43 a0 ff ff ff 	movabs $0xffffffffffffa043,%rax
+  8000c9:	ff ff ff 
+  8000cc:	48 01 d8             	add    %rbx,%rax
+  8000cf:	ff d0                	call   *%rax
+  8000d1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8000d4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8000d8:	79 4c                	jns    800126 <handler+0xe3>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  8000da:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8000dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000e1:	41 89 d0             	mov    %edx,%r8d
+  8000e4:	48 89 c1             	mov    %rax,%rcx
+  8000e7:	48 b8 08 e1 ff ff ff 	movabs $0xffffffffffffe108,%rax
+  8000ee:	ff ff ff 
+  8000f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000f5:	48 89 c2             	mov    %rax,%rdx
+  8000f8:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000fd:	48 b8 33 e1 ff ff ff 	movabs $0xffffffffffffe133,%rax
+  800104:	ff ff ff 
+  800107:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80010b:	48 89 c7             	mov    %rax,%rdi
+  80010e:	49 89 df             	mov    %rbx,%r15
+  800111:	b8 00 00 00 00       	mov    $0x0,%eax
+  800116:	49 b9 ee 82 ff ff ff 	movabs $0xffffffffffff82ee,%r9
+  80011d:	ff ff ff 
+  800120:	49 01 d9             	add    %rbx,%r9
+  800123:	41 ff d1             	call   *%r9
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800126:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80012a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80012e:	48 89 d1             	mov    %rdx,%rcx
+  800131:	48 ba 48 e1 ff ff ff 	movabs $0xffffffffffffe148,%rdx
+  800138:	ff ff ff 
+  80013b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80013f:	be 64 00 00 00       	mov    $0x64,%esi
+  800144:	48 89 c7             	mov    %rax,%rdi
+  800147:	49 89 df             	mov    %rbx,%r15
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	49 b8 fa 91 ff ff ff 	movabs $0xffffffffffff91fa,%r8
+  800156:	ff ff ff 
+  800159:	49 01 d8             	add    %rbx,%r8
+  80015c:	41 ff d0             	call   *%r8
+}
+  80015f:	90                   	nop
+  800160:	48 83 c4 30          	add    $0x30,%rsp
+  800164:	5b                   	pop    %rbx
+  800165:	41 5f                	pop    %r15
+  800167:	5d                   	pop    %rbp
+  800168:	c3                   	ret
+
+0000000000800169 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800169:	55                   	push   %rbp
+  80016a:	48 89 e5             	mov    %rsp,%rbp
+  80016d:	41 57                	push   %r15
+  80016f:	53                   	push   %rbx
+  800170:	48 83 ec 10          	sub    $0x10,%rsp
+  800174:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800174 <umain+0xb>
+  80017b:	49 bb c4 7e 00 00 00 	movabs $0x7ec4,%r11
+  800182:	00 00 00 
+  800185:	4c 01 db             	add    %r11,%rbx
+  800188:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80018b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	set_pgfault_handler(handler);
+  80018f:	48 b8 0b 80 ff ff ff 	movabs $0xffffffffffff800b,%rax
+  800196:	ff ff ff 
+  800199:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80019d:	48 89 c7             	mov    %rax,%rdi
+  8001a0:	49 89 df             	mov    %rbx,%r15
+  8001a3:	48 b8 ec a7 ff ff ff 	movabs $0xffffffffffffa7ec,%rax
+  8001aa:	ff ff ff 
+  8001ad:	48 01 d8             	add    %rbx,%rax
+  8001b0:	ff d0                	call   *%rax
+	cprintf("%s\n", (char*)0xDeadBeef);
+  8001b2:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  8001b7:	48 89 c6             	mov    %rax,%rsi
+  8001ba:	48 b8 69 e1 ff ff ff 	movabs $0xffffffffffffe169,%rax
+  8001c1:	ff ff ff 
+  8001c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001c8:	48 89 c7             	mov    %rax,%rdi
+  8001cb:	49 89 df             	mov    %rbx,%r15
+  8001ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d3:	48 ba c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rdx
+  8001da:	ff ff ff 
+  8001dd:	48 01 da             	add    %rbx,%rdx
+  8001e0:	ff d2                	call   *%rdx
+	cprintf("%s\n", (char*)0xCafeBffe);
+  8001e2:	b8 fe bf fe ca       	mov    $0xcafebffe,%eax
+  8001e7:	48 89 c6             	mov    %rax,%rsi
+  8001ea:	48 b8 69 e1 ff ff ff 	movabs $0xffffffffffffe169,%rax
+  8001f1:	ff ff ff 
+  8001f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f8:	48 89 c7             	mov    %rax,%rdi
+  8001fb:	49 89 df             	mov    %rbx,%r15
+  8001fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800203:	48 ba c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rdx
+  80020a:	ff ff ff 
+  80020d:	48 01 da             	add    %rbx,%rdx
+  800210:	ff d2                	call   *%rdx
+}
+  800212:	90                   	nop
+  800213:	48 83 c4 10          	add    $0x10,%rsp
+  800217:	5b                   	pop    %rbx
+  800218:	41 5f                	pop    %r15
+  80021a:	5d                   	pop    %rbp
+  80021b:	c3                   	ret
+
+000000000080021c <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80021c:	55                   	push   %rbp
+  80021d:	48 89 e5             	mov    %rsp,%rbp
+  800220:	41 57                	push   %r15
+  800222:	53                   	push   %rbx
+  800223:	48 83 ec 20          	sub    $0x20,%rsp
+  800227:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800227 <libmain+0xb>
+  80022e:	49 bb 11 7e 00 00 00 	movabs $0x7e11,%r11
+  800235:	00 00 00 
+  800238:	4c 01 db             	add    %r11,%rbx
+  80023b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80023e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800242:	49 89 df             	mov    %rbx,%r15
+  800245:	48 b8 9a 9f ff ff ff 	movabs $0xffffffffffff9f9a,%rax
+  80024c:	ff ff ff 
+  80024f:	48 01 d8             	add    %rbx,%rax
+  800252:	ff d0                	call   *%rax
+  800254:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800257:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80025a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80025f:	48 98                	cltq
+  800261:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800268:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  80026f:	ff ff ff 
+  800272:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800276:	48 01 c2             	add    %rax,%rdx
+  800279:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  800280:	00 00 00 
+  800283:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800287:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80028b:	7e 15                	jle    8002a2 <libmain+0x86>
+		binaryname = argv[0];
+  80028d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800291:	48 8b 00             	mov    (%rax),%rax
+  800294:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  80029b:	00 00 00 
+  80029e:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8002a2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8002a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8002a9:	48 89 d6             	mov    %rdx,%rsi
+  8002ac:	89 c7                	mov    %eax,%edi
+  8002ae:	49 89 df             	mov    %rbx,%r15
+  8002b1:	48 b8 31 81 ff ff ff 	movabs $0xffffffffffff8131,%rax
+  8002b8:	ff ff ff 
+  8002bb:	48 01 d8             	add    %rbx,%rax
+  8002be:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8002c0:	49 89 df             	mov    %rbx,%r15
+  8002c3:	48 b8 a4 82 ff ff ff 	movabs $0xffffffffffff82a4,%rax
+  8002ca:	ff ff ff 
+  8002cd:	48 01 d8             	add    %rbx,%rax
+  8002d0:	ff d0                	call   *%rax
+}
+  8002d2:	90                   	nop
+  8002d3:	48 83 c4 20          	add    $0x20,%rsp
+  8002d7:	5b                   	pop    %rbx
+  8002d8:	41 5f                	pop    %r15
+  8002da:	5d                   	pop    %rbp
+  8002db:	c3                   	ret
+
+00000000008002dc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002dc:	55                   	push   %rbp
+  8002dd:	48 89 e5             	mov    %rsp,%rbp
+  8002e0:	41 57                	push   %r15
+  8002e2:	53                   	push   %rbx
+  8002e3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8002e3 <exit+0x7>
+  8002ea:	49 bb 55 7d 00 00 00 	movabs $0x7d55,%r11
+  8002f1:	00 00 00 
+  8002f4:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8002f7:	49 89 df             	mov    %rbx,%r15
+  8002fa:	48 b8 99 ad ff ff ff 	movabs $0xffffffffffffad99,%rax
+  800301:	ff ff ff 
+  800304:	48 01 d8             	add    %rbx,%rax
+  800307:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800309:	bf 00 00 00 00       	mov    $0x0,%edi
+  80030e:	49 89 df             	mov    %rbx,%r15
+  800311:	48 b8 3e 9f ff ff ff 	movabs $0xffffffffffff9f3e,%rax
+  800318:	ff ff ff 
+  80031b:	48 01 d8             	add    %rbx,%rax
+  80031e:	ff d0                	call   *%rax
+}
+  800320:	90                   	nop
+  800321:	5b                   	pop    %rbx
+  800322:	41 5f                	pop    %r15
+  800324:	5d                   	pop    %rbp
+  800325:	c3                   	ret
+
+0000000000800326 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800326:	55                   	push   %rbp
+  800327:	48 89 e5             	mov    %rsp,%rbp
+  80032a:	41 57                	push   %r15
+  80032c:	41 54                	push   %r12
+  80032e:	53                   	push   %rbx
+  80032f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800336:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800336 <_panic+0x10>
+  80033d:	49 bb 02 7d 00 00 00 	movabs $0x7d02,%r11
+  800344:	00 00 00 
+  800347:	4c 01 db             	add    %r11,%rbx
+  80034a:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800351:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800357:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80035e:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800365:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80036c:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800373:	84 c0                	test   %al,%al
+  800375:	74 26                	je     80039d <_panic+0x77>
+  800377:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80037e:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800385:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800389:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80038d:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800391:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800395:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800399:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80039d:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8003a4:	00 00 00 
+  8003a7:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8003ae:	00 00 00 
+  8003b1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003b5:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8003bc:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8003c3:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003ca:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  8003d1:	ff ff ff 
+  8003d4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8003d8:	4c 8b 20             	mov    (%rax),%r12
+  8003db:	49 89 df             	mov    %rbx,%r15
+  8003de:	48 b8 9a 9f ff ff ff 	movabs $0xffffffffffff9f9a,%rax
+  8003e5:	ff ff ff 
+  8003e8:	48 01 d8             	add    %rbx,%rax
+  8003eb:	ff d0                	call   *%rax
+  8003ed:	89 c6                	mov    %eax,%esi
+  8003ef:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8003f5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8003fc:	41 89 d0             	mov    %edx,%r8d
+  8003ff:	48 89 c1             	mov    %rax,%rcx
+  800402:	4c 89 e2             	mov    %r12,%rdx
+  800405:	48 b8 78 e1 ff ff ff 	movabs $0xffffffffffffe178,%rax
+  80040c:	ff ff ff 
+  80040f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800413:	48 89 c7             	mov    %rax,%rdi
+  800416:	49 89 df             	mov    %rbx,%r15
+  800419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041e:	49 b9 c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%r9
+  800425:	ff ff ff 
+  800428:	49 01 d9             	add    %rbx,%r9
+  80042b:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80042e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800435:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80043c:	48 89 d6             	mov    %rdx,%rsi
+  80043f:	48 89 c7             	mov    %rax,%rdi
+  800442:	49 89 df             	mov    %rbx,%r15
+  800445:	48 b8 e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%rax
+  80044c:	ff ff ff 
+  80044f:	48 01 d8             	add    %rbx,%rax
+  800452:	ff d0                	call   *%rax
+	cprintf("\n");
+  800454:	48 b8 9b e1 ff ff ff 	movabs $0xffffffffffffe19b,%rax
+  80045b:	ff ff ff 
+  80045e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800462:	48 89 c7             	mov    %rax,%rdi
+  800465:	49 89 df             	mov    %rbx,%r15
+  800468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046d:	48 ba c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rdx
+  800474:	ff ff ff 
+  800477:	48 01 da             	add    %rbx,%rdx
+  80047a:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80047c:	cc                   	int3
+  80047d:	eb fd                	jmp    80047c <_panic+0x156>
+
+000000000080047f <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  80047f:	55                   	push   %rbp
+  800480:	48 89 e5             	mov    %rsp,%rbp
+  800483:	41 57                	push   %r15
+  800485:	48 83 ec 18          	sub    $0x18,%rsp
+  800489:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800489 <putch+0xa>
+  800490:	49 bb af 7b 00 00 00 	movabs $0x7baf,%r11
+  800497:	00 00 00 
+  80049a:	4c 01 d8             	add    %r11,%rax
+  80049d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8004a0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8004a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004a8:	8b 12                	mov    (%rdx),%edx
+  8004aa:	8d 72 01             	lea    0x1(%rdx),%esi
+  8004ad:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8004b1:	89 31                	mov    %esi,(%rcx)
+  8004b3:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8004b6:	89 ce                	mov    %ecx,%esi
+  8004b8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8004bc:	48 63 d2             	movslq %edx,%rdx
+  8004bf:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8004c4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004c8:	8b 12                	mov    (%rdx),%edx
+  8004ca:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004d0:	75 33                	jne    800505 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8004d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004d6:	8b 12                	mov    (%rdx),%edx
+  8004d8:	48 63 d2             	movslq %edx,%rdx
+  8004db:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8004df:	48 83 c1 08          	add    $0x8,%rcx
+  8004e3:	48 89 d6             	mov    %rdx,%rsi
+  8004e6:	48 89 cf             	mov    %rcx,%rdi
+  8004e9:	49 89 c7             	mov    %rax,%r15
+  8004ec:	48 ba 8b 9e ff ff ff 	movabs $0xffffffffffff9e8b,%rdx
+  8004f3:	ff ff ff 
+  8004f6:	48 01 c2             	add    %rax,%rdx
+  8004f9:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8004fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004ff:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800505:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800509:	8b 40 04             	mov    0x4(%rax),%eax
+  80050c:	8d 50 01             	lea    0x1(%rax),%edx
+  80050f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800513:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800516:	90                   	nop
+  800517:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80051b:	c9                   	leave
+  80051c:	c3                   	ret
+
+000000000080051d <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80051d:	55                   	push   %rbp
+  80051e:	48 89 e5             	mov    %rsp,%rbp
+  800521:	41 57                	push   %r15
+  800523:	53                   	push   %rbx
+  800524:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80052b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80052b <vcprintf+0xe>
+  800532:	49 bb 0d 7b 00 00 00 	movabs $0x7b0d,%r11
+  800539:	00 00 00 
+  80053c:	4c 01 db             	add    %r11,%rbx
+  80053f:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800546:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80054d:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800554:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80055b:	48 8b 06             	mov    (%rsi),%rax
+  80055e:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800562:	48 89 01             	mov    %rax,(%rcx)
+  800565:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800569:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80056d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800571:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800578:	00 00 00 
+    b.cnt = 0;
+  80057b:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800582:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800585:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80058c:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800593:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80059a:	48 89 c6             	mov    %rax,%rsi
+  80059d:	48 b8 47 84 ff ff ff 	movabs $0xffffffffffff8447,%rax
+  8005a4:	ff ff ff 
+  8005a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005ab:	48 89 c7             	mov    %rax,%rdi
+  8005ae:	49 89 df             	mov    %rbx,%r15
+  8005b1:	48 b8 09 8a ff ff ff 	movabs $0xffffffffffff8a09,%rax
+  8005b8:	ff ff ff 
+  8005bb:	48 01 d8             	add    %rbx,%rax
+  8005be:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8005c0:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8005c6:	48 98                	cltq
+  8005c8:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8005cf:	48 83 c2 08          	add    $0x8,%rdx
+  8005d3:	48 89 c6             	mov    %rax,%rsi
+  8005d6:	48 89 d7             	mov    %rdx,%rdi
+  8005d9:	49 89 df             	mov    %rbx,%r15
+  8005dc:	48 b8 8b 9e ff ff ff 	movabs $0xffffffffffff9e8b,%rax
+  8005e3:	ff ff ff 
+  8005e6:	48 01 d8             	add    %rbx,%rax
+  8005e9:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8005eb:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8005f1:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8005f8:	5b                   	pop    %rbx
+  8005f9:	41 5f                	pop    %r15
+  8005fb:	5d                   	pop    %rbp
+  8005fc:	c3                   	ret
+
+00000000008005fd <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8005fd:	55                   	push   %rbp
+  8005fe:	48 89 e5             	mov    %rsp,%rbp
+  800601:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800608:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800608 <cprintf+0xb>
+  80060f:	49 bb 30 7a 00 00 00 	movabs $0x7a30,%r11
+  800616:	00 00 00 
+  800619:	4d 01 da             	add    %r11,%r10
+  80061c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800623:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80062a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800631:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800638:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80063f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800646:	84 c0                	test   %al,%al
+  800648:	74 20                	je     80066a <cprintf+0x6d>
+  80064a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80064e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800652:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800656:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80065a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80065e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800662:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800666:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80066a:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800671:	00 00 00 
+  800674:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80067b:	00 00 00 
+  80067e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800682:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800689:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800690:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800697:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80069e:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8006a5:	48 8b 06             	mov    (%rsi),%rax
+  8006a8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006ac:	48 89 01             	mov    %rax,(%rcx)
+  8006af:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006b3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006b7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8006bb:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8006c2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8006c9:	48 89 d6             	mov    %rdx,%rsi
+  8006cc:	48 89 c7             	mov    %rax,%rdi
+  8006cf:	48 b8 e5 84 ff ff ff 	movabs $0xffffffffffff84e5,%rax
+  8006d6:	ff ff ff 
+  8006d9:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8006dd:	ff d0                	call   *%rax
+  8006df:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8006e5:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8006eb:	c9                   	leave
+  8006ec:	c3                   	ret
+
+00000000008006ed <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8006ed:	55                   	push   %rbp
+  8006ee:	48 89 e5             	mov    %rsp,%rbp
+  8006f1:	53                   	push   %rbx
+  8006f2:	48 83 ec 38          	sub    $0x38,%rsp
+  8006f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006f6 <printnum+0x9>
+  8006fd:	49 bb 42 79 00 00 00 	movabs $0x7942,%r11
+  800704:	00 00 00 
+  800707:	4c 01 db             	add    %r11,%rbx
+  80070a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80070e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800712:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800716:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800719:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  80071d:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800721:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800724:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800728:	72 58                	jb     800782 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80072a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80072d:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800730:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800733:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800737:	ba 00 00 00 00       	mov    $0x0,%edx
+  80073c:	48 f7 f6             	div    %rsi
+  80073f:	49 89 c2             	mov    %rax,%r10
+  800742:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800745:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800748:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80074c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800750:	41 89 c9             	mov    %ecx,%r9d
+  800753:	41 89 f8             	mov    %edi,%r8d
+  800756:	89 d1                	mov    %edx,%ecx
+  800758:	4c 89 d2             	mov    %r10,%rdx
+  80075b:	48 89 c7             	mov    %rax,%rdi
+  80075e:	48 b8 b5 86 ff ff ff 	movabs $0xffffffffffff86b5,%rax
+  800765:	ff ff ff 
+  800768:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80076c:	ff d0                	call   *%rax
+  80076e:	eb 1c                	jmp    80078c <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800770:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800774:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800777:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80077b:	48 89 d6             	mov    %rdx,%rsi
+  80077e:	89 c7                	mov    %eax,%edi
+  800780:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800782:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800786:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80078a:	7f e4                	jg     800770 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80078c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80078f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800793:	ba 00 00 00 00       	mov    $0x0,%edx
+  800798:	48 f7 f1             	div    %rcx
+  80079b:	48 b8 d7 e2 ff ff ff 	movabs $0xffffffffffffe2d7,%rax
+  8007a2:	ff ff ff 
+  8007a5:	48 01 d8             	add    %rbx,%rax
+  8007a8:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8007ac:	0f be c0             	movsbl %al,%eax
+  8007af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007b3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007b7:	48 89 d6             	mov    %rdx,%rsi
+  8007ba:	89 c7                	mov    %eax,%edi
+  8007bc:	ff d1                	call   *%rcx
+}
+  8007be:	90                   	nop
+  8007bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007c3:	c9                   	leave
+  8007c4:	c3                   	ret
+
+00000000008007c5 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8007c5:	55                   	push   %rbp
+  8007c6:	48 89 e5             	mov    %rsp,%rbp
+  8007c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8007cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007cd <getuint+0x8>
+  8007d4:	49 bb 6b 78 00 00 00 	movabs $0x786b,%r11
+  8007db:	00 00 00 
+  8007de:	4c 01 d8             	add    %r11,%rax
+  8007e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007e5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8007e8:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8007ec:	7e 4f                	jle    80083d <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8007ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007f2:	8b 00                	mov    (%rax),%eax
+  8007f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f7:	77 24                	ja     80081d <getuint+0x58>
+  8007f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007fd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800801:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800805:	8b 00                	mov    (%rax),%eax
+  800807:	89 c0                	mov    %eax,%eax
+  800809:	48 01 d0             	add    %rdx,%rax
+  80080c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800810:	8b 12                	mov    (%rdx),%edx
+  800812:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800815:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800819:	89 0a                	mov    %ecx,(%rdx)
+  80081b:	eb 14                	jmp    800831 <getuint+0x6c>
+  80081d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800821:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800825:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800829:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80082d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800831:	48 8b 00             	mov    (%rax),%rax
+  800834:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800838:	e9 9d 00 00 00       	jmp    8008da <getuint+0x115>
+	else if (lflag)
+  80083d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800841:	74 4c                	je     80088f <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800843:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800847:	8b 00                	mov    (%rax),%eax
+  800849:	83 f8 2f             	cmp    $0x2f,%eax
+  80084c:	77 24                	ja     800872 <getuint+0xad>
+  80084e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800852:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800856:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80085a:	8b 00                	mov    (%rax),%eax
+  80085c:	89 c0                	mov    %eax,%eax
+  80085e:	48 01 d0             	add    %rdx,%rax
+  800861:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800865:	8b 12                	mov    (%rdx),%edx
+  800867:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80086a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80086e:	89 0a                	mov    %ecx,(%rdx)
+  800870:	eb 14                	jmp    800886 <getuint+0xc1>
+  800872:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800876:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80087a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80087e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800882:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800886:	48 8b 00             	mov    (%rax),%rax
+  800889:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80088d:	eb 4b                	jmp    8008da <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  80088f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800893:	8b 00                	mov    (%rax),%eax
+  800895:	83 f8 2f             	cmp    $0x2f,%eax
+  800898:	77 24                	ja     8008be <getuint+0xf9>
+  80089a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80089e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008a6:	8b 00                	mov    (%rax),%eax
+  8008a8:	89 c0                	mov    %eax,%eax
+  8008aa:	48 01 d0             	add    %rdx,%rax
+  8008ad:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008b1:	8b 12                	mov    (%rdx),%edx
+  8008b3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008b6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008ba:	89 0a                	mov    %ecx,(%rdx)
+  8008bc:	eb 14                	jmp    8008d2 <getuint+0x10d>
+  8008be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008c2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008c6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008ca:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008ce:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008d2:	8b 00                	mov    (%rax),%eax
+  8008d4:	89 c0                	mov    %eax,%eax
+  8008d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8008da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8008de:	c9                   	leave
+  8008df:	c3                   	ret
+
+00000000008008e0 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8008e0:	55                   	push   %rbp
+  8008e1:	48 89 e5             	mov    %rsp,%rbp
+  8008e4:	48 83 ec 20          	sub    $0x20,%rsp
+  8008e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008e8 <printfloat+0x8>
+  8008ef:	49 bb 50 77 00 00 00 	movabs $0x7750,%r11
+  8008f6:	00 00 00 
+  8008f9:	4c 01 d8             	add    %r11,%rax
+  8008fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800900:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800904:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800908:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80090c:	48 85 c0             	test   %rax,%rax
+  80090f:	79 12                	jns    800923 <printfloat+0x43>
+		putch('-',putdat);
+  800911:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800915:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800919:	48 89 c6             	mov    %rax,%rsi
+  80091c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800921:	ff d2                	call   *%rdx
+	
+}
+  800923:	90                   	nop
+  800924:	c9                   	leave
+  800925:	c3                   	ret
+
+0000000000800926 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800926:	55                   	push   %rbp
+  800927:	48 89 e5             	mov    %rsp,%rbp
+  80092a:	48 83 ec 20          	sub    $0x20,%rsp
+  80092e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80092e <getint+0x8>
+  800935:	49 bb 0a 77 00 00 00 	movabs $0x770a,%r11
+  80093c:	00 00 00 
+  80093f:	4c 01 d8             	add    %r11,%rax
+  800942:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800946:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800949:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80094d:	7e 4f                	jle    80099e <getint+0x78>
+		x=va_arg(*ap, long long);
+  80094f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800953:	8b 00                	mov    (%rax),%eax
+  800955:	83 f8 2f             	cmp    $0x2f,%eax
+  800958:	77 24                	ja     80097e <getint+0x58>
+  80095a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80095e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800962:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800966:	8b 00                	mov    (%rax),%eax
+  800968:	89 c0                	mov    %eax,%eax
+  80096a:	48 01 d0             	add    %rdx,%rax
+  80096d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800971:	8b 12                	mov    (%rdx),%edx
+  800973:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800976:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80097a:	89 0a                	mov    %ecx,(%rdx)
+  80097c:	eb 14                	jmp    800992 <getint+0x6c>
+  80097e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800982:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800986:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80098a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80098e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800992:	48 8b 00             	mov    (%rax),%rax
+  800995:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800999:	e9 9d 00 00 00       	jmp    800a3b <getint+0x115>
+	else if (lflag)
+  80099e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8009a2:	74 4c                	je     8009f0 <getint+0xca>
+		x=va_arg(*ap, long);
+  8009a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a8:	8b 00                	mov    (%rax),%eax
+  8009aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ad:	77 24                	ja     8009d3 <getint+0xad>
+  8009af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009b3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009bb:	8b 00                	mov    (%rax),%eax
+  8009bd:	89 c0                	mov    %eax,%eax
+  8009bf:	48 01 d0             	add    %rdx,%rax
+  8009c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009c6:	8b 12                	mov    (%rdx),%edx
+  8009c8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009cb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009cf:	89 0a                	mov    %ecx,(%rdx)
+  8009d1:	eb 14                	jmp    8009e7 <getint+0xc1>
+  8009d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009d7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009db:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009e3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009e7:	48 8b 00             	mov    (%rax),%rax
+  8009ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009ee:	eb 4b                	jmp    800a3b <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8009f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009f4:	8b 00                	mov    (%rax),%eax
+  8009f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f9:	77 24                	ja     800a1f <getint+0xf9>
+  8009fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ff:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a07:	8b 00                	mov    (%rax),%eax
+  800a09:	89 c0                	mov    %eax,%eax
+  800a0b:	48 01 d0             	add    %rdx,%rax
+  800a0e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a12:	8b 12                	mov    (%rdx),%edx
+  800a14:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a17:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a1b:	89 0a                	mov    %ecx,(%rdx)
+  800a1d:	eb 14                	jmp    800a33 <getint+0x10d>
+  800a1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a23:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a27:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a2b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a2f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a33:	8b 00                	mov    (%rax),%eax
+  800a35:	48 98                	cltq
+  800a37:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a3f:	c9                   	leave
+  800a40:	c3                   	ret
+
+0000000000800a41 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800a41:	55                   	push   %rbp
+  800a42:	48 89 e5             	mov    %rsp,%rbp
+  800a45:	41 57                	push   %r15
+  800a47:	41 55                	push   %r13
+  800a49:	41 54                	push   %r12
+  800a4b:	53                   	push   %rbx
+  800a4c:	48 83 ec 60          	sub    $0x60,%rsp
+  800a50:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800a50 <vprintfmt+0xf>
+  800a57:	49 bb e8 75 00 00 00 	movabs $0x75e8,%r11
+  800a5e:	00 00 00 
+  800a61:	4d 01 dc             	add    %r11,%r12
+  800a64:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800a68:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800a6c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800a70:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800a74:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800a7b:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800a7f:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800a83:	48 8b 06             	mov    (%rsi),%rax
+  800a86:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a8a:	48 89 01             	mov    %rax,(%rcx)
+  800a8d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a91:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a95:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a99:	eb 17                	jmp    800ab2 <vprintfmt+0x71>
+			if (ch == '\0')
+  800a9b:	85 db                	test   %ebx,%ebx
+  800a9d:	0f 84 97 05 00 00    	je     80103a <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800aa3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800aa7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800aab:	48 89 c6             	mov    %rax,%rsi
+  800aae:	89 df                	mov    %ebx,%edi
+  800ab0:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ab2:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ab6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800aba:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800abe:	0f b6 00             	movzbl (%rax),%eax
+  800ac1:	0f b6 d8             	movzbl %al,%ebx
+  800ac4:	83 fb 25             	cmp    $0x25,%ebx
+  800ac7:	75 d2                	jne    800a9b <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800ac9:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800acd:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800ad4:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800adb:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800ae2:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800ae9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800aed:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800af1:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800af5:	0f b6 00             	movzbl (%rax),%eax
+  800af8:	0f b6 d8             	movzbl %al,%ebx
+  800afb:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800afe:	83 f8 55             	cmp    $0x55,%eax
+  800b01:	0f 87 00 05 00 00    	ja     801007 <vprintfmt+0x5c6>
+  800b07:	89 c0                	mov    %eax,%eax
+  800b09:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800b10:	00 
+  800b11:	48 8d 05 20 58 00 00 	lea    0x5820(%rip),%rax        # 806338 <.LC18+0xc>
+  800b18:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800b1c:	48 8d 15 15 58 00 00 	lea    0x5815(%rip),%rdx        # 806338 <.LC18+0xc>
+  800b23:	48 01 d0             	add    %rdx,%rax
+  800b26:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800b28:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800b2c:	eb bb                	jmp    800ae9 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800b2e:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800b32:	eb b5                	jmp    800ae9 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800b34:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800b3b:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800b3e:	89 d0                	mov    %edx,%eax
+  800b40:	c1 e0 02             	shl    $0x2,%eax
+  800b43:	01 d0                	add    %edx,%eax
+  800b45:	01 c0                	add    %eax,%eax
+  800b47:	01 d8                	add    %ebx,%eax
+  800b49:	83 e8 30             	sub    $0x30,%eax
+  800b4c:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800b4f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b53:	0f b6 00             	movzbl (%rax),%eax
+  800b56:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800b59:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b5c:	7e 60                	jle    800bbe <vprintfmt+0x17d>
+  800b5e:	83 fb 39             	cmp    $0x39,%ebx
+  800b61:	7f 5b                	jg     800bbe <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800b63:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800b68:	eb d1                	jmp    800b3b <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800b6a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b70:	77 17                	ja     800b89 <vprintfmt+0x148>
+  800b72:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b76:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b79:	89 d2                	mov    %edx,%edx
+  800b7b:	48 01 d0             	add    %rdx,%rax
+  800b7e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b81:	83 c2 08             	add    $0x8,%edx
+  800b84:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b87:	eb 0c                	jmp    800b95 <vprintfmt+0x154>
+  800b89:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b8d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b91:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b95:	8b 00                	mov    (%rax),%eax
+  800b97:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800b9a:	eb 23                	jmp    800bbf <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800b9c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ba0:	0f 89 43 ff ff ff    	jns    800ae9 <vprintfmt+0xa8>
+				width = 0;
+  800ba6:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800bad:	e9 37 ff ff ff       	jmp    800ae9 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800bb2:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800bb9:	e9 2b ff ff ff       	jmp    800ae9 <vprintfmt+0xa8>
+			goto process_precision;
+  800bbe:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800bbf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800bc3:	0f 89 20 ff ff ff    	jns    800ae9 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800bc9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800bcc:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800bcf:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800bd6:	e9 0e ff ff ff       	jmp    800ae9 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800bdb:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800bdf:	e9 05 ff ff ff       	jmp    800ae9 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800be4:	83 fb 39             	cmp    $0x39,%ebx
+  800be7:	7f 0b                	jg     800bf4 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800be9:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800bec:	c1 e0 08             	shl    $0x8,%eax
+  800bef:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800bf2:	eb 21                	jmp    800c15 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800bf4:	83 fb 60             	cmp    $0x60,%ebx
+  800bf7:	7e 10                	jle    800c09 <vprintfmt+0x1c8>
+  800bf9:	83 fb 66             	cmp    $0x66,%ebx
+  800bfc:	7f 0b                	jg     800c09 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800bfe:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800c01:	c1 e0 08             	shl    $0x8,%eax
+  800c04:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800c07:	eb 0c                	jmp    800c15 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800c09:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800c10:	e9 04 01 00 00       	jmp    800d19 <vprintfmt+0x2d8>
+  800c15:	e9 ff 00 00 00       	jmp    800d19 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800c1a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c20:	77 17                	ja     800c39 <vprintfmt+0x1f8>
+  800c22:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c26:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c29:	89 d2                	mov    %edx,%edx
+  800c2b:	48 01 d0             	add    %rdx,%rax
+  800c2e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c31:	83 c2 08             	add    $0x8,%edx
+  800c34:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c37:	eb 0c                	jmp    800c45 <vprintfmt+0x204>
+  800c39:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c3d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c41:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c45:	8b 00                	mov    (%rax),%eax
+  800c47:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c4b:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c4f:	48 89 d6             	mov    %rdx,%rsi
+  800c52:	89 c7                	mov    %eax,%edi
+  800c54:	ff d1                	call   *%rcx
+			break;
+  800c56:	e9 da 03 00 00       	jmp    801035 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800c5b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c61:	77 17                	ja     800c7a <vprintfmt+0x239>
+  800c63:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c67:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c6a:	89 d2                	mov    %edx,%edx
+  800c6c:	48 01 d0             	add    %rdx,%rax
+  800c6f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c72:	83 c2 08             	add    $0x8,%edx
+  800c75:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c78:	eb 0c                	jmp    800c86 <vprintfmt+0x245>
+  800c7a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c7e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c82:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c86:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800c88:	85 db                	test   %ebx,%ebx
+  800c8a:	79 02                	jns    800c8e <vprintfmt+0x24d>
+				err = -err;
+  800c8c:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800c8e:	83 fb 15             	cmp    $0x15,%ebx
+  800c91:	7f 19                	jg     800cac <vprintfmt+0x26b>
+  800c93:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  800c9a:	00 00 00 
+  800c9d:	48 63 c3             	movslq %ebx,%rax
+  800ca0:	4c 01 e2             	add    %r12,%rdx
+  800ca3:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800ca7:	4d 85 ed             	test   %r13,%r13
+  800caa:	75 36                	jne    800ce2 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800cac:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800cb0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cb4:	89 d9                	mov    %ebx,%ecx
+  800cb6:	48 ba e8 e2 ff ff ff 	movabs $0xffffffffffffe2e8,%rdx
+  800cbd:	ff ff ff 
+  800cc0:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800cc4:	48 89 c7             	mov    %rax,%rdi
+  800cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccc:	49 b8 10 90 ff ff ff 	movabs $0xffffffffffff9010,%r8
+  800cd3:	ff ff ff 
+  800cd6:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800cda:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800cdd:	e9 53 03 00 00       	jmp    801035 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800ce2:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800ce6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cea:	4c 89 e9             	mov    %r13,%rcx
+  800ced:	48 ba f1 e2 ff ff ff 	movabs $0xffffffffffffe2f1,%rdx
+  800cf4:	ff ff ff 
+  800cf7:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800cfb:	48 89 c7             	mov    %rax,%rdi
+  800cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d03:	49 b8 10 90 ff ff ff 	movabs $0xffffffffffff9010,%r8
+  800d0a:	ff ff ff 
+  800d0d:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800d11:	41 ff d0             	call   *%r8
+			break;
+  800d14:	e9 1c 03 00 00       	jmp    801035 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800d19:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d1c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1f:	77 17                	ja     800d38 <vprintfmt+0x2f7>
+  800d21:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d25:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d28:	89 d2                	mov    %edx,%edx
+  800d2a:	48 01 d0             	add    %rdx,%rax
+  800d2d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d30:	83 c2 08             	add    $0x8,%edx
+  800d33:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d36:	eb 0c                	jmp    800d44 <vprintfmt+0x303>
+  800d38:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d3c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d40:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d44:	4c 8b 28             	mov    (%rax),%r13
+  800d47:	4d 85 ed             	test   %r13,%r13
+  800d4a:	75 0e                	jne    800d5a <vprintfmt+0x319>
+				p = "(null)";
+  800d4c:	48 b8 f4 e2 ff ff ff 	movabs $0xffffffffffffe2f4,%rax
+  800d53:	ff ff ff 
+  800d56:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800d5a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d5e:	0f 8e 84 00 00 00    	jle    800de8 <vprintfmt+0x3a7>
+  800d64:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800d68:	74 7e                	je     800de8 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d6a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d6d:	48 98                	cltq
+  800d6f:	48 89 c6             	mov    %rax,%rsi
+  800d72:	4c 89 ef             	mov    %r13,%rdi
+  800d75:	4d 89 e7             	mov    %r12,%r15
+  800d78:	48 b8 35 93 ff ff ff 	movabs $0xffffffffffff9335,%rax
+  800d7f:	ff ff ff 
+  800d82:	4c 01 e0             	add    %r12,%rax
+  800d85:	ff d0                	call   *%rax
+  800d87:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800d8a:	eb 17                	jmp    800da3 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800d8c:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800d90:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800d94:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800d98:	48 89 d6             	mov    %rdx,%rsi
+  800d9b:	89 c7                	mov    %eax,%edi
+  800d9d:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d9f:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800da3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800da7:	7f e3                	jg     800d8c <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800da9:	eb 3d                	jmp    800de8 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800dab:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800daf:	74 1e                	je     800dcf <vprintfmt+0x38e>
+  800db1:	83 fb 1f             	cmp    $0x1f,%ebx
+  800db4:	7e 05                	jle    800dbb <vprintfmt+0x37a>
+  800db6:	83 fb 7e             	cmp    $0x7e,%ebx
+  800db9:	7e 14                	jle    800dcf <vprintfmt+0x38e>
+					putch('?', putdat);
+  800dbb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dbf:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dc3:	48 89 c6             	mov    %rax,%rsi
+  800dc6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800dcb:	ff d2                	call   *%rdx
+  800dcd:	eb 15                	jmp    800de4 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800dcf:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800dd2:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800dd5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dd9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ddd:	48 89 c6             	mov    %rax,%rsi
+  800de0:	89 cf                	mov    %ecx,%edi
+  800de2:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800de4:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800de8:	4c 89 e8             	mov    %r13,%rax
+  800deb:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800def:	0f b6 00             	movzbl (%rax),%eax
+  800df2:	0f be d8             	movsbl %al,%ebx
+  800df5:	85 db                	test   %ebx,%ebx
+  800df7:	74 28                	je     800e21 <vprintfmt+0x3e0>
+  800df9:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800dfd:	78 ac                	js     800dab <vprintfmt+0x36a>
+  800dff:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800e03:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800e07:	79 a2                	jns    800dab <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800e09:	eb 16                	jmp    800e21 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800e0b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e0f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e13:	48 89 c6             	mov    %rax,%rsi
+  800e16:	bf 20 00 00 00       	mov    $0x20,%edi
+  800e1b:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800e1d:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e21:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e25:	7f e4                	jg     800e0b <vprintfmt+0x3ca>
+			break;
+  800e27:	e9 09 02 00 00       	jmp    801035 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800e2c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e30:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e34:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800e38:	0f b6 00             	movzbl (%rax),%eax
+  800e3b:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800e3e:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800e3f:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e42:	0f 8e ac fd ff ff    	jle    800bf4 <vprintfmt+0x1b3>
+  800e48:	e9 97 fd ff ff       	jmp    800be4 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800e4d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e51:	be 03 00 00 00       	mov    $0x3,%esi
+  800e56:	48 89 c7             	mov    %rax,%rdi
+  800e59:	48 b8 ee 88 ff ff ff 	movabs $0xffffffffffff88ee,%rax
+  800e60:	ff ff ff 
+  800e63:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e67:	ff d0                	call   *%rax
+  800e69:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800e6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e71:	48 85 c0             	test   %rax,%rax
+  800e74:	79 1d                	jns    800e93 <vprintfmt+0x452>
+				putch('-', putdat);
+  800e76:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e7a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e7e:	48 89 c6             	mov    %rax,%rsi
+  800e81:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e86:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800e88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e8c:	48 f7 d8             	neg    %rax
+  800e8f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800e93:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800e9a:	e9 de 00 00 00       	jmp    800f7d <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800e9f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ea3:	be 03 00 00 00       	mov    $0x3,%esi
+  800ea8:	48 89 c7             	mov    %rax,%rdi
+  800eab:	48 b8 8d 87 ff ff ff 	movabs $0xffffffffffff878d,%rax
+  800eb2:	ff ff ff 
+  800eb5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800eb9:	ff d0                	call   *%rax
+  800ebb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800ebf:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800ec6:	e9 b2 00 00 00       	jmp    800f7d <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800ecb:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ecf:	be 03 00 00 00       	mov    $0x3,%esi
+  800ed4:	48 89 c7             	mov    %rax,%rdi
+  800ed7:	48 b8 8d 87 ff ff ff 	movabs $0xffffffffffff878d,%rax
+  800ede:	ff ff ff 
+  800ee1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ee5:	ff d0                	call   *%rax
+  800ee7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800eeb:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800ef2:	e9 86 00 00 00       	jmp    800f7d <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800ef7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800efb:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800eff:	48 89 c6             	mov    %rax,%rsi
+  800f02:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f07:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800f09:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f0d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f11:	48 89 c6             	mov    %rax,%rsi
+  800f14:	bf 78 00 00 00       	mov    $0x78,%edi
+  800f19:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800f1b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f21:	77 17                	ja     800f3a <vprintfmt+0x4f9>
+  800f23:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f27:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f2a:	89 d2                	mov    %edx,%edx
+  800f2c:	48 01 d0             	add    %rdx,%rax
+  800f2f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f32:	83 c2 08             	add    $0x8,%edx
+  800f35:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f38:	eb 0c                	jmp    800f46 <vprintfmt+0x505>
+  800f3a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f3e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f42:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f46:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800f49:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f4d:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800f54:	eb 27                	jmp    800f7d <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800f56:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f5a:	be 03 00 00 00       	mov    $0x3,%esi
+  800f5f:	48 89 c7             	mov    %rax,%rdi
+  800f62:	48 b8 8d 87 ff ff ff 	movabs $0xffffffffffff878d,%rax
+  800f69:	ff ff ff 
+  800f6c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f70:	ff d0                	call   *%rax
+  800f72:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f76:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800f7d:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800f82:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800f85:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800f88:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800f8c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f90:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f94:	45 89 c1             	mov    %r8d,%r9d
+  800f97:	41 89 f8             	mov    %edi,%r8d
+  800f9a:	48 89 c7             	mov    %rax,%rdi
+  800f9d:	48 b8 b5 86 ff ff ff 	movabs $0xffffffffffff86b5,%rax
+  800fa4:	ff ff ff 
+  800fa7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fab:	ff d0                	call   *%rax
+			break;
+  800fad:	e9 83 00 00 00       	jmp    801035 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800fb2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fb6:	be 03 00 00 00       	mov    $0x3,%esi
+  800fbb:	48 89 c7             	mov    %rax,%rdi
+  800fbe:	48 b8 8d 87 ff ff ff 	movabs $0xffffffffffff878d,%rax
+  800fc5:	ff ff ff 
+  800fc8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fcc:	ff d0                	call   *%rax
+  800fce:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800fd2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800fd6:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800fda:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fde:	48 89 ce             	mov    %rcx,%rsi
+  800fe1:	48 89 c7             	mov    %rax,%rdi
+  800fe4:	48 b8 a8 88 ff ff ff 	movabs $0xffffffffffff88a8,%rax
+  800feb:	ff ff ff 
+  800fee:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ff2:	ff d0                	call   *%rax
+	
+			break;
+  800ff4:	eb 3f                	jmp    801035 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800ff6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ffa:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ffe:	48 89 c6             	mov    %rax,%rsi
+  801001:	89 df                	mov    %ebx,%edi
+  801003:	ff d2                	call   *%rdx
+			break;
+  801005:	eb 2e                	jmp    801035 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801007:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80100b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80100f:	48 89 c6             	mov    %rax,%rsi
+  801012:	bf 25 00 00 00       	mov    $0x25,%edi
+  801017:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801019:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80101e:	eb 05                	jmp    801025 <vprintfmt+0x5e4>
+  801020:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801025:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801029:	48 83 e8 01          	sub    $0x1,%rax
+  80102d:	0f b6 00             	movzbl (%rax),%eax
+  801030:	3c 25                	cmp    $0x25,%al
+  801032:	75 ec                	jne    801020 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801034:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801035:	e9 78 fa ff ff       	jmp    800ab2 <vprintfmt+0x71>
+				return;
+  80103a:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80103b:	48 83 c4 60          	add    $0x60,%rsp
+  80103f:	5b                   	pop    %rbx
+  801040:	41 5c                	pop    %r12
+  801042:	41 5d                	pop    %r13
+  801044:	41 5f                	pop    %r15
+  801046:	5d                   	pop    %rbp
+  801047:	c3                   	ret
+
+0000000000801048 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801048:	55                   	push   %rbp
+  801049:	48 89 e5             	mov    %rsp,%rbp
+  80104c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801053:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801053 <printfmt+0xb>
+  80105a:	49 bb e5 6f 00 00 00 	movabs $0x6fe5,%r11
+  801061:	00 00 00 
+  801064:	4d 01 da             	add    %r11,%r10
+  801067:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80106e:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801075:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80107c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801083:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80108a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801091:	84 c0                	test   %al,%al
+  801093:	74 20                	je     8010b5 <printfmt+0x6d>
+  801095:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801099:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80109d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010a1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010a5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010a9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010ad:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010b1:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8010b5:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8010bc:	00 00 00 
+  8010bf:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8010c6:	00 00 00 
+  8010c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010cd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8010d4:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010db:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8010e2:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8010e9:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8010f0:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8010f7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8010fe:	48 89 c7             	mov    %rax,%rdi
+  801101:	48 b8 09 8a ff ff ff 	movabs $0xffffffffffff8a09,%rax
+  801108:	ff ff ff 
+  80110b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80110f:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801111:	90                   	nop
+  801112:	c9                   	leave
+  801113:	c3                   	ret
+
+0000000000801114 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801114:	55                   	push   %rbp
+  801115:	48 89 e5             	mov    %rsp,%rbp
+  801118:	48 83 ec 10          	sub    $0x10,%rsp
+  80111c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80111c <sprintputch+0x8>
+  801123:	49 bb 1c 6f 00 00 00 	movabs $0x6f1c,%r11
+  80112a:	00 00 00 
+  80112d:	4c 01 d8             	add    %r11,%rax
+  801130:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801133:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801137:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80113b:	8b 40 10             	mov    0x10(%rax),%eax
+  80113e:	8d 50 01             	lea    0x1(%rax),%edx
+  801141:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801145:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801148:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80114c:	48 8b 10             	mov    (%rax),%rdx
+  80114f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801153:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801157:	48 39 c2             	cmp    %rax,%rdx
+  80115a:	73 17                	jae    801173 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80115c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801160:	48 8b 00             	mov    (%rax),%rax
+  801163:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801167:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80116b:	48 89 0a             	mov    %rcx,(%rdx)
+  80116e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801171:	88 10                	mov    %dl,(%rax)
+}
+  801173:	90                   	nop
+  801174:	c9                   	leave
+  801175:	c3                   	ret
+
+0000000000801176 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801176:	55                   	push   %rbp
+  801177:	48 89 e5             	mov    %rsp,%rbp
+  80117a:	53                   	push   %rbx
+  80117b:	48 83 ec 58          	sub    $0x58,%rsp
+  80117f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80117f <vsnprintf+0x9>
+  801186:	49 bb b9 6e 00 00 00 	movabs $0x6eb9,%r11
+  80118d:	00 00 00 
+  801190:	4c 01 d8             	add    %r11,%rax
+  801193:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801197:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80119a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80119e:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8011a2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8011a6:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8011aa:	48 8b 0e             	mov    (%rsi),%rcx
+  8011ad:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8011b1:	48 89 0a             	mov    %rcx,(%rdx)
+  8011b4:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8011b8:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8011bc:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8011c0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8011c4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8011c8:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8011cb:	48 63 d2             	movslq %edx,%rdx
+  8011ce:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8011d2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8011d6:	48 01 ca             	add    %rcx,%rdx
+  8011d9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8011dd:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8011e4:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8011e9:	74 06                	je     8011f1 <vsnprintf+0x7b>
+  8011eb:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8011ef:	7f 07                	jg     8011f8 <vsnprintf+0x82>
+		return -E_INVAL;
+  8011f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011f6:	eb 34                	jmp    80122c <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8011f8:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8011fc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801200:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801204:	48 bf dc 90 ff ff ff 	movabs $0xffffffffffff90dc,%rdi
+  80120b:	ff ff ff 
+  80120e:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801212:	49 b8 09 8a ff ff ff 	movabs $0xffffffffffff8a09,%r8
+  801219:	ff ff ff 
+  80121c:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801220:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801222:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801226:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801229:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80122c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801230:	c9                   	leave
+  801231:	c3                   	ret
+
+0000000000801232 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801232:	55                   	push   %rbp
+  801233:	48 89 e5             	mov    %rsp,%rbp
+  801236:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80123d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80123d <snprintf+0xb>
+  801244:	49 bb fb 6d 00 00 00 	movabs $0x6dfb,%r11
+  80124b:	00 00 00 
+  80124e:	4d 01 da             	add    %r11,%r10
+  801251:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801258:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80125e:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801265:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80126c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801273:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80127a:	84 c0                	test   %al,%al
+  80127c:	74 20                	je     80129e <snprintf+0x6c>
+  80127e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801282:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801286:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80128a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80128e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801292:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801296:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80129a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80129e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8012a5:	00 00 00 
+  8012a8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8012af:	00 00 00 
+  8012b2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8012b6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8012bd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8012c4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8012cb:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8012d2:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8012d9:	48 8b 06             	mov    (%rsi),%rax
+  8012dc:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8012e0:	48 89 01             	mov    %rax,(%rcx)
+  8012e3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8012e7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8012eb:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8012ef:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8012f6:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8012fd:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801303:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80130a:	48 89 c7             	mov    %rax,%rdi
+  80130d:	48 b8 3e 91 ff ff ff 	movabs $0xffffffffffff913e,%rax
+  801314:	ff ff ff 
+  801317:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80131b:	ff d0                	call   *%rax
+  80131d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801323:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801329:	c9                   	leave
+  80132a:	c3                   	ret
+
+000000000080132b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80132b:	55                   	push   %rbp
+  80132c:	48 89 e5             	mov    %rsp,%rbp
+  80132f:	48 83 ec 18          	sub    $0x18,%rsp
+  801333:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801333 <strlen+0x8>
+  80133a:	49 bb 05 6d 00 00 00 	movabs $0x6d05,%r11
+  801341:	00 00 00 
+  801344:	4c 01 d8             	add    %r11,%rax
+  801347:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80134b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801352:	eb 09                	jmp    80135d <strlen+0x32>
+		n++;
+  801354:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801358:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80135d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801361:	0f b6 00             	movzbl (%rax),%eax
+  801364:	84 c0                	test   %al,%al
+  801366:	75 ec                	jne    801354 <strlen+0x29>
+	return n;
+  801368:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80136b:	c9                   	leave
+  80136c:	c3                   	ret
+
+000000000080136d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80136d:	55                   	push   %rbp
+  80136e:	48 89 e5             	mov    %rsp,%rbp
+  801371:	48 83 ec 20          	sub    $0x20,%rsp
+  801375:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801375 <strnlen+0x8>
+  80137c:	49 bb c3 6c 00 00 00 	movabs $0x6cc3,%r11
+  801383:	00 00 00 
+  801386:	4c 01 d8             	add    %r11,%rax
+  801389:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80138d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801391:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801398:	eb 0e                	jmp    8013a8 <strnlen+0x3b>
+		n++;
+  80139a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80139e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8013a3:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8013a8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8013ad:	74 0b                	je     8013ba <strnlen+0x4d>
+  8013af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b3:	0f b6 00             	movzbl (%rax),%eax
+  8013b6:	84 c0                	test   %al,%al
+  8013b8:	75 e0                	jne    80139a <strnlen+0x2d>
+	return n;
+  8013ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013bd:	c9                   	leave
+  8013be:	c3                   	ret
+
+00000000008013bf <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8013bf:	55                   	push   %rbp
+  8013c0:	48 89 e5             	mov    %rsp,%rbp
+  8013c3:	48 83 ec 20          	sub    $0x20,%rsp
+  8013c7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013c7 <strcpy+0x8>
+  8013ce:	49 bb 71 6c 00 00 00 	movabs $0x6c71,%r11
+  8013d5:	00 00 00 
+  8013d8:	4c 01 d8             	add    %r11,%rax
+  8013db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8013e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8013eb:	90                   	nop
+  8013ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013f0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013f4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013fc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801400:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801404:	0f b6 12             	movzbl (%rdx),%edx
+  801407:	88 10                	mov    %dl,(%rax)
+  801409:	0f b6 00             	movzbl (%rax),%eax
+  80140c:	84 c0                	test   %al,%al
+  80140e:	75 dc                	jne    8013ec <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801410:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801414:	c9                   	leave
+  801415:	c3                   	ret
+
+0000000000801416 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801416:	55                   	push   %rbp
+  801417:	48 89 e5             	mov    %rsp,%rbp
+  80141a:	53                   	push   %rbx
+  80141b:	48 83 ec 20          	sub    $0x20,%rsp
+  80141f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80141f <strcat+0x9>
+  801426:	49 bb 19 6c 00 00 00 	movabs $0x6c19,%r11
+  80142d:	00 00 00 
+  801430:	4c 01 db             	add    %r11,%rbx
+  801433:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801437:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80143b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80143f:	48 89 c7             	mov    %rax,%rdi
+  801442:	48 b8 f3 92 ff ff ff 	movabs $0xffffffffffff92f3,%rax
+  801449:	ff ff ff 
+  80144c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801450:	ff d0                	call   *%rax
+  801452:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801455:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801458:	48 63 d0             	movslq %eax,%rdx
+  80145b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80145f:	48 01 c2             	add    %rax,%rdx
+  801462:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801466:	48 89 c6             	mov    %rax,%rsi
+  801469:	48 89 d7             	mov    %rdx,%rdi
+  80146c:	48 b8 87 93 ff ff ff 	movabs $0xffffffffffff9387,%rax
+  801473:	ff ff ff 
+  801476:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80147a:	ff d0                	call   *%rax
+	return dst;
+  80147c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801480:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801484:	c9                   	leave
+  801485:	c3                   	ret
+
+0000000000801486 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801486:	55                   	push   %rbp
+  801487:	48 89 e5             	mov    %rsp,%rbp
+  80148a:	48 83 ec 28          	sub    $0x28,%rsp
+  80148e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80148e <strncpy+0x8>
+  801495:	49 bb aa 6b 00 00 00 	movabs $0x6baa,%r11
+  80149c:	00 00 00 
+  80149f:	4c 01 d8             	add    %r11,%rax
+  8014a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014aa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8014ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8014b6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8014bd:	00 
+  8014be:	eb 2a                	jmp    8014ea <strncpy+0x64>
+		*dst++ = *src;
+  8014c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8014c8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8014cc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014d0:	0f b6 12             	movzbl (%rdx),%edx
+  8014d3:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8014d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014d9:	0f b6 00             	movzbl (%rax),%eax
+  8014dc:	84 c0                	test   %al,%al
+  8014de:	74 05                	je     8014e5 <strncpy+0x5f>
+			src++;
+  8014e0:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8014e5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ee:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8014f2:	72 cc                	jb     8014c0 <strncpy+0x3a>
+	}
+	return ret;
+  8014f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8014f8:	c9                   	leave
+  8014f9:	c3                   	ret
+
+00000000008014fa <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8014fa:	55                   	push   %rbp
+  8014fb:	48 89 e5             	mov    %rsp,%rbp
+  8014fe:	48 83 ec 28          	sub    $0x28,%rsp
+  801502:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801502 <strlcpy+0x8>
+  801509:	49 bb 36 6b 00 00 00 	movabs $0x6b36,%r11
+  801510:	00 00 00 
+  801513:	4c 01 d8             	add    %r11,%rax
+  801516:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80151a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80151e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801522:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801526:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80152a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80152f:	74 3d                	je     80156e <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801531:	eb 1d                	jmp    801550 <strlcpy+0x56>
+			*dst++ = *src++;
+  801533:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801537:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80153b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80153f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801543:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801547:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80154b:	0f b6 12             	movzbl (%rdx),%edx
+  80154e:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801550:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801555:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80155a:	74 0b                	je     801567 <strlcpy+0x6d>
+  80155c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801560:	0f b6 00             	movzbl (%rax),%eax
+  801563:	84 c0                	test   %al,%al
+  801565:	75 cc                	jne    801533 <strlcpy+0x39>
+		*dst = '\0';
+  801567:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80156b:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80156e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801572:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801576:	c9                   	leave
+  801577:	c3                   	ret
+
+0000000000801578 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801578:	55                   	push   %rbp
+  801579:	48 89 e5             	mov    %rsp,%rbp
+  80157c:	48 83 ec 10          	sub    $0x10,%rsp
+  801580:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801580 <strcmp+0x8>
+  801587:	49 bb b8 6a 00 00 00 	movabs $0x6ab8,%r11
+  80158e:	00 00 00 
+  801591:	4c 01 d8             	add    %r11,%rax
+  801594:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801598:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  80159c:	eb 0a                	jmp    8015a8 <strcmp+0x30>
+		p++, q++;
+  80159e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015a3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8015a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ac:	0f b6 00             	movzbl (%rax),%eax
+  8015af:	84 c0                	test   %al,%al
+  8015b1:	74 12                	je     8015c5 <strcmp+0x4d>
+  8015b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b7:	0f b6 10             	movzbl (%rax),%edx
+  8015ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015be:	0f b6 00             	movzbl (%rax),%eax
+  8015c1:	38 c2                	cmp    %al,%dl
+  8015c3:	74 d9                	je     80159e <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8015c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c9:	0f b6 00             	movzbl (%rax),%eax
+  8015cc:	0f b6 d0             	movzbl %al,%edx
+  8015cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015d3:	0f b6 00             	movzbl (%rax),%eax
+  8015d6:	0f b6 c0             	movzbl %al,%eax
+  8015d9:	29 c2                	sub    %eax,%edx
+  8015db:	89 d0                	mov    %edx,%eax
+}
+  8015dd:	c9                   	leave
+  8015de:	c3                   	ret
+
+00000000008015df <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8015df:	55                   	push   %rbp
+  8015e0:	48 89 e5             	mov    %rsp,%rbp
+  8015e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8015e7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015e7 <strncmp+0x8>
+  8015ee:	49 bb 51 6a 00 00 00 	movabs $0x6a51,%r11
+  8015f5:	00 00 00 
+  8015f8:	4c 01 d8             	add    %r11,%rax
+  8015fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801603:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801607:	eb 0f                	jmp    801618 <strncmp+0x39>
+		n--, p++, q++;
+  801609:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80160e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801613:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801618:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80161d:	74 1d                	je     80163c <strncmp+0x5d>
+  80161f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801623:	0f b6 00             	movzbl (%rax),%eax
+  801626:	84 c0                	test   %al,%al
+  801628:	74 12                	je     80163c <strncmp+0x5d>
+  80162a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80162e:	0f b6 10             	movzbl (%rax),%edx
+  801631:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801635:	0f b6 00             	movzbl (%rax),%eax
+  801638:	38 c2                	cmp    %al,%dl
+  80163a:	74 cd                	je     801609 <strncmp+0x2a>
+	if (n == 0)
+  80163c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801641:	75 07                	jne    80164a <strncmp+0x6b>
+		return 0;
+  801643:	ba 00 00 00 00       	mov    $0x0,%edx
+  801648:	eb 16                	jmp    801660 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80164a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80164e:	0f b6 00             	movzbl (%rax),%eax
+  801651:	0f b6 d0             	movzbl %al,%edx
+  801654:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801658:	0f b6 00             	movzbl (%rax),%eax
+  80165b:	0f b6 c0             	movzbl %al,%eax
+  80165e:	29 c2                	sub    %eax,%edx
+}
+  801660:	89 d0                	mov    %edx,%eax
+  801662:	c9                   	leave
+  801663:	c3                   	ret
+
+0000000000801664 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801664:	55                   	push   %rbp
+  801665:	48 89 e5             	mov    %rsp,%rbp
+  801668:	48 83 ec 10          	sub    $0x10,%rsp
+  80166c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80166c <strchr+0x8>
+  801673:	49 bb cc 69 00 00 00 	movabs $0x69cc,%r11
+  80167a:	00 00 00 
+  80167d:	4c 01 d8             	add    %r11,%rax
+  801680:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801684:	89 f0                	mov    %esi,%eax
+  801686:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801689:	eb 17                	jmp    8016a2 <strchr+0x3e>
+		if (*s == c)
+  80168b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80168f:	0f b6 00             	movzbl (%rax),%eax
+  801692:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801695:	75 06                	jne    80169d <strchr+0x39>
+			return (char *) s;
+  801697:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80169b:	eb 15                	jmp    8016b2 <strchr+0x4e>
+	for (; *s; s++)
+  80169d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a6:	0f b6 00             	movzbl (%rax),%eax
+  8016a9:	84 c0                	test   %al,%al
+  8016ab:	75 de                	jne    80168b <strchr+0x27>
+	return 0;
+  8016ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016b2:	c9                   	leave
+  8016b3:	c3                   	ret
+
+00000000008016b4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8016b4:	55                   	push   %rbp
+  8016b5:	48 89 e5             	mov    %rsp,%rbp
+  8016b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8016bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016bc <strfind+0x8>
+  8016c3:	49 bb 7c 69 00 00 00 	movabs $0x697c,%r11
+  8016ca:	00 00 00 
+  8016cd:	4c 01 d8             	add    %r11,%rax
+  8016d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016d4:	89 f0                	mov    %esi,%eax
+  8016d6:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8016d9:	eb 11                	jmp    8016ec <strfind+0x38>
+		if (*s == c)
+  8016db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016df:	0f b6 00             	movzbl (%rax),%eax
+  8016e2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016e5:	74 12                	je     8016f9 <strfind+0x45>
+	for (; *s; s++)
+  8016e7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f0:	0f b6 00             	movzbl (%rax),%eax
+  8016f3:	84 c0                	test   %al,%al
+  8016f5:	75 e4                	jne    8016db <strfind+0x27>
+  8016f7:	eb 01                	jmp    8016fa <strfind+0x46>
+			break;
+  8016f9:	90                   	nop
+	return (char *) s;
+  8016fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016fe:	c9                   	leave
+  8016ff:	c3                   	ret
+
+0000000000801700 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801700:	55                   	push   %rbp
+  801701:	48 89 e5             	mov    %rsp,%rbp
+  801704:	48 83 ec 18          	sub    $0x18,%rsp
+  801708:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801708 <memset+0x8>
+  80170f:	49 bb 30 69 00 00 00 	movabs $0x6930,%r11
+  801716:	00 00 00 
+  801719:	4c 01 d8             	add    %r11,%rax
+  80171c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801720:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801723:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801727:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80172c:	75 06                	jne    801734 <memset+0x34>
+		return v;
+  80172e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801732:	eb 69                	jmp    80179d <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801738:	83 e0 03             	and    $0x3,%eax
+  80173b:	48 85 c0             	test   %rax,%rax
+  80173e:	75 48                	jne    801788 <memset+0x88>
+  801740:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801744:	83 e0 03             	and    $0x3,%eax
+  801747:	48 85 c0             	test   %rax,%rax
+  80174a:	75 3c                	jne    801788 <memset+0x88>
+		c &= 0xFF;
+  80174c:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801753:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801756:	c1 e0 18             	shl    $0x18,%eax
+  801759:	89 c2                	mov    %eax,%edx
+  80175b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80175e:	c1 e0 10             	shl    $0x10,%eax
+  801761:	09 c2                	or     %eax,%edx
+  801763:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801766:	c1 e0 08             	shl    $0x8,%eax
+  801769:	09 d0                	or     %edx,%eax
+  80176b:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  80176e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801772:	48 c1 e8 02          	shr    $0x2,%rax
+  801776:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801779:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80177d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801780:	48 89 d7             	mov    %rdx,%rdi
+  801783:	fc                   	cld
+  801784:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801786:	eb 11                	jmp    801799 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801788:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80178c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80178f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801793:	48 89 d7             	mov    %rdx,%rdi
+  801796:	fc                   	cld
+  801797:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801799:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80179d:	c9                   	leave
+  80179e:	c3                   	ret
+
+000000000080179f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80179f:	55                   	push   %rbp
+  8017a0:	48 89 e5             	mov    %rsp,%rbp
+  8017a3:	48 83 ec 28          	sub    $0x28,%rsp
+  8017a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017a7 <memmove+0x8>
+  8017ae:	49 bb 91 68 00 00 00 	movabs $0x6891,%r11
+  8017b5:	00 00 00 
+  8017b8:	4c 01 d8             	add    %r11,%rax
+  8017bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017bf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017c3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8017c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8017cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8017d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017db:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8017df:	0f 83 88 00 00 00    	jae    80186d <memmove+0xce>
+  8017e5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ed:	48 01 d0             	add    %rdx,%rax
+  8017f0:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8017f4:	73 77                	jae    80186d <memmove+0xce>
+		s += n;
+  8017f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017fa:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8017fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801802:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801806:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180a:	83 e0 03             	and    $0x3,%eax
+  80180d:	48 85 c0             	test   %rax,%rax
+  801810:	75 3b                	jne    80184d <memmove+0xae>
+  801812:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801816:	83 e0 03             	and    $0x3,%eax
+  801819:	48 85 c0             	test   %rax,%rax
+  80181c:	75 2f                	jne    80184d <memmove+0xae>
+  80181e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801822:	83 e0 03             	and    $0x3,%eax
+  801825:	48 85 c0             	test   %rax,%rax
+  801828:	75 23                	jne    80184d <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80182a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80182e:	48 83 e8 04          	sub    $0x4,%rax
+  801832:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801836:	48 83 ea 04          	sub    $0x4,%rdx
+  80183a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80183e:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801842:	48 89 c7             	mov    %rax,%rdi
+  801845:	48 89 d6             	mov    %rdx,%rsi
+  801848:	fd                   	std
+  801849:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80184b:	eb 1d                	jmp    80186a <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80184d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801851:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801859:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  80185d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801861:	48 89 d7             	mov    %rdx,%rdi
+  801864:	48 89 c1             	mov    %rax,%rcx
+  801867:	fd                   	std
+  801868:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80186a:	fc                   	cld
+  80186b:	eb 57                	jmp    8018c4 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80186d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801871:	83 e0 03             	and    $0x3,%eax
+  801874:	48 85 c0             	test   %rax,%rax
+  801877:	75 36                	jne    8018af <memmove+0x110>
+  801879:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80187d:	83 e0 03             	and    $0x3,%eax
+  801880:	48 85 c0             	test   %rax,%rax
+  801883:	75 2a                	jne    8018af <memmove+0x110>
+  801885:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801889:	83 e0 03             	and    $0x3,%eax
+  80188c:	48 85 c0             	test   %rax,%rax
+  80188f:	75 1e                	jne    8018af <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801891:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801895:	48 c1 e8 02          	shr    $0x2,%rax
+  801899:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  80189c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018a4:	48 89 c7             	mov    %rax,%rdi
+  8018a7:	48 89 d6             	mov    %rdx,%rsi
+  8018aa:	fc                   	cld
+  8018ab:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8018ad:	eb 15                	jmp    8018c4 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8018af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018b7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8018bb:	48 89 c7             	mov    %rax,%rdi
+  8018be:	48 89 d6             	mov    %rdx,%rsi
+  8018c1:	fc                   	cld
+  8018c2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8018c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018c8:	c9                   	leave
+  8018c9:	c3                   	ret
+
+00000000008018ca <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8018ca:	55                   	push   %rbp
+  8018cb:	48 89 e5             	mov    %rsp,%rbp
+  8018ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8018d2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018d2 <memcpy+0x8>
+  8018d9:	49 bb 66 67 00 00 00 	movabs $0x6766,%r11
+  8018e0:	00 00 00 
+  8018e3:	4c 01 d8             	add    %r11,%rax
+  8018e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018ee:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8018f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018f6:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8018fa:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8018fe:	48 89 cf             	mov    %rcx,%rdi
+  801901:	48 b9 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rcx
+  801908:	ff ff ff 
+  80190b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80190f:	ff d0                	call   *%rax
+}
+  801911:	c9                   	leave
+  801912:	c3                   	ret
+
+0000000000801913 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801913:	55                   	push   %rbp
+  801914:	48 89 e5             	mov    %rsp,%rbp
+  801917:	48 83 ec 28          	sub    $0x28,%rsp
+  80191b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80191b <memcmp+0x8>
+  801922:	49 bb 1d 67 00 00 00 	movabs $0x671d,%r11
+  801929:	00 00 00 
+  80192c:	4c 01 d8             	add    %r11,%rax
+  80192f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801933:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801937:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80193b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80193f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801943:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801947:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80194b:	eb 34                	jmp    801981 <memcmp+0x6e>
+		if (*s1 != *s2)
+  80194d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801951:	0f b6 10             	movzbl (%rax),%edx
+  801954:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801958:	0f b6 00             	movzbl (%rax),%eax
+  80195b:	38 c2                	cmp    %al,%dl
+  80195d:	74 18                	je     801977 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  80195f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801963:	0f b6 00             	movzbl (%rax),%eax
+  801966:	0f b6 d0             	movzbl %al,%edx
+  801969:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80196d:	0f b6 00             	movzbl (%rax),%eax
+  801970:	0f b6 c0             	movzbl %al,%eax
+  801973:	29 c2                	sub    %eax,%edx
+  801975:	eb 20                	jmp    801997 <memcmp+0x84>
+		s1++, s2++;
+  801977:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80197c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801981:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801985:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801989:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80198d:	48 85 c0             	test   %rax,%rax
+  801990:	75 bb                	jne    80194d <memcmp+0x3a>
+	}
+
+	return 0;
+  801992:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801997:	89 d0                	mov    %edx,%eax
+  801999:	c9                   	leave
+  80199a:	c3                   	ret
+
+000000000080199b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80199b:	55                   	push   %rbp
+  80199c:	48 89 e5             	mov    %rsp,%rbp
+  80199f:	48 83 ec 28          	sub    $0x28,%rsp
+  8019a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019a3 <memfind+0x8>
+  8019aa:	49 bb 95 66 00 00 00 	movabs $0x6695,%r11
+  8019b1:	00 00 00 
+  8019b4:	4c 01 d8             	add    %r11,%rax
+  8019b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019bb:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8019be:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8019c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ca:	48 01 d0             	add    %rdx,%rax
+  8019cd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8019d1:	eb 13                	jmp    8019e6 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8019d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019d7:	0f b6 00             	movzbl (%rax),%eax
+  8019da:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8019dd:	38 d0                	cmp    %dl,%al
+  8019df:	74 11                	je     8019f2 <memfind+0x57>
+	for (; s < ends; s++)
+  8019e1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8019e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ea:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8019ee:	72 e3                	jb     8019d3 <memfind+0x38>
+  8019f0:	eb 01                	jmp    8019f3 <memfind+0x58>
+			break;
+  8019f2:	90                   	nop
+	return (void *) s;
+  8019f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019f7:	c9                   	leave
+  8019f8:	c3                   	ret
+
+00000000008019f9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8019f9:	55                   	push   %rbp
+  8019fa:	48 89 e5             	mov    %rsp,%rbp
+  8019fd:	48 83 ec 38          	sub    $0x38,%rsp
+  801a01:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a01 <strtol+0x8>
+  801a08:	49 bb 37 66 00 00 00 	movabs $0x6637,%r11
+  801a0f:	00 00 00 
+  801a12:	4c 01 d8             	add    %r11,%rax
+  801a15:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a19:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a1d:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801a20:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801a27:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801a2e:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801a2f:	eb 05                	jmp    801a36 <strtol+0x3d>
+		s++;
+  801a31:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801a36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a3a:	0f b6 00             	movzbl (%rax),%eax
+  801a3d:	3c 20                	cmp    $0x20,%al
+  801a3f:	74 f0                	je     801a31 <strtol+0x38>
+  801a41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a45:	0f b6 00             	movzbl (%rax),%eax
+  801a48:	3c 09                	cmp    $0x9,%al
+  801a4a:	74 e5                	je     801a31 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801a4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a50:	0f b6 00             	movzbl (%rax),%eax
+  801a53:	3c 2b                	cmp    $0x2b,%al
+  801a55:	75 07                	jne    801a5e <strtol+0x65>
+		s++;
+  801a57:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a5c:	eb 17                	jmp    801a75 <strtol+0x7c>
+	else if (*s == '-')
+  801a5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a62:	0f b6 00             	movzbl (%rax),%eax
+  801a65:	3c 2d                	cmp    $0x2d,%al
+  801a67:	75 0c                	jne    801a75 <strtol+0x7c>
+		s++, neg = 1;
+  801a69:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a6e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801a75:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a79:	74 06                	je     801a81 <strtol+0x88>
+  801a7b:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801a7f:	75 28                	jne    801aa9 <strtol+0xb0>
+  801a81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a85:	0f b6 00             	movzbl (%rax),%eax
+  801a88:	3c 30                	cmp    $0x30,%al
+  801a8a:	75 1d                	jne    801aa9 <strtol+0xb0>
+  801a8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a90:	48 83 c0 01          	add    $0x1,%rax
+  801a94:	0f b6 00             	movzbl (%rax),%eax
+  801a97:	3c 78                	cmp    $0x78,%al
+  801a99:	75 0e                	jne    801aa9 <strtol+0xb0>
+		s += 2, base = 16;
+  801a9b:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801aa0:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801aa7:	eb 2c                	jmp    801ad5 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801aa9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801aad:	75 19                	jne    801ac8 <strtol+0xcf>
+  801aaf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ab3:	0f b6 00             	movzbl (%rax),%eax
+  801ab6:	3c 30                	cmp    $0x30,%al
+  801ab8:	75 0e                	jne    801ac8 <strtol+0xcf>
+		s++, base = 8;
+  801aba:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801abf:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801ac6:	eb 0d                	jmp    801ad5 <strtol+0xdc>
+	else if (base == 0)
+  801ac8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801acc:	75 07                	jne    801ad5 <strtol+0xdc>
+		base = 10;
+  801ace:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801ad5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad9:	0f b6 00             	movzbl (%rax),%eax
+  801adc:	3c 2f                	cmp    $0x2f,%al
+  801ade:	7e 1d                	jle    801afd <strtol+0x104>
+  801ae0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae4:	0f b6 00             	movzbl (%rax),%eax
+  801ae7:	3c 39                	cmp    $0x39,%al
+  801ae9:	7f 12                	jg     801afd <strtol+0x104>
+			dig = *s - '0';
+  801aeb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aef:	0f b6 00             	movzbl (%rax),%eax
+  801af2:	0f be c0             	movsbl %al,%eax
+  801af5:	83 e8 30             	sub    $0x30,%eax
+  801af8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801afb:	eb 4e                	jmp    801b4b <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801afd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b01:	0f b6 00             	movzbl (%rax),%eax
+  801b04:	3c 60                	cmp    $0x60,%al
+  801b06:	7e 1d                	jle    801b25 <strtol+0x12c>
+  801b08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b0c:	0f b6 00             	movzbl (%rax),%eax
+  801b0f:	3c 7a                	cmp    $0x7a,%al
+  801b11:	7f 12                	jg     801b25 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801b13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b17:	0f b6 00             	movzbl (%rax),%eax
+  801b1a:	0f be c0             	movsbl %al,%eax
+  801b1d:	83 e8 57             	sub    $0x57,%eax
+  801b20:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801b23:	eb 26                	jmp    801b4b <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801b25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b29:	0f b6 00             	movzbl (%rax),%eax
+  801b2c:	3c 40                	cmp    $0x40,%al
+  801b2e:	7e 47                	jle    801b77 <strtol+0x17e>
+  801b30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b34:	0f b6 00             	movzbl (%rax),%eax
+  801b37:	3c 5a                	cmp    $0x5a,%al
+  801b39:	7f 3c                	jg     801b77 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801b3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b3f:	0f b6 00             	movzbl (%rax),%eax
+  801b42:	0f be c0             	movsbl %al,%eax
+  801b45:	83 e8 37             	sub    $0x37,%eax
+  801b48:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801b4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b4e:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801b51:	7d 23                	jge    801b76 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801b53:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b58:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801b5b:	48 98                	cltq
+  801b5d:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801b62:	48 89 c2             	mov    %rax,%rdx
+  801b65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b68:	48 98                	cltq
+  801b6a:	48 01 d0             	add    %rdx,%rax
+  801b6d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801b71:	e9 5f ff ff ff       	jmp    801ad5 <strtol+0xdc>
+			break;
+  801b76:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801b77:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801b7c:	74 0b                	je     801b89 <strtol+0x190>
+		*endptr = (char *) s;
+  801b7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b82:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b86:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801b89:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b8d:	74 09                	je     801b98 <strtol+0x19f>
+  801b8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b93:	48 f7 d8             	neg    %rax
+  801b96:	eb 04                	jmp    801b9c <strtol+0x1a3>
+  801b98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+
+0000000000801b9e <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801b9e:	55                   	push   %rbp
+  801b9f:	48 89 e5             	mov    %rsp,%rbp
+  801ba2:	53                   	push   %rbx
+  801ba3:	48 83 ec 30          	sub    $0x30,%rsp
+  801ba7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801ba7 <strstr+0x9>
+  801bae:	49 bb 91 64 00 00 00 	movabs $0x6491,%r11
+  801bb5:	00 00 00 
+  801bb8:	4c 01 db             	add    %r11,%rbx
+  801bbb:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801bbf:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801bc3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bc7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bcb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801bcf:	0f b6 00             	movzbl (%rax),%eax
+  801bd2:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801bd5:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801bd9:	75 06                	jne    801be1 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801bdb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bdf:	eb 73                	jmp    801c54 <strstr+0xb6>
+
+	len = strlen(str);
+  801be1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801be5:	48 89 c7             	mov    %rax,%rdi
+  801be8:	48 b8 f3 92 ff ff ff 	movabs $0xffffffffffff92f3,%rax
+  801bef:	ff ff ff 
+  801bf2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801bf6:	ff d0                	call   *%rax
+  801bf8:	48 98                	cltq
+  801bfa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801bfe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c02:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c06:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801c0a:	0f b6 00             	movzbl (%rax),%eax
+  801c0d:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801c10:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801c14:	75 07                	jne    801c1d <strstr+0x7f>
+				return (char *) 0;
+  801c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1b:	eb 37                	jmp    801c54 <strstr+0xb6>
+		} while (sc != c);
+  801c1d:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801c21:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801c24:	75 d8                	jne    801bfe <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801c26:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c2a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c2e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c32:	48 89 ce             	mov    %rcx,%rsi
+  801c35:	48 89 c7             	mov    %rax,%rdi
+  801c38:	48 b8 a7 95 ff ff ff 	movabs $0xffffffffffff95a7,%rax
+  801c3f:	ff ff ff 
+  801c42:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c46:	ff d0                	call   *%rax
+  801c48:	85 c0                	test   %eax,%eax
+  801c4a:	75 b2                	jne    801bfe <strstr+0x60>
+
+	return (char *) (in - 1);
+  801c4c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c50:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801c54:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c58:	c9                   	leave
+  801c59:	c3                   	ret
+
+0000000000801c5a <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801c5a:	55                   	push   %rbp
+  801c5b:	48 89 e5             	mov    %rsp,%rbp
+  801c5e:	41 57                	push   %r15
+  801c60:	53                   	push   %rbx
+  801c61:	48 83 ec 40          	sub    $0x40,%rsp
+  801c65:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801c65 <syscall+0xb>
+  801c6c:	49 bb d3 63 00 00 00 	movabs $0x63d3,%r11
+  801c73:	00 00 00 
+  801c76:	4d 01 da             	add    %r11,%r10
+  801c79:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801c7c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801c7f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801c83:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c87:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801c8b:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801c8f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801c92:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801c96:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c9a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801c9e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801ca2:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ca6:	4c 89 c3             	mov    %r8,%rbx
+  801ca9:	cd 30                	int    $0x30
+  801cab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801caf:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801cb3:	74 52                	je     801d07 <syscall+0xad>
+  801cb5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801cba:	7e 4b                	jle    801d07 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801cbc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cc0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801cc3:	49 89 d0             	mov    %rdx,%r8
+  801cc6:	89 c1                	mov    %eax,%ecx
+  801cc8:	48 b8 b0 e5 ff ff ff 	movabs $0xffffffffffffe5b0,%rax
+  801ccf:	ff ff ff 
+  801cd2:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801cd6:	48 89 c2             	mov    %rax,%rdx
+  801cd9:	be 23 00 00 00       	mov    $0x23,%esi
+  801cde:	48 b8 cd e5 ff ff ff 	movabs $0xffffffffffffe5cd,%rax
+  801ce5:	ff ff ff 
+  801ce8:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801cec:	48 89 c7             	mov    %rax,%rdi
+  801cef:	4d 89 d7             	mov    %r10,%r15
+  801cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf7:	49 b9 ee 82 ff ff ff 	movabs $0xffffffffffff82ee,%r9
+  801cfe:	ff ff ff 
+  801d01:	4d 01 d1             	add    %r10,%r9
+  801d04:	41 ff d1             	call   *%r9
+
+	return ret;
+  801d07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d0b:	48 83 c4 40          	add    $0x40,%rsp
+  801d0f:	5b                   	pop    %rbx
+  801d10:	41 5f                	pop    %r15
+  801d12:	5d                   	pop    %rbp
+  801d13:	c3                   	ret
+
+0000000000801d14 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801d14:	55                   	push   %rbp
+  801d15:	48 89 e5             	mov    %rsp,%rbp
+  801d18:	41 57                	push   %r15
+  801d1a:	41 56                	push   %r14
+  801d1c:	41 55                	push   %r13
+  801d1e:	41 54                	push   %r12
+  801d20:	53                   	push   %rbx
+  801d21:	48 83 ec 48          	sub    $0x48,%rsp
+  801d25:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801d25 <syscall_words+0x11>
+  801d2c:	49 bb 13 63 00 00 00 	movabs $0x6313,%r11
+  801d33:	00 00 00 
+  801d36:	4d 01 de             	add    %r11,%r14
+  801d39:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801d3c:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801d3f:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801d43:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801d47:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801d4b:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801d4f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d54:	74 09                	je     801d5f <syscall_words+0x4b>
+  801d56:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d5a:	48 8b 00             	mov    (%rax),%rax
+  801d5d:	eb 05                	jmp    801d64 <syscall_words+0x50>
+  801d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d64:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801d67:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d6c:	74 0a                	je     801d78 <syscall_words+0x64>
+  801d6e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d72:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d76:	eb 05                	jmp    801d7d <syscall_words+0x69>
+  801d78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7d:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801d80:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d85:	74 0a                	je     801d91 <syscall_words+0x7d>
+  801d87:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d8b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d8f:	eb 05                	jmp    801d96 <syscall_words+0x82>
+  801d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d96:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801d99:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d9e:	74 0a                	je     801daa <syscall_words+0x96>
+  801da0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801da4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801da8:	eb 05                	jmp    801daf <syscall_words+0x9b>
+  801daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801daf:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801db2:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801db7:	74 0a                	je     801dc3 <syscall_words+0xaf>
+  801db9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dbd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801dc1:	eb 05                	jmp    801dc8 <syscall_words+0xb4>
+  801dc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc8:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801dcb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dd0:	74 0a                	je     801ddc <syscall_words+0xc8>
+  801dd2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dd6:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801dda:	eb 05                	jmp    801de1 <syscall_words+0xcd>
+  801ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de1:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801de4:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801de7:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801deb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801def:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801df3:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801df7:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801dfb:	cd 30                	int    $0x30
+  801dfd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801e01:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e06:	74 50                	je     801e58 <syscall_words+0x144>
+		words[0] = r8;
+  801e08:	4c 89 c2             	mov    %r8,%rdx
+  801e0b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e0f:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801e12:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e16:	48 83 c0 08          	add    $0x8,%rax
+  801e1a:	4c 89 ca             	mov    %r9,%rdx
+  801e1d:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801e20:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e24:	48 83 c0 10          	add    $0x10,%rax
+  801e28:	4c 89 d2             	mov    %r10,%rdx
+  801e2b:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801e2e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e32:	48 83 c0 18          	add    $0x18,%rax
+  801e36:	4c 89 da             	mov    %r11,%rdx
+  801e39:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801e3c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e40:	48 83 c0 20          	add    $0x20,%rax
+  801e44:	4c 89 e2             	mov    %r12,%rdx
+  801e47:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801e4a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e4e:	48 83 c0 28          	add    $0x28,%rax
+  801e52:	4c 89 ea             	mov    %r13,%rdx
+  801e55:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801e58:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801e5c:	74 52                	je     801eb0 <syscall_words+0x19c>
+  801e5e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e63:	7e 4b                	jle    801eb0 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e65:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e69:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801e6c:	49 89 d0             	mov    %rdx,%r8
+  801e6f:	89 c1                	mov    %eax,%ecx
+  801e71:	48 b8 b0 e5 ff ff ff 	movabs $0xffffffffffffe5b0,%rax
+  801e78:	ff ff ff 
+  801e7b:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801e7f:	48 89 c2             	mov    %rax,%rdx
+  801e82:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801e87:	48 b8 cd e5 ff ff ff 	movabs $0xffffffffffffe5cd,%rax
+  801e8e:	ff ff ff 
+  801e91:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801e95:	48 89 c7             	mov    %rax,%rdi
+  801e98:	4d 89 f7             	mov    %r14,%r15
+  801e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea0:	49 b9 ee 82 ff ff ff 	movabs $0xffffffffffff82ee,%r9
+  801ea7:	ff ff ff 
+  801eaa:	4d 01 f1             	add    %r14,%r9
+  801ead:	41 ff d1             	call   *%r9
+
+	return ret;
+  801eb0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801eb4:	48 83 c4 48          	add    $0x48,%rsp
+  801eb8:	5b                   	pop    %rbx
+  801eb9:	41 5c                	pop    %r12
+  801ebb:	41 5d                	pop    %r13
+  801ebd:	41 5e                	pop    %r14
+  801ebf:	41 5f                	pop    %r15
+  801ec1:	5d                   	pop    %rbp
+  801ec2:	c3                   	ret
+
+0000000000801ec3 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801ec3:	55                   	push   %rbp
+  801ec4:	48 89 e5             	mov    %rsp,%rbp
+  801ec7:	48 83 ec 10          	sub    $0x10,%rsp
+  801ecb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ecb <sys_cputs+0x8>
+  801ed2:	49 bb 6d 61 00 00 00 	movabs $0x616d,%r11
+  801ed9:	00 00 00 
+  801edc:	4c 01 d8             	add    %r11,%rax
+  801edf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ee3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801ee7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801eeb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801eef:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef3:	6a 00                	push   $0x0
+  801ef5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801efb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f01:	be 00 00 00 00       	mov    $0x0,%esi
+  801f06:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0b:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  801f12:	ff ff ff 
+  801f15:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f19:	ff d0                	call   *%rax
+  801f1b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f1f:	90                   	nop
+  801f20:	c9                   	leave
+  801f21:	c3                   	ret
+
+0000000000801f22 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801f22:	55                   	push   %rbp
+  801f23:	48 89 e5             	mov    %rsp,%rbp
+  801f26:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f26 <sys_cgetc+0x4>
+  801f2d:	49 bb 12 61 00 00 00 	movabs $0x6112,%r11
+  801f34:	00 00 00 
+  801f37:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801f3a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f3e:	6a 00                	push   $0x0
+  801f40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f46:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f56:	be 00 00 00 00       	mov    $0x0,%esi
+  801f5b:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f60:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  801f67:	ff ff ff 
+  801f6a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f6e:	ff d0                	call   *%rax
+  801f70:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f74:	c9                   	leave
+  801f75:	c3                   	ret
+
+0000000000801f76 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801f76:	55                   	push   %rbp
+  801f77:	48 89 e5             	mov    %rsp,%rbp
+  801f7a:	48 83 ec 10          	sub    $0x10,%rsp
+  801f7e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f7e <sys_env_destroy+0x8>
+  801f85:	49 bb ba 60 00 00 00 	movabs $0x60ba,%r11
+  801f8c:	00 00 00 
+  801f8f:	4c 01 d8             	add    %r11,%rax
+  801f92:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801f95:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f98:	48 63 d2             	movslq %edx,%rdx
+  801f9b:	48 83 ec 08          	sub    $0x8,%rsp
+  801f9f:	6a 00                	push   $0x0
+  801fa1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fb2:	be 01 00 00 00       	mov    $0x1,%esi
+  801fb7:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fbc:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  801fc3:	ff ff ff 
+  801fc6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fca:	ff d0                	call   *%rax
+  801fcc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fd0:	c9                   	leave
+  801fd1:	c3                   	ret
+
+0000000000801fd2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801fd2:	55                   	push   %rbp
+  801fd3:	48 89 e5             	mov    %rsp,%rbp
+  801fd6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fd6 <sys_getenvid+0x4>
+  801fdd:	49 bb 62 60 00 00 00 	movabs $0x6062,%r11
+  801fe4:	00 00 00 
+  801fe7:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801fea:	48 83 ec 08          	sub    $0x8,%rsp
+  801fee:	6a 00                	push   $0x0
+  801ff0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ff6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ffc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802001:	ba 00 00 00 00       	mov    $0x0,%edx
+  802006:	be 00 00 00 00       	mov    $0x0,%esi
+  80200b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802010:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802017:	ff ff ff 
+  80201a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80201e:	ff d0                	call   *%rax
+  802020:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802024:	c9                   	leave
+  802025:	c3                   	ret
+
+0000000000802026 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802026:	55                   	push   %rbp
+  802027:	48 89 e5             	mov    %rsp,%rbp
+  80202a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80202a <sys_yield+0x4>
+  802031:	49 bb 0e 60 00 00 00 	movabs $0x600e,%r11
+  802038:	00 00 00 
+  80203b:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80203e:	48 83 ec 08          	sub    $0x8,%rsp
+  802042:	6a 00                	push   $0x0
+  802044:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80204a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802050:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802055:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205a:	be 00 00 00 00       	mov    $0x0,%esi
+  80205f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802064:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  80206b:	ff ff ff 
+  80206e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802072:	ff d0                	call   *%rax
+  802074:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802078:	90                   	nop
+  802079:	c9                   	leave
+  80207a:	c3                   	ret
+
+000000000080207b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80207b:	55                   	push   %rbp
+  80207c:	48 89 e5             	mov    %rsp,%rbp
+  80207f:	48 83 ec 10          	sub    $0x10,%rsp
+  802083:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802083 <sys_page_alloc+0x8>
+  80208a:	49 bb b5 5f 00 00 00 	movabs $0x5fb5,%r11
+  802091:	00 00 00 
+  802094:	4c 01 d8             	add    %r11,%rax
+  802097:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80209a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80209e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8020a1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020a4:	48 63 f2             	movslq %edx,%rsi
+  8020a7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020ab:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020ae:	48 63 d2             	movslq %edx,%rdx
+  8020b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b5:	6a 00                	push   $0x0
+  8020b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020bd:	49 89 f0             	mov    %rsi,%r8
+  8020c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8020c5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8020ca:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  8020d1:	ff ff ff 
+  8020d4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020d8:	ff d0                	call   *%rax
+  8020da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020de:	c9                   	leave
+  8020df:	c3                   	ret
+
+00000000008020e0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8020e0:	55                   	push   %rbp
+  8020e1:	48 89 e5             	mov    %rsp,%rbp
+  8020e4:	48 83 ec 20          	sub    $0x20,%rsp
+  8020e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020e8 <sys_page_map+0x8>
+  8020ef:	49 bb 50 5f 00 00 00 	movabs $0x5f50,%r11
+  8020f6:	00 00 00 
+  8020f9:	4c 01 d8             	add    %r11,%rax
+  8020fc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802103:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802106:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80210a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80210e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802111:	48 63 f2             	movslq %edx,%rsi
+  802114:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802118:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80211b:	48 63 fa             	movslq %edx,%rdi
+  80211e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802122:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802125:	48 63 d2             	movslq %edx,%rdx
+  802128:	48 83 ec 08          	sub    $0x8,%rsp
+  80212c:	56                   	push   %rsi
+  80212d:	4d 89 c1             	mov    %r8,%r9
+  802130:	49 89 f8             	mov    %rdi,%r8
+  802133:	be 01 00 00 00       	mov    $0x1,%esi
+  802138:	bf 05 00 00 00       	mov    $0x5,%edi
+  80213d:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802144:	ff ff ff 
+  802147:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80214b:	ff d0                	call   *%rax
+  80214d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802151:	c9                   	leave
+  802152:	c3                   	ret
+
+0000000000802153 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802153:	55                   	push   %rbp
+  802154:	48 89 e5             	mov    %rsp,%rbp
+  802157:	48 83 ec 10          	sub    $0x10,%rsp
+  80215b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80215b <sys_page_unmap+0x8>
+  802162:	49 bb dd 5e 00 00 00 	movabs $0x5edd,%r11
+  802169:	00 00 00 
+  80216c:	4c 01 d8             	add    %r11,%rax
+  80216f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802172:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802176:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80217a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80217d:	48 63 d2             	movslq %edx,%rdx
+  802180:	48 83 ec 08          	sub    $0x8,%rsp
+  802184:	6a 00                	push   $0x0
+  802186:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80218c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802192:	be 01 00 00 00       	mov    $0x1,%esi
+  802197:	bf 06 00 00 00       	mov    $0x6,%edi
+  80219c:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  8021a3:	ff ff ff 
+  8021a6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021aa:	ff d0                	call   *%rax
+  8021ac:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021b0:	c9                   	leave
+  8021b1:	c3                   	ret
+
+00000000008021b2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8021b2:	55                   	push   %rbp
+  8021b3:	48 89 e5             	mov    %rsp,%rbp
+  8021b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021ba <sys_env_set_status+0x8>
+  8021c1:	49 bb 7e 5e 00 00 00 	movabs $0x5e7e,%r11
+  8021c8:	00 00 00 
+  8021cb:	4c 01 d8             	add    %r11,%rax
+  8021ce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021d1:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8021d4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021d7:	48 63 ca             	movslq %edx,%rcx
+  8021da:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021dd:	48 63 d2             	movslq %edx,%rdx
+  8021e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e4:	6a 00                	push   $0x0
+  8021e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8021f7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021fc:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802203:	ff ff ff 
+  802206:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80220a:	ff d0                	call   *%rax
+  80220c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+
+0000000000802212 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802212:	55                   	push   %rbp
+  802213:	48 89 e5             	mov    %rsp,%rbp
+  802216:	48 83 ec 10          	sub    $0x10,%rsp
+  80221a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80221a <sys_env_set_trapframe+0x8>
+  802221:	49 bb 1e 5e 00 00 00 	movabs $0x5e1e,%r11
+  802228:	00 00 00 
+  80222b:	4c 01 d8             	add    %r11,%rax
+  80222e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802231:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802235:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802239:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80223c:	48 63 d2             	movslq %edx,%rdx
+  80223f:	48 83 ec 08          	sub    $0x8,%rsp
+  802243:	6a 00                	push   $0x0
+  802245:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80224b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802251:	be 01 00 00 00       	mov    $0x1,%esi
+  802256:	bf 09 00 00 00       	mov    $0x9,%edi
+  80225b:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802262:	ff ff ff 
+  802265:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802269:	ff d0                	call   *%rax
+  80226b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80226f:	c9                   	leave
+  802270:	c3                   	ret
+
+0000000000802271 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802271:	55                   	push   %rbp
+  802272:	48 89 e5             	mov    %rsp,%rbp
+  802275:	48 83 ec 10          	sub    $0x10,%rsp
+  802279:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802279 <sys_env_set_pgfault_upcall+0x8>
+  802280:	49 bb bf 5d 00 00 00 	movabs $0x5dbf,%r11
+  802287:	00 00 00 
+  80228a:	4c 01 d8             	add    %r11,%rax
+  80228d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802290:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802294:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802298:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80229b:	48 63 d2             	movslq %edx,%rdx
+  80229e:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a2:	6a 00                	push   $0x0
+  8022a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8022b5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8022ba:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  8022c1:	ff ff ff 
+  8022c4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c8:	ff d0                	call   *%rax
+  8022ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ce:	c9                   	leave
+  8022cf:	c3                   	ret
+
+00000000008022d0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8022d0:	55                   	push   %rbp
+  8022d1:	48 89 e5             	mov    %rsp,%rbp
+  8022d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8022d8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d8 <sys_ipc_try_send+0x8>
+  8022df:	49 bb 60 5d 00 00 00 	movabs $0x5d60,%r11
+  8022e6:	00 00 00 
+  8022e9:	4c 01 d8             	add    %r11,%rax
+  8022ec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022f3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8022f7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8022fa:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022fd:	48 63 fa             	movslq %edx,%rdi
+  802300:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802304:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802307:	48 63 d2             	movslq %edx,%rdx
+  80230a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80230e:	48 83 ec 08          	sub    $0x8,%rsp
+  802312:	6a 00                	push   $0x0
+  802314:	49 89 f9             	mov    %rdi,%r9
+  802317:	49 89 f0             	mov    %rsi,%r8
+  80231a:	be 00 00 00 00       	mov    $0x0,%esi
+  80231f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802324:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  80232b:	ff ff ff 
+  80232e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802332:	ff d0                	call   *%rax
+  802334:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802338:	c9                   	leave
+  802339:	c3                   	ret
+
+000000000080233a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80233a:	55                   	push   %rbp
+  80233b:	48 89 e5             	mov    %rsp,%rbp
+  80233e:	48 83 ec 20          	sub    $0x20,%rsp
+  802342:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802342 <sys_ipc_send+0x8>
+  802349:	49 bb f6 5c 00 00 00 	movabs $0x5cf6,%r11
+  802350:	00 00 00 
+  802353:	4c 01 d8             	add    %r11,%rax
+  802356:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802359:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80235d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802361:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802364:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802367:	48 63 fa             	movslq %edx,%rdi
+  80236a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80236e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802371:	48 63 d2             	movslq %edx,%rdx
+  802374:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802378:	48 83 ec 08          	sub    $0x8,%rsp
+  80237c:	6a 00                	push   $0x0
+  80237e:	49 89 f9             	mov    %rdi,%r9
+  802381:	49 89 f0             	mov    %rsi,%r8
+  802384:	be 00 00 00 00       	mov    $0x0,%esi
+  802389:	bf 17 00 00 00       	mov    $0x17,%edi
+  80238e:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802395:	ff ff ff 
+  802398:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80239c:	ff d0                	call   *%rax
+  80239e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a2:	c9                   	leave
+  8023a3:	c3                   	ret
+
+00000000008023a4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8023a4:	55                   	push   %rbp
+  8023a5:	48 89 e5             	mov    %rsp,%rbp
+  8023a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8023ac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023ac <sys_ipc_recv+0x8>
+  8023b3:	49 bb 8c 5c 00 00 00 	movabs $0x5c8c,%r11
+  8023ba:	00 00 00 
+  8023bd:	4c 01 d8             	add    %r11,%rax
+  8023c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8023c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8023c8:	6a 00                	push   $0x0
+  8023ca:	6a 00                	push   $0x0
+  8023cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023dd:	be 01 00 00 00       	mov    $0x1,%esi
+  8023e2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8023e7:	49 ba dc 9c ff ff ff 	movabs $0xffffffffffff9cdc,%r10
+  8023ee:	ff ff ff 
+  8023f1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023f5:	ff d0                	call   *%rax
+  8023f7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023fb:	c9                   	leave
+  8023fc:	c3                   	ret
+
+00000000008023fd <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8023fd:	55                   	push   %rbp
+  8023fe:	48 89 e5             	mov    %rsp,%rbp
+  802401:	48 83 ec 30          	sub    $0x30,%rsp
+  802405:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802405 <sys_ipc_call+0x8>
+  80240c:	49 bb 33 5c 00 00 00 	movabs $0x5c33,%r11
+  802413:	00 00 00 
+  802416:	4c 01 d8             	add    %r11,%rax
+  802419:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80241c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802420:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802424:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802427:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80242b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80242f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802433:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802436:	4c 63 c2             	movslq %edx,%r8
+  802439:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80243d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802440:	48 63 d2             	movslq %edx,%rdx
+  802443:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802447:	ff 75 d8             	push   -0x28(%rbp)
+  80244a:	56                   	push   %rsi
+  80244b:	4d 89 c1             	mov    %r8,%r9
+  80244e:	49 89 f8             	mov    %rdi,%r8
+  802451:	be 00 00 00 00       	mov    $0x0,%esi
+  802456:	bf 18 00 00 00       	mov    $0x18,%edi
+  80245b:	49 ba dc 9c ff ff ff 	movabs $0xffffffffffff9cdc,%r10
+  802462:	ff ff ff 
+  802465:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802469:	ff d0                	call   *%rax
+  80246b:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80246f:	c9                   	leave
+  802470:	c3                   	ret
+
+0000000000802471 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802471:	55                   	push   %rbp
+  802472:	48 89 e5             	mov    %rsp,%rbp
+  802475:	48 83 ec 30          	sub    $0x30,%rsp
+  802479:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802479 <sys_ipc_reply_recv+0x8>
+  802480:	49 bb bf 5b 00 00 00 	movabs $0x5bbf,%r11
+  802487:	00 00 00 
+  80248a:	4c 01 d8             	add    %r11,%rax
+  80248d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802490:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802494:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802498:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80249b:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80249f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8024a3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8024a7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024aa:	4c 63 c2             	movslq %edx,%r8
+  8024ad:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8024b1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024b4:	48 63 d2             	movslq %edx,%rdx
+  8024b7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024bb:	ff 75 d8             	push   -0x28(%rbp)
+  8024be:	56                   	push   %rsi
+  8024bf:	4d 89 c1             	mov    %r8,%r9
+  8024c2:	49 89 f8             	mov    %rdi,%r8
+  8024c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ca:	bf 19 00 00 00       	mov    $0x19,%edi
+  8024cf:	49 ba dc 9c ff ff ff 	movabs $0xffffffffffff9cdc,%r10
+  8024d6:	ff ff ff 
+  8024d9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024dd:	ff d0                	call   *%rax
+  8024df:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8024e3:	c9                   	leave
+  8024e4:	c3                   	ret
+
+00000000008024e5 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024ed <sys_env_set_priority+0x8>
+  8024f4:	49 bb 4b 5b 00 00 00 	movabs $0x5b4b,%r11
+  8024fb:	00 00 00 
+  8024fe:	4c 01 d8             	add    %r11,%rax
+  802501:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802504:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802507:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80250a:	48 63 ca             	movslq %edx,%rcx
+  80250d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802510:	48 63 d2             	movslq %edx,%rdx
+  802513:	48 83 ec 08          	sub    $0x8,%rsp
+  802517:	6a 00                	push   $0x0
+  802519:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80251f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802525:	be 01 00 00 00       	mov    $0x1,%esi
+  80252a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80252f:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802536:	ff ff ff 
+  802539:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80253d:	ff d0                	call   *%rax
+  80253f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802543:	c9                   	leave
+  802544:	c3                   	ret
+
+0000000000802545 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802545:	55                   	push   %rbp
+  802546:	48 89 e5             	mov    %rsp,%rbp
+  802549:	48 83 ec 10          	sub    $0x10,%rsp
+  80254d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80254d <sys_env_set_affinity+0x8>
+  802554:	49 bb eb 5a 00 00 00 	movabs $0x5aeb,%r11
+  80255b:	00 00 00 
+  80255e:	4c 01 d8             	add    %r11,%rax
+  802561:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802564:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802567:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  80256a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80256d:	48 63 d2             	movslq %edx,%rdx
+  802570:	48 83 ec 08          	sub    $0x8,%rsp
+  802574:	6a 00                	push   $0x0
+  802576:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80257c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802582:	be 01 00 00 00       	mov    $0x1,%esi
+  802587:	bf 10 00 00 00       	mov    $0x10,%edi
+  80258c:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802593:	ff ff ff 
+  802596:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80259a:	ff d0                	call   *%rax
+  80259c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a0:	c9                   	leave
+  8025a1:	c3                   	ret
+
+00000000008025a2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8025a2:	55                   	push   %rbp
+  8025a3:	48 89 e5             	mov    %rsp,%rbp
+  8025a6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025a6 <sys_time_msec+0x4>
+  8025ad:	49 bb 92 5a 00 00 00 	movabs $0x5a92,%r11
+  8025b4:	00 00 00 
+  8025b7:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8025ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8025be:	6a 00                	push   $0x0
+  8025c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8025db:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8025e0:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  8025e7:	ff ff ff 
+  8025ea:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025ee:	ff d0                	call   *%rax
+  8025f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f4:	c9                   	leave
+  8025f5:	c3                   	ret
+
+00000000008025f6 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8025f6:	55                   	push   %rbp
+  8025f7:	48 89 e5             	mov    %rsp,%rbp
+  8025fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8025fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025fe <sys_sleep_usec+0x8>
+  802605:	49 bb 3a 5a 00 00 00 	movabs $0x5a3a,%r11
+  80260c:	00 00 00 
+  80260f:	4c 01 d8             	add    %r11,%rax
+  802612:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802616:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80261a:	48 83 ec 08          	sub    $0x8,%rsp
+  80261e:	6a 00                	push   $0x0
+  802620:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802626:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80262c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802631:	be 00 00 00 00       	mov    $0x0,%esi
+  802636:	bf 11 00 00 00       	mov    $0x11,%edi
+  80263b:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802642:	ff ff ff 
+  802645:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802649:	ff d0                	call   *%rax
+  80264b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80264f:	c9                   	leave
+  802650:	c3                   	ret
+
+0000000000802651 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802651:	55                   	push   %rbp
+  802652:	48 89 e5             	mov    %rsp,%rbp
+  802655:	48 83 ec 10          	sub    $0x10,%rsp
+  802659:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802659 <sys_page_alloc_huge+0x8>
+  802660:	49 bb df 59 00 00 00 	movabs $0x59df,%r11
+  802667:	00 00 00 
+  80266a:	4c 01 d8             	add    %r11,%rax
+  80266d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802670:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802674:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802677:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80267a:	48 63 f2             	movslq %edx,%rsi
+  80267d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802681:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802684:	48 63 d2             	movslq %edx,%rdx
+  802687:	48 83 ec 08          	sub    $0x8,%rsp
+  80268b:	6a 00                	push   $0x0
+  80268d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802693:	49 89 f0             	mov    %rsi,%r8
+  802696:	be 01 00 00 00       	mov    $0x1,%esi
+  80269b:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026a0:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  8026a7:	ff ff ff 
+  8026aa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026ae:	ff d0                	call   *%rax
+  8026b0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b4:	c9                   	leave
+  8026b5:	c3                   	ret
+
+00000000008026b6 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8026b6:	55                   	push   %rbp
+  8026b7:	48 89 e5             	mov    %rsp,%rbp
+  8026ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8026be:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026be <sys_page_map_batch+0x8>
+  8026c5:	49 bb 7a 59 00 00 00 	movabs $0x597a,%r11
+  8026cc:	00 00 00 
+  8026cf:	4c 01 d8             	add    %r11,%rax
+  8026d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8026da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026de:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e6:	6a 00                	push   $0x0
+  8026e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026f4:	be 01 00 00 00       	mov    $0x1,%esi
+  8026f9:	bf 13 00 00 00       	mov    $0x13,%edi
+  8026fe:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802705:	ff ff ff 
+  802708:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80270c:	ff d0                	call   *%rax
+  80270e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802712:	c9                   	leave
+  802713:	c3                   	ret
+
+0000000000802714 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802714:	55                   	push   %rbp
+  802715:	48 89 e5             	mov    %rsp,%rbp
+  802718:	48 83 ec 10          	sub    $0x10,%rsp
+  80271c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80271c <sys_page_alloc_batch+0x8>
+  802723:	49 bb 1c 59 00 00 00 	movabs $0x591c,%r11
+  80272a:	00 00 00 
+  80272d:	4c 01 d8             	add    %r11,%rax
+  802730:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802734:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802738:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80273c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802740:	48 83 ec 08          	sub    $0x8,%rsp
+  802744:	6a 00                	push   $0x0
+  802746:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80274c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802752:	be 01 00 00 00       	mov    $0x1,%esi
+  802757:	bf 14 00 00 00       	mov    $0x14,%edi
+  80275c:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802763:	ff ff ff 
+  802766:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80276a:	ff d0                	call   *%rax
+  80276c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802770:	c9                   	leave
+  802771:	c3                   	ret
+
+0000000000802772 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802772:	55                   	push   %rbp
+  802773:	48 89 e5             	mov    %rsp,%rbp
+  802776:	48 83 ec 10          	sub    $0x10,%rsp
+  80277a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80277a <sys_page_unmap_batch+0x8>
+  802781:	49 bb be 58 00 00 00 	movabs $0x58be,%r11
+  802788:	00 00 00 
+  80278b:	4c 01 d8             	add    %r11,%rax
+  80278e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802792:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802796:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80279a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80279e:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a2:	6a 00                	push   $0x0
+  8027a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8027b5:	bf 15 00 00 00       	mov    $0x15,%edi
+  8027ba:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  8027c1:	ff ff ff 
+  8027c4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027c8:	ff d0                	call   *%rax
+  8027ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027ce:	c9                   	leave
+  8027cf:	c3                   	ret
+
+00000000008027d0 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8027d0:	55                   	push   %rbp
+  8027d1:	48 89 e5             	mov    %rsp,%rbp
+  8027d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027d4 <sys_fork+0x4>
+  8027db:	49 bb 64 58 00 00 00 	movabs $0x5864,%r11
+  8027e2:	00 00 00 
+  8027e5:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8027e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ec:	6a 00                	push   $0x0
+  8027ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802804:	be 00 00 00 00       	mov    $0x0,%esi
+  802809:	bf 16 00 00 00       	mov    $0x16,%edi
+  80280e:	49 ba 22 9c ff ff ff 	movabs $0xffffffffffff9c22,%r10
+  802815:	ff ff ff 
+  802818:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80281c:	ff d0                	call   *%rax
+  80281e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802822:	c9                   	leave
+  802823:	c3                   	ret
+
+0000000000802824 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802824:	55                   	push   %rbp
+  802825:	48 89 e5             	mov    %rsp,%rbp
+  802828:	41 57                	push   %r15
+  80282a:	53                   	push   %rbx
+  80282b:	48 83 ec 20          	sub    $0x20,%rsp
+  80282f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80282f <set_pgfault_handler+0xb>
+  802836:	49 bb 09 58 00 00 00 	movabs $0x5809,%r11
+  80283d:	00 00 00 
+  802840:	4c 01 db             	add    %r11,%rbx
+  802843:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  802847:	49 89 df             	mov    %rbx,%r15
+  80284a:	48 b8 9a 9f ff ff ff 	movabs $0xffffffffffff9f9a,%rax
+  802851:	ff ff ff 
+  802854:	48 01 d8             	add    %rbx,%rax
+  802857:	ff d0                	call   *%rax
+  802859:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  80285c:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  802863:	00 00 00 
+  802866:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80286a:	48 85 c0             	test   %rax,%rax
+  80286d:	75 6b                	jne    8028da <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  80286f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802872:	ba 07 00 00 00       	mov    $0x7,%edx
+  802877:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80287c:	48 89 ce             	mov    %rcx,%rsi
+  80287f:	89 c7                	mov    %eax,%edi
+  802881:	49 89 df             	mov    %rbx,%r15
+  802884:	48 b8 43 a0 ff ff ff 	movabs $0xffffffffffffa043,%rax
+  80288b:	ff ff ff 
+  80288e:	48 01 d8             	add    %rbx,%rax
+  802891:	ff d0                	call   *%rax
+  802893:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  802896:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80289a:	74 3e                	je     8028da <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  80289c:	48 b8 e0 e5 ff ff ff 	movabs $0xffffffffffffe5e0,%rax
+  8028a3:	ff ff ff 
+  8028a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8028aa:	48 89 c2             	mov    %rax,%rdx
+  8028ad:	be 23 00 00 00       	mov    $0x23,%esi
+  8028b2:	48 b8 0e e6 ff ff ff 	movabs $0xffffffffffffe60e,%rax
+  8028b9:	ff ff ff 
+  8028bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8028c0:	48 89 c7             	mov    %rax,%rdi
+  8028c3:	49 89 df             	mov    %rbx,%r15
+  8028c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028cb:	48 b9 ee 82 ff ff ff 	movabs $0xffffffffffff82ee,%rcx
+  8028d2:	ff ff ff 
+  8028d5:	48 01 d9             	add    %rbx,%rcx
+  8028d8:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8028da:	48 ba d8 1f 01 00 00 	movabs $0x11fd8,%rdx
+  8028e1:	00 00 00 
+  8028e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028e8:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  8028ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028ef:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8028f6:	ff ff ff 
+  8028f9:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8028fd:	48 89 d6             	mov    %rdx,%rsi
+  802900:	89 c7                	mov    %eax,%edi
+  802902:	49 89 df             	mov    %rbx,%r15
+  802905:	48 b8 39 a2 ff ff ff 	movabs $0xffffffffffffa239,%rax
+  80290c:	ff ff ff 
+  80290f:	48 01 d8             	add    %rbx,%rax
+  802912:	ff d0                	call   *%rax
+}
+  802914:	90                   	nop
+  802915:	48 83 c4 20          	add    $0x20,%rsp
+  802919:	5b                   	pop    %rbx
+  80291a:	41 5f                	pop    %r15
+  80291c:	5d                   	pop    %rbp
+  80291d:	c3                   	ret
+
+000000000080291e <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  80291e:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  802921:	48 a1 10 a0 81 00 00 	movabs 0x81a010,%rax
+  802928:	00 00 00 
+call *%rax
+  80292b:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  80292d:	58                   	pop    %rax
+	popq %rax;
+  80292e:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  80292f:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  802936:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  80293a:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  80293e:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  802942:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  802946:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  80294a:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  80294d:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  802951:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802955:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80295a:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80295f:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802964:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802969:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80296e:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802973:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802978:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80297d:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802982:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802987:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80298c:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802991:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802996:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80299b:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  80299f:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  8029a3:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  8029a4:	5c                   	pop    %rsp
+	ret;			//return
+  8029a5:	c3                   	ret
+
+00000000008029a6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  8029a6:	55                   	push   %rbp
+  8029a7:	48 89 e5             	mov    %rsp,%rbp
+  8029aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029ae <fd2num+0x8>
+  8029b5:	49 bb 8a 56 00 00 00 	movabs $0x568a,%r11
+  8029bc:	00 00 00 
+  8029bf:	4c 01 d8             	add    %r11,%rax
+  8029c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8029c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029ca:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8029d1:	ff ff ff 
+  8029d4:	48 01 d0             	add    %rdx,%rax
+  8029d7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8029db:	c9                   	leave
+  8029dc:	c3                   	ret
+
+00000000008029dd <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8029dd:	55                   	push   %rbp
+  8029de:	48 89 e5             	mov    %rsp,%rbp
+  8029e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8029e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029e5 <fd2data+0x8>
+  8029ec:	49 bb 53 56 00 00 00 	movabs $0x5653,%r11
+  8029f3:	00 00 00 
+  8029f6:	4c 01 d8             	add    %r11,%rax
+  8029f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8029fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a01:	48 89 d7             	mov    %rdx,%rdi
+  802a04:	48 ba 6e a9 ff ff ff 	movabs $0xffffffffffffa96e,%rdx
+  802a0b:	ff ff ff 
+  802a0e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802a12:	ff d0                	call   *%rax
+  802a14:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802a1a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802a1e:	c9                   	leave
+  802a1f:	c3                   	ret
+
+0000000000802a20 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802a20:	55                   	push   %rbp
+  802a21:	48 89 e5             	mov    %rsp,%rbp
+  802a24:	48 83 ec 18          	sub    $0x18,%rsp
+  802a28:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a28 <fd_alloc+0x8>
+  802a2f:	49 bb 10 56 00 00 00 	movabs $0x5610,%r11
+  802a36:	00 00 00 
+  802a39:	4c 01 d8             	add    %r11,%rax
+  802a3c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802a40:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a47:	eb 75                	jmp    802abe <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802a49:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a4c:	48 63 d2             	movslq %edx,%rdx
+  802a4f:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802a56:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802a5a:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a5e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a62:	48 89 d1             	mov    %rdx,%rcx
+  802a65:	48 c1 e9 15          	shr    $0x15,%rcx
+  802a69:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802a70:	ff ff ff 
+  802a73:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a77:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a7b:	83 e2 01             	and    $0x1,%edx
+  802a7e:	48 85 d2             	test   %rdx,%rdx
+  802a81:	74 25                	je     802aa8 <fd_alloc+0x88>
+  802a83:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a87:	48 89 d1             	mov    %rdx,%rcx
+  802a8a:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802a8e:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802a95:	ff ff ff 
+  802a98:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a9c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802aa0:	83 e2 01             	and    $0x1,%edx
+  802aa3:	48 85 d2             	test   %rdx,%rdx
+  802aa6:	75 12                	jne    802aba <fd_alloc+0x9a>
+			*fd_store = fd;
+  802aa8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802aac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ab0:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab8:	eb 1a                	jmp    802ad4 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802aba:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802abe:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802ac2:	7e 85                	jle    802a49 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802ac4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ac8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802acf:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802ad4:	c9                   	leave
+  802ad5:	c3                   	ret
+
+0000000000802ad6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802ad6:	55                   	push   %rbp
+  802ad7:	48 89 e5             	mov    %rsp,%rbp
+  802ada:	48 83 ec 20          	sub    $0x20,%rsp
+  802ade:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ade <fd_lookup+0x8>
+  802ae5:	49 bb 5a 55 00 00 00 	movabs $0x555a,%r11
+  802aec:	00 00 00 
+  802aef:	4c 01 d8             	add    %r11,%rax
+  802af2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802af5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802af9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802afd:	78 06                	js     802b05 <fd_lookup+0x2f>
+  802aff:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802b03:	7e 07                	jle    802b0c <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802b05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b0a:	eb 73                	jmp    802b7f <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802b0c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802b0f:	48 63 d2             	movslq %edx,%rdx
+  802b12:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802b19:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802b1d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802b21:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b25:	48 89 d1             	mov    %rdx,%rcx
+  802b28:	48 c1 e9 15          	shr    $0x15,%rcx
+  802b2c:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802b33:	ff ff ff 
+  802b36:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802b3a:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802b3e:	83 e2 01             	and    $0x1,%edx
+  802b41:	48 85 d2             	test   %rdx,%rdx
+  802b44:	74 22                	je     802b68 <fd_lookup+0x92>
+  802b46:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b4a:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802b4e:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802b55:	ff ff ff 
+  802b58:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802b5c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b60:	83 e0 01             	and    $0x1,%eax
+  802b63:	48 85 c0             	test   %rax,%rax
+  802b66:	75 07                	jne    802b6f <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802b68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b6d:	eb 10                	jmp    802b7f <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802b6f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b73:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b77:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b7f:	c9                   	leave
+  802b80:	c3                   	ret
+
+0000000000802b81 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802b81:	55                   	push   %rbp
+  802b82:	48 89 e5             	mov    %rsp,%rbp
+  802b85:	41 57                	push   %r15
+  802b87:	53                   	push   %rbx
+  802b88:	48 83 ec 30          	sub    $0x30,%rsp
+  802b8c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b8c <fd_close+0xb>
+  802b93:	49 bb ac 54 00 00 00 	movabs $0x54ac,%r11
+  802b9a:	00 00 00 
+  802b9d:	4c 01 db             	add    %r11,%rbx
+  802ba0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802ba4:	89 f0                	mov    %esi,%eax
+  802ba6:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802ba9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bad:	48 89 c7             	mov    %rax,%rdi
+  802bb0:	48 b8 6e a9 ff ff ff 	movabs $0xffffffffffffa96e,%rax
+  802bb7:	ff ff ff 
+  802bba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bbe:	ff d0                	call   *%rax
+  802bc0:	89 c2                	mov    %eax,%edx
+  802bc2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802bc6:	48 89 c6             	mov    %rax,%rsi
+  802bc9:	89 d7                	mov    %edx,%edi
+  802bcb:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  802bd2:	ff ff ff 
+  802bd5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bd9:	ff d0                	call   *%rax
+  802bdb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bde:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802be2:	78 0a                	js     802bee <fd_close+0x6d>
+	    || fd != fd2)
+  802be4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802be8:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802bec:	74 12                	je     802c00 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802bee:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802bf2:	74 05                	je     802bf9 <fd_close+0x78>
+  802bf4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bf7:	eb 7a                	jmp    802c73 <fd_close+0xf2>
+  802bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfe:	eb 73                	jmp    802c73 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802c00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c04:	8b 00                	mov    (%rax),%eax
+  802c06:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802c0a:	48 89 d6             	mov    %rdx,%rsi
+  802c0d:	89 c7                	mov    %eax,%edi
+  802c0f:	48 b8 44 ac ff ff ff 	movabs $0xffffffffffffac44,%rax
+  802c16:	ff ff ff 
+  802c19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c1d:	ff d0                	call   *%rax
+  802c1f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c22:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c26:	78 2a                	js     802c52 <fd_close+0xd1>
+		if (dev->dev_close)
+  802c28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c2c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802c30:	48 85 c0             	test   %rax,%rax
+  802c33:	74 16                	je     802c4b <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802c35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c39:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802c3d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c41:	48 89 c7             	mov    %rax,%rdi
+  802c44:	ff d2                	call   *%rdx
+  802c46:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c49:	eb 07                	jmp    802c52 <fd_close+0xd1>
+		else
+			r = 0;
+  802c4b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802c52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c56:	48 89 c6             	mov    %rax,%rsi
+  802c59:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c5e:	49 89 df             	mov    %rbx,%r15
+  802c61:	48 b8 1b a1 ff ff ff 	movabs $0xffffffffffffa11b,%rax
+  802c68:	ff ff ff 
+  802c6b:	48 01 d8             	add    %rbx,%rax
+  802c6e:	ff d0                	call   *%rax
+	return r;
+  802c70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802c73:	48 83 c4 30          	add    $0x30,%rsp
+  802c77:	5b                   	pop    %rbx
+  802c78:	41 5f                	pop    %r15
+  802c7a:	5d                   	pop    %rbp
+  802c7b:	c3                   	ret
+
+0000000000802c7c <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802c7c:	55                   	push   %rbp
+  802c7d:	48 89 e5             	mov    %rsp,%rbp
+  802c80:	41 57                	push   %r15
+  802c82:	48 83 ec 28          	sub    $0x28,%rsp
+  802c86:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802c86 <dev_lookup+0xa>
+  802c8d:	49 bb b2 53 00 00 00 	movabs $0x53b2,%r11
+  802c94:	00 00 00 
+  802c97:	4c 01 d9             	add    %r11,%rcx
+  802c9a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c9d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802ca1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802ca8:	eb 45                	jmp    802cef <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802caa:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802cb1:	00 00 00 
+  802cb4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cb7:	48 98                	cltq
+  802cb9:	48 01 ca             	add    %rcx,%rdx
+  802cbc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cc0:	8b 00                	mov    (%rax),%eax
+  802cc2:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802cc5:	75 24                	jne    802ceb <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802cc7:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802cce:	00 00 00 
+  802cd1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cd4:	48 98                	cltq
+  802cd6:	48 01 ca             	add    %rcx,%rdx
+  802cd9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cdd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ce1:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce9:	eb 74                	jmp    802d5f <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802ceb:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802cef:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802cf6:	00 00 00 
+  802cf9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cfc:	48 98                	cltq
+  802cfe:	48 01 ca             	add    %rcx,%rdx
+  802d01:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d05:	48 85 c0             	test   %rax,%rax
+  802d08:	75 a0                	jne    802caa <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802d0a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802d11:	ff ff ff 
+  802d14:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802d18:	48 8b 00             	mov    (%rax),%rax
+  802d1b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802d21:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802d24:	89 c6                	mov    %eax,%esi
+  802d26:	48 b8 20 e6 ff ff ff 	movabs $0xffffffffffffe620,%rax
+  802d2d:	ff ff ff 
+  802d30:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802d34:	48 89 c7             	mov    %rax,%rdi
+  802d37:	49 89 cf             	mov    %rcx,%r15
+  802d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3f:	49 b8 c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%r8
+  802d46:	ff ff ff 
+  802d49:	49 01 c8             	add    %rcx,%r8
+  802d4c:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802d4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d53:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802d5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d5f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802d63:	c9                   	leave
+  802d64:	c3                   	ret
+
+0000000000802d65 <close>:
+
+int
+close(int fdnum)
+{
+  802d65:	55                   	push   %rbp
+  802d66:	48 89 e5             	mov    %rsp,%rbp
+  802d69:	53                   	push   %rbx
+  802d6a:	48 83 ec 28          	sub    $0x28,%rsp
+  802d6e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d6e <close+0x9>
+  802d75:	49 bb ca 52 00 00 00 	movabs $0x52ca,%r11
+  802d7c:	00 00 00 
+  802d7f:	4c 01 db             	add    %r11,%rbx
+  802d82:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d85:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802d89:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d8c:	48 89 d6             	mov    %rdx,%rsi
+  802d8f:	89 c7                	mov    %eax,%edi
+  802d91:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  802d98:	ff ff ff 
+  802d9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d9f:	ff d0                	call   *%rax
+  802da1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802da4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802da8:	79 05                	jns    802daf <close+0x4a>
+		return r;
+  802daa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dad:	eb 1c                	jmp    802dcb <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802daf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802db3:	be 01 00 00 00       	mov    $0x1,%esi
+  802db8:	48 89 c7             	mov    %rax,%rdi
+  802dbb:	48 b8 49 ab ff ff ff 	movabs $0xffffffffffffab49,%rax
+  802dc2:	ff ff ff 
+  802dc5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dc9:	ff d0                	call   *%rax
+}
+  802dcb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dcf:	c9                   	leave
+  802dd0:	c3                   	ret
+
+0000000000802dd1 <close_all>:
+
+void
+close_all(void)
+{
+  802dd1:	55                   	push   %rbp
+  802dd2:	48 89 e5             	mov    %rsp,%rbp
+  802dd5:	53                   	push   %rbx
+  802dd6:	48 83 ec 18          	sub    $0x18,%rsp
+  802dda:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dda <close_all+0x9>
+  802de1:	49 bb 5e 52 00 00 00 	movabs $0x525e,%r11
+  802de8:	00 00 00 
+  802deb:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802dee:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802df5:	eb 19                	jmp    802e10 <close_all+0x3f>
+		close(i);
+  802df7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dfa:	89 c7                	mov    %eax,%edi
+  802dfc:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  802e03:	ff ff ff 
+  802e06:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e0a:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802e0c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802e10:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802e14:	7e e1                	jle    802df7 <close_all+0x26>
+}
+  802e16:	90                   	nop
+  802e17:	90                   	nop
+  802e18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e1c:	c9                   	leave
+  802e1d:	c3                   	ret
+
+0000000000802e1e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802e1e:	55                   	push   %rbp
+  802e1f:	48 89 e5             	mov    %rsp,%rbp
+  802e22:	41 57                	push   %r15
+  802e24:	53                   	push   %rbx
+  802e25:	48 83 ec 40          	sub    $0x40,%rsp
+  802e29:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e29 <dup+0xb>
+  802e30:	49 bb 0f 52 00 00 00 	movabs $0x520f,%r11
+  802e37:	00 00 00 
+  802e3a:	4c 01 db             	add    %r11,%rbx
+  802e3d:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802e40:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802e43:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e47:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802e4a:	48 89 d6             	mov    %rdx,%rsi
+  802e4d:	89 c7                	mov    %eax,%edi
+  802e4f:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  802e56:	ff ff ff 
+  802e59:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e5d:	ff d0                	call   *%rax
+  802e5f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e62:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e66:	79 08                	jns    802e70 <dup+0x52>
+		return r;
+  802e68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e6b:	e9 a4 01 00 00       	jmp    803014 <dup+0x1f6>
+	close(newfdnum);
+  802e70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e73:	89 c7                	mov    %eax,%edi
+  802e75:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  802e7c:	ff ff ff 
+  802e7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e83:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802e85:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e88:	48 98                	cltq
+  802e8a:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802e90:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e94:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802e98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e9c:	48 89 c7             	mov    %rax,%rdi
+  802e9f:	48 b8 a5 a9 ff ff ff 	movabs $0xffffffffffffa9a5,%rax
+  802ea6:	ff ff ff 
+  802ea9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ead:	ff d0                	call   *%rax
+  802eaf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802eb3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802eb7:	48 89 c7             	mov    %rax,%rdi
+  802eba:	48 b8 a5 a9 ff ff ff 	movabs $0xffffffffffffa9a5,%rax
+  802ec1:	ff ff ff 
+  802ec4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ec8:	ff d0                	call   *%rax
+  802eca:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802ece:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ed2:	48 c1 e8 15          	shr    $0x15,%rax
+  802ed6:	48 89 c2             	mov    %rax,%rdx
+  802ed9:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802ee0:	ff ff ff 
+  802ee3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ee7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eeb:	83 e0 01             	and    $0x1,%eax
+  802eee:	48 85 c0             	test   %rax,%rax
+  802ef1:	74 7f                	je     802f72 <dup+0x154>
+  802ef3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ef7:	48 c1 e8 0c          	shr    $0xc,%rax
+  802efb:	48 89 c2             	mov    %rax,%rdx
+  802efe:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f05:	ff ff ff 
+  802f08:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f0c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f10:	83 e0 01             	and    $0x1,%eax
+  802f13:	48 85 c0             	test   %rax,%rax
+  802f16:	74 5a                	je     802f72 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802f18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f1c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f20:	48 89 c2             	mov    %rax,%rdx
+  802f23:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f2a:	ff ff ff 
+  802f2d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f31:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f35:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f3a:	89 c1                	mov    %eax,%ecx
+  802f3c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f44:	41 89 c8             	mov    %ecx,%r8d
+  802f47:	48 89 d1             	mov    %rdx,%rcx
+  802f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f4f:	48 89 c6             	mov    %rax,%rsi
+  802f52:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f57:	49 89 df             	mov    %rbx,%r15
+  802f5a:	48 b8 a8 a0 ff ff ff 	movabs $0xffffffffffffa0a8,%rax
+  802f61:	ff ff ff 
+  802f64:	48 01 d8             	add    %rbx,%rax
+  802f67:	ff d0                	call   *%rax
+  802f69:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f6c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f70:	78 5f                	js     802fd1 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802f72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f76:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f7a:	48 89 c2             	mov    %rax,%rdx
+  802f7d:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f84:	ff ff ff 
+  802f87:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f8b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f8f:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f94:	89 c1                	mov    %eax,%ecx
+  802f96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f9a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f9e:	41 89 c8             	mov    %ecx,%r8d
+  802fa1:	48 89 d1             	mov    %rdx,%rcx
+  802fa4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fa9:	48 89 c6             	mov    %rax,%rsi
+  802fac:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fb1:	49 89 df             	mov    %rbx,%r15
+  802fb4:	48 b8 a8 a0 ff ff ff 	movabs $0xffffffffffffa0a8,%rax
+  802fbb:	ff ff ff 
+  802fbe:	48 01 d8             	add    %rbx,%rax
+  802fc1:	ff d0                	call   *%rax
+  802fc3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fc6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fca:	78 08                	js     802fd4 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802fcc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fcf:	eb 43                	jmp    803014 <dup+0x1f6>
+			goto err;
+  802fd1:	90                   	nop
+  802fd2:	eb 01                	jmp    802fd5 <dup+0x1b7>
+		goto err;
+  802fd4:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802fd5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fd9:	48 89 c6             	mov    %rax,%rsi
+  802fdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe1:	49 89 df             	mov    %rbx,%r15
+  802fe4:	48 b8 1b a1 ff ff ff 	movabs $0xffffffffffffa11b,%rax
+  802feb:	ff ff ff 
+  802fee:	48 01 d8             	add    %rbx,%rax
+  802ff1:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802ff3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ff7:	48 89 c6             	mov    %rax,%rsi
+  802ffa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fff:	49 89 df             	mov    %rbx,%r15
+  803002:	48 b8 1b a1 ff ff ff 	movabs $0xffffffffffffa11b,%rax
+  803009:	ff ff ff 
+  80300c:	48 01 d8             	add    %rbx,%rax
+  80300f:	ff d0                	call   *%rax
+	return r;
+  803011:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803014:	48 83 c4 40          	add    $0x40,%rsp
+  803018:	5b                   	pop    %rbx
+  803019:	41 5f                	pop    %r15
+  80301b:	5d                   	pop    %rbp
+  80301c:	c3                   	ret
+
+000000000080301d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80301d:	55                   	push   %rbp
+  80301e:	48 89 e5             	mov    %rsp,%rbp
+  803021:	41 57                	push   %r15
+  803023:	53                   	push   %rbx
+  803024:	48 83 ec 40          	sub    $0x40,%rsp
+  803028:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803028 <read+0xb>
+  80302f:	49 bb 10 50 00 00 00 	movabs $0x5010,%r11
+  803036:	00 00 00 
+  803039:	4c 01 db             	add    %r11,%rbx
+  80303c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80303f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803043:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803047:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80304b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80304e:	48 89 d6             	mov    %rdx,%rsi
+  803051:	89 c7                	mov    %eax,%edi
+  803053:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  80305a:	ff ff ff 
+  80305d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803061:	ff d0                	call   *%rax
+  803063:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803066:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80306a:	78 28                	js     803094 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80306c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803070:	8b 00                	mov    (%rax),%eax
+  803072:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803076:	48 89 d6             	mov    %rdx,%rsi
+  803079:	89 c7                	mov    %eax,%edi
+  80307b:	48 b8 44 ac ff ff ff 	movabs $0xffffffffffffac44,%rax
+  803082:	ff ff ff 
+  803085:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803089:	ff d0                	call   *%rax
+  80308b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80308e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803092:	79 08                	jns    80309c <read+0x7f>
+		return r;
+  803094:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803097:	e9 8b 00 00 00       	jmp    803127 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80309c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030a0:	8b 40 08             	mov    0x8(%rax),%eax
+  8030a3:	83 e0 03             	and    $0x3,%eax
+  8030a6:	83 f8 01             	cmp    $0x1,%eax
+  8030a9:	75 4b                	jne    8030f6 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8030ab:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8030b2:	ff ff ff 
+  8030b5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030b9:	48 8b 00             	mov    (%rax),%rax
+  8030bc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8030c2:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8030c5:	89 c6                	mov    %eax,%esi
+  8030c7:	48 b8 3f e6 ff ff ff 	movabs $0xffffffffffffe63f,%rax
+  8030ce:	ff ff ff 
+  8030d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030d5:	48 89 c7             	mov    %rax,%rdi
+  8030d8:	49 89 df             	mov    %rbx,%r15
+  8030db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030e0:	48 b9 c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rcx
+  8030e7:	ff ff ff 
+  8030ea:	48 01 d9             	add    %rbx,%rcx
+  8030ed:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8030ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030f4:	eb 31                	jmp    803127 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8030f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030fa:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8030fe:	48 85 c0             	test   %rax,%rax
+  803101:	75 07                	jne    80310a <read+0xed>
+		return -E_NOT_SUPP;
+  803103:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803108:	eb 1d                	jmp    803127 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  80310a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80310e:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803112:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803116:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80311a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80311e:	48 89 ce             	mov    %rcx,%rsi
+  803121:	48 89 c7             	mov    %rax,%rdi
+  803124:	41 ff d0             	call   *%r8
+}
+  803127:	48 83 c4 40          	add    $0x40,%rsp
+  80312b:	5b                   	pop    %rbx
+  80312c:	41 5f                	pop    %r15
+  80312e:	5d                   	pop    %rbp
+  80312f:	c3                   	ret
+
+0000000000803130 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803130:	55                   	push   %rbp
+  803131:	48 89 e5             	mov    %rsp,%rbp
+  803134:	53                   	push   %rbx
+  803135:	48 83 ec 38          	sub    $0x38,%rsp
+  803139:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803139 <readn+0x9>
+  803140:	49 bb ff 4e 00 00 00 	movabs $0x4eff,%r11
+  803147:	00 00 00 
+  80314a:	4c 01 db             	add    %r11,%rbx
+  80314d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803150:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803154:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803158:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80315f:	eb 4b                	jmp    8031ac <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803161:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803164:	48 98                	cltq
+  803166:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80316a:	48 29 c2             	sub    %rax,%rdx
+  80316d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803170:	48 63 c8             	movslq %eax,%rcx
+  803173:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803177:	48 01 c1             	add    %rax,%rcx
+  80317a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80317d:	48 89 ce             	mov    %rcx,%rsi
+  803180:	89 c7                	mov    %eax,%edi
+  803182:	48 b8 e5 af ff ff ff 	movabs $0xffffffffffffafe5,%rax
+  803189:	ff ff ff 
+  80318c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803190:	ff d0                	call   *%rax
+  803192:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803195:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803199:	79 05                	jns    8031a0 <readn+0x70>
+			return m;
+  80319b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80319e:	eb 1d                	jmp    8031bd <readn+0x8d>
+		if (m == 0)
+  8031a0:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8031a4:	74 13                	je     8031b9 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  8031a6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8031a9:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8031ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031af:	48 98                	cltq
+  8031b1:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  8031b5:	72 aa                	jb     803161 <readn+0x31>
+  8031b7:	eb 01                	jmp    8031ba <readn+0x8a>
+			break;
+  8031b9:	90                   	nop
+	}
+	return tot;
+  8031ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8031bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031c1:	c9                   	leave
+  8031c2:	c3                   	ret
+
+00000000008031c3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8031c3:	55                   	push   %rbp
+  8031c4:	48 89 e5             	mov    %rsp,%rbp
+  8031c7:	41 57                	push   %r15
+  8031c9:	53                   	push   %rbx
+  8031ca:	48 83 ec 40          	sub    $0x40,%rsp
+  8031ce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031ce <write+0xb>
+  8031d5:	49 bb 6a 4e 00 00 00 	movabs $0x4e6a,%r11
+  8031dc:	00 00 00 
+  8031df:	4c 01 db             	add    %r11,%rbx
+  8031e2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8031e5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8031e9:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8031ed:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8031f1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8031f4:	48 89 d6             	mov    %rdx,%rsi
+  8031f7:	89 c7                	mov    %eax,%edi
+  8031f9:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  803200:	ff ff ff 
+  803203:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803207:	ff d0                	call   *%rax
+  803209:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80320c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803210:	78 28                	js     80323a <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803212:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803216:	8b 00                	mov    (%rax),%eax
+  803218:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80321c:	48 89 d6             	mov    %rdx,%rsi
+  80321f:	89 c7                	mov    %eax,%edi
+  803221:	48 b8 44 ac ff ff ff 	movabs $0xffffffffffffac44,%rax
+  803228:	ff ff ff 
+  80322b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80322f:	ff d0                	call   *%rax
+  803231:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803234:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803238:	79 08                	jns    803242 <write+0x7f>
+		return r;
+  80323a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80323d:	e9 8a 00 00 00       	jmp    8032cc <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803242:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803246:	8b 40 08             	mov    0x8(%rax),%eax
+  803249:	83 e0 03             	and    $0x3,%eax
+  80324c:	85 c0                	test   %eax,%eax
+  80324e:	75 4b                	jne    80329b <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803250:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803257:	ff ff ff 
+  80325a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80325e:	48 8b 00             	mov    (%rax),%rax
+  803261:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803267:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80326a:	89 c6                	mov    %eax,%esi
+  80326c:	48 b8 5b e6 ff ff ff 	movabs $0xffffffffffffe65b,%rax
+  803273:	ff ff ff 
+  803276:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80327a:	48 89 c7             	mov    %rax,%rdi
+  80327d:	49 89 df             	mov    %rbx,%r15
+  803280:	b8 00 00 00 00       	mov    $0x0,%eax
+  803285:	48 b9 c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rcx
+  80328c:	ff ff ff 
+  80328f:	48 01 d9             	add    %rbx,%rcx
+  803292:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803294:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803299:	eb 31                	jmp    8032cc <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80329b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80329f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032a3:	48 85 c0             	test   %rax,%rax
+  8032a6:	75 07                	jne    8032af <write+0xec>
+		return -E_NOT_SUPP;
+  8032a8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8032ad:	eb 1d                	jmp    8032cc <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  8032af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032b3:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8032b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032bb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8032bf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032c3:	48 89 ce             	mov    %rcx,%rsi
+  8032c6:	48 89 c7             	mov    %rax,%rdi
+  8032c9:	41 ff d0             	call   *%r8
+}
+  8032cc:	48 83 c4 40          	add    $0x40,%rsp
+  8032d0:	5b                   	pop    %rbx
+  8032d1:	41 5f                	pop    %r15
+  8032d3:	5d                   	pop    %rbp
+  8032d4:	c3                   	ret
+
+00000000008032d5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8032d5:	55                   	push   %rbp
+  8032d6:	48 89 e5             	mov    %rsp,%rbp
+  8032d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8032dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8032dd <seek+0x8>
+  8032e4:	49 bb 5b 4d 00 00 00 	movabs $0x4d5b,%r11
+  8032eb:	00 00 00 
+  8032ee:	4c 01 d8             	add    %r11,%rax
+  8032f1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8032f4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032f7:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8032fb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032fe:	48 89 ce             	mov    %rcx,%rsi
+  803301:	89 d7                	mov    %edx,%edi
+  803303:	48 ba 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rdx
+  80330a:	ff ff ff 
+  80330d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803311:	ff d0                	call   *%rax
+  803313:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803316:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80331a:	79 05                	jns    803321 <seek+0x4c>
+		return r;
+  80331c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80331f:	eb 0f                	jmp    803330 <seek+0x5b>
+	fd->fd_offset = offset;
+  803321:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803325:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803328:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  80332b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803330:	c9                   	leave
+  803331:	c3                   	ret
+
+0000000000803332 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803332:	55                   	push   %rbp
+  803333:	48 89 e5             	mov    %rsp,%rbp
+  803336:	41 57                	push   %r15
+  803338:	53                   	push   %rbx
+  803339:	48 83 ec 30          	sub    $0x30,%rsp
+  80333d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80333d <ftruncate+0xb>
+  803344:	49 bb fb 4c 00 00 00 	movabs $0x4cfb,%r11
+  80334b:	00 00 00 
+  80334e:	4c 01 db             	add    %r11,%rbx
+  803351:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803354:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803357:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80335b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80335e:	48 89 d6             	mov    %rdx,%rsi
+  803361:	89 c7                	mov    %eax,%edi
+  803363:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  80336a:	ff ff ff 
+  80336d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803371:	ff d0                	call   *%rax
+  803373:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803376:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80337a:	78 28                	js     8033a4 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80337c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803380:	8b 00                	mov    (%rax),%eax
+  803382:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803386:	48 89 d6             	mov    %rdx,%rsi
+  803389:	89 c7                	mov    %eax,%edi
+  80338b:	48 b8 44 ac ff ff ff 	movabs $0xffffffffffffac44,%rax
+  803392:	ff ff ff 
+  803395:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803399:	ff d0                	call   *%rax
+  80339b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80339e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033a2:	79 08                	jns    8033ac <ftruncate+0x7a>
+		return r;
+  8033a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033a7:	e9 83 00 00 00       	jmp    80342f <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033b0:	8b 40 08             	mov    0x8(%rax),%eax
+  8033b3:	83 e0 03             	and    $0x3,%eax
+  8033b6:	85 c0                	test   %eax,%eax
+  8033b8:	75 4b                	jne    803405 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8033ba:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8033c1:	ff ff ff 
+  8033c4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033c8:	48 8b 00             	mov    (%rax),%rax
+  8033cb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033d1:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8033d4:	89 c6                	mov    %eax,%esi
+  8033d6:	48 b8 78 e6 ff ff ff 	movabs $0xffffffffffffe678,%rax
+  8033dd:	ff ff ff 
+  8033e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033e4:	48 89 c7             	mov    %rax,%rdi
+  8033e7:	49 89 df             	mov    %rbx,%r15
+  8033ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ef:	48 b9 c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rcx
+  8033f6:	ff ff ff 
+  8033f9:	48 01 d9             	add    %rbx,%rcx
+  8033fc:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8033fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803403:	eb 2a                	jmp    80342f <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803405:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803409:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80340d:	48 85 c0             	test   %rax,%rax
+  803410:	75 07                	jne    803419 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803412:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803417:	eb 16                	jmp    80342f <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803419:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80341d:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803421:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803425:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803428:	89 d6                	mov    %edx,%esi
+  80342a:	48 89 c7             	mov    %rax,%rdi
+  80342d:	ff d1                	call   *%rcx
+}
+  80342f:	48 83 c4 30          	add    $0x30,%rsp
+  803433:	5b                   	pop    %rbx
+  803434:	41 5f                	pop    %r15
+  803436:	5d                   	pop    %rbp
+  803437:	c3                   	ret
+
+0000000000803438 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803438:	55                   	push   %rbp
+  803439:	48 89 e5             	mov    %rsp,%rbp
+  80343c:	53                   	push   %rbx
+  80343d:	48 83 ec 38          	sub    $0x38,%rsp
+  803441:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803441 <fstat+0x9>
+  803448:	49 bb f7 4b 00 00 00 	movabs $0x4bf7,%r11
+  80344f:	00 00 00 
+  803452:	4c 01 db             	add    %r11,%rbx
+  803455:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803458:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80345c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803460:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803463:	48 89 d6             	mov    %rdx,%rsi
+  803466:	89 c7                	mov    %eax,%edi
+  803468:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  80346f:	ff ff ff 
+  803472:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803476:	ff d0                	call   *%rax
+  803478:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80347b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80347f:	78 28                	js     8034a9 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803481:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803485:	8b 00                	mov    (%rax),%eax
+  803487:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80348b:	48 89 d6             	mov    %rdx,%rsi
+  80348e:	89 c7                	mov    %eax,%edi
+  803490:	48 b8 44 ac ff ff ff 	movabs $0xffffffffffffac44,%rax
+  803497:	ff ff ff 
+  80349a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80349e:	ff d0                	call   *%rax
+  8034a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034a7:	79 05                	jns    8034ae <fstat+0x76>
+		return r;
+  8034a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034ac:	eb 5e                	jmp    80350c <fstat+0xd4>
+	if (!dev->dev_stat)
+  8034ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034b2:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034b6:	48 85 c0             	test   %rax,%rax
+  8034b9:	75 07                	jne    8034c2 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8034bb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034c0:	eb 4a                	jmp    80350c <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8034c2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034c6:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8034c9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034cd:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8034d4:	00 00 00 
+	stat->st_isdir = 0;
+  8034d7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034db:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8034e2:	00 00 00 
+	stat->st_dev = dev;
+  8034e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034e9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034ed:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8034f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034f8:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8034fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803500:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803504:	48 89 d6             	mov    %rdx,%rsi
+  803507:	48 89 c7             	mov    %rax,%rdi
+  80350a:	ff d1                	call   *%rcx
+}
+  80350c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803510:	c9                   	leave
+  803511:	c3                   	ret
+
+0000000000803512 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803512:	55                   	push   %rbp
+  803513:	48 89 e5             	mov    %rsp,%rbp
+  803516:	41 57                	push   %r15
+  803518:	53                   	push   %rbx
+  803519:	48 83 ec 20          	sub    $0x20,%rsp
+  80351d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80351d <stat+0xb>
+  803524:	49 bb 1b 4b 00 00 00 	movabs $0x4b1b,%r11
+  80352b:	00 00 00 
+  80352e:	4c 01 db             	add    %r11,%rbx
+  803531:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803535:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803539:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80353d:	be 00 00 00 00       	mov    $0x0,%esi
+  803542:	48 89 c7             	mov    %rax,%rdi
+  803545:	49 89 df             	mov    %rbx,%r15
+  803548:	48 b8 b4 b7 ff ff ff 	movabs $0xffffffffffffb7b4,%rax
+  80354f:	ff ff ff 
+  803552:	48 01 d8             	add    %rbx,%rax
+  803555:	ff d0                	call   *%rax
+  803557:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80355a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80355e:	79 05                	jns    803565 <stat+0x53>
+		return fd;
+  803560:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803563:	eb 37                	jmp    80359c <stat+0x8a>
+	r = fstat(fd, stat);
+  803565:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803569:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80356c:	48 89 d6             	mov    %rdx,%rsi
+  80356f:	89 c7                	mov    %eax,%edi
+  803571:	48 b8 00 b4 ff ff ff 	movabs $0xffffffffffffb400,%rax
+  803578:	ff ff ff 
+  80357b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80357f:	ff d0                	call   *%rax
+  803581:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803584:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803587:	89 c7                	mov    %eax,%edi
+  803589:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  803590:	ff ff ff 
+  803593:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803597:	ff d0                	call   *%rax
+	return r;
+  803599:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  80359c:	48 83 c4 20          	add    $0x20,%rsp
+  8035a0:	5b                   	pop    %rbx
+  8035a1:	41 5f                	pop    %r15
+  8035a3:	5d                   	pop    %rbp
+  8035a4:	c3                   	ret
+
+00000000008035a5 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8035a5:	55                   	push   %rbp
+  8035a6:	48 89 e5             	mov    %rsp,%rbp
+  8035a9:	41 57                	push   %r15
+  8035ab:	53                   	push   %rbx
+  8035ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8035b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035b0 <fsipc+0xb>
+  8035b7:	49 bb 88 4a 00 00 00 	movabs $0x4a88,%r11
+  8035be:	00 00 00 
+  8035c1:	4c 01 db             	add    %r11,%rbx
+  8035c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8035cb:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8035d2:	00 00 00 
+  8035d5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8035d8:	85 c0                	test   %eax,%eax
+  8035da:	75 24                	jne    803600 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8035dc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035e1:	49 89 df             	mov    %rbx,%r15
+  8035e4:	48 b8 b4 df ff ff ff 	movabs $0xffffffffffffdfb4,%rax
+  8035eb:	ff ff ff 
+  8035ee:	48 01 d8             	add    %rbx,%rax
+  8035f1:	ff d0                	call   *%rax
+  8035f3:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  8035fa:	00 00 00 
+  8035fd:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803600:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803607:	00 00 00 
+  80360a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80360d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803611:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803614:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80361a:	49 89 d0             	mov    %rdx,%r8
+  80361d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803622:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803629:	00 00 00 
+  80362c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803630:	89 c7                	mov    %eax,%edi
+  803632:	49 89 df             	mov    %rbx,%r15
+  803635:	48 b8 d3 d9 ff ff ff 	movabs $0xffffffffffffd9d3,%rax
+  80363c:	ff ff ff 
+  80363f:	48 01 d8             	add    %rbx,%rax
+  803642:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803644:	48 83 c4 10          	add    $0x10,%rsp
+  803648:	5b                   	pop    %rbx
+  803649:	41 5f                	pop    %r15
+  80364b:	5d                   	pop    %rbp
+  80364c:	c3                   	ret
+
+000000000080364d <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  80364d:	55                   	push   %rbp
+  80364e:	48 89 e5             	mov    %rsp,%rbp
+  803651:	41 57                	push   %r15
+  803653:	53                   	push   %rbx
+  803654:	48 83 ec 20          	sub    $0x20,%rsp
+  803658:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803658 <fsipc_words+0xb>
+  80365f:	49 bb e0 49 00 00 00 	movabs $0x49e0,%r11
+  803666:	00 00 00 
+  803669:	4c 01 db             	add    %r11,%rbx
+  80366c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80366f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803673:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803677:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80367e:	00 00 00 
+  803681:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803684:	85 c0                	test   %eax,%eax
+  803686:	75 24                	jne    8036ac <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803688:	bf 01 00 00 00       	mov    $0x1,%edi
+  80368d:	49 89 df             	mov    %rbx,%r15
+  803690:	48 b8 b4 df ff ff ff 	movabs $0xffffffffffffdfb4,%rax
+  803697:	ff ff ff 
+  80369a:	48 01 d8             	add    %rbx,%rax
+  80369d:	ff d0                	call   *%rax
+  80369f:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  8036a6:	00 00 00 
+  8036a9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8036ac:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8036b3:	00 00 00 
+  8036b6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036b9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8036bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036c1:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8036c4:	89 c7                	mov    %eax,%edi
+  8036c6:	49 89 df             	mov    %rbx,%r15
+  8036c9:	48 b8 be da ff ff ff 	movabs $0xffffffffffffdabe,%rax
+  8036d0:	ff ff ff 
+  8036d3:	48 01 d8             	add    %rbx,%rax
+  8036d6:	ff d0                	call   *%rax
+}
+  8036d8:	48 83 c4 20          	add    $0x20,%rsp
+  8036dc:	5b                   	pop    %rbx
+  8036dd:	41 5f                	pop    %r15
+  8036df:	5d                   	pop    %rbp
+  8036e0:	c3                   	ret
+
+00000000008036e1 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8036e1:	55                   	push   %rbp
+  8036e2:	48 89 e5             	mov    %rsp,%rbp
+  8036e5:	41 57                	push   %r15
+  8036e7:	53                   	push   %rbx
+  8036e8:	48 83 ec 40          	sub    $0x40,%rsp
+  8036ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036ec <fsipc_pages+0xb>
+  8036f3:	49 bb 4c 49 00 00 00 	movabs $0x494c,%r11
+  8036fa:	00 00 00 
+  8036fd:	4c 01 db             	add    %r11,%rbx
+  803700:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803703:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803707:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  80370b:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  80370e:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803715:	00 00 00 
+  803718:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80371b:	85 c0                	test   %eax,%eax
+  80371d:	75 24                	jne    803743 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80371f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803724:	49 89 df             	mov    %rbx,%r15
+  803727:	48 b8 b4 df ff ff ff 	movabs $0xffffffffffffdfb4,%rax
+  80372e:	ff ff ff 
+  803731:	48 01 d8             	add    %rbx,%rax
+  803734:	ff d0                	call   *%rax
+  803736:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  80373d:	00 00 00 
+  803740:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803743:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803748:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  80374c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80374f:	48 98                	cltq
+  803751:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  803755:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803759:	0f 95 c0             	setne  %al
+  80375c:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  80375f:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803766:	00 
+  803767:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80376b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80376f:	48 01 d0             	add    %rdx,%rax
+  803772:	48 83 e8 01          	sub    $0x1,%rax
+  803776:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80377a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80377e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803783:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803787:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80378b:	48 29 d0             	sub    %rdx,%rax
+  80378e:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803792:	41 89 c2             	mov    %eax,%r10d
+  803795:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80379c:	00 00 00 
+  80379f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8037a2:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8037a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037aa:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8037ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8037b1:	6a 40                	push   $0x40
+  8037b3:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8037b8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8037bf:	00 
+  8037c0:	6a 05                	push   $0x5
+  8037c2:	41 89 f9             	mov    %edi,%r9d
+  8037c5:	49 89 c8             	mov    %rcx,%r8
+  8037c8:	44 89 d1             	mov    %r10d,%ecx
+  8037cb:	89 c7                	mov    %eax,%edi
+  8037cd:	49 89 df             	mov    %rbx,%r15
+  8037d0:	48 b8 bc db ff ff ff 	movabs $0xffffffffffffdbbc,%rax
+  8037d7:	ff ff ff 
+  8037da:	48 01 d8             	add    %rbx,%rax
+  8037dd:	ff d0                	call   *%rax
+  8037df:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8037e3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8037e7:	5b                   	pop    %rbx
+  8037e8:	41 5f                	pop    %r15
+  8037ea:	5d                   	pop    %rbp
+  8037eb:	c3                   	ret
+
+00000000008037ec <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8037ec:	55                   	push   %rbp
+  8037ed:	48 89 e5             	mov    %rsp,%rbp
+  8037f0:	41 57                	push   %r15
+  8037f2:	53                   	push   %rbx
+  8037f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8037f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037f7 <open+0xb>
+  8037fe:	49 bb 41 48 00 00 00 	movabs $0x4841,%r11
+  803805:	00 00 00 
+  803808:	4c 01 db             	add    %r11,%rbx
+  80380b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80380f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  803812:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803816:	48 89 c7             	mov    %rax,%rdi
+  803819:	49 89 df             	mov    %rbx,%r15
+  80381c:	48 b8 f3 92 ff ff ff 	movabs $0xffffffffffff92f3,%rax
+  803823:	ff ff ff 
+  803826:	48 01 d8             	add    %rbx,%rax
+  803829:	ff d0                	call   *%rax
+  80382b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803830:	7e 0a                	jle    80383c <open+0x50>
+		return -E_BAD_PATH;
+  803832:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803837:	e9 18 01 00 00       	jmp    803954 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  80383c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803840:	48 89 c7             	mov    %rax,%rdi
+  803843:	49 89 df             	mov    %rbx,%r15
+  803846:	48 b8 e8 a9 ff ff ff 	movabs $0xffffffffffffa9e8,%rax
+  80384d:	ff ff ff 
+  803850:	48 01 d8             	add    %rbx,%rax
+  803853:	ff d0                	call   *%rax
+  803855:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803858:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80385c:	74 08                	je     803866 <open+0x7a>
+		return r;
+  80385e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803861:	e9 ee 00 00 00       	jmp    803954 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  803866:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  80386d:	00 00 00 
+  803870:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803873:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80387a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80387e:	48 89 c6             	mov    %rax,%rsi
+  803881:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803888:	00 00 00 
+  80388b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80388f:	48 89 c7             	mov    %rax,%rdi
+  803892:	49 89 df             	mov    %rbx,%r15
+  803895:	48 b8 87 93 ff ff ff 	movabs $0xffffffffffff9387,%rax
+  80389c:	ff ff ff 
+  80389f:	48 01 d8             	add    %rbx,%rax
+  8038a2:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8038a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038a8:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  8038ad:	48 89 c6             	mov    %rax,%rsi
+  8038b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038b5:	49 89 df             	mov    %rbx,%r15
+  8038b8:	48 b8 43 a0 ff ff ff 	movabs $0xffffffffffffa043,%rax
+  8038bf:	ff ff ff 
+  8038c2:	48 01 d8             	add    %rbx,%rax
+  8038c5:	ff d0                	call   *%rax
+  8038c7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038ce:	74 23                	je     8038f3 <open+0x107>
+		fd_close(fd,0);
+  8038d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8038d9:	48 89 c7             	mov    %rax,%rdi
+  8038dc:	49 89 df             	mov    %rbx,%r15
+  8038df:	48 b8 49 ab ff ff ff 	movabs $0xffffffffffffab49,%rax
+  8038e6:	ff ff ff 
+  8038e9:	48 01 d8             	add    %rbx,%rax
+  8038ec:	ff d0                	call   *%rax
+		return r;
+  8038ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038f1:	eb 61                	jmp    803954 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8038f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038f7:	48 89 c6             	mov    %rax,%rsi
+  8038fa:	bf 01 00 00 00       	mov    $0x1,%edi
+  8038ff:	48 b8 6d b5 ff ff ff 	movabs $0xffffffffffffb56d,%rax
+  803906:	ff ff ff 
+  803909:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80390d:	ff d0                	call   *%rax
+  80390f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803912:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803916:	74 23                	je     80393b <open+0x14f>
+		fd_close(fd,0);
+  803918:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80391c:	be 00 00 00 00       	mov    $0x0,%esi
+  803921:	48 89 c7             	mov    %rax,%rdi
+  803924:	49 89 df             	mov    %rbx,%r15
+  803927:	48 b8 49 ab ff ff ff 	movabs $0xffffffffffffab49,%rax
+  80392e:	ff ff ff 
+  803931:	48 01 d8             	add    %rbx,%rax
+  803934:	ff d0                	call   *%rax
+		return r;
+  803936:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803939:	eb 19                	jmp    803954 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  80393b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80393f:	48 89 c7             	mov    %rax,%rdi
+  803942:	49 89 df             	mov    %rbx,%r15
+  803945:	48 b8 6e a9 ff ff ff 	movabs $0xffffffffffffa96e,%rax
+  80394c:	ff ff ff 
+  80394f:	48 01 d8             	add    %rbx,%rax
+  803952:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  803954:	48 83 c4 20          	add    $0x20,%rsp
+  803958:	5b                   	pop    %rbx
+  803959:	41 5f                	pop    %r15
+  80395b:	5d                   	pop    %rbp
+  80395c:	c3                   	ret
+
+000000000080395d <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  80395d:	55                   	push   %rbp
+  80395e:	48 89 e5             	mov    %rsp,%rbp
+  803961:	48 83 ec 20          	sub    $0x20,%rsp
+  803965:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803965 <devfile_flush+0x8>
+  80396c:	49 bb d3 46 00 00 00 	movabs $0x46d3,%r11
+  803973:	00 00 00 
+  803976:	4c 01 d8             	add    %r11,%rax
+  803979:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  80397d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803981:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803984:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803987:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80398b:	ba 04 00 00 00       	mov    $0x4,%edx
+  803990:	48 89 ce             	mov    %rcx,%rsi
+  803993:	bf 06 00 00 00       	mov    $0x6,%edi
+  803998:	48 b9 15 b6 ff ff ff 	movabs $0xffffffffffffb615,%rcx
+  80399f:	ff ff ff 
+  8039a2:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8039a6:	ff d0                	call   *%rax
+}
+  8039a8:	c9                   	leave
+  8039a9:	c3                   	ret
+
+00000000008039aa <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  8039aa:	55                   	push   %rbp
+  8039ab:	48 89 e5             	mov    %rsp,%rbp
+  8039ae:	41 57                	push   %r15
+  8039b0:	53                   	push   %rbx
+  8039b1:	48 83 ec 60          	sub    $0x60,%rsp
+  8039b5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039b5 <devfile_read+0xb>
+  8039bc:	49 bb 83 46 00 00 00 	movabs $0x4683,%r11
+  8039c3:	00 00 00 
+  8039c6:	4c 01 db             	add    %r11,%rbx
+  8039c9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8039cd:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8039d1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  8039d5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8039d9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  8039dd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8039e1:	8b 50 0c             	mov    0xc(%rax),%edx
+  8039e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039e8:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8039ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039ee:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8039f2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8039f6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8039fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8039ff:	ba 10 00 00 00       	mov    $0x10,%edx
+  803a04:	48 89 c6             	mov    %rax,%rsi
+  803a07:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a0c:	48 b8 a9 b6 ff ff ff 	movabs $0xffffffffffffb6a9,%rax
+  803a13:	ff ff ff 
+  803a16:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a1a:	ff d0                	call   *%rax
+  803a1c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803a1f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803a23:	79 05                	jns    803a2a <devfile_read+0x80>
+		return r;
+  803a25:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a28:	eb 64                	jmp    803a8e <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803a2a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a2d:	48 63 d0             	movslq %eax,%rdx
+  803a30:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a34:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803a39:	48 01 c1             	add    %rax,%rcx
+  803a3c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803a40:	48 89 ce             	mov    %rcx,%rsi
+  803a43:	48 89 c7             	mov    %rax,%rdi
+  803a46:	49 89 df             	mov    %rbx,%r15
+  803a49:	48 b8 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rax
+  803a50:	ff ff ff 
+  803a53:	48 01 d8             	add    %rbx,%rax
+  803a56:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803a58:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803a5f:	ff ff ff 
+  803a62:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a66:	48 8b 00             	mov    (%rax),%rax
+  803a69:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803a6f:	89 c6                	mov    %eax,%esi
+  803a71:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803a76:	48 89 c7             	mov    %rax,%rdi
+  803a79:	49 89 df             	mov    %rbx,%r15
+  803a7c:	48 b8 6e df ff ff ff 	movabs $0xffffffffffffdf6e,%rax
+  803a83:	ff ff ff 
+  803a86:	48 01 d8             	add    %rbx,%rax
+  803a89:	ff d0                	call   *%rax
+	return r;
+  803a8b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803a8e:	48 83 c4 60          	add    $0x60,%rsp
+  803a92:	5b                   	pop    %rbx
+  803a93:	41 5f                	pop    %r15
+  803a95:	5d                   	pop    %rbp
+  803a96:	c3                   	ret
+
+0000000000803a97 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803a97:	55                   	push   %rbp
+  803a98:	48 89 e5             	mov    %rsp,%rbp
+  803a9b:	41 57                	push   %r15
+  803a9d:	53                   	push   %rbx
+  803a9e:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803aa2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803aa2 <devfile_write+0xb>
+  803aa9:	49 bb 96 45 00 00 00 	movabs $0x4596,%r11
+  803ab0:	00 00 00 
+  803ab3:	4c 01 db             	add    %r11,%rbx
+  803ab6:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803aba:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803abe:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803ac5:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803ac9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803acd:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803ad4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803ad8:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803adf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ae2:	48 63 d0             	movslq %eax,%rdx
+  803ae5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ae9:	48 39 c2             	cmp    %rax,%rdx
+  803aec:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803af0:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803af7:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803afe:	00 
+  803aff:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b0a:	48 01 d0             	add    %rdx,%rax
+  803b0d:	48 83 e8 01          	sub    $0x1,%rax
+  803b11:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803b15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b19:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b1e:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803b22:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b26:	48 29 d0             	sub    %rdx,%rax
+  803b29:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b2d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803b30:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803b33:	89 c6                	mov    %eax,%esi
+  803b35:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b3a:	48 89 c7             	mov    %rax,%rdi
+  803b3d:	49 89 df             	mov    %rbx,%r15
+  803b40:	48 b8 28 df ff ff ff 	movabs $0xffffffffffffdf28,%rax
+  803b47:	ff ff ff 
+  803b4a:	48 01 d8             	add    %rbx,%rax
+  803b4d:	ff d0                	call   *%rax
+  803b4f:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803b52:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803b56:	79 08                	jns    803b60 <devfile_write+0xc9>
+		return r;
+  803b58:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803b5b:	e9 8f 00 00 00       	jmp    803bef <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803b60:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b67:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803b6b:	48 89 c6             	mov    %rax,%rsi
+  803b6e:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b73:	48 89 c7             	mov    %rax,%rdi
+  803b76:	49 89 df             	mov    %rbx,%r15
+  803b79:	48 b8 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rax
+  803b80:	ff ff ff 
+  803b83:	48 01 d8             	add    %rbx,%rax
+  803b86:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803b88:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803b8c:	8b 50 0c             	mov    0xc(%rax),%edx
+  803b8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b93:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803b95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b99:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803ba0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803ba4:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803ba7:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803bab:	89 d1                	mov    %edx,%ecx
+  803bad:	ba 10 00 00 00       	mov    $0x10,%edx
+  803bb2:	48 89 c6             	mov    %rax,%rsi
+  803bb5:	bf 04 00 00 00       	mov    $0x4,%edi
+  803bba:	48 b8 a9 b6 ff ff ff 	movabs $0xffffffffffffb6a9,%rax
+  803bc1:	ff ff ff 
+  803bc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bc8:	ff d0                	call   *%rax
+  803bca:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803bcd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803bd0:	89 c6                	mov    %eax,%esi
+  803bd2:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803bd7:	48 89 c7             	mov    %rax,%rdi
+  803bda:	49 89 df             	mov    %rbx,%r15
+  803bdd:	48 b8 6e df ff ff ff 	movabs $0xffffffffffffdf6e,%rax
+  803be4:	ff ff ff 
+  803be7:	48 01 d8             	add    %rbx,%rax
+  803bea:	ff d0                	call   *%rax
+	return r;
+  803bec:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803bef:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803bf3:	5b                   	pop    %rbx
+  803bf4:	41 5f                	pop    %r15
+  803bf6:	5d                   	pop    %rbp
+  803bf7:	c3                   	ret
+
+0000000000803bf8 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803bf8:	55                   	push   %rbp
+  803bf9:	48 89 e5             	mov    %rsp,%rbp
+  803bfc:	41 57                	push   %r15
+  803bfe:	53                   	push   %rbx
+  803bff:	48 83 ec 20          	sub    $0x20,%rsp
+  803c03:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c03 <devfile_stat+0xb>
+  803c0a:	49 bb 35 44 00 00 00 	movabs $0x4435,%r11
+  803c11:	00 00 00 
+  803c14:	4c 01 db             	add    %r11,%rbx
+  803c17:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803c1b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803c1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c23:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c26:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803c2d:	00 00 00 
+  803c30:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803c33:	be 00 00 00 00       	mov    $0x0,%esi
+  803c38:	bf 05 00 00 00       	mov    $0x5,%edi
+  803c3d:	48 b8 6d b5 ff ff ff 	movabs $0xffffffffffffb56d,%rax
+  803c44:	ff ff ff 
+  803c47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c4b:	ff d0                	call   *%rax
+  803c4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c50:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c54:	79 05                	jns    803c5b <devfile_stat+0x63>
+		return r;
+  803c56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c59:	eb 65                	jmp    803cc0 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c5b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c5f:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803c66:	00 00 00 
+  803c69:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803c6d:	48 89 d6             	mov    %rdx,%rsi
+  803c70:	48 89 c7             	mov    %rax,%rdi
+  803c73:	49 89 df             	mov    %rbx,%r15
+  803c76:	48 b8 87 93 ff ff ff 	movabs $0xffffffffffff9387,%rax
+  803c7d:	ff ff ff 
+  803c80:	48 01 d8             	add    %rbx,%rax
+  803c83:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803c85:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803c8c:	00 00 00 
+  803c8f:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803c96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c9a:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ca0:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803ca7:	00 00 00 
+  803caa:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803cb1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cb5:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cc0:	48 83 c4 20          	add    $0x20,%rsp
+  803cc4:	5b                   	pop    %rbx
+  803cc5:	41 5f                	pop    %r15
+  803cc7:	5d                   	pop    %rbp
+  803cc8:	c3                   	ret
+
+0000000000803cc9 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803cc9:	55                   	push   %rbp
+  803cca:	48 89 e5             	mov    %rsp,%rbp
+  803ccd:	48 83 ec 20          	sub    $0x20,%rsp
+  803cd1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cd1 <devfile_trunc+0x8>
+  803cd8:	49 bb 67 43 00 00 00 	movabs $0x4367,%r11
+  803cdf:	00 00 00 
+  803ce2:	4c 01 d8             	add    %r11,%rax
+  803ce5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803ce9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803cec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803cf0:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803cf3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803cf6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803cf9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803cfc:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803d00:	ba 08 00 00 00       	mov    $0x8,%edx
+  803d05:	48 89 ce             	mov    %rcx,%rsi
+  803d08:	bf 02 00 00 00       	mov    $0x2,%edi
+  803d0d:	48 b9 15 b6 ff ff ff 	movabs $0xffffffffffffb615,%rcx
+  803d14:	ff ff ff 
+  803d17:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803d1b:	ff d0                	call   *%rax
+}
+  803d1d:	c9                   	leave
+  803d1e:	c3                   	ret
+
+0000000000803d1f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803d1f:	55                   	push   %rbp
+  803d20:	48 89 e5             	mov    %rsp,%rbp
+  803d23:	41 57                	push   %r15
+  803d25:	53                   	push   %rbx
+  803d26:	48 83 ec 10          	sub    $0x10,%rsp
+  803d2a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d2a <remove+0xb>
+  803d31:	49 bb 0e 43 00 00 00 	movabs $0x430e,%r11
+  803d38:	00 00 00 
+  803d3b:	4c 01 db             	add    %r11,%rbx
+  803d3e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803d42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d46:	48 89 c7             	mov    %rax,%rdi
+  803d49:	49 89 df             	mov    %rbx,%r15
+  803d4c:	48 b8 f3 92 ff ff ff 	movabs $0xffffffffffff92f3,%rax
+  803d53:	ff ff ff 
+  803d56:	48 01 d8             	add    %rbx,%rax
+  803d59:	ff d0                	call   *%rax
+  803d5b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803d60:	7e 07                	jle    803d69 <remove+0x4a>
+		return -E_BAD_PATH;
+  803d62:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803d67:	eb 44                	jmp    803dad <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803d69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d6d:	48 89 c6             	mov    %rax,%rsi
+  803d70:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803d77:	00 00 00 
+  803d7a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d7e:	48 89 c7             	mov    %rax,%rdi
+  803d81:	49 89 df             	mov    %rbx,%r15
+  803d84:	48 b8 87 93 ff ff ff 	movabs $0xffffffffffff9387,%rax
+  803d8b:	ff ff ff 
+  803d8e:	48 01 d8             	add    %rbx,%rax
+  803d91:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803d93:	be 00 00 00 00       	mov    $0x0,%esi
+  803d98:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d9d:	48 b8 6d b5 ff ff ff 	movabs $0xffffffffffffb56d,%rax
+  803da4:	ff ff ff 
+  803da7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dab:	ff d0                	call   *%rax
+}
+  803dad:	48 83 c4 10          	add    $0x10,%rsp
+  803db1:	5b                   	pop    %rbx
+  803db2:	41 5f                	pop    %r15
+  803db4:	5d                   	pop    %rbp
+  803db5:	c3                   	ret
+
+0000000000803db6 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803db6:	55                   	push   %rbp
+  803db7:	48 89 e5             	mov    %rsp,%rbp
+  803dba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803dba <sync+0x4>
+  803dc1:	49 bb 7e 42 00 00 00 	movabs $0x427e,%r11
+  803dc8:	00 00 00 
+  803dcb:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803dce:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd3:	be 00 00 00 00       	mov    $0x0,%esi
+  803dd8:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ddd:	48 b9 15 b6 ff ff ff 	movabs $0xffffffffffffb615,%rcx
+  803de4:	ff ff ff 
+  803de7:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803deb:	ff d0                	call   *%rax
+}
+  803ded:	5d                   	pop    %rbp
+  803dee:	c3                   	ret
+
+0000000000803def <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803def:	55                   	push   %rbp
+  803df0:	48 89 e5             	mov    %rsp,%rbp
+  803df3:	41 57                	push   %r15
+  803df5:	53                   	push   %rbx
+  803df6:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803dfd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803dfd <copy+0xe>
+  803e04:	49 bb 3b 42 00 00 00 	movabs $0x423b,%r11
+  803e0b:	00 00 00 
+  803e0e:	4c 01 db             	add    %r11,%rbx
+  803e11:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803e18:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803e1f:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803e26:	be 00 00 00 00       	mov    $0x0,%esi
+  803e2b:	48 89 c7             	mov    %rax,%rdi
+  803e2e:	48 b8 b4 b7 ff ff ff 	movabs $0xffffffffffffb7b4,%rax
+  803e35:	ff ff ff 
+  803e38:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e3c:	ff d0                	call   *%rax
+  803e3e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803e41:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e45:	79 35                	jns    803e7c <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803e47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e4a:	89 c6                	mov    %eax,%esi
+  803e4c:	48 b8 9e e6 ff ff ff 	movabs $0xffffffffffffe69e,%rax
+  803e53:	ff ff ff 
+  803e56:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e5a:	48 89 c7             	mov    %rax,%rdi
+  803e5d:	49 89 df             	mov    %rbx,%r15
+  803e60:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e65:	48 ba c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rdx
+  803e6c:	ff ff ff 
+  803e6f:	48 01 da             	add    %rbx,%rdx
+  803e72:	ff d2                	call   *%rdx
+		return fd_src;
+  803e74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e77:	e9 d7 01 00 00       	jmp    804053 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803e7c:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803e83:	be 01 01 00 00       	mov    $0x101,%esi
+  803e88:	48 89 c7             	mov    %rax,%rdi
+  803e8b:	48 b8 b4 b7 ff ff ff 	movabs $0xffffffffffffb7b4,%rax
+  803e92:	ff ff ff 
+  803e95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e99:	ff d0                	call   *%rax
+  803e9b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803e9e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803ea2:	0f 89 df 00 00 00    	jns    803f87 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803ea8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803eab:	89 c6                	mov    %eax,%esi
+  803ead:	48 b8 b4 e6 ff ff ff 	movabs $0xffffffffffffe6b4,%rax
+  803eb4:	ff ff ff 
+  803eb7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ebb:	48 89 c7             	mov    %rax,%rdi
+  803ebe:	49 89 df             	mov    %rbx,%r15
+  803ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec6:	48 ba c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rdx
+  803ecd:	ff ff ff 
+  803ed0:	48 01 da             	add    %rbx,%rdx
+  803ed3:	ff d2                	call   *%rdx
+		close(fd_src);
+  803ed5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ed8:	89 c7                	mov    %eax,%edi
+  803eda:	49 89 df             	mov    %rbx,%r15
+  803edd:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  803ee4:	ff ff ff 
+  803ee7:	48 01 d8             	add    %rbx,%rax
+  803eea:	ff d0                	call   *%rax
+		return fd_dest;
+  803eec:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803eef:	e9 5f 01 00 00       	jmp    804053 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803ef4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ef7:	48 63 d0             	movslq %eax,%rdx
+  803efa:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803f01:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f04:	48 89 ce             	mov    %rcx,%rsi
+  803f07:	89 c7                	mov    %eax,%edi
+  803f09:	49 89 df             	mov    %rbx,%r15
+  803f0c:	48 b8 8b b1 ff ff ff 	movabs $0xffffffffffffb18b,%rax
+  803f13:	ff ff ff 
+  803f16:	48 01 d8             	add    %rbx,%rax
+  803f19:	ff d0                	call   *%rax
+  803f1b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803f1e:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803f22:	79 63                	jns    803f87 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803f24:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803f27:	89 c6                	mov    %eax,%esi
+  803f29:	48 b8 ce e6 ff ff ff 	movabs $0xffffffffffffe6ce,%rax
+  803f30:	ff ff ff 
+  803f33:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f37:	48 89 c7             	mov    %rax,%rdi
+  803f3a:	49 89 df             	mov    %rbx,%r15
+  803f3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f42:	48 ba c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rdx
+  803f49:	ff ff ff 
+  803f4c:	48 01 da             	add    %rbx,%rdx
+  803f4f:	ff d2                	call   *%rdx
+			close(fd_src);
+  803f51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f54:	89 c7                	mov    %eax,%edi
+  803f56:	49 89 df             	mov    %rbx,%r15
+  803f59:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  803f60:	ff ff ff 
+  803f63:	48 01 d8             	add    %rbx,%rax
+  803f66:	ff d0                	call   *%rax
+			close(fd_dest);
+  803f68:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f6b:	89 c7                	mov    %eax,%edi
+  803f6d:	49 89 df             	mov    %rbx,%r15
+  803f70:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  803f77:	ff ff ff 
+  803f7a:	48 01 d8             	add    %rbx,%rax
+  803f7d:	ff d0                	call   *%rax
+			return write_size;
+  803f7f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803f82:	e9 cc 00 00 00       	jmp    804053 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803f87:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803f8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f91:	ba 00 02 00 00       	mov    $0x200,%edx
+  803f96:	48 89 ce             	mov    %rcx,%rsi
+  803f99:	89 c7                	mov    %eax,%edi
+  803f9b:	49 89 df             	mov    %rbx,%r15
+  803f9e:	48 b8 e5 af ff ff ff 	movabs $0xffffffffffffafe5,%rax
+  803fa5:	ff ff ff 
+  803fa8:	48 01 d8             	add    %rbx,%rax
+  803fab:	ff d0                	call   *%rax
+  803fad:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803fb0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803fb4:	0f 8f 3a ff ff ff    	jg     803ef4 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803fba:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803fbe:	79 60                	jns    804020 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803fc0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fc3:	89 c6                	mov    %eax,%esi
+  803fc5:	48 b8 e1 e6 ff ff ff 	movabs $0xffffffffffffe6e1,%rax
+  803fcc:	ff ff ff 
+  803fcf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fd3:	48 89 c7             	mov    %rax,%rdi
+  803fd6:	49 89 df             	mov    %rbx,%r15
+  803fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fde:	48 ba c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%rdx
+  803fe5:	ff ff ff 
+  803fe8:	48 01 da             	add    %rbx,%rdx
+  803feb:	ff d2                	call   *%rdx
+		close(fd_src);
+  803fed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ff0:	89 c7                	mov    %eax,%edi
+  803ff2:	49 89 df             	mov    %rbx,%r15
+  803ff5:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  803ffc:	ff ff ff 
+  803fff:	48 01 d8             	add    %rbx,%rax
+  804002:	ff d0                	call   *%rax
+		close(fd_dest);
+  804004:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804007:	89 c7                	mov    %eax,%edi
+  804009:	49 89 df             	mov    %rbx,%r15
+  80400c:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  804013:	ff ff ff 
+  804016:	48 01 d8             	add    %rbx,%rax
+  804019:	ff d0                	call   *%rax
+		return read_size;
+  80401b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80401e:	eb 33                	jmp    804053 <copy+0x264>
+	}
+	close(fd_src);
+  804020:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804023:	89 c7                	mov    %eax,%edi
+  804025:	49 89 df             	mov    %rbx,%r15
+  804028:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  80402f:	ff ff ff 
+  804032:	48 01 d8             	add    %rbx,%rax
+  804035:	ff d0                	call   *%rax
+	close(fd_dest);
+  804037:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80403a:	89 c7                	mov    %eax,%edi
+  80403c:	49 89 df             	mov    %rbx,%r15
+  80403f:	48 b8 2d ad ff ff ff 	movabs $0xffffffffffffad2d,%rax
+  804046:	ff ff ff 
+  804049:	48 01 d8             	add    %rbx,%rax
+  80404c:	ff d0                	call   *%rax
+	return 0;
+  80404e:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804053:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  80405a:	5b                   	pop    %rbx
+  80405b:	41 5f                	pop    %r15
+  80405d:	5d                   	pop    %rbp
+  80405e:	c3                   	ret
+
+000000000080405f <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  80405f:	55                   	push   %rbp
+  804060:	48 89 e5             	mov    %rsp,%rbp
+  804063:	41 57                	push   %r15
+  804065:	53                   	push   %rbx
+  804066:	48 83 ec 20          	sub    $0x20,%rsp
+  80406a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80406a <fd2sockid+0xb>
+  804071:	49 bb ce 3f 00 00 00 	movabs $0x3fce,%r11
+  804078:	00 00 00 
+  80407b:	4c 01 db             	add    %r11,%rbx
+  80407e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804081:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804085:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804088:	48 89 d6             	mov    %rdx,%rsi
+  80408b:	89 c7                	mov    %eax,%edi
+  80408d:	49 89 df             	mov    %rbx,%r15
+  804090:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  804097:	ff ff ff 
+  80409a:	48 01 d8             	add    %rbx,%rax
+  80409d:	ff d0                	call   *%rax
+  80409f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040a6:	79 05                	jns    8040ad <fd2sockid+0x4e>
+		return r;
+  8040a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040ab:	eb 25                	jmp    8040d2 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8040ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040b1:	8b 10                	mov    (%rax),%edx
+  8040b3:	48 b8 88 00 00 00 00 	movabs $0x88,%rax
+  8040ba:	00 00 00 
+  8040bd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8040c0:	39 c2                	cmp    %eax,%edx
+  8040c2:	74 07                	je     8040cb <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8040c4:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8040c9:	eb 07                	jmp    8040d2 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8040cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040cf:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8040d2:	48 83 c4 20          	add    $0x20,%rsp
+  8040d6:	5b                   	pop    %rbx
+  8040d7:	41 5f                	pop    %r15
+  8040d9:	5d                   	pop    %rbp
+  8040da:	c3                   	ret
+
+00000000008040db <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8040db:	55                   	push   %rbp
+  8040dc:	48 89 e5             	mov    %rsp,%rbp
+  8040df:	41 57                	push   %r15
+  8040e1:	53                   	push   %rbx
+  8040e2:	48 83 ec 20          	sub    $0x20,%rsp
+  8040e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040e6 <alloc_sockfd+0xb>
+  8040ed:	49 bb 52 3f 00 00 00 	movabs $0x3f52,%r11
+  8040f4:	00 00 00 
+  8040f7:	4c 01 db             	add    %r11,%rbx
+  8040fa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8040fd:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804101:	48 89 c7             	mov    %rax,%rdi
+  804104:	49 89 df             	mov    %rbx,%r15
+  804107:	48 b8 e8 a9 ff ff ff 	movabs $0xffffffffffffa9e8,%rax
+  80410e:	ff ff ff 
+  804111:	48 01 d8             	add    %rbx,%rax
+  804114:	ff d0                	call   *%rax
+  804116:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804119:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80411d:	78 2c                	js     80414b <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80411f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804123:	ba 07 04 00 00       	mov    $0x407,%edx
+  804128:	48 89 c6             	mov    %rax,%rsi
+  80412b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804130:	49 89 df             	mov    %rbx,%r15
+  804133:	48 b8 43 a0 ff ff ff 	movabs $0xffffffffffffa043,%rax
+  80413a:	ff ff ff 
+  80413d:	48 01 d8             	add    %rbx,%rax
+  804140:	ff d0                	call   *%rax
+  804142:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804145:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804149:	79 1c                	jns    804167 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80414b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80414e:	89 c7                	mov    %eax,%edi
+  804150:	49 89 df             	mov    %rbx,%r15
+  804153:	48 b8 97 c8 ff ff ff 	movabs $0xffffffffffffc897,%rax
+  80415a:	ff ff ff 
+  80415d:	48 01 d8             	add    %rbx,%rax
+  804160:	ff d0                	call   *%rax
+		return r;
+  804162:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804165:	eb 41                	jmp    8041a8 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804167:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80416b:	48 ba 88 00 00 00 00 	movabs $0x88,%rdx
+  804172:	00 00 00 
+  804175:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804178:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  80417a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80417e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804185:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804189:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80418c:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  80418f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804193:	48 89 c7             	mov    %rax,%rdi
+  804196:	49 89 df             	mov    %rbx,%r15
+  804199:	48 b8 6e a9 ff ff ff 	movabs $0xffffffffffffa96e,%rax
+  8041a0:	ff ff ff 
+  8041a3:	48 01 d8             	add    %rbx,%rax
+  8041a6:	ff d0                	call   *%rax
+}
+  8041a8:	48 83 c4 20          	add    $0x20,%rsp
+  8041ac:	5b                   	pop    %rbx
+  8041ad:	41 5f                	pop    %r15
+  8041af:	5d                   	pop    %rbp
+  8041b0:	c3                   	ret
+
+00000000008041b1 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8041b1:	55                   	push   %rbp
+  8041b2:	48 89 e5             	mov    %rsp,%rbp
+  8041b5:	41 57                	push   %r15
+  8041b7:	53                   	push   %rbx
+  8041b8:	48 83 ec 30          	sub    $0x30,%rsp
+  8041bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041bc <accept+0xb>
+  8041c3:	49 bb 7c 3e 00 00 00 	movabs $0x3e7c,%r11
+  8041ca:	00 00 00 
+  8041cd:	4c 01 db             	add    %r11,%rbx
+  8041d0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8041d3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8041d7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8041db:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041de:	89 c7                	mov    %eax,%edi
+  8041e0:	48 b8 27 c0 ff ff ff 	movabs $0xffffffffffffc027,%rax
+  8041e7:	ff ff ff 
+  8041ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041ee:	ff d0                	call   *%rax
+  8041f0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041f7:	79 05                	jns    8041fe <accept+0x4d>
+		return r;
+  8041f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041fc:	eb 45                	jmp    804243 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8041fe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804202:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804206:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804209:	48 89 ce             	mov    %rcx,%rsi
+  80420c:	89 c7                	mov    %eax,%edi
+  80420e:	49 89 df             	mov    %rbx,%r15
+  804211:	48 b8 05 c7 ff ff ff 	movabs $0xffffffffffffc705,%rax
+  804218:	ff ff ff 
+  80421b:	48 01 d8             	add    %rbx,%rax
+  80421e:	ff d0                	call   *%rax
+  804220:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804223:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804227:	79 05                	jns    80422e <accept+0x7d>
+		return r;
+  804229:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80422c:	eb 15                	jmp    804243 <accept+0x92>
+	return alloc_sockfd(r);
+  80422e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804231:	89 c7                	mov    %eax,%edi
+  804233:	48 b8 a3 c0 ff ff ff 	movabs $0xffffffffffffc0a3,%rax
+  80423a:	ff ff ff 
+  80423d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804241:	ff d0                	call   *%rax
+}
+  804243:	48 83 c4 30          	add    $0x30,%rsp
+  804247:	5b                   	pop    %rbx
+  804248:	41 5f                	pop    %r15
+  80424a:	5d                   	pop    %rbp
+  80424b:	c3                   	ret
+
+000000000080424c <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80424c:	55                   	push   %rbp
+  80424d:	48 89 e5             	mov    %rsp,%rbp
+  804250:	41 57                	push   %r15
+  804252:	53                   	push   %rbx
+  804253:	48 83 ec 20          	sub    $0x20,%rsp
+  804257:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804257 <bind+0xb>
+  80425e:	49 bb e1 3d 00 00 00 	movabs $0x3de1,%r11
+  804265:	00 00 00 
+  804268:	4c 01 db             	add    %r11,%rbx
+  80426b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80426e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804272:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804275:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804278:	89 c7                	mov    %eax,%edi
+  80427a:	48 b8 27 c0 ff ff ff 	movabs $0xffffffffffffc027,%rax
+  804281:	ff ff ff 
+  804284:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804288:	ff d0                	call   *%rax
+  80428a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80428d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804291:	79 05                	jns    804298 <bind+0x4c>
+		return r;
+  804293:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804296:	eb 21                	jmp    8042b9 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804298:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80429b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80429f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042a2:	48 89 ce             	mov    %rcx,%rsi
+  8042a5:	89 c7                	mov    %eax,%edi
+  8042a7:	49 89 df             	mov    %rbx,%r15
+  8042aa:	48 b8 b1 c7 ff ff ff 	movabs $0xffffffffffffc7b1,%rax
+  8042b1:	ff ff ff 
+  8042b4:	48 01 d8             	add    %rbx,%rax
+  8042b7:	ff d0                	call   *%rax
+}
+  8042b9:	48 83 c4 20          	add    $0x20,%rsp
+  8042bd:	5b                   	pop    %rbx
+  8042be:	41 5f                	pop    %r15
+  8042c0:	5d                   	pop    %rbp
+  8042c1:	c3                   	ret
+
+00000000008042c2 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8042c2:	55                   	push   %rbp
+  8042c3:	48 89 e5             	mov    %rsp,%rbp
+  8042c6:	41 57                	push   %r15
+  8042c8:	53                   	push   %rbx
+  8042c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8042cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042cd <shutdown+0xb>
+  8042d4:	49 bb 6b 3d 00 00 00 	movabs $0x3d6b,%r11
+  8042db:	00 00 00 
+  8042de:	4c 01 db             	add    %r11,%rbx
+  8042e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8042e4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8042e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8042ea:	89 c7                	mov    %eax,%edi
+  8042ec:	48 b8 27 c0 ff ff ff 	movabs $0xffffffffffffc027,%rax
+  8042f3:	ff ff ff 
+  8042f6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042fa:	ff d0                	call   *%rax
+  8042fc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042ff:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804303:	79 05                	jns    80430a <shutdown+0x48>
+		return r;
+  804305:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804308:	eb 1c                	jmp    804326 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  80430a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80430d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804310:	89 d6                	mov    %edx,%esi
+  804312:	89 c7                	mov    %eax,%edi
+  804314:	49 89 df             	mov    %rbx,%r15
+  804317:	48 b8 46 c8 ff ff ff 	movabs $0xffffffffffffc846,%rax
+  80431e:	ff ff ff 
+  804321:	48 01 d8             	add    %rbx,%rax
+  804324:	ff d0                	call   *%rax
+}
+  804326:	48 83 c4 20          	add    $0x20,%rsp
+  80432a:	5b                   	pop    %rbx
+  80432b:	41 5f                	pop    %r15
+  80432d:	5d                   	pop    %rbp
+  80432e:	c3                   	ret
+
+000000000080432f <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  80432f:	55                   	push   %rbp
+  804330:	48 89 e5             	mov    %rsp,%rbp
+  804333:	41 57                	push   %r15
+  804335:	53                   	push   %rbx
+  804336:	48 83 ec 10          	sub    $0x10,%rsp
+  80433a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80433a <devsock_close+0xb>
+  804341:	49 bb fe 3c 00 00 00 	movabs $0x3cfe,%r11
+  804348:	00 00 00 
+  80434b:	4c 01 db             	add    %r11,%rbx
+  80434e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804352:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804356:	48 89 c7             	mov    %rax,%rdi
+  804359:	49 89 df             	mov    %rbx,%r15
+  80435c:	48 b8 43 e0 ff ff ff 	movabs $0xffffffffffffe043,%rax
+  804363:	ff ff ff 
+  804366:	48 01 d8             	add    %rbx,%rax
+  804369:	ff d0                	call   *%rax
+  80436b:	83 f8 01             	cmp    $0x1,%eax
+  80436e:	75 1d                	jne    80438d <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804370:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804374:	8b 40 0c             	mov    0xc(%rax),%eax
+  804377:	89 c7                	mov    %eax,%edi
+  804379:	49 89 df             	mov    %rbx,%r15
+  80437c:	48 b8 97 c8 ff ff ff 	movabs $0xffffffffffffc897,%rax
+  804383:	ff ff ff 
+  804386:	48 01 d8             	add    %rbx,%rax
+  804389:	ff d0                	call   *%rax
+  80438b:	eb 05                	jmp    804392 <devsock_close+0x63>
+	else
+		return 0;
+  80438d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804392:	48 83 c4 10          	add    $0x10,%rsp
+  804396:	5b                   	pop    %rbx
+  804397:	41 5f                	pop    %r15
+  804399:	5d                   	pop    %rbp
+  80439a:	c3                   	ret
+
+000000000080439b <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80439b:	55                   	push   %rbp
+  80439c:	48 89 e5             	mov    %rsp,%rbp
+  80439f:	41 57                	push   %r15
+  8043a1:	53                   	push   %rbx
+  8043a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8043a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043a6 <connect+0xb>
+  8043ad:	49 bb 92 3c 00 00 00 	movabs $0x3c92,%r11
+  8043b4:	00 00 00 
+  8043b7:	4c 01 db             	add    %r11,%rbx
+  8043ba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8043bd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8043c1:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8043c4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043c7:	89 c7                	mov    %eax,%edi
+  8043c9:	48 b8 27 c0 ff ff ff 	movabs $0xffffffffffffc027,%rax
+  8043d0:	ff ff ff 
+  8043d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043d7:	ff d0                	call   *%rax
+  8043d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043dc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043e0:	79 05                	jns    8043e7 <connect+0x4c>
+		return r;
+  8043e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043e5:	eb 21                	jmp    804408 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8043e7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8043ea:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8043ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043f1:	48 89 ce             	mov    %rcx,%rsi
+  8043f4:	89 c7                	mov    %eax,%edi
+  8043f6:	49 89 df             	mov    %rbx,%r15
+  8043f9:	48 b8 df c8 ff ff ff 	movabs $0xffffffffffffc8df,%rax
+  804400:	ff ff ff 
+  804403:	48 01 d8             	add    %rbx,%rax
+  804406:	ff d0                	call   *%rax
+}
+  804408:	48 83 c4 20          	add    $0x20,%rsp
+  80440c:	5b                   	pop    %rbx
+  80440d:	41 5f                	pop    %r15
+  80440f:	5d                   	pop    %rbp
+  804410:	c3                   	ret
+
+0000000000804411 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804411:	55                   	push   %rbp
+  804412:	48 89 e5             	mov    %rsp,%rbp
+  804415:	41 57                	push   %r15
+  804417:	53                   	push   %rbx
+  804418:	48 83 ec 20          	sub    $0x20,%rsp
+  80441c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80441c <listen+0xb>
+  804423:	49 bb 1c 3c 00 00 00 	movabs $0x3c1c,%r11
+  80442a:	00 00 00 
+  80442d:	4c 01 db             	add    %r11,%rbx
+  804430:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804433:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804436:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804439:	89 c7                	mov    %eax,%edi
+  80443b:	48 b8 27 c0 ff ff ff 	movabs $0xffffffffffffc027,%rax
+  804442:	ff ff ff 
+  804445:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804449:	ff d0                	call   *%rax
+  80444b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80444e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804452:	79 05                	jns    804459 <listen+0x48>
+		return r;
+  804454:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804457:	eb 1c                	jmp    804475 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804459:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80445c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80445f:	89 d6                	mov    %edx,%esi
+  804461:	89 c7                	mov    %eax,%edi
+  804463:	49 89 df             	mov    %rbx,%r15
+  804466:	48 b8 74 c9 ff ff ff 	movabs $0xffffffffffffc974,%rax
+  80446d:	ff ff ff 
+  804470:	48 01 d8             	add    %rbx,%rax
+  804473:	ff d0                	call   *%rax
+}
+  804475:	48 83 c4 20          	add    $0x20,%rsp
+  804479:	5b                   	pop    %rbx
+  80447a:	41 5f                	pop    %r15
+  80447c:	5d                   	pop    %rbp
+  80447d:	c3                   	ret
+
+000000000080447e <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  80447e:	55                   	push   %rbp
+  80447f:	48 89 e5             	mov    %rsp,%rbp
+  804482:	41 57                	push   %r15
+  804484:	48 83 ec 28          	sub    $0x28,%rsp
+  804488:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804488 <devsock_read+0xa>
+  80448f:	49 bb b0 3b 00 00 00 	movabs $0x3bb0,%r11
+  804496:	00 00 00 
+  804499:	4c 01 d8             	add    %r11,%rax
+  80449c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8044a0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8044a4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8044a8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8044ac:	41 89 d0             	mov    %edx,%r8d
+  8044af:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8044b3:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8044b6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8044ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8044bf:	44 89 c2             	mov    %r8d,%edx
+  8044c2:	49 89 c7             	mov    %rax,%r15
+  8044c5:	49 b8 c5 c9 ff ff ff 	movabs $0xffffffffffffc9c5,%r8
+  8044cc:	ff ff ff 
+  8044cf:	49 01 c0             	add    %rax,%r8
+  8044d2:	41 ff d0             	call   *%r8
+}
+  8044d5:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8044d9:	c9                   	leave
+  8044da:	c3                   	ret
+
+00000000008044db <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8044db:	55                   	push   %rbp
+  8044dc:	48 89 e5             	mov    %rsp,%rbp
+  8044df:	41 57                	push   %r15
+  8044e1:	48 83 ec 28          	sub    $0x28,%rsp
+  8044e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044e5 <devsock_write+0xa>
+  8044ec:	49 bb 53 3b 00 00 00 	movabs $0x3b53,%r11
+  8044f3:	00 00 00 
+  8044f6:	4c 01 d8             	add    %r11,%rax
+  8044f9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8044fd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804501:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804505:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804509:	41 89 d0             	mov    %edx,%r8d
+  80450c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804510:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804513:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804517:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80451c:	44 89 c2             	mov    %r8d,%edx
+  80451f:	49 89 c7             	mov    %rax,%r15
+  804522:	49 b8 e2 ca ff ff ff 	movabs $0xffffffffffffcae2,%r8
+  804529:	ff ff ff 
+  80452c:	49 01 c0             	add    %rax,%r8
+  80452f:	41 ff d0             	call   *%r8
+}
+  804532:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804536:	c9                   	leave
+  804537:	c3                   	ret
+
+0000000000804538 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  804538:	55                   	push   %rbp
+  804539:	48 89 e5             	mov    %rsp,%rbp
+  80453c:	41 57                	push   %r15
+  80453e:	48 83 ec 18          	sub    $0x18,%rsp
+  804542:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804542 <devsock_stat+0xa>
+  804549:	49 bb f6 3a 00 00 00 	movabs $0x3af6,%r11
+  804550:	00 00 00 
+  804553:	4c 01 d8             	add    %r11,%rax
+  804556:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80455a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  80455e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804562:	48 b9 fc e6 ff ff ff 	movabs $0xffffffffffffe6fc,%rcx
+  804569:	ff ff ff 
+  80456c:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804570:	48 89 ce             	mov    %rcx,%rsi
+  804573:	48 89 d7             	mov    %rdx,%rdi
+  804576:	49 89 c7             	mov    %rax,%r15
+  804579:	48 ba 87 93 ff ff ff 	movabs $0xffffffffffff9387,%rdx
+  804580:	ff ff ff 
+  804583:	48 01 c2             	add    %rax,%rdx
+  804586:	ff d2                	call   *%rdx
+	return 0;
+  804588:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80458d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804591:	c9                   	leave
+  804592:	c3                   	ret
+
+0000000000804593 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804593:	55                   	push   %rbp
+  804594:	48 89 e5             	mov    %rsp,%rbp
+  804597:	41 57                	push   %r15
+  804599:	53                   	push   %rbx
+  80459a:	48 83 ec 20          	sub    $0x20,%rsp
+  80459e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80459e <socket+0xb>
+  8045a5:	49 bb 9a 3a 00 00 00 	movabs $0x3a9a,%r11
+  8045ac:	00 00 00 
+  8045af:	4c 01 db             	add    %r11,%rbx
+  8045b2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8045b5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8045b8:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8045bb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8045be:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8045c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045c4:	89 ce                	mov    %ecx,%esi
+  8045c6:	89 c7                	mov    %eax,%edi
+  8045c8:	49 89 df             	mov    %rbx,%r15
+  8045cb:	48 b8 b9 cc ff ff ff 	movabs $0xffffffffffffccb9,%rax
+  8045d2:	ff ff ff 
+  8045d5:	48 01 d8             	add    %rbx,%rax
+  8045d8:	ff d0                	call   *%rax
+  8045da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8045dd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045e1:	79 05                	jns    8045e8 <socket+0x55>
+		return r;
+  8045e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045e6:	eb 15                	jmp    8045fd <socket+0x6a>
+	return alloc_sockfd(r);
+  8045e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045eb:	89 c7                	mov    %eax,%edi
+  8045ed:	48 b8 a3 c0 ff ff ff 	movabs $0xffffffffffffc0a3,%rax
+  8045f4:	ff ff ff 
+  8045f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045fb:	ff d0                	call   *%rax
+}
+  8045fd:	48 83 c4 20          	add    $0x20,%rsp
+  804601:	5b                   	pop    %rbx
+  804602:	41 5f                	pop    %r15
+  804604:	5d                   	pop    %rbp
+  804605:	c3                   	ret
+
+0000000000804606 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  804606:	55                   	push   %rbp
+  804607:	48 89 e5             	mov    %rsp,%rbp
+  80460a:	41 57                	push   %r15
+  80460c:	53                   	push   %rbx
+  80460d:	48 83 ec 10          	sub    $0x10,%rsp
+  804611:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804611 <nsipc+0xb>
+  804618:	49 bb 27 3a 00 00 00 	movabs $0x3a27,%r11
+  80461f:	00 00 00 
+  804622:	4c 01 db             	add    %r11,%rbx
+  804625:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  804628:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  80462f:	00 00 00 
+  804632:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804635:	85 c0                	test   %eax,%eax
+  804637:	75 24                	jne    80465d <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804639:	bf 02 00 00 00       	mov    $0x2,%edi
+  80463e:	49 89 df             	mov    %rbx,%r15
+  804641:	48 b8 b4 df ff ff ff 	movabs $0xffffffffffffdfb4,%rax
+  804648:	ff ff ff 
+  80464b:	48 01 d8             	add    %rbx,%rax
+  80464e:	ff d0                	call   *%rax
+  804650:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  804657:	00 00 00 
+  80465a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  80465d:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804664:	00 00 00 
+  804667:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80466a:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80466d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804673:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804679:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80467e:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804685:	00 00 00 
+  804688:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80468c:	89 c7                	mov    %eax,%edi
+  80468e:	49 89 df             	mov    %rbx,%r15
+  804691:	48 b8 d3 d9 ff ff ff 	movabs $0xffffffffffffd9d3,%rax
+  804698:	ff ff ff 
+  80469b:	48 01 d8             	add    %rbx,%rax
+  80469e:	ff d0                	call   *%rax
+}
+  8046a0:	48 83 c4 10          	add    $0x10,%rsp
+  8046a4:	5b                   	pop    %rbx
+  8046a5:	41 5f                	pop    %r15
+  8046a7:	5d                   	pop    %rbp
+  8046a8:	c3                   	ret
+
+00000000008046a9 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8046a9:	55                   	push   %rbp
+  8046aa:	48 89 e5             	mov    %rsp,%rbp
+  8046ad:	41 57                	push   %r15
+  8046af:	53                   	push   %rbx
+  8046b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8046b4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046b4 <nsipc_words+0xb>
+  8046bb:	49 bb 84 39 00 00 00 	movabs $0x3984,%r11
+  8046c2:	00 00 00 
+  8046c5:	4c 01 db             	add    %r11,%rbx
+  8046c8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8046cb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8046cf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8046d3:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8046da:	00 00 00 
+  8046dd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8046e0:	85 c0                	test   %eax,%eax
+  8046e2:	75 24                	jne    804708 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8046e4:	bf 02 00 00 00       	mov    $0x2,%edi
+  8046e9:	49 89 df             	mov    %rbx,%r15
+  8046ec:	48 b8 b4 df ff ff ff 	movabs $0xffffffffffffdfb4,%rax
+  8046f3:	ff ff ff 
+  8046f6:	48 01 d8             	add    %rbx,%rax
+  8046f9:	ff d0                	call   *%rax
+  8046fb:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  804702:	00 00 00 
+  804705:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804708:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  80470f:	00 00 00 
+  804712:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804715:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804719:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80471d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804720:	89 c7                	mov    %eax,%edi
+  804722:	49 89 df             	mov    %rbx,%r15
+  804725:	48 b8 be da ff ff ff 	movabs $0xffffffffffffdabe,%rax
+  80472c:	ff ff ff 
+  80472f:	48 01 d8             	add    %rbx,%rax
+  804732:	ff d0                	call   *%rax
+}
+  804734:	48 83 c4 20          	add    $0x20,%rsp
+  804738:	5b                   	pop    %rbx
+  804739:	41 5f                	pop    %r15
+  80473b:	5d                   	pop    %rbp
+  80473c:	c3                   	ret
+
+000000000080473d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80473d:	55                   	push   %rbp
+  80473e:	48 89 e5             	mov    %rsp,%rbp
+  804741:	41 57                	push   %r15
+  804743:	53                   	push   %rbx
+  804744:	48 83 ec 30          	sub    $0x30,%rsp
+  804748:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804748 <nsipc_accept+0xb>
+  80474f:	49 bb f0 38 00 00 00 	movabs $0x38f0,%r11
+  804756:	00 00 00 
+  804759:	4c 01 db             	add    %r11,%rbx
+  80475c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80475f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804763:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  804767:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80476e:	00 00 00 
+  804771:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804774:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  804777:	bf 01 00 00 00       	mov    $0x1,%edi
+  80477c:	48 b8 ce c5 ff ff ff 	movabs $0xffffffffffffc5ce,%rax
+  804783:	ff ff ff 
+  804786:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80478a:	ff d0                	call   *%rax
+  80478c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80478f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804793:	78 48                	js     8047dd <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  804795:	48 b8 c8 3f 01 00 00 	movabs $0x13fc8,%rax
+  80479c:	00 00 00 
+  80479f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047a3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8047a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047ab:	8b 40 10             	mov    0x10(%rax),%eax
+  8047ae:	89 c2                	mov    %eax,%edx
+  8047b0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8047b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047b8:	48 89 ce             	mov    %rcx,%rsi
+  8047bb:	48 89 c7             	mov    %rax,%rdi
+  8047be:	49 89 df             	mov    %rbx,%r15
+  8047c1:	48 b8 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rax
+  8047c8:	ff ff ff 
+  8047cb:	48 01 d8             	add    %rbx,%rax
+  8047ce:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8047d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047d4:	8b 50 10             	mov    0x10(%rax),%edx
+  8047d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047db:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8047dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8047e0:	48 83 c4 30          	add    $0x30,%rsp
+  8047e4:	5b                   	pop    %rbx
+  8047e5:	41 5f                	pop    %r15
+  8047e7:	5d                   	pop    %rbp
+  8047e8:	c3                   	ret
+
+00000000008047e9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8047e9:	55                   	push   %rbp
+  8047ea:	48 89 e5             	mov    %rsp,%rbp
+  8047ed:	41 57                	push   %r15
+  8047ef:	53                   	push   %rbx
+  8047f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8047f4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047f4 <nsipc_bind+0xb>
+  8047fb:	49 bb 44 38 00 00 00 	movabs $0x3844,%r11
+  804802:	00 00 00 
+  804805:	4c 01 db             	add    %r11,%rbx
+  804808:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80480b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80480f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  804812:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804819:	00 00 00 
+  80481c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80481f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804822:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804825:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804829:	48 89 c6             	mov    %rax,%rsi
+  80482c:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  804833:	00 00 00 
+  804836:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80483a:	48 89 c7             	mov    %rax,%rdi
+  80483d:	49 89 df             	mov    %rbx,%r15
+  804840:	48 b8 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rax
+  804847:	ff ff ff 
+  80484a:	48 01 d8             	add    %rbx,%rax
+  80484d:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  80484f:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804856:	00 00 00 
+  804859:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80485c:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804860:	bf 02 00 00 00       	mov    $0x2,%edi
+  804865:	48 b8 ce c5 ff ff ff 	movabs $0xffffffffffffc5ce,%rax
+  80486c:	ff ff ff 
+  80486f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804873:	ff d0                	call   *%rax
+}
+  804875:	48 83 c4 10          	add    $0x10,%rsp
+  804879:	5b                   	pop    %rbx
+  80487a:	41 5f                	pop    %r15
+  80487c:	5d                   	pop    %rbp
+  80487d:	c3                   	ret
+
+000000000080487e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80487e:	55                   	push   %rbp
+  80487f:	48 89 e5             	mov    %rsp,%rbp
+  804882:	48 83 ec 20          	sub    $0x20,%rsp
+  804886:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804886 <nsipc_shutdown+0x8>
+  80488d:	49 bb b2 37 00 00 00 	movabs $0x37b2,%r11
+  804894:	00 00 00 
+  804897:	4c 01 d8             	add    %r11,%rax
+  80489a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80489d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8048a0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8048a3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8048a6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8048a9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8048ac:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8048b0:	ba 08 00 00 00       	mov    $0x8,%edx
+  8048b5:	48 89 ce             	mov    %rcx,%rsi
+  8048b8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8048bd:	48 b9 71 c6 ff ff ff 	movabs $0xffffffffffffc671,%rcx
+  8048c4:	ff ff ff 
+  8048c7:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8048cb:	ff d0                	call   *%rax
+}
+  8048cd:	c9                   	leave
+  8048ce:	c3                   	ret
+
+00000000008048cf <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8048cf:	55                   	push   %rbp
+  8048d0:	48 89 e5             	mov    %rsp,%rbp
+  8048d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8048d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8048d7 <nsipc_close+0x8>
+  8048de:	49 bb 61 37 00 00 00 	movabs $0x3761,%r11
+  8048e5:	00 00 00 
+  8048e8:	4c 01 d8             	add    %r11,%rax
+  8048eb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8048ee:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8048f1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8048f4:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8048f8:	ba 04 00 00 00       	mov    $0x4,%edx
+  8048fd:	48 89 ce             	mov    %rcx,%rsi
+  804900:	bf 04 00 00 00       	mov    $0x4,%edi
+  804905:	48 b9 71 c6 ff ff ff 	movabs $0xffffffffffffc671,%rcx
+  80490c:	ff ff ff 
+  80490f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804913:	ff d0                	call   *%rax
+}
+  804915:	c9                   	leave
+  804916:	c3                   	ret
+
+0000000000804917 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804917:	55                   	push   %rbp
+  804918:	48 89 e5             	mov    %rsp,%rbp
+  80491b:	41 57                	push   %r15
+  80491d:	53                   	push   %rbx
+  80491e:	48 83 ec 10          	sub    $0x10,%rsp
+  804922:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804922 <nsipc_connect+0xb>
+  804929:	49 bb 16 37 00 00 00 	movabs $0x3716,%r11
+  804930:	00 00 00 
+  804933:	4c 01 db             	add    %r11,%rbx
+  804936:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804939:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80493d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804940:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804947:	00 00 00 
+  80494a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80494d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804950:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804953:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804957:	48 89 c6             	mov    %rax,%rsi
+  80495a:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  804961:	00 00 00 
+  804964:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804968:	48 89 c7             	mov    %rax,%rdi
+  80496b:	49 89 df             	mov    %rbx,%r15
+  80496e:	48 b8 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rax
+  804975:	ff ff ff 
+  804978:	48 01 d8             	add    %rbx,%rax
+  80497b:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  80497d:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804984:	00 00 00 
+  804987:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80498a:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  80498e:	bf 05 00 00 00       	mov    $0x5,%edi
+  804993:	48 b8 ce c5 ff ff ff 	movabs $0xffffffffffffc5ce,%rax
+  80499a:	ff ff ff 
+  80499d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049a1:	ff d0                	call   *%rax
+}
+  8049a3:	48 83 c4 10          	add    $0x10,%rsp
+  8049a7:	5b                   	pop    %rbx
+  8049a8:	41 5f                	pop    %r15
+  8049aa:	5d                   	pop    %rbp
+  8049ab:	c3                   	ret
+
+00000000008049ac <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8049ac:	55                   	push   %rbp
+  8049ad:	48 89 e5             	mov    %rsp,%rbp
+  8049b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8049b4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8049b4 <nsipc_listen+0x8>
+  8049bb:	49 bb 84 36 00 00 00 	movabs $0x3684,%r11
+  8049c2:	00 00 00 
+  8049c5:	4c 01 d8             	add    %r11,%rax
+  8049c8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8049cb:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8049ce:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8049d1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8049d4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8049d7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8049da:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8049de:	ba 08 00 00 00       	mov    $0x8,%edx
+  8049e3:	48 89 ce             	mov    %rcx,%rsi
+  8049e6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8049eb:	48 b9 71 c6 ff ff ff 	movabs $0xffffffffffffc671,%rcx
+  8049f2:	ff ff ff 
+  8049f5:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8049f9:	ff d0                	call   *%rax
+}
+  8049fb:	c9                   	leave
+  8049fc:	c3                   	ret
+
+00000000008049fd <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8049fd:	55                   	push   %rbp
+  8049fe:	48 89 e5             	mov    %rsp,%rbp
+  804a01:	41 57                	push   %r15
+  804a03:	53                   	push   %rbx
+  804a04:	48 83 ec 30          	sub    $0x30,%rsp
+  804a08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a08 <nsipc_recv+0xb>
+  804a0f:	49 bb 30 36 00 00 00 	movabs $0x3630,%r11
+  804a16:	00 00 00 
+  804a19:	4c 01 db             	add    %r11,%rbx
+  804a1c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804a1f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a23:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  804a26:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804a29:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804a30:	00 00 00 
+  804a33:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a36:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  804a39:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804a40:	00 00 00 
+  804a43:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804a46:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804a4a:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804a51:	00 00 00 
+  804a54:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804a57:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804a5b:	bf 07 00 00 00       	mov    $0x7,%edi
+  804a60:	48 b8 ce c5 ff ff ff 	movabs $0xffffffffffffc5ce,%rax
+  804a67:	ff ff ff 
+  804a6a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a6e:	ff d0                	call   *%rax
+  804a70:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a73:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a77:	0f 88 91 00 00 00    	js     804b0e <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804a7d:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804a84:	7f 08                	jg     804a8e <nsipc_recv+0x91>
+  804a86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a89:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804a8c:	7e 50                	jle    804ade <nsipc_recv+0xe1>
+  804a8e:	48 b8 03 e7 ff ff ff 	movabs $0xffffffffffffe703,%rax
+  804a95:	ff ff ff 
+  804a98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a9c:	48 89 c1             	mov    %rax,%rcx
+  804a9f:	48 b8 18 e7 ff ff ff 	movabs $0xffffffffffffe718,%rax
+  804aa6:	ff ff ff 
+  804aa9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804aad:	48 89 c2             	mov    %rax,%rdx
+  804ab0:	be 79 00 00 00       	mov    $0x79,%esi
+  804ab5:	48 b8 2d e7 ff ff ff 	movabs $0xffffffffffffe72d,%rax
+  804abc:	ff ff ff 
+  804abf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ac3:	48 89 c7             	mov    %rax,%rdi
+  804ac6:	49 89 df             	mov    %rbx,%r15
+  804ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ace:	49 b8 ee 82 ff ff ff 	movabs $0xffffffffffff82ee,%r8
+  804ad5:	ff ff ff 
+  804ad8:	49 01 d8             	add    %rbx,%r8
+  804adb:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804ade:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ae1:	48 63 d0             	movslq %eax,%rdx
+  804ae4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ae8:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804aef:	00 00 00 
+  804af2:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  804af6:	48 89 ce             	mov    %rcx,%rsi
+  804af9:	48 89 c7             	mov    %rax,%rdi
+  804afc:	49 89 df             	mov    %rbx,%r15
+  804aff:	48 b8 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rax
+  804b06:	ff ff ff 
+  804b09:	48 01 d8             	add    %rbx,%rax
+  804b0c:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804b0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804b11:	48 83 c4 30          	add    $0x30,%rsp
+  804b15:	5b                   	pop    %rbx
+  804b16:	41 5f                	pop    %r15
+  804b18:	5d                   	pop    %rbp
+  804b19:	c3                   	ret
+
+0000000000804b1a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804b1a:	55                   	push   %rbp
+  804b1b:	48 89 e5             	mov    %rsp,%rbp
+  804b1e:	41 57                	push   %r15
+  804b20:	53                   	push   %rbx
+  804b21:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804b28:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b28 <nsipc_send+0xe>
+  804b2f:	49 bb 10 35 00 00 00 	movabs $0x3510,%r11
+  804b36:	00 00 00 
+  804b39:	4c 01 db             	add    %r11,%rbx
+  804b3c:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804b42:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804b49:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804b4f:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804b55:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804b59:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804b5d:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804b64:	00 00 00 
+  804b67:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b6a:	85 c0                	test   %eax,%eax
+  804b6c:	75 24                	jne    804b92 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804b6e:	bf 02 00 00 00       	mov    $0x2,%edi
+  804b73:	49 89 df             	mov    %rbx,%r15
+  804b76:	48 b8 b4 df ff ff ff 	movabs $0xffffffffffffdfb4,%rax
+  804b7d:	ff ff ff 
+  804b80:	48 01 d8             	add    %rbx,%rax
+  804b83:	ff d0                	call   *%rax
+  804b85:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  804b8c:	00 00 00 
+  804b8f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804b92:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804b98:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804b9b:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804ba2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804ba5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804ba8:	39 c2                	cmp    %eax,%edx
+  804baa:	0f 4e c2             	cmovle %edx,%eax
+  804bad:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804bb3:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804bb9:	48 63 d0             	movslq %eax,%rdx
+  804bbc:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804bc3:	48 89 c6             	mov    %rax,%rsi
+  804bc6:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804bcd:	00 00 00 
+  804bd0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bd4:	48 89 c7             	mov    %rax,%rdi
+  804bd7:	49 89 df             	mov    %rbx,%r15
+  804bda:	48 b8 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rax
+  804be1:	ff ff ff 
+  804be4:	48 01 d8             	add    %rbx,%rax
+  804be7:	ff d0                	call   *%rax
+	req->req_s = s;
+  804be9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bed:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804bf3:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804bf5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bf9:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804bff:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804c02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c06:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804c0c:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804c0f:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804c16:	00 00 00 
+  804c19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c1d:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804c21:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804c28:	00 
+  804c29:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804c2f:	48 63 d0             	movslq %eax,%rdx
+  804c32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c36:	48 01 d0             	add    %rdx,%rax
+  804c39:	48 83 e8 01          	sub    $0x1,%rax
+  804c3d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804c41:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c45:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c4a:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804c4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c52:	48 29 d0             	sub    %rdx,%rax
+  804c55:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804c5b:	85 c0                	test   %eax,%eax
+  804c5d:	0f 48 c2             	cmovs  %edx,%eax
+  804c60:	c1 f8 0c             	sar    $0xc,%eax
+  804c63:	48 98                	cltq
+  804c65:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804c69:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804c6d:	48 85 c0             	test   %rax,%rax
+  804c70:	0f 95 c0             	setne  %al
+  804c73:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804c76:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804c7d:	00 
+  804c7e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c82:	48 83 c0 0b          	add    $0xb,%rax
+  804c86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804c8a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c93:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804c97:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c9b:	48 29 d0             	sub    %rdx,%rax
+  804c9e:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804ca2:	89 c7                	mov    %eax,%edi
+  804ca4:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804cab:	00 00 00 
+  804cae:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804cb1:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804cb5:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804cb9:	48 83 ec 08          	sub    $0x8,%rsp
+  804cbd:	6a 00                	push   $0x0
+  804cbf:	6a 00                	push   $0x0
+  804cc1:	6a 05                	push   $0x5
+  804cc3:	41 89 f1             	mov    %esi,%r9d
+  804cc6:	49 89 c8             	mov    %rcx,%r8
+  804cc9:	89 f9                	mov    %edi,%ecx
+  804ccb:	be 08 00 00 00       	mov    $0x8,%esi
+  804cd0:	89 c7                	mov    %eax,%edi
+  804cd2:	49 89 df             	mov    %rbx,%r15
+  804cd5:	48 b8 bc db ff ff ff 	movabs $0xffffffffffffdbbc,%rax
+  804cdc:	ff ff ff 
+  804cdf:	48 01 d8             	add    %rbx,%rax
+  804ce2:	ff d0                	call   *%rax
+  804ce4:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804ce8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804cec:	5b                   	pop    %rbx
+  804ced:	41 5f                	pop    %r15
+  804cef:	5d                   	pop    %rbp
+  804cf0:	c3                   	ret
+
+0000000000804cf1 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804cf1:	55                   	push   %rbp
+  804cf2:	48 89 e5             	mov    %rsp,%rbp
+  804cf5:	48 83 ec 10          	sub    $0x10,%rsp
+  804cf9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804cf9 <nsipc_socket+0x8>
+  804d00:	49 bb 3f 33 00 00 00 	movabs $0x333f,%r11
+  804d07:	00 00 00 
+  804d0a:	4c 01 d8             	add    %r11,%rax
+  804d0d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804d10:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804d13:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804d16:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804d1d:	00 00 00 
+  804d20:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804d23:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804d26:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804d2d:	00 00 00 
+  804d30:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804d33:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804d37:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804d3e:	00 00 00 
+  804d41:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804d44:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804d48:	bf 09 00 00 00       	mov    $0x9,%edi
+  804d4d:	48 ba ce c5 ff ff ff 	movabs $0xffffffffffffc5ce,%rdx
+  804d54:	ff ff ff 
+  804d57:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804d5b:	ff d0                	call   *%rax
+}
+  804d5d:	c9                   	leave
+  804d5e:	c3                   	ret
+
+0000000000804d5f <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804d5f:	55                   	push   %rbp
+  804d60:	48 89 e5             	mov    %rsp,%rbp
+  804d63:	41 57                	push   %r15
+  804d65:	53                   	push   %rbx
+  804d66:	48 83 ec 30          	sub    $0x30,%rsp
+  804d6a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d6a <pipe+0xb>
+  804d71:	49 bb ce 32 00 00 00 	movabs $0x32ce,%r11
+  804d78:	00 00 00 
+  804d7b:	4c 01 db             	add    %r11,%rbx
+  804d7e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804d82:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804d86:	48 89 c7             	mov    %rax,%rdi
+  804d89:	49 89 df             	mov    %rbx,%r15
+  804d8c:	48 b8 e8 a9 ff ff ff 	movabs $0xffffffffffffa9e8,%rax
+  804d93:	ff ff ff 
+  804d96:	48 01 d8             	add    %rbx,%rax
+  804d99:	ff d0                	call   *%rax
+  804d9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d9e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804da2:	0f 88 12 02 00 00    	js     804fba <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804da8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dac:	ba 07 04 00 00       	mov    $0x407,%edx
+  804db1:	48 89 c6             	mov    %rax,%rsi
+  804db4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804db9:	49 89 df             	mov    %rbx,%r15
+  804dbc:	48 b8 43 a0 ff ff ff 	movabs $0xffffffffffffa043,%rax
+  804dc3:	ff ff ff 
+  804dc6:	48 01 d8             	add    %rbx,%rax
+  804dc9:	ff d0                	call   *%rax
+  804dcb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804dce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804dd2:	0f 88 e2 01 00 00    	js     804fba <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804dd8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804ddc:	48 89 c7             	mov    %rax,%rdi
+  804ddf:	49 89 df             	mov    %rbx,%r15
+  804de2:	48 b8 e8 a9 ff ff ff 	movabs $0xffffffffffffa9e8,%rax
+  804de9:	ff ff ff 
+  804dec:	48 01 d8             	add    %rbx,%rax
+  804def:	ff d0                	call   *%rax
+  804df1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804df4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804df8:	0f 88 9b 01 00 00    	js     804f99 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804dfe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e02:	ba 07 04 00 00       	mov    $0x407,%edx
+  804e07:	48 89 c6             	mov    %rax,%rsi
+  804e0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e0f:	49 89 df             	mov    %rbx,%r15
+  804e12:	48 b8 43 a0 ff ff ff 	movabs $0xffffffffffffa043,%rax
+  804e19:	ff ff ff 
+  804e1c:	48 01 d8             	add    %rbx,%rax
+  804e1f:	ff d0                	call   *%rax
+  804e21:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e24:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e28:	0f 88 6b 01 00 00    	js     804f99 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804e2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e32:	48 89 c7             	mov    %rax,%rdi
+  804e35:	49 89 df             	mov    %rbx,%r15
+  804e38:	48 b8 a5 a9 ff ff ff 	movabs $0xffffffffffffa9a5,%rax
+  804e3f:	ff ff ff 
+  804e42:	48 01 d8             	add    %rbx,%rax
+  804e45:	ff d0                	call   *%rax
+  804e47:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804e4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e4f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804e54:	48 89 c6             	mov    %rax,%rsi
+  804e57:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e5c:	49 89 df             	mov    %rbx,%r15
+  804e5f:	48 b8 43 a0 ff ff ff 	movabs $0xffffffffffffa043,%rax
+  804e66:	ff ff ff 
+  804e69:	48 01 d8             	add    %rbx,%rax
+  804e6c:	ff d0                	call   *%rax
+  804e6e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e71:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e75:	0f 88 fd 00 00 00    	js     804f78 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804e7b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e7f:	48 89 c7             	mov    %rax,%rdi
+  804e82:	49 89 df             	mov    %rbx,%r15
+  804e85:	48 b8 a5 a9 ff ff ff 	movabs $0xffffffffffffa9a5,%rax
+  804e8c:	ff ff ff 
+  804e8f:	48 01 d8             	add    %rbx,%rax
+  804e92:	ff d0                	call   *%rax
+  804e94:	48 89 c2             	mov    %rax,%rdx
+  804e97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e9b:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804ea1:	48 89 d1             	mov    %rdx,%rcx
+  804ea4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ea9:	48 89 c6             	mov    %rax,%rsi
+  804eac:	bf 00 00 00 00       	mov    $0x0,%edi
+  804eb1:	49 89 df             	mov    %rbx,%r15
+  804eb4:	48 b8 a8 a0 ff ff ff 	movabs $0xffffffffffffa0a8,%rax
+  804ebb:	ff ff ff 
+  804ebe:	48 01 d8             	add    %rbx,%rax
+  804ec1:	ff d0                	call   *%rax
+  804ec3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ec6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804eca:	0f 88 87 00 00 00    	js     804f57 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804ed0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ed4:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  804edb:	00 00 00 
+  804ede:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804ee1:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804ee3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ee7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804eee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ef2:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  804ef9:	00 00 00 
+  804efc:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804eff:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804f01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f05:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804f0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f10:	48 89 c7             	mov    %rax,%rdi
+  804f13:	49 89 df             	mov    %rbx,%r15
+  804f16:	48 b8 6e a9 ff ff ff 	movabs $0xffffffffffffa96e,%rax
+  804f1d:	ff ff ff 
+  804f20:	48 01 d8             	add    %rbx,%rax
+  804f23:	ff d0                	call   *%rax
+  804f25:	89 c2                	mov    %eax,%edx
+  804f27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f2b:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804f2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f31:	48 89 c7             	mov    %rax,%rdi
+  804f34:	49 89 df             	mov    %rbx,%r15
+  804f37:	48 b8 6e a9 ff ff ff 	movabs $0xffffffffffffa96e,%rax
+  804f3e:	ff ff ff 
+  804f41:	48 01 d8             	add    %rbx,%rax
+  804f44:	ff d0                	call   *%rax
+  804f46:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804f4a:	48 83 c2 04          	add    $0x4,%rdx
+  804f4e:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804f50:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f55:	eb 67                	jmp    804fbe <pipe+0x25f>
+		goto err3;
+  804f57:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804f58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f5c:	48 89 c6             	mov    %rax,%rsi
+  804f5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f64:	49 89 df             	mov    %rbx,%r15
+  804f67:	48 b8 1b a1 ff ff ff 	movabs $0xffffffffffffa11b,%rax
+  804f6e:	ff ff ff 
+  804f71:	48 01 d8             	add    %rbx,%rax
+  804f74:	ff d0                	call   *%rax
+  804f76:	eb 01                	jmp    804f79 <pipe+0x21a>
+		goto err2;
+  804f78:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804f79:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f7d:	48 89 c6             	mov    %rax,%rsi
+  804f80:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f85:	49 89 df             	mov    %rbx,%r15
+  804f88:	48 b8 1b a1 ff ff ff 	movabs $0xffffffffffffa11b,%rax
+  804f8f:	ff ff ff 
+  804f92:	48 01 d8             	add    %rbx,%rax
+  804f95:	ff d0                	call   *%rax
+  804f97:	eb 01                	jmp    804f9a <pipe+0x23b>
+		goto err1;
+  804f99:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804f9a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f9e:	48 89 c6             	mov    %rax,%rsi
+  804fa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fa6:	49 89 df             	mov    %rbx,%r15
+  804fa9:	48 b8 1b a1 ff ff ff 	movabs $0xffffffffffffa11b,%rax
+  804fb0:	ff ff ff 
+  804fb3:	48 01 d8             	add    %rbx,%rax
+  804fb6:	ff d0                	call   *%rax
+  804fb8:	eb 01                	jmp    804fbb <pipe+0x25c>
+		goto err;
+  804fba:	90                   	nop
+err:
+	return r;
+  804fbb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804fbe:	48 83 c4 30          	add    $0x30,%rsp
+  804fc2:	5b                   	pop    %rbx
+  804fc3:	41 5f                	pop    %r15
+  804fc5:	5d                   	pop    %rbp
+  804fc6:	c3                   	ret
+
+0000000000804fc7 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804fc7:	55                   	push   %rbp
+  804fc8:	48 89 e5             	mov    %rsp,%rbp
+  804fcb:	41 57                	push   %r15
+  804fcd:	41 54                	push   %r12
+  804fcf:	53                   	push   %rbx
+  804fd0:	48 83 ec 28          	sub    $0x28,%rsp
+  804fd4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fd4 <_pipeisclosed+0xd>
+  804fdb:	49 bb 64 30 00 00 00 	movabs $0x3064,%r11
+  804fe2:	00 00 00 
+  804fe5:	4c 01 db             	add    %r11,%rbx
+  804fe8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804fec:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804ff0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804ff7:	ff ff ff 
+  804ffa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804ffe:	48 8b 00             	mov    (%rax),%rax
+  805001:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805007:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  80500a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80500e:	48 89 c7             	mov    %rax,%rdi
+  805011:	49 89 df             	mov    %rbx,%r15
+  805014:	48 b8 43 e0 ff ff ff 	movabs $0xffffffffffffe043,%rax
+  80501b:	ff ff ff 
+  80501e:	48 01 d8             	add    %rbx,%rax
+  805021:	ff d0                	call   *%rax
+  805023:	41 89 c4             	mov    %eax,%r12d
+  805026:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80502a:	48 89 c7             	mov    %rax,%rdi
+  80502d:	49 89 df             	mov    %rbx,%r15
+  805030:	48 b8 43 e0 ff ff ff 	movabs $0xffffffffffffe043,%rax
+  805037:	ff ff ff 
+  80503a:	48 01 d8             	add    %rbx,%rax
+  80503d:	ff d0                	call   *%rax
+  80503f:	41 39 c4             	cmp    %eax,%r12d
+  805042:	0f 94 c0             	sete   %al
+  805045:	0f b6 c0             	movzbl %al,%eax
+  805048:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  80504b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805052:	ff ff ff 
+  805055:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805059:	48 8b 00             	mov    (%rax),%rax
+  80505c:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805062:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805065:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805068:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80506b:	75 05                	jne    805072 <_pipeisclosed+0xab>
+			return ret;
+  80506d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805070:	eb 63                	jmp    8050d5 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805072:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805075:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805078:	0f 84 72 ff ff ff    	je     804ff0 <_pipeisclosed+0x29>
+  80507e:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805082:	0f 85 68 ff ff ff    	jne    804ff0 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805088:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80508f:	ff ff ff 
+  805092:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805096:	48 8b 00             	mov    (%rax),%rax
+  805099:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  80509f:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8050a2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8050a5:	89 c6                	mov    %eax,%esi
+  8050a7:	48 b8 3e e7 ff ff ff 	movabs $0xffffffffffffe73e,%rax
+  8050ae:	ff ff ff 
+  8050b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050b5:	48 89 c7             	mov    %rax,%rdi
+  8050b8:	49 89 df             	mov    %rbx,%r15
+  8050bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050c0:	49 b8 c5 85 ff ff ff 	movabs $0xffffffffffff85c5,%r8
+  8050c7:	ff ff ff 
+  8050ca:	49 01 d8             	add    %rbx,%r8
+  8050cd:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8050d0:	e9 1b ff ff ff       	jmp    804ff0 <_pipeisclosed+0x29>
+	}
+}
+  8050d5:	48 83 c4 28          	add    $0x28,%rsp
+  8050d9:	5b                   	pop    %rbx
+  8050da:	41 5c                	pop    %r12
+  8050dc:	41 5f                	pop    %r15
+  8050de:	5d                   	pop    %rbp
+  8050df:	c3                   	ret
+
+00000000008050e0 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8050e0:	55                   	push   %rbp
+  8050e1:	48 89 e5             	mov    %rsp,%rbp
+  8050e4:	41 57                	push   %r15
+  8050e6:	53                   	push   %rbx
+  8050e7:	48 83 ec 30          	sub    $0x30,%rsp
+  8050eb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050eb <pipeisclosed+0xb>
+  8050f2:	49 bb 4d 2f 00 00 00 	movabs $0x2f4d,%r11
+  8050f9:	00 00 00 
+  8050fc:	4c 01 db             	add    %r11,%rbx
+  8050ff:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805102:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805106:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805109:	48 89 d6             	mov    %rdx,%rsi
+  80510c:	89 c7                	mov    %eax,%edi
+  80510e:	49 89 df             	mov    %rbx,%r15
+  805111:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  805118:	ff ff ff 
+  80511b:	48 01 d8             	add    %rbx,%rax
+  80511e:	ff d0                	call   *%rax
+  805120:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805123:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805127:	79 05                	jns    80512e <pipeisclosed+0x4e>
+		return r;
+  805129:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80512c:	eb 3b                	jmp    805169 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  80512e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805132:	48 89 c7             	mov    %rax,%rdi
+  805135:	49 89 df             	mov    %rbx,%r15
+  805138:	48 b8 a5 a9 ff ff ff 	movabs $0xffffffffffffa9a5,%rax
+  80513f:	ff ff ff 
+  805142:	48 01 d8             	add    %rbx,%rax
+  805145:	ff d0                	call   *%rax
+  805147:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80514b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80514f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805153:	48 89 d6             	mov    %rdx,%rsi
+  805156:	48 89 c7             	mov    %rax,%rdi
+  805159:	48 b8 8f cf ff ff ff 	movabs $0xffffffffffffcf8f,%rax
+  805160:	ff ff ff 
+  805163:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805167:	ff d0                	call   *%rax
+}
+  805169:	48 83 c4 30          	add    $0x30,%rsp
+  80516d:	5b                   	pop    %rbx
+  80516e:	41 5f                	pop    %r15
+  805170:	5d                   	pop    %rbp
+  805171:	c3                   	ret
+
+0000000000805172 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805172:	55                   	push   %rbp
+  805173:	48 89 e5             	mov    %rsp,%rbp
+  805176:	41 57                	push   %r15
+  805178:	53                   	push   %rbx
+  805179:	48 83 ec 40          	sub    $0x40,%rsp
+  80517d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80517d <devpipe_read+0xb>
+  805184:	49 bb bb 2e 00 00 00 	movabs $0x2ebb,%r11
+  80518b:	00 00 00 
+  80518e:	4c 01 db             	add    %r11,%rbx
+  805191:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805195:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805199:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  80519d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051a1:	48 89 c7             	mov    %rax,%rdi
+  8051a4:	49 89 df             	mov    %rbx,%r15
+  8051a7:	48 b8 a5 a9 ff ff ff 	movabs $0xffffffffffffa9a5,%rax
+  8051ae:	ff ff ff 
+  8051b1:	48 01 d8             	add    %rbx,%rax
+  8051b4:	ff d0                	call   *%rax
+  8051b6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8051ba:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8051be:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8051c2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8051c9:	00 
+  8051ca:	e9 a1 00 00 00       	jmp    805270 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8051cf:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8051d4:	74 09                	je     8051df <devpipe_read+0x6d>
+				return i;
+  8051d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051da:	e9 9f 00 00 00       	jmp    80527e <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8051df:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051e7:	48 89 d6             	mov    %rdx,%rsi
+  8051ea:	48 89 c7             	mov    %rax,%rdi
+  8051ed:	48 b8 8f cf ff ff ff 	movabs $0xffffffffffffcf8f,%rax
+  8051f4:	ff ff ff 
+  8051f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051fb:	ff d0                	call   *%rax
+  8051fd:	85 c0                	test   %eax,%eax
+  8051ff:	74 07                	je     805208 <devpipe_read+0x96>
+				return 0;
+  805201:	b8 00 00 00 00       	mov    $0x0,%eax
+  805206:	eb 76                	jmp    80527e <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805208:	49 89 df             	mov    %rbx,%r15
+  80520b:	48 b8 ee 9f ff ff ff 	movabs $0xffffffffffff9fee,%rax
+  805212:	ff ff ff 
+  805215:	48 01 d8             	add    %rbx,%rax
+  805218:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  80521a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80521e:	8b 10                	mov    (%rax),%edx
+  805220:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805224:	8b 40 04             	mov    0x4(%rax),%eax
+  805227:	39 c2                	cmp    %eax,%edx
+  805229:	74 a4                	je     8051cf <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80522b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80522f:	8b 10                	mov    (%rax),%edx
+  805231:	89 d0                	mov    %edx,%eax
+  805233:	c1 f8 1f             	sar    $0x1f,%eax
+  805236:	c1 e8 1b             	shr    $0x1b,%eax
+  805239:	01 c2                	add    %eax,%edx
+  80523b:	83 e2 1f             	and    $0x1f,%edx
+  80523e:	29 c2                	sub    %eax,%edx
+  805240:	89 d6                	mov    %edx,%esi
+  805242:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805246:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80524a:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80524e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805252:	48 63 c6             	movslq %esi,%rax
+  805255:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  80525a:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  80525c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805260:	8b 00                	mov    (%rax),%eax
+  805262:	8d 50 01             	lea    0x1(%rax),%edx
+  805265:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805269:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80526b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805274:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805278:	72 a0                	jb     80521a <devpipe_read+0xa8>
+	}
+	return i;
+  80527a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80527e:	48 83 c4 40          	add    $0x40,%rsp
+  805282:	5b                   	pop    %rbx
+  805283:	41 5f                	pop    %r15
+  805285:	5d                   	pop    %rbp
+  805286:	c3                   	ret
+
+0000000000805287 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805287:	55                   	push   %rbp
+  805288:	48 89 e5             	mov    %rsp,%rbp
+  80528b:	41 57                	push   %r15
+  80528d:	53                   	push   %rbx
+  80528e:	48 83 ec 40          	sub    $0x40,%rsp
+  805292:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805292 <devpipe_write+0xb>
+  805299:	49 bb a6 2d 00 00 00 	movabs $0x2da6,%r11
+  8052a0:	00 00 00 
+  8052a3:	4c 01 db             	add    %r11,%rbx
+  8052a6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8052aa:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8052ae:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8052b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052b6:	48 89 c7             	mov    %rax,%rdi
+  8052b9:	49 89 df             	mov    %rbx,%r15
+  8052bc:	48 b8 a5 a9 ff ff ff 	movabs $0xffffffffffffa9a5,%rax
+  8052c3:	ff ff ff 
+  8052c6:	48 01 d8             	add    %rbx,%rax
+  8052c9:	ff d0                	call   *%rax
+  8052cb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8052cf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8052d3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8052d7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8052de:	00 
+  8052df:	e9 a0 00 00 00       	jmp    805384 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8052e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8052e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052ec:	48 89 d6             	mov    %rdx,%rsi
+  8052ef:	48 89 c7             	mov    %rax,%rdi
+  8052f2:	48 b8 8f cf ff ff ff 	movabs $0xffffffffffffcf8f,%rax
+  8052f9:	ff ff ff 
+  8052fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805300:	ff d0                	call   *%rax
+  805302:	85 c0                	test   %eax,%eax
+  805304:	74 0a                	je     805310 <devpipe_write+0x89>
+				return 0;
+  805306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80530b:	e9 82 00 00 00       	jmp    805392 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805310:	49 89 df             	mov    %rbx,%r15
+  805313:	48 b8 ee 9f ff ff ff 	movabs $0xffffffffffff9fee,%rax
+  80531a:	ff ff ff 
+  80531d:	48 01 d8             	add    %rbx,%rax
+  805320:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805322:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805326:	8b 40 04             	mov    0x4(%rax),%eax
+  805329:	48 63 d0             	movslq %eax,%rdx
+  80532c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805330:	8b 00                	mov    (%rax),%eax
+  805332:	48 98                	cltq
+  805334:	48 83 c0 20          	add    $0x20,%rax
+  805338:	48 39 c2             	cmp    %rax,%rdx
+  80533b:	73 a7                	jae    8052e4 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80533d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805341:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805345:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805349:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80534d:	8b 50 04             	mov    0x4(%rax),%edx
+  805350:	89 d0                	mov    %edx,%eax
+  805352:	c1 f8 1f             	sar    $0x1f,%eax
+  805355:	c1 e8 1b             	shr    $0x1b,%eax
+  805358:	01 c2                	add    %eax,%edx
+  80535a:	83 e2 1f             	and    $0x1f,%edx
+  80535d:	29 c2                	sub    %eax,%edx
+  80535f:	89 d0                	mov    %edx,%eax
+  805361:	0f b6 09             	movzbl (%rcx),%ecx
+  805364:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805368:	48 98                	cltq
+  80536a:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  80536e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805372:	8b 40 04             	mov    0x4(%rax),%eax
+  805375:	8d 50 01             	lea    0x1(%rax),%edx
+  805378:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80537c:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  80537f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805384:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805388:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80538c:	72 94                	jb     805322 <devpipe_write+0x9b>
+	}
+
+	return i;
+  80538e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805392:	48 83 c4 40          	add    $0x40,%rsp
+  805396:	5b                   	pop    %rbx
+  805397:	41 5f                	pop    %r15
+  805399:	5d                   	pop    %rbp
+  80539a:	c3                   	ret
+
+000000000080539b <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80539b:	55                   	push   %rbp
+  80539c:	48 89 e5             	mov    %rsp,%rbp
+  80539f:	41 57                	push   %r15
+  8053a1:	53                   	push   %rbx
+  8053a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8053a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053a6 <devpipe_stat+0xb>
+  8053ad:	49 bb 92 2c 00 00 00 	movabs $0x2c92,%r11
+  8053b4:	00 00 00 
+  8053b7:	4c 01 db             	add    %r11,%rbx
+  8053ba:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8053be:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8053c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053c6:	48 89 c7             	mov    %rax,%rdi
+  8053c9:	49 89 df             	mov    %rbx,%r15
+  8053cc:	48 b8 a5 a9 ff ff ff 	movabs $0xffffffffffffa9a5,%rax
+  8053d3:	ff ff ff 
+  8053d6:	48 01 d8             	add    %rbx,%rax
+  8053d9:	ff d0                	call   *%rax
+  8053db:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8053df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053e3:	48 ba 51 e7 ff ff ff 	movabs $0xffffffffffffe751,%rdx
+  8053ea:	ff ff ff 
+  8053ed:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8053f1:	48 89 d6             	mov    %rdx,%rsi
+  8053f4:	48 89 c7             	mov    %rax,%rdi
+  8053f7:	49 89 df             	mov    %rbx,%r15
+  8053fa:	48 b8 87 93 ff ff ff 	movabs $0xffffffffffff9387,%rax
+  805401:	ff ff ff 
+  805404:	48 01 d8             	add    %rbx,%rax
+  805407:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805409:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80540d:	8b 50 04             	mov    0x4(%rax),%edx
+  805410:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805414:	8b 00                	mov    (%rax),%eax
+  805416:	29 c2                	sub    %eax,%edx
+  805418:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80541c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805422:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805426:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80542d:	00 00 00 
+	stat->st_dev = &devpipe;
+  805430:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805434:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  80543b:	00 00 00 
+  80543e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805442:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805449:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80544e:	48 83 c4 20          	add    $0x20,%rsp
+  805452:	5b                   	pop    %rbx
+  805453:	41 5f                	pop    %r15
+  805455:	5d                   	pop    %rbp
+  805456:	c3                   	ret
+
+0000000000805457 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805457:	55                   	push   %rbp
+  805458:	48 89 e5             	mov    %rsp,%rbp
+  80545b:	41 57                	push   %r15
+  80545d:	53                   	push   %rbx
+  80545e:	48 83 ec 10          	sub    $0x10,%rsp
+  805462:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805462 <devpipe_close+0xb>
+  805469:	49 bb d6 2b 00 00 00 	movabs $0x2bd6,%r11
+  805470:	00 00 00 
+  805473:	4c 01 db             	add    %r11,%rbx
+  805476:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80547a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80547e:	48 89 c6             	mov    %rax,%rsi
+  805481:	bf 00 00 00 00       	mov    $0x0,%edi
+  805486:	49 89 df             	mov    %rbx,%r15
+  805489:	48 b8 1b a1 ff ff ff 	movabs $0xffffffffffffa11b,%rax
+  805490:	ff ff ff 
+  805493:	48 01 d8             	add    %rbx,%rax
+  805496:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805498:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80549c:	48 89 c7             	mov    %rax,%rdi
+  80549f:	49 89 df             	mov    %rbx,%r15
+  8054a2:	48 b8 a5 a9 ff ff ff 	movabs $0xffffffffffffa9a5,%rax
+  8054a9:	ff ff ff 
+  8054ac:	48 01 d8             	add    %rbx,%rax
+  8054af:	ff d0                	call   *%rax
+  8054b1:	48 89 c6             	mov    %rax,%rsi
+  8054b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054b9:	49 89 df             	mov    %rbx,%r15
+  8054bc:	48 b8 1b a1 ff ff ff 	movabs $0xffffffffffffa11b,%rax
+  8054c3:	ff ff ff 
+  8054c6:	48 01 d8             	add    %rbx,%rax
+  8054c9:	ff d0                	call   *%rax
+}
+  8054cb:	48 83 c4 10          	add    $0x10,%rsp
+  8054cf:	5b                   	pop    %rbx
+  8054d0:	41 5f                	pop    %r15
+  8054d2:	5d                   	pop    %rbp
+  8054d3:	c3                   	ret
+
+00000000008054d4 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8054d4:	55                   	push   %rbp
+  8054d5:	48 89 e5             	mov    %rsp,%rbp
+  8054d8:	41 57                	push   %r15
+  8054da:	48 83 ec 28          	sub    $0x28,%rsp
+  8054de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054de <cputchar+0xa>
+  8054e5:	49 bb 5a 2b 00 00 00 	movabs $0x2b5a,%r11
+  8054ec:	00 00 00 
+  8054ef:	4c 01 d8             	add    %r11,%rax
+  8054f2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8054f5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8054f8:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8054fb:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8054ff:	be 01 00 00 00       	mov    $0x1,%esi
+  805504:	48 89 d7             	mov    %rdx,%rdi
+  805507:	49 89 c7             	mov    %rax,%r15
+  80550a:	48 ba 8b 9e ff ff ff 	movabs $0xffffffffffff9e8b,%rdx
+  805511:	ff ff ff 
+  805514:	48 01 c2             	add    %rax,%rdx
+  805517:	ff d2                	call   *%rdx
+}
+  805519:	90                   	nop
+  80551a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80551e:	c9                   	leave
+  80551f:	c3                   	ret
+
+0000000000805520 <getchar>:
+
+int
+getchar(void)
+{
+  805520:	55                   	push   %rbp
+  805521:	48 89 e5             	mov    %rsp,%rbp
+  805524:	41 57                	push   %r15
+  805526:	48 83 ec 18          	sub    $0x18,%rsp
+  80552a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80552a <getchar+0xa>
+  805531:	49 bb 0e 2b 00 00 00 	movabs $0x2b0e,%r11
+  805538:	00 00 00 
+  80553b:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  80553e:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805542:	ba 01 00 00 00       	mov    $0x1,%edx
+  805547:	48 89 ce             	mov    %rcx,%rsi
+  80554a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80554f:	49 89 c7             	mov    %rax,%r15
+  805552:	48 b9 e5 af ff ff ff 	movabs $0xffffffffffffafe5,%rcx
+  805559:	ff ff ff 
+  80555c:	48 01 c1             	add    %rax,%rcx
+  80555f:	ff d1                	call   *%rcx
+  805561:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  805564:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805568:	79 05                	jns    80556f <getchar+0x4f>
+		return r;
+  80556a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80556d:	eb 14                	jmp    805583 <getchar+0x63>
+	if (r < 1)
+  80556f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805573:	7f 07                	jg     80557c <getchar+0x5c>
+		return -E_EOF;
+  805575:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80557a:	eb 07                	jmp    805583 <getchar+0x63>
+	return c;
+  80557c:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805580:	0f b6 c0             	movzbl %al,%eax
+}
+  805583:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805587:	c9                   	leave
+  805588:	c3                   	ret
+
+0000000000805589 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  805589:	55                   	push   %rbp
+  80558a:	48 89 e5             	mov    %rsp,%rbp
+  80558d:	41 57                	push   %r15
+  80558f:	53                   	push   %rbx
+  805590:	48 83 ec 20          	sub    $0x20,%rsp
+  805594:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805594 <iscons+0xb>
+  80559b:	49 bb a4 2a 00 00 00 	movabs $0x2aa4,%r11
+  8055a2:	00 00 00 
+  8055a5:	4c 01 db             	add    %r11,%rbx
+  8055a8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8055ab:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8055af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8055b2:	48 89 d6             	mov    %rdx,%rsi
+  8055b5:	89 c7                	mov    %eax,%edi
+  8055b7:	49 89 df             	mov    %rbx,%r15
+  8055ba:	48 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%rax
+  8055c1:	ff ff ff 
+  8055c4:	48 01 d8             	add    %rbx,%rax
+  8055c7:	ff d0                	call   *%rax
+  8055c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055d0:	79 05                	jns    8055d7 <iscons+0x4e>
+		return r;
+  8055d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055d5:	eb 1b                	jmp    8055f2 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8055d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055db:	8b 10                	mov    (%rax),%edx
+  8055dd:	48 b8 08 01 00 00 00 	movabs $0x108,%rax
+  8055e4:	00 00 00 
+  8055e7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8055ea:	39 c2                	cmp    %eax,%edx
+  8055ec:	0f 94 c0             	sete   %al
+  8055ef:	0f b6 c0             	movzbl %al,%eax
+}
+  8055f2:	48 83 c4 20          	add    $0x20,%rsp
+  8055f6:	5b                   	pop    %rbx
+  8055f7:	41 5f                	pop    %r15
+  8055f9:	5d                   	pop    %rbp
+  8055fa:	c3                   	ret
+
+00000000008055fb <opencons>:
+
+int
+opencons(void)
+{
+  8055fb:	55                   	push   %rbp
+  8055fc:	48 89 e5             	mov    %rsp,%rbp
+  8055ff:	41 57                	push   %r15
+  805601:	53                   	push   %rbx
+  805602:	48 83 ec 10          	sub    $0x10,%rsp
+  805606:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805606 <opencons+0xb>
+  80560d:	49 bb 32 2a 00 00 00 	movabs $0x2a32,%r11
+  805614:	00 00 00 
+  805617:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  80561a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80561e:	48 89 c7             	mov    %rax,%rdi
+  805621:	49 89 df             	mov    %rbx,%r15
+  805624:	48 b8 e8 a9 ff ff ff 	movabs $0xffffffffffffa9e8,%rax
+  80562b:	ff ff ff 
+  80562e:	48 01 d8             	add    %rbx,%rax
+  805631:	ff d0                	call   *%rax
+  805633:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805636:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80563a:	79 05                	jns    805641 <opencons+0x46>
+		return r;
+  80563c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80563f:	eb 68                	jmp    8056a9 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805641:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805645:	ba 07 04 00 00       	mov    $0x407,%edx
+  80564a:	48 89 c6             	mov    %rax,%rsi
+  80564d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805652:	49 89 df             	mov    %rbx,%r15
+  805655:	48 b8 43 a0 ff ff ff 	movabs $0xffffffffffffa043,%rax
+  80565c:	ff ff ff 
+  80565f:	48 01 d8             	add    %rbx,%rax
+  805662:	ff d0                	call   *%rax
+  805664:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805667:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80566b:	79 05                	jns    805672 <opencons+0x77>
+		return r;
+  80566d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805670:	eb 37                	jmp    8056a9 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805672:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805676:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  80567d:	00 00 00 
+  805680:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805683:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  805685:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805689:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805690:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805694:	48 89 c7             	mov    %rax,%rdi
+  805697:	49 89 df             	mov    %rbx,%r15
+  80569a:	48 b8 6e a9 ff ff ff 	movabs $0xffffffffffffa96e,%rax
+  8056a1:	ff ff ff 
+  8056a4:	48 01 d8             	add    %rbx,%rax
+  8056a7:	ff d0                	call   *%rax
+}
+  8056a9:	48 83 c4 10          	add    $0x10,%rsp
+  8056ad:	5b                   	pop    %rbx
+  8056ae:	41 5f                	pop    %r15
+  8056b0:	5d                   	pop    %rbp
+  8056b1:	c3                   	ret
+
+00000000008056b2 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8056b2:	55                   	push   %rbp
+  8056b3:	48 89 e5             	mov    %rsp,%rbp
+  8056b6:	41 57                	push   %r15
+  8056b8:	53                   	push   %rbx
+  8056b9:	48 83 ec 30          	sub    $0x30,%rsp
+  8056bd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056bd <devcons_read+0xb>
+  8056c4:	49 bb 7b 29 00 00 00 	movabs $0x297b,%r11
+  8056cb:	00 00 00 
+  8056ce:	4c 01 db             	add    %r11,%rbx
+  8056d1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8056d5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8056d9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8056dd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8056e2:	75 19                	jne    8056fd <devcons_read+0x4b>
+		return 0;
+  8056e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056e9:	eb 55                	jmp    805740 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8056eb:	49 89 df             	mov    %rbx,%r15
+  8056ee:	48 b8 ee 9f ff ff ff 	movabs $0xffffffffffff9fee,%rax
+  8056f5:	ff ff ff 
+  8056f8:	48 01 d8             	add    %rbx,%rax
+  8056fb:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8056fd:	49 89 df             	mov    %rbx,%r15
+  805700:	48 b8 ea 9e ff ff ff 	movabs $0xffffffffffff9eea,%rax
+  805707:	ff ff ff 
+  80570a:	48 01 d8             	add    %rbx,%rax
+  80570d:	ff d0                	call   *%rax
+  80570f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805712:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805716:	74 d3                	je     8056eb <devcons_read+0x39>
+	if (c < 0)
+  805718:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80571c:	79 05                	jns    805723 <devcons_read+0x71>
+		return c;
+  80571e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805721:	eb 1d                	jmp    805740 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  805723:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  805727:	75 07                	jne    805730 <devcons_read+0x7e>
+		return 0;
+  805729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80572e:	eb 10                	jmp    805740 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805730:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805733:	89 c2                	mov    %eax,%edx
+  805735:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805739:	88 10                	mov    %dl,(%rax)
+	return 1;
+  80573b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805740:	48 83 c4 30          	add    $0x30,%rsp
+  805744:	5b                   	pop    %rbx
+  805745:	41 5f                	pop    %r15
+  805747:	5d                   	pop    %rbp
+  805748:	c3                   	ret
+
+0000000000805749 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805749:	55                   	push   %rbp
+  80574a:	48 89 e5             	mov    %rsp,%rbp
+  80574d:	41 57                	push   %r15
+  80574f:	53                   	push   %rbx
+  805750:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805757:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805757 <devcons_write+0xe>
+  80575e:	49 bb e1 28 00 00 00 	movabs $0x28e1,%r11
+  805765:	00 00 00 
+  805768:	4c 01 db             	add    %r11,%rbx
+  80576b:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  805772:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  805779:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805780:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805787:	e9 80 00 00 00       	jmp    80580c <devcons_write+0xc3>
+		m = n - tot;
+  80578c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805793:	89 c2                	mov    %eax,%edx
+  805795:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805798:	29 c2                	sub    %eax,%edx
+  80579a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  80579d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8057a0:	83 f8 7f             	cmp    $0x7f,%eax
+  8057a3:	76 07                	jbe    8057ac <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8057a5:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8057ac:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8057af:	48 63 d0             	movslq %eax,%rdx
+  8057b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057b5:	48 63 c8             	movslq %eax,%rcx
+  8057b8:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8057bf:	48 01 c1             	add    %rax,%rcx
+  8057c2:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8057c9:	48 89 ce             	mov    %rcx,%rsi
+  8057cc:	48 89 c7             	mov    %rax,%rdi
+  8057cf:	49 89 df             	mov    %rbx,%r15
+  8057d2:	48 b8 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rax
+  8057d9:	ff ff ff 
+  8057dc:	48 01 d8             	add    %rbx,%rax
+  8057df:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8057e1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8057e4:	48 63 d0             	movslq %eax,%rdx
+  8057e7:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8057ee:	48 89 d6             	mov    %rdx,%rsi
+  8057f1:	48 89 c7             	mov    %rax,%rdi
+  8057f4:	49 89 df             	mov    %rbx,%r15
+  8057f7:	48 b8 8b 9e ff ff ff 	movabs $0xffffffffffff9e8b,%rax
+  8057fe:	ff ff ff 
+  805801:	48 01 d8             	add    %rbx,%rax
+  805804:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  805806:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805809:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80580c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80580f:	48 98                	cltq
+  805811:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  805818:	0f 82 6e ff ff ff    	jb     80578c <devcons_write+0x43>
+	}
+	return tot;
+  80581e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805821:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  805828:	5b                   	pop    %rbx
+  805829:	41 5f                	pop    %r15
+  80582b:	5d                   	pop    %rbp
+  80582c:	c3                   	ret
+
+000000000080582d <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  80582d:	55                   	push   %rbp
+  80582e:	48 89 e5             	mov    %rsp,%rbp
+  805831:	48 83 ec 08          	sub    $0x8,%rsp
+  805835:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805835 <devcons_close+0x8>
+  80583c:	49 bb 03 28 00 00 00 	movabs $0x2803,%r11
+  805843:	00 00 00 
+  805846:	4c 01 d8             	add    %r11,%rax
+  805849:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  80584d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805852:	c9                   	leave
+  805853:	c3                   	ret
+
+0000000000805854 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805854:	55                   	push   %rbp
+  805855:	48 89 e5             	mov    %rsp,%rbp
+  805858:	41 57                	push   %r15
+  80585a:	48 83 ec 18          	sub    $0x18,%rsp
+  80585e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80585e <devcons_stat+0xa>
+  805865:	49 bb da 27 00 00 00 	movabs $0x27da,%r11
+  80586c:	00 00 00 
+  80586f:	4c 01 d8             	add    %r11,%rax
+  805872:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805876:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80587a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80587e:	48 b9 5d e7 ff ff ff 	movabs $0xffffffffffffe75d,%rcx
+  805885:	ff ff ff 
+  805888:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80588c:	48 89 ce             	mov    %rcx,%rsi
+  80588f:	48 89 d7             	mov    %rdx,%rdi
+  805892:	49 89 c7             	mov    %rax,%r15
+  805895:	48 ba 87 93 ff ff ff 	movabs $0xffffffffffff9387,%rdx
+  80589c:	ff ff ff 
+  80589f:	48 01 c2             	add    %rax,%rdx
+  8058a2:	ff d2                	call   *%rdx
+	return 0;
+  8058a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058a9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8058ad:	c9                   	leave
+  8058ae:	c3                   	ret
+
+00000000008058af <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8058af:	55                   	push   %rbp
+  8058b0:	48 89 e5             	mov    %rsp,%rbp
+  8058b3:	41 57                	push   %r15
+  8058b5:	53                   	push   %rbx
+  8058b6:	48 83 ec 30          	sub    $0x30,%rsp
+  8058ba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058ba <ipc_recv+0xb>
+  8058c1:	49 bb 7e 27 00 00 00 	movabs $0x277e,%r11
+  8058c8:	00 00 00 
+  8058cb:	4c 01 db             	add    %r11,%rbx
+  8058ce:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8058d2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8058d6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8058da:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8058df:	75 0e                	jne    8058ef <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8058e1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8058e8:	00 00 00 
+  8058eb:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8058ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8058f3:	48 89 c7             	mov    %rax,%rdi
+  8058f6:	49 89 df             	mov    %rbx,%r15
+  8058f9:	48 b8 6c a3 ff ff ff 	movabs $0xffffffffffffa36c,%rax
+  805900:	ff ff ff 
+  805903:	48 01 d8             	add    %rbx,%rax
+  805906:	ff d0                	call   *%rax
+  805908:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  80590b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805910:	74 2a                	je     80593c <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805912:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805916:	75 19                	jne    805931 <ipc_recv+0x82>
+  805918:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80591f:	ff ff ff 
+  805922:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805926:	48 8b 00             	mov    (%rax),%rax
+  805929:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80592f:	eb 05                	jmp    805936 <ipc_recv+0x87>
+  805931:	b8 00 00 00 00       	mov    $0x0,%eax
+  805936:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80593a:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80593c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805941:	74 2a                	je     80596d <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805943:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805947:	75 19                	jne    805962 <ipc_recv+0xb3>
+  805949:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805950:	ff ff ff 
+  805953:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805957:	48 8b 00             	mov    (%rax),%rax
+  80595a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805960:	eb 05                	jmp    805967 <ipc_recv+0xb8>
+  805962:	b8 00 00 00 00       	mov    $0x0,%eax
+  805967:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80596b:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80596d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805971:	74 05                	je     805978 <ipc_recv+0xc9>
+		return res;
+  805973:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805976:	eb 17                	jmp    80598f <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805978:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80597f:	ff ff ff 
+  805982:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805986:	48 8b 00             	mov    (%rax),%rax
+  805989:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80598f:	48 83 c4 30          	add    $0x30,%rsp
+  805993:	5b                   	pop    %rbx
+  805994:	41 5f                	pop    %r15
+  805996:	5d                   	pop    %rbp
+  805997:	c3                   	ret
+
+0000000000805998 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805998:	55                   	push   %rbp
+  805999:	48 89 e5             	mov    %rsp,%rbp
+  80599c:	41 57                	push   %r15
+  80599e:	53                   	push   %rbx
+  80599f:	48 83 ec 20          	sub    $0x20,%rsp
+  8059a3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059a3 <ipc_send+0xb>
+  8059aa:	49 bb 95 26 00 00 00 	movabs $0x2695,%r11
+  8059b1:	00 00 00 
+  8059b4:	4c 01 db             	add    %r11,%rbx
+  8059b7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8059ba:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8059bd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8059c1:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8059c4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8059c9:	75 0e                	jne    8059d9 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8059cb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8059d2:	00 00 00 
+  8059d5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8059d9:	90                   	nop
+  8059da:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8059dd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8059e0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8059e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059e7:	89 c7                	mov    %eax,%edi
+  8059e9:	49 89 df             	mov    %rbx,%r15
+  8059ec:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  8059f3:	ff ff ff 
+  8059f6:	48 01 d8             	add    %rbx,%rax
+  8059f9:	ff d0                	call   *%rax
+  8059fb:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8059fe:	74 da                	je     8059da <ipc_send+0x42>
+		;
+}
+  805a00:	90                   	nop
+  805a01:	90                   	nop
+  805a02:	48 83 c4 20          	add    $0x20,%rsp
+  805a06:	5b                   	pop    %rbx
+  805a07:	41 5f                	pop    %r15
+  805a09:	5d                   	pop    %rbp
+  805a0a:	c3                   	ret
+
+0000000000805a0b <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805a0b:	55                   	push   %rbp
+  805a0c:	48 89 e5             	mov    %rsp,%rbp
+  805a0f:	41 57                	push   %r15
+  805a11:	53                   	push   %rbx
+  805a12:	48 83 ec 40          	sub    $0x40,%rsp
+  805a16:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a16 <ipc_call+0xb>
+  805a1d:	49 bb 22 26 00 00 00 	movabs $0x2622,%r11
+  805a24:	00 00 00 
+  805a27:	4c 01 db             	add    %r11,%rbx
+  805a2a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805a2d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805a30:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805a34:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805a37:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805a3b:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805a3f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805a44:	75 0e                	jne    805a54 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805a46:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a4d:	00 00 00 
+  805a50:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805a54:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805a59:	75 0e                	jne    805a69 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805a5b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a62:	00 00 00 
+  805a65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805a69:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805a6c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805a70:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805a73:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805a77:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a7a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805a80:	49 89 f8             	mov    %rdi,%r8
+  805a83:	89 c7                	mov    %eax,%edi
+  805a85:	49 89 df             	mov    %rbx,%r15
+  805a88:	48 b8 c5 a3 ff ff ff 	movabs $0xffffffffffffa3c5,%rax
+  805a8f:	ff ff ff 
+  805a92:	48 01 d8             	add    %rbx,%rax
+  805a95:	ff d0                	call   *%rax
+  805a97:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805a9a:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805a9f:	74 2a                	je     805acb <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805aa1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805aa5:	75 19                	jne    805ac0 <ipc_call+0xb5>
+  805aa7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805aae:	ff ff ff 
+  805ab1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ab5:	48 8b 00             	mov    (%rax),%rax
+  805ab8:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805abe:	eb 05                	jmp    805ac5 <ipc_call+0xba>
+  805ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ac5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805ac9:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805acb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805acf:	74 05                	je     805ad6 <ipc_call+0xcb>
+		return r;
+  805ad1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ad4:	eb 17                	jmp    805aed <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805ad6:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805add:	ff ff ff 
+  805ae0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ae4:	48 8b 00             	mov    (%rax),%rax
+  805ae7:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805aed:	48 83 c4 40          	add    $0x40,%rsp
+  805af1:	5b                   	pop    %rbx
+  805af2:	41 5f                	pop    %r15
+  805af4:	5d                   	pop    %rbp
+  805af5:	c3                   	ret
+
+0000000000805af6 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805af6:	55                   	push   %rbp
+  805af7:	48 89 e5             	mov    %rsp,%rbp
+  805afa:	41 57                	push   %r15
+  805afc:	53                   	push   %rbx
+  805afd:	48 83 ec 70          	sub    $0x70,%rsp
+  805b01:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b01 <ipc_callw+0xb>
+  805b08:	49 bb 37 25 00 00 00 	movabs $0x2537,%r11
+  805b0f:	00 00 00 
+  805b12:	4c 01 db             	add    %r11,%rbx
+  805b15:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805b18:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805b1b:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805b1f:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805b23:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805b28:	76 0a                	jbe    805b34 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805b2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805b2f:	e9 b7 00 00 00       	jmp    805beb <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805b34:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805b38:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805b3c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805b40:	48 89 ce             	mov    %rcx,%rsi
+  805b43:	48 89 c7             	mov    %rax,%rdi
+  805b46:	49 89 df             	mov    %rbx,%r15
+  805b49:	48 b8 67 97 ff ff ff 	movabs $0xffffffffffff9767,%rax
+  805b50:	ff ff ff 
+  805b53:	48 01 d8             	add    %rbx,%rax
+  805b56:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805b58:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805b5f:	00 
+  805b60:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805b64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b68:	48 01 d0             	add    %rdx,%rax
+  805b6b:	48 83 e8 01          	sub    $0x1,%rax
+  805b6f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805b73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b77:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b7c:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805b80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b84:	48 29 d0             	sub    %rdx,%rax
+  805b87:	48 c1 e8 03          	shr    $0x3,%rax
+  805b8b:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805b8f:	89 c1                	mov    %eax,%ecx
+  805b91:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805b94:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805b98:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805b9b:	49 89 d1             	mov    %rdx,%r9
+  805b9e:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805ba5:	00 00 00 
+  805ba8:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805baf:	00 00 00 
+  805bb2:	89 c7                	mov    %eax,%edi
+  805bb4:	49 89 df             	mov    %rbx,%r15
+  805bb7:	48 b8 c5 a3 ff ff ff 	movabs $0xffffffffffffa3c5,%rax
+  805bbe:	ff ff ff 
+  805bc1:	48 01 d8             	add    %rbx,%rax
+  805bc4:	ff d0                	call   *%rax
+  805bc6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805bc9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805bcd:	74 05                	je     805bd4 <ipc_callw+0xde>
+		return r;
+  805bcf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bd2:	eb 17                	jmp    805beb <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805bd4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bdb:	ff ff ff 
+  805bde:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805be2:	48 8b 00             	mov    (%rax),%rax
+  805be5:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805beb:	48 83 c4 70          	add    $0x70,%rsp
+  805bef:	5b                   	pop    %rbx
+  805bf0:	41 5f                	pop    %r15
+  805bf2:	5d                   	pop    %rbp
+  805bf3:	c3                   	ret
+
+0000000000805bf4 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805bf4:	55                   	push   %rbp
+  805bf5:	48 89 e5             	mov    %rsp,%rbp
+  805bf8:	41 57                	push   %r15
+  805bfa:	53                   	push   %rbx
+  805bfb:	48 83 ec 40          	sub    $0x40,%rsp
+  805bff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bff <ipc_callv+0xb>
+  805c06:	49 bb 39 24 00 00 00 	movabs $0x2439,%r11
+  805c0d:	00 00 00 
+  805c10:	4c 01 db             	add    %r11,%rbx
+  805c13:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805c16:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805c19:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805c1d:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805c20:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805c24:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805c28:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805c2f:	00 00 00 
+  805c32:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805c36:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805c3a:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805c3e:	74 11                	je     805c51 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805c40:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805c44:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805c48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805c4b:	c1 e0 14             	shl    $0x14,%eax
+  805c4e:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805c51:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805c55:	74 14                	je     805c6b <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805c57:	8b 45 20             	mov    0x20(%rbp),%eax
+  805c5a:	83 e8 01             	sub    $0x1,%eax
+  805c5d:	48 63 d0             	movslq %eax,%rdx
+  805c60:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805c64:	48 09 d0             	or     %rdx,%rax
+  805c67:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805c6b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805c6e:	c1 e0 10             	shl    $0x10,%eax
+  805c71:	0b 45 10             	or     0x10(%rbp),%eax
+  805c74:	89 c1                	mov    %eax,%ecx
+  805c76:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805c79:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805c7d:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805c81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805c85:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c88:	4d 89 c1             	mov    %r8,%r9
+  805c8b:	49 89 f8             	mov    %rdi,%r8
+  805c8e:	89 c7                	mov    %eax,%edi
+  805c90:	49 89 df             	mov    %rbx,%r15
+  805c93:	48 b8 c5 a3 ff ff ff 	movabs $0xffffffffffffa3c5,%rax
+  805c9a:	ff ff ff 
+  805c9d:	48 01 d8             	add    %rbx,%rax
+  805ca0:	ff d0                	call   *%rax
+  805ca2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805ca5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ca9:	74 05                	je     805cb0 <ipc_callv+0xbc>
+		return r;
+  805cab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805cae:	eb 17                	jmp    805cc7 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805cb0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805cb7:	ff ff ff 
+  805cba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805cbe:	48 8b 00             	mov    (%rax),%rax
+  805cc1:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805cc7:	48 83 c4 40          	add    $0x40,%rsp
+  805ccb:	5b                   	pop    %rbx
+  805ccc:	41 5f                	pop    %r15
+  805cce:	5d                   	pop    %rbp
+  805ccf:	c3                   	ret
+
+0000000000805cd0 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805cd0:	55                   	push   %rbp
+  805cd1:	48 89 e5             	mov    %rsp,%rbp
+  805cd4:	41 57                	push   %r15
+  805cd6:	53                   	push   %rbx
+  805cd7:	48 83 ec 40          	sub    $0x40,%rsp
+  805cdb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cdb <ipc_reply_recv+0xb>
+  805ce2:	49 bb 5d 23 00 00 00 	movabs $0x235d,%r11
+  805ce9:	00 00 00 
+  805cec:	4c 01 db             	add    %r11,%rbx
+  805cef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805cf2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805cf5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805cf9:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805cfc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805d00:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805d04:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805d09:	75 0e                	jne    805d19 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805d0b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805d12:	00 00 00 
+  805d15:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805d19:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805d1e:	75 0e                	jne    805d2e <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805d20:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805d27:	00 00 00 
+  805d2a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805d2e:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805d31:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805d35:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805d39:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805d3c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805d40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d43:	4d 89 c1             	mov    %r8,%r9
+  805d46:	49 89 f8             	mov    %rdi,%r8
+  805d49:	89 c7                	mov    %eax,%edi
+  805d4b:	49 89 df             	mov    %rbx,%r15
+  805d4e:	48 b8 39 a4 ff ff ff 	movabs $0xffffffffffffa439,%rax
+  805d55:	ff ff ff 
+  805d58:	48 01 d8             	add    %rbx,%rax
+  805d5b:	ff d0                	call   *%rax
+  805d5d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805d60:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805d65:	74 2a                	je     805d91 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805d67:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d6b:	75 19                	jne    805d86 <ipc_reply_recv+0xb6>
+  805d6d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d74:	ff ff ff 
+  805d77:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d7b:	48 8b 00             	mov    (%rax),%rax
+  805d7e:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805d84:	eb 05                	jmp    805d8b <ipc_reply_recv+0xbb>
+  805d86:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805d8f:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805d91:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805d96:	74 2a                	je     805dc2 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805d98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d9c:	75 19                	jne    805db7 <ipc_reply_recv+0xe7>
+  805d9e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805da5:	ff ff ff 
+  805da8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805dac:	48 8b 00             	mov    (%rax),%rax
+  805daf:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805db5:	eb 05                	jmp    805dbc <ipc_reply_recv+0xec>
+  805db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dbc:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805dc0:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805dc2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805dc6:	74 05                	je     805dcd <ipc_reply_recv+0xfd>
+		return r;
+  805dc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dcb:	eb 17                	jmp    805de4 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805dcd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805dd4:	ff ff ff 
+  805dd7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ddb:	48 8b 00             	mov    (%rax),%rax
+  805dde:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805de4:	48 83 c4 40          	add    $0x40,%rsp
+  805de8:	5b                   	pop    %rbx
+  805de9:	41 5f                	pop    %r15
+  805deb:	5d                   	pop    %rbp
+  805dec:	c3                   	ret
+
+0000000000805ded <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805ded:	55                   	push   %rbp
+  805dee:	48 89 e5             	mov    %rsp,%rbp
+  805df1:	41 57                	push   %r15
+  805df3:	53                   	push   %rbx
+  805df4:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805dfb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805dfb <ipc_window_batch+0xe>
+  805e02:	49 bb 3d 22 00 00 00 	movabs $0x223d,%r11
+  805e09:	00 00 00 
+  805e0c:	4c 01 db             	add    %r11,%rbx
+  805e0f:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805e15:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805e1c:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805e22:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805e28:	e9 15 01 00 00       	jmp    805f42 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805e2d:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805e33:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805e36:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805e3d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805e40:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805e43:	39 c2                	cmp    %eax,%edx
+  805e45:	0f 4e c2             	cmovle %edx,%eax
+  805e48:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805e4b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805e52:	eb 6b                	jmp    805ebf <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805e54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e57:	48 98                	cltq
+  805e59:	48 c1 e0 05          	shl    $0x5,%rax
+  805e5d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805e61:	48 01 e8             	add    %rbp,%rax
+  805e64:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805e6a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805e70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e73:	c1 e0 0c             	shl    $0xc,%eax
+  805e76:	48 63 d0             	movslq %eax,%rdx
+  805e79:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805e80:	48 01 c2             	add    %rax,%rdx
+  805e83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e86:	48 98                	cltq
+  805e88:	48 c1 e0 05          	shl    $0x5,%rax
+  805e8c:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805e90:	48 01 e8             	add    %rbp,%rax
+  805e93:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805e99:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805e9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e9f:	48 98                	cltq
+  805ea1:	48 c1 e0 05          	shl    $0x5,%rax
+  805ea5:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805ea9:	48 01 e8             	add    %rbp,%rax
+  805eac:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805eb3:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805eb9:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805ebb:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805ebf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ec2:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805ec5:	7c 8d                	jl     805e54 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805ec7:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805ece:	74 27                	je     805ef7 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805ed0:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805ed3:	48 63 d0             	movslq %eax,%rdx
+  805ed6:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805edd:	48 89 d6             	mov    %rdx,%rsi
+  805ee0:	48 89 c7             	mov    %rax,%rdi
+  805ee3:	49 89 df             	mov    %rbx,%r15
+  805ee6:	48 b8 dc a6 ff ff ff 	movabs $0xffffffffffffa6dc,%rax
+  805eed:	ff ff ff 
+  805ef0:	48 01 d8             	add    %rbx,%rax
+  805ef3:	ff d0                	call   *%rax
+  805ef5:	eb 25                	jmp    805f1c <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805ef7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805efa:	48 63 d0             	movslq %eax,%rdx
+  805efd:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805f04:	48 89 d6             	mov    %rdx,%rsi
+  805f07:	48 89 c7             	mov    %rax,%rdi
+  805f0a:	49 89 df             	mov    %rbx,%r15
+  805f0d:	48 b8 3a a7 ff ff ff 	movabs $0xffffffffffffa73a,%rax
+  805f14:	ff ff ff 
+  805f17:	48 01 d8             	add    %rbx,%rax
+  805f1a:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805f1c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805f1f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805f23:	79 05                	jns    805f2a <ipc_window_batch+0x13d>
+			return r;
+  805f25:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f28:	eb 2a                	jmp    805f54 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805f2a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805f2d:	c1 e0 0c             	shl    $0xc,%eax
+  805f30:	48 98                	cltq
+  805f32:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805f39:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805f3c:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805f42:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805f49:	0f 8f de fe ff ff    	jg     805e2d <ipc_window_batch+0x40>
+	}
+	return 0;
+  805f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805f54:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805f5b:	5b                   	pop    %rbx
+  805f5c:	41 5f                	pop    %r15
+  805f5e:	5d                   	pop    %rbp
+  805f5f:	c3                   	ret
+
+0000000000805f60 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805f60:	55                   	push   %rbp
+  805f61:	48 89 e5             	mov    %rsp,%rbp
+  805f64:	48 83 ec 10          	sub    $0x10,%rsp
+  805f68:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f68 <ipc_map_window+0x8>
+  805f6f:	49 bb d0 20 00 00 00 	movabs $0x20d0,%r11
+  805f76:	00 00 00 
+  805f79:	4c 01 d8             	add    %r11,%rax
+  805f7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f80:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805f83:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805f86:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805f8a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805f8f:	bf 01 00 00 00       	mov    $0x1,%edi
+  805f94:	49 b8 b5 dd ff ff ff 	movabs $0xffffffffffffddb5,%r8
+  805f9b:	ff ff ff 
+  805f9e:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805fa2:	ff d0                	call   *%rax
+}
+  805fa4:	c9                   	leave
+  805fa5:	c3                   	ret
+
+0000000000805fa6 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805fa6:	55                   	push   %rbp
+  805fa7:	48 89 e5             	mov    %rsp,%rbp
+  805faa:	48 83 ec 10          	sub    $0x10,%rsp
+  805fae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805fae <ipc_unmap_window+0x8>
+  805fb5:	49 bb 8a 20 00 00 00 	movabs $0x208a,%r11
+  805fbc:	00 00 00 
+  805fbf:	4c 01 d8             	add    %r11,%rax
+  805fc2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805fc6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805fc9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805fcc:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805fd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805fd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fda:	49 b8 b5 dd ff ff ff 	movabs $0xffffffffffffddb5,%r8
+  805fe1:	ff ff ff 
+  805fe4:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805fe8:	ff d0                	call   *%rax
+}
+  805fea:	c9                   	leave
+  805feb:	c3                   	ret
+
+0000000000805fec <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805fec:	55                   	push   %rbp
+  805fed:	48 89 e5             	mov    %rsp,%rbp
+  805ff0:	48 83 ec 18          	sub    $0x18,%rsp
+  805ff4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ff4 <ipc_find_env+0x8>
+  805ffb:	49 bb 44 20 00 00 00 	movabs $0x2044,%r11
+  806002:	00 00 00 
+  806005:	4c 01 d8             	add    %r11,%rax
+  806008:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  80600b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806012:	eb 57                	jmp    80606b <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806014:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  80601b:	ff ff ff 
+  80601e:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806022:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806025:	48 63 d2             	movslq %edx,%rdx
+  806028:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  80602f:	48 01 ca             	add    %rcx,%rdx
+  806032:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806039:	8b 12                	mov    (%rdx),%edx
+  80603b:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  80603e:	75 27                	jne    806067 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806040:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  806047:	ff ff ff 
+  80604a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80604e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806051:	48 98                	cltq
+  806053:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80605a:	48 01 d0             	add    %rdx,%rax
+  80605d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806063:	8b 00                	mov    (%rax),%eax
+  806065:	eb 12                	jmp    806079 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806067:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80606b:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806072:	7e a0                	jle    806014 <ipc_find_env+0x28>
+	}
+	return 0;
+  806074:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806079:	c9                   	leave
+  80607a:	c3                   	ret
+
+000000000080607b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80607b:	55                   	push   %rbp
+  80607c:	48 89 e5             	mov    %rsp,%rbp
+  80607f:	48 83 ec 18          	sub    $0x18,%rsp
+  806083:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806083 <pageref+0x8>
+  80608a:	49 bb b5 1f 00 00 00 	movabs $0x1fb5,%r11
+  806091:	00 00 00 
+  806094:	4c 01 d8             	add    %r11,%rax
+  806097:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80609b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80609f:	48 89 d1             	mov    %rdx,%rcx
+  8060a2:	48 c1 e9 15          	shr    $0x15,%rcx
+  8060a6:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8060ad:	ff ff ff 
+  8060b0:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8060b4:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8060b8:	83 e2 01             	and    $0x1,%edx
+  8060bb:	48 85 d2             	test   %rdx,%rdx
+  8060be:	75 07                	jne    8060c7 <pageref+0x4c>
+		return 0;
+  8060c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060c5:	eb 64                	jmp    80612b <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  8060c7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8060cb:	48 89 d1             	mov    %rdx,%rcx
+  8060ce:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8060d2:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8060d9:	ff ff ff 
+  8060dc:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8060e0:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8060e4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8060e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8060ec:	83 e2 01             	and    $0x1,%edx
+  8060ef:	48 85 d2             	test   %rdx,%rdx
+  8060f2:	75 07                	jne    8060fb <pageref+0x80>
+		return 0;
+  8060f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060f9:	eb 30                	jmp    80612b <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8060fb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8060ff:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806103:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80610a:	ff ff ff 
+  80610d:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806111:	48 89 d0             	mov    %rdx,%rax
+  806114:	48 01 c0             	add    %rax,%rax
+  806117:	48 01 d0             	add    %rdx,%rax
+  80611a:	48 c1 e0 03          	shl    $0x3,%rax
+  80611e:	48 01 c8             	add    %rcx,%rax
+  806121:	48 83 c0 08          	add    $0x8,%rax
+  806125:	0f b7 00             	movzwl (%rax),%eax
+  806128:	0f b7 c0             	movzwl %ax,%eax
+}
+  80612b:	c9                   	leave
+  80612c:	c3                   	ret
@@ -0,0 +1,9524 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 9a 01 00 00       	call   8001db <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 30          	sub    $0x30,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <handler+0xb>
+  800055:	49 bb ea 7f 00 00 00 	movabs $0x7fea,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	void *addr = (void*)utf->utf_fault_va;
+  800066:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80006a:	48 8b 00             	mov    (%rax),%rax
+  80006d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	cprintf("fault %x\n", addr);
+  800071:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800075:	48 89 c6             	mov    %rax,%rsi
+  800078:	48 b8 b8 e0 ff ff ff 	movabs $0xffffffffffffe0b8,%rax
+  80007f:	ff ff ff 
+  800082:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800086:	48 89 c7             	mov    %rax,%rdi
+  800089:	49 89 df             	mov    %rbx,%r15
+  80008c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800091:	48 ba 84 85 ff ff ff 	movabs $0xffffffffffff8584,%rdx
+  800098:	ff ff ff 
+  80009b:	48 01 da             	add    %rbx,%rdx
+  80009e:	ff d2                	call   *%rdx
+	if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  8000a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000a4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8000a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8000ac:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8000b2:	ba 07 00 00 00       	mov    $0x7,%edx
+  8000b7:	48 89 c6             	mov    %rax,%rsi
+  8000ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000bf:	49 89 df             	mov    %rbx,%r15
+  8000c2:	48 b8 02 a0 ff ff ff 	movabs $0xffffffffffffa002,%rax
+  8000c9:	ff ff ff 
+  8000cc:	48 01 d8             	add    %rbx,%rax
+  8000cf:	ff d0                	call   *%rax
+  8000d1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8000d4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8000d8:	79 4c                	jns    800126 <handler+0xe3>
+				PTE_P|PTE_U|PTE_W)) < 0)
+		panic("allocating at %x in page fault handler: %e", addr, r);
+  8000da:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8000dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000e1:	41 89 d0             	mov    %edx,%r8d
+  8000e4:	48 89 c1             	mov    %rax,%rcx
+  8000e7:	48 b8 c8 e0 ff ff ff 	movabs $0xffffffffffffe0c8,%rax
+  8000ee:	ff ff ff 
+  8000f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000f5:	48 89 c2             	mov    %rax,%rdx
+  8000f8:	be 0f 00 00 00       	mov    $0xf,%esi
+  8000fd:	48 b8 f3 e0 ff ff ff 	movabs $0xffffffffffffe0f3,%rax
+  800104:	ff ff ff 
+  800107:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80010b:	48 89 c7             	mov    %rax,%rdi
+  80010e:	49 89 df             	mov    %rbx,%r15
+  800111:	b8 00 00 00 00       	mov    $0x0,%eax
+  800116:	49 b9 ad 82 ff ff ff 	movabs $0xffffffffffff82ad,%r9
+  80011d:	ff ff ff 
+  800120:	49 01 d9             	add    %rbx,%r9
+  800123:	41 ff d1             	call   *%r9
+	snprintf((char*) addr, 100, "this string was faulted in at %x", addr);
+  800126:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80012a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80012e:	48 89 d1             	mov    %rdx,%rcx
+  800131:	48 ba 08 e1 ff ff ff 	movabs $0xffffffffffffe108,%rdx
+  800138:	ff ff ff 
+  80013b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80013f:	be 64 00 00 00       	mov    $0x64,%esi
+  800144:	48 89 c7             	mov    %rax,%rdi
+  800147:	49 89 df             	mov    %rbx,%r15
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	49 b8 b9 91 ff ff ff 	movabs $0xffffffffffff91b9,%r8
+  800156:	ff ff ff 
+  800159:	49 01 d8             	add    %rbx,%r8
+  80015c:	41 ff d0             	call   *%r8
+}
+  80015f:	90                   	nop
+  800160:	48 83 c4 30          	add    $0x30,%rsp
+  800164:	5b                   	pop    %rbx
+  800165:	41 5f                	pop    %r15
+  800167:	5d                   	pop    %rbp
+  800168:	c3                   	ret
+
+0000000000800169 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800169:	55                   	push   %rbp
+  80016a:	48 89 e5             	mov    %rsp,%rbp
+  80016d:	41 57                	push   %r15
+  80016f:	53                   	push   %rbx
+  800170:	48 83 ec 10          	sub    $0x10,%rsp
+  800174:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800174 <umain+0xb>
+  80017b:	49 bb c4 7e 00 00 00 	movabs $0x7ec4,%r11
+  800182:	00 00 00 
+  800185:	4c 01 db             	add    %r11,%rbx
+  800188:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80018b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	set_pgfault_handler(handler);
+  80018f:	48 b8 0b 80 ff ff ff 	movabs $0xffffffffffff800b,%rax
+  800196:	ff ff ff 
+  800199:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80019d:	48 89 c7             	mov    %rax,%rdi
+  8001a0:	49 89 df             	mov    %rbx,%r15
+  8001a3:	48 b8 ab a7 ff ff ff 	movabs $0xffffffffffffa7ab,%rax
+  8001aa:	ff ff ff 
+  8001ad:	48 01 d8             	add    %rbx,%rax
+  8001b0:	ff d0                	call   *%rax
+	sys_cputs((char*)0xDEADBEEF, 4);
+  8001b2:	be 04 00 00 00       	mov    $0x4,%esi
+  8001b7:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  8001bc:	48 89 c7             	mov    %rax,%rdi
+  8001bf:	49 89 df             	mov    %rbx,%r15
+  8001c2:	48 b8 4a 9e ff ff ff 	movabs $0xffffffffffff9e4a,%rax
+  8001c9:	ff ff ff 
+  8001cc:	48 01 d8             	add    %rbx,%rax
+  8001cf:	ff d0                	call   *%rax
+}
+  8001d1:	90                   	nop
+  8001d2:	48 83 c4 10          	add    $0x10,%rsp
+  8001d6:	5b                   	pop    %rbx
+  8001d7:	41 5f                	pop    %r15
+  8001d9:	5d                   	pop    %rbp
+  8001da:	c3                   	ret
+
+00000000008001db <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001db:	55                   	push   %rbp
+  8001dc:	48 89 e5             	mov    %rsp,%rbp
+  8001df:	41 57                	push   %r15
+  8001e1:	53                   	push   %rbx
+  8001e2:	48 83 ec 20          	sub    $0x20,%rsp
+  8001e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8001e6 <libmain+0xb>
+  8001ed:	49 bb 52 7e 00 00 00 	movabs $0x7e52,%r11
+  8001f4:	00 00 00 
+  8001f7:	4c 01 db             	add    %r11,%rbx
+  8001fa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8001fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800201:	49 89 df             	mov    %rbx,%r15
+  800204:	48 b8 59 9f ff ff ff 	movabs $0xffffffffffff9f59,%rax
+  80020b:	ff ff ff 
+  80020e:	48 01 d8             	add    %rbx,%rax
+  800211:	ff d0                	call   *%rax
+  800213:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800216:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800219:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80021e:	48 98                	cltq
+  800220:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800227:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  80022e:	ff ff ff 
+  800231:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800235:	48 01 c2             	add    %rax,%rdx
+  800238:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80023f:	00 00 00 
+  800242:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800246:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80024a:	7e 15                	jle    800261 <libmain+0x86>
+		binaryname = argv[0];
+  80024c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800250:	48 8b 00             	mov    (%rax),%rax
+  800253:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  80025a:	00 00 00 
+  80025d:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800261:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800265:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800268:	48 89 d6             	mov    %rdx,%rsi
+  80026b:	89 c7                	mov    %eax,%edi
+  80026d:	49 89 df             	mov    %rbx,%r15
+  800270:	48 b8 31 81 ff ff ff 	movabs $0xffffffffffff8131,%rax
+  800277:	ff ff ff 
+  80027a:	48 01 d8             	add    %rbx,%rax
+  80027d:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80027f:	49 89 df             	mov    %rbx,%r15
+  800282:	48 b8 63 82 ff ff ff 	movabs $0xffffffffffff8263,%rax
+  800289:	ff ff ff 
+  80028c:	48 01 d8             	add    %rbx,%rax
+  80028f:	ff d0                	call   *%rax
+}
+  800291:	90                   	nop
+  800292:	48 83 c4 20          	add    $0x20,%rsp
+  800296:	5b                   	pop    %rbx
+  800297:	41 5f                	pop    %r15
+  800299:	5d                   	pop    %rbp
+  80029a:	c3                   	ret
+
+000000000080029b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	41 57                	push   %r15
+  8002a1:	53                   	push   %rbx
+  8002a2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8002a2 <exit+0x7>
+  8002a9:	49 bb 96 7d 00 00 00 	movabs $0x7d96,%r11
+  8002b0:	00 00 00 
+  8002b3:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8002b6:	49 89 df             	mov    %rbx,%r15
+  8002b9:	48 b8 58 ad ff ff ff 	movabs $0xffffffffffffad58,%rax
+  8002c0:	ff ff ff 
+  8002c3:	48 01 d8             	add    %rbx,%rax
+  8002c6:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8002c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002cd:	49 89 df             	mov    %rbx,%r15
+  8002d0:	48 b8 fd 9e ff ff ff 	movabs $0xffffffffffff9efd,%rax
+  8002d7:	ff ff ff 
+  8002da:	48 01 d8             	add    %rbx,%rax
+  8002dd:	ff d0                	call   *%rax
+}
+  8002df:	90                   	nop
+  8002e0:	5b                   	pop    %rbx
+  8002e1:	41 5f                	pop    %r15
+  8002e3:	5d                   	pop    %rbp
+  8002e4:	c3                   	ret
+
+00000000008002e5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002e5:	55                   	push   %rbp
+  8002e6:	48 89 e5             	mov    %rsp,%rbp
+  8002e9:	41 57                	push   %r15
+  8002eb:	41 54                	push   %r12
+  8002ed:	53                   	push   %rbx
+  8002ee:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8002f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8002f5 <_panic+0x10>
+  8002fc:	49 bb 43 7d 00 00 00 	movabs $0x7d43,%r11
+  800303:	00 00 00 
+  800306:	4c 01 db             	add    %r11,%rbx
+  800309:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800310:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800316:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80031d:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800324:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80032b:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800332:	84 c0                	test   %al,%al
+  800334:	74 26                	je     80035c <_panic+0x77>
+  800336:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80033d:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800344:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800348:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80034c:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800350:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800354:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800358:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80035c:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800363:	00 00 00 
+  800366:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80036d:	00 00 00 
+  800370:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800374:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80037b:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800382:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800389:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  800390:	ff ff ff 
+  800393:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800397:	4c 8b 20             	mov    (%rax),%r12
+  80039a:	49 89 df             	mov    %rbx,%r15
+  80039d:	48 b8 59 9f ff ff ff 	movabs $0xffffffffffff9f59,%rax
+  8003a4:	ff ff ff 
+  8003a7:	48 01 d8             	add    %rbx,%rax
+  8003aa:	ff d0                	call   *%rax
+  8003ac:	89 c6                	mov    %eax,%esi
+  8003ae:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8003b4:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8003bb:	41 89 d0             	mov    %edx,%r8d
+  8003be:	48 89 c1             	mov    %rax,%rcx
+  8003c1:	4c 89 e2             	mov    %r12,%rdx
+  8003c4:	48 b8 38 e1 ff ff ff 	movabs $0xffffffffffffe138,%rax
+  8003cb:	ff ff ff 
+  8003ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003d2:	48 89 c7             	mov    %rax,%rdi
+  8003d5:	49 89 df             	mov    %rbx,%r15
+  8003d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dd:	49 b9 84 85 ff ff ff 	movabs $0xffffffffffff8584,%r9
+  8003e4:	ff ff ff 
+  8003e7:	49 01 d9             	add    %rbx,%r9
+  8003ea:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003ed:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8003f4:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8003fb:	48 89 d6             	mov    %rdx,%rsi
+  8003fe:	48 89 c7             	mov    %rax,%rdi
+  800401:	49 89 df             	mov    %rbx,%r15
+  800404:	48 b8 a4 84 ff ff ff 	movabs $0xffffffffffff84a4,%rax
+  80040b:	ff ff ff 
+  80040e:	48 01 d8             	add    %rbx,%rax
+  800411:	ff d0                	call   *%rax
+	cprintf("\n");
+  800413:	48 b8 5b e1 ff ff ff 	movabs $0xffffffffffffe15b,%rax
+  80041a:	ff ff ff 
+  80041d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800421:	48 89 c7             	mov    %rax,%rdi
+  800424:	49 89 df             	mov    %rbx,%r15
+  800427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042c:	48 ba 84 85 ff ff ff 	movabs $0xffffffffffff8584,%rdx
+  800433:	ff ff ff 
+  800436:	48 01 da             	add    %rbx,%rdx
+  800439:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80043b:	cc                   	int3
+  80043c:	eb fd                	jmp    80043b <_panic+0x156>
+
+000000000080043e <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  80043e:	55                   	push   %rbp
+  80043f:	48 89 e5             	mov    %rsp,%rbp
+  800442:	41 57                	push   %r15
+  800444:	48 83 ec 18          	sub    $0x18,%rsp
+  800448:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800448 <putch+0xa>
+  80044f:	49 bb f0 7b 00 00 00 	movabs $0x7bf0,%r11
+  800456:	00 00 00 
+  800459:	4c 01 d8             	add    %r11,%rax
+  80045c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80045f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800463:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800467:	8b 12                	mov    (%rdx),%edx
+  800469:	8d 72 01             	lea    0x1(%rdx),%esi
+  80046c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800470:	89 31                	mov    %esi,(%rcx)
+  800472:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800475:	89 ce                	mov    %ecx,%esi
+  800477:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80047b:	48 63 d2             	movslq %edx,%rdx
+  80047e:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800483:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800487:	8b 12                	mov    (%rdx),%edx
+  800489:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80048f:	75 33                	jne    8004c4 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800491:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800495:	8b 12                	mov    (%rdx),%edx
+  800497:	48 63 d2             	movslq %edx,%rdx
+  80049a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80049e:	48 83 c1 08          	add    $0x8,%rcx
+  8004a2:	48 89 d6             	mov    %rdx,%rsi
+  8004a5:	48 89 cf             	mov    %rcx,%rdi
+  8004a8:	49 89 c7             	mov    %rax,%r15
+  8004ab:	48 ba 4a 9e ff ff ff 	movabs $0xffffffffffff9e4a,%rdx
+  8004b2:	ff ff ff 
+  8004b5:	48 01 c2             	add    %rax,%rdx
+  8004b8:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8004ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004be:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8004c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004c8:	8b 40 04             	mov    0x4(%rax),%eax
+  8004cb:	8d 50 01             	lea    0x1(%rax),%edx
+  8004ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004d2:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8004d5:	90                   	nop
+  8004d6:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8004da:	c9                   	leave
+  8004db:	c3                   	ret
+
+00000000008004dc <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004dc:	55                   	push   %rbp
+  8004dd:	48 89 e5             	mov    %rsp,%rbp
+  8004e0:	41 57                	push   %r15
+  8004e2:	53                   	push   %rbx
+  8004e3:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8004ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004ea <vcprintf+0xe>
+  8004f1:	49 bb 4e 7b 00 00 00 	movabs $0x7b4e,%r11
+  8004f8:	00 00 00 
+  8004fb:	4c 01 db             	add    %r11,%rbx
+  8004fe:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800505:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80050c:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800513:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80051a:	48 8b 06             	mov    (%rsi),%rax
+  80051d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800521:	48 89 01             	mov    %rax,(%rcx)
+  800524:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800528:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80052c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800530:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800537:	00 00 00 
+    b.cnt = 0;
+  80053a:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800541:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800544:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80054b:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800552:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800559:	48 89 c6             	mov    %rax,%rsi
+  80055c:	48 b8 06 84 ff ff ff 	movabs $0xffffffffffff8406,%rax
+  800563:	ff ff ff 
+  800566:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80056a:	48 89 c7             	mov    %rax,%rdi
+  80056d:	49 89 df             	mov    %rbx,%r15
+  800570:	48 b8 c8 89 ff ff ff 	movabs $0xffffffffffff89c8,%rax
+  800577:	ff ff ff 
+  80057a:	48 01 d8             	add    %rbx,%rax
+  80057d:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  80057f:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800585:	48 98                	cltq
+  800587:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  80058e:	48 83 c2 08          	add    $0x8,%rdx
+  800592:	48 89 c6             	mov    %rax,%rsi
+  800595:	48 89 d7             	mov    %rdx,%rdi
+  800598:	49 89 df             	mov    %rbx,%r15
+  80059b:	48 b8 4a 9e ff ff ff 	movabs $0xffffffffffff9e4a,%rax
+  8005a2:	ff ff ff 
+  8005a5:	48 01 d8             	add    %rbx,%rax
+  8005a8:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8005aa:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8005b0:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8005b7:	5b                   	pop    %rbx
+  8005b8:	41 5f                	pop    %r15
+  8005ba:	5d                   	pop    %rbp
+  8005bb:	c3                   	ret
+
+00000000008005bc <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8005bc:	55                   	push   %rbp
+  8005bd:	48 89 e5             	mov    %rsp,%rbp
+  8005c0:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8005c7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8005c7 <cprintf+0xb>
+  8005ce:	49 bb 71 7a 00 00 00 	movabs $0x7a71,%r11
+  8005d5:	00 00 00 
+  8005d8:	4d 01 da             	add    %r11,%r10
+  8005db:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8005e2:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8005e9:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8005f0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8005f7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8005fe:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800605:	84 c0                	test   %al,%al
+  800607:	74 20                	je     800629 <cprintf+0x6d>
+  800609:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80060d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800611:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800615:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800619:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80061d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800621:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800625:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800629:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800630:	00 00 00 
+  800633:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80063a:	00 00 00 
+  80063d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800641:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800648:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80064f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800656:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80065d:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800664:	48 8b 06             	mov    (%rsi),%rax
+  800667:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80066b:	48 89 01             	mov    %rax,(%rcx)
+  80066e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800672:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800676:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80067a:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800681:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800688:	48 89 d6             	mov    %rdx,%rsi
+  80068b:	48 89 c7             	mov    %rax,%rdi
+  80068e:	48 b8 a4 84 ff ff ff 	movabs $0xffffffffffff84a4,%rax
+  800695:	ff ff ff 
+  800698:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80069c:	ff d0                	call   *%rax
+  80069e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8006a4:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8006aa:	c9                   	leave
+  8006ab:	c3                   	ret
+
+00000000008006ac <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8006ac:	55                   	push   %rbp
+  8006ad:	48 89 e5             	mov    %rsp,%rbp
+  8006b0:	53                   	push   %rbx
+  8006b1:	48 83 ec 38          	sub    $0x38,%rsp
+  8006b5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006b5 <printnum+0x9>
+  8006bc:	49 bb 83 79 00 00 00 	movabs $0x7983,%r11
+  8006c3:	00 00 00 
+  8006c6:	4c 01 db             	add    %r11,%rbx
+  8006c9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8006cd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8006d1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8006d5:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8006d8:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8006dc:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8006e0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8006e3:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8006e7:	72 58                	jb     800741 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006e9:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8006ec:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8006ef:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8006f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8006f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006fb:	48 f7 f6             	div    %rsi
+  8006fe:	49 89 c2             	mov    %rax,%r10
+  800701:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800704:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800707:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80070b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80070f:	41 89 c9             	mov    %ecx,%r9d
+  800712:	41 89 f8             	mov    %edi,%r8d
+  800715:	89 d1                	mov    %edx,%ecx
+  800717:	4c 89 d2             	mov    %r10,%rdx
+  80071a:	48 89 c7             	mov    %rax,%rdi
+  80071d:	48 b8 74 86 ff ff ff 	movabs $0xffffffffffff8674,%rax
+  800724:	ff ff ff 
+  800727:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80072b:	ff d0                	call   *%rax
+  80072d:	eb 1c                	jmp    80074b <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80072f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800733:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800736:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80073a:	48 89 d6             	mov    %rdx,%rsi
+  80073d:	89 c7                	mov    %eax,%edi
+  80073f:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800741:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800745:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800749:	7f e4                	jg     80072f <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80074b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80074e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800752:	ba 00 00 00 00       	mov    $0x0,%edx
+  800757:	48 f7 f1             	div    %rcx
+  80075a:	48 b8 97 e2 ff ff ff 	movabs $0xffffffffffffe297,%rax
+  800761:	ff ff ff 
+  800764:	48 01 d8             	add    %rbx,%rax
+  800767:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80076b:	0f be c0             	movsbl %al,%eax
+  80076e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800772:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800776:	48 89 d6             	mov    %rdx,%rsi
+  800779:	89 c7                	mov    %eax,%edi
+  80077b:	ff d1                	call   *%rcx
+}
+  80077d:	90                   	nop
+  80077e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800782:	c9                   	leave
+  800783:	c3                   	ret
+
+0000000000800784 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800784:	55                   	push   %rbp
+  800785:	48 89 e5             	mov    %rsp,%rbp
+  800788:	48 83 ec 20          	sub    $0x20,%rsp
+  80078c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80078c <getuint+0x8>
+  800793:	49 bb ac 78 00 00 00 	movabs $0x78ac,%r11
+  80079a:	00 00 00 
+  80079d:	4c 01 d8             	add    %r11,%rax
+  8007a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007a4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8007a7:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8007ab:	7e 4f                	jle    8007fc <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8007ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007b1:	8b 00                	mov    (%rax),%eax
+  8007b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b6:	77 24                	ja     8007dc <getuint+0x58>
+  8007b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007bc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c4:	8b 00                	mov    (%rax),%eax
+  8007c6:	89 c0                	mov    %eax,%eax
+  8007c8:	48 01 d0             	add    %rdx,%rax
+  8007cb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007cf:	8b 12                	mov    (%rdx),%edx
+  8007d1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007d8:	89 0a                	mov    %ecx,(%rdx)
+  8007da:	eb 14                	jmp    8007f0 <getuint+0x6c>
+  8007dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007e4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007e8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007ec:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007f0:	48 8b 00             	mov    (%rax),%rax
+  8007f3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007f7:	e9 9d 00 00 00       	jmp    800899 <getuint+0x115>
+	else if (lflag)
+  8007fc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800800:	74 4c                	je     80084e <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800802:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800806:	8b 00                	mov    (%rax),%eax
+  800808:	83 f8 2f             	cmp    $0x2f,%eax
+  80080b:	77 24                	ja     800831 <getuint+0xad>
+  80080d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800811:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800815:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800819:	8b 00                	mov    (%rax),%eax
+  80081b:	89 c0                	mov    %eax,%eax
+  80081d:	48 01 d0             	add    %rdx,%rax
+  800820:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800824:	8b 12                	mov    (%rdx),%edx
+  800826:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800829:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80082d:	89 0a                	mov    %ecx,(%rdx)
+  80082f:	eb 14                	jmp    800845 <getuint+0xc1>
+  800831:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800835:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800839:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80083d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800841:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800845:	48 8b 00             	mov    (%rax),%rax
+  800848:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80084c:	eb 4b                	jmp    800899 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  80084e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800852:	8b 00                	mov    (%rax),%eax
+  800854:	83 f8 2f             	cmp    $0x2f,%eax
+  800857:	77 24                	ja     80087d <getuint+0xf9>
+  800859:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80085d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800861:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800865:	8b 00                	mov    (%rax),%eax
+  800867:	89 c0                	mov    %eax,%eax
+  800869:	48 01 d0             	add    %rdx,%rax
+  80086c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800870:	8b 12                	mov    (%rdx),%edx
+  800872:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800875:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800879:	89 0a                	mov    %ecx,(%rdx)
+  80087b:	eb 14                	jmp    800891 <getuint+0x10d>
+  80087d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800881:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800885:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800889:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80088d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800891:	8b 00                	mov    (%rax),%eax
+  800893:	89 c0                	mov    %eax,%eax
+  800895:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800899:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80089d:	c9                   	leave
+  80089e:	c3                   	ret
+
+000000000080089f <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  80089f:	55                   	push   %rbp
+  8008a0:	48 89 e5             	mov    %rsp,%rbp
+  8008a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8008a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008a7 <printfloat+0x8>
+  8008ae:	49 bb 91 77 00 00 00 	movabs $0x7791,%r11
+  8008b5:	00 00 00 
+  8008b8:	4c 01 d8             	add    %r11,%rax
+  8008bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008bf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008c3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8008c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008cb:	48 85 c0             	test   %rax,%rax
+  8008ce:	79 12                	jns    8008e2 <printfloat+0x43>
+		putch('-',putdat);
+  8008d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8008d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008d8:	48 89 c6             	mov    %rax,%rsi
+  8008db:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008e0:	ff d2                	call   *%rdx
+	
+}
+  8008e2:	90                   	nop
+  8008e3:	c9                   	leave
+  8008e4:	c3                   	ret
+
+00000000008008e5 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8008e5:	55                   	push   %rbp
+  8008e6:	48 89 e5             	mov    %rsp,%rbp
+  8008e9:	48 83 ec 20          	sub    $0x20,%rsp
+  8008ed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008ed <getint+0x8>
+  8008f4:	49 bb 4b 77 00 00 00 	movabs $0x774b,%r11
+  8008fb:	00 00 00 
+  8008fe:	4c 01 d8             	add    %r11,%rax
+  800901:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800905:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800908:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80090c:	7e 4f                	jle    80095d <getint+0x78>
+		x=va_arg(*ap, long long);
+  80090e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800912:	8b 00                	mov    (%rax),%eax
+  800914:	83 f8 2f             	cmp    $0x2f,%eax
+  800917:	77 24                	ja     80093d <getint+0x58>
+  800919:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80091d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800921:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800925:	8b 00                	mov    (%rax),%eax
+  800927:	89 c0                	mov    %eax,%eax
+  800929:	48 01 d0             	add    %rdx,%rax
+  80092c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800930:	8b 12                	mov    (%rdx),%edx
+  800932:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800935:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800939:	89 0a                	mov    %ecx,(%rdx)
+  80093b:	eb 14                	jmp    800951 <getint+0x6c>
+  80093d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800941:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800945:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800949:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80094d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800951:	48 8b 00             	mov    (%rax),%rax
+  800954:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800958:	e9 9d 00 00 00       	jmp    8009fa <getint+0x115>
+	else if (lflag)
+  80095d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800961:	74 4c                	je     8009af <getint+0xca>
+		x=va_arg(*ap, long);
+  800963:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800967:	8b 00                	mov    (%rax),%eax
+  800969:	83 f8 2f             	cmp    $0x2f,%eax
+  80096c:	77 24                	ja     800992 <getint+0xad>
+  80096e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800972:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800976:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80097a:	8b 00                	mov    (%rax),%eax
+  80097c:	89 c0                	mov    %eax,%eax
+  80097e:	48 01 d0             	add    %rdx,%rax
+  800981:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800985:	8b 12                	mov    (%rdx),%edx
+  800987:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80098a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80098e:	89 0a                	mov    %ecx,(%rdx)
+  800990:	eb 14                	jmp    8009a6 <getint+0xc1>
+  800992:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800996:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80099a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80099e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009a2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009a6:	48 8b 00             	mov    (%rax),%rax
+  8009a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009ad:	eb 4b                	jmp    8009fa <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8009af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009b3:	8b 00                	mov    (%rax),%eax
+  8009b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b8:	77 24                	ja     8009de <getint+0xf9>
+  8009ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009be:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c6:	8b 00                	mov    (%rax),%eax
+  8009c8:	89 c0                	mov    %eax,%eax
+  8009ca:	48 01 d0             	add    %rdx,%rax
+  8009cd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009d1:	8b 12                	mov    (%rdx),%edx
+  8009d3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009da:	89 0a                	mov    %ecx,(%rdx)
+  8009dc:	eb 14                	jmp    8009f2 <getint+0x10d>
+  8009de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009e6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009ea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009ee:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009f2:	8b 00                	mov    (%rax),%eax
+  8009f4:	48 98                	cltq
+  8009f6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8009fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8009fe:	c9                   	leave
+  8009ff:	c3                   	ret
+
+0000000000800a00 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800a00:	55                   	push   %rbp
+  800a01:	48 89 e5             	mov    %rsp,%rbp
+  800a04:	41 57                	push   %r15
+  800a06:	41 55                	push   %r13
+  800a08:	41 54                	push   %r12
+  800a0a:	53                   	push   %rbx
+  800a0b:	48 83 ec 60          	sub    $0x60,%rsp
+  800a0f:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800a0f <vprintfmt+0xf>
+  800a16:	49 bb 29 76 00 00 00 	movabs $0x7629,%r11
+  800a1d:	00 00 00 
+  800a20:	4d 01 dc             	add    %r11,%r12
+  800a23:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800a27:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800a2b:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800a2f:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800a33:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800a3a:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800a3e:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800a42:	48 8b 06             	mov    (%rsi),%rax
+  800a45:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a49:	48 89 01             	mov    %rax,(%rcx)
+  800a4c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a50:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a54:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a58:	eb 17                	jmp    800a71 <vprintfmt+0x71>
+			if (ch == '\0')
+  800a5a:	85 db                	test   %ebx,%ebx
+  800a5c:	0f 84 97 05 00 00    	je     800ff9 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800a62:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800a66:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800a6a:	48 89 c6             	mov    %rax,%rsi
+  800a6d:	89 df                	mov    %ebx,%edi
+  800a6f:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a71:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800a75:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a79:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800a7d:	0f b6 00             	movzbl (%rax),%eax
+  800a80:	0f b6 d8             	movzbl %al,%ebx
+  800a83:	83 fb 25             	cmp    $0x25,%ebx
+  800a86:	75 d2                	jne    800a5a <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800a88:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800a8c:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800a93:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800a9a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800aa1:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800aa8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800aac:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ab0:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800ab4:	0f b6 00             	movzbl (%rax),%eax
+  800ab7:	0f b6 d8             	movzbl %al,%ebx
+  800aba:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800abd:	83 f8 55             	cmp    $0x55,%eax
+  800ac0:	0f 87 00 05 00 00    	ja     800fc6 <vprintfmt+0x5c6>
+  800ac6:	89 c0                	mov    %eax,%eax
+  800ac8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800acf:	00 
+  800ad0:	48 8d 05 21 58 00 00 	lea    0x5821(%rip),%rax        # 8062f8 <.LC18+0xc>
+  800ad7:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800adb:	48 8d 15 16 58 00 00 	lea    0x5816(%rip),%rdx        # 8062f8 <.LC18+0xc>
+  800ae2:	48 01 d0             	add    %rdx,%rax
+  800ae5:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800ae7:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800aeb:	eb bb                	jmp    800aa8 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800aed:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800af1:	eb b5                	jmp    800aa8 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800af3:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800afa:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800afd:	89 d0                	mov    %edx,%eax
+  800aff:	c1 e0 02             	shl    $0x2,%eax
+  800b02:	01 d0                	add    %edx,%eax
+  800b04:	01 c0                	add    %eax,%eax
+  800b06:	01 d8                	add    %ebx,%eax
+  800b08:	83 e8 30             	sub    $0x30,%eax
+  800b0b:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800b0e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b12:	0f b6 00             	movzbl (%rax),%eax
+  800b15:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800b18:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b1b:	7e 60                	jle    800b7d <vprintfmt+0x17d>
+  800b1d:	83 fb 39             	cmp    $0x39,%ebx
+  800b20:	7f 5b                	jg     800b7d <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800b22:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800b27:	eb d1                	jmp    800afa <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800b29:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2f:	77 17                	ja     800b48 <vprintfmt+0x148>
+  800b31:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b35:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b38:	89 d2                	mov    %edx,%edx
+  800b3a:	48 01 d0             	add    %rdx,%rax
+  800b3d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b40:	83 c2 08             	add    $0x8,%edx
+  800b43:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b46:	eb 0c                	jmp    800b54 <vprintfmt+0x154>
+  800b48:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b4c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b50:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b54:	8b 00                	mov    (%rax),%eax
+  800b56:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800b59:	eb 23                	jmp    800b7e <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800b5b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b5f:	0f 89 43 ff ff ff    	jns    800aa8 <vprintfmt+0xa8>
+				width = 0;
+  800b65:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800b6c:	e9 37 ff ff ff       	jmp    800aa8 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800b71:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800b78:	e9 2b ff ff ff       	jmp    800aa8 <vprintfmt+0xa8>
+			goto process_precision;
+  800b7d:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800b7e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b82:	0f 89 20 ff ff ff    	jns    800aa8 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800b88:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800b8b:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800b8e:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800b95:	e9 0e ff ff ff       	jmp    800aa8 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800b9a:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800b9e:	e9 05 ff ff ff       	jmp    800aa8 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800ba3:	83 fb 39             	cmp    $0x39,%ebx
+  800ba6:	7f 0b                	jg     800bb3 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800ba8:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800bab:	c1 e0 08             	shl    $0x8,%eax
+  800bae:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800bb1:	eb 21                	jmp    800bd4 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800bb3:	83 fb 60             	cmp    $0x60,%ebx
+  800bb6:	7e 10                	jle    800bc8 <vprintfmt+0x1c8>
+  800bb8:	83 fb 66             	cmp    $0x66,%ebx
+  800bbb:	7f 0b                	jg     800bc8 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800bbd:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800bc0:	c1 e0 08             	shl    $0x8,%eax
+  800bc3:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800bc6:	eb 0c                	jmp    800bd4 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800bc8:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800bcf:	e9 04 01 00 00       	jmp    800cd8 <vprintfmt+0x2d8>
+  800bd4:	e9 ff 00 00 00       	jmp    800cd8 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800bd9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800bdc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdf:	77 17                	ja     800bf8 <vprintfmt+0x1f8>
+  800be1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800be5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800be8:	89 d2                	mov    %edx,%edx
+  800bea:	48 01 d0             	add    %rdx,%rax
+  800bed:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bf0:	83 c2 08             	add    $0x8,%edx
+  800bf3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800bf6:	eb 0c                	jmp    800c04 <vprintfmt+0x204>
+  800bf8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bfc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c00:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c04:	8b 00                	mov    (%rax),%eax
+  800c06:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c0a:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c0e:	48 89 d6             	mov    %rdx,%rsi
+  800c11:	89 c7                	mov    %eax,%edi
+  800c13:	ff d1                	call   *%rcx
+			break;
+  800c15:	e9 da 03 00 00       	jmp    800ff4 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800c1a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c20:	77 17                	ja     800c39 <vprintfmt+0x239>
+  800c22:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c26:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c29:	89 d2                	mov    %edx,%edx
+  800c2b:	48 01 d0             	add    %rdx,%rax
+  800c2e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c31:	83 c2 08             	add    $0x8,%edx
+  800c34:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c37:	eb 0c                	jmp    800c45 <vprintfmt+0x245>
+  800c39:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c3d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c41:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c45:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800c47:	85 db                	test   %ebx,%ebx
+  800c49:	79 02                	jns    800c4d <vprintfmt+0x24d>
+				err = -err;
+  800c4b:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800c4d:	83 fb 15             	cmp    $0x15,%ebx
+  800c50:	7f 19                	jg     800c6b <vprintfmt+0x26b>
+  800c52:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  800c59:	00 00 00 
+  800c5c:	48 63 c3             	movslq %ebx,%rax
+  800c5f:	4c 01 e2             	add    %r12,%rdx
+  800c62:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800c66:	4d 85 ed             	test   %r13,%r13
+  800c69:	75 36                	jne    800ca1 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800c6b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800c6f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c73:	89 d9                	mov    %ebx,%ecx
+  800c75:	48 ba a8 e2 ff ff ff 	movabs $0xffffffffffffe2a8,%rdx
+  800c7c:	ff ff ff 
+  800c7f:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800c83:	48 89 c7             	mov    %rax,%rdi
+  800c86:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8b:	49 b8 cf 8f ff ff ff 	movabs $0xffffffffffff8fcf,%r8
+  800c92:	ff ff ff 
+  800c95:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800c99:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800c9c:	e9 53 03 00 00       	jmp    800ff4 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800ca1:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800ca5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ca9:	4c 89 e9             	mov    %r13,%rcx
+  800cac:	48 ba b1 e2 ff ff ff 	movabs $0xffffffffffffe2b1,%rdx
+  800cb3:	ff ff ff 
+  800cb6:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800cba:	48 89 c7             	mov    %rax,%rdi
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc2:	49 b8 cf 8f ff ff ff 	movabs $0xffffffffffff8fcf,%r8
+  800cc9:	ff ff ff 
+  800ccc:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800cd0:	41 ff d0             	call   *%r8
+			break;
+  800cd3:	e9 1c 03 00 00       	jmp    800ff4 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800cd8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800cdb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cde:	77 17                	ja     800cf7 <vprintfmt+0x2f7>
+  800ce0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ce4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ce7:	89 d2                	mov    %edx,%edx
+  800ce9:	48 01 d0             	add    %rdx,%rax
+  800cec:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cef:	83 c2 08             	add    $0x8,%edx
+  800cf2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cf5:	eb 0c                	jmp    800d03 <vprintfmt+0x303>
+  800cf7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cfb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cff:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d03:	4c 8b 28             	mov    (%rax),%r13
+  800d06:	4d 85 ed             	test   %r13,%r13
+  800d09:	75 0e                	jne    800d19 <vprintfmt+0x319>
+				p = "(null)";
+  800d0b:	48 b8 b4 e2 ff ff ff 	movabs $0xffffffffffffe2b4,%rax
+  800d12:	ff ff ff 
+  800d15:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800d19:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d1d:	0f 8e 84 00 00 00    	jle    800da7 <vprintfmt+0x3a7>
+  800d23:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800d27:	74 7e                	je     800da7 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d29:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d2c:	48 98                	cltq
+  800d2e:	48 89 c6             	mov    %rax,%rsi
+  800d31:	4c 89 ef             	mov    %r13,%rdi
+  800d34:	4d 89 e7             	mov    %r12,%r15
+  800d37:	48 b8 f4 92 ff ff ff 	movabs $0xffffffffffff92f4,%rax
+  800d3e:	ff ff ff 
+  800d41:	4c 01 e0             	add    %r12,%rax
+  800d44:	ff d0                	call   *%rax
+  800d46:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800d49:	eb 17                	jmp    800d62 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800d4b:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800d4f:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800d53:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800d57:	48 89 d6             	mov    %rdx,%rsi
+  800d5a:	89 c7                	mov    %eax,%edi
+  800d5c:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d5e:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800d62:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d66:	7f e3                	jg     800d4b <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d68:	eb 3d                	jmp    800da7 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800d6a:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800d6e:	74 1e                	je     800d8e <vprintfmt+0x38e>
+  800d70:	83 fb 1f             	cmp    $0x1f,%ebx
+  800d73:	7e 05                	jle    800d7a <vprintfmt+0x37a>
+  800d75:	83 fb 7e             	cmp    $0x7e,%ebx
+  800d78:	7e 14                	jle    800d8e <vprintfmt+0x38e>
+					putch('?', putdat);
+  800d7a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d7e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d82:	48 89 c6             	mov    %rax,%rsi
+  800d85:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d8a:	ff d2                	call   *%rdx
+  800d8c:	eb 15                	jmp    800da3 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800d8e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800d91:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800d94:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d98:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d9c:	48 89 c6             	mov    %rax,%rsi
+  800d9f:	89 cf                	mov    %ecx,%edi
+  800da1:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800da3:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800da7:	4c 89 e8             	mov    %r13,%rax
+  800daa:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800dae:	0f b6 00             	movzbl (%rax),%eax
+  800db1:	0f be d8             	movsbl %al,%ebx
+  800db4:	85 db                	test   %ebx,%ebx
+  800db6:	74 28                	je     800de0 <vprintfmt+0x3e0>
+  800db8:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800dbc:	78 ac                	js     800d6a <vprintfmt+0x36a>
+  800dbe:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800dc2:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800dc6:	79 a2                	jns    800d6a <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800dc8:	eb 16                	jmp    800de0 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800dca:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dce:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dd2:	48 89 c6             	mov    %rax,%rsi
+  800dd5:	bf 20 00 00 00       	mov    $0x20,%edi
+  800dda:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800ddc:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800de0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800de4:	7f e4                	jg     800dca <vprintfmt+0x3ca>
+			break;
+  800de6:	e9 09 02 00 00       	jmp    800ff4 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800deb:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800def:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800df3:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800df7:	0f b6 00             	movzbl (%rax),%eax
+  800dfa:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800dfd:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800dfe:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e01:	0f 8e ac fd ff ff    	jle    800bb3 <vprintfmt+0x1b3>
+  800e07:	e9 97 fd ff ff       	jmp    800ba3 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800e0c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e10:	be 03 00 00 00       	mov    $0x3,%esi
+  800e15:	48 89 c7             	mov    %rax,%rdi
+  800e18:	48 b8 ad 88 ff ff ff 	movabs $0xffffffffffff88ad,%rax
+  800e1f:	ff ff ff 
+  800e22:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e26:	ff d0                	call   *%rax
+  800e28:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800e2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e30:	48 85 c0             	test   %rax,%rax
+  800e33:	79 1d                	jns    800e52 <vprintfmt+0x452>
+				putch('-', putdat);
+  800e35:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e39:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e3d:	48 89 c6             	mov    %rax,%rsi
+  800e40:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e45:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800e47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e4b:	48 f7 d8             	neg    %rax
+  800e4e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800e52:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800e59:	e9 de 00 00 00       	jmp    800f3c <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800e5e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e62:	be 03 00 00 00       	mov    $0x3,%esi
+  800e67:	48 89 c7             	mov    %rax,%rdi
+  800e6a:	48 b8 4c 87 ff ff ff 	movabs $0xffffffffffff874c,%rax
+  800e71:	ff ff ff 
+  800e74:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e78:	ff d0                	call   *%rax
+  800e7a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800e7e:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800e85:	e9 b2 00 00 00       	jmp    800f3c <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800e8a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e8e:	be 03 00 00 00       	mov    $0x3,%esi
+  800e93:	48 89 c7             	mov    %rax,%rdi
+  800e96:	48 b8 4c 87 ff ff ff 	movabs $0xffffffffffff874c,%rax
+  800e9d:	ff ff ff 
+  800ea0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ea4:	ff d0                	call   *%rax
+  800ea6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800eaa:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800eb1:	e9 86 00 00 00       	jmp    800f3c <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800eb6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800eba:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ebe:	48 89 c6             	mov    %rax,%rsi
+  800ec1:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ec6:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800ec8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ecc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ed0:	48 89 c6             	mov    %rax,%rsi
+  800ed3:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ed8:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800eda:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800edd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ee0:	77 17                	ja     800ef9 <vprintfmt+0x4f9>
+  800ee2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ee6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ee9:	89 d2                	mov    %edx,%edx
+  800eeb:	48 01 d0             	add    %rdx,%rax
+  800eee:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ef1:	83 c2 08             	add    $0x8,%edx
+  800ef4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ef7:	eb 0c                	jmp    800f05 <vprintfmt+0x505>
+  800ef9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800efd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f01:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f05:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800f08:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f0c:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800f13:	eb 27                	jmp    800f3c <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800f15:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f19:	be 03 00 00 00       	mov    $0x3,%esi
+  800f1e:	48 89 c7             	mov    %rax,%rdi
+  800f21:	48 b8 4c 87 ff ff ff 	movabs $0xffffffffffff874c,%rax
+  800f28:	ff ff ff 
+  800f2b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f2f:	ff d0                	call   *%rax
+  800f31:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f35:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800f3c:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800f41:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800f44:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800f47:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800f4b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f4f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f53:	45 89 c1             	mov    %r8d,%r9d
+  800f56:	41 89 f8             	mov    %edi,%r8d
+  800f59:	48 89 c7             	mov    %rax,%rdi
+  800f5c:	48 b8 74 86 ff ff ff 	movabs $0xffffffffffff8674,%rax
+  800f63:	ff ff ff 
+  800f66:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f6a:	ff d0                	call   *%rax
+			break;
+  800f6c:	e9 83 00 00 00       	jmp    800ff4 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800f71:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f75:	be 03 00 00 00       	mov    $0x3,%esi
+  800f7a:	48 89 c7             	mov    %rax,%rdi
+  800f7d:	48 b8 4c 87 ff ff ff 	movabs $0xffffffffffff874c,%rax
+  800f84:	ff ff ff 
+  800f87:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f8b:	ff d0                	call   *%rax
+  800f8d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800f91:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800f95:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800f99:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f9d:	48 89 ce             	mov    %rcx,%rsi
+  800fa0:	48 89 c7             	mov    %rax,%rdi
+  800fa3:	48 b8 67 88 ff ff ff 	movabs $0xffffffffffff8867,%rax
+  800faa:	ff ff ff 
+  800fad:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fb1:	ff d0                	call   *%rax
+	
+			break;
+  800fb3:	eb 3f                	jmp    800ff4 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800fb5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fb9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fbd:	48 89 c6             	mov    %rax,%rsi
+  800fc0:	89 df                	mov    %ebx,%edi
+  800fc2:	ff d2                	call   *%rdx
+			break;
+  800fc4:	eb 2e                	jmp    800ff4 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800fc6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fca:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fce:	48 89 c6             	mov    %rax,%rsi
+  800fd1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fd6:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800fd8:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800fdd:	eb 05                	jmp    800fe4 <vprintfmt+0x5e4>
+  800fdf:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800fe4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800fe8:	48 83 e8 01          	sub    $0x1,%rax
+  800fec:	0f b6 00             	movzbl (%rax),%eax
+  800fef:	3c 25                	cmp    $0x25,%al
+  800ff1:	75 ec                	jne    800fdf <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800ff3:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ff4:	e9 78 fa ff ff       	jmp    800a71 <vprintfmt+0x71>
+				return;
+  800ff9:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800ffa:	48 83 c4 60          	add    $0x60,%rsp
+  800ffe:	5b                   	pop    %rbx
+  800fff:	41 5c                	pop    %r12
+  801001:	41 5d                	pop    %r13
+  801003:	41 5f                	pop    %r15
+  801005:	5d                   	pop    %rbp
+  801006:	c3                   	ret
+
+0000000000801007 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801007:	55                   	push   %rbp
+  801008:	48 89 e5             	mov    %rsp,%rbp
+  80100b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801012:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801012 <printfmt+0xb>
+  801019:	49 bb 26 70 00 00 00 	movabs $0x7026,%r11
+  801020:	00 00 00 
+  801023:	4d 01 da             	add    %r11,%r10
+  801026:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80102d:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801034:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80103b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801042:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801049:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801050:	84 c0                	test   %al,%al
+  801052:	74 20                	je     801074 <printfmt+0x6d>
+  801054:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801058:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80105c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801060:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801064:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801068:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80106c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801070:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801074:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80107b:	00 00 00 
+  80107e:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801085:	00 00 00 
+  801088:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80108c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801093:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80109a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8010a1:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8010a8:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8010af:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8010b6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8010bd:	48 89 c7             	mov    %rax,%rdi
+  8010c0:	48 b8 c8 89 ff ff ff 	movabs $0xffffffffffff89c8,%rax
+  8010c7:	ff ff ff 
+  8010ca:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8010ce:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8010d0:	90                   	nop
+  8010d1:	c9                   	leave
+  8010d2:	c3                   	ret
+
+00000000008010d3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8010d3:	55                   	push   %rbp
+  8010d4:	48 89 e5             	mov    %rsp,%rbp
+  8010d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8010db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8010db <sprintputch+0x8>
+  8010e2:	49 bb 5d 6f 00 00 00 	movabs $0x6f5d,%r11
+  8010e9:	00 00 00 
+  8010ec:	4c 01 d8             	add    %r11,%rax
+  8010ef:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8010f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8010f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010fa:	8b 40 10             	mov    0x10(%rax),%eax
+  8010fd:	8d 50 01             	lea    0x1(%rax),%edx
+  801100:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801104:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801107:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80110b:	48 8b 10             	mov    (%rax),%rdx
+  80110e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801112:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801116:	48 39 c2             	cmp    %rax,%rdx
+  801119:	73 17                	jae    801132 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80111b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80111f:	48 8b 00             	mov    (%rax),%rax
+  801122:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801126:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80112a:	48 89 0a             	mov    %rcx,(%rdx)
+  80112d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801130:	88 10                	mov    %dl,(%rax)
+}
+  801132:	90                   	nop
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+0000000000801135 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801135:	55                   	push   %rbp
+  801136:	48 89 e5             	mov    %rsp,%rbp
+  801139:	53                   	push   %rbx
+  80113a:	48 83 ec 58          	sub    $0x58,%rsp
+  80113e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80113e <vsnprintf+0x9>
+  801145:	49 bb fa 6e 00 00 00 	movabs $0x6efa,%r11
+  80114c:	00 00 00 
+  80114f:	4c 01 d8             	add    %r11,%rax
+  801152:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801156:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801159:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80115d:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801161:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801165:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801169:	48 8b 0e             	mov    (%rsi),%rcx
+  80116c:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801170:	48 89 0a             	mov    %rcx,(%rdx)
+  801173:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801177:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  80117b:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80117f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801183:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801187:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80118a:	48 63 d2             	movslq %edx,%rdx
+  80118d:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801191:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801195:	48 01 ca             	add    %rcx,%rdx
+  801198:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80119c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8011a3:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8011a8:	74 06                	je     8011b0 <vsnprintf+0x7b>
+  8011aa:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8011ae:	7f 07                	jg     8011b7 <vsnprintf+0x82>
+		return -E_INVAL;
+  8011b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b5:	eb 34                	jmp    8011eb <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8011b7:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8011bb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8011bf:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8011c3:	48 bf 9b 90 ff ff ff 	movabs $0xffffffffffff909b,%rdi
+  8011ca:	ff ff ff 
+  8011cd:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8011d1:	49 b8 c8 89 ff ff ff 	movabs $0xffffffffffff89c8,%r8
+  8011d8:	ff ff ff 
+  8011db:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8011df:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8011e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011e5:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8011e8:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8011eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ef:	c9                   	leave
+  8011f0:	c3                   	ret
+
+00000000008011f1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8011f1:	55                   	push   %rbp
+  8011f2:	48 89 e5             	mov    %rsp,%rbp
+  8011f5:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8011fc:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8011fc <snprintf+0xb>
+  801203:	49 bb 3c 6e 00 00 00 	movabs $0x6e3c,%r11
+  80120a:	00 00 00 
+  80120d:	4d 01 da             	add    %r11,%r10
+  801210:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801217:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80121d:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801224:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80122b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801232:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801239:	84 c0                	test   %al,%al
+  80123b:	74 20                	je     80125d <snprintf+0x6c>
+  80123d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801241:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801245:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801249:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80124d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801251:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801255:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801259:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80125d:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801264:	00 00 00 
+  801267:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80126e:	00 00 00 
+  801271:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801275:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80127c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801283:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80128a:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801291:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801298:	48 8b 06             	mov    (%rsi),%rax
+  80129b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80129f:	48 89 01             	mov    %rax,(%rcx)
+  8012a2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8012a6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8012aa:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8012ae:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8012b5:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8012bc:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8012c2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8012c9:	48 89 c7             	mov    %rax,%rdi
+  8012cc:	48 b8 fd 90 ff ff ff 	movabs $0xffffffffffff90fd,%rax
+  8012d3:	ff ff ff 
+  8012d6:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8012da:	ff d0                	call   *%rax
+  8012dc:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8012e2:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8012e8:	c9                   	leave
+  8012e9:	c3                   	ret
+
+00000000008012ea <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8012ea:	55                   	push   %rbp
+  8012eb:	48 89 e5             	mov    %rsp,%rbp
+  8012ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8012f2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012f2 <strlen+0x8>
+  8012f9:	49 bb 46 6d 00 00 00 	movabs $0x6d46,%r11
+  801300:	00 00 00 
+  801303:	4c 01 d8             	add    %r11,%rax
+  801306:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80130a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801311:	eb 09                	jmp    80131c <strlen+0x32>
+		n++;
+  801313:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801317:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80131c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801320:	0f b6 00             	movzbl (%rax),%eax
+  801323:	84 c0                	test   %al,%al
+  801325:	75 ec                	jne    801313 <strlen+0x29>
+	return n;
+  801327:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80132a:	c9                   	leave
+  80132b:	c3                   	ret
+
+000000000080132c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80132c:	55                   	push   %rbp
+  80132d:	48 89 e5             	mov    %rsp,%rbp
+  801330:	48 83 ec 20          	sub    $0x20,%rsp
+  801334:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801334 <strnlen+0x8>
+  80133b:	49 bb 04 6d 00 00 00 	movabs $0x6d04,%r11
+  801342:	00 00 00 
+  801345:	4c 01 d8             	add    %r11,%rax
+  801348:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80134c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801350:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801357:	eb 0e                	jmp    801367 <strnlen+0x3b>
+		n++;
+  801359:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80135d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801362:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801367:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80136c:	74 0b                	je     801379 <strnlen+0x4d>
+  80136e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801372:	0f b6 00             	movzbl (%rax),%eax
+  801375:	84 c0                	test   %al,%al
+  801377:	75 e0                	jne    801359 <strnlen+0x2d>
+	return n;
+  801379:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80137c:	c9                   	leave
+  80137d:	c3                   	ret
+
+000000000080137e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80137e:	55                   	push   %rbp
+  80137f:	48 89 e5             	mov    %rsp,%rbp
+  801382:	48 83 ec 20          	sub    $0x20,%rsp
+  801386:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801386 <strcpy+0x8>
+  80138d:	49 bb b2 6c 00 00 00 	movabs $0x6cb2,%r11
+  801394:	00 00 00 
+  801397:	4c 01 d8             	add    %r11,%rax
+  80139a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80139e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8013a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8013aa:	90                   	nop
+  8013ab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013af:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013b3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013bb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013bf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013c3:	0f b6 12             	movzbl (%rdx),%edx
+  8013c6:	88 10                	mov    %dl,(%rax)
+  8013c8:	0f b6 00             	movzbl (%rax),%eax
+  8013cb:	84 c0                	test   %al,%al
+  8013cd:	75 dc                	jne    8013ab <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8013cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8013d3:	c9                   	leave
+  8013d4:	c3                   	ret
+
+00000000008013d5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8013d5:	55                   	push   %rbp
+  8013d6:	48 89 e5             	mov    %rsp,%rbp
+  8013d9:	53                   	push   %rbx
+  8013da:	48 83 ec 20          	sub    $0x20,%rsp
+  8013de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8013de <strcat+0x9>
+  8013e5:	49 bb 5a 6c 00 00 00 	movabs $0x6c5a,%r11
+  8013ec:	00 00 00 
+  8013ef:	4c 01 db             	add    %r11,%rbx
+  8013f2:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8013f6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8013fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013fe:	48 89 c7             	mov    %rax,%rdi
+  801401:	48 b8 b2 92 ff ff ff 	movabs $0xffffffffffff92b2,%rax
+  801408:	ff ff ff 
+  80140b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80140f:	ff d0                	call   *%rax
+  801411:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801414:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801417:	48 63 d0             	movslq %eax,%rdx
+  80141a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80141e:	48 01 c2             	add    %rax,%rdx
+  801421:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801425:	48 89 c6             	mov    %rax,%rsi
+  801428:	48 89 d7             	mov    %rdx,%rdi
+  80142b:	48 b8 46 93 ff ff ff 	movabs $0xffffffffffff9346,%rax
+  801432:	ff ff ff 
+  801435:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801439:	ff d0                	call   *%rax
+	return dst;
+  80143b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  80143f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801443:	c9                   	leave
+  801444:	c3                   	ret
+
+0000000000801445 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801445:	55                   	push   %rbp
+  801446:	48 89 e5             	mov    %rsp,%rbp
+  801449:	48 83 ec 28          	sub    $0x28,%rsp
+  80144d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80144d <strncpy+0x8>
+  801454:	49 bb eb 6b 00 00 00 	movabs $0x6beb,%r11
+  80145b:	00 00 00 
+  80145e:	4c 01 d8             	add    %r11,%rax
+  801461:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801465:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801469:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80146d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801471:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801475:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80147c:	00 
+  80147d:	eb 2a                	jmp    8014a9 <strncpy+0x64>
+		*dst++ = *src;
+  80147f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801483:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801487:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80148b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80148f:	0f b6 12             	movzbl (%rdx),%edx
+  801492:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801494:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801498:	0f b6 00             	movzbl (%rax),%eax
+  80149b:	84 c0                	test   %al,%al
+  80149d:	74 05                	je     8014a4 <strncpy+0x5f>
+			src++;
+  80149f:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8014a4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ad:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8014b1:	72 cc                	jb     80147f <strncpy+0x3a>
+	}
+	return ret;
+  8014b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8014b7:	c9                   	leave
+  8014b8:	c3                   	ret
+
+00000000008014b9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8014b9:	55                   	push   %rbp
+  8014ba:	48 89 e5             	mov    %rsp,%rbp
+  8014bd:	48 83 ec 28          	sub    $0x28,%rsp
+  8014c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014c1 <strlcpy+0x8>
+  8014c8:	49 bb 77 6b 00 00 00 	movabs $0x6b77,%r11
+  8014cf:	00 00 00 
+  8014d2:	4c 01 d8             	add    %r11,%rax
+  8014d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014dd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8014e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014e5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8014e9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8014ee:	74 3d                	je     80152d <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8014f0:	eb 1d                	jmp    80150f <strlcpy+0x56>
+			*dst++ = *src++;
+  8014f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014f6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014fa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801502:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801506:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80150a:	0f b6 12             	movzbl (%rdx),%edx
+  80150d:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80150f:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801514:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801519:	74 0b                	je     801526 <strlcpy+0x6d>
+  80151b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80151f:	0f b6 00             	movzbl (%rax),%eax
+  801522:	84 c0                	test   %al,%al
+  801524:	75 cc                	jne    8014f2 <strlcpy+0x39>
+		*dst = '\0';
+  801526:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80152a:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80152d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801531:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801535:	c9                   	leave
+  801536:	c3                   	ret
+
+0000000000801537 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801537:	55                   	push   %rbp
+  801538:	48 89 e5             	mov    %rsp,%rbp
+  80153b:	48 83 ec 10          	sub    $0x10,%rsp
+  80153f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80153f <strcmp+0x8>
+  801546:	49 bb f9 6a 00 00 00 	movabs $0x6af9,%r11
+  80154d:	00 00 00 
+  801550:	4c 01 d8             	add    %r11,%rax
+  801553:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801557:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  80155b:	eb 0a                	jmp    801567 <strcmp+0x30>
+		p++, q++;
+  80155d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801562:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801567:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80156b:	0f b6 00             	movzbl (%rax),%eax
+  80156e:	84 c0                	test   %al,%al
+  801570:	74 12                	je     801584 <strcmp+0x4d>
+  801572:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801576:	0f b6 10             	movzbl (%rax),%edx
+  801579:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80157d:	0f b6 00             	movzbl (%rax),%eax
+  801580:	38 c2                	cmp    %al,%dl
+  801582:	74 d9                	je     80155d <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801584:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801588:	0f b6 00             	movzbl (%rax),%eax
+  80158b:	0f b6 d0             	movzbl %al,%edx
+  80158e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801592:	0f b6 00             	movzbl (%rax),%eax
+  801595:	0f b6 c0             	movzbl %al,%eax
+  801598:	29 c2                	sub    %eax,%edx
+  80159a:	89 d0                	mov    %edx,%eax
+}
+  80159c:	c9                   	leave
+  80159d:	c3                   	ret
+
+000000000080159e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80159e:	55                   	push   %rbp
+  80159f:	48 89 e5             	mov    %rsp,%rbp
+  8015a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8015a6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015a6 <strncmp+0x8>
+  8015ad:	49 bb 92 6a 00 00 00 	movabs $0x6a92,%r11
+  8015b4:	00 00 00 
+  8015b7:	4c 01 d8             	add    %r11,%rax
+  8015ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8015c2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8015c6:	eb 0f                	jmp    8015d7 <strncmp+0x39>
+		n--, p++, q++;
+  8015c8:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8015cd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015d2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8015d7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8015dc:	74 1d                	je     8015fb <strncmp+0x5d>
+  8015de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e2:	0f b6 00             	movzbl (%rax),%eax
+  8015e5:	84 c0                	test   %al,%al
+  8015e7:	74 12                	je     8015fb <strncmp+0x5d>
+  8015e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ed:	0f b6 10             	movzbl (%rax),%edx
+  8015f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015f4:	0f b6 00             	movzbl (%rax),%eax
+  8015f7:	38 c2                	cmp    %al,%dl
+  8015f9:	74 cd                	je     8015c8 <strncmp+0x2a>
+	if (n == 0)
+  8015fb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801600:	75 07                	jne    801609 <strncmp+0x6b>
+		return 0;
+  801602:	ba 00 00 00 00       	mov    $0x0,%edx
+  801607:	eb 16                	jmp    80161f <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801609:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80160d:	0f b6 00             	movzbl (%rax),%eax
+  801610:	0f b6 d0             	movzbl %al,%edx
+  801613:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801617:	0f b6 00             	movzbl (%rax),%eax
+  80161a:	0f b6 c0             	movzbl %al,%eax
+  80161d:	29 c2                	sub    %eax,%edx
+}
+  80161f:	89 d0                	mov    %edx,%eax
+  801621:	c9                   	leave
+  801622:	c3                   	ret
+
+0000000000801623 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801623:	55                   	push   %rbp
+  801624:	48 89 e5             	mov    %rsp,%rbp
+  801627:	48 83 ec 10          	sub    $0x10,%rsp
+  80162b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80162b <strchr+0x8>
+  801632:	49 bb 0d 6a 00 00 00 	movabs $0x6a0d,%r11
+  801639:	00 00 00 
+  80163c:	4c 01 d8             	add    %r11,%rax
+  80163f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801643:	89 f0                	mov    %esi,%eax
+  801645:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801648:	eb 17                	jmp    801661 <strchr+0x3e>
+		if (*s == c)
+  80164a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80164e:	0f b6 00             	movzbl (%rax),%eax
+  801651:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801654:	75 06                	jne    80165c <strchr+0x39>
+			return (char *) s;
+  801656:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80165a:	eb 15                	jmp    801671 <strchr+0x4e>
+	for (; *s; s++)
+  80165c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801661:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801665:	0f b6 00             	movzbl (%rax),%eax
+  801668:	84 c0                	test   %al,%al
+  80166a:	75 de                	jne    80164a <strchr+0x27>
+	return 0;
+  80166c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801671:	c9                   	leave
+  801672:	c3                   	ret
+
+0000000000801673 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801673:	55                   	push   %rbp
+  801674:	48 89 e5             	mov    %rsp,%rbp
+  801677:	48 83 ec 10          	sub    $0x10,%rsp
+  80167b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80167b <strfind+0x8>
+  801682:	49 bb bd 69 00 00 00 	movabs $0x69bd,%r11
+  801689:	00 00 00 
+  80168c:	4c 01 d8             	add    %r11,%rax
+  80168f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801693:	89 f0                	mov    %esi,%eax
+  801695:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801698:	eb 11                	jmp    8016ab <strfind+0x38>
+		if (*s == c)
+  80169a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80169e:	0f b6 00             	movzbl (%rax),%eax
+  8016a1:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016a4:	74 12                	je     8016b8 <strfind+0x45>
+	for (; *s; s++)
+  8016a6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016af:	0f b6 00             	movzbl (%rax),%eax
+  8016b2:	84 c0                	test   %al,%al
+  8016b4:	75 e4                	jne    80169a <strfind+0x27>
+  8016b6:	eb 01                	jmp    8016b9 <strfind+0x46>
+			break;
+  8016b8:	90                   	nop
+	return (char *) s;
+  8016b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016bd:	c9                   	leave
+  8016be:	c3                   	ret
+
+00000000008016bf <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8016bf:	55                   	push   %rbp
+  8016c0:	48 89 e5             	mov    %rsp,%rbp
+  8016c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8016c7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016c7 <memset+0x8>
+  8016ce:	49 bb 71 69 00 00 00 	movabs $0x6971,%r11
+  8016d5:	00 00 00 
+  8016d8:	4c 01 d8             	add    %r11,%rax
+  8016db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016df:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8016e2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8016e6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016eb:	75 06                	jne    8016f3 <memset+0x34>
+		return v;
+  8016ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f1:	eb 69                	jmp    80175c <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8016f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f7:	83 e0 03             	and    $0x3,%eax
+  8016fa:	48 85 c0             	test   %rax,%rax
+  8016fd:	75 48                	jne    801747 <memset+0x88>
+  8016ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801703:	83 e0 03             	and    $0x3,%eax
+  801706:	48 85 c0             	test   %rax,%rax
+  801709:	75 3c                	jne    801747 <memset+0x88>
+		c &= 0xFF;
+  80170b:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801712:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801715:	c1 e0 18             	shl    $0x18,%eax
+  801718:	89 c2                	mov    %eax,%edx
+  80171a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80171d:	c1 e0 10             	shl    $0x10,%eax
+  801720:	09 c2                	or     %eax,%edx
+  801722:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801725:	c1 e0 08             	shl    $0x8,%eax
+  801728:	09 d0                	or     %edx,%eax
+  80172a:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  80172d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801731:	48 c1 e8 02          	shr    $0x2,%rax
+  801735:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801738:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80173c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80173f:	48 89 d7             	mov    %rdx,%rdi
+  801742:	fc                   	cld
+  801743:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801745:	eb 11                	jmp    801758 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801747:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80174b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80174e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801752:	48 89 d7             	mov    %rdx,%rdi
+  801755:	fc                   	cld
+  801756:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+
+000000000080175e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80175e:	55                   	push   %rbp
+  80175f:	48 89 e5             	mov    %rsp,%rbp
+  801762:	48 83 ec 28          	sub    $0x28,%rsp
+  801766:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801766 <memmove+0x8>
+  80176d:	49 bb d2 68 00 00 00 	movabs $0x68d2,%r11
+  801774:	00 00 00 
+  801777:	4c 01 d8             	add    %r11,%rax
+  80177a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80177e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801782:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801786:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80178a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  80178e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801792:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801796:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80179e:	0f 83 88 00 00 00    	jae    80182c <memmove+0xce>
+  8017a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ac:	48 01 d0             	add    %rdx,%rax
+  8017af:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8017b3:	73 77                	jae    80182c <memmove+0xce>
+		s += n;
+  8017b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017b9:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8017bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017c1:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8017c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c9:	83 e0 03             	and    $0x3,%eax
+  8017cc:	48 85 c0             	test   %rax,%rax
+  8017cf:	75 3b                	jne    80180c <memmove+0xae>
+  8017d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d5:	83 e0 03             	and    $0x3,%eax
+  8017d8:	48 85 c0             	test   %rax,%rax
+  8017db:	75 2f                	jne    80180c <memmove+0xae>
+  8017dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017e1:	83 e0 03             	and    $0x3,%eax
+  8017e4:	48 85 c0             	test   %rax,%rax
+  8017e7:	75 23                	jne    80180c <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8017e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ed:	48 83 e8 04          	sub    $0x4,%rax
+  8017f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017f5:	48 83 ea 04          	sub    $0x4,%rdx
+  8017f9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8017fd:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801801:	48 89 c7             	mov    %rax,%rdi
+  801804:	48 89 d6             	mov    %rdx,%rsi
+  801807:	fd                   	std
+  801808:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80180a:	eb 1d                	jmp    801829 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80180c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801810:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801814:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801818:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  80181c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801820:	48 89 d7             	mov    %rdx,%rdi
+  801823:	48 89 c1             	mov    %rax,%rcx
+  801826:	fd                   	std
+  801827:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801829:	fc                   	cld
+  80182a:	eb 57                	jmp    801883 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80182c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801830:	83 e0 03             	and    $0x3,%eax
+  801833:	48 85 c0             	test   %rax,%rax
+  801836:	75 36                	jne    80186e <memmove+0x110>
+  801838:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80183c:	83 e0 03             	and    $0x3,%eax
+  80183f:	48 85 c0             	test   %rax,%rax
+  801842:	75 2a                	jne    80186e <memmove+0x110>
+  801844:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801848:	83 e0 03             	and    $0x3,%eax
+  80184b:	48 85 c0             	test   %rax,%rax
+  80184e:	75 1e                	jne    80186e <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801850:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801854:	48 c1 e8 02          	shr    $0x2,%rax
+  801858:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  80185b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80185f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801863:	48 89 c7             	mov    %rax,%rdi
+  801866:	48 89 d6             	mov    %rdx,%rsi
+  801869:	fc                   	cld
+  80186a:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80186c:	eb 15                	jmp    801883 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  80186e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801872:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801876:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80187a:	48 89 c7             	mov    %rax,%rdi
+  80187d:	48 89 d6             	mov    %rdx,%rsi
+  801880:	fc                   	cld
+  801881:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801883:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801887:	c9                   	leave
+  801888:	c3                   	ret
+
+0000000000801889 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801889:	55                   	push   %rbp
+  80188a:	48 89 e5             	mov    %rsp,%rbp
+  80188d:	48 83 ec 18          	sub    $0x18,%rsp
+  801891:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801891 <memcpy+0x8>
+  801898:	49 bb a7 67 00 00 00 	movabs $0x67a7,%r11
+  80189f:	00 00 00 
+  8018a2:	4c 01 d8             	add    %r11,%rax
+  8018a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018a9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018ad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8018b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018b5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8018b9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8018bd:	48 89 cf             	mov    %rcx,%rdi
+  8018c0:	48 b9 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rcx
+  8018c7:	ff ff ff 
+  8018ca:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8018ce:	ff d0                	call   *%rax
+}
+  8018d0:	c9                   	leave
+  8018d1:	c3                   	ret
+
+00000000008018d2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8018d2:	55                   	push   %rbp
+  8018d3:	48 89 e5             	mov    %rsp,%rbp
+  8018d6:	48 83 ec 28          	sub    $0x28,%rsp
+  8018da:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018da <memcmp+0x8>
+  8018e1:	49 bb 5e 67 00 00 00 	movabs $0x675e,%r11
+  8018e8:	00 00 00 
+  8018eb:	4c 01 d8             	add    %r11,%rax
+  8018ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018f2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018f6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  8018fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801902:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801906:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80190a:	eb 34                	jmp    801940 <memcmp+0x6e>
+		if (*s1 != *s2)
+  80190c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801910:	0f b6 10             	movzbl (%rax),%edx
+  801913:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801917:	0f b6 00             	movzbl (%rax),%eax
+  80191a:	38 c2                	cmp    %al,%dl
+  80191c:	74 18                	je     801936 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  80191e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801922:	0f b6 00             	movzbl (%rax),%eax
+  801925:	0f b6 d0             	movzbl %al,%edx
+  801928:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80192c:	0f b6 00             	movzbl (%rax),%eax
+  80192f:	0f b6 c0             	movzbl %al,%eax
+  801932:	29 c2                	sub    %eax,%edx
+  801934:	eb 20                	jmp    801956 <memcmp+0x84>
+		s1++, s2++;
+  801936:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80193b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801940:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801944:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801948:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80194c:	48 85 c0             	test   %rax,%rax
+  80194f:	75 bb                	jne    80190c <memcmp+0x3a>
+	}
+
+	return 0;
+  801951:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801956:	89 d0                	mov    %edx,%eax
+  801958:	c9                   	leave
+  801959:	c3                   	ret
+
+000000000080195a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80195a:	55                   	push   %rbp
+  80195b:	48 89 e5             	mov    %rsp,%rbp
+  80195e:	48 83 ec 28          	sub    $0x28,%rsp
+  801962:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801962 <memfind+0x8>
+  801969:	49 bb d6 66 00 00 00 	movabs $0x66d6,%r11
+  801970:	00 00 00 
+  801973:	4c 01 d8             	add    %r11,%rax
+  801976:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80197a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80197d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801981:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801985:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801989:	48 01 d0             	add    %rdx,%rax
+  80198c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801990:	eb 13                	jmp    8019a5 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801992:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801996:	0f b6 00             	movzbl (%rax),%eax
+  801999:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80199c:	38 d0                	cmp    %dl,%al
+  80199e:	74 11                	je     8019b1 <memfind+0x57>
+	for (; s < ends; s++)
+  8019a0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8019a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019a9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8019ad:	72 e3                	jb     801992 <memfind+0x38>
+  8019af:	eb 01                	jmp    8019b2 <memfind+0x58>
+			break;
+  8019b1:	90                   	nop
+	return (void *) s;
+  8019b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019b6:	c9                   	leave
+  8019b7:	c3                   	ret
+
+00000000008019b8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8019b8:	55                   	push   %rbp
+  8019b9:	48 89 e5             	mov    %rsp,%rbp
+  8019bc:	48 83 ec 38          	sub    $0x38,%rsp
+  8019c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019c0 <strtol+0x8>
+  8019c7:	49 bb 78 66 00 00 00 	movabs $0x6678,%r11
+  8019ce:	00 00 00 
+  8019d1:	4c 01 d8             	add    %r11,%rax
+  8019d4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019d8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8019dc:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8019df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8019e6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8019ed:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8019ee:	eb 05                	jmp    8019f5 <strtol+0x3d>
+		s++;
+  8019f0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8019f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f9:	0f b6 00             	movzbl (%rax),%eax
+  8019fc:	3c 20                	cmp    $0x20,%al
+  8019fe:	74 f0                	je     8019f0 <strtol+0x38>
+  801a00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a04:	0f b6 00             	movzbl (%rax),%eax
+  801a07:	3c 09                	cmp    $0x9,%al
+  801a09:	74 e5                	je     8019f0 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801a0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a0f:	0f b6 00             	movzbl (%rax),%eax
+  801a12:	3c 2b                	cmp    $0x2b,%al
+  801a14:	75 07                	jne    801a1d <strtol+0x65>
+		s++;
+  801a16:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a1b:	eb 17                	jmp    801a34 <strtol+0x7c>
+	else if (*s == '-')
+  801a1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a21:	0f b6 00             	movzbl (%rax),%eax
+  801a24:	3c 2d                	cmp    $0x2d,%al
+  801a26:	75 0c                	jne    801a34 <strtol+0x7c>
+		s++, neg = 1;
+  801a28:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a2d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801a34:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a38:	74 06                	je     801a40 <strtol+0x88>
+  801a3a:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801a3e:	75 28                	jne    801a68 <strtol+0xb0>
+  801a40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a44:	0f b6 00             	movzbl (%rax),%eax
+  801a47:	3c 30                	cmp    $0x30,%al
+  801a49:	75 1d                	jne    801a68 <strtol+0xb0>
+  801a4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a4f:	48 83 c0 01          	add    $0x1,%rax
+  801a53:	0f b6 00             	movzbl (%rax),%eax
+  801a56:	3c 78                	cmp    $0x78,%al
+  801a58:	75 0e                	jne    801a68 <strtol+0xb0>
+		s += 2, base = 16;
+  801a5a:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801a5f:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801a66:	eb 2c                	jmp    801a94 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801a68:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a6c:	75 19                	jne    801a87 <strtol+0xcf>
+  801a6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a72:	0f b6 00             	movzbl (%rax),%eax
+  801a75:	3c 30                	cmp    $0x30,%al
+  801a77:	75 0e                	jne    801a87 <strtol+0xcf>
+		s++, base = 8;
+  801a79:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a7e:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801a85:	eb 0d                	jmp    801a94 <strtol+0xdc>
+	else if (base == 0)
+  801a87:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a8b:	75 07                	jne    801a94 <strtol+0xdc>
+		base = 10;
+  801a8d:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801a94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a98:	0f b6 00             	movzbl (%rax),%eax
+  801a9b:	3c 2f                	cmp    $0x2f,%al
+  801a9d:	7e 1d                	jle    801abc <strtol+0x104>
+  801a9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa3:	0f b6 00             	movzbl (%rax),%eax
+  801aa6:	3c 39                	cmp    $0x39,%al
+  801aa8:	7f 12                	jg     801abc <strtol+0x104>
+			dig = *s - '0';
+  801aaa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aae:	0f b6 00             	movzbl (%rax),%eax
+  801ab1:	0f be c0             	movsbl %al,%eax
+  801ab4:	83 e8 30             	sub    $0x30,%eax
+  801ab7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801aba:	eb 4e                	jmp    801b0a <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801abc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ac0:	0f b6 00             	movzbl (%rax),%eax
+  801ac3:	3c 60                	cmp    $0x60,%al
+  801ac5:	7e 1d                	jle    801ae4 <strtol+0x12c>
+  801ac7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801acb:	0f b6 00             	movzbl (%rax),%eax
+  801ace:	3c 7a                	cmp    $0x7a,%al
+  801ad0:	7f 12                	jg     801ae4 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801ad2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad6:	0f b6 00             	movzbl (%rax),%eax
+  801ad9:	0f be c0             	movsbl %al,%eax
+  801adc:	83 e8 57             	sub    $0x57,%eax
+  801adf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ae2:	eb 26                	jmp    801b0a <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801ae4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae8:	0f b6 00             	movzbl (%rax),%eax
+  801aeb:	3c 40                	cmp    $0x40,%al
+  801aed:	7e 47                	jle    801b36 <strtol+0x17e>
+  801aef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801af3:	0f b6 00             	movzbl (%rax),%eax
+  801af6:	3c 5a                	cmp    $0x5a,%al
+  801af8:	7f 3c                	jg     801b36 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801afa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801afe:	0f b6 00             	movzbl (%rax),%eax
+  801b01:	0f be c0             	movsbl %al,%eax
+  801b04:	83 e8 37             	sub    $0x37,%eax
+  801b07:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801b0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b0d:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801b10:	7d 23                	jge    801b35 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801b12:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b17:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801b1a:	48 98                	cltq
+  801b1c:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801b21:	48 89 c2             	mov    %rax,%rdx
+  801b24:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b27:	48 98                	cltq
+  801b29:	48 01 d0             	add    %rdx,%rax
+  801b2c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801b30:	e9 5f ff ff ff       	jmp    801a94 <strtol+0xdc>
+			break;
+  801b35:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801b36:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801b3b:	74 0b                	je     801b48 <strtol+0x190>
+		*endptr = (char *) s;
+  801b3d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b41:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b45:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801b48:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b4c:	74 09                	je     801b57 <strtol+0x19f>
+  801b4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b52:	48 f7 d8             	neg    %rax
+  801b55:	eb 04                	jmp    801b5b <strtol+0x1a3>
+  801b57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801b5b:	c9                   	leave
+  801b5c:	c3                   	ret
+
+0000000000801b5d <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801b5d:	55                   	push   %rbp
+  801b5e:	48 89 e5             	mov    %rsp,%rbp
+  801b61:	53                   	push   %rbx
+  801b62:	48 83 ec 30          	sub    $0x30,%rsp
+  801b66:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801b66 <strstr+0x9>
+  801b6d:	49 bb d2 64 00 00 00 	movabs $0x64d2,%r11
+  801b74:	00 00 00 
+  801b77:	4c 01 db             	add    %r11,%rbx
+  801b7a:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801b7e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801b82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b86:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b8a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b8e:	0f b6 00             	movzbl (%rax),%eax
+  801b91:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801b94:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801b98:	75 06                	jne    801ba0 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801b9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b9e:	eb 73                	jmp    801c13 <strstr+0xb6>
+
+	len = strlen(str);
+  801ba0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ba4:	48 89 c7             	mov    %rax,%rdi
+  801ba7:	48 b8 b2 92 ff ff ff 	movabs $0xffffffffffff92b2,%rax
+  801bae:	ff ff ff 
+  801bb1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801bb5:	ff d0                	call   *%rax
+  801bb7:	48 98                	cltq
+  801bb9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801bbd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bc5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801bc9:	0f b6 00             	movzbl (%rax),%eax
+  801bcc:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801bcf:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801bd3:	75 07                	jne    801bdc <strstr+0x7f>
+				return (char *) 0;
+  801bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bda:	eb 37                	jmp    801c13 <strstr+0xb6>
+		} while (sc != c);
+  801bdc:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801be0:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801be3:	75 d8                	jne    801bbd <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801be5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801be9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801bed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bf1:	48 89 ce             	mov    %rcx,%rsi
+  801bf4:	48 89 c7             	mov    %rax,%rdi
+  801bf7:	48 b8 66 95 ff ff ff 	movabs $0xffffffffffff9566,%rax
+  801bfe:	ff ff ff 
+  801c01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c05:	ff d0                	call   *%rax
+  801c07:	85 c0                	test   %eax,%eax
+  801c09:	75 b2                	jne    801bbd <strstr+0x60>
+
+	return (char *) (in - 1);
+  801c0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c0f:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801c13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c17:	c9                   	leave
+  801c18:	c3                   	ret
+
+0000000000801c19 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801c19:	55                   	push   %rbp
+  801c1a:	48 89 e5             	mov    %rsp,%rbp
+  801c1d:	41 57                	push   %r15
+  801c1f:	53                   	push   %rbx
+  801c20:	48 83 ec 40          	sub    $0x40,%rsp
+  801c24:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801c24 <syscall+0xb>
+  801c2b:	49 bb 14 64 00 00 00 	movabs $0x6414,%r11
+  801c32:	00 00 00 
+  801c35:	4d 01 da             	add    %r11,%r10
+  801c38:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801c3b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801c3e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801c42:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c46:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801c4a:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801c4e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801c51:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801c55:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c59:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801c5d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801c61:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801c65:	4c 89 c3             	mov    %r8,%rbx
+  801c68:	cd 30                	int    $0x30
+  801c6a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801c6e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801c72:	74 52                	je     801cc6 <syscall+0xad>
+  801c74:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c79:	7e 4b                	jle    801cc6 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c7b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c7f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801c82:	49 89 d0             	mov    %rdx,%r8
+  801c85:	89 c1                	mov    %eax,%ecx
+  801c87:	48 b8 70 e5 ff ff ff 	movabs $0xffffffffffffe570,%rax
+  801c8e:	ff ff ff 
+  801c91:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801c95:	48 89 c2             	mov    %rax,%rdx
+  801c98:	be 23 00 00 00       	mov    $0x23,%esi
+  801c9d:	48 b8 8d e5 ff ff ff 	movabs $0xffffffffffffe58d,%rax
+  801ca4:	ff ff ff 
+  801ca7:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801cab:	48 89 c7             	mov    %rax,%rdi
+  801cae:	4d 89 d7             	mov    %r10,%r15
+  801cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb6:	49 b9 ad 82 ff ff ff 	movabs $0xffffffffffff82ad,%r9
+  801cbd:	ff ff ff 
+  801cc0:	4d 01 d1             	add    %r10,%r9
+  801cc3:	41 ff d1             	call   *%r9
+
+	return ret;
+  801cc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801cca:	48 83 c4 40          	add    $0x40,%rsp
+  801cce:	5b                   	pop    %rbx
+  801ccf:	41 5f                	pop    %r15
+  801cd1:	5d                   	pop    %rbp
+  801cd2:	c3                   	ret
+
+0000000000801cd3 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801cd3:	55                   	push   %rbp
+  801cd4:	48 89 e5             	mov    %rsp,%rbp
+  801cd7:	41 57                	push   %r15
+  801cd9:	41 56                	push   %r14
+  801cdb:	41 55                	push   %r13
+  801cdd:	41 54                	push   %r12
+  801cdf:	53                   	push   %rbx
+  801ce0:	48 83 ec 48          	sub    $0x48,%rsp
+  801ce4:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801ce4 <syscall_words+0x11>
+  801ceb:	49 bb 54 63 00 00 00 	movabs $0x6354,%r11
+  801cf2:	00 00 00 
+  801cf5:	4d 01 de             	add    %r11,%r14
+  801cf8:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801cfb:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801cfe:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801d02:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801d06:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801d0a:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801d0e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d13:	74 09                	je     801d1e <syscall_words+0x4b>
+  801d15:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d19:	48 8b 00             	mov    (%rax),%rax
+  801d1c:	eb 05                	jmp    801d23 <syscall_words+0x50>
+  801d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d23:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801d26:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d2b:	74 0a                	je     801d37 <syscall_words+0x64>
+  801d2d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d31:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d35:	eb 05                	jmp    801d3c <syscall_words+0x69>
+  801d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3c:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801d3f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d44:	74 0a                	je     801d50 <syscall_words+0x7d>
+  801d46:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d4a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d4e:	eb 05                	jmp    801d55 <syscall_words+0x82>
+  801d50:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d55:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801d58:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d5d:	74 0a                	je     801d69 <syscall_words+0x96>
+  801d5f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d63:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d67:	eb 05                	jmp    801d6e <syscall_words+0x9b>
+  801d69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6e:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801d71:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d76:	74 0a                	je     801d82 <syscall_words+0xaf>
+  801d78:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d7c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d80:	eb 05                	jmp    801d87 <syscall_words+0xb4>
+  801d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d87:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801d8a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d8f:	74 0a                	je     801d9b <syscall_words+0xc8>
+  801d91:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d95:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801d99:	eb 05                	jmp    801da0 <syscall_words+0xcd>
+  801d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da0:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801da3:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801da6:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801daa:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801dae:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801db2:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801db6:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801dba:	cd 30                	int    $0x30
+  801dbc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801dc0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dc5:	74 50                	je     801e17 <syscall_words+0x144>
+		words[0] = r8;
+  801dc7:	4c 89 c2             	mov    %r8,%rdx
+  801dca:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dce:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801dd1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dd5:	48 83 c0 08          	add    $0x8,%rax
+  801dd9:	4c 89 ca             	mov    %r9,%rdx
+  801ddc:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801ddf:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801de3:	48 83 c0 10          	add    $0x10,%rax
+  801de7:	4c 89 d2             	mov    %r10,%rdx
+  801dea:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801ded:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801df1:	48 83 c0 18          	add    $0x18,%rax
+  801df5:	4c 89 da             	mov    %r11,%rdx
+  801df8:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801dfb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dff:	48 83 c0 20          	add    $0x20,%rax
+  801e03:	4c 89 e2             	mov    %r12,%rdx
+  801e06:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801e09:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e0d:	48 83 c0 28          	add    $0x28,%rax
+  801e11:	4c 89 ea             	mov    %r13,%rdx
+  801e14:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801e17:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801e1b:	74 52                	je     801e6f <syscall_words+0x19c>
+  801e1d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e22:	7e 4b                	jle    801e6f <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e24:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e28:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801e2b:	49 89 d0             	mov    %rdx,%r8
+  801e2e:	89 c1                	mov    %eax,%ecx
+  801e30:	48 b8 70 e5 ff ff ff 	movabs $0xffffffffffffe570,%rax
+  801e37:	ff ff ff 
+  801e3a:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801e3e:	48 89 c2             	mov    %rax,%rdx
+  801e41:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801e46:	48 b8 8d e5 ff ff ff 	movabs $0xffffffffffffe58d,%rax
+  801e4d:	ff ff ff 
+  801e50:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801e54:	48 89 c7             	mov    %rax,%rdi
+  801e57:	4d 89 f7             	mov    %r14,%r15
+  801e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5f:	49 b9 ad 82 ff ff ff 	movabs $0xffffffffffff82ad,%r9
+  801e66:	ff ff ff 
+  801e69:	4d 01 f1             	add    %r14,%r9
+  801e6c:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801e73:	48 83 c4 48          	add    $0x48,%rsp
+  801e77:	5b                   	pop    %rbx
+  801e78:	41 5c                	pop    %r12
+  801e7a:	41 5d                	pop    %r13
+  801e7c:	41 5e                	pop    %r14
+  801e7e:	41 5f                	pop    %r15
+  801e80:	5d                   	pop    %rbp
+  801e81:	c3                   	ret
+
+0000000000801e82 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801e82:	55                   	push   %rbp
+  801e83:	48 89 e5             	mov    %rsp,%rbp
+  801e86:	48 83 ec 10          	sub    $0x10,%rsp
+  801e8a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e8a <sys_cputs+0x8>
+  801e91:	49 bb ae 61 00 00 00 	movabs $0x61ae,%r11
+  801e98:	00 00 00 
+  801e9b:	4c 01 d8             	add    %r11,%rax
+  801e9e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ea2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801ea6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801eaa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801eae:	48 83 ec 08          	sub    $0x8,%rsp
+  801eb2:	6a 00                	push   $0x0
+  801eb4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801eba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ec0:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eca:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  801ed1:	ff ff ff 
+  801ed4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ed8:	ff d0                	call   *%rax
+  801eda:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ede:	90                   	nop
+  801edf:	c9                   	leave
+  801ee0:	c3                   	ret
+
+0000000000801ee1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801ee1:	55                   	push   %rbp
+  801ee2:	48 89 e5             	mov    %rsp,%rbp
+  801ee5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ee5 <sys_cgetc+0x4>
+  801eec:	49 bb 53 61 00 00 00 	movabs $0x6153,%r11
+  801ef3:	00 00 00 
+  801ef6:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ef9:	48 83 ec 08          	sub    $0x8,%rsp
+  801efd:	6a 00                	push   $0x0
+  801eff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f15:	be 00 00 00 00       	mov    $0x0,%esi
+  801f1a:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f1f:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  801f26:	ff ff ff 
+  801f29:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f2d:	ff d0                	call   *%rax
+  801f2f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f33:	c9                   	leave
+  801f34:	c3                   	ret
+
+0000000000801f35 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801f35:	55                   	push   %rbp
+  801f36:	48 89 e5             	mov    %rsp,%rbp
+  801f39:	48 83 ec 10          	sub    $0x10,%rsp
+  801f3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f3d <sys_env_destroy+0x8>
+  801f44:	49 bb fb 60 00 00 00 	movabs $0x60fb,%r11
+  801f4b:	00 00 00 
+  801f4e:	4c 01 d8             	add    %r11,%rax
+  801f51:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801f54:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f57:	48 63 d2             	movslq %edx,%rdx
+  801f5a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f5e:	6a 00                	push   $0x0
+  801f60:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f66:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f71:	be 01 00 00 00       	mov    $0x1,%esi
+  801f76:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f7b:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  801f82:	ff ff ff 
+  801f85:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f89:	ff d0                	call   *%rax
+  801f8b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f8f:	c9                   	leave
+  801f90:	c3                   	ret
+
+0000000000801f91 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801f91:	55                   	push   %rbp
+  801f92:	48 89 e5             	mov    %rsp,%rbp
+  801f95:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f95 <sys_getenvid+0x4>
+  801f9c:	49 bb a3 60 00 00 00 	movabs $0x60a3,%r11
+  801fa3:	00 00 00 
+  801fa6:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801fa9:	48 83 ec 08          	sub    $0x8,%rsp
+  801fad:	6a 00                	push   $0x0
+  801faf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fb5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fca:	bf 02 00 00 00       	mov    $0x2,%edi
+  801fcf:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  801fd6:	ff ff ff 
+  801fd9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fdd:	ff d0                	call   *%rax
+  801fdf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fe3:	c9                   	leave
+  801fe4:	c3                   	ret
+
+0000000000801fe5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801fe5:	55                   	push   %rbp
+  801fe6:	48 89 e5             	mov    %rsp,%rbp
+  801fe9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fe9 <sys_yield+0x4>
+  801ff0:	49 bb 4f 60 00 00 00 	movabs $0x604f,%r11
+  801ff7:	00 00 00 
+  801ffa:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801ffd:	48 83 ec 08          	sub    $0x8,%rsp
+  802001:	6a 00                	push   $0x0
+  802003:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802009:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80200f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802014:	ba 00 00 00 00       	mov    $0x0,%edx
+  802019:	be 00 00 00 00       	mov    $0x0,%esi
+  80201e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802023:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  80202a:	ff ff ff 
+  80202d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802031:	ff d0                	call   *%rax
+  802033:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802037:	90                   	nop
+  802038:	c9                   	leave
+  802039:	c3                   	ret
+
+000000000080203a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80203a:	55                   	push   %rbp
+  80203b:	48 89 e5             	mov    %rsp,%rbp
+  80203e:	48 83 ec 10          	sub    $0x10,%rsp
+  802042:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802042 <sys_page_alloc+0x8>
+  802049:	49 bb f6 5f 00 00 00 	movabs $0x5ff6,%r11
+  802050:	00 00 00 
+  802053:	4c 01 d8             	add    %r11,%rax
+  802056:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802059:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80205d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802060:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802063:	48 63 f2             	movslq %edx,%rsi
+  802066:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80206a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80206d:	48 63 d2             	movslq %edx,%rdx
+  802070:	48 83 ec 08          	sub    $0x8,%rsp
+  802074:	6a 00                	push   $0x0
+  802076:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80207c:	49 89 f0             	mov    %rsi,%r8
+  80207f:	be 01 00 00 00       	mov    $0x1,%esi
+  802084:	bf 04 00 00 00       	mov    $0x4,%edi
+  802089:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802090:	ff ff ff 
+  802093:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802097:	ff d0                	call   *%rax
+  802099:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80209d:	c9                   	leave
+  80209e:	c3                   	ret
+
+000000000080209f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80209f:	55                   	push   %rbp
+  8020a0:	48 89 e5             	mov    %rsp,%rbp
+  8020a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8020a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020a7 <sys_page_map+0x8>
+  8020ae:	49 bb 91 5f 00 00 00 	movabs $0x5f91,%r11
+  8020b5:	00 00 00 
+  8020b8:	4c 01 d8             	add    %r11,%rax
+  8020bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020c2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8020c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020c9:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8020cd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8020d0:	48 63 f2             	movslq %edx,%rsi
+  8020d3:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8020d7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020da:	48 63 fa             	movslq %edx,%rdi
+  8020dd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020e1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020e4:	48 63 d2             	movslq %edx,%rdx
+  8020e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8020eb:	56                   	push   %rsi
+  8020ec:	4d 89 c1             	mov    %r8,%r9
+  8020ef:	49 89 f8             	mov    %rdi,%r8
+  8020f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8020f7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8020fc:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802103:	ff ff ff 
+  802106:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80210a:	ff d0                	call   *%rax
+  80210c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802110:	c9                   	leave
+  802111:	c3                   	ret
+
+0000000000802112 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	48 83 ec 10          	sub    $0x10,%rsp
+  80211a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80211a <sys_page_unmap+0x8>
+  802121:	49 bb 1e 5f 00 00 00 	movabs $0x5f1e,%r11
+  802128:	00 00 00 
+  80212b:	4c 01 d8             	add    %r11,%rax
+  80212e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802131:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802135:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802139:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80213c:	48 63 d2             	movslq %edx,%rdx
+  80213f:	48 83 ec 08          	sub    $0x8,%rsp
+  802143:	6a 00                	push   $0x0
+  802145:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80214b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802151:	be 01 00 00 00       	mov    $0x1,%esi
+  802156:	bf 06 00 00 00       	mov    $0x6,%edi
+  80215b:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802162:	ff ff ff 
+  802165:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802169:	ff d0                	call   *%rax
+  80216b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80216f:	c9                   	leave
+  802170:	c3                   	ret
+
+0000000000802171 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802171:	55                   	push   %rbp
+  802172:	48 89 e5             	mov    %rsp,%rbp
+  802175:	48 83 ec 10          	sub    $0x10,%rsp
+  802179:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802179 <sys_env_set_status+0x8>
+  802180:	49 bb bf 5e 00 00 00 	movabs $0x5ebf,%r11
+  802187:	00 00 00 
+  80218a:	4c 01 d8             	add    %r11,%rax
+  80218d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802190:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802193:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802196:	48 63 ca             	movslq %edx,%rcx
+  802199:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80219c:	48 63 d2             	movslq %edx,%rdx
+  80219f:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a3:	6a 00                	push   $0x0
+  8021a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8021b6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021bb:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  8021c2:	ff ff ff 
+  8021c5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021c9:	ff d0                	call   *%rax
+  8021cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021cf:	c9                   	leave
+  8021d0:	c3                   	ret
+
+00000000008021d1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8021d1:	55                   	push   %rbp
+  8021d2:	48 89 e5             	mov    %rsp,%rbp
+  8021d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021d9 <sys_env_set_trapframe+0x8>
+  8021e0:	49 bb 5f 5e 00 00 00 	movabs $0x5e5f,%r11
+  8021e7:	00 00 00 
+  8021ea:	4c 01 d8             	add    %r11,%rax
+  8021ed:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8021f4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021f8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021fb:	48 63 d2             	movslq %edx,%rdx
+  8021fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802202:	6a 00                	push   $0x0
+  802204:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80220a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802210:	be 01 00 00 00       	mov    $0x1,%esi
+  802215:	bf 09 00 00 00       	mov    $0x9,%edi
+  80221a:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802221:	ff ff ff 
+  802224:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802228:	ff d0                	call   *%rax
+  80222a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80222e:	c9                   	leave
+  80222f:	c3                   	ret
+
+0000000000802230 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802230:	55                   	push   %rbp
+  802231:	48 89 e5             	mov    %rsp,%rbp
+  802234:	48 83 ec 10          	sub    $0x10,%rsp
+  802238:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802238 <sys_env_set_pgfault_upcall+0x8>
+  80223f:	49 bb 00 5e 00 00 00 	movabs $0x5e00,%r11
+  802246:	00 00 00 
+  802249:	4c 01 d8             	add    %r11,%rax
+  80224c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80224f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802253:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802257:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80225a:	48 63 d2             	movslq %edx,%rdx
+  80225d:	48 83 ec 08          	sub    $0x8,%rsp
+  802261:	6a 00                	push   $0x0
+  802263:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80226f:	be 01 00 00 00       	mov    $0x1,%esi
+  802274:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802279:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802280:	ff ff ff 
+  802283:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802287:	ff d0                	call   *%rax
+  802289:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80228d:	c9                   	leave
+  80228e:	c3                   	ret
+
+000000000080228f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80228f:	55                   	push   %rbp
+  802290:	48 89 e5             	mov    %rsp,%rbp
+  802293:	48 83 ec 20          	sub    $0x20,%rsp
+  802297:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802297 <sys_ipc_try_send+0x8>
+  80229e:	49 bb a1 5d 00 00 00 	movabs $0x5da1,%r11
+  8022a5:	00 00 00 
+  8022a8:	4c 01 d8             	add    %r11,%rax
+  8022ab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022b2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8022b6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8022b9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022bc:	48 63 fa             	movslq %edx,%rdi
+  8022bf:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8022c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022c6:	48 63 d2             	movslq %edx,%rdx
+  8022c9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8022d1:	6a 00                	push   $0x0
+  8022d3:	49 89 f9             	mov    %rdi,%r9
+  8022d6:	49 89 f0             	mov    %rsi,%r8
+  8022d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022de:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8022e3:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  8022ea:	ff ff ff 
+  8022ed:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022f1:	ff d0                	call   *%rax
+  8022f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f7:	c9                   	leave
+  8022f8:	c3                   	ret
+
+00000000008022f9 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8022f9:	55                   	push   %rbp
+  8022fa:	48 89 e5             	mov    %rsp,%rbp
+  8022fd:	48 83 ec 20          	sub    $0x20,%rsp
+  802301:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802301 <sys_ipc_send+0x8>
+  802308:	49 bb 37 5d 00 00 00 	movabs $0x5d37,%r11
+  80230f:	00 00 00 
+  802312:	4c 01 d8             	add    %r11,%rax
+  802315:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802318:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80231c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802320:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802323:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802326:	48 63 fa             	movslq %edx,%rdi
+  802329:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80232d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802330:	48 63 d2             	movslq %edx,%rdx
+  802333:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802337:	48 83 ec 08          	sub    $0x8,%rsp
+  80233b:	6a 00                	push   $0x0
+  80233d:	49 89 f9             	mov    %rdi,%r9
+  802340:	49 89 f0             	mov    %rsi,%r8
+  802343:	be 00 00 00 00       	mov    $0x0,%esi
+  802348:	bf 17 00 00 00       	mov    $0x17,%edi
+  80234d:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802354:	ff ff ff 
+  802357:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80235b:	ff d0                	call   *%rax
+  80235d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802361:	c9                   	leave
+  802362:	c3                   	ret
+
+0000000000802363 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802363:	55                   	push   %rbp
+  802364:	48 89 e5             	mov    %rsp,%rbp
+  802367:	48 83 ec 10          	sub    $0x10,%rsp
+  80236b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80236b <sys_ipc_recv+0x8>
+  802372:	49 bb cd 5c 00 00 00 	movabs $0x5ccd,%r11
+  802379:	00 00 00 
+  80237c:	4c 01 d8             	add    %r11,%rax
+  80237f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802383:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802387:	6a 00                	push   $0x0
+  802389:	6a 00                	push   $0x0
+  80238b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802391:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802397:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80239c:	be 01 00 00 00       	mov    $0x1,%esi
+  8023a1:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8023a6:	49 ba 9b 9c ff ff ff 	movabs $0xffffffffffff9c9b,%r10
+  8023ad:	ff ff ff 
+  8023b0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023b4:	ff d0                	call   *%rax
+  8023b6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ba:	c9                   	leave
+  8023bb:	c3                   	ret
+
+00000000008023bc <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8023bc:	55                   	push   %rbp
+  8023bd:	48 89 e5             	mov    %rsp,%rbp
+  8023c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8023c4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023c4 <sys_ipc_call+0x8>
+  8023cb:	49 bb 74 5c 00 00 00 	movabs $0x5c74,%r11
+  8023d2:	00 00 00 
+  8023d5:	4c 01 d8             	add    %r11,%rax
+  8023d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023df:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023e3:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8023e6:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8023ea:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8023ee:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8023f2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023f5:	4c 63 c2             	movslq %edx,%r8
+  8023f8:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8023fc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023ff:	48 63 d2             	movslq %edx,%rdx
+  802402:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802406:	ff 75 d8             	push   -0x28(%rbp)
+  802409:	56                   	push   %rsi
+  80240a:	4d 89 c1             	mov    %r8,%r9
+  80240d:	49 89 f8             	mov    %rdi,%r8
+  802410:	be 00 00 00 00       	mov    $0x0,%esi
+  802415:	bf 18 00 00 00       	mov    $0x18,%edi
+  80241a:	49 ba 9b 9c ff ff ff 	movabs $0xffffffffffff9c9b,%r10
+  802421:	ff ff ff 
+  802424:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802428:	ff d0                	call   *%rax
+  80242a:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80242e:	c9                   	leave
+  80242f:	c3                   	ret
+
+0000000000802430 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802430:	55                   	push   %rbp
+  802431:	48 89 e5             	mov    %rsp,%rbp
+  802434:	48 83 ec 30          	sub    $0x30,%rsp
+  802438:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802438 <sys_ipc_reply_recv+0x8>
+  80243f:	49 bb 00 5c 00 00 00 	movabs $0x5c00,%r11
+  802446:	00 00 00 
+  802449:	4c 01 d8             	add    %r11,%rax
+  80244c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80244f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802453:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802457:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80245a:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80245e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802462:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802466:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802469:	4c 63 c2             	movslq %edx,%r8
+  80246c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802470:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802473:	48 63 d2             	movslq %edx,%rdx
+  802476:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80247a:	ff 75 d8             	push   -0x28(%rbp)
+  80247d:	56                   	push   %rsi
+  80247e:	4d 89 c1             	mov    %r8,%r9
+  802481:	49 89 f8             	mov    %rdi,%r8
+  802484:	be 00 00 00 00       	mov    $0x0,%esi
+  802489:	bf 19 00 00 00       	mov    $0x19,%edi
+  80248e:	49 ba 9b 9c ff ff ff 	movabs $0xffffffffffff9c9b,%r10
+  802495:	ff ff ff 
+  802498:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80249c:	ff d0                	call   *%rax
+  80249e:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8024a2:	c9                   	leave
+  8024a3:	c3                   	ret
+
+00000000008024a4 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8024a4:	55                   	push   %rbp
+  8024a5:	48 89 e5             	mov    %rsp,%rbp
+  8024a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024ac <sys_env_set_priority+0x8>
+  8024b3:	49 bb 8c 5b 00 00 00 	movabs $0x5b8c,%r11
+  8024ba:	00 00 00 
+  8024bd:	4c 01 d8             	add    %r11,%rax
+  8024c0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024c3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8024c6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024c9:	48 63 ca             	movslq %edx,%rcx
+  8024cc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024cf:	48 63 d2             	movslq %edx,%rdx
+  8024d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d6:	6a 00                	push   $0x0
+  8024d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8024e9:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8024ee:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  8024f5:	ff ff ff 
+  8024f8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024fc:	ff d0                	call   *%rax
+  8024fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802502:	c9                   	leave
+  802503:	c3                   	ret
+
+0000000000802504 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802504:	55                   	push   %rbp
+  802505:	48 89 e5             	mov    %rsp,%rbp
+  802508:	48 83 ec 10          	sub    $0x10,%rsp
+  80250c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80250c <sys_env_set_affinity+0x8>
+  802513:	49 bb 2c 5b 00 00 00 	movabs $0x5b2c,%r11
+  80251a:	00 00 00 
+  80251d:	4c 01 d8             	add    %r11,%rax
+  802520:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802523:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802526:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802529:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80252c:	48 63 d2             	movslq %edx,%rdx
+  80252f:	48 83 ec 08          	sub    $0x8,%rsp
+  802533:	6a 00                	push   $0x0
+  802535:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80253b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802541:	be 01 00 00 00       	mov    $0x1,%esi
+  802546:	bf 10 00 00 00       	mov    $0x10,%edi
+  80254b:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802552:	ff ff ff 
+  802555:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802559:	ff d0                	call   *%rax
+  80255b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80255f:	c9                   	leave
+  802560:	c3                   	ret
+
+0000000000802561 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802561:	55                   	push   %rbp
+  802562:	48 89 e5             	mov    %rsp,%rbp
+  802565:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802565 <sys_time_msec+0x4>
+  80256c:	49 bb d3 5a 00 00 00 	movabs $0x5ad3,%r11
+  802573:	00 00 00 
+  802576:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802579:	48 83 ec 08          	sub    $0x8,%rsp
+  80257d:	6a 00                	push   $0x0
+  80257f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802585:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80258b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802590:	ba 00 00 00 00       	mov    $0x0,%edx
+  802595:	be 00 00 00 00       	mov    $0x0,%esi
+  80259a:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80259f:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  8025a6:	ff ff ff 
+  8025a9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025ad:	ff d0                	call   *%rax
+  8025af:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025b3:	c9                   	leave
+  8025b4:	c3                   	ret
+
+00000000008025b5 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8025b5:	55                   	push   %rbp
+  8025b6:	48 89 e5             	mov    %rsp,%rbp
+  8025b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8025bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025bd <sys_sleep_usec+0x8>
+  8025c4:	49 bb 7b 5a 00 00 00 	movabs $0x5a7b,%r11
+  8025cb:	00 00 00 
+  8025ce:	4c 01 d8             	add    %r11,%rax
+  8025d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8025d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8025dd:	6a 00                	push   $0x0
+  8025df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f5:	bf 11 00 00 00       	mov    $0x11,%edi
+  8025fa:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802601:	ff ff ff 
+  802604:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802608:	ff d0                	call   *%rax
+  80260a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80260e:	c9                   	leave
+  80260f:	c3                   	ret
+
+0000000000802610 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802610:	55                   	push   %rbp
+  802611:	48 89 e5             	mov    %rsp,%rbp
+  802614:	48 83 ec 10          	sub    $0x10,%rsp
+  802618:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802618 <sys_page_alloc_huge+0x8>
+  80261f:	49 bb 20 5a 00 00 00 	movabs $0x5a20,%r11
+  802626:	00 00 00 
+  802629:	4c 01 d8             	add    %r11,%rax
+  80262c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80262f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802633:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802636:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802639:	48 63 f2             	movslq %edx,%rsi
+  80263c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802640:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802643:	48 63 d2             	movslq %edx,%rdx
+  802646:	48 83 ec 08          	sub    $0x8,%rsp
+  80264a:	6a 00                	push   $0x0
+  80264c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802652:	49 89 f0             	mov    %rsi,%r8
+  802655:	be 01 00 00 00       	mov    $0x1,%esi
+  80265a:	bf 12 00 00 00       	mov    $0x12,%edi
+  80265f:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802666:	ff ff ff 
+  802669:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80266d:	ff d0                	call   *%rax
+  80266f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802673:	c9                   	leave
+  802674:	c3                   	ret
+
+0000000000802675 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802675:	55                   	push   %rbp
+  802676:	48 89 e5             	mov    %rsp,%rbp
+  802679:	48 83 ec 10          	sub    $0x10,%rsp
+  80267d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80267d <sys_page_map_batch+0x8>
+  802684:	49 bb bb 59 00 00 00 	movabs $0x59bb,%r11
+  80268b:	00 00 00 
+  80268e:	4c 01 d8             	add    %r11,%rax
+  802691:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802695:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802699:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80269d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a5:	6a 00                	push   $0x0
+  8026a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8026b8:	bf 13 00 00 00       	mov    $0x13,%edi
+  8026bd:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  8026c4:	ff ff ff 
+  8026c7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026cb:	ff d0                	call   *%rax
+  8026cd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+
+00000000008026d3 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8026d3:	55                   	push   %rbp
+  8026d4:	48 89 e5             	mov    %rsp,%rbp
+  8026d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8026db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026db <sys_page_alloc_batch+0x8>
+  8026e2:	49 bb 5d 59 00 00 00 	movabs $0x595d,%r11
+  8026e9:	00 00 00 
+  8026ec:	4c 01 d8             	add    %r11,%rax
+  8026ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8026f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026fb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802703:	6a 00                	push   $0x0
+  802705:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80270b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802711:	be 01 00 00 00       	mov    $0x1,%esi
+  802716:	bf 14 00 00 00       	mov    $0x14,%edi
+  80271b:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802722:	ff ff ff 
+  802725:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802729:	ff d0                	call   *%rax
+  80272b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80272f:	c9                   	leave
+  802730:	c3                   	ret
+
+0000000000802731 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802731:	55                   	push   %rbp
+  802732:	48 89 e5             	mov    %rsp,%rbp
+  802735:	48 83 ec 10          	sub    $0x10,%rsp
+  802739:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802739 <sys_page_unmap_batch+0x8>
+  802740:	49 bb ff 58 00 00 00 	movabs $0x58ff,%r11
+  802747:	00 00 00 
+  80274a:	4c 01 d8             	add    %r11,%rax
+  80274d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802751:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802755:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802759:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80275d:	48 83 ec 08          	sub    $0x8,%rsp
+  802761:	6a 00                	push   $0x0
+  802763:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802769:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80276f:	be 01 00 00 00       	mov    $0x1,%esi
+  802774:	bf 15 00 00 00       	mov    $0x15,%edi
+  802779:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  802780:	ff ff ff 
+  802783:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802787:	ff d0                	call   *%rax
+  802789:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80278d:	c9                   	leave
+  80278e:	c3                   	ret
+
+000000000080278f <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80278f:	55                   	push   %rbp
+  802790:	48 89 e5             	mov    %rsp,%rbp
+  802793:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802793 <sys_fork+0x4>
+  80279a:	49 bb a5 58 00 00 00 	movabs $0x58a5,%r11
+  8027a1:	00 00 00 
+  8027a4:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8027a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ab:	6a 00                	push   $0x0
+  8027ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c8:	bf 16 00 00 00       	mov    $0x16,%edi
+  8027cd:	49 ba e1 9b ff ff ff 	movabs $0xffffffffffff9be1,%r10
+  8027d4:	ff ff ff 
+  8027d7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027db:	ff d0                	call   *%rax
+  8027dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027e1:	c9                   	leave
+  8027e2:	c3                   	ret
+
+00000000008027e3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8027e3:	55                   	push   %rbp
+  8027e4:	48 89 e5             	mov    %rsp,%rbp
+  8027e7:	41 57                	push   %r15
+  8027e9:	53                   	push   %rbx
+  8027ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8027ee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8027ee <set_pgfault_handler+0xb>
+  8027f5:	49 bb 4a 58 00 00 00 	movabs $0x584a,%r11
+  8027fc:	00 00 00 
+  8027ff:	4c 01 db             	add    %r11,%rbx
+  802802:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  802806:	49 89 df             	mov    %rbx,%r15
+  802809:	48 b8 59 9f ff ff ff 	movabs $0xffffffffffff9f59,%rax
+  802810:	ff ff ff 
+  802813:	48 01 d8             	add    %rbx,%rax
+  802816:	ff d0                	call   *%rax
+  802818:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  80281b:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  802822:	00 00 00 
+  802825:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802829:	48 85 c0             	test   %rax,%rax
+  80282c:	75 6b                	jne    802899 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  80282e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802831:	ba 07 00 00 00       	mov    $0x7,%edx
+  802836:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80283b:	48 89 ce             	mov    %rcx,%rsi
+  80283e:	89 c7                	mov    %eax,%edi
+  802840:	49 89 df             	mov    %rbx,%r15
+  802843:	48 b8 02 a0 ff ff ff 	movabs $0xffffffffffffa002,%rax
+  80284a:	ff ff ff 
+  80284d:	48 01 d8             	add    %rbx,%rax
+  802850:	ff d0                	call   *%rax
+  802852:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  802855:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802859:	74 3e                	je     802899 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  80285b:	48 b8 a0 e5 ff ff ff 	movabs $0xffffffffffffe5a0,%rax
+  802862:	ff ff ff 
+  802865:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802869:	48 89 c2             	mov    %rax,%rdx
+  80286c:	be 23 00 00 00       	mov    $0x23,%esi
+  802871:	48 b8 ce e5 ff ff ff 	movabs $0xffffffffffffe5ce,%rax
+  802878:	ff ff ff 
+  80287b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80287f:	48 89 c7             	mov    %rax,%rdi
+  802882:	49 89 df             	mov    %rbx,%r15
+  802885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288a:	48 b9 ad 82 ff ff ff 	movabs $0xffffffffffff82ad,%rcx
+  802891:	ff ff ff 
+  802894:	48 01 d9             	add    %rbx,%rcx
+  802897:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  802899:	48 ba d8 1f 01 00 00 	movabs $0x11fd8,%rdx
+  8028a0:	00 00 00 
+  8028a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028a7:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  8028ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028ae:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8028b5:	ff ff ff 
+  8028b8:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8028bc:	48 89 d6             	mov    %rdx,%rsi
+  8028bf:	89 c7                	mov    %eax,%edi
+  8028c1:	49 89 df             	mov    %rbx,%r15
+  8028c4:	48 b8 f8 a1 ff ff ff 	movabs $0xffffffffffffa1f8,%rax
+  8028cb:	ff ff ff 
+  8028ce:	48 01 d8             	add    %rbx,%rax
+  8028d1:	ff d0                	call   *%rax
+}
+  8028d3:	90                   	nop
+  8028d4:	48 83 c4 20          	add    $0x20,%rsp
+  8028d8:	5b                   	pop    %rbx
+  8028d9:	41 5f                	pop    %r15
+  8028db:	5d                   	pop    %rbp
+  8028dc:	c3                   	ret
+
+00000000008028dd <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  8028dd:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  8028e0:	48 a1 10 a0 81 00 00 	movabs 0x81a010,%rax
+  8028e7:	00 00 00 
+call *%rax
+  8028ea:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  8028ec:	58                   	pop    %rax
+	popq %rax;
+  8028ed:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  8028ee:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  8028f5:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  8028f9:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  8028fd:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  802901:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  802905:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  802909:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  80290c:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  802910:	4c 8b 3c 24          	mov    (%rsp),%r15
+  802914:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802919:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80291e:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  802923:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802928:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80292d:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  802932:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802937:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80293c:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  802941:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  802946:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80294b:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802950:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  802955:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80295a:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  80295e:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  802962:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  802963:	5c                   	pop    %rsp
+	ret;			//return
+  802964:	c3                   	ret
+
+0000000000802965 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802965:	55                   	push   %rbp
+  802966:	48 89 e5             	mov    %rsp,%rbp
+  802969:	48 83 ec 08          	sub    $0x8,%rsp
+  80296d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80296d <fd2num+0x8>
+  802974:	49 bb cb 56 00 00 00 	movabs $0x56cb,%r11
+  80297b:	00 00 00 
+  80297e:	4c 01 d8             	add    %r11,%rax
+  802981:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802985:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802989:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802990:	ff ff ff 
+  802993:	48 01 d0             	add    %rdx,%rax
+  802996:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80299a:	c9                   	leave
+  80299b:	c3                   	ret
+
+000000000080299c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80299c:	55                   	push   %rbp
+  80299d:	48 89 e5             	mov    %rsp,%rbp
+  8029a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029a4 <fd2data+0x8>
+  8029ab:	49 bb 94 56 00 00 00 	movabs $0x5694,%r11
+  8029b2:	00 00 00 
+  8029b5:	4c 01 d8             	add    %r11,%rax
+  8029b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8029bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029c0:	48 89 d7             	mov    %rdx,%rdi
+  8029c3:	48 ba 2d a9 ff ff ff 	movabs $0xffffffffffffa92d,%rdx
+  8029ca:	ff ff ff 
+  8029cd:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8029d1:	ff d0                	call   *%rax
+  8029d3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8029d9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8029dd:	c9                   	leave
+  8029de:	c3                   	ret
+
+00000000008029df <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8029df:	55                   	push   %rbp
+  8029e0:	48 89 e5             	mov    %rsp,%rbp
+  8029e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8029e7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029e7 <fd_alloc+0x8>
+  8029ee:	49 bb 51 56 00 00 00 	movabs $0x5651,%r11
+  8029f5:	00 00 00 
+  8029f8:	4c 01 d8             	add    %r11,%rax
+  8029fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8029ff:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a06:	eb 75                	jmp    802a7d <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802a08:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a0b:	48 63 d2             	movslq %edx,%rdx
+  802a0e:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802a15:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802a19:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a1d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a21:	48 89 d1             	mov    %rdx,%rcx
+  802a24:	48 c1 e9 15          	shr    $0x15,%rcx
+  802a28:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802a2f:	ff ff ff 
+  802a32:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a36:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a3a:	83 e2 01             	and    $0x1,%edx
+  802a3d:	48 85 d2             	test   %rdx,%rdx
+  802a40:	74 25                	je     802a67 <fd_alloc+0x88>
+  802a42:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a46:	48 89 d1             	mov    %rdx,%rcx
+  802a49:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802a4d:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802a54:	ff ff ff 
+  802a57:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a5b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a5f:	83 e2 01             	and    $0x1,%edx
+  802a62:	48 85 d2             	test   %rdx,%rdx
+  802a65:	75 12                	jne    802a79 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802a67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a6b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a6f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a77:	eb 1a                	jmp    802a93 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802a79:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a7d:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a81:	7e 85                	jle    802a08 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802a83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a87:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802a8e:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802a93:	c9                   	leave
+  802a94:	c3                   	ret
+
+0000000000802a95 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802a95:	55                   	push   %rbp
+  802a96:	48 89 e5             	mov    %rsp,%rbp
+  802a99:	48 83 ec 20          	sub    $0x20,%rsp
+  802a9d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a9d <fd_lookup+0x8>
+  802aa4:	49 bb 9b 55 00 00 00 	movabs $0x559b,%r11
+  802aab:	00 00 00 
+  802aae:	4c 01 d8             	add    %r11,%rax
+  802ab1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ab4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802ab8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802abc:	78 06                	js     802ac4 <fd_lookup+0x2f>
+  802abe:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802ac2:	7e 07                	jle    802acb <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802ac4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac9:	eb 73                	jmp    802b3e <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802acb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ace:	48 63 d2             	movslq %edx,%rdx
+  802ad1:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802ad8:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802adc:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802ae0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ae4:	48 89 d1             	mov    %rdx,%rcx
+  802ae7:	48 c1 e9 15          	shr    $0x15,%rcx
+  802aeb:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802af2:	ff ff ff 
+  802af5:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802af9:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802afd:	83 e2 01             	and    $0x1,%edx
+  802b00:	48 85 d2             	test   %rdx,%rdx
+  802b03:	74 22                	je     802b27 <fd_lookup+0x92>
+  802b05:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b09:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802b0d:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802b14:	ff ff ff 
+  802b17:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802b1b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b1f:	83 e0 01             	and    $0x1,%eax
+  802b22:	48 85 c0             	test   %rax,%rax
+  802b25:	75 07                	jne    802b2e <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802b27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b2c:	eb 10                	jmp    802b3e <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802b2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b32:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b36:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b3e:	c9                   	leave
+  802b3f:	c3                   	ret
+
+0000000000802b40 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802b40:	55                   	push   %rbp
+  802b41:	48 89 e5             	mov    %rsp,%rbp
+  802b44:	41 57                	push   %r15
+  802b46:	53                   	push   %rbx
+  802b47:	48 83 ec 30          	sub    $0x30,%rsp
+  802b4b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b4b <fd_close+0xb>
+  802b52:	49 bb ed 54 00 00 00 	movabs $0x54ed,%r11
+  802b59:	00 00 00 
+  802b5c:	4c 01 db             	add    %r11,%rbx
+  802b5f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802b63:	89 f0                	mov    %esi,%eax
+  802b65:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802b68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b6c:	48 89 c7             	mov    %rax,%rdi
+  802b6f:	48 b8 2d a9 ff ff ff 	movabs $0xffffffffffffa92d,%rax
+  802b76:	ff ff ff 
+  802b79:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b7d:	ff d0                	call   *%rax
+  802b7f:	89 c2                	mov    %eax,%edx
+  802b81:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802b85:	48 89 c6             	mov    %rax,%rsi
+  802b88:	89 d7                	mov    %edx,%edi
+  802b8a:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  802b91:	ff ff ff 
+  802b94:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b98:	ff d0                	call   *%rax
+  802b9a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b9d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ba1:	78 0a                	js     802bad <fd_close+0x6d>
+	    || fd != fd2)
+  802ba3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ba7:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802bab:	74 12                	je     802bbf <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802bad:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802bb1:	74 05                	je     802bb8 <fd_close+0x78>
+  802bb3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bb6:	eb 7a                	jmp    802c32 <fd_close+0xf2>
+  802bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbd:	eb 73                	jmp    802c32 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802bbf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bc3:	8b 00                	mov    (%rax),%eax
+  802bc5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802bc9:	48 89 d6             	mov    %rdx,%rsi
+  802bcc:	89 c7                	mov    %eax,%edi
+  802bce:	48 b8 03 ac ff ff ff 	movabs $0xffffffffffffac03,%rax
+  802bd5:	ff ff ff 
+  802bd8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bdc:	ff d0                	call   *%rax
+  802bde:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802be1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802be5:	78 2a                	js     802c11 <fd_close+0xd1>
+		if (dev->dev_close)
+  802be7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802beb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802bef:	48 85 c0             	test   %rax,%rax
+  802bf2:	74 16                	je     802c0a <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802bf4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bf8:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802bfc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c00:	48 89 c7             	mov    %rax,%rdi
+  802c03:	ff d2                	call   *%rdx
+  802c05:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c08:	eb 07                	jmp    802c11 <fd_close+0xd1>
+		else
+			r = 0;
+  802c0a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802c11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c15:	48 89 c6             	mov    %rax,%rsi
+  802c18:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c1d:	49 89 df             	mov    %rbx,%r15
+  802c20:	48 b8 da a0 ff ff ff 	movabs $0xffffffffffffa0da,%rax
+  802c27:	ff ff ff 
+  802c2a:	48 01 d8             	add    %rbx,%rax
+  802c2d:	ff d0                	call   *%rax
+	return r;
+  802c2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802c32:	48 83 c4 30          	add    $0x30,%rsp
+  802c36:	5b                   	pop    %rbx
+  802c37:	41 5f                	pop    %r15
+  802c39:	5d                   	pop    %rbp
+  802c3a:	c3                   	ret
+
+0000000000802c3b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802c3b:	55                   	push   %rbp
+  802c3c:	48 89 e5             	mov    %rsp,%rbp
+  802c3f:	41 57                	push   %r15
+  802c41:	48 83 ec 28          	sub    $0x28,%rsp
+  802c45:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802c45 <dev_lookup+0xa>
+  802c4c:	49 bb f3 53 00 00 00 	movabs $0x53f3,%r11
+  802c53:	00 00 00 
+  802c56:	4c 01 d9             	add    %r11,%rcx
+  802c59:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c5c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802c60:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802c67:	eb 45                	jmp    802cae <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802c69:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802c70:	00 00 00 
+  802c73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c76:	48 98                	cltq
+  802c78:	48 01 ca             	add    %rcx,%rdx
+  802c7b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c7f:	8b 00                	mov    (%rax),%eax
+  802c81:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802c84:	75 24                	jne    802caa <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802c86:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802c8d:	00 00 00 
+  802c90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c93:	48 98                	cltq
+  802c95:	48 01 ca             	add    %rcx,%rdx
+  802c98:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c9c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ca0:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca8:	eb 74                	jmp    802d1e <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802caa:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802cae:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802cb5:	00 00 00 
+  802cb8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cbb:	48 98                	cltq
+  802cbd:	48 01 ca             	add    %rcx,%rdx
+  802cc0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cc4:	48 85 c0             	test   %rax,%rax
+  802cc7:	75 a0                	jne    802c69 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802cc9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802cd0:	ff ff ff 
+  802cd3:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802cd7:	48 8b 00             	mov    (%rax),%rax
+  802cda:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802ce0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ce3:	89 c6                	mov    %eax,%esi
+  802ce5:	48 b8 e0 e5 ff ff ff 	movabs $0xffffffffffffe5e0,%rax
+  802cec:	ff ff ff 
+  802cef:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802cf3:	48 89 c7             	mov    %rax,%rdi
+  802cf6:	49 89 cf             	mov    %rcx,%r15
+  802cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfe:	49 b8 84 85 ff ff ff 	movabs $0xffffffffffff8584,%r8
+  802d05:	ff ff ff 
+  802d08:	49 01 c8             	add    %rcx,%r8
+  802d0b:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802d0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d12:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802d19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d1e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802d22:	c9                   	leave
+  802d23:	c3                   	ret
+
+0000000000802d24 <close>:
+
+int
+close(int fdnum)
+{
+  802d24:	55                   	push   %rbp
+  802d25:	48 89 e5             	mov    %rsp,%rbp
+  802d28:	53                   	push   %rbx
+  802d29:	48 83 ec 28          	sub    $0x28,%rsp
+  802d2d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d2d <close+0x9>
+  802d34:	49 bb 0b 53 00 00 00 	movabs $0x530b,%r11
+  802d3b:	00 00 00 
+  802d3e:	4c 01 db             	add    %r11,%rbx
+  802d41:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d44:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802d48:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d4b:	48 89 d6             	mov    %rdx,%rsi
+  802d4e:	89 c7                	mov    %eax,%edi
+  802d50:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  802d57:	ff ff ff 
+  802d5a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d5e:	ff d0                	call   *%rax
+  802d60:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d63:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d67:	79 05                	jns    802d6e <close+0x4a>
+		return r;
+  802d69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d6c:	eb 1c                	jmp    802d8a <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802d6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d72:	be 01 00 00 00       	mov    $0x1,%esi
+  802d77:	48 89 c7             	mov    %rax,%rdi
+  802d7a:	48 b8 08 ab ff ff ff 	movabs $0xffffffffffffab08,%rax
+  802d81:	ff ff ff 
+  802d84:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d88:	ff d0                	call   *%rax
+}
+  802d8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d8e:	c9                   	leave
+  802d8f:	c3                   	ret
+
+0000000000802d90 <close_all>:
+
+void
+close_all(void)
+{
+  802d90:	55                   	push   %rbp
+  802d91:	48 89 e5             	mov    %rsp,%rbp
+  802d94:	53                   	push   %rbx
+  802d95:	48 83 ec 18          	sub    $0x18,%rsp
+  802d99:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d99 <close_all+0x9>
+  802da0:	49 bb 9f 52 00 00 00 	movabs $0x529f,%r11
+  802da7:	00 00 00 
+  802daa:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802dad:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802db4:	eb 19                	jmp    802dcf <close_all+0x3f>
+		close(i);
+  802db6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802db9:	89 c7                	mov    %eax,%edi
+  802dbb:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  802dc2:	ff ff ff 
+  802dc5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dc9:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802dcb:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802dcf:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802dd3:	7e e1                	jle    802db6 <close_all+0x26>
+}
+  802dd5:	90                   	nop
+  802dd6:	90                   	nop
+  802dd7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ddb:	c9                   	leave
+  802ddc:	c3                   	ret
+
+0000000000802ddd <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802ddd:	55                   	push   %rbp
+  802dde:	48 89 e5             	mov    %rsp,%rbp
+  802de1:	41 57                	push   %r15
+  802de3:	53                   	push   %rbx
+  802de4:	48 83 ec 40          	sub    $0x40,%rsp
+  802de8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802de8 <dup+0xb>
+  802def:	49 bb 50 52 00 00 00 	movabs $0x5250,%r11
+  802df6:	00 00 00 
+  802df9:	4c 01 db             	add    %r11,%rbx
+  802dfc:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802dff:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802e02:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e06:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802e09:	48 89 d6             	mov    %rdx,%rsi
+  802e0c:	89 c7                	mov    %eax,%edi
+  802e0e:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  802e15:	ff ff ff 
+  802e18:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e1c:	ff d0                	call   *%rax
+  802e1e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e21:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e25:	79 08                	jns    802e2f <dup+0x52>
+		return r;
+  802e27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e2a:	e9 a4 01 00 00       	jmp    802fd3 <dup+0x1f6>
+	close(newfdnum);
+  802e2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e32:	89 c7                	mov    %eax,%edi
+  802e34:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  802e3b:	ff ff ff 
+  802e3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e42:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802e44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e47:	48 98                	cltq
+  802e49:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802e4f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e53:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802e57:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e5b:	48 89 c7             	mov    %rax,%rdi
+  802e5e:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  802e65:	ff ff ff 
+  802e68:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e6c:	ff d0                	call   *%rax
+  802e6e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802e72:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e76:	48 89 c7             	mov    %rax,%rdi
+  802e79:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  802e80:	ff ff ff 
+  802e83:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e87:	ff d0                	call   *%rax
+  802e89:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802e8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e91:	48 c1 e8 15          	shr    $0x15,%rax
+  802e95:	48 89 c2             	mov    %rax,%rdx
+  802e98:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802e9f:	ff ff ff 
+  802ea2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ea6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eaa:	83 e0 01             	and    $0x1,%eax
+  802ead:	48 85 c0             	test   %rax,%rax
+  802eb0:	74 7f                	je     802f31 <dup+0x154>
+  802eb2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802eb6:	48 c1 e8 0c          	shr    $0xc,%rax
+  802eba:	48 89 c2             	mov    %rax,%rdx
+  802ebd:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802ec4:	ff ff ff 
+  802ec7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ecb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ecf:	83 e0 01             	and    $0x1,%eax
+  802ed2:	48 85 c0             	test   %rax,%rax
+  802ed5:	74 5a                	je     802f31 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802ed7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802edb:	48 c1 e8 0c          	shr    $0xc,%rax
+  802edf:	48 89 c2             	mov    %rax,%rdx
+  802ee2:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802ee9:	ff ff ff 
+  802eec:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ef0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ef4:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ef9:	89 c1                	mov    %eax,%ecx
+  802efb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802eff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f03:	41 89 c8             	mov    %ecx,%r8d
+  802f06:	48 89 d1             	mov    %rdx,%rcx
+  802f09:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f0e:	48 89 c6             	mov    %rax,%rsi
+  802f11:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f16:	49 89 df             	mov    %rbx,%r15
+  802f19:	48 b8 67 a0 ff ff ff 	movabs $0xffffffffffffa067,%rax
+  802f20:	ff ff ff 
+  802f23:	48 01 d8             	add    %rbx,%rax
+  802f26:	ff d0                	call   *%rax
+  802f28:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f2b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f2f:	78 5f                	js     802f90 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802f31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f35:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f39:	48 89 c2             	mov    %rax,%rdx
+  802f3c:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f43:	ff ff ff 
+  802f46:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f4a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f4e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f53:	89 c1                	mov    %eax,%ecx
+  802f55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f59:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f5d:	41 89 c8             	mov    %ecx,%r8d
+  802f60:	48 89 d1             	mov    %rdx,%rcx
+  802f63:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f68:	48 89 c6             	mov    %rax,%rsi
+  802f6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f70:	49 89 df             	mov    %rbx,%r15
+  802f73:	48 b8 67 a0 ff ff ff 	movabs $0xffffffffffffa067,%rax
+  802f7a:	ff ff ff 
+  802f7d:	48 01 d8             	add    %rbx,%rax
+  802f80:	ff d0                	call   *%rax
+  802f82:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f85:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f89:	78 08                	js     802f93 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802f8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f8e:	eb 43                	jmp    802fd3 <dup+0x1f6>
+			goto err;
+  802f90:	90                   	nop
+  802f91:	eb 01                	jmp    802f94 <dup+0x1b7>
+		goto err;
+  802f93:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802f94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f98:	48 89 c6             	mov    %rax,%rsi
+  802f9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa0:	49 89 df             	mov    %rbx,%r15
+  802fa3:	48 b8 da a0 ff ff ff 	movabs $0xffffffffffffa0da,%rax
+  802faa:	ff ff ff 
+  802fad:	48 01 d8             	add    %rbx,%rax
+  802fb0:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802fb2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fb6:	48 89 c6             	mov    %rax,%rsi
+  802fb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fbe:	49 89 df             	mov    %rbx,%r15
+  802fc1:	48 b8 da a0 ff ff ff 	movabs $0xffffffffffffa0da,%rax
+  802fc8:	ff ff ff 
+  802fcb:	48 01 d8             	add    %rbx,%rax
+  802fce:	ff d0                	call   *%rax
+	return r;
+  802fd0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802fd3:	48 83 c4 40          	add    $0x40,%rsp
+  802fd7:	5b                   	pop    %rbx
+  802fd8:	41 5f                	pop    %r15
+  802fda:	5d                   	pop    %rbp
+  802fdb:	c3                   	ret
+
+0000000000802fdc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802fdc:	55                   	push   %rbp
+  802fdd:	48 89 e5             	mov    %rsp,%rbp
+  802fe0:	41 57                	push   %r15
+  802fe2:	53                   	push   %rbx
+  802fe3:	48 83 ec 40          	sub    $0x40,%rsp
+  802fe7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802fe7 <read+0xb>
+  802fee:	49 bb 51 50 00 00 00 	movabs $0x5051,%r11
+  802ff5:	00 00 00 
+  802ff8:	4c 01 db             	add    %r11,%rbx
+  802ffb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802ffe:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803002:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803006:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80300a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80300d:	48 89 d6             	mov    %rdx,%rsi
+  803010:	89 c7                	mov    %eax,%edi
+  803012:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  803019:	ff ff ff 
+  80301c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803020:	ff d0                	call   *%rax
+  803022:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803025:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803029:	78 28                	js     803053 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80302b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80302f:	8b 00                	mov    (%rax),%eax
+  803031:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803035:	48 89 d6             	mov    %rdx,%rsi
+  803038:	89 c7                	mov    %eax,%edi
+  80303a:	48 b8 03 ac ff ff ff 	movabs $0xffffffffffffac03,%rax
+  803041:	ff ff ff 
+  803044:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803048:	ff d0                	call   *%rax
+  80304a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80304d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803051:	79 08                	jns    80305b <read+0x7f>
+		return r;
+  803053:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803056:	e9 8b 00 00 00       	jmp    8030e6 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80305b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80305f:	8b 40 08             	mov    0x8(%rax),%eax
+  803062:	83 e0 03             	and    $0x3,%eax
+  803065:	83 f8 01             	cmp    $0x1,%eax
+  803068:	75 4b                	jne    8030b5 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80306a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803071:	ff ff ff 
+  803074:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803078:	48 8b 00             	mov    (%rax),%rax
+  80307b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803081:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803084:	89 c6                	mov    %eax,%esi
+  803086:	48 b8 ff e5 ff ff ff 	movabs $0xffffffffffffe5ff,%rax
+  80308d:	ff ff ff 
+  803090:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803094:	48 89 c7             	mov    %rax,%rdi
+  803097:	49 89 df             	mov    %rbx,%r15
+  80309a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309f:	48 b9 84 85 ff ff ff 	movabs $0xffffffffffff8584,%rcx
+  8030a6:	ff ff ff 
+  8030a9:	48 01 d9             	add    %rbx,%rcx
+  8030ac:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8030ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030b3:	eb 31                	jmp    8030e6 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8030b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030b9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8030bd:	48 85 c0             	test   %rax,%rax
+  8030c0:	75 07                	jne    8030c9 <read+0xed>
+		return -E_NOT_SUPP;
+  8030c2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030c7:	eb 1d                	jmp    8030e6 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8030c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030cd:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8030d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030d5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8030d9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8030dd:	48 89 ce             	mov    %rcx,%rsi
+  8030e0:	48 89 c7             	mov    %rax,%rdi
+  8030e3:	41 ff d0             	call   *%r8
+}
+  8030e6:	48 83 c4 40          	add    $0x40,%rsp
+  8030ea:	5b                   	pop    %rbx
+  8030eb:	41 5f                	pop    %r15
+  8030ed:	5d                   	pop    %rbp
+  8030ee:	c3                   	ret
+
+00000000008030ef <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8030ef:	55                   	push   %rbp
+  8030f0:	48 89 e5             	mov    %rsp,%rbp
+  8030f3:	53                   	push   %rbx
+  8030f4:	48 83 ec 38          	sub    $0x38,%rsp
+  8030f8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030f8 <readn+0x9>
+  8030ff:	49 bb 40 4f 00 00 00 	movabs $0x4f40,%r11
+  803106:	00 00 00 
+  803109:	4c 01 db             	add    %r11,%rbx
+  80310c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80310f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803113:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803117:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80311e:	eb 4b                	jmp    80316b <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803120:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803123:	48 98                	cltq
+  803125:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803129:	48 29 c2             	sub    %rax,%rdx
+  80312c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80312f:	48 63 c8             	movslq %eax,%rcx
+  803132:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803136:	48 01 c1             	add    %rax,%rcx
+  803139:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80313c:	48 89 ce             	mov    %rcx,%rsi
+  80313f:	89 c7                	mov    %eax,%edi
+  803141:	48 b8 a4 af ff ff ff 	movabs $0xffffffffffffafa4,%rax
+  803148:	ff ff ff 
+  80314b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80314f:	ff d0                	call   *%rax
+  803151:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803154:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803158:	79 05                	jns    80315f <readn+0x70>
+			return m;
+  80315a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80315d:	eb 1d                	jmp    80317c <readn+0x8d>
+		if (m == 0)
+  80315f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803163:	74 13                	je     803178 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803165:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803168:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80316b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80316e:	48 98                	cltq
+  803170:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803174:	72 aa                	jb     803120 <readn+0x31>
+  803176:	eb 01                	jmp    803179 <readn+0x8a>
+			break;
+  803178:	90                   	nop
+	}
+	return tot;
+  803179:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80317c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803180:	c9                   	leave
+  803181:	c3                   	ret
+
+0000000000803182 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803182:	55                   	push   %rbp
+  803183:	48 89 e5             	mov    %rsp,%rbp
+  803186:	41 57                	push   %r15
+  803188:	53                   	push   %rbx
+  803189:	48 83 ec 40          	sub    $0x40,%rsp
+  80318d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80318d <write+0xb>
+  803194:	49 bb ab 4e 00 00 00 	movabs $0x4eab,%r11
+  80319b:	00 00 00 
+  80319e:	4c 01 db             	add    %r11,%rbx
+  8031a1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8031a4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8031a8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8031ac:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8031b0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8031b3:	48 89 d6             	mov    %rdx,%rsi
+  8031b6:	89 c7                	mov    %eax,%edi
+  8031b8:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  8031bf:	ff ff ff 
+  8031c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031c6:	ff d0                	call   *%rax
+  8031c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031cf:	78 28                	js     8031f9 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8031d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031d5:	8b 00                	mov    (%rax),%eax
+  8031d7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8031db:	48 89 d6             	mov    %rdx,%rsi
+  8031de:	89 c7                	mov    %eax,%edi
+  8031e0:	48 b8 03 ac ff ff ff 	movabs $0xffffffffffffac03,%rax
+  8031e7:	ff ff ff 
+  8031ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031ee:	ff d0                	call   *%rax
+  8031f0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031f7:	79 08                	jns    803201 <write+0x7f>
+		return r;
+  8031f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031fc:	e9 8a 00 00 00       	jmp    80328b <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803201:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803205:	8b 40 08             	mov    0x8(%rax),%eax
+  803208:	83 e0 03             	and    $0x3,%eax
+  80320b:	85 c0                	test   %eax,%eax
+  80320d:	75 4b                	jne    80325a <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80320f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803216:	ff ff ff 
+  803219:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80321d:	48 8b 00             	mov    (%rax),%rax
+  803220:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803226:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803229:	89 c6                	mov    %eax,%esi
+  80322b:	48 b8 1b e6 ff ff ff 	movabs $0xffffffffffffe61b,%rax
+  803232:	ff ff ff 
+  803235:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803239:	48 89 c7             	mov    %rax,%rdi
+  80323c:	49 89 df             	mov    %rbx,%r15
+  80323f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803244:	48 b9 84 85 ff ff ff 	movabs $0xffffffffffff8584,%rcx
+  80324b:	ff ff ff 
+  80324e:	48 01 d9             	add    %rbx,%rcx
+  803251:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803253:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803258:	eb 31                	jmp    80328b <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80325a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80325e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803262:	48 85 c0             	test   %rax,%rax
+  803265:	75 07                	jne    80326e <write+0xec>
+		return -E_NOT_SUPP;
+  803267:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80326c:	eb 1d                	jmp    80328b <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  80326e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803272:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803276:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80327a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80327e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803282:	48 89 ce             	mov    %rcx,%rsi
+  803285:	48 89 c7             	mov    %rax,%rdi
+  803288:	41 ff d0             	call   *%r8
+}
+  80328b:	48 83 c4 40          	add    $0x40,%rsp
+  80328f:	5b                   	pop    %rbx
+  803290:	41 5f                	pop    %r15
+  803292:	5d                   	pop    %rbp
+  803293:	c3                   	ret
+
+0000000000803294 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803294:	55                   	push   %rbp
+  803295:	48 89 e5             	mov    %rsp,%rbp
+  803298:	48 83 ec 18          	sub    $0x18,%rsp
+  80329c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80329c <seek+0x8>
+  8032a3:	49 bb 9c 4d 00 00 00 	movabs $0x4d9c,%r11
+  8032aa:	00 00 00 
+  8032ad:	4c 01 d8             	add    %r11,%rax
+  8032b0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8032b3:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032b6:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8032ba:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032bd:	48 89 ce             	mov    %rcx,%rsi
+  8032c0:	89 d7                	mov    %edx,%edi
+  8032c2:	48 ba 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rdx
+  8032c9:	ff ff ff 
+  8032cc:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8032d0:	ff d0                	call   *%rax
+  8032d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032d5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032d9:	79 05                	jns    8032e0 <seek+0x4c>
+		return r;
+  8032db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032de:	eb 0f                	jmp    8032ef <seek+0x5b>
+	fd->fd_offset = offset;
+  8032e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032e4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8032e7:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8032ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ef:	c9                   	leave
+  8032f0:	c3                   	ret
+
+00000000008032f1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8032f1:	55                   	push   %rbp
+  8032f2:	48 89 e5             	mov    %rsp,%rbp
+  8032f5:	41 57                	push   %r15
+  8032f7:	53                   	push   %rbx
+  8032f8:	48 83 ec 30          	sub    $0x30,%rsp
+  8032fc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032fc <ftruncate+0xb>
+  803303:	49 bb 3c 4d 00 00 00 	movabs $0x4d3c,%r11
+  80330a:	00 00 00 
+  80330d:	4c 01 db             	add    %r11,%rbx
+  803310:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803313:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803316:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80331a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80331d:	48 89 d6             	mov    %rdx,%rsi
+  803320:	89 c7                	mov    %eax,%edi
+  803322:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  803329:	ff ff ff 
+  80332c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803330:	ff d0                	call   *%rax
+  803332:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803335:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803339:	78 28                	js     803363 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80333b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80333f:	8b 00                	mov    (%rax),%eax
+  803341:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803345:	48 89 d6             	mov    %rdx,%rsi
+  803348:	89 c7                	mov    %eax,%edi
+  80334a:	48 b8 03 ac ff ff ff 	movabs $0xffffffffffffac03,%rax
+  803351:	ff ff ff 
+  803354:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803358:	ff d0                	call   *%rax
+  80335a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80335d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803361:	79 08                	jns    80336b <ftruncate+0x7a>
+		return r;
+  803363:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803366:	e9 83 00 00 00       	jmp    8033ee <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80336b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80336f:	8b 40 08             	mov    0x8(%rax),%eax
+  803372:	83 e0 03             	and    $0x3,%eax
+  803375:	85 c0                	test   %eax,%eax
+  803377:	75 4b                	jne    8033c4 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803379:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803380:	ff ff ff 
+  803383:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803387:	48 8b 00             	mov    (%rax),%rax
+  80338a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803390:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803393:	89 c6                	mov    %eax,%esi
+  803395:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  80339c:	ff ff ff 
+  80339f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033a3:	48 89 c7             	mov    %rax,%rdi
+  8033a6:	49 89 df             	mov    %rbx,%r15
+  8033a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ae:	48 b9 84 85 ff ff ff 	movabs $0xffffffffffff8584,%rcx
+  8033b5:	ff ff ff 
+  8033b8:	48 01 d9             	add    %rbx,%rcx
+  8033bb:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8033bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c2:	eb 2a                	jmp    8033ee <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8033c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033c8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8033cc:	48 85 c0             	test   %rax,%rax
+  8033cf:	75 07                	jne    8033d8 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8033d1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8033d6:	eb 16                	jmp    8033ee <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8033d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033dc:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8033e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033e4:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8033e7:	89 d6                	mov    %edx,%esi
+  8033e9:	48 89 c7             	mov    %rax,%rdi
+  8033ec:	ff d1                	call   *%rcx
+}
+  8033ee:	48 83 c4 30          	add    $0x30,%rsp
+  8033f2:	5b                   	pop    %rbx
+  8033f3:	41 5f                	pop    %r15
+  8033f5:	5d                   	pop    %rbp
+  8033f6:	c3                   	ret
+
+00000000008033f7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8033f7:	55                   	push   %rbp
+  8033f8:	48 89 e5             	mov    %rsp,%rbp
+  8033fb:	53                   	push   %rbx
+  8033fc:	48 83 ec 38          	sub    $0x38,%rsp
+  803400:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803400 <fstat+0x9>
+  803407:	49 bb 38 4c 00 00 00 	movabs $0x4c38,%r11
+  80340e:	00 00 00 
+  803411:	4c 01 db             	add    %r11,%rbx
+  803414:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803417:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80341b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80341f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803422:	48 89 d6             	mov    %rdx,%rsi
+  803425:	89 c7                	mov    %eax,%edi
+  803427:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  80342e:	ff ff ff 
+  803431:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803435:	ff d0                	call   *%rax
+  803437:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80343a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80343e:	78 28                	js     803468 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803440:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803444:	8b 00                	mov    (%rax),%eax
+  803446:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80344a:	48 89 d6             	mov    %rdx,%rsi
+  80344d:	89 c7                	mov    %eax,%edi
+  80344f:	48 b8 03 ac ff ff ff 	movabs $0xffffffffffffac03,%rax
+  803456:	ff ff ff 
+  803459:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80345d:	ff d0                	call   *%rax
+  80345f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803462:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803466:	79 05                	jns    80346d <fstat+0x76>
+		return r;
+  803468:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80346b:	eb 5e                	jmp    8034cb <fstat+0xd4>
+	if (!dev->dev_stat)
+  80346d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803471:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803475:	48 85 c0             	test   %rax,%rax
+  803478:	75 07                	jne    803481 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80347a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80347f:	eb 4a                	jmp    8034cb <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803481:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803485:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803488:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80348c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803493:	00 00 00 
+	stat->st_isdir = 0;
+  803496:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80349a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8034a1:	00 00 00 
+	stat->st_dev = dev;
+  8034a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034a8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034ac:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8034b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034b7:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8034bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034c3:	48 89 d6             	mov    %rdx,%rsi
+  8034c6:	48 89 c7             	mov    %rax,%rdi
+  8034c9:	ff d1                	call   *%rcx
+}
+  8034cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034cf:	c9                   	leave
+  8034d0:	c3                   	ret
+
+00000000008034d1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8034d1:	55                   	push   %rbp
+  8034d2:	48 89 e5             	mov    %rsp,%rbp
+  8034d5:	41 57                	push   %r15
+  8034d7:	53                   	push   %rbx
+  8034d8:	48 83 ec 20          	sub    $0x20,%rsp
+  8034dc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034dc <stat+0xb>
+  8034e3:	49 bb 5c 4b 00 00 00 	movabs $0x4b5c,%r11
+  8034ea:	00 00 00 
+  8034ed:	4c 01 db             	add    %r11,%rbx
+  8034f0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8034f4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8034f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034fc:	be 00 00 00 00       	mov    $0x0,%esi
+  803501:	48 89 c7             	mov    %rax,%rdi
+  803504:	49 89 df             	mov    %rbx,%r15
+  803507:	48 b8 73 b7 ff ff ff 	movabs $0xffffffffffffb773,%rax
+  80350e:	ff ff ff 
+  803511:	48 01 d8             	add    %rbx,%rax
+  803514:	ff d0                	call   *%rax
+  803516:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803519:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80351d:	79 05                	jns    803524 <stat+0x53>
+		return fd;
+  80351f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803522:	eb 37                	jmp    80355b <stat+0x8a>
+	r = fstat(fd, stat);
+  803524:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803528:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80352b:	48 89 d6             	mov    %rdx,%rsi
+  80352e:	89 c7                	mov    %eax,%edi
+  803530:	48 b8 bf b3 ff ff ff 	movabs $0xffffffffffffb3bf,%rax
+  803537:	ff ff ff 
+  80353a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80353e:	ff d0                	call   *%rax
+  803540:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803543:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803546:	89 c7                	mov    %eax,%edi
+  803548:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  80354f:	ff ff ff 
+  803552:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803556:	ff d0                	call   *%rax
+	return r;
+  803558:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  80355b:	48 83 c4 20          	add    $0x20,%rsp
+  80355f:	5b                   	pop    %rbx
+  803560:	41 5f                	pop    %r15
+  803562:	5d                   	pop    %rbp
+  803563:	c3                   	ret
+
+0000000000803564 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803564:	55                   	push   %rbp
+  803565:	48 89 e5             	mov    %rsp,%rbp
+  803568:	41 57                	push   %r15
+  80356a:	53                   	push   %rbx
+  80356b:	48 83 ec 10          	sub    $0x10,%rsp
+  80356f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80356f <fsipc+0xb>
+  803576:	49 bb c9 4a 00 00 00 	movabs $0x4ac9,%r11
+  80357d:	00 00 00 
+  803580:	4c 01 db             	add    %r11,%rbx
+  803583:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803586:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80358a:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803591:	00 00 00 
+  803594:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803597:	85 c0                	test   %eax,%eax
+  803599:	75 24                	jne    8035bf <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80359b:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035a0:	49 89 df             	mov    %rbx,%r15
+  8035a3:	48 b8 73 df ff ff ff 	movabs $0xffffffffffffdf73,%rax
+  8035aa:	ff ff ff 
+  8035ad:	48 01 d8             	add    %rbx,%rax
+  8035b0:	ff d0                	call   *%rax
+  8035b2:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  8035b9:	00 00 00 
+  8035bc:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8035bf:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8035c6:	00 00 00 
+  8035c9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8035cc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035d0:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8035d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8035d9:	49 89 d0             	mov    %rdx,%r8
+  8035dc:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8035e1:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  8035e8:	00 00 00 
+  8035eb:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8035ef:	89 c7                	mov    %eax,%edi
+  8035f1:	49 89 df             	mov    %rbx,%r15
+  8035f4:	48 b8 92 d9 ff ff ff 	movabs $0xffffffffffffd992,%rax
+  8035fb:	ff ff ff 
+  8035fe:	48 01 d8             	add    %rbx,%rax
+  803601:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803603:	48 83 c4 10          	add    $0x10,%rsp
+  803607:	5b                   	pop    %rbx
+  803608:	41 5f                	pop    %r15
+  80360a:	5d                   	pop    %rbp
+  80360b:	c3                   	ret
+
+000000000080360c <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  80360c:	55                   	push   %rbp
+  80360d:	48 89 e5             	mov    %rsp,%rbp
+  803610:	41 57                	push   %r15
+  803612:	53                   	push   %rbx
+  803613:	48 83 ec 20          	sub    $0x20,%rsp
+  803617:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803617 <fsipc_words+0xb>
+  80361e:	49 bb 21 4a 00 00 00 	movabs $0x4a21,%r11
+  803625:	00 00 00 
+  803628:	4c 01 db             	add    %r11,%rbx
+  80362b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80362e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803632:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803636:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80363d:	00 00 00 
+  803640:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803643:	85 c0                	test   %eax,%eax
+  803645:	75 24                	jne    80366b <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803647:	bf 01 00 00 00       	mov    $0x1,%edi
+  80364c:	49 89 df             	mov    %rbx,%r15
+  80364f:	48 b8 73 df ff ff ff 	movabs $0xffffffffffffdf73,%rax
+  803656:	ff ff ff 
+  803659:	48 01 d8             	add    %rbx,%rax
+  80365c:	ff d0                	call   *%rax
+  80365e:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  803665:	00 00 00 
+  803668:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  80366b:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803672:	00 00 00 
+  803675:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803678:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80367c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803680:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803683:	89 c7                	mov    %eax,%edi
+  803685:	49 89 df             	mov    %rbx,%r15
+  803688:	48 b8 7d da ff ff ff 	movabs $0xffffffffffffda7d,%rax
+  80368f:	ff ff ff 
+  803692:	48 01 d8             	add    %rbx,%rax
+  803695:	ff d0                	call   *%rax
+}
+  803697:	48 83 c4 20          	add    $0x20,%rsp
+  80369b:	5b                   	pop    %rbx
+  80369c:	41 5f                	pop    %r15
+  80369e:	5d                   	pop    %rbp
+  80369f:	c3                   	ret
+
+00000000008036a0 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8036a0:	55                   	push   %rbp
+  8036a1:	48 89 e5             	mov    %rsp,%rbp
+  8036a4:	41 57                	push   %r15
+  8036a6:	53                   	push   %rbx
+  8036a7:	48 83 ec 40          	sub    $0x40,%rsp
+  8036ab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036ab <fsipc_pages+0xb>
+  8036b2:	49 bb 8d 49 00 00 00 	movabs $0x498d,%r11
+  8036b9:	00 00 00 
+  8036bc:	4c 01 db             	add    %r11,%rbx
+  8036bf:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8036c2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8036c6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8036ca:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8036cd:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8036d4:	00 00 00 
+  8036d7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036da:	85 c0                	test   %eax,%eax
+  8036dc:	75 24                	jne    803702 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036de:	bf 01 00 00 00       	mov    $0x1,%edi
+  8036e3:	49 89 df             	mov    %rbx,%r15
+  8036e6:	48 b8 73 df ff ff ff 	movabs $0xffffffffffffdf73,%rax
+  8036ed:	ff ff ff 
+  8036f0:	48 01 d8             	add    %rbx,%rax
+  8036f3:	ff d0                	call   *%rax
+  8036f5:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  8036fc:	00 00 00 
+  8036ff:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803702:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803707:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  80370b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80370e:	48 98                	cltq
+  803710:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  803714:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803718:	0f 95 c0             	setne  %al
+  80371b:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  80371e:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803725:	00 
+  803726:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80372a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80372e:	48 01 d0             	add    %rdx,%rax
+  803731:	48 83 e8 01          	sub    $0x1,%rax
+  803735:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803739:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80373d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803742:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803746:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80374a:	48 29 d0             	sub    %rdx,%rax
+  80374d:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803751:	41 89 c2             	mov    %eax,%r10d
+  803754:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80375b:	00 00 00 
+  80375e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803761:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  803765:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803769:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80376c:	48 83 ec 08          	sub    $0x8,%rsp
+  803770:	6a 40                	push   $0x40
+  803772:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803777:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  80377e:	00 
+  80377f:	6a 05                	push   $0x5
+  803781:	41 89 f9             	mov    %edi,%r9d
+  803784:	49 89 c8             	mov    %rcx,%r8
+  803787:	44 89 d1             	mov    %r10d,%ecx
+  80378a:	89 c7                	mov    %eax,%edi
+  80378c:	49 89 df             	mov    %rbx,%r15
+  80378f:	48 b8 7b db ff ff ff 	movabs $0xffffffffffffdb7b,%rax
+  803796:	ff ff ff 
+  803799:	48 01 d8             	add    %rbx,%rax
+  80379c:	ff d0                	call   *%rax
+  80379e:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8037a2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8037a6:	5b                   	pop    %rbx
+  8037a7:	41 5f                	pop    %r15
+  8037a9:	5d                   	pop    %rbp
+  8037aa:	c3                   	ret
+
+00000000008037ab <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8037ab:	55                   	push   %rbp
+  8037ac:	48 89 e5             	mov    %rsp,%rbp
+  8037af:	41 57                	push   %r15
+  8037b1:	53                   	push   %rbx
+  8037b2:	48 83 ec 20          	sub    $0x20,%rsp
+  8037b6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037b6 <open+0xb>
+  8037bd:	49 bb 82 48 00 00 00 	movabs $0x4882,%r11
+  8037c4:	00 00 00 
+  8037c7:	4c 01 db             	add    %r11,%rbx
+  8037ca:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8037ce:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8037d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037d5:	48 89 c7             	mov    %rax,%rdi
+  8037d8:	49 89 df             	mov    %rbx,%r15
+  8037db:	48 b8 b2 92 ff ff ff 	movabs $0xffffffffffff92b2,%rax
+  8037e2:	ff ff ff 
+  8037e5:	48 01 d8             	add    %rbx,%rax
+  8037e8:	ff d0                	call   *%rax
+  8037ea:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8037ef:	7e 0a                	jle    8037fb <open+0x50>
+		return -E_BAD_PATH;
+  8037f1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8037f6:	e9 18 01 00 00       	jmp    803913 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8037fb:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8037ff:	48 89 c7             	mov    %rax,%rdi
+  803802:	49 89 df             	mov    %rbx,%r15
+  803805:	48 b8 a7 a9 ff ff ff 	movabs $0xffffffffffffa9a7,%rax
+  80380c:	ff ff ff 
+  80380f:	48 01 d8             	add    %rbx,%rax
+  803812:	ff d0                	call   *%rax
+  803814:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803817:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80381b:	74 08                	je     803825 <open+0x7a>
+		return r;
+  80381d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803820:	e9 ee 00 00 00       	jmp    803913 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  803825:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  80382c:	00 00 00 
+  80382f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803832:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  803839:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80383d:	48 89 c6             	mov    %rax,%rsi
+  803840:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803847:	00 00 00 
+  80384a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80384e:	48 89 c7             	mov    %rax,%rdi
+  803851:	49 89 df             	mov    %rbx,%r15
+  803854:	48 b8 46 93 ff ff ff 	movabs $0xffffffffffff9346,%rax
+  80385b:	ff ff ff 
+  80385e:	48 01 d8             	add    %rbx,%rax
+  803861:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803863:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803867:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  80386c:	48 89 c6             	mov    %rax,%rsi
+  80386f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803874:	49 89 df             	mov    %rbx,%r15
+  803877:	48 b8 02 a0 ff ff ff 	movabs $0xffffffffffffa002,%rax
+  80387e:	ff ff ff 
+  803881:	48 01 d8             	add    %rbx,%rax
+  803884:	ff d0                	call   *%rax
+  803886:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803889:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80388d:	74 23                	je     8038b2 <open+0x107>
+		fd_close(fd,0);
+  80388f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803893:	be 00 00 00 00       	mov    $0x0,%esi
+  803898:	48 89 c7             	mov    %rax,%rdi
+  80389b:	49 89 df             	mov    %rbx,%r15
+  80389e:	48 b8 08 ab ff ff ff 	movabs $0xffffffffffffab08,%rax
+  8038a5:	ff ff ff 
+  8038a8:	48 01 d8             	add    %rbx,%rax
+  8038ab:	ff d0                	call   *%rax
+		return r;
+  8038ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038b0:	eb 61                	jmp    803913 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8038b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038b6:	48 89 c6             	mov    %rax,%rsi
+  8038b9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8038be:	48 b8 2c b5 ff ff ff 	movabs $0xffffffffffffb52c,%rax
+  8038c5:	ff ff ff 
+  8038c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038cc:	ff d0                	call   *%rax
+  8038ce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038d1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038d5:	74 23                	je     8038fa <open+0x14f>
+		fd_close(fd,0);
+  8038d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038db:	be 00 00 00 00       	mov    $0x0,%esi
+  8038e0:	48 89 c7             	mov    %rax,%rdi
+  8038e3:	49 89 df             	mov    %rbx,%r15
+  8038e6:	48 b8 08 ab ff ff ff 	movabs $0xffffffffffffab08,%rax
+  8038ed:	ff ff ff 
+  8038f0:	48 01 d8             	add    %rbx,%rax
+  8038f3:	ff d0                	call   *%rax
+		return r;
+  8038f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038f8:	eb 19                	jmp    803913 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8038fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038fe:	48 89 c7             	mov    %rax,%rdi
+  803901:	49 89 df             	mov    %rbx,%r15
+  803904:	48 b8 2d a9 ff ff ff 	movabs $0xffffffffffffa92d,%rax
+  80390b:	ff ff ff 
+  80390e:	48 01 d8             	add    %rbx,%rax
+  803911:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  803913:	48 83 c4 20          	add    $0x20,%rsp
+  803917:	5b                   	pop    %rbx
+  803918:	41 5f                	pop    %r15
+  80391a:	5d                   	pop    %rbp
+  80391b:	c3                   	ret
+
+000000000080391c <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  80391c:	55                   	push   %rbp
+  80391d:	48 89 e5             	mov    %rsp,%rbp
+  803920:	48 83 ec 20          	sub    $0x20,%rsp
+  803924:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803924 <devfile_flush+0x8>
+  80392b:	49 bb 14 47 00 00 00 	movabs $0x4714,%r11
+  803932:	00 00 00 
+  803935:	4c 01 d8             	add    %r11,%rax
+  803938:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  80393c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803940:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803943:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803946:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80394a:	ba 04 00 00 00       	mov    $0x4,%edx
+  80394f:	48 89 ce             	mov    %rcx,%rsi
+  803952:	bf 06 00 00 00       	mov    $0x6,%edi
+  803957:	48 b9 d4 b5 ff ff ff 	movabs $0xffffffffffffb5d4,%rcx
+  80395e:	ff ff ff 
+  803961:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803965:	ff d0                	call   *%rax
+}
+  803967:	c9                   	leave
+  803968:	c3                   	ret
+
+0000000000803969 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803969:	55                   	push   %rbp
+  80396a:	48 89 e5             	mov    %rsp,%rbp
+  80396d:	41 57                	push   %r15
+  80396f:	53                   	push   %rbx
+  803970:	48 83 ec 60          	sub    $0x60,%rsp
+  803974:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803974 <devfile_read+0xb>
+  80397b:	49 bb c4 46 00 00 00 	movabs $0x46c4,%r11
+  803982:	00 00 00 
+  803985:	4c 01 db             	add    %r11,%rbx
+  803988:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80398c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803990:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  803994:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803998:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  80399c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8039a0:	8b 50 0c             	mov    0xc(%rax),%edx
+  8039a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039a7:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8039a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039ad:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8039b1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8039b5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8039b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8039be:	ba 10 00 00 00       	mov    $0x10,%edx
+  8039c3:	48 89 c6             	mov    %rax,%rsi
+  8039c6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039cb:	48 b8 68 b6 ff ff ff 	movabs $0xffffffffffffb668,%rax
+  8039d2:	ff ff ff 
+  8039d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039d9:	ff d0                	call   *%rax
+  8039db:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8039de:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8039e2:	79 05                	jns    8039e9 <devfile_read+0x80>
+		return r;
+  8039e4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8039e7:	eb 64                	jmp    803a4d <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8039e9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8039ec:	48 63 d0             	movslq %eax,%rdx
+  8039ef:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039f3:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8039f8:	48 01 c1             	add    %rax,%rcx
+  8039fb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8039ff:	48 89 ce             	mov    %rcx,%rsi
+  803a02:	48 89 c7             	mov    %rax,%rdi
+  803a05:	49 89 df             	mov    %rbx,%r15
+  803a08:	48 b8 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rax
+  803a0f:	ff ff ff 
+  803a12:	48 01 d8             	add    %rbx,%rax
+  803a15:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803a17:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803a1e:	ff ff ff 
+  803a21:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a25:	48 8b 00             	mov    (%rax),%rax
+  803a28:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803a2e:	89 c6                	mov    %eax,%esi
+  803a30:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803a35:	48 89 c7             	mov    %rax,%rdi
+  803a38:	49 89 df             	mov    %rbx,%r15
+  803a3b:	48 b8 2d df ff ff ff 	movabs $0xffffffffffffdf2d,%rax
+  803a42:	ff ff ff 
+  803a45:	48 01 d8             	add    %rbx,%rax
+  803a48:	ff d0                	call   *%rax
+	return r;
+  803a4a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803a4d:	48 83 c4 60          	add    $0x60,%rsp
+  803a51:	5b                   	pop    %rbx
+  803a52:	41 5f                	pop    %r15
+  803a54:	5d                   	pop    %rbp
+  803a55:	c3                   	ret
+
+0000000000803a56 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803a56:	55                   	push   %rbp
+  803a57:	48 89 e5             	mov    %rsp,%rbp
+  803a5a:	41 57                	push   %r15
+  803a5c:	53                   	push   %rbx
+  803a5d:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803a61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a61 <devfile_write+0xb>
+  803a68:	49 bb d7 45 00 00 00 	movabs $0x45d7,%r11
+  803a6f:	00 00 00 
+  803a72:	4c 01 db             	add    %r11,%rbx
+  803a75:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803a79:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803a7d:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803a84:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803a88:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803a8c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803a93:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803a97:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803a9e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803aa1:	48 63 d0             	movslq %eax,%rdx
+  803aa4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803aa8:	48 39 c2             	cmp    %rax,%rdx
+  803aab:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803aaf:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803ab6:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803abd:	00 
+  803abe:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803ac5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ac9:	48 01 d0             	add    %rdx,%rax
+  803acc:	48 83 e8 01          	sub    $0x1,%rax
+  803ad0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803ad4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ad8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803add:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803ae1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ae5:	48 29 d0             	sub    %rdx,%rax
+  803ae8:	48 c1 e8 0c          	shr    $0xc,%rax
+  803aec:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803aef:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803af2:	89 c6                	mov    %eax,%esi
+  803af4:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803af9:	48 89 c7             	mov    %rax,%rdi
+  803afc:	49 89 df             	mov    %rbx,%r15
+  803aff:	48 b8 e7 de ff ff ff 	movabs $0xffffffffffffdee7,%rax
+  803b06:	ff ff ff 
+  803b09:	48 01 d8             	add    %rbx,%rax
+  803b0c:	ff d0                	call   *%rax
+  803b0e:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803b11:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803b15:	79 08                	jns    803b1f <devfile_write+0xc9>
+		return r;
+  803b17:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803b1a:	e9 8f 00 00 00       	jmp    803bae <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803b1f:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b26:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803b2a:	48 89 c6             	mov    %rax,%rsi
+  803b2d:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b32:	48 89 c7             	mov    %rax,%rdi
+  803b35:	49 89 df             	mov    %rbx,%r15
+  803b38:	48 b8 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rax
+  803b3f:	ff ff ff 
+  803b42:	48 01 d8             	add    %rbx,%rax
+  803b45:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803b47:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803b4b:	8b 50 0c             	mov    0xc(%rax),%edx
+  803b4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b52:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803b54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b58:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b5f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803b63:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803b66:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803b6a:	89 d1                	mov    %edx,%ecx
+  803b6c:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b71:	48 89 c6             	mov    %rax,%rsi
+  803b74:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b79:	48 b8 68 b6 ff ff ff 	movabs $0xffffffffffffb668,%rax
+  803b80:	ff ff ff 
+  803b83:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b87:	ff d0                	call   *%rax
+  803b89:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803b8c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803b8f:	89 c6                	mov    %eax,%esi
+  803b91:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b96:	48 89 c7             	mov    %rax,%rdi
+  803b99:	49 89 df             	mov    %rbx,%r15
+  803b9c:	48 b8 2d df ff ff ff 	movabs $0xffffffffffffdf2d,%rax
+  803ba3:	ff ff ff 
+  803ba6:	48 01 d8             	add    %rbx,%rax
+  803ba9:	ff d0                	call   *%rax
+	return r;
+  803bab:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803bae:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803bb2:	5b                   	pop    %rbx
+  803bb3:	41 5f                	pop    %r15
+  803bb5:	5d                   	pop    %rbp
+  803bb6:	c3                   	ret
+
+0000000000803bb7 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803bb7:	55                   	push   %rbp
+  803bb8:	48 89 e5             	mov    %rsp,%rbp
+  803bbb:	41 57                	push   %r15
+  803bbd:	53                   	push   %rbx
+  803bbe:	48 83 ec 20          	sub    $0x20,%rsp
+  803bc2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bc2 <devfile_stat+0xb>
+  803bc9:	49 bb 76 44 00 00 00 	movabs $0x4476,%r11
+  803bd0:	00 00 00 
+  803bd3:	4c 01 db             	add    %r11,%rbx
+  803bd6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803bda:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803bde:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803be2:	8b 40 0c             	mov    0xc(%rax),%eax
+  803be5:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803bec:	00 00 00 
+  803bef:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803bf2:	be 00 00 00 00       	mov    $0x0,%esi
+  803bf7:	bf 05 00 00 00       	mov    $0x5,%edi
+  803bfc:	48 b8 2c b5 ff ff ff 	movabs $0xffffffffffffb52c,%rax
+  803c03:	ff ff ff 
+  803c06:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c0a:	ff d0                	call   *%rax
+  803c0c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c0f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c13:	79 05                	jns    803c1a <devfile_stat+0x63>
+		return r;
+  803c15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c18:	eb 65                	jmp    803c7f <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c1a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c1e:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803c25:	00 00 00 
+  803c28:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803c2c:	48 89 d6             	mov    %rdx,%rsi
+  803c2f:	48 89 c7             	mov    %rax,%rdi
+  803c32:	49 89 df             	mov    %rbx,%r15
+  803c35:	48 b8 46 93 ff ff ff 	movabs $0xffffffffffff9346,%rax
+  803c3c:	ff ff ff 
+  803c3f:	48 01 d8             	add    %rbx,%rax
+  803c42:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803c44:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803c4b:	00 00 00 
+  803c4e:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803c55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c59:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c5f:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803c66:	00 00 00 
+  803c69:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803c70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c74:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c7f:	48 83 c4 20          	add    $0x20,%rsp
+  803c83:	5b                   	pop    %rbx
+  803c84:	41 5f                	pop    %r15
+  803c86:	5d                   	pop    %rbp
+  803c87:	c3                   	ret
+
+0000000000803c88 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803c88:	55                   	push   %rbp
+  803c89:	48 89 e5             	mov    %rsp,%rbp
+  803c8c:	48 83 ec 20          	sub    $0x20,%rsp
+  803c90:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c90 <devfile_trunc+0x8>
+  803c97:	49 bb a8 43 00 00 00 	movabs $0x43a8,%r11
+  803c9e:	00 00 00 
+  803ca1:	4c 01 d8             	add    %r11,%rax
+  803ca4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803ca8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803cab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803caf:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803cb2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803cb5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803cb8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803cbb:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803cbf:	ba 08 00 00 00       	mov    $0x8,%edx
+  803cc4:	48 89 ce             	mov    %rcx,%rsi
+  803cc7:	bf 02 00 00 00       	mov    $0x2,%edi
+  803ccc:	48 b9 d4 b5 ff ff ff 	movabs $0xffffffffffffb5d4,%rcx
+  803cd3:	ff ff ff 
+  803cd6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803cda:	ff d0                	call   *%rax
+}
+  803cdc:	c9                   	leave
+  803cdd:	c3                   	ret
+
+0000000000803cde <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803cde:	55                   	push   %rbp
+  803cdf:	48 89 e5             	mov    %rsp,%rbp
+  803ce2:	41 57                	push   %r15
+  803ce4:	53                   	push   %rbx
+  803ce5:	48 83 ec 10          	sub    $0x10,%rsp
+  803ce9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ce9 <remove+0xb>
+  803cf0:	49 bb 4f 43 00 00 00 	movabs $0x434f,%r11
+  803cf7:	00 00 00 
+  803cfa:	4c 01 db             	add    %r11,%rbx
+  803cfd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803d01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d05:	48 89 c7             	mov    %rax,%rdi
+  803d08:	49 89 df             	mov    %rbx,%r15
+  803d0b:	48 b8 b2 92 ff ff ff 	movabs $0xffffffffffff92b2,%rax
+  803d12:	ff ff ff 
+  803d15:	48 01 d8             	add    %rbx,%rax
+  803d18:	ff d0                	call   *%rax
+  803d1a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803d1f:	7e 07                	jle    803d28 <remove+0x4a>
+		return -E_BAD_PATH;
+  803d21:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803d26:	eb 44                	jmp    803d6c <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803d28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d2c:	48 89 c6             	mov    %rax,%rsi
+  803d2f:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803d36:	00 00 00 
+  803d39:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d3d:	48 89 c7             	mov    %rax,%rdi
+  803d40:	49 89 df             	mov    %rbx,%r15
+  803d43:	48 b8 46 93 ff ff ff 	movabs $0xffffffffffff9346,%rax
+  803d4a:	ff ff ff 
+  803d4d:	48 01 d8             	add    %rbx,%rax
+  803d50:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803d52:	be 00 00 00 00       	mov    $0x0,%esi
+  803d57:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d5c:	48 b8 2c b5 ff ff ff 	movabs $0xffffffffffffb52c,%rax
+  803d63:	ff ff ff 
+  803d66:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d6a:	ff d0                	call   *%rax
+}
+  803d6c:	48 83 c4 10          	add    $0x10,%rsp
+  803d70:	5b                   	pop    %rbx
+  803d71:	41 5f                	pop    %r15
+  803d73:	5d                   	pop    %rbp
+  803d74:	c3                   	ret
+
+0000000000803d75 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803d75:	55                   	push   %rbp
+  803d76:	48 89 e5             	mov    %rsp,%rbp
+  803d79:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d79 <sync+0x4>
+  803d80:	49 bb bf 42 00 00 00 	movabs $0x42bf,%r11
+  803d87:	00 00 00 
+  803d8a:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d92:	be 00 00 00 00       	mov    $0x0,%esi
+  803d97:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d9c:	48 b9 d4 b5 ff ff ff 	movabs $0xffffffffffffb5d4,%rcx
+  803da3:	ff ff ff 
+  803da6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803daa:	ff d0                	call   *%rax
+}
+  803dac:	5d                   	pop    %rbp
+  803dad:	c3                   	ret
+
+0000000000803dae <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803dae:	55                   	push   %rbp
+  803daf:	48 89 e5             	mov    %rsp,%rbp
+  803db2:	41 57                	push   %r15
+  803db4:	53                   	push   %rbx
+  803db5:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803dbc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803dbc <copy+0xe>
+  803dc3:	49 bb 7c 42 00 00 00 	movabs $0x427c,%r11
+  803dca:	00 00 00 
+  803dcd:	4c 01 db             	add    %r11,%rbx
+  803dd0:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803dd7:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803dde:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803de5:	be 00 00 00 00       	mov    $0x0,%esi
+  803dea:	48 89 c7             	mov    %rax,%rdi
+  803ded:	48 b8 73 b7 ff ff ff 	movabs $0xffffffffffffb773,%rax
+  803df4:	ff ff ff 
+  803df7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dfb:	ff d0                	call   *%rax
+  803dfd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803e00:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e04:	79 35                	jns    803e3b <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803e06:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e09:	89 c6                	mov    %eax,%esi
+  803e0b:	48 b8 5e e6 ff ff ff 	movabs $0xffffffffffffe65e,%rax
+  803e12:	ff ff ff 
+  803e15:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e19:	48 89 c7             	mov    %rax,%rdi
+  803e1c:	49 89 df             	mov    %rbx,%r15
+  803e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e24:	48 ba 84 85 ff ff ff 	movabs $0xffffffffffff8584,%rdx
+  803e2b:	ff ff ff 
+  803e2e:	48 01 da             	add    %rbx,%rdx
+  803e31:	ff d2                	call   *%rdx
+		return fd_src;
+  803e33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e36:	e9 d7 01 00 00       	jmp    804012 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803e3b:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803e42:	be 01 01 00 00       	mov    $0x101,%esi
+  803e47:	48 89 c7             	mov    %rax,%rdi
+  803e4a:	48 b8 73 b7 ff ff ff 	movabs $0xffffffffffffb773,%rax
+  803e51:	ff ff ff 
+  803e54:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e58:	ff d0                	call   *%rax
+  803e5a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803e5d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803e61:	0f 89 df 00 00 00    	jns    803f46 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803e67:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e6a:	89 c6                	mov    %eax,%esi
+  803e6c:	48 b8 74 e6 ff ff ff 	movabs $0xffffffffffffe674,%rax
+  803e73:	ff ff ff 
+  803e76:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e7a:	48 89 c7             	mov    %rax,%rdi
+  803e7d:	49 89 df             	mov    %rbx,%r15
+  803e80:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e85:	48 ba 84 85 ff ff ff 	movabs $0xffffffffffff8584,%rdx
+  803e8c:	ff ff ff 
+  803e8f:	48 01 da             	add    %rbx,%rdx
+  803e92:	ff d2                	call   *%rdx
+		close(fd_src);
+  803e94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e97:	89 c7                	mov    %eax,%edi
+  803e99:	49 89 df             	mov    %rbx,%r15
+  803e9c:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  803ea3:	ff ff ff 
+  803ea6:	48 01 d8             	add    %rbx,%rax
+  803ea9:	ff d0                	call   *%rax
+		return fd_dest;
+  803eab:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803eae:	e9 5f 01 00 00       	jmp    804012 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803eb3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803eb6:	48 63 d0             	movslq %eax,%rdx
+  803eb9:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803ec0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ec3:	48 89 ce             	mov    %rcx,%rsi
+  803ec6:	89 c7                	mov    %eax,%edi
+  803ec8:	49 89 df             	mov    %rbx,%r15
+  803ecb:	48 b8 4a b1 ff ff ff 	movabs $0xffffffffffffb14a,%rax
+  803ed2:	ff ff ff 
+  803ed5:	48 01 d8             	add    %rbx,%rax
+  803ed8:	ff d0                	call   *%rax
+  803eda:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803edd:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803ee1:	79 63                	jns    803f46 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803ee3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803ee6:	89 c6                	mov    %eax,%esi
+  803ee8:	48 b8 8e e6 ff ff ff 	movabs $0xffffffffffffe68e,%rax
+  803eef:	ff ff ff 
+  803ef2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ef6:	48 89 c7             	mov    %rax,%rdi
+  803ef9:	49 89 df             	mov    %rbx,%r15
+  803efc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f01:	48 ba 84 85 ff ff ff 	movabs $0xffffffffffff8584,%rdx
+  803f08:	ff ff ff 
+  803f0b:	48 01 da             	add    %rbx,%rdx
+  803f0e:	ff d2                	call   *%rdx
+			close(fd_src);
+  803f10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f13:	89 c7                	mov    %eax,%edi
+  803f15:	49 89 df             	mov    %rbx,%r15
+  803f18:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  803f1f:	ff ff ff 
+  803f22:	48 01 d8             	add    %rbx,%rax
+  803f25:	ff d0                	call   *%rax
+			close(fd_dest);
+  803f27:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f2a:	89 c7                	mov    %eax,%edi
+  803f2c:	49 89 df             	mov    %rbx,%r15
+  803f2f:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  803f36:	ff ff ff 
+  803f39:	48 01 d8             	add    %rbx,%rax
+  803f3c:	ff d0                	call   *%rax
+			return write_size;
+  803f3e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803f41:	e9 cc 00 00 00       	jmp    804012 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803f46:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803f4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f50:	ba 00 02 00 00       	mov    $0x200,%edx
+  803f55:	48 89 ce             	mov    %rcx,%rsi
+  803f58:	89 c7                	mov    %eax,%edi
+  803f5a:	49 89 df             	mov    %rbx,%r15
+  803f5d:	48 b8 a4 af ff ff ff 	movabs $0xffffffffffffafa4,%rax
+  803f64:	ff ff ff 
+  803f67:	48 01 d8             	add    %rbx,%rax
+  803f6a:	ff d0                	call   *%rax
+  803f6c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803f6f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f73:	0f 8f 3a ff ff ff    	jg     803eb3 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803f79:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f7d:	79 60                	jns    803fdf <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803f7f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f82:	89 c6                	mov    %eax,%esi
+  803f84:	48 b8 a1 e6 ff ff ff 	movabs $0xffffffffffffe6a1,%rax
+  803f8b:	ff ff ff 
+  803f8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f92:	48 89 c7             	mov    %rax,%rdi
+  803f95:	49 89 df             	mov    %rbx,%r15
+  803f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f9d:	48 ba 84 85 ff ff ff 	movabs $0xffffffffffff8584,%rdx
+  803fa4:	ff ff ff 
+  803fa7:	48 01 da             	add    %rbx,%rdx
+  803faa:	ff d2                	call   *%rdx
+		close(fd_src);
+  803fac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803faf:	89 c7                	mov    %eax,%edi
+  803fb1:	49 89 df             	mov    %rbx,%r15
+  803fb4:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  803fbb:	ff ff ff 
+  803fbe:	48 01 d8             	add    %rbx,%rax
+  803fc1:	ff d0                	call   *%rax
+		close(fd_dest);
+  803fc3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803fc6:	89 c7                	mov    %eax,%edi
+  803fc8:	49 89 df             	mov    %rbx,%r15
+  803fcb:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  803fd2:	ff ff ff 
+  803fd5:	48 01 d8             	add    %rbx,%rax
+  803fd8:	ff d0                	call   *%rax
+		return read_size;
+  803fda:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fdd:	eb 33                	jmp    804012 <copy+0x264>
+	}
+	close(fd_src);
+  803fdf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fe2:	89 c7                	mov    %eax,%edi
+  803fe4:	49 89 df             	mov    %rbx,%r15
+  803fe7:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  803fee:	ff ff ff 
+  803ff1:	48 01 d8             	add    %rbx,%rax
+  803ff4:	ff d0                	call   *%rax
+	close(fd_dest);
+  803ff6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ff9:	89 c7                	mov    %eax,%edi
+  803ffb:	49 89 df             	mov    %rbx,%r15
+  803ffe:	48 b8 ec ac ff ff ff 	movabs $0xffffffffffffacec,%rax
+  804005:	ff ff ff 
+  804008:	48 01 d8             	add    %rbx,%rax
+  80400b:	ff d0                	call   *%rax
+	return 0;
+  80400d:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804012:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804019:	5b                   	pop    %rbx
+  80401a:	41 5f                	pop    %r15
+  80401c:	5d                   	pop    %rbp
+  80401d:	c3                   	ret
+
+000000000080401e <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  80401e:	55                   	push   %rbp
+  80401f:	48 89 e5             	mov    %rsp,%rbp
+  804022:	41 57                	push   %r15
+  804024:	53                   	push   %rbx
+  804025:	48 83 ec 20          	sub    $0x20,%rsp
+  804029:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804029 <fd2sockid+0xb>
+  804030:	49 bb 0f 40 00 00 00 	movabs $0x400f,%r11
+  804037:	00 00 00 
+  80403a:	4c 01 db             	add    %r11,%rbx
+  80403d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804040:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804044:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804047:	48 89 d6             	mov    %rdx,%rsi
+  80404a:	89 c7                	mov    %eax,%edi
+  80404c:	49 89 df             	mov    %rbx,%r15
+  80404f:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  804056:	ff ff ff 
+  804059:	48 01 d8             	add    %rbx,%rax
+  80405c:	ff d0                	call   *%rax
+  80405e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804061:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804065:	79 05                	jns    80406c <fd2sockid+0x4e>
+		return r;
+  804067:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80406a:	eb 25                	jmp    804091 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80406c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804070:	8b 10                	mov    (%rax),%edx
+  804072:	48 b8 88 00 00 00 00 	movabs $0x88,%rax
+  804079:	00 00 00 
+  80407c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80407f:	39 c2                	cmp    %eax,%edx
+  804081:	74 07                	je     80408a <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804083:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804088:	eb 07                	jmp    804091 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  80408a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80408e:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804091:	48 83 c4 20          	add    $0x20,%rsp
+  804095:	5b                   	pop    %rbx
+  804096:	41 5f                	pop    %r15
+  804098:	5d                   	pop    %rbp
+  804099:	c3                   	ret
+
+000000000080409a <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  80409a:	55                   	push   %rbp
+  80409b:	48 89 e5             	mov    %rsp,%rbp
+  80409e:	41 57                	push   %r15
+  8040a0:	53                   	push   %rbx
+  8040a1:	48 83 ec 20          	sub    $0x20,%rsp
+  8040a5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040a5 <alloc_sockfd+0xb>
+  8040ac:	49 bb 93 3f 00 00 00 	movabs $0x3f93,%r11
+  8040b3:	00 00 00 
+  8040b6:	4c 01 db             	add    %r11,%rbx
+  8040b9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8040bc:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8040c0:	48 89 c7             	mov    %rax,%rdi
+  8040c3:	49 89 df             	mov    %rbx,%r15
+  8040c6:	48 b8 a7 a9 ff ff ff 	movabs $0xffffffffffffa9a7,%rax
+  8040cd:	ff ff ff 
+  8040d0:	48 01 d8             	add    %rbx,%rax
+  8040d3:	ff d0                	call   *%rax
+  8040d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040dc:	78 2c                	js     80410a <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8040de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040e2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8040e7:	48 89 c6             	mov    %rax,%rsi
+  8040ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ef:	49 89 df             	mov    %rbx,%r15
+  8040f2:	48 b8 02 a0 ff ff ff 	movabs $0xffffffffffffa002,%rax
+  8040f9:	ff ff ff 
+  8040fc:	48 01 d8             	add    %rbx,%rax
+  8040ff:	ff d0                	call   *%rax
+  804101:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804104:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804108:	79 1c                	jns    804126 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80410a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80410d:	89 c7                	mov    %eax,%edi
+  80410f:	49 89 df             	mov    %rbx,%r15
+  804112:	48 b8 56 c8 ff ff ff 	movabs $0xffffffffffffc856,%rax
+  804119:	ff ff ff 
+  80411c:	48 01 d8             	add    %rbx,%rax
+  80411f:	ff d0                	call   *%rax
+		return r;
+  804121:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804124:	eb 41                	jmp    804167 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804126:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80412a:	48 ba 88 00 00 00 00 	movabs $0x88,%rdx
+  804131:	00 00 00 
+  804134:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804137:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804139:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80413d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804144:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804148:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80414b:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  80414e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804152:	48 89 c7             	mov    %rax,%rdi
+  804155:	49 89 df             	mov    %rbx,%r15
+  804158:	48 b8 2d a9 ff ff ff 	movabs $0xffffffffffffa92d,%rax
+  80415f:	ff ff ff 
+  804162:	48 01 d8             	add    %rbx,%rax
+  804165:	ff d0                	call   *%rax
+}
+  804167:	48 83 c4 20          	add    $0x20,%rsp
+  80416b:	5b                   	pop    %rbx
+  80416c:	41 5f                	pop    %r15
+  80416e:	5d                   	pop    %rbp
+  80416f:	c3                   	ret
+
+0000000000804170 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804170:	55                   	push   %rbp
+  804171:	48 89 e5             	mov    %rsp,%rbp
+  804174:	41 57                	push   %r15
+  804176:	53                   	push   %rbx
+  804177:	48 83 ec 30          	sub    $0x30,%rsp
+  80417b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80417b <accept+0xb>
+  804182:	49 bb bd 3e 00 00 00 	movabs $0x3ebd,%r11
+  804189:	00 00 00 
+  80418c:	4c 01 db             	add    %r11,%rbx
+  80418f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804192:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804196:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80419a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80419d:	89 c7                	mov    %eax,%edi
+  80419f:	48 b8 e6 bf ff ff ff 	movabs $0xffffffffffffbfe6,%rax
+  8041a6:	ff ff ff 
+  8041a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041ad:	ff d0                	call   *%rax
+  8041af:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041b2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041b6:	79 05                	jns    8041bd <accept+0x4d>
+		return r;
+  8041b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041bb:	eb 45                	jmp    804202 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8041bd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8041c1:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8041c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041c8:	48 89 ce             	mov    %rcx,%rsi
+  8041cb:	89 c7                	mov    %eax,%edi
+  8041cd:	49 89 df             	mov    %rbx,%r15
+  8041d0:	48 b8 c4 c6 ff ff ff 	movabs $0xffffffffffffc6c4,%rax
+  8041d7:	ff ff ff 
+  8041da:	48 01 d8             	add    %rbx,%rax
+  8041dd:	ff d0                	call   *%rax
+  8041df:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041e6:	79 05                	jns    8041ed <accept+0x7d>
+		return r;
+  8041e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041eb:	eb 15                	jmp    804202 <accept+0x92>
+	return alloc_sockfd(r);
+  8041ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041f0:	89 c7                	mov    %eax,%edi
+  8041f2:	48 b8 62 c0 ff ff ff 	movabs $0xffffffffffffc062,%rax
+  8041f9:	ff ff ff 
+  8041fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804200:	ff d0                	call   *%rax
+}
+  804202:	48 83 c4 30          	add    $0x30,%rsp
+  804206:	5b                   	pop    %rbx
+  804207:	41 5f                	pop    %r15
+  804209:	5d                   	pop    %rbp
+  80420a:	c3                   	ret
+
+000000000080420b <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80420b:	55                   	push   %rbp
+  80420c:	48 89 e5             	mov    %rsp,%rbp
+  80420f:	41 57                	push   %r15
+  804211:	53                   	push   %rbx
+  804212:	48 83 ec 20          	sub    $0x20,%rsp
+  804216:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804216 <bind+0xb>
+  80421d:	49 bb 22 3e 00 00 00 	movabs $0x3e22,%r11
+  804224:	00 00 00 
+  804227:	4c 01 db             	add    %r11,%rbx
+  80422a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80422d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804231:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804234:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804237:	89 c7                	mov    %eax,%edi
+  804239:	48 b8 e6 bf ff ff ff 	movabs $0xffffffffffffbfe6,%rax
+  804240:	ff ff ff 
+  804243:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804247:	ff d0                	call   *%rax
+  804249:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80424c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804250:	79 05                	jns    804257 <bind+0x4c>
+		return r;
+  804252:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804255:	eb 21                	jmp    804278 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804257:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80425a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80425e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804261:	48 89 ce             	mov    %rcx,%rsi
+  804264:	89 c7                	mov    %eax,%edi
+  804266:	49 89 df             	mov    %rbx,%r15
+  804269:	48 b8 70 c7 ff ff ff 	movabs $0xffffffffffffc770,%rax
+  804270:	ff ff ff 
+  804273:	48 01 d8             	add    %rbx,%rax
+  804276:	ff d0                	call   *%rax
+}
+  804278:	48 83 c4 20          	add    $0x20,%rsp
+  80427c:	5b                   	pop    %rbx
+  80427d:	41 5f                	pop    %r15
+  80427f:	5d                   	pop    %rbp
+  804280:	c3                   	ret
+
+0000000000804281 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804281:	55                   	push   %rbp
+  804282:	48 89 e5             	mov    %rsp,%rbp
+  804285:	41 57                	push   %r15
+  804287:	53                   	push   %rbx
+  804288:	48 83 ec 20          	sub    $0x20,%rsp
+  80428c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80428c <shutdown+0xb>
+  804293:	49 bb ac 3d 00 00 00 	movabs $0x3dac,%r11
+  80429a:	00 00 00 
+  80429d:	4c 01 db             	add    %r11,%rbx
+  8042a0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8042a3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8042a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8042a9:	89 c7                	mov    %eax,%edi
+  8042ab:	48 b8 e6 bf ff ff ff 	movabs $0xffffffffffffbfe6,%rax
+  8042b2:	ff ff ff 
+  8042b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042b9:	ff d0                	call   *%rax
+  8042bb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042c2:	79 05                	jns    8042c9 <shutdown+0x48>
+		return r;
+  8042c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042c7:	eb 1c                	jmp    8042e5 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8042c9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8042cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042cf:	89 d6                	mov    %edx,%esi
+  8042d1:	89 c7                	mov    %eax,%edi
+  8042d3:	49 89 df             	mov    %rbx,%r15
+  8042d6:	48 b8 05 c8 ff ff ff 	movabs $0xffffffffffffc805,%rax
+  8042dd:	ff ff ff 
+  8042e0:	48 01 d8             	add    %rbx,%rax
+  8042e3:	ff d0                	call   *%rax
+}
+  8042e5:	48 83 c4 20          	add    $0x20,%rsp
+  8042e9:	5b                   	pop    %rbx
+  8042ea:	41 5f                	pop    %r15
+  8042ec:	5d                   	pop    %rbp
+  8042ed:	c3                   	ret
+
+00000000008042ee <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8042ee:	55                   	push   %rbp
+  8042ef:	48 89 e5             	mov    %rsp,%rbp
+  8042f2:	41 57                	push   %r15
+  8042f4:	53                   	push   %rbx
+  8042f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8042f9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042f9 <devsock_close+0xb>
+  804300:	49 bb 3f 3d 00 00 00 	movabs $0x3d3f,%r11
+  804307:	00 00 00 
+  80430a:	4c 01 db             	add    %r11,%rbx
+  80430d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804311:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804315:	48 89 c7             	mov    %rax,%rdi
+  804318:	49 89 df             	mov    %rbx,%r15
+  80431b:	48 b8 02 e0 ff ff ff 	movabs $0xffffffffffffe002,%rax
+  804322:	ff ff ff 
+  804325:	48 01 d8             	add    %rbx,%rax
+  804328:	ff d0                	call   *%rax
+  80432a:	83 f8 01             	cmp    $0x1,%eax
+  80432d:	75 1d                	jne    80434c <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  80432f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804333:	8b 40 0c             	mov    0xc(%rax),%eax
+  804336:	89 c7                	mov    %eax,%edi
+  804338:	49 89 df             	mov    %rbx,%r15
+  80433b:	48 b8 56 c8 ff ff ff 	movabs $0xffffffffffffc856,%rax
+  804342:	ff ff ff 
+  804345:	48 01 d8             	add    %rbx,%rax
+  804348:	ff d0                	call   *%rax
+  80434a:	eb 05                	jmp    804351 <devsock_close+0x63>
+	else
+		return 0;
+  80434c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804351:	48 83 c4 10          	add    $0x10,%rsp
+  804355:	5b                   	pop    %rbx
+  804356:	41 5f                	pop    %r15
+  804358:	5d                   	pop    %rbp
+  804359:	c3                   	ret
+
+000000000080435a <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80435a:	55                   	push   %rbp
+  80435b:	48 89 e5             	mov    %rsp,%rbp
+  80435e:	41 57                	push   %r15
+  804360:	53                   	push   %rbx
+  804361:	48 83 ec 20          	sub    $0x20,%rsp
+  804365:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804365 <connect+0xb>
+  80436c:	49 bb d3 3c 00 00 00 	movabs $0x3cd3,%r11
+  804373:	00 00 00 
+  804376:	4c 01 db             	add    %r11,%rbx
+  804379:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80437c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804380:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804383:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804386:	89 c7                	mov    %eax,%edi
+  804388:	48 b8 e6 bf ff ff ff 	movabs $0xffffffffffffbfe6,%rax
+  80438f:	ff ff ff 
+  804392:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804396:	ff d0                	call   *%rax
+  804398:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80439b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80439f:	79 05                	jns    8043a6 <connect+0x4c>
+		return r;
+  8043a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043a4:	eb 21                	jmp    8043c7 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8043a6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8043a9:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8043ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043b0:	48 89 ce             	mov    %rcx,%rsi
+  8043b3:	89 c7                	mov    %eax,%edi
+  8043b5:	49 89 df             	mov    %rbx,%r15
+  8043b8:	48 b8 9e c8 ff ff ff 	movabs $0xffffffffffffc89e,%rax
+  8043bf:	ff ff ff 
+  8043c2:	48 01 d8             	add    %rbx,%rax
+  8043c5:	ff d0                	call   *%rax
+}
+  8043c7:	48 83 c4 20          	add    $0x20,%rsp
+  8043cb:	5b                   	pop    %rbx
+  8043cc:	41 5f                	pop    %r15
+  8043ce:	5d                   	pop    %rbp
+  8043cf:	c3                   	ret
+
+00000000008043d0 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8043d0:	55                   	push   %rbp
+  8043d1:	48 89 e5             	mov    %rsp,%rbp
+  8043d4:	41 57                	push   %r15
+  8043d6:	53                   	push   %rbx
+  8043d7:	48 83 ec 20          	sub    $0x20,%rsp
+  8043db:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043db <listen+0xb>
+  8043e2:	49 bb 5d 3c 00 00 00 	movabs $0x3c5d,%r11
+  8043e9:	00 00 00 
+  8043ec:	4c 01 db             	add    %r11,%rbx
+  8043ef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8043f2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8043f5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043f8:	89 c7                	mov    %eax,%edi
+  8043fa:	48 b8 e6 bf ff ff ff 	movabs $0xffffffffffffbfe6,%rax
+  804401:	ff ff ff 
+  804404:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804408:	ff d0                	call   *%rax
+  80440a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80440d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804411:	79 05                	jns    804418 <listen+0x48>
+		return r;
+  804413:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804416:	eb 1c                	jmp    804434 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804418:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80441b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80441e:	89 d6                	mov    %edx,%esi
+  804420:	89 c7                	mov    %eax,%edi
+  804422:	49 89 df             	mov    %rbx,%r15
+  804425:	48 b8 33 c9 ff ff ff 	movabs $0xffffffffffffc933,%rax
+  80442c:	ff ff ff 
+  80442f:	48 01 d8             	add    %rbx,%rax
+  804432:	ff d0                	call   *%rax
+}
+  804434:	48 83 c4 20          	add    $0x20,%rsp
+  804438:	5b                   	pop    %rbx
+  804439:	41 5f                	pop    %r15
+  80443b:	5d                   	pop    %rbp
+  80443c:	c3                   	ret
+
+000000000080443d <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  80443d:	55                   	push   %rbp
+  80443e:	48 89 e5             	mov    %rsp,%rbp
+  804441:	41 57                	push   %r15
+  804443:	48 83 ec 28          	sub    $0x28,%rsp
+  804447:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804447 <devsock_read+0xa>
+  80444e:	49 bb f1 3b 00 00 00 	movabs $0x3bf1,%r11
+  804455:	00 00 00 
+  804458:	4c 01 d8             	add    %r11,%rax
+  80445b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80445f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804463:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804467:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80446b:	41 89 d0             	mov    %edx,%r8d
+  80446e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804472:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804475:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804479:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80447e:	44 89 c2             	mov    %r8d,%edx
+  804481:	49 89 c7             	mov    %rax,%r15
+  804484:	49 b8 84 c9 ff ff ff 	movabs $0xffffffffffffc984,%r8
+  80448b:	ff ff ff 
+  80448e:	49 01 c0             	add    %rax,%r8
+  804491:	41 ff d0             	call   *%r8
+}
+  804494:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804498:	c9                   	leave
+  804499:	c3                   	ret
+
+000000000080449a <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80449a:	55                   	push   %rbp
+  80449b:	48 89 e5             	mov    %rsp,%rbp
+  80449e:	41 57                	push   %r15
+  8044a0:	48 83 ec 28          	sub    $0x28,%rsp
+  8044a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044a4 <devsock_write+0xa>
+  8044ab:	49 bb 94 3b 00 00 00 	movabs $0x3b94,%r11
+  8044b2:	00 00 00 
+  8044b5:	4c 01 d8             	add    %r11,%rax
+  8044b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8044bc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8044c0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8044c4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8044c8:	41 89 d0             	mov    %edx,%r8d
+  8044cb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8044cf:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8044d2:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8044d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8044db:	44 89 c2             	mov    %r8d,%edx
+  8044de:	49 89 c7             	mov    %rax,%r15
+  8044e1:	49 b8 a1 ca ff ff ff 	movabs $0xffffffffffffcaa1,%r8
+  8044e8:	ff ff ff 
+  8044eb:	49 01 c0             	add    %rax,%r8
+  8044ee:	41 ff d0             	call   *%r8
+}
+  8044f1:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8044f5:	c9                   	leave
+  8044f6:	c3                   	ret
+
+00000000008044f7 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8044f7:	55                   	push   %rbp
+  8044f8:	48 89 e5             	mov    %rsp,%rbp
+  8044fb:	41 57                	push   %r15
+  8044fd:	48 83 ec 18          	sub    $0x18,%rsp
+  804501:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804501 <devsock_stat+0xa>
+  804508:	49 bb 37 3b 00 00 00 	movabs $0x3b37,%r11
+  80450f:	00 00 00 
+  804512:	4c 01 d8             	add    %r11,%rax
+  804515:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804519:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  80451d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804521:	48 b9 bc e6 ff ff ff 	movabs $0xffffffffffffe6bc,%rcx
+  804528:	ff ff ff 
+  80452b:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80452f:	48 89 ce             	mov    %rcx,%rsi
+  804532:	48 89 d7             	mov    %rdx,%rdi
+  804535:	49 89 c7             	mov    %rax,%r15
+  804538:	48 ba 46 93 ff ff ff 	movabs $0xffffffffffff9346,%rdx
+  80453f:	ff ff ff 
+  804542:	48 01 c2             	add    %rax,%rdx
+  804545:	ff d2                	call   *%rdx
+	return 0;
+  804547:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80454c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804550:	c9                   	leave
+  804551:	c3                   	ret
+
+0000000000804552 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804552:	55                   	push   %rbp
+  804553:	48 89 e5             	mov    %rsp,%rbp
+  804556:	41 57                	push   %r15
+  804558:	53                   	push   %rbx
+  804559:	48 83 ec 20          	sub    $0x20,%rsp
+  80455d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80455d <socket+0xb>
+  804564:	49 bb db 3a 00 00 00 	movabs $0x3adb,%r11
+  80456b:	00 00 00 
+  80456e:	4c 01 db             	add    %r11,%rbx
+  804571:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804574:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804577:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80457a:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80457d:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804580:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804583:	89 ce                	mov    %ecx,%esi
+  804585:	89 c7                	mov    %eax,%edi
+  804587:	49 89 df             	mov    %rbx,%r15
+  80458a:	48 b8 78 cc ff ff ff 	movabs $0xffffffffffffcc78,%rax
+  804591:	ff ff ff 
+  804594:	48 01 d8             	add    %rbx,%rax
+  804597:	ff d0                	call   *%rax
+  804599:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80459c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045a0:	79 05                	jns    8045a7 <socket+0x55>
+		return r;
+  8045a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045a5:	eb 15                	jmp    8045bc <socket+0x6a>
+	return alloc_sockfd(r);
+  8045a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045aa:	89 c7                	mov    %eax,%edi
+  8045ac:	48 b8 62 c0 ff ff ff 	movabs $0xffffffffffffc062,%rax
+  8045b3:	ff ff ff 
+  8045b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045ba:	ff d0                	call   *%rax
+}
+  8045bc:	48 83 c4 20          	add    $0x20,%rsp
+  8045c0:	5b                   	pop    %rbx
+  8045c1:	41 5f                	pop    %r15
+  8045c3:	5d                   	pop    %rbp
+  8045c4:	c3                   	ret
+
+00000000008045c5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8045c5:	55                   	push   %rbp
+  8045c6:	48 89 e5             	mov    %rsp,%rbp
+  8045c9:	41 57                	push   %r15
+  8045cb:	53                   	push   %rbx
+  8045cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8045d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045d0 <nsipc+0xb>
+  8045d7:	49 bb 68 3a 00 00 00 	movabs $0x3a68,%r11
+  8045de:	00 00 00 
+  8045e1:	4c 01 db             	add    %r11,%rbx
+  8045e4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8045e7:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8045ee:	00 00 00 
+  8045f1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8045f4:	85 c0                	test   %eax,%eax
+  8045f6:	75 24                	jne    80461c <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8045f8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8045fd:	49 89 df             	mov    %rbx,%r15
+  804600:	48 b8 73 df ff ff ff 	movabs $0xffffffffffffdf73,%rax
+  804607:	ff ff ff 
+  80460a:	48 01 d8             	add    %rbx,%rax
+  80460d:	ff d0                	call   *%rax
+  80460f:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  804616:	00 00 00 
+  804619:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  80461c:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804623:	00 00 00 
+  804626:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804629:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80462c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804632:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804638:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80463d:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804644:	00 00 00 
+  804647:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80464b:	89 c7                	mov    %eax,%edi
+  80464d:	49 89 df             	mov    %rbx,%r15
+  804650:	48 b8 92 d9 ff ff ff 	movabs $0xffffffffffffd992,%rax
+  804657:	ff ff ff 
+  80465a:	48 01 d8             	add    %rbx,%rax
+  80465d:	ff d0                	call   *%rax
+}
+  80465f:	48 83 c4 10          	add    $0x10,%rsp
+  804663:	5b                   	pop    %rbx
+  804664:	41 5f                	pop    %r15
+  804666:	5d                   	pop    %rbp
+  804667:	c3                   	ret
+
+0000000000804668 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804668:	55                   	push   %rbp
+  804669:	48 89 e5             	mov    %rsp,%rbp
+  80466c:	41 57                	push   %r15
+  80466e:	53                   	push   %rbx
+  80466f:	48 83 ec 20          	sub    $0x20,%rsp
+  804673:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804673 <nsipc_words+0xb>
+  80467a:	49 bb c5 39 00 00 00 	movabs $0x39c5,%r11
+  804681:	00 00 00 
+  804684:	4c 01 db             	add    %r11,%rbx
+  804687:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80468a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80468e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  804692:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804699:	00 00 00 
+  80469c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80469f:	85 c0                	test   %eax,%eax
+  8046a1:	75 24                	jne    8046c7 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8046a3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8046a8:	49 89 df             	mov    %rbx,%r15
+  8046ab:	48 b8 73 df ff ff ff 	movabs $0xffffffffffffdf73,%rax
+  8046b2:	ff ff ff 
+  8046b5:	48 01 d8             	add    %rbx,%rax
+  8046b8:	ff d0                	call   *%rax
+  8046ba:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  8046c1:	00 00 00 
+  8046c4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8046c7:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8046ce:	00 00 00 
+  8046d1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8046d4:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8046d8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8046dc:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8046df:	89 c7                	mov    %eax,%edi
+  8046e1:	49 89 df             	mov    %rbx,%r15
+  8046e4:	48 b8 7d da ff ff ff 	movabs $0xffffffffffffda7d,%rax
+  8046eb:	ff ff ff 
+  8046ee:	48 01 d8             	add    %rbx,%rax
+  8046f1:	ff d0                	call   *%rax
+}
+  8046f3:	48 83 c4 20          	add    $0x20,%rsp
+  8046f7:	5b                   	pop    %rbx
+  8046f8:	41 5f                	pop    %r15
+  8046fa:	5d                   	pop    %rbp
+  8046fb:	c3                   	ret
+
+00000000008046fc <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8046fc:	55                   	push   %rbp
+  8046fd:	48 89 e5             	mov    %rsp,%rbp
+  804700:	41 57                	push   %r15
+  804702:	53                   	push   %rbx
+  804703:	48 83 ec 30          	sub    $0x30,%rsp
+  804707:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804707 <nsipc_accept+0xb>
+  80470e:	49 bb 31 39 00 00 00 	movabs $0x3931,%r11
+  804715:	00 00 00 
+  804718:	4c 01 db             	add    %r11,%rbx
+  80471b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80471e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804722:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  804726:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80472d:	00 00 00 
+  804730:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804733:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  804736:	bf 01 00 00 00       	mov    $0x1,%edi
+  80473b:	48 b8 8d c5 ff ff ff 	movabs $0xffffffffffffc58d,%rax
+  804742:	ff ff ff 
+  804745:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804749:	ff d0                	call   *%rax
+  80474b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80474e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804752:	78 48                	js     80479c <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  804754:	48 b8 c8 3f 01 00 00 	movabs $0x13fc8,%rax
+  80475b:	00 00 00 
+  80475e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804762:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804766:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80476a:	8b 40 10             	mov    0x10(%rax),%eax
+  80476d:	89 c2                	mov    %eax,%edx
+  80476f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804773:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804777:	48 89 ce             	mov    %rcx,%rsi
+  80477a:	48 89 c7             	mov    %rax,%rdi
+  80477d:	49 89 df             	mov    %rbx,%r15
+  804780:	48 b8 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rax
+  804787:	ff ff ff 
+  80478a:	48 01 d8             	add    %rbx,%rax
+  80478d:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80478f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804793:	8b 50 10             	mov    0x10(%rax),%edx
+  804796:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80479a:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  80479c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80479f:	48 83 c4 30          	add    $0x30,%rsp
+  8047a3:	5b                   	pop    %rbx
+  8047a4:	41 5f                	pop    %r15
+  8047a6:	5d                   	pop    %rbp
+  8047a7:	c3                   	ret
+
+00000000008047a8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8047a8:	55                   	push   %rbp
+  8047a9:	48 89 e5             	mov    %rsp,%rbp
+  8047ac:	41 57                	push   %r15
+  8047ae:	53                   	push   %rbx
+  8047af:	48 83 ec 10          	sub    $0x10,%rsp
+  8047b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047b3 <nsipc_bind+0xb>
+  8047ba:	49 bb 85 38 00 00 00 	movabs $0x3885,%r11
+  8047c1:	00 00 00 
+  8047c4:	4c 01 db             	add    %r11,%rbx
+  8047c7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8047ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8047ce:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8047d1:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8047d8:	00 00 00 
+  8047db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047de:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8047e1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8047e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047e8:	48 89 c6             	mov    %rax,%rsi
+  8047eb:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  8047f2:	00 00 00 
+  8047f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047f9:	48 89 c7             	mov    %rax,%rdi
+  8047fc:	49 89 df             	mov    %rbx,%r15
+  8047ff:	48 b8 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rax
+  804806:	ff ff ff 
+  804809:	48 01 d8             	add    %rbx,%rax
+  80480c:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  80480e:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804815:	00 00 00 
+  804818:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80481b:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  80481f:	bf 02 00 00 00       	mov    $0x2,%edi
+  804824:	48 b8 8d c5 ff ff ff 	movabs $0xffffffffffffc58d,%rax
+  80482b:	ff ff ff 
+  80482e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804832:	ff d0                	call   *%rax
+}
+  804834:	48 83 c4 10          	add    $0x10,%rsp
+  804838:	5b                   	pop    %rbx
+  804839:	41 5f                	pop    %r15
+  80483b:	5d                   	pop    %rbp
+  80483c:	c3                   	ret
+
+000000000080483d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80483d:	55                   	push   %rbp
+  80483e:	48 89 e5             	mov    %rsp,%rbp
+  804841:	48 83 ec 20          	sub    $0x20,%rsp
+  804845:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804845 <nsipc_shutdown+0x8>
+  80484c:	49 bb f3 37 00 00 00 	movabs $0x37f3,%r11
+  804853:	00 00 00 
+  804856:	4c 01 d8             	add    %r11,%rax
+  804859:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80485c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  80485f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804862:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  804865:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804868:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80486b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80486f:	ba 08 00 00 00       	mov    $0x8,%edx
+  804874:	48 89 ce             	mov    %rcx,%rsi
+  804877:	bf 03 00 00 00       	mov    $0x3,%edi
+  80487c:	48 b9 30 c6 ff ff ff 	movabs $0xffffffffffffc630,%rcx
+  804883:	ff ff ff 
+  804886:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80488a:	ff d0                	call   *%rax
+}
+  80488c:	c9                   	leave
+  80488d:	c3                   	ret
+
+000000000080488e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80488e:	55                   	push   %rbp
+  80488f:	48 89 e5             	mov    %rsp,%rbp
+  804892:	48 83 ec 20          	sub    $0x20,%rsp
+  804896:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804896 <nsipc_close+0x8>
+  80489d:	49 bb a2 37 00 00 00 	movabs $0x37a2,%r11
+  8048a4:	00 00 00 
+  8048a7:	4c 01 d8             	add    %r11,%rax
+  8048aa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8048ad:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8048b0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8048b3:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8048b7:	ba 04 00 00 00       	mov    $0x4,%edx
+  8048bc:	48 89 ce             	mov    %rcx,%rsi
+  8048bf:	bf 04 00 00 00       	mov    $0x4,%edi
+  8048c4:	48 b9 30 c6 ff ff ff 	movabs $0xffffffffffffc630,%rcx
+  8048cb:	ff ff ff 
+  8048ce:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8048d2:	ff d0                	call   *%rax
+}
+  8048d4:	c9                   	leave
+  8048d5:	c3                   	ret
+
+00000000008048d6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8048d6:	55                   	push   %rbp
+  8048d7:	48 89 e5             	mov    %rsp,%rbp
+  8048da:	41 57                	push   %r15
+  8048dc:	53                   	push   %rbx
+  8048dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8048e1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048e1 <nsipc_connect+0xb>
+  8048e8:	49 bb 57 37 00 00 00 	movabs $0x3757,%r11
+  8048ef:	00 00 00 
+  8048f2:	4c 01 db             	add    %r11,%rbx
+  8048f5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8048f8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8048fc:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8048ff:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804906:	00 00 00 
+  804909:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80490c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80490f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804912:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804916:	48 89 c6             	mov    %rax,%rsi
+  804919:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  804920:	00 00 00 
+  804923:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804927:	48 89 c7             	mov    %rax,%rdi
+  80492a:	49 89 df             	mov    %rbx,%r15
+  80492d:	48 b8 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rax
+  804934:	ff ff ff 
+  804937:	48 01 d8             	add    %rbx,%rax
+  80493a:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  80493c:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804943:	00 00 00 
+  804946:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804949:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  80494d:	bf 05 00 00 00       	mov    $0x5,%edi
+  804952:	48 b8 8d c5 ff ff ff 	movabs $0xffffffffffffc58d,%rax
+  804959:	ff ff ff 
+  80495c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804960:	ff d0                	call   *%rax
+}
+  804962:	48 83 c4 10          	add    $0x10,%rsp
+  804966:	5b                   	pop    %rbx
+  804967:	41 5f                	pop    %r15
+  804969:	5d                   	pop    %rbp
+  80496a:	c3                   	ret
+
+000000000080496b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80496b:	55                   	push   %rbp
+  80496c:	48 89 e5             	mov    %rsp,%rbp
+  80496f:	48 83 ec 20          	sub    $0x20,%rsp
+  804973:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804973 <nsipc_listen+0x8>
+  80497a:	49 bb c5 36 00 00 00 	movabs $0x36c5,%r11
+  804981:	00 00 00 
+  804984:	4c 01 d8             	add    %r11,%rax
+  804987:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80498a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  80498d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804990:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  804993:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804996:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804999:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80499d:	ba 08 00 00 00       	mov    $0x8,%edx
+  8049a2:	48 89 ce             	mov    %rcx,%rsi
+  8049a5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8049aa:	48 b9 30 c6 ff ff ff 	movabs $0xffffffffffffc630,%rcx
+  8049b1:	ff ff ff 
+  8049b4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8049b8:	ff d0                	call   *%rax
+}
+  8049ba:	c9                   	leave
+  8049bb:	c3                   	ret
+
+00000000008049bc <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8049bc:	55                   	push   %rbp
+  8049bd:	48 89 e5             	mov    %rsp,%rbp
+  8049c0:	41 57                	push   %r15
+  8049c2:	53                   	push   %rbx
+  8049c3:	48 83 ec 30          	sub    $0x30,%rsp
+  8049c7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049c7 <nsipc_recv+0xb>
+  8049ce:	49 bb 71 36 00 00 00 	movabs $0x3671,%r11
+  8049d5:	00 00 00 
+  8049d8:	4c 01 db             	add    %r11,%rbx
+  8049db:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8049de:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8049e2:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8049e5:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8049e8:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8049ef:	00 00 00 
+  8049f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8049f5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8049f8:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8049ff:	00 00 00 
+  804a02:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804a05:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804a09:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804a10:	00 00 00 
+  804a13:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804a16:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804a1a:	bf 07 00 00 00       	mov    $0x7,%edi
+  804a1f:	48 b8 8d c5 ff ff ff 	movabs $0xffffffffffffc58d,%rax
+  804a26:	ff ff ff 
+  804a29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a2d:	ff d0                	call   *%rax
+  804a2f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a32:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a36:	0f 88 91 00 00 00    	js     804acd <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804a3c:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804a43:	7f 08                	jg     804a4d <nsipc_recv+0x91>
+  804a45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a48:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804a4b:	7e 50                	jle    804a9d <nsipc_recv+0xe1>
+  804a4d:	48 b8 c3 e6 ff ff ff 	movabs $0xffffffffffffe6c3,%rax
+  804a54:	ff ff ff 
+  804a57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a5b:	48 89 c1             	mov    %rax,%rcx
+  804a5e:	48 b8 d8 e6 ff ff ff 	movabs $0xffffffffffffe6d8,%rax
+  804a65:	ff ff ff 
+  804a68:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a6c:	48 89 c2             	mov    %rax,%rdx
+  804a6f:	be 79 00 00 00       	mov    $0x79,%esi
+  804a74:	48 b8 ed e6 ff ff ff 	movabs $0xffffffffffffe6ed,%rax
+  804a7b:	ff ff ff 
+  804a7e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a82:	48 89 c7             	mov    %rax,%rdi
+  804a85:	49 89 df             	mov    %rbx,%r15
+  804a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a8d:	49 b8 ad 82 ff ff ff 	movabs $0xffffffffffff82ad,%r8
+  804a94:	ff ff ff 
+  804a97:	49 01 d8             	add    %rbx,%r8
+  804a9a:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804a9d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aa0:	48 63 d0             	movslq %eax,%rdx
+  804aa3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804aa7:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804aae:	00 00 00 
+  804ab1:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  804ab5:	48 89 ce             	mov    %rcx,%rsi
+  804ab8:	48 89 c7             	mov    %rax,%rdi
+  804abb:	49 89 df             	mov    %rbx,%r15
+  804abe:	48 b8 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rax
+  804ac5:	ff ff ff 
+  804ac8:	48 01 d8             	add    %rbx,%rax
+  804acb:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804acd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804ad0:	48 83 c4 30          	add    $0x30,%rsp
+  804ad4:	5b                   	pop    %rbx
+  804ad5:	41 5f                	pop    %r15
+  804ad7:	5d                   	pop    %rbp
+  804ad8:	c3                   	ret
+
+0000000000804ad9 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804ad9:	55                   	push   %rbp
+  804ada:	48 89 e5             	mov    %rsp,%rbp
+  804add:	41 57                	push   %r15
+  804adf:	53                   	push   %rbx
+  804ae0:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804ae7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ae7 <nsipc_send+0xe>
+  804aee:	49 bb 51 35 00 00 00 	movabs $0x3551,%r11
+  804af5:	00 00 00 
+  804af8:	4c 01 db             	add    %r11,%rbx
+  804afb:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804b01:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804b08:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804b0e:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804b14:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804b18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804b1c:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804b23:	00 00 00 
+  804b26:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b29:	85 c0                	test   %eax,%eax
+  804b2b:	75 24                	jne    804b51 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804b2d:	bf 02 00 00 00       	mov    $0x2,%edi
+  804b32:	49 89 df             	mov    %rbx,%r15
+  804b35:	48 b8 73 df ff ff ff 	movabs $0xffffffffffffdf73,%rax
+  804b3c:	ff ff ff 
+  804b3f:	48 01 d8             	add    %rbx,%rax
+  804b42:	ff d0                	call   *%rax
+  804b44:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  804b4b:	00 00 00 
+  804b4e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804b51:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804b57:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804b5a:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804b61:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804b64:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804b67:	39 c2                	cmp    %eax,%edx
+  804b69:	0f 4e c2             	cmovle %edx,%eax
+  804b6c:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804b72:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804b78:	48 63 d0             	movslq %eax,%rdx
+  804b7b:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804b82:	48 89 c6             	mov    %rax,%rsi
+  804b85:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804b8c:	00 00 00 
+  804b8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b93:	48 89 c7             	mov    %rax,%rdi
+  804b96:	49 89 df             	mov    %rbx,%r15
+  804b99:	48 b8 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rax
+  804ba0:	ff ff ff 
+  804ba3:	48 01 d8             	add    %rbx,%rax
+  804ba6:	ff d0                	call   *%rax
+	req->req_s = s;
+  804ba8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bac:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804bb2:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804bb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bb8:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804bbe:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804bc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bc5:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804bcb:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804bce:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804bd5:	00 00 00 
+  804bd8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bdc:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804be0:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804be7:	00 
+  804be8:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804bee:	48 63 d0             	movslq %eax,%rdx
+  804bf1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bf5:	48 01 d0             	add    %rdx,%rax
+  804bf8:	48 83 e8 01          	sub    $0x1,%rax
+  804bfc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804c00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c09:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804c0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c11:	48 29 d0             	sub    %rdx,%rax
+  804c14:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804c1a:	85 c0                	test   %eax,%eax
+  804c1c:	0f 48 c2             	cmovs  %edx,%eax
+  804c1f:	c1 f8 0c             	sar    $0xc,%eax
+  804c22:	48 98                	cltq
+  804c24:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804c28:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804c2c:	48 85 c0             	test   %rax,%rax
+  804c2f:	0f 95 c0             	setne  %al
+  804c32:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804c35:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804c3c:	00 
+  804c3d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c41:	48 83 c0 0b          	add    $0xb,%rax
+  804c45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804c49:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c52:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804c56:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c5a:	48 29 d0             	sub    %rdx,%rax
+  804c5d:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804c61:	89 c7                	mov    %eax,%edi
+  804c63:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804c6a:	00 00 00 
+  804c6d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c70:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804c74:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804c78:	48 83 ec 08          	sub    $0x8,%rsp
+  804c7c:	6a 00                	push   $0x0
+  804c7e:	6a 00                	push   $0x0
+  804c80:	6a 05                	push   $0x5
+  804c82:	41 89 f1             	mov    %esi,%r9d
+  804c85:	49 89 c8             	mov    %rcx,%r8
+  804c88:	89 f9                	mov    %edi,%ecx
+  804c8a:	be 08 00 00 00       	mov    $0x8,%esi
+  804c8f:	89 c7                	mov    %eax,%edi
+  804c91:	49 89 df             	mov    %rbx,%r15
+  804c94:	48 b8 7b db ff ff ff 	movabs $0xffffffffffffdb7b,%rax
+  804c9b:	ff ff ff 
+  804c9e:	48 01 d8             	add    %rbx,%rax
+  804ca1:	ff d0                	call   *%rax
+  804ca3:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804ca7:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804cab:	5b                   	pop    %rbx
+  804cac:	41 5f                	pop    %r15
+  804cae:	5d                   	pop    %rbp
+  804caf:	c3                   	ret
+
+0000000000804cb0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804cb0:	55                   	push   %rbp
+  804cb1:	48 89 e5             	mov    %rsp,%rbp
+  804cb4:	48 83 ec 10          	sub    $0x10,%rsp
+  804cb8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804cb8 <nsipc_socket+0x8>
+  804cbf:	49 bb 80 33 00 00 00 	movabs $0x3380,%r11
+  804cc6:	00 00 00 
+  804cc9:	4c 01 d8             	add    %r11,%rax
+  804ccc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804ccf:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804cd2:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804cd5:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804cdc:	00 00 00 
+  804cdf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804ce2:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804ce5:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804cec:	00 00 00 
+  804cef:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804cf2:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804cf6:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804cfd:	00 00 00 
+  804d00:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804d03:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804d07:	bf 09 00 00 00       	mov    $0x9,%edi
+  804d0c:	48 ba 8d c5 ff ff ff 	movabs $0xffffffffffffc58d,%rdx
+  804d13:	ff ff ff 
+  804d16:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804d1a:	ff d0                	call   *%rax
+}
+  804d1c:	c9                   	leave
+  804d1d:	c3                   	ret
+
+0000000000804d1e <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804d1e:	55                   	push   %rbp
+  804d1f:	48 89 e5             	mov    %rsp,%rbp
+  804d22:	41 57                	push   %r15
+  804d24:	53                   	push   %rbx
+  804d25:	48 83 ec 30          	sub    $0x30,%rsp
+  804d29:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d29 <pipe+0xb>
+  804d30:	49 bb 0f 33 00 00 00 	movabs $0x330f,%r11
+  804d37:	00 00 00 
+  804d3a:	4c 01 db             	add    %r11,%rbx
+  804d3d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804d41:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804d45:	48 89 c7             	mov    %rax,%rdi
+  804d48:	49 89 df             	mov    %rbx,%r15
+  804d4b:	48 b8 a7 a9 ff ff ff 	movabs $0xffffffffffffa9a7,%rax
+  804d52:	ff ff ff 
+  804d55:	48 01 d8             	add    %rbx,%rax
+  804d58:	ff d0                	call   *%rax
+  804d5a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d5d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d61:	0f 88 12 02 00 00    	js     804f79 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804d67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d6b:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d70:	48 89 c6             	mov    %rax,%rsi
+  804d73:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d78:	49 89 df             	mov    %rbx,%r15
+  804d7b:	48 b8 02 a0 ff ff ff 	movabs $0xffffffffffffa002,%rax
+  804d82:	ff ff ff 
+  804d85:	48 01 d8             	add    %rbx,%rax
+  804d88:	ff d0                	call   *%rax
+  804d8a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d8d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d91:	0f 88 e2 01 00 00    	js     804f79 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804d97:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804d9b:	48 89 c7             	mov    %rax,%rdi
+  804d9e:	49 89 df             	mov    %rbx,%r15
+  804da1:	48 b8 a7 a9 ff ff ff 	movabs $0xffffffffffffa9a7,%rax
+  804da8:	ff ff ff 
+  804dab:	48 01 d8             	add    %rbx,%rax
+  804dae:	ff d0                	call   *%rax
+  804db0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804db3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804db7:	0f 88 9b 01 00 00    	js     804f58 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804dbd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804dc1:	ba 07 04 00 00       	mov    $0x407,%edx
+  804dc6:	48 89 c6             	mov    %rax,%rsi
+  804dc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dce:	49 89 df             	mov    %rbx,%r15
+  804dd1:	48 b8 02 a0 ff ff ff 	movabs $0xffffffffffffa002,%rax
+  804dd8:	ff ff ff 
+  804ddb:	48 01 d8             	add    %rbx,%rax
+  804dde:	ff d0                	call   *%rax
+  804de0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804de3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804de7:	0f 88 6b 01 00 00    	js     804f58 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804ded:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804df1:	48 89 c7             	mov    %rax,%rdi
+  804df4:	49 89 df             	mov    %rbx,%r15
+  804df7:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  804dfe:	ff ff ff 
+  804e01:	48 01 d8             	add    %rbx,%rax
+  804e04:	ff d0                	call   *%rax
+  804e06:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804e0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e0e:	ba 07 04 00 00       	mov    $0x407,%edx
+  804e13:	48 89 c6             	mov    %rax,%rsi
+  804e16:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e1b:	49 89 df             	mov    %rbx,%r15
+  804e1e:	48 b8 02 a0 ff ff ff 	movabs $0xffffffffffffa002,%rax
+  804e25:	ff ff ff 
+  804e28:	48 01 d8             	add    %rbx,%rax
+  804e2b:	ff d0                	call   *%rax
+  804e2d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e30:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e34:	0f 88 fd 00 00 00    	js     804f37 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804e3a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e3e:	48 89 c7             	mov    %rax,%rdi
+  804e41:	49 89 df             	mov    %rbx,%r15
+  804e44:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  804e4b:	ff ff ff 
+  804e4e:	48 01 d8             	add    %rbx,%rax
+  804e51:	ff d0                	call   *%rax
+  804e53:	48 89 c2             	mov    %rax,%rdx
+  804e56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e5a:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804e60:	48 89 d1             	mov    %rdx,%rcx
+  804e63:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e68:	48 89 c6             	mov    %rax,%rsi
+  804e6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e70:	49 89 df             	mov    %rbx,%r15
+  804e73:	48 b8 67 a0 ff ff ff 	movabs $0xffffffffffffa067,%rax
+  804e7a:	ff ff ff 
+  804e7d:	48 01 d8             	add    %rbx,%rax
+  804e80:	ff d0                	call   *%rax
+  804e82:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e85:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e89:	0f 88 87 00 00 00    	js     804f16 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804e8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e93:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  804e9a:	00 00 00 
+  804e9d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804ea0:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804ea2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ea6:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804ead:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804eb1:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  804eb8:	00 00 00 
+  804ebb:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804ebe:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804ec0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ec4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804ecb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ecf:	48 89 c7             	mov    %rax,%rdi
+  804ed2:	49 89 df             	mov    %rbx,%r15
+  804ed5:	48 b8 2d a9 ff ff ff 	movabs $0xffffffffffffa92d,%rax
+  804edc:	ff ff ff 
+  804edf:	48 01 d8             	add    %rbx,%rax
+  804ee2:	ff d0                	call   *%rax
+  804ee4:	89 c2                	mov    %eax,%edx
+  804ee6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804eea:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804eec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ef0:	48 89 c7             	mov    %rax,%rdi
+  804ef3:	49 89 df             	mov    %rbx,%r15
+  804ef6:	48 b8 2d a9 ff ff ff 	movabs $0xffffffffffffa92d,%rax
+  804efd:	ff ff ff 
+  804f00:	48 01 d8             	add    %rbx,%rax
+  804f03:	ff d0                	call   *%rax
+  804f05:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804f09:	48 83 c2 04          	add    $0x4,%rdx
+  804f0d:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f14:	eb 67                	jmp    804f7d <pipe+0x25f>
+		goto err3;
+  804f16:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804f17:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f1b:	48 89 c6             	mov    %rax,%rsi
+  804f1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f23:	49 89 df             	mov    %rbx,%r15
+  804f26:	48 b8 da a0 ff ff ff 	movabs $0xffffffffffffa0da,%rax
+  804f2d:	ff ff ff 
+  804f30:	48 01 d8             	add    %rbx,%rax
+  804f33:	ff d0                	call   *%rax
+  804f35:	eb 01                	jmp    804f38 <pipe+0x21a>
+		goto err2;
+  804f37:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804f38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f3c:	48 89 c6             	mov    %rax,%rsi
+  804f3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f44:	49 89 df             	mov    %rbx,%r15
+  804f47:	48 b8 da a0 ff ff ff 	movabs $0xffffffffffffa0da,%rax
+  804f4e:	ff ff ff 
+  804f51:	48 01 d8             	add    %rbx,%rax
+  804f54:	ff d0                	call   *%rax
+  804f56:	eb 01                	jmp    804f59 <pipe+0x23b>
+		goto err1;
+  804f58:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804f59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f5d:	48 89 c6             	mov    %rax,%rsi
+  804f60:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f65:	49 89 df             	mov    %rbx,%r15
+  804f68:	48 b8 da a0 ff ff ff 	movabs $0xffffffffffffa0da,%rax
+  804f6f:	ff ff ff 
+  804f72:	48 01 d8             	add    %rbx,%rax
+  804f75:	ff d0                	call   *%rax
+  804f77:	eb 01                	jmp    804f7a <pipe+0x25c>
+		goto err;
+  804f79:	90                   	nop
+err:
+	return r;
+  804f7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804f7d:	48 83 c4 30          	add    $0x30,%rsp
+  804f81:	5b                   	pop    %rbx
+  804f82:	41 5f                	pop    %r15
+  804f84:	5d                   	pop    %rbp
+  804f85:	c3                   	ret
+
+0000000000804f86 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804f86:	55                   	push   %rbp
+  804f87:	48 89 e5             	mov    %rsp,%rbp
+  804f8a:	41 57                	push   %r15
+  804f8c:	41 54                	push   %r12
+  804f8e:	53                   	push   %rbx
+  804f8f:	48 83 ec 28          	sub    $0x28,%rsp
+  804f93:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f93 <_pipeisclosed+0xd>
+  804f9a:	49 bb a5 30 00 00 00 	movabs $0x30a5,%r11
+  804fa1:	00 00 00 
+  804fa4:	4c 01 db             	add    %r11,%rbx
+  804fa7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804fab:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804faf:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804fb6:	ff ff ff 
+  804fb9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804fbd:	48 8b 00             	mov    (%rax),%rax
+  804fc0:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804fc6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  804fc9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fcd:	48 89 c7             	mov    %rax,%rdi
+  804fd0:	49 89 df             	mov    %rbx,%r15
+  804fd3:	48 b8 02 e0 ff ff ff 	movabs $0xffffffffffffe002,%rax
+  804fda:	ff ff ff 
+  804fdd:	48 01 d8             	add    %rbx,%rax
+  804fe0:	ff d0                	call   *%rax
+  804fe2:	41 89 c4             	mov    %eax,%r12d
+  804fe5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804fe9:	48 89 c7             	mov    %rax,%rdi
+  804fec:	49 89 df             	mov    %rbx,%r15
+  804fef:	48 b8 02 e0 ff ff ff 	movabs $0xffffffffffffe002,%rax
+  804ff6:	ff ff ff 
+  804ff9:	48 01 d8             	add    %rbx,%rax
+  804ffc:	ff d0                	call   *%rax
+  804ffe:	41 39 c4             	cmp    %eax,%r12d
+  805001:	0f 94 c0             	sete   %al
+  805004:	0f b6 c0             	movzbl %al,%eax
+  805007:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  80500a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805011:	ff ff ff 
+  805014:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805018:	48 8b 00             	mov    (%rax),%rax
+  80501b:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805021:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805024:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805027:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80502a:	75 05                	jne    805031 <_pipeisclosed+0xab>
+			return ret;
+  80502c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80502f:	eb 63                	jmp    805094 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805031:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805034:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805037:	0f 84 72 ff ff ff    	je     804faf <_pipeisclosed+0x29>
+  80503d:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805041:	0f 85 68 ff ff ff    	jne    804faf <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805047:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80504e:	ff ff ff 
+  805051:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805055:	48 8b 00             	mov    (%rax),%rax
+  805058:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  80505e:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805061:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805064:	89 c6                	mov    %eax,%esi
+  805066:	48 b8 fe e6 ff ff ff 	movabs $0xffffffffffffe6fe,%rax
+  80506d:	ff ff ff 
+  805070:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805074:	48 89 c7             	mov    %rax,%rdi
+  805077:	49 89 df             	mov    %rbx,%r15
+  80507a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80507f:	49 b8 84 85 ff ff ff 	movabs $0xffffffffffff8584,%r8
+  805086:	ff ff ff 
+  805089:	49 01 d8             	add    %rbx,%r8
+  80508c:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  80508f:	e9 1b ff ff ff       	jmp    804faf <_pipeisclosed+0x29>
+	}
+}
+  805094:	48 83 c4 28          	add    $0x28,%rsp
+  805098:	5b                   	pop    %rbx
+  805099:	41 5c                	pop    %r12
+  80509b:	41 5f                	pop    %r15
+  80509d:	5d                   	pop    %rbp
+  80509e:	c3                   	ret
+
+000000000080509f <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  80509f:	55                   	push   %rbp
+  8050a0:	48 89 e5             	mov    %rsp,%rbp
+  8050a3:	41 57                	push   %r15
+  8050a5:	53                   	push   %rbx
+  8050a6:	48 83 ec 30          	sub    $0x30,%rsp
+  8050aa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050aa <pipeisclosed+0xb>
+  8050b1:	49 bb 8e 2f 00 00 00 	movabs $0x2f8e,%r11
+  8050b8:	00 00 00 
+  8050bb:	4c 01 db             	add    %r11,%rbx
+  8050be:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8050c1:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8050c5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8050c8:	48 89 d6             	mov    %rdx,%rsi
+  8050cb:	89 c7                	mov    %eax,%edi
+  8050cd:	49 89 df             	mov    %rbx,%r15
+  8050d0:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  8050d7:	ff ff ff 
+  8050da:	48 01 d8             	add    %rbx,%rax
+  8050dd:	ff d0                	call   *%rax
+  8050df:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050e6:	79 05                	jns    8050ed <pipeisclosed+0x4e>
+		return r;
+  8050e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050eb:	eb 3b                	jmp    805128 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8050ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050f1:	48 89 c7             	mov    %rax,%rdi
+  8050f4:	49 89 df             	mov    %rbx,%r15
+  8050f7:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  8050fe:	ff ff ff 
+  805101:	48 01 d8             	add    %rbx,%rax
+  805104:	ff d0                	call   *%rax
+  805106:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80510a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80510e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805112:	48 89 d6             	mov    %rdx,%rsi
+  805115:	48 89 c7             	mov    %rax,%rdi
+  805118:	48 b8 4e cf ff ff ff 	movabs $0xffffffffffffcf4e,%rax
+  80511f:	ff ff ff 
+  805122:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805126:	ff d0                	call   *%rax
+}
+  805128:	48 83 c4 30          	add    $0x30,%rsp
+  80512c:	5b                   	pop    %rbx
+  80512d:	41 5f                	pop    %r15
+  80512f:	5d                   	pop    %rbp
+  805130:	c3                   	ret
+
+0000000000805131 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805131:	55                   	push   %rbp
+  805132:	48 89 e5             	mov    %rsp,%rbp
+  805135:	41 57                	push   %r15
+  805137:	53                   	push   %rbx
+  805138:	48 83 ec 40          	sub    $0x40,%rsp
+  80513c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80513c <devpipe_read+0xb>
+  805143:	49 bb fc 2e 00 00 00 	movabs $0x2efc,%r11
+  80514a:	00 00 00 
+  80514d:	4c 01 db             	add    %r11,%rbx
+  805150:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805154:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805158:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  80515c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805160:	48 89 c7             	mov    %rax,%rdi
+  805163:	49 89 df             	mov    %rbx,%r15
+  805166:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  80516d:	ff ff ff 
+  805170:	48 01 d8             	add    %rbx,%rax
+  805173:	ff d0                	call   *%rax
+  805175:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805179:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80517d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805181:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805188:	00 
+  805189:	e9 a1 00 00 00       	jmp    80522f <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  80518e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805193:	74 09                	je     80519e <devpipe_read+0x6d>
+				return i;
+  805195:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805199:	e9 9f 00 00 00       	jmp    80523d <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  80519e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051a6:	48 89 d6             	mov    %rdx,%rsi
+  8051a9:	48 89 c7             	mov    %rax,%rdi
+  8051ac:	48 b8 4e cf ff ff ff 	movabs $0xffffffffffffcf4e,%rax
+  8051b3:	ff ff ff 
+  8051b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051ba:	ff d0                	call   *%rax
+  8051bc:	85 c0                	test   %eax,%eax
+  8051be:	74 07                	je     8051c7 <devpipe_read+0x96>
+				return 0;
+  8051c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c5:	eb 76                	jmp    80523d <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8051c7:	49 89 df             	mov    %rbx,%r15
+  8051ca:	48 b8 ad 9f ff ff ff 	movabs $0xffffffffffff9fad,%rax
+  8051d1:	ff ff ff 
+  8051d4:	48 01 d8             	add    %rbx,%rax
+  8051d7:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8051d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051dd:	8b 10                	mov    (%rax),%edx
+  8051df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051e3:	8b 40 04             	mov    0x4(%rax),%eax
+  8051e6:	39 c2                	cmp    %eax,%edx
+  8051e8:	74 a4                	je     80518e <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8051ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051ee:	8b 10                	mov    (%rax),%edx
+  8051f0:	89 d0                	mov    %edx,%eax
+  8051f2:	c1 f8 1f             	sar    $0x1f,%eax
+  8051f5:	c1 e8 1b             	shr    $0x1b,%eax
+  8051f8:	01 c2                	add    %eax,%edx
+  8051fa:	83 e2 1f             	and    $0x1f,%edx
+  8051fd:	29 c2                	sub    %eax,%edx
+  8051ff:	89 d6                	mov    %edx,%esi
+  805201:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805205:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805209:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80520d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805211:	48 63 c6             	movslq %esi,%rax
+  805214:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805219:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  80521b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80521f:	8b 00                	mov    (%rax),%eax
+  805221:	8d 50 01             	lea    0x1(%rax),%edx
+  805224:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805228:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80522a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80522f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805233:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805237:	72 a0                	jb     8051d9 <devpipe_read+0xa8>
+	}
+	return i;
+  805239:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80523d:	48 83 c4 40          	add    $0x40,%rsp
+  805241:	5b                   	pop    %rbx
+  805242:	41 5f                	pop    %r15
+  805244:	5d                   	pop    %rbp
+  805245:	c3                   	ret
+
+0000000000805246 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805246:	55                   	push   %rbp
+  805247:	48 89 e5             	mov    %rsp,%rbp
+  80524a:	41 57                	push   %r15
+  80524c:	53                   	push   %rbx
+  80524d:	48 83 ec 40          	sub    $0x40,%rsp
+  805251:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805251 <devpipe_write+0xb>
+  805258:	49 bb e7 2d 00 00 00 	movabs $0x2de7,%r11
+  80525f:	00 00 00 
+  805262:	4c 01 db             	add    %r11,%rbx
+  805265:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805269:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80526d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805271:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805275:	48 89 c7             	mov    %rax,%rdi
+  805278:	49 89 df             	mov    %rbx,%r15
+  80527b:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  805282:	ff ff ff 
+  805285:	48 01 d8             	add    %rbx,%rax
+  805288:	ff d0                	call   *%rax
+  80528a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80528e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805292:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805296:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80529d:	00 
+  80529e:	e9 a0 00 00 00       	jmp    805343 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8052a3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8052a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052ab:	48 89 d6             	mov    %rdx,%rsi
+  8052ae:	48 89 c7             	mov    %rax,%rdi
+  8052b1:	48 b8 4e cf ff ff ff 	movabs $0xffffffffffffcf4e,%rax
+  8052b8:	ff ff ff 
+  8052bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052bf:	ff d0                	call   *%rax
+  8052c1:	85 c0                	test   %eax,%eax
+  8052c3:	74 0a                	je     8052cf <devpipe_write+0x89>
+				return 0;
+  8052c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052ca:	e9 82 00 00 00       	jmp    805351 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8052cf:	49 89 df             	mov    %rbx,%r15
+  8052d2:	48 b8 ad 9f ff ff ff 	movabs $0xffffffffffff9fad,%rax
+  8052d9:	ff ff ff 
+  8052dc:	48 01 d8             	add    %rbx,%rax
+  8052df:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8052e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052e5:	8b 40 04             	mov    0x4(%rax),%eax
+  8052e8:	48 63 d0             	movslq %eax,%rdx
+  8052eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052ef:	8b 00                	mov    (%rax),%eax
+  8052f1:	48 98                	cltq
+  8052f3:	48 83 c0 20          	add    $0x20,%rax
+  8052f7:	48 39 c2             	cmp    %rax,%rdx
+  8052fa:	73 a7                	jae    8052a3 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8052fc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805300:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805304:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805308:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80530c:	8b 50 04             	mov    0x4(%rax),%edx
+  80530f:	89 d0                	mov    %edx,%eax
+  805311:	c1 f8 1f             	sar    $0x1f,%eax
+  805314:	c1 e8 1b             	shr    $0x1b,%eax
+  805317:	01 c2                	add    %eax,%edx
+  805319:	83 e2 1f             	and    $0x1f,%edx
+  80531c:	29 c2                	sub    %eax,%edx
+  80531e:	89 d0                	mov    %edx,%eax
+  805320:	0f b6 09             	movzbl (%rcx),%ecx
+  805323:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805327:	48 98                	cltq
+  805329:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  80532d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805331:	8b 40 04             	mov    0x4(%rax),%eax
+  805334:	8d 50 01             	lea    0x1(%rax),%edx
+  805337:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80533b:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  80533e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805343:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805347:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80534b:	72 94                	jb     8052e1 <devpipe_write+0x9b>
+	}
+
+	return i;
+  80534d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805351:	48 83 c4 40          	add    $0x40,%rsp
+  805355:	5b                   	pop    %rbx
+  805356:	41 5f                	pop    %r15
+  805358:	5d                   	pop    %rbp
+  805359:	c3                   	ret
+
+000000000080535a <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80535a:	55                   	push   %rbp
+  80535b:	48 89 e5             	mov    %rsp,%rbp
+  80535e:	41 57                	push   %r15
+  805360:	53                   	push   %rbx
+  805361:	48 83 ec 20          	sub    $0x20,%rsp
+  805365:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805365 <devpipe_stat+0xb>
+  80536c:	49 bb d3 2c 00 00 00 	movabs $0x2cd3,%r11
+  805373:	00 00 00 
+  805376:	4c 01 db             	add    %r11,%rbx
+  805379:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80537d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805381:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805385:	48 89 c7             	mov    %rax,%rdi
+  805388:	49 89 df             	mov    %rbx,%r15
+  80538b:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  805392:	ff ff ff 
+  805395:	48 01 d8             	add    %rbx,%rax
+  805398:	ff d0                	call   *%rax
+  80539a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  80539e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053a2:	48 ba 11 e7 ff ff ff 	movabs $0xffffffffffffe711,%rdx
+  8053a9:	ff ff ff 
+  8053ac:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8053b0:	48 89 d6             	mov    %rdx,%rsi
+  8053b3:	48 89 c7             	mov    %rax,%rdi
+  8053b6:	49 89 df             	mov    %rbx,%r15
+  8053b9:	48 b8 46 93 ff ff ff 	movabs $0xffffffffffff9346,%rax
+  8053c0:	ff ff ff 
+  8053c3:	48 01 d8             	add    %rbx,%rax
+  8053c6:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8053c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053cc:	8b 50 04             	mov    0x4(%rax),%edx
+  8053cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053d3:	8b 00                	mov    (%rax),%eax
+  8053d5:	29 c2                	sub    %eax,%edx
+  8053d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053db:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8053e1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053e5:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8053ec:	00 00 00 
+	stat->st_dev = &devpipe;
+  8053ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053f3:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  8053fa:	00 00 00 
+  8053fd:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805401:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805408:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80540d:	48 83 c4 20          	add    $0x20,%rsp
+  805411:	5b                   	pop    %rbx
+  805412:	41 5f                	pop    %r15
+  805414:	5d                   	pop    %rbp
+  805415:	c3                   	ret
+
+0000000000805416 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805416:	55                   	push   %rbp
+  805417:	48 89 e5             	mov    %rsp,%rbp
+  80541a:	41 57                	push   %r15
+  80541c:	53                   	push   %rbx
+  80541d:	48 83 ec 10          	sub    $0x10,%rsp
+  805421:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805421 <devpipe_close+0xb>
+  805428:	49 bb 17 2c 00 00 00 	movabs $0x2c17,%r11
+  80542f:	00 00 00 
+  805432:	4c 01 db             	add    %r11,%rbx
+  805435:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805439:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80543d:	48 89 c6             	mov    %rax,%rsi
+  805440:	bf 00 00 00 00       	mov    $0x0,%edi
+  805445:	49 89 df             	mov    %rbx,%r15
+  805448:	48 b8 da a0 ff ff ff 	movabs $0xffffffffffffa0da,%rax
+  80544f:	ff ff ff 
+  805452:	48 01 d8             	add    %rbx,%rax
+  805455:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805457:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80545b:	48 89 c7             	mov    %rax,%rdi
+  80545e:	49 89 df             	mov    %rbx,%r15
+  805461:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  805468:	ff ff ff 
+  80546b:	48 01 d8             	add    %rbx,%rax
+  80546e:	ff d0                	call   *%rax
+  805470:	48 89 c6             	mov    %rax,%rsi
+  805473:	bf 00 00 00 00       	mov    $0x0,%edi
+  805478:	49 89 df             	mov    %rbx,%r15
+  80547b:	48 b8 da a0 ff ff ff 	movabs $0xffffffffffffa0da,%rax
+  805482:	ff ff ff 
+  805485:	48 01 d8             	add    %rbx,%rax
+  805488:	ff d0                	call   *%rax
+}
+  80548a:	48 83 c4 10          	add    $0x10,%rsp
+  80548e:	5b                   	pop    %rbx
+  80548f:	41 5f                	pop    %r15
+  805491:	5d                   	pop    %rbp
+  805492:	c3                   	ret
+
+0000000000805493 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  805493:	55                   	push   %rbp
+  805494:	48 89 e5             	mov    %rsp,%rbp
+  805497:	41 57                	push   %r15
+  805499:	48 83 ec 28          	sub    $0x28,%rsp
+  80549d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80549d <cputchar+0xa>
+  8054a4:	49 bb 9b 2b 00 00 00 	movabs $0x2b9b,%r11
+  8054ab:	00 00 00 
+  8054ae:	4c 01 d8             	add    %r11,%rax
+  8054b1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8054b4:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8054b7:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8054ba:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8054be:	be 01 00 00 00       	mov    $0x1,%esi
+  8054c3:	48 89 d7             	mov    %rdx,%rdi
+  8054c6:	49 89 c7             	mov    %rax,%r15
+  8054c9:	48 ba 4a 9e ff ff ff 	movabs $0xffffffffffff9e4a,%rdx
+  8054d0:	ff ff ff 
+  8054d3:	48 01 c2             	add    %rax,%rdx
+  8054d6:	ff d2                	call   *%rdx
+}
+  8054d8:	90                   	nop
+  8054d9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8054dd:	c9                   	leave
+  8054de:	c3                   	ret
+
+00000000008054df <getchar>:
+
+int
+getchar(void)
+{
+  8054df:	55                   	push   %rbp
+  8054e0:	48 89 e5             	mov    %rsp,%rbp
+  8054e3:	41 57                	push   %r15
+  8054e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8054e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054e9 <getchar+0xa>
+  8054f0:	49 bb 4f 2b 00 00 00 	movabs $0x2b4f,%r11
+  8054f7:	00 00 00 
+  8054fa:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8054fd:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805501:	ba 01 00 00 00       	mov    $0x1,%edx
+  805506:	48 89 ce             	mov    %rcx,%rsi
+  805509:	bf 00 00 00 00       	mov    $0x0,%edi
+  80550e:	49 89 c7             	mov    %rax,%r15
+  805511:	48 b9 a4 af ff ff ff 	movabs $0xffffffffffffafa4,%rcx
+  805518:	ff ff ff 
+  80551b:	48 01 c1             	add    %rax,%rcx
+  80551e:	ff d1                	call   *%rcx
+  805520:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  805523:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805527:	79 05                	jns    80552e <getchar+0x4f>
+		return r;
+  805529:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80552c:	eb 14                	jmp    805542 <getchar+0x63>
+	if (r < 1)
+  80552e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805532:	7f 07                	jg     80553b <getchar+0x5c>
+		return -E_EOF;
+  805534:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  805539:	eb 07                	jmp    805542 <getchar+0x63>
+	return c;
+  80553b:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  80553f:	0f b6 c0             	movzbl %al,%eax
+}
+  805542:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805546:	c9                   	leave
+  805547:	c3                   	ret
+
+0000000000805548 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  805548:	55                   	push   %rbp
+  805549:	48 89 e5             	mov    %rsp,%rbp
+  80554c:	41 57                	push   %r15
+  80554e:	53                   	push   %rbx
+  80554f:	48 83 ec 20          	sub    $0x20,%rsp
+  805553:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805553 <iscons+0xb>
+  80555a:	49 bb e5 2a 00 00 00 	movabs $0x2ae5,%r11
+  805561:	00 00 00 
+  805564:	4c 01 db             	add    %r11,%rbx
+  805567:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80556a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80556e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805571:	48 89 d6             	mov    %rdx,%rsi
+  805574:	89 c7                	mov    %eax,%edi
+  805576:	49 89 df             	mov    %rbx,%r15
+  805579:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  805580:	ff ff ff 
+  805583:	48 01 d8             	add    %rbx,%rax
+  805586:	ff d0                	call   *%rax
+  805588:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80558b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80558f:	79 05                	jns    805596 <iscons+0x4e>
+		return r;
+  805591:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805594:	eb 1b                	jmp    8055b1 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  805596:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80559a:	8b 10                	mov    (%rax),%edx
+  80559c:	48 b8 08 01 00 00 00 	movabs $0x108,%rax
+  8055a3:	00 00 00 
+  8055a6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8055a9:	39 c2                	cmp    %eax,%edx
+  8055ab:	0f 94 c0             	sete   %al
+  8055ae:	0f b6 c0             	movzbl %al,%eax
+}
+  8055b1:	48 83 c4 20          	add    $0x20,%rsp
+  8055b5:	5b                   	pop    %rbx
+  8055b6:	41 5f                	pop    %r15
+  8055b8:	5d                   	pop    %rbp
+  8055b9:	c3                   	ret
+
+00000000008055ba <opencons>:
+
+int
+opencons(void)
+{
+  8055ba:	55                   	push   %rbp
+  8055bb:	48 89 e5             	mov    %rsp,%rbp
+  8055be:	41 57                	push   %r15
+  8055c0:	53                   	push   %rbx
+  8055c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8055c5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055c5 <opencons+0xb>
+  8055cc:	49 bb 73 2a 00 00 00 	movabs $0x2a73,%r11
+  8055d3:	00 00 00 
+  8055d6:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8055d9:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8055dd:	48 89 c7             	mov    %rax,%rdi
+  8055e0:	49 89 df             	mov    %rbx,%r15
+  8055e3:	48 b8 a7 a9 ff ff ff 	movabs $0xffffffffffffa9a7,%rax
+  8055ea:	ff ff ff 
+  8055ed:	48 01 d8             	add    %rbx,%rax
+  8055f0:	ff d0                	call   *%rax
+  8055f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055f9:	79 05                	jns    805600 <opencons+0x46>
+		return r;
+  8055fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055fe:	eb 68                	jmp    805668 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805600:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805604:	ba 07 04 00 00       	mov    $0x407,%edx
+  805609:	48 89 c6             	mov    %rax,%rsi
+  80560c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805611:	49 89 df             	mov    %rbx,%r15
+  805614:	48 b8 02 a0 ff ff ff 	movabs $0xffffffffffffa002,%rax
+  80561b:	ff ff ff 
+  80561e:	48 01 d8             	add    %rbx,%rax
+  805621:	ff d0                	call   *%rax
+  805623:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805626:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80562a:	79 05                	jns    805631 <opencons+0x77>
+		return r;
+  80562c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80562f:	eb 37                	jmp    805668 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805631:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805635:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  80563c:	00 00 00 
+  80563f:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805642:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  805644:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805648:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  80564f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805653:	48 89 c7             	mov    %rax,%rdi
+  805656:	49 89 df             	mov    %rbx,%r15
+  805659:	48 b8 2d a9 ff ff ff 	movabs $0xffffffffffffa92d,%rax
+  805660:	ff ff ff 
+  805663:	48 01 d8             	add    %rbx,%rax
+  805666:	ff d0                	call   *%rax
+}
+  805668:	48 83 c4 10          	add    $0x10,%rsp
+  80566c:	5b                   	pop    %rbx
+  80566d:	41 5f                	pop    %r15
+  80566f:	5d                   	pop    %rbp
+  805670:	c3                   	ret
+
+0000000000805671 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805671:	55                   	push   %rbp
+  805672:	48 89 e5             	mov    %rsp,%rbp
+  805675:	41 57                	push   %r15
+  805677:	53                   	push   %rbx
+  805678:	48 83 ec 30          	sub    $0x30,%rsp
+  80567c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80567c <devcons_read+0xb>
+  805683:	49 bb bc 29 00 00 00 	movabs $0x29bc,%r11
+  80568a:	00 00 00 
+  80568d:	4c 01 db             	add    %r11,%rbx
+  805690:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805694:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805698:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  80569c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8056a1:	75 19                	jne    8056bc <devcons_read+0x4b>
+		return 0;
+  8056a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056a8:	eb 55                	jmp    8056ff <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8056aa:	49 89 df             	mov    %rbx,%r15
+  8056ad:	48 b8 ad 9f ff ff ff 	movabs $0xffffffffffff9fad,%rax
+  8056b4:	ff ff ff 
+  8056b7:	48 01 d8             	add    %rbx,%rax
+  8056ba:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8056bc:	49 89 df             	mov    %rbx,%r15
+  8056bf:	48 b8 a9 9e ff ff ff 	movabs $0xffffffffffff9ea9,%rax
+  8056c6:	ff ff ff 
+  8056c9:	48 01 d8             	add    %rbx,%rax
+  8056cc:	ff d0                	call   *%rax
+  8056ce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056d1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056d5:	74 d3                	je     8056aa <devcons_read+0x39>
+	if (c < 0)
+  8056d7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056db:	79 05                	jns    8056e2 <devcons_read+0x71>
+		return c;
+  8056dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056e0:	eb 1d                	jmp    8056ff <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8056e2:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8056e6:	75 07                	jne    8056ef <devcons_read+0x7e>
+		return 0;
+  8056e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056ed:	eb 10                	jmp    8056ff <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8056ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056f2:	89 c2                	mov    %eax,%edx
+  8056f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056f8:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8056fa:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8056ff:	48 83 c4 30          	add    $0x30,%rsp
+  805703:	5b                   	pop    %rbx
+  805704:	41 5f                	pop    %r15
+  805706:	5d                   	pop    %rbp
+  805707:	c3                   	ret
+
+0000000000805708 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805708:	55                   	push   %rbp
+  805709:	48 89 e5             	mov    %rsp,%rbp
+  80570c:	41 57                	push   %r15
+  80570e:	53                   	push   %rbx
+  80570f:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805716:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805716 <devcons_write+0xe>
+  80571d:	49 bb 22 29 00 00 00 	movabs $0x2922,%r11
+  805724:	00 00 00 
+  805727:	4c 01 db             	add    %r11,%rbx
+  80572a:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  805731:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  805738:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  80573f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805746:	e9 80 00 00 00       	jmp    8057cb <devcons_write+0xc3>
+		m = n - tot;
+  80574b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805752:	89 c2                	mov    %eax,%edx
+  805754:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805757:	29 c2                	sub    %eax,%edx
+  805759:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  80575c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80575f:	83 f8 7f             	cmp    $0x7f,%eax
+  805762:	76 07                	jbe    80576b <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  805764:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80576b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80576e:	48 63 d0             	movslq %eax,%rdx
+  805771:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805774:	48 63 c8             	movslq %eax,%rcx
+  805777:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80577e:	48 01 c1             	add    %rax,%rcx
+  805781:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805788:	48 89 ce             	mov    %rcx,%rsi
+  80578b:	48 89 c7             	mov    %rax,%rdi
+  80578e:	49 89 df             	mov    %rbx,%r15
+  805791:	48 b8 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rax
+  805798:	ff ff ff 
+  80579b:	48 01 d8             	add    %rbx,%rax
+  80579e:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8057a0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8057a3:	48 63 d0             	movslq %eax,%rdx
+  8057a6:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8057ad:	48 89 d6             	mov    %rdx,%rsi
+  8057b0:	48 89 c7             	mov    %rax,%rdi
+  8057b3:	49 89 df             	mov    %rbx,%r15
+  8057b6:	48 b8 4a 9e ff ff ff 	movabs $0xffffffffffff9e4a,%rax
+  8057bd:	ff ff ff 
+  8057c0:	48 01 d8             	add    %rbx,%rax
+  8057c3:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8057c5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8057c8:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8057cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057ce:	48 98                	cltq
+  8057d0:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8057d7:	0f 82 6e ff ff ff    	jb     80574b <devcons_write+0x43>
+	}
+	return tot;
+  8057dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8057e0:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8057e7:	5b                   	pop    %rbx
+  8057e8:	41 5f                	pop    %r15
+  8057ea:	5d                   	pop    %rbp
+  8057eb:	c3                   	ret
+
+00000000008057ec <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8057ec:	55                   	push   %rbp
+  8057ed:	48 89 e5             	mov    %rsp,%rbp
+  8057f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8057f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8057f4 <devcons_close+0x8>
+  8057fb:	49 bb 44 28 00 00 00 	movabs $0x2844,%r11
+  805802:	00 00 00 
+  805805:	4c 01 d8             	add    %r11,%rax
+  805808:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  80580c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805811:	c9                   	leave
+  805812:	c3                   	ret
+
+0000000000805813 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805813:	55                   	push   %rbp
+  805814:	48 89 e5             	mov    %rsp,%rbp
+  805817:	41 57                	push   %r15
+  805819:	48 83 ec 18          	sub    $0x18,%rsp
+  80581d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80581d <devcons_stat+0xa>
+  805824:	49 bb 1b 28 00 00 00 	movabs $0x281b,%r11
+  80582b:	00 00 00 
+  80582e:	4c 01 d8             	add    %r11,%rax
+  805831:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805835:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  805839:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80583d:	48 b9 1d e7 ff ff ff 	movabs $0xffffffffffffe71d,%rcx
+  805844:	ff ff ff 
+  805847:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80584b:	48 89 ce             	mov    %rcx,%rsi
+  80584e:	48 89 d7             	mov    %rdx,%rdi
+  805851:	49 89 c7             	mov    %rax,%r15
+  805854:	48 ba 46 93 ff ff ff 	movabs $0xffffffffffff9346,%rdx
+  80585b:	ff ff ff 
+  80585e:	48 01 c2             	add    %rax,%rdx
+  805861:	ff d2                	call   *%rdx
+	return 0;
+  805863:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805868:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80586c:	c9                   	leave
+  80586d:	c3                   	ret
+
+000000000080586e <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80586e:	55                   	push   %rbp
+  80586f:	48 89 e5             	mov    %rsp,%rbp
+  805872:	41 57                	push   %r15
+  805874:	53                   	push   %rbx
+  805875:	48 83 ec 30          	sub    $0x30,%rsp
+  805879:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805879 <ipc_recv+0xb>
+  805880:	49 bb bf 27 00 00 00 	movabs $0x27bf,%r11
+  805887:	00 00 00 
+  80588a:	4c 01 db             	add    %r11,%rbx
+  80588d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805891:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805895:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  805899:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80589e:	75 0e                	jne    8058ae <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8058a0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8058a7:	00 00 00 
+  8058aa:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8058ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8058b2:	48 89 c7             	mov    %rax,%rdi
+  8058b5:	49 89 df             	mov    %rbx,%r15
+  8058b8:	48 b8 2b a3 ff ff ff 	movabs $0xffffffffffffa32b,%rax
+  8058bf:	ff ff ff 
+  8058c2:	48 01 d8             	add    %rbx,%rax
+  8058c5:	ff d0                	call   *%rax
+  8058c7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8058ca:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8058cf:	74 2a                	je     8058fb <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8058d1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058d5:	75 19                	jne    8058f0 <ipc_recv+0x82>
+  8058d7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8058de:	ff ff ff 
+  8058e1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058e5:	48 8b 00             	mov    (%rax),%rax
+  8058e8:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8058ee:	eb 05                	jmp    8058f5 <ipc_recv+0x87>
+  8058f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058f5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8058f9:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8058fb:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805900:	74 2a                	je     80592c <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805902:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805906:	75 19                	jne    805921 <ipc_recv+0xb3>
+  805908:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80590f:	ff ff ff 
+  805912:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805916:	48 8b 00             	mov    (%rax),%rax
+  805919:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80591f:	eb 05                	jmp    805926 <ipc_recv+0xb8>
+  805921:	b8 00 00 00 00       	mov    $0x0,%eax
+  805926:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80592a:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80592c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805930:	74 05                	je     805937 <ipc_recv+0xc9>
+		return res;
+  805932:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805935:	eb 17                	jmp    80594e <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805937:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80593e:	ff ff ff 
+  805941:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805945:	48 8b 00             	mov    (%rax),%rax
+  805948:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80594e:	48 83 c4 30          	add    $0x30,%rsp
+  805952:	5b                   	pop    %rbx
+  805953:	41 5f                	pop    %r15
+  805955:	5d                   	pop    %rbp
+  805956:	c3                   	ret
+
+0000000000805957 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805957:	55                   	push   %rbp
+  805958:	48 89 e5             	mov    %rsp,%rbp
+  80595b:	41 57                	push   %r15
+  80595d:	53                   	push   %rbx
+  80595e:	48 83 ec 20          	sub    $0x20,%rsp
+  805962:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805962 <ipc_send+0xb>
+  805969:	49 bb d6 26 00 00 00 	movabs $0x26d6,%r11
+  805970:	00 00 00 
+  805973:	4c 01 db             	add    %r11,%rbx
+  805976:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805979:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80597c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805980:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805983:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805988:	75 0e                	jne    805998 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  80598a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805991:	00 00 00 
+  805994:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805998:	90                   	nop
+  805999:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80599c:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80599f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8059a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059a6:	89 c7                	mov    %eax,%edi
+  8059a8:	49 89 df             	mov    %rbx,%r15
+  8059ab:	48 b8 c1 a2 ff ff ff 	movabs $0xffffffffffffa2c1,%rax
+  8059b2:	ff ff ff 
+  8059b5:	48 01 d8             	add    %rbx,%rax
+  8059b8:	ff d0                	call   *%rax
+  8059ba:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8059bd:	74 da                	je     805999 <ipc_send+0x42>
+		;
+}
+  8059bf:	90                   	nop
+  8059c0:	90                   	nop
+  8059c1:	48 83 c4 20          	add    $0x20,%rsp
+  8059c5:	5b                   	pop    %rbx
+  8059c6:	41 5f                	pop    %r15
+  8059c8:	5d                   	pop    %rbp
+  8059c9:	c3                   	ret
+
+00000000008059ca <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8059ca:	55                   	push   %rbp
+  8059cb:	48 89 e5             	mov    %rsp,%rbp
+  8059ce:	41 57                	push   %r15
+  8059d0:	53                   	push   %rbx
+  8059d1:	48 83 ec 40          	sub    $0x40,%rsp
+  8059d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059d5 <ipc_call+0xb>
+  8059dc:	49 bb 63 26 00 00 00 	movabs $0x2663,%r11
+  8059e3:	00 00 00 
+  8059e6:	4c 01 db             	add    %r11,%rbx
+  8059e9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8059ec:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8059ef:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8059f3:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8059f6:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8059fa:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8059fe:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805a03:	75 0e                	jne    805a13 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805a05:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a0c:	00 00 00 
+  805a0f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805a13:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805a18:	75 0e                	jne    805a28 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805a1a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a21:	00 00 00 
+  805a24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805a28:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805a2b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805a2f:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805a32:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805a36:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a39:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805a3f:	49 89 f8             	mov    %rdi,%r8
+  805a42:	89 c7                	mov    %eax,%edi
+  805a44:	49 89 df             	mov    %rbx,%r15
+  805a47:	48 b8 84 a3 ff ff ff 	movabs $0xffffffffffffa384,%rax
+  805a4e:	ff ff ff 
+  805a51:	48 01 d8             	add    %rbx,%rax
+  805a54:	ff d0                	call   *%rax
+  805a56:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805a59:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805a5e:	74 2a                	je     805a8a <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805a60:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a64:	75 19                	jne    805a7f <ipc_call+0xb5>
+  805a66:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a6d:	ff ff ff 
+  805a70:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a74:	48 8b 00             	mov    (%rax),%rax
+  805a77:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805a7d:	eb 05                	jmp    805a84 <ipc_call+0xba>
+  805a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a84:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805a88:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805a8a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a8e:	74 05                	je     805a95 <ipc_call+0xcb>
+		return r;
+  805a90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a93:	eb 17                	jmp    805aac <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805a95:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a9c:	ff ff ff 
+  805a9f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805aa3:	48 8b 00             	mov    (%rax),%rax
+  805aa6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805aac:	48 83 c4 40          	add    $0x40,%rsp
+  805ab0:	5b                   	pop    %rbx
+  805ab1:	41 5f                	pop    %r15
+  805ab3:	5d                   	pop    %rbp
+  805ab4:	c3                   	ret
+
+0000000000805ab5 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805ab5:	55                   	push   %rbp
+  805ab6:	48 89 e5             	mov    %rsp,%rbp
+  805ab9:	41 57                	push   %r15
+  805abb:	53                   	push   %rbx
+  805abc:	48 83 ec 70          	sub    $0x70,%rsp
+  805ac0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ac0 <ipc_callw+0xb>
+  805ac7:	49 bb 78 25 00 00 00 	movabs $0x2578,%r11
+  805ace:	00 00 00 
+  805ad1:	4c 01 db             	add    %r11,%rbx
+  805ad4:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805ad7:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805ada:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805ade:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805ae2:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805ae7:	76 0a                	jbe    805af3 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805ae9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805aee:	e9 b7 00 00 00       	jmp    805baa <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805af3:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805af7:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805afb:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805aff:	48 89 ce             	mov    %rcx,%rsi
+  805b02:	48 89 c7             	mov    %rax,%rdi
+  805b05:	49 89 df             	mov    %rbx,%r15
+  805b08:	48 b8 26 97 ff ff ff 	movabs $0xffffffffffff9726,%rax
+  805b0f:	ff ff ff 
+  805b12:	48 01 d8             	add    %rbx,%rax
+  805b15:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805b17:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805b1e:	00 
+  805b1f:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b27:	48 01 d0             	add    %rdx,%rax
+  805b2a:	48 83 e8 01          	sub    $0x1,%rax
+  805b2e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805b32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b36:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b3b:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805b3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b43:	48 29 d0             	sub    %rdx,%rax
+  805b46:	48 c1 e8 03          	shr    $0x3,%rax
+  805b4a:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805b4e:	89 c1                	mov    %eax,%ecx
+  805b50:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805b53:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805b57:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805b5a:	49 89 d1             	mov    %rdx,%r9
+  805b5d:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805b64:	00 00 00 
+  805b67:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805b6e:	00 00 00 
+  805b71:	89 c7                	mov    %eax,%edi
+  805b73:	49 89 df             	mov    %rbx,%r15
+  805b76:	48 b8 84 a3 ff ff ff 	movabs $0xffffffffffffa384,%rax
+  805b7d:	ff ff ff 
+  805b80:	48 01 d8             	add    %rbx,%rax
+  805b83:	ff d0                	call   *%rax
+  805b85:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805b88:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805b8c:	74 05                	je     805b93 <ipc_callw+0xde>
+		return r;
+  805b8e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b91:	eb 17                	jmp    805baa <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805b93:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b9a:	ff ff ff 
+  805b9d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ba1:	48 8b 00             	mov    (%rax),%rax
+  805ba4:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805baa:	48 83 c4 70          	add    $0x70,%rsp
+  805bae:	5b                   	pop    %rbx
+  805baf:	41 5f                	pop    %r15
+  805bb1:	5d                   	pop    %rbp
+  805bb2:	c3                   	ret
+
+0000000000805bb3 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805bb3:	55                   	push   %rbp
+  805bb4:	48 89 e5             	mov    %rsp,%rbp
+  805bb7:	41 57                	push   %r15
+  805bb9:	53                   	push   %rbx
+  805bba:	48 83 ec 40          	sub    $0x40,%rsp
+  805bbe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bbe <ipc_callv+0xb>
+  805bc5:	49 bb 7a 24 00 00 00 	movabs $0x247a,%r11
+  805bcc:	00 00 00 
+  805bcf:	4c 01 db             	add    %r11,%rbx
+  805bd2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805bd5:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805bd8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805bdc:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805bdf:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805be3:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805be7:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805bee:	00 00 00 
+  805bf1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805bf5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805bf9:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805bfd:	74 11                	je     805c10 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805bff:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805c03:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805c07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805c0a:	c1 e0 14             	shl    $0x14,%eax
+  805c0d:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805c10:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805c14:	74 14                	je     805c2a <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805c16:	8b 45 20             	mov    0x20(%rbp),%eax
+  805c19:	83 e8 01             	sub    $0x1,%eax
+  805c1c:	48 63 d0             	movslq %eax,%rdx
+  805c1f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805c23:	48 09 d0             	or     %rdx,%rax
+  805c26:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805c2a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805c2d:	c1 e0 10             	shl    $0x10,%eax
+  805c30:	0b 45 10             	or     0x10(%rbp),%eax
+  805c33:	89 c1                	mov    %eax,%ecx
+  805c35:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805c38:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805c3c:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805c40:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805c44:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c47:	4d 89 c1             	mov    %r8,%r9
+  805c4a:	49 89 f8             	mov    %rdi,%r8
+  805c4d:	89 c7                	mov    %eax,%edi
+  805c4f:	49 89 df             	mov    %rbx,%r15
+  805c52:	48 b8 84 a3 ff ff ff 	movabs $0xffffffffffffa384,%rax
+  805c59:	ff ff ff 
+  805c5c:	48 01 d8             	add    %rbx,%rax
+  805c5f:	ff d0                	call   *%rax
+  805c61:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805c64:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805c68:	74 05                	je     805c6f <ipc_callv+0xbc>
+		return r;
+  805c6a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c6d:	eb 17                	jmp    805c86 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805c6f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c76:	ff ff ff 
+  805c79:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c7d:	48 8b 00             	mov    (%rax),%rax
+  805c80:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805c86:	48 83 c4 40          	add    $0x40,%rsp
+  805c8a:	5b                   	pop    %rbx
+  805c8b:	41 5f                	pop    %r15
+  805c8d:	5d                   	pop    %rbp
+  805c8e:	c3                   	ret
+
+0000000000805c8f <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805c8f:	55                   	push   %rbp
+  805c90:	48 89 e5             	mov    %rsp,%rbp
+  805c93:	41 57                	push   %r15
+  805c95:	53                   	push   %rbx
+  805c96:	48 83 ec 40          	sub    $0x40,%rsp
+  805c9a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c9a <ipc_reply_recv+0xb>
+  805ca1:	49 bb 9e 23 00 00 00 	movabs $0x239e,%r11
+  805ca8:	00 00 00 
+  805cab:	4c 01 db             	add    %r11,%rbx
+  805cae:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805cb1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805cb4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805cb8:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805cbb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805cbf:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805cc3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805cc8:	75 0e                	jne    805cd8 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805cca:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805cd1:	00 00 00 
+  805cd4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805cd8:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805cdd:	75 0e                	jne    805ced <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805cdf:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805ce6:	00 00 00 
+  805ce9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805ced:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805cf0:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805cf4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805cf8:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805cfb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805cff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d02:	4d 89 c1             	mov    %r8,%r9
+  805d05:	49 89 f8             	mov    %rdi,%r8
+  805d08:	89 c7                	mov    %eax,%edi
+  805d0a:	49 89 df             	mov    %rbx,%r15
+  805d0d:	48 b8 f8 a3 ff ff ff 	movabs $0xffffffffffffa3f8,%rax
+  805d14:	ff ff ff 
+  805d17:	48 01 d8             	add    %rbx,%rax
+  805d1a:	ff d0                	call   *%rax
+  805d1c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805d1f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805d24:	74 2a                	je     805d50 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805d26:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d2a:	75 19                	jne    805d45 <ipc_reply_recv+0xb6>
+  805d2c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d33:	ff ff ff 
+  805d36:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d3a:	48 8b 00             	mov    (%rax),%rax
+  805d3d:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805d43:	eb 05                	jmp    805d4a <ipc_reply_recv+0xbb>
+  805d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805d4e:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805d50:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805d55:	74 2a                	je     805d81 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805d57:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d5b:	75 19                	jne    805d76 <ipc_reply_recv+0xe7>
+  805d5d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d64:	ff ff ff 
+  805d67:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d6b:	48 8b 00             	mov    (%rax),%rax
+  805d6e:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805d74:	eb 05                	jmp    805d7b <ipc_reply_recv+0xec>
+  805d76:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d7b:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805d7f:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805d81:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d85:	74 05                	je     805d8c <ipc_reply_recv+0xfd>
+		return r;
+  805d87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d8a:	eb 17                	jmp    805da3 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805d8c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d93:	ff ff ff 
+  805d96:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d9a:	48 8b 00             	mov    (%rax),%rax
+  805d9d:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805da3:	48 83 c4 40          	add    $0x40,%rsp
+  805da7:	5b                   	pop    %rbx
+  805da8:	41 5f                	pop    %r15
+  805daa:	5d                   	pop    %rbp
+  805dab:	c3                   	ret
+
+0000000000805dac <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805dac:	55                   	push   %rbp
+  805dad:	48 89 e5             	mov    %rsp,%rbp
+  805db0:	41 57                	push   %r15
+  805db2:	53                   	push   %rbx
+  805db3:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805dba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805dba <ipc_window_batch+0xe>
+  805dc1:	49 bb 7e 22 00 00 00 	movabs $0x227e,%r11
+  805dc8:	00 00 00 
+  805dcb:	4c 01 db             	add    %r11,%rbx
+  805dce:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805dd4:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805ddb:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805de1:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805de7:	e9 15 01 00 00       	jmp    805f01 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805dec:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805df2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805df5:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805dfc:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805dff:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805e02:	39 c2                	cmp    %eax,%edx
+  805e04:	0f 4e c2             	cmovle %edx,%eax
+  805e07:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805e0a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805e11:	eb 6b                	jmp    805e7e <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805e13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e16:	48 98                	cltq
+  805e18:	48 c1 e0 05          	shl    $0x5,%rax
+  805e1c:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805e20:	48 01 e8             	add    %rbp,%rax
+  805e23:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805e29:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805e2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e32:	c1 e0 0c             	shl    $0xc,%eax
+  805e35:	48 63 d0             	movslq %eax,%rdx
+  805e38:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805e3f:	48 01 c2             	add    %rax,%rdx
+  805e42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e45:	48 98                	cltq
+  805e47:	48 c1 e0 05          	shl    $0x5,%rax
+  805e4b:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805e4f:	48 01 e8             	add    %rbp,%rax
+  805e52:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805e58:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805e5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e5e:	48 98                	cltq
+  805e60:	48 c1 e0 05          	shl    $0x5,%rax
+  805e64:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805e68:	48 01 e8             	add    %rbp,%rax
+  805e6b:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805e72:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805e78:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805e7a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805e7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e81:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805e84:	7c 8d                	jl     805e13 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805e86:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805e8d:	74 27                	je     805eb6 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805e8f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805e92:	48 63 d0             	movslq %eax,%rdx
+  805e95:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805e9c:	48 89 d6             	mov    %rdx,%rsi
+  805e9f:	48 89 c7             	mov    %rax,%rdi
+  805ea2:	49 89 df             	mov    %rbx,%r15
+  805ea5:	48 b8 9b a6 ff ff ff 	movabs $0xffffffffffffa69b,%rax
+  805eac:	ff ff ff 
+  805eaf:	48 01 d8             	add    %rbx,%rax
+  805eb2:	ff d0                	call   *%rax
+  805eb4:	eb 25                	jmp    805edb <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805eb6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805eb9:	48 63 d0             	movslq %eax,%rdx
+  805ebc:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805ec3:	48 89 d6             	mov    %rdx,%rsi
+  805ec6:	48 89 c7             	mov    %rax,%rdi
+  805ec9:	49 89 df             	mov    %rbx,%r15
+  805ecc:	48 b8 f9 a6 ff ff ff 	movabs $0xffffffffffffa6f9,%rax
+  805ed3:	ff ff ff 
+  805ed6:	48 01 d8             	add    %rbx,%rax
+  805ed9:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805edb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805ede:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805ee2:	79 05                	jns    805ee9 <ipc_window_batch+0x13d>
+			return r;
+  805ee4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ee7:	eb 2a                	jmp    805f13 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805ee9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805eec:	c1 e0 0c             	shl    $0xc,%eax
+  805eef:	48 98                	cltq
+  805ef1:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805ef8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805efb:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805f01:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805f08:	0f 8f de fe ff ff    	jg     805dec <ipc_window_batch+0x40>
+	}
+	return 0;
+  805f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805f13:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805f1a:	5b                   	pop    %rbx
+  805f1b:	41 5f                	pop    %r15
+  805f1d:	5d                   	pop    %rbp
+  805f1e:	c3                   	ret
+
+0000000000805f1f <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805f1f:	55                   	push   %rbp
+  805f20:	48 89 e5             	mov    %rsp,%rbp
+  805f23:	48 83 ec 10          	sub    $0x10,%rsp
+  805f27:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f27 <ipc_map_window+0x8>
+  805f2e:	49 bb 11 21 00 00 00 	movabs $0x2111,%r11
+  805f35:	00 00 00 
+  805f38:	4c 01 d8             	add    %r11,%rax
+  805f3b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f3f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805f42:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805f45:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805f49:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805f4e:	bf 01 00 00 00       	mov    $0x1,%edi
+  805f53:	49 b8 74 dd ff ff ff 	movabs $0xffffffffffffdd74,%r8
+  805f5a:	ff ff ff 
+  805f5d:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805f61:	ff d0                	call   *%rax
+}
+  805f63:	c9                   	leave
+  805f64:	c3                   	ret
+
+0000000000805f65 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805f65:	55                   	push   %rbp
+  805f66:	48 89 e5             	mov    %rsp,%rbp
+  805f69:	48 83 ec 10          	sub    $0x10,%rsp
+  805f6d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f6d <ipc_unmap_window+0x8>
+  805f74:	49 bb cb 20 00 00 00 	movabs $0x20cb,%r11
+  805f7b:	00 00 00 
+  805f7e:	4c 01 d8             	add    %r11,%rax
+  805f81:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f85:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805f88:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805f8b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805f8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805f94:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f99:	49 b8 74 dd ff ff ff 	movabs $0xffffffffffffdd74,%r8
+  805fa0:	ff ff ff 
+  805fa3:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805fa7:	ff d0                	call   *%rax
+}
+  805fa9:	c9                   	leave
+  805faa:	c3                   	ret
+
+0000000000805fab <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805fab:	55                   	push   %rbp
+  805fac:	48 89 e5             	mov    %rsp,%rbp
+  805faf:	48 83 ec 18          	sub    $0x18,%rsp
+  805fb3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805fb3 <ipc_find_env+0x8>
+  805fba:	49 bb 85 20 00 00 00 	movabs $0x2085,%r11
+  805fc1:	00 00 00 
+  805fc4:	4c 01 d8             	add    %r11,%rax
+  805fc7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805fca:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805fd1:	eb 57                	jmp    80602a <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805fd3:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805fda:	ff ff ff 
+  805fdd:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805fe1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805fe4:	48 63 d2             	movslq %edx,%rdx
+  805fe7:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805fee:	48 01 ca             	add    %rcx,%rdx
+  805ff1:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805ff8:	8b 12                	mov    (%rdx),%edx
+  805ffa:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805ffd:	75 27                	jne    806026 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805fff:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  806006:	ff ff ff 
+  806009:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80600d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806010:	48 98                	cltq
+  806012:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806019:	48 01 d0             	add    %rdx,%rax
+  80601c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806022:	8b 00                	mov    (%rax),%eax
+  806024:	eb 12                	jmp    806038 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806026:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80602a:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806031:	7e a0                	jle    805fd3 <ipc_find_env+0x28>
+	}
+	return 0;
+  806033:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806038:	c9                   	leave
+  806039:	c3                   	ret
+
+000000000080603a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80603a:	55                   	push   %rbp
+  80603b:	48 89 e5             	mov    %rsp,%rbp
+  80603e:	48 83 ec 18          	sub    $0x18,%rsp
+  806042:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806042 <pageref+0x8>
+  806049:	49 bb f6 1f 00 00 00 	movabs $0x1ff6,%r11
+  806050:	00 00 00 
+  806053:	4c 01 d8             	add    %r11,%rax
+  806056:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80605a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80605e:	48 89 d1             	mov    %rdx,%rcx
+  806061:	48 c1 e9 15          	shr    $0x15,%rcx
+  806065:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80606c:	ff ff ff 
+  80606f:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806073:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806077:	83 e2 01             	and    $0x1,%edx
+  80607a:	48 85 d2             	test   %rdx,%rdx
+  80607d:	75 07                	jne    806086 <pageref+0x4c>
+		return 0;
+  80607f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806084:	eb 64                	jmp    8060ea <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806086:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80608a:	48 89 d1             	mov    %rdx,%rcx
+  80608d:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806091:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806098:	ff ff ff 
+  80609b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80609f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8060a3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8060a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8060ab:	83 e2 01             	and    $0x1,%edx
+  8060ae:	48 85 d2             	test   %rdx,%rdx
+  8060b1:	75 07                	jne    8060ba <pageref+0x80>
+		return 0;
+  8060b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060b8:	eb 30                	jmp    8060ea <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8060ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8060be:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8060c2:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  8060c9:	ff ff ff 
+  8060cc:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8060d0:	48 89 d0             	mov    %rdx,%rax
+  8060d3:	48 01 c0             	add    %rax,%rax
+  8060d6:	48 01 d0             	add    %rdx,%rax
+  8060d9:	48 c1 e0 03          	shl    $0x3,%rax
+  8060dd:	48 01 c8             	add    %rcx,%rax
+  8060e0:	48 83 c0 08          	add    $0x8,%rax
+  8060e4:	0f b7 00             	movzwl (%rax),%eax
+  8060e7:	0f b7 c0             	movzwl %ax,%eax
+}
+  8060ea:	c9                   	leave
+  8060eb:	c3                   	ret
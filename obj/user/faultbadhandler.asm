@@ -0,0 +1,9270 @@
+
+obj/user/faultbadhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 80 00 00 00       	call   8000c1 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 10          	sub    $0x10,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb e2 7f 00 00 00 	movabs $0x7fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800065:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	sys_page_alloc(0, (void*) (UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  800069:	ba 07 00 00 00       	mov    $0x7,%edx
+  80006e:	b8 00 f0 7f ef       	mov    $0xef7ff000,%eax
+  800073:	48 89 c6             	mov    %rax,%rsi
+  800076:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007b:	49 89 df             	mov    %rbx,%r15
+  80007e:	48 b8 bc 85 ff ff ff 	movabs $0xffffffffffff85bc,%rax
+  800085:	ff ff ff 
+  800088:	48 01 d8             	add    %rbx,%rax
+  80008b:	ff d0                	call   *%rax
+	sys_env_set_pgfault_upcall(0, (void*) 0xDeadBeef);
+  80008d:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  800092:	48 89 c6             	mov    %rax,%rsi
+  800095:	bf 00 00 00 00       	mov    $0x0,%edi
+  80009a:	49 89 df             	mov    %rbx,%r15
+  80009d:	48 b8 b2 87 ff ff ff 	movabs $0xffffffffffff87b2,%rax
+  8000a4:	ff ff ff 
+  8000a7:	48 01 d8             	add    %rbx,%rax
+  8000aa:	ff d0                	call   *%rax
+	*(int*)0 = 0;
+  8000ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8000b7:	90                   	nop
+  8000b8:	48 83 c4 10          	add    $0x10,%rsp
+  8000bc:	5b                   	pop    %rbx
+  8000bd:	41 5f                	pop    %r15
+  8000bf:	5d                   	pop    %rbp
+  8000c0:	c3                   	ret
+
+00000000008000c1 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c1:	55                   	push   %rbp
+  8000c2:	48 89 e5             	mov    %rsp,%rbp
+  8000c5:	41 57                	push   %r15
+  8000c7:	53                   	push   %rbx
+  8000c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8000cc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000cc <libmain+0xb>
+  8000d3:	49 bb 64 7f 00 00 00 	movabs $0x7f64,%r11
+  8000da:	00 00 00 
+  8000dd:	4c 01 db             	add    %r11,%rbx
+  8000e0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8000e3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8000e7:	49 89 df             	mov    %rbx,%r15
+  8000ea:	48 b8 13 85 ff ff ff 	movabs $0xffffffffffff8513,%rax
+  8000f1:	ff ff ff 
+  8000f4:	48 01 d8             	add    %rbx,%rax
+  8000f7:	ff d0                	call   *%rax
+  8000f9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8000fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000ff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800104:	48 98                	cltq
+  800106:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80010d:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  800114:	ff ff ff 
+  800117:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80011b:	48 01 c2             	add    %rax,%rdx
+  80011e:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  800125:	00 00 00 
+  800128:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80012c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800130:	7e 15                	jle    800147 <libmain+0x86>
+		binaryname = argv[0];
+  800132:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800136:	48 8b 00             	mov    (%rax),%rax
+  800139:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  800140:	00 00 00 
+  800143:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800147:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80014b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80014e:	48 89 d6             	mov    %rdx,%rsi
+  800151:	89 c7                	mov    %eax,%edi
+  800153:	49 89 df             	mov    %rbx,%r15
+  800156:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  80015d:	ff ff ff 
+  800160:	48 01 d8             	add    %rbx,%rax
+  800163:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800165:	49 89 df             	mov    %rbx,%r15
+  800168:	48 b8 51 81 ff ff ff 	movabs $0xffffffffffff8151,%rax
+  80016f:	ff ff ff 
+  800172:	48 01 d8             	add    %rbx,%rax
+  800175:	ff d0                	call   *%rax
+}
+  800177:	90                   	nop
+  800178:	48 83 c4 20          	add    $0x20,%rsp
+  80017c:	5b                   	pop    %rbx
+  80017d:	41 5f                	pop    %r15
+  80017f:	5d                   	pop    %rbp
+  800180:	c3                   	ret
+
+0000000000800181 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800181:	55                   	push   %rbp
+  800182:	48 89 e5             	mov    %rsp,%rbp
+  800185:	41 57                	push   %r15
+  800187:	53                   	push   %rbx
+  800188:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800188 <exit+0x7>
+  80018f:	49 bb a8 7e 00 00 00 	movabs $0x7ea8,%r11
+  800196:	00 00 00 
+  800199:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80019c:	49 89 df             	mov    %rbx,%r15
+  80019f:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  8001a6:	ff ff ff 
+  8001a9:	48 01 d8             	add    %rbx,%rax
+  8001ac:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8001ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001b3:	49 89 df             	mov    %rbx,%r15
+  8001b6:	48 b8 b7 84 ff ff ff 	movabs $0xffffffffffff84b7,%rax
+  8001bd:	ff ff ff 
+  8001c0:	48 01 d8             	add    %rbx,%rax
+  8001c3:	ff d0                	call   *%rax
+}
+  8001c5:	90                   	nop
+  8001c6:	5b                   	pop    %rbx
+  8001c7:	41 5f                	pop    %r15
+  8001c9:	5d                   	pop    %rbp
+  8001ca:	c3                   	ret
+
+00000000008001cb <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  8001cb:	55                   	push   %rbp
+  8001cc:	48 89 e5             	mov    %rsp,%rbp
+  8001cf:	41 57                	push   %r15
+  8001d1:	53                   	push   %rbx
+  8001d2:	48 83 ec 40          	sub    $0x40,%rsp
+  8001d6:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8001d6 <syscall+0xb>
+  8001dd:	49 bb 5a 7e 00 00 00 	movabs $0x7e5a,%r11
+  8001e4:	00 00 00 
+  8001e7:	4d 01 da             	add    %r11,%r10
+  8001ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8001ed:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8001f0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8001f4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8001f8:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8001fc:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  800200:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800203:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800207:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80020b:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80020f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  800213:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800217:	4c 89 c3             	mov    %r8,%rbx
+  80021a:	cd 30                	int    $0x30
+  80021c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  800220:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800224:	74 52                	je     800278 <syscall+0xad>
+  800226:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80022b:	7e 4b                	jle    800278 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80022d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800231:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800234:	49 89 d0             	mov    %rdx,%r8
+  800237:	89 c1                	mov    %eax,%ecx
+  800239:	48 b8 2a de ff ff ff 	movabs $0xffffffffffffde2a,%rax
+  800240:	ff ff ff 
+  800243:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800247:	48 89 c2             	mov    %rax,%rdx
+  80024a:	be 23 00 00 00       	mov    $0x23,%esi
+  80024f:	48 b8 47 de ff ff ff 	movabs $0xffffffffffffde47,%rax
+  800256:	ff ff ff 
+  800259:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80025d:	48 89 c7             	mov    %rax,%rdi
+  800260:	4d 89 d7             	mov    %r10,%r15
+  800263:	b8 00 00 00 00       	mov    $0x0,%eax
+  800268:	49 b9 6e bc ff ff ff 	movabs $0xffffffffffffbc6e,%r9
+  80026f:	ff ff ff 
+  800272:	4d 01 d1             	add    %r10,%r9
+  800275:	41 ff d1             	call   *%r9
+
+	return ret;
+  800278:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80027c:	48 83 c4 40          	add    $0x40,%rsp
+  800280:	5b                   	pop    %rbx
+  800281:	41 5f                	pop    %r15
+  800283:	5d                   	pop    %rbp
+  800284:	c3                   	ret
+
+0000000000800285 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  800285:	55                   	push   %rbp
+  800286:	48 89 e5             	mov    %rsp,%rbp
+  800289:	41 57                	push   %r15
+  80028b:	41 56                	push   %r14
+  80028d:	41 55                	push   %r13
+  80028f:	41 54                	push   %r12
+  800291:	53                   	push   %rbx
+  800292:	48 83 ec 48          	sub    $0x48,%rsp
+  800296:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 800296 <syscall_words+0x11>
+  80029d:	49 bb 9a 7d 00 00 00 	movabs $0x7d9a,%r11
+  8002a4:	00 00 00 
+  8002a7:	4d 01 de             	add    %r11,%r14
+  8002aa:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8002ad:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  8002b0:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  8002b4:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8002b8:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  8002bc:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  8002c0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002c5:	74 09                	je     8002d0 <syscall_words+0x4b>
+  8002c7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002cb:	48 8b 00             	mov    (%rax),%rax
+  8002ce:	eb 05                	jmp    8002d5 <syscall_words+0x50>
+  8002d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d5:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  8002d8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002dd:	74 0a                	je     8002e9 <syscall_words+0x64>
+  8002df:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002e3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8002e7:	eb 05                	jmp    8002ee <syscall_words+0x69>
+  8002e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ee:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  8002f1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002f6:	74 0a                	je     800302 <syscall_words+0x7d>
+  8002f8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002fc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800300:	eb 05                	jmp    800307 <syscall_words+0x82>
+  800302:	b8 00 00 00 00       	mov    $0x0,%eax
+  800307:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  80030a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80030f:	74 0a                	je     80031b <syscall_words+0x96>
+  800311:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800315:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800319:	eb 05                	jmp    800320 <syscall_words+0x9b>
+  80031b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800320:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  800323:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800328:	74 0a                	je     800334 <syscall_words+0xaf>
+  80032a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80032e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800332:	eb 05                	jmp    800339 <syscall_words+0xb4>
+  800334:	b8 00 00 00 00       	mov    $0x0,%eax
+  800339:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  80033c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800341:	74 0a                	je     80034d <syscall_words+0xc8>
+  800343:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800347:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80034b:	eb 05                	jmp    800352 <syscall_words+0xcd>
+  80034d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800352:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  800355:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800358:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80035c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800360:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  800364:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800368:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80036c:	cd 30                	int    $0x30
+  80036e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  800372:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800377:	74 50                	je     8003c9 <syscall_words+0x144>
+		words[0] = r8;
+  800379:	4c 89 c2             	mov    %r8,%rdx
+  80037c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800380:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  800383:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800387:	48 83 c0 08          	add    $0x8,%rax
+  80038b:	4c 89 ca             	mov    %r9,%rdx
+  80038e:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  800391:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800395:	48 83 c0 10          	add    $0x10,%rax
+  800399:	4c 89 d2             	mov    %r10,%rdx
+  80039c:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  80039f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8003a3:	48 83 c0 18          	add    $0x18,%rax
+  8003a7:	4c 89 da             	mov    %r11,%rdx
+  8003aa:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  8003ad:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8003b1:	48 83 c0 20          	add    $0x20,%rax
+  8003b5:	4c 89 e2             	mov    %r12,%rdx
+  8003b8:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  8003bb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8003bf:	48 83 c0 28          	add    $0x28,%rax
+  8003c3:	4c 89 ea             	mov    %r13,%rdx
+  8003c6:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  8003c9:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8003cd:	74 52                	je     800421 <syscall_words+0x19c>
+  8003cf:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8003d4:	7e 4b                	jle    800421 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003d6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8003da:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8003dd:	49 89 d0             	mov    %rdx,%r8
+  8003e0:	89 c1                	mov    %eax,%ecx
+  8003e2:	48 b8 2a de ff ff ff 	movabs $0xffffffffffffde2a,%rax
+  8003e9:	ff ff ff 
+  8003ec:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8003f0:	48 89 c2             	mov    %rax,%rdx
+  8003f3:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8003f8:	48 b8 47 de ff ff ff 	movabs $0xffffffffffffde47,%rax
+  8003ff:	ff ff ff 
+  800402:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  800406:	48 89 c7             	mov    %rax,%rdi
+  800409:	4d 89 f7             	mov    %r14,%r15
+  80040c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800411:	49 b9 6e bc ff ff ff 	movabs $0xffffffffffffbc6e,%r9
+  800418:	ff ff ff 
+  80041b:	4d 01 f1             	add    %r14,%r9
+  80041e:	41 ff d1             	call   *%r9
+
+	return ret;
+  800421:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  800425:	48 83 c4 48          	add    $0x48,%rsp
+  800429:	5b                   	pop    %rbx
+  80042a:	41 5c                	pop    %r12
+  80042c:	41 5d                	pop    %r13
+  80042e:	41 5e                	pop    %r14
+  800430:	41 5f                	pop    %r15
+  800432:	5d                   	pop    %rbp
+  800433:	c3                   	ret
+
+0000000000800434 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800434:	55                   	push   %rbp
+  800435:	48 89 e5             	mov    %rsp,%rbp
+  800438:	48 83 ec 10          	sub    $0x10,%rsp
+  80043c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80043c <sys_cputs+0x8>
+  800443:	49 bb f4 7b 00 00 00 	movabs $0x7bf4,%r11
+  80044a:	00 00 00 
+  80044d:	4c 01 d8             	add    %r11,%rax
+  800450:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800454:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800458:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80045c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800460:	48 83 ec 08          	sub    $0x8,%rsp
+  800464:	6a 00                	push   $0x0
+  800466:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80046c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800472:	be 00 00 00 00       	mov    $0x0,%esi
+  800477:	bf 00 00 00 00       	mov    $0x0,%edi
+  80047c:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800483:	ff ff ff 
+  800486:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80048a:	ff d0                	call   *%rax
+  80048c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800490:	90                   	nop
+  800491:	c9                   	leave
+  800492:	c3                   	ret
+
+0000000000800493 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800493:	55                   	push   %rbp
+  800494:	48 89 e5             	mov    %rsp,%rbp
+  800497:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800497 <sys_cgetc+0x4>
+  80049e:	49 bb 99 7b 00 00 00 	movabs $0x7b99,%r11
+  8004a5:	00 00 00 
+  8004a8:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8004ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8004af:	6a 00                	push   $0x0
+  8004b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8004cc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004d1:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  8004d8:	ff ff ff 
+  8004db:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8004df:	ff d0                	call   *%rax
+  8004e1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004e5:	c9                   	leave
+  8004e6:	c3                   	ret
+
+00000000008004e7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8004e7:	55                   	push   %rbp
+  8004e8:	48 89 e5             	mov    %rsp,%rbp
+  8004eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8004ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8004ef <sys_env_destroy+0x8>
+  8004f6:	49 bb 41 7b 00 00 00 	movabs $0x7b41,%r11
+  8004fd:	00 00 00 
+  800500:	4c 01 d8             	add    %r11,%rax
+  800503:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  800506:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800509:	48 63 d2             	movslq %edx,%rdx
+  80050c:	48 83 ec 08          	sub    $0x8,%rsp
+  800510:	6a 00                	push   $0x0
+  800512:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800518:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80051e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800523:	be 01 00 00 00       	mov    $0x1,%esi
+  800528:	bf 03 00 00 00       	mov    $0x3,%edi
+  80052d:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800534:	ff ff ff 
+  800537:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80053b:	ff d0                	call   *%rax
+  80053d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800541:	c9                   	leave
+  800542:	c3                   	ret
+
+0000000000800543 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800543:	55                   	push   %rbp
+  800544:	48 89 e5             	mov    %rsp,%rbp
+  800547:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800547 <sys_getenvid+0x4>
+  80054e:	49 bb e9 7a 00 00 00 	movabs $0x7ae9,%r11
+  800555:	00 00 00 
+  800558:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80055b:	48 83 ec 08          	sub    $0x8,%rsp
+  80055f:	6a 00                	push   $0x0
+  800561:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800567:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80056d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800572:	ba 00 00 00 00       	mov    $0x0,%edx
+  800577:	be 00 00 00 00       	mov    $0x0,%esi
+  80057c:	bf 02 00 00 00       	mov    $0x2,%edi
+  800581:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800588:	ff ff ff 
+  80058b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80058f:	ff d0                	call   *%rax
+  800591:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800595:	c9                   	leave
+  800596:	c3                   	ret
+
+0000000000800597 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800597:	55                   	push   %rbp
+  800598:	48 89 e5             	mov    %rsp,%rbp
+  80059b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80059b <sys_yield+0x4>
+  8005a2:	49 bb 95 7a 00 00 00 	movabs $0x7a95,%r11
+  8005a9:	00 00 00 
+  8005ac:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8005af:	48 83 ec 08          	sub    $0x8,%rsp
+  8005b3:	6a 00                	push   $0x0
+  8005b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8005bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8005d0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8005d5:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  8005dc:	ff ff ff 
+  8005df:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8005e3:	ff d0                	call   *%rax
+  8005e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005e9:	90                   	nop
+  8005ea:	c9                   	leave
+  8005eb:	c3                   	ret
+
+00000000008005ec <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8005ec:	55                   	push   %rbp
+  8005ed:	48 89 e5             	mov    %rsp,%rbp
+  8005f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8005f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005f4 <sys_page_alloc+0x8>
+  8005fb:	49 bb 3c 7a 00 00 00 	movabs $0x7a3c,%r11
+  800602:	00 00 00 
+  800605:	4c 01 d8             	add    %r11,%rax
+  800608:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80060b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80060f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  800612:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800615:	48 63 f2             	movslq %edx,%rsi
+  800618:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80061c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80061f:	48 63 d2             	movslq %edx,%rdx
+  800622:	48 83 ec 08          	sub    $0x8,%rsp
+  800626:	6a 00                	push   $0x0
+  800628:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80062e:	49 89 f0             	mov    %rsi,%r8
+  800631:	be 01 00 00 00       	mov    $0x1,%esi
+  800636:	bf 04 00 00 00       	mov    $0x4,%edi
+  80063b:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800642:	ff ff ff 
+  800645:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800649:	ff d0                	call   *%rax
+  80064b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80064f:	c9                   	leave
+  800650:	c3                   	ret
+
+0000000000800651 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800651:	55                   	push   %rbp
+  800652:	48 89 e5             	mov    %rsp,%rbp
+  800655:	48 83 ec 20          	sub    $0x20,%rsp
+  800659:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800659 <sys_page_map+0x8>
+  800660:	49 bb d7 79 00 00 00 	movabs $0x79d7,%r11
+  800667:	00 00 00 
+  80066a:	4c 01 d8             	add    %r11,%rax
+  80066d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800670:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800674:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800677:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80067b:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80067f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800682:	48 63 f2             	movslq %edx,%rsi
+  800685:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  800689:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80068c:	48 63 fa             	movslq %edx,%rdi
+  80068f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800693:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800696:	48 63 d2             	movslq %edx,%rdx
+  800699:	48 83 ec 08          	sub    $0x8,%rsp
+  80069d:	56                   	push   %rsi
+  80069e:	4d 89 c1             	mov    %r8,%r9
+  8006a1:	49 89 f8             	mov    %rdi,%r8
+  8006a4:	be 01 00 00 00       	mov    $0x1,%esi
+  8006a9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8006ae:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  8006b5:	ff ff ff 
+  8006b8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8006bc:	ff d0                	call   *%rax
+  8006be:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006c2:	c9                   	leave
+  8006c3:	c3                   	ret
+
+00000000008006c4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8006c4:	55                   	push   %rbp
+  8006c5:	48 89 e5             	mov    %rsp,%rbp
+  8006c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8006cc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006cc <sys_page_unmap+0x8>
+  8006d3:	49 bb 64 79 00 00 00 	movabs $0x7964,%r11
+  8006da:	00 00 00 
+  8006dd:	4c 01 d8             	add    %r11,%rax
+  8006e0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8006e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8006e7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8006eb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8006ee:	48 63 d2             	movslq %edx,%rdx
+  8006f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f5:	6a 00                	push   $0x0
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800703:	be 01 00 00 00       	mov    $0x1,%esi
+  800708:	bf 06 00 00 00       	mov    $0x6,%edi
+  80070d:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800714:	ff ff ff 
+  800717:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80071b:	ff d0                	call   *%rax
+  80071d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800721:	c9                   	leave
+  800722:	c3                   	ret
+
+0000000000800723 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800723:	55                   	push   %rbp
+  800724:	48 89 e5             	mov    %rsp,%rbp
+  800727:	48 83 ec 10          	sub    $0x10,%rsp
+  80072b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80072b <sys_env_set_status+0x8>
+  800732:	49 bb 05 79 00 00 00 	movabs $0x7905,%r11
+  800739:	00 00 00 
+  80073c:	4c 01 d8             	add    %r11,%rax
+  80073f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800742:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800745:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800748:	48 63 ca             	movslq %edx,%rcx
+  80074b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80074e:	48 63 d2             	movslq %edx,%rdx
+  800751:	48 83 ec 08          	sub    $0x8,%rsp
+  800755:	6a 00                	push   $0x0
+  800757:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80075d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800763:	be 01 00 00 00       	mov    $0x1,%esi
+  800768:	bf 08 00 00 00       	mov    $0x8,%edi
+  80076d:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800774:	ff ff ff 
+  800777:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80077b:	ff d0                	call   *%rax
+  80077d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800781:	c9                   	leave
+  800782:	c3                   	ret
+
+0000000000800783 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800783:	55                   	push   %rbp
+  800784:	48 89 e5             	mov    %rsp,%rbp
+  800787:	48 83 ec 10          	sub    $0x10,%rsp
+  80078b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80078b <sys_env_set_trapframe+0x8>
+  800792:	49 bb a5 78 00 00 00 	movabs $0x78a5,%r11
+  800799:	00 00 00 
+  80079c:	4c 01 d8             	add    %r11,%rax
+  80079f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8007a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8007a6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8007aa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8007ad:	48 63 d2             	movslq %edx,%rdx
+  8007b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8007b4:	6a 00                	push   $0x0
+  8007b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8007c7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8007cc:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  8007d3:	ff ff ff 
+  8007d6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8007da:	ff d0                	call   *%rax
+  8007dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007e0:	c9                   	leave
+  8007e1:	c3                   	ret
+
+00000000008007e2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8007e2:	55                   	push   %rbp
+  8007e3:	48 89 e5             	mov    %rsp,%rbp
+  8007e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8007ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007ea <sys_env_set_pgfault_upcall+0x8>
+  8007f1:	49 bb 46 78 00 00 00 	movabs $0x7846,%r11
+  8007f8:	00 00 00 
+  8007fb:	4c 01 d8             	add    %r11,%rax
+  8007fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800801:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  800805:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800809:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80080c:	48 63 d2             	movslq %edx,%rdx
+  80080f:	48 83 ec 08          	sub    $0x8,%rsp
+  800813:	6a 00                	push   $0x0
+  800815:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80081b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800821:	be 01 00 00 00       	mov    $0x1,%esi
+  800826:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80082b:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800832:	ff ff ff 
+  800835:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800839:	ff d0                	call   *%rax
+  80083b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80083f:	c9                   	leave
+  800840:	c3                   	ret
+
+0000000000800841 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  800841:	55                   	push   %rbp
+  800842:	48 89 e5             	mov    %rsp,%rbp
+  800845:	48 83 ec 20          	sub    $0x20,%rsp
+  800849:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800849 <sys_ipc_try_send+0x8>
+  800850:	49 bb e7 77 00 00 00 	movabs $0x77e7,%r11
+  800857:	00 00 00 
+  80085a:	4c 01 d8             	add    %r11,%rax
+  80085d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800860:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800864:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800868:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80086b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80086e:	48 63 fa             	movslq %edx,%rdi
+  800871:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800875:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800878:	48 63 d2             	movslq %edx,%rdx
+  80087b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80087f:	48 83 ec 08          	sub    $0x8,%rsp
+  800883:	6a 00                	push   $0x0
+  800885:	49 89 f9             	mov    %rdi,%r9
+  800888:	49 89 f0             	mov    %rsi,%r8
+  80088b:	be 00 00 00 00       	mov    $0x0,%esi
+  800890:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800895:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  80089c:	ff ff ff 
+  80089f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8008a3:	ff d0                	call   *%rax
+  8008a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008a9:	c9                   	leave
+  8008aa:	c3                   	ret
+
+00000000008008ab <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8008ab:	55                   	push   %rbp
+  8008ac:	48 89 e5             	mov    %rsp,%rbp
+  8008af:	48 83 ec 20          	sub    $0x20,%rsp
+  8008b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008b3 <sys_ipc_send+0x8>
+  8008ba:	49 bb 7d 77 00 00 00 	movabs $0x777d,%r11
+  8008c1:	00 00 00 
+  8008c4:	4c 01 d8             	add    %r11,%rax
+  8008c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8008ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008ce:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8008d2:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8008d5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8008d8:	48 63 fa             	movslq %edx,%rdi
+  8008db:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8008df:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8008e2:	48 63 d2             	movslq %edx,%rdx
+  8008e5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8008e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ed:	6a 00                	push   $0x0
+  8008ef:	49 89 f9             	mov    %rdi,%r9
+  8008f2:	49 89 f0             	mov    %rsi,%r8
+  8008f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8008fa:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008ff:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800906:	ff ff ff 
+  800909:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80090d:	ff d0                	call   *%rax
+  80090f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800913:	c9                   	leave
+  800914:	c3                   	ret
+
+0000000000800915 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800915:	55                   	push   %rbp
+  800916:	48 89 e5             	mov    %rsp,%rbp
+  800919:	48 83 ec 10          	sub    $0x10,%rsp
+  80091d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80091d <sys_ipc_recv+0x8>
+  800924:	49 bb 13 77 00 00 00 	movabs $0x7713,%r11
+  80092b:	00 00 00 
+  80092e:	4c 01 d8             	add    %r11,%rax
+  800931:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  800935:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800939:	6a 00                	push   $0x0
+  80093b:	6a 00                	push   $0x0
+  80093d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800943:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800949:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094e:	be 01 00 00 00       	mov    $0x1,%esi
+  800953:	bf 0d 00 00 00       	mov    $0xd,%edi
+  800958:	49 ba 55 82 ff ff ff 	movabs $0xffffffffffff8255,%r10
+  80095f:	ff ff ff 
+  800962:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800966:	ff d0                	call   *%rax
+  800968:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80096c:	c9                   	leave
+  80096d:	c3                   	ret
+
+000000000080096e <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  80096e:	55                   	push   %rbp
+  80096f:	48 89 e5             	mov    %rsp,%rbp
+  800972:	48 83 ec 30          	sub    $0x30,%rsp
+  800976:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800976 <sys_ipc_call+0x8>
+  80097d:	49 bb ba 76 00 00 00 	movabs $0x76ba,%r11
+  800984:	00 00 00 
+  800987:	4c 01 d8             	add    %r11,%rax
+  80098a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80098d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800991:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800995:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  800998:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80099c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8009a0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8009a4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8009a7:	4c 63 c2             	movslq %edx,%r8
+  8009aa:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8009ae:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8009b1:	48 63 d2             	movslq %edx,%rdx
+  8009b4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8009b8:	ff 75 d8             	push   -0x28(%rbp)
+  8009bb:	56                   	push   %rsi
+  8009bc:	4d 89 c1             	mov    %r8,%r9
+  8009bf:	49 89 f8             	mov    %rdi,%r8
+  8009c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8009c7:	bf 18 00 00 00       	mov    $0x18,%edi
+  8009cc:	49 ba 55 82 ff ff ff 	movabs $0xffffffffffff8255,%r10
+  8009d3:	ff ff ff 
+  8009d6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8009da:	ff d0                	call   *%rax
+  8009dc:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8009e0:	c9                   	leave
+  8009e1:	c3                   	ret
+
+00000000008009e2 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8009e2:	55                   	push   %rbp
+  8009e3:	48 89 e5             	mov    %rsp,%rbp
+  8009e6:	48 83 ec 30          	sub    $0x30,%rsp
+  8009ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8009ea <sys_ipc_reply_recv+0x8>
+  8009f1:	49 bb 46 76 00 00 00 	movabs $0x7646,%r11
+  8009f8:	00 00 00 
+  8009fb:	4c 01 d8             	add    %r11,%rax
+  8009fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800a01:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a05:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800a09:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  800a0c:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  800a10:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  800a14:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800a18:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800a1b:	4c 63 c2             	movslq %edx,%r8
+  800a1e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800a22:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800a25:	48 63 d2             	movslq %edx,%rdx
+  800a28:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800a2c:	ff 75 d8             	push   -0x28(%rbp)
+  800a2f:	56                   	push   %rsi
+  800a30:	4d 89 c1             	mov    %r8,%r9
+  800a33:	49 89 f8             	mov    %rdi,%r8
+  800a36:	be 00 00 00 00       	mov    $0x0,%esi
+  800a3b:	bf 19 00 00 00       	mov    $0x19,%edi
+  800a40:	49 ba 55 82 ff ff ff 	movabs $0xffffffffffff8255,%r10
+  800a47:	ff ff ff 
+  800a4a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800a4e:	ff d0                	call   *%rax
+  800a50:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  800a54:	c9                   	leave
+  800a55:	c3                   	ret
+
+0000000000800a56 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800a56:	55                   	push   %rbp
+  800a57:	48 89 e5             	mov    %rsp,%rbp
+  800a5a:	48 83 ec 10          	sub    $0x10,%rsp
+  800a5e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a5e <sys_env_set_priority+0x8>
+  800a65:	49 bb d2 75 00 00 00 	movabs $0x75d2,%r11
+  800a6c:	00 00 00 
+  800a6f:	4c 01 d8             	add    %r11,%rax
+  800a72:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800a75:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  800a78:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800a7b:	48 63 ca             	movslq %edx,%rcx
+  800a7e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800a81:	48 63 d2             	movslq %edx,%rdx
+  800a84:	48 83 ec 08          	sub    $0x8,%rsp
+  800a88:	6a 00                	push   $0x0
+  800a8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a96:	be 01 00 00 00       	mov    $0x1,%esi
+  800a9b:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800aa0:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800aa7:	ff ff ff 
+  800aaa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800aae:	ff d0                	call   *%rax
+  800ab0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ab4:	c9                   	leave
+  800ab5:	c3                   	ret
+
+0000000000800ab6 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800ab6:	55                   	push   %rbp
+  800ab7:	48 89 e5             	mov    %rsp,%rbp
+  800aba:	48 83 ec 10          	sub    $0x10,%rsp
+  800abe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800abe <sys_env_set_affinity+0x8>
+  800ac5:	49 bb 72 75 00 00 00 	movabs $0x7572,%r11
+  800acc:	00 00 00 
+  800acf:	4c 01 d8             	add    %r11,%rax
+  800ad2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ad5:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  800ad8:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  800adb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800ade:	48 63 d2             	movslq %edx,%rdx
+  800ae1:	48 83 ec 08          	sub    $0x8,%rsp
+  800ae5:	6a 00                	push   $0x0
+  800ae7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800aed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800af3:	be 01 00 00 00       	mov    $0x1,%esi
+  800af8:	bf 10 00 00 00       	mov    $0x10,%edi
+  800afd:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800b04:	ff ff ff 
+  800b07:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800b0b:	ff d0                	call   *%rax
+  800b0d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800b11:	c9                   	leave
+  800b12:	c3                   	ret
+
+0000000000800b13 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800b13:	55                   	push   %rbp
+  800b14:	48 89 e5             	mov    %rsp,%rbp
+  800b17:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b17 <sys_time_msec+0x4>
+  800b1e:	49 bb 19 75 00 00 00 	movabs $0x7519,%r11
+  800b25:	00 00 00 
+  800b28:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  800b2b:	48 83 ec 08          	sub    $0x8,%rsp
+  800b2f:	6a 00                	push   $0x0
+  800b31:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800b37:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b47:	be 00 00 00 00       	mov    $0x0,%esi
+  800b4c:	bf 0e 00 00 00       	mov    $0xe,%edi
+  800b51:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800b58:	ff ff ff 
+  800b5b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800b5f:	ff d0                	call   *%rax
+  800b61:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800b65:	c9                   	leave
+  800b66:	c3                   	ret
+
+0000000000800b67 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  800b67:	55                   	push   %rbp
+  800b68:	48 89 e5             	mov    %rsp,%rbp
+  800b6b:	48 83 ec 10          	sub    $0x10,%rsp
+  800b6f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b6f <sys_sleep_usec+0x8>
+  800b76:	49 bb c1 74 00 00 00 	movabs $0x74c1,%r11
+  800b7d:	00 00 00 
+  800b80:	4c 01 d8             	add    %r11,%rax
+  800b83:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  800b87:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b8b:	48 83 ec 08          	sub    $0x8,%rsp
+  800b8f:	6a 00                	push   $0x0
+  800b91:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800b97:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ba7:	bf 11 00 00 00       	mov    $0x11,%edi
+  800bac:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800bb3:	ff ff ff 
+  800bb6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800bba:	ff d0                	call   *%rax
+  800bbc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800bc0:	c9                   	leave
+  800bc1:	c3                   	ret
+
+0000000000800bc2 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  800bc2:	55                   	push   %rbp
+  800bc3:	48 89 e5             	mov    %rsp,%rbp
+  800bc6:	48 83 ec 10          	sub    $0x10,%rsp
+  800bca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800bca <sys_page_alloc_huge+0x8>
+  800bd1:	49 bb 66 74 00 00 00 	movabs $0x7466,%r11
+  800bd8:	00 00 00 
+  800bdb:	4c 01 d8             	add    %r11,%rax
+  800bde:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800be1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800be5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800be8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800beb:	48 63 f2             	movslq %edx,%rsi
+  800bee:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800bf2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800bf5:	48 63 d2             	movslq %edx,%rdx
+  800bf8:	48 83 ec 08          	sub    $0x8,%rsp
+  800bfc:	6a 00                	push   $0x0
+  800bfe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800c04:	49 89 f0             	mov    %rsi,%r8
+  800c07:	be 01 00 00 00       	mov    $0x1,%esi
+  800c0c:	bf 12 00 00 00       	mov    $0x12,%edi
+  800c11:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800c18:	ff ff ff 
+  800c1b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800c1f:	ff d0                	call   *%rax
+  800c21:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800c25:	c9                   	leave
+  800c26:	c3                   	ret
+
+0000000000800c27 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  800c27:	55                   	push   %rbp
+  800c28:	48 89 e5             	mov    %rsp,%rbp
+  800c2b:	48 83 ec 10          	sub    $0x10,%rsp
+  800c2f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c2f <sys_page_map_batch+0x8>
+  800c36:	49 bb 01 74 00 00 00 	movabs $0x7401,%r11
+  800c3d:	00 00 00 
+  800c40:	4c 01 d8             	add    %r11,%rax
+  800c43:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800c47:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  800c4b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c4f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800c53:	48 83 ec 08          	sub    $0x8,%rsp
+  800c57:	6a 00                	push   $0x0
+  800c59:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800c5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800c65:	be 01 00 00 00       	mov    $0x1,%esi
+  800c6a:	bf 13 00 00 00       	mov    $0x13,%edi
+  800c6f:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800c76:	ff ff ff 
+  800c79:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800c7d:	ff d0                	call   *%rax
+  800c7f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800c83:	c9                   	leave
+  800c84:	c3                   	ret
+
+0000000000800c85 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  800c85:	55                   	push   %rbp
+  800c86:	48 89 e5             	mov    %rsp,%rbp
+  800c89:	48 83 ec 10          	sub    $0x10,%rsp
+  800c8d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c8d <sys_page_alloc_batch+0x8>
+  800c94:	49 bb a3 73 00 00 00 	movabs $0x73a3,%r11
+  800c9b:	00 00 00 
+  800c9e:	4c 01 d8             	add    %r11,%rax
+  800ca1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800ca5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  800ca9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800cad:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800cb1:	48 83 ec 08          	sub    $0x8,%rsp
+  800cb5:	6a 00                	push   $0x0
+  800cb7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800cbd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800cc3:	be 01 00 00 00       	mov    $0x1,%esi
+  800cc8:	bf 14 00 00 00       	mov    $0x14,%edi
+  800ccd:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800cd4:	ff ff ff 
+  800cd7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800cdb:	ff d0                	call   *%rax
+  800cdd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ce1:	c9                   	leave
+  800ce2:	c3                   	ret
+
+0000000000800ce3 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  800ce3:	55                   	push   %rbp
+  800ce4:	48 89 e5             	mov    %rsp,%rbp
+  800ce7:	48 83 ec 10          	sub    $0x10,%rsp
+  800ceb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ceb <sys_page_unmap_batch+0x8>
+  800cf2:	49 bb 45 73 00 00 00 	movabs $0x7345,%r11
+  800cf9:	00 00 00 
+  800cfc:	4c 01 d8             	add    %r11,%rax
+  800cff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800d03:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  800d07:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d0b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800d0f:	48 83 ec 08          	sub    $0x8,%rsp
+  800d13:	6a 00                	push   $0x0
+  800d15:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800d21:	be 01 00 00 00       	mov    $0x1,%esi
+  800d26:	bf 15 00 00 00       	mov    $0x15,%edi
+  800d2b:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800d32:	ff ff ff 
+  800d35:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800d39:	ff d0                	call   *%rax
+  800d3b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800d3f:	c9                   	leave
+  800d40:	c3                   	ret
+
+0000000000800d41 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  800d41:	55                   	push   %rbp
+  800d42:	48 89 e5             	mov    %rsp,%rbp
+  800d45:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800d45 <sys_fork+0x4>
+  800d4c:	49 bb eb 72 00 00 00 	movabs $0x72eb,%r11
+  800d53:	00 00 00 
+  800d56:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  800d59:	48 83 ec 08          	sub    $0x8,%rsp
+  800d5d:	6a 00                	push   $0x0
+  800d5f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800d6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d75:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7a:	bf 16 00 00 00       	mov    $0x16,%edi
+  800d7f:	49 ba 9b 81 ff ff ff 	movabs $0xffffffffffff819b,%r10
+  800d86:	ff ff ff 
+  800d89:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800d8d:	ff d0                	call   *%rax
+  800d8f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800d93:	c9                   	leave
+  800d94:	c3                   	ret
+
+0000000000800d95 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  800d95:	55                   	push   %rbp
+  800d96:	48 89 e5             	mov    %rsp,%rbp
+  800d99:	48 83 ec 08          	sub    $0x8,%rsp
+  800d9d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800d9d <fd2num+0x8>
+  800da4:	49 bb 93 72 00 00 00 	movabs $0x7293,%r11
+  800dab:	00 00 00 
+  800dae:	4c 01 d8             	add    %r11,%rax
+  800db1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800db5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800db9:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800dc0:	ff ff ff 
+  800dc3:	48 01 d0             	add    %rdx,%rax
+  800dc6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800dca:	c9                   	leave
+  800dcb:	c3                   	ret
+
+0000000000800dcc <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800dcc:	55                   	push   %rbp
+  800dcd:	48 89 e5             	mov    %rsp,%rbp
+  800dd0:	48 83 ec 08          	sub    $0x8,%rsp
+  800dd4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800dd4 <fd2data+0x8>
+  800ddb:	49 bb 5c 72 00 00 00 	movabs $0x725c,%r11
+  800de2:	00 00 00 
+  800de5:	4c 01 d8             	add    %r11,%rax
+  800de8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  800dec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800df0:	48 89 d7             	mov    %rdx,%rdi
+  800df3:	48 ba 65 8d ff ff ff 	movabs $0xffffffffffff8d65,%rdx
+  800dfa:	ff ff ff 
+  800dfd:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  800e01:	ff d0                	call   *%rax
+  800e03:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800e09:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800e0d:	c9                   	leave
+  800e0e:	c3                   	ret
+
+0000000000800e0f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800e0f:	55                   	push   %rbp
+  800e10:	48 89 e5             	mov    %rsp,%rbp
+  800e13:	48 83 ec 18          	sub    $0x18,%rsp
+  800e17:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800e17 <fd_alloc+0x8>
+  800e1e:	49 bb 19 72 00 00 00 	movabs $0x7219,%r11
+  800e25:	00 00 00 
+  800e28:	4c 01 d8             	add    %r11,%rax
+  800e2b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800e2f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e36:	eb 75                	jmp    800ead <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  800e38:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800e3b:	48 63 d2             	movslq %edx,%rdx
+  800e3e:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  800e45:	48 c1 e2 0c          	shl    $0xc,%rdx
+  800e49:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800e4d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e51:	48 89 d1             	mov    %rdx,%rcx
+  800e54:	48 c1 e9 15          	shr    $0x15,%rcx
+  800e58:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800e5f:	ff ff ff 
+  800e62:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800e66:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800e6a:	83 e2 01             	and    $0x1,%edx
+  800e6d:	48 85 d2             	test   %rdx,%rdx
+  800e70:	74 25                	je     800e97 <fd_alloc+0x88>
+  800e72:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e76:	48 89 d1             	mov    %rdx,%rcx
+  800e79:	48 c1 e9 0c          	shr    $0xc,%rcx
+  800e7d:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  800e84:	ff ff ff 
+  800e87:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800e8b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800e8f:	83 e2 01             	and    $0x1,%edx
+  800e92:	48 85 d2             	test   %rdx,%rdx
+  800e95:	75 12                	jne    800ea9 <fd_alloc+0x9a>
+			*fd_store = fd;
+  800e97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e9b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e9f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  800ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea7:	eb 1a                	jmp    800ec3 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  800ea9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800ead:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800eb1:	7e 85                	jle    800e38 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  800eb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800eb7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  800ebe:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  800ec3:	c9                   	leave
+  800ec4:	c3                   	ret
+
+0000000000800ec5 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800ec5:	55                   	push   %rbp
+  800ec6:	48 89 e5             	mov    %rsp,%rbp
+  800ec9:	48 83 ec 20          	sub    $0x20,%rsp
+  800ecd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ecd <fd_lookup+0x8>
+  800ed4:	49 bb 63 71 00 00 00 	movabs $0x7163,%r11
+  800edb:	00 00 00 
+  800ede:	4c 01 d8             	add    %r11,%rax
+  800ee1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800ee4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800ee8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800eec:	78 06                	js     800ef4 <fd_lookup+0x2f>
+  800eee:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800ef2:	7e 07                	jle    800efb <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  800ef4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ef9:	eb 73                	jmp    800f6e <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  800efb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800efe:	48 63 d2             	movslq %edx,%rdx
+  800f01:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  800f08:	48 c1 e2 0c          	shl    $0xc,%rdx
+  800f0c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f10:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f14:	48 89 d1             	mov    %rdx,%rcx
+  800f17:	48 c1 e9 15          	shr    $0x15,%rcx
+  800f1b:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800f22:	ff ff ff 
+  800f25:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800f29:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800f2d:	83 e2 01             	and    $0x1,%edx
+  800f30:	48 85 d2             	test   %rdx,%rdx
+  800f33:	74 22                	je     800f57 <fd_lookup+0x92>
+  800f35:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f39:	48 c1 ea 0c          	shr    $0xc,%rdx
+  800f3d:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  800f44:	ff ff ff 
+  800f47:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  800f4b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f4f:	83 e0 01             	and    $0x1,%eax
+  800f52:	48 85 c0             	test   %rax,%rax
+  800f55:	75 07                	jne    800f5e <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  800f57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f5c:	eb 10                	jmp    800f6e <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  800f5e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f62:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f66:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  800f69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f6e:	c9                   	leave
+  800f6f:	c3                   	ret
+
+0000000000800f70 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  800f70:	55                   	push   %rbp
+  800f71:	48 89 e5             	mov    %rsp,%rbp
+  800f74:	41 57                	push   %r15
+  800f76:	53                   	push   %rbx
+  800f77:	48 83 ec 30          	sub    $0x30,%rsp
+  800f7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800f7b <fd_close+0xb>
+  800f82:	49 bb b5 70 00 00 00 	movabs $0x70b5,%r11
+  800f89:	00 00 00 
+  800f8c:	4c 01 db             	add    %r11,%rbx
+  800f8f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800f93:	89 f0                	mov    %esi,%eax
+  800f95:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f9c:	48 89 c7             	mov    %rax,%rdi
+  800f9f:	48 b8 65 8d ff ff ff 	movabs $0xffffffffffff8d65,%rax
+  800fa6:	ff ff ff 
+  800fa9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fad:	ff d0                	call   *%rax
+  800faf:	89 c2                	mov    %eax,%edx
+  800fb1:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800fb5:	48 89 c6             	mov    %rax,%rsi
+  800fb8:	89 d7                	mov    %edx,%edi
+  800fba:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  800fc1:	ff ff ff 
+  800fc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fc8:	ff d0                	call   *%rax
+  800fca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800fcd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800fd1:	78 0a                	js     800fdd <fd_close+0x6d>
+	    || fd != fd2)
+  800fd3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fd7:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  800fdb:	74 12                	je     800fef <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  800fdd:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800fe1:	74 05                	je     800fe8 <fd_close+0x78>
+  800fe3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800fe6:	eb 7a                	jmp    801062 <fd_close+0xf2>
+  800fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fed:	eb 73                	jmp    801062 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800fef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ff3:	8b 00                	mov    (%rax),%eax
+  800ff5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  800ff9:	48 89 d6             	mov    %rdx,%rsi
+  800ffc:	89 c7                	mov    %eax,%edi
+  800ffe:	48 b8 3b 90 ff ff ff 	movabs $0xffffffffffff903b,%rax
+  801005:	ff ff ff 
+  801008:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80100c:	ff d0                	call   *%rax
+  80100e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801011:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801015:	78 2a                	js     801041 <fd_close+0xd1>
+		if (dev->dev_close)
+  801017:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80101b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80101f:	48 85 c0             	test   %rax,%rax
+  801022:	74 16                	je     80103a <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  801024:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801028:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80102c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801030:	48 89 c7             	mov    %rax,%rdi
+  801033:	ff d2                	call   *%rdx
+  801035:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801038:	eb 07                	jmp    801041 <fd_close+0xd1>
+		else
+			r = 0;
+  80103a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  801041:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801045:	48 89 c6             	mov    %rax,%rsi
+  801048:	bf 00 00 00 00       	mov    $0x0,%edi
+  80104d:	49 89 df             	mov    %rbx,%r15
+  801050:	48 b8 94 86 ff ff ff 	movabs $0xffffffffffff8694,%rax
+  801057:	ff ff ff 
+  80105a:	48 01 d8             	add    %rbx,%rax
+  80105d:	ff d0                	call   *%rax
+	return r;
+  80105f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  801062:	48 83 c4 30          	add    $0x30,%rsp
+  801066:	5b                   	pop    %rbx
+  801067:	41 5f                	pop    %r15
+  801069:	5d                   	pop    %rbp
+  80106a:	c3                   	ret
+
+000000000080106b <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80106b:	55                   	push   %rbp
+  80106c:	48 89 e5             	mov    %rsp,%rbp
+  80106f:	41 57                	push   %r15
+  801071:	48 83 ec 28          	sub    $0x28,%rsp
+  801075:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 801075 <dev_lookup+0xa>
+  80107c:	49 bb bb 6f 00 00 00 	movabs $0x6fbb,%r11
+  801083:	00 00 00 
+  801086:	4c 01 d9             	add    %r11,%rcx
+  801089:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80108c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801090:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801097:	eb 45                	jmp    8010de <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  801099:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  8010a0:	00 00 00 
+  8010a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8010a6:	48 98                	cltq
+  8010a8:	48 01 ca             	add    %rcx,%rdx
+  8010ab:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8010af:	8b 00                	mov    (%rax),%eax
+  8010b1:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8010b4:	75 24                	jne    8010da <dev_lookup+0x6f>
+			*dev = devtab[i];
+  8010b6:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  8010bd:	00 00 00 
+  8010c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8010c3:	48 98                	cltq
+  8010c5:	48 01 ca             	add    %rcx,%rdx
+  8010c8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8010cc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010d0:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8010d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010d8:	eb 74                	jmp    80114e <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  8010da:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8010de:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  8010e5:	00 00 00 
+  8010e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8010eb:	48 98                	cltq
+  8010ed:	48 01 ca             	add    %rcx,%rdx
+  8010f0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8010f4:	48 85 c0             	test   %rax,%rax
+  8010f7:	75 a0                	jne    801099 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010f9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801100:	ff ff ff 
+  801103:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  801107:	48 8b 00             	mov    (%rax),%rax
+  80110a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801110:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  801113:	89 c6                	mov    %eax,%esi
+  801115:	48 b8 58 de ff ff ff 	movabs $0xffffffffffffde58,%rax
+  80111c:	ff ff ff 
+  80111f:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  801123:	48 89 c7             	mov    %rax,%rdi
+  801126:	49 89 cf             	mov    %rcx,%r15
+  801129:	b8 00 00 00 00       	mov    $0x0,%eax
+  80112e:	49 b8 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%r8
+  801135:	ff ff ff 
+  801138:	49 01 c8             	add    %rcx,%r8
+  80113b:	41 ff d0             	call   *%r8
+	*dev = 0;
+  80113e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801142:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  801149:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80114e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  801152:	c9                   	leave
+  801153:	c3                   	ret
+
+0000000000801154 <close>:
+
+int
+close(int fdnum)
+{
+  801154:	55                   	push   %rbp
+  801155:	48 89 e5             	mov    %rsp,%rbp
+  801158:	53                   	push   %rbx
+  801159:	48 83 ec 28          	sub    $0x28,%rsp
+  80115d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80115d <close+0x9>
+  801164:	49 bb d3 6e 00 00 00 	movabs $0x6ed3,%r11
+  80116b:	00 00 00 
+  80116e:	4c 01 db             	add    %r11,%rbx
+  801171:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801174:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801178:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80117b:	48 89 d6             	mov    %rdx,%rsi
+  80117e:	89 c7                	mov    %eax,%edi
+  801180:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  801187:	ff ff ff 
+  80118a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80118e:	ff d0                	call   *%rax
+  801190:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801193:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801197:	79 05                	jns    80119e <close+0x4a>
+		return r;
+  801199:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80119c:	eb 1c                	jmp    8011ba <close+0x66>
+	else
+		return fd_close(fd, 1);
+  80119e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8011a7:	48 89 c7             	mov    %rax,%rdi
+  8011aa:	48 b8 40 8f ff ff ff 	movabs $0xffffffffffff8f40,%rax
+  8011b1:	ff ff ff 
+  8011b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8011b8:	ff d0                	call   *%rax
+}
+  8011ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011be:	c9                   	leave
+  8011bf:	c3                   	ret
+
+00000000008011c0 <close_all>:
+
+void
+close_all(void)
+{
+  8011c0:	55                   	push   %rbp
+  8011c1:	48 89 e5             	mov    %rsp,%rbp
+  8011c4:	53                   	push   %rbx
+  8011c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8011c9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8011c9 <close_all+0x9>
+  8011d0:	49 bb 67 6e 00 00 00 	movabs $0x6e67,%r11
+  8011d7:	00 00 00 
+  8011da:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011dd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8011e4:	eb 19                	jmp    8011ff <close_all+0x3f>
+		close(i);
+  8011e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8011e9:	89 c7                	mov    %eax,%edi
+  8011eb:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  8011f2:	ff ff ff 
+  8011f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8011f9:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8011fb:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8011ff:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  801203:	7e e1                	jle    8011e6 <close_all+0x26>
+}
+  801205:	90                   	nop
+  801206:	90                   	nop
+  801207:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80120b:	c9                   	leave
+  80120c:	c3                   	ret
+
+000000000080120d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80120d:	55                   	push   %rbp
+  80120e:	48 89 e5             	mov    %rsp,%rbp
+  801211:	41 57                	push   %r15
+  801213:	53                   	push   %rbx
+  801214:	48 83 ec 40          	sub    $0x40,%rsp
+  801218:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801218 <dup+0xb>
+  80121f:	49 bb 18 6e 00 00 00 	movabs $0x6e18,%r11
+  801226:	00 00 00 
+  801229:	4c 01 db             	add    %r11,%rbx
+  80122c:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80122f:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801232:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801236:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801239:	48 89 d6             	mov    %rdx,%rsi
+  80123c:	89 c7                	mov    %eax,%edi
+  80123e:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  801245:	ff ff ff 
+  801248:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80124c:	ff d0                	call   *%rax
+  80124e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801251:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801255:	79 08                	jns    80125f <dup+0x52>
+		return r;
+  801257:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80125a:	e9 a4 01 00 00       	jmp    801403 <dup+0x1f6>
+	close(newfdnum);
+  80125f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801262:	89 c7                	mov    %eax,%edi
+  801264:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  80126b:	ff ff ff 
+  80126e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801272:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  801274:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801277:	48 98                	cltq
+  801279:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80127f:	48 c1 e0 0c          	shl    $0xc,%rax
+  801283:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  801287:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80128b:	48 89 c7             	mov    %rax,%rdi
+  80128e:	48 b8 9c 8d ff ff ff 	movabs $0xffffffffffff8d9c,%rax
+  801295:	ff ff ff 
+  801298:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80129c:	ff d0                	call   *%rax
+  80129e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  8012a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012a6:	48 89 c7             	mov    %rax,%rdi
+  8012a9:	48 b8 9c 8d ff ff ff 	movabs $0xffffffffffff8d9c,%rax
+  8012b0:	ff ff ff 
+  8012b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8012b7:	ff d0                	call   *%rax
+  8012b9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8012bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012c1:	48 c1 e8 15          	shr    $0x15,%rax
+  8012c5:	48 89 c2             	mov    %rax,%rdx
+  8012c8:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8012cf:	ff ff ff 
+  8012d2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8012d6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8012da:	83 e0 01             	and    $0x1,%eax
+  8012dd:	48 85 c0             	test   %rax,%rax
+  8012e0:	74 7f                	je     801361 <dup+0x154>
+  8012e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012e6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8012ea:	48 89 c2             	mov    %rax,%rdx
+  8012ed:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8012f4:	ff ff ff 
+  8012f7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8012fb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8012ff:	83 e0 01             	and    $0x1,%eax
+  801302:	48 85 c0             	test   %rax,%rax
+  801305:	74 5a                	je     801361 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801307:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80130b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80130f:	48 89 c2             	mov    %rax,%rdx
+  801312:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  801319:	ff ff ff 
+  80131c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801320:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801324:	25 07 0e 00 00       	and    $0xe07,%eax
+  801329:	89 c1                	mov    %eax,%ecx
+  80132b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80132f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801333:	41 89 c8             	mov    %ecx,%r8d
+  801336:	48 89 d1             	mov    %rdx,%rcx
+  801339:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133e:	48 89 c6             	mov    %rax,%rsi
+  801341:	bf 00 00 00 00       	mov    $0x0,%edi
+  801346:	49 89 df             	mov    %rbx,%r15
+  801349:	48 b8 21 86 ff ff ff 	movabs $0xffffffffffff8621,%rax
+  801350:	ff ff ff 
+  801353:	48 01 d8             	add    %rbx,%rax
+  801356:	ff d0                	call   *%rax
+  801358:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80135b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80135f:	78 5f                	js     8013c0 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801361:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801365:	48 c1 e8 0c          	shr    $0xc,%rax
+  801369:	48 89 c2             	mov    %rax,%rdx
+  80136c:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  801373:	ff ff ff 
+  801376:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80137a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80137e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801383:	89 c1                	mov    %eax,%ecx
+  801385:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801389:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80138d:	41 89 c8             	mov    %ecx,%r8d
+  801390:	48 89 d1             	mov    %rdx,%rcx
+  801393:	ba 00 00 00 00       	mov    $0x0,%edx
+  801398:	48 89 c6             	mov    %rax,%rsi
+  80139b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a0:	49 89 df             	mov    %rbx,%r15
+  8013a3:	48 b8 21 86 ff ff ff 	movabs $0xffffffffffff8621,%rax
+  8013aa:	ff ff ff 
+  8013ad:	48 01 d8             	add    %rbx,%rax
+  8013b0:	ff d0                	call   *%rax
+  8013b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8013b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8013b9:	78 08                	js     8013c3 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  8013bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013be:	eb 43                	jmp    801403 <dup+0x1f6>
+			goto err;
+  8013c0:	90                   	nop
+  8013c1:	eb 01                	jmp    8013c4 <dup+0x1b7>
+		goto err;
+  8013c3:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  8013c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013c8:	48 89 c6             	mov    %rax,%rsi
+  8013cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013d0:	49 89 df             	mov    %rbx,%r15
+  8013d3:	48 b8 94 86 ff ff ff 	movabs $0xffffffffffff8694,%rax
+  8013da:	ff ff ff 
+  8013dd:	48 01 d8             	add    %rbx,%rax
+  8013e0:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8013e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8013e6:	48 89 c6             	mov    %rax,%rsi
+  8013e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013ee:	49 89 df             	mov    %rbx,%r15
+  8013f1:	48 b8 94 86 ff ff ff 	movabs $0xffffffffffff8694,%rax
+  8013f8:	ff ff ff 
+  8013fb:	48 01 d8             	add    %rbx,%rax
+  8013fe:	ff d0                	call   *%rax
+	return r;
+  801400:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  801403:	48 83 c4 40          	add    $0x40,%rsp
+  801407:	5b                   	pop    %rbx
+  801408:	41 5f                	pop    %r15
+  80140a:	5d                   	pop    %rbp
+  80140b:	c3                   	ret
+
+000000000080140c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80140c:	55                   	push   %rbp
+  80140d:	48 89 e5             	mov    %rsp,%rbp
+  801410:	41 57                	push   %r15
+  801412:	53                   	push   %rbx
+  801413:	48 83 ec 40          	sub    $0x40,%rsp
+  801417:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801417 <read+0xb>
+  80141e:	49 bb 19 6c 00 00 00 	movabs $0x6c19,%r11
+  801425:	00 00 00 
+  801428:	4c 01 db             	add    %r11,%rbx
+  80142b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80142e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801432:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801436:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80143a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80143d:	48 89 d6             	mov    %rdx,%rsi
+  801440:	89 c7                	mov    %eax,%edi
+  801442:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  801449:	ff ff ff 
+  80144c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801450:	ff d0                	call   *%rax
+  801452:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801455:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801459:	78 28                	js     801483 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80145b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80145f:	8b 00                	mov    (%rax),%eax
+  801461:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801465:	48 89 d6             	mov    %rdx,%rsi
+  801468:	89 c7                	mov    %eax,%edi
+  80146a:	48 b8 3b 90 ff ff ff 	movabs $0xffffffffffff903b,%rax
+  801471:	ff ff ff 
+  801474:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801478:	ff d0                	call   *%rax
+  80147a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80147d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801481:	79 08                	jns    80148b <read+0x7f>
+		return r;
+  801483:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801486:	e9 8b 00 00 00       	jmp    801516 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80148b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80148f:	8b 40 08             	mov    0x8(%rax),%eax
+  801492:	83 e0 03             	and    $0x3,%eax
+  801495:	83 f8 01             	cmp    $0x1,%eax
+  801498:	75 4b                	jne    8014e5 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80149a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8014a1:	ff ff ff 
+  8014a4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8014a8:	48 8b 00             	mov    (%rax),%rax
+  8014ab:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8014b1:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8014b4:	89 c6                	mov    %eax,%esi
+  8014b6:	48 b8 77 de ff ff ff 	movabs $0xffffffffffffde77,%rax
+  8014bd:	ff ff ff 
+  8014c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014c4:	48 89 c7             	mov    %rax,%rdi
+  8014c7:	49 89 df             	mov    %rbx,%r15
+  8014ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cf:	48 b9 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%rcx
+  8014d6:	ff ff ff 
+  8014d9:	48 01 d9             	add    %rbx,%rcx
+  8014dc:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8014de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e3:	eb 31                	jmp    801516 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8014e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014e9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8014ed:	48 85 c0             	test   %rax,%rax
+  8014f0:	75 07                	jne    8014f9 <read+0xed>
+		return -E_NOT_SUPP;
+  8014f2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8014f7:	eb 1d                	jmp    801516 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8014f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014fd:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  801501:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801505:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801509:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80150d:	48 89 ce             	mov    %rcx,%rsi
+  801510:	48 89 c7             	mov    %rax,%rdi
+  801513:	41 ff d0             	call   *%r8
+}
+  801516:	48 83 c4 40          	add    $0x40,%rsp
+  80151a:	5b                   	pop    %rbx
+  80151b:	41 5f                	pop    %r15
+  80151d:	5d                   	pop    %rbp
+  80151e:	c3                   	ret
+
+000000000080151f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80151f:	55                   	push   %rbp
+  801520:	48 89 e5             	mov    %rsp,%rbp
+  801523:	53                   	push   %rbx
+  801524:	48 83 ec 38          	sub    $0x38,%rsp
+  801528:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801528 <readn+0x9>
+  80152f:	49 bb 08 6b 00 00 00 	movabs $0x6b08,%r11
+  801536:	00 00 00 
+  801539:	4c 01 db             	add    %r11,%rbx
+  80153c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80153f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801543:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801547:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80154e:	eb 4b                	jmp    80159b <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801550:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801553:	48 98                	cltq
+  801555:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801559:	48 29 c2             	sub    %rax,%rdx
+  80155c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80155f:	48 63 c8             	movslq %eax,%rcx
+  801562:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801566:	48 01 c1             	add    %rax,%rcx
+  801569:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80156c:	48 89 ce             	mov    %rcx,%rsi
+  80156f:	89 c7                	mov    %eax,%edi
+  801571:	48 b8 dc 93 ff ff ff 	movabs $0xffffffffffff93dc,%rax
+  801578:	ff ff ff 
+  80157b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80157f:	ff d0                	call   *%rax
+  801581:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  801584:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  801588:	79 05                	jns    80158f <readn+0x70>
+			return m;
+  80158a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80158d:	eb 1d                	jmp    8015ac <readn+0x8d>
+		if (m == 0)
+  80158f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  801593:	74 13                	je     8015a8 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  801595:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801598:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80159b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80159e:	48 98                	cltq
+  8015a0:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  8015a4:	72 aa                	jb     801550 <readn+0x31>
+  8015a6:	eb 01                	jmp    8015a9 <readn+0x8a>
+			break;
+  8015a8:	90                   	nop
+	}
+	return tot;
+  8015a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8015ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015b0:	c9                   	leave
+  8015b1:	c3                   	ret
+
+00000000008015b2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015b2:	55                   	push   %rbp
+  8015b3:	48 89 e5             	mov    %rsp,%rbp
+  8015b6:	41 57                	push   %r15
+  8015b8:	53                   	push   %rbx
+  8015b9:	48 83 ec 40          	sub    $0x40,%rsp
+  8015bd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8015bd <write+0xb>
+  8015c4:	49 bb 73 6a 00 00 00 	movabs $0x6a73,%r11
+  8015cb:	00 00 00 
+  8015ce:	4c 01 db             	add    %r11,%rbx
+  8015d1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8015d4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8015d8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015dc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8015e0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8015e3:	48 89 d6             	mov    %rdx,%rsi
+  8015e6:	89 c7                	mov    %eax,%edi
+  8015e8:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  8015ef:	ff ff ff 
+  8015f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015f6:	ff d0                	call   *%rax
+  8015f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8015fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8015ff:	78 28                	js     801629 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801601:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801605:	8b 00                	mov    (%rax),%eax
+  801607:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80160b:	48 89 d6             	mov    %rdx,%rsi
+  80160e:	89 c7                	mov    %eax,%edi
+  801610:	48 b8 3b 90 ff ff ff 	movabs $0xffffffffffff903b,%rax
+  801617:	ff ff ff 
+  80161a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80161e:	ff d0                	call   *%rax
+  801620:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801623:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801627:	79 08                	jns    801631 <write+0x7f>
+		return r;
+  801629:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80162c:	e9 8a 00 00 00       	jmp    8016bb <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801631:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801635:	8b 40 08             	mov    0x8(%rax),%eax
+  801638:	83 e0 03             	and    $0x3,%eax
+  80163b:	85 c0                	test   %eax,%eax
+  80163d:	75 4b                	jne    80168a <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80163f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801646:	ff ff ff 
+  801649:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80164d:	48 8b 00             	mov    (%rax),%rax
+  801650:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801656:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  801659:	89 c6                	mov    %eax,%esi
+  80165b:	48 b8 93 de ff ff ff 	movabs $0xffffffffffffde93,%rax
+  801662:	ff ff ff 
+  801665:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801669:	48 89 c7             	mov    %rax,%rdi
+  80166c:	49 89 df             	mov    %rbx,%r15
+  80166f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801674:	48 b9 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%rcx
+  80167b:	ff ff ff 
+  80167e:	48 01 d9             	add    %rbx,%rcx
+  801681:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  801683:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801688:	eb 31                	jmp    8016bb <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80168a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80168e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801692:	48 85 c0             	test   %rax,%rax
+  801695:	75 07                	jne    80169e <write+0xec>
+		return -E_NOT_SUPP;
+  801697:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80169c:	eb 1d                	jmp    8016bb <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  80169e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016a2:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8016a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016aa:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8016ae:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8016b2:	48 89 ce             	mov    %rcx,%rsi
+  8016b5:	48 89 c7             	mov    %rax,%rdi
+  8016b8:	41 ff d0             	call   *%r8
+}
+  8016bb:	48 83 c4 40          	add    $0x40,%rsp
+  8016bf:	5b                   	pop    %rbx
+  8016c0:	41 5f                	pop    %r15
+  8016c2:	5d                   	pop    %rbp
+  8016c3:	c3                   	ret
+
+00000000008016c4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016c4:	55                   	push   %rbp
+  8016c5:	48 89 e5             	mov    %rsp,%rbp
+  8016c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8016cc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016cc <seek+0x8>
+  8016d3:	49 bb 64 69 00 00 00 	movabs $0x6964,%r11
+  8016da:	00 00 00 
+  8016dd:	4c 01 d8             	add    %r11,%rax
+  8016e0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8016e3:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016e6:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8016ea:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8016ed:	48 89 ce             	mov    %rcx,%rsi
+  8016f0:	89 d7                	mov    %edx,%edi
+  8016f2:	48 ba 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rdx
+  8016f9:	ff ff ff 
+  8016fc:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  801700:	ff d0                	call   *%rax
+  801702:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801705:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801709:	79 05                	jns    801710 <seek+0x4c>
+		return r;
+  80170b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80170e:	eb 0f                	jmp    80171f <seek+0x5b>
+	fd->fd_offset = offset;
+  801710:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801714:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801717:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  80171a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80171f:	c9                   	leave
+  801720:	c3                   	ret
+
+0000000000801721 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801721:	55                   	push   %rbp
+  801722:	48 89 e5             	mov    %rsp,%rbp
+  801725:	41 57                	push   %r15
+  801727:	53                   	push   %rbx
+  801728:	48 83 ec 30          	sub    $0x30,%rsp
+  80172c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80172c <ftruncate+0xb>
+  801733:	49 bb 04 69 00 00 00 	movabs $0x6904,%r11
+  80173a:	00 00 00 
+  80173d:	4c 01 db             	add    %r11,%rbx
+  801740:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801743:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801746:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80174a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80174d:	48 89 d6             	mov    %rdx,%rsi
+  801750:	89 c7                	mov    %eax,%edi
+  801752:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  801759:	ff ff ff 
+  80175c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801760:	ff d0                	call   *%rax
+  801762:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801765:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801769:	78 28                	js     801793 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80176b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80176f:	8b 00                	mov    (%rax),%eax
+  801771:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801775:	48 89 d6             	mov    %rdx,%rsi
+  801778:	89 c7                	mov    %eax,%edi
+  80177a:	48 b8 3b 90 ff ff ff 	movabs $0xffffffffffff903b,%rax
+  801781:	ff ff ff 
+  801784:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801788:	ff d0                	call   *%rax
+  80178a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80178d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801791:	79 08                	jns    80179b <ftruncate+0x7a>
+		return r;
+  801793:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801796:	e9 83 00 00 00       	jmp    80181e <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80179b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80179f:	8b 40 08             	mov    0x8(%rax),%eax
+  8017a2:	83 e0 03             	and    $0x3,%eax
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	75 4b                	jne    8017f4 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8017a9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8017b0:	ff ff ff 
+  8017b3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8017b7:	48 8b 00             	mov    (%rax),%rax
+  8017ba:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017c0:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8017c3:	89 c6                	mov    %eax,%esi
+  8017c5:	48 b8 b0 de ff ff ff 	movabs $0xffffffffffffdeb0,%rax
+  8017cc:	ff ff ff 
+  8017cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8017d3:	48 89 c7             	mov    %rax,%rdi
+  8017d6:	49 89 df             	mov    %rbx,%r15
+  8017d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017de:	48 b9 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%rcx
+  8017e5:	ff ff ff 
+  8017e8:	48 01 d9             	add    %rbx,%rcx
+  8017eb:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8017ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f2:	eb 2a                	jmp    80181e <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8017f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017f8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8017fc:	48 85 c0             	test   %rax,%rax
+  8017ff:	75 07                	jne    801808 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  801801:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  801806:	eb 16                	jmp    80181e <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  801808:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80180c:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  801810:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801814:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  801817:	89 d6                	mov    %edx,%esi
+  801819:	48 89 c7             	mov    %rax,%rdi
+  80181c:	ff d1                	call   *%rcx
+}
+  80181e:	48 83 c4 30          	add    $0x30,%rsp
+  801822:	5b                   	pop    %rbx
+  801823:	41 5f                	pop    %r15
+  801825:	5d                   	pop    %rbp
+  801826:	c3                   	ret
+
+0000000000801827 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801827:	55                   	push   %rbp
+  801828:	48 89 e5             	mov    %rsp,%rbp
+  80182b:	53                   	push   %rbx
+  80182c:	48 83 ec 38          	sub    $0x38,%rsp
+  801830:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801830 <fstat+0x9>
+  801837:	49 bb 00 68 00 00 00 	movabs $0x6800,%r11
+  80183e:	00 00 00 
+  801841:	4c 01 db             	add    %r11,%rbx
+  801844:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801847:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80184b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80184f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801852:	48 89 d6             	mov    %rdx,%rsi
+  801855:	89 c7                	mov    %eax,%edi
+  801857:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  80185e:	ff ff ff 
+  801861:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801865:	ff d0                	call   *%rax
+  801867:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80186a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80186e:	78 28                	js     801898 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801870:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801874:	8b 00                	mov    (%rax),%eax
+  801876:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80187a:	48 89 d6             	mov    %rdx,%rsi
+  80187d:	89 c7                	mov    %eax,%edi
+  80187f:	48 b8 3b 90 ff ff ff 	movabs $0xffffffffffff903b,%rax
+  801886:	ff ff ff 
+  801889:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80188d:	ff d0                	call   *%rax
+  80188f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801892:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801896:	79 05                	jns    80189d <fstat+0x76>
+		return r;
+  801898:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80189b:	eb 5e                	jmp    8018fb <fstat+0xd4>
+	if (!dev->dev_stat)
+  80189d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018a1:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8018a5:	48 85 c0             	test   %rax,%rax
+  8018a8:	75 07                	jne    8018b1 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8018aa:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8018af:	eb 4a                	jmp    8018fb <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8018b1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018b5:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8018b8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018bc:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8018c3:	00 00 00 
+	stat->st_isdir = 0;
+  8018c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018ca:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8018d1:	00 00 00 
+	stat->st_dev = dev;
+  8018d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018d8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018dc:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8018e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018e7:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8018eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8018f3:	48 89 d6             	mov    %rdx,%rsi
+  8018f6:	48 89 c7             	mov    %rax,%rdi
+  8018f9:	ff d1                	call   *%rcx
+}
+  8018fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ff:	c9                   	leave
+  801900:	c3                   	ret
+
+0000000000801901 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801901:	55                   	push   %rbp
+  801902:	48 89 e5             	mov    %rsp,%rbp
+  801905:	41 57                	push   %r15
+  801907:	53                   	push   %rbx
+  801908:	48 83 ec 20          	sub    $0x20,%rsp
+  80190c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80190c <stat+0xb>
+  801913:	49 bb 24 67 00 00 00 	movabs $0x6724,%r11
+  80191a:	00 00 00 
+  80191d:	4c 01 db             	add    %r11,%rbx
+  801920:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801924:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801928:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80192c:	be 00 00 00 00       	mov    $0x0,%esi
+  801931:	48 89 c7             	mov    %rax,%rdi
+  801934:	49 89 df             	mov    %rbx,%r15
+  801937:	48 b8 ab 9b ff ff ff 	movabs $0xffffffffffff9bab,%rax
+  80193e:	ff ff ff 
+  801941:	48 01 d8             	add    %rbx,%rax
+  801944:	ff d0                	call   *%rax
+  801946:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801949:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80194d:	79 05                	jns    801954 <stat+0x53>
+		return fd;
+  80194f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801952:	eb 37                	jmp    80198b <stat+0x8a>
+	r = fstat(fd, stat);
+  801954:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801958:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80195b:	48 89 d6             	mov    %rdx,%rsi
+  80195e:	89 c7                	mov    %eax,%edi
+  801960:	48 b8 f7 97 ff ff ff 	movabs $0xffffffffffff97f7,%rax
+  801967:	ff ff ff 
+  80196a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80196e:	ff d0                	call   *%rax
+  801970:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  801973:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801976:	89 c7                	mov    %eax,%edi
+  801978:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  80197f:	ff ff ff 
+  801982:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801986:	ff d0                	call   *%rax
+	return r;
+  801988:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  80198b:	48 83 c4 20          	add    $0x20,%rsp
+  80198f:	5b                   	pop    %rbx
+  801990:	41 5f                	pop    %r15
+  801992:	5d                   	pop    %rbp
+  801993:	c3                   	ret
+
+0000000000801994 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801994:	55                   	push   %rbp
+  801995:	48 89 e5             	mov    %rsp,%rbp
+  801998:	41 57                	push   %r15
+  80199a:	53                   	push   %rbx
+  80199b:	48 83 ec 10          	sub    $0x10,%rsp
+  80199f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80199f <fsipc+0xb>
+  8019a6:	49 bb 91 66 00 00 00 	movabs $0x6691,%r11
+  8019ad:	00 00 00 
+  8019b0:	4c 01 db             	add    %r11,%rbx
+  8019b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8019b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8019ba:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8019c1:	00 00 00 
+  8019c4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8019c7:	85 c0                	test   %eax,%eax
+  8019c9:	75 24                	jne    8019ef <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8019d0:	49 89 df             	mov    %rbx,%r15
+  8019d3:	48 b8 df dc ff ff ff 	movabs $0xffffffffffffdcdf,%rax
+  8019da:	ff ff ff 
+  8019dd:	48 01 d8             	add    %rbx,%rax
+  8019e0:	ff d0                	call   *%rax
+  8019e2:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8019e9:	00 00 00 
+  8019ec:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8019ef:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8019f6:	00 00 00 
+  8019f9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8019fc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a00:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  801a03:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801a09:	49 89 d0             	mov    %rdx,%r8
+  801a0c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a11:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  801a18:	00 00 00 
+  801a1b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  801a1f:	89 c7                	mov    %eax,%edi
+  801a21:	49 89 df             	mov    %rbx,%r15
+  801a24:	48 b8 fe d6 ff ff ff 	movabs $0xffffffffffffd6fe,%rax
+  801a2b:	ff ff ff 
+  801a2e:	48 01 d8             	add    %rbx,%rax
+  801a31:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  801a33:	48 83 c4 10          	add    $0x10,%rsp
+  801a37:	5b                   	pop    %rbx
+  801a38:	41 5f                	pop    %r15
+  801a3a:	5d                   	pop    %rbp
+  801a3b:	c3                   	ret
+
+0000000000801a3c <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  801a3c:	55                   	push   %rbp
+  801a3d:	48 89 e5             	mov    %rsp,%rbp
+  801a40:	41 57                	push   %r15
+  801a42:	53                   	push   %rbx
+  801a43:	48 83 ec 20          	sub    $0x20,%rsp
+  801a47:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801a47 <fsipc_words+0xb>
+  801a4e:	49 bb e9 65 00 00 00 	movabs $0x65e9,%r11
+  801a55:	00 00 00 
+  801a58:	4c 01 db             	add    %r11,%rbx
+  801a5b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801a5e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a62:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  801a66:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  801a6d:	00 00 00 
+  801a70:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801a73:	85 c0                	test   %eax,%eax
+  801a75:	75 24                	jne    801a9b <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a77:	bf 01 00 00 00       	mov    $0x1,%edi
+  801a7c:	49 89 df             	mov    %rbx,%r15
+  801a7f:	48 b8 df dc ff ff ff 	movabs $0xffffffffffffdcdf,%rax
+  801a86:	ff ff ff 
+  801a89:	48 01 d8             	add    %rbx,%rax
+  801a8c:	ff d0                	call   *%rax
+  801a8e:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  801a95:	00 00 00 
+  801a98:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  801a9b:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  801aa2:	00 00 00 
+  801aa5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801aa8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801aac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801ab0:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  801ab3:	89 c7                	mov    %eax,%edi
+  801ab5:	49 89 df             	mov    %rbx,%r15
+  801ab8:	48 b8 e9 d7 ff ff ff 	movabs $0xffffffffffffd7e9,%rax
+  801abf:	ff ff ff 
+  801ac2:	48 01 d8             	add    %rbx,%rax
+  801ac5:	ff d0                	call   *%rax
+}
+  801ac7:	48 83 c4 20          	add    $0x20,%rsp
+  801acb:	5b                   	pop    %rbx
+  801acc:	41 5f                	pop    %r15
+  801ace:	5d                   	pop    %rbp
+  801acf:	c3                   	ret
+
+0000000000801ad0 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  801ad0:	55                   	push   %rbp
+  801ad1:	48 89 e5             	mov    %rsp,%rbp
+  801ad4:	41 57                	push   %r15
+  801ad6:	53                   	push   %rbx
+  801ad7:	48 83 ec 40          	sub    $0x40,%rsp
+  801adb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801adb <fsipc_pages+0xb>
+  801ae2:	49 bb 55 65 00 00 00 	movabs $0x6555,%r11
+  801ae9:	00 00 00 
+  801aec:	4c 01 db             	add    %r11,%rbx
+  801aef:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801af2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801af6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  801afa:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  801afd:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  801b04:	00 00 00 
+  801b07:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801b0a:	85 c0                	test   %eax,%eax
+  801b0c:	75 24                	jne    801b32 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b0e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b13:	49 89 df             	mov    %rbx,%r15
+  801b16:	48 b8 df dc ff ff ff 	movabs $0xffffffffffffdcdf,%rax
+  801b1d:	ff ff ff 
+  801b20:	48 01 d8             	add    %rbx,%rax
+  801b23:	ff d0                	call   *%rax
+  801b25:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  801b2c:	00 00 00 
+  801b2f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  801b32:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801b37:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  801b3b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801b3e:	48 98                	cltq
+  801b40:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  801b44:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801b48:	0f 95 c0             	setne  %al
+  801b4b:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  801b4e:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  801b55:	00 
+  801b56:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801b5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b5e:	48 01 d0             	add    %rdx,%rax
+  801b61:	48 83 e8 01          	sub    $0x1,%rax
+  801b65:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801b69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b72:	48 f7 75 e8          	divq   -0x18(%rbp)
+  801b76:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b7a:	48 29 d0             	sub    %rdx,%rax
+  801b7d:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  801b81:	41 89 c2             	mov    %eax,%r10d
+  801b84:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  801b8b:	00 00 00 
+  801b8e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801b91:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  801b95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b99:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801b9c:	48 83 ec 08          	sub    $0x8,%rsp
+  801ba0:	6a 40                	push   $0x40
+  801ba2:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  801ba7:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  801bae:	00 
+  801baf:	6a 05                	push   $0x5
+  801bb1:	41 89 f9             	mov    %edi,%r9d
+  801bb4:	49 89 c8             	mov    %rcx,%r8
+  801bb7:	44 89 d1             	mov    %r10d,%ecx
+  801bba:	89 c7                	mov    %eax,%edi
+  801bbc:	49 89 df             	mov    %rbx,%r15
+  801bbf:	48 b8 e7 d8 ff ff ff 	movabs $0xffffffffffffd8e7,%rax
+  801bc6:	ff ff ff 
+  801bc9:	48 01 d8             	add    %rbx,%rax
+  801bcc:	ff d0                	call   *%rax
+  801bce:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  801bd2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801bd6:	5b                   	pop    %rbx
+  801bd7:	41 5f                	pop    %r15
+  801bd9:	5d                   	pop    %rbp
+  801bda:	c3                   	ret
+
+0000000000801bdb <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  801bdb:	55                   	push   %rbp
+  801bdc:	48 89 e5             	mov    %rsp,%rbp
+  801bdf:	41 57                	push   %r15
+  801be1:	53                   	push   %rbx
+  801be2:	48 83 ec 20          	sub    $0x20,%rsp
+  801be6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801be6 <open+0xb>
+  801bed:	49 bb 4a 64 00 00 00 	movabs $0x644a,%r11
+  801bf4:	00 00 00 
+  801bf7:	4c 01 db             	add    %r11,%rbx
+  801bfa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bfe:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  801c01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c05:	48 89 c7             	mov    %rax,%rdi
+  801c08:	49 89 df             	mov    %rbx,%r15
+  801c0b:	48 b8 73 cc ff ff ff 	movabs $0xffffffffffffcc73,%rax
+  801c12:	ff ff ff 
+  801c15:	48 01 d8             	add    %rbx,%rax
+  801c18:	ff d0                	call   *%rax
+  801c1a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c1f:	7e 0a                	jle    801c2b <open+0x50>
+		return -E_BAD_PATH;
+  801c21:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801c26:	e9 18 01 00 00       	jmp    801d43 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  801c2b:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801c2f:	48 89 c7             	mov    %rax,%rdi
+  801c32:	49 89 df             	mov    %rbx,%r15
+  801c35:	48 b8 df 8d ff ff ff 	movabs $0xffffffffffff8ddf,%rax
+  801c3c:	ff ff ff 
+  801c3f:	48 01 d8             	add    %rbx,%rax
+  801c42:	ff d0                	call   *%rax
+  801c44:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c47:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801c4b:	74 08                	je     801c55 <open+0x7a>
+		return r;
+  801c4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c50:	e9 ee 00 00 00       	jmp    801d43 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  801c55:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  801c5c:	00 00 00 
+  801c5f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c62:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  801c69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c6d:	48 89 c6             	mov    %rax,%rsi
+  801c70:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  801c77:	00 00 00 
+  801c7a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c7e:	48 89 c7             	mov    %rax,%rdi
+  801c81:	49 89 df             	mov    %rbx,%r15
+  801c84:	48 b8 07 cd ff ff ff 	movabs $0xffffffffffffcd07,%rax
+  801c8b:	ff ff ff 
+  801c8e:	48 01 d8             	add    %rbx,%rax
+  801c91:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  801c93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c97:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  801c9c:	48 89 c6             	mov    %rax,%rsi
+  801c9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca4:	49 89 df             	mov    %rbx,%r15
+  801ca7:	48 b8 bc 85 ff ff ff 	movabs $0xffffffffffff85bc,%rax
+  801cae:	ff ff ff 
+  801cb1:	48 01 d8             	add    %rbx,%rax
+  801cb4:	ff d0                	call   *%rax
+  801cb6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801cb9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801cbd:	74 23                	je     801ce2 <open+0x107>
+		fd_close(fd,0);
+  801cbf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cc3:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc8:	48 89 c7             	mov    %rax,%rdi
+  801ccb:	49 89 df             	mov    %rbx,%r15
+  801cce:	48 b8 40 8f ff ff ff 	movabs $0xffffffffffff8f40,%rax
+  801cd5:	ff ff ff 
+  801cd8:	48 01 d8             	add    %rbx,%rax
+  801cdb:	ff d0                	call   *%rax
+		return r;
+  801cdd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ce0:	eb 61                	jmp    801d43 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  801ce2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ce6:	48 89 c6             	mov    %rax,%rsi
+  801ce9:	bf 01 00 00 00       	mov    $0x1,%edi
+  801cee:	48 b8 64 99 ff ff ff 	movabs $0xffffffffffff9964,%rax
+  801cf5:	ff ff ff 
+  801cf8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801cfc:	ff d0                	call   *%rax
+  801cfe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d01:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801d05:	74 23                	je     801d2a <open+0x14f>
+		fd_close(fd,0);
+  801d07:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d0b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d10:	48 89 c7             	mov    %rax,%rdi
+  801d13:	49 89 df             	mov    %rbx,%r15
+  801d16:	48 b8 40 8f ff ff ff 	movabs $0xffffffffffff8f40,%rax
+  801d1d:	ff ff ff 
+  801d20:	48 01 d8             	add    %rbx,%rax
+  801d23:	ff d0                	call   *%rax
+		return r;
+  801d25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d28:	eb 19                	jmp    801d43 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  801d2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d2e:	48 89 c7             	mov    %rax,%rdi
+  801d31:	49 89 df             	mov    %rbx,%r15
+  801d34:	48 b8 65 8d ff ff ff 	movabs $0xffffffffffff8d65,%rax
+  801d3b:	ff ff ff 
+  801d3e:	48 01 d8             	add    %rbx,%rax
+  801d41:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  801d43:	48 83 c4 20          	add    $0x20,%rsp
+  801d47:	5b                   	pop    %rbx
+  801d48:	41 5f                	pop    %r15
+  801d4a:	5d                   	pop    %rbp
+  801d4b:	c3                   	ret
+
+0000000000801d4c <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  801d4c:	55                   	push   %rbp
+  801d4d:	48 89 e5             	mov    %rsp,%rbp
+  801d50:	48 83 ec 20          	sub    $0x20,%rsp
+  801d54:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d54 <devfile_flush+0x8>
+  801d5b:	49 bb dc 62 00 00 00 	movabs $0x62dc,%r11
+  801d62:	00 00 00 
+  801d65:	4c 01 d8             	add    %r11,%rax
+  801d68:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  801d6c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d70:	8b 52 0c             	mov    0xc(%rdx),%edx
+  801d73:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  801d76:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  801d7a:	ba 04 00 00 00       	mov    $0x4,%edx
+  801d7f:	48 89 ce             	mov    %rcx,%rsi
+  801d82:	bf 06 00 00 00       	mov    $0x6,%edi
+  801d87:	48 b9 0c 9a ff ff ff 	movabs $0xffffffffffff9a0c,%rcx
+  801d8e:	ff ff ff 
+  801d91:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801d95:	ff d0                	call   *%rax
+}
+  801d97:	c9                   	leave
+  801d98:	c3                   	ret
+
+0000000000801d99 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  801d99:	55                   	push   %rbp
+  801d9a:	48 89 e5             	mov    %rsp,%rbp
+  801d9d:	41 57                	push   %r15
+  801d9f:	53                   	push   %rbx
+  801da0:	48 83 ec 60          	sub    $0x60,%rsp
+  801da4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801da4 <devfile_read+0xb>
+  801dab:	49 bb 8c 62 00 00 00 	movabs $0x628c,%r11
+  801db2:	00 00 00 
+  801db5:	4c 01 db             	add    %r11,%rbx
+  801db8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801dbc:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801dc0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  801dc4:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801dc8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  801dcc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801dd0:	8b 50 0c             	mov    0xc(%rax),%edx
+  801dd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dd7:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  801dd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ddd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801de1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  801de5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801de9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dee:	ba 10 00 00 00       	mov    $0x10,%edx
+  801df3:	48 89 c6             	mov    %rax,%rsi
+  801df6:	bf 03 00 00 00       	mov    $0x3,%edi
+  801dfb:	48 b8 a0 9a ff ff ff 	movabs $0xffffffffffff9aa0,%rax
+  801e02:	ff ff ff 
+  801e05:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e09:	ff d0                	call   *%rax
+  801e0b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  801e0e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801e12:	79 05                	jns    801e19 <devfile_read+0x80>
+		return r;
+  801e14:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801e17:	eb 64                	jmp    801e7d <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  801e19:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801e1c:	48 63 d0             	movslq %eax,%rdx
+  801e1f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801e23:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  801e28:	48 01 c1             	add    %rax,%rcx
+  801e2b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e2f:	48 89 ce             	mov    %rcx,%rsi
+  801e32:	48 89 c7             	mov    %rax,%rdi
+  801e35:	49 89 df             	mov    %rbx,%r15
+  801e38:	48 b8 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rax
+  801e3f:	ff ff ff 
+  801e42:	48 01 d8             	add    %rbx,%rax
+  801e45:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  801e47:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801e4e:	ff ff ff 
+  801e51:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801e55:	48 8b 00             	mov    (%rax),%rax
+  801e58:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  801e5e:	89 c6                	mov    %eax,%esi
+  801e60:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  801e65:	48 89 c7             	mov    %rax,%rdi
+  801e68:	49 89 df             	mov    %rbx,%r15
+  801e6b:	48 b8 99 dc ff ff ff 	movabs $0xffffffffffffdc99,%rax
+  801e72:	ff ff ff 
+  801e75:	48 01 d8             	add    %rbx,%rax
+  801e78:	ff d0                	call   *%rax
+	return r;
+  801e7a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  801e7d:	48 83 c4 60          	add    $0x60,%rsp
+  801e81:	5b                   	pop    %rbx
+  801e82:	41 5f                	pop    %r15
+  801e84:	5d                   	pop    %rbp
+  801e85:	c3                   	ret
+
+0000000000801e86 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  801e86:	55                   	push   %rbp
+  801e87:	48 89 e5             	mov    %rsp,%rbp
+  801e8a:	41 57                	push   %r15
+  801e8c:	53                   	push   %rbx
+  801e8d:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  801e91:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801e91 <devfile_write+0xb>
+  801e98:	49 bb 9f 61 00 00 00 	movabs $0x619f,%r11
+  801e9f:	00 00 00 
+  801ea2:	4c 01 db             	add    %r11,%rbx
+  801ea5:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  801ea9:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  801ead:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  801eb4:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  801eb8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  801ebc:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  801ec3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801ec7:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  801ece:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ed1:	48 63 d0             	movslq %eax,%rdx
+  801ed4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ed8:	48 39 c2             	cmp    %rax,%rdx
+  801edb:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801edf:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801ee6:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  801eed:	00 
+  801eee:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  801ef5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ef9:	48 01 d0             	add    %rdx,%rax
+  801efc:	48 83 e8 01          	sub    $0x1,%rax
+  801f00:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801f04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f0d:	48 f7 75 d0          	divq   -0x30(%rbp)
+  801f11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f15:	48 29 d0             	sub    %rdx,%rax
+  801f18:	48 c1 e8 0c          	shr    $0xc,%rax
+  801f1c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  801f1f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f22:	89 c6                	mov    %eax,%esi
+  801f24:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801f29:	48 89 c7             	mov    %rax,%rdi
+  801f2c:	49 89 df             	mov    %rbx,%r15
+  801f2f:	48 b8 53 dc ff ff ff 	movabs $0xffffffffffffdc53,%rax
+  801f36:	ff ff ff 
+  801f39:	48 01 d8             	add    %rbx,%rax
+  801f3c:	ff d0                	call   *%rax
+  801f3e:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  801f41:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  801f45:	79 08                	jns    801f4f <devfile_write+0xc9>
+		return r;
+  801f47:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801f4a:	e9 8f 00 00 00       	jmp    801fde <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  801f4f:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  801f56:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  801f5a:	48 89 c6             	mov    %rax,%rsi
+  801f5d:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801f62:	48 89 c7             	mov    %rax,%rdi
+  801f65:	49 89 df             	mov    %rbx,%r15
+  801f68:	48 b8 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rax
+  801f6f:	ff ff ff 
+  801f72:	48 01 d8             	add    %rbx,%rax
+  801f75:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  801f77:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801f7b:	8b 50 0c             	mov    0xc(%rax),%edx
+  801f7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f82:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  801f84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f88:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  801f8f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  801f93:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801f96:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  801f9a:	89 d1                	mov    %edx,%ecx
+  801f9c:	ba 10 00 00 00       	mov    $0x10,%edx
+  801fa1:	48 89 c6             	mov    %rax,%rsi
+  801fa4:	bf 04 00 00 00       	mov    $0x4,%edi
+  801fa9:	48 b8 a0 9a ff ff ff 	movabs $0xffffffffffff9aa0,%rax
+  801fb0:	ff ff ff 
+  801fb3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801fb7:	ff d0                	call   *%rax
+  801fb9:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  801fbc:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801fbf:	89 c6                	mov    %eax,%esi
+  801fc1:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801fc6:	48 89 c7             	mov    %rax,%rdi
+  801fc9:	49 89 df             	mov    %rbx,%r15
+  801fcc:	48 b8 99 dc ff ff ff 	movabs $0xffffffffffffdc99,%rax
+  801fd3:	ff ff ff 
+  801fd6:	48 01 d8             	add    %rbx,%rax
+  801fd9:	ff d0                	call   *%rax
+	return r;
+  801fdb:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  801fde:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  801fe2:	5b                   	pop    %rbx
+  801fe3:	41 5f                	pop    %r15
+  801fe5:	5d                   	pop    %rbp
+  801fe6:	c3                   	ret
+
+0000000000801fe7 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  801fe7:	55                   	push   %rbp
+  801fe8:	48 89 e5             	mov    %rsp,%rbp
+  801feb:	41 57                	push   %r15
+  801fed:	53                   	push   %rbx
+  801fee:	48 83 ec 20          	sub    $0x20,%rsp
+  801ff2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801ff2 <devfile_stat+0xb>
+  801ff9:	49 bb 3e 60 00 00 00 	movabs $0x603e,%r11
+  802000:	00 00 00 
+  802003:	4c 01 db             	add    %r11,%rbx
+  802006:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80200a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80200e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802012:	8b 40 0c             	mov    0xc(%rax),%eax
+  802015:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  80201c:	00 00 00 
+  80201f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802022:	be 00 00 00 00       	mov    $0x0,%esi
+  802027:	bf 05 00 00 00       	mov    $0x5,%edi
+  80202c:	48 b8 64 99 ff ff ff 	movabs $0xffffffffffff9964,%rax
+  802033:	ff ff ff 
+  802036:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80203a:	ff d0                	call   *%rax
+  80203c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80203f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802043:	79 05                	jns    80204a <devfile_stat+0x63>
+		return r;
+  802045:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802048:	eb 65                	jmp    8020af <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80204a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80204e:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  802055:	00 00 00 
+  802058:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80205c:	48 89 d6             	mov    %rdx,%rsi
+  80205f:	48 89 c7             	mov    %rax,%rdi
+  802062:	49 89 df             	mov    %rbx,%r15
+  802065:	48 b8 07 cd ff ff ff 	movabs $0xffffffffffffcd07,%rax
+  80206c:	ff ff ff 
+  80206f:	48 01 d8             	add    %rbx,%rax
+  802072:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802074:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80207b:	00 00 00 
+  80207e:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  802085:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802089:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80208f:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  802096:	00 00 00 
+  802099:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  8020a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020a4:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  8020aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020af:	48 83 c4 20          	add    $0x20,%rsp
+  8020b3:	5b                   	pop    %rbx
+  8020b4:	41 5f                	pop    %r15
+  8020b6:	5d                   	pop    %rbp
+  8020b7:	c3                   	ret
+
+00000000008020b8 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8020b8:	55                   	push   %rbp
+  8020b9:	48 89 e5             	mov    %rsp,%rbp
+  8020bc:	48 83 ec 20          	sub    $0x20,%rsp
+  8020c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020c0 <devfile_trunc+0x8>
+  8020c7:	49 bb 70 5f 00 00 00 	movabs $0x5f70,%r11
+  8020ce:	00 00 00 
+  8020d1:	4c 01 d8             	add    %r11,%rax
+  8020d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020d8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  8020db:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020df:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8020e2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  8020e5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8020e8:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8020eb:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8020ef:	ba 08 00 00 00       	mov    $0x8,%edx
+  8020f4:	48 89 ce             	mov    %rcx,%rsi
+  8020f7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020fc:	48 b9 0c 9a ff ff ff 	movabs $0xffffffffffff9a0c,%rcx
+  802103:	ff ff ff 
+  802106:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80210a:	ff d0                	call   *%rax
+}
+  80210c:	c9                   	leave
+  80210d:	c3                   	ret
+
+000000000080210e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80210e:	55                   	push   %rbp
+  80210f:	48 89 e5             	mov    %rsp,%rbp
+  802112:	41 57                	push   %r15
+  802114:	53                   	push   %rbx
+  802115:	48 83 ec 10          	sub    $0x10,%rsp
+  802119:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802119 <remove+0xb>
+  802120:	49 bb 17 5f 00 00 00 	movabs $0x5f17,%r11
+  802127:	00 00 00 
+  80212a:	4c 01 db             	add    %r11,%rbx
+  80212d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  802131:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802135:	48 89 c7             	mov    %rax,%rdi
+  802138:	49 89 df             	mov    %rbx,%r15
+  80213b:	48 b8 73 cc ff ff ff 	movabs $0xffffffffffffcc73,%rax
+  802142:	ff ff ff 
+  802145:	48 01 d8             	add    %rbx,%rax
+  802148:	ff d0                	call   *%rax
+  80214a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80214f:	7e 07                	jle    802158 <remove+0x4a>
+		return -E_BAD_PATH;
+  802151:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802156:	eb 44                	jmp    80219c <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802158:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80215c:	48 89 c6             	mov    %rax,%rsi
+  80215f:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  802166:	00 00 00 
+  802169:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80216d:	48 89 c7             	mov    %rax,%rdi
+  802170:	49 89 df             	mov    %rbx,%r15
+  802173:	48 b8 07 cd ff ff ff 	movabs $0xffffffffffffcd07,%rax
+  80217a:	ff ff ff 
+  80217d:	48 01 d8             	add    %rbx,%rax
+  802180:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  802182:	be 00 00 00 00       	mov    $0x0,%esi
+  802187:	bf 07 00 00 00       	mov    $0x7,%edi
+  80218c:	48 b8 64 99 ff ff ff 	movabs $0xffffffffffff9964,%rax
+  802193:	ff ff ff 
+  802196:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80219a:	ff d0                	call   *%rax
+}
+  80219c:	48 83 c4 10          	add    $0x10,%rsp
+  8021a0:	5b                   	pop    %rbx
+  8021a1:	41 5f                	pop    %r15
+  8021a3:	5d                   	pop    %rbp
+  8021a4:	c3                   	ret
+
+00000000008021a5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8021a5:	55                   	push   %rbp
+  8021a6:	48 89 e5             	mov    %rsp,%rbp
+  8021a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021a9 <sync+0x4>
+  8021b0:	49 bb 87 5e 00 00 00 	movabs $0x5e87,%r11
+  8021b7:	00 00 00 
+  8021ba:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  8021bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021cc:	48 b9 0c 9a ff ff ff 	movabs $0xffffffffffff9a0c,%rcx
+  8021d3:	ff ff ff 
+  8021d6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8021da:	ff d0                	call   *%rax
+}
+  8021dc:	5d                   	pop    %rbp
+  8021dd:	c3                   	ret
+
+00000000008021de <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  8021de:	55                   	push   %rbp
+  8021df:	48 89 e5             	mov    %rsp,%rbp
+  8021e2:	41 57                	push   %r15
+  8021e4:	53                   	push   %rbx
+  8021e5:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8021ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8021ec <copy+0xe>
+  8021f3:	49 bb 44 5e 00 00 00 	movabs $0x5e44,%r11
+  8021fa:	00 00 00 
+  8021fd:	4c 01 db             	add    %r11,%rbx
+  802200:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  802207:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  80220e:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  802215:	be 00 00 00 00       	mov    $0x0,%esi
+  80221a:	48 89 c7             	mov    %rax,%rdi
+  80221d:	48 b8 ab 9b ff ff ff 	movabs $0xffffffffffff9bab,%rax
+  802224:	ff ff ff 
+  802227:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80222b:	ff d0                	call   *%rax
+  80222d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  802230:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802234:	79 35                	jns    80226b <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  802236:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802239:	89 c6                	mov    %eax,%esi
+  80223b:	48 b8 d6 de ff ff ff 	movabs $0xffffffffffffded6,%rax
+  802242:	ff ff ff 
+  802245:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802249:	48 89 c7             	mov    %rax,%rdi
+  80224c:	49 89 df             	mov    %rbx,%r15
+  80224f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802254:	48 ba 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%rdx
+  80225b:	ff ff ff 
+  80225e:	48 01 da             	add    %rbx,%rdx
+  802261:	ff d2                	call   *%rdx
+		return fd_src;
+  802263:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802266:	e9 d7 01 00 00       	jmp    802442 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  80226b:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  802272:	be 01 01 00 00       	mov    $0x101,%esi
+  802277:	48 89 c7             	mov    %rax,%rdi
+  80227a:	48 b8 ab 9b ff ff ff 	movabs $0xffffffffffff9bab,%rax
+  802281:	ff ff ff 
+  802284:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802288:	ff d0                	call   *%rax
+  80228a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  80228d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802291:	0f 89 df 00 00 00    	jns    802376 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  802297:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80229a:	89 c6                	mov    %eax,%esi
+  80229c:	48 b8 ec de ff ff ff 	movabs $0xffffffffffffdeec,%rax
+  8022a3:	ff ff ff 
+  8022a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8022aa:	48 89 c7             	mov    %rax,%rdi
+  8022ad:	49 89 df             	mov    %rbx,%r15
+  8022b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b5:	48 ba 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%rdx
+  8022bc:	ff ff ff 
+  8022bf:	48 01 da             	add    %rbx,%rdx
+  8022c2:	ff d2                	call   *%rdx
+		close(fd_src);
+  8022c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022c7:	89 c7                	mov    %eax,%edi
+  8022c9:	49 89 df             	mov    %rbx,%r15
+  8022cc:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  8022d3:	ff ff ff 
+  8022d6:	48 01 d8             	add    %rbx,%rax
+  8022d9:	ff d0                	call   *%rax
+		return fd_dest;
+  8022db:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8022de:	e9 5f 01 00 00       	jmp    802442 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  8022e3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8022e6:	48 63 d0             	movslq %eax,%rdx
+  8022e9:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8022f0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8022f3:	48 89 ce             	mov    %rcx,%rsi
+  8022f6:	89 c7                	mov    %eax,%edi
+  8022f8:	49 89 df             	mov    %rbx,%r15
+  8022fb:	48 b8 82 95 ff ff ff 	movabs $0xffffffffffff9582,%rax
+  802302:	ff ff ff 
+  802305:	48 01 d8             	add    %rbx,%rax
+  802308:	ff d0                	call   *%rax
+  80230a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  80230d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  802311:	79 63                	jns    802376 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  802313:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  802316:	89 c6                	mov    %eax,%esi
+  802318:	48 b8 06 df ff ff ff 	movabs $0xffffffffffffdf06,%rax
+  80231f:	ff ff ff 
+  802322:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802326:	48 89 c7             	mov    %rax,%rdi
+  802329:	49 89 df             	mov    %rbx,%r15
+  80232c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802331:	48 ba 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%rdx
+  802338:	ff ff ff 
+  80233b:	48 01 da             	add    %rbx,%rdx
+  80233e:	ff d2                	call   *%rdx
+			close(fd_src);
+  802340:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802343:	89 c7                	mov    %eax,%edi
+  802345:	49 89 df             	mov    %rbx,%r15
+  802348:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  80234f:	ff ff ff 
+  802352:	48 01 d8             	add    %rbx,%rax
+  802355:	ff d0                	call   *%rax
+			close(fd_dest);
+  802357:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80235a:	89 c7                	mov    %eax,%edi
+  80235c:	49 89 df             	mov    %rbx,%r15
+  80235f:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  802366:	ff ff ff 
+  802369:	48 01 d8             	add    %rbx,%rax
+  80236c:	ff d0                	call   *%rax
+			return write_size;
+  80236e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  802371:	e9 cc 00 00 00       	jmp    802442 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  802376:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80237d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802380:	ba 00 02 00 00       	mov    $0x200,%edx
+  802385:	48 89 ce             	mov    %rcx,%rsi
+  802388:	89 c7                	mov    %eax,%edi
+  80238a:	49 89 df             	mov    %rbx,%r15
+  80238d:	48 b8 dc 93 ff ff ff 	movabs $0xffffffffffff93dc,%rax
+  802394:	ff ff ff 
+  802397:	48 01 d8             	add    %rbx,%rax
+  80239a:	ff d0                	call   *%rax
+  80239c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80239f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8023a3:	0f 8f 3a ff ff ff    	jg     8022e3 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  8023a9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8023ad:	79 60                	jns    80240f <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  8023af:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8023b2:	89 c6                	mov    %eax,%esi
+  8023b4:	48 b8 19 df ff ff ff 	movabs $0xffffffffffffdf19,%rax
+  8023bb:	ff ff ff 
+  8023be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8023c2:	48 89 c7             	mov    %rax,%rdi
+  8023c5:	49 89 df             	mov    %rbx,%r15
+  8023c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023cd:	48 ba 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%rdx
+  8023d4:	ff ff ff 
+  8023d7:	48 01 da             	add    %rbx,%rdx
+  8023da:	ff d2                	call   *%rdx
+		close(fd_src);
+  8023dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023df:	89 c7                	mov    %eax,%edi
+  8023e1:	49 89 df             	mov    %rbx,%r15
+  8023e4:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  8023eb:	ff ff ff 
+  8023ee:	48 01 d8             	add    %rbx,%rax
+  8023f1:	ff d0                	call   *%rax
+		close(fd_dest);
+  8023f3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023f6:	89 c7                	mov    %eax,%edi
+  8023f8:	49 89 df             	mov    %rbx,%r15
+  8023fb:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  802402:	ff ff ff 
+  802405:	48 01 d8             	add    %rbx,%rax
+  802408:	ff d0                	call   *%rax
+		return read_size;
+  80240a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80240d:	eb 33                	jmp    802442 <copy+0x264>
+	}
+	close(fd_src);
+  80240f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802412:	89 c7                	mov    %eax,%edi
+  802414:	49 89 df             	mov    %rbx,%r15
+  802417:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  80241e:	ff ff ff 
+  802421:	48 01 d8             	add    %rbx,%rax
+  802424:	ff d0                	call   *%rax
+	close(fd_dest);
+  802426:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802429:	89 c7                	mov    %eax,%edi
+  80242b:	49 89 df             	mov    %rbx,%r15
+  80242e:	48 b8 24 91 ff ff ff 	movabs $0xffffffffffff9124,%rax
+  802435:	ff ff ff 
+  802438:	48 01 d8             	add    %rbx,%rax
+  80243b:	ff d0                	call   *%rax
+	return 0;
+  80243d:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  802442:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  802449:	5b                   	pop    %rbx
+  80244a:	41 5f                	pop    %r15
+  80244c:	5d                   	pop    %rbp
+  80244d:	c3                   	ret
+
+000000000080244e <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  80244e:	55                   	push   %rbp
+  80244f:	48 89 e5             	mov    %rsp,%rbp
+  802452:	41 57                	push   %r15
+  802454:	53                   	push   %rbx
+  802455:	48 83 ec 20          	sub    $0x20,%rsp
+  802459:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802459 <fd2sockid+0xb>
+  802460:	49 bb d7 5b 00 00 00 	movabs $0x5bd7,%r11
+  802467:	00 00 00 
+  80246a:	4c 01 db             	add    %r11,%rbx
+  80246d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802470:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802474:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802477:	48 89 d6             	mov    %rdx,%rsi
+  80247a:	89 c7                	mov    %eax,%edi
+  80247c:	49 89 df             	mov    %rbx,%r15
+  80247f:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  802486:	ff ff ff 
+  802489:	48 01 d8             	add    %rbx,%rax
+  80248c:	ff d0                	call   *%rax
+  80248e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802491:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802495:	79 05                	jns    80249c <fd2sockid+0x4e>
+		return r;
+  802497:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80249a:	eb 25                	jmp    8024c1 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80249c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024a0:	8b 10                	mov    (%rax),%edx
+  8024a2:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  8024a9:	00 00 00 
+  8024ac:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8024af:	39 c2                	cmp    %eax,%edx
+  8024b1:	74 07                	je     8024ba <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8024b3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8024b8:	eb 07                	jmp    8024c1 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8024ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024be:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8024c1:	48 83 c4 20          	add    $0x20,%rsp
+  8024c5:	5b                   	pop    %rbx
+  8024c6:	41 5f                	pop    %r15
+  8024c8:	5d                   	pop    %rbp
+  8024c9:	c3                   	ret
+
+00000000008024ca <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8024ca:	55                   	push   %rbp
+  8024cb:	48 89 e5             	mov    %rsp,%rbp
+  8024ce:	41 57                	push   %r15
+  8024d0:	53                   	push   %rbx
+  8024d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8024d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8024d5 <alloc_sockfd+0xb>
+  8024dc:	49 bb 5b 5b 00 00 00 	movabs $0x5b5b,%r11
+  8024e3:	00 00 00 
+  8024e6:	4c 01 db             	add    %r11,%rbx
+  8024e9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8024ec:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8024f0:	48 89 c7             	mov    %rax,%rdi
+  8024f3:	49 89 df             	mov    %rbx,%r15
+  8024f6:	48 b8 df 8d ff ff ff 	movabs $0xffffffffffff8ddf,%rax
+  8024fd:	ff ff ff 
+  802500:	48 01 d8             	add    %rbx,%rax
+  802503:	ff d0                	call   *%rax
+  802505:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802508:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80250c:	78 2c                	js     80253a <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80250e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802512:	ba 07 04 00 00       	mov    $0x407,%edx
+  802517:	48 89 c6             	mov    %rax,%rsi
+  80251a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80251f:	49 89 df             	mov    %rbx,%r15
+  802522:	48 b8 bc 85 ff ff ff 	movabs $0xffffffffffff85bc,%rax
+  802529:	ff ff ff 
+  80252c:	48 01 d8             	add    %rbx,%rax
+  80252f:	ff d0                	call   *%rax
+  802531:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802534:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802538:	79 1c                	jns    802556 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80253a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80253d:	89 c7                	mov    %eax,%edi
+  80253f:	49 89 df             	mov    %rbx,%r15
+  802542:	48 b8 8e ac ff ff ff 	movabs $0xffffffffffffac8e,%rax
+  802549:	ff ff ff 
+  80254c:	48 01 d8             	add    %rbx,%rax
+  80254f:	ff d0                	call   *%rax
+		return r;
+  802551:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802554:	eb 41                	jmp    802597 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  802556:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80255a:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  802561:	00 00 00 
+  802564:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  802567:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  802569:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80256d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  802574:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802578:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80257b:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  80257e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802582:	48 89 c7             	mov    %rax,%rdi
+  802585:	49 89 df             	mov    %rbx,%r15
+  802588:	48 b8 65 8d ff ff ff 	movabs $0xffffffffffff8d65,%rax
+  80258f:	ff ff ff 
+  802592:	48 01 d8             	add    %rbx,%rax
+  802595:	ff d0                	call   *%rax
+}
+  802597:	48 83 c4 20          	add    $0x20,%rsp
+  80259b:	5b                   	pop    %rbx
+  80259c:	41 5f                	pop    %r15
+  80259e:	5d                   	pop    %rbp
+  80259f:	c3                   	ret
+
+00000000008025a0 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8025a0:	55                   	push   %rbp
+  8025a1:	48 89 e5             	mov    %rsp,%rbp
+  8025a4:	41 57                	push   %r15
+  8025a6:	53                   	push   %rbx
+  8025a7:	48 83 ec 30          	sub    $0x30,%rsp
+  8025ab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8025ab <accept+0xb>
+  8025b2:	49 bb 85 5a 00 00 00 	movabs $0x5a85,%r11
+  8025b9:	00 00 00 
+  8025bc:	4c 01 db             	add    %r11,%rbx
+  8025bf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8025c2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8025c6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8025ca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8025cd:	89 c7                	mov    %eax,%edi
+  8025cf:	48 b8 1e a4 ff ff ff 	movabs $0xffffffffffffa41e,%rax
+  8025d6:	ff ff ff 
+  8025d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8025dd:	ff d0                	call   *%rax
+  8025df:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8025e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8025e6:	79 05                	jns    8025ed <accept+0x4d>
+		return r;
+  8025e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025eb:	eb 45                	jmp    802632 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8025ed:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8025f1:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8025f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025f8:	48 89 ce             	mov    %rcx,%rsi
+  8025fb:	89 c7                	mov    %eax,%edi
+  8025fd:	49 89 df             	mov    %rbx,%r15
+  802600:	48 b8 fc aa ff ff ff 	movabs $0xffffffffffffaafc,%rax
+  802607:	ff ff ff 
+  80260a:	48 01 d8             	add    %rbx,%rax
+  80260d:	ff d0                	call   *%rax
+  80260f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802612:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802616:	79 05                	jns    80261d <accept+0x7d>
+		return r;
+  802618:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80261b:	eb 15                	jmp    802632 <accept+0x92>
+	return alloc_sockfd(r);
+  80261d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802620:	89 c7                	mov    %eax,%edi
+  802622:	48 b8 9a a4 ff ff ff 	movabs $0xffffffffffffa49a,%rax
+  802629:	ff ff ff 
+  80262c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802630:	ff d0                	call   *%rax
+}
+  802632:	48 83 c4 30          	add    $0x30,%rsp
+  802636:	5b                   	pop    %rbx
+  802637:	41 5f                	pop    %r15
+  802639:	5d                   	pop    %rbp
+  80263a:	c3                   	ret
+
+000000000080263b <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80263b:	55                   	push   %rbp
+  80263c:	48 89 e5             	mov    %rsp,%rbp
+  80263f:	41 57                	push   %r15
+  802641:	53                   	push   %rbx
+  802642:	48 83 ec 20          	sub    $0x20,%rsp
+  802646:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802646 <bind+0xb>
+  80264d:	49 bb ea 59 00 00 00 	movabs $0x59ea,%r11
+  802654:	00 00 00 
+  802657:	4c 01 db             	add    %r11,%rbx
+  80265a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80265d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802661:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  802664:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802667:	89 c7                	mov    %eax,%edi
+  802669:	48 b8 1e a4 ff ff ff 	movabs $0xffffffffffffa41e,%rax
+  802670:	ff ff ff 
+  802673:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802677:	ff d0                	call   *%rax
+  802679:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80267c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802680:	79 05                	jns    802687 <bind+0x4c>
+		return r;
+  802682:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802685:	eb 21                	jmp    8026a8 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  802687:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80268a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80268e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802691:	48 89 ce             	mov    %rcx,%rsi
+  802694:	89 c7                	mov    %eax,%edi
+  802696:	49 89 df             	mov    %rbx,%r15
+  802699:	48 b8 a8 ab ff ff ff 	movabs $0xffffffffffffaba8,%rax
+  8026a0:	ff ff ff 
+  8026a3:	48 01 d8             	add    %rbx,%rax
+  8026a6:	ff d0                	call   *%rax
+}
+  8026a8:	48 83 c4 20          	add    $0x20,%rsp
+  8026ac:	5b                   	pop    %rbx
+  8026ad:	41 5f                	pop    %r15
+  8026af:	5d                   	pop    %rbp
+  8026b0:	c3                   	ret
+
+00000000008026b1 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8026b1:	55                   	push   %rbp
+  8026b2:	48 89 e5             	mov    %rsp,%rbp
+  8026b5:	41 57                	push   %r15
+  8026b7:	53                   	push   %rbx
+  8026b8:	48 83 ec 20          	sub    $0x20,%rsp
+  8026bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8026bc <shutdown+0xb>
+  8026c3:	49 bb 74 59 00 00 00 	movabs $0x5974,%r11
+  8026ca:	00 00 00 
+  8026cd:	4c 01 db             	add    %r11,%rbx
+  8026d0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8026d3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8026d6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026d9:	89 c7                	mov    %eax,%edi
+  8026db:	48 b8 1e a4 ff ff ff 	movabs $0xffffffffffffa41e,%rax
+  8026e2:	ff ff ff 
+  8026e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8026e9:	ff d0                	call   *%rax
+  8026eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8026ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8026f2:	79 05                	jns    8026f9 <shutdown+0x48>
+		return r;
+  8026f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026f7:	eb 1c                	jmp    802715 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8026f9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8026fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026ff:	89 d6                	mov    %edx,%esi
+  802701:	89 c7                	mov    %eax,%edi
+  802703:	49 89 df             	mov    %rbx,%r15
+  802706:	48 b8 3d ac ff ff ff 	movabs $0xffffffffffffac3d,%rax
+  80270d:	ff ff ff 
+  802710:	48 01 d8             	add    %rbx,%rax
+  802713:	ff d0                	call   *%rax
+}
+  802715:	48 83 c4 20          	add    $0x20,%rsp
+  802719:	5b                   	pop    %rbx
+  80271a:	41 5f                	pop    %r15
+  80271c:	5d                   	pop    %rbp
+  80271d:	c3                   	ret
+
+000000000080271e <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  80271e:	55                   	push   %rbp
+  80271f:	48 89 e5             	mov    %rsp,%rbp
+  802722:	41 57                	push   %r15
+  802724:	53                   	push   %rbx
+  802725:	48 83 ec 10          	sub    $0x10,%rsp
+  802729:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802729 <devsock_close+0xb>
+  802730:	49 bb 07 59 00 00 00 	movabs $0x5907,%r11
+  802737:	00 00 00 
+  80273a:	4c 01 db             	add    %r11,%rbx
+  80273d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  802741:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802745:	48 89 c7             	mov    %rax,%rdi
+  802748:	49 89 df             	mov    %rbx,%r15
+  80274b:	48 b8 6e dd ff ff ff 	movabs $0xffffffffffffdd6e,%rax
+  802752:	ff ff ff 
+  802755:	48 01 d8             	add    %rbx,%rax
+  802758:	ff d0                	call   *%rax
+  80275a:	83 f8 01             	cmp    $0x1,%eax
+  80275d:	75 1d                	jne    80277c <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  80275f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802763:	8b 40 0c             	mov    0xc(%rax),%eax
+  802766:	89 c7                	mov    %eax,%edi
+  802768:	49 89 df             	mov    %rbx,%r15
+  80276b:	48 b8 8e ac ff ff ff 	movabs $0xffffffffffffac8e,%rax
+  802772:	ff ff ff 
+  802775:	48 01 d8             	add    %rbx,%rax
+  802778:	ff d0                	call   *%rax
+  80277a:	eb 05                	jmp    802781 <devsock_close+0x63>
+	else
+		return 0;
+  80277c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802781:	48 83 c4 10          	add    $0x10,%rsp
+  802785:	5b                   	pop    %rbx
+  802786:	41 5f                	pop    %r15
+  802788:	5d                   	pop    %rbp
+  802789:	c3                   	ret
+
+000000000080278a <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80278a:	55                   	push   %rbp
+  80278b:	48 89 e5             	mov    %rsp,%rbp
+  80278e:	41 57                	push   %r15
+  802790:	53                   	push   %rbx
+  802791:	48 83 ec 20          	sub    $0x20,%rsp
+  802795:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802795 <connect+0xb>
+  80279c:	49 bb 9b 58 00 00 00 	movabs $0x589b,%r11
+  8027a3:	00 00 00 
+  8027a6:	4c 01 db             	add    %r11,%rbx
+  8027a9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8027ac:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8027b0:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8027b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8027b6:	89 c7                	mov    %eax,%edi
+  8027b8:	48 b8 1e a4 ff ff ff 	movabs $0xffffffffffffa41e,%rax
+  8027bf:	ff ff ff 
+  8027c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8027cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8027cf:	79 05                	jns    8027d6 <connect+0x4c>
+		return r;
+  8027d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027d4:	eb 21                	jmp    8027f7 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8027d6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8027d9:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8027dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027e0:	48 89 ce             	mov    %rcx,%rsi
+  8027e3:	89 c7                	mov    %eax,%edi
+  8027e5:	49 89 df             	mov    %rbx,%r15
+  8027e8:	48 b8 d6 ac ff ff ff 	movabs $0xffffffffffffacd6,%rax
+  8027ef:	ff ff ff 
+  8027f2:	48 01 d8             	add    %rbx,%rax
+  8027f5:	ff d0                	call   *%rax
+}
+  8027f7:	48 83 c4 20          	add    $0x20,%rsp
+  8027fb:	5b                   	pop    %rbx
+  8027fc:	41 5f                	pop    %r15
+  8027fe:	5d                   	pop    %rbp
+  8027ff:	c3                   	ret
+
+0000000000802800 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  802800:	55                   	push   %rbp
+  802801:	48 89 e5             	mov    %rsp,%rbp
+  802804:	41 57                	push   %r15
+  802806:	53                   	push   %rbx
+  802807:	48 83 ec 20          	sub    $0x20,%rsp
+  80280b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80280b <listen+0xb>
+  802812:	49 bb 25 58 00 00 00 	movabs $0x5825,%r11
+  802819:	00 00 00 
+  80281c:	4c 01 db             	add    %r11,%rbx
+  80281f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802822:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  802825:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802828:	89 c7                	mov    %eax,%edi
+  80282a:	48 b8 1e a4 ff ff ff 	movabs $0xffffffffffffa41e,%rax
+  802831:	ff ff ff 
+  802834:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802838:	ff d0                	call   *%rax
+  80283a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80283d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802841:	79 05                	jns    802848 <listen+0x48>
+		return r;
+  802843:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802846:	eb 1c                	jmp    802864 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  802848:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80284b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80284e:	89 d6                	mov    %edx,%esi
+  802850:	89 c7                	mov    %eax,%edi
+  802852:	49 89 df             	mov    %rbx,%r15
+  802855:	48 b8 6b ad ff ff ff 	movabs $0xffffffffffffad6b,%rax
+  80285c:	ff ff ff 
+  80285f:	48 01 d8             	add    %rbx,%rax
+  802862:	ff d0                	call   *%rax
+}
+  802864:	48 83 c4 20          	add    $0x20,%rsp
+  802868:	5b                   	pop    %rbx
+  802869:	41 5f                	pop    %r15
+  80286b:	5d                   	pop    %rbp
+  80286c:	c3                   	ret
+
+000000000080286d <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  80286d:	55                   	push   %rbp
+  80286e:	48 89 e5             	mov    %rsp,%rbp
+  802871:	41 57                	push   %r15
+  802873:	48 83 ec 28          	sub    $0x28,%rsp
+  802877:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802877 <devsock_read+0xa>
+  80287e:	49 bb b9 57 00 00 00 	movabs $0x57b9,%r11
+  802885:	00 00 00 
+  802888:	4c 01 d8             	add    %r11,%rax
+  80288b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80288f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802893:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802897:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80289b:	41 89 d0             	mov    %edx,%r8d
+  80289e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8028a2:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8028a5:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8028a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ae:	44 89 c2             	mov    %r8d,%edx
+  8028b1:	49 89 c7             	mov    %rax,%r15
+  8028b4:	49 b8 bc ad ff ff ff 	movabs $0xffffffffffffadbc,%r8
+  8028bb:	ff ff ff 
+  8028be:	49 01 c0             	add    %rax,%r8
+  8028c1:	41 ff d0             	call   *%r8
+}
+  8028c4:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8028c8:	c9                   	leave
+  8028c9:	c3                   	ret
+
+00000000008028ca <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8028ca:	55                   	push   %rbp
+  8028cb:	48 89 e5             	mov    %rsp,%rbp
+  8028ce:	41 57                	push   %r15
+  8028d0:	48 83 ec 28          	sub    $0x28,%rsp
+  8028d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028d4 <devsock_write+0xa>
+  8028db:	49 bb 5c 57 00 00 00 	movabs $0x575c,%r11
+  8028e2:	00 00 00 
+  8028e5:	4c 01 d8             	add    %r11,%rax
+  8028e8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8028ec:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028f0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8028f4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028f8:	41 89 d0             	mov    %edx,%r8d
+  8028fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8028ff:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  802902:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802906:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80290b:	44 89 c2             	mov    %r8d,%edx
+  80290e:	49 89 c7             	mov    %rax,%r15
+  802911:	49 b8 d9 ae ff ff ff 	movabs $0xffffffffffffaed9,%r8
+  802918:	ff ff ff 
+  80291b:	49 01 c0             	add    %rax,%r8
+  80291e:	41 ff d0             	call   *%r8
+}
+  802921:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802925:	c9                   	leave
+  802926:	c3                   	ret
+
+0000000000802927 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802927:	55                   	push   %rbp
+  802928:	48 89 e5             	mov    %rsp,%rbp
+  80292b:	41 57                	push   %r15
+  80292d:	48 83 ec 18          	sub    $0x18,%rsp
+  802931:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802931 <devsock_stat+0xa>
+  802938:	49 bb ff 56 00 00 00 	movabs $0x56ff,%r11
+  80293f:	00 00 00 
+  802942:	4c 01 d8             	add    %r11,%rax
+  802945:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802949:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  80294d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802951:	48 b9 34 df ff ff ff 	movabs $0xffffffffffffdf34,%rcx
+  802958:	ff ff ff 
+  80295b:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80295f:	48 89 ce             	mov    %rcx,%rsi
+  802962:	48 89 d7             	mov    %rdx,%rdi
+  802965:	49 89 c7             	mov    %rax,%r15
+  802968:	48 ba 07 cd ff ff ff 	movabs $0xffffffffffffcd07,%rdx
+  80296f:	ff ff ff 
+  802972:	48 01 c2             	add    %rax,%rdx
+  802975:	ff d2                	call   *%rdx
+	return 0;
+  802977:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80297c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802980:	c9                   	leave
+  802981:	c3                   	ret
+
+0000000000802982 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802982:	55                   	push   %rbp
+  802983:	48 89 e5             	mov    %rsp,%rbp
+  802986:	41 57                	push   %r15
+  802988:	53                   	push   %rbx
+  802989:	48 83 ec 20          	sub    $0x20,%rsp
+  80298d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80298d <socket+0xb>
+  802994:	49 bb a3 56 00 00 00 	movabs $0x56a3,%r11
+  80299b:	00 00 00 
+  80299e:	4c 01 db             	add    %r11,%rbx
+  8029a1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8029a4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8029a7:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8029aa:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8029ad:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8029b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8029b3:	89 ce                	mov    %ecx,%esi
+  8029b5:	89 c7                	mov    %eax,%edi
+  8029b7:	49 89 df             	mov    %rbx,%r15
+  8029ba:	48 b8 b0 b0 ff ff ff 	movabs $0xffffffffffffb0b0,%rax
+  8029c1:	ff ff ff 
+  8029c4:	48 01 d8             	add    %rbx,%rax
+  8029c7:	ff d0                	call   *%rax
+  8029c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8029cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8029d0:	79 05                	jns    8029d7 <socket+0x55>
+		return r;
+  8029d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029d5:	eb 15                	jmp    8029ec <socket+0x6a>
+	return alloc_sockfd(r);
+  8029d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029da:	89 c7                	mov    %eax,%edi
+  8029dc:	48 b8 9a a4 ff ff ff 	movabs $0xffffffffffffa49a,%rax
+  8029e3:	ff ff ff 
+  8029e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029ea:	ff d0                	call   *%rax
+}
+  8029ec:	48 83 c4 20          	add    $0x20,%rsp
+  8029f0:	5b                   	pop    %rbx
+  8029f1:	41 5f                	pop    %r15
+  8029f3:	5d                   	pop    %rbp
+  8029f4:	c3                   	ret
+
+00000000008029f5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8029f5:	55                   	push   %rbp
+  8029f6:	48 89 e5             	mov    %rsp,%rbp
+  8029f9:	41 57                	push   %r15
+  8029fb:	53                   	push   %rbx
+  8029fc:	48 83 ec 10          	sub    $0x10,%rsp
+  802a00:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a00 <nsipc+0xb>
+  802a07:	49 bb 30 56 00 00 00 	movabs $0x5630,%r11
+  802a0e:	00 00 00 
+  802a11:	4c 01 db             	add    %r11,%rbx
+  802a14:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  802a17:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  802a1e:	00 00 00 
+  802a21:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802a24:	85 c0                	test   %eax,%eax
+  802a26:	75 24                	jne    802a4c <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a28:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a2d:	49 89 df             	mov    %rbx,%r15
+  802a30:	48 b8 df dc ff ff ff 	movabs $0xffffffffffffdcdf,%rax
+  802a37:	ff ff ff 
+  802a3a:	48 01 d8             	add    %rbx,%rax
+  802a3d:	ff d0                	call   *%rax
+  802a3f:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  802a46:	00 00 00 
+  802a49:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  802a4c:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  802a53:	00 00 00 
+  802a56:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802a59:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802a5c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a68:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802a6d:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802a74:	00 00 00 
+  802a77:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  802a7b:	89 c7                	mov    %eax,%edi
+  802a7d:	49 89 df             	mov    %rbx,%r15
+  802a80:	48 b8 fe d6 ff ff ff 	movabs $0xffffffffffffd6fe,%rax
+  802a87:	ff ff ff 
+  802a8a:	48 01 d8             	add    %rbx,%rax
+  802a8d:	ff d0                	call   *%rax
+}
+  802a8f:	48 83 c4 10          	add    $0x10,%rsp
+  802a93:	5b                   	pop    %rbx
+  802a94:	41 5f                	pop    %r15
+  802a96:	5d                   	pop    %rbp
+  802a97:	c3                   	ret
+
+0000000000802a98 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  802a98:	55                   	push   %rbp
+  802a99:	48 89 e5             	mov    %rsp,%rbp
+  802a9c:	41 57                	push   %r15
+  802a9e:	53                   	push   %rbx
+  802a9f:	48 83 ec 20          	sub    $0x20,%rsp
+  802aa3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802aa3 <nsipc_words+0xb>
+  802aaa:	49 bb 8d 55 00 00 00 	movabs $0x558d,%r11
+  802ab1:	00 00 00 
+  802ab4:	4c 01 db             	add    %r11,%rbx
+  802ab7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802aba:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802abe:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  802ac2:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  802ac9:	00 00 00 
+  802acc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802acf:	85 c0                	test   %eax,%eax
+  802ad1:	75 24                	jne    802af7 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ad3:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ad8:	49 89 df             	mov    %rbx,%r15
+  802adb:	48 b8 df dc ff ff ff 	movabs $0xffffffffffffdcdf,%rax
+  802ae2:	ff ff ff 
+  802ae5:	48 01 d8             	add    %rbx,%rax
+  802ae8:	ff d0                	call   *%rax
+  802aea:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  802af1:	00 00 00 
+  802af4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  802af7:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  802afe:	00 00 00 
+  802b01:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802b04:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802b08:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b0c:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802b0f:	89 c7                	mov    %eax,%edi
+  802b11:	49 89 df             	mov    %rbx,%r15
+  802b14:	48 b8 e9 d7 ff ff ff 	movabs $0xffffffffffffd7e9,%rax
+  802b1b:	ff ff ff 
+  802b1e:	48 01 d8             	add    %rbx,%rax
+  802b21:	ff d0                	call   *%rax
+}
+  802b23:	48 83 c4 20          	add    $0x20,%rsp
+  802b27:	5b                   	pop    %rbx
+  802b28:	41 5f                	pop    %r15
+  802b2a:	5d                   	pop    %rbp
+  802b2b:	c3                   	ret
+
+0000000000802b2c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802b2c:	55                   	push   %rbp
+  802b2d:	48 89 e5             	mov    %rsp,%rbp
+  802b30:	41 57                	push   %r15
+  802b32:	53                   	push   %rbx
+  802b33:	48 83 ec 30          	sub    $0x30,%rsp
+  802b37:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b37 <nsipc_accept+0xb>
+  802b3e:	49 bb f9 54 00 00 00 	movabs $0x54f9,%r11
+  802b45:	00 00 00 
+  802b48:	4c 01 db             	add    %r11,%rbx
+  802b4b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802b4e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802b52:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802b56:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802b5d:	00 00 00 
+  802b60:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802b63:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b66:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b6b:	48 b8 c5 a9 ff ff ff 	movabs $0xffffffffffffa9c5,%rax
+  802b72:	ff ff ff 
+  802b75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b79:	ff d0                	call   *%rax
+  802b7b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b7e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b82:	78 48                	js     802bcc <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  802b84:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  802b8b:	00 00 00 
+  802b8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b92:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b9a:	8b 40 10             	mov    0x10(%rax),%eax
+  802b9d:	89 c2                	mov    %eax,%edx
+  802b9f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802ba3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ba7:	48 89 ce             	mov    %rcx,%rsi
+  802baa:	48 89 c7             	mov    %rax,%rdi
+  802bad:	49 89 df             	mov    %rbx,%r15
+  802bb0:	48 b8 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rax
+  802bb7:	ff ff ff 
+  802bba:	48 01 d8             	add    %rbx,%rax
+  802bbd:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  802bbf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bc3:	8b 50 10             	mov    0x10(%rax),%edx
+  802bc6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bca:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  802bcc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802bcf:	48 83 c4 30          	add    $0x30,%rsp
+  802bd3:	5b                   	pop    %rbx
+  802bd4:	41 5f                	pop    %r15
+  802bd6:	5d                   	pop    %rbp
+  802bd7:	c3                   	ret
+
+0000000000802bd8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802bd8:	55                   	push   %rbp
+  802bd9:	48 89 e5             	mov    %rsp,%rbp
+  802bdc:	41 57                	push   %r15
+  802bde:	53                   	push   %rbx
+  802bdf:	48 83 ec 10          	sub    $0x10,%rsp
+  802be3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802be3 <nsipc_bind+0xb>
+  802bea:	49 bb 4d 54 00 00 00 	movabs $0x544d,%r11
+  802bf1:	00 00 00 
+  802bf4:	4c 01 db             	add    %r11,%rbx
+  802bf7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802bfa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802bfe:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  802c01:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802c08:	00 00 00 
+  802c0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c0e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c11:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802c14:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c18:	48 89 c6             	mov    %rax,%rsi
+  802c1b:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  802c22:	00 00 00 
+  802c25:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c29:	48 89 c7             	mov    %rax,%rdi
+  802c2c:	49 89 df             	mov    %rbx,%r15
+  802c2f:	48 b8 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rax
+  802c36:	ff ff ff 
+  802c39:	48 01 d8             	add    %rbx,%rax
+  802c3c:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  802c3e:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802c45:	00 00 00 
+  802c48:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802c4b:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  802c4f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c54:	48 b8 c5 a9 ff ff ff 	movabs $0xffffffffffffa9c5,%rax
+  802c5b:	ff ff ff 
+  802c5e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c62:	ff d0                	call   *%rax
+}
+  802c64:	48 83 c4 10          	add    $0x10,%rsp
+  802c68:	5b                   	pop    %rbx
+  802c69:	41 5f                	pop    %r15
+  802c6b:	5d                   	pop    %rbp
+  802c6c:	c3                   	ret
+
+0000000000802c6d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c6d:	55                   	push   %rbp
+  802c6e:	48 89 e5             	mov    %rsp,%rbp
+  802c71:	48 83 ec 20          	sub    $0x20,%rsp
+  802c75:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c75 <nsipc_shutdown+0x8>
+  802c7c:	49 bb bb 53 00 00 00 	movabs $0x53bb,%r11
+  802c83:	00 00 00 
+  802c86:	4c 01 d8             	add    %r11,%rax
+  802c89:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802c8c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  802c8f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802c92:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  802c95:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802c98:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  802c9b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  802c9f:	ba 08 00 00 00       	mov    $0x8,%edx
+  802ca4:	48 89 ce             	mov    %rcx,%rsi
+  802ca7:	bf 03 00 00 00       	mov    $0x3,%edi
+  802cac:	48 b9 68 aa ff ff ff 	movabs $0xffffffffffffaa68,%rcx
+  802cb3:	ff ff ff 
+  802cb6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802cba:	ff d0                	call   *%rax
+}
+  802cbc:	c9                   	leave
+  802cbd:	c3                   	ret
+
+0000000000802cbe <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802cbe:	55                   	push   %rbp
+  802cbf:	48 89 e5             	mov    %rsp,%rbp
+  802cc2:	48 83 ec 20          	sub    $0x20,%rsp
+  802cc6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802cc6 <nsipc_close+0x8>
+  802ccd:	49 bb 6a 53 00 00 00 	movabs $0x536a,%r11
+  802cd4:	00 00 00 
+  802cd7:	4c 01 d8             	add    %r11,%rax
+  802cda:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  802cdd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ce0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  802ce3:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  802ce7:	ba 04 00 00 00       	mov    $0x4,%edx
+  802cec:	48 89 ce             	mov    %rcx,%rsi
+  802cef:	bf 04 00 00 00       	mov    $0x4,%edi
+  802cf4:	48 b9 68 aa ff ff ff 	movabs $0xffffffffffffaa68,%rcx
+  802cfb:	ff ff ff 
+  802cfe:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802d02:	ff d0                	call   *%rax
+}
+  802d04:	c9                   	leave
+  802d05:	c3                   	ret
+
+0000000000802d06 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d06:	55                   	push   %rbp
+  802d07:	48 89 e5             	mov    %rsp,%rbp
+  802d0a:	41 57                	push   %r15
+  802d0c:	53                   	push   %rbx
+  802d0d:	48 83 ec 10          	sub    $0x10,%rsp
+  802d11:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d11 <nsipc_connect+0xb>
+  802d18:	49 bb 1f 53 00 00 00 	movabs $0x531f,%r11
+  802d1f:	00 00 00 
+  802d22:	4c 01 db             	add    %r11,%rbx
+  802d25:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d28:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802d2c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  802d2f:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802d36:	00 00 00 
+  802d39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d3c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d3f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d46:	48 89 c6             	mov    %rax,%rsi
+  802d49:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  802d50:	00 00 00 
+  802d53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d57:	48 89 c7             	mov    %rax,%rdi
+  802d5a:	49 89 df             	mov    %rbx,%r15
+  802d5d:	48 b8 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rax
+  802d64:	ff ff ff 
+  802d67:	48 01 d8             	add    %rbx,%rax
+  802d6a:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  802d6c:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802d73:	00 00 00 
+  802d76:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802d79:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  802d7d:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d82:	48 b8 c5 a9 ff ff ff 	movabs $0xffffffffffffa9c5,%rax
+  802d89:	ff ff ff 
+  802d8c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d90:	ff d0                	call   *%rax
+}
+  802d92:	48 83 c4 10          	add    $0x10,%rsp
+  802d96:	5b                   	pop    %rbx
+  802d97:	41 5f                	pop    %r15
+  802d99:	5d                   	pop    %rbp
+  802d9a:	c3                   	ret
+
+0000000000802d9b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d9b:	55                   	push   %rbp
+  802d9c:	48 89 e5             	mov    %rsp,%rbp
+  802d9f:	48 83 ec 20          	sub    $0x20,%rsp
+  802da3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802da3 <nsipc_listen+0x8>
+  802daa:	49 bb 8d 52 00 00 00 	movabs $0x528d,%r11
+  802db1:	00 00 00 
+  802db4:	4c 01 d8             	add    %r11,%rax
+  802db7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802dba:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  802dbd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802dc0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  802dc3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802dc6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  802dc9:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  802dcd:	ba 08 00 00 00       	mov    $0x8,%edx
+  802dd2:	48 89 ce             	mov    %rcx,%rsi
+  802dd5:	bf 06 00 00 00       	mov    $0x6,%edi
+  802dda:	48 b9 68 aa ff ff ff 	movabs $0xffffffffffffaa68,%rcx
+  802de1:	ff ff ff 
+  802de4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802de8:	ff d0                	call   *%rax
+}
+  802dea:	c9                   	leave
+  802deb:	c3                   	ret
+
+0000000000802dec <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802dec:	55                   	push   %rbp
+  802ded:	48 89 e5             	mov    %rsp,%rbp
+  802df0:	41 57                	push   %r15
+  802df2:	53                   	push   %rbx
+  802df3:	48 83 ec 30          	sub    $0x30,%rsp
+  802df7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802df7 <nsipc_recv+0xb>
+  802dfe:	49 bb 39 52 00 00 00 	movabs $0x5239,%r11
+  802e05:	00 00 00 
+  802e08:	4c 01 db             	add    %r11,%rbx
+  802e0b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e0e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802e12:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  802e15:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e18:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802e1f:	00 00 00 
+  802e22:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e25:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  802e28:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802e2f:	00 00 00 
+  802e32:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802e35:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  802e39:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802e40:	00 00 00 
+  802e43:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e46:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e4a:	bf 07 00 00 00       	mov    $0x7,%edi
+  802e4f:	48 b8 c5 a9 ff ff ff 	movabs $0xffffffffffffa9c5,%rax
+  802e56:	ff ff ff 
+  802e59:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e5d:	ff d0                	call   *%rax
+  802e5f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e62:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e66:	0f 88 91 00 00 00    	js     802efd <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  802e6c:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  802e73:	7f 08                	jg     802e7d <nsipc_recv+0x91>
+  802e75:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e78:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  802e7b:	7e 50                	jle    802ecd <nsipc_recv+0xe1>
+  802e7d:	48 b8 3b df ff ff ff 	movabs $0xffffffffffffdf3b,%rax
+  802e84:	ff ff ff 
+  802e87:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e8b:	48 89 c1             	mov    %rax,%rcx
+  802e8e:	48 b8 50 df ff ff ff 	movabs $0xffffffffffffdf50,%rax
+  802e95:	ff ff ff 
+  802e98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e9c:	48 89 c2             	mov    %rax,%rdx
+  802e9f:	be 79 00 00 00       	mov    $0x79,%esi
+  802ea4:	48 b8 65 df ff ff ff 	movabs $0xffffffffffffdf65,%rax
+  802eab:	ff ff ff 
+  802eae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802eb2:	48 89 c7             	mov    %rax,%rdi
+  802eb5:	49 89 df             	mov    %rbx,%r15
+  802eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebd:	49 b8 6e bc ff ff ff 	movabs $0xffffffffffffbc6e,%r8
+  802ec4:	ff ff ff 
+  802ec7:	49 01 d8             	add    %rbx,%r8
+  802eca:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ecd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ed0:	48 63 d0             	movslq %eax,%rdx
+  802ed3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ed7:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  802ede:	00 00 00 
+  802ee1:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  802ee5:	48 89 ce             	mov    %rcx,%rsi
+  802ee8:	48 89 c7             	mov    %rax,%rdi
+  802eeb:	49 89 df             	mov    %rbx,%r15
+  802eee:	48 b8 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rax
+  802ef5:	ff ff ff 
+  802ef8:	48 01 d8             	add    %rbx,%rax
+  802efb:	ff d0                	call   *%rax
+	}
+
+	return r;
+  802efd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f00:	48 83 c4 30          	add    $0x30,%rsp
+  802f04:	5b                   	pop    %rbx
+  802f05:	41 5f                	pop    %r15
+  802f07:	5d                   	pop    %rbp
+  802f08:	c3                   	ret
+
+0000000000802f09 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f09:	55                   	push   %rbp
+  802f0a:	48 89 e5             	mov    %rsp,%rbp
+  802f0d:	41 57                	push   %r15
+  802f0f:	53                   	push   %rbx
+  802f10:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  802f17:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f17 <nsipc_send+0xe>
+  802f1e:	49 bb 19 51 00 00 00 	movabs $0x5119,%r11
+  802f25:	00 00 00 
+  802f28:	4c 01 db             	add    %r11,%rbx
+  802f2b:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  802f31:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  802f38:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  802f3e:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  802f44:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  802f48:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  802f4c:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  802f53:	00 00 00 
+  802f56:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802f59:	85 c0                	test   %eax,%eax
+  802f5b:	75 24                	jne    802f81 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802f5d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f62:	49 89 df             	mov    %rbx,%r15
+  802f65:	48 b8 df dc ff ff ff 	movabs $0xffffffffffffdcdf,%rax
+  802f6c:	ff ff ff 
+  802f6f:	48 01 d8             	add    %rbx,%rax
+  802f72:	ff d0                	call   *%rax
+  802f74:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  802f7b:	00 00 00 
+  802f7e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  802f81:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  802f87:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802f8a:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  802f91:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802f94:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  802f97:	39 c2                	cmp    %eax,%edx
+  802f99:	0f 4e c2             	cmovle %edx,%eax
+  802f9c:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  802fa2:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  802fa8:	48 63 d0             	movslq %eax,%rdx
+  802fab:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  802fb2:	48 89 c6             	mov    %rax,%rsi
+  802fb5:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  802fbc:	00 00 00 
+  802fbf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fc3:	48 89 c7             	mov    %rax,%rdi
+  802fc6:	49 89 df             	mov    %rbx,%r15
+  802fc9:	48 b8 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rax
+  802fd0:	ff ff ff 
+  802fd3:	48 01 d8             	add    %rbx,%rax
+  802fd6:	ff d0                	call   *%rax
+	req->req_s = s;
+  802fd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fdc:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  802fe2:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  802fe4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fe8:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  802fee:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  802ff1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ff5:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  802ffb:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  802ffe:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  803005:	00 00 00 
+  803008:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80300c:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  803010:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  803017:	00 
+  803018:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80301e:	48 63 d0             	movslq %eax,%rdx
+  803021:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803025:	48 01 d0             	add    %rdx,%rax
+  803028:	48 83 e8 01          	sub    $0x1,%rax
+  80302c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  803030:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803034:	ba 00 00 00 00       	mov    $0x0,%edx
+  803039:	48 f7 75 d8          	divq   -0x28(%rbp)
+  80303d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803041:	48 29 d0             	sub    %rdx,%rax
+  803044:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  80304a:	85 c0                	test   %eax,%eax
+  80304c:	0f 48 c2             	cmovs  %edx,%eax
+  80304f:	c1 f8 0c             	sar    $0xc,%eax
+  803052:	48 98                	cltq
+  803054:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  803058:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80305c:	48 85 c0             	test   %rax,%rax
+  80305f:	0f 95 c0             	setne  %al
+  803062:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  803065:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  80306c:	00 
+  80306d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803071:	48 83 c0 0b          	add    $0xb,%rax
+  803075:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803079:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80307d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803082:	48 f7 75 c8          	divq   -0x38(%rbp)
+  803086:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80308a:	48 29 d0             	sub    %rdx,%rax
+  80308d:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  803091:	89 c7                	mov    %eax,%edi
+  803093:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80309a:	00 00 00 
+  80309d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8030a0:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8030a4:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8030a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8030ac:	6a 00                	push   $0x0
+  8030ae:	6a 00                	push   $0x0
+  8030b0:	6a 05                	push   $0x5
+  8030b2:	41 89 f1             	mov    %esi,%r9d
+  8030b5:	49 89 c8             	mov    %rcx,%r8
+  8030b8:	89 f9                	mov    %edi,%ecx
+  8030ba:	be 08 00 00 00       	mov    $0x8,%esi
+  8030bf:	89 c7                	mov    %eax,%edi
+  8030c1:	49 89 df             	mov    %rbx,%r15
+  8030c4:	48 b8 e7 d8 ff ff ff 	movabs $0xffffffffffffd8e7,%rax
+  8030cb:	ff ff ff 
+  8030ce:	48 01 d8             	add    %rbx,%rax
+  8030d1:	ff d0                	call   *%rax
+  8030d3:	48 83 c4 20          	add    $0x20,%rsp
+}
+  8030d7:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8030db:	5b                   	pop    %rbx
+  8030dc:	41 5f                	pop    %r15
+  8030de:	5d                   	pop    %rbp
+  8030df:	c3                   	ret
+
+00000000008030e0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8030e0:	55                   	push   %rbp
+  8030e1:	48 89 e5             	mov    %rsp,%rbp
+  8030e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8030e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8030e8 <nsipc_socket+0x8>
+  8030ef:	49 bb 48 4f 00 00 00 	movabs $0x4f48,%r11
+  8030f6:	00 00 00 
+  8030f9:	4c 01 d8             	add    %r11,%rax
+  8030fc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8030ff:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  803102:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  803105:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  80310c:	00 00 00 
+  80310f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803112:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  803115:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  80311c:	00 00 00 
+  80311f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803122:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  803126:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  80312d:	00 00 00 
+  803130:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803133:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  803137:	bf 09 00 00 00       	mov    $0x9,%edi
+  80313c:	48 ba c5 a9 ff ff ff 	movabs $0xffffffffffffa9c5,%rdx
+  803143:	ff ff ff 
+  803146:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80314a:	ff d0                	call   *%rax
+}
+  80314c:	c9                   	leave
+  80314d:	c3                   	ret
+
+000000000080314e <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  80314e:	55                   	push   %rbp
+  80314f:	48 89 e5             	mov    %rsp,%rbp
+  803152:	41 57                	push   %r15
+  803154:	53                   	push   %rbx
+  803155:	48 83 ec 30          	sub    $0x30,%rsp
+  803159:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803159 <pipe+0xb>
+  803160:	49 bb d7 4e 00 00 00 	movabs $0x4ed7,%r11
+  803167:	00 00 00 
+  80316a:	4c 01 db             	add    %r11,%rbx
+  80316d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  803171:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  803175:	48 89 c7             	mov    %rax,%rdi
+  803178:	49 89 df             	mov    %rbx,%r15
+  80317b:	48 b8 df 8d ff ff ff 	movabs $0xffffffffffff8ddf,%rax
+  803182:	ff ff ff 
+  803185:	48 01 d8             	add    %rbx,%rax
+  803188:	ff d0                	call   *%rax
+  80318a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80318d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803191:	0f 88 12 02 00 00    	js     8033a9 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803197:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80319b:	ba 07 04 00 00       	mov    $0x407,%edx
+  8031a0:	48 89 c6             	mov    %rax,%rsi
+  8031a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a8:	49 89 df             	mov    %rbx,%r15
+  8031ab:	48 b8 bc 85 ff ff ff 	movabs $0xffffffffffff85bc,%rax
+  8031b2:	ff ff ff 
+  8031b5:	48 01 d8             	add    %rbx,%rax
+  8031b8:	ff d0                	call   *%rax
+  8031ba:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031bd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031c1:	0f 88 e2 01 00 00    	js     8033a9 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8031c7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031cb:	48 89 c7             	mov    %rax,%rdi
+  8031ce:	49 89 df             	mov    %rbx,%r15
+  8031d1:	48 b8 df 8d ff ff ff 	movabs $0xffffffffffff8ddf,%rax
+  8031d8:	ff ff ff 
+  8031db:	48 01 d8             	add    %rbx,%rax
+  8031de:	ff d0                	call   *%rax
+  8031e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031e7:	0f 88 9b 01 00 00    	js     803388 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031f1:	ba 07 04 00 00       	mov    $0x407,%edx
+  8031f6:	48 89 c6             	mov    %rax,%rsi
+  8031f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031fe:	49 89 df             	mov    %rbx,%r15
+  803201:	48 b8 bc 85 ff ff ff 	movabs $0xffffffffffff85bc,%rax
+  803208:	ff ff ff 
+  80320b:	48 01 d8             	add    %rbx,%rax
+  80320e:	ff d0                	call   *%rax
+  803210:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803213:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803217:	0f 88 6b 01 00 00    	js     803388 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  80321d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803221:	48 89 c7             	mov    %rax,%rdi
+  803224:	49 89 df             	mov    %rbx,%r15
+  803227:	48 b8 9c 8d ff ff ff 	movabs $0xffffffffffff8d9c,%rax
+  80322e:	ff ff ff 
+  803231:	48 01 d8             	add    %rbx,%rax
+  803234:	ff d0                	call   *%rax
+  803236:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80323a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80323e:	ba 07 04 00 00       	mov    $0x407,%edx
+  803243:	48 89 c6             	mov    %rax,%rsi
+  803246:	bf 00 00 00 00       	mov    $0x0,%edi
+  80324b:	49 89 df             	mov    %rbx,%r15
+  80324e:	48 b8 bc 85 ff ff ff 	movabs $0xffffffffffff85bc,%rax
+  803255:	ff ff ff 
+  803258:	48 01 d8             	add    %rbx,%rax
+  80325b:	ff d0                	call   *%rax
+  80325d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803260:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803264:	0f 88 fd 00 00 00    	js     803367 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80326a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80326e:	48 89 c7             	mov    %rax,%rdi
+  803271:	49 89 df             	mov    %rbx,%r15
+  803274:	48 b8 9c 8d ff ff ff 	movabs $0xffffffffffff8d9c,%rax
+  80327b:	ff ff ff 
+  80327e:	48 01 d8             	add    %rbx,%rax
+  803281:	ff d0                	call   *%rax
+  803283:	48 89 c2             	mov    %rax,%rdx
+  803286:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80328a:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803290:	48 89 d1             	mov    %rdx,%rcx
+  803293:	ba 00 00 00 00       	mov    $0x0,%edx
+  803298:	48 89 c6             	mov    %rax,%rsi
+  80329b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032a0:	49 89 df             	mov    %rbx,%r15
+  8032a3:	48 b8 21 86 ff ff ff 	movabs $0xffffffffffff8621,%rax
+  8032aa:	ff ff ff 
+  8032ad:	48 01 d8             	add    %rbx,%rax
+  8032b0:	ff d0                	call   *%rax
+  8032b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032b9:	0f 88 87 00 00 00    	js     803346 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8032bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032c3:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  8032ca:	00 00 00 
+  8032cd:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8032d0:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  8032d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032d6:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032e1:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  8032e8:	00 00 00 
+  8032eb:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8032ee:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8032f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032f4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8032fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032ff:	48 89 c7             	mov    %rax,%rdi
+  803302:	49 89 df             	mov    %rbx,%r15
+  803305:	48 b8 65 8d ff ff ff 	movabs $0xffffffffffff8d65,%rax
+  80330c:	ff ff ff 
+  80330f:	48 01 d8             	add    %rbx,%rax
+  803312:	ff d0                	call   *%rax
+  803314:	89 c2                	mov    %eax,%edx
+  803316:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80331a:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  80331c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803320:	48 89 c7             	mov    %rax,%rdi
+  803323:	49 89 df             	mov    %rbx,%r15
+  803326:	48 b8 65 8d ff ff ff 	movabs $0xffffffffffff8d65,%rax
+  80332d:	ff ff ff 
+  803330:	48 01 d8             	add    %rbx,%rax
+  803333:	ff d0                	call   *%rax
+  803335:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803339:	48 83 c2 04          	add    $0x4,%rdx
+  80333d:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  80333f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803344:	eb 67                	jmp    8033ad <pipe+0x25f>
+		goto err3;
+  803346:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  803347:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80334b:	48 89 c6             	mov    %rax,%rsi
+  80334e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803353:	49 89 df             	mov    %rbx,%r15
+  803356:	48 b8 94 86 ff ff ff 	movabs $0xffffffffffff8694,%rax
+  80335d:	ff ff ff 
+  803360:	48 01 d8             	add    %rbx,%rax
+  803363:	ff d0                	call   *%rax
+  803365:	eb 01                	jmp    803368 <pipe+0x21a>
+		goto err2;
+  803367:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  803368:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80336c:	48 89 c6             	mov    %rax,%rsi
+  80336f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803374:	49 89 df             	mov    %rbx,%r15
+  803377:	48 b8 94 86 ff ff ff 	movabs $0xffffffffffff8694,%rax
+  80337e:	ff ff ff 
+  803381:	48 01 d8             	add    %rbx,%rax
+  803384:	ff d0                	call   *%rax
+  803386:	eb 01                	jmp    803389 <pipe+0x23b>
+		goto err1;
+  803388:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  803389:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80338d:	48 89 c6             	mov    %rax,%rsi
+  803390:	bf 00 00 00 00       	mov    $0x0,%edi
+  803395:	49 89 df             	mov    %rbx,%r15
+  803398:	48 b8 94 86 ff ff ff 	movabs $0xffffffffffff8694,%rax
+  80339f:	ff ff ff 
+  8033a2:	48 01 d8             	add    %rbx,%rax
+  8033a5:	ff d0                	call   *%rax
+  8033a7:	eb 01                	jmp    8033aa <pipe+0x25c>
+		goto err;
+  8033a9:	90                   	nop
+err:
+	return r;
+  8033aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8033ad:	48 83 c4 30          	add    $0x30,%rsp
+  8033b1:	5b                   	pop    %rbx
+  8033b2:	41 5f                	pop    %r15
+  8033b4:	5d                   	pop    %rbp
+  8033b5:	c3                   	ret
+
+00000000008033b6 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8033b6:	55                   	push   %rbp
+  8033b7:	48 89 e5             	mov    %rsp,%rbp
+  8033ba:	41 57                	push   %r15
+  8033bc:	41 54                	push   %r12
+  8033be:	53                   	push   %rbx
+  8033bf:	48 83 ec 28          	sub    $0x28,%rsp
+  8033c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033c3 <_pipeisclosed+0xd>
+  8033ca:	49 bb 6d 4c 00 00 00 	movabs $0x4c6d,%r11
+  8033d1:	00 00 00 
+  8033d4:	4c 01 db             	add    %r11,%rbx
+  8033d7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8033db:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8033df:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8033e6:	ff ff ff 
+  8033e9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033ed:	48 8b 00             	mov    (%rax),%rax
+  8033f0:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8033f6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8033f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033fd:	48 89 c7             	mov    %rax,%rdi
+  803400:	49 89 df             	mov    %rbx,%r15
+  803403:	48 b8 6e dd ff ff ff 	movabs $0xffffffffffffdd6e,%rax
+  80340a:	ff ff ff 
+  80340d:	48 01 d8             	add    %rbx,%rax
+  803410:	ff d0                	call   *%rax
+  803412:	41 89 c4             	mov    %eax,%r12d
+  803415:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803419:	48 89 c7             	mov    %rax,%rdi
+  80341c:	49 89 df             	mov    %rbx,%r15
+  80341f:	48 b8 6e dd ff ff ff 	movabs $0xffffffffffffdd6e,%rax
+  803426:	ff ff ff 
+  803429:	48 01 d8             	add    %rbx,%rax
+  80342c:	ff d0                	call   *%rax
+  80342e:	41 39 c4             	cmp    %eax,%r12d
+  803431:	0f 94 c0             	sete   %al
+  803434:	0f b6 c0             	movzbl %al,%eax
+  803437:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  80343a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803441:	ff ff ff 
+  803444:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803448:	48 8b 00             	mov    (%rax),%rax
+  80344b:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  803451:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  803454:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803457:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80345a:	75 05                	jne    803461 <_pipeisclosed+0xab>
+			return ret;
+  80345c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80345f:	eb 63                	jmp    8034c4 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  803461:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803464:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  803467:	0f 84 72 ff ff ff    	je     8033df <_pipeisclosed+0x29>
+  80346d:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  803471:	0f 85 68 ff ff ff    	jne    8033df <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803477:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80347e:	ff ff ff 
+  803481:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803485:	48 8b 00             	mov    (%rax),%rax
+  803488:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  80348e:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  803491:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803494:	89 c6                	mov    %eax,%esi
+  803496:	48 b8 76 df ff ff ff 	movabs $0xffffffffffffdf76,%rax
+  80349d:	ff ff ff 
+  8034a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034a4:	48 89 c7             	mov    %rax,%rdi
+  8034a7:	49 89 df             	mov    %rbx,%r15
+  8034aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034af:	49 b8 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%r8
+  8034b6:	ff ff ff 
+  8034b9:	49 01 d8             	add    %rbx,%r8
+  8034bc:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8034bf:	e9 1b ff ff ff       	jmp    8033df <_pipeisclosed+0x29>
+	}
+}
+  8034c4:	48 83 c4 28          	add    $0x28,%rsp
+  8034c8:	5b                   	pop    %rbx
+  8034c9:	41 5c                	pop    %r12
+  8034cb:	41 5f                	pop    %r15
+  8034cd:	5d                   	pop    %rbp
+  8034ce:	c3                   	ret
+
+00000000008034cf <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8034cf:	55                   	push   %rbp
+  8034d0:	48 89 e5             	mov    %rsp,%rbp
+  8034d3:	41 57                	push   %r15
+  8034d5:	53                   	push   %rbx
+  8034d6:	48 83 ec 30          	sub    $0x30,%rsp
+  8034da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034da <pipeisclosed+0xb>
+  8034e1:	49 bb 56 4b 00 00 00 	movabs $0x4b56,%r11
+  8034e8:	00 00 00 
+  8034eb:	4c 01 db             	add    %r11,%rbx
+  8034ee:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034f1:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8034f5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8034f8:	48 89 d6             	mov    %rdx,%rsi
+  8034fb:	89 c7                	mov    %eax,%edi
+  8034fd:	49 89 df             	mov    %rbx,%r15
+  803500:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  803507:	ff ff ff 
+  80350a:	48 01 d8             	add    %rbx,%rax
+  80350d:	ff d0                	call   *%rax
+  80350f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803512:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803516:	79 05                	jns    80351d <pipeisclosed+0x4e>
+		return r;
+  803518:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80351b:	eb 3b                	jmp    803558 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  80351d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803521:	48 89 c7             	mov    %rax,%rdi
+  803524:	49 89 df             	mov    %rbx,%r15
+  803527:	48 b8 9c 8d ff ff ff 	movabs $0xffffffffffff8d9c,%rax
+  80352e:	ff ff ff 
+  803531:	48 01 d8             	add    %rbx,%rax
+  803534:	ff d0                	call   *%rax
+  803536:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80353a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80353e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803542:	48 89 d6             	mov    %rdx,%rsi
+  803545:	48 89 c7             	mov    %rax,%rdi
+  803548:	48 b8 86 b3 ff ff ff 	movabs $0xffffffffffffb386,%rax
+  80354f:	ff ff ff 
+  803552:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803556:	ff d0                	call   *%rax
+}
+  803558:	48 83 c4 30          	add    $0x30,%rsp
+  80355c:	5b                   	pop    %rbx
+  80355d:	41 5f                	pop    %r15
+  80355f:	5d                   	pop    %rbp
+  803560:	c3                   	ret
+
+0000000000803561 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  803561:	55                   	push   %rbp
+  803562:	48 89 e5             	mov    %rsp,%rbp
+  803565:	41 57                	push   %r15
+  803567:	53                   	push   %rbx
+  803568:	48 83 ec 40          	sub    $0x40,%rsp
+  80356c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80356c <devpipe_read+0xb>
+  803573:	49 bb c4 4a 00 00 00 	movabs $0x4ac4,%r11
+  80357a:	00 00 00 
+  80357d:	4c 01 db             	add    %r11,%rbx
+  803580:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803584:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803588:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  80358c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803590:	48 89 c7             	mov    %rax,%rdi
+  803593:	49 89 df             	mov    %rbx,%r15
+  803596:	48 b8 9c 8d ff ff ff 	movabs $0xffffffffffff8d9c,%rax
+  80359d:	ff ff ff 
+  8035a0:	48 01 d8             	add    %rbx,%rax
+  8035a3:	ff d0                	call   *%rax
+  8035a5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8035a9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8035ad:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8035b1:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8035b8:	00 
+  8035b9:	e9 a1 00 00 00       	jmp    80365f <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8035be:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8035c3:	74 09                	je     8035ce <devpipe_read+0x6d>
+				return i;
+  8035c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035c9:	e9 9f 00 00 00       	jmp    80366d <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8035ce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035d6:	48 89 d6             	mov    %rdx,%rsi
+  8035d9:	48 89 c7             	mov    %rax,%rdi
+  8035dc:	48 b8 86 b3 ff ff ff 	movabs $0xffffffffffffb386,%rax
+  8035e3:	ff ff ff 
+  8035e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035ea:	ff d0                	call   *%rax
+  8035ec:	85 c0                	test   %eax,%eax
+  8035ee:	74 07                	je     8035f7 <devpipe_read+0x96>
+				return 0;
+  8035f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f5:	eb 76                	jmp    80366d <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8035f7:	49 89 df             	mov    %rbx,%r15
+  8035fa:	48 b8 67 85 ff ff ff 	movabs $0xffffffffffff8567,%rax
+  803601:	ff ff ff 
+  803604:	48 01 d8             	add    %rbx,%rax
+  803607:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  803609:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80360d:	8b 10                	mov    (%rax),%edx
+  80360f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803613:	8b 40 04             	mov    0x4(%rax),%eax
+  803616:	39 c2                	cmp    %eax,%edx
+  803618:	74 a4                	je     8035be <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80361a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80361e:	8b 10                	mov    (%rax),%edx
+  803620:	89 d0                	mov    %edx,%eax
+  803622:	c1 f8 1f             	sar    $0x1f,%eax
+  803625:	c1 e8 1b             	shr    $0x1b,%eax
+  803628:	01 c2                	add    %eax,%edx
+  80362a:	83 e2 1f             	and    $0x1f,%edx
+  80362d:	29 c2                	sub    %eax,%edx
+  80362f:	89 d6                	mov    %edx,%esi
+  803631:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803635:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803639:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80363d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803641:	48 63 c6             	movslq %esi,%rax
+  803644:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  803649:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  80364b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80364f:	8b 00                	mov    (%rax),%eax
+  803651:	8d 50 01             	lea    0x1(%rax),%edx
+  803654:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803658:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80365a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80365f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803663:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  803667:	72 a0                	jb     803609 <devpipe_read+0xa8>
+	}
+	return i;
+  803669:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80366d:	48 83 c4 40          	add    $0x40,%rsp
+  803671:	5b                   	pop    %rbx
+  803672:	41 5f                	pop    %r15
+  803674:	5d                   	pop    %rbp
+  803675:	c3                   	ret
+
+0000000000803676 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  803676:	55                   	push   %rbp
+  803677:	48 89 e5             	mov    %rsp,%rbp
+  80367a:	41 57                	push   %r15
+  80367c:	53                   	push   %rbx
+  80367d:	48 83 ec 40          	sub    $0x40,%rsp
+  803681:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803681 <devpipe_write+0xb>
+  803688:	49 bb af 49 00 00 00 	movabs $0x49af,%r11
+  80368f:	00 00 00 
+  803692:	4c 01 db             	add    %r11,%rbx
+  803695:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803699:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80369d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8036a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036a5:	48 89 c7             	mov    %rax,%rdi
+  8036a8:	49 89 df             	mov    %rbx,%r15
+  8036ab:	48 b8 9c 8d ff ff ff 	movabs $0xffffffffffff8d9c,%rax
+  8036b2:	ff ff ff 
+  8036b5:	48 01 d8             	add    %rbx,%rax
+  8036b8:	ff d0                	call   *%rax
+  8036ba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8036be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8036c2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8036c6:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8036cd:	00 
+  8036ce:	e9 a0 00 00 00       	jmp    803773 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8036d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036db:	48 89 d6             	mov    %rdx,%rsi
+  8036de:	48 89 c7             	mov    %rax,%rdi
+  8036e1:	48 b8 86 b3 ff ff ff 	movabs $0xffffffffffffb386,%rax
+  8036e8:	ff ff ff 
+  8036eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036ef:	ff d0                	call   *%rax
+  8036f1:	85 c0                	test   %eax,%eax
+  8036f3:	74 0a                	je     8036ff <devpipe_write+0x89>
+				return 0;
+  8036f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036fa:	e9 82 00 00 00       	jmp    803781 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8036ff:	49 89 df             	mov    %rbx,%r15
+  803702:	48 b8 67 85 ff ff ff 	movabs $0xffffffffffff8567,%rax
+  803709:	ff ff ff 
+  80370c:	48 01 d8             	add    %rbx,%rax
+  80370f:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803711:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803715:	8b 40 04             	mov    0x4(%rax),%eax
+  803718:	48 63 d0             	movslq %eax,%rdx
+  80371b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80371f:	8b 00                	mov    (%rax),%eax
+  803721:	48 98                	cltq
+  803723:	48 83 c0 20          	add    $0x20,%rax
+  803727:	48 39 c2             	cmp    %rax,%rdx
+  80372a:	73 a7                	jae    8036d3 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80372c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803730:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803734:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  803738:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80373c:	8b 50 04             	mov    0x4(%rax),%edx
+  80373f:	89 d0                	mov    %edx,%eax
+  803741:	c1 f8 1f             	sar    $0x1f,%eax
+  803744:	c1 e8 1b             	shr    $0x1b,%eax
+  803747:	01 c2                	add    %eax,%edx
+  803749:	83 e2 1f             	and    $0x1f,%edx
+  80374c:	29 c2                	sub    %eax,%edx
+  80374e:	89 d0                	mov    %edx,%eax
+  803750:	0f b6 09             	movzbl (%rcx),%ecx
+  803753:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803757:	48 98                	cltq
+  803759:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  80375d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803761:	8b 40 04             	mov    0x4(%rax),%eax
+  803764:	8d 50 01             	lea    0x1(%rax),%edx
+  803767:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80376b:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  80376e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  803773:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803777:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80377b:	72 94                	jb     803711 <devpipe_write+0x9b>
+	}
+
+	return i;
+  80377d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  803781:	48 83 c4 40          	add    $0x40,%rsp
+  803785:	5b                   	pop    %rbx
+  803786:	41 5f                	pop    %r15
+  803788:	5d                   	pop    %rbp
+  803789:	c3                   	ret
+
+000000000080378a <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80378a:	55                   	push   %rbp
+  80378b:	48 89 e5             	mov    %rsp,%rbp
+  80378e:	41 57                	push   %r15
+  803790:	53                   	push   %rbx
+  803791:	48 83 ec 20          	sub    $0x20,%rsp
+  803795:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803795 <devpipe_stat+0xb>
+  80379c:	49 bb 9b 48 00 00 00 	movabs $0x489b,%r11
+  8037a3:	00 00 00 
+  8037a6:	4c 01 db             	add    %r11,%rbx
+  8037a9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8037ad:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8037b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037b5:	48 89 c7             	mov    %rax,%rdi
+  8037b8:	49 89 df             	mov    %rbx,%r15
+  8037bb:	48 b8 9c 8d ff ff ff 	movabs $0xffffffffffff8d9c,%rax
+  8037c2:	ff ff ff 
+  8037c5:	48 01 d8             	add    %rbx,%rax
+  8037c8:	ff d0                	call   *%rax
+  8037ca:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8037ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037d2:	48 ba 89 df ff ff ff 	movabs $0xffffffffffffdf89,%rdx
+  8037d9:	ff ff ff 
+  8037dc:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8037e0:	48 89 d6             	mov    %rdx,%rsi
+  8037e3:	48 89 c7             	mov    %rax,%rdi
+  8037e6:	49 89 df             	mov    %rbx,%r15
+  8037e9:	48 b8 07 cd ff ff ff 	movabs $0xffffffffffffcd07,%rax
+  8037f0:	ff ff ff 
+  8037f3:	48 01 d8             	add    %rbx,%rax
+  8037f6:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8037f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037fc:	8b 50 04             	mov    0x4(%rax),%edx
+  8037ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803803:	8b 00                	mov    (%rax),%eax
+  803805:	29 c2                	sub    %eax,%edx
+  803807:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80380b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  803811:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803815:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80381c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80381f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803823:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  80382a:	00 00 00 
+  80382d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803831:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  803838:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80383d:	48 83 c4 20          	add    $0x20,%rsp
+  803841:	5b                   	pop    %rbx
+  803842:	41 5f                	pop    %r15
+  803844:	5d                   	pop    %rbp
+  803845:	c3                   	ret
+
+0000000000803846 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803846:	55                   	push   %rbp
+  803847:	48 89 e5             	mov    %rsp,%rbp
+  80384a:	41 57                	push   %r15
+  80384c:	53                   	push   %rbx
+  80384d:	48 83 ec 10          	sub    $0x10,%rsp
+  803851:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803851 <devpipe_close+0xb>
+  803858:	49 bb df 47 00 00 00 	movabs $0x47df,%r11
+  80385f:	00 00 00 
+  803862:	4c 01 db             	add    %r11,%rbx
+  803865:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  803869:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80386d:	48 89 c6             	mov    %rax,%rsi
+  803870:	bf 00 00 00 00       	mov    $0x0,%edi
+  803875:	49 89 df             	mov    %rbx,%r15
+  803878:	48 b8 94 86 ff ff ff 	movabs $0xffffffffffff8694,%rax
+  80387f:	ff ff ff 
+  803882:	48 01 d8             	add    %rbx,%rax
+  803885:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  803887:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80388b:	48 89 c7             	mov    %rax,%rdi
+  80388e:	49 89 df             	mov    %rbx,%r15
+  803891:	48 b8 9c 8d ff ff ff 	movabs $0xffffffffffff8d9c,%rax
+  803898:	ff ff ff 
+  80389b:	48 01 d8             	add    %rbx,%rax
+  80389e:	ff d0                	call   *%rax
+  8038a0:	48 89 c6             	mov    %rax,%rsi
+  8038a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038a8:	49 89 df             	mov    %rbx,%r15
+  8038ab:	48 b8 94 86 ff ff ff 	movabs $0xffffffffffff8694,%rax
+  8038b2:	ff ff ff 
+  8038b5:	48 01 d8             	add    %rbx,%rax
+  8038b8:	ff d0                	call   *%rax
+}
+  8038ba:	48 83 c4 10          	add    $0x10,%rsp
+  8038be:	5b                   	pop    %rbx
+  8038bf:	41 5f                	pop    %r15
+  8038c1:	5d                   	pop    %rbp
+  8038c2:	c3                   	ret
+
+00000000008038c3 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8038c3:	55                   	push   %rbp
+  8038c4:	48 89 e5             	mov    %rsp,%rbp
+  8038c7:	41 57                	push   %r15
+  8038c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8038cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038cd <cputchar+0xa>
+  8038d4:	49 bb 63 47 00 00 00 	movabs $0x4763,%r11
+  8038db:	00 00 00 
+  8038de:	4c 01 d8             	add    %r11,%rax
+  8038e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8038e4:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8038e7:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8038ea:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8038ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8038f3:	48 89 d7             	mov    %rdx,%rdi
+  8038f6:	49 89 c7             	mov    %rax,%r15
+  8038f9:	48 ba 04 84 ff ff ff 	movabs $0xffffffffffff8404,%rdx
+  803900:	ff ff ff 
+  803903:	48 01 c2             	add    %rax,%rdx
+  803906:	ff d2                	call   *%rdx
+}
+  803908:	90                   	nop
+  803909:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80390d:	c9                   	leave
+  80390e:	c3                   	ret
+
+000000000080390f <getchar>:
+
+int
+getchar(void)
+{
+  80390f:	55                   	push   %rbp
+  803910:	48 89 e5             	mov    %rsp,%rbp
+  803913:	41 57                	push   %r15
+  803915:	48 83 ec 18          	sub    $0x18,%rsp
+  803919:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803919 <getchar+0xa>
+  803920:	49 bb 17 47 00 00 00 	movabs $0x4717,%r11
+  803927:	00 00 00 
+  80392a:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  80392d:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  803931:	ba 01 00 00 00       	mov    $0x1,%edx
+  803936:	48 89 ce             	mov    %rcx,%rsi
+  803939:	bf 00 00 00 00       	mov    $0x0,%edi
+  80393e:	49 89 c7             	mov    %rax,%r15
+  803941:	48 b9 dc 93 ff ff ff 	movabs $0xffffffffffff93dc,%rcx
+  803948:	ff ff ff 
+  80394b:	48 01 c1             	add    %rax,%rcx
+  80394e:	ff d1                	call   *%rcx
+  803950:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  803953:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803957:	79 05                	jns    80395e <getchar+0x4f>
+		return r;
+  803959:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80395c:	eb 14                	jmp    803972 <getchar+0x63>
+	if (r < 1)
+  80395e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803962:	7f 07                	jg     80396b <getchar+0x5c>
+		return -E_EOF;
+  803964:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  803969:	eb 07                	jmp    803972 <getchar+0x63>
+	return c;
+  80396b:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  80396f:	0f b6 c0             	movzbl %al,%eax
+}
+  803972:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803976:	c9                   	leave
+  803977:	c3                   	ret
+
+0000000000803978 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  803978:	55                   	push   %rbp
+  803979:	48 89 e5             	mov    %rsp,%rbp
+  80397c:	41 57                	push   %r15
+  80397e:	53                   	push   %rbx
+  80397f:	48 83 ec 20          	sub    $0x20,%rsp
+  803983:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803983 <iscons+0xb>
+  80398a:	49 bb ad 46 00 00 00 	movabs $0x46ad,%r11
+  803991:	00 00 00 
+  803994:	4c 01 db             	add    %r11,%rbx
+  803997:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80399a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80399e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039a1:	48 89 d6             	mov    %rdx,%rsi
+  8039a4:	89 c7                	mov    %eax,%edi
+  8039a6:	49 89 df             	mov    %rbx,%r15
+  8039a9:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  8039b0:	ff ff ff 
+  8039b3:	48 01 d8             	add    %rbx,%rax
+  8039b6:	ff d0                	call   *%rax
+  8039b8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039bf:	79 05                	jns    8039c6 <iscons+0x4e>
+		return r;
+  8039c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039c4:	eb 1b                	jmp    8039e1 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8039c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ca:	8b 10                	mov    (%rax),%edx
+  8039cc:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  8039d3:	00 00 00 
+  8039d6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8039d9:	39 c2                	cmp    %eax,%edx
+  8039db:	0f 94 c0             	sete   %al
+  8039de:	0f b6 c0             	movzbl %al,%eax
+}
+  8039e1:	48 83 c4 20          	add    $0x20,%rsp
+  8039e5:	5b                   	pop    %rbx
+  8039e6:	41 5f                	pop    %r15
+  8039e8:	5d                   	pop    %rbp
+  8039e9:	c3                   	ret
+
+00000000008039ea <opencons>:
+
+int
+opencons(void)
+{
+  8039ea:	55                   	push   %rbp
+  8039eb:	48 89 e5             	mov    %rsp,%rbp
+  8039ee:	41 57                	push   %r15
+  8039f0:	53                   	push   %rbx
+  8039f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8039f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039f5 <opencons+0xb>
+  8039fc:	49 bb 3b 46 00 00 00 	movabs $0x463b,%r11
+  803a03:	00 00 00 
+  803a06:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  803a09:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803a0d:	48 89 c7             	mov    %rax,%rdi
+  803a10:	49 89 df             	mov    %rbx,%r15
+  803a13:	48 b8 df 8d ff ff ff 	movabs $0xffffffffffff8ddf,%rax
+  803a1a:	ff ff ff 
+  803a1d:	48 01 d8             	add    %rbx,%rax
+  803a20:	ff d0                	call   *%rax
+  803a22:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a25:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a29:	79 05                	jns    803a30 <opencons+0x46>
+		return r;
+  803a2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a2e:	eb 68                	jmp    803a98 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803a30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a34:	ba 07 04 00 00       	mov    $0x407,%edx
+  803a39:	48 89 c6             	mov    %rax,%rsi
+  803a3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a41:	49 89 df             	mov    %rbx,%r15
+  803a44:	48 b8 bc 85 ff ff ff 	movabs $0xffffffffffff85bc,%rax
+  803a4b:	ff ff ff 
+  803a4e:	48 01 d8             	add    %rbx,%rax
+  803a51:	ff d0                	call   *%rax
+  803a53:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a56:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a5a:	79 05                	jns    803a61 <opencons+0x77>
+		return r;
+  803a5c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a5f:	eb 37                	jmp    803a98 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  803a61:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a65:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  803a6c:	00 00 00 
+  803a6f:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803a72:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  803a74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a78:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  803a7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a83:	48 89 c7             	mov    %rax,%rdi
+  803a86:	49 89 df             	mov    %rbx,%r15
+  803a89:	48 b8 65 8d ff ff ff 	movabs $0xffffffffffff8d65,%rax
+  803a90:	ff ff ff 
+  803a93:	48 01 d8             	add    %rbx,%rax
+  803a96:	ff d0                	call   *%rax
+}
+  803a98:	48 83 c4 10          	add    $0x10,%rsp
+  803a9c:	5b                   	pop    %rbx
+  803a9d:	41 5f                	pop    %r15
+  803a9f:	5d                   	pop    %rbp
+  803aa0:	c3                   	ret
+
+0000000000803aa1 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  803aa1:	55                   	push   %rbp
+  803aa2:	48 89 e5             	mov    %rsp,%rbp
+  803aa5:	41 57                	push   %r15
+  803aa7:	53                   	push   %rbx
+  803aa8:	48 83 ec 30          	sub    $0x30,%rsp
+  803aac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803aac <devcons_read+0xb>
+  803ab3:	49 bb 84 45 00 00 00 	movabs $0x4584,%r11
+  803aba:	00 00 00 
+  803abd:	4c 01 db             	add    %r11,%rbx
+  803ac0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ac4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803ac8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  803acc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803ad1:	75 19                	jne    803aec <devcons_read+0x4b>
+		return 0;
+  803ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad8:	eb 55                	jmp    803b2f <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  803ada:	49 89 df             	mov    %rbx,%r15
+  803add:	48 b8 67 85 ff ff ff 	movabs $0xffffffffffff8567,%rax
+  803ae4:	ff ff ff 
+  803ae7:	48 01 d8             	add    %rbx,%rax
+  803aea:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  803aec:	49 89 df             	mov    %rbx,%r15
+  803aef:	48 b8 63 84 ff ff ff 	movabs $0xffffffffffff8463,%rax
+  803af6:	ff ff ff 
+  803af9:	48 01 d8             	add    %rbx,%rax
+  803afc:	ff d0                	call   *%rax
+  803afe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b01:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b05:	74 d3                	je     803ada <devcons_read+0x39>
+	if (c < 0)
+  803b07:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b0b:	79 05                	jns    803b12 <devcons_read+0x71>
+		return c;
+  803b0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b10:	eb 1d                	jmp    803b2f <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  803b12:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  803b16:	75 07                	jne    803b1f <devcons_read+0x7e>
+		return 0;
+  803b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b1d:	eb 10                	jmp    803b2f <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  803b1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b22:	89 c2                	mov    %eax,%edx
+  803b24:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b28:	88 10                	mov    %dl,(%rax)
+	return 1;
+  803b2a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803b2f:	48 83 c4 30          	add    $0x30,%rsp
+  803b33:	5b                   	pop    %rbx
+  803b34:	41 5f                	pop    %r15
+  803b36:	5d                   	pop    %rbp
+  803b37:	c3                   	ret
+
+0000000000803b38 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  803b38:	55                   	push   %rbp
+  803b39:	48 89 e5             	mov    %rsp,%rbp
+  803b3c:	41 57                	push   %r15
+  803b3e:	53                   	push   %rbx
+  803b3f:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  803b46:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b46 <devcons_write+0xe>
+  803b4d:	49 bb ea 44 00 00 00 	movabs $0x44ea,%r11
+  803b54:	00 00 00 
+  803b57:	4c 01 db             	add    %r11,%rbx
+  803b5a:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  803b61:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  803b68:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  803b6f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803b76:	e9 80 00 00 00       	jmp    803bfb <devcons_write+0xc3>
+		m = n - tot;
+  803b7b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803b82:	89 c2                	mov    %eax,%edx
+  803b84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b87:	29 c2                	sub    %eax,%edx
+  803b89:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  803b8c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803b8f:	83 f8 7f             	cmp    $0x7f,%eax
+  803b92:	76 07                	jbe    803b9b <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  803b94:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  803b9b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803b9e:	48 63 d0             	movslq %eax,%rdx
+  803ba1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ba4:	48 63 c8             	movslq %eax,%rcx
+  803ba7:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  803bae:	48 01 c1             	add    %rax,%rcx
+  803bb1:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  803bb8:	48 89 ce             	mov    %rcx,%rsi
+  803bbb:	48 89 c7             	mov    %rax,%rdi
+  803bbe:	49 89 df             	mov    %rbx,%r15
+  803bc1:	48 b8 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rax
+  803bc8:	ff ff ff 
+  803bcb:	48 01 d8             	add    %rbx,%rax
+  803bce:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  803bd0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803bd3:	48 63 d0             	movslq %eax,%rdx
+  803bd6:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  803bdd:	48 89 d6             	mov    %rdx,%rsi
+  803be0:	48 89 c7             	mov    %rax,%rdi
+  803be3:	49 89 df             	mov    %rbx,%r15
+  803be6:	48 b8 04 84 ff ff ff 	movabs $0xffffffffffff8404,%rax
+  803bed:	ff ff ff 
+  803bf0:	48 01 d8             	add    %rbx,%rax
+  803bf3:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  803bf5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803bf8:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803bfb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bfe:	48 98                	cltq
+  803c00:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  803c07:	0f 82 6e ff ff ff    	jb     803b7b <devcons_write+0x43>
+	}
+	return tot;
+  803c0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803c10:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  803c17:	5b                   	pop    %rbx
+  803c18:	41 5f                	pop    %r15
+  803c1a:	5d                   	pop    %rbp
+  803c1b:	c3                   	ret
+
+0000000000803c1c <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  803c1c:	55                   	push   %rbp
+  803c1d:	48 89 e5             	mov    %rsp,%rbp
+  803c20:	48 83 ec 08          	sub    $0x8,%rsp
+  803c24:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c24 <devcons_close+0x8>
+  803c2b:	49 bb 0c 44 00 00 00 	movabs $0x440c,%r11
+  803c32:	00 00 00 
+  803c35:	4c 01 d8             	add    %r11,%rax
+  803c38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  803c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c41:	c9                   	leave
+  803c42:	c3                   	ret
+
+0000000000803c43 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803c43:	55                   	push   %rbp
+  803c44:	48 89 e5             	mov    %rsp,%rbp
+  803c47:	41 57                	push   %r15
+  803c49:	48 83 ec 18          	sub    $0x18,%rsp
+  803c4d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c4d <devcons_stat+0xa>
+  803c54:	49 bb e3 43 00 00 00 	movabs $0x43e3,%r11
+  803c5b:	00 00 00 
+  803c5e:	4c 01 d8             	add    %r11,%rax
+  803c61:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c65:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  803c69:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c6d:	48 b9 95 df ff ff ff 	movabs $0xffffffffffffdf95,%rcx
+  803c74:	ff ff ff 
+  803c77:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  803c7b:	48 89 ce             	mov    %rcx,%rsi
+  803c7e:	48 89 d7             	mov    %rdx,%rdi
+  803c81:	49 89 c7             	mov    %rax,%r15
+  803c84:	48 ba 07 cd ff ff ff 	movabs $0xffffffffffffcd07,%rdx
+  803c8b:	ff ff ff 
+  803c8e:	48 01 c2             	add    %rax,%rdx
+  803c91:	ff d2                	call   *%rdx
+	return 0;
+  803c93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c98:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803c9c:	c9                   	leave
+  803c9d:	c3                   	ret
+
+0000000000803c9e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803c9e:	55                   	push   %rbp
+  803c9f:	48 89 e5             	mov    %rsp,%rbp
+  803ca2:	41 57                	push   %r15
+  803ca4:	41 54                	push   %r12
+  803ca6:	53                   	push   %rbx
+  803ca7:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  803cae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cae <_panic+0x10>
+  803cb5:	49 bb 82 43 00 00 00 	movabs $0x4382,%r11
+  803cbc:	00 00 00 
+  803cbf:	4c 01 db             	add    %r11,%rbx
+  803cc2:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  803cc9:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  803ccf:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  803cd6:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  803cdd:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  803ce4:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  803ceb:	84 c0                	test   %al,%al
+  803ced:	74 26                	je     803d15 <_panic+0x77>
+  803cef:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  803cf6:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  803cfd:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  803d01:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  803d05:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  803d09:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  803d0d:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  803d11:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  803d15:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  803d1c:	00 00 00 
+  803d1f:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  803d26:	00 00 00 
+  803d29:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d2d:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  803d34:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  803d3b:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803d42:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803d49:	ff ff ff 
+  803d4c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803d50:	4c 8b 20             	mov    (%rax),%r12
+  803d53:	49 89 df             	mov    %rbx,%r15
+  803d56:	48 b8 13 85 ff ff ff 	movabs $0xffffffffffff8513,%rax
+  803d5d:	ff ff ff 
+  803d60:	48 01 d8             	add    %rbx,%rax
+  803d63:	ff d0                	call   *%rax
+  803d65:	89 c6                	mov    %eax,%esi
+  803d67:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  803d6d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803d74:	41 89 d0             	mov    %edx,%r8d
+  803d77:	48 89 c1             	mov    %rax,%rcx
+  803d7a:	4c 89 e2             	mov    %r12,%rdx
+  803d7d:	48 b8 a0 df ff ff ff 	movabs $0xffffffffffffdfa0,%rax
+  803d84:	ff ff ff 
+  803d87:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d8b:	48 89 c7             	mov    %rax,%rdi
+  803d8e:	49 89 df             	mov    %rbx,%r15
+  803d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d96:	49 b9 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%r9
+  803d9d:	ff ff ff 
+  803da0:	49 01 d9             	add    %rbx,%r9
+  803da3:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803da6:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  803dad:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  803db4:	48 89 d6             	mov    %rdx,%rsi
+  803db7:	48 89 c7             	mov    %rax,%rdi
+  803dba:	49 89 df             	mov    %rbx,%r15
+  803dbd:	48 b8 65 be ff ff ff 	movabs $0xffffffffffffbe65,%rax
+  803dc4:	ff ff ff 
+  803dc7:	48 01 d8             	add    %rbx,%rax
+  803dca:	ff d0                	call   *%rax
+	cprintf("\n");
+  803dcc:	48 b8 c3 df ff ff ff 	movabs $0xffffffffffffdfc3,%rax
+  803dd3:	ff ff ff 
+  803dd6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dda:	48 89 c7             	mov    %rax,%rdi
+  803ddd:	49 89 df             	mov    %rbx,%r15
+  803de0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de5:	48 ba 45 bf ff ff ff 	movabs $0xffffffffffffbf45,%rdx
+  803dec:	ff ff ff 
+  803def:	48 01 da             	add    %rbx,%rdx
+  803df2:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803df4:	cc                   	int3
+  803df5:	eb fd                	jmp    803df4 <_panic+0x156>
+
+0000000000803df7 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  803df7:	55                   	push   %rbp
+  803df8:	48 89 e5             	mov    %rsp,%rbp
+  803dfb:	41 57                	push   %r15
+  803dfd:	48 83 ec 18          	sub    $0x18,%rsp
+  803e01:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e01 <putch+0xa>
+  803e08:	49 bb 2f 42 00 00 00 	movabs $0x422f,%r11
+  803e0f:	00 00 00 
+  803e12:	4c 01 d8             	add    %r11,%rax
+  803e15:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e18:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  803e1c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e20:	8b 12                	mov    (%rdx),%edx
+  803e22:	8d 72 01             	lea    0x1(%rdx),%esi
+  803e25:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803e29:	89 31                	mov    %esi,(%rcx)
+  803e2b:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  803e2e:	89 ce                	mov    %ecx,%esi
+  803e30:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803e34:	48 63 d2             	movslq %edx,%rdx
+  803e37:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  803e3c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e40:	8b 12                	mov    (%rdx),%edx
+  803e42:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803e48:	75 33                	jne    803e7d <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  803e4a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e4e:	8b 12                	mov    (%rdx),%edx
+  803e50:	48 63 d2             	movslq %edx,%rdx
+  803e53:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803e57:	48 83 c1 08          	add    $0x8,%rcx
+  803e5b:	48 89 d6             	mov    %rdx,%rsi
+  803e5e:	48 89 cf             	mov    %rcx,%rdi
+  803e61:	49 89 c7             	mov    %rax,%r15
+  803e64:	48 ba 04 84 ff ff ff 	movabs $0xffffffffffff8404,%rdx
+  803e6b:	ff ff ff 
+  803e6e:	48 01 c2             	add    %rax,%rdx
+  803e71:	ff d2                	call   *%rdx
+        b->idx = 0;
+  803e73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e77:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  803e7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e81:	8b 40 04             	mov    0x4(%rax),%eax
+  803e84:	8d 50 01             	lea    0x1(%rax),%edx
+  803e87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e8b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  803e8e:	90                   	nop
+  803e8f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803e93:	c9                   	leave
+  803e94:	c3                   	ret
+
+0000000000803e95 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  803e95:	55                   	push   %rbp
+  803e96:	48 89 e5             	mov    %rsp,%rbp
+  803e99:	41 57                	push   %r15
+  803e9b:	53                   	push   %rbx
+  803e9c:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  803ea3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ea3 <vcprintf+0xe>
+  803eaa:	49 bb 8d 41 00 00 00 	movabs $0x418d,%r11
+  803eb1:	00 00 00 
+  803eb4:	4c 01 db             	add    %r11,%rbx
+  803eb7:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  803ebe:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  803ec5:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  803ecc:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  803ed3:	48 8b 06             	mov    (%rsi),%rax
+  803ed6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  803eda:	48 89 01             	mov    %rax,(%rcx)
+  803edd:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  803ee1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  803ee5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  803ee9:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  803ef0:	00 00 00 
+    b.cnt = 0;
+  803ef3:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  803efa:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  803efd:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  803f04:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  803f0b:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  803f12:	48 89 c6             	mov    %rax,%rsi
+  803f15:	48 b8 c7 bd ff ff ff 	movabs $0xffffffffffffbdc7,%rax
+  803f1c:	ff ff ff 
+  803f1f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f23:	48 89 c7             	mov    %rax,%rdi
+  803f26:	49 89 df             	mov    %rbx,%r15
+  803f29:	48 b8 89 c3 ff ff ff 	movabs $0xffffffffffffc389,%rax
+  803f30:	ff ff ff 
+  803f33:	48 01 d8             	add    %rbx,%rax
+  803f36:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  803f38:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  803f3e:	48 98                	cltq
+  803f40:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  803f47:	48 83 c2 08          	add    $0x8,%rdx
+  803f4b:	48 89 c6             	mov    %rax,%rsi
+  803f4e:	48 89 d7             	mov    %rdx,%rdi
+  803f51:	49 89 df             	mov    %rbx,%r15
+  803f54:	48 b8 04 84 ff ff ff 	movabs $0xffffffffffff8404,%rax
+  803f5b:	ff ff ff 
+  803f5e:	48 01 d8             	add    %rbx,%rax
+  803f61:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  803f63:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  803f69:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  803f70:	5b                   	pop    %rbx
+  803f71:	41 5f                	pop    %r15
+  803f73:	5d                   	pop    %rbp
+  803f74:	c3                   	ret
+
+0000000000803f75 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  803f75:	55                   	push   %rbp
+  803f76:	48 89 e5             	mov    %rsp,%rbp
+  803f79:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  803f80:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 803f80 <cprintf+0xb>
+  803f87:	49 bb b0 40 00 00 00 	movabs $0x40b0,%r11
+  803f8e:	00 00 00 
+  803f91:	4d 01 da             	add    %r11,%r10
+  803f94:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  803f9b:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803fa2:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  803fa9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803fb0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803fb7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803fbe:	84 c0                	test   %al,%al
+  803fc0:	74 20                	je     803fe2 <cprintf+0x6d>
+  803fc2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803fc6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803fca:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803fce:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803fd2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803fd6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803fda:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803fde:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  803fe2:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  803fe9:	00 00 00 
+  803fec:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803ff3:	00 00 00 
+  803ff6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ffa:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804001:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804008:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  80400f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  804016:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80401d:	48 8b 06             	mov    (%rsi),%rax
+  804020:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804024:	48 89 01             	mov    %rax,(%rcx)
+  804027:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80402b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80402f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  804033:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80403a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804041:	48 89 d6             	mov    %rdx,%rsi
+  804044:	48 89 c7             	mov    %rax,%rdi
+  804047:	48 b8 65 be ff ff ff 	movabs $0xffffffffffffbe65,%rax
+  80404e:	ff ff ff 
+  804051:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804055:	ff d0                	call   *%rax
+  804057:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80405d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804063:	c9                   	leave
+  804064:	c3                   	ret
+
+0000000000804065 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  804065:	55                   	push   %rbp
+  804066:	48 89 e5             	mov    %rsp,%rbp
+  804069:	53                   	push   %rbx
+  80406a:	48 83 ec 38          	sub    $0x38,%rsp
+  80406e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80406e <printnum+0x9>
+  804075:	49 bb c2 3f 00 00 00 	movabs $0x3fc2,%r11
+  80407c:	00 00 00 
+  80407f:	4c 01 db             	add    %r11,%rbx
+  804082:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804086:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80408a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80408e:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  804091:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  804095:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  804099:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80409c:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8040a0:	72 58                	jb     8040fa <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8040a2:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8040a5:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8040a8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8040ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040b4:	48 f7 f6             	div    %rsi
+  8040b7:	49 89 c2             	mov    %rax,%r10
+  8040ba:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8040bd:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8040c0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8040c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040c8:	41 89 c9             	mov    %ecx,%r9d
+  8040cb:	41 89 f8             	mov    %edi,%r8d
+  8040ce:	89 d1                	mov    %edx,%ecx
+  8040d0:	4c 89 d2             	mov    %r10,%rdx
+  8040d3:	48 89 c7             	mov    %rax,%rdi
+  8040d6:	48 b8 35 c0 ff ff ff 	movabs $0xffffffffffffc035,%rax
+  8040dd:	ff ff ff 
+  8040e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040e4:	ff d0                	call   *%rax
+  8040e6:	eb 1c                	jmp    804104 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8040e8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8040ec:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8040ef:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8040f3:	48 89 d6             	mov    %rdx,%rsi
+  8040f6:	89 c7                	mov    %eax,%edi
+  8040f8:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8040fa:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8040fe:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  804102:	7f e4                	jg     8040e8 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  804104:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804107:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80410b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804110:	48 f7 f1             	div    %rcx
+  804113:	48 b8 ff e0 ff ff ff 	movabs $0xffffffffffffe0ff,%rax
+  80411a:	ff ff ff 
+  80411d:	48 01 d8             	add    %rbx,%rax
+  804120:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  804124:	0f be c0             	movsbl %al,%eax
+  804127:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80412b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80412f:	48 89 d6             	mov    %rdx,%rsi
+  804132:	89 c7                	mov    %eax,%edi
+  804134:	ff d1                	call   *%rcx
+}
+  804136:	90                   	nop
+  804137:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80413b:	c9                   	leave
+  80413c:	c3                   	ret
+
+000000000080413d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80413d:	55                   	push   %rbp
+  80413e:	48 89 e5             	mov    %rsp,%rbp
+  804141:	48 83 ec 20          	sub    $0x20,%rsp
+  804145:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804145 <getuint+0x8>
+  80414c:	49 bb eb 3e 00 00 00 	movabs $0x3eeb,%r11
+  804153:	00 00 00 
+  804156:	4c 01 d8             	add    %r11,%rax
+  804159:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80415d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  804160:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  804164:	7e 4f                	jle    8041b5 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  804166:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80416a:	8b 00                	mov    (%rax),%eax
+  80416c:	83 f8 2f             	cmp    $0x2f,%eax
+  80416f:	77 24                	ja     804195 <getuint+0x58>
+  804171:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804175:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804179:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80417d:	8b 00                	mov    (%rax),%eax
+  80417f:	89 c0                	mov    %eax,%eax
+  804181:	48 01 d0             	add    %rdx,%rax
+  804184:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804188:	8b 12                	mov    (%rdx),%edx
+  80418a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80418d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804191:	89 0a                	mov    %ecx,(%rdx)
+  804193:	eb 14                	jmp    8041a9 <getuint+0x6c>
+  804195:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804199:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80419d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8041a1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041a5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8041a9:	48 8b 00             	mov    (%rax),%rax
+  8041ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8041b0:	e9 9d 00 00 00       	jmp    804252 <getuint+0x115>
+	else if (lflag)
+  8041b5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8041b9:	74 4c                	je     804207 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8041bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041bf:	8b 00                	mov    (%rax),%eax
+  8041c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8041c4:	77 24                	ja     8041ea <getuint+0xad>
+  8041c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ca:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8041ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041d2:	8b 00                	mov    (%rax),%eax
+  8041d4:	89 c0                	mov    %eax,%eax
+  8041d6:	48 01 d0             	add    %rdx,%rax
+  8041d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041dd:	8b 12                	mov    (%rdx),%edx
+  8041df:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8041e2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041e6:	89 0a                	mov    %ecx,(%rdx)
+  8041e8:	eb 14                	jmp    8041fe <getuint+0xc1>
+  8041ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041f2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8041f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041fa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8041fe:	48 8b 00             	mov    (%rax),%rax
+  804201:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804205:	eb 4b                	jmp    804252 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  804207:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80420b:	8b 00                	mov    (%rax),%eax
+  80420d:	83 f8 2f             	cmp    $0x2f,%eax
+  804210:	77 24                	ja     804236 <getuint+0xf9>
+  804212:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804216:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80421a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80421e:	8b 00                	mov    (%rax),%eax
+  804220:	89 c0                	mov    %eax,%eax
+  804222:	48 01 d0             	add    %rdx,%rax
+  804225:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804229:	8b 12                	mov    (%rdx),%edx
+  80422b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80422e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804232:	89 0a                	mov    %ecx,(%rdx)
+  804234:	eb 14                	jmp    80424a <getuint+0x10d>
+  804236:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80423a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80423e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804242:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804246:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80424a:	8b 00                	mov    (%rax),%eax
+  80424c:	89 c0                	mov    %eax,%eax
+  80424e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  804252:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804256:	c9                   	leave
+  804257:	c3                   	ret
+
+0000000000804258 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  804258:	55                   	push   %rbp
+  804259:	48 89 e5             	mov    %rsp,%rbp
+  80425c:	48 83 ec 20          	sub    $0x20,%rsp
+  804260:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804260 <printfloat+0x8>
+  804267:	49 bb d0 3d 00 00 00 	movabs $0x3dd0,%r11
+  80426e:	00 00 00 
+  804271:	4c 01 d8             	add    %r11,%rax
+  804274:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804278:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80427c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  804280:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804284:	48 85 c0             	test   %rax,%rax
+  804287:	79 12                	jns    80429b <printfloat+0x43>
+		putch('-',putdat);
+  804289:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80428d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804291:	48 89 c6             	mov    %rax,%rsi
+  804294:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  804299:	ff d2                	call   *%rdx
+	
+}
+  80429b:	90                   	nop
+  80429c:	c9                   	leave
+  80429d:	c3                   	ret
+
+000000000080429e <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  80429e:	55                   	push   %rbp
+  80429f:	48 89 e5             	mov    %rsp,%rbp
+  8042a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8042a6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8042a6 <getint+0x8>
+  8042ad:	49 bb 8a 3d 00 00 00 	movabs $0x3d8a,%r11
+  8042b4:	00 00 00 
+  8042b7:	4c 01 d8             	add    %r11,%rax
+  8042ba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042be:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8042c1:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8042c5:	7e 4f                	jle    804316 <getint+0x78>
+		x=va_arg(*ap, long long);
+  8042c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042cb:	8b 00                	mov    (%rax),%eax
+  8042cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8042d0:	77 24                	ja     8042f6 <getint+0x58>
+  8042d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8042da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042de:	8b 00                	mov    (%rax),%eax
+  8042e0:	89 c0                	mov    %eax,%eax
+  8042e2:	48 01 d0             	add    %rdx,%rax
+  8042e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042e9:	8b 12                	mov    (%rdx),%edx
+  8042eb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8042ee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042f2:	89 0a                	mov    %ecx,(%rdx)
+  8042f4:	eb 14                	jmp    80430a <getint+0x6c>
+  8042f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042fa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8042fe:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804302:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804306:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80430a:	48 8b 00             	mov    (%rax),%rax
+  80430d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804311:	e9 9d 00 00 00       	jmp    8043b3 <getint+0x115>
+	else if (lflag)
+  804316:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80431a:	74 4c                	je     804368 <getint+0xca>
+		x=va_arg(*ap, long);
+  80431c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804320:	8b 00                	mov    (%rax),%eax
+  804322:	83 f8 2f             	cmp    $0x2f,%eax
+  804325:	77 24                	ja     80434b <getint+0xad>
+  804327:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80432b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80432f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804333:	8b 00                	mov    (%rax),%eax
+  804335:	89 c0                	mov    %eax,%eax
+  804337:	48 01 d0             	add    %rdx,%rax
+  80433a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80433e:	8b 12                	mov    (%rdx),%edx
+  804340:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804343:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804347:	89 0a                	mov    %ecx,(%rdx)
+  804349:	eb 14                	jmp    80435f <getint+0xc1>
+  80434b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80434f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804353:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804357:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80435b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80435f:	48 8b 00             	mov    (%rax),%rax
+  804362:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804366:	eb 4b                	jmp    8043b3 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  804368:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80436c:	8b 00                	mov    (%rax),%eax
+  80436e:	83 f8 2f             	cmp    $0x2f,%eax
+  804371:	77 24                	ja     804397 <getint+0xf9>
+  804373:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804377:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80437b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80437f:	8b 00                	mov    (%rax),%eax
+  804381:	89 c0                	mov    %eax,%eax
+  804383:	48 01 d0             	add    %rdx,%rax
+  804386:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80438a:	8b 12                	mov    (%rdx),%edx
+  80438c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80438f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804393:	89 0a                	mov    %ecx,(%rdx)
+  804395:	eb 14                	jmp    8043ab <getint+0x10d>
+  804397:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80439b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80439f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8043a3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043a7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8043ab:	8b 00                	mov    (%rax),%eax
+  8043ad:	48 98                	cltq
+  8043af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8043b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8043b7:	c9                   	leave
+  8043b8:	c3                   	ret
+
+00000000008043b9 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  8043b9:	55                   	push   %rbp
+  8043ba:	48 89 e5             	mov    %rsp,%rbp
+  8043bd:	41 57                	push   %r15
+  8043bf:	41 55                	push   %r13
+  8043c1:	41 54                	push   %r12
+  8043c3:	53                   	push   %rbx
+  8043c4:	48 83 ec 60          	sub    $0x60,%rsp
+  8043c8:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 8043c8 <vprintfmt+0xf>
+  8043cf:	49 bb 68 3c 00 00 00 	movabs $0x3c68,%r11
+  8043d6:	00 00 00 
+  8043d9:	4d 01 dc             	add    %r11,%r12
+  8043dc:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  8043e0:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  8043e4:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8043e8:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  8043ec:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  8043f3:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  8043f7:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  8043fb:	48 8b 06             	mov    (%rsi),%rax
+  8043fe:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804402:	48 89 01             	mov    %rax,(%rcx)
+  804405:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804409:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80440d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804411:	eb 17                	jmp    80442a <vprintfmt+0x71>
+			if (ch == '\0')
+  804413:	85 db                	test   %ebx,%ebx
+  804415:	0f 84 97 05 00 00    	je     8049b2 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  80441b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80441f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804423:	48 89 c6             	mov    %rax,%rsi
+  804426:	89 df                	mov    %ebx,%edi
+  804428:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80442a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80442e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804432:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804436:	0f b6 00             	movzbl (%rax),%eax
+  804439:	0f b6 d8             	movzbl %al,%ebx
+  80443c:	83 fb 25             	cmp    $0x25,%ebx
+  80443f:	75 d2                	jne    804413 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  804441:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  804445:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  80444c:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  804453:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  80445a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  804461:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804465:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804469:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80446d:	0f b6 00             	movzbl (%rax),%eax
+  804470:	0f b6 d8             	movzbl %al,%ebx
+  804473:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  804476:	83 f8 55             	cmp    $0x55,%eax
+  804479:	0f 87 00 05 00 00    	ja     80497f <vprintfmt+0x5c6>
+  80447f:	89 c0                	mov    %eax,%eax
+  804481:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804488:	00 
+  804489:	48 8d 05 c8 1c 00 00 	lea    0x1cc8(%rip),%rax        # 806158 <.LC18+0xc>
+  804490:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  804494:	48 8d 15 bd 1c 00 00 	lea    0x1cbd(%rip),%rdx        # 806158 <.LC18+0xc>
+  80449b:	48 01 d0             	add    %rdx,%rax
+  80449e:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  8044a0:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  8044a4:	eb bb                	jmp    804461 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  8044a6:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  8044aa:	eb b5                	jmp    804461 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  8044ac:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  8044b3:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8044b6:	89 d0                	mov    %edx,%eax
+  8044b8:	c1 e0 02             	shl    $0x2,%eax
+  8044bb:	01 d0                	add    %edx,%eax
+  8044bd:	01 c0                	add    %eax,%eax
+  8044bf:	01 d8                	add    %ebx,%eax
+  8044c1:	83 e8 30             	sub    $0x30,%eax
+  8044c4:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  8044c7:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8044cb:	0f b6 00             	movzbl (%rax),%eax
+  8044ce:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  8044d1:	83 fb 2f             	cmp    $0x2f,%ebx
+  8044d4:	7e 60                	jle    804536 <vprintfmt+0x17d>
+  8044d6:	83 fb 39             	cmp    $0x39,%ebx
+  8044d9:	7f 5b                	jg     804536 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  8044db:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  8044e0:	eb d1                	jmp    8044b3 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8044e2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8044e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8044e8:	77 17                	ja     804501 <vprintfmt+0x148>
+  8044ea:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8044ee:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8044f1:	89 d2                	mov    %edx,%edx
+  8044f3:	48 01 d0             	add    %rdx,%rax
+  8044f6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8044f9:	83 c2 08             	add    $0x8,%edx
+  8044fc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8044ff:	eb 0c                	jmp    80450d <vprintfmt+0x154>
+  804501:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804505:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804509:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80450d:	8b 00                	mov    (%rax),%eax
+  80450f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  804512:	eb 23                	jmp    804537 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  804514:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804518:	0f 89 43 ff ff ff    	jns    804461 <vprintfmt+0xa8>
+				width = 0;
+  80451e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  804525:	e9 37 ff ff ff       	jmp    804461 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  80452a:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  804531:	e9 2b ff ff ff       	jmp    804461 <vprintfmt+0xa8>
+			goto process_precision;
+  804536:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  804537:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80453b:	0f 89 20 ff ff ff    	jns    804461 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  804541:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804544:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  804547:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  80454e:	e9 0e ff ff ff       	jmp    804461 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  804553:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  804557:	e9 05 ff ff ff       	jmp    804461 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  80455c:	83 fb 39             	cmp    $0x39,%ebx
+  80455f:	7f 0b                	jg     80456c <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  804561:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  804564:	c1 e0 08             	shl    $0x8,%eax
+  804567:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80456a:	eb 21                	jmp    80458d <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  80456c:	83 fb 60             	cmp    $0x60,%ebx
+  80456f:	7e 10                	jle    804581 <vprintfmt+0x1c8>
+  804571:	83 fb 66             	cmp    $0x66,%ebx
+  804574:	7f 0b                	jg     804581 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  804576:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  804579:	c1 e0 08             	shl    $0x8,%eax
+  80457c:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80457f:	eb 0c                	jmp    80458d <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  804581:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  804588:	e9 04 01 00 00       	jmp    804691 <vprintfmt+0x2d8>
+  80458d:	e9 ff 00 00 00       	jmp    804691 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  804592:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804595:	83 f8 2f             	cmp    $0x2f,%eax
+  804598:	77 17                	ja     8045b1 <vprintfmt+0x1f8>
+  80459a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80459e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8045a1:	89 d2                	mov    %edx,%edx
+  8045a3:	48 01 d0             	add    %rdx,%rax
+  8045a6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8045a9:	83 c2 08             	add    $0x8,%edx
+  8045ac:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8045af:	eb 0c                	jmp    8045bd <vprintfmt+0x204>
+  8045b1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8045b5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8045b9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8045bd:	8b 00                	mov    (%rax),%eax
+  8045bf:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8045c3:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8045c7:	48 89 d6             	mov    %rdx,%rsi
+  8045ca:	89 c7                	mov    %eax,%edi
+  8045cc:	ff d1                	call   *%rcx
+			break;
+  8045ce:	e9 da 03 00 00       	jmp    8049ad <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  8045d3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8045d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8045d9:	77 17                	ja     8045f2 <vprintfmt+0x239>
+  8045db:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8045df:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8045e2:	89 d2                	mov    %edx,%edx
+  8045e4:	48 01 d0             	add    %rdx,%rax
+  8045e7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8045ea:	83 c2 08             	add    $0x8,%edx
+  8045ed:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8045f0:	eb 0c                	jmp    8045fe <vprintfmt+0x245>
+  8045f2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8045f6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8045fa:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8045fe:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  804600:	85 db                	test   %ebx,%ebx
+  804602:	79 02                	jns    804606 <vprintfmt+0x24d>
+				err = -err;
+  804604:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  804606:	83 fb 15             	cmp    $0x15,%ebx
+  804609:	7f 19                	jg     804624 <vprintfmt+0x26b>
+  80460b:	48 ba 90 01 00 00 00 	movabs $0x190,%rdx
+  804612:	00 00 00 
+  804615:	48 63 c3             	movslq %ebx,%rax
+  804618:	4c 01 e2             	add    %r12,%rdx
+  80461b:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  80461f:	4d 85 ed             	test   %r13,%r13
+  804622:	75 36                	jne    80465a <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  804624:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804628:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80462c:	89 d9                	mov    %ebx,%ecx
+  80462e:	48 ba 10 e1 ff ff ff 	movabs $0xffffffffffffe110,%rdx
+  804635:	ff ff ff 
+  804638:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  80463c:	48 89 c7             	mov    %rax,%rdi
+  80463f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804644:	49 b8 90 c9 ff ff ff 	movabs $0xffffffffffffc990,%r8
+  80464b:	ff ff ff 
+  80464e:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  804652:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  804655:	e9 53 03 00 00       	jmp    8049ad <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  80465a:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80465e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804662:	4c 89 e9             	mov    %r13,%rcx
+  804665:	48 ba 19 e1 ff ff ff 	movabs $0xffffffffffffe119,%rdx
+  80466c:	ff ff ff 
+  80466f:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  804673:	48 89 c7             	mov    %rax,%rdi
+  804676:	b8 00 00 00 00       	mov    $0x0,%eax
+  80467b:	49 b8 90 c9 ff ff ff 	movabs $0xffffffffffffc990,%r8
+  804682:	ff ff ff 
+  804685:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  804689:	41 ff d0             	call   *%r8
+			break;
+  80468c:	e9 1c 03 00 00       	jmp    8049ad <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  804691:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804694:	83 f8 2f             	cmp    $0x2f,%eax
+  804697:	77 17                	ja     8046b0 <vprintfmt+0x2f7>
+  804699:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80469d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8046a0:	89 d2                	mov    %edx,%edx
+  8046a2:	48 01 d0             	add    %rdx,%rax
+  8046a5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8046a8:	83 c2 08             	add    $0x8,%edx
+  8046ab:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8046ae:	eb 0c                	jmp    8046bc <vprintfmt+0x303>
+  8046b0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8046b4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8046b8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8046bc:	4c 8b 28             	mov    (%rax),%r13
+  8046bf:	4d 85 ed             	test   %r13,%r13
+  8046c2:	75 0e                	jne    8046d2 <vprintfmt+0x319>
+				p = "(null)";
+  8046c4:	48 b8 1c e1 ff ff ff 	movabs $0xffffffffffffe11c,%rax
+  8046cb:	ff ff ff 
+  8046ce:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  8046d2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8046d6:	0f 8e 84 00 00 00    	jle    804760 <vprintfmt+0x3a7>
+  8046dc:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  8046e0:	74 7e                	je     804760 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8046e2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8046e5:	48 98                	cltq
+  8046e7:	48 89 c6             	mov    %rax,%rsi
+  8046ea:	4c 89 ef             	mov    %r13,%rdi
+  8046ed:	4d 89 e7             	mov    %r12,%r15
+  8046f0:	48 b8 b5 cc ff ff ff 	movabs $0xffffffffffffccb5,%rax
+  8046f7:	ff ff ff 
+  8046fa:	4c 01 e0             	add    %r12,%rax
+  8046fd:	ff d0                	call   *%rax
+  8046ff:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  804702:	eb 17                	jmp    80471b <vprintfmt+0x362>
+					putch(padc, putdat);
+  804704:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  804708:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80470c:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  804710:	48 89 d6             	mov    %rdx,%rsi
+  804713:	89 c7                	mov    %eax,%edi
+  804715:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  804717:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80471b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80471f:	7f e3                	jg     804704 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  804721:	eb 3d                	jmp    804760 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  804723:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  804727:	74 1e                	je     804747 <vprintfmt+0x38e>
+  804729:	83 fb 1f             	cmp    $0x1f,%ebx
+  80472c:	7e 05                	jle    804733 <vprintfmt+0x37a>
+  80472e:	83 fb 7e             	cmp    $0x7e,%ebx
+  804731:	7e 14                	jle    804747 <vprintfmt+0x38e>
+					putch('?', putdat);
+  804733:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804737:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80473b:	48 89 c6             	mov    %rax,%rsi
+  80473e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  804743:	ff d2                	call   *%rdx
+  804745:	eb 15                	jmp    80475c <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  804747:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80474a:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  80474d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804751:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804755:	48 89 c6             	mov    %rax,%rsi
+  804758:	89 cf                	mov    %ecx,%edi
+  80475a:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80475c:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  804760:	4c 89 e8             	mov    %r13,%rax
+  804763:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  804767:	0f b6 00             	movzbl (%rax),%eax
+  80476a:	0f be d8             	movsbl %al,%ebx
+  80476d:	85 db                	test   %ebx,%ebx
+  80476f:	74 28                	je     804799 <vprintfmt+0x3e0>
+  804771:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804775:	78 ac                	js     804723 <vprintfmt+0x36a>
+  804777:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  80477b:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80477f:	79 a2                	jns    804723 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  804781:	eb 16                	jmp    804799 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  804783:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804787:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80478b:	48 89 c6             	mov    %rax,%rsi
+  80478e:	bf 20 00 00 00       	mov    $0x20,%edi
+  804793:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  804795:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  804799:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80479d:	7f e4                	jg     804783 <vprintfmt+0x3ca>
+			break;
+  80479f:	e9 09 02 00 00       	jmp    8049ad <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  8047a4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8047a8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8047ac:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8047b0:	0f b6 00             	movzbl (%rax),%eax
+  8047b3:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  8047b6:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  8047b7:	83 fb 2f             	cmp    $0x2f,%ebx
+  8047ba:	0f 8e ac fd ff ff    	jle    80456c <vprintfmt+0x1b3>
+  8047c0:	e9 97 fd ff ff       	jmp    80455c <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8047c5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8047c9:	be 03 00 00 00       	mov    $0x3,%esi
+  8047ce:	48 89 c7             	mov    %rax,%rdi
+  8047d1:	48 b8 6e c2 ff ff ff 	movabs $0xffffffffffffc26e,%rax
+  8047d8:	ff ff ff 
+  8047db:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8047df:	ff d0                	call   *%rax
+  8047e1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8047e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047e9:	48 85 c0             	test   %rax,%rax
+  8047ec:	79 1d                	jns    80480b <vprintfmt+0x452>
+				putch('-', putdat);
+  8047ee:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8047f2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8047f6:	48 89 c6             	mov    %rax,%rsi
+  8047f9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8047fe:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  804800:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804804:	48 f7 d8             	neg    %rax
+  804807:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  80480b:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  804812:	e9 de 00 00 00       	jmp    8048f5 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  804817:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80481b:	be 03 00 00 00       	mov    $0x3,%esi
+  804820:	48 89 c7             	mov    %rax,%rdi
+  804823:	48 b8 0d c1 ff ff ff 	movabs $0xffffffffffffc10d,%rax
+  80482a:	ff ff ff 
+  80482d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804831:	ff d0                	call   *%rax
+  804833:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  804837:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80483e:	e9 b2 00 00 00       	jmp    8048f5 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  804843:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804847:	be 03 00 00 00       	mov    $0x3,%esi
+  80484c:	48 89 c7             	mov    %rax,%rdi
+  80484f:	48 b8 0d c1 ff ff ff 	movabs $0xffffffffffffc10d,%rax
+  804856:	ff ff ff 
+  804859:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80485d:	ff d0                	call   *%rax
+  80485f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  804863:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  80486a:	e9 86 00 00 00       	jmp    8048f5 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80486f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804873:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804877:	48 89 c6             	mov    %rax,%rsi
+  80487a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80487f:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  804881:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804885:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804889:	48 89 c6             	mov    %rax,%rsi
+  80488c:	bf 78 00 00 00       	mov    $0x78,%edi
+  804891:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  804893:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804896:	83 f8 2f             	cmp    $0x2f,%eax
+  804899:	77 17                	ja     8048b2 <vprintfmt+0x4f9>
+  80489b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80489f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8048a2:	89 d2                	mov    %edx,%edx
+  8048a4:	48 01 d0             	add    %rdx,%rax
+  8048a7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8048aa:	83 c2 08             	add    $0x8,%edx
+  8048ad:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8048b0:	eb 0c                	jmp    8048be <vprintfmt+0x505>
+  8048b2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8048b6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8048ba:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8048be:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8048c1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8048c5:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8048cc:	eb 27                	jmp    8048f5 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8048ce:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8048d2:	be 03 00 00 00       	mov    $0x3,%esi
+  8048d7:	48 89 c7             	mov    %rax,%rdi
+  8048da:	48 b8 0d c1 ff ff ff 	movabs $0xffffffffffffc10d,%rax
+  8048e1:	ff ff ff 
+  8048e4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8048e8:	ff d0                	call   *%rax
+  8048ea:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8048ee:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8048f5:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8048fa:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8048fd:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  804900:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804904:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804908:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80490c:	45 89 c1             	mov    %r8d,%r9d
+  80490f:	41 89 f8             	mov    %edi,%r8d
+  804912:	48 89 c7             	mov    %rax,%rdi
+  804915:	48 b8 35 c0 ff ff ff 	movabs $0xffffffffffffc035,%rax
+  80491c:	ff ff ff 
+  80491f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804923:	ff d0                	call   *%rax
+			break;
+  804925:	e9 83 00 00 00       	jmp    8049ad <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80492a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80492e:	be 03 00 00 00       	mov    $0x3,%esi
+  804933:	48 89 c7             	mov    %rax,%rdi
+  804936:	48 b8 0d c1 ff ff ff 	movabs $0xffffffffffffc10d,%rax
+  80493d:	ff ff ff 
+  804940:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804944:	ff d0                	call   *%rax
+  804946:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80494a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80494e:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  804952:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804956:	48 89 ce             	mov    %rcx,%rsi
+  804959:	48 89 c7             	mov    %rax,%rdi
+  80495c:	48 b8 28 c2 ff ff ff 	movabs $0xffffffffffffc228,%rax
+  804963:	ff ff ff 
+  804966:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80496a:	ff d0                	call   *%rax
+	
+			break;
+  80496c:	eb 3f                	jmp    8049ad <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80496e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804972:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804976:	48 89 c6             	mov    %rax,%rsi
+  804979:	89 df                	mov    %ebx,%edi
+  80497b:	ff d2                	call   *%rdx
+			break;
+  80497d:	eb 2e                	jmp    8049ad <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80497f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804983:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804987:	48 89 c6             	mov    %rax,%rsi
+  80498a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80498f:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  804991:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  804996:	eb 05                	jmp    80499d <vprintfmt+0x5e4>
+  804998:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80499d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8049a1:	48 83 e8 01          	sub    $0x1,%rax
+  8049a5:	0f b6 00             	movzbl (%rax),%eax
+  8049a8:	3c 25                	cmp    $0x25,%al
+  8049aa:	75 ec                	jne    804998 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8049ac:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8049ad:	e9 78 fa ff ff       	jmp    80442a <vprintfmt+0x71>
+				return;
+  8049b2:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8049b3:	48 83 c4 60          	add    $0x60,%rsp
+  8049b7:	5b                   	pop    %rbx
+  8049b8:	41 5c                	pop    %r12
+  8049ba:	41 5d                	pop    %r13
+  8049bc:	41 5f                	pop    %r15
+  8049be:	5d                   	pop    %rbp
+  8049bf:	c3                   	ret
+
+00000000008049c0 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8049c0:	55                   	push   %rbp
+  8049c1:	48 89 e5             	mov    %rsp,%rbp
+  8049c4:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8049cb:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8049cb <printfmt+0xb>
+  8049d2:	49 bb 65 36 00 00 00 	movabs $0x3665,%r11
+  8049d9:	00 00 00 
+  8049dc:	4d 01 da             	add    %r11,%r10
+  8049df:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8049e6:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8049ed:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8049f4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8049fb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804a02:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804a09:	84 c0                	test   %al,%al
+  804a0b:	74 20                	je     804a2d <printfmt+0x6d>
+  804a0d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804a11:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804a15:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804a19:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804a1d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804a21:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804a25:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804a29:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  804a2d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  804a34:	00 00 00 
+  804a37:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  804a3e:	00 00 00 
+  804a41:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a45:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  804a4c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804a53:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  804a5a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  804a61:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  804a68:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  804a6f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804a76:	48 89 c7             	mov    %rax,%rdi
+  804a79:	48 b8 89 c3 ff ff ff 	movabs $0xffffffffffffc389,%rax
+  804a80:	ff ff ff 
+  804a83:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804a87:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  804a89:	90                   	nop
+  804a8a:	c9                   	leave
+  804a8b:	c3                   	ret
+
+0000000000804a8c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  804a8c:	55                   	push   %rbp
+  804a8d:	48 89 e5             	mov    %rsp,%rbp
+  804a90:	48 83 ec 10          	sub    $0x10,%rsp
+  804a94:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a94 <sprintputch+0x8>
+  804a9b:	49 bb 9c 35 00 00 00 	movabs $0x359c,%r11
+  804aa2:	00 00 00 
+  804aa5:	4c 01 d8             	add    %r11,%rax
+  804aa8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804aab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  804aaf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ab3:	8b 40 10             	mov    0x10(%rax),%eax
+  804ab6:	8d 50 01             	lea    0x1(%rax),%edx
+  804ab9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804abd:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  804ac0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ac4:	48 8b 10             	mov    (%rax),%rdx
+  804ac7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804acb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804acf:	48 39 c2             	cmp    %rax,%rdx
+  804ad2:	73 17                	jae    804aeb <sprintputch+0x5f>
+		*b->buf++ = ch;
+  804ad4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ad8:	48 8b 00             	mov    (%rax),%rax
+  804adb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804adf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804ae3:	48 89 0a             	mov    %rcx,(%rdx)
+  804ae6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804ae9:	88 10                	mov    %dl,(%rax)
+}
+  804aeb:	90                   	nop
+  804aec:	c9                   	leave
+  804aed:	c3                   	ret
+
+0000000000804aee <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  804aee:	55                   	push   %rbp
+  804aef:	48 89 e5             	mov    %rsp,%rbp
+  804af2:	53                   	push   %rbx
+  804af3:	48 83 ec 58          	sub    $0x58,%rsp
+  804af7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804af7 <vsnprintf+0x9>
+  804afe:	49 bb 39 35 00 00 00 	movabs $0x3539,%r11
+  804b05:	00 00 00 
+  804b08:	4c 01 d8             	add    %r11,%rax
+  804b0b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804b0f:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  804b12:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804b16:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  804b1a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804b1e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  804b22:	48 8b 0e             	mov    (%rsi),%rcx
+  804b25:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  804b29:	48 89 0a             	mov    %rcx,(%rdx)
+  804b2c:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  804b30:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  804b34:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  804b38:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804b3c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804b40:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  804b43:	48 63 d2             	movslq %edx,%rdx
+  804b46:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  804b4a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804b4e:	48 01 ca             	add    %rcx,%rdx
+  804b51:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804b55:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  804b5c:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804b61:	74 06                	je     804b69 <vsnprintf+0x7b>
+  804b63:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  804b67:	7f 07                	jg     804b70 <vsnprintf+0x82>
+		return -E_INVAL;
+  804b69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804b6e:	eb 34                	jmp    804ba4 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  804b70:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  804b74:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  804b78:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  804b7c:	48 bf 5c ca ff ff ff 	movabs $0xffffffffffffca5c,%rdi
+  804b83:	ff ff ff 
+  804b86:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  804b8a:	49 b8 89 c3 ff ff ff 	movabs $0xffffffffffffc389,%r8
+  804b91:	ff ff ff 
+  804b94:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  804b98:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  804b9a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b9e:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  804ba1:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  804ba4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804ba8:	c9                   	leave
+  804ba9:	c3                   	ret
+
+0000000000804baa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  804baa:	55                   	push   %rbp
+  804bab:	48 89 e5             	mov    %rsp,%rbp
+  804bae:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  804bb5:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804bb5 <snprintf+0xb>
+  804bbc:	49 bb 7b 34 00 00 00 	movabs $0x347b,%r11
+  804bc3:	00 00 00 
+  804bc6:	4d 01 da             	add    %r11,%r10
+  804bc9:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  804bd0:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  804bd6:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  804bdd:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804be4:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804beb:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804bf2:	84 c0                	test   %al,%al
+  804bf4:	74 20                	je     804c16 <snprintf+0x6c>
+  804bf6:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804bfa:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804bfe:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804c02:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804c06:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804c0a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804c0e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804c12:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  804c16:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  804c1d:	00 00 00 
+  804c20:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804c27:	00 00 00 
+  804c2a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804c2e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804c35:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804c3c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  804c43:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  804c4a:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  804c51:	48 8b 06             	mov    (%rsi),%rax
+  804c54:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804c58:	48 89 01             	mov    %rax,(%rcx)
+  804c5b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804c5f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804c63:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  804c67:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  804c6e:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  804c75:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  804c7b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c82:	48 89 c7             	mov    %rax,%rdi
+  804c85:	48 b8 be ca ff ff ff 	movabs $0xffffffffffffcabe,%rax
+  804c8c:	ff ff ff 
+  804c8f:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804c93:	ff d0                	call   *%rax
+  804c95:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  804c9b:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804ca1:	c9                   	leave
+  804ca2:	c3                   	ret
+
+0000000000804ca3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  804ca3:	55                   	push   %rbp
+  804ca4:	48 89 e5             	mov    %rsp,%rbp
+  804ca7:	48 83 ec 18          	sub    $0x18,%rsp
+  804cab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804cab <strlen+0x8>
+  804cb2:	49 bb 85 33 00 00 00 	movabs $0x3385,%r11
+  804cb9:	00 00 00 
+  804cbc:	4c 01 d8             	add    %r11,%rax
+  804cbf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  804cc3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804cca:	eb 09                	jmp    804cd5 <strlen+0x32>
+		n++;
+  804ccc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  804cd0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804cd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cd9:	0f b6 00             	movzbl (%rax),%eax
+  804cdc:	84 c0                	test   %al,%al
+  804cde:	75 ec                	jne    804ccc <strlen+0x29>
+	return n;
+  804ce0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804ce3:	c9                   	leave
+  804ce4:	c3                   	ret
+
+0000000000804ce5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  804ce5:	55                   	push   %rbp
+  804ce6:	48 89 e5             	mov    %rsp,%rbp
+  804ce9:	48 83 ec 20          	sub    $0x20,%rsp
+  804ced:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804ced <strnlen+0x8>
+  804cf4:	49 bb 43 33 00 00 00 	movabs $0x3343,%r11
+  804cfb:	00 00 00 
+  804cfe:	4c 01 d8             	add    %r11,%rax
+  804d01:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d05:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804d09:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804d10:	eb 0e                	jmp    804d20 <strnlen+0x3b>
+		n++;
+  804d12:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804d16:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804d1b:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  804d20:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804d25:	74 0b                	je     804d32 <strnlen+0x4d>
+  804d27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d2b:	0f b6 00             	movzbl (%rax),%eax
+  804d2e:	84 c0                	test   %al,%al
+  804d30:	75 e0                	jne    804d12 <strnlen+0x2d>
+	return n;
+  804d32:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d35:	c9                   	leave
+  804d36:	c3                   	ret
+
+0000000000804d37 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  804d37:	55                   	push   %rbp
+  804d38:	48 89 e5             	mov    %rsp,%rbp
+  804d3b:	48 83 ec 20          	sub    $0x20,%rsp
+  804d3f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d3f <strcpy+0x8>
+  804d46:	49 bb f1 32 00 00 00 	movabs $0x32f1,%r11
+  804d4d:	00 00 00 
+  804d50:	4c 01 d8             	add    %r11,%rax
+  804d53:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d57:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  804d5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d5f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  804d63:	90                   	nop
+  804d64:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804d68:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804d6c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804d70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d74:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804d78:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804d7c:	0f b6 12             	movzbl (%rdx),%edx
+  804d7f:	88 10                	mov    %dl,(%rax)
+  804d81:	0f b6 00             	movzbl (%rax),%eax
+  804d84:	84 c0                	test   %al,%al
+  804d86:	75 dc                	jne    804d64 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  804d88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804d8c:	c9                   	leave
+  804d8d:	c3                   	ret
+
+0000000000804d8e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  804d8e:	55                   	push   %rbp
+  804d8f:	48 89 e5             	mov    %rsp,%rbp
+  804d92:	53                   	push   %rbx
+  804d93:	48 83 ec 20          	sub    $0x20,%rsp
+  804d97:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d97 <strcat+0x9>
+  804d9e:	49 bb 99 32 00 00 00 	movabs $0x3299,%r11
+  804da5:	00 00 00 
+  804da8:	4c 01 db             	add    %r11,%rbx
+  804dab:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  804daf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  804db3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804db7:	48 89 c7             	mov    %rax,%rdi
+  804dba:	48 b8 73 cc ff ff ff 	movabs $0xffffffffffffcc73,%rax
+  804dc1:	ff ff ff 
+  804dc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804dc8:	ff d0                	call   *%rax
+  804dca:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  804dcd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804dd0:	48 63 d0             	movslq %eax,%rdx
+  804dd3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804dd7:	48 01 c2             	add    %rax,%rdx
+  804dda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dde:	48 89 c6             	mov    %rax,%rsi
+  804de1:	48 89 d7             	mov    %rdx,%rdi
+  804de4:	48 b8 07 cd ff ff ff 	movabs $0xffffffffffffcd07,%rax
+  804deb:	ff ff ff 
+  804dee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804df2:	ff d0                	call   *%rax
+	return dst;
+  804df4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  804df8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804dfc:	c9                   	leave
+  804dfd:	c3                   	ret
+
+0000000000804dfe <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  804dfe:	55                   	push   %rbp
+  804dff:	48 89 e5             	mov    %rsp,%rbp
+  804e02:	48 83 ec 28          	sub    $0x28,%rsp
+  804e06:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e06 <strncpy+0x8>
+  804e0d:	49 bb 2a 32 00 00 00 	movabs $0x322a,%r11
+  804e14:	00 00 00 
+  804e17:	4c 01 d8             	add    %r11,%rax
+  804e1a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e1e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804e22:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  804e26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e2a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  804e2e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804e35:	00 
+  804e36:	eb 2a                	jmp    804e62 <strncpy+0x64>
+		*dst++ = *src;
+  804e38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e3c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804e40:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804e44:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e48:	0f b6 12             	movzbl (%rdx),%edx
+  804e4b:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  804e4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e51:	0f b6 00             	movzbl (%rax),%eax
+  804e54:	84 c0                	test   %al,%al
+  804e56:	74 05                	je     804e5d <strncpy+0x5f>
+			src++;
+  804e58:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  804e5d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804e62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e66:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804e6a:	72 cc                	jb     804e38 <strncpy+0x3a>
+	}
+	return ret;
+  804e6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804e70:	c9                   	leave
+  804e71:	c3                   	ret
+
+0000000000804e72 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  804e72:	55                   	push   %rbp
+  804e73:	48 89 e5             	mov    %rsp,%rbp
+  804e76:	48 83 ec 28          	sub    $0x28,%rsp
+  804e7a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e7a <strlcpy+0x8>
+  804e81:	49 bb b6 31 00 00 00 	movabs $0x31b6,%r11
+  804e88:	00 00 00 
+  804e8b:	4c 01 d8             	add    %r11,%rax
+  804e8e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e92:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804e96:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  804e9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e9e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  804ea2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804ea7:	74 3d                	je     804ee6 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  804ea9:	eb 1d                	jmp    804ec8 <strlcpy+0x56>
+			*dst++ = *src++;
+  804eab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804eaf:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804eb3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804eb7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ebb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804ebf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804ec3:	0f b6 12             	movzbl (%rdx),%edx
+  804ec6:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  804ec8:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804ecd:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804ed2:	74 0b                	je     804edf <strlcpy+0x6d>
+  804ed4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ed8:	0f b6 00             	movzbl (%rax),%eax
+  804edb:	84 c0                	test   %al,%al
+  804edd:	75 cc                	jne    804eab <strlcpy+0x39>
+		*dst = '\0';
+  804edf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee3:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  804ee6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eea:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  804eee:	c9                   	leave
+  804eef:	c3                   	ret
+
+0000000000804ef0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  804ef0:	55                   	push   %rbp
+  804ef1:	48 89 e5             	mov    %rsp,%rbp
+  804ef4:	48 83 ec 10          	sub    $0x10,%rsp
+  804ef8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804ef8 <strcmp+0x8>
+  804eff:	49 bb 38 31 00 00 00 	movabs $0x3138,%r11
+  804f06:	00 00 00 
+  804f09:	4c 01 d8             	add    %r11,%rax
+  804f0c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804f10:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  804f14:	eb 0a                	jmp    804f20 <strcmp+0x30>
+		p++, q++;
+  804f16:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804f1b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  804f20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f24:	0f b6 00             	movzbl (%rax),%eax
+  804f27:	84 c0                	test   %al,%al
+  804f29:	74 12                	je     804f3d <strcmp+0x4d>
+  804f2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f2f:	0f b6 10             	movzbl (%rax),%edx
+  804f32:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f36:	0f b6 00             	movzbl (%rax),%eax
+  804f39:	38 c2                	cmp    %al,%dl
+  804f3b:	74 d9                	je     804f16 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  804f3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f41:	0f b6 00             	movzbl (%rax),%eax
+  804f44:	0f b6 d0             	movzbl %al,%edx
+  804f47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f4b:	0f b6 00             	movzbl (%rax),%eax
+  804f4e:	0f b6 c0             	movzbl %al,%eax
+  804f51:	29 c2                	sub    %eax,%edx
+  804f53:	89 d0                	mov    %edx,%eax
+}
+  804f55:	c9                   	leave
+  804f56:	c3                   	ret
+
+0000000000804f57 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  804f57:	55                   	push   %rbp
+  804f58:	48 89 e5             	mov    %rsp,%rbp
+  804f5b:	48 83 ec 18          	sub    $0x18,%rsp
+  804f5f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804f5f <strncmp+0x8>
+  804f66:	49 bb d1 30 00 00 00 	movabs $0x30d1,%r11
+  804f6d:	00 00 00 
+  804f70:	4c 01 d8             	add    %r11,%rax
+  804f73:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804f77:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804f7b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  804f7f:	eb 0f                	jmp    804f90 <strncmp+0x39>
+		n--, p++, q++;
+  804f81:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  804f86:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804f8b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  804f90:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804f95:	74 1d                	je     804fb4 <strncmp+0x5d>
+  804f97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f9b:	0f b6 00             	movzbl (%rax),%eax
+  804f9e:	84 c0                	test   %al,%al
+  804fa0:	74 12                	je     804fb4 <strncmp+0x5d>
+  804fa2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fa6:	0f b6 10             	movzbl (%rax),%edx
+  804fa9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fad:	0f b6 00             	movzbl (%rax),%eax
+  804fb0:	38 c2                	cmp    %al,%dl
+  804fb2:	74 cd                	je     804f81 <strncmp+0x2a>
+	if (n == 0)
+  804fb4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804fb9:	75 07                	jne    804fc2 <strncmp+0x6b>
+		return 0;
+  804fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fc0:	eb 16                	jmp    804fd8 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  804fc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fc6:	0f b6 00             	movzbl (%rax),%eax
+  804fc9:	0f b6 d0             	movzbl %al,%edx
+  804fcc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fd0:	0f b6 00             	movzbl (%rax),%eax
+  804fd3:	0f b6 c0             	movzbl %al,%eax
+  804fd6:	29 c2                	sub    %eax,%edx
+}
+  804fd8:	89 d0                	mov    %edx,%eax
+  804fda:	c9                   	leave
+  804fdb:	c3                   	ret
+
+0000000000804fdc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  804fdc:	55                   	push   %rbp
+  804fdd:	48 89 e5             	mov    %rsp,%rbp
+  804fe0:	48 83 ec 10          	sub    $0x10,%rsp
+  804fe4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804fe4 <strchr+0x8>
+  804feb:	49 bb 4c 30 00 00 00 	movabs $0x304c,%r11
+  804ff2:	00 00 00 
+  804ff5:	4c 01 d8             	add    %r11,%rax
+  804ff8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804ffc:	89 f0                	mov    %esi,%eax
+  804ffe:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  805001:	eb 17                	jmp    80501a <strchr+0x3e>
+		if (*s == c)
+  805003:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805007:	0f b6 00             	movzbl (%rax),%eax
+  80500a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80500d:	75 06                	jne    805015 <strchr+0x39>
+			return (char *) s;
+  80500f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805013:	eb 15                	jmp    80502a <strchr+0x4e>
+	for (; *s; s++)
+  805015:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80501a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80501e:	0f b6 00             	movzbl (%rax),%eax
+  805021:	84 c0                	test   %al,%al
+  805023:	75 de                	jne    805003 <strchr+0x27>
+	return 0;
+  805025:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80502a:	c9                   	leave
+  80502b:	c3                   	ret
+
+000000000080502c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80502c:	55                   	push   %rbp
+  80502d:	48 89 e5             	mov    %rsp,%rbp
+  805030:	48 83 ec 10          	sub    $0x10,%rsp
+  805034:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805034 <strfind+0x8>
+  80503b:	49 bb fc 2f 00 00 00 	movabs $0x2ffc,%r11
+  805042:	00 00 00 
+  805045:	4c 01 d8             	add    %r11,%rax
+  805048:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80504c:	89 f0                	mov    %esi,%eax
+  80504e:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  805051:	eb 11                	jmp    805064 <strfind+0x38>
+		if (*s == c)
+  805053:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805057:	0f b6 00             	movzbl (%rax),%eax
+  80505a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80505d:	74 12                	je     805071 <strfind+0x45>
+	for (; *s; s++)
+  80505f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  805064:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805068:	0f b6 00             	movzbl (%rax),%eax
+  80506b:	84 c0                	test   %al,%al
+  80506d:	75 e4                	jne    805053 <strfind+0x27>
+  80506f:	eb 01                	jmp    805072 <strfind+0x46>
+			break;
+  805071:	90                   	nop
+	return (char *) s;
+  805072:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805076:	c9                   	leave
+  805077:	c3                   	ret
+
+0000000000805078 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  805078:	55                   	push   %rbp
+  805079:	48 89 e5             	mov    %rsp,%rbp
+  80507c:	48 83 ec 18          	sub    $0x18,%rsp
+  805080:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805080 <memset+0x8>
+  805087:	49 bb b0 2f 00 00 00 	movabs $0x2fb0,%r11
+  80508e:	00 00 00 
+  805091:	4c 01 d8             	add    %r11,%rax
+  805094:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805098:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80509b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80509f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8050a4:	75 06                	jne    8050ac <memset+0x34>
+		return v;
+  8050a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050aa:	eb 69                	jmp    805115 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8050ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050b0:	83 e0 03             	and    $0x3,%eax
+  8050b3:	48 85 c0             	test   %rax,%rax
+  8050b6:	75 48                	jne    805100 <memset+0x88>
+  8050b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050bc:	83 e0 03             	and    $0x3,%eax
+  8050bf:	48 85 c0             	test   %rax,%rax
+  8050c2:	75 3c                	jne    805100 <memset+0x88>
+		c &= 0xFF;
+  8050c4:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8050cb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050ce:	c1 e0 18             	shl    $0x18,%eax
+  8050d1:	89 c2                	mov    %eax,%edx
+  8050d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050d6:	c1 e0 10             	shl    $0x10,%eax
+  8050d9:	09 c2                	or     %eax,%edx
+  8050db:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050de:	c1 e0 08             	shl    $0x8,%eax
+  8050e1:	09 d0                	or     %edx,%eax
+  8050e3:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8050e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050ea:	48 c1 e8 02          	shr    $0x2,%rax
+  8050ee:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8050f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050f8:	48 89 d7             	mov    %rdx,%rdi
+  8050fb:	fc                   	cld
+  8050fc:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8050fe:	eb 11                	jmp    805111 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  805100:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805104:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805107:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80510b:	48 89 d7             	mov    %rdx,%rdi
+  80510e:	fc                   	cld
+  80510f:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  805111:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805115:	c9                   	leave
+  805116:	c3                   	ret
+
+0000000000805117 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  805117:	55                   	push   %rbp
+  805118:	48 89 e5             	mov    %rsp,%rbp
+  80511b:	48 83 ec 28          	sub    $0x28,%rsp
+  80511f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80511f <memmove+0x8>
+  805126:	49 bb 11 2f 00 00 00 	movabs $0x2f11,%r11
+  80512d:	00 00 00 
+  805130:	4c 01 d8             	add    %r11,%rax
+  805133:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805137:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80513b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80513f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805143:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  805147:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80514b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80514f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805153:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805157:	0f 83 88 00 00 00    	jae    8051e5 <memmove+0xce>
+  80515d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805161:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805165:	48 01 d0             	add    %rdx,%rax
+  805168:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80516c:	73 77                	jae    8051e5 <memmove+0xce>
+		s += n;
+  80516e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805172:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  805176:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80517a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80517e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805182:	83 e0 03             	and    $0x3,%eax
+  805185:	48 85 c0             	test   %rax,%rax
+  805188:	75 3b                	jne    8051c5 <memmove+0xae>
+  80518a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80518e:	83 e0 03             	and    $0x3,%eax
+  805191:	48 85 c0             	test   %rax,%rax
+  805194:	75 2f                	jne    8051c5 <memmove+0xae>
+  805196:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80519a:	83 e0 03             	and    $0x3,%eax
+  80519d:	48 85 c0             	test   %rax,%rax
+  8051a0:	75 23                	jne    8051c5 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8051a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051a6:	48 83 e8 04          	sub    $0x4,%rax
+  8051aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8051ae:	48 83 ea 04          	sub    $0x4,%rdx
+  8051b2:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8051b6:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8051ba:	48 89 c7             	mov    %rax,%rdi
+  8051bd:	48 89 d6             	mov    %rdx,%rsi
+  8051c0:	fd                   	std
+  8051c1:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8051c3:	eb 1d                	jmp    8051e2 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8051c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051c9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8051cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051d1:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8051d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051d9:	48 89 d7             	mov    %rdx,%rdi
+  8051dc:	48 89 c1             	mov    %rax,%rcx
+  8051df:	fd                   	std
+  8051e0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8051e2:	fc                   	cld
+  8051e3:	eb 57                	jmp    80523c <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8051e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051e9:	83 e0 03             	and    $0x3,%eax
+  8051ec:	48 85 c0             	test   %rax,%rax
+  8051ef:	75 36                	jne    805227 <memmove+0x110>
+  8051f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051f5:	83 e0 03             	and    $0x3,%eax
+  8051f8:	48 85 c0             	test   %rax,%rax
+  8051fb:	75 2a                	jne    805227 <memmove+0x110>
+  8051fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805201:	83 e0 03             	and    $0x3,%eax
+  805204:	48 85 c0             	test   %rax,%rax
+  805207:	75 1e                	jne    805227 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  805209:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80520d:	48 c1 e8 02          	shr    $0x2,%rax
+  805211:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  805214:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805218:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80521c:	48 89 c7             	mov    %rax,%rdi
+  80521f:	48 89 d6             	mov    %rdx,%rsi
+  805222:	fc                   	cld
+  805223:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  805225:	eb 15                	jmp    80523c <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  805227:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80522b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80522f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805233:	48 89 c7             	mov    %rax,%rdi
+  805236:	48 89 d6             	mov    %rdx,%rsi
+  805239:	fc                   	cld
+  80523a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  80523c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805240:	c9                   	leave
+  805241:	c3                   	ret
+
+0000000000805242 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  805242:	55                   	push   %rbp
+  805243:	48 89 e5             	mov    %rsp,%rbp
+  805246:	48 83 ec 18          	sub    $0x18,%rsp
+  80524a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80524a <memcpy+0x8>
+  805251:	49 bb e6 2d 00 00 00 	movabs $0x2de6,%r11
+  805258:	00 00 00 
+  80525b:	4c 01 d8             	add    %r11,%rax
+  80525e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805262:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805266:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  80526a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80526e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805272:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  805276:	48 89 cf             	mov    %rcx,%rdi
+  805279:	48 b9 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rcx
+  805280:	ff ff ff 
+  805283:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805287:	ff d0                	call   *%rax
+}
+  805289:	c9                   	leave
+  80528a:	c3                   	ret
+
+000000000080528b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80528b:	55                   	push   %rbp
+  80528c:	48 89 e5             	mov    %rsp,%rbp
+  80528f:	48 83 ec 28          	sub    $0x28,%rsp
+  805293:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805293 <memcmp+0x8>
+  80529a:	49 bb 9d 2d 00 00 00 	movabs $0x2d9d,%r11
+  8052a1:	00 00 00 
+  8052a4:	4c 01 d8             	add    %r11,%rax
+  8052a7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8052ab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8052af:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  8052b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  8052bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052bf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  8052c3:	eb 34                	jmp    8052f9 <memcmp+0x6e>
+		if (*s1 != *s2)
+  8052c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052c9:	0f b6 10             	movzbl (%rax),%edx
+  8052cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052d0:	0f b6 00             	movzbl (%rax),%eax
+  8052d3:	38 c2                	cmp    %al,%dl
+  8052d5:	74 18                	je     8052ef <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  8052d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052db:	0f b6 00             	movzbl (%rax),%eax
+  8052de:	0f b6 d0             	movzbl %al,%edx
+  8052e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052e5:	0f b6 00             	movzbl (%rax),%eax
+  8052e8:	0f b6 c0             	movzbl %al,%eax
+  8052eb:	29 c2                	sub    %eax,%edx
+  8052ed:	eb 20                	jmp    80530f <memcmp+0x84>
+		s1++, s2++;
+  8052ef:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8052f4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8052f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052fd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805301:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805305:	48 85 c0             	test   %rax,%rax
+  805308:	75 bb                	jne    8052c5 <memcmp+0x3a>
+	}
+
+	return 0;
+  80530a:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80530f:	89 d0                	mov    %edx,%eax
+  805311:	c9                   	leave
+  805312:	c3                   	ret
+
+0000000000805313 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  805313:	55                   	push   %rbp
+  805314:	48 89 e5             	mov    %rsp,%rbp
+  805317:	48 83 ec 28          	sub    $0x28,%rsp
+  80531b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80531b <memfind+0x8>
+  805322:	49 bb 15 2d 00 00 00 	movabs $0x2d15,%r11
+  805329:	00 00 00 
+  80532c:	4c 01 d8             	add    %r11,%rax
+  80532f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805333:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805336:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  80533a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80533e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805342:	48 01 d0             	add    %rdx,%rax
+  805345:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  805349:	eb 13                	jmp    80535e <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80534b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80534f:	0f b6 00             	movzbl (%rax),%eax
+  805352:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805355:	38 d0                	cmp    %dl,%al
+  805357:	74 11                	je     80536a <memfind+0x57>
+	for (; s < ends; s++)
+  805359:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80535e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805362:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805366:	72 e3                	jb     80534b <memfind+0x38>
+  805368:	eb 01                	jmp    80536b <memfind+0x58>
+			break;
+  80536a:	90                   	nop
+	return (void *) s;
+  80536b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80536f:	c9                   	leave
+  805370:	c3                   	ret
+
+0000000000805371 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  805371:	55                   	push   %rbp
+  805372:	48 89 e5             	mov    %rsp,%rbp
+  805375:	48 83 ec 38          	sub    $0x38,%rsp
+  805379:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805379 <strtol+0x8>
+  805380:	49 bb b7 2c 00 00 00 	movabs $0x2cb7,%r11
+  805387:	00 00 00 
+  80538a:	4c 01 d8             	add    %r11,%rax
+  80538d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805391:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805395:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  805398:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80539f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8053a6:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8053a7:	eb 05                	jmp    8053ae <strtol+0x3d>
+		s++;
+  8053a9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8053ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053b2:	0f b6 00             	movzbl (%rax),%eax
+  8053b5:	3c 20                	cmp    $0x20,%al
+  8053b7:	74 f0                	je     8053a9 <strtol+0x38>
+  8053b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053bd:	0f b6 00             	movzbl (%rax),%eax
+  8053c0:	3c 09                	cmp    $0x9,%al
+  8053c2:	74 e5                	je     8053a9 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  8053c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053c8:	0f b6 00             	movzbl (%rax),%eax
+  8053cb:	3c 2b                	cmp    $0x2b,%al
+  8053cd:	75 07                	jne    8053d6 <strtol+0x65>
+		s++;
+  8053cf:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8053d4:	eb 17                	jmp    8053ed <strtol+0x7c>
+	else if (*s == '-')
+  8053d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053da:	0f b6 00             	movzbl (%rax),%eax
+  8053dd:	3c 2d                	cmp    $0x2d,%al
+  8053df:	75 0c                	jne    8053ed <strtol+0x7c>
+		s++, neg = 1;
+  8053e1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8053e6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8053ed:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8053f1:	74 06                	je     8053f9 <strtol+0x88>
+  8053f3:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8053f7:	75 28                	jne    805421 <strtol+0xb0>
+  8053f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053fd:	0f b6 00             	movzbl (%rax),%eax
+  805400:	3c 30                	cmp    $0x30,%al
+  805402:	75 1d                	jne    805421 <strtol+0xb0>
+  805404:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805408:	48 83 c0 01          	add    $0x1,%rax
+  80540c:	0f b6 00             	movzbl (%rax),%eax
+  80540f:	3c 78                	cmp    $0x78,%al
+  805411:	75 0e                	jne    805421 <strtol+0xb0>
+		s += 2, base = 16;
+  805413:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  805418:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80541f:	eb 2c                	jmp    80544d <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  805421:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  805425:	75 19                	jne    805440 <strtol+0xcf>
+  805427:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80542b:	0f b6 00             	movzbl (%rax),%eax
+  80542e:	3c 30                	cmp    $0x30,%al
+  805430:	75 0e                	jne    805440 <strtol+0xcf>
+		s++, base = 8;
+  805432:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  805437:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80543e:	eb 0d                	jmp    80544d <strtol+0xdc>
+	else if (base == 0)
+  805440:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  805444:	75 07                	jne    80544d <strtol+0xdc>
+		base = 10;
+  805446:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  80544d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805451:	0f b6 00             	movzbl (%rax),%eax
+  805454:	3c 2f                	cmp    $0x2f,%al
+  805456:	7e 1d                	jle    805475 <strtol+0x104>
+  805458:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80545c:	0f b6 00             	movzbl (%rax),%eax
+  80545f:	3c 39                	cmp    $0x39,%al
+  805461:	7f 12                	jg     805475 <strtol+0x104>
+			dig = *s - '0';
+  805463:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805467:	0f b6 00             	movzbl (%rax),%eax
+  80546a:	0f be c0             	movsbl %al,%eax
+  80546d:	83 e8 30             	sub    $0x30,%eax
+  805470:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805473:	eb 4e                	jmp    8054c3 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  805475:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805479:	0f b6 00             	movzbl (%rax),%eax
+  80547c:	3c 60                	cmp    $0x60,%al
+  80547e:	7e 1d                	jle    80549d <strtol+0x12c>
+  805480:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805484:	0f b6 00             	movzbl (%rax),%eax
+  805487:	3c 7a                	cmp    $0x7a,%al
+  805489:	7f 12                	jg     80549d <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  80548b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80548f:	0f b6 00             	movzbl (%rax),%eax
+  805492:	0f be c0             	movsbl %al,%eax
+  805495:	83 e8 57             	sub    $0x57,%eax
+  805498:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80549b:	eb 26                	jmp    8054c3 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  80549d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054a1:	0f b6 00             	movzbl (%rax),%eax
+  8054a4:	3c 40                	cmp    $0x40,%al
+  8054a6:	7e 47                	jle    8054ef <strtol+0x17e>
+  8054a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054ac:	0f b6 00             	movzbl (%rax),%eax
+  8054af:	3c 5a                	cmp    $0x5a,%al
+  8054b1:	7f 3c                	jg     8054ef <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  8054b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054b7:	0f b6 00             	movzbl (%rax),%eax
+  8054ba:	0f be c0             	movsbl %al,%eax
+  8054bd:	83 e8 37             	sub    $0x37,%eax
+  8054c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  8054c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054c6:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8054c9:	7d 23                	jge    8054ee <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  8054cb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8054d0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8054d3:	48 98                	cltq
+  8054d5:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8054da:	48 89 c2             	mov    %rax,%rdx
+  8054dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054e0:	48 98                	cltq
+  8054e2:	48 01 d0             	add    %rdx,%rax
+  8054e5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  8054e9:	e9 5f ff ff ff       	jmp    80544d <strtol+0xdc>
+			break;
+  8054ee:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8054ef:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8054f4:	74 0b                	je     805501 <strtol+0x190>
+		*endptr = (char *) s;
+  8054f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054fa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8054fe:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  805501:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805505:	74 09                	je     805510 <strtol+0x19f>
+  805507:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80550b:	48 f7 d8             	neg    %rax
+  80550e:	eb 04                	jmp    805514 <strtol+0x1a3>
+  805510:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  805514:	c9                   	leave
+  805515:	c3                   	ret
+
+0000000000805516 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  805516:	55                   	push   %rbp
+  805517:	48 89 e5             	mov    %rsp,%rbp
+  80551a:	53                   	push   %rbx
+  80551b:	48 83 ec 30          	sub    $0x30,%rsp
+  80551f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80551f <strstr+0x9>
+  805526:	49 bb 11 2b 00 00 00 	movabs $0x2b11,%r11
+  80552d:	00 00 00 
+  805530:	4c 01 db             	add    %r11,%rbx
+  805533:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  805537:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  80553b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80553f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  805543:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  805547:	0f b6 00             	movzbl (%rax),%eax
+  80554a:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  80554d:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  805551:	75 06                	jne    805559 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  805553:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805557:	eb 73                	jmp    8055cc <strstr+0xb6>
+
+	len = strlen(str);
+  805559:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80555d:	48 89 c7             	mov    %rax,%rdi
+  805560:	48 b8 73 cc ff ff ff 	movabs $0xffffffffffffcc73,%rax
+  805567:	ff ff ff 
+  80556a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80556e:	ff d0                	call   *%rax
+  805570:	48 98                	cltq
+  805572:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  805576:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80557a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80557e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805582:	0f b6 00             	movzbl (%rax),%eax
+  805585:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  805588:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  80558c:	75 07                	jne    805595 <strstr+0x7f>
+				return (char *) 0;
+  80558e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805593:	eb 37                	jmp    8055cc <strstr+0xb6>
+		} while (sc != c);
+  805595:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  805599:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  80559c:	75 d8                	jne    805576 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  80559e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8055a2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8055a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8055aa:	48 89 ce             	mov    %rcx,%rsi
+  8055ad:	48 89 c7             	mov    %rax,%rdi
+  8055b0:	48 b8 27 cf ff ff ff 	movabs $0xffffffffffffcf27,%rax
+  8055b7:	ff ff ff 
+  8055ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055be:	ff d0                	call   *%rax
+  8055c0:	85 c0                	test   %eax,%eax
+  8055c2:	75 b2                	jne    805576 <strstr+0x60>
+
+	return (char *) (in - 1);
+  8055c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8055c8:	48 83 e8 01          	sub    $0x1,%rax
+}
+  8055cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055d0:	c9                   	leave
+  8055d1:	c3                   	ret
+
+00000000008055d2 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8055d2:	55                   	push   %rbp
+  8055d3:	48 89 e5             	mov    %rsp,%rbp
+  8055d6:	41 57                	push   %r15
+  8055d8:	53                   	push   %rbx
+  8055d9:	48 83 ec 30          	sub    $0x30,%rsp
+  8055dd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055dd <ipc_recv+0xb>
+  8055e4:	49 bb 53 2a 00 00 00 	movabs $0x2a53,%r11
+  8055eb:	00 00 00 
+  8055ee:	4c 01 db             	add    %r11,%rbx
+  8055f1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8055f5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8055f9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8055fd:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805602:	75 0e                	jne    805612 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805604:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80560b:	00 00 00 
+  80560e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  805612:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805616:	48 89 c7             	mov    %rax,%rdi
+  805619:	49 89 df             	mov    %rbx,%r15
+  80561c:	48 b8 e5 88 ff ff ff 	movabs $0xffffffffffff88e5,%rax
+  805623:	ff ff ff 
+  805626:	48 01 d8             	add    %rbx,%rax
+  805629:	ff d0                	call   *%rax
+  80562b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  80562e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805633:	74 2a                	je     80565f <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805635:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805639:	75 19                	jne    805654 <ipc_recv+0x82>
+  80563b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805642:	ff ff ff 
+  805645:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805649:	48 8b 00             	mov    (%rax),%rax
+  80564c:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805652:	eb 05                	jmp    805659 <ipc_recv+0x87>
+  805654:	b8 00 00 00 00       	mov    $0x0,%eax
+  805659:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80565d:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80565f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805664:	74 2a                	je     805690 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805666:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80566a:	75 19                	jne    805685 <ipc_recv+0xb3>
+  80566c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805673:	ff ff ff 
+  805676:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80567a:	48 8b 00             	mov    (%rax),%rax
+  80567d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805683:	eb 05                	jmp    80568a <ipc_recv+0xb8>
+  805685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80568a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80568e:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805690:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805694:	74 05                	je     80569b <ipc_recv+0xc9>
+		return res;
+  805696:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805699:	eb 17                	jmp    8056b2 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  80569b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8056a2:	ff ff ff 
+  8056a5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8056a9:	48 8b 00             	mov    (%rax),%rax
+  8056ac:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8056b2:	48 83 c4 30          	add    $0x30,%rsp
+  8056b6:	5b                   	pop    %rbx
+  8056b7:	41 5f                	pop    %r15
+  8056b9:	5d                   	pop    %rbp
+  8056ba:	c3                   	ret
+
+00000000008056bb <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8056bb:	55                   	push   %rbp
+  8056bc:	48 89 e5             	mov    %rsp,%rbp
+  8056bf:	41 57                	push   %r15
+  8056c1:	53                   	push   %rbx
+  8056c2:	48 83 ec 20          	sub    $0x20,%rsp
+  8056c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056c6 <ipc_send+0xb>
+  8056cd:	49 bb 6a 29 00 00 00 	movabs $0x296a,%r11
+  8056d4:	00 00 00 
+  8056d7:	4c 01 db             	add    %r11,%rbx
+  8056da:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8056dd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8056e0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8056e4:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8056e7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8056ec:	75 0e                	jne    8056fc <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8056ee:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8056f5:	00 00 00 
+  8056f8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8056fc:	90                   	nop
+  8056fd:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805700:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805703:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805707:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80570a:	89 c7                	mov    %eax,%edi
+  80570c:	49 89 df             	mov    %rbx,%r15
+  80570f:	48 b8 7b 88 ff ff ff 	movabs $0xffffffffffff887b,%rax
+  805716:	ff ff ff 
+  805719:	48 01 d8             	add    %rbx,%rax
+  80571c:	ff d0                	call   *%rax
+  80571e:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805721:	74 da                	je     8056fd <ipc_send+0x42>
+		;
+}
+  805723:	90                   	nop
+  805724:	90                   	nop
+  805725:	48 83 c4 20          	add    $0x20,%rsp
+  805729:	5b                   	pop    %rbx
+  80572a:	41 5f                	pop    %r15
+  80572c:	5d                   	pop    %rbp
+  80572d:	c3                   	ret
+
+000000000080572e <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  80572e:	55                   	push   %rbp
+  80572f:	48 89 e5             	mov    %rsp,%rbp
+  805732:	41 57                	push   %r15
+  805734:	53                   	push   %rbx
+  805735:	48 83 ec 40          	sub    $0x40,%rsp
+  805739:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805739 <ipc_call+0xb>
+  805740:	49 bb f7 28 00 00 00 	movabs $0x28f7,%r11
+  805747:	00 00 00 
+  80574a:	4c 01 db             	add    %r11,%rbx
+  80574d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805750:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805753:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805757:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80575a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80575e:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805762:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805767:	75 0e                	jne    805777 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805769:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805770:	00 00 00 
+  805773:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805777:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80577c:	75 0e                	jne    80578c <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80577e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805785:	00 00 00 
+  805788:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80578c:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80578f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805793:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805796:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80579a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80579d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8057a3:	49 89 f8             	mov    %rdi,%r8
+  8057a6:	89 c7                	mov    %eax,%edi
+  8057a8:	49 89 df             	mov    %rbx,%r15
+  8057ab:	48 b8 3e 89 ff ff ff 	movabs $0xffffffffffff893e,%rax
+  8057b2:	ff ff ff 
+  8057b5:	48 01 d8             	add    %rbx,%rax
+  8057b8:	ff d0                	call   *%rax
+  8057ba:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8057bd:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8057c2:	74 2a                	je     8057ee <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8057c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057c8:	75 19                	jne    8057e3 <ipc_call+0xb5>
+  8057ca:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8057d1:	ff ff ff 
+  8057d4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8057d8:	48 8b 00             	mov    (%rax),%rax
+  8057db:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8057e1:	eb 05                	jmp    8057e8 <ipc_call+0xba>
+  8057e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057e8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8057ec:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8057ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057f2:	74 05                	je     8057f9 <ipc_call+0xcb>
+		return r;
+  8057f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057f7:	eb 17                	jmp    805810 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8057f9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805800:	ff ff ff 
+  805803:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805807:	48 8b 00             	mov    (%rax),%rax
+  80580a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805810:	48 83 c4 40          	add    $0x40,%rsp
+  805814:	5b                   	pop    %rbx
+  805815:	41 5f                	pop    %r15
+  805817:	5d                   	pop    %rbp
+  805818:	c3                   	ret
+
+0000000000805819 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805819:	55                   	push   %rbp
+  80581a:	48 89 e5             	mov    %rsp,%rbp
+  80581d:	41 57                	push   %r15
+  80581f:	53                   	push   %rbx
+  805820:	48 83 ec 70          	sub    $0x70,%rsp
+  805824:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805824 <ipc_callw+0xb>
+  80582b:	49 bb 0c 28 00 00 00 	movabs $0x280c,%r11
+  805832:	00 00 00 
+  805835:	4c 01 db             	add    %r11,%rbx
+  805838:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  80583b:	89 75 98             	mov    %esi,-0x68(%rbp)
+  80583e:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805842:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805846:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  80584b:	76 0a                	jbe    805857 <ipc_callw+0x3e>
+		return -E_INVAL;
+  80584d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805852:	e9 b7 00 00 00       	jmp    80590e <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805857:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80585b:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80585f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805863:	48 89 ce             	mov    %rcx,%rsi
+  805866:	48 89 c7             	mov    %rax,%rdi
+  805869:	49 89 df             	mov    %rbx,%r15
+  80586c:	48 b8 e7 d0 ff ff ff 	movabs $0xffffffffffffd0e7,%rax
+  805873:	ff ff ff 
+  805876:	48 01 d8             	add    %rbx,%rax
+  805879:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  80587b:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805882:	00 
+  805883:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805887:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80588b:	48 01 d0             	add    %rdx,%rax
+  80588e:	48 83 e8 01          	sub    $0x1,%rax
+  805892:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805896:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80589a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80589f:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8058a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058a7:	48 29 d0             	sub    %rdx,%rax
+  8058aa:	48 c1 e8 03          	shr    $0x3,%rax
+  8058ae:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  8058b2:	89 c1                	mov    %eax,%ecx
+  8058b4:	8b 75 98             	mov    -0x68(%rbp),%esi
+  8058b7:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  8058bb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8058be:	49 89 d1             	mov    %rdx,%r9
+  8058c1:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8058c8:	00 00 00 
+  8058cb:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8058d2:	00 00 00 
+  8058d5:	89 c7                	mov    %eax,%edi
+  8058d7:	49 89 df             	mov    %rbx,%r15
+  8058da:	48 b8 3e 89 ff ff ff 	movabs $0xffffffffffff893e,%rax
+  8058e1:	ff ff ff 
+  8058e4:	48 01 d8             	add    %rbx,%rax
+  8058e7:	ff d0                	call   *%rax
+  8058e9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8058ec:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8058f0:	74 05                	je     8058f7 <ipc_callw+0xde>
+		return r;
+  8058f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058f5:	eb 17                	jmp    80590e <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8058f7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8058fe:	ff ff ff 
+  805901:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805905:	48 8b 00             	mov    (%rax),%rax
+  805908:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80590e:	48 83 c4 70          	add    $0x70,%rsp
+  805912:	5b                   	pop    %rbx
+  805913:	41 5f                	pop    %r15
+  805915:	5d                   	pop    %rbp
+  805916:	c3                   	ret
+
+0000000000805917 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805917:	55                   	push   %rbp
+  805918:	48 89 e5             	mov    %rsp,%rbp
+  80591b:	41 57                	push   %r15
+  80591d:	53                   	push   %rbx
+  80591e:	48 83 ec 40          	sub    $0x40,%rsp
+  805922:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805922 <ipc_callv+0xb>
+  805929:	49 bb 0e 27 00 00 00 	movabs $0x270e,%r11
+  805930:	00 00 00 
+  805933:	4c 01 db             	add    %r11,%rbx
+  805936:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805939:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  80593c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805940:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805943:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805947:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  80594b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805952:	00 00 00 
+  805955:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805959:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80595d:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805961:	74 11                	je     805974 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805963:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805967:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  80596b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80596e:	c1 e0 14             	shl    $0x14,%eax
+  805971:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805974:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805978:	74 14                	je     80598e <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  80597a:	8b 45 20             	mov    0x20(%rbp),%eax
+  80597d:	83 e8 01             	sub    $0x1,%eax
+  805980:	48 63 d0             	movslq %eax,%rdx
+  805983:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805987:	48 09 d0             	or     %rdx,%rax
+  80598a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  80598e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805991:	c1 e0 10             	shl    $0x10,%eax
+  805994:	0b 45 10             	or     0x10(%rbp),%eax
+  805997:	89 c1                	mov    %eax,%ecx
+  805999:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80599c:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8059a0:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8059a4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8059a8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8059ab:	4d 89 c1             	mov    %r8,%r9
+  8059ae:	49 89 f8             	mov    %rdi,%r8
+  8059b1:	89 c7                	mov    %eax,%edi
+  8059b3:	49 89 df             	mov    %rbx,%r15
+  8059b6:	48 b8 3e 89 ff ff ff 	movabs $0xffffffffffff893e,%rax
+  8059bd:	ff ff ff 
+  8059c0:	48 01 d8             	add    %rbx,%rax
+  8059c3:	ff d0                	call   *%rax
+  8059c5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8059c8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8059cc:	74 05                	je     8059d3 <ipc_callv+0xbc>
+		return r;
+  8059ce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8059d1:	eb 17                	jmp    8059ea <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8059d3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8059da:	ff ff ff 
+  8059dd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059e1:	48 8b 00             	mov    (%rax),%rax
+  8059e4:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8059ea:	48 83 c4 40          	add    $0x40,%rsp
+  8059ee:	5b                   	pop    %rbx
+  8059ef:	41 5f                	pop    %r15
+  8059f1:	5d                   	pop    %rbp
+  8059f2:	c3                   	ret
+
+00000000008059f3 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8059f3:	55                   	push   %rbp
+  8059f4:	48 89 e5             	mov    %rsp,%rbp
+  8059f7:	41 57                	push   %r15
+  8059f9:	53                   	push   %rbx
+  8059fa:	48 83 ec 40          	sub    $0x40,%rsp
+  8059fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059fe <ipc_reply_recv+0xb>
+  805a05:	49 bb 32 26 00 00 00 	movabs $0x2632,%r11
+  805a0c:	00 00 00 
+  805a0f:	4c 01 db             	add    %r11,%rbx
+  805a12:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805a15:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805a18:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805a1c:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805a1f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805a23:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805a27:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805a2c:	75 0e                	jne    805a3c <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805a2e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a35:	00 00 00 
+  805a38:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805a3c:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805a41:	75 0e                	jne    805a51 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805a43:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a4a:	00 00 00 
+  805a4d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805a51:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805a54:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805a58:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805a5c:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805a5f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805a63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a66:	4d 89 c1             	mov    %r8,%r9
+  805a69:	49 89 f8             	mov    %rdi,%r8
+  805a6c:	89 c7                	mov    %eax,%edi
+  805a6e:	49 89 df             	mov    %rbx,%r15
+  805a71:	48 b8 b2 89 ff ff ff 	movabs $0xffffffffffff89b2,%rax
+  805a78:	ff ff ff 
+  805a7b:	48 01 d8             	add    %rbx,%rax
+  805a7e:	ff d0                	call   *%rax
+  805a80:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805a83:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805a88:	74 2a                	je     805ab4 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805a8a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a8e:	75 19                	jne    805aa9 <ipc_reply_recv+0xb6>
+  805a90:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a97:	ff ff ff 
+  805a9a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a9e:	48 8b 00             	mov    (%rax),%rax
+  805aa1:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805aa7:	eb 05                	jmp    805aae <ipc_reply_recv+0xbb>
+  805aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805ab2:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805ab4:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805ab9:	74 2a                	je     805ae5 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805abb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805abf:	75 19                	jne    805ada <ipc_reply_recv+0xe7>
+  805ac1:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ac8:	ff ff ff 
+  805acb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805acf:	48 8b 00             	mov    (%rax),%rax
+  805ad2:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805ad8:	eb 05                	jmp    805adf <ipc_reply_recv+0xec>
+  805ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  805adf:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805ae3:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805ae5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ae9:	74 05                	je     805af0 <ipc_reply_recv+0xfd>
+		return r;
+  805aeb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805aee:	eb 17                	jmp    805b07 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805af0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805af7:	ff ff ff 
+  805afa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805afe:	48 8b 00             	mov    (%rax),%rax
+  805b01:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805b07:	48 83 c4 40          	add    $0x40,%rsp
+  805b0b:	5b                   	pop    %rbx
+  805b0c:	41 5f                	pop    %r15
+  805b0e:	5d                   	pop    %rbp
+  805b0f:	c3                   	ret
+
+0000000000805b10 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805b10:	55                   	push   %rbp
+  805b11:	48 89 e5             	mov    %rsp,%rbp
+  805b14:	41 57                	push   %r15
+  805b16:	53                   	push   %rbx
+  805b17:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805b1e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b1e <ipc_window_batch+0xe>
+  805b25:	49 bb 12 25 00 00 00 	movabs $0x2512,%r11
+  805b2c:	00 00 00 
+  805b2f:	4c 01 db             	add    %r11,%rbx
+  805b32:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805b38:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805b3f:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805b45:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805b4b:	e9 15 01 00 00       	jmp    805c65 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805b50:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805b56:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805b59:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805b60:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b63:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b66:	39 c2                	cmp    %eax,%edx
+  805b68:	0f 4e c2             	cmovle %edx,%eax
+  805b6b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805b6e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805b75:	eb 6b                	jmp    805be2 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805b77:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b7a:	48 98                	cltq
+  805b7c:	48 c1 e0 05          	shl    $0x5,%rax
+  805b80:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805b84:	48 01 e8             	add    %rbp,%rax
+  805b87:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805b8d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805b93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b96:	c1 e0 0c             	shl    $0xc,%eax
+  805b99:	48 63 d0             	movslq %eax,%rdx
+  805b9c:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805ba3:	48 01 c2             	add    %rax,%rdx
+  805ba6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ba9:	48 98                	cltq
+  805bab:	48 c1 e0 05          	shl    $0x5,%rax
+  805baf:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805bb3:	48 01 e8             	add    %rbp,%rax
+  805bb6:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805bbc:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805bbf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bc2:	48 98                	cltq
+  805bc4:	48 c1 e0 05          	shl    $0x5,%rax
+  805bc8:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805bcc:	48 01 e8             	add    %rbp,%rax
+  805bcf:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805bd6:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805bdc:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805bde:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805be2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805be5:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805be8:	7c 8d                	jl     805b77 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805bea:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805bf1:	74 27                	je     805c1a <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805bf3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805bf6:	48 63 d0             	movslq %eax,%rdx
+  805bf9:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805c00:	48 89 d6             	mov    %rdx,%rsi
+  805c03:	48 89 c7             	mov    %rax,%rdi
+  805c06:	49 89 df             	mov    %rbx,%r15
+  805c09:	48 b8 55 8c ff ff ff 	movabs $0xffffffffffff8c55,%rax
+  805c10:	ff ff ff 
+  805c13:	48 01 d8             	add    %rbx,%rax
+  805c16:	ff d0                	call   *%rax
+  805c18:	eb 25                	jmp    805c3f <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805c1a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c1d:	48 63 d0             	movslq %eax,%rdx
+  805c20:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805c27:	48 89 d6             	mov    %rdx,%rsi
+  805c2a:	48 89 c7             	mov    %rax,%rdi
+  805c2d:	49 89 df             	mov    %rbx,%r15
+  805c30:	48 b8 b3 8c ff ff ff 	movabs $0xffffffffffff8cb3,%rax
+  805c37:	ff ff ff 
+  805c3a:	48 01 d8             	add    %rbx,%rax
+  805c3d:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805c3f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805c42:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805c46:	79 05                	jns    805c4d <ipc_window_batch+0x13d>
+			return r;
+  805c48:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c4b:	eb 2a                	jmp    805c77 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805c4d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c50:	c1 e0 0c             	shl    $0xc,%eax
+  805c53:	48 98                	cltq
+  805c55:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805c5c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c5f:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805c65:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805c6c:	0f 8f de fe ff ff    	jg     805b50 <ipc_window_batch+0x40>
+	}
+	return 0;
+  805c72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c77:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805c7e:	5b                   	pop    %rbx
+  805c7f:	41 5f                	pop    %r15
+  805c81:	5d                   	pop    %rbp
+  805c82:	c3                   	ret
+
+0000000000805c83 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805c83:	55                   	push   %rbp
+  805c84:	48 89 e5             	mov    %rsp,%rbp
+  805c87:	48 83 ec 10          	sub    $0x10,%rsp
+  805c8b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805c8b <ipc_map_window+0x8>
+  805c92:	49 bb a5 23 00 00 00 	movabs $0x23a5,%r11
+  805c99:	00 00 00 
+  805c9c:	4c 01 d8             	add    %r11,%rax
+  805c9f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805ca3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805ca6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805ca9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805cad:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805cb2:	bf 01 00 00 00       	mov    $0x1,%edi
+  805cb7:	49 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%r8
+  805cbe:	ff ff ff 
+  805cc1:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805cc5:	ff d0                	call   *%rax
+}
+  805cc7:	c9                   	leave
+  805cc8:	c3                   	ret
+
+0000000000805cc9 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805cc9:	55                   	push   %rbp
+  805cca:	48 89 e5             	mov    %rsp,%rbp
+  805ccd:	48 83 ec 10          	sub    $0x10,%rsp
+  805cd1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805cd1 <ipc_unmap_window+0x8>
+  805cd8:	49 bb 5f 23 00 00 00 	movabs $0x235f,%r11
+  805cdf:	00 00 00 
+  805ce2:	4c 01 d8             	add    %r11,%rax
+  805ce5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805ce9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805cec:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805cef:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805cf3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cfd:	49 b8 e0 da ff ff ff 	movabs $0xffffffffffffdae0,%r8
+  805d04:	ff ff ff 
+  805d07:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805d0b:	ff d0                	call   *%rax
+}
+  805d0d:	c9                   	leave
+  805d0e:	c3                   	ret
+
+0000000000805d0f <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805d0f:	55                   	push   %rbp
+  805d10:	48 89 e5             	mov    %rsp,%rbp
+  805d13:	48 83 ec 18          	sub    $0x18,%rsp
+  805d17:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d17 <ipc_find_env+0x8>
+  805d1e:	49 bb 19 23 00 00 00 	movabs $0x2319,%r11
+  805d25:	00 00 00 
+  805d28:	4c 01 d8             	add    %r11,%rax
+  805d2b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805d2e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805d35:	eb 57                	jmp    805d8e <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805d37:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805d3e:	ff ff ff 
+  805d41:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805d45:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805d48:	48 63 d2             	movslq %edx,%rdx
+  805d4b:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805d52:	48 01 ca             	add    %rcx,%rdx
+  805d55:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805d5c:	8b 12                	mov    (%rdx),%edx
+  805d5e:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805d61:	75 27                	jne    805d8a <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805d63:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805d6a:	ff ff ff 
+  805d6d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805d71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d74:	48 98                	cltq
+  805d76:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  805d7d:	48 01 d0             	add    %rdx,%rax
+  805d80:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805d86:	8b 00                	mov    (%rax),%eax
+  805d88:	eb 12                	jmp    805d9c <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  805d8a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805d8e:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805d95:	7e a0                	jle    805d37 <ipc_find_env+0x28>
+	}
+	return 0;
+  805d97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d9c:	c9                   	leave
+  805d9d:	c3                   	ret
+
+0000000000805d9e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805d9e:	55                   	push   %rbp
+  805d9f:	48 89 e5             	mov    %rsp,%rbp
+  805da2:	48 83 ec 18          	sub    $0x18,%rsp
+  805da6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805da6 <pageref+0x8>
+  805dad:	49 bb 8a 22 00 00 00 	movabs $0x228a,%r11
+  805db4:	00 00 00 
+  805db7:	4c 01 d8             	add    %r11,%rax
+  805dba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  805dbe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805dc2:	48 89 d1             	mov    %rdx,%rcx
+  805dc5:	48 c1 e9 15          	shr    $0x15,%rcx
+  805dc9:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  805dd0:	ff ff ff 
+  805dd3:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805dd7:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805ddb:	83 e2 01             	and    $0x1,%edx
+  805dde:	48 85 d2             	test   %rdx,%rdx
+  805de1:	75 07                	jne    805dea <pageref+0x4c>
+		return 0;
+  805de3:	b8 00 00 00 00       	mov    $0x0,%eax
+  805de8:	eb 64                	jmp    805e4e <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  805dea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805dee:	48 89 d1             	mov    %rdx,%rcx
+  805df1:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805df5:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  805dfc:	ff ff ff 
+  805dff:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805e03:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805e07:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  805e0b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805e0f:	83 e2 01             	and    $0x1,%edx
+  805e12:	48 85 d2             	test   %rdx,%rdx
+  805e15:	75 07                	jne    805e1e <pageref+0x80>
+		return 0;
+  805e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e1c:	eb 30                	jmp    805e4e <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  805e1e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805e22:	48 c1 ea 0c          	shr    $0xc,%rdx
+  805e26:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  805e2d:	ff ff ff 
+  805e30:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  805e34:	48 89 d0             	mov    %rdx,%rax
+  805e37:	48 01 c0             	add    %rax,%rax
+  805e3a:	48 01 d0             	add    %rdx,%rax
+  805e3d:	48 c1 e0 03          	shl    $0x3,%rax
+  805e41:	48 01 c8             	add    %rcx,%rax
+  805e44:	48 83 c0 08          	add    $0x8,%rax
+  805e48:	0f b7 00             	movzwl (%rax),%eax
+  805e4b:	0f b7 c0             	movzwl %ax,%eax
+}
+  805e4e:	c9                   	leave
+  805e4f:	c3                   	ret
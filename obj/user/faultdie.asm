@@ -0,0 +1,9480 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 fc 00 00 00       	call   80013d <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <handler+0xb>
+  800055:	49 bb ea 7f 00 00 00 	movabs $0x7fea,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	void *addr = (void*)utf->utf_fault_va;
+  800066:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80006a:	48 8b 00             	mov    (%rax),%rax
+  80006d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  800071:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800075:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800079:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80007c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80007f:	83 e0 07             	and    $0x7,%eax
+  800082:	89 c2                	mov    %eax,%edx
+  800084:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800088:	48 89 c6             	mov    %rax,%rsi
+  80008b:	48 b8 18 e0 ff ff ff 	movabs $0xffffffffffffe018,%rax
+  800092:	ff ff ff 
+  800095:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800099:	48 89 c7             	mov    %rax,%rdi
+  80009c:	49 89 df             	mov    %rbx,%r15
+  80009f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a4:	48 b9 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%rcx
+  8000ab:	ff ff ff 
+  8000ae:	48 01 d9             	add    %rbx,%rcx
+  8000b1:	ff d1                	call   *%rcx
+	sys_env_destroy(sys_getenvid());
+  8000b3:	49 89 df             	mov    %rbx,%r15
+  8000b6:	48 b8 62 9d ff ff ff 	movabs $0xffffffffffff9d62,%rax
+  8000bd:	ff ff ff 
+  8000c0:	48 01 d8             	add    %rbx,%rax
+  8000c3:	ff d0                	call   *%rax
+  8000c5:	89 c7                	mov    %eax,%edi
+  8000c7:	49 89 df             	mov    %rbx,%r15
+  8000ca:	48 b8 06 9d ff ff ff 	movabs $0xffffffffffff9d06,%rax
+  8000d1:	ff ff ff 
+  8000d4:	48 01 d8             	add    %rbx,%rax
+  8000d7:	ff d0                	call   *%rax
+}
+  8000d9:	90                   	nop
+  8000da:	48 83 c4 20          	add    $0x20,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5f                	pop    %r15
+  8000e1:	5d                   	pop    %rbp
+  8000e2:	c3                   	ret
+
+00000000008000e3 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e3:	55                   	push   %rbp
+  8000e4:	48 89 e5             	mov    %rsp,%rbp
+  8000e7:	41 57                	push   %r15
+  8000e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8000ed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8000ed <umain+0xa>
+  8000f4:	49 bb 4b 7f 00 00 00 	movabs $0x7f4b,%r11
+  8000fb:	00 00 00 
+  8000fe:	4c 01 d8             	add    %r11,%rax
+  800101:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800104:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	set_pgfault_handler(handler);
+  800108:	48 ba 0b 80 ff ff ff 	movabs $0xffffffffffff800b,%rdx
+  80010f:	ff ff ff 
+  800112:	48 8d 14 10          	lea    (%rax,%rdx,1),%rdx
+  800116:	48 89 d7             	mov    %rdx,%rdi
+  800119:	49 89 c7             	mov    %rax,%r15
+  80011c:	48 ba b4 a5 ff ff ff 	movabs $0xffffffffffffa5b4,%rdx
+  800123:	ff ff ff 
+  800126:	48 01 c2             	add    %rax,%rdx
+  800129:	ff d2                	call   *%rdx
+	*(int*)0xDeadBeef = 0;
+  80012b:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  800130:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800136:	90                   	nop
+  800137:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80013b:	c9                   	leave
+  80013c:	c3                   	ret
+
+000000000080013d <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80013d:	55                   	push   %rbp
+  80013e:	48 89 e5             	mov    %rsp,%rbp
+  800141:	41 57                	push   %r15
+  800143:	53                   	push   %rbx
+  800144:	48 83 ec 20          	sub    $0x20,%rsp
+  800148:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800148 <libmain+0xb>
+  80014f:	49 bb f0 7e 00 00 00 	movabs $0x7ef0,%r11
+  800156:	00 00 00 
+  800159:	4c 01 db             	add    %r11,%rbx
+  80015c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80015f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800163:	49 89 df             	mov    %rbx,%r15
+  800166:	48 b8 62 9d ff ff ff 	movabs $0xffffffffffff9d62,%rax
+  80016d:	ff ff ff 
+  800170:	48 01 d8             	add    %rbx,%rax
+  800173:	ff d0                	call   *%rax
+  800175:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800178:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80017b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800180:	48 98                	cltq
+  800182:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800189:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  800190:	ff ff ff 
+  800193:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800197:	48 01 c2             	add    %rax,%rdx
+  80019a:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8001a1:	00 00 00 
+  8001a4:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001a8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8001ac:	7e 15                	jle    8001c3 <libmain+0x86>
+		binaryname = argv[0];
+  8001ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8001b2:	48 8b 00             	mov    (%rax),%rax
+  8001b5:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  8001bc:	00 00 00 
+  8001bf:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8001c3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8001c7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001ca:	48 89 d6             	mov    %rdx,%rsi
+  8001cd:	89 c7                	mov    %eax,%edi
+  8001cf:	49 89 df             	mov    %rbx,%r15
+  8001d2:	48 b8 ab 80 ff ff ff 	movabs $0xffffffffffff80ab,%rax
+  8001d9:	ff ff ff 
+  8001dc:	48 01 d8             	add    %rbx,%rax
+  8001df:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8001e1:	49 89 df             	mov    %rbx,%r15
+  8001e4:	48 b8 c5 81 ff ff ff 	movabs $0xffffffffffff81c5,%rax
+  8001eb:	ff ff ff 
+  8001ee:	48 01 d8             	add    %rbx,%rax
+  8001f1:	ff d0                	call   *%rax
+}
+  8001f3:	90                   	nop
+  8001f4:	48 83 c4 20          	add    $0x20,%rsp
+  8001f8:	5b                   	pop    %rbx
+  8001f9:	41 5f                	pop    %r15
+  8001fb:	5d                   	pop    %rbp
+  8001fc:	c3                   	ret
+
+00000000008001fd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001fd:	55                   	push   %rbp
+  8001fe:	48 89 e5             	mov    %rsp,%rbp
+  800201:	41 57                	push   %r15
+  800203:	53                   	push   %rbx
+  800204:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800204 <exit+0x7>
+  80020b:	49 bb 34 7e 00 00 00 	movabs $0x7e34,%r11
+  800212:	00 00 00 
+  800215:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800218:	49 89 df             	mov    %rbx,%r15
+  80021b:	48 b8 61 ab ff ff ff 	movabs $0xffffffffffffab61,%rax
+  800222:	ff ff ff 
+  800225:	48 01 d8             	add    %rbx,%rax
+  800228:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80022a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80022f:	49 89 df             	mov    %rbx,%r15
+  800232:	48 b8 06 9d ff ff ff 	movabs $0xffffffffffff9d06,%rax
+  800239:	ff ff ff 
+  80023c:	48 01 d8             	add    %rbx,%rax
+  80023f:	ff d0                	call   *%rax
+}
+  800241:	90                   	nop
+  800242:	5b                   	pop    %rbx
+  800243:	41 5f                	pop    %r15
+  800245:	5d                   	pop    %rbp
+  800246:	c3                   	ret
+
+0000000000800247 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800247:	55                   	push   %rbp
+  800248:	48 89 e5             	mov    %rsp,%rbp
+  80024b:	41 57                	push   %r15
+  80024d:	48 83 ec 18          	sub    $0x18,%rsp
+  800251:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800251 <putch+0xa>
+  800258:	49 bb e7 7d 00 00 00 	movabs $0x7de7,%r11
+  80025f:	00 00 00 
+  800262:	4c 01 d8             	add    %r11,%rax
+  800265:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800268:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80026c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800270:	8b 12                	mov    (%rdx),%edx
+  800272:	8d 72 01             	lea    0x1(%rdx),%esi
+  800275:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800279:	89 31                	mov    %esi,(%rcx)
+  80027b:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80027e:	89 ce                	mov    %ecx,%esi
+  800280:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800284:	48 63 d2             	movslq %edx,%rdx
+  800287:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80028c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800290:	8b 12                	mov    (%rdx),%edx
+  800292:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800298:	75 33                	jne    8002cd <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80029a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80029e:	8b 12                	mov    (%rdx),%edx
+  8002a0:	48 63 d2             	movslq %edx,%rdx
+  8002a3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8002a7:	48 83 c1 08          	add    $0x8,%rcx
+  8002ab:	48 89 d6             	mov    %rdx,%rsi
+  8002ae:	48 89 cf             	mov    %rcx,%rdi
+  8002b1:	49 89 c7             	mov    %rax,%r15
+  8002b4:	48 ba 53 9c ff ff ff 	movabs $0xffffffffffff9c53,%rdx
+  8002bb:	ff ff ff 
+  8002be:	48 01 c2             	add    %rax,%rdx
+  8002c1:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8002c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002c7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8002cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002d1:	8b 40 04             	mov    0x4(%rax),%eax
+  8002d4:	8d 50 01             	lea    0x1(%rax),%edx
+  8002d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002db:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8002de:	90                   	nop
+  8002df:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8002e3:	c9                   	leave
+  8002e4:	c3                   	ret
+
+00000000008002e5 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002e5:	55                   	push   %rbp
+  8002e6:	48 89 e5             	mov    %rsp,%rbp
+  8002e9:	41 57                	push   %r15
+  8002eb:	53                   	push   %rbx
+  8002ec:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8002f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8002f3 <vcprintf+0xe>
+  8002fa:	49 bb 45 7d 00 00 00 	movabs $0x7d45,%r11
+  800301:	00 00 00 
+  800304:	4c 01 db             	add    %r11,%rbx
+  800307:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80030e:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800315:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80031c:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800323:	48 8b 06             	mov    (%rsi),%rax
+  800326:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80032a:	48 89 01             	mov    %rax,(%rcx)
+  80032d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800331:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800335:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800339:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800340:	00 00 00 
+    b.cnt = 0;
+  800343:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80034a:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  80034d:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800354:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80035b:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800362:	48 89 c6             	mov    %rax,%rsi
+  800365:	48 b8 0f 82 ff ff ff 	movabs $0xffffffffffff820f,%rax
+  80036c:	ff ff ff 
+  80036f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800373:	48 89 c7             	mov    %rax,%rdi
+  800376:	49 89 df             	mov    %rbx,%r15
+  800379:	48 b8 d1 87 ff ff ff 	movabs $0xffffffffffff87d1,%rax
+  800380:	ff ff ff 
+  800383:	48 01 d8             	add    %rbx,%rax
+  800386:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800388:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80038e:	48 98                	cltq
+  800390:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800397:	48 83 c2 08          	add    $0x8,%rdx
+  80039b:	48 89 c6             	mov    %rax,%rsi
+  80039e:	48 89 d7             	mov    %rdx,%rdi
+  8003a1:	49 89 df             	mov    %rbx,%r15
+  8003a4:	48 b8 53 9c ff ff ff 	movabs $0xffffffffffff9c53,%rax
+  8003ab:	ff ff ff 
+  8003ae:	48 01 d8             	add    %rbx,%rax
+  8003b1:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8003b3:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8003b9:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8003c0:	5b                   	pop    %rbx
+  8003c1:	41 5f                	pop    %r15
+  8003c3:	5d                   	pop    %rbp
+  8003c4:	c3                   	ret
+
+00000000008003c5 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8003c5:	55                   	push   %rbp
+  8003c6:	48 89 e5             	mov    %rsp,%rbp
+  8003c9:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8003d0:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8003d0 <cprintf+0xb>
+  8003d7:	49 bb 68 7c 00 00 00 	movabs $0x7c68,%r11
+  8003de:	00 00 00 
+  8003e1:	4d 01 da             	add    %r11,%r10
+  8003e4:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8003eb:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8003f2:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8003f9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800400:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800407:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80040e:	84 c0                	test   %al,%al
+  800410:	74 20                	je     800432 <cprintf+0x6d>
+  800412:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800416:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80041a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80041e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800422:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800426:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80042a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80042e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800432:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800439:	00 00 00 
+  80043c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800443:	00 00 00 
+  800446:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80044a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800451:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800458:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  80045f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800466:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80046d:	48 8b 06             	mov    (%rsi),%rax
+  800470:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800474:	48 89 01             	mov    %rax,(%rcx)
+  800477:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80047b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80047f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800483:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80048a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800491:	48 89 d6             	mov    %rdx,%rsi
+  800494:	48 89 c7             	mov    %rax,%rdi
+  800497:	48 b8 ad 82 ff ff ff 	movabs $0xffffffffffff82ad,%rax
+  80049e:	ff ff ff 
+  8004a1:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8004a5:	ff d0                	call   *%rax
+  8004a7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8004ad:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8004b3:	c9                   	leave
+  8004b4:	c3                   	ret
+
+00000000008004b5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004b5:	55                   	push   %rbp
+  8004b6:	48 89 e5             	mov    %rsp,%rbp
+  8004b9:	53                   	push   %rbx
+  8004ba:	48 83 ec 38          	sub    $0x38,%rsp
+  8004be:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004be <printnum+0x9>
+  8004c5:	49 bb 7a 7b 00 00 00 	movabs $0x7b7a,%r11
+  8004cc:	00 00 00 
+  8004cf:	4c 01 db             	add    %r11,%rbx
+  8004d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8004d6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8004da:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8004de:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8004e1:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8004e5:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004e9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8004ec:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8004f0:	72 58                	jb     80054a <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004f2:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8004f5:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8004f8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8004fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8004ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800504:	48 f7 f6             	div    %rsi
+  800507:	49 89 c2             	mov    %rax,%r10
+  80050a:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80050d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800510:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800514:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800518:	41 89 c9             	mov    %ecx,%r9d
+  80051b:	41 89 f8             	mov    %edi,%r8d
+  80051e:	89 d1                	mov    %edx,%ecx
+  800520:	4c 89 d2             	mov    %r10,%rdx
+  800523:	48 89 c7             	mov    %rax,%rdi
+  800526:	48 b8 7d 84 ff ff ff 	movabs $0xffffffffffff847d,%rax
+  80052d:	ff ff ff 
+  800530:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800534:	ff d0                	call   *%rax
+  800536:	eb 1c                	jmp    800554 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800538:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80053c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80053f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800543:	48 89 d6             	mov    %rdx,%rsi
+  800546:	89 c7                	mov    %eax,%edi
+  800548:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80054a:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  80054e:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800552:	7f e4                	jg     800538 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800554:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800557:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80055b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800560:	48 f7 f1             	div    %rcx
+  800563:	48 b8 77 e1 ff ff ff 	movabs $0xffffffffffffe177,%rax
+  80056a:	ff ff ff 
+  80056d:	48 01 d8             	add    %rbx,%rax
+  800570:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800574:	0f be c0             	movsbl %al,%eax
+  800577:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80057b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80057f:	48 89 d6             	mov    %rdx,%rsi
+  800582:	89 c7                	mov    %eax,%edi
+  800584:	ff d1                	call   *%rcx
+}
+  800586:	90                   	nop
+  800587:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80058b:	c9                   	leave
+  80058c:	c3                   	ret
+
+000000000080058d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80058d:	55                   	push   %rbp
+  80058e:	48 89 e5             	mov    %rsp,%rbp
+  800591:	48 83 ec 20          	sub    $0x20,%rsp
+  800595:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800595 <getuint+0x8>
+  80059c:	49 bb a3 7a 00 00 00 	movabs $0x7aa3,%r11
+  8005a3:	00 00 00 
+  8005a6:	4c 01 d8             	add    %r11,%rax
+  8005a9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005ad:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8005b0:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8005b4:	7e 4f                	jle    800605 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8005b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ba:	8b 00                	mov    (%rax),%eax
+  8005bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8005bf:	77 24                	ja     8005e5 <getuint+0x58>
+  8005c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005c5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005cd:	8b 00                	mov    (%rax),%eax
+  8005cf:	89 c0                	mov    %eax,%eax
+  8005d1:	48 01 d0             	add    %rdx,%rax
+  8005d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005d8:	8b 12                	mov    (%rdx),%edx
+  8005da:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005e1:	89 0a                	mov    %ecx,(%rdx)
+  8005e3:	eb 14                	jmp    8005f9 <getuint+0x6c>
+  8005e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005e9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005ed:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005f1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005f5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005f9:	48 8b 00             	mov    (%rax),%rax
+  8005fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800600:	e9 9d 00 00 00       	jmp    8006a2 <getuint+0x115>
+	else if (lflag)
+  800605:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800609:	74 4c                	je     800657 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  80060b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80060f:	8b 00                	mov    (%rax),%eax
+  800611:	83 f8 2f             	cmp    $0x2f,%eax
+  800614:	77 24                	ja     80063a <getuint+0xad>
+  800616:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80061a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80061e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800622:	8b 00                	mov    (%rax),%eax
+  800624:	89 c0                	mov    %eax,%eax
+  800626:	48 01 d0             	add    %rdx,%rax
+  800629:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80062d:	8b 12                	mov    (%rdx),%edx
+  80062f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800632:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800636:	89 0a                	mov    %ecx,(%rdx)
+  800638:	eb 14                	jmp    80064e <getuint+0xc1>
+  80063a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80063e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800642:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800646:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80064a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80064e:	48 8b 00             	mov    (%rax),%rax
+  800651:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800655:	eb 4b                	jmp    8006a2 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800657:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80065b:	8b 00                	mov    (%rax),%eax
+  80065d:	83 f8 2f             	cmp    $0x2f,%eax
+  800660:	77 24                	ja     800686 <getuint+0xf9>
+  800662:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800666:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80066a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80066e:	8b 00                	mov    (%rax),%eax
+  800670:	89 c0                	mov    %eax,%eax
+  800672:	48 01 d0             	add    %rdx,%rax
+  800675:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800679:	8b 12                	mov    (%rdx),%edx
+  80067b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80067e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800682:	89 0a                	mov    %ecx,(%rdx)
+  800684:	eb 14                	jmp    80069a <getuint+0x10d>
+  800686:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80068a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80068e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800692:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800696:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80069a:	8b 00                	mov    (%rax),%eax
+  80069c:	89 c0                	mov    %eax,%eax
+  80069e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8006a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8006a6:	c9                   	leave
+  8006a7:	c3                   	ret
+
+00000000008006a8 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8006a8:	55                   	push   %rbp
+  8006a9:	48 89 e5             	mov    %rsp,%rbp
+  8006ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8006b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006b0 <printfloat+0x8>
+  8006b7:	49 bb 88 79 00 00 00 	movabs $0x7988,%r11
+  8006be:	00 00 00 
+  8006c1:	4c 01 d8             	add    %r11,%rax
+  8006c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8006cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8006d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d4:	48 85 c0             	test   %rax,%rax
+  8006d7:	79 12                	jns    8006eb <printfloat+0x43>
+		putch('-',putdat);
+  8006d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006e1:	48 89 c6             	mov    %rax,%rsi
+  8006e4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8006e9:	ff d2                	call   *%rdx
+	
+}
+  8006eb:	90                   	nop
+  8006ec:	c9                   	leave
+  8006ed:	c3                   	ret
+
+00000000008006ee <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8006ee:	55                   	push   %rbp
+  8006ef:	48 89 e5             	mov    %rsp,%rbp
+  8006f2:	48 83 ec 20          	sub    $0x20,%rsp
+  8006f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006f6 <getint+0x8>
+  8006fd:	49 bb 42 79 00 00 00 	movabs $0x7942,%r11
+  800704:	00 00 00 
+  800707:	4c 01 d8             	add    %r11,%rax
+  80070a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80070e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800711:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800715:	7e 4f                	jle    800766 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800717:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80071b:	8b 00                	mov    (%rax),%eax
+  80071d:	83 f8 2f             	cmp    $0x2f,%eax
+  800720:	77 24                	ja     800746 <getint+0x58>
+  800722:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800726:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80072a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80072e:	8b 00                	mov    (%rax),%eax
+  800730:	89 c0                	mov    %eax,%eax
+  800732:	48 01 d0             	add    %rdx,%rax
+  800735:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800739:	8b 12                	mov    (%rdx),%edx
+  80073b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80073e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800742:	89 0a                	mov    %ecx,(%rdx)
+  800744:	eb 14                	jmp    80075a <getint+0x6c>
+  800746:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80074a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80074e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800752:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800756:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80075a:	48 8b 00             	mov    (%rax),%rax
+  80075d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800761:	e9 9d 00 00 00       	jmp    800803 <getint+0x115>
+	else if (lflag)
+  800766:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80076a:	74 4c                	je     8007b8 <getint+0xca>
+		x=va_arg(*ap, long);
+  80076c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800770:	8b 00                	mov    (%rax),%eax
+  800772:	83 f8 2f             	cmp    $0x2f,%eax
+  800775:	77 24                	ja     80079b <getint+0xad>
+  800777:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80077b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80077f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800783:	8b 00                	mov    (%rax),%eax
+  800785:	89 c0                	mov    %eax,%eax
+  800787:	48 01 d0             	add    %rdx,%rax
+  80078a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80078e:	8b 12                	mov    (%rdx),%edx
+  800790:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800793:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800797:	89 0a                	mov    %ecx,(%rdx)
+  800799:	eb 14                	jmp    8007af <getint+0xc1>
+  80079b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80079f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007a3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007ab:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007af:	48 8b 00             	mov    (%rax),%rax
+  8007b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007b6:	eb 4b                	jmp    800803 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8007b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007bc:	8b 00                	mov    (%rax),%eax
+  8007be:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c1:	77 24                	ja     8007e7 <getint+0xf9>
+  8007c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007cf:	8b 00                	mov    (%rax),%eax
+  8007d1:	89 c0                	mov    %eax,%eax
+  8007d3:	48 01 d0             	add    %rdx,%rax
+  8007d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007da:	8b 12                	mov    (%rdx),%edx
+  8007dc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007e3:	89 0a                	mov    %ecx,(%rdx)
+  8007e5:	eb 14                	jmp    8007fb <getint+0x10d>
+  8007e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007eb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007ef:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007f7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007fb:	8b 00                	mov    (%rax),%eax
+  8007fd:	48 98                	cltq
+  8007ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800803:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800807:	c9                   	leave
+  800808:	c3                   	ret
+
+0000000000800809 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800809:	55                   	push   %rbp
+  80080a:	48 89 e5             	mov    %rsp,%rbp
+  80080d:	41 57                	push   %r15
+  80080f:	41 55                	push   %r13
+  800811:	41 54                	push   %r12
+  800813:	53                   	push   %rbx
+  800814:	48 83 ec 60          	sub    $0x60,%rsp
+  800818:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800818 <vprintfmt+0xf>
+  80081f:	49 bb 20 78 00 00 00 	movabs $0x7820,%r11
+  800826:	00 00 00 
+  800829:	4d 01 dc             	add    %r11,%r12
+  80082c:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800830:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800834:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800838:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  80083c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800843:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800847:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  80084b:	48 8b 06             	mov    (%rsi),%rax
+  80084e:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800852:	48 89 01             	mov    %rax,(%rcx)
+  800855:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800859:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80085d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800861:	eb 17                	jmp    80087a <vprintfmt+0x71>
+			if (ch == '\0')
+  800863:	85 db                	test   %ebx,%ebx
+  800865:	0f 84 97 05 00 00    	je     800e02 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  80086b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80086f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800873:	48 89 c6             	mov    %rax,%rsi
+  800876:	89 df                	mov    %ebx,%edi
+  800878:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80087a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80087e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800882:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800886:	0f b6 00             	movzbl (%rax),%eax
+  800889:	0f b6 d8             	movzbl %al,%ebx
+  80088c:	83 fb 25             	cmp    $0x25,%ebx
+  80088f:	75 d2                	jne    800863 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800891:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800895:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  80089c:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8008a3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  8008aa:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  8008b1:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8008b5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008b9:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8008bd:	0f b6 00             	movzbl (%rax),%eax
+  8008c0:	0f b6 d8             	movzbl %al,%ebx
+  8008c3:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8008c6:	83 f8 55             	cmp    $0x55,%eax
+  8008c9:	0f 87 00 05 00 00    	ja     800dcf <vprintfmt+0x5c6>
+  8008cf:	89 c0                	mov    %eax,%eax
+  8008d1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8008d8:	00 
+  8008d9:	48 8d 05 f8 58 00 00 	lea    0x58f8(%rip),%rax        # 8061d8 <.LC18+0xc>
+  8008e0:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  8008e4:	48 8d 15 ed 58 00 00 	lea    0x58ed(%rip),%rdx        # 8061d8 <.LC18+0xc>
+  8008eb:	48 01 d0             	add    %rdx,%rax
+  8008ee:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  8008f0:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  8008f4:	eb bb                	jmp    8008b1 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  8008f6:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  8008fa:	eb b5                	jmp    8008b1 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  8008fc:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800903:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800906:	89 d0                	mov    %edx,%eax
+  800908:	c1 e0 02             	shl    $0x2,%eax
+  80090b:	01 d0                	add    %edx,%eax
+  80090d:	01 c0                	add    %eax,%eax
+  80090f:	01 d8                	add    %ebx,%eax
+  800911:	83 e8 30             	sub    $0x30,%eax
+  800914:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800917:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80091b:	0f b6 00             	movzbl (%rax),%eax
+  80091e:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800921:	83 fb 2f             	cmp    $0x2f,%ebx
+  800924:	7e 60                	jle    800986 <vprintfmt+0x17d>
+  800926:	83 fb 39             	cmp    $0x39,%ebx
+  800929:	7f 5b                	jg     800986 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  80092b:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800930:	eb d1                	jmp    800903 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800932:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800935:	83 f8 2f             	cmp    $0x2f,%eax
+  800938:	77 17                	ja     800951 <vprintfmt+0x148>
+  80093a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80093e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800941:	89 d2                	mov    %edx,%edx
+  800943:	48 01 d0             	add    %rdx,%rax
+  800946:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800949:	83 c2 08             	add    $0x8,%edx
+  80094c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80094f:	eb 0c                	jmp    80095d <vprintfmt+0x154>
+  800951:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800955:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800959:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80095d:	8b 00                	mov    (%rax),%eax
+  80095f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800962:	eb 23                	jmp    800987 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800964:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800968:	0f 89 43 ff ff ff    	jns    8008b1 <vprintfmt+0xa8>
+				width = 0;
+  80096e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800975:	e9 37 ff ff ff       	jmp    8008b1 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  80097a:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800981:	e9 2b ff ff ff       	jmp    8008b1 <vprintfmt+0xa8>
+			goto process_precision;
+  800986:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800987:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80098b:	0f 89 20 ff ff ff    	jns    8008b1 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800991:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800994:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800997:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  80099e:	e9 0e ff ff ff       	jmp    8008b1 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8009a3:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  8009a7:	e9 05 ff ff ff       	jmp    8008b1 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  8009ac:	83 fb 39             	cmp    $0x39,%ebx
+  8009af:	7f 0b                	jg     8009bc <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  8009b1:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  8009b4:	c1 e0 08             	shl    $0x8,%eax
+  8009b7:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8009ba:	eb 21                	jmp    8009dd <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  8009bc:	83 fb 60             	cmp    $0x60,%ebx
+  8009bf:	7e 10                	jle    8009d1 <vprintfmt+0x1c8>
+  8009c1:	83 fb 66             	cmp    $0x66,%ebx
+  8009c4:	7f 0b                	jg     8009d1 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  8009c6:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  8009c9:	c1 e0 08             	shl    $0x8,%eax
+  8009cc:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8009cf:	eb 0c                	jmp    8009dd <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  8009d1:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  8009d8:	e9 04 01 00 00       	jmp    800ae1 <vprintfmt+0x2d8>
+  8009dd:	e9 ff 00 00 00       	jmp    800ae1 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8009e2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8009e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e8:	77 17                	ja     800a01 <vprintfmt+0x1f8>
+  8009ea:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8009ee:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8009f1:	89 d2                	mov    %edx,%edx
+  8009f3:	48 01 d0             	add    %rdx,%rax
+  8009f6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8009f9:	83 c2 08             	add    $0x8,%edx
+  8009fc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8009ff:	eb 0c                	jmp    800a0d <vprintfmt+0x204>
+  800a01:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a05:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a09:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800a0d:	8b 00                	mov    (%rax),%eax
+  800a0f:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800a13:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800a17:	48 89 d6             	mov    %rdx,%rsi
+  800a1a:	89 c7                	mov    %eax,%edi
+  800a1c:	ff d1                	call   *%rcx
+			break;
+  800a1e:	e9 da 03 00 00       	jmp    800dfd <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800a23:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a26:	83 f8 2f             	cmp    $0x2f,%eax
+  800a29:	77 17                	ja     800a42 <vprintfmt+0x239>
+  800a2b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a2f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a32:	89 d2                	mov    %edx,%edx
+  800a34:	48 01 d0             	add    %rdx,%rax
+  800a37:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a3a:	83 c2 08             	add    $0x8,%edx
+  800a3d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800a40:	eb 0c                	jmp    800a4e <vprintfmt+0x245>
+  800a42:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a46:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a4a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800a4e:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800a50:	85 db                	test   %ebx,%ebx
+  800a52:	79 02                	jns    800a56 <vprintfmt+0x24d>
+				err = -err;
+  800a54:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a56:	83 fb 15             	cmp    $0x15,%ebx
+  800a59:	7f 19                	jg     800a74 <vprintfmt+0x26b>
+  800a5b:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  800a62:	00 00 00 
+  800a65:	48 63 c3             	movslq %ebx,%rax
+  800a68:	4c 01 e2             	add    %r12,%rdx
+  800a6b:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800a6f:	4d 85 ed             	test   %r13,%r13
+  800a72:	75 36                	jne    800aaa <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800a74:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800a78:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a7c:	89 d9                	mov    %ebx,%ecx
+  800a7e:	48 ba 88 e1 ff ff ff 	movabs $0xffffffffffffe188,%rdx
+  800a85:	ff ff ff 
+  800a88:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800a8c:	48 89 c7             	mov    %rax,%rdi
+  800a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a94:	49 b8 d8 8d ff ff ff 	movabs $0xffffffffffff8dd8,%r8
+  800a9b:	ff ff ff 
+  800a9e:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800aa2:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800aa5:	e9 53 03 00 00       	jmp    800dfd <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800aaa:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800aae:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ab2:	4c 89 e9             	mov    %r13,%rcx
+  800ab5:	48 ba 91 e1 ff ff ff 	movabs $0xffffffffffffe191,%rdx
+  800abc:	ff ff ff 
+  800abf:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800ac3:	48 89 c7             	mov    %rax,%rdi
+  800ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acb:	49 b8 d8 8d ff ff ff 	movabs $0xffffffffffff8dd8,%r8
+  800ad2:	ff ff ff 
+  800ad5:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800ad9:	41 ff d0             	call   *%r8
+			break;
+  800adc:	e9 1c 03 00 00       	jmp    800dfd <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800ae1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ae4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae7:	77 17                	ja     800b00 <vprintfmt+0x2f7>
+  800ae9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800aed:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800af0:	89 d2                	mov    %edx,%edx
+  800af2:	48 01 d0             	add    %rdx,%rax
+  800af5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800af8:	83 c2 08             	add    $0x8,%edx
+  800afb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800afe:	eb 0c                	jmp    800b0c <vprintfmt+0x303>
+  800b00:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b04:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b08:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b0c:	4c 8b 28             	mov    (%rax),%r13
+  800b0f:	4d 85 ed             	test   %r13,%r13
+  800b12:	75 0e                	jne    800b22 <vprintfmt+0x319>
+				p = "(null)";
+  800b14:	48 b8 94 e1 ff ff ff 	movabs $0xffffffffffffe194,%rax
+  800b1b:	ff ff ff 
+  800b1e:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800b22:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b26:	0f 8e 84 00 00 00    	jle    800bb0 <vprintfmt+0x3a7>
+  800b2c:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800b30:	74 7e                	je     800bb0 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b32:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800b35:	48 98                	cltq
+  800b37:	48 89 c6             	mov    %rax,%rsi
+  800b3a:	4c 89 ef             	mov    %r13,%rdi
+  800b3d:	4d 89 e7             	mov    %r12,%r15
+  800b40:	48 b8 fd 90 ff ff ff 	movabs $0xffffffffffff90fd,%rax
+  800b47:	ff ff ff 
+  800b4a:	4c 01 e0             	add    %r12,%rax
+  800b4d:	ff d0                	call   *%rax
+  800b4f:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800b52:	eb 17                	jmp    800b6b <vprintfmt+0x362>
+					putch(padc, putdat);
+  800b54:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800b58:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800b5c:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800b60:	48 89 d6             	mov    %rdx,%rsi
+  800b63:	89 c7                	mov    %eax,%edi
+  800b65:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b67:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800b6b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b6f:	7f e3                	jg     800b54 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b71:	eb 3d                	jmp    800bb0 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b73:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800b77:	74 1e                	je     800b97 <vprintfmt+0x38e>
+  800b79:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b7c:	7e 05                	jle    800b83 <vprintfmt+0x37a>
+  800b7e:	83 fb 7e             	cmp    $0x7e,%ebx
+  800b81:	7e 14                	jle    800b97 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800b83:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800b87:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800b8b:	48 89 c6             	mov    %rax,%rsi
+  800b8e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b93:	ff d2                	call   *%rdx
+  800b95:	eb 15                	jmp    800bac <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800b97:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800b9a:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800b9d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ba1:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ba5:	48 89 c6             	mov    %rax,%rsi
+  800ba8:	89 cf                	mov    %ecx,%edi
+  800baa:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bac:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800bb0:	4c 89 e8             	mov    %r13,%rax
+  800bb3:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800bb7:	0f b6 00             	movzbl (%rax),%eax
+  800bba:	0f be d8             	movsbl %al,%ebx
+  800bbd:	85 db                	test   %ebx,%ebx
+  800bbf:	74 28                	je     800be9 <vprintfmt+0x3e0>
+  800bc1:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800bc5:	78 ac                	js     800b73 <vprintfmt+0x36a>
+  800bc7:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800bcb:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800bcf:	79 a2                	jns    800b73 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800bd1:	eb 16                	jmp    800be9 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800bd3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800bd7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800bdb:	48 89 c6             	mov    %rax,%rsi
+  800bde:	bf 20 00 00 00       	mov    $0x20,%edi
+  800be3:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800be5:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800be9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800bed:	7f e4                	jg     800bd3 <vprintfmt+0x3ca>
+			break;
+  800bef:	e9 09 02 00 00       	jmp    800dfd <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800bf4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800bf8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bfc:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c00:	0f b6 00             	movzbl (%rax),%eax
+  800c03:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800c06:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800c07:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c0a:	0f 8e ac fd ff ff    	jle    8009bc <vprintfmt+0x1b3>
+  800c10:	e9 97 fd ff ff       	jmp    8009ac <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800c15:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800c19:	be 03 00 00 00       	mov    $0x3,%esi
+  800c1e:	48 89 c7             	mov    %rax,%rdi
+  800c21:	48 b8 b6 86 ff ff ff 	movabs $0xffffffffffff86b6,%rax
+  800c28:	ff ff ff 
+  800c2b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800c2f:	ff d0                	call   *%rax
+  800c31:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800c35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c39:	48 85 c0             	test   %rax,%rax
+  800c3c:	79 1d                	jns    800c5b <vprintfmt+0x452>
+				putch('-', putdat);
+  800c3e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c42:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c46:	48 89 c6             	mov    %rax,%rsi
+  800c49:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c4e:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800c50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c54:	48 f7 d8             	neg    %rax
+  800c57:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800c5b:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800c62:	e9 de 00 00 00       	jmp    800d45 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800c67:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800c6b:	be 03 00 00 00       	mov    $0x3,%esi
+  800c70:	48 89 c7             	mov    %rax,%rdi
+  800c73:	48 b8 55 85 ff ff ff 	movabs $0xffffffffffff8555,%rax
+  800c7a:	ff ff ff 
+  800c7d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800c81:	ff d0                	call   *%rax
+  800c83:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800c87:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800c8e:	e9 b2 00 00 00       	jmp    800d45 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800c93:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800c97:	be 03 00 00 00       	mov    $0x3,%esi
+  800c9c:	48 89 c7             	mov    %rax,%rdi
+  800c9f:	48 b8 55 85 ff ff ff 	movabs $0xffffffffffff8555,%rax
+  800ca6:	ff ff ff 
+  800ca9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800cad:	ff d0                	call   *%rax
+  800caf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800cb3:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800cba:	e9 86 00 00 00       	jmp    800d45 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800cbf:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cc3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800cc7:	48 89 c6             	mov    %rax,%rsi
+  800cca:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ccf:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800cd1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cd5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800cd9:	48 89 c6             	mov    %rax,%rsi
+  800cdc:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ce1:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800ce3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ce6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce9:	77 17                	ja     800d02 <vprintfmt+0x4f9>
+  800ceb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800cef:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cf2:	89 d2                	mov    %edx,%edx
+  800cf4:	48 01 d0             	add    %rdx,%rax
+  800cf7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cfa:	83 c2 08             	add    $0x8,%edx
+  800cfd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d00:	eb 0c                	jmp    800d0e <vprintfmt+0x505>
+  800d02:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d06:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d0a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d0e:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800d11:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800d15:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800d1c:	eb 27                	jmp    800d45 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800d1e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d22:	be 03 00 00 00       	mov    $0x3,%esi
+  800d27:	48 89 c7             	mov    %rax,%rdi
+  800d2a:	48 b8 55 85 ff ff ff 	movabs $0xffffffffffff8555,%rax
+  800d31:	ff ff ff 
+  800d34:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d38:	ff d0                	call   *%rax
+  800d3a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800d3e:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800d45:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800d4a:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800d4d:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800d50:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800d54:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800d58:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d5c:	45 89 c1             	mov    %r8d,%r9d
+  800d5f:	41 89 f8             	mov    %edi,%r8d
+  800d62:	48 89 c7             	mov    %rax,%rdi
+  800d65:	48 b8 7d 84 ff ff ff 	movabs $0xffffffffffff847d,%rax
+  800d6c:	ff ff ff 
+  800d6f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d73:	ff d0                	call   *%rax
+			break;
+  800d75:	e9 83 00 00 00       	jmp    800dfd <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800d7a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d7e:	be 03 00 00 00       	mov    $0x3,%esi
+  800d83:	48 89 c7             	mov    %rax,%rdi
+  800d86:	48 b8 55 85 ff ff ff 	movabs $0xffffffffffff8555,%rax
+  800d8d:	ff ff ff 
+  800d90:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d94:	ff d0                	call   *%rax
+  800d96:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800d9a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800d9e:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800da2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800da6:	48 89 ce             	mov    %rcx,%rsi
+  800da9:	48 89 c7             	mov    %rax,%rdi
+  800dac:	48 b8 70 86 ff ff ff 	movabs $0xffffffffffff8670,%rax
+  800db3:	ff ff ff 
+  800db6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800dba:	ff d0                	call   *%rax
+	
+			break;
+  800dbc:	eb 3f                	jmp    800dfd <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800dbe:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dc2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dc6:	48 89 c6             	mov    %rax,%rsi
+  800dc9:	89 df                	mov    %ebx,%edi
+  800dcb:	ff d2                	call   *%rdx
+			break;
+  800dcd:	eb 2e                	jmp    800dfd <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800dcf:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dd3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dd7:	48 89 c6             	mov    %rax,%rsi
+  800dda:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ddf:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800de1:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800de6:	eb 05                	jmp    800ded <vprintfmt+0x5e4>
+  800de8:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800ded:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800df1:	48 83 e8 01          	sub    $0x1,%rax
+  800df5:	0f b6 00             	movzbl (%rax),%eax
+  800df8:	3c 25                	cmp    $0x25,%al
+  800dfa:	75 ec                	jne    800de8 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800dfc:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800dfd:	e9 78 fa ff ff       	jmp    80087a <vprintfmt+0x71>
+				return;
+  800e02:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800e03:	48 83 c4 60          	add    $0x60,%rsp
+  800e07:	5b                   	pop    %rbx
+  800e08:	41 5c                	pop    %r12
+  800e0a:	41 5d                	pop    %r13
+  800e0c:	41 5f                	pop    %r15
+  800e0e:	5d                   	pop    %rbp
+  800e0f:	c3                   	ret
+
+0000000000800e10 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  800e10:	55                   	push   %rbp
+  800e11:	48 89 e5             	mov    %rsp,%rbp
+  800e14:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e1b:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800e1b <printfmt+0xb>
+  800e22:	49 bb 1d 72 00 00 00 	movabs $0x721d,%r11
+  800e29:	00 00 00 
+  800e2c:	4d 01 da             	add    %r11,%r10
+  800e2f:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e36:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800e3d:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e44:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e4b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e52:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e59:	84 c0                	test   %al,%al
+  800e5b:	74 20                	je     800e7d <printfmt+0x6d>
+  800e5d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e61:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e65:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e69:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e6d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e71:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e75:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e79:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800e7d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800e84:	00 00 00 
+  800e87:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800e8e:	00 00 00 
+  800e91:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e95:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800e9c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ea3:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800eaa:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800eb1:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800eb8:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800ebf:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800ec6:	48 89 c7             	mov    %rax,%rdi
+  800ec9:	48 b8 d1 87 ff ff ff 	movabs $0xffffffffffff87d1,%rax
+  800ed0:	ff ff ff 
+  800ed3:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800ed7:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800ed9:	90                   	nop
+  800eda:	c9                   	leave
+  800edb:	c3                   	ret
+
+0000000000800edc <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800edc:	55                   	push   %rbp
+  800edd:	48 89 e5             	mov    %rsp,%rbp
+  800ee0:	48 83 ec 10          	sub    $0x10,%rsp
+  800ee4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ee4 <sprintputch+0x8>
+  800eeb:	49 bb 54 71 00 00 00 	movabs $0x7154,%r11
+  800ef2:	00 00 00 
+  800ef5:	4c 01 d8             	add    %r11,%rax
+  800ef8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800efb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800eff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f03:	8b 40 10             	mov    0x10(%rax),%eax
+  800f06:	8d 50 01             	lea    0x1(%rax),%edx
+  800f09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f0d:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800f10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f14:	48 8b 10             	mov    (%rax),%rdx
+  800f17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f1b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f1f:	48 39 c2             	cmp    %rax,%rdx
+  800f22:	73 17                	jae    800f3b <sprintputch+0x5f>
+		*b->buf++ = ch;
+  800f24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f28:	48 8b 00             	mov    (%rax),%rax
+  800f2b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f2f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f33:	48 89 0a             	mov    %rcx,(%rdx)
+  800f36:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f39:	88 10                	mov    %dl,(%rax)
+}
+  800f3b:	90                   	nop
+  800f3c:	c9                   	leave
+  800f3d:	c3                   	ret
+
+0000000000800f3e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800f3e:	55                   	push   %rbp
+  800f3f:	48 89 e5             	mov    %rsp,%rbp
+  800f42:	53                   	push   %rbx
+  800f43:	48 83 ec 58          	sub    $0x58,%rsp
+  800f47:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800f47 <vsnprintf+0x9>
+  800f4e:	49 bb f1 70 00 00 00 	movabs $0x70f1,%r11
+  800f55:	00 00 00 
+  800f58:	4c 01 d8             	add    %r11,%rax
+  800f5b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  800f5f:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  800f62:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f66:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  800f6a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  800f6e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800f72:	48 8b 0e             	mov    (%rsi),%rcx
+  800f75:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  800f79:	48 89 0a             	mov    %rcx,(%rdx)
+  800f7c:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  800f80:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  800f84:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800f88:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800f8c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800f90:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  800f93:	48 63 d2             	movslq %edx,%rdx
+  800f96:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  800f9a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800f9e:	48 01 ca             	add    %rcx,%rdx
+  800fa1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800fa5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  800fac:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  800fb1:	74 06                	je     800fb9 <vsnprintf+0x7b>
+  800fb3:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  800fb7:	7f 07                	jg     800fc0 <vsnprintf+0x82>
+		return -E_INVAL;
+  800fb9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fbe:	eb 34                	jmp    800ff4 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  800fc0:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  800fc4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800fc8:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800fcc:	48 bf a4 8e ff ff ff 	movabs $0xffffffffffff8ea4,%rdi
+  800fd3:	ff ff ff 
+  800fd6:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  800fda:	49 b8 d1 87 ff ff ff 	movabs $0xffffffffffff87d1,%r8
+  800fe1:	ff ff ff 
+  800fe4:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  800fe8:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800fea:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800fee:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800ff1:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  800ff4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ff8:	c9                   	leave
+  800ff9:	c3                   	ret
+
+0000000000800ffa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ffa:	55                   	push   %rbp
+  800ffb:	48 89 e5             	mov    %rsp,%rbp
+  800ffe:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801005:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801005 <snprintf+0xb>
+  80100c:	49 bb 33 70 00 00 00 	movabs $0x7033,%r11
+  801013:	00 00 00 
+  801016:	4d 01 da             	add    %r11,%r10
+  801019:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801020:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801026:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80102d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801034:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80103b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801042:	84 c0                	test   %al,%al
+  801044:	74 20                	je     801066 <snprintf+0x6c>
+  801046:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80104a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80104e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801052:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801056:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80105a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80105e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801062:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801066:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80106d:	00 00 00 
+  801070:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801077:	00 00 00 
+  80107a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80107e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801085:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80108c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801093:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80109a:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8010a1:	48 8b 06             	mov    (%rsi),%rax
+  8010a4:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8010a8:	48 89 01             	mov    %rax,(%rcx)
+  8010ab:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8010af:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8010b3:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8010b7:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8010be:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8010c5:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8010cb:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8010d2:	48 89 c7             	mov    %rax,%rdi
+  8010d5:	48 b8 06 8f ff ff ff 	movabs $0xffffffffffff8f06,%rax
+  8010dc:	ff ff ff 
+  8010df:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8010e3:	ff d0                	call   *%rax
+  8010e5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8010eb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8010f1:	c9                   	leave
+  8010f2:	c3                   	ret
+
+00000000008010f3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8010f3:	55                   	push   %rbp
+  8010f4:	48 89 e5             	mov    %rsp,%rbp
+  8010f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8010fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8010fb <strlen+0x8>
+  801102:	49 bb 3d 6f 00 00 00 	movabs $0x6f3d,%r11
+  801109:	00 00 00 
+  80110c:	4c 01 d8             	add    %r11,%rax
+  80110f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801113:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80111a:	eb 09                	jmp    801125 <strlen+0x32>
+		n++;
+  80111c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801120:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801125:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801129:	0f b6 00             	movzbl (%rax),%eax
+  80112c:	84 c0                	test   %al,%al
+  80112e:	75 ec                	jne    80111c <strlen+0x29>
+	return n;
+  801130:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+0000000000801135 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801135:	55                   	push   %rbp
+  801136:	48 89 e5             	mov    %rsp,%rbp
+  801139:	48 83 ec 20          	sub    $0x20,%rsp
+  80113d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80113d <strnlen+0x8>
+  801144:	49 bb fb 6e 00 00 00 	movabs $0x6efb,%r11
+  80114b:	00 00 00 
+  80114e:	4c 01 d8             	add    %r11,%rax
+  801151:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801155:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801159:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801160:	eb 0e                	jmp    801170 <strnlen+0x3b>
+		n++;
+  801162:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801166:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80116b:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801170:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801175:	74 0b                	je     801182 <strnlen+0x4d>
+  801177:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80117b:	0f b6 00             	movzbl (%rax),%eax
+  80117e:	84 c0                	test   %al,%al
+  801180:	75 e0                	jne    801162 <strnlen+0x2d>
+	return n;
+  801182:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801185:	c9                   	leave
+  801186:	c3                   	ret
+
+0000000000801187 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801187:	55                   	push   %rbp
+  801188:	48 89 e5             	mov    %rsp,%rbp
+  80118b:	48 83 ec 20          	sub    $0x20,%rsp
+  80118f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80118f <strcpy+0x8>
+  801196:	49 bb a9 6e 00 00 00 	movabs $0x6ea9,%r11
+  80119d:	00 00 00 
+  8011a0:	4c 01 d8             	add    %r11,%rax
+  8011a3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011a7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8011ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8011b3:	90                   	nop
+  8011b4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011b8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8011bc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011c4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011cc:	0f b6 12             	movzbl (%rdx),%edx
+  8011cf:	88 10                	mov    %dl,(%rax)
+  8011d1:	0f b6 00             	movzbl (%rax),%eax
+  8011d4:	84 c0                	test   %al,%al
+  8011d6:	75 dc                	jne    8011b4 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8011d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8011dc:	c9                   	leave
+  8011dd:	c3                   	ret
+
+00000000008011de <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8011de:	55                   	push   %rbp
+  8011df:	48 89 e5             	mov    %rsp,%rbp
+  8011e2:	53                   	push   %rbx
+  8011e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8011e7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8011e7 <strcat+0x9>
+  8011ee:	49 bb 51 6e 00 00 00 	movabs $0x6e51,%r11
+  8011f5:	00 00 00 
+  8011f8:	4c 01 db             	add    %r11,%rbx
+  8011fb:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8011ff:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801203:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801207:	48 89 c7             	mov    %rax,%rdi
+  80120a:	48 b8 bb 90 ff ff ff 	movabs $0xffffffffffff90bb,%rax
+  801211:	ff ff ff 
+  801214:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801218:	ff d0                	call   *%rax
+  80121a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  80121d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801220:	48 63 d0             	movslq %eax,%rdx
+  801223:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801227:	48 01 c2             	add    %rax,%rdx
+  80122a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80122e:	48 89 c6             	mov    %rax,%rsi
+  801231:	48 89 d7             	mov    %rdx,%rdi
+  801234:	48 b8 4f 91 ff ff ff 	movabs $0xffffffffffff914f,%rax
+  80123b:	ff ff ff 
+  80123e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801242:	ff d0                	call   *%rax
+	return dst;
+  801244:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801248:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80124c:	c9                   	leave
+  80124d:	c3                   	ret
+
+000000000080124e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80124e:	55                   	push   %rbp
+  80124f:	48 89 e5             	mov    %rsp,%rbp
+  801252:	48 83 ec 28          	sub    $0x28,%rsp
+  801256:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801256 <strncpy+0x8>
+  80125d:	49 bb e2 6d 00 00 00 	movabs $0x6de2,%r11
+  801264:	00 00 00 
+  801267:	4c 01 d8             	add    %r11,%rax
+  80126a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80126e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801272:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801276:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80127a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80127e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801285:	00 
+  801286:	eb 2a                	jmp    8012b2 <strncpy+0x64>
+		*dst++ = *src;
+  801288:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80128c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801290:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801294:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801298:	0f b6 12             	movzbl (%rdx),%edx
+  80129b:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80129d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012a1:	0f b6 00             	movzbl (%rax),%eax
+  8012a4:	84 c0                	test   %al,%al
+  8012a6:	74 05                	je     8012ad <strncpy+0x5f>
+			src++;
+  8012a8:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8012ad:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8012b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012b6:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8012ba:	72 cc                	jb     801288 <strncpy+0x3a>
+	}
+	return ret;
+  8012bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8012c0:	c9                   	leave
+  8012c1:	c3                   	ret
+
+00000000008012c2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8012c2:	55                   	push   %rbp
+  8012c3:	48 89 e5             	mov    %rsp,%rbp
+  8012c6:	48 83 ec 28          	sub    $0x28,%rsp
+  8012ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012ca <strlcpy+0x8>
+  8012d1:	49 bb 6e 6d 00 00 00 	movabs $0x6d6e,%r11
+  8012d8:	00 00 00 
+  8012db:	4c 01 d8             	add    %r11,%rax
+  8012de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8012e6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8012ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8012f2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012f7:	74 3d                	je     801336 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8012f9:	eb 1d                	jmp    801318 <strlcpy+0x56>
+			*dst++ = *src++;
+  8012fb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012ff:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801303:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801307:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80130b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80130f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801313:	0f b6 12             	movzbl (%rdx),%edx
+  801316:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801318:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80131d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801322:	74 0b                	je     80132f <strlcpy+0x6d>
+  801324:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801328:	0f b6 00             	movzbl (%rax),%eax
+  80132b:	84 c0                	test   %al,%al
+  80132d:	75 cc                	jne    8012fb <strlcpy+0x39>
+		*dst = '\0';
+  80132f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801333:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801336:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80133a:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80133e:	c9                   	leave
+  80133f:	c3                   	ret
+
+0000000000801340 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801340:	55                   	push   %rbp
+  801341:	48 89 e5             	mov    %rsp,%rbp
+  801344:	48 83 ec 10          	sub    $0x10,%rsp
+  801348:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801348 <strcmp+0x8>
+  80134f:	49 bb f0 6c 00 00 00 	movabs $0x6cf0,%r11
+  801356:	00 00 00 
+  801359:	4c 01 d8             	add    %r11,%rax
+  80135c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801360:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801364:	eb 0a                	jmp    801370 <strcmp+0x30>
+		p++, q++;
+  801366:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80136b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801374:	0f b6 00             	movzbl (%rax),%eax
+  801377:	84 c0                	test   %al,%al
+  801379:	74 12                	je     80138d <strcmp+0x4d>
+  80137b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80137f:	0f b6 10             	movzbl (%rax),%edx
+  801382:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801386:	0f b6 00             	movzbl (%rax),%eax
+  801389:	38 c2                	cmp    %al,%dl
+  80138b:	74 d9                	je     801366 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80138d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801391:	0f b6 00             	movzbl (%rax),%eax
+  801394:	0f b6 d0             	movzbl %al,%edx
+  801397:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80139b:	0f b6 00             	movzbl (%rax),%eax
+  80139e:	0f b6 c0             	movzbl %al,%eax
+  8013a1:	29 c2                	sub    %eax,%edx
+  8013a3:	89 d0                	mov    %edx,%eax
+}
+  8013a5:	c9                   	leave
+  8013a6:	c3                   	ret
+
+00000000008013a7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8013a7:	55                   	push   %rbp
+  8013a8:	48 89 e5             	mov    %rsp,%rbp
+  8013ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8013af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013af <strncmp+0x8>
+  8013b6:	49 bb 89 6c 00 00 00 	movabs $0x6c89,%r11
+  8013bd:	00 00 00 
+  8013c0:	4c 01 d8             	add    %r11,%rax
+  8013c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8013c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8013cb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8013cf:	eb 0f                	jmp    8013e0 <strncmp+0x39>
+		n--, p++, q++;
+  8013d1:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8013d6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013db:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8013e0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8013e5:	74 1d                	je     801404 <strncmp+0x5d>
+  8013e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013eb:	0f b6 00             	movzbl (%rax),%eax
+  8013ee:	84 c0                	test   %al,%al
+  8013f0:	74 12                	je     801404 <strncmp+0x5d>
+  8013f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013f6:	0f b6 10             	movzbl (%rax),%edx
+  8013f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013fd:	0f b6 00             	movzbl (%rax),%eax
+  801400:	38 c2                	cmp    %al,%dl
+  801402:	74 cd                	je     8013d1 <strncmp+0x2a>
+	if (n == 0)
+  801404:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801409:	75 07                	jne    801412 <strncmp+0x6b>
+		return 0;
+  80140b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801410:	eb 16                	jmp    801428 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801412:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801416:	0f b6 00             	movzbl (%rax),%eax
+  801419:	0f b6 d0             	movzbl %al,%edx
+  80141c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801420:	0f b6 00             	movzbl (%rax),%eax
+  801423:	0f b6 c0             	movzbl %al,%eax
+  801426:	29 c2                	sub    %eax,%edx
+}
+  801428:	89 d0                	mov    %edx,%eax
+  80142a:	c9                   	leave
+  80142b:	c3                   	ret
+
+000000000080142c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80142c:	55                   	push   %rbp
+  80142d:	48 89 e5             	mov    %rsp,%rbp
+  801430:	48 83 ec 10          	sub    $0x10,%rsp
+  801434:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801434 <strchr+0x8>
+  80143b:	49 bb 04 6c 00 00 00 	movabs $0x6c04,%r11
+  801442:	00 00 00 
+  801445:	4c 01 d8             	add    %r11,%rax
+  801448:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80144c:	89 f0                	mov    %esi,%eax
+  80144e:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801451:	eb 17                	jmp    80146a <strchr+0x3e>
+		if (*s == c)
+  801453:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801457:	0f b6 00             	movzbl (%rax),%eax
+  80145a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80145d:	75 06                	jne    801465 <strchr+0x39>
+			return (char *) s;
+  80145f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801463:	eb 15                	jmp    80147a <strchr+0x4e>
+	for (; *s; s++)
+  801465:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80146a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80146e:	0f b6 00             	movzbl (%rax),%eax
+  801471:	84 c0                	test   %al,%al
+  801473:	75 de                	jne    801453 <strchr+0x27>
+	return 0;
+  801475:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80147a:	c9                   	leave
+  80147b:	c3                   	ret
+
+000000000080147c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80147c:	55                   	push   %rbp
+  80147d:	48 89 e5             	mov    %rsp,%rbp
+  801480:	48 83 ec 10          	sub    $0x10,%rsp
+  801484:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801484 <strfind+0x8>
+  80148b:	49 bb b4 6b 00 00 00 	movabs $0x6bb4,%r11
+  801492:	00 00 00 
+  801495:	4c 01 d8             	add    %r11,%rax
+  801498:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80149c:	89 f0                	mov    %esi,%eax
+  80149e:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8014a1:	eb 11                	jmp    8014b4 <strfind+0x38>
+		if (*s == c)
+  8014a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a7:	0f b6 00             	movzbl (%rax),%eax
+  8014aa:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8014ad:	74 12                	je     8014c1 <strfind+0x45>
+	for (; *s; s++)
+  8014af:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014b8:	0f b6 00             	movzbl (%rax),%eax
+  8014bb:	84 c0                	test   %al,%al
+  8014bd:	75 e4                	jne    8014a3 <strfind+0x27>
+  8014bf:	eb 01                	jmp    8014c2 <strfind+0x46>
+			break;
+  8014c1:	90                   	nop
+	return (char *) s;
+  8014c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8014c6:	c9                   	leave
+  8014c7:	c3                   	ret
+
+00000000008014c8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8014c8:	55                   	push   %rbp
+  8014c9:	48 89 e5             	mov    %rsp,%rbp
+  8014cc:	48 83 ec 18          	sub    $0x18,%rsp
+  8014d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014d0 <memset+0x8>
+  8014d7:	49 bb 68 6b 00 00 00 	movabs $0x6b68,%r11
+  8014de:	00 00 00 
+  8014e1:	4c 01 d8             	add    %r11,%rax
+  8014e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014e8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8014eb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8014ef:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014f4:	75 06                	jne    8014fc <memset+0x34>
+		return v;
+  8014f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014fa:	eb 69                	jmp    801565 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8014fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801500:	83 e0 03             	and    $0x3,%eax
+  801503:	48 85 c0             	test   %rax,%rax
+  801506:	75 48                	jne    801550 <memset+0x88>
+  801508:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80150c:	83 e0 03             	and    $0x3,%eax
+  80150f:	48 85 c0             	test   %rax,%rax
+  801512:	75 3c                	jne    801550 <memset+0x88>
+		c &= 0xFF;
+  801514:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  80151b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80151e:	c1 e0 18             	shl    $0x18,%eax
+  801521:	89 c2                	mov    %eax,%edx
+  801523:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801526:	c1 e0 10             	shl    $0x10,%eax
+  801529:	09 c2                	or     %eax,%edx
+  80152b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80152e:	c1 e0 08             	shl    $0x8,%eax
+  801531:	09 d0                	or     %edx,%eax
+  801533:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801536:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80153a:	48 c1 e8 02          	shr    $0x2,%rax
+  80153e:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801541:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801545:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801548:	48 89 d7             	mov    %rdx,%rdi
+  80154b:	fc                   	cld
+  80154c:	f3 ab                	rep stos %eax,%es:(%rdi)
+  80154e:	eb 11                	jmp    801561 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801550:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801554:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801557:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80155b:	48 89 d7             	mov    %rdx,%rdi
+  80155e:	fc                   	cld
+  80155f:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801561:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801565:	c9                   	leave
+  801566:	c3                   	ret
+
+0000000000801567 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801567:	55                   	push   %rbp
+  801568:	48 89 e5             	mov    %rsp,%rbp
+  80156b:	48 83 ec 28          	sub    $0x28,%rsp
+  80156f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80156f <memmove+0x8>
+  801576:	49 bb c9 6a 00 00 00 	movabs $0x6ac9,%r11
+  80157d:	00 00 00 
+  801580:	4c 01 d8             	add    %r11,%rax
+  801583:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801587:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80158b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80158f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801593:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801597:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80159b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80159f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a3:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8015a7:	0f 83 88 00 00 00    	jae    801635 <memmove+0xce>
+  8015ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015b5:	48 01 d0             	add    %rdx,%rax
+  8015b8:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8015bc:	73 77                	jae    801635 <memmove+0xce>
+		s += n;
+  8015be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015c2:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8015c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015ca:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8015ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015d2:	83 e0 03             	and    $0x3,%eax
+  8015d5:	48 85 c0             	test   %rax,%rax
+  8015d8:	75 3b                	jne    801615 <memmove+0xae>
+  8015da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015de:	83 e0 03             	and    $0x3,%eax
+  8015e1:	48 85 c0             	test   %rax,%rax
+  8015e4:	75 2f                	jne    801615 <memmove+0xae>
+  8015e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015ea:	83 e0 03             	and    $0x3,%eax
+  8015ed:	48 85 c0             	test   %rax,%rax
+  8015f0:	75 23                	jne    801615 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8015f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015f6:	48 83 e8 04          	sub    $0x4,%rax
+  8015fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015fe:	48 83 ea 04          	sub    $0x4,%rdx
+  801602:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801606:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80160a:	48 89 c7             	mov    %rax,%rdi
+  80160d:	48 89 d6             	mov    %rdx,%rsi
+  801610:	fd                   	std
+  801611:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801613:	eb 1d                	jmp    801632 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801615:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801619:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80161d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801621:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801625:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801629:	48 89 d7             	mov    %rdx,%rdi
+  80162c:	48 89 c1             	mov    %rax,%rcx
+  80162f:	fd                   	std
+  801630:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801632:	fc                   	cld
+  801633:	eb 57                	jmp    80168c <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801635:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801639:	83 e0 03             	and    $0x3,%eax
+  80163c:	48 85 c0             	test   %rax,%rax
+  80163f:	75 36                	jne    801677 <memmove+0x110>
+  801641:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801645:	83 e0 03             	and    $0x3,%eax
+  801648:	48 85 c0             	test   %rax,%rax
+  80164b:	75 2a                	jne    801677 <memmove+0x110>
+  80164d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801651:	83 e0 03             	and    $0x3,%eax
+  801654:	48 85 c0             	test   %rax,%rax
+  801657:	75 1e                	jne    801677 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801659:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80165d:	48 c1 e8 02          	shr    $0x2,%rax
+  801661:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801664:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801668:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80166c:	48 89 c7             	mov    %rax,%rdi
+  80166f:	48 89 d6             	mov    %rdx,%rsi
+  801672:	fc                   	cld
+  801673:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801675:	eb 15                	jmp    80168c <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801677:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80167b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80167f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801683:	48 89 c7             	mov    %rax,%rdi
+  801686:	48 89 d6             	mov    %rdx,%rsi
+  801689:	fc                   	cld
+  80168a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  80168c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801690:	c9                   	leave
+  801691:	c3                   	ret
+
+0000000000801692 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801692:	55                   	push   %rbp
+  801693:	48 89 e5             	mov    %rsp,%rbp
+  801696:	48 83 ec 18          	sub    $0x18,%rsp
+  80169a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80169a <memcpy+0x8>
+  8016a1:	49 bb 9e 69 00 00 00 	movabs $0x699e,%r11
+  8016a8:	00 00 00 
+  8016ab:	4c 01 d8             	add    %r11,%rax
+  8016ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8016b6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8016ba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016be:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8016c2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8016c6:	48 89 cf             	mov    %rcx,%rdi
+  8016c9:	48 b9 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rcx
+  8016d0:	ff ff ff 
+  8016d3:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8016d7:	ff d0                	call   *%rax
+}
+  8016d9:	c9                   	leave
+  8016da:	c3                   	ret
+
+00000000008016db <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8016db:	55                   	push   %rbp
+  8016dc:	48 89 e5             	mov    %rsp,%rbp
+  8016df:	48 83 ec 28          	sub    $0x28,%rsp
+  8016e3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016e3 <memcmp+0x8>
+  8016ea:	49 bb 55 69 00 00 00 	movabs $0x6955,%r11
+  8016f1:	00 00 00 
+  8016f4:	4c 01 d8             	add    %r11,%rax
+  8016f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016ff:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801703:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801707:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  80170b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80170f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801713:	eb 34                	jmp    801749 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801715:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801719:	0f b6 10             	movzbl (%rax),%edx
+  80171c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801720:	0f b6 00             	movzbl (%rax),%eax
+  801723:	38 c2                	cmp    %al,%dl
+  801725:	74 18                	je     80173f <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801727:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172b:	0f b6 00             	movzbl (%rax),%eax
+  80172e:	0f b6 d0             	movzbl %al,%edx
+  801731:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801735:	0f b6 00             	movzbl (%rax),%eax
+  801738:	0f b6 c0             	movzbl %al,%eax
+  80173b:	29 c2                	sub    %eax,%edx
+  80173d:	eb 20                	jmp    80175f <memcmp+0x84>
+		s1++, s2++;
+  80173f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801744:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801749:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80174d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801751:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801755:	48 85 c0             	test   %rax,%rax
+  801758:	75 bb                	jne    801715 <memcmp+0x3a>
+	}
+
+	return 0;
+  80175a:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80175f:	89 d0                	mov    %edx,%eax
+  801761:	c9                   	leave
+  801762:	c3                   	ret
+
+0000000000801763 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801763:	55                   	push   %rbp
+  801764:	48 89 e5             	mov    %rsp,%rbp
+  801767:	48 83 ec 28          	sub    $0x28,%rsp
+  80176b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80176b <memfind+0x8>
+  801772:	49 bb cd 68 00 00 00 	movabs $0x68cd,%r11
+  801779:	00 00 00 
+  80177c:	4c 01 d8             	add    %r11,%rax
+  80177f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801783:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801786:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  80178a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80178e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801792:	48 01 d0             	add    %rdx,%rax
+  801795:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801799:	eb 13                	jmp    8017ae <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80179b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80179f:	0f b6 00             	movzbl (%rax),%eax
+  8017a2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8017a5:	38 d0                	cmp    %dl,%al
+  8017a7:	74 11                	je     8017ba <memfind+0x57>
+	for (; s < ends; s++)
+  8017a9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b2:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8017b6:	72 e3                	jb     80179b <memfind+0x38>
+  8017b8:	eb 01                	jmp    8017bb <memfind+0x58>
+			break;
+  8017ba:	90                   	nop
+	return (void *) s;
+  8017bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017bf:	c9                   	leave
+  8017c0:	c3                   	ret
+
+00000000008017c1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8017c1:	55                   	push   %rbp
+  8017c2:	48 89 e5             	mov    %rsp,%rbp
+  8017c5:	48 83 ec 38          	sub    $0x38,%rsp
+  8017c9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017c9 <strtol+0x8>
+  8017d0:	49 bb 6f 68 00 00 00 	movabs $0x686f,%r11
+  8017d7:	00 00 00 
+  8017da:	4c 01 d8             	add    %r11,%rax
+  8017dd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8017e1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8017e5:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8017e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8017ef:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8017f6:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8017f7:	eb 05                	jmp    8017fe <strtol+0x3d>
+		s++;
+  8017f9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8017fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801802:	0f b6 00             	movzbl (%rax),%eax
+  801805:	3c 20                	cmp    $0x20,%al
+  801807:	74 f0                	je     8017f9 <strtol+0x38>
+  801809:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80180d:	0f b6 00             	movzbl (%rax),%eax
+  801810:	3c 09                	cmp    $0x9,%al
+  801812:	74 e5                	je     8017f9 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801814:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801818:	0f b6 00             	movzbl (%rax),%eax
+  80181b:	3c 2b                	cmp    $0x2b,%al
+  80181d:	75 07                	jne    801826 <strtol+0x65>
+		s++;
+  80181f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801824:	eb 17                	jmp    80183d <strtol+0x7c>
+	else if (*s == '-')
+  801826:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80182a:	0f b6 00             	movzbl (%rax),%eax
+  80182d:	3c 2d                	cmp    $0x2d,%al
+  80182f:	75 0c                	jne    80183d <strtol+0x7c>
+		s++, neg = 1;
+  801831:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801836:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80183d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801841:	74 06                	je     801849 <strtol+0x88>
+  801843:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801847:	75 28                	jne    801871 <strtol+0xb0>
+  801849:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80184d:	0f b6 00             	movzbl (%rax),%eax
+  801850:	3c 30                	cmp    $0x30,%al
+  801852:	75 1d                	jne    801871 <strtol+0xb0>
+  801854:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801858:	48 83 c0 01          	add    $0x1,%rax
+  80185c:	0f b6 00             	movzbl (%rax),%eax
+  80185f:	3c 78                	cmp    $0x78,%al
+  801861:	75 0e                	jne    801871 <strtol+0xb0>
+		s += 2, base = 16;
+  801863:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801868:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80186f:	eb 2c                	jmp    80189d <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801871:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801875:	75 19                	jne    801890 <strtol+0xcf>
+  801877:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80187b:	0f b6 00             	movzbl (%rax),%eax
+  80187e:	3c 30                	cmp    $0x30,%al
+  801880:	75 0e                	jne    801890 <strtol+0xcf>
+		s++, base = 8;
+  801882:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801887:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80188e:	eb 0d                	jmp    80189d <strtol+0xdc>
+	else if (base == 0)
+  801890:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801894:	75 07                	jne    80189d <strtol+0xdc>
+		base = 10;
+  801896:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  80189d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a1:	0f b6 00             	movzbl (%rax),%eax
+  8018a4:	3c 2f                	cmp    $0x2f,%al
+  8018a6:	7e 1d                	jle    8018c5 <strtol+0x104>
+  8018a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ac:	0f b6 00             	movzbl (%rax),%eax
+  8018af:	3c 39                	cmp    $0x39,%al
+  8018b1:	7f 12                	jg     8018c5 <strtol+0x104>
+			dig = *s - '0';
+  8018b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018b7:	0f b6 00             	movzbl (%rax),%eax
+  8018ba:	0f be c0             	movsbl %al,%eax
+  8018bd:	83 e8 30             	sub    $0x30,%eax
+  8018c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018c3:	eb 4e                	jmp    801913 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  8018c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c9:	0f b6 00             	movzbl (%rax),%eax
+  8018cc:	3c 60                	cmp    $0x60,%al
+  8018ce:	7e 1d                	jle    8018ed <strtol+0x12c>
+  8018d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d4:	0f b6 00             	movzbl (%rax),%eax
+  8018d7:	3c 7a                	cmp    $0x7a,%al
+  8018d9:	7f 12                	jg     8018ed <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  8018db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018df:	0f b6 00             	movzbl (%rax),%eax
+  8018e2:	0f be c0             	movsbl %al,%eax
+  8018e5:	83 e8 57             	sub    $0x57,%eax
+  8018e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018eb:	eb 26                	jmp    801913 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  8018ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f1:	0f b6 00             	movzbl (%rax),%eax
+  8018f4:	3c 40                	cmp    $0x40,%al
+  8018f6:	7e 47                	jle    80193f <strtol+0x17e>
+  8018f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018fc:	0f b6 00             	movzbl (%rax),%eax
+  8018ff:	3c 5a                	cmp    $0x5a,%al
+  801901:	7f 3c                	jg     80193f <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801903:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801907:	0f b6 00             	movzbl (%rax),%eax
+  80190a:	0f be c0             	movsbl %al,%eax
+  80190d:	83 e8 37             	sub    $0x37,%eax
+  801910:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801913:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801916:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801919:	7d 23                	jge    80193e <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  80191b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801920:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801923:	48 98                	cltq
+  801925:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80192a:	48 89 c2             	mov    %rax,%rdx
+  80192d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801930:	48 98                	cltq
+  801932:	48 01 d0             	add    %rdx,%rax
+  801935:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801939:	e9 5f ff ff ff       	jmp    80189d <strtol+0xdc>
+			break;
+  80193e:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80193f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801944:	74 0b                	je     801951 <strtol+0x190>
+		*endptr = (char *) s;
+  801946:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80194a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80194e:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801951:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801955:	74 09                	je     801960 <strtol+0x19f>
+  801957:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80195b:	48 f7 d8             	neg    %rax
+  80195e:	eb 04                	jmp    801964 <strtol+0x1a3>
+  801960:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801964:	c9                   	leave
+  801965:	c3                   	ret
+
+0000000000801966 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801966:	55                   	push   %rbp
+  801967:	48 89 e5             	mov    %rsp,%rbp
+  80196a:	53                   	push   %rbx
+  80196b:	48 83 ec 30          	sub    $0x30,%rsp
+  80196f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80196f <strstr+0x9>
+  801976:	49 bb c9 66 00 00 00 	movabs $0x66c9,%r11
+  80197d:	00 00 00 
+  801980:	4c 01 db             	add    %r11,%rbx
+  801983:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801987:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  80198b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80198f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801993:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801997:	0f b6 00             	movzbl (%rax),%eax
+  80199a:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  80199d:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  8019a1:	75 06                	jne    8019a9 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  8019a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019a7:	eb 73                	jmp    801a1c <strstr+0xb6>
+
+	len = strlen(str);
+  8019a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019ad:	48 89 c7             	mov    %rax,%rdi
+  8019b0:	48 b8 bb 90 ff ff ff 	movabs $0xffffffffffff90bb,%rax
+  8019b7:	ff ff ff 
+  8019ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8019be:	ff d0                	call   *%rax
+  8019c0:	48 98                	cltq
+  8019c2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  8019c6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019ca:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019ce:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8019d2:	0f b6 00             	movzbl (%rax),%eax
+  8019d5:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  8019d8:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  8019dc:	75 07                	jne    8019e5 <strstr+0x7f>
+				return (char *) 0;
+  8019de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e3:	eb 37                	jmp    801a1c <strstr+0xb6>
+		} while (sc != c);
+  8019e5:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  8019e9:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  8019ec:	75 d8                	jne    8019c6 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  8019ee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019f2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8019f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019fa:	48 89 ce             	mov    %rcx,%rsi
+  8019fd:	48 89 c7             	mov    %rax,%rdi
+  801a00:	48 b8 6f 93 ff ff ff 	movabs $0xffffffffffff936f,%rax
+  801a07:	ff ff ff 
+  801a0a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a0e:	ff d0                	call   *%rax
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	75 b2                	jne    8019c6 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801a14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a18:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801a1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a20:	c9                   	leave
+  801a21:	c3                   	ret
+
+0000000000801a22 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801a22:	55                   	push   %rbp
+  801a23:	48 89 e5             	mov    %rsp,%rbp
+  801a26:	41 57                	push   %r15
+  801a28:	53                   	push   %rbx
+  801a29:	48 83 ec 40          	sub    $0x40,%rsp
+  801a2d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801a2d <syscall+0xb>
+  801a34:	49 bb 0b 66 00 00 00 	movabs $0x660b,%r11
+  801a3b:	00 00 00 
+  801a3e:	4d 01 da             	add    %r11,%r10
+  801a41:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801a44:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801a47:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a4b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801a4f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801a53:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801a57:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a5a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801a5e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a62:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801a66:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801a6a:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801a6e:	4c 89 c3             	mov    %r8,%rbx
+  801a71:	cd 30                	int    $0x30
+  801a73:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801a77:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801a7b:	74 52                	je     801acf <syscall+0xad>
+  801a7d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a82:	7e 4b                	jle    801acf <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a84:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a88:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a8b:	49 89 d0             	mov    %rdx,%r8
+  801a8e:	89 c1                	mov    %eax,%ecx
+  801a90:	48 b8 50 e4 ff ff ff 	movabs $0xffffffffffffe450,%rax
+  801a97:	ff ff ff 
+  801a9a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801a9e:	48 89 c2             	mov    %rax,%rdx
+  801aa1:	be 23 00 00 00       	mov    $0x23,%esi
+  801aa6:	48 b8 6d e4 ff ff ff 	movabs $0xffffffffffffe46d,%rax
+  801aad:	ff ff ff 
+  801ab0:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801ab4:	48 89 c7             	mov    %rax,%rdi
+  801ab7:	4d 89 d7             	mov    %r10,%r15
+  801aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abf:	49 b9 3f d6 ff ff ff 	movabs $0xffffffffffffd63f,%r9
+  801ac6:	ff ff ff 
+  801ac9:	4d 01 d1             	add    %r10,%r9
+  801acc:	41 ff d1             	call   *%r9
+
+	return ret;
+  801acf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ad3:	48 83 c4 40          	add    $0x40,%rsp
+  801ad7:	5b                   	pop    %rbx
+  801ad8:	41 5f                	pop    %r15
+  801ada:	5d                   	pop    %rbp
+  801adb:	c3                   	ret
+
+0000000000801adc <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801adc:	55                   	push   %rbp
+  801add:	48 89 e5             	mov    %rsp,%rbp
+  801ae0:	41 57                	push   %r15
+  801ae2:	41 56                	push   %r14
+  801ae4:	41 55                	push   %r13
+  801ae6:	41 54                	push   %r12
+  801ae8:	53                   	push   %rbx
+  801ae9:	48 83 ec 48          	sub    $0x48,%rsp
+  801aed:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801aed <syscall_words+0x11>
+  801af4:	49 bb 4b 65 00 00 00 	movabs $0x654b,%r11
+  801afb:	00 00 00 
+  801afe:	4d 01 de             	add    %r11,%r14
+  801b01:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801b04:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801b07:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801b0b:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801b0f:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801b13:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801b17:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b1c:	74 09                	je     801b27 <syscall_words+0x4b>
+  801b1e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b22:	48 8b 00             	mov    (%rax),%rax
+  801b25:	eb 05                	jmp    801b2c <syscall_words+0x50>
+  801b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2c:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801b2f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b34:	74 0a                	je     801b40 <syscall_words+0x64>
+  801b36:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b3a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b3e:	eb 05                	jmp    801b45 <syscall_words+0x69>
+  801b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b45:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801b48:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b4d:	74 0a                	je     801b59 <syscall_words+0x7d>
+  801b4f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b53:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b57:	eb 05                	jmp    801b5e <syscall_words+0x82>
+  801b59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5e:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801b61:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b66:	74 0a                	je     801b72 <syscall_words+0x96>
+  801b68:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b6c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b70:	eb 05                	jmp    801b77 <syscall_words+0x9b>
+  801b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b77:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801b7a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b7f:	74 0a                	je     801b8b <syscall_words+0xaf>
+  801b81:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b85:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b89:	eb 05                	jmp    801b90 <syscall_words+0xb4>
+  801b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b90:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801b93:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b98:	74 0a                	je     801ba4 <syscall_words+0xc8>
+  801b9a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b9e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801ba2:	eb 05                	jmp    801ba9 <syscall_words+0xcd>
+  801ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba9:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801bac:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801baf:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801bb3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801bb7:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801bbb:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801bbf:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801bc3:	cd 30                	int    $0x30
+  801bc5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801bc9:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801bce:	74 50                	je     801c20 <syscall_words+0x144>
+		words[0] = r8;
+  801bd0:	4c 89 c2             	mov    %r8,%rdx
+  801bd3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bd7:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801bda:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bde:	48 83 c0 08          	add    $0x8,%rax
+  801be2:	4c 89 ca             	mov    %r9,%rdx
+  801be5:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801be8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bec:	48 83 c0 10          	add    $0x10,%rax
+  801bf0:	4c 89 d2             	mov    %r10,%rdx
+  801bf3:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801bf6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bfa:	48 83 c0 18          	add    $0x18,%rax
+  801bfe:	4c 89 da             	mov    %r11,%rdx
+  801c01:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801c04:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c08:	48 83 c0 20          	add    $0x20,%rax
+  801c0c:	4c 89 e2             	mov    %r12,%rdx
+  801c0f:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801c12:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c16:	48 83 c0 28          	add    $0x28,%rax
+  801c1a:	4c 89 ea             	mov    %r13,%rdx
+  801c1d:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801c20:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801c24:	74 52                	je     801c78 <syscall_words+0x19c>
+  801c26:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801c2b:	7e 4b                	jle    801c78 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c2d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c31:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801c34:	49 89 d0             	mov    %rdx,%r8
+  801c37:	89 c1                	mov    %eax,%ecx
+  801c39:	48 b8 50 e4 ff ff ff 	movabs $0xffffffffffffe450,%rax
+  801c40:	ff ff ff 
+  801c43:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801c47:	48 89 c2             	mov    %rax,%rdx
+  801c4a:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801c4f:	48 b8 6d e4 ff ff ff 	movabs $0xffffffffffffe46d,%rax
+  801c56:	ff ff ff 
+  801c59:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801c5d:	48 89 c7             	mov    %rax,%rdi
+  801c60:	4d 89 f7             	mov    %r14,%r15
+  801c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c68:	49 b9 3f d6 ff ff ff 	movabs $0xffffffffffffd63f,%r9
+  801c6f:	ff ff ff 
+  801c72:	4d 01 f1             	add    %r14,%r9
+  801c75:	41 ff d1             	call   *%r9
+
+	return ret;
+  801c78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801c7c:	48 83 c4 48          	add    $0x48,%rsp
+  801c80:	5b                   	pop    %rbx
+  801c81:	41 5c                	pop    %r12
+  801c83:	41 5d                	pop    %r13
+  801c85:	41 5e                	pop    %r14
+  801c87:	41 5f                	pop    %r15
+  801c89:	5d                   	pop    %rbp
+  801c8a:	c3                   	ret
+
+0000000000801c8b <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801c8b:	55                   	push   %rbp
+  801c8c:	48 89 e5             	mov    %rsp,%rbp
+  801c8f:	48 83 ec 10          	sub    $0x10,%rsp
+  801c93:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c93 <sys_cputs+0x8>
+  801c9a:	49 bb a5 63 00 00 00 	movabs $0x63a5,%r11
+  801ca1:	00 00 00 
+  801ca4:	4c 01 d8             	add    %r11,%rax
+  801ca7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801cab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801caf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cb3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cb7:	48 83 ec 08          	sub    $0x8,%rsp
+  801cbb:	6a 00                	push   $0x0
+  801cbd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cc3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cc9:	be 00 00 00 00       	mov    $0x0,%esi
+  801cce:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cd3:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  801cda:	ff ff ff 
+  801cdd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ce1:	ff d0                	call   *%rax
+  801ce3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ce7:	90                   	nop
+  801ce8:	c9                   	leave
+  801ce9:	c3                   	ret
+
+0000000000801cea <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801cea:	55                   	push   %rbp
+  801ceb:	48 89 e5             	mov    %rsp,%rbp
+  801cee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801cee <sys_cgetc+0x4>
+  801cf5:	49 bb 4a 63 00 00 00 	movabs $0x634a,%r11
+  801cfc:	00 00 00 
+  801cff:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801d02:	48 83 ec 08          	sub    $0x8,%rsp
+  801d06:	6a 00                	push   $0x0
+  801d08:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d23:	bf 01 00 00 00       	mov    $0x1,%edi
+  801d28:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  801d2f:	ff ff ff 
+  801d32:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801d36:	ff d0                	call   *%rax
+  801d38:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d3c:	c9                   	leave
+  801d3d:	c3                   	ret
+
+0000000000801d3e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801d3e:	55                   	push   %rbp
+  801d3f:	48 89 e5             	mov    %rsp,%rbp
+  801d42:	48 83 ec 10          	sub    $0x10,%rsp
+  801d46:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d46 <sys_env_destroy+0x8>
+  801d4d:	49 bb f2 62 00 00 00 	movabs $0x62f2,%r11
+  801d54:	00 00 00 
+  801d57:	4c 01 d8             	add    %r11,%rax
+  801d5a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801d5d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801d60:	48 63 d2             	movslq %edx,%rdx
+  801d63:	48 83 ec 08          	sub    $0x8,%rsp
+  801d67:	6a 00                	push   $0x0
+  801d69:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d6f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d7a:	be 01 00 00 00       	mov    $0x1,%esi
+  801d7f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d84:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  801d8b:	ff ff ff 
+  801d8e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801d92:	ff d0                	call   *%rax
+  801d94:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d98:	c9                   	leave
+  801d99:	c3                   	ret
+
+0000000000801d9a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801d9a:	55                   	push   %rbp
+  801d9b:	48 89 e5             	mov    %rsp,%rbp
+  801d9e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d9e <sys_getenvid+0x4>
+  801da5:	49 bb 9a 62 00 00 00 	movabs $0x629a,%r11
+  801dac:	00 00 00 
+  801daf:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801db2:	48 83 ec 08          	sub    $0x8,%rsp
+  801db6:	6a 00                	push   $0x0
+  801db8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dbe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dce:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd3:	bf 02 00 00 00       	mov    $0x2,%edi
+  801dd8:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  801ddf:	ff ff ff 
+  801de2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801de6:	ff d0                	call   *%rax
+  801de8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dec:	c9                   	leave
+  801ded:	c3                   	ret
+
+0000000000801dee <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801dee:	55                   	push   %rbp
+  801def:	48 89 e5             	mov    %rsp,%rbp
+  801df2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801df2 <sys_yield+0x4>
+  801df9:	49 bb 46 62 00 00 00 	movabs $0x6246,%r11
+  801e00:	00 00 00 
+  801e03:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801e06:	48 83 ec 08          	sub    $0x8,%rsp
+  801e0a:	6a 00                	push   $0x0
+  801e0c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e22:	be 00 00 00 00       	mov    $0x0,%esi
+  801e27:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801e2c:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  801e33:	ff ff ff 
+  801e36:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e3a:	ff d0                	call   *%rax
+  801e3c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e40:	90                   	nop
+  801e41:	c9                   	leave
+  801e42:	c3                   	ret
+
+0000000000801e43 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801e43:	55                   	push   %rbp
+  801e44:	48 89 e5             	mov    %rsp,%rbp
+  801e47:	48 83 ec 10          	sub    $0x10,%rsp
+  801e4b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e4b <sys_page_alloc+0x8>
+  801e52:	49 bb ed 61 00 00 00 	movabs $0x61ed,%r11
+  801e59:	00 00 00 
+  801e5c:	4c 01 d8             	add    %r11,%rax
+  801e5f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e62:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e66:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801e69:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801e6c:	48 63 f2             	movslq %edx,%rsi
+  801e6f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e73:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801e76:	48 63 d2             	movslq %edx,%rdx
+  801e79:	48 83 ec 08          	sub    $0x8,%rsp
+  801e7d:	6a 00                	push   $0x0
+  801e7f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e85:	49 89 f0             	mov    %rsi,%r8
+  801e88:	be 01 00 00 00       	mov    $0x1,%esi
+  801e8d:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e92:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  801e99:	ff ff ff 
+  801e9c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ea0:	ff d0                	call   *%rax
+  801ea2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ea6:	c9                   	leave
+  801ea7:	c3                   	ret
+
+0000000000801ea8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801ea8:	55                   	push   %rbp
+  801ea9:	48 89 e5             	mov    %rsp,%rbp
+  801eac:	48 83 ec 20          	sub    $0x20,%rsp
+  801eb0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801eb0 <sys_page_map+0x8>
+  801eb7:	49 bb 88 61 00 00 00 	movabs $0x6188,%r11
+  801ebe:	00 00 00 
+  801ec1:	4c 01 d8             	add    %r11,%rax
+  801ec4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ec7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ecb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801ece:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801ed2:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801ed6:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801ed9:	48 63 f2             	movslq %edx,%rsi
+  801edc:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  801ee0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801ee3:	48 63 fa             	movslq %edx,%rdi
+  801ee6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801eea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801eed:	48 63 d2             	movslq %edx,%rdx
+  801ef0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef4:	56                   	push   %rsi
+  801ef5:	4d 89 c1             	mov    %r8,%r9
+  801ef8:	49 89 f8             	mov    %rdi,%r8
+  801efb:	be 01 00 00 00       	mov    $0x1,%esi
+  801f00:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f05:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  801f0c:	ff ff ff 
+  801f0f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f13:	ff d0                	call   *%rax
+  801f15:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f19:	c9                   	leave
+  801f1a:	c3                   	ret
+
+0000000000801f1b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801f1b:	55                   	push   %rbp
+  801f1c:	48 89 e5             	mov    %rsp,%rbp
+  801f1f:	48 83 ec 10          	sub    $0x10,%rsp
+  801f23:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f23 <sys_page_unmap+0x8>
+  801f2a:	49 bb 15 61 00 00 00 	movabs $0x6115,%r11
+  801f31:	00 00 00 
+  801f34:	4c 01 d8             	add    %r11,%rax
+  801f37:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f3a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801f3e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f42:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f45:	48 63 d2             	movslq %edx,%rdx
+  801f48:	48 83 ec 08          	sub    $0x8,%rsp
+  801f4c:	6a 00                	push   $0x0
+  801f4e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f5a:	be 01 00 00 00       	mov    $0x1,%esi
+  801f5f:	bf 06 00 00 00       	mov    $0x6,%edi
+  801f64:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  801f6b:	ff ff ff 
+  801f6e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f72:	ff d0                	call   *%rax
+  801f74:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f78:	c9                   	leave
+  801f79:	c3                   	ret
+
+0000000000801f7a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801f7a:	55                   	push   %rbp
+  801f7b:	48 89 e5             	mov    %rsp,%rbp
+  801f7e:	48 83 ec 10          	sub    $0x10,%rsp
+  801f82:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f82 <sys_env_set_status+0x8>
+  801f89:	49 bb b6 60 00 00 00 	movabs $0x60b6,%r11
+  801f90:	00 00 00 
+  801f93:	4c 01 d8             	add    %r11,%rax
+  801f96:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f99:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801f9c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801f9f:	48 63 ca             	movslq %edx,%rcx
+  801fa2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fa5:	48 63 d2             	movslq %edx,%rdx
+  801fa8:	48 83 ec 08          	sub    $0x8,%rsp
+  801fac:	6a 00                	push   $0x0
+  801fae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fba:	be 01 00 00 00       	mov    $0x1,%esi
+  801fbf:	bf 08 00 00 00       	mov    $0x8,%edi
+  801fc4:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  801fcb:	ff ff ff 
+  801fce:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fd2:	ff d0                	call   *%rax
+  801fd4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fd8:	c9                   	leave
+  801fd9:	c3                   	ret
+
+0000000000801fda <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801fda:	55                   	push   %rbp
+  801fdb:	48 89 e5             	mov    %rsp,%rbp
+  801fde:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fe2 <sys_env_set_trapframe+0x8>
+  801fe9:	49 bb 56 60 00 00 00 	movabs $0x6056,%r11
+  801ff0:	00 00 00 
+  801ff3:	4c 01 d8             	add    %r11,%rax
+  801ff6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ff9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  801ffd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802001:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802004:	48 63 d2             	movslq %edx,%rdx
+  802007:	48 83 ec 08          	sub    $0x8,%rsp
+  80200b:	6a 00                	push   $0x0
+  80200d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802013:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802019:	be 01 00 00 00       	mov    $0x1,%esi
+  80201e:	bf 09 00 00 00       	mov    $0x9,%edi
+  802023:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  80202a:	ff ff ff 
+  80202d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802031:	ff d0                	call   *%rax
+  802033:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802037:	c9                   	leave
+  802038:	c3                   	ret
+
+0000000000802039 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802039:	55                   	push   %rbp
+  80203a:	48 89 e5             	mov    %rsp,%rbp
+  80203d:	48 83 ec 10          	sub    $0x10,%rsp
+  802041:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802041 <sys_env_set_pgfault_upcall+0x8>
+  802048:	49 bb f7 5f 00 00 00 	movabs $0x5ff7,%r11
+  80204f:	00 00 00 
+  802052:	4c 01 d8             	add    %r11,%rax
+  802055:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802058:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80205c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802060:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802063:	48 63 d2             	movslq %edx,%rdx
+  802066:	48 83 ec 08          	sub    $0x8,%rsp
+  80206a:	6a 00                	push   $0x0
+  80206c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802072:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802078:	be 01 00 00 00       	mov    $0x1,%esi
+  80207d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802082:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  802089:	ff ff ff 
+  80208c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802090:	ff d0                	call   *%rax
+  802092:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802096:	c9                   	leave
+  802097:	c3                   	ret
+
+0000000000802098 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802098:	55                   	push   %rbp
+  802099:	48 89 e5             	mov    %rsp,%rbp
+  80209c:	48 83 ec 20          	sub    $0x20,%rsp
+  8020a0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020a0 <sys_ipc_try_send+0x8>
+  8020a7:	49 bb 98 5f 00 00 00 	movabs $0x5f98,%r11
+  8020ae:	00 00 00 
+  8020b1:	4c 01 d8             	add    %r11,%rax
+  8020b4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020b7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020bb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8020bf:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8020c2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020c5:	48 63 fa             	movslq %edx,%rdi
+  8020c8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8020cc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020cf:	48 63 d2             	movslq %edx,%rdx
+  8020d2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8020da:	6a 00                	push   $0x0
+  8020dc:	49 89 f9             	mov    %rdi,%r9
+  8020df:	49 89 f0             	mov    %rsi,%r8
+  8020e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8020e7:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8020ec:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  8020f3:	ff ff ff 
+  8020f6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020fa:	ff d0                	call   *%rax
+  8020fc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802100:	c9                   	leave
+  802101:	c3                   	ret
+
+0000000000802102 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802102:	55                   	push   %rbp
+  802103:	48 89 e5             	mov    %rsp,%rbp
+  802106:	48 83 ec 20          	sub    $0x20,%rsp
+  80210a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80210a <sys_ipc_send+0x8>
+  802111:	49 bb 2e 5f 00 00 00 	movabs $0x5f2e,%r11
+  802118:	00 00 00 
+  80211b:	4c 01 d8             	add    %r11,%rax
+  80211e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802121:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802125:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802129:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80212c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80212f:	48 63 fa             	movslq %edx,%rdi
+  802132:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802136:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802139:	48 63 d2             	movslq %edx,%rdx
+  80213c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802140:	48 83 ec 08          	sub    $0x8,%rsp
+  802144:	6a 00                	push   $0x0
+  802146:	49 89 f9             	mov    %rdi,%r9
+  802149:	49 89 f0             	mov    %rsi,%r8
+  80214c:	be 00 00 00 00       	mov    $0x0,%esi
+  802151:	bf 17 00 00 00       	mov    $0x17,%edi
+  802156:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  80215d:	ff ff ff 
+  802160:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802164:	ff d0                	call   *%rax
+  802166:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80216a:	c9                   	leave
+  80216b:	c3                   	ret
+
+000000000080216c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80216c:	55                   	push   %rbp
+  80216d:	48 89 e5             	mov    %rsp,%rbp
+  802170:	48 83 ec 10          	sub    $0x10,%rsp
+  802174:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802174 <sys_ipc_recv+0x8>
+  80217b:	49 bb c4 5e 00 00 00 	movabs $0x5ec4,%r11
+  802182:	00 00 00 
+  802185:	4c 01 d8             	add    %r11,%rax
+  802188:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80218c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802190:	6a 00                	push   $0x0
+  802192:	6a 00                	push   $0x0
+  802194:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80219a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8021aa:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021af:	49 ba a4 9a ff ff ff 	movabs $0xffffffffffff9aa4,%r10
+  8021b6:	ff ff ff 
+  8021b9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021bd:	ff d0                	call   *%rax
+  8021bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021c3:	c9                   	leave
+  8021c4:	c3                   	ret
+
+00000000008021c5 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8021c5:	55                   	push   %rbp
+  8021c6:	48 89 e5             	mov    %rsp,%rbp
+  8021c9:	48 83 ec 30          	sub    $0x30,%rsp
+  8021cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021cd <sys_ipc_call+0x8>
+  8021d4:	49 bb 6b 5e 00 00 00 	movabs $0x5e6b,%r11
+  8021db:	00 00 00 
+  8021de:	4c 01 d8             	add    %r11,%rax
+  8021e1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021e4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021e8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021ec:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8021ef:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8021f3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8021f7:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8021fb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021fe:	4c 63 c2             	movslq %edx,%r8
+  802201:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802205:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802208:	48 63 d2             	movslq %edx,%rdx
+  80220b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80220f:	ff 75 d8             	push   -0x28(%rbp)
+  802212:	56                   	push   %rsi
+  802213:	4d 89 c1             	mov    %r8,%r9
+  802216:	49 89 f8             	mov    %rdi,%r8
+  802219:	be 00 00 00 00       	mov    $0x0,%esi
+  80221e:	bf 18 00 00 00       	mov    $0x18,%edi
+  802223:	49 ba a4 9a ff ff ff 	movabs $0xffffffffffff9aa4,%r10
+  80222a:	ff ff ff 
+  80222d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802231:	ff d0                	call   *%rax
+  802233:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802237:	c9                   	leave
+  802238:	c3                   	ret
+
+0000000000802239 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802239:	55                   	push   %rbp
+  80223a:	48 89 e5             	mov    %rsp,%rbp
+  80223d:	48 83 ec 30          	sub    $0x30,%rsp
+  802241:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802241 <sys_ipc_reply_recv+0x8>
+  802248:	49 bb f7 5d 00 00 00 	movabs $0x5df7,%r11
+  80224f:	00 00 00 
+  802252:	4c 01 d8             	add    %r11,%rax
+  802255:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802258:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80225c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802260:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802263:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802267:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80226b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80226f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802272:	4c 63 c2             	movslq %edx,%r8
+  802275:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802279:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80227c:	48 63 d2             	movslq %edx,%rdx
+  80227f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802283:	ff 75 d8             	push   -0x28(%rbp)
+  802286:	56                   	push   %rsi
+  802287:	4d 89 c1             	mov    %r8,%r9
+  80228a:	49 89 f8             	mov    %rdi,%r8
+  80228d:	be 00 00 00 00       	mov    $0x0,%esi
+  802292:	bf 19 00 00 00       	mov    $0x19,%edi
+  802297:	49 ba a4 9a ff ff ff 	movabs $0xffffffffffff9aa4,%r10
+  80229e:	ff ff ff 
+  8022a1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022a5:	ff d0                	call   *%rax
+  8022a7:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8022ab:	c9                   	leave
+  8022ac:	c3                   	ret
+
+00000000008022ad <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8022ad:	55                   	push   %rbp
+  8022ae:	48 89 e5             	mov    %rsp,%rbp
+  8022b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022b5 <sys_env_set_priority+0x8>
+  8022bc:	49 bb 83 5d 00 00 00 	movabs $0x5d83,%r11
+  8022c3:	00 00 00 
+  8022c6:	4c 01 d8             	add    %r11,%rax
+  8022c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022cc:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8022cf:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022d2:	48 63 ca             	movslq %edx,%rcx
+  8022d5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022d8:	48 63 d2             	movslq %edx,%rdx
+  8022db:	48 83 ec 08          	sub    $0x8,%rsp
+  8022df:	6a 00                	push   $0x0
+  8022e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8022f2:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8022f7:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  8022fe:	ff ff ff 
+  802301:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802305:	ff d0                	call   *%rax
+  802307:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80230b:	c9                   	leave
+  80230c:	c3                   	ret
+
+000000000080230d <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80230d:	55                   	push   %rbp
+  80230e:	48 89 e5             	mov    %rsp,%rbp
+  802311:	48 83 ec 10          	sub    $0x10,%rsp
+  802315:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802315 <sys_env_set_affinity+0x8>
+  80231c:	49 bb 23 5d 00 00 00 	movabs $0x5d23,%r11
+  802323:	00 00 00 
+  802326:	4c 01 d8             	add    %r11,%rax
+  802329:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80232c:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  80232f:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802332:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802335:	48 63 d2             	movslq %edx,%rdx
+  802338:	48 83 ec 08          	sub    $0x8,%rsp
+  80233c:	6a 00                	push   $0x0
+  80233e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802344:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80234a:	be 01 00 00 00       	mov    $0x1,%esi
+  80234f:	bf 10 00 00 00       	mov    $0x10,%edi
+  802354:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  80235b:	ff ff ff 
+  80235e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802362:	ff d0                	call   *%rax
+  802364:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802368:	c9                   	leave
+  802369:	c3                   	ret
+
+000000000080236a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80236a:	55                   	push   %rbp
+  80236b:	48 89 e5             	mov    %rsp,%rbp
+  80236e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80236e <sys_time_msec+0x4>
+  802375:	49 bb ca 5c 00 00 00 	movabs $0x5cca,%r11
+  80237c:	00 00 00 
+  80237f:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802382:	48 83 ec 08          	sub    $0x8,%rsp
+  802386:	6a 00                	push   $0x0
+  802388:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80238e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802394:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802399:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239e:	be 00 00 00 00       	mov    $0x0,%esi
+  8023a3:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8023a8:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  8023af:	ff ff ff 
+  8023b2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023b6:	ff d0                	call   *%rax
+  8023b8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023bc:	c9                   	leave
+  8023bd:	c3                   	ret
+
+00000000008023be <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8023be:	55                   	push   %rbp
+  8023bf:	48 89 e5             	mov    %rsp,%rbp
+  8023c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8023c6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023c6 <sys_sleep_usec+0x8>
+  8023cd:	49 bb 72 5c 00 00 00 	movabs $0x5c72,%r11
+  8023d4:	00 00 00 
+  8023d7:	4c 01 d8             	add    %r11,%rax
+  8023da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8023de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8023e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e6:	6a 00                	push   $0x0
+  8023e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023fe:	bf 11 00 00 00       	mov    $0x11,%edi
+  802403:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  80240a:	ff ff ff 
+  80240d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802411:	ff d0                	call   *%rax
+  802413:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802417:	c9                   	leave
+  802418:	c3                   	ret
+
+0000000000802419 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802419:	55                   	push   %rbp
+  80241a:	48 89 e5             	mov    %rsp,%rbp
+  80241d:	48 83 ec 10          	sub    $0x10,%rsp
+  802421:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802421 <sys_page_alloc_huge+0x8>
+  802428:	49 bb 17 5c 00 00 00 	movabs $0x5c17,%r11
+  80242f:	00 00 00 
+  802432:	4c 01 d8             	add    %r11,%rax
+  802435:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802438:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80243c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  80243f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802442:	48 63 f2             	movslq %edx,%rsi
+  802445:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802449:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80244c:	48 63 d2             	movslq %edx,%rdx
+  80244f:	48 83 ec 08          	sub    $0x8,%rsp
+  802453:	6a 00                	push   $0x0
+  802455:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80245b:	49 89 f0             	mov    %rsi,%r8
+  80245e:	be 01 00 00 00       	mov    $0x1,%esi
+  802463:	bf 12 00 00 00       	mov    $0x12,%edi
+  802468:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  80246f:	ff ff ff 
+  802472:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802476:	ff d0                	call   *%rax
+  802478:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80247c:	c9                   	leave
+  80247d:	c3                   	ret
+
+000000000080247e <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80247e:	55                   	push   %rbp
+  80247f:	48 89 e5             	mov    %rsp,%rbp
+  802482:	48 83 ec 10          	sub    $0x10,%rsp
+  802486:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802486 <sys_page_map_batch+0x8>
+  80248d:	49 bb b2 5b 00 00 00 	movabs $0x5bb2,%r11
+  802494:	00 00 00 
+  802497:	4c 01 d8             	add    %r11,%rax
+  80249a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80249e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8024a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024a6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ae:	6a 00                	push   $0x0
+  8024b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024bc:	be 01 00 00 00       	mov    $0x1,%esi
+  8024c1:	bf 13 00 00 00       	mov    $0x13,%edi
+  8024c6:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  8024cd:	ff ff ff 
+  8024d0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024d4:	ff d0                	call   *%rax
+  8024d6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024da:	c9                   	leave
+  8024db:	c3                   	ret
+
+00000000008024dc <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8024dc:	55                   	push   %rbp
+  8024dd:	48 89 e5             	mov    %rsp,%rbp
+  8024e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8024e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024e4 <sys_page_alloc_batch+0x8>
+  8024eb:	49 bb 54 5b 00 00 00 	movabs $0x5b54,%r11
+  8024f2:	00 00 00 
+  8024f5:	4c 01 d8             	add    %r11,%rax
+  8024f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802500:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802504:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802508:	48 83 ec 08          	sub    $0x8,%rsp
+  80250c:	6a 00                	push   $0x0
+  80250e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80251a:	be 01 00 00 00       	mov    $0x1,%esi
+  80251f:	bf 14 00 00 00       	mov    $0x14,%edi
+  802524:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  80252b:	ff ff ff 
+  80252e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802532:	ff d0                	call   *%rax
+  802534:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802538:	c9                   	leave
+  802539:	c3                   	ret
+
+000000000080253a <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80253a:	55                   	push   %rbp
+  80253b:	48 89 e5             	mov    %rsp,%rbp
+  80253e:	48 83 ec 10          	sub    $0x10,%rsp
+  802542:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802542 <sys_page_unmap_batch+0x8>
+  802549:	49 bb f6 5a 00 00 00 	movabs $0x5af6,%r11
+  802550:	00 00 00 
+  802553:	4c 01 d8             	add    %r11,%rax
+  802556:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80255a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80255e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802562:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802566:	48 83 ec 08          	sub    $0x8,%rsp
+  80256a:	6a 00                	push   $0x0
+  80256c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802572:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802578:	be 01 00 00 00       	mov    $0x1,%esi
+  80257d:	bf 15 00 00 00       	mov    $0x15,%edi
+  802582:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  802589:	ff ff ff 
+  80258c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802590:	ff d0                	call   *%rax
+  802592:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802596:	c9                   	leave
+  802597:	c3                   	ret
+
+0000000000802598 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802598:	55                   	push   %rbp
+  802599:	48 89 e5             	mov    %rsp,%rbp
+  80259c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80259c <sys_fork+0x4>
+  8025a3:	49 bb 9c 5a 00 00 00 	movabs $0x5a9c,%r11
+  8025aa:	00 00 00 
+  8025ad:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8025b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b4:	6a 00                	push   $0x0
+  8025b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d1:	bf 16 00 00 00       	mov    $0x16,%edi
+  8025d6:	49 ba ea 99 ff ff ff 	movabs $0xffffffffffff99ea,%r10
+  8025dd:	ff ff ff 
+  8025e0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025e4:	ff d0                	call   *%rax
+  8025e6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ea:	c9                   	leave
+  8025eb:	c3                   	ret
+
+00000000008025ec <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8025ec:	55                   	push   %rbp
+  8025ed:	48 89 e5             	mov    %rsp,%rbp
+  8025f0:	41 57                	push   %r15
+  8025f2:	53                   	push   %rbx
+  8025f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8025f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8025f7 <set_pgfault_handler+0xb>
+  8025fe:	49 bb 41 5a 00 00 00 	movabs $0x5a41,%r11
+  802605:	00 00 00 
+  802608:	4c 01 db             	add    %r11,%rbx
+  80260b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  80260f:	49 89 df             	mov    %rbx,%r15
+  802612:	48 b8 62 9d ff ff ff 	movabs $0xffffffffffff9d62,%rax
+  802619:	ff ff ff 
+  80261c:	48 01 d8             	add    %rbx,%rax
+  80261f:	ff d0                	call   *%rax
+  802621:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  802624:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  80262b:	00 00 00 
+  80262e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802632:	48 85 c0             	test   %rax,%rax
+  802635:	75 6b                	jne    8026a2 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  802637:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80263a:	ba 07 00 00 00       	mov    $0x7,%edx
+  80263f:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  802644:	48 89 ce             	mov    %rcx,%rsi
+  802647:	89 c7                	mov    %eax,%edi
+  802649:	49 89 df             	mov    %rbx,%r15
+  80264c:	48 b8 0b 9e ff ff ff 	movabs $0xffffffffffff9e0b,%rax
+  802653:	ff ff ff 
+  802656:	48 01 d8             	add    %rbx,%rax
+  802659:	ff d0                	call   *%rax
+  80265b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  80265e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802662:	74 3e                	je     8026a2 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  802664:	48 b8 80 e4 ff ff ff 	movabs $0xffffffffffffe480,%rax
+  80266b:	ff ff ff 
+  80266e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802672:	48 89 c2             	mov    %rax,%rdx
+  802675:	be 23 00 00 00       	mov    $0x23,%esi
+  80267a:	48 b8 ae e4 ff ff ff 	movabs $0xffffffffffffe4ae,%rax
+  802681:	ff ff ff 
+  802684:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802688:	48 89 c7             	mov    %rax,%rdi
+  80268b:	49 89 df             	mov    %rbx,%r15
+  80268e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802693:	48 b9 3f d6 ff ff ff 	movabs $0xffffffffffffd63f,%rcx
+  80269a:	ff ff ff 
+  80269d:	48 01 d9             	add    %rbx,%rcx
+  8026a0:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8026a2:	48 ba d8 1f 01 00 00 	movabs $0x11fd8,%rdx
+  8026a9:	00 00 00 
+  8026ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026b0:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  8026b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026b7:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8026be:	ff ff ff 
+  8026c1:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8026c5:	48 89 d6             	mov    %rdx,%rsi
+  8026c8:	89 c7                	mov    %eax,%edi
+  8026ca:	49 89 df             	mov    %rbx,%r15
+  8026cd:	48 b8 01 a0 ff ff ff 	movabs $0xffffffffffffa001,%rax
+  8026d4:	ff ff ff 
+  8026d7:	48 01 d8             	add    %rbx,%rax
+  8026da:	ff d0                	call   *%rax
+}
+  8026dc:	90                   	nop
+  8026dd:	48 83 c4 20          	add    $0x20,%rsp
+  8026e1:	5b                   	pop    %rbx
+  8026e2:	41 5f                	pop    %r15
+  8026e4:	5d                   	pop    %rbp
+  8026e5:	c3                   	ret
+
+00000000008026e6 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  8026e6:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  8026e9:	48 a1 10 a0 81 00 00 	movabs 0x81a010,%rax
+  8026f0:	00 00 00 
+call *%rax
+  8026f3:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  8026f5:	58                   	pop    %rax
+	popq %rax;
+  8026f6:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  8026f7:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  8026fe:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  802702:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  802706:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  80270a:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  80270e:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  802712:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  802715:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  802719:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80271d:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  802722:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  802727:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80272c:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  802731:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  802736:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80273b:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  802740:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  802745:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80274a:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80274f:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  802754:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  802759:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80275e:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  802763:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  802767:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  80276b:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  80276c:	5c                   	pop    %rsp
+	ret;			//return
+  80276d:	c3                   	ret
+
+000000000080276e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80276e:	55                   	push   %rbp
+  80276f:	48 89 e5             	mov    %rsp,%rbp
+  802772:	48 83 ec 08          	sub    $0x8,%rsp
+  802776:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802776 <fd2num+0x8>
+  80277d:	49 bb c2 58 00 00 00 	movabs $0x58c2,%r11
+  802784:	00 00 00 
+  802787:	4c 01 d8             	add    %r11,%rax
+  80278a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80278e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802792:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802799:	ff ff ff 
+  80279c:	48 01 d0             	add    %rdx,%rax
+  80279f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8027a3:	c9                   	leave
+  8027a4:	c3                   	ret
+
+00000000008027a5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8027a5:	55                   	push   %rbp
+  8027a6:	48 89 e5             	mov    %rsp,%rbp
+  8027a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ad:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027ad <fd2data+0x8>
+  8027b4:	49 bb 8b 58 00 00 00 	movabs $0x588b,%r11
+  8027bb:	00 00 00 
+  8027be:	4c 01 d8             	add    %r11,%rax
+  8027c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8027c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027c9:	48 89 d7             	mov    %rdx,%rdi
+  8027cc:	48 ba 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rdx
+  8027d3:	ff ff ff 
+  8027d6:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8027da:	ff d0                	call   *%rax
+  8027dc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8027e2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8027e6:	c9                   	leave
+  8027e7:	c3                   	ret
+
+00000000008027e8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8027e8:	55                   	push   %rbp
+  8027e9:	48 89 e5             	mov    %rsp,%rbp
+  8027ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8027f0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027f0 <fd_alloc+0x8>
+  8027f7:	49 bb 48 58 00 00 00 	movabs $0x5848,%r11
+  8027fe:	00 00 00 
+  802801:	4c 01 d8             	add    %r11,%rax
+  802804:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802808:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80280f:	eb 75                	jmp    802886 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802811:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802814:	48 63 d2             	movslq %edx,%rdx
+  802817:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  80281e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802822:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802826:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80282a:	48 89 d1             	mov    %rdx,%rcx
+  80282d:	48 c1 e9 15          	shr    $0x15,%rcx
+  802831:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802838:	ff ff ff 
+  80283b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80283f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802843:	83 e2 01             	and    $0x1,%edx
+  802846:	48 85 d2             	test   %rdx,%rdx
+  802849:	74 25                	je     802870 <fd_alloc+0x88>
+  80284b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80284f:	48 89 d1             	mov    %rdx,%rcx
+  802852:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802856:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80285d:	ff ff ff 
+  802860:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802864:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802868:	83 e2 01             	and    $0x1,%edx
+  80286b:	48 85 d2             	test   %rdx,%rdx
+  80286e:	75 12                	jne    802882 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802870:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802874:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802878:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80287b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802880:	eb 1a                	jmp    80289c <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802882:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802886:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80288a:	7e 85                	jle    802811 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  80288c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802890:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802897:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  80289c:	c9                   	leave
+  80289d:	c3                   	ret
+
+000000000080289e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80289e:	55                   	push   %rbp
+  80289f:	48 89 e5             	mov    %rsp,%rbp
+  8028a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8028a6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028a6 <fd_lookup+0x8>
+  8028ad:	49 bb 92 57 00 00 00 	movabs $0x5792,%r11
+  8028b4:	00 00 00 
+  8028b7:	4c 01 d8             	add    %r11,%rax
+  8028ba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8028bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8028c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8028c5:	78 06                	js     8028cd <fd_lookup+0x2f>
+  8028c7:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8028cb:	7e 07                	jle    8028d4 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8028cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028d2:	eb 73                	jmp    802947 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8028d4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8028d7:	48 63 d2             	movslq %edx,%rdx
+  8028da:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8028e1:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8028e5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8028e9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028ed:	48 89 d1             	mov    %rdx,%rcx
+  8028f0:	48 c1 e9 15          	shr    $0x15,%rcx
+  8028f4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8028fb:	ff ff ff 
+  8028fe:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802902:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802906:	83 e2 01             	and    $0x1,%edx
+  802909:	48 85 d2             	test   %rdx,%rdx
+  80290c:	74 22                	je     802930 <fd_lookup+0x92>
+  80290e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802912:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802916:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  80291d:	ff ff ff 
+  802920:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802924:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802928:	83 e0 01             	and    $0x1,%eax
+  80292b:	48 85 c0             	test   %rax,%rax
+  80292e:	75 07                	jne    802937 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802930:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802935:	eb 10                	jmp    802947 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802937:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80293b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80293f:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802942:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802947:	c9                   	leave
+  802948:	c3                   	ret
+
+0000000000802949 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802949:	55                   	push   %rbp
+  80294a:	48 89 e5             	mov    %rsp,%rbp
+  80294d:	41 57                	push   %r15
+  80294f:	53                   	push   %rbx
+  802950:	48 83 ec 30          	sub    $0x30,%rsp
+  802954:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802954 <fd_close+0xb>
+  80295b:	49 bb e4 56 00 00 00 	movabs $0x56e4,%r11
+  802962:	00 00 00 
+  802965:	4c 01 db             	add    %r11,%rbx
+  802968:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80296c:	89 f0                	mov    %esi,%eax
+  80296e:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802971:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802975:	48 89 c7             	mov    %rax,%rdi
+  802978:	48 b8 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rax
+  80297f:	ff ff ff 
+  802982:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802986:	ff d0                	call   *%rax
+  802988:	89 c2                	mov    %eax,%edx
+  80298a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80298e:	48 89 c6             	mov    %rax,%rsi
+  802991:	89 d7                	mov    %edx,%edi
+  802993:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  80299a:	ff ff ff 
+  80299d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029a1:	ff d0                	call   *%rax
+  8029a3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8029a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8029aa:	78 0a                	js     8029b6 <fd_close+0x6d>
+	    || fd != fd2)
+  8029ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029b0:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  8029b4:	74 12                	je     8029c8 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  8029b6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8029ba:	74 05                	je     8029c1 <fd_close+0x78>
+  8029bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029bf:	eb 7a                	jmp    802a3b <fd_close+0xf2>
+  8029c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c6:	eb 73                	jmp    802a3b <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8029c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029cc:	8b 00                	mov    (%rax),%eax
+  8029ce:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8029d2:	48 89 d6             	mov    %rdx,%rsi
+  8029d5:	89 c7                	mov    %eax,%edi
+  8029d7:	48 b8 0c aa ff ff ff 	movabs $0xffffffffffffaa0c,%rax
+  8029de:	ff ff ff 
+  8029e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029e5:	ff d0                	call   *%rax
+  8029e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8029ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8029ee:	78 2a                	js     802a1a <fd_close+0xd1>
+		if (dev->dev_close)
+  8029f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029f4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8029f8:	48 85 c0             	test   %rax,%rax
+  8029fb:	74 16                	je     802a13 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8029fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a01:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802a05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a09:	48 89 c7             	mov    %rax,%rdi
+  802a0c:	ff d2                	call   *%rdx
+  802a0e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802a11:	eb 07                	jmp    802a1a <fd_close+0xd1>
+		else
+			r = 0;
+  802a13:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802a1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a1e:	48 89 c6             	mov    %rax,%rsi
+  802a21:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a26:	49 89 df             	mov    %rbx,%r15
+  802a29:	48 b8 e3 9e ff ff ff 	movabs $0xffffffffffff9ee3,%rax
+  802a30:	ff ff ff 
+  802a33:	48 01 d8             	add    %rbx,%rax
+  802a36:	ff d0                	call   *%rax
+	return r;
+  802a38:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802a3b:	48 83 c4 30          	add    $0x30,%rsp
+  802a3f:	5b                   	pop    %rbx
+  802a40:	41 5f                	pop    %r15
+  802a42:	5d                   	pop    %rbp
+  802a43:	c3                   	ret
+
+0000000000802a44 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802a44:	55                   	push   %rbp
+  802a45:	48 89 e5             	mov    %rsp,%rbp
+  802a48:	41 57                	push   %r15
+  802a4a:	48 83 ec 28          	sub    $0x28,%rsp
+  802a4e:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802a4e <dev_lookup+0xa>
+  802a55:	49 bb ea 55 00 00 00 	movabs $0x55ea,%r11
+  802a5c:	00 00 00 
+  802a5f:	4c 01 d9             	add    %r11,%rcx
+  802a62:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802a65:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802a69:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802a70:	eb 45                	jmp    802ab7 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802a72:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802a79:	00 00 00 
+  802a7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a7f:	48 98                	cltq
+  802a81:	48 01 ca             	add    %rcx,%rdx
+  802a84:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a88:	8b 00                	mov    (%rax),%eax
+  802a8a:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802a8d:	75 24                	jne    802ab3 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802a8f:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802a96:	00 00 00 
+  802a99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a9c:	48 98                	cltq
+  802a9e:	48 01 ca             	add    %rcx,%rdx
+  802aa1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802aa5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802aa9:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab1:	eb 74                	jmp    802b27 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802ab3:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802ab7:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802abe:	00 00 00 
+  802ac1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ac4:	48 98                	cltq
+  802ac6:	48 01 ca             	add    %rcx,%rdx
+  802ac9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802acd:	48 85 c0             	test   %rax,%rax
+  802ad0:	75 a0                	jne    802a72 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802ad2:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802ad9:	ff ff ff 
+  802adc:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802ae0:	48 8b 00             	mov    (%rax),%rax
+  802ae3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802ae9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802aec:	89 c6                	mov    %eax,%esi
+  802aee:	48 b8 c0 e4 ff ff ff 	movabs $0xffffffffffffe4c0,%rax
+  802af5:	ff ff ff 
+  802af8:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802afc:	48 89 c7             	mov    %rax,%rdi
+  802aff:	49 89 cf             	mov    %rcx,%r15
+  802b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b07:	49 b8 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%r8
+  802b0e:	ff ff ff 
+  802b11:	49 01 c8             	add    %rcx,%r8
+  802b14:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802b17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b1b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802b22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b27:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802b2b:	c9                   	leave
+  802b2c:	c3                   	ret
+
+0000000000802b2d <close>:
+
+int
+close(int fdnum)
+{
+  802b2d:	55                   	push   %rbp
+  802b2e:	48 89 e5             	mov    %rsp,%rbp
+  802b31:	53                   	push   %rbx
+  802b32:	48 83 ec 28          	sub    $0x28,%rsp
+  802b36:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b36 <close+0x9>
+  802b3d:	49 bb 02 55 00 00 00 	movabs $0x5502,%r11
+  802b44:	00 00 00 
+  802b47:	4c 01 db             	add    %r11,%rbx
+  802b4a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b4d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802b51:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802b54:	48 89 d6             	mov    %rdx,%rsi
+  802b57:	89 c7                	mov    %eax,%edi
+  802b59:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  802b60:	ff ff ff 
+  802b63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b67:	ff d0                	call   *%rax
+  802b69:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b6c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b70:	79 05                	jns    802b77 <close+0x4a>
+		return r;
+  802b72:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b75:	eb 1c                	jmp    802b93 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802b77:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b7b:	be 01 00 00 00       	mov    $0x1,%esi
+  802b80:	48 89 c7             	mov    %rax,%rdi
+  802b83:	48 b8 11 a9 ff ff ff 	movabs $0xffffffffffffa911,%rax
+  802b8a:	ff ff ff 
+  802b8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b91:	ff d0                	call   *%rax
+}
+  802b93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b97:	c9                   	leave
+  802b98:	c3                   	ret
+
+0000000000802b99 <close_all>:
+
+void
+close_all(void)
+{
+  802b99:	55                   	push   %rbp
+  802b9a:	48 89 e5             	mov    %rsp,%rbp
+  802b9d:	53                   	push   %rbx
+  802b9e:	48 83 ec 18          	sub    $0x18,%rsp
+  802ba2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ba2 <close_all+0x9>
+  802ba9:	49 bb 96 54 00 00 00 	movabs $0x5496,%r11
+  802bb0:	00 00 00 
+  802bb3:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802bb6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802bbd:	eb 19                	jmp    802bd8 <close_all+0x3f>
+		close(i);
+  802bbf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bc2:	89 c7                	mov    %eax,%edi
+  802bc4:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  802bcb:	ff ff ff 
+  802bce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bd2:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802bd4:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802bd8:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802bdc:	7e e1                	jle    802bbf <close_all+0x26>
+}
+  802bde:	90                   	nop
+  802bdf:	90                   	nop
+  802be0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802be4:	c9                   	leave
+  802be5:	c3                   	ret
+
+0000000000802be6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802be6:	55                   	push   %rbp
+  802be7:	48 89 e5             	mov    %rsp,%rbp
+  802bea:	41 57                	push   %r15
+  802bec:	53                   	push   %rbx
+  802bed:	48 83 ec 40          	sub    $0x40,%rsp
+  802bf1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802bf1 <dup+0xb>
+  802bf8:	49 bb 47 54 00 00 00 	movabs $0x5447,%r11
+  802bff:	00 00 00 
+  802c02:	4c 01 db             	add    %r11,%rbx
+  802c05:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802c08:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802c0b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c0f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802c12:	48 89 d6             	mov    %rdx,%rsi
+  802c15:	89 c7                	mov    %eax,%edi
+  802c17:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  802c1e:	ff ff ff 
+  802c21:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c25:	ff d0                	call   *%rax
+  802c27:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c2a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c2e:	79 08                	jns    802c38 <dup+0x52>
+		return r;
+  802c30:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c33:	e9 a4 01 00 00       	jmp    802ddc <dup+0x1f6>
+	close(newfdnum);
+  802c38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c3b:	89 c7                	mov    %eax,%edi
+  802c3d:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  802c44:	ff ff ff 
+  802c47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c4b:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802c4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c50:	48 98                	cltq
+  802c52:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802c58:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c5c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802c60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c64:	48 89 c7             	mov    %rax,%rdi
+  802c67:	48 b8 6d a7 ff ff ff 	movabs $0xffffffffffffa76d,%rax
+  802c6e:	ff ff ff 
+  802c71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c75:	ff d0                	call   *%rax
+  802c77:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802c7b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c7f:	48 89 c7             	mov    %rax,%rdi
+  802c82:	48 b8 6d a7 ff ff ff 	movabs $0xffffffffffffa76d,%rax
+  802c89:	ff ff ff 
+  802c8c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c90:	ff d0                	call   *%rax
+  802c92:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802c96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c9a:	48 c1 e8 15          	shr    $0x15,%rax
+  802c9e:	48 89 c2             	mov    %rax,%rdx
+  802ca1:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802ca8:	ff ff ff 
+  802cab:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802caf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cb3:	83 e0 01             	and    $0x1,%eax
+  802cb6:	48 85 c0             	test   %rax,%rax
+  802cb9:	74 7f                	je     802d3a <dup+0x154>
+  802cbb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cbf:	48 c1 e8 0c          	shr    $0xc,%rax
+  802cc3:	48 89 c2             	mov    %rax,%rdx
+  802cc6:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802ccd:	ff ff ff 
+  802cd0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cd4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cd8:	83 e0 01             	and    $0x1,%eax
+  802cdb:	48 85 c0             	test   %rax,%rax
+  802cde:	74 5a                	je     802d3a <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802ce0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ce4:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ce8:	48 89 c2             	mov    %rax,%rdx
+  802ceb:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802cf2:	ff ff ff 
+  802cf5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cf9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cfd:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d02:	89 c1                	mov    %eax,%ecx
+  802d04:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802d08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d0c:	41 89 c8             	mov    %ecx,%r8d
+  802d0f:	48 89 d1             	mov    %rdx,%rcx
+  802d12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d17:	48 89 c6             	mov    %rax,%rsi
+  802d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d1f:	49 89 df             	mov    %rbx,%r15
+  802d22:	48 b8 70 9e ff ff ff 	movabs $0xffffffffffff9e70,%rax
+  802d29:	ff ff ff 
+  802d2c:	48 01 d8             	add    %rbx,%rax
+  802d2f:	ff d0                	call   *%rax
+  802d31:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d34:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d38:	78 5f                	js     802d99 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802d3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d3e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d42:	48 89 c2             	mov    %rax,%rdx
+  802d45:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802d4c:	ff ff ff 
+  802d4f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d53:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d57:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d5c:	89 c1                	mov    %eax,%ecx
+  802d5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d62:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d66:	41 89 c8             	mov    %ecx,%r8d
+  802d69:	48 89 d1             	mov    %rdx,%rcx
+  802d6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d71:	48 89 c6             	mov    %rax,%rsi
+  802d74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d79:	49 89 df             	mov    %rbx,%r15
+  802d7c:	48 b8 70 9e ff ff ff 	movabs $0xffffffffffff9e70,%rax
+  802d83:	ff ff ff 
+  802d86:	48 01 d8             	add    %rbx,%rax
+  802d89:	ff d0                	call   *%rax
+  802d8b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d8e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d92:	78 08                	js     802d9c <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802d94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d97:	eb 43                	jmp    802ddc <dup+0x1f6>
+			goto err;
+  802d99:	90                   	nop
+  802d9a:	eb 01                	jmp    802d9d <dup+0x1b7>
+		goto err;
+  802d9c:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802d9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802da1:	48 89 c6             	mov    %rax,%rsi
+  802da4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da9:	49 89 df             	mov    %rbx,%r15
+  802dac:	48 b8 e3 9e ff ff ff 	movabs $0xffffffffffff9ee3,%rax
+  802db3:	ff ff ff 
+  802db6:	48 01 d8             	add    %rbx,%rax
+  802db9:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802dbb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802dbf:	48 89 c6             	mov    %rax,%rsi
+  802dc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc7:	49 89 df             	mov    %rbx,%r15
+  802dca:	48 b8 e3 9e ff ff ff 	movabs $0xffffffffffff9ee3,%rax
+  802dd1:	ff ff ff 
+  802dd4:	48 01 d8             	add    %rbx,%rax
+  802dd7:	ff d0                	call   *%rax
+	return r;
+  802dd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802ddc:	48 83 c4 40          	add    $0x40,%rsp
+  802de0:	5b                   	pop    %rbx
+  802de1:	41 5f                	pop    %r15
+  802de3:	5d                   	pop    %rbp
+  802de4:	c3                   	ret
+
+0000000000802de5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802de5:	55                   	push   %rbp
+  802de6:	48 89 e5             	mov    %rsp,%rbp
+  802de9:	41 57                	push   %r15
+  802deb:	53                   	push   %rbx
+  802dec:	48 83 ec 40          	sub    $0x40,%rsp
+  802df0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802df0 <read+0xb>
+  802df7:	49 bb 48 52 00 00 00 	movabs $0x5248,%r11
+  802dfe:	00 00 00 
+  802e01:	4c 01 db             	add    %r11,%rbx
+  802e04:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802e07:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e0b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802e0f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802e13:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e16:	48 89 d6             	mov    %rdx,%rsi
+  802e19:	89 c7                	mov    %eax,%edi
+  802e1b:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  802e22:	ff ff ff 
+  802e25:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e29:	ff d0                	call   *%rax
+  802e2b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e2e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e32:	78 28                	js     802e5c <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e38:	8b 00                	mov    (%rax),%eax
+  802e3a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802e3e:	48 89 d6             	mov    %rdx,%rsi
+  802e41:	89 c7                	mov    %eax,%edi
+  802e43:	48 b8 0c aa ff ff ff 	movabs $0xffffffffffffaa0c,%rax
+  802e4a:	ff ff ff 
+  802e4d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e51:	ff d0                	call   *%rax
+  802e53:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e56:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e5a:	79 08                	jns    802e64 <read+0x7f>
+		return r;
+  802e5c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e5f:	e9 8b 00 00 00       	jmp    802eef <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802e64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e68:	8b 40 08             	mov    0x8(%rax),%eax
+  802e6b:	83 e0 03             	and    $0x3,%eax
+  802e6e:	83 f8 01             	cmp    $0x1,%eax
+  802e71:	75 4b                	jne    802ebe <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802e73:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802e7a:	ff ff ff 
+  802e7d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e81:	48 8b 00             	mov    (%rax),%rax
+  802e84:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802e8a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802e8d:	89 c6                	mov    %eax,%esi
+  802e8f:	48 b8 df e4 ff ff ff 	movabs $0xffffffffffffe4df,%rax
+  802e96:	ff ff ff 
+  802e99:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e9d:	48 89 c7             	mov    %rax,%rdi
+  802ea0:	49 89 df             	mov    %rbx,%r15
+  802ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea8:	48 b9 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%rcx
+  802eaf:	ff ff ff 
+  802eb2:	48 01 d9             	add    %rbx,%rcx
+  802eb5:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802eb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ebc:	eb 31                	jmp    802eef <read+0x10a>
+	}
+	if (!dev->dev_read)
+  802ebe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ec2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802ec6:	48 85 c0             	test   %rax,%rax
+  802ec9:	75 07                	jne    802ed2 <read+0xed>
+		return -E_NOT_SUPP;
+  802ecb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802ed0:	eb 1d                	jmp    802eef <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  802ed2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ed6:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802eda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ede:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802ee2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ee6:	48 89 ce             	mov    %rcx,%rsi
+  802ee9:	48 89 c7             	mov    %rax,%rdi
+  802eec:	41 ff d0             	call   *%r8
+}
+  802eef:	48 83 c4 40          	add    $0x40,%rsp
+  802ef3:	5b                   	pop    %rbx
+  802ef4:	41 5f                	pop    %r15
+  802ef6:	5d                   	pop    %rbp
+  802ef7:	c3                   	ret
+
+0000000000802ef8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802ef8:	55                   	push   %rbp
+  802ef9:	48 89 e5             	mov    %rsp,%rbp
+  802efc:	53                   	push   %rbx
+  802efd:	48 83 ec 38          	sub    $0x38,%rsp
+  802f01:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f01 <readn+0x9>
+  802f08:	49 bb 37 51 00 00 00 	movabs $0x5137,%r11
+  802f0f:	00 00 00 
+  802f12:	4c 01 db             	add    %r11,%rbx
+  802f15:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f18:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802f1c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802f20:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802f27:	eb 4b                	jmp    802f74 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802f29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f2c:	48 98                	cltq
+  802f2e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802f32:	48 29 c2             	sub    %rax,%rdx
+  802f35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f38:	48 63 c8             	movslq %eax,%rcx
+  802f3b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f3f:	48 01 c1             	add    %rax,%rcx
+  802f42:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802f45:	48 89 ce             	mov    %rcx,%rsi
+  802f48:	89 c7                	mov    %eax,%edi
+  802f4a:	48 b8 ad ad ff ff ff 	movabs $0xffffffffffffadad,%rax
+  802f51:	ff ff ff 
+  802f54:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f58:	ff d0                	call   *%rax
+  802f5a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  802f5d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802f61:	79 05                	jns    802f68 <readn+0x70>
+			return m;
+  802f63:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802f66:	eb 1d                	jmp    802f85 <readn+0x8d>
+		if (m == 0)
+  802f68:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802f6c:	74 13                	je     802f81 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  802f6e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802f71:	01 45 ec             	add    %eax,-0x14(%rbp)
+  802f74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f77:	48 98                	cltq
+  802f79:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  802f7d:	72 aa                	jb     802f29 <readn+0x31>
+  802f7f:	eb 01                	jmp    802f82 <readn+0x8a>
+			break;
+  802f81:	90                   	nop
+	}
+	return tot;
+  802f82:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f89:	c9                   	leave
+  802f8a:	c3                   	ret
+
+0000000000802f8b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802f8b:	55                   	push   %rbp
+  802f8c:	48 89 e5             	mov    %rsp,%rbp
+  802f8f:	41 57                	push   %r15
+  802f91:	53                   	push   %rbx
+  802f92:	48 83 ec 40          	sub    $0x40,%rsp
+  802f96:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f96 <write+0xb>
+  802f9d:	49 bb a2 50 00 00 00 	movabs $0x50a2,%r11
+  802fa4:	00 00 00 
+  802fa7:	4c 01 db             	add    %r11,%rbx
+  802faa:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802fad:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802fb1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802fb5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802fb9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802fbc:	48 89 d6             	mov    %rdx,%rsi
+  802fbf:	89 c7                	mov    %eax,%edi
+  802fc1:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  802fc8:	ff ff ff 
+  802fcb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fcf:	ff d0                	call   *%rax
+  802fd1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fd4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fd8:	78 28                	js     803002 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fde:	8b 00                	mov    (%rax),%eax
+  802fe0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802fe4:	48 89 d6             	mov    %rdx,%rsi
+  802fe7:	89 c7                	mov    %eax,%edi
+  802fe9:	48 b8 0c aa ff ff ff 	movabs $0xffffffffffffaa0c,%rax
+  802ff0:	ff ff ff 
+  802ff3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ff7:	ff d0                	call   *%rax
+  802ff9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ffc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803000:	79 08                	jns    80300a <write+0x7f>
+		return r;
+  803002:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803005:	e9 8a 00 00 00       	jmp    803094 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80300a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80300e:	8b 40 08             	mov    0x8(%rax),%eax
+  803011:	83 e0 03             	and    $0x3,%eax
+  803014:	85 c0                	test   %eax,%eax
+  803016:	75 4b                	jne    803063 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803018:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80301f:	ff ff ff 
+  803022:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803026:	48 8b 00             	mov    (%rax),%rax
+  803029:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80302f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803032:	89 c6                	mov    %eax,%esi
+  803034:	48 b8 fb e4 ff ff ff 	movabs $0xffffffffffffe4fb,%rax
+  80303b:	ff ff ff 
+  80303e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803042:	48 89 c7             	mov    %rax,%rdi
+  803045:	49 89 df             	mov    %rbx,%r15
+  803048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304d:	48 b9 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%rcx
+  803054:	ff ff ff 
+  803057:	48 01 d9             	add    %rbx,%rcx
+  80305a:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80305c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803061:	eb 31                	jmp    803094 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803063:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803067:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80306b:	48 85 c0             	test   %rax,%rax
+  80306e:	75 07                	jne    803077 <write+0xec>
+		return -E_NOT_SUPP;
+  803070:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803075:	eb 1d                	jmp    803094 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803077:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80307b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80307f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803083:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803087:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80308b:	48 89 ce             	mov    %rcx,%rsi
+  80308e:	48 89 c7             	mov    %rax,%rdi
+  803091:	41 ff d0             	call   *%r8
+}
+  803094:	48 83 c4 40          	add    $0x40,%rsp
+  803098:	5b                   	pop    %rbx
+  803099:	41 5f                	pop    %r15
+  80309b:	5d                   	pop    %rbp
+  80309c:	c3                   	ret
+
+000000000080309d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80309d:	55                   	push   %rbp
+  80309e:	48 89 e5             	mov    %rsp,%rbp
+  8030a1:	48 83 ec 18          	sub    $0x18,%rsp
+  8030a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8030a5 <seek+0x8>
+  8030ac:	49 bb 93 4f 00 00 00 	movabs $0x4f93,%r11
+  8030b3:	00 00 00 
+  8030b6:	4c 01 d8             	add    %r11,%rax
+  8030b9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8030bc:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030bf:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8030c3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8030c6:	48 89 ce             	mov    %rcx,%rsi
+  8030c9:	89 d7                	mov    %edx,%edi
+  8030cb:	48 ba 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rdx
+  8030d2:	ff ff ff 
+  8030d5:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8030d9:	ff d0                	call   *%rax
+  8030db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030e2:	79 05                	jns    8030e9 <seek+0x4c>
+		return r;
+  8030e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030e7:	eb 0f                	jmp    8030f8 <seek+0x5b>
+	fd->fd_offset = offset;
+  8030e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030ed:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8030f0:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8030f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030f8:	c9                   	leave
+  8030f9:	c3                   	ret
+
+00000000008030fa <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8030fa:	55                   	push   %rbp
+  8030fb:	48 89 e5             	mov    %rsp,%rbp
+  8030fe:	41 57                	push   %r15
+  803100:	53                   	push   %rbx
+  803101:	48 83 ec 30          	sub    $0x30,%rsp
+  803105:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803105 <ftruncate+0xb>
+  80310c:	49 bb 33 4f 00 00 00 	movabs $0x4f33,%r11
+  803113:	00 00 00 
+  803116:	4c 01 db             	add    %r11,%rbx
+  803119:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80311c:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80311f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803123:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803126:	48 89 d6             	mov    %rdx,%rsi
+  803129:	89 c7                	mov    %eax,%edi
+  80312b:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  803132:	ff ff ff 
+  803135:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803139:	ff d0                	call   *%rax
+  80313b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80313e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803142:	78 28                	js     80316c <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803144:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803148:	8b 00                	mov    (%rax),%eax
+  80314a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80314e:	48 89 d6             	mov    %rdx,%rsi
+  803151:	89 c7                	mov    %eax,%edi
+  803153:	48 b8 0c aa ff ff ff 	movabs $0xffffffffffffaa0c,%rax
+  80315a:	ff ff ff 
+  80315d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803161:	ff d0                	call   *%rax
+  803163:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803166:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80316a:	79 08                	jns    803174 <ftruncate+0x7a>
+		return r;
+  80316c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80316f:	e9 83 00 00 00       	jmp    8031f7 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803174:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803178:	8b 40 08             	mov    0x8(%rax),%eax
+  80317b:	83 e0 03             	and    $0x3,%eax
+  80317e:	85 c0                	test   %eax,%eax
+  803180:	75 4b                	jne    8031cd <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803182:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803189:	ff ff ff 
+  80318c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803190:	48 8b 00             	mov    (%rax),%rax
+  803193:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803199:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80319c:	89 c6                	mov    %eax,%esi
+  80319e:	48 b8 18 e5 ff ff ff 	movabs $0xffffffffffffe518,%rax
+  8031a5:	ff ff ff 
+  8031a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031ac:	48 89 c7             	mov    %rax,%rdi
+  8031af:	49 89 df             	mov    %rbx,%r15
+  8031b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b7:	48 b9 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%rcx
+  8031be:	ff ff ff 
+  8031c1:	48 01 d9             	add    %rbx,%rcx
+  8031c4:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8031c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031cb:	eb 2a                	jmp    8031f7 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8031cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031d1:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8031d5:	48 85 c0             	test   %rax,%rax
+  8031d8:	75 07                	jne    8031e1 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8031da:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8031df:	eb 16                	jmp    8031f7 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8031e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031e5:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8031e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031ed:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8031f0:	89 d6                	mov    %edx,%esi
+  8031f2:	48 89 c7             	mov    %rax,%rdi
+  8031f5:	ff d1                	call   *%rcx
+}
+  8031f7:	48 83 c4 30          	add    $0x30,%rsp
+  8031fb:	5b                   	pop    %rbx
+  8031fc:	41 5f                	pop    %r15
+  8031fe:	5d                   	pop    %rbp
+  8031ff:	c3                   	ret
+
+0000000000803200 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803200:	55                   	push   %rbp
+  803201:	48 89 e5             	mov    %rsp,%rbp
+  803204:	53                   	push   %rbx
+  803205:	48 83 ec 38          	sub    $0x38,%rsp
+  803209:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803209 <fstat+0x9>
+  803210:	49 bb 2f 4e 00 00 00 	movabs $0x4e2f,%r11
+  803217:	00 00 00 
+  80321a:	4c 01 db             	add    %r11,%rbx
+  80321d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803220:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803224:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803228:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80322b:	48 89 d6             	mov    %rdx,%rsi
+  80322e:	89 c7                	mov    %eax,%edi
+  803230:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  803237:	ff ff ff 
+  80323a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80323e:	ff d0                	call   *%rax
+  803240:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803243:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803247:	78 28                	js     803271 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803249:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80324d:	8b 00                	mov    (%rax),%eax
+  80324f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803253:	48 89 d6             	mov    %rdx,%rsi
+  803256:	89 c7                	mov    %eax,%edi
+  803258:	48 b8 0c aa ff ff ff 	movabs $0xffffffffffffaa0c,%rax
+  80325f:	ff ff ff 
+  803262:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803266:	ff d0                	call   *%rax
+  803268:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80326b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80326f:	79 05                	jns    803276 <fstat+0x76>
+		return r;
+  803271:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803274:	eb 5e                	jmp    8032d4 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803276:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80327a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80327e:	48 85 c0             	test   %rax,%rax
+  803281:	75 07                	jne    80328a <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803283:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803288:	eb 4a                	jmp    8032d4 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80328a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80328e:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803291:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803295:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80329c:	00 00 00 
+	stat->st_isdir = 0;
+  80329f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8032a3:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8032aa:	00 00 00 
+	stat->st_dev = dev;
+  8032ad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8032b1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8032b5:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8032bc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032c0:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8032c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032cc:	48 89 d6             	mov    %rdx,%rsi
+  8032cf:	48 89 c7             	mov    %rax,%rdi
+  8032d2:	ff d1                	call   *%rcx
+}
+  8032d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032d8:	c9                   	leave
+  8032d9:	c3                   	ret
+
+00000000008032da <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8032da:	55                   	push   %rbp
+  8032db:	48 89 e5             	mov    %rsp,%rbp
+  8032de:	41 57                	push   %r15
+  8032e0:	53                   	push   %rbx
+  8032e1:	48 83 ec 20          	sub    $0x20,%rsp
+  8032e5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032e5 <stat+0xb>
+  8032ec:	49 bb 53 4d 00 00 00 	movabs $0x4d53,%r11
+  8032f3:	00 00 00 
+  8032f6:	4c 01 db             	add    %r11,%rbx
+  8032f9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8032fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803301:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803305:	be 00 00 00 00       	mov    $0x0,%esi
+  80330a:	48 89 c7             	mov    %rax,%rdi
+  80330d:	49 89 df             	mov    %rbx,%r15
+  803310:	48 b8 7c b5 ff ff ff 	movabs $0xffffffffffffb57c,%rax
+  803317:	ff ff ff 
+  80331a:	48 01 d8             	add    %rbx,%rax
+  80331d:	ff d0                	call   *%rax
+  80331f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803322:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803326:	79 05                	jns    80332d <stat+0x53>
+		return fd;
+  803328:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80332b:	eb 37                	jmp    803364 <stat+0x8a>
+	r = fstat(fd, stat);
+  80332d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803331:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803334:	48 89 d6             	mov    %rdx,%rsi
+  803337:	89 c7                	mov    %eax,%edi
+  803339:	48 b8 c8 b1 ff ff ff 	movabs $0xffffffffffffb1c8,%rax
+  803340:	ff ff ff 
+  803343:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803347:	ff d0                	call   *%rax
+  803349:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80334c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80334f:	89 c7                	mov    %eax,%edi
+  803351:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  803358:	ff ff ff 
+  80335b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80335f:	ff d0                	call   *%rax
+	return r;
+  803361:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803364:	48 83 c4 20          	add    $0x20,%rsp
+  803368:	5b                   	pop    %rbx
+  803369:	41 5f                	pop    %r15
+  80336b:	5d                   	pop    %rbp
+  80336c:	c3                   	ret
+
+000000000080336d <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80336d:	55                   	push   %rbp
+  80336e:	48 89 e5             	mov    %rsp,%rbp
+  803371:	41 57                	push   %r15
+  803373:	53                   	push   %rbx
+  803374:	48 83 ec 10          	sub    $0x10,%rsp
+  803378:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803378 <fsipc+0xb>
+  80337f:	49 bb c0 4c 00 00 00 	movabs $0x4cc0,%r11
+  803386:	00 00 00 
+  803389:	4c 01 db             	add    %r11,%rbx
+  80338c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80338f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803393:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80339a:	00 00 00 
+  80339d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8033a0:	85 c0                	test   %eax,%eax
+  8033a2:	75 24                	jne    8033c8 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8033a4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8033a9:	49 89 df             	mov    %rbx,%r15
+  8033ac:	48 b8 d5 de ff ff ff 	movabs $0xffffffffffffded5,%rax
+  8033b3:	ff ff ff 
+  8033b6:	48 01 d8             	add    %rbx,%rax
+  8033b9:	ff d0                	call   *%rax
+  8033bb:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  8033c2:	00 00 00 
+  8033c5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8033c8:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8033cf:	00 00 00 
+  8033d2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8033d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033d9:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8033dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8033e2:	49 89 d0             	mov    %rdx,%r8
+  8033e5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8033ea:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  8033f1:	00 00 00 
+  8033f4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8033f8:	89 c7                	mov    %eax,%edi
+  8033fa:	49 89 df             	mov    %rbx,%r15
+  8033fd:	48 b8 f4 d8 ff ff ff 	movabs $0xffffffffffffd8f4,%rax
+  803404:	ff ff ff 
+  803407:	48 01 d8             	add    %rbx,%rax
+  80340a:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  80340c:	48 83 c4 10          	add    $0x10,%rsp
+  803410:	5b                   	pop    %rbx
+  803411:	41 5f                	pop    %r15
+  803413:	5d                   	pop    %rbp
+  803414:	c3                   	ret
+
+0000000000803415 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803415:	55                   	push   %rbp
+  803416:	48 89 e5             	mov    %rsp,%rbp
+  803419:	41 57                	push   %r15
+  80341b:	53                   	push   %rbx
+  80341c:	48 83 ec 20          	sub    $0x20,%rsp
+  803420:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803420 <fsipc_words+0xb>
+  803427:	49 bb 18 4c 00 00 00 	movabs $0x4c18,%r11
+  80342e:	00 00 00 
+  803431:	4c 01 db             	add    %r11,%rbx
+  803434:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803437:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80343b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80343f:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803446:	00 00 00 
+  803449:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80344c:	85 c0                	test   %eax,%eax
+  80344e:	75 24                	jne    803474 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803450:	bf 01 00 00 00       	mov    $0x1,%edi
+  803455:	49 89 df             	mov    %rbx,%r15
+  803458:	48 b8 d5 de ff ff ff 	movabs $0xffffffffffffded5,%rax
+  80345f:	ff ff ff 
+  803462:	48 01 d8             	add    %rbx,%rax
+  803465:	ff d0                	call   *%rax
+  803467:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  80346e:	00 00 00 
+  803471:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803474:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80347b:	00 00 00 
+  80347e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803481:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803485:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803489:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80348c:	89 c7                	mov    %eax,%edi
+  80348e:	49 89 df             	mov    %rbx,%r15
+  803491:	48 b8 df d9 ff ff ff 	movabs $0xffffffffffffd9df,%rax
+  803498:	ff ff ff 
+  80349b:	48 01 d8             	add    %rbx,%rax
+  80349e:	ff d0                	call   *%rax
+}
+  8034a0:	48 83 c4 20          	add    $0x20,%rsp
+  8034a4:	5b                   	pop    %rbx
+  8034a5:	41 5f                	pop    %r15
+  8034a7:	5d                   	pop    %rbp
+  8034a8:	c3                   	ret
+
+00000000008034a9 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8034a9:	55                   	push   %rbp
+  8034aa:	48 89 e5             	mov    %rsp,%rbp
+  8034ad:	41 57                	push   %r15
+  8034af:	53                   	push   %rbx
+  8034b0:	48 83 ec 40          	sub    $0x40,%rsp
+  8034b4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034b4 <fsipc_pages+0xb>
+  8034bb:	49 bb 84 4b 00 00 00 	movabs $0x4b84,%r11
+  8034c2:	00 00 00 
+  8034c5:	4c 01 db             	add    %r11,%rbx
+  8034c8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8034cb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8034cf:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8034d3:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8034d6:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8034dd:	00 00 00 
+  8034e0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8034e3:	85 c0                	test   %eax,%eax
+  8034e5:	75 24                	jne    80350b <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034e7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034ec:	49 89 df             	mov    %rbx,%r15
+  8034ef:	48 b8 d5 de ff ff ff 	movabs $0xffffffffffffded5,%rax
+  8034f6:	ff ff ff 
+  8034f9:	48 01 d8             	add    %rbx,%rax
+  8034fc:	ff d0                	call   *%rax
+  8034fe:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  803505:	00 00 00 
+  803508:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  80350b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803510:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803514:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803517:	48 98                	cltq
+  803519:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80351d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803521:	0f 95 c0             	setne  %al
+  803524:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803527:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80352e:	00 
+  80352f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803533:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803537:	48 01 d0             	add    %rdx,%rax
+  80353a:	48 83 e8 01          	sub    $0x1,%rax
+  80353e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803542:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803546:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354b:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80354f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803553:	48 29 d0             	sub    %rdx,%rax
+  803556:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  80355a:	41 89 c2             	mov    %eax,%r10d
+  80355d:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803564:	00 00 00 
+  803567:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80356a:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80356e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803572:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803575:	48 83 ec 08          	sub    $0x8,%rsp
+  803579:	6a 40                	push   $0x40
+  80357b:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803580:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803587:	00 
+  803588:	6a 05                	push   $0x5
+  80358a:	41 89 f9             	mov    %edi,%r9d
+  80358d:	49 89 c8             	mov    %rcx,%r8
+  803590:	44 89 d1             	mov    %r10d,%ecx
+  803593:	89 c7                	mov    %eax,%edi
+  803595:	49 89 df             	mov    %rbx,%r15
+  803598:	48 b8 dd da ff ff ff 	movabs $0xffffffffffffdadd,%rax
+  80359f:	ff ff ff 
+  8035a2:	48 01 d8             	add    %rbx,%rax
+  8035a5:	ff d0                	call   *%rax
+  8035a7:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8035ab:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8035af:	5b                   	pop    %rbx
+  8035b0:	41 5f                	pop    %r15
+  8035b2:	5d                   	pop    %rbp
+  8035b3:	c3                   	ret
+
+00000000008035b4 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8035b4:	55                   	push   %rbp
+  8035b5:	48 89 e5             	mov    %rsp,%rbp
+  8035b8:	41 57                	push   %r15
+  8035ba:	53                   	push   %rbx
+  8035bb:	48 83 ec 20          	sub    $0x20,%rsp
+  8035bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035bf <open+0xb>
+  8035c6:	49 bb 79 4a 00 00 00 	movabs $0x4a79,%r11
+  8035cd:	00 00 00 
+  8035d0:	4c 01 db             	add    %r11,%rbx
+  8035d3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8035d7:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8035da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035de:	48 89 c7             	mov    %rax,%rdi
+  8035e1:	49 89 df             	mov    %rbx,%r15
+  8035e4:	48 b8 bb 90 ff ff ff 	movabs $0xffffffffffff90bb,%rax
+  8035eb:	ff ff ff 
+  8035ee:	48 01 d8             	add    %rbx,%rax
+  8035f1:	ff d0                	call   *%rax
+  8035f3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8035f8:	7e 0a                	jle    803604 <open+0x50>
+		return -E_BAD_PATH;
+  8035fa:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8035ff:	e9 18 01 00 00       	jmp    80371c <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803604:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803608:	48 89 c7             	mov    %rax,%rdi
+  80360b:	49 89 df             	mov    %rbx,%r15
+  80360e:	48 b8 b0 a7 ff ff ff 	movabs $0xffffffffffffa7b0,%rax
+  803615:	ff ff ff 
+  803618:	48 01 d8             	add    %rbx,%rax
+  80361b:	ff d0                	call   *%rax
+  80361d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803620:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803624:	74 08                	je     80362e <open+0x7a>
+		return r;
+  803626:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803629:	e9 ee 00 00 00       	jmp    80371c <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80362e:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803635:	00 00 00 
+  803638:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80363b:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  803642:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803646:	48 89 c6             	mov    %rax,%rsi
+  803649:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803650:	00 00 00 
+  803653:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803657:	48 89 c7             	mov    %rax,%rdi
+  80365a:	49 89 df             	mov    %rbx,%r15
+  80365d:	48 b8 4f 91 ff ff ff 	movabs $0xffffffffffff914f,%rax
+  803664:	ff ff ff 
+  803667:	48 01 d8             	add    %rbx,%rax
+  80366a:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  80366c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803670:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803675:	48 89 c6             	mov    %rax,%rsi
+  803678:	bf 00 00 00 00       	mov    $0x0,%edi
+  80367d:	49 89 df             	mov    %rbx,%r15
+  803680:	48 b8 0b 9e ff ff ff 	movabs $0xffffffffffff9e0b,%rax
+  803687:	ff ff ff 
+  80368a:	48 01 d8             	add    %rbx,%rax
+  80368d:	ff d0                	call   *%rax
+  80368f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803692:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803696:	74 23                	je     8036bb <open+0x107>
+		fd_close(fd,0);
+  803698:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80369c:	be 00 00 00 00       	mov    $0x0,%esi
+  8036a1:	48 89 c7             	mov    %rax,%rdi
+  8036a4:	49 89 df             	mov    %rbx,%r15
+  8036a7:	48 b8 11 a9 ff ff ff 	movabs $0xffffffffffffa911,%rax
+  8036ae:	ff ff ff 
+  8036b1:	48 01 d8             	add    %rbx,%rax
+  8036b4:	ff d0                	call   *%rax
+		return r;
+  8036b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036b9:	eb 61                	jmp    80371c <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8036bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036bf:	48 89 c6             	mov    %rax,%rsi
+  8036c2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8036c7:	48 b8 35 b3 ff ff ff 	movabs $0xffffffffffffb335,%rax
+  8036ce:	ff ff ff 
+  8036d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036d5:	ff d0                	call   *%rax
+  8036d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8036da:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036de:	74 23                	je     803703 <open+0x14f>
+		fd_close(fd,0);
+  8036e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8036e9:	48 89 c7             	mov    %rax,%rdi
+  8036ec:	49 89 df             	mov    %rbx,%r15
+  8036ef:	48 b8 11 a9 ff ff ff 	movabs $0xffffffffffffa911,%rax
+  8036f6:	ff ff ff 
+  8036f9:	48 01 d8             	add    %rbx,%rax
+  8036fc:	ff d0                	call   *%rax
+		return r;
+  8036fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803701:	eb 19                	jmp    80371c <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803703:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803707:	48 89 c7             	mov    %rax,%rdi
+  80370a:	49 89 df             	mov    %rbx,%r15
+  80370d:	48 b8 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rax
+  803714:	ff ff ff 
+  803717:	48 01 d8             	add    %rbx,%rax
+  80371a:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  80371c:	48 83 c4 20          	add    $0x20,%rsp
+  803720:	5b                   	pop    %rbx
+  803721:	41 5f                	pop    %r15
+  803723:	5d                   	pop    %rbp
+  803724:	c3                   	ret
+
+0000000000803725 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803725:	55                   	push   %rbp
+  803726:	48 89 e5             	mov    %rsp,%rbp
+  803729:	48 83 ec 20          	sub    $0x20,%rsp
+  80372d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80372d <devfile_flush+0x8>
+  803734:	49 bb 0b 49 00 00 00 	movabs $0x490b,%r11
+  80373b:	00 00 00 
+  80373e:	4c 01 d8             	add    %r11,%rax
+  803741:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803745:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803749:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80374c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  80374f:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803753:	ba 04 00 00 00       	mov    $0x4,%edx
+  803758:	48 89 ce             	mov    %rcx,%rsi
+  80375b:	bf 06 00 00 00       	mov    $0x6,%edi
+  803760:	48 b9 dd b3 ff ff ff 	movabs $0xffffffffffffb3dd,%rcx
+  803767:	ff ff ff 
+  80376a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80376e:	ff d0                	call   *%rax
+}
+  803770:	c9                   	leave
+  803771:	c3                   	ret
+
+0000000000803772 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803772:	55                   	push   %rbp
+  803773:	48 89 e5             	mov    %rsp,%rbp
+  803776:	41 57                	push   %r15
+  803778:	53                   	push   %rbx
+  803779:	48 83 ec 60          	sub    $0x60,%rsp
+  80377d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80377d <devfile_read+0xb>
+  803784:	49 bb bb 48 00 00 00 	movabs $0x48bb,%r11
+  80378b:	00 00 00 
+  80378e:	4c 01 db             	add    %r11,%rbx
+  803791:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803795:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803799:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80379d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8037a1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  8037a5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8037a9:	8b 50 0c             	mov    0xc(%rax),%edx
+  8037ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037b0:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8037b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037b6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8037ba:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8037be:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8037c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037c7:	ba 10 00 00 00       	mov    $0x10,%edx
+  8037cc:	48 89 c6             	mov    %rax,%rsi
+  8037cf:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037d4:	48 b8 71 b4 ff ff ff 	movabs $0xffffffffffffb471,%rax
+  8037db:	ff ff ff 
+  8037de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037e2:	ff d0                	call   *%rax
+  8037e4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8037e7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8037eb:	79 05                	jns    8037f2 <devfile_read+0x80>
+		return r;
+  8037ed:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8037f0:	eb 64                	jmp    803856 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8037f2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8037f5:	48 63 d0             	movslq %eax,%rdx
+  8037f8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037fc:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803801:	48 01 c1             	add    %rax,%rcx
+  803804:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803808:	48 89 ce             	mov    %rcx,%rsi
+  80380b:	48 89 c7             	mov    %rax,%rdi
+  80380e:	49 89 df             	mov    %rbx,%r15
+  803811:	48 b8 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rax
+  803818:	ff ff ff 
+  80381b:	48 01 d8             	add    %rbx,%rax
+  80381e:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803820:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803827:	ff ff ff 
+  80382a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80382e:	48 8b 00             	mov    (%rax),%rax
+  803831:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803837:	89 c6                	mov    %eax,%esi
+  803839:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  80383e:	48 89 c7             	mov    %rax,%rdi
+  803841:	49 89 df             	mov    %rbx,%r15
+  803844:	48 b8 8f de ff ff ff 	movabs $0xffffffffffffde8f,%rax
+  80384b:	ff ff ff 
+  80384e:	48 01 d8             	add    %rbx,%rax
+  803851:	ff d0                	call   *%rax
+	return r;
+  803853:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803856:	48 83 c4 60          	add    $0x60,%rsp
+  80385a:	5b                   	pop    %rbx
+  80385b:	41 5f                	pop    %r15
+  80385d:	5d                   	pop    %rbp
+  80385e:	c3                   	ret
+
+000000000080385f <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80385f:	55                   	push   %rbp
+  803860:	48 89 e5             	mov    %rsp,%rbp
+  803863:	41 57                	push   %r15
+  803865:	53                   	push   %rbx
+  803866:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  80386a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80386a <devfile_write+0xb>
+  803871:	49 bb ce 47 00 00 00 	movabs $0x47ce,%r11
+  803878:	00 00 00 
+  80387b:	4c 01 db             	add    %r11,%rbx
+  80387e:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803882:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803886:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  80388d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803891:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803895:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  80389c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8038a0:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  8038a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038aa:	48 63 d0             	movslq %eax,%rdx
+  8038ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038b1:	48 39 c2             	cmp    %rax,%rdx
+  8038b4:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8038b8:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8038bf:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  8038c6:	00 
+  8038c7:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8038ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038d2:	48 01 d0             	add    %rdx,%rax
+  8038d5:	48 83 e8 01          	sub    $0x1,%rax
+  8038d9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8038dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038e6:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8038ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ee:	48 29 d0             	sub    %rdx,%rax
+  8038f1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038f5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8038f8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8038fb:	89 c6                	mov    %eax,%esi
+  8038fd:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803902:	48 89 c7             	mov    %rax,%rdi
+  803905:	49 89 df             	mov    %rbx,%r15
+  803908:	48 b8 49 de ff ff ff 	movabs $0xffffffffffffde49,%rax
+  80390f:	ff ff ff 
+  803912:	48 01 d8             	add    %rbx,%rax
+  803915:	ff d0                	call   *%rax
+  803917:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  80391a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  80391e:	79 08                	jns    803928 <devfile_write+0xc9>
+		return r;
+  803920:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803923:	e9 8f 00 00 00       	jmp    8039b7 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803928:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80392f:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803933:	48 89 c6             	mov    %rax,%rsi
+  803936:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80393b:	48 89 c7             	mov    %rax,%rdi
+  80393e:	49 89 df             	mov    %rbx,%r15
+  803941:	48 b8 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rax
+  803948:	ff ff ff 
+  80394b:	48 01 d8             	add    %rbx,%rax
+  80394e:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803950:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803954:	8b 50 0c             	mov    0xc(%rax),%edx
+  803957:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80395b:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80395d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803961:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803968:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  80396c:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80396f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803973:	89 d1                	mov    %edx,%ecx
+  803975:	ba 10 00 00 00       	mov    $0x10,%edx
+  80397a:	48 89 c6             	mov    %rax,%rsi
+  80397d:	bf 04 00 00 00       	mov    $0x4,%edi
+  803982:	48 b8 71 b4 ff ff ff 	movabs $0xffffffffffffb471,%rax
+  803989:	ff ff ff 
+  80398c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803990:	ff d0                	call   *%rax
+  803992:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803995:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803998:	89 c6                	mov    %eax,%esi
+  80399a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80399f:	48 89 c7             	mov    %rax,%rdi
+  8039a2:	49 89 df             	mov    %rbx,%r15
+  8039a5:	48 b8 8f de ff ff ff 	movabs $0xffffffffffffde8f,%rax
+  8039ac:	ff ff ff 
+  8039af:	48 01 d8             	add    %rbx,%rax
+  8039b2:	ff d0                	call   *%rax
+	return r;
+  8039b4:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  8039b7:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  8039bb:	5b                   	pop    %rbx
+  8039bc:	41 5f                	pop    %r15
+  8039be:	5d                   	pop    %rbp
+  8039bf:	c3                   	ret
+
+00000000008039c0 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  8039c0:	55                   	push   %rbp
+  8039c1:	48 89 e5             	mov    %rsp,%rbp
+  8039c4:	41 57                	push   %r15
+  8039c6:	53                   	push   %rbx
+  8039c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8039cb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039cb <devfile_stat+0xb>
+  8039d2:	49 bb 6d 46 00 00 00 	movabs $0x466d,%r11
+  8039d9:	00 00 00 
+  8039dc:	4c 01 db             	add    %r11,%rbx
+  8039df:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8039e3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8039e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039eb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8039ee:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  8039f5:	00 00 00 
+  8039f8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8039fb:	be 00 00 00 00       	mov    $0x0,%esi
+  803a00:	bf 05 00 00 00       	mov    $0x5,%edi
+  803a05:	48 b8 35 b3 ff ff ff 	movabs $0xffffffffffffb335,%rax
+  803a0c:	ff ff ff 
+  803a0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a13:	ff d0                	call   *%rax
+  803a15:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a18:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a1c:	79 05                	jns    803a23 <devfile_stat+0x63>
+		return r;
+  803a1e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a21:	eb 65                	jmp    803a88 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803a23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a27:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803a2e:	00 00 00 
+  803a31:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803a35:	48 89 d6             	mov    %rdx,%rsi
+  803a38:	48 89 c7             	mov    %rax,%rdi
+  803a3b:	49 89 df             	mov    %rbx,%r15
+  803a3e:	48 b8 4f 91 ff ff ff 	movabs $0xffffffffffff914f,%rax
+  803a45:	ff ff ff 
+  803a48:	48 01 d8             	add    %rbx,%rax
+  803a4b:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803a4d:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803a54:	00 00 00 
+  803a57:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803a5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a62:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803a68:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803a6f:	00 00 00 
+  803a72:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803a79:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a7d:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803a83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a88:	48 83 c4 20          	add    $0x20,%rsp
+  803a8c:	5b                   	pop    %rbx
+  803a8d:	41 5f                	pop    %r15
+  803a8f:	5d                   	pop    %rbp
+  803a90:	c3                   	ret
+
+0000000000803a91 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803a91:	55                   	push   %rbp
+  803a92:	48 89 e5             	mov    %rsp,%rbp
+  803a95:	48 83 ec 20          	sub    $0x20,%rsp
+  803a99:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a99 <devfile_trunc+0x8>
+  803aa0:	49 bb 9f 45 00 00 00 	movabs $0x459f,%r11
+  803aa7:	00 00 00 
+  803aaa:	4c 01 d8             	add    %r11,%rax
+  803aad:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803ab1:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803ab4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803ab8:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803abb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803abe:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803ac1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803ac4:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803ac8:	ba 08 00 00 00       	mov    $0x8,%edx
+  803acd:	48 89 ce             	mov    %rcx,%rsi
+  803ad0:	bf 02 00 00 00       	mov    $0x2,%edi
+  803ad5:	48 b9 dd b3 ff ff ff 	movabs $0xffffffffffffb3dd,%rcx
+  803adc:	ff ff ff 
+  803adf:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803ae3:	ff d0                	call   *%rax
+}
+  803ae5:	c9                   	leave
+  803ae6:	c3                   	ret
+
+0000000000803ae7 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803ae7:	55                   	push   %rbp
+  803ae8:	48 89 e5             	mov    %rsp,%rbp
+  803aeb:	41 57                	push   %r15
+  803aed:	53                   	push   %rbx
+  803aee:	48 83 ec 10          	sub    $0x10,%rsp
+  803af2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803af2 <remove+0xb>
+  803af9:	49 bb 46 45 00 00 00 	movabs $0x4546,%r11
+  803b00:	00 00 00 
+  803b03:	4c 01 db             	add    %r11,%rbx
+  803b06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803b0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b0e:	48 89 c7             	mov    %rax,%rdi
+  803b11:	49 89 df             	mov    %rbx,%r15
+  803b14:	48 b8 bb 90 ff ff ff 	movabs $0xffffffffffff90bb,%rax
+  803b1b:	ff ff ff 
+  803b1e:	48 01 d8             	add    %rbx,%rax
+  803b21:	ff d0                	call   *%rax
+  803b23:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803b28:	7e 07                	jle    803b31 <remove+0x4a>
+		return -E_BAD_PATH;
+  803b2a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803b2f:	eb 44                	jmp    803b75 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803b31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b35:	48 89 c6             	mov    %rax,%rsi
+  803b38:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803b3f:	00 00 00 
+  803b42:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b46:	48 89 c7             	mov    %rax,%rdi
+  803b49:	49 89 df             	mov    %rbx,%r15
+  803b4c:	48 b8 4f 91 ff ff ff 	movabs $0xffffffffffff914f,%rax
+  803b53:	ff ff ff 
+  803b56:	48 01 d8             	add    %rbx,%rax
+  803b59:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803b5b:	be 00 00 00 00       	mov    $0x0,%esi
+  803b60:	bf 07 00 00 00       	mov    $0x7,%edi
+  803b65:	48 b8 35 b3 ff ff ff 	movabs $0xffffffffffffb335,%rax
+  803b6c:	ff ff ff 
+  803b6f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b73:	ff d0                	call   *%rax
+}
+  803b75:	48 83 c4 10          	add    $0x10,%rsp
+  803b79:	5b                   	pop    %rbx
+  803b7a:	41 5f                	pop    %r15
+  803b7c:	5d                   	pop    %rbp
+  803b7d:	c3                   	ret
+
+0000000000803b7e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803b7e:	55                   	push   %rbp
+  803b7f:	48 89 e5             	mov    %rsp,%rbp
+  803b82:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b82 <sync+0x4>
+  803b89:	49 bb b6 44 00 00 00 	movabs $0x44b6,%r11
+  803b90:	00 00 00 
+  803b93:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803b96:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b9b:	be 00 00 00 00       	mov    $0x0,%esi
+  803ba0:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ba5:	48 b9 dd b3 ff ff ff 	movabs $0xffffffffffffb3dd,%rcx
+  803bac:	ff ff ff 
+  803baf:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803bb3:	ff d0                	call   *%rax
+}
+  803bb5:	5d                   	pop    %rbp
+  803bb6:	c3                   	ret
+
+0000000000803bb7 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803bb7:	55                   	push   %rbp
+  803bb8:	48 89 e5             	mov    %rsp,%rbp
+  803bbb:	41 57                	push   %r15
+  803bbd:	53                   	push   %rbx
+  803bbe:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803bc5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bc5 <copy+0xe>
+  803bcc:	49 bb 73 44 00 00 00 	movabs $0x4473,%r11
+  803bd3:	00 00 00 
+  803bd6:	4c 01 db             	add    %r11,%rbx
+  803bd9:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803be0:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803be7:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803bee:	be 00 00 00 00       	mov    $0x0,%esi
+  803bf3:	48 89 c7             	mov    %rax,%rdi
+  803bf6:	48 b8 7c b5 ff ff ff 	movabs $0xffffffffffffb57c,%rax
+  803bfd:	ff ff ff 
+  803c00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c04:	ff d0                	call   *%rax
+  803c06:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803c09:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c0d:	79 35                	jns    803c44 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803c0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c12:	89 c6                	mov    %eax,%esi
+  803c14:	48 b8 3e e5 ff ff ff 	movabs $0xffffffffffffe53e,%rax
+  803c1b:	ff ff ff 
+  803c1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c22:	48 89 c7             	mov    %rax,%rdi
+  803c25:	49 89 df             	mov    %rbx,%r15
+  803c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c2d:	48 ba 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%rdx
+  803c34:	ff ff ff 
+  803c37:	48 01 da             	add    %rbx,%rdx
+  803c3a:	ff d2                	call   *%rdx
+		return fd_src;
+  803c3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c3f:	e9 d7 01 00 00       	jmp    803e1b <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803c44:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803c4b:	be 01 01 00 00       	mov    $0x101,%esi
+  803c50:	48 89 c7             	mov    %rax,%rdi
+  803c53:	48 b8 7c b5 ff ff ff 	movabs $0xffffffffffffb57c,%rax
+  803c5a:	ff ff ff 
+  803c5d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c61:	ff d0                	call   *%rax
+  803c63:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803c66:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803c6a:	0f 89 df 00 00 00    	jns    803d4f <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803c70:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803c73:	89 c6                	mov    %eax,%esi
+  803c75:	48 b8 54 e5 ff ff ff 	movabs $0xffffffffffffe554,%rax
+  803c7c:	ff ff ff 
+  803c7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c83:	48 89 c7             	mov    %rax,%rdi
+  803c86:	49 89 df             	mov    %rbx,%r15
+  803c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c8e:	48 ba 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%rdx
+  803c95:	ff ff ff 
+  803c98:	48 01 da             	add    %rbx,%rdx
+  803c9b:	ff d2                	call   *%rdx
+		close(fd_src);
+  803c9d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ca0:	89 c7                	mov    %eax,%edi
+  803ca2:	49 89 df             	mov    %rbx,%r15
+  803ca5:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  803cac:	ff ff ff 
+  803caf:	48 01 d8             	add    %rbx,%rax
+  803cb2:	ff d0                	call   *%rax
+		return fd_dest;
+  803cb4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803cb7:	e9 5f 01 00 00       	jmp    803e1b <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803cbc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803cbf:	48 63 d0             	movslq %eax,%rdx
+  803cc2:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803cc9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ccc:	48 89 ce             	mov    %rcx,%rsi
+  803ccf:	89 c7                	mov    %eax,%edi
+  803cd1:	49 89 df             	mov    %rbx,%r15
+  803cd4:	48 b8 53 af ff ff ff 	movabs $0xffffffffffffaf53,%rax
+  803cdb:	ff ff ff 
+  803cde:	48 01 d8             	add    %rbx,%rax
+  803ce1:	ff d0                	call   *%rax
+  803ce3:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803ce6:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803cea:	79 63                	jns    803d4f <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803cec:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803cef:	89 c6                	mov    %eax,%esi
+  803cf1:	48 b8 6e e5 ff ff ff 	movabs $0xffffffffffffe56e,%rax
+  803cf8:	ff ff ff 
+  803cfb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cff:	48 89 c7             	mov    %rax,%rdi
+  803d02:	49 89 df             	mov    %rbx,%r15
+  803d05:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d0a:	48 ba 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%rdx
+  803d11:	ff ff ff 
+  803d14:	48 01 da             	add    %rbx,%rdx
+  803d17:	ff d2                	call   *%rdx
+			close(fd_src);
+  803d19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d1c:	89 c7                	mov    %eax,%edi
+  803d1e:	49 89 df             	mov    %rbx,%r15
+  803d21:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  803d28:	ff ff ff 
+  803d2b:	48 01 d8             	add    %rbx,%rax
+  803d2e:	ff d0                	call   *%rax
+			close(fd_dest);
+  803d30:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d33:	89 c7                	mov    %eax,%edi
+  803d35:	49 89 df             	mov    %rbx,%r15
+  803d38:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  803d3f:	ff ff ff 
+  803d42:	48 01 d8             	add    %rbx,%rax
+  803d45:	ff d0                	call   *%rax
+			return write_size;
+  803d47:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803d4a:	e9 cc 00 00 00       	jmp    803e1b <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803d4f:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803d56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d59:	ba 00 02 00 00       	mov    $0x200,%edx
+  803d5e:	48 89 ce             	mov    %rcx,%rsi
+  803d61:	89 c7                	mov    %eax,%edi
+  803d63:	49 89 df             	mov    %rbx,%r15
+  803d66:	48 b8 ad ad ff ff ff 	movabs $0xffffffffffffadad,%rax
+  803d6d:	ff ff ff 
+  803d70:	48 01 d8             	add    %rbx,%rax
+  803d73:	ff d0                	call   *%rax
+  803d75:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803d78:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803d7c:	0f 8f 3a ff ff ff    	jg     803cbc <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803d82:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803d86:	79 60                	jns    803de8 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803d88:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803d8b:	89 c6                	mov    %eax,%esi
+  803d8d:	48 b8 81 e5 ff ff ff 	movabs $0xffffffffffffe581,%rax
+  803d94:	ff ff ff 
+  803d97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d9b:	48 89 c7             	mov    %rax,%rdi
+  803d9e:	49 89 df             	mov    %rbx,%r15
+  803da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803da6:	48 ba 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%rdx
+  803dad:	ff ff ff 
+  803db0:	48 01 da             	add    %rbx,%rdx
+  803db3:	ff d2                	call   *%rdx
+		close(fd_src);
+  803db5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803db8:	89 c7                	mov    %eax,%edi
+  803dba:	49 89 df             	mov    %rbx,%r15
+  803dbd:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  803dc4:	ff ff ff 
+  803dc7:	48 01 d8             	add    %rbx,%rax
+  803dca:	ff d0                	call   *%rax
+		close(fd_dest);
+  803dcc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803dcf:	89 c7                	mov    %eax,%edi
+  803dd1:	49 89 df             	mov    %rbx,%r15
+  803dd4:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  803ddb:	ff ff ff 
+  803dde:	48 01 d8             	add    %rbx,%rax
+  803de1:	ff d0                	call   *%rax
+		return read_size;
+  803de3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803de6:	eb 33                	jmp    803e1b <copy+0x264>
+	}
+	close(fd_src);
+  803de8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803deb:	89 c7                	mov    %eax,%edi
+  803ded:	49 89 df             	mov    %rbx,%r15
+  803df0:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  803df7:	ff ff ff 
+  803dfa:	48 01 d8             	add    %rbx,%rax
+  803dfd:	ff d0                	call   *%rax
+	close(fd_dest);
+  803dff:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e02:	89 c7                	mov    %eax,%edi
+  803e04:	49 89 df             	mov    %rbx,%r15
+  803e07:	48 b8 f5 aa ff ff ff 	movabs $0xffffffffffffaaf5,%rax
+  803e0e:	ff ff ff 
+  803e11:	48 01 d8             	add    %rbx,%rax
+  803e14:	ff d0                	call   *%rax
+	return 0;
+  803e16:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803e1b:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803e22:	5b                   	pop    %rbx
+  803e23:	41 5f                	pop    %r15
+  803e25:	5d                   	pop    %rbp
+  803e26:	c3                   	ret
+
+0000000000803e27 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  803e27:	55                   	push   %rbp
+  803e28:	48 89 e5             	mov    %rsp,%rbp
+  803e2b:	41 57                	push   %r15
+  803e2d:	53                   	push   %rbx
+  803e2e:	48 83 ec 20          	sub    $0x20,%rsp
+  803e32:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e32 <fd2sockid+0xb>
+  803e39:	49 bb 06 42 00 00 00 	movabs $0x4206,%r11
+  803e40:	00 00 00 
+  803e43:	4c 01 db             	add    %r11,%rbx
+  803e46:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803e49:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803e4d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e50:	48 89 d6             	mov    %rdx,%rsi
+  803e53:	89 c7                	mov    %eax,%edi
+  803e55:	49 89 df             	mov    %rbx,%r15
+  803e58:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  803e5f:	ff ff ff 
+  803e62:	48 01 d8             	add    %rbx,%rax
+  803e65:	ff d0                	call   *%rax
+  803e67:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e6a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e6e:	79 05                	jns    803e75 <fd2sockid+0x4e>
+		return r;
+  803e70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e73:	eb 25                	jmp    803e9a <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803e75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e79:	8b 10                	mov    (%rax),%edx
+  803e7b:	48 b8 88 00 00 00 00 	movabs $0x88,%rax
+  803e82:	00 00 00 
+  803e85:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803e88:	39 c2                	cmp    %eax,%edx
+  803e8a:	74 07                	je     803e93 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  803e8c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803e91:	eb 07                	jmp    803e9a <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  803e93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e97:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  803e9a:	48 83 c4 20          	add    $0x20,%rsp
+  803e9e:	5b                   	pop    %rbx
+  803e9f:	41 5f                	pop    %r15
+  803ea1:	5d                   	pop    %rbp
+  803ea2:	c3                   	ret
+
+0000000000803ea3 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  803ea3:	55                   	push   %rbp
+  803ea4:	48 89 e5             	mov    %rsp,%rbp
+  803ea7:	41 57                	push   %r15
+  803ea9:	53                   	push   %rbx
+  803eaa:	48 83 ec 20          	sub    $0x20,%rsp
+  803eae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803eae <alloc_sockfd+0xb>
+  803eb5:	49 bb 8a 41 00 00 00 	movabs $0x418a,%r11
+  803ebc:	00 00 00 
+  803ebf:	4c 01 db             	add    %r11,%rbx
+  803ec2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  803ec5:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803ec9:	48 89 c7             	mov    %rax,%rdi
+  803ecc:	49 89 df             	mov    %rbx,%r15
+  803ecf:	48 b8 b0 a7 ff ff ff 	movabs $0xffffffffffffa7b0,%rax
+  803ed6:	ff ff ff 
+  803ed9:	48 01 d8             	add    %rbx,%rax
+  803edc:	ff d0                	call   *%rax
+  803ede:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ee1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ee5:	78 2c                	js     803f13 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803ee7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803eeb:	ba 07 04 00 00       	mov    $0x407,%edx
+  803ef0:	48 89 c6             	mov    %rax,%rsi
+  803ef3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ef8:	49 89 df             	mov    %rbx,%r15
+  803efb:	48 b8 0b 9e ff ff ff 	movabs $0xffffffffffff9e0b,%rax
+  803f02:	ff ff ff 
+  803f05:	48 01 d8             	add    %rbx,%rax
+  803f08:	ff d0                	call   *%rax
+  803f0a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f0d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f11:	79 1c                	jns    803f2f <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  803f13:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f16:	89 c7                	mov    %eax,%edi
+  803f18:	49 89 df             	mov    %rbx,%r15
+  803f1b:	48 b8 5f c6 ff ff ff 	movabs $0xffffffffffffc65f,%rax
+  803f22:	ff ff ff 
+  803f25:	48 01 d8             	add    %rbx,%rax
+  803f28:	ff d0                	call   *%rax
+		return r;
+  803f2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f2d:	eb 41                	jmp    803f70 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  803f2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f33:	48 ba 88 00 00 00 00 	movabs $0x88,%rdx
+  803f3a:	00 00 00 
+  803f3d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803f40:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  803f42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f46:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  803f4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f51:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803f54:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  803f57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f5b:	48 89 c7             	mov    %rax,%rdi
+  803f5e:	49 89 df             	mov    %rbx,%r15
+  803f61:	48 b8 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rax
+  803f68:	ff ff ff 
+  803f6b:	48 01 d8             	add    %rbx,%rax
+  803f6e:	ff d0                	call   *%rax
+}
+  803f70:	48 83 c4 20          	add    $0x20,%rsp
+  803f74:	5b                   	pop    %rbx
+  803f75:	41 5f                	pop    %r15
+  803f77:	5d                   	pop    %rbp
+  803f78:	c3                   	ret
+
+0000000000803f79 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803f79:	55                   	push   %rbp
+  803f7a:	48 89 e5             	mov    %rsp,%rbp
+  803f7d:	41 57                	push   %r15
+  803f7f:	53                   	push   %rbx
+  803f80:	48 83 ec 30          	sub    $0x30,%rsp
+  803f84:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f84 <accept+0xb>
+  803f8b:	49 bb b4 40 00 00 00 	movabs $0x40b4,%r11
+  803f92:	00 00 00 
+  803f95:	4c 01 db             	add    %r11,%rbx
+  803f98:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803f9b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803f9f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  803fa3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803fa6:	89 c7                	mov    %eax,%edi
+  803fa8:	48 b8 ef bd ff ff ff 	movabs $0xffffffffffffbdef,%rax
+  803faf:	ff ff ff 
+  803fb2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fb6:	ff d0                	call   *%rax
+  803fb8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fbb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fbf:	79 05                	jns    803fc6 <accept+0x4d>
+		return r;
+  803fc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fc4:	eb 45                	jmp    80400b <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803fc6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803fca:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803fce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fd1:	48 89 ce             	mov    %rcx,%rsi
+  803fd4:	89 c7                	mov    %eax,%edi
+  803fd6:	49 89 df             	mov    %rbx,%r15
+  803fd9:	48 b8 cd c4 ff ff ff 	movabs $0xffffffffffffc4cd,%rax
+  803fe0:	ff ff ff 
+  803fe3:	48 01 d8             	add    %rbx,%rax
+  803fe6:	ff d0                	call   *%rax
+  803fe8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803feb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fef:	79 05                	jns    803ff6 <accept+0x7d>
+		return r;
+  803ff1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ff4:	eb 15                	jmp    80400b <accept+0x92>
+	return alloc_sockfd(r);
+  803ff6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ff9:	89 c7                	mov    %eax,%edi
+  803ffb:	48 b8 6b be ff ff ff 	movabs $0xffffffffffffbe6b,%rax
+  804002:	ff ff ff 
+  804005:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804009:	ff d0                	call   *%rax
+}
+  80400b:	48 83 c4 30          	add    $0x30,%rsp
+  80400f:	5b                   	pop    %rbx
+  804010:	41 5f                	pop    %r15
+  804012:	5d                   	pop    %rbp
+  804013:	c3                   	ret
+
+0000000000804014 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804014:	55                   	push   %rbp
+  804015:	48 89 e5             	mov    %rsp,%rbp
+  804018:	41 57                	push   %r15
+  80401a:	53                   	push   %rbx
+  80401b:	48 83 ec 20          	sub    $0x20,%rsp
+  80401f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80401f <bind+0xb>
+  804026:	49 bb 19 40 00 00 00 	movabs $0x4019,%r11
+  80402d:	00 00 00 
+  804030:	4c 01 db             	add    %r11,%rbx
+  804033:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804036:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80403a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80403d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804040:	89 c7                	mov    %eax,%edi
+  804042:	48 b8 ef bd ff ff ff 	movabs $0xffffffffffffbdef,%rax
+  804049:	ff ff ff 
+  80404c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804050:	ff d0                	call   *%rax
+  804052:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804055:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804059:	79 05                	jns    804060 <bind+0x4c>
+		return r;
+  80405b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80405e:	eb 21                	jmp    804081 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804060:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804063:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804067:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80406a:	48 89 ce             	mov    %rcx,%rsi
+  80406d:	89 c7                	mov    %eax,%edi
+  80406f:	49 89 df             	mov    %rbx,%r15
+  804072:	48 b8 79 c5 ff ff ff 	movabs $0xffffffffffffc579,%rax
+  804079:	ff ff ff 
+  80407c:	48 01 d8             	add    %rbx,%rax
+  80407f:	ff d0                	call   *%rax
+}
+  804081:	48 83 c4 20          	add    $0x20,%rsp
+  804085:	5b                   	pop    %rbx
+  804086:	41 5f                	pop    %r15
+  804088:	5d                   	pop    %rbp
+  804089:	c3                   	ret
+
+000000000080408a <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80408a:	55                   	push   %rbp
+  80408b:	48 89 e5             	mov    %rsp,%rbp
+  80408e:	41 57                	push   %r15
+  804090:	53                   	push   %rbx
+  804091:	48 83 ec 20          	sub    $0x20,%rsp
+  804095:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804095 <shutdown+0xb>
+  80409c:	49 bb a3 3f 00 00 00 	movabs $0x3fa3,%r11
+  8040a3:	00 00 00 
+  8040a6:	4c 01 db             	add    %r11,%rbx
+  8040a9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8040ac:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8040af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040b2:	89 c7                	mov    %eax,%edi
+  8040b4:	48 b8 ef bd ff ff ff 	movabs $0xffffffffffffbdef,%rax
+  8040bb:	ff ff ff 
+  8040be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040c2:	ff d0                	call   *%rax
+  8040c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040cb:	79 05                	jns    8040d2 <shutdown+0x48>
+		return r;
+  8040cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040d0:	eb 1c                	jmp    8040ee <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8040d2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8040d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040d8:	89 d6                	mov    %edx,%esi
+  8040da:	89 c7                	mov    %eax,%edi
+  8040dc:	49 89 df             	mov    %rbx,%r15
+  8040df:	48 b8 0e c6 ff ff ff 	movabs $0xffffffffffffc60e,%rax
+  8040e6:	ff ff ff 
+  8040e9:	48 01 d8             	add    %rbx,%rax
+  8040ec:	ff d0                	call   *%rax
+}
+  8040ee:	48 83 c4 20          	add    $0x20,%rsp
+  8040f2:	5b                   	pop    %rbx
+  8040f3:	41 5f                	pop    %r15
+  8040f5:	5d                   	pop    %rbp
+  8040f6:	c3                   	ret
+
+00000000008040f7 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8040f7:	55                   	push   %rbp
+  8040f8:	48 89 e5             	mov    %rsp,%rbp
+  8040fb:	41 57                	push   %r15
+  8040fd:	53                   	push   %rbx
+  8040fe:	48 83 ec 10          	sub    $0x10,%rsp
+  804102:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804102 <devsock_close+0xb>
+  804109:	49 bb 36 3f 00 00 00 	movabs $0x3f36,%r11
+  804110:	00 00 00 
+  804113:	4c 01 db             	add    %r11,%rbx
+  804116:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80411a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80411e:	48 89 c7             	mov    %rax,%rdi
+  804121:	49 89 df             	mov    %rbx,%r15
+  804124:	48 b8 64 df ff ff ff 	movabs $0xffffffffffffdf64,%rax
+  80412b:	ff ff ff 
+  80412e:	48 01 d8             	add    %rbx,%rax
+  804131:	ff d0                	call   *%rax
+  804133:	83 f8 01             	cmp    $0x1,%eax
+  804136:	75 1d                	jne    804155 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804138:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80413c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80413f:	89 c7                	mov    %eax,%edi
+  804141:	49 89 df             	mov    %rbx,%r15
+  804144:	48 b8 5f c6 ff ff ff 	movabs $0xffffffffffffc65f,%rax
+  80414b:	ff ff ff 
+  80414e:	48 01 d8             	add    %rbx,%rax
+  804151:	ff d0                	call   *%rax
+  804153:	eb 05                	jmp    80415a <devsock_close+0x63>
+	else
+		return 0;
+  804155:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80415a:	48 83 c4 10          	add    $0x10,%rsp
+  80415e:	5b                   	pop    %rbx
+  80415f:	41 5f                	pop    %r15
+  804161:	5d                   	pop    %rbp
+  804162:	c3                   	ret
+
+0000000000804163 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804163:	55                   	push   %rbp
+  804164:	48 89 e5             	mov    %rsp,%rbp
+  804167:	41 57                	push   %r15
+  804169:	53                   	push   %rbx
+  80416a:	48 83 ec 20          	sub    $0x20,%rsp
+  80416e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80416e <connect+0xb>
+  804175:	49 bb ca 3e 00 00 00 	movabs $0x3eca,%r11
+  80417c:	00 00 00 
+  80417f:	4c 01 db             	add    %r11,%rbx
+  804182:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804185:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804189:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80418c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80418f:	89 c7                	mov    %eax,%edi
+  804191:	48 b8 ef bd ff ff ff 	movabs $0xffffffffffffbdef,%rax
+  804198:	ff ff ff 
+  80419b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80419f:	ff d0                	call   *%rax
+  8041a1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041a4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041a8:	79 05                	jns    8041af <connect+0x4c>
+		return r;
+  8041aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041ad:	eb 21                	jmp    8041d0 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8041af:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8041b2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8041b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041b9:	48 89 ce             	mov    %rcx,%rsi
+  8041bc:	89 c7                	mov    %eax,%edi
+  8041be:	49 89 df             	mov    %rbx,%r15
+  8041c1:	48 b8 a7 c6 ff ff ff 	movabs $0xffffffffffffc6a7,%rax
+  8041c8:	ff ff ff 
+  8041cb:	48 01 d8             	add    %rbx,%rax
+  8041ce:	ff d0                	call   *%rax
+}
+  8041d0:	48 83 c4 20          	add    $0x20,%rsp
+  8041d4:	5b                   	pop    %rbx
+  8041d5:	41 5f                	pop    %r15
+  8041d7:	5d                   	pop    %rbp
+  8041d8:	c3                   	ret
+
+00000000008041d9 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8041d9:	55                   	push   %rbp
+  8041da:	48 89 e5             	mov    %rsp,%rbp
+  8041dd:	41 57                	push   %r15
+  8041df:	53                   	push   %rbx
+  8041e0:	48 83 ec 20          	sub    $0x20,%rsp
+  8041e4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041e4 <listen+0xb>
+  8041eb:	49 bb 54 3e 00 00 00 	movabs $0x3e54,%r11
+  8041f2:	00 00 00 
+  8041f5:	4c 01 db             	add    %r11,%rbx
+  8041f8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8041fb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8041fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804201:	89 c7                	mov    %eax,%edi
+  804203:	48 b8 ef bd ff ff ff 	movabs $0xffffffffffffbdef,%rax
+  80420a:	ff ff ff 
+  80420d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804211:	ff d0                	call   *%rax
+  804213:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804216:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80421a:	79 05                	jns    804221 <listen+0x48>
+		return r;
+  80421c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80421f:	eb 1c                	jmp    80423d <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804221:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804224:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804227:	89 d6                	mov    %edx,%esi
+  804229:	89 c7                	mov    %eax,%edi
+  80422b:	49 89 df             	mov    %rbx,%r15
+  80422e:	48 b8 3c c7 ff ff ff 	movabs $0xffffffffffffc73c,%rax
+  804235:	ff ff ff 
+  804238:	48 01 d8             	add    %rbx,%rax
+  80423b:	ff d0                	call   *%rax
+}
+  80423d:	48 83 c4 20          	add    $0x20,%rsp
+  804241:	5b                   	pop    %rbx
+  804242:	41 5f                	pop    %r15
+  804244:	5d                   	pop    %rbp
+  804245:	c3                   	ret
+
+0000000000804246 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804246:	55                   	push   %rbp
+  804247:	48 89 e5             	mov    %rsp,%rbp
+  80424a:	41 57                	push   %r15
+  80424c:	48 83 ec 28          	sub    $0x28,%rsp
+  804250:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804250 <devsock_read+0xa>
+  804257:	49 bb e8 3d 00 00 00 	movabs $0x3de8,%r11
+  80425e:	00 00 00 
+  804261:	4c 01 d8             	add    %r11,%rax
+  804264:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804268:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80426c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804270:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804274:	41 89 d0             	mov    %edx,%r8d
+  804277:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80427b:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80427e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804282:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804287:	44 89 c2             	mov    %r8d,%edx
+  80428a:	49 89 c7             	mov    %rax,%r15
+  80428d:	49 b8 8d c7 ff ff ff 	movabs $0xffffffffffffc78d,%r8
+  804294:	ff ff ff 
+  804297:	49 01 c0             	add    %rax,%r8
+  80429a:	41 ff d0             	call   *%r8
+}
+  80429d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8042a1:	c9                   	leave
+  8042a2:	c3                   	ret
+
+00000000008042a3 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8042a3:	55                   	push   %rbp
+  8042a4:	48 89 e5             	mov    %rsp,%rbp
+  8042a7:	41 57                	push   %r15
+  8042a9:	48 83 ec 28          	sub    $0x28,%rsp
+  8042ad:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8042ad <devsock_write+0xa>
+  8042b4:	49 bb 8b 3d 00 00 00 	movabs $0x3d8b,%r11
+  8042bb:	00 00 00 
+  8042be:	4c 01 d8             	add    %r11,%rax
+  8042c1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042c5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8042c9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8042cd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042d1:	41 89 d0             	mov    %edx,%r8d
+  8042d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042d8:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8042db:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8042df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8042e4:	44 89 c2             	mov    %r8d,%edx
+  8042e7:	49 89 c7             	mov    %rax,%r15
+  8042ea:	49 b8 aa c8 ff ff ff 	movabs $0xffffffffffffc8aa,%r8
+  8042f1:	ff ff ff 
+  8042f4:	49 01 c0             	add    %rax,%r8
+  8042f7:	41 ff d0             	call   *%r8
+}
+  8042fa:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8042fe:	c9                   	leave
+  8042ff:	c3                   	ret
+
+0000000000804300 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  804300:	55                   	push   %rbp
+  804301:	48 89 e5             	mov    %rsp,%rbp
+  804304:	41 57                	push   %r15
+  804306:	48 83 ec 18          	sub    $0x18,%rsp
+  80430a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80430a <devsock_stat+0xa>
+  804311:	49 bb 2e 3d 00 00 00 	movabs $0x3d2e,%r11
+  804318:	00 00 00 
+  80431b:	4c 01 d8             	add    %r11,%rax
+  80431e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804322:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804326:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80432a:	48 b9 9c e5 ff ff ff 	movabs $0xffffffffffffe59c,%rcx
+  804331:	ff ff ff 
+  804334:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804338:	48 89 ce             	mov    %rcx,%rsi
+  80433b:	48 89 d7             	mov    %rdx,%rdi
+  80433e:	49 89 c7             	mov    %rax,%r15
+  804341:	48 ba 4f 91 ff ff ff 	movabs $0xffffffffffff914f,%rdx
+  804348:	ff ff ff 
+  80434b:	48 01 c2             	add    %rax,%rdx
+  80434e:	ff d2                	call   *%rdx
+	return 0;
+  804350:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804355:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804359:	c9                   	leave
+  80435a:	c3                   	ret
+
+000000000080435b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80435b:	55                   	push   %rbp
+  80435c:	48 89 e5             	mov    %rsp,%rbp
+  80435f:	41 57                	push   %r15
+  804361:	53                   	push   %rbx
+  804362:	48 83 ec 20          	sub    $0x20,%rsp
+  804366:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804366 <socket+0xb>
+  80436d:	49 bb d2 3c 00 00 00 	movabs $0x3cd2,%r11
+  804374:	00 00 00 
+  804377:	4c 01 db             	add    %r11,%rbx
+  80437a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80437d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804380:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804383:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804386:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804389:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80438c:	89 ce                	mov    %ecx,%esi
+  80438e:	89 c7                	mov    %eax,%edi
+  804390:	49 89 df             	mov    %rbx,%r15
+  804393:	48 b8 81 ca ff ff ff 	movabs $0xffffffffffffca81,%rax
+  80439a:	ff ff ff 
+  80439d:	48 01 d8             	add    %rbx,%rax
+  8043a0:	ff d0                	call   *%rax
+  8043a2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043a5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043a9:	79 05                	jns    8043b0 <socket+0x55>
+		return r;
+  8043ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043ae:	eb 15                	jmp    8043c5 <socket+0x6a>
+	return alloc_sockfd(r);
+  8043b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043b3:	89 c7                	mov    %eax,%edi
+  8043b5:	48 b8 6b be ff ff ff 	movabs $0xffffffffffffbe6b,%rax
+  8043bc:	ff ff ff 
+  8043bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043c3:	ff d0                	call   *%rax
+}
+  8043c5:	48 83 c4 20          	add    $0x20,%rsp
+  8043c9:	5b                   	pop    %rbx
+  8043ca:	41 5f                	pop    %r15
+  8043cc:	5d                   	pop    %rbp
+  8043cd:	c3                   	ret
+
+00000000008043ce <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8043ce:	55                   	push   %rbp
+  8043cf:	48 89 e5             	mov    %rsp,%rbp
+  8043d2:	41 57                	push   %r15
+  8043d4:	53                   	push   %rbx
+  8043d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8043d9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043d9 <nsipc+0xb>
+  8043e0:	49 bb 5f 3c 00 00 00 	movabs $0x3c5f,%r11
+  8043e7:	00 00 00 
+  8043ea:	4c 01 db             	add    %r11,%rbx
+  8043ed:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8043f0:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8043f7:	00 00 00 
+  8043fa:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8043fd:	85 c0                	test   %eax,%eax
+  8043ff:	75 24                	jne    804425 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804401:	bf 02 00 00 00       	mov    $0x2,%edi
+  804406:	49 89 df             	mov    %rbx,%r15
+  804409:	48 b8 d5 de ff ff ff 	movabs $0xffffffffffffded5,%rax
+  804410:	ff ff ff 
+  804413:	48 01 d8             	add    %rbx,%rax
+  804416:	ff d0                	call   *%rax
+  804418:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  80441f:	00 00 00 
+  804422:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804425:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  80442c:	00 00 00 
+  80442f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804432:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804435:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80443b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804441:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804446:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80444d:	00 00 00 
+  804450:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804454:	89 c7                	mov    %eax,%edi
+  804456:	49 89 df             	mov    %rbx,%r15
+  804459:	48 b8 f4 d8 ff ff ff 	movabs $0xffffffffffffd8f4,%rax
+  804460:	ff ff ff 
+  804463:	48 01 d8             	add    %rbx,%rax
+  804466:	ff d0                	call   *%rax
+}
+  804468:	48 83 c4 10          	add    $0x10,%rsp
+  80446c:	5b                   	pop    %rbx
+  80446d:	41 5f                	pop    %r15
+  80446f:	5d                   	pop    %rbp
+  804470:	c3                   	ret
+
+0000000000804471 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804471:	55                   	push   %rbp
+  804472:	48 89 e5             	mov    %rsp,%rbp
+  804475:	41 57                	push   %r15
+  804477:	53                   	push   %rbx
+  804478:	48 83 ec 20          	sub    $0x20,%rsp
+  80447c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80447c <nsipc_words+0xb>
+  804483:	49 bb bc 3b 00 00 00 	movabs $0x3bbc,%r11
+  80448a:	00 00 00 
+  80448d:	4c 01 db             	add    %r11,%rbx
+  804490:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804493:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804497:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80449b:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8044a2:	00 00 00 
+  8044a5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8044a8:	85 c0                	test   %eax,%eax
+  8044aa:	75 24                	jne    8044d0 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8044ac:	bf 02 00 00 00       	mov    $0x2,%edi
+  8044b1:	49 89 df             	mov    %rbx,%r15
+  8044b4:	48 b8 d5 de ff ff ff 	movabs $0xffffffffffffded5,%rax
+  8044bb:	ff ff ff 
+  8044be:	48 01 d8             	add    %rbx,%rax
+  8044c1:	ff d0                	call   *%rax
+  8044c3:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  8044ca:	00 00 00 
+  8044cd:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8044d0:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8044d7:	00 00 00 
+  8044da:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8044dd:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8044e1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8044e5:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8044e8:	89 c7                	mov    %eax,%edi
+  8044ea:	49 89 df             	mov    %rbx,%r15
+  8044ed:	48 b8 df d9 ff ff ff 	movabs $0xffffffffffffd9df,%rax
+  8044f4:	ff ff ff 
+  8044f7:	48 01 d8             	add    %rbx,%rax
+  8044fa:	ff d0                	call   *%rax
+}
+  8044fc:	48 83 c4 20          	add    $0x20,%rsp
+  804500:	5b                   	pop    %rbx
+  804501:	41 5f                	pop    %r15
+  804503:	5d                   	pop    %rbp
+  804504:	c3                   	ret
+
+0000000000804505 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804505:	55                   	push   %rbp
+  804506:	48 89 e5             	mov    %rsp,%rbp
+  804509:	41 57                	push   %r15
+  80450b:	53                   	push   %rbx
+  80450c:	48 83 ec 30          	sub    $0x30,%rsp
+  804510:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804510 <nsipc_accept+0xb>
+  804517:	49 bb 28 3b 00 00 00 	movabs $0x3b28,%r11
+  80451e:	00 00 00 
+  804521:	4c 01 db             	add    %r11,%rbx
+  804524:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804527:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80452b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80452f:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804536:	00 00 00 
+  804539:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80453c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80453f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804544:	48 b8 96 c3 ff ff ff 	movabs $0xffffffffffffc396,%rax
+  80454b:	ff ff ff 
+  80454e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804552:	ff d0                	call   *%rax
+  804554:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804557:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80455b:	78 48                	js     8045a5 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80455d:	48 b8 c8 3f 01 00 00 	movabs $0x13fc8,%rax
+  804564:	00 00 00 
+  804567:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80456b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80456f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804573:	8b 40 10             	mov    0x10(%rax),%eax
+  804576:	89 c2                	mov    %eax,%edx
+  804578:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80457c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804580:	48 89 ce             	mov    %rcx,%rsi
+  804583:	48 89 c7             	mov    %rax,%rdi
+  804586:	49 89 df             	mov    %rbx,%r15
+  804589:	48 b8 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rax
+  804590:	ff ff ff 
+  804593:	48 01 d8             	add    %rbx,%rax
+  804596:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  804598:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80459c:	8b 50 10             	mov    0x10(%rax),%edx
+  80459f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045a3:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8045a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8045a8:	48 83 c4 30          	add    $0x30,%rsp
+  8045ac:	5b                   	pop    %rbx
+  8045ad:	41 5f                	pop    %r15
+  8045af:	5d                   	pop    %rbp
+  8045b0:	c3                   	ret
+
+00000000008045b1 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8045b1:	55                   	push   %rbp
+  8045b2:	48 89 e5             	mov    %rsp,%rbp
+  8045b5:	41 57                	push   %r15
+  8045b7:	53                   	push   %rbx
+  8045b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8045bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045bc <nsipc_bind+0xb>
+  8045c3:	49 bb 7c 3a 00 00 00 	movabs $0x3a7c,%r11
+  8045ca:	00 00 00 
+  8045cd:	4c 01 db             	add    %r11,%rbx
+  8045d0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8045d3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8045d7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8045da:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8045e1:	00 00 00 
+  8045e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045e7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8045ea:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8045ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045f1:	48 89 c6             	mov    %rax,%rsi
+  8045f4:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  8045fb:	00 00 00 
+  8045fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804602:	48 89 c7             	mov    %rax,%rdi
+  804605:	49 89 df             	mov    %rbx,%r15
+  804608:	48 b8 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rax
+  80460f:	ff ff ff 
+  804612:	48 01 d8             	add    %rbx,%rax
+  804615:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804617:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80461e:	00 00 00 
+  804621:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804624:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804628:	bf 02 00 00 00       	mov    $0x2,%edi
+  80462d:	48 b8 96 c3 ff ff ff 	movabs $0xffffffffffffc396,%rax
+  804634:	ff ff ff 
+  804637:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80463b:	ff d0                	call   *%rax
+}
+  80463d:	48 83 c4 10          	add    $0x10,%rsp
+  804641:	5b                   	pop    %rbx
+  804642:	41 5f                	pop    %r15
+  804644:	5d                   	pop    %rbp
+  804645:	c3                   	ret
+
+0000000000804646 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804646:	55                   	push   %rbp
+  804647:	48 89 e5             	mov    %rsp,%rbp
+  80464a:	48 83 ec 20          	sub    $0x20,%rsp
+  80464e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80464e <nsipc_shutdown+0x8>
+  804655:	49 bb ea 39 00 00 00 	movabs $0x39ea,%r11
+  80465c:	00 00 00 
+  80465f:	4c 01 d8             	add    %r11,%rax
+  804662:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804665:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  804668:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80466b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  80466e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804671:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  804674:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804678:	ba 08 00 00 00       	mov    $0x8,%edx
+  80467d:	48 89 ce             	mov    %rcx,%rsi
+  804680:	bf 03 00 00 00       	mov    $0x3,%edi
+  804685:	48 b9 39 c4 ff ff ff 	movabs $0xffffffffffffc439,%rcx
+  80468c:	ff ff ff 
+  80468f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804693:	ff d0                	call   *%rax
+}
+  804695:	c9                   	leave
+  804696:	c3                   	ret
+
+0000000000804697 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  804697:	55                   	push   %rbp
+  804698:	48 89 e5             	mov    %rsp,%rbp
+  80469b:	48 83 ec 20          	sub    $0x20,%rsp
+  80469f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80469f <nsipc_close+0x8>
+  8046a6:	49 bb 99 39 00 00 00 	movabs $0x3999,%r11
+  8046ad:	00 00 00 
+  8046b0:	4c 01 d8             	add    %r11,%rax
+  8046b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8046b6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8046b9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8046bc:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8046c0:	ba 04 00 00 00       	mov    $0x4,%edx
+  8046c5:	48 89 ce             	mov    %rcx,%rsi
+  8046c8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8046cd:	48 b9 39 c4 ff ff ff 	movabs $0xffffffffffffc439,%rcx
+  8046d4:	ff ff ff 
+  8046d7:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8046db:	ff d0                	call   *%rax
+}
+  8046dd:	c9                   	leave
+  8046de:	c3                   	ret
+
+00000000008046df <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8046df:	55                   	push   %rbp
+  8046e0:	48 89 e5             	mov    %rsp,%rbp
+  8046e3:	41 57                	push   %r15
+  8046e5:	53                   	push   %rbx
+  8046e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8046ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046ea <nsipc_connect+0xb>
+  8046f1:	49 bb 4e 39 00 00 00 	movabs $0x394e,%r11
+  8046f8:	00 00 00 
+  8046fb:	4c 01 db             	add    %r11,%rbx
+  8046fe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804701:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804705:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804708:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80470f:	00 00 00 
+  804712:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804715:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804718:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80471b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80471f:	48 89 c6             	mov    %rax,%rsi
+  804722:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  804729:	00 00 00 
+  80472c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804730:	48 89 c7             	mov    %rax,%rdi
+  804733:	49 89 df             	mov    %rbx,%r15
+  804736:	48 b8 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rax
+  80473d:	ff ff ff 
+  804740:	48 01 d8             	add    %rbx,%rax
+  804743:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  804745:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80474c:	00 00 00 
+  80474f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804752:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  804756:	bf 05 00 00 00       	mov    $0x5,%edi
+  80475b:	48 b8 96 c3 ff ff ff 	movabs $0xffffffffffffc396,%rax
+  804762:	ff ff ff 
+  804765:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804769:	ff d0                	call   *%rax
+}
+  80476b:	48 83 c4 10          	add    $0x10,%rsp
+  80476f:	5b                   	pop    %rbx
+  804770:	41 5f                	pop    %r15
+  804772:	5d                   	pop    %rbp
+  804773:	c3                   	ret
+
+0000000000804774 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804774:	55                   	push   %rbp
+  804775:	48 89 e5             	mov    %rsp,%rbp
+  804778:	48 83 ec 20          	sub    $0x20,%rsp
+  80477c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80477c <nsipc_listen+0x8>
+  804783:	49 bb bc 38 00 00 00 	movabs $0x38bc,%r11
+  80478a:	00 00 00 
+  80478d:	4c 01 d8             	add    %r11,%rax
+  804790:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804793:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804796:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804799:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  80479c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80479f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8047a2:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8047a6:	ba 08 00 00 00       	mov    $0x8,%edx
+  8047ab:	48 89 ce             	mov    %rcx,%rsi
+  8047ae:	bf 06 00 00 00       	mov    $0x6,%edi
+  8047b3:	48 b9 39 c4 ff ff ff 	movabs $0xffffffffffffc439,%rcx
+  8047ba:	ff ff ff 
+  8047bd:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8047c1:	ff d0                	call   *%rax
+}
+  8047c3:	c9                   	leave
+  8047c4:	c3                   	ret
+
+00000000008047c5 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8047c5:	55                   	push   %rbp
+  8047c6:	48 89 e5             	mov    %rsp,%rbp
+  8047c9:	41 57                	push   %r15
+  8047cb:	53                   	push   %rbx
+  8047cc:	48 83 ec 30          	sub    $0x30,%rsp
+  8047d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047d0 <nsipc_recv+0xb>
+  8047d7:	49 bb 68 38 00 00 00 	movabs $0x3868,%r11
+  8047de:	00 00 00 
+  8047e1:	4c 01 db             	add    %r11,%rbx
+  8047e4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8047e7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8047eb:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8047ee:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8047f1:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8047f8:	00 00 00 
+  8047fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8047fe:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  804801:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804808:	00 00 00 
+  80480b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80480e:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804812:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804819:	00 00 00 
+  80481c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80481f:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804823:	bf 07 00 00 00       	mov    $0x7,%edi
+  804828:	48 b8 96 c3 ff ff ff 	movabs $0xffffffffffffc396,%rax
+  80482f:	ff ff ff 
+  804832:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804836:	ff d0                	call   *%rax
+  804838:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80483b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80483f:	0f 88 91 00 00 00    	js     8048d6 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804845:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  80484c:	7f 08                	jg     804856 <nsipc_recv+0x91>
+  80484e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804851:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804854:	7e 50                	jle    8048a6 <nsipc_recv+0xe1>
+  804856:	48 b8 a3 e5 ff ff ff 	movabs $0xffffffffffffe5a3,%rax
+  80485d:	ff ff ff 
+  804860:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804864:	48 89 c1             	mov    %rax,%rcx
+  804867:	48 b8 b8 e5 ff ff ff 	movabs $0xffffffffffffe5b8,%rax
+  80486e:	ff ff ff 
+  804871:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804875:	48 89 c2             	mov    %rax,%rdx
+  804878:	be 79 00 00 00       	mov    $0x79,%esi
+  80487d:	48 b8 cd e5 ff ff ff 	movabs $0xffffffffffffe5cd,%rax
+  804884:	ff ff ff 
+  804887:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80488b:	48 89 c7             	mov    %rax,%rdi
+  80488e:	49 89 df             	mov    %rbx,%r15
+  804891:	b8 00 00 00 00       	mov    $0x0,%eax
+  804896:	49 b8 3f d6 ff ff ff 	movabs $0xffffffffffffd63f,%r8
+  80489d:	ff ff ff 
+  8048a0:	49 01 d8             	add    %rbx,%r8
+  8048a3:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8048a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048a9:	48 63 d0             	movslq %eax,%rdx
+  8048ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048b0:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  8048b7:	00 00 00 
+  8048ba:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8048be:	48 89 ce             	mov    %rcx,%rsi
+  8048c1:	48 89 c7             	mov    %rax,%rdi
+  8048c4:	49 89 df             	mov    %rbx,%r15
+  8048c7:	48 b8 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rax
+  8048ce:	ff ff ff 
+  8048d1:	48 01 d8             	add    %rbx,%rax
+  8048d4:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8048d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8048d9:	48 83 c4 30          	add    $0x30,%rsp
+  8048dd:	5b                   	pop    %rbx
+  8048de:	41 5f                	pop    %r15
+  8048e0:	5d                   	pop    %rbp
+  8048e1:	c3                   	ret
+
+00000000008048e2 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8048e2:	55                   	push   %rbp
+  8048e3:	48 89 e5             	mov    %rsp,%rbp
+  8048e6:	41 57                	push   %r15
+  8048e8:	53                   	push   %rbx
+  8048e9:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8048f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048f0 <nsipc_send+0xe>
+  8048f7:	49 bb 48 37 00 00 00 	movabs $0x3748,%r11
+  8048fe:	00 00 00 
+  804901:	4c 01 db             	add    %r11,%rbx
+  804904:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  80490a:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804911:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804917:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  80491d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804921:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804925:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  80492c:	00 00 00 
+  80492f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804932:	85 c0                	test   %eax,%eax
+  804934:	75 24                	jne    80495a <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804936:	bf 02 00 00 00       	mov    $0x2,%edi
+  80493b:	49 89 df             	mov    %rbx,%r15
+  80493e:	48 b8 d5 de ff ff ff 	movabs $0xffffffffffffded5,%rax
+  804945:	ff ff ff 
+  804948:	48 01 d8             	add    %rbx,%rax
+  80494b:	ff d0                	call   *%rax
+  80494d:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  804954:	00 00 00 
+  804957:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  80495a:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804960:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804963:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  80496a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80496d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804970:	39 c2                	cmp    %eax,%edx
+  804972:	0f 4e c2             	cmovle %edx,%eax
+  804975:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  80497b:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804981:	48 63 d0             	movslq %eax,%rdx
+  804984:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  80498b:	48 89 c6             	mov    %rax,%rsi
+  80498e:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804995:	00 00 00 
+  804998:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80499c:	48 89 c7             	mov    %rax,%rdi
+  80499f:	49 89 df             	mov    %rbx,%r15
+  8049a2:	48 b8 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rax
+  8049a9:	ff ff ff 
+  8049ac:	48 01 d8             	add    %rbx,%rax
+  8049af:	ff d0                	call   *%rax
+	req->req_s = s;
+  8049b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049b5:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  8049bb:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  8049bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049c1:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8049c7:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  8049ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049ce:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8049d4:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  8049d7:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8049de:	00 00 00 
+  8049e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049e5:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8049e9:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8049f0:	00 
+  8049f1:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8049f7:	48 63 d0             	movslq %eax,%rdx
+  8049fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049fe:	48 01 d0             	add    %rdx,%rax
+  804a01:	48 83 e8 01          	sub    $0x1,%rax
+  804a05:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804a09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a12:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804a16:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a1a:	48 29 d0             	sub    %rdx,%rax
+  804a1d:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804a23:	85 c0                	test   %eax,%eax
+  804a25:	0f 48 c2             	cmovs  %edx,%eax
+  804a28:	c1 f8 0c             	sar    $0xc,%eax
+  804a2b:	48 98                	cltq
+  804a2d:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804a31:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804a35:	48 85 c0             	test   %rax,%rax
+  804a38:	0f 95 c0             	setne  %al
+  804a3b:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804a3e:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804a45:	00 
+  804a46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a4a:	48 83 c0 0b          	add    $0xb,%rax
+  804a4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804a52:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a56:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a5b:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804a5f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a63:	48 29 d0             	sub    %rdx,%rax
+  804a66:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804a6a:	89 c7                	mov    %eax,%edi
+  804a6c:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804a73:	00 00 00 
+  804a76:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a79:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804a7d:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804a81:	48 83 ec 08          	sub    $0x8,%rsp
+  804a85:	6a 00                	push   $0x0
+  804a87:	6a 00                	push   $0x0
+  804a89:	6a 05                	push   $0x5
+  804a8b:	41 89 f1             	mov    %esi,%r9d
+  804a8e:	49 89 c8             	mov    %rcx,%r8
+  804a91:	89 f9                	mov    %edi,%ecx
+  804a93:	be 08 00 00 00       	mov    $0x8,%esi
+  804a98:	89 c7                	mov    %eax,%edi
+  804a9a:	49 89 df             	mov    %rbx,%r15
+  804a9d:	48 b8 dd da ff ff ff 	movabs $0xffffffffffffdadd,%rax
+  804aa4:	ff ff ff 
+  804aa7:	48 01 d8             	add    %rbx,%rax
+  804aaa:	ff d0                	call   *%rax
+  804aac:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804ab0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804ab4:	5b                   	pop    %rbx
+  804ab5:	41 5f                	pop    %r15
+  804ab7:	5d                   	pop    %rbp
+  804ab8:	c3                   	ret
+
+0000000000804ab9 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804ab9:	55                   	push   %rbp
+  804aba:	48 89 e5             	mov    %rsp,%rbp
+  804abd:	48 83 ec 10          	sub    $0x10,%rsp
+  804ac1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804ac1 <nsipc_socket+0x8>
+  804ac8:	49 bb 77 35 00 00 00 	movabs $0x3577,%r11
+  804acf:	00 00 00 
+  804ad2:	4c 01 d8             	add    %r11,%rax
+  804ad5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804ad8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804adb:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804ade:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804ae5:	00 00 00 
+  804ae8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804aeb:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804aee:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804af5:	00 00 00 
+  804af8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804afb:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804aff:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804b06:	00 00 00 
+  804b09:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804b0c:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804b10:	bf 09 00 00 00       	mov    $0x9,%edi
+  804b15:	48 ba 96 c3 ff ff ff 	movabs $0xffffffffffffc396,%rdx
+  804b1c:	ff ff ff 
+  804b1f:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804b23:	ff d0                	call   *%rax
+}
+  804b25:	c9                   	leave
+  804b26:	c3                   	ret
+
+0000000000804b27 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804b27:	55                   	push   %rbp
+  804b28:	48 89 e5             	mov    %rsp,%rbp
+  804b2b:	41 57                	push   %r15
+  804b2d:	53                   	push   %rbx
+  804b2e:	48 83 ec 30          	sub    $0x30,%rsp
+  804b32:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b32 <pipe+0xb>
+  804b39:	49 bb 06 35 00 00 00 	movabs $0x3506,%r11
+  804b40:	00 00 00 
+  804b43:	4c 01 db             	add    %r11,%rbx
+  804b46:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804b4a:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804b4e:	48 89 c7             	mov    %rax,%rdi
+  804b51:	49 89 df             	mov    %rbx,%r15
+  804b54:	48 b8 b0 a7 ff ff ff 	movabs $0xffffffffffffa7b0,%rax
+  804b5b:	ff ff ff 
+  804b5e:	48 01 d8             	add    %rbx,%rax
+  804b61:	ff d0                	call   *%rax
+  804b63:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b66:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b6a:	0f 88 12 02 00 00    	js     804d82 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804b70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b74:	ba 07 04 00 00       	mov    $0x407,%edx
+  804b79:	48 89 c6             	mov    %rax,%rsi
+  804b7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b81:	49 89 df             	mov    %rbx,%r15
+  804b84:	48 b8 0b 9e ff ff ff 	movabs $0xffffffffffff9e0b,%rax
+  804b8b:	ff ff ff 
+  804b8e:	48 01 d8             	add    %rbx,%rax
+  804b91:	ff d0                	call   *%rax
+  804b93:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b96:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b9a:	0f 88 e2 01 00 00    	js     804d82 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804ba0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804ba4:	48 89 c7             	mov    %rax,%rdi
+  804ba7:	49 89 df             	mov    %rbx,%r15
+  804baa:	48 b8 b0 a7 ff ff ff 	movabs $0xffffffffffffa7b0,%rax
+  804bb1:	ff ff ff 
+  804bb4:	48 01 d8             	add    %rbx,%rax
+  804bb7:	ff d0                	call   *%rax
+  804bb9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bbc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804bc0:	0f 88 9b 01 00 00    	js     804d61 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804bc6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bca:	ba 07 04 00 00       	mov    $0x407,%edx
+  804bcf:	48 89 c6             	mov    %rax,%rsi
+  804bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bd7:	49 89 df             	mov    %rbx,%r15
+  804bda:	48 b8 0b 9e ff ff ff 	movabs $0xffffffffffff9e0b,%rax
+  804be1:	ff ff ff 
+  804be4:	48 01 d8             	add    %rbx,%rax
+  804be7:	ff d0                	call   *%rax
+  804be9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804bf0:	0f 88 6b 01 00 00    	js     804d61 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804bf6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bfa:	48 89 c7             	mov    %rax,%rdi
+  804bfd:	49 89 df             	mov    %rbx,%r15
+  804c00:	48 b8 6d a7 ff ff ff 	movabs $0xffffffffffffa76d,%rax
+  804c07:	ff ff ff 
+  804c0a:	48 01 d8             	add    %rbx,%rax
+  804c0d:	ff d0                	call   *%rax
+  804c0f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c13:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c17:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c1c:	48 89 c6             	mov    %rax,%rsi
+  804c1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c24:	49 89 df             	mov    %rbx,%r15
+  804c27:	48 b8 0b 9e ff ff ff 	movabs $0xffffffffffff9e0b,%rax
+  804c2e:	ff ff ff 
+  804c31:	48 01 d8             	add    %rbx,%rax
+  804c34:	ff d0                	call   *%rax
+  804c36:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c39:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c3d:	0f 88 fd 00 00 00    	js     804d40 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c47:	48 89 c7             	mov    %rax,%rdi
+  804c4a:	49 89 df             	mov    %rbx,%r15
+  804c4d:	48 b8 6d a7 ff ff ff 	movabs $0xffffffffffffa76d,%rax
+  804c54:	ff ff ff 
+  804c57:	48 01 d8             	add    %rbx,%rax
+  804c5a:	ff d0                	call   *%rax
+  804c5c:	48 89 c2             	mov    %rax,%rdx
+  804c5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c63:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804c69:	48 89 d1             	mov    %rdx,%rcx
+  804c6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c71:	48 89 c6             	mov    %rax,%rsi
+  804c74:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c79:	49 89 df             	mov    %rbx,%r15
+  804c7c:	48 b8 70 9e ff ff ff 	movabs $0xffffffffffff9e70,%rax
+  804c83:	ff ff ff 
+  804c86:	48 01 d8             	add    %rbx,%rax
+  804c89:	ff d0                	call   *%rax
+  804c8b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c8e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c92:	0f 88 87 00 00 00    	js     804d1f <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804c98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c9c:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  804ca3:	00 00 00 
+  804ca6:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804ca9:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804cab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804caf:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804cb6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cba:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  804cc1:	00 00 00 
+  804cc4:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804cc7:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804cc9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ccd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804cd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cd8:	48 89 c7             	mov    %rax,%rdi
+  804cdb:	49 89 df             	mov    %rbx,%r15
+  804cde:	48 b8 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rax
+  804ce5:	ff ff ff 
+  804ce8:	48 01 d8             	add    %rbx,%rax
+  804ceb:	ff d0                	call   *%rax
+  804ced:	89 c2                	mov    %eax,%edx
+  804cef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cf3:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804cf5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cf9:	48 89 c7             	mov    %rax,%rdi
+  804cfc:	49 89 df             	mov    %rbx,%r15
+  804cff:	48 b8 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rax
+  804d06:	ff ff ff 
+  804d09:	48 01 d8             	add    %rbx,%rax
+  804d0c:	ff d0                	call   *%rax
+  804d0e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d12:	48 83 c2 04          	add    $0x4,%rdx
+  804d16:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d1d:	eb 67                	jmp    804d86 <pipe+0x25f>
+		goto err3;
+  804d1f:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804d20:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d24:	48 89 c6             	mov    %rax,%rsi
+  804d27:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d2c:	49 89 df             	mov    %rbx,%r15
+  804d2f:	48 b8 e3 9e ff ff ff 	movabs $0xffffffffffff9ee3,%rax
+  804d36:	ff ff ff 
+  804d39:	48 01 d8             	add    %rbx,%rax
+  804d3c:	ff d0                	call   *%rax
+  804d3e:	eb 01                	jmp    804d41 <pipe+0x21a>
+		goto err2;
+  804d40:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804d41:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d45:	48 89 c6             	mov    %rax,%rsi
+  804d48:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d4d:	49 89 df             	mov    %rbx,%r15
+  804d50:	48 b8 e3 9e ff ff ff 	movabs $0xffffffffffff9ee3,%rax
+  804d57:	ff ff ff 
+  804d5a:	48 01 d8             	add    %rbx,%rax
+  804d5d:	ff d0                	call   *%rax
+  804d5f:	eb 01                	jmp    804d62 <pipe+0x23b>
+		goto err1;
+  804d61:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804d62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d66:	48 89 c6             	mov    %rax,%rsi
+  804d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d6e:	49 89 df             	mov    %rbx,%r15
+  804d71:	48 b8 e3 9e ff ff ff 	movabs $0xffffffffffff9ee3,%rax
+  804d78:	ff ff ff 
+  804d7b:	48 01 d8             	add    %rbx,%rax
+  804d7e:	ff d0                	call   *%rax
+  804d80:	eb 01                	jmp    804d83 <pipe+0x25c>
+		goto err;
+  804d82:	90                   	nop
+err:
+	return r;
+  804d83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804d86:	48 83 c4 30          	add    $0x30,%rsp
+  804d8a:	5b                   	pop    %rbx
+  804d8b:	41 5f                	pop    %r15
+  804d8d:	5d                   	pop    %rbp
+  804d8e:	c3                   	ret
+
+0000000000804d8f <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804d8f:	55                   	push   %rbp
+  804d90:	48 89 e5             	mov    %rsp,%rbp
+  804d93:	41 57                	push   %r15
+  804d95:	41 54                	push   %r12
+  804d97:	53                   	push   %rbx
+  804d98:	48 83 ec 28          	sub    $0x28,%rsp
+  804d9c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d9c <_pipeisclosed+0xd>
+  804da3:	49 bb 9c 32 00 00 00 	movabs $0x329c,%r11
+  804daa:	00 00 00 
+  804dad:	4c 01 db             	add    %r11,%rbx
+  804db0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804db4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804db8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804dbf:	ff ff ff 
+  804dc2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804dc6:	48 8b 00             	mov    (%rax),%rax
+  804dc9:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804dcf:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  804dd2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dd6:	48 89 c7             	mov    %rax,%rdi
+  804dd9:	49 89 df             	mov    %rbx,%r15
+  804ddc:	48 b8 64 df ff ff ff 	movabs $0xffffffffffffdf64,%rax
+  804de3:	ff ff ff 
+  804de6:	48 01 d8             	add    %rbx,%rax
+  804de9:	ff d0                	call   *%rax
+  804deb:	41 89 c4             	mov    %eax,%r12d
+  804dee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804df2:	48 89 c7             	mov    %rax,%rdi
+  804df5:	49 89 df             	mov    %rbx,%r15
+  804df8:	48 b8 64 df ff ff ff 	movabs $0xffffffffffffdf64,%rax
+  804dff:	ff ff ff 
+  804e02:	48 01 d8             	add    %rbx,%rax
+  804e05:	ff d0                	call   *%rax
+  804e07:	41 39 c4             	cmp    %eax,%r12d
+  804e0a:	0f 94 c0             	sete   %al
+  804e0d:	0f b6 c0             	movzbl %al,%eax
+  804e10:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  804e13:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804e1a:	ff ff ff 
+  804e1d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804e21:	48 8b 00             	mov    (%rax),%rax
+  804e24:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804e2a:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  804e2d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e30:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804e33:	75 05                	jne    804e3a <_pipeisclosed+0xab>
+			return ret;
+  804e35:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804e38:	eb 63                	jmp    804e9d <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  804e3a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e3d:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804e40:	0f 84 72 ff ff ff    	je     804db8 <_pipeisclosed+0x29>
+  804e46:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  804e4a:	0f 85 68 ff ff ff    	jne    804db8 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804e50:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804e57:	ff ff ff 
+  804e5a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804e5e:	48 8b 00             	mov    (%rax),%rax
+  804e61:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  804e67:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804e6a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e6d:	89 c6                	mov    %eax,%esi
+  804e6f:	48 b8 de e5 ff ff ff 	movabs $0xffffffffffffe5de,%rax
+  804e76:	ff ff ff 
+  804e79:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e7d:	48 89 c7             	mov    %rax,%rdi
+  804e80:	49 89 df             	mov    %rbx,%r15
+  804e83:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e88:	49 b8 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%r8
+  804e8f:	ff ff ff 
+  804e92:	49 01 d8             	add    %rbx,%r8
+  804e95:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  804e98:	e9 1b ff ff ff       	jmp    804db8 <_pipeisclosed+0x29>
+	}
+}
+  804e9d:	48 83 c4 28          	add    $0x28,%rsp
+  804ea1:	5b                   	pop    %rbx
+  804ea2:	41 5c                	pop    %r12
+  804ea4:	41 5f                	pop    %r15
+  804ea6:	5d                   	pop    %rbp
+  804ea7:	c3                   	ret
+
+0000000000804ea8 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  804ea8:	55                   	push   %rbp
+  804ea9:	48 89 e5             	mov    %rsp,%rbp
+  804eac:	41 57                	push   %r15
+  804eae:	53                   	push   %rbx
+  804eaf:	48 83 ec 30          	sub    $0x30,%rsp
+  804eb3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804eb3 <pipeisclosed+0xb>
+  804eba:	49 bb 85 31 00 00 00 	movabs $0x3185,%r11
+  804ec1:	00 00 00 
+  804ec4:	4c 01 db             	add    %r11,%rbx
+  804ec7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804eca:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804ece:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804ed1:	48 89 d6             	mov    %rdx,%rsi
+  804ed4:	89 c7                	mov    %eax,%edi
+  804ed6:	49 89 df             	mov    %rbx,%r15
+  804ed9:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  804ee0:	ff ff ff 
+  804ee3:	48 01 d8             	add    %rbx,%rax
+  804ee6:	ff d0                	call   *%rax
+  804ee8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804eeb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804eef:	79 05                	jns    804ef6 <pipeisclosed+0x4e>
+		return r;
+  804ef1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ef4:	eb 3b                	jmp    804f31 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  804ef6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804efa:	48 89 c7             	mov    %rax,%rdi
+  804efd:	49 89 df             	mov    %rbx,%r15
+  804f00:	48 b8 6d a7 ff ff ff 	movabs $0xffffffffffffa76d,%rax
+  804f07:	ff ff ff 
+  804f0a:	48 01 d8             	add    %rbx,%rax
+  804f0d:	ff d0                	call   *%rax
+  804f0f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  804f13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f17:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f1b:	48 89 d6             	mov    %rdx,%rsi
+  804f1e:	48 89 c7             	mov    %rax,%rdi
+  804f21:	48 b8 57 cd ff ff ff 	movabs $0xffffffffffffcd57,%rax
+  804f28:	ff ff ff 
+  804f2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f2f:	ff d0                	call   *%rax
+}
+  804f31:	48 83 c4 30          	add    $0x30,%rsp
+  804f35:	5b                   	pop    %rbx
+  804f36:	41 5f                	pop    %r15
+  804f38:	5d                   	pop    %rbp
+  804f39:	c3                   	ret
+
+0000000000804f3a <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  804f3a:	55                   	push   %rbp
+  804f3b:	48 89 e5             	mov    %rsp,%rbp
+  804f3e:	41 57                	push   %r15
+  804f40:	53                   	push   %rbx
+  804f41:	48 83 ec 40          	sub    $0x40,%rsp
+  804f45:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f45 <devpipe_read+0xb>
+  804f4c:	49 bb f3 30 00 00 00 	movabs $0x30f3,%r11
+  804f53:	00 00 00 
+  804f56:	4c 01 db             	add    %r11,%rbx
+  804f59:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804f5d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804f61:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  804f65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f69:	48 89 c7             	mov    %rax,%rdi
+  804f6c:	49 89 df             	mov    %rbx,%r15
+  804f6f:	48 b8 6d a7 ff ff ff 	movabs $0xffffffffffffa76d,%rax
+  804f76:	ff ff ff 
+  804f79:	48 01 d8             	add    %rbx,%rax
+  804f7c:	ff d0                	call   *%rax
+  804f7e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  804f82:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f86:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  804f8a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804f91:	00 
+  804f92:	e9 a1 00 00 00       	jmp    805038 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  804f97:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804f9c:	74 09                	je     804fa7 <devpipe_read+0x6d>
+				return i;
+  804f9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fa2:	e9 9f 00 00 00       	jmp    805046 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  804fa7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804fab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804faf:	48 89 d6             	mov    %rdx,%rsi
+  804fb2:	48 89 c7             	mov    %rax,%rdi
+  804fb5:	48 b8 57 cd ff ff ff 	movabs $0xffffffffffffcd57,%rax
+  804fbc:	ff ff ff 
+  804fbf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fc3:	ff d0                	call   *%rax
+  804fc5:	85 c0                	test   %eax,%eax
+  804fc7:	74 07                	je     804fd0 <devpipe_read+0x96>
+				return 0;
+  804fc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fce:	eb 76                	jmp    805046 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  804fd0:	49 89 df             	mov    %rbx,%r15
+  804fd3:	48 b8 b6 9d ff ff ff 	movabs $0xffffffffffff9db6,%rax
+  804fda:	ff ff ff 
+  804fdd:	48 01 d8             	add    %rbx,%rax
+  804fe0:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  804fe2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fe6:	8b 10                	mov    (%rax),%edx
+  804fe8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fec:	8b 40 04             	mov    0x4(%rax),%eax
+  804fef:	39 c2                	cmp    %eax,%edx
+  804ff1:	74 a4                	je     804f97 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804ff3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ff7:	8b 10                	mov    (%rax),%edx
+  804ff9:	89 d0                	mov    %edx,%eax
+  804ffb:	c1 f8 1f             	sar    $0x1f,%eax
+  804ffe:	c1 e8 1b             	shr    $0x1b,%eax
+  805001:	01 c2                	add    %eax,%edx
+  805003:	83 e2 1f             	and    $0x1f,%edx
+  805006:	29 c2                	sub    %eax,%edx
+  805008:	89 d6                	mov    %edx,%esi
+  80500a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80500e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805012:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805016:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80501a:	48 63 c6             	movslq %esi,%rax
+  80501d:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805022:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805024:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805028:	8b 00                	mov    (%rax),%eax
+  80502a:	8d 50 01             	lea    0x1(%rax),%edx
+  80502d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805031:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805033:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805038:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80503c:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805040:	72 a0                	jb     804fe2 <devpipe_read+0xa8>
+	}
+	return i;
+  805042:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805046:	48 83 c4 40          	add    $0x40,%rsp
+  80504a:	5b                   	pop    %rbx
+  80504b:	41 5f                	pop    %r15
+  80504d:	5d                   	pop    %rbp
+  80504e:	c3                   	ret
+
+000000000080504f <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80504f:	55                   	push   %rbp
+  805050:	48 89 e5             	mov    %rsp,%rbp
+  805053:	41 57                	push   %r15
+  805055:	53                   	push   %rbx
+  805056:	48 83 ec 40          	sub    $0x40,%rsp
+  80505a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80505a <devpipe_write+0xb>
+  805061:	49 bb de 2f 00 00 00 	movabs $0x2fde,%r11
+  805068:	00 00 00 
+  80506b:	4c 01 db             	add    %r11,%rbx
+  80506e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805072:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805076:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80507a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80507e:	48 89 c7             	mov    %rax,%rdi
+  805081:	49 89 df             	mov    %rbx,%r15
+  805084:	48 b8 6d a7 ff ff ff 	movabs $0xffffffffffffa76d,%rax
+  80508b:	ff ff ff 
+  80508e:	48 01 d8             	add    %rbx,%rax
+  805091:	ff d0                	call   *%rax
+  805093:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805097:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80509b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80509f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8050a6:	00 
+  8050a7:	e9 a0 00 00 00       	jmp    80514c <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8050ac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8050b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050b4:	48 89 d6             	mov    %rdx,%rsi
+  8050b7:	48 89 c7             	mov    %rax,%rdi
+  8050ba:	48 b8 57 cd ff ff ff 	movabs $0xffffffffffffcd57,%rax
+  8050c1:	ff ff ff 
+  8050c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050c8:	ff d0                	call   *%rax
+  8050ca:	85 c0                	test   %eax,%eax
+  8050cc:	74 0a                	je     8050d8 <devpipe_write+0x89>
+				return 0;
+  8050ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050d3:	e9 82 00 00 00       	jmp    80515a <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8050d8:	49 89 df             	mov    %rbx,%r15
+  8050db:	48 b8 b6 9d ff ff ff 	movabs $0xffffffffffff9db6,%rax
+  8050e2:	ff ff ff 
+  8050e5:	48 01 d8             	add    %rbx,%rax
+  8050e8:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8050ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050ee:	8b 40 04             	mov    0x4(%rax),%eax
+  8050f1:	48 63 d0             	movslq %eax,%rdx
+  8050f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050f8:	8b 00                	mov    (%rax),%eax
+  8050fa:	48 98                	cltq
+  8050fc:	48 83 c0 20          	add    $0x20,%rax
+  805100:	48 39 c2             	cmp    %rax,%rdx
+  805103:	73 a7                	jae    8050ac <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805105:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805109:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80510d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805111:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805115:	8b 50 04             	mov    0x4(%rax),%edx
+  805118:	89 d0                	mov    %edx,%eax
+  80511a:	c1 f8 1f             	sar    $0x1f,%eax
+  80511d:	c1 e8 1b             	shr    $0x1b,%eax
+  805120:	01 c2                	add    %eax,%edx
+  805122:	83 e2 1f             	and    $0x1f,%edx
+  805125:	29 c2                	sub    %eax,%edx
+  805127:	89 d0                	mov    %edx,%eax
+  805129:	0f b6 09             	movzbl (%rcx),%ecx
+  80512c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805130:	48 98                	cltq
+  805132:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805136:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80513a:	8b 40 04             	mov    0x4(%rax),%eax
+  80513d:	8d 50 01             	lea    0x1(%rax),%edx
+  805140:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805144:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805147:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80514c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805150:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805154:	72 94                	jb     8050ea <devpipe_write+0x9b>
+	}
+
+	return i;
+  805156:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80515a:	48 83 c4 40          	add    $0x40,%rsp
+  80515e:	5b                   	pop    %rbx
+  80515f:	41 5f                	pop    %r15
+  805161:	5d                   	pop    %rbp
+  805162:	c3                   	ret
+
+0000000000805163 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805163:	55                   	push   %rbp
+  805164:	48 89 e5             	mov    %rsp,%rbp
+  805167:	41 57                	push   %r15
+  805169:	53                   	push   %rbx
+  80516a:	48 83 ec 20          	sub    $0x20,%rsp
+  80516e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80516e <devpipe_stat+0xb>
+  805175:	49 bb ca 2e 00 00 00 	movabs $0x2eca,%r11
+  80517c:	00 00 00 
+  80517f:	4c 01 db             	add    %r11,%rbx
+  805182:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805186:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80518a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80518e:	48 89 c7             	mov    %rax,%rdi
+  805191:	49 89 df             	mov    %rbx,%r15
+  805194:	48 b8 6d a7 ff ff ff 	movabs $0xffffffffffffa76d,%rax
+  80519b:	ff ff ff 
+  80519e:	48 01 d8             	add    %rbx,%rax
+  8051a1:	ff d0                	call   *%rax
+  8051a3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8051a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051ab:	48 ba f1 e5 ff ff ff 	movabs $0xffffffffffffe5f1,%rdx
+  8051b2:	ff ff ff 
+  8051b5:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8051b9:	48 89 d6             	mov    %rdx,%rsi
+  8051bc:	48 89 c7             	mov    %rax,%rdi
+  8051bf:	49 89 df             	mov    %rbx,%r15
+  8051c2:	48 b8 4f 91 ff ff ff 	movabs $0xffffffffffff914f,%rax
+  8051c9:	ff ff ff 
+  8051cc:	48 01 d8             	add    %rbx,%rax
+  8051cf:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8051d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051d5:	8b 50 04             	mov    0x4(%rax),%edx
+  8051d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051dc:	8b 00                	mov    (%rax),%eax
+  8051de:	29 c2                	sub    %eax,%edx
+  8051e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051e4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8051ea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051ee:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8051f5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8051f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051fc:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  805203:	00 00 00 
+  805206:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80520a:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805211:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805216:	48 83 c4 20          	add    $0x20,%rsp
+  80521a:	5b                   	pop    %rbx
+  80521b:	41 5f                	pop    %r15
+  80521d:	5d                   	pop    %rbp
+  80521e:	c3                   	ret
+
+000000000080521f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80521f:	55                   	push   %rbp
+  805220:	48 89 e5             	mov    %rsp,%rbp
+  805223:	41 57                	push   %r15
+  805225:	53                   	push   %rbx
+  805226:	48 83 ec 10          	sub    $0x10,%rsp
+  80522a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80522a <devpipe_close+0xb>
+  805231:	49 bb 0e 2e 00 00 00 	movabs $0x2e0e,%r11
+  805238:	00 00 00 
+  80523b:	4c 01 db             	add    %r11,%rbx
+  80523e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805242:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805246:	48 89 c6             	mov    %rax,%rsi
+  805249:	bf 00 00 00 00       	mov    $0x0,%edi
+  80524e:	49 89 df             	mov    %rbx,%r15
+  805251:	48 b8 e3 9e ff ff ff 	movabs $0xffffffffffff9ee3,%rax
+  805258:	ff ff ff 
+  80525b:	48 01 d8             	add    %rbx,%rax
+  80525e:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805260:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805264:	48 89 c7             	mov    %rax,%rdi
+  805267:	49 89 df             	mov    %rbx,%r15
+  80526a:	48 b8 6d a7 ff ff ff 	movabs $0xffffffffffffa76d,%rax
+  805271:	ff ff ff 
+  805274:	48 01 d8             	add    %rbx,%rax
+  805277:	ff d0                	call   *%rax
+  805279:	48 89 c6             	mov    %rax,%rsi
+  80527c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805281:	49 89 df             	mov    %rbx,%r15
+  805284:	48 b8 e3 9e ff ff ff 	movabs $0xffffffffffff9ee3,%rax
+  80528b:	ff ff ff 
+  80528e:	48 01 d8             	add    %rbx,%rax
+  805291:	ff d0                	call   *%rax
+}
+  805293:	48 83 c4 10          	add    $0x10,%rsp
+  805297:	5b                   	pop    %rbx
+  805298:	41 5f                	pop    %r15
+  80529a:	5d                   	pop    %rbp
+  80529b:	c3                   	ret
+
+000000000080529c <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80529c:	55                   	push   %rbp
+  80529d:	48 89 e5             	mov    %rsp,%rbp
+  8052a0:	41 57                	push   %r15
+  8052a2:	48 83 ec 28          	sub    $0x28,%rsp
+  8052a6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8052a6 <cputchar+0xa>
+  8052ad:	49 bb 92 2d 00 00 00 	movabs $0x2d92,%r11
+  8052b4:	00 00 00 
+  8052b7:	4c 01 d8             	add    %r11,%rax
+  8052ba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8052bd:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8052c0:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8052c3:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8052c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8052cc:	48 89 d7             	mov    %rdx,%rdi
+  8052cf:	49 89 c7             	mov    %rax,%r15
+  8052d2:	48 ba 53 9c ff ff ff 	movabs $0xffffffffffff9c53,%rdx
+  8052d9:	ff ff ff 
+  8052dc:	48 01 c2             	add    %rax,%rdx
+  8052df:	ff d2                	call   *%rdx
+}
+  8052e1:	90                   	nop
+  8052e2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8052e6:	c9                   	leave
+  8052e7:	c3                   	ret
+
+00000000008052e8 <getchar>:
+
+int
+getchar(void)
+{
+  8052e8:	55                   	push   %rbp
+  8052e9:	48 89 e5             	mov    %rsp,%rbp
+  8052ec:	41 57                	push   %r15
+  8052ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8052f2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8052f2 <getchar+0xa>
+  8052f9:	49 bb 46 2d 00 00 00 	movabs $0x2d46,%r11
+  805300:	00 00 00 
+  805303:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805306:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80530a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80530f:	48 89 ce             	mov    %rcx,%rsi
+  805312:	bf 00 00 00 00       	mov    $0x0,%edi
+  805317:	49 89 c7             	mov    %rax,%r15
+  80531a:	48 b9 ad ad ff ff ff 	movabs $0xffffffffffffadad,%rcx
+  805321:	ff ff ff 
+  805324:	48 01 c1             	add    %rax,%rcx
+  805327:	ff d1                	call   *%rcx
+  805329:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80532c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805330:	79 05                	jns    805337 <getchar+0x4f>
+		return r;
+  805332:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805335:	eb 14                	jmp    80534b <getchar+0x63>
+	if (r < 1)
+  805337:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80533b:	7f 07                	jg     805344 <getchar+0x5c>
+		return -E_EOF;
+  80533d:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  805342:	eb 07                	jmp    80534b <getchar+0x63>
+	return c;
+  805344:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805348:	0f b6 c0             	movzbl %al,%eax
+}
+  80534b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80534f:	c9                   	leave
+  805350:	c3                   	ret
+
+0000000000805351 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  805351:	55                   	push   %rbp
+  805352:	48 89 e5             	mov    %rsp,%rbp
+  805355:	41 57                	push   %r15
+  805357:	53                   	push   %rbx
+  805358:	48 83 ec 20          	sub    $0x20,%rsp
+  80535c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80535c <iscons+0xb>
+  805363:	49 bb dc 2c 00 00 00 	movabs $0x2cdc,%r11
+  80536a:	00 00 00 
+  80536d:	4c 01 db             	add    %r11,%rbx
+  805370:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805373:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805377:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80537a:	48 89 d6             	mov    %rdx,%rsi
+  80537d:	89 c7                	mov    %eax,%edi
+  80537f:	49 89 df             	mov    %rbx,%r15
+  805382:	48 b8 66 a8 ff ff ff 	movabs $0xffffffffffffa866,%rax
+  805389:	ff ff ff 
+  80538c:	48 01 d8             	add    %rbx,%rax
+  80538f:	ff d0                	call   *%rax
+  805391:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805394:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805398:	79 05                	jns    80539f <iscons+0x4e>
+		return r;
+  80539a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80539d:	eb 1b                	jmp    8053ba <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80539f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053a3:	8b 10                	mov    (%rax),%edx
+  8053a5:	48 b8 08 01 00 00 00 	movabs $0x108,%rax
+  8053ac:	00 00 00 
+  8053af:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8053b2:	39 c2                	cmp    %eax,%edx
+  8053b4:	0f 94 c0             	sete   %al
+  8053b7:	0f b6 c0             	movzbl %al,%eax
+}
+  8053ba:	48 83 c4 20          	add    $0x20,%rsp
+  8053be:	5b                   	pop    %rbx
+  8053bf:	41 5f                	pop    %r15
+  8053c1:	5d                   	pop    %rbp
+  8053c2:	c3                   	ret
+
+00000000008053c3 <opencons>:
+
+int
+opencons(void)
+{
+  8053c3:	55                   	push   %rbp
+  8053c4:	48 89 e5             	mov    %rsp,%rbp
+  8053c7:	41 57                	push   %r15
+  8053c9:	53                   	push   %rbx
+  8053ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8053ce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053ce <opencons+0xb>
+  8053d5:	49 bb 6a 2c 00 00 00 	movabs $0x2c6a,%r11
+  8053dc:	00 00 00 
+  8053df:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8053e2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8053e6:	48 89 c7             	mov    %rax,%rdi
+  8053e9:	49 89 df             	mov    %rbx,%r15
+  8053ec:	48 b8 b0 a7 ff ff ff 	movabs $0xffffffffffffa7b0,%rax
+  8053f3:	ff ff ff 
+  8053f6:	48 01 d8             	add    %rbx,%rax
+  8053f9:	ff d0                	call   *%rax
+  8053fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805402:	79 05                	jns    805409 <opencons+0x46>
+		return r;
+  805404:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805407:	eb 68                	jmp    805471 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805409:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80540d:	ba 07 04 00 00       	mov    $0x407,%edx
+  805412:	48 89 c6             	mov    %rax,%rsi
+  805415:	bf 00 00 00 00       	mov    $0x0,%edi
+  80541a:	49 89 df             	mov    %rbx,%r15
+  80541d:	48 b8 0b 9e ff ff ff 	movabs $0xffffffffffff9e0b,%rax
+  805424:	ff ff ff 
+  805427:	48 01 d8             	add    %rbx,%rax
+  80542a:	ff d0                	call   *%rax
+  80542c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80542f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805433:	79 05                	jns    80543a <opencons+0x77>
+		return r;
+  805435:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805438:	eb 37                	jmp    805471 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80543a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80543e:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  805445:	00 00 00 
+  805448:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80544b:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80544d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805451:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805458:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80545c:	48 89 c7             	mov    %rax,%rdi
+  80545f:	49 89 df             	mov    %rbx,%r15
+  805462:	48 b8 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rax
+  805469:	ff ff ff 
+  80546c:	48 01 d8             	add    %rbx,%rax
+  80546f:	ff d0                	call   *%rax
+}
+  805471:	48 83 c4 10          	add    $0x10,%rsp
+  805475:	5b                   	pop    %rbx
+  805476:	41 5f                	pop    %r15
+  805478:	5d                   	pop    %rbp
+  805479:	c3                   	ret
+
+000000000080547a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80547a:	55                   	push   %rbp
+  80547b:	48 89 e5             	mov    %rsp,%rbp
+  80547e:	41 57                	push   %r15
+  805480:	53                   	push   %rbx
+  805481:	48 83 ec 30          	sub    $0x30,%rsp
+  805485:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805485 <devcons_read+0xb>
+  80548c:	49 bb b3 2b 00 00 00 	movabs $0x2bb3,%r11
+  805493:	00 00 00 
+  805496:	4c 01 db             	add    %r11,%rbx
+  805499:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80549d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8054a1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8054a5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8054aa:	75 19                	jne    8054c5 <devcons_read+0x4b>
+		return 0;
+  8054ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054b1:	eb 55                	jmp    805508 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8054b3:	49 89 df             	mov    %rbx,%r15
+  8054b6:	48 b8 b6 9d ff ff ff 	movabs $0xffffffffffff9db6,%rax
+  8054bd:	ff ff ff 
+  8054c0:	48 01 d8             	add    %rbx,%rax
+  8054c3:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8054c5:	49 89 df             	mov    %rbx,%r15
+  8054c8:	48 b8 b2 9c ff ff ff 	movabs $0xffffffffffff9cb2,%rax
+  8054cf:	ff ff ff 
+  8054d2:	48 01 d8             	add    %rbx,%rax
+  8054d5:	ff d0                	call   *%rax
+  8054d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054da:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054de:	74 d3                	je     8054b3 <devcons_read+0x39>
+	if (c < 0)
+  8054e0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054e4:	79 05                	jns    8054eb <devcons_read+0x71>
+		return c;
+  8054e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054e9:	eb 1d                	jmp    805508 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8054eb:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8054ef:	75 07                	jne    8054f8 <devcons_read+0x7e>
+		return 0;
+  8054f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054f6:	eb 10                	jmp    805508 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8054f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054fb:	89 c2                	mov    %eax,%edx
+  8054fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805501:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805503:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805508:	48 83 c4 30          	add    $0x30,%rsp
+  80550c:	5b                   	pop    %rbx
+  80550d:	41 5f                	pop    %r15
+  80550f:	5d                   	pop    %rbp
+  805510:	c3                   	ret
+
+0000000000805511 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805511:	55                   	push   %rbp
+  805512:	48 89 e5             	mov    %rsp,%rbp
+  805515:	41 57                	push   %r15
+  805517:	53                   	push   %rbx
+  805518:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80551f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80551f <devcons_write+0xe>
+  805526:	49 bb 19 2b 00 00 00 	movabs $0x2b19,%r11
+  80552d:	00 00 00 
+  805530:	4c 01 db             	add    %r11,%rbx
+  805533:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80553a:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  805541:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805548:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80554f:	e9 80 00 00 00       	jmp    8055d4 <devcons_write+0xc3>
+		m = n - tot;
+  805554:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80555b:	89 c2                	mov    %eax,%edx
+  80555d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805560:	29 c2                	sub    %eax,%edx
+  805562:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  805565:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805568:	83 f8 7f             	cmp    $0x7f,%eax
+  80556b:	76 07                	jbe    805574 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  80556d:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  805574:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805577:	48 63 d0             	movslq %eax,%rdx
+  80557a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80557d:	48 63 c8             	movslq %eax,%rcx
+  805580:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  805587:	48 01 c1             	add    %rax,%rcx
+  80558a:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805591:	48 89 ce             	mov    %rcx,%rsi
+  805594:	48 89 c7             	mov    %rax,%rdi
+  805597:	49 89 df             	mov    %rbx,%r15
+  80559a:	48 b8 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rax
+  8055a1:	ff ff ff 
+  8055a4:	48 01 d8             	add    %rbx,%rax
+  8055a7:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8055a9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8055ac:	48 63 d0             	movslq %eax,%rdx
+  8055af:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8055b6:	48 89 d6             	mov    %rdx,%rsi
+  8055b9:	48 89 c7             	mov    %rax,%rdi
+  8055bc:	49 89 df             	mov    %rbx,%r15
+  8055bf:	48 b8 53 9c ff ff ff 	movabs $0xffffffffffff9c53,%rax
+  8055c6:	ff ff ff 
+  8055c9:	48 01 d8             	add    %rbx,%rax
+  8055cc:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8055ce:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8055d1:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8055d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055d7:	48 98                	cltq
+  8055d9:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8055e0:	0f 82 6e ff ff ff    	jb     805554 <devcons_write+0x43>
+	}
+	return tot;
+  8055e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8055e9:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8055f0:	5b                   	pop    %rbx
+  8055f1:	41 5f                	pop    %r15
+  8055f3:	5d                   	pop    %rbp
+  8055f4:	c3                   	ret
+
+00000000008055f5 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8055f5:	55                   	push   %rbp
+  8055f6:	48 89 e5             	mov    %rsp,%rbp
+  8055f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8055fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055fd <devcons_close+0x8>
+  805604:	49 bb 3b 2a 00 00 00 	movabs $0x2a3b,%r11
+  80560b:	00 00 00 
+  80560e:	4c 01 d8             	add    %r11,%rax
+  805611:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  805615:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80561a:	c9                   	leave
+  80561b:	c3                   	ret
+
+000000000080561c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80561c:	55                   	push   %rbp
+  80561d:	48 89 e5             	mov    %rsp,%rbp
+  805620:	41 57                	push   %r15
+  805622:	48 83 ec 18          	sub    $0x18,%rsp
+  805626:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805626 <devcons_stat+0xa>
+  80562d:	49 bb 12 2a 00 00 00 	movabs $0x2a12,%r11
+  805634:	00 00 00 
+  805637:	4c 01 d8             	add    %r11,%rax
+  80563a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80563e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  805642:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805646:	48 b9 fd e5 ff ff ff 	movabs $0xffffffffffffe5fd,%rcx
+  80564d:	ff ff ff 
+  805650:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805654:	48 89 ce             	mov    %rcx,%rsi
+  805657:	48 89 d7             	mov    %rdx,%rdi
+  80565a:	49 89 c7             	mov    %rax,%r15
+  80565d:	48 ba 4f 91 ff ff ff 	movabs $0xffffffffffff914f,%rdx
+  805664:	ff ff ff 
+  805667:	48 01 c2             	add    %rax,%rdx
+  80566a:	ff d2                	call   *%rdx
+	return 0;
+  80566c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805671:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805675:	c9                   	leave
+  805676:	c3                   	ret
+
+0000000000805677 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  805677:	55                   	push   %rbp
+  805678:	48 89 e5             	mov    %rsp,%rbp
+  80567b:	41 57                	push   %r15
+  80567d:	41 54                	push   %r12
+  80567f:	53                   	push   %rbx
+  805680:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  805687:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805687 <_panic+0x10>
+  80568e:	49 bb b1 29 00 00 00 	movabs $0x29b1,%r11
+  805695:	00 00 00 
+  805698:	4c 01 db             	add    %r11,%rbx
+  80569b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8056a2:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8056a8:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8056af:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8056b6:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8056bd:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8056c4:	84 c0                	test   %al,%al
+  8056c6:	74 26                	je     8056ee <_panic+0x77>
+  8056c8:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8056cf:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8056d6:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8056da:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8056de:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8056e2:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8056e6:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8056ea:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8056ee:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8056f5:	00 00 00 
+  8056f8:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8056ff:	00 00 00 
+  805702:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805706:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80570d:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  805714:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80571b:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  805722:	ff ff ff 
+  805725:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805729:	4c 8b 20             	mov    (%rax),%r12
+  80572c:	49 89 df             	mov    %rbx,%r15
+  80572f:	48 b8 62 9d ff ff ff 	movabs $0xffffffffffff9d62,%rax
+  805736:	ff ff ff 
+  805739:	48 01 d8             	add    %rbx,%rax
+  80573c:	ff d0                	call   *%rax
+  80573e:	89 c6                	mov    %eax,%esi
+  805740:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  805746:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80574d:	41 89 d0             	mov    %edx,%r8d
+  805750:	48 89 c1             	mov    %rax,%rcx
+  805753:	4c 89 e2             	mov    %r12,%rdx
+  805756:	48 b8 08 e6 ff ff ff 	movabs $0xffffffffffffe608,%rax
+  80575d:	ff ff ff 
+  805760:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805764:	48 89 c7             	mov    %rax,%rdi
+  805767:	49 89 df             	mov    %rbx,%r15
+  80576a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80576f:	49 b9 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%r9
+  805776:	ff ff ff 
+  805779:	49 01 d9             	add    %rbx,%r9
+  80577c:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80577f:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  805786:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80578d:	48 89 d6             	mov    %rdx,%rsi
+  805790:	48 89 c7             	mov    %rax,%rdi
+  805793:	49 89 df             	mov    %rbx,%r15
+  805796:	48 b8 ad 82 ff ff ff 	movabs $0xffffffffffff82ad,%rax
+  80579d:	ff ff ff 
+  8057a0:	48 01 d8             	add    %rbx,%rax
+  8057a3:	ff d0                	call   *%rax
+	cprintf("\n");
+  8057a5:	48 b8 2b e6 ff ff ff 	movabs $0xffffffffffffe62b,%rax
+  8057ac:	ff ff ff 
+  8057af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057b3:	48 89 c7             	mov    %rax,%rdi
+  8057b6:	49 89 df             	mov    %rbx,%r15
+  8057b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057be:	48 ba 8d 83 ff ff ff 	movabs $0xffffffffffff838d,%rdx
+  8057c5:	ff ff ff 
+  8057c8:	48 01 da             	add    %rbx,%rdx
+  8057cb:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8057cd:	cc                   	int3
+  8057ce:	eb fd                	jmp    8057cd <_panic+0x156>
+
+00000000008057d0 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8057d0:	55                   	push   %rbp
+  8057d1:	48 89 e5             	mov    %rsp,%rbp
+  8057d4:	41 57                	push   %r15
+  8057d6:	53                   	push   %rbx
+  8057d7:	48 83 ec 30          	sub    $0x30,%rsp
+  8057db:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057db <ipc_recv+0xb>
+  8057e2:	49 bb 5d 28 00 00 00 	movabs $0x285d,%r11
+  8057e9:	00 00 00 
+  8057ec:	4c 01 db             	add    %r11,%rbx
+  8057ef:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8057f3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8057f7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8057fb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805800:	75 0e                	jne    805810 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805802:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805809:	00 00 00 
+  80580c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  805810:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805814:	48 89 c7             	mov    %rax,%rdi
+  805817:	49 89 df             	mov    %rbx,%r15
+  80581a:	48 b8 34 a1 ff ff ff 	movabs $0xffffffffffffa134,%rax
+  805821:	ff ff ff 
+  805824:	48 01 d8             	add    %rbx,%rax
+  805827:	ff d0                	call   *%rax
+  805829:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  80582c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805831:	74 2a                	je     80585d <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805833:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805837:	75 19                	jne    805852 <ipc_recv+0x82>
+  805839:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805840:	ff ff ff 
+  805843:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805847:	48 8b 00             	mov    (%rax),%rax
+  80584a:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805850:	eb 05                	jmp    805857 <ipc_recv+0x87>
+  805852:	b8 00 00 00 00       	mov    $0x0,%eax
+  805857:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80585b:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80585d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805862:	74 2a                	je     80588e <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805864:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805868:	75 19                	jne    805883 <ipc_recv+0xb3>
+  80586a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805871:	ff ff ff 
+  805874:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805878:	48 8b 00             	mov    (%rax),%rax
+  80587b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805881:	eb 05                	jmp    805888 <ipc_recv+0xb8>
+  805883:	b8 00 00 00 00       	mov    $0x0,%eax
+  805888:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80588c:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80588e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805892:	74 05                	je     805899 <ipc_recv+0xc9>
+		return res;
+  805894:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805897:	eb 17                	jmp    8058b0 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805899:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8058a0:	ff ff ff 
+  8058a3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058a7:	48 8b 00             	mov    (%rax),%rax
+  8058aa:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8058b0:	48 83 c4 30          	add    $0x30,%rsp
+  8058b4:	5b                   	pop    %rbx
+  8058b5:	41 5f                	pop    %r15
+  8058b7:	5d                   	pop    %rbp
+  8058b8:	c3                   	ret
+
+00000000008058b9 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8058b9:	55                   	push   %rbp
+  8058ba:	48 89 e5             	mov    %rsp,%rbp
+  8058bd:	41 57                	push   %r15
+  8058bf:	53                   	push   %rbx
+  8058c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8058c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058c4 <ipc_send+0xb>
+  8058cb:	49 bb 74 27 00 00 00 	movabs $0x2774,%r11
+  8058d2:	00 00 00 
+  8058d5:	4c 01 db             	add    %r11,%rbx
+  8058d8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8058db:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8058de:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8058e2:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8058e5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8058ea:	75 0e                	jne    8058fa <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8058ec:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8058f3:	00 00 00 
+  8058f6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8058fa:	90                   	nop
+  8058fb:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8058fe:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805901:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805905:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805908:	89 c7                	mov    %eax,%edi
+  80590a:	49 89 df             	mov    %rbx,%r15
+  80590d:	48 b8 ca a0 ff ff ff 	movabs $0xffffffffffffa0ca,%rax
+  805914:	ff ff ff 
+  805917:	48 01 d8             	add    %rbx,%rax
+  80591a:	ff d0                	call   *%rax
+  80591c:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  80591f:	74 da                	je     8058fb <ipc_send+0x42>
+		;
+}
+  805921:	90                   	nop
+  805922:	90                   	nop
+  805923:	48 83 c4 20          	add    $0x20,%rsp
+  805927:	5b                   	pop    %rbx
+  805928:	41 5f                	pop    %r15
+  80592a:	5d                   	pop    %rbp
+  80592b:	c3                   	ret
+
+000000000080592c <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  80592c:	55                   	push   %rbp
+  80592d:	48 89 e5             	mov    %rsp,%rbp
+  805930:	41 57                	push   %r15
+  805932:	53                   	push   %rbx
+  805933:	48 83 ec 40          	sub    $0x40,%rsp
+  805937:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805937 <ipc_call+0xb>
+  80593e:	49 bb 01 27 00 00 00 	movabs $0x2701,%r11
+  805945:	00 00 00 
+  805948:	4c 01 db             	add    %r11,%rbx
+  80594b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80594e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805951:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805955:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805958:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80595c:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805960:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805965:	75 0e                	jne    805975 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805967:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80596e:	00 00 00 
+  805971:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805975:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80597a:	75 0e                	jne    80598a <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80597c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805983:	00 00 00 
+  805986:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80598a:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80598d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805991:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805994:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805998:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80599b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8059a1:	49 89 f8             	mov    %rdi,%r8
+  8059a4:	89 c7                	mov    %eax,%edi
+  8059a6:	49 89 df             	mov    %rbx,%r15
+  8059a9:	48 b8 8d a1 ff ff ff 	movabs $0xffffffffffffa18d,%rax
+  8059b0:	ff ff ff 
+  8059b3:	48 01 d8             	add    %rbx,%rax
+  8059b6:	ff d0                	call   *%rax
+  8059b8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8059bb:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8059c0:	74 2a                	je     8059ec <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8059c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059c6:	75 19                	jne    8059e1 <ipc_call+0xb5>
+  8059c8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8059cf:	ff ff ff 
+  8059d2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059d6:	48 8b 00             	mov    (%rax),%rax
+  8059d9:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8059df:	eb 05                	jmp    8059e6 <ipc_call+0xba>
+  8059e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059e6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8059ea:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8059ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059f0:	74 05                	je     8059f7 <ipc_call+0xcb>
+		return r;
+  8059f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059f5:	eb 17                	jmp    805a0e <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8059f7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8059fe:	ff ff ff 
+  805a01:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a05:	48 8b 00             	mov    (%rax),%rax
+  805a08:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805a0e:	48 83 c4 40          	add    $0x40,%rsp
+  805a12:	5b                   	pop    %rbx
+  805a13:	41 5f                	pop    %r15
+  805a15:	5d                   	pop    %rbp
+  805a16:	c3                   	ret
+
+0000000000805a17 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805a17:	55                   	push   %rbp
+  805a18:	48 89 e5             	mov    %rsp,%rbp
+  805a1b:	41 57                	push   %r15
+  805a1d:	53                   	push   %rbx
+  805a1e:	48 83 ec 70          	sub    $0x70,%rsp
+  805a22:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a22 <ipc_callw+0xb>
+  805a29:	49 bb 16 26 00 00 00 	movabs $0x2616,%r11
+  805a30:	00 00 00 
+  805a33:	4c 01 db             	add    %r11,%rbx
+  805a36:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805a39:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805a3c:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805a40:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805a44:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805a49:	76 0a                	jbe    805a55 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805a4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805a50:	e9 b7 00 00 00       	jmp    805b0c <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805a55:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805a59:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805a5d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805a61:	48 89 ce             	mov    %rcx,%rsi
+  805a64:	48 89 c7             	mov    %rax,%rdi
+  805a67:	49 89 df             	mov    %rbx,%r15
+  805a6a:	48 b8 2f 95 ff ff ff 	movabs $0xffffffffffff952f,%rax
+  805a71:	ff ff ff 
+  805a74:	48 01 d8             	add    %rbx,%rax
+  805a77:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805a79:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805a80:	00 
+  805a81:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805a85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a89:	48 01 d0             	add    %rdx,%rax
+  805a8c:	48 83 e8 01          	sub    $0x1,%rax
+  805a90:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805a94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a98:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a9d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805aa1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805aa5:	48 29 d0             	sub    %rdx,%rax
+  805aa8:	48 c1 e8 03          	shr    $0x3,%rax
+  805aac:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805ab0:	89 c1                	mov    %eax,%ecx
+  805ab2:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805ab5:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805ab9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805abc:	49 89 d1             	mov    %rdx,%r9
+  805abf:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805ac6:	00 00 00 
+  805ac9:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805ad0:	00 00 00 
+  805ad3:	89 c7                	mov    %eax,%edi
+  805ad5:	49 89 df             	mov    %rbx,%r15
+  805ad8:	48 b8 8d a1 ff ff ff 	movabs $0xffffffffffffa18d,%rax
+  805adf:	ff ff ff 
+  805ae2:	48 01 d8             	add    %rbx,%rax
+  805ae5:	ff d0                	call   *%rax
+  805ae7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805aea:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805aee:	74 05                	je     805af5 <ipc_callw+0xde>
+		return r;
+  805af0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805af3:	eb 17                	jmp    805b0c <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805af5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805afc:	ff ff ff 
+  805aff:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b03:	48 8b 00             	mov    (%rax),%rax
+  805b06:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805b0c:	48 83 c4 70          	add    $0x70,%rsp
+  805b10:	5b                   	pop    %rbx
+  805b11:	41 5f                	pop    %r15
+  805b13:	5d                   	pop    %rbp
+  805b14:	c3                   	ret
+
+0000000000805b15 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805b15:	55                   	push   %rbp
+  805b16:	48 89 e5             	mov    %rsp,%rbp
+  805b19:	41 57                	push   %r15
+  805b1b:	53                   	push   %rbx
+  805b1c:	48 83 ec 40          	sub    $0x40,%rsp
+  805b20:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b20 <ipc_callv+0xb>
+  805b27:	49 bb 18 25 00 00 00 	movabs $0x2518,%r11
+  805b2e:	00 00 00 
+  805b31:	4c 01 db             	add    %r11,%rbx
+  805b34:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805b37:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805b3a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805b3e:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805b41:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805b45:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805b49:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b50:	00 00 00 
+  805b53:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805b57:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805b5b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805b5f:	74 11                	je     805b72 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805b61:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805b65:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805b69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805b6c:	c1 e0 14             	shl    $0x14,%eax
+  805b6f:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805b72:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805b76:	74 14                	je     805b8c <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805b78:	8b 45 20             	mov    0x20(%rbp),%eax
+  805b7b:	83 e8 01             	sub    $0x1,%eax
+  805b7e:	48 63 d0             	movslq %eax,%rdx
+  805b81:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805b85:	48 09 d0             	or     %rdx,%rax
+  805b88:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805b8c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805b8f:	c1 e0 10             	shl    $0x10,%eax
+  805b92:	0b 45 10             	or     0x10(%rbp),%eax
+  805b95:	89 c1                	mov    %eax,%ecx
+  805b97:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805b9a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805b9e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805ba2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805ba6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805ba9:	4d 89 c1             	mov    %r8,%r9
+  805bac:	49 89 f8             	mov    %rdi,%r8
+  805baf:	89 c7                	mov    %eax,%edi
+  805bb1:	49 89 df             	mov    %rbx,%r15
+  805bb4:	48 b8 8d a1 ff ff ff 	movabs $0xffffffffffffa18d,%rax
+  805bbb:	ff ff ff 
+  805bbe:	48 01 d8             	add    %rbx,%rax
+  805bc1:	ff d0                	call   *%rax
+  805bc3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805bc6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805bca:	74 05                	je     805bd1 <ipc_callv+0xbc>
+		return r;
+  805bcc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bcf:	eb 17                	jmp    805be8 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805bd1:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bd8:	ff ff ff 
+  805bdb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bdf:	48 8b 00             	mov    (%rax),%rax
+  805be2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805be8:	48 83 c4 40          	add    $0x40,%rsp
+  805bec:	5b                   	pop    %rbx
+  805bed:	41 5f                	pop    %r15
+  805bef:	5d                   	pop    %rbp
+  805bf0:	c3                   	ret
+
+0000000000805bf1 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805bf1:	55                   	push   %rbp
+  805bf2:	48 89 e5             	mov    %rsp,%rbp
+  805bf5:	41 57                	push   %r15
+  805bf7:	53                   	push   %rbx
+  805bf8:	48 83 ec 40          	sub    $0x40,%rsp
+  805bfc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bfc <ipc_reply_recv+0xb>
+  805c03:	49 bb 3c 24 00 00 00 	movabs $0x243c,%r11
+  805c0a:	00 00 00 
+  805c0d:	4c 01 db             	add    %r11,%rbx
+  805c10:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805c13:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805c16:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805c1a:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805c1d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805c21:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805c25:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805c2a:	75 0e                	jne    805c3a <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805c2c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805c33:	00 00 00 
+  805c36:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805c3a:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805c3f:	75 0e                	jne    805c4f <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805c41:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805c48:	00 00 00 
+  805c4b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805c4f:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805c52:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805c56:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805c5a:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805c5d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805c61:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c64:	4d 89 c1             	mov    %r8,%r9
+  805c67:	49 89 f8             	mov    %rdi,%r8
+  805c6a:	89 c7                	mov    %eax,%edi
+  805c6c:	49 89 df             	mov    %rbx,%r15
+  805c6f:	48 b8 01 a2 ff ff ff 	movabs $0xffffffffffffa201,%rax
+  805c76:	ff ff ff 
+  805c79:	48 01 d8             	add    %rbx,%rax
+  805c7c:	ff d0                	call   *%rax
+  805c7e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805c81:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805c86:	74 2a                	je     805cb2 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805c88:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c8c:	75 19                	jne    805ca7 <ipc_reply_recv+0xb6>
+  805c8e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c95:	ff ff ff 
+  805c98:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c9c:	48 8b 00             	mov    (%rax),%rax
+  805c9f:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805ca5:	eb 05                	jmp    805cac <ipc_reply_recv+0xbb>
+  805ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805cb0:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805cb2:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805cb7:	74 2a                	je     805ce3 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805cb9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805cbd:	75 19                	jne    805cd8 <ipc_reply_recv+0xe7>
+  805cbf:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805cc6:	ff ff ff 
+  805cc9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ccd:	48 8b 00             	mov    (%rax),%rax
+  805cd0:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805cd6:	eb 05                	jmp    805cdd <ipc_reply_recv+0xec>
+  805cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cdd:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805ce1:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805ce3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ce7:	74 05                	je     805cee <ipc_reply_recv+0xfd>
+		return r;
+  805ce9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cec:	eb 17                	jmp    805d05 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805cee:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805cf5:	ff ff ff 
+  805cf8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805cfc:	48 8b 00             	mov    (%rax),%rax
+  805cff:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805d05:	48 83 c4 40          	add    $0x40,%rsp
+  805d09:	5b                   	pop    %rbx
+  805d0a:	41 5f                	pop    %r15
+  805d0c:	5d                   	pop    %rbp
+  805d0d:	c3                   	ret
+
+0000000000805d0e <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805d0e:	55                   	push   %rbp
+  805d0f:	48 89 e5             	mov    %rsp,%rbp
+  805d12:	41 57                	push   %r15
+  805d14:	53                   	push   %rbx
+  805d15:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805d1c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d1c <ipc_window_batch+0xe>
+  805d23:	49 bb 1c 23 00 00 00 	movabs $0x231c,%r11
+  805d2a:	00 00 00 
+  805d2d:	4c 01 db             	add    %r11,%rbx
+  805d30:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805d36:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805d3d:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805d43:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805d49:	e9 15 01 00 00       	jmp    805e63 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805d4e:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805d54:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805d57:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805d5e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d61:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805d64:	39 c2                	cmp    %eax,%edx
+  805d66:	0f 4e c2             	cmovle %edx,%eax
+  805d69:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805d6c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805d73:	eb 6b                	jmp    805de0 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805d75:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d78:	48 98                	cltq
+  805d7a:	48 c1 e0 05          	shl    $0x5,%rax
+  805d7e:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805d82:	48 01 e8             	add    %rbp,%rax
+  805d85:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805d8b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805d91:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d94:	c1 e0 0c             	shl    $0xc,%eax
+  805d97:	48 63 d0             	movslq %eax,%rdx
+  805d9a:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805da1:	48 01 c2             	add    %rax,%rdx
+  805da4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805da7:	48 98                	cltq
+  805da9:	48 c1 e0 05          	shl    $0x5,%rax
+  805dad:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805db1:	48 01 e8             	add    %rbp,%rax
+  805db4:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805dba:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805dbd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dc0:	48 98                	cltq
+  805dc2:	48 c1 e0 05          	shl    $0x5,%rax
+  805dc6:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805dca:	48 01 e8             	add    %rbp,%rax
+  805dcd:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805dd4:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805dda:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805ddc:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805de0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805de3:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805de6:	7c 8d                	jl     805d75 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805de8:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805def:	74 27                	je     805e18 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805df1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805df4:	48 63 d0             	movslq %eax,%rdx
+  805df7:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805dfe:	48 89 d6             	mov    %rdx,%rsi
+  805e01:	48 89 c7             	mov    %rax,%rdi
+  805e04:	49 89 df             	mov    %rbx,%r15
+  805e07:	48 b8 a4 a4 ff ff ff 	movabs $0xffffffffffffa4a4,%rax
+  805e0e:	ff ff ff 
+  805e11:	48 01 d8             	add    %rbx,%rax
+  805e14:	ff d0                	call   *%rax
+  805e16:	eb 25                	jmp    805e3d <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805e18:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805e1b:	48 63 d0             	movslq %eax,%rdx
+  805e1e:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805e25:	48 89 d6             	mov    %rdx,%rsi
+  805e28:	48 89 c7             	mov    %rax,%rdi
+  805e2b:	49 89 df             	mov    %rbx,%r15
+  805e2e:	48 b8 02 a5 ff ff ff 	movabs $0xffffffffffffa502,%rax
+  805e35:	ff ff ff 
+  805e38:	48 01 d8             	add    %rbx,%rax
+  805e3b:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805e3d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805e40:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805e44:	79 05                	jns    805e4b <ipc_window_batch+0x13d>
+			return r;
+  805e46:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e49:	eb 2a                	jmp    805e75 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805e4b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805e4e:	c1 e0 0c             	shl    $0xc,%eax
+  805e51:	48 98                	cltq
+  805e53:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805e5a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805e5d:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805e63:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805e6a:	0f 8f de fe ff ff    	jg     805d4e <ipc_window_batch+0x40>
+	}
+	return 0;
+  805e70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e75:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805e7c:	5b                   	pop    %rbx
+  805e7d:	41 5f                	pop    %r15
+  805e7f:	5d                   	pop    %rbp
+  805e80:	c3                   	ret
+
+0000000000805e81 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805e81:	55                   	push   %rbp
+  805e82:	48 89 e5             	mov    %rsp,%rbp
+  805e85:	48 83 ec 10          	sub    $0x10,%rsp
+  805e89:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e89 <ipc_map_window+0x8>
+  805e90:	49 bb af 21 00 00 00 	movabs $0x21af,%r11
+  805e97:	00 00 00 
+  805e9a:	4c 01 d8             	add    %r11,%rax
+  805e9d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805ea1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805ea4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805ea7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805eab:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805eb0:	bf 01 00 00 00       	mov    $0x1,%edi
+  805eb5:	49 b8 d6 dc ff ff ff 	movabs $0xffffffffffffdcd6,%r8
+  805ebc:	ff ff ff 
+  805ebf:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805ec3:	ff d0                	call   *%rax
+}
+  805ec5:	c9                   	leave
+  805ec6:	c3                   	ret
+
+0000000000805ec7 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805ec7:	55                   	push   %rbp
+  805ec8:	48 89 e5             	mov    %rsp,%rbp
+  805ecb:	48 83 ec 10          	sub    $0x10,%rsp
+  805ecf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ecf <ipc_unmap_window+0x8>
+  805ed6:	49 bb 69 21 00 00 00 	movabs $0x2169,%r11
+  805edd:	00 00 00 
+  805ee0:	4c 01 d8             	add    %r11,%rax
+  805ee3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805ee7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805eea:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805eed:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805ef1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805ef6:	bf 00 00 00 00       	mov    $0x0,%edi
+  805efb:	49 b8 d6 dc ff ff ff 	movabs $0xffffffffffffdcd6,%r8
+  805f02:	ff ff ff 
+  805f05:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805f09:	ff d0                	call   *%rax
+}
+  805f0b:	c9                   	leave
+  805f0c:	c3                   	ret
+
+0000000000805f0d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805f0d:	55                   	push   %rbp
+  805f0e:	48 89 e5             	mov    %rsp,%rbp
+  805f11:	48 83 ec 18          	sub    $0x18,%rsp
+  805f15:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f15 <ipc_find_env+0x8>
+  805f1c:	49 bb 23 21 00 00 00 	movabs $0x2123,%r11
+  805f23:	00 00 00 
+  805f26:	4c 01 d8             	add    %r11,%rax
+  805f29:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805f2c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805f33:	eb 57                	jmp    805f8c <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805f35:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805f3c:	ff ff ff 
+  805f3f:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805f43:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805f46:	48 63 d2             	movslq %edx,%rdx
+  805f49:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805f50:	48 01 ca             	add    %rcx,%rdx
+  805f53:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805f5a:	8b 12                	mov    (%rdx),%edx
+  805f5c:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805f5f:	75 27                	jne    805f88 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805f61:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805f68:	ff ff ff 
+  805f6b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805f6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f72:	48 98                	cltq
+  805f74:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  805f7b:	48 01 d0             	add    %rdx,%rax
+  805f7e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805f84:	8b 00                	mov    (%rax),%eax
+  805f86:	eb 12                	jmp    805f9a <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  805f88:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805f8c:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805f93:	7e a0                	jle    805f35 <ipc_find_env+0x28>
+	}
+	return 0;
+  805f95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805f9a:	c9                   	leave
+  805f9b:	c3                   	ret
+
+0000000000805f9c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805f9c:	55                   	push   %rbp
+  805f9d:	48 89 e5             	mov    %rsp,%rbp
+  805fa0:	48 83 ec 18          	sub    $0x18,%rsp
+  805fa4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805fa4 <pageref+0x8>
+  805fab:	49 bb 94 20 00 00 00 	movabs $0x2094,%r11
+  805fb2:	00 00 00 
+  805fb5:	4c 01 d8             	add    %r11,%rax
+  805fb8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  805fbc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805fc0:	48 89 d1             	mov    %rdx,%rcx
+  805fc3:	48 c1 e9 15          	shr    $0x15,%rcx
+  805fc7:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  805fce:	ff ff ff 
+  805fd1:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805fd5:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805fd9:	83 e2 01             	and    $0x1,%edx
+  805fdc:	48 85 d2             	test   %rdx,%rdx
+  805fdf:	75 07                	jne    805fe8 <pageref+0x4c>
+		return 0;
+  805fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fe6:	eb 64                	jmp    80604c <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  805fe8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805fec:	48 89 d1             	mov    %rdx,%rcx
+  805fef:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805ff3:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  805ffa:	ff ff ff 
+  805ffd:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806001:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806005:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806009:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80600d:	83 e2 01             	and    $0x1,%edx
+  806010:	48 85 d2             	test   %rdx,%rdx
+  806013:	75 07                	jne    80601c <pageref+0x80>
+		return 0;
+  806015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80601a:	eb 30                	jmp    80604c <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  80601c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806020:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806024:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80602b:	ff ff ff 
+  80602e:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806032:	48 89 d0             	mov    %rdx,%rax
+  806035:	48 01 c0             	add    %rax,%rax
+  806038:	48 01 d0             	add    %rdx,%rax
+  80603b:	48 c1 e0 03          	shl    $0x3,%rax
+  80603f:	48 01 c8             	add    %rcx,%rax
+  806042:	48 83 c0 08          	add    $0x8,%rax
+  806046:	0f b7 00             	movzwl (%rax),%eax
+  806049:	0f b7 c0             	movzwl %ax,%eax
+}
+  80604c:	c9                   	leave
+  80604d:	c3                   	ret
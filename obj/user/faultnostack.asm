@@ -0,0 +1,9422 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 61 00 00 00       	call   8000a2 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	48 83 ec 18          	sub    $0x18,%rsp
+  80004d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80004d <umain+0xa>
+  800054:	49 bb eb 7f 00 00 00 	movabs $0x7feb,%r11
+  80005b:	00 00 00 
+  80005e:	4c 01 d8             	add    %r11,%rax
+  800061:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800064:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	sys_env_set_pgfault_upcall(0, (void*) _pgfault_upcall);
+  800068:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80006f:	ff ff ff 
+  800072:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800076:	48 89 d6             	mov    %rdx,%rsi
+  800079:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007e:	49 89 c7             	mov    %rax,%r15
+  800081:	48 ba 8b 87 ff ff ff 	movabs $0xffffffffffff878b,%rdx
+  800088:	ff ff ff 
+  80008b:	48 01 c2             	add    %rax,%rdx
+  80008e:	ff d2                	call   *%rdx
+	*(int*)0 = 0;
+  800090:	b8 00 00 00 00       	mov    $0x0,%eax
+  800095:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80009b:	90                   	nop
+  80009c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8000a0:	c9                   	leave
+  8000a1:	c3                   	ret
+
+00000000008000a2 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000a2:	55                   	push   %rbp
+  8000a3:	48 89 e5             	mov    %rsp,%rbp
+  8000a6:	41 57                	push   %r15
+  8000a8:	53                   	push   %rbx
+  8000a9:	48 83 ec 20          	sub    $0x20,%rsp
+  8000ad:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000ad <libmain+0xb>
+  8000b4:	49 bb 8b 7f 00 00 00 	movabs $0x7f8b,%r11
+  8000bb:	00 00 00 
+  8000be:	4c 01 db             	add    %r11,%rbx
+  8000c1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8000c4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8000c8:	49 89 df             	mov    %rbx,%r15
+  8000cb:	48 b8 ec 84 ff ff ff 	movabs $0xffffffffffff84ec,%rax
+  8000d2:	ff ff ff 
+  8000d5:	48 01 d8             	add    %rbx,%rax
+  8000d8:	ff d0                	call   *%rax
+  8000da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8000dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e5:	48 98                	cltq
+  8000e7:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8000ee:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8000f5:	ff ff ff 
+  8000f8:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8000fc:	48 01 c2             	add    %rax,%rdx
+  8000ff:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  800106:	00 00 00 
+  800109:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80010d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800111:	7e 15                	jle    800128 <libmain+0x86>
+		binaryname = argv[0];
+  800113:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800117:	48 8b 00             	mov    (%rax),%rax
+  80011a:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  800121:	00 00 00 
+  800124:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800128:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80012c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80012f:	48 89 d6             	mov    %rdx,%rsi
+  800132:	89 c7                	mov    %eax,%edi
+  800134:	49 89 df             	mov    %rbx,%r15
+  800137:	48 b8 0b 80 ff ff ff 	movabs $0xffffffffffff800b,%rax
+  80013e:	ff ff ff 
+  800141:	48 01 d8             	add    %rbx,%rax
+  800144:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800146:	49 89 df             	mov    %rbx,%r15
+  800149:	48 b8 2a 81 ff ff ff 	movabs $0xffffffffffff812a,%rax
+  800150:	ff ff ff 
+  800153:	48 01 d8             	add    %rbx,%rax
+  800156:	ff d0                	call   *%rax
+}
+  800158:	90                   	nop
+  800159:	48 83 c4 20          	add    $0x20,%rsp
+  80015d:	5b                   	pop    %rbx
+  80015e:	41 5f                	pop    %r15
+  800160:	5d                   	pop    %rbp
+  800161:	c3                   	ret
+
+0000000000800162 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800162:	55                   	push   %rbp
+  800163:	48 89 e5             	mov    %rsp,%rbp
+  800166:	41 57                	push   %r15
+  800168:	53                   	push   %rbx
+  800169:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800169 <exit+0x7>
+  800170:	49 bb cf 7e 00 00 00 	movabs $0x7ecf,%r11
+  800177:	00 00 00 
+  80017a:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80017d:	49 89 df             	mov    %rbx,%r15
+  800180:	48 b8 f1 91 ff ff ff 	movabs $0xffffffffffff91f1,%rax
+  800187:	ff ff ff 
+  80018a:	48 01 d8             	add    %rbx,%rax
+  80018d:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80018f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800194:	49 89 df             	mov    %rbx,%r15
+  800197:	48 b8 90 84 ff ff ff 	movabs $0xffffffffffff8490,%rax
+  80019e:	ff ff ff 
+  8001a1:	48 01 d8             	add    %rbx,%rax
+  8001a4:	ff d0                	call   *%rax
+}
+  8001a6:	90                   	nop
+  8001a7:	5b                   	pop    %rbx
+  8001a8:	41 5f                	pop    %r15
+  8001aa:	5d                   	pop    %rbp
+  8001ab:	c3                   	ret
+
+00000000008001ac <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  8001ac:	55                   	push   %rbp
+  8001ad:	48 89 e5             	mov    %rsp,%rbp
+  8001b0:	41 57                	push   %r15
+  8001b2:	53                   	push   %rbx
+  8001b3:	48 83 ec 40          	sub    $0x40,%rsp
+  8001b7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8001b7 <syscall+0xb>
+  8001be:	49 bb 81 7e 00 00 00 	movabs $0x7e81,%r11
+  8001c5:	00 00 00 
+  8001c8:	4d 01 da             	add    %r11,%r10
+  8001cb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8001ce:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8001d1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8001d5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8001d9:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8001dd:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  8001e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001e4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8001e8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8001ec:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8001f0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8001f4:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8001f8:	4c 89 c3             	mov    %r8,%rbx
+  8001fb:	cd 30                	int    $0x30
+  8001fd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  800201:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800205:	74 52                	je     800259 <syscall+0xad>
+  800207:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80020c:	7e 4b                	jle    800259 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80020e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800212:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800215:	49 89 d0             	mov    %rdx,%r8
+  800218:	89 c1                	mov    %eax,%ecx
+  80021a:	48 b8 8a df ff ff ff 	movabs $0xffffffffffffdf8a,%rax
+  800221:	ff ff ff 
+  800224:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800228:	48 89 c2             	mov    %rax,%rdx
+  80022b:	be 23 00 00 00       	mov    $0x23,%esi
+  800230:	48 b8 a7 df ff ff ff 	movabs $0xffffffffffffdfa7,%rax
+  800237:	ff ff ff 
+  80023a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80023e:	48 89 c7             	mov    %rax,%rdi
+  800241:	4d 89 d7             	mov    %r10,%r15
+  800244:	b8 00 00 00 00       	mov    $0x0,%eax
+  800249:	49 b9 cf bc ff ff ff 	movabs $0xffffffffffffbccf,%r9
+  800250:	ff ff ff 
+  800253:	4d 01 d1             	add    %r10,%r9
+  800256:	41 ff d1             	call   *%r9
+
+	return ret;
+  800259:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80025d:	48 83 c4 40          	add    $0x40,%rsp
+  800261:	5b                   	pop    %rbx
+  800262:	41 5f                	pop    %r15
+  800264:	5d                   	pop    %rbp
+  800265:	c3                   	ret
+
+0000000000800266 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  800266:	55                   	push   %rbp
+  800267:	48 89 e5             	mov    %rsp,%rbp
+  80026a:	41 57                	push   %r15
+  80026c:	41 56                	push   %r14
+  80026e:	41 55                	push   %r13
+  800270:	41 54                	push   %r12
+  800272:	53                   	push   %rbx
+  800273:	48 83 ec 48          	sub    $0x48,%rsp
+  800277:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 800277 <syscall_words+0x11>
+  80027e:	49 bb c1 7d 00 00 00 	movabs $0x7dc1,%r11
+  800285:	00 00 00 
+  800288:	4d 01 de             	add    %r11,%r14
+  80028b:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80028e:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  800291:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  800295:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  800299:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  80029d:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  8002a1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002a6:	74 09                	je     8002b1 <syscall_words+0x4b>
+  8002a8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002ac:	48 8b 00             	mov    (%rax),%rax
+  8002af:	eb 05                	jmp    8002b6 <syscall_words+0x50>
+  8002b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b6:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  8002b9:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002be:	74 0a                	je     8002ca <syscall_words+0x64>
+  8002c0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002c4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8002c8:	eb 05                	jmp    8002cf <syscall_words+0x69>
+  8002ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cf:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  8002d2:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002d7:	74 0a                	je     8002e3 <syscall_words+0x7d>
+  8002d9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002dd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8002e1:	eb 05                	jmp    8002e8 <syscall_words+0x82>
+  8002e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e8:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8002eb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002f0:	74 0a                	je     8002fc <syscall_words+0x96>
+  8002f2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002f6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8002fa:	eb 05                	jmp    800301 <syscall_words+0x9b>
+  8002fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800301:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  800304:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800309:	74 0a                	je     800315 <syscall_words+0xaf>
+  80030b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80030f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800313:	eb 05                	jmp    80031a <syscall_words+0xb4>
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  80031d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800322:	74 0a                	je     80032e <syscall_words+0xc8>
+  800324:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800328:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80032c:	eb 05                	jmp    800333 <syscall_words+0xcd>
+  80032e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800333:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  800336:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800339:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80033d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800341:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  800345:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800349:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80034d:	cd 30                	int    $0x30
+  80034f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  800353:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800358:	74 50                	je     8003aa <syscall_words+0x144>
+		words[0] = r8;
+  80035a:	4c 89 c2             	mov    %r8,%rdx
+  80035d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800361:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  800364:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800368:	48 83 c0 08          	add    $0x8,%rax
+  80036c:	4c 89 ca             	mov    %r9,%rdx
+  80036f:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  800372:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800376:	48 83 c0 10          	add    $0x10,%rax
+  80037a:	4c 89 d2             	mov    %r10,%rdx
+  80037d:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  800380:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800384:	48 83 c0 18          	add    $0x18,%rax
+  800388:	4c 89 da             	mov    %r11,%rdx
+  80038b:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80038e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800392:	48 83 c0 20          	add    $0x20,%rax
+  800396:	4c 89 e2             	mov    %r12,%rdx
+  800399:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80039c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8003a0:	48 83 c0 28          	add    $0x28,%rax
+  8003a4:	4c 89 ea             	mov    %r13,%rdx
+  8003a7:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  8003aa:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8003ae:	74 52                	je     800402 <syscall_words+0x19c>
+  8003b0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8003b5:	7e 4b                	jle    800402 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003b7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8003bb:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8003be:	49 89 d0             	mov    %rdx,%r8
+  8003c1:	89 c1                	mov    %eax,%ecx
+  8003c3:	48 b8 8a df ff ff ff 	movabs $0xffffffffffffdf8a,%rax
+  8003ca:	ff ff ff 
+  8003cd:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8003d1:	48 89 c2             	mov    %rax,%rdx
+  8003d4:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8003d9:	48 b8 a7 df ff ff ff 	movabs $0xffffffffffffdfa7,%rax
+  8003e0:	ff ff ff 
+  8003e3:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8003e7:	48 89 c7             	mov    %rax,%rdi
+  8003ea:	4d 89 f7             	mov    %r14,%r15
+  8003ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f2:	49 b9 cf bc ff ff ff 	movabs $0xffffffffffffbccf,%r9
+  8003f9:	ff ff ff 
+  8003fc:	4d 01 f1             	add    %r14,%r9
+  8003ff:	41 ff d1             	call   *%r9
+
+	return ret;
+  800402:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  800406:	48 83 c4 48          	add    $0x48,%rsp
+  80040a:	5b                   	pop    %rbx
+  80040b:	41 5c                	pop    %r12
+  80040d:	41 5d                	pop    %r13
+  80040f:	41 5e                	pop    %r14
+  800411:	41 5f                	pop    %r15
+  800413:	5d                   	pop    %rbp
+  800414:	c3                   	ret
+
+0000000000800415 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800415:	55                   	push   %rbp
+  800416:	48 89 e5             	mov    %rsp,%rbp
+  800419:	48 83 ec 10          	sub    $0x10,%rsp
+  80041d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80041d <sys_cputs+0x8>
+  800424:	49 bb 1b 7c 00 00 00 	movabs $0x7c1b,%r11
+  80042b:	00 00 00 
+  80042e:	4c 01 d8             	add    %r11,%rax
+  800431:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800435:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800439:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80043d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800441:	48 83 ec 08          	sub    $0x8,%rsp
+  800445:	6a 00                	push   $0x0
+  800447:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80044d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800453:	be 00 00 00 00       	mov    $0x0,%esi
+  800458:	bf 00 00 00 00       	mov    $0x0,%edi
+  80045d:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800464:	ff ff ff 
+  800467:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80046b:	ff d0                	call   *%rax
+  80046d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800471:	90                   	nop
+  800472:	c9                   	leave
+  800473:	c3                   	ret
+
+0000000000800474 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800474:	55                   	push   %rbp
+  800475:	48 89 e5             	mov    %rsp,%rbp
+  800478:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800478 <sys_cgetc+0x4>
+  80047f:	49 bb c0 7b 00 00 00 	movabs $0x7bc0,%r11
+  800486:	00 00 00 
+  800489:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80048c:	48 83 ec 08          	sub    $0x8,%rsp
+  800490:	6a 00                	push   $0x0
+  800492:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800498:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80049e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004ad:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004b2:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  8004b9:	ff ff ff 
+  8004bc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8004c0:	ff d0                	call   *%rax
+  8004c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004c6:	c9                   	leave
+  8004c7:	c3                   	ret
+
+00000000008004c8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8004d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8004d0 <sys_env_destroy+0x8>
+  8004d7:	49 bb 68 7b 00 00 00 	movabs $0x7b68,%r11
+  8004de:	00 00 00 
+  8004e1:	4c 01 d8             	add    %r11,%rax
+  8004e4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8004e7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8004ea:	48 63 d2             	movslq %edx,%rdx
+  8004ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f1:	6a 00                	push   $0x0
+  8004f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800504:	be 01 00 00 00       	mov    $0x1,%esi
+  800509:	bf 03 00 00 00       	mov    $0x3,%edi
+  80050e:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800515:	ff ff ff 
+  800518:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80051c:	ff d0                	call   *%rax
+  80051e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800522:	c9                   	leave
+  800523:	c3                   	ret
+
+0000000000800524 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800524:	55                   	push   %rbp
+  800525:	48 89 e5             	mov    %rsp,%rbp
+  800528:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800528 <sys_getenvid+0x4>
+  80052f:	49 bb 10 7b 00 00 00 	movabs $0x7b10,%r11
+  800536:	00 00 00 
+  800539:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80053c:	48 83 ec 08          	sub    $0x8,%rsp
+  800540:	6a 00                	push   $0x0
+  800542:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800548:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80054e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800553:	ba 00 00 00 00       	mov    $0x0,%edx
+  800558:	be 00 00 00 00       	mov    $0x0,%esi
+  80055d:	bf 02 00 00 00       	mov    $0x2,%edi
+  800562:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800569:	ff ff ff 
+  80056c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800570:	ff d0                	call   *%rax
+  800572:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800576:	c9                   	leave
+  800577:	c3                   	ret
+
+0000000000800578 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800578:	55                   	push   %rbp
+  800579:	48 89 e5             	mov    %rsp,%rbp
+  80057c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80057c <sys_yield+0x4>
+  800583:	49 bb bc 7a 00 00 00 	movabs $0x7abc,%r11
+  80058a:	00 00 00 
+  80058d:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  800590:	48 83 ec 08          	sub    $0x8,%rsp
+  800594:	6a 00                	push   $0x0
+  800596:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80059c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8005b1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8005b6:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  8005bd:	ff ff ff 
+  8005c0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8005c4:	ff d0                	call   *%rax
+  8005c6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005ca:	90                   	nop
+  8005cb:	c9                   	leave
+  8005cc:	c3                   	ret
+
+00000000008005cd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8005cd:	55                   	push   %rbp
+  8005ce:	48 89 e5             	mov    %rsp,%rbp
+  8005d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8005d5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005d5 <sys_page_alloc+0x8>
+  8005dc:	49 bb 63 7a 00 00 00 	movabs $0x7a63,%r11
+  8005e3:	00 00 00 
+  8005e6:	4c 01 d8             	add    %r11,%rax
+  8005e9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005ec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005f0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8005f3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8005f6:	48 63 f2             	movslq %edx,%rsi
+  8005f9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8005fd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800600:	48 63 d2             	movslq %edx,%rdx
+  800603:	48 83 ec 08          	sub    $0x8,%rsp
+  800607:	6a 00                	push   $0x0
+  800609:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80060f:	49 89 f0             	mov    %rsi,%r8
+  800612:	be 01 00 00 00       	mov    $0x1,%esi
+  800617:	bf 04 00 00 00       	mov    $0x4,%edi
+  80061c:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800623:	ff ff ff 
+  800626:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80062a:	ff d0                	call   *%rax
+  80062c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800630:	c9                   	leave
+  800631:	c3                   	ret
+
+0000000000800632 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800632:	55                   	push   %rbp
+  800633:	48 89 e5             	mov    %rsp,%rbp
+  800636:	48 83 ec 20          	sub    $0x20,%rsp
+  80063a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80063a <sys_page_map+0x8>
+  800641:	49 bb fe 79 00 00 00 	movabs $0x79fe,%r11
+  800648:	00 00 00 
+  80064b:	4c 01 d8             	add    %r11,%rax
+  80064e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800651:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800655:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800658:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80065c:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  800660:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800663:	48 63 f2             	movslq %edx,%rsi
+  800666:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80066a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80066d:	48 63 fa             	movslq %edx,%rdi
+  800670:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800674:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800677:	48 63 d2             	movslq %edx,%rdx
+  80067a:	48 83 ec 08          	sub    $0x8,%rsp
+  80067e:	56                   	push   %rsi
+  80067f:	4d 89 c1             	mov    %r8,%r9
+  800682:	49 89 f8             	mov    %rdi,%r8
+  800685:	be 01 00 00 00       	mov    $0x1,%esi
+  80068a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80068f:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800696:	ff ff ff 
+  800699:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80069d:	ff d0                	call   *%rax
+  80069f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006a3:	c9                   	leave
+  8006a4:	c3                   	ret
+
+00000000008006a5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8006a5:	55                   	push   %rbp
+  8006a6:	48 89 e5             	mov    %rsp,%rbp
+  8006a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8006ad:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006ad <sys_page_unmap+0x8>
+  8006b4:	49 bb 8b 79 00 00 00 	movabs $0x798b,%r11
+  8006bb:	00 00 00 
+  8006be:	4c 01 d8             	add    %r11,%rax
+  8006c1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8006c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8006c8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8006cc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8006cf:	48 63 d2             	movslq %edx,%rdx
+  8006d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8006d6:	6a 00                	push   $0x0
+  8006d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8006e9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8006ee:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  8006f5:	ff ff ff 
+  8006f8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8006fc:	ff d0                	call   *%rax
+  8006fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800702:	c9                   	leave
+  800703:	c3                   	ret
+
+0000000000800704 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800704:	55                   	push   %rbp
+  800705:	48 89 e5             	mov    %rsp,%rbp
+  800708:	48 83 ec 10          	sub    $0x10,%rsp
+  80070c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80070c <sys_env_set_status+0x8>
+  800713:	49 bb 2c 79 00 00 00 	movabs $0x792c,%r11
+  80071a:	00 00 00 
+  80071d:	4c 01 d8             	add    %r11,%rax
+  800720:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800723:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800726:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800729:	48 63 ca             	movslq %edx,%rcx
+  80072c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80072f:	48 63 d2             	movslq %edx,%rdx
+  800732:	48 83 ec 08          	sub    $0x8,%rsp
+  800736:	6a 00                	push   $0x0
+  800738:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80073e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800744:	be 01 00 00 00       	mov    $0x1,%esi
+  800749:	bf 08 00 00 00       	mov    $0x8,%edi
+  80074e:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800755:	ff ff ff 
+  800758:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80075c:	ff d0                	call   *%rax
+  80075e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800762:	c9                   	leave
+  800763:	c3                   	ret
+
+0000000000800764 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800764:	55                   	push   %rbp
+  800765:	48 89 e5             	mov    %rsp,%rbp
+  800768:	48 83 ec 10          	sub    $0x10,%rsp
+  80076c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80076c <sys_env_set_trapframe+0x8>
+  800773:	49 bb cc 78 00 00 00 	movabs $0x78cc,%r11
+  80077a:	00 00 00 
+  80077d:	4c 01 d8             	add    %r11,%rax
+  800780:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800783:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  800787:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80078b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80078e:	48 63 d2             	movslq %edx,%rdx
+  800791:	48 83 ec 08          	sub    $0x8,%rsp
+  800795:	6a 00                	push   $0x0
+  800797:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80079d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8007a8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8007ad:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  8007b4:	ff ff ff 
+  8007b7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8007bb:	ff d0                	call   *%rax
+  8007bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007c1:	c9                   	leave
+  8007c2:	c3                   	ret
+
+00000000008007c3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8007c3:	55                   	push   %rbp
+  8007c4:	48 89 e5             	mov    %rsp,%rbp
+  8007c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8007cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007cb <sys_env_set_pgfault_upcall+0x8>
+  8007d2:	49 bb 6d 78 00 00 00 	movabs $0x786d,%r11
+  8007d9:	00 00 00 
+  8007dc:	4c 01 d8             	add    %r11,%rax
+  8007df:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8007e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8007e6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8007ea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8007ed:	48 63 d2             	movslq %edx,%rdx
+  8007f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8007f4:	6a 00                	push   $0x0
+  8007f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800802:	be 01 00 00 00       	mov    $0x1,%esi
+  800807:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80080c:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800813:	ff ff ff 
+  800816:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80081a:	ff d0                	call   *%rax
+  80081c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800820:	c9                   	leave
+  800821:	c3                   	ret
+
+0000000000800822 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  800822:	55                   	push   %rbp
+  800823:	48 89 e5             	mov    %rsp,%rbp
+  800826:	48 83 ec 20          	sub    $0x20,%rsp
+  80082a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80082a <sys_ipc_try_send+0x8>
+  800831:	49 bb 0e 78 00 00 00 	movabs $0x780e,%r11
+  800838:	00 00 00 
+  80083b:	4c 01 d8             	add    %r11,%rax
+  80083e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800841:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800845:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800849:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80084c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80084f:	48 63 fa             	movslq %edx,%rdi
+  800852:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800856:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800859:	48 63 d2             	movslq %edx,%rdx
+  80085c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800860:	48 83 ec 08          	sub    $0x8,%rsp
+  800864:	6a 00                	push   $0x0
+  800866:	49 89 f9             	mov    %rdi,%r9
+  800869:	49 89 f0             	mov    %rsi,%r8
+  80086c:	be 00 00 00 00       	mov    $0x0,%esi
+  800871:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800876:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  80087d:	ff ff ff 
+  800880:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800884:	ff d0                	call   *%rax
+  800886:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80088a:	c9                   	leave
+  80088b:	c3                   	ret
+
+000000000080088c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80088c:	55                   	push   %rbp
+  80088d:	48 89 e5             	mov    %rsp,%rbp
+  800890:	48 83 ec 20          	sub    $0x20,%rsp
+  800894:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800894 <sys_ipc_send+0x8>
+  80089b:	49 bb a4 77 00 00 00 	movabs $0x77a4,%r11
+  8008a2:	00 00 00 
+  8008a5:	4c 01 d8             	add    %r11,%rax
+  8008a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8008ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008af:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8008b3:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8008b6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8008b9:	48 63 fa             	movslq %edx,%rdi
+  8008bc:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8008c0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8008c3:	48 63 d2             	movslq %edx,%rdx
+  8008c6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8008ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ce:	6a 00                	push   $0x0
+  8008d0:	49 89 f9             	mov    %rdi,%r9
+  8008d3:	49 89 f0             	mov    %rsi,%r8
+  8008d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8008db:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008e0:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  8008e7:	ff ff ff 
+  8008ea:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8008ee:	ff d0                	call   *%rax
+  8008f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008f4:	c9                   	leave
+  8008f5:	c3                   	ret
+
+00000000008008f6 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8008f6:	55                   	push   %rbp
+  8008f7:	48 89 e5             	mov    %rsp,%rbp
+  8008fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8008fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008fe <sys_ipc_recv+0x8>
+  800905:	49 bb 3a 77 00 00 00 	movabs $0x773a,%r11
+  80090c:	00 00 00 
+  80090f:	4c 01 d8             	add    %r11,%rax
+  800912:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  800916:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80091a:	6a 00                	push   $0x0
+  80091c:	6a 00                	push   $0x0
+  80091e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800924:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80092a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092f:	be 01 00 00 00       	mov    $0x1,%esi
+  800934:	bf 0d 00 00 00       	mov    $0xd,%edi
+  800939:	49 ba 2e 82 ff ff ff 	movabs $0xffffffffffff822e,%r10
+  800940:	ff ff ff 
+  800943:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800947:	ff d0                	call   *%rax
+  800949:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80094d:	c9                   	leave
+  80094e:	c3                   	ret
+
+000000000080094f <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  80094f:	55                   	push   %rbp
+  800950:	48 89 e5             	mov    %rsp,%rbp
+  800953:	48 83 ec 30          	sub    $0x30,%rsp
+  800957:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800957 <sys_ipc_call+0x8>
+  80095e:	49 bb e1 76 00 00 00 	movabs $0x76e1,%r11
+  800965:	00 00 00 
+  800968:	4c 01 d8             	add    %r11,%rax
+  80096b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80096e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800972:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800976:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  800979:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80097d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  800981:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800985:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800988:	4c 63 c2             	movslq %edx,%r8
+  80098b:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80098f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800992:	48 63 d2             	movslq %edx,%rdx
+  800995:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800999:	ff 75 d8             	push   -0x28(%rbp)
+  80099c:	56                   	push   %rsi
+  80099d:	4d 89 c1             	mov    %r8,%r9
+  8009a0:	49 89 f8             	mov    %rdi,%r8
+  8009a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8009a8:	bf 18 00 00 00       	mov    $0x18,%edi
+  8009ad:	49 ba 2e 82 ff ff ff 	movabs $0xffffffffffff822e,%r10
+  8009b4:	ff ff ff 
+  8009b7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8009bb:	ff d0                	call   *%rax
+  8009bd:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8009c1:	c9                   	leave
+  8009c2:	c3                   	ret
+
+00000000008009c3 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8009c3:	55                   	push   %rbp
+  8009c4:	48 89 e5             	mov    %rsp,%rbp
+  8009c7:	48 83 ec 30          	sub    $0x30,%rsp
+  8009cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8009cb <sys_ipc_reply_recv+0x8>
+  8009d2:	49 bb 6d 76 00 00 00 	movabs $0x766d,%r11
+  8009d9:	00 00 00 
+  8009dc:	4c 01 d8             	add    %r11,%rax
+  8009df:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8009e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009e6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8009ea:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8009ed:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8009f1:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8009f5:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8009f9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8009fc:	4c 63 c2             	movslq %edx,%r8
+  8009ff:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800a03:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800a06:	48 63 d2             	movslq %edx,%rdx
+  800a09:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800a0d:	ff 75 d8             	push   -0x28(%rbp)
+  800a10:	56                   	push   %rsi
+  800a11:	4d 89 c1             	mov    %r8,%r9
+  800a14:	49 89 f8             	mov    %rdi,%r8
+  800a17:	be 00 00 00 00       	mov    $0x0,%esi
+  800a1c:	bf 19 00 00 00       	mov    $0x19,%edi
+  800a21:	49 ba 2e 82 ff ff ff 	movabs $0xffffffffffff822e,%r10
+  800a28:	ff ff ff 
+  800a2b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800a2f:	ff d0                	call   *%rax
+  800a31:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  800a35:	c9                   	leave
+  800a36:	c3                   	ret
+
+0000000000800a37 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800a37:	55                   	push   %rbp
+  800a38:	48 89 e5             	mov    %rsp,%rbp
+  800a3b:	48 83 ec 10          	sub    $0x10,%rsp
+  800a3f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a3f <sys_env_set_priority+0x8>
+  800a46:	49 bb f9 75 00 00 00 	movabs $0x75f9,%r11
+  800a4d:	00 00 00 
+  800a50:	4c 01 d8             	add    %r11,%rax
+  800a53:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800a56:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  800a59:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800a5c:	48 63 ca             	movslq %edx,%rcx
+  800a5f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800a62:	48 63 d2             	movslq %edx,%rdx
+  800a65:	48 83 ec 08          	sub    $0x8,%rsp
+  800a69:	6a 00                	push   $0x0
+  800a6b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a71:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a77:	be 01 00 00 00       	mov    $0x1,%esi
+  800a7c:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800a81:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800a88:	ff ff ff 
+  800a8b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800a8f:	ff d0                	call   *%rax
+  800a91:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a95:	c9                   	leave
+  800a96:	c3                   	ret
+
+0000000000800a97 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800a97:	55                   	push   %rbp
+  800a98:	48 89 e5             	mov    %rsp,%rbp
+  800a9b:	48 83 ec 10          	sub    $0x10,%rsp
+  800a9f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a9f <sys_env_set_affinity+0x8>
+  800aa6:	49 bb 99 75 00 00 00 	movabs $0x7599,%r11
+  800aad:	00 00 00 
+  800ab0:	4c 01 d8             	add    %r11,%rax
+  800ab3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ab6:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  800ab9:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  800abc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800abf:	48 63 d2             	movslq %edx,%rdx
+  800ac2:	48 83 ec 08          	sub    $0x8,%rsp
+  800ac6:	6a 00                	push   $0x0
+  800ac8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ace:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ad4:	be 01 00 00 00       	mov    $0x1,%esi
+  800ad9:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ade:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800ae5:	ff ff ff 
+  800ae8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800aec:	ff d0                	call   *%rax
+  800aee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800af2:	c9                   	leave
+  800af3:	c3                   	ret
+
+0000000000800af4 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800af4:	55                   	push   %rbp
+  800af5:	48 89 e5             	mov    %rsp,%rbp
+  800af8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800af8 <sys_time_msec+0x4>
+  800aff:	49 bb 40 75 00 00 00 	movabs $0x7540,%r11
+  800b06:	00 00 00 
+  800b09:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  800b0c:	48 83 ec 08          	sub    $0x8,%rsp
+  800b10:	6a 00                	push   $0x0
+  800b12:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800b18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b23:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b28:	be 00 00 00 00       	mov    $0x0,%esi
+  800b2d:	bf 0e 00 00 00       	mov    $0xe,%edi
+  800b32:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800b39:	ff ff ff 
+  800b3c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800b40:	ff d0                	call   *%rax
+  800b42:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800b46:	c9                   	leave
+  800b47:	c3                   	ret
+
+0000000000800b48 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  800b48:	55                   	push   %rbp
+  800b49:	48 89 e5             	mov    %rsp,%rbp
+  800b4c:	48 83 ec 10          	sub    $0x10,%rsp
+  800b50:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b50 <sys_sleep_usec+0x8>
+  800b57:	49 bb e8 74 00 00 00 	movabs $0x74e8,%r11
+  800b5e:	00 00 00 
+  800b61:	4c 01 d8             	add    %r11,%rax
+  800b64:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  800b68:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b6c:	48 83 ec 08          	sub    $0x8,%rsp
+  800b70:	6a 00                	push   $0x0
+  800b72:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800b78:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b83:	be 00 00 00 00       	mov    $0x0,%esi
+  800b88:	bf 11 00 00 00       	mov    $0x11,%edi
+  800b8d:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800b94:	ff ff ff 
+  800b97:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800b9b:	ff d0                	call   *%rax
+  800b9d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800ba1:	c9                   	leave
+  800ba2:	c3                   	ret
+
+0000000000800ba3 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  800ba3:	55                   	push   %rbp
+  800ba4:	48 89 e5             	mov    %rsp,%rbp
+  800ba7:	48 83 ec 10          	sub    $0x10,%rsp
+  800bab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800bab <sys_page_alloc_huge+0x8>
+  800bb2:	49 bb 8d 74 00 00 00 	movabs $0x748d,%r11
+  800bb9:	00 00 00 
+  800bbc:	4c 01 d8             	add    %r11,%rax
+  800bbf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800bc2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800bc6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800bc9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800bcc:	48 63 f2             	movslq %edx,%rsi
+  800bcf:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800bd3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800bd6:	48 63 d2             	movslq %edx,%rdx
+  800bd9:	48 83 ec 08          	sub    $0x8,%rsp
+  800bdd:	6a 00                	push   $0x0
+  800bdf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800be5:	49 89 f0             	mov    %rsi,%r8
+  800be8:	be 01 00 00 00       	mov    $0x1,%esi
+  800bed:	bf 12 00 00 00       	mov    $0x12,%edi
+  800bf2:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800bf9:	ff ff ff 
+  800bfc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800c00:	ff d0                	call   *%rax
+  800c02:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800c06:	c9                   	leave
+  800c07:	c3                   	ret
+
+0000000000800c08 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  800c08:	55                   	push   %rbp
+  800c09:	48 89 e5             	mov    %rsp,%rbp
+  800c0c:	48 83 ec 10          	sub    $0x10,%rsp
+  800c10:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c10 <sys_page_map_batch+0x8>
+  800c17:	49 bb 28 74 00 00 00 	movabs $0x7428,%r11
+  800c1e:	00 00 00 
+  800c21:	4c 01 d8             	add    %r11,%rax
+  800c24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800c28:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  800c2c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c30:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800c34:	48 83 ec 08          	sub    $0x8,%rsp
+  800c38:	6a 00                	push   $0x0
+  800c3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800c40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800c46:	be 01 00 00 00       	mov    $0x1,%esi
+  800c4b:	bf 13 00 00 00       	mov    $0x13,%edi
+  800c50:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800c57:	ff ff ff 
+  800c5a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800c5e:	ff d0                	call   *%rax
+  800c60:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800c64:	c9                   	leave
+  800c65:	c3                   	ret
+
+0000000000800c66 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  800c66:	55                   	push   %rbp
+  800c67:	48 89 e5             	mov    %rsp,%rbp
+  800c6a:	48 83 ec 10          	sub    $0x10,%rsp
+  800c6e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c6e <sys_page_alloc_batch+0x8>
+  800c75:	49 bb ca 73 00 00 00 	movabs $0x73ca,%r11
+  800c7c:	00 00 00 
+  800c7f:	4c 01 d8             	add    %r11,%rax
+  800c82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800c86:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  800c8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c8e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800c92:	48 83 ec 08          	sub    $0x8,%rsp
+  800c96:	6a 00                	push   $0x0
+  800c98:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800c9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ca4:	be 01 00 00 00       	mov    $0x1,%esi
+  800ca9:	bf 14 00 00 00       	mov    $0x14,%edi
+  800cae:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800cb5:	ff ff ff 
+  800cb8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800cbc:	ff d0                	call   *%rax
+  800cbe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800cc2:	c9                   	leave
+  800cc3:	c3                   	ret
+
+0000000000800cc4 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  800cc4:	55                   	push   %rbp
+  800cc5:	48 89 e5             	mov    %rsp,%rbp
+  800cc8:	48 83 ec 10          	sub    $0x10,%rsp
+  800ccc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ccc <sys_page_unmap_batch+0x8>
+  800cd3:	49 bb 6c 73 00 00 00 	movabs $0x736c,%r11
+  800cda:	00 00 00 
+  800cdd:	4c 01 d8             	add    %r11,%rax
+  800ce0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800ce4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  800ce8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800cec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800cf0:	48 83 ec 08          	sub    $0x8,%rsp
+  800cf4:	6a 00                	push   $0x0
+  800cf6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800cfc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800d02:	be 01 00 00 00       	mov    $0x1,%esi
+  800d07:	bf 15 00 00 00       	mov    $0x15,%edi
+  800d0c:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800d13:	ff ff ff 
+  800d16:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800d1a:	ff d0                	call   *%rax
+  800d1c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800d20:	c9                   	leave
+  800d21:	c3                   	ret
+
+0000000000800d22 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  800d22:	55                   	push   %rbp
+  800d23:	48 89 e5             	mov    %rsp,%rbp
+  800d26:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800d26 <sys_fork+0x4>
+  800d2d:	49 bb 12 73 00 00 00 	movabs $0x7312,%r11
+  800d34:	00 00 00 
+  800d37:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  800d3a:	48 83 ec 08          	sub    $0x8,%rsp
+  800d3e:	6a 00                	push   $0x0
+  800d40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d46:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800d4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d56:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5b:	bf 16 00 00 00       	mov    $0x16,%edi
+  800d60:	49 ba 74 81 ff ff ff 	movabs $0xffffffffffff8174,%r10
+  800d67:	ff ff ff 
+  800d6a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800d6e:	ff d0                	call   *%rax
+  800d70:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800d74:	c9                   	leave
+  800d75:	c3                   	ret
+
+0000000000800d76 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  800d76:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  800d79:	48 a1 00 d0 81 00 00 	movabs 0x81d000,%rax
+  800d80:	00 00 00 
+call *%rax
+  800d83:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  800d85:	58                   	pop    %rax
+	popq %rax;
+  800d86:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  800d87:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  800d8e:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  800d92:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  800d96:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  800d9a:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  800d9e:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  800da2:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  800da5:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  800da9:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800dad:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  800db2:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  800db7:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  800dbc:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  800dc1:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  800dc6:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  800dcb:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  800dd0:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  800dd5:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  800dda:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  800ddf:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  800de4:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  800de9:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  800dee:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  800df3:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  800df7:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  800dfb:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  800dfc:	5c                   	pop    %rsp
+	ret;			//return
+  800dfd:	c3                   	ret
+
+0000000000800dfe <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  800dfe:	55                   	push   %rbp
+  800dff:	48 89 e5             	mov    %rsp,%rbp
+  800e02:	48 83 ec 08          	sub    $0x8,%rsp
+  800e06:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800e06 <fd2num+0x8>
+  800e0d:	49 bb 32 72 00 00 00 	movabs $0x7232,%r11
+  800e14:	00 00 00 
+  800e17:	4c 01 d8             	add    %r11,%rax
+  800e1a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800e1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e22:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800e29:	ff ff ff 
+  800e2c:	48 01 d0             	add    %rdx,%rax
+  800e2f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800e33:	c9                   	leave
+  800e34:	c3                   	ret
+
+0000000000800e35 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800e35:	55                   	push   %rbp
+  800e36:	48 89 e5             	mov    %rsp,%rbp
+  800e39:	48 83 ec 08          	sub    $0x8,%rsp
+  800e3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800e3d <fd2data+0x8>
+  800e44:	49 bb fb 71 00 00 00 	movabs $0x71fb,%r11
+  800e4b:	00 00 00 
+  800e4e:	4c 01 d8             	add    %r11,%rax
+  800e51:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  800e55:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800e59:	48 89 d7             	mov    %rdx,%rdi
+  800e5c:	48 ba c6 8d ff ff ff 	movabs $0xffffffffffff8dc6,%rdx
+  800e63:	ff ff ff 
+  800e66:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  800e6a:	ff d0                	call   *%rax
+  800e6c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800e72:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800e76:	c9                   	leave
+  800e77:	c3                   	ret
+
+0000000000800e78 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800e78:	55                   	push   %rbp
+  800e79:	48 89 e5             	mov    %rsp,%rbp
+  800e7c:	48 83 ec 18          	sub    $0x18,%rsp
+  800e80:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800e80 <fd_alloc+0x8>
+  800e87:	49 bb b8 71 00 00 00 	movabs $0x71b8,%r11
+  800e8e:	00 00 00 
+  800e91:	4c 01 d8             	add    %r11,%rax
+  800e94:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800e98:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e9f:	eb 75                	jmp    800f16 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  800ea1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800ea4:	48 63 d2             	movslq %edx,%rdx
+  800ea7:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  800eae:	48 c1 e2 0c          	shl    $0xc,%rdx
+  800eb2:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800eb6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800eba:	48 89 d1             	mov    %rdx,%rcx
+  800ebd:	48 c1 e9 15          	shr    $0x15,%rcx
+  800ec1:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800ec8:	ff ff ff 
+  800ecb:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800ecf:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800ed3:	83 e2 01             	and    $0x1,%edx
+  800ed6:	48 85 d2             	test   %rdx,%rdx
+  800ed9:	74 25                	je     800f00 <fd_alloc+0x88>
+  800edb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800edf:	48 89 d1             	mov    %rdx,%rcx
+  800ee2:	48 c1 e9 0c          	shr    $0xc,%rcx
+  800ee6:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  800eed:	ff ff ff 
+  800ef0:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800ef4:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800ef8:	83 e2 01             	and    $0x1,%edx
+  800efb:	48 85 d2             	test   %rdx,%rdx
+  800efe:	75 12                	jne    800f12 <fd_alloc+0x9a>
+			*fd_store = fd;
+  800f00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f04:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f08:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  800f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f10:	eb 1a                	jmp    800f2c <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  800f12:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800f16:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800f1a:	7e 85                	jle    800ea1 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  800f1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f20:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  800f27:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  800f2c:	c9                   	leave
+  800f2d:	c3                   	ret
+
+0000000000800f2e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800f2e:	55                   	push   %rbp
+  800f2f:	48 89 e5             	mov    %rsp,%rbp
+  800f32:	48 83 ec 20          	sub    $0x20,%rsp
+  800f36:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800f36 <fd_lookup+0x8>
+  800f3d:	49 bb 02 71 00 00 00 	movabs $0x7102,%r11
+  800f44:	00 00 00 
+  800f47:	4c 01 d8             	add    %r11,%rax
+  800f4a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800f4d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800f51:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800f55:	78 06                	js     800f5d <fd_lookup+0x2f>
+  800f57:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800f5b:	7e 07                	jle    800f64 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  800f5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f62:	eb 73                	jmp    800fd7 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  800f64:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800f67:	48 63 d2             	movslq %edx,%rdx
+  800f6a:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  800f71:	48 c1 e2 0c          	shl    $0xc,%rdx
+  800f75:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800f79:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f7d:	48 89 d1             	mov    %rdx,%rcx
+  800f80:	48 c1 e9 15          	shr    $0x15,%rcx
+  800f84:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800f8b:	ff ff ff 
+  800f8e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800f92:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800f96:	83 e2 01             	and    $0x1,%edx
+  800f99:	48 85 d2             	test   %rdx,%rdx
+  800f9c:	74 22                	je     800fc0 <fd_lookup+0x92>
+  800f9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800fa2:	48 c1 ea 0c          	shr    $0xc,%rdx
+  800fa6:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  800fad:	ff ff ff 
+  800fb0:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  800fb4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800fb8:	83 e0 01             	and    $0x1,%eax
+  800fbb:	48 85 c0             	test   %rax,%rax
+  800fbe:	75 07                	jne    800fc7 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  800fc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fc5:	eb 10                	jmp    800fd7 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  800fc7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fcb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800fcf:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  800fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd7:	c9                   	leave
+  800fd8:	c3                   	ret
+
+0000000000800fd9 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  800fd9:	55                   	push   %rbp
+  800fda:	48 89 e5             	mov    %rsp,%rbp
+  800fdd:	41 57                	push   %r15
+  800fdf:	53                   	push   %rbx
+  800fe0:	48 83 ec 30          	sub    $0x30,%rsp
+  800fe4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800fe4 <fd_close+0xb>
+  800feb:	49 bb 54 70 00 00 00 	movabs $0x7054,%r11
+  800ff2:	00 00 00 
+  800ff5:	4c 01 db             	add    %r11,%rbx
+  800ff8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800ffc:	89 f0                	mov    %esi,%eax
+  800ffe:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801001:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801005:	48 89 c7             	mov    %rax,%rdi
+  801008:	48 b8 c6 8d ff ff ff 	movabs $0xffffffffffff8dc6,%rax
+  80100f:	ff ff ff 
+  801012:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801016:	ff d0                	call   *%rax
+  801018:	89 c2                	mov    %eax,%edx
+  80101a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80101e:	48 89 c6             	mov    %rax,%rsi
+  801021:	89 d7                	mov    %edx,%edi
+  801023:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  80102a:	ff ff ff 
+  80102d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801031:	ff d0                	call   *%rax
+  801033:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801036:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80103a:	78 0a                	js     801046 <fd_close+0x6d>
+	    || fd != fd2)
+  80103c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801040:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  801044:	74 12                	je     801058 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  801046:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80104a:	74 05                	je     801051 <fd_close+0x78>
+  80104c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80104f:	eb 7a                	jmp    8010cb <fd_close+0xf2>
+  801051:	b8 00 00 00 00       	mov    $0x0,%eax
+  801056:	eb 73                	jmp    8010cb <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801058:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80105c:	8b 00                	mov    (%rax),%eax
+  80105e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801062:	48 89 d6             	mov    %rdx,%rsi
+  801065:	89 c7                	mov    %eax,%edi
+  801067:	48 b8 9c 90 ff ff ff 	movabs $0xffffffffffff909c,%rax
+  80106e:	ff ff ff 
+  801071:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801075:	ff d0                	call   *%rax
+  801077:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80107a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80107e:	78 2a                	js     8010aa <fd_close+0xd1>
+		if (dev->dev_close)
+  801080:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801084:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801088:	48 85 c0             	test   %rax,%rax
+  80108b:	74 16                	je     8010a3 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  80108d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801091:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  801095:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801099:	48 89 c7             	mov    %rax,%rdi
+  80109c:	ff d2                	call   *%rdx
+  80109e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8010a1:	eb 07                	jmp    8010aa <fd_close+0xd1>
+		else
+			r = 0;
+  8010a3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8010aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010ae:	48 89 c6             	mov    %rax,%rsi
+  8010b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b6:	49 89 df             	mov    %rbx,%r15
+  8010b9:	48 b8 6d 86 ff ff ff 	movabs $0xffffffffffff866d,%rax
+  8010c0:	ff ff ff 
+  8010c3:	48 01 d8             	add    %rbx,%rax
+  8010c6:	ff d0                	call   *%rax
+	return r;
+  8010c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8010cb:	48 83 c4 30          	add    $0x30,%rsp
+  8010cf:	5b                   	pop    %rbx
+  8010d0:	41 5f                	pop    %r15
+  8010d2:	5d                   	pop    %rbp
+  8010d3:	c3                   	ret
+
+00000000008010d4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8010d4:	55                   	push   %rbp
+  8010d5:	48 89 e5             	mov    %rsp,%rbp
+  8010d8:	41 57                	push   %r15
+  8010da:	48 83 ec 28          	sub    $0x28,%rsp
+  8010de:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8010de <dev_lookup+0xa>
+  8010e5:	49 bb 5a 6f 00 00 00 	movabs $0x6f5a,%r11
+  8010ec:	00 00 00 
+  8010ef:	4c 01 d9             	add    %r11,%rcx
+  8010f2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8010f5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8010f9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801100:	eb 45                	jmp    801147 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  801102:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  801109:	00 00 00 
+  80110c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80110f:	48 98                	cltq
+  801111:	48 01 ca             	add    %rcx,%rdx
+  801114:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801118:	8b 00                	mov    (%rax),%eax
+  80111a:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80111d:	75 24                	jne    801143 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  80111f:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  801126:	00 00 00 
+  801129:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80112c:	48 98                	cltq
+  80112e:	48 01 ca             	add    %rcx,%rdx
+  801131:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  801135:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801139:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80113c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801141:	eb 74                	jmp    8011b7 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  801143:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  801147:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  80114e:	00 00 00 
+  801151:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801154:	48 98                	cltq
+  801156:	48 01 ca             	add    %rcx,%rdx
+  801159:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80115d:	48 85 c0             	test   %rax,%rax
+  801160:	75 a0                	jne    801102 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801162:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801169:	ff ff ff 
+  80116c:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  801170:	48 8b 00             	mov    (%rax),%rax
+  801173:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801179:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80117c:	89 c6                	mov    %eax,%esi
+  80117e:	48 b8 b8 df ff ff ff 	movabs $0xffffffffffffdfb8,%rax
+  801185:	ff ff ff 
+  801188:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80118c:	48 89 c7             	mov    %rax,%rdi
+  80118f:	49 89 cf             	mov    %rcx,%r15
+  801192:	b8 00 00 00 00       	mov    $0x0,%eax
+  801197:	49 b8 a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%r8
+  80119e:	ff ff ff 
+  8011a1:	49 01 c8             	add    %rcx,%r8
+  8011a4:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8011a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011ab:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8011b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8011b7:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8011bb:	c9                   	leave
+  8011bc:	c3                   	ret
+
+00000000008011bd <close>:
+
+int
+close(int fdnum)
+{
+  8011bd:	55                   	push   %rbp
+  8011be:	48 89 e5             	mov    %rsp,%rbp
+  8011c1:	53                   	push   %rbx
+  8011c2:	48 83 ec 28          	sub    $0x28,%rsp
+  8011c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8011c6 <close+0x9>
+  8011cd:	49 bb 72 6e 00 00 00 	movabs $0x6e72,%r11
+  8011d4:	00 00 00 
+  8011d7:	4c 01 db             	add    %r11,%rbx
+  8011da:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011dd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8011e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8011e4:	48 89 d6             	mov    %rdx,%rsi
+  8011e7:	89 c7                	mov    %eax,%edi
+  8011e9:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  8011f0:	ff ff ff 
+  8011f3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8011f7:	ff d0                	call   *%rax
+  8011f9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8011fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801200:	79 05                	jns    801207 <close+0x4a>
+		return r;
+  801202:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801205:	eb 1c                	jmp    801223 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  801207:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80120b:	be 01 00 00 00       	mov    $0x1,%esi
+  801210:	48 89 c7             	mov    %rax,%rdi
+  801213:	48 b8 a1 8f ff ff ff 	movabs $0xffffffffffff8fa1,%rax
+  80121a:	ff ff ff 
+  80121d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801221:	ff d0                	call   *%rax
+}
+  801223:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801227:	c9                   	leave
+  801228:	c3                   	ret
+
+0000000000801229 <close_all>:
+
+void
+close_all(void)
+{
+  801229:	55                   	push   %rbp
+  80122a:	48 89 e5             	mov    %rsp,%rbp
+  80122d:	53                   	push   %rbx
+  80122e:	48 83 ec 18          	sub    $0x18,%rsp
+  801232:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801232 <close_all+0x9>
+  801239:	49 bb 06 6e 00 00 00 	movabs $0x6e06,%r11
+  801240:	00 00 00 
+  801243:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801246:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80124d:	eb 19                	jmp    801268 <close_all+0x3f>
+		close(i);
+  80124f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801252:	89 c7                	mov    %eax,%edi
+  801254:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  80125b:	ff ff ff 
+  80125e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801262:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  801264:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  801268:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80126c:	7e e1                	jle    80124f <close_all+0x26>
+}
+  80126e:	90                   	nop
+  80126f:	90                   	nop
+  801270:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801274:	c9                   	leave
+  801275:	c3                   	ret
+
+0000000000801276 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801276:	55                   	push   %rbp
+  801277:	48 89 e5             	mov    %rsp,%rbp
+  80127a:	41 57                	push   %r15
+  80127c:	53                   	push   %rbx
+  80127d:	48 83 ec 40          	sub    $0x40,%rsp
+  801281:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801281 <dup+0xb>
+  801288:	49 bb b7 6d 00 00 00 	movabs $0x6db7,%r11
+  80128f:	00 00 00 
+  801292:	4c 01 db             	add    %r11,%rbx
+  801295:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801298:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80129b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80129f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8012a2:	48 89 d6             	mov    %rdx,%rsi
+  8012a5:	89 c7                	mov    %eax,%edi
+  8012a7:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  8012ae:	ff ff ff 
+  8012b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8012b5:	ff d0                	call   *%rax
+  8012b7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8012ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8012be:	79 08                	jns    8012c8 <dup+0x52>
+		return r;
+  8012c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8012c3:	e9 a4 01 00 00       	jmp    80146c <dup+0x1f6>
+	close(newfdnum);
+  8012c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012cb:	89 c7                	mov    %eax,%edi
+  8012cd:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  8012d4:	ff ff ff 
+  8012d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8012db:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8012dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012e0:	48 98                	cltq
+  8012e2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8012e8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8012ec:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  8012f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8012f4:	48 89 c7             	mov    %rax,%rdi
+  8012f7:	48 b8 fd 8d ff ff ff 	movabs $0xffffffffffff8dfd,%rax
+  8012fe:	ff ff ff 
+  801301:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801305:	ff d0                	call   *%rax
+  801307:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  80130b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80130f:	48 89 c7             	mov    %rax,%rdi
+  801312:	48 b8 fd 8d ff ff ff 	movabs $0xffffffffffff8dfd,%rax
+  801319:	ff ff ff 
+  80131c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801320:	ff d0                	call   *%rax
+  801322:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801326:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80132a:	48 c1 e8 15          	shr    $0x15,%rax
+  80132e:	48 89 c2             	mov    %rax,%rdx
+  801331:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  801338:	ff ff ff 
+  80133b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80133f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801343:	83 e0 01             	and    $0x1,%eax
+  801346:	48 85 c0             	test   %rax,%rax
+  801349:	74 7f                	je     8013ca <dup+0x154>
+  80134b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80134f:	48 c1 e8 0c          	shr    $0xc,%rax
+  801353:	48 89 c2             	mov    %rax,%rdx
+  801356:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80135d:	ff ff ff 
+  801360:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801364:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801368:	83 e0 01             	and    $0x1,%eax
+  80136b:	48 85 c0             	test   %rax,%rax
+  80136e:	74 5a                	je     8013ca <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801370:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801374:	48 c1 e8 0c          	shr    $0xc,%rax
+  801378:	48 89 c2             	mov    %rax,%rdx
+  80137b:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  801382:	ff ff ff 
+  801385:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801389:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80138d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801392:	89 c1                	mov    %eax,%ecx
+  801394:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801398:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80139c:	41 89 c8             	mov    %ecx,%r8d
+  80139f:	48 89 d1             	mov    %rdx,%rcx
+  8013a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a7:	48 89 c6             	mov    %rax,%rsi
+  8013aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013af:	49 89 df             	mov    %rbx,%r15
+  8013b2:	48 b8 fa 85 ff ff ff 	movabs $0xffffffffffff85fa,%rax
+  8013b9:	ff ff ff 
+  8013bc:	48 01 d8             	add    %rbx,%rax
+  8013bf:	ff d0                	call   *%rax
+  8013c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8013c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8013c8:	78 5f                	js     801429 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013ce:	48 c1 e8 0c          	shr    $0xc,%rax
+  8013d2:	48 89 c2             	mov    %rax,%rdx
+  8013d5:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8013dc:	ff ff ff 
+  8013df:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8013e3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8013e7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013ec:	89 c1                	mov    %eax,%ecx
+  8013ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8013f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013f6:	41 89 c8             	mov    %ecx,%r8d
+  8013f9:	48 89 d1             	mov    %rdx,%rcx
+  8013fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801401:	48 89 c6             	mov    %rax,%rsi
+  801404:	bf 00 00 00 00       	mov    $0x0,%edi
+  801409:	49 89 df             	mov    %rbx,%r15
+  80140c:	48 b8 fa 85 ff ff ff 	movabs $0xffffffffffff85fa,%rax
+  801413:	ff ff ff 
+  801416:	48 01 d8             	add    %rbx,%rax
+  801419:	ff d0                	call   *%rax
+  80141b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80141e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801422:	78 08                	js     80142c <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  801424:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801427:	eb 43                	jmp    80146c <dup+0x1f6>
+			goto err;
+  801429:	90                   	nop
+  80142a:	eb 01                	jmp    80142d <dup+0x1b7>
+		goto err;
+  80142c:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80142d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801431:	48 89 c6             	mov    %rax,%rsi
+  801434:	bf 00 00 00 00       	mov    $0x0,%edi
+  801439:	49 89 df             	mov    %rbx,%r15
+  80143c:	48 b8 6d 86 ff ff ff 	movabs $0xffffffffffff866d,%rax
+  801443:	ff ff ff 
+  801446:	48 01 d8             	add    %rbx,%rax
+  801449:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  80144b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80144f:	48 89 c6             	mov    %rax,%rsi
+  801452:	bf 00 00 00 00       	mov    $0x0,%edi
+  801457:	49 89 df             	mov    %rbx,%r15
+  80145a:	48 b8 6d 86 ff ff ff 	movabs $0xffffffffffff866d,%rax
+  801461:	ff ff ff 
+  801464:	48 01 d8             	add    %rbx,%rax
+  801467:	ff d0                	call   *%rax
+	return r;
+  801469:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80146c:	48 83 c4 40          	add    $0x40,%rsp
+  801470:	5b                   	pop    %rbx
+  801471:	41 5f                	pop    %r15
+  801473:	5d                   	pop    %rbp
+  801474:	c3                   	ret
+
+0000000000801475 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801475:	55                   	push   %rbp
+  801476:	48 89 e5             	mov    %rsp,%rbp
+  801479:	41 57                	push   %r15
+  80147b:	53                   	push   %rbx
+  80147c:	48 83 ec 40          	sub    $0x40,%rsp
+  801480:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801480 <read+0xb>
+  801487:	49 bb b8 6b 00 00 00 	movabs $0x6bb8,%r11
+  80148e:	00 00 00 
+  801491:	4c 01 db             	add    %r11,%rbx
+  801494:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801497:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80149b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80149f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014a3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8014a6:	48 89 d6             	mov    %rdx,%rsi
+  8014a9:	89 c7                	mov    %eax,%edi
+  8014ab:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  8014b2:	ff ff ff 
+  8014b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014b9:	ff d0                	call   *%rax
+  8014bb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8014be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8014c2:	78 28                	js     8014ec <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014c8:	8b 00                	mov    (%rax),%eax
+  8014ca:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8014ce:	48 89 d6             	mov    %rdx,%rsi
+  8014d1:	89 c7                	mov    %eax,%edi
+  8014d3:	48 b8 9c 90 ff ff ff 	movabs $0xffffffffffff909c,%rax
+  8014da:	ff ff ff 
+  8014dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014e1:	ff d0                	call   *%rax
+  8014e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8014e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8014ea:	79 08                	jns    8014f4 <read+0x7f>
+		return r;
+  8014ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8014ef:	e9 8b 00 00 00       	jmp    80157f <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014f8:	8b 40 08             	mov    0x8(%rax),%eax
+  8014fb:	83 e0 03             	and    $0x3,%eax
+  8014fe:	83 f8 01             	cmp    $0x1,%eax
+  801501:	75 4b                	jne    80154e <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801503:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80150a:	ff ff ff 
+  80150d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801511:	48 8b 00             	mov    (%rax),%rax
+  801514:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80151a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80151d:	89 c6                	mov    %eax,%esi
+  80151f:	48 b8 d7 df ff ff ff 	movabs $0xffffffffffffdfd7,%rax
+  801526:	ff ff ff 
+  801529:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80152d:	48 89 c7             	mov    %rax,%rdi
+  801530:	49 89 df             	mov    %rbx,%r15
+  801533:	b8 00 00 00 00       	mov    $0x0,%eax
+  801538:	48 b9 a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%rcx
+  80153f:	ff ff ff 
+  801542:	48 01 d9             	add    %rbx,%rcx
+  801545:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  801547:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80154c:	eb 31                	jmp    80157f <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80154e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801552:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801556:	48 85 c0             	test   %rax,%rax
+  801559:	75 07                	jne    801562 <read+0xed>
+		return -E_NOT_SUPP;
+  80155b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  801560:	eb 1d                	jmp    80157f <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  801562:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801566:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80156a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80156e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801572:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801576:	48 89 ce             	mov    %rcx,%rsi
+  801579:	48 89 c7             	mov    %rax,%rdi
+  80157c:	41 ff d0             	call   *%r8
+}
+  80157f:	48 83 c4 40          	add    $0x40,%rsp
+  801583:	5b                   	pop    %rbx
+  801584:	41 5f                	pop    %r15
+  801586:	5d                   	pop    %rbp
+  801587:	c3                   	ret
+
+0000000000801588 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801588:	55                   	push   %rbp
+  801589:	48 89 e5             	mov    %rsp,%rbp
+  80158c:	53                   	push   %rbx
+  80158d:	48 83 ec 38          	sub    $0x38,%rsp
+  801591:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801591 <readn+0x9>
+  801598:	49 bb a7 6a 00 00 00 	movabs $0x6aa7,%r11
+  80159f:	00 00 00 
+  8015a2:	4c 01 db             	add    %r11,%rbx
+  8015a5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8015a8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8015ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015b0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8015b7:	eb 4b                	jmp    801604 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8015bc:	48 98                	cltq
+  8015be:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8015c2:	48 29 c2             	sub    %rax,%rdx
+  8015c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8015c8:	48 63 c8             	movslq %eax,%rcx
+  8015cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8015cf:	48 01 c1             	add    %rax,%rcx
+  8015d2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8015d5:	48 89 ce             	mov    %rcx,%rsi
+  8015d8:	89 c7                	mov    %eax,%edi
+  8015da:	48 b8 3d 94 ff ff ff 	movabs $0xffffffffffff943d,%rax
+  8015e1:	ff ff ff 
+  8015e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015e8:	ff d0                	call   *%rax
+  8015ea:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  8015ed:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8015f1:	79 05                	jns    8015f8 <readn+0x70>
+			return m;
+  8015f3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8015f6:	eb 1d                	jmp    801615 <readn+0x8d>
+		if (m == 0)
+  8015f8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8015fc:	74 13                	je     801611 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  8015fe:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801601:	01 45 ec             	add    %eax,-0x14(%rbp)
+  801604:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801607:	48 98                	cltq
+  801609:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80160d:	72 aa                	jb     8015b9 <readn+0x31>
+  80160f:	eb 01                	jmp    801612 <readn+0x8a>
+			break;
+  801611:	90                   	nop
+	}
+	return tot;
+  801612:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  801615:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801619:	c9                   	leave
+  80161a:	c3                   	ret
+
+000000000080161b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80161b:	55                   	push   %rbp
+  80161c:	48 89 e5             	mov    %rsp,%rbp
+  80161f:	41 57                	push   %r15
+  801621:	53                   	push   %rbx
+  801622:	48 83 ec 40          	sub    $0x40,%rsp
+  801626:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801626 <write+0xb>
+  80162d:	49 bb 12 6a 00 00 00 	movabs $0x6a12,%r11
+  801634:	00 00 00 
+  801637:	4c 01 db             	add    %r11,%rbx
+  80163a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80163d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801641:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801645:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801649:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80164c:	48 89 d6             	mov    %rdx,%rsi
+  80164f:	89 c7                	mov    %eax,%edi
+  801651:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  801658:	ff ff ff 
+  80165b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80165f:	ff d0                	call   *%rax
+  801661:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801664:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801668:	78 28                	js     801692 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80166a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80166e:	8b 00                	mov    (%rax),%eax
+  801670:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801674:	48 89 d6             	mov    %rdx,%rsi
+  801677:	89 c7                	mov    %eax,%edi
+  801679:	48 b8 9c 90 ff ff ff 	movabs $0xffffffffffff909c,%rax
+  801680:	ff ff ff 
+  801683:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801687:	ff d0                	call   *%rax
+  801689:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80168c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801690:	79 08                	jns    80169a <write+0x7f>
+		return r;
+  801692:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801695:	e9 8a 00 00 00       	jmp    801724 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80169a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80169e:	8b 40 08             	mov    0x8(%rax),%eax
+  8016a1:	83 e0 03             	and    $0x3,%eax
+  8016a4:	85 c0                	test   %eax,%eax
+  8016a6:	75 4b                	jne    8016f3 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016a8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8016af:	ff ff ff 
+  8016b2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8016b6:	48 8b 00             	mov    (%rax),%rax
+  8016b9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8016bf:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8016c2:	89 c6                	mov    %eax,%esi
+  8016c4:	48 b8 f3 df ff ff ff 	movabs $0xffffffffffffdff3,%rax
+  8016cb:	ff ff ff 
+  8016ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016d2:	48 89 c7             	mov    %rax,%rdi
+  8016d5:	49 89 df             	mov    %rbx,%r15
+  8016d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dd:	48 b9 a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%rcx
+  8016e4:	ff ff ff 
+  8016e7:	48 01 d9             	add    %rbx,%rcx
+  8016ea:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8016ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f1:	eb 31                	jmp    801724 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8016f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016f7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8016fb:	48 85 c0             	test   %rax,%rax
+  8016fe:	75 07                	jne    801707 <write+0xec>
+		return -E_NOT_SUPP;
+  801700:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  801705:	eb 1d                	jmp    801724 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  801707:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80170b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80170f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801713:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801717:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80171b:	48 89 ce             	mov    %rcx,%rsi
+  80171e:	48 89 c7             	mov    %rax,%rdi
+  801721:	41 ff d0             	call   *%r8
+}
+  801724:	48 83 c4 40          	add    $0x40,%rsp
+  801728:	5b                   	pop    %rbx
+  801729:	41 5f                	pop    %r15
+  80172b:	5d                   	pop    %rbp
+  80172c:	c3                   	ret
+
+000000000080172d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80172d:	55                   	push   %rbp
+  80172e:	48 89 e5             	mov    %rsp,%rbp
+  801731:	48 83 ec 18          	sub    $0x18,%rsp
+  801735:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801735 <seek+0x8>
+  80173c:	49 bb 03 69 00 00 00 	movabs $0x6903,%r11
+  801743:	00 00 00 
+  801746:	4c 01 d8             	add    %r11,%rax
+  801749:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80174c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80174f:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  801753:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801756:	48 89 ce             	mov    %rcx,%rsi
+  801759:	89 d7                	mov    %edx,%edi
+  80175b:	48 ba f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rdx
+  801762:	ff ff ff 
+  801765:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  801769:	ff d0                	call   *%rax
+  80176b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80176e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801772:	79 05                	jns    801779 <seek+0x4c>
+		return r;
+  801774:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801777:	eb 0f                	jmp    801788 <seek+0x5b>
+	fd->fd_offset = offset;
+  801779:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80177d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801780:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  801783:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801788:	c9                   	leave
+  801789:	c3                   	ret
+
+000000000080178a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80178a:	55                   	push   %rbp
+  80178b:	48 89 e5             	mov    %rsp,%rbp
+  80178e:	41 57                	push   %r15
+  801790:	53                   	push   %rbx
+  801791:	48 83 ec 30          	sub    $0x30,%rsp
+  801795:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801795 <ftruncate+0xb>
+  80179c:	49 bb a3 68 00 00 00 	movabs $0x68a3,%r11
+  8017a3:	00 00 00 
+  8017a6:	4c 01 db             	add    %r11,%rbx
+  8017a9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8017ac:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017af:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8017b3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8017b6:	48 89 d6             	mov    %rdx,%rsi
+  8017b9:	89 c7                	mov    %eax,%edi
+  8017bb:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  8017c2:	ff ff ff 
+  8017c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8017c9:	ff d0                	call   *%rax
+  8017cb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8017ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8017d2:	78 28                	js     8017fc <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017d8:	8b 00                	mov    (%rax),%eax
+  8017da:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8017de:	48 89 d6             	mov    %rdx,%rsi
+  8017e1:	89 c7                	mov    %eax,%edi
+  8017e3:	48 b8 9c 90 ff ff ff 	movabs $0xffffffffffff909c,%rax
+  8017ea:	ff ff ff 
+  8017ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8017f1:	ff d0                	call   *%rax
+  8017f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8017f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8017fa:	79 08                	jns    801804 <ftruncate+0x7a>
+		return r;
+  8017fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8017ff:	e9 83 00 00 00       	jmp    801887 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801804:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801808:	8b 40 08             	mov    0x8(%rax),%eax
+  80180b:	83 e0 03             	and    $0x3,%eax
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	75 4b                	jne    80185d <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  801812:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801819:	ff ff ff 
+  80181c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801820:	48 8b 00             	mov    (%rax),%rax
+  801823:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801829:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80182c:	89 c6                	mov    %eax,%esi
+  80182e:	48 b8 10 e0 ff ff ff 	movabs $0xffffffffffffe010,%rax
+  801835:	ff ff ff 
+  801838:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80183c:	48 89 c7             	mov    %rax,%rdi
+  80183f:	49 89 df             	mov    %rbx,%r15
+  801842:	b8 00 00 00 00       	mov    $0x0,%eax
+  801847:	48 b9 a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%rcx
+  80184e:	ff ff ff 
+  801851:	48 01 d9             	add    %rbx,%rcx
+  801854:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  801856:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185b:	eb 2a                	jmp    801887 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80185d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801861:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801865:	48 85 c0             	test   %rax,%rax
+  801868:	75 07                	jne    801871 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  80186a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80186f:	eb 16                	jmp    801887 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  801871:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801875:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  801879:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80187d:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  801880:	89 d6                	mov    %edx,%esi
+  801882:	48 89 c7             	mov    %rax,%rdi
+  801885:	ff d1                	call   *%rcx
+}
+  801887:	48 83 c4 30          	add    $0x30,%rsp
+  80188b:	5b                   	pop    %rbx
+  80188c:	41 5f                	pop    %r15
+  80188e:	5d                   	pop    %rbp
+  80188f:	c3                   	ret
+
+0000000000801890 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801890:	55                   	push   %rbp
+  801891:	48 89 e5             	mov    %rsp,%rbp
+  801894:	53                   	push   %rbx
+  801895:	48 83 ec 38          	sub    $0x38,%rsp
+  801899:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801899 <fstat+0x9>
+  8018a0:	49 bb 9f 67 00 00 00 	movabs $0x679f,%r11
+  8018a7:	00 00 00 
+  8018aa:	4c 01 db             	add    %r11,%rbx
+  8018ad:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8018b0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018b4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8018b8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8018bb:	48 89 d6             	mov    %rdx,%rsi
+  8018be:	89 c7                	mov    %eax,%edi
+  8018c0:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  8018c7:	ff ff ff 
+  8018ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8018ce:	ff d0                	call   *%rax
+  8018d0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8018d7:	78 28                	js     801901 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018dd:	8b 00                	mov    (%rax),%eax
+  8018df:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8018e3:	48 89 d6             	mov    %rdx,%rsi
+  8018e6:	89 c7                	mov    %eax,%edi
+  8018e8:	48 b8 9c 90 ff ff ff 	movabs $0xffffffffffff909c,%rax
+  8018ef:	ff ff ff 
+  8018f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8018f6:	ff d0                	call   *%rax
+  8018f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8018fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8018ff:	79 05                	jns    801906 <fstat+0x76>
+		return r;
+  801901:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801904:	eb 5e                	jmp    801964 <fstat+0xd4>
+	if (!dev->dev_stat)
+  801906:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80190a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80190e:	48 85 c0             	test   %rax,%rax
+  801911:	75 07                	jne    80191a <fstat+0x8a>
+		return -E_NOT_SUPP;
+  801913:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  801918:	eb 4a                	jmp    801964 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80191a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80191e:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  801921:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801925:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80192c:	00 00 00 
+	stat->st_isdir = 0;
+  80192f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801933:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80193a:	00 00 00 
+	stat->st_dev = dev;
+  80193d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801941:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801945:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80194c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801950:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  801954:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80195c:	48 89 d6             	mov    %rdx,%rsi
+  80195f:	48 89 c7             	mov    %rax,%rdi
+  801962:	ff d1                	call   *%rcx
+}
+  801964:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801968:	c9                   	leave
+  801969:	c3                   	ret
+
+000000000080196a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80196a:	55                   	push   %rbp
+  80196b:	48 89 e5             	mov    %rsp,%rbp
+  80196e:	41 57                	push   %r15
+  801970:	53                   	push   %rbx
+  801971:	48 83 ec 20          	sub    $0x20,%rsp
+  801975:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801975 <stat+0xb>
+  80197c:	49 bb c3 66 00 00 00 	movabs $0x66c3,%r11
+  801983:	00 00 00 
+  801986:	4c 01 db             	add    %r11,%rbx
+  801989:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80198d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801991:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801995:	be 00 00 00 00       	mov    $0x0,%esi
+  80199a:	48 89 c7             	mov    %rax,%rdi
+  80199d:	49 89 df             	mov    %rbx,%r15
+  8019a0:	48 b8 0c 9c ff ff ff 	movabs $0xffffffffffff9c0c,%rax
+  8019a7:	ff ff ff 
+  8019aa:	48 01 d8             	add    %rbx,%rax
+  8019ad:	ff d0                	call   *%rax
+  8019af:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019b2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8019b6:	79 05                	jns    8019bd <stat+0x53>
+		return fd;
+  8019b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019bb:	eb 37                	jmp    8019f4 <stat+0x8a>
+	r = fstat(fd, stat);
+  8019bd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8019c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019c4:	48 89 d6             	mov    %rdx,%rsi
+  8019c7:	89 c7                	mov    %eax,%edi
+  8019c9:	48 b8 58 98 ff ff ff 	movabs $0xffffffffffff9858,%rax
+  8019d0:	ff ff ff 
+  8019d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8019d7:	ff d0                	call   *%rax
+  8019d9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8019dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019df:	89 c7                	mov    %eax,%edi
+  8019e1:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  8019e8:	ff ff ff 
+  8019eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8019ef:	ff d0                	call   *%rax
+	return r;
+  8019f1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8019f4:	48 83 c4 20          	add    $0x20,%rsp
+  8019f8:	5b                   	pop    %rbx
+  8019f9:	41 5f                	pop    %r15
+  8019fb:	5d                   	pop    %rbp
+  8019fc:	c3                   	ret
+
+00000000008019fd <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8019fd:	55                   	push   %rbp
+  8019fe:	48 89 e5             	mov    %rsp,%rbp
+  801a01:	41 57                	push   %r15
+  801a03:	53                   	push   %rbx
+  801a04:	48 83 ec 10          	sub    $0x10,%rsp
+  801a08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801a08 <fsipc+0xb>
+  801a0f:	49 bb 30 66 00 00 00 	movabs $0x6630,%r11
+  801a16:	00 00 00 
+  801a19:	4c 01 db             	add    %r11,%rbx
+  801a1c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801a1f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  801a23:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  801a2a:	00 00 00 
+  801a2d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	75 24                	jne    801a58 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a34:	bf 01 00 00 00       	mov    $0x1,%edi
+  801a39:	49 89 df             	mov    %rbx,%r15
+  801a3c:	48 b8 3a de ff ff ff 	movabs $0xffffffffffffde3a,%rax
+  801a43:	ff ff ff 
+  801a46:	48 01 d8             	add    %rbx,%rax
+  801a49:	ff d0                	call   *%rax
+  801a4b:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  801a52:	00 00 00 
+  801a55:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  801a58:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  801a5f:	00 00 00 
+  801a62:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801a65:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a69:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  801a6c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801a72:	49 89 d0             	mov    %rdx,%r8
+  801a75:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801a7a:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  801a81:	00 00 00 
+  801a84:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  801a88:	89 c7                	mov    %eax,%edi
+  801a8a:	49 89 df             	mov    %rbx,%r15
+  801a8d:	48 b8 59 d8 ff ff ff 	movabs $0xffffffffffffd859,%rax
+  801a94:	ff ff ff 
+  801a97:	48 01 d8             	add    %rbx,%rax
+  801a9a:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  801a9c:	48 83 c4 10          	add    $0x10,%rsp
+  801aa0:	5b                   	pop    %rbx
+  801aa1:	41 5f                	pop    %r15
+  801aa3:	5d                   	pop    %rbp
+  801aa4:	c3                   	ret
+
+0000000000801aa5 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  801aa5:	55                   	push   %rbp
+  801aa6:	48 89 e5             	mov    %rsp,%rbp
+  801aa9:	41 57                	push   %r15
+  801aab:	53                   	push   %rbx
+  801aac:	48 83 ec 20          	sub    $0x20,%rsp
+  801ab0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801ab0 <fsipc_words+0xb>
+  801ab7:	49 bb 88 65 00 00 00 	movabs $0x6588,%r11
+  801abe:	00 00 00 
+  801ac1:	4c 01 db             	add    %r11,%rbx
+  801ac4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801ac7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801acb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  801acf:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  801ad6:	00 00 00 
+  801ad9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	75 24                	jne    801b04 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ae0:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ae5:	49 89 df             	mov    %rbx,%r15
+  801ae8:	48 b8 3a de ff ff ff 	movabs $0xffffffffffffde3a,%rax
+  801aef:	ff ff ff 
+  801af2:	48 01 d8             	add    %rbx,%rax
+  801af5:	ff d0                	call   *%rax
+  801af7:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  801afe:	00 00 00 
+  801b01:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  801b04:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  801b0b:	00 00 00 
+  801b0e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801b11:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b15:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801b19:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  801b1c:	89 c7                	mov    %eax,%edi
+  801b1e:	49 89 df             	mov    %rbx,%r15
+  801b21:	48 b8 44 d9 ff ff ff 	movabs $0xffffffffffffd944,%rax
+  801b28:	ff ff ff 
+  801b2b:	48 01 d8             	add    %rbx,%rax
+  801b2e:	ff d0                	call   *%rax
+}
+  801b30:	48 83 c4 20          	add    $0x20,%rsp
+  801b34:	5b                   	pop    %rbx
+  801b35:	41 5f                	pop    %r15
+  801b37:	5d                   	pop    %rbp
+  801b38:	c3                   	ret
+
+0000000000801b39 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  801b39:	55                   	push   %rbp
+  801b3a:	48 89 e5             	mov    %rsp,%rbp
+  801b3d:	41 57                	push   %r15
+  801b3f:	53                   	push   %rbx
+  801b40:	48 83 ec 40          	sub    $0x40,%rsp
+  801b44:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801b44 <fsipc_pages+0xb>
+  801b4b:	49 bb f4 64 00 00 00 	movabs $0x64f4,%r11
+  801b52:	00 00 00 
+  801b55:	4c 01 db             	add    %r11,%rbx
+  801b58:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801b5b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801b5f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  801b63:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  801b66:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  801b6d:	00 00 00 
+  801b70:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	75 24                	jne    801b9b <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b77:	bf 01 00 00 00       	mov    $0x1,%edi
+  801b7c:	49 89 df             	mov    %rbx,%r15
+  801b7f:	48 b8 3a de ff ff ff 	movabs $0xffffffffffffde3a,%rax
+  801b86:	ff ff ff 
+  801b89:	48 01 d8             	add    %rbx,%rax
+  801b8c:	ff d0                	call   *%rax
+  801b8e:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  801b95:	00 00 00 
+  801b98:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  801b9b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801ba0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  801ba4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801ba7:	48 98                	cltq
+  801ba9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  801bad:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801bb1:	0f 95 c0             	setne  %al
+  801bb4:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  801bb7:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  801bbe:	00 
+  801bbf:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc7:	48 01 d0             	add    %rdx,%rax
+  801bca:	48 83 e8 01          	sub    $0x1,%rax
+  801bce:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801bd2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdb:	48 f7 75 e8          	divq   -0x18(%rbp)
+  801bdf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801be3:	48 29 d0             	sub    %rdx,%rax
+  801be6:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  801bea:	41 89 c2             	mov    %eax,%r10d
+  801bed:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  801bf4:	00 00 00 
+  801bf7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801bfa:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  801bfe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c02:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801c05:	48 83 ec 08          	sub    $0x8,%rsp
+  801c09:	6a 40                	push   $0x40
+  801c0b:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  801c10:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  801c17:	00 
+  801c18:	6a 05                	push   $0x5
+  801c1a:	41 89 f9             	mov    %edi,%r9d
+  801c1d:	49 89 c8             	mov    %rcx,%r8
+  801c20:	44 89 d1             	mov    %r10d,%ecx
+  801c23:	89 c7                	mov    %eax,%edi
+  801c25:	49 89 df             	mov    %rbx,%r15
+  801c28:	48 b8 42 da ff ff ff 	movabs $0xffffffffffffda42,%rax
+  801c2f:	ff ff ff 
+  801c32:	48 01 d8             	add    %rbx,%rax
+  801c35:	ff d0                	call   *%rax
+  801c37:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  801c3b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801c3f:	5b                   	pop    %rbx
+  801c40:	41 5f                	pop    %r15
+  801c42:	5d                   	pop    %rbp
+  801c43:	c3                   	ret
+
+0000000000801c44 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  801c44:	55                   	push   %rbp
+  801c45:	48 89 e5             	mov    %rsp,%rbp
+  801c48:	41 57                	push   %r15
+  801c4a:	53                   	push   %rbx
+  801c4b:	48 83 ec 20          	sub    $0x20,%rsp
+  801c4f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801c4f <open+0xb>
+  801c56:	49 bb e9 63 00 00 00 	movabs $0x63e9,%r11
+  801c5d:	00 00 00 
+  801c60:	4c 01 db             	add    %r11,%rbx
+  801c63:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c67:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  801c6a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c6e:	48 89 c7             	mov    %rax,%rdi
+  801c71:	49 89 df             	mov    %rbx,%r15
+  801c74:	48 b8 d4 cc ff ff ff 	movabs $0xffffffffffffccd4,%rax
+  801c7b:	ff ff ff 
+  801c7e:	48 01 d8             	add    %rbx,%rax
+  801c81:	ff d0                	call   *%rax
+  801c83:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c88:	7e 0a                	jle    801c94 <open+0x50>
+		return -E_BAD_PATH;
+  801c8a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801c8f:	e9 18 01 00 00       	jmp    801dac <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  801c94:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801c98:	48 89 c7             	mov    %rax,%rdi
+  801c9b:	49 89 df             	mov    %rbx,%r15
+  801c9e:	48 b8 40 8e ff ff ff 	movabs $0xffffffffffff8e40,%rax
+  801ca5:	ff ff ff 
+  801ca8:	48 01 d8             	add    %rbx,%rax
+  801cab:	ff d0                	call   *%rax
+  801cad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801cb0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801cb4:	74 08                	je     801cbe <open+0x7a>
+		return r;
+  801cb6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cb9:	e9 ee 00 00 00       	jmp    801dac <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  801cbe:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  801cc5:	00 00 00 
+  801cc8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801ccb:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  801cd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd6:	48 89 c6             	mov    %rax,%rsi
+  801cd9:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  801ce0:	00 00 00 
+  801ce3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ce7:	48 89 c7             	mov    %rax,%rdi
+  801cea:	49 89 df             	mov    %rbx,%r15
+  801ced:	48 b8 68 cd ff ff ff 	movabs $0xffffffffffffcd68,%rax
+  801cf4:	ff ff ff 
+  801cf7:	48 01 d8             	add    %rbx,%rax
+  801cfa:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  801cfc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d00:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  801d05:	48 89 c6             	mov    %rax,%rsi
+  801d08:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d0d:	49 89 df             	mov    %rbx,%r15
+  801d10:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  801d17:	ff ff ff 
+  801d1a:	48 01 d8             	add    %rbx,%rax
+  801d1d:	ff d0                	call   *%rax
+  801d1f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d22:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801d26:	74 23                	je     801d4b <open+0x107>
+		fd_close(fd,0);
+  801d28:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d2c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d31:	48 89 c7             	mov    %rax,%rdi
+  801d34:	49 89 df             	mov    %rbx,%r15
+  801d37:	48 b8 a1 8f ff ff ff 	movabs $0xffffffffffff8fa1,%rax
+  801d3e:	ff ff ff 
+  801d41:	48 01 d8             	add    %rbx,%rax
+  801d44:	ff d0                	call   *%rax
+		return r;
+  801d46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d49:	eb 61                	jmp    801dac <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  801d4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d4f:	48 89 c6             	mov    %rax,%rsi
+  801d52:	bf 01 00 00 00       	mov    $0x1,%edi
+  801d57:	48 b8 c5 99 ff ff ff 	movabs $0xffffffffffff99c5,%rax
+  801d5e:	ff ff ff 
+  801d61:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d65:	ff d0                	call   *%rax
+  801d67:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d6a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801d6e:	74 23                	je     801d93 <open+0x14f>
+		fd_close(fd,0);
+  801d70:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d74:	be 00 00 00 00       	mov    $0x0,%esi
+  801d79:	48 89 c7             	mov    %rax,%rdi
+  801d7c:	49 89 df             	mov    %rbx,%r15
+  801d7f:	48 b8 a1 8f ff ff ff 	movabs $0xffffffffffff8fa1,%rax
+  801d86:	ff ff ff 
+  801d89:	48 01 d8             	add    %rbx,%rax
+  801d8c:	ff d0                	call   *%rax
+		return r;
+  801d8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d91:	eb 19                	jmp    801dac <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  801d93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d97:	48 89 c7             	mov    %rax,%rdi
+  801d9a:	49 89 df             	mov    %rbx,%r15
+  801d9d:	48 b8 c6 8d ff ff ff 	movabs $0xffffffffffff8dc6,%rax
+  801da4:	ff ff ff 
+  801da7:	48 01 d8             	add    %rbx,%rax
+  801daa:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  801dac:	48 83 c4 20          	add    $0x20,%rsp
+  801db0:	5b                   	pop    %rbx
+  801db1:	41 5f                	pop    %r15
+  801db3:	5d                   	pop    %rbp
+  801db4:	c3                   	ret
+
+0000000000801db5 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  801db5:	55                   	push   %rbp
+  801db6:	48 89 e5             	mov    %rsp,%rbp
+  801db9:	48 83 ec 20          	sub    $0x20,%rsp
+  801dbd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dbd <devfile_flush+0x8>
+  801dc4:	49 bb 7b 62 00 00 00 	movabs $0x627b,%r11
+  801dcb:	00 00 00 
+  801dce:	4c 01 d8             	add    %r11,%rax
+  801dd1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  801dd5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801dd9:	8b 52 0c             	mov    0xc(%rdx),%edx
+  801ddc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  801ddf:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  801de3:	ba 04 00 00 00       	mov    $0x4,%edx
+  801de8:	48 89 ce             	mov    %rcx,%rsi
+  801deb:	bf 06 00 00 00       	mov    $0x6,%edi
+  801df0:	48 b9 6d 9a ff ff ff 	movabs $0xffffffffffff9a6d,%rcx
+  801df7:	ff ff ff 
+  801dfa:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801dfe:	ff d0                	call   *%rax
+}
+  801e00:	c9                   	leave
+  801e01:	c3                   	ret
+
+0000000000801e02 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  801e02:	55                   	push   %rbp
+  801e03:	48 89 e5             	mov    %rsp,%rbp
+  801e06:	41 57                	push   %r15
+  801e08:	53                   	push   %rbx
+  801e09:	48 83 ec 60          	sub    $0x60,%rsp
+  801e0d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801e0d <devfile_read+0xb>
+  801e14:	49 bb 2b 62 00 00 00 	movabs $0x622b,%r11
+  801e1b:	00 00 00 
+  801e1e:	4c 01 db             	add    %r11,%rbx
+  801e21:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801e25:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801e29:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  801e2d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801e31:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  801e35:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801e39:	8b 50 0c             	mov    0xc(%rax),%edx
+  801e3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e40:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  801e42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e46:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801e4a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  801e4e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801e52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e57:	ba 10 00 00 00       	mov    $0x10,%edx
+  801e5c:	48 89 c6             	mov    %rax,%rsi
+  801e5f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e64:	48 b8 01 9b ff ff ff 	movabs $0xffffffffffff9b01,%rax
+  801e6b:	ff ff ff 
+  801e6e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e72:	ff d0                	call   *%rax
+  801e74:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  801e77:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801e7b:	79 05                	jns    801e82 <devfile_read+0x80>
+		return r;
+  801e7d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801e80:	eb 64                	jmp    801ee6 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  801e82:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801e85:	48 63 d0             	movslq %eax,%rdx
+  801e88:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801e8c:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  801e91:	48 01 c1             	add    %rax,%rcx
+  801e94:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e98:	48 89 ce             	mov    %rcx,%rsi
+  801e9b:	48 89 c7             	mov    %rax,%rdi
+  801e9e:	49 89 df             	mov    %rbx,%r15
+  801ea1:	48 b8 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rax
+  801ea8:	ff ff ff 
+  801eab:	48 01 d8             	add    %rbx,%rax
+  801eae:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  801eb0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801eb7:	ff ff ff 
+  801eba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801ebe:	48 8b 00             	mov    (%rax),%rax
+  801ec1:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  801ec7:	89 c6                	mov    %eax,%esi
+  801ec9:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  801ece:	48 89 c7             	mov    %rax,%rdi
+  801ed1:	49 89 df             	mov    %rbx,%r15
+  801ed4:	48 b8 f4 dd ff ff ff 	movabs $0xffffffffffffddf4,%rax
+  801edb:	ff ff ff 
+  801ede:	48 01 d8             	add    %rbx,%rax
+  801ee1:	ff d0                	call   *%rax
+	return r;
+  801ee3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  801ee6:	48 83 c4 60          	add    $0x60,%rsp
+  801eea:	5b                   	pop    %rbx
+  801eeb:	41 5f                	pop    %r15
+  801eed:	5d                   	pop    %rbp
+  801eee:	c3                   	ret
+
+0000000000801eef <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  801eef:	55                   	push   %rbp
+  801ef0:	48 89 e5             	mov    %rsp,%rbp
+  801ef3:	41 57                	push   %r15
+  801ef5:	53                   	push   %rbx
+  801ef6:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  801efa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801efa <devfile_write+0xb>
+  801f01:	49 bb 3e 61 00 00 00 	movabs $0x613e,%r11
+  801f08:	00 00 00 
+  801f0b:	4c 01 db             	add    %r11,%rbx
+  801f0e:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  801f12:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  801f16:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  801f1d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  801f21:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  801f25:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  801f2c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801f30:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  801f37:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f3a:	48 63 d0             	movslq %eax,%rdx
+  801f3d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f41:	48 39 c2             	cmp    %rax,%rdx
+  801f44:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801f48:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801f4f:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  801f56:	00 
+  801f57:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  801f5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f62:	48 01 d0             	add    %rdx,%rax
+  801f65:	48 83 e8 01          	sub    $0x1,%rax
+  801f69:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801f6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f76:	48 f7 75 d0          	divq   -0x30(%rbp)
+  801f7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f7e:	48 29 d0             	sub    %rdx,%rax
+  801f81:	48 c1 e8 0c          	shr    $0xc,%rax
+  801f85:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  801f88:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f8b:	89 c6                	mov    %eax,%esi
+  801f8d:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801f92:	48 89 c7             	mov    %rax,%rdi
+  801f95:	49 89 df             	mov    %rbx,%r15
+  801f98:	48 b8 ae dd ff ff ff 	movabs $0xffffffffffffddae,%rax
+  801f9f:	ff ff ff 
+  801fa2:	48 01 d8             	add    %rbx,%rax
+  801fa5:	ff d0                	call   *%rax
+  801fa7:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  801faa:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  801fae:	79 08                	jns    801fb8 <devfile_write+0xc9>
+		return r;
+  801fb0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801fb3:	e9 8f 00 00 00       	jmp    802047 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  801fb8:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  801fbf:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  801fc3:	48 89 c6             	mov    %rax,%rsi
+  801fc6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801fcb:	48 89 c7             	mov    %rax,%rdi
+  801fce:	49 89 df             	mov    %rbx,%r15
+  801fd1:	48 b8 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rax
+  801fd8:	ff ff ff 
+  801fdb:	48 01 d8             	add    %rbx,%rax
+  801fde:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  801fe0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801fe4:	8b 50 0c             	mov    0xc(%rax),%edx
+  801fe7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801feb:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  801fed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ff1:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  801ff8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  801ffc:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801fff:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  802003:	89 d1                	mov    %edx,%ecx
+  802005:	ba 10 00 00 00       	mov    $0x10,%edx
+  80200a:	48 89 c6             	mov    %rax,%rsi
+  80200d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802012:	48 b8 01 9b ff ff ff 	movabs $0xffffffffffff9b01,%rax
+  802019:	ff ff ff 
+  80201c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802020:	ff d0                	call   *%rax
+  802022:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  802025:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802028:	89 c6                	mov    %eax,%esi
+  80202a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80202f:	48 89 c7             	mov    %rax,%rdi
+  802032:	49 89 df             	mov    %rbx,%r15
+  802035:	48 b8 f4 dd ff ff ff 	movabs $0xffffffffffffddf4,%rax
+  80203c:	ff ff ff 
+  80203f:	48 01 d8             	add    %rbx,%rax
+  802042:	ff d0                	call   *%rax
+	return r;
+  802044:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  802047:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  80204b:	5b                   	pop    %rbx
+  80204c:	41 5f                	pop    %r15
+  80204e:	5d                   	pop    %rbp
+  80204f:	c3                   	ret
+
+0000000000802050 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  802050:	55                   	push   %rbp
+  802051:	48 89 e5             	mov    %rsp,%rbp
+  802054:	41 57                	push   %r15
+  802056:	53                   	push   %rbx
+  802057:	48 83 ec 20          	sub    $0x20,%rsp
+  80205b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80205b <devfile_stat+0xb>
+  802062:	49 bb dd 5f 00 00 00 	movabs $0x5fdd,%r11
+  802069:	00 00 00 
+  80206c:	4c 01 db             	add    %r11,%rbx
+  80206f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802073:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802077:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80207b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80207e:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  802085:	00 00 00 
+  802088:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80208b:	be 00 00 00 00       	mov    $0x0,%esi
+  802090:	bf 05 00 00 00       	mov    $0x5,%edi
+  802095:	48 b8 c5 99 ff ff ff 	movabs $0xffffffffffff99c5,%rax
+  80209c:	ff ff ff 
+  80209f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8020a3:	ff d0                	call   *%rax
+  8020a5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8020a8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8020ac:	79 05                	jns    8020b3 <devfile_stat+0x63>
+		return r;
+  8020ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020b1:	eb 65                	jmp    802118 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020b7:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  8020be:	00 00 00 
+  8020c1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8020c5:	48 89 d6             	mov    %rdx,%rsi
+  8020c8:	48 89 c7             	mov    %rax,%rdi
+  8020cb:	49 89 df             	mov    %rbx,%r15
+  8020ce:	48 b8 68 cd ff ff ff 	movabs $0xffffffffffffcd68,%rax
+  8020d5:	ff ff ff 
+  8020d8:	48 01 d8             	add    %rbx,%rax
+  8020db:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8020dd:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8020e4:	00 00 00 
+  8020e7:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8020ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020f2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020f8:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8020ff:	00 00 00 
+  802102:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  802109:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80210d:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  802113:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802118:	48 83 c4 20          	add    $0x20,%rsp
+  80211c:	5b                   	pop    %rbx
+  80211d:	41 5f                	pop    %r15
+  80211f:	5d                   	pop    %rbp
+  802120:	c3                   	ret
+
+0000000000802121 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802121:	55                   	push   %rbp
+  802122:	48 89 e5             	mov    %rsp,%rbp
+  802125:	48 83 ec 20          	sub    $0x20,%rsp
+  802129:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802129 <devfile_trunc+0x8>
+  802130:	49 bb 0f 5f 00 00 00 	movabs $0x5f0f,%r11
+  802137:	00 00 00 
+  80213a:	4c 01 d8             	add    %r11,%rax
+  80213d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802141:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  802144:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802148:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80214b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  80214e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802151:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  802154:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  802158:	ba 08 00 00 00       	mov    $0x8,%edx
+  80215d:	48 89 ce             	mov    %rcx,%rsi
+  802160:	bf 02 00 00 00       	mov    $0x2,%edi
+  802165:	48 b9 6d 9a ff ff ff 	movabs $0xffffffffffff9a6d,%rcx
+  80216c:	ff ff ff 
+  80216f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802173:	ff d0                	call   *%rax
+}
+  802175:	c9                   	leave
+  802176:	c3                   	ret
+
+0000000000802177 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802177:	55                   	push   %rbp
+  802178:	48 89 e5             	mov    %rsp,%rbp
+  80217b:	41 57                	push   %r15
+  80217d:	53                   	push   %rbx
+  80217e:	48 83 ec 10          	sub    $0x10,%rsp
+  802182:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802182 <remove+0xb>
+  802189:	49 bb b6 5e 00 00 00 	movabs $0x5eb6,%r11
+  802190:	00 00 00 
+  802193:	4c 01 db             	add    %r11,%rbx
+  802196:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  80219a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80219e:	48 89 c7             	mov    %rax,%rdi
+  8021a1:	49 89 df             	mov    %rbx,%r15
+  8021a4:	48 b8 d4 cc ff ff ff 	movabs $0xffffffffffffccd4,%rax
+  8021ab:	ff ff ff 
+  8021ae:	48 01 d8             	add    %rbx,%rax
+  8021b1:	ff d0                	call   *%rax
+  8021b3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021b8:	7e 07                	jle    8021c1 <remove+0x4a>
+		return -E_BAD_PATH;
+  8021ba:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8021bf:	eb 44                	jmp    802205 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8021c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021c5:	48 89 c6             	mov    %rax,%rsi
+  8021c8:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8021cf:	00 00 00 
+  8021d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8021d6:	48 89 c7             	mov    %rax,%rdi
+  8021d9:	49 89 df             	mov    %rbx,%r15
+  8021dc:	48 b8 68 cd ff ff ff 	movabs $0xffffffffffffcd68,%rax
+  8021e3:	ff ff ff 
+  8021e6:	48 01 d8             	add    %rbx,%rax
+  8021e9:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8021eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f0:	bf 07 00 00 00       	mov    $0x7,%edi
+  8021f5:	48 b8 c5 99 ff ff ff 	movabs $0xffffffffffff99c5,%rax
+  8021fc:	ff ff ff 
+  8021ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802203:	ff d0                	call   *%rax
+}
+  802205:	48 83 c4 10          	add    $0x10,%rsp
+  802209:	5b                   	pop    %rbx
+  80220a:	41 5f                	pop    %r15
+  80220c:	5d                   	pop    %rbp
+  80220d:	c3                   	ret
+
+000000000080220e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80220e:	55                   	push   %rbp
+  80220f:	48 89 e5             	mov    %rsp,%rbp
+  802212:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802212 <sync+0x4>
+  802219:	49 bb 26 5e 00 00 00 	movabs $0x5e26,%r11
+  802220:	00 00 00 
+  802223:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  802226:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222b:	be 00 00 00 00       	mov    $0x0,%esi
+  802230:	bf 08 00 00 00       	mov    $0x8,%edi
+  802235:	48 b9 6d 9a ff ff ff 	movabs $0xffffffffffff9a6d,%rcx
+  80223c:	ff ff ff 
+  80223f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802243:	ff d0                	call   *%rax
+}
+  802245:	5d                   	pop    %rbp
+  802246:	c3                   	ret
+
+0000000000802247 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  802247:	55                   	push   %rbp
+  802248:	48 89 e5             	mov    %rsp,%rbp
+  80224b:	41 57                	push   %r15
+  80224d:	53                   	push   %rbx
+  80224e:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  802255:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802255 <copy+0xe>
+  80225c:	49 bb e3 5d 00 00 00 	movabs $0x5de3,%r11
+  802263:	00 00 00 
+  802266:	4c 01 db             	add    %r11,%rbx
+  802269:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  802270:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  802277:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  80227e:	be 00 00 00 00       	mov    $0x0,%esi
+  802283:	48 89 c7             	mov    %rax,%rdi
+  802286:	48 b8 0c 9c ff ff ff 	movabs $0xffffffffffff9c0c,%rax
+  80228d:	ff ff ff 
+  802290:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802294:	ff d0                	call   *%rax
+  802296:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  802299:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80229d:	79 35                	jns    8022d4 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  80229f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022a2:	89 c6                	mov    %eax,%esi
+  8022a4:	48 b8 36 e0 ff ff ff 	movabs $0xffffffffffffe036,%rax
+  8022ab:	ff ff ff 
+  8022ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8022b2:	48 89 c7             	mov    %rax,%rdi
+  8022b5:	49 89 df             	mov    %rbx,%r15
+  8022b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bd:	48 ba a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%rdx
+  8022c4:	ff ff ff 
+  8022c7:	48 01 da             	add    %rbx,%rdx
+  8022ca:	ff d2                	call   *%rdx
+		return fd_src;
+  8022cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022cf:	e9 d7 01 00 00       	jmp    8024ab <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8022d4:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8022db:	be 01 01 00 00       	mov    $0x101,%esi
+  8022e0:	48 89 c7             	mov    %rax,%rdi
+  8022e3:	48 b8 0c 9c ff ff ff 	movabs $0xffffffffffff9c0c,%rax
+  8022ea:	ff ff ff 
+  8022ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8022f1:	ff d0                	call   *%rax
+  8022f3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  8022f6:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8022fa:	0f 89 df 00 00 00    	jns    8023df <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  802300:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802303:	89 c6                	mov    %eax,%esi
+  802305:	48 b8 4c e0 ff ff ff 	movabs $0xffffffffffffe04c,%rax
+  80230c:	ff ff ff 
+  80230f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802313:	48 89 c7             	mov    %rax,%rdi
+  802316:	49 89 df             	mov    %rbx,%r15
+  802319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231e:	48 ba a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%rdx
+  802325:	ff ff ff 
+  802328:	48 01 da             	add    %rbx,%rdx
+  80232b:	ff d2                	call   *%rdx
+		close(fd_src);
+  80232d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802330:	89 c7                	mov    %eax,%edi
+  802332:	49 89 df             	mov    %rbx,%r15
+  802335:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  80233c:	ff ff ff 
+  80233f:	48 01 d8             	add    %rbx,%rax
+  802342:	ff d0                	call   *%rax
+		return fd_dest;
+  802344:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802347:	e9 5f 01 00 00       	jmp    8024ab <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  80234c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80234f:	48 63 d0             	movslq %eax,%rdx
+  802352:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  802359:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80235c:	48 89 ce             	mov    %rcx,%rsi
+  80235f:	89 c7                	mov    %eax,%edi
+  802361:	49 89 df             	mov    %rbx,%r15
+  802364:	48 b8 e3 95 ff ff ff 	movabs $0xffffffffffff95e3,%rax
+  80236b:	ff ff ff 
+  80236e:	48 01 d8             	add    %rbx,%rax
+  802371:	ff d0                	call   *%rax
+  802373:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  802376:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80237a:	79 63                	jns    8023df <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  80237c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80237f:	89 c6                	mov    %eax,%esi
+  802381:	48 b8 66 e0 ff ff ff 	movabs $0xffffffffffffe066,%rax
+  802388:	ff ff ff 
+  80238b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80238f:	48 89 c7             	mov    %rax,%rdi
+  802392:	49 89 df             	mov    %rbx,%r15
+  802395:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239a:	48 ba a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%rdx
+  8023a1:	ff ff ff 
+  8023a4:	48 01 da             	add    %rbx,%rdx
+  8023a7:	ff d2                	call   *%rdx
+			close(fd_src);
+  8023a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023ac:	89 c7                	mov    %eax,%edi
+  8023ae:	49 89 df             	mov    %rbx,%r15
+  8023b1:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  8023b8:	ff ff ff 
+  8023bb:	48 01 d8             	add    %rbx,%rax
+  8023be:	ff d0                	call   *%rax
+			close(fd_dest);
+  8023c0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023c3:	89 c7                	mov    %eax,%edi
+  8023c5:	49 89 df             	mov    %rbx,%r15
+  8023c8:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  8023cf:	ff ff ff 
+  8023d2:	48 01 d8             	add    %rbx,%rax
+  8023d5:	ff d0                	call   *%rax
+			return write_size;
+  8023d7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8023da:	e9 cc 00 00 00       	jmp    8024ab <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  8023df:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8023e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023e9:	ba 00 02 00 00       	mov    $0x200,%edx
+  8023ee:	48 89 ce             	mov    %rcx,%rsi
+  8023f1:	89 c7                	mov    %eax,%edi
+  8023f3:	49 89 df             	mov    %rbx,%r15
+  8023f6:	48 b8 3d 94 ff ff ff 	movabs $0xffffffffffff943d,%rax
+  8023fd:	ff ff ff 
+  802400:	48 01 d8             	add    %rbx,%rax
+  802403:	ff d0                	call   *%rax
+  802405:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802408:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80240c:	0f 8f 3a ff ff ff    	jg     80234c <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  802412:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802416:	79 60                	jns    802478 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  802418:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80241b:	89 c6                	mov    %eax,%esi
+  80241d:	48 b8 79 e0 ff ff ff 	movabs $0xffffffffffffe079,%rax
+  802424:	ff ff ff 
+  802427:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80242b:	48 89 c7             	mov    %rax,%rdi
+  80242e:	49 89 df             	mov    %rbx,%r15
+  802431:	b8 00 00 00 00       	mov    $0x0,%eax
+  802436:	48 ba a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%rdx
+  80243d:	ff ff ff 
+  802440:	48 01 da             	add    %rbx,%rdx
+  802443:	ff d2                	call   *%rdx
+		close(fd_src);
+  802445:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802448:	89 c7                	mov    %eax,%edi
+  80244a:	49 89 df             	mov    %rbx,%r15
+  80244d:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  802454:	ff ff ff 
+  802457:	48 01 d8             	add    %rbx,%rax
+  80245a:	ff d0                	call   *%rax
+		close(fd_dest);
+  80245c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80245f:	89 c7                	mov    %eax,%edi
+  802461:	49 89 df             	mov    %rbx,%r15
+  802464:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  80246b:	ff ff ff 
+  80246e:	48 01 d8             	add    %rbx,%rax
+  802471:	ff d0                	call   *%rax
+		return read_size;
+  802473:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802476:	eb 33                	jmp    8024ab <copy+0x264>
+	}
+	close(fd_src);
+  802478:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80247b:	89 c7                	mov    %eax,%edi
+  80247d:	49 89 df             	mov    %rbx,%r15
+  802480:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  802487:	ff ff ff 
+  80248a:	48 01 d8             	add    %rbx,%rax
+  80248d:	ff d0                	call   *%rax
+	close(fd_dest);
+  80248f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802492:	89 c7                	mov    %eax,%edi
+  802494:	49 89 df             	mov    %rbx,%r15
+  802497:	48 b8 85 91 ff ff ff 	movabs $0xffffffffffff9185,%rax
+  80249e:	ff ff ff 
+  8024a1:	48 01 d8             	add    %rbx,%rax
+  8024a4:	ff d0                	call   *%rax
+	return 0;
+  8024a6:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8024ab:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8024b2:	5b                   	pop    %rbx
+  8024b3:	41 5f                	pop    %r15
+  8024b5:	5d                   	pop    %rbp
+  8024b6:	c3                   	ret
+
+00000000008024b7 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  8024b7:	55                   	push   %rbp
+  8024b8:	48 89 e5             	mov    %rsp,%rbp
+  8024bb:	41 57                	push   %r15
+  8024bd:	53                   	push   %rbx
+  8024be:	48 83 ec 20          	sub    $0x20,%rsp
+  8024c2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8024c2 <fd2sockid+0xb>
+  8024c9:	49 bb 76 5b 00 00 00 	movabs $0x5b76,%r11
+  8024d0:	00 00 00 
+  8024d3:	4c 01 db             	add    %r11,%rbx
+  8024d6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8024d9:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8024dd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8024e0:	48 89 d6             	mov    %rdx,%rsi
+  8024e3:	89 c7                	mov    %eax,%edi
+  8024e5:	49 89 df             	mov    %rbx,%r15
+  8024e8:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  8024ef:	ff ff ff 
+  8024f2:	48 01 d8             	add    %rbx,%rax
+  8024f5:	ff d0                	call   *%rax
+  8024f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8024fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8024fe:	79 05                	jns    802505 <fd2sockid+0x4e>
+		return r;
+  802500:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802503:	eb 25                	jmp    80252a <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802505:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802509:	8b 10                	mov    (%rax),%edx
+  80250b:	48 b8 88 00 00 00 00 	movabs $0x88,%rax
+  802512:	00 00 00 
+  802515:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802518:	39 c2                	cmp    %eax,%edx
+  80251a:	74 07                	je     802523 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80251c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802521:	eb 07                	jmp    80252a <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  802523:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802527:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  80252a:	48 83 c4 20          	add    $0x20,%rsp
+  80252e:	5b                   	pop    %rbx
+  80252f:	41 5f                	pop    %r15
+  802531:	5d                   	pop    %rbp
+  802532:	c3                   	ret
+
+0000000000802533 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  802533:	55                   	push   %rbp
+  802534:	48 89 e5             	mov    %rsp,%rbp
+  802537:	41 57                	push   %r15
+  802539:	53                   	push   %rbx
+  80253a:	48 83 ec 20          	sub    $0x20,%rsp
+  80253e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80253e <alloc_sockfd+0xb>
+  802545:	49 bb fa 5a 00 00 00 	movabs $0x5afa,%r11
+  80254c:	00 00 00 
+  80254f:	4c 01 db             	add    %r11,%rbx
+  802552:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  802555:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802559:	48 89 c7             	mov    %rax,%rdi
+  80255c:	49 89 df             	mov    %rbx,%r15
+  80255f:	48 b8 40 8e ff ff ff 	movabs $0xffffffffffff8e40,%rax
+  802566:	ff ff ff 
+  802569:	48 01 d8             	add    %rbx,%rax
+  80256c:	ff d0                	call   *%rax
+  80256e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802571:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802575:	78 2c                	js     8025a3 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802577:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80257b:	ba 07 04 00 00       	mov    $0x407,%edx
+  802580:	48 89 c6             	mov    %rax,%rsi
+  802583:	bf 00 00 00 00       	mov    $0x0,%edi
+  802588:	49 89 df             	mov    %rbx,%r15
+  80258b:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  802592:	ff ff ff 
+  802595:	48 01 d8             	add    %rbx,%rax
+  802598:	ff d0                	call   *%rax
+  80259a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80259d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8025a1:	79 1c                	jns    8025bf <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8025a3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8025a6:	89 c7                	mov    %eax,%edi
+  8025a8:	49 89 df             	mov    %rbx,%r15
+  8025ab:	48 b8 ef ac ff ff ff 	movabs $0xffffffffffffacef,%rax
+  8025b2:	ff ff ff 
+  8025b5:	48 01 d8             	add    %rbx,%rax
+  8025b8:	ff d0                	call   *%rax
+		return r;
+  8025ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025bd:	eb 41                	jmp    802600 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  8025bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8025c3:	48 ba 88 00 00 00 00 	movabs $0x88,%rdx
+  8025ca:	00 00 00 
+  8025cd:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8025d0:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8025d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8025d6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  8025dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8025e1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8025e4:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8025e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8025eb:	48 89 c7             	mov    %rax,%rdi
+  8025ee:	49 89 df             	mov    %rbx,%r15
+  8025f1:	48 b8 c6 8d ff ff ff 	movabs $0xffffffffffff8dc6,%rax
+  8025f8:	ff ff ff 
+  8025fb:	48 01 d8             	add    %rbx,%rax
+  8025fe:	ff d0                	call   *%rax
+}
+  802600:	48 83 c4 20          	add    $0x20,%rsp
+  802604:	5b                   	pop    %rbx
+  802605:	41 5f                	pop    %r15
+  802607:	5d                   	pop    %rbp
+  802608:	c3                   	ret
+
+0000000000802609 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802609:	55                   	push   %rbp
+  80260a:	48 89 e5             	mov    %rsp,%rbp
+  80260d:	41 57                	push   %r15
+  80260f:	53                   	push   %rbx
+  802610:	48 83 ec 30          	sub    $0x30,%rsp
+  802614:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802614 <accept+0xb>
+  80261b:	49 bb 24 5a 00 00 00 	movabs $0x5a24,%r11
+  802622:	00 00 00 
+  802625:	4c 01 db             	add    %r11,%rbx
+  802628:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80262b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80262f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  802633:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802636:	89 c7                	mov    %eax,%edi
+  802638:	48 b8 7f a4 ff ff ff 	movabs $0xffffffffffffa47f,%rax
+  80263f:	ff ff ff 
+  802642:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802646:	ff d0                	call   *%rax
+  802648:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80264b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80264f:	79 05                	jns    802656 <accept+0x4d>
+		return r;
+  802651:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802654:	eb 45                	jmp    80269b <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802656:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80265a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80265e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802661:	48 89 ce             	mov    %rcx,%rsi
+  802664:	89 c7                	mov    %eax,%edi
+  802666:	49 89 df             	mov    %rbx,%r15
+  802669:	48 b8 5d ab ff ff ff 	movabs $0xffffffffffffab5d,%rax
+  802670:	ff ff ff 
+  802673:	48 01 d8             	add    %rbx,%rax
+  802676:	ff d0                	call   *%rax
+  802678:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80267b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80267f:	79 05                	jns    802686 <accept+0x7d>
+		return r;
+  802681:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802684:	eb 15                	jmp    80269b <accept+0x92>
+	return alloc_sockfd(r);
+  802686:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802689:	89 c7                	mov    %eax,%edi
+  80268b:	48 b8 fb a4 ff ff ff 	movabs $0xffffffffffffa4fb,%rax
+  802692:	ff ff ff 
+  802695:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802699:	ff d0                	call   *%rax
+}
+  80269b:	48 83 c4 30          	add    $0x30,%rsp
+  80269f:	5b                   	pop    %rbx
+  8026a0:	41 5f                	pop    %r15
+  8026a2:	5d                   	pop    %rbp
+  8026a3:	c3                   	ret
+
+00000000008026a4 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8026a4:	55                   	push   %rbp
+  8026a5:	48 89 e5             	mov    %rsp,%rbp
+  8026a8:	41 57                	push   %r15
+  8026aa:	53                   	push   %rbx
+  8026ab:	48 83 ec 20          	sub    $0x20,%rsp
+  8026af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8026af <bind+0xb>
+  8026b6:	49 bb 89 59 00 00 00 	movabs $0x5989,%r11
+  8026bd:	00 00 00 
+  8026c0:	4c 01 db             	add    %r11,%rbx
+  8026c3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8026c6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8026ca:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8026cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026d0:	89 c7                	mov    %eax,%edi
+  8026d2:	48 b8 7f a4 ff ff ff 	movabs $0xffffffffffffa47f,%rax
+  8026d9:	ff ff ff 
+  8026dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8026e0:	ff d0                	call   *%rax
+  8026e2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8026e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8026e9:	79 05                	jns    8026f0 <bind+0x4c>
+		return r;
+  8026eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026ee:	eb 21                	jmp    802711 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  8026f0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8026f3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8026f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026fa:	48 89 ce             	mov    %rcx,%rsi
+  8026fd:	89 c7                	mov    %eax,%edi
+  8026ff:	49 89 df             	mov    %rbx,%r15
+  802702:	48 b8 09 ac ff ff ff 	movabs $0xffffffffffffac09,%rax
+  802709:	ff ff ff 
+  80270c:	48 01 d8             	add    %rbx,%rax
+  80270f:	ff d0                	call   *%rax
+}
+  802711:	48 83 c4 20          	add    $0x20,%rsp
+  802715:	5b                   	pop    %rbx
+  802716:	41 5f                	pop    %r15
+  802718:	5d                   	pop    %rbp
+  802719:	c3                   	ret
+
+000000000080271a <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80271a:	55                   	push   %rbp
+  80271b:	48 89 e5             	mov    %rsp,%rbp
+  80271e:	41 57                	push   %r15
+  802720:	53                   	push   %rbx
+  802721:	48 83 ec 20          	sub    $0x20,%rsp
+  802725:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802725 <shutdown+0xb>
+  80272c:	49 bb 13 59 00 00 00 	movabs $0x5913,%r11
+  802733:	00 00 00 
+  802736:	4c 01 db             	add    %r11,%rbx
+  802739:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80273c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80273f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802742:	89 c7                	mov    %eax,%edi
+  802744:	48 b8 7f a4 ff ff ff 	movabs $0xffffffffffffa47f,%rax
+  80274b:	ff ff ff 
+  80274e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802752:	ff d0                	call   *%rax
+  802754:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802757:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80275b:	79 05                	jns    802762 <shutdown+0x48>
+		return r;
+  80275d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802760:	eb 1c                	jmp    80277e <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  802762:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802765:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802768:	89 d6                	mov    %edx,%esi
+  80276a:	89 c7                	mov    %eax,%edi
+  80276c:	49 89 df             	mov    %rbx,%r15
+  80276f:	48 b8 9e ac ff ff ff 	movabs $0xffffffffffffac9e,%rax
+  802776:	ff ff ff 
+  802779:	48 01 d8             	add    %rbx,%rax
+  80277c:	ff d0                	call   *%rax
+}
+  80277e:	48 83 c4 20          	add    $0x20,%rsp
+  802782:	5b                   	pop    %rbx
+  802783:	41 5f                	pop    %r15
+  802785:	5d                   	pop    %rbp
+  802786:	c3                   	ret
+
+0000000000802787 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  802787:	55                   	push   %rbp
+  802788:	48 89 e5             	mov    %rsp,%rbp
+  80278b:	41 57                	push   %r15
+  80278d:	53                   	push   %rbx
+  80278e:	48 83 ec 10          	sub    $0x10,%rsp
+  802792:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802792 <devsock_close+0xb>
+  802799:	49 bb a6 58 00 00 00 	movabs $0x58a6,%r11
+  8027a0:	00 00 00 
+  8027a3:	4c 01 db             	add    %r11,%rbx
+  8027a6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  8027aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027ae:	48 89 c7             	mov    %rax,%rdi
+  8027b1:	49 89 df             	mov    %rbx,%r15
+  8027b4:	48 b8 c9 de ff ff ff 	movabs $0xffffffffffffdec9,%rax
+  8027bb:	ff ff ff 
+  8027be:	48 01 d8             	add    %rbx,%rax
+  8027c1:	ff d0                	call   *%rax
+  8027c3:	83 f8 01             	cmp    $0x1,%eax
+  8027c6:	75 1d                	jne    8027e5 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  8027c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027cc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8027cf:	89 c7                	mov    %eax,%edi
+  8027d1:	49 89 df             	mov    %rbx,%r15
+  8027d4:	48 b8 ef ac ff ff ff 	movabs $0xffffffffffffacef,%rax
+  8027db:	ff ff ff 
+  8027de:	48 01 d8             	add    %rbx,%rax
+  8027e1:	ff d0                	call   *%rax
+  8027e3:	eb 05                	jmp    8027ea <devsock_close+0x63>
+	else
+		return 0;
+  8027e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ea:	48 83 c4 10          	add    $0x10,%rsp
+  8027ee:	5b                   	pop    %rbx
+  8027ef:	41 5f                	pop    %r15
+  8027f1:	5d                   	pop    %rbp
+  8027f2:	c3                   	ret
+
+00000000008027f3 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8027f3:	55                   	push   %rbp
+  8027f4:	48 89 e5             	mov    %rsp,%rbp
+  8027f7:	41 57                	push   %r15
+  8027f9:	53                   	push   %rbx
+  8027fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8027fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8027fe <connect+0xb>
+  802805:	49 bb 3a 58 00 00 00 	movabs $0x583a,%r11
+  80280c:	00 00 00 
+  80280f:	4c 01 db             	add    %r11,%rbx
+  802812:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802815:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802819:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80281c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80281f:	89 c7                	mov    %eax,%edi
+  802821:	48 b8 7f a4 ff ff ff 	movabs $0xffffffffffffa47f,%rax
+  802828:	ff ff ff 
+  80282b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80282f:	ff d0                	call   *%rax
+  802831:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802834:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802838:	79 05                	jns    80283f <connect+0x4c>
+		return r;
+  80283a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80283d:	eb 21                	jmp    802860 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80283f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802842:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802846:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802849:	48 89 ce             	mov    %rcx,%rsi
+  80284c:	89 c7                	mov    %eax,%edi
+  80284e:	49 89 df             	mov    %rbx,%r15
+  802851:	48 b8 37 ad ff ff ff 	movabs $0xffffffffffffad37,%rax
+  802858:	ff ff ff 
+  80285b:	48 01 d8             	add    %rbx,%rax
+  80285e:	ff d0                	call   *%rax
+}
+  802860:	48 83 c4 20          	add    $0x20,%rsp
+  802864:	5b                   	pop    %rbx
+  802865:	41 5f                	pop    %r15
+  802867:	5d                   	pop    %rbp
+  802868:	c3                   	ret
+
+0000000000802869 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  802869:	55                   	push   %rbp
+  80286a:	48 89 e5             	mov    %rsp,%rbp
+  80286d:	41 57                	push   %r15
+  80286f:	53                   	push   %rbx
+  802870:	48 83 ec 20          	sub    $0x20,%rsp
+  802874:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802874 <listen+0xb>
+  80287b:	49 bb c4 57 00 00 00 	movabs $0x57c4,%r11
+  802882:	00 00 00 
+  802885:	4c 01 db             	add    %r11,%rbx
+  802888:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80288b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80288e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802891:	89 c7                	mov    %eax,%edi
+  802893:	48 b8 7f a4 ff ff ff 	movabs $0xffffffffffffa47f,%rax
+  80289a:	ff ff ff 
+  80289d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8028a1:	ff d0                	call   *%rax
+  8028a3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8028a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8028aa:	79 05                	jns    8028b1 <listen+0x48>
+		return r;
+  8028ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028af:	eb 1c                	jmp    8028cd <listen+0x64>
+	return nsipc_listen(r, backlog);
+  8028b1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8028b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028b7:	89 d6                	mov    %edx,%esi
+  8028b9:	89 c7                	mov    %eax,%edi
+  8028bb:	49 89 df             	mov    %rbx,%r15
+  8028be:	48 b8 cc ad ff ff ff 	movabs $0xffffffffffffadcc,%rax
+  8028c5:	ff ff ff 
+  8028c8:	48 01 d8             	add    %rbx,%rax
+  8028cb:	ff d0                	call   *%rax
+}
+  8028cd:	48 83 c4 20          	add    $0x20,%rsp
+  8028d1:	5b                   	pop    %rbx
+  8028d2:	41 5f                	pop    %r15
+  8028d4:	5d                   	pop    %rbp
+  8028d5:	c3                   	ret
+
+00000000008028d6 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8028d6:	55                   	push   %rbp
+  8028d7:	48 89 e5             	mov    %rsp,%rbp
+  8028da:	41 57                	push   %r15
+  8028dc:	48 83 ec 28          	sub    $0x28,%rsp
+  8028e0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028e0 <devsock_read+0xa>
+  8028e7:	49 bb 58 57 00 00 00 	movabs $0x5758,%r11
+  8028ee:	00 00 00 
+  8028f1:	4c 01 d8             	add    %r11,%rax
+  8028f4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8028f8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028fc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802900:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802904:	41 89 d0             	mov    %edx,%r8d
+  802907:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80290b:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80290e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802912:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802917:	44 89 c2             	mov    %r8d,%edx
+  80291a:	49 89 c7             	mov    %rax,%r15
+  80291d:	49 b8 1d ae ff ff ff 	movabs $0xffffffffffffae1d,%r8
+  802924:	ff ff ff 
+  802927:	49 01 c0             	add    %rax,%r8
+  80292a:	41 ff d0             	call   *%r8
+}
+  80292d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802931:	c9                   	leave
+  802932:	c3                   	ret
+
+0000000000802933 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  802933:	55                   	push   %rbp
+  802934:	48 89 e5             	mov    %rsp,%rbp
+  802937:	41 57                	push   %r15
+  802939:	48 83 ec 28          	sub    $0x28,%rsp
+  80293d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80293d <devsock_write+0xa>
+  802944:	49 bb fb 56 00 00 00 	movabs $0x56fb,%r11
+  80294b:	00 00 00 
+  80294e:	4c 01 d8             	add    %r11,%rax
+  802951:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802955:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802959:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80295d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802961:	41 89 d0             	mov    %edx,%r8d
+  802964:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802968:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80296b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80296f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802974:	44 89 c2             	mov    %r8d,%edx
+  802977:	49 89 c7             	mov    %rax,%r15
+  80297a:	49 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%r8
+  802981:	ff ff ff 
+  802984:	49 01 c0             	add    %rax,%r8
+  802987:	41 ff d0             	call   *%r8
+}
+  80298a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80298e:	c9                   	leave
+  80298f:	c3                   	ret
+
+0000000000802990 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802990:	55                   	push   %rbp
+  802991:	48 89 e5             	mov    %rsp,%rbp
+  802994:	41 57                	push   %r15
+  802996:	48 83 ec 18          	sub    $0x18,%rsp
+  80299a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80299a <devsock_stat+0xa>
+  8029a1:	49 bb 9e 56 00 00 00 	movabs $0x569e,%r11
+  8029a8:	00 00 00 
+  8029ab:	4c 01 d8             	add    %r11,%rax
+  8029ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029b2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8029b6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8029ba:	48 b9 94 e0 ff ff ff 	movabs $0xffffffffffffe094,%rcx
+  8029c1:	ff ff ff 
+  8029c4:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8029c8:	48 89 ce             	mov    %rcx,%rsi
+  8029cb:	48 89 d7             	mov    %rdx,%rdi
+  8029ce:	49 89 c7             	mov    %rax,%r15
+  8029d1:	48 ba 68 cd ff ff ff 	movabs $0xffffffffffffcd68,%rdx
+  8029d8:	ff ff ff 
+  8029db:	48 01 c2             	add    %rax,%rdx
+  8029de:	ff d2                	call   *%rdx
+	return 0;
+  8029e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029e5:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8029e9:	c9                   	leave
+  8029ea:	c3                   	ret
+
+00000000008029eb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8029eb:	55                   	push   %rbp
+  8029ec:	48 89 e5             	mov    %rsp,%rbp
+  8029ef:	41 57                	push   %r15
+  8029f1:	53                   	push   %rbx
+  8029f2:	48 83 ec 20          	sub    $0x20,%rsp
+  8029f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8029f6 <socket+0xb>
+  8029fd:	49 bb 42 56 00 00 00 	movabs $0x5642,%r11
+  802a04:	00 00 00 
+  802a07:	4c 01 db             	add    %r11,%rbx
+  802a0a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802a0d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  802a10:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a13:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  802a16:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  802a19:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a1c:	89 ce                	mov    %ecx,%esi
+  802a1e:	89 c7                	mov    %eax,%edi
+  802a20:	49 89 df             	mov    %rbx,%r15
+  802a23:	48 b8 11 b1 ff ff ff 	movabs $0xffffffffffffb111,%rax
+  802a2a:	ff ff ff 
+  802a2d:	48 01 d8             	add    %rbx,%rax
+  802a30:	ff d0                	call   *%rax
+  802a32:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802a35:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a39:	79 05                	jns    802a40 <socket+0x55>
+		return r;
+  802a3b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a3e:	eb 15                	jmp    802a55 <socket+0x6a>
+	return alloc_sockfd(r);
+  802a40:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a43:	89 c7                	mov    %eax,%edi
+  802a45:	48 b8 fb a4 ff ff ff 	movabs $0xffffffffffffa4fb,%rax
+  802a4c:	ff ff ff 
+  802a4f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a53:	ff d0                	call   *%rax
+}
+  802a55:	48 83 c4 20          	add    $0x20,%rsp
+  802a59:	5b                   	pop    %rbx
+  802a5a:	41 5f                	pop    %r15
+  802a5c:	5d                   	pop    %rbp
+  802a5d:	c3                   	ret
+
+0000000000802a5e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a5e:	55                   	push   %rbp
+  802a5f:	48 89 e5             	mov    %rsp,%rbp
+  802a62:	41 57                	push   %r15
+  802a64:	53                   	push   %rbx
+  802a65:	48 83 ec 10          	sub    $0x10,%rsp
+  802a69:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a69 <nsipc+0xb>
+  802a70:	49 bb cf 55 00 00 00 	movabs $0x55cf,%r11
+  802a77:	00 00 00 
+  802a7a:	4c 01 db             	add    %r11,%rbx
+  802a7d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  802a80:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  802a87:	00 00 00 
+  802a8a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802a8d:	85 c0                	test   %eax,%eax
+  802a8f:	75 24                	jne    802ab5 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a91:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a96:	49 89 df             	mov    %rbx,%r15
+  802a99:	48 b8 3a de ff ff ff 	movabs $0xffffffffffffde3a,%rax
+  802aa0:	ff ff ff 
+  802aa3:	48 01 d8             	add    %rbx,%rax
+  802aa6:	ff d0                	call   *%rax
+  802aa8:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  802aaf:	00 00 00 
+  802ab2:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  802ab5:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  802abc:	00 00 00 
+  802abf:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802ac2:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802ac5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802acb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ad1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802ad6:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  802add:	00 00 00 
+  802ae0:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  802ae4:	89 c7                	mov    %eax,%edi
+  802ae6:	49 89 df             	mov    %rbx,%r15
+  802ae9:	48 b8 59 d8 ff ff ff 	movabs $0xffffffffffffd859,%rax
+  802af0:	ff ff ff 
+  802af3:	48 01 d8             	add    %rbx,%rax
+  802af6:	ff d0                	call   *%rax
+}
+  802af8:	48 83 c4 10          	add    $0x10,%rsp
+  802afc:	5b                   	pop    %rbx
+  802afd:	41 5f                	pop    %r15
+  802aff:	5d                   	pop    %rbp
+  802b00:	c3                   	ret
+
+0000000000802b01 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  802b01:	55                   	push   %rbp
+  802b02:	48 89 e5             	mov    %rsp,%rbp
+  802b05:	41 57                	push   %r15
+  802b07:	53                   	push   %rbx
+  802b08:	48 83 ec 20          	sub    $0x20,%rsp
+  802b0c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b0c <nsipc_words+0xb>
+  802b13:	49 bb 2c 55 00 00 00 	movabs $0x552c,%r11
+  802b1a:	00 00 00 
+  802b1d:	4c 01 db             	add    %r11,%rbx
+  802b20:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b23:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802b27:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  802b2b:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  802b32:	00 00 00 
+  802b35:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802b38:	85 c0                	test   %eax,%eax
+  802b3a:	75 24                	jne    802b60 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b3c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802b41:	49 89 df             	mov    %rbx,%r15
+  802b44:	48 b8 3a de ff ff ff 	movabs $0xffffffffffffde3a,%rax
+  802b4b:	ff ff ff 
+  802b4e:	48 01 d8             	add    %rbx,%rax
+  802b51:	ff d0                	call   *%rax
+  802b53:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  802b5a:	00 00 00 
+  802b5d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  802b60:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  802b67:	00 00 00 
+  802b6a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802b6d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802b71:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b75:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802b78:	89 c7                	mov    %eax,%edi
+  802b7a:	49 89 df             	mov    %rbx,%r15
+  802b7d:	48 b8 44 d9 ff ff ff 	movabs $0xffffffffffffd944,%rax
+  802b84:	ff ff ff 
+  802b87:	48 01 d8             	add    %rbx,%rax
+  802b8a:	ff d0                	call   *%rax
+}
+  802b8c:	48 83 c4 20          	add    $0x20,%rsp
+  802b90:	5b                   	pop    %rbx
+  802b91:	41 5f                	pop    %r15
+  802b93:	5d                   	pop    %rbp
+  802b94:	c3                   	ret
+
+0000000000802b95 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802b95:	55                   	push   %rbp
+  802b96:	48 89 e5             	mov    %rsp,%rbp
+  802b99:	41 57                	push   %r15
+  802b9b:	53                   	push   %rbx
+  802b9c:	48 83 ec 30          	sub    $0x30,%rsp
+  802ba0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ba0 <nsipc_accept+0xb>
+  802ba7:	49 bb 98 54 00 00 00 	movabs $0x5498,%r11
+  802bae:	00 00 00 
+  802bb1:	4c 01 db             	add    %r11,%rbx
+  802bb4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802bb7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802bbb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802bbf:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  802bc6:	00 00 00 
+  802bc9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802bcc:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802bcf:	bf 01 00 00 00       	mov    $0x1,%edi
+  802bd4:	48 b8 26 aa ff ff ff 	movabs $0xffffffffffffaa26,%rax
+  802bdb:	ff ff ff 
+  802bde:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802be2:	ff d0                	call   *%rax
+  802be4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802be7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802beb:	78 48                	js     802c35 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  802bed:	48 b8 c8 3f 01 00 00 	movabs $0x13fc8,%rax
+  802bf4:	00 00 00 
+  802bf7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bfb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802bff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c03:	8b 40 10             	mov    0x10(%rax),%eax
+  802c06:	89 c2                	mov    %eax,%edx
+  802c08:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802c0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c10:	48 89 ce             	mov    %rcx,%rsi
+  802c13:	48 89 c7             	mov    %rax,%rdi
+  802c16:	49 89 df             	mov    %rbx,%r15
+  802c19:	48 b8 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rax
+  802c20:	ff ff ff 
+  802c23:	48 01 d8             	add    %rbx,%rax
+  802c26:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  802c28:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c2c:	8b 50 10             	mov    0x10(%rax),%edx
+  802c2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c33:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  802c35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802c38:	48 83 c4 30          	add    $0x30,%rsp
+  802c3c:	5b                   	pop    %rbx
+  802c3d:	41 5f                	pop    %r15
+  802c3f:	5d                   	pop    %rbp
+  802c40:	c3                   	ret
+
+0000000000802c41 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c41:	55                   	push   %rbp
+  802c42:	48 89 e5             	mov    %rsp,%rbp
+  802c45:	41 57                	push   %r15
+  802c47:	53                   	push   %rbx
+  802c48:	48 83 ec 10          	sub    $0x10,%rsp
+  802c4c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c4c <nsipc_bind+0xb>
+  802c53:	49 bb ec 53 00 00 00 	movabs $0x53ec,%r11
+  802c5a:	00 00 00 
+  802c5d:	4c 01 db             	add    %r11,%rbx
+  802c60:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802c63:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802c67:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  802c6a:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  802c71:	00 00 00 
+  802c74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c77:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c7a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802c7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c81:	48 89 c6             	mov    %rax,%rsi
+  802c84:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  802c8b:	00 00 00 
+  802c8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c92:	48 89 c7             	mov    %rax,%rdi
+  802c95:	49 89 df             	mov    %rbx,%r15
+  802c98:	48 b8 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rax
+  802c9f:	ff ff ff 
+  802ca2:	48 01 d8             	add    %rbx,%rax
+  802ca5:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  802ca7:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  802cae:	00 00 00 
+  802cb1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802cb4:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  802cb8:	bf 02 00 00 00       	mov    $0x2,%edi
+  802cbd:	48 b8 26 aa ff ff ff 	movabs $0xffffffffffffaa26,%rax
+  802cc4:	ff ff ff 
+  802cc7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ccb:	ff d0                	call   *%rax
+}
+  802ccd:	48 83 c4 10          	add    $0x10,%rsp
+  802cd1:	5b                   	pop    %rbx
+  802cd2:	41 5f                	pop    %r15
+  802cd4:	5d                   	pop    %rbp
+  802cd5:	c3                   	ret
+
+0000000000802cd6 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802cd6:	55                   	push   %rbp
+  802cd7:	48 89 e5             	mov    %rsp,%rbp
+  802cda:	48 83 ec 20          	sub    $0x20,%rsp
+  802cde:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802cde <nsipc_shutdown+0x8>
+  802ce5:	49 bb 5a 53 00 00 00 	movabs $0x535a,%r11
+  802cec:	00 00 00 
+  802cef:	4c 01 d8             	add    %r11,%rax
+  802cf2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802cf5:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  802cf8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802cfb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  802cfe:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d01:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  802d04:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  802d08:	ba 08 00 00 00       	mov    $0x8,%edx
+  802d0d:	48 89 ce             	mov    %rcx,%rsi
+  802d10:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d15:	48 b9 c9 aa ff ff ff 	movabs $0xffffffffffffaac9,%rcx
+  802d1c:	ff ff ff 
+  802d1f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802d23:	ff d0                	call   *%rax
+}
+  802d25:	c9                   	leave
+  802d26:	c3                   	ret
+
+0000000000802d27 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d27:	55                   	push   %rbp
+  802d28:	48 89 e5             	mov    %rsp,%rbp
+  802d2b:	48 83 ec 20          	sub    $0x20,%rsp
+  802d2f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d2f <nsipc_close+0x8>
+  802d36:	49 bb 09 53 00 00 00 	movabs $0x5309,%r11
+  802d3d:	00 00 00 
+  802d40:	4c 01 d8             	add    %r11,%rax
+  802d43:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  802d46:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802d49:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  802d4c:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  802d50:	ba 04 00 00 00       	mov    $0x4,%edx
+  802d55:	48 89 ce             	mov    %rcx,%rsi
+  802d58:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d5d:	48 b9 c9 aa ff ff ff 	movabs $0xffffffffffffaac9,%rcx
+  802d64:	ff ff ff 
+  802d67:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802d6b:	ff d0                	call   *%rax
+}
+  802d6d:	c9                   	leave
+  802d6e:	c3                   	ret
+
+0000000000802d6f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802d6f:	55                   	push   %rbp
+  802d70:	48 89 e5             	mov    %rsp,%rbp
+  802d73:	41 57                	push   %r15
+  802d75:	53                   	push   %rbx
+  802d76:	48 83 ec 10          	sub    $0x10,%rsp
+  802d7a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d7a <nsipc_connect+0xb>
+  802d81:	49 bb be 52 00 00 00 	movabs $0x52be,%r11
+  802d88:	00 00 00 
+  802d8b:	4c 01 db             	add    %r11,%rbx
+  802d8e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d91:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802d95:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  802d98:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  802d9f:	00 00 00 
+  802da2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802da5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802da8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802dab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802daf:	48 89 c6             	mov    %rax,%rsi
+  802db2:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  802db9:	00 00 00 
+  802dbc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dc0:	48 89 c7             	mov    %rax,%rdi
+  802dc3:	49 89 df             	mov    %rbx,%r15
+  802dc6:	48 b8 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rax
+  802dcd:	ff ff ff 
+  802dd0:	48 01 d8             	add    %rbx,%rax
+  802dd3:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  802dd5:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  802ddc:	00 00 00 
+  802ddf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802de2:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  802de6:	bf 05 00 00 00       	mov    $0x5,%edi
+  802deb:	48 b8 26 aa ff ff ff 	movabs $0xffffffffffffaa26,%rax
+  802df2:	ff ff ff 
+  802df5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802df9:	ff d0                	call   *%rax
+}
+  802dfb:	48 83 c4 10          	add    $0x10,%rsp
+  802dff:	5b                   	pop    %rbx
+  802e00:	41 5f                	pop    %r15
+  802e02:	5d                   	pop    %rbp
+  802e03:	c3                   	ret
+
+0000000000802e04 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e04:	55                   	push   %rbp
+  802e05:	48 89 e5             	mov    %rsp,%rbp
+  802e08:	48 83 ec 20          	sub    $0x20,%rsp
+  802e0c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e0c <nsipc_listen+0x8>
+  802e13:	49 bb 2c 52 00 00 00 	movabs $0x522c,%r11
+  802e1a:	00 00 00 
+  802e1d:	4c 01 d8             	add    %r11,%rax
+  802e20:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e23:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  802e26:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e29:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  802e2c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802e2f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  802e32:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  802e36:	ba 08 00 00 00       	mov    $0x8,%edx
+  802e3b:	48 89 ce             	mov    %rcx,%rsi
+  802e3e:	bf 06 00 00 00       	mov    $0x6,%edi
+  802e43:	48 b9 c9 aa ff ff ff 	movabs $0xffffffffffffaac9,%rcx
+  802e4a:	ff ff ff 
+  802e4d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802e51:	ff d0                	call   *%rax
+}
+  802e53:	c9                   	leave
+  802e54:	c3                   	ret
+
+0000000000802e55 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802e55:	55                   	push   %rbp
+  802e56:	48 89 e5             	mov    %rsp,%rbp
+  802e59:	41 57                	push   %r15
+  802e5b:	53                   	push   %rbx
+  802e5c:	48 83 ec 30          	sub    $0x30,%rsp
+  802e60:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e60 <nsipc_recv+0xb>
+  802e67:	49 bb d8 51 00 00 00 	movabs $0x51d8,%r11
+  802e6e:	00 00 00 
+  802e71:	4c 01 db             	add    %r11,%rbx
+  802e74:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e77:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802e7b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  802e7e:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802e81:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  802e88:	00 00 00 
+  802e8b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e8e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  802e91:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  802e98:	00 00 00 
+  802e9b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802e9e:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  802ea2:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  802ea9:	00 00 00 
+  802eac:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802eaf:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802eb3:	bf 07 00 00 00       	mov    $0x7,%edi
+  802eb8:	48 b8 26 aa ff ff ff 	movabs $0xffffffffffffaa26,%rax
+  802ebf:	ff ff ff 
+  802ec2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ec6:	ff d0                	call   *%rax
+  802ec8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ecb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ecf:	0f 88 91 00 00 00    	js     802f66 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  802ed5:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  802edc:	7f 08                	jg     802ee6 <nsipc_recv+0x91>
+  802ede:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ee1:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  802ee4:	7e 50                	jle    802f36 <nsipc_recv+0xe1>
+  802ee6:	48 b8 9b e0 ff ff ff 	movabs $0xffffffffffffe09b,%rax
+  802eed:	ff ff ff 
+  802ef0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ef4:	48 89 c1             	mov    %rax,%rcx
+  802ef7:	48 b8 b0 e0 ff ff ff 	movabs $0xffffffffffffe0b0,%rax
+  802efe:	ff ff ff 
+  802f01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f05:	48 89 c2             	mov    %rax,%rdx
+  802f08:	be 79 00 00 00       	mov    $0x79,%esi
+  802f0d:	48 b8 c5 e0 ff ff ff 	movabs $0xffffffffffffe0c5,%rax
+  802f14:	ff ff ff 
+  802f17:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f1b:	48 89 c7             	mov    %rax,%rdi
+  802f1e:	49 89 df             	mov    %rbx,%r15
+  802f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f26:	49 b8 cf bc ff ff ff 	movabs $0xffffffffffffbccf,%r8
+  802f2d:	ff ff ff 
+  802f30:	49 01 d8             	add    %rbx,%r8
+  802f33:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802f36:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f39:	48 63 d0             	movslq %eax,%rdx
+  802f3c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f40:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  802f47:	00 00 00 
+  802f4a:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  802f4e:	48 89 ce             	mov    %rcx,%rsi
+  802f51:	48 89 c7             	mov    %rax,%rdi
+  802f54:	49 89 df             	mov    %rbx,%r15
+  802f57:	48 b8 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rax
+  802f5e:	ff ff ff 
+  802f61:	48 01 d8             	add    %rbx,%rax
+  802f64:	ff d0                	call   *%rax
+	}
+
+	return r;
+  802f66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f69:	48 83 c4 30          	add    $0x30,%rsp
+  802f6d:	5b                   	pop    %rbx
+  802f6e:	41 5f                	pop    %r15
+  802f70:	5d                   	pop    %rbp
+  802f71:	c3                   	ret
+
+0000000000802f72 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f72:	55                   	push   %rbp
+  802f73:	48 89 e5             	mov    %rsp,%rbp
+  802f76:	41 57                	push   %r15
+  802f78:	53                   	push   %rbx
+  802f79:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  802f80:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f80 <nsipc_send+0xe>
+  802f87:	49 bb b8 50 00 00 00 	movabs $0x50b8,%r11
+  802f8e:	00 00 00 
+  802f91:	4c 01 db             	add    %r11,%rbx
+  802f94:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  802f9a:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  802fa1:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  802fa7:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  802fad:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  802fb1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  802fb5:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  802fbc:	00 00 00 
+  802fbf:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802fc2:	85 c0                	test   %eax,%eax
+  802fc4:	75 24                	jne    802fea <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802fc6:	bf 02 00 00 00       	mov    $0x2,%edi
+  802fcb:	49 89 df             	mov    %rbx,%r15
+  802fce:	48 b8 3a de ff ff ff 	movabs $0xffffffffffffde3a,%rax
+  802fd5:	ff ff ff 
+  802fd8:	48 01 d8             	add    %rbx,%rax
+  802fdb:	ff d0                	call   *%rax
+  802fdd:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  802fe4:	00 00 00 
+  802fe7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  802fea:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  802ff0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802ff3:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  802ffa:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802ffd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803000:	39 c2                	cmp    %eax,%edx
+  803002:	0f 4e c2             	cmovle %edx,%eax
+  803005:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  80300b:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  803011:	48 63 d0             	movslq %eax,%rdx
+  803014:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  80301b:	48 89 c6             	mov    %rax,%rsi
+  80301e:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803025:	00 00 00 
+  803028:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80302c:	48 89 c7             	mov    %rax,%rdi
+  80302f:	49 89 df             	mov    %rbx,%r15
+  803032:	48 b8 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rax
+  803039:	ff ff ff 
+  80303c:	48 01 d8             	add    %rbx,%rax
+  80303f:	ff d0                	call   *%rax
+	req->req_s = s;
+  803041:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803045:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80304b:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80304d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803051:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  803057:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  80305a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80305e:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  803064:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  803067:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80306e:	00 00 00 
+  803071:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803075:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  803079:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  803080:	00 
+  803081:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  803087:	48 63 d0             	movslq %eax,%rdx
+  80308a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80308e:	48 01 d0             	add    %rdx,%rax
+  803091:	48 83 e8 01          	sub    $0x1,%rax
+  803095:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  803099:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80309d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030a2:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8030a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030aa:	48 29 d0             	sub    %rdx,%rax
+  8030ad:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8030b3:	85 c0                	test   %eax,%eax
+  8030b5:	0f 48 c2             	cmovs  %edx,%eax
+  8030b8:	c1 f8 0c             	sar    $0xc,%eax
+  8030bb:	48 98                	cltq
+  8030bd:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8030c1:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8030c5:	48 85 c0             	test   %rax,%rax
+  8030c8:	0f 95 c0             	setne  %al
+  8030cb:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8030ce:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8030d5:	00 
+  8030d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030da:	48 83 c0 0b          	add    $0xb,%rax
+  8030de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030e2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030eb:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8030ef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030f3:	48 29 d0             	sub    %rdx,%rax
+  8030f6:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8030fa:	89 c7                	mov    %eax,%edi
+  8030fc:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  803103:	00 00 00 
+  803106:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803109:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80310d:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  803111:	48 83 ec 08          	sub    $0x8,%rsp
+  803115:	6a 00                	push   $0x0
+  803117:	6a 00                	push   $0x0
+  803119:	6a 05                	push   $0x5
+  80311b:	41 89 f1             	mov    %esi,%r9d
+  80311e:	49 89 c8             	mov    %rcx,%r8
+  803121:	89 f9                	mov    %edi,%ecx
+  803123:	be 08 00 00 00       	mov    $0x8,%esi
+  803128:	89 c7                	mov    %eax,%edi
+  80312a:	49 89 df             	mov    %rbx,%r15
+  80312d:	48 b8 42 da ff ff ff 	movabs $0xffffffffffffda42,%rax
+  803134:	ff ff ff 
+  803137:	48 01 d8             	add    %rbx,%rax
+  80313a:	ff d0                	call   *%rax
+  80313c:	48 83 c4 20          	add    $0x20,%rsp
+}
+  803140:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803144:	5b                   	pop    %rbx
+  803145:	41 5f                	pop    %r15
+  803147:	5d                   	pop    %rbp
+  803148:	c3                   	ret
+
+0000000000803149 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803149:	55                   	push   %rbp
+  80314a:	48 89 e5             	mov    %rsp,%rbp
+  80314d:	48 83 ec 10          	sub    $0x10,%rsp
+  803151:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803151 <nsipc_socket+0x8>
+  803158:	49 bb e7 4e 00 00 00 	movabs $0x4ee7,%r11
+  80315f:	00 00 00 
+  803162:	4c 01 d8             	add    %r11,%rax
+  803165:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803168:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  80316b:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  80316e:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  803175:	00 00 00 
+  803178:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80317b:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  80317e:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  803185:	00 00 00 
+  803188:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80318b:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  80318f:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  803196:	00 00 00 
+  803199:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80319c:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8031a0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8031a5:	48 ba 26 aa ff ff ff 	movabs $0xffffffffffffaa26,%rdx
+  8031ac:	ff ff ff 
+  8031af:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8031b3:	ff d0                	call   *%rax
+}
+  8031b5:	c9                   	leave
+  8031b6:	c3                   	ret
+
+00000000008031b7 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8031b7:	55                   	push   %rbp
+  8031b8:	48 89 e5             	mov    %rsp,%rbp
+  8031bb:	41 57                	push   %r15
+  8031bd:	53                   	push   %rbx
+  8031be:	48 83 ec 30          	sub    $0x30,%rsp
+  8031c2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031c2 <pipe+0xb>
+  8031c9:	49 bb 76 4e 00 00 00 	movabs $0x4e76,%r11
+  8031d0:	00 00 00 
+  8031d3:	4c 01 db             	add    %r11,%rbx
+  8031d6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8031da:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8031de:	48 89 c7             	mov    %rax,%rdi
+  8031e1:	49 89 df             	mov    %rbx,%r15
+  8031e4:	48 b8 40 8e ff ff ff 	movabs $0xffffffffffff8e40,%rax
+  8031eb:	ff ff ff 
+  8031ee:	48 01 d8             	add    %rbx,%rax
+  8031f1:	ff d0                	call   *%rax
+  8031f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031fa:	0f 88 12 02 00 00    	js     803412 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803200:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803204:	ba 07 04 00 00       	mov    $0x407,%edx
+  803209:	48 89 c6             	mov    %rax,%rsi
+  80320c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803211:	49 89 df             	mov    %rbx,%r15
+  803214:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  80321b:	ff ff ff 
+  80321e:	48 01 d8             	add    %rbx,%rax
+  803221:	ff d0                	call   *%rax
+  803223:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803226:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80322a:	0f 88 e2 01 00 00    	js     803412 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  803230:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803234:	48 89 c7             	mov    %rax,%rdi
+  803237:	49 89 df             	mov    %rbx,%r15
+  80323a:	48 b8 40 8e ff ff ff 	movabs $0xffffffffffff8e40,%rax
+  803241:	ff ff ff 
+  803244:	48 01 d8             	add    %rbx,%rax
+  803247:	ff d0                	call   *%rax
+  803249:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80324c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803250:	0f 88 9b 01 00 00    	js     8033f1 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803256:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80325a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80325f:	48 89 c6             	mov    %rax,%rsi
+  803262:	bf 00 00 00 00       	mov    $0x0,%edi
+  803267:	49 89 df             	mov    %rbx,%r15
+  80326a:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  803271:	ff ff ff 
+  803274:	48 01 d8             	add    %rbx,%rax
+  803277:	ff d0                	call   *%rax
+  803279:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80327c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803280:	0f 88 6b 01 00 00    	js     8033f1 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  803286:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80328a:	48 89 c7             	mov    %rax,%rdi
+  80328d:	49 89 df             	mov    %rbx,%r15
+  803290:	48 b8 fd 8d ff ff ff 	movabs $0xffffffffffff8dfd,%rax
+  803297:	ff ff ff 
+  80329a:	48 01 d8             	add    %rbx,%rax
+  80329d:	ff d0                	call   *%rax
+  80329f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032a7:	ba 07 04 00 00       	mov    $0x407,%edx
+  8032ac:	48 89 c6             	mov    %rax,%rsi
+  8032af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b4:	49 89 df             	mov    %rbx,%r15
+  8032b7:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  8032be:	ff ff ff 
+  8032c1:	48 01 d8             	add    %rbx,%rax
+  8032c4:	ff d0                	call   *%rax
+  8032c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032cd:	0f 88 fd 00 00 00    	js     8033d0 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032d3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032d7:	48 89 c7             	mov    %rax,%rdi
+  8032da:	49 89 df             	mov    %rbx,%r15
+  8032dd:	48 b8 fd 8d ff ff ff 	movabs $0xffffffffffff8dfd,%rax
+  8032e4:	ff ff ff 
+  8032e7:	48 01 d8             	add    %rbx,%rax
+  8032ea:	ff d0                	call   *%rax
+  8032ec:	48 89 c2             	mov    %rax,%rdx
+  8032ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032f3:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8032f9:	48 89 d1             	mov    %rdx,%rcx
+  8032fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803301:	48 89 c6             	mov    %rax,%rsi
+  803304:	bf 00 00 00 00       	mov    $0x0,%edi
+  803309:	49 89 df             	mov    %rbx,%r15
+  80330c:	48 b8 fa 85 ff ff ff 	movabs $0xffffffffffff85fa,%rax
+  803313:	ff ff ff 
+  803316:	48 01 d8             	add    %rbx,%rax
+  803319:	ff d0                	call   *%rax
+  80331b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80331e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803322:	0f 88 87 00 00 00    	js     8033af <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  803328:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80332c:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  803333:	00 00 00 
+  803336:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803339:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  80333b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80333f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  803346:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80334a:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  803351:	00 00 00 
+  803354:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803357:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  803359:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80335d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  803364:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803368:	48 89 c7             	mov    %rax,%rdi
+  80336b:	49 89 df             	mov    %rbx,%r15
+  80336e:	48 b8 c6 8d ff ff ff 	movabs $0xffffffffffff8dc6,%rax
+  803375:	ff ff ff 
+  803378:	48 01 d8             	add    %rbx,%rax
+  80337b:	ff d0                	call   *%rax
+  80337d:	89 c2                	mov    %eax,%edx
+  80337f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803383:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  803385:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803389:	48 89 c7             	mov    %rax,%rdi
+  80338c:	49 89 df             	mov    %rbx,%r15
+  80338f:	48 b8 c6 8d ff ff ff 	movabs $0xffffffffffff8dc6,%rax
+  803396:	ff ff ff 
+  803399:	48 01 d8             	add    %rbx,%rax
+  80339c:	ff d0                	call   *%rax
+  80339e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8033a2:	48 83 c2 04          	add    $0x4,%rdx
+  8033a6:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  8033a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ad:	eb 67                	jmp    803416 <pipe+0x25f>
+		goto err3;
+  8033af:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  8033b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033b4:	48 89 c6             	mov    %rax,%rsi
+  8033b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033bc:	49 89 df             	mov    %rbx,%r15
+  8033bf:	48 b8 6d 86 ff ff ff 	movabs $0xffffffffffff866d,%rax
+  8033c6:	ff ff ff 
+  8033c9:	48 01 d8             	add    %rbx,%rax
+  8033cc:	ff d0                	call   *%rax
+  8033ce:	eb 01                	jmp    8033d1 <pipe+0x21a>
+		goto err2;
+  8033d0:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  8033d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033d5:	48 89 c6             	mov    %rax,%rsi
+  8033d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033dd:	49 89 df             	mov    %rbx,%r15
+  8033e0:	48 b8 6d 86 ff ff ff 	movabs $0xffffffffffff866d,%rax
+  8033e7:	ff ff ff 
+  8033ea:	48 01 d8             	add    %rbx,%rax
+  8033ed:	ff d0                	call   *%rax
+  8033ef:	eb 01                	jmp    8033f2 <pipe+0x23b>
+		goto err1;
+  8033f1:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8033f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033f6:	48 89 c6             	mov    %rax,%rsi
+  8033f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033fe:	49 89 df             	mov    %rbx,%r15
+  803401:	48 b8 6d 86 ff ff ff 	movabs $0xffffffffffff866d,%rax
+  803408:	ff ff ff 
+  80340b:	48 01 d8             	add    %rbx,%rax
+  80340e:	ff d0                	call   *%rax
+  803410:	eb 01                	jmp    803413 <pipe+0x25c>
+		goto err;
+  803412:	90                   	nop
+err:
+	return r;
+  803413:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803416:	48 83 c4 30          	add    $0x30,%rsp
+  80341a:	5b                   	pop    %rbx
+  80341b:	41 5f                	pop    %r15
+  80341d:	5d                   	pop    %rbp
+  80341e:	c3                   	ret
+
+000000000080341f <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80341f:	55                   	push   %rbp
+  803420:	48 89 e5             	mov    %rsp,%rbp
+  803423:	41 57                	push   %r15
+  803425:	41 54                	push   %r12
+  803427:	53                   	push   %rbx
+  803428:	48 83 ec 28          	sub    $0x28,%rsp
+  80342c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80342c <_pipeisclosed+0xd>
+  803433:	49 bb 0c 4c 00 00 00 	movabs $0x4c0c,%r11
+  80343a:	00 00 00 
+  80343d:	4c 01 db             	add    %r11,%rbx
+  803440:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803444:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803448:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80344f:	ff ff ff 
+  803452:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803456:	48 8b 00             	mov    (%rax),%rax
+  803459:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80345f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  803462:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803466:	48 89 c7             	mov    %rax,%rdi
+  803469:	49 89 df             	mov    %rbx,%r15
+  80346c:	48 b8 c9 de ff ff ff 	movabs $0xffffffffffffdec9,%rax
+  803473:	ff ff ff 
+  803476:	48 01 d8             	add    %rbx,%rax
+  803479:	ff d0                	call   *%rax
+  80347b:	41 89 c4             	mov    %eax,%r12d
+  80347e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803482:	48 89 c7             	mov    %rax,%rdi
+  803485:	49 89 df             	mov    %rbx,%r15
+  803488:	48 b8 c9 de ff ff ff 	movabs $0xffffffffffffdec9,%rax
+  80348f:	ff ff ff 
+  803492:	48 01 d8             	add    %rbx,%rax
+  803495:	ff d0                	call   *%rax
+  803497:	41 39 c4             	cmp    %eax,%r12d
+  80349a:	0f 94 c0             	sete   %al
+  80349d:	0f b6 c0             	movzbl %al,%eax
+  8034a0:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  8034a3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8034aa:	ff ff ff 
+  8034ad:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034b1:	48 8b 00             	mov    (%rax),%rax
+  8034b4:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8034ba:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  8034bd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034c0:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8034c3:	75 05                	jne    8034ca <_pipeisclosed+0xab>
+			return ret;
+  8034c5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8034c8:	eb 63                	jmp    80352d <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  8034ca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034cd:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8034d0:	0f 84 72 ff ff ff    	je     803448 <_pipeisclosed+0x29>
+  8034d6:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  8034da:	0f 85 68 ff ff ff    	jne    803448 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8034e0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8034e7:	ff ff ff 
+  8034ea:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034ee:	48 8b 00             	mov    (%rax),%rax
+  8034f1:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8034f7:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8034fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034fd:	89 c6                	mov    %eax,%esi
+  8034ff:	48 b8 d6 e0 ff ff ff 	movabs $0xffffffffffffe0d6,%rax
+  803506:	ff ff ff 
+  803509:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80350d:	48 89 c7             	mov    %rax,%rdi
+  803510:	49 89 df             	mov    %rbx,%r15
+  803513:	b8 00 00 00 00       	mov    $0x0,%eax
+  803518:	49 b8 a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%r8
+  80351f:	ff ff ff 
+  803522:	49 01 d8             	add    %rbx,%r8
+  803525:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  803528:	e9 1b ff ff ff       	jmp    803448 <_pipeisclosed+0x29>
+	}
+}
+  80352d:	48 83 c4 28          	add    $0x28,%rsp
+  803531:	5b                   	pop    %rbx
+  803532:	41 5c                	pop    %r12
+  803534:	41 5f                	pop    %r15
+  803536:	5d                   	pop    %rbp
+  803537:	c3                   	ret
+
+0000000000803538 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  803538:	55                   	push   %rbp
+  803539:	48 89 e5             	mov    %rsp,%rbp
+  80353c:	41 57                	push   %r15
+  80353e:	53                   	push   %rbx
+  80353f:	48 83 ec 30          	sub    $0x30,%rsp
+  803543:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803543 <pipeisclosed+0xb>
+  80354a:	49 bb f5 4a 00 00 00 	movabs $0x4af5,%r11
+  803551:	00 00 00 
+  803554:	4c 01 db             	add    %r11,%rbx
+  803557:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80355a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80355e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803561:	48 89 d6             	mov    %rdx,%rsi
+  803564:	89 c7                	mov    %eax,%edi
+  803566:	49 89 df             	mov    %rbx,%r15
+  803569:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  803570:	ff ff ff 
+  803573:	48 01 d8             	add    %rbx,%rax
+  803576:	ff d0                	call   *%rax
+  803578:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80357b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80357f:	79 05                	jns    803586 <pipeisclosed+0x4e>
+		return r;
+  803581:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803584:	eb 3b                	jmp    8035c1 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  803586:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80358a:	48 89 c7             	mov    %rax,%rdi
+  80358d:	49 89 df             	mov    %rbx,%r15
+  803590:	48 b8 fd 8d ff ff ff 	movabs $0xffffffffffff8dfd,%rax
+  803597:	ff ff ff 
+  80359a:	48 01 d8             	add    %rbx,%rax
+  80359d:	ff d0                	call   *%rax
+  80359f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  8035a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035a7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035ab:	48 89 d6             	mov    %rdx,%rsi
+  8035ae:	48 89 c7             	mov    %rax,%rdi
+  8035b1:	48 b8 e7 b3 ff ff ff 	movabs $0xffffffffffffb3e7,%rax
+  8035b8:	ff ff ff 
+  8035bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035bf:	ff d0                	call   *%rax
+}
+  8035c1:	48 83 c4 30          	add    $0x30,%rsp
+  8035c5:	5b                   	pop    %rbx
+  8035c6:	41 5f                	pop    %r15
+  8035c8:	5d                   	pop    %rbp
+  8035c9:	c3                   	ret
+
+00000000008035ca <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8035ca:	55                   	push   %rbp
+  8035cb:	48 89 e5             	mov    %rsp,%rbp
+  8035ce:	41 57                	push   %r15
+  8035d0:	53                   	push   %rbx
+  8035d1:	48 83 ec 40          	sub    $0x40,%rsp
+  8035d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035d5 <devpipe_read+0xb>
+  8035dc:	49 bb 63 4a 00 00 00 	movabs $0x4a63,%r11
+  8035e3:	00 00 00 
+  8035e6:	4c 01 db             	add    %r11,%rbx
+  8035e9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8035ed:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8035f1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8035f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035f9:	48 89 c7             	mov    %rax,%rdi
+  8035fc:	49 89 df             	mov    %rbx,%r15
+  8035ff:	48 b8 fd 8d ff ff ff 	movabs $0xffffffffffff8dfd,%rax
+  803606:	ff ff ff 
+  803609:	48 01 d8             	add    %rbx,%rax
+  80360c:	ff d0                	call   *%rax
+  80360e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  803612:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803616:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80361a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803621:	00 
+  803622:	e9 a1 00 00 00       	jmp    8036c8 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  803627:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80362c:	74 09                	je     803637 <devpipe_read+0x6d>
+				return i;
+  80362e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803632:	e9 9f 00 00 00       	jmp    8036d6 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  803637:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80363b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80363f:	48 89 d6             	mov    %rdx,%rsi
+  803642:	48 89 c7             	mov    %rax,%rdi
+  803645:	48 b8 e7 b3 ff ff ff 	movabs $0xffffffffffffb3e7,%rax
+  80364c:	ff ff ff 
+  80364f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803653:	ff d0                	call   *%rax
+  803655:	85 c0                	test   %eax,%eax
+  803657:	74 07                	je     803660 <devpipe_read+0x96>
+				return 0;
+  803659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80365e:	eb 76                	jmp    8036d6 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  803660:	49 89 df             	mov    %rbx,%r15
+  803663:	48 b8 40 85 ff ff ff 	movabs $0xffffffffffff8540,%rax
+  80366a:	ff ff ff 
+  80366d:	48 01 d8             	add    %rbx,%rax
+  803670:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  803672:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803676:	8b 10                	mov    (%rax),%edx
+  803678:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80367c:	8b 40 04             	mov    0x4(%rax),%eax
+  80367f:	39 c2                	cmp    %eax,%edx
+  803681:	74 a4                	je     803627 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803683:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803687:	8b 10                	mov    (%rax),%edx
+  803689:	89 d0                	mov    %edx,%eax
+  80368b:	c1 f8 1f             	sar    $0x1f,%eax
+  80368e:	c1 e8 1b             	shr    $0x1b,%eax
+  803691:	01 c2                	add    %eax,%edx
+  803693:	83 e2 1f             	and    $0x1f,%edx
+  803696:	29 c2                	sub    %eax,%edx
+  803698:	89 d6                	mov    %edx,%esi
+  80369a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80369e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036a2:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8036a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036aa:	48 63 c6             	movslq %esi,%rax
+  8036ad:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  8036b2:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  8036b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036b8:	8b 00                	mov    (%rax),%eax
+  8036ba:	8d 50 01             	lea    0x1(%rax),%edx
+  8036bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036c1:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  8036c3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8036c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036cc:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8036d0:	72 a0                	jb     803672 <devpipe_read+0xa8>
+	}
+	return i;
+  8036d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8036d6:	48 83 c4 40          	add    $0x40,%rsp
+  8036da:	5b                   	pop    %rbx
+  8036db:	41 5f                	pop    %r15
+  8036dd:	5d                   	pop    %rbp
+  8036de:	c3                   	ret
+
+00000000008036df <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8036df:	55                   	push   %rbp
+  8036e0:	48 89 e5             	mov    %rsp,%rbp
+  8036e3:	41 57                	push   %r15
+  8036e5:	53                   	push   %rbx
+  8036e6:	48 83 ec 40          	sub    $0x40,%rsp
+  8036ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036ea <devpipe_write+0xb>
+  8036f1:	49 bb 4e 49 00 00 00 	movabs $0x494e,%r11
+  8036f8:	00 00 00 
+  8036fb:	4c 01 db             	add    %r11,%rbx
+  8036fe:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803702:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803706:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80370a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80370e:	48 89 c7             	mov    %rax,%rdi
+  803711:	49 89 df             	mov    %rbx,%r15
+  803714:	48 b8 fd 8d ff ff ff 	movabs $0xffffffffffff8dfd,%rax
+  80371b:	ff ff ff 
+  80371e:	48 01 d8             	add    %rbx,%rax
+  803721:	ff d0                	call   *%rax
+  803723:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  803727:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80372b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80372f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803736:	00 
+  803737:	e9 a0 00 00 00       	jmp    8037dc <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80373c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803740:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803744:	48 89 d6             	mov    %rdx,%rsi
+  803747:	48 89 c7             	mov    %rax,%rdi
+  80374a:	48 b8 e7 b3 ff ff ff 	movabs $0xffffffffffffb3e7,%rax
+  803751:	ff ff ff 
+  803754:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803758:	ff d0                	call   *%rax
+  80375a:	85 c0                	test   %eax,%eax
+  80375c:	74 0a                	je     803768 <devpipe_write+0x89>
+				return 0;
+  80375e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803763:	e9 82 00 00 00       	jmp    8037ea <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  803768:	49 89 df             	mov    %rbx,%r15
+  80376b:	48 b8 40 85 ff ff ff 	movabs $0xffffffffffff8540,%rax
+  803772:	ff ff ff 
+  803775:	48 01 d8             	add    %rbx,%rax
+  803778:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80377a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80377e:	8b 40 04             	mov    0x4(%rax),%eax
+  803781:	48 63 d0             	movslq %eax,%rdx
+  803784:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803788:	8b 00                	mov    (%rax),%eax
+  80378a:	48 98                	cltq
+  80378c:	48 83 c0 20          	add    $0x20,%rax
+  803790:	48 39 c2             	cmp    %rax,%rdx
+  803793:	73 a7                	jae    80373c <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803795:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803799:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80379d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8037a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037a5:	8b 50 04             	mov    0x4(%rax),%edx
+  8037a8:	89 d0                	mov    %edx,%eax
+  8037aa:	c1 f8 1f             	sar    $0x1f,%eax
+  8037ad:	c1 e8 1b             	shr    $0x1b,%eax
+  8037b0:	01 c2                	add    %eax,%edx
+  8037b2:	83 e2 1f             	and    $0x1f,%edx
+  8037b5:	29 c2                	sub    %eax,%edx
+  8037b7:	89 d0                	mov    %edx,%eax
+  8037b9:	0f b6 09             	movzbl (%rcx),%ecx
+  8037bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037c0:	48 98                	cltq
+  8037c2:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  8037c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037ca:	8b 40 04             	mov    0x4(%rax),%eax
+  8037cd:	8d 50 01             	lea    0x1(%rax),%edx
+  8037d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037d4:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8037d7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8037dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037e0:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8037e4:	72 94                	jb     80377a <devpipe_write+0x9b>
+	}
+
+	return i;
+  8037e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8037ea:	48 83 c4 40          	add    $0x40,%rsp
+  8037ee:	5b                   	pop    %rbx
+  8037ef:	41 5f                	pop    %r15
+  8037f1:	5d                   	pop    %rbp
+  8037f2:	c3                   	ret
+
+00000000008037f3 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8037f3:	55                   	push   %rbp
+  8037f4:	48 89 e5             	mov    %rsp,%rbp
+  8037f7:	41 57                	push   %r15
+  8037f9:	53                   	push   %rbx
+  8037fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8037fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037fe <devpipe_stat+0xb>
+  803805:	49 bb 3a 48 00 00 00 	movabs $0x483a,%r11
+  80380c:	00 00 00 
+  80380f:	4c 01 db             	add    %r11,%rbx
+  803812:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803816:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80381a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80381e:	48 89 c7             	mov    %rax,%rdi
+  803821:	49 89 df             	mov    %rbx,%r15
+  803824:	48 b8 fd 8d ff ff ff 	movabs $0xffffffffffff8dfd,%rax
+  80382b:	ff ff ff 
+  80382e:	48 01 d8             	add    %rbx,%rax
+  803831:	ff d0                	call   *%rax
+  803833:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  803837:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80383b:	48 ba e9 e0 ff ff ff 	movabs $0xffffffffffffe0e9,%rdx
+  803842:	ff ff ff 
+  803845:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803849:	48 89 d6             	mov    %rdx,%rsi
+  80384c:	48 89 c7             	mov    %rax,%rdi
+  80384f:	49 89 df             	mov    %rbx,%r15
+  803852:	48 b8 68 cd ff ff ff 	movabs $0xffffffffffffcd68,%rax
+  803859:	ff ff ff 
+  80385c:	48 01 d8             	add    %rbx,%rax
+  80385f:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803861:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803865:	8b 50 04             	mov    0x4(%rax),%edx
+  803868:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80386c:	8b 00                	mov    (%rax),%eax
+  80386e:	29 c2                	sub    %eax,%edx
+  803870:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803874:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  80387a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80387e:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803885:	00 00 00 
+	stat->st_dev = &devpipe;
+  803888:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80388c:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  803893:	00 00 00 
+  803896:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80389a:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8038a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038a6:	48 83 c4 20          	add    $0x20,%rsp
+  8038aa:	5b                   	pop    %rbx
+  8038ab:	41 5f                	pop    %r15
+  8038ad:	5d                   	pop    %rbp
+  8038ae:	c3                   	ret
+
+00000000008038af <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8038af:	55                   	push   %rbp
+  8038b0:	48 89 e5             	mov    %rsp,%rbp
+  8038b3:	41 57                	push   %r15
+  8038b5:	53                   	push   %rbx
+  8038b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8038ba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038ba <devpipe_close+0xb>
+  8038c1:	49 bb 7e 47 00 00 00 	movabs $0x477e,%r11
+  8038c8:	00 00 00 
+  8038cb:	4c 01 db             	add    %r11,%rbx
+  8038ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8038d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038d6:	48 89 c6             	mov    %rax,%rsi
+  8038d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038de:	49 89 df             	mov    %rbx,%r15
+  8038e1:	48 b8 6d 86 ff ff ff 	movabs $0xffffffffffff866d,%rax
+  8038e8:	ff ff ff 
+  8038eb:	48 01 d8             	add    %rbx,%rax
+  8038ee:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8038f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038f4:	48 89 c7             	mov    %rax,%rdi
+  8038f7:	49 89 df             	mov    %rbx,%r15
+  8038fa:	48 b8 fd 8d ff ff ff 	movabs $0xffffffffffff8dfd,%rax
+  803901:	ff ff ff 
+  803904:	48 01 d8             	add    %rbx,%rax
+  803907:	ff d0                	call   *%rax
+  803909:	48 89 c6             	mov    %rax,%rsi
+  80390c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803911:	49 89 df             	mov    %rbx,%r15
+  803914:	48 b8 6d 86 ff ff ff 	movabs $0xffffffffffff866d,%rax
+  80391b:	ff ff ff 
+  80391e:	48 01 d8             	add    %rbx,%rax
+  803921:	ff d0                	call   *%rax
+}
+  803923:	48 83 c4 10          	add    $0x10,%rsp
+  803927:	5b                   	pop    %rbx
+  803928:	41 5f                	pop    %r15
+  80392a:	5d                   	pop    %rbp
+  80392b:	c3                   	ret
+
+000000000080392c <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80392c:	55                   	push   %rbp
+  80392d:	48 89 e5             	mov    %rsp,%rbp
+  803930:	41 57                	push   %r15
+  803932:	48 83 ec 28          	sub    $0x28,%rsp
+  803936:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803936 <cputchar+0xa>
+  80393d:	49 bb 02 47 00 00 00 	movabs $0x4702,%r11
+  803944:	00 00 00 
+  803947:	4c 01 d8             	add    %r11,%rax
+  80394a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80394d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803950:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  803953:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  803957:	be 01 00 00 00       	mov    $0x1,%esi
+  80395c:	48 89 d7             	mov    %rdx,%rdi
+  80395f:	49 89 c7             	mov    %rax,%r15
+  803962:	48 ba dd 83 ff ff ff 	movabs $0xffffffffffff83dd,%rdx
+  803969:	ff ff ff 
+  80396c:	48 01 c2             	add    %rax,%rdx
+  80396f:	ff d2                	call   *%rdx
+}
+  803971:	90                   	nop
+  803972:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803976:	c9                   	leave
+  803977:	c3                   	ret
+
+0000000000803978 <getchar>:
+
+int
+getchar(void)
+{
+  803978:	55                   	push   %rbp
+  803979:	48 89 e5             	mov    %rsp,%rbp
+  80397c:	41 57                	push   %r15
+  80397e:	48 83 ec 18          	sub    $0x18,%rsp
+  803982:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803982 <getchar+0xa>
+  803989:	49 bb b6 46 00 00 00 	movabs $0x46b6,%r11
+  803990:	00 00 00 
+  803993:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  803996:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80399a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80399f:	48 89 ce             	mov    %rcx,%rsi
+  8039a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039a7:	49 89 c7             	mov    %rax,%r15
+  8039aa:	48 b9 3d 94 ff ff ff 	movabs $0xffffffffffff943d,%rcx
+  8039b1:	ff ff ff 
+  8039b4:	48 01 c1             	add    %rax,%rcx
+  8039b7:	ff d1                	call   *%rcx
+  8039b9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8039bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039c0:	79 05                	jns    8039c7 <getchar+0x4f>
+		return r;
+  8039c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039c5:	eb 14                	jmp    8039db <getchar+0x63>
+	if (r < 1)
+  8039c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039cb:	7f 07                	jg     8039d4 <getchar+0x5c>
+		return -E_EOF;
+  8039cd:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8039d2:	eb 07                	jmp    8039db <getchar+0x63>
+	return c;
+  8039d4:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8039d8:	0f b6 c0             	movzbl %al,%eax
+}
+  8039db:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8039df:	c9                   	leave
+  8039e0:	c3                   	ret
+
+00000000008039e1 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8039e1:	55                   	push   %rbp
+  8039e2:	48 89 e5             	mov    %rsp,%rbp
+  8039e5:	41 57                	push   %r15
+  8039e7:	53                   	push   %rbx
+  8039e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8039ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039ec <iscons+0xb>
+  8039f3:	49 bb 4c 46 00 00 00 	movabs $0x464c,%r11
+  8039fa:	00 00 00 
+  8039fd:	4c 01 db             	add    %r11,%rbx
+  803a00:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803a03:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803a07:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a0a:	48 89 d6             	mov    %rdx,%rsi
+  803a0d:	89 c7                	mov    %eax,%edi
+  803a0f:	49 89 df             	mov    %rbx,%r15
+  803a12:	48 b8 f6 8e ff ff ff 	movabs $0xffffffffffff8ef6,%rax
+  803a19:	ff ff ff 
+  803a1c:	48 01 d8             	add    %rbx,%rax
+  803a1f:	ff d0                	call   *%rax
+  803a21:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a24:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a28:	79 05                	jns    803a2f <iscons+0x4e>
+		return r;
+  803a2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a2d:	eb 1b                	jmp    803a4a <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  803a2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a33:	8b 10                	mov    (%rax),%edx
+  803a35:	48 b8 08 01 00 00 00 	movabs $0x108,%rax
+  803a3c:	00 00 00 
+  803a3f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803a42:	39 c2                	cmp    %eax,%edx
+  803a44:	0f 94 c0             	sete   %al
+  803a47:	0f b6 c0             	movzbl %al,%eax
+}
+  803a4a:	48 83 c4 20          	add    $0x20,%rsp
+  803a4e:	5b                   	pop    %rbx
+  803a4f:	41 5f                	pop    %r15
+  803a51:	5d                   	pop    %rbp
+  803a52:	c3                   	ret
+
+0000000000803a53 <opencons>:
+
+int
+opencons(void)
+{
+  803a53:	55                   	push   %rbp
+  803a54:	48 89 e5             	mov    %rsp,%rbp
+  803a57:	41 57                	push   %r15
+  803a59:	53                   	push   %rbx
+  803a5a:	48 83 ec 10          	sub    $0x10,%rsp
+  803a5e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a5e <opencons+0xb>
+  803a65:	49 bb da 45 00 00 00 	movabs $0x45da,%r11
+  803a6c:	00 00 00 
+  803a6f:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  803a72:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803a76:	48 89 c7             	mov    %rax,%rdi
+  803a79:	49 89 df             	mov    %rbx,%r15
+  803a7c:	48 b8 40 8e ff ff ff 	movabs $0xffffffffffff8e40,%rax
+  803a83:	ff ff ff 
+  803a86:	48 01 d8             	add    %rbx,%rax
+  803a89:	ff d0                	call   *%rax
+  803a8b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a8e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a92:	79 05                	jns    803a99 <opencons+0x46>
+		return r;
+  803a94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a97:	eb 68                	jmp    803b01 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803a99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a9d:	ba 07 04 00 00       	mov    $0x407,%edx
+  803aa2:	48 89 c6             	mov    %rax,%rsi
+  803aa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aaa:	49 89 df             	mov    %rbx,%r15
+  803aad:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  803ab4:	ff ff ff 
+  803ab7:	48 01 d8             	add    %rbx,%rax
+  803aba:	ff d0                	call   *%rax
+  803abc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803abf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ac3:	79 05                	jns    803aca <opencons+0x77>
+		return r;
+  803ac5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ac8:	eb 37                	jmp    803b01 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  803aca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ace:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  803ad5:	00 00 00 
+  803ad8:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803adb:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  803add:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ae1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  803ae8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803aec:	48 89 c7             	mov    %rax,%rdi
+  803aef:	49 89 df             	mov    %rbx,%r15
+  803af2:	48 b8 c6 8d ff ff ff 	movabs $0xffffffffffff8dc6,%rax
+  803af9:	ff ff ff 
+  803afc:	48 01 d8             	add    %rbx,%rax
+  803aff:	ff d0                	call   *%rax
+}
+  803b01:	48 83 c4 10          	add    $0x10,%rsp
+  803b05:	5b                   	pop    %rbx
+  803b06:	41 5f                	pop    %r15
+  803b08:	5d                   	pop    %rbp
+  803b09:	c3                   	ret
+
+0000000000803b0a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  803b0a:	55                   	push   %rbp
+  803b0b:	48 89 e5             	mov    %rsp,%rbp
+  803b0e:	41 57                	push   %r15
+  803b10:	53                   	push   %rbx
+  803b11:	48 83 ec 30          	sub    $0x30,%rsp
+  803b15:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b15 <devcons_read+0xb>
+  803b1c:	49 bb 23 45 00 00 00 	movabs $0x4523,%r11
+  803b23:	00 00 00 
+  803b26:	4c 01 db             	add    %r11,%rbx
+  803b29:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803b2d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803b31:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  803b35:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803b3a:	75 19                	jne    803b55 <devcons_read+0x4b>
+		return 0;
+  803b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b41:	eb 55                	jmp    803b98 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  803b43:	49 89 df             	mov    %rbx,%r15
+  803b46:	48 b8 40 85 ff ff ff 	movabs $0xffffffffffff8540,%rax
+  803b4d:	ff ff ff 
+  803b50:	48 01 d8             	add    %rbx,%rax
+  803b53:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  803b55:	49 89 df             	mov    %rbx,%r15
+  803b58:	48 b8 3c 84 ff ff ff 	movabs $0xffffffffffff843c,%rax
+  803b5f:	ff ff ff 
+  803b62:	48 01 d8             	add    %rbx,%rax
+  803b65:	ff d0                	call   *%rax
+  803b67:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b6a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b6e:	74 d3                	je     803b43 <devcons_read+0x39>
+	if (c < 0)
+  803b70:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b74:	79 05                	jns    803b7b <devcons_read+0x71>
+		return c;
+  803b76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b79:	eb 1d                	jmp    803b98 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  803b7b:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  803b7f:	75 07                	jne    803b88 <devcons_read+0x7e>
+		return 0;
+  803b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b86:	eb 10                	jmp    803b98 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  803b88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b8b:	89 c2                	mov    %eax,%edx
+  803b8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b91:	88 10                	mov    %dl,(%rax)
+	return 1;
+  803b93:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803b98:	48 83 c4 30          	add    $0x30,%rsp
+  803b9c:	5b                   	pop    %rbx
+  803b9d:	41 5f                	pop    %r15
+  803b9f:	5d                   	pop    %rbp
+  803ba0:	c3                   	ret
+
+0000000000803ba1 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  803ba1:	55                   	push   %rbp
+  803ba2:	48 89 e5             	mov    %rsp,%rbp
+  803ba5:	41 57                	push   %r15
+  803ba7:	53                   	push   %rbx
+  803ba8:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  803baf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803baf <devcons_write+0xe>
+  803bb6:	49 bb 89 44 00 00 00 	movabs $0x4489,%r11
+  803bbd:	00 00 00 
+  803bc0:	4c 01 db             	add    %r11,%rbx
+  803bc3:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  803bca:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  803bd1:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  803bd8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803bdf:	e9 80 00 00 00       	jmp    803c64 <devcons_write+0xc3>
+		m = n - tot;
+  803be4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803beb:	89 c2                	mov    %eax,%edx
+  803bed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bf0:	29 c2                	sub    %eax,%edx
+  803bf2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  803bf5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803bf8:	83 f8 7f             	cmp    $0x7f,%eax
+  803bfb:	76 07                	jbe    803c04 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  803bfd:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  803c04:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803c07:	48 63 d0             	movslq %eax,%rdx
+  803c0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c0d:	48 63 c8             	movslq %eax,%rcx
+  803c10:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  803c17:	48 01 c1             	add    %rax,%rcx
+  803c1a:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  803c21:	48 89 ce             	mov    %rcx,%rsi
+  803c24:	48 89 c7             	mov    %rax,%rdi
+  803c27:	49 89 df             	mov    %rbx,%r15
+  803c2a:	48 b8 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rax
+  803c31:	ff ff ff 
+  803c34:	48 01 d8             	add    %rbx,%rax
+  803c37:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  803c39:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803c3c:	48 63 d0             	movslq %eax,%rdx
+  803c3f:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  803c46:	48 89 d6             	mov    %rdx,%rsi
+  803c49:	48 89 c7             	mov    %rax,%rdi
+  803c4c:	49 89 df             	mov    %rbx,%r15
+  803c4f:	48 b8 dd 83 ff ff ff 	movabs $0xffffffffffff83dd,%rax
+  803c56:	ff ff ff 
+  803c59:	48 01 d8             	add    %rbx,%rax
+  803c5c:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  803c5e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803c61:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803c64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c67:	48 98                	cltq
+  803c69:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  803c70:	0f 82 6e ff ff ff    	jb     803be4 <devcons_write+0x43>
+	}
+	return tot;
+  803c76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803c79:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  803c80:	5b                   	pop    %rbx
+  803c81:	41 5f                	pop    %r15
+  803c83:	5d                   	pop    %rbp
+  803c84:	c3                   	ret
+
+0000000000803c85 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  803c85:	55                   	push   %rbp
+  803c86:	48 89 e5             	mov    %rsp,%rbp
+  803c89:	48 83 ec 08          	sub    $0x8,%rsp
+  803c8d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c8d <devcons_close+0x8>
+  803c94:	49 bb ab 43 00 00 00 	movabs $0x43ab,%r11
+  803c9b:	00 00 00 
+  803c9e:	4c 01 d8             	add    %r11,%rax
+  803ca1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  803ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803caa:	c9                   	leave
+  803cab:	c3                   	ret
+
+0000000000803cac <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803cac:	55                   	push   %rbp
+  803cad:	48 89 e5             	mov    %rsp,%rbp
+  803cb0:	41 57                	push   %r15
+  803cb2:	48 83 ec 18          	sub    $0x18,%rsp
+  803cb6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cb6 <devcons_stat+0xa>
+  803cbd:	49 bb 82 43 00 00 00 	movabs $0x4382,%r11
+  803cc4:	00 00 00 
+  803cc7:	4c 01 d8             	add    %r11,%rax
+  803cca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803cce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  803cd2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803cd6:	48 b9 f5 e0 ff ff ff 	movabs $0xffffffffffffe0f5,%rcx
+  803cdd:	ff ff ff 
+  803ce0:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  803ce4:	48 89 ce             	mov    %rcx,%rsi
+  803ce7:	48 89 d7             	mov    %rdx,%rdi
+  803cea:	49 89 c7             	mov    %rax,%r15
+  803ced:	48 ba 68 cd ff ff ff 	movabs $0xffffffffffffcd68,%rdx
+  803cf4:	ff ff ff 
+  803cf7:	48 01 c2             	add    %rax,%rdx
+  803cfa:	ff d2                	call   *%rdx
+	return 0;
+  803cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d01:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803d05:	c9                   	leave
+  803d06:	c3                   	ret
+
+0000000000803d07 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803d07:	55                   	push   %rbp
+  803d08:	48 89 e5             	mov    %rsp,%rbp
+  803d0b:	41 57                	push   %r15
+  803d0d:	41 54                	push   %r12
+  803d0f:	53                   	push   %rbx
+  803d10:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  803d17:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d17 <_panic+0x10>
+  803d1e:	49 bb 21 43 00 00 00 	movabs $0x4321,%r11
+  803d25:	00 00 00 
+  803d28:	4c 01 db             	add    %r11,%rbx
+  803d2b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  803d32:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  803d38:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  803d3f:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  803d46:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  803d4d:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  803d54:	84 c0                	test   %al,%al
+  803d56:	74 26                	je     803d7e <_panic+0x77>
+  803d58:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  803d5f:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  803d66:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  803d6a:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  803d6e:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  803d72:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  803d76:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  803d7a:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  803d7e:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  803d85:	00 00 00 
+  803d88:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  803d8f:	00 00 00 
+  803d92:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d96:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  803d9d:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  803da4:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803dab:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  803db2:	ff ff ff 
+  803db5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803db9:	4c 8b 20             	mov    (%rax),%r12
+  803dbc:	49 89 df             	mov    %rbx,%r15
+  803dbf:	48 b8 ec 84 ff ff ff 	movabs $0xffffffffffff84ec,%rax
+  803dc6:	ff ff ff 
+  803dc9:	48 01 d8             	add    %rbx,%rax
+  803dcc:	ff d0                	call   *%rax
+  803dce:	89 c6                	mov    %eax,%esi
+  803dd0:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  803dd6:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803ddd:	41 89 d0             	mov    %edx,%r8d
+  803de0:	48 89 c1             	mov    %rax,%rcx
+  803de3:	4c 89 e2             	mov    %r12,%rdx
+  803de6:	48 b8 00 e1 ff ff ff 	movabs $0xffffffffffffe100,%rax
+  803ded:	ff ff ff 
+  803df0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803df4:	48 89 c7             	mov    %rax,%rdi
+  803df7:	49 89 df             	mov    %rbx,%r15
+  803dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dff:	49 b9 a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%r9
+  803e06:	ff ff ff 
+  803e09:	49 01 d9             	add    %rbx,%r9
+  803e0c:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803e0f:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  803e16:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  803e1d:	48 89 d6             	mov    %rdx,%rsi
+  803e20:	48 89 c7             	mov    %rax,%rdi
+  803e23:	49 89 df             	mov    %rbx,%r15
+  803e26:	48 b8 c6 be ff ff ff 	movabs $0xffffffffffffbec6,%rax
+  803e2d:	ff ff ff 
+  803e30:	48 01 d8             	add    %rbx,%rax
+  803e33:	ff d0                	call   *%rax
+	cprintf("\n");
+  803e35:	48 b8 23 e1 ff ff ff 	movabs $0xffffffffffffe123,%rax
+  803e3c:	ff ff ff 
+  803e3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e43:	48 89 c7             	mov    %rax,%rdi
+  803e46:	49 89 df             	mov    %rbx,%r15
+  803e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4e:	48 ba a6 bf ff ff ff 	movabs $0xffffffffffffbfa6,%rdx
+  803e55:	ff ff ff 
+  803e58:	48 01 da             	add    %rbx,%rdx
+  803e5b:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803e5d:	cc                   	int3
+  803e5e:	eb fd                	jmp    803e5d <_panic+0x156>
+
+0000000000803e60 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  803e60:	55                   	push   %rbp
+  803e61:	48 89 e5             	mov    %rsp,%rbp
+  803e64:	41 57                	push   %r15
+  803e66:	48 83 ec 18          	sub    $0x18,%rsp
+  803e6a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e6a <putch+0xa>
+  803e71:	49 bb ce 41 00 00 00 	movabs $0x41ce,%r11
+  803e78:	00 00 00 
+  803e7b:	4c 01 d8             	add    %r11,%rax
+  803e7e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e81:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  803e85:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e89:	8b 12                	mov    (%rdx),%edx
+  803e8b:	8d 72 01             	lea    0x1(%rdx),%esi
+  803e8e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803e92:	89 31                	mov    %esi,(%rcx)
+  803e94:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  803e97:	89 ce                	mov    %ecx,%esi
+  803e99:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803e9d:	48 63 d2             	movslq %edx,%rdx
+  803ea0:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  803ea5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ea9:	8b 12                	mov    (%rdx),%edx
+  803eab:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803eb1:	75 33                	jne    803ee6 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  803eb3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803eb7:	8b 12                	mov    (%rdx),%edx
+  803eb9:	48 63 d2             	movslq %edx,%rdx
+  803ebc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803ec0:	48 83 c1 08          	add    $0x8,%rcx
+  803ec4:	48 89 d6             	mov    %rdx,%rsi
+  803ec7:	48 89 cf             	mov    %rcx,%rdi
+  803eca:	49 89 c7             	mov    %rax,%r15
+  803ecd:	48 ba dd 83 ff ff ff 	movabs $0xffffffffffff83dd,%rdx
+  803ed4:	ff ff ff 
+  803ed7:	48 01 c2             	add    %rax,%rdx
+  803eda:	ff d2                	call   *%rdx
+        b->idx = 0;
+  803edc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ee0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  803ee6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803eea:	8b 40 04             	mov    0x4(%rax),%eax
+  803eed:	8d 50 01             	lea    0x1(%rax),%edx
+  803ef0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ef4:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  803ef7:	90                   	nop
+  803ef8:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803efc:	c9                   	leave
+  803efd:	c3                   	ret
+
+0000000000803efe <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  803efe:	55                   	push   %rbp
+  803eff:	48 89 e5             	mov    %rsp,%rbp
+  803f02:	41 57                	push   %r15
+  803f04:	53                   	push   %rbx
+  803f05:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  803f0c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f0c <vcprintf+0xe>
+  803f13:	49 bb 2c 41 00 00 00 	movabs $0x412c,%r11
+  803f1a:	00 00 00 
+  803f1d:	4c 01 db             	add    %r11,%rbx
+  803f20:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  803f27:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  803f2e:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  803f35:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  803f3c:	48 8b 06             	mov    (%rsi),%rax
+  803f3f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  803f43:	48 89 01             	mov    %rax,(%rcx)
+  803f46:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  803f4a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  803f4e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  803f52:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  803f59:	00 00 00 
+    b.cnt = 0;
+  803f5c:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  803f63:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  803f66:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  803f6d:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  803f74:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  803f7b:	48 89 c6             	mov    %rax,%rsi
+  803f7e:	48 b8 28 be ff ff ff 	movabs $0xffffffffffffbe28,%rax
+  803f85:	ff ff ff 
+  803f88:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f8c:	48 89 c7             	mov    %rax,%rdi
+  803f8f:	49 89 df             	mov    %rbx,%r15
+  803f92:	48 b8 ea c3 ff ff ff 	movabs $0xffffffffffffc3ea,%rax
+  803f99:	ff ff ff 
+  803f9c:	48 01 d8             	add    %rbx,%rax
+  803f9f:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  803fa1:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  803fa7:	48 98                	cltq
+  803fa9:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  803fb0:	48 83 c2 08          	add    $0x8,%rdx
+  803fb4:	48 89 c6             	mov    %rax,%rsi
+  803fb7:	48 89 d7             	mov    %rdx,%rdi
+  803fba:	49 89 df             	mov    %rbx,%r15
+  803fbd:	48 b8 dd 83 ff ff ff 	movabs $0xffffffffffff83dd,%rax
+  803fc4:	ff ff ff 
+  803fc7:	48 01 d8             	add    %rbx,%rax
+  803fca:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  803fcc:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  803fd2:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  803fd9:	5b                   	pop    %rbx
+  803fda:	41 5f                	pop    %r15
+  803fdc:	5d                   	pop    %rbp
+  803fdd:	c3                   	ret
+
+0000000000803fde <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  803fde:	55                   	push   %rbp
+  803fdf:	48 89 e5             	mov    %rsp,%rbp
+  803fe2:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  803fe9:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 803fe9 <cprintf+0xb>
+  803ff0:	49 bb 4f 40 00 00 00 	movabs $0x404f,%r11
+  803ff7:	00 00 00 
+  803ffa:	4d 01 da             	add    %r11,%r10
+  803ffd:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  804004:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80400b:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804012:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804019:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804020:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804027:	84 c0                	test   %al,%al
+  804029:	74 20                	je     80404b <cprintf+0x6d>
+  80402b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80402f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804033:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804037:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80403b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80403f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804043:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804047:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80404b:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  804052:	00 00 00 
+  804055:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80405c:	00 00 00 
+  80405f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804063:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80406a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804071:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  804078:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80407f:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  804086:	48 8b 06             	mov    (%rsi),%rax
+  804089:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80408d:	48 89 01             	mov    %rax,(%rcx)
+  804090:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804094:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804098:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80409c:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8040a3:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8040aa:	48 89 d6             	mov    %rdx,%rsi
+  8040ad:	48 89 c7             	mov    %rax,%rdi
+  8040b0:	48 b8 c6 be ff ff ff 	movabs $0xffffffffffffbec6,%rax
+  8040b7:	ff ff ff 
+  8040ba:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8040be:	ff d0                	call   *%rax
+  8040c0:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8040c6:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8040cc:	c9                   	leave
+  8040cd:	c3                   	ret
+
+00000000008040ce <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8040ce:	55                   	push   %rbp
+  8040cf:	48 89 e5             	mov    %rsp,%rbp
+  8040d2:	53                   	push   %rbx
+  8040d3:	48 83 ec 38          	sub    $0x38,%rsp
+  8040d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040d7 <printnum+0x9>
+  8040de:	49 bb 61 3f 00 00 00 	movabs $0x3f61,%r11
+  8040e5:	00 00 00 
+  8040e8:	4c 01 db             	add    %r11,%rbx
+  8040eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040ef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8040f3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8040f7:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8040fa:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8040fe:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  804102:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804105:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  804109:	72 58                	jb     804163 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80410b:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80410e:	8d 78 ff             	lea    -0x1(%rax),%edi
+  804111:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  804114:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80411d:	48 f7 f6             	div    %rsi
+  804120:	49 89 c2             	mov    %rax,%r10
+  804123:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  804126:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804129:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80412d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804131:	41 89 c9             	mov    %ecx,%r9d
+  804134:	41 89 f8             	mov    %edi,%r8d
+  804137:	89 d1                	mov    %edx,%ecx
+  804139:	4c 89 d2             	mov    %r10,%rdx
+  80413c:	48 89 c7             	mov    %rax,%rdi
+  80413f:	48 b8 96 c0 ff ff ff 	movabs $0xffffffffffffc096,%rax
+  804146:	ff ff ff 
+  804149:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80414d:	ff d0                	call   *%rax
+  80414f:	eb 1c                	jmp    80416d <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  804151:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804155:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804158:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80415c:	48 89 d6             	mov    %rdx,%rsi
+  80415f:	89 c7                	mov    %eax,%edi
+  804161:	ff d1                	call   *%rcx
+		while (--width > 0)
+  804163:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  804167:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80416b:	7f e4                	jg     804151 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80416d:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804170:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804174:	ba 00 00 00 00       	mov    $0x0,%edx
+  804179:	48 f7 f1             	div    %rcx
+  80417c:	48 b8 5f e2 ff ff ff 	movabs $0xffffffffffffe25f,%rax
+  804183:	ff ff ff 
+  804186:	48 01 d8             	add    %rbx,%rax
+  804189:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80418d:	0f be c0             	movsbl %al,%eax
+  804190:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804194:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804198:	48 89 d6             	mov    %rdx,%rsi
+  80419b:	89 c7                	mov    %eax,%edi
+  80419d:	ff d1                	call   *%rcx
+}
+  80419f:	90                   	nop
+  8041a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041a4:	c9                   	leave
+  8041a5:	c3                   	ret
+
+00000000008041a6 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8041a6:	55                   	push   %rbp
+  8041a7:	48 89 e5             	mov    %rsp,%rbp
+  8041aa:	48 83 ec 20          	sub    $0x20,%rsp
+  8041ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8041ae <getuint+0x8>
+  8041b5:	49 bb 8a 3e 00 00 00 	movabs $0x3e8a,%r11
+  8041bc:	00 00 00 
+  8041bf:	4c 01 d8             	add    %r11,%rax
+  8041c2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041c6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8041c9:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8041cd:	7e 4f                	jle    80421e <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8041cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041d3:	8b 00                	mov    (%rax),%eax
+  8041d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8041d8:	77 24                	ja     8041fe <getuint+0x58>
+  8041da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041de:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8041e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041e6:	8b 00                	mov    (%rax),%eax
+  8041e8:	89 c0                	mov    %eax,%eax
+  8041ea:	48 01 d0             	add    %rdx,%rax
+  8041ed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041f1:	8b 12                	mov    (%rdx),%edx
+  8041f3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8041f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041fa:	89 0a                	mov    %ecx,(%rdx)
+  8041fc:	eb 14                	jmp    804212 <getuint+0x6c>
+  8041fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804202:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804206:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80420a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80420e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804212:	48 8b 00             	mov    (%rax),%rax
+  804215:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804219:	e9 9d 00 00 00       	jmp    8042bb <getuint+0x115>
+	else if (lflag)
+  80421e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804222:	74 4c                	je     804270 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  804224:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804228:	8b 00                	mov    (%rax),%eax
+  80422a:	83 f8 2f             	cmp    $0x2f,%eax
+  80422d:	77 24                	ja     804253 <getuint+0xad>
+  80422f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804233:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804237:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80423b:	8b 00                	mov    (%rax),%eax
+  80423d:	89 c0                	mov    %eax,%eax
+  80423f:	48 01 d0             	add    %rdx,%rax
+  804242:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804246:	8b 12                	mov    (%rdx),%edx
+  804248:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80424b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80424f:	89 0a                	mov    %ecx,(%rdx)
+  804251:	eb 14                	jmp    804267 <getuint+0xc1>
+  804253:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804257:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80425b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80425f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804263:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804267:	48 8b 00             	mov    (%rax),%rax
+  80426a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80426e:	eb 4b                	jmp    8042bb <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  804270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804274:	8b 00                	mov    (%rax),%eax
+  804276:	83 f8 2f             	cmp    $0x2f,%eax
+  804279:	77 24                	ja     80429f <getuint+0xf9>
+  80427b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80427f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804287:	8b 00                	mov    (%rax),%eax
+  804289:	89 c0                	mov    %eax,%eax
+  80428b:	48 01 d0             	add    %rdx,%rax
+  80428e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804292:	8b 12                	mov    (%rdx),%edx
+  804294:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804297:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80429b:	89 0a                	mov    %ecx,(%rdx)
+  80429d:	eb 14                	jmp    8042b3 <getuint+0x10d>
+  80429f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042a3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8042a7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8042ab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042af:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8042b3:	8b 00                	mov    (%rax),%eax
+  8042b5:	89 c0                	mov    %eax,%eax
+  8042b7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8042bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8042bf:	c9                   	leave
+  8042c0:	c3                   	ret
+
+00000000008042c1 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8042c1:	55                   	push   %rbp
+  8042c2:	48 89 e5             	mov    %rsp,%rbp
+  8042c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8042c9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8042c9 <printfloat+0x8>
+  8042d0:	49 bb 6f 3d 00 00 00 	movabs $0x3d6f,%r11
+  8042d7:	00 00 00 
+  8042da:	4c 01 d8             	add    %r11,%rax
+  8042dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8042e1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8042e5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8042e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042ed:	48 85 c0             	test   %rax,%rax
+  8042f0:	79 12                	jns    804304 <printfloat+0x43>
+		putch('-',putdat);
+  8042f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042fa:	48 89 c6             	mov    %rax,%rsi
+  8042fd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  804302:	ff d2                	call   *%rdx
+	
+}
+  804304:	90                   	nop
+  804305:	c9                   	leave
+  804306:	c3                   	ret
+
+0000000000804307 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  804307:	55                   	push   %rbp
+  804308:	48 89 e5             	mov    %rsp,%rbp
+  80430b:	48 83 ec 20          	sub    $0x20,%rsp
+  80430f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80430f <getint+0x8>
+  804316:	49 bb 29 3d 00 00 00 	movabs $0x3d29,%r11
+  80431d:	00 00 00 
+  804320:	4c 01 d8             	add    %r11,%rax
+  804323:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804327:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80432a:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80432e:	7e 4f                	jle    80437f <getint+0x78>
+		x=va_arg(*ap, long long);
+  804330:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804334:	8b 00                	mov    (%rax),%eax
+  804336:	83 f8 2f             	cmp    $0x2f,%eax
+  804339:	77 24                	ja     80435f <getint+0x58>
+  80433b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80433f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804343:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804347:	8b 00                	mov    (%rax),%eax
+  804349:	89 c0                	mov    %eax,%eax
+  80434b:	48 01 d0             	add    %rdx,%rax
+  80434e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804352:	8b 12                	mov    (%rdx),%edx
+  804354:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804357:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80435b:	89 0a                	mov    %ecx,(%rdx)
+  80435d:	eb 14                	jmp    804373 <getint+0x6c>
+  80435f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804363:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804367:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80436b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80436f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804373:	48 8b 00             	mov    (%rax),%rax
+  804376:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80437a:	e9 9d 00 00 00       	jmp    80441c <getint+0x115>
+	else if (lflag)
+  80437f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804383:	74 4c                	je     8043d1 <getint+0xca>
+		x=va_arg(*ap, long);
+  804385:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804389:	8b 00                	mov    (%rax),%eax
+  80438b:	83 f8 2f             	cmp    $0x2f,%eax
+  80438e:	77 24                	ja     8043b4 <getint+0xad>
+  804390:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804394:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804398:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80439c:	8b 00                	mov    (%rax),%eax
+  80439e:	89 c0                	mov    %eax,%eax
+  8043a0:	48 01 d0             	add    %rdx,%rax
+  8043a3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043a7:	8b 12                	mov    (%rdx),%edx
+  8043a9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8043ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043b0:	89 0a                	mov    %ecx,(%rdx)
+  8043b2:	eb 14                	jmp    8043c8 <getint+0xc1>
+  8043b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043b8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8043bc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8043c0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043c4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8043c8:	48 8b 00             	mov    (%rax),%rax
+  8043cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8043cf:	eb 4b                	jmp    80441c <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8043d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043d5:	8b 00                	mov    (%rax),%eax
+  8043d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8043da:	77 24                	ja     804400 <getint+0xf9>
+  8043dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043e0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8043e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043e8:	8b 00                	mov    (%rax),%eax
+  8043ea:	89 c0                	mov    %eax,%eax
+  8043ec:	48 01 d0             	add    %rdx,%rax
+  8043ef:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043f3:	8b 12                	mov    (%rdx),%edx
+  8043f5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8043f8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043fc:	89 0a                	mov    %ecx,(%rdx)
+  8043fe:	eb 14                	jmp    804414 <getint+0x10d>
+  804400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804404:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804408:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80440c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804410:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804414:	8b 00                	mov    (%rax),%eax
+  804416:	48 98                	cltq
+  804418:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80441c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804420:	c9                   	leave
+  804421:	c3                   	ret
+
+0000000000804422 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  804422:	55                   	push   %rbp
+  804423:	48 89 e5             	mov    %rsp,%rbp
+  804426:	41 57                	push   %r15
+  804428:	41 55                	push   %r13
+  80442a:	41 54                	push   %r12
+  80442c:	53                   	push   %rbx
+  80442d:	48 83 ec 60          	sub    $0x60,%rsp
+  804431:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 804431 <vprintfmt+0xf>
+  804438:	49 bb 07 3c 00 00 00 	movabs $0x3c07,%r11
+  80443f:	00 00 00 
+  804442:	4d 01 dc             	add    %r11,%r12
+  804445:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  804449:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  80444d:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804451:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  804455:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  80445c:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  804460:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  804464:	48 8b 06             	mov    (%rsi),%rax
+  804467:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80446b:	48 89 01             	mov    %rax,(%rcx)
+  80446e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804472:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804476:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80447a:	eb 17                	jmp    804493 <vprintfmt+0x71>
+			if (ch == '\0')
+  80447c:	85 db                	test   %ebx,%ebx
+  80447e:	0f 84 97 05 00 00    	je     804a1b <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  804484:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804488:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80448c:	48 89 c6             	mov    %rax,%rsi
+  80448f:	89 df                	mov    %ebx,%edi
+  804491:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804493:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804497:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80449b:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80449f:	0f b6 00             	movzbl (%rax),%eax
+  8044a2:	0f b6 d8             	movzbl %al,%ebx
+  8044a5:	83 fb 25             	cmp    $0x25,%ebx
+  8044a8:	75 d2                	jne    80447c <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  8044aa:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  8044ae:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  8044b5:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8044bc:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  8044c3:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  8044ca:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8044ce:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8044d2:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8044d6:	0f b6 00             	movzbl (%rax),%eax
+  8044d9:	0f b6 d8             	movzbl %al,%ebx
+  8044dc:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8044df:	83 f8 55             	cmp    $0x55,%eax
+  8044e2:	0f 87 00 05 00 00    	ja     8049e8 <vprintfmt+0x5c6>
+  8044e8:	89 c0                	mov    %eax,%eax
+  8044ea:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8044f1:	00 
+  8044f2:	48 8d 05 c7 1d 00 00 	lea    0x1dc7(%rip),%rax        # 8062c0 <.LC18+0xc>
+  8044f9:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  8044fd:	48 8d 15 bc 1d 00 00 	lea    0x1dbc(%rip),%rdx        # 8062c0 <.LC18+0xc>
+  804504:	48 01 d0             	add    %rdx,%rax
+  804507:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  804509:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  80450d:	eb bb                	jmp    8044ca <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  80450f:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  804513:	eb b5                	jmp    8044ca <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  804515:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  80451c:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80451f:	89 d0                	mov    %edx,%eax
+  804521:	c1 e0 02             	shl    $0x2,%eax
+  804524:	01 d0                	add    %edx,%eax
+  804526:	01 c0                	add    %eax,%eax
+  804528:	01 d8                	add    %ebx,%eax
+  80452a:	83 e8 30             	sub    $0x30,%eax
+  80452d:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  804530:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804534:	0f b6 00             	movzbl (%rax),%eax
+  804537:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  80453a:	83 fb 2f             	cmp    $0x2f,%ebx
+  80453d:	7e 60                	jle    80459f <vprintfmt+0x17d>
+  80453f:	83 fb 39             	cmp    $0x39,%ebx
+  804542:	7f 5b                	jg     80459f <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  804544:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  804549:	eb d1                	jmp    80451c <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  80454b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80454e:	83 f8 2f             	cmp    $0x2f,%eax
+  804551:	77 17                	ja     80456a <vprintfmt+0x148>
+  804553:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804557:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80455a:	89 d2                	mov    %edx,%edx
+  80455c:	48 01 d0             	add    %rdx,%rax
+  80455f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804562:	83 c2 08             	add    $0x8,%edx
+  804565:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804568:	eb 0c                	jmp    804576 <vprintfmt+0x154>
+  80456a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80456e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804572:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804576:	8b 00                	mov    (%rax),%eax
+  804578:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  80457b:	eb 23                	jmp    8045a0 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  80457d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804581:	0f 89 43 ff ff ff    	jns    8044ca <vprintfmt+0xa8>
+				width = 0;
+  804587:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  80458e:	e9 37 ff ff ff       	jmp    8044ca <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  804593:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  80459a:	e9 2b ff ff ff       	jmp    8044ca <vprintfmt+0xa8>
+			goto process_precision;
+  80459f:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8045a0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8045a4:	0f 89 20 ff ff ff    	jns    8044ca <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  8045aa:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8045ad:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8045b0:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  8045b7:	e9 0e ff ff ff       	jmp    8044ca <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8045bc:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  8045c0:	e9 05 ff ff ff       	jmp    8044ca <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  8045c5:	83 fb 39             	cmp    $0x39,%ebx
+  8045c8:	7f 0b                	jg     8045d5 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  8045ca:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  8045cd:	c1 e0 08             	shl    $0x8,%eax
+  8045d0:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8045d3:	eb 21                	jmp    8045f6 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  8045d5:	83 fb 60             	cmp    $0x60,%ebx
+  8045d8:	7e 10                	jle    8045ea <vprintfmt+0x1c8>
+  8045da:	83 fb 66             	cmp    $0x66,%ebx
+  8045dd:	7f 0b                	jg     8045ea <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  8045df:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  8045e2:	c1 e0 08             	shl    $0x8,%eax
+  8045e5:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8045e8:	eb 0c                	jmp    8045f6 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  8045ea:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  8045f1:	e9 04 01 00 00       	jmp    8046fa <vprintfmt+0x2d8>
+  8045f6:	e9 ff 00 00 00       	jmp    8046fa <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8045fb:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8045fe:	83 f8 2f             	cmp    $0x2f,%eax
+  804601:	77 17                	ja     80461a <vprintfmt+0x1f8>
+  804603:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804607:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80460a:	89 d2                	mov    %edx,%edx
+  80460c:	48 01 d0             	add    %rdx,%rax
+  80460f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804612:	83 c2 08             	add    $0x8,%edx
+  804615:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804618:	eb 0c                	jmp    804626 <vprintfmt+0x204>
+  80461a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80461e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804622:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804626:	8b 00                	mov    (%rax),%eax
+  804628:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80462c:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  804630:	48 89 d6             	mov    %rdx,%rsi
+  804633:	89 c7                	mov    %eax,%edi
+  804635:	ff d1                	call   *%rcx
+			break;
+  804637:	e9 da 03 00 00       	jmp    804a16 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80463c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80463f:	83 f8 2f             	cmp    $0x2f,%eax
+  804642:	77 17                	ja     80465b <vprintfmt+0x239>
+  804644:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804648:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80464b:	89 d2                	mov    %edx,%edx
+  80464d:	48 01 d0             	add    %rdx,%rax
+  804650:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804653:	83 c2 08             	add    $0x8,%edx
+  804656:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804659:	eb 0c                	jmp    804667 <vprintfmt+0x245>
+  80465b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80465f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804663:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804667:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  804669:	85 db                	test   %ebx,%ebx
+  80466b:	79 02                	jns    80466f <vprintfmt+0x24d>
+				err = -err;
+  80466d:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80466f:	83 fb 15             	cmp    $0x15,%ebx
+  804672:	7f 19                	jg     80468d <vprintfmt+0x26b>
+  804674:	48 ba 88 01 00 00 00 	movabs $0x188,%rdx
+  80467b:	00 00 00 
+  80467e:	48 63 c3             	movslq %ebx,%rax
+  804681:	4c 01 e2             	add    %r12,%rdx
+  804684:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  804688:	4d 85 ed             	test   %r13,%r13
+  80468b:	75 36                	jne    8046c3 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  80468d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804691:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804695:	89 d9                	mov    %ebx,%ecx
+  804697:	48 ba 70 e2 ff ff ff 	movabs $0xffffffffffffe270,%rdx
+  80469e:	ff ff ff 
+  8046a1:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8046a5:	48 89 c7             	mov    %rax,%rdi
+  8046a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ad:	49 b8 f1 c9 ff ff ff 	movabs $0xffffffffffffc9f1,%r8
+  8046b4:	ff ff ff 
+  8046b7:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8046bb:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8046be:	e9 53 03 00 00       	jmp    804a16 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  8046c3:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8046c7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8046cb:	4c 89 e9             	mov    %r13,%rcx
+  8046ce:	48 ba 79 e2 ff ff ff 	movabs $0xffffffffffffe279,%rdx
+  8046d5:	ff ff ff 
+  8046d8:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8046dc:	48 89 c7             	mov    %rax,%rdi
+  8046df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e4:	49 b8 f1 c9 ff ff ff 	movabs $0xffffffffffffc9f1,%r8
+  8046eb:	ff ff ff 
+  8046ee:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8046f2:	41 ff d0             	call   *%r8
+			break;
+  8046f5:	e9 1c 03 00 00       	jmp    804a16 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  8046fa:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8046fd:	83 f8 2f             	cmp    $0x2f,%eax
+  804700:	77 17                	ja     804719 <vprintfmt+0x2f7>
+  804702:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804706:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804709:	89 d2                	mov    %edx,%edx
+  80470b:	48 01 d0             	add    %rdx,%rax
+  80470e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804711:	83 c2 08             	add    $0x8,%edx
+  804714:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804717:	eb 0c                	jmp    804725 <vprintfmt+0x303>
+  804719:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80471d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804721:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804725:	4c 8b 28             	mov    (%rax),%r13
+  804728:	4d 85 ed             	test   %r13,%r13
+  80472b:	75 0e                	jne    80473b <vprintfmt+0x319>
+				p = "(null)";
+  80472d:	48 b8 7c e2 ff ff ff 	movabs $0xffffffffffffe27c,%rax
+  804734:	ff ff ff 
+  804737:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  80473b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80473f:	0f 8e 84 00 00 00    	jle    8047c9 <vprintfmt+0x3a7>
+  804745:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  804749:	74 7e                	je     8047c9 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80474b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80474e:	48 98                	cltq
+  804750:	48 89 c6             	mov    %rax,%rsi
+  804753:	4c 89 ef             	mov    %r13,%rdi
+  804756:	4d 89 e7             	mov    %r12,%r15
+  804759:	48 b8 16 cd ff ff ff 	movabs $0xffffffffffffcd16,%rax
+  804760:	ff ff ff 
+  804763:	4c 01 e0             	add    %r12,%rax
+  804766:	ff d0                	call   *%rax
+  804768:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  80476b:	eb 17                	jmp    804784 <vprintfmt+0x362>
+					putch(padc, putdat);
+  80476d:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  804771:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  804775:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  804779:	48 89 d6             	mov    %rdx,%rsi
+  80477c:	89 c7                	mov    %eax,%edi
+  80477e:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  804780:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  804784:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804788:	7f e3                	jg     80476d <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80478a:	eb 3d                	jmp    8047c9 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80478c:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  804790:	74 1e                	je     8047b0 <vprintfmt+0x38e>
+  804792:	83 fb 1f             	cmp    $0x1f,%ebx
+  804795:	7e 05                	jle    80479c <vprintfmt+0x37a>
+  804797:	83 fb 7e             	cmp    $0x7e,%ebx
+  80479a:	7e 14                	jle    8047b0 <vprintfmt+0x38e>
+					putch('?', putdat);
+  80479c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8047a0:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8047a4:	48 89 c6             	mov    %rax,%rsi
+  8047a7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8047ac:	ff d2                	call   *%rdx
+  8047ae:	eb 15                	jmp    8047c5 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  8047b0:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8047b3:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  8047b6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8047ba:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8047be:	48 89 c6             	mov    %rax,%rsi
+  8047c1:	89 cf                	mov    %ecx,%edi
+  8047c3:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8047c5:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8047c9:	4c 89 e8             	mov    %r13,%rax
+  8047cc:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  8047d0:	0f b6 00             	movzbl (%rax),%eax
+  8047d3:	0f be d8             	movsbl %al,%ebx
+  8047d6:	85 db                	test   %ebx,%ebx
+  8047d8:	74 28                	je     804802 <vprintfmt+0x3e0>
+  8047da:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8047de:	78 ac                	js     80478c <vprintfmt+0x36a>
+  8047e0:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  8047e4:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8047e8:	79 a2                	jns    80478c <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  8047ea:	eb 16                	jmp    804802 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  8047ec:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8047f0:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8047f4:	48 89 c6             	mov    %rax,%rsi
+  8047f7:	bf 20 00 00 00       	mov    $0x20,%edi
+  8047fc:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8047fe:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  804802:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804806:	7f e4                	jg     8047ec <vprintfmt+0x3ca>
+			break;
+  804808:	e9 09 02 00 00       	jmp    804a16 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80480d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804811:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804815:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804819:	0f b6 00             	movzbl (%rax),%eax
+  80481c:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  80481f:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  804820:	83 fb 2f             	cmp    $0x2f,%ebx
+  804823:	0f 8e ac fd ff ff    	jle    8045d5 <vprintfmt+0x1b3>
+  804829:	e9 97 fd ff ff       	jmp    8045c5 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  80482e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804832:	be 03 00 00 00       	mov    $0x3,%esi
+  804837:	48 89 c7             	mov    %rax,%rdi
+  80483a:	48 b8 cf c2 ff ff ff 	movabs $0xffffffffffffc2cf,%rax
+  804841:	ff ff ff 
+  804844:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804848:	ff d0                	call   *%rax
+  80484a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  80484e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804852:	48 85 c0             	test   %rax,%rax
+  804855:	79 1d                	jns    804874 <vprintfmt+0x452>
+				putch('-', putdat);
+  804857:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80485b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80485f:	48 89 c6             	mov    %rax,%rsi
+  804862:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  804867:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  804869:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80486d:	48 f7 d8             	neg    %rax
+  804870:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  804874:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80487b:	e9 de 00 00 00       	jmp    80495e <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  804880:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804884:	be 03 00 00 00       	mov    $0x3,%esi
+  804889:	48 89 c7             	mov    %rax,%rdi
+  80488c:	48 b8 6e c1 ff ff ff 	movabs $0xffffffffffffc16e,%rax
+  804893:	ff ff ff 
+  804896:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80489a:	ff d0                	call   *%rax
+  80489c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  8048a0:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8048a7:	e9 b2 00 00 00       	jmp    80495e <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8048ac:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8048b0:	be 03 00 00 00       	mov    $0x3,%esi
+  8048b5:	48 89 c7             	mov    %rax,%rdi
+  8048b8:	48 b8 6e c1 ff ff ff 	movabs $0xffffffffffffc16e,%rax
+  8048bf:	ff ff ff 
+  8048c2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8048c6:	ff d0                	call   *%rax
+  8048c8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  8048cc:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  8048d3:	e9 86 00 00 00       	jmp    80495e <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  8048d8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8048dc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8048e0:	48 89 c6             	mov    %rax,%rsi
+  8048e3:	bf 30 00 00 00       	mov    $0x30,%edi
+  8048e8:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  8048ea:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8048ee:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8048f2:	48 89 c6             	mov    %rax,%rsi
+  8048f5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8048fa:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8048fc:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8048ff:	83 f8 2f             	cmp    $0x2f,%eax
+  804902:	77 17                	ja     80491b <vprintfmt+0x4f9>
+  804904:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804908:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80490b:	89 d2                	mov    %edx,%edx
+  80490d:	48 01 d0             	add    %rdx,%rax
+  804910:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804913:	83 c2 08             	add    $0x8,%edx
+  804916:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804919:	eb 0c                	jmp    804927 <vprintfmt+0x505>
+  80491b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80491f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804923:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804927:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80492a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80492e:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  804935:	eb 27                	jmp    80495e <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  804937:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80493b:	be 03 00 00 00       	mov    $0x3,%esi
+  804940:	48 89 c7             	mov    %rax,%rdi
+  804943:	48 b8 6e c1 ff ff ff 	movabs $0xffffffffffffc16e,%rax
+  80494a:	ff ff ff 
+  80494d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804951:	ff d0                	call   *%rax
+  804953:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  804957:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  80495e:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  804963:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804966:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  804969:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80496d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804971:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804975:	45 89 c1             	mov    %r8d,%r9d
+  804978:	41 89 f8             	mov    %edi,%r8d
+  80497b:	48 89 c7             	mov    %rax,%rdi
+  80497e:	48 b8 96 c0 ff ff ff 	movabs $0xffffffffffffc096,%rax
+  804985:	ff ff ff 
+  804988:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80498c:	ff d0                	call   *%rax
+			break;
+  80498e:	e9 83 00 00 00       	jmp    804a16 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  804993:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804997:	be 03 00 00 00       	mov    $0x3,%esi
+  80499c:	48 89 c7             	mov    %rax,%rdi
+  80499f:	48 b8 6e c1 ff ff ff 	movabs $0xffffffffffffc16e,%rax
+  8049a6:	ff ff ff 
+  8049a9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8049ad:	ff d0                	call   *%rax
+  8049af:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8049b3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8049b7:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8049bb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8049bf:	48 89 ce             	mov    %rcx,%rsi
+  8049c2:	48 89 c7             	mov    %rax,%rdi
+  8049c5:	48 b8 89 c2 ff ff ff 	movabs $0xffffffffffffc289,%rax
+  8049cc:	ff ff ff 
+  8049cf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8049d3:	ff d0                	call   *%rax
+	
+			break;
+  8049d5:	eb 3f                	jmp    804a16 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8049d7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8049db:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8049df:	48 89 c6             	mov    %rax,%rsi
+  8049e2:	89 df                	mov    %ebx,%edi
+  8049e4:	ff d2                	call   *%rdx
+			break;
+  8049e6:	eb 2e                	jmp    804a16 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8049e8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8049ec:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8049f0:	48 89 c6             	mov    %rax,%rsi
+  8049f3:	bf 25 00 00 00       	mov    $0x25,%edi
+  8049f8:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8049fa:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8049ff:	eb 05                	jmp    804a06 <vprintfmt+0x5e4>
+  804a01:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  804a06:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804a0a:	48 83 e8 01          	sub    $0x1,%rax
+  804a0e:	0f b6 00             	movzbl (%rax),%eax
+  804a11:	3c 25                	cmp    $0x25,%al
+  804a13:	75 ec                	jne    804a01 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  804a15:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804a16:	e9 78 fa ff ff       	jmp    804493 <vprintfmt+0x71>
+				return;
+  804a1b:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  804a1c:	48 83 c4 60          	add    $0x60,%rsp
+  804a20:	5b                   	pop    %rbx
+  804a21:	41 5c                	pop    %r12
+  804a23:	41 5d                	pop    %r13
+  804a25:	41 5f                	pop    %r15
+  804a27:	5d                   	pop    %rbp
+  804a28:	c3                   	ret
+
+0000000000804a29 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  804a29:	55                   	push   %rbp
+  804a2a:	48 89 e5             	mov    %rsp,%rbp
+  804a2d:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  804a34:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804a34 <printfmt+0xb>
+  804a3b:	49 bb 04 36 00 00 00 	movabs $0x3604,%r11
+  804a42:	00 00 00 
+  804a45:	4d 01 da             	add    %r11,%r10
+  804a48:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  804a4f:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  804a56:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  804a5d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804a64:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804a6b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804a72:	84 c0                	test   %al,%al
+  804a74:	74 20                	je     804a96 <printfmt+0x6d>
+  804a76:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804a7a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804a7e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804a82:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804a86:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804a8a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804a8e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804a92:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  804a96:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  804a9d:	00 00 00 
+  804aa0:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  804aa7:	00 00 00 
+  804aaa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804aae:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  804ab5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804abc:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  804ac3:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  804aca:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  804ad1:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  804ad8:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804adf:	48 89 c7             	mov    %rax,%rdi
+  804ae2:	48 b8 ea c3 ff ff ff 	movabs $0xffffffffffffc3ea,%rax
+  804ae9:	ff ff ff 
+  804aec:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804af0:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  804af2:	90                   	nop
+  804af3:	c9                   	leave
+  804af4:	c3                   	ret
+
+0000000000804af5 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  804af5:	55                   	push   %rbp
+  804af6:	48 89 e5             	mov    %rsp,%rbp
+  804af9:	48 83 ec 10          	sub    $0x10,%rsp
+  804afd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804afd <sprintputch+0x8>
+  804b04:	49 bb 3b 35 00 00 00 	movabs $0x353b,%r11
+  804b0b:	00 00 00 
+  804b0e:	4c 01 d8             	add    %r11,%rax
+  804b11:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804b14:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  804b18:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b1c:	8b 40 10             	mov    0x10(%rax),%eax
+  804b1f:	8d 50 01             	lea    0x1(%rax),%edx
+  804b22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b26:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  804b29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b2d:	48 8b 10             	mov    (%rax),%rdx
+  804b30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b34:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804b38:	48 39 c2             	cmp    %rax,%rdx
+  804b3b:	73 17                	jae    804b54 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  804b3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b41:	48 8b 00             	mov    (%rax),%rax
+  804b44:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804b48:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b4c:	48 89 0a             	mov    %rcx,(%rdx)
+  804b4f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804b52:	88 10                	mov    %dl,(%rax)
+}
+  804b54:	90                   	nop
+  804b55:	c9                   	leave
+  804b56:	c3                   	ret
+
+0000000000804b57 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  804b57:	55                   	push   %rbp
+  804b58:	48 89 e5             	mov    %rsp,%rbp
+  804b5b:	53                   	push   %rbx
+  804b5c:	48 83 ec 58          	sub    $0x58,%rsp
+  804b60:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804b60 <vsnprintf+0x9>
+  804b67:	49 bb d8 34 00 00 00 	movabs $0x34d8,%r11
+  804b6e:	00 00 00 
+  804b71:	4c 01 d8             	add    %r11,%rax
+  804b74:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804b78:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  804b7b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804b7f:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  804b83:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804b87:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  804b8b:	48 8b 0e             	mov    (%rsi),%rcx
+  804b8e:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  804b92:	48 89 0a             	mov    %rcx,(%rdx)
+  804b95:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  804b99:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  804b9d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  804ba1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804ba5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804ba9:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  804bac:	48 63 d2             	movslq %edx,%rdx
+  804baf:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  804bb3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804bb7:	48 01 ca             	add    %rcx,%rdx
+  804bba:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804bbe:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  804bc5:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804bca:	74 06                	je     804bd2 <vsnprintf+0x7b>
+  804bcc:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  804bd0:	7f 07                	jg     804bd9 <vsnprintf+0x82>
+		return -E_INVAL;
+  804bd2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804bd7:	eb 34                	jmp    804c0d <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  804bd9:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  804bdd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  804be1:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  804be5:	48 bf bd ca ff ff ff 	movabs $0xffffffffffffcabd,%rdi
+  804bec:	ff ff ff 
+  804bef:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  804bf3:	49 b8 ea c3 ff ff ff 	movabs $0xffffffffffffc3ea,%r8
+  804bfa:	ff ff ff 
+  804bfd:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  804c01:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  804c03:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c07:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  804c0a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  804c0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804c11:	c9                   	leave
+  804c12:	c3                   	ret
+
+0000000000804c13 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  804c13:	55                   	push   %rbp
+  804c14:	48 89 e5             	mov    %rsp,%rbp
+  804c17:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  804c1e:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804c1e <snprintf+0xb>
+  804c25:	49 bb 1a 34 00 00 00 	movabs $0x341a,%r11
+  804c2c:	00 00 00 
+  804c2f:	4d 01 da             	add    %r11,%r10
+  804c32:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  804c39:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  804c3f:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  804c46:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804c4d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804c54:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804c5b:	84 c0                	test   %al,%al
+  804c5d:	74 20                	je     804c7f <snprintf+0x6c>
+  804c5f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804c63:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804c67:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804c6b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804c6f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804c73:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804c77:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804c7b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  804c7f:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  804c86:	00 00 00 
+  804c89:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804c90:	00 00 00 
+  804c93:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804c97:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804c9e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804ca5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  804cac:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  804cb3:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  804cba:	48 8b 06             	mov    (%rsi),%rax
+  804cbd:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804cc1:	48 89 01             	mov    %rax,(%rcx)
+  804cc4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804cc8:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804ccc:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  804cd0:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  804cd7:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  804cde:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  804ce4:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804ceb:	48 89 c7             	mov    %rax,%rdi
+  804cee:	48 b8 1f cb ff ff ff 	movabs $0xffffffffffffcb1f,%rax
+  804cf5:	ff ff ff 
+  804cf8:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804cfc:	ff d0                	call   *%rax
+  804cfe:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  804d04:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804d0a:	c9                   	leave
+  804d0b:	c3                   	ret
+
+0000000000804d0c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  804d0c:	55                   	push   %rbp
+  804d0d:	48 89 e5             	mov    %rsp,%rbp
+  804d10:	48 83 ec 18          	sub    $0x18,%rsp
+  804d14:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d14 <strlen+0x8>
+  804d1b:	49 bb 24 33 00 00 00 	movabs $0x3324,%r11
+  804d22:	00 00 00 
+  804d25:	4c 01 d8             	add    %r11,%rax
+  804d28:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  804d2c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804d33:	eb 09                	jmp    804d3e <strlen+0x32>
+		n++;
+  804d35:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  804d39:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804d3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d42:	0f b6 00             	movzbl (%rax),%eax
+  804d45:	84 c0                	test   %al,%al
+  804d47:	75 ec                	jne    804d35 <strlen+0x29>
+	return n;
+  804d49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d4c:	c9                   	leave
+  804d4d:	c3                   	ret
+
+0000000000804d4e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  804d4e:	55                   	push   %rbp
+  804d4f:	48 89 e5             	mov    %rsp,%rbp
+  804d52:	48 83 ec 20          	sub    $0x20,%rsp
+  804d56:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d56 <strnlen+0x8>
+  804d5d:	49 bb e2 32 00 00 00 	movabs $0x32e2,%r11
+  804d64:	00 00 00 
+  804d67:	4c 01 d8             	add    %r11,%rax
+  804d6a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d6e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804d72:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804d79:	eb 0e                	jmp    804d89 <strnlen+0x3b>
+		n++;
+  804d7b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804d7f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804d84:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  804d89:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804d8e:	74 0b                	je     804d9b <strnlen+0x4d>
+  804d90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d94:	0f b6 00             	movzbl (%rax),%eax
+  804d97:	84 c0                	test   %al,%al
+  804d99:	75 e0                	jne    804d7b <strnlen+0x2d>
+	return n;
+  804d9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d9e:	c9                   	leave
+  804d9f:	c3                   	ret
+
+0000000000804da0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  804da0:	55                   	push   %rbp
+  804da1:	48 89 e5             	mov    %rsp,%rbp
+  804da4:	48 83 ec 20          	sub    $0x20,%rsp
+  804da8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804da8 <strcpy+0x8>
+  804daf:	49 bb 90 32 00 00 00 	movabs $0x3290,%r11
+  804db6:	00 00 00 
+  804db9:	4c 01 d8             	add    %r11,%rax
+  804dbc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804dc0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  804dc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804dc8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  804dcc:	90                   	nop
+  804dcd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804dd1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804dd5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804dd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ddd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804de1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804de5:	0f b6 12             	movzbl (%rdx),%edx
+  804de8:	88 10                	mov    %dl,(%rax)
+  804dea:	0f b6 00             	movzbl (%rax),%eax
+  804ded:	84 c0                	test   %al,%al
+  804def:	75 dc                	jne    804dcd <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  804df1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804df5:	c9                   	leave
+  804df6:	c3                   	ret
+
+0000000000804df7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  804df7:	55                   	push   %rbp
+  804df8:	48 89 e5             	mov    %rsp,%rbp
+  804dfb:	53                   	push   %rbx
+  804dfc:	48 83 ec 20          	sub    $0x20,%rsp
+  804e00:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e00 <strcat+0x9>
+  804e07:	49 bb 38 32 00 00 00 	movabs $0x3238,%r11
+  804e0e:	00 00 00 
+  804e11:	4c 01 db             	add    %r11,%rbx
+  804e14:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  804e18:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  804e1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e20:	48 89 c7             	mov    %rax,%rdi
+  804e23:	48 b8 d4 cc ff ff ff 	movabs $0xffffffffffffccd4,%rax
+  804e2a:	ff ff ff 
+  804e2d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e31:	ff d0                	call   *%rax
+  804e33:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  804e36:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804e39:	48 63 d0             	movslq %eax,%rdx
+  804e3c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e40:	48 01 c2             	add    %rax,%rdx
+  804e43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e47:	48 89 c6             	mov    %rax,%rsi
+  804e4a:	48 89 d7             	mov    %rdx,%rdi
+  804e4d:	48 b8 68 cd ff ff ff 	movabs $0xffffffffffffcd68,%rax
+  804e54:	ff ff ff 
+  804e57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e5b:	ff d0                	call   *%rax
+	return dst;
+  804e5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  804e61:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804e65:	c9                   	leave
+  804e66:	c3                   	ret
+
+0000000000804e67 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  804e67:	55                   	push   %rbp
+  804e68:	48 89 e5             	mov    %rsp,%rbp
+  804e6b:	48 83 ec 28          	sub    $0x28,%rsp
+  804e6f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e6f <strncpy+0x8>
+  804e76:	49 bb c9 31 00 00 00 	movabs $0x31c9,%r11
+  804e7d:	00 00 00 
+  804e80:	4c 01 d8             	add    %r11,%rax
+  804e83:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e87:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804e8b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  804e8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e93:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  804e97:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804e9e:	00 
+  804e9f:	eb 2a                	jmp    804ecb <strncpy+0x64>
+		*dst++ = *src;
+  804ea1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ea5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804ea9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804ead:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804eb1:	0f b6 12             	movzbl (%rdx),%edx
+  804eb4:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  804eb6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804eba:	0f b6 00             	movzbl (%rax),%eax
+  804ebd:	84 c0                	test   %al,%al
+  804ebf:	74 05                	je     804ec6 <strncpy+0x5f>
+			src++;
+  804ec1:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  804ec6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804ecb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ecf:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804ed3:	72 cc                	jb     804ea1 <strncpy+0x3a>
+	}
+	return ret;
+  804ed5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804ed9:	c9                   	leave
+  804eda:	c3                   	ret
+
+0000000000804edb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  804edb:	55                   	push   %rbp
+  804edc:	48 89 e5             	mov    %rsp,%rbp
+  804edf:	48 83 ec 28          	sub    $0x28,%rsp
+  804ee3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804ee3 <strlcpy+0x8>
+  804eea:	49 bb 55 31 00 00 00 	movabs $0x3155,%r11
+  804ef1:	00 00 00 
+  804ef4:	4c 01 d8             	add    %r11,%rax
+  804ef7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804efb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804eff:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  804f03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f07:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  804f0b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804f10:	74 3d                	je     804f4f <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  804f12:	eb 1d                	jmp    804f31 <strlcpy+0x56>
+			*dst++ = *src++;
+  804f14:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f18:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804f1c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804f20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f24:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804f28:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804f2c:	0f b6 12             	movzbl (%rdx),%edx
+  804f2f:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  804f31:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804f36:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804f3b:	74 0b                	je     804f48 <strlcpy+0x6d>
+  804f3d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f41:	0f b6 00             	movzbl (%rax),%eax
+  804f44:	84 c0                	test   %al,%al
+  804f46:	75 cc                	jne    804f14 <strlcpy+0x39>
+		*dst = '\0';
+  804f48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f4c:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  804f4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f53:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  804f57:	c9                   	leave
+  804f58:	c3                   	ret
+
+0000000000804f59 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  804f59:	55                   	push   %rbp
+  804f5a:	48 89 e5             	mov    %rsp,%rbp
+  804f5d:	48 83 ec 10          	sub    $0x10,%rsp
+  804f61:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804f61 <strcmp+0x8>
+  804f68:	49 bb d7 30 00 00 00 	movabs $0x30d7,%r11
+  804f6f:	00 00 00 
+  804f72:	4c 01 d8             	add    %r11,%rax
+  804f75:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804f79:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  804f7d:	eb 0a                	jmp    804f89 <strcmp+0x30>
+		p++, q++;
+  804f7f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804f84:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  804f89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f8d:	0f b6 00             	movzbl (%rax),%eax
+  804f90:	84 c0                	test   %al,%al
+  804f92:	74 12                	je     804fa6 <strcmp+0x4d>
+  804f94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f98:	0f b6 10             	movzbl (%rax),%edx
+  804f9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f9f:	0f b6 00             	movzbl (%rax),%eax
+  804fa2:	38 c2                	cmp    %al,%dl
+  804fa4:	74 d9                	je     804f7f <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  804fa6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804faa:	0f b6 00             	movzbl (%rax),%eax
+  804fad:	0f b6 d0             	movzbl %al,%edx
+  804fb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fb4:	0f b6 00             	movzbl (%rax),%eax
+  804fb7:	0f b6 c0             	movzbl %al,%eax
+  804fba:	29 c2                	sub    %eax,%edx
+  804fbc:	89 d0                	mov    %edx,%eax
+}
+  804fbe:	c9                   	leave
+  804fbf:	c3                   	ret
+
+0000000000804fc0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  804fc0:	55                   	push   %rbp
+  804fc1:	48 89 e5             	mov    %rsp,%rbp
+  804fc4:	48 83 ec 18          	sub    $0x18,%rsp
+  804fc8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804fc8 <strncmp+0x8>
+  804fcf:	49 bb 70 30 00 00 00 	movabs $0x3070,%r11
+  804fd6:	00 00 00 
+  804fd9:	4c 01 d8             	add    %r11,%rax
+  804fdc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804fe0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804fe4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  804fe8:	eb 0f                	jmp    804ff9 <strncmp+0x39>
+		n--, p++, q++;
+  804fea:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  804fef:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804ff4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  804ff9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804ffe:	74 1d                	je     80501d <strncmp+0x5d>
+  805000:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805004:	0f b6 00             	movzbl (%rax),%eax
+  805007:	84 c0                	test   %al,%al
+  805009:	74 12                	je     80501d <strncmp+0x5d>
+  80500b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80500f:	0f b6 10             	movzbl (%rax),%edx
+  805012:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805016:	0f b6 00             	movzbl (%rax),%eax
+  805019:	38 c2                	cmp    %al,%dl
+  80501b:	74 cd                	je     804fea <strncmp+0x2a>
+	if (n == 0)
+  80501d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805022:	75 07                	jne    80502b <strncmp+0x6b>
+		return 0;
+  805024:	ba 00 00 00 00       	mov    $0x0,%edx
+  805029:	eb 16                	jmp    805041 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80502b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80502f:	0f b6 00             	movzbl (%rax),%eax
+  805032:	0f b6 d0             	movzbl %al,%edx
+  805035:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805039:	0f b6 00             	movzbl (%rax),%eax
+  80503c:	0f b6 c0             	movzbl %al,%eax
+  80503f:	29 c2                	sub    %eax,%edx
+}
+  805041:	89 d0                	mov    %edx,%eax
+  805043:	c9                   	leave
+  805044:	c3                   	ret
+
+0000000000805045 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  805045:	55                   	push   %rbp
+  805046:	48 89 e5             	mov    %rsp,%rbp
+  805049:	48 83 ec 10          	sub    $0x10,%rsp
+  80504d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80504d <strchr+0x8>
+  805054:	49 bb eb 2f 00 00 00 	movabs $0x2feb,%r11
+  80505b:	00 00 00 
+  80505e:	4c 01 d8             	add    %r11,%rax
+  805061:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805065:	89 f0                	mov    %esi,%eax
+  805067:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80506a:	eb 17                	jmp    805083 <strchr+0x3e>
+		if (*s == c)
+  80506c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805070:	0f b6 00             	movzbl (%rax),%eax
+  805073:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  805076:	75 06                	jne    80507e <strchr+0x39>
+			return (char *) s;
+  805078:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80507c:	eb 15                	jmp    805093 <strchr+0x4e>
+	for (; *s; s++)
+  80507e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  805083:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805087:	0f b6 00             	movzbl (%rax),%eax
+  80508a:	84 c0                	test   %al,%al
+  80508c:	75 de                	jne    80506c <strchr+0x27>
+	return 0;
+  80508e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805093:	c9                   	leave
+  805094:	c3                   	ret
+
+0000000000805095 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  805095:	55                   	push   %rbp
+  805096:	48 89 e5             	mov    %rsp,%rbp
+  805099:	48 83 ec 10          	sub    $0x10,%rsp
+  80509d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80509d <strfind+0x8>
+  8050a4:	49 bb 9b 2f 00 00 00 	movabs $0x2f9b,%r11
+  8050ab:	00 00 00 
+  8050ae:	4c 01 d8             	add    %r11,%rax
+  8050b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8050b5:	89 f0                	mov    %esi,%eax
+  8050b7:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8050ba:	eb 11                	jmp    8050cd <strfind+0x38>
+		if (*s == c)
+  8050bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050c0:	0f b6 00             	movzbl (%rax),%eax
+  8050c3:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8050c6:	74 12                	je     8050da <strfind+0x45>
+	for (; *s; s++)
+  8050c8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8050cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050d1:	0f b6 00             	movzbl (%rax),%eax
+  8050d4:	84 c0                	test   %al,%al
+  8050d6:	75 e4                	jne    8050bc <strfind+0x27>
+  8050d8:	eb 01                	jmp    8050db <strfind+0x46>
+			break;
+  8050da:	90                   	nop
+	return (char *) s;
+  8050db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8050df:	c9                   	leave
+  8050e0:	c3                   	ret
+
+00000000008050e1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8050e1:	55                   	push   %rbp
+  8050e2:	48 89 e5             	mov    %rsp,%rbp
+  8050e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8050e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050e9 <memset+0x8>
+  8050f0:	49 bb 4f 2f 00 00 00 	movabs $0x2f4f,%r11
+  8050f7:	00 00 00 
+  8050fa:	4c 01 d8             	add    %r11,%rax
+  8050fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805101:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  805104:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  805108:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80510d:	75 06                	jne    805115 <memset+0x34>
+		return v;
+  80510f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805113:	eb 69                	jmp    80517e <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  805115:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805119:	83 e0 03             	and    $0x3,%eax
+  80511c:	48 85 c0             	test   %rax,%rax
+  80511f:	75 48                	jne    805169 <memset+0x88>
+  805121:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805125:	83 e0 03             	and    $0x3,%eax
+  805128:	48 85 c0             	test   %rax,%rax
+  80512b:	75 3c                	jne    805169 <memset+0x88>
+		c &= 0xFF;
+  80512d:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  805134:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805137:	c1 e0 18             	shl    $0x18,%eax
+  80513a:	89 c2                	mov    %eax,%edx
+  80513c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80513f:	c1 e0 10             	shl    $0x10,%eax
+  805142:	09 c2                	or     %eax,%edx
+  805144:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805147:	c1 e0 08             	shl    $0x8,%eax
+  80514a:	09 d0                	or     %edx,%eax
+  80514c:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  80514f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805153:	48 c1 e8 02          	shr    $0x2,%rax
+  805157:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  80515a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80515e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805161:	48 89 d7             	mov    %rdx,%rdi
+  805164:	fc                   	cld
+  805165:	f3 ab                	rep stos %eax,%es:(%rdi)
+  805167:	eb 11                	jmp    80517a <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  805169:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80516d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805170:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805174:	48 89 d7             	mov    %rdx,%rdi
+  805177:	fc                   	cld
+  805178:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  80517a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80517e:	c9                   	leave
+  80517f:	c3                   	ret
+
+0000000000805180 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  805180:	55                   	push   %rbp
+  805181:	48 89 e5             	mov    %rsp,%rbp
+  805184:	48 83 ec 28          	sub    $0x28,%rsp
+  805188:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805188 <memmove+0x8>
+  80518f:	49 bb b0 2e 00 00 00 	movabs $0x2eb0,%r11
+  805196:	00 00 00 
+  805199:	4c 01 d8             	add    %r11,%rax
+  80519c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8051a0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8051a4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8051a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8051b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051b4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8051b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051bc:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8051c0:	0f 83 88 00 00 00    	jae    80524e <memmove+0xce>
+  8051c6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8051ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051ce:	48 01 d0             	add    %rdx,%rax
+  8051d1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8051d5:	73 77                	jae    80524e <memmove+0xce>
+		s += n;
+  8051d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051db:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8051df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051e3:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8051e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051eb:	83 e0 03             	and    $0x3,%eax
+  8051ee:	48 85 c0             	test   %rax,%rax
+  8051f1:	75 3b                	jne    80522e <memmove+0xae>
+  8051f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051f7:	83 e0 03             	and    $0x3,%eax
+  8051fa:	48 85 c0             	test   %rax,%rax
+  8051fd:	75 2f                	jne    80522e <memmove+0xae>
+  8051ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805203:	83 e0 03             	and    $0x3,%eax
+  805206:	48 85 c0             	test   %rax,%rax
+  805209:	75 23                	jne    80522e <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80520b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80520f:	48 83 e8 04          	sub    $0x4,%rax
+  805213:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805217:	48 83 ea 04          	sub    $0x4,%rdx
+  80521b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80521f:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  805223:	48 89 c7             	mov    %rax,%rdi
+  805226:	48 89 d6             	mov    %rdx,%rsi
+  805229:	fd                   	std
+  80522a:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80522c:	eb 1d                	jmp    80524b <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80522e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805232:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805236:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80523a:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  80523e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805242:	48 89 d7             	mov    %rdx,%rdi
+  805245:	48 89 c1             	mov    %rax,%rcx
+  805248:	fd                   	std
+  805249:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80524b:	fc                   	cld
+  80524c:	eb 57                	jmp    8052a5 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80524e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805252:	83 e0 03             	and    $0x3,%eax
+  805255:	48 85 c0             	test   %rax,%rax
+  805258:	75 36                	jne    805290 <memmove+0x110>
+  80525a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80525e:	83 e0 03             	and    $0x3,%eax
+  805261:	48 85 c0             	test   %rax,%rax
+  805264:	75 2a                	jne    805290 <memmove+0x110>
+  805266:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80526a:	83 e0 03             	and    $0x3,%eax
+  80526d:	48 85 c0             	test   %rax,%rax
+  805270:	75 1e                	jne    805290 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  805272:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805276:	48 c1 e8 02          	shr    $0x2,%rax
+  80527a:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  80527d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805281:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805285:	48 89 c7             	mov    %rax,%rdi
+  805288:	48 89 d6             	mov    %rdx,%rsi
+  80528b:	fc                   	cld
+  80528c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80528e:	eb 15                	jmp    8052a5 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  805290:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805294:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805298:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80529c:	48 89 c7             	mov    %rax,%rdi
+  80529f:	48 89 d6             	mov    %rdx,%rsi
+  8052a2:	fc                   	cld
+  8052a3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8052a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8052a9:	c9                   	leave
+  8052aa:	c3                   	ret
+
+00000000008052ab <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8052ab:	55                   	push   %rbp
+  8052ac:	48 89 e5             	mov    %rsp,%rbp
+  8052af:	48 83 ec 18          	sub    $0x18,%rsp
+  8052b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8052b3 <memcpy+0x8>
+  8052ba:	49 bb 85 2d 00 00 00 	movabs $0x2d85,%r11
+  8052c1:	00 00 00 
+  8052c4:	4c 01 d8             	add    %r11,%rax
+  8052c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8052cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8052cf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8052d3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8052d7:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8052db:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8052df:	48 89 cf             	mov    %rcx,%rdi
+  8052e2:	48 b9 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rcx
+  8052e9:	ff ff ff 
+  8052ec:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8052f0:	ff d0                	call   *%rax
+}
+  8052f2:	c9                   	leave
+  8052f3:	c3                   	ret
+
+00000000008052f4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8052f4:	55                   	push   %rbp
+  8052f5:	48 89 e5             	mov    %rsp,%rbp
+  8052f8:	48 83 ec 28          	sub    $0x28,%rsp
+  8052fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8052fc <memcmp+0x8>
+  805303:	49 bb 3c 2d 00 00 00 	movabs $0x2d3c,%r11
+  80530a:	00 00 00 
+  80530d:	4c 01 d8             	add    %r11,%rax
+  805310:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805314:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805318:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80531c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805320:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  805324:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805328:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80532c:	eb 34                	jmp    805362 <memcmp+0x6e>
+		if (*s1 != *s2)
+  80532e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805332:	0f b6 10             	movzbl (%rax),%edx
+  805335:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805339:	0f b6 00             	movzbl (%rax),%eax
+  80533c:	38 c2                	cmp    %al,%dl
+  80533e:	74 18                	je     805358 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  805340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805344:	0f b6 00             	movzbl (%rax),%eax
+  805347:	0f b6 d0             	movzbl %al,%edx
+  80534a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80534e:	0f b6 00             	movzbl (%rax),%eax
+  805351:	0f b6 c0             	movzbl %al,%eax
+  805354:	29 c2                	sub    %eax,%edx
+  805356:	eb 20                	jmp    805378 <memcmp+0x84>
+		s1++, s2++;
+  805358:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80535d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  805362:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805366:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80536a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80536e:	48 85 c0             	test   %rax,%rax
+  805371:	75 bb                	jne    80532e <memcmp+0x3a>
+	}
+
+	return 0;
+  805373:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  805378:	89 d0                	mov    %edx,%eax
+  80537a:	c9                   	leave
+  80537b:	c3                   	ret
+
+000000000080537c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80537c:	55                   	push   %rbp
+  80537d:	48 89 e5             	mov    %rsp,%rbp
+  805380:	48 83 ec 28          	sub    $0x28,%rsp
+  805384:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805384 <memfind+0x8>
+  80538b:	49 bb b4 2c 00 00 00 	movabs $0x2cb4,%r11
+  805392:	00 00 00 
+  805395:	4c 01 d8             	add    %r11,%rax
+  805398:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80539c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80539f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8053a3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8053a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053ab:	48 01 d0             	add    %rdx,%rax
+  8053ae:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8053b2:	eb 13                	jmp    8053c7 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8053b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053b8:	0f b6 00             	movzbl (%rax),%eax
+  8053bb:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8053be:	38 d0                	cmp    %dl,%al
+  8053c0:	74 11                	je     8053d3 <memfind+0x57>
+	for (; s < ends; s++)
+  8053c2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8053c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053cb:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8053cf:	72 e3                	jb     8053b4 <memfind+0x38>
+  8053d1:	eb 01                	jmp    8053d4 <memfind+0x58>
+			break;
+  8053d3:	90                   	nop
+	return (void *) s;
+  8053d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8053d8:	c9                   	leave
+  8053d9:	c3                   	ret
+
+00000000008053da <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8053da:	55                   	push   %rbp
+  8053db:	48 89 e5             	mov    %rsp,%rbp
+  8053de:	48 83 ec 38          	sub    $0x38,%rsp
+  8053e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8053e2 <strtol+0x8>
+  8053e9:	49 bb 56 2c 00 00 00 	movabs $0x2c56,%r11
+  8053f0:	00 00 00 
+  8053f3:	4c 01 d8             	add    %r11,%rax
+  8053f6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8053fa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8053fe:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  805401:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  805408:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80540f:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  805410:	eb 05                	jmp    805417 <strtol+0x3d>
+		s++;
+  805412:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  805417:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80541b:	0f b6 00             	movzbl (%rax),%eax
+  80541e:	3c 20                	cmp    $0x20,%al
+  805420:	74 f0                	je     805412 <strtol+0x38>
+  805422:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805426:	0f b6 00             	movzbl (%rax),%eax
+  805429:	3c 09                	cmp    $0x9,%al
+  80542b:	74 e5                	je     805412 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  80542d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805431:	0f b6 00             	movzbl (%rax),%eax
+  805434:	3c 2b                	cmp    $0x2b,%al
+  805436:	75 07                	jne    80543f <strtol+0x65>
+		s++;
+  805438:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80543d:	eb 17                	jmp    805456 <strtol+0x7c>
+	else if (*s == '-')
+  80543f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805443:	0f b6 00             	movzbl (%rax),%eax
+  805446:	3c 2d                	cmp    $0x2d,%al
+  805448:	75 0c                	jne    805456 <strtol+0x7c>
+		s++, neg = 1;
+  80544a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80544f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  805456:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80545a:	74 06                	je     805462 <strtol+0x88>
+  80545c:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  805460:	75 28                	jne    80548a <strtol+0xb0>
+  805462:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805466:	0f b6 00             	movzbl (%rax),%eax
+  805469:	3c 30                	cmp    $0x30,%al
+  80546b:	75 1d                	jne    80548a <strtol+0xb0>
+  80546d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805471:	48 83 c0 01          	add    $0x1,%rax
+  805475:	0f b6 00             	movzbl (%rax),%eax
+  805478:	3c 78                	cmp    $0x78,%al
+  80547a:	75 0e                	jne    80548a <strtol+0xb0>
+		s += 2, base = 16;
+  80547c:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  805481:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  805488:	eb 2c                	jmp    8054b6 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  80548a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80548e:	75 19                	jne    8054a9 <strtol+0xcf>
+  805490:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805494:	0f b6 00             	movzbl (%rax),%eax
+  805497:	3c 30                	cmp    $0x30,%al
+  805499:	75 0e                	jne    8054a9 <strtol+0xcf>
+		s++, base = 8;
+  80549b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8054a0:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8054a7:	eb 0d                	jmp    8054b6 <strtol+0xdc>
+	else if (base == 0)
+  8054a9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8054ad:	75 07                	jne    8054b6 <strtol+0xdc>
+		base = 10;
+  8054af:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8054b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054ba:	0f b6 00             	movzbl (%rax),%eax
+  8054bd:	3c 2f                	cmp    $0x2f,%al
+  8054bf:	7e 1d                	jle    8054de <strtol+0x104>
+  8054c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054c5:	0f b6 00             	movzbl (%rax),%eax
+  8054c8:	3c 39                	cmp    $0x39,%al
+  8054ca:	7f 12                	jg     8054de <strtol+0x104>
+			dig = *s - '0';
+  8054cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054d0:	0f b6 00             	movzbl (%rax),%eax
+  8054d3:	0f be c0             	movsbl %al,%eax
+  8054d6:	83 e8 30             	sub    $0x30,%eax
+  8054d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054dc:	eb 4e                	jmp    80552c <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  8054de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054e2:	0f b6 00             	movzbl (%rax),%eax
+  8054e5:	3c 60                	cmp    $0x60,%al
+  8054e7:	7e 1d                	jle    805506 <strtol+0x12c>
+  8054e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054ed:	0f b6 00             	movzbl (%rax),%eax
+  8054f0:	3c 7a                	cmp    $0x7a,%al
+  8054f2:	7f 12                	jg     805506 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  8054f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054f8:	0f b6 00             	movzbl (%rax),%eax
+  8054fb:	0f be c0             	movsbl %al,%eax
+  8054fe:	83 e8 57             	sub    $0x57,%eax
+  805501:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805504:	eb 26                	jmp    80552c <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  805506:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80550a:	0f b6 00             	movzbl (%rax),%eax
+  80550d:	3c 40                	cmp    $0x40,%al
+  80550f:	7e 47                	jle    805558 <strtol+0x17e>
+  805511:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805515:	0f b6 00             	movzbl (%rax),%eax
+  805518:	3c 5a                	cmp    $0x5a,%al
+  80551a:	7f 3c                	jg     805558 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  80551c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805520:	0f b6 00             	movzbl (%rax),%eax
+  805523:	0f be c0             	movsbl %al,%eax
+  805526:	83 e8 37             	sub    $0x37,%eax
+  805529:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80552c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80552f:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  805532:	7d 23                	jge    805557 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  805534:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  805539:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80553c:	48 98                	cltq
+  80553e:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  805543:	48 89 c2             	mov    %rax,%rdx
+  805546:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805549:	48 98                	cltq
+  80554b:	48 01 d0             	add    %rdx,%rax
+  80554e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  805552:	e9 5f ff ff ff       	jmp    8054b6 <strtol+0xdc>
+			break;
+  805557:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  805558:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80555d:	74 0b                	je     80556a <strtol+0x190>
+		*endptr = (char *) s;
+  80555f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805563:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805567:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  80556a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80556e:	74 09                	je     805579 <strtol+0x19f>
+  805570:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805574:	48 f7 d8             	neg    %rax
+  805577:	eb 04                	jmp    80557d <strtol+0x1a3>
+  805579:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80557d:	c9                   	leave
+  80557e:	c3                   	ret
+
+000000000080557f <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  80557f:	55                   	push   %rbp
+  805580:	48 89 e5             	mov    %rsp,%rbp
+  805583:	53                   	push   %rbx
+  805584:	48 83 ec 30          	sub    $0x30,%rsp
+  805588:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805588 <strstr+0x9>
+  80558f:	49 bb b0 2a 00 00 00 	movabs $0x2ab0,%r11
+  805596:	00 00 00 
+  805599:	4c 01 db             	add    %r11,%rbx
+  80559c:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  8055a0:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  8055a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055a8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8055ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8055b0:	0f b6 00             	movzbl (%rax),%eax
+  8055b3:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  8055b6:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  8055ba:	75 06                	jne    8055c2 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  8055bc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8055c0:	eb 73                	jmp    805635 <strstr+0xb6>
+
+	len = strlen(str);
+  8055c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055c6:	48 89 c7             	mov    %rax,%rdi
+  8055c9:	48 b8 d4 cc ff ff ff 	movabs $0xffffffffffffccd4,%rax
+  8055d0:	ff ff ff 
+  8055d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055d7:	ff d0                	call   *%rax
+  8055d9:	48 98                	cltq
+  8055db:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  8055df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8055e3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8055e7:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8055eb:	0f b6 00             	movzbl (%rax),%eax
+  8055ee:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  8055f1:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  8055f5:	75 07                	jne    8055fe <strstr+0x7f>
+				return (char *) 0;
+  8055f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055fc:	eb 37                	jmp    805635 <strstr+0xb6>
+		} while (sc != c);
+  8055fe:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  805602:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  805605:	75 d8                	jne    8055df <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  805607:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80560b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80560f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805613:	48 89 ce             	mov    %rcx,%rsi
+  805616:	48 89 c7             	mov    %rax,%rdi
+  805619:	48 b8 88 cf ff ff ff 	movabs $0xffffffffffffcf88,%rax
+  805620:	ff ff ff 
+  805623:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805627:	ff d0                	call   *%rax
+  805629:	85 c0                	test   %eax,%eax
+  80562b:	75 b2                	jne    8055df <strstr+0x60>
+
+	return (char *) (in - 1);
+  80562d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805631:	48 83 e8 01          	sub    $0x1,%rax
+}
+  805635:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805639:	c9                   	leave
+  80563a:	c3                   	ret
+
+000000000080563b <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80563b:	55                   	push   %rbp
+  80563c:	48 89 e5             	mov    %rsp,%rbp
+  80563f:	41 57                	push   %r15
+  805641:	53                   	push   %rbx
+  805642:	48 83 ec 20          	sub    $0x20,%rsp
+  805646:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805646 <set_pgfault_handler+0xb>
+  80564d:	49 bb f2 29 00 00 00 	movabs $0x29f2,%r11
+  805654:	00 00 00 
+  805657:	4c 01 db             	add    %r11,%rbx
+  80565a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  80565e:	49 89 df             	mov    %rbx,%r15
+  805661:	48 b8 ec 84 ff ff ff 	movabs $0xffffffffffff84ec,%rax
+  805668:	ff ff ff 
+  80566b:	48 01 d8             	add    %rbx,%rax
+  80566e:	ff d0                	call   *%rax
+  805670:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  805673:	48 b8 c8 4f 01 00 00 	movabs $0x14fc8,%rax
+  80567a:	00 00 00 
+  80567d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805681:	48 85 c0             	test   %rax,%rax
+  805684:	75 6b                	jne    8056f1 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  805686:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805689:	ba 07 00 00 00       	mov    $0x7,%edx
+  80568e:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  805693:	48 89 ce             	mov    %rcx,%rsi
+  805696:	89 c7                	mov    %eax,%edi
+  805698:	49 89 df             	mov    %rbx,%r15
+  80569b:	48 b8 95 85 ff ff ff 	movabs $0xffffffffffff8595,%rax
+  8056a2:	ff ff ff 
+  8056a5:	48 01 d8             	add    %rbx,%rax
+  8056a8:	ff d0                	call   *%rax
+  8056aa:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  8056ad:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8056b1:	74 3e                	je     8056f1 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  8056b3:	48 b8 38 e5 ff ff ff 	movabs $0xffffffffffffe538,%rax
+  8056ba:	ff ff ff 
+  8056bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056c1:	48 89 c2             	mov    %rax,%rdx
+  8056c4:	be 23 00 00 00       	mov    $0x23,%esi
+  8056c9:	48 b8 66 e5 ff ff ff 	movabs $0xffffffffffffe566,%rax
+  8056d0:	ff ff ff 
+  8056d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056d7:	48 89 c7             	mov    %rax,%rdi
+  8056da:	49 89 df             	mov    %rbx,%r15
+  8056dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056e2:	48 b9 cf bc ff ff ff 	movabs $0xffffffffffffbccf,%rcx
+  8056e9:	ff ff ff 
+  8056ec:	48 01 d9             	add    %rbx,%rcx
+  8056ef:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8056f1:	48 ba c8 4f 01 00 00 	movabs $0x14fc8,%rdx
+  8056f8:	00 00 00 
+  8056fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8056ff:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  805703:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805706:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80570d:	ff ff ff 
+  805710:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  805714:	48 89 d6             	mov    %rdx,%rsi
+  805717:	89 c7                	mov    %eax,%edi
+  805719:	49 89 df             	mov    %rbx,%r15
+  80571c:	48 b8 8b 87 ff ff ff 	movabs $0xffffffffffff878b,%rax
+  805723:	ff ff ff 
+  805726:	48 01 d8             	add    %rbx,%rax
+  805729:	ff d0                	call   *%rax
+}
+  80572b:	90                   	nop
+  80572c:	48 83 c4 20          	add    $0x20,%rsp
+  805730:	5b                   	pop    %rbx
+  805731:	41 5f                	pop    %r15
+  805733:	5d                   	pop    %rbp
+  805734:	c3                   	ret
+
+0000000000805735 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805735:	55                   	push   %rbp
+  805736:	48 89 e5             	mov    %rsp,%rbp
+  805739:	41 57                	push   %r15
+  80573b:	53                   	push   %rbx
+  80573c:	48 83 ec 30          	sub    $0x30,%rsp
+  805740:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805740 <ipc_recv+0xb>
+  805747:	49 bb f8 28 00 00 00 	movabs $0x28f8,%r11
+  80574e:	00 00 00 
+  805751:	4c 01 db             	add    %r11,%rbx
+  805754:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805758:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80575c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  805760:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805765:	75 0e                	jne    805775 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805767:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80576e:	00 00 00 
+  805771:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  805775:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805779:	48 89 c7             	mov    %rax,%rdi
+  80577c:	49 89 df             	mov    %rbx,%r15
+  80577f:	48 b8 be 88 ff ff ff 	movabs $0xffffffffffff88be,%rax
+  805786:	ff ff ff 
+  805789:	48 01 d8             	add    %rbx,%rax
+  80578c:	ff d0                	call   *%rax
+  80578e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  805791:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805796:	74 2a                	je     8057c2 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805798:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80579c:	75 19                	jne    8057b7 <ipc_recv+0x82>
+  80579e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8057a5:	ff ff ff 
+  8057a8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8057ac:	48 8b 00             	mov    (%rax),%rax
+  8057af:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8057b5:	eb 05                	jmp    8057bc <ipc_recv+0x87>
+  8057b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057bc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8057c0:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8057c2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8057c7:	74 2a                	je     8057f3 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8057c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057cd:	75 19                	jne    8057e8 <ipc_recv+0xb3>
+  8057cf:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8057d6:	ff ff ff 
+  8057d9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8057dd:	48 8b 00             	mov    (%rax),%rax
+  8057e0:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8057e6:	eb 05                	jmp    8057ed <ipc_recv+0xb8>
+  8057e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057ed:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8057f1:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  8057f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057f7:	74 05                	je     8057fe <ipc_recv+0xc9>
+		return res;
+  8057f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057fc:	eb 17                	jmp    805815 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  8057fe:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805805:	ff ff ff 
+  805808:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80580c:	48 8b 00             	mov    (%rax),%rax
+  80580f:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805815:	48 83 c4 30          	add    $0x30,%rsp
+  805819:	5b                   	pop    %rbx
+  80581a:	41 5f                	pop    %r15
+  80581c:	5d                   	pop    %rbp
+  80581d:	c3                   	ret
+
+000000000080581e <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80581e:	55                   	push   %rbp
+  80581f:	48 89 e5             	mov    %rsp,%rbp
+  805822:	41 57                	push   %r15
+  805824:	53                   	push   %rbx
+  805825:	48 83 ec 20          	sub    $0x20,%rsp
+  805829:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805829 <ipc_send+0xb>
+  805830:	49 bb 0f 28 00 00 00 	movabs $0x280f,%r11
+  805837:	00 00 00 
+  80583a:	4c 01 db             	add    %r11,%rbx
+  80583d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805840:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805843:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805847:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  80584a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80584f:	75 0e                	jne    80585f <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805851:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805858:	00 00 00 
+  80585b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  80585f:	90                   	nop
+  805860:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805863:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805866:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80586a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80586d:	89 c7                	mov    %eax,%edi
+  80586f:	49 89 df             	mov    %rbx,%r15
+  805872:	48 b8 54 88 ff ff ff 	movabs $0xffffffffffff8854,%rax
+  805879:	ff ff ff 
+  80587c:	48 01 d8             	add    %rbx,%rax
+  80587f:	ff d0                	call   *%rax
+  805881:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805884:	74 da                	je     805860 <ipc_send+0x42>
+		;
+}
+  805886:	90                   	nop
+  805887:	90                   	nop
+  805888:	48 83 c4 20          	add    $0x20,%rsp
+  80588c:	5b                   	pop    %rbx
+  80588d:	41 5f                	pop    %r15
+  80588f:	5d                   	pop    %rbp
+  805890:	c3                   	ret
+
+0000000000805891 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805891:	55                   	push   %rbp
+  805892:	48 89 e5             	mov    %rsp,%rbp
+  805895:	41 57                	push   %r15
+  805897:	53                   	push   %rbx
+  805898:	48 83 ec 40          	sub    $0x40,%rsp
+  80589c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80589c <ipc_call+0xb>
+  8058a3:	49 bb 9c 27 00 00 00 	movabs $0x279c,%r11
+  8058aa:	00 00 00 
+  8058ad:	4c 01 db             	add    %r11,%rbx
+  8058b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8058b3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8058b6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8058ba:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8058bd:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8058c1:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8058c5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8058ca:	75 0e                	jne    8058da <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  8058cc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8058d3:	00 00 00 
+  8058d6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8058da:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8058df:	75 0e                	jne    8058ef <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8058e1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8058e8:	00 00 00 
+  8058eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8058ef:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8058f2:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8058f6:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8058f9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8058fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805900:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805906:	49 89 f8             	mov    %rdi,%r8
+  805909:	89 c7                	mov    %eax,%edi
+  80590b:	49 89 df             	mov    %rbx,%r15
+  80590e:	48 b8 17 89 ff ff ff 	movabs $0xffffffffffff8917,%rax
+  805915:	ff ff ff 
+  805918:	48 01 d8             	add    %rbx,%rax
+  80591b:	ff d0                	call   *%rax
+  80591d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805920:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805925:	74 2a                	je     805951 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805927:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80592b:	75 19                	jne    805946 <ipc_call+0xb5>
+  80592d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805934:	ff ff ff 
+  805937:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80593b:	48 8b 00             	mov    (%rax),%rax
+  80593e:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805944:	eb 05                	jmp    80594b <ipc_call+0xba>
+  805946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80594b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80594f:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805951:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805955:	74 05                	je     80595c <ipc_call+0xcb>
+		return r;
+  805957:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80595a:	eb 17                	jmp    805973 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  80595c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805963:	ff ff ff 
+  805966:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80596a:	48 8b 00             	mov    (%rax),%rax
+  80596d:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805973:	48 83 c4 40          	add    $0x40,%rsp
+  805977:	5b                   	pop    %rbx
+  805978:	41 5f                	pop    %r15
+  80597a:	5d                   	pop    %rbp
+  80597b:	c3                   	ret
+
+000000000080597c <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  80597c:	55                   	push   %rbp
+  80597d:	48 89 e5             	mov    %rsp,%rbp
+  805980:	41 57                	push   %r15
+  805982:	53                   	push   %rbx
+  805983:	48 83 ec 70          	sub    $0x70,%rsp
+  805987:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805987 <ipc_callw+0xb>
+  80598e:	49 bb b1 26 00 00 00 	movabs $0x26b1,%r11
+  805995:	00 00 00 
+  805998:	4c 01 db             	add    %r11,%rbx
+  80599b:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  80599e:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8059a1:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8059a5:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8059a9:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8059ae:	76 0a                	jbe    8059ba <ipc_callw+0x3e>
+		return -E_INVAL;
+  8059b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8059b5:	e9 b7 00 00 00       	jmp    805a71 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8059ba:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8059be:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8059c2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8059c6:	48 89 ce             	mov    %rcx,%rsi
+  8059c9:	48 89 c7             	mov    %rax,%rdi
+  8059cc:	49 89 df             	mov    %rbx,%r15
+  8059cf:	48 b8 48 d1 ff ff ff 	movabs $0xffffffffffffd148,%rax
+  8059d6:	ff ff ff 
+  8059d9:	48 01 d8             	add    %rbx,%rax
+  8059dc:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  8059de:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8059e5:	00 
+  8059e6:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8059ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059ee:	48 01 d0             	add    %rdx,%rax
+  8059f1:	48 83 e8 01          	sub    $0x1,%rax
+  8059f5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8059f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a02:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805a06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a0a:	48 29 d0             	sub    %rdx,%rax
+  805a0d:	48 c1 e8 03          	shr    $0x3,%rax
+  805a11:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805a15:	89 c1                	mov    %eax,%ecx
+  805a17:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805a1a:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805a1e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805a21:	49 89 d1             	mov    %rdx,%r9
+  805a24:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805a2b:	00 00 00 
+  805a2e:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805a35:	00 00 00 
+  805a38:	89 c7                	mov    %eax,%edi
+  805a3a:	49 89 df             	mov    %rbx,%r15
+  805a3d:	48 b8 17 89 ff ff ff 	movabs $0xffffffffffff8917,%rax
+  805a44:	ff ff ff 
+  805a47:	48 01 d8             	add    %rbx,%rax
+  805a4a:	ff d0                	call   *%rax
+  805a4c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805a4f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805a53:	74 05                	je     805a5a <ipc_callw+0xde>
+		return r;
+  805a55:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a58:	eb 17                	jmp    805a71 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805a5a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a61:	ff ff ff 
+  805a64:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a68:	48 8b 00             	mov    (%rax),%rax
+  805a6b:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805a71:	48 83 c4 70          	add    $0x70,%rsp
+  805a75:	5b                   	pop    %rbx
+  805a76:	41 5f                	pop    %r15
+  805a78:	5d                   	pop    %rbp
+  805a79:	c3                   	ret
+
+0000000000805a7a <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805a7a:	55                   	push   %rbp
+  805a7b:	48 89 e5             	mov    %rsp,%rbp
+  805a7e:	41 57                	push   %r15
+  805a80:	53                   	push   %rbx
+  805a81:	48 83 ec 40          	sub    $0x40,%rsp
+  805a85:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a85 <ipc_callv+0xb>
+  805a8c:	49 bb b3 25 00 00 00 	movabs $0x25b3,%r11
+  805a93:	00 00 00 
+  805a96:	4c 01 db             	add    %r11,%rbx
+  805a99:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805a9c:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805a9f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805aa3:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805aa6:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805aaa:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805aae:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805ab5:	00 00 00 
+  805ab8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805abc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805ac0:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805ac4:	74 11                	je     805ad7 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805ac6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805aca:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805ace:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805ad1:	c1 e0 14             	shl    $0x14,%eax
+  805ad4:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805ad7:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805adb:	74 14                	je     805af1 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805add:	8b 45 20             	mov    0x20(%rbp),%eax
+  805ae0:	83 e8 01             	sub    $0x1,%eax
+  805ae3:	48 63 d0             	movslq %eax,%rdx
+  805ae6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805aea:	48 09 d0             	or     %rdx,%rax
+  805aed:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805af1:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805af4:	c1 e0 10             	shl    $0x10,%eax
+  805af7:	0b 45 10             	or     0x10(%rbp),%eax
+  805afa:	89 c1                	mov    %eax,%ecx
+  805afc:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805aff:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805b03:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805b07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805b0b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805b0e:	4d 89 c1             	mov    %r8,%r9
+  805b11:	49 89 f8             	mov    %rdi,%r8
+  805b14:	89 c7                	mov    %eax,%edi
+  805b16:	49 89 df             	mov    %rbx,%r15
+  805b19:	48 b8 17 89 ff ff ff 	movabs $0xffffffffffff8917,%rax
+  805b20:	ff ff ff 
+  805b23:	48 01 d8             	add    %rbx,%rax
+  805b26:	ff d0                	call   *%rax
+  805b28:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805b2b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805b2f:	74 05                	je     805b36 <ipc_callv+0xbc>
+		return r;
+  805b31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b34:	eb 17                	jmp    805b4d <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805b36:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b3d:	ff ff ff 
+  805b40:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b44:	48 8b 00             	mov    (%rax),%rax
+  805b47:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805b4d:	48 83 c4 40          	add    $0x40,%rsp
+  805b51:	5b                   	pop    %rbx
+  805b52:	41 5f                	pop    %r15
+  805b54:	5d                   	pop    %rbp
+  805b55:	c3                   	ret
+
+0000000000805b56 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805b56:	55                   	push   %rbp
+  805b57:	48 89 e5             	mov    %rsp,%rbp
+  805b5a:	41 57                	push   %r15
+  805b5c:	53                   	push   %rbx
+  805b5d:	48 83 ec 40          	sub    $0x40,%rsp
+  805b61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b61 <ipc_reply_recv+0xb>
+  805b68:	49 bb d7 24 00 00 00 	movabs $0x24d7,%r11
+  805b6f:	00 00 00 
+  805b72:	4c 01 db             	add    %r11,%rbx
+  805b75:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805b78:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805b7b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805b7f:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805b82:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805b86:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805b8a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805b8f:	75 0e                	jne    805b9f <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805b91:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805b98:	00 00 00 
+  805b9b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805b9f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805ba4:	75 0e                	jne    805bb4 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805ba6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805bad:	00 00 00 
+  805bb0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805bb4:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805bb7:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805bbb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805bbf:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805bc2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805bc6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bc9:	4d 89 c1             	mov    %r8,%r9
+  805bcc:	49 89 f8             	mov    %rdi,%r8
+  805bcf:	89 c7                	mov    %eax,%edi
+  805bd1:	49 89 df             	mov    %rbx,%r15
+  805bd4:	48 b8 8b 89 ff ff ff 	movabs $0xffffffffffff898b,%rax
+  805bdb:	ff ff ff 
+  805bde:	48 01 d8             	add    %rbx,%rax
+  805be1:	ff d0                	call   *%rax
+  805be3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805be6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805beb:	74 2a                	je     805c17 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805bed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805bf1:	75 19                	jne    805c0c <ipc_reply_recv+0xb6>
+  805bf3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bfa:	ff ff ff 
+  805bfd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c01:	48 8b 00             	mov    (%rax),%rax
+  805c04:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805c0a:	eb 05                	jmp    805c11 <ipc_reply_recv+0xbb>
+  805c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805c15:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805c17:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805c1c:	74 2a                	je     805c48 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805c1e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c22:	75 19                	jne    805c3d <ipc_reply_recv+0xe7>
+  805c24:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c2b:	ff ff ff 
+  805c2e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c32:	48 8b 00             	mov    (%rax),%rax
+  805c35:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805c3b:	eb 05                	jmp    805c42 <ipc_reply_recv+0xec>
+  805c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c42:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805c46:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805c48:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c4c:	74 05                	je     805c53 <ipc_reply_recv+0xfd>
+		return r;
+  805c4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c51:	eb 17                	jmp    805c6a <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805c53:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c5a:	ff ff ff 
+  805c5d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c61:	48 8b 00             	mov    (%rax),%rax
+  805c64:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805c6a:	48 83 c4 40          	add    $0x40,%rsp
+  805c6e:	5b                   	pop    %rbx
+  805c6f:	41 5f                	pop    %r15
+  805c71:	5d                   	pop    %rbp
+  805c72:	c3                   	ret
+
+0000000000805c73 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805c73:	55                   	push   %rbp
+  805c74:	48 89 e5             	mov    %rsp,%rbp
+  805c77:	41 57                	push   %r15
+  805c79:	53                   	push   %rbx
+  805c7a:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805c81:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c81 <ipc_window_batch+0xe>
+  805c88:	49 bb b7 23 00 00 00 	movabs $0x23b7,%r11
+  805c8f:	00 00 00 
+  805c92:	4c 01 db             	add    %r11,%rbx
+  805c95:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805c9b:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805ca2:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805ca8:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805cae:	e9 15 01 00 00       	jmp    805dc8 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805cb3:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805cb9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805cbc:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805cc3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805cc6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805cc9:	39 c2                	cmp    %eax,%edx
+  805ccb:	0f 4e c2             	cmovle %edx,%eax
+  805cce:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805cd1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805cd8:	eb 6b                	jmp    805d45 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805cda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cdd:	48 98                	cltq
+  805cdf:	48 c1 e0 05          	shl    $0x5,%rax
+  805ce3:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805ce7:	48 01 e8             	add    %rbp,%rax
+  805cea:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805cf0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805cf6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cf9:	c1 e0 0c             	shl    $0xc,%eax
+  805cfc:	48 63 d0             	movslq %eax,%rdx
+  805cff:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805d06:	48 01 c2             	add    %rax,%rdx
+  805d09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d0c:	48 98                	cltq
+  805d0e:	48 c1 e0 05          	shl    $0x5,%rax
+  805d12:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805d16:	48 01 e8             	add    %rbp,%rax
+  805d19:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805d1f:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805d22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d25:	48 98                	cltq
+  805d27:	48 c1 e0 05          	shl    $0x5,%rax
+  805d2b:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805d2f:	48 01 e8             	add    %rbp,%rax
+  805d32:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805d39:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805d3f:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805d41:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805d45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d48:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805d4b:	7c 8d                	jl     805cda <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805d4d:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805d54:	74 27                	je     805d7d <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805d56:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805d59:	48 63 d0             	movslq %eax,%rdx
+  805d5c:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805d63:	48 89 d6             	mov    %rdx,%rsi
+  805d66:	48 89 c7             	mov    %rax,%rdi
+  805d69:	49 89 df             	mov    %rbx,%r15
+  805d6c:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  805d73:	ff ff ff 
+  805d76:	48 01 d8             	add    %rbx,%rax
+  805d79:	ff d0                	call   *%rax
+  805d7b:	eb 25                	jmp    805da2 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805d7d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805d80:	48 63 d0             	movslq %eax,%rdx
+  805d83:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805d8a:	48 89 d6             	mov    %rdx,%rsi
+  805d8d:	48 89 c7             	mov    %rax,%rdi
+  805d90:	49 89 df             	mov    %rbx,%r15
+  805d93:	48 b8 8c 8c ff ff ff 	movabs $0xffffffffffff8c8c,%rax
+  805d9a:	ff ff ff 
+  805d9d:	48 01 d8             	add    %rbx,%rax
+  805da0:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805da2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805da5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805da9:	79 05                	jns    805db0 <ipc_window_batch+0x13d>
+			return r;
+  805dab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805dae:	eb 2a                	jmp    805dda <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805db0:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805db3:	c1 e0 0c             	shl    $0xc,%eax
+  805db6:	48 98                	cltq
+  805db8:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805dbf:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805dc2:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805dc8:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805dcf:	0f 8f de fe ff ff    	jg     805cb3 <ipc_window_batch+0x40>
+	}
+	return 0;
+  805dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805dda:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805de1:	5b                   	pop    %rbx
+  805de2:	41 5f                	pop    %r15
+  805de4:	5d                   	pop    %rbp
+  805de5:	c3                   	ret
+
+0000000000805de6 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805de6:	55                   	push   %rbp
+  805de7:	48 89 e5             	mov    %rsp,%rbp
+  805dea:	48 83 ec 10          	sub    $0x10,%rsp
+  805dee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805dee <ipc_map_window+0x8>
+  805df5:	49 bb 4a 22 00 00 00 	movabs $0x224a,%r11
+  805dfc:	00 00 00 
+  805dff:	4c 01 d8             	add    %r11,%rax
+  805e02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805e06:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805e09:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805e0c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805e10:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805e15:	bf 01 00 00 00       	mov    $0x1,%edi
+  805e1a:	49 b8 3b dc ff ff ff 	movabs $0xffffffffffffdc3b,%r8
+  805e21:	ff ff ff 
+  805e24:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805e28:	ff d0                	call   *%rax
+}
+  805e2a:	c9                   	leave
+  805e2b:	c3                   	ret
+
+0000000000805e2c <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805e2c:	55                   	push   %rbp
+  805e2d:	48 89 e5             	mov    %rsp,%rbp
+  805e30:	48 83 ec 10          	sub    $0x10,%rsp
+  805e34:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e34 <ipc_unmap_window+0x8>
+  805e3b:	49 bb 04 22 00 00 00 	movabs $0x2204,%r11
+  805e42:	00 00 00 
+  805e45:	4c 01 d8             	add    %r11,%rax
+  805e48:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805e4c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805e4f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805e52:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805e56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805e5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e60:	49 b8 3b dc ff ff ff 	movabs $0xffffffffffffdc3b,%r8
+  805e67:	ff ff ff 
+  805e6a:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805e6e:	ff d0                	call   *%rax
+}
+  805e70:	c9                   	leave
+  805e71:	c3                   	ret
+
+0000000000805e72 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805e72:	55                   	push   %rbp
+  805e73:	48 89 e5             	mov    %rsp,%rbp
+  805e76:	48 83 ec 18          	sub    $0x18,%rsp
+  805e7a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e7a <ipc_find_env+0x8>
+  805e81:	49 bb be 21 00 00 00 	movabs $0x21be,%r11
+  805e88:	00 00 00 
+  805e8b:	4c 01 d8             	add    %r11,%rax
+  805e8e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805e91:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805e98:	eb 57                	jmp    805ef1 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805e9a:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805ea1:	ff ff ff 
+  805ea4:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805ea8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805eab:	48 63 d2             	movslq %edx,%rdx
+  805eae:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805eb5:	48 01 ca             	add    %rcx,%rdx
+  805eb8:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805ebf:	8b 12                	mov    (%rdx),%edx
+  805ec1:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805ec4:	75 27                	jne    805eed <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805ec6:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805ecd:	ff ff ff 
+  805ed0:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805ed4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ed7:	48 98                	cltq
+  805ed9:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  805ee0:	48 01 d0             	add    %rdx,%rax
+  805ee3:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805ee9:	8b 00                	mov    (%rax),%eax
+  805eeb:	eb 12                	jmp    805eff <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  805eed:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805ef1:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805ef8:	7e a0                	jle    805e9a <ipc_find_env+0x28>
+	}
+	return 0;
+  805efa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805eff:	c9                   	leave
+  805f00:	c3                   	ret
+
+0000000000805f01 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805f01:	55                   	push   %rbp
+  805f02:	48 89 e5             	mov    %rsp,%rbp
+  805f05:	48 83 ec 18          	sub    $0x18,%rsp
+  805f09:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f09 <pageref+0x8>
+  805f10:	49 bb 2f 21 00 00 00 	movabs $0x212f,%r11
+  805f17:	00 00 00 
+  805f1a:	4c 01 d8             	add    %r11,%rax
+  805f1d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  805f21:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805f25:	48 89 d1             	mov    %rdx,%rcx
+  805f28:	48 c1 e9 15          	shr    $0x15,%rcx
+  805f2c:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  805f33:	ff ff ff 
+  805f36:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805f3a:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805f3e:	83 e2 01             	and    $0x1,%edx
+  805f41:	48 85 d2             	test   %rdx,%rdx
+  805f44:	75 07                	jne    805f4d <pageref+0x4c>
+		return 0;
+  805f46:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f4b:	eb 64                	jmp    805fb1 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  805f4d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805f51:	48 89 d1             	mov    %rdx,%rcx
+  805f54:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805f58:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  805f5f:	ff ff ff 
+  805f62:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805f66:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805f6a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  805f6e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805f72:	83 e2 01             	and    $0x1,%edx
+  805f75:	48 85 d2             	test   %rdx,%rdx
+  805f78:	75 07                	jne    805f81 <pageref+0x80>
+		return 0;
+  805f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f7f:	eb 30                	jmp    805fb1 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  805f81:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805f85:	48 c1 ea 0c          	shr    $0xc,%rdx
+  805f89:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  805f90:	ff ff ff 
+  805f93:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  805f97:	48 89 d0             	mov    %rdx,%rax
+  805f9a:	48 01 c0             	add    %rax,%rax
+  805f9d:	48 01 d0             	add    %rdx,%rax
+  805fa0:	48 c1 e0 03          	shl    $0x3,%rax
+  805fa4:	48 01 c8             	add    %rcx,%rax
+  805fa7:	48 83 c0 08          	add    $0x8,%rax
+  805fab:	0f b7 00             	movzwl (%rax),%eax
+  805fae:	0f b7 c0             	movzwl %ax,%eax
+}
+  805fb1:	c9                   	leave
+  805fb2:	c3                   	ret
@@ -0,0 +1,10299 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 f8 0c 00 00       	call   800d39 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+	   const char *testname)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 40          	sub    $0x40,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <check_regs+0xb>
+  800055:	49 bb ea 8f 00 00 00 	movabs $0x8fea,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800066:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80006a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80006e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  800072:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+	int mismatch = 0;
+  800076:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+	cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  80007d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800081:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800085:	48 89 d1             	mov    %rdx,%rcx
+  800088:	48 89 c2             	mov    %rax,%rdx
+  80008b:	48 b8 18 dc ff ff ff 	movabs $0xffffffffffffdc18,%rax
+  800092:	ff ff ff 
+  800095:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800099:	48 89 c6             	mov    %rax,%rsi
+  80009c:	48 b8 19 dc ff ff ff 	movabs $0xffffffffffffdc19,%rax
+  8000a3:	ff ff ff 
+  8000a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000aa:	48 89 c7             	mov    %rax,%rdi
+  8000ad:	49 89 df             	mov    %rbx,%r15
+  8000b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b5:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  8000bc:	ff ff ff 
+  8000bf:	49 01 d8             	add    %rbx,%r8
+  8000c2:	41 ff d0             	call   *%r8
+			cprintf("MISMATCH\n");				\
+			mismatch = 1;					\
+		}							\
+	} while (0)
+
+	CHECK(edi, regs.reg_rdi);
+  8000c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000c9:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  8000cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8000d1:	48 8b 40 48          	mov    0x48(%rax),%rax
+  8000d5:	48 89 d1             	mov    %rdx,%rcx
+  8000d8:	48 89 c2             	mov    %rax,%rdx
+  8000db:	48 b8 29 dc ff ff ff 	movabs $0xffffffffffffdc29,%rax
+  8000e2:	ff ff ff 
+  8000e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000e9:	48 89 c6             	mov    %rax,%rsi
+  8000ec:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  8000f3:	ff ff ff 
+  8000f6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000fa:	48 89 c7             	mov    %rax,%rdi
+  8000fd:	49 89 df             	mov    %rbx,%r15
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  80010c:	ff ff ff 
+  80010f:	49 01 d8             	add    %rbx,%r8
+  800112:	41 ff d0             	call   *%r8
+  800115:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800119:	48 8b 50 48          	mov    0x48(%rax),%rdx
+  80011d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800121:	48 8b 40 48          	mov    0x48(%rax),%rax
+  800125:	48 39 c2             	cmp    %rax,%rdx
+  800128:	75 2a                	jne    800154 <check_regs+0x111>
+  80012a:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  800131:	ff ff ff 
+  800134:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800138:	48 89 c7             	mov    %rax,%rdi
+  80013b:	49 89 df             	mov    %rbx,%r15
+  80013e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800143:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  80014a:	ff ff ff 
+  80014d:	48 01 da             	add    %rbx,%rdx
+  800150:	ff d2                	call   *%rdx
+  800152:	eb 2f                	jmp    800183 <check_regs+0x140>
+  800154:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  80015b:	ff ff ff 
+  80015e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800162:	48 89 c7             	mov    %rax,%rdi
+  800165:	49 89 df             	mov    %rbx,%r15
+  800168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016d:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800174:	ff ff ff 
+  800177:	48 01 da             	add    %rbx,%rdx
+  80017a:	ff d2                	call   *%rdx
+  80017c:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+	CHECK(esi, regs.reg_rsi);
+  800183:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800187:	48 8b 50 40          	mov    0x40(%rax),%rdx
+  80018b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80018f:	48 8b 40 40          	mov    0x40(%rax),%rax
+  800193:	48 89 d1             	mov    %rdx,%rcx
+  800196:	48 89 c2             	mov    %rax,%rdx
+  800199:	48 b8 4b dc ff ff ff 	movabs $0xffffffffffffdc4b,%rax
+  8001a0:	ff ff ff 
+  8001a3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001a7:	48 89 c6             	mov    %rax,%rsi
+  8001aa:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  8001b1:	ff ff ff 
+  8001b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001b8:	48 89 c7             	mov    %rax,%rdi
+  8001bb:	49 89 df             	mov    %rbx,%r15
+  8001be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c3:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  8001ca:	ff ff ff 
+  8001cd:	49 01 d8             	add    %rbx,%r8
+  8001d0:	41 ff d0             	call   *%r8
+  8001d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001d7:	48 8b 50 40          	mov    0x40(%rax),%rdx
+  8001db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8001df:	48 8b 40 40          	mov    0x40(%rax),%rax
+  8001e3:	48 39 c2             	cmp    %rax,%rdx
+  8001e6:	75 2a                	jne    800212 <check_regs+0x1cf>
+  8001e8:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  8001ef:	ff ff ff 
+  8001f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f6:	48 89 c7             	mov    %rax,%rdi
+  8001f9:	49 89 df             	mov    %rbx,%r15
+  8001fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800201:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800208:	ff ff ff 
+  80020b:	48 01 da             	add    %rbx,%rdx
+  80020e:	ff d2                	call   *%rdx
+  800210:	eb 2f                	jmp    800241 <check_regs+0x1fe>
+  800212:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  800219:	ff ff ff 
+  80021c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800220:	48 89 c7             	mov    %rax,%rdi
+  800223:	49 89 df             	mov    %rbx,%r15
+  800226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022b:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800232:	ff ff ff 
+  800235:	48 01 da             	add    %rbx,%rdx
+  800238:	ff d2                	call   *%rdx
+  80023a:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+	CHECK(ebp, regs.reg_rbp);
+  800241:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800245:	48 8b 50 50          	mov    0x50(%rax),%rdx
+  800249:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80024d:	48 8b 40 50          	mov    0x50(%rax),%rax
+  800251:	48 89 d1             	mov    %rdx,%rcx
+  800254:	48 89 c2             	mov    %rax,%rdx
+  800257:	48 b8 4f dc ff ff ff 	movabs $0xffffffffffffdc4f,%rax
+  80025e:	ff ff ff 
+  800261:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800265:	48 89 c6             	mov    %rax,%rsi
+  800268:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  80026f:	ff ff ff 
+  800272:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800276:	48 89 c7             	mov    %rax,%rdi
+  800279:	49 89 df             	mov    %rbx,%r15
+  80027c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800281:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  800288:	ff ff ff 
+  80028b:	49 01 d8             	add    %rbx,%r8
+  80028e:	41 ff d0             	call   *%r8
+  800291:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800295:	48 8b 50 50          	mov    0x50(%rax),%rdx
+  800299:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80029d:	48 8b 40 50          	mov    0x50(%rax),%rax
+  8002a1:	48 39 c2             	cmp    %rax,%rdx
+  8002a4:	75 2a                	jne    8002d0 <check_regs+0x28d>
+  8002a6:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  8002ad:	ff ff ff 
+  8002b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002b4:	48 89 c7             	mov    %rax,%rdi
+  8002b7:	49 89 df             	mov    %rbx,%r15
+  8002ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bf:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  8002c6:	ff ff ff 
+  8002c9:	48 01 da             	add    %rbx,%rdx
+  8002cc:	ff d2                	call   *%rdx
+  8002ce:	eb 2f                	jmp    8002ff <check_regs+0x2bc>
+  8002d0:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  8002d7:	ff ff ff 
+  8002da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002de:	48 89 c7             	mov    %rax,%rdi
+  8002e1:	49 89 df             	mov    %rbx,%r15
+  8002e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e9:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  8002f0:	ff ff ff 
+  8002f3:	48 01 da             	add    %rbx,%rdx
+  8002f6:	ff d2                	call   *%rdx
+  8002f8:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+	CHECK(ebx, regs.reg_rbx);
+  8002ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800303:	48 8b 50 68          	mov    0x68(%rax),%rdx
+  800307:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80030b:	48 8b 40 68          	mov    0x68(%rax),%rax
+  80030f:	48 89 d1             	mov    %rdx,%rcx
+  800312:	48 89 c2             	mov    %rax,%rdx
+  800315:	48 b8 53 dc ff ff ff 	movabs $0xffffffffffffdc53,%rax
+  80031c:	ff ff ff 
+  80031f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800323:	48 89 c6             	mov    %rax,%rsi
+  800326:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  80032d:	ff ff ff 
+  800330:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800334:	48 89 c7             	mov    %rax,%rdi
+  800337:	49 89 df             	mov    %rbx,%r15
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  800346:	ff ff ff 
+  800349:	49 01 d8             	add    %rbx,%r8
+  80034c:	41 ff d0             	call   *%r8
+  80034f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800353:	48 8b 50 68          	mov    0x68(%rax),%rdx
+  800357:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80035b:	48 8b 40 68          	mov    0x68(%rax),%rax
+  80035f:	48 39 c2             	cmp    %rax,%rdx
+  800362:	75 2a                	jne    80038e <check_regs+0x34b>
+  800364:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  80036b:	ff ff ff 
+  80036e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800372:	48 89 c7             	mov    %rax,%rdi
+  800375:	49 89 df             	mov    %rbx,%r15
+  800378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037d:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800384:	ff ff ff 
+  800387:	48 01 da             	add    %rbx,%rdx
+  80038a:	ff d2                	call   *%rdx
+  80038c:	eb 2f                	jmp    8003bd <check_regs+0x37a>
+  80038e:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  800395:	ff ff ff 
+  800398:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80039c:	48 89 c7             	mov    %rax,%rdi
+  80039f:	49 89 df             	mov    %rbx,%r15
+  8003a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a7:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  8003ae:	ff ff ff 
+  8003b1:	48 01 da             	add    %rbx,%rdx
+  8003b4:	ff d2                	call   *%rdx
+  8003b6:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+	CHECK(edx, regs.reg_rdx);
+  8003bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003c1:	48 8b 50 58          	mov    0x58(%rax),%rdx
+  8003c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003c9:	48 8b 40 58          	mov    0x58(%rax),%rax
+  8003cd:	48 89 d1             	mov    %rdx,%rcx
+  8003d0:	48 89 c2             	mov    %rax,%rdx
+  8003d3:	48 b8 57 dc ff ff ff 	movabs $0xffffffffffffdc57,%rax
+  8003da:	ff ff ff 
+  8003dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003e1:	48 89 c6             	mov    %rax,%rsi
+  8003e4:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  8003eb:	ff ff ff 
+  8003ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003f2:	48 89 c7             	mov    %rax,%rdi
+  8003f5:	49 89 df             	mov    %rbx,%r15
+  8003f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fd:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  800404:	ff ff ff 
+  800407:	49 01 d8             	add    %rbx,%r8
+  80040a:	41 ff d0             	call   *%r8
+  80040d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800411:	48 8b 50 58          	mov    0x58(%rax),%rdx
+  800415:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800419:	48 8b 40 58          	mov    0x58(%rax),%rax
+  80041d:	48 39 c2             	cmp    %rax,%rdx
+  800420:	75 2a                	jne    80044c <check_regs+0x409>
+  800422:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  800429:	ff ff ff 
+  80042c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800430:	48 89 c7             	mov    %rax,%rdi
+  800433:	49 89 df             	mov    %rbx,%r15
+  800436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043b:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800442:	ff ff ff 
+  800445:	48 01 da             	add    %rbx,%rdx
+  800448:	ff d2                	call   *%rdx
+  80044a:	eb 2f                	jmp    80047b <check_regs+0x438>
+  80044c:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  800453:	ff ff ff 
+  800456:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80045a:	48 89 c7             	mov    %rax,%rdi
+  80045d:	49 89 df             	mov    %rbx,%r15
+  800460:	b8 00 00 00 00       	mov    $0x0,%eax
+  800465:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  80046c:	ff ff ff 
+  80046f:	48 01 da             	add    %rbx,%rdx
+  800472:	ff d2                	call   *%rdx
+  800474:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+	CHECK(ecx, regs.reg_rcx);
+  80047b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80047f:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  800483:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800487:	48 8b 40 60          	mov    0x60(%rax),%rax
+  80048b:	48 89 d1             	mov    %rdx,%rcx
+  80048e:	48 89 c2             	mov    %rax,%rdx
+  800491:	48 b8 5b dc ff ff ff 	movabs $0xffffffffffffdc5b,%rax
+  800498:	ff ff ff 
+  80049b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80049f:	48 89 c6             	mov    %rax,%rsi
+  8004a2:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  8004a9:	ff ff ff 
+  8004ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004b0:	48 89 c7             	mov    %rax,%rdi
+  8004b3:	49 89 df             	mov    %rbx,%r15
+  8004b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bb:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  8004c2:	ff ff ff 
+  8004c5:	49 01 d8             	add    %rbx,%r8
+  8004c8:	41 ff d0             	call   *%r8
+  8004cb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8004cf:	48 8b 50 60          	mov    0x60(%rax),%rdx
+  8004d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004d7:	48 8b 40 60          	mov    0x60(%rax),%rax
+  8004db:	48 39 c2             	cmp    %rax,%rdx
+  8004de:	75 2a                	jne    80050a <check_regs+0x4c7>
+  8004e0:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  8004e7:	ff ff ff 
+  8004ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004ee:	48 89 c7             	mov    %rax,%rdi
+  8004f1:	49 89 df             	mov    %rbx,%r15
+  8004f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f9:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800500:	ff ff ff 
+  800503:	48 01 da             	add    %rbx,%rdx
+  800506:	ff d2                	call   *%rdx
+  800508:	eb 2f                	jmp    800539 <check_regs+0x4f6>
+  80050a:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  800511:	ff ff ff 
+  800514:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800518:	48 89 c7             	mov    %rax,%rdi
+  80051b:	49 89 df             	mov    %rbx,%r15
+  80051e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800523:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  80052a:	ff ff ff 
+  80052d:	48 01 da             	add    %rbx,%rdx
+  800530:	ff d2                	call   *%rdx
+  800532:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+	CHECK(eax, regs.reg_rax);
+  800539:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80053d:	48 8b 50 70          	mov    0x70(%rax),%rdx
+  800541:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800545:	48 8b 40 70          	mov    0x70(%rax),%rax
+  800549:	48 89 d1             	mov    %rdx,%rcx
+  80054c:	48 89 c2             	mov    %rax,%rdx
+  80054f:	48 b8 5f dc ff ff ff 	movabs $0xffffffffffffdc5f,%rax
+  800556:	ff ff ff 
+  800559:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80055d:	48 89 c6             	mov    %rax,%rsi
+  800560:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  800567:	ff ff ff 
+  80056a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80056e:	48 89 c7             	mov    %rax,%rdi
+  800571:	49 89 df             	mov    %rbx,%r15
+  800574:	b8 00 00 00 00       	mov    $0x0,%eax
+  800579:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  800580:	ff ff ff 
+  800583:	49 01 d8             	add    %rbx,%r8
+  800586:	41 ff d0             	call   *%r8
+  800589:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80058d:	48 8b 50 70          	mov    0x70(%rax),%rdx
+  800591:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800595:	48 8b 40 70          	mov    0x70(%rax),%rax
+  800599:	48 39 c2             	cmp    %rax,%rdx
+  80059c:	75 2a                	jne    8005c8 <check_regs+0x585>
+  80059e:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  8005a5:	ff ff ff 
+  8005a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005ac:	48 89 c7             	mov    %rax,%rdi
+  8005af:	49 89 df             	mov    %rbx,%r15
+  8005b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b7:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  8005be:	ff ff ff 
+  8005c1:	48 01 da             	add    %rbx,%rdx
+  8005c4:	ff d2                	call   *%rdx
+  8005c6:	eb 2f                	jmp    8005f7 <check_regs+0x5b4>
+  8005c8:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  8005cf:	ff ff ff 
+  8005d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005d6:	48 89 c7             	mov    %rax,%rdi
+  8005d9:	49 89 df             	mov    %rbx,%r15
+  8005dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e1:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  8005e8:	ff ff ff 
+  8005eb:	48 01 da             	add    %rbx,%rdx
+  8005ee:	ff d2                	call   *%rdx
+  8005f0:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+	CHECK(eip, eip);
+  8005f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005fb:	48 8b 50 78          	mov    0x78(%rax),%rdx
+  8005ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800603:	48 8b 40 78          	mov    0x78(%rax),%rax
+  800607:	48 89 d1             	mov    %rdx,%rcx
+  80060a:	48 89 c2             	mov    %rax,%rdx
+  80060d:	48 b8 63 dc ff ff ff 	movabs $0xffffffffffffdc63,%rax
+  800614:	ff ff ff 
+  800617:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80061b:	48 89 c6             	mov    %rax,%rsi
+  80061e:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  800625:	ff ff ff 
+  800628:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80062c:	48 89 c7             	mov    %rax,%rdi
+  80062f:	49 89 df             	mov    %rbx,%r15
+  800632:	b8 00 00 00 00       	mov    $0x0,%eax
+  800637:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  80063e:	ff ff ff 
+  800641:	49 01 d8             	add    %rbx,%r8
+  800644:	41 ff d0             	call   *%r8
+  800647:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80064b:	48 8b 50 78          	mov    0x78(%rax),%rdx
+  80064f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800653:	48 8b 40 78          	mov    0x78(%rax),%rax
+  800657:	48 39 c2             	cmp    %rax,%rdx
+  80065a:	75 2a                	jne    800686 <check_regs+0x643>
+  80065c:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  800663:	ff ff ff 
+  800666:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80066a:	48 89 c7             	mov    %rax,%rdi
+  80066d:	49 89 df             	mov    %rbx,%r15
+  800670:	b8 00 00 00 00       	mov    $0x0,%eax
+  800675:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  80067c:	ff ff ff 
+  80067f:	48 01 da             	add    %rbx,%rdx
+  800682:	ff d2                	call   *%rdx
+  800684:	eb 2f                	jmp    8006b5 <check_regs+0x672>
+  800686:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  80068d:	ff ff ff 
+  800690:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800694:	48 89 c7             	mov    %rax,%rdi
+  800697:	49 89 df             	mov    %rbx,%r15
+  80069a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069f:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  8006a6:	ff ff ff 
+  8006a9:	48 01 da             	add    %rbx,%rdx
+  8006ac:	ff d2                	call   *%rdx
+  8006ae:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+	CHECK(eflags, eflags);
+  8006b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006b9:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  8006c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8006c4:	48 8b 80 80 00 00 00 	mov    0x80(%rax),%rax
+  8006cb:	48 89 d1             	mov    %rdx,%rcx
+  8006ce:	48 89 c2             	mov    %rax,%rdx
+  8006d1:	48 b8 67 dc ff ff ff 	movabs $0xffffffffffffdc67,%rax
+  8006d8:	ff ff ff 
+  8006db:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006df:	48 89 c6             	mov    %rax,%rsi
+  8006e2:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  8006e9:	ff ff ff 
+  8006ec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006f0:	48 89 c7             	mov    %rax,%rdi
+  8006f3:	49 89 df             	mov    %rbx,%r15
+  8006f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006fb:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  800702:	ff ff ff 
+  800705:	49 01 d8             	add    %rbx,%r8
+  800708:	41 ff d0             	call   *%r8
+  80070b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80070f:	48 8b 90 80 00 00 00 	mov    0x80(%rax),%rdx
+  800716:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80071a:	48 8b 80 80 00 00 00 	mov    0x80(%rax),%rax
+  800721:	48 39 c2             	cmp    %rax,%rdx
+  800724:	75 2a                	jne    800750 <check_regs+0x70d>
+  800726:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  80072d:	ff ff ff 
+  800730:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800734:	48 89 c7             	mov    %rax,%rdi
+  800737:	49 89 df             	mov    %rbx,%r15
+  80073a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073f:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800746:	ff ff ff 
+  800749:	48 01 da             	add    %rbx,%rdx
+  80074c:	ff d2                	call   *%rdx
+  80074e:	eb 2f                	jmp    80077f <check_regs+0x73c>
+  800750:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  800757:	ff ff ff 
+  80075a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80075e:	48 89 c7             	mov    %rax,%rdi
+  800761:	49 89 df             	mov    %rbx,%r15
+  800764:	b8 00 00 00 00       	mov    $0x0,%eax
+  800769:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800770:	ff ff ff 
+  800773:	48 01 da             	add    %rbx,%rdx
+  800776:	ff d2                	call   *%rdx
+  800778:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+	CHECK(esp, esp);
+  80077f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800783:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  80078a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80078e:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+  800795:	48 89 d1             	mov    %rdx,%rcx
+  800798:	48 89 c2             	mov    %rax,%rdx
+  80079b:	48 b8 6e dc ff ff ff 	movabs $0xffffffffffffdc6e,%rax
+  8007a2:	ff ff ff 
+  8007a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007a9:	48 89 c6             	mov    %rax,%rsi
+  8007ac:	48 b8 2d dc ff ff ff 	movabs $0xffffffffffffdc2d,%rax
+  8007b3:	ff ff ff 
+  8007b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007ba:	48 89 c7             	mov    %rax,%rdi
+  8007bd:	49 89 df             	mov    %rbx,%r15
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c5:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  8007cc:	ff ff ff 
+  8007cf:	49 01 d8             	add    %rbx,%r8
+  8007d2:	41 ff d0             	call   *%r8
+  8007d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8007d9:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8007e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007e4:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+  8007eb:	48 39 c2             	cmp    %rax,%rdx
+  8007ee:	75 2a                	jne    80081a <check_regs+0x7d7>
+  8007f0:	48 b8 3d dc ff ff ff 	movabs $0xffffffffffffdc3d,%rax
+  8007f7:	ff ff ff 
+  8007fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007fe:	48 89 c7             	mov    %rax,%rdi
+  800801:	49 89 df             	mov    %rbx,%r15
+  800804:	b8 00 00 00 00       	mov    $0x0,%eax
+  800809:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800810:	ff ff ff 
+  800813:	48 01 da             	add    %rbx,%rdx
+  800816:	ff d2                	call   *%rdx
+  800818:	eb 2f                	jmp    800849 <check_regs+0x806>
+  80081a:	48 b8 41 dc ff ff ff 	movabs $0xffffffffffffdc41,%rax
+  800821:	ff ff ff 
+  800824:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800828:	48 89 c7             	mov    %rax,%rdi
+  80082b:	49 89 df             	mov    %rbx,%r15
+  80082e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800833:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  80083a:	ff ff ff 
+  80083d:	48 01 da             	add    %rbx,%rdx
+  800840:	ff d2                	call   *%rdx
+  800842:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+
+#undef CHECK
+
+
+	if (!mismatch)
+  800849:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80084d:	75 31                	jne    800880 <check_regs+0x83d>
+		cprintf("Registers %s OK\n", testname);
+  80084f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  800853:	48 89 c6             	mov    %rax,%rsi
+  800856:	48 b8 72 dc ff ff ff 	movabs $0xffffffffffffdc72,%rax
+  80085d:	ff ff ff 
+  800860:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800864:	48 89 c7             	mov    %rax,%rdi
+  800867:	49 89 df             	mov    %rbx,%r15
+  80086a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086f:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800876:	ff ff ff 
+  800879:	48 01 da             	add    %rbx,%rdx
+  80087c:	ff d2                	call   *%rdx
+	else
+		cprintf("Registers %s MISMATCH\n", testname);
+}
+  80087e:	eb 2f                	jmp    8008af <check_regs+0x86c>
+		cprintf("Registers %s MISMATCH\n", testname);
+  800880:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  800884:	48 89 c6             	mov    %rax,%rsi
+  800887:	48 b8 83 dc ff ff ff 	movabs $0xffffffffffffdc83,%rax
+  80088e:	ff ff ff 
+  800891:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800895:	48 89 c7             	mov    %rax,%rdi
+  800898:	49 89 df             	mov    %rbx,%r15
+  80089b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a0:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  8008a7:	ff ff ff 
+  8008aa:	48 01 da             	add    %rbx,%rdx
+  8008ad:	ff d2                	call   *%rdx
+}
+  8008af:	90                   	nop
+  8008b0:	48 83 c4 40          	add    $0x40,%rsp
+  8008b4:	5b                   	pop    %rbx
+  8008b5:	41 5f                	pop    %r15
+  8008b7:	5d                   	pop    %rbp
+  8008b8:	c3                   	ret
+
+00000000008008b9 <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8008b9:	55                   	push   %rbp
+  8008ba:	48 89 e5             	mov    %rsp,%rbp
+  8008bd:	41 57                	push   %r15
+  8008bf:	53                   	push   %rbx
+  8008c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8008c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8008c4 <pgfault+0xb>
+  8008cb:	49 bb 74 87 00 00 00 	movabs $0x8774,%r11
+  8008d2:	00 00 00 
+  8008d5:	4c 01 db             	add    %r11,%rbx
+  8008d8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	if (utf->utf_fault_va != (uint64_t)UTEMP)
+  8008dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008e0:	48 8b 00             	mov    (%rax),%rax
+  8008e3:	48 3d 00 00 40 00    	cmp    $0x400000,%rax
+  8008e9:	74 57                	je     800942 <pgfault+0x89>
+		panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  8008eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008ef:	48 8b 90 88 00 00 00 	mov    0x88(%rax),%rdx
+  8008f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008fa:	48 8b 00             	mov    (%rax),%rax
+  8008fd:	49 89 d0             	mov    %rdx,%r8
+  800900:	48 89 c1             	mov    %rax,%rcx
+  800903:	48 b8 a0 dc ff ff ff 	movabs $0xffffffffffffdca0,%rax
+  80090a:	ff ff ff 
+  80090d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800911:	48 89 c2             	mov    %rax,%rdx
+  800914:	be 5e 00 00 00       	mov    $0x5e,%esi
+  800919:	48 b8 d1 dc ff ff ff 	movabs $0xffffffffffffdcd1,%rax
+  800920:	ff ff ff 
+  800923:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800927:	48 89 c7             	mov    %rax,%rdi
+  80092a:	49 89 df             	mov    %rbx,%r15
+  80092d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800932:	49 b9 0b 7e ff ff ff 	movabs $0xffffffffffff7e0b,%r9
+  800939:	ff ff ff 
+  80093c:	49 01 d9             	add    %rbx,%r9
+  80093f:	41 ff d1             	call   *%r9
+		      utf->utf_fault_va, utf->utf_rip);
+
+	// Check registers in UTrapframe
+	during.regs = utf->utf_regs;
+  800942:	48 ba 68 10 00 00 00 	movabs $0x1068,%rdx
+  800949:	00 00 00 
+  80094c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800950:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  800954:	48 8b 78 18          	mov    0x18(%rax),%rdi
+  800958:	48 89 34 13          	mov    %rsi,(%rbx,%rdx,1)
+  80095c:	48 89 7c 13 08       	mov    %rdi,0x8(%rbx,%rdx,1)
+  800961:	48 8b 70 20          	mov    0x20(%rax),%rsi
+  800965:	48 8b 78 28          	mov    0x28(%rax),%rdi
+  800969:	48 89 74 13 10       	mov    %rsi,0x10(%rbx,%rdx,1)
+  80096e:	48 89 7c 13 18       	mov    %rdi,0x18(%rbx,%rdx,1)
+  800973:	48 8b 70 30          	mov    0x30(%rax),%rsi
+  800977:	48 8b 78 38          	mov    0x38(%rax),%rdi
+  80097b:	48 89 74 13 20       	mov    %rsi,0x20(%rbx,%rdx,1)
+  800980:	48 89 7c 13 28       	mov    %rdi,0x28(%rbx,%rdx,1)
+  800985:	48 8b 70 40          	mov    0x40(%rax),%rsi
+  800989:	48 8b 78 48          	mov    0x48(%rax),%rdi
+  80098d:	48 89 74 13 30       	mov    %rsi,0x30(%rbx,%rdx,1)
+  800992:	48 89 7c 13 38       	mov    %rdi,0x38(%rbx,%rdx,1)
+  800997:	48 8b 70 50          	mov    0x50(%rax),%rsi
+  80099b:	48 8b 78 58          	mov    0x58(%rax),%rdi
+  80099f:	48 89 74 13 40       	mov    %rsi,0x40(%rbx,%rdx,1)
+  8009a4:	48 89 7c 13 48       	mov    %rdi,0x48(%rbx,%rdx,1)
+  8009a9:	48 8b 70 60          	mov    0x60(%rax),%rsi
+  8009ad:	48 8b 78 68          	mov    0x68(%rax),%rdi
+  8009b1:	48 89 74 13 50       	mov    %rsi,0x50(%rbx,%rdx,1)
+  8009b6:	48 89 7c 13 58       	mov    %rdi,0x58(%rbx,%rdx,1)
+  8009bb:	48 8b 70 70          	mov    0x70(%rax),%rsi
+  8009bf:	48 8b 78 78          	mov    0x78(%rax),%rdi
+  8009c3:	48 89 74 13 60       	mov    %rsi,0x60(%rbx,%rdx,1)
+  8009c8:	48 89 7c 13 68       	mov    %rdi,0x68(%rbx,%rdx,1)
+  8009cd:	48 8b 80 80 00 00 00 	mov    0x80(%rax),%rax
+  8009d4:	48 89 44 13 70       	mov    %rax,0x70(%rbx,%rdx,1)
+	during.eip = utf->utf_rip;
+  8009d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009dd:	48 8b 80 88 00 00 00 	mov    0x88(%rax),%rax
+  8009e4:	48 ba 68 10 00 00 00 	movabs $0x1068,%rdx
+  8009eb:	00 00 00 
+  8009ee:	48 89 44 13 78       	mov    %rax,0x78(%rbx,%rdx,1)
+	during.eflags = utf->utf_eflags & 0xfff;
+  8009f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009f7:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+  8009fe:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800a03:	48 89 c2             	mov    %rax,%rdx
+  800a06:	48 b8 68 10 00 00 00 	movabs $0x1068,%rax
+  800a0d:	00 00 00 
+  800a10:	48 89 94 03 80 00 00 	mov    %rdx,0x80(%rbx,%rax,1)
+  800a17:	00 
+	during.esp = utf->utf_rsp;
+  800a18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a1c:	48 8b 80 98 00 00 00 	mov    0x98(%rax),%rax
+  800a23:	48 ba 68 10 00 00 00 	movabs $0x1068,%rdx
+  800a2a:	00 00 00 
+  800a2d:	48 89 84 13 88 00 00 	mov    %rax,0x88(%rbx,%rdx,1)
+  800a34:	00 
+	check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800a35:	48 b8 e2 dc ff ff ff 	movabs $0xffffffffffffdce2,%rax
+  800a3c:	ff ff ff 
+  800a3f:	4c 8d 04 03          	lea    (%rbx,%rax,1),%r8
+  800a43:	48 b8 f0 dc ff ff ff 	movabs $0xffffffffffffdcf0,%rax
+  800a4a:	ff ff ff 
+  800a4d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a51:	48 89 c1             	mov    %rax,%rcx
+  800a54:	48 b8 68 10 00 00 00 	movabs $0x1068,%rax
+  800a5b:	00 00 00 
+  800a5e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a62:	48 89 c2             	mov    %rax,%rdx
+  800a65:	48 b8 f7 dc ff ff ff 	movabs $0xffffffffffffdcf7,%rax
+  800a6c:	ff ff ff 
+  800a6f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a73:	48 89 c6             	mov    %rax,%rsi
+  800a76:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  800a7d:	00 00 00 
+  800a80:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a84:	48 89 c7             	mov    %rax,%rdi
+  800a87:	48 b8 0b 70 ff ff ff 	movabs $0xffffffffffff700b,%rax
+  800a8e:	ff ff ff 
+  800a91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a95:	ff d0                	call   *%rax
+
+	// Map UTEMP so the write succeeds
+	if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  800a97:	ba 07 00 00 00       	mov    $0x7,%edx
+  800a9c:	be 00 00 40 00       	mov    $0x400000,%esi
+  800aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aa6:	49 89 df             	mov    %rbx,%r15
+  800aa9:	48 b8 60 9b ff ff ff 	movabs $0xffffffffffff9b60,%rax
+  800ab0:	ff ff ff 
+  800ab3:	48 01 d8             	add    %rbx,%rax
+  800ab6:	ff d0                	call   *%rax
+  800ab8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800abb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800abf:	79 44                	jns    800b05 <pgfault+0x24c>
+		panic("sys_page_alloc: %e", r);
+  800ac1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800ac4:	89 c1                	mov    %eax,%ecx
+  800ac6:	48 b8 fe dc ff ff ff 	movabs $0xffffffffffffdcfe,%rax
+  800acd:	ff ff ff 
+  800ad0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ad4:	48 89 c2             	mov    %rax,%rdx
+  800ad7:	be 6a 00 00 00       	mov    $0x6a,%esi
+  800adc:	48 b8 d1 dc ff ff ff 	movabs $0xffffffffffffdcd1,%rax
+  800ae3:	ff ff ff 
+  800ae6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800aea:	48 89 c7             	mov    %rax,%rdi
+  800aed:	49 89 df             	mov    %rbx,%r15
+  800af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af5:	49 b8 0b 7e ff ff ff 	movabs $0xffffffffffff7e0b,%r8
+  800afc:	ff ff ff 
+  800aff:	49 01 d8             	add    %rbx,%r8
+  800b02:	41 ff d0             	call   *%r8
+}
+  800b05:	90                   	nop
+  800b06:	48 83 c4 20          	add    $0x20,%rsp
+  800b0a:	5b                   	pop    %rbx
+  800b0b:	41 5f                	pop    %r15
+  800b0d:	5d                   	pop    %rbp
+  800b0e:	c3                   	ret
+
+0000000000800b0f <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800b0f:	55                   	push   %rbp
+  800b10:	48 89 e5             	mov    %rsp,%rbp
+  800b13:	41 57                	push   %r15
+  800b15:	53                   	push   %rbx
+  800b16:	48 83 ec 10          	sub    $0x10,%rsp
+  800b1a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800b1a <umain+0xb>
+  800b21:	49 bb 1e 85 00 00 00 	movabs $0x851e,%r11
+  800b28:	00 00 00 
+  800b2b:	4c 01 db             	add    %r11,%rbx
+  800b2e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800b31:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	set_pgfault_handler(pgfault);
+  800b35:	48 b8 81 78 ff ff ff 	movabs $0xffffffffffff7881,%rax
+  800b3c:	ff ff ff 
+  800b3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b43:	48 89 c7             	mov    %rax,%rdi
+  800b46:	49 89 df             	mov    %rbx,%r15
+  800b49:	48 b8 09 a3 ff ff ff 	movabs $0xffffffffffffa309,%rax
+  800b50:	ff ff ff 
+  800b53:	48 01 d8             	add    %rbx,%rax
+  800b56:	ff d0                	call   *%rax
+
+	__asm __volatile(
+  800b58:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  800b5f:	00 00 00 
+  800b62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b66:	48 ba 08 11 00 00 00 	movabs $0x1108,%rdx
+  800b6d:	00 00 00 
+  800b70:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800b74:	50                   	push   %rax
+  800b75:	52                   	push   %rdx
+  800b76:	50                   	push   %rax
+  800b77:	9c                   	pushf
+  800b78:	58                   	pop    %rax
+  800b79:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  800b7f:	50                   	push   %rax
+  800b80:	9d                   	popf
+  800b81:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+  800b86:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800b8d:	48 8d 04 25 d9 0b 80 	lea    0x800bd9,%rax
+  800b94:	00 
+  800b95:	49 89 47 78          	mov    %rax,0x78(%r15)
+  800b99:	58                   	pop    %rax
+  800b9a:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800b9e:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800ba2:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800ba6:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800baa:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800bae:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800bb2:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800bb6:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bba:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bbe:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800bc2:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800bc6:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800bca:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800bce:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800bd2:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800bd9:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  800be0:	2a 00 00 00 
+  800be4:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800be8:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800bec:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800bf0:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800bf4:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800bf8:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800bfc:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800c00:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800c04:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800c08:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800c0c:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800c10:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800c14:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800c18:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800c1c:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800c20:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800c27:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c2c:	4d 8b 77 08          	mov    0x8(%r15),%r14
+  800c30:	4d 8b 6f 10          	mov    0x10(%r15),%r13
+  800c34:	4d 8b 67 18          	mov    0x18(%r15),%r12
+  800c38:	4d 8b 5f 20          	mov    0x20(%r15),%r11
+  800c3c:	4d 8b 57 28          	mov    0x28(%r15),%r10
+  800c40:	4d 8b 4f 30          	mov    0x30(%r15),%r9
+  800c44:	4d 8b 47 38          	mov    0x38(%r15),%r8
+  800c48:	49 8b 77 40          	mov    0x40(%r15),%rsi
+  800c4c:	49 8b 7f 48          	mov    0x48(%r15),%rdi
+  800c50:	49 8b 6f 50          	mov    0x50(%r15),%rbp
+  800c54:	49 8b 57 58          	mov    0x58(%r15),%rdx
+  800c58:	49 8b 4f 60          	mov    0x60(%r15),%rcx
+  800c5c:	49 8b 5f 68          	mov    0x68(%r15),%rbx
+  800c60:	49 8b 47 70          	mov    0x70(%r15),%rax
+  800c64:	49 8b a7 88 00 00 00 	mov    0x88(%r15),%rsp
+  800c6b:	50                   	push   %rax
+  800c6c:	9c                   	pushf
+  800c6d:	58                   	pop    %rax
+  800c6e:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c73:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800c7a:	58                   	pop    %rax
+		: : "r" (&before), "r" (&after) : "memory", "cc");
+
+	// Check UTEMP to roughly determine that EIP was restored
+	// correctly (of course, we probably wouldn't get this far if
+	// it weren't)
+	if (*(int*)UTEMP != 42)
+  800c7b:	b8 00 00 40 00       	mov    $0x400000,%eax
+  800c80:	8b 00                	mov    (%rax),%eax
+  800c82:	83 f8 2a             	cmp    $0x2a,%eax
+  800c85:	74 28                	je     800caf <umain+0x1a0>
+		cprintf("EIP after page-fault MISMATCH\n");
+  800c87:	48 b8 18 dd ff ff ff 	movabs $0xffffffffffffdd18,%rax
+  800c8e:	ff ff ff 
+  800c91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c95:	48 89 c7             	mov    %rax,%rdi
+  800c98:	49 89 df             	mov    %rbx,%r15
+  800c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca0:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800ca7:	ff ff ff 
+  800caa:	48 01 da             	add    %rbx,%rdx
+  800cad:	ff d2                	call   *%rdx
+	after.eip = before.eip;
+  800caf:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  800cb6:	00 00 00 
+  800cb9:	48 8b 44 03 78       	mov    0x78(%rbx,%rax,1),%rax
+  800cbe:	48 ba 08 11 00 00 00 	movabs $0x1108,%rdx
+  800cc5:	00 00 00 
+  800cc8:	48 89 44 13 78       	mov    %rax,0x78(%rbx,%rdx,1)
+
+	check_regs(&before, "before", &after, "after", "after page-fault");
+  800ccd:	48 b8 37 dd ff ff ff 	movabs $0xffffffffffffdd37,%rax
+  800cd4:	ff ff ff 
+  800cd7:	4c 8d 04 03          	lea    (%rbx,%rax,1),%r8
+  800cdb:	48 b8 48 dd ff ff ff 	movabs $0xffffffffffffdd48,%rax
+  800ce2:	ff ff ff 
+  800ce5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ce9:	48 89 c1             	mov    %rax,%rcx
+  800cec:	48 b8 08 11 00 00 00 	movabs $0x1108,%rax
+  800cf3:	00 00 00 
+  800cf6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800cfa:	48 89 c2             	mov    %rax,%rdx
+  800cfd:	48 b8 f7 dc ff ff ff 	movabs $0xffffffffffffdcf7,%rax
+  800d04:	ff ff ff 
+  800d07:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d0b:	48 89 c6             	mov    %rax,%rsi
+  800d0e:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  800d15:	00 00 00 
+  800d18:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d1c:	48 89 c7             	mov    %rax,%rdi
+  800d1f:	48 b8 0b 70 ff ff ff 	movabs $0xffffffffffff700b,%rax
+  800d26:	ff ff ff 
+  800d29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d2d:	ff d0                	call   *%rax
+}
+  800d2f:	90                   	nop
+  800d30:	48 83 c4 10          	add    $0x10,%rsp
+  800d34:	5b                   	pop    %rbx
+  800d35:	41 5f                	pop    %r15
+  800d37:	5d                   	pop    %rbp
+  800d38:	c3                   	ret
+
+0000000000800d39 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800d39:	55                   	push   %rbp
+  800d3a:	48 89 e5             	mov    %rsp,%rbp
+  800d3d:	41 57                	push   %r15
+  800d3f:	53                   	push   %rbx
+  800d40:	48 83 ec 20          	sub    $0x20,%rsp
+  800d44:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800d44 <libmain+0xb>
+  800d4b:	49 bb f4 82 00 00 00 	movabs $0x82f4,%r11
+  800d52:	00 00 00 
+  800d55:	4c 01 db             	add    %r11,%rbx
+  800d58:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800d5b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800d5f:	49 89 df             	mov    %rbx,%r15
+  800d62:	48 b8 b7 9a ff ff ff 	movabs $0xffffffffffff9ab7,%rax
+  800d69:	ff ff ff 
+  800d6c:	48 01 d8             	add    %rbx,%rax
+  800d6f:	ff d0                	call   *%rax
+  800d71:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800d74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800d77:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800d7c:	48 98                	cltq
+  800d7e:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800d85:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  800d8c:	ff ff ff 
+  800d8f:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800d93:	48 01 c2             	add    %rax,%rdx
+  800d96:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  800d9d:	00 00 00 
+  800da0:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800da4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800da8:	7e 15                	jle    800dbf <libmain+0x86>
+		binaryname = argv[0];
+  800daa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800dae:	48 8b 00             	mov    (%rax),%rax
+  800db1:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  800db8:	00 00 00 
+  800dbb:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800dbf:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800dc3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800dc6:	48 89 d6             	mov    %rdx,%rsi
+  800dc9:	89 c7                	mov    %eax,%edi
+  800dcb:	49 89 df             	mov    %rbx,%r15
+  800dce:	48 b8 d7 7a ff ff ff 	movabs $0xffffffffffff7ad7,%rax
+  800dd5:	ff ff ff 
+  800dd8:	48 01 d8             	add    %rbx,%rax
+  800ddb:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800ddd:	49 89 df             	mov    %rbx,%r15
+  800de0:	48 b8 c1 7d ff ff ff 	movabs $0xffffffffffff7dc1,%rax
+  800de7:	ff ff ff 
+  800dea:	48 01 d8             	add    %rbx,%rax
+  800ded:	ff d0                	call   *%rax
+}
+  800def:	90                   	nop
+  800df0:	48 83 c4 20          	add    $0x20,%rsp
+  800df4:	5b                   	pop    %rbx
+  800df5:	41 5f                	pop    %r15
+  800df7:	5d                   	pop    %rbp
+  800df8:	c3                   	ret
+
+0000000000800df9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800df9:	55                   	push   %rbp
+  800dfa:	48 89 e5             	mov    %rsp,%rbp
+  800dfd:	41 57                	push   %r15
+  800dff:	53                   	push   %rbx
+  800e00:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800e00 <exit+0x7>
+  800e07:	49 bb 38 82 00 00 00 	movabs $0x8238,%r11
+  800e0e:	00 00 00 
+  800e11:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800e14:	49 89 df             	mov    %rbx,%r15
+  800e17:	48 b8 b6 a8 ff ff ff 	movabs $0xffffffffffffa8b6,%rax
+  800e1e:	ff ff ff 
+  800e21:	48 01 d8             	add    %rbx,%rax
+  800e24:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800e26:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e2b:	49 89 df             	mov    %rbx,%r15
+  800e2e:	48 b8 5b 9a ff ff ff 	movabs $0xffffffffffff9a5b,%rax
+  800e35:	ff ff ff 
+  800e38:	48 01 d8             	add    %rbx,%rax
+  800e3b:	ff d0                	call   *%rax
+}
+  800e3d:	90                   	nop
+  800e3e:	5b                   	pop    %rbx
+  800e3f:	41 5f                	pop    %r15
+  800e41:	5d                   	pop    %rbp
+  800e42:	c3                   	ret
+
+0000000000800e43 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800e43:	55                   	push   %rbp
+  800e44:	48 89 e5             	mov    %rsp,%rbp
+  800e47:	41 57                	push   %r15
+  800e49:	41 54                	push   %r12
+  800e4b:	53                   	push   %rbx
+  800e4c:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800e53:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800e53 <_panic+0x10>
+  800e5a:	49 bb e5 81 00 00 00 	movabs $0x81e5,%r11
+  800e61:	00 00 00 
+  800e64:	4c 01 db             	add    %r11,%rbx
+  800e67:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800e6e:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800e74:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800e7b:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800e82:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800e89:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800e90:	84 c0                	test   %al,%al
+  800e92:	74 26                	je     800eba <_panic+0x77>
+  800e94:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800e9b:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800ea2:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800ea6:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800eaa:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800eae:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800eb2:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800eb6:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800eba:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800ec1:	00 00 00 
+  800ec4:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800ecb:	00 00 00 
+  800ece:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ed2:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800ed9:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800ee0:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800ee7:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  800eee:	ff ff ff 
+  800ef1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800ef5:	4c 8b 20             	mov    (%rax),%r12
+  800ef8:	49 89 df             	mov    %rbx,%r15
+  800efb:	48 b8 b7 9a ff ff ff 	movabs $0xffffffffffff9ab7,%rax
+  800f02:	ff ff ff 
+  800f05:	48 01 d8             	add    %rbx,%rax
+  800f08:	ff d0                	call   *%rax
+  800f0a:	89 c6                	mov    %eax,%esi
+  800f0c:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800f12:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800f19:	41 89 d0             	mov    %edx,%r8d
+  800f1c:	48 89 c1             	mov    %rax,%rcx
+  800f1f:	4c 89 e2             	mov    %r12,%rdx
+  800f22:	48 b8 58 dd ff ff ff 	movabs $0xffffffffffffdd58,%rax
+  800f29:	ff ff ff 
+  800f2c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f30:	48 89 c7             	mov    %rax,%rdi
+  800f33:	49 89 df             	mov    %rbx,%r15
+  800f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3b:	49 b9 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r9
+  800f42:	ff ff ff 
+  800f45:	49 01 d9             	add    %rbx,%r9
+  800f48:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800f4b:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800f52:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800f59:	48 89 d6             	mov    %rdx,%rsi
+  800f5c:	48 89 c7             	mov    %rax,%rdi
+  800f5f:	49 89 df             	mov    %rbx,%r15
+  800f62:	48 b8 02 80 ff ff ff 	movabs $0xffffffffffff8002,%rax
+  800f69:	ff ff ff 
+  800f6c:	48 01 d8             	add    %rbx,%rax
+  800f6f:	ff d0                	call   *%rax
+	cprintf("\n");
+  800f71:	48 b8 7b dd ff ff ff 	movabs $0xffffffffffffdd7b,%rax
+  800f78:	ff ff ff 
+  800f7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f7f:	48 89 c7             	mov    %rax,%rdi
+  800f82:	49 89 df             	mov    %rbx,%r15
+  800f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8a:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800f91:	ff ff ff 
+  800f94:	48 01 da             	add    %rbx,%rdx
+  800f97:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800f99:	cc                   	int3
+  800f9a:	eb fd                	jmp    800f99 <_panic+0x156>
+
+0000000000800f9c <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800f9c:	55                   	push   %rbp
+  800f9d:	48 89 e5             	mov    %rsp,%rbp
+  800fa0:	41 57                	push   %r15
+  800fa2:	48 83 ec 18          	sub    $0x18,%rsp
+  800fa6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800fa6 <putch+0xa>
+  800fad:	49 bb 92 80 00 00 00 	movabs $0x8092,%r11
+  800fb4:	00 00 00 
+  800fb7:	4c 01 d8             	add    %r11,%rax
+  800fba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800fbd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800fc1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fc5:	8b 12                	mov    (%rdx),%edx
+  800fc7:	8d 72 01             	lea    0x1(%rdx),%esi
+  800fca:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800fce:	89 31                	mov    %esi,(%rcx)
+  800fd0:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800fd3:	89 ce                	mov    %ecx,%esi
+  800fd5:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800fd9:	48 63 d2             	movslq %edx,%rdx
+  800fdc:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800fe1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800fe5:	8b 12                	mov    (%rdx),%edx
+  800fe7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800fed:	75 33                	jne    801022 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800fef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ff3:	8b 12                	mov    (%rdx),%edx
+  800ff5:	48 63 d2             	movslq %edx,%rdx
+  800ff8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800ffc:	48 83 c1 08          	add    $0x8,%rcx
+  801000:	48 89 d6             	mov    %rdx,%rsi
+  801003:	48 89 cf             	mov    %rcx,%rdi
+  801006:	49 89 c7             	mov    %rax,%r15
+  801009:	48 ba a8 99 ff ff ff 	movabs $0xffffffffffff99a8,%rdx
+  801010:	ff ff ff 
+  801013:	48 01 c2             	add    %rax,%rdx
+  801016:	ff d2                	call   *%rdx
+        b->idx = 0;
+  801018:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80101c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  801022:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801026:	8b 40 04             	mov    0x4(%rax),%eax
+  801029:	8d 50 01             	lea    0x1(%rax),%edx
+  80102c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801030:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  801033:	90                   	nop
+  801034:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  801038:	c9                   	leave
+  801039:	c3                   	ret
+
+000000000080103a <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80103a:	55                   	push   %rbp
+  80103b:	48 89 e5             	mov    %rsp,%rbp
+  80103e:	41 57                	push   %r15
+  801040:	53                   	push   %rbx
+  801041:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  801048:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801048 <vcprintf+0xe>
+  80104f:	49 bb f0 7f 00 00 00 	movabs $0x7ff0,%r11
+  801056:	00 00 00 
+  801059:	4c 01 db             	add    %r11,%rbx
+  80105c:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  801063:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80106a:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  801071:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  801078:	48 8b 06             	mov    (%rsi),%rax
+  80107b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80107f:	48 89 01             	mov    %rax,(%rcx)
+  801082:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801086:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80108a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80108e:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  801095:	00 00 00 
+    b.cnt = 0;
+  801098:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80109f:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8010a2:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8010a9:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8010b0:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8010b7:	48 89 c6             	mov    %rax,%rsi
+  8010ba:	48 b8 64 7f ff ff ff 	movabs $0xffffffffffff7f64,%rax
+  8010c1:	ff ff ff 
+  8010c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8010c8:	48 89 c7             	mov    %rax,%rdi
+  8010cb:	49 89 df             	mov    %rbx,%r15
+  8010ce:	48 b8 26 85 ff ff ff 	movabs $0xffffffffffff8526,%rax
+  8010d5:	ff ff ff 
+  8010d8:	48 01 d8             	add    %rbx,%rax
+  8010db:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8010dd:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8010e3:	48 98                	cltq
+  8010e5:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8010ec:	48 83 c2 08          	add    $0x8,%rdx
+  8010f0:	48 89 c6             	mov    %rax,%rsi
+  8010f3:	48 89 d7             	mov    %rdx,%rdi
+  8010f6:	49 89 df             	mov    %rbx,%r15
+  8010f9:	48 b8 a8 99 ff ff ff 	movabs $0xffffffffffff99a8,%rax
+  801100:	ff ff ff 
+  801103:	48 01 d8             	add    %rbx,%rax
+  801106:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  801108:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80110e:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  801115:	5b                   	pop    %rbx
+  801116:	41 5f                	pop    %r15
+  801118:	5d                   	pop    %rbp
+  801119:	c3                   	ret
+
+000000000080111a <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  80111a:	55                   	push   %rbp
+  80111b:	48 89 e5             	mov    %rsp,%rbp
+  80111e:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  801125:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801125 <cprintf+0xb>
+  80112c:	49 bb 13 7f 00 00 00 	movabs $0x7f13,%r11
+  801133:	00 00 00 
+  801136:	4d 01 da             	add    %r11,%r10
+  801139:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801140:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  801147:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80114e:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801155:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80115c:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801163:	84 c0                	test   %al,%al
+  801165:	74 20                	je     801187 <cprintf+0x6d>
+  801167:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80116b:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80116f:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801173:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801177:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80117b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80117f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801183:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  801187:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80118e:	00 00 00 
+  801191:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801198:	00 00 00 
+  80119b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80119f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8011a6:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8011ad:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8011b4:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8011bb:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8011c2:	48 8b 06             	mov    (%rsi),%rax
+  8011c5:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8011c9:	48 89 01             	mov    %rax,(%rcx)
+  8011cc:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8011d0:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8011d4:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8011d8:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8011df:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8011e6:	48 89 d6             	mov    %rdx,%rsi
+  8011e9:	48 89 c7             	mov    %rax,%rdi
+  8011ec:	48 b8 02 80 ff ff ff 	movabs $0xffffffffffff8002,%rax
+  8011f3:	ff ff ff 
+  8011f6:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8011fa:	ff d0                	call   *%rax
+  8011fc:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  801202:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801208:	c9                   	leave
+  801209:	c3                   	ret
+
+000000000080120a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80120a:	55                   	push   %rbp
+  80120b:	48 89 e5             	mov    %rsp,%rbp
+  80120e:	53                   	push   %rbx
+  80120f:	48 83 ec 38          	sub    $0x38,%rsp
+  801213:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801213 <printnum+0x9>
+  80121a:	49 bb 25 7e 00 00 00 	movabs $0x7e25,%r11
+  801221:	00 00 00 
+  801224:	4c 01 db             	add    %r11,%rbx
+  801227:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80122b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80122f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801233:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  801236:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  80123a:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80123e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801241:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  801245:	72 58                	jb     80129f <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801247:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80124a:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80124d:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  801250:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801254:	ba 00 00 00 00       	mov    $0x0,%edx
+  801259:	48 f7 f6             	div    %rsi
+  80125c:	49 89 c2             	mov    %rax,%r10
+  80125f:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  801262:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801265:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  801269:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80126d:	41 89 c9             	mov    %ecx,%r9d
+  801270:	41 89 f8             	mov    %edi,%r8d
+  801273:	89 d1                	mov    %edx,%ecx
+  801275:	4c 89 d2             	mov    %r10,%rdx
+  801278:	48 89 c7             	mov    %rax,%rdi
+  80127b:	48 b8 d2 81 ff ff ff 	movabs $0xffffffffffff81d2,%rax
+  801282:	ff ff ff 
+  801285:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801289:	ff d0                	call   *%rax
+  80128b:	eb 1c                	jmp    8012a9 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80128d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801291:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801294:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801298:	48 89 d6             	mov    %rdx,%rsi
+  80129b:	89 c7                	mov    %eax,%edi
+  80129d:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80129f:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8012a3:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8012a7:	7f e4                	jg     80128d <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8012a9:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8012ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b5:	48 f7 f1             	div    %rcx
+  8012b8:	48 b8 b7 de ff ff ff 	movabs $0xffffffffffffdeb7,%rax
+  8012bf:	ff ff ff 
+  8012c2:	48 01 d8             	add    %rbx,%rax
+  8012c5:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8012c9:	0f be c0             	movsbl %al,%eax
+  8012cc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012d0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8012d4:	48 89 d6             	mov    %rdx,%rsi
+  8012d7:	89 c7                	mov    %eax,%edi
+  8012d9:	ff d1                	call   *%rcx
+}
+  8012db:	90                   	nop
+  8012dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e0:	c9                   	leave
+  8012e1:	c3                   	ret
+
+00000000008012e2 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+  8012e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8012ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012ea <getuint+0x8>
+  8012f1:	49 bb 4e 7d 00 00 00 	movabs $0x7d4e,%r11
+  8012f8:	00 00 00 
+  8012fb:	4c 01 d8             	add    %r11,%rax
+  8012fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801302:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  801305:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801309:	7e 4f                	jle    80135a <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  80130b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80130f:	8b 00                	mov    (%rax),%eax
+  801311:	83 f8 2f             	cmp    $0x2f,%eax
+  801314:	77 24                	ja     80133a <getuint+0x58>
+  801316:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80131a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80131e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801322:	8b 00                	mov    (%rax),%eax
+  801324:	89 c0                	mov    %eax,%eax
+  801326:	48 01 d0             	add    %rdx,%rax
+  801329:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80132d:	8b 12                	mov    (%rdx),%edx
+  80132f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801332:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801336:	89 0a                	mov    %ecx,(%rdx)
+  801338:	eb 14                	jmp    80134e <getuint+0x6c>
+  80133a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80133e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801342:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801346:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80134a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80134e:	48 8b 00             	mov    (%rax),%rax
+  801351:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801355:	e9 9d 00 00 00       	jmp    8013f7 <getuint+0x115>
+	else if (lflag)
+  80135a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80135e:	74 4c                	je     8013ac <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  801360:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801364:	8b 00                	mov    (%rax),%eax
+  801366:	83 f8 2f             	cmp    $0x2f,%eax
+  801369:	77 24                	ja     80138f <getuint+0xad>
+  80136b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80136f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801373:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801377:	8b 00                	mov    (%rax),%eax
+  801379:	89 c0                	mov    %eax,%eax
+  80137b:	48 01 d0             	add    %rdx,%rax
+  80137e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801382:	8b 12                	mov    (%rdx),%edx
+  801384:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801387:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80138b:	89 0a                	mov    %ecx,(%rdx)
+  80138d:	eb 14                	jmp    8013a3 <getuint+0xc1>
+  80138f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801393:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801397:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80139b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80139f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8013a3:	48 8b 00             	mov    (%rax),%rax
+  8013a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8013aa:	eb 4b                	jmp    8013f7 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8013ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b0:	8b 00                	mov    (%rax),%eax
+  8013b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8013b5:	77 24                	ja     8013db <getuint+0xf9>
+  8013b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013bb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8013bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c3:	8b 00                	mov    (%rax),%eax
+  8013c5:	89 c0                	mov    %eax,%eax
+  8013c7:	48 01 d0             	add    %rdx,%rax
+  8013ca:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8013ce:	8b 12                	mov    (%rdx),%edx
+  8013d0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8013d3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8013d7:	89 0a                	mov    %ecx,(%rdx)
+  8013d9:	eb 14                	jmp    8013ef <getuint+0x10d>
+  8013db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013df:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013e3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8013e7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8013eb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8013ef:	8b 00                	mov    (%rax),%eax
+  8013f1:	89 c0                	mov    %eax,%eax
+  8013f3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8013f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8013fb:	c9                   	leave
+  8013fc:	c3                   	ret
+
+00000000008013fd <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8013fd:	55                   	push   %rbp
+  8013fe:	48 89 e5             	mov    %rsp,%rbp
+  801401:	48 83 ec 20          	sub    $0x20,%rsp
+  801405:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801405 <printfloat+0x8>
+  80140c:	49 bb 33 7c 00 00 00 	movabs $0x7c33,%r11
+  801413:	00 00 00 
+  801416:	4c 01 d8             	add    %r11,%rax
+  801419:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80141d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801421:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  801425:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801429:	48 85 c0             	test   %rax,%rax
+  80142c:	79 12                	jns    801440 <printfloat+0x43>
+		putch('-',putdat);
+  80142e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801432:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801436:	48 89 c6             	mov    %rax,%rsi
+  801439:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80143e:	ff d2                	call   *%rdx
+	
+}
+  801440:	90                   	nop
+  801441:	c9                   	leave
+  801442:	c3                   	ret
+
+0000000000801443 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  801443:	55                   	push   %rbp
+  801444:	48 89 e5             	mov    %rsp,%rbp
+  801447:	48 83 ec 20          	sub    $0x20,%rsp
+  80144b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80144b <getint+0x8>
+  801452:	49 bb ed 7b 00 00 00 	movabs $0x7bed,%r11
+  801459:	00 00 00 
+  80145c:	4c 01 d8             	add    %r11,%rax
+  80145f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801463:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  801466:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80146a:	7e 4f                	jle    8014bb <getint+0x78>
+		x=va_arg(*ap, long long);
+  80146c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801470:	8b 00                	mov    (%rax),%eax
+  801472:	83 f8 2f             	cmp    $0x2f,%eax
+  801475:	77 24                	ja     80149b <getint+0x58>
+  801477:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80147b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80147f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801483:	8b 00                	mov    (%rax),%eax
+  801485:	89 c0                	mov    %eax,%eax
+  801487:	48 01 d0             	add    %rdx,%rax
+  80148a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80148e:	8b 12                	mov    (%rdx),%edx
+  801490:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801493:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801497:	89 0a                	mov    %ecx,(%rdx)
+  801499:	eb 14                	jmp    8014af <getint+0x6c>
+  80149b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80149f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8014a3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8014a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8014ab:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8014af:	48 8b 00             	mov    (%rax),%rax
+  8014b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8014b6:	e9 9d 00 00 00       	jmp    801558 <getint+0x115>
+	else if (lflag)
+  8014bb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8014bf:	74 4c                	je     80150d <getint+0xca>
+		x=va_arg(*ap, long);
+  8014c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014c5:	8b 00                	mov    (%rax),%eax
+  8014c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8014ca:	77 24                	ja     8014f0 <getint+0xad>
+  8014cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8014d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d8:	8b 00                	mov    (%rax),%eax
+  8014da:	89 c0                	mov    %eax,%eax
+  8014dc:	48 01 d0             	add    %rdx,%rax
+  8014df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8014e3:	8b 12                	mov    (%rdx),%edx
+  8014e5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8014e8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8014ec:	89 0a                	mov    %ecx,(%rdx)
+  8014ee:	eb 14                	jmp    801504 <getint+0xc1>
+  8014f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8014f8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8014fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801500:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801504:	48 8b 00             	mov    (%rax),%rax
+  801507:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80150b:	eb 4b                	jmp    801558 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  80150d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801511:	8b 00                	mov    (%rax),%eax
+  801513:	83 f8 2f             	cmp    $0x2f,%eax
+  801516:	77 24                	ja     80153c <getint+0xf9>
+  801518:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80151c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801520:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801524:	8b 00                	mov    (%rax),%eax
+  801526:	89 c0                	mov    %eax,%eax
+  801528:	48 01 d0             	add    %rdx,%rax
+  80152b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80152f:	8b 12                	mov    (%rdx),%edx
+  801531:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801534:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801538:	89 0a                	mov    %ecx,(%rdx)
+  80153a:	eb 14                	jmp    801550 <getint+0x10d>
+  80153c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801540:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801544:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801548:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80154c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801550:	8b 00                	mov    (%rax),%eax
+  801552:	48 98                	cltq
+  801554:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  801558:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80155c:	c9                   	leave
+  80155d:	c3                   	ret
+
+000000000080155e <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  80155e:	55                   	push   %rbp
+  80155f:	48 89 e5             	mov    %rsp,%rbp
+  801562:	41 57                	push   %r15
+  801564:	41 55                	push   %r13
+  801566:	41 54                	push   %r12
+  801568:	53                   	push   %rbx
+  801569:	48 83 ec 60          	sub    $0x60,%rsp
+  80156d:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 80156d <vprintfmt+0xf>
+  801574:	49 bb cb 7a 00 00 00 	movabs $0x7acb,%r11
+  80157b:	00 00 00 
+  80157e:	4d 01 dc             	add    %r11,%r12
+  801581:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  801585:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  801589:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80158d:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  801591:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  801598:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  80159c:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  8015a0:	48 8b 06             	mov    (%rsi),%rax
+  8015a3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8015a7:	48 89 01             	mov    %rax,(%rcx)
+  8015aa:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8015ae:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8015b2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8015b6:	eb 17                	jmp    8015cf <vprintfmt+0x71>
+			if (ch == '\0')
+  8015b8:	85 db                	test   %ebx,%ebx
+  8015ba:	0f 84 97 05 00 00    	je     801b57 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  8015c0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8015c4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8015c8:	48 89 c6             	mov    %rax,%rsi
+  8015cb:	89 df                	mov    %ebx,%edi
+  8015cd:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8015cf:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8015d3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015d7:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8015db:	0f b6 00             	movzbl (%rax),%eax
+  8015de:	0f b6 d8             	movzbl %al,%ebx
+  8015e1:	83 fb 25             	cmp    $0x25,%ebx
+  8015e4:	75 d2                	jne    8015b8 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  8015e6:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  8015ea:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  8015f1:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8015f8:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  8015ff:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  801606:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80160a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80160e:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801612:	0f b6 00             	movzbl (%rax),%eax
+  801615:	0f b6 d8             	movzbl %al,%ebx
+  801618:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80161b:	83 f8 55             	cmp    $0x55,%eax
+  80161e:	0f 87 00 05 00 00    	ja     801b24 <vprintfmt+0x5c6>
+  801624:	89 c0                	mov    %eax,%eax
+  801626:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80162d:	00 
+  80162e:	48 8d 05 e3 58 00 00 	lea    0x58e3(%rip),%rax        # 806f18 <.LC18+0xc>
+  801635:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  801639:	48 8d 15 d8 58 00 00 	lea    0x58d8(%rip),%rdx        # 806f18 <.LC18+0xc>
+  801640:	48 01 d0             	add    %rdx,%rax
+  801643:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  801645:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  801649:	eb bb                	jmp    801606 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  80164b:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  80164f:	eb b5                	jmp    801606 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  801651:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  801658:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80165b:	89 d0                	mov    %edx,%eax
+  80165d:	c1 e0 02             	shl    $0x2,%eax
+  801660:	01 d0                	add    %edx,%eax
+  801662:	01 c0                	add    %eax,%eax
+  801664:	01 d8                	add    %ebx,%eax
+  801666:	83 e8 30             	sub    $0x30,%eax
+  801669:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  80166c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801670:	0f b6 00             	movzbl (%rax),%eax
+  801673:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  801676:	83 fb 2f             	cmp    $0x2f,%ebx
+  801679:	7e 60                	jle    8016db <vprintfmt+0x17d>
+  80167b:	83 fb 39             	cmp    $0x39,%ebx
+  80167e:	7f 5b                	jg     8016db <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  801680:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  801685:	eb d1                	jmp    801658 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  801687:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80168a:	83 f8 2f             	cmp    $0x2f,%eax
+  80168d:	77 17                	ja     8016a6 <vprintfmt+0x148>
+  80168f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801693:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801696:	89 d2                	mov    %edx,%edx
+  801698:	48 01 d0             	add    %rdx,%rax
+  80169b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80169e:	83 c2 08             	add    $0x8,%edx
+  8016a1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8016a4:	eb 0c                	jmp    8016b2 <vprintfmt+0x154>
+  8016a6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8016aa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8016ae:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8016b2:	8b 00                	mov    (%rax),%eax
+  8016b4:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  8016b7:	eb 23                	jmp    8016dc <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  8016b9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8016bd:	0f 89 43 ff ff ff    	jns    801606 <vprintfmt+0xa8>
+				width = 0;
+  8016c3:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  8016ca:	e9 37 ff ff ff       	jmp    801606 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  8016cf:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  8016d6:	e9 2b ff ff ff       	jmp    801606 <vprintfmt+0xa8>
+			goto process_precision;
+  8016db:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8016dc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8016e0:	0f 89 20 ff ff ff    	jns    801606 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  8016e6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8016e9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8016ec:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  8016f3:	e9 0e ff ff ff       	jmp    801606 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8016f8:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  8016fc:	e9 05 ff ff ff       	jmp    801606 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  801701:	83 fb 39             	cmp    $0x39,%ebx
+  801704:	7f 0b                	jg     801711 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  801706:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  801709:	c1 e0 08             	shl    $0x8,%eax
+  80170c:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80170f:	eb 21                	jmp    801732 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  801711:	83 fb 60             	cmp    $0x60,%ebx
+  801714:	7e 10                	jle    801726 <vprintfmt+0x1c8>
+  801716:	83 fb 66             	cmp    $0x66,%ebx
+  801719:	7f 0b                	jg     801726 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  80171b:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  80171e:	c1 e0 08             	shl    $0x8,%eax
+  801721:	01 45 bc             	add    %eax,-0x44(%rbp)
+  801724:	eb 0c                	jmp    801732 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  801726:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  80172d:	e9 04 01 00 00       	jmp    801836 <vprintfmt+0x2d8>
+  801732:	e9 ff 00 00 00       	jmp    801836 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  801737:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80173a:	83 f8 2f             	cmp    $0x2f,%eax
+  80173d:	77 17                	ja     801756 <vprintfmt+0x1f8>
+  80173f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801743:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801746:	89 d2                	mov    %edx,%edx
+  801748:	48 01 d0             	add    %rdx,%rax
+  80174b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80174e:	83 c2 08             	add    $0x8,%edx
+  801751:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801754:	eb 0c                	jmp    801762 <vprintfmt+0x204>
+  801756:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80175a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80175e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801762:	8b 00                	mov    (%rax),%eax
+  801764:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  801768:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  80176c:	48 89 d6             	mov    %rdx,%rsi
+  80176f:	89 c7                	mov    %eax,%edi
+  801771:	ff d1                	call   *%rcx
+			break;
+  801773:	e9 da 03 00 00       	jmp    801b52 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  801778:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80177b:	83 f8 2f             	cmp    $0x2f,%eax
+  80177e:	77 17                	ja     801797 <vprintfmt+0x239>
+  801780:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801784:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801787:	89 d2                	mov    %edx,%edx
+  801789:	48 01 d0             	add    %rdx,%rax
+  80178c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80178f:	83 c2 08             	add    $0x8,%edx
+  801792:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801795:	eb 0c                	jmp    8017a3 <vprintfmt+0x245>
+  801797:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80179b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80179f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8017a3:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8017a5:	85 db                	test   %ebx,%ebx
+  8017a7:	79 02                	jns    8017ab <vprintfmt+0x24d>
+				err = -err;
+  8017a9:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8017ab:	83 fb 15             	cmp    $0x15,%ebx
+  8017ae:	7f 19                	jg     8017c9 <vprintfmt+0x26b>
+  8017b0:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  8017b7:	00 00 00 
+  8017ba:	48 63 c3             	movslq %ebx,%rax
+  8017bd:	4c 01 e2             	add    %r12,%rdx
+  8017c0:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  8017c4:	4d 85 ed             	test   %r13,%r13
+  8017c7:	75 36                	jne    8017ff <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  8017c9:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8017cd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8017d1:	89 d9                	mov    %ebx,%ecx
+  8017d3:	48 ba c8 de ff ff ff 	movabs $0xffffffffffffdec8,%rdx
+  8017da:	ff ff ff 
+  8017dd:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8017e1:	48 89 c7             	mov    %rax,%rdi
+  8017e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e9:	49 b8 2d 8b ff ff ff 	movabs $0xffffffffffff8b2d,%r8
+  8017f0:	ff ff ff 
+  8017f3:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8017f7:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8017fa:	e9 53 03 00 00       	jmp    801b52 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  8017ff:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801803:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801807:	4c 89 e9             	mov    %r13,%rcx
+  80180a:	48 ba d1 de ff ff ff 	movabs $0xffffffffffffded1,%rdx
+  801811:	ff ff ff 
+  801814:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  801818:	48 89 c7             	mov    %rax,%rdi
+  80181b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801820:	49 b8 2d 8b ff ff ff 	movabs $0xffffffffffff8b2d,%r8
+  801827:	ff ff ff 
+  80182a:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  80182e:	41 ff d0             	call   *%r8
+			break;
+  801831:	e9 1c 03 00 00       	jmp    801b52 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  801836:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801839:	83 f8 2f             	cmp    $0x2f,%eax
+  80183c:	77 17                	ja     801855 <vprintfmt+0x2f7>
+  80183e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801842:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801845:	89 d2                	mov    %edx,%edx
+  801847:	48 01 d0             	add    %rdx,%rax
+  80184a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80184d:	83 c2 08             	add    $0x8,%edx
+  801850:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801853:	eb 0c                	jmp    801861 <vprintfmt+0x303>
+  801855:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801859:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80185d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801861:	4c 8b 28             	mov    (%rax),%r13
+  801864:	4d 85 ed             	test   %r13,%r13
+  801867:	75 0e                	jne    801877 <vprintfmt+0x319>
+				p = "(null)";
+  801869:	48 b8 d4 de ff ff ff 	movabs $0xffffffffffffded4,%rax
+  801870:	ff ff ff 
+  801873:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  801877:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80187b:	0f 8e 84 00 00 00    	jle    801905 <vprintfmt+0x3a7>
+  801881:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  801885:	74 7e                	je     801905 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801887:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80188a:	48 98                	cltq
+  80188c:	48 89 c6             	mov    %rax,%rsi
+  80188f:	4c 89 ef             	mov    %r13,%rdi
+  801892:	4d 89 e7             	mov    %r12,%r15
+  801895:	48 b8 52 8e ff ff ff 	movabs $0xffffffffffff8e52,%rax
+  80189c:	ff ff ff 
+  80189f:	4c 01 e0             	add    %r12,%rax
+  8018a2:	ff d0                	call   *%rax
+  8018a4:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  8018a7:	eb 17                	jmp    8018c0 <vprintfmt+0x362>
+					putch(padc, putdat);
+  8018a9:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  8018ad:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8018b1:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8018b5:	48 89 d6             	mov    %rdx,%rsi
+  8018b8:	89 c7                	mov    %eax,%edi
+  8018ba:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8018bc:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8018c0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018c4:	7f e3                	jg     8018a9 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8018c6:	eb 3d                	jmp    801905 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8018c8:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8018cc:	74 1e                	je     8018ec <vprintfmt+0x38e>
+  8018ce:	83 fb 1f             	cmp    $0x1f,%ebx
+  8018d1:	7e 05                	jle    8018d8 <vprintfmt+0x37a>
+  8018d3:	83 fb 7e             	cmp    $0x7e,%ebx
+  8018d6:	7e 14                	jle    8018ec <vprintfmt+0x38e>
+					putch('?', putdat);
+  8018d8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8018dc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8018e0:	48 89 c6             	mov    %rax,%rsi
+  8018e3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8018e8:	ff d2                	call   *%rdx
+  8018ea:	eb 15                	jmp    801901 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  8018ec:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8018ef:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  8018f2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8018f6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8018fa:	48 89 c6             	mov    %rax,%rsi
+  8018fd:	89 cf                	mov    %ecx,%edi
+  8018ff:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801901:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801905:	4c 89 e8             	mov    %r13,%rax
+  801908:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  80190c:	0f b6 00             	movzbl (%rax),%eax
+  80190f:	0f be d8             	movsbl %al,%ebx
+  801912:	85 db                	test   %ebx,%ebx
+  801914:	74 28                	je     80193e <vprintfmt+0x3e0>
+  801916:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80191a:	78 ac                	js     8018c8 <vprintfmt+0x36a>
+  80191c:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801920:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801924:	79 a2                	jns    8018c8 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  801926:	eb 16                	jmp    80193e <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  801928:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80192c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801930:	48 89 c6             	mov    %rax,%rsi
+  801933:	bf 20 00 00 00       	mov    $0x20,%edi
+  801938:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  80193a:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80193e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801942:	7f e4                	jg     801928 <vprintfmt+0x3ca>
+			break;
+  801944:	e9 09 02 00 00       	jmp    801b52 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  801949:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80194d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801951:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801955:	0f b6 00             	movzbl (%rax),%eax
+  801958:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  80195b:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  80195c:	83 fb 2f             	cmp    $0x2f,%ebx
+  80195f:	0f 8e ac fd ff ff    	jle    801711 <vprintfmt+0x1b3>
+  801965:	e9 97 fd ff ff       	jmp    801701 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  80196a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80196e:	be 03 00 00 00       	mov    $0x3,%esi
+  801973:	48 89 c7             	mov    %rax,%rdi
+  801976:	48 b8 0b 84 ff ff ff 	movabs $0xffffffffffff840b,%rax
+  80197d:	ff ff ff 
+  801980:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801984:	ff d0                	call   *%rax
+  801986:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  80198a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80198e:	48 85 c0             	test   %rax,%rax
+  801991:	79 1d                	jns    8019b0 <vprintfmt+0x452>
+				putch('-', putdat);
+  801993:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801997:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80199b:	48 89 c6             	mov    %rax,%rsi
+  80199e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8019a3:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8019a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019a9:	48 f7 d8             	neg    %rax
+  8019ac:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8019b0:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8019b7:	e9 de 00 00 00       	jmp    801a9a <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8019bc:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8019c0:	be 03 00 00 00       	mov    $0x3,%esi
+  8019c5:	48 89 c7             	mov    %rax,%rdi
+  8019c8:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  8019cf:	ff ff ff 
+  8019d2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8019d6:	ff d0                	call   *%rax
+  8019d8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  8019dc:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8019e3:	e9 b2 00 00 00       	jmp    801a9a <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8019e8:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8019ec:	be 03 00 00 00       	mov    $0x3,%esi
+  8019f1:	48 89 c7             	mov    %rax,%rdi
+  8019f4:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  8019fb:	ff ff ff 
+  8019fe:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801a02:	ff d0                	call   *%rax
+  801a04:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801a08:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801a0f:	e9 86 00 00 00       	jmp    801a9a <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801a14:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801a18:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801a1c:	48 89 c6             	mov    %rax,%rsi
+  801a1f:	bf 30 00 00 00       	mov    $0x30,%edi
+  801a24:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801a26:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801a2a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801a2e:	48 89 c6             	mov    %rax,%rsi
+  801a31:	bf 78 00 00 00       	mov    $0x78,%edi
+  801a36:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801a38:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801a3b:	83 f8 2f             	cmp    $0x2f,%eax
+  801a3e:	77 17                	ja     801a57 <vprintfmt+0x4f9>
+  801a40:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a44:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801a47:	89 d2                	mov    %edx,%edx
+  801a49:	48 01 d0             	add    %rdx,%rax
+  801a4c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801a4f:	83 c2 08             	add    $0x8,%edx
+  801a52:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801a55:	eb 0c                	jmp    801a63 <vprintfmt+0x505>
+  801a57:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a5b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801a5f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801a63:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801a66:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801a6a:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801a71:	eb 27                	jmp    801a9a <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801a73:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801a77:	be 03 00 00 00       	mov    $0x3,%esi
+  801a7c:	48 89 c7             	mov    %rax,%rdi
+  801a7f:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  801a86:	ff ff ff 
+  801a89:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801a8d:	ff d0                	call   *%rax
+  801a8f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801a93:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801a9a:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801a9f:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801aa2:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801aa5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801aa9:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801aad:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801ab1:	45 89 c1             	mov    %r8d,%r9d
+  801ab4:	41 89 f8             	mov    %edi,%r8d
+  801ab7:	48 89 c7             	mov    %rax,%rdi
+  801aba:	48 b8 d2 81 ff ff ff 	movabs $0xffffffffffff81d2,%rax
+  801ac1:	ff ff ff 
+  801ac4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801ac8:	ff d0                	call   *%rax
+			break;
+  801aca:	e9 83 00 00 00       	jmp    801b52 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801acf:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801ad3:	be 03 00 00 00       	mov    $0x3,%esi
+  801ad8:	48 89 c7             	mov    %rax,%rdi
+  801adb:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  801ae2:	ff ff ff 
+  801ae5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801ae9:	ff d0                	call   *%rax
+  801aeb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801aef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801af3:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801af7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801afb:	48 89 ce             	mov    %rcx,%rsi
+  801afe:	48 89 c7             	mov    %rax,%rdi
+  801b01:	48 b8 c5 83 ff ff ff 	movabs $0xffffffffffff83c5,%rax
+  801b08:	ff ff ff 
+  801b0b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801b0f:	ff d0                	call   *%rax
+	
+			break;
+  801b11:	eb 3f                	jmp    801b52 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801b13:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801b17:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801b1b:	48 89 c6             	mov    %rax,%rsi
+  801b1e:	89 df                	mov    %ebx,%edi
+  801b20:	ff d2                	call   *%rdx
+			break;
+  801b22:	eb 2e                	jmp    801b52 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801b24:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801b28:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801b2c:	48 89 c6             	mov    %rax,%rsi
+  801b2f:	bf 25 00 00 00       	mov    $0x25,%edi
+  801b34:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801b36:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801b3b:	eb 05                	jmp    801b42 <vprintfmt+0x5e4>
+  801b3d:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801b42:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801b46:	48 83 e8 01          	sub    $0x1,%rax
+  801b4a:	0f b6 00             	movzbl (%rax),%eax
+  801b4d:	3c 25                	cmp    $0x25,%al
+  801b4f:	75 ec                	jne    801b3d <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801b51:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801b52:	e9 78 fa ff ff       	jmp    8015cf <vprintfmt+0x71>
+				return;
+  801b57:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801b58:	48 83 c4 60          	add    $0x60,%rsp
+  801b5c:	5b                   	pop    %rbx
+  801b5d:	41 5c                	pop    %r12
+  801b5f:	41 5d                	pop    %r13
+  801b61:	41 5f                	pop    %r15
+  801b63:	5d                   	pop    %rbp
+  801b64:	c3                   	ret
+
+0000000000801b65 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801b65:	55                   	push   %rbp
+  801b66:	48 89 e5             	mov    %rsp,%rbp
+  801b69:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801b70:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801b70 <printfmt+0xb>
+  801b77:	49 bb c8 74 00 00 00 	movabs $0x74c8,%r11
+  801b7e:	00 00 00 
+  801b81:	4d 01 da             	add    %r11,%r10
+  801b84:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801b8b:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801b92:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801b99:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801ba0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801ba7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801bae:	84 c0                	test   %al,%al
+  801bb0:	74 20                	je     801bd2 <printfmt+0x6d>
+  801bb2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801bb6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801bba:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801bbe:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801bc2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801bc6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801bca:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801bce:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801bd2:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801bd9:	00 00 00 
+  801bdc:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801be3:	00 00 00 
+  801be6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801bea:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801bf1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801bf8:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801bff:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801c06:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801c0d:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801c14:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801c1b:	48 89 c7             	mov    %rax,%rdi
+  801c1e:	48 b8 26 85 ff ff ff 	movabs $0xffffffffffff8526,%rax
+  801c25:	ff ff ff 
+  801c28:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801c2c:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801c2e:	90                   	nop
+  801c2f:	c9                   	leave
+  801c30:	c3                   	ret
+
+0000000000801c31 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801c31:	55                   	push   %rbp
+  801c32:	48 89 e5             	mov    %rsp,%rbp
+  801c35:	48 83 ec 10          	sub    $0x10,%rsp
+  801c39:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c39 <sprintputch+0x8>
+  801c40:	49 bb ff 73 00 00 00 	movabs $0x73ff,%r11
+  801c47:	00 00 00 
+  801c4a:	4c 01 d8             	add    %r11,%rax
+  801c4d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801c50:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801c54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c58:	8b 40 10             	mov    0x10(%rax),%eax
+  801c5b:	8d 50 01             	lea    0x1(%rax),%edx
+  801c5e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c62:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801c65:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c69:	48 8b 10             	mov    (%rax),%rdx
+  801c6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c70:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c74:	48 39 c2             	cmp    %rax,%rdx
+  801c77:	73 17                	jae    801c90 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801c79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c7d:	48 8b 00             	mov    (%rax),%rax
+  801c80:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c84:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801c88:	48 89 0a             	mov    %rcx,(%rdx)
+  801c8b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801c8e:	88 10                	mov    %dl,(%rax)
+}
+  801c90:	90                   	nop
+  801c91:	c9                   	leave
+  801c92:	c3                   	ret
+
+0000000000801c93 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801c93:	55                   	push   %rbp
+  801c94:	48 89 e5             	mov    %rsp,%rbp
+  801c97:	53                   	push   %rbx
+  801c98:	48 83 ec 58          	sub    $0x58,%rsp
+  801c9c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c9c <vsnprintf+0x9>
+  801ca3:	49 bb 9c 73 00 00 00 	movabs $0x739c,%r11
+  801caa:	00 00 00 
+  801cad:	4c 01 d8             	add    %r11,%rax
+  801cb0:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801cb4:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801cb7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801cbb:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801cbf:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801cc3:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801cc7:	48 8b 0e             	mov    (%rsi),%rcx
+  801cca:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801cce:	48 89 0a             	mov    %rcx,(%rdx)
+  801cd1:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801cd5:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801cd9:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801cdd:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801ce1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801ce5:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801ce8:	48 63 d2             	movslq %edx,%rdx
+  801ceb:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801cef:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801cf3:	48 01 ca             	add    %rcx,%rdx
+  801cf6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cfa:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801d01:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801d06:	74 06                	je     801d0e <vsnprintf+0x7b>
+  801d08:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801d0c:	7f 07                	jg     801d15 <vsnprintf+0x82>
+		return -E_INVAL;
+  801d0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d13:	eb 34                	jmp    801d49 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801d15:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801d19:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801d1d:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801d21:	48 bf f9 8b ff ff ff 	movabs $0xffffffffffff8bf9,%rdi
+  801d28:	ff ff ff 
+  801d2b:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801d2f:	49 b8 26 85 ff ff ff 	movabs $0xffffffffffff8526,%r8
+  801d36:	ff ff ff 
+  801d39:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801d3d:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801d3f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801d43:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801d46:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801d49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d4d:	c9                   	leave
+  801d4e:	c3                   	ret
+
+0000000000801d4f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801d4f:	55                   	push   %rbp
+  801d50:	48 89 e5             	mov    %rsp,%rbp
+  801d53:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801d5a:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801d5a <snprintf+0xb>
+  801d61:	49 bb de 72 00 00 00 	movabs $0x72de,%r11
+  801d68:	00 00 00 
+  801d6b:	4d 01 da             	add    %r11,%r10
+  801d6e:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801d75:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801d7b:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801d82:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801d89:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801d90:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801d97:	84 c0                	test   %al,%al
+  801d99:	74 20                	je     801dbb <snprintf+0x6c>
+  801d9b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801d9f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801da3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801da7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801dab:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801daf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801db3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801db7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801dbb:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801dc2:	00 00 00 
+  801dc5:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801dcc:	00 00 00 
+  801dcf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801dd3:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801dda:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801de1:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801de8:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801def:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801df6:	48 8b 06             	mov    (%rsi),%rax
+  801df9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801dfd:	48 89 01             	mov    %rax,(%rcx)
+  801e00:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801e04:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801e08:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801e0c:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801e13:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801e1a:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801e20:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801e27:	48 89 c7             	mov    %rax,%rdi
+  801e2a:	48 b8 5b 8c ff ff ff 	movabs $0xffffffffffff8c5b,%rax
+  801e31:	ff ff ff 
+  801e34:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e38:	ff d0                	call   *%rax
+  801e3a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801e40:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801e46:	c9                   	leave
+  801e47:	c3                   	ret
+
+0000000000801e48 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801e48:	55                   	push   %rbp
+  801e49:	48 89 e5             	mov    %rsp,%rbp
+  801e4c:	48 83 ec 18          	sub    $0x18,%rsp
+  801e50:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e50 <strlen+0x8>
+  801e57:	49 bb e8 71 00 00 00 	movabs $0x71e8,%r11
+  801e5e:	00 00 00 
+  801e61:	4c 01 d8             	add    %r11,%rax
+  801e64:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801e68:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801e6f:	eb 09                	jmp    801e7a <strlen+0x32>
+		n++;
+  801e71:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801e75:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801e7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e7e:	0f b6 00             	movzbl (%rax),%eax
+  801e81:	84 c0                	test   %al,%al
+  801e83:	75 ec                	jne    801e71 <strlen+0x29>
+	return n;
+  801e85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801e88:	c9                   	leave
+  801e89:	c3                   	ret
+
+0000000000801e8a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801e8a:	55                   	push   %rbp
+  801e8b:	48 89 e5             	mov    %rsp,%rbp
+  801e8e:	48 83 ec 20          	sub    $0x20,%rsp
+  801e92:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e92 <strnlen+0x8>
+  801e99:	49 bb a6 71 00 00 00 	movabs $0x71a6,%r11
+  801ea0:	00 00 00 
+  801ea3:	4c 01 d8             	add    %r11,%rax
+  801ea6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801eaa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801eae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801eb5:	eb 0e                	jmp    801ec5 <strnlen+0x3b>
+		n++;
+  801eb7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801ebb:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ec0:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801ec5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801eca:	74 0b                	je     801ed7 <strnlen+0x4d>
+  801ecc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ed0:	0f b6 00             	movzbl (%rax),%eax
+  801ed3:	84 c0                	test   %al,%al
+  801ed5:	75 e0                	jne    801eb7 <strnlen+0x2d>
+	return n;
+  801ed7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801eda:	c9                   	leave
+  801edb:	c3                   	ret
+
+0000000000801edc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801edc:	55                   	push   %rbp
+  801edd:	48 89 e5             	mov    %rsp,%rbp
+  801ee0:	48 83 ec 20          	sub    $0x20,%rsp
+  801ee4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ee4 <strcpy+0x8>
+  801eeb:	49 bb 54 71 00 00 00 	movabs $0x7154,%r11
+  801ef2:	00 00 00 
+  801ef5:	4c 01 d8             	add    %r11,%rax
+  801ef8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801efc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801f00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f04:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801f08:	90                   	nop
+  801f09:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801f0d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801f11:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801f15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f19:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801f1d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f21:	0f b6 12             	movzbl (%rdx),%edx
+  801f24:	88 10                	mov    %dl,(%rax)
+  801f26:	0f b6 00             	movzbl (%rax),%eax
+  801f29:	84 c0                	test   %al,%al
+  801f2b:	75 dc                	jne    801f09 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801f2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801f31:	c9                   	leave
+  801f32:	c3                   	ret
+
+0000000000801f33 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801f33:	55                   	push   %rbp
+  801f34:	48 89 e5             	mov    %rsp,%rbp
+  801f37:	53                   	push   %rbx
+  801f38:	48 83 ec 20          	sub    $0x20,%rsp
+  801f3c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801f3c <strcat+0x9>
+  801f43:	49 bb fc 70 00 00 00 	movabs $0x70fc,%r11
+  801f4a:	00 00 00 
+  801f4d:	4c 01 db             	add    %r11,%rbx
+  801f50:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801f54:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801f58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f5c:	48 89 c7             	mov    %rax,%rdi
+  801f5f:	48 b8 10 8e ff ff ff 	movabs $0xffffffffffff8e10,%rax
+  801f66:	ff ff ff 
+  801f69:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f6d:	ff d0                	call   *%rax
+  801f6f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801f72:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801f75:	48 63 d0             	movslq %eax,%rdx
+  801f78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f7c:	48 01 c2             	add    %rax,%rdx
+  801f7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f83:	48 89 c6             	mov    %rax,%rsi
+  801f86:	48 89 d7             	mov    %rdx,%rdi
+  801f89:	48 b8 a4 8e ff ff ff 	movabs $0xffffffffffff8ea4,%rax
+  801f90:	ff ff ff 
+  801f93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f97:	ff d0                	call   *%rax
+	return dst;
+  801f99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801f9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801fa1:	c9                   	leave
+  801fa2:	c3                   	ret
+
+0000000000801fa3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801fa3:	55                   	push   %rbp
+  801fa4:	48 89 e5             	mov    %rsp,%rbp
+  801fa7:	48 83 ec 28          	sub    $0x28,%rsp
+  801fab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fab <strncpy+0x8>
+  801fb2:	49 bb 8d 70 00 00 00 	movabs $0x708d,%r11
+  801fb9:	00 00 00 
+  801fbc:	4c 01 d8             	add    %r11,%rax
+  801fbf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801fc3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801fc7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801fcb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fcf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801fd3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801fda:	00 
+  801fdb:	eb 2a                	jmp    802007 <strncpy+0x64>
+		*dst++ = *src;
+  801fdd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fe1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801fe5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801fe9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801fed:	0f b6 12             	movzbl (%rdx),%edx
+  801ff0:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801ff2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ff6:	0f b6 00             	movzbl (%rax),%eax
+  801ff9:	84 c0                	test   %al,%al
+  801ffb:	74 05                	je     802002 <strncpy+0x5f>
+			src++;
+  801ffd:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  802002:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802007:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80200b:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80200f:	72 cc                	jb     801fdd <strncpy+0x3a>
+	}
+	return ret;
+  802011:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802015:	c9                   	leave
+  802016:	c3                   	ret
+
+0000000000802017 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802017:	55                   	push   %rbp
+  802018:	48 89 e5             	mov    %rsp,%rbp
+  80201b:	48 83 ec 28          	sub    $0x28,%rsp
+  80201f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80201f <strlcpy+0x8>
+  802026:	49 bb 19 70 00 00 00 	movabs $0x7019,%r11
+  80202d:	00 00 00 
+  802030:	4c 01 d8             	add    %r11,%rax
+  802033:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802037:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80203b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80203f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802043:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  802047:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80204c:	74 3d                	je     80208b <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  80204e:	eb 1d                	jmp    80206d <strlcpy+0x56>
+			*dst++ = *src++;
+  802050:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802054:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802058:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80205c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802060:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802064:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802068:	0f b6 12             	movzbl (%rdx),%edx
+  80206b:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80206d:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  802072:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802077:	74 0b                	je     802084 <strlcpy+0x6d>
+  802079:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80207d:	0f b6 00             	movzbl (%rax),%eax
+  802080:	84 c0                	test   %al,%al
+  802082:	75 cc                	jne    802050 <strlcpy+0x39>
+		*dst = '\0';
+  802084:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802088:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80208b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80208f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  802093:	c9                   	leave
+  802094:	c3                   	ret
+
+0000000000802095 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802095:	55                   	push   %rbp
+  802096:	48 89 e5             	mov    %rsp,%rbp
+  802099:	48 83 ec 10          	sub    $0x10,%rsp
+  80209d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80209d <strcmp+0x8>
+  8020a4:	49 bb 9b 6f 00 00 00 	movabs $0x6f9b,%r11
+  8020ab:	00 00 00 
+  8020ae:	4c 01 d8             	add    %r11,%rax
+  8020b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8020b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8020b9:	eb 0a                	jmp    8020c5 <strcmp+0x30>
+		p++, q++;
+  8020bb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8020c0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8020c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020c9:	0f b6 00             	movzbl (%rax),%eax
+  8020cc:	84 c0                	test   %al,%al
+  8020ce:	74 12                	je     8020e2 <strcmp+0x4d>
+  8020d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020d4:	0f b6 10             	movzbl (%rax),%edx
+  8020d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020db:	0f b6 00             	movzbl (%rax),%eax
+  8020de:	38 c2                	cmp    %al,%dl
+  8020e0:	74 d9                	je     8020bb <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8020e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020e6:	0f b6 00             	movzbl (%rax),%eax
+  8020e9:	0f b6 d0             	movzbl %al,%edx
+  8020ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020f0:	0f b6 00             	movzbl (%rax),%eax
+  8020f3:	0f b6 c0             	movzbl %al,%eax
+  8020f6:	29 c2                	sub    %eax,%edx
+  8020f8:	89 d0                	mov    %edx,%eax
+}
+  8020fa:	c9                   	leave
+  8020fb:	c3                   	ret
+
+00000000008020fc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8020fc:	55                   	push   %rbp
+  8020fd:	48 89 e5             	mov    %rsp,%rbp
+  802100:	48 83 ec 18          	sub    $0x18,%rsp
+  802104:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802104 <strncmp+0x8>
+  80210b:	49 bb 34 6f 00 00 00 	movabs $0x6f34,%r11
+  802112:	00 00 00 
+  802115:	4c 01 d8             	add    %r11,%rax
+  802118:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80211c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802120:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  802124:	eb 0f                	jmp    802135 <strncmp+0x39>
+		n--, p++, q++;
+  802126:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80212b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802130:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  802135:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80213a:	74 1d                	je     802159 <strncmp+0x5d>
+  80213c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802140:	0f b6 00             	movzbl (%rax),%eax
+  802143:	84 c0                	test   %al,%al
+  802145:	74 12                	je     802159 <strncmp+0x5d>
+  802147:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80214b:	0f b6 10             	movzbl (%rax),%edx
+  80214e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802152:	0f b6 00             	movzbl (%rax),%eax
+  802155:	38 c2                	cmp    %al,%dl
+  802157:	74 cd                	je     802126 <strncmp+0x2a>
+	if (n == 0)
+  802159:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80215e:	75 07                	jne    802167 <strncmp+0x6b>
+		return 0;
+  802160:	ba 00 00 00 00       	mov    $0x0,%edx
+  802165:	eb 16                	jmp    80217d <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802167:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80216b:	0f b6 00             	movzbl (%rax),%eax
+  80216e:	0f b6 d0             	movzbl %al,%edx
+  802171:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802175:	0f b6 00             	movzbl (%rax),%eax
+  802178:	0f b6 c0             	movzbl %al,%eax
+  80217b:	29 c2                	sub    %eax,%edx
+}
+  80217d:	89 d0                	mov    %edx,%eax
+  80217f:	c9                   	leave
+  802180:	c3                   	ret
+
+0000000000802181 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802181:	55                   	push   %rbp
+  802182:	48 89 e5             	mov    %rsp,%rbp
+  802185:	48 83 ec 10          	sub    $0x10,%rsp
+  802189:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802189 <strchr+0x8>
+  802190:	49 bb af 6e 00 00 00 	movabs $0x6eaf,%r11
+  802197:	00 00 00 
+  80219a:	4c 01 d8             	add    %r11,%rax
+  80219d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8021a1:	89 f0                	mov    %esi,%eax
+  8021a3:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8021a6:	eb 17                	jmp    8021bf <strchr+0x3e>
+		if (*s == c)
+  8021a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021ac:	0f b6 00             	movzbl (%rax),%eax
+  8021af:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8021b2:	75 06                	jne    8021ba <strchr+0x39>
+			return (char *) s;
+  8021b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021b8:	eb 15                	jmp    8021cf <strchr+0x4e>
+	for (; *s; s++)
+  8021ba:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8021bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021c3:	0f b6 00             	movzbl (%rax),%eax
+  8021c6:	84 c0                	test   %al,%al
+  8021c8:	75 de                	jne    8021a8 <strchr+0x27>
+	return 0;
+  8021ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021cf:	c9                   	leave
+  8021d0:	c3                   	ret
+
+00000000008021d1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8021d1:	55                   	push   %rbp
+  8021d2:	48 89 e5             	mov    %rsp,%rbp
+  8021d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021d9 <strfind+0x8>
+  8021e0:	49 bb 5f 6e 00 00 00 	movabs $0x6e5f,%r11
+  8021e7:	00 00 00 
+  8021ea:	4c 01 d8             	add    %r11,%rax
+  8021ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8021f1:	89 f0                	mov    %esi,%eax
+  8021f3:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8021f6:	eb 11                	jmp    802209 <strfind+0x38>
+		if (*s == c)
+  8021f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021fc:	0f b6 00             	movzbl (%rax),%eax
+  8021ff:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  802202:	74 12                	je     802216 <strfind+0x45>
+	for (; *s; s++)
+  802204:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802209:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80220d:	0f b6 00             	movzbl (%rax),%eax
+  802210:	84 c0                	test   %al,%al
+  802212:	75 e4                	jne    8021f8 <strfind+0x27>
+  802214:	eb 01                	jmp    802217 <strfind+0x46>
+			break;
+  802216:	90                   	nop
+	return (char *) s;
+  802217:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80221b:	c9                   	leave
+  80221c:	c3                   	ret
+
+000000000080221d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80221d:	55                   	push   %rbp
+  80221e:	48 89 e5             	mov    %rsp,%rbp
+  802221:	48 83 ec 18          	sub    $0x18,%rsp
+  802225:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802225 <memset+0x8>
+  80222c:	49 bb 13 6e 00 00 00 	movabs $0x6e13,%r11
+  802233:	00 00 00 
+  802236:	4c 01 d8             	add    %r11,%rax
+  802239:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80223d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802240:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  802244:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802249:	75 06                	jne    802251 <memset+0x34>
+		return v;
+  80224b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80224f:	eb 69                	jmp    8022ba <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  802251:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802255:	83 e0 03             	and    $0x3,%eax
+  802258:	48 85 c0             	test   %rax,%rax
+  80225b:	75 48                	jne    8022a5 <memset+0x88>
+  80225d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802261:	83 e0 03             	and    $0x3,%eax
+  802264:	48 85 c0             	test   %rax,%rax
+  802267:	75 3c                	jne    8022a5 <memset+0x88>
+		c &= 0xFF;
+  802269:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  802270:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802273:	c1 e0 18             	shl    $0x18,%eax
+  802276:	89 c2                	mov    %eax,%edx
+  802278:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80227b:	c1 e0 10             	shl    $0x10,%eax
+  80227e:	09 c2                	or     %eax,%edx
+  802280:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802283:	c1 e0 08             	shl    $0x8,%eax
+  802286:	09 d0                	or     %edx,%eax
+  802288:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  80228b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80228f:	48 c1 e8 02          	shr    $0x2,%rax
+  802293:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  802296:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80229a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80229d:	48 89 d7             	mov    %rdx,%rdi
+  8022a0:	fc                   	cld
+  8022a1:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8022a3:	eb 11                	jmp    8022b6 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8022a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8022a9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8022ac:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8022b0:	48 89 d7             	mov    %rdx,%rdi
+  8022b3:	fc                   	cld
+  8022b4:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8022b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8022ba:	c9                   	leave
+  8022bb:	c3                   	ret
+
+00000000008022bc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8022bc:	55                   	push   %rbp
+  8022bd:	48 89 e5             	mov    %rsp,%rbp
+  8022c0:	48 83 ec 28          	sub    $0x28,%rsp
+  8022c4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022c4 <memmove+0x8>
+  8022cb:	49 bb 74 6d 00 00 00 	movabs $0x6d74,%r11
+  8022d2:	00 00 00 
+  8022d5:	4c 01 d8             	add    %r11,%rax
+  8022d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8022e0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8022e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8022ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8022f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022f8:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8022fc:	0f 83 88 00 00 00    	jae    80238a <memmove+0xce>
+  802302:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802306:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80230a:	48 01 d0             	add    %rdx,%rax
+  80230d:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802311:	73 77                	jae    80238a <memmove+0xce>
+		s += n;
+  802313:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802317:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80231b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80231f:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  802323:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802327:	83 e0 03             	and    $0x3,%eax
+  80232a:	48 85 c0             	test   %rax,%rax
+  80232d:	75 3b                	jne    80236a <memmove+0xae>
+  80232f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802333:	83 e0 03             	and    $0x3,%eax
+  802336:	48 85 c0             	test   %rax,%rax
+  802339:	75 2f                	jne    80236a <memmove+0xae>
+  80233b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80233f:	83 e0 03             	and    $0x3,%eax
+  802342:	48 85 c0             	test   %rax,%rax
+  802345:	75 23                	jne    80236a <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802347:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80234b:	48 83 e8 04          	sub    $0x4,%rax
+  80234f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802353:	48 83 ea 04          	sub    $0x4,%rdx
+  802357:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80235b:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80235f:	48 89 c7             	mov    %rax,%rdi
+  802362:	48 89 d6             	mov    %rdx,%rsi
+  802365:	fd                   	std
+  802366:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  802368:	eb 1d                	jmp    802387 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80236a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80236e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802372:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802376:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  80237a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80237e:	48 89 d7             	mov    %rdx,%rdi
+  802381:	48 89 c1             	mov    %rax,%rcx
+  802384:	fd                   	std
+  802385:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802387:	fc                   	cld
+  802388:	eb 57                	jmp    8023e1 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80238a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80238e:	83 e0 03             	and    $0x3,%eax
+  802391:	48 85 c0             	test   %rax,%rax
+  802394:	75 36                	jne    8023cc <memmove+0x110>
+  802396:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80239a:	83 e0 03             	and    $0x3,%eax
+  80239d:	48 85 c0             	test   %rax,%rax
+  8023a0:	75 2a                	jne    8023cc <memmove+0x110>
+  8023a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023a6:	83 e0 03             	and    $0x3,%eax
+  8023a9:	48 85 c0             	test   %rax,%rax
+  8023ac:	75 1e                	jne    8023cc <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8023ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023b2:	48 c1 e8 02          	shr    $0x2,%rax
+  8023b6:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8023b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023bd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8023c1:	48 89 c7             	mov    %rax,%rdi
+  8023c4:	48 89 d6             	mov    %rdx,%rsi
+  8023c7:	fc                   	cld
+  8023c8:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8023ca:	eb 15                	jmp    8023e1 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8023cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8023d4:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8023d8:	48 89 c7             	mov    %rax,%rdi
+  8023db:	48 89 d6             	mov    %rdx,%rsi
+  8023de:	fc                   	cld
+  8023df:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8023e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8023e5:	c9                   	leave
+  8023e6:	c3                   	ret
+
+00000000008023e7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8023e7:	55                   	push   %rbp
+  8023e8:	48 89 e5             	mov    %rsp,%rbp
+  8023eb:	48 83 ec 18          	sub    $0x18,%rsp
+  8023ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023ef <memcpy+0x8>
+  8023f6:	49 bb 49 6c 00 00 00 	movabs $0x6c49,%r11
+  8023fd:	00 00 00 
+  802400:	4c 01 d8             	add    %r11,%rax
+  802403:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802407:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80240b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  80240f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802413:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  802417:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80241b:	48 89 cf             	mov    %rcx,%rdi
+  80241e:	48 b9 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rcx
+  802425:	ff ff ff 
+  802428:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80242c:	ff d0                	call   *%rax
+}
+  80242e:	c9                   	leave
+  80242f:	c3                   	ret
+
+0000000000802430 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802430:	55                   	push   %rbp
+  802431:	48 89 e5             	mov    %rsp,%rbp
+  802434:	48 83 ec 28          	sub    $0x28,%rsp
+  802438:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802438 <memcmp+0x8>
+  80243f:	49 bb 00 6c 00 00 00 	movabs $0x6c00,%r11
+  802446:	00 00 00 
+  802449:	4c 01 d8             	add    %r11,%rax
+  80244c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802450:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802454:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  802458:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80245c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  802460:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802464:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  802468:	eb 34                	jmp    80249e <memcmp+0x6e>
+		if (*s1 != *s2)
+  80246a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80246e:	0f b6 10             	movzbl (%rax),%edx
+  802471:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802475:	0f b6 00             	movzbl (%rax),%eax
+  802478:	38 c2                	cmp    %al,%dl
+  80247a:	74 18                	je     802494 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  80247c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802480:	0f b6 00             	movzbl (%rax),%eax
+  802483:	0f b6 d0             	movzbl %al,%edx
+  802486:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80248a:	0f b6 00             	movzbl (%rax),%eax
+  80248d:	0f b6 c0             	movzbl %al,%eax
+  802490:	29 c2                	sub    %eax,%edx
+  802492:	eb 20                	jmp    8024b4 <memcmp+0x84>
+		s1++, s2++;
+  802494:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802499:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  80249e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024a2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8024a6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8024aa:	48 85 c0             	test   %rax,%rax
+  8024ad:	75 bb                	jne    80246a <memcmp+0x3a>
+	}
+
+	return 0;
+  8024af:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8024b4:	89 d0                	mov    %edx,%eax
+  8024b6:	c9                   	leave
+  8024b7:	c3                   	ret
+
+00000000008024b8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8024b8:	55                   	push   %rbp
+  8024b9:	48 89 e5             	mov    %rsp,%rbp
+  8024bc:	48 83 ec 28          	sub    $0x28,%rsp
+  8024c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024c0 <memfind+0x8>
+  8024c7:	49 bb 78 6b 00 00 00 	movabs $0x6b78,%r11
+  8024ce:	00 00 00 
+  8024d1:	4c 01 d8             	add    %r11,%rax
+  8024d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8024d8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8024db:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8024df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8024e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024e7:	48 01 d0             	add    %rdx,%rax
+  8024ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8024ee:	eb 13                	jmp    802503 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8024f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8024f4:	0f b6 00             	movzbl (%rax),%eax
+  8024f7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8024fa:	38 d0                	cmp    %dl,%al
+  8024fc:	74 11                	je     80250f <memfind+0x57>
+	for (; s < ends; s++)
+  8024fe:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  802503:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802507:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80250b:	72 e3                	jb     8024f0 <memfind+0x38>
+  80250d:	eb 01                	jmp    802510 <memfind+0x58>
+			break;
+  80250f:	90                   	nop
+	return (void *) s;
+  802510:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802514:	c9                   	leave
+  802515:	c3                   	ret
+
+0000000000802516 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802516:	55                   	push   %rbp
+  802517:	48 89 e5             	mov    %rsp,%rbp
+  80251a:	48 83 ec 38          	sub    $0x38,%rsp
+  80251e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80251e <strtol+0x8>
+  802525:	49 bb 1a 6b 00 00 00 	movabs $0x6b1a,%r11
+  80252c:	00 00 00 
+  80252f:	4c 01 d8             	add    %r11,%rax
+  802532:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802536:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80253a:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  80253d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  802544:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80254b:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80254c:	eb 05                	jmp    802553 <strtol+0x3d>
+		s++;
+  80254e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  802553:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802557:	0f b6 00             	movzbl (%rax),%eax
+  80255a:	3c 20                	cmp    $0x20,%al
+  80255c:	74 f0                	je     80254e <strtol+0x38>
+  80255e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802562:	0f b6 00             	movzbl (%rax),%eax
+  802565:	3c 09                	cmp    $0x9,%al
+  802567:	74 e5                	je     80254e <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  802569:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80256d:	0f b6 00             	movzbl (%rax),%eax
+  802570:	3c 2b                	cmp    $0x2b,%al
+  802572:	75 07                	jne    80257b <strtol+0x65>
+		s++;
+  802574:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802579:	eb 17                	jmp    802592 <strtol+0x7c>
+	else if (*s == '-')
+  80257b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80257f:	0f b6 00             	movzbl (%rax),%eax
+  802582:	3c 2d                	cmp    $0x2d,%al
+  802584:	75 0c                	jne    802592 <strtol+0x7c>
+		s++, neg = 1;
+  802586:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80258b:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802592:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802596:	74 06                	je     80259e <strtol+0x88>
+  802598:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  80259c:	75 28                	jne    8025c6 <strtol+0xb0>
+  80259e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025a2:	0f b6 00             	movzbl (%rax),%eax
+  8025a5:	3c 30                	cmp    $0x30,%al
+  8025a7:	75 1d                	jne    8025c6 <strtol+0xb0>
+  8025a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025ad:	48 83 c0 01          	add    $0x1,%rax
+  8025b1:	0f b6 00             	movzbl (%rax),%eax
+  8025b4:	3c 78                	cmp    $0x78,%al
+  8025b6:	75 0e                	jne    8025c6 <strtol+0xb0>
+		s += 2, base = 16;
+  8025b8:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8025bd:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8025c4:	eb 2c                	jmp    8025f2 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  8025c6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8025ca:	75 19                	jne    8025e5 <strtol+0xcf>
+  8025cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025d0:	0f b6 00             	movzbl (%rax),%eax
+  8025d3:	3c 30                	cmp    $0x30,%al
+  8025d5:	75 0e                	jne    8025e5 <strtol+0xcf>
+		s++, base = 8;
+  8025d7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8025dc:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8025e3:	eb 0d                	jmp    8025f2 <strtol+0xdc>
+	else if (base == 0)
+  8025e5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8025e9:	75 07                	jne    8025f2 <strtol+0xdc>
+		base = 10;
+  8025eb:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8025f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025f6:	0f b6 00             	movzbl (%rax),%eax
+  8025f9:	3c 2f                	cmp    $0x2f,%al
+  8025fb:	7e 1d                	jle    80261a <strtol+0x104>
+  8025fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802601:	0f b6 00             	movzbl (%rax),%eax
+  802604:	3c 39                	cmp    $0x39,%al
+  802606:	7f 12                	jg     80261a <strtol+0x104>
+			dig = *s - '0';
+  802608:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80260c:	0f b6 00             	movzbl (%rax),%eax
+  80260f:	0f be c0             	movsbl %al,%eax
+  802612:	83 e8 30             	sub    $0x30,%eax
+  802615:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802618:	eb 4e                	jmp    802668 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  80261a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80261e:	0f b6 00             	movzbl (%rax),%eax
+  802621:	3c 60                	cmp    $0x60,%al
+  802623:	7e 1d                	jle    802642 <strtol+0x12c>
+  802625:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802629:	0f b6 00             	movzbl (%rax),%eax
+  80262c:	3c 7a                	cmp    $0x7a,%al
+  80262e:	7f 12                	jg     802642 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  802630:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802634:	0f b6 00             	movzbl (%rax),%eax
+  802637:	0f be c0             	movsbl %al,%eax
+  80263a:	83 e8 57             	sub    $0x57,%eax
+  80263d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802640:	eb 26                	jmp    802668 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  802642:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802646:	0f b6 00             	movzbl (%rax),%eax
+  802649:	3c 40                	cmp    $0x40,%al
+  80264b:	7e 47                	jle    802694 <strtol+0x17e>
+  80264d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802651:	0f b6 00             	movzbl (%rax),%eax
+  802654:	3c 5a                	cmp    $0x5a,%al
+  802656:	7f 3c                	jg     802694 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  802658:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80265c:	0f b6 00             	movzbl (%rax),%eax
+  80265f:	0f be c0             	movsbl %al,%eax
+  802662:	83 e8 37             	sub    $0x37,%eax
+  802665:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  802668:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80266b:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80266e:	7d 23                	jge    802693 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  802670:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802675:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802678:	48 98                	cltq
+  80267a:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80267f:	48 89 c2             	mov    %rax,%rdx
+  802682:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802685:	48 98                	cltq
+  802687:	48 01 d0             	add    %rdx,%rax
+  80268a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  80268e:	e9 5f ff ff ff       	jmp    8025f2 <strtol+0xdc>
+			break;
+  802693:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802694:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802699:	74 0b                	je     8026a6 <strtol+0x190>
+		*endptr = (char *) s;
+  80269b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80269f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026a3:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8026a6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8026aa:	74 09                	je     8026b5 <strtol+0x19f>
+  8026ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026b0:	48 f7 d8             	neg    %rax
+  8026b3:	eb 04                	jmp    8026b9 <strtol+0x1a3>
+  8026b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8026b9:	c9                   	leave
+  8026ba:	c3                   	ret
+
+00000000008026bb <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  8026bb:	55                   	push   %rbp
+  8026bc:	48 89 e5             	mov    %rsp,%rbp
+  8026bf:	53                   	push   %rbx
+  8026c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8026c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8026c4 <strstr+0x9>
+  8026cb:	49 bb 74 69 00 00 00 	movabs $0x6974,%r11
+  8026d2:	00 00 00 
+  8026d5:	4c 01 db             	add    %r11,%rbx
+  8026d8:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  8026dc:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  8026e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026e4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8026e8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026ec:	0f b6 00             	movzbl (%rax),%eax
+  8026ef:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  8026f2:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  8026f6:	75 06                	jne    8026fe <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  8026f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026fc:	eb 73                	jmp    802771 <strstr+0xb6>
+
+	len = strlen(str);
+  8026fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802702:	48 89 c7             	mov    %rax,%rdi
+  802705:	48 b8 10 8e ff ff ff 	movabs $0xffffffffffff8e10,%rax
+  80270c:	ff ff ff 
+  80270f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802713:	ff d0                	call   *%rax
+  802715:	48 98                	cltq
+  802717:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  80271b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80271f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802723:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  802727:	0f b6 00             	movzbl (%rax),%eax
+  80272a:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  80272d:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  802731:	75 07                	jne    80273a <strstr+0x7f>
+				return (char *) 0;
+  802733:	b8 00 00 00 00       	mov    $0x0,%eax
+  802738:	eb 37                	jmp    802771 <strstr+0xb6>
+		} while (sc != c);
+  80273a:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  80273e:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  802741:	75 d8                	jne    80271b <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  802743:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802747:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80274b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80274f:	48 89 ce             	mov    %rcx,%rsi
+  802752:	48 89 c7             	mov    %rax,%rdi
+  802755:	48 b8 c4 90 ff ff ff 	movabs $0xffffffffffff90c4,%rax
+  80275c:	ff ff ff 
+  80275f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802763:	ff d0                	call   *%rax
+  802765:	85 c0                	test   %eax,%eax
+  802767:	75 b2                	jne    80271b <strstr+0x60>
+
+	return (char *) (in - 1);
+  802769:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80276d:	48 83 e8 01          	sub    $0x1,%rax
+}
+  802771:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802775:	c9                   	leave
+  802776:	c3                   	ret
+
+0000000000802777 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  802777:	55                   	push   %rbp
+  802778:	48 89 e5             	mov    %rsp,%rbp
+  80277b:	41 57                	push   %r15
+  80277d:	53                   	push   %rbx
+  80277e:	48 83 ec 40          	sub    $0x40,%rsp
+  802782:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 802782 <syscall+0xb>
+  802789:	49 bb b6 68 00 00 00 	movabs $0x68b6,%r11
+  802790:	00 00 00 
+  802793:	4d 01 da             	add    %r11,%r10
+  802796:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802799:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80279c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8027a0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8027a4:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8027a8:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  8027ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8027af:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8027b3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8027b7:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8027bb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8027bf:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8027c3:	4c 89 c3             	mov    %r8,%rbx
+  8027c6:	cd 30                	int    $0x30
+  8027c8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  8027cc:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8027d0:	74 52                	je     802824 <syscall+0xad>
+  8027d2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8027d7:	7e 4b                	jle    802824 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8027d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027dd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8027e0:	49 89 d0             	mov    %rdx,%r8
+  8027e3:	89 c1                	mov    %eax,%ecx
+  8027e5:	48 b8 90 e1 ff ff ff 	movabs $0xffffffffffffe190,%rax
+  8027ec:	ff ff ff 
+  8027ef:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8027f3:	48 89 c2             	mov    %rax,%rdx
+  8027f6:	be 23 00 00 00       	mov    $0x23,%esi
+  8027fb:	48 b8 ad e1 ff ff ff 	movabs $0xffffffffffffe1ad,%rax
+  802802:	ff ff ff 
+  802805:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  802809:	48 89 c7             	mov    %rax,%rdi
+  80280c:	4d 89 d7             	mov    %r10,%r15
+  80280f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802814:	49 b9 0b 7e ff ff ff 	movabs $0xffffffffffff7e0b,%r9
+  80281b:	ff ff ff 
+  80281e:	4d 01 d1             	add    %r10,%r9
+  802821:	41 ff d1             	call   *%r9
+
+	return ret;
+  802824:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802828:	48 83 c4 40          	add    $0x40,%rsp
+  80282c:	5b                   	pop    %rbx
+  80282d:	41 5f                	pop    %r15
+  80282f:	5d                   	pop    %rbp
+  802830:	c3                   	ret
+
+0000000000802831 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  802831:	55                   	push   %rbp
+  802832:	48 89 e5             	mov    %rsp,%rbp
+  802835:	41 57                	push   %r15
+  802837:	41 56                	push   %r14
+  802839:	41 55                	push   %r13
+  80283b:	41 54                	push   %r12
+  80283d:	53                   	push   %rbx
+  80283e:	48 83 ec 48          	sub    $0x48,%rsp
+  802842:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 802842 <syscall_words+0x11>
+  802849:	49 bb f6 67 00 00 00 	movabs $0x67f6,%r11
+  802850:	00 00 00 
+  802853:	4d 01 de             	add    %r11,%r14
+  802856:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802859:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  80285c:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802860:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802864:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  802868:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  80286c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802871:	74 09                	je     80287c <syscall_words+0x4b>
+  802873:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802877:	48 8b 00             	mov    (%rax),%rax
+  80287a:	eb 05                	jmp    802881 <syscall_words+0x50>
+  80287c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802881:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  802884:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802889:	74 0a                	je     802895 <syscall_words+0x64>
+  80288b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80288f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802893:	eb 05                	jmp    80289a <syscall_words+0x69>
+  802895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289a:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  80289d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8028a2:	74 0a                	je     8028ae <syscall_words+0x7d>
+  8028a4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8028a8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8028ac:	eb 05                	jmp    8028b3 <syscall_words+0x82>
+  8028ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b3:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8028b6:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8028bb:	74 0a                	je     8028c7 <syscall_words+0x96>
+  8028bd:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8028c1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8028c5:	eb 05                	jmp    8028cc <syscall_words+0x9b>
+  8028c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028cc:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  8028cf:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8028d4:	74 0a                	je     8028e0 <syscall_words+0xaf>
+  8028d6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8028da:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8028de:	eb 05                	jmp    8028e5 <syscall_words+0xb4>
+  8028e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e5:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  8028e8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8028ed:	74 0a                	je     8028f9 <syscall_words+0xc8>
+  8028ef:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8028f3:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8028f7:	eb 05                	jmp    8028fe <syscall_words+0xcd>
+  8028f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fe:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  802901:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802904:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802908:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80290c:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802910:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  802914:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802918:	cd 30                	int    $0x30
+  80291a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  80291e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802923:	74 50                	je     802975 <syscall_words+0x144>
+		words[0] = r8;
+  802925:	4c 89 c2             	mov    %r8,%rdx
+  802928:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80292c:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  80292f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802933:	48 83 c0 08          	add    $0x8,%rax
+  802937:	4c 89 ca             	mov    %r9,%rdx
+  80293a:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  80293d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802941:	48 83 c0 10          	add    $0x10,%rax
+  802945:	4c 89 d2             	mov    %r10,%rdx
+  802948:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  80294b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80294f:	48 83 c0 18          	add    $0x18,%rax
+  802953:	4c 89 da             	mov    %r11,%rdx
+  802956:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  802959:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80295d:	48 83 c0 20          	add    $0x20,%rax
+  802961:	4c 89 e2             	mov    %r12,%rdx
+  802964:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  802967:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80296b:	48 83 c0 28          	add    $0x28,%rax
+  80296f:	4c 89 ea             	mov    %r13,%rdx
+  802972:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  802975:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  802979:	74 52                	je     8029cd <syscall_words+0x19c>
+  80297b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802980:	7e 4b                	jle    8029cd <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802982:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802986:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802989:	49 89 d0             	mov    %rdx,%r8
+  80298c:	89 c1                	mov    %eax,%ecx
+  80298e:	48 b8 90 e1 ff ff ff 	movabs $0xffffffffffffe190,%rax
+  802995:	ff ff ff 
+  802998:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80299c:	48 89 c2             	mov    %rax,%rdx
+  80299f:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8029a4:	48 b8 ad e1 ff ff ff 	movabs $0xffffffffffffe1ad,%rax
+  8029ab:	ff ff ff 
+  8029ae:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8029b2:	48 89 c7             	mov    %rax,%rdi
+  8029b5:	4d 89 f7             	mov    %r14,%r15
+  8029b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bd:	49 b9 0b 7e ff ff ff 	movabs $0xffffffffffff7e0b,%r9
+  8029c4:	ff ff ff 
+  8029c7:	4d 01 f1             	add    %r14,%r9
+  8029ca:	41 ff d1             	call   *%r9
+
+	return ret;
+  8029cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8029d1:	48 83 c4 48          	add    $0x48,%rsp
+  8029d5:	5b                   	pop    %rbx
+  8029d6:	41 5c                	pop    %r12
+  8029d8:	41 5d                	pop    %r13
+  8029da:	41 5e                	pop    %r14
+  8029dc:	41 5f                	pop    %r15
+  8029de:	5d                   	pop    %rbp
+  8029df:	c3                   	ret
+
+00000000008029e0 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8029e0:	55                   	push   %rbp
+  8029e1:	48 89 e5             	mov    %rsp,%rbp
+  8029e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8029e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029e8 <sys_cputs+0x8>
+  8029ef:	49 bb 50 66 00 00 00 	movabs $0x6650,%r11
+  8029f6:	00 00 00 
+  8029f9:	4c 01 d8             	add    %r11,%rax
+  8029fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a00:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802a04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a08:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a0c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a10:	6a 00                	push   $0x0
+  802a12:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a1e:	be 00 00 00 00       	mov    $0x0,%esi
+  802a23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a28:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802a2f:	ff ff ff 
+  802a32:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a36:	ff d0                	call   *%rax
+  802a38:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a3c:	90                   	nop
+  802a3d:	c9                   	leave
+  802a3e:	c3                   	ret
+
+0000000000802a3f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802a3f:	55                   	push   %rbp
+  802a40:	48 89 e5             	mov    %rsp,%rbp
+  802a43:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a43 <sys_cgetc+0x4>
+  802a4a:	49 bb f5 65 00 00 00 	movabs $0x65f5,%r11
+  802a51:	00 00 00 
+  802a54:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802a57:	48 83 ec 08          	sub    $0x8,%rsp
+  802a5b:	6a 00                	push   $0x0
+  802a5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a73:	be 00 00 00 00       	mov    $0x0,%esi
+  802a78:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a7d:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802a84:	ff ff ff 
+  802a87:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a8b:	ff d0                	call   *%rax
+  802a8d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a91:	c9                   	leave
+  802a92:	c3                   	ret
+
+0000000000802a93 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802a93:	55                   	push   %rbp
+  802a94:	48 89 e5             	mov    %rsp,%rbp
+  802a97:	48 83 ec 10          	sub    $0x10,%rsp
+  802a9b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a9b <sys_env_destroy+0x8>
+  802aa2:	49 bb 9d 65 00 00 00 	movabs $0x659d,%r11
+  802aa9:	00 00 00 
+  802aac:	4c 01 d8             	add    %r11,%rax
+  802aaf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802ab2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802ab5:	48 63 d2             	movslq %edx,%rdx
+  802ab8:	48 83 ec 08          	sub    $0x8,%rsp
+  802abc:	6a 00                	push   $0x0
+  802abe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ac4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802acf:	be 01 00 00 00       	mov    $0x1,%esi
+  802ad4:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ad9:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802ae0:	ff ff ff 
+  802ae3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802ae7:	ff d0                	call   *%rax
+  802ae9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aed:	c9                   	leave
+  802aee:	c3                   	ret
+
+0000000000802aef <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802aef:	55                   	push   %rbp
+  802af0:	48 89 e5             	mov    %rsp,%rbp
+  802af3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802af3 <sys_getenvid+0x4>
+  802afa:	49 bb 45 65 00 00 00 	movabs $0x6545,%r11
+  802b01:	00 00 00 
+  802b04:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802b07:	48 83 ec 08          	sub    $0x8,%rsp
+  802b0b:	6a 00                	push   $0x0
+  802b0d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b13:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b23:	be 00 00 00 00       	mov    $0x0,%esi
+  802b28:	bf 02 00 00 00       	mov    $0x2,%edi
+  802b2d:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802b34:	ff ff ff 
+  802b37:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b3b:	ff d0                	call   *%rax
+  802b3d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b41:	c9                   	leave
+  802b42:	c3                   	ret
+
+0000000000802b43 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802b43:	55                   	push   %rbp
+  802b44:	48 89 e5             	mov    %rsp,%rbp
+  802b47:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b47 <sys_yield+0x4>
+  802b4e:	49 bb f1 64 00 00 00 	movabs $0x64f1,%r11
+  802b55:	00 00 00 
+  802b58:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802b5b:	48 83 ec 08          	sub    $0x8,%rsp
+  802b5f:	6a 00                	push   $0x0
+  802b61:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b67:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b72:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b77:	be 00 00 00 00       	mov    $0x0,%esi
+  802b7c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b81:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802b88:	ff ff ff 
+  802b8b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b8f:	ff d0                	call   *%rax
+  802b91:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b95:	90                   	nop
+  802b96:	c9                   	leave
+  802b97:	c3                   	ret
+
+0000000000802b98 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802b98:	55                   	push   %rbp
+  802b99:	48 89 e5             	mov    %rsp,%rbp
+  802b9c:	48 83 ec 10          	sub    $0x10,%rsp
+  802ba0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ba0 <sys_page_alloc+0x8>
+  802ba7:	49 bb 98 64 00 00 00 	movabs $0x6498,%r11
+  802bae:	00 00 00 
+  802bb1:	4c 01 d8             	add    %r11,%rax
+  802bb4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802bb7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802bbb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802bbe:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802bc1:	48 63 f2             	movslq %edx,%rsi
+  802bc4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802bc8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802bcb:	48 63 d2             	movslq %edx,%rdx
+  802bce:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd2:	6a 00                	push   $0x0
+  802bd4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bda:	49 89 f0             	mov    %rsi,%r8
+  802bdd:	be 01 00 00 00       	mov    $0x1,%esi
+  802be2:	bf 04 00 00 00       	mov    $0x4,%edi
+  802be7:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802bee:	ff ff ff 
+  802bf1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802bf5:	ff d0                	call   *%rax
+  802bf7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bfb:	c9                   	leave
+  802bfc:	c3                   	ret
+
+0000000000802bfd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802bfd:	55                   	push   %rbp
+  802bfe:	48 89 e5             	mov    %rsp,%rbp
+  802c01:	48 83 ec 20          	sub    $0x20,%rsp
+  802c05:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c05 <sys_page_map+0x8>
+  802c0c:	49 bb 33 64 00 00 00 	movabs $0x6433,%r11
+  802c13:	00 00 00 
+  802c16:	4c 01 d8             	add    %r11,%rax
+  802c19:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c1c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802c20:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802c23:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802c27:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802c2b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802c2e:	48 63 f2             	movslq %edx,%rsi
+  802c31:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802c35:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802c38:	48 63 fa             	movslq %edx,%rdi
+  802c3b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802c3f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802c42:	48 63 d2             	movslq %edx,%rdx
+  802c45:	48 83 ec 08          	sub    $0x8,%rsp
+  802c49:	56                   	push   %rsi
+  802c4a:	4d 89 c1             	mov    %r8,%r9
+  802c4d:	49 89 f8             	mov    %rdi,%r8
+  802c50:	be 01 00 00 00       	mov    $0x1,%esi
+  802c55:	bf 05 00 00 00       	mov    $0x5,%edi
+  802c5a:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802c61:	ff ff ff 
+  802c64:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c68:	ff d0                	call   *%rax
+  802c6a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c6e:	c9                   	leave
+  802c6f:	c3                   	ret
+
+0000000000802c70 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802c70:	55                   	push   %rbp
+  802c71:	48 89 e5             	mov    %rsp,%rbp
+  802c74:	48 83 ec 10          	sub    $0x10,%rsp
+  802c78:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c78 <sys_page_unmap+0x8>
+  802c7f:	49 bb c0 63 00 00 00 	movabs $0x63c0,%r11
+  802c86:	00 00 00 
+  802c89:	4c 01 d8             	add    %r11,%rax
+  802c8c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c8f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802c93:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802c97:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802c9a:	48 63 d2             	movslq %edx,%rdx
+  802c9d:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca1:	6a 00                	push   $0x0
+  802ca3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ca9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802caf:	be 01 00 00 00       	mov    $0x1,%esi
+  802cb4:	bf 06 00 00 00       	mov    $0x6,%edi
+  802cb9:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802cc0:	ff ff ff 
+  802cc3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802cc7:	ff d0                	call   *%rax
+  802cc9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ccd:	c9                   	leave
+  802cce:	c3                   	ret
+
+0000000000802ccf <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802ccf:	55                   	push   %rbp
+  802cd0:	48 89 e5             	mov    %rsp,%rbp
+  802cd3:	48 83 ec 10          	sub    $0x10,%rsp
+  802cd7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802cd7 <sys_env_set_status+0x8>
+  802cde:	49 bb 61 63 00 00 00 	movabs $0x6361,%r11
+  802ce5:	00 00 00 
+  802ce8:	4c 01 d8             	add    %r11,%rax
+  802ceb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802cee:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802cf1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802cf4:	48 63 ca             	movslq %edx,%rcx
+  802cf7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802cfa:	48 63 d2             	movslq %edx,%rdx
+  802cfd:	48 83 ec 08          	sub    $0x8,%rsp
+  802d01:	6a 00                	push   $0x0
+  802d03:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d0f:	be 01 00 00 00       	mov    $0x1,%esi
+  802d14:	bf 08 00 00 00       	mov    $0x8,%edi
+  802d19:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802d20:	ff ff ff 
+  802d23:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d27:	ff d0                	call   *%rax
+  802d29:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d2d:	c9                   	leave
+  802d2e:	c3                   	ret
+
+0000000000802d2f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802d2f:	55                   	push   %rbp
+  802d30:	48 89 e5             	mov    %rsp,%rbp
+  802d33:	48 83 ec 10          	sub    $0x10,%rsp
+  802d37:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d37 <sys_env_set_trapframe+0x8>
+  802d3e:	49 bb 01 63 00 00 00 	movabs $0x6301,%r11
+  802d45:	00 00 00 
+  802d48:	4c 01 d8             	add    %r11,%rax
+  802d4b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802d4e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802d52:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802d56:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802d59:	48 63 d2             	movslq %edx,%rdx
+  802d5c:	48 83 ec 08          	sub    $0x8,%rsp
+  802d60:	6a 00                	push   $0x0
+  802d62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d6e:	be 01 00 00 00       	mov    $0x1,%esi
+  802d73:	bf 09 00 00 00       	mov    $0x9,%edi
+  802d78:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802d7f:	ff ff ff 
+  802d82:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d86:	ff d0                	call   *%rax
+  802d88:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d8c:	c9                   	leave
+  802d8d:	c3                   	ret
+
+0000000000802d8e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802d8e:	55                   	push   %rbp
+  802d8f:	48 89 e5             	mov    %rsp,%rbp
+  802d92:	48 83 ec 10          	sub    $0x10,%rsp
+  802d96:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d96 <sys_env_set_pgfault_upcall+0x8>
+  802d9d:	49 bb a2 62 00 00 00 	movabs $0x62a2,%r11
+  802da4:	00 00 00 
+  802da7:	4c 01 d8             	add    %r11,%rax
+  802daa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802dad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802db1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802db5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802db8:	48 63 d2             	movslq %edx,%rdx
+  802dbb:	48 83 ec 08          	sub    $0x8,%rsp
+  802dbf:	6a 00                	push   $0x0
+  802dc1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802dc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802dcd:	be 01 00 00 00       	mov    $0x1,%esi
+  802dd2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802dd7:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802dde:	ff ff ff 
+  802de1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802de5:	ff d0                	call   *%rax
+  802de7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802deb:	c9                   	leave
+  802dec:	c3                   	ret
+
+0000000000802ded <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802ded:	55                   	push   %rbp
+  802dee:	48 89 e5             	mov    %rsp,%rbp
+  802df1:	48 83 ec 20          	sub    $0x20,%rsp
+  802df5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802df5 <sys_ipc_try_send+0x8>
+  802dfc:	49 bb 43 62 00 00 00 	movabs $0x6243,%r11
+  802e03:	00 00 00 
+  802e06:	4c 01 d8             	add    %r11,%rax
+  802e09:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802e0c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802e10:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802e14:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802e17:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802e1a:	48 63 fa             	movslq %edx,%rdi
+  802e1d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802e21:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802e24:	48 63 d2             	movslq %edx,%rdx
+  802e27:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802e2b:	48 83 ec 08          	sub    $0x8,%rsp
+  802e2f:	6a 00                	push   $0x0
+  802e31:	49 89 f9             	mov    %rdi,%r9
+  802e34:	49 89 f0             	mov    %rsi,%r8
+  802e37:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802e41:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802e48:	ff ff ff 
+  802e4b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e4f:	ff d0                	call   *%rax
+  802e51:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e55:	c9                   	leave
+  802e56:	c3                   	ret
+
+0000000000802e57 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802e57:	55                   	push   %rbp
+  802e58:	48 89 e5             	mov    %rsp,%rbp
+  802e5b:	48 83 ec 20          	sub    $0x20,%rsp
+  802e5f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e5f <sys_ipc_send+0x8>
+  802e66:	49 bb d9 61 00 00 00 	movabs $0x61d9,%r11
+  802e6d:	00 00 00 
+  802e70:	4c 01 d8             	add    %r11,%rax
+  802e73:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802e76:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802e7a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802e7e:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802e81:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802e84:	48 63 fa             	movslq %edx,%rdi
+  802e87:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802e8b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802e8e:	48 63 d2             	movslq %edx,%rdx
+  802e91:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802e95:	48 83 ec 08          	sub    $0x8,%rsp
+  802e99:	6a 00                	push   $0x0
+  802e9b:	49 89 f9             	mov    %rdi,%r9
+  802e9e:	49 89 f0             	mov    %rsi,%r8
+  802ea1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea6:	bf 17 00 00 00       	mov    $0x17,%edi
+  802eab:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  802eb2:	ff ff ff 
+  802eb5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802eb9:	ff d0                	call   *%rax
+  802ebb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ebf:	c9                   	leave
+  802ec0:	c3                   	ret
+
+0000000000802ec1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802ec1:	55                   	push   %rbp
+  802ec2:	48 89 e5             	mov    %rsp,%rbp
+  802ec5:	48 83 ec 10          	sub    $0x10,%rsp
+  802ec9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ec9 <sys_ipc_recv+0x8>
+  802ed0:	49 bb 6f 61 00 00 00 	movabs $0x616f,%r11
+  802ed7:	00 00 00 
+  802eda:	4c 01 d8             	add    %r11,%rax
+  802edd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802ee1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ee5:	6a 00                	push   $0x0
+  802ee7:	6a 00                	push   $0x0
+  802ee9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802eef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ef5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802efa:	be 01 00 00 00       	mov    $0x1,%esi
+  802eff:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802f04:	49 ba f9 97 ff ff ff 	movabs $0xffffffffffff97f9,%r10
+  802f0b:	ff ff ff 
+  802f0e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f12:	ff d0                	call   *%rax
+  802f14:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f18:	c9                   	leave
+  802f19:	c3                   	ret
+
+0000000000802f1a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802f1a:	55                   	push   %rbp
+  802f1b:	48 89 e5             	mov    %rsp,%rbp
+  802f1e:	48 83 ec 30          	sub    $0x30,%rsp
+  802f22:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f22 <sys_ipc_call+0x8>
+  802f29:	49 bb 16 61 00 00 00 	movabs $0x6116,%r11
+  802f30:	00 00 00 
+  802f33:	4c 01 d8             	add    %r11,%rax
+  802f36:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802f39:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802f3d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802f41:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802f44:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802f48:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802f4c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802f50:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802f53:	4c 63 c2             	movslq %edx,%r8
+  802f56:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802f5a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802f5d:	48 63 d2             	movslq %edx,%rdx
+  802f60:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802f64:	ff 75 d8             	push   -0x28(%rbp)
+  802f67:	56                   	push   %rsi
+  802f68:	4d 89 c1             	mov    %r8,%r9
+  802f6b:	49 89 f8             	mov    %rdi,%r8
+  802f6e:	be 00 00 00 00       	mov    $0x0,%esi
+  802f73:	bf 18 00 00 00       	mov    $0x18,%edi
+  802f78:	49 ba f9 97 ff ff ff 	movabs $0xffffffffffff97f9,%r10
+  802f7f:	ff ff ff 
+  802f82:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f86:	ff d0                	call   *%rax
+  802f88:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802f8c:	c9                   	leave
+  802f8d:	c3                   	ret
+
+0000000000802f8e <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802f8e:	55                   	push   %rbp
+  802f8f:	48 89 e5             	mov    %rsp,%rbp
+  802f92:	48 83 ec 30          	sub    $0x30,%rsp
+  802f96:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f96 <sys_ipc_reply_recv+0x8>
+  802f9d:	49 bb a2 60 00 00 00 	movabs $0x60a2,%r11
+  802fa4:	00 00 00 
+  802fa7:	4c 01 d8             	add    %r11,%rax
+  802faa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802fad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802fb1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802fb5:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802fb8:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802fbc:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802fc0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802fc4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802fc7:	4c 63 c2             	movslq %edx,%r8
+  802fca:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802fce:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802fd1:	48 63 d2             	movslq %edx,%rdx
+  802fd4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802fd8:	ff 75 d8             	push   -0x28(%rbp)
+  802fdb:	56                   	push   %rsi
+  802fdc:	4d 89 c1             	mov    %r8,%r9
+  802fdf:	49 89 f8             	mov    %rdi,%r8
+  802fe2:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe7:	bf 19 00 00 00       	mov    $0x19,%edi
+  802fec:	49 ba f9 97 ff ff ff 	movabs $0xffffffffffff97f9,%r10
+  802ff3:	ff ff ff 
+  802ff6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802ffa:	ff d0                	call   *%rax
+  802ffc:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  803000:	c9                   	leave
+  803001:	c3                   	ret
+
+0000000000803002 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  803002:	55                   	push   %rbp
+  803003:	48 89 e5             	mov    %rsp,%rbp
+  803006:	48 83 ec 10          	sub    $0x10,%rsp
+  80300a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80300a <sys_env_set_priority+0x8>
+  803011:	49 bb 2e 60 00 00 00 	movabs $0x602e,%r11
+  803018:	00 00 00 
+  80301b:	4c 01 d8             	add    %r11,%rax
+  80301e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803021:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  803024:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803027:	48 63 ca             	movslq %edx,%rcx
+  80302a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80302d:	48 63 d2             	movslq %edx,%rdx
+  803030:	48 83 ec 08          	sub    $0x8,%rsp
+  803034:	6a 00                	push   $0x0
+  803036:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80303c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803042:	be 01 00 00 00       	mov    $0x1,%esi
+  803047:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80304c:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  803053:	ff ff ff 
+  803056:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80305a:	ff d0                	call   *%rax
+  80305c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803060:	c9                   	leave
+  803061:	c3                   	ret
+
+0000000000803062 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  803062:	55                   	push   %rbp
+  803063:	48 89 e5             	mov    %rsp,%rbp
+  803066:	48 83 ec 10          	sub    $0x10,%rsp
+  80306a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80306a <sys_env_set_affinity+0x8>
+  803071:	49 bb ce 5f 00 00 00 	movabs $0x5fce,%r11
+  803078:	00 00 00 
+  80307b:	4c 01 d8             	add    %r11,%rax
+  80307e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803081:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  803084:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  803087:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80308a:	48 63 d2             	movslq %edx,%rdx
+  80308d:	48 83 ec 08          	sub    $0x8,%rsp
+  803091:	6a 00                	push   $0x0
+  803093:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803099:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80309f:	be 01 00 00 00       	mov    $0x1,%esi
+  8030a4:	bf 10 00 00 00       	mov    $0x10,%edi
+  8030a9:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  8030b0:	ff ff ff 
+  8030b3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8030b7:	ff d0                	call   *%rax
+  8030b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8030bd:	c9                   	leave
+  8030be:	c3                   	ret
+
+00000000008030bf <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8030bf:	55                   	push   %rbp
+  8030c0:	48 89 e5             	mov    %rsp,%rbp
+  8030c3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8030c3 <sys_time_msec+0x4>
+  8030ca:	49 bb 75 5f 00 00 00 	movabs $0x5f75,%r11
+  8030d1:	00 00 00 
+  8030d4:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8030d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8030db:	6a 00                	push   $0x0
+  8030dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8030f8:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8030fd:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  803104:	ff ff ff 
+  803107:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80310b:	ff d0                	call   *%rax
+  80310d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803111:	c9                   	leave
+  803112:	c3                   	ret
+
+0000000000803113 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  803113:	55                   	push   %rbp
+  803114:	48 89 e5             	mov    %rsp,%rbp
+  803117:	48 83 ec 10          	sub    $0x10,%rsp
+  80311b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80311b <sys_sleep_usec+0x8>
+  803122:	49 bb 1d 5f 00 00 00 	movabs $0x5f1d,%r11
+  803129:	00 00 00 
+  80312c:	4c 01 d8             	add    %r11,%rax
+  80312f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  803133:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803137:	48 83 ec 08          	sub    $0x8,%rsp
+  80313b:	6a 00                	push   $0x0
+  80313d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803143:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803149:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80314e:	be 00 00 00 00       	mov    $0x0,%esi
+  803153:	bf 11 00 00 00       	mov    $0x11,%edi
+  803158:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  80315f:	ff ff ff 
+  803162:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803166:	ff d0                	call   *%rax
+  803168:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80316c:	c9                   	leave
+  80316d:	c3                   	ret
+
+000000000080316e <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80316e:	55                   	push   %rbp
+  80316f:	48 89 e5             	mov    %rsp,%rbp
+  803172:	48 83 ec 10          	sub    $0x10,%rsp
+  803176:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803176 <sys_page_alloc_huge+0x8>
+  80317d:	49 bb c2 5e 00 00 00 	movabs $0x5ec2,%r11
+  803184:	00 00 00 
+  803187:	4c 01 d8             	add    %r11,%rax
+  80318a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80318d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803191:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  803194:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803197:	48 63 f2             	movslq %edx,%rsi
+  80319a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80319e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8031a1:	48 63 d2             	movslq %edx,%rdx
+  8031a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8031a8:	6a 00                	push   $0x0
+  8031aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8031b0:	49 89 f0             	mov    %rsi,%r8
+  8031b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8031b8:	bf 12 00 00 00       	mov    $0x12,%edi
+  8031bd:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  8031c4:	ff ff ff 
+  8031c7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8031cb:	ff d0                	call   *%rax
+  8031cd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031d1:	c9                   	leave
+  8031d2:	c3                   	ret
+
+00000000008031d3 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8031d3:	55                   	push   %rbp
+  8031d4:	48 89 e5             	mov    %rsp,%rbp
+  8031d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8031db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8031db <sys_page_map_batch+0x8>
+  8031e2:	49 bb 5d 5e 00 00 00 	movabs $0x5e5d,%r11
+  8031e9:	00 00 00 
+  8031ec:	4c 01 d8             	add    %r11,%rax
+  8031ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8031f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8031f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031fb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8031ff:	48 83 ec 08          	sub    $0x8,%rsp
+  803203:	6a 00                	push   $0x0
+  803205:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80320b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803211:	be 01 00 00 00       	mov    $0x1,%esi
+  803216:	bf 13 00 00 00       	mov    $0x13,%edi
+  80321b:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  803222:	ff ff ff 
+  803225:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803229:	ff d0                	call   *%rax
+  80322b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80322f:	c9                   	leave
+  803230:	c3                   	ret
+
+0000000000803231 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  803231:	55                   	push   %rbp
+  803232:	48 89 e5             	mov    %rsp,%rbp
+  803235:	48 83 ec 10          	sub    $0x10,%rsp
+  803239:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803239 <sys_page_alloc_batch+0x8>
+  803240:	49 bb ff 5d 00 00 00 	movabs $0x5dff,%r11
+  803247:	00 00 00 
+  80324a:	4c 01 d8             	add    %r11,%rax
+  80324d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803251:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  803255:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803259:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80325d:	48 83 ec 08          	sub    $0x8,%rsp
+  803261:	6a 00                	push   $0x0
+  803263:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80326f:	be 01 00 00 00       	mov    $0x1,%esi
+  803274:	bf 14 00 00 00       	mov    $0x14,%edi
+  803279:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  803280:	ff ff ff 
+  803283:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803287:	ff d0                	call   *%rax
+  803289:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80328d:	c9                   	leave
+  80328e:	c3                   	ret
+
+000000000080328f <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80328f:	55                   	push   %rbp
+  803290:	48 89 e5             	mov    %rsp,%rbp
+  803293:	48 83 ec 10          	sub    $0x10,%rsp
+  803297:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803297 <sys_page_unmap_batch+0x8>
+  80329e:	49 bb a1 5d 00 00 00 	movabs $0x5da1,%r11
+  8032a5:	00 00 00 
+  8032a8:	4c 01 d8             	add    %r11,%rax
+  8032ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8032b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032b7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8032bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8032bf:	6a 00                	push   $0x0
+  8032c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8032c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8032cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8032d2:	bf 15 00 00 00       	mov    $0x15,%edi
+  8032d7:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  8032de:	ff ff ff 
+  8032e1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8032e5:	ff d0                	call   *%rax
+  8032e7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8032eb:	c9                   	leave
+  8032ec:	c3                   	ret
+
+00000000008032ed <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8032ed:	55                   	push   %rbp
+  8032ee:	48 89 e5             	mov    %rsp,%rbp
+  8032f1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8032f1 <sys_fork+0x4>
+  8032f8:	49 bb 47 5d 00 00 00 	movabs $0x5d47,%r11
+  8032ff:	00 00 00 
+  803302:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  803305:	48 83 ec 08          	sub    $0x8,%rsp
+  803309:	6a 00                	push   $0x0
+  80330b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803311:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803317:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80331c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803321:	be 00 00 00 00       	mov    $0x0,%esi
+  803326:	bf 16 00 00 00       	mov    $0x16,%edi
+  80332b:	49 ba 3f 97 ff ff ff 	movabs $0xffffffffffff973f,%r10
+  803332:	ff ff ff 
+  803335:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803339:	ff d0                	call   *%rax
+  80333b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80333f:	c9                   	leave
+  803340:	c3                   	ret
+
+0000000000803341 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803341:	55                   	push   %rbp
+  803342:	48 89 e5             	mov    %rsp,%rbp
+  803345:	41 57                	push   %r15
+  803347:	53                   	push   %rbx
+  803348:	48 83 ec 20          	sub    $0x20,%rsp
+  80334c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80334c <set_pgfault_handler+0xb>
+  803353:	49 bb ec 5c 00 00 00 	movabs $0x5cec,%r11
+  80335a:	00 00 00 
+  80335d:	4c 01 db             	add    %r11,%rbx
+  803360:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  803364:	49 89 df             	mov    %rbx,%r15
+  803367:	48 b8 b7 9a ff ff ff 	movabs $0xffffffffffff9ab7,%rax
+  80336e:	ff ff ff 
+  803371:	48 01 d8             	add    %rbx,%rax
+  803374:	ff d0                	call   *%rax
+  803376:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  803379:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  803380:	00 00 00 
+  803383:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803387:	48 85 c0             	test   %rax,%rax
+  80338a:	75 6b                	jne    8033f7 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  80338c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80338f:	ba 07 00 00 00       	mov    $0x7,%edx
+  803394:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  803399:	48 89 ce             	mov    %rcx,%rsi
+  80339c:	89 c7                	mov    %eax,%edi
+  80339e:	49 89 df             	mov    %rbx,%r15
+  8033a1:	48 b8 60 9b ff ff ff 	movabs $0xffffffffffff9b60,%rax
+  8033a8:	ff ff ff 
+  8033ab:	48 01 d8             	add    %rbx,%rax
+  8033ae:	ff d0                	call   *%rax
+  8033b0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  8033b3:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8033b7:	74 3e                	je     8033f7 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  8033b9:	48 b8 c0 e1 ff ff ff 	movabs $0xffffffffffffe1c0,%rax
+  8033c0:	ff ff ff 
+  8033c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033c7:	48 89 c2             	mov    %rax,%rdx
+  8033ca:	be 23 00 00 00       	mov    $0x23,%esi
+  8033cf:	48 b8 ee e1 ff ff ff 	movabs $0xffffffffffffe1ee,%rax
+  8033d6:	ff ff ff 
+  8033d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033dd:	48 89 c7             	mov    %rax,%rdi
+  8033e0:	49 89 df             	mov    %rbx,%r15
+  8033e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e8:	48 b9 0b 7e ff ff ff 	movabs $0xffffffffffff7e0b,%rcx
+  8033ef:	ff ff ff 
+  8033f2:	48 01 d9             	add    %rbx,%rcx
+  8033f5:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8033f7:	48 ba d8 1f 01 00 00 	movabs $0x11fd8,%rdx
+  8033fe:	00 00 00 
+  803401:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803405:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  803409:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80340c:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803413:	ff ff ff 
+  803416:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80341a:	48 89 d6             	mov    %rdx,%rsi
+  80341d:	89 c7                	mov    %eax,%edi
+  80341f:	49 89 df             	mov    %rbx,%r15
+  803422:	48 b8 56 9d ff ff ff 	movabs $0xffffffffffff9d56,%rax
+  803429:	ff ff ff 
+  80342c:	48 01 d8             	add    %rbx,%rax
+  80342f:	ff d0                	call   *%rax
+}
+  803431:	90                   	nop
+  803432:	48 83 c4 20          	add    $0x20,%rsp
+  803436:	5b                   	pop    %rbx
+  803437:	41 5f                	pop    %r15
+  803439:	5d                   	pop    %rbp
+  80343a:	c3                   	ret
+
+000000000080343b <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  80343b:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  80343e:	48 a1 10 b0 81 00 00 	movabs 0x81b010,%rax
+  803445:	00 00 00 
+call *%rax
+  803448:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  80344a:	58                   	pop    %rax
+	popq %rax;
+  80344b:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  80344c:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  803453:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  803457:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  80345b:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  80345f:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  803463:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  803467:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  80346a:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  80346e:	4c 8b 3c 24          	mov    (%rsp),%r15
+  803472:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  803477:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80347c:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  803481:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  803486:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80348b:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  803490:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  803495:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80349a:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80349f:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8034a4:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8034a9:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8034ae:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8034b3:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8034b8:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  8034bc:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  8034c0:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  8034c1:	5c                   	pop    %rsp
+	ret;			//return
+  8034c2:	c3                   	ret
+
+00000000008034c3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  8034c3:	55                   	push   %rbp
+  8034c4:	48 89 e5             	mov    %rsp,%rbp
+  8034c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8034cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8034cb <fd2num+0x8>
+  8034d2:	49 bb 6d 5b 00 00 00 	movabs $0x5b6d,%r11
+  8034d9:	00 00 00 
+  8034dc:	4c 01 d8             	add    %r11,%rax
+  8034df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8034e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034e7:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8034ee:	ff ff ff 
+  8034f1:	48 01 d0             	add    %rdx,%rax
+  8034f4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8034f8:	c9                   	leave
+  8034f9:	c3                   	ret
+
+00000000008034fa <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8034fa:	55                   	push   %rbp
+  8034fb:	48 89 e5             	mov    %rsp,%rbp
+  8034fe:	48 83 ec 08          	sub    $0x8,%rsp
+  803502:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803502 <fd2data+0x8>
+  803509:	49 bb 36 5b 00 00 00 	movabs $0x5b36,%r11
+  803510:	00 00 00 
+  803513:	4c 01 d8             	add    %r11,%rax
+  803516:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80351a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80351e:	48 89 d7             	mov    %rdx,%rdi
+  803521:	48 ba 8b a4 ff ff ff 	movabs $0xffffffffffffa48b,%rdx
+  803528:	ff ff ff 
+  80352b:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80352f:	ff d0                	call   *%rax
+  803531:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803537:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80353b:	c9                   	leave
+  80353c:	c3                   	ret
+
+000000000080353d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80353d:	55                   	push   %rbp
+  80353e:	48 89 e5             	mov    %rsp,%rbp
+  803541:	48 83 ec 18          	sub    $0x18,%rsp
+  803545:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803545 <fd_alloc+0x8>
+  80354c:	49 bb f3 5a 00 00 00 	movabs $0x5af3,%r11
+  803553:	00 00 00 
+  803556:	4c 01 d8             	add    %r11,%rax
+  803559:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80355d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803564:	eb 75                	jmp    8035db <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803566:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803569:	48 63 d2             	movslq %edx,%rdx
+  80356c:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803573:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803577:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80357b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80357f:	48 89 d1             	mov    %rdx,%rcx
+  803582:	48 c1 e9 15          	shr    $0x15,%rcx
+  803586:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80358d:	ff ff ff 
+  803590:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803594:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803598:	83 e2 01             	and    $0x1,%edx
+  80359b:	48 85 d2             	test   %rdx,%rdx
+  80359e:	74 25                	je     8035c5 <fd_alloc+0x88>
+  8035a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8035a4:	48 89 d1             	mov    %rdx,%rcx
+  8035a7:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8035ab:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8035b2:	ff ff ff 
+  8035b5:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8035b9:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8035bd:	83 e2 01             	and    $0x1,%edx
+  8035c0:	48 85 d2             	test   %rdx,%rdx
+  8035c3:	75 12                	jne    8035d7 <fd_alloc+0x9a>
+			*fd_store = fd;
+  8035c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8035cd:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8035d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d5:	eb 1a                	jmp    8035f1 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  8035d7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8035db:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8035df:	7e 85                	jle    803566 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  8035e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035e5:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  8035ec:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  8035f1:	c9                   	leave
+  8035f2:	c3                   	ret
+
+00000000008035f3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8035f3:	55                   	push   %rbp
+  8035f4:	48 89 e5             	mov    %rsp,%rbp
+  8035f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8035fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8035fb <fd_lookup+0x8>
+  803602:	49 bb 3d 5a 00 00 00 	movabs $0x5a3d,%r11
+  803609:	00 00 00 
+  80360c:	4c 01 d8             	add    %r11,%rax
+  80360f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803612:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803616:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80361a:	78 06                	js     803622 <fd_lookup+0x2f>
+  80361c:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803620:	7e 07                	jle    803629 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803622:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803627:	eb 73                	jmp    80369c <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803629:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80362c:	48 63 d2             	movslq %edx,%rdx
+  80362f:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803636:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80363a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80363e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803642:	48 89 d1             	mov    %rdx,%rcx
+  803645:	48 c1 e9 15          	shr    $0x15,%rcx
+  803649:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803650:	ff ff ff 
+  803653:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803657:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80365b:	83 e2 01             	and    $0x1,%edx
+  80365e:	48 85 d2             	test   %rdx,%rdx
+  803661:	74 22                	je     803685 <fd_lookup+0x92>
+  803663:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803667:	48 c1 ea 0c          	shr    $0xc,%rdx
+  80366b:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  803672:	ff ff ff 
+  803675:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803679:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80367d:	83 e0 01             	and    $0x1,%eax
+  803680:	48 85 c0             	test   %rax,%rax
+  803683:	75 07                	jne    80368c <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803685:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80368a:	eb 10                	jmp    80369c <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  80368c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803690:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803694:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803697:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80369c:	c9                   	leave
+  80369d:	c3                   	ret
+
+000000000080369e <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  80369e:	55                   	push   %rbp
+  80369f:	48 89 e5             	mov    %rsp,%rbp
+  8036a2:	41 57                	push   %r15
+  8036a4:	53                   	push   %rbx
+  8036a5:	48 83 ec 30          	sub    $0x30,%rsp
+  8036a9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036a9 <fd_close+0xb>
+  8036b0:	49 bb 8f 59 00 00 00 	movabs $0x598f,%r11
+  8036b7:	00 00 00 
+  8036ba:	4c 01 db             	add    %r11,%rbx
+  8036bd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8036c1:	89 f0                	mov    %esi,%eax
+  8036c3:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8036c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036ca:	48 89 c7             	mov    %rax,%rdi
+  8036cd:	48 b8 8b a4 ff ff ff 	movabs $0xffffffffffffa48b,%rax
+  8036d4:	ff ff ff 
+  8036d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036db:	ff d0                	call   *%rax
+  8036dd:	89 c2                	mov    %eax,%edx
+  8036df:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8036e3:	48 89 c6             	mov    %rax,%rsi
+  8036e6:	89 d7                	mov    %edx,%edi
+  8036e8:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  8036ef:	ff ff ff 
+  8036f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036f6:	ff d0                	call   *%rax
+  8036f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8036fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036ff:	78 0a                	js     80370b <fd_close+0x6d>
+	    || fd != fd2)
+  803701:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803705:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803709:	74 12                	je     80371d <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80370b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80370f:	74 05                	je     803716 <fd_close+0x78>
+  803711:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803714:	eb 7a                	jmp    803790 <fd_close+0xf2>
+  803716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80371b:	eb 73                	jmp    803790 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80371d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803721:	8b 00                	mov    (%rax),%eax
+  803723:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803727:	48 89 d6             	mov    %rdx,%rsi
+  80372a:	89 c7                	mov    %eax,%edi
+  80372c:	48 b8 61 a7 ff ff ff 	movabs $0xffffffffffffa761,%rax
+  803733:	ff ff ff 
+  803736:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80373a:	ff d0                	call   *%rax
+  80373c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80373f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803743:	78 2a                	js     80376f <fd_close+0xd1>
+		if (dev->dev_close)
+  803745:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803749:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80374d:	48 85 c0             	test   %rax,%rax
+  803750:	74 16                	je     803768 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803752:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803756:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80375a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80375e:	48 89 c7             	mov    %rax,%rdi
+  803761:	ff d2                	call   *%rdx
+  803763:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803766:	eb 07                	jmp    80376f <fd_close+0xd1>
+		else
+			r = 0;
+  803768:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  80376f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803773:	48 89 c6             	mov    %rax,%rsi
+  803776:	bf 00 00 00 00       	mov    $0x0,%edi
+  80377b:	49 89 df             	mov    %rbx,%r15
+  80377e:	48 b8 38 9c ff ff ff 	movabs $0xffffffffffff9c38,%rax
+  803785:	ff ff ff 
+  803788:	48 01 d8             	add    %rbx,%rax
+  80378b:	ff d0                	call   *%rax
+	return r;
+  80378d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803790:	48 83 c4 30          	add    $0x30,%rsp
+  803794:	5b                   	pop    %rbx
+  803795:	41 5f                	pop    %r15
+  803797:	5d                   	pop    %rbp
+  803798:	c3                   	ret
+
+0000000000803799 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803799:	55                   	push   %rbp
+  80379a:	48 89 e5             	mov    %rsp,%rbp
+  80379d:	41 57                	push   %r15
+  80379f:	48 83 ec 28          	sub    $0x28,%rsp
+  8037a3:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8037a3 <dev_lookup+0xa>
+  8037aa:	49 bb 95 58 00 00 00 	movabs $0x5895,%r11
+  8037b1:	00 00 00 
+  8037b4:	4c 01 d9             	add    %r11,%rcx
+  8037b7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8037ba:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8037be:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8037c5:	eb 45                	jmp    80380c <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  8037c7:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  8037ce:	00 00 00 
+  8037d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037d4:	48 98                	cltq
+  8037d6:	48 01 ca             	add    %rcx,%rdx
+  8037d9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037dd:	8b 00                	mov    (%rax),%eax
+  8037df:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8037e2:	75 24                	jne    803808 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  8037e4:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  8037eb:	00 00 00 
+  8037ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037f1:	48 98                	cltq
+  8037f3:	48 01 ca             	add    %rcx,%rdx
+  8037f6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037fe:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803801:	b8 00 00 00 00       	mov    $0x0,%eax
+  803806:	eb 74                	jmp    80387c <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803808:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80380c:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  803813:	00 00 00 
+  803816:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803819:	48 98                	cltq
+  80381b:	48 01 ca             	add    %rcx,%rdx
+  80381e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803822:	48 85 c0             	test   %rax,%rax
+  803825:	75 a0                	jne    8037c7 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803827:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80382e:	ff ff ff 
+  803831:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803835:	48 8b 00             	mov    (%rax),%rax
+  803838:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80383e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803841:	89 c6                	mov    %eax,%esi
+  803843:	48 b8 00 e2 ff ff ff 	movabs $0xffffffffffffe200,%rax
+  80384a:	ff ff ff 
+  80384d:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803851:	48 89 c7             	mov    %rax,%rdi
+  803854:	49 89 cf             	mov    %rcx,%r15
+  803857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385c:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  803863:	ff ff ff 
+  803866:	49 01 c8             	add    %rcx,%r8
+  803869:	41 ff d0             	call   *%r8
+	*dev = 0;
+  80386c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803870:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  803877:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80387c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803880:	c9                   	leave
+  803881:	c3                   	ret
+
+0000000000803882 <close>:
+
+int
+close(int fdnum)
+{
+  803882:	55                   	push   %rbp
+  803883:	48 89 e5             	mov    %rsp,%rbp
+  803886:	53                   	push   %rbx
+  803887:	48 83 ec 28          	sub    $0x28,%rsp
+  80388b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80388b <close+0x9>
+  803892:	49 bb ad 57 00 00 00 	movabs $0x57ad,%r11
+  803899:	00 00 00 
+  80389c:	4c 01 db             	add    %r11,%rbx
+  80389f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8038a2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8038a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038a9:	48 89 d6             	mov    %rdx,%rsi
+  8038ac:	89 c7                	mov    %eax,%edi
+  8038ae:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  8038b5:	ff ff ff 
+  8038b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038bc:	ff d0                	call   *%rax
+  8038be:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038c5:	79 05                	jns    8038cc <close+0x4a>
+		return r;
+  8038c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038ca:	eb 1c                	jmp    8038e8 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  8038cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8038d5:	48 89 c7             	mov    %rax,%rdi
+  8038d8:	48 b8 66 a6 ff ff ff 	movabs $0xffffffffffffa666,%rax
+  8038df:	ff ff ff 
+  8038e2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038e6:	ff d0                	call   *%rax
+}
+  8038e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038ec:	c9                   	leave
+  8038ed:	c3                   	ret
+
+00000000008038ee <close_all>:
+
+void
+close_all(void)
+{
+  8038ee:	55                   	push   %rbp
+  8038ef:	48 89 e5             	mov    %rsp,%rbp
+  8038f2:	53                   	push   %rbx
+  8038f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8038f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038f7 <close_all+0x9>
+  8038fe:	49 bb 41 57 00 00 00 	movabs $0x5741,%r11
+  803905:	00 00 00 
+  803908:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80390b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803912:	eb 19                	jmp    80392d <close_all+0x3f>
+		close(i);
+  803914:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803917:	89 c7                	mov    %eax,%edi
+  803919:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  803920:	ff ff ff 
+  803923:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803927:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803929:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80392d:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803931:	7e e1                	jle    803914 <close_all+0x26>
+}
+  803933:	90                   	nop
+  803934:	90                   	nop
+  803935:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803939:	c9                   	leave
+  80393a:	c3                   	ret
+
+000000000080393b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80393b:	55                   	push   %rbp
+  80393c:	48 89 e5             	mov    %rsp,%rbp
+  80393f:	41 57                	push   %r15
+  803941:	53                   	push   %rbx
+  803942:	48 83 ec 40          	sub    $0x40,%rsp
+  803946:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803946 <dup+0xb>
+  80394d:	49 bb f2 56 00 00 00 	movabs $0x56f2,%r11
+  803954:	00 00 00 
+  803957:	4c 01 db             	add    %r11,%rbx
+  80395a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80395d:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803960:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803964:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803967:	48 89 d6             	mov    %rdx,%rsi
+  80396a:	89 c7                	mov    %eax,%edi
+  80396c:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  803973:	ff ff ff 
+  803976:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80397a:	ff d0                	call   *%rax
+  80397c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80397f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803983:	79 08                	jns    80398d <dup+0x52>
+		return r;
+  803985:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803988:	e9 a4 01 00 00       	jmp    803b31 <dup+0x1f6>
+	close(newfdnum);
+  80398d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803990:	89 c7                	mov    %eax,%edi
+  803992:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  803999:	ff ff ff 
+  80399c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039a0:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8039a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039a5:	48 98                	cltq
+  8039a7:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8039ad:	48 c1 e0 0c          	shl    $0xc,%rax
+  8039b1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  8039b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039b9:	48 89 c7             	mov    %rax,%rdi
+  8039bc:	48 b8 c2 a4 ff ff ff 	movabs $0xffffffffffffa4c2,%rax
+  8039c3:	ff ff ff 
+  8039c6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039ca:	ff d0                	call   *%rax
+  8039cc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  8039d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039d4:	48 89 c7             	mov    %rax,%rdi
+  8039d7:	48 b8 c2 a4 ff ff ff 	movabs $0xffffffffffffa4c2,%rax
+  8039de:	ff ff ff 
+  8039e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039e5:	ff d0                	call   *%rax
+  8039e7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8039eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039ef:	48 c1 e8 15          	shr    $0x15,%rax
+  8039f3:	48 89 c2             	mov    %rax,%rdx
+  8039f6:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8039fd:	ff ff ff 
+  803a00:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a04:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a08:	83 e0 01             	and    $0x1,%eax
+  803a0b:	48 85 c0             	test   %rax,%rax
+  803a0e:	74 7f                	je     803a8f <dup+0x154>
+  803a10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a14:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a18:	48 89 c2             	mov    %rax,%rdx
+  803a1b:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803a22:	ff ff ff 
+  803a25:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a29:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a2d:	83 e0 01             	and    $0x1,%eax
+  803a30:	48 85 c0             	test   %rax,%rax
+  803a33:	74 5a                	je     803a8f <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803a35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a39:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a3d:	48 89 c2             	mov    %rax,%rdx
+  803a40:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803a47:	ff ff ff 
+  803a4a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a4e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a52:	25 07 0e 00 00       	and    $0xe07,%eax
+  803a57:	89 c1                	mov    %eax,%ecx
+  803a59:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a61:	41 89 c8             	mov    %ecx,%r8d
+  803a64:	48 89 d1             	mov    %rdx,%rcx
+  803a67:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a6c:	48 89 c6             	mov    %rax,%rsi
+  803a6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a74:	49 89 df             	mov    %rbx,%r15
+  803a77:	48 b8 c5 9b ff ff ff 	movabs $0xffffffffffff9bc5,%rax
+  803a7e:	ff ff ff 
+  803a81:	48 01 d8             	add    %rbx,%rax
+  803a84:	ff d0                	call   *%rax
+  803a86:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a89:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a8d:	78 5f                	js     803aee <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803a8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a93:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a97:	48 89 c2             	mov    %rax,%rdx
+  803a9a:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803aa1:	ff ff ff 
+  803aa4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803aa8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803aac:	25 07 0e 00 00       	and    $0xe07,%eax
+  803ab1:	89 c1                	mov    %eax,%ecx
+  803ab3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ab7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803abb:	41 89 c8             	mov    %ecx,%r8d
+  803abe:	48 89 d1             	mov    %rdx,%rcx
+  803ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ac6:	48 89 c6             	mov    %rax,%rsi
+  803ac9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ace:	49 89 df             	mov    %rbx,%r15
+  803ad1:	48 b8 c5 9b ff ff ff 	movabs $0xffffffffffff9bc5,%rax
+  803ad8:	ff ff ff 
+  803adb:	48 01 d8             	add    %rbx,%rax
+  803ade:	ff d0                	call   *%rax
+  803ae0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ae3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ae7:	78 08                	js     803af1 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803ae9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803aec:	eb 43                	jmp    803b31 <dup+0x1f6>
+			goto err;
+  803aee:	90                   	nop
+  803aef:	eb 01                	jmp    803af2 <dup+0x1b7>
+		goto err;
+  803af1:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803af2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803af6:	48 89 c6             	mov    %rax,%rsi
+  803af9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803afe:	49 89 df             	mov    %rbx,%r15
+  803b01:	48 b8 38 9c ff ff ff 	movabs $0xffffffffffff9c38,%rax
+  803b08:	ff ff ff 
+  803b0b:	48 01 d8             	add    %rbx,%rax
+  803b0e:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803b10:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b14:	48 89 c6             	mov    %rax,%rsi
+  803b17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b1c:	49 89 df             	mov    %rbx,%r15
+  803b1f:	48 b8 38 9c ff ff ff 	movabs $0xffffffffffff9c38,%rax
+  803b26:	ff ff ff 
+  803b29:	48 01 d8             	add    %rbx,%rax
+  803b2c:	ff d0                	call   *%rax
+	return r;
+  803b2e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803b31:	48 83 c4 40          	add    $0x40,%rsp
+  803b35:	5b                   	pop    %rbx
+  803b36:	41 5f                	pop    %r15
+  803b38:	5d                   	pop    %rbp
+  803b39:	c3                   	ret
+
+0000000000803b3a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803b3a:	55                   	push   %rbp
+  803b3b:	48 89 e5             	mov    %rsp,%rbp
+  803b3e:	41 57                	push   %r15
+  803b40:	53                   	push   %rbx
+  803b41:	48 83 ec 40          	sub    $0x40,%rsp
+  803b45:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b45 <read+0xb>
+  803b4c:	49 bb f3 54 00 00 00 	movabs $0x54f3,%r11
+  803b53:	00 00 00 
+  803b56:	4c 01 db             	add    %r11,%rbx
+  803b59:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803b5c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803b60:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803b64:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803b68:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803b6b:	48 89 d6             	mov    %rdx,%rsi
+  803b6e:	89 c7                	mov    %eax,%edi
+  803b70:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  803b77:	ff ff ff 
+  803b7a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b7e:	ff d0                	call   *%rax
+  803b80:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b83:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b87:	78 28                	js     803bb1 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b8d:	8b 00                	mov    (%rax),%eax
+  803b8f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803b93:	48 89 d6             	mov    %rdx,%rsi
+  803b96:	89 c7                	mov    %eax,%edi
+  803b98:	48 b8 61 a7 ff ff ff 	movabs $0xffffffffffffa761,%rax
+  803b9f:	ff ff ff 
+  803ba2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ba6:	ff d0                	call   *%rax
+  803ba8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803baf:	79 08                	jns    803bb9 <read+0x7f>
+		return r;
+  803bb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bb4:	e9 8b 00 00 00       	jmp    803c44 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803bb9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bbd:	8b 40 08             	mov    0x8(%rax),%eax
+  803bc0:	83 e0 03             	and    $0x3,%eax
+  803bc3:	83 f8 01             	cmp    $0x1,%eax
+  803bc6:	75 4b                	jne    803c13 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803bc8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803bcf:	ff ff ff 
+  803bd2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803bd6:	48 8b 00             	mov    (%rax),%rax
+  803bd9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803bdf:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803be2:	89 c6                	mov    %eax,%esi
+  803be4:	48 b8 1f e2 ff ff ff 	movabs $0xffffffffffffe21f,%rax
+  803beb:	ff ff ff 
+  803bee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bf2:	48 89 c7             	mov    %rax,%rdi
+  803bf5:	49 89 df             	mov    %rbx,%r15
+  803bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bfd:	48 b9 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rcx
+  803c04:	ff ff ff 
+  803c07:	48 01 d9             	add    %rbx,%rcx
+  803c0a:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803c0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c11:	eb 31                	jmp    803c44 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803c13:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c17:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803c1b:	48 85 c0             	test   %rax,%rax
+  803c1e:	75 07                	jne    803c27 <read+0xed>
+		return -E_NOT_SUPP;
+  803c20:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c25:	eb 1d                	jmp    803c44 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803c27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c2b:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803c2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c33:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803c37:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c3b:	48 89 ce             	mov    %rcx,%rsi
+  803c3e:	48 89 c7             	mov    %rax,%rdi
+  803c41:	41 ff d0             	call   *%r8
+}
+  803c44:	48 83 c4 40          	add    $0x40,%rsp
+  803c48:	5b                   	pop    %rbx
+  803c49:	41 5f                	pop    %r15
+  803c4b:	5d                   	pop    %rbp
+  803c4c:	c3                   	ret
+
+0000000000803c4d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803c4d:	55                   	push   %rbp
+  803c4e:	48 89 e5             	mov    %rsp,%rbp
+  803c51:	53                   	push   %rbx
+  803c52:	48 83 ec 38          	sub    $0x38,%rsp
+  803c56:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c56 <readn+0x9>
+  803c5d:	49 bb e2 53 00 00 00 	movabs $0x53e2,%r11
+  803c64:	00 00 00 
+  803c67:	4c 01 db             	add    %r11,%rbx
+  803c6a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c6d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803c71:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803c75:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803c7c:	eb 4b                	jmp    803cc9 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803c7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c81:	48 98                	cltq
+  803c83:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c87:	48 29 c2             	sub    %rax,%rdx
+  803c8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c8d:	48 63 c8             	movslq %eax,%rcx
+  803c90:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c94:	48 01 c1             	add    %rax,%rcx
+  803c97:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c9a:	48 89 ce             	mov    %rcx,%rsi
+  803c9d:	89 c7                	mov    %eax,%edi
+  803c9f:	48 b8 02 ab ff ff ff 	movabs $0xffffffffffffab02,%rax
+  803ca6:	ff ff ff 
+  803ca9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cad:	ff d0                	call   *%rax
+  803caf:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803cb2:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803cb6:	79 05                	jns    803cbd <readn+0x70>
+			return m;
+  803cb8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803cbb:	eb 1d                	jmp    803cda <readn+0x8d>
+		if (m == 0)
+  803cbd:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803cc1:	74 13                	je     803cd6 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803cc3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803cc6:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803cc9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ccc:	48 98                	cltq
+  803cce:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803cd2:	72 aa                	jb     803c7e <readn+0x31>
+  803cd4:	eb 01                	jmp    803cd7 <readn+0x8a>
+			break;
+  803cd6:	90                   	nop
+	}
+	return tot;
+  803cd7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803cda:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803cde:	c9                   	leave
+  803cdf:	c3                   	ret
+
+0000000000803ce0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803ce0:	55                   	push   %rbp
+  803ce1:	48 89 e5             	mov    %rsp,%rbp
+  803ce4:	41 57                	push   %r15
+  803ce6:	53                   	push   %rbx
+  803ce7:	48 83 ec 40          	sub    $0x40,%rsp
+  803ceb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ceb <write+0xb>
+  803cf2:	49 bb 4d 53 00 00 00 	movabs $0x534d,%r11
+  803cf9:	00 00 00 
+  803cfc:	4c 01 db             	add    %r11,%rbx
+  803cff:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803d02:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d06:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803d0a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803d0e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803d11:	48 89 d6             	mov    %rdx,%rsi
+  803d14:	89 c7                	mov    %eax,%edi
+  803d16:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  803d1d:	ff ff ff 
+  803d20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d24:	ff d0                	call   *%rax
+  803d26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d2d:	78 28                	js     803d57 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d33:	8b 00                	mov    (%rax),%eax
+  803d35:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803d39:	48 89 d6             	mov    %rdx,%rsi
+  803d3c:	89 c7                	mov    %eax,%edi
+  803d3e:	48 b8 61 a7 ff ff ff 	movabs $0xffffffffffffa761,%rax
+  803d45:	ff ff ff 
+  803d48:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d4c:	ff d0                	call   *%rax
+  803d4e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d51:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d55:	79 08                	jns    803d5f <write+0x7f>
+		return r;
+  803d57:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d5a:	e9 8a 00 00 00       	jmp    803de9 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803d5f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d63:	8b 40 08             	mov    0x8(%rax),%eax
+  803d66:	83 e0 03             	and    $0x3,%eax
+  803d69:	85 c0                	test   %eax,%eax
+  803d6b:	75 4b                	jne    803db8 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803d6d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803d74:	ff ff ff 
+  803d77:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803d7b:	48 8b 00             	mov    (%rax),%rax
+  803d7e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803d84:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803d87:	89 c6                	mov    %eax,%esi
+  803d89:	48 b8 3b e2 ff ff ff 	movabs $0xffffffffffffe23b,%rax
+  803d90:	ff ff ff 
+  803d93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d97:	48 89 c7             	mov    %rax,%rdi
+  803d9a:	49 89 df             	mov    %rbx,%r15
+  803d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803da2:	48 b9 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rcx
+  803da9:	ff ff ff 
+  803dac:	48 01 d9             	add    %rbx,%rcx
+  803daf:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803db1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803db6:	eb 31                	jmp    803de9 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803db8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dbc:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803dc0:	48 85 c0             	test   %rax,%rax
+  803dc3:	75 07                	jne    803dcc <write+0xec>
+		return -E_NOT_SUPP;
+  803dc5:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803dca:	eb 1d                	jmp    803de9 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803dcc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dd0:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803dd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dd8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803ddc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803de0:	48 89 ce             	mov    %rcx,%rsi
+  803de3:	48 89 c7             	mov    %rax,%rdi
+  803de6:	41 ff d0             	call   *%r8
+}
+  803de9:	48 83 c4 40          	add    $0x40,%rsp
+  803ded:	5b                   	pop    %rbx
+  803dee:	41 5f                	pop    %r15
+  803df0:	5d                   	pop    %rbp
+  803df1:	c3                   	ret
+
+0000000000803df2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803df2:	55                   	push   %rbp
+  803df3:	48 89 e5             	mov    %rsp,%rbp
+  803df6:	48 83 ec 18          	sub    $0x18,%rsp
+  803dfa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803dfa <seek+0x8>
+  803e01:	49 bb 3e 52 00 00 00 	movabs $0x523e,%r11
+  803e08:	00 00 00 
+  803e0b:	4c 01 d8             	add    %r11,%rax
+  803e0e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e11:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e14:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803e18:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803e1b:	48 89 ce             	mov    %rcx,%rsi
+  803e1e:	89 d7                	mov    %edx,%edi
+  803e20:	48 ba bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rdx
+  803e27:	ff ff ff 
+  803e2a:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803e2e:	ff d0                	call   *%rax
+  803e30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e33:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e37:	79 05                	jns    803e3e <seek+0x4c>
+		return r;
+  803e39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e3c:	eb 0f                	jmp    803e4d <seek+0x5b>
+	fd->fd_offset = offset;
+  803e3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e42:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803e45:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803e48:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e4d:	c9                   	leave
+  803e4e:	c3                   	ret
+
+0000000000803e4f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803e4f:	55                   	push   %rbp
+  803e50:	48 89 e5             	mov    %rsp,%rbp
+  803e53:	41 57                	push   %r15
+  803e55:	53                   	push   %rbx
+  803e56:	48 83 ec 30          	sub    $0x30,%rsp
+  803e5a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e5a <ftruncate+0xb>
+  803e61:	49 bb de 51 00 00 00 	movabs $0x51de,%r11
+  803e68:	00 00 00 
+  803e6b:	4c 01 db             	add    %r11,%rbx
+  803e6e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803e71:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803e74:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803e78:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803e7b:	48 89 d6             	mov    %rdx,%rsi
+  803e7e:	89 c7                	mov    %eax,%edi
+  803e80:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  803e87:	ff ff ff 
+  803e8a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e8e:	ff d0                	call   *%rax
+  803e90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e93:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e97:	78 28                	js     803ec1 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803e99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e9d:	8b 00                	mov    (%rax),%eax
+  803e9f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803ea3:	48 89 d6             	mov    %rdx,%rsi
+  803ea6:	89 c7                	mov    %eax,%edi
+  803ea8:	48 b8 61 a7 ff ff ff 	movabs $0xffffffffffffa761,%rax
+  803eaf:	ff ff ff 
+  803eb2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eb6:	ff d0                	call   *%rax
+  803eb8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ebb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ebf:	79 08                	jns    803ec9 <ftruncate+0x7a>
+		return r;
+  803ec1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ec4:	e9 83 00 00 00       	jmp    803f4c <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803ec9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ecd:	8b 40 08             	mov    0x8(%rax),%eax
+  803ed0:	83 e0 03             	and    $0x3,%eax
+  803ed3:	85 c0                	test   %eax,%eax
+  803ed5:	75 4b                	jne    803f22 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803ed7:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803ede:	ff ff ff 
+  803ee1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ee5:	48 8b 00             	mov    (%rax),%rax
+  803ee8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803eee:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803ef1:	89 c6                	mov    %eax,%esi
+  803ef3:	48 b8 58 e2 ff ff ff 	movabs $0xffffffffffffe258,%rax
+  803efa:	ff ff ff 
+  803efd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f01:	48 89 c7             	mov    %rax,%rdi
+  803f04:	49 89 df             	mov    %rbx,%r15
+  803f07:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f0c:	48 b9 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rcx
+  803f13:	ff ff ff 
+  803f16:	48 01 d9             	add    %rbx,%rcx
+  803f19:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803f1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f20:	eb 2a                	jmp    803f4c <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803f22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f26:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803f2a:	48 85 c0             	test   %rax,%rax
+  803f2d:	75 07                	jne    803f36 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803f2f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f34:	eb 16                	jmp    803f4c <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803f36:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f3a:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803f3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f42:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803f45:	89 d6                	mov    %edx,%esi
+  803f47:	48 89 c7             	mov    %rax,%rdi
+  803f4a:	ff d1                	call   *%rcx
+}
+  803f4c:	48 83 c4 30          	add    $0x30,%rsp
+  803f50:	5b                   	pop    %rbx
+  803f51:	41 5f                	pop    %r15
+  803f53:	5d                   	pop    %rbp
+  803f54:	c3                   	ret
+
+0000000000803f55 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803f55:	55                   	push   %rbp
+  803f56:	48 89 e5             	mov    %rsp,%rbp
+  803f59:	53                   	push   %rbx
+  803f5a:	48 83 ec 38          	sub    $0x38,%rsp
+  803f5e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f5e <fstat+0x9>
+  803f65:	49 bb da 50 00 00 00 	movabs $0x50da,%r11
+  803f6c:	00 00 00 
+  803f6f:	4c 01 db             	add    %r11,%rbx
+  803f72:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803f75:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803f79:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803f7d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803f80:	48 89 d6             	mov    %rdx,%rsi
+  803f83:	89 c7                	mov    %eax,%edi
+  803f85:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  803f8c:	ff ff ff 
+  803f8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f93:	ff d0                	call   *%rax
+  803f95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f9c:	78 28                	js     803fc6 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f9e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fa2:	8b 00                	mov    (%rax),%eax
+  803fa4:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803fa8:	48 89 d6             	mov    %rdx,%rsi
+  803fab:	89 c7                	mov    %eax,%edi
+  803fad:	48 b8 61 a7 ff ff ff 	movabs $0xffffffffffffa761,%rax
+  803fb4:	ff ff ff 
+  803fb7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fbb:	ff d0                	call   *%rax
+  803fbd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fc0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fc4:	79 05                	jns    803fcb <fstat+0x76>
+		return r;
+  803fc6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fc9:	eb 5e                	jmp    804029 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803fcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fcf:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803fd3:	48 85 c0             	test   %rax,%rax
+  803fd6:	75 07                	jne    803fdf <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803fd8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803fdd:	eb 4a                	jmp    804029 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803fdf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fe3:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803fe6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fea:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803ff1:	00 00 00 
+	stat->st_isdir = 0;
+  803ff4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ff8:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803fff:	00 00 00 
+	stat->st_dev = dev;
+  804002:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804006:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80400a:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804011:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804015:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804019:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80401d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804021:	48 89 d6             	mov    %rdx,%rsi
+  804024:	48 89 c7             	mov    %rax,%rdi
+  804027:	ff d1                	call   *%rcx
+}
+  804029:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80402d:	c9                   	leave
+  80402e:	c3                   	ret
+
+000000000080402f <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80402f:	55                   	push   %rbp
+  804030:	48 89 e5             	mov    %rsp,%rbp
+  804033:	41 57                	push   %r15
+  804035:	53                   	push   %rbx
+  804036:	48 83 ec 20          	sub    $0x20,%rsp
+  80403a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80403a <stat+0xb>
+  804041:	49 bb fe 4f 00 00 00 	movabs $0x4ffe,%r11
+  804048:	00 00 00 
+  80404b:	4c 01 db             	add    %r11,%rbx
+  80404e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804052:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804056:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80405a:	be 00 00 00 00       	mov    $0x0,%esi
+  80405f:	48 89 c7             	mov    %rax,%rdi
+  804062:	49 89 df             	mov    %rbx,%r15
+  804065:	48 b8 d1 b2 ff ff ff 	movabs $0xffffffffffffb2d1,%rax
+  80406c:	ff ff ff 
+  80406f:	48 01 d8             	add    %rbx,%rax
+  804072:	ff d0                	call   *%rax
+  804074:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804077:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80407b:	79 05                	jns    804082 <stat+0x53>
+		return fd;
+  80407d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804080:	eb 37                	jmp    8040b9 <stat+0x8a>
+	r = fstat(fd, stat);
+  804082:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804086:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804089:	48 89 d6             	mov    %rdx,%rsi
+  80408c:	89 c7                	mov    %eax,%edi
+  80408e:	48 b8 1d af ff ff ff 	movabs $0xffffffffffffaf1d,%rax
+  804095:	ff ff ff 
+  804098:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80409c:	ff d0                	call   *%rax
+  80409e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8040a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040a4:	89 c7                	mov    %eax,%edi
+  8040a6:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  8040ad:	ff ff ff 
+  8040b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040b4:	ff d0                	call   *%rax
+	return r;
+  8040b6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8040b9:	48 83 c4 20          	add    $0x20,%rsp
+  8040bd:	5b                   	pop    %rbx
+  8040be:	41 5f                	pop    %r15
+  8040c0:	5d                   	pop    %rbp
+  8040c1:	c3                   	ret
+
+00000000008040c2 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8040c2:	55                   	push   %rbp
+  8040c3:	48 89 e5             	mov    %rsp,%rbp
+  8040c6:	41 57                	push   %r15
+  8040c8:	53                   	push   %rbx
+  8040c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8040cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040cd <fsipc+0xb>
+  8040d4:	49 bb 6b 4f 00 00 00 	movabs $0x4f6b,%r11
+  8040db:	00 00 00 
+  8040de:	4c 01 db             	add    %r11,%rbx
+  8040e1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8040e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8040e8:	48 b8 98 11 00 00 00 	movabs $0x1198,%rax
+  8040ef:	00 00 00 
+  8040f2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8040f5:	85 c0                	test   %eax,%eax
+  8040f7:	75 24                	jne    80411d <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8040f9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8040fe:	49 89 df             	mov    %rbx,%r15
+  804101:	48 b8 d1 da ff ff ff 	movabs $0xffffffffffffdad1,%rax
+  804108:	ff ff ff 
+  80410b:	48 01 d8             	add    %rbx,%rax
+  80410e:	ff d0                	call   *%rax
+  804110:	48 ba 98 11 00 00 00 	movabs $0x1198,%rdx
+  804117:	00 00 00 
+  80411a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  80411d:	48 b8 98 11 00 00 00 	movabs $0x1198,%rax
+  804124:	00 00 00 
+  804127:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80412a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80412e:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804131:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804137:	49 89 d0             	mov    %rdx,%r8
+  80413a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80413f:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  804146:	00 00 00 
+  804149:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80414d:	89 c7                	mov    %eax,%edi
+  80414f:	49 89 df             	mov    %rbx,%r15
+  804152:	48 b8 f0 d4 ff ff ff 	movabs $0xffffffffffffd4f0,%rax
+  804159:	ff ff ff 
+  80415c:	48 01 d8             	add    %rbx,%rax
+  80415f:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804161:	48 83 c4 10          	add    $0x10,%rsp
+  804165:	5b                   	pop    %rbx
+  804166:	41 5f                	pop    %r15
+  804168:	5d                   	pop    %rbp
+  804169:	c3                   	ret
+
+000000000080416a <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  80416a:	55                   	push   %rbp
+  80416b:	48 89 e5             	mov    %rsp,%rbp
+  80416e:	41 57                	push   %r15
+  804170:	53                   	push   %rbx
+  804171:	48 83 ec 20          	sub    $0x20,%rsp
+  804175:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804175 <fsipc_words+0xb>
+  80417c:	49 bb c3 4e 00 00 00 	movabs $0x4ec3,%r11
+  804183:	00 00 00 
+  804186:	4c 01 db             	add    %r11,%rbx
+  804189:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80418c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804190:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804194:	48 b8 98 11 00 00 00 	movabs $0x1198,%rax
+  80419b:	00 00 00 
+  80419e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8041a1:	85 c0                	test   %eax,%eax
+  8041a3:	75 24                	jne    8041c9 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8041a5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041aa:	49 89 df             	mov    %rbx,%r15
+  8041ad:	48 b8 d1 da ff ff ff 	movabs $0xffffffffffffdad1,%rax
+  8041b4:	ff ff ff 
+  8041b7:	48 01 d8             	add    %rbx,%rax
+  8041ba:	ff d0                	call   *%rax
+  8041bc:	48 ba 98 11 00 00 00 	movabs $0x1198,%rdx
+  8041c3:	00 00 00 
+  8041c6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8041c9:	48 b8 98 11 00 00 00 	movabs $0x1198,%rax
+  8041d0:	00 00 00 
+  8041d3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8041d6:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8041da:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041de:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8041e1:	89 c7                	mov    %eax,%edi
+  8041e3:	49 89 df             	mov    %rbx,%r15
+  8041e6:	48 b8 db d5 ff ff ff 	movabs $0xffffffffffffd5db,%rax
+  8041ed:	ff ff ff 
+  8041f0:	48 01 d8             	add    %rbx,%rax
+  8041f3:	ff d0                	call   *%rax
+}
+  8041f5:	48 83 c4 20          	add    $0x20,%rsp
+  8041f9:	5b                   	pop    %rbx
+  8041fa:	41 5f                	pop    %r15
+  8041fc:	5d                   	pop    %rbp
+  8041fd:	c3                   	ret
+
+00000000008041fe <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8041fe:	55                   	push   %rbp
+  8041ff:	48 89 e5             	mov    %rsp,%rbp
+  804202:	41 57                	push   %r15
+  804204:	53                   	push   %rbx
+  804205:	48 83 ec 40          	sub    $0x40,%rsp
+  804209:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804209 <fsipc_pages+0xb>
+  804210:	49 bb 2f 4e 00 00 00 	movabs $0x4e2f,%r11
+  804217:	00 00 00 
+  80421a:	4c 01 db             	add    %r11,%rbx
+  80421d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804220:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804224:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804228:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  80422b:	48 b8 98 11 00 00 00 	movabs $0x1198,%rax
+  804232:	00 00 00 
+  804235:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804238:	85 c0                	test   %eax,%eax
+  80423a:	75 24                	jne    804260 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80423c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804241:	49 89 df             	mov    %rbx,%r15
+  804244:	48 b8 d1 da ff ff ff 	movabs $0xffffffffffffdad1,%rax
+  80424b:	ff ff ff 
+  80424e:	48 01 d8             	add    %rbx,%rax
+  804251:	ff d0                	call   *%rax
+  804253:	48 ba 98 11 00 00 00 	movabs $0x1198,%rdx
+  80425a:	00 00 00 
+  80425d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804260:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804265:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804269:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80426c:	48 98                	cltq
+  80426e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804272:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804276:	0f 95 c0             	setne  %al
+  804279:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  80427c:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804283:	00 
+  804284:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804288:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80428c:	48 01 d0             	add    %rdx,%rax
+  80428f:	48 83 e8 01          	sub    $0x1,%rax
+  804293:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804297:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80429b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042a0:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8042a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042a8:	48 29 d0             	sub    %rdx,%rax
+  8042ab:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8042af:	41 89 c2             	mov    %eax,%r10d
+  8042b2:	48 b8 98 11 00 00 00 	movabs $0x1198,%rax
+  8042b9:	00 00 00 
+  8042bc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8042bf:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8042c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8042c7:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8042ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8042ce:	6a 40                	push   $0x40
+  8042d0:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8042d5:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8042dc:	00 
+  8042dd:	6a 05                	push   $0x5
+  8042df:	41 89 f9             	mov    %edi,%r9d
+  8042e2:	49 89 c8             	mov    %rcx,%r8
+  8042e5:	44 89 d1             	mov    %r10d,%ecx
+  8042e8:	89 c7                	mov    %eax,%edi
+  8042ea:	49 89 df             	mov    %rbx,%r15
+  8042ed:	48 b8 d9 d6 ff ff ff 	movabs $0xffffffffffffd6d9,%rax
+  8042f4:	ff ff ff 
+  8042f7:	48 01 d8             	add    %rbx,%rax
+  8042fa:	ff d0                	call   *%rax
+  8042fc:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804300:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804304:	5b                   	pop    %rbx
+  804305:	41 5f                	pop    %r15
+  804307:	5d                   	pop    %rbp
+  804308:	c3                   	ret
+
+0000000000804309 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804309:	55                   	push   %rbp
+  80430a:	48 89 e5             	mov    %rsp,%rbp
+  80430d:	41 57                	push   %r15
+  80430f:	53                   	push   %rbx
+  804310:	48 83 ec 20          	sub    $0x20,%rsp
+  804314:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804314 <open+0xb>
+  80431b:	49 bb 24 4d 00 00 00 	movabs $0x4d24,%r11
+  804322:	00 00 00 
+  804325:	4c 01 db             	add    %r11,%rbx
+  804328:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80432c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  80432f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804333:	48 89 c7             	mov    %rax,%rdi
+  804336:	49 89 df             	mov    %rbx,%r15
+  804339:	48 b8 10 8e ff ff ff 	movabs $0xffffffffffff8e10,%rax
+  804340:	ff ff ff 
+  804343:	48 01 d8             	add    %rbx,%rax
+  804346:	ff d0                	call   *%rax
+  804348:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80434d:	7e 0a                	jle    804359 <open+0x50>
+		return -E_BAD_PATH;
+  80434f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804354:	e9 18 01 00 00       	jmp    804471 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804359:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80435d:	48 89 c7             	mov    %rax,%rdi
+  804360:	49 89 df             	mov    %rbx,%r15
+  804363:	48 b8 05 a5 ff ff ff 	movabs $0xffffffffffffa505,%rax
+  80436a:	ff ff ff 
+  80436d:	48 01 d8             	add    %rbx,%rax
+  804370:	ff d0                	call   *%rax
+  804372:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804375:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804379:	74 08                	je     804383 <open+0x7a>
+		return r;
+  80437b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80437e:	e9 ee 00 00 00       	jmp    804471 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804383:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  80438a:	00 00 00 
+  80438d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804390:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804397:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80439b:	48 89 c6             	mov    %rax,%rsi
+  80439e:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8043a5:	00 00 00 
+  8043a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043ac:	48 89 c7             	mov    %rax,%rdi
+  8043af:	49 89 df             	mov    %rbx,%r15
+  8043b2:	48 b8 a4 8e ff ff ff 	movabs $0xffffffffffff8ea4,%rax
+  8043b9:	ff ff ff 
+  8043bc:	48 01 d8             	add    %rbx,%rax
+  8043bf:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8043c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043c5:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  8043ca:	48 89 c6             	mov    %rax,%rsi
+  8043cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043d2:	49 89 df             	mov    %rbx,%r15
+  8043d5:	48 b8 60 9b ff ff ff 	movabs $0xffffffffffff9b60,%rax
+  8043dc:	ff ff ff 
+  8043df:	48 01 d8             	add    %rbx,%rax
+  8043e2:	ff d0                	call   *%rax
+  8043e4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043e7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043eb:	74 23                	je     804410 <open+0x107>
+		fd_close(fd,0);
+  8043ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8043f6:	48 89 c7             	mov    %rax,%rdi
+  8043f9:	49 89 df             	mov    %rbx,%r15
+  8043fc:	48 b8 66 a6 ff ff ff 	movabs $0xffffffffffffa666,%rax
+  804403:	ff ff ff 
+  804406:	48 01 d8             	add    %rbx,%rax
+  804409:	ff d0                	call   *%rax
+		return r;
+  80440b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80440e:	eb 61                	jmp    804471 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804410:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804414:	48 89 c6             	mov    %rax,%rsi
+  804417:	bf 01 00 00 00       	mov    $0x1,%edi
+  80441c:	48 b8 8a b0 ff ff ff 	movabs $0xffffffffffffb08a,%rax
+  804423:	ff ff ff 
+  804426:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80442a:	ff d0                	call   *%rax
+  80442c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80442f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804433:	74 23                	je     804458 <open+0x14f>
+		fd_close(fd,0);
+  804435:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804439:	be 00 00 00 00       	mov    $0x0,%esi
+  80443e:	48 89 c7             	mov    %rax,%rdi
+  804441:	49 89 df             	mov    %rbx,%r15
+  804444:	48 b8 66 a6 ff ff ff 	movabs $0xffffffffffffa666,%rax
+  80444b:	ff ff ff 
+  80444e:	48 01 d8             	add    %rbx,%rax
+  804451:	ff d0                	call   *%rax
+		return r;
+  804453:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804456:	eb 19                	jmp    804471 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804458:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80445c:	48 89 c7             	mov    %rax,%rdi
+  80445f:	49 89 df             	mov    %rbx,%r15
+  804462:	48 b8 8b a4 ff ff ff 	movabs $0xffffffffffffa48b,%rax
+  804469:	ff ff ff 
+  80446c:	48 01 d8             	add    %rbx,%rax
+  80446f:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804471:	48 83 c4 20          	add    $0x20,%rsp
+  804475:	5b                   	pop    %rbx
+  804476:	41 5f                	pop    %r15
+  804478:	5d                   	pop    %rbp
+  804479:	c3                   	ret
+
+000000000080447a <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  80447a:	55                   	push   %rbp
+  80447b:	48 89 e5             	mov    %rsp,%rbp
+  80447e:	48 83 ec 20          	sub    $0x20,%rsp
+  804482:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804482 <devfile_flush+0x8>
+  804489:	49 bb b6 4b 00 00 00 	movabs $0x4bb6,%r11
+  804490:	00 00 00 
+  804493:	4c 01 d8             	add    %r11,%rax
+  804496:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  80449a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80449e:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8044a1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8044a4:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8044a8:	ba 04 00 00 00       	mov    $0x4,%edx
+  8044ad:	48 89 ce             	mov    %rcx,%rsi
+  8044b0:	bf 06 00 00 00       	mov    $0x6,%edi
+  8044b5:	48 b9 32 b1 ff ff ff 	movabs $0xffffffffffffb132,%rcx
+  8044bc:	ff ff ff 
+  8044bf:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8044c3:	ff d0                	call   *%rax
+}
+  8044c5:	c9                   	leave
+  8044c6:	c3                   	ret
+
+00000000008044c7 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  8044c7:	55                   	push   %rbp
+  8044c8:	48 89 e5             	mov    %rsp,%rbp
+  8044cb:	41 57                	push   %r15
+  8044cd:	53                   	push   %rbx
+  8044ce:	48 83 ec 60          	sub    $0x60,%rsp
+  8044d2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044d2 <devfile_read+0xb>
+  8044d9:	49 bb 66 4b 00 00 00 	movabs $0x4b66,%r11
+  8044e0:	00 00 00 
+  8044e3:	4c 01 db             	add    %r11,%rbx
+  8044e6:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8044ea:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8044ee:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  8044f2:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8044f6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  8044fa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044fe:	8b 50 0c             	mov    0xc(%rax),%edx
+  804501:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804505:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804507:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80450b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80450f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804513:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804517:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80451c:	ba 10 00 00 00       	mov    $0x10,%edx
+  804521:	48 89 c6             	mov    %rax,%rsi
+  804524:	bf 03 00 00 00       	mov    $0x3,%edi
+  804529:	48 b8 c6 b1 ff ff ff 	movabs $0xffffffffffffb1c6,%rax
+  804530:	ff ff ff 
+  804533:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804537:	ff d0                	call   *%rax
+  804539:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80453c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804540:	79 05                	jns    804547 <devfile_read+0x80>
+		return r;
+  804542:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804545:	eb 64                	jmp    8045ab <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804547:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80454a:	48 63 d0             	movslq %eax,%rdx
+  80454d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804551:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804556:	48 01 c1             	add    %rax,%rcx
+  804559:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80455d:	48 89 ce             	mov    %rcx,%rsi
+  804560:	48 89 c7             	mov    %rax,%rdi
+  804563:	49 89 df             	mov    %rbx,%r15
+  804566:	48 b8 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rax
+  80456d:	ff ff ff 
+  804570:	48 01 d8             	add    %rbx,%rax
+  804573:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804575:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80457c:	ff ff ff 
+  80457f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804583:	48 8b 00             	mov    (%rax),%rax
+  804586:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  80458c:	89 c6                	mov    %eax,%esi
+  80458e:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804593:	48 89 c7             	mov    %rax,%rdi
+  804596:	49 89 df             	mov    %rbx,%r15
+  804599:	48 b8 8b da ff ff ff 	movabs $0xffffffffffffda8b,%rax
+  8045a0:	ff ff ff 
+  8045a3:	48 01 d8             	add    %rbx,%rax
+  8045a6:	ff d0                	call   *%rax
+	return r;
+  8045a8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8045ab:	48 83 c4 60          	add    $0x60,%rsp
+  8045af:	5b                   	pop    %rbx
+  8045b0:	41 5f                	pop    %r15
+  8045b2:	5d                   	pop    %rbp
+  8045b3:	c3                   	ret
+
+00000000008045b4 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8045b4:	55                   	push   %rbp
+  8045b5:	48 89 e5             	mov    %rsp,%rbp
+  8045b8:	41 57                	push   %r15
+  8045ba:	53                   	push   %rbx
+  8045bb:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  8045bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045bf <devfile_write+0xb>
+  8045c6:	49 bb 79 4a 00 00 00 	movabs $0x4a79,%r11
+  8045cd:	00 00 00 
+  8045d0:	4c 01 db             	add    %r11,%rbx
+  8045d3:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  8045d7:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  8045db:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  8045e2:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8045e6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  8045ea:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  8045f1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8045f5:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  8045fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045ff:	48 63 d0             	movslq %eax,%rdx
+  804602:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804606:	48 39 c2             	cmp    %rax,%rdx
+  804609:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80460d:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804614:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80461b:	00 
+  80461c:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804623:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804627:	48 01 d0             	add    %rdx,%rax
+  80462a:	48 83 e8 01          	sub    $0x1,%rax
+  80462e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804632:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804636:	ba 00 00 00 00       	mov    $0x0,%edx
+  80463b:	48 f7 75 d0          	divq   -0x30(%rbp)
+  80463f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804643:	48 29 d0             	sub    %rdx,%rax
+  804646:	48 c1 e8 0c          	shr    $0xc,%rax
+  80464a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  80464d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804650:	89 c6                	mov    %eax,%esi
+  804652:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804657:	48 89 c7             	mov    %rax,%rdi
+  80465a:	49 89 df             	mov    %rbx,%r15
+  80465d:	48 b8 45 da ff ff ff 	movabs $0xffffffffffffda45,%rax
+  804664:	ff ff ff 
+  804667:	48 01 d8             	add    %rbx,%rax
+  80466a:	ff d0                	call   *%rax
+  80466c:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  80466f:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804673:	79 08                	jns    80467d <devfile_write+0xc9>
+		return r;
+  804675:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804678:	e9 8f 00 00 00       	jmp    80470c <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  80467d:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804684:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804688:	48 89 c6             	mov    %rax,%rsi
+  80468b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804690:	48 89 c7             	mov    %rax,%rdi
+  804693:	49 89 df             	mov    %rbx,%r15
+  804696:	48 b8 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rax
+  80469d:	ff ff ff 
+  8046a0:	48 01 d8             	add    %rbx,%rax
+  8046a3:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8046a5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8046a9:	8b 50 0c             	mov    0xc(%rax),%edx
+  8046ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046b0:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8046b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046b6:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8046bd:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  8046c1:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  8046c4:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8046c8:	89 d1                	mov    %edx,%ecx
+  8046ca:	ba 10 00 00 00       	mov    $0x10,%edx
+  8046cf:	48 89 c6             	mov    %rax,%rsi
+  8046d2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8046d7:	48 b8 c6 b1 ff ff ff 	movabs $0xffffffffffffb1c6,%rax
+  8046de:	ff ff ff 
+  8046e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046e5:	ff d0                	call   *%rax
+  8046e7:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  8046ea:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8046ed:	89 c6                	mov    %eax,%esi
+  8046ef:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8046f4:	48 89 c7             	mov    %rax,%rdi
+  8046f7:	49 89 df             	mov    %rbx,%r15
+  8046fa:	48 b8 8b da ff ff ff 	movabs $0xffffffffffffda8b,%rax
+  804701:	ff ff ff 
+  804704:	48 01 d8             	add    %rbx,%rax
+  804707:	ff d0                	call   *%rax
+	return r;
+  804709:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80470c:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804710:	5b                   	pop    %rbx
+  804711:	41 5f                	pop    %r15
+  804713:	5d                   	pop    %rbp
+  804714:	c3                   	ret
+
+0000000000804715 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804715:	55                   	push   %rbp
+  804716:	48 89 e5             	mov    %rsp,%rbp
+  804719:	41 57                	push   %r15
+  80471b:	53                   	push   %rbx
+  80471c:	48 83 ec 20          	sub    $0x20,%rsp
+  804720:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804720 <devfile_stat+0xb>
+  804727:	49 bb 18 49 00 00 00 	movabs $0x4918,%r11
+  80472e:	00 00 00 
+  804731:	4c 01 db             	add    %r11,%rbx
+  804734:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804738:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80473c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804740:	8b 40 0c             	mov    0xc(%rax),%eax
+  804743:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  80474a:	00 00 00 
+  80474d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804750:	be 00 00 00 00       	mov    $0x0,%esi
+  804755:	bf 05 00 00 00       	mov    $0x5,%edi
+  80475a:	48 b8 8a b0 ff ff ff 	movabs $0xffffffffffffb08a,%rax
+  804761:	ff ff ff 
+  804764:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804768:	ff d0                	call   *%rax
+  80476a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80476d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804771:	79 05                	jns    804778 <devfile_stat+0x63>
+		return r;
+  804773:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804776:	eb 65                	jmp    8047dd <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804778:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80477c:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  804783:	00 00 00 
+  804786:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80478a:	48 89 d6             	mov    %rdx,%rsi
+  80478d:	48 89 c7             	mov    %rax,%rdi
+  804790:	49 89 df             	mov    %rbx,%r15
+  804793:	48 b8 a4 8e ff ff ff 	movabs $0xffffffffffff8ea4,%rax
+  80479a:	ff ff ff 
+  80479d:	48 01 d8             	add    %rbx,%rax
+  8047a0:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8047a2:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8047a9:	00 00 00 
+  8047ac:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8047b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047b7:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8047bd:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8047c4:	00 00 00 
+  8047c7:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  8047ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047d2:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  8047d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047dd:	48 83 c4 20          	add    $0x20,%rsp
+  8047e1:	5b                   	pop    %rbx
+  8047e2:	41 5f                	pop    %r15
+  8047e4:	5d                   	pop    %rbp
+  8047e5:	c3                   	ret
+
+00000000008047e6 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8047e6:	55                   	push   %rbp
+  8047e7:	48 89 e5             	mov    %rsp,%rbp
+  8047ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8047ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8047ee <devfile_trunc+0x8>
+  8047f5:	49 bb 4a 48 00 00 00 	movabs $0x484a,%r11
+  8047fc:	00 00 00 
+  8047ff:	4c 01 d8             	add    %r11,%rax
+  804802:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804806:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804809:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80480d:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804810:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804813:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804816:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804819:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80481d:	ba 08 00 00 00       	mov    $0x8,%edx
+  804822:	48 89 ce             	mov    %rcx,%rsi
+  804825:	bf 02 00 00 00       	mov    $0x2,%edi
+  80482a:	48 b9 32 b1 ff ff ff 	movabs $0xffffffffffffb132,%rcx
+  804831:	ff ff ff 
+  804834:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804838:	ff d0                	call   *%rax
+}
+  80483a:	c9                   	leave
+  80483b:	c3                   	ret
+
+000000000080483c <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80483c:	55                   	push   %rbp
+  80483d:	48 89 e5             	mov    %rsp,%rbp
+  804840:	41 57                	push   %r15
+  804842:	53                   	push   %rbx
+  804843:	48 83 ec 10          	sub    $0x10,%rsp
+  804847:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804847 <remove+0xb>
+  80484e:	49 bb f1 47 00 00 00 	movabs $0x47f1,%r11
+  804855:	00 00 00 
+  804858:	4c 01 db             	add    %r11,%rbx
+  80485b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  80485f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804863:	48 89 c7             	mov    %rax,%rdi
+  804866:	49 89 df             	mov    %rbx,%r15
+  804869:	48 b8 10 8e ff ff ff 	movabs $0xffffffffffff8e10,%rax
+  804870:	ff ff ff 
+  804873:	48 01 d8             	add    %rbx,%rax
+  804876:	ff d0                	call   *%rax
+  804878:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80487d:	7e 07                	jle    804886 <remove+0x4a>
+		return -E_BAD_PATH;
+  80487f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804884:	eb 44                	jmp    8048ca <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804886:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80488a:	48 89 c6             	mov    %rax,%rsi
+  80488d:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  804894:	00 00 00 
+  804897:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80489b:	48 89 c7             	mov    %rax,%rdi
+  80489e:	49 89 df             	mov    %rbx,%r15
+  8048a1:	48 b8 a4 8e ff ff ff 	movabs $0xffffffffffff8ea4,%rax
+  8048a8:	ff ff ff 
+  8048ab:	48 01 d8             	add    %rbx,%rax
+  8048ae:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8048b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8048b5:	bf 07 00 00 00       	mov    $0x7,%edi
+  8048ba:	48 b8 8a b0 ff ff ff 	movabs $0xffffffffffffb08a,%rax
+  8048c1:	ff ff ff 
+  8048c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048c8:	ff d0                	call   *%rax
+}
+  8048ca:	48 83 c4 10          	add    $0x10,%rsp
+  8048ce:	5b                   	pop    %rbx
+  8048cf:	41 5f                	pop    %r15
+  8048d1:	5d                   	pop    %rbp
+  8048d2:	c3                   	ret
+
+00000000008048d3 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8048d3:	55                   	push   %rbp
+  8048d4:	48 89 e5             	mov    %rsp,%rbp
+  8048d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8048d7 <sync+0x4>
+  8048de:	49 bb 61 47 00 00 00 	movabs $0x4761,%r11
+  8048e5:	00 00 00 
+  8048e8:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  8048eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8048f5:	bf 08 00 00 00       	mov    $0x8,%edi
+  8048fa:	48 b9 32 b1 ff ff ff 	movabs $0xffffffffffffb132,%rcx
+  804901:	ff ff ff 
+  804904:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804908:	ff d0                	call   *%rax
+}
+  80490a:	5d                   	pop    %rbp
+  80490b:	c3                   	ret
+
+000000000080490c <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80490c:	55                   	push   %rbp
+  80490d:	48 89 e5             	mov    %rsp,%rbp
+  804910:	41 57                	push   %r15
+  804912:	53                   	push   %rbx
+  804913:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80491a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80491a <copy+0xe>
+  804921:	49 bb 1e 47 00 00 00 	movabs $0x471e,%r11
+  804928:	00 00 00 
+  80492b:	4c 01 db             	add    %r11,%rbx
+  80492e:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804935:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  80493c:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804943:	be 00 00 00 00       	mov    $0x0,%esi
+  804948:	48 89 c7             	mov    %rax,%rdi
+  80494b:	48 b8 d1 b2 ff ff ff 	movabs $0xffffffffffffb2d1,%rax
+  804952:	ff ff ff 
+  804955:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804959:	ff d0                	call   *%rax
+  80495b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  80495e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804962:	79 35                	jns    804999 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  804964:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804967:	89 c6                	mov    %eax,%esi
+  804969:	48 b8 7e e2 ff ff ff 	movabs $0xffffffffffffe27e,%rax
+  804970:	ff ff ff 
+  804973:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804977:	48 89 c7             	mov    %rax,%rdi
+  80497a:	49 89 df             	mov    %rbx,%r15
+  80497d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804982:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  804989:	ff ff ff 
+  80498c:	48 01 da             	add    %rbx,%rdx
+  80498f:	ff d2                	call   *%rdx
+		return fd_src;
+  804991:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804994:	e9 d7 01 00 00       	jmp    804b70 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804999:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8049a0:	be 01 01 00 00       	mov    $0x101,%esi
+  8049a5:	48 89 c7             	mov    %rax,%rdi
+  8049a8:	48 b8 d1 b2 ff ff ff 	movabs $0xffffffffffffb2d1,%rax
+  8049af:	ff ff ff 
+  8049b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049b6:	ff d0                	call   *%rax
+  8049b8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  8049bb:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8049bf:	0f 89 df 00 00 00    	jns    804aa4 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  8049c5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8049c8:	89 c6                	mov    %eax,%esi
+  8049ca:	48 b8 94 e2 ff ff ff 	movabs $0xffffffffffffe294,%rax
+  8049d1:	ff ff ff 
+  8049d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049d8:	48 89 c7             	mov    %rax,%rdi
+  8049db:	49 89 df             	mov    %rbx,%r15
+  8049de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049e3:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  8049ea:	ff ff ff 
+  8049ed:	48 01 da             	add    %rbx,%rdx
+  8049f0:	ff d2                	call   *%rdx
+		close(fd_src);
+  8049f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049f5:	89 c7                	mov    %eax,%edi
+  8049f7:	49 89 df             	mov    %rbx,%r15
+  8049fa:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  804a01:	ff ff ff 
+  804a04:	48 01 d8             	add    %rbx,%rax
+  804a07:	ff d0                	call   *%rax
+		return fd_dest;
+  804a09:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a0c:	e9 5f 01 00 00       	jmp    804b70 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804a11:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a14:	48 63 d0             	movslq %eax,%rdx
+  804a17:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804a1e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a21:	48 89 ce             	mov    %rcx,%rsi
+  804a24:	89 c7                	mov    %eax,%edi
+  804a26:	49 89 df             	mov    %rbx,%r15
+  804a29:	48 b8 a8 ac ff ff ff 	movabs $0xffffffffffffaca8,%rax
+  804a30:	ff ff ff 
+  804a33:	48 01 d8             	add    %rbx,%rax
+  804a36:	ff d0                	call   *%rax
+  804a38:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804a3b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804a3f:	79 63                	jns    804aa4 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804a41:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804a44:	89 c6                	mov    %eax,%esi
+  804a46:	48 b8 ae e2 ff ff ff 	movabs $0xffffffffffffe2ae,%rax
+  804a4d:	ff ff ff 
+  804a50:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a54:	48 89 c7             	mov    %rax,%rdi
+  804a57:	49 89 df             	mov    %rbx,%r15
+  804a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a5f:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  804a66:	ff ff ff 
+  804a69:	48 01 da             	add    %rbx,%rdx
+  804a6c:	ff d2                	call   *%rdx
+			close(fd_src);
+  804a6e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a71:	89 c7                	mov    %eax,%edi
+  804a73:	49 89 df             	mov    %rbx,%r15
+  804a76:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  804a7d:	ff ff ff 
+  804a80:	48 01 d8             	add    %rbx,%rax
+  804a83:	ff d0                	call   *%rax
+			close(fd_dest);
+  804a85:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a88:	89 c7                	mov    %eax,%edi
+  804a8a:	49 89 df             	mov    %rbx,%r15
+  804a8d:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  804a94:	ff ff ff 
+  804a97:	48 01 d8             	add    %rbx,%rax
+  804a9a:	ff d0                	call   *%rax
+			return write_size;
+  804a9c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804a9f:	e9 cc 00 00 00       	jmp    804b70 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804aa4:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804aab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aae:	ba 00 02 00 00       	mov    $0x200,%edx
+  804ab3:	48 89 ce             	mov    %rcx,%rsi
+  804ab6:	89 c7                	mov    %eax,%edi
+  804ab8:	49 89 df             	mov    %rbx,%r15
+  804abb:	48 b8 02 ab ff ff ff 	movabs $0xffffffffffffab02,%rax
+  804ac2:	ff ff ff 
+  804ac5:	48 01 d8             	add    %rbx,%rax
+  804ac8:	ff d0                	call   *%rax
+  804aca:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804acd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804ad1:	0f 8f 3a ff ff ff    	jg     804a11 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804ad7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804adb:	79 60                	jns    804b3d <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804add:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ae0:	89 c6                	mov    %eax,%esi
+  804ae2:	48 b8 c1 e2 ff ff ff 	movabs $0xffffffffffffe2c1,%rax
+  804ae9:	ff ff ff 
+  804aec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804af0:	48 89 c7             	mov    %rax,%rdi
+  804af3:	49 89 df             	mov    %rbx,%r15
+  804af6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804afb:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  804b02:	ff ff ff 
+  804b05:	48 01 da             	add    %rbx,%rdx
+  804b08:	ff d2                	call   *%rdx
+		close(fd_src);
+  804b0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b0d:	89 c7                	mov    %eax,%edi
+  804b0f:	49 89 df             	mov    %rbx,%r15
+  804b12:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  804b19:	ff ff ff 
+  804b1c:	48 01 d8             	add    %rbx,%rax
+  804b1f:	ff d0                	call   *%rax
+		close(fd_dest);
+  804b21:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b24:	89 c7                	mov    %eax,%edi
+  804b26:	49 89 df             	mov    %rbx,%r15
+  804b29:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  804b30:	ff ff ff 
+  804b33:	48 01 d8             	add    %rbx,%rax
+  804b36:	ff d0                	call   *%rax
+		return read_size;
+  804b38:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b3b:	eb 33                	jmp    804b70 <copy+0x264>
+	}
+	close(fd_src);
+  804b3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b40:	89 c7                	mov    %eax,%edi
+  804b42:	49 89 df             	mov    %rbx,%r15
+  804b45:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  804b4c:	ff ff ff 
+  804b4f:	48 01 d8             	add    %rbx,%rax
+  804b52:	ff d0                	call   *%rax
+	close(fd_dest);
+  804b54:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b57:	89 c7                	mov    %eax,%edi
+  804b59:	49 89 df             	mov    %rbx,%r15
+  804b5c:	48 b8 4a a8 ff ff ff 	movabs $0xffffffffffffa84a,%rax
+  804b63:	ff ff ff 
+  804b66:	48 01 d8             	add    %rbx,%rax
+  804b69:	ff d0                	call   *%rax
+	return 0;
+  804b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804b70:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804b77:	5b                   	pop    %rbx
+  804b78:	41 5f                	pop    %r15
+  804b7a:	5d                   	pop    %rbp
+  804b7b:	c3                   	ret
+
+0000000000804b7c <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804b7c:	55                   	push   %rbp
+  804b7d:	48 89 e5             	mov    %rsp,%rbp
+  804b80:	41 57                	push   %r15
+  804b82:	53                   	push   %rbx
+  804b83:	48 83 ec 20          	sub    $0x20,%rsp
+  804b87:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b87 <fd2sockid+0xb>
+  804b8e:	49 bb b1 44 00 00 00 	movabs $0x44b1,%r11
+  804b95:	00 00 00 
+  804b98:	4c 01 db             	add    %r11,%rbx
+  804b9b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804b9e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804ba2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ba5:	48 89 d6             	mov    %rdx,%rsi
+  804ba8:	89 c7                	mov    %eax,%edi
+  804baa:	49 89 df             	mov    %rbx,%r15
+  804bad:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  804bb4:	ff ff ff 
+  804bb7:	48 01 d8             	add    %rbx,%rax
+  804bba:	ff d0                	call   *%rax
+  804bbc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bbf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804bc3:	79 05                	jns    804bca <fd2sockid+0x4e>
+		return r;
+  804bc5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bc8:	eb 25                	jmp    804bef <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804bca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bce:	8b 10                	mov    (%rax),%edx
+  804bd0:	48 b8 88 00 00 00 00 	movabs $0x88,%rax
+  804bd7:	00 00 00 
+  804bda:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804bdd:	39 c2                	cmp    %eax,%edx
+  804bdf:	74 07                	je     804be8 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804be1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804be6:	eb 07                	jmp    804bef <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804be8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bec:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804bef:	48 83 c4 20          	add    $0x20,%rsp
+  804bf3:	5b                   	pop    %rbx
+  804bf4:	41 5f                	pop    %r15
+  804bf6:	5d                   	pop    %rbp
+  804bf7:	c3                   	ret
+
+0000000000804bf8 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804bf8:	55                   	push   %rbp
+  804bf9:	48 89 e5             	mov    %rsp,%rbp
+  804bfc:	41 57                	push   %r15
+  804bfe:	53                   	push   %rbx
+  804bff:	48 83 ec 20          	sub    $0x20,%rsp
+  804c03:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c03 <alloc_sockfd+0xb>
+  804c0a:	49 bb 35 44 00 00 00 	movabs $0x4435,%r11
+  804c11:	00 00 00 
+  804c14:	4c 01 db             	add    %r11,%rbx
+  804c17:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804c1a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804c1e:	48 89 c7             	mov    %rax,%rdi
+  804c21:	49 89 df             	mov    %rbx,%r15
+  804c24:	48 b8 05 a5 ff ff ff 	movabs $0xffffffffffffa505,%rax
+  804c2b:	ff ff ff 
+  804c2e:	48 01 d8             	add    %rbx,%rax
+  804c31:	ff d0                	call   *%rax
+  804c33:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c36:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c3a:	78 2c                	js     804c68 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804c3c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c40:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c45:	48 89 c6             	mov    %rax,%rsi
+  804c48:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c4d:	49 89 df             	mov    %rbx,%r15
+  804c50:	48 b8 60 9b ff ff ff 	movabs $0xffffffffffff9b60,%rax
+  804c57:	ff ff ff 
+  804c5a:	48 01 d8             	add    %rbx,%rax
+  804c5d:	ff d0                	call   *%rax
+  804c5f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c62:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c66:	79 1c                	jns    804c84 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804c68:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c6b:	89 c7                	mov    %eax,%edi
+  804c6d:	49 89 df             	mov    %rbx,%r15
+  804c70:	48 b8 b4 c3 ff ff ff 	movabs $0xffffffffffffc3b4,%rax
+  804c77:	ff ff ff 
+  804c7a:	48 01 d8             	add    %rbx,%rax
+  804c7d:	ff d0                	call   *%rax
+		return r;
+  804c7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c82:	eb 41                	jmp    804cc5 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804c84:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c88:	48 ba 88 00 00 00 00 	movabs $0x88,%rdx
+  804c8f:	00 00 00 
+  804c92:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804c95:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804c97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c9b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804ca2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ca6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804ca9:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804cac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cb0:	48 89 c7             	mov    %rax,%rdi
+  804cb3:	49 89 df             	mov    %rbx,%r15
+  804cb6:	48 b8 8b a4 ff ff ff 	movabs $0xffffffffffffa48b,%rax
+  804cbd:	ff ff ff 
+  804cc0:	48 01 d8             	add    %rbx,%rax
+  804cc3:	ff d0                	call   *%rax
+}
+  804cc5:	48 83 c4 20          	add    $0x20,%rsp
+  804cc9:	5b                   	pop    %rbx
+  804cca:	41 5f                	pop    %r15
+  804ccc:	5d                   	pop    %rbp
+  804ccd:	c3                   	ret
+
+0000000000804cce <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804cce:	55                   	push   %rbp
+  804ccf:	48 89 e5             	mov    %rsp,%rbp
+  804cd2:	41 57                	push   %r15
+  804cd4:	53                   	push   %rbx
+  804cd5:	48 83 ec 30          	sub    $0x30,%rsp
+  804cd9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cd9 <accept+0xb>
+  804ce0:	49 bb 5f 43 00 00 00 	movabs $0x435f,%r11
+  804ce7:	00 00 00 
+  804cea:	4c 01 db             	add    %r11,%rbx
+  804ced:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804cf0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804cf4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804cf8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804cfb:	89 c7                	mov    %eax,%edi
+  804cfd:	48 b8 44 bb ff ff ff 	movabs $0xffffffffffffbb44,%rax
+  804d04:	ff ff ff 
+  804d07:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d0b:	ff d0                	call   *%rax
+  804d0d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d10:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d14:	79 05                	jns    804d1b <accept+0x4d>
+		return r;
+  804d16:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d19:	eb 45                	jmp    804d60 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804d1b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d1f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804d23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d26:	48 89 ce             	mov    %rcx,%rsi
+  804d29:	89 c7                	mov    %eax,%edi
+  804d2b:	49 89 df             	mov    %rbx,%r15
+  804d2e:	48 b8 22 c2 ff ff ff 	movabs $0xffffffffffffc222,%rax
+  804d35:	ff ff ff 
+  804d38:	48 01 d8             	add    %rbx,%rax
+  804d3b:	ff d0                	call   *%rax
+  804d3d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d40:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d44:	79 05                	jns    804d4b <accept+0x7d>
+		return r;
+  804d46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d49:	eb 15                	jmp    804d60 <accept+0x92>
+	return alloc_sockfd(r);
+  804d4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d4e:	89 c7                	mov    %eax,%edi
+  804d50:	48 b8 c0 bb ff ff ff 	movabs $0xffffffffffffbbc0,%rax
+  804d57:	ff ff ff 
+  804d5a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d5e:	ff d0                	call   *%rax
+}
+  804d60:	48 83 c4 30          	add    $0x30,%rsp
+  804d64:	5b                   	pop    %rbx
+  804d65:	41 5f                	pop    %r15
+  804d67:	5d                   	pop    %rbp
+  804d68:	c3                   	ret
+
+0000000000804d69 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804d69:	55                   	push   %rbp
+  804d6a:	48 89 e5             	mov    %rsp,%rbp
+  804d6d:	41 57                	push   %r15
+  804d6f:	53                   	push   %rbx
+  804d70:	48 83 ec 20          	sub    $0x20,%rsp
+  804d74:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d74 <bind+0xb>
+  804d7b:	49 bb c4 42 00 00 00 	movabs $0x42c4,%r11
+  804d82:	00 00 00 
+  804d85:	4c 01 db             	add    %r11,%rbx
+  804d88:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804d8b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804d8f:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804d92:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804d95:	89 c7                	mov    %eax,%edi
+  804d97:	48 b8 44 bb ff ff ff 	movabs $0xffffffffffffbb44,%rax
+  804d9e:	ff ff ff 
+  804da1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804da5:	ff d0                	call   *%rax
+  804da7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804daa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804dae:	79 05                	jns    804db5 <bind+0x4c>
+		return r;
+  804db0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804db3:	eb 21                	jmp    804dd6 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804db5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804db8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804dbc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dbf:	48 89 ce             	mov    %rcx,%rsi
+  804dc2:	89 c7                	mov    %eax,%edi
+  804dc4:	49 89 df             	mov    %rbx,%r15
+  804dc7:	48 b8 ce c2 ff ff ff 	movabs $0xffffffffffffc2ce,%rax
+  804dce:	ff ff ff 
+  804dd1:	48 01 d8             	add    %rbx,%rax
+  804dd4:	ff d0                	call   *%rax
+}
+  804dd6:	48 83 c4 20          	add    $0x20,%rsp
+  804dda:	5b                   	pop    %rbx
+  804ddb:	41 5f                	pop    %r15
+  804ddd:	5d                   	pop    %rbp
+  804dde:	c3                   	ret
+
+0000000000804ddf <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804ddf:	55                   	push   %rbp
+  804de0:	48 89 e5             	mov    %rsp,%rbp
+  804de3:	41 57                	push   %r15
+  804de5:	53                   	push   %rbx
+  804de6:	48 83 ec 20          	sub    $0x20,%rsp
+  804dea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804dea <shutdown+0xb>
+  804df1:	49 bb 4e 42 00 00 00 	movabs $0x424e,%r11
+  804df8:	00 00 00 
+  804dfb:	4c 01 db             	add    %r11,%rbx
+  804dfe:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e01:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804e04:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e07:	89 c7                	mov    %eax,%edi
+  804e09:	48 b8 44 bb ff ff ff 	movabs $0xffffffffffffbb44,%rax
+  804e10:	ff ff ff 
+  804e13:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e17:	ff d0                	call   *%rax
+  804e19:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e1c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e20:	79 05                	jns    804e27 <shutdown+0x48>
+		return r;
+  804e22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e25:	eb 1c                	jmp    804e43 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804e27:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804e2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e2d:	89 d6                	mov    %edx,%esi
+  804e2f:	89 c7                	mov    %eax,%edi
+  804e31:	49 89 df             	mov    %rbx,%r15
+  804e34:	48 b8 63 c3 ff ff ff 	movabs $0xffffffffffffc363,%rax
+  804e3b:	ff ff ff 
+  804e3e:	48 01 d8             	add    %rbx,%rax
+  804e41:	ff d0                	call   *%rax
+}
+  804e43:	48 83 c4 20          	add    $0x20,%rsp
+  804e47:	5b                   	pop    %rbx
+  804e48:	41 5f                	pop    %r15
+  804e4a:	5d                   	pop    %rbp
+  804e4b:	c3                   	ret
+
+0000000000804e4c <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804e4c:	55                   	push   %rbp
+  804e4d:	48 89 e5             	mov    %rsp,%rbp
+  804e50:	41 57                	push   %r15
+  804e52:	53                   	push   %rbx
+  804e53:	48 83 ec 10          	sub    $0x10,%rsp
+  804e57:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e57 <devsock_close+0xb>
+  804e5e:	49 bb e1 41 00 00 00 	movabs $0x41e1,%r11
+  804e65:	00 00 00 
+  804e68:	4c 01 db             	add    %r11,%rbx
+  804e6b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804e6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e73:	48 89 c7             	mov    %rax,%rdi
+  804e76:	49 89 df             	mov    %rbx,%r15
+  804e79:	48 b8 60 db ff ff ff 	movabs $0xffffffffffffdb60,%rax
+  804e80:	ff ff ff 
+  804e83:	48 01 d8             	add    %rbx,%rax
+  804e86:	ff d0                	call   *%rax
+  804e88:	83 f8 01             	cmp    $0x1,%eax
+  804e8b:	75 1d                	jne    804eaa <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804e8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e91:	8b 40 0c             	mov    0xc(%rax),%eax
+  804e94:	89 c7                	mov    %eax,%edi
+  804e96:	49 89 df             	mov    %rbx,%r15
+  804e99:	48 b8 b4 c3 ff ff ff 	movabs $0xffffffffffffc3b4,%rax
+  804ea0:	ff ff ff 
+  804ea3:	48 01 d8             	add    %rbx,%rax
+  804ea6:	ff d0                	call   *%rax
+  804ea8:	eb 05                	jmp    804eaf <devsock_close+0x63>
+	else
+		return 0;
+  804eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804eaf:	48 83 c4 10          	add    $0x10,%rsp
+  804eb3:	5b                   	pop    %rbx
+  804eb4:	41 5f                	pop    %r15
+  804eb6:	5d                   	pop    %rbp
+  804eb7:	c3                   	ret
+
+0000000000804eb8 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804eb8:	55                   	push   %rbp
+  804eb9:	48 89 e5             	mov    %rsp,%rbp
+  804ebc:	41 57                	push   %r15
+  804ebe:	53                   	push   %rbx
+  804ebf:	48 83 ec 20          	sub    $0x20,%rsp
+  804ec3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ec3 <connect+0xb>
+  804eca:	49 bb 75 41 00 00 00 	movabs $0x4175,%r11
+  804ed1:	00 00 00 
+  804ed4:	4c 01 db             	add    %r11,%rbx
+  804ed7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804eda:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804ede:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804ee1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ee4:	89 c7                	mov    %eax,%edi
+  804ee6:	48 b8 44 bb ff ff ff 	movabs $0xffffffffffffbb44,%rax
+  804eed:	ff ff ff 
+  804ef0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ef4:	ff d0                	call   *%rax
+  804ef6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ef9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804efd:	79 05                	jns    804f04 <connect+0x4c>
+		return r;
+  804eff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f02:	eb 21                	jmp    804f25 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804f04:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804f07:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804f0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f0e:	48 89 ce             	mov    %rcx,%rsi
+  804f11:	89 c7                	mov    %eax,%edi
+  804f13:	49 89 df             	mov    %rbx,%r15
+  804f16:	48 b8 fc c3 ff ff ff 	movabs $0xffffffffffffc3fc,%rax
+  804f1d:	ff ff ff 
+  804f20:	48 01 d8             	add    %rbx,%rax
+  804f23:	ff d0                	call   *%rax
+}
+  804f25:	48 83 c4 20          	add    $0x20,%rsp
+  804f29:	5b                   	pop    %rbx
+  804f2a:	41 5f                	pop    %r15
+  804f2c:	5d                   	pop    %rbp
+  804f2d:	c3                   	ret
+
+0000000000804f2e <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804f2e:	55                   	push   %rbp
+  804f2f:	48 89 e5             	mov    %rsp,%rbp
+  804f32:	41 57                	push   %r15
+  804f34:	53                   	push   %rbx
+  804f35:	48 83 ec 20          	sub    $0x20,%rsp
+  804f39:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f39 <listen+0xb>
+  804f40:	49 bb ff 40 00 00 00 	movabs $0x40ff,%r11
+  804f47:	00 00 00 
+  804f4a:	4c 01 db             	add    %r11,%rbx
+  804f4d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f50:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804f53:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f56:	89 c7                	mov    %eax,%edi
+  804f58:	48 b8 44 bb ff ff ff 	movabs $0xffffffffffffbb44,%rax
+  804f5f:	ff ff ff 
+  804f62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f66:	ff d0                	call   *%rax
+  804f68:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f6f:	79 05                	jns    804f76 <listen+0x48>
+		return r;
+  804f71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f74:	eb 1c                	jmp    804f92 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804f76:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804f79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f7c:	89 d6                	mov    %edx,%esi
+  804f7e:	89 c7                	mov    %eax,%edi
+  804f80:	49 89 df             	mov    %rbx,%r15
+  804f83:	48 b8 91 c4 ff ff ff 	movabs $0xffffffffffffc491,%rax
+  804f8a:	ff ff ff 
+  804f8d:	48 01 d8             	add    %rbx,%rax
+  804f90:	ff d0                	call   *%rax
+}
+  804f92:	48 83 c4 20          	add    $0x20,%rsp
+  804f96:	5b                   	pop    %rbx
+  804f97:	41 5f                	pop    %r15
+  804f99:	5d                   	pop    %rbp
+  804f9a:	c3                   	ret
+
+0000000000804f9b <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804f9b:	55                   	push   %rbp
+  804f9c:	48 89 e5             	mov    %rsp,%rbp
+  804f9f:	41 57                	push   %r15
+  804fa1:	48 83 ec 28          	sub    $0x28,%rsp
+  804fa5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804fa5 <devsock_read+0xa>
+  804fac:	49 bb 93 40 00 00 00 	movabs $0x4093,%r11
+  804fb3:	00 00 00 
+  804fb6:	4c 01 d8             	add    %r11,%rax
+  804fb9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804fbd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804fc1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804fc5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804fc9:	41 89 d0             	mov    %edx,%r8d
+  804fcc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804fd0:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804fd3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804fd7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804fdc:	44 89 c2             	mov    %r8d,%edx
+  804fdf:	49 89 c7             	mov    %rax,%r15
+  804fe2:	49 b8 e2 c4 ff ff ff 	movabs $0xffffffffffffc4e2,%r8
+  804fe9:	ff ff ff 
+  804fec:	49 01 c0             	add    %rax,%r8
+  804fef:	41 ff d0             	call   *%r8
+}
+  804ff2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804ff6:	c9                   	leave
+  804ff7:	c3                   	ret
+
+0000000000804ff8 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804ff8:	55                   	push   %rbp
+  804ff9:	48 89 e5             	mov    %rsp,%rbp
+  804ffc:	41 57                	push   %r15
+  804ffe:	48 83 ec 28          	sub    $0x28,%rsp
+  805002:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805002 <devsock_write+0xa>
+  805009:	49 bb 36 40 00 00 00 	movabs $0x4036,%r11
+  805010:	00 00 00 
+  805013:	4c 01 d8             	add    %r11,%rax
+  805016:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80501a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80501e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805022:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805026:	41 89 d0             	mov    %edx,%r8d
+  805029:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80502d:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805030:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805034:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805039:	44 89 c2             	mov    %r8d,%edx
+  80503c:	49 89 c7             	mov    %rax,%r15
+  80503f:	49 b8 ff c5 ff ff ff 	movabs $0xffffffffffffc5ff,%r8
+  805046:	ff ff ff 
+  805049:	49 01 c0             	add    %rax,%r8
+  80504c:	41 ff d0             	call   *%r8
+}
+  80504f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805053:	c9                   	leave
+  805054:	c3                   	ret
+
+0000000000805055 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805055:	55                   	push   %rbp
+  805056:	48 89 e5             	mov    %rsp,%rbp
+  805059:	41 57                	push   %r15
+  80505b:	48 83 ec 18          	sub    $0x18,%rsp
+  80505f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80505f <devsock_stat+0xa>
+  805066:	49 bb d9 3f 00 00 00 	movabs $0x3fd9,%r11
+  80506d:	00 00 00 
+  805070:	4c 01 d8             	add    %r11,%rax
+  805073:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805077:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  80507b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80507f:	48 b9 dc e2 ff ff ff 	movabs $0xffffffffffffe2dc,%rcx
+  805086:	ff ff ff 
+  805089:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80508d:	48 89 ce             	mov    %rcx,%rsi
+  805090:	48 89 d7             	mov    %rdx,%rdi
+  805093:	49 89 c7             	mov    %rax,%r15
+  805096:	48 ba a4 8e ff ff ff 	movabs $0xffffffffffff8ea4,%rdx
+  80509d:	ff ff ff 
+  8050a0:	48 01 c2             	add    %rax,%rdx
+  8050a3:	ff d2                	call   *%rdx
+	return 0;
+  8050a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050aa:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8050ae:	c9                   	leave
+  8050af:	c3                   	ret
+
+00000000008050b0 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8050b0:	55                   	push   %rbp
+  8050b1:	48 89 e5             	mov    %rsp,%rbp
+  8050b4:	41 57                	push   %r15
+  8050b6:	53                   	push   %rbx
+  8050b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8050bb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050bb <socket+0xb>
+  8050c2:	49 bb 7d 3f 00 00 00 	movabs $0x3f7d,%r11
+  8050c9:	00 00 00 
+  8050cc:	4c 01 db             	add    %r11,%rbx
+  8050cf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8050d2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8050d5:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8050d8:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8050db:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8050de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8050e1:	89 ce                	mov    %ecx,%esi
+  8050e3:	89 c7                	mov    %eax,%edi
+  8050e5:	49 89 df             	mov    %rbx,%r15
+  8050e8:	48 b8 d6 c7 ff ff ff 	movabs $0xffffffffffffc7d6,%rax
+  8050ef:	ff ff ff 
+  8050f2:	48 01 d8             	add    %rbx,%rax
+  8050f5:	ff d0                	call   *%rax
+  8050f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050fe:	79 05                	jns    805105 <socket+0x55>
+		return r;
+  805100:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805103:	eb 15                	jmp    80511a <socket+0x6a>
+	return alloc_sockfd(r);
+  805105:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805108:	89 c7                	mov    %eax,%edi
+  80510a:	48 b8 c0 bb ff ff ff 	movabs $0xffffffffffffbbc0,%rax
+  805111:	ff ff ff 
+  805114:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805118:	ff d0                	call   *%rax
+}
+  80511a:	48 83 c4 20          	add    $0x20,%rsp
+  80511e:	5b                   	pop    %rbx
+  80511f:	41 5f                	pop    %r15
+  805121:	5d                   	pop    %rbp
+  805122:	c3                   	ret
+
+0000000000805123 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805123:	55                   	push   %rbp
+  805124:	48 89 e5             	mov    %rsp,%rbp
+  805127:	41 57                	push   %r15
+  805129:	53                   	push   %rbx
+  80512a:	48 83 ec 10          	sub    $0x10,%rsp
+  80512e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80512e <nsipc+0xb>
+  805135:	49 bb 0a 3f 00 00 00 	movabs $0x3f0a,%r11
+  80513c:	00 00 00 
+  80513f:	4c 01 db             	add    %r11,%rbx
+  805142:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805145:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  80514c:	00 00 00 
+  80514f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805152:	85 c0                	test   %eax,%eax
+  805154:	75 24                	jne    80517a <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805156:	bf 02 00 00 00       	mov    $0x2,%edi
+  80515b:	49 89 df             	mov    %rbx,%r15
+  80515e:	48 b8 d1 da ff ff ff 	movabs $0xffffffffffffdad1,%rax
+  805165:	ff ff ff 
+  805168:	48 01 d8             	add    %rbx,%rax
+  80516b:	ff d0                	call   *%rax
+  80516d:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  805174:	00 00 00 
+  805177:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  80517a:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  805181:	00 00 00 
+  805184:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805187:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80518a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805190:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805196:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80519b:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8051a2:	00 00 00 
+  8051a5:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8051a9:	89 c7                	mov    %eax,%edi
+  8051ab:	49 89 df             	mov    %rbx,%r15
+  8051ae:	48 b8 f0 d4 ff ff ff 	movabs $0xffffffffffffd4f0,%rax
+  8051b5:	ff ff ff 
+  8051b8:	48 01 d8             	add    %rbx,%rax
+  8051bb:	ff d0                	call   *%rax
+}
+  8051bd:	48 83 c4 10          	add    $0x10,%rsp
+  8051c1:	5b                   	pop    %rbx
+  8051c2:	41 5f                	pop    %r15
+  8051c4:	5d                   	pop    %rbp
+  8051c5:	c3                   	ret
+
+00000000008051c6 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8051c6:	55                   	push   %rbp
+  8051c7:	48 89 e5             	mov    %rsp,%rbp
+  8051ca:	41 57                	push   %r15
+  8051cc:	53                   	push   %rbx
+  8051cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8051d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051d1 <nsipc_words+0xb>
+  8051d8:	49 bb 67 3e 00 00 00 	movabs $0x3e67,%r11
+  8051df:	00 00 00 
+  8051e2:	4c 01 db             	add    %r11,%rbx
+  8051e5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8051e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8051ec:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8051f0:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8051f7:	00 00 00 
+  8051fa:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8051fd:	85 c0                	test   %eax,%eax
+  8051ff:	75 24                	jne    805225 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805201:	bf 02 00 00 00       	mov    $0x2,%edi
+  805206:	49 89 df             	mov    %rbx,%r15
+  805209:	48 b8 d1 da ff ff ff 	movabs $0xffffffffffffdad1,%rax
+  805210:	ff ff ff 
+  805213:	48 01 d8             	add    %rbx,%rax
+  805216:	ff d0                	call   *%rax
+  805218:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  80521f:	00 00 00 
+  805222:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805225:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  80522c:	00 00 00 
+  80522f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805232:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805236:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80523a:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80523d:	89 c7                	mov    %eax,%edi
+  80523f:	49 89 df             	mov    %rbx,%r15
+  805242:	48 b8 db d5 ff ff ff 	movabs $0xffffffffffffd5db,%rax
+  805249:	ff ff ff 
+  80524c:	48 01 d8             	add    %rbx,%rax
+  80524f:	ff d0                	call   *%rax
+}
+  805251:	48 83 c4 20          	add    $0x20,%rsp
+  805255:	5b                   	pop    %rbx
+  805256:	41 5f                	pop    %r15
+  805258:	5d                   	pop    %rbp
+  805259:	c3                   	ret
+
+000000000080525a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80525a:	55                   	push   %rbp
+  80525b:	48 89 e5             	mov    %rsp,%rbp
+  80525e:	41 57                	push   %r15
+  805260:	53                   	push   %rbx
+  805261:	48 83 ec 30          	sub    $0x30,%rsp
+  805265:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805265 <nsipc_accept+0xb>
+  80526c:	49 bb d3 3d 00 00 00 	movabs $0x3dd3,%r11
+  805273:	00 00 00 
+  805276:	4c 01 db             	add    %r11,%rbx
+  805279:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80527c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805280:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805284:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80528b:	00 00 00 
+  80528e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805291:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805294:	bf 01 00 00 00       	mov    $0x1,%edi
+  805299:	48 b8 eb c0 ff ff ff 	movabs $0xffffffffffffc0eb,%rax
+  8052a0:	ff ff ff 
+  8052a3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052a7:	ff d0                	call   *%rax
+  8052a9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052ac:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052b0:	78 48                	js     8052fa <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8052b2:	48 b8 c8 3f 01 00 00 	movabs $0x13fc8,%rax
+  8052b9:	00 00 00 
+  8052bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052c0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8052c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052c8:	8b 40 10             	mov    0x10(%rax),%eax
+  8052cb:	89 c2                	mov    %eax,%edx
+  8052cd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8052d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052d5:	48 89 ce             	mov    %rcx,%rsi
+  8052d8:	48 89 c7             	mov    %rax,%rdi
+  8052db:	49 89 df             	mov    %rbx,%r15
+  8052de:	48 b8 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rax
+  8052e5:	ff ff ff 
+  8052e8:	48 01 d8             	add    %rbx,%rax
+  8052eb:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8052ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052f1:	8b 50 10             	mov    0x10(%rax),%edx
+  8052f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052f8:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8052fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8052fd:	48 83 c4 30          	add    $0x30,%rsp
+  805301:	5b                   	pop    %rbx
+  805302:	41 5f                	pop    %r15
+  805304:	5d                   	pop    %rbp
+  805305:	c3                   	ret
+
+0000000000805306 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805306:	55                   	push   %rbp
+  805307:	48 89 e5             	mov    %rsp,%rbp
+  80530a:	41 57                	push   %r15
+  80530c:	53                   	push   %rbx
+  80530d:	48 83 ec 10          	sub    $0x10,%rsp
+  805311:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805311 <nsipc_bind+0xb>
+  805318:	49 bb 27 3d 00 00 00 	movabs $0x3d27,%r11
+  80531f:	00 00 00 
+  805322:	4c 01 db             	add    %r11,%rbx
+  805325:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805328:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80532c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  80532f:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805336:	00 00 00 
+  805339:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80533c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80533f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805342:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805346:	48 89 c6             	mov    %rax,%rsi
+  805349:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  805350:	00 00 00 
+  805353:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805357:	48 89 c7             	mov    %rax,%rdi
+  80535a:	49 89 df             	mov    %rbx,%r15
+  80535d:	48 b8 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rax
+  805364:	ff ff ff 
+  805367:	48 01 d8             	add    %rbx,%rax
+  80536a:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  80536c:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805373:	00 00 00 
+  805376:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805379:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  80537d:	bf 02 00 00 00       	mov    $0x2,%edi
+  805382:	48 b8 eb c0 ff ff ff 	movabs $0xffffffffffffc0eb,%rax
+  805389:	ff ff ff 
+  80538c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805390:	ff d0                	call   *%rax
+}
+  805392:	48 83 c4 10          	add    $0x10,%rsp
+  805396:	5b                   	pop    %rbx
+  805397:	41 5f                	pop    %r15
+  805399:	5d                   	pop    %rbp
+  80539a:	c3                   	ret
+
+000000000080539b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80539b:	55                   	push   %rbp
+  80539c:	48 89 e5             	mov    %rsp,%rbp
+  80539f:	48 83 ec 20          	sub    $0x20,%rsp
+  8053a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8053a3 <nsipc_shutdown+0x8>
+  8053aa:	49 bb 95 3c 00 00 00 	movabs $0x3c95,%r11
+  8053b1:	00 00 00 
+  8053b4:	4c 01 d8             	add    %r11,%rax
+  8053b7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8053ba:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8053bd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8053c0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8053c3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8053c6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8053c9:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8053cd:	ba 08 00 00 00       	mov    $0x8,%edx
+  8053d2:	48 89 ce             	mov    %rcx,%rsi
+  8053d5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8053da:	48 b9 8e c1 ff ff ff 	movabs $0xffffffffffffc18e,%rcx
+  8053e1:	ff ff ff 
+  8053e4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8053e8:	ff d0                	call   *%rax
+}
+  8053ea:	c9                   	leave
+  8053eb:	c3                   	ret
+
+00000000008053ec <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8053ec:	55                   	push   %rbp
+  8053ed:	48 89 e5             	mov    %rsp,%rbp
+  8053f0:	48 83 ec 20          	sub    $0x20,%rsp
+  8053f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8053f4 <nsipc_close+0x8>
+  8053fb:	49 bb 44 3c 00 00 00 	movabs $0x3c44,%r11
+  805402:	00 00 00 
+  805405:	4c 01 d8             	add    %r11,%rax
+  805408:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80540b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80540e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805411:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805415:	ba 04 00 00 00       	mov    $0x4,%edx
+  80541a:	48 89 ce             	mov    %rcx,%rsi
+  80541d:	bf 04 00 00 00       	mov    $0x4,%edi
+  805422:	48 b9 8e c1 ff ff ff 	movabs $0xffffffffffffc18e,%rcx
+  805429:	ff ff ff 
+  80542c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805430:	ff d0                	call   *%rax
+}
+  805432:	c9                   	leave
+  805433:	c3                   	ret
+
+0000000000805434 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805434:	55                   	push   %rbp
+  805435:	48 89 e5             	mov    %rsp,%rbp
+  805438:	41 57                	push   %r15
+  80543a:	53                   	push   %rbx
+  80543b:	48 83 ec 10          	sub    $0x10,%rsp
+  80543f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80543f <nsipc_connect+0xb>
+  805446:	49 bb f9 3b 00 00 00 	movabs $0x3bf9,%r11
+  80544d:	00 00 00 
+  805450:	4c 01 db             	add    %r11,%rbx
+  805453:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805456:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80545a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  80545d:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805464:	00 00 00 
+  805467:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80546a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80546d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805470:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805474:	48 89 c6             	mov    %rax,%rsi
+  805477:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  80547e:	00 00 00 
+  805481:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805485:	48 89 c7             	mov    %rax,%rdi
+  805488:	49 89 df             	mov    %rbx,%r15
+  80548b:	48 b8 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rax
+  805492:	ff ff ff 
+  805495:	48 01 d8             	add    %rbx,%rax
+  805498:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  80549a:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8054a1:	00 00 00 
+  8054a4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8054a7:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8054ab:	bf 05 00 00 00       	mov    $0x5,%edi
+  8054b0:	48 b8 eb c0 ff ff ff 	movabs $0xffffffffffffc0eb,%rax
+  8054b7:	ff ff ff 
+  8054ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054be:	ff d0                	call   *%rax
+}
+  8054c0:	48 83 c4 10          	add    $0x10,%rsp
+  8054c4:	5b                   	pop    %rbx
+  8054c5:	41 5f                	pop    %r15
+  8054c7:	5d                   	pop    %rbp
+  8054c8:	c3                   	ret
+
+00000000008054c9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8054c9:	55                   	push   %rbp
+  8054ca:	48 89 e5             	mov    %rsp,%rbp
+  8054cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8054d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054d1 <nsipc_listen+0x8>
+  8054d8:	49 bb 67 3b 00 00 00 	movabs $0x3b67,%r11
+  8054df:	00 00 00 
+  8054e2:	4c 01 d8             	add    %r11,%rax
+  8054e5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8054e8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8054eb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8054ee:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8054f1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8054f4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8054f7:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8054fb:	ba 08 00 00 00       	mov    $0x8,%edx
+  805500:	48 89 ce             	mov    %rcx,%rsi
+  805503:	bf 06 00 00 00       	mov    $0x6,%edi
+  805508:	48 b9 8e c1 ff ff ff 	movabs $0xffffffffffffc18e,%rcx
+  80550f:	ff ff ff 
+  805512:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805516:	ff d0                	call   *%rax
+}
+  805518:	c9                   	leave
+  805519:	c3                   	ret
+
+000000000080551a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80551a:	55                   	push   %rbp
+  80551b:	48 89 e5             	mov    %rsp,%rbp
+  80551e:	41 57                	push   %r15
+  805520:	53                   	push   %rbx
+  805521:	48 83 ec 30          	sub    $0x30,%rsp
+  805525:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805525 <nsipc_recv+0xb>
+  80552c:	49 bb 13 3b 00 00 00 	movabs $0x3b13,%r11
+  805533:	00 00 00 
+  805536:	4c 01 db             	add    %r11,%rbx
+  805539:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80553c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805540:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805543:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805546:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80554d:	00 00 00 
+  805550:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805553:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805556:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80555d:	00 00 00 
+  805560:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805563:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805567:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80556e:	00 00 00 
+  805571:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805574:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805578:	bf 07 00 00 00       	mov    $0x7,%edi
+  80557d:	48 b8 eb c0 ff ff ff 	movabs $0xffffffffffffc0eb,%rax
+  805584:	ff ff ff 
+  805587:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80558b:	ff d0                	call   *%rax
+  80558d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805590:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805594:	0f 88 91 00 00 00    	js     80562b <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  80559a:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8055a1:	7f 08                	jg     8055ab <nsipc_recv+0x91>
+  8055a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055a6:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8055a9:	7e 50                	jle    8055fb <nsipc_recv+0xe1>
+  8055ab:	48 b8 e3 e2 ff ff ff 	movabs $0xffffffffffffe2e3,%rax
+  8055b2:	ff ff ff 
+  8055b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055b9:	48 89 c1             	mov    %rax,%rcx
+  8055bc:	48 b8 f8 e2 ff ff ff 	movabs $0xffffffffffffe2f8,%rax
+  8055c3:	ff ff ff 
+  8055c6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055ca:	48 89 c2             	mov    %rax,%rdx
+  8055cd:	be 79 00 00 00       	mov    $0x79,%esi
+  8055d2:	48 b8 0d e3 ff ff ff 	movabs $0xffffffffffffe30d,%rax
+  8055d9:	ff ff ff 
+  8055dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055e0:	48 89 c7             	mov    %rax,%rdi
+  8055e3:	49 89 df             	mov    %rbx,%r15
+  8055e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055eb:	49 b8 0b 7e ff ff ff 	movabs $0xffffffffffff7e0b,%r8
+  8055f2:	ff ff ff 
+  8055f5:	49 01 d8             	add    %rbx,%r8
+  8055f8:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8055fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055fe:	48 63 d0             	movslq %eax,%rdx
+  805601:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805605:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  80560c:	00 00 00 
+  80560f:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805613:	48 89 ce             	mov    %rcx,%rsi
+  805616:	48 89 c7             	mov    %rax,%rdi
+  805619:	49 89 df             	mov    %rbx,%r15
+  80561c:	48 b8 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rax
+  805623:	ff ff ff 
+  805626:	48 01 d8             	add    %rbx,%rax
+  805629:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80562b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80562e:	48 83 c4 30          	add    $0x30,%rsp
+  805632:	5b                   	pop    %rbx
+  805633:	41 5f                	pop    %r15
+  805635:	5d                   	pop    %rbp
+  805636:	c3                   	ret
+
+0000000000805637 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805637:	55                   	push   %rbp
+  805638:	48 89 e5             	mov    %rsp,%rbp
+  80563b:	41 57                	push   %r15
+  80563d:	53                   	push   %rbx
+  80563e:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805645:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805645 <nsipc_send+0xe>
+  80564c:	49 bb f3 39 00 00 00 	movabs $0x39f3,%r11
+  805653:	00 00 00 
+  805656:	4c 01 db             	add    %r11,%rbx
+  805659:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  80565f:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805666:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  80566c:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805672:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805676:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  80567a:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  805681:	00 00 00 
+  805684:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805687:	85 c0                	test   %eax,%eax
+  805689:	75 24                	jne    8056af <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80568b:	bf 02 00 00 00       	mov    $0x2,%edi
+  805690:	49 89 df             	mov    %rbx,%r15
+  805693:	48 b8 d1 da ff ff ff 	movabs $0xffffffffffffdad1,%rax
+  80569a:	ff ff ff 
+  80569d:	48 01 d8             	add    %rbx,%rax
+  8056a0:	ff d0                	call   *%rax
+  8056a2:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  8056a9:	00 00 00 
+  8056ac:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8056af:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8056b5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8056b8:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8056bf:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8056c2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8056c5:	39 c2                	cmp    %eax,%edx
+  8056c7:	0f 4e c2             	cmovle %edx,%eax
+  8056ca:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8056d0:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8056d6:	48 63 d0             	movslq %eax,%rdx
+  8056d9:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8056e0:	48 89 c6             	mov    %rax,%rsi
+  8056e3:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8056ea:	00 00 00 
+  8056ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056f1:	48 89 c7             	mov    %rax,%rdi
+  8056f4:	49 89 df             	mov    %rbx,%r15
+  8056f7:	48 b8 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rax
+  8056fe:	ff ff ff 
+  805701:	48 01 d8             	add    %rbx,%rax
+  805704:	ff d0                	call   *%rax
+	req->req_s = s;
+  805706:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80570a:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805710:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805712:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805716:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80571c:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  80571f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805723:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805729:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  80572c:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  805733:	00 00 00 
+  805736:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80573a:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  80573e:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805745:	00 
+  805746:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80574c:	48 63 d0             	movslq %eax,%rdx
+  80574f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805753:	48 01 d0             	add    %rdx,%rax
+  805756:	48 83 e8 01          	sub    $0x1,%rax
+  80575a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80575e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805762:	ba 00 00 00 00       	mov    $0x0,%edx
+  805767:	48 f7 75 d8          	divq   -0x28(%rbp)
+  80576b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80576f:	48 29 d0             	sub    %rdx,%rax
+  805772:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805778:	85 c0                	test   %eax,%eax
+  80577a:	0f 48 c2             	cmovs  %edx,%eax
+  80577d:	c1 f8 0c             	sar    $0xc,%eax
+  805780:	48 98                	cltq
+  805782:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805786:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80578a:	48 85 c0             	test   %rax,%rax
+  80578d:	0f 95 c0             	setne  %al
+  805790:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805793:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  80579a:	00 
+  80579b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80579f:	48 83 c0 0b          	add    $0xb,%rax
+  8057a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8057a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8057ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057b0:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8057b4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8057b8:	48 29 d0             	sub    %rdx,%rax
+  8057bb:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8057bf:	89 c7                	mov    %eax,%edi
+  8057c1:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8057c8:	00 00 00 
+  8057cb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8057ce:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8057d2:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8057d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8057da:	6a 00                	push   $0x0
+  8057dc:	6a 00                	push   $0x0
+  8057de:	6a 05                	push   $0x5
+  8057e0:	41 89 f1             	mov    %esi,%r9d
+  8057e3:	49 89 c8             	mov    %rcx,%r8
+  8057e6:	89 f9                	mov    %edi,%ecx
+  8057e8:	be 08 00 00 00       	mov    $0x8,%esi
+  8057ed:	89 c7                	mov    %eax,%edi
+  8057ef:	49 89 df             	mov    %rbx,%r15
+  8057f2:	48 b8 d9 d6 ff ff ff 	movabs $0xffffffffffffd6d9,%rax
+  8057f9:	ff ff ff 
+  8057fc:	48 01 d8             	add    %rbx,%rax
+  8057ff:	ff d0                	call   *%rax
+  805801:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805805:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805809:	5b                   	pop    %rbx
+  80580a:	41 5f                	pop    %r15
+  80580c:	5d                   	pop    %rbp
+  80580d:	c3                   	ret
+
+000000000080580e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80580e:	55                   	push   %rbp
+  80580f:	48 89 e5             	mov    %rsp,%rbp
+  805812:	48 83 ec 10          	sub    $0x10,%rsp
+  805816:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805816 <nsipc_socket+0x8>
+  80581d:	49 bb 22 38 00 00 00 	movabs $0x3822,%r11
+  805824:	00 00 00 
+  805827:	4c 01 d8             	add    %r11,%rax
+  80582a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80582d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805830:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805833:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  80583a:	00 00 00 
+  80583d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805840:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805843:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  80584a:	00 00 00 
+  80584d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805850:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805854:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  80585b:	00 00 00 
+  80585e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805861:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805865:	bf 09 00 00 00       	mov    $0x9,%edi
+  80586a:	48 ba eb c0 ff ff ff 	movabs $0xffffffffffffc0eb,%rdx
+  805871:	ff ff ff 
+  805874:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805878:	ff d0                	call   *%rax
+}
+  80587a:	c9                   	leave
+  80587b:	c3                   	ret
+
+000000000080587c <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  80587c:	55                   	push   %rbp
+  80587d:	48 89 e5             	mov    %rsp,%rbp
+  805880:	41 57                	push   %r15
+  805882:	53                   	push   %rbx
+  805883:	48 83 ec 30          	sub    $0x30,%rsp
+  805887:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805887 <pipe+0xb>
+  80588e:	49 bb b1 37 00 00 00 	movabs $0x37b1,%r11
+  805895:	00 00 00 
+  805898:	4c 01 db             	add    %r11,%rbx
+  80589b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  80589f:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8058a3:	48 89 c7             	mov    %rax,%rdi
+  8058a6:	49 89 df             	mov    %rbx,%r15
+  8058a9:	48 b8 05 a5 ff ff ff 	movabs $0xffffffffffffa505,%rax
+  8058b0:	ff ff ff 
+  8058b3:	48 01 d8             	add    %rbx,%rax
+  8058b6:	ff d0                	call   *%rax
+  8058b8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058bf:	0f 88 12 02 00 00    	js     805ad7 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8058c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8058c9:	ba 07 04 00 00       	mov    $0x407,%edx
+  8058ce:	48 89 c6             	mov    %rax,%rsi
+  8058d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058d6:	49 89 df             	mov    %rbx,%r15
+  8058d9:	48 b8 60 9b ff ff ff 	movabs $0xffffffffffff9b60,%rax
+  8058e0:	ff ff ff 
+  8058e3:	48 01 d8             	add    %rbx,%rax
+  8058e6:	ff d0                	call   *%rax
+  8058e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058ef:	0f 88 e2 01 00 00    	js     805ad7 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8058f5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8058f9:	48 89 c7             	mov    %rax,%rdi
+  8058fc:	49 89 df             	mov    %rbx,%r15
+  8058ff:	48 b8 05 a5 ff ff ff 	movabs $0xffffffffffffa505,%rax
+  805906:	ff ff ff 
+  805909:	48 01 d8             	add    %rbx,%rax
+  80590c:	ff d0                	call   *%rax
+  80590e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805911:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805915:	0f 88 9b 01 00 00    	js     805ab6 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80591b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80591f:	ba 07 04 00 00       	mov    $0x407,%edx
+  805924:	48 89 c6             	mov    %rax,%rsi
+  805927:	bf 00 00 00 00       	mov    $0x0,%edi
+  80592c:	49 89 df             	mov    %rbx,%r15
+  80592f:	48 b8 60 9b ff ff ff 	movabs $0xffffffffffff9b60,%rax
+  805936:	ff ff ff 
+  805939:	48 01 d8             	add    %rbx,%rax
+  80593c:	ff d0                	call   *%rax
+  80593e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805941:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805945:	0f 88 6b 01 00 00    	js     805ab6 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  80594b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80594f:	48 89 c7             	mov    %rax,%rdi
+  805952:	49 89 df             	mov    %rbx,%r15
+  805955:	48 b8 c2 a4 ff ff ff 	movabs $0xffffffffffffa4c2,%rax
+  80595c:	ff ff ff 
+  80595f:	48 01 d8             	add    %rbx,%rax
+  805962:	ff d0                	call   *%rax
+  805964:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805968:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80596c:	ba 07 04 00 00       	mov    $0x407,%edx
+  805971:	48 89 c6             	mov    %rax,%rsi
+  805974:	bf 00 00 00 00       	mov    $0x0,%edi
+  805979:	49 89 df             	mov    %rbx,%r15
+  80597c:	48 b8 60 9b ff ff ff 	movabs $0xffffffffffff9b60,%rax
+  805983:	ff ff ff 
+  805986:	48 01 d8             	add    %rbx,%rax
+  805989:	ff d0                	call   *%rax
+  80598b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80598e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805992:	0f 88 fd 00 00 00    	js     805a95 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805998:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80599c:	48 89 c7             	mov    %rax,%rdi
+  80599f:	49 89 df             	mov    %rbx,%r15
+  8059a2:	48 b8 c2 a4 ff ff ff 	movabs $0xffffffffffffa4c2,%rax
+  8059a9:	ff ff ff 
+  8059ac:	48 01 d8             	add    %rbx,%rax
+  8059af:	ff d0                	call   *%rax
+  8059b1:	48 89 c2             	mov    %rax,%rdx
+  8059b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059b8:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8059be:	48 89 d1             	mov    %rdx,%rcx
+  8059c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8059c6:	48 89 c6             	mov    %rax,%rsi
+  8059c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059ce:	49 89 df             	mov    %rbx,%r15
+  8059d1:	48 b8 c5 9b ff ff ff 	movabs $0xffffffffffff9bc5,%rax
+  8059d8:	ff ff ff 
+  8059db:	48 01 d8             	add    %rbx,%rax
+  8059de:	ff d0                	call   *%rax
+  8059e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059e7:	0f 88 87 00 00 00    	js     805a74 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8059ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059f1:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  8059f8:	00 00 00 
+  8059fb:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8059fe:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805a00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a04:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805a0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a0f:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  805a16:	00 00 00 
+  805a19:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805a1c:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805a1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a22:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805a29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a2d:	48 89 c7             	mov    %rax,%rdi
+  805a30:	49 89 df             	mov    %rbx,%r15
+  805a33:	48 b8 8b a4 ff ff ff 	movabs $0xffffffffffffa48b,%rax
+  805a3a:	ff ff ff 
+  805a3d:	48 01 d8             	add    %rbx,%rax
+  805a40:	ff d0                	call   *%rax
+  805a42:	89 c2                	mov    %eax,%edx
+  805a44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a48:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805a4a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a4e:	48 89 c7             	mov    %rax,%rdi
+  805a51:	49 89 df             	mov    %rbx,%r15
+  805a54:	48 b8 8b a4 ff ff ff 	movabs $0xffffffffffffa48b,%rax
+  805a5b:	ff ff ff 
+  805a5e:	48 01 d8             	add    %rbx,%rax
+  805a61:	ff d0                	call   *%rax
+  805a63:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805a67:	48 83 c2 04          	add    $0x4,%rdx
+  805a6b:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a72:	eb 67                	jmp    805adb <pipe+0x25f>
+		goto err3;
+  805a74:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805a75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a79:	48 89 c6             	mov    %rax,%rsi
+  805a7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a81:	49 89 df             	mov    %rbx,%r15
+  805a84:	48 b8 38 9c ff ff ff 	movabs $0xffffffffffff9c38,%rax
+  805a8b:	ff ff ff 
+  805a8e:	48 01 d8             	add    %rbx,%rax
+  805a91:	ff d0                	call   *%rax
+  805a93:	eb 01                	jmp    805a96 <pipe+0x21a>
+		goto err2;
+  805a95:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805a96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a9a:	48 89 c6             	mov    %rax,%rsi
+  805a9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805aa2:	49 89 df             	mov    %rbx,%r15
+  805aa5:	48 b8 38 9c ff ff ff 	movabs $0xffffffffffff9c38,%rax
+  805aac:	ff ff ff 
+  805aaf:	48 01 d8             	add    %rbx,%rax
+  805ab2:	ff d0                	call   *%rax
+  805ab4:	eb 01                	jmp    805ab7 <pipe+0x23b>
+		goto err1;
+  805ab6:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805ab7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805abb:	48 89 c6             	mov    %rax,%rsi
+  805abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ac3:	49 89 df             	mov    %rbx,%r15
+  805ac6:	48 b8 38 9c ff ff ff 	movabs $0xffffffffffff9c38,%rax
+  805acd:	ff ff ff 
+  805ad0:	48 01 d8             	add    %rbx,%rax
+  805ad3:	ff d0                	call   *%rax
+  805ad5:	eb 01                	jmp    805ad8 <pipe+0x25c>
+		goto err;
+  805ad7:	90                   	nop
+err:
+	return r;
+  805ad8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805adb:	48 83 c4 30          	add    $0x30,%rsp
+  805adf:	5b                   	pop    %rbx
+  805ae0:	41 5f                	pop    %r15
+  805ae2:	5d                   	pop    %rbp
+  805ae3:	c3                   	ret
+
+0000000000805ae4 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805ae4:	55                   	push   %rbp
+  805ae5:	48 89 e5             	mov    %rsp,%rbp
+  805ae8:	41 57                	push   %r15
+  805aea:	41 54                	push   %r12
+  805aec:	53                   	push   %rbx
+  805aed:	48 83 ec 28          	sub    $0x28,%rsp
+  805af1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805af1 <_pipeisclosed+0xd>
+  805af8:	49 bb 47 35 00 00 00 	movabs $0x3547,%r11
+  805aff:	00 00 00 
+  805b02:	4c 01 db             	add    %r11,%rbx
+  805b05:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805b09:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805b0d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b14:	ff ff ff 
+  805b17:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b1b:	48 8b 00             	mov    (%rax),%rax
+  805b1e:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805b24:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805b27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b2b:	48 89 c7             	mov    %rax,%rdi
+  805b2e:	49 89 df             	mov    %rbx,%r15
+  805b31:	48 b8 60 db ff ff ff 	movabs $0xffffffffffffdb60,%rax
+  805b38:	ff ff ff 
+  805b3b:	48 01 d8             	add    %rbx,%rax
+  805b3e:	ff d0                	call   *%rax
+  805b40:	41 89 c4             	mov    %eax,%r12d
+  805b43:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805b47:	48 89 c7             	mov    %rax,%rdi
+  805b4a:	49 89 df             	mov    %rbx,%r15
+  805b4d:	48 b8 60 db ff ff ff 	movabs $0xffffffffffffdb60,%rax
+  805b54:	ff ff ff 
+  805b57:	48 01 d8             	add    %rbx,%rax
+  805b5a:	ff d0                	call   *%rax
+  805b5c:	41 39 c4             	cmp    %eax,%r12d
+  805b5f:	0f 94 c0             	sete   %al
+  805b62:	0f b6 c0             	movzbl %al,%eax
+  805b65:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805b68:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b6f:	ff ff ff 
+  805b72:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b76:	48 8b 00             	mov    (%rax),%rax
+  805b79:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805b7f:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805b82:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b85:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805b88:	75 05                	jne    805b8f <_pipeisclosed+0xab>
+			return ret;
+  805b8a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805b8d:	eb 63                	jmp    805bf2 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805b8f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b92:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805b95:	0f 84 72 ff ff ff    	je     805b0d <_pipeisclosed+0x29>
+  805b9b:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805b9f:	0f 85 68 ff ff ff    	jne    805b0d <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805ba5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805bac:	ff ff ff 
+  805baf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bb3:	48 8b 00             	mov    (%rax),%rax
+  805bb6:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805bbc:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805bbf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bc2:	89 c6                	mov    %eax,%esi
+  805bc4:	48 b8 1e e3 ff ff ff 	movabs $0xffffffffffffe31e,%rax
+  805bcb:	ff ff ff 
+  805bce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805bd2:	48 89 c7             	mov    %rax,%rdi
+  805bd5:	49 89 df             	mov    %rbx,%r15
+  805bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bdd:	49 b8 e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%r8
+  805be4:	ff ff ff 
+  805be7:	49 01 d8             	add    %rbx,%r8
+  805bea:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805bed:	e9 1b ff ff ff       	jmp    805b0d <_pipeisclosed+0x29>
+	}
+}
+  805bf2:	48 83 c4 28          	add    $0x28,%rsp
+  805bf6:	5b                   	pop    %rbx
+  805bf7:	41 5c                	pop    %r12
+  805bf9:	41 5f                	pop    %r15
+  805bfb:	5d                   	pop    %rbp
+  805bfc:	c3                   	ret
+
+0000000000805bfd <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805bfd:	55                   	push   %rbp
+  805bfe:	48 89 e5             	mov    %rsp,%rbp
+  805c01:	41 57                	push   %r15
+  805c03:	53                   	push   %rbx
+  805c04:	48 83 ec 30          	sub    $0x30,%rsp
+  805c08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c08 <pipeisclosed+0xb>
+  805c0f:	49 bb 30 34 00 00 00 	movabs $0x3430,%r11
+  805c16:	00 00 00 
+  805c19:	4c 01 db             	add    %r11,%rbx
+  805c1c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805c1f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805c23:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c26:	48 89 d6             	mov    %rdx,%rsi
+  805c29:	89 c7                	mov    %eax,%edi
+  805c2b:	49 89 df             	mov    %rbx,%r15
+  805c2e:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  805c35:	ff ff ff 
+  805c38:	48 01 d8             	add    %rbx,%rax
+  805c3b:	ff d0                	call   *%rax
+  805c3d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c40:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c44:	79 05                	jns    805c4b <pipeisclosed+0x4e>
+		return r;
+  805c46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c49:	eb 3b                	jmp    805c86 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805c4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c4f:	48 89 c7             	mov    %rax,%rdi
+  805c52:	49 89 df             	mov    %rbx,%r15
+  805c55:	48 b8 c2 a4 ff ff ff 	movabs $0xffffffffffffa4c2,%rax
+  805c5c:	ff ff ff 
+  805c5f:	48 01 d8             	add    %rbx,%rax
+  805c62:	ff d0                	call   *%rax
+  805c64:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805c68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c6c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c70:	48 89 d6             	mov    %rdx,%rsi
+  805c73:	48 89 c7             	mov    %rax,%rdi
+  805c76:	48 b8 ac ca ff ff ff 	movabs $0xffffffffffffcaac,%rax
+  805c7d:	ff ff ff 
+  805c80:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c84:	ff d0                	call   *%rax
+}
+  805c86:	48 83 c4 30          	add    $0x30,%rsp
+  805c8a:	5b                   	pop    %rbx
+  805c8b:	41 5f                	pop    %r15
+  805c8d:	5d                   	pop    %rbp
+  805c8e:	c3                   	ret
+
+0000000000805c8f <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805c8f:	55                   	push   %rbp
+  805c90:	48 89 e5             	mov    %rsp,%rbp
+  805c93:	41 57                	push   %r15
+  805c95:	53                   	push   %rbx
+  805c96:	48 83 ec 40          	sub    $0x40,%rsp
+  805c9a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c9a <devpipe_read+0xb>
+  805ca1:	49 bb 9e 33 00 00 00 	movabs $0x339e,%r11
+  805ca8:	00 00 00 
+  805cab:	4c 01 db             	add    %r11,%rbx
+  805cae:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805cb2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805cb6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805cba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805cbe:	48 89 c7             	mov    %rax,%rdi
+  805cc1:	49 89 df             	mov    %rbx,%r15
+  805cc4:	48 b8 c2 a4 ff ff ff 	movabs $0xffffffffffffa4c2,%rax
+  805ccb:	ff ff ff 
+  805cce:	48 01 d8             	add    %rbx,%rax
+  805cd1:	ff d0                	call   *%rax
+  805cd3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805cd7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805cdb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805cdf:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805ce6:	00 
+  805ce7:	e9 a1 00 00 00       	jmp    805d8d <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805cec:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805cf1:	74 09                	je     805cfc <devpipe_read+0x6d>
+				return i;
+  805cf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cf7:	e9 9f 00 00 00       	jmp    805d9b <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805cfc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d04:	48 89 d6             	mov    %rdx,%rsi
+  805d07:	48 89 c7             	mov    %rax,%rdi
+  805d0a:	48 b8 ac ca ff ff ff 	movabs $0xffffffffffffcaac,%rax
+  805d11:	ff ff ff 
+  805d14:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d18:	ff d0                	call   *%rax
+  805d1a:	85 c0                	test   %eax,%eax
+  805d1c:	74 07                	je     805d25 <devpipe_read+0x96>
+				return 0;
+  805d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d23:	eb 76                	jmp    805d9b <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805d25:	49 89 df             	mov    %rbx,%r15
+  805d28:	48 b8 0b 9b ff ff ff 	movabs $0xffffffffffff9b0b,%rax
+  805d2f:	ff ff ff 
+  805d32:	48 01 d8             	add    %rbx,%rax
+  805d35:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805d37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d3b:	8b 10                	mov    (%rax),%edx
+  805d3d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d41:	8b 40 04             	mov    0x4(%rax),%eax
+  805d44:	39 c2                	cmp    %eax,%edx
+  805d46:	74 a4                	je     805cec <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805d48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d4c:	8b 10                	mov    (%rax),%edx
+  805d4e:	89 d0                	mov    %edx,%eax
+  805d50:	c1 f8 1f             	sar    $0x1f,%eax
+  805d53:	c1 e8 1b             	shr    $0x1b,%eax
+  805d56:	01 c2                	add    %eax,%edx
+  805d58:	83 e2 1f             	and    $0x1f,%edx
+  805d5b:	29 c2                	sub    %eax,%edx
+  805d5d:	89 d6                	mov    %edx,%esi
+  805d5f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805d63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d67:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805d6b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d6f:	48 63 c6             	movslq %esi,%rax
+  805d72:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805d77:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805d79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d7d:	8b 00                	mov    (%rax),%eax
+  805d7f:	8d 50 01             	lea    0x1(%rax),%edx
+  805d82:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d86:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805d88:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805d8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d91:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805d95:	72 a0                	jb     805d37 <devpipe_read+0xa8>
+	}
+	return i;
+  805d97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805d9b:	48 83 c4 40          	add    $0x40,%rsp
+  805d9f:	5b                   	pop    %rbx
+  805da0:	41 5f                	pop    %r15
+  805da2:	5d                   	pop    %rbp
+  805da3:	c3                   	ret
+
+0000000000805da4 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805da4:	55                   	push   %rbp
+  805da5:	48 89 e5             	mov    %rsp,%rbp
+  805da8:	41 57                	push   %r15
+  805daa:	53                   	push   %rbx
+  805dab:	48 83 ec 40          	sub    $0x40,%rsp
+  805daf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805daf <devpipe_write+0xb>
+  805db6:	49 bb 89 32 00 00 00 	movabs $0x3289,%r11
+  805dbd:	00 00 00 
+  805dc0:	4c 01 db             	add    %r11,%rbx
+  805dc3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805dc7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805dcb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805dcf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805dd3:	48 89 c7             	mov    %rax,%rdi
+  805dd6:	49 89 df             	mov    %rbx,%r15
+  805dd9:	48 b8 c2 a4 ff ff ff 	movabs $0xffffffffffffa4c2,%rax
+  805de0:	ff ff ff 
+  805de3:	48 01 d8             	add    %rbx,%rax
+  805de6:	ff d0                	call   *%rax
+  805de8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805dec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805df0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805df4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805dfb:	00 
+  805dfc:	e9 a0 00 00 00       	jmp    805ea1 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805e01:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e09:	48 89 d6             	mov    %rdx,%rsi
+  805e0c:	48 89 c7             	mov    %rax,%rdi
+  805e0f:	48 b8 ac ca ff ff ff 	movabs $0xffffffffffffcaac,%rax
+  805e16:	ff ff ff 
+  805e19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e1d:	ff d0                	call   *%rax
+  805e1f:	85 c0                	test   %eax,%eax
+  805e21:	74 0a                	je     805e2d <devpipe_write+0x89>
+				return 0;
+  805e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e28:	e9 82 00 00 00       	jmp    805eaf <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805e2d:	49 89 df             	mov    %rbx,%r15
+  805e30:	48 b8 0b 9b ff ff ff 	movabs $0xffffffffffff9b0b,%rax
+  805e37:	ff ff ff 
+  805e3a:	48 01 d8             	add    %rbx,%rax
+  805e3d:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805e3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e43:	8b 40 04             	mov    0x4(%rax),%eax
+  805e46:	48 63 d0             	movslq %eax,%rdx
+  805e49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e4d:	8b 00                	mov    (%rax),%eax
+  805e4f:	48 98                	cltq
+  805e51:	48 83 c0 20          	add    $0x20,%rax
+  805e55:	48 39 c2             	cmp    %rax,%rdx
+  805e58:	73 a7                	jae    805e01 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805e5a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805e5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e62:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805e66:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e6a:	8b 50 04             	mov    0x4(%rax),%edx
+  805e6d:	89 d0                	mov    %edx,%eax
+  805e6f:	c1 f8 1f             	sar    $0x1f,%eax
+  805e72:	c1 e8 1b             	shr    $0x1b,%eax
+  805e75:	01 c2                	add    %eax,%edx
+  805e77:	83 e2 1f             	and    $0x1f,%edx
+  805e7a:	29 c2                	sub    %eax,%edx
+  805e7c:	89 d0                	mov    %edx,%eax
+  805e7e:	0f b6 09             	movzbl (%rcx),%ecx
+  805e81:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e85:	48 98                	cltq
+  805e87:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805e8b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e8f:	8b 40 04             	mov    0x4(%rax),%eax
+  805e92:	8d 50 01             	lea    0x1(%rax),%edx
+  805e95:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e99:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805e9c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805ea1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ea5:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805ea9:	72 94                	jb     805e3f <devpipe_write+0x9b>
+	}
+
+	return i;
+  805eab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805eaf:	48 83 c4 40          	add    $0x40,%rsp
+  805eb3:	5b                   	pop    %rbx
+  805eb4:	41 5f                	pop    %r15
+  805eb6:	5d                   	pop    %rbp
+  805eb7:	c3                   	ret
+
+0000000000805eb8 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805eb8:	55                   	push   %rbp
+  805eb9:	48 89 e5             	mov    %rsp,%rbp
+  805ebc:	41 57                	push   %r15
+  805ebe:	53                   	push   %rbx
+  805ebf:	48 83 ec 20          	sub    $0x20,%rsp
+  805ec3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ec3 <devpipe_stat+0xb>
+  805eca:	49 bb 75 31 00 00 00 	movabs $0x3175,%r11
+  805ed1:	00 00 00 
+  805ed4:	4c 01 db             	add    %r11,%rbx
+  805ed7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805edb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805edf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ee3:	48 89 c7             	mov    %rax,%rdi
+  805ee6:	49 89 df             	mov    %rbx,%r15
+  805ee9:	48 b8 c2 a4 ff ff ff 	movabs $0xffffffffffffa4c2,%rax
+  805ef0:	ff ff ff 
+  805ef3:	48 01 d8             	add    %rbx,%rax
+  805ef6:	ff d0                	call   *%rax
+  805ef8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805efc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f00:	48 ba 31 e3 ff ff ff 	movabs $0xffffffffffffe331,%rdx
+  805f07:	ff ff ff 
+  805f0a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805f0e:	48 89 d6             	mov    %rdx,%rsi
+  805f11:	48 89 c7             	mov    %rax,%rdi
+  805f14:	49 89 df             	mov    %rbx,%r15
+  805f17:	48 b8 a4 8e ff ff ff 	movabs $0xffffffffffff8ea4,%rax
+  805f1e:	ff ff ff 
+  805f21:	48 01 d8             	add    %rbx,%rax
+  805f24:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f2a:	8b 50 04             	mov    0x4(%rax),%edx
+  805f2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f31:	8b 00                	mov    (%rax),%eax
+  805f33:	29 c2                	sub    %eax,%edx
+  805f35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f39:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805f3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f43:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805f4a:	00 00 00 
+	stat->st_dev = &devpipe;
+  805f4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f51:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  805f58:	00 00 00 
+  805f5b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805f5f:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805f66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805f6b:	48 83 c4 20          	add    $0x20,%rsp
+  805f6f:	5b                   	pop    %rbx
+  805f70:	41 5f                	pop    %r15
+  805f72:	5d                   	pop    %rbp
+  805f73:	c3                   	ret
+
+0000000000805f74 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805f74:	55                   	push   %rbp
+  805f75:	48 89 e5             	mov    %rsp,%rbp
+  805f78:	41 57                	push   %r15
+  805f7a:	53                   	push   %rbx
+  805f7b:	48 83 ec 10          	sub    $0x10,%rsp
+  805f7f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f7f <devpipe_close+0xb>
+  805f86:	49 bb b9 30 00 00 00 	movabs $0x30b9,%r11
+  805f8d:	00 00 00 
+  805f90:	4c 01 db             	add    %r11,%rbx
+  805f93:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805f97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f9b:	48 89 c6             	mov    %rax,%rsi
+  805f9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fa3:	49 89 df             	mov    %rbx,%r15
+  805fa6:	48 b8 38 9c ff ff ff 	movabs $0xffffffffffff9c38,%rax
+  805fad:	ff ff ff 
+  805fb0:	48 01 d8             	add    %rbx,%rax
+  805fb3:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805fb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fb9:	48 89 c7             	mov    %rax,%rdi
+  805fbc:	49 89 df             	mov    %rbx,%r15
+  805fbf:	48 b8 c2 a4 ff ff ff 	movabs $0xffffffffffffa4c2,%rax
+  805fc6:	ff ff ff 
+  805fc9:	48 01 d8             	add    %rbx,%rax
+  805fcc:	ff d0                	call   *%rax
+  805fce:	48 89 c6             	mov    %rax,%rsi
+  805fd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fd6:	49 89 df             	mov    %rbx,%r15
+  805fd9:	48 b8 38 9c ff ff ff 	movabs $0xffffffffffff9c38,%rax
+  805fe0:	ff ff ff 
+  805fe3:	48 01 d8             	add    %rbx,%rax
+  805fe6:	ff d0                	call   *%rax
+}
+  805fe8:	48 83 c4 10          	add    $0x10,%rsp
+  805fec:	5b                   	pop    %rbx
+  805fed:	41 5f                	pop    %r15
+  805fef:	5d                   	pop    %rbp
+  805ff0:	c3                   	ret
+
+0000000000805ff1 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  805ff1:	55                   	push   %rbp
+  805ff2:	48 89 e5             	mov    %rsp,%rbp
+  805ff5:	41 57                	push   %r15
+  805ff7:	48 83 ec 28          	sub    $0x28,%rsp
+  805ffb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ffb <cputchar+0xa>
+  806002:	49 bb 3d 30 00 00 00 	movabs $0x303d,%r11
+  806009:	00 00 00 
+  80600c:	4c 01 d8             	add    %r11,%rax
+  80600f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806012:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806015:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806018:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  80601c:	be 01 00 00 00       	mov    $0x1,%esi
+  806021:	48 89 d7             	mov    %rdx,%rdi
+  806024:	49 89 c7             	mov    %rax,%r15
+  806027:	48 ba a8 99 ff ff ff 	movabs $0xffffffffffff99a8,%rdx
+  80602e:	ff ff ff 
+  806031:	48 01 c2             	add    %rax,%rdx
+  806034:	ff d2                	call   *%rdx
+}
+  806036:	90                   	nop
+  806037:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80603b:	c9                   	leave
+  80603c:	c3                   	ret
+
+000000000080603d <getchar>:
+
+int
+getchar(void)
+{
+  80603d:	55                   	push   %rbp
+  80603e:	48 89 e5             	mov    %rsp,%rbp
+  806041:	41 57                	push   %r15
+  806043:	48 83 ec 18          	sub    $0x18,%rsp
+  806047:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806047 <getchar+0xa>
+  80604e:	49 bb f1 2f 00 00 00 	movabs $0x2ff1,%r11
+  806055:	00 00 00 
+  806058:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  80605b:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80605f:	ba 01 00 00 00       	mov    $0x1,%edx
+  806064:	48 89 ce             	mov    %rcx,%rsi
+  806067:	bf 00 00 00 00       	mov    $0x0,%edi
+  80606c:	49 89 c7             	mov    %rax,%r15
+  80606f:	48 b9 02 ab ff ff ff 	movabs $0xffffffffffffab02,%rcx
+  806076:	ff ff ff 
+  806079:	48 01 c1             	add    %rax,%rcx
+  80607c:	ff d1                	call   *%rcx
+  80607e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806081:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806085:	79 05                	jns    80608c <getchar+0x4f>
+		return r;
+  806087:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80608a:	eb 14                	jmp    8060a0 <getchar+0x63>
+	if (r < 1)
+  80608c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806090:	7f 07                	jg     806099 <getchar+0x5c>
+		return -E_EOF;
+  806092:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806097:	eb 07                	jmp    8060a0 <getchar+0x63>
+	return c;
+  806099:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  80609d:	0f b6 c0             	movzbl %al,%eax
+}
+  8060a0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8060a4:	c9                   	leave
+  8060a5:	c3                   	ret
+
+00000000008060a6 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8060a6:	55                   	push   %rbp
+  8060a7:	48 89 e5             	mov    %rsp,%rbp
+  8060aa:	41 57                	push   %r15
+  8060ac:	53                   	push   %rbx
+  8060ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8060b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060b1 <iscons+0xb>
+  8060b8:	49 bb 87 2f 00 00 00 	movabs $0x2f87,%r11
+  8060bf:	00 00 00 
+  8060c2:	4c 01 db             	add    %r11,%rbx
+  8060c5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8060c8:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8060cc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8060cf:	48 89 d6             	mov    %rdx,%rsi
+  8060d2:	89 c7                	mov    %eax,%edi
+  8060d4:	49 89 df             	mov    %rbx,%r15
+  8060d7:	48 b8 bb a5 ff ff ff 	movabs $0xffffffffffffa5bb,%rax
+  8060de:	ff ff ff 
+  8060e1:	48 01 d8             	add    %rbx,%rax
+  8060e4:	ff d0                	call   *%rax
+  8060e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8060e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060ed:	79 05                	jns    8060f4 <iscons+0x4e>
+		return r;
+  8060ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060f2:	eb 1b                	jmp    80610f <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8060f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060f8:	8b 10                	mov    (%rax),%edx
+  8060fa:	48 b8 08 01 00 00 00 	movabs $0x108,%rax
+  806101:	00 00 00 
+  806104:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806107:	39 c2                	cmp    %eax,%edx
+  806109:	0f 94 c0             	sete   %al
+  80610c:	0f b6 c0             	movzbl %al,%eax
+}
+  80610f:	48 83 c4 20          	add    $0x20,%rsp
+  806113:	5b                   	pop    %rbx
+  806114:	41 5f                	pop    %r15
+  806116:	5d                   	pop    %rbp
+  806117:	c3                   	ret
+
+0000000000806118 <opencons>:
+
+int
+opencons(void)
+{
+  806118:	55                   	push   %rbp
+  806119:	48 89 e5             	mov    %rsp,%rbp
+  80611c:	41 57                	push   %r15
+  80611e:	53                   	push   %rbx
+  80611f:	48 83 ec 10          	sub    $0x10,%rsp
+  806123:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806123 <opencons+0xb>
+  80612a:	49 bb 15 2f 00 00 00 	movabs $0x2f15,%r11
+  806131:	00 00 00 
+  806134:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806137:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80613b:	48 89 c7             	mov    %rax,%rdi
+  80613e:	49 89 df             	mov    %rbx,%r15
+  806141:	48 b8 05 a5 ff ff ff 	movabs $0xffffffffffffa505,%rax
+  806148:	ff ff ff 
+  80614b:	48 01 d8             	add    %rbx,%rax
+  80614e:	ff d0                	call   *%rax
+  806150:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806153:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806157:	79 05                	jns    80615e <opencons+0x46>
+		return r;
+  806159:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80615c:	eb 68                	jmp    8061c6 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80615e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806162:	ba 07 04 00 00       	mov    $0x407,%edx
+  806167:	48 89 c6             	mov    %rax,%rsi
+  80616a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80616f:	49 89 df             	mov    %rbx,%r15
+  806172:	48 b8 60 9b ff ff ff 	movabs $0xffffffffffff9b60,%rax
+  806179:	ff ff ff 
+  80617c:	48 01 d8             	add    %rbx,%rax
+  80617f:	ff d0                	call   *%rax
+  806181:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806184:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806188:	79 05                	jns    80618f <opencons+0x77>
+		return r;
+  80618a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80618d:	eb 37                	jmp    8061c6 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80618f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806193:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  80619a:	00 00 00 
+  80619d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8061a0:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8061a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061a6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8061ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061b1:	48 89 c7             	mov    %rax,%rdi
+  8061b4:	49 89 df             	mov    %rbx,%r15
+  8061b7:	48 b8 8b a4 ff ff ff 	movabs $0xffffffffffffa48b,%rax
+  8061be:	ff ff ff 
+  8061c1:	48 01 d8             	add    %rbx,%rax
+  8061c4:	ff d0                	call   *%rax
+}
+  8061c6:	48 83 c4 10          	add    $0x10,%rsp
+  8061ca:	5b                   	pop    %rbx
+  8061cb:	41 5f                	pop    %r15
+  8061cd:	5d                   	pop    %rbp
+  8061ce:	c3                   	ret
+
+00000000008061cf <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8061cf:	55                   	push   %rbp
+  8061d0:	48 89 e5             	mov    %rsp,%rbp
+  8061d3:	41 57                	push   %r15
+  8061d5:	53                   	push   %rbx
+  8061d6:	48 83 ec 30          	sub    $0x30,%rsp
+  8061da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061da <devcons_read+0xb>
+  8061e1:	49 bb 5e 2e 00 00 00 	movabs $0x2e5e,%r11
+  8061e8:	00 00 00 
+  8061eb:	4c 01 db             	add    %r11,%rbx
+  8061ee:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8061f2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8061f6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8061fa:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8061ff:	75 19                	jne    80621a <devcons_read+0x4b>
+		return 0;
+  806201:	b8 00 00 00 00       	mov    $0x0,%eax
+  806206:	eb 55                	jmp    80625d <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806208:	49 89 df             	mov    %rbx,%r15
+  80620b:	48 b8 0b 9b ff ff ff 	movabs $0xffffffffffff9b0b,%rax
+  806212:	ff ff ff 
+  806215:	48 01 d8             	add    %rbx,%rax
+  806218:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  80621a:	49 89 df             	mov    %rbx,%r15
+  80621d:	48 b8 07 9a ff ff ff 	movabs $0xffffffffffff9a07,%rax
+  806224:	ff ff ff 
+  806227:	48 01 d8             	add    %rbx,%rax
+  80622a:	ff d0                	call   *%rax
+  80622c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80622f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806233:	74 d3                	je     806208 <devcons_read+0x39>
+	if (c < 0)
+  806235:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806239:	79 05                	jns    806240 <devcons_read+0x71>
+		return c;
+  80623b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80623e:	eb 1d                	jmp    80625d <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806240:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806244:	75 07                	jne    80624d <devcons_read+0x7e>
+		return 0;
+  806246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80624b:	eb 10                	jmp    80625d <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  80624d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806250:	89 c2                	mov    %eax,%edx
+  806252:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806256:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806258:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80625d:	48 83 c4 30          	add    $0x30,%rsp
+  806261:	5b                   	pop    %rbx
+  806262:	41 5f                	pop    %r15
+  806264:	5d                   	pop    %rbp
+  806265:	c3                   	ret
+
+0000000000806266 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806266:	55                   	push   %rbp
+  806267:	48 89 e5             	mov    %rsp,%rbp
+  80626a:	41 57                	push   %r15
+  80626c:	53                   	push   %rbx
+  80626d:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806274:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806274 <devcons_write+0xe>
+  80627b:	49 bb c4 2d 00 00 00 	movabs $0x2dc4,%r11
+  806282:	00 00 00 
+  806285:	4c 01 db             	add    %r11,%rbx
+  806288:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80628f:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806296:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  80629d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8062a4:	e9 80 00 00 00       	jmp    806329 <devcons_write+0xc3>
+		m = n - tot;
+  8062a9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8062b0:	89 c2                	mov    %eax,%edx
+  8062b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062b5:	29 c2                	sub    %eax,%edx
+  8062b7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8062ba:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8062bd:	83 f8 7f             	cmp    $0x7f,%eax
+  8062c0:	76 07                	jbe    8062c9 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8062c2:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8062c9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8062cc:	48 63 d0             	movslq %eax,%rdx
+  8062cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062d2:	48 63 c8             	movslq %eax,%rcx
+  8062d5:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8062dc:	48 01 c1             	add    %rax,%rcx
+  8062df:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8062e6:	48 89 ce             	mov    %rcx,%rsi
+  8062e9:	48 89 c7             	mov    %rax,%rdi
+  8062ec:	49 89 df             	mov    %rbx,%r15
+  8062ef:	48 b8 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rax
+  8062f6:	ff ff ff 
+  8062f9:	48 01 d8             	add    %rbx,%rax
+  8062fc:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8062fe:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806301:	48 63 d0             	movslq %eax,%rdx
+  806304:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80630b:	48 89 d6             	mov    %rdx,%rsi
+  80630e:	48 89 c7             	mov    %rax,%rdi
+  806311:	49 89 df             	mov    %rbx,%r15
+  806314:	48 b8 a8 99 ff ff ff 	movabs $0xffffffffffff99a8,%rax
+  80631b:	ff ff ff 
+  80631e:	48 01 d8             	add    %rbx,%rax
+  806321:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806323:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806326:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806329:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80632c:	48 98                	cltq
+  80632e:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806335:	0f 82 6e ff ff ff    	jb     8062a9 <devcons_write+0x43>
+	}
+	return tot;
+  80633b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80633e:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806345:	5b                   	pop    %rbx
+  806346:	41 5f                	pop    %r15
+  806348:	5d                   	pop    %rbp
+  806349:	c3                   	ret
+
+000000000080634a <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  80634a:	55                   	push   %rbp
+  80634b:	48 89 e5             	mov    %rsp,%rbp
+  80634e:	48 83 ec 08          	sub    $0x8,%rsp
+  806352:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806352 <devcons_close+0x8>
+  806359:	49 bb e6 2c 00 00 00 	movabs $0x2ce6,%r11
+  806360:	00 00 00 
+  806363:	4c 01 d8             	add    %r11,%rax
+  806366:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  80636a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80636f:	c9                   	leave
+  806370:	c3                   	ret
+
+0000000000806371 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806371:	55                   	push   %rbp
+  806372:	48 89 e5             	mov    %rsp,%rbp
+  806375:	41 57                	push   %r15
+  806377:	48 83 ec 18          	sub    $0x18,%rsp
+  80637b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80637b <devcons_stat+0xa>
+  806382:	49 bb bd 2c 00 00 00 	movabs $0x2cbd,%r11
+  806389:	00 00 00 
+  80638c:	4c 01 d8             	add    %r11,%rax
+  80638f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806393:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806397:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80639b:	48 b9 3d e3 ff ff ff 	movabs $0xffffffffffffe33d,%rcx
+  8063a2:	ff ff ff 
+  8063a5:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8063a9:	48 89 ce             	mov    %rcx,%rsi
+  8063ac:	48 89 d7             	mov    %rdx,%rdi
+  8063af:	49 89 c7             	mov    %rax,%r15
+  8063b2:	48 ba a4 8e ff ff ff 	movabs $0xffffffffffff8ea4,%rdx
+  8063b9:	ff ff ff 
+  8063bc:	48 01 c2             	add    %rax,%rdx
+  8063bf:	ff d2                	call   *%rdx
+	return 0;
+  8063c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8063c6:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8063ca:	c9                   	leave
+  8063cb:	c3                   	ret
+
+00000000008063cc <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8063cc:	55                   	push   %rbp
+  8063cd:	48 89 e5             	mov    %rsp,%rbp
+  8063d0:	41 57                	push   %r15
+  8063d2:	53                   	push   %rbx
+  8063d3:	48 83 ec 30          	sub    $0x30,%rsp
+  8063d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063d7 <ipc_recv+0xb>
+  8063de:	49 bb 61 2c 00 00 00 	movabs $0x2c61,%r11
+  8063e5:	00 00 00 
+  8063e8:	4c 01 db             	add    %r11,%rbx
+  8063eb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8063ef:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8063f3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8063f7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8063fc:	75 0e                	jne    80640c <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8063fe:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806405:	00 00 00 
+  806408:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  80640c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806410:	48 89 c7             	mov    %rax,%rdi
+  806413:	49 89 df             	mov    %rbx,%r15
+  806416:	48 b8 89 9e ff ff ff 	movabs $0xffffffffffff9e89,%rax
+  80641d:	ff ff ff 
+  806420:	48 01 d8             	add    %rbx,%rax
+  806423:	ff d0                	call   *%rax
+  806425:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  806428:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80642d:	74 2a                	je     806459 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  80642f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806433:	75 19                	jne    80644e <ipc_recv+0x82>
+  806435:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80643c:	ff ff ff 
+  80643f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806443:	48 8b 00             	mov    (%rax),%rax
+  806446:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80644c:	eb 05                	jmp    806453 <ipc_recv+0x87>
+  80644e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806453:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806457:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806459:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80645e:	74 2a                	je     80648a <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  806460:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806464:	75 19                	jne    80647f <ipc_recv+0xb3>
+  806466:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80646d:	ff ff ff 
+  806470:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806474:	48 8b 00             	mov    (%rax),%rax
+  806477:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80647d:	eb 05                	jmp    806484 <ipc_recv+0xb8>
+  80647f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806484:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806488:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80648a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80648e:	74 05                	je     806495 <ipc_recv+0xc9>
+		return res;
+  806490:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806493:	eb 17                	jmp    8064ac <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806495:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80649c:	ff ff ff 
+  80649f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064a3:	48 8b 00             	mov    (%rax),%rax
+  8064a6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8064ac:	48 83 c4 30          	add    $0x30,%rsp
+  8064b0:	5b                   	pop    %rbx
+  8064b1:	41 5f                	pop    %r15
+  8064b3:	5d                   	pop    %rbp
+  8064b4:	c3                   	ret
+
+00000000008064b5 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8064b5:	55                   	push   %rbp
+  8064b6:	48 89 e5             	mov    %rsp,%rbp
+  8064b9:	41 57                	push   %r15
+  8064bb:	53                   	push   %rbx
+  8064bc:	48 83 ec 20          	sub    $0x20,%rsp
+  8064c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064c0 <ipc_send+0xb>
+  8064c7:	49 bb 78 2b 00 00 00 	movabs $0x2b78,%r11
+  8064ce:	00 00 00 
+  8064d1:	4c 01 db             	add    %r11,%rbx
+  8064d4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8064d7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8064da:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8064de:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8064e1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8064e6:	75 0e                	jne    8064f6 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8064e8:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8064ef:	00 00 00 
+  8064f2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8064f6:	90                   	nop
+  8064f7:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8064fa:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8064fd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806501:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806504:	89 c7                	mov    %eax,%edi
+  806506:	49 89 df             	mov    %rbx,%r15
+  806509:	48 b8 1f 9e ff ff ff 	movabs $0xffffffffffff9e1f,%rax
+  806510:	ff ff ff 
+  806513:	48 01 d8             	add    %rbx,%rax
+  806516:	ff d0                	call   *%rax
+  806518:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  80651b:	74 da                	je     8064f7 <ipc_send+0x42>
+		;
+}
+  80651d:	90                   	nop
+  80651e:	90                   	nop
+  80651f:	48 83 c4 20          	add    $0x20,%rsp
+  806523:	5b                   	pop    %rbx
+  806524:	41 5f                	pop    %r15
+  806526:	5d                   	pop    %rbp
+  806527:	c3                   	ret
+
+0000000000806528 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  806528:	55                   	push   %rbp
+  806529:	48 89 e5             	mov    %rsp,%rbp
+  80652c:	41 57                	push   %r15
+  80652e:	53                   	push   %rbx
+  80652f:	48 83 ec 40          	sub    $0x40,%rsp
+  806533:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806533 <ipc_call+0xb>
+  80653a:	49 bb 05 2b 00 00 00 	movabs $0x2b05,%r11
+  806541:	00 00 00 
+  806544:	4c 01 db             	add    %r11,%rbx
+  806547:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80654a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80654d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806551:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806554:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806558:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80655c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806561:	75 0e                	jne    806571 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806563:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80656a:	00 00 00 
+  80656d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806571:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806576:	75 0e                	jne    806586 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806578:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80657f:	00 00 00 
+  806582:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806586:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806589:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80658d:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806590:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806594:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806597:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80659d:	49 89 f8             	mov    %rdi,%r8
+  8065a0:	89 c7                	mov    %eax,%edi
+  8065a2:	49 89 df             	mov    %rbx,%r15
+  8065a5:	48 b8 e2 9e ff ff ff 	movabs $0xffffffffffff9ee2,%rax
+  8065ac:	ff ff ff 
+  8065af:	48 01 d8             	add    %rbx,%rax
+  8065b2:	ff d0                	call   *%rax
+  8065b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8065b7:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8065bc:	74 2a                	je     8065e8 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8065be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065c2:	75 19                	jne    8065dd <ipc_call+0xb5>
+  8065c4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8065cb:	ff ff ff 
+  8065ce:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8065d2:	48 8b 00             	mov    (%rax),%rax
+  8065d5:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8065db:	eb 05                	jmp    8065e2 <ipc_call+0xba>
+  8065dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065e2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8065e6:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8065e8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065ec:	74 05                	je     8065f3 <ipc_call+0xcb>
+		return r;
+  8065ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065f1:	eb 17                	jmp    80660a <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8065f3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8065fa:	ff ff ff 
+  8065fd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806601:	48 8b 00             	mov    (%rax),%rax
+  806604:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80660a:	48 83 c4 40          	add    $0x40,%rsp
+  80660e:	5b                   	pop    %rbx
+  80660f:	41 5f                	pop    %r15
+  806611:	5d                   	pop    %rbp
+  806612:	c3                   	ret
+
+0000000000806613 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806613:	55                   	push   %rbp
+  806614:	48 89 e5             	mov    %rsp,%rbp
+  806617:	41 57                	push   %r15
+  806619:	53                   	push   %rbx
+  80661a:	48 83 ec 70          	sub    $0x70,%rsp
+  80661e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80661e <ipc_callw+0xb>
+  806625:	49 bb 1a 2a 00 00 00 	movabs $0x2a1a,%r11
+  80662c:	00 00 00 
+  80662f:	4c 01 db             	add    %r11,%rbx
+  806632:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806635:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806638:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  80663c:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806640:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806645:	76 0a                	jbe    806651 <ipc_callw+0x3e>
+		return -E_INVAL;
+  806647:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80664c:	e9 b7 00 00 00       	jmp    806708 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806651:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806655:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806659:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80665d:	48 89 ce             	mov    %rcx,%rsi
+  806660:	48 89 c7             	mov    %rax,%rdi
+  806663:	49 89 df             	mov    %rbx,%r15
+  806666:	48 b8 84 92 ff ff ff 	movabs $0xffffffffffff9284,%rax
+  80666d:	ff ff ff 
+  806670:	48 01 d8             	add    %rbx,%rax
+  806673:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806675:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80667c:	00 
+  80667d:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806681:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806685:	48 01 d0             	add    %rdx,%rax
+  806688:	48 83 e8 01          	sub    $0x1,%rax
+  80668c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806690:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806694:	ba 00 00 00 00       	mov    $0x0,%edx
+  806699:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80669d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066a1:	48 29 d0             	sub    %rdx,%rax
+  8066a4:	48 c1 e8 03          	shr    $0x3,%rax
+  8066a8:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  8066ac:	89 c1                	mov    %eax,%ecx
+  8066ae:	8b 75 98             	mov    -0x68(%rbp),%esi
+  8066b1:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  8066b5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8066b8:	49 89 d1             	mov    %rdx,%r9
+  8066bb:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8066c2:	00 00 00 
+  8066c5:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8066cc:	00 00 00 
+  8066cf:	89 c7                	mov    %eax,%edi
+  8066d1:	49 89 df             	mov    %rbx,%r15
+  8066d4:	48 b8 e2 9e ff ff ff 	movabs $0xffffffffffff9ee2,%rax
+  8066db:	ff ff ff 
+  8066de:	48 01 d8             	add    %rbx,%rax
+  8066e1:	ff d0                	call   *%rax
+  8066e3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8066e6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8066ea:	74 05                	je     8066f1 <ipc_callw+0xde>
+		return r;
+  8066ec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8066ef:	eb 17                	jmp    806708 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8066f1:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8066f8:	ff ff ff 
+  8066fb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8066ff:	48 8b 00             	mov    (%rax),%rax
+  806702:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806708:	48 83 c4 70          	add    $0x70,%rsp
+  80670c:	5b                   	pop    %rbx
+  80670d:	41 5f                	pop    %r15
+  80670f:	5d                   	pop    %rbp
+  806710:	c3                   	ret
+
+0000000000806711 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806711:	55                   	push   %rbp
+  806712:	48 89 e5             	mov    %rsp,%rbp
+  806715:	41 57                	push   %r15
+  806717:	53                   	push   %rbx
+  806718:	48 83 ec 40          	sub    $0x40,%rsp
+  80671c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80671c <ipc_callv+0xb>
+  806723:	49 bb 1c 29 00 00 00 	movabs $0x291c,%r11
+  80672a:	00 00 00 
+  80672d:	4c 01 db             	add    %r11,%rbx
+  806730:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806733:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806736:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80673a:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80673d:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806741:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806745:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80674c:	00 00 00 
+  80674f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806753:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806757:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80675b:	74 11                	je     80676e <ipc_callv+0x5d>
+		pg = (void *) segs;
+  80675d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806761:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806765:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806768:	c1 e0 14             	shl    $0x14,%eax
+  80676b:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  80676e:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806772:	74 14                	je     806788 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806774:	8b 45 20             	mov    0x20(%rbp),%eax
+  806777:	83 e8 01             	sub    $0x1,%eax
+  80677a:	48 63 d0             	movslq %eax,%rdx
+  80677d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806781:	48 09 d0             	or     %rdx,%rax
+  806784:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806788:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80678b:	c1 e0 10             	shl    $0x10,%eax
+  80678e:	0b 45 10             	or     0x10(%rbp),%eax
+  806791:	89 c1                	mov    %eax,%ecx
+  806793:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806796:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80679a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80679e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8067a2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8067a5:	4d 89 c1             	mov    %r8,%r9
+  8067a8:	49 89 f8             	mov    %rdi,%r8
+  8067ab:	89 c7                	mov    %eax,%edi
+  8067ad:	49 89 df             	mov    %rbx,%r15
+  8067b0:	48 b8 e2 9e ff ff ff 	movabs $0xffffffffffff9ee2,%rax
+  8067b7:	ff ff ff 
+  8067ba:	48 01 d8             	add    %rbx,%rax
+  8067bd:	ff d0                	call   *%rax
+  8067bf:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8067c2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8067c6:	74 05                	je     8067cd <ipc_callv+0xbc>
+		return r;
+  8067c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8067cb:	eb 17                	jmp    8067e4 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8067cd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8067d4:	ff ff ff 
+  8067d7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8067db:	48 8b 00             	mov    (%rax),%rax
+  8067de:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8067e4:	48 83 c4 40          	add    $0x40,%rsp
+  8067e8:	5b                   	pop    %rbx
+  8067e9:	41 5f                	pop    %r15
+  8067eb:	5d                   	pop    %rbp
+  8067ec:	c3                   	ret
+
+00000000008067ed <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8067ed:	55                   	push   %rbp
+  8067ee:	48 89 e5             	mov    %rsp,%rbp
+  8067f1:	41 57                	push   %r15
+  8067f3:	53                   	push   %rbx
+  8067f4:	48 83 ec 40          	sub    $0x40,%rsp
+  8067f8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067f8 <ipc_reply_recv+0xb>
+  8067ff:	49 bb 40 28 00 00 00 	movabs $0x2840,%r11
+  806806:	00 00 00 
+  806809:	4c 01 db             	add    %r11,%rbx
+  80680c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80680f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806812:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806816:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806819:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80681d:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806821:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806826:	75 0e                	jne    806836 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806828:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80682f:	00 00 00 
+  806832:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806836:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80683b:	75 0e                	jne    80684b <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80683d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806844:	00 00 00 
+  806847:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  80684b:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80684e:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806852:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806856:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806859:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80685d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806860:	4d 89 c1             	mov    %r8,%r9
+  806863:	49 89 f8             	mov    %rdi,%r8
+  806866:	89 c7                	mov    %eax,%edi
+  806868:	49 89 df             	mov    %rbx,%r15
+  80686b:	48 b8 56 9f ff ff ff 	movabs $0xffffffffffff9f56,%rax
+  806872:	ff ff ff 
+  806875:	48 01 d8             	add    %rbx,%rax
+  806878:	ff d0                	call   *%rax
+  80687a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  80687d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806882:	74 2a                	je     8068ae <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806884:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806888:	75 19                	jne    8068a3 <ipc_reply_recv+0xb6>
+  80688a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806891:	ff ff ff 
+  806894:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806898:	48 8b 00             	mov    (%rax),%rax
+  80689b:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8068a1:	eb 05                	jmp    8068a8 <ipc_reply_recv+0xbb>
+  8068a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8068ac:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  8068ae:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  8068b3:	74 2a                	je     8068df <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8068b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068b9:	75 19                	jne    8068d4 <ipc_reply_recv+0xe7>
+  8068bb:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8068c2:	ff ff ff 
+  8068c5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068c9:	48 8b 00             	mov    (%rax),%rax
+  8068cc:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8068d2:	eb 05                	jmp    8068d9 <ipc_reply_recv+0xec>
+  8068d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068d9:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  8068dd:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8068df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068e3:	74 05                	je     8068ea <ipc_reply_recv+0xfd>
+		return r;
+  8068e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068e8:	eb 17                	jmp    806901 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8068ea:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8068f1:	ff ff ff 
+  8068f4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068f8:	48 8b 00             	mov    (%rax),%rax
+  8068fb:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806901:	48 83 c4 40          	add    $0x40,%rsp
+  806905:	5b                   	pop    %rbx
+  806906:	41 5f                	pop    %r15
+  806908:	5d                   	pop    %rbp
+  806909:	c3                   	ret
+
+000000000080690a <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  80690a:	55                   	push   %rbp
+  80690b:	48 89 e5             	mov    %rsp,%rbp
+  80690e:	41 57                	push   %r15
+  806910:	53                   	push   %rbx
+  806911:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806918:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806918 <ipc_window_batch+0xe>
+  80691f:	49 bb 20 27 00 00 00 	movabs $0x2720,%r11
+  806926:	00 00 00 
+  806929:	4c 01 db             	add    %r11,%rbx
+  80692c:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806932:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806939:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  80693f:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806945:	e9 15 01 00 00       	jmp    806a5f <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  80694a:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806950:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806953:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  80695a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80695d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806960:	39 c2                	cmp    %eax,%edx
+  806962:	0f 4e c2             	cmovle %edx,%eax
+  806965:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806968:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80696f:	eb 6b                	jmp    8069dc <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806971:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806974:	48 98                	cltq
+  806976:	48 c1 e0 05          	shl    $0x5,%rax
+  80697a:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80697e:	48 01 e8             	add    %rbp,%rax
+  806981:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806987:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  80698d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806990:	c1 e0 0c             	shl    $0xc,%eax
+  806993:	48 63 d0             	movslq %eax,%rdx
+  806996:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  80699d:	48 01 c2             	add    %rax,%rdx
+  8069a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069a3:	48 98                	cltq
+  8069a5:	48 c1 e0 05          	shl    $0x5,%rax
+  8069a9:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8069ad:	48 01 e8             	add    %rbp,%rax
+  8069b0:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  8069b6:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  8069b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069bc:	48 98                	cltq
+  8069be:	48 c1 e0 05          	shl    $0x5,%rax
+  8069c2:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8069c6:	48 01 e8             	add    %rbp,%rax
+  8069c9:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  8069d0:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  8069d6:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  8069d8:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8069dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069df:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  8069e2:	7c 8d                	jl     806971 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  8069e4:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8069eb:	74 27                	je     806a14 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8069ed:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8069f0:	48 63 d0             	movslq %eax,%rdx
+  8069f3:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8069fa:	48 89 d6             	mov    %rdx,%rsi
+  8069fd:	48 89 c7             	mov    %rax,%rdi
+  806a00:	49 89 df             	mov    %rbx,%r15
+  806a03:	48 b8 f9 a1 ff ff ff 	movabs $0xffffffffffffa1f9,%rax
+  806a0a:	ff ff ff 
+  806a0d:	48 01 d8             	add    %rbx,%rax
+  806a10:	ff d0                	call   *%rax
+  806a12:	eb 25                	jmp    806a39 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806a14:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806a17:	48 63 d0             	movslq %eax,%rdx
+  806a1a:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806a21:	48 89 d6             	mov    %rdx,%rsi
+  806a24:	48 89 c7             	mov    %rax,%rdi
+  806a27:	49 89 df             	mov    %rbx,%r15
+  806a2a:	48 b8 57 a2 ff ff ff 	movabs $0xffffffffffffa257,%rax
+  806a31:	ff ff ff 
+  806a34:	48 01 d8             	add    %rbx,%rax
+  806a37:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806a39:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806a3c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806a40:	79 05                	jns    806a47 <ipc_window_batch+0x13d>
+			return r;
+  806a42:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a45:	eb 2a                	jmp    806a71 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806a47:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806a4a:	c1 e0 0c             	shl    $0xc,%eax
+  806a4d:	48 98                	cltq
+  806a4f:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806a56:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806a59:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806a5f:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806a66:	0f 8f de fe ff ff    	jg     80694a <ipc_window_batch+0x40>
+	}
+	return 0;
+  806a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a71:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806a78:	5b                   	pop    %rbx
+  806a79:	41 5f                	pop    %r15
+  806a7b:	5d                   	pop    %rbp
+  806a7c:	c3                   	ret
+
+0000000000806a7d <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806a7d:	55                   	push   %rbp
+  806a7e:	48 89 e5             	mov    %rsp,%rbp
+  806a81:	48 83 ec 10          	sub    $0x10,%rsp
+  806a85:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a85 <ipc_map_window+0x8>
+  806a8c:	49 bb b3 25 00 00 00 	movabs $0x25b3,%r11
+  806a93:	00 00 00 
+  806a96:	4c 01 d8             	add    %r11,%rax
+  806a99:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806a9d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806aa0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806aa3:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806aa7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806aac:	bf 01 00 00 00       	mov    $0x1,%edi
+  806ab1:	49 b8 d2 d8 ff ff ff 	movabs $0xffffffffffffd8d2,%r8
+  806ab8:	ff ff ff 
+  806abb:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806abf:	ff d0                	call   *%rax
+}
+  806ac1:	c9                   	leave
+  806ac2:	c3                   	ret
+
+0000000000806ac3 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806ac3:	55                   	push   %rbp
+  806ac4:	48 89 e5             	mov    %rsp,%rbp
+  806ac7:	48 83 ec 10          	sub    $0x10,%rsp
+  806acb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806acb <ipc_unmap_window+0x8>
+  806ad2:	49 bb 6d 25 00 00 00 	movabs $0x256d,%r11
+  806ad9:	00 00 00 
+  806adc:	4c 01 d8             	add    %r11,%rax
+  806adf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806ae3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806ae6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806ae9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806aed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806af2:	bf 00 00 00 00       	mov    $0x0,%edi
+  806af7:	49 b8 d2 d8 ff ff ff 	movabs $0xffffffffffffd8d2,%r8
+  806afe:	ff ff ff 
+  806b01:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806b05:	ff d0                	call   *%rax
+}
+  806b07:	c9                   	leave
+  806b08:	c3                   	ret
+
+0000000000806b09 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806b09:	55                   	push   %rbp
+  806b0a:	48 89 e5             	mov    %rsp,%rbp
+  806b0d:	48 83 ec 18          	sub    $0x18,%rsp
+  806b11:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806b11 <ipc_find_env+0x8>
+  806b18:	49 bb 27 25 00 00 00 	movabs $0x2527,%r11
+  806b1f:	00 00 00 
+  806b22:	4c 01 d8             	add    %r11,%rax
+  806b25:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806b28:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806b2f:	eb 57                	jmp    806b88 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806b31:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  806b38:	ff ff ff 
+  806b3b:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806b3f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806b42:	48 63 d2             	movslq %edx,%rdx
+  806b45:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806b4c:	48 01 ca             	add    %rcx,%rdx
+  806b4f:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806b56:	8b 12                	mov    (%rdx),%edx
+  806b58:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806b5b:	75 27                	jne    806b84 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806b5d:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  806b64:	ff ff ff 
+  806b67:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806b6b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806b6e:	48 98                	cltq
+  806b70:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806b77:	48 01 d0             	add    %rdx,%rax
+  806b7a:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806b80:	8b 00                	mov    (%rax),%eax
+  806b82:	eb 12                	jmp    806b96 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806b84:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806b88:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806b8f:	7e a0                	jle    806b31 <ipc_find_env+0x28>
+	}
+	return 0;
+  806b91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806b96:	c9                   	leave
+  806b97:	c3                   	ret
+
+0000000000806b98 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806b98:	55                   	push   %rbp
+  806b99:	48 89 e5             	mov    %rsp,%rbp
+  806b9c:	48 83 ec 18          	sub    $0x18,%rsp
+  806ba0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806ba0 <pageref+0x8>
+  806ba7:	49 bb 98 24 00 00 00 	movabs $0x2498,%r11
+  806bae:	00 00 00 
+  806bb1:	4c 01 d8             	add    %r11,%rax
+  806bb4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806bb8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806bbc:	48 89 d1             	mov    %rdx,%rcx
+  806bbf:	48 c1 e9 15          	shr    $0x15,%rcx
+  806bc3:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806bca:	ff ff ff 
+  806bcd:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806bd1:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806bd5:	83 e2 01             	and    $0x1,%edx
+  806bd8:	48 85 d2             	test   %rdx,%rdx
+  806bdb:	75 07                	jne    806be4 <pageref+0x4c>
+		return 0;
+  806bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  806be2:	eb 64                	jmp    806c48 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806be4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806be8:	48 89 d1             	mov    %rdx,%rcx
+  806beb:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806bef:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806bf6:	ff ff ff 
+  806bf9:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806bfd:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806c01:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806c05:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806c09:	83 e2 01             	and    $0x1,%edx
+  806c0c:	48 85 d2             	test   %rdx,%rdx
+  806c0f:	75 07                	jne    806c18 <pageref+0x80>
+		return 0;
+  806c11:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c16:	eb 30                	jmp    806c48 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806c18:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806c1c:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806c20:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806c27:	ff ff ff 
+  806c2a:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806c2e:	48 89 d0             	mov    %rdx,%rax
+  806c31:	48 01 c0             	add    %rax,%rax
+  806c34:	48 01 d0             	add    %rdx,%rax
+  806c37:	48 c1 e0 03          	shl    $0x3,%rax
+  806c3b:	48 01 c8             	add    %rcx,%rax
+  806c3e:	48 83 c0 08          	add    $0x8,%rax
+  806c42:	0f b7 00             	movzwl (%rax),%eax
+  806c45:	0f b7 c0             	movzwl %ax,%eax
+}
+  806c48:	c9                   	leave
+  806c49:	c3                   	ret
@@ -0,0 +1,10767 @@
+
+obj/user/forkbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 50 03 00 00       	call   800391 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <bench>:
+#define HEAPPAGES	1024
+#define HEAP		((char *) 0x10000000)
+
+static uint64_t
+bench(const char *name, envid_t (*forkfn)(void))
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 40          	sub    $0x40,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <bench+0xb>
+  800055:	49 bb 02 90 00 00 00 	movabs $0x9002,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  800066:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint32_t lo, hi;
+	__asm __volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  80006a:	0f 31                	rdtsc
+  80006c:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  80006f:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	return ((uint64_t) hi << 32) | lo;
+  800072:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800075:	48 c1 e0 20          	shl    $0x20,%rax
+  800079:	48 89 c2             	mov    %rax,%rdx
+  80007c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80007f:	48 09 d0             	or     %rdx,%rax
+	uint64_t start, cycles;
+	envid_t envid;
+	int i;
+
+	start = read_tsc();
+  800082:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < NFORKS; i++) {
+  800086:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80008d:	e9 8e 00 00 00       	jmp    800120 <bench+0xdd>
+		if ((envid = forkfn()) < 0)
+  800092:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800096:	ff d0                	call   *%rax
+  800098:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80009b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80009f:	79 4c                	jns    8000ed <bench+0xaa>
+			panic("%s: %e", name, envid);
+  8000a1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8000a4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8000a8:	41 89 d0             	mov    %edx,%r8d
+  8000ab:	48 89 c1             	mov    %rax,%rcx
+  8000ae:	48 b8 b8 de ff ff ff 	movabs $0xffffffffffffdeb8,%rax
+  8000b5:	ff ff ff 
+  8000b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000bc:	48 89 c2             	mov    %rax,%rdx
+  8000bf:	be 18 00 00 00       	mov    $0x18,%esi
+  8000c4:	48 b8 bf de ff ff ff 	movabs $0xffffffffffffdebf,%rax
+  8000cb:	ff ff ff 
+  8000ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000d2:	48 89 c7             	mov    %rax,%rdi
+  8000d5:	49 89 df             	mov    %rbx,%r15
+  8000d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000dd:	49 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%r9
+  8000e4:	ff ff ff 
+  8000e7:	49 01 d9             	add    %rbx,%r9
+  8000ea:	41 ff d1             	call   *%r9
+		if (envid == 0)
+  8000ed:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8000f1:	75 12                	jne    800105 <bench+0xc2>
+			exit();
+  8000f3:	49 89 df             	mov    %rbx,%r15
+  8000f6:	48 b8 01 74 ff ff ff 	movabs $0xffffffffffff7401,%rax
+  8000fd:	ff ff ff 
+  800100:	48 01 d8             	add    %rbx,%rax
+  800103:	ff d0                	call   *%rax
+		wait(envid);
+  800105:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800108:	89 c7                	mov    %eax,%edi
+  80010a:	49 89 df             	mov    %rbx,%r15
+  80010d:	48 b8 03 d0 ff ff ff 	movabs $0xffffffffffffd003,%rax
+  800114:	ff ff ff 
+  800117:	48 01 d8             	add    %rbx,%rax
+  80011a:	ff d0                	call   *%rax
+	for (i = 0; i < NFORKS; i++) {
+  80011c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  800120:	83 7d ec 63          	cmpl   $0x63,-0x14(%rbp)
+  800124:	0f 8e 68 ff ff ff    	jle    800092 <bench+0x4f>
+	__asm __volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  80012a:	0f 31                	rdtsc
+  80012c:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  80012f:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+	return ((uint64_t) hi << 32) | lo;
+  800132:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800135:	48 c1 e0 20          	shl    $0x20,%rax
+  800139:	48 89 c2             	mov    %rax,%rdx
+  80013c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80013f:	48 09 d0             	or     %rdx,%rax
+	}
+	cycles = (read_tsc() - start) / NFORKS;
+  800142:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  800146:	48 c1 e8 02          	shr    $0x2,%rax
+  80014a:	48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+  800151:	c2 f5 28 
+  800154:	48 f7 e2             	mul    %rdx
+  800157:	48 89 d0             	mov    %rdx,%rax
+  80015a:	48 c1 e8 02          	shr    $0x2,%rax
+  80015e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	cprintf("forkbench: %s: %llu cycles per fork+exit+wait\n",
+  800162:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800166:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80016a:	48 89 c6             	mov    %rax,%rsi
+  80016d:	48 b8 d0 de ff ff ff 	movabs $0xffffffffffffded0,%rax
+  800174:	ff ff ff 
+  800177:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80017b:	48 89 c7             	mov    %rax,%rdi
+  80017e:	49 89 df             	mov    %rbx,%r15
+  800181:	b8 00 00 00 00       	mov    $0x0,%eax
+  800186:	48 b9 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rcx
+  80018d:	ff ff ff 
+  800190:	48 01 d9             	add    %rbx,%rcx
+  800193:	ff d1                	call   *%rcx
+		name, cycles);
+	return cycles;
+  800195:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  800199:	48 83 c4 40          	add    $0x40,%rsp
+  80019d:	5b                   	pop    %rbx
+  80019e:	41 5f                	pop    %r15
+  8001a0:	5d                   	pop    %rbp
+  8001a1:	c3                   	ret
+
+00000000008001a2 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001a2:	55                   	push   %rbp
+  8001a3:	48 89 e5             	mov    %rsp,%rbp
+  8001a6:	41 57                	push   %r15
+  8001a8:	53                   	push   %rbx
+  8001a9:	48 83 ec 30          	sub    $0x30,%rsp
+  8001ad:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8001ad <umain+0xb>
+  8001b4:	49 bb a3 8e 00 00 00 	movabs $0x8ea3,%r11
+  8001bb:	00 00 00 
+  8001be:	4c 01 db             	add    %r11,%rbx
+  8001c1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8001c4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	uint64_t kern, user;
+	int i, r;
+
+	for (i = 0; i < HEAPPAGES; i++) {
+  8001c8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8001cf:	e9 91 00 00 00       	jmp    800265 <umain+0xc3>
+		if ((r = sys_page_alloc(0, HEAP + i * PGSIZE,
+  8001d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001d7:	c1 e0 0c             	shl    $0xc,%eax
+  8001da:	48 98                	cltq
+  8001dc:	48 05 00 00 00 10    	add    $0x10000000,%rax
+  8001e2:	ba 07 00 00 00       	mov    $0x7,%edx
+  8001e7:	48 89 c6             	mov    %rax,%rsi
+  8001ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ef:	49 89 df             	mov    %rbx,%r15
+  8001f2:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  8001f9:	ff ff ff 
+  8001fc:	48 01 d8             	add    %rbx,%rax
+  8001ff:	ff d0                	call   *%rax
+  800201:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  800204:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800208:	79 44                	jns    80024e <umain+0xac>
+					PTE_P|PTE_U|PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+  80020a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80020d:	89 c1                	mov    %eax,%ecx
+  80020f:	48 b8 ff de ff ff ff 	movabs $0xffffffffffffdeff,%rax
+  800216:	ff ff ff 
+  800219:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80021d:	48 89 c2             	mov    %rax,%rdx
+  800220:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800225:	48 b8 bf de ff ff ff 	movabs $0xffffffffffffdebf,%rax
+  80022c:	ff ff ff 
+  80022f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800233:	48 89 c7             	mov    %rax,%rdi
+  800236:	49 89 df             	mov    %rbx,%r15
+  800239:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023e:	49 b8 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%r8
+  800245:	ff ff ff 
+  800248:	49 01 d8             	add    %rbx,%r8
+  80024b:	41 ff d0             	call   *%r8
+		HEAP[i * PGSIZE] = i;
+  80024e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800251:	c1 e0 0c             	shl    $0xc,%eax
+  800254:	48 98                	cltq
+  800256:	48 05 00 00 00 10    	add    $0x10000000,%rax
+  80025c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80025f:	88 10                	mov    %dl,(%rax)
+	for (i = 0; i < HEAPPAGES; i++) {
+  800261:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  800265:	81 7d ec ff 03 00 00 	cmpl   $0x3ff,-0x14(%rbp)
+  80026c:	0f 8e 62 ff ff ff    	jle    8001d4 <umain+0x32>
+	}
+
+	user = bench("ufork", ufork);
+  800272:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  800279:	ff ff ff 
+  80027c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800280:	48 89 c6             	mov    %rax,%rsi
+  800283:	48 b8 12 df ff ff ff 	movabs $0xffffffffffffdf12,%rax
+  80028a:	ff ff ff 
+  80028d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800291:	48 89 c7             	mov    %rax,%rdi
+  800294:	48 b8 f3 6f ff ff ff 	movabs $0xffffffffffff6ff3,%rax
+  80029b:	ff ff ff 
+  80029e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002a2:	ff d0                	call   *%rax
+  8002a4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	kern = bench("fork", fork);
+  8002a8:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8002af:	ff ff ff 
+  8002b2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002b6:	48 89 c6             	mov    %rax,%rsi
+  8002b9:	48 b8 18 df ff ff ff 	movabs $0xffffffffffffdf18,%rax
+  8002c0:	ff ff ff 
+  8002c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002c7:	48 89 c7             	mov    %rax,%rdi
+  8002ca:	48 b8 f3 6f ff ff ff 	movabs $0xffffffffffff6ff3,%rax
+  8002d1:	ff ff ff 
+  8002d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002d8:	ff d0                	call   *%rax
+  8002da:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	if (kern > 0)
+  8002de:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8002e3:	0f 84 9e 00 00 00    	je     800387 <umain+0x1e5>
+		cprintf("forkbench: fork is %llu.%02llux faster\n",
+			user / kern, user * 100 / kern % 100);
+  8002e9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8002ed:	48 89 d0             	mov    %rdx,%rax
+  8002f0:	48 c1 e0 02          	shl    $0x2,%rax
+  8002f4:	48 01 d0             	add    %rdx,%rax
+  8002f7:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8002fe:	00 
+  8002ff:	48 01 d0             	add    %rdx,%rax
+  800302:	48 c1 e0 02          	shl    $0x2,%rax
+  800306:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030b:	48 f7 75 d8          	divq   -0x28(%rbp)
+  80030f:	48 89 c6             	mov    %rax,%rsi
+		cprintf("forkbench: fork is %llu.%02llux faster\n",
+  800312:	48 89 f0             	mov    %rsi,%rax
+  800315:	48 c1 e8 02          	shr    $0x2,%rax
+  800319:	48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+  800320:	c2 f5 28 
+  800323:	48 f7 e2             	mul    %rdx
+  800326:	48 89 d1             	mov    %rdx,%rcx
+  800329:	48 c1 e9 02          	shr    $0x2,%rcx
+  80032d:	48 89 c8             	mov    %rcx,%rax
+  800330:	48 c1 e0 02          	shl    $0x2,%rax
+  800334:	48 01 c8             	add    %rcx,%rax
+  800337:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80033e:	00 
+  80033f:	48 01 d0             	add    %rdx,%rax
+  800342:	48 c1 e0 02          	shl    $0x2,%rax
+  800346:	48 29 c6             	sub    %rax,%rsi
+  800349:	48 89 f1             	mov    %rsi,%rcx
+  80034c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800350:	ba 00 00 00 00       	mov    $0x0,%edx
+  800355:	48 f7 75 d8          	divq   -0x28(%rbp)
+  800359:	48 89 ca             	mov    %rcx,%rdx
+  80035c:	48 89 c6             	mov    %rax,%rsi
+  80035f:	48 b8 20 df ff ff ff 	movabs $0xffffffffffffdf20,%rax
+  800366:	ff ff ff 
+  800369:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80036d:	48 89 c7             	mov    %rax,%rdi
+  800370:	49 89 df             	mov    %rbx,%r15
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	48 b9 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rcx
+  80037f:	ff ff ff 
+  800382:	48 01 d9             	add    %rbx,%rcx
+  800385:	ff d1                	call   *%rcx
+}
+  800387:	90                   	nop
+  800388:	48 83 c4 30          	add    $0x30,%rsp
+  80038c:	5b                   	pop    %rbx
+  80038d:	41 5f                	pop    %r15
+  80038f:	5d                   	pop    %rbp
+  800390:	c3                   	ret
+
+0000000000800391 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800391:	55                   	push   %rbp
+  800392:	48 89 e5             	mov    %rsp,%rbp
+  800395:	41 57                	push   %r15
+  800397:	53                   	push   %rbx
+  800398:	48 83 ec 20          	sub    $0x20,%rsp
+  80039c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80039c <libmain+0xb>
+  8003a3:	49 bb b4 8c 00 00 00 	movabs $0x8cb4,%r11
+  8003aa:	00 00 00 
+  8003ad:	4c 01 db             	add    %r11,%rbx
+  8003b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8003b3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8003b7:	49 89 df             	mov    %rbx,%r15
+  8003ba:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  8003c1:	ff ff ff 
+  8003c4:	48 01 d8             	add    %rbx,%rax
+  8003c7:	ff d0                	call   *%rax
+  8003c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8003cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003d4:	48 98                	cltq
+  8003d6:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8003dd:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8003e4:	ff ff ff 
+  8003e7:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8003eb:	48 01 c2             	add    %rax,%rdx
+  8003ee:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  8003f5:	00 00 00 
+  8003f8:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003fc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800400:	7e 15                	jle    800417 <libmain+0x86>
+		binaryname = argv[0];
+  800402:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800406:	48 8b 00             	mov    (%rax),%rax
+  800409:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  800410:	00 00 00 
+  800413:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800417:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80041b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80041e:	48 89 d6             	mov    %rdx,%rsi
+  800421:	89 c7                	mov    %eax,%edi
+  800423:	49 89 df             	mov    %rbx,%r15
+  800426:	48 b8 52 71 ff ff ff 	movabs $0xffffffffffff7152,%rax
+  80042d:	ff ff ff 
+  800430:	48 01 d8             	add    %rbx,%rax
+  800433:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800435:	49 89 df             	mov    %rbx,%r15
+  800438:	48 b8 01 74 ff ff ff 	movabs $0xffffffffffff7401,%rax
+  80043f:	ff ff ff 
+  800442:	48 01 d8             	add    %rbx,%rax
+  800445:	ff d0                	call   *%rax
+}
+  800447:	90                   	nop
+  800448:	48 83 c4 20          	add    $0x20,%rsp
+  80044c:	5b                   	pop    %rbx
+  80044d:	41 5f                	pop    %r15
+  80044f:	5d                   	pop    %rbp
+  800450:	c3                   	ret
+
+0000000000800451 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800451:	55                   	push   %rbp
+  800452:	48 89 e5             	mov    %rsp,%rbp
+  800455:	41 57                	push   %r15
+  800457:	53                   	push   %rbx
+  800458:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800458 <exit+0x7>
+  80045f:	49 bb f8 8b 00 00 00 	movabs $0x8bf8,%r11
+  800466:	00 00 00 
+  800469:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80046c:	49 89 df             	mov    %rbx,%r15
+  80046f:	48 b8 00 a9 ff ff ff 	movabs $0xffffffffffffa900,%rax
+  800476:	ff ff ff 
+  800479:	48 01 d8             	add    %rbx,%rax
+  80047c:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80047e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800483:	49 89 df             	mov    %rbx,%r15
+  800486:	48 b8 9b 90 ff ff ff 	movabs $0xffffffffffff909b,%rax
+  80048d:	ff ff ff 
+  800490:	48 01 d8             	add    %rbx,%rax
+  800493:	ff d0                	call   *%rax
+}
+  800495:	90                   	nop
+  800496:	5b                   	pop    %rbx
+  800497:	41 5f                	pop    %r15
+  800499:	5d                   	pop    %rbp
+  80049a:	c3                   	ret
+
+000000000080049b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80049b:	55                   	push   %rbp
+  80049c:	48 89 e5             	mov    %rsp,%rbp
+  80049f:	41 57                	push   %r15
+  8004a1:	41 54                	push   %r12
+  8004a3:	53                   	push   %rbx
+  8004a4:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8004ab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004ab <_panic+0x10>
+  8004b2:	49 bb a5 8b 00 00 00 	movabs $0x8ba5,%r11
+  8004b9:	00 00 00 
+  8004bc:	4c 01 db             	add    %r11,%rbx
+  8004bf:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004c6:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8004cc:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8004d3:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8004da:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8004e1:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8004e8:	84 c0                	test   %al,%al
+  8004ea:	74 26                	je     800512 <_panic+0x77>
+  8004ec:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8004f3:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8004fa:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8004fe:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800502:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800506:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80050a:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80050e:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800512:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800519:	00 00 00 
+  80051c:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800523:	00 00 00 
+  800526:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80052a:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800531:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800538:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80053f:	48 b8 b0 ff ff ff ff 	movabs $0xffffffffffffffb0,%rax
+  800546:	ff ff ff 
+  800549:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80054d:	4c 8b 20             	mov    (%rax),%r12
+  800550:	49 89 df             	mov    %rbx,%r15
+  800553:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  80055a:	ff ff ff 
+  80055d:	48 01 d8             	add    %rbx,%rax
+  800560:	ff d0                	call   *%rax
+  800562:	89 c6                	mov    %eax,%esi
+  800564:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80056a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800571:	41 89 d0             	mov    %edx,%r8d
+  800574:	48 89 c1             	mov    %rax,%rcx
+  800577:	4c 89 e2             	mov    %r12,%rdx
+  80057a:	48 b8 58 df ff ff ff 	movabs $0xffffffffffffdf58,%rax
+  800581:	ff ff ff 
+  800584:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800588:	48 89 c7             	mov    %rax,%rdi
+  80058b:	49 89 df             	mov    %rbx,%r15
+  80058e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800593:	49 b9 22 77 ff ff ff 	movabs $0xffffffffffff7722,%r9
+  80059a:	ff ff ff 
+  80059d:	49 01 d9             	add    %rbx,%r9
+  8005a0:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005a3:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8005aa:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8005b1:	48 89 d6             	mov    %rdx,%rsi
+  8005b4:	48 89 c7             	mov    %rax,%rdi
+  8005b7:	49 89 df             	mov    %rbx,%r15
+  8005ba:	48 b8 42 76 ff ff ff 	movabs $0xffffffffffff7642,%rax
+  8005c1:	ff ff ff 
+  8005c4:	48 01 d8             	add    %rbx,%rax
+  8005c7:	ff d0                	call   *%rax
+	cprintf("\n");
+  8005c9:	48 b8 7b df ff ff ff 	movabs $0xffffffffffffdf7b,%rax
+  8005d0:	ff ff ff 
+  8005d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005d7:	48 89 c7             	mov    %rax,%rdi
+  8005da:	49 89 df             	mov    %rbx,%r15
+  8005dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e2:	48 ba 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rdx
+  8005e9:	ff ff ff 
+  8005ec:	48 01 da             	add    %rbx,%rdx
+  8005ef:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8005f1:	cc                   	int3
+  8005f2:	eb fd                	jmp    8005f1 <_panic+0x156>
+
+00000000008005f4 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8005f4:	55                   	push   %rbp
+  8005f5:	48 89 e5             	mov    %rsp,%rbp
+  8005f8:	41 57                	push   %r15
+  8005fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8005fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005fe <putch+0xa>
+  800605:	49 bb 52 8a 00 00 00 	movabs $0x8a52,%r11
+  80060c:	00 00 00 
+  80060f:	4c 01 d8             	add    %r11,%rax
+  800612:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800615:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800619:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80061d:	8b 12                	mov    (%rdx),%edx
+  80061f:	8d 72 01             	lea    0x1(%rdx),%esi
+  800622:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800626:	89 31                	mov    %esi,(%rcx)
+  800628:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80062b:	89 ce                	mov    %ecx,%esi
+  80062d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800631:	48 63 d2             	movslq %edx,%rdx
+  800634:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800639:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80063d:	8b 12                	mov    (%rdx),%edx
+  80063f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800645:	75 33                	jne    80067a <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800647:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80064b:	8b 12                	mov    (%rdx),%edx
+  80064d:	48 63 d2             	movslq %edx,%rdx
+  800650:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800654:	48 83 c1 08          	add    $0x8,%rcx
+  800658:	48 89 d6             	mov    %rdx,%rsi
+  80065b:	48 89 cf             	mov    %rcx,%rdi
+  80065e:	49 89 c7             	mov    %rax,%r15
+  800661:	48 ba e8 8f ff ff ff 	movabs $0xffffffffffff8fe8,%rdx
+  800668:	ff ff ff 
+  80066b:	48 01 c2             	add    %rax,%rdx
+  80066e:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800670:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800674:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80067a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80067e:	8b 40 04             	mov    0x4(%rax),%eax
+  800681:	8d 50 01             	lea    0x1(%rax),%edx
+  800684:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800688:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80068b:	90                   	nop
+  80068c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800690:	c9                   	leave
+  800691:	c3                   	ret
+
+0000000000800692 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800692:	55                   	push   %rbp
+  800693:	48 89 e5             	mov    %rsp,%rbp
+  800696:	41 57                	push   %r15
+  800698:	53                   	push   %rbx
+  800699:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8006a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006a0 <vcprintf+0xe>
+  8006a7:	49 bb b0 89 00 00 00 	movabs $0x89b0,%r11
+  8006ae:	00 00 00 
+  8006b1:	4c 01 db             	add    %r11,%rbx
+  8006b4:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8006bb:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8006c2:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006c9:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8006d0:	48 8b 06             	mov    (%rsi),%rax
+  8006d3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006d7:	48 89 01             	mov    %rax,(%rcx)
+  8006da:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006de:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006e2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8006e6:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8006ed:	00 00 00 
+    b.cnt = 0;
+  8006f0:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8006f7:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8006fa:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800701:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800708:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80070f:	48 89 c6             	mov    %rax,%rsi
+  800712:	48 b8 a4 75 ff ff ff 	movabs $0xffffffffffff75a4,%rax
+  800719:	ff ff ff 
+  80071c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800720:	48 89 c7             	mov    %rax,%rdi
+  800723:	49 89 df             	mov    %rbx,%r15
+  800726:	48 b8 66 7b ff ff ff 	movabs $0xffffffffffff7b66,%rax
+  80072d:	ff ff ff 
+  800730:	48 01 d8             	add    %rbx,%rax
+  800733:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800735:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80073b:	48 98                	cltq
+  80073d:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800744:	48 83 c2 08          	add    $0x8,%rdx
+  800748:	48 89 c6             	mov    %rax,%rsi
+  80074b:	48 89 d7             	mov    %rdx,%rdi
+  80074e:	49 89 df             	mov    %rbx,%r15
+  800751:	48 b8 e8 8f ff ff ff 	movabs $0xffffffffffff8fe8,%rax
+  800758:	ff ff ff 
+  80075b:	48 01 d8             	add    %rbx,%rax
+  80075e:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800760:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800766:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80076d:	5b                   	pop    %rbx
+  80076e:	41 5f                	pop    %r15
+  800770:	5d                   	pop    %rbp
+  800771:	c3                   	ret
+
+0000000000800772 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800772:	55                   	push   %rbp
+  800773:	48 89 e5             	mov    %rsp,%rbp
+  800776:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80077d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80077d <cprintf+0xb>
+  800784:	49 bb d3 88 00 00 00 	movabs $0x88d3,%r11
+  80078b:	00 00 00 
+  80078e:	4d 01 da             	add    %r11,%r10
+  800791:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800798:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80079f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8007a6:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8007ad:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8007b4:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8007bb:	84 c0                	test   %al,%al
+  8007bd:	74 20                	je     8007df <cprintf+0x6d>
+  8007bf:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8007c3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8007c7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8007cb:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8007cf:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8007d3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8007d7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8007db:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8007df:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8007e6:	00 00 00 
+  8007e9:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8007f0:	00 00 00 
+  8007f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007f7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8007fe:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800805:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  80080c:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800813:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80081a:	48 8b 06             	mov    (%rsi),%rax
+  80081d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800821:	48 89 01             	mov    %rax,(%rcx)
+  800824:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800828:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80082c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800830:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800837:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80083e:	48 89 d6             	mov    %rdx,%rsi
+  800841:	48 89 c7             	mov    %rax,%rdi
+  800844:	48 b8 42 76 ff ff ff 	movabs $0xffffffffffff7642,%rax
+  80084b:	ff ff ff 
+  80084e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800852:	ff d0                	call   *%rax
+  800854:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80085a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800860:	c9                   	leave
+  800861:	c3                   	ret
+
+0000000000800862 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800862:	55                   	push   %rbp
+  800863:	48 89 e5             	mov    %rsp,%rbp
+  800866:	53                   	push   %rbx
+  800867:	48 83 ec 38          	sub    $0x38,%rsp
+  80086b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80086b <printnum+0x9>
+  800872:	49 bb e5 87 00 00 00 	movabs $0x87e5,%r11
+  800879:	00 00 00 
+  80087c:	4c 01 db             	add    %r11,%rbx
+  80087f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800883:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800887:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80088b:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80088e:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800892:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800896:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800899:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80089d:	72 58                	jb     8008f7 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80089f:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8008a2:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8008a5:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8008a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008b1:	48 f7 f6             	div    %rsi
+  8008b4:	49 89 c2             	mov    %rax,%r10
+  8008b7:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8008ba:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8008bd:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8008c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008c5:	41 89 c9             	mov    %ecx,%r9d
+  8008c8:	41 89 f8             	mov    %edi,%r8d
+  8008cb:	89 d1                	mov    %edx,%ecx
+  8008cd:	4c 89 d2             	mov    %r10,%rdx
+  8008d0:	48 89 c7             	mov    %rax,%rdi
+  8008d3:	48 b8 12 78 ff ff ff 	movabs $0xffffffffffff7812,%rax
+  8008da:	ff ff ff 
+  8008dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008e1:	ff d0                	call   *%rax
+  8008e3:	eb 1c                	jmp    800901 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8008e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008e9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8008ec:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8008f0:	48 89 d6             	mov    %rdx,%rsi
+  8008f3:	89 c7                	mov    %eax,%edi
+  8008f5:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8008f7:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8008fb:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8008ff:	7f e4                	jg     8008e5 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800901:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800904:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800908:	ba 00 00 00 00       	mov    $0x0,%edx
+  80090d:	48 f7 f1             	div    %rcx
+  800910:	48 b8 b7 e0 ff ff ff 	movabs $0xffffffffffffe0b7,%rax
+  800917:	ff ff ff 
+  80091a:	48 01 d8             	add    %rbx,%rax
+  80091d:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800921:	0f be c0             	movsbl %al,%eax
+  800924:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800928:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80092c:	48 89 d6             	mov    %rdx,%rsi
+  80092f:	89 c7                	mov    %eax,%edi
+  800931:	ff d1                	call   *%rcx
+}
+  800933:	90                   	nop
+  800934:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800938:	c9                   	leave
+  800939:	c3                   	ret
+
+000000000080093a <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80093a:	55                   	push   %rbp
+  80093b:	48 89 e5             	mov    %rsp,%rbp
+  80093e:	48 83 ec 20          	sub    $0x20,%rsp
+  800942:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800942 <getuint+0x8>
+  800949:	49 bb 0e 87 00 00 00 	movabs $0x870e,%r11
+  800950:	00 00 00 
+  800953:	4c 01 d8             	add    %r11,%rax
+  800956:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80095a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80095d:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800961:	7e 4f                	jle    8009b2 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800963:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800967:	8b 00                	mov    (%rax),%eax
+  800969:	83 f8 2f             	cmp    $0x2f,%eax
+  80096c:	77 24                	ja     800992 <getuint+0x58>
+  80096e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800972:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800976:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80097a:	8b 00                	mov    (%rax),%eax
+  80097c:	89 c0                	mov    %eax,%eax
+  80097e:	48 01 d0             	add    %rdx,%rax
+  800981:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800985:	8b 12                	mov    (%rdx),%edx
+  800987:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80098a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80098e:	89 0a                	mov    %ecx,(%rdx)
+  800990:	eb 14                	jmp    8009a6 <getuint+0x6c>
+  800992:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800996:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80099a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80099e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009a2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009a6:	48 8b 00             	mov    (%rax),%rax
+  8009a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009ad:	e9 9d 00 00 00       	jmp    800a4f <getuint+0x115>
+	else if (lflag)
+  8009b2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8009b6:	74 4c                	je     800a04 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8009b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009bc:	8b 00                	mov    (%rax),%eax
+  8009be:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c1:	77 24                	ja     8009e7 <getuint+0xad>
+  8009c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009cf:	8b 00                	mov    (%rax),%eax
+  8009d1:	89 c0                	mov    %eax,%eax
+  8009d3:	48 01 d0             	add    %rdx,%rax
+  8009d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009da:	8b 12                	mov    (%rdx),%edx
+  8009dc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009e3:	89 0a                	mov    %ecx,(%rdx)
+  8009e5:	eb 14                	jmp    8009fb <getuint+0xc1>
+  8009e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009eb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009ef:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009f3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009f7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009fb:	48 8b 00             	mov    (%rax),%rax
+  8009fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a02:	eb 4b                	jmp    800a4f <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800a04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a08:	8b 00                	mov    (%rax),%eax
+  800a0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0d:	77 24                	ja     800a33 <getuint+0xf9>
+  800a0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a13:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a1b:	8b 00                	mov    (%rax),%eax
+  800a1d:	89 c0                	mov    %eax,%eax
+  800a1f:	48 01 d0             	add    %rdx,%rax
+  800a22:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a26:	8b 12                	mov    (%rdx),%edx
+  800a28:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a2b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a2f:	89 0a                	mov    %ecx,(%rdx)
+  800a31:	eb 14                	jmp    800a47 <getuint+0x10d>
+  800a33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a37:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a3b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a3f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a43:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a47:	8b 00                	mov    (%rax),%eax
+  800a49:	89 c0                	mov    %eax,%eax
+  800a4b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a53:	c9                   	leave
+  800a54:	c3                   	ret
+
+0000000000800a55 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800a55:	55                   	push   %rbp
+  800a56:	48 89 e5             	mov    %rsp,%rbp
+  800a59:	48 83 ec 20          	sub    $0x20,%rsp
+  800a5d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a5d <printfloat+0x8>
+  800a64:	49 bb f3 85 00 00 00 	movabs $0x85f3,%r11
+  800a6b:	00 00 00 
+  800a6e:	4c 01 d8             	add    %r11,%rax
+  800a71:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a75:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a79:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800a7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a81:	48 85 c0             	test   %rax,%rax
+  800a84:	79 12                	jns    800a98 <printfloat+0x43>
+		putch('-',putdat);
+  800a86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a8e:	48 89 c6             	mov    %rax,%rsi
+  800a91:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a96:	ff d2                	call   *%rdx
+	
+}
+  800a98:	90                   	nop
+  800a99:	c9                   	leave
+  800a9a:	c3                   	ret
+
+0000000000800a9b <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800a9b:	55                   	push   %rbp
+  800a9c:	48 89 e5             	mov    %rsp,%rbp
+  800a9f:	48 83 ec 20          	sub    $0x20,%rsp
+  800aa3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800aa3 <getint+0x8>
+  800aaa:	49 bb ad 85 00 00 00 	movabs $0x85ad,%r11
+  800ab1:	00 00 00 
+  800ab4:	4c 01 d8             	add    %r11,%rax
+  800ab7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800abb:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800abe:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800ac2:	7e 4f                	jle    800b13 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800ac4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ac8:	8b 00                	mov    (%rax),%eax
+  800aca:	83 f8 2f             	cmp    $0x2f,%eax
+  800acd:	77 24                	ja     800af3 <getint+0x58>
+  800acf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ad7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800adb:	8b 00                	mov    (%rax),%eax
+  800add:	89 c0                	mov    %eax,%eax
+  800adf:	48 01 d0             	add    %rdx,%rax
+  800ae2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ae6:	8b 12                	mov    (%rdx),%edx
+  800ae8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800aeb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aef:	89 0a                	mov    %ecx,(%rdx)
+  800af1:	eb 14                	jmp    800b07 <getint+0x6c>
+  800af3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800afb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800aff:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b03:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b07:	48 8b 00             	mov    (%rax),%rax
+  800b0a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b0e:	e9 9d 00 00 00       	jmp    800bb0 <getint+0x115>
+	else if (lflag)
+  800b13:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800b17:	74 4c                	je     800b65 <getint+0xca>
+		x=va_arg(*ap, long);
+  800b19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b1d:	8b 00                	mov    (%rax),%eax
+  800b1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b22:	77 24                	ja     800b48 <getint+0xad>
+  800b24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b28:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b30:	8b 00                	mov    (%rax),%eax
+  800b32:	89 c0                	mov    %eax,%eax
+  800b34:	48 01 d0             	add    %rdx,%rax
+  800b37:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b3b:	8b 12                	mov    (%rdx),%edx
+  800b3d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b40:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b44:	89 0a                	mov    %ecx,(%rdx)
+  800b46:	eb 14                	jmp    800b5c <getint+0xc1>
+  800b48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b50:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b54:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b58:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b5c:	48 8b 00             	mov    (%rax),%rax
+  800b5f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b63:	eb 4b                	jmp    800bb0 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800b65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b69:	8b 00                	mov    (%rax),%eax
+  800b6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6e:	77 24                	ja     800b94 <getint+0xf9>
+  800b70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b74:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b7c:	8b 00                	mov    (%rax),%eax
+  800b7e:	89 c0                	mov    %eax,%eax
+  800b80:	48 01 d0             	add    %rdx,%rax
+  800b83:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b87:	8b 12                	mov    (%rdx),%edx
+  800b89:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b8c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b90:	89 0a                	mov    %ecx,(%rdx)
+  800b92:	eb 14                	jmp    800ba8 <getint+0x10d>
+  800b94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b98:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b9c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ba0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ba4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ba8:	8b 00                	mov    (%rax),%eax
+  800baa:	48 98                	cltq
+  800bac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800bb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800bb4:	c9                   	leave
+  800bb5:	c3                   	ret
+
+0000000000800bb6 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800bb6:	55                   	push   %rbp
+  800bb7:	48 89 e5             	mov    %rsp,%rbp
+  800bba:	41 57                	push   %r15
+  800bbc:	41 55                	push   %r13
+  800bbe:	41 54                	push   %r12
+  800bc0:	53                   	push   %rbx
+  800bc1:	48 83 ec 60          	sub    $0x60,%rsp
+  800bc5:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800bc5 <vprintfmt+0xf>
+  800bcc:	49 bb 8b 84 00 00 00 	movabs $0x848b,%r11
+  800bd3:	00 00 00 
+  800bd6:	4d 01 dc             	add    %r11,%r12
+  800bd9:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800bdd:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800be1:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800be5:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800be9:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800bf0:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800bf4:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800bf8:	48 8b 06             	mov    (%rsi),%rax
+  800bfb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800bff:	48 89 01             	mov    %rax,(%rcx)
+  800c02:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800c06:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800c0a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c0e:	eb 17                	jmp    800c27 <vprintfmt+0x71>
+			if (ch == '\0')
+  800c10:	85 db                	test   %ebx,%ebx
+  800c12:	0f 84 97 05 00 00    	je     8011af <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800c18:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c1c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c20:	48 89 c6             	mov    %rax,%rsi
+  800c23:	89 df                	mov    %ebx,%edi
+  800c25:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c27:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c2b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c2f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c33:	0f b6 00             	movzbl (%rax),%eax
+  800c36:	0f b6 d8             	movzbl %al,%ebx
+  800c39:	83 fb 25             	cmp    $0x25,%ebx
+  800c3c:	75 d2                	jne    800c10 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800c3e:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800c42:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800c49:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800c50:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800c57:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800c5e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c62:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c66:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c6a:	0f b6 00             	movzbl (%rax),%eax
+  800c6d:	0f b6 d8             	movzbl %al,%ebx
+  800c70:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c73:	83 f8 55             	cmp    $0x55,%eax
+  800c76:	0f 87 00 05 00 00    	ja     80117c <vprintfmt+0x5c6>
+  800c7c:	89 c0                	mov    %eax,%eax
+  800c7e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c85:	00 
+  800c86:	48 8d 05 a3 64 00 00 	lea    0x64a3(%rip),%rax        # 807130 <.LC18+0xc>
+  800c8d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800c91:	48 8d 15 98 64 00 00 	lea    0x6498(%rip),%rdx        # 807130 <.LC18+0xc>
+  800c98:	48 01 d0             	add    %rdx,%rax
+  800c9b:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800c9d:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800ca1:	eb bb                	jmp    800c5e <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800ca3:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800ca7:	eb b5                	jmp    800c5e <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800ca9:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800cb0:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800cb3:	89 d0                	mov    %edx,%eax
+  800cb5:	c1 e0 02             	shl    $0x2,%eax
+  800cb8:	01 d0                	add    %edx,%eax
+  800cba:	01 c0                	add    %eax,%eax
+  800cbc:	01 d8                	add    %ebx,%eax
+  800cbe:	83 e8 30             	sub    $0x30,%eax
+  800cc1:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800cc4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800cc8:	0f b6 00             	movzbl (%rax),%eax
+  800ccb:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800cce:	83 fb 2f             	cmp    $0x2f,%ebx
+  800cd1:	7e 60                	jle    800d33 <vprintfmt+0x17d>
+  800cd3:	83 fb 39             	cmp    $0x39,%ebx
+  800cd6:	7f 5b                	jg     800d33 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800cd8:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800cdd:	eb d1                	jmp    800cb0 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800cdf:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ce2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce5:	77 17                	ja     800cfe <vprintfmt+0x148>
+  800ce7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ceb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cee:	89 d2                	mov    %edx,%edx
+  800cf0:	48 01 d0             	add    %rdx,%rax
+  800cf3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cf6:	83 c2 08             	add    $0x8,%edx
+  800cf9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cfc:	eb 0c                	jmp    800d0a <vprintfmt+0x154>
+  800cfe:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d02:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d06:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d0a:	8b 00                	mov    (%rax),%eax
+  800d0c:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800d0f:	eb 23                	jmp    800d34 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800d11:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d15:	0f 89 43 ff ff ff    	jns    800c5e <vprintfmt+0xa8>
+				width = 0;
+  800d1b:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800d22:	e9 37 ff ff ff       	jmp    800c5e <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800d27:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800d2e:	e9 2b ff ff ff       	jmp    800c5e <vprintfmt+0xa8>
+			goto process_precision;
+  800d33:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800d34:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d38:	0f 89 20 ff ff ff    	jns    800c5e <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800d3e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d41:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800d44:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800d4b:	e9 0e ff ff ff       	jmp    800c5e <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800d50:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800d54:	e9 05 ff ff ff       	jmp    800c5e <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800d59:	83 fb 39             	cmp    $0x39,%ebx
+  800d5c:	7f 0b                	jg     800d69 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800d5e:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800d61:	c1 e0 08             	shl    $0x8,%eax
+  800d64:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d67:	eb 21                	jmp    800d8a <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800d69:	83 fb 60             	cmp    $0x60,%ebx
+  800d6c:	7e 10                	jle    800d7e <vprintfmt+0x1c8>
+  800d6e:	83 fb 66             	cmp    $0x66,%ebx
+  800d71:	7f 0b                	jg     800d7e <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800d73:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800d76:	c1 e0 08             	shl    $0x8,%eax
+  800d79:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d7c:	eb 0c                	jmp    800d8a <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800d7e:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800d85:	e9 04 01 00 00       	jmp    800e8e <vprintfmt+0x2d8>
+  800d8a:	e9 ff 00 00 00       	jmp    800e8e <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800d8f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d92:	83 f8 2f             	cmp    $0x2f,%eax
+  800d95:	77 17                	ja     800dae <vprintfmt+0x1f8>
+  800d97:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d9b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d9e:	89 d2                	mov    %edx,%edx
+  800da0:	48 01 d0             	add    %rdx,%rax
+  800da3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800da6:	83 c2 08             	add    $0x8,%edx
+  800da9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800dac:	eb 0c                	jmp    800dba <vprintfmt+0x204>
+  800dae:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800db2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800db6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800dba:	8b 00                	mov    (%rax),%eax
+  800dbc:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800dc0:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800dc4:	48 89 d6             	mov    %rdx,%rsi
+  800dc7:	89 c7                	mov    %eax,%edi
+  800dc9:	ff d1                	call   *%rcx
+			break;
+  800dcb:	e9 da 03 00 00       	jmp    8011aa <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800dd0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800dd3:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd6:	77 17                	ja     800def <vprintfmt+0x239>
+  800dd8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ddc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ddf:	89 d2                	mov    %edx,%edx
+  800de1:	48 01 d0             	add    %rdx,%rax
+  800de4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800de7:	83 c2 08             	add    $0x8,%edx
+  800dea:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ded:	eb 0c                	jmp    800dfb <vprintfmt+0x245>
+  800def:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800df3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800df7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800dfb:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800dfd:	85 db                	test   %ebx,%ebx
+  800dff:	79 02                	jns    800e03 <vprintfmt+0x24d>
+				err = -err;
+  800e01:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800e03:	83 fb 15             	cmp    $0x15,%ebx
+  800e06:	7f 19                	jg     800e21 <vprintfmt+0x26b>
+  800e08:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800e0f:	00 00 00 
+  800e12:	48 63 c3             	movslq %ebx,%rax
+  800e15:	4c 01 e2             	add    %r12,%rdx
+  800e18:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800e1c:	4d 85 ed             	test   %r13,%r13
+  800e1f:	75 36                	jne    800e57 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800e21:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e25:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e29:	89 d9                	mov    %ebx,%ecx
+  800e2b:	48 ba c8 e0 ff ff ff 	movabs $0xffffffffffffe0c8,%rdx
+  800e32:	ff ff ff 
+  800e35:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e39:	48 89 c7             	mov    %rax,%rdi
+  800e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e41:	49 b8 6d 81 ff ff ff 	movabs $0xffffffffffff816d,%r8
+  800e48:	ff ff ff 
+  800e4b:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e4f:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800e52:	e9 53 03 00 00       	jmp    8011aa <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800e57:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e5b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e5f:	4c 89 e9             	mov    %r13,%rcx
+  800e62:	48 ba d1 e0 ff ff ff 	movabs $0xffffffffffffe0d1,%rdx
+  800e69:	ff ff ff 
+  800e6c:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e70:	48 89 c7             	mov    %rax,%rdi
+  800e73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e78:	49 b8 6d 81 ff ff ff 	movabs $0xffffffffffff816d,%r8
+  800e7f:	ff ff ff 
+  800e82:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e86:	41 ff d0             	call   *%r8
+			break;
+  800e89:	e9 1c 03 00 00       	jmp    8011aa <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800e8e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e91:	83 f8 2f             	cmp    $0x2f,%eax
+  800e94:	77 17                	ja     800ead <vprintfmt+0x2f7>
+  800e96:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e9a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e9d:	89 d2                	mov    %edx,%edx
+  800e9f:	48 01 d0             	add    %rdx,%rax
+  800ea2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ea5:	83 c2 08             	add    $0x8,%edx
+  800ea8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800eab:	eb 0c                	jmp    800eb9 <vprintfmt+0x303>
+  800ead:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800eb1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800eb5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800eb9:	4c 8b 28             	mov    (%rax),%r13
+  800ebc:	4d 85 ed             	test   %r13,%r13
+  800ebf:	75 0e                	jne    800ecf <vprintfmt+0x319>
+				p = "(null)";
+  800ec1:	48 b8 d4 e0 ff ff ff 	movabs $0xffffffffffffe0d4,%rax
+  800ec8:	ff ff ff 
+  800ecb:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800ecf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ed3:	0f 8e 84 00 00 00    	jle    800f5d <vprintfmt+0x3a7>
+  800ed9:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800edd:	74 7e                	je     800f5d <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800edf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ee2:	48 98                	cltq
+  800ee4:	48 89 c6             	mov    %rax,%rsi
+  800ee7:	4c 89 ef             	mov    %r13,%rdi
+  800eea:	4d 89 e7             	mov    %r12,%r15
+  800eed:	48 b8 92 84 ff ff ff 	movabs $0xffffffffffff8492,%rax
+  800ef4:	ff ff ff 
+  800ef7:	4c 01 e0             	add    %r12,%rax
+  800efa:	ff d0                	call   *%rax
+  800efc:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800eff:	eb 17                	jmp    800f18 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800f01:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800f05:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800f09:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800f0d:	48 89 d6             	mov    %rdx,%rsi
+  800f10:	89 c7                	mov    %eax,%edi
+  800f12:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f14:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f18:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f1c:	7f e3                	jg     800f01 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f1e:	eb 3d                	jmp    800f5d <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800f20:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800f24:	74 1e                	je     800f44 <vprintfmt+0x38e>
+  800f26:	83 fb 1f             	cmp    $0x1f,%ebx
+  800f29:	7e 05                	jle    800f30 <vprintfmt+0x37a>
+  800f2b:	83 fb 7e             	cmp    $0x7e,%ebx
+  800f2e:	7e 14                	jle    800f44 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800f30:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f34:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f38:	48 89 c6             	mov    %rax,%rsi
+  800f3b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800f40:	ff d2                	call   *%rdx
+  800f42:	eb 15                	jmp    800f59 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800f44:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800f47:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800f4a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f4e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f52:	48 89 c6             	mov    %rax,%rsi
+  800f55:	89 cf                	mov    %ecx,%edi
+  800f57:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f59:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f5d:	4c 89 e8             	mov    %r13,%rax
+  800f60:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800f64:	0f b6 00             	movzbl (%rax),%eax
+  800f67:	0f be d8             	movsbl %al,%ebx
+  800f6a:	85 db                	test   %ebx,%ebx
+  800f6c:	74 28                	je     800f96 <vprintfmt+0x3e0>
+  800f6e:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f72:	78 ac                	js     800f20 <vprintfmt+0x36a>
+  800f74:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800f78:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f7c:	79 a2                	jns    800f20 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800f7e:	eb 16                	jmp    800f96 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800f80:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f84:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f88:	48 89 c6             	mov    %rax,%rsi
+  800f8b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f90:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800f92:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f96:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f9a:	7f e4                	jg     800f80 <vprintfmt+0x3ca>
+			break;
+  800f9c:	e9 09 02 00 00       	jmp    8011aa <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800fa1:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800fa5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fa9:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800fad:	0f b6 00             	movzbl (%rax),%eax
+  800fb0:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800fb3:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800fb4:	83 fb 2f             	cmp    $0x2f,%ebx
+  800fb7:	0f 8e ac fd ff ff    	jle    800d69 <vprintfmt+0x1b3>
+  800fbd:	e9 97 fd ff ff       	jmp    800d59 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800fc2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fc6:	be 03 00 00 00       	mov    $0x3,%esi
+  800fcb:	48 89 c7             	mov    %rax,%rdi
+  800fce:	48 b8 4b 7a ff ff ff 	movabs $0xffffffffffff7a4b,%rax
+  800fd5:	ff ff ff 
+  800fd8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fdc:	ff d0                	call   *%rax
+  800fde:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800fe2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fe6:	48 85 c0             	test   %rax,%rax
+  800fe9:	79 1d                	jns    801008 <vprintfmt+0x452>
+				putch('-', putdat);
+  800feb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fef:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ff3:	48 89 c6             	mov    %rax,%rsi
+  800ff6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ffb:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800ffd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801001:	48 f7 d8             	neg    %rax
+  801004:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  801008:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80100f:	e9 de 00 00 00       	jmp    8010f2 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801014:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801018:	be 03 00 00 00       	mov    $0x3,%esi
+  80101d:	48 89 c7             	mov    %rax,%rdi
+  801020:	48 b8 ea 78 ff ff ff 	movabs $0xffffffffffff78ea,%rax
+  801027:	ff ff ff 
+  80102a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80102e:	ff d0                	call   *%rax
+  801030:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801034:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80103b:	e9 b2 00 00 00       	jmp    8010f2 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801040:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801044:	be 03 00 00 00       	mov    $0x3,%esi
+  801049:	48 89 c7             	mov    %rax,%rdi
+  80104c:	48 b8 ea 78 ff ff ff 	movabs $0xffffffffffff78ea,%rax
+  801053:	ff ff ff 
+  801056:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80105a:	ff d0                	call   *%rax
+  80105c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801060:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801067:	e9 86 00 00 00       	jmp    8010f2 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80106c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801070:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801074:	48 89 c6             	mov    %rax,%rsi
+  801077:	bf 30 00 00 00       	mov    $0x30,%edi
+  80107c:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80107e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801082:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801086:	48 89 c6             	mov    %rax,%rsi
+  801089:	bf 78 00 00 00       	mov    $0x78,%edi
+  80108e:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801090:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801093:	83 f8 2f             	cmp    $0x2f,%eax
+  801096:	77 17                	ja     8010af <vprintfmt+0x4f9>
+  801098:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80109c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80109f:	89 d2                	mov    %edx,%edx
+  8010a1:	48 01 d0             	add    %rdx,%rax
+  8010a4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010a7:	83 c2 08             	add    $0x8,%edx
+  8010aa:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8010ad:	eb 0c                	jmp    8010bb <vprintfmt+0x505>
+  8010af:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8010b3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8010b7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8010bb:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8010be:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010c2:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8010c9:	eb 27                	jmp    8010f2 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8010cb:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010cf:	be 03 00 00 00       	mov    $0x3,%esi
+  8010d4:	48 89 c7             	mov    %rax,%rdi
+  8010d7:	48 b8 ea 78 ff ff ff 	movabs $0xffffffffffff78ea,%rax
+  8010de:	ff ff ff 
+  8010e1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010e5:	ff d0                	call   *%rax
+  8010e7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010eb:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8010f2:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8010f7:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8010fa:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8010fd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801101:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801105:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801109:	45 89 c1             	mov    %r8d,%r9d
+  80110c:	41 89 f8             	mov    %edi,%r8d
+  80110f:	48 89 c7             	mov    %rax,%rdi
+  801112:	48 b8 12 78 ff ff ff 	movabs $0xffffffffffff7812,%rax
+  801119:	ff ff ff 
+  80111c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801120:	ff d0                	call   *%rax
+			break;
+  801122:	e9 83 00 00 00       	jmp    8011aa <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801127:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80112b:	be 03 00 00 00       	mov    $0x3,%esi
+  801130:	48 89 c7             	mov    %rax,%rdi
+  801133:	48 b8 ea 78 ff ff ff 	movabs $0xffffffffffff78ea,%rax
+  80113a:	ff ff ff 
+  80113d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801141:	ff d0                	call   *%rax
+  801143:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801147:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80114b:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80114f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801153:	48 89 ce             	mov    %rcx,%rsi
+  801156:	48 89 c7             	mov    %rax,%rdi
+  801159:	48 b8 05 7a ff ff ff 	movabs $0xffffffffffff7a05,%rax
+  801160:	ff ff ff 
+  801163:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801167:	ff d0                	call   *%rax
+	
+			break;
+  801169:	eb 3f                	jmp    8011aa <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80116b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80116f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801173:	48 89 c6             	mov    %rax,%rsi
+  801176:	89 df                	mov    %ebx,%edi
+  801178:	ff d2                	call   *%rdx
+			break;
+  80117a:	eb 2e                	jmp    8011aa <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80117c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801180:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801184:	48 89 c6             	mov    %rax,%rsi
+  801187:	bf 25 00 00 00       	mov    $0x25,%edi
+  80118c:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80118e:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801193:	eb 05                	jmp    80119a <vprintfmt+0x5e4>
+  801195:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80119a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80119e:	48 83 e8 01          	sub    $0x1,%rax
+  8011a2:	0f b6 00             	movzbl (%rax),%eax
+  8011a5:	3c 25                	cmp    $0x25,%al
+  8011a7:	75 ec                	jne    801195 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8011a9:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8011aa:	e9 78 fa ff ff       	jmp    800c27 <vprintfmt+0x71>
+				return;
+  8011af:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8011b0:	48 83 c4 60          	add    $0x60,%rsp
+  8011b4:	5b                   	pop    %rbx
+  8011b5:	41 5c                	pop    %r12
+  8011b7:	41 5d                	pop    %r13
+  8011b9:	41 5f                	pop    %r15
+  8011bb:	5d                   	pop    %rbp
+  8011bc:	c3                   	ret
+
+00000000008011bd <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8011bd:	55                   	push   %rbp
+  8011be:	48 89 e5             	mov    %rsp,%rbp
+  8011c1:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8011c8:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8011c8 <printfmt+0xb>
+  8011cf:	49 bb 88 7e 00 00 00 	movabs $0x7e88,%r11
+  8011d6:	00 00 00 
+  8011d9:	4d 01 da             	add    %r11,%r10
+  8011dc:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8011e3:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8011ea:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8011f1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8011f8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8011ff:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801206:	84 c0                	test   %al,%al
+  801208:	74 20                	je     80122a <printfmt+0x6d>
+  80120a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80120e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801212:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801216:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80121a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80121e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801222:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801226:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80122a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801231:	00 00 00 
+  801234:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80123b:	00 00 00 
+  80123e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801242:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801249:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801250:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801257:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80125e:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801265:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80126c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801273:	48 89 c7             	mov    %rax,%rdi
+  801276:	48 b8 66 7b ff ff ff 	movabs $0xffffffffffff7b66,%rax
+  80127d:	ff ff ff 
+  801280:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801284:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801286:	90                   	nop
+  801287:	c9                   	leave
+  801288:	c3                   	ret
+
+0000000000801289 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801289:	55                   	push   %rbp
+  80128a:	48 89 e5             	mov    %rsp,%rbp
+  80128d:	48 83 ec 10          	sub    $0x10,%rsp
+  801291:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801291 <sprintputch+0x8>
+  801298:	49 bb bf 7d 00 00 00 	movabs $0x7dbf,%r11
+  80129f:	00 00 00 
+  8012a2:	4c 01 d8             	add    %r11,%rax
+  8012a5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8012a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8012ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012b0:	8b 40 10             	mov    0x10(%rax),%eax
+  8012b3:	8d 50 01             	lea    0x1(%rax),%edx
+  8012b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012ba:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8012bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012c1:	48 8b 10             	mov    (%rax),%rdx
+  8012c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012c8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012cc:	48 39 c2             	cmp    %rax,%rdx
+  8012cf:	73 17                	jae    8012e8 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8012d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012d5:	48 8b 00             	mov    (%rax),%rax
+  8012d8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012dc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012e0:	48 89 0a             	mov    %rcx,(%rdx)
+  8012e3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8012e6:	88 10                	mov    %dl,(%rax)
+}
+  8012e8:	90                   	nop
+  8012e9:	c9                   	leave
+  8012ea:	c3                   	ret
+
+00000000008012eb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8012eb:	55                   	push   %rbp
+  8012ec:	48 89 e5             	mov    %rsp,%rbp
+  8012ef:	53                   	push   %rbx
+  8012f0:	48 83 ec 58          	sub    $0x58,%rsp
+  8012f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012f4 <vsnprintf+0x9>
+  8012fb:	49 bb 5c 7d 00 00 00 	movabs $0x7d5c,%r11
+  801302:	00 00 00 
+  801305:	4c 01 d8             	add    %r11,%rax
+  801308:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80130c:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80130f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801313:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801317:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80131b:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80131f:	48 8b 0e             	mov    (%rsi),%rcx
+  801322:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801326:	48 89 0a             	mov    %rcx,(%rdx)
+  801329:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80132d:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801331:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801335:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801339:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80133d:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801340:	48 63 d2             	movslq %edx,%rdx
+  801343:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801347:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80134b:	48 01 ca             	add    %rcx,%rdx
+  80134e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801352:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801359:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80135e:	74 06                	je     801366 <vsnprintf+0x7b>
+  801360:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801364:	7f 07                	jg     80136d <vsnprintf+0x82>
+		return -E_INVAL;
+  801366:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80136b:	eb 34                	jmp    8013a1 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80136d:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801371:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801375:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801379:	48 bf 39 82 ff ff ff 	movabs $0xffffffffffff8239,%rdi
+  801380:	ff ff ff 
+  801383:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801387:	49 b8 66 7b ff ff ff 	movabs $0xffffffffffff7b66,%r8
+  80138e:	ff ff ff 
+  801391:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801395:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801397:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80139b:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80139e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8013a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a5:	c9                   	leave
+  8013a6:	c3                   	ret
+
+00000000008013a7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8013a7:	55                   	push   %rbp
+  8013a8:	48 89 e5             	mov    %rsp,%rbp
+  8013ab:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8013b2:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8013b2 <snprintf+0xb>
+  8013b9:	49 bb 9e 7c 00 00 00 	movabs $0x7c9e,%r11
+  8013c0:	00 00 00 
+  8013c3:	4d 01 da             	add    %r11,%r10
+  8013c6:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8013cd:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8013d3:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8013da:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8013e1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8013e8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8013ef:	84 c0                	test   %al,%al
+  8013f1:	74 20                	je     801413 <snprintf+0x6c>
+  8013f3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8013f7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8013fb:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8013ff:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801403:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801407:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80140b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80140f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801413:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80141a:	00 00 00 
+  80141d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801424:	00 00 00 
+  801427:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80142b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801432:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801439:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801440:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801447:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80144e:	48 8b 06             	mov    (%rsi),%rax
+  801451:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801455:	48 89 01             	mov    %rax,(%rcx)
+  801458:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80145c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801460:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801464:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80146b:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801472:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801478:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80147f:	48 89 c7             	mov    %rax,%rdi
+  801482:	48 b8 9b 82 ff ff ff 	movabs $0xffffffffffff829b,%rax
+  801489:	ff ff ff 
+  80148c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801490:	ff d0                	call   *%rax
+  801492:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801498:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80149e:	c9                   	leave
+  80149f:	c3                   	ret
+
+00000000008014a0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8014a0:	55                   	push   %rbp
+  8014a1:	48 89 e5             	mov    %rsp,%rbp
+  8014a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8014a8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014a8 <strlen+0x8>
+  8014af:	49 bb a8 7b 00 00 00 	movabs $0x7ba8,%r11
+  8014b6:	00 00 00 
+  8014b9:	4c 01 d8             	add    %r11,%rax
+  8014bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8014c0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014c7:	eb 09                	jmp    8014d2 <strlen+0x32>
+		n++;
+  8014c9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8014cd:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d6:	0f b6 00             	movzbl (%rax),%eax
+  8014d9:	84 c0                	test   %al,%al
+  8014db:	75 ec                	jne    8014c9 <strlen+0x29>
+	return n;
+  8014dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+
+00000000008014e2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8014e2:	55                   	push   %rbp
+  8014e3:	48 89 e5             	mov    %rsp,%rbp
+  8014e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8014ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014ea <strnlen+0x8>
+  8014f1:	49 bb 66 7b 00 00 00 	movabs $0x7b66,%r11
+  8014f8:	00 00 00 
+  8014fb:	4c 01 d8             	add    %r11,%rax
+  8014fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801502:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801506:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80150d:	eb 0e                	jmp    80151d <strnlen+0x3b>
+		n++;
+  80150f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801513:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801518:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80151d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801522:	74 0b                	je     80152f <strnlen+0x4d>
+  801524:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801528:	0f b6 00             	movzbl (%rax),%eax
+  80152b:	84 c0                	test   %al,%al
+  80152d:	75 e0                	jne    80150f <strnlen+0x2d>
+	return n;
+  80152f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801532:	c9                   	leave
+  801533:	c3                   	ret
+
+0000000000801534 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801534:	55                   	push   %rbp
+  801535:	48 89 e5             	mov    %rsp,%rbp
+  801538:	48 83 ec 20          	sub    $0x20,%rsp
+  80153c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80153c <strcpy+0x8>
+  801543:	49 bb 14 7b 00 00 00 	movabs $0x7b14,%r11
+  80154a:	00 00 00 
+  80154d:	4c 01 d8             	add    %r11,%rax
+  801550:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801554:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801558:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80155c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801560:	90                   	nop
+  801561:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801565:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801569:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80156d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801571:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801579:	0f b6 12             	movzbl (%rdx),%edx
+  80157c:	88 10                	mov    %dl,(%rax)
+  80157e:	0f b6 00             	movzbl (%rax),%eax
+  801581:	84 c0                	test   %al,%al
+  801583:	75 dc                	jne    801561 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801585:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801589:	c9                   	leave
+  80158a:	c3                   	ret
+
+000000000080158b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80158b:	55                   	push   %rbp
+  80158c:	48 89 e5             	mov    %rsp,%rbp
+  80158f:	53                   	push   %rbx
+  801590:	48 83 ec 20          	sub    $0x20,%rsp
+  801594:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801594 <strcat+0x9>
+  80159b:	49 bb bc 7a 00 00 00 	movabs $0x7abc,%r11
+  8015a2:	00 00 00 
+  8015a5:	4c 01 db             	add    %r11,%rbx
+  8015a8:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8015ac:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8015b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b4:	48 89 c7             	mov    %rax,%rdi
+  8015b7:	48 b8 50 84 ff ff ff 	movabs $0xffffffffffff8450,%rax
+  8015be:	ff ff ff 
+  8015c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015c5:	ff d0                	call   *%rax
+  8015c7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8015ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015cd:	48 63 d0             	movslq %eax,%rdx
+  8015d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015d4:	48 01 c2             	add    %rax,%rdx
+  8015d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015db:	48 89 c6             	mov    %rax,%rsi
+  8015de:	48 89 d7             	mov    %rdx,%rdi
+  8015e1:	48 b8 e4 84 ff ff ff 	movabs $0xffffffffffff84e4,%rax
+  8015e8:	ff ff ff 
+  8015eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015ef:	ff d0                	call   *%rax
+	return dst;
+  8015f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8015f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+
+00000000008015fb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8015fb:	55                   	push   %rbp
+  8015fc:	48 89 e5             	mov    %rsp,%rbp
+  8015ff:	48 83 ec 28          	sub    $0x28,%rsp
+  801603:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801603 <strncpy+0x8>
+  80160a:	49 bb 4d 7a 00 00 00 	movabs $0x7a4d,%r11
+  801611:	00 00 00 
+  801614:	4c 01 d8             	add    %r11,%rax
+  801617:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80161b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80161f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801623:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801627:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80162b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801632:	00 
+  801633:	eb 2a                	jmp    80165f <strncpy+0x64>
+		*dst++ = *src;
+  801635:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801639:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80163d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801641:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801645:	0f b6 12             	movzbl (%rdx),%edx
+  801648:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80164a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80164e:	0f b6 00             	movzbl (%rax),%eax
+  801651:	84 c0                	test   %al,%al
+  801653:	74 05                	je     80165a <strncpy+0x5f>
+			src++;
+  801655:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80165a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80165f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801663:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801667:	72 cc                	jb     801635 <strncpy+0x3a>
+	}
+	return ret;
+  801669:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80166d:	c9                   	leave
+  80166e:	c3                   	ret
+
+000000000080166f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80166f:	55                   	push   %rbp
+  801670:	48 89 e5             	mov    %rsp,%rbp
+  801673:	48 83 ec 28          	sub    $0x28,%rsp
+  801677:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801677 <strlcpy+0x8>
+  80167e:	49 bb d9 79 00 00 00 	movabs $0x79d9,%r11
+  801685:	00 00 00 
+  801688:	4c 01 d8             	add    %r11,%rax
+  80168b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80168f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801693:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801697:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80169b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80169f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016a4:	74 3d                	je     8016e3 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8016a6:	eb 1d                	jmp    8016c5 <strlcpy+0x56>
+			*dst++ = *src++;
+  8016a8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016ac:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016b0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016b8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016bc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016c0:	0f b6 12             	movzbl (%rdx),%edx
+  8016c3:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8016c5:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016ca:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016cf:	74 0b                	je     8016dc <strlcpy+0x6d>
+  8016d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016d5:	0f b6 00             	movzbl (%rax),%eax
+  8016d8:	84 c0                	test   %al,%al
+  8016da:	75 cc                	jne    8016a8 <strlcpy+0x39>
+		*dst = '\0';
+  8016dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e0:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8016e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e7:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+
+00000000008016ed <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8016ed:	55                   	push   %rbp
+  8016ee:	48 89 e5             	mov    %rsp,%rbp
+  8016f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8016f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016f5 <strcmp+0x8>
+  8016fc:	49 bb 5b 79 00 00 00 	movabs $0x795b,%r11
+  801703:	00 00 00 
+  801706:	4c 01 d8             	add    %r11,%rax
+  801709:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80170d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801711:	eb 0a                	jmp    80171d <strcmp+0x30>
+		p++, q++;
+  801713:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801718:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80171d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801721:	0f b6 00             	movzbl (%rax),%eax
+  801724:	84 c0                	test   %al,%al
+  801726:	74 12                	je     80173a <strcmp+0x4d>
+  801728:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172c:	0f b6 10             	movzbl (%rax),%edx
+  80172f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801733:	0f b6 00             	movzbl (%rax),%eax
+  801736:	38 c2                	cmp    %al,%dl
+  801738:	74 d9                	je     801713 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80173a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80173e:	0f b6 00             	movzbl (%rax),%eax
+  801741:	0f b6 d0             	movzbl %al,%edx
+  801744:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801748:	0f b6 00             	movzbl (%rax),%eax
+  80174b:	0f b6 c0             	movzbl %al,%eax
+  80174e:	29 c2                	sub    %eax,%edx
+  801750:	89 d0                	mov    %edx,%eax
+}
+  801752:	c9                   	leave
+  801753:	c3                   	ret
+
+0000000000801754 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801754:	55                   	push   %rbp
+  801755:	48 89 e5             	mov    %rsp,%rbp
+  801758:	48 83 ec 18          	sub    $0x18,%rsp
+  80175c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80175c <strncmp+0x8>
+  801763:	49 bb f4 78 00 00 00 	movabs $0x78f4,%r11
+  80176a:	00 00 00 
+  80176d:	4c 01 d8             	add    %r11,%rax
+  801770:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801774:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801778:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80177c:	eb 0f                	jmp    80178d <strncmp+0x39>
+		n--, p++, q++;
+  80177e:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801783:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801788:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80178d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801792:	74 1d                	je     8017b1 <strncmp+0x5d>
+  801794:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801798:	0f b6 00             	movzbl (%rax),%eax
+  80179b:	84 c0                	test   %al,%al
+  80179d:	74 12                	je     8017b1 <strncmp+0x5d>
+  80179f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017a3:	0f b6 10             	movzbl (%rax),%edx
+  8017a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017aa:	0f b6 00             	movzbl (%rax),%eax
+  8017ad:	38 c2                	cmp    %al,%dl
+  8017af:	74 cd                	je     80177e <strncmp+0x2a>
+	if (n == 0)
+  8017b1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8017b6:	75 07                	jne    8017bf <strncmp+0x6b>
+		return 0;
+  8017b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017bd:	eb 16                	jmp    8017d5 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8017bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c3:	0f b6 00             	movzbl (%rax),%eax
+  8017c6:	0f b6 d0             	movzbl %al,%edx
+  8017c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017cd:	0f b6 00             	movzbl (%rax),%eax
+  8017d0:	0f b6 c0             	movzbl %al,%eax
+  8017d3:	29 c2                	sub    %eax,%edx
+}
+  8017d5:	89 d0                	mov    %edx,%eax
+  8017d7:	c9                   	leave
+  8017d8:	c3                   	ret
+
+00000000008017d9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8017d9:	55                   	push   %rbp
+  8017da:	48 89 e5             	mov    %rsp,%rbp
+  8017dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8017e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e1 <strchr+0x8>
+  8017e8:	49 bb 6f 78 00 00 00 	movabs $0x786f,%r11
+  8017ef:	00 00 00 
+  8017f2:	4c 01 d8             	add    %r11,%rax
+  8017f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017f9:	89 f0                	mov    %esi,%eax
+  8017fb:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8017fe:	eb 17                	jmp    801817 <strchr+0x3e>
+		if (*s == c)
+  801800:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801804:	0f b6 00             	movzbl (%rax),%eax
+  801807:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80180a:	75 06                	jne    801812 <strchr+0x39>
+			return (char *) s;
+  80180c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801810:	eb 15                	jmp    801827 <strchr+0x4e>
+	for (; *s; s++)
+  801812:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801817:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181b:	0f b6 00             	movzbl (%rax),%eax
+  80181e:	84 c0                	test   %al,%al
+  801820:	75 de                	jne    801800 <strchr+0x27>
+	return 0;
+  801822:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801827:	c9                   	leave
+  801828:	c3                   	ret
+
+0000000000801829 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801829:	55                   	push   %rbp
+  80182a:	48 89 e5             	mov    %rsp,%rbp
+  80182d:	48 83 ec 10          	sub    $0x10,%rsp
+  801831:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801831 <strfind+0x8>
+  801838:	49 bb 1f 78 00 00 00 	movabs $0x781f,%r11
+  80183f:	00 00 00 
+  801842:	4c 01 d8             	add    %r11,%rax
+  801845:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801849:	89 f0                	mov    %esi,%eax
+  80184b:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80184e:	eb 11                	jmp    801861 <strfind+0x38>
+		if (*s == c)
+  801850:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801854:	0f b6 00             	movzbl (%rax),%eax
+  801857:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80185a:	74 12                	je     80186e <strfind+0x45>
+	for (; *s; s++)
+  80185c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801861:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801865:	0f b6 00             	movzbl (%rax),%eax
+  801868:	84 c0                	test   %al,%al
+  80186a:	75 e4                	jne    801850 <strfind+0x27>
+  80186c:	eb 01                	jmp    80186f <strfind+0x46>
+			break;
+  80186e:	90                   	nop
+	return (char *) s;
+  80186f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801873:	c9                   	leave
+  801874:	c3                   	ret
+
+0000000000801875 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801875:	55                   	push   %rbp
+  801876:	48 89 e5             	mov    %rsp,%rbp
+  801879:	48 83 ec 18          	sub    $0x18,%rsp
+  80187d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80187d <memset+0x8>
+  801884:	49 bb d3 77 00 00 00 	movabs $0x77d3,%r11
+  80188b:	00 00 00 
+  80188e:	4c 01 d8             	add    %r11,%rax
+  801891:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801895:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801898:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80189c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018a1:	75 06                	jne    8018a9 <memset+0x34>
+		return v;
+  8018a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a7:	eb 69                	jmp    801912 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8018a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ad:	83 e0 03             	and    $0x3,%eax
+  8018b0:	48 85 c0             	test   %rax,%rax
+  8018b3:	75 48                	jne    8018fd <memset+0x88>
+  8018b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b9:	83 e0 03             	and    $0x3,%eax
+  8018bc:	48 85 c0             	test   %rax,%rax
+  8018bf:	75 3c                	jne    8018fd <memset+0x88>
+		c &= 0xFF;
+  8018c1:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8018c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018cb:	c1 e0 18             	shl    $0x18,%eax
+  8018ce:	89 c2                	mov    %eax,%edx
+  8018d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d3:	c1 e0 10             	shl    $0x10,%eax
+  8018d6:	09 c2                	or     %eax,%edx
+  8018d8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018db:	c1 e0 08             	shl    $0x8,%eax
+  8018de:	09 d0                	or     %edx,%eax
+  8018e0:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8018e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018e7:	48 c1 e8 02          	shr    $0x2,%rax
+  8018eb:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8018ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018f2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018f5:	48 89 d7             	mov    %rdx,%rdi
+  8018f8:	fc                   	cld
+  8018f9:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8018fb:	eb 11                	jmp    80190e <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8018fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801901:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801904:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801908:	48 89 d7             	mov    %rdx,%rdi
+  80190b:	fc                   	cld
+  80190c:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  80190e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801912:	c9                   	leave
+  801913:	c3                   	ret
+
+0000000000801914 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801914:	55                   	push   %rbp
+  801915:	48 89 e5             	mov    %rsp,%rbp
+  801918:	48 83 ec 28          	sub    $0x28,%rsp
+  80191c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80191c <memmove+0x8>
+  801923:	49 bb 34 77 00 00 00 	movabs $0x7734,%r11
+  80192a:	00 00 00 
+  80192d:	4c 01 d8             	add    %r11,%rax
+  801930:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801934:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801938:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80193c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801940:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801944:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801948:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80194c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801950:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801954:	0f 83 88 00 00 00    	jae    8019e2 <memmove+0xce>
+  80195a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80195e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801962:	48 01 d0             	add    %rdx,%rax
+  801965:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801969:	73 77                	jae    8019e2 <memmove+0xce>
+		s += n;
+  80196b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80196f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801973:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801977:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80197b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80197f:	83 e0 03             	and    $0x3,%eax
+  801982:	48 85 c0             	test   %rax,%rax
+  801985:	75 3b                	jne    8019c2 <memmove+0xae>
+  801987:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80198b:	83 e0 03             	and    $0x3,%eax
+  80198e:	48 85 c0             	test   %rax,%rax
+  801991:	75 2f                	jne    8019c2 <memmove+0xae>
+  801993:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801997:	83 e0 03             	and    $0x3,%eax
+  80199a:	48 85 c0             	test   %rax,%rax
+  80199d:	75 23                	jne    8019c2 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80199f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a3:	48 83 e8 04          	sub    $0x4,%rax
+  8019a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019ab:	48 83 ea 04          	sub    $0x4,%rdx
+  8019af:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8019b3:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8019b7:	48 89 c7             	mov    %rax,%rdi
+  8019ba:	48 89 d6             	mov    %rdx,%rsi
+  8019bd:	fd                   	std
+  8019be:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8019c0:	eb 1d                	jmp    8019df <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8019c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019ce:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8019d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d6:	48 89 d7             	mov    %rdx,%rdi
+  8019d9:	48 89 c1             	mov    %rax,%rcx
+  8019dc:	fd                   	std
+  8019dd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8019df:	fc                   	cld
+  8019e0:	eb 57                	jmp    801a39 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8019e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019e6:	83 e0 03             	and    $0x3,%eax
+  8019e9:	48 85 c0             	test   %rax,%rax
+  8019ec:	75 36                	jne    801a24 <memmove+0x110>
+  8019ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019f2:	83 e0 03             	and    $0x3,%eax
+  8019f5:	48 85 c0             	test   %rax,%rax
+  8019f8:	75 2a                	jne    801a24 <memmove+0x110>
+  8019fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019fe:	83 e0 03             	and    $0x3,%eax
+  801a01:	48 85 c0             	test   %rax,%rax
+  801a04:	75 1e                	jne    801a24 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801a06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a0a:	48 c1 e8 02          	shr    $0x2,%rax
+  801a0e:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801a11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a15:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a19:	48 89 c7             	mov    %rax,%rdi
+  801a1c:	48 89 d6             	mov    %rdx,%rsi
+  801a1f:	fc                   	cld
+  801a20:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a22:	eb 15                	jmp    801a39 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801a24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a28:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a2c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a30:	48 89 c7             	mov    %rax,%rdi
+  801a33:	48 89 d6             	mov    %rdx,%rsi
+  801a36:	fc                   	cld
+  801a37:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801a39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a3d:	c9                   	leave
+  801a3e:	c3                   	ret
+
+0000000000801a3f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801a3f:	55                   	push   %rbp
+  801a40:	48 89 e5             	mov    %rsp,%rbp
+  801a43:	48 83 ec 18          	sub    $0x18,%rsp
+  801a47:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a47 <memcpy+0x8>
+  801a4e:	49 bb 09 76 00 00 00 	movabs $0x7609,%r11
+  801a55:	00 00 00 
+  801a58:	4c 01 d8             	add    %r11,%rax
+  801a5b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a5f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a63:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801a67:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a6b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801a6f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a73:	48 89 cf             	mov    %rcx,%rdi
+  801a76:	48 b9 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rcx
+  801a7d:	ff ff ff 
+  801a80:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801a84:	ff d0                	call   *%rax
+}
+  801a86:	c9                   	leave
+  801a87:	c3                   	ret
+
+0000000000801a88 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801a88:	55                   	push   %rbp
+  801a89:	48 89 e5             	mov    %rsp,%rbp
+  801a8c:	48 83 ec 28          	sub    $0x28,%rsp
+  801a90:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a90 <memcmp+0x8>
+  801a97:	49 bb c0 75 00 00 00 	movabs $0x75c0,%r11
+  801a9e:	00 00 00 
+  801aa1:	4c 01 d8             	add    %r11,%rax
+  801aa4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aa8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801aac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801ab0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ab4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801ab8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801abc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801ac0:	eb 34                	jmp    801af6 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801ac2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac6:	0f b6 10             	movzbl (%rax),%edx
+  801ac9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801acd:	0f b6 00             	movzbl (%rax),%eax
+  801ad0:	38 c2                	cmp    %al,%dl
+  801ad2:	74 18                	je     801aec <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801ad4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ad8:	0f b6 00             	movzbl (%rax),%eax
+  801adb:	0f b6 d0             	movzbl %al,%edx
+  801ade:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ae2:	0f b6 00             	movzbl (%rax),%eax
+  801ae5:	0f b6 c0             	movzbl %al,%eax
+  801ae8:	29 c2                	sub    %eax,%edx
+  801aea:	eb 20                	jmp    801b0c <memcmp+0x84>
+		s1++, s2++;
+  801aec:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801af1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801af6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801afa:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801afe:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801b02:	48 85 c0             	test   %rax,%rax
+  801b05:	75 bb                	jne    801ac2 <memcmp+0x3a>
+	}
+
+	return 0;
+  801b07:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801b0c:	89 d0                	mov    %edx,%eax
+  801b0e:	c9                   	leave
+  801b0f:	c3                   	ret
+
+0000000000801b10 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801b10:	55                   	push   %rbp
+  801b11:	48 89 e5             	mov    %rsp,%rbp
+  801b14:	48 83 ec 28          	sub    $0x28,%rsp
+  801b18:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b18 <memfind+0x8>
+  801b1f:	49 bb 38 75 00 00 00 	movabs $0x7538,%r11
+  801b26:	00 00 00 
+  801b29:	4c 01 d8             	add    %r11,%rax
+  801b2c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b30:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801b33:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801b37:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b3f:	48 01 d0             	add    %rdx,%rax
+  801b42:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801b46:	eb 13                	jmp    801b5b <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801b48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b4c:	0f b6 00             	movzbl (%rax),%eax
+  801b4f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801b52:	38 d0                	cmp    %dl,%al
+  801b54:	74 11                	je     801b67 <memfind+0x57>
+	for (; s < ends; s++)
+  801b56:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801b5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b5f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b63:	72 e3                	jb     801b48 <memfind+0x38>
+  801b65:	eb 01                	jmp    801b68 <memfind+0x58>
+			break;
+  801b67:	90                   	nop
+	return (void *) s;
+  801b68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b6c:	c9                   	leave
+  801b6d:	c3                   	ret
+
+0000000000801b6e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801b6e:	55                   	push   %rbp
+  801b6f:	48 89 e5             	mov    %rsp,%rbp
+  801b72:	48 83 ec 38          	sub    $0x38,%rsp
+  801b76:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b76 <strtol+0x8>
+  801b7d:	49 bb da 74 00 00 00 	movabs $0x74da,%r11
+  801b84:	00 00 00 
+  801b87:	4c 01 d8             	add    %r11,%rax
+  801b8a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b8e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b92:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801b95:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b9c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801ba3:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801ba4:	eb 05                	jmp    801bab <strtol+0x3d>
+		s++;
+  801ba6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801bab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801baf:	0f b6 00             	movzbl (%rax),%eax
+  801bb2:	3c 20                	cmp    $0x20,%al
+  801bb4:	74 f0                	je     801ba6 <strtol+0x38>
+  801bb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bba:	0f b6 00             	movzbl (%rax),%eax
+  801bbd:	3c 09                	cmp    $0x9,%al
+  801bbf:	74 e5                	je     801ba6 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801bc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc5:	0f b6 00             	movzbl (%rax),%eax
+  801bc8:	3c 2b                	cmp    $0x2b,%al
+  801bca:	75 07                	jne    801bd3 <strtol+0x65>
+		s++;
+  801bcc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bd1:	eb 17                	jmp    801bea <strtol+0x7c>
+	else if (*s == '-')
+  801bd3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd7:	0f b6 00             	movzbl (%rax),%eax
+  801bda:	3c 2d                	cmp    $0x2d,%al
+  801bdc:	75 0c                	jne    801bea <strtol+0x7c>
+		s++, neg = 1;
+  801bde:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801be3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801bea:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bee:	74 06                	je     801bf6 <strtol+0x88>
+  801bf0:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bf4:	75 28                	jne    801c1e <strtol+0xb0>
+  801bf6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bfa:	0f b6 00             	movzbl (%rax),%eax
+  801bfd:	3c 30                	cmp    $0x30,%al
+  801bff:	75 1d                	jne    801c1e <strtol+0xb0>
+  801c01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c05:	48 83 c0 01          	add    $0x1,%rax
+  801c09:	0f b6 00             	movzbl (%rax),%eax
+  801c0c:	3c 78                	cmp    $0x78,%al
+  801c0e:	75 0e                	jne    801c1e <strtol+0xb0>
+		s += 2, base = 16;
+  801c10:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801c15:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801c1c:	eb 2c                	jmp    801c4a <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801c1e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c22:	75 19                	jne    801c3d <strtol+0xcf>
+  801c24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c28:	0f b6 00             	movzbl (%rax),%eax
+  801c2b:	3c 30                	cmp    $0x30,%al
+  801c2d:	75 0e                	jne    801c3d <strtol+0xcf>
+		s++, base = 8;
+  801c2f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c34:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c3b:	eb 0d                	jmp    801c4a <strtol+0xdc>
+	else if (base == 0)
+  801c3d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c41:	75 07                	jne    801c4a <strtol+0xdc>
+		base = 10;
+  801c43:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801c4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c4e:	0f b6 00             	movzbl (%rax),%eax
+  801c51:	3c 2f                	cmp    $0x2f,%al
+  801c53:	7e 1d                	jle    801c72 <strtol+0x104>
+  801c55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c59:	0f b6 00             	movzbl (%rax),%eax
+  801c5c:	3c 39                	cmp    $0x39,%al
+  801c5e:	7f 12                	jg     801c72 <strtol+0x104>
+			dig = *s - '0';
+  801c60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c64:	0f b6 00             	movzbl (%rax),%eax
+  801c67:	0f be c0             	movsbl %al,%eax
+  801c6a:	83 e8 30             	sub    $0x30,%eax
+  801c6d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c70:	eb 4e                	jmp    801cc0 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801c72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c76:	0f b6 00             	movzbl (%rax),%eax
+  801c79:	3c 60                	cmp    $0x60,%al
+  801c7b:	7e 1d                	jle    801c9a <strtol+0x12c>
+  801c7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c81:	0f b6 00             	movzbl (%rax),%eax
+  801c84:	3c 7a                	cmp    $0x7a,%al
+  801c86:	7f 12                	jg     801c9a <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801c88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8c:	0f b6 00             	movzbl (%rax),%eax
+  801c8f:	0f be c0             	movsbl %al,%eax
+  801c92:	83 e8 57             	sub    $0x57,%eax
+  801c95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c98:	eb 26                	jmp    801cc0 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c9a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c9e:	0f b6 00             	movzbl (%rax),%eax
+  801ca1:	3c 40                	cmp    $0x40,%al
+  801ca3:	7e 47                	jle    801cec <strtol+0x17e>
+  801ca5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca9:	0f b6 00             	movzbl (%rax),%eax
+  801cac:	3c 5a                	cmp    $0x5a,%al
+  801cae:	7f 3c                	jg     801cec <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801cb0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb4:	0f b6 00             	movzbl (%rax),%eax
+  801cb7:	0f be c0             	movsbl %al,%eax
+  801cba:	83 e8 37             	sub    $0x37,%eax
+  801cbd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801cc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cc3:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801cc6:	7d 23                	jge    801ceb <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801cc8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ccd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801cd0:	48 98                	cltq
+  801cd2:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cd7:	48 89 c2             	mov    %rax,%rdx
+  801cda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cdd:	48 98                	cltq
+  801cdf:	48 01 d0             	add    %rdx,%rax
+  801ce2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801ce6:	e9 5f ff ff ff       	jmp    801c4a <strtol+0xdc>
+			break;
+  801ceb:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801cec:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cf1:	74 0b                	je     801cfe <strtol+0x190>
+		*endptr = (char *) s;
+  801cf3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cf7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cfb:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801cfe:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801d02:	74 09                	je     801d0d <strtol+0x19f>
+  801d04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d08:	48 f7 d8             	neg    %rax
+  801d0b:	eb 04                	jmp    801d11 <strtol+0x1a3>
+  801d0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801d11:	c9                   	leave
+  801d12:	c3                   	ret
+
+0000000000801d13 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801d13:	55                   	push   %rbp
+  801d14:	48 89 e5             	mov    %rsp,%rbp
+  801d17:	53                   	push   %rbx
+  801d18:	48 83 ec 30          	sub    $0x30,%rsp
+  801d1c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801d1c <strstr+0x9>
+  801d23:	49 bb 34 73 00 00 00 	movabs $0x7334,%r11
+  801d2a:	00 00 00 
+  801d2d:	4c 01 db             	add    %r11,%rbx
+  801d30:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801d34:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801d38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d3c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d40:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d44:	0f b6 00             	movzbl (%rax),%eax
+  801d47:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801d4a:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801d4e:	75 06                	jne    801d56 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801d50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d54:	eb 73                	jmp    801dc9 <strstr+0xb6>
+
+	len = strlen(str);
+  801d56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d5a:	48 89 c7             	mov    %rax,%rdi
+  801d5d:	48 b8 50 84 ff ff ff 	movabs $0xffffffffffff8450,%rax
+  801d64:	ff ff ff 
+  801d67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d6b:	ff d0                	call   *%rax
+  801d6d:	48 98                	cltq
+  801d6f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801d73:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d77:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d7b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d7f:	0f b6 00             	movzbl (%rax),%eax
+  801d82:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801d85:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801d89:	75 07                	jne    801d92 <strstr+0x7f>
+				return (char *) 0;
+  801d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d90:	eb 37                	jmp    801dc9 <strstr+0xb6>
+		} while (sc != c);
+  801d92:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801d96:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801d99:	75 d8                	jne    801d73 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801d9b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d9f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801da3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da7:	48 89 ce             	mov    %rcx,%rsi
+  801daa:	48 89 c7             	mov    %rax,%rdi
+  801dad:	48 b8 04 87 ff ff ff 	movabs $0xffffffffffff8704,%rax
+  801db4:	ff ff ff 
+  801db7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801dbb:	ff d0                	call   *%rax
+  801dbd:	85 c0                	test   %eax,%eax
+  801dbf:	75 b2                	jne    801d73 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801dc1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc5:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801dc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dcd:	c9                   	leave
+  801dce:	c3                   	ret
+
+0000000000801dcf <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801dcf:	55                   	push   %rbp
+  801dd0:	48 89 e5             	mov    %rsp,%rbp
+  801dd3:	41 57                	push   %r15
+  801dd5:	53                   	push   %rbx
+  801dd6:	48 83 ec 40          	sub    $0x40,%rsp
+  801dda:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801dda <syscall+0xb>
+  801de1:	49 bb 76 72 00 00 00 	movabs $0x7276,%r11
+  801de8:	00 00 00 
+  801deb:	4d 01 da             	add    %r11,%r10
+  801dee:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801df1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801df4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801df8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801dfc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801e00:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801e04:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e07:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801e0b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e0f:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801e13:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801e17:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e1b:	4c 89 c3             	mov    %r8,%rbx
+  801e1e:	cd 30                	int    $0x30
+  801e20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801e24:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801e28:	74 52                	je     801e7c <syscall+0xad>
+  801e2a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e2f:	7e 4b                	jle    801e7c <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e31:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e38:	49 89 d0             	mov    %rdx,%r8
+  801e3b:	89 c1                	mov    %eax,%ecx
+  801e3d:	48 b8 90 e3 ff ff ff 	movabs $0xffffffffffffe390,%rax
+  801e44:	ff ff ff 
+  801e47:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e4b:	48 89 c2             	mov    %rax,%rdx
+  801e4e:	be 23 00 00 00       	mov    $0x23,%esi
+  801e53:	48 b8 ad e3 ff ff ff 	movabs $0xffffffffffffe3ad,%rax
+  801e5a:	ff ff ff 
+  801e5d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e61:	48 89 c7             	mov    %rax,%rdi
+  801e64:	4d 89 d7             	mov    %r10,%r15
+  801e67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6c:	49 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%r9
+  801e73:	ff ff ff 
+  801e76:	4d 01 d1             	add    %r10,%r9
+  801e79:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e80:	48 83 c4 40          	add    $0x40,%rsp
+  801e84:	5b                   	pop    %rbx
+  801e85:	41 5f                	pop    %r15
+  801e87:	5d                   	pop    %rbp
+  801e88:	c3                   	ret
+
+0000000000801e89 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801e89:	55                   	push   %rbp
+  801e8a:	48 89 e5             	mov    %rsp,%rbp
+  801e8d:	41 57                	push   %r15
+  801e8f:	41 56                	push   %r14
+  801e91:	41 55                	push   %r13
+  801e93:	41 54                	push   %r12
+  801e95:	53                   	push   %rbx
+  801e96:	48 83 ec 48          	sub    $0x48,%rsp
+  801e9a:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801e9a <syscall_words+0x11>
+  801ea1:	49 bb b6 71 00 00 00 	movabs $0x71b6,%r11
+  801ea8:	00 00 00 
+  801eab:	4d 01 de             	add    %r11,%r14
+  801eae:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801eb1:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801eb4:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801eb8:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801ebc:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801ec0:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801ec4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ec9:	74 09                	je     801ed4 <syscall_words+0x4b>
+  801ecb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ecf:	48 8b 00             	mov    (%rax),%rax
+  801ed2:	eb 05                	jmp    801ed9 <syscall_words+0x50>
+  801ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed9:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801edc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ee1:	74 0a                	je     801eed <syscall_words+0x64>
+  801ee3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ee7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801eeb:	eb 05                	jmp    801ef2 <syscall_words+0x69>
+  801eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef2:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801ef5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801efa:	74 0a                	je     801f06 <syscall_words+0x7d>
+  801efc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f00:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f04:	eb 05                	jmp    801f0b <syscall_words+0x82>
+  801f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0b:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801f0e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f13:	74 0a                	je     801f1f <syscall_words+0x96>
+  801f15:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f19:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f1d:	eb 05                	jmp    801f24 <syscall_words+0x9b>
+  801f1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f24:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801f27:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f2c:	74 0a                	je     801f38 <syscall_words+0xaf>
+  801f2e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f32:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f36:	eb 05                	jmp    801f3d <syscall_words+0xb4>
+  801f38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3d:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801f40:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f45:	74 0a                	je     801f51 <syscall_words+0xc8>
+  801f47:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f4b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801f4f:	eb 05                	jmp    801f56 <syscall_words+0xcd>
+  801f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f56:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801f59:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f5c:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801f60:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f64:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801f68:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801f6c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f70:	cd 30                	int    $0x30
+  801f72:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801f76:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f7b:	74 50                	je     801fcd <syscall_words+0x144>
+		words[0] = r8;
+  801f7d:	4c 89 c2             	mov    %r8,%rdx
+  801f80:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f84:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801f87:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f8b:	48 83 c0 08          	add    $0x8,%rax
+  801f8f:	4c 89 ca             	mov    %r9,%rdx
+  801f92:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801f95:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f99:	48 83 c0 10          	add    $0x10,%rax
+  801f9d:	4c 89 d2             	mov    %r10,%rdx
+  801fa0:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801fa3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fa7:	48 83 c0 18          	add    $0x18,%rax
+  801fab:	4c 89 da             	mov    %r11,%rdx
+  801fae:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801fb1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fb5:	48 83 c0 20          	add    $0x20,%rax
+  801fb9:	4c 89 e2             	mov    %r12,%rdx
+  801fbc:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801fbf:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fc3:	48 83 c0 28          	add    $0x28,%rax
+  801fc7:	4c 89 ea             	mov    %r13,%rdx
+  801fca:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801fcd:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801fd1:	74 52                	je     802025 <syscall_words+0x19c>
+  801fd3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801fd8:	7e 4b                	jle    802025 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fda:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801fde:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801fe1:	49 89 d0             	mov    %rdx,%r8
+  801fe4:	89 c1                	mov    %eax,%ecx
+  801fe6:	48 b8 90 e3 ff ff ff 	movabs $0xffffffffffffe390,%rax
+  801fed:	ff ff ff 
+  801ff0:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801ff4:	48 89 c2             	mov    %rax,%rdx
+  801ff7:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801ffc:	48 b8 ad e3 ff ff ff 	movabs $0xffffffffffffe3ad,%rax
+  802003:	ff ff ff 
+  802006:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80200a:	48 89 c7             	mov    %rax,%rdi
+  80200d:	4d 89 f7             	mov    %r14,%r15
+  802010:	b8 00 00 00 00       	mov    $0x0,%eax
+  802015:	49 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%r9
+  80201c:	ff ff ff 
+  80201f:	4d 01 f1             	add    %r14,%r9
+  802022:	41 ff d1             	call   *%r9
+
+	return ret;
+  802025:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802029:	48 83 c4 48          	add    $0x48,%rsp
+  80202d:	5b                   	pop    %rbx
+  80202e:	41 5c                	pop    %r12
+  802030:	41 5d                	pop    %r13
+  802032:	41 5e                	pop    %r14
+  802034:	41 5f                	pop    %r15
+  802036:	5d                   	pop    %rbp
+  802037:	c3                   	ret
+
+0000000000802038 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802038:	55                   	push   %rbp
+  802039:	48 89 e5             	mov    %rsp,%rbp
+  80203c:	48 83 ec 10          	sub    $0x10,%rsp
+  802040:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802040 <sys_cputs+0x8>
+  802047:	49 bb 10 70 00 00 00 	movabs $0x7010,%r11
+  80204e:	00 00 00 
+  802051:	4c 01 d8             	add    %r11,%rax
+  802054:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802058:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80205c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802060:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802064:	48 83 ec 08          	sub    $0x8,%rsp
+  802068:	6a 00                	push   $0x0
+  80206a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802070:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802076:	be 00 00 00 00       	mov    $0x0,%esi
+  80207b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802080:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  802087:	ff ff ff 
+  80208a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80208e:	ff d0                	call   *%rax
+  802090:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802094:	90                   	nop
+  802095:	c9                   	leave
+  802096:	c3                   	ret
+
+0000000000802097 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802097:	55                   	push   %rbp
+  802098:	48 89 e5             	mov    %rsp,%rbp
+  80209b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80209b <sys_cgetc+0x4>
+  8020a2:	49 bb b5 6f 00 00 00 	movabs $0x6fb5,%r11
+  8020a9:	00 00 00 
+  8020ac:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8020af:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b3:	6a 00                	push   $0x0
+  8020b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020d5:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  8020dc:	ff ff ff 
+  8020df:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020e3:	ff d0                	call   *%rax
+  8020e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020e9:	c9                   	leave
+  8020ea:	c3                   	ret
+
+00000000008020eb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8020eb:	55                   	push   %rbp
+  8020ec:	48 89 e5             	mov    %rsp,%rbp
+  8020ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020f3 <sys_env_destroy+0x8>
+  8020fa:	49 bb 5d 6f 00 00 00 	movabs $0x6f5d,%r11
+  802101:	00 00 00 
+  802104:	4c 01 d8             	add    %r11,%rax
+  802107:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80210a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80210d:	48 63 d2             	movslq %edx,%rdx
+  802110:	48 83 ec 08          	sub    $0x8,%rsp
+  802114:	6a 00                	push   $0x0
+  802116:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80211c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802122:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802127:	be 01 00 00 00       	mov    $0x1,%esi
+  80212c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802131:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  802138:	ff ff ff 
+  80213b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80213f:	ff d0                	call   *%rax
+  802141:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802145:	c9                   	leave
+  802146:	c3                   	ret
+
+0000000000802147 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802147:	55                   	push   %rbp
+  802148:	48 89 e5             	mov    %rsp,%rbp
+  80214b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80214b <sys_getenvid+0x4>
+  802152:	49 bb 05 6f 00 00 00 	movabs $0x6f05,%r11
+  802159:	00 00 00 
+  80215c:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80215f:	48 83 ec 08          	sub    $0x8,%rsp
+  802163:	6a 00                	push   $0x0
+  802165:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80216b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802171:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802176:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217b:	be 00 00 00 00       	mov    $0x0,%esi
+  802180:	bf 02 00 00 00       	mov    $0x2,%edi
+  802185:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  80218c:	ff ff ff 
+  80218f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802193:	ff d0                	call   *%rax
+  802195:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802199:	c9                   	leave
+  80219a:	c3                   	ret
+
+000000000080219b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80219b:	55                   	push   %rbp
+  80219c:	48 89 e5             	mov    %rsp,%rbp
+  80219f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80219f <sys_yield+0x4>
+  8021a6:	49 bb b1 6e 00 00 00 	movabs $0x6eb1,%r11
+  8021ad:	00 00 00 
+  8021b0:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8021b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b7:	6a 00                	push   $0x0
+  8021b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d4:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021d9:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  8021e0:	ff ff ff 
+  8021e3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021e7:	ff d0                	call   *%rax
+  8021e9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ed:	90                   	nop
+  8021ee:	c9                   	leave
+  8021ef:	c3                   	ret
+
+00000000008021f0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8021f0:	55                   	push   %rbp
+  8021f1:	48 89 e5             	mov    %rsp,%rbp
+  8021f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021f8 <sys_page_alloc+0x8>
+  8021ff:	49 bb 58 6e 00 00 00 	movabs $0x6e58,%r11
+  802206:	00 00 00 
+  802209:	4c 01 d8             	add    %r11,%rax
+  80220c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80220f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802213:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802216:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802219:	48 63 f2             	movslq %edx,%rsi
+  80221c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802220:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802223:	48 63 d2             	movslq %edx,%rdx
+  802226:	48 83 ec 08          	sub    $0x8,%rsp
+  80222a:	6a 00                	push   $0x0
+  80222c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802232:	49 89 f0             	mov    %rsi,%r8
+  802235:	be 01 00 00 00       	mov    $0x1,%esi
+  80223a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80223f:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  802246:	ff ff ff 
+  802249:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80224d:	ff d0                	call   *%rax
+  80224f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802253:	c9                   	leave
+  802254:	c3                   	ret
+
+0000000000802255 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802255:	55                   	push   %rbp
+  802256:	48 89 e5             	mov    %rsp,%rbp
+  802259:	48 83 ec 20          	sub    $0x20,%rsp
+  80225d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80225d <sys_page_map+0x8>
+  802264:	49 bb f3 6d 00 00 00 	movabs $0x6df3,%r11
+  80226b:	00 00 00 
+  80226e:	4c 01 d8             	add    %r11,%rax
+  802271:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802274:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802278:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80227b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80227f:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802283:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802286:	48 63 f2             	movslq %edx,%rsi
+  802289:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80228d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802290:	48 63 fa             	movslq %edx,%rdi
+  802293:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802297:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80229a:	48 63 d2             	movslq %edx,%rdx
+  80229d:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a1:	56                   	push   %rsi
+  8022a2:	4d 89 c1             	mov    %r8,%r9
+  8022a5:	49 89 f8             	mov    %rdi,%r8
+  8022a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ad:	bf 05 00 00 00       	mov    $0x5,%edi
+  8022b2:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  8022b9:	ff ff ff 
+  8022bc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c0:	ff d0                	call   *%rax
+  8022c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c6:	c9                   	leave
+  8022c7:	c3                   	ret
+
+00000000008022c8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8022c8:	55                   	push   %rbp
+  8022c9:	48 89 e5             	mov    %rsp,%rbp
+  8022cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d0 <sys_page_unmap+0x8>
+  8022d7:	49 bb 80 6d 00 00 00 	movabs $0x6d80,%r11
+  8022de:	00 00 00 
+  8022e1:	4c 01 d8             	add    %r11,%rax
+  8022e4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8022eb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022ef:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022f2:	48 63 d2             	movslq %edx,%rdx
+  8022f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8022f9:	6a 00                	push   $0x0
+  8022fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802301:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802307:	be 01 00 00 00       	mov    $0x1,%esi
+  80230c:	bf 06 00 00 00       	mov    $0x6,%edi
+  802311:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  802318:	ff ff ff 
+  80231b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80231f:	ff d0                	call   *%rax
+  802321:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802325:	c9                   	leave
+  802326:	c3                   	ret
+
+0000000000802327 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802327:	55                   	push   %rbp
+  802328:	48 89 e5             	mov    %rsp,%rbp
+  80232b:	48 83 ec 10          	sub    $0x10,%rsp
+  80232f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80232f <sys_env_set_status+0x8>
+  802336:	49 bb 21 6d 00 00 00 	movabs $0x6d21,%r11
+  80233d:	00 00 00 
+  802340:	4c 01 d8             	add    %r11,%rax
+  802343:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802346:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802349:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80234c:	48 63 ca             	movslq %edx,%rcx
+  80234f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802352:	48 63 d2             	movslq %edx,%rdx
+  802355:	48 83 ec 08          	sub    $0x8,%rsp
+  802359:	6a 00                	push   $0x0
+  80235b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802361:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802367:	be 01 00 00 00       	mov    $0x1,%esi
+  80236c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802371:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  802378:	ff ff ff 
+  80237b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80237f:	ff d0                	call   *%rax
+  802381:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802385:	c9                   	leave
+  802386:	c3                   	ret
+
+0000000000802387 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802387:	55                   	push   %rbp
+  802388:	48 89 e5             	mov    %rsp,%rbp
+  80238b:	48 83 ec 10          	sub    $0x10,%rsp
+  80238f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80238f <sys_env_set_trapframe+0x8>
+  802396:	49 bb c1 6c 00 00 00 	movabs $0x6cc1,%r11
+  80239d:	00 00 00 
+  8023a0:	4c 01 d8             	add    %r11,%rax
+  8023a3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023a6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8023aa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023ae:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023b1:	48 63 d2             	movslq %edx,%rdx
+  8023b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b8:	6a 00                	push   $0x0
+  8023ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c6:	be 01 00 00 00       	mov    $0x1,%esi
+  8023cb:	bf 09 00 00 00       	mov    $0x9,%edi
+  8023d0:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  8023d7:	ff ff ff 
+  8023da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023de:	ff d0                	call   *%rax
+  8023e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e4:	c9                   	leave
+  8023e5:	c3                   	ret
+
+00000000008023e6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8023e6:	55                   	push   %rbp
+  8023e7:	48 89 e5             	mov    %rsp,%rbp
+  8023ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8023ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023ee <sys_env_set_pgfault_upcall+0x8>
+  8023f5:	49 bb 62 6c 00 00 00 	movabs $0x6c62,%r11
+  8023fc:	00 00 00 
+  8023ff:	4c 01 d8             	add    %r11,%rax
+  802402:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802405:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802409:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80240d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802410:	48 63 d2             	movslq %edx,%rdx
+  802413:	48 83 ec 08          	sub    $0x8,%rsp
+  802417:	6a 00                	push   $0x0
+  802419:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80241f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802425:	be 01 00 00 00       	mov    $0x1,%esi
+  80242a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80242f:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  802436:	ff ff ff 
+  802439:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80243d:	ff d0                	call   *%rax
+  80243f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802443:	c9                   	leave
+  802444:	c3                   	ret
+
+0000000000802445 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802445:	55                   	push   %rbp
+  802446:	48 89 e5             	mov    %rsp,%rbp
+  802449:	48 83 ec 20          	sub    $0x20,%rsp
+  80244d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80244d <sys_ipc_try_send+0x8>
+  802454:	49 bb 03 6c 00 00 00 	movabs $0x6c03,%r11
+  80245b:	00 00 00 
+  80245e:	4c 01 d8             	add    %r11,%rax
+  802461:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802464:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802468:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80246c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80246f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802472:	48 63 fa             	movslq %edx,%rdi
+  802475:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802479:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80247c:	48 63 d2             	movslq %edx,%rdx
+  80247f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802483:	48 83 ec 08          	sub    $0x8,%rsp
+  802487:	6a 00                	push   $0x0
+  802489:	49 89 f9             	mov    %rdi,%r9
+  80248c:	49 89 f0             	mov    %rsi,%r8
+  80248f:	be 00 00 00 00       	mov    $0x0,%esi
+  802494:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802499:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  8024a0:	ff ff ff 
+  8024a3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024a7:	ff d0                	call   *%rax
+  8024a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+
+00000000008024af <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8024af:	55                   	push   %rbp
+  8024b0:	48 89 e5             	mov    %rsp,%rbp
+  8024b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8024b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024b7 <sys_ipc_send+0x8>
+  8024be:	49 bb 99 6b 00 00 00 	movabs $0x6b99,%r11
+  8024c5:	00 00 00 
+  8024c8:	4c 01 d8             	add    %r11,%rax
+  8024cb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024ce:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024d2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024d6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8024d9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024dc:	48 63 fa             	movslq %edx,%rdi
+  8024df:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024e3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024e6:	48 63 d2             	movslq %edx,%rdx
+  8024e9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f1:	6a 00                	push   $0x0
+  8024f3:	49 89 f9             	mov    %rdi,%r9
+  8024f6:	49 89 f0             	mov    %rsi,%r8
+  8024f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024fe:	bf 17 00 00 00       	mov    $0x17,%edi
+  802503:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  80250a:	ff ff ff 
+  80250d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802511:	ff d0                	call   *%rax
+  802513:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802517:	c9                   	leave
+  802518:	c3                   	ret
+
+0000000000802519 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802519:	55                   	push   %rbp
+  80251a:	48 89 e5             	mov    %rsp,%rbp
+  80251d:	48 83 ec 10          	sub    $0x10,%rsp
+  802521:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802521 <sys_ipc_recv+0x8>
+  802528:	49 bb 2f 6b 00 00 00 	movabs $0x6b2f,%r11
+  80252f:	00 00 00 
+  802532:	4c 01 d8             	add    %r11,%rax
+  802535:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802539:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80253d:	6a 00                	push   $0x0
+  80253f:	6a 00                	push   $0x0
+  802541:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802547:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80254d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802552:	be 01 00 00 00       	mov    $0x1,%esi
+  802557:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80255c:	49 ba 39 8e ff ff ff 	movabs $0xffffffffffff8e39,%r10
+  802563:	ff ff ff 
+  802566:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80256a:	ff d0                	call   *%rax
+  80256c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802570:	c9                   	leave
+  802571:	c3                   	ret
+
+0000000000802572 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802572:	55                   	push   %rbp
+  802573:	48 89 e5             	mov    %rsp,%rbp
+  802576:	48 83 ec 30          	sub    $0x30,%rsp
+  80257a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80257a <sys_ipc_call+0x8>
+  802581:	49 bb d6 6a 00 00 00 	movabs $0x6ad6,%r11
+  802588:	00 00 00 
+  80258b:	4c 01 d8             	add    %r11,%rax
+  80258e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802591:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802595:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802599:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80259c:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8025a0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8025a4:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8025a8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025ab:	4c 63 c2             	movslq %edx,%r8
+  8025ae:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8025b2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025b5:	48 63 d2             	movslq %edx,%rdx
+  8025b8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025bc:	ff 75 d8             	push   -0x28(%rbp)
+  8025bf:	56                   	push   %rsi
+  8025c0:	4d 89 c1             	mov    %r8,%r9
+  8025c3:	49 89 f8             	mov    %rdi,%r8
+  8025c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8025cb:	bf 18 00 00 00       	mov    $0x18,%edi
+  8025d0:	49 ba 39 8e ff ff ff 	movabs $0xffffffffffff8e39,%r10
+  8025d7:	ff ff ff 
+  8025da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025de:	ff d0                	call   *%rax
+  8025e0:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8025e4:	c9                   	leave
+  8025e5:	c3                   	ret
+
+00000000008025e6 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8025e6:	55                   	push   %rbp
+  8025e7:	48 89 e5             	mov    %rsp,%rbp
+  8025ea:	48 83 ec 30          	sub    $0x30,%rsp
+  8025ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025ee <sys_ipc_reply_recv+0x8>
+  8025f5:	49 bb 62 6a 00 00 00 	movabs $0x6a62,%r11
+  8025fc:	00 00 00 
+  8025ff:	4c 01 d8             	add    %r11,%rax
+  802602:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802605:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802609:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80260d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802610:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802614:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802618:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80261c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80261f:	4c 63 c2             	movslq %edx,%r8
+  802622:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802626:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802629:	48 63 d2             	movslq %edx,%rdx
+  80262c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802630:	ff 75 d8             	push   -0x28(%rbp)
+  802633:	56                   	push   %rsi
+  802634:	4d 89 c1             	mov    %r8,%r9
+  802637:	49 89 f8             	mov    %rdi,%r8
+  80263a:	be 00 00 00 00       	mov    $0x0,%esi
+  80263f:	bf 19 00 00 00       	mov    $0x19,%edi
+  802644:	49 ba 39 8e ff ff ff 	movabs $0xffffffffffff8e39,%r10
+  80264b:	ff ff ff 
+  80264e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802652:	ff d0                	call   *%rax
+  802654:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802658:	c9                   	leave
+  802659:	c3                   	ret
+
+000000000080265a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80265a:	55                   	push   %rbp
+  80265b:	48 89 e5             	mov    %rsp,%rbp
+  80265e:	48 83 ec 10          	sub    $0x10,%rsp
+  802662:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802662 <sys_env_set_priority+0x8>
+  802669:	49 bb ee 69 00 00 00 	movabs $0x69ee,%r11
+  802670:	00 00 00 
+  802673:	4c 01 d8             	add    %r11,%rax
+  802676:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802679:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80267c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80267f:	48 63 ca             	movslq %edx,%rcx
+  802682:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802685:	48 63 d2             	movslq %edx,%rdx
+  802688:	48 83 ec 08          	sub    $0x8,%rsp
+  80268c:	6a 00                	push   $0x0
+  80268e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802694:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80269a:	be 01 00 00 00       	mov    $0x1,%esi
+  80269f:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8026a4:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  8026ab:	ff ff ff 
+  8026ae:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026b2:	ff d0                	call   *%rax
+  8026b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b8:	c9                   	leave
+  8026b9:	c3                   	ret
+
+00000000008026ba <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8026ba:	55                   	push   %rbp
+  8026bb:	48 89 e5             	mov    %rsp,%rbp
+  8026be:	48 83 ec 10          	sub    $0x10,%rsp
+  8026c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026c2 <sys_env_set_affinity+0x8>
+  8026c9:	49 bb 8e 69 00 00 00 	movabs $0x698e,%r11
+  8026d0:	00 00 00 
+  8026d3:	4c 01 d8             	add    %r11,%rax
+  8026d6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026d9:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8026dc:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8026df:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026e2:	48 63 d2             	movslq %edx,%rdx
+  8026e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e9:	6a 00                	push   $0x0
+  8026eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8026fc:	bf 10 00 00 00       	mov    $0x10,%edi
+  802701:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  802708:	ff ff ff 
+  80270b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80270f:	ff d0                	call   *%rax
+  802711:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802715:	c9                   	leave
+  802716:	c3                   	ret
+
+0000000000802717 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802717:	55                   	push   %rbp
+  802718:	48 89 e5             	mov    %rsp,%rbp
+  80271b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80271b <sys_time_msec+0x4>
+  802722:	49 bb 35 69 00 00 00 	movabs $0x6935,%r11
+  802729:	00 00 00 
+  80272c:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80272f:	48 83 ec 08          	sub    $0x8,%rsp
+  802733:	6a 00                	push   $0x0
+  802735:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80273b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802741:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802746:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274b:	be 00 00 00 00       	mov    $0x0,%esi
+  802750:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802755:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  80275c:	ff ff ff 
+  80275f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802763:	ff d0                	call   *%rax
+  802765:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802769:	c9                   	leave
+  80276a:	c3                   	ret
+
+000000000080276b <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80276b:	55                   	push   %rbp
+  80276c:	48 89 e5             	mov    %rsp,%rbp
+  80276f:	48 83 ec 10          	sub    $0x10,%rsp
+  802773:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802773 <sys_sleep_usec+0x8>
+  80277a:	49 bb dd 68 00 00 00 	movabs $0x68dd,%r11
+  802781:	00 00 00 
+  802784:	4c 01 d8             	add    %r11,%rax
+  802787:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80278b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80278f:	48 83 ec 08          	sub    $0x8,%rsp
+  802793:	6a 00                	push   $0x0
+  802795:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80279b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ab:	bf 11 00 00 00       	mov    $0x11,%edi
+  8027b0:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  8027b7:	ff ff ff 
+  8027ba:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027be:	ff d0                	call   *%rax
+  8027c0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027c4:	c9                   	leave
+  8027c5:	c3                   	ret
+
+00000000008027c6 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8027c6:	55                   	push   %rbp
+  8027c7:	48 89 e5             	mov    %rsp,%rbp
+  8027ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8027ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027ce <sys_page_alloc_huge+0x8>
+  8027d5:	49 bb 82 68 00 00 00 	movabs $0x6882,%r11
+  8027dc:	00 00 00 
+  8027df:	4c 01 d8             	add    %r11,%rax
+  8027e2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027e5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027e9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8027ec:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027ef:	48 63 f2             	movslq %edx,%rsi
+  8027f2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027f6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027f9:	48 63 d2             	movslq %edx,%rdx
+  8027fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802800:	6a 00                	push   $0x0
+  802802:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802808:	49 89 f0             	mov    %rsi,%r8
+  80280b:	be 01 00 00 00       	mov    $0x1,%esi
+  802810:	bf 12 00 00 00       	mov    $0x12,%edi
+  802815:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  80281c:	ff ff ff 
+  80281f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802823:	ff d0                	call   *%rax
+  802825:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802829:	c9                   	leave
+  80282a:	c3                   	ret
+
+000000000080282b <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80282b:	55                   	push   %rbp
+  80282c:	48 89 e5             	mov    %rsp,%rbp
+  80282f:	48 83 ec 10          	sub    $0x10,%rsp
+  802833:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802833 <sys_page_map_batch+0x8>
+  80283a:	49 bb 1d 68 00 00 00 	movabs $0x681d,%r11
+  802841:	00 00 00 
+  802844:	4c 01 d8             	add    %r11,%rax
+  802847:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80284b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80284f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802853:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802857:	48 83 ec 08          	sub    $0x8,%rsp
+  80285b:	6a 00                	push   $0x0
+  80285d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802863:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802869:	be 01 00 00 00       	mov    $0x1,%esi
+  80286e:	bf 13 00 00 00       	mov    $0x13,%edi
+  802873:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  80287a:	ff ff ff 
+  80287d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802881:	ff d0                	call   *%rax
+  802883:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802887:	c9                   	leave
+  802888:	c3                   	ret
+
+0000000000802889 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802889:	55                   	push   %rbp
+  80288a:	48 89 e5             	mov    %rsp,%rbp
+  80288d:	48 83 ec 10          	sub    $0x10,%rsp
+  802891:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802891 <sys_page_alloc_batch+0x8>
+  802898:	49 bb bf 67 00 00 00 	movabs $0x67bf,%r11
+  80289f:	00 00 00 
+  8028a2:	4c 01 d8             	add    %r11,%rax
+  8028a5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028a9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8028ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028b1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b9:	6a 00                	push   $0x0
+  8028bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8028cc:	bf 14 00 00 00       	mov    $0x14,%edi
+  8028d1:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  8028d8:	ff ff ff 
+  8028db:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028df:	ff d0                	call   *%rax
+  8028e1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028e5:	c9                   	leave
+  8028e6:	c3                   	ret
+
+00000000008028e7 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8028e7:	55                   	push   %rbp
+  8028e8:	48 89 e5             	mov    %rsp,%rbp
+  8028eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8028ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028ef <sys_page_unmap_batch+0x8>
+  8028f6:	49 bb 61 67 00 00 00 	movabs $0x6761,%r11
+  8028fd:	00 00 00 
+  802900:	4c 01 d8             	add    %r11,%rax
+  802903:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802907:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80290b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80290f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802913:	48 83 ec 08          	sub    $0x8,%rsp
+  802917:	6a 00                	push   $0x0
+  802919:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802925:	be 01 00 00 00       	mov    $0x1,%esi
+  80292a:	bf 15 00 00 00       	mov    $0x15,%edi
+  80292f:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  802936:	ff ff ff 
+  802939:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80293d:	ff d0                	call   *%rax
+  80293f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802943:	c9                   	leave
+  802944:	c3                   	ret
+
+0000000000802945 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802945:	55                   	push   %rbp
+  802946:	48 89 e5             	mov    %rsp,%rbp
+  802949:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802949 <sys_fork+0x4>
+  802950:	49 bb 07 67 00 00 00 	movabs $0x6707,%r11
+  802957:	00 00 00 
+  80295a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80295d:	48 83 ec 08          	sub    $0x8,%rsp
+  802961:	6a 00                	push   $0x0
+  802963:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802969:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80296f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802974:	ba 00 00 00 00       	mov    $0x0,%edx
+  802979:	be 00 00 00 00       	mov    $0x0,%esi
+  80297e:	bf 16 00 00 00       	mov    $0x16,%edi
+  802983:	49 ba 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r10
+  80298a:	ff ff ff 
+  80298d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802991:	ff d0                	call   *%rax
+  802993:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802997:	c9                   	leave
+  802998:	c3                   	ret
+
+0000000000802999 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802999:	55                   	push   %rbp
+  80299a:	48 89 e5             	mov    %rsp,%rbp
+  80299d:	41 57                	push   %r15
+  80299f:	53                   	push   %rbx
+  8029a0:	48 83 ec 40          	sub    $0x40,%rsp
+  8029a4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8029a4 <pgfault+0xb>
+  8029ab:	49 bb ac 66 00 00 00 	movabs $0x66ac,%r11
+  8029b2:	00 00 00 
+  8029b5:	4c 01 db             	add    %r11,%rbx
+  8029b8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  8029bc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029c0:	48 8b 00             	mov    (%rax),%rax
+  8029c3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  8029c7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029cf:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  8029d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029d6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8029da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029de:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029e4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  8029e8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8029eb:	83 e0 02             	and    $0x2,%eax
+  8029ee:	85 c0                	test   %eax,%eax
+  8029f0:	0f 84 91 03 00 00    	je     802d87 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8029f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029fa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029fe:	48 89 c2             	mov    %rax,%rdx
+  802a01:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802a08:	ff ff ff 
+  802a0b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a0f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a13:	83 e0 01             	and    $0x1,%eax
+  802a16:	48 85 c0             	test   %rax,%rax
+  802a19:	0f 84 a7 01 00 00    	je     802bc6 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802a1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a23:	48 c1 e8 15          	shr    $0x15,%rax
+  802a27:	48 89 c2             	mov    %rax,%rdx
+  802a2a:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  802a31:	ff ff ff 
+  802a34:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a38:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a3c:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802a41:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802a47:	0f 85 79 01 00 00    	jne    802bc6 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802a4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a51:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802a55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a59:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802a5f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802a63:	ba 07 00 00 00       	mov    $0x7,%edx
+  802a68:	be 00 00 60 00       	mov    $0x600000,%esi
+  802a6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a72:	49 89 df             	mov    %rbx,%r15
+  802a75:	48 b8 76 97 ff ff ff 	movabs $0xffffffffffff9776,%rax
+  802a7c:	ff ff ff 
+  802a7f:	48 01 d8             	add    %rbx,%rax
+  802a82:	ff d0                	call   *%rax
+  802a84:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802a87:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802a8b:	79 44                	jns    802ad1 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802a8d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802a90:	89 c1                	mov    %eax,%ecx
+  802a92:	48 b8 c0 e3 ff ff ff 	movabs $0xffffffffffffe3c0,%rax
+  802a99:	ff ff ff 
+  802a9c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aa0:	48 89 c2             	mov    %rax,%rdx
+  802aa3:	be 20 00 00 00       	mov    $0x20,%esi
+  802aa8:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  802aaf:	ff ff ff 
+  802ab2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ab6:	48 89 c7             	mov    %rax,%rdi
+  802ab9:	49 89 df             	mov    %rbx,%r15
+  802abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac1:	49 b8 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%r8
+  802ac8:	ff ff ff 
+  802acb:	49 01 d8             	add    %rbx,%r8
+  802ace:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802ad1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ad5:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802ada:	48 89 c6             	mov    %rax,%rsi
+  802add:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802ae2:	49 89 df             	mov    %rbx,%r15
+  802ae5:	48 b8 ef 89 ff ff ff 	movabs $0xffffffffffff89ef,%rax
+  802aec:	ff ff ff 
+  802aef:	48 01 d8             	add    %rbx,%rax
+  802af2:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802af4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802af8:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802afe:	48 89 c1             	mov    %rax,%rcx
+  802b01:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b06:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b10:	49 89 df             	mov    %rbx,%r15
+  802b13:	48 b8 05 92 ff ff ff 	movabs $0xffffffffffff9205,%rax
+  802b1a:	ff ff ff 
+  802b1d:	48 01 d8             	add    %rbx,%rax
+  802b20:	ff d0                	call   *%rax
+  802b22:	85 c0                	test   %eax,%eax
+  802b24:	74 3e                	je     802b64 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802b26:	48 b8 eb e3 ff ff ff 	movabs $0xffffffffffffe3eb,%rax
+  802b2d:	ff ff ff 
+  802b30:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b34:	48 89 c2             	mov    %rax,%rdx
+  802b37:	be 23 00 00 00       	mov    $0x23,%esi
+  802b3c:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  802b43:	ff ff ff 
+  802b46:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b4a:	48 89 c7             	mov    %rax,%rdi
+  802b4d:	49 89 df             	mov    %rbx,%r15
+  802b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b55:	48 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%rcx
+  802b5c:	ff ff ff 
+  802b5f:	48 01 d9             	add    %rbx,%rcx
+  802b62:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802b64:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b69:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b6e:	49 89 df             	mov    %rbx,%r15
+  802b71:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  802b78:	ff ff ff 
+  802b7b:	48 01 d8             	add    %rbx,%rax
+  802b7e:	ff d0                	call   *%rax
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	0f 84 3d 02 00 00    	je     802dc5 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802b88:	48 b8 00 e4 ff ff ff 	movabs $0xffffffffffffe400,%rax
+  802b8f:	ff ff ff 
+  802b92:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b96:	48 89 c2             	mov    %rax,%rdx
+  802b99:	be 25 00 00 00       	mov    $0x25,%esi
+  802b9e:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  802ba5:	ff ff ff 
+  802ba8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bac:	48 89 c7             	mov    %rax,%rdi
+  802baf:	49 89 df             	mov    %rbx,%r15
+  802bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb7:	48 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%rcx
+  802bbe:	ff ff ff 
+  802bc1:	48 01 d9             	add    %rbx,%rcx
+  802bc4:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802bc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bca:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bce:	48 89 c2             	mov    %rax,%rdx
+  802bd1:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  802bd8:	ff ff ff 
+  802bdb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bdf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802be3:	25 00 08 00 00       	and    $0x800,%eax
+  802be8:	48 85 c0             	test   %rax,%rax
+  802beb:	0f 84 58 01 00 00    	je     802d49 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802bf1:	ba 07 00 00 00       	mov    $0x7,%edx
+  802bf6:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802bfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c00:	49 89 df             	mov    %rbx,%r15
+  802c03:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  802c0a:	ff ff ff 
+  802c0d:	48 01 d8             	add    %rbx,%rax
+  802c10:	ff d0                	call   *%rax
+  802c12:	85 c0                	test   %eax,%eax
+  802c14:	74 3e                	je     802c54 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802c16:	48 b8 17 e4 ff ff ff 	movabs $0xffffffffffffe417,%rax
+  802c1d:	ff ff ff 
+  802c20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c24:	48 89 c2             	mov    %rax,%rdx
+  802c27:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802c2c:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  802c33:	ff ff ff 
+  802c36:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c3a:	48 89 c7             	mov    %rax,%rdi
+  802c3d:	49 89 df             	mov    %rbx,%r15
+  802c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c45:	48 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%rcx
+  802c4c:	ff ff ff 
+  802c4f:	48 01 d9             	add    %rbx,%rcx
+  802c52:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802c54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c5d:	48 89 c6             	mov    %rax,%rsi
+  802c60:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802c65:	49 89 df             	mov    %rbx,%r15
+  802c68:	48 b8 ef 89 ff ff ff 	movabs $0xffffffffffff89ef,%rax
+  802c6f:	ff ff ff 
+  802c72:	48 01 d8             	add    %rbx,%rax
+  802c75:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802c77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c7b:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c81:	48 89 c1             	mov    %rax,%rcx
+  802c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c89:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802c8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c93:	49 89 df             	mov    %rbx,%r15
+  802c96:	48 b8 05 92 ff ff ff 	movabs $0xffffffffffff9205,%rax
+  802c9d:	ff ff ff 
+  802ca0:	48 01 d8             	add    %rbx,%rax
+  802ca3:	ff d0                	call   *%rax
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	74 3e                	je     802ce7 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802ca9:	48 b8 eb e3 ff ff ff 	movabs $0xffffffffffffe3eb,%rax
+  802cb0:	ff ff ff 
+  802cb3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cb7:	48 89 c2             	mov    %rax,%rdx
+  802cba:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802cbf:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  802cc6:	ff ff ff 
+  802cc9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ccd:	48 89 c7             	mov    %rax,%rdi
+  802cd0:	49 89 df             	mov    %rbx,%r15
+  802cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd8:	48 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%rcx
+  802cdf:	ff ff ff 
+  802ce2:	48 01 d9             	add    %rbx,%rcx
+  802ce5:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802ce7:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802cec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf1:	49 89 df             	mov    %rbx,%r15
+  802cf4:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  802cfb:	ff ff ff 
+  802cfe:	48 01 d8             	add    %rbx,%rax
+  802d01:	ff d0                	call   *%rax
+  802d03:	85 c0                	test   %eax,%eax
+  802d05:	0f 84 bb 00 00 00    	je     802dc6 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802d0b:	48 b8 00 e4 ff ff ff 	movabs $0xffffffffffffe400,%rax
+  802d12:	ff ff ff 
+  802d15:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d19:	48 89 c2             	mov    %rax,%rdx
+  802d1c:	be 32 00 00 00       	mov    $0x32,%esi
+  802d21:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  802d28:	ff ff ff 
+  802d2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d2f:	48 89 c7             	mov    %rax,%rdi
+  802d32:	49 89 df             	mov    %rbx,%r15
+  802d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3a:	48 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%rcx
+  802d41:	ff ff ff 
+  802d44:	48 01 d9             	add    %rbx,%rcx
+  802d47:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802d49:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802d50:	ff ff ff 
+  802d53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d57:	48 89 c2             	mov    %rax,%rdx
+  802d5a:	be 36 00 00 00       	mov    $0x36,%esi
+  802d5f:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  802d66:	ff ff ff 
+  802d69:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d6d:	48 89 c7             	mov    %rax,%rdi
+  802d70:	49 89 df             	mov    %rbx,%r15
+  802d73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d78:	48 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%rcx
+  802d7f:	ff ff ff 
+  802d82:	48 01 d9             	add    %rbx,%rcx
+  802d85:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802d87:	48 b8 4f e4 ff ff ff 	movabs $0xffffffffffffe44f,%rax
+  802d8e:	ff ff ff 
+  802d91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d95:	48 89 c2             	mov    %rax,%rdx
+  802d98:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802d9d:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  802da4:	ff ff ff 
+  802da7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dab:	48 89 c7             	mov    %rax,%rdi
+  802dae:	49 89 df             	mov    %rbx,%r15
+  802db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db6:	48 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%rcx
+  802dbd:	ff ff ff 
+  802dc0:	48 01 d9             	add    %rbx,%rcx
+  802dc3:	ff d1                	call   *%rcx
+			return;
+  802dc5:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802dc6:	48 83 c4 40          	add    $0x40,%rsp
+  802dca:	5b                   	pop    %rbx
+  802dcb:	41 5f                	pop    %r15
+  802dcd:	5d                   	pop    %rbp
+  802dce:	c3                   	ret
+
+0000000000802dcf <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802dcf:	55                   	push   %rbp
+  802dd0:	48 89 e5             	mov    %rsp,%rbp
+  802dd3:	41 57                	push   %r15
+  802dd5:	53                   	push   %rbx
+  802dd6:	48 83 ec 10          	sub    $0x10,%rsp
+  802dda:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dda <fork_flush+0xb>
+  802de1:	49 bb 76 62 00 00 00 	movabs $0x6276,%r11
+  802de8:	00 00 00 
+  802deb:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802dee:	48 b8 b0 1f 00 00 00 	movabs $0x1fb0,%rax
+  802df5:	00 00 00 
+  802df8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802dfc:	48 85 c0             	test   %rax,%rax
+  802dff:	0f 84 81 00 00 00    	je     802e86 <fork_flush+0xb7>
+  802e05:	48 b8 b0 1f 00 00 00 	movabs $0x1fb0,%rax
+  802e0c:	00 00 00 
+  802e0f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e13:	48 89 c6             	mov    %rax,%rsi
+  802e16:	48 b8 b0 0f 00 00 00 	movabs $0xfb0,%rax
+  802e1d:	00 00 00 
+  802e20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e24:	48 89 c7             	mov    %rax,%rdi
+  802e27:	49 89 df             	mov    %rbx,%r15
+  802e2a:	48 b8 db 97 ff ff ff 	movabs $0xffffffffffff97db,%rax
+  802e31:	ff ff ff 
+  802e34:	48 01 d8             	add    %rbx,%rax
+  802e37:	ff d0                	call   *%rax
+  802e39:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e3c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e40:	79 44                	jns    802e86 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802e42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e45:	89 c1                	mov    %eax,%ecx
+  802e47:	48 b8 68 e4 ff ff ff 	movabs $0xffffffffffffe468,%rax
+  802e4e:	ff ff ff 
+  802e51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e55:	48 89 c2             	mov    %rax,%rdx
+  802e58:	be 56 00 00 00       	mov    $0x56,%esi
+  802e5d:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  802e64:	ff ff ff 
+  802e67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e6b:	48 89 c7             	mov    %rax,%rdi
+  802e6e:	49 89 df             	mov    %rbx,%r15
+  802e71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e76:	49 b8 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%r8
+  802e7d:	ff ff ff 
+  802e80:	49 01 d8             	add    %rbx,%r8
+  802e83:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802e86:	48 b8 b0 1f 00 00 00 	movabs $0x1fb0,%rax
+  802e8d:	00 00 00 
+  802e90:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802e97:	00 
+}
+  802e98:	90                   	nop
+  802e99:	48 83 c4 10          	add    $0x10,%rsp
+  802e9d:	5b                   	pop    %rbx
+  802e9e:	41 5f                	pop    %r15
+  802ea0:	5d                   	pop    %rbp
+  802ea1:	c3                   	ret
+
+0000000000802ea2 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802ea2:	55                   	push   %rbp
+  802ea3:	48 89 e5             	mov    %rsp,%rbp
+  802ea6:	53                   	push   %rbx
+  802ea7:	48 83 ec 28          	sub    $0x28,%rsp
+  802eab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802eab <fork_map+0x9>
+  802eb2:	49 bb a5 61 00 00 00 	movabs $0x61a5,%r11
+  802eb9:	00 00 00 
+  802ebc:	4c 01 db             	add    %r11,%rbx
+  802ebf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ec2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ec6:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802ec9:	48 b8 b0 1f 00 00 00 	movabs $0x1fb0,%rax
+  802ed0:	00 00 00 
+  802ed3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ed7:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802edd:	75 10                	jne    802eef <fork_map+0x4d>
+		fork_flush();
+  802edf:	48 b8 7f 9d ff ff ff 	movabs $0xffffffffffff9d7f,%rax
+  802ee6:	ff ff ff 
+  802ee9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802eed:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802eef:	48 b8 b0 1f 00 00 00 	movabs $0x1fb0,%rax
+  802ef6:	00 00 00 
+  802ef9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802efd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802f01:	48 b9 b0 1f 00 00 00 	movabs $0x1fb0,%rcx
+  802f08:	00 00 00 
+  802f0b:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802f0f:	48 c1 e0 05          	shl    $0x5,%rax
+  802f13:	48 89 c2             	mov    %rax,%rdx
+  802f16:	48 b8 b0 0f 00 00 00 	movabs $0xfb0,%rax
+  802f1d:	00 00 00 
+  802f20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f24:	48 01 d0             	add    %rdx,%rax
+  802f27:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802f2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f2f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802f35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f39:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f3d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802f41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f45:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f48:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802f4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f4f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f53:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802f57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f5b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802f5e:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802f61:	90                   	nop
+  802f62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f66:	c9                   	leave
+  802f67:	c3                   	ret
+
+0000000000802f68 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802f68:	55                   	push   %rbp
+  802f69:	48 89 e5             	mov    %rsp,%rbp
+  802f6c:	53                   	push   %rbx
+  802f6d:	48 83 ec 28          	sub    $0x28,%rsp
+  802f71:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f71 <duppage+0x9>
+  802f78:	49 bb df 60 00 00 00 	movabs $0x60df,%r11
+  802f7f:	00 00 00 
+  802f82:	4c 01 db             	add    %r11,%rbx
+  802f85:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f88:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802f8b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802f8e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f92:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802f96:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  802f9d:	ff ff ff 
+  802fa0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fa4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fa7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fab:	25 00 04 00 00       	and    $0x400,%eax
+  802fb0:	48 85 c0             	test   %rax,%rax
+  802fb3:	74 42                	je     802ff7 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802fb5:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  802fbc:	ff ff ff 
+  802fbf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fc3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fc6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fca:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fcf:	89 c2                	mov    %eax,%edx
+  802fd1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802fd5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fd8:	48 89 ce             	mov    %rcx,%rsi
+  802fdb:	89 c7                	mov    %eax,%edi
+  802fdd:	48 b8 52 9e ff ff ff 	movabs $0xffffffffffff9e52,%rax
+  802fe4:	ff ff ff 
+  802fe7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802feb:	ff d0                	call   *%rax
+		return 0;
+  802fed:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff2:	e9 ae 00 00 00       	jmp    8030a5 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802ff7:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  802ffe:	ff ff ff 
+  803001:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803005:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803008:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80300c:	83 e0 02             	and    $0x2,%eax
+  80300f:	48 85 c0             	test   %rax,%rax
+  803012:	75 1f                	jne    803033 <duppage+0xcb>
+  803014:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80301b:	ff ff ff 
+  80301e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803022:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803025:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803029:	25 00 08 00 00       	and    $0x800,%eax
+  80302e:	48 85 c0             	test   %rax,%rax
+  803031:	74 4c                	je     80307f <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  803033:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  80303a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80303d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803041:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803044:	48 89 ce             	mov    %rcx,%rsi
+  803047:	89 c7                	mov    %eax,%edi
+  803049:	48 b8 52 9e ff ff ff 	movabs $0xffffffffffff9e52,%rax
+  803050:	ff ff ff 
+  803053:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803057:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  803059:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80305c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803060:	48 89 c6             	mov    %rax,%rsi
+  803063:	bf 00 00 00 00       	mov    $0x0,%edi
+  803068:	48 b8 52 9e ff ff ff 	movabs $0xffffffffffff9e52,%rax
+  80306f:	ff ff ff 
+  803072:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803076:	ff d0                	call   *%rax
+		return 0;
+  803078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307d:	eb 26                	jmp    8030a5 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  80307f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803083:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803086:	ba 05 00 00 00       	mov    $0x5,%edx
+  80308b:	48 89 ce             	mov    %rcx,%rsi
+  80308e:	89 c7                	mov    %eax,%edi
+  803090:	48 b8 52 9e ff ff ff 	movabs $0xffffffffffff9e52,%rax
+  803097:	ff ff ff 
+  80309a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80309e:	ff d0                	call   *%rax
+		return 0;
+  8030a0:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  8030a5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030a9:	c9                   	leave
+  8030aa:	c3                   	ret
+
+00000000008030ab <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  8030ab:	55                   	push   %rbp
+  8030ac:	48 89 e5             	mov    %rsp,%rbp
+  8030af:	53                   	push   %rbx
+  8030b0:	48 83 ec 28          	sub    $0x28,%rsp
+  8030b4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030b4 <duphuge+0x9>
+  8030bb:	49 bb 9c 5f 00 00 00 	movabs $0x5f9c,%r11
+  8030c2:	00 00 00 
+  8030c5:	4c 01 db             	add    %r11,%rbx
+  8030c8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030cb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  8030cf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030d3:	48 c1 e8 15          	shr    $0x15,%rax
+  8030d7:	48 89 c2             	mov    %rax,%rdx
+  8030da:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  8030e1:	ff ff ff 
+  8030e4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030e8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030ec:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8030f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030f4:	25 00 04 00 00       	and    $0x400,%eax
+  8030f9:	48 85 c0             	test   %rax,%rax
+  8030fc:	74 0e                	je     80310c <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8030fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803102:	25 07 0e 00 00       	and    $0xe07,%eax
+  803107:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80310a:	eb 1e                	jmp    80312a <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  80310c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803110:	25 02 08 00 00       	and    $0x802,%eax
+  803115:	48 85 c0             	test   %rax,%rax
+  803118:	74 09                	je     803123 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  80311a:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  803121:	eb 07                	jmp    80312a <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  803123:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  80312a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80312d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803131:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803134:	48 89 ce             	mov    %rcx,%rsi
+  803137:	89 c7                	mov    %eax,%edi
+  803139:	48 b8 52 9e ff ff ff 	movabs $0xffffffffffff9e52,%rax
+  803140:	ff ff ff 
+  803143:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803147:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  803149:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80314c:	25 00 08 00 00       	and    $0x800,%eax
+  803151:	85 c0                	test   %eax,%eax
+  803153:	74 1f                	je     803174 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  803155:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803158:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80315c:	48 89 c6             	mov    %rax,%rsi
+  80315f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803164:	48 b8 52 9e ff ff ff 	movabs $0xffffffffffff9e52,%rax
+  80316b:	ff ff ff 
+  80316e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803172:	ff d0                	call   *%rax
+	return 0;
+  803174:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803179:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80317d:	c9                   	leave
+  80317e:	c3                   	ret
+
+000000000080317f <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  80317f:	55                   	push   %rbp
+  803180:	48 89 e5             	mov    %rsp,%rbp
+  803183:	41 57                	push   %r15
+  803185:	53                   	push   %rbx
+  803186:	48 83 ec 10          	sub    $0x10,%rsp
+  80318a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80318a <fork+0xb>
+  803191:	49 bb c6 5e 00 00 00 	movabs $0x5ec6,%r11
+  803198:	00 00 00 
+  80319b:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  80319e:	49 89 df             	mov    %rbx,%r15
+  8031a1:	48 b8 f5 98 ff ff ff 	movabs $0xffffffffffff98f5,%rax
+  8031a8:	ff ff ff 
+  8031ab:	48 01 d8             	add    %rbx,%rax
+  8031ae:	ff d0                	call   *%rax
+  8031b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031b7:	75 42                	jne    8031fb <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8031b9:	49 89 df             	mov    %rbx,%r15
+  8031bc:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  8031c3:	ff ff ff 
+  8031c6:	48 01 d8             	add    %rbx,%rax
+  8031c9:	ff d0                	call   *%rax
+  8031cb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031d0:	48 98                	cltq
+  8031d2:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8031d9:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8031e0:	ff ff ff 
+  8031e3:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8031e7:	48 01 c2             	add    %rax,%rdx
+  8031ea:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8031f1:	ff ff ff 
+  8031f4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031f8:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8031fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8031fe:	48 83 c4 10          	add    $0x10,%rsp
+  803202:	5b                   	pop    %rbx
+  803203:	41 5f                	pop    %r15
+  803205:	5d                   	pop    %rbp
+  803206:	c3                   	ret
+
+0000000000803207 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  803207:	55                   	push   %rbp
+  803208:	48 89 e5             	mov    %rsp,%rbp
+  80320b:	41 57                	push   %r15
+  80320d:	53                   	push   %rbx
+  80320e:	48 83 ec 10          	sub    $0x10,%rsp
+  803212:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803212 <ufork+0xb>
+  803219:	49 bb 3e 5e 00 00 00 	movabs $0x5e3e,%r11
+  803220:	00 00 00 
+  803223:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  803226:	48 b8 49 99 ff ff ff 	movabs $0xffffffffffff9949,%rax
+  80322d:	ff ff ff 
+  803230:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803234:	48 89 c7             	mov    %rax,%rdi
+  803237:	49 89 df             	mov    %rbx,%r15
+  80323a:	48 b8 b7 d4 ff ff ff 	movabs $0xffffffffffffd4b7,%rax
+  803241:	ff ff ff 
+  803244:	48 01 d8             	add    %rbx,%rax
+  803247:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  803249:	b8 07 00 00 00       	mov    $0x7,%eax
+  80324e:	cd 30                	int    $0x30
+  803250:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  803253:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  803256:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  803259:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80325d:	0f 84 03 02 00 00    	je     803466 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  803263:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80326a:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  80326b:	e9 28 01 00 00       	jmp    803398 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  803270:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803274:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803278:	48 89 c2             	mov    %rax,%rdx
+  80327b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803282:	ff ff ff 
+  803285:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803289:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80328d:	83 e0 01             	and    $0x1,%eax
+  803290:	48 85 c0             	test   %rax,%rax
+  803293:	0f 84 f7 00 00 00    	je     803390 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803299:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80329d:	48 c1 e8 15          	shr    $0x15,%rax
+  8032a1:	48 89 c2             	mov    %rax,%rdx
+  8032a4:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  8032ab:	ff ff ff 
+  8032ae:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032b2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032b6:	25 81 00 00 00       	and    $0x81,%eax
+  8032bb:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  8032c1:	75 29                	jne    8032ec <ufork+0xe5>
+					duphuge(child_envid, addr);
+  8032c3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8032c7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032ca:	48 89 d6             	mov    %rdx,%rsi
+  8032cd:	89 c7                	mov    %eax,%edi
+  8032cf:	48 b8 5b a0 ff ff ff 	movabs $0xffffffffffffa05b,%rax
+  8032d6:	ff ff ff 
+  8032d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032dd:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  8032df:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8032e6:	00 
+  8032e7:	e9 ac 00 00 00       	jmp    803398 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8032ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032f0:	48 c1 e8 15          	shr    $0x15,%rax
+  8032f4:	48 89 c2             	mov    %rax,%rdx
+  8032f7:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  8032fe:	ff ff ff 
+  803301:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803305:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803309:	83 e0 01             	and    $0x1,%eax
+  80330c:	48 85 c0             	test   %rax,%rax
+  80330f:	74 75                	je     803386 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  803311:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803315:	48 c1 e8 0c          	shr    $0xc,%rax
+  803319:	48 89 c2             	mov    %rax,%rdx
+  80331c:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  803323:	ff ff ff 
+  803326:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80332a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80332e:	83 e0 01             	and    $0x1,%eax
+  803331:	48 85 c0             	test   %rax,%rax
+  803334:	74 46                	je     80337c <ufork+0x175>
+  803336:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80333a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80333e:	48 89 c2             	mov    %rax,%rdx
+  803341:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  803348:	ff ff ff 
+  80334b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80334f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803353:	83 e0 04             	and    $0x4,%eax
+  803356:	48 85 c0             	test   %rax,%rax
+  803359:	74 21                	je     80337c <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  80335b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80335f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803363:	89 c2                	mov    %eax,%edx
+  803365:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803368:	89 d6                	mov    %edx,%esi
+  80336a:	89 c7                	mov    %eax,%edi
+  80336c:	48 b8 18 9f ff ff ff 	movabs $0xffffffffffff9f18,%rax
+  803373:	ff ff ff 
+  803376:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80337a:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  80337c:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803383:	00 
+  803384:	eb 12                	jmp    803398 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803386:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80338d:	00 
+  80338e:	eb 08                	jmp    803398 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  803390:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803397:	40 
+		for (; addr < USTACKTOP;){
+  803398:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80339d:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8033a1:	0f 83 c9 fe ff ff    	jae    803270 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  8033a7:	48 b8 7f 9d ff ff ff 	movabs $0xffffffffffff9d7f,%rax
+  8033ae:	ff ff ff 
+  8033b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033b5:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  8033b7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033ba:	ba 07 00 00 00       	mov    $0x7,%edx
+  8033bf:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8033c4:	48 89 ce             	mov    %rcx,%rsi
+  8033c7:	89 c7                	mov    %eax,%edi
+  8033c9:	49 89 df             	mov    %rbx,%r15
+  8033cc:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  8033d3:	ff ff ff 
+  8033d6:	48 01 d8             	add    %rbx,%rax
+  8033d9:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8033db:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033de:	48 ba b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rdx
+  8033e5:	ff ff ff 
+  8033e8:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8033ec:	48 89 d6             	mov    %rdx,%rsi
+  8033ef:	89 c7                	mov    %eax,%edi
+  8033f1:	49 89 df             	mov    %rbx,%r15
+  8033f4:	48 b8 96 93 ff ff ff 	movabs $0xffffffffffff9396,%rax
+  8033fb:	ff ff ff 
+  8033fe:	48 01 d8             	add    %rbx,%rax
+  803401:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803403:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803406:	be 02 00 00 00       	mov    $0x2,%esi
+  80340b:	89 c7                	mov    %eax,%edi
+  80340d:	49 89 df             	mov    %rbx,%r15
+  803410:	48 b8 d7 92 ff ff ff 	movabs $0xffffffffffff92d7,%rax
+  803417:	ff ff ff 
+  80341a:	48 01 d8             	add    %rbx,%rax
+  80341d:	ff d0                	call   *%rax
+  80341f:	85 c0                	test   %eax,%eax
+  803421:	74 3e                	je     803461 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803423:	48 b8 8f e4 ff ff ff 	movabs $0xffffffffffffe48f,%rax
+  80342a:	ff ff ff 
+  80342d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803431:	48 89 c2             	mov    %rax,%rdx
+  803434:	be 07 01 00 00       	mov    $0x107,%esi
+  803439:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  803440:	ff ff ff 
+  803443:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803447:	48 89 c7             	mov    %rax,%rdi
+  80344a:	49 89 df             	mov    %rbx,%r15
+  80344d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803452:	48 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%rcx
+  803459:	ff ff ff 
+  80345c:	48 01 d9             	add    %rbx,%rcx
+  80345f:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803461:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803464:	eb 59                	jmp    8034bf <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803466:	49 89 df             	mov    %rbx,%r15
+  803469:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  803470:	ff ff ff 
+  803473:	48 01 d8             	add    %rbx,%rax
+  803476:	ff d0                	call   *%rax
+  803478:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80347d:	48 98                	cltq
+  80347f:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803486:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80348d:	ff ff ff 
+  803490:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803494:	48 01 c2             	add    %rax,%rdx
+  803497:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80349e:	ff ff ff 
+  8034a1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034a5:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  8034a8:	48 b8 b0 1f 00 00 00 	movabs $0x1fb0,%rax
+  8034af:	00 00 00 
+  8034b2:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  8034b9:	00 
+		return 0;
+  8034ba:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  8034bf:	48 83 c4 10          	add    $0x10,%rsp
+  8034c3:	5b                   	pop    %rbx
+  8034c4:	41 5f                	pop    %r15
+  8034c6:	5d                   	pop    %rbp
+  8034c7:	c3                   	ret
+
+00000000008034c8 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8034c8:	55                   	push   %rbp
+  8034c9:	48 89 e5             	mov    %rsp,%rbp
+  8034cc:	41 57                	push   %r15
+  8034ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8034d2:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8034d2 <sfork+0xa>
+  8034d9:	49 bb 7e 5b 00 00 00 	movabs $0x5b7e,%r11
+  8034e0:	00 00 00 
+  8034e3:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8034e6:	48 b8 aa e4 ff ff ff 	movabs $0xffffffffffffe4aa,%rax
+  8034ed:	ff ff ff 
+  8034f0:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8034f4:	48 89 c2             	mov    %rax,%rdx
+  8034f7:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8034fc:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  803503:	ff ff ff 
+  803506:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80350a:	48 89 c7             	mov    %rax,%rdi
+  80350d:	49 89 cf             	mov    %rcx,%r15
+  803510:	b8 00 00 00 00       	mov    $0x0,%eax
+  803515:	49 b8 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%r8
+  80351c:	ff ff ff 
+  80351f:	49 01 c8             	add    %rcx,%r8
+  803522:	41 ff d0             	call   *%r8
+
+0000000000803525 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803525:	55                   	push   %rbp
+  803526:	48 89 e5             	mov    %rsp,%rbp
+  803529:	48 83 ec 08          	sub    $0x8,%rsp
+  80352d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80352d <fd2num+0x8>
+  803534:	49 bb 23 5b 00 00 00 	movabs $0x5b23,%r11
+  80353b:	00 00 00 
+  80353e:	4c 01 d8             	add    %r11,%rax
+  803541:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803545:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803549:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803550:	ff ff ff 
+  803553:	48 01 d0             	add    %rdx,%rax
+  803556:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80355a:	c9                   	leave
+  80355b:	c3                   	ret
+
+000000000080355c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80355c:	55                   	push   %rbp
+  80355d:	48 89 e5             	mov    %rsp,%rbp
+  803560:	48 83 ec 08          	sub    $0x8,%rsp
+  803564:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803564 <fd2data+0x8>
+  80356b:	49 bb ec 5a 00 00 00 	movabs $0x5aec,%r11
+  803572:	00 00 00 
+  803575:	4c 01 d8             	add    %r11,%rax
+  803578:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80357c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803580:	48 89 d7             	mov    %rdx,%rdi
+  803583:	48 ba d5 a4 ff ff ff 	movabs $0xffffffffffffa4d5,%rdx
+  80358a:	ff ff ff 
+  80358d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803591:	ff d0                	call   *%rax
+  803593:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803599:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80359d:	c9                   	leave
+  80359e:	c3                   	ret
+
+000000000080359f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80359f:	55                   	push   %rbp
+  8035a0:	48 89 e5             	mov    %rsp,%rbp
+  8035a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8035a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8035a7 <fd_alloc+0x8>
+  8035ae:	49 bb a9 5a 00 00 00 	movabs $0x5aa9,%r11
+  8035b5:	00 00 00 
+  8035b8:	4c 01 d8             	add    %r11,%rax
+  8035bb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8035bf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035c6:	eb 75                	jmp    80363d <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8035c8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8035cb:	48 63 d2             	movslq %edx,%rdx
+  8035ce:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8035d5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8035d9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8035dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8035e1:	48 89 d1             	mov    %rdx,%rcx
+  8035e4:	48 c1 e9 15          	shr    $0x15,%rcx
+  8035e8:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8035ef:	ff ff ff 
+  8035f2:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8035f6:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8035fa:	83 e2 01             	and    $0x1,%edx
+  8035fd:	48 85 d2             	test   %rdx,%rdx
+  803600:	74 25                	je     803627 <fd_alloc+0x88>
+  803602:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803606:	48 89 d1             	mov    %rdx,%rcx
+  803609:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80360d:	48 ba c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rdx
+  803614:	ff ff ff 
+  803617:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80361b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80361f:	83 e2 01             	and    $0x1,%edx
+  803622:	48 85 d2             	test   %rdx,%rdx
+  803625:	75 12                	jne    803639 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803627:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80362b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80362f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803632:	b8 00 00 00 00       	mov    $0x0,%eax
+  803637:	eb 1a                	jmp    803653 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803639:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80363d:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803641:	7e 85                	jle    8035c8 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803647:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  80364e:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803653:	c9                   	leave
+  803654:	c3                   	ret
+
+0000000000803655 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803655:	55                   	push   %rbp
+  803656:	48 89 e5             	mov    %rsp,%rbp
+  803659:	48 83 ec 20          	sub    $0x20,%rsp
+  80365d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80365d <fd_lookup+0x8>
+  803664:	49 bb f3 59 00 00 00 	movabs $0x59f3,%r11
+  80366b:	00 00 00 
+  80366e:	4c 01 d8             	add    %r11,%rax
+  803671:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803674:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803678:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80367c:	78 06                	js     803684 <fd_lookup+0x2f>
+  80367e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803682:	7e 07                	jle    80368b <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803684:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803689:	eb 73                	jmp    8036fe <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  80368b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80368e:	48 63 d2             	movslq %edx,%rdx
+  803691:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803698:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80369c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8036a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036a4:	48 89 d1             	mov    %rdx,%rcx
+  8036a7:	48 c1 e9 15          	shr    $0x15,%rcx
+  8036ab:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8036b2:	ff ff ff 
+  8036b5:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8036b9:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8036bd:	83 e2 01             	and    $0x1,%edx
+  8036c0:	48 85 d2             	test   %rdx,%rdx
+  8036c3:	74 22                	je     8036e7 <fd_lookup+0x92>
+  8036c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036c9:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8036cd:	48 b9 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rcx
+  8036d4:	ff ff ff 
+  8036d7:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8036db:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036df:	83 e0 01             	and    $0x1,%eax
+  8036e2:	48 85 c0             	test   %rax,%rax
+  8036e5:	75 07                	jne    8036ee <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8036e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036ec:	eb 10                	jmp    8036fe <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8036ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036f6:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8036f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036fe:	c9                   	leave
+  8036ff:	c3                   	ret
+
+0000000000803700 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803700:	55                   	push   %rbp
+  803701:	48 89 e5             	mov    %rsp,%rbp
+  803704:	41 57                	push   %r15
+  803706:	53                   	push   %rbx
+  803707:	48 83 ec 30          	sub    $0x30,%rsp
+  80370b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80370b <fd_close+0xb>
+  803712:	49 bb 45 59 00 00 00 	movabs $0x5945,%r11
+  803719:	00 00 00 
+  80371c:	4c 01 db             	add    %r11,%rbx
+  80371f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803723:	89 f0                	mov    %esi,%eax
+  803725:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803728:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80372c:	48 89 c7             	mov    %rax,%rdi
+  80372f:	48 b8 d5 a4 ff ff ff 	movabs $0xffffffffffffa4d5,%rax
+  803736:	ff ff ff 
+  803739:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80373d:	ff d0                	call   *%rax
+  80373f:	89 c2                	mov    %eax,%edx
+  803741:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803745:	48 89 c6             	mov    %rax,%rsi
+  803748:	89 d7                	mov    %edx,%edi
+  80374a:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  803751:	ff ff ff 
+  803754:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803758:	ff d0                	call   *%rax
+  80375a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80375d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803761:	78 0a                	js     80376d <fd_close+0x6d>
+	    || fd != fd2)
+  803763:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803767:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80376b:	74 12                	je     80377f <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80376d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803771:	74 05                	je     803778 <fd_close+0x78>
+  803773:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803776:	eb 7a                	jmp    8037f2 <fd_close+0xf2>
+  803778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377d:	eb 73                	jmp    8037f2 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80377f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803783:	8b 00                	mov    (%rax),%eax
+  803785:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803789:	48 89 d6             	mov    %rdx,%rsi
+  80378c:	89 c7                	mov    %eax,%edi
+  80378e:	48 b8 ab a7 ff ff ff 	movabs $0xffffffffffffa7ab,%rax
+  803795:	ff ff ff 
+  803798:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80379c:	ff d0                	call   *%rax
+  80379e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037a1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037a5:	78 2a                	js     8037d1 <fd_close+0xd1>
+		if (dev->dev_close)
+  8037a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037ab:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8037af:	48 85 c0             	test   %rax,%rax
+  8037b2:	74 16                	je     8037ca <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8037b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037b8:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8037bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037c0:	48 89 c7             	mov    %rax,%rdi
+  8037c3:	ff d2                	call   *%rdx
+  8037c5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037c8:	eb 07                	jmp    8037d1 <fd_close+0xd1>
+		else
+			r = 0;
+  8037ca:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8037d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037d5:	48 89 c6             	mov    %rax,%rsi
+  8037d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037dd:	49 89 df             	mov    %rbx,%r15
+  8037e0:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  8037e7:	ff ff ff 
+  8037ea:	48 01 d8             	add    %rbx,%rax
+  8037ed:	ff d0                	call   *%rax
+	return r;
+  8037ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8037f2:	48 83 c4 30          	add    $0x30,%rsp
+  8037f6:	5b                   	pop    %rbx
+  8037f7:	41 5f                	pop    %r15
+  8037f9:	5d                   	pop    %rbp
+  8037fa:	c3                   	ret
+
+00000000008037fb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8037fb:	55                   	push   %rbp
+  8037fc:	48 89 e5             	mov    %rsp,%rbp
+  8037ff:	41 57                	push   %r15
+  803801:	48 83 ec 28          	sub    $0x28,%rsp
+  803805:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803805 <dev_lookup+0xa>
+  80380c:	49 bb 4b 58 00 00 00 	movabs $0x584b,%r11
+  803813:	00 00 00 
+  803816:	4c 01 d9             	add    %r11,%rcx
+  803819:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80381c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803820:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803827:	eb 45                	jmp    80386e <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803829:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  803830:	00 00 00 
+  803833:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803836:	48 98                	cltq
+  803838:	48 01 ca             	add    %rcx,%rdx
+  80383b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80383f:	8b 00                	mov    (%rax),%eax
+  803841:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803844:	75 24                	jne    80386a <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803846:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  80384d:	00 00 00 
+  803850:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803853:	48 98                	cltq
+  803855:	48 01 ca             	add    %rcx,%rdx
+  803858:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80385c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803860:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803863:	b8 00 00 00 00       	mov    $0x0,%eax
+  803868:	eb 74                	jmp    8038de <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  80386a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80386e:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  803875:	00 00 00 
+  803878:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80387b:	48 98                	cltq
+  80387d:	48 01 ca             	add    %rcx,%rdx
+  803880:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803884:	48 85 c0             	test   %rax,%rax
+  803887:	75 a0                	jne    803829 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803889:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803890:	ff ff ff 
+  803893:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803897:	48 8b 00             	mov    (%rax),%rax
+  80389a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8038a0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8038a3:	89 c6                	mov    %eax,%esi
+  8038a5:	48 b8 c0 e4 ff ff ff 	movabs $0xffffffffffffe4c0,%rax
+  8038ac:	ff ff ff 
+  8038af:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8038b3:	48 89 c7             	mov    %rax,%rdi
+  8038b6:	49 89 cf             	mov    %rcx,%r15
+  8038b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038be:	49 b8 22 77 ff ff ff 	movabs $0xffffffffffff7722,%r8
+  8038c5:	ff ff ff 
+  8038c8:	49 01 c8             	add    %rcx,%r8
+  8038cb:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8038ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038d2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8038d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8038de:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8038e2:	c9                   	leave
+  8038e3:	c3                   	ret
+
+00000000008038e4 <close>:
+
+int
+close(int fdnum)
+{
+  8038e4:	55                   	push   %rbp
+  8038e5:	48 89 e5             	mov    %rsp,%rbp
+  8038e8:	53                   	push   %rbx
+  8038e9:	48 83 ec 28          	sub    $0x28,%rsp
+  8038ed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038ed <close+0x9>
+  8038f4:	49 bb 63 57 00 00 00 	movabs $0x5763,%r11
+  8038fb:	00 00 00 
+  8038fe:	4c 01 db             	add    %r11,%rbx
+  803901:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803904:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803908:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80390b:	48 89 d6             	mov    %rdx,%rsi
+  80390e:	89 c7                	mov    %eax,%edi
+  803910:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  803917:	ff ff ff 
+  80391a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80391e:	ff d0                	call   *%rax
+  803920:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803923:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803927:	79 05                	jns    80392e <close+0x4a>
+		return r;
+  803929:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80392c:	eb 1c                	jmp    80394a <close+0x66>
+	else
+		return fd_close(fd, 1);
+  80392e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803932:	be 01 00 00 00       	mov    $0x1,%esi
+  803937:	48 89 c7             	mov    %rax,%rdi
+  80393a:	48 b8 b0 a6 ff ff ff 	movabs $0xffffffffffffa6b0,%rax
+  803941:	ff ff ff 
+  803944:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803948:	ff d0                	call   *%rax
+}
+  80394a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80394e:	c9                   	leave
+  80394f:	c3                   	ret
+
+0000000000803950 <close_all>:
+
+void
+close_all(void)
+{
+  803950:	55                   	push   %rbp
+  803951:	48 89 e5             	mov    %rsp,%rbp
+  803954:	53                   	push   %rbx
+  803955:	48 83 ec 18          	sub    $0x18,%rsp
+  803959:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803959 <close_all+0x9>
+  803960:	49 bb f7 56 00 00 00 	movabs $0x56f7,%r11
+  803967:	00 00 00 
+  80396a:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80396d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803974:	eb 19                	jmp    80398f <close_all+0x3f>
+		close(i);
+  803976:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803979:	89 c7                	mov    %eax,%edi
+  80397b:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  803982:	ff ff ff 
+  803985:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803989:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  80398b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80398f:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803993:	7e e1                	jle    803976 <close_all+0x26>
+}
+  803995:	90                   	nop
+  803996:	90                   	nop
+  803997:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80399b:	c9                   	leave
+  80399c:	c3                   	ret
+
+000000000080399d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80399d:	55                   	push   %rbp
+  80399e:	48 89 e5             	mov    %rsp,%rbp
+  8039a1:	41 57                	push   %r15
+  8039a3:	53                   	push   %rbx
+  8039a4:	48 83 ec 40          	sub    $0x40,%rsp
+  8039a8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039a8 <dup+0xb>
+  8039af:	49 bb a8 56 00 00 00 	movabs $0x56a8,%r11
+  8039b6:	00 00 00 
+  8039b9:	4c 01 db             	add    %r11,%rbx
+  8039bc:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8039bf:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8039c2:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8039c6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8039c9:	48 89 d6             	mov    %rdx,%rsi
+  8039cc:	89 c7                	mov    %eax,%edi
+  8039ce:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  8039d5:	ff ff ff 
+  8039d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039dc:	ff d0                	call   *%rax
+  8039de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039e1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039e5:	79 08                	jns    8039ef <dup+0x52>
+		return r;
+  8039e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039ea:	e9 a4 01 00 00       	jmp    803b93 <dup+0x1f6>
+	close(newfdnum);
+  8039ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039f2:	89 c7                	mov    %eax,%edi
+  8039f4:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  8039fb:	ff ff ff 
+  8039fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a02:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803a04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a07:	48 98                	cltq
+  803a09:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803a0f:	48 c1 e0 0c          	shl    $0xc,%rax
+  803a13:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803a17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a1b:	48 89 c7             	mov    %rax,%rdi
+  803a1e:	48 b8 0c a5 ff ff ff 	movabs $0xffffffffffffa50c,%rax
+  803a25:	ff ff ff 
+  803a28:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a2c:	ff d0                	call   *%rax
+  803a2e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803a32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a36:	48 89 c7             	mov    %rax,%rdi
+  803a39:	48 b8 0c a5 ff ff ff 	movabs $0xffffffffffffa50c,%rax
+  803a40:	ff ff ff 
+  803a43:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a47:	ff d0                	call   *%rax
+  803a49:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803a4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a51:	48 c1 e8 15          	shr    $0x15,%rax
+  803a55:	48 89 c2             	mov    %rax,%rdx
+  803a58:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  803a5f:	ff ff ff 
+  803a62:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a66:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a6a:	83 e0 01             	and    $0x1,%eax
+  803a6d:	48 85 c0             	test   %rax,%rax
+  803a70:	74 7f                	je     803af1 <dup+0x154>
+  803a72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a76:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a7a:	48 89 c2             	mov    %rax,%rdx
+  803a7d:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  803a84:	ff ff ff 
+  803a87:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a8b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a8f:	83 e0 01             	and    $0x1,%eax
+  803a92:	48 85 c0             	test   %rax,%rax
+  803a95:	74 5a                	je     803af1 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803a97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a9b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a9f:	48 89 c2             	mov    %rax,%rdx
+  803aa2:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  803aa9:	ff ff ff 
+  803aac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ab0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ab4:	25 07 0e 00 00       	and    $0xe07,%eax
+  803ab9:	89 c1                	mov    %eax,%ecx
+  803abb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803abf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ac3:	41 89 c8             	mov    %ecx,%r8d
+  803ac6:	48 89 d1             	mov    %rdx,%rcx
+  803ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ace:	48 89 c6             	mov    %rax,%rsi
+  803ad1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad6:	49 89 df             	mov    %rbx,%r15
+  803ad9:	48 b8 05 92 ff ff ff 	movabs $0xffffffffffff9205,%rax
+  803ae0:	ff ff ff 
+  803ae3:	48 01 d8             	add    %rbx,%rax
+  803ae6:	ff d0                	call   *%rax
+  803ae8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803aeb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803aef:	78 5f                	js     803b50 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803af1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803af5:	48 c1 e8 0c          	shr    $0xc,%rax
+  803af9:	48 89 c2             	mov    %rax,%rdx
+  803afc:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  803b03:	ff ff ff 
+  803b06:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b0a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b0e:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b13:	89 c1                	mov    %eax,%ecx
+  803b15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b19:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b1d:	41 89 c8             	mov    %ecx,%r8d
+  803b20:	48 89 d1             	mov    %rdx,%rcx
+  803b23:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b28:	48 89 c6             	mov    %rax,%rsi
+  803b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b30:	49 89 df             	mov    %rbx,%r15
+  803b33:	48 b8 05 92 ff ff ff 	movabs $0xffffffffffff9205,%rax
+  803b3a:	ff ff ff 
+  803b3d:	48 01 d8             	add    %rbx,%rax
+  803b40:	ff d0                	call   *%rax
+  803b42:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b49:	78 08                	js     803b53 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803b4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b4e:	eb 43                	jmp    803b93 <dup+0x1f6>
+			goto err;
+  803b50:	90                   	nop
+  803b51:	eb 01                	jmp    803b54 <dup+0x1b7>
+		goto err;
+  803b53:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803b54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b58:	48 89 c6             	mov    %rax,%rsi
+  803b5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b60:	49 89 df             	mov    %rbx,%r15
+  803b63:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  803b6a:	ff ff ff 
+  803b6d:	48 01 d8             	add    %rbx,%rax
+  803b70:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803b72:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b76:	48 89 c6             	mov    %rax,%rsi
+  803b79:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b7e:	49 89 df             	mov    %rbx,%r15
+  803b81:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  803b88:	ff ff ff 
+  803b8b:	48 01 d8             	add    %rbx,%rax
+  803b8e:	ff d0                	call   *%rax
+	return r;
+  803b90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803b93:	48 83 c4 40          	add    $0x40,%rsp
+  803b97:	5b                   	pop    %rbx
+  803b98:	41 5f                	pop    %r15
+  803b9a:	5d                   	pop    %rbp
+  803b9b:	c3                   	ret
+
+0000000000803b9c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803b9c:	55                   	push   %rbp
+  803b9d:	48 89 e5             	mov    %rsp,%rbp
+  803ba0:	41 57                	push   %r15
+  803ba2:	53                   	push   %rbx
+  803ba3:	48 83 ec 40          	sub    $0x40,%rsp
+  803ba7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ba7 <read+0xb>
+  803bae:	49 bb a9 54 00 00 00 	movabs $0x54a9,%r11
+  803bb5:	00 00 00 
+  803bb8:	4c 01 db             	add    %r11,%rbx
+  803bbb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803bbe:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803bc2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803bc6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803bca:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803bcd:	48 89 d6             	mov    %rdx,%rsi
+  803bd0:	89 c7                	mov    %eax,%edi
+  803bd2:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  803bd9:	ff ff ff 
+  803bdc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803be0:	ff d0                	call   *%rax
+  803be2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803be5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803be9:	78 28                	js     803c13 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803beb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bef:	8b 00                	mov    (%rax),%eax
+  803bf1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803bf5:	48 89 d6             	mov    %rdx,%rsi
+  803bf8:	89 c7                	mov    %eax,%edi
+  803bfa:	48 b8 ab a7 ff ff ff 	movabs $0xffffffffffffa7ab,%rax
+  803c01:	ff ff ff 
+  803c04:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c08:	ff d0                	call   *%rax
+  803c0a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c0d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c11:	79 08                	jns    803c1b <read+0x7f>
+		return r;
+  803c13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c16:	e9 8b 00 00 00       	jmp    803ca6 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803c1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c1f:	8b 40 08             	mov    0x8(%rax),%eax
+  803c22:	83 e0 03             	and    $0x3,%eax
+  803c25:	83 f8 01             	cmp    $0x1,%eax
+  803c28:	75 4b                	jne    803c75 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803c2a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803c31:	ff ff ff 
+  803c34:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c38:	48 8b 00             	mov    (%rax),%rax
+  803c3b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803c41:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803c44:	89 c6                	mov    %eax,%esi
+  803c46:	48 b8 df e4 ff ff ff 	movabs $0xffffffffffffe4df,%rax
+  803c4d:	ff ff ff 
+  803c50:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c54:	48 89 c7             	mov    %rax,%rdi
+  803c57:	49 89 df             	mov    %rbx,%r15
+  803c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c5f:	48 b9 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rcx
+  803c66:	ff ff ff 
+  803c69:	48 01 d9             	add    %rbx,%rcx
+  803c6c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803c6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c73:	eb 31                	jmp    803ca6 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803c75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c79:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803c7d:	48 85 c0             	test   %rax,%rax
+  803c80:	75 07                	jne    803c89 <read+0xed>
+		return -E_NOT_SUPP;
+  803c82:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c87:	eb 1d                	jmp    803ca6 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803c89:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c8d:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803c91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c95:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803c99:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c9d:	48 89 ce             	mov    %rcx,%rsi
+  803ca0:	48 89 c7             	mov    %rax,%rdi
+  803ca3:	41 ff d0             	call   *%r8
+}
+  803ca6:	48 83 c4 40          	add    $0x40,%rsp
+  803caa:	5b                   	pop    %rbx
+  803cab:	41 5f                	pop    %r15
+  803cad:	5d                   	pop    %rbp
+  803cae:	c3                   	ret
+
+0000000000803caf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803caf:	55                   	push   %rbp
+  803cb0:	48 89 e5             	mov    %rsp,%rbp
+  803cb3:	53                   	push   %rbx
+  803cb4:	48 83 ec 38          	sub    $0x38,%rsp
+  803cb8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cb8 <readn+0x9>
+  803cbf:	49 bb 98 53 00 00 00 	movabs $0x5398,%r11
+  803cc6:	00 00 00 
+  803cc9:	4c 01 db             	add    %r11,%rbx
+  803ccc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ccf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803cd3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803cd7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803cde:	eb 4b                	jmp    803d2b <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803ce0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ce3:	48 98                	cltq
+  803ce5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803ce9:	48 29 c2             	sub    %rax,%rdx
+  803cec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cef:	48 63 c8             	movslq %eax,%rcx
+  803cf2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cf6:	48 01 c1             	add    %rax,%rcx
+  803cf9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cfc:	48 89 ce             	mov    %rcx,%rsi
+  803cff:	89 c7                	mov    %eax,%edi
+  803d01:	48 b8 4c ab ff ff ff 	movabs $0xffffffffffffab4c,%rax
+  803d08:	ff ff ff 
+  803d0b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d0f:	ff d0                	call   *%rax
+  803d11:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803d14:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803d18:	79 05                	jns    803d1f <readn+0x70>
+			return m;
+  803d1a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d1d:	eb 1d                	jmp    803d3c <readn+0x8d>
+		if (m == 0)
+  803d1f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803d23:	74 13                	je     803d38 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803d25:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d28:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803d2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d2e:	48 98                	cltq
+  803d30:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803d34:	72 aa                	jb     803ce0 <readn+0x31>
+  803d36:	eb 01                	jmp    803d39 <readn+0x8a>
+			break;
+  803d38:	90                   	nop
+	}
+	return tot;
+  803d39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803d3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d40:	c9                   	leave
+  803d41:	c3                   	ret
+
+0000000000803d42 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803d42:	55                   	push   %rbp
+  803d43:	48 89 e5             	mov    %rsp,%rbp
+  803d46:	41 57                	push   %r15
+  803d48:	53                   	push   %rbx
+  803d49:	48 83 ec 40          	sub    $0x40,%rsp
+  803d4d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d4d <write+0xb>
+  803d54:	49 bb 03 53 00 00 00 	movabs $0x5303,%r11
+  803d5b:	00 00 00 
+  803d5e:	4c 01 db             	add    %r11,%rbx
+  803d61:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803d64:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d68:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803d6c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803d70:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803d73:	48 89 d6             	mov    %rdx,%rsi
+  803d76:	89 c7                	mov    %eax,%edi
+  803d78:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  803d7f:	ff ff ff 
+  803d82:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d86:	ff d0                	call   *%rax
+  803d88:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d8b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d8f:	78 28                	js     803db9 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d95:	8b 00                	mov    (%rax),%eax
+  803d97:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803d9b:	48 89 d6             	mov    %rdx,%rsi
+  803d9e:	89 c7                	mov    %eax,%edi
+  803da0:	48 b8 ab a7 ff ff ff 	movabs $0xffffffffffffa7ab,%rax
+  803da7:	ff ff ff 
+  803daa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dae:	ff d0                	call   *%rax
+  803db0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803db3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803db7:	79 08                	jns    803dc1 <write+0x7f>
+		return r;
+  803db9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dbc:	e9 8a 00 00 00       	jmp    803e4b <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803dc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dc5:	8b 40 08             	mov    0x8(%rax),%eax
+  803dc8:	83 e0 03             	and    $0x3,%eax
+  803dcb:	85 c0                	test   %eax,%eax
+  803dcd:	75 4b                	jne    803e1a <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803dcf:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803dd6:	ff ff ff 
+  803dd9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ddd:	48 8b 00             	mov    (%rax),%rax
+  803de0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803de6:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803de9:	89 c6                	mov    %eax,%esi
+  803deb:	48 b8 fb e4 ff ff ff 	movabs $0xffffffffffffe4fb,%rax
+  803df2:	ff ff ff 
+  803df5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803df9:	48 89 c7             	mov    %rax,%rdi
+  803dfc:	49 89 df             	mov    %rbx,%r15
+  803dff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e04:	48 b9 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rcx
+  803e0b:	ff ff ff 
+  803e0e:	48 01 d9             	add    %rbx,%rcx
+  803e11:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803e13:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e18:	eb 31                	jmp    803e4b <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803e1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e1e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803e22:	48 85 c0             	test   %rax,%rax
+  803e25:	75 07                	jne    803e2e <write+0xec>
+		return -E_NOT_SUPP;
+  803e27:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803e2c:	eb 1d                	jmp    803e4b <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803e2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e32:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803e36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e3a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e3e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e42:	48 89 ce             	mov    %rcx,%rsi
+  803e45:	48 89 c7             	mov    %rax,%rdi
+  803e48:	41 ff d0             	call   *%r8
+}
+  803e4b:	48 83 c4 40          	add    $0x40,%rsp
+  803e4f:	5b                   	pop    %rbx
+  803e50:	41 5f                	pop    %r15
+  803e52:	5d                   	pop    %rbp
+  803e53:	c3                   	ret
+
+0000000000803e54 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803e54:	55                   	push   %rbp
+  803e55:	48 89 e5             	mov    %rsp,%rbp
+  803e58:	48 83 ec 18          	sub    $0x18,%rsp
+  803e5c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e5c <seek+0x8>
+  803e63:	49 bb f4 51 00 00 00 	movabs $0x51f4,%r11
+  803e6a:	00 00 00 
+  803e6d:	4c 01 d8             	add    %r11,%rax
+  803e70:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e73:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e76:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803e7a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803e7d:	48 89 ce             	mov    %rcx,%rsi
+  803e80:	89 d7                	mov    %edx,%edi
+  803e82:	48 ba 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rdx
+  803e89:	ff ff ff 
+  803e8c:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803e90:	ff d0                	call   *%rax
+  803e92:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e95:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e99:	79 05                	jns    803ea0 <seek+0x4c>
+		return r;
+  803e9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e9e:	eb 0f                	jmp    803eaf <seek+0x5b>
+	fd->fd_offset = offset;
+  803ea0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ea4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803ea7:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eaf:	c9                   	leave
+  803eb0:	c3                   	ret
+
+0000000000803eb1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803eb1:	55                   	push   %rbp
+  803eb2:	48 89 e5             	mov    %rsp,%rbp
+  803eb5:	41 57                	push   %r15
+  803eb7:	53                   	push   %rbx
+  803eb8:	48 83 ec 30          	sub    $0x30,%rsp
+  803ebc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ebc <ftruncate+0xb>
+  803ec3:	49 bb 94 51 00 00 00 	movabs $0x5194,%r11
+  803eca:	00 00 00 
+  803ecd:	4c 01 db             	add    %r11,%rbx
+  803ed0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803ed3:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803ed6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803eda:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803edd:	48 89 d6             	mov    %rdx,%rsi
+  803ee0:	89 c7                	mov    %eax,%edi
+  803ee2:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  803ee9:	ff ff ff 
+  803eec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ef0:	ff d0                	call   *%rax
+  803ef2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ef5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ef9:	78 28                	js     803f23 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803efb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803eff:	8b 00                	mov    (%rax),%eax
+  803f01:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f05:	48 89 d6             	mov    %rdx,%rsi
+  803f08:	89 c7                	mov    %eax,%edi
+  803f0a:	48 b8 ab a7 ff ff ff 	movabs $0xffffffffffffa7ab,%rax
+  803f11:	ff ff ff 
+  803f14:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f18:	ff d0                	call   *%rax
+  803f1a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f1d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f21:	79 08                	jns    803f2b <ftruncate+0x7a>
+		return r;
+  803f23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f26:	e9 83 00 00 00       	jmp    803fae <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803f2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f2f:	8b 40 08             	mov    0x8(%rax),%eax
+  803f32:	83 e0 03             	and    $0x3,%eax
+  803f35:	85 c0                	test   %eax,%eax
+  803f37:	75 4b                	jne    803f84 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803f39:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803f40:	ff ff ff 
+  803f43:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f47:	48 8b 00             	mov    (%rax),%rax
+  803f4a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803f50:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803f53:	89 c6                	mov    %eax,%esi
+  803f55:	48 b8 18 e5 ff ff ff 	movabs $0xffffffffffffe518,%rax
+  803f5c:	ff ff ff 
+  803f5f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f63:	48 89 c7             	mov    %rax,%rdi
+  803f66:	49 89 df             	mov    %rbx,%r15
+  803f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6e:	48 b9 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rcx
+  803f75:	ff ff ff 
+  803f78:	48 01 d9             	add    %rbx,%rcx
+  803f7b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803f7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f82:	eb 2a                	jmp    803fae <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803f84:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f88:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803f8c:	48 85 c0             	test   %rax,%rax
+  803f8f:	75 07                	jne    803f98 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803f91:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f96:	eb 16                	jmp    803fae <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803f98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f9c:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803fa0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fa4:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803fa7:	89 d6                	mov    %edx,%esi
+  803fa9:	48 89 c7             	mov    %rax,%rdi
+  803fac:	ff d1                	call   *%rcx
+}
+  803fae:	48 83 c4 30          	add    $0x30,%rsp
+  803fb2:	5b                   	pop    %rbx
+  803fb3:	41 5f                	pop    %r15
+  803fb5:	5d                   	pop    %rbp
+  803fb6:	c3                   	ret
+
+0000000000803fb7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803fb7:	55                   	push   %rbp
+  803fb8:	48 89 e5             	mov    %rsp,%rbp
+  803fbb:	53                   	push   %rbx
+  803fbc:	48 83 ec 38          	sub    $0x38,%rsp
+  803fc0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fc0 <fstat+0x9>
+  803fc7:	49 bb 90 50 00 00 00 	movabs $0x5090,%r11
+  803fce:	00 00 00 
+  803fd1:	4c 01 db             	add    %r11,%rbx
+  803fd4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803fd7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803fdb:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803fdf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803fe2:	48 89 d6             	mov    %rdx,%rsi
+  803fe5:	89 c7                	mov    %eax,%edi
+  803fe7:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  803fee:	ff ff ff 
+  803ff1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ff5:	ff d0                	call   *%rax
+  803ff7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ffa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ffe:	78 28                	js     804028 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804000:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804004:	8b 00                	mov    (%rax),%eax
+  804006:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80400a:	48 89 d6             	mov    %rdx,%rsi
+  80400d:	89 c7                	mov    %eax,%edi
+  80400f:	48 b8 ab a7 ff ff ff 	movabs $0xffffffffffffa7ab,%rax
+  804016:	ff ff ff 
+  804019:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80401d:	ff d0                	call   *%rax
+  80401f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804022:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804026:	79 05                	jns    80402d <fstat+0x76>
+		return r;
+  804028:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80402b:	eb 5e                	jmp    80408b <fstat+0xd4>
+	if (!dev->dev_stat)
+  80402d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804031:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804035:	48 85 c0             	test   %rax,%rax
+  804038:	75 07                	jne    804041 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80403a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80403f:	eb 4a                	jmp    80408b <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804041:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804045:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804048:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80404c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804053:	00 00 00 
+	stat->st_isdir = 0;
+  804056:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80405a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804061:	00 00 00 
+	stat->st_dev = dev;
+  804064:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804068:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80406c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804073:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804077:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80407b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80407f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804083:	48 89 d6             	mov    %rdx,%rsi
+  804086:	48 89 c7             	mov    %rax,%rdi
+  804089:	ff d1                	call   *%rcx
+}
+  80408b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80408f:	c9                   	leave
+  804090:	c3                   	ret
+
+0000000000804091 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804091:	55                   	push   %rbp
+  804092:	48 89 e5             	mov    %rsp,%rbp
+  804095:	41 57                	push   %r15
+  804097:	53                   	push   %rbx
+  804098:	48 83 ec 20          	sub    $0x20,%rsp
+  80409c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80409c <stat+0xb>
+  8040a3:	49 bb b4 4f 00 00 00 	movabs $0x4fb4,%r11
+  8040aa:	00 00 00 
+  8040ad:	4c 01 db             	add    %r11,%rbx
+  8040b0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8040b4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8040b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8040c1:	48 89 c7             	mov    %rax,%rdi
+  8040c4:	49 89 df             	mov    %rbx,%r15
+  8040c7:	48 b8 1b b3 ff ff ff 	movabs $0xffffffffffffb31b,%rax
+  8040ce:	ff ff ff 
+  8040d1:	48 01 d8             	add    %rbx,%rax
+  8040d4:	ff d0                	call   *%rax
+  8040d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040dd:	79 05                	jns    8040e4 <stat+0x53>
+		return fd;
+  8040df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040e2:	eb 37                	jmp    80411b <stat+0x8a>
+	r = fstat(fd, stat);
+  8040e4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040eb:	48 89 d6             	mov    %rdx,%rsi
+  8040ee:	89 c7                	mov    %eax,%edi
+  8040f0:	48 b8 67 af ff ff ff 	movabs $0xffffffffffffaf67,%rax
+  8040f7:	ff ff ff 
+  8040fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040fe:	ff d0                	call   *%rax
+  804100:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  804103:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804106:	89 c7                	mov    %eax,%edi
+  804108:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  80410f:	ff ff ff 
+  804112:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804116:	ff d0                	call   *%rax
+	return r;
+  804118:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  80411b:	48 83 c4 20          	add    $0x20,%rsp
+  80411f:	5b                   	pop    %rbx
+  804120:	41 5f                	pop    %r15
+  804122:	5d                   	pop    %rbp
+  804123:	c3                   	ret
+
+0000000000804124 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  804124:	55                   	push   %rbp
+  804125:	48 89 e5             	mov    %rsp,%rbp
+  804128:	41 57                	push   %r15
+  80412a:	53                   	push   %rbx
+  80412b:	48 83 ec 10          	sub    $0x10,%rsp
+  80412f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80412f <fsipc+0xb>
+  804136:	49 bb 21 4f 00 00 00 	movabs $0x4f21,%r11
+  80413d:	00 00 00 
+  804140:	4c 01 db             	add    %r11,%rbx
+  804143:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804146:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80414a:	48 b8 b8 1f 00 00 00 	movabs $0x1fb8,%rax
+  804151:	00 00 00 
+  804154:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804157:	85 c0                	test   %eax,%eax
+  804159:	75 24                	jne    80417f <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80415b:	bf 01 00 00 00       	mov    $0x1,%edi
+  804160:	49 89 df             	mov    %rbx,%r15
+  804163:	48 b8 76 dd ff ff ff 	movabs $0xffffffffffffdd76,%rax
+  80416a:	ff ff ff 
+  80416d:	48 01 d8             	add    %rbx,%rax
+  804170:	ff d0                	call   *%rax
+  804172:	48 ba b8 1f 00 00 00 	movabs $0x1fb8,%rdx
+  804179:	00 00 00 
+  80417c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  80417f:	48 b8 b8 1f 00 00 00 	movabs $0x1fb8,%rax
+  804186:	00 00 00 
+  804189:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80418c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804190:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804193:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804199:	49 89 d0             	mov    %rdx,%r8
+  80419c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8041a1:	48 ba b0 3f 01 00 00 	movabs $0x13fb0,%rdx
+  8041a8:	00 00 00 
+  8041ab:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8041af:	89 c7                	mov    %eax,%edi
+  8041b1:	49 89 df             	mov    %rbx,%r15
+  8041b4:	48 b8 95 d7 ff ff ff 	movabs $0xffffffffffffd795,%rax
+  8041bb:	ff ff ff 
+  8041be:	48 01 d8             	add    %rbx,%rax
+  8041c1:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8041c3:	48 83 c4 10          	add    $0x10,%rsp
+  8041c7:	5b                   	pop    %rbx
+  8041c8:	41 5f                	pop    %r15
+  8041ca:	5d                   	pop    %rbp
+  8041cb:	c3                   	ret
+
+00000000008041cc <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8041cc:	55                   	push   %rbp
+  8041cd:	48 89 e5             	mov    %rsp,%rbp
+  8041d0:	41 57                	push   %r15
+  8041d2:	53                   	push   %rbx
+  8041d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8041d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041d7 <fsipc_words+0xb>
+  8041de:	49 bb 79 4e 00 00 00 	movabs $0x4e79,%r11
+  8041e5:	00 00 00 
+  8041e8:	4c 01 db             	add    %r11,%rbx
+  8041eb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8041ee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041f2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8041f6:	48 b8 b8 1f 00 00 00 	movabs $0x1fb8,%rax
+  8041fd:	00 00 00 
+  804200:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804203:	85 c0                	test   %eax,%eax
+  804205:	75 24                	jne    80422b <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804207:	bf 01 00 00 00       	mov    $0x1,%edi
+  80420c:	49 89 df             	mov    %rbx,%r15
+  80420f:	48 b8 76 dd ff ff ff 	movabs $0xffffffffffffdd76,%rax
+  804216:	ff ff ff 
+  804219:	48 01 d8             	add    %rbx,%rax
+  80421c:	ff d0                	call   *%rax
+  80421e:	48 ba b8 1f 00 00 00 	movabs $0x1fb8,%rdx
+  804225:	00 00 00 
+  804228:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  80422b:	48 b8 b8 1f 00 00 00 	movabs $0x1fb8,%rax
+  804232:	00 00 00 
+  804235:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804238:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80423c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804240:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804243:	89 c7                	mov    %eax,%edi
+  804245:	49 89 df             	mov    %rbx,%r15
+  804248:	48 b8 80 d8 ff ff ff 	movabs $0xffffffffffffd880,%rax
+  80424f:	ff ff ff 
+  804252:	48 01 d8             	add    %rbx,%rax
+  804255:	ff d0                	call   *%rax
+}
+  804257:	48 83 c4 20          	add    $0x20,%rsp
+  80425b:	5b                   	pop    %rbx
+  80425c:	41 5f                	pop    %r15
+  80425e:	5d                   	pop    %rbp
+  80425f:	c3                   	ret
+
+0000000000804260 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804260:	55                   	push   %rbp
+  804261:	48 89 e5             	mov    %rsp,%rbp
+  804264:	41 57                	push   %r15
+  804266:	53                   	push   %rbx
+  804267:	48 83 ec 40          	sub    $0x40,%rsp
+  80426b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80426b <fsipc_pages+0xb>
+  804272:	49 bb e5 4d 00 00 00 	movabs $0x4de5,%r11
+  804279:	00 00 00 
+  80427c:	4c 01 db             	add    %r11,%rbx
+  80427f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804282:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804286:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  80428a:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  80428d:	48 b8 b8 1f 00 00 00 	movabs $0x1fb8,%rax
+  804294:	00 00 00 
+  804297:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80429a:	85 c0                	test   %eax,%eax
+  80429c:	75 24                	jne    8042c2 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80429e:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042a3:	49 89 df             	mov    %rbx,%r15
+  8042a6:	48 b8 76 dd ff ff ff 	movabs $0xffffffffffffdd76,%rax
+  8042ad:	ff ff ff 
+  8042b0:	48 01 d8             	add    %rbx,%rax
+  8042b3:	ff d0                	call   *%rax
+  8042b5:	48 ba b8 1f 00 00 00 	movabs $0x1fb8,%rdx
+  8042bc:	00 00 00 
+  8042bf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8042c2:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8042c7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8042cb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8042ce:	48 98                	cltq
+  8042d0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8042d4:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8042d8:	0f 95 c0             	setne  %al
+  8042db:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  8042de:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8042e5:	00 
+  8042e6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8042ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042ee:	48 01 d0             	add    %rdx,%rax
+  8042f1:	48 83 e8 01          	sub    $0x1,%rax
+  8042f5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8042f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804302:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804306:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80430a:	48 29 d0             	sub    %rdx,%rax
+  80430d:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804311:	41 89 c2             	mov    %eax,%r10d
+  804314:	48 b8 b8 1f 00 00 00 	movabs $0x1fb8,%rax
+  80431b:	00 00 00 
+  80431e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804321:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804325:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804329:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80432c:	48 83 ec 08          	sub    $0x8,%rsp
+  804330:	6a 40                	push   $0x40
+  804332:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804337:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  80433e:	00 
+  80433f:	6a 05                	push   $0x5
+  804341:	41 89 f9             	mov    %edi,%r9d
+  804344:	49 89 c8             	mov    %rcx,%r8
+  804347:	44 89 d1             	mov    %r10d,%ecx
+  80434a:	89 c7                	mov    %eax,%edi
+  80434c:	49 89 df             	mov    %rbx,%r15
+  80434f:	48 b8 7e d9 ff ff ff 	movabs $0xffffffffffffd97e,%rax
+  804356:	ff ff ff 
+  804359:	48 01 d8             	add    %rbx,%rax
+  80435c:	ff d0                	call   *%rax
+  80435e:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804362:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804366:	5b                   	pop    %rbx
+  804367:	41 5f                	pop    %r15
+  804369:	5d                   	pop    %rbp
+  80436a:	c3                   	ret
+
+000000000080436b <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  80436b:	55                   	push   %rbp
+  80436c:	48 89 e5             	mov    %rsp,%rbp
+  80436f:	41 57                	push   %r15
+  804371:	53                   	push   %rbx
+  804372:	48 83 ec 20          	sub    $0x20,%rsp
+  804376:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804376 <open+0xb>
+  80437d:	49 bb da 4c 00 00 00 	movabs $0x4cda,%r11
+  804384:	00 00 00 
+  804387:	4c 01 db             	add    %r11,%rbx
+  80438a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80438e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804391:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804395:	48 89 c7             	mov    %rax,%rdi
+  804398:	49 89 df             	mov    %rbx,%r15
+  80439b:	48 b8 50 84 ff ff ff 	movabs $0xffffffffffff8450,%rax
+  8043a2:	ff ff ff 
+  8043a5:	48 01 d8             	add    %rbx,%rax
+  8043a8:	ff d0                	call   *%rax
+  8043aa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043af:	7e 0a                	jle    8043bb <open+0x50>
+		return -E_BAD_PATH;
+  8043b1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8043b6:	e9 18 01 00 00       	jmp    8044d3 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8043bb:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8043bf:	48 89 c7             	mov    %rax,%rdi
+  8043c2:	49 89 df             	mov    %rbx,%r15
+  8043c5:	48 b8 4f a5 ff ff ff 	movabs $0xffffffffffffa54f,%rax
+  8043cc:	ff ff ff 
+  8043cf:	48 01 d8             	add    %rbx,%rax
+  8043d2:	ff d0                	call   *%rax
+  8043d4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043d7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043db:	74 08                	je     8043e5 <open+0x7a>
+		return r;
+  8043dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043e0:	e9 ee 00 00 00       	jmp    8044d3 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8043e5:	48 ba b0 3f 01 00 00 	movabs $0x13fb0,%rdx
+  8043ec:	00 00 00 
+  8043ef:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8043f2:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8043f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043fd:	48 89 c6             	mov    %rax,%rsi
+  804400:	48 b8 b0 3f 01 00 00 	movabs $0x13fb0,%rax
+  804407:	00 00 00 
+  80440a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80440e:	48 89 c7             	mov    %rax,%rdi
+  804411:	49 89 df             	mov    %rbx,%r15
+  804414:	48 b8 e4 84 ff ff ff 	movabs $0xffffffffffff84e4,%rax
+  80441b:	ff ff ff 
+  80441e:	48 01 d8             	add    %rbx,%rax
+  804421:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804423:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804427:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  80442c:	48 89 c6             	mov    %rax,%rsi
+  80442f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804434:	49 89 df             	mov    %rbx,%r15
+  804437:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  80443e:	ff ff ff 
+  804441:	48 01 d8             	add    %rbx,%rax
+  804444:	ff d0                	call   *%rax
+  804446:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804449:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80444d:	74 23                	je     804472 <open+0x107>
+		fd_close(fd,0);
+  80444f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804453:	be 00 00 00 00       	mov    $0x0,%esi
+  804458:	48 89 c7             	mov    %rax,%rdi
+  80445b:	49 89 df             	mov    %rbx,%r15
+  80445e:	48 b8 b0 a6 ff ff ff 	movabs $0xffffffffffffa6b0,%rax
+  804465:	ff ff ff 
+  804468:	48 01 d8             	add    %rbx,%rax
+  80446b:	ff d0                	call   *%rax
+		return r;
+  80446d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804470:	eb 61                	jmp    8044d3 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804472:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804476:	48 89 c6             	mov    %rax,%rsi
+  804479:	bf 01 00 00 00       	mov    $0x1,%edi
+  80447e:	48 b8 d4 b0 ff ff ff 	movabs $0xffffffffffffb0d4,%rax
+  804485:	ff ff ff 
+  804488:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80448c:	ff d0                	call   *%rax
+  80448e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804491:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804495:	74 23                	je     8044ba <open+0x14f>
+		fd_close(fd,0);
+  804497:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80449b:	be 00 00 00 00       	mov    $0x0,%esi
+  8044a0:	48 89 c7             	mov    %rax,%rdi
+  8044a3:	49 89 df             	mov    %rbx,%r15
+  8044a6:	48 b8 b0 a6 ff ff ff 	movabs $0xffffffffffffa6b0,%rax
+  8044ad:	ff ff ff 
+  8044b0:	48 01 d8             	add    %rbx,%rax
+  8044b3:	ff d0                	call   *%rax
+		return r;
+  8044b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044b8:	eb 19                	jmp    8044d3 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8044ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044be:	48 89 c7             	mov    %rax,%rdi
+  8044c1:	49 89 df             	mov    %rbx,%r15
+  8044c4:	48 b8 d5 a4 ff ff ff 	movabs $0xffffffffffffa4d5,%rax
+  8044cb:	ff ff ff 
+  8044ce:	48 01 d8             	add    %rbx,%rax
+  8044d1:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8044d3:	48 83 c4 20          	add    $0x20,%rsp
+  8044d7:	5b                   	pop    %rbx
+  8044d8:	41 5f                	pop    %r15
+  8044da:	5d                   	pop    %rbp
+  8044db:	c3                   	ret
+
+00000000008044dc <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8044dc:	55                   	push   %rbp
+  8044dd:	48 89 e5             	mov    %rsp,%rbp
+  8044e0:	48 83 ec 20          	sub    $0x20,%rsp
+  8044e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044e4 <devfile_flush+0x8>
+  8044eb:	49 bb 6c 4b 00 00 00 	movabs $0x4b6c,%r11
+  8044f2:	00 00 00 
+  8044f5:	4c 01 d8             	add    %r11,%rax
+  8044f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8044fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804500:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804503:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804506:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80450a:	ba 04 00 00 00       	mov    $0x4,%edx
+  80450f:	48 89 ce             	mov    %rcx,%rsi
+  804512:	bf 06 00 00 00       	mov    $0x6,%edi
+  804517:	48 b9 7c b1 ff ff ff 	movabs $0xffffffffffffb17c,%rcx
+  80451e:	ff ff ff 
+  804521:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804525:	ff d0                	call   *%rax
+}
+  804527:	c9                   	leave
+  804528:	c3                   	ret
+
+0000000000804529 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804529:	55                   	push   %rbp
+  80452a:	48 89 e5             	mov    %rsp,%rbp
+  80452d:	41 57                	push   %r15
+  80452f:	53                   	push   %rbx
+  804530:	48 83 ec 60          	sub    $0x60,%rsp
+  804534:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804534 <devfile_read+0xb>
+  80453b:	49 bb 1c 4b 00 00 00 	movabs $0x4b1c,%r11
+  804542:	00 00 00 
+  804545:	4c 01 db             	add    %r11,%rbx
+  804548:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80454c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804550:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804554:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804558:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  80455c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804560:	8b 50 0c             	mov    0xc(%rax),%edx
+  804563:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804567:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804569:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80456d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804571:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804575:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804579:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80457e:	ba 10 00 00 00       	mov    $0x10,%edx
+  804583:	48 89 c6             	mov    %rax,%rsi
+  804586:	bf 03 00 00 00       	mov    $0x3,%edi
+  80458b:	48 b8 10 b2 ff ff ff 	movabs $0xffffffffffffb210,%rax
+  804592:	ff ff ff 
+  804595:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804599:	ff d0                	call   *%rax
+  80459b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80459e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8045a2:	79 05                	jns    8045a9 <devfile_read+0x80>
+		return r;
+  8045a4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045a7:	eb 64                	jmp    80460d <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8045a9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045ac:	48 63 d0             	movslq %eax,%rdx
+  8045af:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8045b3:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8045b8:	48 01 c1             	add    %rax,%rcx
+  8045bb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8045bf:	48 89 ce             	mov    %rcx,%rsi
+  8045c2:	48 89 c7             	mov    %rax,%rdi
+  8045c5:	49 89 df             	mov    %rbx,%r15
+  8045c8:	48 b8 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rax
+  8045cf:	ff ff ff 
+  8045d2:	48 01 d8             	add    %rbx,%rax
+  8045d5:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8045d7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8045de:	ff ff ff 
+  8045e1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8045e5:	48 8b 00             	mov    (%rax),%rax
+  8045e8:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8045ee:	89 c6                	mov    %eax,%esi
+  8045f0:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8045f5:	48 89 c7             	mov    %rax,%rdi
+  8045f8:	49 89 df             	mov    %rbx,%r15
+  8045fb:	48 b8 30 dd ff ff ff 	movabs $0xffffffffffffdd30,%rax
+  804602:	ff ff ff 
+  804605:	48 01 d8             	add    %rbx,%rax
+  804608:	ff d0                	call   *%rax
+	return r;
+  80460a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  80460d:	48 83 c4 60          	add    $0x60,%rsp
+  804611:	5b                   	pop    %rbx
+  804612:	41 5f                	pop    %r15
+  804614:	5d                   	pop    %rbp
+  804615:	c3                   	ret
+
+0000000000804616 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804616:	55                   	push   %rbp
+  804617:	48 89 e5             	mov    %rsp,%rbp
+  80461a:	41 57                	push   %r15
+  80461c:	53                   	push   %rbx
+  80461d:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804621:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804621 <devfile_write+0xb>
+  804628:	49 bb 2f 4a 00 00 00 	movabs $0x4a2f,%r11
+  80462f:	00 00 00 
+  804632:	4c 01 db             	add    %r11,%rbx
+  804635:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804639:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  80463d:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804644:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804648:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  80464c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804653:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804657:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  80465e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804661:	48 63 d0             	movslq %eax,%rdx
+  804664:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804668:	48 39 c2             	cmp    %rax,%rdx
+  80466b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80466f:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804676:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80467d:	00 
+  80467e:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804685:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804689:	48 01 d0             	add    %rdx,%rax
+  80468c:	48 83 e8 01          	sub    $0x1,%rax
+  804690:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804694:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804698:	ba 00 00 00 00       	mov    $0x0,%edx
+  80469d:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8046a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a5:	48 29 d0             	sub    %rdx,%rax
+  8046a8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8046ac:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8046af:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8046b2:	89 c6                	mov    %eax,%esi
+  8046b4:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8046b9:	48 89 c7             	mov    %rax,%rdi
+  8046bc:	49 89 df             	mov    %rbx,%r15
+  8046bf:	48 b8 ea dc ff ff ff 	movabs $0xffffffffffffdcea,%rax
+  8046c6:	ff ff ff 
+  8046c9:	48 01 d8             	add    %rbx,%rax
+  8046cc:	ff d0                	call   *%rax
+  8046ce:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8046d1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8046d5:	79 08                	jns    8046df <devfile_write+0xc9>
+		return r;
+  8046d7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8046da:	e9 8f 00 00 00       	jmp    80476e <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8046df:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8046e6:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8046ea:	48 89 c6             	mov    %rax,%rsi
+  8046ed:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8046f2:	48 89 c7             	mov    %rax,%rdi
+  8046f5:	49 89 df             	mov    %rbx,%r15
+  8046f8:	48 b8 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rax
+  8046ff:	ff ff ff 
+  804702:	48 01 d8             	add    %rbx,%rax
+  804705:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804707:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80470b:	8b 50 0c             	mov    0xc(%rax),%edx
+  80470e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804712:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804714:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804718:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80471f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804723:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804726:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80472a:	89 d1                	mov    %edx,%ecx
+  80472c:	ba 10 00 00 00       	mov    $0x10,%edx
+  804731:	48 89 c6             	mov    %rax,%rsi
+  804734:	bf 04 00 00 00       	mov    $0x4,%edi
+  804739:	48 b8 10 b2 ff ff ff 	movabs $0xffffffffffffb210,%rax
+  804740:	ff ff ff 
+  804743:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804747:	ff d0                	call   *%rax
+  804749:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80474c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80474f:	89 c6                	mov    %eax,%esi
+  804751:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804756:	48 89 c7             	mov    %rax,%rdi
+  804759:	49 89 df             	mov    %rbx,%r15
+  80475c:	48 b8 30 dd ff ff ff 	movabs $0xffffffffffffdd30,%rax
+  804763:	ff ff ff 
+  804766:	48 01 d8             	add    %rbx,%rax
+  804769:	ff d0                	call   *%rax
+	return r;
+  80476b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80476e:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804772:	5b                   	pop    %rbx
+  804773:	41 5f                	pop    %r15
+  804775:	5d                   	pop    %rbp
+  804776:	c3                   	ret
+
+0000000000804777 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804777:	55                   	push   %rbp
+  804778:	48 89 e5             	mov    %rsp,%rbp
+  80477b:	41 57                	push   %r15
+  80477d:	53                   	push   %rbx
+  80477e:	48 83 ec 20          	sub    $0x20,%rsp
+  804782:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804782 <devfile_stat+0xb>
+  804789:	49 bb ce 48 00 00 00 	movabs $0x48ce,%r11
+  804790:	00 00 00 
+  804793:	4c 01 db             	add    %r11,%rbx
+  804796:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80479a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80479e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047a2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8047a5:	48 ba b0 3f 01 00 00 	movabs $0x13fb0,%rdx
+  8047ac:	00 00 00 
+  8047af:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8047b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8047b7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8047bc:	48 b8 d4 b0 ff ff ff 	movabs $0xffffffffffffb0d4,%rax
+  8047c3:	ff ff ff 
+  8047c6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047ca:	ff d0                	call   *%rax
+  8047cc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047cf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047d3:	79 05                	jns    8047da <devfile_stat+0x63>
+		return r;
+  8047d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047d8:	eb 65                	jmp    80483f <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8047da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047de:	48 ba b0 3f 01 00 00 	movabs $0x13fb0,%rdx
+  8047e5:	00 00 00 
+  8047e8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8047ec:	48 89 d6             	mov    %rdx,%rsi
+  8047ef:	48 89 c7             	mov    %rax,%rdi
+  8047f2:	49 89 df             	mov    %rbx,%r15
+  8047f5:	48 b8 e4 84 ff ff ff 	movabs $0xffffffffffff84e4,%rax
+  8047fc:	ff ff ff 
+  8047ff:	48 01 d8             	add    %rbx,%rax
+  804802:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804804:	48 b8 b0 3f 01 00 00 	movabs $0x13fb0,%rax
+  80480b:	00 00 00 
+  80480e:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804815:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804819:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80481f:	48 b8 b0 3f 01 00 00 	movabs $0x13fb0,%rax
+  804826:	00 00 00 
+  804829:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804830:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804834:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  80483a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80483f:	48 83 c4 20          	add    $0x20,%rsp
+  804843:	5b                   	pop    %rbx
+  804844:	41 5f                	pop    %r15
+  804846:	5d                   	pop    %rbp
+  804847:	c3                   	ret
+
+0000000000804848 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804848:	55                   	push   %rbp
+  804849:	48 89 e5             	mov    %rsp,%rbp
+  80484c:	48 83 ec 20          	sub    $0x20,%rsp
+  804850:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804850 <devfile_trunc+0x8>
+  804857:	49 bb 00 48 00 00 00 	movabs $0x4800,%r11
+  80485e:	00 00 00 
+  804861:	4c 01 d8             	add    %r11,%rax
+  804864:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804868:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80486b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80486f:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804872:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804875:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804878:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80487b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80487f:	ba 08 00 00 00       	mov    $0x8,%edx
+  804884:	48 89 ce             	mov    %rcx,%rsi
+  804887:	bf 02 00 00 00       	mov    $0x2,%edi
+  80488c:	48 b9 7c b1 ff ff ff 	movabs $0xffffffffffffb17c,%rcx
+  804893:	ff ff ff 
+  804896:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80489a:	ff d0                	call   *%rax
+}
+  80489c:	c9                   	leave
+  80489d:	c3                   	ret
+
+000000000080489e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80489e:	55                   	push   %rbp
+  80489f:	48 89 e5             	mov    %rsp,%rbp
+  8048a2:	41 57                	push   %r15
+  8048a4:	53                   	push   %rbx
+  8048a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8048a9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048a9 <remove+0xb>
+  8048b0:	49 bb a7 47 00 00 00 	movabs $0x47a7,%r11
+  8048b7:	00 00 00 
+  8048ba:	4c 01 db             	add    %r11,%rbx
+  8048bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8048c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048c5:	48 89 c7             	mov    %rax,%rdi
+  8048c8:	49 89 df             	mov    %rbx,%r15
+  8048cb:	48 b8 50 84 ff ff ff 	movabs $0xffffffffffff8450,%rax
+  8048d2:	ff ff ff 
+  8048d5:	48 01 d8             	add    %rbx,%rax
+  8048d8:	ff d0                	call   *%rax
+  8048da:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8048df:	7e 07                	jle    8048e8 <remove+0x4a>
+		return -E_BAD_PATH;
+  8048e1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8048e6:	eb 44                	jmp    80492c <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8048e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048ec:	48 89 c6             	mov    %rax,%rsi
+  8048ef:	48 b8 b0 3f 01 00 00 	movabs $0x13fb0,%rax
+  8048f6:	00 00 00 
+  8048f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048fd:	48 89 c7             	mov    %rax,%rdi
+  804900:	49 89 df             	mov    %rbx,%r15
+  804903:	48 b8 e4 84 ff ff ff 	movabs $0xffffffffffff84e4,%rax
+  80490a:	ff ff ff 
+  80490d:	48 01 d8             	add    %rbx,%rax
+  804910:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804912:	be 00 00 00 00       	mov    $0x0,%esi
+  804917:	bf 07 00 00 00       	mov    $0x7,%edi
+  80491c:	48 b8 d4 b0 ff ff ff 	movabs $0xffffffffffffb0d4,%rax
+  804923:	ff ff ff 
+  804926:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80492a:	ff d0                	call   *%rax
+}
+  80492c:	48 83 c4 10          	add    $0x10,%rsp
+  804930:	5b                   	pop    %rbx
+  804931:	41 5f                	pop    %r15
+  804933:	5d                   	pop    %rbp
+  804934:	c3                   	ret
+
+0000000000804935 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804935:	55                   	push   %rbp
+  804936:	48 89 e5             	mov    %rsp,%rbp
+  804939:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804939 <sync+0x4>
+  804940:	49 bb 17 47 00 00 00 	movabs $0x4717,%r11
+  804947:	00 00 00 
+  80494a:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80494d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804952:	be 00 00 00 00       	mov    $0x0,%esi
+  804957:	bf 08 00 00 00       	mov    $0x8,%edi
+  80495c:	48 b9 7c b1 ff ff ff 	movabs $0xffffffffffffb17c,%rcx
+  804963:	ff ff ff 
+  804966:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80496a:	ff d0                	call   *%rax
+}
+  80496c:	5d                   	pop    %rbp
+  80496d:	c3                   	ret
+
+000000000080496e <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80496e:	55                   	push   %rbp
+  80496f:	48 89 e5             	mov    %rsp,%rbp
+  804972:	41 57                	push   %r15
+  804974:	53                   	push   %rbx
+  804975:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80497c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80497c <copy+0xe>
+  804983:	49 bb d4 46 00 00 00 	movabs $0x46d4,%r11
+  80498a:	00 00 00 
+  80498d:	4c 01 db             	add    %r11,%rbx
+  804990:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804997:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  80499e:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8049a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8049aa:	48 89 c7             	mov    %rax,%rdi
+  8049ad:	48 b8 1b b3 ff ff ff 	movabs $0xffffffffffffb31b,%rax
+  8049b4:	ff ff ff 
+  8049b7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049bb:	ff d0                	call   *%rax
+  8049bd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8049c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049c4:	79 35                	jns    8049fb <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8049c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049c9:	89 c6                	mov    %eax,%esi
+  8049cb:	48 b8 3e e5 ff ff ff 	movabs $0xffffffffffffe53e,%rax
+  8049d2:	ff ff ff 
+  8049d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049d9:	48 89 c7             	mov    %rax,%rdi
+  8049dc:	49 89 df             	mov    %rbx,%r15
+  8049df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049e4:	48 ba 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rdx
+  8049eb:	ff ff ff 
+  8049ee:	48 01 da             	add    %rbx,%rdx
+  8049f1:	ff d2                	call   *%rdx
+		return fd_src;
+  8049f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049f6:	e9 d7 01 00 00       	jmp    804bd2 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8049fb:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804a02:	be 01 01 00 00       	mov    $0x101,%esi
+  804a07:	48 89 c7             	mov    %rax,%rdi
+  804a0a:	48 b8 1b b3 ff ff ff 	movabs $0xffffffffffffb31b,%rax
+  804a11:	ff ff ff 
+  804a14:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a18:	ff d0                	call   *%rax
+  804a1a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804a1d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804a21:	0f 89 df 00 00 00    	jns    804b06 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804a27:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a2a:	89 c6                	mov    %eax,%esi
+  804a2c:	48 b8 54 e5 ff ff ff 	movabs $0xffffffffffffe554,%rax
+  804a33:	ff ff ff 
+  804a36:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a3a:	48 89 c7             	mov    %rax,%rdi
+  804a3d:	49 89 df             	mov    %rbx,%r15
+  804a40:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a45:	48 ba 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rdx
+  804a4c:	ff ff ff 
+  804a4f:	48 01 da             	add    %rbx,%rdx
+  804a52:	ff d2                	call   *%rdx
+		close(fd_src);
+  804a54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a57:	89 c7                	mov    %eax,%edi
+  804a59:	49 89 df             	mov    %rbx,%r15
+  804a5c:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  804a63:	ff ff ff 
+  804a66:	48 01 d8             	add    %rbx,%rax
+  804a69:	ff d0                	call   *%rax
+		return fd_dest;
+  804a6b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a6e:	e9 5f 01 00 00       	jmp    804bd2 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804a73:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a76:	48 63 d0             	movslq %eax,%rdx
+  804a79:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804a80:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a83:	48 89 ce             	mov    %rcx,%rsi
+  804a86:	89 c7                	mov    %eax,%edi
+  804a88:	49 89 df             	mov    %rbx,%r15
+  804a8b:	48 b8 f2 ac ff ff ff 	movabs $0xffffffffffffacf2,%rax
+  804a92:	ff ff ff 
+  804a95:	48 01 d8             	add    %rbx,%rax
+  804a98:	ff d0                	call   *%rax
+  804a9a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804a9d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804aa1:	79 63                	jns    804b06 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804aa3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804aa6:	89 c6                	mov    %eax,%esi
+  804aa8:	48 b8 6e e5 ff ff ff 	movabs $0xffffffffffffe56e,%rax
+  804aaf:	ff ff ff 
+  804ab2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ab6:	48 89 c7             	mov    %rax,%rdi
+  804ab9:	49 89 df             	mov    %rbx,%r15
+  804abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ac1:	48 ba 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rdx
+  804ac8:	ff ff ff 
+  804acb:	48 01 da             	add    %rbx,%rdx
+  804ace:	ff d2                	call   *%rdx
+			close(fd_src);
+  804ad0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ad3:	89 c7                	mov    %eax,%edi
+  804ad5:	49 89 df             	mov    %rbx,%r15
+  804ad8:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  804adf:	ff ff ff 
+  804ae2:	48 01 d8             	add    %rbx,%rax
+  804ae5:	ff d0                	call   *%rax
+			close(fd_dest);
+  804ae7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804aea:	89 c7                	mov    %eax,%edi
+  804aec:	49 89 df             	mov    %rbx,%r15
+  804aef:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  804af6:	ff ff ff 
+  804af9:	48 01 d8             	add    %rbx,%rax
+  804afc:	ff d0                	call   *%rax
+			return write_size;
+  804afe:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804b01:	e9 cc 00 00 00       	jmp    804bd2 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804b06:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804b0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b10:	ba 00 02 00 00       	mov    $0x200,%edx
+  804b15:	48 89 ce             	mov    %rcx,%rsi
+  804b18:	89 c7                	mov    %eax,%edi
+  804b1a:	49 89 df             	mov    %rbx,%r15
+  804b1d:	48 b8 4c ab ff ff ff 	movabs $0xffffffffffffab4c,%rax
+  804b24:	ff ff ff 
+  804b27:	48 01 d8             	add    %rbx,%rax
+  804b2a:	ff d0                	call   *%rax
+  804b2c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804b2f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804b33:	0f 8f 3a ff ff ff    	jg     804a73 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804b39:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804b3d:	79 60                	jns    804b9f <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804b3f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b42:	89 c6                	mov    %eax,%esi
+  804b44:	48 b8 81 e5 ff ff ff 	movabs $0xffffffffffffe581,%rax
+  804b4b:	ff ff ff 
+  804b4e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b52:	48 89 c7             	mov    %rax,%rdi
+  804b55:	49 89 df             	mov    %rbx,%r15
+  804b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b5d:	48 ba 22 77 ff ff ff 	movabs $0xffffffffffff7722,%rdx
+  804b64:	ff ff ff 
+  804b67:	48 01 da             	add    %rbx,%rdx
+  804b6a:	ff d2                	call   *%rdx
+		close(fd_src);
+  804b6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b6f:	89 c7                	mov    %eax,%edi
+  804b71:	49 89 df             	mov    %rbx,%r15
+  804b74:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  804b7b:	ff ff ff 
+  804b7e:	48 01 d8             	add    %rbx,%rax
+  804b81:	ff d0                	call   *%rax
+		close(fd_dest);
+  804b83:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b86:	89 c7                	mov    %eax,%edi
+  804b88:	49 89 df             	mov    %rbx,%r15
+  804b8b:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  804b92:	ff ff ff 
+  804b95:	48 01 d8             	add    %rbx,%rax
+  804b98:	ff d0                	call   *%rax
+		return read_size;
+  804b9a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b9d:	eb 33                	jmp    804bd2 <copy+0x264>
+	}
+	close(fd_src);
+  804b9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ba2:	89 c7                	mov    %eax,%edi
+  804ba4:	49 89 df             	mov    %rbx,%r15
+  804ba7:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  804bae:	ff ff ff 
+  804bb1:	48 01 d8             	add    %rbx,%rax
+  804bb4:	ff d0                	call   *%rax
+	close(fd_dest);
+  804bb6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bb9:	89 c7                	mov    %eax,%edi
+  804bbb:	49 89 df             	mov    %rbx,%r15
+  804bbe:	48 b8 94 a8 ff ff ff 	movabs $0xffffffffffffa894,%rax
+  804bc5:	ff ff ff 
+  804bc8:	48 01 d8             	add    %rbx,%rax
+  804bcb:	ff d0                	call   *%rax
+	return 0;
+  804bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804bd2:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804bd9:	5b                   	pop    %rbx
+  804bda:	41 5f                	pop    %r15
+  804bdc:	5d                   	pop    %rbp
+  804bdd:	c3                   	ret
+
+0000000000804bde <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804bde:	55                   	push   %rbp
+  804bdf:	48 89 e5             	mov    %rsp,%rbp
+  804be2:	41 57                	push   %r15
+  804be4:	53                   	push   %rbx
+  804be5:	48 83 ec 20          	sub    $0x20,%rsp
+  804be9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804be9 <fd2sockid+0xb>
+  804bf0:	49 bb 67 44 00 00 00 	movabs $0x4467,%r11
+  804bf7:	00 00 00 
+  804bfa:	4c 01 db             	add    %r11,%rbx
+  804bfd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804c00:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804c04:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c07:	48 89 d6             	mov    %rdx,%rsi
+  804c0a:	89 c7                	mov    %eax,%edi
+  804c0c:	49 89 df             	mov    %rbx,%r15
+  804c0f:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  804c16:	ff ff ff 
+  804c19:	48 01 d8             	add    %rbx,%rax
+  804c1c:	ff d0                	call   *%rax
+  804c1e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c21:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c25:	79 05                	jns    804c2c <fd2sockid+0x4e>
+		return r;
+  804c27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c2a:	eb 25                	jmp    804c51 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804c2c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c30:	8b 10                	mov    (%rax),%edx
+  804c32:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  804c39:	00 00 00 
+  804c3c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c3f:	39 c2                	cmp    %eax,%edx
+  804c41:	74 07                	je     804c4a <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804c43:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804c48:	eb 07                	jmp    804c51 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804c4a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c4e:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804c51:	48 83 c4 20          	add    $0x20,%rsp
+  804c55:	5b                   	pop    %rbx
+  804c56:	41 5f                	pop    %r15
+  804c58:	5d                   	pop    %rbp
+  804c59:	c3                   	ret
+
+0000000000804c5a <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804c5a:	55                   	push   %rbp
+  804c5b:	48 89 e5             	mov    %rsp,%rbp
+  804c5e:	41 57                	push   %r15
+  804c60:	53                   	push   %rbx
+  804c61:	48 83 ec 20          	sub    $0x20,%rsp
+  804c65:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c65 <alloc_sockfd+0xb>
+  804c6c:	49 bb eb 43 00 00 00 	movabs $0x43eb,%r11
+  804c73:	00 00 00 
+  804c76:	4c 01 db             	add    %r11,%rbx
+  804c79:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804c7c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804c80:	48 89 c7             	mov    %rax,%rdi
+  804c83:	49 89 df             	mov    %rbx,%r15
+  804c86:	48 b8 4f a5 ff ff ff 	movabs $0xffffffffffffa54f,%rax
+  804c8d:	ff ff ff 
+  804c90:	48 01 d8             	add    %rbx,%rax
+  804c93:	ff d0                	call   *%rax
+  804c95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c9c:	78 2c                	js     804cca <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804c9e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ca2:	ba 07 04 00 00       	mov    $0x407,%edx
+  804ca7:	48 89 c6             	mov    %rax,%rsi
+  804caa:	bf 00 00 00 00       	mov    $0x0,%edi
+  804caf:	49 89 df             	mov    %rbx,%r15
+  804cb2:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  804cb9:	ff ff ff 
+  804cbc:	48 01 d8             	add    %rbx,%rax
+  804cbf:	ff d0                	call   *%rax
+  804cc1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cc4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cc8:	79 1c                	jns    804ce6 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804cca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ccd:	89 c7                	mov    %eax,%edi
+  804ccf:	49 89 df             	mov    %rbx,%r15
+  804cd2:	48 b8 fe c3 ff ff ff 	movabs $0xffffffffffffc3fe,%rax
+  804cd9:	ff ff ff 
+  804cdc:	48 01 d8             	add    %rbx,%rax
+  804cdf:	ff d0                	call   *%rax
+		return r;
+  804ce1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ce4:	eb 41                	jmp    804d27 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804ce6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cea:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  804cf1:	00 00 00 
+  804cf4:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804cf7:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804cf9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cfd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804d04:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d08:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804d0b:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804d0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d12:	48 89 c7             	mov    %rax,%rdi
+  804d15:	49 89 df             	mov    %rbx,%r15
+  804d18:	48 b8 d5 a4 ff ff ff 	movabs $0xffffffffffffa4d5,%rax
+  804d1f:	ff ff ff 
+  804d22:	48 01 d8             	add    %rbx,%rax
+  804d25:	ff d0                	call   *%rax
+}
+  804d27:	48 83 c4 20          	add    $0x20,%rsp
+  804d2b:	5b                   	pop    %rbx
+  804d2c:	41 5f                	pop    %r15
+  804d2e:	5d                   	pop    %rbp
+  804d2f:	c3                   	ret
+
+0000000000804d30 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804d30:	55                   	push   %rbp
+  804d31:	48 89 e5             	mov    %rsp,%rbp
+  804d34:	41 57                	push   %r15
+  804d36:	53                   	push   %rbx
+  804d37:	48 83 ec 30          	sub    $0x30,%rsp
+  804d3b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d3b <accept+0xb>
+  804d42:	49 bb 15 43 00 00 00 	movabs $0x4315,%r11
+  804d49:	00 00 00 
+  804d4c:	4c 01 db             	add    %r11,%rbx
+  804d4f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804d52:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804d56:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804d5a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804d5d:	89 c7                	mov    %eax,%edi
+  804d5f:	48 b8 8e bb ff ff ff 	movabs $0xffffffffffffbb8e,%rax
+  804d66:	ff ff ff 
+  804d69:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d6d:	ff d0                	call   *%rax
+  804d6f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d72:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d76:	79 05                	jns    804d7d <accept+0x4d>
+		return r;
+  804d78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d7b:	eb 45                	jmp    804dc2 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804d7d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d81:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804d85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d88:	48 89 ce             	mov    %rcx,%rsi
+  804d8b:	89 c7                	mov    %eax,%edi
+  804d8d:	49 89 df             	mov    %rbx,%r15
+  804d90:	48 b8 6c c2 ff ff ff 	movabs $0xffffffffffffc26c,%rax
+  804d97:	ff ff ff 
+  804d9a:	48 01 d8             	add    %rbx,%rax
+  804d9d:	ff d0                	call   *%rax
+  804d9f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804da2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804da6:	79 05                	jns    804dad <accept+0x7d>
+		return r;
+  804da8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dab:	eb 15                	jmp    804dc2 <accept+0x92>
+	return alloc_sockfd(r);
+  804dad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804db0:	89 c7                	mov    %eax,%edi
+  804db2:	48 b8 0a bc ff ff ff 	movabs $0xffffffffffffbc0a,%rax
+  804db9:	ff ff ff 
+  804dbc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804dc0:	ff d0                	call   *%rax
+}
+  804dc2:	48 83 c4 30          	add    $0x30,%rsp
+  804dc6:	5b                   	pop    %rbx
+  804dc7:	41 5f                	pop    %r15
+  804dc9:	5d                   	pop    %rbp
+  804dca:	c3                   	ret
+
+0000000000804dcb <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804dcb:	55                   	push   %rbp
+  804dcc:	48 89 e5             	mov    %rsp,%rbp
+  804dcf:	41 57                	push   %r15
+  804dd1:	53                   	push   %rbx
+  804dd2:	48 83 ec 20          	sub    $0x20,%rsp
+  804dd6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804dd6 <bind+0xb>
+  804ddd:	49 bb 7a 42 00 00 00 	movabs $0x427a,%r11
+  804de4:	00 00 00 
+  804de7:	4c 01 db             	add    %r11,%rbx
+  804dea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804ded:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804df1:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804df4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804df7:	89 c7                	mov    %eax,%edi
+  804df9:	48 b8 8e bb ff ff ff 	movabs $0xffffffffffffbb8e,%rax
+  804e00:	ff ff ff 
+  804e03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e07:	ff d0                	call   *%rax
+  804e09:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e0c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e10:	79 05                	jns    804e17 <bind+0x4c>
+		return r;
+  804e12:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e15:	eb 21                	jmp    804e38 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804e17:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804e1a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804e1e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e21:	48 89 ce             	mov    %rcx,%rsi
+  804e24:	89 c7                	mov    %eax,%edi
+  804e26:	49 89 df             	mov    %rbx,%r15
+  804e29:	48 b8 18 c3 ff ff ff 	movabs $0xffffffffffffc318,%rax
+  804e30:	ff ff ff 
+  804e33:	48 01 d8             	add    %rbx,%rax
+  804e36:	ff d0                	call   *%rax
+}
+  804e38:	48 83 c4 20          	add    $0x20,%rsp
+  804e3c:	5b                   	pop    %rbx
+  804e3d:	41 5f                	pop    %r15
+  804e3f:	5d                   	pop    %rbp
+  804e40:	c3                   	ret
+
+0000000000804e41 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804e41:	55                   	push   %rbp
+  804e42:	48 89 e5             	mov    %rsp,%rbp
+  804e45:	41 57                	push   %r15
+  804e47:	53                   	push   %rbx
+  804e48:	48 83 ec 20          	sub    $0x20,%rsp
+  804e4c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e4c <shutdown+0xb>
+  804e53:	49 bb 04 42 00 00 00 	movabs $0x4204,%r11
+  804e5a:	00 00 00 
+  804e5d:	4c 01 db             	add    %r11,%rbx
+  804e60:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e63:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804e66:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e69:	89 c7                	mov    %eax,%edi
+  804e6b:	48 b8 8e bb ff ff ff 	movabs $0xffffffffffffbb8e,%rax
+  804e72:	ff ff ff 
+  804e75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e79:	ff d0                	call   *%rax
+  804e7b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e7e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e82:	79 05                	jns    804e89 <shutdown+0x48>
+		return r;
+  804e84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e87:	eb 1c                	jmp    804ea5 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804e89:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804e8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e8f:	89 d6                	mov    %edx,%esi
+  804e91:	89 c7                	mov    %eax,%edi
+  804e93:	49 89 df             	mov    %rbx,%r15
+  804e96:	48 b8 ad c3 ff ff ff 	movabs $0xffffffffffffc3ad,%rax
+  804e9d:	ff ff ff 
+  804ea0:	48 01 d8             	add    %rbx,%rax
+  804ea3:	ff d0                	call   *%rax
+}
+  804ea5:	48 83 c4 20          	add    $0x20,%rsp
+  804ea9:	5b                   	pop    %rbx
+  804eaa:	41 5f                	pop    %r15
+  804eac:	5d                   	pop    %rbp
+  804ead:	c3                   	ret
+
+0000000000804eae <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804eae:	55                   	push   %rbp
+  804eaf:	48 89 e5             	mov    %rsp,%rbp
+  804eb2:	41 57                	push   %r15
+  804eb4:	53                   	push   %rbx
+  804eb5:	48 83 ec 10          	sub    $0x10,%rsp
+  804eb9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804eb9 <devsock_close+0xb>
+  804ec0:	49 bb 97 41 00 00 00 	movabs $0x4197,%r11
+  804ec7:	00 00 00 
+  804eca:	4c 01 db             	add    %r11,%rbx
+  804ecd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804ed1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed5:	48 89 c7             	mov    %rax,%rdi
+  804ed8:	49 89 df             	mov    %rbx,%r15
+  804edb:	48 b8 05 de ff ff ff 	movabs $0xffffffffffffde05,%rax
+  804ee2:	ff ff ff 
+  804ee5:	48 01 d8             	add    %rbx,%rax
+  804ee8:	ff d0                	call   *%rax
+  804eea:	83 f8 01             	cmp    $0x1,%eax
+  804eed:	75 1d                	jne    804f0c <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804eef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ef3:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ef6:	89 c7                	mov    %eax,%edi
+  804ef8:	49 89 df             	mov    %rbx,%r15
+  804efb:	48 b8 fe c3 ff ff ff 	movabs $0xffffffffffffc3fe,%rax
+  804f02:	ff ff ff 
+  804f05:	48 01 d8             	add    %rbx,%rax
+  804f08:	ff d0                	call   *%rax
+  804f0a:	eb 05                	jmp    804f11 <devsock_close+0x63>
+	else
+		return 0;
+  804f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f11:	48 83 c4 10          	add    $0x10,%rsp
+  804f15:	5b                   	pop    %rbx
+  804f16:	41 5f                	pop    %r15
+  804f18:	5d                   	pop    %rbp
+  804f19:	c3                   	ret
+
+0000000000804f1a <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804f1a:	55                   	push   %rbp
+  804f1b:	48 89 e5             	mov    %rsp,%rbp
+  804f1e:	41 57                	push   %r15
+  804f20:	53                   	push   %rbx
+  804f21:	48 83 ec 20          	sub    $0x20,%rsp
+  804f25:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f25 <connect+0xb>
+  804f2c:	49 bb 2b 41 00 00 00 	movabs $0x412b,%r11
+  804f33:	00 00 00 
+  804f36:	4c 01 db             	add    %r11,%rbx
+  804f39:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f3c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804f40:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804f43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f46:	89 c7                	mov    %eax,%edi
+  804f48:	48 b8 8e bb ff ff ff 	movabs $0xffffffffffffbb8e,%rax
+  804f4f:	ff ff ff 
+  804f52:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f56:	ff d0                	call   *%rax
+  804f58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f5f:	79 05                	jns    804f66 <connect+0x4c>
+		return r;
+  804f61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f64:	eb 21                	jmp    804f87 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804f66:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804f69:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804f6d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f70:	48 89 ce             	mov    %rcx,%rsi
+  804f73:	89 c7                	mov    %eax,%edi
+  804f75:	49 89 df             	mov    %rbx,%r15
+  804f78:	48 b8 46 c4 ff ff ff 	movabs $0xffffffffffffc446,%rax
+  804f7f:	ff ff ff 
+  804f82:	48 01 d8             	add    %rbx,%rax
+  804f85:	ff d0                	call   *%rax
+}
+  804f87:	48 83 c4 20          	add    $0x20,%rsp
+  804f8b:	5b                   	pop    %rbx
+  804f8c:	41 5f                	pop    %r15
+  804f8e:	5d                   	pop    %rbp
+  804f8f:	c3                   	ret
+
+0000000000804f90 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804f90:	55                   	push   %rbp
+  804f91:	48 89 e5             	mov    %rsp,%rbp
+  804f94:	41 57                	push   %r15
+  804f96:	53                   	push   %rbx
+  804f97:	48 83 ec 20          	sub    $0x20,%rsp
+  804f9b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f9b <listen+0xb>
+  804fa2:	49 bb b5 40 00 00 00 	movabs $0x40b5,%r11
+  804fa9:	00 00 00 
+  804fac:	4c 01 db             	add    %r11,%rbx
+  804faf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804fb2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804fb5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fb8:	89 c7                	mov    %eax,%edi
+  804fba:	48 b8 8e bb ff ff ff 	movabs $0xffffffffffffbb8e,%rax
+  804fc1:	ff ff ff 
+  804fc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fc8:	ff d0                	call   *%rax
+  804fca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fcd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fd1:	79 05                	jns    804fd8 <listen+0x48>
+		return r;
+  804fd3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fd6:	eb 1c                	jmp    804ff4 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804fd8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804fdb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fde:	89 d6                	mov    %edx,%esi
+  804fe0:	89 c7                	mov    %eax,%edi
+  804fe2:	49 89 df             	mov    %rbx,%r15
+  804fe5:	48 b8 db c4 ff ff ff 	movabs $0xffffffffffffc4db,%rax
+  804fec:	ff ff ff 
+  804fef:	48 01 d8             	add    %rbx,%rax
+  804ff2:	ff d0                	call   *%rax
+}
+  804ff4:	48 83 c4 20          	add    $0x20,%rsp
+  804ff8:	5b                   	pop    %rbx
+  804ff9:	41 5f                	pop    %r15
+  804ffb:	5d                   	pop    %rbp
+  804ffc:	c3                   	ret
+
+0000000000804ffd <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804ffd:	55                   	push   %rbp
+  804ffe:	48 89 e5             	mov    %rsp,%rbp
+  805001:	41 57                	push   %r15
+  805003:	48 83 ec 28          	sub    $0x28,%rsp
+  805007:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805007 <devsock_read+0xa>
+  80500e:	49 bb 49 40 00 00 00 	movabs $0x4049,%r11
+  805015:	00 00 00 
+  805018:	4c 01 d8             	add    %r11,%rax
+  80501b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80501f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805023:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805027:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80502b:	41 89 d0             	mov    %edx,%r8d
+  80502e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805032:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805035:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805039:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80503e:	44 89 c2             	mov    %r8d,%edx
+  805041:	49 89 c7             	mov    %rax,%r15
+  805044:	49 b8 2c c5 ff ff ff 	movabs $0xffffffffffffc52c,%r8
+  80504b:	ff ff ff 
+  80504e:	49 01 c0             	add    %rax,%r8
+  805051:	41 ff d0             	call   *%r8
+}
+  805054:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805058:	c9                   	leave
+  805059:	c3                   	ret
+
+000000000080505a <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80505a:	55                   	push   %rbp
+  80505b:	48 89 e5             	mov    %rsp,%rbp
+  80505e:	41 57                	push   %r15
+  805060:	48 83 ec 28          	sub    $0x28,%rsp
+  805064:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805064 <devsock_write+0xa>
+  80506b:	49 bb ec 3f 00 00 00 	movabs $0x3fec,%r11
+  805072:	00 00 00 
+  805075:	4c 01 d8             	add    %r11,%rax
+  805078:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80507c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805080:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805084:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805088:	41 89 d0             	mov    %edx,%r8d
+  80508b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80508f:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805092:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805096:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80509b:	44 89 c2             	mov    %r8d,%edx
+  80509e:	49 89 c7             	mov    %rax,%r15
+  8050a1:	49 b8 49 c6 ff ff ff 	movabs $0xffffffffffffc649,%r8
+  8050a8:	ff ff ff 
+  8050ab:	49 01 c0             	add    %rax,%r8
+  8050ae:	41 ff d0             	call   *%r8
+}
+  8050b1:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8050b5:	c9                   	leave
+  8050b6:	c3                   	ret
+
+00000000008050b7 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8050b7:	55                   	push   %rbp
+  8050b8:	48 89 e5             	mov    %rsp,%rbp
+  8050bb:	41 57                	push   %r15
+  8050bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8050c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050c1 <devsock_stat+0xa>
+  8050c8:	49 bb 8f 3f 00 00 00 	movabs $0x3f8f,%r11
+  8050cf:	00 00 00 
+  8050d2:	4c 01 d8             	add    %r11,%rax
+  8050d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8050d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8050dd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8050e1:	48 b9 9c e5 ff ff ff 	movabs $0xffffffffffffe59c,%rcx
+  8050e8:	ff ff ff 
+  8050eb:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8050ef:	48 89 ce             	mov    %rcx,%rsi
+  8050f2:	48 89 d7             	mov    %rdx,%rdi
+  8050f5:	49 89 c7             	mov    %rax,%r15
+  8050f8:	48 ba e4 84 ff ff ff 	movabs $0xffffffffffff84e4,%rdx
+  8050ff:	ff ff ff 
+  805102:	48 01 c2             	add    %rax,%rdx
+  805105:	ff d2                	call   *%rdx
+	return 0;
+  805107:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80510c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805110:	c9                   	leave
+  805111:	c3                   	ret
+
+0000000000805112 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  805112:	55                   	push   %rbp
+  805113:	48 89 e5             	mov    %rsp,%rbp
+  805116:	41 57                	push   %r15
+  805118:	53                   	push   %rbx
+  805119:	48 83 ec 20          	sub    $0x20,%rsp
+  80511d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80511d <socket+0xb>
+  805124:	49 bb 33 3f 00 00 00 	movabs $0x3f33,%r11
+  80512b:	00 00 00 
+  80512e:	4c 01 db             	add    %r11,%rbx
+  805131:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805134:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805137:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80513a:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80513d:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805140:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805143:	89 ce                	mov    %ecx,%esi
+  805145:	89 c7                	mov    %eax,%edi
+  805147:	49 89 df             	mov    %rbx,%r15
+  80514a:	48 b8 20 c8 ff ff ff 	movabs $0xffffffffffffc820,%rax
+  805151:	ff ff ff 
+  805154:	48 01 d8             	add    %rbx,%rax
+  805157:	ff d0                	call   *%rax
+  805159:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80515c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805160:	79 05                	jns    805167 <socket+0x55>
+		return r;
+  805162:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805165:	eb 15                	jmp    80517c <socket+0x6a>
+	return alloc_sockfd(r);
+  805167:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80516a:	89 c7                	mov    %eax,%edi
+  80516c:	48 b8 0a bc ff ff ff 	movabs $0xffffffffffffbc0a,%rax
+  805173:	ff ff ff 
+  805176:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80517a:	ff d0                	call   *%rax
+}
+  80517c:	48 83 c4 20          	add    $0x20,%rsp
+  805180:	5b                   	pop    %rbx
+  805181:	41 5f                	pop    %r15
+  805183:	5d                   	pop    %rbp
+  805184:	c3                   	ret
+
+0000000000805185 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805185:	55                   	push   %rbp
+  805186:	48 89 e5             	mov    %rsp,%rbp
+  805189:	41 57                	push   %r15
+  80518b:	53                   	push   %rbx
+  80518c:	48 83 ec 10          	sub    $0x10,%rsp
+  805190:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805190 <nsipc+0xb>
+  805197:	49 bb c0 3e 00 00 00 	movabs $0x3ec0,%r11
+  80519e:	00 00 00 
+  8051a1:	4c 01 db             	add    %r11,%rbx
+  8051a4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8051a7:	48 b8 b0 2f 01 00 00 	movabs $0x12fb0,%rax
+  8051ae:	00 00 00 
+  8051b1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8051b4:	85 c0                	test   %eax,%eax
+  8051b6:	75 24                	jne    8051dc <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8051b8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8051bd:	49 89 df             	mov    %rbx,%r15
+  8051c0:	48 b8 76 dd ff ff ff 	movabs $0xffffffffffffdd76,%rax
+  8051c7:	ff ff ff 
+  8051ca:	48 01 d8             	add    %rbx,%rax
+  8051cd:	ff d0                	call   *%rax
+  8051cf:	48 ba b0 2f 01 00 00 	movabs $0x12fb0,%rdx
+  8051d6:	00 00 00 
+  8051d9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  8051dc:	48 b8 b0 2f 01 00 00 	movabs $0x12fb0,%rax
+  8051e3:	00 00 00 
+  8051e6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8051e9:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8051ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8051f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8051f8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8051fd:	48 ba b0 4f 01 00 00 	movabs $0x14fb0,%rdx
+  805204:	00 00 00 
+  805207:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80520b:	89 c7                	mov    %eax,%edi
+  80520d:	49 89 df             	mov    %rbx,%r15
+  805210:	48 b8 95 d7 ff ff ff 	movabs $0xffffffffffffd795,%rax
+  805217:	ff ff ff 
+  80521a:	48 01 d8             	add    %rbx,%rax
+  80521d:	ff d0                	call   *%rax
+}
+  80521f:	48 83 c4 10          	add    $0x10,%rsp
+  805223:	5b                   	pop    %rbx
+  805224:	41 5f                	pop    %r15
+  805226:	5d                   	pop    %rbp
+  805227:	c3                   	ret
+
+0000000000805228 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805228:	55                   	push   %rbp
+  805229:	48 89 e5             	mov    %rsp,%rbp
+  80522c:	41 57                	push   %r15
+  80522e:	53                   	push   %rbx
+  80522f:	48 83 ec 20          	sub    $0x20,%rsp
+  805233:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805233 <nsipc_words+0xb>
+  80523a:	49 bb 1d 3e 00 00 00 	movabs $0x3e1d,%r11
+  805241:	00 00 00 
+  805244:	4c 01 db             	add    %r11,%rbx
+  805247:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80524a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80524e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805252:	48 b8 b0 2f 01 00 00 	movabs $0x12fb0,%rax
+  805259:	00 00 00 
+  80525c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80525f:	85 c0                	test   %eax,%eax
+  805261:	75 24                	jne    805287 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805263:	bf 02 00 00 00       	mov    $0x2,%edi
+  805268:	49 89 df             	mov    %rbx,%r15
+  80526b:	48 b8 76 dd ff ff ff 	movabs $0xffffffffffffdd76,%rax
+  805272:	ff ff ff 
+  805275:	48 01 d8             	add    %rbx,%rax
+  805278:	ff d0                	call   *%rax
+  80527a:	48 ba b0 2f 01 00 00 	movabs $0x12fb0,%rdx
+  805281:	00 00 00 
+  805284:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805287:	48 b8 b0 2f 01 00 00 	movabs $0x12fb0,%rax
+  80528e:	00 00 00 
+  805291:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805294:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805298:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80529c:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80529f:	89 c7                	mov    %eax,%edi
+  8052a1:	49 89 df             	mov    %rbx,%r15
+  8052a4:	48 b8 80 d8 ff ff ff 	movabs $0xffffffffffffd880,%rax
+  8052ab:	ff ff ff 
+  8052ae:	48 01 d8             	add    %rbx,%rax
+  8052b1:	ff d0                	call   *%rax
+}
+  8052b3:	48 83 c4 20          	add    $0x20,%rsp
+  8052b7:	5b                   	pop    %rbx
+  8052b8:	41 5f                	pop    %r15
+  8052ba:	5d                   	pop    %rbp
+  8052bb:	c3                   	ret
+
+00000000008052bc <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8052bc:	55                   	push   %rbp
+  8052bd:	48 89 e5             	mov    %rsp,%rbp
+  8052c0:	41 57                	push   %r15
+  8052c2:	53                   	push   %rbx
+  8052c3:	48 83 ec 30          	sub    $0x30,%rsp
+  8052c7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052c7 <nsipc_accept+0xb>
+  8052ce:	49 bb 89 3d 00 00 00 	movabs $0x3d89,%r11
+  8052d5:	00 00 00 
+  8052d8:	4c 01 db             	add    %r11,%rbx
+  8052db:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8052de:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8052e2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8052e6:	48 ba b0 4f 01 00 00 	movabs $0x14fb0,%rdx
+  8052ed:	00 00 00 
+  8052f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052f3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8052f6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8052fb:	48 b8 35 c1 ff ff ff 	movabs $0xffffffffffffc135,%rax
+  805302:	ff ff ff 
+  805305:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805309:	ff d0                	call   *%rax
+  80530b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80530e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805312:	78 48                	js     80535c <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805314:	48 b8 b0 4f 01 00 00 	movabs $0x14fb0,%rax
+  80531b:	00 00 00 
+  80531e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805322:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805326:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80532a:	8b 40 10             	mov    0x10(%rax),%eax
+  80532d:	89 c2                	mov    %eax,%edx
+  80532f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805333:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805337:	48 89 ce             	mov    %rcx,%rsi
+  80533a:	48 89 c7             	mov    %rax,%rdi
+  80533d:	49 89 df             	mov    %rbx,%r15
+  805340:	48 b8 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rax
+  805347:	ff ff ff 
+  80534a:	48 01 d8             	add    %rbx,%rax
+  80534d:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80534f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805353:	8b 50 10             	mov    0x10(%rax),%edx
+  805356:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80535a:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  80535c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80535f:	48 83 c4 30          	add    $0x30,%rsp
+  805363:	5b                   	pop    %rbx
+  805364:	41 5f                	pop    %r15
+  805366:	5d                   	pop    %rbp
+  805367:	c3                   	ret
+
+0000000000805368 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805368:	55                   	push   %rbp
+  805369:	48 89 e5             	mov    %rsp,%rbp
+  80536c:	41 57                	push   %r15
+  80536e:	53                   	push   %rbx
+  80536f:	48 83 ec 10          	sub    $0x10,%rsp
+  805373:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805373 <nsipc_bind+0xb>
+  80537a:	49 bb dd 3c 00 00 00 	movabs $0x3cdd,%r11
+  805381:	00 00 00 
+  805384:	4c 01 db             	add    %r11,%rbx
+  805387:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80538a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80538e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805391:	48 ba b0 4f 01 00 00 	movabs $0x14fb0,%rdx
+  805398:	00 00 00 
+  80539b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80539e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8053a1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8053a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053a8:	48 89 c6             	mov    %rax,%rsi
+  8053ab:	48 b8 b4 4f 01 00 00 	movabs $0x14fb4,%rax
+  8053b2:	00 00 00 
+  8053b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053b9:	48 89 c7             	mov    %rax,%rdi
+  8053bc:	49 89 df             	mov    %rbx,%r15
+  8053bf:	48 b8 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rax
+  8053c6:	ff ff ff 
+  8053c9:	48 01 d8             	add    %rbx,%rax
+  8053cc:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8053ce:	48 ba b0 4f 01 00 00 	movabs $0x14fb0,%rdx
+  8053d5:	00 00 00 
+  8053d8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053db:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8053df:	bf 02 00 00 00       	mov    $0x2,%edi
+  8053e4:	48 b8 35 c1 ff ff ff 	movabs $0xffffffffffffc135,%rax
+  8053eb:	ff ff ff 
+  8053ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053f2:	ff d0                	call   *%rax
+}
+  8053f4:	48 83 c4 10          	add    $0x10,%rsp
+  8053f8:	5b                   	pop    %rbx
+  8053f9:	41 5f                	pop    %r15
+  8053fb:	5d                   	pop    %rbp
+  8053fc:	c3                   	ret
+
+00000000008053fd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8053fd:	55                   	push   %rbp
+  8053fe:	48 89 e5             	mov    %rsp,%rbp
+  805401:	48 83 ec 20          	sub    $0x20,%rsp
+  805405:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805405 <nsipc_shutdown+0x8>
+  80540c:	49 bb 4b 3c 00 00 00 	movabs $0x3c4b,%r11
+  805413:	00 00 00 
+  805416:	4c 01 d8             	add    %r11,%rax
+  805419:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80541c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  80541f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805422:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805425:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805428:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80542b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80542f:	ba 08 00 00 00       	mov    $0x8,%edx
+  805434:	48 89 ce             	mov    %rcx,%rsi
+  805437:	bf 03 00 00 00       	mov    $0x3,%edi
+  80543c:	48 b9 d8 c1 ff ff ff 	movabs $0xffffffffffffc1d8,%rcx
+  805443:	ff ff ff 
+  805446:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80544a:	ff d0                	call   *%rax
+}
+  80544c:	c9                   	leave
+  80544d:	c3                   	ret
+
+000000000080544e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80544e:	55                   	push   %rbp
+  80544f:	48 89 e5             	mov    %rsp,%rbp
+  805452:	48 83 ec 20          	sub    $0x20,%rsp
+  805456:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805456 <nsipc_close+0x8>
+  80545d:	49 bb fa 3b 00 00 00 	movabs $0x3bfa,%r11
+  805464:	00 00 00 
+  805467:	4c 01 d8             	add    %r11,%rax
+  80546a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80546d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805470:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805473:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805477:	ba 04 00 00 00       	mov    $0x4,%edx
+  80547c:	48 89 ce             	mov    %rcx,%rsi
+  80547f:	bf 04 00 00 00       	mov    $0x4,%edi
+  805484:	48 b9 d8 c1 ff ff ff 	movabs $0xffffffffffffc1d8,%rcx
+  80548b:	ff ff ff 
+  80548e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805492:	ff d0                	call   *%rax
+}
+  805494:	c9                   	leave
+  805495:	c3                   	ret
+
+0000000000805496 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805496:	55                   	push   %rbp
+  805497:	48 89 e5             	mov    %rsp,%rbp
+  80549a:	41 57                	push   %r15
+  80549c:	53                   	push   %rbx
+  80549d:	48 83 ec 10          	sub    $0x10,%rsp
+  8054a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054a1 <nsipc_connect+0xb>
+  8054a8:	49 bb af 3b 00 00 00 	movabs $0x3baf,%r11
+  8054af:	00 00 00 
+  8054b2:	4c 01 db             	add    %r11,%rbx
+  8054b5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8054b8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8054bc:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8054bf:	48 ba b0 4f 01 00 00 	movabs $0x14fb0,%rdx
+  8054c6:	00 00 00 
+  8054c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054cc:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8054cf:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8054d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054d6:	48 89 c6             	mov    %rax,%rsi
+  8054d9:	48 b8 b4 4f 01 00 00 	movabs $0x14fb4,%rax
+  8054e0:	00 00 00 
+  8054e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054e7:	48 89 c7             	mov    %rax,%rdi
+  8054ea:	49 89 df             	mov    %rbx,%r15
+  8054ed:	48 b8 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rax
+  8054f4:	ff ff ff 
+  8054f7:	48 01 d8             	add    %rbx,%rax
+  8054fa:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8054fc:	48 ba b0 4f 01 00 00 	movabs $0x14fb0,%rdx
+  805503:	00 00 00 
+  805506:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805509:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  80550d:	bf 05 00 00 00       	mov    $0x5,%edi
+  805512:	48 b8 35 c1 ff ff ff 	movabs $0xffffffffffffc135,%rax
+  805519:	ff ff ff 
+  80551c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805520:	ff d0                	call   *%rax
+}
+  805522:	48 83 c4 10          	add    $0x10,%rsp
+  805526:	5b                   	pop    %rbx
+  805527:	41 5f                	pop    %r15
+  805529:	5d                   	pop    %rbp
+  80552a:	c3                   	ret
+
+000000000080552b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80552b:	55                   	push   %rbp
+  80552c:	48 89 e5             	mov    %rsp,%rbp
+  80552f:	48 83 ec 20          	sub    $0x20,%rsp
+  805533:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805533 <nsipc_listen+0x8>
+  80553a:	49 bb 1d 3b 00 00 00 	movabs $0x3b1d,%r11
+  805541:	00 00 00 
+  805544:	4c 01 d8             	add    %r11,%rax
+  805547:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80554a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  80554d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805550:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805553:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805556:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805559:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80555d:	ba 08 00 00 00       	mov    $0x8,%edx
+  805562:	48 89 ce             	mov    %rcx,%rsi
+  805565:	bf 06 00 00 00       	mov    $0x6,%edi
+  80556a:	48 b9 d8 c1 ff ff ff 	movabs $0xffffffffffffc1d8,%rcx
+  805571:	ff ff ff 
+  805574:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805578:	ff d0                	call   *%rax
+}
+  80557a:	c9                   	leave
+  80557b:	c3                   	ret
+
+000000000080557c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80557c:	55                   	push   %rbp
+  80557d:	48 89 e5             	mov    %rsp,%rbp
+  805580:	41 57                	push   %r15
+  805582:	53                   	push   %rbx
+  805583:	48 83 ec 30          	sub    $0x30,%rsp
+  805587:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805587 <nsipc_recv+0xb>
+  80558e:	49 bb c9 3a 00 00 00 	movabs $0x3ac9,%r11
+  805595:	00 00 00 
+  805598:	4c 01 db             	add    %r11,%rbx
+  80559b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80559e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8055a2:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8055a5:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8055a8:	48 ba b0 4f 01 00 00 	movabs $0x14fb0,%rdx
+  8055af:	00 00 00 
+  8055b2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8055b5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8055b8:	48 ba b0 4f 01 00 00 	movabs $0x14fb0,%rdx
+  8055bf:	00 00 00 
+  8055c2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8055c5:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8055c9:	48 ba b0 4f 01 00 00 	movabs $0x14fb0,%rdx
+  8055d0:	00 00 00 
+  8055d3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8055d6:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8055da:	bf 07 00 00 00       	mov    $0x7,%edi
+  8055df:	48 b8 35 c1 ff ff ff 	movabs $0xffffffffffffc135,%rax
+  8055e6:	ff ff ff 
+  8055e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055ed:	ff d0                	call   *%rax
+  8055ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055f6:	0f 88 91 00 00 00    	js     80568d <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8055fc:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805603:	7f 08                	jg     80560d <nsipc_recv+0x91>
+  805605:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805608:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  80560b:	7e 50                	jle    80565d <nsipc_recv+0xe1>
+  80560d:	48 b8 a3 e5 ff ff ff 	movabs $0xffffffffffffe5a3,%rax
+  805614:	ff ff ff 
+  805617:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80561b:	48 89 c1             	mov    %rax,%rcx
+  80561e:	48 b8 b8 e5 ff ff ff 	movabs $0xffffffffffffe5b8,%rax
+  805625:	ff ff ff 
+  805628:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80562c:	48 89 c2             	mov    %rax,%rdx
+  80562f:	be 79 00 00 00       	mov    $0x79,%esi
+  805634:	48 b8 cd e5 ff ff ff 	movabs $0xffffffffffffe5cd,%rax
+  80563b:	ff ff ff 
+  80563e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805642:	48 89 c7             	mov    %rax,%rdi
+  805645:	49 89 df             	mov    %rbx,%r15
+  805648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80564d:	49 b8 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%r8
+  805654:	ff ff ff 
+  805657:	49 01 d8             	add    %rbx,%r8
+  80565a:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80565d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805660:	48 63 d0             	movslq %eax,%rdx
+  805663:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805667:	48 b9 b0 4f 01 00 00 	movabs $0x14fb0,%rcx
+  80566e:	00 00 00 
+  805671:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805675:	48 89 ce             	mov    %rcx,%rsi
+  805678:	48 89 c7             	mov    %rax,%rdi
+  80567b:	49 89 df             	mov    %rbx,%r15
+  80567e:	48 b8 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rax
+  805685:	ff ff ff 
+  805688:	48 01 d8             	add    %rbx,%rax
+  80568b:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80568d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805690:	48 83 c4 30          	add    $0x30,%rsp
+  805694:	5b                   	pop    %rbx
+  805695:	41 5f                	pop    %r15
+  805697:	5d                   	pop    %rbp
+  805698:	c3                   	ret
+
+0000000000805699 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805699:	55                   	push   %rbp
+  80569a:	48 89 e5             	mov    %rsp,%rbp
+  80569d:	41 57                	push   %r15
+  80569f:	53                   	push   %rbx
+  8056a0:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8056a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056a7 <nsipc_send+0xe>
+  8056ae:	49 bb a9 39 00 00 00 	movabs $0x39a9,%r11
+  8056b5:	00 00 00 
+  8056b8:	4c 01 db             	add    %r11,%rbx
+  8056bb:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8056c1:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8056c8:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8056ce:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8056d4:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8056d8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  8056dc:	48 b8 b0 2f 01 00 00 	movabs $0x12fb0,%rax
+  8056e3:	00 00 00 
+  8056e6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056e9:	85 c0                	test   %eax,%eax
+  8056eb:	75 24                	jne    805711 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8056ed:	bf 02 00 00 00       	mov    $0x2,%edi
+  8056f2:	49 89 df             	mov    %rbx,%r15
+  8056f5:	48 b8 76 dd ff ff ff 	movabs $0xffffffffffffdd76,%rax
+  8056fc:	ff ff ff 
+  8056ff:	48 01 d8             	add    %rbx,%rax
+  805702:	ff d0                	call   *%rax
+  805704:	48 ba b0 2f 01 00 00 	movabs $0x12fb0,%rdx
+  80570b:	00 00 00 
+  80570e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805711:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805717:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80571a:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805721:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805724:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805727:	39 c2                	cmp    %eax,%edx
+  805729:	0f 4e c2             	cmovle %edx,%eax
+  80572c:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805732:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805738:	48 63 d0             	movslq %eax,%rdx
+  80573b:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805742:	48 89 c6             	mov    %rax,%rsi
+  805745:	48 b8 b0 2f 00 00 00 	movabs $0x2fb0,%rax
+  80574c:	00 00 00 
+  80574f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805753:	48 89 c7             	mov    %rax,%rdi
+  805756:	49 89 df             	mov    %rbx,%r15
+  805759:	48 b8 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rax
+  805760:	ff ff ff 
+  805763:	48 01 d8             	add    %rbx,%rax
+  805766:	ff d0                	call   *%rax
+	req->req_s = s;
+  805768:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80576c:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805772:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805774:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805778:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80577e:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805781:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805785:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80578b:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  80578e:	48 b8 b0 2f 00 00 00 	movabs $0x2fb0,%rax
+  805795:	00 00 00 
+  805798:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80579c:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8057a0:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8057a7:	00 
+  8057a8:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8057ae:	48 63 d0             	movslq %eax,%rdx
+  8057b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057b5:	48 01 d0             	add    %rdx,%rax
+  8057b8:	48 83 e8 01          	sub    $0x1,%rax
+  8057bc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8057c0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057c9:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8057cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057d1:	48 29 d0             	sub    %rdx,%rax
+  8057d4:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8057da:	85 c0                	test   %eax,%eax
+  8057dc:	0f 48 c2             	cmovs  %edx,%eax
+  8057df:	c1 f8 0c             	sar    $0xc,%eax
+  8057e2:	48 98                	cltq
+  8057e4:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8057e8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8057ec:	48 85 c0             	test   %rax,%rax
+  8057ef:	0f 95 c0             	setne  %al
+  8057f2:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8057f5:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8057fc:	00 
+  8057fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805801:	48 83 c0 0b          	add    $0xb,%rax
+  805805:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805809:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80580d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805812:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805816:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80581a:	48 29 d0             	sub    %rdx,%rax
+  80581d:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805821:	89 c7                	mov    %eax,%edi
+  805823:	48 b8 b0 2f 01 00 00 	movabs $0x12fb0,%rax
+  80582a:	00 00 00 
+  80582d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805830:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805834:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805838:	48 83 ec 08          	sub    $0x8,%rsp
+  80583c:	6a 00                	push   $0x0
+  80583e:	6a 00                	push   $0x0
+  805840:	6a 05                	push   $0x5
+  805842:	41 89 f1             	mov    %esi,%r9d
+  805845:	49 89 c8             	mov    %rcx,%r8
+  805848:	89 f9                	mov    %edi,%ecx
+  80584a:	be 08 00 00 00       	mov    $0x8,%esi
+  80584f:	89 c7                	mov    %eax,%edi
+  805851:	49 89 df             	mov    %rbx,%r15
+  805854:	48 b8 7e d9 ff ff ff 	movabs $0xffffffffffffd97e,%rax
+  80585b:	ff ff ff 
+  80585e:	48 01 d8             	add    %rbx,%rax
+  805861:	ff d0                	call   *%rax
+  805863:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805867:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80586b:	5b                   	pop    %rbx
+  80586c:	41 5f                	pop    %r15
+  80586e:	5d                   	pop    %rbp
+  80586f:	c3                   	ret
+
+0000000000805870 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805870:	55                   	push   %rbp
+  805871:	48 89 e5             	mov    %rsp,%rbp
+  805874:	48 83 ec 10          	sub    $0x10,%rsp
+  805878:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805878 <nsipc_socket+0x8>
+  80587f:	49 bb d8 37 00 00 00 	movabs $0x37d8,%r11
+  805886:	00 00 00 
+  805889:	4c 01 d8             	add    %r11,%rax
+  80588c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80588f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805892:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805895:	48 b9 b0 4f 01 00 00 	movabs $0x14fb0,%rcx
+  80589c:	00 00 00 
+  80589f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8058a2:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8058a5:	48 b9 b0 4f 01 00 00 	movabs $0x14fb0,%rcx
+  8058ac:	00 00 00 
+  8058af:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8058b2:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8058b6:	48 b9 b0 4f 01 00 00 	movabs $0x14fb0,%rcx
+  8058bd:	00 00 00 
+  8058c0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8058c3:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8058c7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8058cc:	48 ba 35 c1 ff ff ff 	movabs $0xffffffffffffc135,%rdx
+  8058d3:	ff ff ff 
+  8058d6:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8058da:	ff d0                	call   *%rax
+}
+  8058dc:	c9                   	leave
+  8058dd:	c3                   	ret
+
+00000000008058de <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8058de:	55                   	push   %rbp
+  8058df:	48 89 e5             	mov    %rsp,%rbp
+  8058e2:	41 57                	push   %r15
+  8058e4:	53                   	push   %rbx
+  8058e5:	48 83 ec 30          	sub    $0x30,%rsp
+  8058e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058e9 <pipe+0xb>
+  8058f0:	49 bb 67 37 00 00 00 	movabs $0x3767,%r11
+  8058f7:	00 00 00 
+  8058fa:	4c 01 db             	add    %r11,%rbx
+  8058fd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805901:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805905:	48 89 c7             	mov    %rax,%rdi
+  805908:	49 89 df             	mov    %rbx,%r15
+  80590b:	48 b8 4f a5 ff ff ff 	movabs $0xffffffffffffa54f,%rax
+  805912:	ff ff ff 
+  805915:	48 01 d8             	add    %rbx,%rax
+  805918:	ff d0                	call   *%rax
+  80591a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80591d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805921:	0f 88 12 02 00 00    	js     805b39 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805927:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80592b:	ba 07 04 00 00       	mov    $0x407,%edx
+  805930:	48 89 c6             	mov    %rax,%rsi
+  805933:	bf 00 00 00 00       	mov    $0x0,%edi
+  805938:	49 89 df             	mov    %rbx,%r15
+  80593b:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  805942:	ff ff ff 
+  805945:	48 01 d8             	add    %rbx,%rax
+  805948:	ff d0                	call   *%rax
+  80594a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80594d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805951:	0f 88 e2 01 00 00    	js     805b39 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805957:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80595b:	48 89 c7             	mov    %rax,%rdi
+  80595e:	49 89 df             	mov    %rbx,%r15
+  805961:	48 b8 4f a5 ff ff ff 	movabs $0xffffffffffffa54f,%rax
+  805968:	ff ff ff 
+  80596b:	48 01 d8             	add    %rbx,%rax
+  80596e:	ff d0                	call   *%rax
+  805970:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805973:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805977:	0f 88 9b 01 00 00    	js     805b18 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80597d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805981:	ba 07 04 00 00       	mov    $0x407,%edx
+  805986:	48 89 c6             	mov    %rax,%rsi
+  805989:	bf 00 00 00 00       	mov    $0x0,%edi
+  80598e:	49 89 df             	mov    %rbx,%r15
+  805991:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  805998:	ff ff ff 
+  80599b:	48 01 d8             	add    %rbx,%rax
+  80599e:	ff d0                	call   *%rax
+  8059a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059a7:	0f 88 6b 01 00 00    	js     805b18 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8059ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059b1:	48 89 c7             	mov    %rax,%rdi
+  8059b4:	49 89 df             	mov    %rbx,%r15
+  8059b7:	48 b8 0c a5 ff ff ff 	movabs $0xffffffffffffa50c,%rax
+  8059be:	ff ff ff 
+  8059c1:	48 01 d8             	add    %rbx,%rax
+  8059c4:	ff d0                	call   *%rax
+  8059c6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8059ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059ce:	ba 07 04 00 00       	mov    $0x407,%edx
+  8059d3:	48 89 c6             	mov    %rax,%rsi
+  8059d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059db:	49 89 df             	mov    %rbx,%r15
+  8059de:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  8059e5:	ff ff ff 
+  8059e8:	48 01 d8             	add    %rbx,%rax
+  8059eb:	ff d0                	call   *%rax
+  8059ed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059f4:	0f 88 fd 00 00 00    	js     805af7 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8059fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059fe:	48 89 c7             	mov    %rax,%rdi
+  805a01:	49 89 df             	mov    %rbx,%r15
+  805a04:	48 b8 0c a5 ff ff ff 	movabs $0xffffffffffffa50c,%rax
+  805a0b:	ff ff ff 
+  805a0e:	48 01 d8             	add    %rbx,%rax
+  805a11:	ff d0                	call   *%rax
+  805a13:	48 89 c2             	mov    %rax,%rdx
+  805a16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a1a:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805a20:	48 89 d1             	mov    %rdx,%rcx
+  805a23:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a28:	48 89 c6             	mov    %rax,%rsi
+  805a2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a30:	49 89 df             	mov    %rbx,%r15
+  805a33:	48 b8 05 92 ff ff ff 	movabs $0xffffffffffff9205,%rax
+  805a3a:	ff ff ff 
+  805a3d:	48 01 d8             	add    %rbx,%rax
+  805a40:	ff d0                	call   *%rax
+  805a42:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a49:	0f 88 87 00 00 00    	js     805ad6 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805a4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a53:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805a5a:	00 00 00 
+  805a5d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805a60:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805a62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a66:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805a6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a71:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805a78:	00 00 00 
+  805a7b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805a7e:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805a80:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a84:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805a8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a8f:	48 89 c7             	mov    %rax,%rdi
+  805a92:	49 89 df             	mov    %rbx,%r15
+  805a95:	48 b8 d5 a4 ff ff ff 	movabs $0xffffffffffffa4d5,%rax
+  805a9c:	ff ff ff 
+  805a9f:	48 01 d8             	add    %rbx,%rax
+  805aa2:	ff d0                	call   *%rax
+  805aa4:	89 c2                	mov    %eax,%edx
+  805aa6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805aaa:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805aac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ab0:	48 89 c7             	mov    %rax,%rdi
+  805ab3:	49 89 df             	mov    %rbx,%r15
+  805ab6:	48 b8 d5 a4 ff ff ff 	movabs $0xffffffffffffa4d5,%rax
+  805abd:	ff ff ff 
+  805ac0:	48 01 d8             	add    %rbx,%rax
+  805ac3:	ff d0                	call   *%rax
+  805ac5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805ac9:	48 83 c2 04          	add    $0x4,%rdx
+  805acd:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ad4:	eb 67                	jmp    805b3d <pipe+0x25f>
+		goto err3;
+  805ad6:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805ad7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805adb:	48 89 c6             	mov    %rax,%rsi
+  805ade:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ae3:	49 89 df             	mov    %rbx,%r15
+  805ae6:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  805aed:	ff ff ff 
+  805af0:	48 01 d8             	add    %rbx,%rax
+  805af3:	ff d0                	call   *%rax
+  805af5:	eb 01                	jmp    805af8 <pipe+0x21a>
+		goto err2;
+  805af7:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805af8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805afc:	48 89 c6             	mov    %rax,%rsi
+  805aff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b04:	49 89 df             	mov    %rbx,%r15
+  805b07:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  805b0e:	ff ff ff 
+  805b11:	48 01 d8             	add    %rbx,%rax
+  805b14:	ff d0                	call   *%rax
+  805b16:	eb 01                	jmp    805b19 <pipe+0x23b>
+		goto err1;
+  805b18:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805b19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b1d:	48 89 c6             	mov    %rax,%rsi
+  805b20:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b25:	49 89 df             	mov    %rbx,%r15
+  805b28:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  805b2f:	ff ff ff 
+  805b32:	48 01 d8             	add    %rbx,%rax
+  805b35:	ff d0                	call   *%rax
+  805b37:	eb 01                	jmp    805b3a <pipe+0x25c>
+		goto err;
+  805b39:	90                   	nop
+err:
+	return r;
+  805b3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805b3d:	48 83 c4 30          	add    $0x30,%rsp
+  805b41:	5b                   	pop    %rbx
+  805b42:	41 5f                	pop    %r15
+  805b44:	5d                   	pop    %rbp
+  805b45:	c3                   	ret
+
+0000000000805b46 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805b46:	55                   	push   %rbp
+  805b47:	48 89 e5             	mov    %rsp,%rbp
+  805b4a:	41 57                	push   %r15
+  805b4c:	41 54                	push   %r12
+  805b4e:	53                   	push   %rbx
+  805b4f:	48 83 ec 28          	sub    $0x28,%rsp
+  805b53:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b53 <_pipeisclosed+0xd>
+  805b5a:	49 bb fd 34 00 00 00 	movabs $0x34fd,%r11
+  805b61:	00 00 00 
+  805b64:	4c 01 db             	add    %r11,%rbx
+  805b67:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805b6b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805b6f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805b76:	ff ff ff 
+  805b79:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b7d:	48 8b 00             	mov    (%rax),%rax
+  805b80:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805b86:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805b89:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b8d:	48 89 c7             	mov    %rax,%rdi
+  805b90:	49 89 df             	mov    %rbx,%r15
+  805b93:	48 b8 05 de ff ff ff 	movabs $0xffffffffffffde05,%rax
+  805b9a:	ff ff ff 
+  805b9d:	48 01 d8             	add    %rbx,%rax
+  805ba0:	ff d0                	call   *%rax
+  805ba2:	41 89 c4             	mov    %eax,%r12d
+  805ba5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805ba9:	48 89 c7             	mov    %rax,%rdi
+  805bac:	49 89 df             	mov    %rbx,%r15
+  805baf:	48 b8 05 de ff ff ff 	movabs $0xffffffffffffde05,%rax
+  805bb6:	ff ff ff 
+  805bb9:	48 01 d8             	add    %rbx,%rax
+  805bbc:	ff d0                	call   *%rax
+  805bbe:	41 39 c4             	cmp    %eax,%r12d
+  805bc1:	0f 94 c0             	sete   %al
+  805bc4:	0f b6 c0             	movzbl %al,%eax
+  805bc7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805bca:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805bd1:	ff ff ff 
+  805bd4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bd8:	48 8b 00             	mov    (%rax),%rax
+  805bdb:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805be1:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805be4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805be7:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805bea:	75 05                	jne    805bf1 <_pipeisclosed+0xab>
+			return ret;
+  805bec:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805bef:	eb 63                	jmp    805c54 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805bf1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bf4:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805bf7:	0f 84 72 ff ff ff    	je     805b6f <_pipeisclosed+0x29>
+  805bfd:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805c01:	0f 85 68 ff ff ff    	jne    805b6f <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805c07:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805c0e:	ff ff ff 
+  805c11:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c15:	48 8b 00             	mov    (%rax),%rax
+  805c18:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805c1e:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805c21:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c24:	89 c6                	mov    %eax,%esi
+  805c26:	48 b8 de e5 ff ff ff 	movabs $0xffffffffffffe5de,%rax
+  805c2d:	ff ff ff 
+  805c30:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c34:	48 89 c7             	mov    %rax,%rdi
+  805c37:	49 89 df             	mov    %rbx,%r15
+  805c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c3f:	49 b8 22 77 ff ff ff 	movabs $0xffffffffffff7722,%r8
+  805c46:	ff ff ff 
+  805c49:	49 01 d8             	add    %rbx,%r8
+  805c4c:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805c4f:	e9 1b ff ff ff       	jmp    805b6f <_pipeisclosed+0x29>
+	}
+}
+  805c54:	48 83 c4 28          	add    $0x28,%rsp
+  805c58:	5b                   	pop    %rbx
+  805c59:	41 5c                	pop    %r12
+  805c5b:	41 5f                	pop    %r15
+  805c5d:	5d                   	pop    %rbp
+  805c5e:	c3                   	ret
+
+0000000000805c5f <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805c5f:	55                   	push   %rbp
+  805c60:	48 89 e5             	mov    %rsp,%rbp
+  805c63:	41 57                	push   %r15
+  805c65:	53                   	push   %rbx
+  805c66:	48 83 ec 30          	sub    $0x30,%rsp
+  805c6a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c6a <pipeisclosed+0xb>
+  805c71:	49 bb e6 33 00 00 00 	movabs $0x33e6,%r11
+  805c78:	00 00 00 
+  805c7b:	4c 01 db             	add    %r11,%rbx
+  805c7e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805c81:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805c85:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c88:	48 89 d6             	mov    %rdx,%rsi
+  805c8b:	89 c7                	mov    %eax,%edi
+  805c8d:	49 89 df             	mov    %rbx,%r15
+  805c90:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  805c97:	ff ff ff 
+  805c9a:	48 01 d8             	add    %rbx,%rax
+  805c9d:	ff d0                	call   *%rax
+  805c9f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ca2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ca6:	79 05                	jns    805cad <pipeisclosed+0x4e>
+		return r;
+  805ca8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cab:	eb 3b                	jmp    805ce8 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805cad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cb1:	48 89 c7             	mov    %rax,%rdi
+  805cb4:	49 89 df             	mov    %rbx,%r15
+  805cb7:	48 b8 0c a5 ff ff ff 	movabs $0xffffffffffffa50c,%rax
+  805cbe:	ff ff ff 
+  805cc1:	48 01 d8             	add    %rbx,%rax
+  805cc4:	ff d0                	call   *%rax
+  805cc6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805cca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cce:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805cd2:	48 89 d6             	mov    %rdx,%rsi
+  805cd5:	48 89 c7             	mov    %rax,%rdi
+  805cd8:	48 b8 f6 ca ff ff ff 	movabs $0xffffffffffffcaf6,%rax
+  805cdf:	ff ff ff 
+  805ce2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ce6:	ff d0                	call   *%rax
+}
+  805ce8:	48 83 c4 30          	add    $0x30,%rsp
+  805cec:	5b                   	pop    %rbx
+  805ced:	41 5f                	pop    %r15
+  805cef:	5d                   	pop    %rbp
+  805cf0:	c3                   	ret
+
+0000000000805cf1 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805cf1:	55                   	push   %rbp
+  805cf2:	48 89 e5             	mov    %rsp,%rbp
+  805cf5:	41 57                	push   %r15
+  805cf7:	53                   	push   %rbx
+  805cf8:	48 83 ec 40          	sub    $0x40,%rsp
+  805cfc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cfc <devpipe_read+0xb>
+  805d03:	49 bb 54 33 00 00 00 	movabs $0x3354,%r11
+  805d0a:	00 00 00 
+  805d0d:	4c 01 db             	add    %r11,%rbx
+  805d10:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805d14:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805d18:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805d1c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d20:	48 89 c7             	mov    %rax,%rdi
+  805d23:	49 89 df             	mov    %rbx,%r15
+  805d26:	48 b8 0c a5 ff ff ff 	movabs $0xffffffffffffa50c,%rax
+  805d2d:	ff ff ff 
+  805d30:	48 01 d8             	add    %rbx,%rax
+  805d33:	ff d0                	call   *%rax
+  805d35:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805d39:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d3d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805d41:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805d48:	00 
+  805d49:	e9 a1 00 00 00       	jmp    805def <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805d4e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805d53:	74 09                	je     805d5e <devpipe_read+0x6d>
+				return i;
+  805d55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d59:	e9 9f 00 00 00       	jmp    805dfd <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805d5e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d66:	48 89 d6             	mov    %rdx,%rsi
+  805d69:	48 89 c7             	mov    %rax,%rdi
+  805d6c:	48 b8 f6 ca ff ff ff 	movabs $0xffffffffffffcaf6,%rax
+  805d73:	ff ff ff 
+  805d76:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d7a:	ff d0                	call   *%rax
+  805d7c:	85 c0                	test   %eax,%eax
+  805d7e:	74 07                	je     805d87 <devpipe_read+0x96>
+				return 0;
+  805d80:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d85:	eb 76                	jmp    805dfd <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805d87:	49 89 df             	mov    %rbx,%r15
+  805d8a:	48 b8 4b 91 ff ff ff 	movabs $0xffffffffffff914b,%rax
+  805d91:	ff ff ff 
+  805d94:	48 01 d8             	add    %rbx,%rax
+  805d97:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805d99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d9d:	8b 10                	mov    (%rax),%edx
+  805d9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805da3:	8b 40 04             	mov    0x4(%rax),%eax
+  805da6:	39 c2                	cmp    %eax,%edx
+  805da8:	74 a4                	je     805d4e <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805daa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805dae:	8b 10                	mov    (%rax),%edx
+  805db0:	89 d0                	mov    %edx,%eax
+  805db2:	c1 f8 1f             	sar    $0x1f,%eax
+  805db5:	c1 e8 1b             	shr    $0x1b,%eax
+  805db8:	01 c2                	add    %eax,%edx
+  805dba:	83 e2 1f             	and    $0x1f,%edx
+  805dbd:	29 c2                	sub    %eax,%edx
+  805dbf:	89 d6                	mov    %edx,%esi
+  805dc1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805dc5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dc9:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805dcd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805dd1:	48 63 c6             	movslq %esi,%rax
+  805dd4:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805dd9:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805ddb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ddf:	8b 00                	mov    (%rax),%eax
+  805de1:	8d 50 01             	lea    0x1(%rax),%edx
+  805de4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805de8:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805dea:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805def:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805df3:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805df7:	72 a0                	jb     805d99 <devpipe_read+0xa8>
+	}
+	return i;
+  805df9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805dfd:	48 83 c4 40          	add    $0x40,%rsp
+  805e01:	5b                   	pop    %rbx
+  805e02:	41 5f                	pop    %r15
+  805e04:	5d                   	pop    %rbp
+  805e05:	c3                   	ret
+
+0000000000805e06 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805e06:	55                   	push   %rbp
+  805e07:	48 89 e5             	mov    %rsp,%rbp
+  805e0a:	41 57                	push   %r15
+  805e0c:	53                   	push   %rbx
+  805e0d:	48 83 ec 40          	sub    $0x40,%rsp
+  805e11:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e11 <devpipe_write+0xb>
+  805e18:	49 bb 3f 32 00 00 00 	movabs $0x323f,%r11
+  805e1f:	00 00 00 
+  805e22:	4c 01 db             	add    %r11,%rbx
+  805e25:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805e29:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805e2d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805e31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e35:	48 89 c7             	mov    %rax,%rdi
+  805e38:	49 89 df             	mov    %rbx,%r15
+  805e3b:	48 b8 0c a5 ff ff ff 	movabs $0xffffffffffffa50c,%rax
+  805e42:	ff ff ff 
+  805e45:	48 01 d8             	add    %rbx,%rax
+  805e48:	ff d0                	call   *%rax
+  805e4a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805e4e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805e52:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805e56:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805e5d:	00 
+  805e5e:	e9 a0 00 00 00       	jmp    805f03 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805e63:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e6b:	48 89 d6             	mov    %rdx,%rsi
+  805e6e:	48 89 c7             	mov    %rax,%rdi
+  805e71:	48 b8 f6 ca ff ff ff 	movabs $0xffffffffffffcaf6,%rax
+  805e78:	ff ff ff 
+  805e7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e7f:	ff d0                	call   *%rax
+  805e81:	85 c0                	test   %eax,%eax
+  805e83:	74 0a                	je     805e8f <devpipe_write+0x89>
+				return 0;
+  805e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e8a:	e9 82 00 00 00       	jmp    805f11 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805e8f:	49 89 df             	mov    %rbx,%r15
+  805e92:	48 b8 4b 91 ff ff ff 	movabs $0xffffffffffff914b,%rax
+  805e99:	ff ff ff 
+  805e9c:	48 01 d8             	add    %rbx,%rax
+  805e9f:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805ea1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ea5:	8b 40 04             	mov    0x4(%rax),%eax
+  805ea8:	48 63 d0             	movslq %eax,%rdx
+  805eab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805eaf:	8b 00                	mov    (%rax),%eax
+  805eb1:	48 98                	cltq
+  805eb3:	48 83 c0 20          	add    $0x20,%rax
+  805eb7:	48 39 c2             	cmp    %rax,%rdx
+  805eba:	73 a7                	jae    805e63 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805ebc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805ec0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ec4:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805ec8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ecc:	8b 50 04             	mov    0x4(%rax),%edx
+  805ecf:	89 d0                	mov    %edx,%eax
+  805ed1:	c1 f8 1f             	sar    $0x1f,%eax
+  805ed4:	c1 e8 1b             	shr    $0x1b,%eax
+  805ed7:	01 c2                	add    %eax,%edx
+  805ed9:	83 e2 1f             	and    $0x1f,%edx
+  805edc:	29 c2                	sub    %eax,%edx
+  805ede:	89 d0                	mov    %edx,%eax
+  805ee0:	0f b6 09             	movzbl (%rcx),%ecx
+  805ee3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ee7:	48 98                	cltq
+  805ee9:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805eed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ef1:	8b 40 04             	mov    0x4(%rax),%eax
+  805ef4:	8d 50 01             	lea    0x1(%rax),%edx
+  805ef7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805efb:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805efe:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805f03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f07:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805f0b:	72 94                	jb     805ea1 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805f0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805f11:	48 83 c4 40          	add    $0x40,%rsp
+  805f15:	5b                   	pop    %rbx
+  805f16:	41 5f                	pop    %r15
+  805f18:	5d                   	pop    %rbp
+  805f19:	c3                   	ret
+
+0000000000805f1a <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805f1a:	55                   	push   %rbp
+  805f1b:	48 89 e5             	mov    %rsp,%rbp
+  805f1e:	41 57                	push   %r15
+  805f20:	53                   	push   %rbx
+  805f21:	48 83 ec 20          	sub    $0x20,%rsp
+  805f25:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f25 <devpipe_stat+0xb>
+  805f2c:	49 bb 2b 31 00 00 00 	movabs $0x312b,%r11
+  805f33:	00 00 00 
+  805f36:	4c 01 db             	add    %r11,%rbx
+  805f39:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805f3d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805f41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f45:	48 89 c7             	mov    %rax,%rdi
+  805f48:	49 89 df             	mov    %rbx,%r15
+  805f4b:	48 b8 0c a5 ff ff ff 	movabs $0xffffffffffffa50c,%rax
+  805f52:	ff ff ff 
+  805f55:	48 01 d8             	add    %rbx,%rax
+  805f58:	ff d0                	call   *%rax
+  805f5a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805f5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f62:	48 ba f1 e5 ff ff ff 	movabs $0xffffffffffffe5f1,%rdx
+  805f69:	ff ff ff 
+  805f6c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805f70:	48 89 d6             	mov    %rdx,%rsi
+  805f73:	48 89 c7             	mov    %rax,%rdi
+  805f76:	49 89 df             	mov    %rbx,%r15
+  805f79:	48 b8 e4 84 ff ff ff 	movabs $0xffffffffffff84e4,%rax
+  805f80:	ff ff ff 
+  805f83:	48 01 d8             	add    %rbx,%rax
+  805f86:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805f88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f8c:	8b 50 04             	mov    0x4(%rax),%edx
+  805f8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f93:	8b 00                	mov    (%rax),%eax
+  805f95:	29 c2                	sub    %eax,%edx
+  805f97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f9b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805fa1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fa5:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805fac:	00 00 00 
+	stat->st_dev = &devpipe;
+  805faf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fb3:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805fba:	00 00 00 
+  805fbd:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805fc1:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805fcd:	48 83 c4 20          	add    $0x20,%rsp
+  805fd1:	5b                   	pop    %rbx
+  805fd2:	41 5f                	pop    %r15
+  805fd4:	5d                   	pop    %rbp
+  805fd5:	c3                   	ret
+
+0000000000805fd6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805fd6:	55                   	push   %rbp
+  805fd7:	48 89 e5             	mov    %rsp,%rbp
+  805fda:	41 57                	push   %r15
+  805fdc:	53                   	push   %rbx
+  805fdd:	48 83 ec 10          	sub    $0x10,%rsp
+  805fe1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fe1 <devpipe_close+0xb>
+  805fe8:	49 bb 6f 30 00 00 00 	movabs $0x306f,%r11
+  805fef:	00 00 00 
+  805ff2:	4c 01 db             	add    %r11,%rbx
+  805ff5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805ff9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ffd:	48 89 c6             	mov    %rax,%rsi
+  806000:	bf 00 00 00 00       	mov    $0x0,%edi
+  806005:	49 89 df             	mov    %rbx,%r15
+  806008:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  80600f:	ff ff ff 
+  806012:	48 01 d8             	add    %rbx,%rax
+  806015:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  806017:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80601b:	48 89 c7             	mov    %rax,%rdi
+  80601e:	49 89 df             	mov    %rbx,%r15
+  806021:	48 b8 0c a5 ff ff ff 	movabs $0xffffffffffffa50c,%rax
+  806028:	ff ff ff 
+  80602b:	48 01 d8             	add    %rbx,%rax
+  80602e:	ff d0                	call   *%rax
+  806030:	48 89 c6             	mov    %rax,%rsi
+  806033:	bf 00 00 00 00       	mov    $0x0,%edi
+  806038:	49 89 df             	mov    %rbx,%r15
+  80603b:	48 b8 78 92 ff ff ff 	movabs $0xffffffffffff9278,%rax
+  806042:	ff ff ff 
+  806045:	48 01 d8             	add    %rbx,%rax
+  806048:	ff d0                	call   *%rax
+}
+  80604a:	48 83 c4 10          	add    $0x10,%rsp
+  80604e:	5b                   	pop    %rbx
+  80604f:	41 5f                	pop    %r15
+  806051:	5d                   	pop    %rbp
+  806052:	c3                   	ret
+
+0000000000806053 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  806053:	55                   	push   %rbp
+  806054:	48 89 e5             	mov    %rsp,%rbp
+  806057:	41 57                	push   %r15
+  806059:	53                   	push   %rbx
+  80605a:	48 83 ec 20          	sub    $0x20,%rsp
+  80605e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80605e <wait+0xb>
+  806065:	49 bb f2 2f 00 00 00 	movabs $0x2ff2,%r11
+  80606c:	00 00 00 
+  80606f:	4c 01 db             	add    %r11,%rbx
+  806072:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  806075:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806079:	75 50                	jne    8060cb <wait+0x78>
+  80607b:	48 b8 f8 e5 ff ff ff 	movabs $0xffffffffffffe5f8,%rax
+  806082:	ff ff ff 
+  806085:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806089:	48 89 c1             	mov    %rax,%rcx
+  80608c:	48 b8 03 e6 ff ff ff 	movabs $0xffffffffffffe603,%rax
+  806093:	ff ff ff 
+  806096:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80609a:	48 89 c2             	mov    %rax,%rdx
+  80609d:	be 09 00 00 00       	mov    $0x9,%esi
+  8060a2:	48 b8 18 e6 ff ff ff 	movabs $0xffffffffffffe618,%rax
+  8060a9:	ff ff ff 
+  8060ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060b0:	48 89 c7             	mov    %rax,%rdi
+  8060b3:	49 89 df             	mov    %rbx,%r15
+  8060b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060bb:	49 b8 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%r8
+  8060c2:	ff ff ff 
+  8060c5:	49 01 d8             	add    %rbx,%r8
+  8060c8:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  8060cb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8060ce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8060d3:	48 98                	cltq
+  8060d5:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8060dc:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8060e3:	ff ff ff 
+  8060e6:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8060ea:	48 01 d0             	add    %rdx,%rax
+  8060ed:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8060f1:	eb 12                	jmp    806105 <wait+0xb2>
+		sys_yield();
+  8060f3:	49 89 df             	mov    %rbx,%r15
+  8060f6:	48 b8 4b 91 ff ff ff 	movabs $0xffffffffffff914b,%rax
+  8060fd:	ff ff ff 
+  806100:	48 01 d8             	add    %rbx,%rax
+  806103:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  806105:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806109:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80610f:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  806112:	75 0e                	jne    806122 <wait+0xcf>
+  806114:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806118:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  80611e:	85 c0                	test   %eax,%eax
+  806120:	75 d1                	jne    8060f3 <wait+0xa0>
+}
+  806122:	90                   	nop
+  806123:	48 83 c4 20          	add    $0x20,%rsp
+  806127:	5b                   	pop    %rbx
+  806128:	41 5f                	pop    %r15
+  80612a:	5d                   	pop    %rbp
+  80612b:	c3                   	ret
+
+000000000080612c <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80612c:	55                   	push   %rbp
+  80612d:	48 89 e5             	mov    %rsp,%rbp
+  806130:	41 57                	push   %r15
+  806132:	48 83 ec 28          	sub    $0x28,%rsp
+  806136:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806136 <cputchar+0xa>
+  80613d:	49 bb 1a 2f 00 00 00 	movabs $0x2f1a,%r11
+  806144:	00 00 00 
+  806147:	4c 01 d8             	add    %r11,%rax
+  80614a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80614d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806150:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806153:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806157:	be 01 00 00 00       	mov    $0x1,%esi
+  80615c:	48 89 d7             	mov    %rdx,%rdi
+  80615f:	49 89 c7             	mov    %rax,%r15
+  806162:	48 ba e8 8f ff ff ff 	movabs $0xffffffffffff8fe8,%rdx
+  806169:	ff ff ff 
+  80616c:	48 01 c2             	add    %rax,%rdx
+  80616f:	ff d2                	call   *%rdx
+}
+  806171:	90                   	nop
+  806172:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806176:	c9                   	leave
+  806177:	c3                   	ret
+
+0000000000806178 <getchar>:
+
+int
+getchar(void)
+{
+  806178:	55                   	push   %rbp
+  806179:	48 89 e5             	mov    %rsp,%rbp
+  80617c:	41 57                	push   %r15
+  80617e:	48 83 ec 18          	sub    $0x18,%rsp
+  806182:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806182 <getchar+0xa>
+  806189:	49 bb ce 2e 00 00 00 	movabs $0x2ece,%r11
+  806190:	00 00 00 
+  806193:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806196:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80619a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80619f:	48 89 ce             	mov    %rcx,%rsi
+  8061a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061a7:	49 89 c7             	mov    %rax,%r15
+  8061aa:	48 b9 4c ab ff ff ff 	movabs $0xffffffffffffab4c,%rcx
+  8061b1:	ff ff ff 
+  8061b4:	48 01 c1             	add    %rax,%rcx
+  8061b7:	ff d1                	call   *%rcx
+  8061b9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8061bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061c0:	79 05                	jns    8061c7 <getchar+0x4f>
+		return r;
+  8061c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061c5:	eb 14                	jmp    8061db <getchar+0x63>
+	if (r < 1)
+  8061c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061cb:	7f 07                	jg     8061d4 <getchar+0x5c>
+		return -E_EOF;
+  8061cd:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8061d2:	eb 07                	jmp    8061db <getchar+0x63>
+	return c;
+  8061d4:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8061d8:	0f b6 c0             	movzbl %al,%eax
+}
+  8061db:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8061df:	c9                   	leave
+  8061e0:	c3                   	ret
+
+00000000008061e1 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8061e1:	55                   	push   %rbp
+  8061e2:	48 89 e5             	mov    %rsp,%rbp
+  8061e5:	41 57                	push   %r15
+  8061e7:	53                   	push   %rbx
+  8061e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8061ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061ec <iscons+0xb>
+  8061f3:	49 bb 64 2e 00 00 00 	movabs $0x2e64,%r11
+  8061fa:	00 00 00 
+  8061fd:	4c 01 db             	add    %r11,%rbx
+  806200:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806203:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806207:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80620a:	48 89 d6             	mov    %rdx,%rsi
+  80620d:	89 c7                	mov    %eax,%edi
+  80620f:	49 89 df             	mov    %rbx,%r15
+  806212:	48 b8 05 a6 ff ff ff 	movabs $0xffffffffffffa605,%rax
+  806219:	ff ff ff 
+  80621c:	48 01 d8             	add    %rbx,%rax
+  80621f:	ff d0                	call   *%rax
+  806221:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806224:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806228:	79 05                	jns    80622f <iscons+0x4e>
+		return r;
+  80622a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80622d:	eb 1b                	jmp    80624a <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80622f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806233:	8b 10                	mov    (%rax),%edx
+  806235:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  80623c:	00 00 00 
+  80623f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806242:	39 c2                	cmp    %eax,%edx
+  806244:	0f 94 c0             	sete   %al
+  806247:	0f b6 c0             	movzbl %al,%eax
+}
+  80624a:	48 83 c4 20          	add    $0x20,%rsp
+  80624e:	5b                   	pop    %rbx
+  80624f:	41 5f                	pop    %r15
+  806251:	5d                   	pop    %rbp
+  806252:	c3                   	ret
+
+0000000000806253 <opencons>:
+
+int
+opencons(void)
+{
+  806253:	55                   	push   %rbp
+  806254:	48 89 e5             	mov    %rsp,%rbp
+  806257:	41 57                	push   %r15
+  806259:	53                   	push   %rbx
+  80625a:	48 83 ec 10          	sub    $0x10,%rsp
+  80625e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80625e <opencons+0xb>
+  806265:	49 bb f2 2d 00 00 00 	movabs $0x2df2,%r11
+  80626c:	00 00 00 
+  80626f:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806272:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806276:	48 89 c7             	mov    %rax,%rdi
+  806279:	49 89 df             	mov    %rbx,%r15
+  80627c:	48 b8 4f a5 ff ff ff 	movabs $0xffffffffffffa54f,%rax
+  806283:	ff ff ff 
+  806286:	48 01 d8             	add    %rbx,%rax
+  806289:	ff d0                	call   *%rax
+  80628b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80628e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806292:	79 05                	jns    806299 <opencons+0x46>
+		return r;
+  806294:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806297:	eb 68                	jmp    806301 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806299:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80629d:	ba 07 04 00 00       	mov    $0x407,%edx
+  8062a2:	48 89 c6             	mov    %rax,%rsi
+  8062a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8062aa:	49 89 df             	mov    %rbx,%r15
+  8062ad:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  8062b4:	ff ff ff 
+  8062b7:	48 01 d8             	add    %rbx,%rax
+  8062ba:	ff d0                	call   *%rax
+  8062bc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062bf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062c3:	79 05                	jns    8062ca <opencons+0x77>
+		return r;
+  8062c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062c8:	eb 37                	jmp    806301 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8062ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062ce:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  8062d5:	00 00 00 
+  8062d8:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8062db:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8062dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062e1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8062e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062ec:	48 89 c7             	mov    %rax,%rdi
+  8062ef:	49 89 df             	mov    %rbx,%r15
+  8062f2:	48 b8 d5 a4 ff ff ff 	movabs $0xffffffffffffa4d5,%rax
+  8062f9:	ff ff ff 
+  8062fc:	48 01 d8             	add    %rbx,%rax
+  8062ff:	ff d0                	call   *%rax
+}
+  806301:	48 83 c4 10          	add    $0x10,%rsp
+  806305:	5b                   	pop    %rbx
+  806306:	41 5f                	pop    %r15
+  806308:	5d                   	pop    %rbp
+  806309:	c3                   	ret
+
+000000000080630a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80630a:	55                   	push   %rbp
+  80630b:	48 89 e5             	mov    %rsp,%rbp
+  80630e:	41 57                	push   %r15
+  806310:	53                   	push   %rbx
+  806311:	48 83 ec 30          	sub    $0x30,%rsp
+  806315:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806315 <devcons_read+0xb>
+  80631c:	49 bb 3b 2d 00 00 00 	movabs $0x2d3b,%r11
+  806323:	00 00 00 
+  806326:	4c 01 db             	add    %r11,%rbx
+  806329:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80632d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806331:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806335:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80633a:	75 19                	jne    806355 <devcons_read+0x4b>
+		return 0;
+  80633c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806341:	eb 55                	jmp    806398 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806343:	49 89 df             	mov    %rbx,%r15
+  806346:	48 b8 4b 91 ff ff ff 	movabs $0xffffffffffff914b,%rax
+  80634d:	ff ff ff 
+  806350:	48 01 d8             	add    %rbx,%rax
+  806353:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806355:	49 89 df             	mov    %rbx,%r15
+  806358:	48 b8 47 90 ff ff ff 	movabs $0xffffffffffff9047,%rax
+  80635f:	ff ff ff 
+  806362:	48 01 d8             	add    %rbx,%rax
+  806365:	ff d0                	call   *%rax
+  806367:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80636a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80636e:	74 d3                	je     806343 <devcons_read+0x39>
+	if (c < 0)
+  806370:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806374:	79 05                	jns    80637b <devcons_read+0x71>
+		return c;
+  806376:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806379:	eb 1d                	jmp    806398 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  80637b:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80637f:	75 07                	jne    806388 <devcons_read+0x7e>
+		return 0;
+  806381:	b8 00 00 00 00       	mov    $0x0,%eax
+  806386:	eb 10                	jmp    806398 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806388:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80638b:	89 c2                	mov    %eax,%edx
+  80638d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806391:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806393:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806398:	48 83 c4 30          	add    $0x30,%rsp
+  80639c:	5b                   	pop    %rbx
+  80639d:	41 5f                	pop    %r15
+  80639f:	5d                   	pop    %rbp
+  8063a0:	c3                   	ret
+
+00000000008063a1 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8063a1:	55                   	push   %rbp
+  8063a2:	48 89 e5             	mov    %rsp,%rbp
+  8063a5:	41 57                	push   %r15
+  8063a7:	53                   	push   %rbx
+  8063a8:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8063af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063af <devcons_write+0xe>
+  8063b6:	49 bb a1 2c 00 00 00 	movabs $0x2ca1,%r11
+  8063bd:	00 00 00 
+  8063c0:	4c 01 db             	add    %r11,%rbx
+  8063c3:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8063ca:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8063d1:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8063d8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8063df:	e9 80 00 00 00       	jmp    806464 <devcons_write+0xc3>
+		m = n - tot;
+  8063e4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8063eb:	89 c2                	mov    %eax,%edx
+  8063ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063f0:	29 c2                	sub    %eax,%edx
+  8063f2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8063f5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8063f8:	83 f8 7f             	cmp    $0x7f,%eax
+  8063fb:	76 07                	jbe    806404 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8063fd:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806404:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806407:	48 63 d0             	movslq %eax,%rdx
+  80640a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80640d:	48 63 c8             	movslq %eax,%rcx
+  806410:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806417:	48 01 c1             	add    %rax,%rcx
+  80641a:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806421:	48 89 ce             	mov    %rcx,%rsi
+  806424:	48 89 c7             	mov    %rax,%rdi
+  806427:	49 89 df             	mov    %rbx,%r15
+  80642a:	48 b8 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rax
+  806431:	ff ff ff 
+  806434:	48 01 d8             	add    %rbx,%rax
+  806437:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806439:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80643c:	48 63 d0             	movslq %eax,%rdx
+  80643f:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806446:	48 89 d6             	mov    %rdx,%rsi
+  806449:	48 89 c7             	mov    %rax,%rdi
+  80644c:	49 89 df             	mov    %rbx,%r15
+  80644f:	48 b8 e8 8f ff ff ff 	movabs $0xffffffffffff8fe8,%rax
+  806456:	ff ff ff 
+  806459:	48 01 d8             	add    %rbx,%rax
+  80645c:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80645e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806461:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806464:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806467:	48 98                	cltq
+  806469:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806470:	0f 82 6e ff ff ff    	jb     8063e4 <devcons_write+0x43>
+	}
+	return tot;
+  806476:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806479:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806480:	5b                   	pop    %rbx
+  806481:	41 5f                	pop    %r15
+  806483:	5d                   	pop    %rbp
+  806484:	c3                   	ret
+
+0000000000806485 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806485:	55                   	push   %rbp
+  806486:	48 89 e5             	mov    %rsp,%rbp
+  806489:	48 83 ec 08          	sub    $0x8,%rsp
+  80648d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80648d <devcons_close+0x8>
+  806494:	49 bb c3 2b 00 00 00 	movabs $0x2bc3,%r11
+  80649b:	00 00 00 
+  80649e:	4c 01 d8             	add    %r11,%rax
+  8064a1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8064a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8064aa:	c9                   	leave
+  8064ab:	c3                   	ret
+
+00000000008064ac <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8064ac:	55                   	push   %rbp
+  8064ad:	48 89 e5             	mov    %rsp,%rbp
+  8064b0:	41 57                	push   %r15
+  8064b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8064b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064b6 <devcons_stat+0xa>
+  8064bd:	49 bb 9a 2b 00 00 00 	movabs $0x2b9a,%r11
+  8064c4:	00 00 00 
+  8064c7:	4c 01 d8             	add    %r11,%rax
+  8064ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8064ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8064d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8064d6:	48 b9 28 e6 ff ff ff 	movabs $0xffffffffffffe628,%rcx
+  8064dd:	ff ff ff 
+  8064e0:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8064e4:	48 89 ce             	mov    %rcx,%rsi
+  8064e7:	48 89 d7             	mov    %rdx,%rdi
+  8064ea:	49 89 c7             	mov    %rax,%r15
+  8064ed:	48 ba e4 84 ff ff ff 	movabs $0xffffffffffff84e4,%rdx
+  8064f4:	ff ff ff 
+  8064f7:	48 01 c2             	add    %rax,%rdx
+  8064fa:	ff d2                	call   *%rdx
+	return 0;
+  8064fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806501:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806505:	c9                   	leave
+  806506:	c3                   	ret
+
+0000000000806507 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806507:	55                   	push   %rbp
+  806508:	48 89 e5             	mov    %rsp,%rbp
+  80650b:	41 57                	push   %r15
+  80650d:	53                   	push   %rbx
+  80650e:	48 83 ec 20          	sub    $0x20,%rsp
+  806512:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806512 <set_pgfault_handler+0xb>
+  806519:	49 bb 3e 2b 00 00 00 	movabs $0x2b3e,%r11
+  806520:	00 00 00 
+  806523:	4c 01 db             	add    %r11,%rbx
+  806526:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  80652a:	49 89 df             	mov    %rbx,%r15
+  80652d:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  806534:	ff ff ff 
+  806537:	48 01 d8             	add    %rbx,%rax
+  80653a:	ff d0                	call   *%rax
+  80653c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  80653f:	48 b8 b0 5f 01 00 00 	movabs $0x15fb0,%rax
+  806546:	00 00 00 
+  806549:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80654d:	48 85 c0             	test   %rax,%rax
+  806550:	75 6b                	jne    8065bd <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806552:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806555:	ba 07 00 00 00       	mov    $0x7,%edx
+  80655a:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80655f:	48 89 ce             	mov    %rcx,%rsi
+  806562:	89 c7                	mov    %eax,%edi
+  806564:	49 89 df             	mov    %rbx,%r15
+  806567:	48 b8 a0 91 ff ff ff 	movabs $0xffffffffffff91a0,%rax
+  80656e:	ff ff ff 
+  806571:	48 01 d8             	add    %rbx,%rax
+  806574:	ff d0                	call   *%rax
+  806576:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806579:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80657d:	74 3e                	je     8065bd <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  80657f:	48 b8 30 e6 ff ff ff 	movabs $0xffffffffffffe630,%rax
+  806586:	ff ff ff 
+  806589:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80658d:	48 89 c2             	mov    %rax,%rdx
+  806590:	be 23 00 00 00       	mov    $0x23,%esi
+  806595:	48 b8 5e e6 ff ff ff 	movabs $0xffffffffffffe65e,%rax
+  80659c:	ff ff ff 
+  80659f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8065a3:	48 89 c7             	mov    %rax,%rdi
+  8065a6:	49 89 df             	mov    %rbx,%r15
+  8065a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065ae:	48 b9 4b 74 ff ff ff 	movabs $0xffffffffffff744b,%rcx
+  8065b5:	ff ff ff 
+  8065b8:	48 01 d9             	add    %rbx,%rcx
+  8065bb:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8065bd:	48 ba b0 5f 01 00 00 	movabs $0x15fb0,%rdx
+  8065c4:	00 00 00 
+  8065c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065cb:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  8065cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065d2:	48 ba b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rdx
+  8065d9:	ff ff ff 
+  8065dc:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8065e0:	48 89 d6             	mov    %rdx,%rsi
+  8065e3:	89 c7                	mov    %eax,%edi
+  8065e5:	49 89 df             	mov    %rbx,%r15
+  8065e8:	48 b8 96 93 ff ff ff 	movabs $0xffffffffffff9396,%rax
+  8065ef:	ff ff ff 
+  8065f2:	48 01 d8             	add    %rbx,%rax
+  8065f5:	ff d0                	call   *%rax
+}
+  8065f7:	90                   	nop
+  8065f8:	48 83 c4 20          	add    $0x20,%rsp
+  8065fc:	5b                   	pop    %rbx
+  8065fd:	41 5f                	pop    %r15
+  8065ff:	5d                   	pop    %rbp
+  806600:	c3                   	ret
+
+0000000000806601 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806601:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806604:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  80660b:	00 00 00 
+call *%rax
+  80660e:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806610:	58                   	pop    %rax
+	popq %rax;
+  806611:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806612:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806619:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  80661d:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806621:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806625:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806629:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  80662d:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806630:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806634:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806638:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80663d:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806642:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806647:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80664c:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806651:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806656:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80665b:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806660:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806665:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80666a:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80666f:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806674:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806679:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80667e:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806682:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806686:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806687:	5c                   	pop    %rsp
+	ret;			//return
+  806688:	c3                   	ret
+
+0000000000806689 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806689:	55                   	push   %rbp
+  80668a:	48 89 e5             	mov    %rsp,%rbp
+  80668d:	41 57                	push   %r15
+  80668f:	53                   	push   %rbx
+  806690:	48 83 ec 30          	sub    $0x30,%rsp
+  806694:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806694 <ipc_recv+0xb>
+  80669b:	49 bb bc 29 00 00 00 	movabs $0x29bc,%r11
+  8066a2:	00 00 00 
+  8066a5:	4c 01 db             	add    %r11,%rbx
+  8066a8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8066ac:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8066b0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8066b4:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8066b9:	75 0e                	jne    8066c9 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8066bb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8066c2:	00 00 00 
+  8066c5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8066c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8066cd:	48 89 c7             	mov    %rax,%rdi
+  8066d0:	49 89 df             	mov    %rbx,%r15
+  8066d3:	48 b8 c9 94 ff ff ff 	movabs $0xffffffffffff94c9,%rax
+  8066da:	ff ff ff 
+  8066dd:	48 01 d8             	add    %rbx,%rax
+  8066e0:	ff d0                	call   *%rax
+  8066e2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8066e5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8066ea:	74 2a                	je     806716 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8066ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066f0:	75 19                	jne    80670b <ipc_recv+0x82>
+  8066f2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8066f9:	ff ff ff 
+  8066fc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806700:	48 8b 00             	mov    (%rax),%rax
+  806703:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806709:	eb 05                	jmp    806710 <ipc_recv+0x87>
+  80670b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806710:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806714:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806716:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80671b:	74 2a                	je     806747 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  80671d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806721:	75 19                	jne    80673c <ipc_recv+0xb3>
+  806723:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80672a:	ff ff ff 
+  80672d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806731:	48 8b 00             	mov    (%rax),%rax
+  806734:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80673a:	eb 05                	jmp    806741 <ipc_recv+0xb8>
+  80673c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806741:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806745:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806747:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80674b:	74 05                	je     806752 <ipc_recv+0xc9>
+		return res;
+  80674d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806750:	eb 17                	jmp    806769 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806752:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806759:	ff ff ff 
+  80675c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806760:	48 8b 00             	mov    (%rax),%rax
+  806763:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806769:	48 83 c4 30          	add    $0x30,%rsp
+  80676d:	5b                   	pop    %rbx
+  80676e:	41 5f                	pop    %r15
+  806770:	5d                   	pop    %rbp
+  806771:	c3                   	ret
+
+0000000000806772 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806772:	55                   	push   %rbp
+  806773:	48 89 e5             	mov    %rsp,%rbp
+  806776:	41 57                	push   %r15
+  806778:	53                   	push   %rbx
+  806779:	48 83 ec 20          	sub    $0x20,%rsp
+  80677d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80677d <ipc_send+0xb>
+  806784:	49 bb d3 28 00 00 00 	movabs $0x28d3,%r11
+  80678b:	00 00 00 
+  80678e:	4c 01 db             	add    %r11,%rbx
+  806791:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806794:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806797:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80679b:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  80679e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8067a3:	75 0e                	jne    8067b3 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8067a5:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8067ac:	00 00 00 
+  8067af:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8067b3:	90                   	nop
+  8067b4:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8067b7:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8067ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8067be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067c1:	89 c7                	mov    %eax,%edi
+  8067c3:	49 89 df             	mov    %rbx,%r15
+  8067c6:	48 b8 5f 94 ff ff ff 	movabs $0xffffffffffff945f,%rax
+  8067cd:	ff ff ff 
+  8067d0:	48 01 d8             	add    %rbx,%rax
+  8067d3:	ff d0                	call   *%rax
+  8067d5:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8067d8:	74 da                	je     8067b4 <ipc_send+0x42>
+		;
+}
+  8067da:	90                   	nop
+  8067db:	90                   	nop
+  8067dc:	48 83 c4 20          	add    $0x20,%rsp
+  8067e0:	5b                   	pop    %rbx
+  8067e1:	41 5f                	pop    %r15
+  8067e3:	5d                   	pop    %rbp
+  8067e4:	c3                   	ret
+
+00000000008067e5 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8067e5:	55                   	push   %rbp
+  8067e6:	48 89 e5             	mov    %rsp,%rbp
+  8067e9:	41 57                	push   %r15
+  8067eb:	53                   	push   %rbx
+  8067ec:	48 83 ec 40          	sub    $0x40,%rsp
+  8067f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067f0 <ipc_call+0xb>
+  8067f7:	49 bb 60 28 00 00 00 	movabs $0x2860,%r11
+  8067fe:	00 00 00 
+  806801:	4c 01 db             	add    %r11,%rbx
+  806804:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806807:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80680a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80680e:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806811:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806815:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806819:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80681e:	75 0e                	jne    80682e <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806820:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806827:	00 00 00 
+  80682a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80682e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806833:	75 0e                	jne    806843 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806835:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80683c:	00 00 00 
+  80683f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806843:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806846:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80684a:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80684d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806851:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806854:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80685a:	49 89 f8             	mov    %rdi,%r8
+  80685d:	89 c7                	mov    %eax,%edi
+  80685f:	49 89 df             	mov    %rbx,%r15
+  806862:	48 b8 22 95 ff ff ff 	movabs $0xffffffffffff9522,%rax
+  806869:	ff ff ff 
+  80686c:	48 01 d8             	add    %rbx,%rax
+  80686f:	ff d0                	call   *%rax
+  806871:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806874:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806879:	74 2a                	je     8068a5 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80687b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80687f:	75 19                	jne    80689a <ipc_call+0xb5>
+  806881:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806888:	ff ff ff 
+  80688b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80688f:	48 8b 00             	mov    (%rax),%rax
+  806892:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806898:	eb 05                	jmp    80689f <ipc_call+0xba>
+  80689a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80689f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8068a3:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8068a5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068a9:	74 05                	je     8068b0 <ipc_call+0xcb>
+		return r;
+  8068ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068ae:	eb 17                	jmp    8068c7 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8068b0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068b7:	ff ff ff 
+  8068ba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068be:	48 8b 00             	mov    (%rax),%rax
+  8068c1:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8068c7:	48 83 c4 40          	add    $0x40,%rsp
+  8068cb:	5b                   	pop    %rbx
+  8068cc:	41 5f                	pop    %r15
+  8068ce:	5d                   	pop    %rbp
+  8068cf:	c3                   	ret
+
+00000000008068d0 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8068d0:	55                   	push   %rbp
+  8068d1:	48 89 e5             	mov    %rsp,%rbp
+  8068d4:	41 57                	push   %r15
+  8068d6:	53                   	push   %rbx
+  8068d7:	48 83 ec 70          	sub    $0x70,%rsp
+  8068db:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068db <ipc_callw+0xb>
+  8068e2:	49 bb 75 27 00 00 00 	movabs $0x2775,%r11
+  8068e9:	00 00 00 
+  8068ec:	4c 01 db             	add    %r11,%rbx
+  8068ef:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8068f2:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8068f5:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8068f9:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8068fd:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806902:	76 0a                	jbe    80690e <ipc_callw+0x3e>
+		return -E_INVAL;
+  806904:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806909:	e9 b7 00 00 00       	jmp    8069c5 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  80690e:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806912:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806916:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80691a:	48 89 ce             	mov    %rcx,%rsi
+  80691d:	48 89 c7             	mov    %rax,%rdi
+  806920:	49 89 df             	mov    %rbx,%r15
+  806923:	48 b8 c4 88 ff ff ff 	movabs $0xffffffffffff88c4,%rax
+  80692a:	ff ff ff 
+  80692d:	48 01 d8             	add    %rbx,%rax
+  806930:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806932:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806939:	00 
+  80693a:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80693e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806942:	48 01 d0             	add    %rdx,%rax
+  806945:	48 83 e8 01          	sub    $0x1,%rax
+  806949:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80694d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806951:	ba 00 00 00 00       	mov    $0x0,%edx
+  806956:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80695a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80695e:	48 29 d0             	sub    %rdx,%rax
+  806961:	48 c1 e8 03          	shr    $0x3,%rax
+  806965:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806969:	89 c1                	mov    %eax,%ecx
+  80696b:	8b 75 98             	mov    -0x68(%rbp),%esi
+  80696e:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806972:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806975:	49 89 d1             	mov    %rdx,%r9
+  806978:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  80697f:	00 00 00 
+  806982:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806989:	00 00 00 
+  80698c:	89 c7                	mov    %eax,%edi
+  80698e:	49 89 df             	mov    %rbx,%r15
+  806991:	48 b8 22 95 ff ff ff 	movabs $0xffffffffffff9522,%rax
+  806998:	ff ff ff 
+  80699b:	48 01 d8             	add    %rbx,%rax
+  80699e:	ff d0                	call   *%rax
+  8069a0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8069a3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8069a7:	74 05                	je     8069ae <ipc_callw+0xde>
+		return r;
+  8069a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8069ac:	eb 17                	jmp    8069c5 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8069ae:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8069b5:	ff ff ff 
+  8069b8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8069bc:	48 8b 00             	mov    (%rax),%rax
+  8069bf:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8069c5:	48 83 c4 70          	add    $0x70,%rsp
+  8069c9:	5b                   	pop    %rbx
+  8069ca:	41 5f                	pop    %r15
+  8069cc:	5d                   	pop    %rbp
+  8069cd:	c3                   	ret
+
+00000000008069ce <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8069ce:	55                   	push   %rbp
+  8069cf:	48 89 e5             	mov    %rsp,%rbp
+  8069d2:	41 57                	push   %r15
+  8069d4:	53                   	push   %rbx
+  8069d5:	48 83 ec 40          	sub    $0x40,%rsp
+  8069d9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069d9 <ipc_callv+0xb>
+  8069e0:	49 bb 77 26 00 00 00 	movabs $0x2677,%r11
+  8069e7:	00 00 00 
+  8069ea:	4c 01 db             	add    %r11,%rbx
+  8069ed:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8069f0:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8069f3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8069f7:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8069fa:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8069fe:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806a02:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806a09:	00 00 00 
+  806a0c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806a10:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806a14:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806a18:	74 11                	je     806a2b <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806a1a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806a1e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806a22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806a25:	c1 e0 14             	shl    $0x14,%eax
+  806a28:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806a2b:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806a2f:	74 14                	je     806a45 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806a31:	8b 45 20             	mov    0x20(%rbp),%eax
+  806a34:	83 e8 01             	sub    $0x1,%eax
+  806a37:	48 63 d0             	movslq %eax,%rdx
+  806a3a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806a3e:	48 09 d0             	or     %rdx,%rax
+  806a41:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806a45:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806a48:	c1 e0 10             	shl    $0x10,%eax
+  806a4b:	0b 45 10             	or     0x10(%rbp),%eax
+  806a4e:	89 c1                	mov    %eax,%ecx
+  806a50:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806a53:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806a57:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806a5b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806a5f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806a62:	4d 89 c1             	mov    %r8,%r9
+  806a65:	49 89 f8             	mov    %rdi,%r8
+  806a68:	89 c7                	mov    %eax,%edi
+  806a6a:	49 89 df             	mov    %rbx,%r15
+  806a6d:	48 b8 22 95 ff ff ff 	movabs $0xffffffffffff9522,%rax
+  806a74:	ff ff ff 
+  806a77:	48 01 d8             	add    %rbx,%rax
+  806a7a:	ff d0                	call   *%rax
+  806a7c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806a7f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806a83:	74 05                	je     806a8a <ipc_callv+0xbc>
+		return r;
+  806a85:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a88:	eb 17                	jmp    806aa1 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806a8a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a91:	ff ff ff 
+  806a94:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a98:	48 8b 00             	mov    (%rax),%rax
+  806a9b:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806aa1:	48 83 c4 40          	add    $0x40,%rsp
+  806aa5:	5b                   	pop    %rbx
+  806aa6:	41 5f                	pop    %r15
+  806aa8:	5d                   	pop    %rbp
+  806aa9:	c3                   	ret
+
+0000000000806aaa <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806aaa:	55                   	push   %rbp
+  806aab:	48 89 e5             	mov    %rsp,%rbp
+  806aae:	41 57                	push   %r15
+  806ab0:	53                   	push   %rbx
+  806ab1:	48 83 ec 40          	sub    $0x40,%rsp
+  806ab5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ab5 <ipc_reply_recv+0xb>
+  806abc:	49 bb 9b 25 00 00 00 	movabs $0x259b,%r11
+  806ac3:	00 00 00 
+  806ac6:	4c 01 db             	add    %r11,%rbx
+  806ac9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806acc:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806acf:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806ad3:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806ad6:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806ada:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806ade:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806ae3:	75 0e                	jne    806af3 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806ae5:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806aec:	00 00 00 
+  806aef:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806af3:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806af8:	75 0e                	jne    806b08 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806afa:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806b01:	00 00 00 
+  806b04:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806b08:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806b0b:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806b0f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806b13:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806b16:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806b1a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b1d:	4d 89 c1             	mov    %r8,%r9
+  806b20:	49 89 f8             	mov    %rdi,%r8
+  806b23:	89 c7                	mov    %eax,%edi
+  806b25:	49 89 df             	mov    %rbx,%r15
+  806b28:	48 b8 96 95 ff ff ff 	movabs $0xffffffffffff9596,%rax
+  806b2f:	ff ff ff 
+  806b32:	48 01 d8             	add    %rbx,%rax
+  806b35:	ff d0                	call   *%rax
+  806b37:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806b3a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806b3f:	74 2a                	je     806b6b <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806b41:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b45:	75 19                	jne    806b60 <ipc_reply_recv+0xb6>
+  806b47:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b4e:	ff ff ff 
+  806b51:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b55:	48 8b 00             	mov    (%rax),%rax
+  806b58:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806b5e:	eb 05                	jmp    806b65 <ipc_reply_recv+0xbb>
+  806b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806b69:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806b6b:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806b70:	74 2a                	je     806b9c <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806b72:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b76:	75 19                	jne    806b91 <ipc_reply_recv+0xe7>
+  806b78:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b7f:	ff ff ff 
+  806b82:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b86:	48 8b 00             	mov    (%rax),%rax
+  806b89:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806b8f:	eb 05                	jmp    806b96 <ipc_reply_recv+0xec>
+  806b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b96:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806b9a:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806b9c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ba0:	74 05                	je     806ba7 <ipc_reply_recv+0xfd>
+		return r;
+  806ba2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ba5:	eb 17                	jmp    806bbe <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806ba7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806bae:	ff ff ff 
+  806bb1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806bb5:	48 8b 00             	mov    (%rax),%rax
+  806bb8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806bbe:	48 83 c4 40          	add    $0x40,%rsp
+  806bc2:	5b                   	pop    %rbx
+  806bc3:	41 5f                	pop    %r15
+  806bc5:	5d                   	pop    %rbp
+  806bc6:	c3                   	ret
+
+0000000000806bc7 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806bc7:	55                   	push   %rbp
+  806bc8:	48 89 e5             	mov    %rsp,%rbp
+  806bcb:	41 57                	push   %r15
+  806bcd:	53                   	push   %rbx
+  806bce:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806bd5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806bd5 <ipc_window_batch+0xe>
+  806bdc:	49 bb 7b 24 00 00 00 	movabs $0x247b,%r11
+  806be3:	00 00 00 
+  806be6:	4c 01 db             	add    %r11,%rbx
+  806be9:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806bef:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806bf6:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806bfc:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806c02:	e9 15 01 00 00       	jmp    806d1c <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806c07:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806c0d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806c10:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806c17:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806c1a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806c1d:	39 c2                	cmp    %eax,%edx
+  806c1f:	0f 4e c2             	cmovle %edx,%eax
+  806c22:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806c25:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806c2c:	eb 6b                	jmp    806c99 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806c2e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c31:	48 98                	cltq
+  806c33:	48 c1 e0 05          	shl    $0x5,%rax
+  806c37:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806c3b:	48 01 e8             	add    %rbp,%rax
+  806c3e:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806c44:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806c4a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c4d:	c1 e0 0c             	shl    $0xc,%eax
+  806c50:	48 63 d0             	movslq %eax,%rdx
+  806c53:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806c5a:	48 01 c2             	add    %rax,%rdx
+  806c5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c60:	48 98                	cltq
+  806c62:	48 c1 e0 05          	shl    $0x5,%rax
+  806c66:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806c6a:	48 01 e8             	add    %rbp,%rax
+  806c6d:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806c73:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806c76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c79:	48 98                	cltq
+  806c7b:	48 c1 e0 05          	shl    $0x5,%rax
+  806c7f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806c83:	48 01 e8             	add    %rbp,%rax
+  806c86:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806c8d:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806c93:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806c95:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806c99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c9c:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806c9f:	7c 8d                	jl     806c2e <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806ca1:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806ca8:	74 27                	je     806cd1 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806caa:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806cad:	48 63 d0             	movslq %eax,%rdx
+  806cb0:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806cb7:	48 89 d6             	mov    %rdx,%rsi
+  806cba:	48 89 c7             	mov    %rax,%rdi
+  806cbd:	49 89 df             	mov    %rbx,%r15
+  806cc0:	48 b8 39 98 ff ff ff 	movabs $0xffffffffffff9839,%rax
+  806cc7:	ff ff ff 
+  806cca:	48 01 d8             	add    %rbx,%rax
+  806ccd:	ff d0                	call   *%rax
+  806ccf:	eb 25                	jmp    806cf6 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806cd1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806cd4:	48 63 d0             	movslq %eax,%rdx
+  806cd7:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806cde:	48 89 d6             	mov    %rdx,%rsi
+  806ce1:	48 89 c7             	mov    %rax,%rdi
+  806ce4:	49 89 df             	mov    %rbx,%r15
+  806ce7:	48 b8 97 98 ff ff ff 	movabs $0xffffffffffff9897,%rax
+  806cee:	ff ff ff 
+  806cf1:	48 01 d8             	add    %rbx,%rax
+  806cf4:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806cf6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806cf9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806cfd:	79 05                	jns    806d04 <ipc_window_batch+0x13d>
+			return r;
+  806cff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806d02:	eb 2a                	jmp    806d2e <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806d04:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806d07:	c1 e0 0c             	shl    $0xc,%eax
+  806d0a:	48 98                	cltq
+  806d0c:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806d13:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806d16:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806d1c:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806d23:	0f 8f de fe ff ff    	jg     806c07 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806d29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806d2e:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806d35:	5b                   	pop    %rbx
+  806d36:	41 5f                	pop    %r15
+  806d38:	5d                   	pop    %rbp
+  806d39:	c3                   	ret
+
+0000000000806d3a <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806d3a:	55                   	push   %rbp
+  806d3b:	48 89 e5             	mov    %rsp,%rbp
+  806d3e:	48 83 ec 10          	sub    $0x10,%rsp
+  806d42:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d42 <ipc_map_window+0x8>
+  806d49:	49 bb 0e 23 00 00 00 	movabs $0x230e,%r11
+  806d50:	00 00 00 
+  806d53:	4c 01 d8             	add    %r11,%rax
+  806d56:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806d5a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806d5d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806d60:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806d64:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806d69:	bf 01 00 00 00       	mov    $0x1,%edi
+  806d6e:	49 b8 77 db ff ff ff 	movabs $0xffffffffffffdb77,%r8
+  806d75:	ff ff ff 
+  806d78:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806d7c:	ff d0                	call   *%rax
+}
+  806d7e:	c9                   	leave
+  806d7f:	c3                   	ret
+
+0000000000806d80 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806d80:	55                   	push   %rbp
+  806d81:	48 89 e5             	mov    %rsp,%rbp
+  806d84:	48 83 ec 10          	sub    $0x10,%rsp
+  806d88:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d88 <ipc_unmap_window+0x8>
+  806d8f:	49 bb c8 22 00 00 00 	movabs $0x22c8,%r11
+  806d96:	00 00 00 
+  806d99:	4c 01 d8             	add    %r11,%rax
+  806d9c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806da0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806da3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806da6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806daa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806daf:	bf 00 00 00 00       	mov    $0x0,%edi
+  806db4:	49 b8 77 db ff ff ff 	movabs $0xffffffffffffdb77,%r8
+  806dbb:	ff ff ff 
+  806dbe:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806dc2:	ff d0                	call   *%rax
+}
+  806dc4:	c9                   	leave
+  806dc5:	c3                   	ret
+
+0000000000806dc6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806dc6:	55                   	push   %rbp
+  806dc7:	48 89 e5             	mov    %rsp,%rbp
+  806dca:	48 83 ec 18          	sub    $0x18,%rsp
+  806dce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806dce <ipc_find_env+0x8>
+  806dd5:	49 bb 82 22 00 00 00 	movabs $0x2282,%r11
+  806ddc:	00 00 00 
+  806ddf:	4c 01 d8             	add    %r11,%rax
+  806de2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806de5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806dec:	eb 57                	jmp    806e45 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806dee:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806df5:	ff ff ff 
+  806df8:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806dfc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806dff:	48 63 d2             	movslq %edx,%rdx
+  806e02:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806e09:	48 01 ca             	add    %rcx,%rdx
+  806e0c:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806e13:	8b 12                	mov    (%rdx),%edx
+  806e15:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806e18:	75 27                	jne    806e41 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806e1a:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806e21:	ff ff ff 
+  806e24:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806e28:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806e2b:	48 98                	cltq
+  806e2d:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806e34:	48 01 d0             	add    %rdx,%rax
+  806e37:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806e3d:	8b 00                	mov    (%rax),%eax
+  806e3f:	eb 12                	jmp    806e53 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806e41:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806e45:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806e4c:	7e a0                	jle    806dee <ipc_find_env+0x28>
+	}
+	return 0;
+  806e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806e53:	c9                   	leave
+  806e54:	c3                   	ret
+
+0000000000806e55 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806e55:	55                   	push   %rbp
+  806e56:	48 89 e5             	mov    %rsp,%rbp
+  806e59:	48 83 ec 18          	sub    $0x18,%rsp
+  806e5d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e5d <pageref+0x8>
+  806e64:	49 bb f3 21 00 00 00 	movabs $0x21f3,%r11
+  806e6b:	00 00 00 
+  806e6e:	4c 01 d8             	add    %r11,%rax
+  806e71:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806e75:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806e79:	48 89 d1             	mov    %rdx,%rcx
+  806e7c:	48 c1 e9 15          	shr    $0x15,%rcx
+  806e80:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806e87:	ff ff ff 
+  806e8a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806e8e:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806e92:	83 e2 01             	and    $0x1,%edx
+  806e95:	48 85 d2             	test   %rdx,%rdx
+  806e98:	75 07                	jne    806ea1 <pageref+0x4c>
+		return 0;
+  806e9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e9f:	eb 64                	jmp    806f05 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806ea1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806ea5:	48 89 d1             	mov    %rdx,%rcx
+  806ea8:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806eac:	48 ba c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rdx
+  806eb3:	ff ff ff 
+  806eb6:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806eba:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806ebe:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806ec2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806ec6:	83 e2 01             	and    $0x1,%edx
+  806ec9:	48 85 d2             	test   %rdx,%rdx
+  806ecc:	75 07                	jne    806ed5 <pageref+0x80>
+		return 0;
+  806ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ed3:	eb 30                	jmp    806f05 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806ed5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806ed9:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806edd:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806ee4:	ff ff ff 
+  806ee7:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806eeb:	48 89 d0             	mov    %rdx,%rax
+  806eee:	48 01 c0             	add    %rax,%rax
+  806ef1:	48 01 d0             	add    %rdx,%rax
+  806ef4:	48 c1 e0 03          	shl    $0x3,%rax
+  806ef8:	48 01 c8             	add    %rcx,%rax
+  806efb:	48 83 c0 08          	add    $0x8,%rax
+  806eff:	0f b7 00             	movzwl (%rax),%eax
+  806f02:	0f b7 c0             	movzwl %ax,%eax
+}
+  806f05:	c9                   	leave
+  806f06:	c3                   	ret
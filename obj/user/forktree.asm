@@ -0,0 +1,10574 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 c8 01 00 00       	call   800209 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <forkchild>:
+#define DEPTH 3
+void forktree(const char *cur);
+
+void
+forkchild(const char *cur, char branch)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <forkchild+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800066:	89 f0                	mov    %esi,%eax
+  800068:	88 45 d4             	mov    %al,-0x2c(%rbp)
+	char nxt[DEPTH+1];
+
+	if (strlen(cur) >= DEPTH)
+  80006b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80006f:	48 89 c7             	mov    %rax,%rdi
+  800072:	49 89 df             	mov    %rbx,%r15
+  800075:	48 b8 7f 81 ff ff ff 	movabs $0xffffffffffff817f,%rax
+  80007c:	ff ff ff 
+  80007f:	48 01 d8             	add    %rbx,%rax
+  800082:	ff d0                	call   *%rax
+  800084:	83 f8 02             	cmp    $0x2,%eax
+  800087:	0f 8f 81 00 00 00    	jg     80010e <forkchild+0xcb>
+		return;
+
+	snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  80008d:	0f be 4d d4          	movsbl -0x2c(%rbp),%ecx
+  800091:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800095:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+  800099:	41 89 c8             	mov    %ecx,%r8d
+  80009c:	48 89 d1             	mov    %rdx,%rcx
+  80009f:	48 ba 68 dc ff ff ff 	movabs $0xffffffffffffdc68,%rdx
+  8000a6:	ff ff ff 
+  8000a9:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8000ad:	be 04 00 00 00       	mov    $0x4,%esi
+  8000b2:	48 89 c7             	mov    %rax,%rdi
+  8000b5:	49 89 df             	mov    %rbx,%r15
+  8000b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bd:	49 b9 86 80 ff ff ff 	movabs $0xffffffffffff8086,%r9
+  8000c4:	ff ff ff 
+  8000c7:	49 01 d9             	add    %rbx,%r9
+  8000ca:	41 ff d1             	call   *%r9
+	if (fork() == 0) {
+  8000cd:	49 89 df             	mov    %rbx,%r15
+  8000d0:	48 b8 5e 9e ff ff ff 	movabs $0xffffffffffff9e5e,%rax
+  8000d7:	ff ff ff 
+  8000da:	48 01 d8             	add    %rbx,%rax
+  8000dd:	ff d0                	call   *%rax
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	75 2c                	jne    80010f <forkchild+0xcc>
+		forktree(nxt);
+  8000e3:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+  8000e7:	48 89 c7             	mov    %rax,%rdi
+  8000ea:	48 b8 d8 70 ff ff ff 	movabs $0xffffffffffff70d8,%rax
+  8000f1:	ff ff ff 
+  8000f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000f8:	ff d0                	call   *%rax
+		exit();
+  8000fa:	49 89 df             	mov    %rbx,%r15
+  8000fd:	48 b8 89 72 ff ff ff 	movabs $0xffffffffffff7289,%rax
+  800104:	ff ff ff 
+  800107:	48 01 d8             	add    %rbx,%rax
+  80010a:	ff d0                	call   *%rax
+  80010c:	eb 01                	jmp    80010f <forkchild+0xcc>
+		return;
+  80010e:	90                   	nop
+	}
+}
+  80010f:	48 83 c4 20          	add    $0x20,%rsp
+  800113:	5b                   	pop    %rbx
+  800114:	41 5f                	pop    %r15
+  800116:	5d                   	pop    %rbp
+  800117:	c3                   	ret
+
+0000000000800118 <forktree>:
+
+void
+forktree(const char *cur)
+{
+  800118:	55                   	push   %rbp
+  800119:	48 89 e5             	mov    %rsp,%rbp
+  80011c:	41 57                	push   %r15
+  80011e:	53                   	push   %rbx
+  80011f:	48 83 ec 10          	sub    $0x10,%rsp
+  800123:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800123 <forktree+0xb>
+  80012a:	49 bb 1d 8f 00 00 00 	movabs $0x8f1d,%r11
+  800131:	00 00 00 
+  800134:	4c 01 db             	add    %r11,%rbx
+  800137:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80013b:	49 89 df             	mov    %rbx,%r15
+  80013e:	48 b8 26 8e ff ff ff 	movabs $0xffffffffffff8e26,%rax
+  800145:	ff ff ff 
+  800148:	48 01 d8             	add    %rbx,%rax
+  80014b:	ff d0                	call   *%rax
+  80014d:	89 c1                	mov    %eax,%ecx
+  80014f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800153:	48 89 c2             	mov    %rax,%rdx
+  800156:	89 ce                	mov    %ecx,%esi
+  800158:	48 b8 6d dc ff ff ff 	movabs $0xffffffffffffdc6d,%rax
+  80015f:	ff ff ff 
+  800162:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800166:	48 89 c7             	mov    %rax,%rdi
+  800169:	49 89 df             	mov    %rbx,%r15
+  80016c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800171:	48 b9 51 74 ff ff ff 	movabs $0xffffffffffff7451,%rcx
+  800178:	ff ff ff 
+  80017b:	48 01 d9             	add    %rbx,%rcx
+  80017e:	ff d1                	call   *%rcx
+
+	forkchild(cur, '0');
+  800180:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800184:	be 30 00 00 00       	mov    $0x30,%esi
+  800189:	48 89 c7             	mov    %rax,%rdi
+  80018c:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800193:	ff ff ff 
+  800196:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80019a:	ff d0                	call   *%rax
+	forkchild(cur, '1');
+  80019c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8001a0:	be 31 00 00 00       	mov    $0x31,%esi
+  8001a5:	48 89 c7             	mov    %rax,%rdi
+  8001a8:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8001af:	ff ff ff 
+  8001b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001b6:	ff d0                	call   *%rax
+}
+  8001b8:	90                   	nop
+  8001b9:	48 83 c4 10          	add    $0x10,%rsp
+  8001bd:	5b                   	pop    %rbx
+  8001be:	41 5f                	pop    %r15
+  8001c0:	5d                   	pop    %rbp
+  8001c1:	c3                   	ret
+
+00000000008001c2 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001c2:	55                   	push   %rbp
+  8001c3:	48 89 e5             	mov    %rsp,%rbp
+  8001c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8001ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8001ca <umain+0x8>
+  8001d1:	49 bb 76 8e 00 00 00 	movabs $0x8e76,%r11
+  8001d8:	00 00 00 
+  8001db:	4c 01 d8             	add    %r11,%rax
+  8001de:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8001e1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	forktree("");
+  8001e5:	48 ba 7e dc ff ff ff 	movabs $0xffffffffffffdc7e,%rdx
+  8001ec:	ff ff ff 
+  8001ef:	48 8d 14 10          	lea    (%rax,%rdx,1),%rdx
+  8001f3:	48 89 d7             	mov    %rdx,%rdi
+  8001f6:	48 ba d8 70 ff ff ff 	movabs $0xffffffffffff70d8,%rdx
+  8001fd:	ff ff ff 
+  800200:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  800204:	ff d0                	call   *%rax
+}
+  800206:	90                   	nop
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+0000000000800209 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800209:	55                   	push   %rbp
+  80020a:	48 89 e5             	mov    %rsp,%rbp
+  80020d:	41 57                	push   %r15
+  80020f:	53                   	push   %rbx
+  800210:	48 83 ec 20          	sub    $0x20,%rsp
+  800214:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800214 <libmain+0xb>
+  80021b:	49 bb 2c 8e 00 00 00 	movabs $0x8e2c,%r11
+  800222:	00 00 00 
+  800225:	4c 01 db             	add    %r11,%rbx
+  800228:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80022b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80022f:	49 89 df             	mov    %rbx,%r15
+  800232:	48 b8 26 8e ff ff ff 	movabs $0xffffffffffff8e26,%rax
+  800239:	ff ff ff 
+  80023c:	48 01 d8             	add    %rbx,%rax
+  80023f:	ff d0                	call   *%rax
+  800241:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800244:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800247:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80024c:	48 98                	cltq
+  80024e:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800255:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80025c:	ff ff ff 
+  80025f:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800263:	48 01 c2             	add    %rax,%rdx
+  800266:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  80026d:	00 00 00 
+  800270:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800274:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800278:	7e 15                	jle    80028f <libmain+0x86>
+		binaryname = argv[0];
+  80027a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80027e:	48 8b 00             	mov    (%rax),%rax
+  800281:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  800288:	00 00 00 
+  80028b:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80028f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800293:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800296:	48 89 d6             	mov    %rdx,%rsi
+  800299:	89 c7                	mov    %eax,%edi
+  80029b:	49 89 df             	mov    %rbx,%r15
+  80029e:	48 b8 82 71 ff ff ff 	movabs $0xffffffffffff7182,%rax
+  8002a5:	ff ff ff 
+  8002a8:	48 01 d8             	add    %rbx,%rax
+  8002ab:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8002ad:	49 89 df             	mov    %rbx,%r15
+  8002b0:	48 b8 89 72 ff ff ff 	movabs $0xffffffffffff7289,%rax
+  8002b7:	ff ff ff 
+  8002ba:	48 01 d8             	add    %rbx,%rax
+  8002bd:	ff d0                	call   *%rax
+}
+  8002bf:	90                   	nop
+  8002c0:	48 83 c4 20          	add    $0x20,%rsp
+  8002c4:	5b                   	pop    %rbx
+  8002c5:	41 5f                	pop    %r15
+  8002c7:	5d                   	pop    %rbp
+  8002c8:	c3                   	ret
+
+00000000008002c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002c9:	55                   	push   %rbp
+  8002ca:	48 89 e5             	mov    %rsp,%rbp
+  8002cd:	41 57                	push   %r15
+  8002cf:	53                   	push   %rbx
+  8002d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8002d0 <exit+0x7>
+  8002d7:	49 bb 70 8d 00 00 00 	movabs $0x8d70,%r11
+  8002de:	00 00 00 
+  8002e1:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8002e4:	49 89 df             	mov    %rbx,%r15
+  8002e7:	48 b8 2f a6 ff ff ff 	movabs $0xffffffffffffa62f,%rax
+  8002ee:	ff ff ff 
+  8002f1:	48 01 d8             	add    %rbx,%rax
+  8002f4:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8002f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002fb:	49 89 df             	mov    %rbx,%r15
+  8002fe:	48 b8 ca 8d ff ff ff 	movabs $0xffffffffffff8dca,%rax
+  800305:	ff ff ff 
+  800308:	48 01 d8             	add    %rbx,%rax
+  80030b:	ff d0                	call   *%rax
+}
+  80030d:	90                   	nop
+  80030e:	5b                   	pop    %rbx
+  80030f:	41 5f                	pop    %r15
+  800311:	5d                   	pop    %rbp
+  800312:	c3                   	ret
+
+0000000000800313 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800313:	55                   	push   %rbp
+  800314:	48 89 e5             	mov    %rsp,%rbp
+  800317:	41 57                	push   %r15
+  800319:	48 83 ec 18          	sub    $0x18,%rsp
+  80031d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80031d <putch+0xa>
+  800324:	49 bb 23 8d 00 00 00 	movabs $0x8d23,%r11
+  80032b:	00 00 00 
+  80032e:	4c 01 d8             	add    %r11,%rax
+  800331:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800334:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800338:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80033c:	8b 12                	mov    (%rdx),%edx
+  80033e:	8d 72 01             	lea    0x1(%rdx),%esi
+  800341:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800345:	89 31                	mov    %esi,(%rcx)
+  800347:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80034a:	89 ce                	mov    %ecx,%esi
+  80034c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800350:	48 63 d2             	movslq %edx,%rdx
+  800353:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800358:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80035c:	8b 12                	mov    (%rdx),%edx
+  80035e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800364:	75 33                	jne    800399 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800366:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80036a:	8b 12                	mov    (%rdx),%edx
+  80036c:	48 63 d2             	movslq %edx,%rdx
+  80036f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800373:	48 83 c1 08          	add    $0x8,%rcx
+  800377:	48 89 d6             	mov    %rdx,%rsi
+  80037a:	48 89 cf             	mov    %rcx,%rdi
+  80037d:	49 89 c7             	mov    %rax,%r15
+  800380:	48 ba 17 8d ff ff ff 	movabs $0xffffffffffff8d17,%rdx
+  800387:	ff ff ff 
+  80038a:	48 01 c2             	add    %rax,%rdx
+  80038d:	ff d2                	call   *%rdx
+        b->idx = 0;
+  80038f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800393:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800399:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80039d:	8b 40 04             	mov    0x4(%rax),%eax
+  8003a0:	8d 50 01             	lea    0x1(%rax),%edx
+  8003a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003a7:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8003aa:	90                   	nop
+  8003ab:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8003af:	c9                   	leave
+  8003b0:	c3                   	ret
+
+00000000008003b1 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003b1:	55                   	push   %rbp
+  8003b2:	48 89 e5             	mov    %rsp,%rbp
+  8003b5:	41 57                	push   %r15
+  8003b7:	53                   	push   %rbx
+  8003b8:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8003bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8003bf <vcprintf+0xe>
+  8003c6:	49 bb 81 8c 00 00 00 	movabs $0x8c81,%r11
+  8003cd:	00 00 00 
+  8003d0:	4c 01 db             	add    %r11,%rbx
+  8003d3:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8003da:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8003e1:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8003e8:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8003ef:	48 8b 06             	mov    (%rsi),%rax
+  8003f2:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8003f6:	48 89 01             	mov    %rax,(%rcx)
+  8003f9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8003fd:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800401:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800405:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  80040c:	00 00 00 
+    b.cnt = 0;
+  80040f:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800416:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800419:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800420:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800427:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80042e:	48 89 c6             	mov    %rax,%rsi
+  800431:	48 b8 d3 72 ff ff ff 	movabs $0xffffffffffff72d3,%rax
+  800438:	ff ff ff 
+  80043b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80043f:	48 89 c7             	mov    %rax,%rdi
+  800442:	49 89 df             	mov    %rbx,%r15
+  800445:	48 b8 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rax
+  80044c:	ff ff ff 
+  80044f:	48 01 d8             	add    %rbx,%rax
+  800452:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800454:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80045a:	48 98                	cltq
+  80045c:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800463:	48 83 c2 08          	add    $0x8,%rdx
+  800467:	48 89 c6             	mov    %rax,%rsi
+  80046a:	48 89 d7             	mov    %rdx,%rdi
+  80046d:	49 89 df             	mov    %rbx,%r15
+  800470:	48 b8 17 8d ff ff ff 	movabs $0xffffffffffff8d17,%rax
+  800477:	ff ff ff 
+  80047a:	48 01 d8             	add    %rbx,%rax
+  80047d:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  80047f:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800485:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80048c:	5b                   	pop    %rbx
+  80048d:	41 5f                	pop    %r15
+  80048f:	5d                   	pop    %rbp
+  800490:	c3                   	ret
+
+0000000000800491 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800491:	55                   	push   %rbp
+  800492:	48 89 e5             	mov    %rsp,%rbp
+  800495:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80049c:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80049c <cprintf+0xb>
+  8004a3:	49 bb a4 8b 00 00 00 	movabs $0x8ba4,%r11
+  8004aa:	00 00 00 
+  8004ad:	4d 01 da             	add    %r11,%r10
+  8004b0:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004b7:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8004be:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8004c5:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8004cc:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004d3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004da:	84 c0                	test   %al,%al
+  8004dc:	74 20                	je     8004fe <cprintf+0x6d>
+  8004de:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004e2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004e6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004ea:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004ee:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004f2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004f6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004fa:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8004fe:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800505:	00 00 00 
+  800508:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80050f:	00 00 00 
+  800512:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800516:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80051d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800524:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  80052b:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800532:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800539:	48 8b 06             	mov    (%rsi),%rax
+  80053c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800540:	48 89 01             	mov    %rax,(%rcx)
+  800543:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800547:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80054b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80054f:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800556:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80055d:	48 89 d6             	mov    %rdx,%rsi
+  800560:	48 89 c7             	mov    %rax,%rdi
+  800563:	48 b8 71 73 ff ff ff 	movabs $0xffffffffffff7371,%rax
+  80056a:	ff ff ff 
+  80056d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800571:	ff d0                	call   *%rax
+  800573:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800579:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80057f:	c9                   	leave
+  800580:	c3                   	ret
+
+0000000000800581 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800581:	55                   	push   %rbp
+  800582:	48 89 e5             	mov    %rsp,%rbp
+  800585:	53                   	push   %rbx
+  800586:	48 83 ec 38          	sub    $0x38,%rsp
+  80058a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80058a <printnum+0x9>
+  800591:	49 bb b6 8a 00 00 00 	movabs $0x8ab6,%r11
+  800598:	00 00 00 
+  80059b:	4c 01 db             	add    %r11,%rbx
+  80059e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8005a6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8005aa:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8005ad:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8005b1:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005b5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8005b8:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8005bc:	72 58                	jb     800616 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005be:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8005c1:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8005c4:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8005c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8005cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d0:	48 f7 f6             	div    %rsi
+  8005d3:	49 89 c2             	mov    %rax,%r10
+  8005d6:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8005d9:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8005dc:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8005e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005e4:	41 89 c9             	mov    %ecx,%r9d
+  8005e7:	41 89 f8             	mov    %edi,%r8d
+  8005ea:	89 d1                	mov    %edx,%ecx
+  8005ec:	4c 89 d2             	mov    %r10,%rdx
+  8005ef:	48 89 c7             	mov    %rax,%rdi
+  8005f2:	48 b8 41 75 ff ff ff 	movabs $0xffffffffffff7541,%rax
+  8005f9:	ff ff ff 
+  8005fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800600:	ff d0                	call   *%rax
+  800602:	eb 1c                	jmp    800620 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800604:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800608:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80060b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80060f:	48 89 d6             	mov    %rdx,%rsi
+  800612:	89 c7                	mov    %eax,%edi
+  800614:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800616:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  80061a:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80061e:	7f e4                	jg     800604 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800620:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800623:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800627:	ba 00 00 00 00       	mov    $0x0,%edx
+  80062c:	48 f7 f1             	div    %rcx
+  80062f:	48 b8 c7 dd ff ff ff 	movabs $0xffffffffffffddc7,%rax
+  800636:	ff ff ff 
+  800639:	48 01 d8             	add    %rbx,%rax
+  80063c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800640:	0f be c0             	movsbl %al,%eax
+  800643:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800647:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80064b:	48 89 d6             	mov    %rdx,%rsi
+  80064e:	89 c7                	mov    %eax,%edi
+  800650:	ff d1                	call   *%rcx
+}
+  800652:	90                   	nop
+  800653:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800657:	c9                   	leave
+  800658:	c3                   	ret
+
+0000000000800659 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800659:	55                   	push   %rbp
+  80065a:	48 89 e5             	mov    %rsp,%rbp
+  80065d:	48 83 ec 20          	sub    $0x20,%rsp
+  800661:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800661 <getuint+0x8>
+  800668:	49 bb df 89 00 00 00 	movabs $0x89df,%r11
+  80066f:	00 00 00 
+  800672:	4c 01 d8             	add    %r11,%rax
+  800675:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800679:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80067c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800680:	7e 4f                	jle    8006d1 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800682:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800686:	8b 00                	mov    (%rax),%eax
+  800688:	83 f8 2f             	cmp    $0x2f,%eax
+  80068b:	77 24                	ja     8006b1 <getuint+0x58>
+  80068d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800691:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800695:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800699:	8b 00                	mov    (%rax),%eax
+  80069b:	89 c0                	mov    %eax,%eax
+  80069d:	48 01 d0             	add    %rdx,%rax
+  8006a0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006a4:	8b 12                	mov    (%rdx),%edx
+  8006a6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006a9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006ad:	89 0a                	mov    %ecx,(%rdx)
+  8006af:	eb 14                	jmp    8006c5 <getuint+0x6c>
+  8006b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006b5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006b9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006bd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006c1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006c5:	48 8b 00             	mov    (%rax),%rax
+  8006c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8006cc:	e9 9d 00 00 00       	jmp    80076e <getuint+0x115>
+	else if (lflag)
+  8006d1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8006d5:	74 4c                	je     800723 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8006d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006db:	8b 00                	mov    (%rax),%eax
+  8006dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e0:	77 24                	ja     800706 <getuint+0xad>
+  8006e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006e6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ee:	8b 00                	mov    (%rax),%eax
+  8006f0:	89 c0                	mov    %eax,%eax
+  8006f2:	48 01 d0             	add    %rdx,%rax
+  8006f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006f9:	8b 12                	mov    (%rdx),%edx
+  8006fb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800702:	89 0a                	mov    %ecx,(%rdx)
+  800704:	eb 14                	jmp    80071a <getuint+0xc1>
+  800706:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80070a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80070e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800712:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800716:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80071a:	48 8b 00             	mov    (%rax),%rax
+  80071d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800721:	eb 4b                	jmp    80076e <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800723:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800727:	8b 00                	mov    (%rax),%eax
+  800729:	83 f8 2f             	cmp    $0x2f,%eax
+  80072c:	77 24                	ja     800752 <getuint+0xf9>
+  80072e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800732:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800736:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80073a:	8b 00                	mov    (%rax),%eax
+  80073c:	89 c0                	mov    %eax,%eax
+  80073e:	48 01 d0             	add    %rdx,%rax
+  800741:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800745:	8b 12                	mov    (%rdx),%edx
+  800747:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80074a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80074e:	89 0a                	mov    %ecx,(%rdx)
+  800750:	eb 14                	jmp    800766 <getuint+0x10d>
+  800752:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800756:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80075a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80075e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800762:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800766:	8b 00                	mov    (%rax),%eax
+  800768:	89 c0                	mov    %eax,%eax
+  80076a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80076e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800772:	c9                   	leave
+  800773:	c3                   	ret
+
+0000000000800774 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800774:	55                   	push   %rbp
+  800775:	48 89 e5             	mov    %rsp,%rbp
+  800778:	48 83 ec 20          	sub    $0x20,%rsp
+  80077c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80077c <printfloat+0x8>
+  800783:	49 bb c4 88 00 00 00 	movabs $0x88c4,%r11
+  80078a:	00 00 00 
+  80078d:	4c 01 d8             	add    %r11,%rax
+  800790:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800794:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800798:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80079c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a0:	48 85 c0             	test   %rax,%rax
+  8007a3:	79 12                	jns    8007b7 <printfloat+0x43>
+		putch('-',putdat);
+  8007a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007ad:	48 89 c6             	mov    %rax,%rsi
+  8007b0:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007b5:	ff d2                	call   *%rdx
+	
+}
+  8007b7:	90                   	nop
+  8007b8:	c9                   	leave
+  8007b9:	c3                   	ret
+
+00000000008007ba <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8007ba:	55                   	push   %rbp
+  8007bb:	48 89 e5             	mov    %rsp,%rbp
+  8007be:	48 83 ec 20          	sub    $0x20,%rsp
+  8007c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007c2 <getint+0x8>
+  8007c9:	49 bb 7e 88 00 00 00 	movabs $0x887e,%r11
+  8007d0:	00 00 00 
+  8007d3:	4c 01 d8             	add    %r11,%rax
+  8007d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007da:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8007dd:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8007e1:	7e 4f                	jle    800832 <getint+0x78>
+		x=va_arg(*ap, long long);
+  8007e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e7:	8b 00                	mov    (%rax),%eax
+  8007e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ec:	77 24                	ja     800812 <getint+0x58>
+  8007ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007f2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007fa:	8b 00                	mov    (%rax),%eax
+  8007fc:	89 c0                	mov    %eax,%eax
+  8007fe:	48 01 d0             	add    %rdx,%rax
+  800801:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800805:	8b 12                	mov    (%rdx),%edx
+  800807:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80080a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80080e:	89 0a                	mov    %ecx,(%rdx)
+  800810:	eb 14                	jmp    800826 <getint+0x6c>
+  800812:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800816:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80081a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80081e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800822:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800826:	48 8b 00             	mov    (%rax),%rax
+  800829:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80082d:	e9 9d 00 00 00       	jmp    8008cf <getint+0x115>
+	else if (lflag)
+  800832:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800836:	74 4c                	je     800884 <getint+0xca>
+		x=va_arg(*ap, long);
+  800838:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80083c:	8b 00                	mov    (%rax),%eax
+  80083e:	83 f8 2f             	cmp    $0x2f,%eax
+  800841:	77 24                	ja     800867 <getint+0xad>
+  800843:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800847:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80084b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80084f:	8b 00                	mov    (%rax),%eax
+  800851:	89 c0                	mov    %eax,%eax
+  800853:	48 01 d0             	add    %rdx,%rax
+  800856:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80085a:	8b 12                	mov    (%rdx),%edx
+  80085c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80085f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800863:	89 0a                	mov    %ecx,(%rdx)
+  800865:	eb 14                	jmp    80087b <getint+0xc1>
+  800867:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80086b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80086f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800873:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800877:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80087b:	48 8b 00             	mov    (%rax),%rax
+  80087e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800882:	eb 4b                	jmp    8008cf <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800884:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800888:	8b 00                	mov    (%rax),%eax
+  80088a:	83 f8 2f             	cmp    $0x2f,%eax
+  80088d:	77 24                	ja     8008b3 <getint+0xf9>
+  80088f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800893:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800897:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80089b:	8b 00                	mov    (%rax),%eax
+  80089d:	89 c0                	mov    %eax,%eax
+  80089f:	48 01 d0             	add    %rdx,%rax
+  8008a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008a6:	8b 12                	mov    (%rdx),%edx
+  8008a8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008ab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008af:	89 0a                	mov    %ecx,(%rdx)
+  8008b1:	eb 14                	jmp    8008c7 <getint+0x10d>
+  8008b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008b7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008bb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008bf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008c7:	8b 00                	mov    (%rax),%eax
+  8008c9:	48 98                	cltq
+  8008cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8008cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8008d3:	c9                   	leave
+  8008d4:	c3                   	ret
+
+00000000008008d5 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  8008d5:	55                   	push   %rbp
+  8008d6:	48 89 e5             	mov    %rsp,%rbp
+  8008d9:	41 57                	push   %r15
+  8008db:	41 55                	push   %r13
+  8008dd:	41 54                	push   %r12
+  8008df:	53                   	push   %rbx
+  8008e0:	48 83 ec 60          	sub    $0x60,%rsp
+  8008e4:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 8008e4 <vprintfmt+0xf>
+  8008eb:	49 bb 5c 87 00 00 00 	movabs $0x875c,%r11
+  8008f2:	00 00 00 
+  8008f5:	4d 01 dc             	add    %r11,%r12
+  8008f8:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  8008fc:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800900:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800904:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800908:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  80090f:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800913:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800917:	48 8b 06             	mov    (%rsi),%rax
+  80091a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80091e:	48 89 01             	mov    %rax,(%rcx)
+  800921:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800925:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800929:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80092d:	eb 17                	jmp    800946 <vprintfmt+0x71>
+			if (ch == '\0')
+  80092f:	85 db                	test   %ebx,%ebx
+  800931:	0f 84 97 05 00 00    	je     800ece <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800937:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80093b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80093f:	48 89 c6             	mov    %rax,%rsi
+  800942:	89 df                	mov    %ebx,%edi
+  800944:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800946:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80094a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80094e:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800952:	0f b6 00             	movzbl (%rax),%eax
+  800955:	0f b6 d8             	movzbl %al,%ebx
+  800958:	83 fb 25             	cmp    $0x25,%ebx
+  80095b:	75 d2                	jne    80092f <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  80095d:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800961:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800968:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  80096f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800976:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  80097d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800981:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800985:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800989:	0f b6 00             	movzbl (%rax),%eax
+  80098c:	0f b6 d8             	movzbl %al,%ebx
+  80098f:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800992:	83 f8 55             	cmp    $0x55,%eax
+  800995:	0f 87 00 05 00 00    	ja     800e9b <vprintfmt+0x5c6>
+  80099b:	89 c0                	mov    %eax,%eax
+  80099d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8009a4:	00 
+  8009a5:	48 8d 05 84 64 00 00 	lea    0x6484(%rip),%rax        # 806e30 <.LC18+0xc>
+  8009ac:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  8009b0:	48 8d 15 79 64 00 00 	lea    0x6479(%rip),%rdx        # 806e30 <.LC18+0xc>
+  8009b7:	48 01 d0             	add    %rdx,%rax
+  8009ba:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  8009bc:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  8009c0:	eb bb                	jmp    80097d <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  8009c2:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  8009c6:	eb b5                	jmp    80097d <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  8009c8:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  8009cf:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8009d2:	89 d0                	mov    %edx,%eax
+  8009d4:	c1 e0 02             	shl    $0x2,%eax
+  8009d7:	01 d0                	add    %edx,%eax
+  8009d9:	01 c0                	add    %eax,%eax
+  8009db:	01 d8                	add    %ebx,%eax
+  8009dd:	83 e8 30             	sub    $0x30,%eax
+  8009e0:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  8009e3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8009e7:	0f b6 00             	movzbl (%rax),%eax
+  8009ea:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  8009ed:	83 fb 2f             	cmp    $0x2f,%ebx
+  8009f0:	7e 60                	jle    800a52 <vprintfmt+0x17d>
+  8009f2:	83 fb 39             	cmp    $0x39,%ebx
+  8009f5:	7f 5b                	jg     800a52 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  8009f7:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  8009fc:	eb d1                	jmp    8009cf <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8009fe:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a01:	83 f8 2f             	cmp    $0x2f,%eax
+  800a04:	77 17                	ja     800a1d <vprintfmt+0x148>
+  800a06:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a0a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a0d:	89 d2                	mov    %edx,%edx
+  800a0f:	48 01 d0             	add    %rdx,%rax
+  800a12:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a15:	83 c2 08             	add    $0x8,%edx
+  800a18:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800a1b:	eb 0c                	jmp    800a29 <vprintfmt+0x154>
+  800a1d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a21:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a25:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800a29:	8b 00                	mov    (%rax),%eax
+  800a2b:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800a2e:	eb 23                	jmp    800a53 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800a30:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a34:	0f 89 43 ff ff ff    	jns    80097d <vprintfmt+0xa8>
+				width = 0;
+  800a3a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800a41:	e9 37 ff ff ff       	jmp    80097d <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800a46:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800a4d:	e9 2b ff ff ff       	jmp    80097d <vprintfmt+0xa8>
+			goto process_precision;
+  800a52:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800a53:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a57:	0f 89 20 ff ff ff    	jns    80097d <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800a5d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800a60:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800a63:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800a6a:	e9 0e ff ff ff       	jmp    80097d <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800a6f:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800a73:	e9 05 ff ff ff       	jmp    80097d <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800a78:	83 fb 39             	cmp    $0x39,%ebx
+  800a7b:	7f 0b                	jg     800a88 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800a7d:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800a80:	c1 e0 08             	shl    $0x8,%eax
+  800a83:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800a86:	eb 21                	jmp    800aa9 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800a88:	83 fb 60             	cmp    $0x60,%ebx
+  800a8b:	7e 10                	jle    800a9d <vprintfmt+0x1c8>
+  800a8d:	83 fb 66             	cmp    $0x66,%ebx
+  800a90:	7f 0b                	jg     800a9d <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800a92:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800a95:	c1 e0 08             	shl    $0x8,%eax
+  800a98:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800a9b:	eb 0c                	jmp    800aa9 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800a9d:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800aa4:	e9 04 01 00 00       	jmp    800bad <vprintfmt+0x2d8>
+  800aa9:	e9 ff 00 00 00       	jmp    800bad <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800aae:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ab1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab4:	77 17                	ja     800acd <vprintfmt+0x1f8>
+  800ab6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800aba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800abd:	89 d2                	mov    %edx,%edx
+  800abf:	48 01 d0             	add    %rdx,%rax
+  800ac2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ac5:	83 c2 08             	add    $0x8,%edx
+  800ac8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800acb:	eb 0c                	jmp    800ad9 <vprintfmt+0x204>
+  800acd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ad1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ad5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ad9:	8b 00                	mov    (%rax),%eax
+  800adb:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800adf:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800ae3:	48 89 d6             	mov    %rdx,%rsi
+  800ae6:	89 c7                	mov    %eax,%edi
+  800ae8:	ff d1                	call   *%rcx
+			break;
+  800aea:	e9 da 03 00 00       	jmp    800ec9 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800aef:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800af2:	83 f8 2f             	cmp    $0x2f,%eax
+  800af5:	77 17                	ja     800b0e <vprintfmt+0x239>
+  800af7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800afb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800afe:	89 d2                	mov    %edx,%edx
+  800b00:	48 01 d0             	add    %rdx,%rax
+  800b03:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b06:	83 c2 08             	add    $0x8,%edx
+  800b09:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b0c:	eb 0c                	jmp    800b1a <vprintfmt+0x245>
+  800b0e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b12:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b16:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b1a:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800b1c:	85 db                	test   %ebx,%ebx
+  800b1e:	79 02                	jns    800b22 <vprintfmt+0x24d>
+				err = -err;
+  800b20:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b22:	83 fb 15             	cmp    $0x15,%ebx
+  800b25:	7f 19                	jg     800b40 <vprintfmt+0x26b>
+  800b27:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800b2e:	00 00 00 
+  800b31:	48 63 c3             	movslq %ebx,%rax
+  800b34:	4c 01 e2             	add    %r12,%rdx
+  800b37:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800b3b:	4d 85 ed             	test   %r13,%r13
+  800b3e:	75 36                	jne    800b76 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800b40:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b44:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b48:	89 d9                	mov    %ebx,%ecx
+  800b4a:	48 ba d8 dd ff ff ff 	movabs $0xffffffffffffddd8,%rdx
+  800b51:	ff ff ff 
+  800b54:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800b58:	48 89 c7             	mov    %rax,%rdi
+  800b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b60:	49 b8 9c 7e ff ff ff 	movabs $0xffffffffffff7e9c,%r8
+  800b67:	ff ff ff 
+  800b6a:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800b6e:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800b71:	e9 53 03 00 00       	jmp    800ec9 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800b76:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b7a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b7e:	4c 89 e9             	mov    %r13,%rcx
+  800b81:	48 ba e1 dd ff ff ff 	movabs $0xffffffffffffdde1,%rdx
+  800b88:	ff ff ff 
+  800b8b:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800b8f:	48 89 c7             	mov    %rax,%rdi
+  800b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b97:	49 b8 9c 7e ff ff ff 	movabs $0xffffffffffff7e9c,%r8
+  800b9e:	ff ff ff 
+  800ba1:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800ba5:	41 ff d0             	call   *%r8
+			break;
+  800ba8:	e9 1c 03 00 00       	jmp    800ec9 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800bad:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800bb0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb3:	77 17                	ja     800bcc <vprintfmt+0x2f7>
+  800bb5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800bb9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bbc:	89 d2                	mov    %edx,%edx
+  800bbe:	48 01 d0             	add    %rdx,%rax
+  800bc1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bc4:	83 c2 08             	add    $0x8,%edx
+  800bc7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800bca:	eb 0c                	jmp    800bd8 <vprintfmt+0x303>
+  800bcc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bd0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bd4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800bd8:	4c 8b 28             	mov    (%rax),%r13
+  800bdb:	4d 85 ed             	test   %r13,%r13
+  800bde:	75 0e                	jne    800bee <vprintfmt+0x319>
+				p = "(null)";
+  800be0:	48 b8 e4 dd ff ff ff 	movabs $0xffffffffffffdde4,%rax
+  800be7:	ff ff ff 
+  800bea:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800bee:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800bf2:	0f 8e 84 00 00 00    	jle    800c7c <vprintfmt+0x3a7>
+  800bf8:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800bfc:	74 7e                	je     800c7c <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bfe:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800c01:	48 98                	cltq
+  800c03:	48 89 c6             	mov    %rax,%rsi
+  800c06:	4c 89 ef             	mov    %r13,%rdi
+  800c09:	4d 89 e7             	mov    %r12,%r15
+  800c0c:	48 b8 c1 81 ff ff ff 	movabs $0xffffffffffff81c1,%rax
+  800c13:	ff ff ff 
+  800c16:	4c 01 e0             	add    %r12,%rax
+  800c19:	ff d0                	call   *%rax
+  800c1b:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800c1e:	eb 17                	jmp    800c37 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800c20:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800c24:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c28:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c2c:	48 89 d6             	mov    %rdx,%rsi
+  800c2f:	89 c7                	mov    %eax,%edi
+  800c31:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c33:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800c37:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c3b:	7f e3                	jg     800c20 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c3d:	eb 3d                	jmp    800c7c <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800c3f:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800c43:	74 1e                	je     800c63 <vprintfmt+0x38e>
+  800c45:	83 fb 1f             	cmp    $0x1f,%ebx
+  800c48:	7e 05                	jle    800c4f <vprintfmt+0x37a>
+  800c4a:	83 fb 7e             	cmp    $0x7e,%ebx
+  800c4d:	7e 14                	jle    800c63 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800c4f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c53:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c57:	48 89 c6             	mov    %rax,%rsi
+  800c5a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c5f:	ff d2                	call   *%rdx
+  800c61:	eb 15                	jmp    800c78 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800c63:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800c66:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800c69:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c6d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c71:	48 89 c6             	mov    %rax,%rsi
+  800c74:	89 cf                	mov    %ecx,%edi
+  800c76:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c78:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800c7c:	4c 89 e8             	mov    %r13,%rax
+  800c7f:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800c83:	0f b6 00             	movzbl (%rax),%eax
+  800c86:	0f be d8             	movsbl %al,%ebx
+  800c89:	85 db                	test   %ebx,%ebx
+  800c8b:	74 28                	je     800cb5 <vprintfmt+0x3e0>
+  800c8d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800c91:	78 ac                	js     800c3f <vprintfmt+0x36a>
+  800c93:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800c97:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800c9b:	79 a2                	jns    800c3f <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800c9d:	eb 16                	jmp    800cb5 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800c9f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ca3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ca7:	48 89 c6             	mov    %rax,%rsi
+  800caa:	bf 20 00 00 00       	mov    $0x20,%edi
+  800caf:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800cb1:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800cb5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800cb9:	7f e4                	jg     800c9f <vprintfmt+0x3ca>
+			break;
+  800cbb:	e9 09 02 00 00       	jmp    800ec9 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800cc0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800cc4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800cc8:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800ccc:	0f b6 00             	movzbl (%rax),%eax
+  800ccf:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800cd2:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800cd3:	83 fb 2f             	cmp    $0x2f,%ebx
+  800cd6:	0f 8e ac fd ff ff    	jle    800a88 <vprintfmt+0x1b3>
+  800cdc:	e9 97 fd ff ff       	jmp    800a78 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800ce1:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ce5:	be 03 00 00 00       	mov    $0x3,%esi
+  800cea:	48 89 c7             	mov    %rax,%rdi
+  800ced:	48 b8 7a 77 ff ff ff 	movabs $0xffffffffffff777a,%rax
+  800cf4:	ff ff ff 
+  800cf7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800cfb:	ff d0                	call   *%rax
+  800cfd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800d01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d05:	48 85 c0             	test   %rax,%rax
+  800d08:	79 1d                	jns    800d27 <vprintfmt+0x452>
+				putch('-', putdat);
+  800d0a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d0e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d12:	48 89 c6             	mov    %rax,%rsi
+  800d15:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d1a:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800d1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d20:	48 f7 d8             	neg    %rax
+  800d23:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800d27:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800d2e:	e9 de 00 00 00       	jmp    800e11 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800d33:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d37:	be 03 00 00 00       	mov    $0x3,%esi
+  800d3c:	48 89 c7             	mov    %rax,%rdi
+  800d3f:	48 b8 19 76 ff ff ff 	movabs $0xffffffffffff7619,%rax
+  800d46:	ff ff ff 
+  800d49:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d4d:	ff d0                	call   *%rax
+  800d4f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800d53:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800d5a:	e9 b2 00 00 00       	jmp    800e11 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800d5f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d63:	be 03 00 00 00       	mov    $0x3,%esi
+  800d68:	48 89 c7             	mov    %rax,%rdi
+  800d6b:	48 b8 19 76 ff ff ff 	movabs $0xffffffffffff7619,%rax
+  800d72:	ff ff ff 
+  800d75:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d79:	ff d0                	call   *%rax
+  800d7b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800d7f:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800d86:	e9 86 00 00 00       	jmp    800e11 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800d8b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d8f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d93:	48 89 c6             	mov    %rax,%rsi
+  800d96:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d9b:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800d9d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800da1:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800da5:	48 89 c6             	mov    %rax,%rsi
+  800da8:	bf 78 00 00 00       	mov    $0x78,%edi
+  800dad:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800daf:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800db2:	83 f8 2f             	cmp    $0x2f,%eax
+  800db5:	77 17                	ja     800dce <vprintfmt+0x4f9>
+  800db7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dbb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dbe:	89 d2                	mov    %edx,%edx
+  800dc0:	48 01 d0             	add    %rdx,%rax
+  800dc3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dc6:	83 c2 08             	add    $0x8,%edx
+  800dc9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800dcc:	eb 0c                	jmp    800dda <vprintfmt+0x505>
+  800dce:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dd2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dd6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800dda:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800ddd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800de1:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800de8:	eb 27                	jmp    800e11 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800dea:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800dee:	be 03 00 00 00       	mov    $0x3,%esi
+  800df3:	48 89 c7             	mov    %rax,%rdi
+  800df6:	48 b8 19 76 ff ff ff 	movabs $0xffffffffffff7619,%rax
+  800dfd:	ff ff ff 
+  800e00:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e04:	ff d0                	call   *%rax
+  800e06:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800e0a:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800e11:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800e16:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800e19:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800e1c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800e20:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e24:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e28:	45 89 c1             	mov    %r8d,%r9d
+  800e2b:	41 89 f8             	mov    %edi,%r8d
+  800e2e:	48 89 c7             	mov    %rax,%rdi
+  800e31:	48 b8 41 75 ff ff ff 	movabs $0xffffffffffff7541,%rax
+  800e38:	ff ff ff 
+  800e3b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e3f:	ff d0                	call   *%rax
+			break;
+  800e41:	e9 83 00 00 00       	jmp    800ec9 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800e46:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e4a:	be 03 00 00 00       	mov    $0x3,%esi
+  800e4f:	48 89 c7             	mov    %rax,%rdi
+  800e52:	48 b8 19 76 ff ff ff 	movabs $0xffffffffffff7619,%rax
+  800e59:	ff ff ff 
+  800e5c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e60:	ff d0                	call   *%rax
+  800e62:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800e66:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800e6a:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800e6e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e72:	48 89 ce             	mov    %rcx,%rsi
+  800e75:	48 89 c7             	mov    %rax,%rdi
+  800e78:	48 b8 34 77 ff ff ff 	movabs $0xffffffffffff7734,%rax
+  800e7f:	ff ff ff 
+  800e82:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e86:	ff d0                	call   *%rax
+	
+			break;
+  800e88:	eb 3f                	jmp    800ec9 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800e8a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e8e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e92:	48 89 c6             	mov    %rax,%rsi
+  800e95:	89 df                	mov    %ebx,%edi
+  800e97:	ff d2                	call   *%rdx
+			break;
+  800e99:	eb 2e                	jmp    800ec9 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800e9b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e9f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ea3:	48 89 c6             	mov    %rax,%rsi
+  800ea6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800eab:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ead:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800eb2:	eb 05                	jmp    800eb9 <vprintfmt+0x5e4>
+  800eb4:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800eb9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ebd:	48 83 e8 01          	sub    $0x1,%rax
+  800ec1:	0f b6 00             	movzbl (%rax),%eax
+  800ec4:	3c 25                	cmp    $0x25,%al
+  800ec6:	75 ec                	jne    800eb4 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800ec8:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ec9:	e9 78 fa ff ff       	jmp    800946 <vprintfmt+0x71>
+				return;
+  800ece:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800ecf:	48 83 c4 60          	add    $0x60,%rsp
+  800ed3:	5b                   	pop    %rbx
+  800ed4:	41 5c                	pop    %r12
+  800ed6:	41 5d                	pop    %r13
+  800ed8:	41 5f                	pop    %r15
+  800eda:	5d                   	pop    %rbp
+  800edb:	c3                   	ret
+
+0000000000800edc <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  800edc:	55                   	push   %rbp
+  800edd:	48 89 e5             	mov    %rsp,%rbp
+  800ee0:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800ee7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800ee7 <printfmt+0xb>
+  800eee:	49 bb 59 81 00 00 00 	movabs $0x8159,%r11
+  800ef5:	00 00 00 
+  800ef8:	4d 01 da             	add    %r11,%r10
+  800efb:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f02:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f09:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f10:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f17:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f1e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f25:	84 c0                	test   %al,%al
+  800f27:	74 20                	je     800f49 <printfmt+0x6d>
+  800f29:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f2d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f31:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f35:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f39:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f3d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f41:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f45:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800f49:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f50:	00 00 00 
+  800f53:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f5a:	00 00 00 
+  800f5d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f61:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f68:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f6f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800f76:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f7d:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800f84:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800f8b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f92:	48 89 c7             	mov    %rax,%rdi
+  800f95:	48 b8 95 78 ff ff ff 	movabs $0xffffffffffff7895,%rax
+  800f9c:	ff ff ff 
+  800f9f:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800fa3:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800fa5:	90                   	nop
+  800fa6:	c9                   	leave
+  800fa7:	c3                   	ret
+
+0000000000800fa8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800fa8:	55                   	push   %rbp
+  800fa9:	48 89 e5             	mov    %rsp,%rbp
+  800fac:	48 83 ec 10          	sub    $0x10,%rsp
+  800fb0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800fb0 <sprintputch+0x8>
+  800fb7:	49 bb 90 80 00 00 00 	movabs $0x8090,%r11
+  800fbe:	00 00 00 
+  800fc1:	4c 01 d8             	add    %r11,%rax
+  800fc4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800fc7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800fcb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fcf:	8b 40 10             	mov    0x10(%rax),%eax
+  800fd2:	8d 50 01             	lea    0x1(%rax),%edx
+  800fd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fd9:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800fdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fe0:	48 8b 10             	mov    (%rax),%rdx
+  800fe3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fe7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800feb:	48 39 c2             	cmp    %rax,%rdx
+  800fee:	73 17                	jae    801007 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  800ff0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ff4:	48 8b 00             	mov    (%rax),%rax
+  800ff7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800ffb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800fff:	48 89 0a             	mov    %rcx,(%rdx)
+  801002:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801005:	88 10                	mov    %dl,(%rax)
+}
+  801007:	90                   	nop
+  801008:	c9                   	leave
+  801009:	c3                   	ret
+
+000000000080100a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80100a:	55                   	push   %rbp
+  80100b:	48 89 e5             	mov    %rsp,%rbp
+  80100e:	53                   	push   %rbx
+  80100f:	48 83 ec 58          	sub    $0x58,%rsp
+  801013:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801013 <vsnprintf+0x9>
+  80101a:	49 bb 2d 80 00 00 00 	movabs $0x802d,%r11
+  801021:	00 00 00 
+  801024:	4c 01 d8             	add    %r11,%rax
+  801027:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80102b:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80102e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801032:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801036:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80103a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80103e:	48 8b 0e             	mov    (%rsi),%rcx
+  801041:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801045:	48 89 0a             	mov    %rcx,(%rdx)
+  801048:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80104c:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801050:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801054:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801058:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80105c:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80105f:	48 63 d2             	movslq %edx,%rdx
+  801062:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801066:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80106a:	48 01 ca             	add    %rcx,%rdx
+  80106d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801071:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801078:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80107d:	74 06                	je     801085 <vsnprintf+0x7b>
+  80107f:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801083:	7f 07                	jg     80108c <vsnprintf+0x82>
+		return -E_INVAL;
+  801085:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80108a:	eb 34                	jmp    8010c0 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80108c:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801090:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801094:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801098:	48 bf 68 7f ff ff ff 	movabs $0xffffffffffff7f68,%rdi
+  80109f:	ff ff ff 
+  8010a2:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8010a6:	49 b8 95 78 ff ff ff 	movabs $0xffffffffffff7895,%r8
+  8010ad:	ff ff ff 
+  8010b0:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8010b4:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8010b6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8010ba:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8010bd:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8010c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010c4:	c9                   	leave
+  8010c5:	c3                   	ret
+
+00000000008010c6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8010c6:	55                   	push   %rbp
+  8010c7:	48 89 e5             	mov    %rsp,%rbp
+  8010ca:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8010d1:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8010d1 <snprintf+0xb>
+  8010d8:	49 bb 6f 7f 00 00 00 	movabs $0x7f6f,%r11
+  8010df:	00 00 00 
+  8010e2:	4d 01 da             	add    %r11,%r10
+  8010e5:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8010ec:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8010f2:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8010f9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801100:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801107:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80110e:	84 c0                	test   %al,%al
+  801110:	74 20                	je     801132 <snprintf+0x6c>
+  801112:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801116:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80111a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80111e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801122:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801126:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80112a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80112e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801132:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801139:	00 00 00 
+  80113c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801143:	00 00 00 
+  801146:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80114a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801151:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801158:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80115f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801166:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80116d:	48 8b 06             	mov    (%rsi),%rax
+  801170:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801174:	48 89 01             	mov    %rax,(%rcx)
+  801177:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80117b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80117f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801183:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80118a:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801191:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801197:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80119e:	48 89 c7             	mov    %rax,%rdi
+  8011a1:	48 b8 ca 7f ff ff ff 	movabs $0xffffffffffff7fca,%rax
+  8011a8:	ff ff ff 
+  8011ab:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8011af:	ff d0                	call   *%rax
+  8011b1:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8011b7:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8011bd:	c9                   	leave
+  8011be:	c3                   	ret
+
+00000000008011bf <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8011bf:	55                   	push   %rbp
+  8011c0:	48 89 e5             	mov    %rsp,%rbp
+  8011c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8011c7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011c7 <strlen+0x8>
+  8011ce:	49 bb 79 7e 00 00 00 	movabs $0x7e79,%r11
+  8011d5:	00 00 00 
+  8011d8:	4c 01 d8             	add    %r11,%rax
+  8011db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8011df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8011e6:	eb 09                	jmp    8011f1 <strlen+0x32>
+		n++;
+  8011e8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8011ec:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8011f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011f5:	0f b6 00             	movzbl (%rax),%eax
+  8011f8:	84 c0                	test   %al,%al
+  8011fa:	75 ec                	jne    8011e8 <strlen+0x29>
+	return n;
+  8011fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8011ff:	c9                   	leave
+  801200:	c3                   	ret
+
+0000000000801201 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801201:	55                   	push   %rbp
+  801202:	48 89 e5             	mov    %rsp,%rbp
+  801205:	48 83 ec 20          	sub    $0x20,%rsp
+  801209:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801209 <strnlen+0x8>
+  801210:	49 bb 37 7e 00 00 00 	movabs $0x7e37,%r11
+  801217:	00 00 00 
+  80121a:	4c 01 d8             	add    %r11,%rax
+  80121d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801221:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801225:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80122c:	eb 0e                	jmp    80123c <strnlen+0x3b>
+		n++;
+  80122e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801232:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801237:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80123c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801241:	74 0b                	je     80124e <strnlen+0x4d>
+  801243:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801247:	0f b6 00             	movzbl (%rax),%eax
+  80124a:	84 c0                	test   %al,%al
+  80124c:	75 e0                	jne    80122e <strnlen+0x2d>
+	return n;
+  80124e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801251:	c9                   	leave
+  801252:	c3                   	ret
+
+0000000000801253 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801253:	55                   	push   %rbp
+  801254:	48 89 e5             	mov    %rsp,%rbp
+  801257:	48 83 ec 20          	sub    $0x20,%rsp
+  80125b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80125b <strcpy+0x8>
+  801262:	49 bb e5 7d 00 00 00 	movabs $0x7de5,%r11
+  801269:	00 00 00 
+  80126c:	4c 01 d8             	add    %r11,%rax
+  80126f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801273:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801277:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80127b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80127f:	90                   	nop
+  801280:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801284:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801288:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80128c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801290:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801294:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801298:	0f b6 12             	movzbl (%rdx),%edx
+  80129b:	88 10                	mov    %dl,(%rax)
+  80129d:	0f b6 00             	movzbl (%rax),%eax
+  8012a0:	84 c0                	test   %al,%al
+  8012a2:	75 dc                	jne    801280 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8012a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8012a8:	c9                   	leave
+  8012a9:	c3                   	ret
+
+00000000008012aa <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8012aa:	55                   	push   %rbp
+  8012ab:	48 89 e5             	mov    %rsp,%rbp
+  8012ae:	53                   	push   %rbx
+  8012af:	48 83 ec 20          	sub    $0x20,%rsp
+  8012b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8012b3 <strcat+0x9>
+  8012ba:	49 bb 8d 7d 00 00 00 	movabs $0x7d8d,%r11
+  8012c1:	00 00 00 
+  8012c4:	4c 01 db             	add    %r11,%rbx
+  8012c7:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8012cb:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8012cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012d3:	48 89 c7             	mov    %rax,%rdi
+  8012d6:	48 b8 7f 81 ff ff ff 	movabs $0xffffffffffff817f,%rax
+  8012dd:	ff ff ff 
+  8012e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8012e4:	ff d0                	call   *%rax
+  8012e6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8012e9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8012ec:	48 63 d0             	movslq %eax,%rdx
+  8012ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012f3:	48 01 c2             	add    %rax,%rdx
+  8012f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012fa:	48 89 c6             	mov    %rax,%rsi
+  8012fd:	48 89 d7             	mov    %rdx,%rdi
+  801300:	48 b8 13 82 ff ff ff 	movabs $0xffffffffffff8213,%rax
+  801307:	ff ff ff 
+  80130a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80130e:	ff d0                	call   *%rax
+	return dst;
+  801310:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801314:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801318:	c9                   	leave
+  801319:	c3                   	ret
+
+000000000080131a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80131a:	55                   	push   %rbp
+  80131b:	48 89 e5             	mov    %rsp,%rbp
+  80131e:	48 83 ec 28          	sub    $0x28,%rsp
+  801322:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801322 <strncpy+0x8>
+  801329:	49 bb 1e 7d 00 00 00 	movabs $0x7d1e,%r11
+  801330:	00 00 00 
+  801333:	4c 01 d8             	add    %r11,%rax
+  801336:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80133a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80133e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801342:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801346:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80134a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801351:	00 
+  801352:	eb 2a                	jmp    80137e <strncpy+0x64>
+		*dst++ = *src;
+  801354:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801358:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80135c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801360:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801364:	0f b6 12             	movzbl (%rdx),%edx
+  801367:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801369:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80136d:	0f b6 00             	movzbl (%rax),%eax
+  801370:	84 c0                	test   %al,%al
+  801372:	74 05                	je     801379 <strncpy+0x5f>
+			src++;
+  801374:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801379:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80137e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801382:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801386:	72 cc                	jb     801354 <strncpy+0x3a>
+	}
+	return ret;
+  801388:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80138c:	c9                   	leave
+  80138d:	c3                   	ret
+
+000000000080138e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80138e:	55                   	push   %rbp
+  80138f:	48 89 e5             	mov    %rsp,%rbp
+  801392:	48 83 ec 28          	sub    $0x28,%rsp
+  801396:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801396 <strlcpy+0x8>
+  80139d:	49 bb aa 7c 00 00 00 	movabs $0x7caa,%r11
+  8013a4:	00 00 00 
+  8013a7:	4c 01 d8             	add    %r11,%rax
+  8013aa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013ae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013b2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8013b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8013be:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013c3:	74 3d                	je     801402 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8013c5:	eb 1d                	jmp    8013e4 <strlcpy+0x56>
+			*dst++ = *src++;
+  8013c7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013cb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013cf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013d7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013db:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013df:	0f b6 12             	movzbl (%rdx),%edx
+  8013e2:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8013e4:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8013e9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013ee:	74 0b                	je     8013fb <strlcpy+0x6d>
+  8013f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013f4:	0f b6 00             	movzbl (%rax),%eax
+  8013f7:	84 c0                	test   %al,%al
+  8013f9:	75 cc                	jne    8013c7 <strlcpy+0x39>
+		*dst = '\0';
+  8013fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ff:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801402:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801406:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80140a:	c9                   	leave
+  80140b:	c3                   	ret
+
+000000000080140c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80140c:	55                   	push   %rbp
+  80140d:	48 89 e5             	mov    %rsp,%rbp
+  801410:	48 83 ec 10          	sub    $0x10,%rsp
+  801414:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801414 <strcmp+0x8>
+  80141b:	49 bb 2c 7c 00 00 00 	movabs $0x7c2c,%r11
+  801422:	00 00 00 
+  801425:	4c 01 d8             	add    %r11,%rax
+  801428:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80142c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801430:	eb 0a                	jmp    80143c <strcmp+0x30>
+		p++, q++;
+  801432:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801437:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80143c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801440:	0f b6 00             	movzbl (%rax),%eax
+  801443:	84 c0                	test   %al,%al
+  801445:	74 12                	je     801459 <strcmp+0x4d>
+  801447:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80144b:	0f b6 10             	movzbl (%rax),%edx
+  80144e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801452:	0f b6 00             	movzbl (%rax),%eax
+  801455:	38 c2                	cmp    %al,%dl
+  801457:	74 d9                	je     801432 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801459:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80145d:	0f b6 00             	movzbl (%rax),%eax
+  801460:	0f b6 d0             	movzbl %al,%edx
+  801463:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801467:	0f b6 00             	movzbl (%rax),%eax
+  80146a:	0f b6 c0             	movzbl %al,%eax
+  80146d:	29 c2                	sub    %eax,%edx
+  80146f:	89 d0                	mov    %edx,%eax
+}
+  801471:	c9                   	leave
+  801472:	c3                   	ret
+
+0000000000801473 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801473:	55                   	push   %rbp
+  801474:	48 89 e5             	mov    %rsp,%rbp
+  801477:	48 83 ec 18          	sub    $0x18,%rsp
+  80147b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80147b <strncmp+0x8>
+  801482:	49 bb c5 7b 00 00 00 	movabs $0x7bc5,%r11
+  801489:	00 00 00 
+  80148c:	4c 01 d8             	add    %r11,%rax
+  80148f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801493:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801497:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80149b:	eb 0f                	jmp    8014ac <strncmp+0x39>
+		n--, p++, q++;
+  80149d:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8014a2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014a7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8014ac:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014b1:	74 1d                	je     8014d0 <strncmp+0x5d>
+  8014b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014b7:	0f b6 00             	movzbl (%rax),%eax
+  8014ba:	84 c0                	test   %al,%al
+  8014bc:	74 12                	je     8014d0 <strncmp+0x5d>
+  8014be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014c2:	0f b6 10             	movzbl (%rax),%edx
+  8014c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014c9:	0f b6 00             	movzbl (%rax),%eax
+  8014cc:	38 c2                	cmp    %al,%dl
+  8014ce:	74 cd                	je     80149d <strncmp+0x2a>
+	if (n == 0)
+  8014d0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014d5:	75 07                	jne    8014de <strncmp+0x6b>
+		return 0;
+  8014d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014dc:	eb 16                	jmp    8014f4 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8014de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014e2:	0f b6 00             	movzbl (%rax),%eax
+  8014e5:	0f b6 d0             	movzbl %al,%edx
+  8014e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ec:	0f b6 00             	movzbl (%rax),%eax
+  8014ef:	0f b6 c0             	movzbl %al,%eax
+  8014f2:	29 c2                	sub    %eax,%edx
+}
+  8014f4:	89 d0                	mov    %edx,%eax
+  8014f6:	c9                   	leave
+  8014f7:	c3                   	ret
+
+00000000008014f8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8014f8:	55                   	push   %rbp
+  8014f9:	48 89 e5             	mov    %rsp,%rbp
+  8014fc:	48 83 ec 10          	sub    $0x10,%rsp
+  801500:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801500 <strchr+0x8>
+  801507:	49 bb 40 7b 00 00 00 	movabs $0x7b40,%r11
+  80150e:	00 00 00 
+  801511:	4c 01 d8             	add    %r11,%rax
+  801514:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801518:	89 f0                	mov    %esi,%eax
+  80151a:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80151d:	eb 17                	jmp    801536 <strchr+0x3e>
+		if (*s == c)
+  80151f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801523:	0f b6 00             	movzbl (%rax),%eax
+  801526:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801529:	75 06                	jne    801531 <strchr+0x39>
+			return (char *) s;
+  80152b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80152f:	eb 15                	jmp    801546 <strchr+0x4e>
+	for (; *s; s++)
+  801531:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801536:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80153a:	0f b6 00             	movzbl (%rax),%eax
+  80153d:	84 c0                	test   %al,%al
+  80153f:	75 de                	jne    80151f <strchr+0x27>
+	return 0;
+  801541:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801546:	c9                   	leave
+  801547:	c3                   	ret
+
+0000000000801548 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801548:	55                   	push   %rbp
+  801549:	48 89 e5             	mov    %rsp,%rbp
+  80154c:	48 83 ec 10          	sub    $0x10,%rsp
+  801550:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801550 <strfind+0x8>
+  801557:	49 bb f0 7a 00 00 00 	movabs $0x7af0,%r11
+  80155e:	00 00 00 
+  801561:	4c 01 d8             	add    %r11,%rax
+  801564:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801568:	89 f0                	mov    %esi,%eax
+  80156a:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80156d:	eb 11                	jmp    801580 <strfind+0x38>
+		if (*s == c)
+  80156f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801573:	0f b6 00             	movzbl (%rax),%eax
+  801576:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801579:	74 12                	je     80158d <strfind+0x45>
+	for (; *s; s++)
+  80157b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801580:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801584:	0f b6 00             	movzbl (%rax),%eax
+  801587:	84 c0                	test   %al,%al
+  801589:	75 e4                	jne    80156f <strfind+0x27>
+  80158b:	eb 01                	jmp    80158e <strfind+0x46>
+			break;
+  80158d:	90                   	nop
+	return (char *) s;
+  80158e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801592:	c9                   	leave
+  801593:	c3                   	ret
+
+0000000000801594 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801594:	55                   	push   %rbp
+  801595:	48 89 e5             	mov    %rsp,%rbp
+  801598:	48 83 ec 18          	sub    $0x18,%rsp
+  80159c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80159c <memset+0x8>
+  8015a3:	49 bb a4 7a 00 00 00 	movabs $0x7aa4,%r11
+  8015aa:	00 00 00 
+  8015ad:	4c 01 d8             	add    %r11,%rax
+  8015b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015b4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8015b7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8015bb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8015c0:	75 06                	jne    8015c8 <memset+0x34>
+		return v;
+  8015c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c6:	eb 69                	jmp    801631 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8015c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015cc:	83 e0 03             	and    $0x3,%eax
+  8015cf:	48 85 c0             	test   %rax,%rax
+  8015d2:	75 48                	jne    80161c <memset+0x88>
+  8015d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015d8:	83 e0 03             	and    $0x3,%eax
+  8015db:	48 85 c0             	test   %rax,%rax
+  8015de:	75 3c                	jne    80161c <memset+0x88>
+		c &= 0xFF;
+  8015e0:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8015e7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015ea:	c1 e0 18             	shl    $0x18,%eax
+  8015ed:	89 c2                	mov    %eax,%edx
+  8015ef:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015f2:	c1 e0 10             	shl    $0x10,%eax
+  8015f5:	09 c2                	or     %eax,%edx
+  8015f7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015fa:	c1 e0 08             	shl    $0x8,%eax
+  8015fd:	09 d0                	or     %edx,%eax
+  8015ff:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801602:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801606:	48 c1 e8 02          	shr    $0x2,%rax
+  80160a:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  80160d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801611:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801614:	48 89 d7             	mov    %rdx,%rdi
+  801617:	fc                   	cld
+  801618:	f3 ab                	rep stos %eax,%es:(%rdi)
+  80161a:	eb 11                	jmp    80162d <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80161c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801620:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801623:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801627:	48 89 d7             	mov    %rdx,%rdi
+  80162a:	fc                   	cld
+  80162b:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  80162d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801631:	c9                   	leave
+  801632:	c3                   	ret
+
+0000000000801633 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801633:	55                   	push   %rbp
+  801634:	48 89 e5             	mov    %rsp,%rbp
+  801637:	48 83 ec 28          	sub    $0x28,%rsp
+  80163b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80163b <memmove+0x8>
+  801642:	49 bb 05 7a 00 00 00 	movabs $0x7a05,%r11
+  801649:	00 00 00 
+  80164c:	4c 01 d8             	add    %r11,%rax
+  80164f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801653:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801657:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80165b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80165f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801663:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801667:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80166b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80166f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801673:	0f 83 88 00 00 00    	jae    801701 <memmove+0xce>
+  801679:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80167d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801681:	48 01 d0             	add    %rdx,%rax
+  801684:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801688:	73 77                	jae    801701 <memmove+0xce>
+		s += n;
+  80168a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80168e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801692:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801696:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80169a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80169e:	83 e0 03             	and    $0x3,%eax
+  8016a1:	48 85 c0             	test   %rax,%rax
+  8016a4:	75 3b                	jne    8016e1 <memmove+0xae>
+  8016a6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016aa:	83 e0 03             	and    $0x3,%eax
+  8016ad:	48 85 c0             	test   %rax,%rax
+  8016b0:	75 2f                	jne    8016e1 <memmove+0xae>
+  8016b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016b6:	83 e0 03             	and    $0x3,%eax
+  8016b9:	48 85 c0             	test   %rax,%rax
+  8016bc:	75 23                	jne    8016e1 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8016be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016c2:	48 83 e8 04          	sub    $0x4,%rax
+  8016c6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016ca:	48 83 ea 04          	sub    $0x4,%rdx
+  8016ce:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8016d2:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8016d6:	48 89 c7             	mov    %rax,%rdi
+  8016d9:	48 89 d6             	mov    %rdx,%rsi
+  8016dc:	fd                   	std
+  8016dd:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8016df:	eb 1d                	jmp    8016fe <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8016e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016e5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ed:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8016f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016f5:	48 89 d7             	mov    %rdx,%rdi
+  8016f8:	48 89 c1             	mov    %rax,%rcx
+  8016fb:	fd                   	std
+  8016fc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8016fe:	fc                   	cld
+  8016ff:	eb 57                	jmp    801758 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801701:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801705:	83 e0 03             	and    $0x3,%eax
+  801708:	48 85 c0             	test   %rax,%rax
+  80170b:	75 36                	jne    801743 <memmove+0x110>
+  80170d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801711:	83 e0 03             	and    $0x3,%eax
+  801714:	48 85 c0             	test   %rax,%rax
+  801717:	75 2a                	jne    801743 <memmove+0x110>
+  801719:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80171d:	83 e0 03             	and    $0x3,%eax
+  801720:	48 85 c0             	test   %rax,%rax
+  801723:	75 1e                	jne    801743 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801725:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801729:	48 c1 e8 02          	shr    $0x2,%rax
+  80172d:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801730:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801734:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801738:	48 89 c7             	mov    %rax,%rdi
+  80173b:	48 89 d6             	mov    %rdx,%rsi
+  80173e:	fc                   	cld
+  80173f:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801741:	eb 15                	jmp    801758 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801743:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801747:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80174b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80174f:	48 89 c7             	mov    %rax,%rdi
+  801752:	48 89 d6             	mov    %rdx,%rsi
+  801755:	fc                   	cld
+  801756:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801758:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+
+000000000080175e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80175e:	55                   	push   %rbp
+  80175f:	48 89 e5             	mov    %rsp,%rbp
+  801762:	48 83 ec 18          	sub    $0x18,%rsp
+  801766:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801766 <memcpy+0x8>
+  80176d:	49 bb da 78 00 00 00 	movabs $0x78da,%r11
+  801774:	00 00 00 
+  801777:	4c 01 d8             	add    %r11,%rax
+  80177a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80177e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801782:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801786:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80178a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80178e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801792:	48 89 cf             	mov    %rcx,%rdi
+  801795:	48 b9 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rcx
+  80179c:	ff ff ff 
+  80179f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8017a3:	ff d0                	call   *%rax
+}
+  8017a5:	c9                   	leave
+  8017a6:	c3                   	ret
+
+00000000008017a7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8017a7:	55                   	push   %rbp
+  8017a8:	48 89 e5             	mov    %rsp,%rbp
+  8017ab:	48 83 ec 28          	sub    $0x28,%rsp
+  8017af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017af <memcmp+0x8>
+  8017b6:	49 bb 91 78 00 00 00 	movabs $0x7891,%r11
+  8017bd:	00 00 00 
+  8017c0:	4c 01 d8             	add    %r11,%rax
+  8017c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017cb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  8017cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  8017d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017db:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  8017df:	eb 34                	jmp    801815 <memcmp+0x6e>
+		if (*s1 != *s2)
+  8017e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017e5:	0f b6 10             	movzbl (%rax),%edx
+  8017e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ec:	0f b6 00             	movzbl (%rax),%eax
+  8017ef:	38 c2                	cmp    %al,%dl
+  8017f1:	74 18                	je     80180b <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  8017f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f7:	0f b6 00             	movzbl (%rax),%eax
+  8017fa:	0f b6 d0             	movzbl %al,%edx
+  8017fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801801:	0f b6 00             	movzbl (%rax),%eax
+  801804:	0f b6 c0             	movzbl %al,%eax
+  801807:	29 c2                	sub    %eax,%edx
+  801809:	eb 20                	jmp    80182b <memcmp+0x84>
+		s1++, s2++;
+  80180b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801810:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801815:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801819:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80181d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801821:	48 85 c0             	test   %rax,%rax
+  801824:	75 bb                	jne    8017e1 <memcmp+0x3a>
+	}
+
+	return 0;
+  801826:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80182b:	89 d0                	mov    %edx,%eax
+  80182d:	c9                   	leave
+  80182e:	c3                   	ret
+
+000000000080182f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80182f:	55                   	push   %rbp
+  801830:	48 89 e5             	mov    %rsp,%rbp
+  801833:	48 83 ec 28          	sub    $0x28,%rsp
+  801837:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801837 <memfind+0x8>
+  80183e:	49 bb 09 78 00 00 00 	movabs $0x7809,%r11
+  801845:	00 00 00 
+  801848:	4c 01 d8             	add    %r11,%rax
+  80184b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80184f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801852:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801856:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80185a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80185e:	48 01 d0             	add    %rdx,%rax
+  801861:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801865:	eb 13                	jmp    80187a <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801867:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80186b:	0f b6 00             	movzbl (%rax),%eax
+  80186e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801871:	38 d0                	cmp    %dl,%al
+  801873:	74 11                	je     801886 <memfind+0x57>
+	for (; s < ends; s++)
+  801875:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80187a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80187e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801882:	72 e3                	jb     801867 <memfind+0x38>
+  801884:	eb 01                	jmp    801887 <memfind+0x58>
+			break;
+  801886:	90                   	nop
+	return (void *) s;
+  801887:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80188b:	c9                   	leave
+  80188c:	c3                   	ret
+
+000000000080188d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80188d:	55                   	push   %rbp
+  80188e:	48 89 e5             	mov    %rsp,%rbp
+  801891:	48 83 ec 38          	sub    $0x38,%rsp
+  801895:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801895 <strtol+0x8>
+  80189c:	49 bb ab 77 00 00 00 	movabs $0x77ab,%r11
+  8018a3:	00 00 00 
+  8018a6:	4c 01 d8             	add    %r11,%rax
+  8018a9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8018ad:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8018b1:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8018b4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8018bb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8018c2:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8018c3:	eb 05                	jmp    8018ca <strtol+0x3d>
+		s++;
+  8018c5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8018ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ce:	0f b6 00             	movzbl (%rax),%eax
+  8018d1:	3c 20                	cmp    $0x20,%al
+  8018d3:	74 f0                	je     8018c5 <strtol+0x38>
+  8018d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d9:	0f b6 00             	movzbl (%rax),%eax
+  8018dc:	3c 09                	cmp    $0x9,%al
+  8018de:	74 e5                	je     8018c5 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  8018e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018e4:	0f b6 00             	movzbl (%rax),%eax
+  8018e7:	3c 2b                	cmp    $0x2b,%al
+  8018e9:	75 07                	jne    8018f2 <strtol+0x65>
+		s++;
+  8018eb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018f0:	eb 17                	jmp    801909 <strtol+0x7c>
+	else if (*s == '-')
+  8018f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f6:	0f b6 00             	movzbl (%rax),%eax
+  8018f9:	3c 2d                	cmp    $0x2d,%al
+  8018fb:	75 0c                	jne    801909 <strtol+0x7c>
+		s++, neg = 1;
+  8018fd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801902:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801909:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80190d:	74 06                	je     801915 <strtol+0x88>
+  80190f:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801913:	75 28                	jne    80193d <strtol+0xb0>
+  801915:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801919:	0f b6 00             	movzbl (%rax),%eax
+  80191c:	3c 30                	cmp    $0x30,%al
+  80191e:	75 1d                	jne    80193d <strtol+0xb0>
+  801920:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801924:	48 83 c0 01          	add    $0x1,%rax
+  801928:	0f b6 00             	movzbl (%rax),%eax
+  80192b:	3c 78                	cmp    $0x78,%al
+  80192d:	75 0e                	jne    80193d <strtol+0xb0>
+		s += 2, base = 16;
+  80192f:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801934:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80193b:	eb 2c                	jmp    801969 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  80193d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801941:	75 19                	jne    80195c <strtol+0xcf>
+  801943:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801947:	0f b6 00             	movzbl (%rax),%eax
+  80194a:	3c 30                	cmp    $0x30,%al
+  80194c:	75 0e                	jne    80195c <strtol+0xcf>
+		s++, base = 8;
+  80194e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801953:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80195a:	eb 0d                	jmp    801969 <strtol+0xdc>
+	else if (base == 0)
+  80195c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801960:	75 07                	jne    801969 <strtol+0xdc>
+		base = 10;
+  801962:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801969:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80196d:	0f b6 00             	movzbl (%rax),%eax
+  801970:	3c 2f                	cmp    $0x2f,%al
+  801972:	7e 1d                	jle    801991 <strtol+0x104>
+  801974:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801978:	0f b6 00             	movzbl (%rax),%eax
+  80197b:	3c 39                	cmp    $0x39,%al
+  80197d:	7f 12                	jg     801991 <strtol+0x104>
+			dig = *s - '0';
+  80197f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801983:	0f b6 00             	movzbl (%rax),%eax
+  801986:	0f be c0             	movsbl %al,%eax
+  801989:	83 e8 30             	sub    $0x30,%eax
+  80198c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80198f:	eb 4e                	jmp    8019df <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801991:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801995:	0f b6 00             	movzbl (%rax),%eax
+  801998:	3c 60                	cmp    $0x60,%al
+  80199a:	7e 1d                	jle    8019b9 <strtol+0x12c>
+  80199c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019a0:	0f b6 00             	movzbl (%rax),%eax
+  8019a3:	3c 7a                	cmp    $0x7a,%al
+  8019a5:	7f 12                	jg     8019b9 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  8019a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ab:	0f b6 00             	movzbl (%rax),%eax
+  8019ae:	0f be c0             	movsbl %al,%eax
+  8019b1:	83 e8 57             	sub    $0x57,%eax
+  8019b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019b7:	eb 26                	jmp    8019df <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  8019b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019bd:	0f b6 00             	movzbl (%rax),%eax
+  8019c0:	3c 40                	cmp    $0x40,%al
+  8019c2:	7e 47                	jle    801a0b <strtol+0x17e>
+  8019c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c8:	0f b6 00             	movzbl (%rax),%eax
+  8019cb:	3c 5a                	cmp    $0x5a,%al
+  8019cd:	7f 3c                	jg     801a0b <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  8019cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d3:	0f b6 00             	movzbl (%rax),%eax
+  8019d6:	0f be c0             	movsbl %al,%eax
+  8019d9:	83 e8 37             	sub    $0x37,%eax
+  8019dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  8019df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019e2:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8019e5:	7d 23                	jge    801a0a <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  8019e7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019ec:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8019ef:	48 98                	cltq
+  8019f1:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8019f6:	48 89 c2             	mov    %rax,%rdx
+  8019f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019fc:	48 98                	cltq
+  8019fe:	48 01 d0             	add    %rdx,%rax
+  801a01:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801a05:	e9 5f ff ff ff       	jmp    801969 <strtol+0xdc>
+			break;
+  801a0a:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801a0b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801a10:	74 0b                	je     801a1d <strtol+0x190>
+		*endptr = (char *) s;
+  801a12:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a16:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801a1a:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801a1d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a21:	74 09                	je     801a2c <strtol+0x19f>
+  801a23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a27:	48 f7 d8             	neg    %rax
+  801a2a:	eb 04                	jmp    801a30 <strtol+0x1a3>
+  801a2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801a30:	c9                   	leave
+  801a31:	c3                   	ret
+
+0000000000801a32 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801a32:	55                   	push   %rbp
+  801a33:	48 89 e5             	mov    %rsp,%rbp
+  801a36:	53                   	push   %rbx
+  801a37:	48 83 ec 30          	sub    $0x30,%rsp
+  801a3b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801a3b <strstr+0x9>
+  801a42:	49 bb 05 76 00 00 00 	movabs $0x7605,%r11
+  801a49:	00 00 00 
+  801a4c:	4c 01 db             	add    %r11,%rbx
+  801a4f:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801a53:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801a57:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a5b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a5f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a63:	0f b6 00             	movzbl (%rax),%eax
+  801a66:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801a69:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801a6d:	75 06                	jne    801a75 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801a6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a73:	eb 73                	jmp    801ae8 <strstr+0xb6>
+
+	len = strlen(str);
+  801a75:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a79:	48 89 c7             	mov    %rax,%rdi
+  801a7c:	48 b8 7f 81 ff ff ff 	movabs $0xffffffffffff817f,%rax
+  801a83:	ff ff ff 
+  801a86:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a8a:	ff d0                	call   *%rax
+  801a8c:	48 98                	cltq
+  801a8e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801a92:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a96:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a9a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a9e:	0f b6 00             	movzbl (%rax),%eax
+  801aa1:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801aa4:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801aa8:	75 07                	jne    801ab1 <strstr+0x7f>
+				return (char *) 0;
+  801aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aaf:	eb 37                	jmp    801ae8 <strstr+0xb6>
+		} while (sc != c);
+  801ab1:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801ab5:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801ab8:	75 d8                	jne    801a92 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801aba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801abe:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801ac2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ac6:	48 89 ce             	mov    %rcx,%rsi
+  801ac9:	48 89 c7             	mov    %rax,%rdi
+  801acc:	48 b8 33 84 ff ff ff 	movabs $0xffffffffffff8433,%rax
+  801ad3:	ff ff ff 
+  801ad6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ada:	ff d0                	call   *%rax
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	75 b2                	jne    801a92 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801ae0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae4:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801ae8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aec:	c9                   	leave
+  801aed:	c3                   	ret
+
+0000000000801aee <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801aee:	55                   	push   %rbp
+  801aef:	48 89 e5             	mov    %rsp,%rbp
+  801af2:	41 57                	push   %r15
+  801af4:	53                   	push   %rbx
+  801af5:	48 83 ec 40          	sub    $0x40,%rsp
+  801af9:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801af9 <syscall+0xb>
+  801b00:	49 bb 47 75 00 00 00 	movabs $0x7547,%r11
+  801b07:	00 00 00 
+  801b0a:	4d 01 da             	add    %r11,%r10
+  801b0d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801b10:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801b13:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b17:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b1b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801b1f:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801b23:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b26:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801b2a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801b2e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801b32:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b36:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801b3a:	4c 89 c3             	mov    %r8,%rbx
+  801b3d:	cd 30                	int    $0x30
+  801b3f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801b43:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801b47:	74 52                	je     801b9b <syscall+0xad>
+  801b49:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b4e:	7e 4b                	jle    801b9b <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b50:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b54:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b57:	49 89 d0             	mov    %rdx,%r8
+  801b5a:	89 c1                	mov    %eax,%ecx
+  801b5c:	48 b8 a0 e0 ff ff ff 	movabs $0xffffffffffffe0a0,%rax
+  801b63:	ff ff ff 
+  801b66:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801b6a:	48 89 c2             	mov    %rax,%rdx
+  801b6d:	be 23 00 00 00       	mov    $0x23,%esi
+  801b72:	48 b8 bd e0 ff ff ff 	movabs $0xffffffffffffe0bd,%rax
+  801b79:	ff ff ff 
+  801b7c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801b80:	48 89 c7             	mov    %rax,%rdi
+  801b83:	4d 89 d7             	mov    %r10,%r15
+  801b86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b8b:	49 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%r9
+  801b92:	ff ff ff 
+  801b95:	4d 01 d1             	add    %r10,%r9
+  801b98:	41 ff d1             	call   *%r9
+
+	return ret;
+  801b9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b9f:	48 83 c4 40          	add    $0x40,%rsp
+  801ba3:	5b                   	pop    %rbx
+  801ba4:	41 5f                	pop    %r15
+  801ba6:	5d                   	pop    %rbp
+  801ba7:	c3                   	ret
+
+0000000000801ba8 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801ba8:	55                   	push   %rbp
+  801ba9:	48 89 e5             	mov    %rsp,%rbp
+  801bac:	41 57                	push   %r15
+  801bae:	41 56                	push   %r14
+  801bb0:	41 55                	push   %r13
+  801bb2:	41 54                	push   %r12
+  801bb4:	53                   	push   %rbx
+  801bb5:	48 83 ec 48          	sub    $0x48,%rsp
+  801bb9:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801bb9 <syscall_words+0x11>
+  801bc0:	49 bb 87 74 00 00 00 	movabs $0x7487,%r11
+  801bc7:	00 00 00 
+  801bca:	4d 01 de             	add    %r11,%r14
+  801bcd:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801bd0:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801bd3:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801bd7:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801bdb:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801bdf:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801be3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801be8:	74 09                	je     801bf3 <syscall_words+0x4b>
+  801bea:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bee:	48 8b 00             	mov    (%rax),%rax
+  801bf1:	eb 05                	jmp    801bf8 <syscall_words+0x50>
+  801bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf8:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801bfb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c00:	74 0a                	je     801c0c <syscall_words+0x64>
+  801c02:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c06:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c0a:	eb 05                	jmp    801c11 <syscall_words+0x69>
+  801c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c11:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801c14:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c19:	74 0a                	je     801c25 <syscall_words+0x7d>
+  801c1b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c1f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c23:	eb 05                	jmp    801c2a <syscall_words+0x82>
+  801c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2a:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801c2d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c32:	74 0a                	je     801c3e <syscall_words+0x96>
+  801c34:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c38:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c3c:	eb 05                	jmp    801c43 <syscall_words+0x9b>
+  801c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c43:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801c46:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c4b:	74 0a                	je     801c57 <syscall_words+0xaf>
+  801c4d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c51:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c55:	eb 05                	jmp    801c5c <syscall_words+0xb4>
+  801c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5c:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801c5f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c64:	74 0a                	je     801c70 <syscall_words+0xc8>
+  801c66:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c6a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801c6e:	eb 05                	jmp    801c75 <syscall_words+0xcd>
+  801c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c75:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801c78:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801c7b:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801c7f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c83:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801c87:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801c8b:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801c8f:	cd 30                	int    $0x30
+  801c91:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801c95:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c9a:	74 50                	je     801cec <syscall_words+0x144>
+		words[0] = r8;
+  801c9c:	4c 89 c2             	mov    %r8,%rdx
+  801c9f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ca3:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801ca6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801caa:	48 83 c0 08          	add    $0x8,%rax
+  801cae:	4c 89 ca             	mov    %r9,%rdx
+  801cb1:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801cb4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cb8:	48 83 c0 10          	add    $0x10,%rax
+  801cbc:	4c 89 d2             	mov    %r10,%rdx
+  801cbf:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801cc2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cc6:	48 83 c0 18          	add    $0x18,%rax
+  801cca:	4c 89 da             	mov    %r11,%rdx
+  801ccd:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801cd0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cd4:	48 83 c0 20          	add    $0x20,%rax
+  801cd8:	4c 89 e2             	mov    %r12,%rdx
+  801cdb:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801cde:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ce2:	48 83 c0 28          	add    $0x28,%rax
+  801ce6:	4c 89 ea             	mov    %r13,%rdx
+  801ce9:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801cec:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801cf0:	74 52                	je     801d44 <syscall_words+0x19c>
+  801cf2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801cf7:	7e 4b                	jle    801d44 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801cf9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801cfd:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801d00:	49 89 d0             	mov    %rdx,%r8
+  801d03:	89 c1                	mov    %eax,%ecx
+  801d05:	48 b8 a0 e0 ff ff ff 	movabs $0xffffffffffffe0a0,%rax
+  801d0c:	ff ff ff 
+  801d0f:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801d13:	48 89 c2             	mov    %rax,%rdx
+  801d16:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801d1b:	48 b8 bd e0 ff ff ff 	movabs $0xffffffffffffe0bd,%rax
+  801d22:	ff ff ff 
+  801d25:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801d29:	48 89 c7             	mov    %rax,%rdi
+  801d2c:	4d 89 f7             	mov    %r14,%r15
+  801d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d34:	49 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%r9
+  801d3b:	ff ff ff 
+  801d3e:	4d 01 f1             	add    %r14,%r9
+  801d41:	41 ff d1             	call   *%r9
+
+	return ret;
+  801d44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801d48:	48 83 c4 48          	add    $0x48,%rsp
+  801d4c:	5b                   	pop    %rbx
+  801d4d:	41 5c                	pop    %r12
+  801d4f:	41 5d                	pop    %r13
+  801d51:	41 5e                	pop    %r14
+  801d53:	41 5f                	pop    %r15
+  801d55:	5d                   	pop    %rbp
+  801d56:	c3                   	ret
+
+0000000000801d57 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801d57:	55                   	push   %rbp
+  801d58:	48 89 e5             	mov    %rsp,%rbp
+  801d5b:	48 83 ec 10          	sub    $0x10,%rsp
+  801d5f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d5f <sys_cputs+0x8>
+  801d66:	49 bb e1 72 00 00 00 	movabs $0x72e1,%r11
+  801d6d:	00 00 00 
+  801d70:	4c 01 d8             	add    %r11,%rax
+  801d73:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d77:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801d7b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d7f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d83:	48 83 ec 08          	sub    $0x8,%rsp
+  801d87:	6a 00                	push   $0x0
+  801d89:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d95:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d9f:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  801da6:	ff ff ff 
+  801da9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801dad:	ff d0                	call   *%rax
+  801daf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801db3:	90                   	nop
+  801db4:	c9                   	leave
+  801db5:	c3                   	ret
+
+0000000000801db6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801db6:	55                   	push   %rbp
+  801db7:	48 89 e5             	mov    %rsp,%rbp
+  801dba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dba <sys_cgetc+0x4>
+  801dc1:	49 bb 86 72 00 00 00 	movabs $0x7286,%r11
+  801dc8:	00 00 00 
+  801dcb:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801dce:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd2:	6a 00                	push   $0x0
+  801dd4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801de0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801de5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dea:	be 00 00 00 00       	mov    $0x0,%esi
+  801def:	bf 01 00 00 00       	mov    $0x1,%edi
+  801df4:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  801dfb:	ff ff ff 
+  801dfe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e02:	ff d0                	call   *%rax
+  801e04:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e08:	c9                   	leave
+  801e09:	c3                   	ret
+
+0000000000801e0a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801e0a:	55                   	push   %rbp
+  801e0b:	48 89 e5             	mov    %rsp,%rbp
+  801e0e:	48 83 ec 10          	sub    $0x10,%rsp
+  801e12:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e12 <sys_env_destroy+0x8>
+  801e19:	49 bb 2e 72 00 00 00 	movabs $0x722e,%r11
+  801e20:	00 00 00 
+  801e23:	4c 01 d8             	add    %r11,%rax
+  801e26:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e29:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801e2c:	48 63 d2             	movslq %edx,%rdx
+  801e2f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e33:	6a 00                	push   $0x0
+  801e35:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e41:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e46:	be 01 00 00 00       	mov    $0x1,%esi
+  801e4b:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e50:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  801e57:	ff ff ff 
+  801e5a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e5e:	ff d0                	call   *%rax
+  801e60:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e64:	c9                   	leave
+  801e65:	c3                   	ret
+
+0000000000801e66 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801e66:	55                   	push   %rbp
+  801e67:	48 89 e5             	mov    %rsp,%rbp
+  801e6a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e6a <sys_getenvid+0x4>
+  801e71:	49 bb d6 71 00 00 00 	movabs $0x71d6,%r11
+  801e78:	00 00 00 
+  801e7b:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801e7e:	48 83 ec 08          	sub    $0x8,%rsp
+  801e82:	6a 00                	push   $0x0
+  801e84:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e8a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e9a:	be 00 00 00 00       	mov    $0x0,%esi
+  801e9f:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ea4:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  801eab:	ff ff ff 
+  801eae:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801eb2:	ff d0                	call   *%rax
+  801eb4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eb8:	c9                   	leave
+  801eb9:	c3                   	ret
+
+0000000000801eba <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801eba:	55                   	push   %rbp
+  801ebb:	48 89 e5             	mov    %rsp,%rbp
+  801ebe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ebe <sys_yield+0x4>
+  801ec5:	49 bb 82 71 00 00 00 	movabs $0x7182,%r11
+  801ecc:	00 00 00 
+  801ecf:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801ed2:	48 83 ec 08          	sub    $0x8,%rsp
+  801ed6:	6a 00                	push   $0x0
+  801ed8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ede:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ee4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eee:	be 00 00 00 00       	mov    $0x0,%esi
+  801ef3:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801ef8:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  801eff:	ff ff ff 
+  801f02:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f06:	ff d0                	call   *%rax
+  801f08:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f0c:	90                   	nop
+  801f0d:	c9                   	leave
+  801f0e:	c3                   	ret
+
+0000000000801f0f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801f0f:	55                   	push   %rbp
+  801f10:	48 89 e5             	mov    %rsp,%rbp
+  801f13:	48 83 ec 10          	sub    $0x10,%rsp
+  801f17:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f17 <sys_page_alloc+0x8>
+  801f1e:	49 bb 29 71 00 00 00 	movabs $0x7129,%r11
+  801f25:	00 00 00 
+  801f28:	4c 01 d8             	add    %r11,%rax
+  801f2b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f2e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f32:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801f35:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801f38:	48 63 f2             	movslq %edx,%rsi
+  801f3b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f3f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f42:	48 63 d2             	movslq %edx,%rdx
+  801f45:	48 83 ec 08          	sub    $0x8,%rsp
+  801f49:	6a 00                	push   $0x0
+  801f4b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f51:	49 89 f0             	mov    %rsi,%r8
+  801f54:	be 01 00 00 00       	mov    $0x1,%esi
+  801f59:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f5e:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  801f65:	ff ff ff 
+  801f68:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f6c:	ff d0                	call   *%rax
+  801f6e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f72:	c9                   	leave
+  801f73:	c3                   	ret
+
+0000000000801f74 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801f74:	55                   	push   %rbp
+  801f75:	48 89 e5             	mov    %rsp,%rbp
+  801f78:	48 83 ec 20          	sub    $0x20,%rsp
+  801f7c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f7c <sys_page_map+0x8>
+  801f83:	49 bb c4 70 00 00 00 	movabs $0x70c4,%r11
+  801f8a:	00 00 00 
+  801f8d:	4c 01 d8             	add    %r11,%rax
+  801f90:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f93:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f97:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801f9a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f9e:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801fa2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801fa5:	48 63 f2             	movslq %edx,%rsi
+  801fa8:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  801fac:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801faf:	48 63 fa             	movslq %edx,%rdi
+  801fb2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fb6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fb9:	48 63 d2             	movslq %edx,%rdx
+  801fbc:	48 83 ec 08          	sub    $0x8,%rsp
+  801fc0:	56                   	push   %rsi
+  801fc1:	4d 89 c1             	mov    %r8,%r9
+  801fc4:	49 89 f8             	mov    %rdi,%r8
+  801fc7:	be 01 00 00 00       	mov    $0x1,%esi
+  801fcc:	bf 05 00 00 00       	mov    $0x5,%edi
+  801fd1:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  801fd8:	ff ff ff 
+  801fdb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fdf:	ff d0                	call   *%rax
+  801fe1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fe5:	c9                   	leave
+  801fe6:	c3                   	ret
+
+0000000000801fe7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801fe7:	55                   	push   %rbp
+  801fe8:	48 89 e5             	mov    %rsp,%rbp
+  801feb:	48 83 ec 10          	sub    $0x10,%rsp
+  801fef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fef <sys_page_unmap+0x8>
+  801ff6:	49 bb 51 70 00 00 00 	movabs $0x7051,%r11
+  801ffd:	00 00 00 
+  802000:	4c 01 d8             	add    %r11,%rax
+  802003:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802006:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  80200a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80200e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802011:	48 63 d2             	movslq %edx,%rdx
+  802014:	48 83 ec 08          	sub    $0x8,%rsp
+  802018:	6a 00                	push   $0x0
+  80201a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802020:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802026:	be 01 00 00 00       	mov    $0x1,%esi
+  80202b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802030:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  802037:	ff ff ff 
+  80203a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80203e:	ff d0                	call   *%rax
+  802040:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802044:	c9                   	leave
+  802045:	c3                   	ret
+
+0000000000802046 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802046:	55                   	push   %rbp
+  802047:	48 89 e5             	mov    %rsp,%rbp
+  80204a:	48 83 ec 10          	sub    $0x10,%rsp
+  80204e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80204e <sys_env_set_status+0x8>
+  802055:	49 bb f2 6f 00 00 00 	movabs $0x6ff2,%r11
+  80205c:	00 00 00 
+  80205f:	4c 01 d8             	add    %r11,%rax
+  802062:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802065:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802068:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80206b:	48 63 ca             	movslq %edx,%rcx
+  80206e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802071:	48 63 d2             	movslq %edx,%rdx
+  802074:	48 83 ec 08          	sub    $0x8,%rsp
+  802078:	6a 00                	push   $0x0
+  80207a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802080:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802086:	be 01 00 00 00       	mov    $0x1,%esi
+  80208b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802090:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  802097:	ff ff ff 
+  80209a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80209e:	ff d0                	call   *%rax
+  8020a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020a4:	c9                   	leave
+  8020a5:	c3                   	ret
+
+00000000008020a6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8020a6:	55                   	push   %rbp
+  8020a7:	48 89 e5             	mov    %rsp,%rbp
+  8020aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020ae <sys_env_set_trapframe+0x8>
+  8020b5:	49 bb 92 6f 00 00 00 	movabs $0x6f92,%r11
+  8020bc:	00 00 00 
+  8020bf:	4c 01 d8             	add    %r11,%rax
+  8020c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8020c9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020cd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020d0:	48 63 d2             	movslq %edx,%rdx
+  8020d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8020d7:	6a 00                	push   $0x0
+  8020d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8020ea:	bf 09 00 00 00       	mov    $0x9,%edi
+  8020ef:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  8020f6:	ff ff ff 
+  8020f9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020fd:	ff d0                	call   *%rax
+  8020ff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802103:	c9                   	leave
+  802104:	c3                   	ret
+
+0000000000802105 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802105:	55                   	push   %rbp
+  802106:	48 89 e5             	mov    %rsp,%rbp
+  802109:	48 83 ec 10          	sub    $0x10,%rsp
+  80210d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80210d <sys_env_set_pgfault_upcall+0x8>
+  802114:	49 bb 33 6f 00 00 00 	movabs $0x6f33,%r11
+  80211b:	00 00 00 
+  80211e:	4c 01 d8             	add    %r11,%rax
+  802121:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802124:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802128:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80212c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80212f:	48 63 d2             	movslq %edx,%rdx
+  802132:	48 83 ec 08          	sub    $0x8,%rsp
+  802136:	6a 00                	push   $0x0
+  802138:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80213e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802144:	be 01 00 00 00       	mov    $0x1,%esi
+  802149:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80214e:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  802155:	ff ff ff 
+  802158:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80215c:	ff d0                	call   *%rax
+  80215e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802162:	c9                   	leave
+  802163:	c3                   	ret
+
+0000000000802164 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+  802168:	48 83 ec 20          	sub    $0x20,%rsp
+  80216c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80216c <sys_ipc_try_send+0x8>
+  802173:	49 bb d4 6e 00 00 00 	movabs $0x6ed4,%r11
+  80217a:	00 00 00 
+  80217d:	4c 01 d8             	add    %r11,%rax
+  802180:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802183:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802187:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80218b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80218e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802191:	48 63 fa             	movslq %edx,%rdi
+  802194:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802198:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80219b:	48 63 d2             	movslq %edx,%rdx
+  80219e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a6:	6a 00                	push   $0x0
+  8021a8:	49 89 f9             	mov    %rdi,%r9
+  8021ab:	49 89 f0             	mov    %rsi,%r8
+  8021ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b3:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021b8:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  8021bf:	ff ff ff 
+  8021c2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021c6:	ff d0                	call   *%rax
+  8021c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021cc:	c9                   	leave
+  8021cd:	c3                   	ret
+
+00000000008021ce <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8021ce:	55                   	push   %rbp
+  8021cf:	48 89 e5             	mov    %rsp,%rbp
+  8021d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8021d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021d6 <sys_ipc_send+0x8>
+  8021dd:	49 bb 6a 6e 00 00 00 	movabs $0x6e6a,%r11
+  8021e4:	00 00 00 
+  8021e7:	4c 01 d8             	add    %r11,%rax
+  8021ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021ed:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021f1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021f5:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8021f8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021fb:	48 63 fa             	movslq %edx,%rdi
+  8021fe:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802202:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802205:	48 63 d2             	movslq %edx,%rdx
+  802208:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80220c:	48 83 ec 08          	sub    $0x8,%rsp
+  802210:	6a 00                	push   $0x0
+  802212:	49 89 f9             	mov    %rdi,%r9
+  802215:	49 89 f0             	mov    %rsi,%r8
+  802218:	be 00 00 00 00       	mov    $0x0,%esi
+  80221d:	bf 17 00 00 00       	mov    $0x17,%edi
+  802222:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  802229:	ff ff ff 
+  80222c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802230:	ff d0                	call   *%rax
+  802232:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802236:	c9                   	leave
+  802237:	c3                   	ret
+
+0000000000802238 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802238:	55                   	push   %rbp
+  802239:	48 89 e5             	mov    %rsp,%rbp
+  80223c:	48 83 ec 10          	sub    $0x10,%rsp
+  802240:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802240 <sys_ipc_recv+0x8>
+  802247:	49 bb 00 6e 00 00 00 	movabs $0x6e00,%r11
+  80224e:	00 00 00 
+  802251:	4c 01 d8             	add    %r11,%rax
+  802254:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802258:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80225c:	6a 00                	push   $0x0
+  80225e:	6a 00                	push   $0x0
+  802260:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802266:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80226c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802271:	be 01 00 00 00       	mov    $0x1,%esi
+  802276:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80227b:	49 ba 68 8b ff ff ff 	movabs $0xffffffffffff8b68,%r10
+  802282:	ff ff ff 
+  802285:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802289:	ff d0                	call   *%rax
+  80228b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80228f:	c9                   	leave
+  802290:	c3                   	ret
+
+0000000000802291 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802291:	55                   	push   %rbp
+  802292:	48 89 e5             	mov    %rsp,%rbp
+  802295:	48 83 ec 30          	sub    $0x30,%rsp
+  802299:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802299 <sys_ipc_call+0x8>
+  8022a0:	49 bb a7 6d 00 00 00 	movabs $0x6da7,%r11
+  8022a7:	00 00 00 
+  8022aa:	4c 01 d8             	add    %r11,%rax
+  8022ad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022b4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8022b8:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8022bb:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8022bf:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8022c3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8022c7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022ca:	4c 63 c2             	movslq %edx,%r8
+  8022cd:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8022d1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022d4:	48 63 d2             	movslq %edx,%rdx
+  8022d7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022db:	ff 75 d8             	push   -0x28(%rbp)
+  8022de:	56                   	push   %rsi
+  8022df:	4d 89 c1             	mov    %r8,%r9
+  8022e2:	49 89 f8             	mov    %rdi,%r8
+  8022e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ea:	bf 18 00 00 00       	mov    $0x18,%edi
+  8022ef:	49 ba 68 8b ff ff ff 	movabs $0xffffffffffff8b68,%r10
+  8022f6:	ff ff ff 
+  8022f9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022fd:	ff d0                	call   *%rax
+  8022ff:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802303:	c9                   	leave
+  802304:	c3                   	ret
+
+0000000000802305 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802305:	55                   	push   %rbp
+  802306:	48 89 e5             	mov    %rsp,%rbp
+  802309:	48 83 ec 30          	sub    $0x30,%rsp
+  80230d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80230d <sys_ipc_reply_recv+0x8>
+  802314:	49 bb 33 6d 00 00 00 	movabs $0x6d33,%r11
+  80231b:	00 00 00 
+  80231e:	4c 01 d8             	add    %r11,%rax
+  802321:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802324:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802328:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80232c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80232f:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802333:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802337:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80233b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80233e:	4c 63 c2             	movslq %edx,%r8
+  802341:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802345:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802348:	48 63 d2             	movslq %edx,%rdx
+  80234b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80234f:	ff 75 d8             	push   -0x28(%rbp)
+  802352:	56                   	push   %rsi
+  802353:	4d 89 c1             	mov    %r8,%r9
+  802356:	49 89 f8             	mov    %rdi,%r8
+  802359:	be 00 00 00 00       	mov    $0x0,%esi
+  80235e:	bf 19 00 00 00       	mov    $0x19,%edi
+  802363:	49 ba 68 8b ff ff ff 	movabs $0xffffffffffff8b68,%r10
+  80236a:	ff ff ff 
+  80236d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802371:	ff d0                	call   *%rax
+  802373:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802377:	c9                   	leave
+  802378:	c3                   	ret
+
+0000000000802379 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802379:	55                   	push   %rbp
+  80237a:	48 89 e5             	mov    %rsp,%rbp
+  80237d:	48 83 ec 10          	sub    $0x10,%rsp
+  802381:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802381 <sys_env_set_priority+0x8>
+  802388:	49 bb bf 6c 00 00 00 	movabs $0x6cbf,%r11
+  80238f:	00 00 00 
+  802392:	4c 01 d8             	add    %r11,%rax
+  802395:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802398:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80239b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80239e:	48 63 ca             	movslq %edx,%rcx
+  8023a1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023a4:	48 63 d2             	movslq %edx,%rdx
+  8023a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ab:	6a 00                	push   $0x0
+  8023ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8023be:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8023c3:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  8023ca:	ff ff ff 
+  8023cd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023d1:	ff d0                	call   *%rax
+  8023d3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023d7:	c9                   	leave
+  8023d8:	c3                   	ret
+
+00000000008023d9 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8023d9:	55                   	push   %rbp
+  8023da:	48 89 e5             	mov    %rsp,%rbp
+  8023dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023e1 <sys_env_set_affinity+0x8>
+  8023e8:	49 bb 5f 6c 00 00 00 	movabs $0x6c5f,%r11
+  8023ef:	00 00 00 
+  8023f2:	4c 01 d8             	add    %r11,%rax
+  8023f5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023f8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8023fb:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8023fe:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802401:	48 63 d2             	movslq %edx,%rdx
+  802404:	48 83 ec 08          	sub    $0x8,%rsp
+  802408:	6a 00                	push   $0x0
+  80240a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802410:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802416:	be 01 00 00 00       	mov    $0x1,%esi
+  80241b:	bf 10 00 00 00       	mov    $0x10,%edi
+  802420:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  802427:	ff ff ff 
+  80242a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80242e:	ff d0                	call   *%rax
+  802430:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802434:	c9                   	leave
+  802435:	c3                   	ret
+
+0000000000802436 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802436:	55                   	push   %rbp
+  802437:	48 89 e5             	mov    %rsp,%rbp
+  80243a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80243a <sys_time_msec+0x4>
+  802441:	49 bb 06 6c 00 00 00 	movabs $0x6c06,%r11
+  802448:	00 00 00 
+  80244b:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80244e:	48 83 ec 08          	sub    $0x8,%rsp
+  802452:	6a 00                	push   $0x0
+  802454:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80245a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802465:	ba 00 00 00 00       	mov    $0x0,%edx
+  80246a:	be 00 00 00 00       	mov    $0x0,%esi
+  80246f:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802474:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  80247b:	ff ff ff 
+  80247e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802482:	ff d0                	call   *%rax
+  802484:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802488:	c9                   	leave
+  802489:	c3                   	ret
+
+000000000080248a <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80248a:	55                   	push   %rbp
+  80248b:	48 89 e5             	mov    %rsp,%rbp
+  80248e:	48 83 ec 10          	sub    $0x10,%rsp
+  802492:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802492 <sys_sleep_usec+0x8>
+  802499:	49 bb ae 6b 00 00 00 	movabs $0x6bae,%r11
+  8024a0:	00 00 00 
+  8024a3:	4c 01 d8             	add    %r11,%rax
+  8024a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8024aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b2:	6a 00                	push   $0x0
+  8024b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ca:	bf 11 00 00 00       	mov    $0x11,%edi
+  8024cf:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  8024d6:	ff ff ff 
+  8024d9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024dd:	ff d0                	call   *%rax
+  8024df:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e3:	c9                   	leave
+  8024e4:	c3                   	ret
+
+00000000008024e5 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8024ed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024ed <sys_page_alloc_huge+0x8>
+  8024f4:	49 bb 53 6b 00 00 00 	movabs $0x6b53,%r11
+  8024fb:	00 00 00 
+  8024fe:	4c 01 d8             	add    %r11,%rax
+  802501:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802504:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802508:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  80250b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80250e:	48 63 f2             	movslq %edx,%rsi
+  802511:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802515:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802518:	48 63 d2             	movslq %edx,%rdx
+  80251b:	48 83 ec 08          	sub    $0x8,%rsp
+  80251f:	6a 00                	push   $0x0
+  802521:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802527:	49 89 f0             	mov    %rsi,%r8
+  80252a:	be 01 00 00 00       	mov    $0x1,%esi
+  80252f:	bf 12 00 00 00       	mov    $0x12,%edi
+  802534:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  80253b:	ff ff ff 
+  80253e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802542:	ff d0                	call   *%rax
+  802544:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802548:	c9                   	leave
+  802549:	c3                   	ret
+
+000000000080254a <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80254a:	55                   	push   %rbp
+  80254b:	48 89 e5             	mov    %rsp,%rbp
+  80254e:	48 83 ec 10          	sub    $0x10,%rsp
+  802552:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802552 <sys_page_map_batch+0x8>
+  802559:	49 bb ee 6a 00 00 00 	movabs $0x6aee,%r11
+  802560:	00 00 00 
+  802563:	4c 01 d8             	add    %r11,%rax
+  802566:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80256a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80256e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802572:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802576:	48 83 ec 08          	sub    $0x8,%rsp
+  80257a:	6a 00                	push   $0x0
+  80257c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802582:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802588:	be 01 00 00 00       	mov    $0x1,%esi
+  80258d:	bf 13 00 00 00       	mov    $0x13,%edi
+  802592:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  802599:	ff ff ff 
+  80259c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025a0:	ff d0                	call   *%rax
+  8025a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a6:	c9                   	leave
+  8025a7:	c3                   	ret
+
+00000000008025a8 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8025a8:	55                   	push   %rbp
+  8025a9:	48 89 e5             	mov    %rsp,%rbp
+  8025ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025b0 <sys_page_alloc_batch+0x8>
+  8025b7:	49 bb 90 6a 00 00 00 	movabs $0x6a90,%r11
+  8025be:	00 00 00 
+  8025c1:	4c 01 d8             	add    %r11,%rax
+  8025c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8025cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025d0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d8:	6a 00                	push   $0x0
+  8025da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8025eb:	bf 14 00 00 00       	mov    $0x14,%edi
+  8025f0:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  8025f7:	ff ff ff 
+  8025fa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025fe:	ff d0                	call   *%rax
+  802600:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802604:	c9                   	leave
+  802605:	c3                   	ret
+
+0000000000802606 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802606:	55                   	push   %rbp
+  802607:	48 89 e5             	mov    %rsp,%rbp
+  80260a:	48 83 ec 10          	sub    $0x10,%rsp
+  80260e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80260e <sys_page_unmap_batch+0x8>
+  802615:	49 bb 32 6a 00 00 00 	movabs $0x6a32,%r11
+  80261c:	00 00 00 
+  80261f:	4c 01 d8             	add    %r11,%rax
+  802622:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802626:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80262a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80262e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802632:	48 83 ec 08          	sub    $0x8,%rsp
+  802636:	6a 00                	push   $0x0
+  802638:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80263e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802644:	be 01 00 00 00       	mov    $0x1,%esi
+  802649:	bf 15 00 00 00       	mov    $0x15,%edi
+  80264e:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  802655:	ff ff ff 
+  802658:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80265c:	ff d0                	call   *%rax
+  80265e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802662:	c9                   	leave
+  802663:	c3                   	ret
+
+0000000000802664 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802664:	55                   	push   %rbp
+  802665:	48 89 e5             	mov    %rsp,%rbp
+  802668:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802668 <sys_fork+0x4>
+  80266f:	49 bb d8 69 00 00 00 	movabs $0x69d8,%r11
+  802676:	00 00 00 
+  802679:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80267c:	48 83 ec 08          	sub    $0x8,%rsp
+  802680:	6a 00                	push   $0x0
+  802682:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802688:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80268e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802693:	ba 00 00 00 00       	mov    $0x0,%edx
+  802698:	be 00 00 00 00       	mov    $0x0,%esi
+  80269d:	bf 16 00 00 00       	mov    $0x16,%edi
+  8026a2:	49 ba ae 8a ff ff ff 	movabs $0xffffffffffff8aae,%r10
+  8026a9:	ff ff ff 
+  8026ac:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026b0:	ff d0                	call   *%rax
+  8026b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b6:	c9                   	leave
+  8026b7:	c3                   	ret
+
+00000000008026b8 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8026b8:	55                   	push   %rbp
+  8026b9:	48 89 e5             	mov    %rsp,%rbp
+  8026bc:	41 57                	push   %r15
+  8026be:	53                   	push   %rbx
+  8026bf:	48 83 ec 40          	sub    $0x40,%rsp
+  8026c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8026c3 <pgfault+0xb>
+  8026ca:	49 bb 7d 69 00 00 00 	movabs $0x697d,%r11
+  8026d1:	00 00 00 
+  8026d4:	4c 01 db             	add    %r11,%rbx
+  8026d7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  8026db:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8026df:	48 8b 00             	mov    (%rax),%rax
+  8026e2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  8026e6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8026ea:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026ee:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  8026f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026f5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8026f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026fd:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802703:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802707:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80270a:	83 e0 02             	and    $0x2,%eax
+  80270d:	85 c0                	test   %eax,%eax
+  80270f:	0f 84 91 03 00 00    	je     802aa6 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802715:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802719:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80271d:	48 89 c2             	mov    %rax,%rdx
+  802720:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802727:	ff ff ff 
+  80272a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80272e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802732:	83 e0 01             	and    $0x1,%eax
+  802735:	48 85 c0             	test   %rax,%rax
+  802738:	0f 84 a7 01 00 00    	je     8028e5 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  80273e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802742:	48 c1 e8 15          	shr    $0x15,%rax
+  802746:	48 89 c2             	mov    %rax,%rdx
+  802749:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802750:	ff ff ff 
+  802753:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802757:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80275b:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802760:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802766:	0f 85 79 01 00 00    	jne    8028e5 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  80276c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802770:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802774:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802778:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  80277e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802782:	ba 07 00 00 00       	mov    $0x7,%edx
+  802787:	be 00 00 60 00       	mov    $0x600000,%esi
+  80278c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802791:	49 89 df             	mov    %rbx,%r15
+  802794:	48 b8 a5 94 ff ff ff 	movabs $0xffffffffffff94a5,%rax
+  80279b:	ff ff ff 
+  80279e:	48 01 d8             	add    %rbx,%rax
+  8027a1:	ff d0                	call   *%rax
+  8027a3:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8027a6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8027aa:	79 44                	jns    8027f0 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  8027ac:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8027af:	89 c1                	mov    %eax,%ecx
+  8027b1:	48 b8 d0 e0 ff ff ff 	movabs $0xffffffffffffe0d0,%rax
+  8027b8:	ff ff ff 
+  8027bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8027bf:	48 89 c2             	mov    %rax,%rdx
+  8027c2:	be 20 00 00 00       	mov    $0x20,%esi
+  8027c7:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  8027ce:	ff ff ff 
+  8027d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8027d5:	48 89 c7             	mov    %rax,%rdi
+  8027d8:	49 89 df             	mov    %rbx,%r15
+  8027db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e0:	49 b8 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%r8
+  8027e7:	ff ff ff 
+  8027ea:	49 01 d8             	add    %rbx,%r8
+  8027ed:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  8027f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027f4:	ba 00 00 20 00       	mov    $0x200000,%edx
+  8027f9:	48 89 c6             	mov    %rax,%rsi
+  8027fc:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802801:	49 89 df             	mov    %rbx,%r15
+  802804:	48 b8 1e 87 ff ff ff 	movabs $0xffffffffffff871e,%rax
+  80280b:	ff ff ff 
+  80280e:	48 01 d8             	add    %rbx,%rax
+  802811:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802813:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802817:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80281d:	48 89 c1             	mov    %rax,%rcx
+  802820:	ba 00 00 00 00       	mov    $0x0,%edx
+  802825:	be 00 00 60 00       	mov    $0x600000,%esi
+  80282a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80282f:	49 89 df             	mov    %rbx,%r15
+  802832:	48 b8 34 8f ff ff ff 	movabs $0xffffffffffff8f34,%rax
+  802839:	ff ff ff 
+  80283c:	48 01 d8             	add    %rbx,%rax
+  80283f:	ff d0                	call   *%rax
+  802841:	85 c0                	test   %eax,%eax
+  802843:	74 3e                	je     802883 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802845:	48 b8 fb e0 ff ff ff 	movabs $0xffffffffffffe0fb,%rax
+  80284c:	ff ff ff 
+  80284f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802853:	48 89 c2             	mov    %rax,%rdx
+  802856:	be 23 00 00 00       	mov    $0x23,%esi
+  80285b:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  802862:	ff ff ff 
+  802865:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802869:	48 89 c7             	mov    %rax,%rdi
+  80286c:	49 89 df             	mov    %rbx,%r15
+  80286f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802874:	48 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%rcx
+  80287b:	ff ff ff 
+  80287e:	48 01 d9             	add    %rbx,%rcx
+  802881:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802883:	be 00 00 60 00       	mov    $0x600000,%esi
+  802888:	bf 00 00 00 00       	mov    $0x0,%edi
+  80288d:	49 89 df             	mov    %rbx,%r15
+  802890:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  802897:	ff ff ff 
+  80289a:	48 01 d8             	add    %rbx,%rax
+  80289d:	ff d0                	call   *%rax
+  80289f:	85 c0                	test   %eax,%eax
+  8028a1:	0f 84 3d 02 00 00    	je     802ae4 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  8028a7:	48 b8 10 e1 ff ff ff 	movabs $0xffffffffffffe110,%rax
+  8028ae:	ff ff ff 
+  8028b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8028b5:	48 89 c2             	mov    %rax,%rdx
+  8028b8:	be 25 00 00 00       	mov    $0x25,%esi
+  8028bd:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  8028c4:	ff ff ff 
+  8028c7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8028cb:	48 89 c7             	mov    %rax,%rdi
+  8028ce:	49 89 df             	mov    %rbx,%r15
+  8028d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d6:	48 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%rcx
+  8028dd:	ff ff ff 
+  8028e0:	48 01 d9             	add    %rbx,%rcx
+  8028e3:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  8028e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028e9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028ed:	48 89 c2             	mov    %rax,%rdx
+  8028f0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8028f7:	ff ff ff 
+  8028fa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8028fe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802902:	25 00 08 00 00       	and    $0x800,%eax
+  802907:	48 85 c0             	test   %rax,%rax
+  80290a:	0f 84 58 01 00 00    	je     802a68 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802910:	ba 07 00 00 00       	mov    $0x7,%edx
+  802915:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80291a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80291f:	49 89 df             	mov    %rbx,%r15
+  802922:	48 b8 cf 8e ff ff ff 	movabs $0xffffffffffff8ecf,%rax
+  802929:	ff ff ff 
+  80292c:	48 01 d8             	add    %rbx,%rax
+  80292f:	ff d0                	call   *%rax
+  802931:	85 c0                	test   %eax,%eax
+  802933:	74 3e                	je     802973 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802935:	48 b8 27 e1 ff ff ff 	movabs $0xffffffffffffe127,%rax
+  80293c:	ff ff ff 
+  80293f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802943:	48 89 c2             	mov    %rax,%rdx
+  802946:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80294b:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  802952:	ff ff ff 
+  802955:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802959:	48 89 c7             	mov    %rax,%rdi
+  80295c:	49 89 df             	mov    %rbx,%r15
+  80295f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802964:	48 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%rcx
+  80296b:	ff ff ff 
+  80296e:	48 01 d9             	add    %rbx,%rcx
+  802971:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802973:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802977:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80297c:	48 89 c6             	mov    %rax,%rsi
+  80297f:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802984:	49 89 df             	mov    %rbx,%r15
+  802987:	48 b8 1e 87 ff ff ff 	movabs $0xffffffffffff871e,%rax
+  80298e:	ff ff ff 
+  802991:	48 01 d8             	add    %rbx,%rax
+  802994:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802996:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80299a:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8029a0:	48 89 c1             	mov    %rax,%rcx
+  8029a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a8:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8029ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029b2:	49 89 df             	mov    %rbx,%r15
+  8029b5:	48 b8 34 8f ff ff ff 	movabs $0xffffffffffff8f34,%rax
+  8029bc:	ff ff ff 
+  8029bf:	48 01 d8             	add    %rbx,%rax
+  8029c2:	ff d0                	call   *%rax
+  8029c4:	85 c0                	test   %eax,%eax
+  8029c6:	74 3e                	je     802a06 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  8029c8:	48 b8 fb e0 ff ff ff 	movabs $0xffffffffffffe0fb,%rax
+  8029cf:	ff ff ff 
+  8029d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029d6:	48 89 c2             	mov    %rax,%rdx
+  8029d9:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8029de:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  8029e5:	ff ff ff 
+  8029e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029ec:	48 89 c7             	mov    %rax,%rdi
+  8029ef:	49 89 df             	mov    %rbx,%r15
+  8029f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f7:	48 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%rcx
+  8029fe:	ff ff ff 
+  802a01:	48 01 d9             	add    %rbx,%rcx
+  802a04:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802a06:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802a0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a10:	49 89 df             	mov    %rbx,%r15
+  802a13:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  802a1a:	ff ff ff 
+  802a1d:	48 01 d8             	add    %rbx,%rax
+  802a20:	ff d0                	call   *%rax
+  802a22:	85 c0                	test   %eax,%eax
+  802a24:	0f 84 bb 00 00 00    	je     802ae5 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802a2a:	48 b8 10 e1 ff ff ff 	movabs $0xffffffffffffe110,%rax
+  802a31:	ff ff ff 
+  802a34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a38:	48 89 c2             	mov    %rax,%rdx
+  802a3b:	be 32 00 00 00       	mov    $0x32,%esi
+  802a40:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  802a47:	ff ff ff 
+  802a4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a4e:	48 89 c7             	mov    %rax,%rdi
+  802a51:	49 89 df             	mov    %rbx,%r15
+  802a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a59:	48 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%rcx
+  802a60:	ff ff ff 
+  802a63:	48 01 d9             	add    %rbx,%rcx
+  802a66:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802a68:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  802a6f:	ff ff ff 
+  802a72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a76:	48 89 c2             	mov    %rax,%rdx
+  802a79:	be 36 00 00 00       	mov    $0x36,%esi
+  802a7e:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  802a85:	ff ff ff 
+  802a88:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a8c:	48 89 c7             	mov    %rax,%rdi
+  802a8f:	49 89 df             	mov    %rbx,%r15
+  802a92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a97:	48 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%rcx
+  802a9e:	ff ff ff 
+  802aa1:	48 01 d9             	add    %rbx,%rcx
+  802aa4:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802aa6:	48 b8 5f e1 ff ff ff 	movabs $0xffffffffffffe15f,%rax
+  802aad:	ff ff ff 
+  802ab0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ab4:	48 89 c2             	mov    %rax,%rdx
+  802ab7:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802abc:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  802ac3:	ff ff ff 
+  802ac6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aca:	48 89 c7             	mov    %rax,%rdi
+  802acd:	49 89 df             	mov    %rbx,%r15
+  802ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad5:	48 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%rcx
+  802adc:	ff ff ff 
+  802adf:	48 01 d9             	add    %rbx,%rcx
+  802ae2:	ff d1                	call   *%rcx
+			return;
+  802ae4:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802ae5:	48 83 c4 40          	add    $0x40,%rsp
+  802ae9:	5b                   	pop    %rbx
+  802aea:	41 5f                	pop    %r15
+  802aec:	5d                   	pop    %rbp
+  802aed:	c3                   	ret
+
+0000000000802aee <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802aee:	55                   	push   %rbp
+  802aef:	48 89 e5             	mov    %rsp,%rbp
+  802af2:	41 57                	push   %r15
+  802af4:	53                   	push   %rbx
+  802af5:	48 83 ec 10          	sub    $0x10,%rsp
+  802af9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802af9 <fork_flush+0xb>
+  802b00:	49 bb 47 65 00 00 00 	movabs $0x6547,%r11
+  802b07:	00 00 00 
+  802b0a:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802b0d:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802b14:	00 00 00 
+  802b17:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b1b:	48 85 c0             	test   %rax,%rax
+  802b1e:	0f 84 81 00 00 00    	je     802ba5 <fork_flush+0xb7>
+  802b24:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802b2b:	00 00 00 
+  802b2e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b32:	48 89 c6             	mov    %rax,%rsi
+  802b35:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802b3c:	00 00 00 
+  802b3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b43:	48 89 c7             	mov    %rax,%rdi
+  802b46:	49 89 df             	mov    %rbx,%r15
+  802b49:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  802b50:	ff ff ff 
+  802b53:	48 01 d8             	add    %rbx,%rax
+  802b56:	ff d0                	call   *%rax
+  802b58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b5f:	79 44                	jns    802ba5 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802b61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b64:	89 c1                	mov    %eax,%ecx
+  802b66:	48 b8 78 e1 ff ff ff 	movabs $0xffffffffffffe178,%rax
+  802b6d:	ff ff ff 
+  802b70:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b74:	48 89 c2             	mov    %rax,%rdx
+  802b77:	be 56 00 00 00       	mov    $0x56,%esi
+  802b7c:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  802b83:	ff ff ff 
+  802b86:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b8a:	48 89 c7             	mov    %rax,%rdi
+  802b8d:	49 89 df             	mov    %rbx,%r15
+  802b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b95:	49 b8 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%r8
+  802b9c:	ff ff ff 
+  802b9f:	49 01 d8             	add    %rbx,%r8
+  802ba2:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802ba5:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802bac:	00 00 00 
+  802baf:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802bb6:	00 
+}
+  802bb7:	90                   	nop
+  802bb8:	48 83 c4 10          	add    $0x10,%rsp
+  802bbc:	5b                   	pop    %rbx
+  802bbd:	41 5f                	pop    %r15
+  802bbf:	5d                   	pop    %rbp
+  802bc0:	c3                   	ret
+
+0000000000802bc1 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802bc1:	55                   	push   %rbp
+  802bc2:	48 89 e5             	mov    %rsp,%rbp
+  802bc5:	53                   	push   %rbx
+  802bc6:	48 83 ec 28          	sub    $0x28,%rsp
+  802bca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802bca <fork_map+0x9>
+  802bd1:	49 bb 76 64 00 00 00 	movabs $0x6476,%r11
+  802bd8:	00 00 00 
+  802bdb:	4c 01 db             	add    %r11,%rbx
+  802bde:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802be1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802be5:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802be8:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802bef:	00 00 00 
+  802bf2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bf6:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802bfc:	75 10                	jne    802c0e <fork_map+0x4d>
+		fork_flush();
+  802bfe:	48 b8 ae 9a ff ff ff 	movabs $0xffffffffffff9aae,%rax
+  802c05:	ff ff ff 
+  802c08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c0c:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802c0e:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802c15:	00 00 00 
+  802c18:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c1c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802c20:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802c27:	00 00 00 
+  802c2a:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802c2e:	48 c1 e0 05          	shl    $0x5,%rax
+  802c32:	48 89 c2             	mov    %rax,%rdx
+  802c35:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802c3c:	00 00 00 
+  802c3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c43:	48 01 d0             	add    %rdx,%rax
+  802c46:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802c4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c4e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802c54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c58:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c5c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802c60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c64:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802c67:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802c6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c6e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c72:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802c76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c7a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802c7d:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802c80:	90                   	nop
+  802c81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c85:	c9                   	leave
+  802c86:	c3                   	ret
+
+0000000000802c87 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802c87:	55                   	push   %rbp
+  802c88:	48 89 e5             	mov    %rsp,%rbp
+  802c8b:	53                   	push   %rbx
+  802c8c:	48 83 ec 28          	sub    $0x28,%rsp
+  802c90:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c90 <duppage+0x9>
+  802c97:	49 bb b0 63 00 00 00 	movabs $0x63b0,%r11
+  802c9e:	00 00 00 
+  802ca1:	4c 01 db             	add    %r11,%rbx
+  802ca4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ca7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802caa:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802cad:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cb1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802cb5:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802cbc:	ff ff ff 
+  802cbf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cc3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802cc6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cca:	25 00 04 00 00       	and    $0x400,%eax
+  802ccf:	48 85 c0             	test   %rax,%rax
+  802cd2:	74 42                	je     802d16 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802cd4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802cdb:	ff ff ff 
+  802cde:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ce2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802ce5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ce9:	25 07 0e 00 00       	and    $0xe07,%eax
+  802cee:	89 c2                	mov    %eax,%edx
+  802cf0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802cf4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802cf7:	48 89 ce             	mov    %rcx,%rsi
+  802cfa:	89 c7                	mov    %eax,%edi
+  802cfc:	48 b8 81 9b ff ff ff 	movabs $0xffffffffffff9b81,%rax
+  802d03:	ff ff ff 
+  802d06:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d0a:	ff d0                	call   *%rax
+		return 0;
+  802d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d11:	e9 ae 00 00 00       	jmp    802dc4 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802d16:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d1d:	ff ff ff 
+  802d20:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d24:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d27:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d2b:	83 e0 02             	and    $0x2,%eax
+  802d2e:	48 85 c0             	test   %rax,%rax
+  802d31:	75 1f                	jne    802d52 <duppage+0xcb>
+  802d33:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d3a:	ff ff ff 
+  802d3d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d41:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d44:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d48:	25 00 08 00 00       	and    $0x800,%eax
+  802d4d:	48 85 c0             	test   %rax,%rax
+  802d50:	74 4c                	je     802d9e <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  802d52:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  802d59:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802d5c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d60:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d63:	48 89 ce             	mov    %rcx,%rsi
+  802d66:	89 c7                	mov    %eax,%edi
+  802d68:	48 b8 81 9b ff ff ff 	movabs $0xffffffffffff9b81,%rax
+  802d6f:	ff ff ff 
+  802d72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d76:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  802d78:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802d7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d7f:	48 89 c6             	mov    %rax,%rsi
+  802d82:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d87:	48 b8 81 9b ff ff ff 	movabs $0xffffffffffff9b81,%rax
+  802d8e:	ff ff ff 
+  802d91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d95:	ff d0                	call   *%rax
+		return 0;
+  802d97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9c:	eb 26                	jmp    802dc4 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  802d9e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802da2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802da5:	ba 05 00 00 00       	mov    $0x5,%edx
+  802daa:	48 89 ce             	mov    %rcx,%rsi
+  802dad:	89 c7                	mov    %eax,%edi
+  802daf:	48 b8 81 9b ff ff ff 	movabs $0xffffffffffff9b81,%rax
+  802db6:	ff ff ff 
+  802db9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dbd:	ff d0                	call   *%rax
+		return 0;
+  802dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  802dc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc8:	c9                   	leave
+  802dc9:	c3                   	ret
+
+0000000000802dca <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  802dca:	55                   	push   %rbp
+  802dcb:	48 89 e5             	mov    %rsp,%rbp
+  802dce:	53                   	push   %rbx
+  802dcf:	48 83 ec 28          	sub    $0x28,%rsp
+  802dd3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dd3 <duphuge+0x9>
+  802dda:	49 bb 6d 62 00 00 00 	movabs $0x626d,%r11
+  802de1:	00 00 00 
+  802de4:	4c 01 db             	add    %r11,%rbx
+  802de7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802dea:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  802dee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802df2:	48 c1 e8 15          	shr    $0x15,%rax
+  802df6:	48 89 c2             	mov    %rax,%rdx
+  802df9:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e00:	ff ff ff 
+  802e03:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e07:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e0b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  802e0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e13:	25 00 04 00 00       	and    $0x400,%eax
+  802e18:	48 85 c0             	test   %rax,%rax
+  802e1b:	74 0e                	je     802e2b <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  802e1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e21:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e29:	eb 1e                	jmp    802e49 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  802e2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e2f:	25 02 08 00 00       	and    $0x802,%eax
+  802e34:	48 85 c0             	test   %rax,%rax
+  802e37:	74 09                	je     802e42 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  802e39:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  802e40:	eb 07                	jmp    802e49 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  802e42:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  802e49:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e4c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802e50:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e53:	48 89 ce             	mov    %rcx,%rsi
+  802e56:	89 c7                	mov    %eax,%edi
+  802e58:	48 b8 81 9b ff ff ff 	movabs $0xffffffffffff9b81,%rax
+  802e5f:	ff ff ff 
+  802e62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e66:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  802e68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e6b:	25 00 08 00 00       	and    $0x800,%eax
+  802e70:	85 c0                	test   %eax,%eax
+  802e72:	74 1f                	je     802e93 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  802e74:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e7b:	48 89 c6             	mov    %rax,%rsi
+  802e7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e83:	48 b8 81 9b ff ff ff 	movabs $0xffffffffffff9b81,%rax
+  802e8a:	ff ff ff 
+  802e8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e91:	ff d0                	call   *%rax
+	return 0;
+  802e93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e98:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e9c:	c9                   	leave
+  802e9d:	c3                   	ret
+
+0000000000802e9e <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802e9e:	55                   	push   %rbp
+  802e9f:	48 89 e5             	mov    %rsp,%rbp
+  802ea2:	41 57                	push   %r15
+  802ea4:	53                   	push   %rbx
+  802ea5:	48 83 ec 10          	sub    $0x10,%rsp
+  802ea9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ea9 <fork+0xb>
+  802eb0:	49 bb 97 61 00 00 00 	movabs $0x6197,%r11
+  802eb7:	00 00 00 
+  802eba:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  802ebd:	49 89 df             	mov    %rbx,%r15
+  802ec0:	48 b8 24 96 ff ff ff 	movabs $0xffffffffffff9624,%rax
+  802ec7:	ff ff ff 
+  802eca:	48 01 d8             	add    %rbx,%rax
+  802ecd:	ff d0                	call   *%rax
+  802ecf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ed2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ed6:	75 42                	jne    802f1a <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802ed8:	49 89 df             	mov    %rbx,%r15
+  802edb:	48 b8 26 8e ff ff ff 	movabs $0xffffffffffff8e26,%rax
+  802ee2:	ff ff ff 
+  802ee5:	48 01 d8             	add    %rbx,%rax
+  802ee8:	ff d0                	call   *%rax
+  802eea:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802eef:	48 98                	cltq
+  802ef1:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  802ef8:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802eff:	ff ff ff 
+  802f02:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  802f06:	48 01 c2             	add    %rax,%rdx
+  802f09:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802f10:	ff ff ff 
+  802f13:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f17:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  802f1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f1d:	48 83 c4 10          	add    $0x10,%rsp
+  802f21:	5b                   	pop    %rbx
+  802f22:	41 5f                	pop    %r15
+  802f24:	5d                   	pop    %rbp
+  802f25:	c3                   	ret
+
+0000000000802f26 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  802f26:	55                   	push   %rbp
+  802f27:	48 89 e5             	mov    %rsp,%rbp
+  802f2a:	41 57                	push   %r15
+  802f2c:	53                   	push   %rbx
+  802f2d:	48 83 ec 10          	sub    $0x10,%rsp
+  802f31:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f31 <ufork+0xb>
+  802f38:	49 bb 0f 61 00 00 00 	movabs $0x610f,%r11
+  802f3f:	00 00 00 
+  802f42:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  802f45:	48 b8 78 96 ff ff ff 	movabs $0xffffffffffff9678,%rax
+  802f4c:	ff ff ff 
+  802f4f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f53:	48 89 c7             	mov    %rax,%rdi
+  802f56:	49 89 df             	mov    %rbx,%r15
+  802f59:	48 b8 66 d2 ff ff ff 	movabs $0xffffffffffffd266,%rax
+  802f60:	ff ff ff 
+  802f63:	48 01 d8             	add    %rbx,%rax
+  802f66:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802f68:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f6d:	cd 30                	int    $0x30
+  802f6f:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  802f72:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  802f75:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  802f78:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802f7c:	0f 84 03 02 00 00    	je     803185 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  802f82:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802f89:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  802f8a:	e9 28 01 00 00       	jmp    8030b7 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  802f8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f93:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f97:	48 89 c2             	mov    %rax,%rdx
+  802f9a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802fa1:	ff ff ff 
+  802fa4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fa8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fac:	83 e0 01             	and    $0x1,%eax
+  802faf:	48 85 c0             	test   %rax,%rax
+  802fb2:	0f 84 f7 00 00 00    	je     8030af <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  802fb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fbc:	48 c1 e8 15          	shr    $0x15,%rax
+  802fc0:	48 89 c2             	mov    %rax,%rdx
+  802fc3:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802fca:	ff ff ff 
+  802fcd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fd1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fd5:	25 81 00 00 00       	and    $0x81,%eax
+  802fda:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  802fe0:	75 29                	jne    80300b <ufork+0xe5>
+					duphuge(child_envid, addr);
+  802fe2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802fe6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802fe9:	48 89 d6             	mov    %rdx,%rsi
+  802fec:	89 c7                	mov    %eax,%edi
+  802fee:	48 b8 8a 9d ff ff ff 	movabs $0xffffffffffff9d8a,%rax
+  802ff5:	ff ff ff 
+  802ff8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ffc:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  802ffe:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803005:	00 
+  803006:	e9 ac 00 00 00       	jmp    8030b7 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  80300b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80300f:	48 c1 e8 15          	shr    $0x15,%rax
+  803013:	48 89 c2             	mov    %rax,%rdx
+  803016:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80301d:	ff ff ff 
+  803020:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803024:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803028:	83 e0 01             	and    $0x1,%eax
+  80302b:	48 85 c0             	test   %rax,%rax
+  80302e:	74 75                	je     8030a5 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  803030:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803034:	48 c1 e8 0c          	shr    $0xc,%rax
+  803038:	48 89 c2             	mov    %rax,%rdx
+  80303b:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803042:	ff ff ff 
+  803045:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803049:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80304d:	83 e0 01             	and    $0x1,%eax
+  803050:	48 85 c0             	test   %rax,%rax
+  803053:	74 46                	je     80309b <ufork+0x175>
+  803055:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803059:	48 c1 e8 0c          	shr    $0xc,%rax
+  80305d:	48 89 c2             	mov    %rax,%rdx
+  803060:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803067:	ff ff ff 
+  80306a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80306e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803072:	83 e0 04             	and    $0x4,%eax
+  803075:	48 85 c0             	test   %rax,%rax
+  803078:	74 21                	je     80309b <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  80307a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80307e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803082:	89 c2                	mov    %eax,%edx
+  803084:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803087:	89 d6                	mov    %edx,%esi
+  803089:	89 c7                	mov    %eax,%edi
+  80308b:	48 b8 47 9c ff ff ff 	movabs $0xffffffffffff9c47,%rax
+  803092:	ff ff ff 
+  803095:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803099:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  80309b:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8030a2:	00 
+  8030a3:	eb 12                	jmp    8030b7 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  8030a5:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8030ac:	00 
+  8030ad:	eb 08                	jmp    8030b7 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  8030af:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  8030b6:	40 
+		for (; addr < USTACKTOP;){
+  8030b7:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  8030bc:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8030c0:	0f 83 c9 fe ff ff    	jae    802f8f <ufork+0x69>
+			}
+		}
+		fork_flush();
+  8030c6:	48 b8 ae 9a ff ff ff 	movabs $0xffffffffffff9aae,%rax
+  8030cd:	ff ff ff 
+  8030d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030d4:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  8030d6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8030d9:	ba 07 00 00 00       	mov    $0x7,%edx
+  8030de:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8030e3:	48 89 ce             	mov    %rcx,%rsi
+  8030e6:	89 c7                	mov    %eax,%edi
+  8030e8:	49 89 df             	mov    %rbx,%r15
+  8030eb:	48 b8 cf 8e ff ff ff 	movabs $0xffffffffffff8ecf,%rax
+  8030f2:	ff ff ff 
+  8030f5:	48 01 d8             	add    %rbx,%rax
+  8030f8:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8030fa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8030fd:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803104:	ff ff ff 
+  803107:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80310b:	48 89 d6             	mov    %rdx,%rsi
+  80310e:	89 c7                	mov    %eax,%edi
+  803110:	49 89 df             	mov    %rbx,%r15
+  803113:	48 b8 c5 90 ff ff ff 	movabs $0xffffffffffff90c5,%rax
+  80311a:	ff ff ff 
+  80311d:	48 01 d8             	add    %rbx,%rax
+  803120:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803122:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803125:	be 02 00 00 00       	mov    $0x2,%esi
+  80312a:	89 c7                	mov    %eax,%edi
+  80312c:	49 89 df             	mov    %rbx,%r15
+  80312f:	48 b8 06 90 ff ff ff 	movabs $0xffffffffffff9006,%rax
+  803136:	ff ff ff 
+  803139:	48 01 d8             	add    %rbx,%rax
+  80313c:	ff d0                	call   *%rax
+  80313e:	85 c0                	test   %eax,%eax
+  803140:	74 3e                	je     803180 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803142:	48 b8 9f e1 ff ff ff 	movabs $0xffffffffffffe19f,%rax
+  803149:	ff ff ff 
+  80314c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803150:	48 89 c2             	mov    %rax,%rdx
+  803153:	be 07 01 00 00       	mov    $0x107,%esi
+  803158:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  80315f:	ff ff ff 
+  803162:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803166:	48 89 c7             	mov    %rax,%rdi
+  803169:	49 89 df             	mov    %rbx,%r15
+  80316c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803171:	48 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%rcx
+  803178:	ff ff ff 
+  80317b:	48 01 d9             	add    %rbx,%rcx
+  80317e:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803180:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803183:	eb 59                	jmp    8031de <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803185:	49 89 df             	mov    %rbx,%r15
+  803188:	48 b8 26 8e ff ff ff 	movabs $0xffffffffffff8e26,%rax
+  80318f:	ff ff ff 
+  803192:	48 01 d8             	add    %rbx,%rax
+  803195:	ff d0                	call   *%rax
+  803197:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80319c:	48 98                	cltq
+  80319e:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8031a5:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8031ac:	ff ff ff 
+  8031af:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8031b3:	48 01 c2             	add    %rax,%rdx
+  8031b6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8031bd:	ff ff ff 
+  8031c0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031c4:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  8031c7:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8031ce:	00 00 00 
+  8031d1:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  8031d8:	00 
+		return 0;
+  8031d9:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  8031de:	48 83 c4 10          	add    $0x10,%rsp
+  8031e2:	5b                   	pop    %rbx
+  8031e3:	41 5f                	pop    %r15
+  8031e5:	5d                   	pop    %rbp
+  8031e6:	c3                   	ret
+
+00000000008031e7 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8031e7:	55                   	push   %rbp
+  8031e8:	48 89 e5             	mov    %rsp,%rbp
+  8031eb:	41 57                	push   %r15
+  8031ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8031f1:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8031f1 <sfork+0xa>
+  8031f8:	49 bb 4f 5e 00 00 00 	movabs $0x5e4f,%r11
+  8031ff:	00 00 00 
+  803202:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803205:	48 b8 ba e1 ff ff ff 	movabs $0xffffffffffffe1ba,%rax
+  80320c:	ff ff ff 
+  80320f:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803213:	48 89 c2             	mov    %rax,%rdx
+  803216:	be 1a 01 00 00       	mov    $0x11a,%esi
+  80321b:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  803222:	ff ff ff 
+  803225:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803229:	48 89 c7             	mov    %rax,%rdi
+  80322c:	49 89 cf             	mov    %rcx,%r15
+  80322f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803234:	49 b8 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%r8
+  80323b:	ff ff ff 
+  80323e:	49 01 c8             	add    %rcx,%r8
+  803241:	41 ff d0             	call   *%r8
+
+0000000000803244 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803244:	55                   	push   %rbp
+  803245:	48 89 e5             	mov    %rsp,%rbp
+  803248:	48 83 ec 08          	sub    $0x8,%rsp
+  80324c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80324c <fd2num+0x8>
+  803253:	49 bb f4 5d 00 00 00 	movabs $0x5df4,%r11
+  80325a:	00 00 00 
+  80325d:	4c 01 d8             	add    %r11,%rax
+  803260:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803264:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803268:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80326f:	ff ff ff 
+  803272:	48 01 d0             	add    %rdx,%rax
+  803275:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803279:	c9                   	leave
+  80327a:	c3                   	ret
+
+000000000080327b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80327b:	55                   	push   %rbp
+  80327c:	48 89 e5             	mov    %rsp,%rbp
+  80327f:	48 83 ec 08          	sub    $0x8,%rsp
+  803283:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803283 <fd2data+0x8>
+  80328a:	49 bb bd 5d 00 00 00 	movabs $0x5dbd,%r11
+  803291:	00 00 00 
+  803294:	4c 01 d8             	add    %r11,%rax
+  803297:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80329b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80329f:	48 89 d7             	mov    %rdx,%rdi
+  8032a2:	48 ba 04 a2 ff ff ff 	movabs $0xffffffffffffa204,%rdx
+  8032a9:	ff ff ff 
+  8032ac:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8032b0:	ff d0                	call   *%rax
+  8032b2:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8032b8:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8032bc:	c9                   	leave
+  8032bd:	c3                   	ret
+
+00000000008032be <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8032be:	55                   	push   %rbp
+  8032bf:	48 89 e5             	mov    %rsp,%rbp
+  8032c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8032c6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8032c6 <fd_alloc+0x8>
+  8032cd:	49 bb 7a 5d 00 00 00 	movabs $0x5d7a,%r11
+  8032d4:	00 00 00 
+  8032d7:	4c 01 d8             	add    %r11,%rax
+  8032da:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8032de:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8032e5:	eb 75                	jmp    80335c <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8032e7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8032ea:	48 63 d2             	movslq %edx,%rdx
+  8032ed:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8032f4:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8032f8:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8032fc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803300:	48 89 d1             	mov    %rdx,%rcx
+  803303:	48 c1 e9 15          	shr    $0x15,%rcx
+  803307:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80330e:	ff ff ff 
+  803311:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803315:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803319:	83 e2 01             	and    $0x1,%edx
+  80331c:	48 85 d2             	test   %rdx,%rdx
+  80331f:	74 25                	je     803346 <fd_alloc+0x88>
+  803321:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803325:	48 89 d1             	mov    %rdx,%rcx
+  803328:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80332c:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803333:	ff ff ff 
+  803336:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80333a:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80333e:	83 e2 01             	and    $0x1,%edx
+  803341:	48 85 d2             	test   %rdx,%rdx
+  803344:	75 12                	jne    803358 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803346:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80334a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80334e:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803351:	b8 00 00 00 00       	mov    $0x0,%eax
+  803356:	eb 1a                	jmp    803372 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803358:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80335c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803360:	7e 85                	jle    8032e7 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803362:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803366:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  80336d:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803372:	c9                   	leave
+  803373:	c3                   	ret
+
+0000000000803374 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803374:	55                   	push   %rbp
+  803375:	48 89 e5             	mov    %rsp,%rbp
+  803378:	48 83 ec 20          	sub    $0x20,%rsp
+  80337c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80337c <fd_lookup+0x8>
+  803383:	49 bb c4 5c 00 00 00 	movabs $0x5cc4,%r11
+  80338a:	00 00 00 
+  80338d:	4c 01 d8             	add    %r11,%rax
+  803390:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803393:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803397:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80339b:	78 06                	js     8033a3 <fd_lookup+0x2f>
+  80339d:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8033a1:	7e 07                	jle    8033aa <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8033a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033a8:	eb 73                	jmp    80341d <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8033aa:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8033ad:	48 63 d2             	movslq %edx,%rdx
+  8033b0:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8033b7:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8033bb:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8033bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033c3:	48 89 d1             	mov    %rdx,%rcx
+  8033c6:	48 c1 e9 15          	shr    $0x15,%rcx
+  8033ca:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8033d1:	ff ff ff 
+  8033d4:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8033d8:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8033dc:	83 e2 01             	and    $0x1,%edx
+  8033df:	48 85 d2             	test   %rdx,%rdx
+  8033e2:	74 22                	je     803406 <fd_lookup+0x92>
+  8033e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033e8:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8033ec:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  8033f3:	ff ff ff 
+  8033f6:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8033fa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033fe:	83 e0 01             	and    $0x1,%eax
+  803401:	48 85 c0             	test   %rax,%rax
+  803404:	75 07                	jne    80340d <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803406:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80340b:	eb 10                	jmp    80341d <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  80340d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803411:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803415:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803418:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80341d:	c9                   	leave
+  80341e:	c3                   	ret
+
+000000000080341f <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  80341f:	55                   	push   %rbp
+  803420:	48 89 e5             	mov    %rsp,%rbp
+  803423:	41 57                	push   %r15
+  803425:	53                   	push   %rbx
+  803426:	48 83 ec 30          	sub    $0x30,%rsp
+  80342a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80342a <fd_close+0xb>
+  803431:	49 bb 16 5c 00 00 00 	movabs $0x5c16,%r11
+  803438:	00 00 00 
+  80343b:	4c 01 db             	add    %r11,%rbx
+  80343e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803442:	89 f0                	mov    %esi,%eax
+  803444:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803447:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80344b:	48 89 c7             	mov    %rax,%rdi
+  80344e:	48 b8 04 a2 ff ff ff 	movabs $0xffffffffffffa204,%rax
+  803455:	ff ff ff 
+  803458:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80345c:	ff d0                	call   *%rax
+  80345e:	89 c2                	mov    %eax,%edx
+  803460:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803464:	48 89 c6             	mov    %rax,%rsi
+  803467:	89 d7                	mov    %edx,%edi
+  803469:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  803470:	ff ff ff 
+  803473:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803477:	ff d0                	call   *%rax
+  803479:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80347c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803480:	78 0a                	js     80348c <fd_close+0x6d>
+	    || fd != fd2)
+  803482:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803486:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80348a:	74 12                	je     80349e <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80348c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803490:	74 05                	je     803497 <fd_close+0x78>
+  803492:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803495:	eb 7a                	jmp    803511 <fd_close+0xf2>
+  803497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349c:	eb 73                	jmp    803511 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80349e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034a2:	8b 00                	mov    (%rax),%eax
+  8034a4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8034a8:	48 89 d6             	mov    %rdx,%rsi
+  8034ab:	89 c7                	mov    %eax,%edi
+  8034ad:	48 b8 da a4 ff ff ff 	movabs $0xffffffffffffa4da,%rax
+  8034b4:	ff ff ff 
+  8034b7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034bb:	ff d0                	call   *%rax
+  8034bd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034c4:	78 2a                	js     8034f0 <fd_close+0xd1>
+		if (dev->dev_close)
+  8034c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034ca:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8034ce:	48 85 c0             	test   %rax,%rax
+  8034d1:	74 16                	je     8034e9 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8034d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034d7:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034df:	48 89 c7             	mov    %rax,%rdi
+  8034e2:	ff d2                	call   *%rdx
+  8034e4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034e7:	eb 07                	jmp    8034f0 <fd_close+0xd1>
+		else
+			r = 0;
+  8034e9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8034f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034f4:	48 89 c6             	mov    %rax,%rsi
+  8034f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034fc:	49 89 df             	mov    %rbx,%r15
+  8034ff:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  803506:	ff ff ff 
+  803509:	48 01 d8             	add    %rbx,%rax
+  80350c:	ff d0                	call   *%rax
+	return r;
+  80350e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803511:	48 83 c4 30          	add    $0x30,%rsp
+  803515:	5b                   	pop    %rbx
+  803516:	41 5f                	pop    %r15
+  803518:	5d                   	pop    %rbp
+  803519:	c3                   	ret
+
+000000000080351a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80351a:	55                   	push   %rbp
+  80351b:	48 89 e5             	mov    %rsp,%rbp
+  80351e:	41 57                	push   %r15
+  803520:	48 83 ec 28          	sub    $0x28,%rsp
+  803524:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803524 <dev_lookup+0xa>
+  80352b:	49 bb 1c 5b 00 00 00 	movabs $0x5b1c,%r11
+  803532:	00 00 00 
+  803535:	4c 01 d9             	add    %r11,%rcx
+  803538:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80353b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80353f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803546:	eb 45                	jmp    80358d <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803548:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80354f:	00 00 00 
+  803552:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803555:	48 98                	cltq
+  803557:	48 01 ca             	add    %rcx,%rdx
+  80355a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80355e:	8b 00                	mov    (%rax),%eax
+  803560:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803563:	75 24                	jne    803589 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803565:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80356c:	00 00 00 
+  80356f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803572:	48 98                	cltq
+  803574:	48 01 ca             	add    %rcx,%rdx
+  803577:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80357b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80357f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803582:	b8 00 00 00 00       	mov    $0x0,%eax
+  803587:	eb 74                	jmp    8035fd <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803589:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80358d:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803594:	00 00 00 
+  803597:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80359a:	48 98                	cltq
+  80359c:	48 01 ca             	add    %rcx,%rdx
+  80359f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035a3:	48 85 c0             	test   %rax,%rax
+  8035a6:	75 a0                	jne    803548 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8035a8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8035af:	ff ff ff 
+  8035b2:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8035b6:	48 8b 00             	mov    (%rax),%rax
+  8035b9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8035bf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8035c2:	89 c6                	mov    %eax,%esi
+  8035c4:	48 b8 d0 e1 ff ff ff 	movabs $0xffffffffffffe1d0,%rax
+  8035cb:	ff ff ff 
+  8035ce:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8035d2:	48 89 c7             	mov    %rax,%rdi
+  8035d5:	49 89 cf             	mov    %rcx,%r15
+  8035d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035dd:	49 b8 51 74 ff ff ff 	movabs $0xffffffffffff7451,%r8
+  8035e4:	ff ff ff 
+  8035e7:	49 01 c8             	add    %rcx,%r8
+  8035ea:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8035ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035f1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8035f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8035fd:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803601:	c9                   	leave
+  803602:	c3                   	ret
+
+0000000000803603 <close>:
+
+int
+close(int fdnum)
+{
+  803603:	55                   	push   %rbp
+  803604:	48 89 e5             	mov    %rsp,%rbp
+  803607:	53                   	push   %rbx
+  803608:	48 83 ec 28          	sub    $0x28,%rsp
+  80360c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80360c <close+0x9>
+  803613:	49 bb 34 5a 00 00 00 	movabs $0x5a34,%r11
+  80361a:	00 00 00 
+  80361d:	4c 01 db             	add    %r11,%rbx
+  803620:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803623:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803627:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80362a:	48 89 d6             	mov    %rdx,%rsi
+  80362d:	89 c7                	mov    %eax,%edi
+  80362f:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  803636:	ff ff ff 
+  803639:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80363d:	ff d0                	call   *%rax
+  80363f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803642:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803646:	79 05                	jns    80364d <close+0x4a>
+		return r;
+  803648:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80364b:	eb 1c                	jmp    803669 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  80364d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803651:	be 01 00 00 00       	mov    $0x1,%esi
+  803656:	48 89 c7             	mov    %rax,%rdi
+  803659:	48 b8 df a3 ff ff ff 	movabs $0xffffffffffffa3df,%rax
+  803660:	ff ff ff 
+  803663:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803667:	ff d0                	call   *%rax
+}
+  803669:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80366d:	c9                   	leave
+  80366e:	c3                   	ret
+
+000000000080366f <close_all>:
+
+void
+close_all(void)
+{
+  80366f:	55                   	push   %rbp
+  803670:	48 89 e5             	mov    %rsp,%rbp
+  803673:	53                   	push   %rbx
+  803674:	48 83 ec 18          	sub    $0x18,%rsp
+  803678:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803678 <close_all+0x9>
+  80367f:	49 bb c8 59 00 00 00 	movabs $0x59c8,%r11
+  803686:	00 00 00 
+  803689:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80368c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803693:	eb 19                	jmp    8036ae <close_all+0x3f>
+		close(i);
+  803695:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803698:	89 c7                	mov    %eax,%edi
+  80369a:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  8036a1:	ff ff ff 
+  8036a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036a8:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8036aa:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8036ae:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8036b2:	7e e1                	jle    803695 <close_all+0x26>
+}
+  8036b4:	90                   	nop
+  8036b5:	90                   	nop
+  8036b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036ba:	c9                   	leave
+  8036bb:	c3                   	ret
+
+00000000008036bc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8036bc:	55                   	push   %rbp
+  8036bd:	48 89 e5             	mov    %rsp,%rbp
+  8036c0:	41 57                	push   %r15
+  8036c2:	53                   	push   %rbx
+  8036c3:	48 83 ec 40          	sub    $0x40,%rsp
+  8036c7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036c7 <dup+0xb>
+  8036ce:	49 bb 79 59 00 00 00 	movabs $0x5979,%r11
+  8036d5:	00 00 00 
+  8036d8:	4c 01 db             	add    %r11,%rbx
+  8036db:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8036de:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8036e1:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8036e5:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8036e8:	48 89 d6             	mov    %rdx,%rsi
+  8036eb:	89 c7                	mov    %eax,%edi
+  8036ed:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  8036f4:	ff ff ff 
+  8036f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036fb:	ff d0                	call   *%rax
+  8036fd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803700:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803704:	79 08                	jns    80370e <dup+0x52>
+		return r;
+  803706:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803709:	e9 a4 01 00 00       	jmp    8038b2 <dup+0x1f6>
+	close(newfdnum);
+  80370e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803711:	89 c7                	mov    %eax,%edi
+  803713:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  80371a:	ff ff ff 
+  80371d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803721:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803723:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803726:	48 98                	cltq
+  803728:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80372e:	48 c1 e0 0c          	shl    $0xc,%rax
+  803732:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803736:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80373a:	48 89 c7             	mov    %rax,%rdi
+  80373d:	48 b8 3b a2 ff ff ff 	movabs $0xffffffffffffa23b,%rax
+  803744:	ff ff ff 
+  803747:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80374b:	ff d0                	call   *%rax
+  80374d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803751:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803755:	48 89 c7             	mov    %rax,%rdi
+  803758:	48 b8 3b a2 ff ff ff 	movabs $0xffffffffffffa23b,%rax
+  80375f:	ff ff ff 
+  803762:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803766:	ff d0                	call   *%rax
+  803768:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80376c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803770:	48 c1 e8 15          	shr    $0x15,%rax
+  803774:	48 89 c2             	mov    %rax,%rdx
+  803777:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80377e:	ff ff ff 
+  803781:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803785:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803789:	83 e0 01             	and    $0x1,%eax
+  80378c:	48 85 c0             	test   %rax,%rax
+  80378f:	74 7f                	je     803810 <dup+0x154>
+  803791:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803795:	48 c1 e8 0c          	shr    $0xc,%rax
+  803799:	48 89 c2             	mov    %rax,%rdx
+  80379c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8037a3:	ff ff ff 
+  8037a6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037aa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037ae:	83 e0 01             	and    $0x1,%eax
+  8037b1:	48 85 c0             	test   %rax,%rax
+  8037b4:	74 5a                	je     803810 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8037b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037ba:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037be:	48 89 c2             	mov    %rax,%rdx
+  8037c1:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8037c8:	ff ff ff 
+  8037cb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037cf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037d3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8037d8:	89 c1                	mov    %eax,%ecx
+  8037da:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8037de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037e2:	41 89 c8             	mov    %ecx,%r8d
+  8037e5:	48 89 d1             	mov    %rdx,%rcx
+  8037e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037ed:	48 89 c6             	mov    %rax,%rsi
+  8037f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f5:	49 89 df             	mov    %rbx,%r15
+  8037f8:	48 b8 34 8f ff ff ff 	movabs $0xffffffffffff8f34,%rax
+  8037ff:	ff ff ff 
+  803802:	48 01 d8             	add    %rbx,%rax
+  803805:	ff d0                	call   *%rax
+  803807:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80380a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80380e:	78 5f                	js     80386f <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803810:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803814:	48 c1 e8 0c          	shr    $0xc,%rax
+  803818:	48 89 c2             	mov    %rax,%rdx
+  80381b:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803822:	ff ff ff 
+  803825:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803829:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80382d:	25 07 0e 00 00       	and    $0xe07,%eax
+  803832:	89 c1                	mov    %eax,%ecx
+  803834:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803838:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80383c:	41 89 c8             	mov    %ecx,%r8d
+  80383f:	48 89 d1             	mov    %rdx,%rcx
+  803842:	ba 00 00 00 00       	mov    $0x0,%edx
+  803847:	48 89 c6             	mov    %rax,%rsi
+  80384a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80384f:	49 89 df             	mov    %rbx,%r15
+  803852:	48 b8 34 8f ff ff ff 	movabs $0xffffffffffff8f34,%rax
+  803859:	ff ff ff 
+  80385c:	48 01 d8             	add    %rbx,%rax
+  80385f:	ff d0                	call   *%rax
+  803861:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803864:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803868:	78 08                	js     803872 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  80386a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80386d:	eb 43                	jmp    8038b2 <dup+0x1f6>
+			goto err;
+  80386f:	90                   	nop
+  803870:	eb 01                	jmp    803873 <dup+0x1b7>
+		goto err;
+  803872:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803873:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803877:	48 89 c6             	mov    %rax,%rsi
+  80387a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80387f:	49 89 df             	mov    %rbx,%r15
+  803882:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  803889:	ff ff ff 
+  80388c:	48 01 d8             	add    %rbx,%rax
+  80388f:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803891:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803895:	48 89 c6             	mov    %rax,%rsi
+  803898:	bf 00 00 00 00       	mov    $0x0,%edi
+  80389d:	49 89 df             	mov    %rbx,%r15
+  8038a0:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  8038a7:	ff ff ff 
+  8038aa:	48 01 d8             	add    %rbx,%rax
+  8038ad:	ff d0                	call   *%rax
+	return r;
+  8038af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8038b2:	48 83 c4 40          	add    $0x40,%rsp
+  8038b6:	5b                   	pop    %rbx
+  8038b7:	41 5f                	pop    %r15
+  8038b9:	5d                   	pop    %rbp
+  8038ba:	c3                   	ret
+
+00000000008038bb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8038bb:	55                   	push   %rbp
+  8038bc:	48 89 e5             	mov    %rsp,%rbp
+  8038bf:	41 57                	push   %r15
+  8038c1:	53                   	push   %rbx
+  8038c2:	48 83 ec 40          	sub    $0x40,%rsp
+  8038c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038c6 <read+0xb>
+  8038cd:	49 bb 7a 57 00 00 00 	movabs $0x577a,%r11
+  8038d4:	00 00 00 
+  8038d7:	4c 01 db             	add    %r11,%rbx
+  8038da:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8038dd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038e1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8038e5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8038e9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8038ec:	48 89 d6             	mov    %rdx,%rsi
+  8038ef:	89 c7                	mov    %eax,%edi
+  8038f1:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  8038f8:	ff ff ff 
+  8038fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038ff:	ff d0                	call   *%rax
+  803901:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803904:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803908:	78 28                	js     803932 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80390a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80390e:	8b 00                	mov    (%rax),%eax
+  803910:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803914:	48 89 d6             	mov    %rdx,%rsi
+  803917:	89 c7                	mov    %eax,%edi
+  803919:	48 b8 da a4 ff ff ff 	movabs $0xffffffffffffa4da,%rax
+  803920:	ff ff ff 
+  803923:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803927:	ff d0                	call   *%rax
+  803929:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80392c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803930:	79 08                	jns    80393a <read+0x7f>
+		return r;
+  803932:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803935:	e9 8b 00 00 00       	jmp    8039c5 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80393a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80393e:	8b 40 08             	mov    0x8(%rax),%eax
+  803941:	83 e0 03             	and    $0x3,%eax
+  803944:	83 f8 01             	cmp    $0x1,%eax
+  803947:	75 4b                	jne    803994 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803949:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803950:	ff ff ff 
+  803953:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803957:	48 8b 00             	mov    (%rax),%rax
+  80395a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803960:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803963:	89 c6                	mov    %eax,%esi
+  803965:	48 b8 ef e1 ff ff ff 	movabs $0xffffffffffffe1ef,%rax
+  80396c:	ff ff ff 
+  80396f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803973:	48 89 c7             	mov    %rax,%rdi
+  803976:	49 89 df             	mov    %rbx,%r15
+  803979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80397e:	48 b9 51 74 ff ff ff 	movabs $0xffffffffffff7451,%rcx
+  803985:	ff ff ff 
+  803988:	48 01 d9             	add    %rbx,%rcx
+  80398b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80398d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803992:	eb 31                	jmp    8039c5 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803994:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803998:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80399c:	48 85 c0             	test   %rax,%rax
+  80399f:	75 07                	jne    8039a8 <read+0xed>
+		return -E_NOT_SUPP;
+  8039a1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8039a6:	eb 1d                	jmp    8039c5 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8039a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ac:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8039b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039b4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8039b8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039bc:	48 89 ce             	mov    %rcx,%rsi
+  8039bf:	48 89 c7             	mov    %rax,%rdi
+  8039c2:	41 ff d0             	call   *%r8
+}
+  8039c5:	48 83 c4 40          	add    $0x40,%rsp
+  8039c9:	5b                   	pop    %rbx
+  8039ca:	41 5f                	pop    %r15
+  8039cc:	5d                   	pop    %rbp
+  8039cd:	c3                   	ret
+
+00000000008039ce <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8039ce:	55                   	push   %rbp
+  8039cf:	48 89 e5             	mov    %rsp,%rbp
+  8039d2:	53                   	push   %rbx
+  8039d3:	48 83 ec 38          	sub    $0x38,%rsp
+  8039d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039d7 <readn+0x9>
+  8039de:	49 bb 69 56 00 00 00 	movabs $0x5669,%r11
+  8039e5:	00 00 00 
+  8039e8:	4c 01 db             	add    %r11,%rbx
+  8039eb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039ee:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8039f2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8039f6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8039fd:	eb 4b                	jmp    803a4a <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8039ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a02:	48 98                	cltq
+  803a04:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a08:	48 29 c2             	sub    %rax,%rdx
+  803a0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a0e:	48 63 c8             	movslq %eax,%rcx
+  803a11:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a15:	48 01 c1             	add    %rax,%rcx
+  803a18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a1b:	48 89 ce             	mov    %rcx,%rsi
+  803a1e:	89 c7                	mov    %eax,%edi
+  803a20:	48 b8 7b a8 ff ff ff 	movabs $0xffffffffffffa87b,%rax
+  803a27:	ff ff ff 
+  803a2a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a2e:	ff d0                	call   *%rax
+  803a30:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803a33:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803a37:	79 05                	jns    803a3e <readn+0x70>
+			return m;
+  803a39:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803a3c:	eb 1d                	jmp    803a5b <readn+0x8d>
+		if (m == 0)
+  803a3e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803a42:	74 13                	je     803a57 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803a44:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803a47:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803a4a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a4d:	48 98                	cltq
+  803a4f:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803a53:	72 aa                	jb     8039ff <readn+0x31>
+  803a55:	eb 01                	jmp    803a58 <readn+0x8a>
+			break;
+  803a57:	90                   	nop
+	}
+	return tot;
+  803a58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803a5b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a5f:	c9                   	leave
+  803a60:	c3                   	ret
+
+0000000000803a61 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803a61:	55                   	push   %rbp
+  803a62:	48 89 e5             	mov    %rsp,%rbp
+  803a65:	41 57                	push   %r15
+  803a67:	53                   	push   %rbx
+  803a68:	48 83 ec 40          	sub    $0x40,%rsp
+  803a6c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a6c <write+0xb>
+  803a73:	49 bb d4 55 00 00 00 	movabs $0x55d4,%r11
+  803a7a:	00 00 00 
+  803a7d:	4c 01 db             	add    %r11,%rbx
+  803a80:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803a83:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803a87:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803a8b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803a8f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803a92:	48 89 d6             	mov    %rdx,%rsi
+  803a95:	89 c7                	mov    %eax,%edi
+  803a97:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  803a9e:	ff ff ff 
+  803aa1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803aa5:	ff d0                	call   *%rax
+  803aa7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803aaa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803aae:	78 28                	js     803ad8 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ab0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ab4:	8b 00                	mov    (%rax),%eax
+  803ab6:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803aba:	48 89 d6             	mov    %rdx,%rsi
+  803abd:	89 c7                	mov    %eax,%edi
+  803abf:	48 b8 da a4 ff ff ff 	movabs $0xffffffffffffa4da,%rax
+  803ac6:	ff ff ff 
+  803ac9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803acd:	ff d0                	call   *%rax
+  803acf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ad2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ad6:	79 08                	jns    803ae0 <write+0x7f>
+		return r;
+  803ad8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803adb:	e9 8a 00 00 00       	jmp    803b6a <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803ae0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ae4:	8b 40 08             	mov    0x8(%rax),%eax
+  803ae7:	83 e0 03             	and    $0x3,%eax
+  803aea:	85 c0                	test   %eax,%eax
+  803aec:	75 4b                	jne    803b39 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803aee:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803af5:	ff ff ff 
+  803af8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803afc:	48 8b 00             	mov    (%rax),%rax
+  803aff:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803b05:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803b08:	89 c6                	mov    %eax,%esi
+  803b0a:	48 b8 0b e2 ff ff ff 	movabs $0xffffffffffffe20b,%rax
+  803b11:	ff ff ff 
+  803b14:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b18:	48 89 c7             	mov    %rax,%rdi
+  803b1b:	49 89 df             	mov    %rbx,%r15
+  803b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b23:	48 b9 51 74 ff ff ff 	movabs $0xffffffffffff7451,%rcx
+  803b2a:	ff ff ff 
+  803b2d:	48 01 d9             	add    %rbx,%rcx
+  803b30:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803b32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b37:	eb 31                	jmp    803b6a <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803b39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b3d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803b41:	48 85 c0             	test   %rax,%rax
+  803b44:	75 07                	jne    803b4d <write+0xec>
+		return -E_NOT_SUPP;
+  803b46:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803b4b:	eb 1d                	jmp    803b6a <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803b4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b51:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803b55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b59:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803b5d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b61:	48 89 ce             	mov    %rcx,%rsi
+  803b64:	48 89 c7             	mov    %rax,%rdi
+  803b67:	41 ff d0             	call   *%r8
+}
+  803b6a:	48 83 c4 40          	add    $0x40,%rsp
+  803b6e:	5b                   	pop    %rbx
+  803b6f:	41 5f                	pop    %r15
+  803b71:	5d                   	pop    %rbp
+  803b72:	c3                   	ret
+
+0000000000803b73 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803b73:	55                   	push   %rbp
+  803b74:	48 89 e5             	mov    %rsp,%rbp
+  803b77:	48 83 ec 18          	sub    $0x18,%rsp
+  803b7b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b7b <seek+0x8>
+  803b82:	49 bb c5 54 00 00 00 	movabs $0x54c5,%r11
+  803b89:	00 00 00 
+  803b8c:	4c 01 d8             	add    %r11,%rax
+  803b8f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b92:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b95:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803b99:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803b9c:	48 89 ce             	mov    %rcx,%rsi
+  803b9f:	89 d7                	mov    %edx,%edi
+  803ba1:	48 ba 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rdx
+  803ba8:	ff ff ff 
+  803bab:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803baf:	ff d0                	call   *%rax
+  803bb1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bb4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bb8:	79 05                	jns    803bbf <seek+0x4c>
+		return r;
+  803bba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bbd:	eb 0f                	jmp    803bce <seek+0x5b>
+	fd->fd_offset = offset;
+  803bbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bc3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803bc6:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bce:	c9                   	leave
+  803bcf:	c3                   	ret
+
+0000000000803bd0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803bd0:	55                   	push   %rbp
+  803bd1:	48 89 e5             	mov    %rsp,%rbp
+  803bd4:	41 57                	push   %r15
+  803bd6:	53                   	push   %rbx
+  803bd7:	48 83 ec 30          	sub    $0x30,%rsp
+  803bdb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bdb <ftruncate+0xb>
+  803be2:	49 bb 65 54 00 00 00 	movabs $0x5465,%r11
+  803be9:	00 00 00 
+  803bec:	4c 01 db             	add    %r11,%rbx
+  803bef:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803bf2:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803bf5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803bf9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803bfc:	48 89 d6             	mov    %rdx,%rsi
+  803bff:	89 c7                	mov    %eax,%edi
+  803c01:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  803c08:	ff ff ff 
+  803c0b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c0f:	ff d0                	call   *%rax
+  803c11:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c14:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c18:	78 28                	js     803c42 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c1e:	8b 00                	mov    (%rax),%eax
+  803c20:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803c24:	48 89 d6             	mov    %rdx,%rsi
+  803c27:	89 c7                	mov    %eax,%edi
+  803c29:	48 b8 da a4 ff ff ff 	movabs $0xffffffffffffa4da,%rax
+  803c30:	ff ff ff 
+  803c33:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c37:	ff d0                	call   *%rax
+  803c39:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c3c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c40:	79 08                	jns    803c4a <ftruncate+0x7a>
+		return r;
+  803c42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c45:	e9 83 00 00 00       	jmp    803ccd <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803c4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c4e:	8b 40 08             	mov    0x8(%rax),%eax
+  803c51:	83 e0 03             	and    $0x3,%eax
+  803c54:	85 c0                	test   %eax,%eax
+  803c56:	75 4b                	jne    803ca3 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803c58:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803c5f:	ff ff ff 
+  803c62:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c66:	48 8b 00             	mov    (%rax),%rax
+  803c69:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803c6f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803c72:	89 c6                	mov    %eax,%esi
+  803c74:	48 b8 28 e2 ff ff ff 	movabs $0xffffffffffffe228,%rax
+  803c7b:	ff ff ff 
+  803c7e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c82:	48 89 c7             	mov    %rax,%rdi
+  803c85:	49 89 df             	mov    %rbx,%r15
+  803c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c8d:	48 b9 51 74 ff ff ff 	movabs $0xffffffffffff7451,%rcx
+  803c94:	ff ff ff 
+  803c97:	48 01 d9             	add    %rbx,%rcx
+  803c9a:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803c9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ca1:	eb 2a                	jmp    803ccd <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803ca3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ca7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803cab:	48 85 c0             	test   %rax,%rax
+  803cae:	75 07                	jne    803cb7 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803cb0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803cb5:	eb 16                	jmp    803ccd <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803cb7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cbb:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803cbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cc3:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803cc6:	89 d6                	mov    %edx,%esi
+  803cc8:	48 89 c7             	mov    %rax,%rdi
+  803ccb:	ff d1                	call   *%rcx
+}
+  803ccd:	48 83 c4 30          	add    $0x30,%rsp
+  803cd1:	5b                   	pop    %rbx
+  803cd2:	41 5f                	pop    %r15
+  803cd4:	5d                   	pop    %rbp
+  803cd5:	c3                   	ret
+
+0000000000803cd6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803cd6:	55                   	push   %rbp
+  803cd7:	48 89 e5             	mov    %rsp,%rbp
+  803cda:	53                   	push   %rbx
+  803cdb:	48 83 ec 38          	sub    $0x38,%rsp
+  803cdf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cdf <fstat+0x9>
+  803ce6:	49 bb 61 53 00 00 00 	movabs $0x5361,%r11
+  803ced:	00 00 00 
+  803cf0:	4c 01 db             	add    %r11,%rbx
+  803cf3:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803cf6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803cfa:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803cfe:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803d01:	48 89 d6             	mov    %rdx,%rsi
+  803d04:	89 c7                	mov    %eax,%edi
+  803d06:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  803d0d:	ff ff ff 
+  803d10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d14:	ff d0                	call   *%rax
+  803d16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d19:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d1d:	78 28                	js     803d47 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d23:	8b 00                	mov    (%rax),%eax
+  803d25:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803d29:	48 89 d6             	mov    %rdx,%rsi
+  803d2c:	89 c7                	mov    %eax,%edi
+  803d2e:	48 b8 da a4 ff ff ff 	movabs $0xffffffffffffa4da,%rax
+  803d35:	ff ff ff 
+  803d38:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d3c:	ff d0                	call   *%rax
+  803d3e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d41:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d45:	79 05                	jns    803d4c <fstat+0x76>
+		return r;
+  803d47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d4a:	eb 5e                	jmp    803daa <fstat+0xd4>
+	if (!dev->dev_stat)
+  803d4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d50:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803d54:	48 85 c0             	test   %rax,%rax
+  803d57:	75 07                	jne    803d60 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803d59:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803d5e:	eb 4a                	jmp    803daa <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803d60:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d64:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803d67:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d6b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803d72:	00 00 00 
+	stat->st_isdir = 0;
+  803d75:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d79:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803d80:	00 00 00 
+	stat->st_dev = dev;
+  803d83:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d87:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d8b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  803d92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d96:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803d9a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803da2:	48 89 d6             	mov    %rdx,%rsi
+  803da5:	48 89 c7             	mov    %rax,%rdi
+  803da8:	ff d1                	call   *%rcx
+}
+  803daa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803dae:	c9                   	leave
+  803daf:	c3                   	ret
+
+0000000000803db0 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803db0:	55                   	push   %rbp
+  803db1:	48 89 e5             	mov    %rsp,%rbp
+  803db4:	41 57                	push   %r15
+  803db6:	53                   	push   %rbx
+  803db7:	48 83 ec 20          	sub    $0x20,%rsp
+  803dbb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803dbb <stat+0xb>
+  803dc2:	49 bb 85 52 00 00 00 	movabs $0x5285,%r11
+  803dc9:	00 00 00 
+  803dcc:	4c 01 db             	add    %r11,%rbx
+  803dcf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803dd3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803dd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ddb:	be 00 00 00 00       	mov    $0x0,%esi
+  803de0:	48 89 c7             	mov    %rax,%rdi
+  803de3:	49 89 df             	mov    %rbx,%r15
+  803de6:	48 b8 4a b0 ff ff ff 	movabs $0xffffffffffffb04a,%rax
+  803ded:	ff ff ff 
+  803df0:	48 01 d8             	add    %rbx,%rax
+  803df3:	ff d0                	call   *%rax
+  803df5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803df8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803dfc:	79 05                	jns    803e03 <stat+0x53>
+		return fd;
+  803dfe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e01:	eb 37                	jmp    803e3a <stat+0x8a>
+	r = fstat(fd, stat);
+  803e03:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e07:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e0a:	48 89 d6             	mov    %rdx,%rsi
+  803e0d:	89 c7                	mov    %eax,%edi
+  803e0f:	48 b8 96 ac ff ff ff 	movabs $0xffffffffffffac96,%rax
+  803e16:	ff ff ff 
+  803e19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e1d:	ff d0                	call   *%rax
+  803e1f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803e22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e25:	89 c7                	mov    %eax,%edi
+  803e27:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  803e2e:	ff ff ff 
+  803e31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e35:	ff d0                	call   *%rax
+	return r;
+  803e37:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803e3a:	48 83 c4 20          	add    $0x20,%rsp
+  803e3e:	5b                   	pop    %rbx
+  803e3f:	41 5f                	pop    %r15
+  803e41:	5d                   	pop    %rbp
+  803e42:	c3                   	ret
+
+0000000000803e43 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803e43:	55                   	push   %rbp
+  803e44:	48 89 e5             	mov    %rsp,%rbp
+  803e47:	41 57                	push   %r15
+  803e49:	53                   	push   %rbx
+  803e4a:	48 83 ec 10          	sub    $0x10,%rsp
+  803e4e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e4e <fsipc+0xb>
+  803e55:	49 bb f2 51 00 00 00 	movabs $0x51f2,%r11
+  803e5c:	00 00 00 
+  803e5f:	4c 01 db             	add    %r11,%rbx
+  803e62:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e65:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803e69:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803e70:	00 00 00 
+  803e73:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803e76:	85 c0                	test   %eax,%eax
+  803e78:	75 24                	jne    803e9e <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803e7a:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e7f:	49 89 df             	mov    %rbx,%r15
+  803e82:	48 b8 25 db ff ff ff 	movabs $0xffffffffffffdb25,%rax
+  803e89:	ff ff ff 
+  803e8c:	48 01 d8             	add    %rbx,%rax
+  803e8f:	ff d0                	call   *%rax
+  803e91:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  803e98:	00 00 00 
+  803e9b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803e9e:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803ea5:	00 00 00 
+  803ea8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803eab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803eaf:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803eb2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803eb8:	49 89 d0             	mov    %rdx,%r8
+  803ebb:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803ec0:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  803ec7:	00 00 00 
+  803eca:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803ece:	89 c7                	mov    %eax,%edi
+  803ed0:	49 89 df             	mov    %rbx,%r15
+  803ed3:	48 b8 44 d5 ff ff ff 	movabs $0xffffffffffffd544,%rax
+  803eda:	ff ff ff 
+  803edd:	48 01 d8             	add    %rbx,%rax
+  803ee0:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803ee2:	48 83 c4 10          	add    $0x10,%rsp
+  803ee6:	5b                   	pop    %rbx
+  803ee7:	41 5f                	pop    %r15
+  803ee9:	5d                   	pop    %rbp
+  803eea:	c3                   	ret
+
+0000000000803eeb <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803eeb:	55                   	push   %rbp
+  803eec:	48 89 e5             	mov    %rsp,%rbp
+  803eef:	41 57                	push   %r15
+  803ef1:	53                   	push   %rbx
+  803ef2:	48 83 ec 20          	sub    $0x20,%rsp
+  803ef6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ef6 <fsipc_words+0xb>
+  803efd:	49 bb 4a 51 00 00 00 	movabs $0x514a,%r11
+  803f04:	00 00 00 
+  803f07:	4c 01 db             	add    %r11,%rbx
+  803f0a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f0d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803f11:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803f15:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803f1c:	00 00 00 
+  803f1f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803f22:	85 c0                	test   %eax,%eax
+  803f24:	75 24                	jne    803f4a <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803f26:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f2b:	49 89 df             	mov    %rbx,%r15
+  803f2e:	48 b8 25 db ff ff ff 	movabs $0xffffffffffffdb25,%rax
+  803f35:	ff ff ff 
+  803f38:	48 01 d8             	add    %rbx,%rax
+  803f3b:	ff d0                	call   *%rax
+  803f3d:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  803f44:	00 00 00 
+  803f47:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803f4a:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803f51:	00 00 00 
+  803f54:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803f57:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803f5b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803f5f:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803f62:	89 c7                	mov    %eax,%edi
+  803f64:	49 89 df             	mov    %rbx,%r15
+  803f67:	48 b8 2f d6 ff ff ff 	movabs $0xffffffffffffd62f,%rax
+  803f6e:	ff ff ff 
+  803f71:	48 01 d8             	add    %rbx,%rax
+  803f74:	ff d0                	call   *%rax
+}
+  803f76:	48 83 c4 20          	add    $0x20,%rsp
+  803f7a:	5b                   	pop    %rbx
+  803f7b:	41 5f                	pop    %r15
+  803f7d:	5d                   	pop    %rbp
+  803f7e:	c3                   	ret
+
+0000000000803f7f <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803f7f:	55                   	push   %rbp
+  803f80:	48 89 e5             	mov    %rsp,%rbp
+  803f83:	41 57                	push   %r15
+  803f85:	53                   	push   %rbx
+  803f86:	48 83 ec 40          	sub    $0x40,%rsp
+  803f8a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f8a <fsipc_pages+0xb>
+  803f91:	49 bb b6 50 00 00 00 	movabs $0x50b6,%r11
+  803f98:	00 00 00 
+  803f9b:	4c 01 db             	add    %r11,%rbx
+  803f9e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803fa1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803fa5:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803fa9:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803fac:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803fb3:	00 00 00 
+  803fb6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803fb9:	85 c0                	test   %eax,%eax
+  803fbb:	75 24                	jne    803fe1 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803fbd:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fc2:	49 89 df             	mov    %rbx,%r15
+  803fc5:	48 b8 25 db ff ff ff 	movabs $0xffffffffffffdb25,%rax
+  803fcc:	ff ff ff 
+  803fcf:	48 01 d8             	add    %rbx,%rax
+  803fd2:	ff d0                	call   *%rax
+  803fd4:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  803fdb:	00 00 00 
+  803fde:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803fe1:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803fe6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803fea:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803fed:	48 98                	cltq
+  803fef:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  803ff3:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803ff7:	0f 95 c0             	setne  %al
+  803ffa:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803ffd:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804004:	00 
+  804005:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804009:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80400d:	48 01 d0             	add    %rdx,%rax
+  804010:	48 83 e8 01          	sub    $0x1,%rax
+  804014:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804018:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80401c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804021:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804025:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804029:	48 29 d0             	sub    %rdx,%rax
+  80402c:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804030:	41 89 c2             	mov    %eax,%r10d
+  804033:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80403a:	00 00 00 
+  80403d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804040:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804044:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804048:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80404b:	48 83 ec 08          	sub    $0x8,%rsp
+  80404f:	6a 40                	push   $0x40
+  804051:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804056:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  80405d:	00 
+  80405e:	6a 05                	push   $0x5
+  804060:	41 89 f9             	mov    %edi,%r9d
+  804063:	49 89 c8             	mov    %rcx,%r8
+  804066:	44 89 d1             	mov    %r10d,%ecx
+  804069:	89 c7                	mov    %eax,%edi
+  80406b:	49 89 df             	mov    %rbx,%r15
+  80406e:	48 b8 2d d7 ff ff ff 	movabs $0xffffffffffffd72d,%rax
+  804075:	ff ff ff 
+  804078:	48 01 d8             	add    %rbx,%rax
+  80407b:	ff d0                	call   *%rax
+  80407d:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804081:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804085:	5b                   	pop    %rbx
+  804086:	41 5f                	pop    %r15
+  804088:	5d                   	pop    %rbp
+  804089:	c3                   	ret
+
+000000000080408a <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  80408a:	55                   	push   %rbp
+  80408b:	48 89 e5             	mov    %rsp,%rbp
+  80408e:	41 57                	push   %r15
+  804090:	53                   	push   %rbx
+  804091:	48 83 ec 20          	sub    $0x20,%rsp
+  804095:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804095 <open+0xb>
+  80409c:	49 bb ab 4f 00 00 00 	movabs $0x4fab,%r11
+  8040a3:	00 00 00 
+  8040a6:	4c 01 db             	add    %r11,%rbx
+  8040a9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8040ad:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8040b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040b4:	48 89 c7             	mov    %rax,%rdi
+  8040b7:	49 89 df             	mov    %rbx,%r15
+  8040ba:	48 b8 7f 81 ff ff ff 	movabs $0xffffffffffff817f,%rax
+  8040c1:	ff ff ff 
+  8040c4:	48 01 d8             	add    %rbx,%rax
+  8040c7:	ff d0                	call   *%rax
+  8040c9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8040ce:	7e 0a                	jle    8040da <open+0x50>
+		return -E_BAD_PATH;
+  8040d0:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8040d5:	e9 18 01 00 00       	jmp    8041f2 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8040da:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8040de:	48 89 c7             	mov    %rax,%rdi
+  8040e1:	49 89 df             	mov    %rbx,%r15
+  8040e4:	48 b8 7e a2 ff ff ff 	movabs $0xffffffffffffa27e,%rax
+  8040eb:	ff ff ff 
+  8040ee:	48 01 d8             	add    %rbx,%rax
+  8040f1:	ff d0                	call   *%rax
+  8040f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040fa:	74 08                	je     804104 <open+0x7a>
+		return r;
+  8040fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040ff:	e9 ee 00 00 00       	jmp    8041f2 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804104:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80410b:	00 00 00 
+  80410e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804111:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804118:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80411c:	48 89 c6             	mov    %rax,%rsi
+  80411f:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804126:	00 00 00 
+  804129:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80412d:	48 89 c7             	mov    %rax,%rdi
+  804130:	49 89 df             	mov    %rbx,%r15
+  804133:	48 b8 13 82 ff ff ff 	movabs $0xffffffffffff8213,%rax
+  80413a:	ff ff ff 
+  80413d:	48 01 d8             	add    %rbx,%rax
+  804140:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804142:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804146:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  80414b:	48 89 c6             	mov    %rax,%rsi
+  80414e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804153:	49 89 df             	mov    %rbx,%r15
+  804156:	48 b8 cf 8e ff ff ff 	movabs $0xffffffffffff8ecf,%rax
+  80415d:	ff ff ff 
+  804160:	48 01 d8             	add    %rbx,%rax
+  804163:	ff d0                	call   *%rax
+  804165:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804168:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80416c:	74 23                	je     804191 <open+0x107>
+		fd_close(fd,0);
+  80416e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804172:	be 00 00 00 00       	mov    $0x0,%esi
+  804177:	48 89 c7             	mov    %rax,%rdi
+  80417a:	49 89 df             	mov    %rbx,%r15
+  80417d:	48 b8 df a3 ff ff ff 	movabs $0xffffffffffffa3df,%rax
+  804184:	ff ff ff 
+  804187:	48 01 d8             	add    %rbx,%rax
+  80418a:	ff d0                	call   *%rax
+		return r;
+  80418c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80418f:	eb 61                	jmp    8041f2 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804191:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804195:	48 89 c6             	mov    %rax,%rsi
+  804198:	bf 01 00 00 00       	mov    $0x1,%edi
+  80419d:	48 b8 03 ae ff ff ff 	movabs $0xffffffffffffae03,%rax
+  8041a4:	ff ff ff 
+  8041a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041ab:	ff d0                	call   *%rax
+  8041ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041b4:	74 23                	je     8041d9 <open+0x14f>
+		fd_close(fd,0);
+  8041b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8041bf:	48 89 c7             	mov    %rax,%rdi
+  8041c2:	49 89 df             	mov    %rbx,%r15
+  8041c5:	48 b8 df a3 ff ff ff 	movabs $0xffffffffffffa3df,%rax
+  8041cc:	ff ff ff 
+  8041cf:	48 01 d8             	add    %rbx,%rax
+  8041d2:	ff d0                	call   *%rax
+		return r;
+  8041d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041d7:	eb 19                	jmp    8041f2 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8041d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041dd:	48 89 c7             	mov    %rax,%rdi
+  8041e0:	49 89 df             	mov    %rbx,%r15
+  8041e3:	48 b8 04 a2 ff ff ff 	movabs $0xffffffffffffa204,%rax
+  8041ea:	ff ff ff 
+  8041ed:	48 01 d8             	add    %rbx,%rax
+  8041f0:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8041f2:	48 83 c4 20          	add    $0x20,%rsp
+  8041f6:	5b                   	pop    %rbx
+  8041f7:	41 5f                	pop    %r15
+  8041f9:	5d                   	pop    %rbp
+  8041fa:	c3                   	ret
+
+00000000008041fb <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8041fb:	55                   	push   %rbp
+  8041fc:	48 89 e5             	mov    %rsp,%rbp
+  8041ff:	48 83 ec 20          	sub    $0x20,%rsp
+  804203:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804203 <devfile_flush+0x8>
+  80420a:	49 bb 3d 4e 00 00 00 	movabs $0x4e3d,%r11
+  804211:	00 00 00 
+  804214:	4c 01 d8             	add    %r11,%rax
+  804217:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  80421b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80421f:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804222:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804225:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804229:	ba 04 00 00 00       	mov    $0x4,%edx
+  80422e:	48 89 ce             	mov    %rcx,%rsi
+  804231:	bf 06 00 00 00       	mov    $0x6,%edi
+  804236:	48 b9 ab ae ff ff ff 	movabs $0xffffffffffffaeab,%rcx
+  80423d:	ff ff ff 
+  804240:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804244:	ff d0                	call   *%rax
+}
+  804246:	c9                   	leave
+  804247:	c3                   	ret
+
+0000000000804248 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804248:	55                   	push   %rbp
+  804249:	48 89 e5             	mov    %rsp,%rbp
+  80424c:	41 57                	push   %r15
+  80424e:	53                   	push   %rbx
+  80424f:	48 83 ec 60          	sub    $0x60,%rsp
+  804253:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804253 <devfile_read+0xb>
+  80425a:	49 bb ed 4d 00 00 00 	movabs $0x4ded,%r11
+  804261:	00 00 00 
+  804264:	4c 01 db             	add    %r11,%rbx
+  804267:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80426b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80426f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804273:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804277:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  80427b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80427f:	8b 50 0c             	mov    0xc(%rax),%edx
+  804282:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804286:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804288:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80428c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804290:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804294:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804298:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80429d:	ba 10 00 00 00       	mov    $0x10,%edx
+  8042a2:	48 89 c6             	mov    %rax,%rsi
+  8042a5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8042aa:	48 b8 3f af ff ff ff 	movabs $0xffffffffffffaf3f,%rax
+  8042b1:	ff ff ff 
+  8042b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042b8:	ff d0                	call   *%rax
+  8042ba:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8042bd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8042c1:	79 05                	jns    8042c8 <devfile_read+0x80>
+		return r;
+  8042c3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8042c6:	eb 64                	jmp    80432c <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8042c8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8042cb:	48 63 d0             	movslq %eax,%rdx
+  8042ce:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8042d2:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8042d7:	48 01 c1             	add    %rax,%rcx
+  8042da:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8042de:	48 89 ce             	mov    %rcx,%rsi
+  8042e1:	48 89 c7             	mov    %rax,%rdi
+  8042e4:	49 89 df             	mov    %rbx,%r15
+  8042e7:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  8042ee:	ff ff ff 
+  8042f1:	48 01 d8             	add    %rbx,%rax
+  8042f4:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8042f6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8042fd:	ff ff ff 
+  804300:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804304:	48 8b 00             	mov    (%rax),%rax
+  804307:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  80430d:	89 c6                	mov    %eax,%esi
+  80430f:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804314:	48 89 c7             	mov    %rax,%rdi
+  804317:	49 89 df             	mov    %rbx,%r15
+  80431a:	48 b8 df da ff ff ff 	movabs $0xffffffffffffdadf,%rax
+  804321:	ff ff ff 
+  804324:	48 01 d8             	add    %rbx,%rax
+  804327:	ff d0                	call   *%rax
+	return r;
+  804329:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  80432c:	48 83 c4 60          	add    $0x60,%rsp
+  804330:	5b                   	pop    %rbx
+  804331:	41 5f                	pop    %r15
+  804333:	5d                   	pop    %rbp
+  804334:	c3                   	ret
+
+0000000000804335 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804335:	55                   	push   %rbp
+  804336:	48 89 e5             	mov    %rsp,%rbp
+  804339:	41 57                	push   %r15
+  80433b:	53                   	push   %rbx
+  80433c:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804340:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804340 <devfile_write+0xb>
+  804347:	49 bb 00 4d 00 00 00 	movabs $0x4d00,%r11
+  80434e:	00 00 00 
+  804351:	4c 01 db             	add    %r11,%rbx
+  804354:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804358:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  80435c:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804363:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804367:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  80436b:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804372:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804376:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  80437d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804380:	48 63 d0             	movslq %eax,%rdx
+  804383:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804387:	48 39 c2             	cmp    %rax,%rdx
+  80438a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80438e:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804395:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80439c:	00 
+  80439d:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8043a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043a8:	48 01 d0             	add    %rdx,%rax
+  8043ab:	48 83 e8 01          	sub    $0x1,%rax
+  8043af:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8043b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043bc:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8043c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043c4:	48 29 d0             	sub    %rdx,%rax
+  8043c7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043cb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8043ce:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8043d1:	89 c6                	mov    %eax,%esi
+  8043d3:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8043d8:	48 89 c7             	mov    %rax,%rdi
+  8043db:	49 89 df             	mov    %rbx,%r15
+  8043de:	48 b8 99 da ff ff ff 	movabs $0xffffffffffffda99,%rax
+  8043e5:	ff ff ff 
+  8043e8:	48 01 d8             	add    %rbx,%rax
+  8043eb:	ff d0                	call   *%rax
+  8043ed:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8043f0:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8043f4:	79 08                	jns    8043fe <devfile_write+0xc9>
+		return r;
+  8043f6:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8043f9:	e9 8f 00 00 00       	jmp    80448d <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8043fe:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804405:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804409:	48 89 c6             	mov    %rax,%rsi
+  80440c:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804411:	48 89 c7             	mov    %rax,%rdi
+  804414:	49 89 df             	mov    %rbx,%r15
+  804417:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  80441e:	ff ff ff 
+  804421:	48 01 d8             	add    %rbx,%rax
+  804424:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804426:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80442a:	8b 50 0c             	mov    0xc(%rax),%edx
+  80442d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804431:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804433:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804437:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80443e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804442:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804445:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804449:	89 d1                	mov    %edx,%ecx
+  80444b:	ba 10 00 00 00       	mov    $0x10,%edx
+  804450:	48 89 c6             	mov    %rax,%rsi
+  804453:	bf 04 00 00 00       	mov    $0x4,%edi
+  804458:	48 b8 3f af ff ff ff 	movabs $0xffffffffffffaf3f,%rax
+  80445f:	ff ff ff 
+  804462:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804466:	ff d0                	call   *%rax
+  804468:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80446b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80446e:	89 c6                	mov    %eax,%esi
+  804470:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804475:	48 89 c7             	mov    %rax,%rdi
+  804478:	49 89 df             	mov    %rbx,%r15
+  80447b:	48 b8 df da ff ff ff 	movabs $0xffffffffffffdadf,%rax
+  804482:	ff ff ff 
+  804485:	48 01 d8             	add    %rbx,%rax
+  804488:	ff d0                	call   *%rax
+	return r;
+  80448a:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80448d:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804491:	5b                   	pop    %rbx
+  804492:	41 5f                	pop    %r15
+  804494:	5d                   	pop    %rbp
+  804495:	c3                   	ret
+
+0000000000804496 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804496:	55                   	push   %rbp
+  804497:	48 89 e5             	mov    %rsp,%rbp
+  80449a:	41 57                	push   %r15
+  80449c:	53                   	push   %rbx
+  80449d:	48 83 ec 20          	sub    $0x20,%rsp
+  8044a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044a1 <devfile_stat+0xb>
+  8044a8:	49 bb 9f 4b 00 00 00 	movabs $0x4b9f,%r11
+  8044af:	00 00 00 
+  8044b2:	4c 01 db             	add    %r11,%rbx
+  8044b5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044b9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8044bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044c1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8044c4:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8044cb:	00 00 00 
+  8044ce:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8044d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8044d6:	bf 05 00 00 00       	mov    $0x5,%edi
+  8044db:	48 b8 03 ae ff ff ff 	movabs $0xffffffffffffae03,%rax
+  8044e2:	ff ff ff 
+  8044e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044e9:	ff d0                	call   *%rax
+  8044eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044f2:	79 05                	jns    8044f9 <devfile_stat+0x63>
+		return r;
+  8044f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044f7:	eb 65                	jmp    80455e <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8044f9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044fd:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804504:	00 00 00 
+  804507:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80450b:	48 89 d6             	mov    %rdx,%rsi
+  80450e:	48 89 c7             	mov    %rax,%rdi
+  804511:	49 89 df             	mov    %rbx,%r15
+  804514:	48 b8 13 82 ff ff ff 	movabs $0xffffffffffff8213,%rax
+  80451b:	ff ff ff 
+  80451e:	48 01 d8             	add    %rbx,%rax
+  804521:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804523:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80452a:	00 00 00 
+  80452d:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804534:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804538:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80453e:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804545:	00 00 00 
+  804548:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  80454f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804553:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804559:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80455e:	48 83 c4 20          	add    $0x20,%rsp
+  804562:	5b                   	pop    %rbx
+  804563:	41 5f                	pop    %r15
+  804565:	5d                   	pop    %rbp
+  804566:	c3                   	ret
+
+0000000000804567 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804567:	55                   	push   %rbp
+  804568:	48 89 e5             	mov    %rsp,%rbp
+  80456b:	48 83 ec 20          	sub    $0x20,%rsp
+  80456f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80456f <devfile_trunc+0x8>
+  804576:	49 bb d1 4a 00 00 00 	movabs $0x4ad1,%r11
+  80457d:	00 00 00 
+  804580:	4c 01 d8             	add    %r11,%rax
+  804583:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804587:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80458a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80458e:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804591:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804594:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804597:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80459a:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80459e:	ba 08 00 00 00       	mov    $0x8,%edx
+  8045a3:	48 89 ce             	mov    %rcx,%rsi
+  8045a6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8045ab:	48 b9 ab ae ff ff ff 	movabs $0xffffffffffffaeab,%rcx
+  8045b2:	ff ff ff 
+  8045b5:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8045b9:	ff d0                	call   *%rax
+}
+  8045bb:	c9                   	leave
+  8045bc:	c3                   	ret
+
+00000000008045bd <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8045bd:	55                   	push   %rbp
+  8045be:	48 89 e5             	mov    %rsp,%rbp
+  8045c1:	41 57                	push   %r15
+  8045c3:	53                   	push   %rbx
+  8045c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8045c8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045c8 <remove+0xb>
+  8045cf:	49 bb 78 4a 00 00 00 	movabs $0x4a78,%r11
+  8045d6:	00 00 00 
+  8045d9:	4c 01 db             	add    %r11,%rbx
+  8045dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8045e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045e4:	48 89 c7             	mov    %rax,%rdi
+  8045e7:	49 89 df             	mov    %rbx,%r15
+  8045ea:	48 b8 7f 81 ff ff ff 	movabs $0xffffffffffff817f,%rax
+  8045f1:	ff ff ff 
+  8045f4:	48 01 d8             	add    %rbx,%rax
+  8045f7:	ff d0                	call   *%rax
+  8045f9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8045fe:	7e 07                	jle    804607 <remove+0x4a>
+		return -E_BAD_PATH;
+  804600:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804605:	eb 44                	jmp    80464b <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804607:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80460b:	48 89 c6             	mov    %rax,%rsi
+  80460e:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804615:	00 00 00 
+  804618:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80461c:	48 89 c7             	mov    %rax,%rdi
+  80461f:	49 89 df             	mov    %rbx,%r15
+  804622:	48 b8 13 82 ff ff ff 	movabs $0xffffffffffff8213,%rax
+  804629:	ff ff ff 
+  80462c:	48 01 d8             	add    %rbx,%rax
+  80462f:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804631:	be 00 00 00 00       	mov    $0x0,%esi
+  804636:	bf 07 00 00 00       	mov    $0x7,%edi
+  80463b:	48 b8 03 ae ff ff ff 	movabs $0xffffffffffffae03,%rax
+  804642:	ff ff ff 
+  804645:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804649:	ff d0                	call   *%rax
+}
+  80464b:	48 83 c4 10          	add    $0x10,%rsp
+  80464f:	5b                   	pop    %rbx
+  804650:	41 5f                	pop    %r15
+  804652:	5d                   	pop    %rbp
+  804653:	c3                   	ret
+
+0000000000804654 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804654:	55                   	push   %rbp
+  804655:	48 89 e5             	mov    %rsp,%rbp
+  804658:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804658 <sync+0x4>
+  80465f:	49 bb e8 49 00 00 00 	movabs $0x49e8,%r11
+  804666:	00 00 00 
+  804669:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80466c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804671:	be 00 00 00 00       	mov    $0x0,%esi
+  804676:	bf 08 00 00 00       	mov    $0x8,%edi
+  80467b:	48 b9 ab ae ff ff ff 	movabs $0xffffffffffffaeab,%rcx
+  804682:	ff ff ff 
+  804685:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804689:	ff d0                	call   *%rax
+}
+  80468b:	5d                   	pop    %rbp
+  80468c:	c3                   	ret
+
+000000000080468d <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80468d:	55                   	push   %rbp
+  80468e:	48 89 e5             	mov    %rsp,%rbp
+  804691:	41 57                	push   %r15
+  804693:	53                   	push   %rbx
+  804694:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80469b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80469b <copy+0xe>
+  8046a2:	49 bb a5 49 00 00 00 	movabs $0x49a5,%r11
+  8046a9:	00 00 00 
+  8046ac:	4c 01 db             	add    %r11,%rbx
+  8046af:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8046b6:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8046bd:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8046c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8046c9:	48 89 c7             	mov    %rax,%rdi
+  8046cc:	48 b8 4a b0 ff ff ff 	movabs $0xffffffffffffb04a,%rax
+  8046d3:	ff ff ff 
+  8046d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046da:	ff d0                	call   *%rax
+  8046dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8046df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046e3:	79 35                	jns    80471a <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8046e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046e8:	89 c6                	mov    %eax,%esi
+  8046ea:	48 b8 4e e2 ff ff ff 	movabs $0xffffffffffffe24e,%rax
+  8046f1:	ff ff ff 
+  8046f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046f8:	48 89 c7             	mov    %rax,%rdi
+  8046fb:	49 89 df             	mov    %rbx,%r15
+  8046fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804703:	48 ba 51 74 ff ff ff 	movabs $0xffffffffffff7451,%rdx
+  80470a:	ff ff ff 
+  80470d:	48 01 da             	add    %rbx,%rdx
+  804710:	ff d2                	call   *%rdx
+		return fd_src;
+  804712:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804715:	e9 d7 01 00 00       	jmp    8048f1 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  80471a:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804721:	be 01 01 00 00       	mov    $0x101,%esi
+  804726:	48 89 c7             	mov    %rax,%rdi
+  804729:	48 b8 4a b0 ff ff ff 	movabs $0xffffffffffffb04a,%rax
+  804730:	ff ff ff 
+  804733:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804737:	ff d0                	call   *%rax
+  804739:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  80473c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804740:	0f 89 df 00 00 00    	jns    804825 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804746:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804749:	89 c6                	mov    %eax,%esi
+  80474b:	48 b8 64 e2 ff ff ff 	movabs $0xffffffffffffe264,%rax
+  804752:	ff ff ff 
+  804755:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804759:	48 89 c7             	mov    %rax,%rdi
+  80475c:	49 89 df             	mov    %rbx,%r15
+  80475f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804764:	48 ba 51 74 ff ff ff 	movabs $0xffffffffffff7451,%rdx
+  80476b:	ff ff ff 
+  80476e:	48 01 da             	add    %rbx,%rdx
+  804771:	ff d2                	call   *%rdx
+		close(fd_src);
+  804773:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804776:	89 c7                	mov    %eax,%edi
+  804778:	49 89 df             	mov    %rbx,%r15
+  80477b:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  804782:	ff ff ff 
+  804785:	48 01 d8             	add    %rbx,%rax
+  804788:	ff d0                	call   *%rax
+		return fd_dest;
+  80478a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80478d:	e9 5f 01 00 00       	jmp    8048f1 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804792:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804795:	48 63 d0             	movslq %eax,%rdx
+  804798:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80479f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8047a2:	48 89 ce             	mov    %rcx,%rsi
+  8047a5:	89 c7                	mov    %eax,%edi
+  8047a7:	49 89 df             	mov    %rbx,%r15
+  8047aa:	48 b8 21 aa ff ff ff 	movabs $0xffffffffffffaa21,%rax
+  8047b1:	ff ff ff 
+  8047b4:	48 01 d8             	add    %rbx,%rax
+  8047b7:	ff d0                	call   *%rax
+  8047b9:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8047bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8047c0:	79 63                	jns    804825 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8047c2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8047c5:	89 c6                	mov    %eax,%esi
+  8047c7:	48 b8 7e e2 ff ff ff 	movabs $0xffffffffffffe27e,%rax
+  8047ce:	ff ff ff 
+  8047d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047d5:	48 89 c7             	mov    %rax,%rdi
+  8047d8:	49 89 df             	mov    %rbx,%r15
+  8047db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e0:	48 ba 51 74 ff ff ff 	movabs $0xffffffffffff7451,%rdx
+  8047e7:	ff ff ff 
+  8047ea:	48 01 da             	add    %rbx,%rdx
+  8047ed:	ff d2                	call   *%rdx
+			close(fd_src);
+  8047ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047f2:	89 c7                	mov    %eax,%edi
+  8047f4:	49 89 df             	mov    %rbx,%r15
+  8047f7:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  8047fe:	ff ff ff 
+  804801:	48 01 d8             	add    %rbx,%rax
+  804804:	ff d0                	call   *%rax
+			close(fd_dest);
+  804806:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804809:	89 c7                	mov    %eax,%edi
+  80480b:	49 89 df             	mov    %rbx,%r15
+  80480e:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  804815:	ff ff ff 
+  804818:	48 01 d8             	add    %rbx,%rax
+  80481b:	ff d0                	call   *%rax
+			return write_size;
+  80481d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804820:	e9 cc 00 00 00       	jmp    8048f1 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804825:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80482c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80482f:	ba 00 02 00 00       	mov    $0x200,%edx
+  804834:	48 89 ce             	mov    %rcx,%rsi
+  804837:	89 c7                	mov    %eax,%edi
+  804839:	49 89 df             	mov    %rbx,%r15
+  80483c:	48 b8 7b a8 ff ff ff 	movabs $0xffffffffffffa87b,%rax
+  804843:	ff ff ff 
+  804846:	48 01 d8             	add    %rbx,%rax
+  804849:	ff d0                	call   *%rax
+  80484b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80484e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804852:	0f 8f 3a ff ff ff    	jg     804792 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804858:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80485c:	79 60                	jns    8048be <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  80485e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804861:	89 c6                	mov    %eax,%esi
+  804863:	48 b8 91 e2 ff ff ff 	movabs $0xffffffffffffe291,%rax
+  80486a:	ff ff ff 
+  80486d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804871:	48 89 c7             	mov    %rax,%rdi
+  804874:	49 89 df             	mov    %rbx,%r15
+  804877:	b8 00 00 00 00       	mov    $0x0,%eax
+  80487c:	48 ba 51 74 ff ff ff 	movabs $0xffffffffffff7451,%rdx
+  804883:	ff ff ff 
+  804886:	48 01 da             	add    %rbx,%rdx
+  804889:	ff d2                	call   *%rdx
+		close(fd_src);
+  80488b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80488e:	89 c7                	mov    %eax,%edi
+  804890:	49 89 df             	mov    %rbx,%r15
+  804893:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  80489a:	ff ff ff 
+  80489d:	48 01 d8             	add    %rbx,%rax
+  8048a0:	ff d0                	call   *%rax
+		close(fd_dest);
+  8048a2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8048a5:	89 c7                	mov    %eax,%edi
+  8048a7:	49 89 df             	mov    %rbx,%r15
+  8048aa:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  8048b1:	ff ff ff 
+  8048b4:	48 01 d8             	add    %rbx,%rax
+  8048b7:	ff d0                	call   *%rax
+		return read_size;
+  8048b9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8048bc:	eb 33                	jmp    8048f1 <copy+0x264>
+	}
+	close(fd_src);
+  8048be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048c1:	89 c7                	mov    %eax,%edi
+  8048c3:	49 89 df             	mov    %rbx,%r15
+  8048c6:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  8048cd:	ff ff ff 
+  8048d0:	48 01 d8             	add    %rbx,%rax
+  8048d3:	ff d0                	call   *%rax
+	close(fd_dest);
+  8048d5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8048d8:	89 c7                	mov    %eax,%edi
+  8048da:	49 89 df             	mov    %rbx,%r15
+  8048dd:	48 b8 c3 a5 ff ff ff 	movabs $0xffffffffffffa5c3,%rax
+  8048e4:	ff ff ff 
+  8048e7:	48 01 d8             	add    %rbx,%rax
+  8048ea:	ff d0                	call   *%rax
+	return 0;
+  8048ec:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8048f1:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8048f8:	5b                   	pop    %rbx
+  8048f9:	41 5f                	pop    %r15
+  8048fb:	5d                   	pop    %rbp
+  8048fc:	c3                   	ret
+
+00000000008048fd <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  8048fd:	55                   	push   %rbp
+  8048fe:	48 89 e5             	mov    %rsp,%rbp
+  804901:	41 57                	push   %r15
+  804903:	53                   	push   %rbx
+  804904:	48 83 ec 20          	sub    $0x20,%rsp
+  804908:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804908 <fd2sockid+0xb>
+  80490f:	49 bb 38 47 00 00 00 	movabs $0x4738,%r11
+  804916:	00 00 00 
+  804919:	4c 01 db             	add    %r11,%rbx
+  80491c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80491f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804923:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804926:	48 89 d6             	mov    %rdx,%rsi
+  804929:	89 c7                	mov    %eax,%edi
+  80492b:	49 89 df             	mov    %rbx,%r15
+  80492e:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  804935:	ff ff ff 
+  804938:	48 01 d8             	add    %rbx,%rax
+  80493b:	ff d0                	call   *%rax
+  80493d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804940:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804944:	79 05                	jns    80494b <fd2sockid+0x4e>
+		return r;
+  804946:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804949:	eb 25                	jmp    804970 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80494b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80494f:	8b 10                	mov    (%rax),%edx
+  804951:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  804958:	00 00 00 
+  80495b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80495e:	39 c2                	cmp    %eax,%edx
+  804960:	74 07                	je     804969 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804962:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804967:	eb 07                	jmp    804970 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804969:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80496d:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804970:	48 83 c4 20          	add    $0x20,%rsp
+  804974:	5b                   	pop    %rbx
+  804975:	41 5f                	pop    %r15
+  804977:	5d                   	pop    %rbp
+  804978:	c3                   	ret
+
+0000000000804979 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804979:	55                   	push   %rbp
+  80497a:	48 89 e5             	mov    %rsp,%rbp
+  80497d:	41 57                	push   %r15
+  80497f:	53                   	push   %rbx
+  804980:	48 83 ec 20          	sub    $0x20,%rsp
+  804984:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804984 <alloc_sockfd+0xb>
+  80498b:	49 bb bc 46 00 00 00 	movabs $0x46bc,%r11
+  804992:	00 00 00 
+  804995:	4c 01 db             	add    %r11,%rbx
+  804998:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  80499b:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80499f:	48 89 c7             	mov    %rax,%rdi
+  8049a2:	49 89 df             	mov    %rbx,%r15
+  8049a5:	48 b8 7e a2 ff ff ff 	movabs $0xffffffffffffa27e,%rax
+  8049ac:	ff ff ff 
+  8049af:	48 01 d8             	add    %rbx,%rax
+  8049b2:	ff d0                	call   *%rax
+  8049b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049bb:	78 2c                	js     8049e9 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8049bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049c1:	ba 07 04 00 00       	mov    $0x407,%edx
+  8049c6:	48 89 c6             	mov    %rax,%rsi
+  8049c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049ce:	49 89 df             	mov    %rbx,%r15
+  8049d1:	48 b8 cf 8e ff ff ff 	movabs $0xffffffffffff8ecf,%rax
+  8049d8:	ff ff ff 
+  8049db:	48 01 d8             	add    %rbx,%rax
+  8049de:	ff d0                	call   *%rax
+  8049e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049e7:	79 1c                	jns    804a05 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8049e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8049ec:	89 c7                	mov    %eax,%edi
+  8049ee:	49 89 df             	mov    %rbx,%r15
+  8049f1:	48 b8 2d c1 ff ff ff 	movabs $0xffffffffffffc12d,%rax
+  8049f8:	ff ff ff 
+  8049fb:	48 01 d8             	add    %rbx,%rax
+  8049fe:	ff d0                	call   *%rax
+		return r;
+  804a00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a03:	eb 41                	jmp    804a46 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804a05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a09:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  804a10:	00 00 00 
+  804a13:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804a16:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804a18:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a1c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804a23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a27:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804a2a:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804a2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a31:	48 89 c7             	mov    %rax,%rdi
+  804a34:	49 89 df             	mov    %rbx,%r15
+  804a37:	48 b8 04 a2 ff ff ff 	movabs $0xffffffffffffa204,%rax
+  804a3e:	ff ff ff 
+  804a41:	48 01 d8             	add    %rbx,%rax
+  804a44:	ff d0                	call   *%rax
+}
+  804a46:	48 83 c4 20          	add    $0x20,%rsp
+  804a4a:	5b                   	pop    %rbx
+  804a4b:	41 5f                	pop    %r15
+  804a4d:	5d                   	pop    %rbp
+  804a4e:	c3                   	ret
+
+0000000000804a4f <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804a4f:	55                   	push   %rbp
+  804a50:	48 89 e5             	mov    %rsp,%rbp
+  804a53:	41 57                	push   %r15
+  804a55:	53                   	push   %rbx
+  804a56:	48 83 ec 30          	sub    $0x30,%rsp
+  804a5a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a5a <accept+0xb>
+  804a61:	49 bb e6 45 00 00 00 	movabs $0x45e6,%r11
+  804a68:	00 00 00 
+  804a6b:	4c 01 db             	add    %r11,%rbx
+  804a6e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804a71:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a75:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804a79:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a7c:	89 c7                	mov    %eax,%edi
+  804a7e:	48 b8 bd b8 ff ff ff 	movabs $0xffffffffffffb8bd,%rax
+  804a85:	ff ff ff 
+  804a88:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a8c:	ff d0                	call   *%rax
+  804a8e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a91:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a95:	79 05                	jns    804a9c <accept+0x4d>
+		return r;
+  804a97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a9a:	eb 45                	jmp    804ae1 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804a9c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804aa0:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804aa4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aa7:	48 89 ce             	mov    %rcx,%rsi
+  804aaa:	89 c7                	mov    %eax,%edi
+  804aac:	49 89 df             	mov    %rbx,%r15
+  804aaf:	48 b8 9b bf ff ff ff 	movabs $0xffffffffffffbf9b,%rax
+  804ab6:	ff ff ff 
+  804ab9:	48 01 d8             	add    %rbx,%rax
+  804abc:	ff d0                	call   *%rax
+  804abe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ac1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ac5:	79 05                	jns    804acc <accept+0x7d>
+		return r;
+  804ac7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aca:	eb 15                	jmp    804ae1 <accept+0x92>
+	return alloc_sockfd(r);
+  804acc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804acf:	89 c7                	mov    %eax,%edi
+  804ad1:	48 b8 39 b9 ff ff ff 	movabs $0xffffffffffffb939,%rax
+  804ad8:	ff ff ff 
+  804adb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804adf:	ff d0                	call   *%rax
+}
+  804ae1:	48 83 c4 30          	add    $0x30,%rsp
+  804ae5:	5b                   	pop    %rbx
+  804ae6:	41 5f                	pop    %r15
+  804ae8:	5d                   	pop    %rbp
+  804ae9:	c3                   	ret
+
+0000000000804aea <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804aea:	55                   	push   %rbp
+  804aeb:	48 89 e5             	mov    %rsp,%rbp
+  804aee:	41 57                	push   %r15
+  804af0:	53                   	push   %rbx
+  804af1:	48 83 ec 20          	sub    $0x20,%rsp
+  804af5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804af5 <bind+0xb>
+  804afc:	49 bb 4b 45 00 00 00 	movabs $0x454b,%r11
+  804b03:	00 00 00 
+  804b06:	4c 01 db             	add    %r11,%rbx
+  804b09:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804b0c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804b10:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804b13:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b16:	89 c7                	mov    %eax,%edi
+  804b18:	48 b8 bd b8 ff ff ff 	movabs $0xffffffffffffb8bd,%rax
+  804b1f:	ff ff ff 
+  804b22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b26:	ff d0                	call   *%rax
+  804b28:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b2b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b2f:	79 05                	jns    804b36 <bind+0x4c>
+		return r;
+  804b31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b34:	eb 21                	jmp    804b57 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804b36:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804b39:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804b3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b40:	48 89 ce             	mov    %rcx,%rsi
+  804b43:	89 c7                	mov    %eax,%edi
+  804b45:	49 89 df             	mov    %rbx,%r15
+  804b48:	48 b8 47 c0 ff ff ff 	movabs $0xffffffffffffc047,%rax
+  804b4f:	ff ff ff 
+  804b52:	48 01 d8             	add    %rbx,%rax
+  804b55:	ff d0                	call   *%rax
+}
+  804b57:	48 83 c4 20          	add    $0x20,%rsp
+  804b5b:	5b                   	pop    %rbx
+  804b5c:	41 5f                	pop    %r15
+  804b5e:	5d                   	pop    %rbp
+  804b5f:	c3                   	ret
+
+0000000000804b60 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804b60:	55                   	push   %rbp
+  804b61:	48 89 e5             	mov    %rsp,%rbp
+  804b64:	41 57                	push   %r15
+  804b66:	53                   	push   %rbx
+  804b67:	48 83 ec 20          	sub    $0x20,%rsp
+  804b6b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b6b <shutdown+0xb>
+  804b72:	49 bb d5 44 00 00 00 	movabs $0x44d5,%r11
+  804b79:	00 00 00 
+  804b7c:	4c 01 db             	add    %r11,%rbx
+  804b7f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804b82:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804b85:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b88:	89 c7                	mov    %eax,%edi
+  804b8a:	48 b8 bd b8 ff ff ff 	movabs $0xffffffffffffb8bd,%rax
+  804b91:	ff ff ff 
+  804b94:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b98:	ff d0                	call   *%rax
+  804b9a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b9d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ba1:	79 05                	jns    804ba8 <shutdown+0x48>
+		return r;
+  804ba3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ba6:	eb 1c                	jmp    804bc4 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804ba8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804bab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bae:	89 d6                	mov    %edx,%esi
+  804bb0:	89 c7                	mov    %eax,%edi
+  804bb2:	49 89 df             	mov    %rbx,%r15
+  804bb5:	48 b8 dc c0 ff ff ff 	movabs $0xffffffffffffc0dc,%rax
+  804bbc:	ff ff ff 
+  804bbf:	48 01 d8             	add    %rbx,%rax
+  804bc2:	ff d0                	call   *%rax
+}
+  804bc4:	48 83 c4 20          	add    $0x20,%rsp
+  804bc8:	5b                   	pop    %rbx
+  804bc9:	41 5f                	pop    %r15
+  804bcb:	5d                   	pop    %rbp
+  804bcc:	c3                   	ret
+
+0000000000804bcd <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804bcd:	55                   	push   %rbp
+  804bce:	48 89 e5             	mov    %rsp,%rbp
+  804bd1:	41 57                	push   %r15
+  804bd3:	53                   	push   %rbx
+  804bd4:	48 83 ec 10          	sub    $0x10,%rsp
+  804bd8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804bd8 <devsock_close+0xb>
+  804bdf:	49 bb 68 44 00 00 00 	movabs $0x4468,%r11
+  804be6:	00 00 00 
+  804be9:	4c 01 db             	add    %r11,%rbx
+  804bec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804bf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bf4:	48 89 c7             	mov    %rax,%rdi
+  804bf7:	49 89 df             	mov    %rbx,%r15
+  804bfa:	48 b8 b4 db ff ff ff 	movabs $0xffffffffffffdbb4,%rax
+  804c01:	ff ff ff 
+  804c04:	48 01 d8             	add    %rbx,%rax
+  804c07:	ff d0                	call   *%rax
+  804c09:	83 f8 01             	cmp    $0x1,%eax
+  804c0c:	75 1d                	jne    804c2b <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804c0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c12:	8b 40 0c             	mov    0xc(%rax),%eax
+  804c15:	89 c7                	mov    %eax,%edi
+  804c17:	49 89 df             	mov    %rbx,%r15
+  804c1a:	48 b8 2d c1 ff ff ff 	movabs $0xffffffffffffc12d,%rax
+  804c21:	ff ff ff 
+  804c24:	48 01 d8             	add    %rbx,%rax
+  804c27:	ff d0                	call   *%rax
+  804c29:	eb 05                	jmp    804c30 <devsock_close+0x63>
+	else
+		return 0;
+  804c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c30:	48 83 c4 10          	add    $0x10,%rsp
+  804c34:	5b                   	pop    %rbx
+  804c35:	41 5f                	pop    %r15
+  804c37:	5d                   	pop    %rbp
+  804c38:	c3                   	ret
+
+0000000000804c39 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804c39:	55                   	push   %rbp
+  804c3a:	48 89 e5             	mov    %rsp,%rbp
+  804c3d:	41 57                	push   %r15
+  804c3f:	53                   	push   %rbx
+  804c40:	48 83 ec 20          	sub    $0x20,%rsp
+  804c44:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c44 <connect+0xb>
+  804c4b:	49 bb fc 43 00 00 00 	movabs $0x43fc,%r11
+  804c52:	00 00 00 
+  804c55:	4c 01 db             	add    %r11,%rbx
+  804c58:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804c5b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804c5f:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804c62:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c65:	89 c7                	mov    %eax,%edi
+  804c67:	48 b8 bd b8 ff ff ff 	movabs $0xffffffffffffb8bd,%rax
+  804c6e:	ff ff ff 
+  804c71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c75:	ff d0                	call   *%rax
+  804c77:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c7a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c7e:	79 05                	jns    804c85 <connect+0x4c>
+		return r;
+  804c80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c83:	eb 21                	jmp    804ca6 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804c85:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804c88:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804c8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c8f:	48 89 ce             	mov    %rcx,%rsi
+  804c92:	89 c7                	mov    %eax,%edi
+  804c94:	49 89 df             	mov    %rbx,%r15
+  804c97:	48 b8 75 c1 ff ff ff 	movabs $0xffffffffffffc175,%rax
+  804c9e:	ff ff ff 
+  804ca1:	48 01 d8             	add    %rbx,%rax
+  804ca4:	ff d0                	call   *%rax
+}
+  804ca6:	48 83 c4 20          	add    $0x20,%rsp
+  804caa:	5b                   	pop    %rbx
+  804cab:	41 5f                	pop    %r15
+  804cad:	5d                   	pop    %rbp
+  804cae:	c3                   	ret
+
+0000000000804caf <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804caf:	55                   	push   %rbp
+  804cb0:	48 89 e5             	mov    %rsp,%rbp
+  804cb3:	41 57                	push   %r15
+  804cb5:	53                   	push   %rbx
+  804cb6:	48 83 ec 20          	sub    $0x20,%rsp
+  804cba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cba <listen+0xb>
+  804cc1:	49 bb 86 43 00 00 00 	movabs $0x4386,%r11
+  804cc8:	00 00 00 
+  804ccb:	4c 01 db             	add    %r11,%rbx
+  804cce:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804cd1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804cd4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804cd7:	89 c7                	mov    %eax,%edi
+  804cd9:	48 b8 bd b8 ff ff ff 	movabs $0xffffffffffffb8bd,%rax
+  804ce0:	ff ff ff 
+  804ce3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ce7:	ff d0                	call   *%rax
+  804ce9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cf0:	79 05                	jns    804cf7 <listen+0x48>
+		return r;
+  804cf2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cf5:	eb 1c                	jmp    804d13 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804cf7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804cfa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cfd:	89 d6                	mov    %edx,%esi
+  804cff:	89 c7                	mov    %eax,%edi
+  804d01:	49 89 df             	mov    %rbx,%r15
+  804d04:	48 b8 0a c2 ff ff ff 	movabs $0xffffffffffffc20a,%rax
+  804d0b:	ff ff ff 
+  804d0e:	48 01 d8             	add    %rbx,%rax
+  804d11:	ff d0                	call   *%rax
+}
+  804d13:	48 83 c4 20          	add    $0x20,%rsp
+  804d17:	5b                   	pop    %rbx
+  804d18:	41 5f                	pop    %r15
+  804d1a:	5d                   	pop    %rbp
+  804d1b:	c3                   	ret
+
+0000000000804d1c <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804d1c:	55                   	push   %rbp
+  804d1d:	48 89 e5             	mov    %rsp,%rbp
+  804d20:	41 57                	push   %r15
+  804d22:	48 83 ec 28          	sub    $0x28,%rsp
+  804d26:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d26 <devsock_read+0xa>
+  804d2d:	49 bb 1a 43 00 00 00 	movabs $0x431a,%r11
+  804d34:	00 00 00 
+  804d37:	4c 01 d8             	add    %r11,%rax
+  804d3a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d3e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804d42:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804d46:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804d4a:	41 89 d0             	mov    %edx,%r8d
+  804d4d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d51:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804d54:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804d58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d5d:	44 89 c2             	mov    %r8d,%edx
+  804d60:	49 89 c7             	mov    %rax,%r15
+  804d63:	49 b8 5b c2 ff ff ff 	movabs $0xffffffffffffc25b,%r8
+  804d6a:	ff ff ff 
+  804d6d:	49 01 c0             	add    %rax,%r8
+  804d70:	41 ff d0             	call   *%r8
+}
+  804d73:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804d77:	c9                   	leave
+  804d78:	c3                   	ret
+
+0000000000804d79 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804d79:	55                   	push   %rbp
+  804d7a:	48 89 e5             	mov    %rsp,%rbp
+  804d7d:	41 57                	push   %r15
+  804d7f:	48 83 ec 28          	sub    $0x28,%rsp
+  804d83:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d83 <devsock_write+0xa>
+  804d8a:	49 bb bd 42 00 00 00 	movabs $0x42bd,%r11
+  804d91:	00 00 00 
+  804d94:	4c 01 d8             	add    %r11,%rax
+  804d97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d9b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804d9f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804da3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804da7:	41 89 d0             	mov    %edx,%r8d
+  804daa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804dae:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804db1:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804db5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804dba:	44 89 c2             	mov    %r8d,%edx
+  804dbd:	49 89 c7             	mov    %rax,%r15
+  804dc0:	49 b8 78 c3 ff ff ff 	movabs $0xffffffffffffc378,%r8
+  804dc7:	ff ff ff 
+  804dca:	49 01 c0             	add    %rax,%r8
+  804dcd:	41 ff d0             	call   *%r8
+}
+  804dd0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804dd4:	c9                   	leave
+  804dd5:	c3                   	ret
+
+0000000000804dd6 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  804dd6:	55                   	push   %rbp
+  804dd7:	48 89 e5             	mov    %rsp,%rbp
+  804dda:	41 57                	push   %r15
+  804ddc:	48 83 ec 18          	sub    $0x18,%rsp
+  804de0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804de0 <devsock_stat+0xa>
+  804de7:	49 bb 60 42 00 00 00 	movabs $0x4260,%r11
+  804dee:	00 00 00 
+  804df1:	4c 01 d8             	add    %r11,%rax
+  804df4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804df8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804dfc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e00:	48 b9 ac e2 ff ff ff 	movabs $0xffffffffffffe2ac,%rcx
+  804e07:	ff ff ff 
+  804e0a:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804e0e:	48 89 ce             	mov    %rcx,%rsi
+  804e11:	48 89 d7             	mov    %rdx,%rdi
+  804e14:	49 89 c7             	mov    %rax,%r15
+  804e17:	48 ba 13 82 ff ff ff 	movabs $0xffffffffffff8213,%rdx
+  804e1e:	ff ff ff 
+  804e21:	48 01 c2             	add    %rax,%rdx
+  804e24:	ff d2                	call   *%rdx
+	return 0;
+  804e26:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e2b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804e2f:	c9                   	leave
+  804e30:	c3                   	ret
+
+0000000000804e31 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804e31:	55                   	push   %rbp
+  804e32:	48 89 e5             	mov    %rsp,%rbp
+  804e35:	41 57                	push   %r15
+  804e37:	53                   	push   %rbx
+  804e38:	48 83 ec 20          	sub    $0x20,%rsp
+  804e3c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e3c <socket+0xb>
+  804e43:	49 bb 04 42 00 00 00 	movabs $0x4204,%r11
+  804e4a:	00 00 00 
+  804e4d:	4c 01 db             	add    %r11,%rbx
+  804e50:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e53:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804e56:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804e59:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804e5c:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804e5f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e62:	89 ce                	mov    %ecx,%esi
+  804e64:	89 c7                	mov    %eax,%edi
+  804e66:	49 89 df             	mov    %rbx,%r15
+  804e69:	48 b8 4f c5 ff ff ff 	movabs $0xffffffffffffc54f,%rax
+  804e70:	ff ff ff 
+  804e73:	48 01 d8             	add    %rbx,%rax
+  804e76:	ff d0                	call   *%rax
+  804e78:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e7b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e7f:	79 05                	jns    804e86 <socket+0x55>
+		return r;
+  804e81:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e84:	eb 15                	jmp    804e9b <socket+0x6a>
+	return alloc_sockfd(r);
+  804e86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e89:	89 c7                	mov    %eax,%edi
+  804e8b:	48 b8 39 b9 ff ff ff 	movabs $0xffffffffffffb939,%rax
+  804e92:	ff ff ff 
+  804e95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e99:	ff d0                	call   *%rax
+}
+  804e9b:	48 83 c4 20          	add    $0x20,%rsp
+  804e9f:	5b                   	pop    %rbx
+  804ea0:	41 5f                	pop    %r15
+  804ea2:	5d                   	pop    %rbp
+  804ea3:	c3                   	ret
+
+0000000000804ea4 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  804ea4:	55                   	push   %rbp
+  804ea5:	48 89 e5             	mov    %rsp,%rbp
+  804ea8:	41 57                	push   %r15
+  804eaa:	53                   	push   %rbx
+  804eab:	48 83 ec 10          	sub    $0x10,%rsp
+  804eaf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804eaf <nsipc+0xb>
+  804eb6:	49 bb 91 41 00 00 00 	movabs $0x4191,%r11
+  804ebd:	00 00 00 
+  804ec0:	4c 01 db             	add    %r11,%rbx
+  804ec3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  804ec6:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804ecd:	00 00 00 
+  804ed0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ed3:	85 c0                	test   %eax,%eax
+  804ed5:	75 24                	jne    804efb <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804ed7:	bf 02 00 00 00       	mov    $0x2,%edi
+  804edc:	49 89 df             	mov    %rbx,%r15
+  804edf:	48 b8 25 db ff ff ff 	movabs $0xffffffffffffdb25,%rax
+  804ee6:	ff ff ff 
+  804ee9:	48 01 d8             	add    %rbx,%rax
+  804eec:	ff d0                	call   *%rax
+  804eee:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  804ef5:	00 00 00 
+  804ef8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804efb:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804f02:	00 00 00 
+  804f05:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f08:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804f0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804f11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804f17:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804f1c:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804f23:	00 00 00 
+  804f26:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804f2a:	89 c7                	mov    %eax,%edi
+  804f2c:	49 89 df             	mov    %rbx,%r15
+  804f2f:	48 b8 44 d5 ff ff ff 	movabs $0xffffffffffffd544,%rax
+  804f36:	ff ff ff 
+  804f39:	48 01 d8             	add    %rbx,%rax
+  804f3c:	ff d0                	call   *%rax
+}
+  804f3e:	48 83 c4 10          	add    $0x10,%rsp
+  804f42:	5b                   	pop    %rbx
+  804f43:	41 5f                	pop    %r15
+  804f45:	5d                   	pop    %rbp
+  804f46:	c3                   	ret
+
+0000000000804f47 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804f47:	55                   	push   %rbp
+  804f48:	48 89 e5             	mov    %rsp,%rbp
+  804f4b:	41 57                	push   %r15
+  804f4d:	53                   	push   %rbx
+  804f4e:	48 83 ec 20          	sub    $0x20,%rsp
+  804f52:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f52 <nsipc_words+0xb>
+  804f59:	49 bb ee 40 00 00 00 	movabs $0x40ee,%r11
+  804f60:	00 00 00 
+  804f63:	4c 01 db             	add    %r11,%rbx
+  804f66:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804f69:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804f6d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  804f71:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804f78:	00 00 00 
+  804f7b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f7e:	85 c0                	test   %eax,%eax
+  804f80:	75 24                	jne    804fa6 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804f82:	bf 02 00 00 00       	mov    $0x2,%edi
+  804f87:	49 89 df             	mov    %rbx,%r15
+  804f8a:	48 b8 25 db ff ff ff 	movabs $0xffffffffffffdb25,%rax
+  804f91:	ff ff ff 
+  804f94:	48 01 d8             	add    %rbx,%rax
+  804f97:	ff d0                	call   *%rax
+  804f99:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  804fa0:	00 00 00 
+  804fa3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804fa6:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804fad:	00 00 00 
+  804fb0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804fb3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804fb7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804fbb:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804fbe:	89 c7                	mov    %eax,%edi
+  804fc0:	49 89 df             	mov    %rbx,%r15
+  804fc3:	48 b8 2f d6 ff ff ff 	movabs $0xffffffffffffd62f,%rax
+  804fca:	ff ff ff 
+  804fcd:	48 01 d8             	add    %rbx,%rax
+  804fd0:	ff d0                	call   *%rax
+}
+  804fd2:	48 83 c4 20          	add    $0x20,%rsp
+  804fd6:	5b                   	pop    %rbx
+  804fd7:	41 5f                	pop    %r15
+  804fd9:	5d                   	pop    %rbp
+  804fda:	c3                   	ret
+
+0000000000804fdb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804fdb:	55                   	push   %rbp
+  804fdc:	48 89 e5             	mov    %rsp,%rbp
+  804fdf:	41 57                	push   %r15
+  804fe1:	53                   	push   %rbx
+  804fe2:	48 83 ec 30          	sub    $0x30,%rsp
+  804fe6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fe6 <nsipc_accept+0xb>
+  804fed:	49 bb 5a 40 00 00 00 	movabs $0x405a,%r11
+  804ff4:	00 00 00 
+  804ff7:	4c 01 db             	add    %r11,%rbx
+  804ffa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804ffd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805001:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805005:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80500c:	00 00 00 
+  80500f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805012:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805015:	bf 01 00 00 00       	mov    $0x1,%edi
+  80501a:	48 b8 64 be ff ff ff 	movabs $0xffffffffffffbe64,%rax
+  805021:	ff ff ff 
+  805024:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805028:	ff d0                	call   *%rax
+  80502a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80502d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805031:	78 48                	js     80507b <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805033:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  80503a:	00 00 00 
+  80503d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805041:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805045:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805049:	8b 40 10             	mov    0x10(%rax),%eax
+  80504c:	89 c2                	mov    %eax,%edx
+  80504e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805052:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805056:	48 89 ce             	mov    %rcx,%rsi
+  805059:	48 89 c7             	mov    %rax,%rdi
+  80505c:	49 89 df             	mov    %rbx,%r15
+  80505f:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  805066:	ff ff ff 
+  805069:	48 01 d8             	add    %rbx,%rax
+  80506c:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80506e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805072:	8b 50 10             	mov    0x10(%rax),%edx
+  805075:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805079:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  80507b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80507e:	48 83 c4 30          	add    $0x30,%rsp
+  805082:	5b                   	pop    %rbx
+  805083:	41 5f                	pop    %r15
+  805085:	5d                   	pop    %rbp
+  805086:	c3                   	ret
+
+0000000000805087 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805087:	55                   	push   %rbp
+  805088:	48 89 e5             	mov    %rsp,%rbp
+  80508b:	41 57                	push   %r15
+  80508d:	53                   	push   %rbx
+  80508e:	48 83 ec 10          	sub    $0x10,%rsp
+  805092:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805092 <nsipc_bind+0xb>
+  805099:	49 bb ae 3f 00 00 00 	movabs $0x3fae,%r11
+  8050a0:	00 00 00 
+  8050a3:	4c 01 db             	add    %r11,%rbx
+  8050a6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8050a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8050ad:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8050b0:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8050b7:	00 00 00 
+  8050ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050bd:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8050c0:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8050c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050c7:	48 89 c6             	mov    %rax,%rsi
+  8050ca:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  8050d1:	00 00 00 
+  8050d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050d8:	48 89 c7             	mov    %rax,%rdi
+  8050db:	49 89 df             	mov    %rbx,%r15
+  8050de:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  8050e5:	ff ff ff 
+  8050e8:	48 01 d8             	add    %rbx,%rax
+  8050eb:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8050ed:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8050f4:	00 00 00 
+  8050f7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8050fa:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8050fe:	bf 02 00 00 00       	mov    $0x2,%edi
+  805103:	48 b8 64 be ff ff ff 	movabs $0xffffffffffffbe64,%rax
+  80510a:	ff ff ff 
+  80510d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805111:	ff d0                	call   *%rax
+}
+  805113:	48 83 c4 10          	add    $0x10,%rsp
+  805117:	5b                   	pop    %rbx
+  805118:	41 5f                	pop    %r15
+  80511a:	5d                   	pop    %rbp
+  80511b:	c3                   	ret
+
+000000000080511c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80511c:	55                   	push   %rbp
+  80511d:	48 89 e5             	mov    %rsp,%rbp
+  805120:	48 83 ec 20          	sub    $0x20,%rsp
+  805124:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805124 <nsipc_shutdown+0x8>
+  80512b:	49 bb 1c 3f 00 00 00 	movabs $0x3f1c,%r11
+  805132:	00 00 00 
+  805135:	4c 01 d8             	add    %r11,%rax
+  805138:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80513b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  80513e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805141:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805144:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805147:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80514a:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80514e:	ba 08 00 00 00       	mov    $0x8,%edx
+  805153:	48 89 ce             	mov    %rcx,%rsi
+  805156:	bf 03 00 00 00       	mov    $0x3,%edi
+  80515b:	48 b9 07 bf ff ff ff 	movabs $0xffffffffffffbf07,%rcx
+  805162:	ff ff ff 
+  805165:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805169:	ff d0                	call   *%rax
+}
+  80516b:	c9                   	leave
+  80516c:	c3                   	ret
+
+000000000080516d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80516d:	55                   	push   %rbp
+  80516e:	48 89 e5             	mov    %rsp,%rbp
+  805171:	48 83 ec 20          	sub    $0x20,%rsp
+  805175:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805175 <nsipc_close+0x8>
+  80517c:	49 bb cb 3e 00 00 00 	movabs $0x3ecb,%r11
+  805183:	00 00 00 
+  805186:	4c 01 d8             	add    %r11,%rax
+  805189:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80518c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80518f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805192:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805196:	ba 04 00 00 00       	mov    $0x4,%edx
+  80519b:	48 89 ce             	mov    %rcx,%rsi
+  80519e:	bf 04 00 00 00       	mov    $0x4,%edi
+  8051a3:	48 b9 07 bf ff ff ff 	movabs $0xffffffffffffbf07,%rcx
+  8051aa:	ff ff ff 
+  8051ad:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8051b1:	ff d0                	call   *%rax
+}
+  8051b3:	c9                   	leave
+  8051b4:	c3                   	ret
+
+00000000008051b5 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8051b5:	55                   	push   %rbp
+  8051b6:	48 89 e5             	mov    %rsp,%rbp
+  8051b9:	41 57                	push   %r15
+  8051bb:	53                   	push   %rbx
+  8051bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8051c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051c0 <nsipc_connect+0xb>
+  8051c7:	49 bb 80 3e 00 00 00 	movabs $0x3e80,%r11
+  8051ce:	00 00 00 
+  8051d1:	4c 01 db             	add    %r11,%rbx
+  8051d4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8051d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8051db:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8051de:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8051e5:	00 00 00 
+  8051e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051eb:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8051ee:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8051f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051f5:	48 89 c6             	mov    %rax,%rsi
+  8051f8:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  8051ff:	00 00 00 
+  805202:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805206:	48 89 c7             	mov    %rax,%rdi
+  805209:	49 89 df             	mov    %rbx,%r15
+  80520c:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  805213:	ff ff ff 
+  805216:	48 01 d8             	add    %rbx,%rax
+  805219:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  80521b:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805222:	00 00 00 
+  805225:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805228:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  80522c:	bf 05 00 00 00       	mov    $0x5,%edi
+  805231:	48 b8 64 be ff ff ff 	movabs $0xffffffffffffbe64,%rax
+  805238:	ff ff ff 
+  80523b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80523f:	ff d0                	call   *%rax
+}
+  805241:	48 83 c4 10          	add    $0x10,%rsp
+  805245:	5b                   	pop    %rbx
+  805246:	41 5f                	pop    %r15
+  805248:	5d                   	pop    %rbp
+  805249:	c3                   	ret
+
+000000000080524a <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80524a:	55                   	push   %rbp
+  80524b:	48 89 e5             	mov    %rsp,%rbp
+  80524e:	48 83 ec 20          	sub    $0x20,%rsp
+  805252:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805252 <nsipc_listen+0x8>
+  805259:	49 bb ee 3d 00 00 00 	movabs $0x3dee,%r11
+  805260:	00 00 00 
+  805263:	4c 01 d8             	add    %r11,%rax
+  805266:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805269:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  80526c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80526f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805272:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805275:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805278:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80527c:	ba 08 00 00 00       	mov    $0x8,%edx
+  805281:	48 89 ce             	mov    %rcx,%rsi
+  805284:	bf 06 00 00 00       	mov    $0x6,%edi
+  805289:	48 b9 07 bf ff ff ff 	movabs $0xffffffffffffbf07,%rcx
+  805290:	ff ff ff 
+  805293:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805297:	ff d0                	call   *%rax
+}
+  805299:	c9                   	leave
+  80529a:	c3                   	ret
+
+000000000080529b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80529b:	55                   	push   %rbp
+  80529c:	48 89 e5             	mov    %rsp,%rbp
+  80529f:	41 57                	push   %r15
+  8052a1:	53                   	push   %rbx
+  8052a2:	48 83 ec 30          	sub    $0x30,%rsp
+  8052a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052a6 <nsipc_recv+0xb>
+  8052ad:	49 bb 9a 3d 00 00 00 	movabs $0x3d9a,%r11
+  8052b4:	00 00 00 
+  8052b7:	4c 01 db             	add    %r11,%rbx
+  8052ba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8052bd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8052c1:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8052c4:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8052c7:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8052ce:	00 00 00 
+  8052d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052d4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8052d7:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8052de:	00 00 00 
+  8052e1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8052e4:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8052e8:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8052ef:	00 00 00 
+  8052f2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8052f5:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8052f9:	bf 07 00 00 00       	mov    $0x7,%edi
+  8052fe:	48 b8 64 be ff ff ff 	movabs $0xffffffffffffbe64,%rax
+  805305:	ff ff ff 
+  805308:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80530c:	ff d0                	call   *%rax
+  80530e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805311:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805315:	0f 88 91 00 00 00    	js     8053ac <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  80531b:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805322:	7f 08                	jg     80532c <nsipc_recv+0x91>
+  805324:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805327:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  80532a:	7e 50                	jle    80537c <nsipc_recv+0xe1>
+  80532c:	48 b8 b3 e2 ff ff ff 	movabs $0xffffffffffffe2b3,%rax
+  805333:	ff ff ff 
+  805336:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80533a:	48 89 c1             	mov    %rax,%rcx
+  80533d:	48 b8 c8 e2 ff ff ff 	movabs $0xffffffffffffe2c8,%rax
+  805344:	ff ff ff 
+  805347:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80534b:	48 89 c2             	mov    %rax,%rdx
+  80534e:	be 79 00 00 00       	mov    $0x79,%esi
+  805353:	48 b8 dd e2 ff ff ff 	movabs $0xffffffffffffe2dd,%rax
+  80535a:	ff ff ff 
+  80535d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805361:	48 89 c7             	mov    %rax,%rdi
+  805364:	49 89 df             	mov    %rbx,%r15
+  805367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80536c:	49 b8 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%r8
+  805373:	ff ff ff 
+  805376:	49 01 d8             	add    %rbx,%r8
+  805379:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80537c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80537f:	48 63 d0             	movslq %eax,%rdx
+  805382:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805386:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80538d:	00 00 00 
+  805390:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805394:	48 89 ce             	mov    %rcx,%rsi
+  805397:	48 89 c7             	mov    %rax,%rdi
+  80539a:	49 89 df             	mov    %rbx,%r15
+  80539d:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  8053a4:	ff ff ff 
+  8053a7:	48 01 d8             	add    %rbx,%rax
+  8053aa:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8053ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8053af:	48 83 c4 30          	add    $0x30,%rsp
+  8053b3:	5b                   	pop    %rbx
+  8053b4:	41 5f                	pop    %r15
+  8053b6:	5d                   	pop    %rbp
+  8053b7:	c3                   	ret
+
+00000000008053b8 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8053b8:	55                   	push   %rbp
+  8053b9:	48 89 e5             	mov    %rsp,%rbp
+  8053bc:	41 57                	push   %r15
+  8053be:	53                   	push   %rbx
+  8053bf:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8053c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053c6 <nsipc_send+0xe>
+  8053cd:	49 bb 7a 3c 00 00 00 	movabs $0x3c7a,%r11
+  8053d4:	00 00 00 
+  8053d7:	4c 01 db             	add    %r11,%rbx
+  8053da:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8053e0:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8053e7:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8053ed:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8053f3:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8053f7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  8053fb:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805402:	00 00 00 
+  805405:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805408:	85 c0                	test   %eax,%eax
+  80540a:	75 24                	jne    805430 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80540c:	bf 02 00 00 00       	mov    $0x2,%edi
+  805411:	49 89 df             	mov    %rbx,%r15
+  805414:	48 b8 25 db ff ff ff 	movabs $0xffffffffffffdb25,%rax
+  80541b:	ff ff ff 
+  80541e:	48 01 d8             	add    %rbx,%rax
+  805421:	ff d0                	call   *%rax
+  805423:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80542a:	00 00 00 
+  80542d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805430:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805436:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805439:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805440:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805443:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805446:	39 c2                	cmp    %eax,%edx
+  805448:	0f 4e c2             	cmovle %edx,%eax
+  80544b:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805451:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805457:	48 63 d0             	movslq %eax,%rdx
+  80545a:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805461:	48 89 c6             	mov    %rax,%rsi
+  805464:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  80546b:	00 00 00 
+  80546e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805472:	48 89 c7             	mov    %rax,%rdi
+  805475:	49 89 df             	mov    %rbx,%r15
+  805478:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  80547f:	ff ff ff 
+  805482:	48 01 d8             	add    %rbx,%rax
+  805485:	ff d0                	call   *%rax
+	req->req_s = s;
+  805487:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80548b:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805491:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805493:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805497:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80549d:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  8054a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054a4:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8054aa:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  8054ad:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  8054b4:	00 00 00 
+  8054b7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054bb:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8054bf:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8054c6:	00 
+  8054c7:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8054cd:	48 63 d0             	movslq %eax,%rdx
+  8054d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054d4:	48 01 d0             	add    %rdx,%rax
+  8054d7:	48 83 e8 01          	sub    $0x1,%rax
+  8054db:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8054df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054e8:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8054ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054f0:	48 29 d0             	sub    %rdx,%rax
+  8054f3:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8054f9:	85 c0                	test   %eax,%eax
+  8054fb:	0f 48 c2             	cmovs  %edx,%eax
+  8054fe:	c1 f8 0c             	sar    $0xc,%eax
+  805501:	48 98                	cltq
+  805503:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805507:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80550b:	48 85 c0             	test   %rax,%rax
+  80550e:	0f 95 c0             	setne  %al
+  805511:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805514:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  80551b:	00 
+  80551c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805520:	48 83 c0 0b          	add    $0xb,%rax
+  805524:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805528:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80552c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805531:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805535:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805539:	48 29 d0             	sub    %rdx,%rax
+  80553c:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805540:	89 c7                	mov    %eax,%edi
+  805542:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805549:	00 00 00 
+  80554c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80554f:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805553:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805557:	48 83 ec 08          	sub    $0x8,%rsp
+  80555b:	6a 00                	push   $0x0
+  80555d:	6a 00                	push   $0x0
+  80555f:	6a 05                	push   $0x5
+  805561:	41 89 f1             	mov    %esi,%r9d
+  805564:	49 89 c8             	mov    %rcx,%r8
+  805567:	89 f9                	mov    %edi,%ecx
+  805569:	be 08 00 00 00       	mov    $0x8,%esi
+  80556e:	89 c7                	mov    %eax,%edi
+  805570:	49 89 df             	mov    %rbx,%r15
+  805573:	48 b8 2d d7 ff ff ff 	movabs $0xffffffffffffd72d,%rax
+  80557a:	ff ff ff 
+  80557d:	48 01 d8             	add    %rbx,%rax
+  805580:	ff d0                	call   *%rax
+  805582:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805586:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80558a:	5b                   	pop    %rbx
+  80558b:	41 5f                	pop    %r15
+  80558d:	5d                   	pop    %rbp
+  80558e:	c3                   	ret
+
+000000000080558f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80558f:	55                   	push   %rbp
+  805590:	48 89 e5             	mov    %rsp,%rbp
+  805593:	48 83 ec 10          	sub    $0x10,%rsp
+  805597:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805597 <nsipc_socket+0x8>
+  80559e:	49 bb a9 3a 00 00 00 	movabs $0x3aa9,%r11
+  8055a5:	00 00 00 
+  8055a8:	4c 01 d8             	add    %r11,%rax
+  8055ab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8055ae:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8055b1:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8055b4:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8055bb:	00 00 00 
+  8055be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8055c1:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8055c4:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8055cb:	00 00 00 
+  8055ce:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8055d1:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8055d5:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8055dc:	00 00 00 
+  8055df:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8055e2:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8055e6:	bf 09 00 00 00       	mov    $0x9,%edi
+  8055eb:	48 ba 64 be ff ff ff 	movabs $0xffffffffffffbe64,%rdx
+  8055f2:	ff ff ff 
+  8055f5:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8055f9:	ff d0                	call   *%rax
+}
+  8055fb:	c9                   	leave
+  8055fc:	c3                   	ret
+
+00000000008055fd <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8055fd:	55                   	push   %rbp
+  8055fe:	48 89 e5             	mov    %rsp,%rbp
+  805601:	41 57                	push   %r15
+  805603:	53                   	push   %rbx
+  805604:	48 83 ec 30          	sub    $0x30,%rsp
+  805608:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805608 <pipe+0xb>
+  80560f:	49 bb 38 3a 00 00 00 	movabs $0x3a38,%r11
+  805616:	00 00 00 
+  805619:	4c 01 db             	add    %r11,%rbx
+  80561c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805620:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805624:	48 89 c7             	mov    %rax,%rdi
+  805627:	49 89 df             	mov    %rbx,%r15
+  80562a:	48 b8 7e a2 ff ff ff 	movabs $0xffffffffffffa27e,%rax
+  805631:	ff ff ff 
+  805634:	48 01 d8             	add    %rbx,%rax
+  805637:	ff d0                	call   *%rax
+  805639:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80563c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805640:	0f 88 12 02 00 00    	js     805858 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805646:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80564a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80564f:	48 89 c6             	mov    %rax,%rsi
+  805652:	bf 00 00 00 00       	mov    $0x0,%edi
+  805657:	49 89 df             	mov    %rbx,%r15
+  80565a:	48 b8 cf 8e ff ff ff 	movabs $0xffffffffffff8ecf,%rax
+  805661:	ff ff ff 
+  805664:	48 01 d8             	add    %rbx,%rax
+  805667:	ff d0                	call   *%rax
+  805669:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80566c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805670:	0f 88 e2 01 00 00    	js     805858 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805676:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80567a:	48 89 c7             	mov    %rax,%rdi
+  80567d:	49 89 df             	mov    %rbx,%r15
+  805680:	48 b8 7e a2 ff ff ff 	movabs $0xffffffffffffa27e,%rax
+  805687:	ff ff ff 
+  80568a:	48 01 d8             	add    %rbx,%rax
+  80568d:	ff d0                	call   *%rax
+  80568f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805692:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805696:	0f 88 9b 01 00 00    	js     805837 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80569c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056a0:	ba 07 04 00 00       	mov    $0x407,%edx
+  8056a5:	48 89 c6             	mov    %rax,%rsi
+  8056a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056ad:	49 89 df             	mov    %rbx,%r15
+  8056b0:	48 b8 cf 8e ff ff ff 	movabs $0xffffffffffff8ecf,%rax
+  8056b7:	ff ff ff 
+  8056ba:	48 01 d8             	add    %rbx,%rax
+  8056bd:	ff d0                	call   *%rax
+  8056bf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056c6:	0f 88 6b 01 00 00    	js     805837 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8056cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8056d0:	48 89 c7             	mov    %rax,%rdi
+  8056d3:	49 89 df             	mov    %rbx,%r15
+  8056d6:	48 b8 3b a2 ff ff ff 	movabs $0xffffffffffffa23b,%rax
+  8056dd:	ff ff ff 
+  8056e0:	48 01 d8             	add    %rbx,%rax
+  8056e3:	ff d0                	call   *%rax
+  8056e5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8056e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056ed:	ba 07 04 00 00       	mov    $0x407,%edx
+  8056f2:	48 89 c6             	mov    %rax,%rsi
+  8056f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056fa:	49 89 df             	mov    %rbx,%r15
+  8056fd:	48 b8 cf 8e ff ff ff 	movabs $0xffffffffffff8ecf,%rax
+  805704:	ff ff ff 
+  805707:	48 01 d8             	add    %rbx,%rax
+  80570a:	ff d0                	call   *%rax
+  80570c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80570f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805713:	0f 88 fd 00 00 00    	js     805816 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805719:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80571d:	48 89 c7             	mov    %rax,%rdi
+  805720:	49 89 df             	mov    %rbx,%r15
+  805723:	48 b8 3b a2 ff ff ff 	movabs $0xffffffffffffa23b,%rax
+  80572a:	ff ff ff 
+  80572d:	48 01 d8             	add    %rbx,%rax
+  805730:	ff d0                	call   *%rax
+  805732:	48 89 c2             	mov    %rax,%rdx
+  805735:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805739:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80573f:	48 89 d1             	mov    %rdx,%rcx
+  805742:	ba 00 00 00 00       	mov    $0x0,%edx
+  805747:	48 89 c6             	mov    %rax,%rsi
+  80574a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80574f:	49 89 df             	mov    %rbx,%r15
+  805752:	48 b8 34 8f ff ff ff 	movabs $0xffffffffffff8f34,%rax
+  805759:	ff ff ff 
+  80575c:	48 01 d8             	add    %rbx,%rax
+  80575f:	ff d0                	call   *%rax
+  805761:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805764:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805768:	0f 88 87 00 00 00    	js     8057f5 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  80576e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805772:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805779:	00 00 00 
+  80577c:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80577f:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805781:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805785:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  80578c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805790:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805797:	00 00 00 
+  80579a:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80579d:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  80579f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057a3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8057aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057ae:	48 89 c7             	mov    %rax,%rdi
+  8057b1:	49 89 df             	mov    %rbx,%r15
+  8057b4:	48 b8 04 a2 ff ff ff 	movabs $0xffffffffffffa204,%rax
+  8057bb:	ff ff ff 
+  8057be:	48 01 d8             	add    %rbx,%rax
+  8057c1:	ff d0                	call   *%rax
+  8057c3:	89 c2                	mov    %eax,%edx
+  8057c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8057c9:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8057cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057cf:	48 89 c7             	mov    %rax,%rdi
+  8057d2:	49 89 df             	mov    %rbx,%r15
+  8057d5:	48 b8 04 a2 ff ff ff 	movabs $0xffffffffffffa204,%rax
+  8057dc:	ff ff ff 
+  8057df:	48 01 d8             	add    %rbx,%rax
+  8057e2:	ff d0                	call   *%rax
+  8057e4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8057e8:	48 83 c2 04          	add    $0x4,%rdx
+  8057ec:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  8057ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057f3:	eb 67                	jmp    80585c <pipe+0x25f>
+		goto err3;
+  8057f5:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  8057f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057fa:	48 89 c6             	mov    %rax,%rsi
+  8057fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  805802:	49 89 df             	mov    %rbx,%r15
+  805805:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  80580c:	ff ff ff 
+  80580f:	48 01 d8             	add    %rbx,%rax
+  805812:	ff d0                	call   *%rax
+  805814:	eb 01                	jmp    805817 <pipe+0x21a>
+		goto err2;
+  805816:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805817:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80581b:	48 89 c6             	mov    %rax,%rsi
+  80581e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805823:	49 89 df             	mov    %rbx,%r15
+  805826:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  80582d:	ff ff ff 
+  805830:	48 01 d8             	add    %rbx,%rax
+  805833:	ff d0                	call   *%rax
+  805835:	eb 01                	jmp    805838 <pipe+0x23b>
+		goto err1;
+  805837:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805838:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80583c:	48 89 c6             	mov    %rax,%rsi
+  80583f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805844:	49 89 df             	mov    %rbx,%r15
+  805847:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  80584e:	ff ff ff 
+  805851:	48 01 d8             	add    %rbx,%rax
+  805854:	ff d0                	call   *%rax
+  805856:	eb 01                	jmp    805859 <pipe+0x25c>
+		goto err;
+  805858:	90                   	nop
+err:
+	return r;
+  805859:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80585c:	48 83 c4 30          	add    $0x30,%rsp
+  805860:	5b                   	pop    %rbx
+  805861:	41 5f                	pop    %r15
+  805863:	5d                   	pop    %rbp
+  805864:	c3                   	ret
+
+0000000000805865 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805865:	55                   	push   %rbp
+  805866:	48 89 e5             	mov    %rsp,%rbp
+  805869:	41 57                	push   %r15
+  80586b:	41 54                	push   %r12
+  80586d:	53                   	push   %rbx
+  80586e:	48 83 ec 28          	sub    $0x28,%rsp
+  805872:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805872 <_pipeisclosed+0xd>
+  805879:	49 bb ce 37 00 00 00 	movabs $0x37ce,%r11
+  805880:	00 00 00 
+  805883:	4c 01 db             	add    %r11,%rbx
+  805886:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80588a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80588e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805895:	ff ff ff 
+  805898:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80589c:	48 8b 00             	mov    (%rax),%rax
+  80589f:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8058a5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8058a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8058ac:	48 89 c7             	mov    %rax,%rdi
+  8058af:	49 89 df             	mov    %rbx,%r15
+  8058b2:	48 b8 b4 db ff ff ff 	movabs $0xffffffffffffdbb4,%rax
+  8058b9:	ff ff ff 
+  8058bc:	48 01 d8             	add    %rbx,%rax
+  8058bf:	ff d0                	call   *%rax
+  8058c1:	41 89 c4             	mov    %eax,%r12d
+  8058c4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8058c8:	48 89 c7             	mov    %rax,%rdi
+  8058cb:	49 89 df             	mov    %rbx,%r15
+  8058ce:	48 b8 b4 db ff ff ff 	movabs $0xffffffffffffdbb4,%rax
+  8058d5:	ff ff ff 
+  8058d8:	48 01 d8             	add    %rbx,%rax
+  8058db:	ff d0                	call   *%rax
+  8058dd:	41 39 c4             	cmp    %eax,%r12d
+  8058e0:	0f 94 c0             	sete   %al
+  8058e3:	0f b6 c0             	movzbl %al,%eax
+  8058e6:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  8058e9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8058f0:	ff ff ff 
+  8058f3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058f7:	48 8b 00             	mov    (%rax),%rax
+  8058fa:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805900:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805903:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805906:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805909:	75 05                	jne    805910 <_pipeisclosed+0xab>
+			return ret;
+  80590b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80590e:	eb 63                	jmp    805973 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805910:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805913:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805916:	0f 84 72 ff ff ff    	je     80588e <_pipeisclosed+0x29>
+  80591c:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805920:	0f 85 68 ff ff ff    	jne    80588e <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805926:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80592d:	ff ff ff 
+  805930:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805934:	48 8b 00             	mov    (%rax),%rax
+  805937:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  80593d:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805940:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805943:	89 c6                	mov    %eax,%esi
+  805945:	48 b8 ee e2 ff ff ff 	movabs $0xffffffffffffe2ee,%rax
+  80594c:	ff ff ff 
+  80594f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805953:	48 89 c7             	mov    %rax,%rdi
+  805956:	49 89 df             	mov    %rbx,%r15
+  805959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80595e:	49 b8 51 74 ff ff ff 	movabs $0xffffffffffff7451,%r8
+  805965:	ff ff ff 
+  805968:	49 01 d8             	add    %rbx,%r8
+  80596b:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  80596e:	e9 1b ff ff ff       	jmp    80588e <_pipeisclosed+0x29>
+	}
+}
+  805973:	48 83 c4 28          	add    $0x28,%rsp
+  805977:	5b                   	pop    %rbx
+  805978:	41 5c                	pop    %r12
+  80597a:	41 5f                	pop    %r15
+  80597c:	5d                   	pop    %rbp
+  80597d:	c3                   	ret
+
+000000000080597e <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  80597e:	55                   	push   %rbp
+  80597f:	48 89 e5             	mov    %rsp,%rbp
+  805982:	41 57                	push   %r15
+  805984:	53                   	push   %rbx
+  805985:	48 83 ec 30          	sub    $0x30,%rsp
+  805989:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805989 <pipeisclosed+0xb>
+  805990:	49 bb b7 36 00 00 00 	movabs $0x36b7,%r11
+  805997:	00 00 00 
+  80599a:	4c 01 db             	add    %r11,%rbx
+  80599d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8059a0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8059a4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8059a7:	48 89 d6             	mov    %rdx,%rsi
+  8059aa:	89 c7                	mov    %eax,%edi
+  8059ac:	49 89 df             	mov    %rbx,%r15
+  8059af:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  8059b6:	ff ff ff 
+  8059b9:	48 01 d8             	add    %rbx,%rax
+  8059bc:	ff d0                	call   *%rax
+  8059be:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059c5:	79 05                	jns    8059cc <pipeisclosed+0x4e>
+		return r;
+  8059c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059ca:	eb 3b                	jmp    805a07 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8059cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059d0:	48 89 c7             	mov    %rax,%rdi
+  8059d3:	49 89 df             	mov    %rbx,%r15
+  8059d6:	48 b8 3b a2 ff ff ff 	movabs $0xffffffffffffa23b,%rax
+  8059dd:	ff ff ff 
+  8059e0:	48 01 d8             	add    %rbx,%rax
+  8059e3:	ff d0                	call   *%rax
+  8059e5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  8059e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059ed:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8059f1:	48 89 d6             	mov    %rdx,%rsi
+  8059f4:	48 89 c7             	mov    %rax,%rdi
+  8059f7:	48 b8 25 c8 ff ff ff 	movabs $0xffffffffffffc825,%rax
+  8059fe:	ff ff ff 
+  805a01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a05:	ff d0                	call   *%rax
+}
+  805a07:	48 83 c4 30          	add    $0x30,%rsp
+  805a0b:	5b                   	pop    %rbx
+  805a0c:	41 5f                	pop    %r15
+  805a0e:	5d                   	pop    %rbp
+  805a0f:	c3                   	ret
+
+0000000000805a10 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805a10:	55                   	push   %rbp
+  805a11:	48 89 e5             	mov    %rsp,%rbp
+  805a14:	41 57                	push   %r15
+  805a16:	53                   	push   %rbx
+  805a17:	48 83 ec 40          	sub    $0x40,%rsp
+  805a1b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a1b <devpipe_read+0xb>
+  805a22:	49 bb 25 36 00 00 00 	movabs $0x3625,%r11
+  805a29:	00 00 00 
+  805a2c:	4c 01 db             	add    %r11,%rbx
+  805a2f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805a33:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805a37:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805a3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a3f:	48 89 c7             	mov    %rax,%rdi
+  805a42:	49 89 df             	mov    %rbx,%r15
+  805a45:	48 b8 3b a2 ff ff ff 	movabs $0xffffffffffffa23b,%rax
+  805a4c:	ff ff ff 
+  805a4f:	48 01 d8             	add    %rbx,%rax
+  805a52:	ff d0                	call   *%rax
+  805a54:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805a58:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805a5c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805a60:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805a67:	00 
+  805a68:	e9 a1 00 00 00       	jmp    805b0e <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805a6d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805a72:	74 09                	je     805a7d <devpipe_read+0x6d>
+				return i;
+  805a74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a78:	e9 9f 00 00 00       	jmp    805b1c <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805a7d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a81:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a85:	48 89 d6             	mov    %rdx,%rsi
+  805a88:	48 89 c7             	mov    %rax,%rdi
+  805a8b:	48 b8 25 c8 ff ff ff 	movabs $0xffffffffffffc825,%rax
+  805a92:	ff ff ff 
+  805a95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a99:	ff d0                	call   *%rax
+  805a9b:	85 c0                	test   %eax,%eax
+  805a9d:	74 07                	je     805aa6 <devpipe_read+0x96>
+				return 0;
+  805a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aa4:	eb 76                	jmp    805b1c <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805aa6:	49 89 df             	mov    %rbx,%r15
+  805aa9:	48 b8 7a 8e ff ff ff 	movabs $0xffffffffffff8e7a,%rax
+  805ab0:	ff ff ff 
+  805ab3:	48 01 d8             	add    %rbx,%rax
+  805ab6:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805ab8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805abc:	8b 10                	mov    (%rax),%edx
+  805abe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ac2:	8b 40 04             	mov    0x4(%rax),%eax
+  805ac5:	39 c2                	cmp    %eax,%edx
+  805ac7:	74 a4                	je     805a6d <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805ac9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805acd:	8b 10                	mov    (%rax),%edx
+  805acf:	89 d0                	mov    %edx,%eax
+  805ad1:	c1 f8 1f             	sar    $0x1f,%eax
+  805ad4:	c1 e8 1b             	shr    $0x1b,%eax
+  805ad7:	01 c2                	add    %eax,%edx
+  805ad9:	83 e2 1f             	and    $0x1f,%edx
+  805adc:	29 c2                	sub    %eax,%edx
+  805ade:	89 d6                	mov    %edx,%esi
+  805ae0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805ae4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ae8:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805aec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805af0:	48 63 c6             	movslq %esi,%rax
+  805af3:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805af8:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805afa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805afe:	8b 00                	mov    (%rax),%eax
+  805b00:	8d 50 01             	lea    0x1(%rax),%edx
+  805b03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b07:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805b09:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805b0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b12:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805b16:	72 a0                	jb     805ab8 <devpipe_read+0xa8>
+	}
+	return i;
+  805b18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805b1c:	48 83 c4 40          	add    $0x40,%rsp
+  805b20:	5b                   	pop    %rbx
+  805b21:	41 5f                	pop    %r15
+  805b23:	5d                   	pop    %rbp
+  805b24:	c3                   	ret
+
+0000000000805b25 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805b25:	55                   	push   %rbp
+  805b26:	48 89 e5             	mov    %rsp,%rbp
+  805b29:	41 57                	push   %r15
+  805b2b:	53                   	push   %rbx
+  805b2c:	48 83 ec 40          	sub    $0x40,%rsp
+  805b30:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b30 <devpipe_write+0xb>
+  805b37:	49 bb 10 35 00 00 00 	movabs $0x3510,%r11
+  805b3e:	00 00 00 
+  805b41:	4c 01 db             	add    %r11,%rbx
+  805b44:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805b48:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805b4c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805b50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b54:	48 89 c7             	mov    %rax,%rdi
+  805b57:	49 89 df             	mov    %rbx,%r15
+  805b5a:	48 b8 3b a2 ff ff ff 	movabs $0xffffffffffffa23b,%rax
+  805b61:	ff ff ff 
+  805b64:	48 01 d8             	add    %rbx,%rax
+  805b67:	ff d0                	call   *%rax
+  805b69:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805b6d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805b71:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805b75:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805b7c:	00 
+  805b7d:	e9 a0 00 00 00       	jmp    805c22 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805b82:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805b86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b8a:	48 89 d6             	mov    %rdx,%rsi
+  805b8d:	48 89 c7             	mov    %rax,%rdi
+  805b90:	48 b8 25 c8 ff ff ff 	movabs $0xffffffffffffc825,%rax
+  805b97:	ff ff ff 
+  805b9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b9e:	ff d0                	call   *%rax
+  805ba0:	85 c0                	test   %eax,%eax
+  805ba2:	74 0a                	je     805bae <devpipe_write+0x89>
+				return 0;
+  805ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ba9:	e9 82 00 00 00       	jmp    805c30 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805bae:	49 89 df             	mov    %rbx,%r15
+  805bb1:	48 b8 7a 8e ff ff ff 	movabs $0xffffffffffff8e7a,%rax
+  805bb8:	ff ff ff 
+  805bbb:	48 01 d8             	add    %rbx,%rax
+  805bbe:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805bc0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bc4:	8b 40 04             	mov    0x4(%rax),%eax
+  805bc7:	48 63 d0             	movslq %eax,%rdx
+  805bca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bce:	8b 00                	mov    (%rax),%eax
+  805bd0:	48 98                	cltq
+  805bd2:	48 83 c0 20          	add    $0x20,%rax
+  805bd6:	48 39 c2             	cmp    %rax,%rdx
+  805bd9:	73 a7                	jae    805b82 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805bdb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805bdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805be3:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805be7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805beb:	8b 50 04             	mov    0x4(%rax),%edx
+  805bee:	89 d0                	mov    %edx,%eax
+  805bf0:	c1 f8 1f             	sar    $0x1f,%eax
+  805bf3:	c1 e8 1b             	shr    $0x1b,%eax
+  805bf6:	01 c2                	add    %eax,%edx
+  805bf8:	83 e2 1f             	and    $0x1f,%edx
+  805bfb:	29 c2                	sub    %eax,%edx
+  805bfd:	89 d0                	mov    %edx,%eax
+  805bff:	0f b6 09             	movzbl (%rcx),%ecx
+  805c02:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c06:	48 98                	cltq
+  805c08:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805c0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c10:	8b 40 04             	mov    0x4(%rax),%eax
+  805c13:	8d 50 01             	lea    0x1(%rax),%edx
+  805c16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c1a:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805c1d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805c22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c26:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805c2a:	72 94                	jb     805bc0 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805c2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805c30:	48 83 c4 40          	add    $0x40,%rsp
+  805c34:	5b                   	pop    %rbx
+  805c35:	41 5f                	pop    %r15
+  805c37:	5d                   	pop    %rbp
+  805c38:	c3                   	ret
+
+0000000000805c39 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805c39:	55                   	push   %rbp
+  805c3a:	48 89 e5             	mov    %rsp,%rbp
+  805c3d:	41 57                	push   %r15
+  805c3f:	53                   	push   %rbx
+  805c40:	48 83 ec 20          	sub    $0x20,%rsp
+  805c44:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c44 <devpipe_stat+0xb>
+  805c4b:	49 bb fc 33 00 00 00 	movabs $0x33fc,%r11
+  805c52:	00 00 00 
+  805c55:	4c 01 db             	add    %r11,%rbx
+  805c58:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805c5c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805c60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c64:	48 89 c7             	mov    %rax,%rdi
+  805c67:	49 89 df             	mov    %rbx,%r15
+  805c6a:	48 b8 3b a2 ff ff ff 	movabs $0xffffffffffffa23b,%rax
+  805c71:	ff ff ff 
+  805c74:	48 01 d8             	add    %rbx,%rax
+  805c77:	ff d0                	call   *%rax
+  805c79:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805c7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c81:	48 ba 01 e3 ff ff ff 	movabs $0xffffffffffffe301,%rdx
+  805c88:	ff ff ff 
+  805c8b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805c8f:	48 89 d6             	mov    %rdx,%rsi
+  805c92:	48 89 c7             	mov    %rax,%rdi
+  805c95:	49 89 df             	mov    %rbx,%r15
+  805c98:	48 b8 13 82 ff ff ff 	movabs $0xffffffffffff8213,%rax
+  805c9f:	ff ff ff 
+  805ca2:	48 01 d8             	add    %rbx,%rax
+  805ca5:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805ca7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cab:	8b 50 04             	mov    0x4(%rax),%edx
+  805cae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cb2:	8b 00                	mov    (%rax),%eax
+  805cb4:	29 c2                	sub    %eax,%edx
+  805cb6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cba:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805cc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cc4:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805ccb:	00 00 00 
+	stat->st_dev = &devpipe;
+  805cce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cd2:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805cd9:	00 00 00 
+  805cdc:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805ce0:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805cec:	48 83 c4 20          	add    $0x20,%rsp
+  805cf0:	5b                   	pop    %rbx
+  805cf1:	41 5f                	pop    %r15
+  805cf3:	5d                   	pop    %rbp
+  805cf4:	c3                   	ret
+
+0000000000805cf5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805cf5:	55                   	push   %rbp
+  805cf6:	48 89 e5             	mov    %rsp,%rbp
+  805cf9:	41 57                	push   %r15
+  805cfb:	53                   	push   %rbx
+  805cfc:	48 83 ec 10          	sub    $0x10,%rsp
+  805d00:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d00 <devpipe_close+0xb>
+  805d07:	49 bb 40 33 00 00 00 	movabs $0x3340,%r11
+  805d0e:	00 00 00 
+  805d11:	4c 01 db             	add    %r11,%rbx
+  805d14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805d18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d1c:	48 89 c6             	mov    %rax,%rsi
+  805d1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d24:	49 89 df             	mov    %rbx,%r15
+  805d27:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  805d2e:	ff ff ff 
+  805d31:	48 01 d8             	add    %rbx,%rax
+  805d34:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805d36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d3a:	48 89 c7             	mov    %rax,%rdi
+  805d3d:	49 89 df             	mov    %rbx,%r15
+  805d40:	48 b8 3b a2 ff ff ff 	movabs $0xffffffffffffa23b,%rax
+  805d47:	ff ff ff 
+  805d4a:	48 01 d8             	add    %rbx,%rax
+  805d4d:	ff d0                	call   *%rax
+  805d4f:	48 89 c6             	mov    %rax,%rsi
+  805d52:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d57:	49 89 df             	mov    %rbx,%r15
+  805d5a:	48 b8 a7 8f ff ff ff 	movabs $0xffffffffffff8fa7,%rax
+  805d61:	ff ff ff 
+  805d64:	48 01 d8             	add    %rbx,%rax
+  805d67:	ff d0                	call   *%rax
+}
+  805d69:	48 83 c4 10          	add    $0x10,%rsp
+  805d6d:	5b                   	pop    %rbx
+  805d6e:	41 5f                	pop    %r15
+  805d70:	5d                   	pop    %rbp
+  805d71:	c3                   	ret
+
+0000000000805d72 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  805d72:	55                   	push   %rbp
+  805d73:	48 89 e5             	mov    %rsp,%rbp
+  805d76:	41 57                	push   %r15
+  805d78:	48 83 ec 28          	sub    $0x28,%rsp
+  805d7c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d7c <cputchar+0xa>
+  805d83:	49 bb c4 32 00 00 00 	movabs $0x32c4,%r11
+  805d8a:	00 00 00 
+  805d8d:	4c 01 d8             	add    %r11,%rax
+  805d90:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  805d93:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805d96:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  805d99:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  805d9d:	be 01 00 00 00       	mov    $0x1,%esi
+  805da2:	48 89 d7             	mov    %rdx,%rdi
+  805da5:	49 89 c7             	mov    %rax,%r15
+  805da8:	48 ba 17 8d ff ff ff 	movabs $0xffffffffffff8d17,%rdx
+  805daf:	ff ff ff 
+  805db2:	48 01 c2             	add    %rax,%rdx
+  805db5:	ff d2                	call   *%rdx
+}
+  805db7:	90                   	nop
+  805db8:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805dbc:	c9                   	leave
+  805dbd:	c3                   	ret
+
+0000000000805dbe <getchar>:
+
+int
+getchar(void)
+{
+  805dbe:	55                   	push   %rbp
+  805dbf:	48 89 e5             	mov    %rsp,%rbp
+  805dc2:	41 57                	push   %r15
+  805dc4:	48 83 ec 18          	sub    $0x18,%rsp
+  805dc8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805dc8 <getchar+0xa>
+  805dcf:	49 bb 78 32 00 00 00 	movabs $0x3278,%r11
+  805dd6:	00 00 00 
+  805dd9:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805ddc:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805de0:	ba 01 00 00 00       	mov    $0x1,%edx
+  805de5:	48 89 ce             	mov    %rcx,%rsi
+  805de8:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ded:	49 89 c7             	mov    %rax,%r15
+  805df0:	48 b9 7b a8 ff ff ff 	movabs $0xffffffffffffa87b,%rcx
+  805df7:	ff ff ff 
+  805dfa:	48 01 c1             	add    %rax,%rcx
+  805dfd:	ff d1                	call   *%rcx
+  805dff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  805e02:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e06:	79 05                	jns    805e0d <getchar+0x4f>
+		return r;
+  805e08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e0b:	eb 14                	jmp    805e21 <getchar+0x63>
+	if (r < 1)
+  805e0d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e11:	7f 07                	jg     805e1a <getchar+0x5c>
+		return -E_EOF;
+  805e13:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  805e18:	eb 07                	jmp    805e21 <getchar+0x63>
+	return c;
+  805e1a:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805e1e:	0f b6 c0             	movzbl %al,%eax
+}
+  805e21:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805e25:	c9                   	leave
+  805e26:	c3                   	ret
+
+0000000000805e27 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  805e27:	55                   	push   %rbp
+  805e28:	48 89 e5             	mov    %rsp,%rbp
+  805e2b:	41 57                	push   %r15
+  805e2d:	53                   	push   %rbx
+  805e2e:	48 83 ec 20          	sub    $0x20,%rsp
+  805e32:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e32 <iscons+0xb>
+  805e39:	49 bb 0e 32 00 00 00 	movabs $0x320e,%r11
+  805e40:	00 00 00 
+  805e43:	4c 01 db             	add    %r11,%rbx
+  805e46:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805e49:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805e4d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e50:	48 89 d6             	mov    %rdx,%rsi
+  805e53:	89 c7                	mov    %eax,%edi
+  805e55:	49 89 df             	mov    %rbx,%r15
+  805e58:	48 b8 34 a3 ff ff ff 	movabs $0xffffffffffffa334,%rax
+  805e5f:	ff ff ff 
+  805e62:	48 01 d8             	add    %rbx,%rax
+  805e65:	ff d0                	call   *%rax
+  805e67:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e6a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e6e:	79 05                	jns    805e75 <iscons+0x4e>
+		return r;
+  805e70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e73:	eb 1b                	jmp    805e90 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  805e75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e79:	8b 10                	mov    (%rax),%edx
+  805e7b:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  805e82:	00 00 00 
+  805e85:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805e88:	39 c2                	cmp    %eax,%edx
+  805e8a:	0f 94 c0             	sete   %al
+  805e8d:	0f b6 c0             	movzbl %al,%eax
+}
+  805e90:	48 83 c4 20          	add    $0x20,%rsp
+  805e94:	5b                   	pop    %rbx
+  805e95:	41 5f                	pop    %r15
+  805e97:	5d                   	pop    %rbp
+  805e98:	c3                   	ret
+
+0000000000805e99 <opencons>:
+
+int
+opencons(void)
+{
+  805e99:	55                   	push   %rbp
+  805e9a:	48 89 e5             	mov    %rsp,%rbp
+  805e9d:	41 57                	push   %r15
+  805e9f:	53                   	push   %rbx
+  805ea0:	48 83 ec 10          	sub    $0x10,%rsp
+  805ea4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ea4 <opencons+0xb>
+  805eab:	49 bb 9c 31 00 00 00 	movabs $0x319c,%r11
+  805eb2:	00 00 00 
+  805eb5:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805eb8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805ebc:	48 89 c7             	mov    %rax,%rdi
+  805ebf:	49 89 df             	mov    %rbx,%r15
+  805ec2:	48 b8 7e a2 ff ff ff 	movabs $0xffffffffffffa27e,%rax
+  805ec9:	ff ff ff 
+  805ecc:	48 01 d8             	add    %rbx,%rax
+  805ecf:	ff d0                	call   *%rax
+  805ed1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ed4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ed8:	79 05                	jns    805edf <opencons+0x46>
+		return r;
+  805eda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805edd:	eb 68                	jmp    805f47 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805edf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ee3:	ba 07 04 00 00       	mov    $0x407,%edx
+  805ee8:	48 89 c6             	mov    %rax,%rsi
+  805eeb:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ef0:	49 89 df             	mov    %rbx,%r15
+  805ef3:	48 b8 cf 8e ff ff ff 	movabs $0xffffffffffff8ecf,%rax
+  805efa:	ff ff ff 
+  805efd:	48 01 d8             	add    %rbx,%rax
+  805f00:	ff d0                	call   *%rax
+  805f02:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f05:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f09:	79 05                	jns    805f10 <opencons+0x77>
+		return r;
+  805f0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f0e:	eb 37                	jmp    805f47 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805f10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f14:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  805f1b:	00 00 00 
+  805f1e:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805f21:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  805f23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f27:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805f2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f32:	48 89 c7             	mov    %rax,%rdi
+  805f35:	49 89 df             	mov    %rbx,%r15
+  805f38:	48 b8 04 a2 ff ff ff 	movabs $0xffffffffffffa204,%rax
+  805f3f:	ff ff ff 
+  805f42:	48 01 d8             	add    %rbx,%rax
+  805f45:	ff d0                	call   *%rax
+}
+  805f47:	48 83 c4 10          	add    $0x10,%rsp
+  805f4b:	5b                   	pop    %rbx
+  805f4c:	41 5f                	pop    %r15
+  805f4e:	5d                   	pop    %rbp
+  805f4f:	c3                   	ret
+
+0000000000805f50 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805f50:	55                   	push   %rbp
+  805f51:	48 89 e5             	mov    %rsp,%rbp
+  805f54:	41 57                	push   %r15
+  805f56:	53                   	push   %rbx
+  805f57:	48 83 ec 30          	sub    $0x30,%rsp
+  805f5b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f5b <devcons_read+0xb>
+  805f62:	49 bb e5 30 00 00 00 	movabs $0x30e5,%r11
+  805f69:	00 00 00 
+  805f6c:	4c 01 db             	add    %r11,%rbx
+  805f6f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805f73:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805f77:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  805f7b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805f80:	75 19                	jne    805f9b <devcons_read+0x4b>
+		return 0;
+  805f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f87:	eb 55                	jmp    805fde <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  805f89:	49 89 df             	mov    %rbx,%r15
+  805f8c:	48 b8 7a 8e ff ff ff 	movabs $0xffffffffffff8e7a,%rax
+  805f93:	ff ff ff 
+  805f96:	48 01 d8             	add    %rbx,%rax
+  805f99:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  805f9b:	49 89 df             	mov    %rbx,%r15
+  805f9e:	48 b8 76 8d ff ff ff 	movabs $0xffffffffffff8d76,%rax
+  805fa5:	ff ff ff 
+  805fa8:	48 01 d8             	add    %rbx,%rax
+  805fab:	ff d0                	call   *%rax
+  805fad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fb0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fb4:	74 d3                	je     805f89 <devcons_read+0x39>
+	if (c < 0)
+  805fb6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fba:	79 05                	jns    805fc1 <devcons_read+0x71>
+		return c;
+  805fbc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805fbf:	eb 1d                	jmp    805fde <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  805fc1:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  805fc5:	75 07                	jne    805fce <devcons_read+0x7e>
+		return 0;
+  805fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fcc:	eb 10                	jmp    805fde <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805fce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805fd1:	89 c2                	mov    %eax,%edx
+  805fd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fd7:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805fd9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805fde:	48 83 c4 30          	add    $0x30,%rsp
+  805fe2:	5b                   	pop    %rbx
+  805fe3:	41 5f                	pop    %r15
+  805fe5:	5d                   	pop    %rbp
+  805fe6:	c3                   	ret
+
+0000000000805fe7 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805fe7:	55                   	push   %rbp
+  805fe8:	48 89 e5             	mov    %rsp,%rbp
+  805feb:	41 57                	push   %r15
+  805fed:	53                   	push   %rbx
+  805fee:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805ff5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ff5 <devcons_write+0xe>
+  805ffc:	49 bb 4b 30 00 00 00 	movabs $0x304b,%r11
+  806003:	00 00 00 
+  806006:	4c 01 db             	add    %r11,%rbx
+  806009:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806010:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806017:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  80601e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806025:	e9 80 00 00 00       	jmp    8060aa <devcons_write+0xc3>
+		m = n - tot;
+  80602a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806031:	89 c2                	mov    %eax,%edx
+  806033:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806036:	29 c2                	sub    %eax,%edx
+  806038:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  80603b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80603e:	83 f8 7f             	cmp    $0x7f,%eax
+  806041:	76 07                	jbe    80604a <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806043:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80604a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80604d:	48 63 d0             	movslq %eax,%rdx
+  806050:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806053:	48 63 c8             	movslq %eax,%rcx
+  806056:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80605d:	48 01 c1             	add    %rax,%rcx
+  806060:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806067:	48 89 ce             	mov    %rcx,%rsi
+  80606a:	48 89 c7             	mov    %rax,%rdi
+  80606d:	49 89 df             	mov    %rbx,%r15
+  806070:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  806077:	ff ff ff 
+  80607a:	48 01 d8             	add    %rbx,%rax
+  80607d:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  80607f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806082:	48 63 d0             	movslq %eax,%rdx
+  806085:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80608c:	48 89 d6             	mov    %rdx,%rsi
+  80608f:	48 89 c7             	mov    %rax,%rdi
+  806092:	49 89 df             	mov    %rbx,%r15
+  806095:	48 b8 17 8d ff ff ff 	movabs $0xffffffffffff8d17,%rax
+  80609c:	ff ff ff 
+  80609f:	48 01 d8             	add    %rbx,%rax
+  8060a2:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8060a4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8060a7:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8060aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060ad:	48 98                	cltq
+  8060af:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8060b6:	0f 82 6e ff ff ff    	jb     80602a <devcons_write+0x43>
+	}
+	return tot;
+  8060bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8060bf:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8060c6:	5b                   	pop    %rbx
+  8060c7:	41 5f                	pop    %r15
+  8060c9:	5d                   	pop    %rbp
+  8060ca:	c3                   	ret
+
+00000000008060cb <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8060cb:	55                   	push   %rbp
+  8060cc:	48 89 e5             	mov    %rsp,%rbp
+  8060cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8060d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060d3 <devcons_close+0x8>
+  8060da:	49 bb 6d 2f 00 00 00 	movabs $0x2f6d,%r11
+  8060e1:	00 00 00 
+  8060e4:	4c 01 d8             	add    %r11,%rax
+  8060e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8060eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8060f0:	c9                   	leave
+  8060f1:	c3                   	ret
+
+00000000008060f2 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8060f2:	55                   	push   %rbp
+  8060f3:	48 89 e5             	mov    %rsp,%rbp
+  8060f6:	41 57                	push   %r15
+  8060f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8060fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060fc <devcons_stat+0xa>
+  806103:	49 bb 44 2f 00 00 00 	movabs $0x2f44,%r11
+  80610a:	00 00 00 
+  80610d:	4c 01 d8             	add    %r11,%rax
+  806110:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806114:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806118:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80611c:	48 b9 0d e3 ff ff ff 	movabs $0xffffffffffffe30d,%rcx
+  806123:	ff ff ff 
+  806126:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80612a:	48 89 ce             	mov    %rcx,%rsi
+  80612d:	48 89 d7             	mov    %rdx,%rdi
+  806130:	49 89 c7             	mov    %rax,%r15
+  806133:	48 ba 13 82 ff ff ff 	movabs $0xffffffffffff8213,%rdx
+  80613a:	ff ff ff 
+  80613d:	48 01 c2             	add    %rax,%rdx
+  806140:	ff d2                	call   *%rdx
+	return 0;
+  806142:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806147:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80614b:	c9                   	leave
+  80614c:	c3                   	ret
+
+000000000080614d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80614d:	55                   	push   %rbp
+  80614e:	48 89 e5             	mov    %rsp,%rbp
+  806151:	41 57                	push   %r15
+  806153:	41 54                	push   %r12
+  806155:	53                   	push   %rbx
+  806156:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80615d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80615d <_panic+0x10>
+  806164:	49 bb e3 2e 00 00 00 	movabs $0x2ee3,%r11
+  80616b:	00 00 00 
+  80616e:	4c 01 db             	add    %r11,%rbx
+  806171:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  806178:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80617e:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  806185:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80618c:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  806193:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80619a:	84 c0                	test   %al,%al
+  80619c:	74 26                	je     8061c4 <_panic+0x77>
+  80619e:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8061a5:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8061ac:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8061b0:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8061b4:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8061b8:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8061bc:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8061c0:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8061c4:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8061cb:	00 00 00 
+  8061ce:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8061d5:	00 00 00 
+  8061d8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8061dc:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8061e3:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8061ea:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8061f1:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8061f8:	ff ff ff 
+  8061fb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8061ff:	4c 8b 20             	mov    (%rax),%r12
+  806202:	49 89 df             	mov    %rbx,%r15
+  806205:	48 b8 26 8e ff ff ff 	movabs $0xffffffffffff8e26,%rax
+  80620c:	ff ff ff 
+  80620f:	48 01 d8             	add    %rbx,%rax
+  806212:	ff d0                	call   *%rax
+  806214:	89 c6                	mov    %eax,%esi
+  806216:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80621c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  806223:	41 89 d0             	mov    %edx,%r8d
+  806226:	48 89 c1             	mov    %rax,%rcx
+  806229:	4c 89 e2             	mov    %r12,%rdx
+  80622c:	48 b8 18 e3 ff ff ff 	movabs $0xffffffffffffe318,%rax
+  806233:	ff ff ff 
+  806236:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80623a:	48 89 c7             	mov    %rax,%rdi
+  80623d:	49 89 df             	mov    %rbx,%r15
+  806240:	b8 00 00 00 00       	mov    $0x0,%eax
+  806245:	49 b9 51 74 ff ff ff 	movabs $0xffffffffffff7451,%r9
+  80624c:	ff ff ff 
+  80624f:	49 01 d9             	add    %rbx,%r9
+  806252:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  806255:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80625c:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  806263:	48 89 d6             	mov    %rdx,%rsi
+  806266:	48 89 c7             	mov    %rax,%rdi
+  806269:	49 89 df             	mov    %rbx,%r15
+  80626c:	48 b8 71 73 ff ff ff 	movabs $0xffffffffffff7371,%rax
+  806273:	ff ff ff 
+  806276:	48 01 d8             	add    %rbx,%rax
+  806279:	ff d0                	call   *%rax
+	cprintf("\n");
+  80627b:	48 b8 3b e3 ff ff ff 	movabs $0xffffffffffffe33b,%rax
+  806282:	ff ff ff 
+  806285:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806289:	48 89 c7             	mov    %rax,%rdi
+  80628c:	49 89 df             	mov    %rbx,%r15
+  80628f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806294:	48 ba 51 74 ff ff ff 	movabs $0xffffffffffff7451,%rdx
+  80629b:	ff ff ff 
+  80629e:	48 01 da             	add    %rbx,%rdx
+  8062a1:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8062a3:	cc                   	int3
+  8062a4:	eb fd                	jmp    8062a3 <_panic+0x156>
+
+00000000008062a6 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8062a6:	55                   	push   %rbp
+  8062a7:	48 89 e5             	mov    %rsp,%rbp
+  8062aa:	41 57                	push   %r15
+  8062ac:	53                   	push   %rbx
+  8062ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8062b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8062b1 <set_pgfault_handler+0xb>
+  8062b8:	49 bb 8f 2d 00 00 00 	movabs $0x2d8f,%r11
+  8062bf:	00 00 00 
+  8062c2:	4c 01 db             	add    %r11,%rbx
+  8062c5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  8062c9:	49 89 df             	mov    %rbx,%r15
+  8062cc:	48 b8 26 8e ff ff ff 	movabs $0xffffffffffff8e26,%rax
+  8062d3:	ff ff ff 
+  8062d6:	48 01 d8             	add    %rbx,%rax
+  8062d9:	ff d0                	call   *%rax
+  8062db:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  8062de:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  8062e5:	00 00 00 
+  8062e8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8062ec:	48 85 c0             	test   %rax,%rax
+  8062ef:	75 6b                	jne    80635c <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  8062f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062f4:	ba 07 00 00 00       	mov    $0x7,%edx
+  8062f9:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8062fe:	48 89 ce             	mov    %rcx,%rsi
+  806301:	89 c7                	mov    %eax,%edi
+  806303:	49 89 df             	mov    %rbx,%r15
+  806306:	48 b8 cf 8e ff ff ff 	movabs $0xffffffffffff8ecf,%rax
+  80630d:	ff ff ff 
+  806310:	48 01 d8             	add    %rbx,%rax
+  806313:	ff d0                	call   *%rax
+  806315:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806318:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80631c:	74 3e                	je     80635c <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  80631e:	48 b8 40 e3 ff ff ff 	movabs $0xffffffffffffe340,%rax
+  806325:	ff ff ff 
+  806328:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80632c:	48 89 c2             	mov    %rax,%rdx
+  80632f:	be 23 00 00 00       	mov    $0x23,%esi
+  806334:	48 b8 6e e3 ff ff ff 	movabs $0xffffffffffffe36e,%rax
+  80633b:	ff ff ff 
+  80633e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806342:	48 89 c7             	mov    %rax,%rdi
+  806345:	49 89 df             	mov    %rbx,%r15
+  806348:	b8 00 00 00 00       	mov    $0x0,%eax
+  80634d:	48 b9 0d d1 ff ff ff 	movabs $0xffffffffffffd10d,%rcx
+  806354:	ff ff ff 
+  806357:	48 01 d9             	add    %rbx,%rcx
+  80635a:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80635c:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806363:	00 00 00 
+  806366:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80636a:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  80636e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806371:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806378:	ff ff ff 
+  80637b:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80637f:	48 89 d6             	mov    %rdx,%rsi
+  806382:	89 c7                	mov    %eax,%edi
+  806384:	49 89 df             	mov    %rbx,%r15
+  806387:	48 b8 c5 90 ff ff ff 	movabs $0xffffffffffff90c5,%rax
+  80638e:	ff ff ff 
+  806391:	48 01 d8             	add    %rbx,%rax
+  806394:	ff d0                	call   *%rax
+}
+  806396:	90                   	nop
+  806397:	48 83 c4 20          	add    $0x20,%rsp
+  80639b:	5b                   	pop    %rbx
+  80639c:	41 5f                	pop    %r15
+  80639e:	5d                   	pop    %rbp
+  80639f:	c3                   	ret
+
+00000000008063a0 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  8063a0:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  8063a3:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  8063aa:	00 00 00 
+call *%rax
+  8063ad:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  8063af:	58                   	pop    %rax
+	popq %rax;
+  8063b0:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  8063b1:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  8063b8:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  8063bc:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  8063c0:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  8063c4:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  8063c8:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  8063cc:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  8063cf:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  8063d3:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8063d7:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8063dc:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8063e1:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8063e6:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8063eb:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8063f0:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8063f5:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8063fa:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8063ff:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806404:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806409:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80640e:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806413:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806418:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80641d:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806421:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806425:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806426:	5c                   	pop    %rsp
+	ret;			//return
+  806427:	c3                   	ret
+
+0000000000806428 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806428:	55                   	push   %rbp
+  806429:	48 89 e5             	mov    %rsp,%rbp
+  80642c:	41 57                	push   %r15
+  80642e:	53                   	push   %rbx
+  80642f:	48 83 ec 30          	sub    $0x30,%rsp
+  806433:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806433 <ipc_recv+0xb>
+  80643a:	49 bb 0d 2c 00 00 00 	movabs $0x2c0d,%r11
+  806441:	00 00 00 
+  806444:	4c 01 db             	add    %r11,%rbx
+  806447:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80644b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80644f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  806453:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806458:	75 0e                	jne    806468 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  80645a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806461:	00 00 00 
+  806464:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  806468:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80646c:	48 89 c7             	mov    %rax,%rdi
+  80646f:	49 89 df             	mov    %rbx,%r15
+  806472:	48 b8 f8 91 ff ff ff 	movabs $0xffffffffffff91f8,%rax
+  806479:	ff ff ff 
+  80647c:	48 01 d8             	add    %rbx,%rax
+  80647f:	ff d0                	call   *%rax
+  806481:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  806484:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806489:	74 2a                	je     8064b5 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  80648b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80648f:	75 19                	jne    8064aa <ipc_recv+0x82>
+  806491:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806498:	ff ff ff 
+  80649b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80649f:	48 8b 00             	mov    (%rax),%rax
+  8064a2:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8064a8:	eb 05                	jmp    8064af <ipc_recv+0x87>
+  8064aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064af:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8064b3:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8064b5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8064ba:	74 2a                	je     8064e6 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8064bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8064c0:	75 19                	jne    8064db <ipc_recv+0xb3>
+  8064c2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8064c9:	ff ff ff 
+  8064cc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064d0:	48 8b 00             	mov    (%rax),%rax
+  8064d3:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8064d9:	eb 05                	jmp    8064e0 <ipc_recv+0xb8>
+  8064db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064e0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8064e4:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  8064e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8064ea:	74 05                	je     8064f1 <ipc_recv+0xc9>
+		return res;
+  8064ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064ef:	eb 17                	jmp    806508 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  8064f1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8064f8:	ff ff ff 
+  8064fb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064ff:	48 8b 00             	mov    (%rax),%rax
+  806502:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806508:	48 83 c4 30          	add    $0x30,%rsp
+  80650c:	5b                   	pop    %rbx
+  80650d:	41 5f                	pop    %r15
+  80650f:	5d                   	pop    %rbp
+  806510:	c3                   	ret
+
+0000000000806511 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806511:	55                   	push   %rbp
+  806512:	48 89 e5             	mov    %rsp,%rbp
+  806515:	41 57                	push   %r15
+  806517:	53                   	push   %rbx
+  806518:	48 83 ec 20          	sub    $0x20,%rsp
+  80651c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80651c <ipc_send+0xb>
+  806523:	49 bb 24 2b 00 00 00 	movabs $0x2b24,%r11
+  80652a:	00 00 00 
+  80652d:	4c 01 db             	add    %r11,%rbx
+  806530:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806533:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806536:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80653a:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  80653d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806542:	75 0e                	jne    806552 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806544:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80654b:	00 00 00 
+  80654e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  806552:	90                   	nop
+  806553:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806556:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806559:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80655d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806560:	89 c7                	mov    %eax,%edi
+  806562:	49 89 df             	mov    %rbx,%r15
+  806565:	48 b8 8e 91 ff ff ff 	movabs $0xffffffffffff918e,%rax
+  80656c:	ff ff ff 
+  80656f:	48 01 d8             	add    %rbx,%rax
+  806572:	ff d0                	call   *%rax
+  806574:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  806577:	74 da                	je     806553 <ipc_send+0x42>
+		;
+}
+  806579:	90                   	nop
+  80657a:	90                   	nop
+  80657b:	48 83 c4 20          	add    $0x20,%rsp
+  80657f:	5b                   	pop    %rbx
+  806580:	41 5f                	pop    %r15
+  806582:	5d                   	pop    %rbp
+  806583:	c3                   	ret
+
+0000000000806584 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  806584:	55                   	push   %rbp
+  806585:	48 89 e5             	mov    %rsp,%rbp
+  806588:	41 57                	push   %r15
+  80658a:	53                   	push   %rbx
+  80658b:	48 83 ec 40          	sub    $0x40,%rsp
+  80658f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80658f <ipc_call+0xb>
+  806596:	49 bb b1 2a 00 00 00 	movabs $0x2ab1,%r11
+  80659d:	00 00 00 
+  8065a0:	4c 01 db             	add    %r11,%rbx
+  8065a3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8065a6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8065a9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8065ad:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8065b0:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8065b4:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8065b8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8065bd:	75 0e                	jne    8065cd <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  8065bf:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8065c6:	00 00 00 
+  8065c9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8065cd:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8065d2:	75 0e                	jne    8065e2 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8065d4:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8065db:	00 00 00 
+  8065de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8065e2:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8065e5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8065e9:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8065ec:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8065f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8065f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8065f9:	49 89 f8             	mov    %rdi,%r8
+  8065fc:	89 c7                	mov    %eax,%edi
+  8065fe:	49 89 df             	mov    %rbx,%r15
+  806601:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  806608:	ff ff ff 
+  80660b:	48 01 d8             	add    %rbx,%rax
+  80660e:	ff d0                	call   *%rax
+  806610:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806613:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806618:	74 2a                	je     806644 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80661a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80661e:	75 19                	jne    806639 <ipc_call+0xb5>
+  806620:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806627:	ff ff ff 
+  80662a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80662e:	48 8b 00             	mov    (%rax),%rax
+  806631:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806637:	eb 05                	jmp    80663e <ipc_call+0xba>
+  806639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80663e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806642:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806644:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806648:	74 05                	je     80664f <ipc_call+0xcb>
+		return r;
+  80664a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80664d:	eb 17                	jmp    806666 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  80664f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806656:	ff ff ff 
+  806659:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80665d:	48 8b 00             	mov    (%rax),%rax
+  806660:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806666:	48 83 c4 40          	add    $0x40,%rsp
+  80666a:	5b                   	pop    %rbx
+  80666b:	41 5f                	pop    %r15
+  80666d:	5d                   	pop    %rbp
+  80666e:	c3                   	ret
+
+000000000080666f <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  80666f:	55                   	push   %rbp
+  806670:	48 89 e5             	mov    %rsp,%rbp
+  806673:	41 57                	push   %r15
+  806675:	53                   	push   %rbx
+  806676:	48 83 ec 70          	sub    $0x70,%rsp
+  80667a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80667a <ipc_callw+0xb>
+  806681:	49 bb c6 29 00 00 00 	movabs $0x29c6,%r11
+  806688:	00 00 00 
+  80668b:	4c 01 db             	add    %r11,%rbx
+  80668e:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806691:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806694:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806698:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  80669c:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8066a1:	76 0a                	jbe    8066ad <ipc_callw+0x3e>
+		return -E_INVAL;
+  8066a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8066a8:	e9 b7 00 00 00       	jmp    806764 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8066ad:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8066b1:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8066b5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8066b9:	48 89 ce             	mov    %rcx,%rsi
+  8066bc:	48 89 c7             	mov    %rax,%rdi
+  8066bf:	49 89 df             	mov    %rbx,%r15
+  8066c2:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  8066c9:	ff ff ff 
+  8066cc:	48 01 d8             	add    %rbx,%rax
+  8066cf:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  8066d1:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8066d8:	00 
+  8066d9:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8066dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066e1:	48 01 d0             	add    %rdx,%rax
+  8066e4:	48 83 e8 01          	sub    $0x1,%rax
+  8066e8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8066ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8066f5:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8066f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066fd:	48 29 d0             	sub    %rdx,%rax
+  806700:	48 c1 e8 03          	shr    $0x3,%rax
+  806704:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806708:	89 c1                	mov    %eax,%ecx
+  80670a:	8b 75 98             	mov    -0x68(%rbp),%esi
+  80670d:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806711:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806714:	49 89 d1             	mov    %rdx,%r9
+  806717:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  80671e:	00 00 00 
+  806721:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806728:	00 00 00 
+  80672b:	89 c7                	mov    %eax,%edi
+  80672d:	49 89 df             	mov    %rbx,%r15
+  806730:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  806737:	ff ff ff 
+  80673a:	48 01 d8             	add    %rbx,%rax
+  80673d:	ff d0                	call   *%rax
+  80673f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806742:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806746:	74 05                	je     80674d <ipc_callw+0xde>
+		return r;
+  806748:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80674b:	eb 17                	jmp    806764 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  80674d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806754:	ff ff ff 
+  806757:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80675b:	48 8b 00             	mov    (%rax),%rax
+  80675e:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806764:	48 83 c4 70          	add    $0x70,%rsp
+  806768:	5b                   	pop    %rbx
+  806769:	41 5f                	pop    %r15
+  80676b:	5d                   	pop    %rbp
+  80676c:	c3                   	ret
+
+000000000080676d <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  80676d:	55                   	push   %rbp
+  80676e:	48 89 e5             	mov    %rsp,%rbp
+  806771:	41 57                	push   %r15
+  806773:	53                   	push   %rbx
+  806774:	48 83 ec 40          	sub    $0x40,%rsp
+  806778:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806778 <ipc_callv+0xb>
+  80677f:	49 bb c8 28 00 00 00 	movabs $0x28c8,%r11
+  806786:	00 00 00 
+  806789:	4c 01 db             	add    %r11,%rbx
+  80678c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80678f:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806792:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806796:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806799:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  80679d:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  8067a1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8067a8:	00 00 00 
+  8067ab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  8067af:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  8067b3:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8067b7:	74 11                	je     8067ca <ipc_callv+0x5d>
+		pg = (void *) segs;
+  8067b9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8067bd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  8067c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8067c4:	c1 e0 14             	shl    $0x14,%eax
+  8067c7:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  8067ca:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  8067ce:	74 14                	je     8067e4 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  8067d0:	8b 45 20             	mov    0x20(%rbp),%eax
+  8067d3:	83 e8 01             	sub    $0x1,%eax
+  8067d6:	48 63 d0             	movslq %eax,%rdx
+  8067d9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8067dd:	48 09 d0             	or     %rdx,%rax
+  8067e0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  8067e4:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8067e7:	c1 e0 10             	shl    $0x10,%eax
+  8067ea:	0b 45 10             	or     0x10(%rbp),%eax
+  8067ed:	89 c1                	mov    %eax,%ecx
+  8067ef:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  8067f2:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8067f6:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8067fa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8067fe:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806801:	4d 89 c1             	mov    %r8,%r9
+  806804:	49 89 f8             	mov    %rdi,%r8
+  806807:	89 c7                	mov    %eax,%edi
+  806809:	49 89 df             	mov    %rbx,%r15
+  80680c:	48 b8 51 92 ff ff ff 	movabs $0xffffffffffff9251,%rax
+  806813:	ff ff ff 
+  806816:	48 01 d8             	add    %rbx,%rax
+  806819:	ff d0                	call   *%rax
+  80681b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  80681e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806822:	74 05                	je     806829 <ipc_callv+0xbc>
+		return r;
+  806824:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806827:	eb 17                	jmp    806840 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806829:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806830:	ff ff ff 
+  806833:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806837:	48 8b 00             	mov    (%rax),%rax
+  80683a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806840:	48 83 c4 40          	add    $0x40,%rsp
+  806844:	5b                   	pop    %rbx
+  806845:	41 5f                	pop    %r15
+  806847:	5d                   	pop    %rbp
+  806848:	c3                   	ret
+
+0000000000806849 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806849:	55                   	push   %rbp
+  80684a:	48 89 e5             	mov    %rsp,%rbp
+  80684d:	41 57                	push   %r15
+  80684f:	53                   	push   %rbx
+  806850:	48 83 ec 40          	sub    $0x40,%rsp
+  806854:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806854 <ipc_reply_recv+0xb>
+  80685b:	49 bb ec 27 00 00 00 	movabs $0x27ec,%r11
+  806862:	00 00 00 
+  806865:	4c 01 db             	add    %r11,%rbx
+  806868:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80686b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80686e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806872:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806875:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806879:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80687d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806882:	75 0e                	jne    806892 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806884:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80688b:	00 00 00 
+  80688e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806892:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806897:	75 0e                	jne    8068a7 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806899:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8068a0:	00 00 00 
+  8068a3:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  8068a7:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8068aa:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  8068ae:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8068b2:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8068b5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8068b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8068bc:	4d 89 c1             	mov    %r8,%r9
+  8068bf:	49 89 f8             	mov    %rdi,%r8
+  8068c2:	89 c7                	mov    %eax,%edi
+  8068c4:	49 89 df             	mov    %rbx,%r15
+  8068c7:	48 b8 c5 92 ff ff ff 	movabs $0xffffffffffff92c5,%rax
+  8068ce:	ff ff ff 
+  8068d1:	48 01 d8             	add    %rbx,%rax
+  8068d4:	ff d0                	call   *%rax
+  8068d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  8068d9:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8068de:	74 2a                	je     80690a <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8068e0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068e4:	75 19                	jne    8068ff <ipc_reply_recv+0xb6>
+  8068e6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068ed:	ff ff ff 
+  8068f0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068f4:	48 8b 00             	mov    (%rax),%rax
+  8068f7:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8068fd:	eb 05                	jmp    806904 <ipc_reply_recv+0xbb>
+  8068ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  806904:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806908:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  80690a:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  80690f:	74 2a                	je     80693b <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806911:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806915:	75 19                	jne    806930 <ipc_reply_recv+0xe7>
+  806917:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80691e:	ff ff ff 
+  806921:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806925:	48 8b 00             	mov    (%rax),%rax
+  806928:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80692e:	eb 05                	jmp    806935 <ipc_reply_recv+0xec>
+  806930:	b8 00 00 00 00       	mov    $0x0,%eax
+  806935:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806939:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  80693b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80693f:	74 05                	je     806946 <ipc_reply_recv+0xfd>
+		return r;
+  806941:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806944:	eb 17                	jmp    80695d <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806946:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80694d:	ff ff ff 
+  806950:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806954:	48 8b 00             	mov    (%rax),%rax
+  806957:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80695d:	48 83 c4 40          	add    $0x40,%rsp
+  806961:	5b                   	pop    %rbx
+  806962:	41 5f                	pop    %r15
+  806964:	5d                   	pop    %rbp
+  806965:	c3                   	ret
+
+0000000000806966 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806966:	55                   	push   %rbp
+  806967:	48 89 e5             	mov    %rsp,%rbp
+  80696a:	41 57                	push   %r15
+  80696c:	53                   	push   %rbx
+  80696d:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806974:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806974 <ipc_window_batch+0xe>
+  80697b:	49 bb cc 26 00 00 00 	movabs $0x26cc,%r11
+  806982:	00 00 00 
+  806985:	4c 01 db             	add    %r11,%rbx
+  806988:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  80698e:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806995:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  80699b:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  8069a1:	e9 15 01 00 00       	jmp    806abb <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  8069a6:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  8069ac:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8069af:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  8069b6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8069b9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8069bc:	39 c2                	cmp    %eax,%edx
+  8069be:	0f 4e c2             	cmovle %edx,%eax
+  8069c1:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  8069c4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8069cb:	eb 6b                	jmp    806a38 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  8069cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069d0:	48 98                	cltq
+  8069d2:	48 c1 e0 05          	shl    $0x5,%rax
+  8069d6:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8069da:	48 01 e8             	add    %rbp,%rax
+  8069dd:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  8069e3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  8069e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069ec:	c1 e0 0c             	shl    $0xc,%eax
+  8069ef:	48 63 d0             	movslq %eax,%rdx
+  8069f2:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  8069f9:	48 01 c2             	add    %rax,%rdx
+  8069fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069ff:	48 98                	cltq
+  806a01:	48 c1 e0 05          	shl    $0x5,%rax
+  806a05:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806a09:	48 01 e8             	add    %rbp,%rax
+  806a0c:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806a12:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806a15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a18:	48 98                	cltq
+  806a1a:	48 c1 e0 05          	shl    $0x5,%rax
+  806a1e:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806a22:	48 01 e8             	add    %rbp,%rax
+  806a25:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806a2c:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806a32:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806a34:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806a38:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a3b:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806a3e:	7c 8d                	jl     8069cd <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806a40:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806a47:	74 27                	je     806a70 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806a49:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806a4c:	48 63 d0             	movslq %eax,%rdx
+  806a4f:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806a56:	48 89 d6             	mov    %rdx,%rsi
+  806a59:	48 89 c7             	mov    %rax,%rdi
+  806a5c:	49 89 df             	mov    %rbx,%r15
+  806a5f:	48 b8 68 95 ff ff ff 	movabs $0xffffffffffff9568,%rax
+  806a66:	ff ff ff 
+  806a69:	48 01 d8             	add    %rbx,%rax
+  806a6c:	ff d0                	call   *%rax
+  806a6e:	eb 25                	jmp    806a95 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806a70:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806a73:	48 63 d0             	movslq %eax,%rdx
+  806a76:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806a7d:	48 89 d6             	mov    %rdx,%rsi
+  806a80:	48 89 c7             	mov    %rax,%rdi
+  806a83:	49 89 df             	mov    %rbx,%r15
+  806a86:	48 b8 c6 95 ff ff ff 	movabs $0xffffffffffff95c6,%rax
+  806a8d:	ff ff ff 
+  806a90:	48 01 d8             	add    %rbx,%rax
+  806a93:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806a95:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806a98:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806a9c:	79 05                	jns    806aa3 <ipc_window_batch+0x13d>
+			return r;
+  806a9e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806aa1:	eb 2a                	jmp    806acd <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806aa3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806aa6:	c1 e0 0c             	shl    $0xc,%eax
+  806aa9:	48 98                	cltq
+  806aab:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806ab2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806ab5:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806abb:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806ac2:	0f 8f de fe ff ff    	jg     8069a6 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806acd:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806ad4:	5b                   	pop    %rbx
+  806ad5:	41 5f                	pop    %r15
+  806ad7:	5d                   	pop    %rbp
+  806ad8:	c3                   	ret
+
+0000000000806ad9 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806ad9:	55                   	push   %rbp
+  806ada:	48 89 e5             	mov    %rsp,%rbp
+  806add:	48 83 ec 10          	sub    $0x10,%rsp
+  806ae1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806ae1 <ipc_map_window+0x8>
+  806ae8:	49 bb 5f 25 00 00 00 	movabs $0x255f,%r11
+  806aef:	00 00 00 
+  806af2:	4c 01 d8             	add    %r11,%rax
+  806af5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806af9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806afc:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806aff:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806b03:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806b08:	bf 01 00 00 00       	mov    $0x1,%edi
+  806b0d:	49 b8 26 d9 ff ff ff 	movabs $0xffffffffffffd926,%r8
+  806b14:	ff ff ff 
+  806b17:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806b1b:	ff d0                	call   *%rax
+}
+  806b1d:	c9                   	leave
+  806b1e:	c3                   	ret
+
+0000000000806b1f <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806b1f:	55                   	push   %rbp
+  806b20:	48 89 e5             	mov    %rsp,%rbp
+  806b23:	48 83 ec 10          	sub    $0x10,%rsp
+  806b27:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806b27 <ipc_unmap_window+0x8>
+  806b2e:	49 bb 19 25 00 00 00 	movabs $0x2519,%r11
+  806b35:	00 00 00 
+  806b38:	4c 01 d8             	add    %r11,%rax
+  806b3b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806b3f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806b42:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806b45:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806b49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806b4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806b53:	49 b8 26 d9 ff ff ff 	movabs $0xffffffffffffd926,%r8
+  806b5a:	ff ff ff 
+  806b5d:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806b61:	ff d0                	call   *%rax
+}
+  806b63:	c9                   	leave
+  806b64:	c3                   	ret
+
+0000000000806b65 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806b65:	55                   	push   %rbp
+  806b66:	48 89 e5             	mov    %rsp,%rbp
+  806b69:	48 83 ec 18          	sub    $0x18,%rsp
+  806b6d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806b6d <ipc_find_env+0x8>
+  806b74:	49 bb d3 24 00 00 00 	movabs $0x24d3,%r11
+  806b7b:	00 00 00 
+  806b7e:	4c 01 d8             	add    %r11,%rax
+  806b81:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806b84:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806b8b:	eb 57                	jmp    806be4 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806b8d:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806b94:	ff ff ff 
+  806b97:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806b9b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806b9e:	48 63 d2             	movslq %edx,%rdx
+  806ba1:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806ba8:	48 01 ca             	add    %rcx,%rdx
+  806bab:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806bb2:	8b 12                	mov    (%rdx),%edx
+  806bb4:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806bb7:	75 27                	jne    806be0 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806bb9:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806bc0:	ff ff ff 
+  806bc3:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806bc7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806bca:	48 98                	cltq
+  806bcc:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806bd3:	48 01 d0             	add    %rdx,%rax
+  806bd6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806bdc:	8b 00                	mov    (%rax),%eax
+  806bde:	eb 12                	jmp    806bf2 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806be0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806be4:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806beb:	7e a0                	jle    806b8d <ipc_find_env+0x28>
+	}
+	return 0;
+  806bed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806bf2:	c9                   	leave
+  806bf3:	c3                   	ret
+
+0000000000806bf4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806bf4:	55                   	push   %rbp
+  806bf5:	48 89 e5             	mov    %rsp,%rbp
+  806bf8:	48 83 ec 18          	sub    $0x18,%rsp
+  806bfc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806bfc <pageref+0x8>
+  806c03:	49 bb 44 24 00 00 00 	movabs $0x2444,%r11
+  806c0a:	00 00 00 
+  806c0d:	4c 01 d8             	add    %r11,%rax
+  806c10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806c14:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c18:	48 89 d1             	mov    %rdx,%rcx
+  806c1b:	48 c1 e9 15          	shr    $0x15,%rcx
+  806c1f:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806c26:	ff ff ff 
+  806c29:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806c2d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806c31:	83 e2 01             	and    $0x1,%edx
+  806c34:	48 85 d2             	test   %rdx,%rdx
+  806c37:	75 07                	jne    806c40 <pageref+0x4c>
+		return 0;
+  806c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c3e:	eb 64                	jmp    806ca4 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806c40:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c44:	48 89 d1             	mov    %rdx,%rcx
+  806c47:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806c4b:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806c52:	ff ff ff 
+  806c55:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806c59:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806c5d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806c61:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806c65:	83 e2 01             	and    $0x1,%edx
+  806c68:	48 85 d2             	test   %rdx,%rdx
+  806c6b:	75 07                	jne    806c74 <pageref+0x80>
+		return 0;
+  806c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c72:	eb 30                	jmp    806ca4 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806c74:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806c78:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806c7c:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806c83:	ff ff ff 
+  806c86:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806c8a:	48 89 d0             	mov    %rdx,%rax
+  806c8d:	48 01 c0             	add    %rax,%rax
+  806c90:	48 01 d0             	add    %rdx,%rax
+  806c93:	48 c1 e0 03          	shl    $0x3,%rax
+  806c97:	48 01 c8             	add    %rcx,%rax
+  806c9a:	48 83 c0 08          	add    $0x8,%rax
+  806c9e:	0f b7 00             	movzwl (%rax),%eax
+  806ca1:	0f b7 c0             	movzwl %ax,%eax
+}
+  806ca4:	c9                   	leave
+  806ca5:	c3                   	ret
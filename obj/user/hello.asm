@@ -0,0 +1,9276 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 9b 00 00 00       	call   8000dc <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 10          	sub    $0x10,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb e2 7f 00 00 00 	movabs $0x7fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800065:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	cprintf("hello, world\n");
+  800069:	48 b8 40 de ff ff ff 	movabs $0xffffffffffffde40,%rax
+  800070:	ff ff ff 
+  800073:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800077:	48 89 c7             	mov    %rax,%rdi
+  80007a:	49 89 df             	mov    %rbx,%r15
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	48 ba 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rdx
+  800089:	ff ff ff 
+  80008c:	48 01 da             	add    %rbx,%rdx
+  80008f:	ff d2                	call   *%rdx
+	cprintf("i am environment %08x\n", thisenv->env_id);
+  800091:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  800098:	ff ff ff 
+  80009b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80009f:	48 8b 00             	mov    (%rax),%rax
+  8000a2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8000a8:	89 c6                	mov    %eax,%esi
+  8000aa:	48 b8 4e de ff ff ff 	movabs $0xffffffffffffde4e,%rax
+  8000b1:	ff ff ff 
+  8000b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000b8:	48 89 c7             	mov    %rax,%rdi
+  8000bb:	49 89 df             	mov    %rbx,%r15
+  8000be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c3:	48 ba 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rdx
+  8000ca:	ff ff ff 
+  8000cd:	48 01 da             	add    %rbx,%rdx
+  8000d0:	ff d2                	call   *%rdx
+}
+  8000d2:	90                   	nop
+  8000d3:	48 83 c4 10          	add    $0x10,%rsp
+  8000d7:	5b                   	pop    %rbx
+  8000d8:	41 5f                	pop    %r15
+  8000da:	5d                   	pop    %rbp
+  8000db:	c3                   	ret
+
+00000000008000dc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000dc:	55                   	push   %rbp
+  8000dd:	48 89 e5             	mov    %rsp,%rbp
+  8000e0:	41 57                	push   %r15
+  8000e2:	53                   	push   %rbx
+  8000e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8000e7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000e7 <libmain+0xb>
+  8000ee:	49 bb 49 7f 00 00 00 	movabs $0x7f49,%r11
+  8000f5:	00 00 00 
+  8000f8:	4c 01 db             	add    %r11,%rbx
+  8000fb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8000fe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800102:	49 89 df             	mov    %rbx,%r15
+  800105:	48 b8 09 9d ff ff ff 	movabs $0xffffffffffff9d09,%rax
+  80010c:	ff ff ff 
+  80010f:	48 01 d8             	add    %rbx,%rax
+  800112:	ff d0                	call   *%rax
+  800114:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800117:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80011a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80011f:	48 98                	cltq
+  800121:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800128:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  80012f:	ff ff ff 
+  800132:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800136:	48 01 c2             	add    %rax,%rdx
+  800139:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  800140:	00 00 00 
+  800143:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800147:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80014b:	7e 15                	jle    800162 <libmain+0x86>
+		binaryname = argv[0];
+  80014d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800151:	48 8b 00             	mov    (%rax),%rax
+  800154:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  80015b:	00 00 00 
+  80015e:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800162:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800166:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800169:	48 89 d6             	mov    %rdx,%rsi
+  80016c:	89 c7                	mov    %eax,%edi
+  80016e:	49 89 df             	mov    %rbx,%r15
+  800171:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  800178:	ff ff ff 
+  80017b:	48 01 d8             	add    %rbx,%rax
+  80017e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800180:	49 89 df             	mov    %rbx,%r15
+  800183:	48 b8 6c 81 ff ff ff 	movabs $0xffffffffffff816c,%rax
+  80018a:	ff ff ff 
+  80018d:	48 01 d8             	add    %rbx,%rax
+  800190:	ff d0                	call   *%rax
+}
+  800192:	90                   	nop
+  800193:	48 83 c4 20          	add    $0x20,%rsp
+  800197:	5b                   	pop    %rbx
+  800198:	41 5f                	pop    %r15
+  80019a:	5d                   	pop    %rbp
+  80019b:	c3                   	ret
+
+000000000080019c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80019c:	55                   	push   %rbp
+  80019d:	48 89 e5             	mov    %rsp,%rbp
+  8001a0:	41 57                	push   %r15
+  8001a2:	53                   	push   %rbx
+  8001a3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8001a3 <exit+0x7>
+  8001aa:	49 bb 8d 7e 00 00 00 	movabs $0x7e8d,%r11
+  8001b1:	00 00 00 
+  8001b4:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8001b7:	49 89 df             	mov    %rbx,%r15
+  8001ba:	48 b8 86 a9 ff ff ff 	movabs $0xffffffffffffa986,%rax
+  8001c1:	ff ff ff 
+  8001c4:	48 01 d8             	add    %rbx,%rax
+  8001c7:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8001c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ce:	49 89 df             	mov    %rbx,%r15
+  8001d1:	48 b8 ad 9c ff ff ff 	movabs $0xffffffffffff9cad,%rax
+  8001d8:	ff ff ff 
+  8001db:	48 01 d8             	add    %rbx,%rax
+  8001de:	ff d0                	call   *%rax
+}
+  8001e0:	90                   	nop
+  8001e1:	5b                   	pop    %rbx
+  8001e2:	41 5f                	pop    %r15
+  8001e4:	5d                   	pop    %rbp
+  8001e5:	c3                   	ret
+
+00000000008001e6 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8001e6:	55                   	push   %rbp
+  8001e7:	48 89 e5             	mov    %rsp,%rbp
+  8001ea:	41 57                	push   %r15
+  8001ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8001f0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8001f0 <putch+0xa>
+  8001f7:	49 bb 40 7e 00 00 00 	movabs $0x7e40,%r11
+  8001fe:	00 00 00 
+  800201:	4c 01 d8             	add    %r11,%rax
+  800204:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800207:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80020b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80020f:	8b 12                	mov    (%rdx),%edx
+  800211:	8d 72 01             	lea    0x1(%rdx),%esi
+  800214:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800218:	89 31                	mov    %esi,(%rcx)
+  80021a:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80021d:	89 ce                	mov    %ecx,%esi
+  80021f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800223:	48 63 d2             	movslq %edx,%rdx
+  800226:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80022b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80022f:	8b 12                	mov    (%rdx),%edx
+  800231:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800237:	75 33                	jne    80026c <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800239:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80023d:	8b 12                	mov    (%rdx),%edx
+  80023f:	48 63 d2             	movslq %edx,%rdx
+  800242:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800246:	48 83 c1 08          	add    $0x8,%rcx
+  80024a:	48 89 d6             	mov    %rdx,%rsi
+  80024d:	48 89 cf             	mov    %rcx,%rdi
+  800250:	49 89 c7             	mov    %rax,%r15
+  800253:	48 ba fa 9b ff ff ff 	movabs $0xffffffffffff9bfa,%rdx
+  80025a:	ff ff ff 
+  80025d:	48 01 c2             	add    %rax,%rdx
+  800260:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800262:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800266:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80026c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800270:	8b 40 04             	mov    0x4(%rax),%eax
+  800273:	8d 50 01             	lea    0x1(%rax),%edx
+  800276:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80027a:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80027d:	90                   	nop
+  80027e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800282:	c9                   	leave
+  800283:	c3                   	ret
+
+0000000000800284 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800284:	55                   	push   %rbp
+  800285:	48 89 e5             	mov    %rsp,%rbp
+  800288:	41 57                	push   %r15
+  80028a:	53                   	push   %rbx
+  80028b:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800292:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800292 <vcprintf+0xe>
+  800299:	49 bb 9e 7d 00 00 00 	movabs $0x7d9e,%r11
+  8002a0:	00 00 00 
+  8002a3:	4c 01 db             	add    %r11,%rbx
+  8002a6:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8002ad:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8002b4:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8002bb:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8002c2:	48 8b 06             	mov    (%rsi),%rax
+  8002c5:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8002c9:	48 89 01             	mov    %rax,(%rcx)
+  8002cc:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8002d0:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8002d4:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8002d8:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8002df:	00 00 00 
+    b.cnt = 0;
+  8002e2:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8002e9:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8002ec:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8002f3:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8002fa:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800301:	48 89 c6             	mov    %rax,%rsi
+  800304:	48 b8 b6 81 ff ff ff 	movabs $0xffffffffffff81b6,%rax
+  80030b:	ff ff ff 
+  80030e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800312:	48 89 c7             	mov    %rax,%rdi
+  800315:	49 89 df             	mov    %rbx,%r15
+  800318:	48 b8 78 87 ff ff ff 	movabs $0xffffffffffff8778,%rax
+  80031f:	ff ff ff 
+  800322:	48 01 d8             	add    %rbx,%rax
+  800325:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800327:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80032d:	48 98                	cltq
+  80032f:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800336:	48 83 c2 08          	add    $0x8,%rdx
+  80033a:	48 89 c6             	mov    %rax,%rsi
+  80033d:	48 89 d7             	mov    %rdx,%rdi
+  800340:	49 89 df             	mov    %rbx,%r15
+  800343:	48 b8 fa 9b ff ff ff 	movabs $0xffffffffffff9bfa,%rax
+  80034a:	ff ff ff 
+  80034d:	48 01 d8             	add    %rbx,%rax
+  800350:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800352:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800358:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80035f:	5b                   	pop    %rbx
+  800360:	41 5f                	pop    %r15
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80036f:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80036f <cprintf+0xb>
+  800376:	49 bb c1 7c 00 00 00 	movabs $0x7cc1,%r11
+  80037d:	00 00 00 
+  800380:	4d 01 da             	add    %r11,%r10
+  800383:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80038a:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800391:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800398:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80039f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8003a6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8003ad:	84 c0                	test   %al,%al
+  8003af:	74 20                	je     8003d1 <cprintf+0x6d>
+  8003b1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8003b5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8003b9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8003bd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8003c1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8003c5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8003c9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8003cd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8003d1:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8003d8:	00 00 00 
+  8003db:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8003e2:	00 00 00 
+  8003e5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003e9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8003f0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8003f7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8003fe:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800405:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80040c:	48 8b 06             	mov    (%rsi),%rax
+  80040f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800413:	48 89 01             	mov    %rax,(%rcx)
+  800416:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80041a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80041e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800422:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800429:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800430:	48 89 d6             	mov    %rdx,%rsi
+  800433:	48 89 c7             	mov    %rax,%rdi
+  800436:	48 b8 54 82 ff ff ff 	movabs $0xffffffffffff8254,%rax
+  80043d:	ff ff ff 
+  800440:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800444:	ff d0                	call   *%rax
+  800446:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80044c:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800452:	c9                   	leave
+  800453:	c3                   	ret
+
+0000000000800454 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800454:	55                   	push   %rbp
+  800455:	48 89 e5             	mov    %rsp,%rbp
+  800458:	53                   	push   %rbx
+  800459:	48 83 ec 38          	sub    $0x38,%rsp
+  80045d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80045d <printnum+0x9>
+  800464:	49 bb d3 7b 00 00 00 	movabs $0x7bd3,%r11
+  80046b:	00 00 00 
+  80046e:	4c 01 db             	add    %r11,%rbx
+  800471:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800475:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800479:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80047d:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800480:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800484:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800488:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80048b:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80048f:	72 58                	jb     8004e9 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800491:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800494:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800497:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  80049a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80049e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a3:	48 f7 f6             	div    %rsi
+  8004a6:	49 89 c2             	mov    %rax,%r10
+  8004a9:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8004ac:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8004af:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8004b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004b7:	41 89 c9             	mov    %ecx,%r9d
+  8004ba:	41 89 f8             	mov    %edi,%r8d
+  8004bd:	89 d1                	mov    %edx,%ecx
+  8004bf:	4c 89 d2             	mov    %r10,%rdx
+  8004c2:	48 89 c7             	mov    %rax,%rdi
+  8004c5:	48 b8 24 84 ff ff ff 	movabs $0xffffffffffff8424,%rax
+  8004cc:	ff ff ff 
+  8004cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004d3:	ff d0                	call   *%rax
+  8004d5:	eb 1c                	jmp    8004f3 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8004d7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004db:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8004de:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8004e2:	48 89 d6             	mov    %rdx,%rsi
+  8004e5:	89 c7                	mov    %eax,%edi
+  8004e7:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8004e9:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8004ed:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8004f1:	7f e4                	jg     8004d7 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004f3:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8004f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8004fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ff:	48 f7 f1             	div    %rcx
+  800502:	48 b8 a7 df ff ff ff 	movabs $0xffffffffffffdfa7,%rax
+  800509:	ff ff ff 
+  80050c:	48 01 d8             	add    %rbx,%rax
+  80050f:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800513:	0f be c0             	movsbl %al,%eax
+  800516:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80051a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80051e:	48 89 d6             	mov    %rdx,%rsi
+  800521:	89 c7                	mov    %eax,%edi
+  800523:	ff d1                	call   *%rcx
+}
+  800525:	90                   	nop
+  800526:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80052a:	c9                   	leave
+  80052b:	c3                   	ret
+
+000000000080052c <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80052c:	55                   	push   %rbp
+  80052d:	48 89 e5             	mov    %rsp,%rbp
+  800530:	48 83 ec 20          	sub    $0x20,%rsp
+  800534:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800534 <getuint+0x8>
+  80053b:	49 bb fc 7a 00 00 00 	movabs $0x7afc,%r11
+  800542:	00 00 00 
+  800545:	4c 01 d8             	add    %r11,%rax
+  800548:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80054c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80054f:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800553:	7e 4f                	jle    8005a4 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800555:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800559:	8b 00                	mov    (%rax),%eax
+  80055b:	83 f8 2f             	cmp    $0x2f,%eax
+  80055e:	77 24                	ja     800584 <getuint+0x58>
+  800560:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800564:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800568:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80056c:	8b 00                	mov    (%rax),%eax
+  80056e:	89 c0                	mov    %eax,%eax
+  800570:	48 01 d0             	add    %rdx,%rax
+  800573:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800577:	8b 12                	mov    (%rdx),%edx
+  800579:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80057c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800580:	89 0a                	mov    %ecx,(%rdx)
+  800582:	eb 14                	jmp    800598 <getuint+0x6c>
+  800584:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800588:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80058c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800590:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800594:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800598:	48 8b 00             	mov    (%rax),%rax
+  80059b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80059f:	e9 9d 00 00 00       	jmp    800641 <getuint+0x115>
+	else if (lflag)
+  8005a4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8005a8:	74 4c                	je     8005f6 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8005aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005ae:	8b 00                	mov    (%rax),%eax
+  8005b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b3:	77 24                	ja     8005d9 <getuint+0xad>
+  8005b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005b9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005c1:	8b 00                	mov    (%rax),%eax
+  8005c3:	89 c0                	mov    %eax,%eax
+  8005c5:	48 01 d0             	add    %rdx,%rax
+  8005c8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005cc:	8b 12                	mov    (%rdx),%edx
+  8005ce:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005d1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005d5:	89 0a                	mov    %ecx,(%rdx)
+  8005d7:	eb 14                	jmp    8005ed <getuint+0xc1>
+  8005d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005dd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005e1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8005e9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005ed:	48 8b 00             	mov    (%rax),%rax
+  8005f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8005f4:	eb 4b                	jmp    800641 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8005f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005fa:	8b 00                	mov    (%rax),%eax
+  8005fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ff:	77 24                	ja     800625 <getuint+0xf9>
+  800601:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800605:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800609:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80060d:	8b 00                	mov    (%rax),%eax
+  80060f:	89 c0                	mov    %eax,%eax
+  800611:	48 01 d0             	add    %rdx,%rax
+  800614:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800618:	8b 12                	mov    (%rdx),%edx
+  80061a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80061d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800621:	89 0a                	mov    %ecx,(%rdx)
+  800623:	eb 14                	jmp    800639 <getuint+0x10d>
+  800625:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800629:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80062d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800631:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800635:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800639:	8b 00                	mov    (%rax),%eax
+  80063b:	89 c0                	mov    %eax,%eax
+  80063d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800641:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800645:	c9                   	leave
+  800646:	c3                   	ret
+
+0000000000800647 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800647:	55                   	push   %rbp
+  800648:	48 89 e5             	mov    %rsp,%rbp
+  80064b:	48 83 ec 20          	sub    $0x20,%rsp
+  80064f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80064f <printfloat+0x8>
+  800656:	49 bb e1 79 00 00 00 	movabs $0x79e1,%r11
+  80065d:	00 00 00 
+  800660:	4c 01 d8             	add    %r11,%rax
+  800663:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800667:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80066b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80066f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800673:	48 85 c0             	test   %rax,%rax
+  800676:	79 12                	jns    80068a <printfloat+0x43>
+		putch('-',putdat);
+  800678:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80067c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800680:	48 89 c6             	mov    %rax,%rsi
+  800683:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800688:	ff d2                	call   *%rdx
+	
+}
+  80068a:	90                   	nop
+  80068b:	c9                   	leave
+  80068c:	c3                   	ret
+
+000000000080068d <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  80068d:	55                   	push   %rbp
+  80068e:	48 89 e5             	mov    %rsp,%rbp
+  800691:	48 83 ec 20          	sub    $0x20,%rsp
+  800695:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800695 <getint+0x8>
+  80069c:	49 bb 9b 79 00 00 00 	movabs $0x799b,%r11
+  8006a3:	00 00 00 
+  8006a6:	4c 01 d8             	add    %r11,%rax
+  8006a9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8006ad:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8006b0:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8006b4:	7e 4f                	jle    800705 <getint+0x78>
+		x=va_arg(*ap, long long);
+  8006b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ba:	8b 00                	mov    (%rax),%eax
+  8006bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8006bf:	77 24                	ja     8006e5 <getint+0x58>
+  8006c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006c5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006cd:	8b 00                	mov    (%rax),%eax
+  8006cf:	89 c0                	mov    %eax,%eax
+  8006d1:	48 01 d0             	add    %rdx,%rax
+  8006d4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006d8:	8b 12                	mov    (%rdx),%edx
+  8006da:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e1:	89 0a                	mov    %ecx,(%rdx)
+  8006e3:	eb 14                	jmp    8006f9 <getint+0x6c>
+  8006e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006e9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006ed:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006f1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006f5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006f9:	48 8b 00             	mov    (%rax),%rax
+  8006fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800700:	e9 9d 00 00 00       	jmp    8007a2 <getint+0x115>
+	else if (lflag)
+  800705:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800709:	74 4c                	je     800757 <getint+0xca>
+		x=va_arg(*ap, long);
+  80070b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80070f:	8b 00                	mov    (%rax),%eax
+  800711:	83 f8 2f             	cmp    $0x2f,%eax
+  800714:	77 24                	ja     80073a <getint+0xad>
+  800716:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80071a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80071e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800722:	8b 00                	mov    (%rax),%eax
+  800724:	89 c0                	mov    %eax,%eax
+  800726:	48 01 d0             	add    %rdx,%rax
+  800729:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80072d:	8b 12                	mov    (%rdx),%edx
+  80072f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800732:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800736:	89 0a                	mov    %ecx,(%rdx)
+  800738:	eb 14                	jmp    80074e <getint+0xc1>
+  80073a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80073e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800742:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800746:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80074a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80074e:	48 8b 00             	mov    (%rax),%rax
+  800751:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800755:	eb 4b                	jmp    8007a2 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800757:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80075b:	8b 00                	mov    (%rax),%eax
+  80075d:	83 f8 2f             	cmp    $0x2f,%eax
+  800760:	77 24                	ja     800786 <getint+0xf9>
+  800762:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800766:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80076a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80076e:	8b 00                	mov    (%rax),%eax
+  800770:	89 c0                	mov    %eax,%eax
+  800772:	48 01 d0             	add    %rdx,%rax
+  800775:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800779:	8b 12                	mov    (%rdx),%edx
+  80077b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80077e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800782:	89 0a                	mov    %ecx,(%rdx)
+  800784:	eb 14                	jmp    80079a <getint+0x10d>
+  800786:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80078a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80078e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800792:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800796:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80079a:	8b 00                	mov    (%rax),%eax
+  80079c:	48 98                	cltq
+  80079e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8007a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8007a6:	c9                   	leave
+  8007a7:	c3                   	ret
+
+00000000008007a8 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  8007a8:	55                   	push   %rbp
+  8007a9:	48 89 e5             	mov    %rsp,%rbp
+  8007ac:	41 57                	push   %r15
+  8007ae:	41 55                	push   %r13
+  8007b0:	41 54                	push   %r12
+  8007b2:	53                   	push   %rbx
+  8007b3:	48 83 ec 60          	sub    $0x60,%rsp
+  8007b7:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 8007b7 <vprintfmt+0xf>
+  8007be:	49 bb 79 78 00 00 00 	movabs $0x7879,%r11
+  8007c5:	00 00 00 
+  8007c8:	4d 01 dc             	add    %r11,%r12
+  8007cb:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  8007cf:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  8007d3:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8007d7:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  8007db:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  8007e2:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  8007e6:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  8007ea:	48 8b 06             	mov    (%rsi),%rax
+  8007ed:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007f1:	48 89 01             	mov    %rax,(%rcx)
+  8007f4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007f8:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007fc:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800800:	eb 17                	jmp    800819 <vprintfmt+0x71>
+			if (ch == '\0')
+  800802:	85 db                	test   %ebx,%ebx
+  800804:	0f 84 97 05 00 00    	je     800da1 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  80080a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80080e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800812:	48 89 c6             	mov    %rax,%rsi
+  800815:	89 df                	mov    %ebx,%edi
+  800817:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800819:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80081d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800821:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800825:	0f b6 00             	movzbl (%rax),%eax
+  800828:	0f b6 d8             	movzbl %al,%ebx
+  80082b:	83 fb 25             	cmp    $0x25,%ebx
+  80082e:	75 d2                	jne    800802 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800830:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800834:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  80083b:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800842:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800849:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800850:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800854:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800858:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80085c:	0f b6 00             	movzbl (%rax),%eax
+  80085f:	0f b6 d8             	movzbl %al,%ebx
+  800862:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800865:	83 f8 55             	cmp    $0x55,%eax
+  800868:	0f 87 00 05 00 00    	ja     800d6e <vprintfmt+0x5c6>
+  80086e:	89 c0                	mov    %eax,%eax
+  800870:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800877:	00 
+  800878:	48 8d 05 81 57 00 00 	lea    0x5781(%rip),%rax        # 806000 <.LC18+0xc>
+  80087f:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800883:	48 8d 15 76 57 00 00 	lea    0x5776(%rip),%rdx        # 806000 <.LC18+0xc>
+  80088a:	48 01 d0             	add    %rdx,%rax
+  80088d:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  80088f:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800893:	eb bb                	jmp    800850 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800895:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800899:	eb b5                	jmp    800850 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  80089b:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  8008a2:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8008a5:	89 d0                	mov    %edx,%eax
+  8008a7:	c1 e0 02             	shl    $0x2,%eax
+  8008aa:	01 d0                	add    %edx,%eax
+  8008ac:	01 c0                	add    %eax,%eax
+  8008ae:	01 d8                	add    %ebx,%eax
+  8008b0:	83 e8 30             	sub    $0x30,%eax
+  8008b3:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  8008b6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8008ba:	0f b6 00             	movzbl (%rax),%eax
+  8008bd:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  8008c0:	83 fb 2f             	cmp    $0x2f,%ebx
+  8008c3:	7e 60                	jle    800925 <vprintfmt+0x17d>
+  8008c5:	83 fb 39             	cmp    $0x39,%ebx
+  8008c8:	7f 5b                	jg     800925 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  8008ca:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  8008cf:	eb d1                	jmp    8008a2 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8008d1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8008d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d7:	77 17                	ja     8008f0 <vprintfmt+0x148>
+  8008d9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8008dd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8008e0:	89 d2                	mov    %edx,%edx
+  8008e2:	48 01 d0             	add    %rdx,%rax
+  8008e5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8008e8:	83 c2 08             	add    $0x8,%edx
+  8008eb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8008ee:	eb 0c                	jmp    8008fc <vprintfmt+0x154>
+  8008f0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008f4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008f8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8008fc:	8b 00                	mov    (%rax),%eax
+  8008fe:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800901:	eb 23                	jmp    800926 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800903:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800907:	0f 89 43 ff ff ff    	jns    800850 <vprintfmt+0xa8>
+				width = 0;
+  80090d:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800914:	e9 37 ff ff ff       	jmp    800850 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800919:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800920:	e9 2b ff ff ff       	jmp    800850 <vprintfmt+0xa8>
+			goto process_precision;
+  800925:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800926:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80092a:	0f 89 20 ff ff ff    	jns    800850 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800930:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800933:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800936:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  80093d:	e9 0e ff ff ff       	jmp    800850 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800942:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800946:	e9 05 ff ff ff       	jmp    800850 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  80094b:	83 fb 39             	cmp    $0x39,%ebx
+  80094e:	7f 0b                	jg     80095b <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800950:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800953:	c1 e0 08             	shl    $0x8,%eax
+  800956:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800959:	eb 21                	jmp    80097c <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  80095b:	83 fb 60             	cmp    $0x60,%ebx
+  80095e:	7e 10                	jle    800970 <vprintfmt+0x1c8>
+  800960:	83 fb 66             	cmp    $0x66,%ebx
+  800963:	7f 0b                	jg     800970 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800965:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800968:	c1 e0 08             	shl    $0x8,%eax
+  80096b:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80096e:	eb 0c                	jmp    80097c <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800970:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800977:	e9 04 01 00 00       	jmp    800a80 <vprintfmt+0x2d8>
+  80097c:	e9 ff 00 00 00       	jmp    800a80 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800981:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800984:	83 f8 2f             	cmp    $0x2f,%eax
+  800987:	77 17                	ja     8009a0 <vprintfmt+0x1f8>
+  800989:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80098d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800990:	89 d2                	mov    %edx,%edx
+  800992:	48 01 d0             	add    %rdx,%rax
+  800995:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800998:	83 c2 08             	add    $0x8,%edx
+  80099b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80099e:	eb 0c                	jmp    8009ac <vprintfmt+0x204>
+  8009a0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009a4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009a8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8009ac:	8b 00                	mov    (%rax),%eax
+  8009ae:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8009b2:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8009b6:	48 89 d6             	mov    %rdx,%rsi
+  8009b9:	89 c7                	mov    %eax,%edi
+  8009bb:	ff d1                	call   *%rcx
+			break;
+  8009bd:	e9 da 03 00 00       	jmp    800d9c <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  8009c2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8009c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c8:	77 17                	ja     8009e1 <vprintfmt+0x239>
+  8009ca:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8009ce:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8009d1:	89 d2                	mov    %edx,%edx
+  8009d3:	48 01 d0             	add    %rdx,%rax
+  8009d6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8009d9:	83 c2 08             	add    $0x8,%edx
+  8009dc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8009df:	eb 0c                	jmp    8009ed <vprintfmt+0x245>
+  8009e1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009e5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009e9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8009ed:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8009ef:	85 db                	test   %ebx,%ebx
+  8009f1:	79 02                	jns    8009f5 <vprintfmt+0x24d>
+				err = -err;
+  8009f3:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009f5:	83 fb 15             	cmp    $0x15,%ebx
+  8009f8:	7f 19                	jg     800a13 <vprintfmt+0x26b>
+  8009fa:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800a01:	00 00 00 
+  800a04:	48 63 c3             	movslq %ebx,%rax
+  800a07:	4c 01 e2             	add    %r12,%rdx
+  800a0a:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800a0e:	4d 85 ed             	test   %r13,%r13
+  800a11:	75 36                	jne    800a49 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800a13:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800a17:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a1b:	89 d9                	mov    %ebx,%ecx
+  800a1d:	48 ba b8 df ff ff ff 	movabs $0xffffffffffffdfb8,%rdx
+  800a24:	ff ff ff 
+  800a27:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800a2b:	48 89 c7             	mov    %rax,%rdi
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a33:	49 b8 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r8
+  800a3a:	ff ff ff 
+  800a3d:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800a41:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800a44:	e9 53 03 00 00       	jmp    800d9c <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800a49:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800a4d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a51:	4c 89 e9             	mov    %r13,%rcx
+  800a54:	48 ba c1 df ff ff ff 	movabs $0xffffffffffffdfc1,%rdx
+  800a5b:	ff ff ff 
+  800a5e:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800a62:	48 89 c7             	mov    %rax,%rdi
+  800a65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6a:	49 b8 7f 8d ff ff ff 	movabs $0xffffffffffff8d7f,%r8
+  800a71:	ff ff ff 
+  800a74:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800a78:	41 ff d0             	call   *%r8
+			break;
+  800a7b:	e9 1c 03 00 00       	jmp    800d9c <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800a80:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a83:	83 f8 2f             	cmp    $0x2f,%eax
+  800a86:	77 17                	ja     800a9f <vprintfmt+0x2f7>
+  800a88:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a8c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a8f:	89 d2                	mov    %edx,%edx
+  800a91:	48 01 d0             	add    %rdx,%rax
+  800a94:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a97:	83 c2 08             	add    $0x8,%edx
+  800a9a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800a9d:	eb 0c                	jmp    800aab <vprintfmt+0x303>
+  800a9f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800aa3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800aa7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800aab:	4c 8b 28             	mov    (%rax),%r13
+  800aae:	4d 85 ed             	test   %r13,%r13
+  800ab1:	75 0e                	jne    800ac1 <vprintfmt+0x319>
+				p = "(null)";
+  800ab3:	48 b8 c4 df ff ff ff 	movabs $0xffffffffffffdfc4,%rax
+  800aba:	ff ff ff 
+  800abd:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800ac1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ac5:	0f 8e 84 00 00 00    	jle    800b4f <vprintfmt+0x3a7>
+  800acb:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800acf:	74 7e                	je     800b4f <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ad1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ad4:	48 98                	cltq
+  800ad6:	48 89 c6             	mov    %rax,%rsi
+  800ad9:	4c 89 ef             	mov    %r13,%rdi
+  800adc:	4d 89 e7             	mov    %r12,%r15
+  800adf:	48 b8 a4 90 ff ff ff 	movabs $0xffffffffffff90a4,%rax
+  800ae6:	ff ff ff 
+  800ae9:	4c 01 e0             	add    %r12,%rax
+  800aec:	ff d0                	call   *%rax
+  800aee:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800af1:	eb 17                	jmp    800b0a <vprintfmt+0x362>
+					putch(padc, putdat);
+  800af3:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800af7:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800afb:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800aff:	48 89 d6             	mov    %rdx,%rsi
+  800b02:	89 c7                	mov    %eax,%edi
+  800b04:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b06:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800b0a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b0e:	7f e3                	jg     800af3 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b10:	eb 3d                	jmp    800b4f <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b12:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800b16:	74 1e                	je     800b36 <vprintfmt+0x38e>
+  800b18:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b1b:	7e 05                	jle    800b22 <vprintfmt+0x37a>
+  800b1d:	83 fb 7e             	cmp    $0x7e,%ebx
+  800b20:	7e 14                	jle    800b36 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800b22:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800b26:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800b2a:	48 89 c6             	mov    %rax,%rsi
+  800b2d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b32:	ff d2                	call   *%rdx
+  800b34:	eb 15                	jmp    800b4b <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800b36:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800b39:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800b3c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800b40:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800b44:	48 89 c6             	mov    %rax,%rsi
+  800b47:	89 cf                	mov    %ecx,%edi
+  800b49:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b4b:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800b4f:	4c 89 e8             	mov    %r13,%rax
+  800b52:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800b56:	0f b6 00             	movzbl (%rax),%eax
+  800b59:	0f be d8             	movsbl %al,%ebx
+  800b5c:	85 db                	test   %ebx,%ebx
+  800b5e:	74 28                	je     800b88 <vprintfmt+0x3e0>
+  800b60:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800b64:	78 ac                	js     800b12 <vprintfmt+0x36a>
+  800b66:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800b6a:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800b6e:	79 a2                	jns    800b12 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800b70:	eb 16                	jmp    800b88 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800b72:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800b76:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800b7a:	48 89 c6             	mov    %rax,%rsi
+  800b7d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b82:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800b84:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800b88:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b8c:	7f e4                	jg     800b72 <vprintfmt+0x3ca>
+			break;
+  800b8e:	e9 09 02 00 00       	jmp    800d9c <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800b93:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b97:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b9b:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b9f:	0f b6 00             	movzbl (%rax),%eax
+  800ba2:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800ba5:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800ba6:	83 fb 2f             	cmp    $0x2f,%ebx
+  800ba9:	0f 8e ac fd ff ff    	jle    80095b <vprintfmt+0x1b3>
+  800baf:	e9 97 fd ff ff       	jmp    80094b <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800bb4:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800bb8:	be 03 00 00 00       	mov    $0x3,%esi
+  800bbd:	48 89 c7             	mov    %rax,%rdi
+  800bc0:	48 b8 5d 86 ff ff ff 	movabs $0xffffffffffff865d,%rax
+  800bc7:	ff ff ff 
+  800bca:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800bce:	ff d0                	call   *%rax
+  800bd0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800bd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bd8:	48 85 c0             	test   %rax,%rax
+  800bdb:	79 1d                	jns    800bfa <vprintfmt+0x452>
+				putch('-', putdat);
+  800bdd:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800be1:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800be5:	48 89 c6             	mov    %rax,%rsi
+  800be8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800bed:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800bef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bf3:	48 f7 d8             	neg    %rax
+  800bf6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800bfa:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800c01:	e9 de 00 00 00       	jmp    800ce4 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800c06:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800c0a:	be 03 00 00 00       	mov    $0x3,%esi
+  800c0f:	48 89 c7             	mov    %rax,%rdi
+  800c12:	48 b8 fc 84 ff ff ff 	movabs $0xffffffffffff84fc,%rax
+  800c19:	ff ff ff 
+  800c1c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800c20:	ff d0                	call   *%rax
+  800c22:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800c26:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800c2d:	e9 b2 00 00 00       	jmp    800ce4 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800c32:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800c36:	be 03 00 00 00       	mov    $0x3,%esi
+  800c3b:	48 89 c7             	mov    %rax,%rdi
+  800c3e:	48 b8 fc 84 ff ff ff 	movabs $0xffffffffffff84fc,%rax
+  800c45:	ff ff ff 
+  800c48:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800c4c:	ff d0                	call   *%rax
+  800c4e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800c52:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800c59:	e9 86 00 00 00       	jmp    800ce4 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800c5e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c62:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c66:	48 89 c6             	mov    %rax,%rsi
+  800c69:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c6e:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800c70:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c74:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c78:	48 89 c6             	mov    %rax,%rsi
+  800c7b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c80:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800c82:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c85:	83 f8 2f             	cmp    $0x2f,%eax
+  800c88:	77 17                	ja     800ca1 <vprintfmt+0x4f9>
+  800c8a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c8e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c91:	89 d2                	mov    %edx,%edx
+  800c93:	48 01 d0             	add    %rdx,%rax
+  800c96:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c99:	83 c2 08             	add    $0x8,%edx
+  800c9c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c9f:	eb 0c                	jmp    800cad <vprintfmt+0x505>
+  800ca1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ca5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ca9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800cad:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800cb0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800cb4:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800cbb:	eb 27                	jmp    800ce4 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800cbd:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800cc1:	be 03 00 00 00       	mov    $0x3,%esi
+  800cc6:	48 89 c7             	mov    %rax,%rdi
+  800cc9:	48 b8 fc 84 ff ff ff 	movabs $0xffffffffffff84fc,%rax
+  800cd0:	ff ff ff 
+  800cd3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800cd7:	ff d0                	call   *%rax
+  800cd9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800cdd:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800ce4:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800ce9:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800cec:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800cef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800cf3:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800cf7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cfb:	45 89 c1             	mov    %r8d,%r9d
+  800cfe:	41 89 f8             	mov    %edi,%r8d
+  800d01:	48 89 c7             	mov    %rax,%rdi
+  800d04:	48 b8 24 84 ff ff ff 	movabs $0xffffffffffff8424,%rax
+  800d0b:	ff ff ff 
+  800d0e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d12:	ff d0                	call   *%rax
+			break;
+  800d14:	e9 83 00 00 00       	jmp    800d9c <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800d19:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d1d:	be 03 00 00 00       	mov    $0x3,%esi
+  800d22:	48 89 c7             	mov    %rax,%rdi
+  800d25:	48 b8 fc 84 ff ff ff 	movabs $0xffffffffffff84fc,%rax
+  800d2c:	ff ff ff 
+  800d2f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d33:	ff d0                	call   *%rax
+  800d35:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800d39:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800d3d:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800d41:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d45:	48 89 ce             	mov    %rcx,%rsi
+  800d48:	48 89 c7             	mov    %rax,%rdi
+  800d4b:	48 b8 17 86 ff ff ff 	movabs $0xffffffffffff8617,%rax
+  800d52:	ff ff ff 
+  800d55:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d59:	ff d0                	call   *%rax
+	
+			break;
+  800d5b:	eb 3f                	jmp    800d9c <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800d5d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d61:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d65:	48 89 c6             	mov    %rax,%rsi
+  800d68:	89 df                	mov    %ebx,%edi
+  800d6a:	ff d2                	call   *%rdx
+			break;
+  800d6c:	eb 2e                	jmp    800d9c <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800d6e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d72:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d76:	48 89 c6             	mov    %rax,%rsi
+  800d79:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d7e:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800d80:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800d85:	eb 05                	jmp    800d8c <vprintfmt+0x5e4>
+  800d87:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800d8c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d90:	48 83 e8 01          	sub    $0x1,%rax
+  800d94:	0f b6 00             	movzbl (%rax),%eax
+  800d97:	3c 25                	cmp    $0x25,%al
+  800d99:	75 ec                	jne    800d87 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800d9b:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d9c:	e9 78 fa ff ff       	jmp    800819 <vprintfmt+0x71>
+				return;
+  800da1:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800da2:	48 83 c4 60          	add    $0x60,%rsp
+  800da6:	5b                   	pop    %rbx
+  800da7:	41 5c                	pop    %r12
+  800da9:	41 5d                	pop    %r13
+  800dab:	41 5f                	pop    %r15
+  800dad:	5d                   	pop    %rbp
+  800dae:	c3                   	ret
+
+0000000000800daf <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  800daf:	55                   	push   %rbp
+  800db0:	48 89 e5             	mov    %rsp,%rbp
+  800db3:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800dba:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800dba <printfmt+0xb>
+  800dc1:	49 bb 76 72 00 00 00 	movabs $0x7276,%r11
+  800dc8:	00 00 00 
+  800dcb:	4d 01 da             	add    %r11,%r10
+  800dce:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800dd5:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800ddc:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800de3:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800dea:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800df1:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800df8:	84 c0                	test   %al,%al
+  800dfa:	74 20                	je     800e1c <printfmt+0x6d>
+  800dfc:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e00:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e04:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e08:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e0c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e10:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e14:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e18:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800e1c:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800e23:	00 00 00 
+  800e26:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800e2d:	00 00 00 
+  800e30:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e34:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800e3b:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e42:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800e49:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800e50:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800e57:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800e5e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800e65:	48 89 c7             	mov    %rax,%rdi
+  800e68:	48 b8 78 87 ff ff ff 	movabs $0xffffffffffff8778,%rax
+  800e6f:	ff ff ff 
+  800e72:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800e76:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800e78:	90                   	nop
+  800e79:	c9                   	leave
+  800e7a:	c3                   	ret
+
+0000000000800e7b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800e7b:	55                   	push   %rbp
+  800e7c:	48 89 e5             	mov    %rsp,%rbp
+  800e7f:	48 83 ec 10          	sub    $0x10,%rsp
+  800e83:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800e83 <sprintputch+0x8>
+  800e8a:	49 bb ad 71 00 00 00 	movabs $0x71ad,%r11
+  800e91:	00 00 00 
+  800e94:	4c 01 d8             	add    %r11,%rax
+  800e97:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800e9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800e9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ea2:	8b 40 10             	mov    0x10(%rax),%eax
+  800ea5:	8d 50 01             	lea    0x1(%rax),%edx
+  800ea8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800eac:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800eaf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800eb3:	48 8b 10             	mov    (%rax),%rdx
+  800eb6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800eba:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ebe:	48 39 c2             	cmp    %rax,%rdx
+  800ec1:	73 17                	jae    800eda <sprintputch+0x5f>
+		*b->buf++ = ch;
+  800ec3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ec7:	48 8b 00             	mov    (%rax),%rax
+  800eca:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800ece:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800ed2:	48 89 0a             	mov    %rcx,(%rdx)
+  800ed5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800ed8:	88 10                	mov    %dl,(%rax)
+}
+  800eda:	90                   	nop
+  800edb:	c9                   	leave
+  800edc:	c3                   	ret
+
+0000000000800edd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800edd:	55                   	push   %rbp
+  800ede:	48 89 e5             	mov    %rsp,%rbp
+  800ee1:	53                   	push   %rbx
+  800ee2:	48 83 ec 58          	sub    $0x58,%rsp
+  800ee6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ee6 <vsnprintf+0x9>
+  800eed:	49 bb 4a 71 00 00 00 	movabs $0x714a,%r11
+  800ef4:	00 00 00 
+  800ef7:	4c 01 d8             	add    %r11,%rax
+  800efa:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  800efe:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  800f01:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f05:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  800f09:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  800f0d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800f11:	48 8b 0e             	mov    (%rsi),%rcx
+  800f14:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  800f18:	48 89 0a             	mov    %rcx,(%rdx)
+  800f1b:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  800f1f:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  800f23:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800f27:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800f2b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800f2f:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  800f32:	48 63 d2             	movslq %edx,%rdx
+  800f35:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  800f39:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  800f3d:	48 01 ca             	add    %rcx,%rdx
+  800f40:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f44:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  800f4b:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  800f50:	74 06                	je     800f58 <vsnprintf+0x7b>
+  800f52:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  800f56:	7f 07                	jg     800f5f <vsnprintf+0x82>
+		return -E_INVAL;
+  800f58:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f5d:	eb 34                	jmp    800f93 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  800f5f:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  800f63:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f67:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800f6b:	48 bf 4b 8e ff ff ff 	movabs $0xffffffffffff8e4b,%rdi
+  800f72:	ff ff ff 
+  800f75:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  800f79:	49 b8 78 87 ff ff ff 	movabs $0xffffffffffff8778,%r8
+  800f80:	ff ff ff 
+  800f83:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  800f87:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  800f89:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800f8d:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  800f90:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  800f93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f97:	c9                   	leave
+  800f98:	c3                   	ret
+
+0000000000800f99 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800f99:	55                   	push   %rbp
+  800f9a:	48 89 e5             	mov    %rsp,%rbp
+  800f9d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800fa4:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800fa4 <snprintf+0xb>
+  800fab:	49 bb 8c 70 00 00 00 	movabs $0x708c,%r11
+  800fb2:	00 00 00 
+  800fb5:	4d 01 da             	add    %r11,%r10
+  800fb8:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800fbf:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800fc5:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800fcc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800fd3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800fda:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800fe1:	84 c0                	test   %al,%al
+  800fe3:	74 20                	je     801005 <snprintf+0x6c>
+  800fe5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800fe9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800fed:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800ff1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ff5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ff9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ffd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801001:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801005:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80100c:	00 00 00 
+  80100f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801016:	00 00 00 
+  801019:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80101d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801024:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80102b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801032:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801039:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801040:	48 8b 06             	mov    (%rsi),%rax
+  801043:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801047:	48 89 01             	mov    %rax,(%rcx)
+  80104a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80104e:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801052:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801056:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80105d:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801064:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80106a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801071:	48 89 c7             	mov    %rax,%rdi
+  801074:	48 b8 ad 8e ff ff ff 	movabs $0xffffffffffff8ead,%rax
+  80107b:	ff ff ff 
+  80107e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801082:	ff d0                	call   *%rax
+  801084:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  80108a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801090:	c9                   	leave
+  801091:	c3                   	ret
+
+0000000000801092 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801092:	55                   	push   %rbp
+  801093:	48 89 e5             	mov    %rsp,%rbp
+  801096:	48 83 ec 18          	sub    $0x18,%rsp
+  80109a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80109a <strlen+0x8>
+  8010a1:	49 bb 96 6f 00 00 00 	movabs $0x6f96,%r11
+  8010a8:	00 00 00 
+  8010ab:	4c 01 d8             	add    %r11,%rax
+  8010ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8010b2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8010b9:	eb 09                	jmp    8010c4 <strlen+0x32>
+		n++;
+  8010bb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8010bf:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8010c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010c8:	0f b6 00             	movzbl (%rax),%eax
+  8010cb:	84 c0                	test   %al,%al
+  8010cd:	75 ec                	jne    8010bb <strlen+0x29>
+	return n;
+  8010cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8010d2:	c9                   	leave
+  8010d3:	c3                   	ret
+
+00000000008010d4 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8010d4:	55                   	push   %rbp
+  8010d5:	48 89 e5             	mov    %rsp,%rbp
+  8010d8:	48 83 ec 20          	sub    $0x20,%rsp
+  8010dc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8010dc <strnlen+0x8>
+  8010e3:	49 bb 54 6f 00 00 00 	movabs $0x6f54,%r11
+  8010ea:	00 00 00 
+  8010ed:	4c 01 d8             	add    %r11,%rax
+  8010f0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8010f4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010f8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8010ff:	eb 0e                	jmp    80110f <strnlen+0x3b>
+		n++;
+  801101:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801105:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80110a:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80110f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801114:	74 0b                	je     801121 <strnlen+0x4d>
+  801116:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80111a:	0f b6 00             	movzbl (%rax),%eax
+  80111d:	84 c0                	test   %al,%al
+  80111f:	75 e0                	jne    801101 <strnlen+0x2d>
+	return n;
+  801121:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801124:	c9                   	leave
+  801125:	c3                   	ret
+
+0000000000801126 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801126:	55                   	push   %rbp
+  801127:	48 89 e5             	mov    %rsp,%rbp
+  80112a:	48 83 ec 20          	sub    $0x20,%rsp
+  80112e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80112e <strcpy+0x8>
+  801135:	49 bb 02 6f 00 00 00 	movabs $0x6f02,%r11
+  80113c:	00 00 00 
+  80113f:	4c 01 d8             	add    %r11,%rax
+  801142:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801146:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80114a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80114e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801152:	90                   	nop
+  801153:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801157:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80115b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80115f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801163:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801167:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80116b:	0f b6 12             	movzbl (%rdx),%edx
+  80116e:	88 10                	mov    %dl,(%rax)
+  801170:	0f b6 00             	movzbl (%rax),%eax
+  801173:	84 c0                	test   %al,%al
+  801175:	75 dc                	jne    801153 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801177:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80117b:	c9                   	leave
+  80117c:	c3                   	ret
+
+000000000080117d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80117d:	55                   	push   %rbp
+  80117e:	48 89 e5             	mov    %rsp,%rbp
+  801181:	53                   	push   %rbx
+  801182:	48 83 ec 20          	sub    $0x20,%rsp
+  801186:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801186 <strcat+0x9>
+  80118d:	49 bb aa 6e 00 00 00 	movabs $0x6eaa,%r11
+  801194:	00 00 00 
+  801197:	4c 01 db             	add    %r11,%rbx
+  80119a:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80119e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8011a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011a6:	48 89 c7             	mov    %rax,%rdi
+  8011a9:	48 b8 62 90 ff ff ff 	movabs $0xffffffffffff9062,%rax
+  8011b0:	ff ff ff 
+  8011b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8011b7:	ff d0                	call   *%rax
+  8011b9:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8011bc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8011bf:	48 63 d0             	movslq %eax,%rdx
+  8011c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011c6:	48 01 c2             	add    %rax,%rdx
+  8011c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011cd:	48 89 c6             	mov    %rax,%rsi
+  8011d0:	48 89 d7             	mov    %rdx,%rdi
+  8011d3:	48 b8 f6 90 ff ff ff 	movabs $0xffffffffffff90f6,%rax
+  8011da:	ff ff ff 
+  8011dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8011e1:	ff d0                	call   *%rax
+	return dst;
+  8011e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8011e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011eb:	c9                   	leave
+  8011ec:	c3                   	ret
+
+00000000008011ed <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8011ed:	55                   	push   %rbp
+  8011ee:	48 89 e5             	mov    %rsp,%rbp
+  8011f1:	48 83 ec 28          	sub    $0x28,%rsp
+  8011f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011f5 <strncpy+0x8>
+  8011fc:	49 bb 3b 6e 00 00 00 	movabs $0x6e3b,%r11
+  801203:	00 00 00 
+  801206:	4c 01 d8             	add    %r11,%rax
+  801209:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80120d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801211:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801215:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801219:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80121d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801224:	00 
+  801225:	eb 2a                	jmp    801251 <strncpy+0x64>
+		*dst++ = *src;
+  801227:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80122b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80122f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801233:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801237:	0f b6 12             	movzbl (%rdx),%edx
+  80123a:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80123c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801240:	0f b6 00             	movzbl (%rax),%eax
+  801243:	84 c0                	test   %al,%al
+  801245:	74 05                	je     80124c <strncpy+0x5f>
+			src++;
+  801247:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80124c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801251:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801255:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801259:	72 cc                	jb     801227 <strncpy+0x3a>
+	}
+	return ret;
+  80125b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80125f:	c9                   	leave
+  801260:	c3                   	ret
+
+0000000000801261 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801261:	55                   	push   %rbp
+  801262:	48 89 e5             	mov    %rsp,%rbp
+  801265:	48 83 ec 28          	sub    $0x28,%rsp
+  801269:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801269 <strlcpy+0x8>
+  801270:	49 bb c7 6d 00 00 00 	movabs $0x6dc7,%r11
+  801277:	00 00 00 
+  80127a:	4c 01 d8             	add    %r11,%rax
+  80127d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801281:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801285:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801289:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80128d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801291:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801296:	74 3d                	je     8012d5 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801298:	eb 1d                	jmp    8012b7 <strlcpy+0x56>
+			*dst++ = *src++;
+  80129a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80129e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012a2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012aa:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012ae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012b2:	0f b6 12             	movzbl (%rdx),%edx
+  8012b5:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8012b7:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8012bc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012c1:	74 0b                	je     8012ce <strlcpy+0x6d>
+  8012c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012c7:	0f b6 00             	movzbl (%rax),%eax
+  8012ca:	84 c0                	test   %al,%al
+  8012cc:	75 cc                	jne    80129a <strlcpy+0x39>
+		*dst = '\0';
+  8012ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d2:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8012d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d9:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8012dd:	c9                   	leave
+  8012de:	c3                   	ret
+
+00000000008012df <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8012df:	55                   	push   %rbp
+  8012e0:	48 89 e5             	mov    %rsp,%rbp
+  8012e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8012e7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012e7 <strcmp+0x8>
+  8012ee:	49 bb 49 6d 00 00 00 	movabs $0x6d49,%r11
+  8012f5:	00 00 00 
+  8012f8:	4c 01 d8             	add    %r11,%rax
+  8012fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8012ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801303:	eb 0a                	jmp    80130f <strcmp+0x30>
+		p++, q++;
+  801305:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80130a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80130f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801313:	0f b6 00             	movzbl (%rax),%eax
+  801316:	84 c0                	test   %al,%al
+  801318:	74 12                	je     80132c <strcmp+0x4d>
+  80131a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80131e:	0f b6 10             	movzbl (%rax),%edx
+  801321:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801325:	0f b6 00             	movzbl (%rax),%eax
+  801328:	38 c2                	cmp    %al,%dl
+  80132a:	74 d9                	je     801305 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80132c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801330:	0f b6 00             	movzbl (%rax),%eax
+  801333:	0f b6 d0             	movzbl %al,%edx
+  801336:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80133a:	0f b6 00             	movzbl (%rax),%eax
+  80133d:	0f b6 c0             	movzbl %al,%eax
+  801340:	29 c2                	sub    %eax,%edx
+  801342:	89 d0                	mov    %edx,%eax
+}
+  801344:	c9                   	leave
+  801345:	c3                   	ret
+
+0000000000801346 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801346:	55                   	push   %rbp
+  801347:	48 89 e5             	mov    %rsp,%rbp
+  80134a:	48 83 ec 18          	sub    $0x18,%rsp
+  80134e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80134e <strncmp+0x8>
+  801355:	49 bb e2 6c 00 00 00 	movabs $0x6ce2,%r11
+  80135c:	00 00 00 
+  80135f:	4c 01 d8             	add    %r11,%rax
+  801362:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801366:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80136a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80136e:	eb 0f                	jmp    80137f <strncmp+0x39>
+		n--, p++, q++;
+  801370:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801375:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80137a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80137f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801384:	74 1d                	je     8013a3 <strncmp+0x5d>
+  801386:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80138a:	0f b6 00             	movzbl (%rax),%eax
+  80138d:	84 c0                	test   %al,%al
+  80138f:	74 12                	je     8013a3 <strncmp+0x5d>
+  801391:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801395:	0f b6 10             	movzbl (%rax),%edx
+  801398:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80139c:	0f b6 00             	movzbl (%rax),%eax
+  80139f:	38 c2                	cmp    %al,%dl
+  8013a1:	74 cd                	je     801370 <strncmp+0x2a>
+	if (n == 0)
+  8013a3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8013a8:	75 07                	jne    8013b1 <strncmp+0x6b>
+		return 0;
+  8013aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013af:	eb 16                	jmp    8013c7 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8013b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013b5:	0f b6 00             	movzbl (%rax),%eax
+  8013b8:	0f b6 d0             	movzbl %al,%edx
+  8013bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013bf:	0f b6 00             	movzbl (%rax),%eax
+  8013c2:	0f b6 c0             	movzbl %al,%eax
+  8013c5:	29 c2                	sub    %eax,%edx
+}
+  8013c7:	89 d0                	mov    %edx,%eax
+  8013c9:	c9                   	leave
+  8013ca:	c3                   	ret
+
+00000000008013cb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8013cb:	55                   	push   %rbp
+  8013cc:	48 89 e5             	mov    %rsp,%rbp
+  8013cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8013d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013d3 <strchr+0x8>
+  8013da:	49 bb 5d 6c 00 00 00 	movabs $0x6c5d,%r11
+  8013e1:	00 00 00 
+  8013e4:	4c 01 d8             	add    %r11,%rax
+  8013e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8013eb:	89 f0                	mov    %esi,%eax
+  8013ed:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8013f0:	eb 17                	jmp    801409 <strchr+0x3e>
+		if (*s == c)
+  8013f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013f6:	0f b6 00             	movzbl (%rax),%eax
+  8013f9:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8013fc:	75 06                	jne    801404 <strchr+0x39>
+			return (char *) s;
+  8013fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801402:	eb 15                	jmp    801419 <strchr+0x4e>
+	for (; *s; s++)
+  801404:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801409:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80140d:	0f b6 00             	movzbl (%rax),%eax
+  801410:	84 c0                	test   %al,%al
+  801412:	75 de                	jne    8013f2 <strchr+0x27>
+	return 0;
+  801414:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801419:	c9                   	leave
+  80141a:	c3                   	ret
+
+000000000080141b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80141b:	55                   	push   %rbp
+  80141c:	48 89 e5             	mov    %rsp,%rbp
+  80141f:	48 83 ec 10          	sub    $0x10,%rsp
+  801423:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801423 <strfind+0x8>
+  80142a:	49 bb 0d 6c 00 00 00 	movabs $0x6c0d,%r11
+  801431:	00 00 00 
+  801434:	4c 01 d8             	add    %r11,%rax
+  801437:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80143b:	89 f0                	mov    %esi,%eax
+  80143d:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801440:	eb 11                	jmp    801453 <strfind+0x38>
+		if (*s == c)
+  801442:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801446:	0f b6 00             	movzbl (%rax),%eax
+  801449:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80144c:	74 12                	je     801460 <strfind+0x45>
+	for (; *s; s++)
+  80144e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801453:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801457:	0f b6 00             	movzbl (%rax),%eax
+  80145a:	84 c0                	test   %al,%al
+  80145c:	75 e4                	jne    801442 <strfind+0x27>
+  80145e:	eb 01                	jmp    801461 <strfind+0x46>
+			break;
+  801460:	90                   	nop
+	return (char *) s;
+  801461:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801465:	c9                   	leave
+  801466:	c3                   	ret
+
+0000000000801467 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801467:	55                   	push   %rbp
+  801468:	48 89 e5             	mov    %rsp,%rbp
+  80146b:	48 83 ec 18          	sub    $0x18,%rsp
+  80146f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80146f <memset+0x8>
+  801476:	49 bb c1 6b 00 00 00 	movabs $0x6bc1,%r11
+  80147d:	00 00 00 
+  801480:	4c 01 d8             	add    %r11,%rax
+  801483:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801487:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80148a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80148e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801493:	75 06                	jne    80149b <memset+0x34>
+		return v;
+  801495:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801499:	eb 69                	jmp    801504 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  80149b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80149f:	83 e0 03             	and    $0x3,%eax
+  8014a2:	48 85 c0             	test   %rax,%rax
+  8014a5:	75 48                	jne    8014ef <memset+0x88>
+  8014a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014ab:	83 e0 03             	and    $0x3,%eax
+  8014ae:	48 85 c0             	test   %rax,%rax
+  8014b1:	75 3c                	jne    8014ef <memset+0x88>
+		c &= 0xFF;
+  8014b3:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8014ba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8014bd:	c1 e0 18             	shl    $0x18,%eax
+  8014c0:	89 c2                	mov    %eax,%edx
+  8014c2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8014c5:	c1 e0 10             	shl    $0x10,%eax
+  8014c8:	09 c2                	or     %eax,%edx
+  8014ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8014cd:	c1 e0 08             	shl    $0x8,%eax
+  8014d0:	09 d0                	or     %edx,%eax
+  8014d2:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8014d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d9:	48 c1 e8 02          	shr    $0x2,%rax
+  8014dd:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8014e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8014e7:	48 89 d7             	mov    %rdx,%rdi
+  8014ea:	fc                   	cld
+  8014eb:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8014ed:	eb 11                	jmp    801500 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8014ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8014f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8014f6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014fa:	48 89 d7             	mov    %rdx,%rdi
+  8014fd:	fc                   	cld
+  8014fe:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801500:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801504:	c9                   	leave
+  801505:	c3                   	ret
+
+0000000000801506 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801506:	55                   	push   %rbp
+  801507:	48 89 e5             	mov    %rsp,%rbp
+  80150a:	48 83 ec 28          	sub    $0x28,%rsp
+  80150e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80150e <memmove+0x8>
+  801515:	49 bb 22 6b 00 00 00 	movabs $0x6b22,%r11
+  80151c:	00 00 00 
+  80151f:	4c 01 d8             	add    %r11,%rax
+  801522:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801526:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80152a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80152e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801532:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801536:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80153a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80153e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801542:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801546:	0f 83 88 00 00 00    	jae    8015d4 <memmove+0xce>
+  80154c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801550:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801554:	48 01 d0             	add    %rdx,%rax
+  801557:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80155b:	73 77                	jae    8015d4 <memmove+0xce>
+		s += n;
+  80155d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801561:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801565:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801569:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80156d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801571:	83 e0 03             	and    $0x3,%eax
+  801574:	48 85 c0             	test   %rax,%rax
+  801577:	75 3b                	jne    8015b4 <memmove+0xae>
+  801579:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80157d:	83 e0 03             	and    $0x3,%eax
+  801580:	48 85 c0             	test   %rax,%rax
+  801583:	75 2f                	jne    8015b4 <memmove+0xae>
+  801585:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801589:	83 e0 03             	and    $0x3,%eax
+  80158c:	48 85 c0             	test   %rax,%rax
+  80158f:	75 23                	jne    8015b4 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801591:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801595:	48 83 e8 04          	sub    $0x4,%rax
+  801599:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80159d:	48 83 ea 04          	sub    $0x4,%rdx
+  8015a1:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8015a5:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8015a9:	48 89 c7             	mov    %rax,%rdi
+  8015ac:	48 89 d6             	mov    %rdx,%rsi
+  8015af:	fd                   	std
+  8015b0:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8015b2:	eb 1d                	jmp    8015d1 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8015b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8015bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c0:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8015c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015c8:	48 89 d7             	mov    %rdx,%rdi
+  8015cb:	48 89 c1             	mov    %rax,%rcx
+  8015ce:	fd                   	std
+  8015cf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8015d1:	fc                   	cld
+  8015d2:	eb 57                	jmp    80162b <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8015d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015d8:	83 e0 03             	and    $0x3,%eax
+  8015db:	48 85 c0             	test   %rax,%rax
+  8015de:	75 36                	jne    801616 <memmove+0x110>
+  8015e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015e4:	83 e0 03             	and    $0x3,%eax
+  8015e7:	48 85 c0             	test   %rax,%rax
+  8015ea:	75 2a                	jne    801616 <memmove+0x110>
+  8015ec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015f0:	83 e0 03             	and    $0x3,%eax
+  8015f3:	48 85 c0             	test   %rax,%rax
+  8015f6:	75 1e                	jne    801616 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8015f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015fc:	48 c1 e8 02          	shr    $0x2,%rax
+  801600:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801603:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801607:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80160b:	48 89 c7             	mov    %rax,%rdi
+  80160e:	48 89 d6             	mov    %rdx,%rsi
+  801611:	fc                   	cld
+  801612:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801614:	eb 15                	jmp    80162b <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801616:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80161a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80161e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801622:	48 89 c7             	mov    %rax,%rdi
+  801625:	48 89 d6             	mov    %rdx,%rsi
+  801628:	fc                   	cld
+  801629:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  80162b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80162f:	c9                   	leave
+  801630:	c3                   	ret
+
+0000000000801631 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801631:	55                   	push   %rbp
+  801632:	48 89 e5             	mov    %rsp,%rbp
+  801635:	48 83 ec 18          	sub    $0x18,%rsp
+  801639:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801639 <memcpy+0x8>
+  801640:	49 bb f7 69 00 00 00 	movabs $0x69f7,%r11
+  801647:	00 00 00 
+  80164a:	4c 01 d8             	add    %r11,%rax
+  80164d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801651:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801655:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801659:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80165d:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801661:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801665:	48 89 cf             	mov    %rcx,%rdi
+  801668:	48 b9 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rcx
+  80166f:	ff ff ff 
+  801672:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801676:	ff d0                	call   *%rax
+}
+  801678:	c9                   	leave
+  801679:	c3                   	ret
+
+000000000080167a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80167a:	55                   	push   %rbp
+  80167b:	48 89 e5             	mov    %rsp,%rbp
+  80167e:	48 83 ec 28          	sub    $0x28,%rsp
+  801682:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801682 <memcmp+0x8>
+  801689:	49 bb ae 69 00 00 00 	movabs $0x69ae,%r11
+  801690:	00 00 00 
+  801693:	4c 01 d8             	add    %r11,%rax
+  801696:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80169a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80169e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  8016a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  8016aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016ae:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  8016b2:	eb 34                	jmp    8016e8 <memcmp+0x6e>
+		if (*s1 != *s2)
+  8016b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016b8:	0f b6 10             	movzbl (%rax),%edx
+  8016bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016bf:	0f b6 00             	movzbl (%rax),%eax
+  8016c2:	38 c2                	cmp    %al,%dl
+  8016c4:	74 18                	je     8016de <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  8016c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ca:	0f b6 00             	movzbl (%rax),%eax
+  8016cd:	0f b6 d0             	movzbl %al,%edx
+  8016d0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016d4:	0f b6 00             	movzbl (%rax),%eax
+  8016d7:	0f b6 c0             	movzbl %al,%eax
+  8016da:	29 c2                	sub    %eax,%edx
+  8016dc:	eb 20                	jmp    8016fe <memcmp+0x84>
+		s1++, s2++;
+  8016de:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016e3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8016e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016ec:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016f0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8016f4:	48 85 c0             	test   %rax,%rax
+  8016f7:	75 bb                	jne    8016b4 <memcmp+0x3a>
+	}
+
+	return 0;
+  8016f9:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8016fe:	89 d0                	mov    %edx,%eax
+  801700:	c9                   	leave
+  801701:	c3                   	ret
+
+0000000000801702 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801702:	55                   	push   %rbp
+  801703:	48 89 e5             	mov    %rsp,%rbp
+  801706:	48 83 ec 28          	sub    $0x28,%rsp
+  80170a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80170a <memfind+0x8>
+  801711:	49 bb 26 69 00 00 00 	movabs $0x6926,%r11
+  801718:	00 00 00 
+  80171b:	4c 01 d8             	add    %r11,%rax
+  80171e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801722:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801725:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801729:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80172d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801731:	48 01 d0             	add    %rdx,%rax
+  801734:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801738:	eb 13                	jmp    80174d <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80173a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80173e:	0f b6 00             	movzbl (%rax),%eax
+  801741:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801744:	38 d0                	cmp    %dl,%al
+  801746:	74 11                	je     801759 <memfind+0x57>
+	for (; s < ends; s++)
+  801748:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80174d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801751:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801755:	72 e3                	jb     80173a <memfind+0x38>
+  801757:	eb 01                	jmp    80175a <memfind+0x58>
+			break;
+  801759:	90                   	nop
+	return (void *) s;
+  80175a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80175e:	c9                   	leave
+  80175f:	c3                   	ret
+
+0000000000801760 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801760:	55                   	push   %rbp
+  801761:	48 89 e5             	mov    %rsp,%rbp
+  801764:	48 83 ec 38          	sub    $0x38,%rsp
+  801768:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801768 <strtol+0x8>
+  80176f:	49 bb c8 68 00 00 00 	movabs $0x68c8,%r11
+  801776:	00 00 00 
+  801779:	4c 01 d8             	add    %r11,%rax
+  80177c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801780:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801784:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801787:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80178e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801795:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801796:	eb 05                	jmp    80179d <strtol+0x3d>
+		s++;
+  801798:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  80179d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017a1:	0f b6 00             	movzbl (%rax),%eax
+  8017a4:	3c 20                	cmp    $0x20,%al
+  8017a6:	74 f0                	je     801798 <strtol+0x38>
+  8017a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ac:	0f b6 00             	movzbl (%rax),%eax
+  8017af:	3c 09                	cmp    $0x9,%al
+  8017b1:	74 e5                	je     801798 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  8017b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017b7:	0f b6 00             	movzbl (%rax),%eax
+  8017ba:	3c 2b                	cmp    $0x2b,%al
+  8017bc:	75 07                	jne    8017c5 <strtol+0x65>
+		s++;
+  8017be:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8017c3:	eb 17                	jmp    8017dc <strtol+0x7c>
+	else if (*s == '-')
+  8017c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017c9:	0f b6 00             	movzbl (%rax),%eax
+  8017cc:	3c 2d                	cmp    $0x2d,%al
+  8017ce:	75 0c                	jne    8017dc <strtol+0x7c>
+		s++, neg = 1;
+  8017d0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8017d5:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8017dc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8017e0:	74 06                	je     8017e8 <strtol+0x88>
+  8017e2:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8017e6:	75 28                	jne    801810 <strtol+0xb0>
+  8017e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ec:	0f b6 00             	movzbl (%rax),%eax
+  8017ef:	3c 30                	cmp    $0x30,%al
+  8017f1:	75 1d                	jne    801810 <strtol+0xb0>
+  8017f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017f7:	48 83 c0 01          	add    $0x1,%rax
+  8017fb:	0f b6 00             	movzbl (%rax),%eax
+  8017fe:	3c 78                	cmp    $0x78,%al
+  801800:	75 0e                	jne    801810 <strtol+0xb0>
+		s += 2, base = 16;
+  801802:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801807:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80180e:	eb 2c                	jmp    80183c <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801810:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801814:	75 19                	jne    80182f <strtol+0xcf>
+  801816:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80181a:	0f b6 00             	movzbl (%rax),%eax
+  80181d:	3c 30                	cmp    $0x30,%al
+  80181f:	75 0e                	jne    80182f <strtol+0xcf>
+		s++, base = 8;
+  801821:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801826:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80182d:	eb 0d                	jmp    80183c <strtol+0xdc>
+	else if (base == 0)
+  80182f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801833:	75 07                	jne    80183c <strtol+0xdc>
+		base = 10;
+  801835:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  80183c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801840:	0f b6 00             	movzbl (%rax),%eax
+  801843:	3c 2f                	cmp    $0x2f,%al
+  801845:	7e 1d                	jle    801864 <strtol+0x104>
+  801847:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80184b:	0f b6 00             	movzbl (%rax),%eax
+  80184e:	3c 39                	cmp    $0x39,%al
+  801850:	7f 12                	jg     801864 <strtol+0x104>
+			dig = *s - '0';
+  801852:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801856:	0f b6 00             	movzbl (%rax),%eax
+  801859:	0f be c0             	movsbl %al,%eax
+  80185c:	83 e8 30             	sub    $0x30,%eax
+  80185f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801862:	eb 4e                	jmp    8018b2 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801864:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801868:	0f b6 00             	movzbl (%rax),%eax
+  80186b:	3c 60                	cmp    $0x60,%al
+  80186d:	7e 1d                	jle    80188c <strtol+0x12c>
+  80186f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801873:	0f b6 00             	movzbl (%rax),%eax
+  801876:	3c 7a                	cmp    $0x7a,%al
+  801878:	7f 12                	jg     80188c <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  80187a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80187e:	0f b6 00             	movzbl (%rax),%eax
+  801881:	0f be c0             	movsbl %al,%eax
+  801884:	83 e8 57             	sub    $0x57,%eax
+  801887:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80188a:	eb 26                	jmp    8018b2 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  80188c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801890:	0f b6 00             	movzbl (%rax),%eax
+  801893:	3c 40                	cmp    $0x40,%al
+  801895:	7e 47                	jle    8018de <strtol+0x17e>
+  801897:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80189b:	0f b6 00             	movzbl (%rax),%eax
+  80189e:	3c 5a                	cmp    $0x5a,%al
+  8018a0:	7f 3c                	jg     8018de <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  8018a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a6:	0f b6 00             	movzbl (%rax),%eax
+  8018a9:	0f be c0             	movsbl %al,%eax
+  8018ac:	83 e8 37             	sub    $0x37,%eax
+  8018af:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  8018b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018b5:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8018b8:	7d 23                	jge    8018dd <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  8018ba:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018bf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8018c2:	48 98                	cltq
+  8018c4:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8018c9:	48 89 c2             	mov    %rax,%rdx
+  8018cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018cf:	48 98                	cltq
+  8018d1:	48 01 d0             	add    %rdx,%rax
+  8018d4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  8018d8:	e9 5f ff ff ff       	jmp    80183c <strtol+0xdc>
+			break;
+  8018dd:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8018de:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8018e3:	74 0b                	je     8018f0 <strtol+0x190>
+		*endptr = (char *) s;
+  8018e5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018e9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8018ed:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8018f0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8018f4:	74 09                	je     8018ff <strtol+0x19f>
+  8018f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018fa:	48 f7 d8             	neg    %rax
+  8018fd:	eb 04                	jmp    801903 <strtol+0x1a3>
+  8018ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801903:	c9                   	leave
+  801904:	c3                   	ret
+
+0000000000801905 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801905:	55                   	push   %rbp
+  801906:	48 89 e5             	mov    %rsp,%rbp
+  801909:	53                   	push   %rbx
+  80190a:	48 83 ec 30          	sub    $0x30,%rsp
+  80190e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80190e <strstr+0x9>
+  801915:	49 bb 22 67 00 00 00 	movabs $0x6722,%r11
+  80191c:	00 00 00 
+  80191f:	4c 01 db             	add    %r11,%rbx
+  801922:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801926:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  80192a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80192e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801932:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801936:	0f b6 00             	movzbl (%rax),%eax
+  801939:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  80193c:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801940:	75 06                	jne    801948 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801942:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801946:	eb 73                	jmp    8019bb <strstr+0xb6>
+
+	len = strlen(str);
+  801948:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80194c:	48 89 c7             	mov    %rax,%rdi
+  80194f:	48 b8 62 90 ff ff ff 	movabs $0xffffffffffff9062,%rax
+  801956:	ff ff ff 
+  801959:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80195d:	ff d0                	call   *%rax
+  80195f:	48 98                	cltq
+  801961:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801965:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801969:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80196d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801971:	0f b6 00             	movzbl (%rax),%eax
+  801974:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801977:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  80197b:	75 07                	jne    801984 <strstr+0x7f>
+				return (char *) 0;
+  80197d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801982:	eb 37                	jmp    8019bb <strstr+0xb6>
+		} while (sc != c);
+  801984:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801988:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  80198b:	75 d8                	jne    801965 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  80198d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801991:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801995:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801999:	48 89 ce             	mov    %rcx,%rsi
+  80199c:	48 89 c7             	mov    %rax,%rdi
+  80199f:	48 b8 16 93 ff ff ff 	movabs $0xffffffffffff9316,%rax
+  8019a6:	ff ff ff 
+  8019a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8019ad:	ff d0                	call   *%rax
+  8019af:	85 c0                	test   %eax,%eax
+  8019b1:	75 b2                	jne    801965 <strstr+0x60>
+
+	return (char *) (in - 1);
+  8019b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019b7:	48 83 e8 01          	sub    $0x1,%rax
+}
+  8019bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019bf:	c9                   	leave
+  8019c0:	c3                   	ret
+
+00000000008019c1 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  8019c1:	55                   	push   %rbp
+  8019c2:	48 89 e5             	mov    %rsp,%rbp
+  8019c5:	41 57                	push   %r15
+  8019c7:	53                   	push   %rbx
+  8019c8:	48 83 ec 40          	sub    $0x40,%rsp
+  8019cc:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8019cc <syscall+0xb>
+  8019d3:	49 bb 64 66 00 00 00 	movabs $0x6664,%r11
+  8019da:	00 00 00 
+  8019dd:	4d 01 da             	add    %r11,%r10
+  8019e0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8019e3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8019e6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8019ea:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8019ee:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8019f2:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  8019f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8019f9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8019fd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a01:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801a05:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801a09:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801a0d:	4c 89 c3             	mov    %r8,%rbx
+  801a10:	cd 30                	int    $0x30
+  801a12:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801a16:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801a1a:	74 52                	je     801a6e <syscall+0xad>
+  801a1c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a21:	7e 4b                	jle    801a6e <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a23:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a27:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801a2a:	49 89 d0             	mov    %rdx,%r8
+  801a2d:	89 c1                	mov    %eax,%ecx
+  801a2f:	48 b8 80 e2 ff ff ff 	movabs $0xffffffffffffe280,%rax
+  801a36:	ff ff ff 
+  801a39:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801a3d:	48 89 c2             	mov    %rax,%rdx
+  801a40:	be 23 00 00 00       	mov    $0x23,%esi
+  801a45:	48 b8 9d e2 ff ff ff 	movabs $0xffffffffffffe29d,%rax
+  801a4c:	ff ff ff 
+  801a4f:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801a53:	48 89 c7             	mov    %rax,%rdi
+  801a56:	4d 89 d7             	mov    %r10,%r15
+  801a59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5e:	49 b9 64 d4 ff ff ff 	movabs $0xffffffffffffd464,%r9
+  801a65:	ff ff ff 
+  801a68:	4d 01 d1             	add    %r10,%r9
+  801a6b:	41 ff d1             	call   *%r9
+
+	return ret;
+  801a6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a72:	48 83 c4 40          	add    $0x40,%rsp
+  801a76:	5b                   	pop    %rbx
+  801a77:	41 5f                	pop    %r15
+  801a79:	5d                   	pop    %rbp
+  801a7a:	c3                   	ret
+
+0000000000801a7b <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801a7b:	55                   	push   %rbp
+  801a7c:	48 89 e5             	mov    %rsp,%rbp
+  801a7f:	41 57                	push   %r15
+  801a81:	41 56                	push   %r14
+  801a83:	41 55                	push   %r13
+  801a85:	41 54                	push   %r12
+  801a87:	53                   	push   %rbx
+  801a88:	48 83 ec 48          	sub    $0x48,%rsp
+  801a8c:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801a8c <syscall_words+0x11>
+  801a93:	49 bb a4 65 00 00 00 	movabs $0x65a4,%r11
+  801a9a:	00 00 00 
+  801a9d:	4d 01 de             	add    %r11,%r14
+  801aa0:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801aa3:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801aa6:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801aaa:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801aae:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801ab2:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801ab6:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801abb:	74 09                	je     801ac6 <syscall_words+0x4b>
+  801abd:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ac1:	48 8b 00             	mov    (%rax),%rax
+  801ac4:	eb 05                	jmp    801acb <syscall_words+0x50>
+  801ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acb:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801ace:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ad3:	74 0a                	je     801adf <syscall_words+0x64>
+  801ad5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ad9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801add:	eb 05                	jmp    801ae4 <syscall_words+0x69>
+  801adf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae4:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801ae7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801aec:	74 0a                	je     801af8 <syscall_words+0x7d>
+  801aee:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801af2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801af6:	eb 05                	jmp    801afd <syscall_words+0x82>
+  801af8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afd:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801b00:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b05:	74 0a                	je     801b11 <syscall_words+0x96>
+  801b07:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b0b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b0f:	eb 05                	jmp    801b16 <syscall_words+0x9b>
+  801b11:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b16:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801b19:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b1e:	74 0a                	je     801b2a <syscall_words+0xaf>
+  801b20:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b24:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b28:	eb 05                	jmp    801b2f <syscall_words+0xb4>
+  801b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2f:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801b32:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b37:	74 0a                	je     801b43 <syscall_words+0xc8>
+  801b39:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b3d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801b41:	eb 05                	jmp    801b48 <syscall_words+0xcd>
+  801b43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b48:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801b4b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801b4e:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801b52:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801b56:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801b5a:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801b5e:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801b62:	cd 30                	int    $0x30
+  801b64:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801b68:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801b6d:	74 50                	je     801bbf <syscall_words+0x144>
+		words[0] = r8;
+  801b6f:	4c 89 c2             	mov    %r8,%rdx
+  801b72:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b76:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801b79:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b7d:	48 83 c0 08          	add    $0x8,%rax
+  801b81:	4c 89 ca             	mov    %r9,%rdx
+  801b84:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801b87:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b8b:	48 83 c0 10          	add    $0x10,%rax
+  801b8f:	4c 89 d2             	mov    %r10,%rdx
+  801b92:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801b95:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801b99:	48 83 c0 18          	add    $0x18,%rax
+  801b9d:	4c 89 da             	mov    %r11,%rdx
+  801ba0:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801ba3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ba7:	48 83 c0 20          	add    $0x20,%rax
+  801bab:	4c 89 e2             	mov    %r12,%rdx
+  801bae:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801bb1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bb5:	48 83 c0 28          	add    $0x28,%rax
+  801bb9:	4c 89 ea             	mov    %r13,%rdx
+  801bbc:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801bbf:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801bc3:	74 52                	je     801c17 <syscall_words+0x19c>
+  801bc5:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801bca:	7e 4b                	jle    801c17 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bcc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801bd0:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801bd3:	49 89 d0             	mov    %rdx,%r8
+  801bd6:	89 c1                	mov    %eax,%ecx
+  801bd8:	48 b8 80 e2 ff ff ff 	movabs $0xffffffffffffe280,%rax
+  801bdf:	ff ff ff 
+  801be2:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801be6:	48 89 c2             	mov    %rax,%rdx
+  801be9:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801bee:	48 b8 9d e2 ff ff ff 	movabs $0xffffffffffffe29d,%rax
+  801bf5:	ff ff ff 
+  801bf8:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801bfc:	48 89 c7             	mov    %rax,%rdi
+  801bff:	4d 89 f7             	mov    %r14,%r15
+  801c02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c07:	49 b9 64 d4 ff ff ff 	movabs $0xffffffffffffd464,%r9
+  801c0e:	ff ff ff 
+  801c11:	4d 01 f1             	add    %r14,%r9
+  801c14:	41 ff d1             	call   *%r9
+
+	return ret;
+  801c17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801c1b:	48 83 c4 48          	add    $0x48,%rsp
+  801c1f:	5b                   	pop    %rbx
+  801c20:	41 5c                	pop    %r12
+  801c22:	41 5d                	pop    %r13
+  801c24:	41 5e                	pop    %r14
+  801c26:	41 5f                	pop    %r15
+  801c28:	5d                   	pop    %rbp
+  801c29:	c3                   	ret
+
+0000000000801c2a <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801c2a:	55                   	push   %rbp
+  801c2b:	48 89 e5             	mov    %rsp,%rbp
+  801c2e:	48 83 ec 10          	sub    $0x10,%rsp
+  801c32:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c32 <sys_cputs+0x8>
+  801c39:	49 bb fe 63 00 00 00 	movabs $0x63fe,%r11
+  801c40:	00 00 00 
+  801c43:	4c 01 d8             	add    %r11,%rax
+  801c46:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c4a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801c4e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c52:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c56:	48 83 ec 08          	sub    $0x8,%rsp
+  801c5a:	6a 00                	push   $0x0
+  801c5c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801c62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c68:	be 00 00 00 00       	mov    $0x0,%esi
+  801c6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c72:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801c79:	ff ff ff 
+  801c7c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801c80:	ff d0                	call   *%rax
+  801c82:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801c86:	90                   	nop
+  801c87:	c9                   	leave
+  801c88:	c3                   	ret
+
+0000000000801c89 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801c89:	55                   	push   %rbp
+  801c8a:	48 89 e5             	mov    %rsp,%rbp
+  801c8d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c8d <sys_cgetc+0x4>
+  801c94:	49 bb a3 63 00 00 00 	movabs $0x63a3,%r11
+  801c9b:	00 00 00 
+  801c9e:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ca1:	48 83 ec 08          	sub    $0x8,%rsp
+  801ca5:	6a 00                	push   $0x0
+  801ca7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801cad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbd:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc2:	bf 01 00 00 00       	mov    $0x1,%edi
+  801cc7:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801cce:	ff ff ff 
+  801cd1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801cd5:	ff d0                	call   *%rax
+  801cd7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801cdb:	c9                   	leave
+  801cdc:	c3                   	ret
+
+0000000000801cdd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801cdd:	55                   	push   %rbp
+  801cde:	48 89 e5             	mov    %rsp,%rbp
+  801ce1:	48 83 ec 10          	sub    $0x10,%rsp
+  801ce5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ce5 <sys_env_destroy+0x8>
+  801cec:	49 bb 4b 63 00 00 00 	movabs $0x634b,%r11
+  801cf3:	00 00 00 
+  801cf6:	4c 01 d8             	add    %r11,%rax
+  801cf9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801cfc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801cff:	48 63 d2             	movslq %edx,%rdx
+  801d02:	48 83 ec 08          	sub    $0x8,%rsp
+  801d06:	6a 00                	push   $0x0
+  801d08:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d19:	be 01 00 00 00       	mov    $0x1,%esi
+  801d1e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d23:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801d2a:	ff ff ff 
+  801d2d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801d31:	ff d0                	call   *%rax
+  801d33:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d37:	c9                   	leave
+  801d38:	c3                   	ret
+
+0000000000801d39 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801d39:	55                   	push   %rbp
+  801d3a:	48 89 e5             	mov    %rsp,%rbp
+  801d3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d3d <sys_getenvid+0x4>
+  801d44:	49 bb f3 62 00 00 00 	movabs $0x62f3,%r11
+  801d4b:	00 00 00 
+  801d4e:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801d51:	48 83 ec 08          	sub    $0x8,%rsp
+  801d55:	6a 00                	push   $0x0
+  801d57:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d63:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801d72:	bf 02 00 00 00       	mov    $0x2,%edi
+  801d77:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801d7e:	ff ff ff 
+  801d81:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801d85:	ff d0                	call   *%rax
+  801d87:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d8b:	c9                   	leave
+  801d8c:	c3                   	ret
+
+0000000000801d8d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+  801d91:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d91 <sys_yield+0x4>
+  801d98:	49 bb 9f 62 00 00 00 	movabs $0x629f,%r11
+  801d9f:	00 00 00 
+  801da2:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801da5:	48 83 ec 08          	sub    $0x8,%rsp
+  801da9:	6a 00                	push   $0x0
+  801dab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801db1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801db7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc1:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801dcb:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801dd2:	ff ff ff 
+  801dd5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801dd9:	ff d0                	call   *%rax
+  801ddb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ddf:	90                   	nop
+  801de0:	c9                   	leave
+  801de1:	c3                   	ret
+
+0000000000801de2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801de2:	55                   	push   %rbp
+  801de3:	48 89 e5             	mov    %rsp,%rbp
+  801de6:	48 83 ec 10          	sub    $0x10,%rsp
+  801dea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dea <sys_page_alloc+0x8>
+  801df1:	49 bb 46 62 00 00 00 	movabs $0x6246,%r11
+  801df8:	00 00 00 
+  801dfb:	4c 01 d8             	add    %r11,%rax
+  801dfe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e01:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e05:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801e08:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801e0b:	48 63 f2             	movslq %edx,%rsi
+  801e0e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e12:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801e15:	48 63 d2             	movslq %edx,%rdx
+  801e18:	48 83 ec 08          	sub    $0x8,%rsp
+  801e1c:	6a 00                	push   $0x0
+  801e1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e24:	49 89 f0             	mov    %rsi,%r8
+  801e27:	be 01 00 00 00       	mov    $0x1,%esi
+  801e2c:	bf 04 00 00 00       	mov    $0x4,%edi
+  801e31:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801e38:	ff ff ff 
+  801e3b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e3f:	ff d0                	call   *%rax
+  801e41:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e45:	c9                   	leave
+  801e46:	c3                   	ret
+
+0000000000801e47 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801e47:	55                   	push   %rbp
+  801e48:	48 89 e5             	mov    %rsp,%rbp
+  801e4b:	48 83 ec 20          	sub    $0x20,%rsp
+  801e4f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e4f <sys_page_map+0x8>
+  801e56:	49 bb e1 61 00 00 00 	movabs $0x61e1,%r11
+  801e5d:	00 00 00 
+  801e60:	4c 01 d8             	add    %r11,%rax
+  801e63:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801e66:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e6a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801e6d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e71:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801e75:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801e78:	48 63 f2             	movslq %edx,%rsi
+  801e7b:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  801e7f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801e82:	48 63 fa             	movslq %edx,%rdi
+  801e85:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e89:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801e8c:	48 63 d2             	movslq %edx,%rdx
+  801e8f:	48 83 ec 08          	sub    $0x8,%rsp
+  801e93:	56                   	push   %rsi
+  801e94:	4d 89 c1             	mov    %r8,%r9
+  801e97:	49 89 f8             	mov    %rdi,%r8
+  801e9a:	be 01 00 00 00       	mov    $0x1,%esi
+  801e9f:	bf 05 00 00 00       	mov    $0x5,%edi
+  801ea4:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801eab:	ff ff ff 
+  801eae:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801eb2:	ff d0                	call   *%rax
+  801eb4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eb8:	c9                   	leave
+  801eb9:	c3                   	ret
+
+0000000000801eba <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801eba:	55                   	push   %rbp
+  801ebb:	48 89 e5             	mov    %rsp,%rbp
+  801ebe:	48 83 ec 10          	sub    $0x10,%rsp
+  801ec2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ec2 <sys_page_unmap+0x8>
+  801ec9:	49 bb 6e 61 00 00 00 	movabs $0x616e,%r11
+  801ed0:	00 00 00 
+  801ed3:	4c 01 d8             	add    %r11,%rax
+  801ed6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ed9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801edd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ee1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801ee4:	48 63 d2             	movslq %edx,%rdx
+  801ee7:	48 83 ec 08          	sub    $0x8,%rsp
+  801eeb:	6a 00                	push   $0x0
+  801eed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ef3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ef9:	be 01 00 00 00       	mov    $0x1,%esi
+  801efe:	bf 06 00 00 00       	mov    $0x6,%edi
+  801f03:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801f0a:	ff ff ff 
+  801f0d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f11:	ff d0                	call   *%rax
+  801f13:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f17:	c9                   	leave
+  801f18:	c3                   	ret
+
+0000000000801f19 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801f19:	55                   	push   %rbp
+  801f1a:	48 89 e5             	mov    %rsp,%rbp
+  801f1d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f21:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f21 <sys_env_set_status+0x8>
+  801f28:	49 bb 0f 61 00 00 00 	movabs $0x610f,%r11
+  801f2f:	00 00 00 
+  801f32:	4c 01 d8             	add    %r11,%rax
+  801f35:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f38:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  801f3b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801f3e:	48 63 ca             	movslq %edx,%rcx
+  801f41:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f44:	48 63 d2             	movslq %edx,%rdx
+  801f47:	48 83 ec 08          	sub    $0x8,%rsp
+  801f4b:	6a 00                	push   $0x0
+  801f4d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f53:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f59:	be 01 00 00 00       	mov    $0x1,%esi
+  801f5e:	bf 08 00 00 00       	mov    $0x8,%edi
+  801f63:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801f6a:	ff ff ff 
+  801f6d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f71:	ff d0                	call   *%rax
+  801f73:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f77:	c9                   	leave
+  801f78:	c3                   	ret
+
+0000000000801f79 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801f79:	55                   	push   %rbp
+  801f7a:	48 89 e5             	mov    %rsp,%rbp
+  801f7d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f81:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f81 <sys_env_set_trapframe+0x8>
+  801f88:	49 bb af 60 00 00 00 	movabs $0x60af,%r11
+  801f8f:	00 00 00 
+  801f92:	4c 01 d8             	add    %r11,%rax
+  801f95:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f98:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  801f9c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fa0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fa3:	48 63 d2             	movslq %edx,%rdx
+  801fa6:	48 83 ec 08          	sub    $0x8,%rsp
+  801faa:	6a 00                	push   $0x0
+  801fac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fb2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fb8:	be 01 00 00 00       	mov    $0x1,%esi
+  801fbd:	bf 09 00 00 00       	mov    $0x9,%edi
+  801fc2:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  801fc9:	ff ff ff 
+  801fcc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fd0:	ff d0                	call   *%rax
+  801fd2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+0000000000801fd8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801fd8:	55                   	push   %rbp
+  801fd9:	48 89 e5             	mov    %rsp,%rbp
+  801fdc:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fe0 <sys_env_set_pgfault_upcall+0x8>
+  801fe7:	49 bb 50 60 00 00 00 	movabs $0x6050,%r11
+  801fee:	00 00 00 
+  801ff1:	4c 01 d8             	add    %r11,%rax
+  801ff4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801ff7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  801ffb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fff:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802002:	48 63 d2             	movslq %edx,%rdx
+  802005:	48 83 ec 08          	sub    $0x8,%rsp
+  802009:	6a 00                	push   $0x0
+  80200b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802011:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802017:	be 01 00 00 00       	mov    $0x1,%esi
+  80201c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802021:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  802028:	ff ff ff 
+  80202b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80202f:	ff d0                	call   *%rax
+  802031:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802035:	c9                   	leave
+  802036:	c3                   	ret
+
+0000000000802037 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	48 83 ec 20          	sub    $0x20,%rsp
+  80203f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80203f <sys_ipc_try_send+0x8>
+  802046:	49 bb f1 5f 00 00 00 	movabs $0x5ff1,%r11
+  80204d:	00 00 00 
+  802050:	4c 01 d8             	add    %r11,%rax
+  802053:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802056:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80205a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80205e:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802061:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802064:	48 63 fa             	movslq %edx,%rdi
+  802067:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80206b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80206e:	48 63 d2             	movslq %edx,%rdx
+  802071:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802075:	48 83 ec 08          	sub    $0x8,%rsp
+  802079:	6a 00                	push   $0x0
+  80207b:	49 89 f9             	mov    %rdi,%r9
+  80207e:	49 89 f0             	mov    %rsi,%r8
+  802081:	be 00 00 00 00       	mov    $0x0,%esi
+  802086:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80208b:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  802092:	ff ff ff 
+  802095:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802099:	ff d0                	call   *%rax
+  80209b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80209f:	c9                   	leave
+  8020a0:	c3                   	ret
+
+00000000008020a1 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8020a1:	55                   	push   %rbp
+  8020a2:	48 89 e5             	mov    %rsp,%rbp
+  8020a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8020a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020a9 <sys_ipc_send+0x8>
+  8020b0:	49 bb 87 5f 00 00 00 	movabs $0x5f87,%r11
+  8020b7:	00 00 00 
+  8020ba:	4c 01 d8             	add    %r11,%rax
+  8020bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020c4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8020c8:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8020cb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020ce:	48 63 fa             	movslq %edx,%rdi
+  8020d1:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8020d5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020d8:	48 63 d2             	movslq %edx,%rdx
+  8020db:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020df:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e3:	6a 00                	push   $0x0
+  8020e5:	49 89 f9             	mov    %rdi,%r9
+  8020e8:	49 89 f0             	mov    %rsi,%r8
+  8020eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f0:	bf 17 00 00 00       	mov    $0x17,%edi
+  8020f5:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  8020fc:	ff ff ff 
+  8020ff:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802103:	ff d0                	call   *%rax
+  802105:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802109:	c9                   	leave
+  80210a:	c3                   	ret
+
+000000000080210b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80210b:	55                   	push   %rbp
+  80210c:	48 89 e5             	mov    %rsp,%rbp
+  80210f:	48 83 ec 10          	sub    $0x10,%rsp
+  802113:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802113 <sys_ipc_recv+0x8>
+  80211a:	49 bb 1d 5f 00 00 00 	movabs $0x5f1d,%r11
+  802121:	00 00 00 
+  802124:	4c 01 d8             	add    %r11,%rax
+  802127:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80212b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80212f:	6a 00                	push   $0x0
+  802131:	6a 00                	push   $0x0
+  802133:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802139:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80213f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802144:	be 01 00 00 00       	mov    $0x1,%esi
+  802149:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80214e:	49 ba 4b 9a ff ff ff 	movabs $0xffffffffffff9a4b,%r10
+  802155:	ff ff ff 
+  802158:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80215c:	ff d0                	call   *%rax
+  80215e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802162:	c9                   	leave
+  802163:	c3                   	ret
+
+0000000000802164 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+  802168:	48 83 ec 30          	sub    $0x30,%rsp
+  80216c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80216c <sys_ipc_call+0x8>
+  802173:	49 bb c4 5e 00 00 00 	movabs $0x5ec4,%r11
+  80217a:	00 00 00 
+  80217d:	4c 01 d8             	add    %r11,%rax
+  802180:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802183:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802187:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80218b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80218e:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802192:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802196:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80219a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80219d:	4c 63 c2             	movslq %edx,%r8
+  8021a0:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8021a4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021a7:	48 63 d2             	movslq %edx,%rdx
+  8021aa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021ae:	ff 75 d8             	push   -0x28(%rbp)
+  8021b1:	56                   	push   %rsi
+  8021b2:	4d 89 c1             	mov    %r8,%r9
+  8021b5:	49 89 f8             	mov    %rdi,%r8
+  8021b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021bd:	bf 18 00 00 00       	mov    $0x18,%edi
+  8021c2:	49 ba 4b 9a ff ff ff 	movabs $0xffffffffffff9a4b,%r10
+  8021c9:	ff ff ff 
+  8021cc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021d0:	ff d0                	call   *%rax
+  8021d2:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8021d6:	c9                   	leave
+  8021d7:	c3                   	ret
+
+00000000008021d8 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8021d8:	55                   	push   %rbp
+  8021d9:	48 89 e5             	mov    %rsp,%rbp
+  8021dc:	48 83 ec 30          	sub    $0x30,%rsp
+  8021e0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021e0 <sys_ipc_reply_recv+0x8>
+  8021e7:	49 bb 50 5e 00 00 00 	movabs $0x5e50,%r11
+  8021ee:	00 00 00 
+  8021f1:	4c 01 d8             	add    %r11,%rax
+  8021f4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021fb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021ff:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802202:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802206:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80220a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80220e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802211:	4c 63 c2             	movslq %edx,%r8
+  802214:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802218:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80221b:	48 63 d2             	movslq %edx,%rdx
+  80221e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802222:	ff 75 d8             	push   -0x28(%rbp)
+  802225:	56                   	push   %rsi
+  802226:	4d 89 c1             	mov    %r8,%r9
+  802229:	49 89 f8             	mov    %rdi,%r8
+  80222c:	be 00 00 00 00       	mov    $0x0,%esi
+  802231:	bf 19 00 00 00       	mov    $0x19,%edi
+  802236:	49 ba 4b 9a ff ff ff 	movabs $0xffffffffffff9a4b,%r10
+  80223d:	ff ff ff 
+  802240:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802244:	ff d0                	call   *%rax
+  802246:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80224a:	c9                   	leave
+  80224b:	c3                   	ret
+
+000000000080224c <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80224c:	55                   	push   %rbp
+  80224d:	48 89 e5             	mov    %rsp,%rbp
+  802250:	48 83 ec 10          	sub    $0x10,%rsp
+  802254:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802254 <sys_env_set_priority+0x8>
+  80225b:	49 bb dc 5d 00 00 00 	movabs $0x5ddc,%r11
+  802262:	00 00 00 
+  802265:	4c 01 d8             	add    %r11,%rax
+  802268:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80226b:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80226e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802271:	48 63 ca             	movslq %edx,%rcx
+  802274:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802277:	48 63 d2             	movslq %edx,%rdx
+  80227a:	48 83 ec 08          	sub    $0x8,%rsp
+  80227e:	6a 00                	push   $0x0
+  802280:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80228c:	be 01 00 00 00       	mov    $0x1,%esi
+  802291:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802296:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  80229d:	ff ff ff 
+  8022a0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022a4:	ff d0                	call   *%rax
+  8022a6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022aa:	c9                   	leave
+  8022ab:	c3                   	ret
+
+00000000008022ac <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8022ac:	55                   	push   %rbp
+  8022ad:	48 89 e5             	mov    %rsp,%rbp
+  8022b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022b4 <sys_env_set_affinity+0x8>
+  8022bb:	49 bb 7c 5d 00 00 00 	movabs $0x5d7c,%r11
+  8022c2:	00 00 00 
+  8022c5:	4c 01 d8             	add    %r11,%rax
+  8022c8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022cb:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8022ce:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8022d1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022d4:	48 63 d2             	movslq %edx,%rdx
+  8022d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8022db:	6a 00                	push   $0x0
+  8022dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022e9:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ee:	bf 10 00 00 00       	mov    $0x10,%edi
+  8022f3:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  8022fa:	ff ff ff 
+  8022fd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802301:	ff d0                	call   *%rax
+  802303:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802307:	c9                   	leave
+  802308:	c3                   	ret
+
+0000000000802309 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802309:	55                   	push   %rbp
+  80230a:	48 89 e5             	mov    %rsp,%rbp
+  80230d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80230d <sys_time_msec+0x4>
+  802314:	49 bb 23 5d 00 00 00 	movabs $0x5d23,%r11
+  80231b:	00 00 00 
+  80231e:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802321:	48 83 ec 08          	sub    $0x8,%rsp
+  802325:	6a 00                	push   $0x0
+  802327:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80232d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802333:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802338:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233d:	be 00 00 00 00       	mov    $0x0,%esi
+  802342:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802347:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  80234e:	ff ff ff 
+  802351:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802355:	ff d0                	call   *%rax
+  802357:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80235b:	c9                   	leave
+  80235c:	c3                   	ret
+
+000000000080235d <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80235d:	55                   	push   %rbp
+  80235e:	48 89 e5             	mov    %rsp,%rbp
+  802361:	48 83 ec 10          	sub    $0x10,%rsp
+  802365:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802365 <sys_sleep_usec+0x8>
+  80236c:	49 bb cb 5c 00 00 00 	movabs $0x5ccb,%r11
+  802373:	00 00 00 
+  802376:	4c 01 d8             	add    %r11,%rax
+  802379:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80237d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802381:	48 83 ec 08          	sub    $0x8,%rsp
+  802385:	6a 00                	push   $0x0
+  802387:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80238d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802393:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802398:	be 00 00 00 00       	mov    $0x0,%esi
+  80239d:	bf 11 00 00 00       	mov    $0x11,%edi
+  8023a2:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  8023a9:	ff ff ff 
+  8023ac:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023b0:	ff d0                	call   *%rax
+  8023b2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023b6:	c9                   	leave
+  8023b7:	c3                   	ret
+
+00000000008023b8 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8023b8:	55                   	push   %rbp
+  8023b9:	48 89 e5             	mov    %rsp,%rbp
+  8023bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8023c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023c0 <sys_page_alloc_huge+0x8>
+  8023c7:	49 bb 70 5c 00 00 00 	movabs $0x5c70,%r11
+  8023ce:	00 00 00 
+  8023d1:	4c 01 d8             	add    %r11,%rax
+  8023d4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023db:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8023de:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023e1:	48 63 f2             	movslq %edx,%rsi
+  8023e4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023e8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023eb:	48 63 d2             	movslq %edx,%rdx
+  8023ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8023f2:	6a 00                	push   $0x0
+  8023f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023fa:	49 89 f0             	mov    %rsi,%r8
+  8023fd:	be 01 00 00 00       	mov    $0x1,%esi
+  802402:	bf 12 00 00 00       	mov    $0x12,%edi
+  802407:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  80240e:	ff ff ff 
+  802411:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802415:	ff d0                	call   *%rax
+  802417:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80241b:	c9                   	leave
+  80241c:	c3                   	ret
+
+000000000080241d <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80241d:	55                   	push   %rbp
+  80241e:	48 89 e5             	mov    %rsp,%rbp
+  802421:	48 83 ec 10          	sub    $0x10,%rsp
+  802425:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802425 <sys_page_map_batch+0x8>
+  80242c:	49 bb 0b 5c 00 00 00 	movabs $0x5c0b,%r11
+  802433:	00 00 00 
+  802436:	4c 01 d8             	add    %r11,%rax
+  802439:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80243d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802441:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802445:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802449:	48 83 ec 08          	sub    $0x8,%rsp
+  80244d:	6a 00                	push   $0x0
+  80244f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802455:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80245b:	be 01 00 00 00       	mov    $0x1,%esi
+  802460:	bf 13 00 00 00       	mov    $0x13,%edi
+  802465:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  80246c:	ff ff ff 
+  80246f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802473:	ff d0                	call   *%rax
+  802475:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+
+000000000080247b <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80247b:	55                   	push   %rbp
+  80247c:	48 89 e5             	mov    %rsp,%rbp
+  80247f:	48 83 ec 10          	sub    $0x10,%rsp
+  802483:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802483 <sys_page_alloc_batch+0x8>
+  80248a:	49 bb ad 5b 00 00 00 	movabs $0x5bad,%r11
+  802491:	00 00 00 
+  802494:	4c 01 d8             	add    %r11,%rax
+  802497:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80249b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80249f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024a3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ab:	6a 00                	push   $0x0
+  8024ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8024be:	bf 14 00 00 00       	mov    $0x14,%edi
+  8024c3:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  8024ca:	ff ff ff 
+  8024cd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024d1:	ff d0                	call   *%rax
+  8024d3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d7:	c9                   	leave
+  8024d8:	c3                   	ret
+
+00000000008024d9 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8024d9:	55                   	push   %rbp
+  8024da:	48 89 e5             	mov    %rsp,%rbp
+  8024dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8024e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024e1 <sys_page_unmap_batch+0x8>
+  8024e8:	49 bb 4f 5b 00 00 00 	movabs $0x5b4f,%r11
+  8024ef:	00 00 00 
+  8024f2:	4c 01 d8             	add    %r11,%rax
+  8024f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8024fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802501:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802505:	48 83 ec 08          	sub    $0x8,%rsp
+  802509:	6a 00                	push   $0x0
+  80250b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802511:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802517:	be 01 00 00 00       	mov    $0x1,%esi
+  80251c:	bf 15 00 00 00       	mov    $0x15,%edi
+  802521:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  802528:	ff ff ff 
+  80252b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80252f:	ff d0                	call   *%rax
+  802531:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802535:	c9                   	leave
+  802536:	c3                   	ret
+
+0000000000802537 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802537:	55                   	push   %rbp
+  802538:	48 89 e5             	mov    %rsp,%rbp
+  80253b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80253b <sys_fork+0x4>
+  802542:	49 bb f5 5a 00 00 00 	movabs $0x5af5,%r11
+  802549:	00 00 00 
+  80254c:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80254f:	48 83 ec 08          	sub    $0x8,%rsp
+  802553:	6a 00                	push   $0x0
+  802555:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80255b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802561:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802566:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256b:	be 00 00 00 00       	mov    $0x0,%esi
+  802570:	bf 16 00 00 00       	mov    $0x16,%edi
+  802575:	49 ba 91 99 ff ff ff 	movabs $0xffffffffffff9991,%r10
+  80257c:	ff ff ff 
+  80257f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802583:	ff d0                	call   *%rax
+  802585:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802589:	c9                   	leave
+  80258a:	c3                   	ret
+
+000000000080258b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80258b:	55                   	push   %rbp
+  80258c:	48 89 e5             	mov    %rsp,%rbp
+  80258f:	48 83 ec 08          	sub    $0x8,%rsp
+  802593:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802593 <fd2num+0x8>
+  80259a:	49 bb 9d 5a 00 00 00 	movabs $0x5a9d,%r11
+  8025a1:	00 00 00 
+  8025a4:	4c 01 d8             	add    %r11,%rax
+  8025a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8025ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025af:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8025b6:	ff ff ff 
+  8025b9:	48 01 d0             	add    %rdx,%rax
+  8025bc:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8025c0:	c9                   	leave
+  8025c1:	c3                   	ret
+
+00000000008025c2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8025c2:	55                   	push   %rbp
+  8025c3:	48 89 e5             	mov    %rsp,%rbp
+  8025c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025ca <fd2data+0x8>
+  8025d1:	49 bb 66 5a 00 00 00 	movabs $0x5a66,%r11
+  8025d8:	00 00 00 
+  8025db:	4c 01 d8             	add    %r11,%rax
+  8025de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8025e2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025e6:	48 89 d7             	mov    %rdx,%rdi
+  8025e9:	48 ba 5b a5 ff ff ff 	movabs $0xffffffffffffa55b,%rdx
+  8025f0:	ff ff ff 
+  8025f3:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8025f7:	ff d0                	call   *%rax
+  8025f9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8025ff:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802603:	c9                   	leave
+  802604:	c3                   	ret
+
+0000000000802605 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802605:	55                   	push   %rbp
+  802606:	48 89 e5             	mov    %rsp,%rbp
+  802609:	48 83 ec 18          	sub    $0x18,%rsp
+  80260d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80260d <fd_alloc+0x8>
+  802614:	49 bb 23 5a 00 00 00 	movabs $0x5a23,%r11
+  80261b:	00 00 00 
+  80261e:	4c 01 d8             	add    %r11,%rax
+  802621:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802625:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80262c:	eb 75                	jmp    8026a3 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  80262e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802631:	48 63 d2             	movslq %edx,%rdx
+  802634:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  80263b:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80263f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802643:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802647:	48 89 d1             	mov    %rdx,%rcx
+  80264a:	48 c1 e9 15          	shr    $0x15,%rcx
+  80264e:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802655:	ff ff ff 
+  802658:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80265c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802660:	83 e2 01             	and    $0x1,%edx
+  802663:	48 85 d2             	test   %rdx,%rdx
+  802666:	74 25                	je     80268d <fd_alloc+0x88>
+  802668:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80266c:	48 89 d1             	mov    %rdx,%rcx
+  80266f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802673:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80267a:	ff ff ff 
+  80267d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802681:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802685:	83 e2 01             	and    $0x1,%edx
+  802688:	48 85 d2             	test   %rdx,%rdx
+  80268b:	75 12                	jne    80269f <fd_alloc+0x9a>
+			*fd_store = fd;
+  80268d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802691:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802695:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802698:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269d:	eb 1a                	jmp    8026b9 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  80269f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8026a3:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8026a7:	7e 85                	jle    80262e <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  8026a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026ad:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  8026b4:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  8026b9:	c9                   	leave
+  8026ba:	c3                   	ret
+
+00000000008026bb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8026bb:	55                   	push   %rbp
+  8026bc:	48 89 e5             	mov    %rsp,%rbp
+  8026bf:	48 83 ec 20          	sub    $0x20,%rsp
+  8026c3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026c3 <fd_lookup+0x8>
+  8026ca:	49 bb 6d 59 00 00 00 	movabs $0x596d,%r11
+  8026d1:	00 00 00 
+  8026d4:	4c 01 d8             	add    %r11,%rax
+  8026d7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8026da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8026de:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8026e2:	78 06                	js     8026ea <fd_lookup+0x2f>
+  8026e4:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8026e8:	7e 07                	jle    8026f1 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8026ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ef:	eb 73                	jmp    802764 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8026f1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8026f4:	48 63 d2             	movslq %edx,%rdx
+  8026f7:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8026fe:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802702:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802706:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80270a:	48 89 d1             	mov    %rdx,%rcx
+  80270d:	48 c1 e9 15          	shr    $0x15,%rcx
+  802711:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802718:	ff ff ff 
+  80271b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80271f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802723:	83 e2 01             	and    $0x1,%edx
+  802726:	48 85 d2             	test   %rdx,%rdx
+  802729:	74 22                	je     80274d <fd_lookup+0x92>
+  80272b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80272f:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802733:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  80273a:	ff ff ff 
+  80273d:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802741:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802745:	83 e0 01             	and    $0x1,%eax
+  802748:	48 85 c0             	test   %rax,%rax
+  80274b:	75 07                	jne    802754 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80274d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802752:	eb 10                	jmp    802764 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802754:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802758:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80275c:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  80275f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802764:	c9                   	leave
+  802765:	c3                   	ret
+
+0000000000802766 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802766:	55                   	push   %rbp
+  802767:	48 89 e5             	mov    %rsp,%rbp
+  80276a:	41 57                	push   %r15
+  80276c:	53                   	push   %rbx
+  80276d:	48 83 ec 30          	sub    $0x30,%rsp
+  802771:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802771 <fd_close+0xb>
+  802778:	49 bb bf 58 00 00 00 	movabs $0x58bf,%r11
+  80277f:	00 00 00 
+  802782:	4c 01 db             	add    %r11,%rbx
+  802785:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802789:	89 f0                	mov    %esi,%eax
+  80278b:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80278e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802792:	48 89 c7             	mov    %rax,%rdi
+  802795:	48 b8 5b a5 ff ff ff 	movabs $0xffffffffffffa55b,%rax
+  80279c:	ff ff ff 
+  80279f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8027a3:	ff d0                	call   *%rax
+  8027a5:	89 c2                	mov    %eax,%edx
+  8027a7:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8027ab:	48 89 c6             	mov    %rax,%rsi
+  8027ae:	89 d7                	mov    %edx,%edi
+  8027b0:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  8027b7:	ff ff ff 
+  8027ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8027be:	ff d0                	call   *%rax
+  8027c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8027c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8027c7:	78 0a                	js     8027d3 <fd_close+0x6d>
+	    || fd != fd2)
+  8027c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8027cd:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  8027d1:	74 12                	je     8027e5 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  8027d3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8027d7:	74 05                	je     8027de <fd_close+0x78>
+  8027d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027dc:	eb 7a                	jmp    802858 <fd_close+0xf2>
+  8027de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e3:	eb 73                	jmp    802858 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8027e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027e9:	8b 00                	mov    (%rax),%eax
+  8027eb:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8027ef:	48 89 d6             	mov    %rdx,%rsi
+  8027f2:	89 c7                	mov    %eax,%edi
+  8027f4:	48 b8 31 a8 ff ff ff 	movabs $0xffffffffffffa831,%rax
+  8027fb:	ff ff ff 
+  8027fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802802:	ff d0                	call   *%rax
+  802804:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802807:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80280b:	78 2a                	js     802837 <fd_close+0xd1>
+		if (dev->dev_close)
+  80280d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802811:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802815:	48 85 c0             	test   %rax,%rax
+  802818:	74 16                	je     802830 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  80281a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80281e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802822:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802826:	48 89 c7             	mov    %rax,%rdi
+  802829:	ff d2                	call   *%rdx
+  80282b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80282e:	eb 07                	jmp    802837 <fd_close+0xd1>
+		else
+			r = 0;
+  802830:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802837:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80283b:	48 89 c6             	mov    %rax,%rsi
+  80283e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802843:	49 89 df             	mov    %rbx,%r15
+  802846:	48 b8 8a 9e ff ff ff 	movabs $0xffffffffffff9e8a,%rax
+  80284d:	ff ff ff 
+  802850:	48 01 d8             	add    %rbx,%rax
+  802853:	ff d0                	call   *%rax
+	return r;
+  802855:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802858:	48 83 c4 30          	add    $0x30,%rsp
+  80285c:	5b                   	pop    %rbx
+  80285d:	41 5f                	pop    %r15
+  80285f:	5d                   	pop    %rbp
+  802860:	c3                   	ret
+
+0000000000802861 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802861:	55                   	push   %rbp
+  802862:	48 89 e5             	mov    %rsp,%rbp
+  802865:	41 57                	push   %r15
+  802867:	48 83 ec 28          	sub    $0x28,%rsp
+  80286b:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80286b <dev_lookup+0xa>
+  802872:	49 bb c5 57 00 00 00 	movabs $0x57c5,%r11
+  802879:	00 00 00 
+  80287c:	4c 01 d9             	add    %r11,%rcx
+  80287f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802882:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802886:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80288d:	eb 45                	jmp    8028d4 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  80288f:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802896:	00 00 00 
+  802899:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80289c:	48 98                	cltq
+  80289e:	48 01 ca             	add    %rcx,%rdx
+  8028a1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028a5:	8b 00                	mov    (%rax),%eax
+  8028a7:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8028aa:	75 24                	jne    8028d0 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  8028ac:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  8028b3:	00 00 00 
+  8028b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028b9:	48 98                	cltq
+  8028bb:	48 01 ca             	add    %rcx,%rdx
+  8028be:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8028c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028c6:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8028c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ce:	eb 74                	jmp    802944 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  8028d0:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8028d4:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  8028db:	00 00 00 
+  8028de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028e1:	48 98                	cltq
+  8028e3:	48 01 ca             	add    %rcx,%rdx
+  8028e6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8028ea:	48 85 c0             	test   %rax,%rax
+  8028ed:	75 a0                	jne    80288f <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8028ef:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8028f6:	ff ff ff 
+  8028f9:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8028fd:	48 8b 00             	mov    (%rax),%rax
+  802900:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802906:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802909:	89 c6                	mov    %eax,%esi
+  80290b:	48 b8 b0 e2 ff ff ff 	movabs $0xffffffffffffe2b0,%rax
+  802912:	ff ff ff 
+  802915:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802919:	48 89 c7             	mov    %rax,%rdi
+  80291c:	49 89 cf             	mov    %rcx,%r15
+  80291f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802924:	49 b8 34 83 ff ff ff 	movabs $0xffffffffffff8334,%r8
+  80292b:	ff ff ff 
+  80292e:	49 01 c8             	add    %rcx,%r8
+  802931:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802934:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802938:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  80293f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802944:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802948:	c9                   	leave
+  802949:	c3                   	ret
+
+000000000080294a <close>:
+
+int
+close(int fdnum)
+{
+  80294a:	55                   	push   %rbp
+  80294b:	48 89 e5             	mov    %rsp,%rbp
+  80294e:	53                   	push   %rbx
+  80294f:	48 83 ec 28          	sub    $0x28,%rsp
+  802953:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802953 <close+0x9>
+  80295a:	49 bb dd 56 00 00 00 	movabs $0x56dd,%r11
+  802961:	00 00 00 
+  802964:	4c 01 db             	add    %r11,%rbx
+  802967:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80296a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80296e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802971:	48 89 d6             	mov    %rdx,%rsi
+  802974:	89 c7                	mov    %eax,%edi
+  802976:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  80297d:	ff ff ff 
+  802980:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802984:	ff d0                	call   *%rax
+  802986:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802989:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80298d:	79 05                	jns    802994 <close+0x4a>
+		return r;
+  80298f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802992:	eb 1c                	jmp    8029b0 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802994:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802998:	be 01 00 00 00       	mov    $0x1,%esi
+  80299d:	48 89 c7             	mov    %rax,%rdi
+  8029a0:	48 b8 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rax
+  8029a7:	ff ff ff 
+  8029aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029ae:	ff d0                	call   *%rax
+}
+  8029b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029b4:	c9                   	leave
+  8029b5:	c3                   	ret
+
+00000000008029b6 <close_all>:
+
+void
+close_all(void)
+{
+  8029b6:	55                   	push   %rbp
+  8029b7:	48 89 e5             	mov    %rsp,%rbp
+  8029ba:	53                   	push   %rbx
+  8029bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8029bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8029bf <close_all+0x9>
+  8029c6:	49 bb 71 56 00 00 00 	movabs $0x5671,%r11
+  8029cd:	00 00 00 
+  8029d0:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8029d3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8029da:	eb 19                	jmp    8029f5 <close_all+0x3f>
+		close(i);
+  8029dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029df:	89 c7                	mov    %eax,%edi
+  8029e1:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  8029e8:	ff ff ff 
+  8029eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029ef:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8029f1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8029f5:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8029f9:	7e e1                	jle    8029dc <close_all+0x26>
+}
+  8029fb:	90                   	nop
+  8029fc:	90                   	nop
+  8029fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a01:	c9                   	leave
+  802a02:	c3                   	ret
+
+0000000000802a03 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802a03:	55                   	push   %rbp
+  802a04:	48 89 e5             	mov    %rsp,%rbp
+  802a07:	41 57                	push   %r15
+  802a09:	53                   	push   %rbx
+  802a0a:	48 83 ec 40          	sub    $0x40,%rsp
+  802a0e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a0e <dup+0xb>
+  802a15:	49 bb 22 56 00 00 00 	movabs $0x5622,%r11
+  802a1c:	00 00 00 
+  802a1f:	4c 01 db             	add    %r11,%rbx
+  802a22:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802a25:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802a28:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802a2c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802a2f:	48 89 d6             	mov    %rdx,%rsi
+  802a32:	89 c7                	mov    %eax,%edi
+  802a34:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  802a3b:	ff ff ff 
+  802a3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a42:	ff d0                	call   *%rax
+  802a44:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802a47:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a4b:	79 08                	jns    802a55 <dup+0x52>
+		return r;
+  802a4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a50:	e9 a4 01 00 00       	jmp    802bf9 <dup+0x1f6>
+	close(newfdnum);
+  802a55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a58:	89 c7                	mov    %eax,%edi
+  802a5a:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  802a61:	ff ff ff 
+  802a64:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a68:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802a6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a6d:	48 98                	cltq
+  802a6f:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802a75:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a79:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802a7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a81:	48 89 c7             	mov    %rax,%rdi
+  802a84:	48 b8 92 a5 ff ff ff 	movabs $0xffffffffffffa592,%rax
+  802a8b:	ff ff ff 
+  802a8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a92:	ff d0                	call   *%rax
+  802a94:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802a98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a9c:	48 89 c7             	mov    %rax,%rdi
+  802a9f:	48 b8 92 a5 ff ff ff 	movabs $0xffffffffffffa592,%rax
+  802aa6:	ff ff ff 
+  802aa9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aad:	ff d0                	call   *%rax
+  802aaf:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802ab3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ab7:	48 c1 e8 15          	shr    $0x15,%rax
+  802abb:	48 89 c2             	mov    %rax,%rdx
+  802abe:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802ac5:	ff ff ff 
+  802ac8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802acc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ad0:	83 e0 01             	and    $0x1,%eax
+  802ad3:	48 85 c0             	test   %rax,%rax
+  802ad6:	74 7f                	je     802b57 <dup+0x154>
+  802ad8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802adc:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ae0:	48 89 c2             	mov    %rax,%rdx
+  802ae3:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802aea:	ff ff ff 
+  802aed:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802af1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802af5:	83 e0 01             	and    $0x1,%eax
+  802af8:	48 85 c0             	test   %rax,%rax
+  802afb:	74 5a                	je     802b57 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802afd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b01:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b05:	48 89 c2             	mov    %rax,%rdx
+  802b08:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802b0f:	ff ff ff 
+  802b12:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b16:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b1a:	25 07 0e 00 00       	and    $0xe07,%eax
+  802b1f:	89 c1                	mov    %eax,%ecx
+  802b21:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802b25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b29:	41 89 c8             	mov    %ecx,%r8d
+  802b2c:	48 89 d1             	mov    %rdx,%rcx
+  802b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b34:	48 89 c6             	mov    %rax,%rsi
+  802b37:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b3c:	49 89 df             	mov    %rbx,%r15
+  802b3f:	48 b8 17 9e ff ff ff 	movabs $0xffffffffffff9e17,%rax
+  802b46:	ff ff ff 
+  802b49:	48 01 d8             	add    %rbx,%rax
+  802b4c:	ff d0                	call   *%rax
+  802b4e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b51:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b55:	78 5f                	js     802bb6 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802b57:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b5b:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b5f:	48 89 c2             	mov    %rax,%rdx
+  802b62:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802b69:	ff ff ff 
+  802b6c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b70:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b74:	25 07 0e 00 00       	and    $0xe07,%eax
+  802b79:	89 c1                	mov    %eax,%ecx
+  802b7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b7f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b83:	41 89 c8             	mov    %ecx,%r8d
+  802b86:	48 89 d1             	mov    %rdx,%rcx
+  802b89:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b8e:	48 89 c6             	mov    %rax,%rsi
+  802b91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b96:	49 89 df             	mov    %rbx,%r15
+  802b99:	48 b8 17 9e ff ff ff 	movabs $0xffffffffffff9e17,%rax
+  802ba0:	ff ff ff 
+  802ba3:	48 01 d8             	add    %rbx,%rax
+  802ba6:	ff d0                	call   *%rax
+  802ba8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802baf:	78 08                	js     802bb9 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802bb1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802bb4:	eb 43                	jmp    802bf9 <dup+0x1f6>
+			goto err;
+  802bb6:	90                   	nop
+  802bb7:	eb 01                	jmp    802bba <dup+0x1b7>
+		goto err;
+  802bb9:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802bba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bbe:	48 89 c6             	mov    %rax,%rsi
+  802bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc6:	49 89 df             	mov    %rbx,%r15
+  802bc9:	48 b8 8a 9e ff ff ff 	movabs $0xffffffffffff9e8a,%rax
+  802bd0:	ff ff ff 
+  802bd3:	48 01 d8             	add    %rbx,%rax
+  802bd6:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802bd8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bdc:	48 89 c6             	mov    %rax,%rsi
+  802bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be4:	49 89 df             	mov    %rbx,%r15
+  802be7:	48 b8 8a 9e ff ff ff 	movabs $0xffffffffffff9e8a,%rax
+  802bee:	ff ff ff 
+  802bf1:	48 01 d8             	add    %rbx,%rax
+  802bf4:	ff d0                	call   *%rax
+	return r;
+  802bf6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802bf9:	48 83 c4 40          	add    $0x40,%rsp
+  802bfd:	5b                   	pop    %rbx
+  802bfe:	41 5f                	pop    %r15
+  802c00:	5d                   	pop    %rbp
+  802c01:	c3                   	ret
+
+0000000000802c02 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802c02:	55                   	push   %rbp
+  802c03:	48 89 e5             	mov    %rsp,%rbp
+  802c06:	41 57                	push   %r15
+  802c08:	53                   	push   %rbx
+  802c09:	48 83 ec 40          	sub    $0x40,%rsp
+  802c0d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c0d <read+0xb>
+  802c14:	49 bb 23 54 00 00 00 	movabs $0x5423,%r11
+  802c1b:	00 00 00 
+  802c1e:	4c 01 db             	add    %r11,%rbx
+  802c21:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802c24:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802c28:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802c2c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802c30:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802c33:	48 89 d6             	mov    %rdx,%rsi
+  802c36:	89 c7                	mov    %eax,%edi
+  802c38:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  802c3f:	ff ff ff 
+  802c42:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c46:	ff d0                	call   *%rax
+  802c48:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c4b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c4f:	78 28                	js     802c79 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802c51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c55:	8b 00                	mov    (%rax),%eax
+  802c57:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802c5b:	48 89 d6             	mov    %rdx,%rsi
+  802c5e:	89 c7                	mov    %eax,%edi
+  802c60:	48 b8 31 a8 ff ff ff 	movabs $0xffffffffffffa831,%rax
+  802c67:	ff ff ff 
+  802c6a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c6e:	ff d0                	call   *%rax
+  802c70:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c73:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c77:	79 08                	jns    802c81 <read+0x7f>
+		return r;
+  802c79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c7c:	e9 8b 00 00 00       	jmp    802d0c <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802c81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c85:	8b 40 08             	mov    0x8(%rax),%eax
+  802c88:	83 e0 03             	and    $0x3,%eax
+  802c8b:	83 f8 01             	cmp    $0x1,%eax
+  802c8e:	75 4b                	jne    802cdb <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802c90:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802c97:	ff ff ff 
+  802c9a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c9e:	48 8b 00             	mov    (%rax),%rax
+  802ca1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802ca7:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802caa:	89 c6                	mov    %eax,%esi
+  802cac:	48 b8 cf e2 ff ff ff 	movabs $0xffffffffffffe2cf,%rax
+  802cb3:	ff ff ff 
+  802cb6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cba:	48 89 c7             	mov    %rax,%rdi
+  802cbd:	49 89 df             	mov    %rbx,%r15
+  802cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc5:	48 b9 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rcx
+  802ccc:	ff ff ff 
+  802ccf:	48 01 d9             	add    %rbx,%rcx
+  802cd2:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802cd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cd9:	eb 31                	jmp    802d0c <read+0x10a>
+	}
+	if (!dev->dev_read)
+  802cdb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cdf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802ce3:	48 85 c0             	test   %rax,%rax
+  802ce6:	75 07                	jne    802cef <read+0xed>
+		return -E_NOT_SUPP;
+  802ce8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802ced:	eb 1d                	jmp    802d0c <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  802cef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cf3:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802cf7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cfb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802cff:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802d03:	48 89 ce             	mov    %rcx,%rsi
+  802d06:	48 89 c7             	mov    %rax,%rdi
+  802d09:	41 ff d0             	call   *%r8
+}
+  802d0c:	48 83 c4 40          	add    $0x40,%rsp
+  802d10:	5b                   	pop    %rbx
+  802d11:	41 5f                	pop    %r15
+  802d13:	5d                   	pop    %rbp
+  802d14:	c3                   	ret
+
+0000000000802d15 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802d15:	55                   	push   %rbp
+  802d16:	48 89 e5             	mov    %rsp,%rbp
+  802d19:	53                   	push   %rbx
+  802d1a:	48 83 ec 38          	sub    $0x38,%rsp
+  802d1e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d1e <readn+0x9>
+  802d25:	49 bb 12 53 00 00 00 	movabs $0x5312,%r11
+  802d2c:	00 00 00 
+  802d2f:	4c 01 db             	add    %r11,%rbx
+  802d32:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d35:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802d39:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802d3d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802d44:	eb 4b                	jmp    802d91 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802d46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d49:	48 98                	cltq
+  802d4b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802d4f:	48 29 c2             	sub    %rax,%rdx
+  802d52:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d55:	48 63 c8             	movslq %eax,%rcx
+  802d58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d5c:	48 01 c1             	add    %rax,%rcx
+  802d5f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d62:	48 89 ce             	mov    %rcx,%rsi
+  802d65:	89 c7                	mov    %eax,%edi
+  802d67:	48 b8 d2 ab ff ff ff 	movabs $0xffffffffffffabd2,%rax
+  802d6e:	ff ff ff 
+  802d71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d75:	ff d0                	call   *%rax
+  802d77:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  802d7a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802d7e:	79 05                	jns    802d85 <readn+0x70>
+			return m;
+  802d80:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802d83:	eb 1d                	jmp    802da2 <readn+0x8d>
+		if (m == 0)
+  802d85:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802d89:	74 13                	je     802d9e <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  802d8b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802d8e:	01 45 ec             	add    %eax,-0x14(%rbp)
+  802d91:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d94:	48 98                	cltq
+  802d96:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  802d9a:	72 aa                	jb     802d46 <readn+0x31>
+  802d9c:	eb 01                	jmp    802d9f <readn+0x8a>
+			break;
+  802d9e:	90                   	nop
+	}
+	return tot;
+  802d9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802da2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da6:	c9                   	leave
+  802da7:	c3                   	ret
+
+0000000000802da8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802da8:	55                   	push   %rbp
+  802da9:	48 89 e5             	mov    %rsp,%rbp
+  802dac:	41 57                	push   %r15
+  802dae:	53                   	push   %rbx
+  802daf:	48 83 ec 40          	sub    $0x40,%rsp
+  802db3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802db3 <write+0xb>
+  802dba:	49 bb 7d 52 00 00 00 	movabs $0x527d,%r11
+  802dc1:	00 00 00 
+  802dc4:	4c 01 db             	add    %r11,%rbx
+  802dc7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802dca:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802dce:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802dd2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802dd6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802dd9:	48 89 d6             	mov    %rdx,%rsi
+  802ddc:	89 c7                	mov    %eax,%edi
+  802dde:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  802de5:	ff ff ff 
+  802de8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dec:	ff d0                	call   *%rax
+  802dee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802df1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802df5:	78 28                	js     802e1f <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802df7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802dfb:	8b 00                	mov    (%rax),%eax
+  802dfd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802e01:	48 89 d6             	mov    %rdx,%rsi
+  802e04:	89 c7                	mov    %eax,%edi
+  802e06:	48 b8 31 a8 ff ff ff 	movabs $0xffffffffffffa831,%rax
+  802e0d:	ff ff ff 
+  802e10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e14:	ff d0                	call   *%rax
+  802e16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e19:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e1d:	79 08                	jns    802e27 <write+0x7f>
+		return r;
+  802e1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e22:	e9 8a 00 00 00       	jmp    802eb1 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802e27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e2b:	8b 40 08             	mov    0x8(%rax),%eax
+  802e2e:	83 e0 03             	and    $0x3,%eax
+  802e31:	85 c0                	test   %eax,%eax
+  802e33:	75 4b                	jne    802e80 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802e35:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802e3c:	ff ff ff 
+  802e3f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e43:	48 8b 00             	mov    (%rax),%rax
+  802e46:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802e4c:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802e4f:	89 c6                	mov    %eax,%esi
+  802e51:	48 b8 eb e2 ff ff ff 	movabs $0xffffffffffffe2eb,%rax
+  802e58:	ff ff ff 
+  802e5b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e5f:	48 89 c7             	mov    %rax,%rdi
+  802e62:	49 89 df             	mov    %rbx,%r15
+  802e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e6a:	48 b9 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rcx
+  802e71:	ff ff ff 
+  802e74:	48 01 d9             	add    %rbx,%rcx
+  802e77:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802e79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e7e:	eb 31                	jmp    802eb1 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802e80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e84:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802e88:	48 85 c0             	test   %rax,%rax
+  802e8b:	75 07                	jne    802e94 <write+0xec>
+		return -E_NOT_SUPP;
+  802e8d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802e92:	eb 1d                	jmp    802eb1 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  802e94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e98:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  802e9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ea0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802ea4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ea8:	48 89 ce             	mov    %rcx,%rsi
+  802eab:	48 89 c7             	mov    %rax,%rdi
+  802eae:	41 ff d0             	call   *%r8
+}
+  802eb1:	48 83 c4 40          	add    $0x40,%rsp
+  802eb5:	5b                   	pop    %rbx
+  802eb6:	41 5f                	pop    %r15
+  802eb8:	5d                   	pop    %rbp
+  802eb9:	c3                   	ret
+
+0000000000802eba <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802eba:	55                   	push   %rbp
+  802ebb:	48 89 e5             	mov    %rsp,%rbp
+  802ebe:	48 83 ec 18          	sub    $0x18,%rsp
+  802ec2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ec2 <seek+0x8>
+  802ec9:	49 bb 6e 51 00 00 00 	movabs $0x516e,%r11
+  802ed0:	00 00 00 
+  802ed3:	4c 01 d8             	add    %r11,%rax
+  802ed6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ed9:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802edc:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  802ee0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ee3:	48 89 ce             	mov    %rcx,%rsi
+  802ee6:	89 d7                	mov    %edx,%edi
+  802ee8:	48 ba 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rdx
+  802eef:	ff ff ff 
+  802ef2:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802ef6:	ff d0                	call   *%rax
+  802ef8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802efb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802eff:	79 05                	jns    802f06 <seek+0x4c>
+		return r;
+  802f01:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f04:	eb 0f                	jmp    802f15 <seek+0x5b>
+	fd->fd_offset = offset;
+  802f06:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f0a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802f0d:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  802f10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f15:	c9                   	leave
+  802f16:	c3                   	ret
+
+0000000000802f17 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802f17:	55                   	push   %rbp
+  802f18:	48 89 e5             	mov    %rsp,%rbp
+  802f1b:	41 57                	push   %r15
+  802f1d:	53                   	push   %rbx
+  802f1e:	48 83 ec 30          	sub    $0x30,%rsp
+  802f22:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f22 <ftruncate+0xb>
+  802f29:	49 bb 0e 51 00 00 00 	movabs $0x510e,%r11
+  802f30:	00 00 00 
+  802f33:	4c 01 db             	add    %r11,%rbx
+  802f36:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802f39:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802f3c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802f40:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802f43:	48 89 d6             	mov    %rdx,%rsi
+  802f46:	89 c7                	mov    %eax,%edi
+  802f48:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  802f4f:	ff ff ff 
+  802f52:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f56:	ff d0                	call   *%rax
+  802f58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f5f:	78 28                	js     802f89 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802f61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f65:	8b 00                	mov    (%rax),%eax
+  802f67:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802f6b:	48 89 d6             	mov    %rdx,%rsi
+  802f6e:	89 c7                	mov    %eax,%edi
+  802f70:	48 b8 31 a8 ff ff ff 	movabs $0xffffffffffffa831,%rax
+  802f77:	ff ff ff 
+  802f7a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f7e:	ff d0                	call   *%rax
+  802f80:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f83:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f87:	79 08                	jns    802f91 <ftruncate+0x7a>
+		return r;
+  802f89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f8c:	e9 83 00 00 00       	jmp    803014 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802f91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f95:	8b 40 08             	mov    0x8(%rax),%eax
+  802f98:	83 e0 03             	and    $0x3,%eax
+  802f9b:	85 c0                	test   %eax,%eax
+  802f9d:	75 4b                	jne    802fea <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  802f9f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802fa6:	ff ff ff 
+  802fa9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fad:	48 8b 00             	mov    (%rax),%rax
+  802fb0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802fb6:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802fb9:	89 c6                	mov    %eax,%esi
+  802fbb:	48 b8 08 e3 ff ff ff 	movabs $0xffffffffffffe308,%rax
+  802fc2:	ff ff ff 
+  802fc5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fc9:	48 89 c7             	mov    %rax,%rdi
+  802fcc:	49 89 df             	mov    %rbx,%r15
+  802fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd4:	48 b9 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rcx
+  802fdb:	ff ff ff 
+  802fde:	48 01 d9             	add    %rbx,%rcx
+  802fe1:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802fe3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fe8:	eb 2a                	jmp    803014 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  802fea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fee:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802ff2:	48 85 c0             	test   %rax,%rax
+  802ff5:	75 07                	jne    802ffe <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  802ff7:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802ffc:	eb 16                	jmp    803014 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  802ffe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803002:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803006:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80300a:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80300d:	89 d6                	mov    %edx,%esi
+  80300f:	48 89 c7             	mov    %rax,%rdi
+  803012:	ff d1                	call   *%rcx
+}
+  803014:	48 83 c4 30          	add    $0x30,%rsp
+  803018:	5b                   	pop    %rbx
+  803019:	41 5f                	pop    %r15
+  80301b:	5d                   	pop    %rbp
+  80301c:	c3                   	ret
+
+000000000080301d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80301d:	55                   	push   %rbp
+  80301e:	48 89 e5             	mov    %rsp,%rbp
+  803021:	53                   	push   %rbx
+  803022:	48 83 ec 38          	sub    $0x38,%rsp
+  803026:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803026 <fstat+0x9>
+  80302d:	49 bb 0a 50 00 00 00 	movabs $0x500a,%r11
+  803034:	00 00 00 
+  803037:	4c 01 db             	add    %r11,%rbx
+  80303a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80303d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803041:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803045:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803048:	48 89 d6             	mov    %rdx,%rsi
+  80304b:	89 c7                	mov    %eax,%edi
+  80304d:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  803054:	ff ff ff 
+  803057:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80305b:	ff d0                	call   *%rax
+  80305d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803060:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803064:	78 28                	js     80308e <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803066:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80306a:	8b 00                	mov    (%rax),%eax
+  80306c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803070:	48 89 d6             	mov    %rdx,%rsi
+  803073:	89 c7                	mov    %eax,%edi
+  803075:	48 b8 31 a8 ff ff ff 	movabs $0xffffffffffffa831,%rax
+  80307c:	ff ff ff 
+  80307f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803083:	ff d0                	call   *%rax
+  803085:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803088:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80308c:	79 05                	jns    803093 <fstat+0x76>
+		return r;
+  80308e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803091:	eb 5e                	jmp    8030f1 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803093:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803097:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80309b:	48 85 c0             	test   %rax,%rax
+  80309e:	75 07                	jne    8030a7 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8030a0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030a5:	eb 4a                	jmp    8030f1 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8030a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030ab:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8030ae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030b2:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8030b9:	00 00 00 
+	stat->st_isdir = 0;
+  8030bc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030c0:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8030c7:	00 00 00 
+	stat->st_dev = dev;
+  8030ca:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8030ce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8030d2:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8030d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030dd:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8030e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8030e9:	48 89 d6             	mov    %rdx,%rsi
+  8030ec:	48 89 c7             	mov    %rax,%rdi
+  8030ef:	ff d1                	call   *%rcx
+}
+  8030f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030f5:	c9                   	leave
+  8030f6:	c3                   	ret
+
+00000000008030f7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8030f7:	55                   	push   %rbp
+  8030f8:	48 89 e5             	mov    %rsp,%rbp
+  8030fb:	41 57                	push   %r15
+  8030fd:	53                   	push   %rbx
+  8030fe:	48 83 ec 20          	sub    $0x20,%rsp
+  803102:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803102 <stat+0xb>
+  803109:	49 bb 2e 4f 00 00 00 	movabs $0x4f2e,%r11
+  803110:	00 00 00 
+  803113:	4c 01 db             	add    %r11,%rbx
+  803116:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80311a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80311e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803122:	be 00 00 00 00       	mov    $0x0,%esi
+  803127:	48 89 c7             	mov    %rax,%rdi
+  80312a:	49 89 df             	mov    %rbx,%r15
+  80312d:	48 b8 a1 b3 ff ff ff 	movabs $0xffffffffffffb3a1,%rax
+  803134:	ff ff ff 
+  803137:	48 01 d8             	add    %rbx,%rax
+  80313a:	ff d0                	call   *%rax
+  80313c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80313f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803143:	79 05                	jns    80314a <stat+0x53>
+		return fd;
+  803145:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803148:	eb 37                	jmp    803181 <stat+0x8a>
+	r = fstat(fd, stat);
+  80314a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80314e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803151:	48 89 d6             	mov    %rdx,%rsi
+  803154:	89 c7                	mov    %eax,%edi
+  803156:	48 b8 ed af ff ff ff 	movabs $0xffffffffffffafed,%rax
+  80315d:	ff ff ff 
+  803160:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803164:	ff d0                	call   *%rax
+  803166:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803169:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80316c:	89 c7                	mov    %eax,%edi
+  80316e:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  803175:	ff ff ff 
+  803178:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80317c:	ff d0                	call   *%rax
+	return r;
+  80317e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803181:	48 83 c4 20          	add    $0x20,%rsp
+  803185:	5b                   	pop    %rbx
+  803186:	41 5f                	pop    %r15
+  803188:	5d                   	pop    %rbp
+  803189:	c3                   	ret
+
+000000000080318a <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80318a:	55                   	push   %rbp
+  80318b:	48 89 e5             	mov    %rsp,%rbp
+  80318e:	41 57                	push   %r15
+  803190:	53                   	push   %rbx
+  803191:	48 83 ec 10          	sub    $0x10,%rsp
+  803195:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803195 <fsipc+0xb>
+  80319c:	49 bb 9b 4e 00 00 00 	movabs $0x4e9b,%r11
+  8031a3:	00 00 00 
+  8031a6:	4c 01 db             	add    %r11,%rbx
+  8031a9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031ac:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8031b0:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8031b7:	00 00 00 
+  8031ba:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8031bd:	85 c0                	test   %eax,%eax
+  8031bf:	75 24                	jne    8031e5 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8031c1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8031c6:	49 89 df             	mov    %rbx,%r15
+  8031c9:	48 b8 fa dc ff ff ff 	movabs $0xffffffffffffdcfa,%rax
+  8031d0:	ff ff ff 
+  8031d3:	48 01 d8             	add    %rbx,%rax
+  8031d6:	ff d0                	call   *%rax
+  8031d8:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8031df:	00 00 00 
+  8031e2:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8031e5:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8031ec:	00 00 00 
+  8031ef:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8031f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8031f6:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8031f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8031ff:	49 89 d0             	mov    %rdx,%r8
+  803202:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803207:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  80320e:	00 00 00 
+  803211:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803215:	89 c7                	mov    %eax,%edi
+  803217:	49 89 df             	mov    %rbx,%r15
+  80321a:	48 b8 19 d7 ff ff ff 	movabs $0xffffffffffffd719,%rax
+  803221:	ff ff ff 
+  803224:	48 01 d8             	add    %rbx,%rax
+  803227:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803229:	48 83 c4 10          	add    $0x10,%rsp
+  80322d:	5b                   	pop    %rbx
+  80322e:	41 5f                	pop    %r15
+  803230:	5d                   	pop    %rbp
+  803231:	c3                   	ret
+
+0000000000803232 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803232:	55                   	push   %rbp
+  803233:	48 89 e5             	mov    %rsp,%rbp
+  803236:	41 57                	push   %r15
+  803238:	53                   	push   %rbx
+  803239:	48 83 ec 20          	sub    $0x20,%rsp
+  80323d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80323d <fsipc_words+0xb>
+  803244:	49 bb f3 4d 00 00 00 	movabs $0x4df3,%r11
+  80324b:	00 00 00 
+  80324e:	4c 01 db             	add    %r11,%rbx
+  803251:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803254:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803258:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80325c:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803263:	00 00 00 
+  803266:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803269:	85 c0                	test   %eax,%eax
+  80326b:	75 24                	jne    803291 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80326d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803272:	49 89 df             	mov    %rbx,%r15
+  803275:	48 b8 fa dc ff ff ff 	movabs $0xffffffffffffdcfa,%rax
+  80327c:	ff ff ff 
+  80327f:	48 01 d8             	add    %rbx,%rax
+  803282:	ff d0                	call   *%rax
+  803284:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  80328b:	00 00 00 
+  80328e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803291:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803298:	00 00 00 
+  80329b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80329e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8032a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8032a6:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8032a9:	89 c7                	mov    %eax,%edi
+  8032ab:	49 89 df             	mov    %rbx,%r15
+  8032ae:	48 b8 04 d8 ff ff ff 	movabs $0xffffffffffffd804,%rax
+  8032b5:	ff ff ff 
+  8032b8:	48 01 d8             	add    %rbx,%rax
+  8032bb:	ff d0                	call   *%rax
+}
+  8032bd:	48 83 c4 20          	add    $0x20,%rsp
+  8032c1:	5b                   	pop    %rbx
+  8032c2:	41 5f                	pop    %r15
+  8032c4:	5d                   	pop    %rbp
+  8032c5:	c3                   	ret
+
+00000000008032c6 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8032c6:	55                   	push   %rbp
+  8032c7:	48 89 e5             	mov    %rsp,%rbp
+  8032ca:	41 57                	push   %r15
+  8032cc:	53                   	push   %rbx
+  8032cd:	48 83 ec 40          	sub    $0x40,%rsp
+  8032d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032d1 <fsipc_pages+0xb>
+  8032d8:	49 bb 5f 4d 00 00 00 	movabs $0x4d5f,%r11
+  8032df:	00 00 00 
+  8032e2:	4c 01 db             	add    %r11,%rbx
+  8032e5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8032e8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8032ec:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8032f0:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8032f3:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8032fa:	00 00 00 
+  8032fd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803300:	85 c0                	test   %eax,%eax
+  803302:	75 24                	jne    803328 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803304:	bf 01 00 00 00       	mov    $0x1,%edi
+  803309:	49 89 df             	mov    %rbx,%r15
+  80330c:	48 b8 fa dc ff ff ff 	movabs $0xffffffffffffdcfa,%rax
+  803313:	ff ff ff 
+  803316:	48 01 d8             	add    %rbx,%rax
+  803319:	ff d0                	call   *%rax
+  80331b:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803322:	00 00 00 
+  803325:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803328:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80332d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803331:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803334:	48 98                	cltq
+  803336:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80333a:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80333e:	0f 95 c0             	setne  %al
+  803341:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803344:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80334b:	00 
+  80334c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803350:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803354:	48 01 d0             	add    %rdx,%rax
+  803357:	48 83 e8 01          	sub    $0x1,%rax
+  80335b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80335f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803363:	ba 00 00 00 00       	mov    $0x0,%edx
+  803368:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80336c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803370:	48 29 d0             	sub    %rdx,%rax
+  803373:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803377:	41 89 c2             	mov    %eax,%r10d
+  80337a:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803381:	00 00 00 
+  803384:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803387:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80338b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80338f:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803392:	48 83 ec 08          	sub    $0x8,%rsp
+  803396:	6a 40                	push   $0x40
+  803398:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  80339d:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8033a4:	00 
+  8033a5:	6a 05                	push   $0x5
+  8033a7:	41 89 f9             	mov    %edi,%r9d
+  8033aa:	49 89 c8             	mov    %rcx,%r8
+  8033ad:	44 89 d1             	mov    %r10d,%ecx
+  8033b0:	89 c7                	mov    %eax,%edi
+  8033b2:	49 89 df             	mov    %rbx,%r15
+  8033b5:	48 b8 02 d9 ff ff ff 	movabs $0xffffffffffffd902,%rax
+  8033bc:	ff ff ff 
+  8033bf:	48 01 d8             	add    %rbx,%rax
+  8033c2:	ff d0                	call   *%rax
+  8033c4:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8033c8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8033cc:	5b                   	pop    %rbx
+  8033cd:	41 5f                	pop    %r15
+  8033cf:	5d                   	pop    %rbp
+  8033d0:	c3                   	ret
+
+00000000008033d1 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8033d1:	55                   	push   %rbp
+  8033d2:	48 89 e5             	mov    %rsp,%rbp
+  8033d5:	41 57                	push   %r15
+  8033d7:	53                   	push   %rbx
+  8033d8:	48 83 ec 20          	sub    $0x20,%rsp
+  8033dc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033dc <open+0xb>
+  8033e3:	49 bb 54 4c 00 00 00 	movabs $0x4c54,%r11
+  8033ea:	00 00 00 
+  8033ed:	4c 01 db             	add    %r11,%rbx
+  8033f0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8033f4:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8033f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033fb:	48 89 c7             	mov    %rax,%rdi
+  8033fe:	49 89 df             	mov    %rbx,%r15
+  803401:	48 b8 62 90 ff ff ff 	movabs $0xffffffffffff9062,%rax
+  803408:	ff ff ff 
+  80340b:	48 01 d8             	add    %rbx,%rax
+  80340e:	ff d0                	call   *%rax
+  803410:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803415:	7e 0a                	jle    803421 <open+0x50>
+		return -E_BAD_PATH;
+  803417:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80341c:	e9 18 01 00 00       	jmp    803539 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803421:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803425:	48 89 c7             	mov    %rax,%rdi
+  803428:	49 89 df             	mov    %rbx,%r15
+  80342b:	48 b8 d5 a5 ff ff ff 	movabs $0xffffffffffffa5d5,%rax
+  803432:	ff ff ff 
+  803435:	48 01 d8             	add    %rbx,%rax
+  803438:	ff d0                	call   *%rax
+  80343a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80343d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803441:	74 08                	je     80344b <open+0x7a>
+		return r;
+  803443:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803446:	e9 ee 00 00 00       	jmp    803539 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80344b:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803452:	00 00 00 
+  803455:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803458:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80345f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803463:	48 89 c6             	mov    %rax,%rsi
+  803466:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80346d:	00 00 00 
+  803470:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803474:	48 89 c7             	mov    %rax,%rdi
+  803477:	49 89 df             	mov    %rbx,%r15
+  80347a:	48 b8 f6 90 ff ff ff 	movabs $0xffffffffffff90f6,%rax
+  803481:	ff ff ff 
+  803484:	48 01 d8             	add    %rbx,%rax
+  803487:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803489:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80348d:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803492:	48 89 c6             	mov    %rax,%rsi
+  803495:	bf 00 00 00 00       	mov    $0x0,%edi
+  80349a:	49 89 df             	mov    %rbx,%r15
+  80349d:	48 b8 b2 9d ff ff ff 	movabs $0xffffffffffff9db2,%rax
+  8034a4:	ff ff ff 
+  8034a7:	48 01 d8             	add    %rbx,%rax
+  8034aa:	ff d0                	call   *%rax
+  8034ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034b3:	74 23                	je     8034d8 <open+0x107>
+		fd_close(fd,0);
+  8034b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8034be:	48 89 c7             	mov    %rax,%rdi
+  8034c1:	49 89 df             	mov    %rbx,%r15
+  8034c4:	48 b8 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rax
+  8034cb:	ff ff ff 
+  8034ce:	48 01 d8             	add    %rbx,%rax
+  8034d1:	ff d0                	call   *%rax
+		return r;
+  8034d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034d6:	eb 61                	jmp    803539 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8034d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034dc:	48 89 c6             	mov    %rax,%rsi
+  8034df:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034e4:	48 b8 5a b1 ff ff ff 	movabs $0xffffffffffffb15a,%rax
+  8034eb:	ff ff ff 
+  8034ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034f2:	ff d0                	call   *%rax
+  8034f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034fb:	74 23                	je     803520 <open+0x14f>
+		fd_close(fd,0);
+  8034fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803501:	be 00 00 00 00       	mov    $0x0,%esi
+  803506:	48 89 c7             	mov    %rax,%rdi
+  803509:	49 89 df             	mov    %rbx,%r15
+  80350c:	48 b8 36 a7 ff ff ff 	movabs $0xffffffffffffa736,%rax
+  803513:	ff ff ff 
+  803516:	48 01 d8             	add    %rbx,%rax
+  803519:	ff d0                	call   *%rax
+		return r;
+  80351b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80351e:	eb 19                	jmp    803539 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803520:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803524:	48 89 c7             	mov    %rax,%rdi
+  803527:	49 89 df             	mov    %rbx,%r15
+  80352a:	48 b8 5b a5 ff ff ff 	movabs $0xffffffffffffa55b,%rax
+  803531:	ff ff ff 
+  803534:	48 01 d8             	add    %rbx,%rax
+  803537:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  803539:	48 83 c4 20          	add    $0x20,%rsp
+  80353d:	5b                   	pop    %rbx
+  80353e:	41 5f                	pop    %r15
+  803540:	5d                   	pop    %rbp
+  803541:	c3                   	ret
+
+0000000000803542 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803542:	55                   	push   %rbp
+  803543:	48 89 e5             	mov    %rsp,%rbp
+  803546:	48 83 ec 20          	sub    $0x20,%rsp
+  80354a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80354a <devfile_flush+0x8>
+  803551:	49 bb e6 4a 00 00 00 	movabs $0x4ae6,%r11
+  803558:	00 00 00 
+  80355b:	4c 01 d8             	add    %r11,%rax
+  80355e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803562:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803566:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803569:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  80356c:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803570:	ba 04 00 00 00       	mov    $0x4,%edx
+  803575:	48 89 ce             	mov    %rcx,%rsi
+  803578:	bf 06 00 00 00       	mov    $0x6,%edi
+  80357d:	48 b9 02 b2 ff ff ff 	movabs $0xffffffffffffb202,%rcx
+  803584:	ff ff ff 
+  803587:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80358b:	ff d0                	call   *%rax
+}
+  80358d:	c9                   	leave
+  80358e:	c3                   	ret
+
+000000000080358f <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  80358f:	55                   	push   %rbp
+  803590:	48 89 e5             	mov    %rsp,%rbp
+  803593:	41 57                	push   %r15
+  803595:	53                   	push   %rbx
+  803596:	48 83 ec 60          	sub    $0x60,%rsp
+  80359a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80359a <devfile_read+0xb>
+  8035a1:	49 bb 96 4a 00 00 00 	movabs $0x4a96,%r11
+  8035a8:	00 00 00 
+  8035ab:	4c 01 db             	add    %r11,%rbx
+  8035ae:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8035b2:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8035b6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  8035ba:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8035be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  8035c2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8035c6:	8b 50 0c             	mov    0xc(%rax),%edx
+  8035c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035cd:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8035cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035d3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8035d7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8035db:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8035df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035e4:	ba 10 00 00 00       	mov    $0x10,%edx
+  8035e9:	48 89 c6             	mov    %rax,%rsi
+  8035ec:	bf 03 00 00 00       	mov    $0x3,%edi
+  8035f1:	48 b8 96 b2 ff ff ff 	movabs $0xffffffffffffb296,%rax
+  8035f8:	ff ff ff 
+  8035fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035ff:	ff d0                	call   *%rax
+  803601:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803604:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803608:	79 05                	jns    80360f <devfile_read+0x80>
+		return r;
+  80360a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80360d:	eb 64                	jmp    803673 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  80360f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803612:	48 63 d0             	movslq %eax,%rdx
+  803615:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803619:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  80361e:	48 01 c1             	add    %rax,%rcx
+  803621:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803625:	48 89 ce             	mov    %rcx,%rsi
+  803628:	48 89 c7             	mov    %rax,%rdi
+  80362b:	49 89 df             	mov    %rbx,%r15
+  80362e:	48 b8 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rax
+  803635:	ff ff ff 
+  803638:	48 01 d8             	add    %rbx,%rax
+  80363b:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  80363d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803644:	ff ff ff 
+  803647:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80364b:	48 8b 00             	mov    (%rax),%rax
+  80364e:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803654:	89 c6                	mov    %eax,%esi
+  803656:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  80365b:	48 89 c7             	mov    %rax,%rdi
+  80365e:	49 89 df             	mov    %rbx,%r15
+  803661:	48 b8 b4 dc ff ff ff 	movabs $0xffffffffffffdcb4,%rax
+  803668:	ff ff ff 
+  80366b:	48 01 d8             	add    %rbx,%rax
+  80366e:	ff d0                	call   *%rax
+	return r;
+  803670:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803673:	48 83 c4 60          	add    $0x60,%rsp
+  803677:	5b                   	pop    %rbx
+  803678:	41 5f                	pop    %r15
+  80367a:	5d                   	pop    %rbp
+  80367b:	c3                   	ret
+
+000000000080367c <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80367c:	55                   	push   %rbp
+  80367d:	48 89 e5             	mov    %rsp,%rbp
+  803680:	41 57                	push   %r15
+  803682:	53                   	push   %rbx
+  803683:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803687:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803687 <devfile_write+0xb>
+  80368e:	49 bb a9 49 00 00 00 	movabs $0x49a9,%r11
+  803695:	00 00 00 
+  803698:	4c 01 db             	add    %r11,%rbx
+  80369b:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80369f:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  8036a3:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  8036aa:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8036ae:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  8036b2:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  8036b9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8036bd:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  8036c4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8036c7:	48 63 d0             	movslq %eax,%rdx
+  8036ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036ce:	48 39 c2             	cmp    %rax,%rdx
+  8036d1:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8036d5:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8036dc:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  8036e3:	00 
+  8036e4:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8036eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036ef:	48 01 d0             	add    %rdx,%rax
+  8036f2:	48 83 e8 01          	sub    $0x1,%rax
+  8036f6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8036fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803703:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803707:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80370b:	48 29 d0             	sub    %rdx,%rax
+  80370e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803712:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803715:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803718:	89 c6                	mov    %eax,%esi
+  80371a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80371f:	48 89 c7             	mov    %rax,%rdi
+  803722:	49 89 df             	mov    %rbx,%r15
+  803725:	48 b8 6e dc ff ff ff 	movabs $0xffffffffffffdc6e,%rax
+  80372c:	ff ff ff 
+  80372f:	48 01 d8             	add    %rbx,%rax
+  803732:	ff d0                	call   *%rax
+  803734:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803737:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  80373b:	79 08                	jns    803745 <devfile_write+0xc9>
+		return r;
+  80373d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803740:	e9 8f 00 00 00       	jmp    8037d4 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803745:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80374c:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803750:	48 89 c6             	mov    %rax,%rsi
+  803753:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803758:	48 89 c7             	mov    %rax,%rdi
+  80375b:	49 89 df             	mov    %rbx,%r15
+  80375e:	48 b8 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rax
+  803765:	ff ff ff 
+  803768:	48 01 d8             	add    %rbx,%rax
+  80376b:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  80376d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803771:	8b 50 0c             	mov    0xc(%rax),%edx
+  803774:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803778:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80377a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80377e:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803785:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803789:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80378c:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803790:	89 d1                	mov    %edx,%ecx
+  803792:	ba 10 00 00 00       	mov    $0x10,%edx
+  803797:	48 89 c6             	mov    %rax,%rsi
+  80379a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80379f:	48 b8 96 b2 ff ff ff 	movabs $0xffffffffffffb296,%rax
+  8037a6:	ff ff ff 
+  8037a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037ad:	ff d0                	call   *%rax
+  8037af:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  8037b2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8037b5:	89 c6                	mov    %eax,%esi
+  8037b7:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8037bc:	48 89 c7             	mov    %rax,%rdi
+  8037bf:	49 89 df             	mov    %rbx,%r15
+  8037c2:	48 b8 b4 dc ff ff ff 	movabs $0xffffffffffffdcb4,%rax
+  8037c9:	ff ff ff 
+  8037cc:	48 01 d8             	add    %rbx,%rax
+  8037cf:	ff d0                	call   *%rax
+	return r;
+  8037d1:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  8037d4:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  8037d8:	5b                   	pop    %rbx
+  8037d9:	41 5f                	pop    %r15
+  8037db:	5d                   	pop    %rbp
+  8037dc:	c3                   	ret
+
+00000000008037dd <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  8037dd:	55                   	push   %rbp
+  8037de:	48 89 e5             	mov    %rsp,%rbp
+  8037e1:	41 57                	push   %r15
+  8037e3:	53                   	push   %rbx
+  8037e4:	48 83 ec 20          	sub    $0x20,%rsp
+  8037e8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037e8 <devfile_stat+0xb>
+  8037ef:	49 bb 48 48 00 00 00 	movabs $0x4848,%r11
+  8037f6:	00 00 00 
+  8037f9:	4c 01 db             	add    %r11,%rbx
+  8037fc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803800:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803804:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803808:	8b 40 0c             	mov    0xc(%rax),%eax
+  80380b:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803812:	00 00 00 
+  803815:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803818:	be 00 00 00 00       	mov    $0x0,%esi
+  80381d:	bf 05 00 00 00       	mov    $0x5,%edi
+  803822:	48 b8 5a b1 ff ff ff 	movabs $0xffffffffffffb15a,%rax
+  803829:	ff ff ff 
+  80382c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803830:	ff d0                	call   *%rax
+  803832:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803835:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803839:	79 05                	jns    803840 <devfile_stat+0x63>
+		return r;
+  80383b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80383e:	eb 65                	jmp    8038a5 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803840:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803844:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  80384b:	00 00 00 
+  80384e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803852:	48 89 d6             	mov    %rdx,%rsi
+  803855:	48 89 c7             	mov    %rax,%rdi
+  803858:	49 89 df             	mov    %rbx,%r15
+  80385b:	48 b8 f6 90 ff ff ff 	movabs $0xffffffffffff90f6,%rax
+  803862:	ff ff ff 
+  803865:	48 01 d8             	add    %rbx,%rax
+  803868:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80386a:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803871:	00 00 00 
+  803874:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  80387b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80387f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803885:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80388c:	00 00 00 
+  80388f:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803896:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80389a:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  8038a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038a5:	48 83 c4 20          	add    $0x20,%rsp
+  8038a9:	5b                   	pop    %rbx
+  8038aa:	41 5f                	pop    %r15
+  8038ac:	5d                   	pop    %rbp
+  8038ad:	c3                   	ret
+
+00000000008038ae <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8038ae:	55                   	push   %rbp
+  8038af:	48 89 e5             	mov    %rsp,%rbp
+  8038b2:	48 83 ec 20          	sub    $0x20,%rsp
+  8038b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038b6 <devfile_trunc+0x8>
+  8038bd:	49 bb 7a 47 00 00 00 	movabs $0x477a,%r11
+  8038c4:	00 00 00 
+  8038c7:	4c 01 d8             	add    %r11,%rax
+  8038ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8038ce:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  8038d1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8038d5:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8038d8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  8038db:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8038de:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8038e1:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8038e5:	ba 08 00 00 00       	mov    $0x8,%edx
+  8038ea:	48 89 ce             	mov    %rcx,%rsi
+  8038ed:	bf 02 00 00 00       	mov    $0x2,%edi
+  8038f2:	48 b9 02 b2 ff ff ff 	movabs $0xffffffffffffb202,%rcx
+  8038f9:	ff ff ff 
+  8038fc:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803900:	ff d0                	call   *%rax
+}
+  803902:	c9                   	leave
+  803903:	c3                   	ret
+
+0000000000803904 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803904:	55                   	push   %rbp
+  803905:	48 89 e5             	mov    %rsp,%rbp
+  803908:	41 57                	push   %r15
+  80390a:	53                   	push   %rbx
+  80390b:	48 83 ec 10          	sub    $0x10,%rsp
+  80390f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80390f <remove+0xb>
+  803916:	49 bb 21 47 00 00 00 	movabs $0x4721,%r11
+  80391d:	00 00 00 
+  803920:	4c 01 db             	add    %r11,%rbx
+  803923:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803927:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80392b:	48 89 c7             	mov    %rax,%rdi
+  80392e:	49 89 df             	mov    %rbx,%r15
+  803931:	48 b8 62 90 ff ff ff 	movabs $0xffffffffffff9062,%rax
+  803938:	ff ff ff 
+  80393b:	48 01 d8             	add    %rbx,%rax
+  80393e:	ff d0                	call   *%rax
+  803940:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803945:	7e 07                	jle    80394e <remove+0x4a>
+		return -E_BAD_PATH;
+  803947:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80394c:	eb 44                	jmp    803992 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80394e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803952:	48 89 c6             	mov    %rax,%rsi
+  803955:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80395c:	00 00 00 
+  80395f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803963:	48 89 c7             	mov    %rax,%rdi
+  803966:	49 89 df             	mov    %rbx,%r15
+  803969:	48 b8 f6 90 ff ff ff 	movabs $0xffffffffffff90f6,%rax
+  803970:	ff ff ff 
+  803973:	48 01 d8             	add    %rbx,%rax
+  803976:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803978:	be 00 00 00 00       	mov    $0x0,%esi
+  80397d:	bf 07 00 00 00       	mov    $0x7,%edi
+  803982:	48 b8 5a b1 ff ff ff 	movabs $0xffffffffffffb15a,%rax
+  803989:	ff ff ff 
+  80398c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803990:	ff d0                	call   *%rax
+}
+  803992:	48 83 c4 10          	add    $0x10,%rsp
+  803996:	5b                   	pop    %rbx
+  803997:	41 5f                	pop    %r15
+  803999:	5d                   	pop    %rbp
+  80399a:	c3                   	ret
+
+000000000080399b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80399b:	55                   	push   %rbp
+  80399c:	48 89 e5             	mov    %rsp,%rbp
+  80399f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80399f <sync+0x4>
+  8039a6:	49 bb 91 46 00 00 00 	movabs $0x4691,%r11
+  8039ad:	00 00 00 
+  8039b0:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  8039b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8039bd:	bf 08 00 00 00       	mov    $0x8,%edi
+  8039c2:	48 b9 02 b2 ff ff ff 	movabs $0xffffffffffffb202,%rcx
+  8039c9:	ff ff ff 
+  8039cc:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8039d0:	ff d0                	call   *%rax
+}
+  8039d2:	5d                   	pop    %rbp
+  8039d3:	c3                   	ret
+
+00000000008039d4 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  8039d4:	55                   	push   %rbp
+  8039d5:	48 89 e5             	mov    %rsp,%rbp
+  8039d8:	41 57                	push   %r15
+  8039da:	53                   	push   %rbx
+  8039db:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8039e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039e2 <copy+0xe>
+  8039e9:	49 bb 4e 46 00 00 00 	movabs $0x464e,%r11
+  8039f0:	00 00 00 
+  8039f3:	4c 01 db             	add    %r11,%rbx
+  8039f6:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8039fd:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803a04:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803a0b:	be 00 00 00 00       	mov    $0x0,%esi
+  803a10:	48 89 c7             	mov    %rax,%rdi
+  803a13:	48 b8 a1 b3 ff ff ff 	movabs $0xffffffffffffb3a1,%rax
+  803a1a:	ff ff ff 
+  803a1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a21:	ff d0                	call   *%rax
+  803a23:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803a26:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a2a:	79 35                	jns    803a61 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803a2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a2f:	89 c6                	mov    %eax,%esi
+  803a31:	48 b8 2e e3 ff ff ff 	movabs $0xffffffffffffe32e,%rax
+  803a38:	ff ff ff 
+  803a3b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a3f:	48 89 c7             	mov    %rax,%rdi
+  803a42:	49 89 df             	mov    %rbx,%r15
+  803a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a4a:	48 ba 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rdx
+  803a51:	ff ff ff 
+  803a54:	48 01 da             	add    %rbx,%rdx
+  803a57:	ff d2                	call   *%rdx
+		return fd_src;
+  803a59:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a5c:	e9 d7 01 00 00       	jmp    803c38 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803a61:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803a68:	be 01 01 00 00       	mov    $0x101,%esi
+  803a6d:	48 89 c7             	mov    %rax,%rdi
+  803a70:	48 b8 a1 b3 ff ff ff 	movabs $0xffffffffffffb3a1,%rax
+  803a77:	ff ff ff 
+  803a7a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a7e:	ff d0                	call   *%rax
+  803a80:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803a83:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803a87:	0f 89 df 00 00 00    	jns    803b6c <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803a8d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803a90:	89 c6                	mov    %eax,%esi
+  803a92:	48 b8 44 e3 ff ff ff 	movabs $0xffffffffffffe344,%rax
+  803a99:	ff ff ff 
+  803a9c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803aa0:	48 89 c7             	mov    %rax,%rdi
+  803aa3:	49 89 df             	mov    %rbx,%r15
+  803aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aab:	48 ba 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rdx
+  803ab2:	ff ff ff 
+  803ab5:	48 01 da             	add    %rbx,%rdx
+  803ab8:	ff d2                	call   *%rdx
+		close(fd_src);
+  803aba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803abd:	89 c7                	mov    %eax,%edi
+  803abf:	49 89 df             	mov    %rbx,%r15
+  803ac2:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  803ac9:	ff ff ff 
+  803acc:	48 01 d8             	add    %rbx,%rax
+  803acf:	ff d0                	call   *%rax
+		return fd_dest;
+  803ad1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ad4:	e9 5f 01 00 00       	jmp    803c38 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803ad9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803adc:	48 63 d0             	movslq %eax,%rdx
+  803adf:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803ae6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ae9:	48 89 ce             	mov    %rcx,%rsi
+  803aec:	89 c7                	mov    %eax,%edi
+  803aee:	49 89 df             	mov    %rbx,%r15
+  803af1:	48 b8 78 ad ff ff ff 	movabs $0xffffffffffffad78,%rax
+  803af8:	ff ff ff 
+  803afb:	48 01 d8             	add    %rbx,%rax
+  803afe:	ff d0                	call   *%rax
+  803b00:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803b03:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803b07:	79 63                	jns    803b6c <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803b09:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803b0c:	89 c6                	mov    %eax,%esi
+  803b0e:	48 b8 5e e3 ff ff ff 	movabs $0xffffffffffffe35e,%rax
+  803b15:	ff ff ff 
+  803b18:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b1c:	48 89 c7             	mov    %rax,%rdi
+  803b1f:	49 89 df             	mov    %rbx,%r15
+  803b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b27:	48 ba 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rdx
+  803b2e:	ff ff ff 
+  803b31:	48 01 da             	add    %rbx,%rdx
+  803b34:	ff d2                	call   *%rdx
+			close(fd_src);
+  803b36:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b39:	89 c7                	mov    %eax,%edi
+  803b3b:	49 89 df             	mov    %rbx,%r15
+  803b3e:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  803b45:	ff ff ff 
+  803b48:	48 01 d8             	add    %rbx,%rax
+  803b4b:	ff d0                	call   *%rax
+			close(fd_dest);
+  803b4d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803b50:	89 c7                	mov    %eax,%edi
+  803b52:	49 89 df             	mov    %rbx,%r15
+  803b55:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  803b5c:	ff ff ff 
+  803b5f:	48 01 d8             	add    %rbx,%rax
+  803b62:	ff d0                	call   *%rax
+			return write_size;
+  803b64:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803b67:	e9 cc 00 00 00       	jmp    803c38 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803b6c:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803b73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b76:	ba 00 02 00 00       	mov    $0x200,%edx
+  803b7b:	48 89 ce             	mov    %rcx,%rsi
+  803b7e:	89 c7                	mov    %eax,%edi
+  803b80:	49 89 df             	mov    %rbx,%r15
+  803b83:	48 b8 d2 ab ff ff ff 	movabs $0xffffffffffffabd2,%rax
+  803b8a:	ff ff ff 
+  803b8d:	48 01 d8             	add    %rbx,%rax
+  803b90:	ff d0                	call   *%rax
+  803b92:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803b95:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803b99:	0f 8f 3a ff ff ff    	jg     803ad9 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803b9f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803ba3:	79 60                	jns    803c05 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803ba5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ba8:	89 c6                	mov    %eax,%esi
+  803baa:	48 b8 71 e3 ff ff ff 	movabs $0xffffffffffffe371,%rax
+  803bb1:	ff ff ff 
+  803bb4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bb8:	48 89 c7             	mov    %rax,%rdi
+  803bbb:	49 89 df             	mov    %rbx,%r15
+  803bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc3:	48 ba 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rdx
+  803bca:	ff ff ff 
+  803bcd:	48 01 da             	add    %rbx,%rdx
+  803bd0:	ff d2                	call   *%rdx
+		close(fd_src);
+  803bd2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bd5:	89 c7                	mov    %eax,%edi
+  803bd7:	49 89 df             	mov    %rbx,%r15
+  803bda:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  803be1:	ff ff ff 
+  803be4:	48 01 d8             	add    %rbx,%rax
+  803be7:	ff d0                	call   *%rax
+		close(fd_dest);
+  803be9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803bec:	89 c7                	mov    %eax,%edi
+  803bee:	49 89 df             	mov    %rbx,%r15
+  803bf1:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  803bf8:	ff ff ff 
+  803bfb:	48 01 d8             	add    %rbx,%rax
+  803bfe:	ff d0                	call   *%rax
+		return read_size;
+  803c00:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c03:	eb 33                	jmp    803c38 <copy+0x264>
+	}
+	close(fd_src);
+  803c05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c08:	89 c7                	mov    %eax,%edi
+  803c0a:	49 89 df             	mov    %rbx,%r15
+  803c0d:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  803c14:	ff ff ff 
+  803c17:	48 01 d8             	add    %rbx,%rax
+  803c1a:	ff d0                	call   *%rax
+	close(fd_dest);
+  803c1c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803c1f:	89 c7                	mov    %eax,%edi
+  803c21:	49 89 df             	mov    %rbx,%r15
+  803c24:	48 b8 1a a9 ff ff ff 	movabs $0xffffffffffffa91a,%rax
+  803c2b:	ff ff ff 
+  803c2e:	48 01 d8             	add    %rbx,%rax
+  803c31:	ff d0                	call   *%rax
+	return 0;
+  803c33:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803c38:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803c3f:	5b                   	pop    %rbx
+  803c40:	41 5f                	pop    %r15
+  803c42:	5d                   	pop    %rbp
+  803c43:	c3                   	ret
+
+0000000000803c44 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  803c44:	55                   	push   %rbp
+  803c45:	48 89 e5             	mov    %rsp,%rbp
+  803c48:	41 57                	push   %r15
+  803c4a:	53                   	push   %rbx
+  803c4b:	48 83 ec 20          	sub    $0x20,%rsp
+  803c4f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c4f <fd2sockid+0xb>
+  803c56:	49 bb e1 43 00 00 00 	movabs $0x43e1,%r11
+  803c5d:	00 00 00 
+  803c60:	4c 01 db             	add    %r11,%rbx
+  803c63:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803c66:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803c6a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c6d:	48 89 d6             	mov    %rdx,%rsi
+  803c70:	89 c7                	mov    %eax,%edi
+  803c72:	49 89 df             	mov    %rbx,%r15
+  803c75:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  803c7c:	ff ff ff 
+  803c7f:	48 01 d8             	add    %rbx,%rax
+  803c82:	ff d0                	call   *%rax
+  803c84:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c87:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c8b:	79 05                	jns    803c92 <fd2sockid+0x4e>
+		return r;
+  803c8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c90:	eb 25                	jmp    803cb7 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803c92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c96:	8b 10                	mov    (%rax),%edx
+  803c98:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  803c9f:	00 00 00 
+  803ca2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803ca5:	39 c2                	cmp    %eax,%edx
+  803ca7:	74 07                	je     803cb0 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  803ca9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803cae:	eb 07                	jmp    803cb7 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  803cb0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cb4:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  803cb7:	48 83 c4 20          	add    $0x20,%rsp
+  803cbb:	5b                   	pop    %rbx
+  803cbc:	41 5f                	pop    %r15
+  803cbe:	5d                   	pop    %rbp
+  803cbf:	c3                   	ret
+
+0000000000803cc0 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  803cc0:	55                   	push   %rbp
+  803cc1:	48 89 e5             	mov    %rsp,%rbp
+  803cc4:	41 57                	push   %r15
+  803cc6:	53                   	push   %rbx
+  803cc7:	48 83 ec 20          	sub    $0x20,%rsp
+  803ccb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ccb <alloc_sockfd+0xb>
+  803cd2:	49 bb 65 43 00 00 00 	movabs $0x4365,%r11
+  803cd9:	00 00 00 
+  803cdc:	4c 01 db             	add    %r11,%rbx
+  803cdf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  803ce2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803ce6:	48 89 c7             	mov    %rax,%rdi
+  803ce9:	49 89 df             	mov    %rbx,%r15
+  803cec:	48 b8 d5 a5 ff ff ff 	movabs $0xffffffffffffa5d5,%rax
+  803cf3:	ff ff ff 
+  803cf6:	48 01 d8             	add    %rbx,%rax
+  803cf9:	ff d0                	call   *%rax
+  803cfb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cfe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d02:	78 2c                	js     803d30 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803d04:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d08:	ba 07 04 00 00       	mov    $0x407,%edx
+  803d0d:	48 89 c6             	mov    %rax,%rsi
+  803d10:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d15:	49 89 df             	mov    %rbx,%r15
+  803d18:	48 b8 b2 9d ff ff ff 	movabs $0xffffffffffff9db2,%rax
+  803d1f:	ff ff ff 
+  803d22:	48 01 d8             	add    %rbx,%rax
+  803d25:	ff d0                	call   *%rax
+  803d27:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d2a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d2e:	79 1c                	jns    803d4c <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  803d30:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d33:	89 c7                	mov    %eax,%edi
+  803d35:	49 89 df             	mov    %rbx,%r15
+  803d38:	48 b8 84 c4 ff ff ff 	movabs $0xffffffffffffc484,%rax
+  803d3f:	ff ff ff 
+  803d42:	48 01 d8             	add    %rbx,%rax
+  803d45:	ff d0                	call   *%rax
+		return r;
+  803d47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d4a:	eb 41                	jmp    803d8d <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  803d4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d50:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  803d57:	00 00 00 
+  803d5a:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803d5d:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  803d5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d63:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  803d6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d6e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803d71:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  803d74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d78:	48 89 c7             	mov    %rax,%rdi
+  803d7b:	49 89 df             	mov    %rbx,%r15
+  803d7e:	48 b8 5b a5 ff ff ff 	movabs $0xffffffffffffa55b,%rax
+  803d85:	ff ff ff 
+  803d88:	48 01 d8             	add    %rbx,%rax
+  803d8b:	ff d0                	call   *%rax
+}
+  803d8d:	48 83 c4 20          	add    $0x20,%rsp
+  803d91:	5b                   	pop    %rbx
+  803d92:	41 5f                	pop    %r15
+  803d94:	5d                   	pop    %rbp
+  803d95:	c3                   	ret
+
+0000000000803d96 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803d96:	55                   	push   %rbp
+  803d97:	48 89 e5             	mov    %rsp,%rbp
+  803d9a:	41 57                	push   %r15
+  803d9c:	53                   	push   %rbx
+  803d9d:	48 83 ec 30          	sub    $0x30,%rsp
+  803da1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803da1 <accept+0xb>
+  803da8:	49 bb 8f 42 00 00 00 	movabs $0x428f,%r11
+  803daf:	00 00 00 
+  803db2:	4c 01 db             	add    %r11,%rbx
+  803db5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803db8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803dbc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  803dc0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803dc3:	89 c7                	mov    %eax,%edi
+  803dc5:	48 b8 14 bc ff ff ff 	movabs $0xffffffffffffbc14,%rax
+  803dcc:	ff ff ff 
+  803dcf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dd3:	ff d0                	call   *%rax
+  803dd5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803dd8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ddc:	79 05                	jns    803de3 <accept+0x4d>
+		return r;
+  803dde:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803de1:	eb 45                	jmp    803e28 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  803de3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803de7:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803deb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dee:	48 89 ce             	mov    %rcx,%rsi
+  803df1:	89 c7                	mov    %eax,%edi
+  803df3:	49 89 df             	mov    %rbx,%r15
+  803df6:	48 b8 f2 c2 ff ff ff 	movabs $0xffffffffffffc2f2,%rax
+  803dfd:	ff ff ff 
+  803e00:	48 01 d8             	add    %rbx,%rax
+  803e03:	ff d0                	call   *%rax
+  803e05:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e08:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e0c:	79 05                	jns    803e13 <accept+0x7d>
+		return r;
+  803e0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e11:	eb 15                	jmp    803e28 <accept+0x92>
+	return alloc_sockfd(r);
+  803e13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e16:	89 c7                	mov    %eax,%edi
+  803e18:	48 b8 90 bc ff ff ff 	movabs $0xffffffffffffbc90,%rax
+  803e1f:	ff ff ff 
+  803e22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e26:	ff d0                	call   *%rax
+}
+  803e28:	48 83 c4 30          	add    $0x30,%rsp
+  803e2c:	5b                   	pop    %rbx
+  803e2d:	41 5f                	pop    %r15
+  803e2f:	5d                   	pop    %rbp
+  803e30:	c3                   	ret
+
+0000000000803e31 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803e31:	55                   	push   %rbp
+  803e32:	48 89 e5             	mov    %rsp,%rbp
+  803e35:	41 57                	push   %r15
+  803e37:	53                   	push   %rbx
+  803e38:	48 83 ec 20          	sub    $0x20,%rsp
+  803e3c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e3c <bind+0xb>
+  803e43:	49 bb f4 41 00 00 00 	movabs $0x41f4,%r11
+  803e4a:	00 00 00 
+  803e4d:	4c 01 db             	add    %r11,%rbx
+  803e50:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e53:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803e57:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  803e5a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e5d:	89 c7                	mov    %eax,%edi
+  803e5f:	48 b8 14 bc ff ff ff 	movabs $0xffffffffffffbc14,%rax
+  803e66:	ff ff ff 
+  803e69:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e6d:	ff d0                	call   *%rax
+  803e6f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e72:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e76:	79 05                	jns    803e7d <bind+0x4c>
+		return r;
+  803e78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e7b:	eb 21                	jmp    803e9e <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  803e7d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803e80:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803e84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e87:	48 89 ce             	mov    %rcx,%rsi
+  803e8a:	89 c7                	mov    %eax,%edi
+  803e8c:	49 89 df             	mov    %rbx,%r15
+  803e8f:	48 b8 9e c3 ff ff ff 	movabs $0xffffffffffffc39e,%rax
+  803e96:	ff ff ff 
+  803e99:	48 01 d8             	add    %rbx,%rax
+  803e9c:	ff d0                	call   *%rax
+}
+  803e9e:	48 83 c4 20          	add    $0x20,%rsp
+  803ea2:	5b                   	pop    %rbx
+  803ea3:	41 5f                	pop    %r15
+  803ea5:	5d                   	pop    %rbp
+  803ea6:	c3                   	ret
+
+0000000000803ea7 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  803ea7:	55                   	push   %rbp
+  803ea8:	48 89 e5             	mov    %rsp,%rbp
+  803eab:	41 57                	push   %r15
+  803ead:	53                   	push   %rbx
+  803eae:	48 83 ec 20          	sub    $0x20,%rsp
+  803eb2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803eb2 <shutdown+0xb>
+  803eb9:	49 bb 7e 41 00 00 00 	movabs $0x417e,%r11
+  803ec0:	00 00 00 
+  803ec3:	4c 01 db             	add    %r11,%rbx
+  803ec6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ec9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  803ecc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ecf:	89 c7                	mov    %eax,%edi
+  803ed1:	48 b8 14 bc ff ff ff 	movabs $0xffffffffffffbc14,%rax
+  803ed8:	ff ff ff 
+  803edb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803edf:	ff d0                	call   *%rax
+  803ee1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ee4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ee8:	79 05                	jns    803eef <shutdown+0x48>
+		return r;
+  803eea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803eed:	eb 1c                	jmp    803f0b <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  803eef:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803ef2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ef5:	89 d6                	mov    %edx,%esi
+  803ef7:	89 c7                	mov    %eax,%edi
+  803ef9:	49 89 df             	mov    %rbx,%r15
+  803efc:	48 b8 33 c4 ff ff ff 	movabs $0xffffffffffffc433,%rax
+  803f03:	ff ff ff 
+  803f06:	48 01 d8             	add    %rbx,%rax
+  803f09:	ff d0                	call   *%rax
+}
+  803f0b:	48 83 c4 20          	add    $0x20,%rsp
+  803f0f:	5b                   	pop    %rbx
+  803f10:	41 5f                	pop    %r15
+  803f12:	5d                   	pop    %rbp
+  803f13:	c3                   	ret
+
+0000000000803f14 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  803f14:	55                   	push   %rbp
+  803f15:	48 89 e5             	mov    %rsp,%rbp
+  803f18:	41 57                	push   %r15
+  803f1a:	53                   	push   %rbx
+  803f1b:	48 83 ec 10          	sub    $0x10,%rsp
+  803f1f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f1f <devsock_close+0xb>
+  803f26:	49 bb 11 41 00 00 00 	movabs $0x4111,%r11
+  803f2d:	00 00 00 
+  803f30:	4c 01 db             	add    %r11,%rbx
+  803f33:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  803f37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f3b:	48 89 c7             	mov    %rax,%rdi
+  803f3e:	49 89 df             	mov    %rbx,%r15
+  803f41:	48 b8 89 dd ff ff ff 	movabs $0xffffffffffffdd89,%rax
+  803f48:	ff ff ff 
+  803f4b:	48 01 d8             	add    %rbx,%rax
+  803f4e:	ff d0                	call   *%rax
+  803f50:	83 f8 01             	cmp    $0x1,%eax
+  803f53:	75 1d                	jne    803f72 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  803f55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f59:	8b 40 0c             	mov    0xc(%rax),%eax
+  803f5c:	89 c7                	mov    %eax,%edi
+  803f5e:	49 89 df             	mov    %rbx,%r15
+  803f61:	48 b8 84 c4 ff ff ff 	movabs $0xffffffffffffc484,%rax
+  803f68:	ff ff ff 
+  803f6b:	48 01 d8             	add    %rbx,%rax
+  803f6e:	ff d0                	call   *%rax
+  803f70:	eb 05                	jmp    803f77 <devsock_close+0x63>
+	else
+		return 0;
+  803f72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f77:	48 83 c4 10          	add    $0x10,%rsp
+  803f7b:	5b                   	pop    %rbx
+  803f7c:	41 5f                	pop    %r15
+  803f7e:	5d                   	pop    %rbp
+  803f7f:	c3                   	ret
+
+0000000000803f80 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803f80:	55                   	push   %rbp
+  803f81:	48 89 e5             	mov    %rsp,%rbp
+  803f84:	41 57                	push   %r15
+  803f86:	53                   	push   %rbx
+  803f87:	48 83 ec 20          	sub    $0x20,%rsp
+  803f8b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f8b <connect+0xb>
+  803f92:	49 bb a5 40 00 00 00 	movabs $0x40a5,%r11
+  803f99:	00 00 00 
+  803f9c:	4c 01 db             	add    %r11,%rbx
+  803f9f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803fa2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803fa6:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  803fa9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803fac:	89 c7                	mov    %eax,%edi
+  803fae:	48 b8 14 bc ff ff ff 	movabs $0xffffffffffffbc14,%rax
+  803fb5:	ff ff ff 
+  803fb8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fbc:	ff d0                	call   *%rax
+  803fbe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fc1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fc5:	79 05                	jns    803fcc <connect+0x4c>
+		return r;
+  803fc7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fca:	eb 21                	jmp    803fed <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  803fcc:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803fcf:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803fd3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fd6:	48 89 ce             	mov    %rcx,%rsi
+  803fd9:	89 c7                	mov    %eax,%edi
+  803fdb:	49 89 df             	mov    %rbx,%r15
+  803fde:	48 b8 cc c4 ff ff ff 	movabs $0xffffffffffffc4cc,%rax
+  803fe5:	ff ff ff 
+  803fe8:	48 01 d8             	add    %rbx,%rax
+  803feb:	ff d0                	call   *%rax
+}
+  803fed:	48 83 c4 20          	add    $0x20,%rsp
+  803ff1:	5b                   	pop    %rbx
+  803ff2:	41 5f                	pop    %r15
+  803ff4:	5d                   	pop    %rbp
+  803ff5:	c3                   	ret
+
+0000000000803ff6 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  803ff6:	55                   	push   %rbp
+  803ff7:	48 89 e5             	mov    %rsp,%rbp
+  803ffa:	41 57                	push   %r15
+  803ffc:	53                   	push   %rbx
+  803ffd:	48 83 ec 20          	sub    $0x20,%rsp
+  804001:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804001 <listen+0xb>
+  804008:	49 bb 2f 40 00 00 00 	movabs $0x402f,%r11
+  80400f:	00 00 00 
+  804012:	4c 01 db             	add    %r11,%rbx
+  804015:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804018:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80401b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80401e:	89 c7                	mov    %eax,%edi
+  804020:	48 b8 14 bc ff ff ff 	movabs $0xffffffffffffbc14,%rax
+  804027:	ff ff ff 
+  80402a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80402e:	ff d0                	call   *%rax
+  804030:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804033:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804037:	79 05                	jns    80403e <listen+0x48>
+		return r;
+  804039:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80403c:	eb 1c                	jmp    80405a <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80403e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804041:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804044:	89 d6                	mov    %edx,%esi
+  804046:	89 c7                	mov    %eax,%edi
+  804048:	49 89 df             	mov    %rbx,%r15
+  80404b:	48 b8 61 c5 ff ff ff 	movabs $0xffffffffffffc561,%rax
+  804052:	ff ff ff 
+  804055:	48 01 d8             	add    %rbx,%rax
+  804058:	ff d0                	call   *%rax
+}
+  80405a:	48 83 c4 20          	add    $0x20,%rsp
+  80405e:	5b                   	pop    %rbx
+  80405f:	41 5f                	pop    %r15
+  804061:	5d                   	pop    %rbp
+  804062:	c3                   	ret
+
+0000000000804063 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804063:	55                   	push   %rbp
+  804064:	48 89 e5             	mov    %rsp,%rbp
+  804067:	41 57                	push   %r15
+  804069:	48 83 ec 28          	sub    $0x28,%rsp
+  80406d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80406d <devsock_read+0xa>
+  804074:	49 bb c3 3f 00 00 00 	movabs $0x3fc3,%r11
+  80407b:	00 00 00 
+  80407e:	4c 01 d8             	add    %r11,%rax
+  804081:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804085:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804089:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80408d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804091:	41 89 d0             	mov    %edx,%r8d
+  804094:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804098:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80409b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80409f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8040a4:	44 89 c2             	mov    %r8d,%edx
+  8040a7:	49 89 c7             	mov    %rax,%r15
+  8040aa:	49 b8 b2 c5 ff ff ff 	movabs $0xffffffffffffc5b2,%r8
+  8040b1:	ff ff ff 
+  8040b4:	49 01 c0             	add    %rax,%r8
+  8040b7:	41 ff d0             	call   *%r8
+}
+  8040ba:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8040be:	c9                   	leave
+  8040bf:	c3                   	ret
+
+00000000008040c0 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8040c0:	55                   	push   %rbp
+  8040c1:	48 89 e5             	mov    %rsp,%rbp
+  8040c4:	41 57                	push   %r15
+  8040c6:	48 83 ec 28          	sub    $0x28,%rsp
+  8040ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8040ca <devsock_write+0xa>
+  8040d1:	49 bb 66 3f 00 00 00 	movabs $0x3f66,%r11
+  8040d8:	00 00 00 
+  8040db:	4c 01 d8             	add    %r11,%rax
+  8040de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8040e6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8040ea:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040ee:	41 89 d0             	mov    %edx,%r8d
+  8040f1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8040f5:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8040f8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8040fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804101:	44 89 c2             	mov    %r8d,%edx
+  804104:	49 89 c7             	mov    %rax,%r15
+  804107:	49 b8 cf c6 ff ff ff 	movabs $0xffffffffffffc6cf,%r8
+  80410e:	ff ff ff 
+  804111:	49 01 c0             	add    %rax,%r8
+  804114:	41 ff d0             	call   *%r8
+}
+  804117:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80411b:	c9                   	leave
+  80411c:	c3                   	ret
+
+000000000080411d <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80411d:	55                   	push   %rbp
+  80411e:	48 89 e5             	mov    %rsp,%rbp
+  804121:	41 57                	push   %r15
+  804123:	48 83 ec 18          	sub    $0x18,%rsp
+  804127:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804127 <devsock_stat+0xa>
+  80412e:	49 bb 09 3f 00 00 00 	movabs $0x3f09,%r11
+  804135:	00 00 00 
+  804138:	4c 01 d8             	add    %r11,%rax
+  80413b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80413f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804143:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804147:	48 b9 8c e3 ff ff ff 	movabs $0xffffffffffffe38c,%rcx
+  80414e:	ff ff ff 
+  804151:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804155:	48 89 ce             	mov    %rcx,%rsi
+  804158:	48 89 d7             	mov    %rdx,%rdi
+  80415b:	49 89 c7             	mov    %rax,%r15
+  80415e:	48 ba f6 90 ff ff ff 	movabs $0xffffffffffff90f6,%rdx
+  804165:	ff ff ff 
+  804168:	48 01 c2             	add    %rax,%rdx
+  80416b:	ff d2                	call   *%rdx
+	return 0;
+  80416d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804172:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804176:	c9                   	leave
+  804177:	c3                   	ret
+
+0000000000804178 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804178:	55                   	push   %rbp
+  804179:	48 89 e5             	mov    %rsp,%rbp
+  80417c:	41 57                	push   %r15
+  80417e:	53                   	push   %rbx
+  80417f:	48 83 ec 20          	sub    $0x20,%rsp
+  804183:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804183 <socket+0xb>
+  80418a:	49 bb ad 3e 00 00 00 	movabs $0x3ead,%r11
+  804191:	00 00 00 
+  804194:	4c 01 db             	add    %r11,%rbx
+  804197:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80419a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80419d:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8041a0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8041a3:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8041a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041a9:	89 ce                	mov    %ecx,%esi
+  8041ab:	89 c7                	mov    %eax,%edi
+  8041ad:	49 89 df             	mov    %rbx,%r15
+  8041b0:	48 b8 a6 c8 ff ff ff 	movabs $0xffffffffffffc8a6,%rax
+  8041b7:	ff ff ff 
+  8041ba:	48 01 d8             	add    %rbx,%rax
+  8041bd:	ff d0                	call   *%rax
+  8041bf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041c6:	79 05                	jns    8041cd <socket+0x55>
+		return r;
+  8041c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041cb:	eb 15                	jmp    8041e2 <socket+0x6a>
+	return alloc_sockfd(r);
+  8041cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041d0:	89 c7                	mov    %eax,%edi
+  8041d2:	48 b8 90 bc ff ff ff 	movabs $0xffffffffffffbc90,%rax
+  8041d9:	ff ff ff 
+  8041dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041e0:	ff d0                	call   *%rax
+}
+  8041e2:	48 83 c4 20          	add    $0x20,%rsp
+  8041e6:	5b                   	pop    %rbx
+  8041e7:	41 5f                	pop    %r15
+  8041e9:	5d                   	pop    %rbp
+  8041ea:	c3                   	ret
+
+00000000008041eb <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8041eb:	55                   	push   %rbp
+  8041ec:	48 89 e5             	mov    %rsp,%rbp
+  8041ef:	41 57                	push   %r15
+  8041f1:	53                   	push   %rbx
+  8041f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8041f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041f6 <nsipc+0xb>
+  8041fd:	49 bb 3a 3e 00 00 00 	movabs $0x3e3a,%r11
+  804204:	00 00 00 
+  804207:	4c 01 db             	add    %r11,%rbx
+  80420a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  80420d:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804214:	00 00 00 
+  804217:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80421a:	85 c0                	test   %eax,%eax
+  80421c:	75 24                	jne    804242 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80421e:	bf 02 00 00 00       	mov    $0x2,%edi
+  804223:	49 89 df             	mov    %rbx,%r15
+  804226:	48 b8 fa dc ff ff ff 	movabs $0xffffffffffffdcfa,%rax
+  80422d:	ff ff ff 
+  804230:	48 01 d8             	add    %rbx,%rax
+  804233:	ff d0                	call   *%rax
+  804235:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  80423c:	00 00 00 
+  80423f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804242:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804249:	00 00 00 
+  80424c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80424f:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804252:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804258:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80425e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804263:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80426a:	00 00 00 
+  80426d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804271:	89 c7                	mov    %eax,%edi
+  804273:	49 89 df             	mov    %rbx,%r15
+  804276:	48 b8 19 d7 ff ff ff 	movabs $0xffffffffffffd719,%rax
+  80427d:	ff ff ff 
+  804280:	48 01 d8             	add    %rbx,%rax
+  804283:	ff d0                	call   *%rax
+}
+  804285:	48 83 c4 10          	add    $0x10,%rsp
+  804289:	5b                   	pop    %rbx
+  80428a:	41 5f                	pop    %r15
+  80428c:	5d                   	pop    %rbp
+  80428d:	c3                   	ret
+
+000000000080428e <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  80428e:	55                   	push   %rbp
+  80428f:	48 89 e5             	mov    %rsp,%rbp
+  804292:	41 57                	push   %r15
+  804294:	53                   	push   %rbx
+  804295:	48 83 ec 20          	sub    $0x20,%rsp
+  804299:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804299 <nsipc_words+0xb>
+  8042a0:	49 bb 97 3d 00 00 00 	movabs $0x3d97,%r11
+  8042a7:	00 00 00 
+  8042aa:	4c 01 db             	add    %r11,%rbx
+  8042ad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8042b0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8042b4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8042b8:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8042bf:	00 00 00 
+  8042c2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8042c5:	85 c0                	test   %eax,%eax
+  8042c7:	75 24                	jne    8042ed <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8042c9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8042ce:	49 89 df             	mov    %rbx,%r15
+  8042d1:	48 b8 fa dc ff ff ff 	movabs $0xffffffffffffdcfa,%rax
+  8042d8:	ff ff ff 
+  8042db:	48 01 d8             	add    %rbx,%rax
+  8042de:	ff d0                	call   *%rax
+  8042e0:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8042e7:	00 00 00 
+  8042ea:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8042ed:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8042f4:	00 00 00 
+  8042f7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8042fa:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8042fe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804302:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804305:	89 c7                	mov    %eax,%edi
+  804307:	49 89 df             	mov    %rbx,%r15
+  80430a:	48 b8 04 d8 ff ff ff 	movabs $0xffffffffffffd804,%rax
+  804311:	ff ff ff 
+  804314:	48 01 d8             	add    %rbx,%rax
+  804317:	ff d0                	call   *%rax
+}
+  804319:	48 83 c4 20          	add    $0x20,%rsp
+  80431d:	5b                   	pop    %rbx
+  80431e:	41 5f                	pop    %r15
+  804320:	5d                   	pop    %rbp
+  804321:	c3                   	ret
+
+0000000000804322 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804322:	55                   	push   %rbp
+  804323:	48 89 e5             	mov    %rsp,%rbp
+  804326:	41 57                	push   %r15
+  804328:	53                   	push   %rbx
+  804329:	48 83 ec 30          	sub    $0x30,%rsp
+  80432d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80432d <nsipc_accept+0xb>
+  804334:	49 bb 03 3d 00 00 00 	movabs $0x3d03,%r11
+  80433b:	00 00 00 
+  80433e:	4c 01 db             	add    %r11,%rbx
+  804341:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804344:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804348:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80434c:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804353:	00 00 00 
+  804356:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804359:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80435c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804361:	48 b8 bb c1 ff ff ff 	movabs $0xffffffffffffc1bb,%rax
+  804368:	ff ff ff 
+  80436b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80436f:	ff d0                	call   *%rax
+  804371:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804374:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804378:	78 48                	js     8043c2 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80437a:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  804381:	00 00 00 
+  804384:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804388:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80438c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804390:	8b 40 10             	mov    0x10(%rax),%eax
+  804393:	89 c2                	mov    %eax,%edx
+  804395:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804399:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80439d:	48 89 ce             	mov    %rcx,%rsi
+  8043a0:	48 89 c7             	mov    %rax,%rdi
+  8043a3:	49 89 df             	mov    %rbx,%r15
+  8043a6:	48 b8 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rax
+  8043ad:	ff ff ff 
+  8043b0:	48 01 d8             	add    %rbx,%rax
+  8043b3:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8043b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043b9:	8b 50 10             	mov    0x10(%rax),%edx
+  8043bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043c0:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8043c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8043c5:	48 83 c4 30          	add    $0x30,%rsp
+  8043c9:	5b                   	pop    %rbx
+  8043ca:	41 5f                	pop    %r15
+  8043cc:	5d                   	pop    %rbp
+  8043cd:	c3                   	ret
+
+00000000008043ce <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8043ce:	55                   	push   %rbp
+  8043cf:	48 89 e5             	mov    %rsp,%rbp
+  8043d2:	41 57                	push   %r15
+  8043d4:	53                   	push   %rbx
+  8043d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8043d9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043d9 <nsipc_bind+0xb>
+  8043e0:	49 bb 57 3c 00 00 00 	movabs $0x3c57,%r11
+  8043e7:	00 00 00 
+  8043ea:	4c 01 db             	add    %r11,%rbx
+  8043ed:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8043f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8043f4:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8043f7:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8043fe:	00 00 00 
+  804401:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804404:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804407:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80440a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80440e:	48 89 c6             	mov    %rax,%rsi
+  804411:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  804418:	00 00 00 
+  80441b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80441f:	48 89 c7             	mov    %rax,%rdi
+  804422:	49 89 df             	mov    %rbx,%r15
+  804425:	48 b8 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rax
+  80442c:	ff ff ff 
+  80442f:	48 01 d8             	add    %rbx,%rax
+  804432:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804434:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80443b:	00 00 00 
+  80443e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804441:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804445:	bf 02 00 00 00       	mov    $0x2,%edi
+  80444a:	48 b8 bb c1 ff ff ff 	movabs $0xffffffffffffc1bb,%rax
+  804451:	ff ff ff 
+  804454:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804458:	ff d0                	call   *%rax
+}
+  80445a:	48 83 c4 10          	add    $0x10,%rsp
+  80445e:	5b                   	pop    %rbx
+  80445f:	41 5f                	pop    %r15
+  804461:	5d                   	pop    %rbp
+  804462:	c3                   	ret
+
+0000000000804463 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804463:	55                   	push   %rbp
+  804464:	48 89 e5             	mov    %rsp,%rbp
+  804467:	48 83 ec 20          	sub    $0x20,%rsp
+  80446b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80446b <nsipc_shutdown+0x8>
+  804472:	49 bb c5 3b 00 00 00 	movabs $0x3bc5,%r11
+  804479:	00 00 00 
+  80447c:	4c 01 d8             	add    %r11,%rax
+  80447f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804482:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  804485:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804488:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  80448b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80448e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  804491:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804495:	ba 08 00 00 00       	mov    $0x8,%edx
+  80449a:	48 89 ce             	mov    %rcx,%rsi
+  80449d:	bf 03 00 00 00       	mov    $0x3,%edi
+  8044a2:	48 b9 5e c2 ff ff ff 	movabs $0xffffffffffffc25e,%rcx
+  8044a9:	ff ff ff 
+  8044ac:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8044b0:	ff d0                	call   *%rax
+}
+  8044b2:	c9                   	leave
+  8044b3:	c3                   	ret
+
+00000000008044b4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8044b4:	55                   	push   %rbp
+  8044b5:	48 89 e5             	mov    %rsp,%rbp
+  8044b8:	48 83 ec 20          	sub    $0x20,%rsp
+  8044bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044bc <nsipc_close+0x8>
+  8044c3:	49 bb 74 3b 00 00 00 	movabs $0x3b74,%r11
+  8044ca:	00 00 00 
+  8044cd:	4c 01 d8             	add    %r11,%rax
+  8044d0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8044d3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8044d6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8044d9:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8044dd:	ba 04 00 00 00       	mov    $0x4,%edx
+  8044e2:	48 89 ce             	mov    %rcx,%rsi
+  8044e5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8044ea:	48 b9 5e c2 ff ff ff 	movabs $0xffffffffffffc25e,%rcx
+  8044f1:	ff ff ff 
+  8044f4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8044f8:	ff d0                	call   *%rax
+}
+  8044fa:	c9                   	leave
+  8044fb:	c3                   	ret
+
+00000000008044fc <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8044fc:	55                   	push   %rbp
+  8044fd:	48 89 e5             	mov    %rsp,%rbp
+  804500:	41 57                	push   %r15
+  804502:	53                   	push   %rbx
+  804503:	48 83 ec 10          	sub    $0x10,%rsp
+  804507:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804507 <nsipc_connect+0xb>
+  80450e:	49 bb 29 3b 00 00 00 	movabs $0x3b29,%r11
+  804515:	00 00 00 
+  804518:	4c 01 db             	add    %r11,%rbx
+  80451b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80451e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804522:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804525:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80452c:	00 00 00 
+  80452f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804532:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804535:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804538:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80453c:	48 89 c6             	mov    %rax,%rsi
+  80453f:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  804546:	00 00 00 
+  804549:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80454d:	48 89 c7             	mov    %rax,%rdi
+  804550:	49 89 df             	mov    %rbx,%r15
+  804553:	48 b8 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rax
+  80455a:	ff ff ff 
+  80455d:	48 01 d8             	add    %rbx,%rax
+  804560:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  804562:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804569:	00 00 00 
+  80456c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80456f:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  804573:	bf 05 00 00 00       	mov    $0x5,%edi
+  804578:	48 b8 bb c1 ff ff ff 	movabs $0xffffffffffffc1bb,%rax
+  80457f:	ff ff ff 
+  804582:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804586:	ff d0                	call   *%rax
+}
+  804588:	48 83 c4 10          	add    $0x10,%rsp
+  80458c:	5b                   	pop    %rbx
+  80458d:	41 5f                	pop    %r15
+  80458f:	5d                   	pop    %rbp
+  804590:	c3                   	ret
+
+0000000000804591 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804591:	55                   	push   %rbp
+  804592:	48 89 e5             	mov    %rsp,%rbp
+  804595:	48 83 ec 20          	sub    $0x20,%rsp
+  804599:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804599 <nsipc_listen+0x8>
+  8045a0:	49 bb 97 3a 00 00 00 	movabs $0x3a97,%r11
+  8045a7:	00 00 00 
+  8045aa:	4c 01 d8             	add    %r11,%rax
+  8045ad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8045b0:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8045b3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8045b6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8045b9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8045bc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8045bf:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8045c3:	ba 08 00 00 00       	mov    $0x8,%edx
+  8045c8:	48 89 ce             	mov    %rcx,%rsi
+  8045cb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8045d0:	48 b9 5e c2 ff ff ff 	movabs $0xffffffffffffc25e,%rcx
+  8045d7:	ff ff ff 
+  8045da:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8045de:	ff d0                	call   *%rax
+}
+  8045e0:	c9                   	leave
+  8045e1:	c3                   	ret
+
+00000000008045e2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8045e2:	55                   	push   %rbp
+  8045e3:	48 89 e5             	mov    %rsp,%rbp
+  8045e6:	41 57                	push   %r15
+  8045e8:	53                   	push   %rbx
+  8045e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8045ed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045ed <nsipc_recv+0xb>
+  8045f4:	49 bb 43 3a 00 00 00 	movabs $0x3a43,%r11
+  8045fb:	00 00 00 
+  8045fe:	4c 01 db             	add    %r11,%rbx
+  804601:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804604:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804608:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  80460b:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80460e:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804615:	00 00 00 
+  804618:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80461b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  80461e:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804625:	00 00 00 
+  804628:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80462b:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  80462f:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804636:	00 00 00 
+  804639:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80463c:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804640:	bf 07 00 00 00       	mov    $0x7,%edi
+  804645:	48 b8 bb c1 ff ff ff 	movabs $0xffffffffffffc1bb,%rax
+  80464c:	ff ff ff 
+  80464f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804653:	ff d0                	call   *%rax
+  804655:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804658:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80465c:	0f 88 91 00 00 00    	js     8046f3 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804662:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804669:	7f 08                	jg     804673 <nsipc_recv+0x91>
+  80466b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80466e:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804671:	7e 50                	jle    8046c3 <nsipc_recv+0xe1>
+  804673:	48 b8 93 e3 ff ff ff 	movabs $0xffffffffffffe393,%rax
+  80467a:	ff ff ff 
+  80467d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804681:	48 89 c1             	mov    %rax,%rcx
+  804684:	48 b8 a8 e3 ff ff ff 	movabs $0xffffffffffffe3a8,%rax
+  80468b:	ff ff ff 
+  80468e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804692:	48 89 c2             	mov    %rax,%rdx
+  804695:	be 79 00 00 00       	mov    $0x79,%esi
+  80469a:	48 b8 bd e3 ff ff ff 	movabs $0xffffffffffffe3bd,%rax
+  8046a1:	ff ff ff 
+  8046a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046a8:	48 89 c7             	mov    %rax,%rdi
+  8046ab:	49 89 df             	mov    %rbx,%r15
+  8046ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046b3:	49 b8 64 d4 ff ff ff 	movabs $0xffffffffffffd464,%r8
+  8046ba:	ff ff ff 
+  8046bd:	49 01 d8             	add    %rbx,%r8
+  8046c0:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8046c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046c6:	48 63 d0             	movslq %eax,%rdx
+  8046c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046cd:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  8046d4:	00 00 00 
+  8046d7:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8046db:	48 89 ce             	mov    %rcx,%rsi
+  8046de:	48 89 c7             	mov    %rax,%rdi
+  8046e1:	49 89 df             	mov    %rbx,%r15
+  8046e4:	48 b8 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rax
+  8046eb:	ff ff ff 
+  8046ee:	48 01 d8             	add    %rbx,%rax
+  8046f1:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8046f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8046f6:	48 83 c4 30          	add    $0x30,%rsp
+  8046fa:	5b                   	pop    %rbx
+  8046fb:	41 5f                	pop    %r15
+  8046fd:	5d                   	pop    %rbp
+  8046fe:	c3                   	ret
+
+00000000008046ff <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8046ff:	55                   	push   %rbp
+  804700:	48 89 e5             	mov    %rsp,%rbp
+  804703:	41 57                	push   %r15
+  804705:	53                   	push   %rbx
+  804706:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80470d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80470d <nsipc_send+0xe>
+  804714:	49 bb 23 39 00 00 00 	movabs $0x3923,%r11
+  80471b:	00 00 00 
+  80471e:	4c 01 db             	add    %r11,%rbx
+  804721:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804727:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  80472e:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804734:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  80473a:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80473e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804742:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804749:	00 00 00 
+  80474c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80474f:	85 c0                	test   %eax,%eax
+  804751:	75 24                	jne    804777 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804753:	bf 02 00 00 00       	mov    $0x2,%edi
+  804758:	49 89 df             	mov    %rbx,%r15
+  80475b:	48 b8 fa dc ff ff ff 	movabs $0xffffffffffffdcfa,%rax
+  804762:	ff ff ff 
+  804765:	48 01 d8             	add    %rbx,%rax
+  804768:	ff d0                	call   *%rax
+  80476a:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804771:	00 00 00 
+  804774:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804777:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80477d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804780:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804787:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80478a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80478d:	39 c2                	cmp    %eax,%edx
+  80478f:	0f 4e c2             	cmovle %edx,%eax
+  804792:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804798:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80479e:	48 63 d0             	movslq %eax,%rdx
+  8047a1:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8047a8:	48 89 c6             	mov    %rax,%rsi
+  8047ab:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  8047b2:	00 00 00 
+  8047b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047b9:	48 89 c7             	mov    %rax,%rdi
+  8047bc:	49 89 df             	mov    %rbx,%r15
+  8047bf:	48 b8 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rax
+  8047c6:	ff ff ff 
+  8047c9:	48 01 d8             	add    %rbx,%rax
+  8047cc:	ff d0                	call   *%rax
+	req->req_s = s;
+  8047ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047d2:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  8047d8:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  8047da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047de:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8047e4:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  8047e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047eb:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8047f1:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  8047f4:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  8047fb:	00 00 00 
+  8047fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804802:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804806:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80480d:	00 
+  80480e:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804814:	48 63 d0             	movslq %eax,%rdx
+  804817:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80481b:	48 01 d0             	add    %rdx,%rax
+  80481e:	48 83 e8 01          	sub    $0x1,%rax
+  804822:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804826:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80482a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80482f:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804833:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804837:	48 29 d0             	sub    %rdx,%rax
+  80483a:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804840:	85 c0                	test   %eax,%eax
+  804842:	0f 48 c2             	cmovs  %edx,%eax
+  804845:	c1 f8 0c             	sar    $0xc,%eax
+  804848:	48 98                	cltq
+  80484a:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  80484e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804852:	48 85 c0             	test   %rax,%rax
+  804855:	0f 95 c0             	setne  %al
+  804858:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  80485b:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804862:	00 
+  804863:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804867:	48 83 c0 0b          	add    $0xb,%rax
+  80486b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80486f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804873:	ba 00 00 00 00       	mov    $0x0,%edx
+  804878:	48 f7 75 c8          	divq   -0x38(%rbp)
+  80487c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804880:	48 29 d0             	sub    %rdx,%rax
+  804883:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804887:	89 c7                	mov    %eax,%edi
+  804889:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804890:	00 00 00 
+  804893:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804896:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80489a:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  80489e:	48 83 ec 08          	sub    $0x8,%rsp
+  8048a2:	6a 00                	push   $0x0
+  8048a4:	6a 00                	push   $0x0
+  8048a6:	6a 05                	push   $0x5
+  8048a8:	41 89 f1             	mov    %esi,%r9d
+  8048ab:	49 89 c8             	mov    %rcx,%r8
+  8048ae:	89 f9                	mov    %edi,%ecx
+  8048b0:	be 08 00 00 00       	mov    $0x8,%esi
+  8048b5:	89 c7                	mov    %eax,%edi
+  8048b7:	49 89 df             	mov    %rbx,%r15
+  8048ba:	48 b8 02 d9 ff ff ff 	movabs $0xffffffffffffd902,%rax
+  8048c1:	ff ff ff 
+  8048c4:	48 01 d8             	add    %rbx,%rax
+  8048c7:	ff d0                	call   *%rax
+  8048c9:	48 83 c4 20          	add    $0x20,%rsp
+}
+  8048cd:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8048d1:	5b                   	pop    %rbx
+  8048d2:	41 5f                	pop    %r15
+  8048d4:	5d                   	pop    %rbp
+  8048d5:	c3                   	ret
+
+00000000008048d6 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8048d6:	55                   	push   %rbp
+  8048d7:	48 89 e5             	mov    %rsp,%rbp
+  8048da:	48 83 ec 10          	sub    $0x10,%rsp
+  8048de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8048de <nsipc_socket+0x8>
+  8048e5:	49 bb 52 37 00 00 00 	movabs $0x3752,%r11
+  8048ec:	00 00 00 
+  8048ef:	4c 01 d8             	add    %r11,%rax
+  8048f2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8048f5:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8048f8:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8048fb:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804902:	00 00 00 
+  804905:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804908:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  80490b:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804912:	00 00 00 
+  804915:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804918:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  80491c:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804923:	00 00 00 
+  804926:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804929:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  80492d:	bf 09 00 00 00       	mov    $0x9,%edi
+  804932:	48 ba bb c1 ff ff ff 	movabs $0xffffffffffffc1bb,%rdx
+  804939:	ff ff ff 
+  80493c:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804940:	ff d0                	call   *%rax
+}
+  804942:	c9                   	leave
+  804943:	c3                   	ret
+
+0000000000804944 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804944:	55                   	push   %rbp
+  804945:	48 89 e5             	mov    %rsp,%rbp
+  804948:	41 57                	push   %r15
+  80494a:	53                   	push   %rbx
+  80494b:	48 83 ec 30          	sub    $0x30,%rsp
+  80494f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80494f <pipe+0xb>
+  804956:	49 bb e1 36 00 00 00 	movabs $0x36e1,%r11
+  80495d:	00 00 00 
+  804960:	4c 01 db             	add    %r11,%rbx
+  804963:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804967:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  80496b:	48 89 c7             	mov    %rax,%rdi
+  80496e:	49 89 df             	mov    %rbx,%r15
+  804971:	48 b8 d5 a5 ff ff ff 	movabs $0xffffffffffffa5d5,%rax
+  804978:	ff ff ff 
+  80497b:	48 01 d8             	add    %rbx,%rax
+  80497e:	ff d0                	call   *%rax
+  804980:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804983:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804987:	0f 88 12 02 00 00    	js     804b9f <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80498d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804991:	ba 07 04 00 00       	mov    $0x407,%edx
+  804996:	48 89 c6             	mov    %rax,%rsi
+  804999:	bf 00 00 00 00       	mov    $0x0,%edi
+  80499e:	49 89 df             	mov    %rbx,%r15
+  8049a1:	48 b8 b2 9d ff ff ff 	movabs $0xffffffffffff9db2,%rax
+  8049a8:	ff ff ff 
+  8049ab:	48 01 d8             	add    %rbx,%rax
+  8049ae:	ff d0                	call   *%rax
+  8049b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049b7:	0f 88 e2 01 00 00    	js     804b9f <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8049bd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8049c1:	48 89 c7             	mov    %rax,%rdi
+  8049c4:	49 89 df             	mov    %rbx,%r15
+  8049c7:	48 b8 d5 a5 ff ff ff 	movabs $0xffffffffffffa5d5,%rax
+  8049ce:	ff ff ff 
+  8049d1:	48 01 d8             	add    %rbx,%rax
+  8049d4:	ff d0                	call   *%rax
+  8049d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049dd:	0f 88 9b 01 00 00    	js     804b7e <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8049e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049e7:	ba 07 04 00 00       	mov    $0x407,%edx
+  8049ec:	48 89 c6             	mov    %rax,%rsi
+  8049ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049f4:	49 89 df             	mov    %rbx,%r15
+  8049f7:	48 b8 b2 9d ff ff ff 	movabs $0xffffffffffff9db2,%rax
+  8049fe:	ff ff ff 
+  804a01:	48 01 d8             	add    %rbx,%rax
+  804a04:	ff d0                	call   *%rax
+  804a06:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a09:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a0d:	0f 88 6b 01 00 00    	js     804b7e <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804a13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a17:	48 89 c7             	mov    %rax,%rdi
+  804a1a:	49 89 df             	mov    %rbx,%r15
+  804a1d:	48 b8 92 a5 ff ff ff 	movabs $0xffffffffffffa592,%rax
+  804a24:	ff ff ff 
+  804a27:	48 01 d8             	add    %rbx,%rax
+  804a2a:	ff d0                	call   *%rax
+  804a2c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804a30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a34:	ba 07 04 00 00       	mov    $0x407,%edx
+  804a39:	48 89 c6             	mov    %rax,%rsi
+  804a3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a41:	49 89 df             	mov    %rbx,%r15
+  804a44:	48 b8 b2 9d ff ff ff 	movabs $0xffffffffffff9db2,%rax
+  804a4b:	ff ff ff 
+  804a4e:	48 01 d8             	add    %rbx,%rax
+  804a51:	ff d0                	call   *%rax
+  804a53:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a56:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a5a:	0f 88 fd 00 00 00    	js     804b5d <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804a60:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a64:	48 89 c7             	mov    %rax,%rdi
+  804a67:	49 89 df             	mov    %rbx,%r15
+  804a6a:	48 b8 92 a5 ff ff ff 	movabs $0xffffffffffffa592,%rax
+  804a71:	ff ff ff 
+  804a74:	48 01 d8             	add    %rbx,%rax
+  804a77:	ff d0                	call   *%rax
+  804a79:	48 89 c2             	mov    %rax,%rdx
+  804a7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a80:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804a86:	48 89 d1             	mov    %rdx,%rcx
+  804a89:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a8e:	48 89 c6             	mov    %rax,%rsi
+  804a91:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a96:	49 89 df             	mov    %rbx,%r15
+  804a99:	48 b8 17 9e ff ff ff 	movabs $0xffffffffffff9e17,%rax
+  804aa0:	ff ff ff 
+  804aa3:	48 01 d8             	add    %rbx,%rax
+  804aa6:	ff d0                	call   *%rax
+  804aa8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804aab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804aaf:	0f 88 87 00 00 00    	js     804b3c <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804ab5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ab9:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804ac0:	00 00 00 
+  804ac3:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804ac6:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804ac8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804acc:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804ad3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ad7:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804ade:	00 00 00 
+  804ae1:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804ae4:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804ae6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804aea:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804af1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804af5:	48 89 c7             	mov    %rax,%rdi
+  804af8:	49 89 df             	mov    %rbx,%r15
+  804afb:	48 b8 5b a5 ff ff ff 	movabs $0xffffffffffffa55b,%rax
+  804b02:	ff ff ff 
+  804b05:	48 01 d8             	add    %rbx,%rax
+  804b08:	ff d0                	call   *%rax
+  804b0a:	89 c2                	mov    %eax,%edx
+  804b0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b10:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804b12:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b16:	48 89 c7             	mov    %rax,%rdi
+  804b19:	49 89 df             	mov    %rbx,%r15
+  804b1c:	48 b8 5b a5 ff ff ff 	movabs $0xffffffffffffa55b,%rax
+  804b23:	ff ff ff 
+  804b26:	48 01 d8             	add    %rbx,%rax
+  804b29:	ff d0                	call   *%rax
+  804b2b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b2f:	48 83 c2 04          	add    $0x4,%rdx
+  804b33:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b3a:	eb 67                	jmp    804ba3 <pipe+0x25f>
+		goto err3;
+  804b3c:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804b3d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b41:	48 89 c6             	mov    %rax,%rsi
+  804b44:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b49:	49 89 df             	mov    %rbx,%r15
+  804b4c:	48 b8 8a 9e ff ff ff 	movabs $0xffffffffffff9e8a,%rax
+  804b53:	ff ff ff 
+  804b56:	48 01 d8             	add    %rbx,%rax
+  804b59:	ff d0                	call   *%rax
+  804b5b:	eb 01                	jmp    804b5e <pipe+0x21a>
+		goto err2;
+  804b5d:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804b5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b62:	48 89 c6             	mov    %rax,%rsi
+  804b65:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b6a:	49 89 df             	mov    %rbx,%r15
+  804b6d:	48 b8 8a 9e ff ff ff 	movabs $0xffffffffffff9e8a,%rax
+  804b74:	ff ff ff 
+  804b77:	48 01 d8             	add    %rbx,%rax
+  804b7a:	ff d0                	call   *%rax
+  804b7c:	eb 01                	jmp    804b7f <pipe+0x23b>
+		goto err1;
+  804b7e:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804b7f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b83:	48 89 c6             	mov    %rax,%rsi
+  804b86:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b8b:	49 89 df             	mov    %rbx,%r15
+  804b8e:	48 b8 8a 9e ff ff ff 	movabs $0xffffffffffff9e8a,%rax
+  804b95:	ff ff ff 
+  804b98:	48 01 d8             	add    %rbx,%rax
+  804b9b:	ff d0                	call   *%rax
+  804b9d:	eb 01                	jmp    804ba0 <pipe+0x25c>
+		goto err;
+  804b9f:	90                   	nop
+err:
+	return r;
+  804ba0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804ba3:	48 83 c4 30          	add    $0x30,%rsp
+  804ba7:	5b                   	pop    %rbx
+  804ba8:	41 5f                	pop    %r15
+  804baa:	5d                   	pop    %rbp
+  804bab:	c3                   	ret
+
+0000000000804bac <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804bac:	55                   	push   %rbp
+  804bad:	48 89 e5             	mov    %rsp,%rbp
+  804bb0:	41 57                	push   %r15
+  804bb2:	41 54                	push   %r12
+  804bb4:	53                   	push   %rbx
+  804bb5:	48 83 ec 28          	sub    $0x28,%rsp
+  804bb9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804bb9 <_pipeisclosed+0xd>
+  804bc0:	49 bb 77 34 00 00 00 	movabs $0x3477,%r11
+  804bc7:	00 00 00 
+  804bca:	4c 01 db             	add    %r11,%rbx
+  804bcd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804bd1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804bd5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804bdc:	ff ff ff 
+  804bdf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804be3:	48 8b 00             	mov    (%rax),%rax
+  804be6:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804bec:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  804bef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bf3:	48 89 c7             	mov    %rax,%rdi
+  804bf6:	49 89 df             	mov    %rbx,%r15
+  804bf9:	48 b8 89 dd ff ff ff 	movabs $0xffffffffffffdd89,%rax
+  804c00:	ff ff ff 
+  804c03:	48 01 d8             	add    %rbx,%rax
+  804c06:	ff d0                	call   *%rax
+  804c08:	41 89 c4             	mov    %eax,%r12d
+  804c0b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c0f:	48 89 c7             	mov    %rax,%rdi
+  804c12:	49 89 df             	mov    %rbx,%r15
+  804c15:	48 b8 89 dd ff ff ff 	movabs $0xffffffffffffdd89,%rax
+  804c1c:	ff ff ff 
+  804c1f:	48 01 d8             	add    %rbx,%rax
+  804c22:	ff d0                	call   *%rax
+  804c24:	41 39 c4             	cmp    %eax,%r12d
+  804c27:	0f 94 c0             	sete   %al
+  804c2a:	0f b6 c0             	movzbl %al,%eax
+  804c2d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  804c30:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804c37:	ff ff ff 
+  804c3a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804c3e:	48 8b 00             	mov    (%rax),%rax
+  804c41:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804c47:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  804c4a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c4d:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804c50:	75 05                	jne    804c57 <_pipeisclosed+0xab>
+			return ret;
+  804c52:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804c55:	eb 63                	jmp    804cba <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  804c57:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c5a:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804c5d:	0f 84 72 ff ff ff    	je     804bd5 <_pipeisclosed+0x29>
+  804c63:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  804c67:	0f 85 68 ff ff ff    	jne    804bd5 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804c6d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804c74:	ff ff ff 
+  804c77:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804c7b:	48 8b 00             	mov    (%rax),%rax
+  804c7e:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  804c84:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804c87:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c8a:	89 c6                	mov    %eax,%esi
+  804c8c:	48 b8 ce e3 ff ff ff 	movabs $0xffffffffffffe3ce,%rax
+  804c93:	ff ff ff 
+  804c96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c9a:	48 89 c7             	mov    %rax,%rdi
+  804c9d:	49 89 df             	mov    %rbx,%r15
+  804ca0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ca5:	49 b8 34 83 ff ff ff 	movabs $0xffffffffffff8334,%r8
+  804cac:	ff ff ff 
+  804caf:	49 01 d8             	add    %rbx,%r8
+  804cb2:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  804cb5:	e9 1b ff ff ff       	jmp    804bd5 <_pipeisclosed+0x29>
+	}
+}
+  804cba:	48 83 c4 28          	add    $0x28,%rsp
+  804cbe:	5b                   	pop    %rbx
+  804cbf:	41 5c                	pop    %r12
+  804cc1:	41 5f                	pop    %r15
+  804cc3:	5d                   	pop    %rbp
+  804cc4:	c3                   	ret
+
+0000000000804cc5 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  804cc5:	55                   	push   %rbp
+  804cc6:	48 89 e5             	mov    %rsp,%rbp
+  804cc9:	41 57                	push   %r15
+  804ccb:	53                   	push   %rbx
+  804ccc:	48 83 ec 30          	sub    $0x30,%rsp
+  804cd0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cd0 <pipeisclosed+0xb>
+  804cd7:	49 bb 60 33 00 00 00 	movabs $0x3360,%r11
+  804cde:	00 00 00 
+  804ce1:	4c 01 db             	add    %r11,%rbx
+  804ce4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ce7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804ceb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804cee:	48 89 d6             	mov    %rdx,%rsi
+  804cf1:	89 c7                	mov    %eax,%edi
+  804cf3:	49 89 df             	mov    %rbx,%r15
+  804cf6:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  804cfd:	ff ff ff 
+  804d00:	48 01 d8             	add    %rbx,%rax
+  804d03:	ff d0                	call   *%rax
+  804d05:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d08:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d0c:	79 05                	jns    804d13 <pipeisclosed+0x4e>
+		return r;
+  804d0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d11:	eb 3b                	jmp    804d4e <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  804d13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d17:	48 89 c7             	mov    %rax,%rdi
+  804d1a:	49 89 df             	mov    %rbx,%r15
+  804d1d:	48 b8 92 a5 ff ff ff 	movabs $0xffffffffffffa592,%rax
+  804d24:	ff ff ff 
+  804d27:	48 01 d8             	add    %rbx,%rax
+  804d2a:	ff d0                	call   *%rax
+  804d2c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  804d30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d34:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804d38:	48 89 d6             	mov    %rdx,%rsi
+  804d3b:	48 89 c7             	mov    %rax,%rdi
+  804d3e:	48 b8 7c cb ff ff ff 	movabs $0xffffffffffffcb7c,%rax
+  804d45:	ff ff ff 
+  804d48:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d4c:	ff d0                	call   *%rax
+}
+  804d4e:	48 83 c4 30          	add    $0x30,%rsp
+  804d52:	5b                   	pop    %rbx
+  804d53:	41 5f                	pop    %r15
+  804d55:	5d                   	pop    %rbp
+  804d56:	c3                   	ret
+
+0000000000804d57 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  804d57:	55                   	push   %rbp
+  804d58:	48 89 e5             	mov    %rsp,%rbp
+  804d5b:	41 57                	push   %r15
+  804d5d:	53                   	push   %rbx
+  804d5e:	48 83 ec 40          	sub    $0x40,%rsp
+  804d62:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d62 <devpipe_read+0xb>
+  804d69:	49 bb ce 32 00 00 00 	movabs $0x32ce,%r11
+  804d70:	00 00 00 
+  804d73:	4c 01 db             	add    %r11,%rbx
+  804d76:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804d7a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804d7e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  804d82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d86:	48 89 c7             	mov    %rax,%rdi
+  804d89:	49 89 df             	mov    %rbx,%r15
+  804d8c:	48 b8 92 a5 ff ff ff 	movabs $0xffffffffffffa592,%rax
+  804d93:	ff ff ff 
+  804d96:	48 01 d8             	add    %rbx,%rax
+  804d99:	ff d0                	call   *%rax
+  804d9b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  804d9f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804da3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  804da7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804dae:	00 
+  804daf:	e9 a1 00 00 00       	jmp    804e55 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  804db4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804db9:	74 09                	je     804dc4 <devpipe_read+0x6d>
+				return i;
+  804dbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804dbf:	e9 9f 00 00 00       	jmp    804e63 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  804dc4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804dc8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dcc:	48 89 d6             	mov    %rdx,%rsi
+  804dcf:	48 89 c7             	mov    %rax,%rdi
+  804dd2:	48 b8 7c cb ff ff ff 	movabs $0xffffffffffffcb7c,%rax
+  804dd9:	ff ff ff 
+  804ddc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804de0:	ff d0                	call   *%rax
+  804de2:	85 c0                	test   %eax,%eax
+  804de4:	74 07                	je     804ded <devpipe_read+0x96>
+				return 0;
+  804de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804deb:	eb 76                	jmp    804e63 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  804ded:	49 89 df             	mov    %rbx,%r15
+  804df0:	48 b8 5d 9d ff ff ff 	movabs $0xffffffffffff9d5d,%rax
+  804df7:	ff ff ff 
+  804dfa:	48 01 d8             	add    %rbx,%rax
+  804dfd:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  804dff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e03:	8b 10                	mov    (%rax),%edx
+  804e05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e09:	8b 40 04             	mov    0x4(%rax),%eax
+  804e0c:	39 c2                	cmp    %eax,%edx
+  804e0e:	74 a4                	je     804db4 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804e10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e14:	8b 10                	mov    (%rax),%edx
+  804e16:	89 d0                	mov    %edx,%eax
+  804e18:	c1 f8 1f             	sar    $0x1f,%eax
+  804e1b:	c1 e8 1b             	shr    $0x1b,%eax
+  804e1e:	01 c2                	add    %eax,%edx
+  804e20:	83 e2 1f             	and    $0x1f,%edx
+  804e23:	29 c2                	sub    %eax,%edx
+  804e25:	89 d6                	mov    %edx,%esi
+  804e27:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804e2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e2f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804e33:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e37:	48 63 c6             	movslq %esi,%rax
+  804e3a:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  804e3f:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  804e41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e45:	8b 00                	mov    (%rax),%eax
+  804e47:	8d 50 01             	lea    0x1(%rax),%edx
+  804e4a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e4e:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  804e50:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804e55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e59:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  804e5d:	72 a0                	jb     804dff <devpipe_read+0xa8>
+	}
+	return i;
+  804e5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804e63:	48 83 c4 40          	add    $0x40,%rsp
+  804e67:	5b                   	pop    %rbx
+  804e68:	41 5f                	pop    %r15
+  804e6a:	5d                   	pop    %rbp
+  804e6b:	c3                   	ret
+
+0000000000804e6c <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  804e6c:	55                   	push   %rbp
+  804e6d:	48 89 e5             	mov    %rsp,%rbp
+  804e70:	41 57                	push   %r15
+  804e72:	53                   	push   %rbx
+  804e73:	48 83 ec 40          	sub    $0x40,%rsp
+  804e77:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e77 <devpipe_write+0xb>
+  804e7e:	49 bb b9 31 00 00 00 	movabs $0x31b9,%r11
+  804e85:	00 00 00 
+  804e88:	4c 01 db             	add    %r11,%rbx
+  804e8b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804e8f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804e93:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  804e97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e9b:	48 89 c7             	mov    %rax,%rdi
+  804e9e:	49 89 df             	mov    %rbx,%r15
+  804ea1:	48 b8 92 a5 ff ff ff 	movabs $0xffffffffffffa592,%rax
+  804ea8:	ff ff ff 
+  804eab:	48 01 d8             	add    %rbx,%rax
+  804eae:	ff d0                	call   *%rax
+  804eb0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  804eb4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804eb8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  804ebc:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804ec3:	00 
+  804ec4:	e9 a0 00 00 00       	jmp    804f69 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  804ec9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804ecd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ed1:	48 89 d6             	mov    %rdx,%rsi
+  804ed4:	48 89 c7             	mov    %rax,%rdi
+  804ed7:	48 b8 7c cb ff ff ff 	movabs $0xffffffffffffcb7c,%rax
+  804ede:	ff ff ff 
+  804ee1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ee5:	ff d0                	call   *%rax
+  804ee7:	85 c0                	test   %eax,%eax
+  804ee9:	74 0a                	je     804ef5 <devpipe_write+0x89>
+				return 0;
+  804eeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ef0:	e9 82 00 00 00       	jmp    804f77 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  804ef5:	49 89 df             	mov    %rbx,%r15
+  804ef8:	48 b8 5d 9d ff ff ff 	movabs $0xffffffffffff9d5d,%rax
+  804eff:	ff ff ff 
+  804f02:	48 01 d8             	add    %rbx,%rax
+  804f05:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  804f07:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f0b:	8b 40 04             	mov    0x4(%rax),%eax
+  804f0e:	48 63 d0             	movslq %eax,%rdx
+  804f11:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f15:	8b 00                	mov    (%rax),%eax
+  804f17:	48 98                	cltq
+  804f19:	48 83 c0 20          	add    $0x20,%rax
+  804f1d:	48 39 c2             	cmp    %rax,%rdx
+  804f20:	73 a7                	jae    804ec9 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804f22:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2a:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804f2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f32:	8b 50 04             	mov    0x4(%rax),%edx
+  804f35:	89 d0                	mov    %edx,%eax
+  804f37:	c1 f8 1f             	sar    $0x1f,%eax
+  804f3a:	c1 e8 1b             	shr    $0x1b,%eax
+  804f3d:	01 c2                	add    %eax,%edx
+  804f3f:	83 e2 1f             	and    $0x1f,%edx
+  804f42:	29 c2                	sub    %eax,%edx
+  804f44:	89 d0                	mov    %edx,%eax
+  804f46:	0f b6 09             	movzbl (%rcx),%ecx
+  804f49:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f4d:	48 98                	cltq
+  804f4f:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  804f53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f57:	8b 40 04             	mov    0x4(%rax),%eax
+  804f5a:	8d 50 01             	lea    0x1(%rax),%edx
+  804f5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f61:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  804f64:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804f69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f6d:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  804f71:	72 94                	jb     804f07 <devpipe_write+0x9b>
+	}
+
+	return i;
+  804f73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  804f77:	48 83 c4 40          	add    $0x40,%rsp
+  804f7b:	5b                   	pop    %rbx
+  804f7c:	41 5f                	pop    %r15
+  804f7e:	5d                   	pop    %rbp
+  804f7f:	c3                   	ret
+
+0000000000804f80 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  804f80:	55                   	push   %rbp
+  804f81:	48 89 e5             	mov    %rsp,%rbp
+  804f84:	41 57                	push   %r15
+  804f86:	53                   	push   %rbx
+  804f87:	48 83 ec 20          	sub    $0x20,%rsp
+  804f8b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f8b <devpipe_stat+0xb>
+  804f92:	49 bb a5 30 00 00 00 	movabs $0x30a5,%r11
+  804f99:	00 00 00 
+  804f9c:	4c 01 db             	add    %r11,%rbx
+  804f9f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804fa3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804fa7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fab:	48 89 c7             	mov    %rax,%rdi
+  804fae:	49 89 df             	mov    %rbx,%r15
+  804fb1:	48 b8 92 a5 ff ff ff 	movabs $0xffffffffffffa592,%rax
+  804fb8:	ff ff ff 
+  804fbb:	48 01 d8             	add    %rbx,%rax
+  804fbe:	ff d0                	call   *%rax
+  804fc0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  804fc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fc8:	48 ba e1 e3 ff ff ff 	movabs $0xffffffffffffe3e1,%rdx
+  804fcf:	ff ff ff 
+  804fd2:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804fd6:	48 89 d6             	mov    %rdx,%rsi
+  804fd9:	48 89 c7             	mov    %rax,%rdi
+  804fdc:	49 89 df             	mov    %rbx,%r15
+  804fdf:	48 b8 f6 90 ff ff ff 	movabs $0xffffffffffff90f6,%rax
+  804fe6:	ff ff ff 
+  804fe9:	48 01 d8             	add    %rbx,%rax
+  804fec:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  804fee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff2:	8b 50 04             	mov    0x4(%rax),%edx
+  804ff5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff9:	8b 00                	mov    (%rax),%eax
+  804ffb:	29 c2                	sub    %eax,%edx
+  804ffd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805001:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805007:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80500b:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805012:	00 00 00 
+	stat->st_dev = &devpipe;
+  805015:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805019:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805020:	00 00 00 
+  805023:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805027:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80502e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805033:	48 83 c4 20          	add    $0x20,%rsp
+  805037:	5b                   	pop    %rbx
+  805038:	41 5f                	pop    %r15
+  80503a:	5d                   	pop    %rbp
+  80503b:	c3                   	ret
+
+000000000080503c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80503c:	55                   	push   %rbp
+  80503d:	48 89 e5             	mov    %rsp,%rbp
+  805040:	41 57                	push   %r15
+  805042:	53                   	push   %rbx
+  805043:	48 83 ec 10          	sub    $0x10,%rsp
+  805047:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805047 <devpipe_close+0xb>
+  80504e:	49 bb e9 2f 00 00 00 	movabs $0x2fe9,%r11
+  805055:	00 00 00 
+  805058:	4c 01 db             	add    %r11,%rbx
+  80505b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80505f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805063:	48 89 c6             	mov    %rax,%rsi
+  805066:	bf 00 00 00 00       	mov    $0x0,%edi
+  80506b:	49 89 df             	mov    %rbx,%r15
+  80506e:	48 b8 8a 9e ff ff ff 	movabs $0xffffffffffff9e8a,%rax
+  805075:	ff ff ff 
+  805078:	48 01 d8             	add    %rbx,%rax
+  80507b:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80507d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805081:	48 89 c7             	mov    %rax,%rdi
+  805084:	49 89 df             	mov    %rbx,%r15
+  805087:	48 b8 92 a5 ff ff ff 	movabs $0xffffffffffffa592,%rax
+  80508e:	ff ff ff 
+  805091:	48 01 d8             	add    %rbx,%rax
+  805094:	ff d0                	call   *%rax
+  805096:	48 89 c6             	mov    %rax,%rsi
+  805099:	bf 00 00 00 00       	mov    $0x0,%edi
+  80509e:	49 89 df             	mov    %rbx,%r15
+  8050a1:	48 b8 8a 9e ff ff ff 	movabs $0xffffffffffff9e8a,%rax
+  8050a8:	ff ff ff 
+  8050ab:	48 01 d8             	add    %rbx,%rax
+  8050ae:	ff d0                	call   *%rax
+}
+  8050b0:	48 83 c4 10          	add    $0x10,%rsp
+  8050b4:	5b                   	pop    %rbx
+  8050b5:	41 5f                	pop    %r15
+  8050b7:	5d                   	pop    %rbp
+  8050b8:	c3                   	ret
+
+00000000008050b9 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8050b9:	55                   	push   %rbp
+  8050ba:	48 89 e5             	mov    %rsp,%rbp
+  8050bd:	41 57                	push   %r15
+  8050bf:	48 83 ec 28          	sub    $0x28,%rsp
+  8050c3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050c3 <cputchar+0xa>
+  8050ca:	49 bb 6d 2f 00 00 00 	movabs $0x2f6d,%r11
+  8050d1:	00 00 00 
+  8050d4:	4c 01 d8             	add    %r11,%rax
+  8050d7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8050da:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8050dd:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8050e0:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8050e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8050e9:	48 89 d7             	mov    %rdx,%rdi
+  8050ec:	49 89 c7             	mov    %rax,%r15
+  8050ef:	48 ba fa 9b ff ff ff 	movabs $0xffffffffffff9bfa,%rdx
+  8050f6:	ff ff ff 
+  8050f9:	48 01 c2             	add    %rax,%rdx
+  8050fc:	ff d2                	call   *%rdx
+}
+  8050fe:	90                   	nop
+  8050ff:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805103:	c9                   	leave
+  805104:	c3                   	ret
+
+0000000000805105 <getchar>:
+
+int
+getchar(void)
+{
+  805105:	55                   	push   %rbp
+  805106:	48 89 e5             	mov    %rsp,%rbp
+  805109:	41 57                	push   %r15
+  80510b:	48 83 ec 18          	sub    $0x18,%rsp
+  80510f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80510f <getchar+0xa>
+  805116:	49 bb 21 2f 00 00 00 	movabs $0x2f21,%r11
+  80511d:	00 00 00 
+  805120:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805123:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805127:	ba 01 00 00 00       	mov    $0x1,%edx
+  80512c:	48 89 ce             	mov    %rcx,%rsi
+  80512f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805134:	49 89 c7             	mov    %rax,%r15
+  805137:	48 b9 d2 ab ff ff ff 	movabs $0xffffffffffffabd2,%rcx
+  80513e:	ff ff ff 
+  805141:	48 01 c1             	add    %rax,%rcx
+  805144:	ff d1                	call   *%rcx
+  805146:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  805149:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80514d:	79 05                	jns    805154 <getchar+0x4f>
+		return r;
+  80514f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805152:	eb 14                	jmp    805168 <getchar+0x63>
+	if (r < 1)
+  805154:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805158:	7f 07                	jg     805161 <getchar+0x5c>
+		return -E_EOF;
+  80515a:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80515f:	eb 07                	jmp    805168 <getchar+0x63>
+	return c;
+  805161:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805165:	0f b6 c0             	movzbl %al,%eax
+}
+  805168:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80516c:	c9                   	leave
+  80516d:	c3                   	ret
+
+000000000080516e <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80516e:	55                   	push   %rbp
+  80516f:	48 89 e5             	mov    %rsp,%rbp
+  805172:	41 57                	push   %r15
+  805174:	53                   	push   %rbx
+  805175:	48 83 ec 20          	sub    $0x20,%rsp
+  805179:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805179 <iscons+0xb>
+  805180:	49 bb b7 2e 00 00 00 	movabs $0x2eb7,%r11
+  805187:	00 00 00 
+  80518a:	4c 01 db             	add    %r11,%rbx
+  80518d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805190:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805194:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805197:	48 89 d6             	mov    %rdx,%rsi
+  80519a:	89 c7                	mov    %eax,%edi
+  80519c:	49 89 df             	mov    %rbx,%r15
+  80519f:	48 b8 8b a6 ff ff ff 	movabs $0xffffffffffffa68b,%rax
+  8051a6:	ff ff ff 
+  8051a9:	48 01 d8             	add    %rbx,%rax
+  8051ac:	ff d0                	call   *%rax
+  8051ae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051b1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051b5:	79 05                	jns    8051bc <iscons+0x4e>
+		return r;
+  8051b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051ba:	eb 1b                	jmp    8051d7 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8051bc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051c0:	8b 10                	mov    (%rax),%edx
+  8051c2:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  8051c9:	00 00 00 
+  8051cc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8051cf:	39 c2                	cmp    %eax,%edx
+  8051d1:	0f 94 c0             	sete   %al
+  8051d4:	0f b6 c0             	movzbl %al,%eax
+}
+  8051d7:	48 83 c4 20          	add    $0x20,%rsp
+  8051db:	5b                   	pop    %rbx
+  8051dc:	41 5f                	pop    %r15
+  8051de:	5d                   	pop    %rbp
+  8051df:	c3                   	ret
+
+00000000008051e0 <opencons>:
+
+int
+opencons(void)
+{
+  8051e0:	55                   	push   %rbp
+  8051e1:	48 89 e5             	mov    %rsp,%rbp
+  8051e4:	41 57                	push   %r15
+  8051e6:	53                   	push   %rbx
+  8051e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8051eb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051eb <opencons+0xb>
+  8051f2:	49 bb 45 2e 00 00 00 	movabs $0x2e45,%r11
+  8051f9:	00 00 00 
+  8051fc:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8051ff:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805203:	48 89 c7             	mov    %rax,%rdi
+  805206:	49 89 df             	mov    %rbx,%r15
+  805209:	48 b8 d5 a5 ff ff ff 	movabs $0xffffffffffffa5d5,%rax
+  805210:	ff ff ff 
+  805213:	48 01 d8             	add    %rbx,%rax
+  805216:	ff d0                	call   *%rax
+  805218:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80521b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80521f:	79 05                	jns    805226 <opencons+0x46>
+		return r;
+  805221:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805224:	eb 68                	jmp    80528e <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805226:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80522a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80522f:	48 89 c6             	mov    %rax,%rsi
+  805232:	bf 00 00 00 00       	mov    $0x0,%edi
+  805237:	49 89 df             	mov    %rbx,%r15
+  80523a:	48 b8 b2 9d ff ff ff 	movabs $0xffffffffffff9db2,%rax
+  805241:	ff ff ff 
+  805244:	48 01 d8             	add    %rbx,%rax
+  805247:	ff d0                	call   *%rax
+  805249:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80524c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805250:	79 05                	jns    805257 <opencons+0x77>
+		return r;
+  805252:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805255:	eb 37                	jmp    80528e <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805257:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80525b:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  805262:	00 00 00 
+  805265:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805268:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80526a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80526e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805275:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805279:	48 89 c7             	mov    %rax,%rdi
+  80527c:	49 89 df             	mov    %rbx,%r15
+  80527f:	48 b8 5b a5 ff ff ff 	movabs $0xffffffffffffa55b,%rax
+  805286:	ff ff ff 
+  805289:	48 01 d8             	add    %rbx,%rax
+  80528c:	ff d0                	call   *%rax
+}
+  80528e:	48 83 c4 10          	add    $0x10,%rsp
+  805292:	5b                   	pop    %rbx
+  805293:	41 5f                	pop    %r15
+  805295:	5d                   	pop    %rbp
+  805296:	c3                   	ret
+
+0000000000805297 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805297:	55                   	push   %rbp
+  805298:	48 89 e5             	mov    %rsp,%rbp
+  80529b:	41 57                	push   %r15
+  80529d:	53                   	push   %rbx
+  80529e:	48 83 ec 30          	sub    $0x30,%rsp
+  8052a2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052a2 <devcons_read+0xb>
+  8052a9:	49 bb 8e 2d 00 00 00 	movabs $0x2d8e,%r11
+  8052b0:	00 00 00 
+  8052b3:	4c 01 db             	add    %r11,%rbx
+  8052b6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8052ba:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8052be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8052c2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8052c7:	75 19                	jne    8052e2 <devcons_read+0x4b>
+		return 0;
+  8052c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052ce:	eb 55                	jmp    805325 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8052d0:	49 89 df             	mov    %rbx,%r15
+  8052d3:	48 b8 5d 9d ff ff ff 	movabs $0xffffffffffff9d5d,%rax
+  8052da:	ff ff ff 
+  8052dd:	48 01 d8             	add    %rbx,%rax
+  8052e0:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8052e2:	49 89 df             	mov    %rbx,%r15
+  8052e5:	48 b8 59 9c ff ff ff 	movabs $0xffffffffffff9c59,%rax
+  8052ec:	ff ff ff 
+  8052ef:	48 01 d8             	add    %rbx,%rax
+  8052f2:	ff d0                	call   *%rax
+  8052f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052fb:	74 d3                	je     8052d0 <devcons_read+0x39>
+	if (c < 0)
+  8052fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805301:	79 05                	jns    805308 <devcons_read+0x71>
+		return c;
+  805303:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805306:	eb 1d                	jmp    805325 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  805308:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80530c:	75 07                	jne    805315 <devcons_read+0x7e>
+		return 0;
+  80530e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805313:	eb 10                	jmp    805325 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805315:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805318:	89 c2                	mov    %eax,%edx
+  80531a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80531e:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805320:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805325:	48 83 c4 30          	add    $0x30,%rsp
+  805329:	5b                   	pop    %rbx
+  80532a:	41 5f                	pop    %r15
+  80532c:	5d                   	pop    %rbp
+  80532d:	c3                   	ret
+
+000000000080532e <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80532e:	55                   	push   %rbp
+  80532f:	48 89 e5             	mov    %rsp,%rbp
+  805332:	41 57                	push   %r15
+  805334:	53                   	push   %rbx
+  805335:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80533c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80533c <devcons_write+0xe>
+  805343:	49 bb f4 2c 00 00 00 	movabs $0x2cf4,%r11
+  80534a:	00 00 00 
+  80534d:	4c 01 db             	add    %r11,%rbx
+  805350:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  805357:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  80535e:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805365:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80536c:	e9 80 00 00 00       	jmp    8053f1 <devcons_write+0xc3>
+		m = n - tot;
+  805371:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805378:	89 c2                	mov    %eax,%edx
+  80537a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80537d:	29 c2                	sub    %eax,%edx
+  80537f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  805382:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805385:	83 f8 7f             	cmp    $0x7f,%eax
+  805388:	76 07                	jbe    805391 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  80538a:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  805391:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805394:	48 63 d0             	movslq %eax,%rdx
+  805397:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80539a:	48 63 c8             	movslq %eax,%rcx
+  80539d:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8053a4:	48 01 c1             	add    %rax,%rcx
+  8053a7:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8053ae:	48 89 ce             	mov    %rcx,%rsi
+  8053b1:	48 89 c7             	mov    %rax,%rdi
+  8053b4:	49 89 df             	mov    %rbx,%r15
+  8053b7:	48 b8 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rax
+  8053be:	ff ff ff 
+  8053c1:	48 01 d8             	add    %rbx,%rax
+  8053c4:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8053c6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053c9:	48 63 d0             	movslq %eax,%rdx
+  8053cc:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8053d3:	48 89 d6             	mov    %rdx,%rsi
+  8053d6:	48 89 c7             	mov    %rax,%rdi
+  8053d9:	49 89 df             	mov    %rbx,%r15
+  8053dc:	48 b8 fa 9b ff ff ff 	movabs $0xffffffffffff9bfa,%rax
+  8053e3:	ff ff ff 
+  8053e6:	48 01 d8             	add    %rbx,%rax
+  8053e9:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8053eb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053ee:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8053f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053f4:	48 98                	cltq
+  8053f6:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8053fd:	0f 82 6e ff ff ff    	jb     805371 <devcons_write+0x43>
+	}
+	return tot;
+  805403:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805406:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  80540d:	5b                   	pop    %rbx
+  80540e:	41 5f                	pop    %r15
+  805410:	5d                   	pop    %rbp
+  805411:	c3                   	ret
+
+0000000000805412 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  805412:	55                   	push   %rbp
+  805413:	48 89 e5             	mov    %rsp,%rbp
+  805416:	48 83 ec 08          	sub    $0x8,%rsp
+  80541a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80541a <devcons_close+0x8>
+  805421:	49 bb 16 2c 00 00 00 	movabs $0x2c16,%r11
+  805428:	00 00 00 
+  80542b:	4c 01 d8             	add    %r11,%rax
+  80542e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  805432:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805437:	c9                   	leave
+  805438:	c3                   	ret
+
+0000000000805439 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805439:	55                   	push   %rbp
+  80543a:	48 89 e5             	mov    %rsp,%rbp
+  80543d:	41 57                	push   %r15
+  80543f:	48 83 ec 18          	sub    $0x18,%rsp
+  805443:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805443 <devcons_stat+0xa>
+  80544a:	49 bb ed 2b 00 00 00 	movabs $0x2bed,%r11
+  805451:	00 00 00 
+  805454:	4c 01 d8             	add    %r11,%rax
+  805457:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80545b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80545f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805463:	48 b9 ed e3 ff ff ff 	movabs $0xffffffffffffe3ed,%rcx
+  80546a:	ff ff ff 
+  80546d:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805471:	48 89 ce             	mov    %rcx,%rsi
+  805474:	48 89 d7             	mov    %rdx,%rdi
+  805477:	49 89 c7             	mov    %rax,%r15
+  80547a:	48 ba f6 90 ff ff ff 	movabs $0xffffffffffff90f6,%rdx
+  805481:	ff ff ff 
+  805484:	48 01 c2             	add    %rax,%rdx
+  805487:	ff d2                	call   *%rdx
+	return 0;
+  805489:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80548e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805492:	c9                   	leave
+  805493:	c3                   	ret
+
+0000000000805494 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  805494:	55                   	push   %rbp
+  805495:	48 89 e5             	mov    %rsp,%rbp
+  805498:	41 57                	push   %r15
+  80549a:	41 54                	push   %r12
+  80549c:	53                   	push   %rbx
+  80549d:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8054a4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054a4 <_panic+0x10>
+  8054ab:	49 bb 8c 2b 00 00 00 	movabs $0x2b8c,%r11
+  8054b2:	00 00 00 
+  8054b5:	4c 01 db             	add    %r11,%rbx
+  8054b8:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8054bf:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8054c5:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8054cc:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8054d3:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8054da:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8054e1:	84 c0                	test   %al,%al
+  8054e3:	74 26                	je     80550b <_panic+0x77>
+  8054e5:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8054ec:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8054f3:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8054f7:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8054fb:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8054ff:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  805503:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  805507:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80550b:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  805512:	00 00 00 
+  805515:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80551c:	00 00 00 
+  80551f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805523:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80552a:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  805531:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  805538:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80553f:	ff ff ff 
+  805542:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805546:	4c 8b 20             	mov    (%rax),%r12
+  805549:	49 89 df             	mov    %rbx,%r15
+  80554c:	48 b8 09 9d ff ff ff 	movabs $0xffffffffffff9d09,%rax
+  805553:	ff ff ff 
+  805556:	48 01 d8             	add    %rbx,%rax
+  805559:	ff d0                	call   *%rax
+  80555b:	89 c6                	mov    %eax,%esi
+  80555d:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  805563:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80556a:	41 89 d0             	mov    %edx,%r8d
+  80556d:	48 89 c1             	mov    %rax,%rcx
+  805570:	4c 89 e2             	mov    %r12,%rdx
+  805573:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  80557a:	ff ff ff 
+  80557d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805581:	48 89 c7             	mov    %rax,%rdi
+  805584:	49 89 df             	mov    %rbx,%r15
+  805587:	b8 00 00 00 00       	mov    $0x0,%eax
+  80558c:	49 b9 34 83 ff ff ff 	movabs $0xffffffffffff8334,%r9
+  805593:	ff ff ff 
+  805596:	49 01 d9             	add    %rbx,%r9
+  805599:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80559c:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8055a3:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8055aa:	48 89 d6             	mov    %rdx,%rsi
+  8055ad:	48 89 c7             	mov    %rax,%rdi
+  8055b0:	49 89 df             	mov    %rbx,%r15
+  8055b3:	48 b8 54 82 ff ff ff 	movabs $0xffffffffffff8254,%rax
+  8055ba:	ff ff ff 
+  8055bd:	48 01 d8             	add    %rbx,%rax
+  8055c0:	ff d0                	call   *%rax
+	cprintf("\n");
+  8055c2:	48 b8 1b e4 ff ff ff 	movabs $0xffffffffffffe41b,%rax
+  8055c9:	ff ff ff 
+  8055cc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055d0:	48 89 c7             	mov    %rax,%rdi
+  8055d3:	49 89 df             	mov    %rbx,%r15
+  8055d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055db:	48 ba 34 83 ff ff ff 	movabs $0xffffffffffff8334,%rdx
+  8055e2:	ff ff ff 
+  8055e5:	48 01 da             	add    %rbx,%rdx
+  8055e8:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8055ea:	cc                   	int3
+  8055eb:	eb fd                	jmp    8055ea <_panic+0x156>
+
+00000000008055ed <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8055ed:	55                   	push   %rbp
+  8055ee:	48 89 e5             	mov    %rsp,%rbp
+  8055f1:	41 57                	push   %r15
+  8055f3:	53                   	push   %rbx
+  8055f4:	48 83 ec 30          	sub    $0x30,%rsp
+  8055f8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055f8 <ipc_recv+0xb>
+  8055ff:	49 bb 38 2a 00 00 00 	movabs $0x2a38,%r11
+  805606:	00 00 00 
+  805609:	4c 01 db             	add    %r11,%rbx
+  80560c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805610:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805614:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  805618:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80561d:	75 0e                	jne    80562d <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  80561f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805626:	00 00 00 
+  805629:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  80562d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805631:	48 89 c7             	mov    %rax,%rdi
+  805634:	49 89 df             	mov    %rbx,%r15
+  805637:	48 b8 db a0 ff ff ff 	movabs $0xffffffffffffa0db,%rax
+  80563e:	ff ff ff 
+  805641:	48 01 d8             	add    %rbx,%rax
+  805644:	ff d0                	call   *%rax
+  805646:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  805649:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80564e:	74 2a                	je     80567a <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805650:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805654:	75 19                	jne    80566f <ipc_recv+0x82>
+  805656:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80565d:	ff ff ff 
+  805660:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805664:	48 8b 00             	mov    (%rax),%rax
+  805667:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80566d:	eb 05                	jmp    805674 <ipc_recv+0x87>
+  80566f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805674:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805678:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80567a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80567f:	74 2a                	je     8056ab <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805681:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805685:	75 19                	jne    8056a0 <ipc_recv+0xb3>
+  805687:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80568e:	ff ff ff 
+  805691:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805695:	48 8b 00             	mov    (%rax),%rax
+  805698:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80569e:	eb 05                	jmp    8056a5 <ipc_recv+0xb8>
+  8056a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056a5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8056a9:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  8056ab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056af:	74 05                	je     8056b6 <ipc_recv+0xc9>
+		return res;
+  8056b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056b4:	eb 17                	jmp    8056cd <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  8056b6:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8056bd:	ff ff ff 
+  8056c0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8056c4:	48 8b 00             	mov    (%rax),%rax
+  8056c7:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8056cd:	48 83 c4 30          	add    $0x30,%rsp
+  8056d1:	5b                   	pop    %rbx
+  8056d2:	41 5f                	pop    %r15
+  8056d4:	5d                   	pop    %rbp
+  8056d5:	c3                   	ret
+
+00000000008056d6 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8056d6:	55                   	push   %rbp
+  8056d7:	48 89 e5             	mov    %rsp,%rbp
+  8056da:	41 57                	push   %r15
+  8056dc:	53                   	push   %rbx
+  8056dd:	48 83 ec 20          	sub    $0x20,%rsp
+  8056e1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056e1 <ipc_send+0xb>
+  8056e8:	49 bb 4f 29 00 00 00 	movabs $0x294f,%r11
+  8056ef:	00 00 00 
+  8056f2:	4c 01 db             	add    %r11,%rbx
+  8056f5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8056f8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8056fb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8056ff:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805702:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805707:	75 0e                	jne    805717 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805709:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805710:	00 00 00 
+  805713:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805717:	90                   	nop
+  805718:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80571b:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80571e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805722:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805725:	89 c7                	mov    %eax,%edi
+  805727:	49 89 df             	mov    %rbx,%r15
+  80572a:	48 b8 71 a0 ff ff ff 	movabs $0xffffffffffffa071,%rax
+  805731:	ff ff ff 
+  805734:	48 01 d8             	add    %rbx,%rax
+  805737:	ff d0                	call   *%rax
+  805739:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  80573c:	74 da                	je     805718 <ipc_send+0x42>
+		;
+}
+  80573e:	90                   	nop
+  80573f:	90                   	nop
+  805740:	48 83 c4 20          	add    $0x20,%rsp
+  805744:	5b                   	pop    %rbx
+  805745:	41 5f                	pop    %r15
+  805747:	5d                   	pop    %rbp
+  805748:	c3                   	ret
+
+0000000000805749 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805749:	55                   	push   %rbp
+  80574a:	48 89 e5             	mov    %rsp,%rbp
+  80574d:	41 57                	push   %r15
+  80574f:	53                   	push   %rbx
+  805750:	48 83 ec 40          	sub    $0x40,%rsp
+  805754:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805754 <ipc_call+0xb>
+  80575b:	49 bb dc 28 00 00 00 	movabs $0x28dc,%r11
+  805762:	00 00 00 
+  805765:	4c 01 db             	add    %r11,%rbx
+  805768:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80576b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80576e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805772:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805775:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805779:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80577d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805782:	75 0e                	jne    805792 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805784:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80578b:	00 00 00 
+  80578e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805792:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805797:	75 0e                	jne    8057a7 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805799:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8057a0:	00 00 00 
+  8057a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8057a7:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8057aa:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8057ae:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8057b1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8057b5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8057b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8057be:	49 89 f8             	mov    %rdi,%r8
+  8057c1:	89 c7                	mov    %eax,%edi
+  8057c3:	49 89 df             	mov    %rbx,%r15
+  8057c6:	48 b8 34 a1 ff ff ff 	movabs $0xffffffffffffa134,%rax
+  8057cd:	ff ff ff 
+  8057d0:	48 01 d8             	add    %rbx,%rax
+  8057d3:	ff d0                	call   *%rax
+  8057d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8057d8:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8057dd:	74 2a                	je     805809 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8057df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057e3:	75 19                	jne    8057fe <ipc_call+0xb5>
+  8057e5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8057ec:	ff ff ff 
+  8057ef:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8057f3:	48 8b 00             	mov    (%rax),%rax
+  8057f6:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8057fc:	eb 05                	jmp    805803 <ipc_call+0xba>
+  8057fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805803:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805807:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805809:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80580d:	74 05                	je     805814 <ipc_call+0xcb>
+		return r;
+  80580f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805812:	eb 17                	jmp    80582b <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805814:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80581b:	ff ff ff 
+  80581e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805822:	48 8b 00             	mov    (%rax),%rax
+  805825:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80582b:	48 83 c4 40          	add    $0x40,%rsp
+  80582f:	5b                   	pop    %rbx
+  805830:	41 5f                	pop    %r15
+  805832:	5d                   	pop    %rbp
+  805833:	c3                   	ret
+
+0000000000805834 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805834:	55                   	push   %rbp
+  805835:	48 89 e5             	mov    %rsp,%rbp
+  805838:	41 57                	push   %r15
+  80583a:	53                   	push   %rbx
+  80583b:	48 83 ec 70          	sub    $0x70,%rsp
+  80583f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80583f <ipc_callw+0xb>
+  805846:	49 bb f1 27 00 00 00 	movabs $0x27f1,%r11
+  80584d:	00 00 00 
+  805850:	4c 01 db             	add    %r11,%rbx
+  805853:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805856:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805859:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  80585d:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805861:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805866:	76 0a                	jbe    805872 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805868:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80586d:	e9 b7 00 00 00       	jmp    805929 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805872:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805876:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80587a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80587e:	48 89 ce             	mov    %rcx,%rsi
+  805881:	48 89 c7             	mov    %rax,%rdi
+  805884:	49 89 df             	mov    %rbx,%r15
+  805887:	48 b8 d6 94 ff ff ff 	movabs $0xffffffffffff94d6,%rax
+  80588e:	ff ff ff 
+  805891:	48 01 d8             	add    %rbx,%rax
+  805894:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805896:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80589d:	00 
+  80589e:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8058a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058a6:	48 01 d0             	add    %rdx,%rax
+  8058a9:	48 83 e8 01          	sub    $0x1,%rax
+  8058ad:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8058b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058ba:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8058be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058c2:	48 29 d0             	sub    %rdx,%rax
+  8058c5:	48 c1 e8 03          	shr    $0x3,%rax
+  8058c9:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  8058cd:	89 c1                	mov    %eax,%ecx
+  8058cf:	8b 75 98             	mov    -0x68(%rbp),%esi
+  8058d2:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  8058d6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8058d9:	49 89 d1             	mov    %rdx,%r9
+  8058dc:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8058e3:	00 00 00 
+  8058e6:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8058ed:	00 00 00 
+  8058f0:	89 c7                	mov    %eax,%edi
+  8058f2:	49 89 df             	mov    %rbx,%r15
+  8058f5:	48 b8 34 a1 ff ff ff 	movabs $0xffffffffffffa134,%rax
+  8058fc:	ff ff ff 
+  8058ff:	48 01 d8             	add    %rbx,%rax
+  805902:	ff d0                	call   *%rax
+  805904:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805907:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80590b:	74 05                	je     805912 <ipc_callw+0xde>
+		return r;
+  80590d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805910:	eb 17                	jmp    805929 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805912:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805919:	ff ff ff 
+  80591c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805920:	48 8b 00             	mov    (%rax),%rax
+  805923:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805929:	48 83 c4 70          	add    $0x70,%rsp
+  80592d:	5b                   	pop    %rbx
+  80592e:	41 5f                	pop    %r15
+  805930:	5d                   	pop    %rbp
+  805931:	c3                   	ret
+
+0000000000805932 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805932:	55                   	push   %rbp
+  805933:	48 89 e5             	mov    %rsp,%rbp
+  805936:	41 57                	push   %r15
+  805938:	53                   	push   %rbx
+  805939:	48 83 ec 40          	sub    $0x40,%rsp
+  80593d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80593d <ipc_callv+0xb>
+  805944:	49 bb f3 26 00 00 00 	movabs $0x26f3,%r11
+  80594b:	00 00 00 
+  80594e:	4c 01 db             	add    %r11,%rbx
+  805951:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805954:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805957:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80595b:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80595e:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805962:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805966:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80596d:	00 00 00 
+  805970:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805974:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805978:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80597c:	74 11                	je     80598f <ipc_callv+0x5d>
+		pg = (void *) segs;
+  80597e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805982:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805986:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805989:	c1 e0 14             	shl    $0x14,%eax
+  80598c:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  80598f:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805993:	74 14                	je     8059a9 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805995:	8b 45 20             	mov    0x20(%rbp),%eax
+  805998:	83 e8 01             	sub    $0x1,%eax
+  80599b:	48 63 d0             	movslq %eax,%rdx
+  80599e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8059a2:	48 09 d0             	or     %rdx,%rax
+  8059a5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  8059a9:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8059ac:	c1 e0 10             	shl    $0x10,%eax
+  8059af:	0b 45 10             	or     0x10(%rbp),%eax
+  8059b2:	89 c1                	mov    %eax,%ecx
+  8059b4:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  8059b7:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8059bb:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8059bf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8059c3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8059c6:	4d 89 c1             	mov    %r8,%r9
+  8059c9:	49 89 f8             	mov    %rdi,%r8
+  8059cc:	89 c7                	mov    %eax,%edi
+  8059ce:	49 89 df             	mov    %rbx,%r15
+  8059d1:	48 b8 34 a1 ff ff ff 	movabs $0xffffffffffffa134,%rax
+  8059d8:	ff ff ff 
+  8059db:	48 01 d8             	add    %rbx,%rax
+  8059de:	ff d0                	call   *%rax
+  8059e0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8059e3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8059e7:	74 05                	je     8059ee <ipc_callv+0xbc>
+		return r;
+  8059e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8059ec:	eb 17                	jmp    805a05 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8059ee:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8059f5:	ff ff ff 
+  8059f8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059fc:	48 8b 00             	mov    (%rax),%rax
+  8059ff:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805a05:	48 83 c4 40          	add    $0x40,%rsp
+  805a09:	5b                   	pop    %rbx
+  805a0a:	41 5f                	pop    %r15
+  805a0c:	5d                   	pop    %rbp
+  805a0d:	c3                   	ret
+
+0000000000805a0e <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805a0e:	55                   	push   %rbp
+  805a0f:	48 89 e5             	mov    %rsp,%rbp
+  805a12:	41 57                	push   %r15
+  805a14:	53                   	push   %rbx
+  805a15:	48 83 ec 40          	sub    $0x40,%rsp
+  805a19:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a19 <ipc_reply_recv+0xb>
+  805a20:	49 bb 17 26 00 00 00 	movabs $0x2617,%r11
+  805a27:	00 00 00 
+  805a2a:	4c 01 db             	add    %r11,%rbx
+  805a2d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805a30:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805a33:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805a37:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805a3a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805a3e:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805a42:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805a47:	75 0e                	jne    805a57 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805a49:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a50:	00 00 00 
+  805a53:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805a57:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805a5c:	75 0e                	jne    805a6c <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805a5e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a65:	00 00 00 
+  805a68:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805a6c:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805a6f:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805a73:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805a77:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805a7a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805a7e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a81:	4d 89 c1             	mov    %r8,%r9
+  805a84:	49 89 f8             	mov    %rdi,%r8
+  805a87:	89 c7                	mov    %eax,%edi
+  805a89:	49 89 df             	mov    %rbx,%r15
+  805a8c:	48 b8 a8 a1 ff ff ff 	movabs $0xffffffffffffa1a8,%rax
+  805a93:	ff ff ff 
+  805a96:	48 01 d8             	add    %rbx,%rax
+  805a99:	ff d0                	call   *%rax
+  805a9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805a9e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805aa3:	74 2a                	je     805acf <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805aa5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805aa9:	75 19                	jne    805ac4 <ipc_reply_recv+0xb6>
+  805aab:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ab2:	ff ff ff 
+  805ab5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ab9:	48 8b 00             	mov    (%rax),%rax
+  805abc:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805ac2:	eb 05                	jmp    805ac9 <ipc_reply_recv+0xbb>
+  805ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ac9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805acd:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805acf:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805ad4:	74 2a                	je     805b00 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805ad6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ada:	75 19                	jne    805af5 <ipc_reply_recv+0xe7>
+  805adc:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ae3:	ff ff ff 
+  805ae6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805aea:	48 8b 00             	mov    (%rax),%rax
+  805aed:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805af3:	eb 05                	jmp    805afa <ipc_reply_recv+0xec>
+  805af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  805afa:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805afe:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805b00:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b04:	74 05                	je     805b0b <ipc_reply_recv+0xfd>
+		return r;
+  805b06:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b09:	eb 17                	jmp    805b22 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805b0b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b12:	ff ff ff 
+  805b15:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b19:	48 8b 00             	mov    (%rax),%rax
+  805b1c:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805b22:	48 83 c4 40          	add    $0x40,%rsp
+  805b26:	5b                   	pop    %rbx
+  805b27:	41 5f                	pop    %r15
+  805b29:	5d                   	pop    %rbp
+  805b2a:	c3                   	ret
+
+0000000000805b2b <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805b2b:	55                   	push   %rbp
+  805b2c:	48 89 e5             	mov    %rsp,%rbp
+  805b2f:	41 57                	push   %r15
+  805b31:	53                   	push   %rbx
+  805b32:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805b39:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b39 <ipc_window_batch+0xe>
+  805b40:	49 bb f7 24 00 00 00 	movabs $0x24f7,%r11
+  805b47:	00 00 00 
+  805b4a:	4c 01 db             	add    %r11,%rbx
+  805b4d:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805b53:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805b5a:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805b60:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805b66:	e9 15 01 00 00       	jmp    805c80 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805b6b:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805b71:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805b74:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805b7b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b7e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b81:	39 c2                	cmp    %eax,%edx
+  805b83:	0f 4e c2             	cmovle %edx,%eax
+  805b86:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805b89:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805b90:	eb 6b                	jmp    805bfd <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805b92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b95:	48 98                	cltq
+  805b97:	48 c1 e0 05          	shl    $0x5,%rax
+  805b9b:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805b9f:	48 01 e8             	add    %rbp,%rax
+  805ba2:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805ba8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805bae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bb1:	c1 e0 0c             	shl    $0xc,%eax
+  805bb4:	48 63 d0             	movslq %eax,%rdx
+  805bb7:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805bbe:	48 01 c2             	add    %rax,%rdx
+  805bc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bc4:	48 98                	cltq
+  805bc6:	48 c1 e0 05          	shl    $0x5,%rax
+  805bca:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805bce:	48 01 e8             	add    %rbp,%rax
+  805bd1:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805bd7:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805bda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bdd:	48 98                	cltq
+  805bdf:	48 c1 e0 05          	shl    $0x5,%rax
+  805be3:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805be7:	48 01 e8             	add    %rbp,%rax
+  805bea:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805bf1:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805bf7:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805bf9:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805bfd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c00:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805c03:	7c 8d                	jl     805b92 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805c05:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805c0c:	74 27                	je     805c35 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805c0e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c11:	48 63 d0             	movslq %eax,%rdx
+  805c14:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805c1b:	48 89 d6             	mov    %rdx,%rsi
+  805c1e:	48 89 c7             	mov    %rax,%rdi
+  805c21:	49 89 df             	mov    %rbx,%r15
+  805c24:	48 b8 4b a4 ff ff ff 	movabs $0xffffffffffffa44b,%rax
+  805c2b:	ff ff ff 
+  805c2e:	48 01 d8             	add    %rbx,%rax
+  805c31:	ff d0                	call   *%rax
+  805c33:	eb 25                	jmp    805c5a <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805c35:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c38:	48 63 d0             	movslq %eax,%rdx
+  805c3b:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805c42:	48 89 d6             	mov    %rdx,%rsi
+  805c45:	48 89 c7             	mov    %rax,%rdi
+  805c48:	49 89 df             	mov    %rbx,%r15
+  805c4b:	48 b8 a9 a4 ff ff ff 	movabs $0xffffffffffffa4a9,%rax
+  805c52:	ff ff ff 
+  805c55:	48 01 d8             	add    %rbx,%rax
+  805c58:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805c5a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805c5d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805c61:	79 05                	jns    805c68 <ipc_window_batch+0x13d>
+			return r;
+  805c63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c66:	eb 2a                	jmp    805c92 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805c68:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c6b:	c1 e0 0c             	shl    $0xc,%eax
+  805c6e:	48 98                	cltq
+  805c70:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805c77:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c7a:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805c80:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805c87:	0f 8f de fe ff ff    	jg     805b6b <ipc_window_batch+0x40>
+	}
+	return 0;
+  805c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c92:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805c99:	5b                   	pop    %rbx
+  805c9a:	41 5f                	pop    %r15
+  805c9c:	5d                   	pop    %rbp
+  805c9d:	c3                   	ret
+
+0000000000805c9e <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805c9e:	55                   	push   %rbp
+  805c9f:	48 89 e5             	mov    %rsp,%rbp
+  805ca2:	48 83 ec 10          	sub    $0x10,%rsp
+  805ca6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ca6 <ipc_map_window+0x8>
+  805cad:	49 bb 8a 23 00 00 00 	movabs $0x238a,%r11
+  805cb4:	00 00 00 
+  805cb7:	4c 01 d8             	add    %r11,%rax
+  805cba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805cbe:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805cc1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805cc4:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805cc8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805ccd:	bf 01 00 00 00       	mov    $0x1,%edi
+  805cd2:	49 b8 fb da ff ff ff 	movabs $0xffffffffffffdafb,%r8
+  805cd9:	ff ff ff 
+  805cdc:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805ce0:	ff d0                	call   *%rax
+}
+  805ce2:	c9                   	leave
+  805ce3:	c3                   	ret
+
+0000000000805ce4 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805ce4:	55                   	push   %rbp
+  805ce5:	48 89 e5             	mov    %rsp,%rbp
+  805ce8:	48 83 ec 10          	sub    $0x10,%rsp
+  805cec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805cec <ipc_unmap_window+0x8>
+  805cf3:	49 bb 44 23 00 00 00 	movabs $0x2344,%r11
+  805cfa:	00 00 00 
+  805cfd:	4c 01 d8             	add    %r11,%rax
+  805d00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805d04:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805d07:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805d0a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805d0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805d13:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d18:	49 b8 fb da ff ff ff 	movabs $0xffffffffffffdafb,%r8
+  805d1f:	ff ff ff 
+  805d22:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805d26:	ff d0                	call   *%rax
+}
+  805d28:	c9                   	leave
+  805d29:	c3                   	ret
+
+0000000000805d2a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805d2a:	55                   	push   %rbp
+  805d2b:	48 89 e5             	mov    %rsp,%rbp
+  805d2e:	48 83 ec 18          	sub    $0x18,%rsp
+  805d32:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d32 <ipc_find_env+0x8>
+  805d39:	49 bb fe 22 00 00 00 	movabs $0x22fe,%r11
+  805d40:	00 00 00 
+  805d43:	4c 01 d8             	add    %r11,%rax
+  805d46:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805d49:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805d50:	eb 57                	jmp    805da9 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805d52:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805d59:	ff ff ff 
+  805d5c:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805d60:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805d63:	48 63 d2             	movslq %edx,%rdx
+  805d66:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805d6d:	48 01 ca             	add    %rcx,%rdx
+  805d70:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805d77:	8b 12                	mov    (%rdx),%edx
+  805d79:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805d7c:	75 27                	jne    805da5 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805d7e:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805d85:	ff ff ff 
+  805d88:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805d8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d8f:	48 98                	cltq
+  805d91:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  805d98:	48 01 d0             	add    %rdx,%rax
+  805d9b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805da1:	8b 00                	mov    (%rax),%eax
+  805da3:	eb 12                	jmp    805db7 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  805da5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805da9:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805db0:	7e a0                	jle    805d52 <ipc_find_env+0x28>
+	}
+	return 0;
+  805db2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805db7:	c9                   	leave
+  805db8:	c3                   	ret
+
+0000000000805db9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805db9:	55                   	push   %rbp
+  805dba:	48 89 e5             	mov    %rsp,%rbp
+  805dbd:	48 83 ec 18          	sub    $0x18,%rsp
+  805dc1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805dc1 <pageref+0x8>
+  805dc8:	49 bb 6f 22 00 00 00 	movabs $0x226f,%r11
+  805dcf:	00 00 00 
+  805dd2:	4c 01 d8             	add    %r11,%rax
+  805dd5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  805dd9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805ddd:	48 89 d1             	mov    %rdx,%rcx
+  805de0:	48 c1 e9 15          	shr    $0x15,%rcx
+  805de4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  805deb:	ff ff ff 
+  805dee:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805df2:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805df6:	83 e2 01             	and    $0x1,%edx
+  805df9:	48 85 d2             	test   %rdx,%rdx
+  805dfc:	75 07                	jne    805e05 <pageref+0x4c>
+		return 0;
+  805dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e03:	eb 64                	jmp    805e69 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  805e05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805e09:	48 89 d1             	mov    %rdx,%rcx
+  805e0c:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805e10:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  805e17:	ff ff ff 
+  805e1a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805e1e:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805e22:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  805e26:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805e2a:	83 e2 01             	and    $0x1,%edx
+  805e2d:	48 85 d2             	test   %rdx,%rdx
+  805e30:	75 07                	jne    805e39 <pageref+0x80>
+		return 0;
+  805e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e37:	eb 30                	jmp    805e69 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  805e39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805e3d:	48 c1 ea 0c          	shr    $0xc,%rdx
+  805e41:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  805e48:	ff ff ff 
+  805e4b:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  805e4f:	48 89 d0             	mov    %rdx,%rax
+  805e52:	48 01 c0             	add    %rax,%rax
+  805e55:	48 01 d0             	add    %rdx,%rax
+  805e58:	48 c1 e0 03          	shl    $0x3,%rax
+  805e5c:	48 01 c8             	add    %rcx,%rax
+  805e5f:	48 83 c0 08          	add    $0x8,%rax
+  805e63:	0f b7 00             	movzwl (%rax),%eax
+  805e66:	0f b7 c0             	movzwl %ax,%eax
+}
+  805e69:	c9                   	leave
+  805e6a:	c3                   	ret
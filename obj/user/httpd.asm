@@ -0,0 +1,11771 @@
+
+obj/user/httpd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 0e 0c 00 00       	call   800c4f <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <die>:
+	{404, "Not Found"},
+};
+
+static void
+die(char *m)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 10          	sub    $0x10,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <die+0xb>
+  800055:	49 bb f2 9f 00 00 00 	movabs $0x9ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	cprintf("%s\n", m);
+  800066:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80006a:	48 89 c6             	mov    %rax,%rsi
+  80006d:	48 b8 84 d8 ff ff ff 	movabs $0xffffffffffffd884,%rax
+  800074:	ff ff ff 
+  800077:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80007b:	48 89 c7             	mov    %rax,%rdi
+  80007e:	49 89 df             	mov    %rbx,%r15
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	48 ba f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rdx
+  80008d:	ff ff ff 
+  800090:	48 01 da             	add    %rbx,%rdx
+  800093:	ff d2                	call   *%rdx
+	exit();
+  800095:	49 89 df             	mov    %rbx,%r15
+  800098:	48 b8 cf 6c ff ff ff 	movabs $0xffffffffffff6ccf,%rax
+  80009f:	ff ff ff 
+  8000a2:	48 01 d8             	add    %rbx,%rax
+  8000a5:	ff d0                	call   *%rax
+}
+  8000a7:	90                   	nop
+  8000a8:	48 83 c4 10          	add    $0x10,%rsp
+  8000ac:	5b                   	pop    %rbx
+  8000ad:	41 5f                	pop    %r15
+  8000af:	5d                   	pop    %rbp
+  8000b0:	c3                   	ret
+
+00000000008000b1 <req_free>:
+
+static void
+req_free(struct http_request *req)
+{
+  8000b1:	55                   	push   %rbp
+  8000b2:	48 89 e5             	mov    %rsp,%rbp
+  8000b5:	41 57                	push   %r15
+  8000b7:	53                   	push   %rbx
+  8000b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8000bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000bc <req_free+0xb>
+  8000c3:	49 bb 84 9f 00 00 00 	movabs $0x9f84,%r11
+  8000ca:	00 00 00 
+  8000cd:	4c 01 db             	add    %r11,%rbx
+  8000d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	free(req->url);
+  8000d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000d8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8000dc:	48 89 c7             	mov    %rax,%rdi
+  8000df:	49 89 df             	mov    %rbx,%r15
+  8000e2:	48 b8 49 bd ff ff ff 	movabs $0xffffffffffffbd49,%rax
+  8000e9:	ff ff ff 
+  8000ec:	48 01 d8             	add    %rbx,%rax
+  8000ef:	ff d0                	call   *%rax
+	free(req->version);
+  8000f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000f5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8000f9:	48 89 c7             	mov    %rax,%rdi
+  8000fc:	49 89 df             	mov    %rbx,%r15
+  8000ff:	48 b8 49 bd ff ff ff 	movabs $0xffffffffffffbd49,%rax
+  800106:	ff ff ff 
+  800109:	48 01 d8             	add    %rbx,%rax
+  80010c:	ff d0                	call   *%rax
+}
+  80010e:	90                   	nop
+  80010f:	48 83 c4 10          	add    $0x10,%rsp
+  800113:	5b                   	pop    %rbx
+  800114:	41 5f                	pop    %r15
+  800116:	5d                   	pop    %rbp
+  800117:	c3                   	ret
+
+0000000000800118 <send_header>:
+
+static int
+send_header(struct http_request *req, int code)
+{
+  800118:	55                   	push   %rbp
+  800119:	48 89 e5             	mov    %rsp,%rbp
+  80011c:	41 57                	push   %r15
+  80011e:	53                   	push   %rbx
+  80011f:	48 83 ec 20          	sub    $0x20,%rsp
+  800123:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800123 <send_header+0xb>
+  80012a:	49 bb 1d 9f 00 00 00 	movabs $0x9f1d,%r11
+  800131:	00 00 00 
+  800134:	4c 01 db             	add    %r11,%rbx
+  800137:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80013b:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	struct responce_header *h = headers;
+  80013e:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  800145:	00 00 00 
+  800148:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80014c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (h->code != 0 && h->header!= 0) {
+  800150:	eb 10                	jmp    800162 <send_header+0x4a>
+		if (h->code == code)
+  800152:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800156:	8b 00                	mov    (%rax),%eax
+  800158:	39 45 d4             	cmp    %eax,-0x2c(%rbp)
+  80015b:	74 1e                	je     80017b <send_header+0x63>
+			break;
+		h++;
+  80015d:	48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+	while (h->code != 0 && h->header!= 0) {
+  800162:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800166:	8b 00                	mov    (%rax),%eax
+  800168:	85 c0                	test   %eax,%eax
+  80016a:	74 10                	je     80017c <send_header+0x64>
+  80016c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800170:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800174:	48 85 c0             	test   %rax,%rax
+  800177:	75 d9                	jne    800152 <send_header+0x3a>
+  800179:	eb 01                	jmp    80017c <send_header+0x64>
+			break;
+  80017b:	90                   	nop
+	}
+
+	if (h->code == 0)
+  80017c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800180:	8b 00                	mov    (%rax),%eax
+  800182:	85 c0                	test   %eax,%eax
+  800184:	75 07                	jne    80018d <send_header+0x75>
+		return -1;
+  800186:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80018b:	eb 76                	jmp    800203 <send_header+0xeb>
+
+	int len = strlen(h->header);
+  80018d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800191:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800195:	48 89 c7             	mov    %rax,%rdi
+  800198:	49 89 df             	mov    %rbx,%r15
+  80019b:	48 b8 1e 7d ff ff ff 	movabs $0xffffffffffff7d1e,%rax
+  8001a2:	ff ff ff 
+  8001a5:	48 01 d8             	add    %rbx,%rax
+  8001a8:	ff d0                	call   *%rax
+  8001aa:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (write(req->sock, h->header, len) != len) {
+  8001ad:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8001b0:	48 63 d0             	movslq %eax,%rdx
+  8001b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8001b7:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  8001bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001bf:	8b 00                	mov    (%rax),%eax
+  8001c1:	48 89 ce             	mov    %rcx,%rsi
+  8001c4:	89 c7                	mov    %eax,%edi
+  8001c6:	49 89 df             	mov    %rbx,%r15
+  8001c9:	48 b8 34 9a ff ff ff 	movabs $0xffffffffffff9a34,%rax
+  8001d0:	ff ff ff 
+  8001d3:	48 01 d8             	add    %rbx,%rax
+  8001d6:	ff d0                	call   *%rax
+  8001d8:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+  8001db:	74 21                	je     8001fe <send_header+0xe6>
+		die("Failed to send bytes to client");
+  8001dd:	48 b8 88 d8 ff ff ff 	movabs $0xffffffffffffd888,%rax
+  8001e4:	ff ff ff 
+  8001e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001eb:	48 89 c7             	mov    %rax,%rdi
+  8001ee:	48 b8 03 60 ff ff ff 	movabs $0xffffffffffff6003,%rax
+  8001f5:	ff ff ff 
+  8001f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001fc:	ff d0                	call   *%rax
+	}
+
+	return 0;
+  8001fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800203:	48 83 c4 20          	add    $0x20,%rsp
+  800207:	5b                   	pop    %rbx
+  800208:	41 5f                	pop    %r15
+  80020a:	5d                   	pop    %rbp
+  80020b:	c3                   	ret
+
+000000000080020c <send_data>:
+
+static int
+send_data(struct http_request *req, int fd)
+{
+  80020c:	55                   	push   %rbp
+  80020d:	48 89 e5             	mov    %rsp,%rbp
+  800210:	41 57                	push   %r15
+  800212:	48 83 ec 18          	sub    $0x18,%rsp
+  800216:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 800216 <send_data+0xa>
+  80021d:	49 bb 2a 9e 00 00 00 	movabs $0x9e2a,%r11
+  800224:	00 00 00 
+  800227:	4c 01 d9             	add    %r11,%rcx
+  80022a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80022e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	// LAB 6: Your code here.
+	panic("send_data not implemented");
+  800231:	48 b8 a7 d8 ff ff ff 	movabs $0xffffffffffffd8a7,%rax
+  800238:	ff ff ff 
+  80023b:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80023f:	48 89 c2             	mov    %rax,%rdx
+  800242:	be 50 00 00 00       	mov    $0x50,%esi
+  800247:	48 b8 c1 d8 ff ff ff 	movabs $0xffffffffffffd8c1,%rax
+  80024e:	ff ff ff 
+  800251:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  800255:	48 89 c7             	mov    %rax,%rdi
+  800258:	49 89 cf             	mov    %rcx,%r15
+  80025b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800260:	49 b8 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%r8
+  800267:	ff ff ff 
+  80026a:	49 01 c8             	add    %rcx,%r8
+  80026d:	41 ff d0             	call   *%r8
+
+0000000000800270 <send_size>:
+}
+
+static int
+send_size(struct http_request *req, off_t size)
+{
+  800270:	55                   	push   %rbp
+  800271:	48 89 e5             	mov    %rsp,%rbp
+  800274:	41 57                	push   %r15
+  800276:	53                   	push   %rbx
+  800277:	48 83 ec 60          	sub    $0x60,%rsp
+  80027b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80027b <send_size+0xb>
+  800282:	49 bb c5 9d 00 00 00 	movabs $0x9dc5,%r11
+  800289:	00 00 00 
+  80028c:	4c 01 db             	add    %r11,%rbx
+  80028f:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800293:	89 75 94             	mov    %esi,-0x6c(%rbp)
+	char buf[64];
+	int r;
+
+	r = snprintf(buf, 64, "Content-Length: %ld\r\n", (long)size);
+  800296:	8b 45 94             	mov    -0x6c(%rbp),%eax
+  800299:	48 63 d0             	movslq %eax,%rdx
+  80029c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8002a0:	48 89 d1             	mov    %rdx,%rcx
+  8002a3:	48 ba ce d8 ff ff ff 	movabs $0xffffffffffffd8ce,%rdx
+  8002aa:	ff ff ff 
+  8002ad:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8002b1:	be 40 00 00 00       	mov    $0x40,%esi
+  8002b6:	48 89 c7             	mov    %rax,%rdi
+  8002b9:	49 89 df             	mov    %rbx,%r15
+  8002bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c1:	49 b8 25 7c ff ff ff 	movabs $0xffffffffffff7c25,%r8
+  8002c8:	ff ff ff 
+  8002cb:	49 01 d8             	add    %rbx,%r8
+  8002ce:	41 ff d0             	call   *%r8
+  8002d1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r > 63)
+  8002d4:	83 7d ec 3f          	cmpl   $0x3f,-0x14(%rbp)
+  8002d8:	7e 3e                	jle    800318 <send_size+0xa8>
+		panic("buffer too small!");
+  8002da:	48 b8 e4 d8 ff ff ff 	movabs $0xffffffffffffd8e4,%rax
+  8002e1:	ff ff ff 
+  8002e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002e8:	48 89 c2             	mov    %rax,%rdx
+  8002eb:	be 5b 00 00 00       	mov    $0x5b,%esi
+  8002f0:	48 b8 c1 d8 ff ff ff 	movabs $0xffffffffffffd8c1,%rax
+  8002f7:	ff ff ff 
+  8002fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002fe:	48 89 c7             	mov    %rax,%rdi
+  800301:	49 89 df             	mov    %rbx,%r15
+  800304:	b8 00 00 00 00       	mov    $0x0,%eax
+  800309:	48 b9 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%rcx
+  800310:	ff ff ff 
+  800313:	48 01 d9             	add    %rbx,%rcx
+  800316:	ff d1                	call   *%rcx
+
+	if (write(req->sock, buf, r) != r)
+  800318:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80031b:	48 63 d0             	movslq %eax,%rdx
+  80031e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800322:	8b 00                	mov    (%rax),%eax
+  800324:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800328:	48 89 ce             	mov    %rcx,%rsi
+  80032b:	89 c7                	mov    %eax,%edi
+  80032d:	49 89 df             	mov    %rbx,%r15
+  800330:	48 b8 34 9a ff ff ff 	movabs $0xffffffffffff9a34,%rax
+  800337:	ff ff ff 
+  80033a:	48 01 d8             	add    %rbx,%rax
+  80033d:	ff d0                	call   *%rax
+  80033f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800342:	74 07                	je     80034b <send_size+0xdb>
+		return -1;
+  800344:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800349:	eb 05                	jmp    800350 <send_size+0xe0>
+
+	return 0;
+  80034b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800350:	48 83 c4 60          	add    $0x60,%rsp
+  800354:	5b                   	pop    %rbx
+  800355:	41 5f                	pop    %r15
+  800357:	5d                   	pop    %rbp
+  800358:	c3                   	ret
+
+0000000000800359 <mime_type>:
+
+static const char*
+mime_type(const char *file)
+{
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	48 83 ec 08          	sub    $0x8,%rsp
+  800361:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800361 <mime_type+0x8>
+  800368:	49 bb df 9c 00 00 00 	movabs $0x9cdf,%r11
+  80036f:	00 00 00 
+  800372:	4c 01 d8             	add    %r11,%rax
+  800375:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	//TODO: for now only a single mime type
+	return "text/html";
+  800379:	48 ba f6 d8 ff ff ff 	movabs $0xffffffffffffd8f6,%rdx
+  800380:	ff ff ff 
+  800383:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+}
+  800387:	c9                   	leave
+  800388:	c3                   	ret
+
+0000000000800389 <send_content_type>:
+
+static int
+send_content_type(struct http_request *req)
+{
+  800389:	55                   	push   %rbp
+  80038a:	48 89 e5             	mov    %rsp,%rbp
+  80038d:	41 57                	push   %r15
+  80038f:	53                   	push   %rbx
+  800390:	48 81 ec a0 00 00 00 	sub    $0xa0,%rsp
+  800397:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800397 <send_content_type+0xe>
+  80039e:	49 bb a9 9c 00 00 00 	movabs $0x9ca9,%r11
+  8003a5:	00 00 00 
+  8003a8:	4c 01 db             	add    %r11,%rbx
+  8003ab:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+	char buf[128];
+	int r;
+	const char *type;
+
+	type = mime_type(req->url);
+  8003b2:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8003b9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8003bd:	48 89 c7             	mov    %rax,%rdi
+  8003c0:	48 b8 19 63 ff ff ff 	movabs $0xffffffffffff6319,%rax
+  8003c7:	ff ff ff 
+  8003ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003ce:	ff d0                	call   *%rax
+  8003d0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	if (!type)
+  8003d4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8003d9:	75 0a                	jne    8003e5 <send_content_type+0x5c>
+		return -1;
+  8003db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8003e0:	e9 c1 00 00 00       	jmp    8004a6 <send_content_type+0x11d>
+
+	r = snprintf(buf, 128, "Content-Type: %s\r\n", type);
+  8003e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8003e9:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8003f0:	48 89 d1             	mov    %rdx,%rcx
+  8003f3:	48 ba 00 d9 ff ff ff 	movabs $0xffffffffffffd900,%rdx
+  8003fa:	ff ff ff 
+  8003fd:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800401:	be 80 00 00 00       	mov    $0x80,%esi
+  800406:	48 89 c7             	mov    %rax,%rdi
+  800409:	49 89 df             	mov    %rbx,%r15
+  80040c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800411:	49 b8 25 7c ff ff ff 	movabs $0xffffffffffff7c25,%r8
+  800418:	ff ff ff 
+  80041b:	49 01 d8             	add    %rbx,%r8
+  80041e:	41 ff d0             	call   *%r8
+  800421:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (r > 127)
+  800424:	83 7d e4 7f          	cmpl   $0x7f,-0x1c(%rbp)
+  800428:	7e 3e                	jle    800468 <send_content_type+0xdf>
+		panic("buffer too small!");
+  80042a:	48 b8 e4 d8 ff ff ff 	movabs $0xffffffffffffd8e4,%rax
+  800431:	ff ff ff 
+  800434:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800438:	48 89 c2             	mov    %rax,%rdx
+  80043b:	be 77 00 00 00       	mov    $0x77,%esi
+  800440:	48 b8 c1 d8 ff ff ff 	movabs $0xffffffffffffd8c1,%rax
+  800447:	ff ff ff 
+  80044a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80044e:	48 89 c7             	mov    %rax,%rdi
+  800451:	49 89 df             	mov    %rbx,%r15
+  800454:	b8 00 00 00 00       	mov    $0x0,%eax
+  800459:	48 b9 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%rcx
+  800460:	ff ff ff 
+  800463:	48 01 d9             	add    %rbx,%rcx
+  800466:	ff d1                	call   *%rcx
+
+	if (write(req->sock, buf, r) != r)
+  800468:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80046b:	48 63 d0             	movslq %eax,%rdx
+  80046e:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  800475:	8b 00                	mov    (%rax),%eax
+  800477:	48 8d 8d 60 ff ff ff 	lea    -0xa0(%rbp),%rcx
+  80047e:	48 89 ce             	mov    %rcx,%rsi
+  800481:	89 c7                	mov    %eax,%edi
+  800483:	49 89 df             	mov    %rbx,%r15
+  800486:	48 b8 34 9a ff ff ff 	movabs $0xffffffffffff9a34,%rax
+  80048d:	ff ff ff 
+  800490:	48 01 d8             	add    %rbx,%rax
+  800493:	ff d0                	call   *%rax
+  800495:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+  800498:	74 07                	je     8004a1 <send_content_type+0x118>
+		return -1;
+  80049a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049f:	eb 05                	jmp    8004a6 <send_content_type+0x11d>
+
+	return 0;
+  8004a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004a6:	48 81 c4 a0 00 00 00 	add    $0xa0,%rsp
+  8004ad:	5b                   	pop    %rbx
+  8004ae:	41 5f                	pop    %r15
+  8004b0:	5d                   	pop    %rbp
+  8004b1:	c3                   	ret
+
+00000000008004b2 <send_header_fin>:
+
+static int
+send_header_fin(struct http_request *req)
+{
+  8004b2:	55                   	push   %rbp
+  8004b3:	48 89 e5             	mov    %rsp,%rbp
+  8004b6:	41 57                	push   %r15
+  8004b8:	53                   	push   %rbx
+  8004b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8004bd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004bd <send_header_fin+0xb>
+  8004c4:	49 bb 83 9b 00 00 00 	movabs $0x9b83,%r11
+  8004cb:	00 00 00 
+  8004ce:	4c 01 db             	add    %r11,%rbx
+  8004d1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	const char *fin = "\r\n";
+  8004d5:	48 b8 13 d9 ff ff ff 	movabs $0xffffffffffffd913,%rax
+  8004dc:	ff ff ff 
+  8004df:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004e3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int fin_len = strlen(fin);
+  8004e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004eb:	48 89 c7             	mov    %rax,%rdi
+  8004ee:	49 89 df             	mov    %rbx,%r15
+  8004f1:	48 b8 1e 7d ff ff ff 	movabs $0xffffffffffff7d1e,%rax
+  8004f8:	ff ff ff 
+  8004fb:	48 01 d8             	add    %rbx,%rax
+  8004fe:	ff d0                	call   *%rax
+  800500:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+
+	if (write(req->sock, fin, fin_len) != fin_len)
+  800503:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800506:	48 63 d0             	movslq %eax,%rdx
+  800509:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80050d:	8b 00                	mov    (%rax),%eax
+  80050f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800513:	48 89 ce             	mov    %rcx,%rsi
+  800516:	89 c7                	mov    %eax,%edi
+  800518:	49 89 df             	mov    %rbx,%r15
+  80051b:	48 b8 34 9a ff ff ff 	movabs $0xffffffffffff9a34,%rax
+  800522:	ff ff ff 
+  800525:	48 01 d8             	add    %rbx,%rax
+  800528:	ff d0                	call   *%rax
+  80052a:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+  80052d:	74 07                	je     800536 <send_header_fin+0x84>
+		return -1;
+  80052f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800534:	eb 05                	jmp    80053b <send_header_fin+0x89>
+
+	return 0;
+  800536:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80053b:	48 83 c4 20          	add    $0x20,%rsp
+  80053f:	5b                   	pop    %rbx
+  800540:	41 5f                	pop    %r15
+  800542:	5d                   	pop    %rbp
+  800543:	c3                   	ret
+
+0000000000800544 <http_request_parse>:
+
+// given a request, this function creates a struct http_request
+static int
+http_request_parse(struct http_request *req, char *request)
+{
+  800544:	55                   	push   %rbp
+  800545:	48 89 e5             	mov    %rsp,%rbp
+  800548:	41 57                	push   %r15
+  80054a:	53                   	push   %rbx
+  80054b:	48 83 ec 30          	sub    $0x30,%rsp
+  80054f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80054f <http_request_parse+0xb>
+  800556:	49 bb f1 9a 00 00 00 	movabs $0x9af1,%r11
+  80055d:	00 00 00 
+  800560:	4c 01 db             	add    %r11,%rbx
+  800563:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800567:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	const char *url;
+	const char *version;
+	int url_len, version_len;
+
+	if (!req)
+  80056b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800570:	75 0a                	jne    80057c <http_request_parse+0x38>
+		return -1;
+  800572:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800577:	e9 70 01 00 00       	jmp    8006ec <http_request_parse+0x1a8>
+
+	if (strncmp(request, "GET ", 4) != 0)
+  80057c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800580:	ba 04 00 00 00       	mov    $0x4,%edx
+  800585:	48 b9 16 d9 ff ff ff 	movabs $0xffffffffffffd916,%rcx
+  80058c:	ff ff ff 
+  80058f:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  800593:	48 89 ce             	mov    %rcx,%rsi
+  800596:	48 89 c7             	mov    %rax,%rdi
+  800599:	49 89 df             	mov    %rbx,%r15
+  80059c:	48 b8 d2 7f ff ff ff 	movabs $0xffffffffffff7fd2,%rax
+  8005a3:	ff ff ff 
+  8005a6:	48 01 d8             	add    %rbx,%rax
+  8005a9:	ff d0                	call   *%rax
+  8005ab:	85 c0                	test   %eax,%eax
+  8005ad:	74 0a                	je     8005b9 <http_request_parse+0x75>
+		return -E_BAD_REQ;
+  8005af:	b8 18 fc ff ff       	mov    $0xfffffc18,%eax
+  8005b4:	e9 33 01 00 00       	jmp    8006ec <http_request_parse+0x1a8>
+
+	// skip GET
+	request += 4;
+  8005b9:	48 83 45 c0 04       	addq   $0x4,-0x40(%rbp)
+
+	// get the url
+	url = request;
+  8005be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8005c2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (*request && *request != ' ')
+  8005c6:	eb 05                	jmp    8005cd <http_request_parse+0x89>
+		request++;
+  8005c8:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+	while (*request && *request != ' ')
+  8005cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8005d1:	0f b6 00             	movzbl (%rax),%eax
+  8005d4:	84 c0                	test   %al,%al
+  8005d6:	74 0b                	je     8005e3 <http_request_parse+0x9f>
+  8005d8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8005dc:	0f b6 00             	movzbl (%rax),%eax
+  8005df:	3c 20                	cmp    $0x20,%al
+  8005e1:	75 e5                	jne    8005c8 <http_request_parse+0x84>
+	url_len = request - url;
+  8005e3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8005e7:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+  8005eb:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+
+	req->url = malloc(url_len + 1);
+  8005ee:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8005f1:	83 c0 01             	add    $0x1,%eax
+  8005f4:	48 98                	cltq
+  8005f6:	48 89 c7             	mov    %rax,%rdi
+  8005f9:	49 89 df             	mov    %rbx,%r15
+  8005fc:	48 b8 6d b9 ff ff ff 	movabs $0xffffffffffffb96d,%rax
+  800603:	ff ff ff 
+  800606:	48 01 d8             	add    %rbx,%rax
+  800609:	ff d0                	call   *%rax
+  80060b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80060f:	48 89 42 08          	mov    %rax,0x8(%rdx)
+	memmove(req->url, url, url_len);
+  800613:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800616:	48 63 d0             	movslq %eax,%rdx
+  800619:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80061d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800621:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800625:	48 89 ce             	mov    %rcx,%rsi
+  800628:	48 89 c7             	mov    %rax,%rdi
+  80062b:	49 89 df             	mov    %rbx,%r15
+  80062e:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  800635:	ff ff ff 
+  800638:	48 01 d8             	add    %rbx,%rax
+  80063b:	ff d0                	call   *%rax
+	req->url[url_len] = '\0';
+  80063d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800641:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  800645:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800648:	48 98                	cltq
+  80064a:	48 01 d0             	add    %rdx,%rax
+  80064d:	c6 00 00             	movb   $0x0,(%rax)
+
+	// skip space
+	request++;
+  800650:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+
+	version = request;
+  800655:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800659:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	while (*request && *request != '\n')
+  80065d:	eb 05                	jmp    800664 <http_request_parse+0x120>
+		request++;
+  80065f:	48 83 45 c0 01       	addq   $0x1,-0x40(%rbp)
+	while (*request && *request != '\n')
+  800664:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800668:	0f b6 00             	movzbl (%rax),%eax
+  80066b:	84 c0                	test   %al,%al
+  80066d:	74 0b                	je     80067a <http_request_parse+0x136>
+  80066f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800673:	0f b6 00             	movzbl (%rax),%eax
+  800676:	3c 0a                	cmp    $0xa,%al
+  800678:	75 e5                	jne    80065f <http_request_parse+0x11b>
+	version_len = request - version;
+  80067a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80067e:	48 2b 45 d8          	sub    -0x28(%rbp),%rax
+  800682:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+	req->version = malloc(version_len + 1);
+  800685:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800688:	83 c0 01             	add    $0x1,%eax
+  80068b:	48 98                	cltq
+  80068d:	48 89 c7             	mov    %rax,%rdi
+  800690:	49 89 df             	mov    %rbx,%r15
+  800693:	48 b8 6d b9 ff ff ff 	movabs $0xffffffffffffb96d,%rax
+  80069a:	ff ff ff 
+  80069d:	48 01 d8             	add    %rbx,%rax
+  8006a0:	ff d0                	call   *%rax
+  8006a2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8006a6:	48 89 42 10          	mov    %rax,0x10(%rdx)
+	memmove(req->version, version, version_len);
+  8006aa:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8006ad:	48 63 d0             	movslq %eax,%rdx
+  8006b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006b4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8006b8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8006bc:	48 89 ce             	mov    %rcx,%rsi
+  8006bf:	48 89 c7             	mov    %rax,%rdi
+  8006c2:	49 89 df             	mov    %rbx,%r15
+  8006c5:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  8006cc:	ff ff ff 
+  8006cf:	48 01 d8             	add    %rbx,%rax
+  8006d2:	ff d0                	call   *%rax
+	req->version[version_len] = '\0';
+  8006d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006d8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006dc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8006df:	48 98                	cltq
+  8006e1:	48 01 d0             	add    %rdx,%rax
+  8006e4:	c6 00 00             	movb   $0x0,(%rax)
+
+	// no entity parsing
+
+	return 0;
+  8006e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006ec:	48 83 c4 30          	add    $0x30,%rsp
+  8006f0:	5b                   	pop    %rbx
+  8006f1:	41 5f                	pop    %r15
+  8006f3:	5d                   	pop    %rbp
+  8006f4:	c3                   	ret
+
+00000000008006f5 <send_error>:
+
+static int
+send_error(struct http_request *req, int code)
+{
+  8006f5:	55                   	push   %rbp
+  8006f6:	48 89 e5             	mov    %rsp,%rbp
+  8006f9:	41 57                	push   %r15
+  8006fb:	53                   	push   %rbx
+  8006fc:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  800703:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800703 <send_error+0xe>
+  80070a:	49 bb 3d 99 00 00 00 	movabs $0x993d,%r11
+  800711:	00 00 00 
+  800714:	4c 01 db             	add    %r11,%rbx
+  800717:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  80071e:	89 b5 d4 fd ff ff    	mov    %esi,-0x22c(%rbp)
+	char buf[512];
+	int r;
+
+	struct error_messages *e = errors;
+  800724:	48 b8 40 00 00 00 00 	movabs $0x40,%rax
+  80072b:	00 00 00 
+  80072e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800732:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->code != 0 && e->msg != 0) {
+  800736:	eb 13                	jmp    80074b <send_error+0x56>
+		if (e->code == code)
+  800738:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80073c:	8b 00                	mov    (%rax),%eax
+  80073e:	39 85 d4 fd ff ff    	cmp    %eax,-0x22c(%rbp)
+  800744:	74 1e                	je     800764 <send_error+0x6f>
+			break;
+		e++;
+  800746:	48 83 45 e8 10       	addq   $0x10,-0x18(%rbp)
+	while (e->code != 0 && e->msg != 0) {
+  80074b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80074f:	8b 00                	mov    (%rax),%eax
+  800751:	85 c0                	test   %eax,%eax
+  800753:	74 10                	je     800765 <send_error+0x70>
+  800755:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800759:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80075d:	48 85 c0             	test   %rax,%rax
+  800760:	75 d6                	jne    800738 <send_error+0x43>
+  800762:	eb 01                	jmp    800765 <send_error+0x70>
+			break;
+  800764:	90                   	nop
+	}
+
+	if (e->code == 0)
+  800765:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800769:	8b 00                	mov    (%rax),%eax
+  80076b:	85 c0                	test   %eax,%eax
+  80076d:	75 0a                	jne    800779 <send_error+0x84>
+		return -1;
+  80076f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800774:	e9 a3 00 00 00       	jmp    80081c <send_error+0x127>
+
+	r = snprintf(buf, 512, "HTTP/" HTTP_VERSION" %d %s\r\n"
+  800779:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80077d:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  800781:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800785:	8b 38                	mov    (%rax),%edi
+  800787:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80078b:	48 8b 70 08          	mov    0x8(%rax),%rsi
+  80078f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800793:	8b 10                	mov    (%rax),%edx
+  800795:	48 8d 85 e0 fd ff ff 	lea    -0x220(%rbp),%rax
+  80079c:	48 83 ec 08          	sub    $0x8,%rsp
+  8007a0:	51                   	push   %rcx
+  8007a1:	41 89 f9             	mov    %edi,%r9d
+  8007a4:	49 89 f0             	mov    %rsi,%r8
+  8007a7:	89 d1                	mov    %edx,%ecx
+  8007a9:	48 ba 20 d9 ff ff ff 	movabs $0xffffffffffffd920,%rdx
+  8007b0:	ff ff ff 
+  8007b3:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8007b7:	be 00 02 00 00       	mov    $0x200,%esi
+  8007bc:	48 89 c7             	mov    %rax,%rdi
+  8007bf:	49 89 df             	mov    %rbx,%r15
+  8007c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c7:	49 ba 25 7c ff ff ff 	movabs $0xffffffffffff7c25,%r10
+  8007ce:	ff ff ff 
+  8007d1:	49 01 da             	add    %rbx,%r10
+  8007d4:	41 ff d2             	call   *%r10
+  8007d7:	48 83 c4 10          	add    $0x10,%rsp
+  8007db:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+		     "Content-type: text/html\r\n"
+		     "\r\n"
+		     "<html><body><p>%d - %s</p></body></html>\r\n",
+		     e->code, e->msg, e->code, e->msg);
+
+	if (write(req->sock, buf, r) != r)
+  8007de:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8007e1:	48 63 d0             	movslq %eax,%rdx
+  8007e4:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8007eb:	8b 00                	mov    (%rax),%eax
+  8007ed:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8007f4:	48 89 ce             	mov    %rcx,%rsi
+  8007f7:	89 c7                	mov    %eax,%edi
+  8007f9:	49 89 df             	mov    %rbx,%r15
+  8007fc:	48 b8 34 9a ff ff ff 	movabs $0xffffffffffff9a34,%rax
+  800803:	ff ff ff 
+  800806:	48 01 d8             	add    %rbx,%rax
+  800809:	ff d0                	call   *%rax
+  80080b:	39 45 e4             	cmp    %eax,-0x1c(%rbp)
+  80080e:	74 07                	je     800817 <send_error+0x122>
+		return -1;
+  800810:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800815:	eb 05                	jmp    80081c <send_error+0x127>
+
+	return 0;
+  800817:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80081c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  800820:	5b                   	pop    %rbx
+  800821:	41 5f                	pop    %r15
+  800823:	5d                   	pop    %rbp
+  800824:	c3                   	ret
+
+0000000000800825 <send_file>:
+
+static int
+send_file(struct http_request *req)
+{
+  800825:	55                   	push   %rbp
+  800826:	48 89 e5             	mov    %rsp,%rbp
+  800829:	41 57                	push   %r15
+  80082b:	48 83 ec 28          	sub    $0x28,%rsp
+  80082f:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80082f <send_file+0xa>
+  800836:	49 bb 11 98 00 00 00 	movabs $0x9811,%r11
+  80083d:	00 00 00 
+  800840:	4c 01 d9             	add    %r11,%rcx
+  800843:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+	off_t file_size = -1;
+  800847:	c7 45 ec ff ff ff ff 	movl   $0xffffffff,-0x14(%rbp)
+	// if the file does not exist, send a 404 error using send_error
+	// if the file is a directory, send a 404 error using send_error
+	// set file_size to the size of the file
+
+	// LAB 6: Your code here.
+	panic("send_file not implemented");
+  80084e:	48 b8 9b d9 ff ff ff 	movabs $0xffffffffffffd99b,%rax
+  800855:	ff ff ff 
+  800858:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80085c:	48 89 c2             	mov    %rax,%rdx
+  80085f:	be e2 00 00 00       	mov    $0xe2,%esi
+  800864:	48 b8 c1 d8 ff ff ff 	movabs $0xffffffffffffd8c1,%rax
+  80086b:	ff ff ff 
+  80086e:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  800872:	48 89 c7             	mov    %rax,%rdi
+  800875:	49 89 cf             	mov    %rcx,%r15
+  800878:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087d:	49 b8 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%r8
+  800884:	ff ff ff 
+  800887:	49 01 c8             	add    %rcx,%r8
+  80088a:	41 ff d0             	call   *%r8
+
+000000000080088d <handle_client>:
+	return r;
+}
+
+static void
+handle_client(int sock)
+{
+  80088d:	55                   	push   %rbp
+  80088e:	48 89 e5             	mov    %rsp,%rbp
+  800891:	41 57                	push   %r15
+  800893:	53                   	push   %rbx
+  800894:	48 81 ec 40 02 00 00 	sub    $0x240,%rsp
+  80089b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80089b <handle_client+0xe>
+  8008a2:	49 bb a5 97 00 00 00 	movabs $0x97a5,%r11
+  8008a9:	00 00 00 
+  8008ac:	4c 01 db             	add    %r11,%rbx
+  8008af:	89 bd bc fd ff ff    	mov    %edi,-0x244(%rbp)
+	struct http_request con_d;
+	int r;
+	char buffer[BUFFSIZE];
+	int received = -1;
+  8008b5:	c7 45 ec ff ff ff ff 	movl   $0xffffffff,-0x14(%rbp)
+	struct http_request *req = &con_d;
+  8008bc:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8008c0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+	while (1)
+	{
+		// Receive message
+		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
+  8008c4:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+  8008cb:	8b 85 bc fd ff ff    	mov    -0x244(%rbp),%eax
+  8008d1:	ba 00 02 00 00       	mov    $0x200,%edx
+  8008d6:	48 89 ce             	mov    %rcx,%rsi
+  8008d9:	89 c7                	mov    %eax,%edi
+  8008db:	49 89 df             	mov    %rbx,%r15
+  8008de:	48 b8 8e 98 ff ff ff 	movabs $0xffffffffffff988e,%rax
+  8008e5:	ff ff ff 
+  8008e8:	48 01 d8             	add    %rbx,%rax
+  8008eb:	ff d0                	call   *%rax
+  8008ed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8008f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8008f4:	79 3e                	jns    800934 <handle_client+0xa7>
+			panic("failed to read");
+  8008f6:	48 b8 b5 d9 ff ff ff 	movabs $0xffffffffffffd9b5,%rax
+  8008fd:	ff ff ff 
+  800900:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800904:	48 89 c2             	mov    %rax,%rdx
+  800907:	be 04 01 00 00       	mov    $0x104,%esi
+  80090c:	48 b8 c1 d8 ff ff ff 	movabs $0xffffffffffffd8c1,%rax
+  800913:	ff ff ff 
+  800916:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80091a:	48 89 c7             	mov    %rax,%rdi
+  80091d:	49 89 df             	mov    %rbx,%r15
+  800920:	b8 00 00 00 00       	mov    $0x0,%eax
+  800925:	48 b9 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%rcx
+  80092c:	ff ff ff 
+  80092f:	48 01 d9             	add    %rbx,%rcx
+  800932:	ff d1                	call   *%rcx
+
+		memset(req, 0, sizeof(req));
+  800934:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800938:	ba 08 00 00 00       	mov    $0x8,%edx
+  80093d:	be 00 00 00 00       	mov    $0x0,%esi
+  800942:	48 89 c7             	mov    %rax,%rdi
+  800945:	49 89 df             	mov    %rbx,%r15
+  800948:	48 b8 f3 80 ff ff ff 	movabs $0xffffffffffff80f3,%rax
+  80094f:	ff ff ff 
+  800952:	48 01 d8             	add    %rbx,%rax
+  800955:	ff d0                	call   *%rax
+
+		req->sock = sock;
+  800957:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80095b:	8b 95 bc fd ff ff    	mov    -0x244(%rbp),%edx
+  800961:	89 10                	mov    %edx,(%rax)
+
+		r = http_request_parse(req, buffer);
+  800963:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80096a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80096e:	48 89 d6             	mov    %rdx,%rsi
+  800971:	48 89 c7             	mov    %rax,%rdi
+  800974:	48 b8 04 65 ff ff ff 	movabs $0xffffffffffff6504,%rax
+  80097b:	ff ff ff 
+  80097e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800982:	ff d0                	call   *%rax
+  800984:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r == -E_BAD_REQ)
+  800987:	81 7d dc 18 fc ff ff 	cmpl   $0xfffffc18,-0x24(%rbp)
+  80098e:	75 1e                	jne    8009ae <handle_client+0x121>
+			send_error(req, 400);
+  800990:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800994:	be 90 01 00 00       	mov    $0x190,%esi
+  800999:	48 89 c7             	mov    %rax,%rdi
+  80099c:	48 b8 b5 66 ff ff ff 	movabs $0xffffffffffff66b5,%rax
+  8009a3:	ff ff ff 
+  8009a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009aa:	ff d0                	call   *%rax
+  8009ac:	eb 5b                	jmp    800a09 <handle_client+0x17c>
+		else if (r < 0)
+  8009ae:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009b2:	79 3e                	jns    8009f2 <handle_client+0x165>
+			panic("parse failed");
+  8009b4:	48 b8 c4 d9 ff ff ff 	movabs $0xffffffffffffd9c4,%rax
+  8009bb:	ff ff ff 
+  8009be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009c2:	48 89 c2             	mov    %rax,%rdx
+  8009c5:	be 0e 01 00 00       	mov    $0x10e,%esi
+  8009ca:	48 b8 c1 d8 ff ff ff 	movabs $0xffffffffffffd8c1,%rax
+  8009d1:	ff ff ff 
+  8009d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009d8:	48 89 c7             	mov    %rax,%rdi
+  8009db:	49 89 df             	mov    %rbx,%r15
+  8009de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e3:	48 b9 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%rcx
+  8009ea:	ff ff ff 
+  8009ed:	48 01 d9             	add    %rbx,%rcx
+  8009f0:	ff d1                	call   *%rcx
+		else
+			send_file(req);
+  8009f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009f6:	48 89 c7             	mov    %rax,%rdi
+  8009f9:	48 b8 e5 67 ff ff ff 	movabs $0xffffffffffff67e5,%rax
+  800a00:	ff ff ff 
+  800a03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a07:	ff d0                	call   *%rax
+
+		req_free(req);
+  800a09:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a0d:	48 89 c7             	mov    %rax,%rdi
+  800a10:	48 b8 71 60 ff ff ff 	movabs $0xffffffffffff6071,%rax
+  800a17:	ff ff ff 
+  800a1a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a1e:	ff d0                	call   *%rax
+
+		// no keep alive
+		break;
+  800a20:	90                   	nop
+	}
+
+	close(sock);
+  800a21:	8b 85 bc fd ff ff    	mov    -0x244(%rbp),%eax
+  800a27:	89 c7                	mov    %eax,%edi
+  800a29:	49 89 df             	mov    %rbx,%r15
+  800a2c:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  800a33:	ff ff ff 
+  800a36:	48 01 d8             	add    %rbx,%rax
+  800a39:	ff d0                	call   *%rax
+}
+  800a3b:	90                   	nop
+  800a3c:	48 81 c4 40 02 00 00 	add    $0x240,%rsp
+  800a43:	5b                   	pop    %rbx
+  800a44:	41 5f                	pop    %r15
+  800a46:	5d                   	pop    %rbp
+  800a47:	c3                   	ret
+
+0000000000800a48 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800a48:	55                   	push   %rbp
+  800a49:	48 89 e5             	mov    %rsp,%rbp
+  800a4c:	41 57                	push   %r15
+  800a4e:	53                   	push   %rbx
+  800a4f:	48 83 ec 50          	sub    $0x50,%rsp
+  800a53:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800a53 <umain+0xb>
+  800a5a:	49 bb ed 95 00 00 00 	movabs $0x95ed,%r11
+  800a61:	00 00 00 
+  800a64:	4c 01 db             	add    %r11,%rbx
+  800a67:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  800a6a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+	int serversock, clientsock;
+	struct sockaddr_in server, client;
+
+	binaryname = "jhttpd";
+  800a6e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  800a75:	ff ff ff 
+  800a78:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800a7c:	48 ba d1 d9 ff ff ff 	movabs $0xffffffffffffd9d1,%rdx
+  800a83:	ff ff ff 
+  800a86:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800a8a:	48 89 10             	mov    %rdx,(%rax)
+
+	// Create the TCP socket
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800a8d:	ba 06 00 00 00       	mov    $0x6,%edx
+  800a92:	be 01 00 00 00       	mov    $0x1,%esi
+  800a97:	bf 02 00 00 00       	mov    $0x2,%edi
+  800a9c:	49 89 df             	mov    %rbx,%r15
+  800a9f:	48 b8 04 ae ff ff ff 	movabs $0xffffffffffffae04,%rax
+  800aa6:	ff ff ff 
+  800aa9:	48 01 d8             	add    %rbx,%rax
+  800aac:	ff d0                	call   *%rax
+  800aae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800ab1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800ab5:	79 21                	jns    800ad8 <umain+0x90>
+		die("Failed to create socket");
+  800ab7:	48 b8 d8 d9 ff ff ff 	movabs $0xffffffffffffd9d8,%rax
+  800abe:	ff ff ff 
+  800ac1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ac5:	48 89 c7             	mov    %rax,%rdi
+  800ac8:	48 b8 03 60 ff ff ff 	movabs $0xffffffffffff6003,%rax
+  800acf:	ff ff ff 
+  800ad2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ad6:	ff d0                	call   *%rax
+
+	// Construct the server sockaddr_in structure
+	memset(&server, 0, sizeof(server));		// Clear struct
+  800ad8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800adc:	ba 10 00 00 00       	mov    $0x10,%edx
+  800ae1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ae6:	48 89 c7             	mov    %rax,%rdi
+  800ae9:	49 89 df             	mov    %rbx,%r15
+  800aec:	48 b8 f3 80 ff ff ff 	movabs $0xffffffffffff80f3,%rax
+  800af3:	ff ff ff 
+  800af6:	48 01 d8             	add    %rbx,%rax
+  800af9:	ff d0                	call   *%rax
+	server.sin_family = AF_INET;			// Internet/IP
+  800afb:	c6 45 d1 02          	movb   $0x2,-0x2f(%rbp)
+	server.sin_addr.s_addr = htonl(INADDR_ANY);	// IP address
+  800aff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b04:	49 89 df             	mov    %rbx,%r15
+  800b07:	48 b8 c4 d7 ff ff ff 	movabs $0xffffffffffffd7c4,%rax
+  800b0e:	ff ff ff 
+  800b11:	48 01 d8             	add    %rbx,%rax
+  800b14:	ff d0                	call   *%rax
+  800b16:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+	server.sin_port = htons(PORT);			// server port
+  800b19:	bf 50 00 00 00       	mov    $0x50,%edi
+  800b1e:	49 89 df             	mov    %rbx,%r15
+  800b21:	48 b8 53 d7 ff ff ff 	movabs $0xffffffffffffd753,%rax
+  800b28:	ff ff ff 
+  800b2b:	48 01 d8             	add    %rbx,%rax
+  800b2e:	ff d0                	call   *%rax
+  800b30:	66 89 45 d2          	mov    %ax,-0x2e(%rbp)
+
+	// Bind the server socket
+	if (bind(serversock, (struct sockaddr *) &server,
+  800b34:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  800b38:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800b3b:	ba 10 00 00 00       	mov    $0x10,%edx
+  800b40:	48 89 ce             	mov    %rcx,%rsi
+  800b43:	89 c7                	mov    %eax,%edi
+  800b45:	49 89 df             	mov    %rbx,%r15
+  800b48:	48 b8 bd aa ff ff ff 	movabs $0xffffffffffffaabd,%rax
+  800b4f:	ff ff ff 
+  800b52:	48 01 d8             	add    %rbx,%rax
+  800b55:	ff d0                	call   *%rax
+  800b57:	85 c0                	test   %eax,%eax
+  800b59:	79 21                	jns    800b7c <umain+0x134>
+		 sizeof(server)) < 0)
+	{
+		die("Failed to bind the server socket");
+  800b5b:	48 b8 f0 d9 ff ff ff 	movabs $0xffffffffffffd9f0,%rax
+  800b62:	ff ff ff 
+  800b65:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b69:	48 89 c7             	mov    %rax,%rdi
+  800b6c:	48 b8 03 60 ff ff ff 	movabs $0xffffffffffff6003,%rax
+  800b73:	ff ff ff 
+  800b76:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b7a:	ff d0                	call   *%rax
+	}
+
+	// Listen on the server socket
+	if (listen(serversock, MAXPENDING) < 0)
+  800b7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800b7f:	be 05 00 00 00       	mov    $0x5,%esi
+  800b84:	89 c7                	mov    %eax,%edi
+  800b86:	49 89 df             	mov    %rbx,%r15
+  800b89:	48 b8 82 ac ff ff ff 	movabs $0xffffffffffffac82,%rax
+  800b90:	ff ff ff 
+  800b93:	48 01 d8             	add    %rbx,%rax
+  800b96:	ff d0                	call   *%rax
+  800b98:	85 c0                	test   %eax,%eax
+  800b9a:	79 21                	jns    800bbd <umain+0x175>
+		die("Failed to listen on server socket");
+  800b9c:	48 b8 18 da ff ff ff 	movabs $0xffffffffffffda18,%rax
+  800ba3:	ff ff ff 
+  800ba6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800baa:	48 89 c7             	mov    %rax,%rdi
+  800bad:	48 b8 03 60 ff ff ff 	movabs $0xffffffffffff6003,%rax
+  800bb4:	ff ff ff 
+  800bb7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800bbb:	ff d0                	call   *%rax
+
+	cprintf("Waiting for http connections...\n");
+  800bbd:	48 b8 40 da ff ff ff 	movabs $0xffffffffffffda40,%rax
+  800bc4:	ff ff ff 
+  800bc7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800bcb:	48 89 c7             	mov    %rax,%rdi
+  800bce:	49 89 df             	mov    %rbx,%r15
+  800bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd6:	48 ba f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rdx
+  800bdd:	ff ff ff 
+  800be0:	48 01 da             	add    %rbx,%rdx
+  800be3:	ff d2                	call   *%rdx
+
+	while (1) {
+		unsigned int clientlen = sizeof(client);
+  800be5:	c7 45 bc 10 00 00 00 	movl   $0x10,-0x44(%rbp)
+		// Wait for client connection
+		if ((clientsock = accept(serversock,
+  800bec:	48 8d 55 bc          	lea    -0x44(%rbp),%rdx
+  800bf0:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+  800bf4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bf7:	48 89 ce             	mov    %rcx,%rsi
+  800bfa:	89 c7                	mov    %eax,%edi
+  800bfc:	49 89 df             	mov    %rbx,%r15
+  800bff:	48 b8 22 aa ff ff ff 	movabs $0xffffffffffffaa22,%rax
+  800c06:	ff ff ff 
+  800c09:	48 01 d8             	add    %rbx,%rax
+  800c0c:	ff d0                	call   *%rax
+  800c0e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800c11:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800c15:	79 21                	jns    800c38 <umain+0x1f0>
+					 (struct sockaddr *) &client,
+					 &clientlen)) < 0)
+		{
+			die("Failed to accept client connection");
+  800c17:	48 b8 68 da ff ff ff 	movabs $0xffffffffffffda68,%rax
+  800c1e:	ff ff ff 
+  800c21:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c25:	48 89 c7             	mov    %rax,%rdi
+  800c28:	48 b8 03 60 ff ff ff 	movabs $0xffffffffffff6003,%rax
+  800c2f:	ff ff ff 
+  800c32:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c36:	ff d0                	call   *%rax
+		}
+		handle_client(clientsock);
+  800c38:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800c3b:	89 c7                	mov    %eax,%edi
+  800c3d:	48 b8 4d 68 ff ff ff 	movabs $0xffffffffffff684d,%rax
+  800c44:	ff ff ff 
+  800c47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c4b:	ff d0                	call   *%rax
+	while (1) {
+  800c4d:	eb 96                	jmp    800be5 <umain+0x19d>
+
+0000000000800c4f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800c4f:	55                   	push   %rbp
+  800c50:	48 89 e5             	mov    %rsp,%rbp
+  800c53:	41 57                	push   %r15
+  800c55:	53                   	push   %rbx
+  800c56:	48 83 ec 20          	sub    $0x20,%rsp
+  800c5a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800c5a <libmain+0xb>
+  800c61:	49 bb e6 93 00 00 00 	movabs $0x93e6,%r11
+  800c68:	00 00 00 
+  800c6b:	4c 01 db             	add    %r11,%rbx
+  800c6e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800c71:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800c75:	49 89 df             	mov    %rbx,%r15
+  800c78:	48 b8 c5 89 ff ff ff 	movabs $0xffffffffffff89c5,%rax
+  800c7f:	ff ff ff 
+  800c82:	48 01 d8             	add    %rbx,%rax
+  800c85:	ff d0                	call   *%rax
+  800c87:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800c8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c8d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800c92:	48 98                	cltq
+  800c94:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800c9b:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  800ca2:	ff ff ff 
+  800ca5:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800ca9:	48 01 c2             	add    %rax,%rdx
+  800cac:	48 b8 20 24 01 00 00 	movabs $0x12420,%rax
+  800cb3:	00 00 00 
+  800cb6:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800cba:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cbe:	7e 15                	jle    800cd5 <libmain+0x86>
+		binaryname = argv[0];
+  800cc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cc4:	48 8b 00             	mov    (%rax),%rax
+  800cc7:	48 ba 60 00 00 00 00 	movabs $0x60,%rdx
+  800cce:	00 00 00 
+  800cd1:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800cd5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800cd9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800cdc:	48 89 d6             	mov    %rdx,%rsi
+  800cdf:	89 c7                	mov    %eax,%edi
+  800ce1:	49 89 df             	mov    %rbx,%r15
+  800ce4:	48 b8 08 6a ff ff ff 	movabs $0xffffffffffff6a08,%rax
+  800ceb:	ff ff ff 
+  800cee:	48 01 d8             	add    %rbx,%rax
+  800cf1:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800cf3:	49 89 df             	mov    %rbx,%r15
+  800cf6:	48 b8 cf 6c ff ff ff 	movabs $0xffffffffffff6ccf,%rax
+  800cfd:	ff ff ff 
+  800d00:	48 01 d8             	add    %rbx,%rax
+  800d03:	ff d0                	call   *%rax
+}
+  800d05:	90                   	nop
+  800d06:	48 83 c4 20          	add    $0x20,%rsp
+  800d0a:	5b                   	pop    %rbx
+  800d0b:	41 5f                	pop    %r15
+  800d0d:	5d                   	pop    %rbp
+  800d0e:	c3                   	ret
+
+0000000000800d0f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800d0f:	55                   	push   %rbp
+  800d10:	48 89 e5             	mov    %rsp,%rbp
+  800d13:	41 57                	push   %r15
+  800d15:	53                   	push   %rbx
+  800d16:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800d16 <exit+0x7>
+  800d1d:	49 bb 2a 93 00 00 00 	movabs $0x932a,%r11
+  800d24:	00 00 00 
+  800d27:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800d2a:	49 89 df             	mov    %rbx,%r15
+  800d2d:	48 b8 42 96 ff ff ff 	movabs $0xffffffffffff9642,%rax
+  800d34:	ff ff ff 
+  800d37:	48 01 d8             	add    %rbx,%rax
+  800d3a:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800d3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d41:	49 89 df             	mov    %rbx,%r15
+  800d44:	48 b8 69 89 ff ff ff 	movabs $0xffffffffffff8969,%rax
+  800d4b:	ff ff ff 
+  800d4e:	48 01 d8             	add    %rbx,%rax
+  800d51:	ff d0                	call   *%rax
+}
+  800d53:	90                   	nop
+  800d54:	5b                   	pop    %rbx
+  800d55:	41 5f                	pop    %r15
+  800d57:	5d                   	pop    %rbp
+  800d58:	c3                   	ret
+
+0000000000800d59 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800d59:	55                   	push   %rbp
+  800d5a:	48 89 e5             	mov    %rsp,%rbp
+  800d5d:	41 57                	push   %r15
+  800d5f:	41 54                	push   %r12
+  800d61:	53                   	push   %rbx
+  800d62:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800d69:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800d69 <_panic+0x10>
+  800d70:	49 bb d7 92 00 00 00 	movabs $0x92d7,%r11
+  800d77:	00 00 00 
+  800d7a:	4c 01 db             	add    %r11,%rbx
+  800d7d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800d84:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800d8a:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800d91:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800d98:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800d9f:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800da6:	84 c0                	test   %al,%al
+  800da8:	74 26                	je     800dd0 <_panic+0x77>
+  800daa:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800db1:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800db8:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800dbc:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800dc0:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800dc4:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800dc8:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800dcc:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800dd0:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800dd7:	00 00 00 
+  800dda:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800de1:	00 00 00 
+  800de4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800de8:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800def:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800df6:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800dfd:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  800e04:	ff ff ff 
+  800e07:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800e0b:	4c 8b 20             	mov    (%rax),%r12
+  800e0e:	49 89 df             	mov    %rbx,%r15
+  800e11:	48 b8 c5 89 ff ff ff 	movabs $0xffffffffffff89c5,%rax
+  800e18:	ff ff ff 
+  800e1b:	48 01 d8             	add    %rbx,%rax
+  800e1e:	ff d0                	call   *%rax
+  800e20:	89 c6                	mov    %eax,%esi
+  800e22:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800e28:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800e2f:	41 89 d0             	mov    %edx,%r8d
+  800e32:	48 89 c1             	mov    %rax,%rcx
+  800e35:	4c 89 e2             	mov    %r12,%rdx
+  800e38:	48 b8 98 da ff ff ff 	movabs $0xffffffffffffda98,%rax
+  800e3f:	ff ff ff 
+  800e42:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e46:	48 89 c7             	mov    %rax,%rdi
+  800e49:	49 89 df             	mov    %rbx,%r15
+  800e4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e51:	49 b9 f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%r9
+  800e58:	ff ff ff 
+  800e5b:	49 01 d9             	add    %rbx,%r9
+  800e5e:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800e61:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800e68:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800e6f:	48 89 d6             	mov    %rdx,%rsi
+  800e72:	48 89 c7             	mov    %rax,%rdi
+  800e75:	49 89 df             	mov    %rbx,%r15
+  800e78:	48 b8 10 6f ff ff ff 	movabs $0xffffffffffff6f10,%rax
+  800e7f:	ff ff ff 
+  800e82:	48 01 d8             	add    %rbx,%rax
+  800e85:	ff d0                	call   *%rax
+	cprintf("\n");
+  800e87:	48 b8 bb da ff ff ff 	movabs $0xffffffffffffdabb,%rax
+  800e8e:	ff ff ff 
+  800e91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e95:	48 89 c7             	mov    %rax,%rdi
+  800e98:	49 89 df             	mov    %rbx,%r15
+  800e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea0:	48 ba f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rdx
+  800ea7:	ff ff ff 
+  800eaa:	48 01 da             	add    %rbx,%rdx
+  800ead:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800eaf:	cc                   	int3
+  800eb0:	eb fd                	jmp    800eaf <_panic+0x156>
+
+0000000000800eb2 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800eb2:	55                   	push   %rbp
+  800eb3:	48 89 e5             	mov    %rsp,%rbp
+  800eb6:	41 57                	push   %r15
+  800eb8:	48 83 ec 18          	sub    $0x18,%rsp
+  800ebc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ebc <putch+0xa>
+  800ec3:	49 bb 84 91 00 00 00 	movabs $0x9184,%r11
+  800eca:	00 00 00 
+  800ecd:	4c 01 d8             	add    %r11,%rax
+  800ed0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800ed3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800ed7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800edb:	8b 12                	mov    (%rdx),%edx
+  800edd:	8d 72 01             	lea    0x1(%rdx),%esi
+  800ee0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800ee4:	89 31                	mov    %esi,(%rcx)
+  800ee6:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800ee9:	89 ce                	mov    %ecx,%esi
+  800eeb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800eef:	48 63 d2             	movslq %edx,%rdx
+  800ef2:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800ef7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800efb:	8b 12                	mov    (%rdx),%edx
+  800efd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800f03:	75 33                	jne    800f38 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800f05:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800f09:	8b 12                	mov    (%rdx),%edx
+  800f0b:	48 63 d2             	movslq %edx,%rdx
+  800f0e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800f12:	48 83 c1 08          	add    $0x8,%rcx
+  800f16:	48 89 d6             	mov    %rdx,%rsi
+  800f19:	48 89 cf             	mov    %rcx,%rdi
+  800f1c:	49 89 c7             	mov    %rax,%r15
+  800f1f:	48 ba b6 88 ff ff ff 	movabs $0xffffffffffff88b6,%rdx
+  800f26:	ff ff ff 
+  800f29:	48 01 c2             	add    %rax,%rdx
+  800f2c:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800f2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f32:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800f38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f3c:	8b 40 04             	mov    0x4(%rax),%eax
+  800f3f:	8d 50 01             	lea    0x1(%rax),%edx
+  800f42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f46:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800f49:	90                   	nop
+  800f4a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800f4e:	c9                   	leave
+  800f4f:	c3                   	ret
+
+0000000000800f50 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800f50:	55                   	push   %rbp
+  800f51:	48 89 e5             	mov    %rsp,%rbp
+  800f54:	41 57                	push   %r15
+  800f56:	53                   	push   %rbx
+  800f57:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800f5e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800f5e <vcprintf+0xe>
+  800f65:	49 bb e2 90 00 00 00 	movabs $0x90e2,%r11
+  800f6c:	00 00 00 
+  800f6f:	4c 01 db             	add    %r11,%rbx
+  800f72:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800f79:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800f80:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800f87:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800f8e:	48 8b 06             	mov    (%rsi),%rax
+  800f91:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800f95:	48 89 01             	mov    %rax,(%rcx)
+  800f98:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800f9c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800fa0:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800fa4:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800fab:	00 00 00 
+    b.cnt = 0;
+  800fae:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800fb5:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800fb8:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800fbf:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800fc6:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800fcd:	48 89 c6             	mov    %rax,%rsi
+  800fd0:	48 b8 72 6e ff ff ff 	movabs $0xffffffffffff6e72,%rax
+  800fd7:	ff ff ff 
+  800fda:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fde:	48 89 c7             	mov    %rax,%rdi
+  800fe1:	49 89 df             	mov    %rbx,%r15
+  800fe4:	48 b8 34 74 ff ff ff 	movabs $0xffffffffffff7434,%rax
+  800feb:	ff ff ff 
+  800fee:	48 01 d8             	add    %rbx,%rax
+  800ff1:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800ff3:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800ff9:	48 98                	cltq
+  800ffb:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  801002:	48 83 c2 08          	add    $0x8,%rdx
+  801006:	48 89 c6             	mov    %rax,%rsi
+  801009:	48 89 d7             	mov    %rdx,%rdi
+  80100c:	49 89 df             	mov    %rbx,%r15
+  80100f:	48 b8 b6 88 ff ff ff 	movabs $0xffffffffffff88b6,%rax
+  801016:	ff ff ff 
+  801019:	48 01 d8             	add    %rbx,%rax
+  80101c:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  80101e:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  801024:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80102b:	5b                   	pop    %rbx
+  80102c:	41 5f                	pop    %r15
+  80102e:	5d                   	pop    %rbp
+  80102f:	c3                   	ret
+
+0000000000801030 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  801030:	55                   	push   %rbp
+  801031:	48 89 e5             	mov    %rsp,%rbp
+  801034:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80103b:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80103b <cprintf+0xb>
+  801042:	49 bb 05 90 00 00 00 	movabs $0x9005,%r11
+  801049:	00 00 00 
+  80104c:	4d 01 da             	add    %r11,%r10
+  80104f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801056:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80105d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  801064:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80106b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801072:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801079:	84 c0                	test   %al,%al
+  80107b:	74 20                	je     80109d <cprintf+0x6d>
+  80107d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801081:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801085:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801089:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80108d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801091:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801095:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801099:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80109d:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8010a4:	00 00 00 
+  8010a7:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8010ae:	00 00 00 
+  8010b1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010b5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8010bc:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010c3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8010ca:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8010d1:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8010d8:	48 8b 06             	mov    (%rsi),%rax
+  8010db:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8010df:	48 89 01             	mov    %rax,(%rcx)
+  8010e2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8010e6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8010ea:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8010ee:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8010f5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8010fc:	48 89 d6             	mov    %rdx,%rsi
+  8010ff:	48 89 c7             	mov    %rax,%rdi
+  801102:	48 b8 10 6f ff ff ff 	movabs $0xffffffffffff6f10,%rax
+  801109:	ff ff ff 
+  80110c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801110:	ff d0                	call   *%rax
+  801112:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  801118:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80111e:	c9                   	leave
+  80111f:	c3                   	ret
+
+0000000000801120 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801120:	55                   	push   %rbp
+  801121:	48 89 e5             	mov    %rsp,%rbp
+  801124:	53                   	push   %rbx
+  801125:	48 83 ec 38          	sub    $0x38,%rsp
+  801129:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801129 <printnum+0x9>
+  801130:	49 bb 17 8f 00 00 00 	movabs $0x8f17,%r11
+  801137:	00 00 00 
+  80113a:	4c 01 db             	add    %r11,%rbx
+  80113d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801141:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801145:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801149:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80114c:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  801150:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801154:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801157:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80115b:	72 58                	jb     8011b5 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80115d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  801160:	8d 78 ff             	lea    -0x1(%rax),%edi
+  801163:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  801166:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80116a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116f:	48 f7 f6             	div    %rsi
+  801172:	49 89 c2             	mov    %rax,%r10
+  801175:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  801178:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80117b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80117f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801183:	41 89 c9             	mov    %ecx,%r9d
+  801186:	41 89 f8             	mov    %edi,%r8d
+  801189:	89 d1                	mov    %edx,%ecx
+  80118b:	4c 89 d2             	mov    %r10,%rdx
+  80118e:	48 89 c7             	mov    %rax,%rdi
+  801191:	48 b8 e0 70 ff ff ff 	movabs $0xffffffffffff70e0,%rax
+  801198:	ff ff ff 
+  80119b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80119f:	ff d0                	call   *%rax
+  8011a1:	eb 1c                	jmp    8011bf <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8011a3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011a7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8011aa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8011ae:	48 89 d6             	mov    %rdx,%rsi
+  8011b1:	89 c7                	mov    %eax,%edi
+  8011b3:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8011b5:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8011b9:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8011bd:	7f e4                	jg     8011a3 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8011bf:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8011c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011cb:	48 f7 f1             	div    %rcx
+  8011ce:	48 b8 f7 db ff ff ff 	movabs $0xffffffffffffdbf7,%rax
+  8011d5:	ff ff ff 
+  8011d8:	48 01 d8             	add    %rbx,%rax
+  8011db:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8011df:	0f be c0             	movsbl %al,%eax
+  8011e2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8011e6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8011ea:	48 89 d6             	mov    %rdx,%rsi
+  8011ed:	89 c7                	mov    %eax,%edi
+  8011ef:	ff d1                	call   *%rcx
+}
+  8011f1:	90                   	nop
+  8011f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011f6:	c9                   	leave
+  8011f7:	c3                   	ret
+
+00000000008011f8 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8011f8:	55                   	push   %rbp
+  8011f9:	48 89 e5             	mov    %rsp,%rbp
+  8011fc:	48 83 ec 20          	sub    $0x20,%rsp
+  801200:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801200 <getuint+0x8>
+  801207:	49 bb 40 8e 00 00 00 	movabs $0x8e40,%r11
+  80120e:	00 00 00 
+  801211:	4c 01 d8             	add    %r11,%rax
+  801214:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801218:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80121b:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80121f:	7e 4f                	jle    801270 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  801221:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801225:	8b 00                	mov    (%rax),%eax
+  801227:	83 f8 2f             	cmp    $0x2f,%eax
+  80122a:	77 24                	ja     801250 <getuint+0x58>
+  80122c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801230:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801234:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801238:	8b 00                	mov    (%rax),%eax
+  80123a:	89 c0                	mov    %eax,%eax
+  80123c:	48 01 d0             	add    %rdx,%rax
+  80123f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801243:	8b 12                	mov    (%rdx),%edx
+  801245:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801248:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80124c:	89 0a                	mov    %ecx,(%rdx)
+  80124e:	eb 14                	jmp    801264 <getuint+0x6c>
+  801250:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801254:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801258:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80125c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801260:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801264:	48 8b 00             	mov    (%rax),%rax
+  801267:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80126b:	e9 9d 00 00 00       	jmp    80130d <getuint+0x115>
+	else if (lflag)
+  801270:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801274:	74 4c                	je     8012c2 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  801276:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80127a:	8b 00                	mov    (%rax),%eax
+  80127c:	83 f8 2f             	cmp    $0x2f,%eax
+  80127f:	77 24                	ja     8012a5 <getuint+0xad>
+  801281:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801285:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801289:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80128d:	8b 00                	mov    (%rax),%eax
+  80128f:	89 c0                	mov    %eax,%eax
+  801291:	48 01 d0             	add    %rdx,%rax
+  801294:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801298:	8b 12                	mov    (%rdx),%edx
+  80129a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80129d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012a1:	89 0a                	mov    %ecx,(%rdx)
+  8012a3:	eb 14                	jmp    8012b9 <getuint+0xc1>
+  8012a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012a9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012ad:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8012b1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012b5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8012b9:	48 8b 00             	mov    (%rax),%rax
+  8012bc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8012c0:	eb 4b                	jmp    80130d <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8012c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c6:	8b 00                	mov    (%rax),%eax
+  8012c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8012cb:	77 24                	ja     8012f1 <getuint+0xf9>
+  8012cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8012d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d9:	8b 00                	mov    (%rax),%eax
+  8012db:	89 c0                	mov    %eax,%eax
+  8012dd:	48 01 d0             	add    %rdx,%rax
+  8012e0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012e4:	8b 12                	mov    (%rdx),%edx
+  8012e6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8012e9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8012ed:	89 0a                	mov    %ecx,(%rdx)
+  8012ef:	eb 14                	jmp    801305 <getuint+0x10d>
+  8012f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012f5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012f9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8012fd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801301:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801305:	8b 00                	mov    (%rax),%eax
+  801307:	89 c0                	mov    %eax,%eax
+  801309:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80130d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801311:	c9                   	leave
+  801312:	c3                   	ret
+
+0000000000801313 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  801313:	55                   	push   %rbp
+  801314:	48 89 e5             	mov    %rsp,%rbp
+  801317:	48 83 ec 20          	sub    $0x20,%rsp
+  80131b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80131b <printfloat+0x8>
+  801322:	49 bb 25 8d 00 00 00 	movabs $0x8d25,%r11
+  801329:	00 00 00 
+  80132c:	4c 01 d8             	add    %r11,%rax
+  80132f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801333:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801337:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80133b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80133f:	48 85 c0             	test   %rax,%rax
+  801342:	79 12                	jns    801356 <printfloat+0x43>
+		putch('-',putdat);
+  801344:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801348:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80134c:	48 89 c6             	mov    %rax,%rsi
+  80134f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801354:	ff d2                	call   *%rdx
+	
+}
+  801356:	90                   	nop
+  801357:	c9                   	leave
+  801358:	c3                   	ret
+
+0000000000801359 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  801359:	55                   	push   %rbp
+  80135a:	48 89 e5             	mov    %rsp,%rbp
+  80135d:	48 83 ec 20          	sub    $0x20,%rsp
+  801361:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801361 <getint+0x8>
+  801368:	49 bb df 8c 00 00 00 	movabs $0x8cdf,%r11
+  80136f:	00 00 00 
+  801372:	4c 01 d8             	add    %r11,%rax
+  801375:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801379:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80137c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801380:	7e 4f                	jle    8013d1 <getint+0x78>
+		x=va_arg(*ap, long long);
+  801382:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801386:	8b 00                	mov    (%rax),%eax
+  801388:	83 f8 2f             	cmp    $0x2f,%eax
+  80138b:	77 24                	ja     8013b1 <getint+0x58>
+  80138d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801391:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801395:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801399:	8b 00                	mov    (%rax),%eax
+  80139b:	89 c0                	mov    %eax,%eax
+  80139d:	48 01 d0             	add    %rdx,%rax
+  8013a0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8013a4:	8b 12                	mov    (%rdx),%edx
+  8013a6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8013a9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8013ad:	89 0a                	mov    %ecx,(%rdx)
+  8013af:	eb 14                	jmp    8013c5 <getint+0x6c>
+  8013b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013b9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8013bd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8013c1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8013c5:	48 8b 00             	mov    (%rax),%rax
+  8013c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8013cc:	e9 9d 00 00 00       	jmp    80146e <getint+0x115>
+	else if (lflag)
+  8013d1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8013d5:	74 4c                	je     801423 <getint+0xca>
+		x=va_arg(*ap, long);
+  8013d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013db:	8b 00                	mov    (%rax),%eax
+  8013dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8013e0:	77 24                	ja     801406 <getint+0xad>
+  8013e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8013ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013ee:	8b 00                	mov    (%rax),%eax
+  8013f0:	89 c0                	mov    %eax,%eax
+  8013f2:	48 01 d0             	add    %rdx,%rax
+  8013f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8013f9:	8b 12                	mov    (%rdx),%edx
+  8013fb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8013fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801402:	89 0a                	mov    %ecx,(%rdx)
+  801404:	eb 14                	jmp    80141a <getint+0xc1>
+  801406:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80140a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80140e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801412:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801416:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80141a:	48 8b 00             	mov    (%rax),%rax
+  80141d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801421:	eb 4b                	jmp    80146e <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  801423:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801427:	8b 00                	mov    (%rax),%eax
+  801429:	83 f8 2f             	cmp    $0x2f,%eax
+  80142c:	77 24                	ja     801452 <getint+0xf9>
+  80142e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801432:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801436:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143a:	8b 00                	mov    (%rax),%eax
+  80143c:	89 c0                	mov    %eax,%eax
+  80143e:	48 01 d0             	add    %rdx,%rax
+  801441:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801445:	8b 12                	mov    (%rdx),%edx
+  801447:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80144a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80144e:	89 0a                	mov    %ecx,(%rdx)
+  801450:	eb 14                	jmp    801466 <getint+0x10d>
+  801452:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801456:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80145a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80145e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801462:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801466:	8b 00                	mov    (%rax),%eax
+  801468:	48 98                	cltq
+  80146a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80146e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801472:	c9                   	leave
+  801473:	c3                   	ret
+
+0000000000801474 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  801474:	55                   	push   %rbp
+  801475:	48 89 e5             	mov    %rsp,%rbp
+  801478:	41 57                	push   %r15
+  80147a:	41 55                	push   %r13
+  80147c:	41 54                	push   %r12
+  80147e:	53                   	push   %rbx
+  80147f:	48 83 ec 60          	sub    $0x60,%rsp
+  801483:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 801483 <vprintfmt+0xf>
+  80148a:	49 bb bd 8b 00 00 00 	movabs $0x8bbd,%r11
+  801491:	00 00 00 
+  801494:	4d 01 dc             	add    %r11,%r12
+  801497:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  80149b:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  80149f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8014a3:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  8014a7:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  8014ae:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  8014b2:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  8014b6:	48 8b 06             	mov    (%rsi),%rax
+  8014b9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8014bd:	48 89 01             	mov    %rax,(%rcx)
+  8014c0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8014c4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8014c8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8014cc:	eb 17                	jmp    8014e5 <vprintfmt+0x71>
+			if (ch == '\0')
+  8014ce:	85 db                	test   %ebx,%ebx
+  8014d0:	0f 84 97 05 00 00    	je     801a6d <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  8014d6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8014da:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8014de:	48 89 c6             	mov    %rax,%rsi
+  8014e1:	89 df                	mov    %ebx,%edi
+  8014e3:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8014e5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8014e9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8014ed:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8014f1:	0f b6 00             	movzbl (%rax),%eax
+  8014f4:	0f b6 d8             	movzbl %al,%ebx
+  8014f7:	83 fb 25             	cmp    $0x25,%ebx
+  8014fa:	75 d2                	jne    8014ce <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  8014fc:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  801500:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  801507:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  80150e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  801515:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  80151c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801520:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801524:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801528:	0f b6 00             	movzbl (%rax),%eax
+  80152b:	0f b6 d8             	movzbl %al,%ebx
+  80152e:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  801531:	83 f8 55             	cmp    $0x55,%eax
+  801534:	0f 87 00 05 00 00    	ja     801a3a <vprintfmt+0x5c6>
+  80153a:	89 c0                	mov    %eax,%eax
+  80153c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801543:	00 
+  801544:	48 8d 05 15 67 00 00 	lea    0x6715(%rip),%rax        # 807c60 <.LC18+0xc>
+  80154b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  80154f:	48 8d 15 0a 67 00 00 	lea    0x670a(%rip),%rdx        # 807c60 <.LC18+0xc>
+  801556:	48 01 d0             	add    %rdx,%rax
+  801559:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  80155b:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  80155f:	eb bb                	jmp    80151c <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  801561:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  801565:	eb b5                	jmp    80151c <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  801567:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  80156e:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  801571:	89 d0                	mov    %edx,%eax
+  801573:	c1 e0 02             	shl    $0x2,%eax
+  801576:	01 d0                	add    %edx,%eax
+  801578:	01 c0                	add    %eax,%eax
+  80157a:	01 d8                	add    %ebx,%eax
+  80157c:	83 e8 30             	sub    $0x30,%eax
+  80157f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  801582:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801586:	0f b6 00             	movzbl (%rax),%eax
+  801589:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  80158c:	83 fb 2f             	cmp    $0x2f,%ebx
+  80158f:	7e 60                	jle    8015f1 <vprintfmt+0x17d>
+  801591:	83 fb 39             	cmp    $0x39,%ebx
+  801594:	7f 5b                	jg     8015f1 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  801596:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  80159b:	eb d1                	jmp    80156e <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  80159d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8015a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8015a3:	77 17                	ja     8015bc <vprintfmt+0x148>
+  8015a5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8015a9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8015ac:	89 d2                	mov    %edx,%edx
+  8015ae:	48 01 d0             	add    %rdx,%rax
+  8015b1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8015b4:	83 c2 08             	add    $0x8,%edx
+  8015b7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8015ba:	eb 0c                	jmp    8015c8 <vprintfmt+0x154>
+  8015bc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015c0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8015c4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8015c8:	8b 00                	mov    (%rax),%eax
+  8015ca:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  8015cd:	eb 23                	jmp    8015f2 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  8015cf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8015d3:	0f 89 43 ff ff ff    	jns    80151c <vprintfmt+0xa8>
+				width = 0;
+  8015d9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  8015e0:	e9 37 ff ff ff       	jmp    80151c <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  8015e5:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  8015ec:	e9 2b ff ff ff       	jmp    80151c <vprintfmt+0xa8>
+			goto process_precision;
+  8015f1:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8015f2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8015f6:	0f 89 20 ff ff ff    	jns    80151c <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  8015fc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8015ff:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  801602:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  801609:	e9 0e ff ff ff       	jmp    80151c <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  80160e:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  801612:	e9 05 ff ff ff       	jmp    80151c <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  801617:	83 fb 39             	cmp    $0x39,%ebx
+  80161a:	7f 0b                	jg     801627 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  80161c:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  80161f:	c1 e0 08             	shl    $0x8,%eax
+  801622:	01 45 bc             	add    %eax,-0x44(%rbp)
+  801625:	eb 21                	jmp    801648 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  801627:	83 fb 60             	cmp    $0x60,%ebx
+  80162a:	7e 10                	jle    80163c <vprintfmt+0x1c8>
+  80162c:	83 fb 66             	cmp    $0x66,%ebx
+  80162f:	7f 0b                	jg     80163c <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  801631:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  801634:	c1 e0 08             	shl    $0x8,%eax
+  801637:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80163a:	eb 0c                	jmp    801648 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  80163c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  801643:	e9 04 01 00 00       	jmp    80174c <vprintfmt+0x2d8>
+  801648:	e9 ff 00 00 00       	jmp    80174c <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  80164d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801650:	83 f8 2f             	cmp    $0x2f,%eax
+  801653:	77 17                	ja     80166c <vprintfmt+0x1f8>
+  801655:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801659:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80165c:	89 d2                	mov    %edx,%edx
+  80165e:	48 01 d0             	add    %rdx,%rax
+  801661:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801664:	83 c2 08             	add    $0x8,%edx
+  801667:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80166a:	eb 0c                	jmp    801678 <vprintfmt+0x204>
+  80166c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801670:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801674:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801678:	8b 00                	mov    (%rax),%eax
+  80167a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80167e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801682:	48 89 d6             	mov    %rdx,%rsi
+  801685:	89 c7                	mov    %eax,%edi
+  801687:	ff d1                	call   *%rcx
+			break;
+  801689:	e9 da 03 00 00       	jmp    801a68 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80168e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801691:	83 f8 2f             	cmp    $0x2f,%eax
+  801694:	77 17                	ja     8016ad <vprintfmt+0x239>
+  801696:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80169a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80169d:	89 d2                	mov    %edx,%edx
+  80169f:	48 01 d0             	add    %rdx,%rax
+  8016a2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8016a5:	83 c2 08             	add    $0x8,%edx
+  8016a8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8016ab:	eb 0c                	jmp    8016b9 <vprintfmt+0x245>
+  8016ad:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8016b1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8016b5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8016b9:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8016bb:	85 db                	test   %ebx,%ebx
+  8016bd:	79 02                	jns    8016c1 <vprintfmt+0x24d>
+				err = -err;
+  8016bf:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8016c1:	83 fb 15             	cmp    $0x15,%ebx
+  8016c4:	7f 19                	jg     8016df <vprintfmt+0x26b>
+  8016c6:	48 ba 80 01 00 00 00 	movabs $0x180,%rdx
+  8016cd:	00 00 00 
+  8016d0:	48 63 c3             	movslq %ebx,%rax
+  8016d3:	4c 01 e2             	add    %r12,%rdx
+  8016d6:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  8016da:	4d 85 ed             	test   %r13,%r13
+  8016dd:	75 36                	jne    801715 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  8016df:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8016e3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8016e7:	89 d9                	mov    %ebx,%ecx
+  8016e9:	48 ba 08 dc ff ff ff 	movabs $0xffffffffffffdc08,%rdx
+  8016f0:	ff ff ff 
+  8016f3:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8016f7:	48 89 c7             	mov    %rax,%rdi
+  8016fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ff:	49 b8 3b 7a ff ff ff 	movabs $0xffffffffffff7a3b,%r8
+  801706:	ff ff ff 
+  801709:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  80170d:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  801710:	e9 53 03 00 00       	jmp    801a68 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  801715:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801719:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80171d:	4c 89 e9             	mov    %r13,%rcx
+  801720:	48 ba 11 dc ff ff ff 	movabs $0xffffffffffffdc11,%rdx
+  801727:	ff ff ff 
+  80172a:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  80172e:	48 89 c7             	mov    %rax,%rdi
+  801731:	b8 00 00 00 00       	mov    $0x0,%eax
+  801736:	49 b8 3b 7a ff ff ff 	movabs $0xffffffffffff7a3b,%r8
+  80173d:	ff ff ff 
+  801740:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801744:	41 ff d0             	call   *%r8
+			break;
+  801747:	e9 1c 03 00 00       	jmp    801a68 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  80174c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80174f:	83 f8 2f             	cmp    $0x2f,%eax
+  801752:	77 17                	ja     80176b <vprintfmt+0x2f7>
+  801754:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801758:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80175b:	89 d2                	mov    %edx,%edx
+  80175d:	48 01 d0             	add    %rdx,%rax
+  801760:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801763:	83 c2 08             	add    $0x8,%edx
+  801766:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801769:	eb 0c                	jmp    801777 <vprintfmt+0x303>
+  80176b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80176f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801773:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801777:	4c 8b 28             	mov    (%rax),%r13
+  80177a:	4d 85 ed             	test   %r13,%r13
+  80177d:	75 0e                	jne    80178d <vprintfmt+0x319>
+				p = "(null)";
+  80177f:	48 b8 14 dc ff ff ff 	movabs $0xffffffffffffdc14,%rax
+  801786:	ff ff ff 
+  801789:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  80178d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801791:	0f 8e 84 00 00 00    	jle    80181b <vprintfmt+0x3a7>
+  801797:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  80179b:	74 7e                	je     80181b <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80179d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8017a0:	48 98                	cltq
+  8017a2:	48 89 c6             	mov    %rax,%rsi
+  8017a5:	4c 89 ef             	mov    %r13,%rdi
+  8017a8:	4d 89 e7             	mov    %r12,%r15
+  8017ab:	48 b8 60 7d ff ff ff 	movabs $0xffffffffffff7d60,%rax
+  8017b2:	ff ff ff 
+  8017b5:	4c 01 e0             	add    %r12,%rax
+  8017b8:	ff d0                	call   *%rax
+  8017ba:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  8017bd:	eb 17                	jmp    8017d6 <vprintfmt+0x362>
+					putch(padc, putdat);
+  8017bf:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  8017c3:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8017c7:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8017cb:	48 89 d6             	mov    %rdx,%rsi
+  8017ce:	89 c7                	mov    %eax,%edi
+  8017d0:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8017d2:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8017d6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8017da:	7f e3                	jg     8017bf <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8017dc:	eb 3d                	jmp    80181b <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8017de:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8017e2:	74 1e                	je     801802 <vprintfmt+0x38e>
+  8017e4:	83 fb 1f             	cmp    $0x1f,%ebx
+  8017e7:	7e 05                	jle    8017ee <vprintfmt+0x37a>
+  8017e9:	83 fb 7e             	cmp    $0x7e,%ebx
+  8017ec:	7e 14                	jle    801802 <vprintfmt+0x38e>
+					putch('?', putdat);
+  8017ee:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8017f2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8017f6:	48 89 c6             	mov    %rax,%rsi
+  8017f9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8017fe:	ff d2                	call   *%rdx
+  801800:	eb 15                	jmp    801817 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  801802:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801805:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  801808:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80180c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801810:	48 89 c6             	mov    %rax,%rsi
+  801813:	89 cf                	mov    %ecx,%edi
+  801815:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801817:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80181b:	4c 89 e8             	mov    %r13,%rax
+  80181e:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801822:	0f b6 00             	movzbl (%rax),%eax
+  801825:	0f be d8             	movsbl %al,%ebx
+  801828:	85 db                	test   %ebx,%ebx
+  80182a:	74 28                	je     801854 <vprintfmt+0x3e0>
+  80182c:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801830:	78 ac                	js     8017de <vprintfmt+0x36a>
+  801832:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801836:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80183a:	79 a2                	jns    8017de <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  80183c:	eb 16                	jmp    801854 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  80183e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801842:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801846:	48 89 c6             	mov    %rax,%rsi
+  801849:	bf 20 00 00 00       	mov    $0x20,%edi
+  80184e:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801850:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801854:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801858:	7f e4                	jg     80183e <vprintfmt+0x3ca>
+			break;
+  80185a:	e9 09 02 00 00       	jmp    801a68 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80185f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801863:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801867:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80186b:	0f b6 00             	movzbl (%rax),%eax
+  80186e:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801871:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801872:	83 fb 2f             	cmp    $0x2f,%ebx
+  801875:	0f 8e ac fd ff ff    	jle    801627 <vprintfmt+0x1b3>
+  80187b:	e9 97 fd ff ff       	jmp    801617 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801880:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801884:	be 03 00 00 00       	mov    $0x3,%esi
+  801889:	48 89 c7             	mov    %rax,%rdi
+  80188c:	48 b8 19 73 ff ff ff 	movabs $0xffffffffffff7319,%rax
+  801893:	ff ff ff 
+  801896:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80189a:	ff d0                	call   *%rax
+  80189c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8018a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a4:	48 85 c0             	test   %rax,%rax
+  8018a7:	79 1d                	jns    8018c6 <vprintfmt+0x452>
+				putch('-', putdat);
+  8018a9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8018ad:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8018b1:	48 89 c6             	mov    %rax,%rsi
+  8018b4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8018b9:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8018bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018bf:	48 f7 d8             	neg    %rax
+  8018c2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8018c6:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8018cd:	e9 de 00 00 00       	jmp    8019b0 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8018d2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8018d6:	be 03 00 00 00       	mov    $0x3,%esi
+  8018db:	48 89 c7             	mov    %rax,%rdi
+  8018de:	48 b8 b8 71 ff ff ff 	movabs $0xffffffffffff71b8,%rax
+  8018e5:	ff ff ff 
+  8018e8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8018ec:	ff d0                	call   *%rax
+  8018ee:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  8018f2:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8018f9:	e9 b2 00 00 00       	jmp    8019b0 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8018fe:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801902:	be 03 00 00 00       	mov    $0x3,%esi
+  801907:	48 89 c7             	mov    %rax,%rdi
+  80190a:	48 b8 b8 71 ff ff ff 	movabs $0xffffffffffff71b8,%rax
+  801911:	ff ff ff 
+  801914:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801918:	ff d0                	call   *%rax
+  80191a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  80191e:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801925:	e9 86 00 00 00       	jmp    8019b0 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80192a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80192e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801932:	48 89 c6             	mov    %rax,%rsi
+  801935:	bf 30 00 00 00       	mov    $0x30,%edi
+  80193a:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80193c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801940:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801944:	48 89 c6             	mov    %rax,%rsi
+  801947:	bf 78 00 00 00       	mov    $0x78,%edi
+  80194c:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80194e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801951:	83 f8 2f             	cmp    $0x2f,%eax
+  801954:	77 17                	ja     80196d <vprintfmt+0x4f9>
+  801956:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80195a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80195d:	89 d2                	mov    %edx,%edx
+  80195f:	48 01 d0             	add    %rdx,%rax
+  801962:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801965:	83 c2 08             	add    $0x8,%edx
+  801968:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80196b:	eb 0c                	jmp    801979 <vprintfmt+0x505>
+  80196d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801971:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801975:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801979:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80197c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801980:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801987:	eb 27                	jmp    8019b0 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801989:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80198d:	be 03 00 00 00       	mov    $0x3,%esi
+  801992:	48 89 c7             	mov    %rax,%rdi
+  801995:	48 b8 b8 71 ff ff ff 	movabs $0xffffffffffff71b8,%rax
+  80199c:	ff ff ff 
+  80199f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8019a3:	ff d0                	call   *%rax
+  8019a5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8019a9:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8019b0:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8019b5:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8019b8:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8019bb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8019bf:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8019c3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8019c7:	45 89 c1             	mov    %r8d,%r9d
+  8019ca:	41 89 f8             	mov    %edi,%r8d
+  8019cd:	48 89 c7             	mov    %rax,%rdi
+  8019d0:	48 b8 e0 70 ff ff ff 	movabs $0xffffffffffff70e0,%rax
+  8019d7:	ff ff ff 
+  8019da:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8019de:	ff d0                	call   *%rax
+			break;
+  8019e0:	e9 83 00 00 00       	jmp    801a68 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8019e5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8019e9:	be 03 00 00 00       	mov    $0x3,%esi
+  8019ee:	48 89 c7             	mov    %rax,%rdi
+  8019f1:	48 b8 b8 71 ff ff ff 	movabs $0xffffffffffff71b8,%rax
+  8019f8:	ff ff ff 
+  8019fb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8019ff:	ff d0                	call   *%rax
+  801a01:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801a05:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801a09:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801a0d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801a11:	48 89 ce             	mov    %rcx,%rsi
+  801a14:	48 89 c7             	mov    %rax,%rdi
+  801a17:	48 b8 d3 72 ff ff ff 	movabs $0xffffffffffff72d3,%rax
+  801a1e:	ff ff ff 
+  801a21:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801a25:	ff d0                	call   *%rax
+	
+			break;
+  801a27:	eb 3f                	jmp    801a68 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801a29:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801a2d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801a31:	48 89 c6             	mov    %rax,%rsi
+  801a34:	89 df                	mov    %ebx,%edi
+  801a36:	ff d2                	call   *%rdx
+			break;
+  801a38:	eb 2e                	jmp    801a68 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801a3a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801a3e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801a42:	48 89 c6             	mov    %rax,%rsi
+  801a45:	bf 25 00 00 00       	mov    $0x25,%edi
+  801a4a:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801a4c:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801a51:	eb 05                	jmp    801a58 <vprintfmt+0x5e4>
+  801a53:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801a58:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801a5c:	48 83 e8 01          	sub    $0x1,%rax
+  801a60:	0f b6 00             	movzbl (%rax),%eax
+  801a63:	3c 25                	cmp    $0x25,%al
+  801a65:	75 ec                	jne    801a53 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801a67:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801a68:	e9 78 fa ff ff       	jmp    8014e5 <vprintfmt+0x71>
+				return;
+  801a6d:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801a6e:	48 83 c4 60          	add    $0x60,%rsp
+  801a72:	5b                   	pop    %rbx
+  801a73:	41 5c                	pop    %r12
+  801a75:	41 5d                	pop    %r13
+  801a77:	41 5f                	pop    %r15
+  801a79:	5d                   	pop    %rbp
+  801a7a:	c3                   	ret
+
+0000000000801a7b <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801a7b:	55                   	push   %rbp
+  801a7c:	48 89 e5             	mov    %rsp,%rbp
+  801a7f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801a86:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801a86 <printfmt+0xb>
+  801a8d:	49 bb ba 85 00 00 00 	movabs $0x85ba,%r11
+  801a94:	00 00 00 
+  801a97:	4d 01 da             	add    %r11,%r10
+  801a9a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801aa1:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801aa8:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801aaf:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801ab6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801abd:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801ac4:	84 c0                	test   %al,%al
+  801ac6:	74 20                	je     801ae8 <printfmt+0x6d>
+  801ac8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801acc:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801ad0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801ad4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801ad8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801adc:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801ae0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801ae4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801ae8:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801aef:	00 00 00 
+  801af2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801af9:	00 00 00 
+  801afc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b00:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801b07:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801b0e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801b15:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801b1c:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801b23:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801b2a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801b31:	48 89 c7             	mov    %rax,%rdi
+  801b34:	48 b8 34 74 ff ff ff 	movabs $0xffffffffffff7434,%rax
+  801b3b:	ff ff ff 
+  801b3e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801b42:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801b44:	90                   	nop
+  801b45:	c9                   	leave
+  801b46:	c3                   	ret
+
+0000000000801b47 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801b47:	55                   	push   %rbp
+  801b48:	48 89 e5             	mov    %rsp,%rbp
+  801b4b:	48 83 ec 10          	sub    $0x10,%rsp
+  801b4f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b4f <sprintputch+0x8>
+  801b56:	49 bb f1 84 00 00 00 	movabs $0x84f1,%r11
+  801b5d:	00 00 00 
+  801b60:	4c 01 d8             	add    %r11,%rax
+  801b63:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801b66:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801b6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b6e:	8b 40 10             	mov    0x10(%rax),%eax
+  801b71:	8d 50 01             	lea    0x1(%rax),%edx
+  801b74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b78:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801b7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b7f:	48 8b 10             	mov    (%rax),%rdx
+  801b82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b86:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801b8a:	48 39 c2             	cmp    %rax,%rdx
+  801b8d:	73 17                	jae    801ba6 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801b8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b93:	48 8b 00             	mov    (%rax),%rax
+  801b96:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b9a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801b9e:	48 89 0a             	mov    %rcx,(%rdx)
+  801ba1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801ba4:	88 10                	mov    %dl,(%rax)
+}
+  801ba6:	90                   	nop
+  801ba7:	c9                   	leave
+  801ba8:	c3                   	ret
+
+0000000000801ba9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801ba9:	55                   	push   %rbp
+  801baa:	48 89 e5             	mov    %rsp,%rbp
+  801bad:	53                   	push   %rbx
+  801bae:	48 83 ec 58          	sub    $0x58,%rsp
+  801bb2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bb2 <vsnprintf+0x9>
+  801bb9:	49 bb 8e 84 00 00 00 	movabs $0x848e,%r11
+  801bc0:	00 00 00 
+  801bc3:	4c 01 d8             	add    %r11,%rax
+  801bc6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801bca:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801bcd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801bd1:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801bd5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801bd9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801bdd:	48 8b 0e             	mov    (%rsi),%rcx
+  801be0:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801be4:	48 89 0a             	mov    %rcx,(%rdx)
+  801be7:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801beb:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801bef:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801bf3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801bf7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801bfb:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801bfe:	48 63 d2             	movslq %edx,%rdx
+  801c01:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801c05:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801c09:	48 01 ca             	add    %rcx,%rdx
+  801c0c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c10:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801c17:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801c1c:	74 06                	je     801c24 <vsnprintf+0x7b>
+  801c1e:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801c22:	7f 07                	jg     801c2b <vsnprintf+0x82>
+		return -E_INVAL;
+  801c24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c29:	eb 34                	jmp    801c5f <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801c2b:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801c2f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801c33:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801c37:	48 bf 07 7b ff ff ff 	movabs $0xffffffffffff7b07,%rdi
+  801c3e:	ff ff ff 
+  801c41:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801c45:	49 b8 34 74 ff ff ff 	movabs $0xffffffffffff7434,%r8
+  801c4c:	ff ff ff 
+  801c4f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801c53:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801c55:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801c59:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801c5c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801c5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c63:	c9                   	leave
+  801c64:	c3                   	ret
+
+0000000000801c65 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801c65:	55                   	push   %rbp
+  801c66:	48 89 e5             	mov    %rsp,%rbp
+  801c69:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801c70:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801c70 <snprintf+0xb>
+  801c77:	49 bb d0 83 00 00 00 	movabs $0x83d0,%r11
+  801c7e:	00 00 00 
+  801c81:	4d 01 da             	add    %r11,%r10
+  801c84:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801c8b:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801c91:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801c98:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801c9f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801ca6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801cad:	84 c0                	test   %al,%al
+  801caf:	74 20                	je     801cd1 <snprintf+0x6c>
+  801cb1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801cb5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801cb9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801cbd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801cc1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801cc5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801cc9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801ccd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801cd1:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801cd8:	00 00 00 
+  801cdb:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801ce2:	00 00 00 
+  801ce5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801ce9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801cf0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801cf7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801cfe:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801d05:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801d0c:	48 8b 06             	mov    (%rsi),%rax
+  801d0f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801d13:	48 89 01             	mov    %rax,(%rcx)
+  801d16:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801d1a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801d1e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801d22:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801d29:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801d30:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801d36:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801d3d:	48 89 c7             	mov    %rax,%rdi
+  801d40:	48 b8 69 7b ff ff ff 	movabs $0xffffffffffff7b69,%rax
+  801d47:	ff ff ff 
+  801d4a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801d4e:	ff d0                	call   *%rax
+  801d50:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801d56:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801d5c:	c9                   	leave
+  801d5d:	c3                   	ret
+
+0000000000801d5e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801d5e:	55                   	push   %rbp
+  801d5f:	48 89 e5             	mov    %rsp,%rbp
+  801d62:	48 83 ec 18          	sub    $0x18,%rsp
+  801d66:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d66 <strlen+0x8>
+  801d6d:	49 bb da 82 00 00 00 	movabs $0x82da,%r11
+  801d74:	00 00 00 
+  801d77:	4c 01 d8             	add    %r11,%rax
+  801d7a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801d7e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801d85:	eb 09                	jmp    801d90 <strlen+0x32>
+		n++;
+  801d87:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801d8b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801d90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d94:	0f b6 00             	movzbl (%rax),%eax
+  801d97:	84 c0                	test   %al,%al
+  801d99:	75 ec                	jne    801d87 <strlen+0x29>
+	return n;
+  801d9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801d9e:	c9                   	leave
+  801d9f:	c3                   	ret
+
+0000000000801da0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801da0:	55                   	push   %rbp
+  801da1:	48 89 e5             	mov    %rsp,%rbp
+  801da4:	48 83 ec 20          	sub    $0x20,%rsp
+  801da8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801da8 <strnlen+0x8>
+  801daf:	49 bb 98 82 00 00 00 	movabs $0x8298,%r11
+  801db6:	00 00 00 
+  801db9:	4c 01 d8             	add    %r11,%rax
+  801dbc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801dc0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dc4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801dcb:	eb 0e                	jmp    801ddb <strnlen+0x3b>
+		n++;
+  801dcd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801dd1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801dd6:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801ddb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801de0:	74 0b                	je     801ded <strnlen+0x4d>
+  801de2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801de6:	0f b6 00             	movzbl (%rax),%eax
+  801de9:	84 c0                	test   %al,%al
+  801deb:	75 e0                	jne    801dcd <strnlen+0x2d>
+	return n;
+  801ded:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801df0:	c9                   	leave
+  801df1:	c3                   	ret
+
+0000000000801df2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801df2:	55                   	push   %rbp
+  801df3:	48 89 e5             	mov    %rsp,%rbp
+  801df6:	48 83 ec 20          	sub    $0x20,%rsp
+  801dfa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dfa <strcpy+0x8>
+  801e01:	49 bb 46 82 00 00 00 	movabs $0x8246,%r11
+  801e08:	00 00 00 
+  801e0b:	4c 01 d8             	add    %r11,%rax
+  801e0e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801e12:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801e16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e1a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801e1e:	90                   	nop
+  801e1f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801e23:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801e27:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801e2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e2f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801e33:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801e37:	0f b6 12             	movzbl (%rdx),%edx
+  801e3a:	88 10                	mov    %dl,(%rax)
+  801e3c:	0f b6 00             	movzbl (%rax),%eax
+  801e3f:	84 c0                	test   %al,%al
+  801e41:	75 dc                	jne    801e1f <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801e43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801e47:	c9                   	leave
+  801e48:	c3                   	ret
+
+0000000000801e49 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801e49:	55                   	push   %rbp
+  801e4a:	48 89 e5             	mov    %rsp,%rbp
+  801e4d:	53                   	push   %rbx
+  801e4e:	48 83 ec 20          	sub    $0x20,%rsp
+  801e52:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801e52 <strcat+0x9>
+  801e59:	49 bb ee 81 00 00 00 	movabs $0x81ee,%r11
+  801e60:	00 00 00 
+  801e63:	4c 01 db             	add    %r11,%rbx
+  801e66:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801e6a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801e6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e72:	48 89 c7             	mov    %rax,%rdi
+  801e75:	48 b8 1e 7d ff ff ff 	movabs $0xffffffffffff7d1e,%rax
+  801e7c:	ff ff ff 
+  801e7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e83:	ff d0                	call   *%rax
+  801e85:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801e88:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e8b:	48 63 d0             	movslq %eax,%rdx
+  801e8e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e92:	48 01 c2             	add    %rax,%rdx
+  801e95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e99:	48 89 c6             	mov    %rax,%rsi
+  801e9c:	48 89 d7             	mov    %rdx,%rdi
+  801e9f:	48 b8 b2 7d ff ff ff 	movabs $0xffffffffffff7db2,%rax
+  801ea6:	ff ff ff 
+  801ea9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ead:	ff d0                	call   *%rax
+	return dst;
+  801eaf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801eb3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eb7:	c9                   	leave
+  801eb8:	c3                   	ret
+
+0000000000801eb9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801eb9:	55                   	push   %rbp
+  801eba:	48 89 e5             	mov    %rsp,%rbp
+  801ebd:	48 83 ec 28          	sub    $0x28,%rsp
+  801ec1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ec1 <strncpy+0x8>
+  801ec8:	49 bb 7f 81 00 00 00 	movabs $0x817f,%r11
+  801ecf:	00 00 00 
+  801ed2:	4c 01 d8             	add    %r11,%rax
+  801ed5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ed9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801edd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801ee1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ee5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801ee9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801ef0:	00 
+  801ef1:	eb 2a                	jmp    801f1d <strncpy+0x64>
+		*dst++ = *src;
+  801ef3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ef7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801efb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801eff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801f03:	0f b6 12             	movzbl (%rdx),%edx
+  801f06:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801f08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f0c:	0f b6 00             	movzbl (%rax),%eax
+  801f0f:	84 c0                	test   %al,%al
+  801f11:	74 05                	je     801f18 <strncpy+0x5f>
+			src++;
+  801f13:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801f18:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801f1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f21:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801f25:	72 cc                	jb     801ef3 <strncpy+0x3a>
+	}
+	return ret;
+  801f27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801f2b:	c9                   	leave
+  801f2c:	c3                   	ret
+
+0000000000801f2d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801f2d:	55                   	push   %rbp
+  801f2e:	48 89 e5             	mov    %rsp,%rbp
+  801f31:	48 83 ec 28          	sub    $0x28,%rsp
+  801f35:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f35 <strlcpy+0x8>
+  801f3c:	49 bb 0b 81 00 00 00 	movabs $0x810b,%r11
+  801f43:	00 00 00 
+  801f46:	4c 01 d8             	add    %r11,%rax
+  801f49:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f4d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801f51:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801f55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f59:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801f5d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801f62:	74 3d                	je     801fa1 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801f64:	eb 1d                	jmp    801f83 <strlcpy+0x56>
+			*dst++ = *src++;
+  801f66:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801f6a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801f6e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801f72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f76:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801f7a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f7e:	0f b6 12             	movzbl (%rdx),%edx
+  801f81:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801f83:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801f88:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801f8d:	74 0b                	je     801f9a <strlcpy+0x6d>
+  801f8f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f93:	0f b6 00             	movzbl (%rax),%eax
+  801f96:	84 c0                	test   %al,%al
+  801f98:	75 cc                	jne    801f66 <strlcpy+0x39>
+		*dst = '\0';
+  801f9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f9e:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801fa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fa5:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801fa9:	c9                   	leave
+  801faa:	c3                   	ret
+
+0000000000801fab <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801fab:	55                   	push   %rbp
+  801fac:	48 89 e5             	mov    %rsp,%rbp
+  801faf:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fb3 <strcmp+0x8>
+  801fba:	49 bb 8d 80 00 00 00 	movabs $0x808d,%r11
+  801fc1:	00 00 00 
+  801fc4:	4c 01 d8             	add    %r11,%rax
+  801fc7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801fcb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801fcf:	eb 0a                	jmp    801fdb <strcmp+0x30>
+		p++, q++;
+  801fd1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801fd6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801fdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fdf:	0f b6 00             	movzbl (%rax),%eax
+  801fe2:	84 c0                	test   %al,%al
+  801fe4:	74 12                	je     801ff8 <strcmp+0x4d>
+  801fe6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fea:	0f b6 10             	movzbl (%rax),%edx
+  801fed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ff1:	0f b6 00             	movzbl (%rax),%eax
+  801ff4:	38 c2                	cmp    %al,%dl
+  801ff6:	74 d9                	je     801fd1 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801ff8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ffc:	0f b6 00             	movzbl (%rax),%eax
+  801fff:	0f b6 d0             	movzbl %al,%edx
+  802002:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802006:	0f b6 00             	movzbl (%rax),%eax
+  802009:	0f b6 c0             	movzbl %al,%eax
+  80200c:	29 c2                	sub    %eax,%edx
+  80200e:	89 d0                	mov    %edx,%eax
+}
+  802010:	c9                   	leave
+  802011:	c3                   	ret
+
+0000000000802012 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802012:	55                   	push   %rbp
+  802013:	48 89 e5             	mov    %rsp,%rbp
+  802016:	48 83 ec 18          	sub    $0x18,%rsp
+  80201a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80201a <strncmp+0x8>
+  802021:	49 bb 26 80 00 00 00 	movabs $0x8026,%r11
+  802028:	00 00 00 
+  80202b:	4c 01 d8             	add    %r11,%rax
+  80202e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802032:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802036:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80203a:	eb 0f                	jmp    80204b <strncmp+0x39>
+		n--, p++, q++;
+  80203c:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  802041:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802046:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80204b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802050:	74 1d                	je     80206f <strncmp+0x5d>
+  802052:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802056:	0f b6 00             	movzbl (%rax),%eax
+  802059:	84 c0                	test   %al,%al
+  80205b:	74 12                	je     80206f <strncmp+0x5d>
+  80205d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802061:	0f b6 10             	movzbl (%rax),%edx
+  802064:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802068:	0f b6 00             	movzbl (%rax),%eax
+  80206b:	38 c2                	cmp    %al,%dl
+  80206d:	74 cd                	je     80203c <strncmp+0x2a>
+	if (n == 0)
+  80206f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802074:	75 07                	jne    80207d <strncmp+0x6b>
+		return 0;
+  802076:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207b:	eb 16                	jmp    802093 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80207d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802081:	0f b6 00             	movzbl (%rax),%eax
+  802084:	0f b6 d0             	movzbl %al,%edx
+  802087:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80208b:	0f b6 00             	movzbl (%rax),%eax
+  80208e:	0f b6 c0             	movzbl %al,%eax
+  802091:	29 c2                	sub    %eax,%edx
+}
+  802093:	89 d0                	mov    %edx,%eax
+  802095:	c9                   	leave
+  802096:	c3                   	ret
+
+0000000000802097 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802097:	55                   	push   %rbp
+  802098:	48 89 e5             	mov    %rsp,%rbp
+  80209b:	48 83 ec 10          	sub    $0x10,%rsp
+  80209f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80209f <strchr+0x8>
+  8020a6:	49 bb a1 7f 00 00 00 	movabs $0x7fa1,%r11
+  8020ad:	00 00 00 
+  8020b0:	4c 01 d8             	add    %r11,%rax
+  8020b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8020b7:	89 f0                	mov    %esi,%eax
+  8020b9:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8020bc:	eb 17                	jmp    8020d5 <strchr+0x3e>
+		if (*s == c)
+  8020be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020c2:	0f b6 00             	movzbl (%rax),%eax
+  8020c5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8020c8:	75 06                	jne    8020d0 <strchr+0x39>
+			return (char *) s;
+  8020ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020ce:	eb 15                	jmp    8020e5 <strchr+0x4e>
+	for (; *s; s++)
+  8020d0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8020d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020d9:	0f b6 00             	movzbl (%rax),%eax
+  8020dc:	84 c0                	test   %al,%al
+  8020de:	75 de                	jne    8020be <strchr+0x27>
+	return 0;
+  8020e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020e5:	c9                   	leave
+  8020e6:	c3                   	ret
+
+00000000008020e7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8020e7:	55                   	push   %rbp
+  8020e8:	48 89 e5             	mov    %rsp,%rbp
+  8020eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020ef <strfind+0x8>
+  8020f6:	49 bb 51 7f 00 00 00 	movabs $0x7f51,%r11
+  8020fd:	00 00 00 
+  802100:	4c 01 d8             	add    %r11,%rax
+  802103:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802107:	89 f0                	mov    %esi,%eax
+  802109:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80210c:	eb 11                	jmp    80211f <strfind+0x38>
+		if (*s == c)
+  80210e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802112:	0f b6 00             	movzbl (%rax),%eax
+  802115:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  802118:	74 12                	je     80212c <strfind+0x45>
+	for (; *s; s++)
+  80211a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80211f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802123:	0f b6 00             	movzbl (%rax),%eax
+  802126:	84 c0                	test   %al,%al
+  802128:	75 e4                	jne    80210e <strfind+0x27>
+  80212a:	eb 01                	jmp    80212d <strfind+0x46>
+			break;
+  80212c:	90                   	nop
+	return (char *) s;
+  80212d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802131:	c9                   	leave
+  802132:	c3                   	ret
+
+0000000000802133 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802133:	55                   	push   %rbp
+  802134:	48 89 e5             	mov    %rsp,%rbp
+  802137:	48 83 ec 18          	sub    $0x18,%rsp
+  80213b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80213b <memset+0x8>
+  802142:	49 bb 05 7f 00 00 00 	movabs $0x7f05,%r11
+  802149:	00 00 00 
+  80214c:	4c 01 d8             	add    %r11,%rax
+  80214f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802153:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802156:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80215a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80215f:	75 06                	jne    802167 <memset+0x34>
+		return v;
+  802161:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802165:	eb 69                	jmp    8021d0 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  802167:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80216b:	83 e0 03             	and    $0x3,%eax
+  80216e:	48 85 c0             	test   %rax,%rax
+  802171:	75 48                	jne    8021bb <memset+0x88>
+  802173:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802177:	83 e0 03             	and    $0x3,%eax
+  80217a:	48 85 c0             	test   %rax,%rax
+  80217d:	75 3c                	jne    8021bb <memset+0x88>
+		c &= 0xFF;
+  80217f:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  802186:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802189:	c1 e0 18             	shl    $0x18,%eax
+  80218c:	89 c2                	mov    %eax,%edx
+  80218e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802191:	c1 e0 10             	shl    $0x10,%eax
+  802194:	09 c2                	or     %eax,%edx
+  802196:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802199:	c1 e0 08             	shl    $0x8,%eax
+  80219c:	09 d0                	or     %edx,%eax
+  80219e:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8021a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a5:	48 c1 e8 02          	shr    $0x2,%rax
+  8021a9:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8021ac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8021b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8021b3:	48 89 d7             	mov    %rdx,%rdi
+  8021b6:	fc                   	cld
+  8021b7:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8021b9:	eb 11                	jmp    8021cc <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8021bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8021bf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8021c2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8021c6:	48 89 d7             	mov    %rdx,%rdi
+  8021c9:	fc                   	cld
+  8021ca:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8021cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8021d0:	c9                   	leave
+  8021d1:	c3                   	ret
+
+00000000008021d2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8021d2:	55                   	push   %rbp
+  8021d3:	48 89 e5             	mov    %rsp,%rbp
+  8021d6:	48 83 ec 28          	sub    $0x28,%rsp
+  8021da:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021da <memmove+0x8>
+  8021e1:	49 bb 66 7e 00 00 00 	movabs $0x7e66,%r11
+  8021e8:	00 00 00 
+  8021eb:	4c 01 d8             	add    %r11,%rax
+  8021ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8021f2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8021f6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8021fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  802202:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802206:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80220a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80220e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802212:	0f 83 88 00 00 00    	jae    8022a0 <memmove+0xce>
+  802218:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80221c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802220:	48 01 d0             	add    %rdx,%rax
+  802223:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802227:	73 77                	jae    8022a0 <memmove+0xce>
+		s += n;
+  802229:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80222d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  802231:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802235:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  802239:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80223d:	83 e0 03             	and    $0x3,%eax
+  802240:	48 85 c0             	test   %rax,%rax
+  802243:	75 3b                	jne    802280 <memmove+0xae>
+  802245:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802249:	83 e0 03             	and    $0x3,%eax
+  80224c:	48 85 c0             	test   %rax,%rax
+  80224f:	75 2f                	jne    802280 <memmove+0xae>
+  802251:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802255:	83 e0 03             	and    $0x3,%eax
+  802258:	48 85 c0             	test   %rax,%rax
+  80225b:	75 23                	jne    802280 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80225d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802261:	48 83 e8 04          	sub    $0x4,%rax
+  802265:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802269:	48 83 ea 04          	sub    $0x4,%rdx
+  80226d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802271:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  802275:	48 89 c7             	mov    %rax,%rdi
+  802278:	48 89 d6             	mov    %rdx,%rsi
+  80227b:	fd                   	std
+  80227c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80227e:	eb 1d                	jmp    80229d <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802280:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802284:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802288:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80228c:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  802290:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802294:	48 89 d7             	mov    %rdx,%rdi
+  802297:	48 89 c1             	mov    %rax,%rcx
+  80229a:	fd                   	std
+  80229b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80229d:	fc                   	cld
+  80229e:	eb 57                	jmp    8022f7 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8022a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022a4:	83 e0 03             	and    $0x3,%eax
+  8022a7:	48 85 c0             	test   %rax,%rax
+  8022aa:	75 36                	jne    8022e2 <memmove+0x110>
+  8022ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022b0:	83 e0 03             	and    $0x3,%eax
+  8022b3:	48 85 c0             	test   %rax,%rax
+  8022b6:	75 2a                	jne    8022e2 <memmove+0x110>
+  8022b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022bc:	83 e0 03             	and    $0x3,%eax
+  8022bf:	48 85 c0             	test   %rax,%rax
+  8022c2:	75 1e                	jne    8022e2 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8022c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022c8:	48 c1 e8 02          	shr    $0x2,%rax
+  8022cc:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8022cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8022d7:	48 89 c7             	mov    %rax,%rdi
+  8022da:	48 89 d6             	mov    %rdx,%rsi
+  8022dd:	fc                   	cld
+  8022de:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8022e0:	eb 15                	jmp    8022f7 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8022e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8022ea:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8022ee:	48 89 c7             	mov    %rax,%rdi
+  8022f1:	48 89 d6             	mov    %rdx,%rsi
+  8022f4:	fc                   	cld
+  8022f5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8022f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8022fb:	c9                   	leave
+  8022fc:	c3                   	ret
+
+00000000008022fd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8022fd:	55                   	push   %rbp
+  8022fe:	48 89 e5             	mov    %rsp,%rbp
+  802301:	48 83 ec 18          	sub    $0x18,%rsp
+  802305:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802305 <memcpy+0x8>
+  80230c:	49 bb 3b 7d 00 00 00 	movabs $0x7d3b,%r11
+  802313:	00 00 00 
+  802316:	4c 01 d8             	add    %r11,%rax
+  802319:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80231d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802321:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  802325:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802329:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80232d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802331:	48 89 cf             	mov    %rcx,%rdi
+  802334:	48 b9 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rcx
+  80233b:	ff ff ff 
+  80233e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802342:	ff d0                	call   *%rax
+}
+  802344:	c9                   	leave
+  802345:	c3                   	ret
+
+0000000000802346 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802346:	55                   	push   %rbp
+  802347:	48 89 e5             	mov    %rsp,%rbp
+  80234a:	48 83 ec 28          	sub    $0x28,%rsp
+  80234e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80234e <memcmp+0x8>
+  802355:	49 bb f2 7c 00 00 00 	movabs $0x7cf2,%r11
+  80235c:	00 00 00 
+  80235f:	4c 01 d8             	add    %r11,%rax
+  802362:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802366:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80236a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80236e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802372:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  802376:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80237a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80237e:	eb 34                	jmp    8023b4 <memcmp+0x6e>
+		if (*s1 != *s2)
+  802380:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802384:	0f b6 10             	movzbl (%rax),%edx
+  802387:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80238b:	0f b6 00             	movzbl (%rax),%eax
+  80238e:	38 c2                	cmp    %al,%dl
+  802390:	74 18                	je     8023aa <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  802392:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802396:	0f b6 00             	movzbl (%rax),%eax
+  802399:	0f b6 d0             	movzbl %al,%edx
+  80239c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023a0:	0f b6 00             	movzbl (%rax),%eax
+  8023a3:	0f b6 c0             	movzbl %al,%eax
+  8023a6:	29 c2                	sub    %eax,%edx
+  8023a8:	eb 20                	jmp    8023ca <memcmp+0x84>
+		s1++, s2++;
+  8023aa:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8023af:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8023b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023b8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8023bc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8023c0:	48 85 c0             	test   %rax,%rax
+  8023c3:	75 bb                	jne    802380 <memcmp+0x3a>
+	}
+
+	return 0;
+  8023c5:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8023ca:	89 d0                	mov    %edx,%eax
+  8023cc:	c9                   	leave
+  8023cd:	c3                   	ret
+
+00000000008023ce <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8023ce:	55                   	push   %rbp
+  8023cf:	48 89 e5             	mov    %rsp,%rbp
+  8023d2:	48 83 ec 28          	sub    $0x28,%rsp
+  8023d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023d6 <memfind+0x8>
+  8023dd:	49 bb 6a 7c 00 00 00 	movabs $0x7c6a,%r11
+  8023e4:	00 00 00 
+  8023e7:	4c 01 d8             	add    %r11,%rax
+  8023ea:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8023ee:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8023f1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8023f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8023f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023fd:	48 01 d0             	add    %rdx,%rax
+  802400:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  802404:	eb 13                	jmp    802419 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  802406:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80240a:	0f b6 00             	movzbl (%rax),%eax
+  80240d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802410:	38 d0                	cmp    %dl,%al
+  802412:	74 11                	je     802425 <memfind+0x57>
+	for (; s < ends; s++)
+  802414:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  802419:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80241d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802421:	72 e3                	jb     802406 <memfind+0x38>
+  802423:	eb 01                	jmp    802426 <memfind+0x58>
+			break;
+  802425:	90                   	nop
+	return (void *) s;
+  802426:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80242a:	c9                   	leave
+  80242b:	c3                   	ret
+
+000000000080242c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80242c:	55                   	push   %rbp
+  80242d:	48 89 e5             	mov    %rsp,%rbp
+  802430:	48 83 ec 38          	sub    $0x38,%rsp
+  802434:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802434 <strtol+0x8>
+  80243b:	49 bb 0c 7c 00 00 00 	movabs $0x7c0c,%r11
+  802442:	00 00 00 
+  802445:	4c 01 d8             	add    %r11,%rax
+  802448:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80244c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802450:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  802453:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80245a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802461:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802462:	eb 05                	jmp    802469 <strtol+0x3d>
+		s++;
+  802464:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  802469:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80246d:	0f b6 00             	movzbl (%rax),%eax
+  802470:	3c 20                	cmp    $0x20,%al
+  802472:	74 f0                	je     802464 <strtol+0x38>
+  802474:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802478:	0f b6 00             	movzbl (%rax),%eax
+  80247b:	3c 09                	cmp    $0x9,%al
+  80247d:	74 e5                	je     802464 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  80247f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802483:	0f b6 00             	movzbl (%rax),%eax
+  802486:	3c 2b                	cmp    $0x2b,%al
+  802488:	75 07                	jne    802491 <strtol+0x65>
+		s++;
+  80248a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80248f:	eb 17                	jmp    8024a8 <strtol+0x7c>
+	else if (*s == '-')
+  802491:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802495:	0f b6 00             	movzbl (%rax),%eax
+  802498:	3c 2d                	cmp    $0x2d,%al
+  80249a:	75 0c                	jne    8024a8 <strtol+0x7c>
+		s++, neg = 1;
+  80249c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8024a1:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8024a8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8024ac:	74 06                	je     8024b4 <strtol+0x88>
+  8024ae:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8024b2:	75 28                	jne    8024dc <strtol+0xb0>
+  8024b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024b8:	0f b6 00             	movzbl (%rax),%eax
+  8024bb:	3c 30                	cmp    $0x30,%al
+  8024bd:	75 1d                	jne    8024dc <strtol+0xb0>
+  8024bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024c3:	48 83 c0 01          	add    $0x1,%rax
+  8024c7:	0f b6 00             	movzbl (%rax),%eax
+  8024ca:	3c 78                	cmp    $0x78,%al
+  8024cc:	75 0e                	jne    8024dc <strtol+0xb0>
+		s += 2, base = 16;
+  8024ce:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8024d3:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8024da:	eb 2c                	jmp    802508 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  8024dc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8024e0:	75 19                	jne    8024fb <strtol+0xcf>
+  8024e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024e6:	0f b6 00             	movzbl (%rax),%eax
+  8024e9:	3c 30                	cmp    $0x30,%al
+  8024eb:	75 0e                	jne    8024fb <strtol+0xcf>
+		s++, base = 8;
+  8024ed:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8024f2:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8024f9:	eb 0d                	jmp    802508 <strtol+0xdc>
+	else if (base == 0)
+  8024fb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8024ff:	75 07                	jne    802508 <strtol+0xdc>
+		base = 10;
+  802501:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  802508:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80250c:	0f b6 00             	movzbl (%rax),%eax
+  80250f:	3c 2f                	cmp    $0x2f,%al
+  802511:	7e 1d                	jle    802530 <strtol+0x104>
+  802513:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802517:	0f b6 00             	movzbl (%rax),%eax
+  80251a:	3c 39                	cmp    $0x39,%al
+  80251c:	7f 12                	jg     802530 <strtol+0x104>
+			dig = *s - '0';
+  80251e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802522:	0f b6 00             	movzbl (%rax),%eax
+  802525:	0f be c0             	movsbl %al,%eax
+  802528:	83 e8 30             	sub    $0x30,%eax
+  80252b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80252e:	eb 4e                	jmp    80257e <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  802530:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802534:	0f b6 00             	movzbl (%rax),%eax
+  802537:	3c 60                	cmp    $0x60,%al
+  802539:	7e 1d                	jle    802558 <strtol+0x12c>
+  80253b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80253f:	0f b6 00             	movzbl (%rax),%eax
+  802542:	3c 7a                	cmp    $0x7a,%al
+  802544:	7f 12                	jg     802558 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  802546:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80254a:	0f b6 00             	movzbl (%rax),%eax
+  80254d:	0f be c0             	movsbl %al,%eax
+  802550:	83 e8 57             	sub    $0x57,%eax
+  802553:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802556:	eb 26                	jmp    80257e <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  802558:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80255c:	0f b6 00             	movzbl (%rax),%eax
+  80255f:	3c 40                	cmp    $0x40,%al
+  802561:	7e 47                	jle    8025aa <strtol+0x17e>
+  802563:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802567:	0f b6 00             	movzbl (%rax),%eax
+  80256a:	3c 5a                	cmp    $0x5a,%al
+  80256c:	7f 3c                	jg     8025aa <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  80256e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802572:	0f b6 00             	movzbl (%rax),%eax
+  802575:	0f be c0             	movsbl %al,%eax
+  802578:	83 e8 37             	sub    $0x37,%eax
+  80257b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80257e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802581:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802584:	7d 23                	jge    8025a9 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  802586:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80258b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80258e:	48 98                	cltq
+  802590:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802595:	48 89 c2             	mov    %rax,%rdx
+  802598:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80259b:	48 98                	cltq
+  80259d:	48 01 d0             	add    %rdx,%rax
+  8025a0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  8025a4:	e9 5f ff ff ff       	jmp    802508 <strtol+0xdc>
+			break;
+  8025a9:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8025aa:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8025af:	74 0b                	je     8025bc <strtol+0x190>
+		*endptr = (char *) s;
+  8025b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025b5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8025b9:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8025bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8025c0:	74 09                	je     8025cb <strtol+0x19f>
+  8025c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025c6:	48 f7 d8             	neg    %rax
+  8025c9:	eb 04                	jmp    8025cf <strtol+0x1a3>
+  8025cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8025cf:	c9                   	leave
+  8025d0:	c3                   	ret
+
+00000000008025d1 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  8025d1:	55                   	push   %rbp
+  8025d2:	48 89 e5             	mov    %rsp,%rbp
+  8025d5:	53                   	push   %rbx
+  8025d6:	48 83 ec 30          	sub    $0x30,%rsp
+  8025da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8025da <strstr+0x9>
+  8025e1:	49 bb 66 7a 00 00 00 	movabs $0x7a66,%r11
+  8025e8:	00 00 00 
+  8025eb:	4c 01 db             	add    %r11,%rbx
+  8025ee:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  8025f2:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  8025f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025fa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8025fe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802602:	0f b6 00             	movzbl (%rax),%eax
+  802605:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  802608:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  80260c:	75 06                	jne    802614 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  80260e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802612:	eb 73                	jmp    802687 <strstr+0xb6>
+
+	len = strlen(str);
+  802614:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802618:	48 89 c7             	mov    %rax,%rdi
+  80261b:	48 b8 1e 7d ff ff ff 	movabs $0xffffffffffff7d1e,%rax
+  802622:	ff ff ff 
+  802625:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802629:	ff d0                	call   *%rax
+  80262b:	48 98                	cltq
+  80262d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  802631:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802635:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802639:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80263d:	0f b6 00             	movzbl (%rax),%eax
+  802640:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  802643:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  802647:	75 07                	jne    802650 <strstr+0x7f>
+				return (char *) 0;
+  802649:	b8 00 00 00 00       	mov    $0x0,%eax
+  80264e:	eb 37                	jmp    802687 <strstr+0xb6>
+		} while (sc != c);
+  802650:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  802654:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  802657:	75 d8                	jne    802631 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  802659:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80265d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802661:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802665:	48 89 ce             	mov    %rcx,%rsi
+  802668:	48 89 c7             	mov    %rax,%rdi
+  80266b:	48 b8 d2 7f ff ff ff 	movabs $0xffffffffffff7fd2,%rax
+  802672:	ff ff ff 
+  802675:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802679:	ff d0                	call   *%rax
+  80267b:	85 c0                	test   %eax,%eax
+  80267d:	75 b2                	jne    802631 <strstr+0x60>
+
+	return (char *) (in - 1);
+  80267f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802683:	48 83 e8 01          	sub    $0x1,%rax
+}
+  802687:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80268b:	c9                   	leave
+  80268c:	c3                   	ret
+
+000000000080268d <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  80268d:	55                   	push   %rbp
+  80268e:	48 89 e5             	mov    %rsp,%rbp
+  802691:	41 57                	push   %r15
+  802693:	53                   	push   %rbx
+  802694:	48 83 ec 40          	sub    $0x40,%rsp
+  802698:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 802698 <syscall+0xb>
+  80269f:	49 bb a8 79 00 00 00 	movabs $0x79a8,%r11
+  8026a6:	00 00 00 
+  8026a9:	4d 01 da             	add    %r11,%r10
+  8026ac:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8026af:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8026b2:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8026b6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8026ba:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8026be:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  8026c2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026c5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8026c9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8026cd:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8026d1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8026d5:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8026d9:	4c 89 c3             	mov    %r8,%rbx
+  8026dc:	cd 30                	int    $0x30
+  8026de:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  8026e2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8026e6:	74 52                	je     80273a <syscall+0xad>
+  8026e8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8026ed:	7e 4b                	jle    80273a <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8026ef:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8026f3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026f6:	49 89 d0             	mov    %rdx,%r8
+  8026f9:	89 c1                	mov    %eax,%ecx
+  8026fb:	48 b8 d0 de ff ff ff 	movabs $0xffffffffffffded0,%rax
+  802702:	ff ff ff 
+  802705:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  802709:	48 89 c2             	mov    %rax,%rdx
+  80270c:	be 23 00 00 00       	mov    $0x23,%esi
+  802711:	48 b8 ed de ff ff ff 	movabs $0xffffffffffffdeed,%rax
+  802718:	ff ff ff 
+  80271b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80271f:	48 89 c7             	mov    %rax,%rdi
+  802722:	4d 89 d7             	mov    %r10,%r15
+  802725:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272a:	49 b9 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%r9
+  802731:	ff ff ff 
+  802734:	4d 01 d1             	add    %r10,%r9
+  802737:	41 ff d1             	call   *%r9
+
+	return ret;
+  80273a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80273e:	48 83 c4 40          	add    $0x40,%rsp
+  802742:	5b                   	pop    %rbx
+  802743:	41 5f                	pop    %r15
+  802745:	5d                   	pop    %rbp
+  802746:	c3                   	ret
+
+0000000000802747 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  802747:	55                   	push   %rbp
+  802748:	48 89 e5             	mov    %rsp,%rbp
+  80274b:	41 57                	push   %r15
+  80274d:	41 56                	push   %r14
+  80274f:	41 55                	push   %r13
+  802751:	41 54                	push   %r12
+  802753:	53                   	push   %rbx
+  802754:	48 83 ec 48          	sub    $0x48,%rsp
+  802758:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 802758 <syscall_words+0x11>
+  80275f:	49 bb e8 78 00 00 00 	movabs $0x78e8,%r11
+  802766:	00 00 00 
+  802769:	4d 01 de             	add    %r11,%r14
+  80276c:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80276f:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  802772:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802776:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80277a:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  80277e:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  802782:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802787:	74 09                	je     802792 <syscall_words+0x4b>
+  802789:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80278d:	48 8b 00             	mov    (%rax),%rax
+  802790:	eb 05                	jmp    802797 <syscall_words+0x50>
+  802792:	b8 00 00 00 00       	mov    $0x0,%eax
+  802797:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  80279a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80279f:	74 0a                	je     8027ab <syscall_words+0x64>
+  8027a1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8027a5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8027a9:	eb 05                	jmp    8027b0 <syscall_words+0x69>
+  8027ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b0:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  8027b3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8027b8:	74 0a                	je     8027c4 <syscall_words+0x7d>
+  8027ba:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8027be:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8027c2:	eb 05                	jmp    8027c9 <syscall_words+0x82>
+  8027c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c9:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8027cc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8027d1:	74 0a                	je     8027dd <syscall_words+0x96>
+  8027d3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8027d7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8027db:	eb 05                	jmp    8027e2 <syscall_words+0x9b>
+  8027dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e2:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  8027e5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8027ea:	74 0a                	je     8027f6 <syscall_words+0xaf>
+  8027ec:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8027f0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8027f4:	eb 05                	jmp    8027fb <syscall_words+0xb4>
+  8027f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027fb:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  8027fe:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802803:	74 0a                	je     80280f <syscall_words+0xc8>
+  802805:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802809:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80280d:	eb 05                	jmp    802814 <syscall_words+0xcd>
+  80280f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802814:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  802817:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80281a:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80281e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802822:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802826:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80282a:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80282e:	cd 30                	int    $0x30
+  802830:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802834:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802839:	74 50                	je     80288b <syscall_words+0x144>
+		words[0] = r8;
+  80283b:	4c 89 c2             	mov    %r8,%rdx
+  80283e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802842:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802845:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802849:	48 83 c0 08          	add    $0x8,%rax
+  80284d:	4c 89 ca             	mov    %r9,%rdx
+  802850:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802853:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802857:	48 83 c0 10          	add    $0x10,%rax
+  80285b:	4c 89 d2             	mov    %r10,%rdx
+  80285e:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  802861:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802865:	48 83 c0 18          	add    $0x18,%rax
+  802869:	4c 89 da             	mov    %r11,%rdx
+  80286c:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80286f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802873:	48 83 c0 20          	add    $0x20,%rax
+  802877:	4c 89 e2             	mov    %r12,%rdx
+  80287a:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80287d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802881:	48 83 c0 28          	add    $0x28,%rax
+  802885:	4c 89 ea             	mov    %r13,%rdx
+  802888:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  80288b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80288f:	74 52                	je     8028e3 <syscall_words+0x19c>
+  802891:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802896:	7e 4b                	jle    8028e3 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802898:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80289c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80289f:	49 89 d0             	mov    %rdx,%r8
+  8028a2:	89 c1                	mov    %eax,%ecx
+  8028a4:	48 b8 d0 de ff ff ff 	movabs $0xffffffffffffded0,%rax
+  8028ab:	ff ff ff 
+  8028ae:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8028b2:	48 89 c2             	mov    %rax,%rdx
+  8028b5:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8028ba:	48 b8 ed de ff ff ff 	movabs $0xffffffffffffdeed,%rax
+  8028c1:	ff ff ff 
+  8028c4:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8028c8:	48 89 c7             	mov    %rax,%rdi
+  8028cb:	4d 89 f7             	mov    %r14,%r15
+  8028ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d3:	49 b9 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%r9
+  8028da:	ff ff ff 
+  8028dd:	4d 01 f1             	add    %r14,%r9
+  8028e0:	41 ff d1             	call   *%r9
+
+	return ret;
+  8028e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8028e7:	48 83 c4 48          	add    $0x48,%rsp
+  8028eb:	5b                   	pop    %rbx
+  8028ec:	41 5c                	pop    %r12
+  8028ee:	41 5d                	pop    %r13
+  8028f0:	41 5e                	pop    %r14
+  8028f2:	41 5f                	pop    %r15
+  8028f4:	5d                   	pop    %rbp
+  8028f5:	c3                   	ret
+
+00000000008028f6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8028f6:	55                   	push   %rbp
+  8028f7:	48 89 e5             	mov    %rsp,%rbp
+  8028fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8028fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028fe <sys_cputs+0x8>
+  802905:	49 bb 42 77 00 00 00 	movabs $0x7742,%r11
+  80290c:	00 00 00 
+  80290f:	4c 01 d8             	add    %r11,%rax
+  802912:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802916:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80291a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80291e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802922:	48 83 ec 08          	sub    $0x8,%rsp
+  802926:	6a 00                	push   $0x0
+  802928:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80292e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802934:	be 00 00 00 00       	mov    $0x0,%esi
+  802939:	bf 00 00 00 00       	mov    $0x0,%edi
+  80293e:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802945:	ff ff ff 
+  802948:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80294c:	ff d0                	call   *%rax
+  80294e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802952:	90                   	nop
+  802953:	c9                   	leave
+  802954:	c3                   	ret
+
+0000000000802955 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802955:	55                   	push   %rbp
+  802956:	48 89 e5             	mov    %rsp,%rbp
+  802959:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802959 <sys_cgetc+0x4>
+  802960:	49 bb e7 76 00 00 00 	movabs $0x76e7,%r11
+  802967:	00 00 00 
+  80296a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80296d:	48 83 ec 08          	sub    $0x8,%rsp
+  802971:	6a 00                	push   $0x0
+  802973:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802979:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80297f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802984:	ba 00 00 00 00       	mov    $0x0,%edx
+  802989:	be 00 00 00 00       	mov    $0x0,%esi
+  80298e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802993:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  80299a:	ff ff ff 
+  80299d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029a1:	ff d0                	call   *%rax
+  8029a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029a7:	c9                   	leave
+  8029a8:	c3                   	ret
+
+00000000008029a9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8029a9:	55                   	push   %rbp
+  8029aa:	48 89 e5             	mov    %rsp,%rbp
+  8029ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8029b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029b1 <sys_env_destroy+0x8>
+  8029b8:	49 bb 8f 76 00 00 00 	movabs $0x768f,%r11
+  8029bf:	00 00 00 
+  8029c2:	4c 01 d8             	add    %r11,%rax
+  8029c5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8029c8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029cb:	48 63 d2             	movslq %edx,%rdx
+  8029ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8029d2:	6a 00                	push   $0x0
+  8029d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8029ea:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029ef:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  8029f6:	ff ff ff 
+  8029f9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029fd:	ff d0                	call   *%rax
+  8029ff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a03:	c9                   	leave
+  802a04:	c3                   	ret
+
+0000000000802a05 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802a05:	55                   	push   %rbp
+  802a06:	48 89 e5             	mov    %rsp,%rbp
+  802a09:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a09 <sys_getenvid+0x4>
+  802a10:	49 bb 37 76 00 00 00 	movabs $0x7637,%r11
+  802a17:	00 00 00 
+  802a1a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802a1d:	48 83 ec 08          	sub    $0x8,%rsp
+  802a21:	6a 00                	push   $0x0
+  802a23:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a34:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a39:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a43:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802a4a:	ff ff ff 
+  802a4d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a51:	ff d0                	call   *%rax
+  802a53:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a57:	c9                   	leave
+  802a58:	c3                   	ret
+
+0000000000802a59 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802a59:	55                   	push   %rbp
+  802a5a:	48 89 e5             	mov    %rsp,%rbp
+  802a5d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a5d <sys_yield+0x4>
+  802a64:	49 bb e3 75 00 00 00 	movabs $0x75e3,%r11
+  802a6b:	00 00 00 
+  802a6e:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802a71:	48 83 ec 08          	sub    $0x8,%rsp
+  802a75:	6a 00                	push   $0x0
+  802a77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a92:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802a97:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802a9e:	ff ff ff 
+  802aa1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802aa5:	ff d0                	call   *%rax
+  802aa7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aab:	90                   	nop
+  802aac:	c9                   	leave
+  802aad:	c3                   	ret
+
+0000000000802aae <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802aae:	55                   	push   %rbp
+  802aaf:	48 89 e5             	mov    %rsp,%rbp
+  802ab2:	48 83 ec 10          	sub    $0x10,%rsp
+  802ab6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ab6 <sys_page_alloc+0x8>
+  802abd:	49 bb 8a 75 00 00 00 	movabs $0x758a,%r11
+  802ac4:	00 00 00 
+  802ac7:	4c 01 d8             	add    %r11,%rax
+  802aca:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802acd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802ad1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802ad4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802ad7:	48 63 f2             	movslq %edx,%rsi
+  802ada:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802ade:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802ae1:	48 63 d2             	movslq %edx,%rdx
+  802ae4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae8:	6a 00                	push   $0x0
+  802aea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802af0:	49 89 f0             	mov    %rsi,%r8
+  802af3:	be 01 00 00 00       	mov    $0x1,%esi
+  802af8:	bf 04 00 00 00       	mov    $0x4,%edi
+  802afd:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802b04:	ff ff ff 
+  802b07:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b0b:	ff d0                	call   *%rax
+  802b0d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b11:	c9                   	leave
+  802b12:	c3                   	ret
+
+0000000000802b13 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802b13:	55                   	push   %rbp
+  802b14:	48 89 e5             	mov    %rsp,%rbp
+  802b17:	48 83 ec 20          	sub    $0x20,%rsp
+  802b1b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b1b <sys_page_map+0x8>
+  802b22:	49 bb 25 75 00 00 00 	movabs $0x7525,%r11
+  802b29:	00 00 00 
+  802b2c:	4c 01 d8             	add    %r11,%rax
+  802b2f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b32:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b36:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802b39:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802b3d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802b41:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802b44:	48 63 f2             	movslq %edx,%rsi
+  802b47:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802b4b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802b4e:	48 63 fa             	movslq %edx,%rdi
+  802b51:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802b55:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b58:	48 63 d2             	movslq %edx,%rdx
+  802b5b:	48 83 ec 08          	sub    $0x8,%rsp
+  802b5f:	56                   	push   %rsi
+  802b60:	4d 89 c1             	mov    %r8,%r9
+  802b63:	49 89 f8             	mov    %rdi,%r8
+  802b66:	be 01 00 00 00       	mov    $0x1,%esi
+  802b6b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802b70:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802b77:	ff ff ff 
+  802b7a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b7e:	ff d0                	call   *%rax
+  802b80:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b84:	c9                   	leave
+  802b85:	c3                   	ret
+
+0000000000802b86 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802b86:	55                   	push   %rbp
+  802b87:	48 89 e5             	mov    %rsp,%rbp
+  802b8a:	48 83 ec 10          	sub    $0x10,%rsp
+  802b8e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b8e <sys_page_unmap+0x8>
+  802b95:	49 bb b2 74 00 00 00 	movabs $0x74b2,%r11
+  802b9c:	00 00 00 
+  802b9f:	4c 01 d8             	add    %r11,%rax
+  802ba2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802ba5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802ba9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802bad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802bb0:	48 63 d2             	movslq %edx,%rdx
+  802bb3:	48 83 ec 08          	sub    $0x8,%rsp
+  802bb7:	6a 00                	push   $0x0
+  802bb9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bbf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bc5:	be 01 00 00 00       	mov    $0x1,%esi
+  802bca:	bf 06 00 00 00       	mov    $0x6,%edi
+  802bcf:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802bd6:	ff ff ff 
+  802bd9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802bdd:	ff d0                	call   *%rax
+  802bdf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802be3:	c9                   	leave
+  802be4:	c3                   	ret
+
+0000000000802be5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802be5:	55                   	push   %rbp
+  802be6:	48 89 e5             	mov    %rsp,%rbp
+  802be9:	48 83 ec 10          	sub    $0x10,%rsp
+  802bed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802bed <sys_env_set_status+0x8>
+  802bf4:	49 bb 53 74 00 00 00 	movabs $0x7453,%r11
+  802bfb:	00 00 00 
+  802bfe:	4c 01 d8             	add    %r11,%rax
+  802c01:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c04:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802c07:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802c0a:	48 63 ca             	movslq %edx,%rcx
+  802c0d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802c10:	48 63 d2             	movslq %edx,%rdx
+  802c13:	48 83 ec 08          	sub    $0x8,%rsp
+  802c17:	6a 00                	push   $0x0
+  802c19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c1f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c25:	be 01 00 00 00       	mov    $0x1,%esi
+  802c2a:	bf 08 00 00 00       	mov    $0x8,%edi
+  802c2f:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802c36:	ff ff ff 
+  802c39:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c3d:	ff d0                	call   *%rax
+  802c3f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c43:	c9                   	leave
+  802c44:	c3                   	ret
+
+0000000000802c45 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802c45:	55                   	push   %rbp
+  802c46:	48 89 e5             	mov    %rsp,%rbp
+  802c49:	48 83 ec 10          	sub    $0x10,%rsp
+  802c4d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c4d <sys_env_set_trapframe+0x8>
+  802c54:	49 bb f3 73 00 00 00 	movabs $0x73f3,%r11
+  802c5b:	00 00 00 
+  802c5e:	4c 01 d8             	add    %r11,%rax
+  802c61:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c64:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802c68:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802c6c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802c6f:	48 63 d2             	movslq %edx,%rdx
+  802c72:	48 83 ec 08          	sub    $0x8,%rsp
+  802c76:	6a 00                	push   $0x0
+  802c78:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c7e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c84:	be 01 00 00 00       	mov    $0x1,%esi
+  802c89:	bf 09 00 00 00       	mov    $0x9,%edi
+  802c8e:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802c95:	ff ff ff 
+  802c98:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c9c:	ff d0                	call   *%rax
+  802c9e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ca2:	c9                   	leave
+  802ca3:	c3                   	ret
+
+0000000000802ca4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802ca4:	55                   	push   %rbp
+  802ca5:	48 89 e5             	mov    %rsp,%rbp
+  802ca8:	48 83 ec 10          	sub    $0x10,%rsp
+  802cac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802cac <sys_env_set_pgfault_upcall+0x8>
+  802cb3:	49 bb 94 73 00 00 00 	movabs $0x7394,%r11
+  802cba:	00 00 00 
+  802cbd:	4c 01 d8             	add    %r11,%rax
+  802cc0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802cc3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802cc7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802ccb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802cce:	48 63 d2             	movslq %edx,%rdx
+  802cd1:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd5:	6a 00                	push   $0x0
+  802cd7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802cdd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ce3:	be 01 00 00 00       	mov    $0x1,%esi
+  802ce8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802ced:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802cf4:	ff ff ff 
+  802cf7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802cfb:	ff d0                	call   *%rax
+  802cfd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d01:	c9                   	leave
+  802d02:	c3                   	ret
+
+0000000000802d03 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802d03:	55                   	push   %rbp
+  802d04:	48 89 e5             	mov    %rsp,%rbp
+  802d07:	48 83 ec 20          	sub    $0x20,%rsp
+  802d0b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d0b <sys_ipc_try_send+0x8>
+  802d12:	49 bb 35 73 00 00 00 	movabs $0x7335,%r11
+  802d19:	00 00 00 
+  802d1c:	4c 01 d8             	add    %r11,%rax
+  802d1f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802d22:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d26:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802d2a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802d2d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802d30:	48 63 fa             	movslq %edx,%rdi
+  802d33:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802d37:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802d3a:	48 63 d2             	movslq %edx,%rdx
+  802d3d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802d41:	48 83 ec 08          	sub    $0x8,%rsp
+  802d45:	6a 00                	push   $0x0
+  802d47:	49 89 f9             	mov    %rdi,%r9
+  802d4a:	49 89 f0             	mov    %rsi,%r8
+  802d4d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d52:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802d57:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802d5e:	ff ff ff 
+  802d61:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d65:	ff d0                	call   *%rax
+  802d67:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d6b:	c9                   	leave
+  802d6c:	c3                   	ret
+
+0000000000802d6d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802d6d:	55                   	push   %rbp
+  802d6e:	48 89 e5             	mov    %rsp,%rbp
+  802d71:	48 83 ec 20          	sub    $0x20,%rsp
+  802d75:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d75 <sys_ipc_send+0x8>
+  802d7c:	49 bb cb 72 00 00 00 	movabs $0x72cb,%r11
+  802d83:	00 00 00 
+  802d86:	4c 01 d8             	add    %r11,%rax
+  802d89:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802d8c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d90:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802d94:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802d97:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802d9a:	48 63 fa             	movslq %edx,%rdi
+  802d9d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802da1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802da4:	48 63 d2             	movslq %edx,%rdx
+  802da7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802dab:	48 83 ec 08          	sub    $0x8,%rsp
+  802daf:	6a 00                	push   $0x0
+  802db1:	49 89 f9             	mov    %rdi,%r9
+  802db4:	49 89 f0             	mov    %rsi,%r8
+  802db7:	be 00 00 00 00       	mov    $0x0,%esi
+  802dbc:	bf 17 00 00 00       	mov    $0x17,%edi
+  802dc1:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802dc8:	ff ff ff 
+  802dcb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802dcf:	ff d0                	call   *%rax
+  802dd1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802dd5:	c9                   	leave
+  802dd6:	c3                   	ret
+
+0000000000802dd7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802dd7:	55                   	push   %rbp
+  802dd8:	48 89 e5             	mov    %rsp,%rbp
+  802ddb:	48 83 ec 10          	sub    $0x10,%rsp
+  802ddf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ddf <sys_ipc_recv+0x8>
+  802de6:	49 bb 61 72 00 00 00 	movabs $0x7261,%r11
+  802ded:	00 00 00 
+  802df0:	4c 01 d8             	add    %r11,%rax
+  802df3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802df7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802dfb:	6a 00                	push   $0x0
+  802dfd:	6a 00                	push   $0x0
+  802dff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e10:	be 01 00 00 00       	mov    $0x1,%esi
+  802e15:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802e1a:	49 ba 07 87 ff ff ff 	movabs $0xffffffffffff8707,%r10
+  802e21:	ff ff ff 
+  802e24:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e28:	ff d0                	call   *%rax
+  802e2a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e2e:	c9                   	leave
+  802e2f:	c3                   	ret
+
+0000000000802e30 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802e30:	55                   	push   %rbp
+  802e31:	48 89 e5             	mov    %rsp,%rbp
+  802e34:	48 83 ec 30          	sub    $0x30,%rsp
+  802e38:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e38 <sys_ipc_call+0x8>
+  802e3f:	49 bb 08 72 00 00 00 	movabs $0x7208,%r11
+  802e46:	00 00 00 
+  802e49:	4c 01 d8             	add    %r11,%rax
+  802e4c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802e4f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802e53:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802e57:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802e5a:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802e5e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802e62:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e66:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802e69:	4c 63 c2             	movslq %edx,%r8
+  802e6c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802e70:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802e73:	48 63 d2             	movslq %edx,%rdx
+  802e76:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802e7a:	ff 75 d8             	push   -0x28(%rbp)
+  802e7d:	56                   	push   %rsi
+  802e7e:	4d 89 c1             	mov    %r8,%r9
+  802e81:	49 89 f8             	mov    %rdi,%r8
+  802e84:	be 00 00 00 00       	mov    $0x0,%esi
+  802e89:	bf 18 00 00 00       	mov    $0x18,%edi
+  802e8e:	49 ba 07 87 ff ff ff 	movabs $0xffffffffffff8707,%r10
+  802e95:	ff ff ff 
+  802e98:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e9c:	ff d0                	call   *%rax
+  802e9e:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802ea2:	c9                   	leave
+  802ea3:	c3                   	ret
+
+0000000000802ea4 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802ea4:	55                   	push   %rbp
+  802ea5:	48 89 e5             	mov    %rsp,%rbp
+  802ea8:	48 83 ec 30          	sub    $0x30,%rsp
+  802eac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802eac <sys_ipc_reply_recv+0x8>
+  802eb3:	49 bb 94 71 00 00 00 	movabs $0x7194,%r11
+  802eba:	00 00 00 
+  802ebd:	4c 01 d8             	add    %r11,%rax
+  802ec0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802ec3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802ec7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802ecb:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802ece:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802ed2:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802ed6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802eda:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802edd:	4c 63 c2             	movslq %edx,%r8
+  802ee0:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802ee4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802ee7:	48 63 d2             	movslq %edx,%rdx
+  802eea:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802eee:	ff 75 d8             	push   -0x28(%rbp)
+  802ef1:	56                   	push   %rsi
+  802ef2:	4d 89 c1             	mov    %r8,%r9
+  802ef5:	49 89 f8             	mov    %rdi,%r8
+  802ef8:	be 00 00 00 00       	mov    $0x0,%esi
+  802efd:	bf 19 00 00 00       	mov    $0x19,%edi
+  802f02:	49 ba 07 87 ff ff ff 	movabs $0xffffffffffff8707,%r10
+  802f09:	ff ff ff 
+  802f0c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f10:	ff d0                	call   *%rax
+  802f12:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802f16:	c9                   	leave
+  802f17:	c3                   	ret
+
+0000000000802f18 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802f18:	55                   	push   %rbp
+  802f19:	48 89 e5             	mov    %rsp,%rbp
+  802f1c:	48 83 ec 10          	sub    $0x10,%rsp
+  802f20:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f20 <sys_env_set_priority+0x8>
+  802f27:	49 bb 20 71 00 00 00 	movabs $0x7120,%r11
+  802f2e:	00 00 00 
+  802f31:	4c 01 d8             	add    %r11,%rax
+  802f34:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802f37:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802f3a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802f3d:	48 63 ca             	movslq %edx,%rcx
+  802f40:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802f43:	48 63 d2             	movslq %edx,%rdx
+  802f46:	48 83 ec 08          	sub    $0x8,%rsp
+  802f4a:	6a 00                	push   $0x0
+  802f4c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f58:	be 01 00 00 00       	mov    $0x1,%esi
+  802f5d:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802f62:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802f69:	ff ff ff 
+  802f6c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f70:	ff d0                	call   *%rax
+  802f72:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f76:	c9                   	leave
+  802f77:	c3                   	ret
+
+0000000000802f78 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802f78:	55                   	push   %rbp
+  802f79:	48 89 e5             	mov    %rsp,%rbp
+  802f7c:	48 83 ec 10          	sub    $0x10,%rsp
+  802f80:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f80 <sys_env_set_affinity+0x8>
+  802f87:	49 bb c0 70 00 00 00 	movabs $0x70c0,%r11
+  802f8e:	00 00 00 
+  802f91:	4c 01 d8             	add    %r11,%rax
+  802f94:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802f97:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802f9a:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802f9d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802fa0:	48 63 d2             	movslq %edx,%rdx
+  802fa3:	48 83 ec 08          	sub    $0x8,%rsp
+  802fa7:	6a 00                	push   $0x0
+  802fa9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802faf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fb5:	be 01 00 00 00       	mov    $0x1,%esi
+  802fba:	bf 10 00 00 00       	mov    $0x10,%edi
+  802fbf:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  802fc6:	ff ff ff 
+  802fc9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802fcd:	ff d0                	call   *%rax
+  802fcf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802fd3:	c9                   	leave
+  802fd4:	c3                   	ret
+
+0000000000802fd5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802fd5:	55                   	push   %rbp
+  802fd6:	48 89 e5             	mov    %rsp,%rbp
+  802fd9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802fd9 <sys_time_msec+0x4>
+  802fe0:	49 bb 67 70 00 00 00 	movabs $0x7067,%r11
+  802fe7:	00 00 00 
+  802fea:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802fed:	48 83 ec 08          	sub    $0x8,%rsp
+  802ff1:	6a 00                	push   $0x0
+  802ff3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ff9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803004:	ba 00 00 00 00       	mov    $0x0,%edx
+  803009:	be 00 00 00 00       	mov    $0x0,%esi
+  80300e:	bf 0e 00 00 00       	mov    $0xe,%edi
+  803013:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  80301a:	ff ff ff 
+  80301d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803021:	ff d0                	call   *%rax
+  803023:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803027:	c9                   	leave
+  803028:	c3                   	ret
+
+0000000000803029 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  803029:	55                   	push   %rbp
+  80302a:	48 89 e5             	mov    %rsp,%rbp
+  80302d:	48 83 ec 10          	sub    $0x10,%rsp
+  803031:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803031 <sys_sleep_usec+0x8>
+  803038:	49 bb 0f 70 00 00 00 	movabs $0x700f,%r11
+  80303f:	00 00 00 
+  803042:	4c 01 d8             	add    %r11,%rax
+  803045:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  803049:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80304d:	48 83 ec 08          	sub    $0x8,%rsp
+  803051:	6a 00                	push   $0x0
+  803053:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803059:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80305f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803064:	be 00 00 00 00       	mov    $0x0,%esi
+  803069:	bf 11 00 00 00       	mov    $0x11,%edi
+  80306e:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  803075:	ff ff ff 
+  803078:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80307c:	ff d0                	call   *%rax
+  80307e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803082:	c9                   	leave
+  803083:	c3                   	ret
+
+0000000000803084 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  803084:	55                   	push   %rbp
+  803085:	48 89 e5             	mov    %rsp,%rbp
+  803088:	48 83 ec 10          	sub    $0x10,%rsp
+  80308c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80308c <sys_page_alloc_huge+0x8>
+  803093:	49 bb b4 6f 00 00 00 	movabs $0x6fb4,%r11
+  80309a:	00 00 00 
+  80309d:	4c 01 d8             	add    %r11,%rax
+  8030a0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8030a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8030a7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8030aa:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8030ad:	48 63 f2             	movslq %edx,%rsi
+  8030b0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8030b4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8030b7:	48 63 d2             	movslq %edx,%rdx
+  8030ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8030be:	6a 00                	push   $0x0
+  8030c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030c6:	49 89 f0             	mov    %rsi,%r8
+  8030c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8030ce:	bf 12 00 00 00       	mov    $0x12,%edi
+  8030d3:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  8030da:	ff ff ff 
+  8030dd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8030e1:	ff d0                	call   *%rax
+  8030e3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8030e7:	c9                   	leave
+  8030e8:	c3                   	ret
+
+00000000008030e9 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8030e9:	55                   	push   %rbp
+  8030ea:	48 89 e5             	mov    %rsp,%rbp
+  8030ed:	48 83 ec 10          	sub    $0x10,%rsp
+  8030f1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8030f1 <sys_page_map_batch+0x8>
+  8030f8:	49 bb 4f 6f 00 00 00 	movabs $0x6f4f,%r11
+  8030ff:	00 00 00 
+  803102:	4c 01 d8             	add    %r11,%rax
+  803105:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803109:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80310d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803111:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803115:	48 83 ec 08          	sub    $0x8,%rsp
+  803119:	6a 00                	push   $0x0
+  80311b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803121:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803127:	be 01 00 00 00       	mov    $0x1,%esi
+  80312c:	bf 13 00 00 00       	mov    $0x13,%edi
+  803131:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  803138:	ff ff ff 
+  80313b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80313f:	ff d0                	call   *%rax
+  803141:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803145:	c9                   	leave
+  803146:	c3                   	ret
+
+0000000000803147 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  803147:	55                   	push   %rbp
+  803148:	48 89 e5             	mov    %rsp,%rbp
+  80314b:	48 83 ec 10          	sub    $0x10,%rsp
+  80314f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80314f <sys_page_alloc_batch+0x8>
+  803156:	49 bb f1 6e 00 00 00 	movabs $0x6ef1,%r11
+  80315d:	00 00 00 
+  803160:	4c 01 d8             	add    %r11,%rax
+  803163:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803167:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80316b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80316f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803173:	48 83 ec 08          	sub    $0x8,%rsp
+  803177:	6a 00                	push   $0x0
+  803179:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80317f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803185:	be 01 00 00 00       	mov    $0x1,%esi
+  80318a:	bf 14 00 00 00       	mov    $0x14,%edi
+  80318f:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  803196:	ff ff ff 
+  803199:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80319d:	ff d0                	call   *%rax
+  80319f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031a3:	c9                   	leave
+  8031a4:	c3                   	ret
+
+00000000008031a5 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8031a5:	55                   	push   %rbp
+  8031a6:	48 89 e5             	mov    %rsp,%rbp
+  8031a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8031ad:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8031ad <sys_page_unmap_batch+0x8>
+  8031b4:	49 bb 93 6e 00 00 00 	movabs $0x6e93,%r11
+  8031bb:	00 00 00 
+  8031be:	4c 01 d8             	add    %r11,%rax
+  8031c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8031c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8031c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031cd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8031d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8031d5:	6a 00                	push   $0x0
+  8031d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8031dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8031e3:	be 01 00 00 00       	mov    $0x1,%esi
+  8031e8:	bf 15 00 00 00       	mov    $0x15,%edi
+  8031ed:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  8031f4:	ff ff ff 
+  8031f7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8031fb:	ff d0                	call   *%rax
+  8031fd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803201:	c9                   	leave
+  803202:	c3                   	ret
+
+0000000000803203 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  803203:	55                   	push   %rbp
+  803204:	48 89 e5             	mov    %rsp,%rbp
+  803207:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803207 <sys_fork+0x4>
+  80320e:	49 bb 39 6e 00 00 00 	movabs $0x6e39,%r11
+  803215:	00 00 00 
+  803218:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80321b:	48 83 ec 08          	sub    $0x8,%rsp
+  80321f:	6a 00                	push   $0x0
+  803221:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803227:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80322d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803232:	ba 00 00 00 00       	mov    $0x0,%edx
+  803237:	be 00 00 00 00       	mov    $0x0,%esi
+  80323c:	bf 16 00 00 00       	mov    $0x16,%edi
+  803241:	49 ba 4d 86 ff ff ff 	movabs $0xffffffffffff864d,%r10
+  803248:	ff ff ff 
+  80324b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80324f:	ff d0                	call   *%rax
+  803251:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803255:	c9                   	leave
+  803256:	c3                   	ret
+
+0000000000803257 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803257:	55                   	push   %rbp
+  803258:	48 89 e5             	mov    %rsp,%rbp
+  80325b:	48 83 ec 08          	sub    $0x8,%rsp
+  80325f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80325f <fd2num+0x8>
+  803266:	49 bb e1 6d 00 00 00 	movabs $0x6de1,%r11
+  80326d:	00 00 00 
+  803270:	4c 01 d8             	add    %r11,%rax
+  803273:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803277:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80327b:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803282:	ff ff ff 
+  803285:	48 01 d0             	add    %rdx,%rax
+  803288:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80328c:	c9                   	leave
+  80328d:	c3                   	ret
+
+000000000080328e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80328e:	55                   	push   %rbp
+  80328f:	48 89 e5             	mov    %rsp,%rbp
+  803292:	48 83 ec 08          	sub    $0x8,%rsp
+  803296:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803296 <fd2data+0x8>
+  80329d:	49 bb aa 6d 00 00 00 	movabs $0x6daa,%r11
+  8032a4:	00 00 00 
+  8032a7:	4c 01 d8             	add    %r11,%rax
+  8032aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8032ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032b2:	48 89 d7             	mov    %rdx,%rdi
+  8032b5:	48 ba 17 92 ff ff ff 	movabs $0xffffffffffff9217,%rdx
+  8032bc:	ff ff ff 
+  8032bf:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8032c3:	ff d0                	call   *%rax
+  8032c5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8032cb:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8032cf:	c9                   	leave
+  8032d0:	c3                   	ret
+
+00000000008032d1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8032d1:	55                   	push   %rbp
+  8032d2:	48 89 e5             	mov    %rsp,%rbp
+  8032d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8032d9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8032d9 <fd_alloc+0x8>
+  8032e0:	49 bb 67 6d 00 00 00 	movabs $0x6d67,%r11
+  8032e7:	00 00 00 
+  8032ea:	4c 01 d8             	add    %r11,%rax
+  8032ed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8032f1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8032f8:	eb 75                	jmp    80336f <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8032fa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8032fd:	48 63 d2             	movslq %edx,%rdx
+  803300:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803307:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80330b:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80330f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803313:	48 89 d1             	mov    %rdx,%rcx
+  803316:	48 c1 e9 15          	shr    $0x15,%rcx
+  80331a:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803321:	ff ff ff 
+  803324:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803328:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80332c:	83 e2 01             	and    $0x1,%edx
+  80332f:	48 85 d2             	test   %rdx,%rdx
+  803332:	74 25                	je     803359 <fd_alloc+0x88>
+  803334:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803338:	48 89 d1             	mov    %rdx,%rcx
+  80333b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80333f:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803346:	ff ff ff 
+  803349:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80334d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803351:	83 e2 01             	and    $0x1,%edx
+  803354:	48 85 d2             	test   %rdx,%rdx
+  803357:	75 12                	jne    80336b <fd_alloc+0x9a>
+			*fd_store = fd;
+  803359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80335d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803361:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803364:	b8 00 00 00 00       	mov    $0x0,%eax
+  803369:	eb 1a                	jmp    803385 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  80336b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80336f:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803373:	7e 85                	jle    8032fa <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803375:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803379:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803380:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803385:	c9                   	leave
+  803386:	c3                   	ret
+
+0000000000803387 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803387:	55                   	push   %rbp
+  803388:	48 89 e5             	mov    %rsp,%rbp
+  80338b:	48 83 ec 20          	sub    $0x20,%rsp
+  80338f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80338f <fd_lookup+0x8>
+  803396:	49 bb b1 6c 00 00 00 	movabs $0x6cb1,%r11
+  80339d:	00 00 00 
+  8033a0:	4c 01 d8             	add    %r11,%rax
+  8033a3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8033a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8033aa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033ae:	78 06                	js     8033b6 <fd_lookup+0x2f>
+  8033b0:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8033b4:	7e 07                	jle    8033bd <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8033b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033bb:	eb 73                	jmp    803430 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8033bd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8033c0:	48 63 d2             	movslq %edx,%rdx
+  8033c3:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8033ca:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8033ce:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8033d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033d6:	48 89 d1             	mov    %rdx,%rcx
+  8033d9:	48 c1 e9 15          	shr    $0x15,%rcx
+  8033dd:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8033e4:	ff ff ff 
+  8033e7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8033eb:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8033ef:	83 e2 01             	and    $0x1,%edx
+  8033f2:	48 85 d2             	test   %rdx,%rdx
+  8033f5:	74 22                	je     803419 <fd_lookup+0x92>
+  8033f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033fb:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8033ff:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  803406:	ff ff ff 
+  803409:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  80340d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803411:	83 e0 01             	and    $0x1,%eax
+  803414:	48 85 c0             	test   %rax,%rax
+  803417:	75 07                	jne    803420 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803419:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80341e:	eb 10                	jmp    803430 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803420:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803424:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803428:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  80342b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803430:	c9                   	leave
+  803431:	c3                   	ret
+
+0000000000803432 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803432:	55                   	push   %rbp
+  803433:	48 89 e5             	mov    %rsp,%rbp
+  803436:	41 57                	push   %r15
+  803438:	53                   	push   %rbx
+  803439:	48 83 ec 30          	sub    $0x30,%rsp
+  80343d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80343d <fd_close+0xb>
+  803444:	49 bb 03 6c 00 00 00 	movabs $0x6c03,%r11
+  80344b:	00 00 00 
+  80344e:	4c 01 db             	add    %r11,%rbx
+  803451:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803455:	89 f0                	mov    %esi,%eax
+  803457:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80345a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80345e:	48 89 c7             	mov    %rax,%rdi
+  803461:	48 b8 17 92 ff ff ff 	movabs $0xffffffffffff9217,%rax
+  803468:	ff ff ff 
+  80346b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80346f:	ff d0                	call   *%rax
+  803471:	89 c2                	mov    %eax,%edx
+  803473:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803477:	48 89 c6             	mov    %rax,%rsi
+  80347a:	89 d7                	mov    %edx,%edi
+  80347c:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  803483:	ff ff ff 
+  803486:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80348a:	ff d0                	call   *%rax
+  80348c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80348f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803493:	78 0a                	js     80349f <fd_close+0x6d>
+	    || fd != fd2)
+  803495:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803499:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80349d:	74 12                	je     8034b1 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80349f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8034a3:	74 05                	je     8034aa <fd_close+0x78>
+  8034a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034a8:	eb 7a                	jmp    803524 <fd_close+0xf2>
+  8034aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034af:	eb 73                	jmp    803524 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8034b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034b5:	8b 00                	mov    (%rax),%eax
+  8034b7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8034bb:	48 89 d6             	mov    %rdx,%rsi
+  8034be:	89 c7                	mov    %eax,%edi
+  8034c0:	48 b8 ed 94 ff ff ff 	movabs $0xffffffffffff94ed,%rax
+  8034c7:	ff ff ff 
+  8034ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034ce:	ff d0                	call   *%rax
+  8034d0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034d7:	78 2a                	js     803503 <fd_close+0xd1>
+		if (dev->dev_close)
+  8034d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034dd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8034e1:	48 85 c0             	test   %rax,%rax
+  8034e4:	74 16                	je     8034fc <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8034e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034ea:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034f2:	48 89 c7             	mov    %rax,%rdi
+  8034f5:	ff d2                	call   *%rdx
+  8034f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034fa:	eb 07                	jmp    803503 <fd_close+0xd1>
+		else
+			r = 0;
+  8034fc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  803503:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803507:	48 89 c6             	mov    %rax,%rsi
+  80350a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80350f:	49 89 df             	mov    %rbx,%r15
+  803512:	48 b8 46 8b ff ff ff 	movabs $0xffffffffffff8b46,%rax
+  803519:	ff ff ff 
+  80351c:	48 01 d8             	add    %rbx,%rax
+  80351f:	ff d0                	call   *%rax
+	return r;
+  803521:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803524:	48 83 c4 30          	add    $0x30,%rsp
+  803528:	5b                   	pop    %rbx
+  803529:	41 5f                	pop    %r15
+  80352b:	5d                   	pop    %rbp
+  80352c:	c3                   	ret
+
+000000000080352d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80352d:	55                   	push   %rbp
+  80352e:	48 89 e5             	mov    %rsp,%rbp
+  803531:	41 57                	push   %r15
+  803533:	48 83 ec 28          	sub    $0x28,%rsp
+  803537:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803537 <dev_lookup+0xa>
+  80353e:	49 bb 09 6b 00 00 00 	movabs $0x6b09,%r11
+  803545:	00 00 00 
+  803548:	4c 01 d9             	add    %r11,%rcx
+  80354b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80354e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803552:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803559:	eb 45                	jmp    8035a0 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  80355b:	48 ba 40 02 00 00 00 	movabs $0x240,%rdx
+  803562:	00 00 00 
+  803565:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803568:	48 98                	cltq
+  80356a:	48 01 ca             	add    %rcx,%rdx
+  80356d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803571:	8b 00                	mov    (%rax),%eax
+  803573:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803576:	75 24                	jne    80359c <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803578:	48 ba 40 02 00 00 00 	movabs $0x240,%rdx
+  80357f:	00 00 00 
+  803582:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803585:	48 98                	cltq
+  803587:	48 01 ca             	add    %rcx,%rdx
+  80358a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80358e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803592:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359a:	eb 74                	jmp    803610 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  80359c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8035a0:	48 ba 40 02 00 00 00 	movabs $0x240,%rdx
+  8035a7:	00 00 00 
+  8035aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035ad:	48 98                	cltq
+  8035af:	48 01 ca             	add    %rcx,%rdx
+  8035b2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035b6:	48 85 c0             	test   %rax,%rax
+  8035b9:	75 a0                	jne    80355b <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8035bb:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8035c2:	ff ff ff 
+  8035c5:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8035c9:	48 8b 00             	mov    (%rax),%rax
+  8035cc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8035d2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8035d5:	89 c6                	mov    %eax,%esi
+  8035d7:	48 b8 00 df ff ff ff 	movabs $0xffffffffffffdf00,%rax
+  8035de:	ff ff ff 
+  8035e1:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8035e5:	48 89 c7             	mov    %rax,%rdi
+  8035e8:	49 89 cf             	mov    %rcx,%r15
+  8035eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f0:	49 b8 f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%r8
+  8035f7:	ff ff ff 
+  8035fa:	49 01 c8             	add    %rcx,%r8
+  8035fd:	41 ff d0             	call   *%r8
+	*dev = 0;
+  803600:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803604:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  80360b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803610:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803614:	c9                   	leave
+  803615:	c3                   	ret
+
+0000000000803616 <close>:
+
+int
+close(int fdnum)
+{
+  803616:	55                   	push   %rbp
+  803617:	48 89 e5             	mov    %rsp,%rbp
+  80361a:	53                   	push   %rbx
+  80361b:	48 83 ec 28          	sub    $0x28,%rsp
+  80361f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80361f <close+0x9>
+  803626:	49 bb 21 6a 00 00 00 	movabs $0x6a21,%r11
+  80362d:	00 00 00 
+  803630:	4c 01 db             	add    %r11,%rbx
+  803633:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803636:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80363a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80363d:	48 89 d6             	mov    %rdx,%rsi
+  803640:	89 c7                	mov    %eax,%edi
+  803642:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  803649:	ff ff ff 
+  80364c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803650:	ff d0                	call   *%rax
+  803652:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803655:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803659:	79 05                	jns    803660 <close+0x4a>
+		return r;
+  80365b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80365e:	eb 1c                	jmp    80367c <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803660:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803664:	be 01 00 00 00       	mov    $0x1,%esi
+  803669:	48 89 c7             	mov    %rax,%rdi
+  80366c:	48 b8 f2 93 ff ff ff 	movabs $0xffffffffffff93f2,%rax
+  803673:	ff ff ff 
+  803676:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80367a:	ff d0                	call   *%rax
+}
+  80367c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803680:	c9                   	leave
+  803681:	c3                   	ret
+
+0000000000803682 <close_all>:
+
+void
+close_all(void)
+{
+  803682:	55                   	push   %rbp
+  803683:	48 89 e5             	mov    %rsp,%rbp
+  803686:	53                   	push   %rbx
+  803687:	48 83 ec 18          	sub    $0x18,%rsp
+  80368b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80368b <close_all+0x9>
+  803692:	49 bb b5 69 00 00 00 	movabs $0x69b5,%r11
+  803699:	00 00 00 
+  80369c:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80369f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8036a6:	eb 19                	jmp    8036c1 <close_all+0x3f>
+		close(i);
+  8036a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036ab:	89 c7                	mov    %eax,%edi
+  8036ad:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  8036b4:	ff ff ff 
+  8036b7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036bb:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8036bd:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8036c1:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8036c5:	7e e1                	jle    8036a8 <close_all+0x26>
+}
+  8036c7:	90                   	nop
+  8036c8:	90                   	nop
+  8036c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036cd:	c9                   	leave
+  8036ce:	c3                   	ret
+
+00000000008036cf <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8036cf:	55                   	push   %rbp
+  8036d0:	48 89 e5             	mov    %rsp,%rbp
+  8036d3:	41 57                	push   %r15
+  8036d5:	53                   	push   %rbx
+  8036d6:	48 83 ec 40          	sub    $0x40,%rsp
+  8036da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036da <dup+0xb>
+  8036e1:	49 bb 66 69 00 00 00 	movabs $0x6966,%r11
+  8036e8:	00 00 00 
+  8036eb:	4c 01 db             	add    %r11,%rbx
+  8036ee:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8036f1:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8036f4:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8036f8:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8036fb:	48 89 d6             	mov    %rdx,%rsi
+  8036fe:	89 c7                	mov    %eax,%edi
+  803700:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  803707:	ff ff ff 
+  80370a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80370e:	ff d0                	call   *%rax
+  803710:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803713:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803717:	79 08                	jns    803721 <dup+0x52>
+		return r;
+  803719:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80371c:	e9 a4 01 00 00       	jmp    8038c5 <dup+0x1f6>
+	close(newfdnum);
+  803721:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803724:	89 c7                	mov    %eax,%edi
+  803726:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  80372d:	ff ff ff 
+  803730:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803734:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803736:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803739:	48 98                	cltq
+  80373b:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803741:	48 c1 e0 0c          	shl    $0xc,%rax
+  803745:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803749:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80374d:	48 89 c7             	mov    %rax,%rdi
+  803750:	48 b8 4e 92 ff ff ff 	movabs $0xffffffffffff924e,%rax
+  803757:	ff ff ff 
+  80375a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80375e:	ff d0                	call   *%rax
+  803760:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803764:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803768:	48 89 c7             	mov    %rax,%rdi
+  80376b:	48 b8 4e 92 ff ff ff 	movabs $0xffffffffffff924e,%rax
+  803772:	ff ff ff 
+  803775:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803779:	ff d0                	call   *%rax
+  80377b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80377f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803783:	48 c1 e8 15          	shr    $0x15,%rax
+  803787:	48 89 c2             	mov    %rax,%rdx
+  80378a:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  803791:	ff ff ff 
+  803794:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803798:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80379c:	83 e0 01             	and    $0x1,%eax
+  80379f:	48 85 c0             	test   %rax,%rax
+  8037a2:	74 7f                	je     803823 <dup+0x154>
+  8037a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037a8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037ac:	48 89 c2             	mov    %rax,%rdx
+  8037af:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8037b6:	ff ff ff 
+  8037b9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037bd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037c1:	83 e0 01             	and    $0x1,%eax
+  8037c4:	48 85 c0             	test   %rax,%rax
+  8037c7:	74 5a                	je     803823 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8037c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037cd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037d1:	48 89 c2             	mov    %rax,%rdx
+  8037d4:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8037db:	ff ff ff 
+  8037de:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037e2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037e6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8037eb:	89 c1                	mov    %eax,%ecx
+  8037ed:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8037f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037f5:	41 89 c8             	mov    %ecx,%r8d
+  8037f8:	48 89 d1             	mov    %rdx,%rcx
+  8037fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803800:	48 89 c6             	mov    %rax,%rsi
+  803803:	bf 00 00 00 00       	mov    $0x0,%edi
+  803808:	49 89 df             	mov    %rbx,%r15
+  80380b:	48 b8 d3 8a ff ff ff 	movabs $0xffffffffffff8ad3,%rax
+  803812:	ff ff ff 
+  803815:	48 01 d8             	add    %rbx,%rax
+  803818:	ff d0                	call   *%rax
+  80381a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80381d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803821:	78 5f                	js     803882 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803823:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803827:	48 c1 e8 0c          	shr    $0xc,%rax
+  80382b:	48 89 c2             	mov    %rax,%rdx
+  80382e:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803835:	ff ff ff 
+  803838:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80383c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803840:	25 07 0e 00 00       	and    $0xe07,%eax
+  803845:	89 c1                	mov    %eax,%ecx
+  803847:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80384b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80384f:	41 89 c8             	mov    %ecx,%r8d
+  803852:	48 89 d1             	mov    %rdx,%rcx
+  803855:	ba 00 00 00 00       	mov    $0x0,%edx
+  80385a:	48 89 c6             	mov    %rax,%rsi
+  80385d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803862:	49 89 df             	mov    %rbx,%r15
+  803865:	48 b8 d3 8a ff ff ff 	movabs $0xffffffffffff8ad3,%rax
+  80386c:	ff ff ff 
+  80386f:	48 01 d8             	add    %rbx,%rax
+  803872:	ff d0                	call   *%rax
+  803874:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803877:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80387b:	78 08                	js     803885 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  80387d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803880:	eb 43                	jmp    8038c5 <dup+0x1f6>
+			goto err;
+  803882:	90                   	nop
+  803883:	eb 01                	jmp    803886 <dup+0x1b7>
+		goto err;
+  803885:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803886:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80388a:	48 89 c6             	mov    %rax,%rsi
+  80388d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803892:	49 89 df             	mov    %rbx,%r15
+  803895:	48 b8 46 8b ff ff ff 	movabs $0xffffffffffff8b46,%rax
+  80389c:	ff ff ff 
+  80389f:	48 01 d8             	add    %rbx,%rax
+  8038a2:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8038a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038a8:	48 89 c6             	mov    %rax,%rsi
+  8038ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038b0:	49 89 df             	mov    %rbx,%r15
+  8038b3:	48 b8 46 8b ff ff ff 	movabs $0xffffffffffff8b46,%rax
+  8038ba:	ff ff ff 
+  8038bd:	48 01 d8             	add    %rbx,%rax
+  8038c0:	ff d0                	call   *%rax
+	return r;
+  8038c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8038c5:	48 83 c4 40          	add    $0x40,%rsp
+  8038c9:	5b                   	pop    %rbx
+  8038ca:	41 5f                	pop    %r15
+  8038cc:	5d                   	pop    %rbp
+  8038cd:	c3                   	ret
+
+00000000008038ce <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8038ce:	55                   	push   %rbp
+  8038cf:	48 89 e5             	mov    %rsp,%rbp
+  8038d2:	41 57                	push   %r15
+  8038d4:	53                   	push   %rbx
+  8038d5:	48 83 ec 40          	sub    $0x40,%rsp
+  8038d9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038d9 <read+0xb>
+  8038e0:	49 bb 67 67 00 00 00 	movabs $0x6767,%r11
+  8038e7:	00 00 00 
+  8038ea:	4c 01 db             	add    %r11,%rbx
+  8038ed:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8038f0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038f4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8038f8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8038fc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8038ff:	48 89 d6             	mov    %rdx,%rsi
+  803902:	89 c7                	mov    %eax,%edi
+  803904:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  80390b:	ff ff ff 
+  80390e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803912:	ff d0                	call   *%rax
+  803914:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803917:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80391b:	78 28                	js     803945 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80391d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803921:	8b 00                	mov    (%rax),%eax
+  803923:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803927:	48 89 d6             	mov    %rdx,%rsi
+  80392a:	89 c7                	mov    %eax,%edi
+  80392c:	48 b8 ed 94 ff ff ff 	movabs $0xffffffffffff94ed,%rax
+  803933:	ff ff ff 
+  803936:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80393a:	ff d0                	call   *%rax
+  80393c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80393f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803943:	79 08                	jns    80394d <read+0x7f>
+		return r;
+  803945:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803948:	e9 8b 00 00 00       	jmp    8039d8 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80394d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803951:	8b 40 08             	mov    0x8(%rax),%eax
+  803954:	83 e0 03             	and    $0x3,%eax
+  803957:	83 f8 01             	cmp    $0x1,%eax
+  80395a:	75 4b                	jne    8039a7 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80395c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803963:	ff ff ff 
+  803966:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80396a:	48 8b 00             	mov    (%rax),%rax
+  80396d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803973:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803976:	89 c6                	mov    %eax,%esi
+  803978:	48 b8 1f df ff ff ff 	movabs $0xffffffffffffdf1f,%rax
+  80397f:	ff ff ff 
+  803982:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803986:	48 89 c7             	mov    %rax,%rdi
+  803989:	49 89 df             	mov    %rbx,%r15
+  80398c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803991:	48 b9 f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rcx
+  803998:	ff ff ff 
+  80399b:	48 01 d9             	add    %rbx,%rcx
+  80399e:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8039a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039a5:	eb 31                	jmp    8039d8 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8039a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ab:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8039af:	48 85 c0             	test   %rax,%rax
+  8039b2:	75 07                	jne    8039bb <read+0xed>
+		return -E_NOT_SUPP;
+  8039b4:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8039b9:	eb 1d                	jmp    8039d8 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8039bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039bf:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8039c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039c7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8039cb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8039cf:	48 89 ce             	mov    %rcx,%rsi
+  8039d2:	48 89 c7             	mov    %rax,%rdi
+  8039d5:	41 ff d0             	call   *%r8
+}
+  8039d8:	48 83 c4 40          	add    $0x40,%rsp
+  8039dc:	5b                   	pop    %rbx
+  8039dd:	41 5f                	pop    %r15
+  8039df:	5d                   	pop    %rbp
+  8039e0:	c3                   	ret
+
+00000000008039e1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8039e1:	55                   	push   %rbp
+  8039e2:	48 89 e5             	mov    %rsp,%rbp
+  8039e5:	53                   	push   %rbx
+  8039e6:	48 83 ec 38          	sub    $0x38,%rsp
+  8039ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039ea <readn+0x9>
+  8039f1:	49 bb 56 66 00 00 00 	movabs $0x6656,%r11
+  8039f8:	00 00 00 
+  8039fb:	4c 01 db             	add    %r11,%rbx
+  8039fe:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803a01:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803a05:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803a09:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803a10:	eb 4b                	jmp    803a5d <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803a12:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a15:	48 98                	cltq
+  803a17:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a1b:	48 29 c2             	sub    %rax,%rdx
+  803a1e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a21:	48 63 c8             	movslq %eax,%rcx
+  803a24:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a28:	48 01 c1             	add    %rax,%rcx
+  803a2b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a2e:	48 89 ce             	mov    %rcx,%rsi
+  803a31:	89 c7                	mov    %eax,%edi
+  803a33:	48 b8 8e 98 ff ff ff 	movabs $0xffffffffffff988e,%rax
+  803a3a:	ff ff ff 
+  803a3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a41:	ff d0                	call   *%rax
+  803a43:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803a46:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803a4a:	79 05                	jns    803a51 <readn+0x70>
+			return m;
+  803a4c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803a4f:	eb 1d                	jmp    803a6e <readn+0x8d>
+		if (m == 0)
+  803a51:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803a55:	74 13                	je     803a6a <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803a57:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803a5a:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803a5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a60:	48 98                	cltq
+  803a62:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803a66:	72 aa                	jb     803a12 <readn+0x31>
+  803a68:	eb 01                	jmp    803a6b <readn+0x8a>
+			break;
+  803a6a:	90                   	nop
+	}
+	return tot;
+  803a6b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803a6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a72:	c9                   	leave
+  803a73:	c3                   	ret
+
+0000000000803a74 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803a74:	55                   	push   %rbp
+  803a75:	48 89 e5             	mov    %rsp,%rbp
+  803a78:	41 57                	push   %r15
+  803a7a:	53                   	push   %rbx
+  803a7b:	48 83 ec 40          	sub    $0x40,%rsp
+  803a7f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a7f <write+0xb>
+  803a86:	49 bb c1 65 00 00 00 	movabs $0x65c1,%r11
+  803a8d:	00 00 00 
+  803a90:	4c 01 db             	add    %r11,%rbx
+  803a93:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803a96:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803a9a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803a9e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803aa2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803aa5:	48 89 d6             	mov    %rdx,%rsi
+  803aa8:	89 c7                	mov    %eax,%edi
+  803aaa:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  803ab1:	ff ff ff 
+  803ab4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ab8:	ff d0                	call   *%rax
+  803aba:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803abd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ac1:	78 28                	js     803aeb <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ac3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ac7:	8b 00                	mov    (%rax),%eax
+  803ac9:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803acd:	48 89 d6             	mov    %rdx,%rsi
+  803ad0:	89 c7                	mov    %eax,%edi
+  803ad2:	48 b8 ed 94 ff ff ff 	movabs $0xffffffffffff94ed,%rax
+  803ad9:	ff ff ff 
+  803adc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ae0:	ff d0                	call   *%rax
+  803ae2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ae5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ae9:	79 08                	jns    803af3 <write+0x7f>
+		return r;
+  803aeb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803aee:	e9 8a 00 00 00       	jmp    803b7d <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803af3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803af7:	8b 40 08             	mov    0x8(%rax),%eax
+  803afa:	83 e0 03             	and    $0x3,%eax
+  803afd:	85 c0                	test   %eax,%eax
+  803aff:	75 4b                	jne    803b4c <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803b01:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803b08:	ff ff ff 
+  803b0b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b0f:	48 8b 00             	mov    (%rax),%rax
+  803b12:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803b18:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803b1b:	89 c6                	mov    %eax,%esi
+  803b1d:	48 b8 3b df ff ff ff 	movabs $0xffffffffffffdf3b,%rax
+  803b24:	ff ff ff 
+  803b27:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b2b:	48 89 c7             	mov    %rax,%rdi
+  803b2e:	49 89 df             	mov    %rbx,%r15
+  803b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b36:	48 b9 f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rcx
+  803b3d:	ff ff ff 
+  803b40:	48 01 d9             	add    %rbx,%rcx
+  803b43:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803b45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b4a:	eb 31                	jmp    803b7d <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803b4c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b50:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803b54:	48 85 c0             	test   %rax,%rax
+  803b57:	75 07                	jne    803b60 <write+0xec>
+		return -E_NOT_SUPP;
+  803b59:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803b5e:	eb 1d                	jmp    803b7d <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803b60:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b64:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803b68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b6c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803b70:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b74:	48 89 ce             	mov    %rcx,%rsi
+  803b77:	48 89 c7             	mov    %rax,%rdi
+  803b7a:	41 ff d0             	call   *%r8
+}
+  803b7d:	48 83 c4 40          	add    $0x40,%rsp
+  803b81:	5b                   	pop    %rbx
+  803b82:	41 5f                	pop    %r15
+  803b84:	5d                   	pop    %rbp
+  803b85:	c3                   	ret
+
+0000000000803b86 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803b86:	55                   	push   %rbp
+  803b87:	48 89 e5             	mov    %rsp,%rbp
+  803b8a:	48 83 ec 18          	sub    $0x18,%rsp
+  803b8e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b8e <seek+0x8>
+  803b95:	49 bb b2 64 00 00 00 	movabs $0x64b2,%r11
+  803b9c:	00 00 00 
+  803b9f:	4c 01 d8             	add    %r11,%rax
+  803ba2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803ba5:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ba8:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803bac:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803baf:	48 89 ce             	mov    %rcx,%rsi
+  803bb2:	89 d7                	mov    %edx,%edi
+  803bb4:	48 ba 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rdx
+  803bbb:	ff ff ff 
+  803bbe:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803bc2:	ff d0                	call   *%rax
+  803bc4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bc7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bcb:	79 05                	jns    803bd2 <seek+0x4c>
+		return r;
+  803bcd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bd0:	eb 0f                	jmp    803be1 <seek+0x5b>
+	fd->fd_offset = offset;
+  803bd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bd6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803bd9:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803be1:	c9                   	leave
+  803be2:	c3                   	ret
+
+0000000000803be3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803be3:	55                   	push   %rbp
+  803be4:	48 89 e5             	mov    %rsp,%rbp
+  803be7:	41 57                	push   %r15
+  803be9:	53                   	push   %rbx
+  803bea:	48 83 ec 30          	sub    $0x30,%rsp
+  803bee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bee <ftruncate+0xb>
+  803bf5:	49 bb 52 64 00 00 00 	movabs $0x6452,%r11
+  803bfc:	00 00 00 
+  803bff:	4c 01 db             	add    %r11,%rbx
+  803c02:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803c05:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803c08:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803c0c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803c0f:	48 89 d6             	mov    %rdx,%rsi
+  803c12:	89 c7                	mov    %eax,%edi
+  803c14:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  803c1b:	ff ff ff 
+  803c1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c22:	ff d0                	call   *%rax
+  803c24:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c27:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c2b:	78 28                	js     803c55 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c31:	8b 00                	mov    (%rax),%eax
+  803c33:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803c37:	48 89 d6             	mov    %rdx,%rsi
+  803c3a:	89 c7                	mov    %eax,%edi
+  803c3c:	48 b8 ed 94 ff ff ff 	movabs $0xffffffffffff94ed,%rax
+  803c43:	ff ff ff 
+  803c46:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c4a:	ff d0                	call   *%rax
+  803c4c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c4f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c53:	79 08                	jns    803c5d <ftruncate+0x7a>
+		return r;
+  803c55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c58:	e9 83 00 00 00       	jmp    803ce0 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803c5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c61:	8b 40 08             	mov    0x8(%rax),%eax
+  803c64:	83 e0 03             	and    $0x3,%eax
+  803c67:	85 c0                	test   %eax,%eax
+  803c69:	75 4b                	jne    803cb6 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803c6b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803c72:	ff ff ff 
+  803c75:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c79:	48 8b 00             	mov    (%rax),%rax
+  803c7c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803c82:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803c85:	89 c6                	mov    %eax,%esi
+  803c87:	48 b8 58 df ff ff ff 	movabs $0xffffffffffffdf58,%rax
+  803c8e:	ff ff ff 
+  803c91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c95:	48 89 c7             	mov    %rax,%rdi
+  803c98:	49 89 df             	mov    %rbx,%r15
+  803c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca0:	48 b9 f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rcx
+  803ca7:	ff ff ff 
+  803caa:	48 01 d9             	add    %rbx,%rcx
+  803cad:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803caf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803cb4:	eb 2a                	jmp    803ce0 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803cb6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cba:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803cbe:	48 85 c0             	test   %rax,%rax
+  803cc1:	75 07                	jne    803cca <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803cc3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803cc8:	eb 16                	jmp    803ce0 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803cca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cce:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803cd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cd6:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803cd9:	89 d6                	mov    %edx,%esi
+  803cdb:	48 89 c7             	mov    %rax,%rdi
+  803cde:	ff d1                	call   *%rcx
+}
+  803ce0:	48 83 c4 30          	add    $0x30,%rsp
+  803ce4:	5b                   	pop    %rbx
+  803ce5:	41 5f                	pop    %r15
+  803ce7:	5d                   	pop    %rbp
+  803ce8:	c3                   	ret
+
+0000000000803ce9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803ce9:	55                   	push   %rbp
+  803cea:	48 89 e5             	mov    %rsp,%rbp
+  803ced:	53                   	push   %rbx
+  803cee:	48 83 ec 38          	sub    $0x38,%rsp
+  803cf2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cf2 <fstat+0x9>
+  803cf9:	49 bb 4e 63 00 00 00 	movabs $0x634e,%r11
+  803d00:	00 00 00 
+  803d03:	4c 01 db             	add    %r11,%rbx
+  803d06:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803d09:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803d0d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803d11:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803d14:	48 89 d6             	mov    %rdx,%rsi
+  803d17:	89 c7                	mov    %eax,%edi
+  803d19:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  803d20:	ff ff ff 
+  803d23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d27:	ff d0                	call   *%rax
+  803d29:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d2c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d30:	78 28                	js     803d5a <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d36:	8b 00                	mov    (%rax),%eax
+  803d38:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803d3c:	48 89 d6             	mov    %rdx,%rsi
+  803d3f:	89 c7                	mov    %eax,%edi
+  803d41:	48 b8 ed 94 ff ff ff 	movabs $0xffffffffffff94ed,%rax
+  803d48:	ff ff ff 
+  803d4b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d4f:	ff d0                	call   *%rax
+  803d51:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d54:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d58:	79 05                	jns    803d5f <fstat+0x76>
+		return r;
+  803d5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d5d:	eb 5e                	jmp    803dbd <fstat+0xd4>
+	if (!dev->dev_stat)
+  803d5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d63:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803d67:	48 85 c0             	test   %rax,%rax
+  803d6a:	75 07                	jne    803d73 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803d6c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803d71:	eb 4a                	jmp    803dbd <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803d73:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d77:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803d7a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d7e:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803d85:	00 00 00 
+	stat->st_isdir = 0;
+  803d88:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d8c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803d93:	00 00 00 
+	stat->st_dev = dev;
+  803d96:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d9a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d9e:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  803da5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803da9:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803dad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803db1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803db5:	48 89 d6             	mov    %rdx,%rsi
+  803db8:	48 89 c7             	mov    %rax,%rdi
+  803dbb:	ff d1                	call   *%rcx
+}
+  803dbd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803dc1:	c9                   	leave
+  803dc2:	c3                   	ret
+
+0000000000803dc3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803dc3:	55                   	push   %rbp
+  803dc4:	48 89 e5             	mov    %rsp,%rbp
+  803dc7:	41 57                	push   %r15
+  803dc9:	53                   	push   %rbx
+  803dca:	48 83 ec 20          	sub    $0x20,%rsp
+  803dce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803dce <stat+0xb>
+  803dd5:	49 bb 72 62 00 00 00 	movabs $0x6272,%r11
+  803ddc:	00 00 00 
+  803ddf:	4c 01 db             	add    %r11,%rbx
+  803de2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803de6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803dea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dee:	be 00 00 00 00       	mov    $0x0,%esi
+  803df3:	48 89 c7             	mov    %rax,%rdi
+  803df6:	49 89 df             	mov    %rbx,%r15
+  803df9:	48 b8 5d a0 ff ff ff 	movabs $0xffffffffffffa05d,%rax
+  803e00:	ff ff ff 
+  803e03:	48 01 d8             	add    %rbx,%rax
+  803e06:	ff d0                	call   *%rax
+  803e08:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e0b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e0f:	79 05                	jns    803e16 <stat+0x53>
+		return fd;
+  803e11:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e14:	eb 37                	jmp    803e4d <stat+0x8a>
+	r = fstat(fd, stat);
+  803e16:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e1d:	48 89 d6             	mov    %rdx,%rsi
+  803e20:	89 c7                	mov    %eax,%edi
+  803e22:	48 b8 a9 9c ff ff ff 	movabs $0xffffffffffff9ca9,%rax
+  803e29:	ff ff ff 
+  803e2c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e30:	ff d0                	call   *%rax
+  803e32:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803e35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e38:	89 c7                	mov    %eax,%edi
+  803e3a:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  803e41:	ff ff ff 
+  803e44:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e48:	ff d0                	call   *%rax
+	return r;
+  803e4a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803e4d:	48 83 c4 20          	add    $0x20,%rsp
+  803e51:	5b                   	pop    %rbx
+  803e52:	41 5f                	pop    %r15
+  803e54:	5d                   	pop    %rbp
+  803e55:	c3                   	ret
+
+0000000000803e56 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803e56:	55                   	push   %rbp
+  803e57:	48 89 e5             	mov    %rsp,%rbp
+  803e5a:	41 57                	push   %r15
+  803e5c:	53                   	push   %rbx
+  803e5d:	48 83 ec 10          	sub    $0x10,%rsp
+  803e61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e61 <fsipc+0xb>
+  803e68:	49 bb df 61 00 00 00 	movabs $0x61df,%r11
+  803e6f:	00 00 00 
+  803e72:	4c 01 db             	add    %r11,%rbx
+  803e75:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e78:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803e7c:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803e83:	00 00 00 
+  803e86:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803e89:	85 c0                	test   %eax,%eax
+  803e8b:	75 24                	jne    803eb1 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803e8d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e92:	49 89 df             	mov    %rbx,%r15
+  803e95:	48 b8 c9 d1 ff ff ff 	movabs $0xffffffffffffd1c9,%rax
+  803e9c:	ff ff ff 
+  803e9f:	48 01 d8             	add    %rbx,%rax
+  803ea2:	ff d0                	call   *%rax
+  803ea4:	48 ba c0 0f 00 00 00 	movabs $0xfc0,%rdx
+  803eab:	00 00 00 
+  803eae:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803eb1:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803eb8:	00 00 00 
+  803ebb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803ebe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ec2:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803ec5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803ecb:	49 89 d0             	mov    %rdx,%r8
+  803ece:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803ed3:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  803eda:	00 00 00 
+  803edd:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803ee1:	89 c7                	mov    %eax,%edi
+  803ee3:	49 89 df             	mov    %rbx,%r15
+  803ee6:	48 b8 e8 cb ff ff ff 	movabs $0xffffffffffffcbe8,%rax
+  803eed:	ff ff ff 
+  803ef0:	48 01 d8             	add    %rbx,%rax
+  803ef3:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803ef5:	48 83 c4 10          	add    $0x10,%rsp
+  803ef9:	5b                   	pop    %rbx
+  803efa:	41 5f                	pop    %r15
+  803efc:	5d                   	pop    %rbp
+  803efd:	c3                   	ret
+
+0000000000803efe <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803efe:	55                   	push   %rbp
+  803eff:	48 89 e5             	mov    %rsp,%rbp
+  803f02:	41 57                	push   %r15
+  803f04:	53                   	push   %rbx
+  803f05:	48 83 ec 20          	sub    $0x20,%rsp
+  803f09:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f09 <fsipc_words+0xb>
+  803f10:	49 bb 37 61 00 00 00 	movabs $0x6137,%r11
+  803f17:	00 00 00 
+  803f1a:	4c 01 db             	add    %r11,%rbx
+  803f1d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f20:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803f24:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803f28:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803f2f:	00 00 00 
+  803f32:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803f35:	85 c0                	test   %eax,%eax
+  803f37:	75 24                	jne    803f5d <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803f39:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f3e:	49 89 df             	mov    %rbx,%r15
+  803f41:	48 b8 c9 d1 ff ff ff 	movabs $0xffffffffffffd1c9,%rax
+  803f48:	ff ff ff 
+  803f4b:	48 01 d8             	add    %rbx,%rax
+  803f4e:	ff d0                	call   *%rax
+  803f50:	48 ba c0 0f 00 00 00 	movabs $0xfc0,%rdx
+  803f57:	00 00 00 
+  803f5a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803f5d:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803f64:	00 00 00 
+  803f67:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803f6a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803f6e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803f72:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803f75:	89 c7                	mov    %eax,%edi
+  803f77:	49 89 df             	mov    %rbx,%r15
+  803f7a:	48 b8 d3 cc ff ff ff 	movabs $0xffffffffffffccd3,%rax
+  803f81:	ff ff ff 
+  803f84:	48 01 d8             	add    %rbx,%rax
+  803f87:	ff d0                	call   *%rax
+}
+  803f89:	48 83 c4 20          	add    $0x20,%rsp
+  803f8d:	5b                   	pop    %rbx
+  803f8e:	41 5f                	pop    %r15
+  803f90:	5d                   	pop    %rbp
+  803f91:	c3                   	ret
+
+0000000000803f92 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803f92:	55                   	push   %rbp
+  803f93:	48 89 e5             	mov    %rsp,%rbp
+  803f96:	41 57                	push   %r15
+  803f98:	53                   	push   %rbx
+  803f99:	48 83 ec 40          	sub    $0x40,%rsp
+  803f9d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f9d <fsipc_pages+0xb>
+  803fa4:	49 bb a3 60 00 00 00 	movabs $0x60a3,%r11
+  803fab:	00 00 00 
+  803fae:	4c 01 db             	add    %r11,%rbx
+  803fb1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803fb4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803fb8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803fbc:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803fbf:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803fc6:	00 00 00 
+  803fc9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803fcc:	85 c0                	test   %eax,%eax
+  803fce:	75 24                	jne    803ff4 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803fd0:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fd5:	49 89 df             	mov    %rbx,%r15
+  803fd8:	48 b8 c9 d1 ff ff ff 	movabs $0xffffffffffffd1c9,%rax
+  803fdf:	ff ff ff 
+  803fe2:	48 01 d8             	add    %rbx,%rax
+  803fe5:	ff d0                	call   *%rax
+  803fe7:	48 ba c0 0f 00 00 00 	movabs $0xfc0,%rdx
+  803fee:	00 00 00 
+  803ff1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803ff4:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803ff9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803ffd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804000:	48 98                	cltq
+  804002:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804006:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80400a:	0f 95 c0             	setne  %al
+  80400d:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804010:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804017:	00 
+  804018:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80401c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804020:	48 01 d0             	add    %rdx,%rax
+  804023:	48 83 e8 01          	sub    $0x1,%rax
+  804027:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80402b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80402f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804034:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804038:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80403c:	48 29 d0             	sub    %rdx,%rax
+  80403f:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804043:	41 89 c2             	mov    %eax,%r10d
+  804046:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  80404d:	00 00 00 
+  804050:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804053:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804057:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80405b:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80405e:	48 83 ec 08          	sub    $0x8,%rsp
+  804062:	6a 40                	push   $0x40
+  804064:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804069:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804070:	00 
+  804071:	6a 05                	push   $0x5
+  804073:	41 89 f9             	mov    %edi,%r9d
+  804076:	49 89 c8             	mov    %rcx,%r8
+  804079:	44 89 d1             	mov    %r10d,%ecx
+  80407c:	89 c7                	mov    %eax,%edi
+  80407e:	49 89 df             	mov    %rbx,%r15
+  804081:	48 b8 d1 cd ff ff ff 	movabs $0xffffffffffffcdd1,%rax
+  804088:	ff ff ff 
+  80408b:	48 01 d8             	add    %rbx,%rax
+  80408e:	ff d0                	call   *%rax
+  804090:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804094:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804098:	5b                   	pop    %rbx
+  804099:	41 5f                	pop    %r15
+  80409b:	5d                   	pop    %rbp
+  80409c:	c3                   	ret
+
+000000000080409d <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  80409d:	55                   	push   %rbp
+  80409e:	48 89 e5             	mov    %rsp,%rbp
+  8040a1:	41 57                	push   %r15
+  8040a3:	53                   	push   %rbx
+  8040a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8040a8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040a8 <open+0xb>
+  8040af:	49 bb 98 5f 00 00 00 	movabs $0x5f98,%r11
+  8040b6:	00 00 00 
+  8040b9:	4c 01 db             	add    %r11,%rbx
+  8040bc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8040c0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8040c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040c7:	48 89 c7             	mov    %rax,%rdi
+  8040ca:	49 89 df             	mov    %rbx,%r15
+  8040cd:	48 b8 1e 7d ff ff ff 	movabs $0xffffffffffff7d1e,%rax
+  8040d4:	ff ff ff 
+  8040d7:	48 01 d8             	add    %rbx,%rax
+  8040da:	ff d0                	call   *%rax
+  8040dc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8040e1:	7e 0a                	jle    8040ed <open+0x50>
+		return -E_BAD_PATH;
+  8040e3:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8040e8:	e9 18 01 00 00       	jmp    804205 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8040ed:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8040f1:	48 89 c7             	mov    %rax,%rdi
+  8040f4:	49 89 df             	mov    %rbx,%r15
+  8040f7:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  8040fe:	ff ff ff 
+  804101:	48 01 d8             	add    %rbx,%rax
+  804104:	ff d0                	call   *%rax
+  804106:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804109:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80410d:	74 08                	je     804117 <open+0x7a>
+		return r;
+  80410f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804112:	e9 ee 00 00 00       	jmp    804205 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804117:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80411e:	00 00 00 
+  804121:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804124:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80412b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80412f:	48 89 c6             	mov    %rax,%rsi
+  804132:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804139:	00 00 00 
+  80413c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804140:	48 89 c7             	mov    %rax,%rdi
+  804143:	49 89 df             	mov    %rbx,%r15
+  804146:	48 b8 b2 7d ff ff ff 	movabs $0xffffffffffff7db2,%rax
+  80414d:	ff ff ff 
+  804150:	48 01 d8             	add    %rbx,%rax
+  804153:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804155:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804159:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  80415e:	48 89 c6             	mov    %rax,%rsi
+  804161:	bf 00 00 00 00       	mov    $0x0,%edi
+  804166:	49 89 df             	mov    %rbx,%r15
+  804169:	48 b8 6e 8a ff ff ff 	movabs $0xffffffffffff8a6e,%rax
+  804170:	ff ff ff 
+  804173:	48 01 d8             	add    %rbx,%rax
+  804176:	ff d0                	call   *%rax
+  804178:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80417b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80417f:	74 23                	je     8041a4 <open+0x107>
+		fd_close(fd,0);
+  804181:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804185:	be 00 00 00 00       	mov    $0x0,%esi
+  80418a:	48 89 c7             	mov    %rax,%rdi
+  80418d:	49 89 df             	mov    %rbx,%r15
+  804190:	48 b8 f2 93 ff ff ff 	movabs $0xffffffffffff93f2,%rax
+  804197:	ff ff ff 
+  80419a:	48 01 d8             	add    %rbx,%rax
+  80419d:	ff d0                	call   *%rax
+		return r;
+  80419f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041a2:	eb 61                	jmp    804205 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8041a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041a8:	48 89 c6             	mov    %rax,%rsi
+  8041ab:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041b0:	48 b8 16 9e ff ff ff 	movabs $0xffffffffffff9e16,%rax
+  8041b7:	ff ff ff 
+  8041ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041be:	ff d0                	call   *%rax
+  8041c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041c7:	74 23                	je     8041ec <open+0x14f>
+		fd_close(fd,0);
+  8041c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8041d2:	48 89 c7             	mov    %rax,%rdi
+  8041d5:	49 89 df             	mov    %rbx,%r15
+  8041d8:	48 b8 f2 93 ff ff ff 	movabs $0xffffffffffff93f2,%rax
+  8041df:	ff ff ff 
+  8041e2:	48 01 d8             	add    %rbx,%rax
+  8041e5:	ff d0                	call   *%rax
+		return r;
+  8041e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041ea:	eb 19                	jmp    804205 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8041ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041f0:	48 89 c7             	mov    %rax,%rdi
+  8041f3:	49 89 df             	mov    %rbx,%r15
+  8041f6:	48 b8 17 92 ff ff ff 	movabs $0xffffffffffff9217,%rax
+  8041fd:	ff ff ff 
+  804200:	48 01 d8             	add    %rbx,%rax
+  804203:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804205:	48 83 c4 20          	add    $0x20,%rsp
+  804209:	5b                   	pop    %rbx
+  80420a:	41 5f                	pop    %r15
+  80420c:	5d                   	pop    %rbp
+  80420d:	c3                   	ret
+
+000000000080420e <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  80420e:	55                   	push   %rbp
+  80420f:	48 89 e5             	mov    %rsp,%rbp
+  804212:	48 83 ec 20          	sub    $0x20,%rsp
+  804216:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804216 <devfile_flush+0x8>
+  80421d:	49 bb 2a 5e 00 00 00 	movabs $0x5e2a,%r11
+  804224:	00 00 00 
+  804227:	4c 01 d8             	add    %r11,%rax
+  80422a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  80422e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804232:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804235:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804238:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80423c:	ba 04 00 00 00       	mov    $0x4,%edx
+  804241:	48 89 ce             	mov    %rcx,%rsi
+  804244:	bf 06 00 00 00       	mov    $0x6,%edi
+  804249:	48 b9 be 9e ff ff ff 	movabs $0xffffffffffff9ebe,%rcx
+  804250:	ff ff ff 
+  804253:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804257:	ff d0                	call   *%rax
+}
+  804259:	c9                   	leave
+  80425a:	c3                   	ret
+
+000000000080425b <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  80425b:	55                   	push   %rbp
+  80425c:	48 89 e5             	mov    %rsp,%rbp
+  80425f:	41 57                	push   %r15
+  804261:	53                   	push   %rbx
+  804262:	48 83 ec 60          	sub    $0x60,%rsp
+  804266:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804266 <devfile_read+0xb>
+  80426d:	49 bb da 5d 00 00 00 	movabs $0x5dda,%r11
+  804274:	00 00 00 
+  804277:	4c 01 db             	add    %r11,%rbx
+  80427a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80427e:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804282:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804286:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80428a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  80428e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804292:	8b 50 0c             	mov    0xc(%rax),%edx
+  804295:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804299:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80429b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80429f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8042a3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8042a7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8042ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8042b0:	ba 10 00 00 00       	mov    $0x10,%edx
+  8042b5:	48 89 c6             	mov    %rax,%rsi
+  8042b8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8042bd:	48 b8 52 9f ff ff ff 	movabs $0xffffffffffff9f52,%rax
+  8042c4:	ff ff ff 
+  8042c7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042cb:	ff d0                	call   *%rax
+  8042cd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8042d0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8042d4:	79 05                	jns    8042db <devfile_read+0x80>
+		return r;
+  8042d6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8042d9:	eb 64                	jmp    80433f <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8042db:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8042de:	48 63 d0             	movslq %eax,%rdx
+  8042e1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8042e5:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8042ea:	48 01 c1             	add    %rax,%rcx
+  8042ed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8042f1:	48 89 ce             	mov    %rcx,%rsi
+  8042f4:	48 89 c7             	mov    %rax,%rdi
+  8042f7:	49 89 df             	mov    %rbx,%r15
+  8042fa:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  804301:	ff ff ff 
+  804304:	48 01 d8             	add    %rbx,%rax
+  804307:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804309:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804310:	ff ff ff 
+  804313:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804317:	48 8b 00             	mov    (%rax),%rax
+  80431a:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804320:	89 c6                	mov    %eax,%esi
+  804322:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804327:	48 89 c7             	mov    %rax,%rdi
+  80432a:	49 89 df             	mov    %rbx,%r15
+  80432d:	48 b8 83 d1 ff ff ff 	movabs $0xffffffffffffd183,%rax
+  804334:	ff ff ff 
+  804337:	48 01 d8             	add    %rbx,%rax
+  80433a:	ff d0                	call   *%rax
+	return r;
+  80433c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  80433f:	48 83 c4 60          	add    $0x60,%rsp
+  804343:	5b                   	pop    %rbx
+  804344:	41 5f                	pop    %r15
+  804346:	5d                   	pop    %rbp
+  804347:	c3                   	ret
+
+0000000000804348 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804348:	55                   	push   %rbp
+  804349:	48 89 e5             	mov    %rsp,%rbp
+  80434c:	41 57                	push   %r15
+  80434e:	53                   	push   %rbx
+  80434f:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804353:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804353 <devfile_write+0xb>
+  80435a:	49 bb ed 5c 00 00 00 	movabs $0x5ced,%r11
+  804361:	00 00 00 
+  804364:	4c 01 db             	add    %r11,%rbx
+  804367:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80436b:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  80436f:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804376:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80437a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  80437e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804385:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804389:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804390:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804393:	48 63 d0             	movslq %eax,%rdx
+  804396:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80439a:	48 39 c2             	cmp    %rax,%rdx
+  80439d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8043a1:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8043a8:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  8043af:	00 
+  8043b0:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8043b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043bb:	48 01 d0             	add    %rdx,%rax
+  8043be:	48 83 e8 01          	sub    $0x1,%rax
+  8043c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8043c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043cf:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8043d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043d7:	48 29 d0             	sub    %rdx,%rax
+  8043da:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043de:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8043e1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8043e4:	89 c6                	mov    %eax,%esi
+  8043e6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8043eb:	48 89 c7             	mov    %rax,%rdi
+  8043ee:	49 89 df             	mov    %rbx,%r15
+  8043f1:	48 b8 3d d1 ff ff ff 	movabs $0xffffffffffffd13d,%rax
+  8043f8:	ff ff ff 
+  8043fb:	48 01 d8             	add    %rbx,%rax
+  8043fe:	ff d0                	call   *%rax
+  804400:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804403:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804407:	79 08                	jns    804411 <devfile_write+0xc9>
+		return r;
+  804409:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  80440c:	e9 8f 00 00 00       	jmp    8044a0 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804411:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804418:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  80441c:	48 89 c6             	mov    %rax,%rsi
+  80441f:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804424:	48 89 c7             	mov    %rax,%rdi
+  804427:	49 89 df             	mov    %rbx,%r15
+  80442a:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  804431:	ff ff ff 
+  804434:	48 01 d8             	add    %rbx,%rax
+  804437:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804439:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80443d:	8b 50 0c             	mov    0xc(%rax),%edx
+  804440:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804444:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804446:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80444a:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804451:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804455:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804458:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80445c:	89 d1                	mov    %edx,%ecx
+  80445e:	ba 10 00 00 00       	mov    $0x10,%edx
+  804463:	48 89 c6             	mov    %rax,%rsi
+  804466:	bf 04 00 00 00       	mov    $0x4,%edi
+  80446b:	48 b8 52 9f ff ff ff 	movabs $0xffffffffffff9f52,%rax
+  804472:	ff ff ff 
+  804475:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804479:	ff d0                	call   *%rax
+  80447b:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80447e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804481:	89 c6                	mov    %eax,%esi
+  804483:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804488:	48 89 c7             	mov    %rax,%rdi
+  80448b:	49 89 df             	mov    %rbx,%r15
+  80448e:	48 b8 83 d1 ff ff ff 	movabs $0xffffffffffffd183,%rax
+  804495:	ff ff ff 
+  804498:	48 01 d8             	add    %rbx,%rax
+  80449b:	ff d0                	call   *%rax
+	return r;
+  80449d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  8044a0:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  8044a4:	5b                   	pop    %rbx
+  8044a5:	41 5f                	pop    %r15
+  8044a7:	5d                   	pop    %rbp
+  8044a8:	c3                   	ret
+
+00000000008044a9 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  8044a9:	55                   	push   %rbp
+  8044aa:	48 89 e5             	mov    %rsp,%rbp
+  8044ad:	41 57                	push   %r15
+  8044af:	53                   	push   %rbx
+  8044b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8044b4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044b4 <devfile_stat+0xb>
+  8044bb:	49 bb 8c 5b 00 00 00 	movabs $0x5b8c,%r11
+  8044c2:	00 00 00 
+  8044c5:	4c 01 db             	add    %r11,%rbx
+  8044c8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8044cc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8044d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044d4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8044d7:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8044de:	00 00 00 
+  8044e1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8044e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8044e9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8044ee:	48 b8 16 9e ff ff ff 	movabs $0xffffffffffff9e16,%rax
+  8044f5:	ff ff ff 
+  8044f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044fc:	ff d0                	call   *%rax
+  8044fe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804501:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804505:	79 05                	jns    80450c <devfile_stat+0x63>
+		return r;
+  804507:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80450a:	eb 65                	jmp    804571 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80450c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804510:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  804517:	00 00 00 
+  80451a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80451e:	48 89 d6             	mov    %rdx,%rsi
+  804521:	48 89 c7             	mov    %rax,%rdi
+  804524:	49 89 df             	mov    %rbx,%r15
+  804527:	48 b8 b2 7d ff ff ff 	movabs $0xffffffffffff7db2,%rax
+  80452e:	ff ff ff 
+  804531:	48 01 d8             	add    %rbx,%rax
+  804534:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804536:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80453d:	00 00 00 
+  804540:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804547:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80454b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804551:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804558:	00 00 00 
+  80455b:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804562:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804566:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  80456c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804571:	48 83 c4 20          	add    $0x20,%rsp
+  804575:	5b                   	pop    %rbx
+  804576:	41 5f                	pop    %r15
+  804578:	5d                   	pop    %rbp
+  804579:	c3                   	ret
+
+000000000080457a <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80457a:	55                   	push   %rbp
+  80457b:	48 89 e5             	mov    %rsp,%rbp
+  80457e:	48 83 ec 20          	sub    $0x20,%rsp
+  804582:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804582 <devfile_trunc+0x8>
+  804589:	49 bb be 5a 00 00 00 	movabs $0x5abe,%r11
+  804590:	00 00 00 
+  804593:	4c 01 d8             	add    %r11,%rax
+  804596:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80459a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80459d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045a1:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8045a4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  8045a7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8045aa:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8045ad:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8045b1:	ba 08 00 00 00       	mov    $0x8,%edx
+  8045b6:	48 89 ce             	mov    %rcx,%rsi
+  8045b9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8045be:	48 b9 be 9e ff ff ff 	movabs $0xffffffffffff9ebe,%rcx
+  8045c5:	ff ff ff 
+  8045c8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8045cc:	ff d0                	call   *%rax
+}
+  8045ce:	c9                   	leave
+  8045cf:	c3                   	ret
+
+00000000008045d0 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8045d0:	55                   	push   %rbp
+  8045d1:	48 89 e5             	mov    %rsp,%rbp
+  8045d4:	41 57                	push   %r15
+  8045d6:	53                   	push   %rbx
+  8045d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8045db:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045db <remove+0xb>
+  8045e2:	49 bb 65 5a 00 00 00 	movabs $0x5a65,%r11
+  8045e9:	00 00 00 
+  8045ec:	4c 01 db             	add    %r11,%rbx
+  8045ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8045f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045f7:	48 89 c7             	mov    %rax,%rdi
+  8045fa:	49 89 df             	mov    %rbx,%r15
+  8045fd:	48 b8 1e 7d ff ff ff 	movabs $0xffffffffffff7d1e,%rax
+  804604:	ff ff ff 
+  804607:	48 01 d8             	add    %rbx,%rax
+  80460a:	ff d0                	call   *%rax
+  80460c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804611:	7e 07                	jle    80461a <remove+0x4a>
+		return -E_BAD_PATH;
+  804613:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804618:	eb 44                	jmp    80465e <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80461a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80461e:	48 89 c6             	mov    %rax,%rsi
+  804621:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804628:	00 00 00 
+  80462b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80462f:	48 89 c7             	mov    %rax,%rdi
+  804632:	49 89 df             	mov    %rbx,%r15
+  804635:	48 b8 b2 7d ff ff ff 	movabs $0xffffffffffff7db2,%rax
+  80463c:	ff ff ff 
+  80463f:	48 01 d8             	add    %rbx,%rax
+  804642:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804644:	be 00 00 00 00       	mov    $0x0,%esi
+  804649:	bf 07 00 00 00       	mov    $0x7,%edi
+  80464e:	48 b8 16 9e ff ff ff 	movabs $0xffffffffffff9e16,%rax
+  804655:	ff ff ff 
+  804658:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80465c:	ff d0                	call   *%rax
+}
+  80465e:	48 83 c4 10          	add    $0x10,%rsp
+  804662:	5b                   	pop    %rbx
+  804663:	41 5f                	pop    %r15
+  804665:	5d                   	pop    %rbp
+  804666:	c3                   	ret
+
+0000000000804667 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804667:	55                   	push   %rbp
+  804668:	48 89 e5             	mov    %rsp,%rbp
+  80466b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80466b <sync+0x4>
+  804672:	49 bb d5 59 00 00 00 	movabs $0x59d5,%r11
+  804679:	00 00 00 
+  80467c:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80467f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804684:	be 00 00 00 00       	mov    $0x0,%esi
+  804689:	bf 08 00 00 00       	mov    $0x8,%edi
+  80468e:	48 b9 be 9e ff ff ff 	movabs $0xffffffffffff9ebe,%rcx
+  804695:	ff ff ff 
+  804698:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80469c:	ff d0                	call   *%rax
+}
+  80469e:	5d                   	pop    %rbp
+  80469f:	c3                   	ret
+
+00000000008046a0 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  8046a0:	55                   	push   %rbp
+  8046a1:	48 89 e5             	mov    %rsp,%rbp
+  8046a4:	41 57                	push   %r15
+  8046a6:	53                   	push   %rbx
+  8046a7:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8046ae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046ae <copy+0xe>
+  8046b5:	49 bb 92 59 00 00 00 	movabs $0x5992,%r11
+  8046bc:	00 00 00 
+  8046bf:	4c 01 db             	add    %r11,%rbx
+  8046c2:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8046c9:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8046d0:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8046d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8046dc:	48 89 c7             	mov    %rax,%rdi
+  8046df:	48 b8 5d a0 ff ff ff 	movabs $0xffffffffffffa05d,%rax
+  8046e6:	ff ff ff 
+  8046e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046ed:	ff d0                	call   *%rax
+  8046ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8046f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046f6:	79 35                	jns    80472d <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8046f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046fb:	89 c6                	mov    %eax,%esi
+  8046fd:	48 b8 7e df ff ff ff 	movabs $0xffffffffffffdf7e,%rax
+  804704:	ff ff ff 
+  804707:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80470b:	48 89 c7             	mov    %rax,%rdi
+  80470e:	49 89 df             	mov    %rbx,%r15
+  804711:	b8 00 00 00 00       	mov    $0x0,%eax
+  804716:	48 ba f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rdx
+  80471d:	ff ff ff 
+  804720:	48 01 da             	add    %rbx,%rdx
+  804723:	ff d2                	call   *%rdx
+		return fd_src;
+  804725:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804728:	e9 d7 01 00 00       	jmp    804904 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  80472d:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804734:	be 01 01 00 00       	mov    $0x101,%esi
+  804739:	48 89 c7             	mov    %rax,%rdi
+  80473c:	48 b8 5d a0 ff ff ff 	movabs $0xffffffffffffa05d,%rax
+  804743:	ff ff ff 
+  804746:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80474a:	ff d0                	call   *%rax
+  80474c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  80474f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804753:	0f 89 df 00 00 00    	jns    804838 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804759:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80475c:	89 c6                	mov    %eax,%esi
+  80475e:	48 b8 94 df ff ff ff 	movabs $0xffffffffffffdf94,%rax
+  804765:	ff ff ff 
+  804768:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80476c:	48 89 c7             	mov    %rax,%rdi
+  80476f:	49 89 df             	mov    %rbx,%r15
+  804772:	b8 00 00 00 00       	mov    $0x0,%eax
+  804777:	48 ba f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rdx
+  80477e:	ff ff ff 
+  804781:	48 01 da             	add    %rbx,%rdx
+  804784:	ff d2                	call   *%rdx
+		close(fd_src);
+  804786:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804789:	89 c7                	mov    %eax,%edi
+  80478b:	49 89 df             	mov    %rbx,%r15
+  80478e:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  804795:	ff ff ff 
+  804798:	48 01 d8             	add    %rbx,%rax
+  80479b:	ff d0                	call   *%rax
+		return fd_dest;
+  80479d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8047a0:	e9 5f 01 00 00       	jmp    804904 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  8047a5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8047a8:	48 63 d0             	movslq %eax,%rdx
+  8047ab:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8047b2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8047b5:	48 89 ce             	mov    %rcx,%rsi
+  8047b8:	89 c7                	mov    %eax,%edi
+  8047ba:	49 89 df             	mov    %rbx,%r15
+  8047bd:	48 b8 34 9a ff ff ff 	movabs $0xffffffffffff9a34,%rax
+  8047c4:	ff ff ff 
+  8047c7:	48 01 d8             	add    %rbx,%rax
+  8047ca:	ff d0                	call   *%rax
+  8047cc:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8047cf:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8047d3:	79 63                	jns    804838 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8047d5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8047d8:	89 c6                	mov    %eax,%esi
+  8047da:	48 b8 ae df ff ff ff 	movabs $0xffffffffffffdfae,%rax
+  8047e1:	ff ff ff 
+  8047e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047e8:	48 89 c7             	mov    %rax,%rdi
+  8047eb:	49 89 df             	mov    %rbx,%r15
+  8047ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f3:	48 ba f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rdx
+  8047fa:	ff ff ff 
+  8047fd:	48 01 da             	add    %rbx,%rdx
+  804800:	ff d2                	call   *%rdx
+			close(fd_src);
+  804802:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804805:	89 c7                	mov    %eax,%edi
+  804807:	49 89 df             	mov    %rbx,%r15
+  80480a:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  804811:	ff ff ff 
+  804814:	48 01 d8             	add    %rbx,%rax
+  804817:	ff d0                	call   *%rax
+			close(fd_dest);
+  804819:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80481c:	89 c7                	mov    %eax,%edi
+  80481e:	49 89 df             	mov    %rbx,%r15
+  804821:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  804828:	ff ff ff 
+  80482b:	48 01 d8             	add    %rbx,%rax
+  80482e:	ff d0                	call   *%rax
+			return write_size;
+  804830:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804833:	e9 cc 00 00 00       	jmp    804904 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804838:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80483f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804842:	ba 00 02 00 00       	mov    $0x200,%edx
+  804847:	48 89 ce             	mov    %rcx,%rsi
+  80484a:	89 c7                	mov    %eax,%edi
+  80484c:	49 89 df             	mov    %rbx,%r15
+  80484f:	48 b8 8e 98 ff ff ff 	movabs $0xffffffffffff988e,%rax
+  804856:	ff ff ff 
+  804859:	48 01 d8             	add    %rbx,%rax
+  80485c:	ff d0                	call   *%rax
+  80485e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804861:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804865:	0f 8f 3a ff ff ff    	jg     8047a5 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  80486b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80486f:	79 60                	jns    8048d1 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804871:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804874:	89 c6                	mov    %eax,%esi
+  804876:	48 b8 c1 df ff ff ff 	movabs $0xffffffffffffdfc1,%rax
+  80487d:	ff ff ff 
+  804880:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804884:	48 89 c7             	mov    %rax,%rdi
+  804887:	49 89 df             	mov    %rbx,%r15
+  80488a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80488f:	48 ba f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%rdx
+  804896:	ff ff ff 
+  804899:	48 01 da             	add    %rbx,%rdx
+  80489c:	ff d2                	call   *%rdx
+		close(fd_src);
+  80489e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048a1:	89 c7                	mov    %eax,%edi
+  8048a3:	49 89 df             	mov    %rbx,%r15
+  8048a6:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  8048ad:	ff ff ff 
+  8048b0:	48 01 d8             	add    %rbx,%rax
+  8048b3:	ff d0                	call   *%rax
+		close(fd_dest);
+  8048b5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8048b8:	89 c7                	mov    %eax,%edi
+  8048ba:	49 89 df             	mov    %rbx,%r15
+  8048bd:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  8048c4:	ff ff ff 
+  8048c7:	48 01 d8             	add    %rbx,%rax
+  8048ca:	ff d0                	call   *%rax
+		return read_size;
+  8048cc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8048cf:	eb 33                	jmp    804904 <copy+0x264>
+	}
+	close(fd_src);
+  8048d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048d4:	89 c7                	mov    %eax,%edi
+  8048d6:	49 89 df             	mov    %rbx,%r15
+  8048d9:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  8048e0:	ff ff ff 
+  8048e3:	48 01 d8             	add    %rbx,%rax
+  8048e6:	ff d0                	call   *%rax
+	close(fd_dest);
+  8048e8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8048eb:	89 c7                	mov    %eax,%edi
+  8048ed:	49 89 df             	mov    %rbx,%r15
+  8048f0:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  8048f7:	ff ff ff 
+  8048fa:	48 01 d8             	add    %rbx,%rax
+  8048fd:	ff d0                	call   *%rax
+	return 0;
+  8048ff:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804904:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  80490b:	5b                   	pop    %rbx
+  80490c:	41 5f                	pop    %r15
+  80490e:	5d                   	pop    %rbp
+  80490f:	c3                   	ret
+
+0000000000804910 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804910:	55                   	push   %rbp
+  804911:	48 89 e5             	mov    %rsp,%rbp
+  804914:	41 57                	push   %r15
+  804916:	53                   	push   %rbx
+  804917:	48 83 ec 20          	sub    $0x20,%rsp
+  80491b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80491b <fd2sockid+0xb>
+  804922:	49 bb 25 57 00 00 00 	movabs $0x5725,%r11
+  804929:	00 00 00 
+  80492c:	4c 01 db             	add    %r11,%rbx
+  80492f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804932:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804936:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804939:	48 89 d6             	mov    %rdx,%rsi
+  80493c:	89 c7                	mov    %eax,%edi
+  80493e:	49 89 df             	mov    %rbx,%r15
+  804941:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  804948:	ff ff ff 
+  80494b:	48 01 d8             	add    %rbx,%rax
+  80494e:	ff d0                	call   *%rax
+  804950:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804953:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804957:	79 05                	jns    80495e <fd2sockid+0x4e>
+		return r;
+  804959:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80495c:	eb 25                	jmp    804983 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80495e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804962:	8b 10                	mov    (%rax),%edx
+  804964:	48 b8 c0 00 00 00 00 	movabs $0xc0,%rax
+  80496b:	00 00 00 
+  80496e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804971:	39 c2                	cmp    %eax,%edx
+  804973:	74 07                	je     80497c <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804975:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80497a:	eb 07                	jmp    804983 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  80497c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804980:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804983:	48 83 c4 20          	add    $0x20,%rsp
+  804987:	5b                   	pop    %rbx
+  804988:	41 5f                	pop    %r15
+  80498a:	5d                   	pop    %rbp
+  80498b:	c3                   	ret
+
+000000000080498c <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  80498c:	55                   	push   %rbp
+  80498d:	48 89 e5             	mov    %rsp,%rbp
+  804990:	41 57                	push   %r15
+  804992:	53                   	push   %rbx
+  804993:	48 83 ec 20          	sub    $0x20,%rsp
+  804997:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804997 <alloc_sockfd+0xb>
+  80499e:	49 bb a9 56 00 00 00 	movabs $0x56a9,%r11
+  8049a5:	00 00 00 
+  8049a8:	4c 01 db             	add    %r11,%rbx
+  8049ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8049ae:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8049b2:	48 89 c7             	mov    %rax,%rdi
+  8049b5:	49 89 df             	mov    %rbx,%r15
+  8049b8:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  8049bf:	ff ff ff 
+  8049c2:	48 01 d8             	add    %rbx,%rax
+  8049c5:	ff d0                	call   *%rax
+  8049c7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049ce:	78 2c                	js     8049fc <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8049d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049d4:	ba 07 04 00 00       	mov    $0x407,%edx
+  8049d9:	48 89 c6             	mov    %rax,%rsi
+  8049dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049e1:	49 89 df             	mov    %rbx,%r15
+  8049e4:	48 b8 6e 8a ff ff ff 	movabs $0xffffffffffff8a6e,%rax
+  8049eb:	ff ff ff 
+  8049ee:	48 01 d8             	add    %rbx,%rax
+  8049f1:	ff d0                	call   *%rax
+  8049f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049fa:	79 1c                	jns    804a18 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8049fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8049ff:	89 c7                	mov    %eax,%edi
+  804a01:	49 89 df             	mov    %rbx,%r15
+  804a04:	48 b8 40 b1 ff ff ff 	movabs $0xffffffffffffb140,%rax
+  804a0b:	ff ff ff 
+  804a0e:	48 01 d8             	add    %rbx,%rax
+  804a11:	ff d0                	call   *%rax
+		return r;
+  804a13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a16:	eb 41                	jmp    804a59 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804a18:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a1c:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  804a23:	00 00 00 
+  804a26:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804a29:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804a2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a2f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804a36:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a3a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804a3d:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804a40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a44:	48 89 c7             	mov    %rax,%rdi
+  804a47:	49 89 df             	mov    %rbx,%r15
+  804a4a:	48 b8 17 92 ff ff ff 	movabs $0xffffffffffff9217,%rax
+  804a51:	ff ff ff 
+  804a54:	48 01 d8             	add    %rbx,%rax
+  804a57:	ff d0                	call   *%rax
+}
+  804a59:	48 83 c4 20          	add    $0x20,%rsp
+  804a5d:	5b                   	pop    %rbx
+  804a5e:	41 5f                	pop    %r15
+  804a60:	5d                   	pop    %rbp
+  804a61:	c3                   	ret
+
+0000000000804a62 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804a62:	55                   	push   %rbp
+  804a63:	48 89 e5             	mov    %rsp,%rbp
+  804a66:	41 57                	push   %r15
+  804a68:	53                   	push   %rbx
+  804a69:	48 83 ec 30          	sub    $0x30,%rsp
+  804a6d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a6d <accept+0xb>
+  804a74:	49 bb d3 55 00 00 00 	movabs $0x55d3,%r11
+  804a7b:	00 00 00 
+  804a7e:	4c 01 db             	add    %r11,%rbx
+  804a81:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804a84:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a88:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804a8c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a8f:	89 c7                	mov    %eax,%edi
+  804a91:	48 b8 d0 a8 ff ff ff 	movabs $0xffffffffffffa8d0,%rax
+  804a98:	ff ff ff 
+  804a9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a9f:	ff d0                	call   *%rax
+  804aa1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804aa4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804aa8:	79 05                	jns    804aaf <accept+0x4d>
+		return r;
+  804aaa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aad:	eb 45                	jmp    804af4 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804aaf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ab3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804ab7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aba:	48 89 ce             	mov    %rcx,%rsi
+  804abd:	89 c7                	mov    %eax,%edi
+  804abf:	49 89 df             	mov    %rbx,%r15
+  804ac2:	48 b8 ae af ff ff ff 	movabs $0xffffffffffffafae,%rax
+  804ac9:	ff ff ff 
+  804acc:	48 01 d8             	add    %rbx,%rax
+  804acf:	ff d0                	call   *%rax
+  804ad1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ad4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ad8:	79 05                	jns    804adf <accept+0x7d>
+		return r;
+  804ada:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804add:	eb 15                	jmp    804af4 <accept+0x92>
+	return alloc_sockfd(r);
+  804adf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ae2:	89 c7                	mov    %eax,%edi
+  804ae4:	48 b8 4c a9 ff ff ff 	movabs $0xffffffffffffa94c,%rax
+  804aeb:	ff ff ff 
+  804aee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804af2:	ff d0                	call   *%rax
+}
+  804af4:	48 83 c4 30          	add    $0x30,%rsp
+  804af8:	5b                   	pop    %rbx
+  804af9:	41 5f                	pop    %r15
+  804afb:	5d                   	pop    %rbp
+  804afc:	c3                   	ret
+
+0000000000804afd <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804afd:	55                   	push   %rbp
+  804afe:	48 89 e5             	mov    %rsp,%rbp
+  804b01:	41 57                	push   %r15
+  804b03:	53                   	push   %rbx
+  804b04:	48 83 ec 20          	sub    $0x20,%rsp
+  804b08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b08 <bind+0xb>
+  804b0f:	49 bb 38 55 00 00 00 	movabs $0x5538,%r11
+  804b16:	00 00 00 
+  804b19:	4c 01 db             	add    %r11,%rbx
+  804b1c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804b1f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804b23:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804b26:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b29:	89 c7                	mov    %eax,%edi
+  804b2b:	48 b8 d0 a8 ff ff ff 	movabs $0xffffffffffffa8d0,%rax
+  804b32:	ff ff ff 
+  804b35:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b39:	ff d0                	call   *%rax
+  804b3b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b3e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b42:	79 05                	jns    804b49 <bind+0x4c>
+		return r;
+  804b44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b47:	eb 21                	jmp    804b6a <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804b49:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804b4c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804b50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b53:	48 89 ce             	mov    %rcx,%rsi
+  804b56:	89 c7                	mov    %eax,%edi
+  804b58:	49 89 df             	mov    %rbx,%r15
+  804b5b:	48 b8 5a b0 ff ff ff 	movabs $0xffffffffffffb05a,%rax
+  804b62:	ff ff ff 
+  804b65:	48 01 d8             	add    %rbx,%rax
+  804b68:	ff d0                	call   *%rax
+}
+  804b6a:	48 83 c4 20          	add    $0x20,%rsp
+  804b6e:	5b                   	pop    %rbx
+  804b6f:	41 5f                	pop    %r15
+  804b71:	5d                   	pop    %rbp
+  804b72:	c3                   	ret
+
+0000000000804b73 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804b73:	55                   	push   %rbp
+  804b74:	48 89 e5             	mov    %rsp,%rbp
+  804b77:	41 57                	push   %r15
+  804b79:	53                   	push   %rbx
+  804b7a:	48 83 ec 20          	sub    $0x20,%rsp
+  804b7e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b7e <shutdown+0xb>
+  804b85:	49 bb c2 54 00 00 00 	movabs $0x54c2,%r11
+  804b8c:	00 00 00 
+  804b8f:	4c 01 db             	add    %r11,%rbx
+  804b92:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804b95:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804b98:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b9b:	89 c7                	mov    %eax,%edi
+  804b9d:	48 b8 d0 a8 ff ff ff 	movabs $0xffffffffffffa8d0,%rax
+  804ba4:	ff ff ff 
+  804ba7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bab:	ff d0                	call   *%rax
+  804bad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bb0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804bb4:	79 05                	jns    804bbb <shutdown+0x48>
+		return r;
+  804bb6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bb9:	eb 1c                	jmp    804bd7 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804bbb:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804bbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bc1:	89 d6                	mov    %edx,%esi
+  804bc3:	89 c7                	mov    %eax,%edi
+  804bc5:	49 89 df             	mov    %rbx,%r15
+  804bc8:	48 b8 ef b0 ff ff ff 	movabs $0xffffffffffffb0ef,%rax
+  804bcf:	ff ff ff 
+  804bd2:	48 01 d8             	add    %rbx,%rax
+  804bd5:	ff d0                	call   *%rax
+}
+  804bd7:	48 83 c4 20          	add    $0x20,%rsp
+  804bdb:	5b                   	pop    %rbx
+  804bdc:	41 5f                	pop    %r15
+  804bde:	5d                   	pop    %rbp
+  804bdf:	c3                   	ret
+
+0000000000804be0 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804be0:	55                   	push   %rbp
+  804be1:	48 89 e5             	mov    %rsp,%rbp
+  804be4:	41 57                	push   %r15
+  804be6:	53                   	push   %rbx
+  804be7:	48 83 ec 10          	sub    $0x10,%rsp
+  804beb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804beb <devsock_close+0xb>
+  804bf2:	49 bb 55 54 00 00 00 	movabs $0x5455,%r11
+  804bf9:	00 00 00 
+  804bfc:	4c 01 db             	add    %r11,%rbx
+  804bff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804c03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c07:	48 89 c7             	mov    %rax,%rdi
+  804c0a:	49 89 df             	mov    %rbx,%r15
+  804c0d:	48 b8 58 d2 ff ff ff 	movabs $0xffffffffffffd258,%rax
+  804c14:	ff ff ff 
+  804c17:	48 01 d8             	add    %rbx,%rax
+  804c1a:	ff d0                	call   *%rax
+  804c1c:	83 f8 01             	cmp    $0x1,%eax
+  804c1f:	75 1d                	jne    804c3e <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804c21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c25:	8b 40 0c             	mov    0xc(%rax),%eax
+  804c28:	89 c7                	mov    %eax,%edi
+  804c2a:	49 89 df             	mov    %rbx,%r15
+  804c2d:	48 b8 40 b1 ff ff ff 	movabs $0xffffffffffffb140,%rax
+  804c34:	ff ff ff 
+  804c37:	48 01 d8             	add    %rbx,%rax
+  804c3a:	ff d0                	call   *%rax
+  804c3c:	eb 05                	jmp    804c43 <devsock_close+0x63>
+	else
+		return 0;
+  804c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c43:	48 83 c4 10          	add    $0x10,%rsp
+  804c47:	5b                   	pop    %rbx
+  804c48:	41 5f                	pop    %r15
+  804c4a:	5d                   	pop    %rbp
+  804c4b:	c3                   	ret
+
+0000000000804c4c <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804c4c:	55                   	push   %rbp
+  804c4d:	48 89 e5             	mov    %rsp,%rbp
+  804c50:	41 57                	push   %r15
+  804c52:	53                   	push   %rbx
+  804c53:	48 83 ec 20          	sub    $0x20,%rsp
+  804c57:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c57 <connect+0xb>
+  804c5e:	49 bb e9 53 00 00 00 	movabs $0x53e9,%r11
+  804c65:	00 00 00 
+  804c68:	4c 01 db             	add    %r11,%rbx
+  804c6b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804c6e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804c72:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804c75:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c78:	89 c7                	mov    %eax,%edi
+  804c7a:	48 b8 d0 a8 ff ff ff 	movabs $0xffffffffffffa8d0,%rax
+  804c81:	ff ff ff 
+  804c84:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c88:	ff d0                	call   *%rax
+  804c8a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c8d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c91:	79 05                	jns    804c98 <connect+0x4c>
+		return r;
+  804c93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c96:	eb 21                	jmp    804cb9 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804c98:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804c9b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804c9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ca2:	48 89 ce             	mov    %rcx,%rsi
+  804ca5:	89 c7                	mov    %eax,%edi
+  804ca7:	49 89 df             	mov    %rbx,%r15
+  804caa:	48 b8 88 b1 ff ff ff 	movabs $0xffffffffffffb188,%rax
+  804cb1:	ff ff ff 
+  804cb4:	48 01 d8             	add    %rbx,%rax
+  804cb7:	ff d0                	call   *%rax
+}
+  804cb9:	48 83 c4 20          	add    $0x20,%rsp
+  804cbd:	5b                   	pop    %rbx
+  804cbe:	41 5f                	pop    %r15
+  804cc0:	5d                   	pop    %rbp
+  804cc1:	c3                   	ret
+
+0000000000804cc2 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804cc2:	55                   	push   %rbp
+  804cc3:	48 89 e5             	mov    %rsp,%rbp
+  804cc6:	41 57                	push   %r15
+  804cc8:	53                   	push   %rbx
+  804cc9:	48 83 ec 20          	sub    $0x20,%rsp
+  804ccd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ccd <listen+0xb>
+  804cd4:	49 bb 73 53 00 00 00 	movabs $0x5373,%r11
+  804cdb:	00 00 00 
+  804cde:	4c 01 db             	add    %r11,%rbx
+  804ce1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804ce4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804ce7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804cea:	89 c7                	mov    %eax,%edi
+  804cec:	48 b8 d0 a8 ff ff ff 	movabs $0xffffffffffffa8d0,%rax
+  804cf3:	ff ff ff 
+  804cf6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cfa:	ff d0                	call   *%rax
+  804cfc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cff:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d03:	79 05                	jns    804d0a <listen+0x48>
+		return r;
+  804d05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d08:	eb 1c                	jmp    804d26 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804d0a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804d0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d10:	89 d6                	mov    %edx,%esi
+  804d12:	89 c7                	mov    %eax,%edi
+  804d14:	49 89 df             	mov    %rbx,%r15
+  804d17:	48 b8 1d b2 ff ff ff 	movabs $0xffffffffffffb21d,%rax
+  804d1e:	ff ff ff 
+  804d21:	48 01 d8             	add    %rbx,%rax
+  804d24:	ff d0                	call   *%rax
+}
+  804d26:	48 83 c4 20          	add    $0x20,%rsp
+  804d2a:	5b                   	pop    %rbx
+  804d2b:	41 5f                	pop    %r15
+  804d2d:	5d                   	pop    %rbp
+  804d2e:	c3                   	ret
+
+0000000000804d2f <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804d2f:	55                   	push   %rbp
+  804d30:	48 89 e5             	mov    %rsp,%rbp
+  804d33:	41 57                	push   %r15
+  804d35:	48 83 ec 28          	sub    $0x28,%rsp
+  804d39:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d39 <devsock_read+0xa>
+  804d40:	49 bb 07 53 00 00 00 	movabs $0x5307,%r11
+  804d47:	00 00 00 
+  804d4a:	4c 01 d8             	add    %r11,%rax
+  804d4d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d51:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804d55:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804d59:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804d5d:	41 89 d0             	mov    %edx,%r8d
+  804d60:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d64:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804d67:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804d6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d70:	44 89 c2             	mov    %r8d,%edx
+  804d73:	49 89 c7             	mov    %rax,%r15
+  804d76:	49 b8 6e b2 ff ff ff 	movabs $0xffffffffffffb26e,%r8
+  804d7d:	ff ff ff 
+  804d80:	49 01 c0             	add    %rax,%r8
+  804d83:	41 ff d0             	call   *%r8
+}
+  804d86:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804d8a:	c9                   	leave
+  804d8b:	c3                   	ret
+
+0000000000804d8c <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804d8c:	55                   	push   %rbp
+  804d8d:	48 89 e5             	mov    %rsp,%rbp
+  804d90:	41 57                	push   %r15
+  804d92:	48 83 ec 28          	sub    $0x28,%rsp
+  804d96:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d96 <devsock_write+0xa>
+  804d9d:	49 bb aa 52 00 00 00 	movabs $0x52aa,%r11
+  804da4:	00 00 00 
+  804da7:	4c 01 d8             	add    %r11,%rax
+  804daa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804dae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804db2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804db6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804dba:	41 89 d0             	mov    %edx,%r8d
+  804dbd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804dc1:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804dc4:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804dc8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804dcd:	44 89 c2             	mov    %r8d,%edx
+  804dd0:	49 89 c7             	mov    %rax,%r15
+  804dd3:	49 b8 8b b3 ff ff ff 	movabs $0xffffffffffffb38b,%r8
+  804dda:	ff ff ff 
+  804ddd:	49 01 c0             	add    %rax,%r8
+  804de0:	41 ff d0             	call   *%r8
+}
+  804de3:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804de7:	c9                   	leave
+  804de8:	c3                   	ret
+
+0000000000804de9 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  804de9:	55                   	push   %rbp
+  804dea:	48 89 e5             	mov    %rsp,%rbp
+  804ded:	41 57                	push   %r15
+  804def:	48 83 ec 18          	sub    $0x18,%rsp
+  804df3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804df3 <devsock_stat+0xa>
+  804dfa:	49 bb 4d 52 00 00 00 	movabs $0x524d,%r11
+  804e01:	00 00 00 
+  804e04:	4c 01 d8             	add    %r11,%rax
+  804e07:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e0b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804e0f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e13:	48 b9 dc df ff ff ff 	movabs $0xffffffffffffdfdc,%rcx
+  804e1a:	ff ff ff 
+  804e1d:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804e21:	48 89 ce             	mov    %rcx,%rsi
+  804e24:	48 89 d7             	mov    %rdx,%rdi
+  804e27:	49 89 c7             	mov    %rax,%r15
+  804e2a:	48 ba b2 7d ff ff ff 	movabs $0xffffffffffff7db2,%rdx
+  804e31:	ff ff ff 
+  804e34:	48 01 c2             	add    %rax,%rdx
+  804e37:	ff d2                	call   *%rdx
+	return 0;
+  804e39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e3e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804e42:	c9                   	leave
+  804e43:	c3                   	ret
+
+0000000000804e44 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804e44:	55                   	push   %rbp
+  804e45:	48 89 e5             	mov    %rsp,%rbp
+  804e48:	41 57                	push   %r15
+  804e4a:	53                   	push   %rbx
+  804e4b:	48 83 ec 20          	sub    $0x20,%rsp
+  804e4f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e4f <socket+0xb>
+  804e56:	49 bb f1 51 00 00 00 	movabs $0x51f1,%r11
+  804e5d:	00 00 00 
+  804e60:	4c 01 db             	add    %r11,%rbx
+  804e63:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e66:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804e69:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804e6c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804e6f:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804e72:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e75:	89 ce                	mov    %ecx,%esi
+  804e77:	89 c7                	mov    %eax,%edi
+  804e79:	49 89 df             	mov    %rbx,%r15
+  804e7c:	48 b8 62 b5 ff ff ff 	movabs $0xffffffffffffb562,%rax
+  804e83:	ff ff ff 
+  804e86:	48 01 d8             	add    %rbx,%rax
+  804e89:	ff d0                	call   *%rax
+  804e8b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e8e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e92:	79 05                	jns    804e99 <socket+0x55>
+		return r;
+  804e94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e97:	eb 15                	jmp    804eae <socket+0x6a>
+	return alloc_sockfd(r);
+  804e99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e9c:	89 c7                	mov    %eax,%edi
+  804e9e:	48 b8 4c a9 ff ff ff 	movabs $0xffffffffffffa94c,%rax
+  804ea5:	ff ff ff 
+  804ea8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804eac:	ff d0                	call   *%rax
+}
+  804eae:	48 83 c4 20          	add    $0x20,%rsp
+  804eb2:	5b                   	pop    %rbx
+  804eb3:	41 5f                	pop    %r15
+  804eb5:	5d                   	pop    %rbp
+  804eb6:	c3                   	ret
+
+0000000000804eb7 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  804eb7:	55                   	push   %rbp
+  804eb8:	48 89 e5             	mov    %rsp,%rbp
+  804ebb:	41 57                	push   %r15
+  804ebd:	53                   	push   %rbx
+  804ebe:	48 83 ec 10          	sub    $0x10,%rsp
+  804ec2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ec2 <nsipc+0xb>
+  804ec9:	49 bb 7e 51 00 00 00 	movabs $0x517e,%r11
+  804ed0:	00 00 00 
+  804ed3:	4c 01 db             	add    %r11,%rbx
+  804ed6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  804ed9:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  804ee0:	00 00 00 
+  804ee3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ee6:	85 c0                	test   %eax,%eax
+  804ee8:	75 24                	jne    804f0e <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804eea:	bf 02 00 00 00       	mov    $0x2,%edi
+  804eef:	49 89 df             	mov    %rbx,%r15
+  804ef2:	48 b8 c9 d1 ff ff ff 	movabs $0xffffffffffffd1c9,%rax
+  804ef9:	ff ff ff 
+  804efc:	48 01 d8             	add    %rbx,%rax
+  804eff:	ff d0                	call   *%rax
+  804f01:	48 ba c0 1f 01 00 00 	movabs $0x11fc0,%rdx
+  804f08:	00 00 00 
+  804f0b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804f0e:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  804f15:	00 00 00 
+  804f18:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f1b:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804f1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804f24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804f2a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804f2f:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804f36:	00 00 00 
+  804f39:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804f3d:	89 c7                	mov    %eax,%edi
+  804f3f:	49 89 df             	mov    %rbx,%r15
+  804f42:	48 b8 e8 cb ff ff ff 	movabs $0xffffffffffffcbe8,%rax
+  804f49:	ff ff ff 
+  804f4c:	48 01 d8             	add    %rbx,%rax
+  804f4f:	ff d0                	call   *%rax
+}
+  804f51:	48 83 c4 10          	add    $0x10,%rsp
+  804f55:	5b                   	pop    %rbx
+  804f56:	41 5f                	pop    %r15
+  804f58:	5d                   	pop    %rbp
+  804f59:	c3                   	ret
+
+0000000000804f5a <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804f5a:	55                   	push   %rbp
+  804f5b:	48 89 e5             	mov    %rsp,%rbp
+  804f5e:	41 57                	push   %r15
+  804f60:	53                   	push   %rbx
+  804f61:	48 83 ec 20          	sub    $0x20,%rsp
+  804f65:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f65 <nsipc_words+0xb>
+  804f6c:	49 bb db 50 00 00 00 	movabs $0x50db,%r11
+  804f73:	00 00 00 
+  804f76:	4c 01 db             	add    %r11,%rbx
+  804f79:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804f7c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804f80:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  804f84:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  804f8b:	00 00 00 
+  804f8e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f91:	85 c0                	test   %eax,%eax
+  804f93:	75 24                	jne    804fb9 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804f95:	bf 02 00 00 00       	mov    $0x2,%edi
+  804f9a:	49 89 df             	mov    %rbx,%r15
+  804f9d:	48 b8 c9 d1 ff ff ff 	movabs $0xffffffffffffd1c9,%rax
+  804fa4:	ff ff ff 
+  804fa7:	48 01 d8             	add    %rbx,%rax
+  804faa:	ff d0                	call   *%rax
+  804fac:	48 ba c0 1f 01 00 00 	movabs $0x11fc0,%rdx
+  804fb3:	00 00 00 
+  804fb6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804fb9:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  804fc0:	00 00 00 
+  804fc3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804fc6:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804fca:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804fce:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804fd1:	89 c7                	mov    %eax,%edi
+  804fd3:	49 89 df             	mov    %rbx,%r15
+  804fd6:	48 b8 d3 cc ff ff ff 	movabs $0xffffffffffffccd3,%rax
+  804fdd:	ff ff ff 
+  804fe0:	48 01 d8             	add    %rbx,%rax
+  804fe3:	ff d0                	call   *%rax
+}
+  804fe5:	48 83 c4 20          	add    $0x20,%rsp
+  804fe9:	5b                   	pop    %rbx
+  804fea:	41 5f                	pop    %r15
+  804fec:	5d                   	pop    %rbp
+  804fed:	c3                   	ret
+
+0000000000804fee <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804fee:	55                   	push   %rbp
+  804fef:	48 89 e5             	mov    %rsp,%rbp
+  804ff2:	41 57                	push   %r15
+  804ff4:	53                   	push   %rbx
+  804ff5:	48 83 ec 30          	sub    $0x30,%rsp
+  804ff9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ff9 <nsipc_accept+0xb>
+  805000:	49 bb 47 50 00 00 00 	movabs $0x5047,%r11
+  805007:	00 00 00 
+  80500a:	4c 01 db             	add    %r11,%rbx
+  80500d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805010:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805014:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805018:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80501f:	00 00 00 
+  805022:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805025:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805028:	bf 01 00 00 00       	mov    $0x1,%edi
+  80502d:	48 b8 77 ae ff ff ff 	movabs $0xffffffffffffae77,%rax
+  805034:	ff ff ff 
+  805037:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80503b:	ff d0                	call   *%rax
+  80503d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805040:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805044:	78 48                	js     80508e <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805046:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80504d:	00 00 00 
+  805050:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805054:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805058:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80505c:	8b 40 10             	mov    0x10(%rax),%eax
+  80505f:	89 c2                	mov    %eax,%edx
+  805061:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805065:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805069:	48 89 ce             	mov    %rcx,%rsi
+  80506c:	48 89 c7             	mov    %rax,%rdi
+  80506f:	49 89 df             	mov    %rbx,%r15
+  805072:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  805079:	ff ff ff 
+  80507c:	48 01 d8             	add    %rbx,%rax
+  80507f:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805081:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805085:	8b 50 10             	mov    0x10(%rax),%edx
+  805088:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80508c:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  80508e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805091:	48 83 c4 30          	add    $0x30,%rsp
+  805095:	5b                   	pop    %rbx
+  805096:	41 5f                	pop    %r15
+  805098:	5d                   	pop    %rbp
+  805099:	c3                   	ret
+
+000000000080509a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80509a:	55                   	push   %rbp
+  80509b:	48 89 e5             	mov    %rsp,%rbp
+  80509e:	41 57                	push   %r15
+  8050a0:	53                   	push   %rbx
+  8050a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8050a5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050a5 <nsipc_bind+0xb>
+  8050ac:	49 bb 9b 4f 00 00 00 	movabs $0x4f9b,%r11
+  8050b3:	00 00 00 
+  8050b6:	4c 01 db             	add    %r11,%rbx
+  8050b9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8050bc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8050c0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8050c3:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8050ca:	00 00 00 
+  8050cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050d0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8050d3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8050d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050da:	48 89 c6             	mov    %rax,%rsi
+  8050dd:	48 b8 c4 3f 01 00 00 	movabs $0x13fc4,%rax
+  8050e4:	00 00 00 
+  8050e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050eb:	48 89 c7             	mov    %rax,%rdi
+  8050ee:	49 89 df             	mov    %rbx,%r15
+  8050f1:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  8050f8:	ff ff ff 
+  8050fb:	48 01 d8             	add    %rbx,%rax
+  8050fe:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805100:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805107:	00 00 00 
+  80510a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80510d:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805111:	bf 02 00 00 00       	mov    $0x2,%edi
+  805116:	48 b8 77 ae ff ff ff 	movabs $0xffffffffffffae77,%rax
+  80511d:	ff ff ff 
+  805120:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805124:	ff d0                	call   *%rax
+}
+  805126:	48 83 c4 10          	add    $0x10,%rsp
+  80512a:	5b                   	pop    %rbx
+  80512b:	41 5f                	pop    %r15
+  80512d:	5d                   	pop    %rbp
+  80512e:	c3                   	ret
+
+000000000080512f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80512f:	55                   	push   %rbp
+  805130:	48 89 e5             	mov    %rsp,%rbp
+  805133:	48 83 ec 20          	sub    $0x20,%rsp
+  805137:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805137 <nsipc_shutdown+0x8>
+  80513e:	49 bb 09 4f 00 00 00 	movabs $0x4f09,%r11
+  805145:	00 00 00 
+  805148:	4c 01 d8             	add    %r11,%rax
+  80514b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80514e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805151:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805154:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805157:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80515a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80515d:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805161:	ba 08 00 00 00       	mov    $0x8,%edx
+  805166:	48 89 ce             	mov    %rcx,%rsi
+  805169:	bf 03 00 00 00       	mov    $0x3,%edi
+  80516e:	48 b9 1a af ff ff ff 	movabs $0xffffffffffffaf1a,%rcx
+  805175:	ff ff ff 
+  805178:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80517c:	ff d0                	call   *%rax
+}
+  80517e:	c9                   	leave
+  80517f:	c3                   	ret
+
+0000000000805180 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805180:	55                   	push   %rbp
+  805181:	48 89 e5             	mov    %rsp,%rbp
+  805184:	48 83 ec 20          	sub    $0x20,%rsp
+  805188:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805188 <nsipc_close+0x8>
+  80518f:	49 bb b8 4e 00 00 00 	movabs $0x4eb8,%r11
+  805196:	00 00 00 
+  805199:	4c 01 d8             	add    %r11,%rax
+  80519c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80519f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8051a2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8051a5:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8051a9:	ba 04 00 00 00       	mov    $0x4,%edx
+  8051ae:	48 89 ce             	mov    %rcx,%rsi
+  8051b1:	bf 04 00 00 00       	mov    $0x4,%edi
+  8051b6:	48 b9 1a af ff ff ff 	movabs $0xffffffffffffaf1a,%rcx
+  8051bd:	ff ff ff 
+  8051c0:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8051c4:	ff d0                	call   *%rax
+}
+  8051c6:	c9                   	leave
+  8051c7:	c3                   	ret
+
+00000000008051c8 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8051c8:	55                   	push   %rbp
+  8051c9:	48 89 e5             	mov    %rsp,%rbp
+  8051cc:	41 57                	push   %r15
+  8051ce:	53                   	push   %rbx
+  8051cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8051d3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051d3 <nsipc_connect+0xb>
+  8051da:	49 bb 6d 4e 00 00 00 	movabs $0x4e6d,%r11
+  8051e1:	00 00 00 
+  8051e4:	4c 01 db             	add    %r11,%rbx
+  8051e7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8051ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8051ee:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8051f1:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8051f8:	00 00 00 
+  8051fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051fe:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805201:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805204:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805208:	48 89 c6             	mov    %rax,%rsi
+  80520b:	48 b8 c4 3f 01 00 00 	movabs $0x13fc4,%rax
+  805212:	00 00 00 
+  805215:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805219:	48 89 c7             	mov    %rax,%rdi
+  80521c:	49 89 df             	mov    %rbx,%r15
+  80521f:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  805226:	ff ff ff 
+  805229:	48 01 d8             	add    %rbx,%rax
+  80522c:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  80522e:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805235:	00 00 00 
+  805238:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80523b:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  80523f:	bf 05 00 00 00       	mov    $0x5,%edi
+  805244:	48 b8 77 ae ff ff ff 	movabs $0xffffffffffffae77,%rax
+  80524b:	ff ff ff 
+  80524e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805252:	ff d0                	call   *%rax
+}
+  805254:	48 83 c4 10          	add    $0x10,%rsp
+  805258:	5b                   	pop    %rbx
+  805259:	41 5f                	pop    %r15
+  80525b:	5d                   	pop    %rbp
+  80525c:	c3                   	ret
+
+000000000080525d <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80525d:	55                   	push   %rbp
+  80525e:	48 89 e5             	mov    %rsp,%rbp
+  805261:	48 83 ec 20          	sub    $0x20,%rsp
+  805265:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805265 <nsipc_listen+0x8>
+  80526c:	49 bb db 4d 00 00 00 	movabs $0x4ddb,%r11
+  805273:	00 00 00 
+  805276:	4c 01 d8             	add    %r11,%rax
+  805279:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80527c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  80527f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805282:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805285:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805288:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  80528b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80528f:	ba 08 00 00 00       	mov    $0x8,%edx
+  805294:	48 89 ce             	mov    %rcx,%rsi
+  805297:	bf 06 00 00 00       	mov    $0x6,%edi
+  80529c:	48 b9 1a af ff ff ff 	movabs $0xffffffffffffaf1a,%rcx
+  8052a3:	ff ff ff 
+  8052a6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8052aa:	ff d0                	call   *%rax
+}
+  8052ac:	c9                   	leave
+  8052ad:	c3                   	ret
+
+00000000008052ae <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8052ae:	55                   	push   %rbp
+  8052af:	48 89 e5             	mov    %rsp,%rbp
+  8052b2:	41 57                	push   %r15
+  8052b4:	53                   	push   %rbx
+  8052b5:	48 83 ec 30          	sub    $0x30,%rsp
+  8052b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052b9 <nsipc_recv+0xb>
+  8052c0:	49 bb 87 4d 00 00 00 	movabs $0x4d87,%r11
+  8052c7:	00 00 00 
+  8052ca:	4c 01 db             	add    %r11,%rbx
+  8052cd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8052d0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8052d4:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8052d7:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8052da:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8052e1:	00 00 00 
+  8052e4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052e7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8052ea:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8052f1:	00 00 00 
+  8052f4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8052f7:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8052fb:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805302:	00 00 00 
+  805305:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805308:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80530c:	bf 07 00 00 00       	mov    $0x7,%edi
+  805311:	48 b8 77 ae ff ff ff 	movabs $0xffffffffffffae77,%rax
+  805318:	ff ff ff 
+  80531b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80531f:	ff d0                	call   *%rax
+  805321:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805324:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805328:	0f 88 91 00 00 00    	js     8053bf <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  80532e:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805335:	7f 08                	jg     80533f <nsipc_recv+0x91>
+  805337:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80533a:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  80533d:	7e 50                	jle    80538f <nsipc_recv+0xe1>
+  80533f:	48 b8 e3 df ff ff ff 	movabs $0xffffffffffffdfe3,%rax
+  805346:	ff ff ff 
+  805349:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80534d:	48 89 c1             	mov    %rax,%rcx
+  805350:	48 b8 f8 df ff ff ff 	movabs $0xffffffffffffdff8,%rax
+  805357:	ff ff ff 
+  80535a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80535e:	48 89 c2             	mov    %rax,%rdx
+  805361:	be 79 00 00 00       	mov    $0x79,%esi
+  805366:	48 b8 0d e0 ff ff ff 	movabs $0xffffffffffffe00d,%rax
+  80536d:	ff ff ff 
+  805370:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805374:	48 89 c7             	mov    %rax,%rdi
+  805377:	49 89 df             	mov    %rbx,%r15
+  80537a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80537f:	49 b8 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%r8
+  805386:	ff ff ff 
+  805389:	49 01 d8             	add    %rbx,%r8
+  80538c:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80538f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805392:	48 63 d0             	movslq %eax,%rdx
+  805395:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805399:	48 b9 c0 3f 01 00 00 	movabs $0x13fc0,%rcx
+  8053a0:	00 00 00 
+  8053a3:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8053a7:	48 89 ce             	mov    %rcx,%rsi
+  8053aa:	48 89 c7             	mov    %rax,%rdi
+  8053ad:	49 89 df             	mov    %rbx,%r15
+  8053b0:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  8053b7:	ff ff ff 
+  8053ba:	48 01 d8             	add    %rbx,%rax
+  8053bd:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8053bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8053c2:	48 83 c4 30          	add    $0x30,%rsp
+  8053c6:	5b                   	pop    %rbx
+  8053c7:	41 5f                	pop    %r15
+  8053c9:	5d                   	pop    %rbp
+  8053ca:	c3                   	ret
+
+00000000008053cb <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8053cb:	55                   	push   %rbp
+  8053cc:	48 89 e5             	mov    %rsp,%rbp
+  8053cf:	41 57                	push   %r15
+  8053d1:	53                   	push   %rbx
+  8053d2:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8053d9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053d9 <nsipc_send+0xe>
+  8053e0:	49 bb 67 4c 00 00 00 	movabs $0x4c67,%r11
+  8053e7:	00 00 00 
+  8053ea:	4c 01 db             	add    %r11,%rbx
+  8053ed:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8053f3:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8053fa:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805400:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805406:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80540a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  80540e:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  805415:	00 00 00 
+  805418:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80541b:	85 c0                	test   %eax,%eax
+  80541d:	75 24                	jne    805443 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80541f:	bf 02 00 00 00       	mov    $0x2,%edi
+  805424:	49 89 df             	mov    %rbx,%r15
+  805427:	48 b8 c9 d1 ff ff ff 	movabs $0xffffffffffffd1c9,%rax
+  80542e:	ff ff ff 
+  805431:	48 01 d8             	add    %rbx,%rax
+  805434:	ff d0                	call   *%rax
+  805436:	48 ba c0 1f 01 00 00 	movabs $0x11fc0,%rdx
+  80543d:	00 00 00 
+  805440:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805443:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805449:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80544c:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805453:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805456:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805459:	39 c2                	cmp    %eax,%edx
+  80545b:	0f 4e c2             	cmovle %edx,%eax
+  80545e:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805464:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80546a:	48 63 d0             	movslq %eax,%rdx
+  80546d:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805474:	48 89 c6             	mov    %rax,%rsi
+  805477:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80547e:	00 00 00 
+  805481:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805485:	48 89 c7             	mov    %rax,%rdi
+  805488:	49 89 df             	mov    %rbx,%r15
+  80548b:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  805492:	ff ff ff 
+  805495:	48 01 d8             	add    %rbx,%rax
+  805498:	ff d0                	call   *%rax
+	req->req_s = s;
+  80549a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80549e:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  8054a4:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  8054a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054aa:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8054b0:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  8054b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054b7:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8054bd:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  8054c0:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8054c7:	00 00 00 
+  8054ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054ce:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8054d2:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8054d9:	00 
+  8054da:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8054e0:	48 63 d0             	movslq %eax,%rdx
+  8054e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054e7:	48 01 d0             	add    %rdx,%rax
+  8054ea:	48 83 e8 01          	sub    $0x1,%rax
+  8054ee:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8054f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054fb:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8054ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805503:	48 29 d0             	sub    %rdx,%rax
+  805506:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  80550c:	85 c0                	test   %eax,%eax
+  80550e:	0f 48 c2             	cmovs  %edx,%eax
+  805511:	c1 f8 0c             	sar    $0xc,%eax
+  805514:	48 98                	cltq
+  805516:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  80551a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80551e:	48 85 c0             	test   %rax,%rax
+  805521:	0f 95 c0             	setne  %al
+  805524:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805527:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  80552e:	00 
+  80552f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805533:	48 83 c0 0b          	add    $0xb,%rax
+  805537:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80553b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80553f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805544:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805548:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80554c:	48 29 d0             	sub    %rdx,%rax
+  80554f:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805553:	89 c7                	mov    %eax,%edi
+  805555:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  80555c:	00 00 00 
+  80555f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805562:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805566:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  80556a:	48 83 ec 08          	sub    $0x8,%rsp
+  80556e:	6a 00                	push   $0x0
+  805570:	6a 00                	push   $0x0
+  805572:	6a 05                	push   $0x5
+  805574:	41 89 f1             	mov    %esi,%r9d
+  805577:	49 89 c8             	mov    %rcx,%r8
+  80557a:	89 f9                	mov    %edi,%ecx
+  80557c:	be 08 00 00 00       	mov    $0x8,%esi
+  805581:	89 c7                	mov    %eax,%edi
+  805583:	49 89 df             	mov    %rbx,%r15
+  805586:	48 b8 d1 cd ff ff ff 	movabs $0xffffffffffffcdd1,%rax
+  80558d:	ff ff ff 
+  805590:	48 01 d8             	add    %rbx,%rax
+  805593:	ff d0                	call   *%rax
+  805595:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805599:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80559d:	5b                   	pop    %rbx
+  80559e:	41 5f                	pop    %r15
+  8055a0:	5d                   	pop    %rbp
+  8055a1:	c3                   	ret
+
+00000000008055a2 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8055a2:	55                   	push   %rbp
+  8055a3:	48 89 e5             	mov    %rsp,%rbp
+  8055a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8055aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055aa <nsipc_socket+0x8>
+  8055b1:	49 bb 96 4a 00 00 00 	movabs $0x4a96,%r11
+  8055b8:	00 00 00 
+  8055bb:	4c 01 d8             	add    %r11,%rax
+  8055be:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8055c1:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8055c4:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8055c7:	48 b9 c0 3f 01 00 00 	movabs $0x13fc0,%rcx
+  8055ce:	00 00 00 
+  8055d1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8055d4:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8055d7:	48 b9 c0 3f 01 00 00 	movabs $0x13fc0,%rcx
+  8055de:	00 00 00 
+  8055e1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8055e4:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8055e8:	48 b9 c0 3f 01 00 00 	movabs $0x13fc0,%rcx
+  8055ef:	00 00 00 
+  8055f2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8055f5:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8055f9:	bf 09 00 00 00       	mov    $0x9,%edi
+  8055fe:	48 ba 77 ae ff ff ff 	movabs $0xffffffffffffae77,%rdx
+  805605:	ff ff ff 
+  805608:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80560c:	ff d0                	call   *%rax
+}
+  80560e:	c9                   	leave
+  80560f:	c3                   	ret
+
+0000000000805610 <mops_add>:
+static struct PageOp mops[PAGE_BATCH_CHUNK];
+static int nmops;
+
+static int
+mops_add(int alloc, void *va, int perm)
+{
+  805610:	55                   	push   %rbp
+  805611:	48 89 e5             	mov    %rsp,%rbp
+  805614:	41 57                	push   %r15
+  805616:	53                   	push   %rbx
+  805617:	48 83 ec 20          	sub    $0x20,%rsp
+  80561b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80561b <mops_add+0xb>
+  805622:	49 bb 25 4a 00 00 00 	movabs $0x4a25,%r11
+  805629:	00 00 00 
+  80562c:	4c 01 db             	add    %r11,%rbx
+  80562f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805632:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805636:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r = 0;
+  805639:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+	mops[nmops].dstenvid = 0;
+  805640:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  805647:	00 00 00 
+  80564a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80564d:	48 ba 00 20 01 00 00 	movabs $0x12000,%rdx
+  805654:	00 00 00 
+  805657:	48 98                	cltq
+  805659:	48 c1 e0 05          	shl    $0x5,%rax
+  80565d:	48 01 d8             	add    %rbx,%rax
+  805660:	48 01 d0             	add    %rdx,%rax
+  805663:	48 83 c0 04          	add    $0x4,%rax
+  805667:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	mops[nmops].dstva = (uintptr_t) va;
+  80566d:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  805674:	00 00 00 
+  805677:	8b 14 03             	mov    (%rbx,%rax,1),%edx
+  80567a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80567e:	48 b9 00 20 01 00 00 	movabs $0x12000,%rcx
+  805685:	00 00 00 
+  805688:	48 63 d2             	movslq %edx,%rdx
+  80568b:	48 01 d9             	add    %rbx,%rcx
+  80568e:	48 c1 e2 05          	shl    $0x5,%rdx
+  805692:	48 01 ca             	add    %rcx,%rdx
+  805695:	48 83 c2 10          	add    $0x10,%rdx
+  805699:	48 89 02             	mov    %rax,(%rdx)
+	mops[nmops].perm = perm;
+  80569c:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  8056a3:	00 00 00 
+  8056a6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056a9:	48 ba 00 20 01 00 00 	movabs $0x12000,%rdx
+  8056b0:	00 00 00 
+  8056b3:	48 98                	cltq
+  8056b5:	48 c1 e0 05          	shl    $0x5,%rax
+  8056b9:	48 01 d8             	add    %rbx,%rax
+  8056bc:	48 01 d0             	add    %rdx,%rax
+  8056bf:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8056c3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8056c6:	89 02                	mov    %eax,(%rdx)
+	if (++nmops == PAGE_BATCH_CHUNK)
+  8056c8:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  8056cf:	00 00 00 
+  8056d2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056d5:	8d 50 01             	lea    0x1(%rax),%edx
+  8056d8:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  8056df:	00 00 00 
+  8056e2:	89 14 03             	mov    %edx,(%rbx,%rax,1)
+  8056e5:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  8056ec:	00 00 00 
+  8056ef:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056f2:	83 f8 20             	cmp    $0x20,%eax
+  8056f5:	75 75                	jne    80576c <mops_add+0x15c>
+		r = alloc ? sys_page_alloc_batch(mops, nmops)
+			  : sys_page_unmap_batch(mops, nmops);
+  8056f7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8056fb:	74 37                	je     805734 <mops_add+0x124>
+		r = alloc ? sys_page_alloc_batch(mops, nmops)
+  8056fd:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  805704:	00 00 00 
+  805707:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80570a:	48 98                	cltq
+  80570c:	48 89 c6             	mov    %rax,%rsi
+  80570f:	48 b8 00 20 01 00 00 	movabs $0x12000,%rax
+  805716:	00 00 00 
+  805719:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80571d:	48 89 c7             	mov    %rax,%rdi
+  805720:	49 89 df             	mov    %rbx,%r15
+  805723:	48 b8 07 91 ff ff ff 	movabs $0xffffffffffff9107,%rax
+  80572a:	ff ff ff 
+  80572d:	48 01 d8             	add    %rbx,%rax
+  805730:	ff d0                	call   *%rax
+  805732:	eb 35                	jmp    805769 <mops_add+0x159>
+			  : sys_page_unmap_batch(mops, nmops);
+  805734:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  80573b:	00 00 00 
+  80573e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805741:	48 98                	cltq
+  805743:	48 89 c6             	mov    %rax,%rsi
+  805746:	48 b8 00 20 01 00 00 	movabs $0x12000,%rax
+  80574d:	00 00 00 
+  805750:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805754:	48 89 c7             	mov    %rax,%rdi
+  805757:	49 89 df             	mov    %rbx,%r15
+  80575a:	48 b8 65 91 ff ff ff 	movabs $0xffffffffffff9165,%rax
+  805761:	ff ff ff 
+  805764:	48 01 d8             	add    %rbx,%rax
+  805767:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(mops, nmops)
+  805769:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (nmops == PAGE_BATCH_CHUNK || r < 0)
+  80576c:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  805773:	00 00 00 
+  805776:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805779:	83 f8 20             	cmp    $0x20,%eax
+  80577c:	74 06                	je     805784 <mops_add+0x174>
+  80577e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805782:	79 11                	jns    805795 <mops_add+0x185>
+		nmops = 0;
+  805784:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  80578b:	00 00 00 
+  80578e:	c7 04 03 00 00 00 00 	movl   $0x0,(%rbx,%rax,1)
+	return r;
+  805795:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805798:	48 83 c4 20          	add    $0x20,%rsp
+  80579c:	5b                   	pop    %rbx
+  80579d:	41 5f                	pop    %r15
+  80579f:	5d                   	pop    %rbp
+  8057a0:	c3                   	ret
+
+00000000008057a1 <mops_flush>:
+
+static int
+mops_flush(int alloc)
+{
+  8057a1:	55                   	push   %rbp
+  8057a2:	48 89 e5             	mov    %rsp,%rbp
+  8057a5:	41 57                	push   %r15
+  8057a7:	53                   	push   %rbx
+  8057a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8057ac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057ac <mops_flush+0xb>
+  8057b3:	49 bb 94 48 00 00 00 	movabs $0x4894,%r11
+  8057ba:	00 00 00 
+  8057bd:	4c 01 db             	add    %r11,%rbx
+  8057c0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r = 0;
+  8057c3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+	if (nmops)
+  8057ca:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  8057d1:	00 00 00 
+  8057d4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8057d7:	85 c0                	test   %eax,%eax
+  8057d9:	74 75                	je     805850 <mops_flush+0xaf>
+		r = alloc ? sys_page_alloc_batch(mops, nmops)
+			  : sys_page_unmap_batch(mops, nmops);
+  8057db:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8057df:	74 37                	je     805818 <mops_flush+0x77>
+		r = alloc ? sys_page_alloc_batch(mops, nmops)
+  8057e1:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  8057e8:	00 00 00 
+  8057eb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8057ee:	48 98                	cltq
+  8057f0:	48 89 c6             	mov    %rax,%rsi
+  8057f3:	48 b8 00 20 01 00 00 	movabs $0x12000,%rax
+  8057fa:	00 00 00 
+  8057fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805801:	48 89 c7             	mov    %rax,%rdi
+  805804:	49 89 df             	mov    %rbx,%r15
+  805807:	48 b8 07 91 ff ff ff 	movabs $0xffffffffffff9107,%rax
+  80580e:	ff ff ff 
+  805811:	48 01 d8             	add    %rbx,%rax
+  805814:	ff d0                	call   *%rax
+  805816:	eb 35                	jmp    80584d <mops_flush+0xac>
+			  : sys_page_unmap_batch(mops, nmops);
+  805818:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  80581f:	00 00 00 
+  805822:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805825:	48 98                	cltq
+  805827:	48 89 c6             	mov    %rax,%rsi
+  80582a:	48 b8 00 20 01 00 00 	movabs $0x12000,%rax
+  805831:	00 00 00 
+  805834:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805838:	48 89 c7             	mov    %rax,%rdi
+  80583b:	49 89 df             	mov    %rbx,%r15
+  80583e:	48 b8 65 91 ff ff ff 	movabs $0xffffffffffff9165,%rax
+  805845:	ff ff ff 
+  805848:	48 01 d8             	add    %rbx,%rax
+  80584b:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(mops, nmops)
+  80584d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	nmops = 0;
+  805850:	48 b8 00 24 01 00 00 	movabs $0x12400,%rax
+  805857:	00 00 00 
+  80585a:	c7 04 03 00 00 00 00 	movl   $0x0,(%rbx,%rax,1)
+	return r;
+  805861:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805864:	48 83 c4 20          	add    $0x20,%rsp
+  805868:	5b                   	pop    %rbx
+  805869:	41 5f                	pop    %r15
+  80586b:	5d                   	pop    %rbp
+  80586c:	c3                   	ret
+
+000000000080586d <unmap_pages>:
+
+// Unmap the pages in [v, v+n).
+static void
+unmap_pages(uint8_t *v, size_t n)
+{
+  80586d:	55                   	push   %rbp
+  80586e:	48 89 e5             	mov    %rsp,%rbp
+  805871:	53                   	push   %rbx
+  805872:	48 83 ec 28          	sub    $0x28,%rsp
+  805876:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805876 <unmap_pages+0x9>
+  80587d:	49 bb ca 47 00 00 00 	movabs $0x47ca,%r11
+  805884:	00 00 00 
+  805887:	4c 01 db             	add    %r11,%rbx
+  80588a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80588e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	size_t i;
+
+	for (i = 0; i < n; i += PGSIZE)
+  805892:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805899:	00 
+  80589a:	eb 30                	jmp    8058cc <unmap_pages+0x5f>
+		mops_add(0, v + i, 0);
+  80589c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8058a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058a4:	48 01 d0             	add    %rdx,%rax
+  8058a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058ac:	48 89 c6             	mov    %rax,%rsi
+  8058af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058b4:	48 b8 d0 b5 ff ff ff 	movabs $0xffffffffffffb5d0,%rax
+  8058bb:	ff ff ff 
+  8058be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058c2:	ff d0                	call   *%rax
+	for (i = 0; i < n; i += PGSIZE)
+  8058c4:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8058cb:	00 
+  8058cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058d0:	48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+  8058d4:	72 c6                	jb     80589c <unmap_pages+0x2f>
+	mops_flush(0);
+  8058d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058db:	48 b8 61 b7 ff ff ff 	movabs $0xffffffffffffb761,%rax
+  8058e2:	ff ff ff 
+  8058e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058e9:	ff d0                	call   *%rax
+}
+  8058eb:	90                   	nop
+  8058ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8058f0:	c9                   	leave
+  8058f1:	c3                   	ret
+
+00000000008058f2 <isfree>:
+
+static int
+isfree(void *v, size_t n)
+{
+  8058f2:	55                   	push   %rbp
+  8058f3:	48 89 e5             	mov    %rsp,%rbp
+  8058f6:	48 83 ec 20          	sub    $0x20,%rsp
+  8058fa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8058fa <isfree+0x8>
+  805901:	49 bb 46 47 00 00 00 	movabs $0x4746,%r11
+  805908:	00 00 00 
+  80590b:	4c 01 d8             	add    %r11,%rax
+  80590e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805912:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	uintptr_t va, end_va = (uintptr_t) v + n;
+  805916:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80591a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80591e:	48 01 ca             	add    %rcx,%rdx
+  805921:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  805925:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805929:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80592d:	eb 6d                	jmp    80599c <isfree+0xaa>
+		if (va >= (uintptr_t) mend
+  80592f:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  805936:	ff ff ff 
+  805939:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80593d:	48 39 55 f8          	cmp    %rdx,-0x8(%rbp)
+  805941:	73 4a                	jae    80598d <isfree+0x9b>
+		    || ((uvpd[VPD(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)))
+  805943:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805947:	48 89 d1             	mov    %rdx,%rcx
+  80594a:	48 c1 e9 15          	shr    $0x15,%rcx
+  80594e:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  805955:	ff ff ff 
+  805958:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80595c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805960:	83 e2 01             	and    $0x1,%edx
+  805963:	48 85 d2             	test   %rdx,%rdx
+  805966:	74 2c                	je     805994 <isfree+0xa2>
+  805968:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80596c:	48 89 d1             	mov    %rdx,%rcx
+  80596f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805973:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80597a:	ff ff ff 
+  80597d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805981:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805985:	83 e2 01             	and    $0x1,%edx
+  805988:	48 85 d2             	test   %rdx,%rdx
+  80598b:	74 07                	je     805994 <isfree+0xa2>
+			return 0;
+  80598d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805992:	eb 17                	jmp    8059ab <isfree+0xb9>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  805994:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  80599b:	00 
+  80599c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8059a0:	48 3b 55 f0          	cmp    -0x10(%rbp),%rdx
+  8059a4:	72 89                	jb     80592f <isfree+0x3d>
+	return 1;
+  8059a6:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8059ab:	c9                   	leave
+  8059ac:	c3                   	ret
+
+00000000008059ad <malloc>:
+
+void*
+malloc(size_t n)
+{
+  8059ad:	55                   	push   %rbp
+  8059ae:	48 89 e5             	mov    %rsp,%rbp
+  8059b1:	53                   	push   %rbx
+  8059b2:	48 83 ec 68          	sub    $0x68,%rsp
+  8059b6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059b6 <malloc+0x9>
+  8059bd:	49 bb 8a 46 00 00 00 	movabs $0x468a,%r11
+  8059c4:	00 00 00 
+  8059c7:	4c 01 db             	add    %r11,%rbx
+  8059ca:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+	int i, cont;
+	int nwrap;
+	uint32_t *ref;
+	void *v;
+
+	if (mptr == 0)
+  8059ce:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  8059d5:	00 00 00 
+  8059d8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059dc:	48 85 c0             	test   %rax,%rax
+  8059df:	75 1c                	jne    8059fd <malloc+0x50>
+		mptr = mbegin;
+  8059e1:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8059e8:	ff ff ff 
+  8059eb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059ef:	48 ba e0 1f 01 00 00 	movabs $0x11fe0,%rdx
+  8059f6:	00 00 00 
+  8059f9:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	n = ROUNDUP(n, 4);
+  8059fd:	48 c7 45 e0 04 00 00 	movq   $0x4,-0x20(%rbp)
+  805a04:	00 
+  805a05:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  805a09:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a0d:	48 01 d0             	add    %rdx,%rax
+  805a10:	48 83 e8 01          	sub    $0x1,%rax
+  805a14:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  805a18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a21:	48 f7 75 e0          	divq   -0x20(%rbp)
+  805a25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a29:	48 29 d0             	sub    %rdx,%rax
+  805a2c:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+
+	if (n >= MAXMALLOC)
+  805a30:	48 81 7d 98 ff ff 0f 	cmpq   $0xfffff,-0x68(%rbp)
+  805a37:	00 
+  805a38:	76 0a                	jbe    805a44 <malloc+0x97>
+		return 0;
+  805a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a3f:	e9 3f 03 00 00       	jmp    805d83 <malloc+0x3d6>
+
+	if ((uintptr_t) mptr % PGSIZE){
+  805a44:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805a4b:	00 00 00 
+  805a4e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a52:	25 ff 0f 00 00       	and    $0xfff,%eax
+  805a57:	48 85 c0             	test   %rax,%rax
+  805a5a:	0f 84 1c 01 00 00    	je     805b7c <malloc+0x1cf>
+		/*
+		 * we're in the middle of a partially
+		 * allocated page - can we add this chunk?
+		 * the +4 below is for the ref count.
+		 */
+		ref = (uint32_t*) (ROUNDUP(mptr, PGSIZE) - 4);
+  805a60:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  805a67:	00 
+  805a68:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805a6f:	00 00 00 
+  805a72:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a76:	48 89 c2             	mov    %rax,%rdx
+  805a79:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a7d:	48 01 d0             	add    %rdx,%rax
+  805a80:	48 83 e8 01          	sub    $0x1,%rax
+  805a84:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805a88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a91:	48 f7 75 d0          	divq   -0x30(%rbp)
+  805a95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a99:	48 29 d0             	sub    %rdx,%rax
+  805a9c:	48 83 e8 04          	sub    $0x4,%rax
+  805aa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+		if ((uintptr_t) mptr / PGSIZE == (uintptr_t) (mptr + n - 1 + 4) / PGSIZE) {
+  805aa4:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805aab:	00 00 00 
+  805aae:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ab2:	48 c1 e8 0c          	shr    $0xc,%rax
+  805ab6:	48 89 c1             	mov    %rax,%rcx
+  805ab9:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805ac0:	00 00 00 
+  805ac3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ac7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  805acb:	48 83 c2 03          	add    $0x3,%rdx
+  805acf:	48 01 d0             	add    %rdx,%rax
+  805ad2:	48 c1 e8 0c          	shr    $0xc,%rax
+  805ad6:	48 39 c1             	cmp    %rax,%rcx
+  805ad9:	75 4d                	jne    805b28 <malloc+0x17b>
+			(*ref)++;
+  805adb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805adf:	8b 00                	mov    (%rax),%eax
+  805ae1:	8d 50 01             	lea    0x1(%rax),%edx
+  805ae4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805ae8:	89 10                	mov    %edx,(%rax)
+			v = mptr;
+  805aea:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805af1:	00 00 00 
+  805af4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805af8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+			mptr += n;
+  805afc:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805b03:	00 00 00 
+  805b06:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  805b0a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805b0e:	48 01 c2             	add    %rax,%rdx
+  805b11:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805b18:	00 00 00 
+  805b1b:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+			return v;
+  805b1f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805b23:	e9 5b 02 00 00       	jmp    805d83 <malloc+0x3d6>
+		}
+		/*
+		 * stop working on this page and move on.
+		 */
+		free(mptr);	/* drop reference to this page */
+  805b28:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805b2f:	00 00 00 
+  805b32:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b36:	48 89 c7             	mov    %rax,%rdi
+  805b39:	48 b8 49 bd ff ff ff 	movabs $0xffffffffffffbd49,%rax
+  805b40:	ff ff ff 
+  805b43:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b47:	ff d0                	call   *%rax
+		mptr = ROUNDDOWN(mptr + PGSIZE, PGSIZE);
+  805b49:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805b50:	00 00 00 
+  805b53:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b57:	48 05 00 10 00 00    	add    $0x1000,%rax
+  805b5d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805b61:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805b65:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  805b6b:	48 89 c2             	mov    %rax,%rdx
+  805b6e:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805b75:	00 00 00 
+  805b78:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+	 * now we need to find some address space for this chunk.
+	 * if it's less than a page we leave it open for allocation.
+	 * runs of more than a page can't have ref counts so we
+	 * flag the PTE entries instead.
+	 */
+	nwrap = 0;
+  805b7c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+	while (1) {
+		if (isfree(mptr, n + 4))
+  805b83:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805b87:	48 8d 50 04          	lea    0x4(%rax),%rdx
+  805b8b:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805b92:	00 00 00 
+  805b95:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b99:	48 89 d6             	mov    %rdx,%rsi
+  805b9c:	48 89 c7             	mov    %rax,%rdi
+  805b9f:	48 b8 b2 b8 ff ff ff 	movabs $0xffffffffffffb8b2,%rax
+  805ba6:	ff ff ff 
+  805ba9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805bad:	ff d0                	call   *%rax
+  805baf:	85 c0                	test   %eax,%eax
+  805bb1:	75 78                	jne    805c2b <malloc+0x27e>
+			break;
+		mptr += PGSIZE;
+  805bb3:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805bba:	00 00 00 
+  805bbd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bc1:	48 8d 90 00 10 00 00 	lea    0x1000(%rax),%rdx
+  805bc8:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805bcf:	00 00 00 
+  805bd2:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+		if (mptr == mend) {
+  805bd6:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805bdd:	00 00 00 
+  805be0:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  805be4:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  805beb:	ff ff ff 
+  805bee:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bf2:	48 39 c2             	cmp    %rax,%rdx
+  805bf5:	75 8c                	jne    805b83 <malloc+0x1d6>
+			mptr = mbegin;
+  805bf7:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  805bfe:	ff ff ff 
+  805c01:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c05:	48 ba e0 1f 01 00 00 	movabs $0x11fe0,%rdx
+  805c0c:	00 00 00 
+  805c0f:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+			if (++nwrap == 2)
+  805c13:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  805c17:	83 7d e8 02          	cmpl   $0x2,-0x18(%rbp)
+  805c1b:	0f 85 62 ff ff ff    	jne    805b83 <malloc+0x1d6>
+				return 0;	/* out of address space */
+  805c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c26:	e9 58 01 00 00       	jmp    805d83 <malloc+0x3d6>
+			break;
+  805c2b:	90                   	nop
+	}
+
+	/*
+	 * allocate at mptr - the +4 makes sure we allocate a ref count.
+	 */
+	for (i = 0; i < n + 4; i += PGSIZE){
+  805c2c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805c33:	e9 d2 00 00 00       	jmp    805d0a <malloc+0x35d>
+		cont = (i + PGSIZE < n + 4) ? PTE_CONTINUED : 0;
+  805c38:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c3b:	05 00 10 00 00       	add    $0x1000,%eax
+  805c40:	48 63 d0             	movslq %eax,%rdx
+  805c43:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805c47:	48 83 c0 04          	add    $0x4,%rax
+  805c4b:	48 39 c2             	cmp    %rax,%rdx
+  805c4e:	73 07                	jae    805c57 <malloc+0x2aa>
+  805c50:	b8 00 04 00 00       	mov    $0x400,%eax
+  805c55:	eb 05                	jmp    805c5c <malloc+0x2af>
+  805c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c5c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+		// Only the last page is written (its ref count) right
+		// away; the others stay demand-zero until used.
+		if (mops_add(1, mptr + i,
+			     PTE_P|PTE_U|PTE_W|cont|(cont ? PTE_LAZY : 0)) < 0 ||
+  805c5f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  805c62:	83 c8 07             	or     $0x7,%eax
+  805c65:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  805c69:	74 07                	je     805c72 <malloc+0x2c5>
+  805c6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805c70:	eb 05                	jmp    805c77 <malloc+0x2ca>
+  805c72:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (mops_add(1, mptr + i,
+  805c77:	09 c2                	or     %eax,%edx
+  805c79:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805c80:	00 00 00 
+  805c83:	48 8b 0c 03          	mov    (%rbx,%rax,1),%rcx
+  805c87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c8a:	48 98                	cltq
+  805c8c:	48 01 c8             	add    %rcx,%rax
+  805c8f:	48 89 c6             	mov    %rax,%rsi
+  805c92:	bf 01 00 00 00       	mov    $0x1,%edi
+  805c97:	48 b8 d0 b5 ff ff ff 	movabs $0xffffffffffffb5d0,%rax
+  805c9e:	ff ff ff 
+  805ca1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ca5:	ff d0                	call   *%rax
+  805ca7:	85 c0                	test   %eax,%eax
+  805ca9:	78 1f                	js     805cca <malloc+0x31d>
+			     PTE_P|PTE_U|PTE_W|cont|(cont ? PTE_LAZY : 0)) < 0 ||
+  805cab:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  805caf:	75 52                	jne    805d03 <malloc+0x356>
+		    (!cont && mops_flush(1) < 0)){
+  805cb1:	bf 01 00 00 00       	mov    $0x1,%edi
+  805cb6:	48 b8 61 b7 ff ff ff 	movabs $0xffffffffffffb761,%rax
+  805cbd:	ff ff ff 
+  805cc0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cc4:	ff d0                	call   *%rax
+  805cc6:	85 c0                	test   %eax,%eax
+  805cc8:	79 39                	jns    805d03 <malloc+0x356>
+			unmap_pages(mptr, i + PGSIZE);
+  805cca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ccd:	05 00 10 00 00       	add    $0x1000,%eax
+  805cd2:	48 63 d0             	movslq %eax,%rdx
+  805cd5:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805cdc:	00 00 00 
+  805cdf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ce3:	48 89 d6             	mov    %rdx,%rsi
+  805ce6:	48 89 c7             	mov    %rax,%rdi
+  805ce9:	48 b8 2d b8 ff ff ff 	movabs $0xffffffffffffb82d,%rax
+  805cf0:	ff ff ff 
+  805cf3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cf7:	ff d0                	call   *%rax
+			return 0;	/* out of physical memory */
+  805cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cfe:	e9 80 00 00 00       	jmp    805d83 <malloc+0x3d6>
+	for (i = 0; i < n + 4; i += PGSIZE){
+  805d03:	81 45 ec 00 10 00 00 	addl   $0x1000,-0x14(%rbp)
+  805d0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d0d:	48 63 d0             	movslq %eax,%rdx
+  805d10:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805d14:	48 83 c0 04          	add    $0x4,%rax
+  805d18:	48 39 c2             	cmp    %rax,%rdx
+  805d1b:	0f 82 17 ff ff ff    	jb     805c38 <malloc+0x28b>
+		}
+	}
+
+	ref = (uint32_t*) (mptr + i - 4);
+  805d21:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805d28:	00 00 00 
+  805d2b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d2f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805d32:	48 63 d2             	movslq %edx,%rdx
+  805d35:	48 83 ea 04          	sub    $0x4,%rdx
+  805d39:	48 01 d0             	add    %rdx,%rax
+  805d3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	*ref = 2;	/* reference for mptr, reference for returned block */
+  805d40:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d44:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+	v = mptr;
+  805d4a:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805d51:	00 00 00 
+  805d54:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d58:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+	mptr += n;
+  805d5c:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805d63:	00 00 00 
+  805d66:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  805d6a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805d6e:	48 01 c2             	add    %rax,%rdx
+  805d71:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805d78:	00 00 00 
+  805d7b:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+	return v;
+  805d7f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+}
+  805d83:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805d87:	c9                   	leave
+  805d88:	c3                   	ret
+
+0000000000805d89 <free>:
+
+void
+free(void *v)
+{
+  805d89:	55                   	push   %rbp
+  805d8a:	48 89 e5             	mov    %rsp,%rbp
+  805d8d:	41 57                	push   %r15
+  805d8f:	53                   	push   %rbx
+  805d90:	48 83 ec 30          	sub    $0x30,%rsp
+  805d94:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d94 <free+0xb>
+  805d9b:	49 bb ac 42 00 00 00 	movabs $0x42ac,%r11
+  805da2:	00 00 00 
+  805da5:	4c 01 db             	add    %r11,%rbx
+  805da8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	uint8_t *c;
+	uint32_t *ref;
+
+	if (v == 0)
+  805dac:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805db1:	0f 84 bb 01 00 00    	je     805f72 <free+0x1e9>
+		return;
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mend);
+  805db7:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  805dbe:	ff ff ff 
+  805dc1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805dc5:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  805dc9:	72 14                	jb     805ddf <free+0x56>
+  805dcb:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  805dd2:	ff ff ff 
+  805dd5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805dd9:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  805ddd:	72 50                	jb     805e2f <free+0xa6>
+  805ddf:	48 b8 20 e0 ff ff ff 	movabs $0xffffffffffffe020,%rax
+  805de6:	ff ff ff 
+  805de9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ded:	48 89 c1             	mov    %rax,%rcx
+  805df0:	48 b8 4e e0 ff ff ff 	movabs $0xffffffffffffe04e,%rax
+  805df7:	ff ff ff 
+  805dfa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dfe:	48 89 c2             	mov    %rax,%rdx
+  805e01:	be a8 00 00 00       	mov    $0xa8,%esi
+  805e06:	48 b8 63 e0 ff ff ff 	movabs $0xffffffffffffe063,%rax
+  805e0d:	ff ff ff 
+  805e10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e14:	48 89 c7             	mov    %rax,%rdi
+  805e17:	49 89 df             	mov    %rbx,%r15
+  805e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e1f:	49 b8 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%r8
+  805e26:	ff ff ff 
+  805e29:	49 01 d8             	add    %rbx,%r8
+  805e2c:	41 ff d0             	call   *%r8
+
+	c = ROUNDDOWN(v, PGSIZE);
+  805e2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e33:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805e37:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e3b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  805e41:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  805e45:	e9 a1 00 00 00       	jmp    805eeb <free+0x162>
+		mops_add(0, c, 0);
+  805e4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e53:	48 89 c6             	mov    %rax,%rsi
+  805e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e5b:	48 b8 d0 b5 ff ff ff 	movabs $0xffffffffffffb5d0,%rax
+  805e62:	ff ff ff 
+  805e65:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e69:	ff d0                	call   *%rax
+		c += PGSIZE;
+  805e6b:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  805e72:	00 
+		assert(mbegin <= c && c < mend);
+  805e73:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  805e7a:	ff ff ff 
+  805e7d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e81:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  805e85:	72 14                	jb     805e9b <free+0x112>
+  805e87:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  805e8e:	ff ff ff 
+  805e91:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e95:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  805e99:	72 50                	jb     805eeb <free+0x162>
+  805e9b:	48 b8 70 e0 ff ff ff 	movabs $0xffffffffffffe070,%rax
+  805ea2:	ff ff ff 
+  805ea5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ea9:	48 89 c1             	mov    %rax,%rcx
+  805eac:	48 b8 4e e0 ff ff ff 	movabs $0xffffffffffffe04e,%rax
+  805eb3:	ff ff ff 
+  805eb6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805eba:	48 89 c2             	mov    %rax,%rdx
+  805ebd:	be af 00 00 00       	mov    $0xaf,%esi
+  805ec2:	48 b8 63 e0 ff ff ff 	movabs $0xffffffffffffe063,%rax
+  805ec9:	ff ff ff 
+  805ecc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ed0:	48 89 c7             	mov    %rax,%rdi
+  805ed3:	49 89 df             	mov    %rbx,%r15
+  805ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805edb:	49 b8 19 6d ff ff ff 	movabs $0xffffffffffff6d19,%r8
+  805ee2:	ff ff ff 
+  805ee5:	49 01 d8             	add    %rbx,%r8
+  805ee8:	41 ff d0             	call   *%r8
+	while (uvpt[PGNUM(c)] & PTE_CONTINUED) {
+  805eeb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805eef:	48 c1 e8 0c          	shr    $0xc,%rax
+  805ef3:	48 89 c2             	mov    %rax,%rdx
+  805ef6:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  805efd:	ff ff ff 
+  805f00:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f04:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f08:	25 00 04 00 00       	and    $0x400,%eax
+  805f0d:	48 85 c0             	test   %rax,%rax
+  805f10:	0f 85 34 ff ff ff    	jne    805e4a <free+0xc1>
+	}
+	mops_flush(0);
+  805f16:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f1b:	48 b8 61 b7 ff ff ff 	movabs $0xffffffffffffb761,%rax
+  805f22:	ff ff ff 
+  805f25:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f29:	ff d0                	call   *%rax
+
+	/*
+	 * c is just a piece of this page, so dec the ref count
+	 * and maybe free the page.
+	 */
+	ref = (uint32_t*) (c + PGSIZE - 4);
+  805f2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f2f:	48 05 fc 0f 00 00    	add    $0xffc,%rax
+  805f35:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	if (--(*ref) == 0)
+  805f39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f3d:	8b 00                	mov    (%rax),%eax
+  805f3f:	8d 50 ff             	lea    -0x1(%rax),%edx
+  805f42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f46:	89 10                	mov    %edx,(%rax)
+  805f48:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f4c:	8b 00                	mov    (%rax),%eax
+  805f4e:	85 c0                	test   %eax,%eax
+  805f50:	75 21                	jne    805f73 <free+0x1ea>
+		sys_page_unmap(0, c);
+  805f52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f56:	48 89 c6             	mov    %rax,%rsi
+  805f59:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f5e:	49 89 df             	mov    %rbx,%r15
+  805f61:	48 b8 46 8b ff ff ff 	movabs $0xffffffffffff8b46,%rax
+  805f68:	ff ff ff 
+  805f6b:	48 01 d8             	add    %rbx,%rax
+  805f6e:	ff d0                	call   *%rax
+  805f70:	eb 01                	jmp    805f73 <free+0x1ea>
+		return;
+  805f72:	90                   	nop
+}
+  805f73:	48 83 c4 30          	add    $0x30,%rsp
+  805f77:	5b                   	pop    %rbx
+  805f78:	41 5f                	pop    %r15
+  805f7a:	5d                   	pop    %rbp
+  805f7b:	c3                   	ret
+
+0000000000805f7c <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805f7c:	55                   	push   %rbp
+  805f7d:	48 89 e5             	mov    %rsp,%rbp
+  805f80:	41 57                	push   %r15
+  805f82:	53                   	push   %rbx
+  805f83:	48 83 ec 30          	sub    $0x30,%rsp
+  805f87:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f87 <pipe+0xb>
+  805f8e:	49 bb b9 40 00 00 00 	movabs $0x40b9,%r11
+  805f95:	00 00 00 
+  805f98:	4c 01 db             	add    %r11,%rbx
+  805f9b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805f9f:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805fa3:	48 89 c7             	mov    %rax,%rdi
+  805fa6:	49 89 df             	mov    %rbx,%r15
+  805fa9:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  805fb0:	ff ff ff 
+  805fb3:	48 01 d8             	add    %rbx,%rax
+  805fb6:	ff d0                	call   *%rax
+  805fb8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fbb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fbf:	0f 88 12 02 00 00    	js     8061d7 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805fc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fc9:	ba 07 04 00 00       	mov    $0x407,%edx
+  805fce:	48 89 c6             	mov    %rax,%rsi
+  805fd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fd6:	49 89 df             	mov    %rbx,%r15
+  805fd9:	48 b8 6e 8a ff ff ff 	movabs $0xffffffffffff8a6e,%rax
+  805fe0:	ff ff ff 
+  805fe3:	48 01 d8             	add    %rbx,%rax
+  805fe6:	ff d0                	call   *%rax
+  805fe8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805feb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fef:	0f 88 e2 01 00 00    	js     8061d7 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805ff5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805ff9:	48 89 c7             	mov    %rax,%rdi
+  805ffc:	49 89 df             	mov    %rbx,%r15
+  805fff:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  806006:	ff ff ff 
+  806009:	48 01 d8             	add    %rbx,%rax
+  80600c:	ff d0                	call   *%rax
+  80600e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806011:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806015:	0f 88 9b 01 00 00    	js     8061b6 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80601b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80601f:	ba 07 04 00 00       	mov    $0x407,%edx
+  806024:	48 89 c6             	mov    %rax,%rsi
+  806027:	bf 00 00 00 00       	mov    $0x0,%edi
+  80602c:	49 89 df             	mov    %rbx,%r15
+  80602f:	48 b8 6e 8a ff ff ff 	movabs $0xffffffffffff8a6e,%rax
+  806036:	ff ff ff 
+  806039:	48 01 d8             	add    %rbx,%rax
+  80603c:	ff d0                	call   *%rax
+  80603e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806041:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806045:	0f 88 6b 01 00 00    	js     8061b6 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  80604b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80604f:	48 89 c7             	mov    %rax,%rdi
+  806052:	49 89 df             	mov    %rbx,%r15
+  806055:	48 b8 4e 92 ff ff ff 	movabs $0xffffffffffff924e,%rax
+  80605c:	ff ff ff 
+  80605f:	48 01 d8             	add    %rbx,%rax
+  806062:	ff d0                	call   *%rax
+  806064:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806068:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80606c:	ba 07 04 00 00       	mov    $0x407,%edx
+  806071:	48 89 c6             	mov    %rax,%rsi
+  806074:	bf 00 00 00 00       	mov    $0x0,%edi
+  806079:	49 89 df             	mov    %rbx,%r15
+  80607c:	48 b8 6e 8a ff ff ff 	movabs $0xffffffffffff8a6e,%rax
+  806083:	ff ff ff 
+  806086:	48 01 d8             	add    %rbx,%rax
+  806089:	ff d0                	call   *%rax
+  80608b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80608e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806092:	0f 88 fd 00 00 00    	js     806195 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806098:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80609c:	48 89 c7             	mov    %rax,%rdi
+  80609f:	49 89 df             	mov    %rbx,%r15
+  8060a2:	48 b8 4e 92 ff ff ff 	movabs $0xffffffffffff924e,%rax
+  8060a9:	ff ff ff 
+  8060ac:	48 01 d8             	add    %rbx,%rax
+  8060af:	ff d0                	call   *%rax
+  8060b1:	48 89 c2             	mov    %rax,%rdx
+  8060b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060b8:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8060be:	48 89 d1             	mov    %rdx,%rcx
+  8060c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8060c6:	48 89 c6             	mov    %rax,%rsi
+  8060c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060ce:	49 89 df             	mov    %rbx,%r15
+  8060d1:	48 b8 d3 8a ff ff ff 	movabs $0xffffffffffff8ad3,%rax
+  8060d8:	ff ff ff 
+  8060db:	48 01 d8             	add    %rbx,%rax
+  8060de:	ff d0                	call   *%rax
+  8060e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8060e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060e7:	0f 88 87 00 00 00    	js     806174 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8060ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060f1:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  8060f8:	00 00 00 
+  8060fb:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8060fe:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  806100:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806104:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  80610b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80610f:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806116:	00 00 00 
+  806119:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80611c:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  80611e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806122:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  806129:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80612d:	48 89 c7             	mov    %rax,%rdi
+  806130:	49 89 df             	mov    %rbx,%r15
+  806133:	48 b8 17 92 ff ff ff 	movabs $0xffffffffffff9217,%rax
+  80613a:	ff ff ff 
+  80613d:	48 01 d8             	add    %rbx,%rax
+  806140:	ff d0                	call   *%rax
+  806142:	89 c2                	mov    %eax,%edx
+  806144:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806148:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  80614a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80614e:	48 89 c7             	mov    %rax,%rdi
+  806151:	49 89 df             	mov    %rbx,%r15
+  806154:	48 b8 17 92 ff ff ff 	movabs $0xffffffffffff9217,%rax
+  80615b:	ff ff ff 
+  80615e:	48 01 d8             	add    %rbx,%rax
+  806161:	ff d0                	call   *%rax
+  806163:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806167:	48 83 c2 04          	add    $0x4,%rdx
+  80616b:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  80616d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806172:	eb 67                	jmp    8061db <pipe+0x25f>
+		goto err3;
+  806174:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806175:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806179:	48 89 c6             	mov    %rax,%rsi
+  80617c:	bf 00 00 00 00       	mov    $0x0,%edi
+  806181:	49 89 df             	mov    %rbx,%r15
+  806184:	48 b8 46 8b ff ff ff 	movabs $0xffffffffffff8b46,%rax
+  80618b:	ff ff ff 
+  80618e:	48 01 d8             	add    %rbx,%rax
+  806191:	ff d0                	call   *%rax
+  806193:	eb 01                	jmp    806196 <pipe+0x21a>
+		goto err2;
+  806195:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  806196:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80619a:	48 89 c6             	mov    %rax,%rsi
+  80619d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061a2:	49 89 df             	mov    %rbx,%r15
+  8061a5:	48 b8 46 8b ff ff ff 	movabs $0xffffffffffff8b46,%rax
+  8061ac:	ff ff ff 
+  8061af:	48 01 d8             	add    %rbx,%rax
+  8061b2:	ff d0                	call   *%rax
+  8061b4:	eb 01                	jmp    8061b7 <pipe+0x23b>
+		goto err1;
+  8061b6:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8061b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8061bb:	48 89 c6             	mov    %rax,%rsi
+  8061be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061c3:	49 89 df             	mov    %rbx,%r15
+  8061c6:	48 b8 46 8b ff ff ff 	movabs $0xffffffffffff8b46,%rax
+  8061cd:	ff ff ff 
+  8061d0:	48 01 d8             	add    %rbx,%rax
+  8061d3:	ff d0                	call   *%rax
+  8061d5:	eb 01                	jmp    8061d8 <pipe+0x25c>
+		goto err;
+  8061d7:	90                   	nop
+err:
+	return r;
+  8061d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8061db:	48 83 c4 30          	add    $0x30,%rsp
+  8061df:	5b                   	pop    %rbx
+  8061e0:	41 5f                	pop    %r15
+  8061e2:	5d                   	pop    %rbp
+  8061e3:	c3                   	ret
+
+00000000008061e4 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8061e4:	55                   	push   %rbp
+  8061e5:	48 89 e5             	mov    %rsp,%rbp
+  8061e8:	41 57                	push   %r15
+  8061ea:	41 54                	push   %r12
+  8061ec:	53                   	push   %rbx
+  8061ed:	48 83 ec 28          	sub    $0x28,%rsp
+  8061f1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061f1 <_pipeisclosed+0xd>
+  8061f8:	49 bb 4f 3e 00 00 00 	movabs $0x3e4f,%r11
+  8061ff:	00 00 00 
+  806202:	4c 01 db             	add    %r11,%rbx
+  806205:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806209:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80620d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806214:	ff ff ff 
+  806217:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80621b:	48 8b 00             	mov    (%rax),%rax
+  80621e:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806224:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  806227:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80622b:	48 89 c7             	mov    %rax,%rdi
+  80622e:	49 89 df             	mov    %rbx,%r15
+  806231:	48 b8 58 d2 ff ff ff 	movabs $0xffffffffffffd258,%rax
+  806238:	ff ff ff 
+  80623b:	48 01 d8             	add    %rbx,%rax
+  80623e:	ff d0                	call   *%rax
+  806240:	41 89 c4             	mov    %eax,%r12d
+  806243:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806247:	48 89 c7             	mov    %rax,%rdi
+  80624a:	49 89 df             	mov    %rbx,%r15
+  80624d:	48 b8 58 d2 ff ff ff 	movabs $0xffffffffffffd258,%rax
+  806254:	ff ff ff 
+  806257:	48 01 d8             	add    %rbx,%rax
+  80625a:	ff d0                	call   *%rax
+  80625c:	41 39 c4             	cmp    %eax,%r12d
+  80625f:	0f 94 c0             	sete   %al
+  806262:	0f b6 c0             	movzbl %al,%eax
+  806265:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806268:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80626f:	ff ff ff 
+  806272:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806276:	48 8b 00             	mov    (%rax),%rax
+  806279:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80627f:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  806282:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806285:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806288:	75 05                	jne    80628f <_pipeisclosed+0xab>
+			return ret;
+  80628a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80628d:	eb 63                	jmp    8062f2 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  80628f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806292:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806295:	0f 84 72 ff ff ff    	je     80620d <_pipeisclosed+0x29>
+  80629b:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  80629f:	0f 85 68 ff ff ff    	jne    80620d <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8062a5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8062ac:	ff ff ff 
+  8062af:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8062b3:	48 8b 00             	mov    (%rax),%rax
+  8062b6:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8062bc:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8062bf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8062c2:	89 c6                	mov    %eax,%esi
+  8062c4:	48 b8 8d e0 ff ff ff 	movabs $0xffffffffffffe08d,%rax
+  8062cb:	ff ff ff 
+  8062ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8062d2:	48 89 c7             	mov    %rax,%rdi
+  8062d5:	49 89 df             	mov    %rbx,%r15
+  8062d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062dd:	49 b8 f0 6f ff ff ff 	movabs $0xffffffffffff6ff0,%r8
+  8062e4:	ff ff ff 
+  8062e7:	49 01 d8             	add    %rbx,%r8
+  8062ea:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8062ed:	e9 1b ff ff ff       	jmp    80620d <_pipeisclosed+0x29>
+	}
+}
+  8062f2:	48 83 c4 28          	add    $0x28,%rsp
+  8062f6:	5b                   	pop    %rbx
+  8062f7:	41 5c                	pop    %r12
+  8062f9:	41 5f                	pop    %r15
+  8062fb:	5d                   	pop    %rbp
+  8062fc:	c3                   	ret
+
+00000000008062fd <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8062fd:	55                   	push   %rbp
+  8062fe:	48 89 e5             	mov    %rsp,%rbp
+  806301:	41 57                	push   %r15
+  806303:	53                   	push   %rbx
+  806304:	48 83 ec 30          	sub    $0x30,%rsp
+  806308:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806308 <pipeisclosed+0xb>
+  80630f:	49 bb 38 3d 00 00 00 	movabs $0x3d38,%r11
+  806316:	00 00 00 
+  806319:	4c 01 db             	add    %r11,%rbx
+  80631c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80631f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  806323:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806326:	48 89 d6             	mov    %rdx,%rsi
+  806329:	89 c7                	mov    %eax,%edi
+  80632b:	49 89 df             	mov    %rbx,%r15
+  80632e:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  806335:	ff ff ff 
+  806338:	48 01 d8             	add    %rbx,%rax
+  80633b:	ff d0                	call   *%rax
+  80633d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806340:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806344:	79 05                	jns    80634b <pipeisclosed+0x4e>
+		return r;
+  806346:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806349:	eb 3b                	jmp    806386 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  80634b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80634f:	48 89 c7             	mov    %rax,%rdi
+  806352:	49 89 df             	mov    %rbx,%r15
+  806355:	48 b8 4e 92 ff ff ff 	movabs $0xffffffffffff924e,%rax
+  80635c:	ff ff ff 
+  80635f:	48 01 d8             	add    %rbx,%rax
+  806362:	ff d0                	call   *%rax
+  806364:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806368:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80636c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806370:	48 89 d6             	mov    %rdx,%rsi
+  806373:	48 89 c7             	mov    %rax,%rdi
+  806376:	48 b8 a4 c1 ff ff ff 	movabs $0xffffffffffffc1a4,%rax
+  80637d:	ff ff ff 
+  806380:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806384:	ff d0                	call   *%rax
+}
+  806386:	48 83 c4 30          	add    $0x30,%rsp
+  80638a:	5b                   	pop    %rbx
+  80638b:	41 5f                	pop    %r15
+  80638d:	5d                   	pop    %rbp
+  80638e:	c3                   	ret
+
+000000000080638f <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80638f:	55                   	push   %rbp
+  806390:	48 89 e5             	mov    %rsp,%rbp
+  806393:	41 57                	push   %r15
+  806395:	53                   	push   %rbx
+  806396:	48 83 ec 40          	sub    $0x40,%rsp
+  80639a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80639a <devpipe_read+0xb>
+  8063a1:	49 bb a6 3c 00 00 00 	movabs $0x3ca6,%r11
+  8063a8:	00 00 00 
+  8063ab:	4c 01 db             	add    %r11,%rbx
+  8063ae:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8063b2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8063b6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8063ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063be:	48 89 c7             	mov    %rax,%rdi
+  8063c1:	49 89 df             	mov    %rbx,%r15
+  8063c4:	48 b8 4e 92 ff ff ff 	movabs $0xffffffffffff924e,%rax
+  8063cb:	ff ff ff 
+  8063ce:	48 01 d8             	add    %rbx,%rax
+  8063d1:	ff d0                	call   *%rax
+  8063d3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8063d7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8063db:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8063df:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8063e6:	00 
+  8063e7:	e9 a1 00 00 00       	jmp    80648d <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8063ec:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8063f1:	74 09                	je     8063fc <devpipe_read+0x6d>
+				return i;
+  8063f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063f7:	e9 9f 00 00 00       	jmp    80649b <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8063fc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806400:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806404:	48 89 d6             	mov    %rdx,%rsi
+  806407:	48 89 c7             	mov    %rax,%rdi
+  80640a:	48 b8 a4 c1 ff ff ff 	movabs $0xffffffffffffc1a4,%rax
+  806411:	ff ff ff 
+  806414:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806418:	ff d0                	call   *%rax
+  80641a:	85 c0                	test   %eax,%eax
+  80641c:	74 07                	je     806425 <devpipe_read+0x96>
+				return 0;
+  80641e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806423:	eb 76                	jmp    80649b <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  806425:	49 89 df             	mov    %rbx,%r15
+  806428:	48 b8 19 8a ff ff ff 	movabs $0xffffffffffff8a19,%rax
+  80642f:	ff ff ff 
+  806432:	48 01 d8             	add    %rbx,%rax
+  806435:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  806437:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80643b:	8b 10                	mov    (%rax),%edx
+  80643d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806441:	8b 40 04             	mov    0x4(%rax),%eax
+  806444:	39 c2                	cmp    %eax,%edx
+  806446:	74 a4                	je     8063ec <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  806448:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80644c:	8b 10                	mov    (%rax),%edx
+  80644e:	89 d0                	mov    %edx,%eax
+  806450:	c1 f8 1f             	sar    $0x1f,%eax
+  806453:	c1 e8 1b             	shr    $0x1b,%eax
+  806456:	01 c2                	add    %eax,%edx
+  806458:	83 e2 1f             	and    $0x1f,%edx
+  80645b:	29 c2                	sub    %eax,%edx
+  80645d:	89 d6                	mov    %edx,%esi
+  80645f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806463:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806467:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80646b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80646f:	48 63 c6             	movslq %esi,%rax
+  806472:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806477:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806479:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80647d:	8b 00                	mov    (%rax),%eax
+  80647f:	8d 50 01             	lea    0x1(%rax),%edx
+  806482:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806486:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806488:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80648d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806491:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806495:	72 a0                	jb     806437 <devpipe_read+0xa8>
+	}
+	return i;
+  806497:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80649b:	48 83 c4 40          	add    $0x40,%rsp
+  80649f:	5b                   	pop    %rbx
+  8064a0:	41 5f                	pop    %r15
+  8064a2:	5d                   	pop    %rbp
+  8064a3:	c3                   	ret
+
+00000000008064a4 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8064a4:	55                   	push   %rbp
+  8064a5:	48 89 e5             	mov    %rsp,%rbp
+  8064a8:	41 57                	push   %r15
+  8064aa:	53                   	push   %rbx
+  8064ab:	48 83 ec 40          	sub    $0x40,%rsp
+  8064af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064af <devpipe_write+0xb>
+  8064b6:	49 bb 91 3b 00 00 00 	movabs $0x3b91,%r11
+  8064bd:	00 00 00 
+  8064c0:	4c 01 db             	add    %r11,%rbx
+  8064c3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8064c7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8064cb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8064cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8064d3:	48 89 c7             	mov    %rax,%rdi
+  8064d6:	49 89 df             	mov    %rbx,%r15
+  8064d9:	48 b8 4e 92 ff ff ff 	movabs $0xffffffffffff924e,%rax
+  8064e0:	ff ff ff 
+  8064e3:	48 01 d8             	add    %rbx,%rax
+  8064e6:	ff d0                	call   *%rax
+  8064e8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8064ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8064f0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8064f4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8064fb:	00 
+  8064fc:	e9 a0 00 00 00       	jmp    8065a1 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  806501:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806505:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806509:	48 89 d6             	mov    %rdx,%rsi
+  80650c:	48 89 c7             	mov    %rax,%rdi
+  80650f:	48 b8 a4 c1 ff ff ff 	movabs $0xffffffffffffc1a4,%rax
+  806516:	ff ff ff 
+  806519:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80651d:	ff d0                	call   *%rax
+  80651f:	85 c0                	test   %eax,%eax
+  806521:	74 0a                	je     80652d <devpipe_write+0x89>
+				return 0;
+  806523:	b8 00 00 00 00       	mov    $0x0,%eax
+  806528:	e9 82 00 00 00       	jmp    8065af <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  80652d:	49 89 df             	mov    %rbx,%r15
+  806530:	48 b8 19 8a ff ff ff 	movabs $0xffffffffffff8a19,%rax
+  806537:	ff ff ff 
+  80653a:	48 01 d8             	add    %rbx,%rax
+  80653d:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80653f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806543:	8b 40 04             	mov    0x4(%rax),%eax
+  806546:	48 63 d0             	movslq %eax,%rdx
+  806549:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80654d:	8b 00                	mov    (%rax),%eax
+  80654f:	48 98                	cltq
+  806551:	48 83 c0 20          	add    $0x20,%rax
+  806555:	48 39 c2             	cmp    %rax,%rdx
+  806558:	73 a7                	jae    806501 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80655a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80655e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806562:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806566:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80656a:	8b 50 04             	mov    0x4(%rax),%edx
+  80656d:	89 d0                	mov    %edx,%eax
+  80656f:	c1 f8 1f             	sar    $0x1f,%eax
+  806572:	c1 e8 1b             	shr    $0x1b,%eax
+  806575:	01 c2                	add    %eax,%edx
+  806577:	83 e2 1f             	and    $0x1f,%edx
+  80657a:	29 c2                	sub    %eax,%edx
+  80657c:	89 d0                	mov    %edx,%eax
+  80657e:	0f b6 09             	movzbl (%rcx),%ecx
+  806581:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806585:	48 98                	cltq
+  806587:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  80658b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80658f:	8b 40 04             	mov    0x4(%rax),%eax
+  806592:	8d 50 01             	lea    0x1(%rax),%edx
+  806595:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806599:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  80659c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8065a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065a5:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8065a9:	72 94                	jb     80653f <devpipe_write+0x9b>
+	}
+
+	return i;
+  8065ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8065af:	48 83 c4 40          	add    $0x40,%rsp
+  8065b3:	5b                   	pop    %rbx
+  8065b4:	41 5f                	pop    %r15
+  8065b6:	5d                   	pop    %rbp
+  8065b7:	c3                   	ret
+
+00000000008065b8 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8065b8:	55                   	push   %rbp
+  8065b9:	48 89 e5             	mov    %rsp,%rbp
+  8065bc:	41 57                	push   %r15
+  8065be:	53                   	push   %rbx
+  8065bf:	48 83 ec 20          	sub    $0x20,%rsp
+  8065c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065c3 <devpipe_stat+0xb>
+  8065ca:	49 bb 7d 3a 00 00 00 	movabs $0x3a7d,%r11
+  8065d1:	00 00 00 
+  8065d4:	4c 01 db             	add    %r11,%rbx
+  8065d7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8065db:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8065df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065e3:	48 89 c7             	mov    %rax,%rdi
+  8065e6:	49 89 df             	mov    %rbx,%r15
+  8065e9:	48 b8 4e 92 ff ff ff 	movabs $0xffffffffffff924e,%rax
+  8065f0:	ff ff ff 
+  8065f3:	48 01 d8             	add    %rbx,%rax
+  8065f6:	ff d0                	call   *%rax
+  8065f8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8065fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806600:	48 ba a0 e0 ff ff ff 	movabs $0xffffffffffffe0a0,%rdx
+  806607:	ff ff ff 
+  80660a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80660e:	48 89 d6             	mov    %rdx,%rsi
+  806611:	48 89 c7             	mov    %rax,%rdi
+  806614:	49 89 df             	mov    %rbx,%r15
+  806617:	48 b8 b2 7d ff ff ff 	movabs $0xffffffffffff7db2,%rax
+  80661e:	ff ff ff 
+  806621:	48 01 d8             	add    %rbx,%rax
+  806624:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  806626:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80662a:	8b 50 04             	mov    0x4(%rax),%edx
+  80662d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806631:	8b 00                	mov    (%rax),%eax
+  806633:	29 c2                	sub    %eax,%edx
+  806635:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806639:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  80663f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806643:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80664a:	00 00 00 
+	stat->st_dev = &devpipe;
+  80664d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806651:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806658:	00 00 00 
+  80665b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80665f:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806666:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80666b:	48 83 c4 20          	add    $0x20,%rsp
+  80666f:	5b                   	pop    %rbx
+  806670:	41 5f                	pop    %r15
+  806672:	5d                   	pop    %rbp
+  806673:	c3                   	ret
+
+0000000000806674 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806674:	55                   	push   %rbp
+  806675:	48 89 e5             	mov    %rsp,%rbp
+  806678:	41 57                	push   %r15
+  80667a:	53                   	push   %rbx
+  80667b:	48 83 ec 10          	sub    $0x10,%rsp
+  80667f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80667f <devpipe_close+0xb>
+  806686:	49 bb c1 39 00 00 00 	movabs $0x39c1,%r11
+  80668d:	00 00 00 
+  806690:	4c 01 db             	add    %r11,%rbx
+  806693:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806697:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80669b:	48 89 c6             	mov    %rax,%rsi
+  80669e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8066a3:	49 89 df             	mov    %rbx,%r15
+  8066a6:	48 b8 46 8b ff ff ff 	movabs $0xffffffffffff8b46,%rax
+  8066ad:	ff ff ff 
+  8066b0:	48 01 d8             	add    %rbx,%rax
+  8066b3:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8066b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066b9:	48 89 c7             	mov    %rax,%rdi
+  8066bc:	49 89 df             	mov    %rbx,%r15
+  8066bf:	48 b8 4e 92 ff ff ff 	movabs $0xffffffffffff924e,%rax
+  8066c6:	ff ff ff 
+  8066c9:	48 01 d8             	add    %rbx,%rax
+  8066cc:	ff d0                	call   *%rax
+  8066ce:	48 89 c6             	mov    %rax,%rsi
+  8066d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8066d6:	49 89 df             	mov    %rbx,%r15
+  8066d9:	48 b8 46 8b ff ff ff 	movabs $0xffffffffffff8b46,%rax
+  8066e0:	ff ff ff 
+  8066e3:	48 01 d8             	add    %rbx,%rax
+  8066e6:	ff d0                	call   *%rax
+}
+  8066e8:	48 83 c4 10          	add    $0x10,%rsp
+  8066ec:	5b                   	pop    %rbx
+  8066ed:	41 5f                	pop    %r15
+  8066ef:	5d                   	pop    %rbp
+  8066f0:	c3                   	ret
+
+00000000008066f1 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8066f1:	55                   	push   %rbp
+  8066f2:	48 89 e5             	mov    %rsp,%rbp
+  8066f5:	41 57                	push   %r15
+  8066f7:	48 83 ec 28          	sub    $0x28,%rsp
+  8066fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8066fb <cputchar+0xa>
+  806702:	49 bb 45 39 00 00 00 	movabs $0x3945,%r11
+  806709:	00 00 00 
+  80670c:	4c 01 d8             	add    %r11,%rax
+  80670f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806712:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806715:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806718:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  80671c:	be 01 00 00 00       	mov    $0x1,%esi
+  806721:	48 89 d7             	mov    %rdx,%rdi
+  806724:	49 89 c7             	mov    %rax,%r15
+  806727:	48 ba b6 88 ff ff ff 	movabs $0xffffffffffff88b6,%rdx
+  80672e:	ff ff ff 
+  806731:	48 01 c2             	add    %rax,%rdx
+  806734:	ff d2                	call   *%rdx
+}
+  806736:	90                   	nop
+  806737:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80673b:	c9                   	leave
+  80673c:	c3                   	ret
+
+000000000080673d <getchar>:
+
+int
+getchar(void)
+{
+  80673d:	55                   	push   %rbp
+  80673e:	48 89 e5             	mov    %rsp,%rbp
+  806741:	41 57                	push   %r15
+  806743:	48 83 ec 18          	sub    $0x18,%rsp
+  806747:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806747 <getchar+0xa>
+  80674e:	49 bb f9 38 00 00 00 	movabs $0x38f9,%r11
+  806755:	00 00 00 
+  806758:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  80675b:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80675f:	ba 01 00 00 00       	mov    $0x1,%edx
+  806764:	48 89 ce             	mov    %rcx,%rsi
+  806767:	bf 00 00 00 00       	mov    $0x0,%edi
+  80676c:	49 89 c7             	mov    %rax,%r15
+  80676f:	48 b9 8e 98 ff ff ff 	movabs $0xffffffffffff988e,%rcx
+  806776:	ff ff ff 
+  806779:	48 01 c1             	add    %rax,%rcx
+  80677c:	ff d1                	call   *%rcx
+  80677e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806781:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806785:	79 05                	jns    80678c <getchar+0x4f>
+		return r;
+  806787:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80678a:	eb 14                	jmp    8067a0 <getchar+0x63>
+	if (r < 1)
+  80678c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806790:	7f 07                	jg     806799 <getchar+0x5c>
+		return -E_EOF;
+  806792:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806797:	eb 07                	jmp    8067a0 <getchar+0x63>
+	return c;
+  806799:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  80679d:	0f b6 c0             	movzbl %al,%eax
+}
+  8067a0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8067a4:	c9                   	leave
+  8067a5:	c3                   	ret
+
+00000000008067a6 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8067a6:	55                   	push   %rbp
+  8067a7:	48 89 e5             	mov    %rsp,%rbp
+  8067aa:	41 57                	push   %r15
+  8067ac:	53                   	push   %rbx
+  8067ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8067b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067b1 <iscons+0xb>
+  8067b8:	49 bb 8f 38 00 00 00 	movabs $0x388f,%r11
+  8067bf:	00 00 00 
+  8067c2:	4c 01 db             	add    %r11,%rbx
+  8067c5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8067c8:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8067cc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8067cf:	48 89 d6             	mov    %rdx,%rsi
+  8067d2:	89 c7                	mov    %eax,%edi
+  8067d4:	49 89 df             	mov    %rbx,%r15
+  8067d7:	48 b8 47 93 ff ff ff 	movabs $0xffffffffffff9347,%rax
+  8067de:	ff ff ff 
+  8067e1:	48 01 d8             	add    %rbx,%rax
+  8067e4:	ff d0                	call   *%rax
+  8067e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8067e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067ed:	79 05                	jns    8067f4 <iscons+0x4e>
+		return r;
+  8067ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067f2:	eb 1b                	jmp    80680f <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8067f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067f8:	8b 10                	mov    (%rax),%edx
+  8067fa:	48 b8 40 01 00 00 00 	movabs $0x140,%rax
+  806801:	00 00 00 
+  806804:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806807:	39 c2                	cmp    %eax,%edx
+  806809:	0f 94 c0             	sete   %al
+  80680c:	0f b6 c0             	movzbl %al,%eax
+}
+  80680f:	48 83 c4 20          	add    $0x20,%rsp
+  806813:	5b                   	pop    %rbx
+  806814:	41 5f                	pop    %r15
+  806816:	5d                   	pop    %rbp
+  806817:	c3                   	ret
+
+0000000000806818 <opencons>:
+
+int
+opencons(void)
+{
+  806818:	55                   	push   %rbp
+  806819:	48 89 e5             	mov    %rsp,%rbp
+  80681c:	41 57                	push   %r15
+  80681e:	53                   	push   %rbx
+  80681f:	48 83 ec 10          	sub    $0x10,%rsp
+  806823:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806823 <opencons+0xb>
+  80682a:	49 bb 1d 38 00 00 00 	movabs $0x381d,%r11
+  806831:	00 00 00 
+  806834:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806837:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80683b:	48 89 c7             	mov    %rax,%rdi
+  80683e:	49 89 df             	mov    %rbx,%r15
+  806841:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  806848:	ff ff ff 
+  80684b:	48 01 d8             	add    %rbx,%rax
+  80684e:	ff d0                	call   *%rax
+  806850:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806853:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806857:	79 05                	jns    80685e <opencons+0x46>
+		return r;
+  806859:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80685c:	eb 68                	jmp    8068c6 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80685e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806862:	ba 07 04 00 00       	mov    $0x407,%edx
+  806867:	48 89 c6             	mov    %rax,%rsi
+  80686a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80686f:	49 89 df             	mov    %rbx,%r15
+  806872:	48 b8 6e 8a ff ff ff 	movabs $0xffffffffffff8a6e,%rax
+  806879:	ff ff ff 
+  80687c:	48 01 d8             	add    %rbx,%rax
+  80687f:	ff d0                	call   *%rax
+  806881:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806884:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806888:	79 05                	jns    80688f <opencons+0x77>
+		return r;
+  80688a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80688d:	eb 37                	jmp    8068c6 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80688f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806893:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  80689a:	00 00 00 
+  80689d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8068a0:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8068a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8068a6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8068ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8068b1:	48 89 c7             	mov    %rax,%rdi
+  8068b4:	49 89 df             	mov    %rbx,%r15
+  8068b7:	48 b8 17 92 ff ff ff 	movabs $0xffffffffffff9217,%rax
+  8068be:	ff ff ff 
+  8068c1:	48 01 d8             	add    %rbx,%rax
+  8068c4:	ff d0                	call   *%rax
+}
+  8068c6:	48 83 c4 10          	add    $0x10,%rsp
+  8068ca:	5b                   	pop    %rbx
+  8068cb:	41 5f                	pop    %r15
+  8068cd:	5d                   	pop    %rbp
+  8068ce:	c3                   	ret
+
+00000000008068cf <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8068cf:	55                   	push   %rbp
+  8068d0:	48 89 e5             	mov    %rsp,%rbp
+  8068d3:	41 57                	push   %r15
+  8068d5:	53                   	push   %rbx
+  8068d6:	48 83 ec 30          	sub    $0x30,%rsp
+  8068da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068da <devcons_read+0xb>
+  8068e1:	49 bb 66 37 00 00 00 	movabs $0x3766,%r11
+  8068e8:	00 00 00 
+  8068eb:	4c 01 db             	add    %r11,%rbx
+  8068ee:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8068f2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8068f6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8068fa:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8068ff:	75 19                	jne    80691a <devcons_read+0x4b>
+		return 0;
+  806901:	b8 00 00 00 00       	mov    $0x0,%eax
+  806906:	eb 55                	jmp    80695d <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806908:	49 89 df             	mov    %rbx,%r15
+  80690b:	48 b8 19 8a ff ff ff 	movabs $0xffffffffffff8a19,%rax
+  806912:	ff ff ff 
+  806915:	48 01 d8             	add    %rbx,%rax
+  806918:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  80691a:	49 89 df             	mov    %rbx,%r15
+  80691d:	48 b8 15 89 ff ff ff 	movabs $0xffffffffffff8915,%rax
+  806924:	ff ff ff 
+  806927:	48 01 d8             	add    %rbx,%rax
+  80692a:	ff d0                	call   *%rax
+  80692c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80692f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806933:	74 d3                	je     806908 <devcons_read+0x39>
+	if (c < 0)
+  806935:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806939:	79 05                	jns    806940 <devcons_read+0x71>
+		return c;
+  80693b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80693e:	eb 1d                	jmp    80695d <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806940:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806944:	75 07                	jne    80694d <devcons_read+0x7e>
+		return 0;
+  806946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80694b:	eb 10                	jmp    80695d <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  80694d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806950:	89 c2                	mov    %eax,%edx
+  806952:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806956:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806958:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80695d:	48 83 c4 30          	add    $0x30,%rsp
+  806961:	5b                   	pop    %rbx
+  806962:	41 5f                	pop    %r15
+  806964:	5d                   	pop    %rbp
+  806965:	c3                   	ret
+
+0000000000806966 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806966:	55                   	push   %rbp
+  806967:	48 89 e5             	mov    %rsp,%rbp
+  80696a:	41 57                	push   %r15
+  80696c:	53                   	push   %rbx
+  80696d:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806974:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806974 <devcons_write+0xe>
+  80697b:	49 bb cc 36 00 00 00 	movabs $0x36cc,%r11
+  806982:	00 00 00 
+  806985:	4c 01 db             	add    %r11,%rbx
+  806988:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80698f:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806996:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  80699d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8069a4:	e9 80 00 00 00       	jmp    806a29 <devcons_write+0xc3>
+		m = n - tot;
+  8069a9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8069b0:	89 c2                	mov    %eax,%edx
+  8069b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069b5:	29 c2                	sub    %eax,%edx
+  8069b7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8069ba:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8069bd:	83 f8 7f             	cmp    $0x7f,%eax
+  8069c0:	76 07                	jbe    8069c9 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8069c2:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8069c9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8069cc:	48 63 d0             	movslq %eax,%rdx
+  8069cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069d2:	48 63 c8             	movslq %eax,%rcx
+  8069d5:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8069dc:	48 01 c1             	add    %rax,%rcx
+  8069df:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8069e6:	48 89 ce             	mov    %rcx,%rsi
+  8069e9:	48 89 c7             	mov    %rax,%rdi
+  8069ec:	49 89 df             	mov    %rbx,%r15
+  8069ef:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  8069f6:	ff ff ff 
+  8069f9:	48 01 d8             	add    %rbx,%rax
+  8069fc:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8069fe:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806a01:	48 63 d0             	movslq %eax,%rdx
+  806a04:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806a0b:	48 89 d6             	mov    %rdx,%rsi
+  806a0e:	48 89 c7             	mov    %rax,%rdi
+  806a11:	49 89 df             	mov    %rbx,%r15
+  806a14:	48 b8 b6 88 ff ff ff 	movabs $0xffffffffffff88b6,%rax
+  806a1b:	ff ff ff 
+  806a1e:	48 01 d8             	add    %rbx,%rax
+  806a21:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806a23:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806a26:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806a29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a2c:	48 98                	cltq
+  806a2e:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806a35:	0f 82 6e ff ff ff    	jb     8069a9 <devcons_write+0x43>
+	}
+	return tot;
+  806a3b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806a3e:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806a45:	5b                   	pop    %rbx
+  806a46:	41 5f                	pop    %r15
+  806a48:	5d                   	pop    %rbp
+  806a49:	c3                   	ret
+
+0000000000806a4a <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806a4a:	55                   	push   %rbp
+  806a4b:	48 89 e5             	mov    %rsp,%rbp
+  806a4e:	48 83 ec 08          	sub    $0x8,%rsp
+  806a52:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a52 <devcons_close+0x8>
+  806a59:	49 bb ee 35 00 00 00 	movabs $0x35ee,%r11
+  806a60:	00 00 00 
+  806a63:	4c 01 d8             	add    %r11,%rax
+  806a66:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a6f:	c9                   	leave
+  806a70:	c3                   	ret
+
+0000000000806a71 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806a71:	55                   	push   %rbp
+  806a72:	48 89 e5             	mov    %rsp,%rbp
+  806a75:	41 57                	push   %r15
+  806a77:	48 83 ec 18          	sub    $0x18,%rsp
+  806a7b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a7b <devcons_stat+0xa>
+  806a82:	49 bb c5 35 00 00 00 	movabs $0x35c5,%r11
+  806a89:	00 00 00 
+  806a8c:	4c 01 d8             	add    %r11,%rax
+  806a8f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806a93:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806a97:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806a9b:	48 b9 ac e0 ff ff ff 	movabs $0xffffffffffffe0ac,%rcx
+  806aa2:	ff ff ff 
+  806aa5:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806aa9:	48 89 ce             	mov    %rcx,%rsi
+  806aac:	48 89 d7             	mov    %rdx,%rdi
+  806aaf:	49 89 c7             	mov    %rax,%r15
+  806ab2:	48 ba b2 7d ff ff ff 	movabs $0xffffffffffff7db2,%rdx
+  806ab9:	ff ff ff 
+  806abc:	48 01 c2             	add    %rax,%rdx
+  806abf:	ff d2                	call   *%rdx
+	return 0;
+  806ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806ac6:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806aca:	c9                   	leave
+  806acb:	c3                   	ret
+
+0000000000806acc <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806acc:	55                   	push   %rbp
+  806acd:	48 89 e5             	mov    %rsp,%rbp
+  806ad0:	41 57                	push   %r15
+  806ad2:	53                   	push   %rbx
+  806ad3:	48 83 ec 30          	sub    $0x30,%rsp
+  806ad7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ad7 <ipc_recv+0xb>
+  806ade:	49 bb 69 35 00 00 00 	movabs $0x3569,%r11
+  806ae5:	00 00 00 
+  806ae8:	4c 01 db             	add    %r11,%rbx
+  806aeb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806aef:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806af3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  806af7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806afc:	75 0e                	jne    806b0c <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  806afe:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806b05:	00 00 00 
+  806b08:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  806b0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806b10:	48 89 c7             	mov    %rax,%rdi
+  806b13:	49 89 df             	mov    %rbx,%r15
+  806b16:	48 b8 97 8d ff ff ff 	movabs $0xffffffffffff8d97,%rax
+  806b1d:	ff ff ff 
+  806b20:	48 01 d8             	add    %rbx,%rax
+  806b23:	ff d0                	call   *%rax
+  806b25:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  806b28:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806b2d:	74 2a                	je     806b59 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  806b2f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b33:	75 19                	jne    806b4e <ipc_recv+0x82>
+  806b35:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806b3c:	ff ff ff 
+  806b3f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b43:	48 8b 00             	mov    (%rax),%rax
+  806b46:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806b4c:	eb 05                	jmp    806b53 <ipc_recv+0x87>
+  806b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b53:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806b57:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806b59:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806b5e:	74 2a                	je     806b8a <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  806b60:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b64:	75 19                	jne    806b7f <ipc_recv+0xb3>
+  806b66:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806b6d:	ff ff ff 
+  806b70:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b74:	48 8b 00             	mov    (%rax),%rax
+  806b77:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806b7d:	eb 05                	jmp    806b84 <ipc_recv+0xb8>
+  806b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b84:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806b88:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806b8a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b8e:	74 05                	je     806b95 <ipc_recv+0xc9>
+		return res;
+  806b90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b93:	eb 17                	jmp    806bac <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806b95:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806b9c:	ff ff ff 
+  806b9f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806ba3:	48 8b 00             	mov    (%rax),%rax
+  806ba6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806bac:	48 83 c4 30          	add    $0x30,%rsp
+  806bb0:	5b                   	pop    %rbx
+  806bb1:	41 5f                	pop    %r15
+  806bb3:	5d                   	pop    %rbp
+  806bb4:	c3                   	ret
+
+0000000000806bb5 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806bb5:	55                   	push   %rbp
+  806bb6:	48 89 e5             	mov    %rsp,%rbp
+  806bb9:	41 57                	push   %r15
+  806bbb:	53                   	push   %rbx
+  806bbc:	48 83 ec 20          	sub    $0x20,%rsp
+  806bc0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806bc0 <ipc_send+0xb>
+  806bc7:	49 bb 80 34 00 00 00 	movabs $0x3480,%r11
+  806bce:	00 00 00 
+  806bd1:	4c 01 db             	add    %r11,%rbx
+  806bd4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806bd7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806bda:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806bde:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  806be1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806be6:	75 0e                	jne    806bf6 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806be8:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806bef:	00 00 00 
+  806bf2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  806bf6:	90                   	nop
+  806bf7:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806bfa:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806bfd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806c01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c04:	89 c7                	mov    %eax,%edi
+  806c06:	49 89 df             	mov    %rbx,%r15
+  806c09:	48 b8 2d 8d ff ff ff 	movabs $0xffffffffffff8d2d,%rax
+  806c10:	ff ff ff 
+  806c13:	48 01 d8             	add    %rbx,%rax
+  806c16:	ff d0                	call   *%rax
+  806c18:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  806c1b:	74 da                	je     806bf7 <ipc_send+0x42>
+		;
+}
+  806c1d:	90                   	nop
+  806c1e:	90                   	nop
+  806c1f:	48 83 c4 20          	add    $0x20,%rsp
+  806c23:	5b                   	pop    %rbx
+  806c24:	41 5f                	pop    %r15
+  806c26:	5d                   	pop    %rbp
+  806c27:	c3                   	ret
+
+0000000000806c28 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  806c28:	55                   	push   %rbp
+  806c29:	48 89 e5             	mov    %rsp,%rbp
+  806c2c:	41 57                	push   %r15
+  806c2e:	53                   	push   %rbx
+  806c2f:	48 83 ec 40          	sub    $0x40,%rsp
+  806c33:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c33 <ipc_call+0xb>
+  806c3a:	49 bb 0d 34 00 00 00 	movabs $0x340d,%r11
+  806c41:	00 00 00 
+  806c44:	4c 01 db             	add    %r11,%rbx
+  806c47:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806c4a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806c4d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806c51:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806c54:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806c58:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806c5c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806c61:	75 0e                	jne    806c71 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806c63:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806c6a:	00 00 00 
+  806c6d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806c71:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806c76:	75 0e                	jne    806c86 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806c78:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806c7f:	00 00 00 
+  806c82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806c86:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806c89:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806c8d:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806c90:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806c94:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806c97:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806c9d:	49 89 f8             	mov    %rdi,%r8
+  806ca0:	89 c7                	mov    %eax,%edi
+  806ca2:	49 89 df             	mov    %rbx,%r15
+  806ca5:	48 b8 f0 8d ff ff ff 	movabs $0xffffffffffff8df0,%rax
+  806cac:	ff ff ff 
+  806caf:	48 01 d8             	add    %rbx,%rax
+  806cb2:	ff d0                	call   *%rax
+  806cb4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806cb7:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806cbc:	74 2a                	je     806ce8 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806cbe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806cc2:	75 19                	jne    806cdd <ipc_call+0xb5>
+  806cc4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806ccb:	ff ff ff 
+  806cce:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806cd2:	48 8b 00             	mov    (%rax),%rax
+  806cd5:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806cdb:	eb 05                	jmp    806ce2 <ipc_call+0xba>
+  806cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ce2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806ce6:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806ce8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806cec:	74 05                	je     806cf3 <ipc_call+0xcb>
+		return r;
+  806cee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806cf1:	eb 17                	jmp    806d0a <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806cf3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806cfa:	ff ff ff 
+  806cfd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d01:	48 8b 00             	mov    (%rax),%rax
+  806d04:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806d0a:	48 83 c4 40          	add    $0x40,%rsp
+  806d0e:	5b                   	pop    %rbx
+  806d0f:	41 5f                	pop    %r15
+  806d11:	5d                   	pop    %rbp
+  806d12:	c3                   	ret
+
+0000000000806d13 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806d13:	55                   	push   %rbp
+  806d14:	48 89 e5             	mov    %rsp,%rbp
+  806d17:	41 57                	push   %r15
+  806d19:	53                   	push   %rbx
+  806d1a:	48 83 ec 70          	sub    $0x70,%rsp
+  806d1e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d1e <ipc_callw+0xb>
+  806d25:	49 bb 22 33 00 00 00 	movabs $0x3322,%r11
+  806d2c:	00 00 00 
+  806d2f:	4c 01 db             	add    %r11,%rbx
+  806d32:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806d35:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806d38:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806d3c:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806d40:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806d45:	76 0a                	jbe    806d51 <ipc_callw+0x3e>
+		return -E_INVAL;
+  806d47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806d4c:	e9 b7 00 00 00       	jmp    806e08 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806d51:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806d55:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806d59:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806d5d:	48 89 ce             	mov    %rcx,%rsi
+  806d60:	48 89 c7             	mov    %rax,%rdi
+  806d63:	49 89 df             	mov    %rbx,%r15
+  806d66:	48 b8 92 81 ff ff ff 	movabs $0xffffffffffff8192,%rax
+  806d6d:	ff ff ff 
+  806d70:	48 01 d8             	add    %rbx,%rax
+  806d73:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806d75:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806d7c:	00 
+  806d7d:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806d81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806d85:	48 01 d0             	add    %rdx,%rax
+  806d88:	48 83 e8 01          	sub    $0x1,%rax
+  806d8c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806d90:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d94:	ba 00 00 00 00       	mov    $0x0,%edx
+  806d99:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806d9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806da1:	48 29 d0             	sub    %rdx,%rax
+  806da4:	48 c1 e8 03          	shr    $0x3,%rax
+  806da8:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806dac:	89 c1                	mov    %eax,%ecx
+  806dae:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806db1:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806db5:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806db8:	49 89 d1             	mov    %rdx,%r9
+  806dbb:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806dc2:	00 00 00 
+  806dc5:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806dcc:	00 00 00 
+  806dcf:	89 c7                	mov    %eax,%edi
+  806dd1:	49 89 df             	mov    %rbx,%r15
+  806dd4:	48 b8 f0 8d ff ff ff 	movabs $0xffffffffffff8df0,%rax
+  806ddb:	ff ff ff 
+  806dde:	48 01 d8             	add    %rbx,%rax
+  806de1:	ff d0                	call   *%rax
+  806de3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806de6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806dea:	74 05                	je     806df1 <ipc_callw+0xde>
+		return r;
+  806dec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806def:	eb 17                	jmp    806e08 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806df1:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806df8:	ff ff ff 
+  806dfb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806dff:	48 8b 00             	mov    (%rax),%rax
+  806e02:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806e08:	48 83 c4 70          	add    $0x70,%rsp
+  806e0c:	5b                   	pop    %rbx
+  806e0d:	41 5f                	pop    %r15
+  806e0f:	5d                   	pop    %rbp
+  806e10:	c3                   	ret
+
+0000000000806e11 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806e11:	55                   	push   %rbp
+  806e12:	48 89 e5             	mov    %rsp,%rbp
+  806e15:	41 57                	push   %r15
+  806e17:	53                   	push   %rbx
+  806e18:	48 83 ec 40          	sub    $0x40,%rsp
+  806e1c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806e1c <ipc_callv+0xb>
+  806e23:	49 bb 24 32 00 00 00 	movabs $0x3224,%r11
+  806e2a:	00 00 00 
+  806e2d:	4c 01 db             	add    %r11,%rbx
+  806e30:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806e33:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806e36:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806e3a:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806e3d:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806e41:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806e45:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806e4c:	00 00 00 
+  806e4f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806e53:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806e57:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806e5b:	74 11                	je     806e6e <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806e5d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806e61:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806e65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806e68:	c1 e0 14             	shl    $0x14,%eax
+  806e6b:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806e6e:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806e72:	74 14                	je     806e88 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806e74:	8b 45 20             	mov    0x20(%rbp),%eax
+  806e77:	83 e8 01             	sub    $0x1,%eax
+  806e7a:	48 63 d0             	movslq %eax,%rdx
+  806e7d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806e81:	48 09 d0             	or     %rdx,%rax
+  806e84:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806e88:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806e8b:	c1 e0 10             	shl    $0x10,%eax
+  806e8e:	0b 45 10             	or     0x10(%rbp),%eax
+  806e91:	89 c1                	mov    %eax,%ecx
+  806e93:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806e96:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806e9a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806e9e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806ea2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806ea5:	4d 89 c1             	mov    %r8,%r9
+  806ea8:	49 89 f8             	mov    %rdi,%r8
+  806eab:	89 c7                	mov    %eax,%edi
+  806ead:	49 89 df             	mov    %rbx,%r15
+  806eb0:	48 b8 f0 8d ff ff ff 	movabs $0xffffffffffff8df0,%rax
+  806eb7:	ff ff ff 
+  806eba:	48 01 d8             	add    %rbx,%rax
+  806ebd:	ff d0                	call   *%rax
+  806ebf:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806ec2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806ec6:	74 05                	je     806ecd <ipc_callv+0xbc>
+		return r;
+  806ec8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806ecb:	eb 17                	jmp    806ee4 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806ecd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806ed4:	ff ff ff 
+  806ed7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806edb:	48 8b 00             	mov    (%rax),%rax
+  806ede:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806ee4:	48 83 c4 40          	add    $0x40,%rsp
+  806ee8:	5b                   	pop    %rbx
+  806ee9:	41 5f                	pop    %r15
+  806eeb:	5d                   	pop    %rbp
+  806eec:	c3                   	ret
+
+0000000000806eed <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806eed:	55                   	push   %rbp
+  806eee:	48 89 e5             	mov    %rsp,%rbp
+  806ef1:	41 57                	push   %r15
+  806ef3:	53                   	push   %rbx
+  806ef4:	48 83 ec 40          	sub    $0x40,%rsp
+  806ef8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ef8 <ipc_reply_recv+0xb>
+  806eff:	49 bb 48 31 00 00 00 	movabs $0x3148,%r11
+  806f06:	00 00 00 
+  806f09:	4c 01 db             	add    %r11,%rbx
+  806f0c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806f0f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806f12:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806f16:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806f19:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806f1d:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806f21:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806f26:	75 0e                	jne    806f36 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806f28:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806f2f:	00 00 00 
+  806f32:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806f36:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806f3b:	75 0e                	jne    806f4b <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806f3d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806f44:	00 00 00 
+  806f47:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806f4b:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806f4e:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806f52:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806f56:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806f59:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806f5d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806f60:	4d 89 c1             	mov    %r8,%r9
+  806f63:	49 89 f8             	mov    %rdi,%r8
+  806f66:	89 c7                	mov    %eax,%edi
+  806f68:	49 89 df             	mov    %rbx,%r15
+  806f6b:	48 b8 64 8e ff ff ff 	movabs $0xffffffffffff8e64,%rax
+  806f72:	ff ff ff 
+  806f75:	48 01 d8             	add    %rbx,%rax
+  806f78:	ff d0                	call   *%rax
+  806f7a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806f7d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806f82:	74 2a                	je     806fae <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806f84:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806f88:	75 19                	jne    806fa3 <ipc_reply_recv+0xb6>
+  806f8a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806f91:	ff ff ff 
+  806f94:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806f98:	48 8b 00             	mov    (%rax),%rax
+  806f9b:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806fa1:	eb 05                	jmp    806fa8 <ipc_reply_recv+0xbb>
+  806fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  806fa8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806fac:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806fae:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806fb3:	74 2a                	je     806fdf <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806fb5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806fb9:	75 19                	jne    806fd4 <ipc_reply_recv+0xe7>
+  806fbb:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806fc2:	ff ff ff 
+  806fc5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806fc9:	48 8b 00             	mov    (%rax),%rax
+  806fcc:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806fd2:	eb 05                	jmp    806fd9 <ipc_reply_recv+0xec>
+  806fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  806fd9:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806fdd:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806fdf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806fe3:	74 05                	je     806fea <ipc_reply_recv+0xfd>
+		return r;
+  806fe5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806fe8:	eb 17                	jmp    807001 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806fea:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806ff1:	ff ff ff 
+  806ff4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806ff8:	48 8b 00             	mov    (%rax),%rax
+  806ffb:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  807001:	48 83 c4 40          	add    $0x40,%rsp
+  807005:	5b                   	pop    %rbx
+  807006:	41 5f                	pop    %r15
+  807008:	5d                   	pop    %rbp
+  807009:	c3                   	ret
+
+000000000080700a <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  80700a:	55                   	push   %rbp
+  80700b:	48 89 e5             	mov    %rsp,%rbp
+  80700e:	41 57                	push   %r15
+  807010:	53                   	push   %rbx
+  807011:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  807018:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807018 <ipc_window_batch+0xe>
+  80701f:	49 bb 28 30 00 00 00 	movabs $0x3028,%r11
+  807026:	00 00 00 
+  807029:	4c 01 db             	add    %r11,%rbx
+  80702c:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  807032:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  807039:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  80703f:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  807045:	e9 15 01 00 00       	jmp    80715f <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  80704a:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  807050:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  807053:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  80705a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80705d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807060:	39 c2                	cmp    %eax,%edx
+  807062:	0f 4e c2             	cmovle %edx,%eax
+  807065:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  807068:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80706f:	eb 6b                	jmp    8070dc <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  807071:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807074:	48 98                	cltq
+  807076:	48 c1 e0 05          	shl    $0x5,%rax
+  80707a:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80707e:	48 01 e8             	add    %rbp,%rax
+  807081:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  807087:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  80708d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807090:	c1 e0 0c             	shl    $0xc,%eax
+  807093:	48 63 d0             	movslq %eax,%rdx
+  807096:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  80709d:	48 01 c2             	add    %rax,%rdx
+  8070a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8070a3:	48 98                	cltq
+  8070a5:	48 c1 e0 05          	shl    $0x5,%rax
+  8070a9:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8070ad:	48 01 e8             	add    %rbp,%rax
+  8070b0:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  8070b6:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  8070b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8070bc:	48 98                	cltq
+  8070be:	48 c1 e0 05          	shl    $0x5,%rax
+  8070c2:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8070c6:	48 01 e8             	add    %rbp,%rax
+  8070c9:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  8070d0:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  8070d6:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  8070d8:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8070dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8070df:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  8070e2:	7c 8d                	jl     807071 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  8070e4:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8070eb:	74 27                	je     807114 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8070ed:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8070f0:	48 63 d0             	movslq %eax,%rdx
+  8070f3:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8070fa:	48 89 d6             	mov    %rdx,%rsi
+  8070fd:	48 89 c7             	mov    %rax,%rdi
+  807100:	49 89 df             	mov    %rbx,%r15
+  807103:	48 b8 07 91 ff ff ff 	movabs $0xffffffffffff9107,%rax
+  80710a:	ff ff ff 
+  80710d:	48 01 d8             	add    %rbx,%rax
+  807110:	ff d0                	call   *%rax
+  807112:	eb 25                	jmp    807139 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  807114:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807117:	48 63 d0             	movslq %eax,%rdx
+  80711a:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  807121:	48 89 d6             	mov    %rdx,%rsi
+  807124:	48 89 c7             	mov    %rax,%rdi
+  807127:	49 89 df             	mov    %rbx,%r15
+  80712a:	48 b8 65 91 ff ff ff 	movabs $0xffffffffffff9165,%rax
+  807131:	ff ff ff 
+  807134:	48 01 d8             	add    %rbx,%rax
+  807137:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  807139:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  80713c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  807140:	79 05                	jns    807147 <ipc_window_batch+0x13d>
+			return r;
+  807142:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807145:	eb 2a                	jmp    807171 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  807147:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80714a:	c1 e0 0c             	shl    $0xc,%eax
+  80714d:	48 98                	cltq
+  80714f:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  807156:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807159:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  80715f:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  807166:	0f 8f de fe ff ff    	jg     80704a <ipc_window_batch+0x40>
+	}
+	return 0;
+  80716c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807171:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  807178:	5b                   	pop    %rbx
+  807179:	41 5f                	pop    %r15
+  80717b:	5d                   	pop    %rbp
+  80717c:	c3                   	ret
+
+000000000080717d <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  80717d:	55                   	push   %rbp
+  80717e:	48 89 e5             	mov    %rsp,%rbp
+  807181:	48 83 ec 10          	sub    $0x10,%rsp
+  807185:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807185 <ipc_map_window+0x8>
+  80718c:	49 bb bb 2e 00 00 00 	movabs $0x2ebb,%r11
+  807193:	00 00 00 
+  807196:	4c 01 d8             	add    %r11,%rax
+  807199:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80719d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  8071a0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8071a3:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8071a7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8071ac:	bf 01 00 00 00       	mov    $0x1,%edi
+  8071b1:	49 b8 ca cf ff ff ff 	movabs $0xffffffffffffcfca,%r8
+  8071b8:	ff ff ff 
+  8071bb:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8071bf:	ff d0                	call   *%rax
+}
+  8071c1:	c9                   	leave
+  8071c2:	c3                   	ret
+
+00000000008071c3 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  8071c3:	55                   	push   %rbp
+  8071c4:	48 89 e5             	mov    %rsp,%rbp
+  8071c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8071cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8071cb <ipc_unmap_window+0x8>
+  8071d2:	49 bb 75 2e 00 00 00 	movabs $0x2e75,%r11
+  8071d9:	00 00 00 
+  8071dc:	4c 01 d8             	add    %r11,%rax
+  8071df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8071e3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8071e6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8071e9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8071ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8071f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8071f7:	49 b8 ca cf ff ff ff 	movabs $0xffffffffffffcfca,%r8
+  8071fe:	ff ff ff 
+  807201:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  807205:	ff d0                	call   *%rax
+}
+  807207:	c9                   	leave
+  807208:	c3                   	ret
+
+0000000000807209 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  807209:	55                   	push   %rbp
+  80720a:	48 89 e5             	mov    %rsp,%rbp
+  80720d:	48 83 ec 18          	sub    $0x18,%rsp
+  807211:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807211 <ipc_find_env+0x8>
+  807218:	49 bb 2f 2e 00 00 00 	movabs $0x2e2f,%r11
+  80721f:	00 00 00 
+  807222:	4c 01 d8             	add    %r11,%rax
+  807225:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  807228:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80722f:	eb 57                	jmp    807288 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  807231:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  807238:	ff ff ff 
+  80723b:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  80723f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  807242:	48 63 d2             	movslq %edx,%rdx
+  807245:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  80724c:	48 01 ca             	add    %rcx,%rdx
+  80724f:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  807256:	8b 12                	mov    (%rdx),%edx
+  807258:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  80725b:	75 27                	jne    807284 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  80725d:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  807264:	ff ff ff 
+  807267:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80726b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80726e:	48 98                	cltq
+  807270:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  807277:	48 01 d0             	add    %rdx,%rax
+  80727a:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  807280:	8b 00                	mov    (%rax),%eax
+  807282:	eb 12                	jmp    807296 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  807284:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  807288:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80728f:	7e a0                	jle    807231 <ipc_find_env+0x28>
+	}
+	return 0;
+  807291:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807296:	c9                   	leave
+  807297:	c3                   	ret
+
+0000000000807298 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  807298:	55                   	push   %rbp
+  807299:	48 89 e5             	mov    %rsp,%rbp
+  80729c:	48 83 ec 18          	sub    $0x18,%rsp
+  8072a0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8072a0 <pageref+0x8>
+  8072a7:	49 bb a0 2d 00 00 00 	movabs $0x2da0,%r11
+  8072ae:	00 00 00 
+  8072b1:	4c 01 d8             	add    %r11,%rax
+  8072b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  8072b8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8072bc:	48 89 d1             	mov    %rdx,%rcx
+  8072bf:	48 c1 e9 15          	shr    $0x15,%rcx
+  8072c3:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8072ca:	ff ff ff 
+  8072cd:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8072d1:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8072d5:	83 e2 01             	and    $0x1,%edx
+  8072d8:	48 85 d2             	test   %rdx,%rdx
+  8072db:	75 07                	jne    8072e4 <pageref+0x4c>
+		return 0;
+  8072dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8072e2:	eb 64                	jmp    807348 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  8072e4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8072e8:	48 89 d1             	mov    %rdx,%rcx
+  8072eb:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8072ef:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8072f6:	ff ff ff 
+  8072f9:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8072fd:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807301:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  807305:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  807309:	83 e2 01             	and    $0x1,%edx
+  80730c:	48 85 d2             	test   %rdx,%rdx
+  80730f:	75 07                	jne    807318 <pageref+0x80>
+		return 0;
+  807311:	b8 00 00 00 00       	mov    $0x0,%eax
+  807316:	eb 30                	jmp    807348 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  807318:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80731c:	48 c1 ea 0c          	shr    $0xc,%rdx
+  807320:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  807327:	ff ff ff 
+  80732a:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  80732e:	48 89 d0             	mov    %rdx,%rax
+  807331:	48 01 c0             	add    %rax,%rax
+  807334:	48 01 d0             	add    %rdx,%rax
+  807337:	48 c1 e0 03          	shl    $0x3,%rax
+  80733b:	48 01 c8             	add    %rcx,%rax
+  80733e:	48 83 c0 08          	add    $0x8,%rax
+  807342:	0f b7 00             	movzwl (%rax),%eax
+  807345:	0f b7 c0             	movzwl %ax,%eax
+}
+  807348:	c9                   	leave
+  807349:	c3                   	ret
+
+000000000080734a <inet_addr>:
+ * @param cp IP address in ascii represenation (e.g. "127.0.0.1")
+ * @return ip address in network order
+ */
+u32_t
+inet_addr(const char *cp)
+{
+  80734a:	55                   	push   %rbp
+  80734b:	48 89 e5             	mov    %rsp,%rbp
+  80734e:	48 83 ec 20          	sub    $0x20,%rsp
+  807352:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807352 <inet_addr+0x8>
+  807359:	49 bb ee 2c 00 00 00 	movabs $0x2cee,%r11
+  807360:	00 00 00 
+  807363:	4c 01 d8             	add    %r11,%rax
+  807366:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct in_addr val;
+
+  if (inet_aton(cp, &val)) {
+  80736a:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80736e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807372:	48 89 ce             	mov    %rcx,%rsi
+  807375:	48 89 d7             	mov    %rdx,%rdi
+  807378:	48 ba 58 d3 ff ff ff 	movabs $0xffffffffffffd358,%rdx
+  80737f:	ff ff ff 
+  807382:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  807386:	ff d0                	call   *%rax
+  807388:	85 c0                	test   %eax,%eax
+  80738a:	74 05                	je     807391 <inet_addr+0x47>
+    return (val.s_addr);
+  80738c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80738f:	eb 05                	jmp    807396 <inet_addr+0x4c>
+  }
+  return (INADDR_NONE);
+  807391:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  807396:	c9                   	leave
+  807397:	c3                   	ret
+
+0000000000807398 <inet_aton>:
+ * @param addr pointer to which to save the ip address in network order
+ * @return 1 if cp could be converted to addr, 0 on failure
+ */
+int
+inet_aton(const char *cp, struct in_addr *addr)
+{
+  807398:	55                   	push   %rbp
+  807399:	48 89 e5             	mov    %rsp,%rbp
+  80739c:	48 83 ec 40          	sub    $0x40,%rsp
+  8073a0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8073a0 <inet_aton+0x8>
+  8073a7:	49 bb a0 2c 00 00 00 	movabs $0x2ca0,%r11
+  8073ae:	00 00 00 
+  8073b1:	4c 01 d8             	add    %r11,%rax
+  8073b4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8073b8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  u32_t val;
+  int base, n, c;
+  u32_t parts[4];
+  u32_t *pp = parts;
+  8073bc:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8073c0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+
+  c = *cp;
+  8073c4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8073c8:	0f b6 12             	movzbl (%rdx),%edx
+  8073cb:	0f be d2             	movsbl %dl,%edx
+  8073ce:	89 55 f4             	mov    %edx,-0xc(%rbp)
+    /*
+     * Collect number up to ``.''.
+     * Values are specified as for C:
+     * 0x=hex, 0=octal, 1-9=decimal.
+     */
+    if (!isdigit(c))
+  8073d1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8073d4:	80 fa 2f             	cmp    $0x2f,%dl
+  8073d7:	76 08                	jbe    8073e1 <inet_aton+0x49>
+  8073d9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8073dc:	80 fa 39             	cmp    $0x39,%dl
+  8073df:	76 0a                	jbe    8073eb <inet_aton+0x53>
+      return (0);
+  8073e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8073e6:	e9 7c 02 00 00       	jmp    807667 <inet_aton+0x2cf>
+    val = 0;
+  8073eb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    base = 10;
+  8073f2:	c7 45 f8 0a 00 00 00 	movl   $0xa,-0x8(%rbp)
+    if (c == '0') {
+  8073f9:	83 7d f4 30          	cmpl   $0x30,-0xc(%rbp)
+  8073fd:	75 40                	jne    80743f <inet_aton+0xa7>
+      c = *++cp;
+  8073ff:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  807404:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  807408:	0f b6 12             	movzbl (%rdx),%edx
+  80740b:	0f be d2             	movsbl %dl,%edx
+  80740e:	89 55 f4             	mov    %edx,-0xc(%rbp)
+      if (c == 'x' || c == 'X') {
+  807411:	83 7d f4 78          	cmpl   $0x78,-0xc(%rbp)
+  807415:	74 06                	je     80741d <inet_aton+0x85>
+  807417:	83 7d f4 58          	cmpl   $0x58,-0xc(%rbp)
+  80741b:	75 1b                	jne    807438 <inet_aton+0xa0>
+        base = 16;
+  80741d:	c7 45 f8 10 00 00 00 	movl   $0x10,-0x8(%rbp)
+        c = *++cp;
+  807424:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  807429:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80742d:	0f b6 12             	movzbl (%rdx),%edx
+  807430:	0f be d2             	movsbl %dl,%edx
+  807433:	89 55 f4             	mov    %edx,-0xc(%rbp)
+  807436:	eb 07                	jmp    80743f <inet_aton+0xa7>
+      } else
+        base = 8;
+  807438:	c7 45 f8 08 00 00 00 	movl   $0x8,-0x8(%rbp)
+    }
+    for (;;) {
+      if (isdigit(c)) {
+  80743f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807442:	80 fa 2f             	cmp    $0x2f,%dl
+  807445:	76 30                	jbe    807477 <inet_aton+0xdf>
+  807447:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80744a:	80 fa 39             	cmp    $0x39,%dl
+  80744d:	77 28                	ja     807477 <inet_aton+0xdf>
+        val = (val * base) + (int)(c - '0');
+  80744f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  807452:	89 d1                	mov    %edx,%ecx
+  807454:	0f af 4d fc          	imul   -0x4(%rbp),%ecx
+  807458:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80745b:	01 ca                	add    %ecx,%edx
+  80745d:	83 ea 30             	sub    $0x30,%edx
+  807460:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        c = *++cp;
+  807463:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  807468:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80746c:	0f b6 12             	movzbl (%rdx),%edx
+  80746f:	0f be d2             	movsbl %dl,%edx
+  807472:	89 55 f4             	mov    %edx,-0xc(%rbp)
+  807475:	eb 7b                	jmp    8074f2 <inet_aton+0x15a>
+      } else if (base == 16 && isxdigit(c)) {
+  807477:	83 7d f8 10          	cmpl   $0x10,-0x8(%rbp)
+  80747b:	75 7a                	jne    8074f7 <inet_aton+0x15f>
+  80747d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807480:	80 fa 2f             	cmp    $0x2f,%dl
+  807483:	76 08                	jbe    80748d <inet_aton+0xf5>
+  807485:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807488:	80 fa 39             	cmp    $0x39,%dl
+  80748b:	76 20                	jbe    8074ad <inet_aton+0x115>
+  80748d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807490:	80 fa 60             	cmp    $0x60,%dl
+  807493:	76 08                	jbe    80749d <inet_aton+0x105>
+  807495:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807498:	80 fa 66             	cmp    $0x66,%dl
+  80749b:	76 10                	jbe    8074ad <inet_aton+0x115>
+  80749d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8074a0:	80 fa 40             	cmp    $0x40,%dl
+  8074a3:	76 52                	jbe    8074f7 <inet_aton+0x15f>
+  8074a5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8074a8:	80 fa 46             	cmp    $0x46,%dl
+  8074ab:	77 4a                	ja     8074f7 <inet_aton+0x15f>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  8074ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8074b0:	89 d1                	mov    %edx,%ecx
+  8074b2:	c1 e1 04             	shl    $0x4,%ecx
+  8074b5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8074b8:	83 c2 0a             	add    $0xa,%edx
+  8074bb:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  8074be:	40 80 fe 60          	cmp    $0x60,%sil
+  8074c2:	76 10                	jbe    8074d4 <inet_aton+0x13c>
+  8074c4:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  8074c7:	40 80 fe 7a          	cmp    $0x7a,%sil
+  8074cb:	77 07                	ja     8074d4 <inet_aton+0x13c>
+  8074cd:	be 61 00 00 00       	mov    $0x61,%esi
+  8074d2:	eb 05                	jmp    8074d9 <inet_aton+0x141>
+  8074d4:	be 41 00 00 00       	mov    $0x41,%esi
+  8074d9:	29 f2                	sub    %esi,%edx
+  8074db:	09 ca                	or     %ecx,%edx
+  8074dd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+        c = *++cp;
+  8074e0:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8074e5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8074e9:	0f b6 12             	movzbl (%rdx),%edx
+  8074ec:	0f be d2             	movsbl %dl,%edx
+  8074ef:	89 55 f4             	mov    %edx,-0xc(%rbp)
+      if (isdigit(c)) {
+  8074f2:	e9 48 ff ff ff       	jmp    80743f <inet_aton+0xa7>
+      } else
+        break;
+    }
+    if (c == '.') {
+  8074f7:	83 7d f4 2e          	cmpl   $0x2e,-0xc(%rbp)
+  8074fb:	75 40                	jne    80753d <inet_aton+0x1a5>
+       * Internet format:
+       *  a.b.c.d
+       *  a.b.c   (with c treated as 16 bits)
+       *  a.b (with b treated as 24 bits)
+       */
+      if (pp >= parts + 3)
+  8074fd:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  807501:	48 83 c2 0c          	add    $0xc,%rdx
+  807505:	48 39 55 e8          	cmp    %rdx,-0x18(%rbp)
+  807509:	72 0a                	jb     807515 <inet_aton+0x17d>
+        return (0);
+  80750b:	b8 00 00 00 00       	mov    $0x0,%eax
+  807510:	e9 52 01 00 00       	jmp    807667 <inet_aton+0x2cf>
+      *pp++ = val;
+  807515:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807519:	48 8d 4a 04          	lea    0x4(%rdx),%rcx
+  80751d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  807521:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  807524:	89 0a                	mov    %ecx,(%rdx)
+      c = *++cp;
+  807526:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  80752b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80752f:	0f b6 12             	movzbl (%rdx),%edx
+  807532:	0f be d2             	movsbl %dl,%edx
+  807535:	89 55 f4             	mov    %edx,-0xc(%rbp)
+    if (!isdigit(c))
+  807538:	e9 94 fe ff ff       	jmp    8073d1 <inet_aton+0x39>
+    } else
+      break;
+  80753d:	90                   	nop
+  }
+  /*
+   * Check for trailing characters.
+   */
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  80753e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  807542:	74 3d                	je     807581 <inet_aton+0x1e9>
+  807544:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807547:	80 fa 1f             	cmp    $0x1f,%dl
+  80754a:	76 2b                	jbe    807577 <inet_aton+0x1df>
+  80754c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80754f:	84 d2                	test   %dl,%dl
+  807551:	78 24                	js     807577 <inet_aton+0x1df>
+  807553:	83 7d f4 20          	cmpl   $0x20,-0xc(%rbp)
+  807557:	74 28                	je     807581 <inet_aton+0x1e9>
+  807559:	83 7d f4 0c          	cmpl   $0xc,-0xc(%rbp)
+  80755d:	74 22                	je     807581 <inet_aton+0x1e9>
+  80755f:	83 7d f4 0a          	cmpl   $0xa,-0xc(%rbp)
+  807563:	74 1c                	je     807581 <inet_aton+0x1e9>
+  807565:	83 7d f4 0d          	cmpl   $0xd,-0xc(%rbp)
+  807569:	74 16                	je     807581 <inet_aton+0x1e9>
+  80756b:	83 7d f4 09          	cmpl   $0x9,-0xc(%rbp)
+  80756f:	74 10                	je     807581 <inet_aton+0x1e9>
+  807571:	83 7d f4 0b          	cmpl   $0xb,-0xc(%rbp)
+  807575:	74 0a                	je     807581 <inet_aton+0x1e9>
+    return (0);
+  807577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80757c:	e9 e6 00 00 00       	jmp    807667 <inet_aton+0x2cf>
+  /*
+   * Concoct the address according to
+   * the number of parts specified.
+   */
+  n = pp - parts + 1;
+  807581:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  807585:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  807589:	48 29 d1             	sub    %rdx,%rcx
+  80758c:	48 c1 f9 02          	sar    $0x2,%rcx
+  807590:	48 89 ca             	mov    %rcx,%rdx
+  807593:	83 c2 01             	add    $0x1,%edx
+  807596:	89 55 e4             	mov    %edx,-0x1c(%rbp)
+  switch (n) {
+  807599:	83 7d e4 04          	cmpl   $0x4,-0x1c(%rbp)
+  80759d:	0f 87 9d 00 00 00    	ja     807640 <inet_aton+0x2a8>
+  8075a3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8075a6:	48 8d 0c d5 00 00 00 	lea    0x0(,%rdx,8),%rcx
+  8075ad:	00 
+  8075ae:	48 8d 15 43 0b 00 00 	lea    0xb43(%rip),%rdx        # 8080f8 <.LC1+0xc>
+  8075b5:	48 8b 14 11          	mov    (%rcx,%rdx,1),%rdx
+  8075b9:	48 8d 0d 38 0b 00 00 	lea    0xb38(%rip),%rcx        # 8080f8 <.LC1+0xc>
+  8075c0:	48 01 ca             	add    %rcx,%rdx
+  8075c3:	ff e2                	jmp    *%rdx
+
+  case 0:
+    return (0);       /* initial nondigit */
+  8075c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8075ca:	e9 98 00 00 00       	jmp    807667 <inet_aton+0x2cf>
+
+  case 1:             /* a -- 32 bits */
+    break;
+
+  case 2:             /* a.b -- 8.24 bits */
+    if (val > 0xffffffUL)
+  8075cf:	81 7d fc ff ff ff 00 	cmpl   $0xffffff,-0x4(%rbp)
+  8075d6:	76 0a                	jbe    8075e2 <inet_aton+0x24a>
+      return (0);
+  8075d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8075dd:	e9 85 00 00 00       	jmp    807667 <inet_aton+0x2cf>
+    val |= parts[0] << 24;
+  8075e2:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  8075e5:	c1 e2 18             	shl    $0x18,%edx
+  8075e8:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  8075eb:	eb 53                	jmp    807640 <inet_aton+0x2a8>
+
+  case 3:             /* a.b.c -- 8.8.16 bits */
+    if (val > 0xffff)
+  8075ed:	81 7d fc ff ff 00 00 	cmpl   $0xffff,-0x4(%rbp)
+  8075f4:	76 07                	jbe    8075fd <inet_aton+0x265>
+      return (0);
+  8075f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8075fb:	eb 6a                	jmp    807667 <inet_aton+0x2cf>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  8075fd:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  807600:	89 d1                	mov    %edx,%ecx
+  807602:	c1 e1 18             	shl    $0x18,%ecx
+  807605:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  807608:	c1 e2 10             	shl    $0x10,%edx
+  80760b:	09 ca                	or     %ecx,%edx
+  80760d:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  807610:	eb 2e                	jmp    807640 <inet_aton+0x2a8>
+
+  case 4:             /* a.b.c.d -- 8.8.8.8 bits */
+    if (val > 0xff)
+  807612:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%rbp)
+  807619:	76 07                	jbe    807622 <inet_aton+0x28a>
+      return (0);
+  80761b:	b8 00 00 00 00       	mov    $0x0,%eax
+  807620:	eb 45                	jmp    807667 <inet_aton+0x2cf>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  807622:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  807625:	89 d1                	mov    %edx,%ecx
+  807627:	c1 e1 18             	shl    $0x18,%ecx
+  80762a:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80762d:	c1 e2 10             	shl    $0x10,%edx
+  807630:	09 d1                	or     %edx,%ecx
+  807632:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  807635:	c1 e2 08             	shl    $0x8,%edx
+  807638:	09 ca                	or     %ecx,%edx
+  80763a:	09 55 fc             	or     %edx,-0x4(%rbp)
+    break;
+  80763d:	eb 01                	jmp    807640 <inet_aton+0x2a8>
+    break;
+  80763f:	90                   	nop
+  }
+  if (addr)
+  807640:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  807645:	74 1b                	je     807662 <inet_aton+0x2ca>
+    addr->s_addr = htonl(val);
+  807647:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80764a:	89 d7                	mov    %edx,%edi
+  80764c:	48 ba c4 d7 ff ff ff 	movabs $0xffffffffffffd7c4,%rdx
+  807653:	ff ff ff 
+  807656:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80765a:	ff d0                	call   *%rax
+  80765c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807660:	89 02                	mov    %eax,(%rdx)
+  return (1);
+  807662:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  807667:	c9                   	leave
+  807668:	c3                   	ret
+
+0000000000807669 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  807669:	55                   	push   %rbp
+  80766a:	48 89 e5             	mov    %rsp,%rbp
+  80766d:	48 83 ec 28          	sub    $0x28,%rsp
+  807671:	48 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%rdx        # 807671 <inet_ntoa+0x8>
+  807678:	49 bb cf 29 00 00 00 	movabs $0x29cf,%r11
+  80767f:	00 00 00 
+  807682:	4c 01 da             	add    %r11,%rdx
+  807685:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  807688:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80768b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  u8_t *ap;
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  80768e:	48 b8 10 24 01 00 00 	movabs $0x12410,%rax
+  807695:	00 00 00 
+  807698:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+  80769c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  ap = (u8_t *)&s_addr;
+  8076a0:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8076a4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(n = 0; n < 4; n++) {
+  8076a8:	c6 45 ef 00          	movb   $0x0,-0x11(%rbp)
+  8076ac:	e9 bc 00 00 00       	jmp    80776d <inet_ntoa+0x104>
+    i = 0;
+  8076b1:	c6 45 ee 00          	movb   $0x0,-0x12(%rbp)
+    do {
+      rem = *ap % (u8_t)10;
+  8076b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8076b9:	0f b6 08             	movzbl (%rax),%ecx
+  8076bc:	be cd ff ff ff       	mov    $0xffffffcd,%esi
+  8076c1:	89 f0                	mov    %esi,%eax
+  8076c3:	f6 e1                	mul    %cl
+  8076c5:	66 c1 e8 08          	shr    $0x8,%ax
+  8076c9:	c0 e8 03             	shr    $0x3,%al
+  8076cc:	88 45 ed             	mov    %al,-0x13(%rbp)
+  8076cf:	0f b6 75 ed          	movzbl -0x13(%rbp),%esi
+  8076d3:	89 f0                	mov    %esi,%eax
+  8076d5:	c1 e0 02             	shl    $0x2,%eax
+  8076d8:	01 f0                	add    %esi,%eax
+  8076da:	01 c0                	add    %eax,%eax
+  8076dc:	29 c1                	sub    %eax,%ecx
+  8076de:	88 4d ed             	mov    %cl,-0x13(%rbp)
+      *ap /= (u8_t)10;
+  8076e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8076e5:	0f b6 00             	movzbl (%rax),%eax
+  8076e8:	b9 cd ff ff ff       	mov    $0xffffffcd,%ecx
+  8076ed:	f6 e1                	mul    %cl
+  8076ef:	66 c1 e8 08          	shr    $0x8,%ax
+  8076f3:	89 c1                	mov    %eax,%ecx
+  8076f5:	c0 e9 03             	shr    $0x3,%cl
+  8076f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8076fc:	88 08                	mov    %cl,(%rax)
+      inv[i++] = '0' + rem;
+  8076fe:	0f b6 45 ed          	movzbl -0x13(%rbp),%eax
+  807702:	8d 70 30             	lea    0x30(%rax),%esi
+  807705:	0f b6 45 ee          	movzbl -0x12(%rbp),%eax
+  807709:	8d 48 01             	lea    0x1(%rax),%ecx
+  80770c:	88 4d ee             	mov    %cl,-0x12(%rbp)
+  80770f:	0f b6 c0             	movzbl %al,%eax
+  807712:	89 f1                	mov    %esi,%ecx
+  807714:	48 98                	cltq
+  807716:	88 4c 05 e5          	mov    %cl,-0x1b(%rbp,%rax,1)
+    } while(*ap);
+  80771a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80771e:	0f b6 00             	movzbl (%rax),%eax
+  807721:	84 c0                	test   %al,%al
+  807723:	75 90                	jne    8076b5 <inet_ntoa+0x4c>
+    while(i--)
+  807725:	eb 1a                	jmp    807741 <inet_ntoa+0xd8>
+      *rp++ = inv[i];
+  807727:	0f b6 75 ee          	movzbl -0x12(%rbp),%esi
+  80772b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80772f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  807733:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  807737:	48 63 ce             	movslq %esi,%rcx
+  80773a:	0f b6 4c 0d e5       	movzbl -0x1b(%rbp,%rcx,1),%ecx
+  80773f:	88 08                	mov    %cl,(%rax)
+    while(i--)
+  807741:	0f b6 45 ee          	movzbl -0x12(%rbp),%eax
+  807745:	8d 48 ff             	lea    -0x1(%rax),%ecx
+  807748:	88 4d ee             	mov    %cl,-0x12(%rbp)
+  80774b:	84 c0                	test   %al,%al
+  80774d:	75 d8                	jne    807727 <inet_ntoa+0xbe>
+    *rp++ = '.';
+  80774f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807753:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  807757:	48 89 4d f8          	mov    %rcx,-0x8(%rbp)
+  80775b:	c6 00 2e             	movb   $0x2e,(%rax)
+    ap++;
+  80775e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  for(n = 0; n < 4; n++) {
+  807763:	0f b6 45 ef          	movzbl -0x11(%rbp),%eax
+  807767:	83 c0 01             	add    $0x1,%eax
+  80776a:	88 45 ef             	mov    %al,-0x11(%rbp)
+  80776d:	80 7d ef 03          	cmpb   $0x3,-0x11(%rbp)
+  807771:	0f 86 3a ff ff ff    	jbe    8076b1 <inet_ntoa+0x48>
+  }
+  *--rp = 0;
+  807777:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80777c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807780:	c6 00 00             	movb   $0x0,(%rax)
+  return str;
+  807783:	48 b8 10 24 01 00 00 	movabs $0x12410,%rax
+  80778a:	00 00 00 
+  80778d:	48 8d 04 02          	lea    (%rdx,%rax,1),%rax
+}
+  807791:	c9                   	leave
+  807792:	c3                   	ret
+
+0000000000807793 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  807793:	55                   	push   %rbp
+  807794:	48 89 e5             	mov    %rsp,%rbp
+  807797:	48 83 ec 08          	sub    $0x8,%rsp
+  80779b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80779b <htons+0x8>
+  8077a2:	49 bb a5 28 00 00 00 	movabs $0x28a5,%r11
+  8077a9:	00 00 00 
+  8077ac:	4c 01 d8             	add    %r11,%rax
+  8077af:	89 f8                	mov    %edi,%eax
+  8077b1:	66 89 45 fc          	mov    %ax,-0x4(%rbp)
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  8077b5:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+  8077b9:	c1 e0 08             	shl    $0x8,%eax
+  8077bc:	89 c2                	mov    %eax,%edx
+  8077be:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+  8077c2:	66 c1 e8 08          	shr    $0x8,%ax
+  8077c6:	09 d0                	or     %edx,%eax
+}
+  8077c8:	c9                   	leave
+  8077c9:	c3                   	ret
+
+00000000008077ca <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  8077ca:	55                   	push   %rbp
+  8077cb:	48 89 e5             	mov    %rsp,%rbp
+  8077ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8077d2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8077d2 <ntohs+0x8>
+  8077d9:	49 bb 6e 28 00 00 00 	movabs $0x286e,%r11
+  8077e0:	00 00 00 
+  8077e3:	4c 01 d8             	add    %r11,%rax
+  8077e6:	89 fa                	mov    %edi,%edx
+  8077e8:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+  return htons(n);
+  8077ec:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+  8077f0:	89 d7                	mov    %edx,%edi
+  8077f2:	48 ba 53 d7 ff ff ff 	movabs $0xffffffffffffd753,%rdx
+  8077f9:	ff ff ff 
+  8077fc:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  807800:	ff d0                	call   *%rax
+}
+  807802:	c9                   	leave
+  807803:	c3                   	ret
+
+0000000000807804 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  807804:	55                   	push   %rbp
+  807805:	48 89 e5             	mov    %rsp,%rbp
+  807808:	48 83 ec 08          	sub    $0x8,%rsp
+  80780c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80780c <htonl+0x8>
+  807813:	49 bb 34 28 00 00 00 	movabs $0x2834,%r11
+  80781a:	00 00 00 
+  80781d:	4c 01 d8             	add    %r11,%rax
+  807820:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return ((n & 0xff) << 24) |
+  807823:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807826:	c1 e0 18             	shl    $0x18,%eax
+  807829:	89 c2                	mov    %eax,%edx
+    ((n & 0xff00) << 8) |
+  80782b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80782e:	c1 e0 08             	shl    $0x8,%eax
+  807831:	25 00 00 ff 00       	and    $0xff0000,%eax
+  return ((n & 0xff) << 24) |
+  807836:	09 c2                	or     %eax,%edx
+    ((n & 0xff0000UL) >> 8) |
+  807838:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80783b:	48 c1 e8 08          	shr    $0x8,%rax
+  80783f:	25 00 ff 00 00       	and    $0xff00,%eax
+    ((n & 0xff00) << 8) |
+  807844:	09 c2                	or     %eax,%edx
+    ((n & 0xff000000UL) >> 24);
+  807846:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807849:	c1 e8 18             	shr    $0x18,%eax
+    ((n & 0xff0000UL) >> 8) |
+  80784c:	09 d0                	or     %edx,%eax
+}
+  80784e:	c9                   	leave
+  80784f:	c3                   	ret
+
+0000000000807850 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  807850:	55                   	push   %rbp
+  807851:	48 89 e5             	mov    %rsp,%rbp
+  807854:	48 83 ec 08          	sub    $0x8,%rsp
+  807858:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807858 <ntohl+0x8>
+  80785f:	49 bb e8 27 00 00 00 	movabs $0x27e8,%r11
+  807866:	00 00 00 
+  807869:	4c 01 d8             	add    %r11,%rax
+  80786c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return htonl(n);
+  80786f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  807872:	89 d7                	mov    %edx,%edi
+  807874:	48 ba c4 d7 ff ff ff 	movabs $0xffffffffffffd7c4,%rdx
+  80787b:	ff ff ff 
+  80787e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  807882:	ff d0                	call   *%rax
+}
+  807884:	c9                   	leave
+  807885:	c3                   	ret
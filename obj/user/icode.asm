@@ -0,0 +1,10946 @@
+
+obj/user/icode:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 06 03 00 00       	call   800347 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#define MOTD "/motd"
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  800051:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800051 <umain+0xe>
+  800058:	49 bb e7 8f 00 00 00 	movabs $0x8fe7,%r11
+  80005f:	00 00 00 
+  800062:	4c 01 db             	add    %r11,%rbx
+  800065:	89 bd dc fd ff ff    	mov    %edi,-0x224(%rbp)
+  80006b:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int fd, n, r;
+	char buf[512+1];
+
+	binaryname = "icode";
+  800072:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  800079:	ff ff ff 
+  80007c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800080:	48 ba d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rdx
+  800087:	ff ff ff 
+  80008a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80008e:	48 89 10             	mov    %rdx,(%rax)
+
+	cprintf("icode startup\n");
+  800091:	48 b8 d6 e2 ff ff ff 	movabs $0xffffffffffffe2d6,%rax
+  800098:	ff ff ff 
+  80009b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80009f:	48 89 c7             	mov    %rax,%rdi
+  8000a2:	49 89 df             	mov    %rbx,%r15
+  8000a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000aa:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  8000b1:	ff ff ff 
+  8000b4:	48 01 da             	add    %rbx,%rdx
+  8000b7:	ff d2                	call   *%rdx
+
+	cprintf("icode: open /motd\n");
+  8000b9:	48 b8 e5 e2 ff ff ff 	movabs $0xffffffffffffe2e5,%rax
+  8000c0:	ff ff ff 
+  8000c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c7:	48 89 c7             	mov    %rax,%rdi
+  8000ca:	49 89 df             	mov    %rbx,%r15
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  8000d9:	ff ff ff 
+  8000dc:	48 01 da             	add    %rbx,%rdx
+  8000df:	ff d2                	call   *%rdx
+	if ((fd = open(MOTD, O_RDONLY)) < 0)
+  8000e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e6:	48 b8 f8 e2 ff ff ff 	movabs $0xffffffffffffe2f8,%rax
+  8000ed:	ff ff ff 
+  8000f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000f4:	48 89 c7             	mov    %rax,%rdi
+  8000f7:	49 89 df             	mov    %rbx,%r15
+  8000fa:	48 b8 5d a7 ff ff ff 	movabs $0xffffffffffffa75d,%rax
+  800101:	ff ff ff 
+  800104:	48 01 d8             	add    %rbx,%rax
+  800107:	ff d0                	call   *%rax
+  800109:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80010c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800110:	79 44                	jns    800156 <umain+0x113>
+		panic("icode: open /motd: %e", fd);
+  800112:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800115:	89 c1                	mov    %eax,%ecx
+  800117:	48 b8 fe e2 ff ff ff 	movabs $0xffffffffffffe2fe,%rax
+  80011e:	ff ff ff 
+  800121:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800125:	48 89 c2             	mov    %rax,%rdx
+  800128:	be 11 00 00 00       	mov    $0x11,%esi
+  80012d:	48 b8 14 e3 ff ff ff 	movabs $0xffffffffffffe314,%rax
+  800134:	ff ff ff 
+  800137:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80013b:	48 89 c7             	mov    %rax,%rdi
+  80013e:	49 89 df             	mov    %rbx,%r15
+  800141:	b8 00 00 00 00       	mov    $0x0,%eax
+  800146:	49 b8 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r8
+  80014d:	ff ff ff 
+  800150:	49 01 d8             	add    %rbx,%r8
+  800153:	41 ff d0             	call   *%r8
+
+	cprintf("icode: read /motd\n");
+  800156:	48 b8 21 e3 ff ff ff 	movabs $0xffffffffffffe321,%rax
+  80015d:	ff ff ff 
+  800160:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800164:	48 89 c7             	mov    %rax,%rdi
+  800167:	49 89 df             	mov    %rbx,%r15
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016f:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  800176:	ff ff ff 
+  800179:	48 01 da             	add    %rbx,%rdx
+  80017c:	ff d2                	call   *%rdx
+	while ((n = read(fd, buf, sizeof buf-1)) > 0) {
+  80017e:	eb 4d                	jmp    8001cd <umain+0x18a>
+		cprintf("Writing MOTD\n");
+  800180:	48 b8 34 e3 ff ff ff 	movabs $0xffffffffffffe334,%rax
+  800187:	ff ff ff 
+  80018a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80018e:	48 89 c7             	mov    %rax,%rdi
+  800191:	49 89 df             	mov    %rbx,%r15
+  800194:	b8 00 00 00 00       	mov    $0x0,%eax
+  800199:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  8001a0:	ff ff ff 
+  8001a3:	48 01 da             	add    %rbx,%rdx
+  8001a6:	ff d2                	call   *%rdx
+		sys_cputs(buf, n);
+  8001a8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8001ab:	48 63 d0             	movslq %eax,%rdx
+  8001ae:	48 8d 85 e0 fd ff ff 	lea    -0x220(%rbp),%rax
+  8001b5:	48 89 d6             	mov    %rdx,%rsi
+  8001b8:	48 89 c7             	mov    %rax,%rdi
+  8001bb:	49 89 df             	mov    %rbx,%r15
+  8001be:	48 b8 b6 8f ff ff ff 	movabs $0xffffffffffff8fb6,%rax
+  8001c5:	ff ff ff 
+  8001c8:	48 01 d8             	add    %rbx,%rax
+  8001cb:	ff d0                	call   *%rax
+	while ((n = read(fd, buf, sizeof buf-1)) > 0) {
+  8001cd:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8001d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001d7:	ba 00 02 00 00       	mov    $0x200,%edx
+  8001dc:	48 89 ce             	mov    %rcx,%rsi
+  8001df:	89 c7                	mov    %eax,%edi
+  8001e1:	49 89 df             	mov    %rbx,%r15
+  8001e4:	48 b8 8e 9f ff ff ff 	movabs $0xffffffffffff9f8e,%rax
+  8001eb:	ff ff ff 
+  8001ee:	48 01 d8             	add    %rbx,%rax
+  8001f1:	ff d0                	call   *%rax
+  8001f3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8001f6:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8001fa:	7f 84                	jg     800180 <umain+0x13d>
+	}
+
+	cprintf("icode: close /motd\n");
+  8001fc:	48 b8 42 e3 ff ff ff 	movabs $0xffffffffffffe342,%rax
+  800203:	ff ff ff 
+  800206:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80020a:	48 89 c7             	mov    %rax,%rdi
+  80020d:	49 89 df             	mov    %rbx,%r15
+  800210:	b8 00 00 00 00       	mov    $0x0,%eax
+  800215:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  80021c:	ff ff ff 
+  80021f:	48 01 da             	add    %rbx,%rdx
+  800222:	ff d2                	call   *%rdx
+	close(fd);
+  800224:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800227:	89 c7                	mov    %eax,%edi
+  800229:	49 89 df             	mov    %rbx,%r15
+  80022c:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  800233:	ff ff ff 
+  800236:	48 01 d8             	add    %rbx,%rax
+  800239:	ff d0                	call   *%rax
+
+	cprintf("icode: spawn /sbin/init\n");
+  80023b:	48 b8 56 e3 ff ff ff 	movabs $0xffffffffffffe356,%rax
+  800242:	ff ff ff 
+  800245:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800249:	48 89 c7             	mov    %rax,%rdi
+  80024c:	49 89 df             	mov    %rbx,%r15
+  80024f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800254:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  80025b:	ff ff ff 
+  80025e:	48 01 da             	add    %rbx,%rdx
+  800261:	ff d2                	call   *%rdx
+	if ((r = spawnl("/sbin/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+  800263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800269:	48 b8 6f e3 ff ff ff 	movabs $0xffffffffffffe36f,%rax
+  800270:	ff ff ff 
+  800273:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800277:	48 89 c1             	mov    %rax,%rcx
+  80027a:	48 b8 78 e3 ff ff ff 	movabs $0xffffffffffffe378,%rax
+  800281:	ff ff ff 
+  800284:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800288:	48 89 c2             	mov    %rax,%rdx
+  80028b:	48 b8 81 e3 ff ff ff 	movabs $0xffffffffffffe381,%rax
+  800292:	ff ff ff 
+  800295:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800299:	48 89 c6             	mov    %rax,%rsi
+  80029c:	48 b8 86 e3 ff ff ff 	movabs $0xffffffffffffe386,%rax
+  8002a3:	ff ff ff 
+  8002a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002aa:	48 89 c7             	mov    %rax,%rdi
+  8002ad:	49 89 df             	mov    %rbx,%r15
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	49 b9 d9 b4 ff ff ff 	movabs $0xffffffffffffb4d9,%r9
+  8002bc:	ff ff ff 
+  8002bf:	49 01 d9             	add    %rbx,%r9
+  8002c2:	41 ff d1             	call   *%r9
+  8002c5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8002c8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8002cc:	79 44                	jns    800312 <umain+0x2cf>
+		panic("icode: spawn /sbin/init: %e", r);
+  8002ce:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002d1:	89 c1                	mov    %eax,%ecx
+  8002d3:	48 b8 91 e3 ff ff ff 	movabs $0xffffffffffffe391,%rax
+  8002da:	ff ff ff 
+  8002dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002e1:	48 89 c2             	mov    %rax,%rdx
+  8002e4:	be 1e 00 00 00       	mov    $0x1e,%esi
+  8002e9:	48 b8 14 e3 ff ff ff 	movabs $0xffffffffffffe314,%rax
+  8002f0:	ff ff ff 
+  8002f3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002f7:	48 89 c7             	mov    %rax,%rdi
+  8002fa:	49 89 df             	mov    %rbx,%r15
+  8002fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800302:	49 b8 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r8
+  800309:	ff ff ff 
+  80030c:	49 01 d8             	add    %rbx,%r8
+  80030f:	41 ff d0             	call   *%r8
+	cprintf("icode: exiting\n");
+  800312:	48 b8 ad e3 ff ff ff 	movabs $0xffffffffffffe3ad,%rax
+  800319:	ff ff ff 
+  80031c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800320:	48 89 c7             	mov    %rax,%rdi
+  800323:	49 89 df             	mov    %rbx,%r15
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  800332:	ff ff ff 
+  800335:	48 01 da             	add    %rbx,%rdx
+  800338:	ff d2                	call   *%rdx
+}
+  80033a:	90                   	nop
+  80033b:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  800342:	5b                   	pop    %rbx
+  800343:	41 5f                	pop    %r15
+  800345:	5d                   	pop    %rbp
+  800346:	c3                   	ret
+
+0000000000800347 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800347:	55                   	push   %rbp
+  800348:	48 89 e5             	mov    %rsp,%rbp
+  80034b:	41 57                	push   %r15
+  80034d:	53                   	push   %rbx
+  80034e:	48 83 ec 20          	sub    $0x20,%rsp
+  800352:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800352 <libmain+0xb>
+  800359:	49 bb e6 8c 00 00 00 	movabs $0x8ce6,%r11
+  800360:	00 00 00 
+  800363:	4c 01 db             	add    %r11,%rbx
+  800366:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800369:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80036d:	49 89 df             	mov    %rbx,%r15
+  800370:	48 b8 c5 90 ff ff ff 	movabs $0xffffffffffff90c5,%rax
+  800377:	ff ff ff 
+  80037a:	48 01 d8             	add    %rbx,%rax
+  80037d:	ff d0                	call   *%rax
+  80037f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800382:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800385:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80038a:	48 98                	cltq
+  80038c:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800393:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80039a:	ff ff ff 
+  80039d:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8003a1:	48 01 c2             	add    %rax,%rdx
+  8003a4:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8003ab:	00 00 00 
+  8003ae:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003b2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8003b6:	7e 15                	jle    8003cd <libmain+0x86>
+		binaryname = argv[0];
+  8003b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8003bc:	48 8b 00             	mov    (%rax),%rax
+  8003bf:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  8003c6:	00 00 00 
+  8003c9:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8003cd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8003d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8003d4:	48 89 d6             	mov    %rdx,%rsi
+  8003d7:	89 c7                	mov    %eax,%edi
+  8003d9:	49 89 df             	mov    %rbx,%r15
+  8003dc:	48 b8 0b 70 ff ff ff 	movabs $0xffffffffffff700b,%rax
+  8003e3:	ff ff ff 
+  8003e6:	48 01 d8             	add    %rbx,%rax
+  8003e9:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8003eb:	49 89 df             	mov    %rbx,%r15
+  8003ee:	48 b8 cf 73 ff ff ff 	movabs $0xffffffffffff73cf,%rax
+  8003f5:	ff ff ff 
+  8003f8:	48 01 d8             	add    %rbx,%rax
+  8003fb:	ff d0                	call   *%rax
+}
+  8003fd:	90                   	nop
+  8003fe:	48 83 c4 20          	add    $0x20,%rsp
+  800402:	5b                   	pop    %rbx
+  800403:	41 5f                	pop    %r15
+  800405:	5d                   	pop    %rbp
+  800406:	c3                   	ret
+
+0000000000800407 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800407:	55                   	push   %rbp
+  800408:	48 89 e5             	mov    %rsp,%rbp
+  80040b:	41 57                	push   %r15
+  80040d:	53                   	push   %rbx
+  80040e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80040e <exit+0x7>
+  800415:	49 bb 2a 8c 00 00 00 	movabs $0x8c2a,%r11
+  80041c:	00 00 00 
+  80041f:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800422:	49 89 df             	mov    %rbx,%r15
+  800425:	48 b8 42 9d ff ff ff 	movabs $0xffffffffffff9d42,%rax
+  80042c:	ff ff ff 
+  80042f:	48 01 d8             	add    %rbx,%rax
+  800432:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800434:	bf 00 00 00 00       	mov    $0x0,%edi
+  800439:	49 89 df             	mov    %rbx,%r15
+  80043c:	48 b8 69 90 ff ff ff 	movabs $0xffffffffffff9069,%rax
+  800443:	ff ff ff 
+  800446:	48 01 d8             	add    %rbx,%rax
+  800449:	ff d0                	call   *%rax
+}
+  80044b:	90                   	nop
+  80044c:	5b                   	pop    %rbx
+  80044d:	41 5f                	pop    %r15
+  80044f:	5d                   	pop    %rbp
+  800450:	c3                   	ret
+
+0000000000800451 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800451:	55                   	push   %rbp
+  800452:	48 89 e5             	mov    %rsp,%rbp
+  800455:	41 57                	push   %r15
+  800457:	41 54                	push   %r12
+  800459:	53                   	push   %rbx
+  80045a:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800461:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800461 <_panic+0x10>
+  800468:	49 bb d7 8b 00 00 00 	movabs $0x8bd7,%r11
+  80046f:	00 00 00 
+  800472:	4c 01 db             	add    %r11,%rbx
+  800475:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80047c:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800482:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800489:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800490:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800497:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80049e:	84 c0                	test   %al,%al
+  8004a0:	74 26                	je     8004c8 <_panic+0x77>
+  8004a2:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8004a9:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8004b0:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8004b4:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8004b8:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8004bc:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8004c0:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8004c4:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004c8:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8004cf:	00 00 00 
+  8004d2:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8004d9:	00 00 00 
+  8004dc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004e0:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8004e7:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8004ee:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004f5:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  8004fc:	ff ff ff 
+  8004ff:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800503:	4c 8b 20             	mov    (%rax),%r12
+  800506:	49 89 df             	mov    %rbx,%r15
+  800509:	48 b8 c5 90 ff ff ff 	movabs $0xffffffffffff90c5,%rax
+  800510:	ff ff ff 
+  800513:	48 01 d8             	add    %rbx,%rax
+  800516:	ff d0                	call   *%rax
+  800518:	89 c6                	mov    %eax,%esi
+  80051a:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800520:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800527:	41 89 d0             	mov    %edx,%r8d
+  80052a:	48 89 c1             	mov    %rax,%rcx
+  80052d:	4c 89 e2             	mov    %r12,%rdx
+  800530:	48 b8 c8 e3 ff ff ff 	movabs $0xffffffffffffe3c8,%rax
+  800537:	ff ff ff 
+  80053a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80053e:	48 89 c7             	mov    %rax,%rdi
+  800541:	49 89 df             	mov    %rbx,%r15
+  800544:	b8 00 00 00 00       	mov    $0x0,%eax
+  800549:	49 b9 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%r9
+  800550:	ff ff ff 
+  800553:	49 01 d9             	add    %rbx,%r9
+  800556:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800559:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800560:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800567:	48 89 d6             	mov    %rdx,%rsi
+  80056a:	48 89 c7             	mov    %rax,%rdi
+  80056d:	49 89 df             	mov    %rbx,%r15
+  800570:	48 b8 10 76 ff ff ff 	movabs $0xffffffffffff7610,%rax
+  800577:	ff ff ff 
+  80057a:	48 01 d8             	add    %rbx,%rax
+  80057d:	ff d0                	call   *%rax
+	cprintf("\n");
+  80057f:	48 b8 eb e3 ff ff ff 	movabs $0xffffffffffffe3eb,%rax
+  800586:	ff ff ff 
+  800589:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80058d:	48 89 c7             	mov    %rax,%rdi
+  800590:	49 89 df             	mov    %rbx,%r15
+  800593:	b8 00 00 00 00       	mov    $0x0,%eax
+  800598:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  80059f:	ff ff ff 
+  8005a2:	48 01 da             	add    %rbx,%rdx
+  8005a5:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8005a7:	cc                   	int3
+  8005a8:	eb fd                	jmp    8005a7 <_panic+0x156>
+
+00000000008005aa <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+  8005ae:	41 57                	push   %r15
+  8005b0:	48 83 ec 18          	sub    $0x18,%rsp
+  8005b4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005b4 <putch+0xa>
+  8005bb:	49 bb 84 8a 00 00 00 	movabs $0x8a84,%r11
+  8005c2:	00 00 00 
+  8005c5:	4c 01 d8             	add    %r11,%rax
+  8005c8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8005cb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8005cf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005d3:	8b 12                	mov    (%rdx),%edx
+  8005d5:	8d 72 01             	lea    0x1(%rdx),%esi
+  8005d8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8005dc:	89 31                	mov    %esi,(%rcx)
+  8005de:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8005e1:	89 ce                	mov    %ecx,%esi
+  8005e3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8005e7:	48 63 d2             	movslq %edx,%rdx
+  8005ea:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8005ef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005f3:	8b 12                	mov    (%rdx),%edx
+  8005f5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005fb:	75 33                	jne    800630 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8005fd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800601:	8b 12                	mov    (%rdx),%edx
+  800603:	48 63 d2             	movslq %edx,%rdx
+  800606:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80060a:	48 83 c1 08          	add    $0x8,%rcx
+  80060e:	48 89 d6             	mov    %rdx,%rsi
+  800611:	48 89 cf             	mov    %rcx,%rdi
+  800614:	49 89 c7             	mov    %rax,%r15
+  800617:	48 ba b6 8f ff ff ff 	movabs $0xffffffffffff8fb6,%rdx
+  80061e:	ff ff ff 
+  800621:	48 01 c2             	add    %rax,%rdx
+  800624:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800626:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80062a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800630:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800634:	8b 40 04             	mov    0x4(%rax),%eax
+  800637:	8d 50 01             	lea    0x1(%rax),%edx
+  80063a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80063e:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800641:	90                   	nop
+  800642:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800646:	c9                   	leave
+  800647:	c3                   	ret
+
+0000000000800648 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800648:	55                   	push   %rbp
+  800649:	48 89 e5             	mov    %rsp,%rbp
+  80064c:	41 57                	push   %r15
+  80064e:	53                   	push   %rbx
+  80064f:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800656:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800656 <vcprintf+0xe>
+  80065d:	49 bb e2 89 00 00 00 	movabs $0x89e2,%r11
+  800664:	00 00 00 
+  800667:	4c 01 db             	add    %r11,%rbx
+  80066a:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800671:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800678:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80067f:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800686:	48 8b 06             	mov    (%rsi),%rax
+  800689:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80068d:	48 89 01             	mov    %rax,(%rcx)
+  800690:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800694:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800698:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80069c:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8006a3:	00 00 00 
+    b.cnt = 0;
+  8006a6:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8006ad:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8006b0:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006b7:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8006be:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8006c5:	48 89 c6             	mov    %rax,%rsi
+  8006c8:	48 b8 72 75 ff ff ff 	movabs $0xffffffffffff7572,%rax
+  8006cf:	ff ff ff 
+  8006d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006d6:	48 89 c7             	mov    %rax,%rdi
+  8006d9:	49 89 df             	mov    %rbx,%r15
+  8006dc:	48 b8 34 7b ff ff ff 	movabs $0xffffffffffff7b34,%rax
+  8006e3:	ff ff ff 
+  8006e6:	48 01 d8             	add    %rbx,%rax
+  8006e9:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8006eb:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8006f1:	48 98                	cltq
+  8006f3:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8006fa:	48 83 c2 08          	add    $0x8,%rdx
+  8006fe:	48 89 c6             	mov    %rax,%rsi
+  800701:	48 89 d7             	mov    %rdx,%rdi
+  800704:	49 89 df             	mov    %rbx,%r15
+  800707:	48 b8 b6 8f ff ff ff 	movabs $0xffffffffffff8fb6,%rax
+  80070e:	ff ff ff 
+  800711:	48 01 d8             	add    %rbx,%rax
+  800714:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800716:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80071c:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800723:	5b                   	pop    %rbx
+  800724:	41 5f                	pop    %r15
+  800726:	5d                   	pop    %rbp
+  800727:	c3                   	ret
+
+0000000000800728 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800728:	55                   	push   %rbp
+  800729:	48 89 e5             	mov    %rsp,%rbp
+  80072c:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800733:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800733 <cprintf+0xb>
+  80073a:	49 bb 05 89 00 00 00 	movabs $0x8905,%r11
+  800741:	00 00 00 
+  800744:	4d 01 da             	add    %r11,%r10
+  800747:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80074e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800755:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80075c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800763:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80076a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800771:	84 c0                	test   %al,%al
+  800773:	74 20                	je     800795 <cprintf+0x6d>
+  800775:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800779:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80077d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800781:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800785:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800789:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80078d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800791:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800795:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80079c:	00 00 00 
+  80079f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8007a6:	00 00 00 
+  8007a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007ad:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8007b4:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8007bb:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8007c2:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8007c9:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8007d0:	48 8b 06             	mov    (%rsi),%rax
+  8007d3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007d7:	48 89 01             	mov    %rax,(%rcx)
+  8007da:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007de:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007e2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8007e6:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8007ed:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8007f4:	48 89 d6             	mov    %rdx,%rsi
+  8007f7:	48 89 c7             	mov    %rax,%rdi
+  8007fa:	48 b8 10 76 ff ff ff 	movabs $0xffffffffffff7610,%rax
+  800801:	ff ff ff 
+  800804:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800808:	ff d0                	call   *%rax
+  80080a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800810:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800816:	c9                   	leave
+  800817:	c3                   	ret
+
+0000000000800818 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800818:	55                   	push   %rbp
+  800819:	48 89 e5             	mov    %rsp,%rbp
+  80081c:	53                   	push   %rbx
+  80081d:	48 83 ec 38          	sub    $0x38,%rsp
+  800821:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800821 <printnum+0x9>
+  800828:	49 bb 17 88 00 00 00 	movabs $0x8817,%r11
+  80082f:	00 00 00 
+  800832:	4c 01 db             	add    %r11,%rbx
+  800835:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800839:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80083d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800841:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800844:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800848:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80084c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80084f:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800853:	72 58                	jb     8008ad <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800855:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800858:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80085b:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  80085e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800862:	ba 00 00 00 00       	mov    $0x0,%edx
+  800867:	48 f7 f6             	div    %rsi
+  80086a:	49 89 c2             	mov    %rax,%r10
+  80086d:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800870:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800873:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800877:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80087b:	41 89 c9             	mov    %ecx,%r9d
+  80087e:	41 89 f8             	mov    %edi,%r8d
+  800881:	89 d1                	mov    %edx,%ecx
+  800883:	4c 89 d2             	mov    %r10,%rdx
+  800886:	48 89 c7             	mov    %rax,%rdi
+  800889:	48 b8 e0 77 ff ff ff 	movabs $0xffffffffffff77e0,%rax
+  800890:	ff ff ff 
+  800893:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800897:	ff d0                	call   *%rax
+  800899:	eb 1c                	jmp    8008b7 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80089b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80089f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8008a2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8008a6:	48 89 d6             	mov    %rdx,%rsi
+  8008a9:	89 c7                	mov    %eax,%edi
+  8008ab:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8008ad:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8008b1:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8008b5:	7f e4                	jg     80089b <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8008b7:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8008ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008c3:	48 f7 f1             	div    %rcx
+  8008c6:	48 b8 27 e5 ff ff ff 	movabs $0xffffffffffffe527,%rax
+  8008cd:	ff ff ff 
+  8008d0:	48 01 d8             	add    %rbx,%rax
+  8008d3:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8008d7:	0f be c0             	movsbl %al,%eax
+  8008da:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008de:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8008e2:	48 89 d6             	mov    %rdx,%rsi
+  8008e5:	89 c7                	mov    %eax,%edi
+  8008e7:	ff d1                	call   *%rcx
+}
+  8008e9:	90                   	nop
+  8008ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008ee:	c9                   	leave
+  8008ef:	c3                   	ret
+
+00000000008008f0 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8008f0:	55                   	push   %rbp
+  8008f1:	48 89 e5             	mov    %rsp,%rbp
+  8008f4:	48 83 ec 20          	sub    $0x20,%rsp
+  8008f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008f8 <getuint+0x8>
+  8008ff:	49 bb 40 87 00 00 00 	movabs $0x8740,%r11
+  800906:	00 00 00 
+  800909:	4c 01 d8             	add    %r11,%rax
+  80090c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800910:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800913:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800917:	7e 4f                	jle    800968 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800919:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80091d:	8b 00                	mov    (%rax),%eax
+  80091f:	83 f8 2f             	cmp    $0x2f,%eax
+  800922:	77 24                	ja     800948 <getuint+0x58>
+  800924:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800928:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80092c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800930:	8b 00                	mov    (%rax),%eax
+  800932:	89 c0                	mov    %eax,%eax
+  800934:	48 01 d0             	add    %rdx,%rax
+  800937:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80093b:	8b 12                	mov    (%rdx),%edx
+  80093d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800940:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800944:	89 0a                	mov    %ecx,(%rdx)
+  800946:	eb 14                	jmp    80095c <getuint+0x6c>
+  800948:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80094c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800950:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800954:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800958:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80095c:	48 8b 00             	mov    (%rax),%rax
+  80095f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800963:	e9 9d 00 00 00       	jmp    800a05 <getuint+0x115>
+	else if (lflag)
+  800968:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80096c:	74 4c                	je     8009ba <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  80096e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800972:	8b 00                	mov    (%rax),%eax
+  800974:	83 f8 2f             	cmp    $0x2f,%eax
+  800977:	77 24                	ja     80099d <getuint+0xad>
+  800979:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80097d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800981:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800985:	8b 00                	mov    (%rax),%eax
+  800987:	89 c0                	mov    %eax,%eax
+  800989:	48 01 d0             	add    %rdx,%rax
+  80098c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800990:	8b 12                	mov    (%rdx),%edx
+  800992:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800995:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800999:	89 0a                	mov    %ecx,(%rdx)
+  80099b:	eb 14                	jmp    8009b1 <getuint+0xc1>
+  80099d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009a5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009a9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009ad:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009b1:	48 8b 00             	mov    (%rax),%rax
+  8009b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009b8:	eb 4b                	jmp    800a05 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8009ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009be:	8b 00                	mov    (%rax),%eax
+  8009c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c3:	77 24                	ja     8009e9 <getuint+0xf9>
+  8009c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009d1:	8b 00                	mov    (%rax),%eax
+  8009d3:	89 c0                	mov    %eax,%eax
+  8009d5:	48 01 d0             	add    %rdx,%rax
+  8009d8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009dc:	8b 12                	mov    (%rdx),%edx
+  8009de:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009e1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009e5:	89 0a                	mov    %ecx,(%rdx)
+  8009e7:	eb 14                	jmp    8009fd <getuint+0x10d>
+  8009e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009f1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009f9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009fd:	8b 00                	mov    (%rax),%eax
+  8009ff:	89 c0                	mov    %eax,%eax
+  800a01:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a09:	c9                   	leave
+  800a0a:	c3                   	ret
+
+0000000000800a0b <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800a0b:	55                   	push   %rbp
+  800a0c:	48 89 e5             	mov    %rsp,%rbp
+  800a0f:	48 83 ec 20          	sub    $0x20,%rsp
+  800a13:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a13 <printfloat+0x8>
+  800a1a:	49 bb 25 86 00 00 00 	movabs $0x8625,%r11
+  800a21:	00 00 00 
+  800a24:	4c 01 d8             	add    %r11,%rax
+  800a27:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a2b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a2f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800a33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a37:	48 85 c0             	test   %rax,%rax
+  800a3a:	79 12                	jns    800a4e <printfloat+0x43>
+		putch('-',putdat);
+  800a3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a40:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a44:	48 89 c6             	mov    %rax,%rsi
+  800a47:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a4c:	ff d2                	call   *%rdx
+	
+}
+  800a4e:	90                   	nop
+  800a4f:	c9                   	leave
+  800a50:	c3                   	ret
+
+0000000000800a51 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800a51:	55                   	push   %rbp
+  800a52:	48 89 e5             	mov    %rsp,%rbp
+  800a55:	48 83 ec 20          	sub    $0x20,%rsp
+  800a59:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a59 <getint+0x8>
+  800a60:	49 bb df 85 00 00 00 	movabs $0x85df,%r11
+  800a67:	00 00 00 
+  800a6a:	4c 01 d8             	add    %r11,%rax
+  800a6d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a71:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800a74:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a78:	7e 4f                	jle    800ac9 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800a7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a7e:	8b 00                	mov    (%rax),%eax
+  800a80:	83 f8 2f             	cmp    $0x2f,%eax
+  800a83:	77 24                	ja     800aa9 <getint+0x58>
+  800a85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a89:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a91:	8b 00                	mov    (%rax),%eax
+  800a93:	89 c0                	mov    %eax,%eax
+  800a95:	48 01 d0             	add    %rdx,%rax
+  800a98:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a9c:	8b 12                	mov    (%rdx),%edx
+  800a9e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800aa1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aa5:	89 0a                	mov    %ecx,(%rdx)
+  800aa7:	eb 14                	jmp    800abd <getint+0x6c>
+  800aa9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ab1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ab5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ab9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800abd:	48 8b 00             	mov    (%rax),%rax
+  800ac0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800ac4:	e9 9d 00 00 00       	jmp    800b66 <getint+0x115>
+	else if (lflag)
+  800ac9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800acd:	74 4c                	je     800b1b <getint+0xca>
+		x=va_arg(*ap, long);
+  800acf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad3:	8b 00                	mov    (%rax),%eax
+  800ad5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad8:	77 24                	ja     800afe <getint+0xad>
+  800ada:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ade:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ae2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae6:	8b 00                	mov    (%rax),%eax
+  800ae8:	89 c0                	mov    %eax,%eax
+  800aea:	48 01 d0             	add    %rdx,%rax
+  800aed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800af1:	8b 12                	mov    (%rdx),%edx
+  800af3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800af6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800afa:	89 0a                	mov    %ecx,(%rdx)
+  800afc:	eb 14                	jmp    800b12 <getint+0xc1>
+  800afe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b02:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b06:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b0a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b0e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b12:	48 8b 00             	mov    (%rax),%rax
+  800b15:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b19:	eb 4b                	jmp    800b66 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800b1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b1f:	8b 00                	mov    (%rax),%eax
+  800b21:	83 f8 2f             	cmp    $0x2f,%eax
+  800b24:	77 24                	ja     800b4a <getint+0xf9>
+  800b26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b2a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b32:	8b 00                	mov    (%rax),%eax
+  800b34:	89 c0                	mov    %eax,%eax
+  800b36:	48 01 d0             	add    %rdx,%rax
+  800b39:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b3d:	8b 12                	mov    (%rdx),%edx
+  800b3f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b42:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b46:	89 0a                	mov    %ecx,(%rdx)
+  800b48:	eb 14                	jmp    800b5e <getint+0x10d>
+  800b4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b52:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b56:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b5a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b5e:	8b 00                	mov    (%rax),%eax
+  800b60:	48 98                	cltq
+  800b62:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b6a:	c9                   	leave
+  800b6b:	c3                   	ret
+
+0000000000800b6c <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800b6c:	55                   	push   %rbp
+  800b6d:	48 89 e5             	mov    %rsp,%rbp
+  800b70:	41 57                	push   %r15
+  800b72:	41 55                	push   %r13
+  800b74:	41 54                	push   %r12
+  800b76:	53                   	push   %rbx
+  800b77:	48 83 ec 60          	sub    $0x60,%rsp
+  800b7b:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800b7b <vprintfmt+0xf>
+  800b82:	49 bb bd 84 00 00 00 	movabs $0x84bd,%r11
+  800b89:	00 00 00 
+  800b8c:	4d 01 dc             	add    %r11,%r12
+  800b8f:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800b93:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800b97:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b9b:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800b9f:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800ba6:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800baa:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800bae:	48 8b 06             	mov    (%rsi),%rax
+  800bb1:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800bb5:	48 89 01             	mov    %rax,(%rcx)
+  800bb8:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800bbc:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800bc0:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800bc4:	eb 17                	jmp    800bdd <vprintfmt+0x71>
+			if (ch == '\0')
+  800bc6:	85 db                	test   %ebx,%ebx
+  800bc8:	0f 84 97 05 00 00    	je     801165 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800bce:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800bd2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800bd6:	48 89 c6             	mov    %rax,%rsi
+  800bd9:	89 df                	mov    %ebx,%edi
+  800bdb:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800bdd:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800be1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800be5:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800be9:	0f b6 00             	movzbl (%rax),%eax
+  800bec:	0f b6 d8             	movzbl %al,%ebx
+  800bef:	83 fb 25             	cmp    $0x25,%ebx
+  800bf2:	75 d2                	jne    800bc6 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800bf4:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800bf8:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800bff:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800c06:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800c0d:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800c14:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c18:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c1c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c20:	0f b6 00             	movzbl (%rax),%eax
+  800c23:	0f b6 d8             	movzbl %al,%ebx
+  800c26:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c29:	83 f8 55             	cmp    $0x55,%eax
+  800c2c:	0f 87 00 05 00 00    	ja     801132 <vprintfmt+0x5c6>
+  800c32:	89 c0                	mov    %eax,%eax
+  800c34:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c3b:	00 
+  800c3c:	48 8d 05 45 69 00 00 	lea    0x6945(%rip),%rax        # 807588 <.LC18+0xc>
+  800c43:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800c47:	48 8d 15 3a 69 00 00 	lea    0x693a(%rip),%rdx        # 807588 <.LC18+0xc>
+  800c4e:	48 01 d0             	add    %rdx,%rax
+  800c51:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800c53:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800c57:	eb bb                	jmp    800c14 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800c59:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800c5d:	eb b5                	jmp    800c14 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800c5f:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c66:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800c69:	89 d0                	mov    %edx,%eax
+  800c6b:	c1 e0 02             	shl    $0x2,%eax
+  800c6e:	01 d0                	add    %edx,%eax
+  800c70:	01 c0                	add    %eax,%eax
+  800c72:	01 d8                	add    %ebx,%eax
+  800c74:	83 e8 30             	sub    $0x30,%eax
+  800c77:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800c7a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c7e:	0f b6 00             	movzbl (%rax),%eax
+  800c81:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800c84:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c87:	7e 60                	jle    800ce9 <vprintfmt+0x17d>
+  800c89:	83 fb 39             	cmp    $0x39,%ebx
+  800c8c:	7f 5b                	jg     800ce9 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800c8e:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c93:	eb d1                	jmp    800c66 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800c95:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c98:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9b:	77 17                	ja     800cb4 <vprintfmt+0x148>
+  800c9d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ca1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ca4:	89 d2                	mov    %edx,%edx
+  800ca6:	48 01 d0             	add    %rdx,%rax
+  800ca9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cac:	83 c2 08             	add    $0x8,%edx
+  800caf:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cb2:	eb 0c                	jmp    800cc0 <vprintfmt+0x154>
+  800cb4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cb8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cbc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800cc0:	8b 00                	mov    (%rax),%eax
+  800cc2:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800cc5:	eb 23                	jmp    800cea <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800cc7:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ccb:	0f 89 43 ff ff ff    	jns    800c14 <vprintfmt+0xa8>
+				width = 0;
+  800cd1:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800cd8:	e9 37 ff ff ff       	jmp    800c14 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800cdd:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800ce4:	e9 2b ff ff ff       	jmp    800c14 <vprintfmt+0xa8>
+			goto process_precision;
+  800ce9:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800cea:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800cee:	0f 89 20 ff ff ff    	jns    800c14 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800cf4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800cf7:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800cfa:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800d01:	e9 0e ff ff ff       	jmp    800c14 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800d06:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800d0a:	e9 05 ff ff ff       	jmp    800c14 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800d0f:	83 fb 39             	cmp    $0x39,%ebx
+  800d12:	7f 0b                	jg     800d1f <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800d14:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800d17:	c1 e0 08             	shl    $0x8,%eax
+  800d1a:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d1d:	eb 21                	jmp    800d40 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800d1f:	83 fb 60             	cmp    $0x60,%ebx
+  800d22:	7e 10                	jle    800d34 <vprintfmt+0x1c8>
+  800d24:	83 fb 66             	cmp    $0x66,%ebx
+  800d27:	7f 0b                	jg     800d34 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800d29:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800d2c:	c1 e0 08             	shl    $0x8,%eax
+  800d2f:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d32:	eb 0c                	jmp    800d40 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800d34:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800d3b:	e9 04 01 00 00       	jmp    800e44 <vprintfmt+0x2d8>
+  800d40:	e9 ff 00 00 00       	jmp    800e44 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800d45:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d48:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4b:	77 17                	ja     800d64 <vprintfmt+0x1f8>
+  800d4d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d51:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d54:	89 d2                	mov    %edx,%edx
+  800d56:	48 01 d0             	add    %rdx,%rax
+  800d59:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d5c:	83 c2 08             	add    $0x8,%edx
+  800d5f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d62:	eb 0c                	jmp    800d70 <vprintfmt+0x204>
+  800d64:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d68:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d6c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d70:	8b 00                	mov    (%rax),%eax
+  800d72:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800d76:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800d7a:	48 89 d6             	mov    %rdx,%rsi
+  800d7d:	89 c7                	mov    %eax,%edi
+  800d7f:	ff d1                	call   *%rcx
+			break;
+  800d81:	e9 da 03 00 00       	jmp    801160 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800d86:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d89:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8c:	77 17                	ja     800da5 <vprintfmt+0x239>
+  800d8e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d92:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d95:	89 d2                	mov    %edx,%edx
+  800d97:	48 01 d0             	add    %rdx,%rax
+  800d9a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d9d:	83 c2 08             	add    $0x8,%edx
+  800da0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800da3:	eb 0c                	jmp    800db1 <vprintfmt+0x245>
+  800da5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800da9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dad:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800db1:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800db3:	85 db                	test   %ebx,%ebx
+  800db5:	79 02                	jns    800db9 <vprintfmt+0x24d>
+				err = -err;
+  800db7:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800db9:	83 fb 15             	cmp    $0x15,%ebx
+  800dbc:	7f 19                	jg     800dd7 <vprintfmt+0x26b>
+  800dbe:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  800dc5:	00 00 00 
+  800dc8:	48 63 c3             	movslq %ebx,%rax
+  800dcb:	4c 01 e2             	add    %r12,%rdx
+  800dce:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800dd2:	4d 85 ed             	test   %r13,%r13
+  800dd5:	75 36                	jne    800e0d <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800dd7:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800ddb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ddf:	89 d9                	mov    %ebx,%ecx
+  800de1:	48 ba 38 e5 ff ff ff 	movabs $0xffffffffffffe538,%rdx
+  800de8:	ff ff ff 
+  800deb:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800def:	48 89 c7             	mov    %rax,%rdi
+  800df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df7:	49 b8 3b 81 ff ff ff 	movabs $0xffffffffffff813b,%r8
+  800dfe:	ff ff ff 
+  800e01:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e05:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800e08:	e9 53 03 00 00       	jmp    801160 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800e0d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e11:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e15:	4c 89 e9             	mov    %r13,%rcx
+  800e18:	48 ba 41 e5 ff ff ff 	movabs $0xffffffffffffe541,%rdx
+  800e1f:	ff ff ff 
+  800e22:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e26:	48 89 c7             	mov    %rax,%rdi
+  800e29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2e:	49 b8 3b 81 ff ff ff 	movabs $0xffffffffffff813b,%r8
+  800e35:	ff ff ff 
+  800e38:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e3c:	41 ff d0             	call   *%r8
+			break;
+  800e3f:	e9 1c 03 00 00       	jmp    801160 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800e44:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e47:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4a:	77 17                	ja     800e63 <vprintfmt+0x2f7>
+  800e4c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e50:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e53:	89 d2                	mov    %edx,%edx
+  800e55:	48 01 d0             	add    %rdx,%rax
+  800e58:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e5b:	83 c2 08             	add    $0x8,%edx
+  800e5e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e61:	eb 0c                	jmp    800e6f <vprintfmt+0x303>
+  800e63:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e67:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e6b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e6f:	4c 8b 28             	mov    (%rax),%r13
+  800e72:	4d 85 ed             	test   %r13,%r13
+  800e75:	75 0e                	jne    800e85 <vprintfmt+0x319>
+				p = "(null)";
+  800e77:	48 b8 44 e5 ff ff ff 	movabs $0xffffffffffffe544,%rax
+  800e7e:	ff ff ff 
+  800e81:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800e85:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e89:	0f 8e 84 00 00 00    	jle    800f13 <vprintfmt+0x3a7>
+  800e8f:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800e93:	74 7e                	je     800f13 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800e95:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800e98:	48 98                	cltq
+  800e9a:	48 89 c6             	mov    %rax,%rsi
+  800e9d:	4c 89 ef             	mov    %r13,%rdi
+  800ea0:	4d 89 e7             	mov    %r12,%r15
+  800ea3:	48 b8 60 84 ff ff ff 	movabs $0xffffffffffff8460,%rax
+  800eaa:	ff ff ff 
+  800ead:	4c 01 e0             	add    %r12,%rax
+  800eb0:	ff d0                	call   *%rax
+  800eb2:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800eb5:	eb 17                	jmp    800ece <vprintfmt+0x362>
+					putch(padc, putdat);
+  800eb7:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800ebb:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800ebf:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800ec3:	48 89 d6             	mov    %rdx,%rsi
+  800ec6:	89 c7                	mov    %eax,%edi
+  800ec8:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800eca:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ece:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ed2:	7f e3                	jg     800eb7 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ed4:	eb 3d                	jmp    800f13 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800ed6:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800eda:	74 1e                	je     800efa <vprintfmt+0x38e>
+  800edc:	83 fb 1f             	cmp    $0x1f,%ebx
+  800edf:	7e 05                	jle    800ee6 <vprintfmt+0x37a>
+  800ee1:	83 fb 7e             	cmp    $0x7e,%ebx
+  800ee4:	7e 14                	jle    800efa <vprintfmt+0x38e>
+					putch('?', putdat);
+  800ee6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800eea:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800eee:	48 89 c6             	mov    %rax,%rsi
+  800ef1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ef6:	ff d2                	call   *%rdx
+  800ef8:	eb 15                	jmp    800f0f <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800efa:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800efd:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800f00:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f04:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f08:	48 89 c6             	mov    %rax,%rsi
+  800f0b:	89 cf                	mov    %ecx,%edi
+  800f0d:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f0f:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f13:	4c 89 e8             	mov    %r13,%rax
+  800f16:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800f1a:	0f b6 00             	movzbl (%rax),%eax
+  800f1d:	0f be d8             	movsbl %al,%ebx
+  800f20:	85 db                	test   %ebx,%ebx
+  800f22:	74 28                	je     800f4c <vprintfmt+0x3e0>
+  800f24:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f28:	78 ac                	js     800ed6 <vprintfmt+0x36a>
+  800f2a:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800f2e:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f32:	79 a2                	jns    800ed6 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800f34:	eb 16                	jmp    800f4c <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800f36:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f3a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f3e:	48 89 c6             	mov    %rax,%rsi
+  800f41:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f46:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800f48:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f4c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f50:	7f e4                	jg     800f36 <vprintfmt+0x3ca>
+			break;
+  800f52:	e9 09 02 00 00       	jmp    801160 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800f57:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f5b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f5f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f63:	0f b6 00             	movzbl (%rax),%eax
+  800f66:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800f69:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800f6a:	83 fb 2f             	cmp    $0x2f,%ebx
+  800f6d:	0f 8e ac fd ff ff    	jle    800d1f <vprintfmt+0x1b3>
+  800f73:	e9 97 fd ff ff       	jmp    800d0f <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800f78:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f7c:	be 03 00 00 00       	mov    $0x3,%esi
+  800f81:	48 89 c7             	mov    %rax,%rdi
+  800f84:	48 b8 19 7a ff ff ff 	movabs $0xffffffffffff7a19,%rax
+  800f8b:	ff ff ff 
+  800f8e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f92:	ff d0                	call   *%rax
+  800f94:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800f98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	79 1d                	jns    800fbe <vprintfmt+0x452>
+				putch('-', putdat);
+  800fa1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fa5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fa9:	48 89 c6             	mov    %rax,%rsi
+  800fac:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800fb1:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800fb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fb7:	48 f7 d8             	neg    %rax
+  800fba:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800fbe:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800fc5:	e9 de 00 00 00       	jmp    8010a8 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800fca:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fce:	be 03 00 00 00       	mov    $0x3,%esi
+  800fd3:	48 89 c7             	mov    %rax,%rdi
+  800fd6:	48 b8 b8 78 ff ff ff 	movabs $0xffffffffffff78b8,%rax
+  800fdd:	ff ff ff 
+  800fe0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fe4:	ff d0                	call   *%rax
+  800fe6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800fea:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800ff1:	e9 b2 00 00 00       	jmp    8010a8 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800ff6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ffa:	be 03 00 00 00       	mov    $0x3,%esi
+  800fff:	48 89 c7             	mov    %rax,%rdi
+  801002:	48 b8 b8 78 ff ff ff 	movabs $0xffffffffffff78b8,%rax
+  801009:	ff ff ff 
+  80100c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801010:	ff d0                	call   *%rax
+  801012:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801016:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  80101d:	e9 86 00 00 00       	jmp    8010a8 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801022:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801026:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80102a:	48 89 c6             	mov    %rax,%rsi
+  80102d:	bf 30 00 00 00       	mov    $0x30,%edi
+  801032:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801034:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801038:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80103c:	48 89 c6             	mov    %rax,%rsi
+  80103f:	bf 78 00 00 00       	mov    $0x78,%edi
+  801044:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801046:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801049:	83 f8 2f             	cmp    $0x2f,%eax
+  80104c:	77 17                	ja     801065 <vprintfmt+0x4f9>
+  80104e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801052:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801055:	89 d2                	mov    %edx,%edx
+  801057:	48 01 d0             	add    %rdx,%rax
+  80105a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80105d:	83 c2 08             	add    $0x8,%edx
+  801060:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801063:	eb 0c                	jmp    801071 <vprintfmt+0x505>
+  801065:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801069:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80106d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801071:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801074:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801078:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  80107f:	eb 27                	jmp    8010a8 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801081:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801085:	be 03 00 00 00       	mov    $0x3,%esi
+  80108a:	48 89 c7             	mov    %rax,%rdi
+  80108d:	48 b8 b8 78 ff ff ff 	movabs $0xffffffffffff78b8,%rax
+  801094:	ff ff ff 
+  801097:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80109b:	ff d0                	call   *%rax
+  80109d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010a1:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8010a8:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8010ad:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8010b0:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8010b3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010b7:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8010bb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010bf:	45 89 c1             	mov    %r8d,%r9d
+  8010c2:	41 89 f8             	mov    %edi,%r8d
+  8010c5:	48 89 c7             	mov    %rax,%rdi
+  8010c8:	48 b8 e0 77 ff ff ff 	movabs $0xffffffffffff77e0,%rax
+  8010cf:	ff ff ff 
+  8010d2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010d6:	ff d0                	call   *%rax
+			break;
+  8010d8:	e9 83 00 00 00       	jmp    801160 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8010dd:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010e1:	be 03 00 00 00       	mov    $0x3,%esi
+  8010e6:	48 89 c7             	mov    %rax,%rdi
+  8010e9:	48 b8 b8 78 ff ff ff 	movabs $0xffffffffffff78b8,%rax
+  8010f0:	ff ff ff 
+  8010f3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010f7:	ff d0                	call   *%rax
+  8010f9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8010fd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801101:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801105:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801109:	48 89 ce             	mov    %rcx,%rsi
+  80110c:	48 89 c7             	mov    %rax,%rdi
+  80110f:	48 b8 d3 79 ff ff ff 	movabs $0xffffffffffff79d3,%rax
+  801116:	ff ff ff 
+  801119:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80111d:	ff d0                	call   *%rax
+	
+			break;
+  80111f:	eb 3f                	jmp    801160 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801121:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801125:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801129:	48 89 c6             	mov    %rax,%rsi
+  80112c:	89 df                	mov    %ebx,%edi
+  80112e:	ff d2                	call   *%rdx
+			break;
+  801130:	eb 2e                	jmp    801160 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801132:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801136:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80113a:	48 89 c6             	mov    %rax,%rsi
+  80113d:	bf 25 00 00 00       	mov    $0x25,%edi
+  801142:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801144:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801149:	eb 05                	jmp    801150 <vprintfmt+0x5e4>
+  80114b:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801150:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801154:	48 83 e8 01          	sub    $0x1,%rax
+  801158:	0f b6 00             	movzbl (%rax),%eax
+  80115b:	3c 25                	cmp    $0x25,%al
+  80115d:	75 ec                	jne    80114b <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  80115f:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801160:	e9 78 fa ff ff       	jmp    800bdd <vprintfmt+0x71>
+				return;
+  801165:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801166:	48 83 c4 60          	add    $0x60,%rsp
+  80116a:	5b                   	pop    %rbx
+  80116b:	41 5c                	pop    %r12
+  80116d:	41 5d                	pop    %r13
+  80116f:	41 5f                	pop    %r15
+  801171:	5d                   	pop    %rbp
+  801172:	c3                   	ret
+
+0000000000801173 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801173:	55                   	push   %rbp
+  801174:	48 89 e5             	mov    %rsp,%rbp
+  801177:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80117e:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80117e <printfmt+0xb>
+  801185:	49 bb ba 7e 00 00 00 	movabs $0x7eba,%r11
+  80118c:	00 00 00 
+  80118f:	4d 01 da             	add    %r11,%r10
+  801192:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801199:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8011a0:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8011a7:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8011ae:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8011b5:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8011bc:	84 c0                	test   %al,%al
+  8011be:	74 20                	je     8011e0 <printfmt+0x6d>
+  8011c0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8011c4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8011c8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8011cc:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8011d0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8011d4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8011d8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8011dc:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8011e0:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8011e7:	00 00 00 
+  8011ea:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8011f1:	00 00 00 
+  8011f4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011f8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8011ff:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801206:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80120d:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801214:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80121b:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801222:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801229:	48 89 c7             	mov    %rax,%rdi
+  80122c:	48 b8 34 7b ff ff ff 	movabs $0xffffffffffff7b34,%rax
+  801233:	ff ff ff 
+  801236:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80123a:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  80123c:	90                   	nop
+  80123d:	c9                   	leave
+  80123e:	c3                   	ret
+
+000000000080123f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80123f:	55                   	push   %rbp
+  801240:	48 89 e5             	mov    %rsp,%rbp
+  801243:	48 83 ec 10          	sub    $0x10,%rsp
+  801247:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801247 <sprintputch+0x8>
+  80124e:	49 bb f1 7d 00 00 00 	movabs $0x7df1,%r11
+  801255:	00 00 00 
+  801258:	4c 01 d8             	add    %r11,%rax
+  80125b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80125e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801262:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801266:	8b 40 10             	mov    0x10(%rax),%eax
+  801269:	8d 50 01             	lea    0x1(%rax),%edx
+  80126c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801270:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801273:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801277:	48 8b 10             	mov    (%rax),%rdx
+  80127a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80127e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801282:	48 39 c2             	cmp    %rax,%rdx
+  801285:	73 17                	jae    80129e <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801287:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80128b:	48 8b 00             	mov    (%rax),%rax
+  80128e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801292:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801296:	48 89 0a             	mov    %rcx,(%rdx)
+  801299:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80129c:	88 10                	mov    %dl,(%rax)
+}
+  80129e:	90                   	nop
+  80129f:	c9                   	leave
+  8012a0:	c3                   	ret
+
+00000000008012a1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8012a1:	55                   	push   %rbp
+  8012a2:	48 89 e5             	mov    %rsp,%rbp
+  8012a5:	53                   	push   %rbx
+  8012a6:	48 83 ec 58          	sub    $0x58,%rsp
+  8012aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012aa <vsnprintf+0x9>
+  8012b1:	49 bb 8e 7d 00 00 00 	movabs $0x7d8e,%r11
+  8012b8:	00 00 00 
+  8012bb:	4c 01 d8             	add    %r11,%rax
+  8012be:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8012c2:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8012c5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8012c9:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8012cd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8012d1:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8012d5:	48 8b 0e             	mov    (%rsi),%rcx
+  8012d8:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8012dc:	48 89 0a             	mov    %rcx,(%rdx)
+  8012df:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8012e3:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8012e7:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8012eb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8012ef:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8012f3:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8012f6:	48 63 d2             	movslq %edx,%rdx
+  8012f9:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8012fd:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801301:	48 01 ca             	add    %rcx,%rdx
+  801304:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801308:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80130f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801314:	74 06                	je     80131c <vsnprintf+0x7b>
+  801316:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  80131a:	7f 07                	jg     801323 <vsnprintf+0x82>
+		return -E_INVAL;
+  80131c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801321:	eb 34                	jmp    801357 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801323:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801327:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80132b:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80132f:	48 bf 07 82 ff ff ff 	movabs $0xffffffffffff8207,%rdi
+  801336:	ff ff ff 
+  801339:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  80133d:	49 b8 34 7b ff ff ff 	movabs $0xffffffffffff7b34,%r8
+  801344:	ff ff ff 
+  801347:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80134b:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  80134d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801351:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801354:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801357:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80135b:	c9                   	leave
+  80135c:	c3                   	ret
+
+000000000080135d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80135d:	55                   	push   %rbp
+  80135e:	48 89 e5             	mov    %rsp,%rbp
+  801361:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801368:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801368 <snprintf+0xb>
+  80136f:	49 bb d0 7c 00 00 00 	movabs $0x7cd0,%r11
+  801376:	00 00 00 
+  801379:	4d 01 da             	add    %r11,%r10
+  80137c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801383:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801389:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801390:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801397:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80139e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8013a5:	84 c0                	test   %al,%al
+  8013a7:	74 20                	je     8013c9 <snprintf+0x6c>
+  8013a9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8013ad:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8013b1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8013b5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8013b9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8013bd:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8013c1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8013c5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8013c9:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8013d0:	00 00 00 
+  8013d3:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8013da:	00 00 00 
+  8013dd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8013e1:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8013e8:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8013ef:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8013f6:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8013fd:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801404:	48 8b 06             	mov    (%rsi),%rax
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 89 01             	mov    %rax,(%rcx)
+  80140e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801412:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801416:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80141a:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801421:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801428:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80142e:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801435:	48 89 c7             	mov    %rax,%rdi
+  801438:	48 b8 69 82 ff ff ff 	movabs $0xffffffffffff8269,%rax
+  80143f:	ff ff ff 
+  801442:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801446:	ff d0                	call   *%rax
+  801448:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  80144e:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801454:	c9                   	leave
+  801455:	c3                   	ret
+
+0000000000801456 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801456:	55                   	push   %rbp
+  801457:	48 89 e5             	mov    %rsp,%rbp
+  80145a:	48 83 ec 18          	sub    $0x18,%rsp
+  80145e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80145e <strlen+0x8>
+  801465:	49 bb da 7b 00 00 00 	movabs $0x7bda,%r11
+  80146c:	00 00 00 
+  80146f:	4c 01 d8             	add    %r11,%rax
+  801472:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801476:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80147d:	eb 09                	jmp    801488 <strlen+0x32>
+		n++;
+  80147f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801483:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801488:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80148c:	0f b6 00             	movzbl (%rax),%eax
+  80148f:	84 c0                	test   %al,%al
+  801491:	75 ec                	jne    80147f <strlen+0x29>
+	return n;
+  801493:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+
+0000000000801498 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801498:	55                   	push   %rbp
+  801499:	48 89 e5             	mov    %rsp,%rbp
+  80149c:	48 83 ec 20          	sub    $0x20,%rsp
+  8014a0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014a0 <strnlen+0x8>
+  8014a7:	49 bb 98 7b 00 00 00 	movabs $0x7b98,%r11
+  8014ae:	00 00 00 
+  8014b1:	4c 01 d8             	add    %r11,%rax
+  8014b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014b8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014bc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014c3:	eb 0e                	jmp    8014d3 <strnlen+0x3b>
+		n++;
+  8014c5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014c9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014ce:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8014d3:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8014d8:	74 0b                	je     8014e5 <strnlen+0x4d>
+  8014da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014de:	0f b6 00             	movzbl (%rax),%eax
+  8014e1:	84 c0                	test   %al,%al
+  8014e3:	75 e0                	jne    8014c5 <strnlen+0x2d>
+	return n;
+  8014e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8014e8:	c9                   	leave
+  8014e9:	c3                   	ret
+
+00000000008014ea <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8014ea:	55                   	push   %rbp
+  8014eb:	48 89 e5             	mov    %rsp,%rbp
+  8014ee:	48 83 ec 20          	sub    $0x20,%rsp
+  8014f2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014f2 <strcpy+0x8>
+  8014f9:	49 bb 46 7b 00 00 00 	movabs $0x7b46,%r11
+  801500:	00 00 00 
+  801503:	4c 01 d8             	add    %r11,%rax
+  801506:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80150a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80150e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801512:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801516:	90                   	nop
+  801517:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80151b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80151f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801523:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801527:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80152b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80152f:	0f b6 12             	movzbl (%rdx),%edx
+  801532:	88 10                	mov    %dl,(%rax)
+  801534:	0f b6 00             	movzbl (%rax),%eax
+  801537:	84 c0                	test   %al,%al
+  801539:	75 dc                	jne    801517 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  80153b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80153f:	c9                   	leave
+  801540:	c3                   	ret
+
+0000000000801541 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801541:	55                   	push   %rbp
+  801542:	48 89 e5             	mov    %rsp,%rbp
+  801545:	53                   	push   %rbx
+  801546:	48 83 ec 20          	sub    $0x20,%rsp
+  80154a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80154a <strcat+0x9>
+  801551:	49 bb ee 7a 00 00 00 	movabs $0x7aee,%r11
+  801558:	00 00 00 
+  80155b:	4c 01 db             	add    %r11,%rbx
+  80155e:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801562:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801566:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80156a:	48 89 c7             	mov    %rax,%rdi
+  80156d:	48 b8 1e 84 ff ff ff 	movabs $0xffffffffffff841e,%rax
+  801574:	ff ff ff 
+  801577:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80157b:	ff d0                	call   *%rax
+  80157d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801580:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801583:	48 63 d0             	movslq %eax,%rdx
+  801586:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80158a:	48 01 c2             	add    %rax,%rdx
+  80158d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801591:	48 89 c6             	mov    %rax,%rsi
+  801594:	48 89 d7             	mov    %rdx,%rdi
+  801597:	48 b8 b2 84 ff ff ff 	movabs $0xffffffffffff84b2,%rax
+  80159e:	ff ff ff 
+  8015a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015a5:	ff d0                	call   *%rax
+	return dst;
+  8015a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8015ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+
+00000000008015b1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8015b1:	55                   	push   %rbp
+  8015b2:	48 89 e5             	mov    %rsp,%rbp
+  8015b5:	48 83 ec 28          	sub    $0x28,%rsp
+  8015b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015b9 <strncpy+0x8>
+  8015c0:	49 bb 7f 7a 00 00 00 	movabs $0x7a7f,%r11
+  8015c7:	00 00 00 
+  8015ca:	4c 01 d8             	add    %r11,%rax
+  8015cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015d1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015d5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8015d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015dd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8015e1:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8015e8:	00 
+  8015e9:	eb 2a                	jmp    801615 <strncpy+0x64>
+		*dst++ = *src;
+  8015eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015ef:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015f3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8015f7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015fb:	0f b6 12             	movzbl (%rdx),%edx
+  8015fe:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801600:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801604:	0f b6 00             	movzbl (%rax),%eax
+  801607:	84 c0                	test   %al,%al
+  801609:	74 05                	je     801610 <strncpy+0x5f>
+			src++;
+  80160b:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801610:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801615:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801619:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80161d:	72 cc                	jb     8015eb <strncpy+0x3a>
+	}
+	return ret;
+  80161f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801623:	c9                   	leave
+  801624:	c3                   	ret
+
+0000000000801625 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801625:	55                   	push   %rbp
+  801626:	48 89 e5             	mov    %rsp,%rbp
+  801629:	48 83 ec 28          	sub    $0x28,%rsp
+  80162d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80162d <strlcpy+0x8>
+  801634:	49 bb 0b 7a 00 00 00 	movabs $0x7a0b,%r11
+  80163b:	00 00 00 
+  80163e:	4c 01 d8             	add    %r11,%rax
+  801641:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801645:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801649:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80164d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801651:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801655:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80165a:	74 3d                	je     801699 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  80165c:	eb 1d                	jmp    80167b <strlcpy+0x56>
+			*dst++ = *src++;
+  80165e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801662:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801666:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80166a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80166e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801672:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801676:	0f b6 12             	movzbl (%rdx),%edx
+  801679:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80167b:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801680:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801685:	74 0b                	je     801692 <strlcpy+0x6d>
+  801687:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80168b:	0f b6 00             	movzbl (%rax),%eax
+  80168e:	84 c0                	test   %al,%al
+  801690:	75 cc                	jne    80165e <strlcpy+0x39>
+		*dst = '\0';
+  801692:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801696:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801699:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80169d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8016a1:	c9                   	leave
+  8016a2:	c3                   	ret
+
+00000000008016a3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8016a3:	55                   	push   %rbp
+  8016a4:	48 89 e5             	mov    %rsp,%rbp
+  8016a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8016ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016ab <strcmp+0x8>
+  8016b2:	49 bb 8d 79 00 00 00 	movabs $0x798d,%r11
+  8016b9:	00 00 00 
+  8016bc:	4c 01 d8             	add    %r11,%rax
+  8016bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016c3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8016c7:	eb 0a                	jmp    8016d3 <strcmp+0x30>
+		p++, q++;
+  8016c9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016ce:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8016d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016d7:	0f b6 00             	movzbl (%rax),%eax
+  8016da:	84 c0                	test   %al,%al
+  8016dc:	74 12                	je     8016f0 <strcmp+0x4d>
+  8016de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016e2:	0f b6 10             	movzbl (%rax),%edx
+  8016e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016e9:	0f b6 00             	movzbl (%rax),%eax
+  8016ec:	38 c2                	cmp    %al,%dl
+  8016ee:	74 d9                	je     8016c9 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8016f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f4:	0f b6 00             	movzbl (%rax),%eax
+  8016f7:	0f b6 d0             	movzbl %al,%edx
+  8016fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016fe:	0f b6 00             	movzbl (%rax),%eax
+  801701:	0f b6 c0             	movzbl %al,%eax
+  801704:	29 c2                	sub    %eax,%edx
+  801706:	89 d0                	mov    %edx,%eax
+}
+  801708:	c9                   	leave
+  801709:	c3                   	ret
+
+000000000080170a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80170a:	55                   	push   %rbp
+  80170b:	48 89 e5             	mov    %rsp,%rbp
+  80170e:	48 83 ec 18          	sub    $0x18,%rsp
+  801712:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801712 <strncmp+0x8>
+  801719:	49 bb 26 79 00 00 00 	movabs $0x7926,%r11
+  801720:	00 00 00 
+  801723:	4c 01 d8             	add    %r11,%rax
+  801726:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80172a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80172e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801732:	eb 0f                	jmp    801743 <strncmp+0x39>
+		n--, p++, q++;
+  801734:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801739:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80173e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801743:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801748:	74 1d                	je     801767 <strncmp+0x5d>
+  80174a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80174e:	0f b6 00             	movzbl (%rax),%eax
+  801751:	84 c0                	test   %al,%al
+  801753:	74 12                	je     801767 <strncmp+0x5d>
+  801755:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801759:	0f b6 10             	movzbl (%rax),%edx
+  80175c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801760:	0f b6 00             	movzbl (%rax),%eax
+  801763:	38 c2                	cmp    %al,%dl
+  801765:	74 cd                	je     801734 <strncmp+0x2a>
+	if (n == 0)
+  801767:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80176c:	75 07                	jne    801775 <strncmp+0x6b>
+		return 0;
+  80176e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801773:	eb 16                	jmp    80178b <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801775:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801779:	0f b6 00             	movzbl (%rax),%eax
+  80177c:	0f b6 d0             	movzbl %al,%edx
+  80177f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801783:	0f b6 00             	movzbl (%rax),%eax
+  801786:	0f b6 c0             	movzbl %al,%eax
+  801789:	29 c2                	sub    %eax,%edx
+}
+  80178b:	89 d0                	mov    %edx,%eax
+  80178d:	c9                   	leave
+  80178e:	c3                   	ret
+
+000000000080178f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80178f:	55                   	push   %rbp
+  801790:	48 89 e5             	mov    %rsp,%rbp
+  801793:	48 83 ec 10          	sub    $0x10,%rsp
+  801797:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801797 <strchr+0x8>
+  80179e:	49 bb a1 78 00 00 00 	movabs $0x78a1,%r11
+  8017a5:	00 00 00 
+  8017a8:	4c 01 d8             	add    %r11,%rax
+  8017ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017af:	89 f0                	mov    %esi,%eax
+  8017b1:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8017b4:	eb 17                	jmp    8017cd <strchr+0x3e>
+		if (*s == c)
+  8017b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ba:	0f b6 00             	movzbl (%rax),%eax
+  8017bd:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8017c0:	75 06                	jne    8017c8 <strchr+0x39>
+			return (char *) s;
+  8017c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c6:	eb 15                	jmp    8017dd <strchr+0x4e>
+	for (; *s; s++)
+  8017c8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017d1:	0f b6 00             	movzbl (%rax),%eax
+  8017d4:	84 c0                	test   %al,%al
+  8017d6:	75 de                	jne    8017b6 <strchr+0x27>
+	return 0;
+  8017d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017dd:	c9                   	leave
+  8017de:	c3                   	ret
+
+00000000008017df <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8017df:	55                   	push   %rbp
+  8017e0:	48 89 e5             	mov    %rsp,%rbp
+  8017e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8017e7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e7 <strfind+0x8>
+  8017ee:	49 bb 51 78 00 00 00 	movabs $0x7851,%r11
+  8017f5:	00 00 00 
+  8017f8:	4c 01 d8             	add    %r11,%rax
+  8017fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017ff:	89 f0                	mov    %esi,%eax
+  801801:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801804:	eb 11                	jmp    801817 <strfind+0x38>
+		if (*s == c)
+  801806:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180a:	0f b6 00             	movzbl (%rax),%eax
+  80180d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801810:	74 12                	je     801824 <strfind+0x45>
+	for (; *s; s++)
+  801812:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801817:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181b:	0f b6 00             	movzbl (%rax),%eax
+  80181e:	84 c0                	test   %al,%al
+  801820:	75 e4                	jne    801806 <strfind+0x27>
+  801822:	eb 01                	jmp    801825 <strfind+0x46>
+			break;
+  801824:	90                   	nop
+	return (char *) s;
+  801825:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801829:	c9                   	leave
+  80182a:	c3                   	ret
+
+000000000080182b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80182b:	55                   	push   %rbp
+  80182c:	48 89 e5             	mov    %rsp,%rbp
+  80182f:	48 83 ec 18          	sub    $0x18,%rsp
+  801833:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801833 <memset+0x8>
+  80183a:	49 bb 05 78 00 00 00 	movabs $0x7805,%r11
+  801841:	00 00 00 
+  801844:	4c 01 d8             	add    %r11,%rax
+  801847:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80184b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80184e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801852:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801857:	75 06                	jne    80185f <memset+0x34>
+		return v;
+  801859:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80185d:	eb 69                	jmp    8018c8 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  80185f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801863:	83 e0 03             	and    $0x3,%eax
+  801866:	48 85 c0             	test   %rax,%rax
+  801869:	75 48                	jne    8018b3 <memset+0x88>
+  80186b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80186f:	83 e0 03             	and    $0x3,%eax
+  801872:	48 85 c0             	test   %rax,%rax
+  801875:	75 3c                	jne    8018b3 <memset+0x88>
+		c &= 0xFF;
+  801877:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  80187e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801881:	c1 e0 18             	shl    $0x18,%eax
+  801884:	89 c2                	mov    %eax,%edx
+  801886:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801889:	c1 e0 10             	shl    $0x10,%eax
+  80188c:	09 c2                	or     %eax,%edx
+  80188e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801891:	c1 e0 08             	shl    $0x8,%eax
+  801894:	09 d0                	or     %edx,%eax
+  801896:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801899:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80189d:	48 c1 e8 02          	shr    $0x2,%rax
+  8018a1:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8018a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018a8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ab:	48 89 d7             	mov    %rdx,%rdi
+  8018ae:	fc                   	cld
+  8018af:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8018b1:	eb 11                	jmp    8018c4 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8018b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ba:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8018be:	48 89 d7             	mov    %rdx,%rdi
+  8018c1:	fc                   	cld
+  8018c2:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8018c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018c8:	c9                   	leave
+  8018c9:	c3                   	ret
+
+00000000008018ca <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8018ca:	55                   	push   %rbp
+  8018cb:	48 89 e5             	mov    %rsp,%rbp
+  8018ce:	48 83 ec 28          	sub    $0x28,%rsp
+  8018d2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018d2 <memmove+0x8>
+  8018d9:	49 bb 66 77 00 00 00 	movabs $0x7766,%r11
+  8018e0:	00 00 00 
+  8018e3:	4c 01 d8             	add    %r11,%rax
+  8018e6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018ee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8018f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018f6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8018fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801906:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80190a:	0f 83 88 00 00 00    	jae    801998 <memmove+0xce>
+  801910:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801914:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801918:	48 01 d0             	add    %rdx,%rax
+  80191b:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80191f:	73 77                	jae    801998 <memmove+0xce>
+		s += n;
+  801921:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801925:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801929:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80192d:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801931:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801935:	83 e0 03             	and    $0x3,%eax
+  801938:	48 85 c0             	test   %rax,%rax
+  80193b:	75 3b                	jne    801978 <memmove+0xae>
+  80193d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801941:	83 e0 03             	and    $0x3,%eax
+  801944:	48 85 c0             	test   %rax,%rax
+  801947:	75 2f                	jne    801978 <memmove+0xae>
+  801949:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80194d:	83 e0 03             	and    $0x3,%eax
+  801950:	48 85 c0             	test   %rax,%rax
+  801953:	75 23                	jne    801978 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801955:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801959:	48 83 e8 04          	sub    $0x4,%rax
+  80195d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801961:	48 83 ea 04          	sub    $0x4,%rdx
+  801965:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801969:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80196d:	48 89 c7             	mov    %rax,%rdi
+  801970:	48 89 d6             	mov    %rdx,%rsi
+  801973:	fd                   	std
+  801974:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801976:	eb 1d                	jmp    801995 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801978:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80197c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801980:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801984:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801988:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80198c:	48 89 d7             	mov    %rdx,%rdi
+  80198f:	48 89 c1             	mov    %rax,%rcx
+  801992:	fd                   	std
+  801993:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801995:	fc                   	cld
+  801996:	eb 57                	jmp    8019ef <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801998:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80199c:	83 e0 03             	and    $0x3,%eax
+  80199f:	48 85 c0             	test   %rax,%rax
+  8019a2:	75 36                	jne    8019da <memmove+0x110>
+  8019a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a8:	83 e0 03             	and    $0x3,%eax
+  8019ab:	48 85 c0             	test   %rax,%rax
+  8019ae:	75 2a                	jne    8019da <memmove+0x110>
+  8019b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b4:	83 e0 03             	and    $0x3,%eax
+  8019b7:	48 85 c0             	test   %rax,%rax
+  8019ba:	75 1e                	jne    8019da <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8019bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c0:	48 c1 e8 02          	shr    $0x2,%rax
+  8019c4:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8019c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019cf:	48 89 c7             	mov    %rax,%rdi
+  8019d2:	48 89 d6             	mov    %rdx,%rsi
+  8019d5:	fc                   	cld
+  8019d6:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8019d8:	eb 15                	jmp    8019ef <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8019da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019e2:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8019e6:	48 89 c7             	mov    %rax,%rdi
+  8019e9:	48 89 d6             	mov    %rdx,%rsi
+  8019ec:	fc                   	cld
+  8019ed:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8019ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019f3:	c9                   	leave
+  8019f4:	c3                   	ret
+
+00000000008019f5 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8019f5:	55                   	push   %rbp
+  8019f6:	48 89 e5             	mov    %rsp,%rbp
+  8019f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8019fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019fd <memcpy+0x8>
+  801a04:	49 bb 3b 76 00 00 00 	movabs $0x763b,%r11
+  801a0b:	00 00 00 
+  801a0e:	4c 01 d8             	add    %r11,%rax
+  801a11:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a15:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a19:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801a1d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a21:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801a25:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a29:	48 89 cf             	mov    %rcx,%rdi
+  801a2c:	48 b9 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rcx
+  801a33:	ff ff ff 
+  801a36:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801a3a:	ff d0                	call   *%rax
+}
+  801a3c:	c9                   	leave
+  801a3d:	c3                   	ret
+
+0000000000801a3e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801a3e:	55                   	push   %rbp
+  801a3f:	48 89 e5             	mov    %rsp,%rbp
+  801a42:	48 83 ec 28          	sub    $0x28,%rsp
+  801a46:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a46 <memcmp+0x8>
+  801a4d:	49 bb f2 75 00 00 00 	movabs $0x75f2,%r11
+  801a54:	00 00 00 
+  801a57:	4c 01 d8             	add    %r11,%rax
+  801a5a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a5e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a62:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801a66:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a6a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801a6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a72:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801a76:	eb 34                	jmp    801aac <memcmp+0x6e>
+		if (*s1 != *s2)
+  801a78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a7c:	0f b6 10             	movzbl (%rax),%edx
+  801a7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a83:	0f b6 00             	movzbl (%rax),%eax
+  801a86:	38 c2                	cmp    %al,%dl
+  801a88:	74 18                	je     801aa2 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801a8a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a8e:	0f b6 00             	movzbl (%rax),%eax
+  801a91:	0f b6 d0             	movzbl %al,%edx
+  801a94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a98:	0f b6 00             	movzbl (%rax),%eax
+  801a9b:	0f b6 c0             	movzbl %al,%eax
+  801a9e:	29 c2                	sub    %eax,%edx
+  801aa0:	eb 20                	jmp    801ac2 <memcmp+0x84>
+		s1++, s2++;
+  801aa2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801aa7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801aac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ab0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ab4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801ab8:	48 85 c0             	test   %rax,%rax
+  801abb:	75 bb                	jne    801a78 <memcmp+0x3a>
+	}
+
+	return 0;
+  801abd:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801ac2:	89 d0                	mov    %edx,%eax
+  801ac4:	c9                   	leave
+  801ac5:	c3                   	ret
+
+0000000000801ac6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801ac6:	55                   	push   %rbp
+  801ac7:	48 89 e5             	mov    %rsp,%rbp
+  801aca:	48 83 ec 28          	sub    $0x28,%rsp
+  801ace:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ace <memfind+0x8>
+  801ad5:	49 bb 6a 75 00 00 00 	movabs $0x756a,%r11
+  801adc:	00 00 00 
+  801adf:	4c 01 d8             	add    %r11,%rax
+  801ae2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ae6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801ae9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801aed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801af1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801af5:	48 01 d0             	add    %rdx,%rax
+  801af8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801afc:	eb 13                	jmp    801b11 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801afe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b02:	0f b6 00             	movzbl (%rax),%eax
+  801b05:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801b08:	38 d0                	cmp    %dl,%al
+  801b0a:	74 11                	je     801b1d <memfind+0x57>
+	for (; s < ends; s++)
+  801b0c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801b11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b15:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b19:	72 e3                	jb     801afe <memfind+0x38>
+  801b1b:	eb 01                	jmp    801b1e <memfind+0x58>
+			break;
+  801b1d:	90                   	nop
+	return (void *) s;
+  801b1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b22:	c9                   	leave
+  801b23:	c3                   	ret
+
+0000000000801b24 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801b24:	55                   	push   %rbp
+  801b25:	48 89 e5             	mov    %rsp,%rbp
+  801b28:	48 83 ec 38          	sub    $0x38,%rsp
+  801b2c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b2c <strtol+0x8>
+  801b33:	49 bb 0c 75 00 00 00 	movabs $0x750c,%r11
+  801b3a:	00 00 00 
+  801b3d:	4c 01 d8             	add    %r11,%rax
+  801b40:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b44:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b48:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801b4b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b52:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b59:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801b5a:	eb 05                	jmp    801b61 <strtol+0x3d>
+		s++;
+  801b5c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801b61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b65:	0f b6 00             	movzbl (%rax),%eax
+  801b68:	3c 20                	cmp    $0x20,%al
+  801b6a:	74 f0                	je     801b5c <strtol+0x38>
+  801b6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b70:	0f b6 00             	movzbl (%rax),%eax
+  801b73:	3c 09                	cmp    $0x9,%al
+  801b75:	74 e5                	je     801b5c <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801b77:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b7b:	0f b6 00             	movzbl (%rax),%eax
+  801b7e:	3c 2b                	cmp    $0x2b,%al
+  801b80:	75 07                	jne    801b89 <strtol+0x65>
+		s++;
+  801b82:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b87:	eb 17                	jmp    801ba0 <strtol+0x7c>
+	else if (*s == '-')
+  801b89:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b8d:	0f b6 00             	movzbl (%rax),%eax
+  801b90:	3c 2d                	cmp    $0x2d,%al
+  801b92:	75 0c                	jne    801ba0 <strtol+0x7c>
+		s++, neg = 1;
+  801b94:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b99:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801ba0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ba4:	74 06                	je     801bac <strtol+0x88>
+  801ba6:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801baa:	75 28                	jne    801bd4 <strtol+0xb0>
+  801bac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb0:	0f b6 00             	movzbl (%rax),%eax
+  801bb3:	3c 30                	cmp    $0x30,%al
+  801bb5:	75 1d                	jne    801bd4 <strtol+0xb0>
+  801bb7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bbb:	48 83 c0 01          	add    $0x1,%rax
+  801bbf:	0f b6 00             	movzbl (%rax),%eax
+  801bc2:	3c 78                	cmp    $0x78,%al
+  801bc4:	75 0e                	jne    801bd4 <strtol+0xb0>
+		s += 2, base = 16;
+  801bc6:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801bcb:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801bd2:	eb 2c                	jmp    801c00 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801bd4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bd8:	75 19                	jne    801bf3 <strtol+0xcf>
+  801bda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bde:	0f b6 00             	movzbl (%rax),%eax
+  801be1:	3c 30                	cmp    $0x30,%al
+  801be3:	75 0e                	jne    801bf3 <strtol+0xcf>
+		s++, base = 8;
+  801be5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bea:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801bf1:	eb 0d                	jmp    801c00 <strtol+0xdc>
+	else if (base == 0)
+  801bf3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bf7:	75 07                	jne    801c00 <strtol+0xdc>
+		base = 10;
+  801bf9:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801c00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c04:	0f b6 00             	movzbl (%rax),%eax
+  801c07:	3c 2f                	cmp    $0x2f,%al
+  801c09:	7e 1d                	jle    801c28 <strtol+0x104>
+  801c0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c0f:	0f b6 00             	movzbl (%rax),%eax
+  801c12:	3c 39                	cmp    $0x39,%al
+  801c14:	7f 12                	jg     801c28 <strtol+0x104>
+			dig = *s - '0';
+  801c16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c1a:	0f b6 00             	movzbl (%rax),%eax
+  801c1d:	0f be c0             	movsbl %al,%eax
+  801c20:	83 e8 30             	sub    $0x30,%eax
+  801c23:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c26:	eb 4e                	jmp    801c76 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801c28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2c:	0f b6 00             	movzbl (%rax),%eax
+  801c2f:	3c 60                	cmp    $0x60,%al
+  801c31:	7e 1d                	jle    801c50 <strtol+0x12c>
+  801c33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c37:	0f b6 00             	movzbl (%rax),%eax
+  801c3a:	3c 7a                	cmp    $0x7a,%al
+  801c3c:	7f 12                	jg     801c50 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801c3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c42:	0f b6 00             	movzbl (%rax),%eax
+  801c45:	0f be c0             	movsbl %al,%eax
+  801c48:	83 e8 57             	sub    $0x57,%eax
+  801c4b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c4e:	eb 26                	jmp    801c76 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c54:	0f b6 00             	movzbl (%rax),%eax
+  801c57:	3c 40                	cmp    $0x40,%al
+  801c59:	7e 47                	jle    801ca2 <strtol+0x17e>
+  801c5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5f:	0f b6 00             	movzbl (%rax),%eax
+  801c62:	3c 5a                	cmp    $0x5a,%al
+  801c64:	7f 3c                	jg     801ca2 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801c66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c6a:	0f b6 00             	movzbl (%rax),%eax
+  801c6d:	0f be c0             	movsbl %al,%eax
+  801c70:	83 e8 37             	sub    $0x37,%eax
+  801c73:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801c76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c79:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801c7c:	7d 23                	jge    801ca1 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801c7e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c83:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801c86:	48 98                	cltq
+  801c88:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801c8d:	48 89 c2             	mov    %rax,%rdx
+  801c90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c93:	48 98                	cltq
+  801c95:	48 01 d0             	add    %rdx,%rax
+  801c98:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801c9c:	e9 5f ff ff ff       	jmp    801c00 <strtol+0xdc>
+			break;
+  801ca1:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ca2:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801ca7:	74 0b                	je     801cb4 <strtol+0x190>
+		*endptr = (char *) s;
+  801ca9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cad:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cb1:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801cb4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801cb8:	74 09                	je     801cc3 <strtol+0x19f>
+  801cba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cbe:	48 f7 d8             	neg    %rax
+  801cc1:	eb 04                	jmp    801cc7 <strtol+0x1a3>
+  801cc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801cc7:	c9                   	leave
+  801cc8:	c3                   	ret
+
+0000000000801cc9 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801cc9:	55                   	push   %rbp
+  801cca:	48 89 e5             	mov    %rsp,%rbp
+  801ccd:	53                   	push   %rbx
+  801cce:	48 83 ec 30          	sub    $0x30,%rsp
+  801cd2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801cd2 <strstr+0x9>
+  801cd9:	49 bb 66 73 00 00 00 	movabs $0x7366,%r11
+  801ce0:	00 00 00 
+  801ce3:	4c 01 db             	add    %r11,%rbx
+  801ce6:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801cea:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801cee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cf6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cfa:	0f b6 00             	movzbl (%rax),%eax
+  801cfd:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801d00:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801d04:	75 06                	jne    801d0c <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801d06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d0a:	eb 73                	jmp    801d7f <strstr+0xb6>
+
+	len = strlen(str);
+  801d0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d10:	48 89 c7             	mov    %rax,%rdi
+  801d13:	48 b8 1e 84 ff ff ff 	movabs $0xffffffffffff841e,%rax
+  801d1a:	ff ff ff 
+  801d1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d21:	ff d0                	call   *%rax
+  801d23:	48 98                	cltq
+  801d25:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801d29:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d2d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d31:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d35:	0f b6 00             	movzbl (%rax),%eax
+  801d38:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801d3b:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801d3f:	75 07                	jne    801d48 <strstr+0x7f>
+				return (char *) 0;
+  801d41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d46:	eb 37                	jmp    801d7f <strstr+0xb6>
+		} while (sc != c);
+  801d48:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801d4c:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801d4f:	75 d8                	jne    801d29 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801d51:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d55:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d5d:	48 89 ce             	mov    %rcx,%rsi
+  801d60:	48 89 c7             	mov    %rax,%rdi
+  801d63:	48 b8 d2 86 ff ff ff 	movabs $0xffffffffffff86d2,%rax
+  801d6a:	ff ff ff 
+  801d6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d71:	ff d0                	call   *%rax
+  801d73:	85 c0                	test   %eax,%eax
+  801d75:	75 b2                	jne    801d29 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801d77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d7b:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801d7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801d83:	c9                   	leave
+  801d84:	c3                   	ret
+
+0000000000801d85 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801d85:	55                   	push   %rbp
+  801d86:	48 89 e5             	mov    %rsp,%rbp
+  801d89:	41 57                	push   %r15
+  801d8b:	53                   	push   %rbx
+  801d8c:	48 83 ec 40          	sub    $0x40,%rsp
+  801d90:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801d90 <syscall+0xb>
+  801d97:	49 bb a8 72 00 00 00 	movabs $0x72a8,%r11
+  801d9e:	00 00 00 
+  801da1:	4d 01 da             	add    %r11,%r10
+  801da4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801da7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801daa:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801dae:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801db2:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801db6:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801dba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dbd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801dc1:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801dc5:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801dc9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801dcd:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801dd1:	4c 89 c3             	mov    %r8,%rbx
+  801dd4:	cd 30                	int    $0x30
+  801dd6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801dda:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801dde:	74 52                	je     801e32 <syscall+0xad>
+  801de0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801de5:	7e 4b                	jle    801e32 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801de7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801deb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dee:	49 89 d0             	mov    %rdx,%r8
+  801df1:	89 c1                	mov    %eax,%ecx
+  801df3:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  801dfa:	ff ff ff 
+  801dfd:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e01:	48 89 c2             	mov    %rax,%rdx
+  801e04:	be 23 00 00 00       	mov    $0x23,%esi
+  801e09:	48 b8 1d e8 ff ff ff 	movabs $0xffffffffffffe81d,%rax
+  801e10:	ff ff ff 
+  801e13:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e17:	48 89 c7             	mov    %rax,%rdi
+  801e1a:	4d 89 d7             	mov    %r10,%r15
+  801e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e22:	49 b9 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r9
+  801e29:	ff ff ff 
+  801e2c:	4d 01 d1             	add    %r10,%r9
+  801e2f:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e36:	48 83 c4 40          	add    $0x40,%rsp
+  801e3a:	5b                   	pop    %rbx
+  801e3b:	41 5f                	pop    %r15
+  801e3d:	5d                   	pop    %rbp
+  801e3e:	c3                   	ret
+
+0000000000801e3f <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801e3f:	55                   	push   %rbp
+  801e40:	48 89 e5             	mov    %rsp,%rbp
+  801e43:	41 57                	push   %r15
+  801e45:	41 56                	push   %r14
+  801e47:	41 55                	push   %r13
+  801e49:	41 54                	push   %r12
+  801e4b:	53                   	push   %rbx
+  801e4c:	48 83 ec 48          	sub    $0x48,%rsp
+  801e50:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801e50 <syscall_words+0x11>
+  801e57:	49 bb e8 71 00 00 00 	movabs $0x71e8,%r11
+  801e5e:	00 00 00 
+  801e61:	4d 01 de             	add    %r11,%r14
+  801e64:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801e67:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801e6a:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801e6e:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801e72:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801e76:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801e7a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e7f:	74 09                	je     801e8a <syscall_words+0x4b>
+  801e81:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e85:	48 8b 00             	mov    (%rax),%rax
+  801e88:	eb 05                	jmp    801e8f <syscall_words+0x50>
+  801e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8f:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801e92:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e97:	74 0a                	je     801ea3 <syscall_words+0x64>
+  801e99:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e9d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ea1:	eb 05                	jmp    801ea8 <syscall_words+0x69>
+  801ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea8:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801eab:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801eb0:	74 0a                	je     801ebc <syscall_words+0x7d>
+  801eb2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801eb6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801eba:	eb 05                	jmp    801ec1 <syscall_words+0x82>
+  801ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec1:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801ec4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ec9:	74 0a                	je     801ed5 <syscall_words+0x96>
+  801ecb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ecf:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ed3:	eb 05                	jmp    801eda <syscall_words+0x9b>
+  801ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eda:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801edd:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ee2:	74 0a                	je     801eee <syscall_words+0xaf>
+  801ee4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ee8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801eec:	eb 05                	jmp    801ef3 <syscall_words+0xb4>
+  801eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef3:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801ef6:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801efb:	74 0a                	je     801f07 <syscall_words+0xc8>
+  801efd:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f01:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801f05:	eb 05                	jmp    801f0c <syscall_words+0xcd>
+  801f07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0c:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801f0f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f12:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801f16:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f1a:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801f1e:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801f22:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f26:	cd 30                	int    $0x30
+  801f28:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801f2c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f31:	74 50                	je     801f83 <syscall_words+0x144>
+		words[0] = r8;
+  801f33:	4c 89 c2             	mov    %r8,%rdx
+  801f36:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f3a:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801f3d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f41:	48 83 c0 08          	add    $0x8,%rax
+  801f45:	4c 89 ca             	mov    %r9,%rdx
+  801f48:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801f4b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f4f:	48 83 c0 10          	add    $0x10,%rax
+  801f53:	4c 89 d2             	mov    %r10,%rdx
+  801f56:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801f59:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f5d:	48 83 c0 18          	add    $0x18,%rax
+  801f61:	4c 89 da             	mov    %r11,%rdx
+  801f64:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801f67:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f6b:	48 83 c0 20          	add    $0x20,%rax
+  801f6f:	4c 89 e2             	mov    %r12,%rdx
+  801f72:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801f75:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f79:	48 83 c0 28          	add    $0x28,%rax
+  801f7d:	4c 89 ea             	mov    %r13,%rdx
+  801f80:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801f83:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801f87:	74 52                	je     801fdb <syscall_words+0x19c>
+  801f89:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801f8e:	7e 4b                	jle    801fdb <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f90:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f94:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f97:	49 89 d0             	mov    %rdx,%r8
+  801f9a:	89 c1                	mov    %eax,%ecx
+  801f9c:	48 b8 00 e8 ff ff ff 	movabs $0xffffffffffffe800,%rax
+  801fa3:	ff ff ff 
+  801fa6:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801faa:	48 89 c2             	mov    %rax,%rdx
+  801fad:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801fb2:	48 b8 1d e8 ff ff ff 	movabs $0xffffffffffffe81d,%rax
+  801fb9:	ff ff ff 
+  801fbc:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801fc0:	48 89 c7             	mov    %rax,%rdi
+  801fc3:	4d 89 f7             	mov    %r14,%r15
+  801fc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcb:	49 b9 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r9
+  801fd2:	ff ff ff 
+  801fd5:	4d 01 f1             	add    %r14,%r9
+  801fd8:	41 ff d1             	call   *%r9
+
+	return ret;
+  801fdb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801fdf:	48 83 c4 48          	add    $0x48,%rsp
+  801fe3:	5b                   	pop    %rbx
+  801fe4:	41 5c                	pop    %r12
+  801fe6:	41 5d                	pop    %r13
+  801fe8:	41 5e                	pop    %r14
+  801fea:	41 5f                	pop    %r15
+  801fec:	5d                   	pop    %rbp
+  801fed:	c3                   	ret
+
+0000000000801fee <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801fee:	55                   	push   %rbp
+  801fef:	48 89 e5             	mov    %rsp,%rbp
+  801ff2:	48 83 ec 10          	sub    $0x10,%rsp
+  801ff6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ff6 <sys_cputs+0x8>
+  801ffd:	49 bb 42 70 00 00 00 	movabs $0x7042,%r11
+  802004:	00 00 00 
+  802007:	4c 01 d8             	add    %r11,%rax
+  80200a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80200e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802012:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802016:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80201a:	48 83 ec 08          	sub    $0x8,%rsp
+  80201e:	6a 00                	push   $0x0
+  802020:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802026:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80202c:	be 00 00 00 00       	mov    $0x0,%esi
+  802031:	bf 00 00 00 00       	mov    $0x0,%edi
+  802036:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  80203d:	ff ff ff 
+  802040:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802044:	ff d0                	call   *%rax
+  802046:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80204a:	90                   	nop
+  80204b:	c9                   	leave
+  80204c:	c3                   	ret
+
+000000000080204d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80204d:	55                   	push   %rbp
+  80204e:	48 89 e5             	mov    %rsp,%rbp
+  802051:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802051 <sys_cgetc+0x4>
+  802058:	49 bb e7 6f 00 00 00 	movabs $0x6fe7,%r11
+  80205f:	00 00 00 
+  802062:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802065:	48 83 ec 08          	sub    $0x8,%rsp
+  802069:	6a 00                	push   $0x0
+  80206b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802071:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802077:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80207c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802081:	be 00 00 00 00       	mov    $0x0,%esi
+  802086:	bf 01 00 00 00       	mov    $0x1,%edi
+  80208b:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  802092:	ff ff ff 
+  802095:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802099:	ff d0                	call   *%rax
+  80209b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80209f:	c9                   	leave
+  8020a0:	c3                   	ret
+
+00000000008020a1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8020a1:	55                   	push   %rbp
+  8020a2:	48 89 e5             	mov    %rsp,%rbp
+  8020a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8020a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020a9 <sys_env_destroy+0x8>
+  8020b0:	49 bb 8f 6f 00 00 00 	movabs $0x6f8f,%r11
+  8020b7:	00 00 00 
+  8020ba:	4c 01 d8             	add    %r11,%rax
+  8020bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8020c0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020c3:	48 63 d2             	movslq %edx,%rdx
+  8020c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ca:	6a 00                	push   $0x0
+  8020cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020dd:	be 01 00 00 00       	mov    $0x1,%esi
+  8020e2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020e7:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  8020ee:	ff ff ff 
+  8020f1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020f5:	ff d0                	call   *%rax
+  8020f7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020fb:	c9                   	leave
+  8020fc:	c3                   	ret
+
+00000000008020fd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8020fd:	55                   	push   %rbp
+  8020fe:	48 89 e5             	mov    %rsp,%rbp
+  802101:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802101 <sys_getenvid+0x4>
+  802108:	49 bb 37 6f 00 00 00 	movabs $0x6f37,%r11
+  80210f:	00 00 00 
+  802112:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802115:	48 83 ec 08          	sub    $0x8,%rsp
+  802119:	6a 00                	push   $0x0
+  80211b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802121:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802127:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80212c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802131:	be 00 00 00 00       	mov    $0x0,%esi
+  802136:	bf 02 00 00 00       	mov    $0x2,%edi
+  80213b:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  802142:	ff ff ff 
+  802145:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802149:	ff d0                	call   *%rax
+  80214b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80214f:	c9                   	leave
+  802150:	c3                   	ret
+
+0000000000802151 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802151:	55                   	push   %rbp
+  802152:	48 89 e5             	mov    %rsp,%rbp
+  802155:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802155 <sys_yield+0x4>
+  80215c:	49 bb e3 6e 00 00 00 	movabs $0x6ee3,%r11
+  802163:	00 00 00 
+  802166:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802169:	48 83 ec 08          	sub    $0x8,%rsp
+  80216d:	6a 00                	push   $0x0
+  80216f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80217b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802180:	ba 00 00 00 00       	mov    $0x0,%edx
+  802185:	be 00 00 00 00       	mov    $0x0,%esi
+  80218a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80218f:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  802196:	ff ff ff 
+  802199:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80219d:	ff d0                	call   *%rax
+  80219f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021a3:	90                   	nop
+  8021a4:	c9                   	leave
+  8021a5:	c3                   	ret
+
+00000000008021a6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8021a6:	55                   	push   %rbp
+  8021a7:	48 89 e5             	mov    %rsp,%rbp
+  8021aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021ae <sys_page_alloc+0x8>
+  8021b5:	49 bb 8a 6e 00 00 00 	movabs $0x6e8a,%r11
+  8021bc:	00 00 00 
+  8021bf:	4c 01 d8             	add    %r11,%rax
+  8021c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021c9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8021cc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021cf:	48 63 f2             	movslq %edx,%rsi
+  8021d2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021d6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021d9:	48 63 d2             	movslq %edx,%rdx
+  8021dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e0:	6a 00                	push   $0x0
+  8021e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021e8:	49 89 f0             	mov    %rsi,%r8
+  8021eb:	be 01 00 00 00       	mov    $0x1,%esi
+  8021f0:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021f5:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  8021fc:	ff ff ff 
+  8021ff:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802203:	ff d0                	call   *%rax
+  802205:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802209:	c9                   	leave
+  80220a:	c3                   	ret
+
+000000000080220b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80220b:	55                   	push   %rbp
+  80220c:	48 89 e5             	mov    %rsp,%rbp
+  80220f:	48 83 ec 20          	sub    $0x20,%rsp
+  802213:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802213 <sys_page_map+0x8>
+  80221a:	49 bb 25 6e 00 00 00 	movabs $0x6e25,%r11
+  802221:	00 00 00 
+  802224:	4c 01 d8             	add    %r11,%rax
+  802227:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80222a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80222e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802231:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802235:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802239:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80223c:	48 63 f2             	movslq %edx,%rsi
+  80223f:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802243:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802246:	48 63 fa             	movslq %edx,%rdi
+  802249:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80224d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802250:	48 63 d2             	movslq %edx,%rdx
+  802253:	48 83 ec 08          	sub    $0x8,%rsp
+  802257:	56                   	push   %rsi
+  802258:	4d 89 c1             	mov    %r8,%r9
+  80225b:	49 89 f8             	mov    %rdi,%r8
+  80225e:	be 01 00 00 00       	mov    $0x1,%esi
+  802263:	bf 05 00 00 00       	mov    $0x5,%edi
+  802268:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  80226f:	ff ff ff 
+  802272:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802276:	ff d0                	call   *%rax
+  802278:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80227c:	c9                   	leave
+  80227d:	c3                   	ret
+
+000000000080227e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80227e:	55                   	push   %rbp
+  80227f:	48 89 e5             	mov    %rsp,%rbp
+  802282:	48 83 ec 10          	sub    $0x10,%rsp
+  802286:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802286 <sys_page_unmap+0x8>
+  80228d:	49 bb b2 6d 00 00 00 	movabs $0x6db2,%r11
+  802294:	00 00 00 
+  802297:	4c 01 d8             	add    %r11,%rax
+  80229a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80229d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8022a1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022a5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022a8:	48 63 d2             	movslq %edx,%rdx
+  8022ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8022af:	6a 00                	push   $0x0
+  8022b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8022c2:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022c7:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  8022ce:	ff ff ff 
+  8022d1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022d5:	ff d0                	call   *%rax
+  8022d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022db:	c9                   	leave
+  8022dc:	c3                   	ret
+
+00000000008022dd <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8022dd:	55                   	push   %rbp
+  8022de:	48 89 e5             	mov    %rsp,%rbp
+  8022e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8022e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022e5 <sys_env_set_status+0x8>
+  8022ec:	49 bb 53 6d 00 00 00 	movabs $0x6d53,%r11
+  8022f3:	00 00 00 
+  8022f6:	4c 01 d8             	add    %r11,%rax
+  8022f9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022fc:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8022ff:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802302:	48 63 ca             	movslq %edx,%rcx
+  802305:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802308:	48 63 d2             	movslq %edx,%rdx
+  80230b:	48 83 ec 08          	sub    $0x8,%rsp
+  80230f:	6a 00                	push   $0x0
+  802311:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802317:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80231d:	be 01 00 00 00       	mov    $0x1,%esi
+  802322:	bf 08 00 00 00       	mov    $0x8,%edi
+  802327:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  80232e:	ff ff ff 
+  802331:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802335:	ff d0                	call   *%rax
+  802337:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80233b:	c9                   	leave
+  80233c:	c3                   	ret
+
+000000000080233d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80233d:	55                   	push   %rbp
+  80233e:	48 89 e5             	mov    %rsp,%rbp
+  802341:	48 83 ec 10          	sub    $0x10,%rsp
+  802345:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802345 <sys_env_set_trapframe+0x8>
+  80234c:	49 bb f3 6c 00 00 00 	movabs $0x6cf3,%r11
+  802353:	00 00 00 
+  802356:	4c 01 d8             	add    %r11,%rax
+  802359:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80235c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802360:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802364:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802367:	48 63 d2             	movslq %edx,%rdx
+  80236a:	48 83 ec 08          	sub    $0x8,%rsp
+  80236e:	6a 00                	push   $0x0
+  802370:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802376:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80237c:	be 01 00 00 00       	mov    $0x1,%esi
+  802381:	bf 09 00 00 00       	mov    $0x9,%edi
+  802386:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  80238d:	ff ff ff 
+  802390:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802394:	ff d0                	call   *%rax
+  802396:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80239a:	c9                   	leave
+  80239b:	c3                   	ret
+
+000000000080239c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80239c:	55                   	push   %rbp
+  80239d:	48 89 e5             	mov    %rsp,%rbp
+  8023a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8023a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023a4 <sys_env_set_pgfault_upcall+0x8>
+  8023ab:	49 bb 94 6c 00 00 00 	movabs $0x6c94,%r11
+  8023b2:	00 00 00 
+  8023b5:	4c 01 d8             	add    %r11,%rax
+  8023b8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8023bf:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023c6:	48 63 d2             	movslq %edx,%rdx
+  8023c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8023cd:	6a 00                	push   $0x0
+  8023cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023db:	be 01 00 00 00       	mov    $0x1,%esi
+  8023e0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8023e5:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  8023ec:	ff ff ff 
+  8023ef:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023f3:	ff d0                	call   *%rax
+  8023f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023f9:	c9                   	leave
+  8023fa:	c3                   	ret
+
+00000000008023fb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8023fb:	55                   	push   %rbp
+  8023fc:	48 89 e5             	mov    %rsp,%rbp
+  8023ff:	48 83 ec 20          	sub    $0x20,%rsp
+  802403:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802403 <sys_ipc_try_send+0x8>
+  80240a:	49 bb 35 6c 00 00 00 	movabs $0x6c35,%r11
+  802411:	00 00 00 
+  802414:	4c 01 d8             	add    %r11,%rax
+  802417:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80241a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80241e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802422:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802425:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802428:	48 63 fa             	movslq %edx,%rdi
+  80242b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80242f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802432:	48 63 d2             	movslq %edx,%rdx
+  802435:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802439:	48 83 ec 08          	sub    $0x8,%rsp
+  80243d:	6a 00                	push   $0x0
+  80243f:	49 89 f9             	mov    %rdi,%r9
+  802442:	49 89 f0             	mov    %rsi,%r8
+  802445:	be 00 00 00 00       	mov    $0x0,%esi
+  80244a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80244f:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  802456:	ff ff ff 
+  802459:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80245d:	ff d0                	call   *%rax
+  80245f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802463:	c9                   	leave
+  802464:	c3                   	ret
+
+0000000000802465 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802465:	55                   	push   %rbp
+  802466:	48 89 e5             	mov    %rsp,%rbp
+  802469:	48 83 ec 20          	sub    $0x20,%rsp
+  80246d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80246d <sys_ipc_send+0x8>
+  802474:	49 bb cb 6b 00 00 00 	movabs $0x6bcb,%r11
+  80247b:	00 00 00 
+  80247e:	4c 01 d8             	add    %r11,%rax
+  802481:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802484:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802488:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80248c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80248f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802492:	48 63 fa             	movslq %edx,%rdi
+  802495:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802499:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80249c:	48 63 d2             	movslq %edx,%rdx
+  80249f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8024a7:	6a 00                	push   $0x0
+  8024a9:	49 89 f9             	mov    %rdi,%r9
+  8024ac:	49 89 f0             	mov    %rsi,%r8
+  8024af:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b4:	bf 17 00 00 00       	mov    $0x17,%edi
+  8024b9:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  8024c0:	ff ff ff 
+  8024c3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024c7:	ff d0                	call   *%rax
+  8024c9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024cd:	c9                   	leave
+  8024ce:	c3                   	ret
+
+00000000008024cf <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8024cf:	55                   	push   %rbp
+  8024d0:	48 89 e5             	mov    %rsp,%rbp
+  8024d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024d7 <sys_ipc_recv+0x8>
+  8024de:	49 bb 61 6b 00 00 00 	movabs $0x6b61,%r11
+  8024e5:	00 00 00 
+  8024e8:	4c 01 d8             	add    %r11,%rax
+  8024eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8024ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024f3:	6a 00                	push   $0x0
+  8024f5:	6a 00                	push   $0x0
+  8024f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802503:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802508:	be 01 00 00 00       	mov    $0x1,%esi
+  80250d:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802512:	49 ba 07 8e ff ff ff 	movabs $0xffffffffffff8e07,%r10
+  802519:	ff ff ff 
+  80251c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802520:	ff d0                	call   *%rax
+  802522:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802526:	c9                   	leave
+  802527:	c3                   	ret
+
+0000000000802528 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802528:	55                   	push   %rbp
+  802529:	48 89 e5             	mov    %rsp,%rbp
+  80252c:	48 83 ec 30          	sub    $0x30,%rsp
+  802530:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802530 <sys_ipc_call+0x8>
+  802537:	49 bb 08 6b 00 00 00 	movabs $0x6b08,%r11
+  80253e:	00 00 00 
+  802541:	4c 01 d8             	add    %r11,%rax
+  802544:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802547:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80254b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80254f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802552:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802556:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80255a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80255e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802561:	4c 63 c2             	movslq %edx,%r8
+  802564:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802568:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80256b:	48 63 d2             	movslq %edx,%rdx
+  80256e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802572:	ff 75 d8             	push   -0x28(%rbp)
+  802575:	56                   	push   %rsi
+  802576:	4d 89 c1             	mov    %r8,%r9
+  802579:	49 89 f8             	mov    %rdi,%r8
+  80257c:	be 00 00 00 00       	mov    $0x0,%esi
+  802581:	bf 18 00 00 00       	mov    $0x18,%edi
+  802586:	49 ba 07 8e ff ff ff 	movabs $0xffffffffffff8e07,%r10
+  80258d:	ff ff ff 
+  802590:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802594:	ff d0                	call   *%rax
+  802596:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80259a:	c9                   	leave
+  80259b:	c3                   	ret
+
+000000000080259c <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80259c:	55                   	push   %rbp
+  80259d:	48 89 e5             	mov    %rsp,%rbp
+  8025a0:	48 83 ec 30          	sub    $0x30,%rsp
+  8025a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025a4 <sys_ipc_reply_recv+0x8>
+  8025ab:	49 bb 94 6a 00 00 00 	movabs $0x6a94,%r11
+  8025b2:	00 00 00 
+  8025b5:	4c 01 d8             	add    %r11,%rax
+  8025b8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025bf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025c3:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8025c6:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8025ca:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8025ce:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8025d2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025d5:	4c 63 c2             	movslq %edx,%r8
+  8025d8:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8025dc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025df:	48 63 d2             	movslq %edx,%rdx
+  8025e2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025e6:	ff 75 d8             	push   -0x28(%rbp)
+  8025e9:	56                   	push   %rsi
+  8025ea:	4d 89 c1             	mov    %r8,%r9
+  8025ed:	49 89 f8             	mov    %rdi,%r8
+  8025f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f5:	bf 19 00 00 00       	mov    $0x19,%edi
+  8025fa:	49 ba 07 8e ff ff ff 	movabs $0xffffffffffff8e07,%r10
+  802601:	ff ff ff 
+  802604:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802608:	ff d0                	call   *%rax
+  80260a:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80260e:	c9                   	leave
+  80260f:	c3                   	ret
+
+0000000000802610 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802610:	55                   	push   %rbp
+  802611:	48 89 e5             	mov    %rsp,%rbp
+  802614:	48 83 ec 10          	sub    $0x10,%rsp
+  802618:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802618 <sys_env_set_priority+0x8>
+  80261f:	49 bb 20 6a 00 00 00 	movabs $0x6a20,%r11
+  802626:	00 00 00 
+  802629:	4c 01 d8             	add    %r11,%rax
+  80262c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80262f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802632:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802635:	48 63 ca             	movslq %edx,%rcx
+  802638:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80263b:	48 63 d2             	movslq %edx,%rdx
+  80263e:	48 83 ec 08          	sub    $0x8,%rsp
+  802642:	6a 00                	push   $0x0
+  802644:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80264a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802650:	be 01 00 00 00       	mov    $0x1,%esi
+  802655:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80265a:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  802661:	ff ff ff 
+  802664:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802668:	ff d0                	call   *%rax
+  80266a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80266e:	c9                   	leave
+  80266f:	c3                   	ret
+
+0000000000802670 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802670:	55                   	push   %rbp
+  802671:	48 89 e5             	mov    %rsp,%rbp
+  802674:	48 83 ec 10          	sub    $0x10,%rsp
+  802678:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802678 <sys_env_set_affinity+0x8>
+  80267f:	49 bb c0 69 00 00 00 	movabs $0x69c0,%r11
+  802686:	00 00 00 
+  802689:	4c 01 d8             	add    %r11,%rax
+  80268c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80268f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802692:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802695:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802698:	48 63 d2             	movslq %edx,%rdx
+  80269b:	48 83 ec 08          	sub    $0x8,%rsp
+  80269f:	6a 00                	push   $0x0
+  8026a1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8026b2:	bf 10 00 00 00       	mov    $0x10,%edi
+  8026b7:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  8026be:	ff ff ff 
+  8026c1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026c5:	ff d0                	call   *%rax
+  8026c7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026cb:	c9                   	leave
+  8026cc:	c3                   	ret
+
+00000000008026cd <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8026cd:	55                   	push   %rbp
+  8026ce:	48 89 e5             	mov    %rsp,%rbp
+  8026d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026d1 <sys_time_msec+0x4>
+  8026d8:	49 bb 67 69 00 00 00 	movabs $0x6967,%r11
+  8026df:	00 00 00 
+  8026e2:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8026e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e9:	6a 00                	push   $0x0
+  8026eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802701:	be 00 00 00 00       	mov    $0x0,%esi
+  802706:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80270b:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  802712:	ff ff ff 
+  802715:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802719:	ff d0                	call   *%rax
+  80271b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80271f:	c9                   	leave
+  802720:	c3                   	ret
+
+0000000000802721 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802721:	55                   	push   %rbp
+  802722:	48 89 e5             	mov    %rsp,%rbp
+  802725:	48 83 ec 10          	sub    $0x10,%rsp
+  802729:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802729 <sys_sleep_usec+0x8>
+  802730:	49 bb 0f 69 00 00 00 	movabs $0x690f,%r11
+  802737:	00 00 00 
+  80273a:	4c 01 d8             	add    %r11,%rax
+  80273d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802741:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802745:	48 83 ec 08          	sub    $0x8,%rsp
+  802749:	6a 00                	push   $0x0
+  80274b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802751:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802757:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80275c:	be 00 00 00 00       	mov    $0x0,%esi
+  802761:	bf 11 00 00 00       	mov    $0x11,%edi
+  802766:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  80276d:	ff ff ff 
+  802770:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802774:	ff d0                	call   *%rax
+  802776:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80277a:	c9                   	leave
+  80277b:	c3                   	ret
+
+000000000080277c <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80277c:	55                   	push   %rbp
+  80277d:	48 89 e5             	mov    %rsp,%rbp
+  802780:	48 83 ec 10          	sub    $0x10,%rsp
+  802784:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802784 <sys_page_alloc_huge+0x8>
+  80278b:	49 bb b4 68 00 00 00 	movabs $0x68b4,%r11
+  802792:	00 00 00 
+  802795:	4c 01 d8             	add    %r11,%rax
+  802798:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80279b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80279f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8027a2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027a5:	48 63 f2             	movslq %edx,%rsi
+  8027a8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027ac:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027af:	48 63 d2             	movslq %edx,%rdx
+  8027b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b6:	6a 00                	push   $0x0
+  8027b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027be:	49 89 f0             	mov    %rsi,%r8
+  8027c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8027c6:	bf 12 00 00 00       	mov    $0x12,%edi
+  8027cb:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  8027d2:	ff ff ff 
+  8027d5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027d9:	ff d0                	call   *%rax
+  8027db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027df:	c9                   	leave
+  8027e0:	c3                   	ret
+
+00000000008027e1 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8027e1:	55                   	push   %rbp
+  8027e2:	48 89 e5             	mov    %rsp,%rbp
+  8027e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8027e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027e9 <sys_page_map_batch+0x8>
+  8027f0:	49 bb 4f 68 00 00 00 	movabs $0x684f,%r11
+  8027f7:	00 00 00 
+  8027fa:	4c 01 d8             	add    %r11,%rax
+  8027fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802801:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802805:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802809:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80280d:	48 83 ec 08          	sub    $0x8,%rsp
+  802811:	6a 00                	push   $0x0
+  802813:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802819:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80281f:	be 01 00 00 00       	mov    $0x1,%esi
+  802824:	bf 13 00 00 00       	mov    $0x13,%edi
+  802829:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  802830:	ff ff ff 
+  802833:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802837:	ff d0                	call   *%rax
+  802839:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80283d:	c9                   	leave
+  80283e:	c3                   	ret
+
+000000000080283f <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80283f:	55                   	push   %rbp
+  802840:	48 89 e5             	mov    %rsp,%rbp
+  802843:	48 83 ec 10          	sub    $0x10,%rsp
+  802847:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802847 <sys_page_alloc_batch+0x8>
+  80284e:	49 bb f1 67 00 00 00 	movabs $0x67f1,%r11
+  802855:	00 00 00 
+  802858:	4c 01 d8             	add    %r11,%rax
+  80285b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80285f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802863:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802867:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80286b:	48 83 ec 08          	sub    $0x8,%rsp
+  80286f:	6a 00                	push   $0x0
+  802871:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802877:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80287d:	be 01 00 00 00       	mov    $0x1,%esi
+  802882:	bf 14 00 00 00       	mov    $0x14,%edi
+  802887:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  80288e:	ff ff ff 
+  802891:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802895:	ff d0                	call   *%rax
+  802897:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80289b:	c9                   	leave
+  80289c:	c3                   	ret
+
+000000000080289d <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80289d:	55                   	push   %rbp
+  80289e:	48 89 e5             	mov    %rsp,%rbp
+  8028a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8028a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028a5 <sys_page_unmap_batch+0x8>
+  8028ac:	49 bb 93 67 00 00 00 	movabs $0x6793,%r11
+  8028b3:	00 00 00 
+  8028b6:	4c 01 d8             	add    %r11,%rax
+  8028b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8028c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028c5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8028cd:	6a 00                	push   $0x0
+  8028cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028db:	be 01 00 00 00       	mov    $0x1,%esi
+  8028e0:	bf 15 00 00 00       	mov    $0x15,%edi
+  8028e5:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  8028ec:	ff ff ff 
+  8028ef:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028f3:	ff d0                	call   *%rax
+  8028f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028f9:	c9                   	leave
+  8028fa:	c3                   	ret
+
+00000000008028fb <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8028fb:	55                   	push   %rbp
+  8028fc:	48 89 e5             	mov    %rsp,%rbp
+  8028ff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028ff <sys_fork+0x4>
+  802906:	49 bb 39 67 00 00 00 	movabs $0x6739,%r11
+  80290d:	00 00 00 
+  802910:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802913:	48 83 ec 08          	sub    $0x8,%rsp
+  802917:	6a 00                	push   $0x0
+  802919:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802925:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80292a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80292f:	be 00 00 00 00       	mov    $0x0,%esi
+  802934:	bf 16 00 00 00       	mov    $0x16,%edi
+  802939:	49 ba 4d 8d ff ff ff 	movabs $0xffffffffffff8d4d,%r10
+  802940:	ff ff ff 
+  802943:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802947:	ff d0                	call   *%rax
+  802949:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80294d:	c9                   	leave
+  80294e:	c3                   	ret
+
+000000000080294f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80294f:	55                   	push   %rbp
+  802950:	48 89 e5             	mov    %rsp,%rbp
+  802953:	48 83 ec 08          	sub    $0x8,%rsp
+  802957:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802957 <fd2num+0x8>
+  80295e:	49 bb e1 66 00 00 00 	movabs $0x66e1,%r11
+  802965:	00 00 00 
+  802968:	4c 01 d8             	add    %r11,%rax
+  80296b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80296f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802973:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80297a:	ff ff ff 
+  80297d:	48 01 d0             	add    %rdx,%rax
+  802980:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802984:	c9                   	leave
+  802985:	c3                   	ret
+
+0000000000802986 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802986:	55                   	push   %rbp
+  802987:	48 89 e5             	mov    %rsp,%rbp
+  80298a:	48 83 ec 08          	sub    $0x8,%rsp
+  80298e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80298e <fd2data+0x8>
+  802995:	49 bb aa 66 00 00 00 	movabs $0x66aa,%r11
+  80299c:	00 00 00 
+  80299f:	4c 01 d8             	add    %r11,%rax
+  8029a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8029a6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029aa:	48 89 d7             	mov    %rdx,%rdi
+  8029ad:	48 ba 17 99 ff ff ff 	movabs $0xffffffffffff9917,%rdx
+  8029b4:	ff ff ff 
+  8029b7:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8029bb:	ff d0                	call   *%rax
+  8029bd:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8029c3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8029c7:	c9                   	leave
+  8029c8:	c3                   	ret
+
+00000000008029c9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8029c9:	55                   	push   %rbp
+  8029ca:	48 89 e5             	mov    %rsp,%rbp
+  8029cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8029d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029d1 <fd_alloc+0x8>
+  8029d8:	49 bb 67 66 00 00 00 	movabs $0x6667,%r11
+  8029df:	00 00 00 
+  8029e2:	4c 01 d8             	add    %r11,%rax
+  8029e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8029e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029f0:	eb 75                	jmp    802a67 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8029f2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029f5:	48 63 d2             	movslq %edx,%rdx
+  8029f8:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8029ff:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802a03:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a07:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a0b:	48 89 d1             	mov    %rdx,%rcx
+  802a0e:	48 c1 e9 15          	shr    $0x15,%rcx
+  802a12:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802a19:	ff ff ff 
+  802a1c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a20:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a24:	83 e2 01             	and    $0x1,%edx
+  802a27:	48 85 d2             	test   %rdx,%rdx
+  802a2a:	74 25                	je     802a51 <fd_alloc+0x88>
+  802a2c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a30:	48 89 d1             	mov    %rdx,%rcx
+  802a33:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802a37:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  802a3e:	ff ff ff 
+  802a41:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a45:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a49:	83 e2 01             	and    $0x1,%edx
+  802a4c:	48 85 d2             	test   %rdx,%rdx
+  802a4f:	75 12                	jne    802a63 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802a51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a55:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a59:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a61:	eb 1a                	jmp    802a7d <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802a63:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a67:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802a6b:	7e 85                	jle    8029f2 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802a6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a71:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802a78:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802a7d:	c9                   	leave
+  802a7e:	c3                   	ret
+
+0000000000802a7f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802a7f:	55                   	push   %rbp
+  802a80:	48 89 e5             	mov    %rsp,%rbp
+  802a83:	48 83 ec 20          	sub    $0x20,%rsp
+  802a87:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a87 <fd_lookup+0x8>
+  802a8e:	49 bb b1 65 00 00 00 	movabs $0x65b1,%r11
+  802a95:	00 00 00 
+  802a98:	4c 01 d8             	add    %r11,%rax
+  802a9b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802a9e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802aa2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802aa6:	78 06                	js     802aae <fd_lookup+0x2f>
+  802aa8:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802aac:	7e 07                	jle    802ab5 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802aae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ab3:	eb 73                	jmp    802b28 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802ab5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ab8:	48 63 d2             	movslq %edx,%rdx
+  802abb:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802ac2:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802ac6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802aca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ace:	48 89 d1             	mov    %rdx,%rcx
+  802ad1:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ad5:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802adc:	ff ff ff 
+  802adf:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802ae3:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802ae7:	83 e2 01             	and    $0x1,%edx
+  802aea:	48 85 d2             	test   %rdx,%rdx
+  802aed:	74 22                	je     802b11 <fd_lookup+0x92>
+  802aef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802af3:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802af7:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  802afe:	ff ff ff 
+  802b01:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802b05:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b09:	83 e0 01             	and    $0x1,%eax
+  802b0c:	48 85 c0             	test   %rax,%rax
+  802b0f:	75 07                	jne    802b18 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802b11:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b16:	eb 10                	jmp    802b28 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802b18:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b1c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b20:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802b23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+
+0000000000802b2a <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802b2a:	55                   	push   %rbp
+  802b2b:	48 89 e5             	mov    %rsp,%rbp
+  802b2e:	41 57                	push   %r15
+  802b30:	53                   	push   %rbx
+  802b31:	48 83 ec 30          	sub    $0x30,%rsp
+  802b35:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b35 <fd_close+0xb>
+  802b3c:	49 bb 03 65 00 00 00 	movabs $0x6503,%r11
+  802b43:	00 00 00 
+  802b46:	4c 01 db             	add    %r11,%rbx
+  802b49:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802b4d:	89 f0                	mov    %esi,%eax
+  802b4f:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802b52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b56:	48 89 c7             	mov    %rax,%rdi
+  802b59:	48 b8 17 99 ff ff ff 	movabs $0xffffffffffff9917,%rax
+  802b60:	ff ff ff 
+  802b63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b67:	ff d0                	call   *%rax
+  802b69:	89 c2                	mov    %eax,%edx
+  802b6b:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802b6f:	48 89 c6             	mov    %rax,%rsi
+  802b72:	89 d7                	mov    %edx,%edi
+  802b74:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  802b7b:	ff ff ff 
+  802b7e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b82:	ff d0                	call   *%rax
+  802b84:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b87:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b8b:	78 0a                	js     802b97 <fd_close+0x6d>
+	    || fd != fd2)
+  802b8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b91:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802b95:	74 12                	je     802ba9 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802b97:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802b9b:	74 05                	je     802ba2 <fd_close+0x78>
+  802b9d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ba0:	eb 7a                	jmp    802c1c <fd_close+0xf2>
+  802ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba7:	eb 73                	jmp    802c1c <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802ba9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bad:	8b 00                	mov    (%rax),%eax
+  802baf:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802bb3:	48 89 d6             	mov    %rdx,%rsi
+  802bb6:	89 c7                	mov    %eax,%edi
+  802bb8:	48 b8 ed 9b ff ff ff 	movabs $0xffffffffffff9bed,%rax
+  802bbf:	ff ff ff 
+  802bc2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bc6:	ff d0                	call   *%rax
+  802bc8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bcb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802bcf:	78 2a                	js     802bfb <fd_close+0xd1>
+		if (dev->dev_close)
+  802bd1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bd5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802bd9:	48 85 c0             	test   %rax,%rax
+  802bdc:	74 16                	je     802bf4 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802bde:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802be2:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802be6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bea:	48 89 c7             	mov    %rax,%rdi
+  802bed:	ff d2                	call   *%rdx
+  802bef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bf2:	eb 07                	jmp    802bfb <fd_close+0xd1>
+		else
+			r = 0;
+  802bf4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802bfb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bff:	48 89 c6             	mov    %rax,%rsi
+  802c02:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c07:	49 89 df             	mov    %rbx,%r15
+  802c0a:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  802c11:	ff ff ff 
+  802c14:	48 01 d8             	add    %rbx,%rax
+  802c17:	ff d0                	call   *%rax
+	return r;
+  802c19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802c1c:	48 83 c4 30          	add    $0x30,%rsp
+  802c20:	5b                   	pop    %rbx
+  802c21:	41 5f                	pop    %r15
+  802c23:	5d                   	pop    %rbp
+  802c24:	c3                   	ret
+
+0000000000802c25 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802c25:	55                   	push   %rbp
+  802c26:	48 89 e5             	mov    %rsp,%rbp
+  802c29:	41 57                	push   %r15
+  802c2b:	48 83 ec 28          	sub    $0x28,%rsp
+  802c2f:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802c2f <dev_lookup+0xa>
+  802c36:	49 bb 09 64 00 00 00 	movabs $0x6409,%r11
+  802c3d:	00 00 00 
+  802c40:	4c 01 d9             	add    %r11,%rcx
+  802c43:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c46:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802c4a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802c51:	eb 45                	jmp    802c98 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802c53:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802c5a:	00 00 00 
+  802c5d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c60:	48 98                	cltq
+  802c62:	48 01 ca             	add    %rcx,%rdx
+  802c65:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c69:	8b 00                	mov    (%rax),%eax
+  802c6b:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802c6e:	75 24                	jne    802c94 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802c70:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802c77:	00 00 00 
+  802c7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c7d:	48 98                	cltq
+  802c7f:	48 01 ca             	add    %rcx,%rdx
+  802c82:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802c86:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c8a:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c92:	eb 74                	jmp    802d08 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802c94:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802c98:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802c9f:	00 00 00 
+  802ca2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ca5:	48 98                	cltq
+  802ca7:	48 01 ca             	add    %rcx,%rdx
+  802caa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cae:	48 85 c0             	test   %rax,%rax
+  802cb1:	75 a0                	jne    802c53 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802cb3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802cba:	ff ff ff 
+  802cbd:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802cc1:	48 8b 00             	mov    (%rax),%rax
+  802cc4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802cca:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ccd:	89 c6                	mov    %eax,%esi
+  802ccf:	48 b8 30 e8 ff ff ff 	movabs $0xffffffffffffe830,%rax
+  802cd6:	ff ff ff 
+  802cd9:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802cdd:	48 89 c7             	mov    %rax,%rdi
+  802ce0:	49 89 cf             	mov    %rcx,%r15
+  802ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce8:	49 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%r8
+  802cef:	ff ff ff 
+  802cf2:	49 01 c8             	add    %rcx,%r8
+  802cf5:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802cf8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cfc:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802d03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d08:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802d0c:	c9                   	leave
+  802d0d:	c3                   	ret
+
+0000000000802d0e <close>:
+
+int
+close(int fdnum)
+{
+  802d0e:	55                   	push   %rbp
+  802d0f:	48 89 e5             	mov    %rsp,%rbp
+  802d12:	53                   	push   %rbx
+  802d13:	48 83 ec 28          	sub    $0x28,%rsp
+  802d17:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d17 <close+0x9>
+  802d1e:	49 bb 21 63 00 00 00 	movabs $0x6321,%r11
+  802d25:	00 00 00 
+  802d28:	4c 01 db             	add    %r11,%rbx
+  802d2b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d2e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802d32:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d35:	48 89 d6             	mov    %rdx,%rsi
+  802d38:	89 c7                	mov    %eax,%edi
+  802d3a:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  802d41:	ff ff ff 
+  802d44:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d48:	ff d0                	call   *%rax
+  802d4a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d4d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d51:	79 05                	jns    802d58 <close+0x4a>
+		return r;
+  802d53:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d56:	eb 1c                	jmp    802d74 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802d58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d5c:	be 01 00 00 00       	mov    $0x1,%esi
+  802d61:	48 89 c7             	mov    %rax,%rdi
+  802d64:	48 b8 f2 9a ff ff ff 	movabs $0xffffffffffff9af2,%rax
+  802d6b:	ff ff ff 
+  802d6e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d72:	ff d0                	call   *%rax
+}
+  802d74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d78:	c9                   	leave
+  802d79:	c3                   	ret
+
+0000000000802d7a <close_all>:
+
+void
+close_all(void)
+{
+  802d7a:	55                   	push   %rbp
+  802d7b:	48 89 e5             	mov    %rsp,%rbp
+  802d7e:	53                   	push   %rbx
+  802d7f:	48 83 ec 18          	sub    $0x18,%rsp
+  802d83:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d83 <close_all+0x9>
+  802d8a:	49 bb b5 62 00 00 00 	movabs $0x62b5,%r11
+  802d91:	00 00 00 
+  802d94:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802d97:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802d9e:	eb 19                	jmp    802db9 <close_all+0x3f>
+		close(i);
+  802da0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802da3:	89 c7                	mov    %eax,%edi
+  802da5:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  802dac:	ff ff ff 
+  802daf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802db3:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802db5:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802db9:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802dbd:	7e e1                	jle    802da0 <close_all+0x26>
+}
+  802dbf:	90                   	nop
+  802dc0:	90                   	nop
+  802dc1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc5:	c9                   	leave
+  802dc6:	c3                   	ret
+
+0000000000802dc7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802dc7:	55                   	push   %rbp
+  802dc8:	48 89 e5             	mov    %rsp,%rbp
+  802dcb:	41 57                	push   %r15
+  802dcd:	53                   	push   %rbx
+  802dce:	48 83 ec 40          	sub    $0x40,%rsp
+  802dd2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dd2 <dup+0xb>
+  802dd9:	49 bb 66 62 00 00 00 	movabs $0x6266,%r11
+  802de0:	00 00 00 
+  802de3:	4c 01 db             	add    %r11,%rbx
+  802de6:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802de9:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802dec:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802df0:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802df3:	48 89 d6             	mov    %rdx,%rsi
+  802df6:	89 c7                	mov    %eax,%edi
+  802df8:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  802dff:	ff ff ff 
+  802e02:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e06:	ff d0                	call   *%rax
+  802e08:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e0b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e0f:	79 08                	jns    802e19 <dup+0x52>
+		return r;
+  802e11:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e14:	e9 a4 01 00 00       	jmp    802fbd <dup+0x1f6>
+	close(newfdnum);
+  802e19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e1c:	89 c7                	mov    %eax,%edi
+  802e1e:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  802e25:	ff ff ff 
+  802e28:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e2c:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802e2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e31:	48 98                	cltq
+  802e33:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802e39:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e3d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802e41:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e45:	48 89 c7             	mov    %rax,%rdi
+  802e48:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  802e4f:	ff ff ff 
+  802e52:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e56:	ff d0                	call   *%rax
+  802e58:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802e5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e60:	48 89 c7             	mov    %rax,%rdi
+  802e63:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  802e6a:	ff ff ff 
+  802e6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e71:	ff d0                	call   *%rax
+  802e73:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802e77:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e7b:	48 c1 e8 15          	shr    $0x15,%rax
+  802e7f:	48 89 c2             	mov    %rax,%rdx
+  802e82:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e89:	ff ff ff 
+  802e8c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e90:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e94:	83 e0 01             	and    $0x1,%eax
+  802e97:	48 85 c0             	test   %rax,%rax
+  802e9a:	74 7f                	je     802f1b <dup+0x154>
+  802e9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ea0:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ea4:	48 89 c2             	mov    %rax,%rdx
+  802ea7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802eae:	ff ff ff 
+  802eb1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802eb5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eb9:	83 e0 01             	and    $0x1,%eax
+  802ebc:	48 85 c0             	test   %rax,%rax
+  802ebf:	74 5a                	je     802f1b <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802ec1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ec5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ec9:	48 89 c2             	mov    %rax,%rdx
+  802ecc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ed3:	ff ff ff 
+  802ed6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802eda:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ede:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ee3:	89 c1                	mov    %eax,%ecx
+  802ee5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ee9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802eed:	41 89 c8             	mov    %ecx,%r8d
+  802ef0:	48 89 d1             	mov    %rdx,%rcx
+  802ef3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ef8:	48 89 c6             	mov    %rax,%rsi
+  802efb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f00:	49 89 df             	mov    %rbx,%r15
+  802f03:	48 b8 d3 91 ff ff ff 	movabs $0xffffffffffff91d3,%rax
+  802f0a:	ff ff ff 
+  802f0d:	48 01 d8             	add    %rbx,%rax
+  802f10:	ff d0                	call   *%rax
+  802f12:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f15:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f19:	78 5f                	js     802f7a <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802f1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f1f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f23:	48 89 c2             	mov    %rax,%rdx
+  802f26:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802f2d:	ff ff ff 
+  802f30:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f34:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f38:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f3d:	89 c1                	mov    %eax,%ecx
+  802f3f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f43:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f47:	41 89 c8             	mov    %ecx,%r8d
+  802f4a:	48 89 d1             	mov    %rdx,%rcx
+  802f4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f52:	48 89 c6             	mov    %rax,%rsi
+  802f55:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5a:	49 89 df             	mov    %rbx,%r15
+  802f5d:	48 b8 d3 91 ff ff ff 	movabs $0xffffffffffff91d3,%rax
+  802f64:	ff ff ff 
+  802f67:	48 01 d8             	add    %rbx,%rax
+  802f6a:	ff d0                	call   *%rax
+  802f6c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f6f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f73:	78 08                	js     802f7d <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802f75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f78:	eb 43                	jmp    802fbd <dup+0x1f6>
+			goto err;
+  802f7a:	90                   	nop
+  802f7b:	eb 01                	jmp    802f7e <dup+0x1b7>
+		goto err;
+  802f7d:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802f7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f82:	48 89 c6             	mov    %rax,%rsi
+  802f85:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f8a:	49 89 df             	mov    %rbx,%r15
+  802f8d:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  802f94:	ff ff ff 
+  802f97:	48 01 d8             	add    %rbx,%rax
+  802f9a:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802f9c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fa0:	48 89 c6             	mov    %rax,%rsi
+  802fa3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa8:	49 89 df             	mov    %rbx,%r15
+  802fab:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  802fb2:	ff ff ff 
+  802fb5:	48 01 d8             	add    %rbx,%rax
+  802fb8:	ff d0                	call   *%rax
+	return r;
+  802fba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802fbd:	48 83 c4 40          	add    $0x40,%rsp
+  802fc1:	5b                   	pop    %rbx
+  802fc2:	41 5f                	pop    %r15
+  802fc4:	5d                   	pop    %rbp
+  802fc5:	c3                   	ret
+
+0000000000802fc6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802fc6:	55                   	push   %rbp
+  802fc7:	48 89 e5             	mov    %rsp,%rbp
+  802fca:	41 57                	push   %r15
+  802fcc:	53                   	push   %rbx
+  802fcd:	48 83 ec 40          	sub    $0x40,%rsp
+  802fd1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802fd1 <read+0xb>
+  802fd8:	49 bb 67 60 00 00 00 	movabs $0x6067,%r11
+  802fdf:	00 00 00 
+  802fe2:	4c 01 db             	add    %r11,%rbx
+  802fe5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802fe8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802fec:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802ff0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802ff4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802ff7:	48 89 d6             	mov    %rdx,%rsi
+  802ffa:	89 c7                	mov    %eax,%edi
+  802ffc:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  803003:	ff ff ff 
+  803006:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80300a:	ff d0                	call   *%rax
+  80300c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80300f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803013:	78 28                	js     80303d <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803015:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803019:	8b 00                	mov    (%rax),%eax
+  80301b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80301f:	48 89 d6             	mov    %rdx,%rsi
+  803022:	89 c7                	mov    %eax,%edi
+  803024:	48 b8 ed 9b ff ff ff 	movabs $0xffffffffffff9bed,%rax
+  80302b:	ff ff ff 
+  80302e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803032:	ff d0                	call   *%rax
+  803034:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803037:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80303b:	79 08                	jns    803045 <read+0x7f>
+		return r;
+  80303d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803040:	e9 8b 00 00 00       	jmp    8030d0 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803045:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803049:	8b 40 08             	mov    0x8(%rax),%eax
+  80304c:	83 e0 03             	and    $0x3,%eax
+  80304f:	83 f8 01             	cmp    $0x1,%eax
+  803052:	75 4b                	jne    80309f <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803054:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80305b:	ff ff ff 
+  80305e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803062:	48 8b 00             	mov    (%rax),%rax
+  803065:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80306b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80306e:	89 c6                	mov    %eax,%esi
+  803070:	48 b8 4f e8 ff ff ff 	movabs $0xffffffffffffe84f,%rax
+  803077:	ff ff ff 
+  80307a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80307e:	48 89 c7             	mov    %rax,%rdi
+  803081:	49 89 df             	mov    %rbx,%r15
+  803084:	b8 00 00 00 00       	mov    $0x0,%eax
+  803089:	48 b9 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rcx
+  803090:	ff ff ff 
+  803093:	48 01 d9             	add    %rbx,%rcx
+  803096:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803098:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80309d:	eb 31                	jmp    8030d0 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80309f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030a3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8030a7:	48 85 c0             	test   %rax,%rax
+  8030aa:	75 07                	jne    8030b3 <read+0xed>
+		return -E_NOT_SUPP;
+  8030ac:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030b1:	eb 1d                	jmp    8030d0 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8030b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030b7:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8030bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030bf:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8030c3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8030c7:	48 89 ce             	mov    %rcx,%rsi
+  8030ca:	48 89 c7             	mov    %rax,%rdi
+  8030cd:	41 ff d0             	call   *%r8
+}
+  8030d0:	48 83 c4 40          	add    $0x40,%rsp
+  8030d4:	5b                   	pop    %rbx
+  8030d5:	41 5f                	pop    %r15
+  8030d7:	5d                   	pop    %rbp
+  8030d8:	c3                   	ret
+
+00000000008030d9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8030d9:	55                   	push   %rbp
+  8030da:	48 89 e5             	mov    %rsp,%rbp
+  8030dd:	53                   	push   %rbx
+  8030de:	48 83 ec 38          	sub    $0x38,%rsp
+  8030e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030e2 <readn+0x9>
+  8030e9:	49 bb 56 5f 00 00 00 	movabs $0x5f56,%r11
+  8030f0:	00 00 00 
+  8030f3:	4c 01 db             	add    %r11,%rbx
+  8030f6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030f9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8030fd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803101:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803108:	eb 4b                	jmp    803155 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80310a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80310d:	48 98                	cltq
+  80310f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803113:	48 29 c2             	sub    %rax,%rdx
+  803116:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803119:	48 63 c8             	movslq %eax,%rcx
+  80311c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803120:	48 01 c1             	add    %rax,%rcx
+  803123:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803126:	48 89 ce             	mov    %rcx,%rsi
+  803129:	89 c7                	mov    %eax,%edi
+  80312b:	48 b8 8e 9f ff ff ff 	movabs $0xffffffffffff9f8e,%rax
+  803132:	ff ff ff 
+  803135:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803139:	ff d0                	call   *%rax
+  80313b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80313e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803142:	79 05                	jns    803149 <readn+0x70>
+			return m;
+  803144:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803147:	eb 1d                	jmp    803166 <readn+0x8d>
+		if (m == 0)
+  803149:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80314d:	74 13                	je     803162 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80314f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803152:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803155:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803158:	48 98                	cltq
+  80315a:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80315e:	72 aa                	jb     80310a <readn+0x31>
+  803160:	eb 01                	jmp    803163 <readn+0x8a>
+			break;
+  803162:	90                   	nop
+	}
+	return tot;
+  803163:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803166:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80316a:	c9                   	leave
+  80316b:	c3                   	ret
+
+000000000080316c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80316c:	55                   	push   %rbp
+  80316d:	48 89 e5             	mov    %rsp,%rbp
+  803170:	41 57                	push   %r15
+  803172:	53                   	push   %rbx
+  803173:	48 83 ec 40          	sub    $0x40,%rsp
+  803177:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803177 <write+0xb>
+  80317e:	49 bb c1 5e 00 00 00 	movabs $0x5ec1,%r11
+  803185:	00 00 00 
+  803188:	4c 01 db             	add    %r11,%rbx
+  80318b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80318e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803192:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803196:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80319a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80319d:	48 89 d6             	mov    %rdx,%rsi
+  8031a0:	89 c7                	mov    %eax,%edi
+  8031a2:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  8031a9:	ff ff ff 
+  8031ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031b0:	ff d0                	call   *%rax
+  8031b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031b9:	78 28                	js     8031e3 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8031bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031bf:	8b 00                	mov    (%rax),%eax
+  8031c1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8031c5:	48 89 d6             	mov    %rdx,%rsi
+  8031c8:	89 c7                	mov    %eax,%edi
+  8031ca:	48 b8 ed 9b ff ff ff 	movabs $0xffffffffffff9bed,%rax
+  8031d1:	ff ff ff 
+  8031d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031d8:	ff d0                	call   *%rax
+  8031da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031dd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031e1:	79 08                	jns    8031eb <write+0x7f>
+		return r;
+  8031e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031e6:	e9 8a 00 00 00       	jmp    803275 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8031eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031ef:	8b 40 08             	mov    0x8(%rax),%eax
+  8031f2:	83 e0 03             	and    $0x3,%eax
+  8031f5:	85 c0                	test   %eax,%eax
+  8031f7:	75 4b                	jne    803244 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8031f9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803200:	ff ff ff 
+  803203:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803207:	48 8b 00             	mov    (%rax),%rax
+  80320a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803210:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803213:	89 c6                	mov    %eax,%esi
+  803215:	48 b8 6b e8 ff ff ff 	movabs $0xffffffffffffe86b,%rax
+  80321c:	ff ff ff 
+  80321f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803223:	48 89 c7             	mov    %rax,%rdi
+  803226:	49 89 df             	mov    %rbx,%r15
+  803229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322e:	48 b9 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rcx
+  803235:	ff ff ff 
+  803238:	48 01 d9             	add    %rbx,%rcx
+  80323b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80323d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803242:	eb 31                	jmp    803275 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803244:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803248:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80324c:	48 85 c0             	test   %rax,%rax
+  80324f:	75 07                	jne    803258 <write+0xec>
+		return -E_NOT_SUPP;
+  803251:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803256:	eb 1d                	jmp    803275 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803258:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80325c:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803260:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803264:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803268:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80326c:	48 89 ce             	mov    %rcx,%rsi
+  80326f:	48 89 c7             	mov    %rax,%rdi
+  803272:	41 ff d0             	call   *%r8
+}
+  803275:	48 83 c4 40          	add    $0x40,%rsp
+  803279:	5b                   	pop    %rbx
+  80327a:	41 5f                	pop    %r15
+  80327c:	5d                   	pop    %rbp
+  80327d:	c3                   	ret
+
+000000000080327e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80327e:	55                   	push   %rbp
+  80327f:	48 89 e5             	mov    %rsp,%rbp
+  803282:	48 83 ec 18          	sub    $0x18,%rsp
+  803286:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803286 <seek+0x8>
+  80328d:	49 bb b2 5d 00 00 00 	movabs $0x5db2,%r11
+  803294:	00 00 00 
+  803297:	4c 01 d8             	add    %r11,%rax
+  80329a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80329d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032a0:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8032a4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032a7:	48 89 ce             	mov    %rcx,%rsi
+  8032aa:	89 d7                	mov    %edx,%edi
+  8032ac:	48 ba 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rdx
+  8032b3:	ff ff ff 
+  8032b6:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8032ba:	ff d0                	call   *%rax
+  8032bc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032bf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032c3:	79 05                	jns    8032ca <seek+0x4c>
+		return r;
+  8032c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032c8:	eb 0f                	jmp    8032d9 <seek+0x5b>
+	fd->fd_offset = offset;
+  8032ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032ce:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8032d1:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8032d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032d9:	c9                   	leave
+  8032da:	c3                   	ret
+
+00000000008032db <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8032db:	55                   	push   %rbp
+  8032dc:	48 89 e5             	mov    %rsp,%rbp
+  8032df:	41 57                	push   %r15
+  8032e1:	53                   	push   %rbx
+  8032e2:	48 83 ec 30          	sub    $0x30,%rsp
+  8032e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032e6 <ftruncate+0xb>
+  8032ed:	49 bb 52 5d 00 00 00 	movabs $0x5d52,%r11
+  8032f4:	00 00 00 
+  8032f7:	4c 01 db             	add    %r11,%rbx
+  8032fa:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8032fd:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803300:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803304:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803307:	48 89 d6             	mov    %rdx,%rsi
+  80330a:	89 c7                	mov    %eax,%edi
+  80330c:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  803313:	ff ff ff 
+  803316:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80331a:	ff d0                	call   *%rax
+  80331c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80331f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803323:	78 28                	js     80334d <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803325:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803329:	8b 00                	mov    (%rax),%eax
+  80332b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80332f:	48 89 d6             	mov    %rdx,%rsi
+  803332:	89 c7                	mov    %eax,%edi
+  803334:	48 b8 ed 9b ff ff ff 	movabs $0xffffffffffff9bed,%rax
+  80333b:	ff ff ff 
+  80333e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803342:	ff d0                	call   *%rax
+  803344:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803347:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80334b:	79 08                	jns    803355 <ftruncate+0x7a>
+		return r;
+  80334d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803350:	e9 83 00 00 00       	jmp    8033d8 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803355:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803359:	8b 40 08             	mov    0x8(%rax),%eax
+  80335c:	83 e0 03             	and    $0x3,%eax
+  80335f:	85 c0                	test   %eax,%eax
+  803361:	75 4b                	jne    8033ae <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803363:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80336a:	ff ff ff 
+  80336d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803371:	48 8b 00             	mov    (%rax),%rax
+  803374:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80337a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80337d:	89 c6                	mov    %eax,%esi
+  80337f:	48 b8 88 e8 ff ff ff 	movabs $0xffffffffffffe888,%rax
+  803386:	ff ff ff 
+  803389:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80338d:	48 89 c7             	mov    %rax,%rdi
+  803390:	49 89 df             	mov    %rbx,%r15
+  803393:	b8 00 00 00 00       	mov    $0x0,%eax
+  803398:	48 b9 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rcx
+  80339f:	ff ff ff 
+  8033a2:	48 01 d9             	add    %rbx,%rcx
+  8033a5:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8033a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033ac:	eb 2a                	jmp    8033d8 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8033ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033b2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8033b6:	48 85 c0             	test   %rax,%rax
+  8033b9:	75 07                	jne    8033c2 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8033bb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8033c0:	eb 16                	jmp    8033d8 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8033c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033c6:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8033ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033ce:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8033d1:	89 d6                	mov    %edx,%esi
+  8033d3:	48 89 c7             	mov    %rax,%rdi
+  8033d6:	ff d1                	call   *%rcx
+}
+  8033d8:	48 83 c4 30          	add    $0x30,%rsp
+  8033dc:	5b                   	pop    %rbx
+  8033dd:	41 5f                	pop    %r15
+  8033df:	5d                   	pop    %rbp
+  8033e0:	c3                   	ret
+
+00000000008033e1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8033e1:	55                   	push   %rbp
+  8033e2:	48 89 e5             	mov    %rsp,%rbp
+  8033e5:	53                   	push   %rbx
+  8033e6:	48 83 ec 38          	sub    $0x38,%rsp
+  8033ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033ea <fstat+0x9>
+  8033f1:	49 bb 4e 5c 00 00 00 	movabs $0x5c4e,%r11
+  8033f8:	00 00 00 
+  8033fb:	4c 01 db             	add    %r11,%rbx
+  8033fe:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803401:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803405:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803409:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80340c:	48 89 d6             	mov    %rdx,%rsi
+  80340f:	89 c7                	mov    %eax,%edi
+  803411:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  803418:	ff ff ff 
+  80341b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80341f:	ff d0                	call   *%rax
+  803421:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803424:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803428:	78 28                	js     803452 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80342a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80342e:	8b 00                	mov    (%rax),%eax
+  803430:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803434:	48 89 d6             	mov    %rdx,%rsi
+  803437:	89 c7                	mov    %eax,%edi
+  803439:	48 b8 ed 9b ff ff ff 	movabs $0xffffffffffff9bed,%rax
+  803440:	ff ff ff 
+  803443:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803447:	ff d0                	call   *%rax
+  803449:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80344c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803450:	79 05                	jns    803457 <fstat+0x76>
+		return r;
+  803452:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803455:	eb 5e                	jmp    8034b5 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803457:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80345b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80345f:	48 85 c0             	test   %rax,%rax
+  803462:	75 07                	jne    80346b <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803464:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803469:	eb 4a                	jmp    8034b5 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80346b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80346f:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803472:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803476:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80347d:	00 00 00 
+	stat->st_isdir = 0;
+  803480:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803484:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80348b:	00 00 00 
+	stat->st_dev = dev;
+  80348e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803492:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803496:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80349d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034a1:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8034a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034ad:	48 89 d6             	mov    %rdx,%rsi
+  8034b0:	48 89 c7             	mov    %rax,%rdi
+  8034b3:	ff d1                	call   *%rcx
+}
+  8034b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034b9:	c9                   	leave
+  8034ba:	c3                   	ret
+
+00000000008034bb <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8034bb:	55                   	push   %rbp
+  8034bc:	48 89 e5             	mov    %rsp,%rbp
+  8034bf:	41 57                	push   %r15
+  8034c1:	53                   	push   %rbx
+  8034c2:	48 83 ec 20          	sub    $0x20,%rsp
+  8034c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034c6 <stat+0xb>
+  8034cd:	49 bb 72 5b 00 00 00 	movabs $0x5b72,%r11
+  8034d4:	00 00 00 
+  8034d7:	4c 01 db             	add    %r11,%rbx
+  8034da:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8034de:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8034e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8034eb:	48 89 c7             	mov    %rax,%rdi
+  8034ee:	49 89 df             	mov    %rbx,%r15
+  8034f1:	48 b8 5d a7 ff ff ff 	movabs $0xffffffffffffa75d,%rax
+  8034f8:	ff ff ff 
+  8034fb:	48 01 d8             	add    %rbx,%rax
+  8034fe:	ff d0                	call   *%rax
+  803500:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803503:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803507:	79 05                	jns    80350e <stat+0x53>
+		return fd;
+  803509:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80350c:	eb 37                	jmp    803545 <stat+0x8a>
+	r = fstat(fd, stat);
+  80350e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803512:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803515:	48 89 d6             	mov    %rdx,%rsi
+  803518:	89 c7                	mov    %eax,%edi
+  80351a:	48 b8 a9 a3 ff ff ff 	movabs $0xffffffffffffa3a9,%rax
+  803521:	ff ff ff 
+  803524:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803528:	ff d0                	call   *%rax
+  80352a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80352d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803530:	89 c7                	mov    %eax,%edi
+  803532:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  803539:	ff ff ff 
+  80353c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803540:	ff d0                	call   *%rax
+	return r;
+  803542:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803545:	48 83 c4 20          	add    $0x20,%rsp
+  803549:	5b                   	pop    %rbx
+  80354a:	41 5f                	pop    %r15
+  80354c:	5d                   	pop    %rbp
+  80354d:	c3                   	ret
+
+000000000080354e <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80354e:	55                   	push   %rbp
+  80354f:	48 89 e5             	mov    %rsp,%rbp
+  803552:	41 57                	push   %r15
+  803554:	53                   	push   %rbx
+  803555:	48 83 ec 10          	sub    $0x10,%rsp
+  803559:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803559 <fsipc+0xb>
+  803560:	49 bb df 5a 00 00 00 	movabs $0x5adf,%r11
+  803567:	00 00 00 
+  80356a:	4c 01 db             	add    %r11,%rbx
+  80356d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803570:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803574:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80357b:	00 00 00 
+  80357e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803581:	85 c0                	test   %eax,%eax
+  803583:	75 24                	jne    8035a9 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803585:	bf 01 00 00 00       	mov    $0x1,%edi
+  80358a:	49 89 df             	mov    %rbx,%r15
+  80358d:	48 b8 8f e1 ff ff ff 	movabs $0xffffffffffffe18f,%rax
+  803594:	ff ff ff 
+  803597:	48 01 d8             	add    %rbx,%rax
+  80359a:	ff d0                	call   *%rax
+  80359c:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  8035a3:	00 00 00 
+  8035a6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8035a9:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8035b0:	00 00 00 
+  8035b3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8035b6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035ba:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8035bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8035c3:	49 89 d0             	mov    %rdx,%r8
+  8035c6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8035cb:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  8035d2:	00 00 00 
+  8035d5:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8035d9:	89 c7                	mov    %eax,%edi
+  8035db:	49 89 df             	mov    %rbx,%r15
+  8035de:	48 b8 ae db ff ff ff 	movabs $0xffffffffffffdbae,%rax
+  8035e5:	ff ff ff 
+  8035e8:	48 01 d8             	add    %rbx,%rax
+  8035eb:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8035ed:	48 83 c4 10          	add    $0x10,%rsp
+  8035f1:	5b                   	pop    %rbx
+  8035f2:	41 5f                	pop    %r15
+  8035f4:	5d                   	pop    %rbp
+  8035f5:	c3                   	ret
+
+00000000008035f6 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8035f6:	55                   	push   %rbp
+  8035f7:	48 89 e5             	mov    %rsp,%rbp
+  8035fa:	41 57                	push   %r15
+  8035fc:	53                   	push   %rbx
+  8035fd:	48 83 ec 20          	sub    $0x20,%rsp
+  803601:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803601 <fsipc_words+0xb>
+  803608:	49 bb 37 5a 00 00 00 	movabs $0x5a37,%r11
+  80360f:	00 00 00 
+  803612:	4c 01 db             	add    %r11,%rbx
+  803615:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803618:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80361c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803620:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803627:	00 00 00 
+  80362a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80362d:	85 c0                	test   %eax,%eax
+  80362f:	75 24                	jne    803655 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803631:	bf 01 00 00 00       	mov    $0x1,%edi
+  803636:	49 89 df             	mov    %rbx,%r15
+  803639:	48 b8 8f e1 ff ff ff 	movabs $0xffffffffffffe18f,%rax
+  803640:	ff ff ff 
+  803643:	48 01 d8             	add    %rbx,%rax
+  803646:	ff d0                	call   *%rax
+  803648:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  80364f:	00 00 00 
+  803652:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803655:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80365c:	00 00 00 
+  80365f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803662:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803666:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80366a:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80366d:	89 c7                	mov    %eax,%edi
+  80366f:	49 89 df             	mov    %rbx,%r15
+  803672:	48 b8 99 dc ff ff ff 	movabs $0xffffffffffffdc99,%rax
+  803679:	ff ff ff 
+  80367c:	48 01 d8             	add    %rbx,%rax
+  80367f:	ff d0                	call   *%rax
+}
+  803681:	48 83 c4 20          	add    $0x20,%rsp
+  803685:	5b                   	pop    %rbx
+  803686:	41 5f                	pop    %r15
+  803688:	5d                   	pop    %rbp
+  803689:	c3                   	ret
+
+000000000080368a <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  80368a:	55                   	push   %rbp
+  80368b:	48 89 e5             	mov    %rsp,%rbp
+  80368e:	41 57                	push   %r15
+  803690:	53                   	push   %rbx
+  803691:	48 83 ec 40          	sub    $0x40,%rsp
+  803695:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803695 <fsipc_pages+0xb>
+  80369c:	49 bb a3 59 00 00 00 	movabs $0x59a3,%r11
+  8036a3:	00 00 00 
+  8036a6:	4c 01 db             	add    %r11,%rbx
+  8036a9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8036ac:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8036b0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8036b4:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8036b7:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8036be:	00 00 00 
+  8036c1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036c4:	85 c0                	test   %eax,%eax
+  8036c6:	75 24                	jne    8036ec <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036c8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8036cd:	49 89 df             	mov    %rbx,%r15
+  8036d0:	48 b8 8f e1 ff ff ff 	movabs $0xffffffffffffe18f,%rax
+  8036d7:	ff ff ff 
+  8036da:	48 01 d8             	add    %rbx,%rax
+  8036dd:	ff d0                	call   *%rax
+  8036df:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  8036e6:	00 00 00 
+  8036e9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8036ec:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8036f1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8036f5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8036f8:	48 98                	cltq
+  8036fa:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8036fe:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803702:	0f 95 c0             	setne  %al
+  803705:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803708:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80370f:	00 
+  803710:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803714:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803718:	48 01 d0             	add    %rdx,%rax
+  80371b:	48 83 e8 01          	sub    $0x1,%rax
+  80371f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803723:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803727:	ba 00 00 00 00       	mov    $0x0,%edx
+  80372c:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803730:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803734:	48 29 d0             	sub    %rdx,%rax
+  803737:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  80373b:	41 89 c2             	mov    %eax,%r10d
+  80373e:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803745:	00 00 00 
+  803748:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80374b:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80374f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803753:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803756:	48 83 ec 08          	sub    $0x8,%rsp
+  80375a:	6a 40                	push   $0x40
+  80375c:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803761:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803768:	00 
+  803769:	6a 05                	push   $0x5
+  80376b:	41 89 f9             	mov    %edi,%r9d
+  80376e:	49 89 c8             	mov    %rcx,%r8
+  803771:	44 89 d1             	mov    %r10d,%ecx
+  803774:	89 c7                	mov    %eax,%edi
+  803776:	49 89 df             	mov    %rbx,%r15
+  803779:	48 b8 97 dd ff ff ff 	movabs $0xffffffffffffdd97,%rax
+  803780:	ff ff ff 
+  803783:	48 01 d8             	add    %rbx,%rax
+  803786:	ff d0                	call   *%rax
+  803788:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80378c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803790:	5b                   	pop    %rbx
+  803791:	41 5f                	pop    %r15
+  803793:	5d                   	pop    %rbp
+  803794:	c3                   	ret
+
+0000000000803795 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  803795:	55                   	push   %rbp
+  803796:	48 89 e5             	mov    %rsp,%rbp
+  803799:	41 57                	push   %r15
+  80379b:	53                   	push   %rbx
+  80379c:	48 83 ec 20          	sub    $0x20,%rsp
+  8037a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037a0 <open+0xb>
+  8037a7:	49 bb 98 58 00 00 00 	movabs $0x5898,%r11
+  8037ae:	00 00 00 
+  8037b1:	4c 01 db             	add    %r11,%rbx
+  8037b4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8037b8:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8037bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037bf:	48 89 c7             	mov    %rax,%rdi
+  8037c2:	49 89 df             	mov    %rbx,%r15
+  8037c5:	48 b8 1e 84 ff ff ff 	movabs $0xffffffffffff841e,%rax
+  8037cc:	ff ff ff 
+  8037cf:	48 01 d8             	add    %rbx,%rax
+  8037d2:	ff d0                	call   *%rax
+  8037d4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8037d9:	7e 0a                	jle    8037e5 <open+0x50>
+		return -E_BAD_PATH;
+  8037db:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8037e0:	e9 18 01 00 00       	jmp    8038fd <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8037e5:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8037e9:	48 89 c7             	mov    %rax,%rdi
+  8037ec:	49 89 df             	mov    %rbx,%r15
+  8037ef:	48 b8 91 99 ff ff ff 	movabs $0xffffffffffff9991,%rax
+  8037f6:	ff ff ff 
+  8037f9:	48 01 d8             	add    %rbx,%rax
+  8037fc:	ff d0                	call   *%rax
+  8037fe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803801:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803805:	74 08                	je     80380f <open+0x7a>
+		return r;
+  803807:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80380a:	e9 ee 00 00 00       	jmp    8038fd <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80380f:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803816:	00 00 00 
+  803819:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80381c:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  803823:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803827:	48 89 c6             	mov    %rax,%rsi
+  80382a:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803831:	00 00 00 
+  803834:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803838:	48 89 c7             	mov    %rax,%rdi
+  80383b:	49 89 df             	mov    %rbx,%r15
+  80383e:	48 b8 b2 84 ff ff ff 	movabs $0xffffffffffff84b2,%rax
+  803845:	ff ff ff 
+  803848:	48 01 d8             	add    %rbx,%rax
+  80384b:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  80384d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803851:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803856:	48 89 c6             	mov    %rax,%rsi
+  803859:	bf 00 00 00 00       	mov    $0x0,%edi
+  80385e:	49 89 df             	mov    %rbx,%r15
+  803861:	48 b8 6e 91 ff ff ff 	movabs $0xffffffffffff916e,%rax
+  803868:	ff ff ff 
+  80386b:	48 01 d8             	add    %rbx,%rax
+  80386e:	ff d0                	call   *%rax
+  803870:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803873:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803877:	74 23                	je     80389c <open+0x107>
+		fd_close(fd,0);
+  803879:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80387d:	be 00 00 00 00       	mov    $0x0,%esi
+  803882:	48 89 c7             	mov    %rax,%rdi
+  803885:	49 89 df             	mov    %rbx,%r15
+  803888:	48 b8 f2 9a ff ff ff 	movabs $0xffffffffffff9af2,%rax
+  80388f:	ff ff ff 
+  803892:	48 01 d8             	add    %rbx,%rax
+  803895:	ff d0                	call   *%rax
+		return r;
+  803897:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80389a:	eb 61                	jmp    8038fd <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80389c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038a0:	48 89 c6             	mov    %rax,%rsi
+  8038a3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8038a8:	48 b8 16 a5 ff ff ff 	movabs $0xffffffffffffa516,%rax
+  8038af:	ff ff ff 
+  8038b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038b6:	ff d0                	call   *%rax
+  8038b8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038bf:	74 23                	je     8038e4 <open+0x14f>
+		fd_close(fd,0);
+  8038c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ca:	48 89 c7             	mov    %rax,%rdi
+  8038cd:	49 89 df             	mov    %rbx,%r15
+  8038d0:	48 b8 f2 9a ff ff ff 	movabs $0xffffffffffff9af2,%rax
+  8038d7:	ff ff ff 
+  8038da:	48 01 d8             	add    %rbx,%rax
+  8038dd:	ff d0                	call   *%rax
+		return r;
+  8038df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038e2:	eb 19                	jmp    8038fd <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8038e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038e8:	48 89 c7             	mov    %rax,%rdi
+  8038eb:	49 89 df             	mov    %rbx,%r15
+  8038ee:	48 b8 17 99 ff ff ff 	movabs $0xffffffffffff9917,%rax
+  8038f5:	ff ff ff 
+  8038f8:	48 01 d8             	add    %rbx,%rax
+  8038fb:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8038fd:	48 83 c4 20          	add    $0x20,%rsp
+  803901:	5b                   	pop    %rbx
+  803902:	41 5f                	pop    %r15
+  803904:	5d                   	pop    %rbp
+  803905:	c3                   	ret
+
+0000000000803906 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803906:	55                   	push   %rbp
+  803907:	48 89 e5             	mov    %rsp,%rbp
+  80390a:	48 83 ec 20          	sub    $0x20,%rsp
+  80390e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80390e <devfile_flush+0x8>
+  803915:	49 bb 2a 57 00 00 00 	movabs $0x572a,%r11
+  80391c:	00 00 00 
+  80391f:	4c 01 d8             	add    %r11,%rax
+  803922:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803926:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80392a:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80392d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803930:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803934:	ba 04 00 00 00       	mov    $0x4,%edx
+  803939:	48 89 ce             	mov    %rcx,%rsi
+  80393c:	bf 06 00 00 00       	mov    $0x6,%edi
+  803941:	48 b9 be a5 ff ff ff 	movabs $0xffffffffffffa5be,%rcx
+  803948:	ff ff ff 
+  80394b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80394f:	ff d0                	call   *%rax
+}
+  803951:	c9                   	leave
+  803952:	c3                   	ret
+
+0000000000803953 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803953:	55                   	push   %rbp
+  803954:	48 89 e5             	mov    %rsp,%rbp
+  803957:	41 57                	push   %r15
+  803959:	53                   	push   %rbx
+  80395a:	48 83 ec 60          	sub    $0x60,%rsp
+  80395e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80395e <devfile_read+0xb>
+  803965:	49 bb da 56 00 00 00 	movabs $0x56da,%r11
+  80396c:	00 00 00 
+  80396f:	4c 01 db             	add    %r11,%rbx
+  803972:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803976:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80397a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80397e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803982:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803986:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80398a:	8b 50 0c             	mov    0xc(%rax),%edx
+  80398d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803991:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803993:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803997:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80399b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  80399f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8039a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8039a8:	ba 10 00 00 00       	mov    $0x10,%edx
+  8039ad:	48 89 c6             	mov    %rax,%rsi
+  8039b0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039b5:	48 b8 52 a6 ff ff ff 	movabs $0xffffffffffffa652,%rax
+  8039bc:	ff ff ff 
+  8039bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039c3:	ff d0                	call   *%rax
+  8039c5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8039c8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8039cc:	79 05                	jns    8039d3 <devfile_read+0x80>
+		return r;
+  8039ce:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8039d1:	eb 64                	jmp    803a37 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8039d3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8039d6:	48 63 d0             	movslq %eax,%rdx
+  8039d9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039dd:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8039e2:	48 01 c1             	add    %rax,%rcx
+  8039e5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8039e9:	48 89 ce             	mov    %rcx,%rsi
+  8039ec:	48 89 c7             	mov    %rax,%rdi
+  8039ef:	49 89 df             	mov    %rbx,%r15
+  8039f2:	48 b8 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rax
+  8039f9:	ff ff ff 
+  8039fc:	48 01 d8             	add    %rbx,%rax
+  8039ff:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803a01:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803a08:	ff ff ff 
+  803a0b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a0f:	48 8b 00             	mov    (%rax),%rax
+  803a12:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803a18:	89 c6                	mov    %eax,%esi
+  803a1a:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803a1f:	48 89 c7             	mov    %rax,%rdi
+  803a22:	49 89 df             	mov    %rbx,%r15
+  803a25:	48 b8 49 e1 ff ff ff 	movabs $0xffffffffffffe149,%rax
+  803a2c:	ff ff ff 
+  803a2f:	48 01 d8             	add    %rbx,%rax
+  803a32:	ff d0                	call   *%rax
+	return r;
+  803a34:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803a37:	48 83 c4 60          	add    $0x60,%rsp
+  803a3b:	5b                   	pop    %rbx
+  803a3c:	41 5f                	pop    %r15
+  803a3e:	5d                   	pop    %rbp
+  803a3f:	c3                   	ret
+
+0000000000803a40 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803a40:	55                   	push   %rbp
+  803a41:	48 89 e5             	mov    %rsp,%rbp
+  803a44:	41 57                	push   %r15
+  803a46:	53                   	push   %rbx
+  803a47:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803a4b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a4b <devfile_write+0xb>
+  803a52:	49 bb ed 55 00 00 00 	movabs $0x55ed,%r11
+  803a59:	00 00 00 
+  803a5c:	4c 01 db             	add    %r11,%rbx
+  803a5f:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803a63:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803a67:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803a6e:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803a72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803a76:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803a7d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803a81:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803a88:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a8b:	48 63 d0             	movslq %eax,%rdx
+  803a8e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a92:	48 39 c2             	cmp    %rax,%rdx
+  803a95:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803a99:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803aa0:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803aa7:	00 
+  803aa8:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803aaf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ab3:	48 01 d0             	add    %rdx,%rax
+  803ab6:	48 83 e8 01          	sub    $0x1,%rax
+  803aba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803abe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ac2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ac7:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803acb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803acf:	48 29 d0             	sub    %rdx,%rax
+  803ad2:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ad6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803ad9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803adc:	89 c6                	mov    %eax,%esi
+  803ade:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803ae3:	48 89 c7             	mov    %rax,%rdi
+  803ae6:	49 89 df             	mov    %rbx,%r15
+  803ae9:	48 b8 03 e1 ff ff ff 	movabs $0xffffffffffffe103,%rax
+  803af0:	ff ff ff 
+  803af3:	48 01 d8             	add    %rbx,%rax
+  803af6:	ff d0                	call   *%rax
+  803af8:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803afb:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803aff:	79 08                	jns    803b09 <devfile_write+0xc9>
+		return r;
+  803b01:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803b04:	e9 8f 00 00 00       	jmp    803b98 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803b09:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b10:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803b14:	48 89 c6             	mov    %rax,%rsi
+  803b17:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b1c:	48 89 c7             	mov    %rax,%rdi
+  803b1f:	49 89 df             	mov    %rbx,%r15
+  803b22:	48 b8 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rax
+  803b29:	ff ff ff 
+  803b2c:	48 01 d8             	add    %rbx,%rax
+  803b2f:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803b31:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803b35:	8b 50 0c             	mov    0xc(%rax),%edx
+  803b38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b3c:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803b3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b42:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b49:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803b4d:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803b50:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803b54:	89 d1                	mov    %edx,%ecx
+  803b56:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b5b:	48 89 c6             	mov    %rax,%rsi
+  803b5e:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b63:	48 b8 52 a6 ff ff ff 	movabs $0xffffffffffffa652,%rax
+  803b6a:	ff ff ff 
+  803b6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b71:	ff d0                	call   *%rax
+  803b73:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803b76:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803b79:	89 c6                	mov    %eax,%esi
+  803b7b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b80:	48 89 c7             	mov    %rax,%rdi
+  803b83:	49 89 df             	mov    %rbx,%r15
+  803b86:	48 b8 49 e1 ff ff ff 	movabs $0xffffffffffffe149,%rax
+  803b8d:	ff ff ff 
+  803b90:	48 01 d8             	add    %rbx,%rax
+  803b93:	ff d0                	call   *%rax
+	return r;
+  803b95:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803b98:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803b9c:	5b                   	pop    %rbx
+  803b9d:	41 5f                	pop    %r15
+  803b9f:	5d                   	pop    %rbp
+  803ba0:	c3                   	ret
+
+0000000000803ba1 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803ba1:	55                   	push   %rbp
+  803ba2:	48 89 e5             	mov    %rsp,%rbp
+  803ba5:	41 57                	push   %r15
+  803ba7:	53                   	push   %rbx
+  803ba8:	48 83 ec 20          	sub    $0x20,%rsp
+  803bac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bac <devfile_stat+0xb>
+  803bb3:	49 bb 8c 54 00 00 00 	movabs $0x548c,%r11
+  803bba:	00 00 00 
+  803bbd:	4c 01 db             	add    %r11,%rbx
+  803bc0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803bc4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803bc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bcc:	8b 40 0c             	mov    0xc(%rax),%eax
+  803bcf:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803bd6:	00 00 00 
+  803bd9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803bdc:	be 00 00 00 00       	mov    $0x0,%esi
+  803be1:	bf 05 00 00 00       	mov    $0x5,%edi
+  803be6:	48 b8 16 a5 ff ff ff 	movabs $0xffffffffffffa516,%rax
+  803bed:	ff ff ff 
+  803bf0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bf4:	ff d0                	call   *%rax
+  803bf6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bf9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bfd:	79 05                	jns    803c04 <devfile_stat+0x63>
+		return r;
+  803bff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c02:	eb 65                	jmp    803c69 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c04:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c08:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803c0f:	00 00 00 
+  803c12:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803c16:	48 89 d6             	mov    %rdx,%rsi
+  803c19:	48 89 c7             	mov    %rax,%rdi
+  803c1c:	49 89 df             	mov    %rbx,%r15
+  803c1f:	48 b8 b2 84 ff ff ff 	movabs $0xffffffffffff84b2,%rax
+  803c26:	ff ff ff 
+  803c29:	48 01 d8             	add    %rbx,%rax
+  803c2c:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803c2e:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803c35:	00 00 00 
+  803c38:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803c3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c43:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c49:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803c50:	00 00 00 
+  803c53:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803c5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c5e:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803c64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c69:	48 83 c4 20          	add    $0x20,%rsp
+  803c6d:	5b                   	pop    %rbx
+  803c6e:	41 5f                	pop    %r15
+  803c70:	5d                   	pop    %rbp
+  803c71:	c3                   	ret
+
+0000000000803c72 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803c72:	55                   	push   %rbp
+  803c73:	48 89 e5             	mov    %rsp,%rbp
+  803c76:	48 83 ec 20          	sub    $0x20,%rsp
+  803c7a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c7a <devfile_trunc+0x8>
+  803c81:	49 bb be 53 00 00 00 	movabs $0x53be,%r11
+  803c88:	00 00 00 
+  803c8b:	4c 01 d8             	add    %r11,%rax
+  803c8e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c92:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803c95:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803c99:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803c9c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803c9f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803ca2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803ca5:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803ca9:	ba 08 00 00 00       	mov    $0x8,%edx
+  803cae:	48 89 ce             	mov    %rcx,%rsi
+  803cb1:	bf 02 00 00 00       	mov    $0x2,%edi
+  803cb6:	48 b9 be a5 ff ff ff 	movabs $0xffffffffffffa5be,%rcx
+  803cbd:	ff ff ff 
+  803cc0:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803cc4:	ff d0                	call   *%rax
+}
+  803cc6:	c9                   	leave
+  803cc7:	c3                   	ret
+
+0000000000803cc8 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803cc8:	55                   	push   %rbp
+  803cc9:	48 89 e5             	mov    %rsp,%rbp
+  803ccc:	41 57                	push   %r15
+  803cce:	53                   	push   %rbx
+  803ccf:	48 83 ec 10          	sub    $0x10,%rsp
+  803cd3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cd3 <remove+0xb>
+  803cda:	49 bb 65 53 00 00 00 	movabs $0x5365,%r11
+  803ce1:	00 00 00 
+  803ce4:	4c 01 db             	add    %r11,%rbx
+  803ce7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803ceb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cef:	48 89 c7             	mov    %rax,%rdi
+  803cf2:	49 89 df             	mov    %rbx,%r15
+  803cf5:	48 b8 1e 84 ff ff ff 	movabs $0xffffffffffff841e,%rax
+  803cfc:	ff ff ff 
+  803cff:	48 01 d8             	add    %rbx,%rax
+  803d02:	ff d0                	call   *%rax
+  803d04:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803d09:	7e 07                	jle    803d12 <remove+0x4a>
+		return -E_BAD_PATH;
+  803d0b:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803d10:	eb 44                	jmp    803d56 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803d12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d16:	48 89 c6             	mov    %rax,%rsi
+  803d19:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803d20:	00 00 00 
+  803d23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d27:	48 89 c7             	mov    %rax,%rdi
+  803d2a:	49 89 df             	mov    %rbx,%r15
+  803d2d:	48 b8 b2 84 ff ff ff 	movabs $0xffffffffffff84b2,%rax
+  803d34:	ff ff ff 
+  803d37:	48 01 d8             	add    %rbx,%rax
+  803d3a:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803d3c:	be 00 00 00 00       	mov    $0x0,%esi
+  803d41:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d46:	48 b8 16 a5 ff ff ff 	movabs $0xffffffffffffa516,%rax
+  803d4d:	ff ff ff 
+  803d50:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d54:	ff d0                	call   *%rax
+}
+  803d56:	48 83 c4 10          	add    $0x10,%rsp
+  803d5a:	5b                   	pop    %rbx
+  803d5b:	41 5f                	pop    %r15
+  803d5d:	5d                   	pop    %rbp
+  803d5e:	c3                   	ret
+
+0000000000803d5f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803d5f:	55                   	push   %rbp
+  803d60:	48 89 e5             	mov    %rsp,%rbp
+  803d63:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d63 <sync+0x4>
+  803d6a:	49 bb d5 52 00 00 00 	movabs $0x52d5,%r11
+  803d71:	00 00 00 
+  803d74:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d7c:	be 00 00 00 00       	mov    $0x0,%esi
+  803d81:	bf 08 00 00 00       	mov    $0x8,%edi
+  803d86:	48 b9 be a5 ff ff ff 	movabs $0xffffffffffffa5be,%rcx
+  803d8d:	ff ff ff 
+  803d90:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803d94:	ff d0                	call   *%rax
+}
+  803d96:	5d                   	pop    %rbp
+  803d97:	c3                   	ret
+
+0000000000803d98 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803d98:	55                   	push   %rbp
+  803d99:	48 89 e5             	mov    %rsp,%rbp
+  803d9c:	41 57                	push   %r15
+  803d9e:	53                   	push   %rbx
+  803d9f:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803da6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803da6 <copy+0xe>
+  803dad:	49 bb 92 52 00 00 00 	movabs $0x5292,%r11
+  803db4:	00 00 00 
+  803db7:	4c 01 db             	add    %r11,%rbx
+  803dba:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803dc1:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803dc8:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  803dd4:	48 89 c7             	mov    %rax,%rdi
+  803dd7:	48 b8 5d a7 ff ff ff 	movabs $0xffffffffffffa75d,%rax
+  803dde:	ff ff ff 
+  803de1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803de5:	ff d0                	call   *%rax
+  803de7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803dea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803dee:	79 35                	jns    803e25 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803df0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803df3:	89 c6                	mov    %eax,%esi
+  803df5:	48 b8 ae e8 ff ff ff 	movabs $0xffffffffffffe8ae,%rax
+  803dfc:	ff ff ff 
+  803dff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e03:	48 89 c7             	mov    %rax,%rdi
+  803e06:	49 89 df             	mov    %rbx,%r15
+  803e09:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e0e:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  803e15:	ff ff ff 
+  803e18:	48 01 da             	add    %rbx,%rdx
+  803e1b:	ff d2                	call   *%rdx
+		return fd_src;
+  803e1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e20:	e9 d7 01 00 00       	jmp    803ffc <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803e25:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803e2c:	be 01 01 00 00       	mov    $0x101,%esi
+  803e31:	48 89 c7             	mov    %rax,%rdi
+  803e34:	48 b8 5d a7 ff ff ff 	movabs $0xffffffffffffa75d,%rax
+  803e3b:	ff ff ff 
+  803e3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e42:	ff d0                	call   *%rax
+  803e44:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803e47:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803e4b:	0f 89 df 00 00 00    	jns    803f30 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803e51:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e54:	89 c6                	mov    %eax,%esi
+  803e56:	48 b8 c4 e8 ff ff ff 	movabs $0xffffffffffffe8c4,%rax
+  803e5d:	ff ff ff 
+  803e60:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e64:	48 89 c7             	mov    %rax,%rdi
+  803e67:	49 89 df             	mov    %rbx,%r15
+  803e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e6f:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  803e76:	ff ff ff 
+  803e79:	48 01 da             	add    %rbx,%rdx
+  803e7c:	ff d2                	call   *%rdx
+		close(fd_src);
+  803e7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e81:	89 c7                	mov    %eax,%edi
+  803e83:	49 89 df             	mov    %rbx,%r15
+  803e86:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  803e8d:	ff ff ff 
+  803e90:	48 01 d8             	add    %rbx,%rax
+  803e93:	ff d0                	call   *%rax
+		return fd_dest;
+  803e95:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e98:	e9 5f 01 00 00       	jmp    803ffc <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803e9d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ea0:	48 63 d0             	movslq %eax,%rdx
+  803ea3:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803eaa:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ead:	48 89 ce             	mov    %rcx,%rsi
+  803eb0:	89 c7                	mov    %eax,%edi
+  803eb2:	49 89 df             	mov    %rbx,%r15
+  803eb5:	48 b8 34 a1 ff ff ff 	movabs $0xffffffffffffa134,%rax
+  803ebc:	ff ff ff 
+  803ebf:	48 01 d8             	add    %rbx,%rax
+  803ec2:	ff d0                	call   *%rax
+  803ec4:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803ec7:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803ecb:	79 63                	jns    803f30 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803ecd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803ed0:	89 c6                	mov    %eax,%esi
+  803ed2:	48 b8 de e8 ff ff ff 	movabs $0xffffffffffffe8de,%rax
+  803ed9:	ff ff ff 
+  803edc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ee0:	48 89 c7             	mov    %rax,%rdi
+  803ee3:	49 89 df             	mov    %rbx,%r15
+  803ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eeb:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  803ef2:	ff ff ff 
+  803ef5:	48 01 da             	add    %rbx,%rdx
+  803ef8:	ff d2                	call   *%rdx
+			close(fd_src);
+  803efa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803efd:	89 c7                	mov    %eax,%edi
+  803eff:	49 89 df             	mov    %rbx,%r15
+  803f02:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  803f09:	ff ff ff 
+  803f0c:	48 01 d8             	add    %rbx,%rax
+  803f0f:	ff d0                	call   *%rax
+			close(fd_dest);
+  803f11:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f14:	89 c7                	mov    %eax,%edi
+  803f16:	49 89 df             	mov    %rbx,%r15
+  803f19:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  803f20:	ff ff ff 
+  803f23:	48 01 d8             	add    %rbx,%rax
+  803f26:	ff d0                	call   *%rax
+			return write_size;
+  803f28:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803f2b:	e9 cc 00 00 00       	jmp    803ffc <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803f30:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803f37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f3a:	ba 00 02 00 00       	mov    $0x200,%edx
+  803f3f:	48 89 ce             	mov    %rcx,%rsi
+  803f42:	89 c7                	mov    %eax,%edi
+  803f44:	49 89 df             	mov    %rbx,%r15
+  803f47:	48 b8 8e 9f ff ff ff 	movabs $0xffffffffffff9f8e,%rax
+  803f4e:	ff ff ff 
+  803f51:	48 01 d8             	add    %rbx,%rax
+  803f54:	ff d0                	call   *%rax
+  803f56:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803f59:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f5d:	0f 8f 3a ff ff ff    	jg     803e9d <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803f63:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803f67:	79 60                	jns    803fc9 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803f69:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f6c:	89 c6                	mov    %eax,%esi
+  803f6e:	48 b8 f1 e8 ff ff ff 	movabs $0xffffffffffffe8f1,%rax
+  803f75:	ff ff ff 
+  803f78:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f7c:	48 89 c7             	mov    %rax,%rdi
+  803f7f:	49 89 df             	mov    %rbx,%r15
+  803f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f87:	48 ba f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rdx
+  803f8e:	ff ff ff 
+  803f91:	48 01 da             	add    %rbx,%rdx
+  803f94:	ff d2                	call   *%rdx
+		close(fd_src);
+  803f96:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f99:	89 c7                	mov    %eax,%edi
+  803f9b:	49 89 df             	mov    %rbx,%r15
+  803f9e:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  803fa5:	ff ff ff 
+  803fa8:	48 01 d8             	add    %rbx,%rax
+  803fab:	ff d0                	call   *%rax
+		close(fd_dest);
+  803fad:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803fb0:	89 c7                	mov    %eax,%edi
+  803fb2:	49 89 df             	mov    %rbx,%r15
+  803fb5:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  803fbc:	ff ff ff 
+  803fbf:	48 01 d8             	add    %rbx,%rax
+  803fc2:	ff d0                	call   *%rax
+		return read_size;
+  803fc4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fc7:	eb 33                	jmp    803ffc <copy+0x264>
+	}
+	close(fd_src);
+  803fc9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fcc:	89 c7                	mov    %eax,%edi
+  803fce:	49 89 df             	mov    %rbx,%r15
+  803fd1:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  803fd8:	ff ff ff 
+  803fdb:	48 01 d8             	add    %rbx,%rax
+  803fde:	ff d0                	call   *%rax
+	close(fd_dest);
+  803fe0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803fe3:	89 c7                	mov    %eax,%edi
+  803fe5:	49 89 df             	mov    %rbx,%r15
+  803fe8:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  803fef:	ff ff ff 
+  803ff2:	48 01 d8             	add    %rbx,%rax
+  803ff5:	ff d0                	call   *%rax
+	return 0;
+  803ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803ffc:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804003:	5b                   	pop    %rbx
+  804004:	41 5f                	pop    %r15
+  804006:	5d                   	pop    %rbp
+  804007:	c3                   	ret
+
+0000000000804008 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  804008:	55                   	push   %rbp
+  804009:	48 89 e5             	mov    %rsp,%rbp
+  80400c:	41 57                	push   %r15
+  80400e:	53                   	push   %rbx
+  80400f:	48 81 ec 00 03 00 00 	sub    $0x300,%rsp
+  804016:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804016 <spawn+0xe>
+  80401d:	49 bb 22 50 00 00 00 	movabs $0x5022,%r11
+  804024:	00 00 00 
+  804027:	4c 01 db             	add    %r11,%rbx
+  80402a:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  804031:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  804038:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  80403f:	be 00 00 00 00       	mov    $0x0,%esi
+  804044:	48 89 c7             	mov    %rax,%rdi
+  804047:	49 89 df             	mov    %rbx,%r15
+  80404a:	48 b8 5d a7 ff ff ff 	movabs $0xffffffffffffa75d,%rax
+  804051:	ff ff ff 
+  804054:	48 01 d8             	add    %rbx,%rax
+  804057:	ff d0                	call   *%rax
+  804059:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80405c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804060:	79 08                	jns    80406a <spawn+0x62>
+		return r;
+  804062:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804065:	e9 9e 04 00 00       	jmp    804508 <spawn+0x500>
+	fd = r;
+  80406a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80406d:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+  804070:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+  804077:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  80407b:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+  804082:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804085:	ba 00 02 00 00       	mov    $0x200,%edx
+  80408a:	48 89 ce             	mov    %rcx,%rsi
+  80408d:	89 c7                	mov    %eax,%edi
+  80408f:	49 89 df             	mov    %rbx,%r15
+  804092:	48 b8 a1 a0 ff ff ff 	movabs $0xffffffffffffa0a1,%rax
+  804099:	ff ff ff 
+  80409c:	48 01 d8             	add    %rbx,%rax
+  80409f:	ff d0                	call   *%rax
+  8040a1:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8040a6:	75 0d                	jne    8040b5 <spawn+0xad>
+            || elf->e_magic != ELF_MAGIC) {
+  8040a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040ac:	8b 00                	mov    (%rax),%eax
+  8040ae:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  8040b3:	74 56                	je     80410b <spawn+0x103>
+		close(fd);
+  8040b5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8040b8:	89 c7                	mov    %eax,%edi
+  8040ba:	49 89 df             	mov    %rbx,%r15
+  8040bd:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  8040c4:	ff ff ff 
+  8040c7:	48 01 d8             	add    %rbx,%rax
+  8040ca:	ff d0                	call   *%rax
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8040cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040d0:	8b 00                	mov    (%rax),%eax
+  8040d2:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8040d7:	89 c6                	mov    %eax,%esi
+  8040d9:	48 b8 08 e9 ff ff ff 	movabs $0xffffffffffffe908,%rax
+  8040e0:	ff ff ff 
+  8040e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040e7:	48 89 c7             	mov    %rax,%rdi
+  8040ea:	49 89 df             	mov    %rbx,%r15
+  8040ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f2:	48 b9 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rcx
+  8040f9:	ff ff ff 
+  8040fc:	48 01 d9             	add    %rbx,%rcx
+  8040ff:	ff d1                	call   *%rcx
+		return -E_NOT_EXEC;
+  804101:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804106:	e9 fd 03 00 00       	jmp    804508 <spawn+0x500>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80410b:	b8 07 00 00 00       	mov    $0x7,%eax
+  804110:	cd 30                	int    $0x30
+  804112:	89 45 c0             	mov    %eax,-0x40(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  804115:	8b 45 c0             	mov    -0x40(%rbp),%eax
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  804118:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80411b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80411f:	79 08                	jns    804129 <spawn+0x121>
+		return r;
+  804121:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804124:	e9 df 03 00 00       	jmp    804508 <spawn+0x500>
+	child = r;
+  804129:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80412c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  80412f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804132:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804137:	89 c1                	mov    %eax,%ecx
+  804139:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  804140:	ff ff ff 
+  804143:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  804147:	48 63 c1             	movslq %ecx,%rax
+  80414a:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  804151:	48 01 d0             	add    %rdx,%rax
+  804154:	48 8b 30             	mov    (%rax),%rsi
+  804157:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80415b:	48 89 b5 00 fd ff ff 	mov    %rsi,-0x300(%rbp)
+  804162:	48 89 bd 08 fd ff ff 	mov    %rdi,-0x2f8(%rbp)
+  804169:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  80416d:	48 8b 78 18          	mov    0x18(%rax),%rdi
+  804171:	48 89 b5 10 fd ff ff 	mov    %rsi,-0x2f0(%rbp)
+  804178:	48 89 bd 18 fd ff ff 	mov    %rdi,-0x2e8(%rbp)
+  80417f:	48 8b 70 20          	mov    0x20(%rax),%rsi
+  804183:	48 8b 78 28          	mov    0x28(%rax),%rdi
+  804187:	48 89 b5 20 fd ff ff 	mov    %rsi,-0x2e0(%rbp)
+  80418e:	48 89 bd 28 fd ff ff 	mov    %rdi,-0x2d8(%rbp)
+  804195:	48 8b 70 30          	mov    0x30(%rax),%rsi
+  804199:	48 8b 78 38          	mov    0x38(%rax),%rdi
+  80419d:	48 89 b5 30 fd ff ff 	mov    %rsi,-0x2d0(%rbp)
+  8041a4:	48 89 bd 38 fd ff ff 	mov    %rdi,-0x2c8(%rbp)
+  8041ab:	48 8b 70 40          	mov    0x40(%rax),%rsi
+  8041af:	48 8b 78 48          	mov    0x48(%rax),%rdi
+  8041b3:	48 89 b5 40 fd ff ff 	mov    %rsi,-0x2c0(%rbp)
+  8041ba:	48 89 bd 48 fd ff ff 	mov    %rdi,-0x2b8(%rbp)
+  8041c1:	48 8b 70 50          	mov    0x50(%rax),%rsi
+  8041c5:	48 8b 78 58          	mov    0x58(%rax),%rdi
+  8041c9:	48 89 b5 50 fd ff ff 	mov    %rsi,-0x2b0(%rbp)
+  8041d0:	48 89 bd 58 fd ff ff 	mov    %rdi,-0x2a8(%rbp)
+  8041d7:	48 8b 70 60          	mov    0x60(%rax),%rsi
+  8041db:	48 8b 78 68          	mov    0x68(%rax),%rdi
+  8041df:	48 89 b5 60 fd ff ff 	mov    %rsi,-0x2a0(%rbp)
+  8041e6:	48 89 bd 68 fd ff ff 	mov    %rdi,-0x298(%rbp)
+  8041ed:	48 8b 70 70          	mov    0x70(%rax),%rsi
+  8041f1:	48 8b 78 78          	mov    0x78(%rax),%rdi
+  8041f5:	48 89 b5 70 fd ff ff 	mov    %rsi,-0x290(%rbp)
+  8041fc:	48 89 bd 78 fd ff ff 	mov    %rdi,-0x288(%rbp)
+  804203:	48 8b b0 80 00 00 00 	mov    0x80(%rax),%rsi
+  80420a:	48 8b b8 88 00 00 00 	mov    0x88(%rax),%rdi
+  804211:	48 89 b5 80 fd ff ff 	mov    %rsi,-0x280(%rbp)
+  804218:	48 89 bd 88 fd ff ff 	mov    %rdi,-0x278(%rbp)
+  80421f:	48 8b b0 90 00 00 00 	mov    0x90(%rax),%rsi
+  804226:	48 8b b8 98 00 00 00 	mov    0x98(%rax),%rdi
+  80422d:	48 89 b5 90 fd ff ff 	mov    %rsi,-0x270(%rbp)
+  804234:	48 89 bd 98 fd ff ff 	mov    %rdi,-0x268(%rbp)
+  80423b:	48 8b b0 a0 00 00 00 	mov    0xa0(%rax),%rsi
+  804242:	48 8b b8 a8 00 00 00 	mov    0xa8(%rax),%rdi
+  804249:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  804250:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  804257:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  80425e:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  804265:	48 89 85 b0 fd ff ff 	mov    %rax,-0x250(%rbp)
+  80426c:	48 89 95 b8 fd ff ff 	mov    %rdx,-0x248(%rbp)
+	child_tf.tf_rip = elf->e_entry;
+  804273:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804277:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80427b:	48 89 85 98 fd ff ff 	mov    %rax,-0x268(%rbp)
+
+	if ((r = init_stack(child, argv, &child_tf.tf_rsp)) < 0)
+  804282:	48 8d 85 00 fd ff ff 	lea    -0x300(%rbp),%rax
+  804289:	48 8d 90 b0 00 00 00 	lea    0xb0(%rax),%rdx
+  804290:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  804297:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80429a:	48 89 ce             	mov    %rcx,%rsi
+  80429d:	89 c7                	mov    %eax,%edi
+  80429f:	48 b8 5e b7 ff ff ff 	movabs $0xffffffffffffb75e,%rax
+  8042a6:	ff ff ff 
+  8042a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042ad:	ff d0                	call   *%rax
+  8042af:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8042b2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8042b6:	79 08                	jns    8042c0 <spawn+0x2b8>
+		return r;
+  8042b8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8042bb:	e9 48 02 00 00       	jmp    804508 <spawn+0x500>
+
+	// Set up program segments as defined in ELF header.
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  8042c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042c4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8042c8:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8042cf:	48 01 d0             	add    %rdx,%rax
+  8042d2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8042d6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8042dd:	e9 84 00 00 00       	jmp    804366 <spawn+0x35e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8042e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042e6:	8b 00                	mov    (%rax),%eax
+  8042e8:	83 f8 01             	cmp    $0x1,%eax
+  8042eb:	75 6f                	jne    80435c <spawn+0x354>
+			continue;
+		perm = PTE_P | PTE_U;
+  8042ed:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8042f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042f8:	8b 40 04             	mov    0x4(%rax),%eax
+  8042fb:	83 e0 02             	and    $0x2,%eax
+  8042fe:	85 c0                	test   %eax,%eax
+  804300:	74 04                	je     804306 <spawn+0x2fe>
+			perm |= PTE_W;
+  804302:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+				     fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  804306:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80430a:	48 8b 40 08          	mov    0x8(%rax),%rax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  80430e:	41 89 c1             	mov    %eax,%r9d
+  804311:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804315:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  804319:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80431d:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  804321:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804325:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  804329:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80432c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80432f:	48 83 ec 08          	sub    $0x8,%rsp
+  804333:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  804336:	57                   	push   %rdi
+  804337:	89 c7                	mov    %eax,%edi
+  804339:	48 b8 70 ba ff ff ff 	movabs $0xffffffffffffba70,%rax
+  804340:	ff ff ff 
+  804343:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804347:	ff d0                	call   *%rax
+  804349:	48 83 c4 10          	add    $0x10,%rsp
+  80434d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804350:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804354:	0f 88 7c 01 00 00    	js     8044d6 <spawn+0x4ce>
+  80435a:	eb 01                	jmp    80435d <spawn+0x355>
+			continue;
+  80435c:	90                   	nop
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80435d:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804361:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  804366:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80436a:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  80436e:	0f b7 c0             	movzwl %ax,%eax
+  804371:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804374:	0f 8c 68 ff ff ff    	jl     8042e2 <spawn+0x2da>
+			goto error;
+	}
+	close(fd);
+  80437a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80437d:	89 c7                	mov    %eax,%edi
+  80437f:	49 89 df             	mov    %rbx,%r15
+  804382:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  804389:	ff ff ff 
+  80438c:	48 01 d8             	add    %rbx,%rax
+  80438f:	ff d0                	call   *%rax
+	fd = -1;
+  804391:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+	// Copy shared library state.
+	if ((r = copy_shared_pages(child)) < 0)
+  804398:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80439b:	89 c7                	mov    %eax,%edi
+  80439d:	48 b8 37 bf ff ff ff 	movabs $0xffffffffffffbf37,%rax
+  8043a4:	ff ff ff 
+  8043a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043ab:	ff d0                	call   *%rax
+  8043ad:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8043b0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8043b4:	79 44                	jns    8043fa <spawn+0x3f2>
+		panic("copy_shared_pages: %e", r);
+  8043b6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8043b9:	89 c1                	mov    %eax,%ecx
+  8043bb:	48 b8 22 e9 ff ff ff 	movabs $0xffffffffffffe922,%rax
+  8043c2:	ff ff ff 
+  8043c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043c9:	48 89 c2             	mov    %rax,%rdx
+  8043cc:	be 82 00 00 00       	mov    $0x82,%esi
+  8043d1:	48 b8 38 e9 ff ff ff 	movabs $0xffffffffffffe938,%rax
+  8043d8:	ff ff ff 
+  8043db:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043df:	48 89 c7             	mov    %rax,%rdi
+  8043e2:	49 89 df             	mov    %rbx,%r15
+  8043e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ea:	49 b8 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r8
+  8043f1:	ff ff ff 
+  8043f4:	49 01 d8             	add    %rbx,%r8
+  8043f7:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8043fa:	48 8d 95 00 fd ff ff 	lea    -0x300(%rbp),%rdx
+  804401:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804404:	48 89 d6             	mov    %rdx,%rsi
+  804407:	89 c7                	mov    %eax,%edi
+  804409:	49 89 df             	mov    %rbx,%r15
+  80440c:	48 b8 05 93 ff ff ff 	movabs $0xffffffffffff9305,%rax
+  804413:	ff ff ff 
+  804416:	48 01 d8             	add    %rbx,%rax
+  804419:	ff d0                	call   *%rax
+  80441b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80441e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804422:	79 44                	jns    804468 <spawn+0x460>
+		panic("sys_env_set_trapframe: %e", r);
+  804424:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804427:	89 c1                	mov    %eax,%ecx
+  804429:	48 b8 44 e9 ff ff ff 	movabs $0xffffffffffffe944,%rax
+  804430:	ff ff ff 
+  804433:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804437:	48 89 c2             	mov    %rax,%rdx
+  80443a:	be 85 00 00 00       	mov    $0x85,%esi
+  80443f:	48 b8 38 e9 ff ff ff 	movabs $0xffffffffffffe938,%rax
+  804446:	ff ff ff 
+  804449:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80444d:	48 89 c7             	mov    %rax,%rdi
+  804450:	49 89 df             	mov    %rbx,%r15
+  804453:	b8 00 00 00 00       	mov    $0x0,%eax
+  804458:	49 b8 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r8
+  80445f:	ff ff ff 
+  804462:	49 01 d8             	add    %rbx,%r8
+  804465:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  804468:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80446b:	be 02 00 00 00       	mov    $0x2,%esi
+  804470:	89 c7                	mov    %eax,%edi
+  804472:	49 89 df             	mov    %rbx,%r15
+  804475:	48 b8 a5 92 ff ff ff 	movabs $0xffffffffffff92a5,%rax
+  80447c:	ff ff ff 
+  80447f:	48 01 d8             	add    %rbx,%rax
+  804482:	ff d0                	call   *%rax
+  804484:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804487:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80448b:	79 44                	jns    8044d1 <spawn+0x4c9>
+		panic("sys_env_set_status: %e", r);
+  80448d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804490:	89 c1                	mov    %eax,%ecx
+  804492:	48 b8 5e e9 ff ff ff 	movabs $0xffffffffffffe95e,%rax
+  804499:	ff ff ff 
+  80449c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044a0:	48 89 c2             	mov    %rax,%rdx
+  8044a3:	be 88 00 00 00       	mov    $0x88,%esi
+  8044a8:	48 b8 38 e9 ff ff ff 	movabs $0xffffffffffffe938,%rax
+  8044af:	ff ff ff 
+  8044b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044b6:	48 89 c7             	mov    %rax,%rdi
+  8044b9:	49 89 df             	mov    %rbx,%r15
+  8044bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044c1:	49 b8 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r8
+  8044c8:	ff ff ff 
+  8044cb:	49 01 d8             	add    %rbx,%r8
+  8044ce:	41 ff d0             	call   *%r8
+
+	return child;
+  8044d1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8044d4:	eb 32                	jmp    804508 <spawn+0x500>
+			goto error;
+  8044d6:	90                   	nop
+
+error:
+	sys_env_destroy(child);
+  8044d7:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8044da:	89 c7                	mov    %eax,%edi
+  8044dc:	49 89 df             	mov    %rbx,%r15
+  8044df:	48 b8 69 90 ff ff ff 	movabs $0xffffffffffff9069,%rax
+  8044e6:	ff ff ff 
+  8044e9:	48 01 d8             	add    %rbx,%rax
+  8044ec:	ff d0                	call   *%rax
+	close(fd);
+  8044ee:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8044f1:	89 c7                	mov    %eax,%edi
+  8044f3:	49 89 df             	mov    %rbx,%r15
+  8044f6:	48 b8 d6 9c ff ff ff 	movabs $0xffffffffffff9cd6,%rax
+  8044fd:	ff ff ff 
+  804500:	48 01 d8             	add    %rbx,%rax
+  804503:	ff d0                	call   *%rax
+	return r;
+  804505:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  804508:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80450c:	5b                   	pop    %rbx
+  80450d:	41 5f                	pop    %r15
+  80450f:	5d                   	pop    %rbp
+  804510:	c3                   	ret
+
+0000000000804511 <spawnl>:
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...)
+{
+  804511:	55                   	push   %rbp
+  804512:	48 89 e5             	mov    %rsp,%rbp
+  804515:	41 57                	push   %r15
+  804517:	41 56                	push   %r14
+  804519:	41 55                	push   %r13
+  80451b:	41 54                	push   %r12
+  80451d:	53                   	push   %rbx
+  80451e:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804525:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804525 <spawnl+0x14>
+  80452c:	49 bb 13 4b 00 00 00 	movabs $0x4b13,%r11
+  804533:	00 00 00 
+  804536:	4d 01 da             	add    %r11,%r10
+  804539:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  804540:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  804547:	48 89 95 30 ff ff ff 	mov    %rdx,-0xd0(%rbp)
+  80454e:	48 89 8d 38 ff ff ff 	mov    %rcx,-0xc8(%rbp)
+  804555:	4c 89 85 40 ff ff ff 	mov    %r8,-0xc0(%rbp)
+  80455c:	4c 89 8d 48 ff ff ff 	mov    %r9,-0xb8(%rbp)
+  804563:	84 c0                	test   %al,%al
+  804565:	74 29                	je     804590 <spawnl+0x7f>
+  804567:	0f 29 85 50 ff ff ff 	movaps %xmm0,-0xb0(%rbp)
+  80456e:	0f 29 8d 60 ff ff ff 	movaps %xmm1,-0xa0(%rbp)
+  804575:	0f 29 95 70 ff ff ff 	movaps %xmm2,-0x90(%rbp)
+  80457c:	0f 29 5d 80          	movaps %xmm3,-0x80(%rbp)
+  804580:	0f 29 65 90          	movaps %xmm4,-0x70(%rbp)
+  804584:	0f 29 6d a0          	movaps %xmm5,-0x60(%rbp)
+  804588:	0f 29 75 b0          	movaps %xmm6,-0x50(%rbp)
+  80458c:	0f 29 7d c0          	movaps %xmm7,-0x40(%rbp)
+  804590:	48 89 e0             	mov    %rsp,%rax
+  804593:	48 89 c3             	mov    %rax,%rbx
+	// We calculate argc by advancing the args until we hit NULL.
+	// The contract of the function guarantees that the last
+	// argument will always be NULL, and that none of the other
+	// arguments will be NULL.
+	int argc=0;
+  804596:	c7 85 1c ff ff ff 00 	movl   $0x0,-0xe4(%rbp)
+  80459d:	00 00 00 
+	va_list vl;
+	va_start(vl, arg0);
+  8045a0:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  8045a7:	00 00 00 
+  8045aa:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  8045b1:	00 00 00 
+  8045b4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8045b8:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  8045bf:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  8045c6:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  8045cd:	eb 07                	jmp    8045d6 <spawnl+0xc5>
+		argc++;
+  8045cf:	83 85 1c ff ff ff 01 	addl   $0x1,-0xe4(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  8045d6:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8045dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8045df:	77 23                	ja     804604 <spawnl+0xf3>
+  8045e1:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  8045e8:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  8045ee:	89 d2                	mov    %edx,%edx
+  8045f0:	48 01 d0             	add    %rdx,%rax
+  8045f3:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  8045f9:	83 c2 08             	add    $0x8,%edx
+  8045fc:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  804602:	eb 12                	jmp    804616 <spawnl+0x105>
+  804604:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80460b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80460f:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  804616:	48 8b 00             	mov    (%rax),%rax
+  804619:	48 85 c0             	test   %rax,%rax
+  80461c:	75 b1                	jne    8045cf <spawnl+0xbe>
+	va_end(vl);
+
+	// Now that we have the size of the args, do a second pass
+	// and store the values in a VLA, which has the format of argv
+	const char *argv[argc+2];
+  80461e:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  804624:	83 c0 02             	add    $0x2,%eax
+  804627:	48 63 d0             	movslq %eax,%rdx
+  80462a:	48 83 ea 01          	sub    $0x1,%rdx
+  80462e:	48 89 95 10 ff ff ff 	mov    %rdx,-0xf0(%rbp)
+  804635:	48 63 d0             	movslq %eax,%rdx
+  804638:	49 89 d6             	mov    %rdx,%r14
+  80463b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  804641:	48 63 d0             	movslq %eax,%rdx
+  804644:	49 89 d4             	mov    %rdx,%r12
+  804647:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80464d:	48 98                	cltq
+  80464f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804656:	00 
+  804657:	b8 10 00 00 00       	mov    $0x10,%eax
+  80465c:	48 83 e8 01          	sub    $0x1,%rax
+  804660:	48 01 d0             	add    %rdx,%rax
+  804663:	be 10 00 00 00       	mov    $0x10,%esi
+  804668:	ba 00 00 00 00       	mov    $0x0,%edx
+  80466d:	48 f7 f6             	div    %rsi
+  804670:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  804674:	48 29 c4             	sub    %rax,%rsp
+  804677:	48 89 e0             	mov    %rsp,%rax
+  80467a:	48 83 c0 07          	add    $0x7,%rax
+  80467e:	48 c1 e8 03          	shr    $0x3,%rax
+  804682:	48 c1 e0 03          	shl    $0x3,%rax
+  804686:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+	argv[0] = arg0;
+  80468d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804694:	48 8b 95 e0 fe ff ff 	mov    -0x120(%rbp),%rdx
+  80469b:	48 89 10             	mov    %rdx,(%rax)
+	argv[argc+1] = NULL;
+  80469e:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  8046a4:	8d 50 01             	lea    0x1(%rax),%edx
+  8046a7:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8046ae:	48 63 d2             	movslq %edx,%rdx
+  8046b1:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  8046b8:	00 
+
+	va_start(vl, arg0);
+  8046b9:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  8046c0:	00 00 00 
+  8046c3:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  8046ca:	00 00 00 
+  8046cd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8046d1:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  8046d8:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  8046df:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	unsigned i;
+	for(i=0;i<argc;i++)
+  8046e6:	c7 85 18 ff ff ff 00 	movl   $0x0,-0xe8(%rbp)
+  8046ed:	00 00 00 
+  8046f0:	eb 60                	jmp    804752 <spawnl+0x241>
+		argv[i+1] = va_arg(vl, const char *);
+  8046f2:	8b 85 18 ff ff ff    	mov    -0xe8(%rbp),%eax
+  8046f8:	8d 48 01             	lea    0x1(%rax),%ecx
+  8046fb:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  804701:	83 f8 2f             	cmp    $0x2f,%eax
+  804704:	77 23                	ja     804729 <spawnl+0x218>
+  804706:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  80470d:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  804713:	89 d2                	mov    %edx,%edx
+  804715:	48 01 d0             	add    %rdx,%rax
+  804718:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  80471e:	83 c2 08             	add    $0x8,%edx
+  804721:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  804727:	eb 12                	jmp    80473b <spawnl+0x22a>
+  804729:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  804730:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804734:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80473b:	48 8b 10             	mov    (%rax),%rdx
+  80473e:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804745:	89 c9                	mov    %ecx,%ecx
+  804747:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+	for(i=0;i<argc;i++)
+  80474b:	83 85 18 ff ff ff 01 	addl   $0x1,-0xe8(%rbp)
+  804752:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  804758:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%rbp)
+  80475e:	72 92                	jb     8046f2 <spawnl+0x1e1>
+	va_end(vl);
+	return spawn(prog, argv);
+  804760:	48 8b 95 08 ff ff ff 	mov    -0xf8(%rbp),%rdx
+  804767:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  80476e:	48 89 d6             	mov    %rdx,%rsi
+  804771:	48 89 c7             	mov    %rax,%rdi
+  804774:	48 b8 d0 af ff ff ff 	movabs $0xffffffffffffafd0,%rax
+  80477b:	ff ff ff 
+  80477e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804782:	ff d0                	call   *%rax
+  804784:	48 89 dc             	mov    %rbx,%rsp
+}
+  804787:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80478b:	5b                   	pop    %rbx
+  80478c:	41 5c                	pop    %r12
+  80478e:	41 5d                	pop    %r13
+  804790:	41 5e                	pop    %r14
+  804792:	41 5f                	pop    %r15
+  804794:	5d                   	pop    %rbp
+  804795:	c3                   	ret
+
+0000000000804796 <init_stack>:
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp)
+{
+  804796:	55                   	push   %rbp
+  804797:	48 89 e5             	mov    %rsp,%rbp
+  80479a:	41 57                	push   %r15
+  80479c:	53                   	push   %rbx
+  80479d:	48 83 ec 50          	sub    $0x50,%rsp
+  8047a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047a1 <init_stack+0xb>
+  8047a8:	49 bb 97 48 00 00 00 	movabs $0x4897,%r11
+  8047af:	00 00 00 
+  8047b2:	4c 01 db             	add    %r11,%rbx
+  8047b5:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8047b8:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8047bc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *string_store;
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+  8047c0:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8047c7:	00 
+	for (argc = 0; argv[argc] != 0; argc++)
+  8047c8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  8047cf:	eb 39                	jmp    80480a <init_stack+0x74>
+		string_size += strlen(argv[argc]) + 1;
+  8047d1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8047d4:	48 98                	cltq
+  8047d6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8047dd:	00 
+  8047de:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8047e2:	48 01 d0             	add    %rdx,%rax
+  8047e5:	48 8b 00             	mov    (%rax),%rax
+  8047e8:	48 89 c7             	mov    %rax,%rdi
+  8047eb:	49 89 df             	mov    %rbx,%r15
+  8047ee:	48 b8 1e 84 ff ff ff 	movabs $0xffffffffffff841e,%rax
+  8047f5:	ff ff ff 
+  8047f8:	48 01 d8             	add    %rbx,%rax
+  8047fb:	ff d0                	call   *%rax
+  8047fd:	83 c0 01             	add    $0x1,%eax
+  804800:	48 98                	cltq
+  804802:	48 01 45 e8          	add    %rax,-0x18(%rbp)
+	for (argc = 0; argv[argc] != 0; argc++)
+  804806:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  80480a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80480d:	48 98                	cltq
+  80480f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804816:	00 
+  804817:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80481b:	48 01 d0             	add    %rdx,%rax
+  80481e:	48 8b 00             	mov    (%rax),%rax
+  804821:	48 85 c0             	test   %rax,%rax
+  804824:	75 ab                	jne    8047d1 <init_stack+0x3b>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  804826:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80482a:	48 f7 d8             	neg    %rax
+  80482d:	48 05 00 10 40 00    	add    $0x401000,%rax
+  804833:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  804837:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80483b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80483f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804843:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  804847:	48 89 c2             	mov    %rax,%rdx
+  80484a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80484d:	83 c0 01             	add    $0x1,%eax
+  804850:	c1 e0 03             	shl    $0x3,%eax
+  804853:	48 98                	cltq
+  804855:	48 f7 d8             	neg    %rax
+  804858:	48 01 d0             	add    %rdx,%rax
+  80485b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  80485f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804863:	48 83 e8 10          	sub    $0x10,%rax
+  804867:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  80486d:	77 0a                	ja     804879 <init_stack+0xe3>
+		return -E_NO_MEM;
+  80486f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  804874:	e9 26 02 00 00       	jmp    804a9f <init_stack+0x309>
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  804879:	ba 07 00 00 00       	mov    $0x7,%edx
+  80487e:	be 00 00 40 00       	mov    $0x400000,%esi
+  804883:	bf 00 00 00 00       	mov    $0x0,%edi
+  804888:	49 89 df             	mov    %rbx,%r15
+  80488b:	48 b8 6e 91 ff ff ff 	movabs $0xffffffffffff916e,%rax
+  804892:	ff ff ff 
+  804895:	48 01 d8             	add    %rbx,%rax
+  804898:	ff d0                	call   *%rax
+  80489a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80489d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8048a1:	79 08                	jns    8048ab <init_stack+0x115>
+		return r;
+  8048a3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048a6:	e9 f4 01 00 00       	jmp    804a9f <init_stack+0x309>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8048ab:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+  8048b2:	e9 96 00 00 00       	jmp    80494d <init_stack+0x1b7>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8048b7:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  8048bc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048c0:	48 01 d0             	add    %rdx,%rax
+  8048c3:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  8048ca:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8048cd:	48 98                	cltq
+  8048cf:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  8048d6:	00 
+  8048d7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048db:	48 01 c8             	add    %rcx,%rax
+  8048de:	48 89 10             	mov    %rdx,(%rax)
+		strcpy(string_store, argv[i]);
+  8048e1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8048e4:	48 98                	cltq
+  8048e6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8048ed:	00 
+  8048ee:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8048f2:	48 01 d0             	add    %rdx,%rax
+  8048f5:	48 8b 10             	mov    (%rax),%rdx
+  8048f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048fc:	48 89 d6             	mov    %rdx,%rsi
+  8048ff:	48 89 c7             	mov    %rax,%rdi
+  804902:	49 89 df             	mov    %rbx,%r15
+  804905:	48 b8 b2 84 ff ff ff 	movabs $0xffffffffffff84b2,%rax
+  80490c:	ff ff ff 
+  80490f:	48 01 d8             	add    %rbx,%rax
+  804912:	ff d0                	call   *%rax
+		string_store += strlen(argv[i]) + 1;
+  804914:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804917:	48 98                	cltq
+  804919:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804920:	00 
+  804921:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804925:	48 01 d0             	add    %rdx,%rax
+  804928:	48 8b 00             	mov    (%rax),%rax
+  80492b:	48 89 c7             	mov    %rax,%rdi
+  80492e:	49 89 df             	mov    %rbx,%r15
+  804931:	48 b8 1e 84 ff ff ff 	movabs $0xffffffffffff841e,%rax
+  804938:	ff ff ff 
+  80493b:	48 01 d8             	add    %rbx,%rax
+  80493e:	ff d0                	call   *%rax
+  804940:	83 c0 01             	add    $0x1,%eax
+  804943:	48 98                	cltq
+  804945:	48 01 45 d0          	add    %rax,-0x30(%rbp)
+	for (i = 0; i < argc; i++) {
+  804949:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+  80494d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804950:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804953:	0f 8c 5e ff ff ff    	jl     8048b7 <init_stack+0x121>
+	}
+	argv_store[argc] = 0;
+  804959:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80495c:	48 98                	cltq
+  80495e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804965:	00 
+  804966:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80496a:	48 01 d0             	add    %rdx,%rax
+  80496d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  804974:	48 81 7d d0 00 10 40 	cmpq   $0x401000,-0x30(%rbp)
+  80497b:	00 
+  80497c:	74 50                	je     8049ce <init_stack+0x238>
+  80497e:	48 b8 78 e9 ff ff ff 	movabs $0xffffffffffffe978,%rax
+  804985:	ff ff ff 
+  804988:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80498c:	48 89 c1             	mov    %rax,%rcx
+  80498f:	48 b8 9e e9 ff ff ff 	movabs $0xffffffffffffe99e,%rax
+  804996:	ff ff ff 
+  804999:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80499d:	48 89 c2             	mov    %rax,%rdx
+  8049a0:	be f1 00 00 00       	mov    $0xf1,%esi
+  8049a5:	48 b8 38 e9 ff ff ff 	movabs $0xffffffffffffe938,%rax
+  8049ac:	ff ff ff 
+  8049af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049b3:	48 89 c7             	mov    %rax,%rdi
+  8049b6:	49 89 df             	mov    %rbx,%r15
+  8049b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049be:	49 b8 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r8
+  8049c5:	ff ff ff 
+  8049c8:	49 01 d8             	add    %rbx,%r8
+  8049cb:	41 ff d0             	call   *%r8
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8049ce:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  8049d3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049d7:	48 01 d0             	add    %rdx,%rax
+  8049da:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  8049e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049e5:	48 83 e8 08          	sub    $0x8,%rax
+  8049e9:	48 89 10             	mov    %rdx,(%rax)
+	argv_store[-2] = argc;
+  8049ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049f0:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  8049f4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8049f7:	48 98                	cltq
+  8049f9:	48 89 02             	mov    %rax,(%rdx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8049fc:	ba f0 cf 7f ef       	mov    $0xef7fcff0,%edx
+  804a01:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a05:	48 01 d0             	add    %rdx,%rax
+  804a08:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  804a0e:	48 89 c2             	mov    %rax,%rdx
+  804a11:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804a15:	48 89 10             	mov    %rdx,(%rax)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  804a18:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804a1b:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  804a21:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  804a26:	48 89 d1             	mov    %rdx,%rcx
+  804a29:	89 c2                	mov    %eax,%edx
+  804a2b:	be 00 00 40 00       	mov    $0x400000,%esi
+  804a30:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a35:	49 89 df             	mov    %rbx,%r15
+  804a38:	48 b8 d3 91 ff ff ff 	movabs $0xffffffffffff91d3,%rax
+  804a3f:	ff ff ff 
+  804a42:	48 01 d8             	add    %rbx,%rax
+  804a45:	ff d0                	call   *%rax
+  804a47:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a4a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a4e:	78 2c                	js     804a7c <init_stack+0x2e6>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  804a50:	be 00 00 40 00       	mov    $0x400000,%esi
+  804a55:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a5a:	49 89 df             	mov    %rbx,%r15
+  804a5d:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  804a64:	ff ff ff 
+  804a67:	48 01 d8             	add    %rbx,%rax
+  804a6a:	ff d0                	call   *%rax
+  804a6c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804a6f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804a73:	78 0a                	js     804a7f <init_stack+0x2e9>
+		goto error;
+
+	return 0;
+  804a75:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a7a:	eb 23                	jmp    804a9f <init_stack+0x309>
+		goto error;
+  804a7c:	90                   	nop
+  804a7d:	eb 01                	jmp    804a80 <init_stack+0x2ea>
+		goto error;
+  804a7f:	90                   	nop
+
+error:
+	sys_page_unmap(0, UTEMP);
+  804a80:	be 00 00 40 00       	mov    $0x400000,%esi
+  804a85:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a8a:	49 89 df             	mov    %rbx,%r15
+  804a8d:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  804a94:	ff ff ff 
+  804a97:	48 01 d8             	add    %rbx,%rax
+  804a9a:	ff d0                	call   *%rax
+	return r;
+  804a9c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+}
+  804a9f:	48 83 c4 50          	add    $0x50,%rsp
+  804aa3:	5b                   	pop    %rbx
+  804aa4:	41 5f                	pop    %r15
+  804aa6:	5d                   	pop    %rbp
+  804aa7:	c3                   	ret
+
+0000000000804aa8 <map_segment>:
+#define SEG_BATCH	PAGE_BATCH_CHUNK
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+	    int fd, size_t filesz, off_t fileoffset, int perm)
+{
+  804aa8:	55                   	push   %rbp
+  804aa9:	48 89 e5             	mov    %rsp,%rbp
+  804aac:	41 57                	push   %r15
+  804aae:	53                   	push   %rbx
+  804aaf:	48 81 ec 70 0c 00 00 	sub    $0xc70,%rsp
+  804ab6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ab6 <map_segment+0xe>
+  804abd:	49 bb 82 45 00 00 00 	movabs $0x4582,%r11
+  804ac4:	00 00 00 
+  804ac7:	4c 01 db             	add    %r11,%rbx
+  804aca:	89 bd ac f3 ff ff    	mov    %edi,-0xc54(%rbp)
+  804ad0:	48 89 b5 a0 f3 ff ff 	mov    %rsi,-0xc60(%rbp)
+  804ad7:	48 89 95 98 f3 ff ff 	mov    %rdx,-0xc68(%rbp)
+  804ade:	89 8d a8 f3 ff ff    	mov    %ecx,-0xc58(%rbp)
+  804ae4:	4c 89 85 90 f3 ff ff 	mov    %r8,-0xc70(%rbp)
+  804aeb:	44 89 8d 8c f3 ff ff 	mov    %r9d,-0xc74(%rbp)
+	int i, j, n, nfile, r;
+	void *tmp;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  804af2:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  804af9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804afe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b01:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b05:	74 2d                	je     804b34 <map_segment+0x8c>
+		va -= i;
+  804b07:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b0a:	48 98                	cltq
+  804b0c:	48 29 85 a0 f3 ff ff 	sub    %rax,-0xc60(%rbp)
+		memsz += i;
+  804b13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b16:	48 98                	cltq
+  804b18:	48 01 85 98 f3 ff ff 	add    %rax,-0xc68(%rbp)
+		filesz += i;
+  804b1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b22:	48 98                	cltq
+  804b24:	48 01 85 90 f3 ff ff 	add    %rax,-0xc70(%rbp)
+		fileoffset -= i;
+  804b2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b2e:	29 85 8c f3 ff ff    	sub    %eax,-0xc74(%rbp)
+	}
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  804b34:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804b3b:	e9 db 03 00 00       	jmp    804f1b <map_segment+0x473>
+		n = MIN((memsz - i + PGSIZE - 1) / PGSIZE, SEG_BATCH);
+  804b40:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b43:	48 98                	cltq
+  804b45:	48 8b 95 98 f3 ff ff 	mov    -0xc68(%rbp),%rdx
+  804b4c:	48 29 c2             	sub    %rax,%rdx
+  804b4f:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  804b56:	48 c1 e8 0c          	shr    $0xc,%rax
+  804b5a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804b5e:	c7 45 d4 20 00 00 00 	movl   $0x20,-0x2c(%rbp)
+  804b65:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804b68:	48 63 d0             	movslq %eax,%rdx
+  804b6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b6f:	48 39 c2             	cmp    %rax,%rdx
+  804b72:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804b76:	89 45 d0             	mov    %eax,-0x30(%rbp)
+
+		// Allocate blank pages straight into the child, and pages
+		// for the file's contents at UTEMP in our address space.
+		nfile = 0;
+  804b79:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+		for (j = 0; j < n; j++) {
+  804b80:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  804b87:	e9 ea 01 00 00       	jmp    804d76 <map_segment+0x2ce>
+			if (i + j * PGSIZE < filesz) {
+  804b8c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b8f:	c1 e0 0c             	shl    $0xc,%eax
+  804b92:	89 c2                	mov    %eax,%edx
+  804b94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b97:	01 d0                	add    %edx,%eax
+  804b99:	48 98                	cltq
+  804b9b:	48 3b 85 90 f3 ff ff 	cmp    -0xc70(%rbp),%rax
+  804ba2:	0f 83 57 01 00 00    	jae    804cff <map_segment+0x257>
+				tmp = UTEMP + nfile * PGSIZE;
+  804ba8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804bab:	c1 e0 0c             	shl    $0xc,%eax
+  804bae:	48 98                	cltq
+  804bb0:	48 05 00 00 40 00    	add    $0x400000,%rax
+  804bb6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+				alloc[j].dstenvid = 0;
+  804bba:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bbd:	48 98                	cltq
+  804bbf:	48 c1 e0 05          	shl    $0x5,%rax
+  804bc3:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804bc7:	48 01 e8             	add    %rbp,%rax
+  804bca:	48 2d 3c 04 00 00    	sub    $0x43c,%rax
+  804bd0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				alloc[j].dstva = (uintptr_t) tmp;
+  804bd6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804bda:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804bdd:	48 63 d2             	movslq %edx,%rdx
+  804be0:	48 c1 e2 05          	shl    $0x5,%rdx
+  804be4:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  804be8:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  804bec:	48 81 ea 30 04 00 00 	sub    $0x430,%rdx
+  804bf3:	48 89 02             	mov    %rax,(%rdx)
+				alloc[j].perm = PTE_P|PTE_U|PTE_W;
+  804bf6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bf9:	48 98                	cltq
+  804bfb:	48 c1 e0 05          	shl    $0x5,%rax
+  804bff:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804c03:	48 01 e8             	add    %rbp,%rax
+  804c06:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  804c0c:	c7 00 07 00 00 00    	movl   $0x7,(%rax)
+				map[nfile].srcenvid = 0;
+  804c12:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c15:	48 98                	cltq
+  804c17:	48 c1 e0 05          	shl    $0x5,%rax
+  804c1b:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804c1f:	48 01 e8             	add    %rbp,%rax
+  804c22:	48 2d 40 08 00 00    	sub    $0x840,%rax
+  804c28:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				map[nfile].srcva = (uintptr_t) tmp;
+  804c2e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804c32:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804c35:	48 63 d2             	movslq %edx,%rdx
+  804c38:	48 c1 e2 05          	shl    $0x5,%rdx
+  804c3c:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  804c40:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  804c44:	48 81 ea 38 08 00 00 	sub    $0x838,%rdx
+  804c4b:	48 89 02             	mov    %rax,(%rdx)
+				map[nfile].dstenvid = child;
+  804c4e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c51:	48 98                	cltq
+  804c53:	48 c1 e0 05          	shl    $0x5,%rax
+  804c57:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804c5b:	48 01 e8             	add    %rbp,%rax
+  804c5e:	48 8d 90 c4 f7 ff ff 	lea    -0x83c(%rax),%rdx
+  804c65:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  804c6b:	89 02                	mov    %eax,(%rdx)
+				map[nfile].dstva = va + i + j * PGSIZE;
+  804c6d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c70:	48 63 d0             	movslq %eax,%rdx
+  804c73:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  804c7a:	48 01 c2             	add    %rax,%rdx
+  804c7d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c80:	c1 e0 0c             	shl    $0xc,%eax
+  804c83:	48 98                	cltq
+  804c85:	48 01 c2             	add    %rax,%rdx
+  804c88:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c8b:	48 98                	cltq
+  804c8d:	48 c1 e0 05          	shl    $0x5,%rax
+  804c91:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804c95:	48 01 e8             	add    %rbp,%rax
+  804c98:	48 2d 30 08 00 00    	sub    $0x830,%rax
+  804c9e:	48 89 10             	mov    %rdx,(%rax)
+				map[nfile].perm = perm;
+  804ca1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ca4:	48 98                	cltq
+  804ca6:	48 c1 e0 05          	shl    $0x5,%rax
+  804caa:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804cae:	48 01 e8             	add    %rbp,%rax
+  804cb1:	48 8d 90 d8 f7 ff ff 	lea    -0x828(%rax),%rdx
+  804cb8:	8b 45 10             	mov    0x10(%rbp),%eax
+  804cbb:	89 02                	mov    %eax,(%rdx)
+				unmap[nfile].dstenvid = 0;
+  804cbd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804cc0:	48 98                	cltq
+  804cc2:	48 c1 e0 05          	shl    $0x5,%rax
+  804cc6:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804cca:	48 01 e8             	add    %rbp,%rax
+  804ccd:	48 2d 3c 0c 00 00    	sub    $0xc3c,%rax
+  804cd3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				unmap[nfile].dstva = (uintptr_t) tmp;
+  804cd9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804cdd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804ce0:	48 63 d2             	movslq %edx,%rdx
+  804ce3:	48 c1 e2 05          	shl    $0x5,%rdx
+  804ce7:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  804ceb:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  804cef:	48 81 ea 30 0c 00 00 	sub    $0xc30,%rdx
+  804cf6:	48 89 02             	mov    %rax,(%rdx)
+				nfile++;
+  804cf9:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  804cfd:	eb 73                	jmp    804d72 <map_segment+0x2ca>
+			} else {
+				// Blank (BSS) pages are only allocated
+				// once the child writes to them.
+				alloc[j].dstenvid = child;
+  804cff:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d02:	48 98                	cltq
+  804d04:	48 c1 e0 05          	shl    $0x5,%rax
+  804d08:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804d0c:	48 01 e8             	add    %rbp,%rax
+  804d0f:	48 8d 90 c4 fb ff ff 	lea    -0x43c(%rax),%rdx
+  804d16:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  804d1c:	89 02                	mov    %eax,(%rdx)
+				alloc[j].dstva = va + i + j * PGSIZE;
+  804d1e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d21:	48 63 d0             	movslq %eax,%rdx
+  804d24:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  804d2b:	48 01 c2             	add    %rax,%rdx
+  804d2e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d31:	c1 e0 0c             	shl    $0xc,%eax
+  804d34:	48 98                	cltq
+  804d36:	48 01 c2             	add    %rax,%rdx
+  804d39:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d3c:	48 98                	cltq
+  804d3e:	48 c1 e0 05          	shl    $0x5,%rax
+  804d42:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804d46:	48 01 e8             	add    %rbp,%rax
+  804d49:	48 2d 30 04 00 00    	sub    $0x430,%rax
+  804d4f:	48 89 10             	mov    %rdx,(%rax)
+				alloc[j].perm = perm | PTE_LAZY;
+  804d52:	8b 45 10             	mov    0x10(%rbp),%eax
+  804d55:	80 cc 10             	or     $0x10,%ah
+  804d58:	89 c2                	mov    %eax,%edx
+  804d5a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d5d:	48 98                	cltq
+  804d5f:	48 c1 e0 05          	shl    $0x5,%rax
+  804d63:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804d67:	48 01 e8             	add    %rbp,%rax
+  804d6a:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  804d70:	89 10                	mov    %edx,(%rax)
+		for (j = 0; j < n; j++) {
+  804d72:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  804d76:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d79:	3b 45 d0             	cmp    -0x30(%rbp),%eax
+  804d7c:	0f 8c 0a fe ff ff    	jl     804b8c <map_segment+0xe4>
+			}
+		}
+		if ((r = sys_page_alloc_batch(alloc, n)) < 0)
+  804d82:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  804d85:	48 63 d0             	movslq %eax,%rdx
+  804d88:	48 8d 85 b0 fb ff ff 	lea    -0x450(%rbp),%rax
+  804d8f:	48 89 d6             	mov    %rdx,%rsi
+  804d92:	48 89 c7             	mov    %rax,%rdi
+  804d95:	49 89 df             	mov    %rbx,%r15
+  804d98:	48 b8 07 98 ff ff ff 	movabs $0xffffffffffff9807,%rax
+  804d9f:	ff ff ff 
+  804da2:	48 01 d8             	add    %rbx,%rax
+  804da5:	ff d0                	call   *%rax
+  804da7:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  804daa:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804dae:	0f 88 80 01 00 00    	js     804f34 <map_segment+0x48c>
+			goto out;
+
+		// from file
+		for (j = 0; j < nfile; j++) {
+  804db4:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  804dbb:	e9 af 00 00 00       	jmp    804e6f <map_segment+0x3c7>
+			if ((r = seek(fd, fileoffset + i + j * PGSIZE)) < 0)
+  804dc0:	8b 95 8c f3 ff ff    	mov    -0xc74(%rbp),%edx
+  804dc6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dc9:	01 c2                	add    %eax,%edx
+  804dcb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804dce:	c1 e0 0c             	shl    $0xc,%eax
+  804dd1:	01 c2                	add    %eax,%edx
+  804dd3:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  804dd9:	89 d6                	mov    %edx,%esi
+  804ddb:	89 c7                	mov    %eax,%edi
+  804ddd:	49 89 df             	mov    %rbx,%r15
+  804de0:	48 b8 46 a2 ff ff ff 	movabs $0xffffffffffffa246,%rax
+  804de7:	ff ff ff 
+  804dea:	48 01 d8             	add    %rbx,%rax
+  804ded:	ff d0                	call   *%rax
+  804def:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  804df2:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804df6:	0f 88 3b 01 00 00    	js     804f37 <map_segment+0x48f>
+				goto out;
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+				       MIN(PGSIZE, filesz - i - j * PGSIZE))) < 0)
+  804dfc:	c7 45 cc 00 10 00 00 	movl   $0x1000,-0x34(%rbp)
+  804e03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e06:	48 98                	cltq
+  804e08:	48 8b 95 90 f3 ff ff 	mov    -0xc70(%rbp),%rdx
+  804e0f:	48 29 c2             	sub    %rax,%rdx
+  804e12:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e15:	c1 e0 0c             	shl    $0xc,%eax
+  804e18:	48 98                	cltq
+  804e1a:	48 29 c2             	sub    %rax,%rdx
+  804e1d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804e21:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804e24:	48 63 d0             	movslq %eax,%rdx
+  804e27:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e2b:	48 39 c2             	cmp    %rax,%rdx
+  804e2e:	48 0f 47 d0          	cmova  %rax,%rdx
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+  804e32:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e35:	c1 e0 0c             	shl    $0xc,%eax
+  804e38:	48 98                	cltq
+  804e3a:	48 8d 88 00 00 40 00 	lea    0x400000(%rax),%rcx
+  804e41:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  804e47:	48 89 ce             	mov    %rcx,%rsi
+  804e4a:	89 c7                	mov    %eax,%edi
+  804e4c:	49 89 df             	mov    %rbx,%r15
+  804e4f:	48 b8 a1 a0 ff ff ff 	movabs $0xffffffffffffa0a1,%rax
+  804e56:	ff ff ff 
+  804e59:	48 01 d8             	add    %rbx,%rax
+  804e5c:	ff d0                	call   *%rax
+  804e5e:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  804e61:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804e65:	0f 88 cf 00 00 00    	js     804f3a <map_segment+0x492>
+		for (j = 0; j < nfile; j++) {
+  804e6b:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  804e6f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e72:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804e75:	0f 8c 45 ff ff ff    	jl     804dc0 <map_segment+0x318>
+				goto out;
+		}
+		if ((r = sys_page_map_batch(map, nfile)) < 0)
+  804e7b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e7e:	48 63 d0             	movslq %eax,%rdx
+  804e81:	48 8d 85 b0 f7 ff ff 	lea    -0x850(%rbp),%rax
+  804e88:	48 89 d6             	mov    %rdx,%rsi
+  804e8b:	48 89 c7             	mov    %rax,%rdi
+  804e8e:	49 89 df             	mov    %rbx,%r15
+  804e91:	48 b8 a9 97 ff ff ff 	movabs $0xffffffffffff97a9,%rax
+  804e98:	ff ff ff 
+  804e9b:	48 01 d8             	add    %rbx,%rax
+  804e9e:	ff d0                	call   *%rax
+  804ea0:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  804ea3:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804ea7:	79 44                	jns    804eed <map_segment+0x445>
+			panic("spawn: sys_page_map_batch data: %e", r);
+  804ea9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804eac:	89 c1                	mov    %eax,%ecx
+  804eae:	48 b8 b8 e9 ff ff ff 	movabs $0xffffffffffffe9b8,%rax
+  804eb5:	ff ff ff 
+  804eb8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ebc:	48 89 c2             	mov    %rax,%rdx
+  804ebf:	be 43 01 00 00       	mov    $0x143,%esi
+  804ec4:	48 b8 38 e9 ff ff ff 	movabs $0xffffffffffffe938,%rax
+  804ecb:	ff ff ff 
+  804ece:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ed2:	48 89 c7             	mov    %rax,%rdi
+  804ed5:	49 89 df             	mov    %rbx,%r15
+  804ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804edd:	49 b8 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r8
+  804ee4:	ff ff ff 
+  804ee7:	49 01 d8             	add    %rbx,%r8
+  804eea:	41 ff d0             	call   *%r8
+		sys_page_unmap_batch(unmap, nfile);
+  804eed:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ef0:	48 63 d0             	movslq %eax,%rdx
+  804ef3:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  804efa:	48 89 d6             	mov    %rdx,%rsi
+  804efd:	48 89 c7             	mov    %rax,%rdi
+  804f00:	49 89 df             	mov    %rbx,%r15
+  804f03:	48 b8 65 98 ff ff ff 	movabs $0xffffffffffff9865,%rax
+  804f0a:	ff ff ff 
+  804f0d:	48 01 d8             	add    %rbx,%rax
+  804f10:	ff d0                	call   *%rax
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  804f12:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  804f15:	c1 e0 0c             	shl    $0xc,%eax
+  804f18:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804f1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f1e:	48 98                	cltq
+  804f20:	48 3b 85 98 f3 ff ff 	cmp    -0xc68(%rbp),%rax
+  804f27:	0f 82 13 fc ff ff    	jb     804b40 <map_segment+0x98>
+	}
+	return 0;
+  804f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f32:	eb 2f                	jmp    804f63 <map_segment+0x4bb>
+			goto out;
+  804f34:	90                   	nop
+  804f35:	eb 04                	jmp    804f3b <map_segment+0x493>
+				goto out;
+  804f37:	90                   	nop
+  804f38:	eb 01                	jmp    804f3b <map_segment+0x493>
+				goto out;
+  804f3a:	90                   	nop
+
+out:
+	sys_page_unmap_batch(unmap, nfile);
+  804f3b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804f3e:	48 63 d0             	movslq %eax,%rdx
+  804f41:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  804f48:	48 89 d6             	mov    %rdx,%rsi
+  804f4b:	48 89 c7             	mov    %rax,%rdi
+  804f4e:	49 89 df             	mov    %rbx,%r15
+  804f51:	48 b8 65 98 ff ff ff 	movabs $0xffffffffffff9865,%rax
+  804f58:	ff ff ff 
+  804f5b:	48 01 d8             	add    %rbx,%rax
+  804f5e:	ff d0                	call   *%rax
+	return r;
+  804f60:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  804f63:	48 81 c4 70 0c 00 00 	add    $0xc70,%rsp
+  804f6a:	5b                   	pop    %rbx
+  804f6b:	41 5f                	pop    %r15
+  804f6d:	5d                   	pop    %rbp
+  804f6e:	c3                   	ret
+
+0000000000804f6f <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  804f6f:	55                   	push   %rbp
+  804f70:	48 89 e5             	mov    %rsp,%rbp
+  804f73:	41 57                	push   %r15
+  804f75:	53                   	push   %rbx
+  804f76:	48 83 ec 30          	sub    $0x30,%rsp
+  804f7a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f7a <copy_shared_pages+0xb>
+  804f81:	49 bb be 40 00 00 00 	movabs $0x40be,%r11
+  804f88:	00 00 00 
+  804f8b:	4c 01 db             	add    %r11,%rbx
+  804f8e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	int r;
+	uint64_t addr = 0;
+  804f91:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804f98:	00 
+	for (; addr < USTACKTOP;){
+  804f99:	e9 7f 02 00 00       	jmp    80521d <copy_shared_pages+0x2ae>
+		if (uvpde[VPDPE(addr)] & PTE_P){
+  804f9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fa2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804fa6:	48 89 c2             	mov    %rax,%rdx
+  804fa9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804fb0:	ff ff ff 
+  804fb3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804fb7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fbb:	83 e0 01             	and    $0x1,%eax
+  804fbe:	48 85 c0             	test   %rax,%rax
+  804fc1:	0f 84 4e 02 00 00    	je     805215 <copy_shared_pages+0x2a6>
+			//a 2MB page is described by its PDE, not by uvpt
+			if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  804fc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fcb:	48 c1 e8 15          	shr    $0x15,%rax
+  804fcf:	48 89 c2             	mov    %rax,%rdx
+  804fd2:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  804fd9:	ff ff ff 
+  804fdc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804fe0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fe4:	25 81 00 00 00       	and    $0x81,%eax
+  804fe9:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  804fef:	0f 85 cf 00 00 00    	jne    8050c4 <copy_shared_pages+0x155>
+				if (uvpd[VPD(addr)] & PTE_SHARE){
+  804ff5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff9:	48 c1 e8 15          	shr    $0x15,%rax
+  804ffd:	48 89 c2             	mov    %rax,%rdx
+  805000:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  805007:	ff ff ff 
+  80500a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80500e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805012:	25 00 04 00 00       	and    $0x400,%eax
+  805017:	48 85 c0             	test   %rax,%rax
+  80501a:	0f 84 97 00 00 00    	je     8050b7 <copy_shared_pages+0x148>
+					unsigned int perm = uvpd[VPD(addr)] & (PTE_SYSCALL);
+  805020:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805024:	48 c1 e8 15          	shr    $0x15,%rax
+  805028:	48 89 c2             	mov    %rax,%rdx
+  80502b:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  805032:	ff ff ff 
+  805035:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805039:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80503d:	25 07 0e 00 00       	and    $0xe07,%eax
+  805042:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  805045:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  805048:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80504c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805050:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  805053:	41 89 f0             	mov    %esi,%r8d
+  805056:	48 89 c6             	mov    %rax,%rsi
+  805059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80505e:	49 89 df             	mov    %rbx,%r15
+  805061:	48 b8 d3 91 ff ff ff 	movabs $0xffffffffffff91d3,%rax
+  805068:	ff ff ff 
+  80506b:	48 01 d8             	add    %rbx,%rax
+  80506e:	ff d0                	call   *%rax
+  805070:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  805073:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805077:	79 3e                	jns    8050b7 <copy_shared_pages+0x148>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  805079:	48 b8 e0 e9 ff ff ff 	movabs $0xffffffffffffe9e0,%rax
+  805080:	ff ff ff 
+  805083:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805087:	48 89 c2             	mov    %rax,%rdx
+  80508a:	be 5b 01 00 00       	mov    $0x15b,%esi
+  80508f:	48 b8 38 e9 ff ff ff 	movabs $0xffffffffffffe938,%rax
+  805096:	ff ff ff 
+  805099:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80509d:	48 89 c7             	mov    %rax,%rdi
+  8050a0:	49 89 df             	mov    %rbx,%r15
+  8050a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050a8:	48 b9 19 74 ff ff ff 	movabs $0xffffffffffff7419,%rcx
+  8050af:	ff ff ff 
+  8050b2:	48 01 d9             	add    %rbx,%rcx
+  8050b5:	ff d1                	call   *%rcx
+				}
+				addr += PTSIZE;
+  8050b7:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8050be:	00 
+  8050bf:	e9 59 01 00 00       	jmp    80521d <copy_shared_pages+0x2ae>
+			}
+			else if (uvpd[VPD(addr)] & PTE_P){
+  8050c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050c8:	48 c1 e8 15          	shr    $0x15,%rax
+  8050cc:	48 89 c2             	mov    %rax,%rdx
+  8050cf:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8050d6:	ff ff ff 
+  8050d9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8050dd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8050e1:	83 e0 01             	and    $0x1,%eax
+  8050e4:	48 85 c0             	test   %rax,%rax
+  8050e7:	0f 84 1e 01 00 00    	je     80520b <copy_shared_pages+0x29c>
+				if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_SHARE && uvpt[VPN(addr)] & PTE_U){
+  8050ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050f1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8050f5:	48 89 c2             	mov    %rax,%rdx
+  8050f8:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8050ff:	ff ff ff 
+  805102:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805106:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80510a:	83 e0 01             	and    $0x1,%eax
+  80510d:	48 85 c0             	test   %rax,%rax
+  805110:	0f 84 eb 00 00 00    	je     805201 <copy_shared_pages+0x292>
+  805116:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80511a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80511e:	48 89 c2             	mov    %rax,%rdx
+  805121:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805128:	ff ff ff 
+  80512b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80512f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805133:	25 00 04 00 00       	and    $0x400,%eax
+  805138:	48 85 c0             	test   %rax,%rax
+  80513b:	0f 84 c0 00 00 00    	je     805201 <copy_shared_pages+0x292>
+  805141:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805145:	48 c1 e8 0c          	shr    $0xc,%rax
+  805149:	48 89 c2             	mov    %rax,%rdx
+  80514c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805153:	ff ff ff 
+  805156:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80515a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80515e:	83 e0 04             	and    $0x4,%eax
+  805161:	48 85 c0             	test   %rax,%rax
+  805164:	0f 84 97 00 00 00    	je     805201 <copy_shared_pages+0x292>
+					unsigned int perm = uvpt[VPN(addr)] & (PTE_SYSCALL);
+  80516a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80516e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805172:	48 89 c2             	mov    %rax,%rdx
+  805175:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80517c:	ff ff ff 
+  80517f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805183:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805187:	25 07 0e 00 00       	and    $0xe07,%eax
+  80518c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  80518f:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  805192:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805196:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80519a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80519d:	41 89 f0             	mov    %esi,%r8d
+  8051a0:	48 89 c6             	mov    %rax,%rsi
+  8051a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051a8:	49 89 df             	mov    %rbx,%r15
+  8051ab:	48 b8 d3 91 ff ff ff 	movabs $0xffffffffffff91d3,%rax
+  8051b2:	ff ff ff 
+  8051b5:	48 01 d8             	add    %rbx,%rax
+  8051b8:	ff d0                	call   *%rax
+  8051ba:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  8051bd:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8051c1:	79 3e                	jns    805201 <copy_shared_pages+0x292>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  8051c3:	48 b8 e0 e9 ff ff ff 	movabs $0xffffffffffffe9e0,%rax
+  8051ca:	ff ff ff 
+  8051cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051d1:	48 89 c2             	mov    %rax,%rdx
+  8051d4:	be 64 01 00 00       	mov    $0x164,%esi
+  8051d9:	48 b8 38 e9 ff ff ff 	movabs $0xffffffffffffe938,%rax
+  8051e0:	ff ff ff 
+  8051e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051e7:	48 89 c7             	mov    %rax,%rdi
+  8051ea:	49 89 df             	mov    %rbx,%r15
+  8051ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f2:	48 b9 19 74 ff ff ff 	movabs $0xffffffffffff7419,%rcx
+  8051f9:	ff ff ff 
+  8051fc:	48 01 d9             	add    %rbx,%rcx
+  8051ff:	ff d1                	call   *%rcx
+				}
+				addr += PGSIZE;
+  805201:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  805208:	00 
+  805209:	eb 12                	jmp    80521d <copy_shared_pages+0x2ae>
+			}
+			//we will discover a PDE not present is at 
+			//a multiple of PTSIZE;
+			else {
+				addr += PTSIZE;
+  80520b:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  805212:	00 
+  805213:	eb 08                	jmp    80521d <copy_shared_pages+0x2ae>
+			}
+		}
+		//we will discover a PDPE not present is at
+		//a multiple of PTSIZE * NPDENTRIES;    
+		else {
+			addr += PTSIZE * NPDENTRIES;
+  805215:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  80521c:	40 
+	for (; addr < USTACKTOP;){
+  80521d:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  805222:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  805226:	0f 83 72 fd ff ff    	jae    804f9e <copy_shared_pages+0x2f>
+        	}
+        }
+
+	return 0;
+  80522c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805231:	48 83 c4 30          	add    $0x30,%rsp
+  805235:	5b                   	pop    %rbx
+  805236:	41 5f                	pop    %r15
+  805238:	5d                   	pop    %rbp
+  805239:	c3                   	ret
+
+000000000080523a <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  80523a:	55                   	push   %rbp
+  80523b:	48 89 e5             	mov    %rsp,%rbp
+  80523e:	41 57                	push   %r15
+  805240:	53                   	push   %rbx
+  805241:	48 83 ec 20          	sub    $0x20,%rsp
+  805245:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805245 <fd2sockid+0xb>
+  80524c:	49 bb f3 3d 00 00 00 	movabs $0x3df3,%r11
+  805253:	00 00 00 
+  805256:	4c 01 db             	add    %r11,%rbx
+  805259:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80525c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805260:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805263:	48 89 d6             	mov    %rdx,%rsi
+  805266:	89 c7                	mov    %eax,%edi
+  805268:	49 89 df             	mov    %rbx,%r15
+  80526b:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  805272:	ff ff ff 
+  805275:	48 01 d8             	add    %rbx,%rax
+  805278:	ff d0                	call   *%rax
+  80527a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80527d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805281:	79 05                	jns    805288 <fd2sockid+0x4e>
+		return r;
+  805283:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805286:	eb 25                	jmp    8052ad <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805288:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80528c:	8b 10                	mov    (%rax),%edx
+  80528e:	48 b8 88 00 00 00 00 	movabs $0x88,%rax
+  805295:	00 00 00 
+  805298:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80529b:	39 c2                	cmp    %eax,%edx
+  80529d:	74 07                	je     8052a6 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80529f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8052a4:	eb 07                	jmp    8052ad <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8052a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052aa:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8052ad:	48 83 c4 20          	add    $0x20,%rsp
+  8052b1:	5b                   	pop    %rbx
+  8052b2:	41 5f                	pop    %r15
+  8052b4:	5d                   	pop    %rbp
+  8052b5:	c3                   	ret
+
+00000000008052b6 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8052b6:	55                   	push   %rbp
+  8052b7:	48 89 e5             	mov    %rsp,%rbp
+  8052ba:	41 57                	push   %r15
+  8052bc:	53                   	push   %rbx
+  8052bd:	48 83 ec 20          	sub    $0x20,%rsp
+  8052c1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052c1 <alloc_sockfd+0xb>
+  8052c8:	49 bb 77 3d 00 00 00 	movabs $0x3d77,%r11
+  8052cf:	00 00 00 
+  8052d2:	4c 01 db             	add    %r11,%rbx
+  8052d5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8052d8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8052dc:	48 89 c7             	mov    %rax,%rdi
+  8052df:	49 89 df             	mov    %rbx,%r15
+  8052e2:	48 b8 91 99 ff ff ff 	movabs $0xffffffffffff9991,%rax
+  8052e9:	ff ff ff 
+  8052ec:	48 01 d8             	add    %rbx,%rax
+  8052ef:	ff d0                	call   *%rax
+  8052f1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052f4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052f8:	78 2c                	js     805326 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8052fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052fe:	ba 07 04 00 00       	mov    $0x407,%edx
+  805303:	48 89 c6             	mov    %rax,%rsi
+  805306:	bf 00 00 00 00       	mov    $0x0,%edi
+  80530b:	49 89 df             	mov    %rbx,%r15
+  80530e:	48 b8 6e 91 ff ff ff 	movabs $0xffffffffffff916e,%rax
+  805315:	ff ff ff 
+  805318:	48 01 d8             	add    %rbx,%rax
+  80531b:	ff d0                	call   *%rax
+  80531d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805320:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805324:	79 1c                	jns    805342 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805326:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805329:	89 c7                	mov    %eax,%edi
+  80532b:	49 89 df             	mov    %rbx,%r15
+  80532e:	48 b8 72 ca ff ff ff 	movabs $0xffffffffffffca72,%rax
+  805335:	ff ff ff 
+  805338:	48 01 d8             	add    %rbx,%rax
+  80533b:	ff d0                	call   *%rax
+		return r;
+  80533d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805340:	eb 41                	jmp    805383 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  805342:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805346:	48 ba 88 00 00 00 00 	movabs $0x88,%rdx
+  80534d:	00 00 00 
+  805350:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805353:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805355:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805359:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  805360:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805364:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805367:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  80536a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80536e:	48 89 c7             	mov    %rax,%rdi
+  805371:	49 89 df             	mov    %rbx,%r15
+  805374:	48 b8 17 99 ff ff ff 	movabs $0xffffffffffff9917,%rax
+  80537b:	ff ff ff 
+  80537e:	48 01 d8             	add    %rbx,%rax
+  805381:	ff d0                	call   *%rax
+}
+  805383:	48 83 c4 20          	add    $0x20,%rsp
+  805387:	5b                   	pop    %rbx
+  805388:	41 5f                	pop    %r15
+  80538a:	5d                   	pop    %rbp
+  80538b:	c3                   	ret
+
+000000000080538c <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80538c:	55                   	push   %rbp
+  80538d:	48 89 e5             	mov    %rsp,%rbp
+  805390:	41 57                	push   %r15
+  805392:	53                   	push   %rbx
+  805393:	48 83 ec 30          	sub    $0x30,%rsp
+  805397:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805397 <accept+0xb>
+  80539e:	49 bb a1 3c 00 00 00 	movabs $0x3ca1,%r11
+  8053a5:	00 00 00 
+  8053a8:	4c 01 db             	add    %r11,%rbx
+  8053ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8053ae:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8053b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8053b6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8053b9:	89 c7                	mov    %eax,%edi
+  8053bb:	48 b8 02 c2 ff ff ff 	movabs $0xffffffffffffc202,%rax
+  8053c2:	ff ff ff 
+  8053c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053c9:	ff d0                	call   *%rax
+  8053cb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053d2:	79 05                	jns    8053d9 <accept+0x4d>
+		return r;
+  8053d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053d7:	eb 45                	jmp    80541e <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8053d9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8053dd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8053e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053e4:	48 89 ce             	mov    %rcx,%rsi
+  8053e7:	89 c7                	mov    %eax,%edi
+  8053e9:	49 89 df             	mov    %rbx,%r15
+  8053ec:	48 b8 e0 c8 ff ff ff 	movabs $0xffffffffffffc8e0,%rax
+  8053f3:	ff ff ff 
+  8053f6:	48 01 d8             	add    %rbx,%rax
+  8053f9:	ff d0                	call   *%rax
+  8053fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805402:	79 05                	jns    805409 <accept+0x7d>
+		return r;
+  805404:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805407:	eb 15                	jmp    80541e <accept+0x92>
+	return alloc_sockfd(r);
+  805409:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80540c:	89 c7                	mov    %eax,%edi
+  80540e:	48 b8 7e c2 ff ff ff 	movabs $0xffffffffffffc27e,%rax
+  805415:	ff ff ff 
+  805418:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80541c:	ff d0                	call   *%rax
+}
+  80541e:	48 83 c4 30          	add    $0x30,%rsp
+  805422:	5b                   	pop    %rbx
+  805423:	41 5f                	pop    %r15
+  805425:	5d                   	pop    %rbp
+  805426:	c3                   	ret
+
+0000000000805427 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805427:	55                   	push   %rbp
+  805428:	48 89 e5             	mov    %rsp,%rbp
+  80542b:	41 57                	push   %r15
+  80542d:	53                   	push   %rbx
+  80542e:	48 83 ec 20          	sub    $0x20,%rsp
+  805432:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805432 <bind+0xb>
+  805439:	49 bb 06 3c 00 00 00 	movabs $0x3c06,%r11
+  805440:	00 00 00 
+  805443:	4c 01 db             	add    %r11,%rbx
+  805446:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805449:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80544d:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805450:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805453:	89 c7                	mov    %eax,%edi
+  805455:	48 b8 02 c2 ff ff ff 	movabs $0xffffffffffffc202,%rax
+  80545c:	ff ff ff 
+  80545f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805463:	ff d0                	call   *%rax
+  805465:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805468:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80546c:	79 05                	jns    805473 <bind+0x4c>
+		return r;
+  80546e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805471:	eb 21                	jmp    805494 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  805473:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805476:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80547a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80547d:	48 89 ce             	mov    %rcx,%rsi
+  805480:	89 c7                	mov    %eax,%edi
+  805482:	49 89 df             	mov    %rbx,%r15
+  805485:	48 b8 8c c9 ff ff ff 	movabs $0xffffffffffffc98c,%rax
+  80548c:	ff ff ff 
+  80548f:	48 01 d8             	add    %rbx,%rax
+  805492:	ff d0                	call   *%rax
+}
+  805494:	48 83 c4 20          	add    $0x20,%rsp
+  805498:	5b                   	pop    %rbx
+  805499:	41 5f                	pop    %r15
+  80549b:	5d                   	pop    %rbp
+  80549c:	c3                   	ret
+
+000000000080549d <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80549d:	55                   	push   %rbp
+  80549e:	48 89 e5             	mov    %rsp,%rbp
+  8054a1:	41 57                	push   %r15
+  8054a3:	53                   	push   %rbx
+  8054a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8054a8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054a8 <shutdown+0xb>
+  8054af:	49 bb 90 3b 00 00 00 	movabs $0x3b90,%r11
+  8054b6:	00 00 00 
+  8054b9:	4c 01 db             	add    %r11,%rbx
+  8054bc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8054bf:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8054c2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054c5:	89 c7                	mov    %eax,%edi
+  8054c7:	48 b8 02 c2 ff ff ff 	movabs $0xffffffffffffc202,%rax
+  8054ce:	ff ff ff 
+  8054d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054d5:	ff d0                	call   *%rax
+  8054d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054da:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054de:	79 05                	jns    8054e5 <shutdown+0x48>
+		return r;
+  8054e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054e3:	eb 1c                	jmp    805501 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8054e5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8054e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054eb:	89 d6                	mov    %edx,%esi
+  8054ed:	89 c7                	mov    %eax,%edi
+  8054ef:	49 89 df             	mov    %rbx,%r15
+  8054f2:	48 b8 21 ca ff ff ff 	movabs $0xffffffffffffca21,%rax
+  8054f9:	ff ff ff 
+  8054fc:	48 01 d8             	add    %rbx,%rax
+  8054ff:	ff d0                	call   *%rax
+}
+  805501:	48 83 c4 20          	add    $0x20,%rsp
+  805505:	5b                   	pop    %rbx
+  805506:	41 5f                	pop    %r15
+  805508:	5d                   	pop    %rbp
+  805509:	c3                   	ret
+
+000000000080550a <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  80550a:	55                   	push   %rbp
+  80550b:	48 89 e5             	mov    %rsp,%rbp
+  80550e:	41 57                	push   %r15
+  805510:	53                   	push   %rbx
+  805511:	48 83 ec 10          	sub    $0x10,%rsp
+  805515:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805515 <devsock_close+0xb>
+  80551c:	49 bb 23 3b 00 00 00 	movabs $0x3b23,%r11
+  805523:	00 00 00 
+  805526:	4c 01 db             	add    %r11,%rbx
+  805529:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80552d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805531:	48 89 c7             	mov    %rax,%rdi
+  805534:	49 89 df             	mov    %rbx,%r15
+  805537:	48 b8 1e e2 ff ff ff 	movabs $0xffffffffffffe21e,%rax
+  80553e:	ff ff ff 
+  805541:	48 01 d8             	add    %rbx,%rax
+  805544:	ff d0                	call   *%rax
+  805546:	83 f8 01             	cmp    $0x1,%eax
+  805549:	75 1d                	jne    805568 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  80554b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80554f:	8b 40 0c             	mov    0xc(%rax),%eax
+  805552:	89 c7                	mov    %eax,%edi
+  805554:	49 89 df             	mov    %rbx,%r15
+  805557:	48 b8 72 ca ff ff ff 	movabs $0xffffffffffffca72,%rax
+  80555e:	ff ff ff 
+  805561:	48 01 d8             	add    %rbx,%rax
+  805564:	ff d0                	call   *%rax
+  805566:	eb 05                	jmp    80556d <devsock_close+0x63>
+	else
+		return 0;
+  805568:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80556d:	48 83 c4 10          	add    $0x10,%rsp
+  805571:	5b                   	pop    %rbx
+  805572:	41 5f                	pop    %r15
+  805574:	5d                   	pop    %rbp
+  805575:	c3                   	ret
+
+0000000000805576 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805576:	55                   	push   %rbp
+  805577:	48 89 e5             	mov    %rsp,%rbp
+  80557a:	41 57                	push   %r15
+  80557c:	53                   	push   %rbx
+  80557d:	48 83 ec 20          	sub    $0x20,%rsp
+  805581:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805581 <connect+0xb>
+  805588:	49 bb b7 3a 00 00 00 	movabs $0x3ab7,%r11
+  80558f:	00 00 00 
+  805592:	4c 01 db             	add    %r11,%rbx
+  805595:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805598:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80559c:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80559f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8055a2:	89 c7                	mov    %eax,%edi
+  8055a4:	48 b8 02 c2 ff ff ff 	movabs $0xffffffffffffc202,%rax
+  8055ab:	ff ff ff 
+  8055ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055b2:	ff d0                	call   *%rax
+  8055b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055bb:	79 05                	jns    8055c2 <connect+0x4c>
+		return r;
+  8055bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055c0:	eb 21                	jmp    8055e3 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8055c2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8055c5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8055c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055cc:	48 89 ce             	mov    %rcx,%rsi
+  8055cf:	89 c7                	mov    %eax,%edi
+  8055d1:	49 89 df             	mov    %rbx,%r15
+  8055d4:	48 b8 ba ca ff ff ff 	movabs $0xffffffffffffcaba,%rax
+  8055db:	ff ff ff 
+  8055de:	48 01 d8             	add    %rbx,%rax
+  8055e1:	ff d0                	call   *%rax
+}
+  8055e3:	48 83 c4 20          	add    $0x20,%rsp
+  8055e7:	5b                   	pop    %rbx
+  8055e8:	41 5f                	pop    %r15
+  8055ea:	5d                   	pop    %rbp
+  8055eb:	c3                   	ret
+
+00000000008055ec <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8055ec:	55                   	push   %rbp
+  8055ed:	48 89 e5             	mov    %rsp,%rbp
+  8055f0:	41 57                	push   %r15
+  8055f2:	53                   	push   %rbx
+  8055f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8055f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055f7 <listen+0xb>
+  8055fe:	49 bb 41 3a 00 00 00 	movabs $0x3a41,%r11
+  805605:	00 00 00 
+  805608:	4c 01 db             	add    %r11,%rbx
+  80560b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80560e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805611:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805614:	89 c7                	mov    %eax,%edi
+  805616:	48 b8 02 c2 ff ff ff 	movabs $0xffffffffffffc202,%rax
+  80561d:	ff ff ff 
+  805620:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805624:	ff d0                	call   *%rax
+  805626:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805629:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80562d:	79 05                	jns    805634 <listen+0x48>
+		return r;
+  80562f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805632:	eb 1c                	jmp    805650 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805634:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805637:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80563a:	89 d6                	mov    %edx,%esi
+  80563c:	89 c7                	mov    %eax,%edi
+  80563e:	49 89 df             	mov    %rbx,%r15
+  805641:	48 b8 4f cb ff ff ff 	movabs $0xffffffffffffcb4f,%rax
+  805648:	ff ff ff 
+  80564b:	48 01 d8             	add    %rbx,%rax
+  80564e:	ff d0                	call   *%rax
+}
+  805650:	48 83 c4 20          	add    $0x20,%rsp
+  805654:	5b                   	pop    %rbx
+  805655:	41 5f                	pop    %r15
+  805657:	5d                   	pop    %rbp
+  805658:	c3                   	ret
+
+0000000000805659 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805659:	55                   	push   %rbp
+  80565a:	48 89 e5             	mov    %rsp,%rbp
+  80565d:	41 57                	push   %r15
+  80565f:	48 83 ec 28          	sub    $0x28,%rsp
+  805663:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805663 <devsock_read+0xa>
+  80566a:	49 bb d5 39 00 00 00 	movabs $0x39d5,%r11
+  805671:	00 00 00 
+  805674:	4c 01 d8             	add    %r11,%rax
+  805677:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80567b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80567f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805683:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805687:	41 89 d0             	mov    %edx,%r8d
+  80568a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80568e:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805691:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805695:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80569a:	44 89 c2             	mov    %r8d,%edx
+  80569d:	49 89 c7             	mov    %rax,%r15
+  8056a0:	49 b8 a0 cb ff ff ff 	movabs $0xffffffffffffcba0,%r8
+  8056a7:	ff ff ff 
+  8056aa:	49 01 c0             	add    %rax,%r8
+  8056ad:	41 ff d0             	call   *%r8
+}
+  8056b0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8056b4:	c9                   	leave
+  8056b5:	c3                   	ret
+
+00000000008056b6 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8056b6:	55                   	push   %rbp
+  8056b7:	48 89 e5             	mov    %rsp,%rbp
+  8056ba:	41 57                	push   %r15
+  8056bc:	48 83 ec 28          	sub    $0x28,%rsp
+  8056c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8056c0 <devsock_write+0xa>
+  8056c7:	49 bb 78 39 00 00 00 	movabs $0x3978,%r11
+  8056ce:	00 00 00 
+  8056d1:	4c 01 d8             	add    %r11,%rax
+  8056d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8056d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8056dc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8056e0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8056e4:	41 89 d0             	mov    %edx,%r8d
+  8056e7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8056eb:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8056ee:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8056f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8056f7:	44 89 c2             	mov    %r8d,%edx
+  8056fa:	49 89 c7             	mov    %rax,%r15
+  8056fd:	49 b8 bd cc ff ff ff 	movabs $0xffffffffffffccbd,%r8
+  805704:	ff ff ff 
+  805707:	49 01 c0             	add    %rax,%r8
+  80570a:	41 ff d0             	call   *%r8
+}
+  80570d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805711:	c9                   	leave
+  805712:	c3                   	ret
+
+0000000000805713 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805713:	55                   	push   %rbp
+  805714:	48 89 e5             	mov    %rsp,%rbp
+  805717:	41 57                	push   %r15
+  805719:	48 83 ec 18          	sub    $0x18,%rsp
+  80571d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80571d <devsock_stat+0xa>
+  805724:	49 bb 1b 39 00 00 00 	movabs $0x391b,%r11
+  80572b:	00 00 00 
+  80572e:	4c 01 d8             	add    %r11,%rax
+  805731:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805735:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805739:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80573d:	48 b9 0f ea ff ff ff 	movabs $0xffffffffffffea0f,%rcx
+  805744:	ff ff ff 
+  805747:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80574b:	48 89 ce             	mov    %rcx,%rsi
+  80574e:	48 89 d7             	mov    %rdx,%rdi
+  805751:	49 89 c7             	mov    %rax,%r15
+  805754:	48 ba b2 84 ff ff ff 	movabs $0xffffffffffff84b2,%rdx
+  80575b:	ff ff ff 
+  80575e:	48 01 c2             	add    %rax,%rdx
+  805761:	ff d2                	call   *%rdx
+	return 0;
+  805763:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805768:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80576c:	c9                   	leave
+  80576d:	c3                   	ret
+
+000000000080576e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80576e:	55                   	push   %rbp
+  80576f:	48 89 e5             	mov    %rsp,%rbp
+  805772:	41 57                	push   %r15
+  805774:	53                   	push   %rbx
+  805775:	48 83 ec 20          	sub    $0x20,%rsp
+  805779:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805779 <socket+0xb>
+  805780:	49 bb bf 38 00 00 00 	movabs $0x38bf,%r11
+  805787:	00 00 00 
+  80578a:	4c 01 db             	add    %r11,%rbx
+  80578d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805790:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805793:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805796:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805799:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80579c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80579f:	89 ce                	mov    %ecx,%esi
+  8057a1:	89 c7                	mov    %eax,%edi
+  8057a3:	49 89 df             	mov    %rbx,%r15
+  8057a6:	48 b8 94 ce ff ff ff 	movabs $0xffffffffffffce94,%rax
+  8057ad:	ff ff ff 
+  8057b0:	48 01 d8             	add    %rbx,%rax
+  8057b3:	ff d0                	call   *%rax
+  8057b5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057b8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057bc:	79 05                	jns    8057c3 <socket+0x55>
+		return r;
+  8057be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057c1:	eb 15                	jmp    8057d8 <socket+0x6a>
+	return alloc_sockfd(r);
+  8057c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057c6:	89 c7                	mov    %eax,%edi
+  8057c8:	48 b8 7e c2 ff ff ff 	movabs $0xffffffffffffc27e,%rax
+  8057cf:	ff ff ff 
+  8057d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057d6:	ff d0                	call   *%rax
+}
+  8057d8:	48 83 c4 20          	add    $0x20,%rsp
+  8057dc:	5b                   	pop    %rbx
+  8057dd:	41 5f                	pop    %r15
+  8057df:	5d                   	pop    %rbp
+  8057e0:	c3                   	ret
+
+00000000008057e1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8057e1:	55                   	push   %rbp
+  8057e2:	48 89 e5             	mov    %rsp,%rbp
+  8057e5:	41 57                	push   %r15
+  8057e7:	53                   	push   %rbx
+  8057e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8057ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057ec <nsipc+0xb>
+  8057f3:	49 bb 4c 38 00 00 00 	movabs $0x384c,%r11
+  8057fa:	00 00 00 
+  8057fd:	4c 01 db             	add    %r11,%rbx
+  805800:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805803:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  80580a:	00 00 00 
+  80580d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805810:	85 c0                	test   %eax,%eax
+  805812:	75 24                	jne    805838 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805814:	bf 02 00 00 00       	mov    $0x2,%edi
+  805819:	49 89 df             	mov    %rbx,%r15
+  80581c:	48 b8 8f e1 ff ff ff 	movabs $0xffffffffffffe18f,%rax
+  805823:	ff ff ff 
+  805826:	48 01 d8             	add    %rbx,%rax
+  805829:	ff d0                	call   *%rax
+  80582b:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  805832:	00 00 00 
+  805835:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805838:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  80583f:	00 00 00 
+  805842:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805845:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805848:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80584e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805854:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805859:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805860:	00 00 00 
+  805863:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805867:	89 c7                	mov    %eax,%edi
+  805869:	49 89 df             	mov    %rbx,%r15
+  80586c:	48 b8 ae db ff ff ff 	movabs $0xffffffffffffdbae,%rax
+  805873:	ff ff ff 
+  805876:	48 01 d8             	add    %rbx,%rax
+  805879:	ff d0                	call   *%rax
+}
+  80587b:	48 83 c4 10          	add    $0x10,%rsp
+  80587f:	5b                   	pop    %rbx
+  805880:	41 5f                	pop    %r15
+  805882:	5d                   	pop    %rbp
+  805883:	c3                   	ret
+
+0000000000805884 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805884:	55                   	push   %rbp
+  805885:	48 89 e5             	mov    %rsp,%rbp
+  805888:	41 57                	push   %r15
+  80588a:	53                   	push   %rbx
+  80588b:	48 83 ec 20          	sub    $0x20,%rsp
+  80588f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80588f <nsipc_words+0xb>
+  805896:	49 bb a9 37 00 00 00 	movabs $0x37a9,%r11
+  80589d:	00 00 00 
+  8058a0:	4c 01 db             	add    %r11,%rbx
+  8058a3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8058a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8058aa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8058ae:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8058b5:	00 00 00 
+  8058b8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8058bb:	85 c0                	test   %eax,%eax
+  8058bd:	75 24                	jne    8058e3 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8058bf:	bf 02 00 00 00       	mov    $0x2,%edi
+  8058c4:	49 89 df             	mov    %rbx,%r15
+  8058c7:	48 b8 8f e1 ff ff ff 	movabs $0xffffffffffffe18f,%rax
+  8058ce:	ff ff ff 
+  8058d1:	48 01 d8             	add    %rbx,%rax
+  8058d4:	ff d0                	call   *%rax
+  8058d6:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  8058dd:	00 00 00 
+  8058e0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8058e3:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8058ea:	00 00 00 
+  8058ed:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8058f0:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8058f4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8058f8:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8058fb:	89 c7                	mov    %eax,%edi
+  8058fd:	49 89 df             	mov    %rbx,%r15
+  805900:	48 b8 99 dc ff ff ff 	movabs $0xffffffffffffdc99,%rax
+  805907:	ff ff ff 
+  80590a:	48 01 d8             	add    %rbx,%rax
+  80590d:	ff d0                	call   *%rax
+}
+  80590f:	48 83 c4 20          	add    $0x20,%rsp
+  805913:	5b                   	pop    %rbx
+  805914:	41 5f                	pop    %r15
+  805916:	5d                   	pop    %rbp
+  805917:	c3                   	ret
+
+0000000000805918 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805918:	55                   	push   %rbp
+  805919:	48 89 e5             	mov    %rsp,%rbp
+  80591c:	41 57                	push   %r15
+  80591e:	53                   	push   %rbx
+  80591f:	48 83 ec 30          	sub    $0x30,%rsp
+  805923:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805923 <nsipc_accept+0xb>
+  80592a:	49 bb 15 37 00 00 00 	movabs $0x3715,%r11
+  805931:	00 00 00 
+  805934:	4c 01 db             	add    %r11,%rbx
+  805937:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80593a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80593e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805942:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805949:	00 00 00 
+  80594c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80594f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805952:	bf 01 00 00 00       	mov    $0x1,%edi
+  805957:	48 b8 a9 c7 ff ff ff 	movabs $0xffffffffffffc7a9,%rax
+  80595e:	ff ff ff 
+  805961:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805965:	ff d0                	call   *%rax
+  805967:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80596a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80596e:	78 48                	js     8059b8 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805970:	48 b8 c8 3f 01 00 00 	movabs $0x13fc8,%rax
+  805977:	00 00 00 
+  80597a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80597e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805982:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805986:	8b 40 10             	mov    0x10(%rax),%eax
+  805989:	89 c2                	mov    %eax,%edx
+  80598b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80598f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805993:	48 89 ce             	mov    %rcx,%rsi
+  805996:	48 89 c7             	mov    %rax,%rdi
+  805999:	49 89 df             	mov    %rbx,%r15
+  80599c:	48 b8 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rax
+  8059a3:	ff ff ff 
+  8059a6:	48 01 d8             	add    %rbx,%rax
+  8059a9:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8059ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059af:	8b 50 10             	mov    0x10(%rax),%edx
+  8059b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8059b6:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8059b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8059bb:	48 83 c4 30          	add    $0x30,%rsp
+  8059bf:	5b                   	pop    %rbx
+  8059c0:	41 5f                	pop    %r15
+  8059c2:	5d                   	pop    %rbp
+  8059c3:	c3                   	ret
+
+00000000008059c4 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8059c4:	55                   	push   %rbp
+  8059c5:	48 89 e5             	mov    %rsp,%rbp
+  8059c8:	41 57                	push   %r15
+  8059ca:	53                   	push   %rbx
+  8059cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8059cf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059cf <nsipc_bind+0xb>
+  8059d6:	49 bb 69 36 00 00 00 	movabs $0x3669,%r11
+  8059dd:	00 00 00 
+  8059e0:	4c 01 db             	add    %r11,%rbx
+  8059e3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8059e6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8059ea:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8059ed:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8059f4:	00 00 00 
+  8059f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059fa:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8059fd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a00:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a04:	48 89 c6             	mov    %rax,%rsi
+  805a07:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  805a0e:	00 00 00 
+  805a11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a15:	48 89 c7             	mov    %rax,%rdi
+  805a18:	49 89 df             	mov    %rbx,%r15
+  805a1b:	48 b8 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rax
+  805a22:	ff ff ff 
+  805a25:	48 01 d8             	add    %rbx,%rax
+  805a28:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805a2a:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805a31:	00 00 00 
+  805a34:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a37:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805a3b:	bf 02 00 00 00       	mov    $0x2,%edi
+  805a40:	48 b8 a9 c7 ff ff ff 	movabs $0xffffffffffffc7a9,%rax
+  805a47:	ff ff ff 
+  805a4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a4e:	ff d0                	call   *%rax
+}
+  805a50:	48 83 c4 10          	add    $0x10,%rsp
+  805a54:	5b                   	pop    %rbx
+  805a55:	41 5f                	pop    %r15
+  805a57:	5d                   	pop    %rbp
+  805a58:	c3                   	ret
+
+0000000000805a59 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805a59:	55                   	push   %rbp
+  805a5a:	48 89 e5             	mov    %rsp,%rbp
+  805a5d:	48 83 ec 20          	sub    $0x20,%rsp
+  805a61:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a61 <nsipc_shutdown+0x8>
+  805a68:	49 bb d7 35 00 00 00 	movabs $0x35d7,%r11
+  805a6f:	00 00 00 
+  805a72:	4c 01 d8             	add    %r11,%rax
+  805a75:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a78:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805a7b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805a7e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805a81:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a84:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805a87:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805a8b:	ba 08 00 00 00       	mov    $0x8,%edx
+  805a90:	48 89 ce             	mov    %rcx,%rsi
+  805a93:	bf 03 00 00 00       	mov    $0x3,%edi
+  805a98:	48 b9 4c c8 ff ff ff 	movabs $0xffffffffffffc84c,%rcx
+  805a9f:	ff ff ff 
+  805aa2:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805aa6:	ff d0                	call   *%rax
+}
+  805aa8:	c9                   	leave
+  805aa9:	c3                   	ret
+
+0000000000805aaa <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805aaa:	55                   	push   %rbp
+  805aab:	48 89 e5             	mov    %rsp,%rbp
+  805aae:	48 83 ec 20          	sub    $0x20,%rsp
+  805ab2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ab2 <nsipc_close+0x8>
+  805ab9:	49 bb 86 35 00 00 00 	movabs $0x3586,%r11
+  805ac0:	00 00 00 
+  805ac3:	4c 01 d8             	add    %r11,%rax
+  805ac6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805ac9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805acc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805acf:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805ad3:	ba 04 00 00 00       	mov    $0x4,%edx
+  805ad8:	48 89 ce             	mov    %rcx,%rsi
+  805adb:	bf 04 00 00 00       	mov    $0x4,%edi
+  805ae0:	48 b9 4c c8 ff ff ff 	movabs $0xffffffffffffc84c,%rcx
+  805ae7:	ff ff ff 
+  805aea:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805aee:	ff d0                	call   *%rax
+}
+  805af0:	c9                   	leave
+  805af1:	c3                   	ret
+
+0000000000805af2 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805af2:	55                   	push   %rbp
+  805af3:	48 89 e5             	mov    %rsp,%rbp
+  805af6:	41 57                	push   %r15
+  805af8:	53                   	push   %rbx
+  805af9:	48 83 ec 10          	sub    $0x10,%rsp
+  805afd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805afd <nsipc_connect+0xb>
+  805b04:	49 bb 3b 35 00 00 00 	movabs $0x353b,%r11
+  805b0b:	00 00 00 
+  805b0e:	4c 01 db             	add    %r11,%rbx
+  805b11:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805b14:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805b18:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805b1b:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805b22:	00 00 00 
+  805b25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b28:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805b2b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b32:	48 89 c6             	mov    %rax,%rsi
+  805b35:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  805b3c:	00 00 00 
+  805b3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b43:	48 89 c7             	mov    %rax,%rdi
+  805b46:	49 89 df             	mov    %rbx,%r15
+  805b49:	48 b8 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rax
+  805b50:	ff ff ff 
+  805b53:	48 01 d8             	add    %rbx,%rax
+  805b56:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805b58:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805b5f:	00 00 00 
+  805b62:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805b65:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805b69:	bf 05 00 00 00       	mov    $0x5,%edi
+  805b6e:	48 b8 a9 c7 ff ff ff 	movabs $0xffffffffffffc7a9,%rax
+  805b75:	ff ff ff 
+  805b78:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b7c:	ff d0                	call   *%rax
+}
+  805b7e:	48 83 c4 10          	add    $0x10,%rsp
+  805b82:	5b                   	pop    %rbx
+  805b83:	41 5f                	pop    %r15
+  805b85:	5d                   	pop    %rbp
+  805b86:	c3                   	ret
+
+0000000000805b87 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805b87:	55                   	push   %rbp
+  805b88:	48 89 e5             	mov    %rsp,%rbp
+  805b8b:	48 83 ec 20          	sub    $0x20,%rsp
+  805b8f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805b8f <nsipc_listen+0x8>
+  805b96:	49 bb a9 34 00 00 00 	movabs $0x34a9,%r11
+  805b9d:	00 00 00 
+  805ba0:	4c 01 d8             	add    %r11,%rax
+  805ba3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805ba6:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805ba9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805bac:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805baf:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805bb2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805bb5:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805bb9:	ba 08 00 00 00       	mov    $0x8,%edx
+  805bbe:	48 89 ce             	mov    %rcx,%rsi
+  805bc1:	bf 06 00 00 00       	mov    $0x6,%edi
+  805bc6:	48 b9 4c c8 ff ff ff 	movabs $0xffffffffffffc84c,%rcx
+  805bcd:	ff ff ff 
+  805bd0:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805bd4:	ff d0                	call   *%rax
+}
+  805bd6:	c9                   	leave
+  805bd7:	c3                   	ret
+
+0000000000805bd8 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805bd8:	55                   	push   %rbp
+  805bd9:	48 89 e5             	mov    %rsp,%rbp
+  805bdc:	41 57                	push   %r15
+  805bde:	53                   	push   %rbx
+  805bdf:	48 83 ec 30          	sub    $0x30,%rsp
+  805be3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805be3 <nsipc_recv+0xb>
+  805bea:	49 bb 55 34 00 00 00 	movabs $0x3455,%r11
+  805bf1:	00 00 00 
+  805bf4:	4c 01 db             	add    %r11,%rbx
+  805bf7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805bfa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805bfe:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805c01:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805c04:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805c0b:	00 00 00 
+  805c0e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c11:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805c14:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805c1b:	00 00 00 
+  805c1e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805c21:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805c25:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805c2c:	00 00 00 
+  805c2f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c32:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805c36:	bf 07 00 00 00       	mov    $0x7,%edi
+  805c3b:	48 b8 a9 c7 ff ff ff 	movabs $0xffffffffffffc7a9,%rax
+  805c42:	ff ff ff 
+  805c45:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c49:	ff d0                	call   *%rax
+  805c4b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c4e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c52:	0f 88 91 00 00 00    	js     805ce9 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805c58:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805c5f:	7f 08                	jg     805c69 <nsipc_recv+0x91>
+  805c61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c64:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805c67:	7e 50                	jle    805cb9 <nsipc_recv+0xe1>
+  805c69:	48 b8 16 ea ff ff ff 	movabs $0xffffffffffffea16,%rax
+  805c70:	ff ff ff 
+  805c73:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c77:	48 89 c1             	mov    %rax,%rcx
+  805c7a:	48 b8 2b ea ff ff ff 	movabs $0xffffffffffffea2b,%rax
+  805c81:	ff ff ff 
+  805c84:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c88:	48 89 c2             	mov    %rax,%rdx
+  805c8b:	be 79 00 00 00       	mov    $0x79,%esi
+  805c90:	48 b8 40 ea ff ff ff 	movabs $0xffffffffffffea40,%rax
+  805c97:	ff ff ff 
+  805c9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c9e:	48 89 c7             	mov    %rax,%rdi
+  805ca1:	49 89 df             	mov    %rbx,%r15
+  805ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ca9:	49 b8 19 74 ff ff ff 	movabs $0xffffffffffff7419,%r8
+  805cb0:	ff ff ff 
+  805cb3:	49 01 d8             	add    %rbx,%r8
+  805cb6:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805cb9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cbc:	48 63 d0             	movslq %eax,%rdx
+  805cbf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cc3:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  805cca:	00 00 00 
+  805ccd:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805cd1:	48 89 ce             	mov    %rcx,%rsi
+  805cd4:	48 89 c7             	mov    %rax,%rdi
+  805cd7:	49 89 df             	mov    %rbx,%r15
+  805cda:	48 b8 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rax
+  805ce1:	ff ff ff 
+  805ce4:	48 01 d8             	add    %rbx,%rax
+  805ce7:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805ce9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805cec:	48 83 c4 30          	add    $0x30,%rsp
+  805cf0:	5b                   	pop    %rbx
+  805cf1:	41 5f                	pop    %r15
+  805cf3:	5d                   	pop    %rbp
+  805cf4:	c3                   	ret
+
+0000000000805cf5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805cf5:	55                   	push   %rbp
+  805cf6:	48 89 e5             	mov    %rsp,%rbp
+  805cf9:	41 57                	push   %r15
+  805cfb:	53                   	push   %rbx
+  805cfc:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805d03:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d03 <nsipc_send+0xe>
+  805d0a:	49 bb 35 33 00 00 00 	movabs $0x3335,%r11
+  805d11:	00 00 00 
+  805d14:	4c 01 db             	add    %r11,%rbx
+  805d17:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805d1d:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805d24:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805d2a:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805d30:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805d34:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805d38:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  805d3f:	00 00 00 
+  805d42:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805d45:	85 c0                	test   %eax,%eax
+  805d47:	75 24                	jne    805d6d <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805d49:	bf 02 00 00 00       	mov    $0x2,%edi
+  805d4e:	49 89 df             	mov    %rbx,%r15
+  805d51:	48 b8 8f e1 ff ff ff 	movabs $0xffffffffffffe18f,%rax
+  805d58:	ff ff ff 
+  805d5b:	48 01 d8             	add    %rbx,%rax
+  805d5e:	ff d0                	call   *%rax
+  805d60:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  805d67:	00 00 00 
+  805d6a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805d6d:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805d73:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805d76:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805d7d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805d80:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805d83:	39 c2                	cmp    %eax,%edx
+  805d85:	0f 4e c2             	cmovle %edx,%eax
+  805d88:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805d8e:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805d94:	48 63 d0             	movslq %eax,%rdx
+  805d97:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805d9e:	48 89 c6             	mov    %rax,%rsi
+  805da1:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  805da8:	00 00 00 
+  805dab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805daf:	48 89 c7             	mov    %rax,%rdi
+  805db2:	49 89 df             	mov    %rbx,%r15
+  805db5:	48 b8 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rax
+  805dbc:	ff ff ff 
+  805dbf:	48 01 d8             	add    %rbx,%rax
+  805dc2:	ff d0                	call   *%rax
+	req->req_s = s;
+  805dc4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dc8:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805dce:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805dd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dd4:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805dda:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805ddd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805de1:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805de7:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805dea:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  805df1:	00 00 00 
+  805df4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805df8:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805dfc:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805e03:	00 
+  805e04:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805e0a:	48 63 d0             	movslq %eax,%rdx
+  805e0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e11:	48 01 d0             	add    %rdx,%rax
+  805e14:	48 83 e8 01          	sub    $0x1,%rax
+  805e18:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805e1c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e20:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e25:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805e29:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e2d:	48 29 d0             	sub    %rdx,%rax
+  805e30:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805e36:	85 c0                	test   %eax,%eax
+  805e38:	0f 48 c2             	cmovs  %edx,%eax
+  805e3b:	c1 f8 0c             	sar    $0xc,%eax
+  805e3e:	48 98                	cltq
+  805e40:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805e44:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805e48:	48 85 c0             	test   %rax,%rax
+  805e4b:	0f 95 c0             	setne  %al
+  805e4e:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805e51:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  805e58:	00 
+  805e59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e5d:	48 83 c0 0b          	add    $0xb,%rax
+  805e61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805e65:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805e69:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e6e:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805e72:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805e76:	48 29 d0             	sub    %rdx,%rax
+  805e79:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805e7d:	89 c7                	mov    %eax,%edi
+  805e7f:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  805e86:	00 00 00 
+  805e89:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805e8c:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805e90:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805e94:	48 83 ec 08          	sub    $0x8,%rsp
+  805e98:	6a 00                	push   $0x0
+  805e9a:	6a 00                	push   $0x0
+  805e9c:	6a 05                	push   $0x5
+  805e9e:	41 89 f1             	mov    %esi,%r9d
+  805ea1:	49 89 c8             	mov    %rcx,%r8
+  805ea4:	89 f9                	mov    %edi,%ecx
+  805ea6:	be 08 00 00 00       	mov    $0x8,%esi
+  805eab:	89 c7                	mov    %eax,%edi
+  805ead:	49 89 df             	mov    %rbx,%r15
+  805eb0:	48 b8 97 dd ff ff ff 	movabs $0xffffffffffffdd97,%rax
+  805eb7:	ff ff ff 
+  805eba:	48 01 d8             	add    %rbx,%rax
+  805ebd:	ff d0                	call   *%rax
+  805ebf:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805ec3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805ec7:	5b                   	pop    %rbx
+  805ec8:	41 5f                	pop    %r15
+  805eca:	5d                   	pop    %rbp
+  805ecb:	c3                   	ret
+
+0000000000805ecc <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805ecc:	55                   	push   %rbp
+  805ecd:	48 89 e5             	mov    %rsp,%rbp
+  805ed0:	48 83 ec 10          	sub    $0x10,%rsp
+  805ed4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ed4 <nsipc_socket+0x8>
+  805edb:	49 bb 64 31 00 00 00 	movabs $0x3164,%r11
+  805ee2:	00 00 00 
+  805ee5:	4c 01 d8             	add    %r11,%rax
+  805ee8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805eeb:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805eee:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805ef1:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  805ef8:	00 00 00 
+  805efb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805efe:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805f01:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  805f08:	00 00 00 
+  805f0b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805f0e:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805f12:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  805f19:	00 00 00 
+  805f1c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805f1f:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805f23:	bf 09 00 00 00       	mov    $0x9,%edi
+  805f28:	48 ba a9 c7 ff ff ff 	movabs $0xffffffffffffc7a9,%rdx
+  805f2f:	ff ff ff 
+  805f32:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805f36:	ff d0                	call   *%rax
+}
+  805f38:	c9                   	leave
+  805f39:	c3                   	ret
+
+0000000000805f3a <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805f3a:	55                   	push   %rbp
+  805f3b:	48 89 e5             	mov    %rsp,%rbp
+  805f3e:	41 57                	push   %r15
+  805f40:	53                   	push   %rbx
+  805f41:	48 83 ec 30          	sub    $0x30,%rsp
+  805f45:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f45 <pipe+0xb>
+  805f4c:	49 bb f3 30 00 00 00 	movabs $0x30f3,%r11
+  805f53:	00 00 00 
+  805f56:	4c 01 db             	add    %r11,%rbx
+  805f59:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805f5d:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805f61:	48 89 c7             	mov    %rax,%rdi
+  805f64:	49 89 df             	mov    %rbx,%r15
+  805f67:	48 b8 91 99 ff ff ff 	movabs $0xffffffffffff9991,%rax
+  805f6e:	ff ff ff 
+  805f71:	48 01 d8             	add    %rbx,%rax
+  805f74:	ff d0                	call   *%rax
+  805f76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f7d:	0f 88 12 02 00 00    	js     806195 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805f83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f87:	ba 07 04 00 00       	mov    $0x407,%edx
+  805f8c:	48 89 c6             	mov    %rax,%rsi
+  805f8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f94:	49 89 df             	mov    %rbx,%r15
+  805f97:	48 b8 6e 91 ff ff ff 	movabs $0xffffffffffff916e,%rax
+  805f9e:	ff ff ff 
+  805fa1:	48 01 d8             	add    %rbx,%rax
+  805fa4:	ff d0                	call   *%rax
+  805fa6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fa9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fad:	0f 88 e2 01 00 00    	js     806195 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805fb3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805fb7:	48 89 c7             	mov    %rax,%rdi
+  805fba:	49 89 df             	mov    %rbx,%r15
+  805fbd:	48 b8 91 99 ff ff ff 	movabs $0xffffffffffff9991,%rax
+  805fc4:	ff ff ff 
+  805fc7:	48 01 d8             	add    %rbx,%rax
+  805fca:	ff d0                	call   *%rax
+  805fcc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fcf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fd3:	0f 88 9b 01 00 00    	js     806174 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805fd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fdd:	ba 07 04 00 00       	mov    $0x407,%edx
+  805fe2:	48 89 c6             	mov    %rax,%rsi
+  805fe5:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fea:	49 89 df             	mov    %rbx,%r15
+  805fed:	48 b8 6e 91 ff ff ff 	movabs $0xffffffffffff916e,%rax
+  805ff4:	ff ff ff 
+  805ff7:	48 01 d8             	add    %rbx,%rax
+  805ffa:	ff d0                	call   *%rax
+  805ffc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fff:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806003:	0f 88 6b 01 00 00    	js     806174 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  806009:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80600d:	48 89 c7             	mov    %rax,%rdi
+  806010:	49 89 df             	mov    %rbx,%r15
+  806013:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  80601a:	ff ff ff 
+  80601d:	48 01 d8             	add    %rbx,%rax
+  806020:	ff d0                	call   *%rax
+  806022:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806026:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80602a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80602f:	48 89 c6             	mov    %rax,%rsi
+  806032:	bf 00 00 00 00       	mov    $0x0,%edi
+  806037:	49 89 df             	mov    %rbx,%r15
+  80603a:	48 b8 6e 91 ff ff ff 	movabs $0xffffffffffff916e,%rax
+  806041:	ff ff ff 
+  806044:	48 01 d8             	add    %rbx,%rax
+  806047:	ff d0                	call   *%rax
+  806049:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80604c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806050:	0f 88 fd 00 00 00    	js     806153 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806056:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80605a:	48 89 c7             	mov    %rax,%rdi
+  80605d:	49 89 df             	mov    %rbx,%r15
+  806060:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  806067:	ff ff ff 
+  80606a:	48 01 d8             	add    %rbx,%rax
+  80606d:	ff d0                	call   *%rax
+  80606f:	48 89 c2             	mov    %rax,%rdx
+  806072:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806076:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80607c:	48 89 d1             	mov    %rdx,%rcx
+  80607f:	ba 00 00 00 00       	mov    $0x0,%edx
+  806084:	48 89 c6             	mov    %rax,%rsi
+  806087:	bf 00 00 00 00       	mov    $0x0,%edi
+  80608c:	49 89 df             	mov    %rbx,%r15
+  80608f:	48 b8 d3 91 ff ff ff 	movabs $0xffffffffffff91d3,%rax
+  806096:	ff ff ff 
+  806099:	48 01 d8             	add    %rbx,%rax
+  80609c:	ff d0                	call   *%rax
+  80609e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8060a1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060a5:	0f 88 87 00 00 00    	js     806132 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8060ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060af:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  8060b6:	00 00 00 
+  8060b9:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8060bc:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  8060be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060c2:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8060c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060cd:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  8060d4:	00 00 00 
+  8060d7:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8060da:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8060dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060e0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8060e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060eb:	48 89 c7             	mov    %rax,%rdi
+  8060ee:	49 89 df             	mov    %rbx,%r15
+  8060f1:	48 b8 17 99 ff ff ff 	movabs $0xffffffffffff9917,%rax
+  8060f8:	ff ff ff 
+  8060fb:	48 01 d8             	add    %rbx,%rax
+  8060fe:	ff d0                	call   *%rax
+  806100:	89 c2                	mov    %eax,%edx
+  806102:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806106:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  806108:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80610c:	48 89 c7             	mov    %rax,%rdi
+  80610f:	49 89 df             	mov    %rbx,%r15
+  806112:	48 b8 17 99 ff ff ff 	movabs $0xffffffffffff9917,%rax
+  806119:	ff ff ff 
+  80611c:	48 01 d8             	add    %rbx,%rax
+  80611f:	ff d0                	call   *%rax
+  806121:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806125:	48 83 c2 04          	add    $0x4,%rdx
+  806129:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  80612b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806130:	eb 67                	jmp    806199 <pipe+0x25f>
+		goto err3;
+  806132:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806133:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806137:	48 89 c6             	mov    %rax,%rsi
+  80613a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80613f:	49 89 df             	mov    %rbx,%r15
+  806142:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  806149:	ff ff ff 
+  80614c:	48 01 d8             	add    %rbx,%rax
+  80614f:	ff d0                	call   *%rax
+  806151:	eb 01                	jmp    806154 <pipe+0x21a>
+		goto err2;
+  806153:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  806154:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806158:	48 89 c6             	mov    %rax,%rsi
+  80615b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806160:	49 89 df             	mov    %rbx,%r15
+  806163:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  80616a:	ff ff ff 
+  80616d:	48 01 d8             	add    %rbx,%rax
+  806170:	ff d0                	call   *%rax
+  806172:	eb 01                	jmp    806175 <pipe+0x23b>
+		goto err1;
+  806174:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806175:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806179:	48 89 c6             	mov    %rax,%rsi
+  80617c:	bf 00 00 00 00       	mov    $0x0,%edi
+  806181:	49 89 df             	mov    %rbx,%r15
+  806184:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  80618b:	ff ff ff 
+  80618e:	48 01 d8             	add    %rbx,%rax
+  806191:	ff d0                	call   *%rax
+  806193:	eb 01                	jmp    806196 <pipe+0x25c>
+		goto err;
+  806195:	90                   	nop
+err:
+	return r;
+  806196:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806199:	48 83 c4 30          	add    $0x30,%rsp
+  80619d:	5b                   	pop    %rbx
+  80619e:	41 5f                	pop    %r15
+  8061a0:	5d                   	pop    %rbp
+  8061a1:	c3                   	ret
+
+00000000008061a2 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8061a2:	55                   	push   %rbp
+  8061a3:	48 89 e5             	mov    %rsp,%rbp
+  8061a6:	41 57                	push   %r15
+  8061a8:	41 54                	push   %r12
+  8061aa:	53                   	push   %rbx
+  8061ab:	48 83 ec 28          	sub    $0x28,%rsp
+  8061af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061af <_pipeisclosed+0xd>
+  8061b6:	49 bb 89 2e 00 00 00 	movabs $0x2e89,%r11
+  8061bd:	00 00 00 
+  8061c0:	4c 01 db             	add    %r11,%rbx
+  8061c3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8061c7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8061cb:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8061d2:	ff ff ff 
+  8061d5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8061d9:	48 8b 00             	mov    (%rax),%rax
+  8061dc:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8061e2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8061e5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8061e9:	48 89 c7             	mov    %rax,%rdi
+  8061ec:	49 89 df             	mov    %rbx,%r15
+  8061ef:	48 b8 1e e2 ff ff ff 	movabs $0xffffffffffffe21e,%rax
+  8061f6:	ff ff ff 
+  8061f9:	48 01 d8             	add    %rbx,%rax
+  8061fc:	ff d0                	call   *%rax
+  8061fe:	41 89 c4             	mov    %eax,%r12d
+  806201:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806205:	48 89 c7             	mov    %rax,%rdi
+  806208:	49 89 df             	mov    %rbx,%r15
+  80620b:	48 b8 1e e2 ff ff ff 	movabs $0xffffffffffffe21e,%rax
+  806212:	ff ff ff 
+  806215:	48 01 d8             	add    %rbx,%rax
+  806218:	ff d0                	call   *%rax
+  80621a:	41 39 c4             	cmp    %eax,%r12d
+  80621d:	0f 94 c0             	sete   %al
+  806220:	0f b6 c0             	movzbl %al,%eax
+  806223:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806226:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80622d:	ff ff ff 
+  806230:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806234:	48 8b 00             	mov    (%rax),%rax
+  806237:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80623d:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  806240:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806243:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806246:	75 05                	jne    80624d <_pipeisclosed+0xab>
+			return ret;
+  806248:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80624b:	eb 63                	jmp    8062b0 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  80624d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806250:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806253:	0f 84 72 ff ff ff    	je     8061cb <_pipeisclosed+0x29>
+  806259:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  80625d:	0f 85 68 ff ff ff    	jne    8061cb <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  806263:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80626a:	ff ff ff 
+  80626d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806271:	48 8b 00             	mov    (%rax),%rax
+  806274:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  80627a:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80627d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806280:	89 c6                	mov    %eax,%esi
+  806282:	48 b8 51 ea ff ff ff 	movabs $0xffffffffffffea51,%rax
+  806289:	ff ff ff 
+  80628c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806290:	48 89 c7             	mov    %rax,%rdi
+  806293:	49 89 df             	mov    %rbx,%r15
+  806296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80629b:	49 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%r8
+  8062a2:	ff ff ff 
+  8062a5:	49 01 d8             	add    %rbx,%r8
+  8062a8:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8062ab:	e9 1b ff ff ff       	jmp    8061cb <_pipeisclosed+0x29>
+	}
+}
+  8062b0:	48 83 c4 28          	add    $0x28,%rsp
+  8062b4:	5b                   	pop    %rbx
+  8062b5:	41 5c                	pop    %r12
+  8062b7:	41 5f                	pop    %r15
+  8062b9:	5d                   	pop    %rbp
+  8062ba:	c3                   	ret
+
+00000000008062bb <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8062bb:	55                   	push   %rbp
+  8062bc:	48 89 e5             	mov    %rsp,%rbp
+  8062bf:	41 57                	push   %r15
+  8062c1:	53                   	push   %rbx
+  8062c2:	48 83 ec 30          	sub    $0x30,%rsp
+  8062c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8062c6 <pipeisclosed+0xb>
+  8062cd:	49 bb 72 2d 00 00 00 	movabs $0x2d72,%r11
+  8062d4:	00 00 00 
+  8062d7:	4c 01 db             	add    %r11,%rbx
+  8062da:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8062dd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8062e1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8062e4:	48 89 d6             	mov    %rdx,%rsi
+  8062e7:	89 c7                	mov    %eax,%edi
+  8062e9:	49 89 df             	mov    %rbx,%r15
+  8062ec:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  8062f3:	ff ff ff 
+  8062f6:	48 01 d8             	add    %rbx,%rax
+  8062f9:	ff d0                	call   *%rax
+  8062fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806302:	79 05                	jns    806309 <pipeisclosed+0x4e>
+		return r;
+  806304:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806307:	eb 3b                	jmp    806344 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  806309:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80630d:	48 89 c7             	mov    %rax,%rdi
+  806310:	49 89 df             	mov    %rbx,%r15
+  806313:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  80631a:	ff ff ff 
+  80631d:	48 01 d8             	add    %rbx,%rax
+  806320:	ff d0                	call   *%rax
+  806322:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806326:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80632a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80632e:	48 89 d6             	mov    %rdx,%rsi
+  806331:	48 89 c7             	mov    %rax,%rdi
+  806334:	48 b8 6a d1 ff ff ff 	movabs $0xffffffffffffd16a,%rax
+  80633b:	ff ff ff 
+  80633e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806342:	ff d0                	call   *%rax
+}
+  806344:	48 83 c4 30          	add    $0x30,%rsp
+  806348:	5b                   	pop    %rbx
+  806349:	41 5f                	pop    %r15
+  80634b:	5d                   	pop    %rbp
+  80634c:	c3                   	ret
+
+000000000080634d <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80634d:	55                   	push   %rbp
+  80634e:	48 89 e5             	mov    %rsp,%rbp
+  806351:	41 57                	push   %r15
+  806353:	53                   	push   %rbx
+  806354:	48 83 ec 40          	sub    $0x40,%rsp
+  806358:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806358 <devpipe_read+0xb>
+  80635f:	49 bb e0 2c 00 00 00 	movabs $0x2ce0,%r11
+  806366:	00 00 00 
+  806369:	4c 01 db             	add    %r11,%rbx
+  80636c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806370:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806374:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806378:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80637c:	48 89 c7             	mov    %rax,%rdi
+  80637f:	49 89 df             	mov    %rbx,%r15
+  806382:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  806389:	ff ff ff 
+  80638c:	48 01 d8             	add    %rbx,%rax
+  80638f:	ff d0                	call   *%rax
+  806391:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806395:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806399:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80639d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8063a4:	00 
+  8063a5:	e9 a1 00 00 00       	jmp    80644b <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8063aa:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8063af:	74 09                	je     8063ba <devpipe_read+0x6d>
+				return i;
+  8063b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063b5:	e9 9f 00 00 00       	jmp    806459 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8063ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8063be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063c2:	48 89 d6             	mov    %rdx,%rsi
+  8063c5:	48 89 c7             	mov    %rax,%rdi
+  8063c8:	48 b8 6a d1 ff ff ff 	movabs $0xffffffffffffd16a,%rax
+  8063cf:	ff ff ff 
+  8063d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063d6:	ff d0                	call   *%rax
+  8063d8:	85 c0                	test   %eax,%eax
+  8063da:	74 07                	je     8063e3 <devpipe_read+0x96>
+				return 0;
+  8063dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063e1:	eb 76                	jmp    806459 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8063e3:	49 89 df             	mov    %rbx,%r15
+  8063e6:	48 b8 19 91 ff ff ff 	movabs $0xffffffffffff9119,%rax
+  8063ed:	ff ff ff 
+  8063f0:	48 01 d8             	add    %rbx,%rax
+  8063f3:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8063f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063f9:	8b 10                	mov    (%rax),%edx
+  8063fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063ff:	8b 40 04             	mov    0x4(%rax),%eax
+  806402:	39 c2                	cmp    %eax,%edx
+  806404:	74 a4                	je     8063aa <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  806406:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80640a:	8b 10                	mov    (%rax),%edx
+  80640c:	89 d0                	mov    %edx,%eax
+  80640e:	c1 f8 1f             	sar    $0x1f,%eax
+  806411:	c1 e8 1b             	shr    $0x1b,%eax
+  806414:	01 c2                	add    %eax,%edx
+  806416:	83 e2 1f             	and    $0x1f,%edx
+  806419:	29 c2                	sub    %eax,%edx
+  80641b:	89 d6                	mov    %edx,%esi
+  80641d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806421:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806425:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806429:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80642d:	48 63 c6             	movslq %esi,%rax
+  806430:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806435:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806437:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80643b:	8b 00                	mov    (%rax),%eax
+  80643d:	8d 50 01             	lea    0x1(%rax),%edx
+  806440:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806444:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806446:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80644b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80644f:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806453:	72 a0                	jb     8063f5 <devpipe_read+0xa8>
+	}
+	return i;
+  806455:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806459:	48 83 c4 40          	add    $0x40,%rsp
+  80645d:	5b                   	pop    %rbx
+  80645e:	41 5f                	pop    %r15
+  806460:	5d                   	pop    %rbp
+  806461:	c3                   	ret
+
+0000000000806462 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806462:	55                   	push   %rbp
+  806463:	48 89 e5             	mov    %rsp,%rbp
+  806466:	41 57                	push   %r15
+  806468:	53                   	push   %rbx
+  806469:	48 83 ec 40          	sub    $0x40,%rsp
+  80646d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80646d <devpipe_write+0xb>
+  806474:	49 bb cb 2b 00 00 00 	movabs $0x2bcb,%r11
+  80647b:	00 00 00 
+  80647e:	4c 01 db             	add    %r11,%rbx
+  806481:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806485:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806489:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80648d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806491:	48 89 c7             	mov    %rax,%rdi
+  806494:	49 89 df             	mov    %rbx,%r15
+  806497:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  80649e:	ff ff ff 
+  8064a1:	48 01 d8             	add    %rbx,%rax
+  8064a4:	ff d0                	call   *%rax
+  8064a6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8064aa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8064ae:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8064b2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8064b9:	00 
+  8064ba:	e9 a0 00 00 00       	jmp    80655f <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8064bf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8064c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8064c7:	48 89 d6             	mov    %rdx,%rsi
+  8064ca:	48 89 c7             	mov    %rax,%rdi
+  8064cd:	48 b8 6a d1 ff ff ff 	movabs $0xffffffffffffd16a,%rax
+  8064d4:	ff ff ff 
+  8064d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8064db:	ff d0                	call   *%rax
+  8064dd:	85 c0                	test   %eax,%eax
+  8064df:	74 0a                	je     8064eb <devpipe_write+0x89>
+				return 0;
+  8064e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064e6:	e9 82 00 00 00       	jmp    80656d <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8064eb:	49 89 df             	mov    %rbx,%r15
+  8064ee:	48 b8 19 91 ff ff ff 	movabs $0xffffffffffff9119,%rax
+  8064f5:	ff ff ff 
+  8064f8:	48 01 d8             	add    %rbx,%rax
+  8064fb:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8064fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806501:	8b 40 04             	mov    0x4(%rax),%eax
+  806504:	48 63 d0             	movslq %eax,%rdx
+  806507:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80650b:	8b 00                	mov    (%rax),%eax
+  80650d:	48 98                	cltq
+  80650f:	48 83 c0 20          	add    $0x20,%rax
+  806513:	48 39 c2             	cmp    %rax,%rdx
+  806516:	73 a7                	jae    8064bf <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806518:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80651c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806520:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806524:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806528:	8b 50 04             	mov    0x4(%rax),%edx
+  80652b:	89 d0                	mov    %edx,%eax
+  80652d:	c1 f8 1f             	sar    $0x1f,%eax
+  806530:	c1 e8 1b             	shr    $0x1b,%eax
+  806533:	01 c2                	add    %eax,%edx
+  806535:	83 e2 1f             	and    $0x1f,%edx
+  806538:	29 c2                	sub    %eax,%edx
+  80653a:	89 d0                	mov    %edx,%eax
+  80653c:	0f b6 09             	movzbl (%rcx),%ecx
+  80653f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806543:	48 98                	cltq
+  806545:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806549:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80654d:	8b 40 04             	mov    0x4(%rax),%eax
+  806550:	8d 50 01             	lea    0x1(%rax),%edx
+  806553:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806557:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  80655a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80655f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806563:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806567:	72 94                	jb     8064fd <devpipe_write+0x9b>
+	}
+
+	return i;
+  806569:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80656d:	48 83 c4 40          	add    $0x40,%rsp
+  806571:	5b                   	pop    %rbx
+  806572:	41 5f                	pop    %r15
+  806574:	5d                   	pop    %rbp
+  806575:	c3                   	ret
+
+0000000000806576 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806576:	55                   	push   %rbp
+  806577:	48 89 e5             	mov    %rsp,%rbp
+  80657a:	41 57                	push   %r15
+  80657c:	53                   	push   %rbx
+  80657d:	48 83 ec 20          	sub    $0x20,%rsp
+  806581:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806581 <devpipe_stat+0xb>
+  806588:	49 bb b7 2a 00 00 00 	movabs $0x2ab7,%r11
+  80658f:	00 00 00 
+  806592:	4c 01 db             	add    %r11,%rbx
+  806595:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806599:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80659d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065a1:	48 89 c7             	mov    %rax,%rdi
+  8065a4:	49 89 df             	mov    %rbx,%r15
+  8065a7:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  8065ae:	ff ff ff 
+  8065b1:	48 01 d8             	add    %rbx,%rax
+  8065b4:	ff d0                	call   *%rax
+  8065b6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8065ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065be:	48 ba 64 ea ff ff ff 	movabs $0xffffffffffffea64,%rdx
+  8065c5:	ff ff ff 
+  8065c8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8065cc:	48 89 d6             	mov    %rdx,%rsi
+  8065cf:	48 89 c7             	mov    %rax,%rdi
+  8065d2:	49 89 df             	mov    %rbx,%r15
+  8065d5:	48 b8 b2 84 ff ff ff 	movabs $0xffffffffffff84b2,%rax
+  8065dc:	ff ff ff 
+  8065df:	48 01 d8             	add    %rbx,%rax
+  8065e2:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8065e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065e8:	8b 50 04             	mov    0x4(%rax),%edx
+  8065eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065ef:	8b 00                	mov    (%rax),%eax
+  8065f1:	29 c2                	sub    %eax,%edx
+  8065f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065f7:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8065fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806601:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806608:	00 00 00 
+	stat->st_dev = &devpipe;
+  80660b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80660f:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  806616:	00 00 00 
+  806619:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80661d:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806624:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806629:	48 83 c4 20          	add    $0x20,%rsp
+  80662d:	5b                   	pop    %rbx
+  80662e:	41 5f                	pop    %r15
+  806630:	5d                   	pop    %rbp
+  806631:	c3                   	ret
+
+0000000000806632 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806632:	55                   	push   %rbp
+  806633:	48 89 e5             	mov    %rsp,%rbp
+  806636:	41 57                	push   %r15
+  806638:	53                   	push   %rbx
+  806639:	48 83 ec 10          	sub    $0x10,%rsp
+  80663d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80663d <devpipe_close+0xb>
+  806644:	49 bb fb 29 00 00 00 	movabs $0x29fb,%r11
+  80664b:	00 00 00 
+  80664e:	4c 01 db             	add    %r11,%rbx
+  806651:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806655:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806659:	48 89 c6             	mov    %rax,%rsi
+  80665c:	bf 00 00 00 00       	mov    $0x0,%edi
+  806661:	49 89 df             	mov    %rbx,%r15
+  806664:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  80666b:	ff ff ff 
+  80666e:	48 01 d8             	add    %rbx,%rax
+  806671:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  806673:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806677:	48 89 c7             	mov    %rax,%rdi
+  80667a:	49 89 df             	mov    %rbx,%r15
+  80667d:	48 b8 4e 99 ff ff ff 	movabs $0xffffffffffff994e,%rax
+  806684:	ff ff ff 
+  806687:	48 01 d8             	add    %rbx,%rax
+  80668a:	ff d0                	call   *%rax
+  80668c:	48 89 c6             	mov    %rax,%rsi
+  80668f:	bf 00 00 00 00       	mov    $0x0,%edi
+  806694:	49 89 df             	mov    %rbx,%r15
+  806697:	48 b8 46 92 ff ff ff 	movabs $0xffffffffffff9246,%rax
+  80669e:	ff ff ff 
+  8066a1:	48 01 d8             	add    %rbx,%rax
+  8066a4:	ff d0                	call   *%rax
+}
+  8066a6:	48 83 c4 10          	add    $0x10,%rsp
+  8066aa:	5b                   	pop    %rbx
+  8066ab:	41 5f                	pop    %r15
+  8066ad:	5d                   	pop    %rbp
+  8066ae:	c3                   	ret
+
+00000000008066af <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8066af:	55                   	push   %rbp
+  8066b0:	48 89 e5             	mov    %rsp,%rbp
+  8066b3:	41 57                	push   %r15
+  8066b5:	48 83 ec 28          	sub    $0x28,%rsp
+  8066b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8066b9 <cputchar+0xa>
+  8066c0:	49 bb 7f 29 00 00 00 	movabs $0x297f,%r11
+  8066c7:	00 00 00 
+  8066ca:	4c 01 d8             	add    %r11,%rax
+  8066cd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8066d0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8066d3:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8066d6:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8066da:	be 01 00 00 00       	mov    $0x1,%esi
+  8066df:	48 89 d7             	mov    %rdx,%rdi
+  8066e2:	49 89 c7             	mov    %rax,%r15
+  8066e5:	48 ba b6 8f ff ff ff 	movabs $0xffffffffffff8fb6,%rdx
+  8066ec:	ff ff ff 
+  8066ef:	48 01 c2             	add    %rax,%rdx
+  8066f2:	ff d2                	call   *%rdx
+}
+  8066f4:	90                   	nop
+  8066f5:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8066f9:	c9                   	leave
+  8066fa:	c3                   	ret
+
+00000000008066fb <getchar>:
+
+int
+getchar(void)
+{
+  8066fb:	55                   	push   %rbp
+  8066fc:	48 89 e5             	mov    %rsp,%rbp
+  8066ff:	41 57                	push   %r15
+  806701:	48 83 ec 18          	sub    $0x18,%rsp
+  806705:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806705 <getchar+0xa>
+  80670c:	49 bb 33 29 00 00 00 	movabs $0x2933,%r11
+  806713:	00 00 00 
+  806716:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806719:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80671d:	ba 01 00 00 00       	mov    $0x1,%edx
+  806722:	48 89 ce             	mov    %rcx,%rsi
+  806725:	bf 00 00 00 00       	mov    $0x0,%edi
+  80672a:	49 89 c7             	mov    %rax,%r15
+  80672d:	48 b9 8e 9f ff ff ff 	movabs $0xffffffffffff9f8e,%rcx
+  806734:	ff ff ff 
+  806737:	48 01 c1             	add    %rax,%rcx
+  80673a:	ff d1                	call   *%rcx
+  80673c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80673f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806743:	79 05                	jns    80674a <getchar+0x4f>
+		return r;
+  806745:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806748:	eb 14                	jmp    80675e <getchar+0x63>
+	if (r < 1)
+  80674a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80674e:	7f 07                	jg     806757 <getchar+0x5c>
+		return -E_EOF;
+  806750:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806755:	eb 07                	jmp    80675e <getchar+0x63>
+	return c;
+  806757:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  80675b:	0f b6 c0             	movzbl %al,%eax
+}
+  80675e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806762:	c9                   	leave
+  806763:	c3                   	ret
+
+0000000000806764 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806764:	55                   	push   %rbp
+  806765:	48 89 e5             	mov    %rsp,%rbp
+  806768:	41 57                	push   %r15
+  80676a:	53                   	push   %rbx
+  80676b:	48 83 ec 20          	sub    $0x20,%rsp
+  80676f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80676f <iscons+0xb>
+  806776:	49 bb c9 28 00 00 00 	movabs $0x28c9,%r11
+  80677d:	00 00 00 
+  806780:	4c 01 db             	add    %r11,%rbx
+  806783:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806786:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80678a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80678d:	48 89 d6             	mov    %rdx,%rsi
+  806790:	89 c7                	mov    %eax,%edi
+  806792:	49 89 df             	mov    %rbx,%r15
+  806795:	48 b8 47 9a ff ff ff 	movabs $0xffffffffffff9a47,%rax
+  80679c:	ff ff ff 
+  80679f:	48 01 d8             	add    %rbx,%rax
+  8067a2:	ff d0                	call   *%rax
+  8067a4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8067a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067ab:	79 05                	jns    8067b2 <iscons+0x4e>
+		return r;
+  8067ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067b0:	eb 1b                	jmp    8067cd <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8067b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067b6:	8b 10                	mov    (%rax),%edx
+  8067b8:	48 b8 08 01 00 00 00 	movabs $0x108,%rax
+  8067bf:	00 00 00 
+  8067c2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8067c5:	39 c2                	cmp    %eax,%edx
+  8067c7:	0f 94 c0             	sete   %al
+  8067ca:	0f b6 c0             	movzbl %al,%eax
+}
+  8067cd:	48 83 c4 20          	add    $0x20,%rsp
+  8067d1:	5b                   	pop    %rbx
+  8067d2:	41 5f                	pop    %r15
+  8067d4:	5d                   	pop    %rbp
+  8067d5:	c3                   	ret
+
+00000000008067d6 <opencons>:
+
+int
+opencons(void)
+{
+  8067d6:	55                   	push   %rbp
+  8067d7:	48 89 e5             	mov    %rsp,%rbp
+  8067da:	41 57                	push   %r15
+  8067dc:	53                   	push   %rbx
+  8067dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8067e1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067e1 <opencons+0xb>
+  8067e8:	49 bb 57 28 00 00 00 	movabs $0x2857,%r11
+  8067ef:	00 00 00 
+  8067f2:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8067f5:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8067f9:	48 89 c7             	mov    %rax,%rdi
+  8067fc:	49 89 df             	mov    %rbx,%r15
+  8067ff:	48 b8 91 99 ff ff ff 	movabs $0xffffffffffff9991,%rax
+  806806:	ff ff ff 
+  806809:	48 01 d8             	add    %rbx,%rax
+  80680c:	ff d0                	call   *%rax
+  80680e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806811:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806815:	79 05                	jns    80681c <opencons+0x46>
+		return r;
+  806817:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80681a:	eb 68                	jmp    806884 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80681c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806820:	ba 07 04 00 00       	mov    $0x407,%edx
+  806825:	48 89 c6             	mov    %rax,%rsi
+  806828:	bf 00 00 00 00       	mov    $0x0,%edi
+  80682d:	49 89 df             	mov    %rbx,%r15
+  806830:	48 b8 6e 91 ff ff ff 	movabs $0xffffffffffff916e,%rax
+  806837:	ff ff ff 
+  80683a:	48 01 d8             	add    %rbx,%rax
+  80683d:	ff d0                	call   *%rax
+  80683f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806842:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806846:	79 05                	jns    80684d <opencons+0x77>
+		return r;
+  806848:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80684b:	eb 37                	jmp    806884 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80684d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806851:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  806858:	00 00 00 
+  80685b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80685e:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806860:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806864:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  80686b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80686f:	48 89 c7             	mov    %rax,%rdi
+  806872:	49 89 df             	mov    %rbx,%r15
+  806875:	48 b8 17 99 ff ff ff 	movabs $0xffffffffffff9917,%rax
+  80687c:	ff ff ff 
+  80687f:	48 01 d8             	add    %rbx,%rax
+  806882:	ff d0                	call   *%rax
+}
+  806884:	48 83 c4 10          	add    $0x10,%rsp
+  806888:	5b                   	pop    %rbx
+  806889:	41 5f                	pop    %r15
+  80688b:	5d                   	pop    %rbp
+  80688c:	c3                   	ret
+
+000000000080688d <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80688d:	55                   	push   %rbp
+  80688e:	48 89 e5             	mov    %rsp,%rbp
+  806891:	41 57                	push   %r15
+  806893:	53                   	push   %rbx
+  806894:	48 83 ec 30          	sub    $0x30,%rsp
+  806898:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806898 <devcons_read+0xb>
+  80689f:	49 bb a0 27 00 00 00 	movabs $0x27a0,%r11
+  8068a6:	00 00 00 
+  8068a9:	4c 01 db             	add    %r11,%rbx
+  8068ac:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8068b0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8068b4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8068b8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8068bd:	75 19                	jne    8068d8 <devcons_read+0x4b>
+		return 0;
+  8068bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068c4:	eb 55                	jmp    80691b <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8068c6:	49 89 df             	mov    %rbx,%r15
+  8068c9:	48 b8 19 91 ff ff ff 	movabs $0xffffffffffff9119,%rax
+  8068d0:	ff ff ff 
+  8068d3:	48 01 d8             	add    %rbx,%rax
+  8068d6:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8068d8:	49 89 df             	mov    %rbx,%r15
+  8068db:	48 b8 15 90 ff ff ff 	movabs $0xffffffffffff9015,%rax
+  8068e2:	ff ff ff 
+  8068e5:	48 01 d8             	add    %rbx,%rax
+  8068e8:	ff d0                	call   *%rax
+  8068ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8068ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068f1:	74 d3                	je     8068c6 <devcons_read+0x39>
+	if (c < 0)
+  8068f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068f7:	79 05                	jns    8068fe <devcons_read+0x71>
+		return c;
+  8068f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068fc:	eb 1d                	jmp    80691b <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8068fe:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806902:	75 07                	jne    80690b <devcons_read+0x7e>
+		return 0;
+  806904:	b8 00 00 00 00       	mov    $0x0,%eax
+  806909:	eb 10                	jmp    80691b <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  80690b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80690e:	89 c2                	mov    %eax,%edx
+  806910:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806914:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806916:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80691b:	48 83 c4 30          	add    $0x30,%rsp
+  80691f:	5b                   	pop    %rbx
+  806920:	41 5f                	pop    %r15
+  806922:	5d                   	pop    %rbp
+  806923:	c3                   	ret
+
+0000000000806924 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806924:	55                   	push   %rbp
+  806925:	48 89 e5             	mov    %rsp,%rbp
+  806928:	41 57                	push   %r15
+  80692a:	53                   	push   %rbx
+  80692b:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806932:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806932 <devcons_write+0xe>
+  806939:	49 bb 06 27 00 00 00 	movabs $0x2706,%r11
+  806940:	00 00 00 
+  806943:	4c 01 db             	add    %r11,%rbx
+  806946:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80694d:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806954:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  80695b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806962:	e9 80 00 00 00       	jmp    8069e7 <devcons_write+0xc3>
+		m = n - tot;
+  806967:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80696e:	89 c2                	mov    %eax,%edx
+  806970:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806973:	29 c2                	sub    %eax,%edx
+  806975:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806978:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80697b:	83 f8 7f             	cmp    $0x7f,%eax
+  80697e:	76 07                	jbe    806987 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806980:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806987:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80698a:	48 63 d0             	movslq %eax,%rdx
+  80698d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806990:	48 63 c8             	movslq %eax,%rcx
+  806993:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80699a:	48 01 c1             	add    %rax,%rcx
+  80699d:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8069a4:	48 89 ce             	mov    %rcx,%rsi
+  8069a7:	48 89 c7             	mov    %rax,%rdi
+  8069aa:	49 89 df             	mov    %rbx,%r15
+  8069ad:	48 b8 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rax
+  8069b4:	ff ff ff 
+  8069b7:	48 01 d8             	add    %rbx,%rax
+  8069ba:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8069bc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8069bf:	48 63 d0             	movslq %eax,%rdx
+  8069c2:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8069c9:	48 89 d6             	mov    %rdx,%rsi
+  8069cc:	48 89 c7             	mov    %rax,%rdi
+  8069cf:	49 89 df             	mov    %rbx,%r15
+  8069d2:	48 b8 b6 8f ff ff ff 	movabs $0xffffffffffff8fb6,%rax
+  8069d9:	ff ff ff 
+  8069dc:	48 01 d8             	add    %rbx,%rax
+  8069df:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8069e1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8069e4:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8069e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069ea:	48 98                	cltq
+  8069ec:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8069f3:	0f 82 6e ff ff ff    	jb     806967 <devcons_write+0x43>
+	}
+	return tot;
+  8069f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8069fc:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806a03:	5b                   	pop    %rbx
+  806a04:	41 5f                	pop    %r15
+  806a06:	5d                   	pop    %rbp
+  806a07:	c3                   	ret
+
+0000000000806a08 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806a08:	55                   	push   %rbp
+  806a09:	48 89 e5             	mov    %rsp,%rbp
+  806a0c:	48 83 ec 08          	sub    $0x8,%rsp
+  806a10:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a10 <devcons_close+0x8>
+  806a17:	49 bb 28 26 00 00 00 	movabs $0x2628,%r11
+  806a1e:	00 00 00 
+  806a21:	4c 01 d8             	add    %r11,%rax
+  806a24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806a28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a2d:	c9                   	leave
+  806a2e:	c3                   	ret
+
+0000000000806a2f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806a2f:	55                   	push   %rbp
+  806a30:	48 89 e5             	mov    %rsp,%rbp
+  806a33:	41 57                	push   %r15
+  806a35:	48 83 ec 18          	sub    $0x18,%rsp
+  806a39:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a39 <devcons_stat+0xa>
+  806a40:	49 bb ff 25 00 00 00 	movabs $0x25ff,%r11
+  806a47:	00 00 00 
+  806a4a:	4c 01 d8             	add    %r11,%rax
+  806a4d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806a51:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806a55:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806a59:	48 b9 70 ea ff ff ff 	movabs $0xffffffffffffea70,%rcx
+  806a60:	ff ff ff 
+  806a63:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806a67:	48 89 ce             	mov    %rcx,%rsi
+  806a6a:	48 89 d7             	mov    %rdx,%rdi
+  806a6d:	49 89 c7             	mov    %rax,%r15
+  806a70:	48 ba b2 84 ff ff ff 	movabs $0xffffffffffff84b2,%rdx
+  806a77:	ff ff ff 
+  806a7a:	48 01 c2             	add    %rax,%rdx
+  806a7d:	ff d2                	call   *%rdx
+	return 0;
+  806a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a84:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806a88:	c9                   	leave
+  806a89:	c3                   	ret
+
+0000000000806a8a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806a8a:	55                   	push   %rbp
+  806a8b:	48 89 e5             	mov    %rsp,%rbp
+  806a8e:	41 57                	push   %r15
+  806a90:	53                   	push   %rbx
+  806a91:	48 83 ec 30          	sub    $0x30,%rsp
+  806a95:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a95 <ipc_recv+0xb>
+  806a9c:	49 bb a3 25 00 00 00 	movabs $0x25a3,%r11
+  806aa3:	00 00 00 
+  806aa6:	4c 01 db             	add    %r11,%rbx
+  806aa9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806aad:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806ab1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  806ab5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806aba:	75 0e                	jne    806aca <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  806abc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806ac3:	00 00 00 
+  806ac6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  806aca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806ace:	48 89 c7             	mov    %rax,%rdi
+  806ad1:	49 89 df             	mov    %rbx,%r15
+  806ad4:	48 b8 97 94 ff ff ff 	movabs $0xffffffffffff9497,%rax
+  806adb:	ff ff ff 
+  806ade:	48 01 d8             	add    %rbx,%rax
+  806ae1:	ff d0                	call   *%rax
+  806ae3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  806ae6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806aeb:	74 2a                	je     806b17 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  806aed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806af1:	75 19                	jne    806b0c <ipc_recv+0x82>
+  806af3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806afa:	ff ff ff 
+  806afd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b01:	48 8b 00             	mov    (%rax),%rax
+  806b04:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806b0a:	eb 05                	jmp    806b11 <ipc_recv+0x87>
+  806b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b11:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806b15:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806b17:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806b1c:	74 2a                	je     806b48 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  806b1e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b22:	75 19                	jne    806b3d <ipc_recv+0xb3>
+  806b24:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b2b:	ff ff ff 
+  806b2e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b32:	48 8b 00             	mov    (%rax),%rax
+  806b35:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806b3b:	eb 05                	jmp    806b42 <ipc_recv+0xb8>
+  806b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b42:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806b46:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806b48:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b4c:	74 05                	je     806b53 <ipc_recv+0xc9>
+		return res;
+  806b4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b51:	eb 17                	jmp    806b6a <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806b53:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b5a:	ff ff ff 
+  806b5d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b61:	48 8b 00             	mov    (%rax),%rax
+  806b64:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806b6a:	48 83 c4 30          	add    $0x30,%rsp
+  806b6e:	5b                   	pop    %rbx
+  806b6f:	41 5f                	pop    %r15
+  806b71:	5d                   	pop    %rbp
+  806b72:	c3                   	ret
+
+0000000000806b73 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806b73:	55                   	push   %rbp
+  806b74:	48 89 e5             	mov    %rsp,%rbp
+  806b77:	41 57                	push   %r15
+  806b79:	53                   	push   %rbx
+  806b7a:	48 83 ec 20          	sub    $0x20,%rsp
+  806b7e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b7e <ipc_send+0xb>
+  806b85:	49 bb ba 24 00 00 00 	movabs $0x24ba,%r11
+  806b8c:	00 00 00 
+  806b8f:	4c 01 db             	add    %r11,%rbx
+  806b92:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806b95:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806b98:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806b9c:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  806b9f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806ba4:	75 0e                	jne    806bb4 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806ba6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806bad:	00 00 00 
+  806bb0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  806bb4:	90                   	nop
+  806bb5:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806bb8:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806bbb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806bbf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bc2:	89 c7                	mov    %eax,%edi
+  806bc4:	49 89 df             	mov    %rbx,%r15
+  806bc7:	48 b8 2d 94 ff ff ff 	movabs $0xffffffffffff942d,%rax
+  806bce:	ff ff ff 
+  806bd1:	48 01 d8             	add    %rbx,%rax
+  806bd4:	ff d0                	call   *%rax
+  806bd6:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  806bd9:	74 da                	je     806bb5 <ipc_send+0x42>
+		;
+}
+  806bdb:	90                   	nop
+  806bdc:	90                   	nop
+  806bdd:	48 83 c4 20          	add    $0x20,%rsp
+  806be1:	5b                   	pop    %rbx
+  806be2:	41 5f                	pop    %r15
+  806be4:	5d                   	pop    %rbp
+  806be5:	c3                   	ret
+
+0000000000806be6 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  806be6:	55                   	push   %rbp
+  806be7:	48 89 e5             	mov    %rsp,%rbp
+  806bea:	41 57                	push   %r15
+  806bec:	53                   	push   %rbx
+  806bed:	48 83 ec 40          	sub    $0x40,%rsp
+  806bf1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806bf1 <ipc_call+0xb>
+  806bf8:	49 bb 47 24 00 00 00 	movabs $0x2447,%r11
+  806bff:	00 00 00 
+  806c02:	4c 01 db             	add    %r11,%rbx
+  806c05:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806c08:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806c0b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806c0f:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806c12:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806c16:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806c1a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806c1f:	75 0e                	jne    806c2f <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806c21:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806c28:	00 00 00 
+  806c2b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806c2f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806c34:	75 0e                	jne    806c44 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806c36:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806c3d:	00 00 00 
+  806c40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806c44:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806c47:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806c4b:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806c4e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806c52:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806c55:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806c5b:	49 89 f8             	mov    %rdi,%r8
+  806c5e:	89 c7                	mov    %eax,%edi
+  806c60:	49 89 df             	mov    %rbx,%r15
+  806c63:	48 b8 f0 94 ff ff ff 	movabs $0xffffffffffff94f0,%rax
+  806c6a:	ff ff ff 
+  806c6d:	48 01 d8             	add    %rbx,%rax
+  806c70:	ff d0                	call   *%rax
+  806c72:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806c75:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806c7a:	74 2a                	je     806ca6 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806c7c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c80:	75 19                	jne    806c9b <ipc_call+0xb5>
+  806c82:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c89:	ff ff ff 
+  806c8c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c90:	48 8b 00             	mov    (%rax),%rax
+  806c93:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806c99:	eb 05                	jmp    806ca0 <ipc_call+0xba>
+  806c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ca0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806ca4:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806ca6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806caa:	74 05                	je     806cb1 <ipc_call+0xcb>
+		return r;
+  806cac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806caf:	eb 17                	jmp    806cc8 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806cb1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806cb8:	ff ff ff 
+  806cbb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806cbf:	48 8b 00             	mov    (%rax),%rax
+  806cc2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806cc8:	48 83 c4 40          	add    $0x40,%rsp
+  806ccc:	5b                   	pop    %rbx
+  806ccd:	41 5f                	pop    %r15
+  806ccf:	5d                   	pop    %rbp
+  806cd0:	c3                   	ret
+
+0000000000806cd1 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806cd1:	55                   	push   %rbp
+  806cd2:	48 89 e5             	mov    %rsp,%rbp
+  806cd5:	41 57                	push   %r15
+  806cd7:	53                   	push   %rbx
+  806cd8:	48 83 ec 70          	sub    $0x70,%rsp
+  806cdc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806cdc <ipc_callw+0xb>
+  806ce3:	49 bb 5c 23 00 00 00 	movabs $0x235c,%r11
+  806cea:	00 00 00 
+  806ced:	4c 01 db             	add    %r11,%rbx
+  806cf0:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806cf3:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806cf6:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806cfa:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806cfe:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806d03:	76 0a                	jbe    806d0f <ipc_callw+0x3e>
+		return -E_INVAL;
+  806d05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806d0a:	e9 b7 00 00 00       	jmp    806dc6 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806d0f:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806d13:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806d17:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806d1b:	48 89 ce             	mov    %rcx,%rsi
+  806d1e:	48 89 c7             	mov    %rax,%rdi
+  806d21:	49 89 df             	mov    %rbx,%r15
+  806d24:	48 b8 92 88 ff ff ff 	movabs $0xffffffffffff8892,%rax
+  806d2b:	ff ff ff 
+  806d2e:	48 01 d8             	add    %rbx,%rax
+  806d31:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806d33:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806d3a:	00 
+  806d3b:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806d3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806d43:	48 01 d0             	add    %rdx,%rax
+  806d46:	48 83 e8 01          	sub    $0x1,%rax
+  806d4a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806d4e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  806d57:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806d5b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d5f:	48 29 d0             	sub    %rdx,%rax
+  806d62:	48 c1 e8 03          	shr    $0x3,%rax
+  806d66:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806d6a:	89 c1                	mov    %eax,%ecx
+  806d6c:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806d6f:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806d73:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806d76:	49 89 d1             	mov    %rdx,%r9
+  806d79:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806d80:	00 00 00 
+  806d83:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806d8a:	00 00 00 
+  806d8d:	89 c7                	mov    %eax,%edi
+  806d8f:	49 89 df             	mov    %rbx,%r15
+  806d92:	48 b8 f0 94 ff ff ff 	movabs $0xffffffffffff94f0,%rax
+  806d99:	ff ff ff 
+  806d9c:	48 01 d8             	add    %rbx,%rax
+  806d9f:	ff d0                	call   *%rax
+  806da1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806da4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806da8:	74 05                	je     806daf <ipc_callw+0xde>
+		return r;
+  806daa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806dad:	eb 17                	jmp    806dc6 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806daf:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806db6:	ff ff ff 
+  806db9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806dbd:	48 8b 00             	mov    (%rax),%rax
+  806dc0:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806dc6:	48 83 c4 70          	add    $0x70,%rsp
+  806dca:	5b                   	pop    %rbx
+  806dcb:	41 5f                	pop    %r15
+  806dcd:	5d                   	pop    %rbp
+  806dce:	c3                   	ret
+
+0000000000806dcf <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806dcf:	55                   	push   %rbp
+  806dd0:	48 89 e5             	mov    %rsp,%rbp
+  806dd3:	41 57                	push   %r15
+  806dd5:	53                   	push   %rbx
+  806dd6:	48 83 ec 40          	sub    $0x40,%rsp
+  806dda:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806dda <ipc_callv+0xb>
+  806de1:	49 bb 5e 22 00 00 00 	movabs $0x225e,%r11
+  806de8:	00 00 00 
+  806deb:	4c 01 db             	add    %r11,%rbx
+  806dee:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806df1:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806df4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806df8:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806dfb:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806dff:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806e03:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806e0a:	00 00 00 
+  806e0d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806e11:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806e15:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806e19:	74 11                	je     806e2c <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806e1b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806e1f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806e23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806e26:	c1 e0 14             	shl    $0x14,%eax
+  806e29:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806e2c:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806e30:	74 14                	je     806e46 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806e32:	8b 45 20             	mov    0x20(%rbp),%eax
+  806e35:	83 e8 01             	sub    $0x1,%eax
+  806e38:	48 63 d0             	movslq %eax,%rdx
+  806e3b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806e3f:	48 09 d0             	or     %rdx,%rax
+  806e42:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806e46:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806e49:	c1 e0 10             	shl    $0x10,%eax
+  806e4c:	0b 45 10             	or     0x10(%rbp),%eax
+  806e4f:	89 c1                	mov    %eax,%ecx
+  806e51:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806e54:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806e58:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806e5c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806e60:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806e63:	4d 89 c1             	mov    %r8,%r9
+  806e66:	49 89 f8             	mov    %rdi,%r8
+  806e69:	89 c7                	mov    %eax,%edi
+  806e6b:	49 89 df             	mov    %rbx,%r15
+  806e6e:	48 b8 f0 94 ff ff ff 	movabs $0xffffffffffff94f0,%rax
+  806e75:	ff ff ff 
+  806e78:	48 01 d8             	add    %rbx,%rax
+  806e7b:	ff d0                	call   *%rax
+  806e7d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806e80:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806e84:	74 05                	je     806e8b <ipc_callv+0xbc>
+		return r;
+  806e86:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806e89:	eb 17                	jmp    806ea2 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806e8b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806e92:	ff ff ff 
+  806e95:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e99:	48 8b 00             	mov    (%rax),%rax
+  806e9c:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806ea2:	48 83 c4 40          	add    $0x40,%rsp
+  806ea6:	5b                   	pop    %rbx
+  806ea7:	41 5f                	pop    %r15
+  806ea9:	5d                   	pop    %rbp
+  806eaa:	c3                   	ret
+
+0000000000806eab <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806eab:	55                   	push   %rbp
+  806eac:	48 89 e5             	mov    %rsp,%rbp
+  806eaf:	41 57                	push   %r15
+  806eb1:	53                   	push   %rbx
+  806eb2:	48 83 ec 40          	sub    $0x40,%rsp
+  806eb6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806eb6 <ipc_reply_recv+0xb>
+  806ebd:	49 bb 82 21 00 00 00 	movabs $0x2182,%r11
+  806ec4:	00 00 00 
+  806ec7:	4c 01 db             	add    %r11,%rbx
+  806eca:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806ecd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806ed0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806ed4:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806ed7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806edb:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806edf:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806ee4:	75 0e                	jne    806ef4 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806ee6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806eed:	00 00 00 
+  806ef0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806ef4:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806ef9:	75 0e                	jne    806f09 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806efb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806f02:	00 00 00 
+  806f05:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806f09:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806f0c:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806f10:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806f14:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806f17:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806f1b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806f1e:	4d 89 c1             	mov    %r8,%r9
+  806f21:	49 89 f8             	mov    %rdi,%r8
+  806f24:	89 c7                	mov    %eax,%edi
+  806f26:	49 89 df             	mov    %rbx,%r15
+  806f29:	48 b8 64 95 ff ff ff 	movabs $0xffffffffffff9564,%rax
+  806f30:	ff ff ff 
+  806f33:	48 01 d8             	add    %rbx,%rax
+  806f36:	ff d0                	call   *%rax
+  806f38:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806f3b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806f40:	74 2a                	je     806f6c <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806f42:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806f46:	75 19                	jne    806f61 <ipc_reply_recv+0xb6>
+  806f48:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806f4f:	ff ff ff 
+  806f52:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806f56:	48 8b 00             	mov    (%rax),%rax
+  806f59:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806f5f:	eb 05                	jmp    806f66 <ipc_reply_recv+0xbb>
+  806f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806f6a:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806f6c:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806f71:	74 2a                	je     806f9d <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806f73:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806f77:	75 19                	jne    806f92 <ipc_reply_recv+0xe7>
+  806f79:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806f80:	ff ff ff 
+  806f83:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806f87:	48 8b 00             	mov    (%rax),%rax
+  806f8a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806f90:	eb 05                	jmp    806f97 <ipc_reply_recv+0xec>
+  806f92:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f97:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806f9b:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806f9d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806fa1:	74 05                	je     806fa8 <ipc_reply_recv+0xfd>
+		return r;
+  806fa3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806fa6:	eb 17                	jmp    806fbf <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806fa8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806faf:	ff ff ff 
+  806fb2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806fb6:	48 8b 00             	mov    (%rax),%rax
+  806fb9:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806fbf:	48 83 c4 40          	add    $0x40,%rsp
+  806fc3:	5b                   	pop    %rbx
+  806fc4:	41 5f                	pop    %r15
+  806fc6:	5d                   	pop    %rbp
+  806fc7:	c3                   	ret
+
+0000000000806fc8 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806fc8:	55                   	push   %rbp
+  806fc9:	48 89 e5             	mov    %rsp,%rbp
+  806fcc:	41 57                	push   %r15
+  806fce:	53                   	push   %rbx
+  806fcf:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806fd6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806fd6 <ipc_window_batch+0xe>
+  806fdd:	49 bb 62 20 00 00 00 	movabs $0x2062,%r11
+  806fe4:	00 00 00 
+  806fe7:	4c 01 db             	add    %r11,%rbx
+  806fea:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806ff0:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806ff7:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806ffd:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  807003:	e9 15 01 00 00       	jmp    80711d <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  807008:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  80700e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  807011:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  807018:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80701b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80701e:	39 c2                	cmp    %eax,%edx
+  807020:	0f 4e c2             	cmovle %edx,%eax
+  807023:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  807026:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80702d:	eb 6b                	jmp    80709a <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  80702f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807032:	48 98                	cltq
+  807034:	48 c1 e0 05          	shl    $0x5,%rax
+  807038:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80703c:	48 01 e8             	add    %rbp,%rax
+  80703f:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  807045:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  80704b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80704e:	c1 e0 0c             	shl    $0xc,%eax
+  807051:	48 63 d0             	movslq %eax,%rdx
+  807054:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  80705b:	48 01 c2             	add    %rax,%rdx
+  80705e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807061:	48 98                	cltq
+  807063:	48 c1 e0 05          	shl    $0x5,%rax
+  807067:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80706b:	48 01 e8             	add    %rbp,%rax
+  80706e:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  807074:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  807077:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80707a:	48 98                	cltq
+  80707c:	48 c1 e0 05          	shl    $0x5,%rax
+  807080:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807084:	48 01 e8             	add    %rbp,%rax
+  807087:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  80708e:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  807094:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  807096:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80709a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80709d:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  8070a0:	7c 8d                	jl     80702f <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  8070a2:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8070a9:	74 27                	je     8070d2 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8070ab:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8070ae:	48 63 d0             	movslq %eax,%rdx
+  8070b1:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8070b8:	48 89 d6             	mov    %rdx,%rsi
+  8070bb:	48 89 c7             	mov    %rax,%rdi
+  8070be:	49 89 df             	mov    %rbx,%r15
+  8070c1:	48 b8 07 98 ff ff ff 	movabs $0xffffffffffff9807,%rax
+  8070c8:	ff ff ff 
+  8070cb:	48 01 d8             	add    %rbx,%rax
+  8070ce:	ff d0                	call   *%rax
+  8070d0:	eb 25                	jmp    8070f7 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  8070d2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8070d5:	48 63 d0             	movslq %eax,%rdx
+  8070d8:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8070df:	48 89 d6             	mov    %rdx,%rsi
+  8070e2:	48 89 c7             	mov    %rax,%rdi
+  8070e5:	49 89 df             	mov    %rbx,%r15
+  8070e8:	48 b8 65 98 ff ff ff 	movabs $0xffffffffffff9865,%rax
+  8070ef:	ff ff ff 
+  8070f2:	48 01 d8             	add    %rbx,%rax
+  8070f5:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8070f7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  8070fa:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8070fe:	79 05                	jns    807105 <ipc_window_batch+0x13d>
+			return r;
+  807100:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807103:	eb 2a                	jmp    80712f <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  807105:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807108:	c1 e0 0c             	shl    $0xc,%eax
+  80710b:	48 98                	cltq
+  80710d:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  807114:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807117:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  80711d:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  807124:	0f 8f de fe ff ff    	jg     807008 <ipc_window_batch+0x40>
+	}
+	return 0;
+  80712a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80712f:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  807136:	5b                   	pop    %rbx
+  807137:	41 5f                	pop    %r15
+  807139:	5d                   	pop    %rbp
+  80713a:	c3                   	ret
+
+000000000080713b <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  80713b:	55                   	push   %rbp
+  80713c:	48 89 e5             	mov    %rsp,%rbp
+  80713f:	48 83 ec 10          	sub    $0x10,%rsp
+  807143:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807143 <ipc_map_window+0x8>
+  80714a:	49 bb f5 1e 00 00 00 	movabs $0x1ef5,%r11
+  807151:	00 00 00 
+  807154:	4c 01 d8             	add    %r11,%rax
+  807157:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80715b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  80715e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807161:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  807165:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80716a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80716f:	49 b8 90 df ff ff ff 	movabs $0xffffffffffffdf90,%r8
+  807176:	ff ff ff 
+  807179:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80717d:	ff d0                	call   *%rax
+}
+  80717f:	c9                   	leave
+  807180:	c3                   	ret
+
+0000000000807181 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  807181:	55                   	push   %rbp
+  807182:	48 89 e5             	mov    %rsp,%rbp
+  807185:	48 83 ec 10          	sub    $0x10,%rsp
+  807189:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807189 <ipc_unmap_window+0x8>
+  807190:	49 bb af 1e 00 00 00 	movabs $0x1eaf,%r11
+  807197:	00 00 00 
+  80719a:	4c 01 d8             	add    %r11,%rax
+  80719d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8071a1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8071a4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8071a7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8071ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8071b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8071b5:	49 b8 90 df ff ff ff 	movabs $0xffffffffffffdf90,%r8
+  8071bc:	ff ff ff 
+  8071bf:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8071c3:	ff d0                	call   *%rax
+}
+  8071c5:	c9                   	leave
+  8071c6:	c3                   	ret
+
+00000000008071c7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8071c7:	55                   	push   %rbp
+  8071c8:	48 89 e5             	mov    %rsp,%rbp
+  8071cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8071cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8071cf <ipc_find_env+0x8>
+  8071d6:	49 bb 69 1e 00 00 00 	movabs $0x1e69,%r11
+  8071dd:	00 00 00 
+  8071e0:	4c 01 d8             	add    %r11,%rax
+  8071e3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  8071e6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8071ed:	eb 57                	jmp    807246 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  8071ef:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8071f6:	ff ff ff 
+  8071f9:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8071fd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  807200:	48 63 d2             	movslq %edx,%rdx
+  807203:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  80720a:	48 01 ca             	add    %rcx,%rdx
+  80720d:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  807214:	8b 12                	mov    (%rdx),%edx
+  807216:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  807219:	75 27                	jne    807242 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  80721b:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  807222:	ff ff ff 
+  807225:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807229:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80722c:	48 98                	cltq
+  80722e:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  807235:	48 01 d0             	add    %rdx,%rax
+  807238:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80723e:	8b 00                	mov    (%rax),%eax
+  807240:	eb 12                	jmp    807254 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  807242:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  807246:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80724d:	7e a0                	jle    8071ef <ipc_find_env+0x28>
+	}
+	return 0;
+  80724f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807254:	c9                   	leave
+  807255:	c3                   	ret
+
+0000000000807256 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  807256:	55                   	push   %rbp
+  807257:	48 89 e5             	mov    %rsp,%rbp
+  80725a:	48 83 ec 18          	sub    $0x18,%rsp
+  80725e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80725e <pageref+0x8>
+  807265:	49 bb da 1d 00 00 00 	movabs $0x1dda,%r11
+  80726c:	00 00 00 
+  80726f:	4c 01 d8             	add    %r11,%rax
+  807272:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  807276:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80727a:	48 89 d1             	mov    %rdx,%rcx
+  80727d:	48 c1 e9 15          	shr    $0x15,%rcx
+  807281:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  807288:	ff ff ff 
+  80728b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80728f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807293:	83 e2 01             	and    $0x1,%edx
+  807296:	48 85 d2             	test   %rdx,%rdx
+  807299:	75 07                	jne    8072a2 <pageref+0x4c>
+		return 0;
+  80729b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8072a0:	eb 64                	jmp    807306 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  8072a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8072a6:	48 89 d1             	mov    %rdx,%rcx
+  8072a9:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8072ad:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8072b4:	ff ff ff 
+  8072b7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8072bb:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8072bf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8072c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8072c7:	83 e2 01             	and    $0x1,%edx
+  8072ca:	48 85 d2             	test   %rdx,%rdx
+  8072cd:	75 07                	jne    8072d6 <pageref+0x80>
+		return 0;
+  8072cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8072d4:	eb 30                	jmp    807306 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8072d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8072da:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8072de:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  8072e5:	ff ff ff 
+  8072e8:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8072ec:	48 89 d0             	mov    %rdx,%rax
+  8072ef:	48 01 c0             	add    %rax,%rax
+  8072f2:	48 01 d0             	add    %rdx,%rax
+  8072f5:	48 c1 e0 03          	shl    $0x3,%rax
+  8072f9:	48 01 c8             	add    %rcx,%rax
+  8072fc:	48 83 c0 08          	add    $0x8,%rax
+  807300:	0f b7 00             	movzwl (%rax),%eax
+  807303:	0f b7 c0             	movzwl %ax,%eax
+}
+  807306:	c9                   	leave
+  807307:	c3                   	ret
@@ -0,0 +1,9261 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 5b 00 00 00       	call   80009c <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 10          	sub    $0x10,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb e2 7f 00 00 00 	movabs $0x7fe2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800065:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	binaryname = "idle";
+  800069:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  800070:	ff ff ff 
+  800073:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800077:	48 ba 00 de ff ff ff 	movabs $0xffffffffffffde00,%rdx
+  80007e:	ff ff ff 
+  800081:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800085:	48 89 10             	mov    %rdx,(%rax)
+	// Instead of busy-waiting like this,
+	// a better way would be to use the processor's HLT instruction
+	// to cause the processor to stop executing until the next interrupt -
+	// doing so allows the processor to conserve power more effectively.
+	while (1) {
+		sys_yield();
+  800088:	49 89 df             	mov    %rbx,%r15
+  80008b:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  800092:	ff ff ff 
+  800095:	48 01 d8             	add    %rbx,%rax
+  800098:	ff d0                	call   *%rax
+  80009a:	eb ec                	jmp    800088 <umain+0x45>
+
+000000000080009c <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80009c:	55                   	push   %rbp
+  80009d:	48 89 e5             	mov    %rsp,%rbp
+  8000a0:	41 57                	push   %r15
+  8000a2:	53                   	push   %rbx
+  8000a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8000a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000a7 <libmain+0xb>
+  8000ae:	49 bb 89 7f 00 00 00 	movabs $0x7f89,%r11
+  8000b5:	00 00 00 
+  8000b8:	4c 01 db             	add    %r11,%rbx
+  8000bb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8000be:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8000c2:	49 89 df             	mov    %rbx,%r15
+  8000c5:	48 b8 ee 84 ff ff ff 	movabs $0xffffffffffff84ee,%rax
+  8000cc:	ff ff ff 
+  8000cf:	48 01 d8             	add    %rbx,%rax
+  8000d2:	ff d0                	call   *%rax
+  8000d4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8000d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000df:	48 98                	cltq
+  8000e1:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8000e8:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8000ef:	ff ff ff 
+  8000f2:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8000f6:	48 01 c2             	add    %rax,%rdx
+  8000f9:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  800100:	00 00 00 
+  800103:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800107:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80010b:	7e 15                	jle    800122 <libmain+0x86>
+		binaryname = argv[0];
+  80010d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800111:	48 8b 00             	mov    (%rax),%rax
+  800114:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  80011b:	00 00 00 
+  80011e:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800122:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800126:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800129:	48 89 d6             	mov    %rdx,%rsi
+  80012c:	89 c7                	mov    %eax,%edi
+  80012e:	49 89 df             	mov    %rbx,%r15
+  800131:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  800138:	ff ff ff 
+  80013b:	48 01 d8             	add    %rbx,%rax
+  80013e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800140:	49 89 df             	mov    %rbx,%r15
+  800143:	48 b8 2c 81 ff ff ff 	movabs $0xffffffffffff812c,%rax
+  80014a:	ff ff ff 
+  80014d:	48 01 d8             	add    %rbx,%rax
+  800150:	ff d0                	call   *%rax
+}
+  800152:	90                   	nop
+  800153:	48 83 c4 20          	add    $0x20,%rsp
+  800157:	5b                   	pop    %rbx
+  800158:	41 5f                	pop    %r15
+  80015a:	5d                   	pop    %rbp
+  80015b:	c3                   	ret
+
+000000000080015c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80015c:	55                   	push   %rbp
+  80015d:	48 89 e5             	mov    %rsp,%rbp
+  800160:	41 57                	push   %r15
+  800162:	53                   	push   %rbx
+  800163:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800163 <exit+0x7>
+  80016a:	49 bb cd 7e 00 00 00 	movabs $0x7ecd,%r11
+  800171:	00 00 00 
+  800174:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800177:	49 89 df             	mov    %rbx,%r15
+  80017a:	48 b8 6b 91 ff ff ff 	movabs $0xffffffffffff916b,%rax
+  800181:	ff ff ff 
+  800184:	48 01 d8             	add    %rbx,%rax
+  800187:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800189:	bf 00 00 00 00       	mov    $0x0,%edi
+  80018e:	49 89 df             	mov    %rbx,%r15
+  800191:	48 b8 92 84 ff ff ff 	movabs $0xffffffffffff8492,%rax
+  800198:	ff ff ff 
+  80019b:	48 01 d8             	add    %rbx,%rax
+  80019e:	ff d0                	call   *%rax
+}
+  8001a0:	90                   	nop
+  8001a1:	5b                   	pop    %rbx
+  8001a2:	41 5f                	pop    %r15
+  8001a4:	5d                   	pop    %rbp
+  8001a5:	c3                   	ret
+
+00000000008001a6 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  8001a6:	55                   	push   %rbp
+  8001a7:	48 89 e5             	mov    %rsp,%rbp
+  8001aa:	41 57                	push   %r15
+  8001ac:	53                   	push   %rbx
+  8001ad:	48 83 ec 40          	sub    $0x40,%rsp
+  8001b1:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8001b1 <syscall+0xb>
+  8001b8:	49 bb 7f 7e 00 00 00 	movabs $0x7e7f,%r11
+  8001bf:	00 00 00 
+  8001c2:	4d 01 da             	add    %r11,%r10
+  8001c5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8001c8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8001cb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8001cf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8001d3:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8001d7:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  8001db:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001de:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8001e2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8001e6:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8001ea:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8001ee:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8001f2:	4c 89 c3             	mov    %r8,%rbx
+  8001f5:	cd 30                	int    $0x30
+  8001f7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  8001fb:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8001ff:	74 52                	je     800253 <syscall+0xad>
+  800201:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800206:	7e 4b                	jle    800253 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800208:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80020c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80020f:	49 89 d0             	mov    %rdx,%r8
+  800212:	89 c1                	mov    %eax,%ecx
+  800214:	48 b8 0f de ff ff ff 	movabs $0xffffffffffffde0f,%rax
+  80021b:	ff ff ff 
+  80021e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800222:	48 89 c2             	mov    %rax,%rdx
+  800225:	be 23 00 00 00       	mov    $0x23,%esi
+  80022a:	48 b8 2c de ff ff ff 	movabs $0xffffffffffffde2c,%rax
+  800231:	ff ff ff 
+  800234:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800238:	48 89 c7             	mov    %rax,%rdi
+  80023b:	4d 89 d7             	mov    %r10,%r15
+  80023e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800243:	49 b9 49 bc ff ff ff 	movabs $0xffffffffffffbc49,%r9
+  80024a:	ff ff ff 
+  80024d:	4d 01 d1             	add    %r10,%r9
+  800250:	41 ff d1             	call   *%r9
+
+	return ret;
+  800253:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  800257:	48 83 c4 40          	add    $0x40,%rsp
+  80025b:	5b                   	pop    %rbx
+  80025c:	41 5f                	pop    %r15
+  80025e:	5d                   	pop    %rbp
+  80025f:	c3                   	ret
+
+0000000000800260 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  800260:	55                   	push   %rbp
+  800261:	48 89 e5             	mov    %rsp,%rbp
+  800264:	41 57                	push   %r15
+  800266:	41 56                	push   %r14
+  800268:	41 55                	push   %r13
+  80026a:	41 54                	push   %r12
+  80026c:	53                   	push   %rbx
+  80026d:	48 83 ec 48          	sub    $0x48,%rsp
+  800271:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 800271 <syscall_words+0x11>
+  800278:	49 bb bf 7d 00 00 00 	movabs $0x7dbf,%r11
+  80027f:	00 00 00 
+  800282:	4d 01 de             	add    %r11,%r14
+  800285:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  800288:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  80028b:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  80028f:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  800293:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  800297:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  80029b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002a0:	74 09                	je     8002ab <syscall_words+0x4b>
+  8002a2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002a6:	48 8b 00             	mov    (%rax),%rax
+  8002a9:	eb 05                	jmp    8002b0 <syscall_words+0x50>
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  8002b3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002b8:	74 0a                	je     8002c4 <syscall_words+0x64>
+  8002ba:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002be:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8002c2:	eb 05                	jmp    8002c9 <syscall_words+0x69>
+  8002c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c9:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  8002cc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002d1:	74 0a                	je     8002dd <syscall_words+0x7d>
+  8002d3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002d7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8002db:	eb 05                	jmp    8002e2 <syscall_words+0x82>
+  8002dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e2:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8002e5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8002ea:	74 0a                	je     8002f6 <syscall_words+0x96>
+  8002ec:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8002f0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8002f4:	eb 05                	jmp    8002fb <syscall_words+0x9b>
+  8002f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fb:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  8002fe:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800303:	74 0a                	je     80030f <syscall_words+0xaf>
+  800305:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800309:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80030d:	eb 05                	jmp    800314 <syscall_words+0xb4>
+  80030f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800314:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  800317:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80031c:	74 0a                	je     800328 <syscall_words+0xc8>
+  80031e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800322:	48 8b 40 28          	mov    0x28(%rax),%rax
+  800326:	eb 05                	jmp    80032d <syscall_words+0xcd>
+  800328:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032d:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  800330:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800333:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  800337:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80033b:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  80033f:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  800343:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  800347:	cd 30                	int    $0x30
+  800349:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  80034d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  800352:	74 50                	je     8003a4 <syscall_words+0x144>
+		words[0] = r8;
+  800354:	4c 89 c2             	mov    %r8,%rdx
+  800357:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80035b:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  80035e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800362:	48 83 c0 08          	add    $0x8,%rax
+  800366:	4c 89 ca             	mov    %r9,%rdx
+  800369:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  80036c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  800370:	48 83 c0 10          	add    $0x10,%rax
+  800374:	4c 89 d2             	mov    %r10,%rdx
+  800377:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  80037a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80037e:	48 83 c0 18          	add    $0x18,%rax
+  800382:	4c 89 da             	mov    %r11,%rdx
+  800385:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  800388:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80038c:	48 83 c0 20          	add    $0x20,%rax
+  800390:	4c 89 e2             	mov    %r12,%rdx
+  800393:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  800396:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80039a:	48 83 c0 28          	add    $0x28,%rax
+  80039e:	4c 89 ea             	mov    %r13,%rdx
+  8003a1:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  8003a4:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8003a8:	74 52                	je     8003fc <syscall_words+0x19c>
+  8003aa:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8003af:	7e 4b                	jle    8003fc <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003b1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8003b5:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8003b8:	49 89 d0             	mov    %rdx,%r8
+  8003bb:	89 c1                	mov    %eax,%ecx
+  8003bd:	48 b8 0f de ff ff ff 	movabs $0xffffffffffffde0f,%rax
+  8003c4:	ff ff ff 
+  8003c7:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8003cb:	48 89 c2             	mov    %rax,%rdx
+  8003ce:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8003d3:	48 b8 2c de ff ff ff 	movabs $0xffffffffffffde2c,%rax
+  8003da:	ff ff ff 
+  8003dd:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8003e1:	48 89 c7             	mov    %rax,%rdi
+  8003e4:	4d 89 f7             	mov    %r14,%r15
+  8003e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ec:	49 b9 49 bc ff ff ff 	movabs $0xffffffffffffbc49,%r9
+  8003f3:	ff ff ff 
+  8003f6:	4d 01 f1             	add    %r14,%r9
+  8003f9:	41 ff d1             	call   *%r9
+
+	return ret;
+  8003fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  800400:	48 83 c4 48          	add    $0x48,%rsp
+  800404:	5b                   	pop    %rbx
+  800405:	41 5c                	pop    %r12
+  800407:	41 5d                	pop    %r13
+  800409:	41 5e                	pop    %r14
+  80040b:	41 5f                	pop    %r15
+  80040d:	5d                   	pop    %rbp
+  80040e:	c3                   	ret
+
+000000000080040f <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80040f:	55                   	push   %rbp
+  800410:	48 89 e5             	mov    %rsp,%rbp
+  800413:	48 83 ec 10          	sub    $0x10,%rsp
+  800417:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800417 <sys_cputs+0x8>
+  80041e:	49 bb 19 7c 00 00 00 	movabs $0x7c19,%r11
+  800425:	00 00 00 
+  800428:	4c 01 d8             	add    %r11,%rax
+  80042b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80042f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  800433:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800437:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80043b:	48 83 ec 08          	sub    $0x8,%rsp
+  80043f:	6a 00                	push   $0x0
+  800441:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800447:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80044d:	be 00 00 00 00       	mov    $0x0,%esi
+  800452:	bf 00 00 00 00       	mov    $0x0,%edi
+  800457:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  80045e:	ff ff ff 
+  800461:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800465:	ff d0                	call   *%rax
+  800467:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80046b:	90                   	nop
+  80046c:	c9                   	leave
+  80046d:	c3                   	ret
+
+000000000080046e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80046e:	55                   	push   %rbp
+  80046f:	48 89 e5             	mov    %rsp,%rbp
+  800472:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800472 <sys_cgetc+0x4>
+  800479:	49 bb be 7b 00 00 00 	movabs $0x7bbe,%r11
+  800480:	00 00 00 
+  800483:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  800486:	48 83 ec 08          	sub    $0x8,%rsp
+  80048a:	6a 00                	push   $0x0
+  80048c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800492:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800498:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80049d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004ac:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  8004b3:	ff ff ff 
+  8004b6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8004ba:	ff d0                	call   *%rax
+  8004bc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8004c0:	c9                   	leave
+  8004c1:	c3                   	ret
+
+00000000008004c2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8004c2:	55                   	push   %rbp
+  8004c3:	48 89 e5             	mov    %rsp,%rbp
+  8004c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8004ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8004ca <sys_env_destroy+0x8>
+  8004d1:	49 bb 66 7b 00 00 00 	movabs $0x7b66,%r11
+  8004d8:	00 00 00 
+  8004db:	4c 01 d8             	add    %r11,%rax
+  8004de:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8004e1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8004e4:	48 63 d2             	movslq %edx,%rdx
+  8004e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8004eb:	6a 00                	push   $0x0
+  8004ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8004f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004fe:	be 01 00 00 00       	mov    $0x1,%esi
+  800503:	bf 03 00 00 00       	mov    $0x3,%edi
+  800508:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  80050f:	ff ff ff 
+  800512:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800516:	ff d0                	call   *%rax
+  800518:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80051c:	c9                   	leave
+  80051d:	c3                   	ret
+
+000000000080051e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80051e:	55                   	push   %rbp
+  80051f:	48 89 e5             	mov    %rsp,%rbp
+  800522:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800522 <sys_getenvid+0x4>
+  800529:	49 bb 0e 7b 00 00 00 	movabs $0x7b0e,%r11
+  800530:	00 00 00 
+  800533:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  800536:	48 83 ec 08          	sub    $0x8,%rsp
+  80053a:	6a 00                	push   $0x0
+  80053c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800542:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800548:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80054d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800552:	be 00 00 00 00       	mov    $0x0,%esi
+  800557:	bf 02 00 00 00       	mov    $0x2,%edi
+  80055c:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800563:	ff ff ff 
+  800566:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80056a:	ff d0                	call   *%rax
+  80056c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800570:	c9                   	leave
+  800571:	c3                   	ret
+
+0000000000800572 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800572:	55                   	push   %rbp
+  800573:	48 89 e5             	mov    %rsp,%rbp
+  800576:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800576 <sys_yield+0x4>
+  80057d:	49 bb ba 7a 00 00 00 	movabs $0x7aba,%r11
+  800584:	00 00 00 
+  800587:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80058a:	48 83 ec 08          	sub    $0x8,%rsp
+  80058e:	6a 00                	push   $0x0
+  800590:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800596:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80059c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8005ab:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8005b0:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  8005b7:	ff ff ff 
+  8005ba:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8005be:	ff d0                	call   *%rax
+  8005c0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8005c4:	90                   	nop
+  8005c5:	c9                   	leave
+  8005c6:	c3                   	ret
+
+00000000008005c7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8005c7:	55                   	push   %rbp
+  8005c8:	48 89 e5             	mov    %rsp,%rbp
+  8005cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8005cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005cf <sys_page_alloc+0x8>
+  8005d6:	49 bb 61 7a 00 00 00 	movabs $0x7a61,%r11
+  8005dd:	00 00 00 
+  8005e0:	4c 01 d8             	add    %r11,%rax
+  8005e3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8005ea:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8005ed:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8005f0:	48 63 f2             	movslq %edx,%rsi
+  8005f3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8005f7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8005fa:	48 63 d2             	movslq %edx,%rdx
+  8005fd:	48 83 ec 08          	sub    $0x8,%rsp
+  800601:	6a 00                	push   $0x0
+  800603:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800609:	49 89 f0             	mov    %rsi,%r8
+  80060c:	be 01 00 00 00       	mov    $0x1,%esi
+  800611:	bf 04 00 00 00       	mov    $0x4,%edi
+  800616:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  80061d:	ff ff ff 
+  800620:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800624:	ff d0                	call   *%rax
+  800626:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80062a:	c9                   	leave
+  80062b:	c3                   	ret
+
+000000000080062c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80062c:	55                   	push   %rbp
+  80062d:	48 89 e5             	mov    %rsp,%rbp
+  800630:	48 83 ec 20          	sub    $0x20,%rsp
+  800634:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800634 <sys_page_map+0x8>
+  80063b:	49 bb fc 79 00 00 00 	movabs $0x79fc,%r11
+  800642:	00 00 00 
+  800645:	4c 01 d8             	add    %r11,%rax
+  800648:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80064b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80064f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  800652:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800656:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80065a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80065d:	48 63 f2             	movslq %edx,%rsi
+  800660:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  800664:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800667:	48 63 fa             	movslq %edx,%rdi
+  80066a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80066e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800671:	48 63 d2             	movslq %edx,%rdx
+  800674:	48 83 ec 08          	sub    $0x8,%rsp
+  800678:	56                   	push   %rsi
+  800679:	4d 89 c1             	mov    %r8,%r9
+  80067c:	49 89 f8             	mov    %rdi,%r8
+  80067f:	be 01 00 00 00       	mov    $0x1,%esi
+  800684:	bf 05 00 00 00       	mov    $0x5,%edi
+  800689:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800690:	ff ff ff 
+  800693:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800697:	ff d0                	call   *%rax
+  800699:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80069d:	c9                   	leave
+  80069e:	c3                   	ret
+
+000000000080069f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80069f:	55                   	push   %rbp
+  8006a0:	48 89 e5             	mov    %rsp,%rbp
+  8006a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8006a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006a7 <sys_page_unmap+0x8>
+  8006ae:	49 bb 89 79 00 00 00 	movabs $0x7989,%r11
+  8006b5:	00 00 00 
+  8006b8:	4c 01 d8             	add    %r11,%rax
+  8006bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8006be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8006c2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8006c6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8006c9:	48 63 d2             	movslq %edx,%rdx
+  8006cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8006d0:	6a 00                	push   $0x0
+  8006d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006de:	be 01 00 00 00       	mov    $0x1,%esi
+  8006e3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8006e8:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  8006ef:	ff ff ff 
+  8006f2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8006f6:	ff d0                	call   *%rax
+  8006f8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8006fc:	c9                   	leave
+  8006fd:	c3                   	ret
+
+00000000008006fe <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8006fe:	55                   	push   %rbp
+  8006ff:	48 89 e5             	mov    %rsp,%rbp
+  800702:	48 83 ec 10          	sub    $0x10,%rsp
+  800706:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800706 <sys_env_set_status+0x8>
+  80070d:	49 bb 2a 79 00 00 00 	movabs $0x792a,%r11
+  800714:	00 00 00 
+  800717:	4c 01 d8             	add    %r11,%rax
+  80071a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80071d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  800720:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800723:	48 63 ca             	movslq %edx,%rcx
+  800726:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800729:	48 63 d2             	movslq %edx,%rdx
+  80072c:	48 83 ec 08          	sub    $0x8,%rsp
+  800730:	6a 00                	push   $0x0
+  800732:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800738:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80073e:	be 01 00 00 00       	mov    $0x1,%esi
+  800743:	bf 08 00 00 00       	mov    $0x8,%edi
+  800748:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  80074f:	ff ff ff 
+  800752:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800756:	ff d0                	call   *%rax
+  800758:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80075c:	c9                   	leave
+  80075d:	c3                   	ret
+
+000000000080075e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80075e:	55                   	push   %rbp
+  80075f:	48 89 e5             	mov    %rsp,%rbp
+  800762:	48 83 ec 10          	sub    $0x10,%rsp
+  800766:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800766 <sys_env_set_trapframe+0x8>
+  80076d:	49 bb ca 78 00 00 00 	movabs $0x78ca,%r11
+  800774:	00 00 00 
+  800777:	4c 01 d8             	add    %r11,%rax
+  80077a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80077d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  800781:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800785:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800788:	48 63 d2             	movslq %edx,%rdx
+  80078b:	48 83 ec 08          	sub    $0x8,%rsp
+  80078f:	6a 00                	push   $0x0
+  800791:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800797:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80079d:	be 01 00 00 00       	mov    $0x1,%esi
+  8007a2:	bf 09 00 00 00       	mov    $0x9,%edi
+  8007a7:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  8007ae:	ff ff ff 
+  8007b1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8007b5:	ff d0                	call   *%rax
+  8007b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8007bb:	c9                   	leave
+  8007bc:	c3                   	ret
+
+00000000008007bd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8007bd:	55                   	push   %rbp
+  8007be:	48 89 e5             	mov    %rsp,%rbp
+  8007c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8007c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007c5 <sys_env_set_pgfault_upcall+0x8>
+  8007cc:	49 bb 6b 78 00 00 00 	movabs $0x786b,%r11
+  8007d3:	00 00 00 
+  8007d6:	4c 01 d8             	add    %r11,%rax
+  8007d9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8007dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8007e0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8007e4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8007e7:	48 63 d2             	movslq %edx,%rdx
+  8007ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8007ee:	6a 00                	push   $0x0
+  8007f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8007f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8007fc:	be 01 00 00 00       	mov    $0x1,%esi
+  800801:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800806:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  80080d:	ff ff ff 
+  800810:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800814:	ff d0                	call   *%rax
+  800816:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80081a:	c9                   	leave
+  80081b:	c3                   	ret
+
+000000000080081c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80081c:	55                   	push   %rbp
+  80081d:	48 89 e5             	mov    %rsp,%rbp
+  800820:	48 83 ec 20          	sub    $0x20,%rsp
+  800824:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800824 <sys_ipc_try_send+0x8>
+  80082b:	49 bb 0c 78 00 00 00 	movabs $0x780c,%r11
+  800832:	00 00 00 
+  800835:	4c 01 d8             	add    %r11,%rax
+  800838:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80083b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80083f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800843:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  800846:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800849:	48 63 fa             	movslq %edx,%rdi
+  80084c:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  800850:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800853:	48 63 d2             	movslq %edx,%rdx
+  800856:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80085a:	48 83 ec 08          	sub    $0x8,%rsp
+  80085e:	6a 00                	push   $0x0
+  800860:	49 89 f9             	mov    %rdi,%r9
+  800863:	49 89 f0             	mov    %rsi,%r8
+  800866:	be 00 00 00 00       	mov    $0x0,%esi
+  80086b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  800870:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800877:	ff ff ff 
+  80087a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80087e:	ff d0                	call   *%rax
+  800880:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800884:	c9                   	leave
+  800885:	c3                   	ret
+
+0000000000800886 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  800886:	55                   	push   %rbp
+  800887:	48 89 e5             	mov    %rsp,%rbp
+  80088a:	48 83 ec 20          	sub    $0x20,%rsp
+  80088e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80088e <sys_ipc_send+0x8>
+  800895:	49 bb a2 77 00 00 00 	movabs $0x77a2,%r11
+  80089c:	00 00 00 
+  80089f:	4c 01 d8             	add    %r11,%rax
+  8008a2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8008a5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008a9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8008ad:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8008b0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8008b3:	48 63 fa             	movslq %edx,%rdi
+  8008b6:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8008ba:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8008bd:	48 63 d2             	movslq %edx,%rdx
+  8008c0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8008c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8008c8:	6a 00                	push   $0x0
+  8008ca:	49 89 f9             	mov    %rdi,%r9
+  8008cd:	49 89 f0             	mov    %rsi,%r8
+  8008d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8008d5:	bf 17 00 00 00       	mov    $0x17,%edi
+  8008da:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  8008e1:	ff ff ff 
+  8008e4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8008e8:	ff d0                	call   *%rax
+  8008ea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8008ee:	c9                   	leave
+  8008ef:	c3                   	ret
+
+00000000008008f0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8008f0:	55                   	push   %rbp
+  8008f1:	48 89 e5             	mov    %rsp,%rbp
+  8008f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8008f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008f8 <sys_ipc_recv+0x8>
+  8008ff:	49 bb 38 77 00 00 00 	movabs $0x7738,%r11
+  800906:	00 00 00 
+  800909:	4c 01 d8             	add    %r11,%rax
+  80090c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  800910:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800914:	6a 00                	push   $0x0
+  800916:	6a 00                	push   $0x0
+  800918:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80091e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800924:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800929:	be 01 00 00 00       	mov    $0x1,%esi
+  80092e:	bf 0d 00 00 00       	mov    $0xd,%edi
+  800933:	49 ba 30 82 ff ff ff 	movabs $0xffffffffffff8230,%r10
+  80093a:	ff ff ff 
+  80093d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800941:	ff d0                	call   *%rax
+  800943:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+0000000000800949 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  800949:	55                   	push   %rbp
+  80094a:	48 89 e5             	mov    %rsp,%rbp
+  80094d:	48 83 ec 30          	sub    $0x30,%rsp
+  800951:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800951 <sys_ipc_call+0x8>
+  800958:	49 bb df 76 00 00 00 	movabs $0x76df,%r11
+  80095f:	00 00 00 
+  800962:	4c 01 d8             	add    %r11,%rax
+  800965:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800968:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80096c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800970:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  800973:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  800977:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80097b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80097f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800982:	4c 63 c2             	movslq %edx,%r8
+  800985:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  800989:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80098c:	48 63 d2             	movslq %edx,%rdx
+  80098f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800993:	ff 75 d8             	push   -0x28(%rbp)
+  800996:	56                   	push   %rsi
+  800997:	4d 89 c1             	mov    %r8,%r9
+  80099a:	49 89 f8             	mov    %rdi,%r8
+  80099d:	be 00 00 00 00       	mov    $0x0,%esi
+  8009a2:	bf 18 00 00 00       	mov    $0x18,%edi
+  8009a7:	49 ba 30 82 ff ff ff 	movabs $0xffffffffffff8230,%r10
+  8009ae:	ff ff ff 
+  8009b1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8009b5:	ff d0                	call   *%rax
+  8009b7:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8009bb:	c9                   	leave
+  8009bc:	c3                   	ret
+
+00000000008009bd <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8009bd:	55                   	push   %rbp
+  8009be:	48 89 e5             	mov    %rsp,%rbp
+  8009c1:	48 83 ec 30          	sub    $0x30,%rsp
+  8009c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8009c5 <sys_ipc_reply_recv+0x8>
+  8009cc:	49 bb 6b 76 00 00 00 	movabs $0x766b,%r11
+  8009d3:	00 00 00 
+  8009d6:	4c 01 d8             	add    %r11,%rax
+  8009d9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8009dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8009e0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8009e4:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8009e7:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8009eb:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8009ef:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8009f3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8009f6:	4c 63 c2             	movslq %edx,%r8
+  8009f9:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8009fd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800a00:	48 63 d2             	movslq %edx,%rdx
+  800a03:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800a07:	ff 75 d8             	push   -0x28(%rbp)
+  800a0a:	56                   	push   %rsi
+  800a0b:	4d 89 c1             	mov    %r8,%r9
+  800a0e:	49 89 f8             	mov    %rdi,%r8
+  800a11:	be 00 00 00 00       	mov    $0x0,%esi
+  800a16:	bf 19 00 00 00       	mov    $0x19,%edi
+  800a1b:	49 ba 30 82 ff ff ff 	movabs $0xffffffffffff8230,%r10
+  800a22:	ff ff ff 
+  800a25:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800a29:	ff d0                	call   *%rax
+  800a2b:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  800a2f:	c9                   	leave
+  800a30:	c3                   	ret
+
+0000000000800a31 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  800a31:	55                   	push   %rbp
+  800a32:	48 89 e5             	mov    %rsp,%rbp
+  800a35:	48 83 ec 10          	sub    $0x10,%rsp
+  800a39:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a39 <sys_env_set_priority+0x8>
+  800a40:	49 bb f7 75 00 00 00 	movabs $0x75f7,%r11
+  800a47:	00 00 00 
+  800a4a:	4c 01 d8             	add    %r11,%rax
+  800a4d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800a50:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  800a53:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800a56:	48 63 ca             	movslq %edx,%rcx
+  800a59:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800a5c:	48 63 d2             	movslq %edx,%rdx
+  800a5f:	48 83 ec 08          	sub    $0x8,%rsp
+  800a63:	6a 00                	push   $0x0
+  800a65:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800a6b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a71:	be 01 00 00 00       	mov    $0x1,%esi
+  800a76:	bf 0f 00 00 00       	mov    $0xf,%edi
+  800a7b:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800a82:	ff ff ff 
+  800a85:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800a89:	ff d0                	call   *%rax
+  800a8b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800a8f:	c9                   	leave
+  800a90:	c3                   	ret
+
+0000000000800a91 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  800a91:	55                   	push   %rbp
+  800a92:	48 89 e5             	mov    %rsp,%rbp
+  800a95:	48 83 ec 10          	sub    $0x10,%rsp
+  800a99:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a99 <sys_env_set_affinity+0x8>
+  800aa0:	49 bb 97 75 00 00 00 	movabs $0x7597,%r11
+  800aa7:	00 00 00 
+  800aaa:	4c 01 d8             	add    %r11,%rax
+  800aad:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ab0:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  800ab3:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  800ab6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800ab9:	48 63 d2             	movslq %edx,%rdx
+  800abc:	48 83 ec 08          	sub    $0x8,%rsp
+  800ac0:	6a 00                	push   $0x0
+  800ac2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800ac8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ace:	be 01 00 00 00       	mov    $0x1,%esi
+  800ad3:	bf 10 00 00 00       	mov    $0x10,%edi
+  800ad8:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800adf:	ff ff ff 
+  800ae2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800ae6:	ff d0                	call   *%rax
+  800ae8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800aec:	c9                   	leave
+  800aed:	c3                   	ret
+
+0000000000800aee <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800aee:	55                   	push   %rbp
+  800aef:	48 89 e5             	mov    %rsp,%rbp
+  800af2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800af2 <sys_time_msec+0x4>
+  800af9:	49 bb 3e 75 00 00 00 	movabs $0x753e,%r11
+  800b00:	00 00 00 
+  800b03:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  800b06:	48 83 ec 08          	sub    $0x8,%rsp
+  800b0a:	6a 00                	push   $0x0
+  800b0c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800b12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b22:	be 00 00 00 00       	mov    $0x0,%esi
+  800b27:	bf 0e 00 00 00       	mov    $0xe,%edi
+  800b2c:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800b33:	ff ff ff 
+  800b36:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800b3a:	ff d0                	call   *%rax
+  800b3c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800b40:	c9                   	leave
+  800b41:	c3                   	ret
+
+0000000000800b42 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  800b42:	55                   	push   %rbp
+  800b43:	48 89 e5             	mov    %rsp,%rbp
+  800b46:	48 83 ec 10          	sub    $0x10,%rsp
+  800b4a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b4a <sys_sleep_usec+0x8>
+  800b51:	49 bb e6 74 00 00 00 	movabs $0x74e6,%r11
+  800b58:	00 00 00 
+  800b5b:	4c 01 d8             	add    %r11,%rax
+  800b5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  800b62:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b66:	48 83 ec 08          	sub    $0x8,%rsp
+  800b6a:	6a 00                	push   $0x0
+  800b6c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800b72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7d:	be 00 00 00 00       	mov    $0x0,%esi
+  800b82:	bf 11 00 00 00       	mov    $0x11,%edi
+  800b87:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800b8e:	ff ff ff 
+  800b91:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800b95:	ff d0                	call   *%rax
+  800b97:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800b9b:	c9                   	leave
+  800b9c:	c3                   	ret
+
+0000000000800b9d <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  800b9d:	55                   	push   %rbp
+  800b9e:	48 89 e5             	mov    %rsp,%rbp
+  800ba1:	48 83 ec 10          	sub    $0x10,%rsp
+  800ba5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ba5 <sys_page_alloc_huge+0x8>
+  800bac:	49 bb 8b 74 00 00 00 	movabs $0x748b,%r11
+  800bb3:	00 00 00 
+  800bb6:	4c 01 d8             	add    %r11,%rax
+  800bb9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800bbc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800bc0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  800bc3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800bc6:	48 63 f2             	movslq %edx,%rsi
+  800bc9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800bcd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800bd0:	48 63 d2             	movslq %edx,%rdx
+  800bd3:	48 83 ec 08          	sub    $0x8,%rsp
+  800bd7:	6a 00                	push   $0x0
+  800bd9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800bdf:	49 89 f0             	mov    %rsi,%r8
+  800be2:	be 01 00 00 00       	mov    $0x1,%esi
+  800be7:	bf 12 00 00 00       	mov    $0x12,%edi
+  800bec:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800bf3:	ff ff ff 
+  800bf6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800bfa:	ff d0                	call   *%rax
+  800bfc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800c00:	c9                   	leave
+  800c01:	c3                   	ret
+
+0000000000800c02 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  800c02:	55                   	push   %rbp
+  800c03:	48 89 e5             	mov    %rsp,%rbp
+  800c06:	48 83 ec 10          	sub    $0x10,%rsp
+  800c0a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c0a <sys_page_map_batch+0x8>
+  800c11:	49 bb 26 74 00 00 00 	movabs $0x7426,%r11
+  800c18:	00 00 00 
+  800c1b:	4c 01 d8             	add    %r11,%rax
+  800c1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800c22:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  800c26:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c2a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800c2e:	48 83 ec 08          	sub    $0x8,%rsp
+  800c32:	6a 00                	push   $0x0
+  800c34:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800c3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800c40:	be 01 00 00 00       	mov    $0x1,%esi
+  800c45:	bf 13 00 00 00       	mov    $0x13,%edi
+  800c4a:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800c51:	ff ff ff 
+  800c54:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800c58:	ff d0                	call   *%rax
+  800c5a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800c5e:	c9                   	leave
+  800c5f:	c3                   	ret
+
+0000000000800c60 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  800c60:	55                   	push   %rbp
+  800c61:	48 89 e5             	mov    %rsp,%rbp
+  800c64:	48 83 ec 10          	sub    $0x10,%rsp
+  800c68:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c68 <sys_page_alloc_batch+0x8>
+  800c6f:	49 bb c8 73 00 00 00 	movabs $0x73c8,%r11
+  800c76:	00 00 00 
+  800c79:	4c 01 d8             	add    %r11,%rax
+  800c7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800c80:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  800c84:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c88:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800c8c:	48 83 ec 08          	sub    $0x8,%rsp
+  800c90:	6a 00                	push   $0x0
+  800c92:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800c98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800c9e:	be 01 00 00 00       	mov    $0x1,%esi
+  800ca3:	bf 14 00 00 00       	mov    $0x14,%edi
+  800ca8:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800caf:	ff ff ff 
+  800cb2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800cb6:	ff d0                	call   *%rax
+  800cb8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800cbc:	c9                   	leave
+  800cbd:	c3                   	ret
+
+0000000000800cbe <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  800cbe:	55                   	push   %rbp
+  800cbf:	48 89 e5             	mov    %rsp,%rbp
+  800cc2:	48 83 ec 10          	sub    $0x10,%rsp
+  800cc6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800cc6 <sys_page_unmap_batch+0x8>
+  800ccd:	49 bb 6a 73 00 00 00 	movabs $0x736a,%r11
+  800cd4:	00 00 00 
+  800cd7:	4c 01 d8             	add    %r11,%rax
+  800cda:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800cde:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  800ce2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ce6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800cea:	48 83 ec 08          	sub    $0x8,%rsp
+  800cee:	6a 00                	push   $0x0
+  800cf0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800cf6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800cfc:	be 01 00 00 00       	mov    $0x1,%esi
+  800d01:	bf 15 00 00 00       	mov    $0x15,%edi
+  800d06:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800d0d:	ff ff ff 
+  800d10:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800d14:	ff d0                	call   *%rax
+  800d16:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800d1a:	c9                   	leave
+  800d1b:	c3                   	ret
+
+0000000000800d1c <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  800d1c:	55                   	push   %rbp
+  800d1d:	48 89 e5             	mov    %rsp,%rbp
+  800d20:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800d20 <sys_fork+0x4>
+  800d27:	49 bb 10 73 00 00 00 	movabs $0x7310,%r11
+  800d2e:	00 00 00 
+  800d31:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  800d34:	48 83 ec 08          	sub    $0x8,%rsp
+  800d38:	6a 00                	push   $0x0
+  800d3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  800d40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800d46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d50:	be 00 00 00 00       	mov    $0x0,%esi
+  800d55:	bf 16 00 00 00       	mov    $0x16,%edi
+  800d5a:	49 ba 76 81 ff ff ff 	movabs $0xffffffffffff8176,%r10
+  800d61:	ff ff ff 
+  800d64:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  800d68:	ff d0                	call   *%rax
+  800d6a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  800d6e:	c9                   	leave
+  800d6f:	c3                   	ret
+
+0000000000800d70 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  800d70:	55                   	push   %rbp
+  800d71:	48 89 e5             	mov    %rsp,%rbp
+  800d74:	48 83 ec 08          	sub    $0x8,%rsp
+  800d78:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800d78 <fd2num+0x8>
+  800d7f:	49 bb b8 72 00 00 00 	movabs $0x72b8,%r11
+  800d86:	00 00 00 
+  800d89:	4c 01 d8             	add    %r11,%rax
+  800d8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800d90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d94:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  800d9b:	ff ff ff 
+  800d9e:	48 01 d0             	add    %rdx,%rax
+  800da1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800da5:	c9                   	leave
+  800da6:	c3                   	ret
+
+0000000000800da7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800da7:	55                   	push   %rbp
+  800da8:	48 89 e5             	mov    %rsp,%rbp
+  800dab:	48 83 ec 08          	sub    $0x8,%rsp
+  800daf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800daf <fd2data+0x8>
+  800db6:	49 bb 81 72 00 00 00 	movabs $0x7281,%r11
+  800dbd:	00 00 00 
+  800dc0:	4c 01 d8             	add    %r11,%rax
+  800dc3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  800dc7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800dcb:	48 89 d7             	mov    %rdx,%rdi
+  800dce:	48 ba 40 8d ff ff ff 	movabs $0xffffffffffff8d40,%rdx
+  800dd5:	ff ff ff 
+  800dd8:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  800ddc:	ff d0                	call   *%rax
+  800dde:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800de4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800de8:	c9                   	leave
+  800de9:	c3                   	ret
+
+0000000000800dea <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800dea:	55                   	push   %rbp
+  800deb:	48 89 e5             	mov    %rsp,%rbp
+  800dee:	48 83 ec 18          	sub    $0x18,%rsp
+  800df2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800df2 <fd_alloc+0x8>
+  800df9:	49 bb 3e 72 00 00 00 	movabs $0x723e,%r11
+  800e00:	00 00 00 
+  800e03:	4c 01 d8             	add    %r11,%rax
+  800e06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800e0a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800e11:	eb 75                	jmp    800e88 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  800e13:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800e16:	48 63 d2             	movslq %edx,%rdx
+  800e19:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  800e20:	48 c1 e2 0c          	shl    $0xc,%rdx
+  800e24:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800e28:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e2c:	48 89 d1             	mov    %rdx,%rcx
+  800e2f:	48 c1 e9 15          	shr    $0x15,%rcx
+  800e33:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800e3a:	ff ff ff 
+  800e3d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800e41:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800e45:	83 e2 01             	and    $0x1,%edx
+  800e48:	48 85 d2             	test   %rdx,%rdx
+  800e4b:	74 25                	je     800e72 <fd_alloc+0x88>
+  800e4d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e51:	48 89 d1             	mov    %rdx,%rcx
+  800e54:	48 c1 e9 0c          	shr    $0xc,%rcx
+  800e58:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  800e5f:	ff ff ff 
+  800e62:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800e66:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800e6a:	83 e2 01             	and    $0x1,%edx
+  800e6d:	48 85 d2             	test   %rdx,%rdx
+  800e70:	75 12                	jne    800e84 <fd_alloc+0x9a>
+			*fd_store = fd;
+  800e72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e76:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800e7a:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  800e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e82:	eb 1a                	jmp    800e9e <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  800e84:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800e88:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  800e8c:	7e 85                	jle    800e13 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  800e8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e92:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  800e99:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  800e9e:	c9                   	leave
+  800e9f:	c3                   	ret
+
+0000000000800ea0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800ea0:	55                   	push   %rbp
+  800ea1:	48 89 e5             	mov    %rsp,%rbp
+  800ea4:	48 83 ec 20          	sub    $0x20,%rsp
+  800ea8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ea8 <fd_lookup+0x8>
+  800eaf:	49 bb 88 71 00 00 00 	movabs $0x7188,%r11
+  800eb6:	00 00 00 
+  800eb9:	4c 01 d8             	add    %r11,%rax
+  800ebc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800ebf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800ec3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800ec7:	78 06                	js     800ecf <fd_lookup+0x2f>
+  800ec9:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  800ecd:	7e 07                	jle    800ed6 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  800ecf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed4:	eb 73                	jmp    800f49 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  800ed6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800ed9:	48 63 d2             	movslq %edx,%rdx
+  800edc:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  800ee3:	48 c1 e2 0c          	shl    $0xc,%rdx
+  800ee7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800eeb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800eef:	48 89 d1             	mov    %rdx,%rcx
+  800ef2:	48 c1 e9 15          	shr    $0x15,%rcx
+  800ef6:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800efd:	ff ff ff 
+  800f00:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  800f04:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  800f08:	83 e2 01             	and    $0x1,%edx
+  800f0b:	48 85 d2             	test   %rdx,%rdx
+  800f0e:	74 22                	je     800f32 <fd_lookup+0x92>
+  800f10:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f14:	48 c1 ea 0c          	shr    $0xc,%rdx
+  800f18:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  800f1f:	ff ff ff 
+  800f22:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  800f26:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  800f2a:	83 e0 01             	and    $0x1,%eax
+  800f2d:	48 85 c0             	test   %rax,%rax
+  800f30:	75 07                	jne    800f39 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  800f32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f37:	eb 10                	jmp    800f49 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  800f39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f3d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f41:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  800f44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f49:	c9                   	leave
+  800f4a:	c3                   	ret
+
+0000000000800f4b <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  800f4b:	55                   	push   %rbp
+  800f4c:	48 89 e5             	mov    %rsp,%rbp
+  800f4f:	41 57                	push   %r15
+  800f51:	53                   	push   %rbx
+  800f52:	48 83 ec 30          	sub    $0x30,%rsp
+  800f56:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800f56 <fd_close+0xb>
+  800f5d:	49 bb da 70 00 00 00 	movabs $0x70da,%r11
+  800f64:	00 00 00 
+  800f67:	4c 01 db             	add    %r11,%rbx
+  800f6a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800f6e:	89 f0                	mov    %esi,%eax
+  800f70:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800f73:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f77:	48 89 c7             	mov    %rax,%rdi
+  800f7a:	48 b8 40 8d ff ff ff 	movabs $0xffffffffffff8d40,%rax
+  800f81:	ff ff ff 
+  800f84:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f88:	ff d0                	call   *%rax
+  800f8a:	89 c2                	mov    %eax,%edx
+  800f8c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800f90:	48 89 c6             	mov    %rax,%rsi
+  800f93:	89 d7                	mov    %edx,%edi
+  800f95:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  800f9c:	ff ff ff 
+  800f9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fa3:	ff d0                	call   *%rax
+  800fa5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800fa8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800fac:	78 0a                	js     800fb8 <fd_close+0x6d>
+	    || fd != fd2)
+  800fae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fb2:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  800fb6:	74 12                	je     800fca <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  800fb8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800fbc:	74 05                	je     800fc3 <fd_close+0x78>
+  800fbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800fc1:	eb 7a                	jmp    80103d <fd_close+0xf2>
+  800fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc8:	eb 73                	jmp    80103d <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800fca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fce:	8b 00                	mov    (%rax),%eax
+  800fd0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  800fd4:	48 89 d6             	mov    %rdx,%rsi
+  800fd7:	89 c7                	mov    %eax,%edi
+  800fd9:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  800fe0:	ff ff ff 
+  800fe3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fe7:	ff d0                	call   *%rax
+  800fe9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800fec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800ff0:	78 2a                	js     80101c <fd_close+0xd1>
+		if (dev->dev_close)
+  800ff2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ff6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800ffa:	48 85 c0             	test   %rax,%rax
+  800ffd:	74 16                	je     801015 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  800fff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801003:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  801007:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80100b:	48 89 c7             	mov    %rax,%rdi
+  80100e:	ff d2                	call   *%rdx
+  801010:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801013:	eb 07                	jmp    80101c <fd_close+0xd1>
+		else
+			r = 0;
+  801015:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  80101c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801020:	48 89 c6             	mov    %rax,%rsi
+  801023:	bf 00 00 00 00       	mov    $0x0,%edi
+  801028:	49 89 df             	mov    %rbx,%r15
+  80102b:	48 b8 6f 86 ff ff ff 	movabs $0xffffffffffff866f,%rax
+  801032:	ff ff ff 
+  801035:	48 01 d8             	add    %rbx,%rax
+  801038:	ff d0                	call   *%rax
+	return r;
+  80103a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80103d:	48 83 c4 30          	add    $0x30,%rsp
+  801041:	5b                   	pop    %rbx
+  801042:	41 5f                	pop    %r15
+  801044:	5d                   	pop    %rbp
+  801045:	c3                   	ret
+
+0000000000801046 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801046:	55                   	push   %rbp
+  801047:	48 89 e5             	mov    %rsp,%rbp
+  80104a:	41 57                	push   %r15
+  80104c:	48 83 ec 28          	sub    $0x28,%rsp
+  801050:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 801050 <dev_lookup+0xa>
+  801057:	49 bb e0 6f 00 00 00 	movabs $0x6fe0,%r11
+  80105e:	00 00 00 
+  801061:	4c 01 d9             	add    %r11,%rcx
+  801064:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801067:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80106b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801072:	eb 45                	jmp    8010b9 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  801074:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  80107b:	00 00 00 
+  80107e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801081:	48 98                	cltq
+  801083:	48 01 ca             	add    %rcx,%rdx
+  801086:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80108a:	8b 00                	mov    (%rax),%eax
+  80108c:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80108f:	75 24                	jne    8010b5 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  801091:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  801098:	00 00 00 
+  80109b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80109e:	48 98                	cltq
+  8010a0:	48 01 ca             	add    %rcx,%rdx
+  8010a3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8010a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010ab:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8010ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b3:	eb 74                	jmp    801129 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  8010b5:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8010b9:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  8010c0:	00 00 00 
+  8010c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8010c6:	48 98                	cltq
+  8010c8:	48 01 ca             	add    %rcx,%rdx
+  8010cb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8010cf:	48 85 c0             	test   %rax,%rax
+  8010d2:	75 a0                	jne    801074 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8010d4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8010db:	ff ff ff 
+  8010de:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8010e2:	48 8b 00             	mov    (%rax),%rax
+  8010e5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8010eb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8010ee:	89 c6                	mov    %eax,%esi
+  8010f0:	48 b8 40 de ff ff ff 	movabs $0xffffffffffffde40,%rax
+  8010f7:	ff ff ff 
+  8010fa:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8010fe:	48 89 c7             	mov    %rax,%rdi
+  801101:	49 89 cf             	mov    %rcx,%r15
+  801104:	b8 00 00 00 00       	mov    $0x0,%eax
+  801109:	49 b8 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%r8
+  801110:	ff ff ff 
+  801113:	49 01 c8             	add    %rcx,%r8
+  801116:	41 ff d0             	call   *%r8
+	*dev = 0;
+  801119:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80111d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  801124:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801129:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80112d:	c9                   	leave
+  80112e:	c3                   	ret
+
+000000000080112f <close>:
+
+int
+close(int fdnum)
+{
+  80112f:	55                   	push   %rbp
+  801130:	48 89 e5             	mov    %rsp,%rbp
+  801133:	53                   	push   %rbx
+  801134:	48 83 ec 28          	sub    $0x28,%rsp
+  801138:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801138 <close+0x9>
+  80113f:	49 bb f8 6e 00 00 00 	movabs $0x6ef8,%r11
+  801146:	00 00 00 
+  801149:	4c 01 db             	add    %r11,%rbx
+  80114c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80114f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801153:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801156:	48 89 d6             	mov    %rdx,%rsi
+  801159:	89 c7                	mov    %eax,%edi
+  80115b:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  801162:	ff ff ff 
+  801165:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801169:	ff d0                	call   *%rax
+  80116b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80116e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801172:	79 05                	jns    801179 <close+0x4a>
+		return r;
+  801174:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801177:	eb 1c                	jmp    801195 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  801179:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80117d:	be 01 00 00 00       	mov    $0x1,%esi
+  801182:	48 89 c7             	mov    %rax,%rdi
+  801185:	48 b8 1b 8f ff ff ff 	movabs $0xffffffffffff8f1b,%rax
+  80118c:	ff ff ff 
+  80118f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801193:	ff d0                	call   *%rax
+}
+  801195:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801199:	c9                   	leave
+  80119a:	c3                   	ret
+
+000000000080119b <close_all>:
+
+void
+close_all(void)
+{
+  80119b:	55                   	push   %rbp
+  80119c:	48 89 e5             	mov    %rsp,%rbp
+  80119f:	53                   	push   %rbx
+  8011a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8011a4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8011a4 <close_all+0x9>
+  8011ab:	49 bb 8c 6e 00 00 00 	movabs $0x6e8c,%r11
+  8011b2:	00 00 00 
+  8011b5:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8011b8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8011bf:	eb 19                	jmp    8011da <close_all+0x3f>
+		close(i);
+  8011c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8011c4:	89 c7                	mov    %eax,%edi
+  8011c6:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  8011cd:	ff ff ff 
+  8011d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8011d4:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8011d6:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8011da:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8011de:	7e e1                	jle    8011c1 <close_all+0x26>
+}
+  8011e0:	90                   	nop
+  8011e1:	90                   	nop
+  8011e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011e6:	c9                   	leave
+  8011e7:	c3                   	ret
+
+00000000008011e8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8011e8:	55                   	push   %rbp
+  8011e9:	48 89 e5             	mov    %rsp,%rbp
+  8011ec:	41 57                	push   %r15
+  8011ee:	53                   	push   %rbx
+  8011ef:	48 83 ec 40          	sub    $0x40,%rsp
+  8011f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8011f3 <dup+0xb>
+  8011fa:	49 bb 3d 6e 00 00 00 	movabs $0x6e3d,%r11
+  801201:	00 00 00 
+  801204:	4c 01 db             	add    %r11,%rbx
+  801207:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80120a:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80120d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801211:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801214:	48 89 d6             	mov    %rdx,%rsi
+  801217:	89 c7                	mov    %eax,%edi
+  801219:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  801220:	ff ff ff 
+  801223:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801227:	ff d0                	call   *%rax
+  801229:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80122c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801230:	79 08                	jns    80123a <dup+0x52>
+		return r;
+  801232:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801235:	e9 a4 01 00 00       	jmp    8013de <dup+0x1f6>
+	close(newfdnum);
+  80123a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80123d:	89 c7                	mov    %eax,%edi
+  80123f:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  801246:	ff ff ff 
+  801249:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80124d:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  80124f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801252:	48 98                	cltq
+  801254:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80125a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80125e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  801262:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801266:	48 89 c7             	mov    %rax,%rdi
+  801269:	48 b8 77 8d ff ff ff 	movabs $0xffffffffffff8d77,%rax
+  801270:	ff ff ff 
+  801273:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801277:	ff d0                	call   *%rax
+  801279:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  80127d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801281:	48 89 c7             	mov    %rax,%rdi
+  801284:	48 b8 77 8d ff ff ff 	movabs $0xffffffffffff8d77,%rax
+  80128b:	ff ff ff 
+  80128e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801292:	ff d0                	call   *%rax
+  801294:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801298:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80129c:	48 c1 e8 15          	shr    $0x15,%rax
+  8012a0:	48 89 c2             	mov    %rax,%rdx
+  8012a3:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8012aa:	ff ff ff 
+  8012ad:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8012b1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8012b5:	83 e0 01             	and    $0x1,%eax
+  8012b8:	48 85 c0             	test   %rax,%rax
+  8012bb:	74 7f                	je     80133c <dup+0x154>
+  8012bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012c1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8012c5:	48 89 c2             	mov    %rax,%rdx
+  8012c8:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8012cf:	ff ff ff 
+  8012d2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8012d6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8012da:	83 e0 01             	and    $0x1,%eax
+  8012dd:	48 85 c0             	test   %rax,%rax
+  8012e0:	74 5a                	je     80133c <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8012e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012e6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8012ea:	48 89 c2             	mov    %rax,%rdx
+  8012ed:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8012f4:	ff ff ff 
+  8012f7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8012fb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8012ff:	25 07 0e 00 00       	and    $0xe07,%eax
+  801304:	89 c1                	mov    %eax,%ecx
+  801306:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80130a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80130e:	41 89 c8             	mov    %ecx,%r8d
+  801311:	48 89 d1             	mov    %rdx,%rcx
+  801314:	ba 00 00 00 00       	mov    $0x0,%edx
+  801319:	48 89 c6             	mov    %rax,%rsi
+  80131c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801321:	49 89 df             	mov    %rbx,%r15
+  801324:	48 b8 fc 85 ff ff ff 	movabs $0xffffffffffff85fc,%rax
+  80132b:	ff ff ff 
+  80132e:	48 01 d8             	add    %rbx,%rax
+  801331:	ff d0                	call   *%rax
+  801333:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801336:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80133a:	78 5f                	js     80139b <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80133c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801340:	48 c1 e8 0c          	shr    $0xc,%rax
+  801344:	48 89 c2             	mov    %rax,%rdx
+  801347:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80134e:	ff ff ff 
+  801351:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801355:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  801359:	25 07 0e 00 00       	and    $0xe07,%eax
+  80135e:	89 c1                	mov    %eax,%ecx
+  801360:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801364:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801368:	41 89 c8             	mov    %ecx,%r8d
+  80136b:	48 89 d1             	mov    %rdx,%rcx
+  80136e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801373:	48 89 c6             	mov    %rax,%rsi
+  801376:	bf 00 00 00 00       	mov    $0x0,%edi
+  80137b:	49 89 df             	mov    %rbx,%r15
+  80137e:	48 b8 fc 85 ff ff ff 	movabs $0xffffffffffff85fc,%rax
+  801385:	ff ff ff 
+  801388:	48 01 d8             	add    %rbx,%rax
+  80138b:	ff d0                	call   *%rax
+  80138d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801390:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801394:	78 08                	js     80139e <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  801396:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801399:	eb 43                	jmp    8013de <dup+0x1f6>
+			goto err;
+  80139b:	90                   	nop
+  80139c:	eb 01                	jmp    80139f <dup+0x1b7>
+		goto err;
+  80139e:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80139f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013a3:	48 89 c6             	mov    %rax,%rsi
+  8013a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013ab:	49 89 df             	mov    %rbx,%r15
+  8013ae:	48 b8 6f 86 ff ff ff 	movabs $0xffffffffffff866f,%rax
+  8013b5:	ff ff ff 
+  8013b8:	48 01 d8             	add    %rbx,%rax
+  8013bb:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8013bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8013c1:	48 89 c6             	mov    %rax,%rsi
+  8013c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013c9:	49 89 df             	mov    %rbx,%r15
+  8013cc:	48 b8 6f 86 ff ff ff 	movabs $0xffffffffffff866f,%rax
+  8013d3:	ff ff ff 
+  8013d6:	48 01 d8             	add    %rbx,%rax
+  8013d9:	ff d0                	call   *%rax
+	return r;
+  8013db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8013de:	48 83 c4 40          	add    $0x40,%rsp
+  8013e2:	5b                   	pop    %rbx
+  8013e3:	41 5f                	pop    %r15
+  8013e5:	5d                   	pop    %rbp
+  8013e6:	c3                   	ret
+
+00000000008013e7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+  8013eb:	41 57                	push   %r15
+  8013ed:	53                   	push   %rbx
+  8013ee:	48 83 ec 40          	sub    $0x40,%rsp
+  8013f2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8013f2 <read+0xb>
+  8013f9:	49 bb 3e 6c 00 00 00 	movabs $0x6c3e,%r11
+  801400:	00 00 00 
+  801403:	4c 01 db             	add    %r11,%rbx
+  801406:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801409:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80140d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801411:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801415:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801418:	48 89 d6             	mov    %rdx,%rsi
+  80141b:	89 c7                	mov    %eax,%edi
+  80141d:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  801424:	ff ff ff 
+  801427:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80142b:	ff d0                	call   *%rax
+  80142d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801430:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801434:	78 28                	js     80145e <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801436:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80143a:	8b 00                	mov    (%rax),%eax
+  80143c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801440:	48 89 d6             	mov    %rdx,%rsi
+  801443:	89 c7                	mov    %eax,%edi
+  801445:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  80144c:	ff ff ff 
+  80144f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801453:	ff d0                	call   *%rax
+  801455:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801458:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80145c:	79 08                	jns    801466 <read+0x7f>
+		return r;
+  80145e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801461:	e9 8b 00 00 00       	jmp    8014f1 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801466:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80146a:	8b 40 08             	mov    0x8(%rax),%eax
+  80146d:	83 e0 03             	and    $0x3,%eax
+  801470:	83 f8 01             	cmp    $0x1,%eax
+  801473:	75 4b                	jne    8014c0 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801475:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80147c:	ff ff ff 
+  80147f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801483:	48 8b 00             	mov    (%rax),%rax
+  801486:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80148c:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80148f:	89 c6                	mov    %eax,%esi
+  801491:	48 b8 5f de ff ff ff 	movabs $0xffffffffffffde5f,%rax
+  801498:	ff ff ff 
+  80149b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80149f:	48 89 c7             	mov    %rax,%rdi
+  8014a2:	49 89 df             	mov    %rbx,%r15
+  8014a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014aa:	48 b9 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%rcx
+  8014b1:	ff ff ff 
+  8014b4:	48 01 d9             	add    %rbx,%rcx
+  8014b7:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8014b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014be:	eb 31                	jmp    8014f1 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8014c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014c4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8014c8:	48 85 c0             	test   %rax,%rax
+  8014cb:	75 07                	jne    8014d4 <read+0xed>
+		return -E_NOT_SUPP;
+  8014cd:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8014d2:	eb 1d                	jmp    8014f1 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8014d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014d8:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8014dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014e0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8014e4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8014e8:	48 89 ce             	mov    %rcx,%rsi
+  8014eb:	48 89 c7             	mov    %rax,%rdi
+  8014ee:	41 ff d0             	call   *%r8
+}
+  8014f1:	48 83 c4 40          	add    $0x40,%rsp
+  8014f5:	5b                   	pop    %rbx
+  8014f6:	41 5f                	pop    %r15
+  8014f8:	5d                   	pop    %rbp
+  8014f9:	c3                   	ret
+
+00000000008014fa <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014fa:	55                   	push   %rbp
+  8014fb:	48 89 e5             	mov    %rsp,%rbp
+  8014fe:	53                   	push   %rbx
+  8014ff:	48 83 ec 38          	sub    $0x38,%rsp
+  801503:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801503 <readn+0x9>
+  80150a:	49 bb 2d 6b 00 00 00 	movabs $0x6b2d,%r11
+  801511:	00 00 00 
+  801514:	4c 01 db             	add    %r11,%rbx
+  801517:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80151a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80151e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801522:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  801529:	eb 4b                	jmp    801576 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80152b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80152e:	48 98                	cltq
+  801530:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801534:	48 29 c2             	sub    %rax,%rdx
+  801537:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80153a:	48 63 c8             	movslq %eax,%rcx
+  80153d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801541:	48 01 c1             	add    %rax,%rcx
+  801544:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801547:	48 89 ce             	mov    %rcx,%rsi
+  80154a:	89 c7                	mov    %eax,%edi
+  80154c:	48 b8 b7 93 ff ff ff 	movabs $0xffffffffffff93b7,%rax
+  801553:	ff ff ff 
+  801556:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80155a:	ff d0                	call   *%rax
+  80155c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80155f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  801563:	79 05                	jns    80156a <readn+0x70>
+			return m;
+  801565:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801568:	eb 1d                	jmp    801587 <readn+0x8d>
+		if (m == 0)
+  80156a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80156e:	74 13                	je     801583 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  801570:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801573:	01 45 ec             	add    %eax,-0x14(%rbp)
+  801576:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801579:	48 98                	cltq
+  80157b:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80157f:	72 aa                	jb     80152b <readn+0x31>
+  801581:	eb 01                	jmp    801584 <readn+0x8a>
+			break;
+  801583:	90                   	nop
+	}
+	return tot;
+  801584:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  801587:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80158b:	c9                   	leave
+  80158c:	c3                   	ret
+
+000000000080158d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80158d:	55                   	push   %rbp
+  80158e:	48 89 e5             	mov    %rsp,%rbp
+  801591:	41 57                	push   %r15
+  801593:	53                   	push   %rbx
+  801594:	48 83 ec 40          	sub    $0x40,%rsp
+  801598:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801598 <write+0xb>
+  80159f:	49 bb 98 6a 00 00 00 	movabs $0x6a98,%r11
+  8015a6:	00 00 00 
+  8015a9:	4c 01 db             	add    %r11,%rbx
+  8015ac:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8015af:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8015b3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015b7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8015bb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8015be:	48 89 d6             	mov    %rdx,%rsi
+  8015c1:	89 c7                	mov    %eax,%edi
+  8015c3:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  8015ca:	ff ff ff 
+  8015cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015d1:	ff d0                	call   *%rax
+  8015d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8015d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8015da:	78 28                	js     801604 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015e0:	8b 00                	mov    (%rax),%eax
+  8015e2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8015e6:	48 89 d6             	mov    %rdx,%rsi
+  8015e9:	89 c7                	mov    %eax,%edi
+  8015eb:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  8015f2:	ff ff ff 
+  8015f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015f9:	ff d0                	call   *%rax
+  8015fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8015fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801602:	79 08                	jns    80160c <write+0x7f>
+		return r;
+  801604:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801607:	e9 8a 00 00 00       	jmp    801696 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80160c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801610:	8b 40 08             	mov    0x8(%rax),%eax
+  801613:	83 e0 03             	and    $0x3,%eax
+  801616:	85 c0                	test   %eax,%eax
+  801618:	75 4b                	jne    801665 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80161a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801621:	ff ff ff 
+  801624:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801628:	48 8b 00             	mov    (%rax),%rax
+  80162b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801631:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  801634:	89 c6                	mov    %eax,%esi
+  801636:	48 b8 7b de ff ff ff 	movabs $0xffffffffffffde7b,%rax
+  80163d:	ff ff ff 
+  801640:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801644:	48 89 c7             	mov    %rax,%rdi
+  801647:	49 89 df             	mov    %rbx,%r15
+  80164a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164f:	48 b9 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%rcx
+  801656:	ff ff ff 
+  801659:	48 01 d9             	add    %rbx,%rcx
+  80165c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80165e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801663:	eb 31                	jmp    801696 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801665:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801669:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80166d:	48 85 c0             	test   %rax,%rax
+  801670:	75 07                	jne    801679 <write+0xec>
+		return -E_NOT_SUPP;
+  801672:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  801677:	eb 1d                	jmp    801696 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  801679:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80167d:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  801681:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801685:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801689:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80168d:	48 89 ce             	mov    %rcx,%rsi
+  801690:	48 89 c7             	mov    %rax,%rdi
+  801693:	41 ff d0             	call   *%r8
+}
+  801696:	48 83 c4 40          	add    $0x40,%rsp
+  80169a:	5b                   	pop    %rbx
+  80169b:	41 5f                	pop    %r15
+  80169d:	5d                   	pop    %rbp
+  80169e:	c3                   	ret
+
+000000000080169f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80169f:	55                   	push   %rbp
+  8016a0:	48 89 e5             	mov    %rsp,%rbp
+  8016a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8016a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016a7 <seek+0x8>
+  8016ae:	49 bb 89 69 00 00 00 	movabs $0x6989,%r11
+  8016b5:	00 00 00 
+  8016b8:	4c 01 d8             	add    %r11,%rax
+  8016bb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8016be:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016c1:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8016c5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8016c8:	48 89 ce             	mov    %rcx,%rsi
+  8016cb:	89 d7                	mov    %edx,%edi
+  8016cd:	48 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rdx
+  8016d4:	ff ff ff 
+  8016d7:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8016db:	ff d0                	call   *%rax
+  8016dd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8016e0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8016e4:	79 05                	jns    8016eb <seek+0x4c>
+		return r;
+  8016e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8016e9:	eb 0f                	jmp    8016fa <seek+0x5b>
+	fd->fd_offset = offset;
+  8016eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016ef:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8016f2:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8016f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016fa:	c9                   	leave
+  8016fb:	c3                   	ret
+
+00000000008016fc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016fc:	55                   	push   %rbp
+  8016fd:	48 89 e5             	mov    %rsp,%rbp
+  801700:	41 57                	push   %r15
+  801702:	53                   	push   %rbx
+  801703:	48 83 ec 30          	sub    $0x30,%rsp
+  801707:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801707 <ftruncate+0xb>
+  80170e:	49 bb 29 69 00 00 00 	movabs $0x6929,%r11
+  801715:	00 00 00 
+  801718:	4c 01 db             	add    %r11,%rbx
+  80171b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80171e:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801721:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801725:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801728:	48 89 d6             	mov    %rdx,%rsi
+  80172b:	89 c7                	mov    %eax,%edi
+  80172d:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  801734:	ff ff ff 
+  801737:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80173b:	ff d0                	call   *%rax
+  80173d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801740:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801744:	78 28                	js     80176e <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801746:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80174a:	8b 00                	mov    (%rax),%eax
+  80174c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801750:	48 89 d6             	mov    %rdx,%rsi
+  801753:	89 c7                	mov    %eax,%edi
+  801755:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  80175c:	ff ff ff 
+  80175f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801763:	ff d0                	call   *%rax
+  801765:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801768:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80176c:	79 08                	jns    801776 <ftruncate+0x7a>
+		return r;
+  80176e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801771:	e9 83 00 00 00       	jmp    8017f9 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801776:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80177a:	8b 40 08             	mov    0x8(%rax),%eax
+  80177d:	83 e0 03             	and    $0x3,%eax
+  801780:	85 c0                	test   %eax,%eax
+  801782:	75 4b                	jne    8017cf <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  801784:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80178b:	ff ff ff 
+  80178e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801792:	48 8b 00             	mov    (%rax),%rax
+  801795:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80179b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80179e:	89 c6                	mov    %eax,%esi
+  8017a0:	48 b8 98 de ff ff ff 	movabs $0xffffffffffffde98,%rax
+  8017a7:	ff ff ff 
+  8017aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8017ae:	48 89 c7             	mov    %rax,%rdi
+  8017b1:	49 89 df             	mov    %rbx,%r15
+  8017b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b9:	48 b9 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%rcx
+  8017c0:	ff ff ff 
+  8017c3:	48 01 d9             	add    %rbx,%rcx
+  8017c6:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8017c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017cd:	eb 2a                	jmp    8017f9 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8017cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017d3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8017d7:	48 85 c0             	test   %rax,%rax
+  8017da:	75 07                	jne    8017e3 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8017dc:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8017e1:	eb 16                	jmp    8017f9 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8017e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017e7:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8017eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ef:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8017f2:	89 d6                	mov    %edx,%esi
+  8017f4:	48 89 c7             	mov    %rax,%rdi
+  8017f7:	ff d1                	call   *%rcx
+}
+  8017f9:	48 83 c4 30          	add    $0x30,%rsp
+  8017fd:	5b                   	pop    %rbx
+  8017fe:	41 5f                	pop    %r15
+  801800:	5d                   	pop    %rbp
+  801801:	c3                   	ret
+
+0000000000801802 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801802:	55                   	push   %rbp
+  801803:	48 89 e5             	mov    %rsp,%rbp
+  801806:	53                   	push   %rbx
+  801807:	48 83 ec 38          	sub    $0x38,%rsp
+  80180b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80180b <fstat+0x9>
+  801812:	49 bb 25 68 00 00 00 	movabs $0x6825,%r11
+  801819:	00 00 00 
+  80181c:	4c 01 db             	add    %r11,%rbx
+  80181f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801822:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801826:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80182a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80182d:	48 89 d6             	mov    %rdx,%rsi
+  801830:	89 c7                	mov    %eax,%edi
+  801832:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  801839:	ff ff ff 
+  80183c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801840:	ff d0                	call   *%rax
+  801842:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801845:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801849:	78 28                	js     801873 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80184b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80184f:	8b 00                	mov    (%rax),%eax
+  801851:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  801855:	48 89 d6             	mov    %rdx,%rsi
+  801858:	89 c7                	mov    %eax,%edi
+  80185a:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  801861:	ff ff ff 
+  801864:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801868:	ff d0                	call   *%rax
+  80186a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80186d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801871:	79 05                	jns    801878 <fstat+0x76>
+		return r;
+  801873:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801876:	eb 5e                	jmp    8018d6 <fstat+0xd4>
+	if (!dev->dev_stat)
+  801878:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80187c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801880:	48 85 c0             	test   %rax,%rax
+  801883:	75 07                	jne    80188c <fstat+0x8a>
+		return -E_NOT_SUPP;
+  801885:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80188a:	eb 4a                	jmp    8018d6 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80188c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801890:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  801893:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801897:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80189e:	00 00 00 
+	stat->st_isdir = 0;
+  8018a1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018a5:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8018ac:	00 00 00 
+	stat->st_dev = dev;
+  8018af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018b3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8018b7:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8018be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018c2:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8018c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8018ce:	48 89 d6             	mov    %rdx,%rsi
+  8018d1:	48 89 c7             	mov    %rax,%rdi
+  8018d4:	ff d1                	call   *%rcx
+}
+  8018d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018da:	c9                   	leave
+  8018db:	c3                   	ret
+
+00000000008018dc <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018dc:	55                   	push   %rbp
+  8018dd:	48 89 e5             	mov    %rsp,%rbp
+  8018e0:	41 57                	push   %r15
+  8018e2:	53                   	push   %rbx
+  8018e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8018e7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8018e7 <stat+0xb>
+  8018ee:	49 bb 49 67 00 00 00 	movabs $0x6749,%r11
+  8018f5:	00 00 00 
+  8018f8:	4c 01 db             	add    %r11,%rbx
+  8018fb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8018ff:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801903:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801907:	be 00 00 00 00       	mov    $0x0,%esi
+  80190c:	48 89 c7             	mov    %rax,%rdi
+  80190f:	49 89 df             	mov    %rbx,%r15
+  801912:	48 b8 86 9b ff ff ff 	movabs $0xffffffffffff9b86,%rax
+  801919:	ff ff ff 
+  80191c:	48 01 d8             	add    %rbx,%rax
+  80191f:	ff d0                	call   *%rax
+  801921:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801924:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801928:	79 05                	jns    80192f <stat+0x53>
+		return fd;
+  80192a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80192d:	eb 37                	jmp    801966 <stat+0x8a>
+	r = fstat(fd, stat);
+  80192f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801933:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801936:	48 89 d6             	mov    %rdx,%rsi
+  801939:	89 c7                	mov    %eax,%edi
+  80193b:	48 b8 d2 97 ff ff ff 	movabs $0xffffffffffff97d2,%rax
+  801942:	ff ff ff 
+  801945:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801949:	ff d0                	call   *%rax
+  80194b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80194e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801951:	89 c7                	mov    %eax,%edi
+  801953:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  80195a:	ff ff ff 
+  80195d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801961:	ff d0                	call   *%rax
+	return r;
+  801963:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  801966:	48 83 c4 20          	add    $0x20,%rsp
+  80196a:	5b                   	pop    %rbx
+  80196b:	41 5f                	pop    %r15
+  80196d:	5d                   	pop    %rbp
+  80196e:	c3                   	ret
+
+000000000080196f <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80196f:	55                   	push   %rbp
+  801970:	48 89 e5             	mov    %rsp,%rbp
+  801973:	41 57                	push   %r15
+  801975:	53                   	push   %rbx
+  801976:	48 83 ec 10          	sub    $0x10,%rsp
+  80197a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80197a <fsipc+0xb>
+  801981:	49 bb b6 66 00 00 00 	movabs $0x66b6,%r11
+  801988:	00 00 00 
+  80198b:	4c 01 db             	add    %r11,%rbx
+  80198e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801991:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  801995:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80199c:	00 00 00 
+  80199f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8019a2:	85 c0                	test   %eax,%eax
+  8019a4:	75 24                	jne    8019ca <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019a6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8019ab:	49 89 df             	mov    %rbx,%r15
+  8019ae:	48 b8 ba dc ff ff ff 	movabs $0xffffffffffffdcba,%rax
+  8019b5:	ff ff ff 
+  8019b8:	48 01 d8             	add    %rbx,%rax
+  8019bb:	ff d0                	call   *%rax
+  8019bd:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8019c4:	00 00 00 
+  8019c7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8019ca:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8019d1:	00 00 00 
+  8019d4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8019d7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019db:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8019de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8019e4:	49 89 d0             	mov    %rdx,%r8
+  8019e7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8019ec:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8019f3:	00 00 00 
+  8019f6:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8019fa:	89 c7                	mov    %eax,%edi
+  8019fc:	49 89 df             	mov    %rbx,%r15
+  8019ff:	48 b8 d9 d6 ff ff ff 	movabs $0xffffffffffffd6d9,%rax
+  801a06:	ff ff ff 
+  801a09:	48 01 d8             	add    %rbx,%rax
+  801a0c:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  801a0e:	48 83 c4 10          	add    $0x10,%rsp
+  801a12:	5b                   	pop    %rbx
+  801a13:	41 5f                	pop    %r15
+  801a15:	5d                   	pop    %rbp
+  801a16:	c3                   	ret
+
+0000000000801a17 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  801a17:	55                   	push   %rbp
+  801a18:	48 89 e5             	mov    %rsp,%rbp
+  801a1b:	41 57                	push   %r15
+  801a1d:	53                   	push   %rbx
+  801a1e:	48 83 ec 20          	sub    $0x20,%rsp
+  801a22:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801a22 <fsipc_words+0xb>
+  801a29:	49 bb 0e 66 00 00 00 	movabs $0x660e,%r11
+  801a30:	00 00 00 
+  801a33:	4c 01 db             	add    %r11,%rbx
+  801a36:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801a39:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a3d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  801a41:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  801a48:	00 00 00 
+  801a4b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801a4e:	85 c0                	test   %eax,%eax
+  801a50:	75 24                	jne    801a76 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a52:	bf 01 00 00 00       	mov    $0x1,%edi
+  801a57:	49 89 df             	mov    %rbx,%r15
+  801a5a:	48 b8 ba dc ff ff ff 	movabs $0xffffffffffffdcba,%rax
+  801a61:	ff ff ff 
+  801a64:	48 01 d8             	add    %rbx,%rax
+  801a67:	ff d0                	call   *%rax
+  801a69:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  801a70:	00 00 00 
+  801a73:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  801a76:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  801a7d:	00 00 00 
+  801a80:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801a83:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a87:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801a8b:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  801a8e:	89 c7                	mov    %eax,%edi
+  801a90:	49 89 df             	mov    %rbx,%r15
+  801a93:	48 b8 c4 d7 ff ff ff 	movabs $0xffffffffffffd7c4,%rax
+  801a9a:	ff ff ff 
+  801a9d:	48 01 d8             	add    %rbx,%rax
+  801aa0:	ff d0                	call   *%rax
+}
+  801aa2:	48 83 c4 20          	add    $0x20,%rsp
+  801aa6:	5b                   	pop    %rbx
+  801aa7:	41 5f                	pop    %r15
+  801aa9:	5d                   	pop    %rbp
+  801aaa:	c3                   	ret
+
+0000000000801aab <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  801aab:	55                   	push   %rbp
+  801aac:	48 89 e5             	mov    %rsp,%rbp
+  801aaf:	41 57                	push   %r15
+  801ab1:	53                   	push   %rbx
+  801ab2:	48 83 ec 40          	sub    $0x40,%rsp
+  801ab6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801ab6 <fsipc_pages+0xb>
+  801abd:	49 bb 7a 65 00 00 00 	movabs $0x657a,%r11
+  801ac4:	00 00 00 
+  801ac7:	4c 01 db             	add    %r11,%rbx
+  801aca:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  801acd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  801ad1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  801ad5:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  801ad8:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  801adf:	00 00 00 
+  801ae2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801ae5:	85 c0                	test   %eax,%eax
+  801ae7:	75 24                	jne    801b0d <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ae9:	bf 01 00 00 00       	mov    $0x1,%edi
+  801aee:	49 89 df             	mov    %rbx,%r15
+  801af1:	48 b8 ba dc ff ff ff 	movabs $0xffffffffffffdcba,%rax
+  801af8:	ff ff ff 
+  801afb:	48 01 d8             	add    %rbx,%rax
+  801afe:	ff d0                	call   *%rax
+  801b00:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  801b07:	00 00 00 
+  801b0a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  801b0d:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801b12:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  801b16:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801b19:	48 98                	cltq
+  801b1b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  801b1f:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801b23:	0f 95 c0             	setne  %al
+  801b26:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  801b29:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  801b30:	00 
+  801b31:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801b35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b39:	48 01 d0             	add    %rdx,%rax
+  801b3c:	48 83 e8 01          	sub    $0x1,%rax
+  801b40:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801b44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  801b51:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b55:	48 29 d0             	sub    %rdx,%rax
+  801b58:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  801b5c:	41 89 c2             	mov    %eax,%r10d
+  801b5f:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  801b66:	00 00 00 
+  801b69:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801b6c:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  801b70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b74:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  801b77:	48 83 ec 08          	sub    $0x8,%rsp
+  801b7b:	6a 40                	push   $0x40
+  801b7d:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  801b82:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  801b89:	00 
+  801b8a:	6a 05                	push   $0x5
+  801b8c:	41 89 f9             	mov    %edi,%r9d
+  801b8f:	49 89 c8             	mov    %rcx,%r8
+  801b92:	44 89 d1             	mov    %r10d,%ecx
+  801b95:	89 c7                	mov    %eax,%edi
+  801b97:	49 89 df             	mov    %rbx,%r15
+  801b9a:	48 b8 c2 d8 ff ff ff 	movabs $0xffffffffffffd8c2,%rax
+  801ba1:	ff ff ff 
+  801ba4:	48 01 d8             	add    %rbx,%rax
+  801ba7:	ff d0                	call   *%rax
+  801ba9:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  801bad:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  801bb1:	5b                   	pop    %rbx
+  801bb2:	41 5f                	pop    %r15
+  801bb4:	5d                   	pop    %rbp
+  801bb5:	c3                   	ret
+
+0000000000801bb6 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  801bb6:	55                   	push   %rbp
+  801bb7:	48 89 e5             	mov    %rsp,%rbp
+  801bba:	41 57                	push   %r15
+  801bbc:	53                   	push   %rbx
+  801bbd:	48 83 ec 20          	sub    $0x20,%rsp
+  801bc1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801bc1 <open+0xb>
+  801bc8:	49 bb 6f 64 00 00 00 	movabs $0x646f,%r11
+  801bcf:	00 00 00 
+  801bd2:	4c 01 db             	add    %r11,%rbx
+  801bd5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bd9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  801bdc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be0:	48 89 c7             	mov    %rax,%rdi
+  801be3:	49 89 df             	mov    %rbx,%r15
+  801be6:	48 b8 4e cc ff ff ff 	movabs $0xffffffffffffcc4e,%rax
+  801bed:	ff ff ff 
+  801bf0:	48 01 d8             	add    %rbx,%rax
+  801bf3:	ff d0                	call   *%rax
+  801bf5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bfa:	7e 0a                	jle    801c06 <open+0x50>
+		return -E_BAD_PATH;
+  801bfc:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  801c01:	e9 18 01 00 00       	jmp    801d1e <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  801c06:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801c0a:	48 89 c7             	mov    %rax,%rdi
+  801c0d:	49 89 df             	mov    %rbx,%r15
+  801c10:	48 b8 ba 8d ff ff ff 	movabs $0xffffffffffff8dba,%rax
+  801c17:	ff ff ff 
+  801c1a:	48 01 d8             	add    %rbx,%rax
+  801c1d:	ff d0                	call   *%rax
+  801c1f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c22:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801c26:	74 08                	je     801c30 <open+0x7a>
+		return r;
+  801c28:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801c2b:	e9 ee 00 00 00       	jmp    801d1e <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  801c30:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  801c37:	00 00 00 
+  801c3a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c3d:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  801c44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c48:	48 89 c6             	mov    %rax,%rsi
+  801c4b:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  801c52:	00 00 00 
+  801c55:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c59:	48 89 c7             	mov    %rax,%rdi
+  801c5c:	49 89 df             	mov    %rbx,%r15
+  801c5f:	48 b8 e2 cc ff ff ff 	movabs $0xffffffffffffcce2,%rax
+  801c66:	ff ff ff 
+  801c69:	48 01 d8             	add    %rbx,%rax
+  801c6c:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  801c6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c72:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  801c77:	48 89 c6             	mov    %rax,%rsi
+  801c7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c7f:	49 89 df             	mov    %rbx,%r15
+  801c82:	48 b8 97 85 ff ff ff 	movabs $0xffffffffffff8597,%rax
+  801c89:	ff ff ff 
+  801c8c:	48 01 d8             	add    %rbx,%rax
+  801c8f:	ff d0                	call   *%rax
+  801c91:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c94:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801c98:	74 23                	je     801cbd <open+0x107>
+		fd_close(fd,0);
+  801c9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c9e:	be 00 00 00 00       	mov    $0x0,%esi
+  801ca3:	48 89 c7             	mov    %rax,%rdi
+  801ca6:	49 89 df             	mov    %rbx,%r15
+  801ca9:	48 b8 1b 8f ff ff ff 	movabs $0xffffffffffff8f1b,%rax
+  801cb0:	ff ff ff 
+  801cb3:	48 01 d8             	add    %rbx,%rax
+  801cb6:	ff d0                	call   *%rax
+		return r;
+  801cb8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cbb:	eb 61                	jmp    801d1e <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  801cbd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cc1:	48 89 c6             	mov    %rax,%rsi
+  801cc4:	bf 01 00 00 00       	mov    $0x1,%edi
+  801cc9:	48 b8 3f 99 ff ff ff 	movabs $0xffffffffffff993f,%rax
+  801cd0:	ff ff ff 
+  801cd3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801cd7:	ff d0                	call   *%rax
+  801cd9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801cdc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801ce0:	74 23                	je     801d05 <open+0x14f>
+		fd_close(fd,0);
+  801ce2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ce6:	be 00 00 00 00       	mov    $0x0,%esi
+  801ceb:	48 89 c7             	mov    %rax,%rdi
+  801cee:	49 89 df             	mov    %rbx,%r15
+  801cf1:	48 b8 1b 8f ff ff ff 	movabs $0xffffffffffff8f1b,%rax
+  801cf8:	ff ff ff 
+  801cfb:	48 01 d8             	add    %rbx,%rax
+  801cfe:	ff d0                	call   *%rax
+		return r;
+  801d00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d03:	eb 19                	jmp    801d1e <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  801d05:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d09:	48 89 c7             	mov    %rax,%rdi
+  801d0c:	49 89 df             	mov    %rbx,%r15
+  801d0f:	48 b8 40 8d ff ff ff 	movabs $0xffffffffffff8d40,%rax
+  801d16:	ff ff ff 
+  801d19:	48 01 d8             	add    %rbx,%rax
+  801d1c:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  801d1e:	48 83 c4 20          	add    $0x20,%rsp
+  801d22:	5b                   	pop    %rbx
+  801d23:	41 5f                	pop    %r15
+  801d25:	5d                   	pop    %rbp
+  801d26:	c3                   	ret
+
+0000000000801d27 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  801d27:	55                   	push   %rbp
+  801d28:	48 89 e5             	mov    %rsp,%rbp
+  801d2b:	48 83 ec 20          	sub    $0x20,%rsp
+  801d2f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d2f <devfile_flush+0x8>
+  801d36:	49 bb 01 63 00 00 00 	movabs $0x6301,%r11
+  801d3d:	00 00 00 
+  801d40:	4c 01 d8             	add    %r11,%rax
+  801d43:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  801d47:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d4b:	8b 52 0c             	mov    0xc(%rdx),%edx
+  801d4e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  801d51:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  801d55:	ba 04 00 00 00       	mov    $0x4,%edx
+  801d5a:	48 89 ce             	mov    %rcx,%rsi
+  801d5d:	bf 06 00 00 00       	mov    $0x6,%edi
+  801d62:	48 b9 e7 99 ff ff ff 	movabs $0xffffffffffff99e7,%rcx
+  801d69:	ff ff ff 
+  801d6c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801d70:	ff d0                	call   *%rax
+}
+  801d72:	c9                   	leave
+  801d73:	c3                   	ret
+
+0000000000801d74 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  801d74:	55                   	push   %rbp
+  801d75:	48 89 e5             	mov    %rsp,%rbp
+  801d78:	41 57                	push   %r15
+  801d7a:	53                   	push   %rbx
+  801d7b:	48 83 ec 60          	sub    $0x60,%rsp
+  801d7f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801d7f <devfile_read+0xb>
+  801d86:	49 bb b1 62 00 00 00 	movabs $0x62b1,%r11
+  801d8d:	00 00 00 
+  801d90:	4c 01 db             	add    %r11,%rbx
+  801d93:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801d97:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801d9b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  801d9f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801da3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  801da7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801dab:	8b 50 0c             	mov    0xc(%rax),%edx
+  801dae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801db2:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  801db4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801db8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801dbc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  801dc0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801dc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dc9:	ba 10 00 00 00       	mov    $0x10,%edx
+  801dce:	48 89 c6             	mov    %rax,%rsi
+  801dd1:	bf 03 00 00 00       	mov    $0x3,%edi
+  801dd6:	48 b8 7b 9a ff ff ff 	movabs $0xffffffffffff9a7b,%rax
+  801ddd:	ff ff ff 
+  801de0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801de4:	ff d0                	call   *%rax
+  801de6:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  801de9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801ded:	79 05                	jns    801df4 <devfile_read+0x80>
+		return r;
+  801def:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801df2:	eb 64                	jmp    801e58 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  801df4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801df7:	48 63 d0             	movslq %eax,%rdx
+  801dfa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801dfe:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  801e03:	48 01 c1             	add    %rax,%rcx
+  801e06:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e0a:	48 89 ce             	mov    %rcx,%rsi
+  801e0d:	48 89 c7             	mov    %rax,%rdi
+  801e10:	49 89 df             	mov    %rbx,%r15
+  801e13:	48 b8 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rax
+  801e1a:	ff ff ff 
+  801e1d:	48 01 d8             	add    %rbx,%rax
+  801e20:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  801e22:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  801e29:	ff ff ff 
+  801e2c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801e30:	48 8b 00             	mov    (%rax),%rax
+  801e33:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  801e39:	89 c6                	mov    %eax,%esi
+  801e3b:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  801e40:	48 89 c7             	mov    %rax,%rdi
+  801e43:	49 89 df             	mov    %rbx,%r15
+  801e46:	48 b8 74 dc ff ff ff 	movabs $0xffffffffffffdc74,%rax
+  801e4d:	ff ff ff 
+  801e50:	48 01 d8             	add    %rbx,%rax
+  801e53:	ff d0                	call   *%rax
+	return r;
+  801e55:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  801e58:	48 83 c4 60          	add    $0x60,%rsp
+  801e5c:	5b                   	pop    %rbx
+  801e5d:	41 5f                	pop    %r15
+  801e5f:	5d                   	pop    %rbp
+  801e60:	c3                   	ret
+
+0000000000801e61 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  801e61:	55                   	push   %rbp
+  801e62:	48 89 e5             	mov    %rsp,%rbp
+  801e65:	41 57                	push   %r15
+  801e67:	53                   	push   %rbx
+  801e68:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  801e6c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801e6c <devfile_write+0xb>
+  801e73:	49 bb c4 61 00 00 00 	movabs $0x61c4,%r11
+  801e7a:	00 00 00 
+  801e7d:	4c 01 db             	add    %r11,%rbx
+  801e80:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  801e84:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  801e88:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  801e8f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  801e93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  801e97:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  801e9e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801ea2:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  801ea9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801eac:	48 63 d0             	movslq %eax,%rdx
+  801eaf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801eb3:	48 39 c2             	cmp    %rax,%rdx
+  801eb6:	48 0f 46 c2          	cmovbe %rdx,%rax
+  801eba:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801ec1:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  801ec8:	00 
+  801ec9:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  801ed0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ed4:	48 01 d0             	add    %rdx,%rax
+  801ed7:	48 83 e8 01          	sub    $0x1,%rax
+  801edb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801edf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ee3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee8:	48 f7 75 d0          	divq   -0x30(%rbp)
+  801eec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ef0:	48 29 d0             	sub    %rdx,%rax
+  801ef3:	48 c1 e8 0c          	shr    $0xc,%rax
+  801ef7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  801efa:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801efd:	89 c6                	mov    %eax,%esi
+  801eff:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801f04:	48 89 c7             	mov    %rax,%rdi
+  801f07:	49 89 df             	mov    %rbx,%r15
+  801f0a:	48 b8 2e dc ff ff ff 	movabs $0xffffffffffffdc2e,%rax
+  801f11:	ff ff ff 
+  801f14:	48 01 d8             	add    %rbx,%rax
+  801f17:	ff d0                	call   *%rax
+  801f19:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  801f1c:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  801f20:	79 08                	jns    801f2a <devfile_write+0xc9>
+		return r;
+  801f22:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  801f25:	e9 8f 00 00 00       	jmp    801fb9 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  801f2a:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  801f31:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  801f35:	48 89 c6             	mov    %rax,%rsi
+  801f38:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801f3d:	48 89 c7             	mov    %rax,%rdi
+  801f40:	49 89 df             	mov    %rbx,%r15
+  801f43:	48 b8 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rax
+  801f4a:	ff ff ff 
+  801f4d:	48 01 d8             	add    %rbx,%rax
+  801f50:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  801f52:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801f56:	8b 50 0c             	mov    0xc(%rax),%edx
+  801f59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f5d:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  801f5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f63:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  801f6a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  801f6e:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801f71:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  801f75:	89 d1                	mov    %edx,%ecx
+  801f77:	ba 10 00 00 00       	mov    $0x10,%edx
+  801f7c:	48 89 c6             	mov    %rax,%rsi
+  801f7f:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f84:	48 b8 7b 9a ff ff ff 	movabs $0xffffffffffff9a7b,%rax
+  801f8b:	ff ff ff 
+  801f8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f92:	ff d0                	call   *%rax
+  801f94:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  801f97:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f9a:	89 c6                	mov    %eax,%esi
+  801f9c:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  801fa1:	48 89 c7             	mov    %rax,%rdi
+  801fa4:	49 89 df             	mov    %rbx,%r15
+  801fa7:	48 b8 74 dc ff ff ff 	movabs $0xffffffffffffdc74,%rax
+  801fae:	ff ff ff 
+  801fb1:	48 01 d8             	add    %rbx,%rax
+  801fb4:	ff d0                	call   *%rax
+	return r;
+  801fb6:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  801fb9:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  801fbd:	5b                   	pop    %rbx
+  801fbe:	41 5f                	pop    %r15
+  801fc0:	5d                   	pop    %rbp
+  801fc1:	c3                   	ret
+
+0000000000801fc2 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  801fc2:	55                   	push   %rbp
+  801fc3:	48 89 e5             	mov    %rsp,%rbp
+  801fc6:	41 57                	push   %r15
+  801fc8:	53                   	push   %rbx
+  801fc9:	48 83 ec 20          	sub    $0x20,%rsp
+  801fcd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801fcd <devfile_stat+0xb>
+  801fd4:	49 bb 63 60 00 00 00 	movabs $0x6063,%r11
+  801fdb:	00 00 00 
+  801fde:	4c 01 db             	add    %r11,%rbx
+  801fe1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801fe5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fe9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fed:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ff0:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  801ff7:	00 00 00 
+  801ffa:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ffd:	be 00 00 00 00       	mov    $0x0,%esi
+  802002:	bf 05 00 00 00       	mov    $0x5,%edi
+  802007:	48 b8 3f 99 ff ff ff 	movabs $0xffffffffffff993f,%rax
+  80200e:	ff ff ff 
+  802011:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802015:	ff d0                	call   *%rax
+  802017:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80201a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80201e:	79 05                	jns    802025 <devfile_stat+0x63>
+		return r;
+  802020:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802023:	eb 65                	jmp    80208a <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802025:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802029:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  802030:	00 00 00 
+  802033:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  802037:	48 89 d6             	mov    %rdx,%rsi
+  80203a:	48 89 c7             	mov    %rax,%rdi
+  80203d:	49 89 df             	mov    %rbx,%r15
+  802040:	48 b8 e2 cc ff ff ff 	movabs $0xffffffffffffcce2,%rax
+  802047:	ff ff ff 
+  80204a:	48 01 d8             	add    %rbx,%rax
+  80204d:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80204f:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  802056:	00 00 00 
+  802059:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  802060:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802064:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80206a:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  802071:	00 00 00 
+  802074:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  80207b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80207f:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  802085:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80208a:	48 83 c4 20          	add    $0x20,%rsp
+  80208e:	5b                   	pop    %rbx
+  80208f:	41 5f                	pop    %r15
+  802091:	5d                   	pop    %rbp
+  802092:	c3                   	ret
+
+0000000000802093 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802093:	55                   	push   %rbp
+  802094:	48 89 e5             	mov    %rsp,%rbp
+  802097:	48 83 ec 20          	sub    $0x20,%rsp
+  80209b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80209b <devfile_trunc+0x8>
+  8020a2:	49 bb 95 5f 00 00 00 	movabs $0x5f95,%r11
+  8020a9:	00 00 00 
+  8020ac:	4c 01 d8             	add    %r11,%rax
+  8020af:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020b3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  8020b6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020ba:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8020bd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  8020c0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8020c3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8020c6:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8020ca:	ba 08 00 00 00       	mov    $0x8,%edx
+  8020cf:	48 89 ce             	mov    %rcx,%rsi
+  8020d2:	bf 02 00 00 00       	mov    $0x2,%edi
+  8020d7:	48 b9 e7 99 ff ff ff 	movabs $0xffffffffffff99e7,%rcx
+  8020de:	ff ff ff 
+  8020e1:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8020e5:	ff d0                	call   *%rax
+}
+  8020e7:	c9                   	leave
+  8020e8:	c3                   	ret
+
+00000000008020e9 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8020e9:	55                   	push   %rbp
+  8020ea:	48 89 e5             	mov    %rsp,%rbp
+  8020ed:	41 57                	push   %r15
+  8020ef:	53                   	push   %rbx
+  8020f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8020f4 <remove+0xb>
+  8020fb:	49 bb 3c 5f 00 00 00 	movabs $0x5f3c,%r11
+  802102:	00 00 00 
+  802105:	4c 01 db             	add    %r11,%rbx
+  802108:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  80210c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802110:	48 89 c7             	mov    %rax,%rdi
+  802113:	49 89 df             	mov    %rbx,%r15
+  802116:	48 b8 4e cc ff ff ff 	movabs $0xffffffffffffcc4e,%rax
+  80211d:	ff ff ff 
+  802120:	48 01 d8             	add    %rbx,%rax
+  802123:	ff d0                	call   *%rax
+  802125:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80212a:	7e 07                	jle    802133 <remove+0x4a>
+		return -E_BAD_PATH;
+  80212c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  802131:	eb 44                	jmp    802177 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  802133:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802137:	48 89 c6             	mov    %rax,%rsi
+  80213a:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  802141:	00 00 00 
+  802144:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802148:	48 89 c7             	mov    %rax,%rdi
+  80214b:	49 89 df             	mov    %rbx,%r15
+  80214e:	48 b8 e2 cc ff ff ff 	movabs $0xffffffffffffcce2,%rax
+  802155:	ff ff ff 
+  802158:	48 01 d8             	add    %rbx,%rax
+  80215b:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  80215d:	be 00 00 00 00       	mov    $0x0,%esi
+  802162:	bf 07 00 00 00       	mov    $0x7,%edi
+  802167:	48 b8 3f 99 ff ff ff 	movabs $0xffffffffffff993f,%rax
+  80216e:	ff ff ff 
+  802171:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802175:	ff d0                	call   *%rax
+}
+  802177:	48 83 c4 10          	add    $0x10,%rsp
+  80217b:	5b                   	pop    %rbx
+  80217c:	41 5f                	pop    %r15
+  80217e:	5d                   	pop    %rbp
+  80217f:	c3                   	ret
+
+0000000000802180 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802180:	55                   	push   %rbp
+  802181:	48 89 e5             	mov    %rsp,%rbp
+  802184:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802184 <sync+0x4>
+  80218b:	49 bb ac 5e 00 00 00 	movabs $0x5eac,%r11
+  802192:	00 00 00 
+  802195:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  802198:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219d:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021a7:	48 b9 e7 99 ff ff ff 	movabs $0xffffffffffff99e7,%rcx
+  8021ae:	ff ff ff 
+  8021b1:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8021b5:	ff d0                	call   *%rax
+}
+  8021b7:	5d                   	pop    %rbp
+  8021b8:	c3                   	ret
+
+00000000008021b9 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  8021b9:	55                   	push   %rbp
+  8021ba:	48 89 e5             	mov    %rsp,%rbp
+  8021bd:	41 57                	push   %r15
+  8021bf:	53                   	push   %rbx
+  8021c0:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8021c7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8021c7 <copy+0xe>
+  8021ce:	49 bb 69 5e 00 00 00 	movabs $0x5e69,%r11
+  8021d5:	00 00 00 
+  8021d8:	4c 01 db             	add    %r11,%rbx
+  8021db:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8021e2:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8021e9:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8021f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f5:	48 89 c7             	mov    %rax,%rdi
+  8021f8:	48 b8 86 9b ff ff ff 	movabs $0xffffffffffff9b86,%rax
+  8021ff:	ff ff ff 
+  802202:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802206:	ff d0                	call   *%rax
+  802208:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  80220b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80220f:	79 35                	jns    802246 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  802211:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802214:	89 c6                	mov    %eax,%esi
+  802216:	48 b8 be de ff ff ff 	movabs $0xffffffffffffdebe,%rax
+  80221d:	ff ff ff 
+  802220:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802224:	48 89 c7             	mov    %rax,%rdi
+  802227:	49 89 df             	mov    %rbx,%r15
+  80222a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222f:	48 ba 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%rdx
+  802236:	ff ff ff 
+  802239:	48 01 da             	add    %rbx,%rdx
+  80223c:	ff d2                	call   *%rdx
+		return fd_src;
+  80223e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802241:	e9 d7 01 00 00       	jmp    80241d <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  802246:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  80224d:	be 01 01 00 00       	mov    $0x101,%esi
+  802252:	48 89 c7             	mov    %rax,%rdi
+  802255:	48 b8 86 9b ff ff ff 	movabs $0xffffffffffff9b86,%rax
+  80225c:	ff ff ff 
+  80225f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802263:	ff d0                	call   *%rax
+  802265:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  802268:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80226c:	0f 89 df 00 00 00    	jns    802351 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  802272:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802275:	89 c6                	mov    %eax,%esi
+  802277:	48 b8 d4 de ff ff ff 	movabs $0xffffffffffffded4,%rax
+  80227e:	ff ff ff 
+  802281:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802285:	48 89 c7             	mov    %rax,%rdi
+  802288:	49 89 df             	mov    %rbx,%r15
+  80228b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802290:	48 ba 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%rdx
+  802297:	ff ff ff 
+  80229a:	48 01 da             	add    %rbx,%rdx
+  80229d:	ff d2                	call   *%rdx
+		close(fd_src);
+  80229f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022a2:	89 c7                	mov    %eax,%edi
+  8022a4:	49 89 df             	mov    %rbx,%r15
+  8022a7:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  8022ae:	ff ff ff 
+  8022b1:	48 01 d8             	add    %rbx,%rax
+  8022b4:	ff d0                	call   *%rax
+		return fd_dest;
+  8022b6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8022b9:	e9 5f 01 00 00       	jmp    80241d <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  8022be:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8022c1:	48 63 d0             	movslq %eax,%rdx
+  8022c4:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8022cb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8022ce:	48 89 ce             	mov    %rcx,%rsi
+  8022d1:	89 c7                	mov    %eax,%edi
+  8022d3:	49 89 df             	mov    %rbx,%r15
+  8022d6:	48 b8 5d 95 ff ff ff 	movabs $0xffffffffffff955d,%rax
+  8022dd:	ff ff ff 
+  8022e0:	48 01 d8             	add    %rbx,%rax
+  8022e3:	ff d0                	call   *%rax
+  8022e5:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8022e8:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8022ec:	79 63                	jns    802351 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8022ee:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8022f1:	89 c6                	mov    %eax,%esi
+  8022f3:	48 b8 ee de ff ff ff 	movabs $0xffffffffffffdeee,%rax
+  8022fa:	ff ff ff 
+  8022fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802301:	48 89 c7             	mov    %rax,%rdi
+  802304:	49 89 df             	mov    %rbx,%r15
+  802307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230c:	48 ba 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%rdx
+  802313:	ff ff ff 
+  802316:	48 01 da             	add    %rbx,%rdx
+  802319:	ff d2                	call   *%rdx
+			close(fd_src);
+  80231b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80231e:	89 c7                	mov    %eax,%edi
+  802320:	49 89 df             	mov    %rbx,%r15
+  802323:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  80232a:	ff ff ff 
+  80232d:	48 01 d8             	add    %rbx,%rax
+  802330:	ff d0                	call   *%rax
+			close(fd_dest);
+  802332:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802335:	89 c7                	mov    %eax,%edi
+  802337:	49 89 df             	mov    %rbx,%r15
+  80233a:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  802341:	ff ff ff 
+  802344:	48 01 d8             	add    %rbx,%rax
+  802347:	ff d0                	call   *%rax
+			return write_size;
+  802349:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80234c:	e9 cc 00 00 00       	jmp    80241d <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  802351:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  802358:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80235b:	ba 00 02 00 00       	mov    $0x200,%edx
+  802360:	48 89 ce             	mov    %rcx,%rsi
+  802363:	89 c7                	mov    %eax,%edi
+  802365:	49 89 df             	mov    %rbx,%r15
+  802368:	48 b8 b7 93 ff ff ff 	movabs $0xffffffffffff93b7,%rax
+  80236f:	ff ff ff 
+  802372:	48 01 d8             	add    %rbx,%rax
+  802375:	ff d0                	call   *%rax
+  802377:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80237a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80237e:	0f 8f 3a ff ff ff    	jg     8022be <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  802384:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802388:	79 60                	jns    8023ea <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  80238a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80238d:	89 c6                	mov    %eax,%esi
+  80238f:	48 b8 01 df ff ff ff 	movabs $0xffffffffffffdf01,%rax
+  802396:	ff ff ff 
+  802399:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80239d:	48 89 c7             	mov    %rax,%rdi
+  8023a0:	49 89 df             	mov    %rbx,%r15
+  8023a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a8:	48 ba 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%rdx
+  8023af:	ff ff ff 
+  8023b2:	48 01 da             	add    %rbx,%rdx
+  8023b5:	ff d2                	call   *%rdx
+		close(fd_src);
+  8023b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023ba:	89 c7                	mov    %eax,%edi
+  8023bc:	49 89 df             	mov    %rbx,%r15
+  8023bf:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  8023c6:	ff ff ff 
+  8023c9:	48 01 d8             	add    %rbx,%rax
+  8023cc:	ff d0                	call   *%rax
+		close(fd_dest);
+  8023ce:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023d1:	89 c7                	mov    %eax,%edi
+  8023d3:	49 89 df             	mov    %rbx,%r15
+  8023d6:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  8023dd:	ff ff ff 
+  8023e0:	48 01 d8             	add    %rbx,%rax
+  8023e3:	ff d0                	call   *%rax
+		return read_size;
+  8023e5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8023e8:	eb 33                	jmp    80241d <copy+0x264>
+	}
+	close(fd_src);
+  8023ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023ed:	89 c7                	mov    %eax,%edi
+  8023ef:	49 89 df             	mov    %rbx,%r15
+  8023f2:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  8023f9:	ff ff ff 
+  8023fc:	48 01 d8             	add    %rbx,%rax
+  8023ff:	ff d0                	call   *%rax
+	close(fd_dest);
+  802401:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802404:	89 c7                	mov    %eax,%edi
+  802406:	49 89 df             	mov    %rbx,%r15
+  802409:	48 b8 ff 90 ff ff ff 	movabs $0xffffffffffff90ff,%rax
+  802410:	ff ff ff 
+  802413:	48 01 d8             	add    %rbx,%rax
+  802416:	ff d0                	call   *%rax
+	return 0;
+  802418:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  80241d:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  802424:	5b                   	pop    %rbx
+  802425:	41 5f                	pop    %r15
+  802427:	5d                   	pop    %rbp
+  802428:	c3                   	ret
+
+0000000000802429 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  802429:	55                   	push   %rbp
+  80242a:	48 89 e5             	mov    %rsp,%rbp
+  80242d:	41 57                	push   %r15
+  80242f:	53                   	push   %rbx
+  802430:	48 83 ec 20          	sub    $0x20,%rsp
+  802434:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802434 <fd2sockid+0xb>
+  80243b:	49 bb fc 5b 00 00 00 	movabs $0x5bfc,%r11
+  802442:	00 00 00 
+  802445:	4c 01 db             	add    %r11,%rbx
+  802448:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80244b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80244f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802452:	48 89 d6             	mov    %rdx,%rsi
+  802455:	89 c7                	mov    %eax,%edi
+  802457:	49 89 df             	mov    %rbx,%r15
+  80245a:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  802461:	ff ff ff 
+  802464:	48 01 d8             	add    %rbx,%rax
+  802467:	ff d0                	call   *%rax
+  802469:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80246c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802470:	79 05                	jns    802477 <fd2sockid+0x4e>
+		return r;
+  802472:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802475:	eb 25                	jmp    80249c <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802477:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80247b:	8b 10                	mov    (%rax),%edx
+  80247d:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  802484:	00 00 00 
+  802487:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80248a:	39 c2                	cmp    %eax,%edx
+  80248c:	74 07                	je     802495 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80248e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802493:	eb 07                	jmp    80249c <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  802495:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802499:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  80249c:	48 83 c4 20          	add    $0x20,%rsp
+  8024a0:	5b                   	pop    %rbx
+  8024a1:	41 5f                	pop    %r15
+  8024a3:	5d                   	pop    %rbp
+  8024a4:	c3                   	ret
+
+00000000008024a5 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8024a5:	55                   	push   %rbp
+  8024a6:	48 89 e5             	mov    %rsp,%rbp
+  8024a9:	41 57                	push   %r15
+  8024ab:	53                   	push   %rbx
+  8024ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8024b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8024b0 <alloc_sockfd+0xb>
+  8024b7:	49 bb 80 5b 00 00 00 	movabs $0x5b80,%r11
+  8024be:	00 00 00 
+  8024c1:	4c 01 db             	add    %r11,%rbx
+  8024c4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8024c7:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8024cb:	48 89 c7             	mov    %rax,%rdi
+  8024ce:	49 89 df             	mov    %rbx,%r15
+  8024d1:	48 b8 ba 8d ff ff ff 	movabs $0xffffffffffff8dba,%rax
+  8024d8:	ff ff ff 
+  8024db:	48 01 d8             	add    %rbx,%rax
+  8024de:	ff d0                	call   *%rax
+  8024e0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8024e3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8024e7:	78 2c                	js     802515 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8024e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8024ed:	ba 07 04 00 00       	mov    $0x407,%edx
+  8024f2:	48 89 c6             	mov    %rax,%rsi
+  8024f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024fa:	49 89 df             	mov    %rbx,%r15
+  8024fd:	48 b8 97 85 ff ff ff 	movabs $0xffffffffffff8597,%rax
+  802504:	ff ff ff 
+  802507:	48 01 d8             	add    %rbx,%rax
+  80250a:	ff d0                	call   *%rax
+  80250c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80250f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802513:	79 1c                	jns    802531 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  802515:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802518:	89 c7                	mov    %eax,%edi
+  80251a:	49 89 df             	mov    %rbx,%r15
+  80251d:	48 b8 69 ac ff ff ff 	movabs $0xffffffffffffac69,%rax
+  802524:	ff ff ff 
+  802527:	48 01 d8             	add    %rbx,%rax
+  80252a:	ff d0                	call   *%rax
+		return r;
+  80252c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80252f:	eb 41                	jmp    802572 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  802531:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802535:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  80253c:	00 00 00 
+  80253f:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  802542:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  802544:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802548:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80254f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802553:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802556:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  802559:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80255d:	48 89 c7             	mov    %rax,%rdi
+  802560:	49 89 df             	mov    %rbx,%r15
+  802563:	48 b8 40 8d ff ff ff 	movabs $0xffffffffffff8d40,%rax
+  80256a:	ff ff ff 
+  80256d:	48 01 d8             	add    %rbx,%rax
+  802570:	ff d0                	call   *%rax
+}
+  802572:	48 83 c4 20          	add    $0x20,%rsp
+  802576:	5b                   	pop    %rbx
+  802577:	41 5f                	pop    %r15
+  802579:	5d                   	pop    %rbp
+  80257a:	c3                   	ret
+
+000000000080257b <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80257b:	55                   	push   %rbp
+  80257c:	48 89 e5             	mov    %rsp,%rbp
+  80257f:	41 57                	push   %r15
+  802581:	53                   	push   %rbx
+  802582:	48 83 ec 30          	sub    $0x30,%rsp
+  802586:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802586 <accept+0xb>
+  80258d:	49 bb aa 5a 00 00 00 	movabs $0x5aaa,%r11
+  802594:	00 00 00 
+  802597:	4c 01 db             	add    %r11,%rbx
+  80259a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80259d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8025a1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8025a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8025a8:	89 c7                	mov    %eax,%edi
+  8025aa:	48 b8 f9 a3 ff ff ff 	movabs $0xffffffffffffa3f9,%rax
+  8025b1:	ff ff ff 
+  8025b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8025b8:	ff d0                	call   *%rax
+  8025ba:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8025bd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8025c1:	79 05                	jns    8025c8 <accept+0x4d>
+		return r;
+  8025c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025c6:	eb 45                	jmp    80260d <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8025c8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8025cc:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8025d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025d3:	48 89 ce             	mov    %rcx,%rsi
+  8025d6:	89 c7                	mov    %eax,%edi
+  8025d8:	49 89 df             	mov    %rbx,%r15
+  8025db:	48 b8 d7 aa ff ff ff 	movabs $0xffffffffffffaad7,%rax
+  8025e2:	ff ff ff 
+  8025e5:	48 01 d8             	add    %rbx,%rax
+  8025e8:	ff d0                	call   *%rax
+  8025ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8025ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8025f1:	79 05                	jns    8025f8 <accept+0x7d>
+		return r;
+  8025f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025f6:	eb 15                	jmp    80260d <accept+0x92>
+	return alloc_sockfd(r);
+  8025f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025fb:	89 c7                	mov    %eax,%edi
+  8025fd:	48 b8 75 a4 ff ff ff 	movabs $0xffffffffffffa475,%rax
+  802604:	ff ff ff 
+  802607:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80260b:	ff d0                	call   *%rax
+}
+  80260d:	48 83 c4 30          	add    $0x30,%rsp
+  802611:	5b                   	pop    %rbx
+  802612:	41 5f                	pop    %r15
+  802614:	5d                   	pop    %rbp
+  802615:	c3                   	ret
+
+0000000000802616 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802616:	55                   	push   %rbp
+  802617:	48 89 e5             	mov    %rsp,%rbp
+  80261a:	41 57                	push   %r15
+  80261c:	53                   	push   %rbx
+  80261d:	48 83 ec 20          	sub    $0x20,%rsp
+  802621:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802621 <bind+0xb>
+  802628:	49 bb 0f 5a 00 00 00 	movabs $0x5a0f,%r11
+  80262f:	00 00 00 
+  802632:	4c 01 db             	add    %r11,%rbx
+  802635:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802638:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80263c:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80263f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802642:	89 c7                	mov    %eax,%edi
+  802644:	48 b8 f9 a3 ff ff ff 	movabs $0xffffffffffffa3f9,%rax
+  80264b:	ff ff ff 
+  80264e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802652:	ff d0                	call   *%rax
+  802654:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802657:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80265b:	79 05                	jns    802662 <bind+0x4c>
+		return r;
+  80265d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802660:	eb 21                	jmp    802683 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  802662:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802665:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802669:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80266c:	48 89 ce             	mov    %rcx,%rsi
+  80266f:	89 c7                	mov    %eax,%edi
+  802671:	49 89 df             	mov    %rbx,%r15
+  802674:	48 b8 83 ab ff ff ff 	movabs $0xffffffffffffab83,%rax
+  80267b:	ff ff ff 
+  80267e:	48 01 d8             	add    %rbx,%rax
+  802681:	ff d0                	call   *%rax
+}
+  802683:	48 83 c4 20          	add    $0x20,%rsp
+  802687:	5b                   	pop    %rbx
+  802688:	41 5f                	pop    %r15
+  80268a:	5d                   	pop    %rbp
+  80268b:	c3                   	ret
+
+000000000080268c <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80268c:	55                   	push   %rbp
+  80268d:	48 89 e5             	mov    %rsp,%rbp
+  802690:	41 57                	push   %r15
+  802692:	53                   	push   %rbx
+  802693:	48 83 ec 20          	sub    $0x20,%rsp
+  802697:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802697 <shutdown+0xb>
+  80269e:	49 bb 99 59 00 00 00 	movabs $0x5999,%r11
+  8026a5:	00 00 00 
+  8026a8:	4c 01 db             	add    %r11,%rbx
+  8026ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8026ae:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8026b1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026b4:	89 c7                	mov    %eax,%edi
+  8026b6:	48 b8 f9 a3 ff ff ff 	movabs $0xffffffffffffa3f9,%rax
+  8026bd:	ff ff ff 
+  8026c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8026c4:	ff d0                	call   *%rax
+  8026c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8026c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8026cd:	79 05                	jns    8026d4 <shutdown+0x48>
+		return r;
+  8026cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026d2:	eb 1c                	jmp    8026f0 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8026d4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8026d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026da:	89 d6                	mov    %edx,%esi
+  8026dc:	89 c7                	mov    %eax,%edi
+  8026de:	49 89 df             	mov    %rbx,%r15
+  8026e1:	48 b8 18 ac ff ff ff 	movabs $0xffffffffffffac18,%rax
+  8026e8:	ff ff ff 
+  8026eb:	48 01 d8             	add    %rbx,%rax
+  8026ee:	ff d0                	call   *%rax
+}
+  8026f0:	48 83 c4 20          	add    $0x20,%rsp
+  8026f4:	5b                   	pop    %rbx
+  8026f5:	41 5f                	pop    %r15
+  8026f7:	5d                   	pop    %rbp
+  8026f8:	c3                   	ret
+
+00000000008026f9 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8026f9:	55                   	push   %rbp
+  8026fa:	48 89 e5             	mov    %rsp,%rbp
+  8026fd:	41 57                	push   %r15
+  8026ff:	53                   	push   %rbx
+  802700:	48 83 ec 10          	sub    $0x10,%rsp
+  802704:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802704 <devsock_close+0xb>
+  80270b:	49 bb 2c 59 00 00 00 	movabs $0x592c,%r11
+  802712:	00 00 00 
+  802715:	4c 01 db             	add    %r11,%rbx
+  802718:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80271c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802720:	48 89 c7             	mov    %rax,%rdi
+  802723:	49 89 df             	mov    %rbx,%r15
+  802726:	48 b8 49 dd ff ff ff 	movabs $0xffffffffffffdd49,%rax
+  80272d:	ff ff ff 
+  802730:	48 01 d8             	add    %rbx,%rax
+  802733:	ff d0                	call   *%rax
+  802735:	83 f8 01             	cmp    $0x1,%eax
+  802738:	75 1d                	jne    802757 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  80273a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80273e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802741:	89 c7                	mov    %eax,%edi
+  802743:	49 89 df             	mov    %rbx,%r15
+  802746:	48 b8 69 ac ff ff ff 	movabs $0xffffffffffffac69,%rax
+  80274d:	ff ff ff 
+  802750:	48 01 d8             	add    %rbx,%rax
+  802753:	ff d0                	call   *%rax
+  802755:	eb 05                	jmp    80275c <devsock_close+0x63>
+	else
+		return 0;
+  802757:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80275c:	48 83 c4 10          	add    $0x10,%rsp
+  802760:	5b                   	pop    %rbx
+  802761:	41 5f                	pop    %r15
+  802763:	5d                   	pop    %rbp
+  802764:	c3                   	ret
+
+0000000000802765 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802765:	55                   	push   %rbp
+  802766:	48 89 e5             	mov    %rsp,%rbp
+  802769:	41 57                	push   %r15
+  80276b:	53                   	push   %rbx
+  80276c:	48 83 ec 20          	sub    $0x20,%rsp
+  802770:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802770 <connect+0xb>
+  802777:	49 bb c0 58 00 00 00 	movabs $0x58c0,%r11
+  80277e:	00 00 00 
+  802781:	4c 01 db             	add    %r11,%rbx
+  802784:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802787:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80278b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80278e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802791:	89 c7                	mov    %eax,%edi
+  802793:	48 b8 f9 a3 ff ff ff 	movabs $0xffffffffffffa3f9,%rax
+  80279a:	ff ff ff 
+  80279d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8027a1:	ff d0                	call   *%rax
+  8027a3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8027a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8027aa:	79 05                	jns    8027b1 <connect+0x4c>
+		return r;
+  8027ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027af:	eb 21                	jmp    8027d2 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8027b1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8027b4:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8027b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027bb:	48 89 ce             	mov    %rcx,%rsi
+  8027be:	89 c7                	mov    %eax,%edi
+  8027c0:	49 89 df             	mov    %rbx,%r15
+  8027c3:	48 b8 b1 ac ff ff ff 	movabs $0xffffffffffffacb1,%rax
+  8027ca:	ff ff ff 
+  8027cd:	48 01 d8             	add    %rbx,%rax
+  8027d0:	ff d0                	call   *%rax
+}
+  8027d2:	48 83 c4 20          	add    $0x20,%rsp
+  8027d6:	5b                   	pop    %rbx
+  8027d7:	41 5f                	pop    %r15
+  8027d9:	5d                   	pop    %rbp
+  8027da:	c3                   	ret
+
+00000000008027db <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8027db:	55                   	push   %rbp
+  8027dc:	48 89 e5             	mov    %rsp,%rbp
+  8027df:	41 57                	push   %r15
+  8027e1:	53                   	push   %rbx
+  8027e2:	48 83 ec 20          	sub    $0x20,%rsp
+  8027e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8027e6 <listen+0xb>
+  8027ed:	49 bb 4a 58 00 00 00 	movabs $0x584a,%r11
+  8027f4:	00 00 00 
+  8027f7:	4c 01 db             	add    %r11,%rbx
+  8027fa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8027fd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  802800:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802803:	89 c7                	mov    %eax,%edi
+  802805:	48 b8 f9 a3 ff ff ff 	movabs $0xffffffffffffa3f9,%rax
+  80280c:	ff ff ff 
+  80280f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802813:	ff d0                	call   *%rax
+  802815:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802818:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80281c:	79 05                	jns    802823 <listen+0x48>
+		return r;
+  80281e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802821:	eb 1c                	jmp    80283f <listen+0x64>
+	return nsipc_listen(r, backlog);
+  802823:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802826:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802829:	89 d6                	mov    %edx,%esi
+  80282b:	89 c7                	mov    %eax,%edi
+  80282d:	49 89 df             	mov    %rbx,%r15
+  802830:	48 b8 46 ad ff ff ff 	movabs $0xffffffffffffad46,%rax
+  802837:	ff ff ff 
+  80283a:	48 01 d8             	add    %rbx,%rax
+  80283d:	ff d0                	call   *%rax
+}
+  80283f:	48 83 c4 20          	add    $0x20,%rsp
+  802843:	5b                   	pop    %rbx
+  802844:	41 5f                	pop    %r15
+  802846:	5d                   	pop    %rbp
+  802847:	c3                   	ret
+
+0000000000802848 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  802848:	55                   	push   %rbp
+  802849:	48 89 e5             	mov    %rsp,%rbp
+  80284c:	41 57                	push   %r15
+  80284e:	48 83 ec 28          	sub    $0x28,%rsp
+  802852:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802852 <devsock_read+0xa>
+  802859:	49 bb de 57 00 00 00 	movabs $0x57de,%r11
+  802860:	00 00 00 
+  802863:	4c 01 d8             	add    %r11,%rax
+  802866:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80286a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80286e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802872:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802876:	41 89 d0             	mov    %edx,%r8d
+  802879:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80287d:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  802880:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802884:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802889:	44 89 c2             	mov    %r8d,%edx
+  80288c:	49 89 c7             	mov    %rax,%r15
+  80288f:	49 b8 97 ad ff ff ff 	movabs $0xffffffffffffad97,%r8
+  802896:	ff ff ff 
+  802899:	49 01 c0             	add    %rax,%r8
+  80289c:	41 ff d0             	call   *%r8
+}
+  80289f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8028a3:	c9                   	leave
+  8028a4:	c3                   	ret
+
+00000000008028a5 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8028a5:	55                   	push   %rbp
+  8028a6:	48 89 e5             	mov    %rsp,%rbp
+  8028a9:	41 57                	push   %r15
+  8028ab:	48 83 ec 28          	sub    $0x28,%rsp
+  8028af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028af <devsock_write+0xa>
+  8028b6:	49 bb 81 57 00 00 00 	movabs $0x5781,%r11
+  8028bd:	00 00 00 
+  8028c0:	4c 01 d8             	add    %r11,%rax
+  8028c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8028c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028cb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8028cf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8028d3:	41 89 d0             	mov    %edx,%r8d
+  8028d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8028da:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8028dd:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8028e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028e6:	44 89 c2             	mov    %r8d,%edx
+  8028e9:	49 89 c7             	mov    %rax,%r15
+  8028ec:	49 b8 b4 ae ff ff ff 	movabs $0xffffffffffffaeb4,%r8
+  8028f3:	ff ff ff 
+  8028f6:	49 01 c0             	add    %rax,%r8
+  8028f9:	41 ff d0             	call   *%r8
+}
+  8028fc:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802900:	c9                   	leave
+  802901:	c3                   	ret
+
+0000000000802902 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802902:	55                   	push   %rbp
+  802903:	48 89 e5             	mov    %rsp,%rbp
+  802906:	41 57                	push   %r15
+  802908:	48 83 ec 18          	sub    $0x18,%rsp
+  80290c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80290c <devsock_stat+0xa>
+  802913:	49 bb 24 57 00 00 00 	movabs $0x5724,%r11
+  80291a:	00 00 00 
+  80291d:	4c 01 d8             	add    %r11,%rax
+  802920:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802924:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  802928:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80292c:	48 b9 1c df ff ff ff 	movabs $0xffffffffffffdf1c,%rcx
+  802933:	ff ff ff 
+  802936:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80293a:	48 89 ce             	mov    %rcx,%rsi
+  80293d:	48 89 d7             	mov    %rdx,%rdi
+  802940:	49 89 c7             	mov    %rax,%r15
+  802943:	48 ba e2 cc ff ff ff 	movabs $0xffffffffffffcce2,%rdx
+  80294a:	ff ff ff 
+  80294d:	48 01 c2             	add    %rax,%rdx
+  802950:	ff d2                	call   *%rdx
+	return 0;
+  802952:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802957:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80295b:	c9                   	leave
+  80295c:	c3                   	ret
+
+000000000080295d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80295d:	55                   	push   %rbp
+  80295e:	48 89 e5             	mov    %rsp,%rbp
+  802961:	41 57                	push   %r15
+  802963:	53                   	push   %rbx
+  802964:	48 83 ec 20          	sub    $0x20,%rsp
+  802968:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802968 <socket+0xb>
+  80296f:	49 bb c8 56 00 00 00 	movabs $0x56c8,%r11
+  802976:	00 00 00 
+  802979:	4c 01 db             	add    %r11,%rbx
+  80297c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80297f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  802982:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802985:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  802988:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80298b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80298e:	89 ce                	mov    %ecx,%esi
+  802990:	89 c7                	mov    %eax,%edi
+  802992:	49 89 df             	mov    %rbx,%r15
+  802995:	48 b8 8b b0 ff ff ff 	movabs $0xffffffffffffb08b,%rax
+  80299c:	ff ff ff 
+  80299f:	48 01 d8             	add    %rbx,%rax
+  8029a2:	ff d0                	call   *%rax
+  8029a4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8029a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8029ab:	79 05                	jns    8029b2 <socket+0x55>
+		return r;
+  8029ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029b0:	eb 15                	jmp    8029c7 <socket+0x6a>
+	return alloc_sockfd(r);
+  8029b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029b5:	89 c7                	mov    %eax,%edi
+  8029b7:	48 b8 75 a4 ff ff ff 	movabs $0xffffffffffffa475,%rax
+  8029be:	ff ff ff 
+  8029c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029c5:	ff d0                	call   *%rax
+}
+  8029c7:	48 83 c4 20          	add    $0x20,%rsp
+  8029cb:	5b                   	pop    %rbx
+  8029cc:	41 5f                	pop    %r15
+  8029ce:	5d                   	pop    %rbp
+  8029cf:	c3                   	ret
+
+00000000008029d0 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8029d0:	55                   	push   %rbp
+  8029d1:	48 89 e5             	mov    %rsp,%rbp
+  8029d4:	41 57                	push   %r15
+  8029d6:	53                   	push   %rbx
+  8029d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8029db:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8029db <nsipc+0xb>
+  8029e2:	49 bb 55 56 00 00 00 	movabs $0x5655,%r11
+  8029e9:	00 00 00 
+  8029ec:	4c 01 db             	add    %r11,%rbx
+  8029ef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8029f2:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8029f9:	00 00 00 
+  8029fc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8029ff:	85 c0                	test   %eax,%eax
+  802a01:	75 24                	jne    802a27 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a03:	bf 02 00 00 00       	mov    $0x2,%edi
+  802a08:	49 89 df             	mov    %rbx,%r15
+  802a0b:	48 b8 ba dc ff ff ff 	movabs $0xffffffffffffdcba,%rax
+  802a12:	ff ff ff 
+  802a15:	48 01 d8             	add    %rbx,%rax
+  802a18:	ff d0                	call   *%rax
+  802a1a:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  802a21:	00 00 00 
+  802a24:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  802a27:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  802a2e:	00 00 00 
+  802a31:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802a34:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802a37:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a3d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a43:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802a48:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802a4f:	00 00 00 
+  802a52:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  802a56:	89 c7                	mov    %eax,%edi
+  802a58:	49 89 df             	mov    %rbx,%r15
+  802a5b:	48 b8 d9 d6 ff ff ff 	movabs $0xffffffffffffd6d9,%rax
+  802a62:	ff ff ff 
+  802a65:	48 01 d8             	add    %rbx,%rax
+  802a68:	ff d0                	call   *%rax
+}
+  802a6a:	48 83 c4 10          	add    $0x10,%rsp
+  802a6e:	5b                   	pop    %rbx
+  802a6f:	41 5f                	pop    %r15
+  802a71:	5d                   	pop    %rbp
+  802a72:	c3                   	ret
+
+0000000000802a73 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  802a73:	55                   	push   %rbp
+  802a74:	48 89 e5             	mov    %rsp,%rbp
+  802a77:	41 57                	push   %r15
+  802a79:	53                   	push   %rbx
+  802a7a:	48 83 ec 20          	sub    $0x20,%rsp
+  802a7e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a7e <nsipc_words+0xb>
+  802a85:	49 bb b2 55 00 00 00 	movabs $0x55b2,%r11
+  802a8c:	00 00 00 
+  802a8f:	4c 01 db             	add    %r11,%rbx
+  802a92:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802a95:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802a99:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  802a9d:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  802aa4:	00 00 00 
+  802aa7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802aaa:	85 c0                	test   %eax,%eax
+  802aac:	75 24                	jne    802ad2 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802aae:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ab3:	49 89 df             	mov    %rbx,%r15
+  802ab6:	48 b8 ba dc ff ff ff 	movabs $0xffffffffffffdcba,%rax
+  802abd:	ff ff ff 
+  802ac0:	48 01 d8             	add    %rbx,%rax
+  802ac3:	ff d0                	call   *%rax
+  802ac5:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  802acc:	00 00 00 
+  802acf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  802ad2:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  802ad9:	00 00 00 
+  802adc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802adf:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802ae3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ae7:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  802aea:	89 c7                	mov    %eax,%edi
+  802aec:	49 89 df             	mov    %rbx,%r15
+  802aef:	48 b8 c4 d7 ff ff ff 	movabs $0xffffffffffffd7c4,%rax
+  802af6:	ff ff ff 
+  802af9:	48 01 d8             	add    %rbx,%rax
+  802afc:	ff d0                	call   *%rax
+}
+  802afe:	48 83 c4 20          	add    $0x20,%rsp
+  802b02:	5b                   	pop    %rbx
+  802b03:	41 5f                	pop    %r15
+  802b05:	5d                   	pop    %rbp
+  802b06:	c3                   	ret
+
+0000000000802b07 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802b07:	55                   	push   %rbp
+  802b08:	48 89 e5             	mov    %rsp,%rbp
+  802b0b:	41 57                	push   %r15
+  802b0d:	53                   	push   %rbx
+  802b0e:	48 83 ec 30          	sub    $0x30,%rsp
+  802b12:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b12 <nsipc_accept+0xb>
+  802b19:	49 bb 1e 55 00 00 00 	movabs $0x551e,%r11
+  802b20:	00 00 00 
+  802b23:	4c 01 db             	add    %r11,%rbx
+  802b26:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802b29:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802b2d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802b31:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802b38:	00 00 00 
+  802b3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802b3e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802b41:	bf 01 00 00 00       	mov    $0x1,%edi
+  802b46:	48 b8 a0 a9 ff ff ff 	movabs $0xffffffffffffa9a0,%rax
+  802b4d:	ff ff ff 
+  802b50:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b54:	ff d0                	call   *%rax
+  802b56:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b59:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b5d:	78 48                	js     802ba7 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  802b5f:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  802b66:	00 00 00 
+  802b69:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b6d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802b71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b75:	8b 40 10             	mov    0x10(%rax),%eax
+  802b78:	89 c2                	mov    %eax,%edx
+  802b7a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802b7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b82:	48 89 ce             	mov    %rcx,%rsi
+  802b85:	48 89 c7             	mov    %rax,%rdi
+  802b88:	49 89 df             	mov    %rbx,%r15
+  802b8b:	48 b8 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rax
+  802b92:	ff ff ff 
+  802b95:	48 01 d8             	add    %rbx,%rax
+  802b98:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  802b9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b9e:	8b 50 10             	mov    0x10(%rax),%edx
+  802ba1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ba5:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  802ba7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802baa:	48 83 c4 30          	add    $0x30,%rsp
+  802bae:	5b                   	pop    %rbx
+  802baf:	41 5f                	pop    %r15
+  802bb1:	5d                   	pop    %rbp
+  802bb2:	c3                   	ret
+
+0000000000802bb3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802bb3:	55                   	push   %rbp
+  802bb4:	48 89 e5             	mov    %rsp,%rbp
+  802bb7:	41 57                	push   %r15
+  802bb9:	53                   	push   %rbx
+  802bba:	48 83 ec 10          	sub    $0x10,%rsp
+  802bbe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802bbe <nsipc_bind+0xb>
+  802bc5:	49 bb 72 54 00 00 00 	movabs $0x5472,%r11
+  802bcc:	00 00 00 
+  802bcf:	4c 01 db             	add    %r11,%rbx
+  802bd2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802bd5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802bd9:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  802bdc:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802be3:	00 00 00 
+  802be6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802be9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802bec:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802bef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bf3:	48 89 c6             	mov    %rax,%rsi
+  802bf6:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  802bfd:	00 00 00 
+  802c00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c04:	48 89 c7             	mov    %rax,%rdi
+  802c07:	49 89 df             	mov    %rbx,%r15
+  802c0a:	48 b8 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rax
+  802c11:	ff ff ff 
+  802c14:	48 01 d8             	add    %rbx,%rax
+  802c17:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  802c19:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802c20:	00 00 00 
+  802c23:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802c26:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  802c2a:	bf 02 00 00 00       	mov    $0x2,%edi
+  802c2f:	48 b8 a0 a9 ff ff ff 	movabs $0xffffffffffffa9a0,%rax
+  802c36:	ff ff ff 
+  802c39:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c3d:	ff d0                	call   *%rax
+}
+  802c3f:	48 83 c4 10          	add    $0x10,%rsp
+  802c43:	5b                   	pop    %rbx
+  802c44:	41 5f                	pop    %r15
+  802c46:	5d                   	pop    %rbp
+  802c47:	c3                   	ret
+
+0000000000802c48 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c48:	55                   	push   %rbp
+  802c49:	48 89 e5             	mov    %rsp,%rbp
+  802c4c:	48 83 ec 20          	sub    $0x20,%rsp
+  802c50:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c50 <nsipc_shutdown+0x8>
+  802c57:	49 bb e0 53 00 00 00 	movabs $0x53e0,%r11
+  802c5e:	00 00 00 
+  802c61:	4c 01 d8             	add    %r11,%rax
+  802c64:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802c67:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  802c6a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802c6d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  802c70:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802c73:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  802c76:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  802c7a:	ba 08 00 00 00       	mov    $0x8,%edx
+  802c7f:	48 89 ce             	mov    %rcx,%rsi
+  802c82:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c87:	48 b9 43 aa ff ff ff 	movabs $0xffffffffffffaa43,%rcx
+  802c8e:	ff ff ff 
+  802c91:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802c95:	ff d0                	call   *%rax
+}
+  802c97:	c9                   	leave
+  802c98:	c3                   	ret
+
+0000000000802c99 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c99:	55                   	push   %rbp
+  802c9a:	48 89 e5             	mov    %rsp,%rbp
+  802c9d:	48 83 ec 20          	sub    $0x20,%rsp
+  802ca1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ca1 <nsipc_close+0x8>
+  802ca8:	49 bb 8f 53 00 00 00 	movabs $0x538f,%r11
+  802caf:	00 00 00 
+  802cb2:	4c 01 d8             	add    %r11,%rax
+  802cb5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  802cb8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802cbb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  802cbe:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  802cc2:	ba 04 00 00 00       	mov    $0x4,%edx
+  802cc7:	48 89 ce             	mov    %rcx,%rsi
+  802cca:	bf 04 00 00 00       	mov    $0x4,%edi
+  802ccf:	48 b9 43 aa ff ff ff 	movabs $0xffffffffffffaa43,%rcx
+  802cd6:	ff ff ff 
+  802cd9:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802cdd:	ff d0                	call   *%rax
+}
+  802cdf:	c9                   	leave
+  802ce0:	c3                   	ret
+
+0000000000802ce1 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802ce1:	55                   	push   %rbp
+  802ce2:	48 89 e5             	mov    %rsp,%rbp
+  802ce5:	41 57                	push   %r15
+  802ce7:	53                   	push   %rbx
+  802ce8:	48 83 ec 10          	sub    $0x10,%rsp
+  802cec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802cec <nsipc_connect+0xb>
+  802cf3:	49 bb 44 53 00 00 00 	movabs $0x5344,%r11
+  802cfa:	00 00 00 
+  802cfd:	4c 01 db             	add    %r11,%rbx
+  802d00:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d03:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802d07:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  802d0a:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802d11:	00 00 00 
+  802d14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d17:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802d1a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802d1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d21:	48 89 c6             	mov    %rax,%rsi
+  802d24:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  802d2b:	00 00 00 
+  802d2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d32:	48 89 c7             	mov    %rax,%rdi
+  802d35:	49 89 df             	mov    %rbx,%r15
+  802d38:	48 b8 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rax
+  802d3f:	ff ff ff 
+  802d42:	48 01 d8             	add    %rbx,%rax
+  802d45:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  802d47:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802d4e:	00 00 00 
+  802d51:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802d54:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  802d58:	bf 05 00 00 00       	mov    $0x5,%edi
+  802d5d:	48 b8 a0 a9 ff ff ff 	movabs $0xffffffffffffa9a0,%rax
+  802d64:	ff ff ff 
+  802d67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d6b:	ff d0                	call   *%rax
+}
+  802d6d:	48 83 c4 10          	add    $0x10,%rsp
+  802d71:	5b                   	pop    %rbx
+  802d72:	41 5f                	pop    %r15
+  802d74:	5d                   	pop    %rbp
+  802d75:	c3                   	ret
+
+0000000000802d76 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802d76:	55                   	push   %rbp
+  802d77:	48 89 e5             	mov    %rsp,%rbp
+  802d7a:	48 83 ec 20          	sub    $0x20,%rsp
+  802d7e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d7e <nsipc_listen+0x8>
+  802d85:	49 bb b2 52 00 00 00 	movabs $0x52b2,%r11
+  802d8c:	00 00 00 
+  802d8f:	4c 01 d8             	add    %r11,%rax
+  802d92:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d95:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  802d98:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802d9b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  802d9e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802da1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  802da4:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  802da8:	ba 08 00 00 00       	mov    $0x8,%edx
+  802dad:	48 89 ce             	mov    %rcx,%rsi
+  802db0:	bf 06 00 00 00       	mov    $0x6,%edi
+  802db5:	48 b9 43 aa ff ff ff 	movabs $0xffffffffffffaa43,%rcx
+  802dbc:	ff ff ff 
+  802dbf:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802dc3:	ff d0                	call   *%rax
+}
+  802dc5:	c9                   	leave
+  802dc6:	c3                   	ret
+
+0000000000802dc7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802dc7:	55                   	push   %rbp
+  802dc8:	48 89 e5             	mov    %rsp,%rbp
+  802dcb:	41 57                	push   %r15
+  802dcd:	53                   	push   %rbx
+  802dce:	48 83 ec 30          	sub    $0x30,%rsp
+  802dd2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dd2 <nsipc_recv+0xb>
+  802dd9:	49 bb 5e 52 00 00 00 	movabs $0x525e,%r11
+  802de0:	00 00 00 
+  802de3:	4c 01 db             	add    %r11,%rbx
+  802de6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802de9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ded:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  802df0:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802df3:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802dfa:	00 00 00 
+  802dfd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e00:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  802e03:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802e0a:	00 00 00 
+  802e0d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802e10:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  802e14:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  802e1b:	00 00 00 
+  802e1e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e21:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e25:	bf 07 00 00 00       	mov    $0x7,%edi
+  802e2a:	48 b8 a0 a9 ff ff ff 	movabs $0xffffffffffffa9a0,%rax
+  802e31:	ff ff ff 
+  802e34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e38:	ff d0                	call   *%rax
+  802e3a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e3d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e41:	0f 88 91 00 00 00    	js     802ed8 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  802e47:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  802e4e:	7f 08                	jg     802e58 <nsipc_recv+0x91>
+  802e50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e53:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  802e56:	7e 50                	jle    802ea8 <nsipc_recv+0xe1>
+  802e58:	48 b8 23 df ff ff ff 	movabs $0xffffffffffffdf23,%rax
+  802e5f:	ff ff ff 
+  802e62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e66:	48 89 c1             	mov    %rax,%rcx
+  802e69:	48 b8 38 df ff ff ff 	movabs $0xffffffffffffdf38,%rax
+  802e70:	ff ff ff 
+  802e73:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e77:	48 89 c2             	mov    %rax,%rdx
+  802e7a:	be 79 00 00 00       	mov    $0x79,%esi
+  802e7f:	48 b8 4d df ff ff ff 	movabs $0xffffffffffffdf4d,%rax
+  802e86:	ff ff ff 
+  802e89:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e8d:	48 89 c7             	mov    %rax,%rdi
+  802e90:	49 89 df             	mov    %rbx,%r15
+  802e93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e98:	49 b8 49 bc ff ff ff 	movabs $0xffffffffffffbc49,%r8
+  802e9f:	ff ff ff 
+  802ea2:	49 01 d8             	add    %rbx,%r8
+  802ea5:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ea8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eab:	48 63 d0             	movslq %eax,%rdx
+  802eae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802eb2:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  802eb9:	00 00 00 
+  802ebc:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  802ec0:	48 89 ce             	mov    %rcx,%rsi
+  802ec3:	48 89 c7             	mov    %rax,%rdi
+  802ec6:	49 89 df             	mov    %rbx,%r15
+  802ec9:	48 b8 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rax
+  802ed0:	ff ff ff 
+  802ed3:	48 01 d8             	add    %rbx,%rax
+  802ed6:	ff d0                	call   *%rax
+	}
+
+	return r;
+  802ed8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802edb:	48 83 c4 30          	add    $0x30,%rsp
+  802edf:	5b                   	pop    %rbx
+  802ee0:	41 5f                	pop    %r15
+  802ee2:	5d                   	pop    %rbp
+  802ee3:	c3                   	ret
+
+0000000000802ee4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802ee4:	55                   	push   %rbp
+  802ee5:	48 89 e5             	mov    %rsp,%rbp
+  802ee8:	41 57                	push   %r15
+  802eea:	53                   	push   %rbx
+  802eeb:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  802ef2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ef2 <nsipc_send+0xe>
+  802ef9:	49 bb 3e 51 00 00 00 	movabs $0x513e,%r11
+  802f00:	00 00 00 
+  802f03:	4c 01 db             	add    %r11,%rbx
+  802f06:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  802f0c:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  802f13:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  802f19:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  802f1f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  802f23:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  802f27:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  802f2e:	00 00 00 
+  802f31:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  802f34:	85 c0                	test   %eax,%eax
+  802f36:	75 24                	jne    802f5c <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802f38:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f3d:	49 89 df             	mov    %rbx,%r15
+  802f40:	48 b8 ba dc ff ff ff 	movabs $0xffffffffffffdcba,%rax
+  802f47:	ff ff ff 
+  802f4a:	48 01 d8             	add    %rbx,%rax
+  802f4d:	ff d0                	call   *%rax
+  802f4f:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  802f56:	00 00 00 
+  802f59:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  802f5c:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  802f62:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802f65:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  802f6c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802f6f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  802f72:	39 c2                	cmp    %eax,%edx
+  802f74:	0f 4e c2             	cmovle %edx,%eax
+  802f77:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  802f7d:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  802f83:	48 63 d0             	movslq %eax,%rdx
+  802f86:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  802f8d:	48 89 c6             	mov    %rax,%rsi
+  802f90:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  802f97:	00 00 00 
+  802f9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f9e:	48 89 c7             	mov    %rax,%rdi
+  802fa1:	49 89 df             	mov    %rbx,%r15
+  802fa4:	48 b8 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rax
+  802fab:	ff ff ff 
+  802fae:	48 01 d8             	add    %rbx,%rax
+  802fb1:	ff d0                	call   *%rax
+	req->req_s = s;
+  802fb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fb7:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  802fbd:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  802fbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fc3:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  802fc9:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  802fcc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fd0:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  802fd6:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  802fd9:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  802fe0:	00 00 00 
+  802fe3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fe7:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  802feb:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802ff2:	00 
+  802ff3:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  802ff9:	48 63 d0             	movslq %eax,%rdx
+  802ffc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803000:	48 01 d0             	add    %rdx,%rax
+  803003:	48 83 e8 01          	sub    $0x1,%rax
+  803007:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80300b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80300f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803014:	48 f7 75 d8          	divq   -0x28(%rbp)
+  803018:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80301c:	48 29 d0             	sub    %rdx,%rax
+  80301f:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  803025:	85 c0                	test   %eax,%eax
+  803027:	0f 48 c2             	cmovs  %edx,%eax
+  80302a:	c1 f8 0c             	sar    $0xc,%eax
+  80302d:	48 98                	cltq
+  80302f:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  803033:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  803037:	48 85 c0             	test   %rax,%rax
+  80303a:	0f 95 c0             	setne  %al
+  80303d:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  803040:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  803047:	00 
+  803048:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80304c:	48 83 c0 0b          	add    $0xb,%rax
+  803050:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803054:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803058:	ba 00 00 00 00       	mov    $0x0,%edx
+  80305d:	48 f7 75 c8          	divq   -0x38(%rbp)
+  803061:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803065:	48 29 d0             	sub    %rdx,%rax
+  803068:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80306c:	89 c7                	mov    %eax,%edi
+  80306e:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  803075:	00 00 00 
+  803078:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80307b:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80307f:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  803083:	48 83 ec 08          	sub    $0x8,%rsp
+  803087:	6a 00                	push   $0x0
+  803089:	6a 00                	push   $0x0
+  80308b:	6a 05                	push   $0x5
+  80308d:	41 89 f1             	mov    %esi,%r9d
+  803090:	49 89 c8             	mov    %rcx,%r8
+  803093:	89 f9                	mov    %edi,%ecx
+  803095:	be 08 00 00 00       	mov    $0x8,%esi
+  80309a:	89 c7                	mov    %eax,%edi
+  80309c:	49 89 df             	mov    %rbx,%r15
+  80309f:	48 b8 c2 d8 ff ff ff 	movabs $0xffffffffffffd8c2,%rax
+  8030a6:	ff ff ff 
+  8030a9:	48 01 d8             	add    %rbx,%rax
+  8030ac:	ff d0                	call   *%rax
+  8030ae:	48 83 c4 20          	add    $0x20,%rsp
+}
+  8030b2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8030b6:	5b                   	pop    %rbx
+  8030b7:	41 5f                	pop    %r15
+  8030b9:	5d                   	pop    %rbp
+  8030ba:	c3                   	ret
+
+00000000008030bb <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8030bb:	55                   	push   %rbp
+  8030bc:	48 89 e5             	mov    %rsp,%rbp
+  8030bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8030c3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8030c3 <nsipc_socket+0x8>
+  8030ca:	49 bb 6d 4f 00 00 00 	movabs $0x4f6d,%r11
+  8030d1:	00 00 00 
+  8030d4:	4c 01 d8             	add    %r11,%rax
+  8030d7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8030da:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8030dd:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8030e0:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  8030e7:	00 00 00 
+  8030ea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8030ed:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8030f0:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  8030f7:	00 00 00 
+  8030fa:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8030fd:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  803101:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  803108:	00 00 00 
+  80310b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80310e:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  803112:	bf 09 00 00 00       	mov    $0x9,%edi
+  803117:	48 ba a0 a9 ff ff ff 	movabs $0xffffffffffffa9a0,%rdx
+  80311e:	ff ff ff 
+  803121:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803125:	ff d0                	call   *%rax
+}
+  803127:	c9                   	leave
+  803128:	c3                   	ret
+
+0000000000803129 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  803129:	55                   	push   %rbp
+  80312a:	48 89 e5             	mov    %rsp,%rbp
+  80312d:	41 57                	push   %r15
+  80312f:	53                   	push   %rbx
+  803130:	48 83 ec 30          	sub    $0x30,%rsp
+  803134:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803134 <pipe+0xb>
+  80313b:	49 bb fc 4e 00 00 00 	movabs $0x4efc,%r11
+  803142:	00 00 00 
+  803145:	4c 01 db             	add    %r11,%rbx
+  803148:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  80314c:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  803150:	48 89 c7             	mov    %rax,%rdi
+  803153:	49 89 df             	mov    %rbx,%r15
+  803156:	48 b8 ba 8d ff ff ff 	movabs $0xffffffffffff8dba,%rax
+  80315d:	ff ff ff 
+  803160:	48 01 d8             	add    %rbx,%rax
+  803163:	ff d0                	call   *%rax
+  803165:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803168:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80316c:	0f 88 12 02 00 00    	js     803384 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803172:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803176:	ba 07 04 00 00       	mov    $0x407,%edx
+  80317b:	48 89 c6             	mov    %rax,%rsi
+  80317e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803183:	49 89 df             	mov    %rbx,%r15
+  803186:	48 b8 97 85 ff ff ff 	movabs $0xffffffffffff8597,%rax
+  80318d:	ff ff ff 
+  803190:	48 01 d8             	add    %rbx,%rax
+  803193:	ff d0                	call   *%rax
+  803195:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803198:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80319c:	0f 88 e2 01 00 00    	js     803384 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8031a2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8031a6:	48 89 c7             	mov    %rax,%rdi
+  8031a9:	49 89 df             	mov    %rbx,%r15
+  8031ac:	48 b8 ba 8d ff ff ff 	movabs $0xffffffffffff8dba,%rax
+  8031b3:	ff ff ff 
+  8031b6:	48 01 d8             	add    %rbx,%rax
+  8031b9:	ff d0                	call   *%rax
+  8031bb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031c2:	0f 88 9b 01 00 00    	js     803363 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031c8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031cc:	ba 07 04 00 00       	mov    $0x407,%edx
+  8031d1:	48 89 c6             	mov    %rax,%rsi
+  8031d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d9:	49 89 df             	mov    %rbx,%r15
+  8031dc:	48 b8 97 85 ff ff ff 	movabs $0xffffffffffff8597,%rax
+  8031e3:	ff ff ff 
+  8031e6:	48 01 d8             	add    %rbx,%rax
+  8031e9:	ff d0                	call   *%rax
+  8031eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031f2:	0f 88 6b 01 00 00    	js     803363 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8031f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031fc:	48 89 c7             	mov    %rax,%rdi
+  8031ff:	49 89 df             	mov    %rbx,%r15
+  803202:	48 b8 77 8d ff ff ff 	movabs $0xffffffffffff8d77,%rax
+  803209:	ff ff ff 
+  80320c:	48 01 d8             	add    %rbx,%rax
+  80320f:	ff d0                	call   *%rax
+  803211:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803215:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803219:	ba 07 04 00 00       	mov    $0x407,%edx
+  80321e:	48 89 c6             	mov    %rax,%rsi
+  803221:	bf 00 00 00 00       	mov    $0x0,%edi
+  803226:	49 89 df             	mov    %rbx,%r15
+  803229:	48 b8 97 85 ff ff ff 	movabs $0xffffffffffff8597,%rax
+  803230:	ff ff ff 
+  803233:	48 01 d8             	add    %rbx,%rax
+  803236:	ff d0                	call   *%rax
+  803238:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80323b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80323f:	0f 88 fd 00 00 00    	js     803342 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803245:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803249:	48 89 c7             	mov    %rax,%rdi
+  80324c:	49 89 df             	mov    %rbx,%r15
+  80324f:	48 b8 77 8d ff ff ff 	movabs $0xffffffffffff8d77,%rax
+  803256:	ff ff ff 
+  803259:	48 01 d8             	add    %rbx,%rax
+  80325c:	ff d0                	call   *%rax
+  80325e:	48 89 c2             	mov    %rax,%rdx
+  803261:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803265:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80326b:	48 89 d1             	mov    %rdx,%rcx
+  80326e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803273:	48 89 c6             	mov    %rax,%rsi
+  803276:	bf 00 00 00 00       	mov    $0x0,%edi
+  80327b:	49 89 df             	mov    %rbx,%r15
+  80327e:	48 b8 fc 85 ff ff ff 	movabs $0xffffffffffff85fc,%rax
+  803285:	ff ff ff 
+  803288:	48 01 d8             	add    %rbx,%rax
+  80328b:	ff d0                	call   *%rax
+  80328d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803290:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803294:	0f 88 87 00 00 00    	js     803321 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  80329a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80329e:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  8032a5:	00 00 00 
+  8032a8:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8032ab:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  8032ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032b1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032bc:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  8032c3:	00 00 00 
+  8032c6:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8032c9:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8032cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032cf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8032d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032da:	48 89 c7             	mov    %rax,%rdi
+  8032dd:	49 89 df             	mov    %rbx,%r15
+  8032e0:	48 b8 40 8d ff ff ff 	movabs $0xffffffffffff8d40,%rax
+  8032e7:	ff ff ff 
+  8032ea:	48 01 d8             	add    %rbx,%rax
+  8032ed:	ff d0                	call   *%rax
+  8032ef:	89 c2                	mov    %eax,%edx
+  8032f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032f5:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8032f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032fb:	48 89 c7             	mov    %rax,%rdi
+  8032fe:	49 89 df             	mov    %rbx,%r15
+  803301:	48 b8 40 8d ff ff ff 	movabs $0xffffffffffff8d40,%rax
+  803308:	ff ff ff 
+  80330b:	48 01 d8             	add    %rbx,%rax
+  80330e:	ff d0                	call   *%rax
+  803310:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803314:	48 83 c2 04          	add    $0x4,%rdx
+  803318:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  80331a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80331f:	eb 67                	jmp    803388 <pipe+0x25f>
+		goto err3;
+  803321:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  803322:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803326:	48 89 c6             	mov    %rax,%rsi
+  803329:	bf 00 00 00 00       	mov    $0x0,%edi
+  80332e:	49 89 df             	mov    %rbx,%r15
+  803331:	48 b8 6f 86 ff ff ff 	movabs $0xffffffffffff866f,%rax
+  803338:	ff ff ff 
+  80333b:	48 01 d8             	add    %rbx,%rax
+  80333e:	ff d0                	call   *%rax
+  803340:	eb 01                	jmp    803343 <pipe+0x21a>
+		goto err2;
+  803342:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  803343:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803347:	48 89 c6             	mov    %rax,%rsi
+  80334a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80334f:	49 89 df             	mov    %rbx,%r15
+  803352:	48 b8 6f 86 ff ff ff 	movabs $0xffffffffffff866f,%rax
+  803359:	ff ff ff 
+  80335c:	48 01 d8             	add    %rbx,%rax
+  80335f:	ff d0                	call   *%rax
+  803361:	eb 01                	jmp    803364 <pipe+0x23b>
+		goto err1;
+  803363:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  803364:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803368:	48 89 c6             	mov    %rax,%rsi
+  80336b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803370:	49 89 df             	mov    %rbx,%r15
+  803373:	48 b8 6f 86 ff ff ff 	movabs $0xffffffffffff866f,%rax
+  80337a:	ff ff ff 
+  80337d:	48 01 d8             	add    %rbx,%rax
+  803380:	ff d0                	call   *%rax
+  803382:	eb 01                	jmp    803385 <pipe+0x25c>
+		goto err;
+  803384:	90                   	nop
+err:
+	return r;
+  803385:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803388:	48 83 c4 30          	add    $0x30,%rsp
+  80338c:	5b                   	pop    %rbx
+  80338d:	41 5f                	pop    %r15
+  80338f:	5d                   	pop    %rbp
+  803390:	c3                   	ret
+
+0000000000803391 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803391:	55                   	push   %rbp
+  803392:	48 89 e5             	mov    %rsp,%rbp
+  803395:	41 57                	push   %r15
+  803397:	41 54                	push   %r12
+  803399:	53                   	push   %rbx
+  80339a:	48 83 ec 28          	sub    $0x28,%rsp
+  80339e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80339e <_pipeisclosed+0xd>
+  8033a5:	49 bb 92 4c 00 00 00 	movabs $0x4c92,%r11
+  8033ac:	00 00 00 
+  8033af:	4c 01 db             	add    %r11,%rbx
+  8033b2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8033b6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8033ba:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8033c1:	ff ff ff 
+  8033c4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033c8:	48 8b 00             	mov    (%rax),%rax
+  8033cb:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8033d1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8033d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033d8:	48 89 c7             	mov    %rax,%rdi
+  8033db:	49 89 df             	mov    %rbx,%r15
+  8033de:	48 b8 49 dd ff ff ff 	movabs $0xffffffffffffdd49,%rax
+  8033e5:	ff ff ff 
+  8033e8:	48 01 d8             	add    %rbx,%rax
+  8033eb:	ff d0                	call   *%rax
+  8033ed:	41 89 c4             	mov    %eax,%r12d
+  8033f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033f4:	48 89 c7             	mov    %rax,%rdi
+  8033f7:	49 89 df             	mov    %rbx,%r15
+  8033fa:	48 b8 49 dd ff ff ff 	movabs $0xffffffffffffdd49,%rax
+  803401:	ff ff ff 
+  803404:	48 01 d8             	add    %rbx,%rax
+  803407:	ff d0                	call   *%rax
+  803409:	41 39 c4             	cmp    %eax,%r12d
+  80340c:	0f 94 c0             	sete   %al
+  80340f:	0f b6 c0             	movzbl %al,%eax
+  803412:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  803415:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80341c:	ff ff ff 
+  80341f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803423:	48 8b 00             	mov    (%rax),%rax
+  803426:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80342c:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80342f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803432:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  803435:	75 05                	jne    80343c <_pipeisclosed+0xab>
+			return ret;
+  803437:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80343a:	eb 63                	jmp    80349f <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  80343c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80343f:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  803442:	0f 84 72 ff ff ff    	je     8033ba <_pipeisclosed+0x29>
+  803448:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  80344c:	0f 85 68 ff ff ff    	jne    8033ba <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803452:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803459:	ff ff ff 
+  80345c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803460:	48 8b 00             	mov    (%rax),%rax
+  803463:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  803469:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80346c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80346f:	89 c6                	mov    %eax,%esi
+  803471:	48 b8 5e df ff ff ff 	movabs $0xffffffffffffdf5e,%rax
+  803478:	ff ff ff 
+  80347b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80347f:	48 89 c7             	mov    %rax,%rdi
+  803482:	49 89 df             	mov    %rbx,%r15
+  803485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348a:	49 b8 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%r8
+  803491:	ff ff ff 
+  803494:	49 01 d8             	add    %rbx,%r8
+  803497:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  80349a:	e9 1b ff ff ff       	jmp    8033ba <_pipeisclosed+0x29>
+	}
+}
+  80349f:	48 83 c4 28          	add    $0x28,%rsp
+  8034a3:	5b                   	pop    %rbx
+  8034a4:	41 5c                	pop    %r12
+  8034a6:	41 5f                	pop    %r15
+  8034a8:	5d                   	pop    %rbp
+  8034a9:	c3                   	ret
+
+00000000008034aa <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8034aa:	55                   	push   %rbp
+  8034ab:	48 89 e5             	mov    %rsp,%rbp
+  8034ae:	41 57                	push   %r15
+  8034b0:	53                   	push   %rbx
+  8034b1:	48 83 ec 30          	sub    $0x30,%rsp
+  8034b5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034b5 <pipeisclosed+0xb>
+  8034bc:	49 bb 7b 4b 00 00 00 	movabs $0x4b7b,%r11
+  8034c3:	00 00 00 
+  8034c6:	4c 01 db             	add    %r11,%rbx
+  8034c9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034cc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8034d0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8034d3:	48 89 d6             	mov    %rdx,%rsi
+  8034d6:	89 c7                	mov    %eax,%edi
+  8034d8:	49 89 df             	mov    %rbx,%r15
+  8034db:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  8034e2:	ff ff ff 
+  8034e5:	48 01 d8             	add    %rbx,%rax
+  8034e8:	ff d0                	call   *%rax
+  8034ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034f1:	79 05                	jns    8034f8 <pipeisclosed+0x4e>
+		return r;
+  8034f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034f6:	eb 3b                	jmp    803533 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8034f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034fc:	48 89 c7             	mov    %rax,%rdi
+  8034ff:	49 89 df             	mov    %rbx,%r15
+  803502:	48 b8 77 8d ff ff ff 	movabs $0xffffffffffff8d77,%rax
+  803509:	ff ff ff 
+  80350c:	48 01 d8             	add    %rbx,%rax
+  80350f:	ff d0                	call   *%rax
+  803511:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  803515:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803519:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80351d:	48 89 d6             	mov    %rdx,%rsi
+  803520:	48 89 c7             	mov    %rax,%rdi
+  803523:	48 b8 61 b3 ff ff ff 	movabs $0xffffffffffffb361,%rax
+  80352a:	ff ff ff 
+  80352d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803531:	ff d0                	call   *%rax
+}
+  803533:	48 83 c4 30          	add    $0x30,%rsp
+  803537:	5b                   	pop    %rbx
+  803538:	41 5f                	pop    %r15
+  80353a:	5d                   	pop    %rbp
+  80353b:	c3                   	ret
+
+000000000080353c <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80353c:	55                   	push   %rbp
+  80353d:	48 89 e5             	mov    %rsp,%rbp
+  803540:	41 57                	push   %r15
+  803542:	53                   	push   %rbx
+  803543:	48 83 ec 40          	sub    $0x40,%rsp
+  803547:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803547 <devpipe_read+0xb>
+  80354e:	49 bb e9 4a 00 00 00 	movabs $0x4ae9,%r11
+  803555:	00 00 00 
+  803558:	4c 01 db             	add    %r11,%rbx
+  80355b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80355f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803563:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  803567:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80356b:	48 89 c7             	mov    %rax,%rdi
+  80356e:	49 89 df             	mov    %rbx,%r15
+  803571:	48 b8 77 8d ff ff ff 	movabs $0xffffffffffff8d77,%rax
+  803578:	ff ff ff 
+  80357b:	48 01 d8             	add    %rbx,%rax
+  80357e:	ff d0                	call   *%rax
+  803580:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  803584:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803588:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80358c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803593:	00 
+  803594:	e9 a1 00 00 00       	jmp    80363a <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  803599:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80359e:	74 09                	je     8035a9 <devpipe_read+0x6d>
+				return i;
+  8035a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035a4:	e9 9f 00 00 00       	jmp    803648 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8035a9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8035ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035b1:	48 89 d6             	mov    %rdx,%rsi
+  8035b4:	48 89 c7             	mov    %rax,%rdi
+  8035b7:	48 b8 61 b3 ff ff ff 	movabs $0xffffffffffffb361,%rax
+  8035be:	ff ff ff 
+  8035c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035c5:	ff d0                	call   *%rax
+  8035c7:	85 c0                	test   %eax,%eax
+  8035c9:	74 07                	je     8035d2 <devpipe_read+0x96>
+				return 0;
+  8035cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d0:	eb 76                	jmp    803648 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8035d2:	49 89 df             	mov    %rbx,%r15
+  8035d5:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  8035dc:	ff ff ff 
+  8035df:	48 01 d8             	add    %rbx,%rax
+  8035e2:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8035e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035e8:	8b 10                	mov    (%rax),%edx
+  8035ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035ee:	8b 40 04             	mov    0x4(%rax),%eax
+  8035f1:	39 c2                	cmp    %eax,%edx
+  8035f3:	74 a4                	je     803599 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8035f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035f9:	8b 10                	mov    (%rax),%edx
+  8035fb:	89 d0                	mov    %edx,%eax
+  8035fd:	c1 f8 1f             	sar    $0x1f,%eax
+  803600:	c1 e8 1b             	shr    $0x1b,%eax
+  803603:	01 c2                	add    %eax,%edx
+  803605:	83 e2 1f             	and    $0x1f,%edx
+  803608:	29 c2                	sub    %eax,%edx
+  80360a:	89 d6                	mov    %edx,%esi
+  80360c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803610:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803614:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  803618:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80361c:	48 63 c6             	movslq %esi,%rax
+  80361f:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  803624:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  803626:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80362a:	8b 00                	mov    (%rax),%eax
+  80362c:	8d 50 01             	lea    0x1(%rax),%edx
+  80362f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803633:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  803635:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80363a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80363e:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  803642:	72 a0                	jb     8035e4 <devpipe_read+0xa8>
+	}
+	return i;
+  803644:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  803648:	48 83 c4 40          	add    $0x40,%rsp
+  80364c:	5b                   	pop    %rbx
+  80364d:	41 5f                	pop    %r15
+  80364f:	5d                   	pop    %rbp
+  803650:	c3                   	ret
+
+0000000000803651 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  803651:	55                   	push   %rbp
+  803652:	48 89 e5             	mov    %rsp,%rbp
+  803655:	41 57                	push   %r15
+  803657:	53                   	push   %rbx
+  803658:	48 83 ec 40          	sub    $0x40,%rsp
+  80365c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80365c <devpipe_write+0xb>
+  803663:	49 bb d4 49 00 00 00 	movabs $0x49d4,%r11
+  80366a:	00 00 00 
+  80366d:	4c 01 db             	add    %r11,%rbx
+  803670:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803674:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803678:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80367c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803680:	48 89 c7             	mov    %rax,%rdi
+  803683:	49 89 df             	mov    %rbx,%r15
+  803686:	48 b8 77 8d ff ff ff 	movabs $0xffffffffffff8d77,%rax
+  80368d:	ff ff ff 
+  803690:	48 01 d8             	add    %rbx,%rax
+  803693:	ff d0                	call   *%rax
+  803695:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  803699:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80369d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8036a1:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8036a8:	00 
+  8036a9:	e9 a0 00 00 00       	jmp    80374e <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8036ae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036b6:	48 89 d6             	mov    %rdx,%rsi
+  8036b9:	48 89 c7             	mov    %rax,%rdi
+  8036bc:	48 b8 61 b3 ff ff ff 	movabs $0xffffffffffffb361,%rax
+  8036c3:	ff ff ff 
+  8036c6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036ca:	ff d0                	call   *%rax
+  8036cc:	85 c0                	test   %eax,%eax
+  8036ce:	74 0a                	je     8036da <devpipe_write+0x89>
+				return 0;
+  8036d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d5:	e9 82 00 00 00       	jmp    80375c <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8036da:	49 89 df             	mov    %rbx,%r15
+  8036dd:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  8036e4:	ff ff ff 
+  8036e7:	48 01 d8             	add    %rbx,%rax
+  8036ea:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8036ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036f0:	8b 40 04             	mov    0x4(%rax),%eax
+  8036f3:	48 63 d0             	movslq %eax,%rdx
+  8036f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036fa:	8b 00                	mov    (%rax),%eax
+  8036fc:	48 98                	cltq
+  8036fe:	48 83 c0 20          	add    $0x20,%rax
+  803702:	48 39 c2             	cmp    %rax,%rdx
+  803705:	73 a7                	jae    8036ae <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803707:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80370b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80370f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  803713:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803717:	8b 50 04             	mov    0x4(%rax),%edx
+  80371a:	89 d0                	mov    %edx,%eax
+  80371c:	c1 f8 1f             	sar    $0x1f,%eax
+  80371f:	c1 e8 1b             	shr    $0x1b,%eax
+  803722:	01 c2                	add    %eax,%edx
+  803724:	83 e2 1f             	and    $0x1f,%edx
+  803727:	29 c2                	sub    %eax,%edx
+  803729:	89 d0                	mov    %edx,%eax
+  80372b:	0f b6 09             	movzbl (%rcx),%ecx
+  80372e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803732:	48 98                	cltq
+  803734:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  803738:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80373c:	8b 40 04             	mov    0x4(%rax),%eax
+  80373f:	8d 50 01             	lea    0x1(%rax),%edx
+  803742:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803746:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  803749:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80374e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803752:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  803756:	72 94                	jb     8036ec <devpipe_write+0x9b>
+	}
+
+	return i;
+  803758:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80375c:	48 83 c4 40          	add    $0x40,%rsp
+  803760:	5b                   	pop    %rbx
+  803761:	41 5f                	pop    %r15
+  803763:	5d                   	pop    %rbp
+  803764:	c3                   	ret
+
+0000000000803765 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803765:	55                   	push   %rbp
+  803766:	48 89 e5             	mov    %rsp,%rbp
+  803769:	41 57                	push   %r15
+  80376b:	53                   	push   %rbx
+  80376c:	48 83 ec 20          	sub    $0x20,%rsp
+  803770:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803770 <devpipe_stat+0xb>
+  803777:	49 bb c0 48 00 00 00 	movabs $0x48c0,%r11
+  80377e:	00 00 00 
+  803781:	4c 01 db             	add    %r11,%rbx
+  803784:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803788:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80378c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803790:	48 89 c7             	mov    %rax,%rdi
+  803793:	49 89 df             	mov    %rbx,%r15
+  803796:	48 b8 77 8d ff ff ff 	movabs $0xffffffffffff8d77,%rax
+  80379d:	ff ff ff 
+  8037a0:	48 01 d8             	add    %rbx,%rax
+  8037a3:	ff d0                	call   *%rax
+  8037a5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8037a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037ad:	48 ba 71 df ff ff ff 	movabs $0xffffffffffffdf71,%rdx
+  8037b4:	ff ff ff 
+  8037b7:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8037bb:	48 89 d6             	mov    %rdx,%rsi
+  8037be:	48 89 c7             	mov    %rax,%rdi
+  8037c1:	49 89 df             	mov    %rbx,%r15
+  8037c4:	48 b8 e2 cc ff ff ff 	movabs $0xffffffffffffcce2,%rax
+  8037cb:	ff ff ff 
+  8037ce:	48 01 d8             	add    %rbx,%rax
+  8037d1:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8037d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037d7:	8b 50 04             	mov    0x4(%rax),%edx
+  8037da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037de:	8b 00                	mov    (%rax),%eax
+  8037e0:	29 c2                	sub    %eax,%edx
+  8037e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037e6:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8037ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037f0:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8037f7:	00 00 00 
+	stat->st_dev = &devpipe;
+  8037fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037fe:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  803805:	00 00 00 
+  803808:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80380c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  803813:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803818:	48 83 c4 20          	add    $0x20,%rsp
+  80381c:	5b                   	pop    %rbx
+  80381d:	41 5f                	pop    %r15
+  80381f:	5d                   	pop    %rbp
+  803820:	c3                   	ret
+
+0000000000803821 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803821:	55                   	push   %rbp
+  803822:	48 89 e5             	mov    %rsp,%rbp
+  803825:	41 57                	push   %r15
+  803827:	53                   	push   %rbx
+  803828:	48 83 ec 10          	sub    $0x10,%rsp
+  80382c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80382c <devpipe_close+0xb>
+  803833:	49 bb 04 48 00 00 00 	movabs $0x4804,%r11
+  80383a:	00 00 00 
+  80383d:	4c 01 db             	add    %r11,%rbx
+  803840:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  803844:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803848:	48 89 c6             	mov    %rax,%rsi
+  80384b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803850:	49 89 df             	mov    %rbx,%r15
+  803853:	48 b8 6f 86 ff ff ff 	movabs $0xffffffffffff866f,%rax
+  80385a:	ff ff ff 
+  80385d:	48 01 d8             	add    %rbx,%rax
+  803860:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  803862:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803866:	48 89 c7             	mov    %rax,%rdi
+  803869:	49 89 df             	mov    %rbx,%r15
+  80386c:	48 b8 77 8d ff ff ff 	movabs $0xffffffffffff8d77,%rax
+  803873:	ff ff ff 
+  803876:	48 01 d8             	add    %rbx,%rax
+  803879:	ff d0                	call   *%rax
+  80387b:	48 89 c6             	mov    %rax,%rsi
+  80387e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803883:	49 89 df             	mov    %rbx,%r15
+  803886:	48 b8 6f 86 ff ff ff 	movabs $0xffffffffffff866f,%rax
+  80388d:	ff ff ff 
+  803890:	48 01 d8             	add    %rbx,%rax
+  803893:	ff d0                	call   *%rax
+}
+  803895:	48 83 c4 10          	add    $0x10,%rsp
+  803899:	5b                   	pop    %rbx
+  80389a:	41 5f                	pop    %r15
+  80389c:	5d                   	pop    %rbp
+  80389d:	c3                   	ret
+
+000000000080389e <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80389e:	55                   	push   %rbp
+  80389f:	48 89 e5             	mov    %rsp,%rbp
+  8038a2:	41 57                	push   %r15
+  8038a4:	48 83 ec 28          	sub    $0x28,%rsp
+  8038a8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038a8 <cputchar+0xa>
+  8038af:	49 bb 88 47 00 00 00 	movabs $0x4788,%r11
+  8038b6:	00 00 00 
+  8038b9:	4c 01 d8             	add    %r11,%rax
+  8038bc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8038bf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8038c2:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8038c5:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8038c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8038ce:	48 89 d7             	mov    %rdx,%rdi
+  8038d1:	49 89 c7             	mov    %rax,%r15
+  8038d4:	48 ba df 83 ff ff ff 	movabs $0xffffffffffff83df,%rdx
+  8038db:	ff ff ff 
+  8038de:	48 01 c2             	add    %rax,%rdx
+  8038e1:	ff d2                	call   *%rdx
+}
+  8038e3:	90                   	nop
+  8038e4:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8038e8:	c9                   	leave
+  8038e9:	c3                   	ret
+
+00000000008038ea <getchar>:
+
+int
+getchar(void)
+{
+  8038ea:	55                   	push   %rbp
+  8038eb:	48 89 e5             	mov    %rsp,%rbp
+  8038ee:	41 57                	push   %r15
+  8038f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8038f4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038f4 <getchar+0xa>
+  8038fb:	49 bb 3c 47 00 00 00 	movabs $0x473c,%r11
+  803902:	00 00 00 
+  803905:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  803908:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80390c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803911:	48 89 ce             	mov    %rcx,%rsi
+  803914:	bf 00 00 00 00       	mov    $0x0,%edi
+  803919:	49 89 c7             	mov    %rax,%r15
+  80391c:	48 b9 b7 93 ff ff ff 	movabs $0xffffffffffff93b7,%rcx
+  803923:	ff ff ff 
+  803926:	48 01 c1             	add    %rax,%rcx
+  803929:	ff d1                	call   *%rcx
+  80392b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80392e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803932:	79 05                	jns    803939 <getchar+0x4f>
+		return r;
+  803934:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803937:	eb 14                	jmp    80394d <getchar+0x63>
+	if (r < 1)
+  803939:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80393d:	7f 07                	jg     803946 <getchar+0x5c>
+		return -E_EOF;
+  80393f:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  803944:	eb 07                	jmp    80394d <getchar+0x63>
+	return c;
+  803946:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  80394a:	0f b6 c0             	movzbl %al,%eax
+}
+  80394d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803951:	c9                   	leave
+  803952:	c3                   	ret
+
+0000000000803953 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  803953:	55                   	push   %rbp
+  803954:	48 89 e5             	mov    %rsp,%rbp
+  803957:	41 57                	push   %r15
+  803959:	53                   	push   %rbx
+  80395a:	48 83 ec 20          	sub    $0x20,%rsp
+  80395e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80395e <iscons+0xb>
+  803965:	49 bb d2 46 00 00 00 	movabs $0x46d2,%r11
+  80396c:	00 00 00 
+  80396f:	4c 01 db             	add    %r11,%rbx
+  803972:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803975:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803979:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80397c:	48 89 d6             	mov    %rdx,%rsi
+  80397f:	89 c7                	mov    %eax,%edi
+  803981:	49 89 df             	mov    %rbx,%r15
+  803984:	48 b8 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%rax
+  80398b:	ff ff ff 
+  80398e:	48 01 d8             	add    %rbx,%rax
+  803991:	ff d0                	call   *%rax
+  803993:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803996:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80399a:	79 05                	jns    8039a1 <iscons+0x4e>
+		return r;
+  80399c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80399f:	eb 1b                	jmp    8039bc <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8039a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039a5:	8b 10                	mov    (%rax),%edx
+  8039a7:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  8039ae:	00 00 00 
+  8039b1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8039b4:	39 c2                	cmp    %eax,%edx
+  8039b6:	0f 94 c0             	sete   %al
+  8039b9:	0f b6 c0             	movzbl %al,%eax
+}
+  8039bc:	48 83 c4 20          	add    $0x20,%rsp
+  8039c0:	5b                   	pop    %rbx
+  8039c1:	41 5f                	pop    %r15
+  8039c3:	5d                   	pop    %rbp
+  8039c4:	c3                   	ret
+
+00000000008039c5 <opencons>:
+
+int
+opencons(void)
+{
+  8039c5:	55                   	push   %rbp
+  8039c6:	48 89 e5             	mov    %rsp,%rbp
+  8039c9:	41 57                	push   %r15
+  8039cb:	53                   	push   %rbx
+  8039cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8039d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039d0 <opencons+0xb>
+  8039d7:	49 bb 60 46 00 00 00 	movabs $0x4660,%r11
+  8039de:	00 00 00 
+  8039e1:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8039e4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8039e8:	48 89 c7             	mov    %rax,%rdi
+  8039eb:	49 89 df             	mov    %rbx,%r15
+  8039ee:	48 b8 ba 8d ff ff ff 	movabs $0xffffffffffff8dba,%rax
+  8039f5:	ff ff ff 
+  8039f8:	48 01 d8             	add    %rbx,%rax
+  8039fb:	ff d0                	call   *%rax
+  8039fd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a00:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a04:	79 05                	jns    803a0b <opencons+0x46>
+		return r;
+  803a06:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a09:	eb 68                	jmp    803a73 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803a0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a0f:	ba 07 04 00 00       	mov    $0x407,%edx
+  803a14:	48 89 c6             	mov    %rax,%rsi
+  803a17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a1c:	49 89 df             	mov    %rbx,%r15
+  803a1f:	48 b8 97 85 ff ff ff 	movabs $0xffffffffffff8597,%rax
+  803a26:	ff ff ff 
+  803a29:	48 01 d8             	add    %rbx,%rax
+  803a2c:	ff d0                	call   *%rax
+  803a2e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a31:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a35:	79 05                	jns    803a3c <opencons+0x77>
+		return r;
+  803a37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a3a:	eb 37                	jmp    803a73 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  803a3c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a40:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  803a47:	00 00 00 
+  803a4a:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803a4d:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  803a4f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a53:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  803a5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a5e:	48 89 c7             	mov    %rax,%rdi
+  803a61:	49 89 df             	mov    %rbx,%r15
+  803a64:	48 b8 40 8d ff ff ff 	movabs $0xffffffffffff8d40,%rax
+  803a6b:	ff ff ff 
+  803a6e:	48 01 d8             	add    %rbx,%rax
+  803a71:	ff d0                	call   *%rax
+}
+  803a73:	48 83 c4 10          	add    $0x10,%rsp
+  803a77:	5b                   	pop    %rbx
+  803a78:	41 5f                	pop    %r15
+  803a7a:	5d                   	pop    %rbp
+  803a7b:	c3                   	ret
+
+0000000000803a7c <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  803a7c:	55                   	push   %rbp
+  803a7d:	48 89 e5             	mov    %rsp,%rbp
+  803a80:	41 57                	push   %r15
+  803a82:	53                   	push   %rbx
+  803a83:	48 83 ec 30          	sub    $0x30,%rsp
+  803a87:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a87 <devcons_read+0xb>
+  803a8e:	49 bb a9 45 00 00 00 	movabs $0x45a9,%r11
+  803a95:	00 00 00 
+  803a98:	4c 01 db             	add    %r11,%rbx
+  803a9b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803a9f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803aa3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  803aa7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803aac:	75 19                	jne    803ac7 <devcons_read+0x4b>
+		return 0;
+  803aae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab3:	eb 55                	jmp    803b0a <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  803ab5:	49 89 df             	mov    %rbx,%r15
+  803ab8:	48 b8 42 85 ff ff ff 	movabs $0xffffffffffff8542,%rax
+  803abf:	ff ff ff 
+  803ac2:	48 01 d8             	add    %rbx,%rax
+  803ac5:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  803ac7:	49 89 df             	mov    %rbx,%r15
+  803aca:	48 b8 3e 84 ff ff ff 	movabs $0xffffffffffff843e,%rax
+  803ad1:	ff ff ff 
+  803ad4:	48 01 d8             	add    %rbx,%rax
+  803ad7:	ff d0                	call   *%rax
+  803ad9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803adc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ae0:	74 d3                	je     803ab5 <devcons_read+0x39>
+	if (c < 0)
+  803ae2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ae6:	79 05                	jns    803aed <devcons_read+0x71>
+		return c;
+  803ae8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803aeb:	eb 1d                	jmp    803b0a <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  803aed:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  803af1:	75 07                	jne    803afa <devcons_read+0x7e>
+		return 0;
+  803af3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af8:	eb 10                	jmp    803b0a <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  803afa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803afd:	89 c2                	mov    %eax,%edx
+  803aff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b03:	88 10                	mov    %dl,(%rax)
+	return 1;
+  803b05:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803b0a:	48 83 c4 30          	add    $0x30,%rsp
+  803b0e:	5b                   	pop    %rbx
+  803b0f:	41 5f                	pop    %r15
+  803b11:	5d                   	pop    %rbp
+  803b12:	c3                   	ret
+
+0000000000803b13 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  803b13:	55                   	push   %rbp
+  803b14:	48 89 e5             	mov    %rsp,%rbp
+  803b17:	41 57                	push   %r15
+  803b19:	53                   	push   %rbx
+  803b1a:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  803b21:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b21 <devcons_write+0xe>
+  803b28:	49 bb 0f 45 00 00 00 	movabs $0x450f,%r11
+  803b2f:	00 00 00 
+  803b32:	4c 01 db             	add    %r11,%rbx
+  803b35:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  803b3c:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  803b43:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  803b4a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803b51:	e9 80 00 00 00       	jmp    803bd6 <devcons_write+0xc3>
+		m = n - tot;
+  803b56:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803b5d:	89 c2                	mov    %eax,%edx
+  803b5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b62:	29 c2                	sub    %eax,%edx
+  803b64:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  803b67:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803b6a:	83 f8 7f             	cmp    $0x7f,%eax
+  803b6d:	76 07                	jbe    803b76 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  803b6f:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  803b76:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803b79:	48 63 d0             	movslq %eax,%rdx
+  803b7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b7f:	48 63 c8             	movslq %eax,%rcx
+  803b82:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  803b89:	48 01 c1             	add    %rax,%rcx
+  803b8c:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  803b93:	48 89 ce             	mov    %rcx,%rsi
+  803b96:	48 89 c7             	mov    %rax,%rdi
+  803b99:	49 89 df             	mov    %rbx,%r15
+  803b9c:	48 b8 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rax
+  803ba3:	ff ff ff 
+  803ba6:	48 01 d8             	add    %rbx,%rax
+  803ba9:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  803bab:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803bae:	48 63 d0             	movslq %eax,%rdx
+  803bb1:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  803bb8:	48 89 d6             	mov    %rdx,%rsi
+  803bbb:	48 89 c7             	mov    %rax,%rdi
+  803bbe:	49 89 df             	mov    %rbx,%r15
+  803bc1:	48 b8 df 83 ff ff ff 	movabs $0xffffffffffff83df,%rax
+  803bc8:	ff ff ff 
+  803bcb:	48 01 d8             	add    %rbx,%rax
+  803bce:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  803bd0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803bd3:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803bd6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bd9:	48 98                	cltq
+  803bdb:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  803be2:	0f 82 6e ff ff ff    	jb     803b56 <devcons_write+0x43>
+	}
+	return tot;
+  803be8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803beb:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  803bf2:	5b                   	pop    %rbx
+  803bf3:	41 5f                	pop    %r15
+  803bf5:	5d                   	pop    %rbp
+  803bf6:	c3                   	ret
+
+0000000000803bf7 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  803bf7:	55                   	push   %rbp
+  803bf8:	48 89 e5             	mov    %rsp,%rbp
+  803bfb:	48 83 ec 08          	sub    $0x8,%rsp
+  803bff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803bff <devcons_close+0x8>
+  803c06:	49 bb 31 44 00 00 00 	movabs $0x4431,%r11
+  803c0d:	00 00 00 
+  803c10:	4c 01 d8             	add    %r11,%rax
+  803c13:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  803c17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c1c:	c9                   	leave
+  803c1d:	c3                   	ret
+
+0000000000803c1e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803c1e:	55                   	push   %rbp
+  803c1f:	48 89 e5             	mov    %rsp,%rbp
+  803c22:	41 57                	push   %r15
+  803c24:	48 83 ec 18          	sub    $0x18,%rsp
+  803c28:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c28 <devcons_stat+0xa>
+  803c2f:	49 bb 08 44 00 00 00 	movabs $0x4408,%r11
+  803c36:	00 00 00 
+  803c39:	4c 01 d8             	add    %r11,%rax
+  803c3c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c40:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  803c44:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c48:	48 b9 7d df ff ff ff 	movabs $0xffffffffffffdf7d,%rcx
+  803c4f:	ff ff ff 
+  803c52:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  803c56:	48 89 ce             	mov    %rcx,%rsi
+  803c59:	48 89 d7             	mov    %rdx,%rdi
+  803c5c:	49 89 c7             	mov    %rax,%r15
+  803c5f:	48 ba e2 cc ff ff ff 	movabs $0xffffffffffffcce2,%rdx
+  803c66:	ff ff ff 
+  803c69:	48 01 c2             	add    %rax,%rdx
+  803c6c:	ff d2                	call   *%rdx
+	return 0;
+  803c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c73:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803c77:	c9                   	leave
+  803c78:	c3                   	ret
+
+0000000000803c79 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803c79:	55                   	push   %rbp
+  803c7a:	48 89 e5             	mov    %rsp,%rbp
+  803c7d:	41 57                	push   %r15
+  803c7f:	41 54                	push   %r12
+  803c81:	53                   	push   %rbx
+  803c82:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  803c89:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c89 <_panic+0x10>
+  803c90:	49 bb a7 43 00 00 00 	movabs $0x43a7,%r11
+  803c97:	00 00 00 
+  803c9a:	4c 01 db             	add    %r11,%rbx
+  803c9d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  803ca4:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  803caa:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  803cb1:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  803cb8:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  803cbf:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  803cc6:	84 c0                	test   %al,%al
+  803cc8:	74 26                	je     803cf0 <_panic+0x77>
+  803cca:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  803cd1:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  803cd8:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  803cdc:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  803ce0:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  803ce4:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  803ce8:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  803cec:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  803cf0:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  803cf7:	00 00 00 
+  803cfa:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  803d01:	00 00 00 
+  803d04:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d08:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  803d0f:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  803d16:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803d1d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803d24:	ff ff ff 
+  803d27:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803d2b:	4c 8b 20             	mov    (%rax),%r12
+  803d2e:	49 89 df             	mov    %rbx,%r15
+  803d31:	48 b8 ee 84 ff ff ff 	movabs $0xffffffffffff84ee,%rax
+  803d38:	ff ff ff 
+  803d3b:	48 01 d8             	add    %rbx,%rax
+  803d3e:	ff d0                	call   *%rax
+  803d40:	89 c6                	mov    %eax,%esi
+  803d42:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  803d48:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  803d4f:	41 89 d0             	mov    %edx,%r8d
+  803d52:	48 89 c1             	mov    %rax,%rcx
+  803d55:	4c 89 e2             	mov    %r12,%rdx
+  803d58:	48 b8 88 df ff ff ff 	movabs $0xffffffffffffdf88,%rax
+  803d5f:	ff ff ff 
+  803d62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d66:	48 89 c7             	mov    %rax,%rdi
+  803d69:	49 89 df             	mov    %rbx,%r15
+  803d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d71:	49 b9 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%r9
+  803d78:	ff ff ff 
+  803d7b:	49 01 d9             	add    %rbx,%r9
+  803d7e:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803d81:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  803d88:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  803d8f:	48 89 d6             	mov    %rdx,%rsi
+  803d92:	48 89 c7             	mov    %rax,%rdi
+  803d95:	49 89 df             	mov    %rbx,%r15
+  803d98:	48 b8 40 be ff ff ff 	movabs $0xffffffffffffbe40,%rax
+  803d9f:	ff ff ff 
+  803da2:	48 01 d8             	add    %rbx,%rax
+  803da5:	ff d0                	call   *%rax
+	cprintf("\n");
+  803da7:	48 b8 ab df ff ff ff 	movabs $0xffffffffffffdfab,%rax
+  803dae:	ff ff ff 
+  803db1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803db5:	48 89 c7             	mov    %rax,%rdi
+  803db8:	49 89 df             	mov    %rbx,%r15
+  803dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc0:	48 ba 20 bf ff ff ff 	movabs $0xffffffffffffbf20,%rdx
+  803dc7:	ff ff ff 
+  803dca:	48 01 da             	add    %rbx,%rdx
+  803dcd:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803dcf:	cc                   	int3
+  803dd0:	eb fd                	jmp    803dcf <_panic+0x156>
+
+0000000000803dd2 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  803dd2:	55                   	push   %rbp
+  803dd3:	48 89 e5             	mov    %rsp,%rbp
+  803dd6:	41 57                	push   %r15
+  803dd8:	48 83 ec 18          	sub    $0x18,%rsp
+  803ddc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ddc <putch+0xa>
+  803de3:	49 bb 54 42 00 00 00 	movabs $0x4254,%r11
+  803dea:	00 00 00 
+  803ded:	4c 01 d8             	add    %r11,%rax
+  803df0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803df3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  803df7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803dfb:	8b 12                	mov    (%rdx),%edx
+  803dfd:	8d 72 01             	lea    0x1(%rdx),%esi
+  803e00:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803e04:	89 31                	mov    %esi,(%rcx)
+  803e06:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  803e09:	89 ce                	mov    %ecx,%esi
+  803e0b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803e0f:	48 63 d2             	movslq %edx,%rdx
+  803e12:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  803e17:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e1b:	8b 12                	mov    (%rdx),%edx
+  803e1d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803e23:	75 33                	jne    803e58 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  803e25:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e29:	8b 12                	mov    (%rdx),%edx
+  803e2b:	48 63 d2             	movslq %edx,%rdx
+  803e2e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803e32:	48 83 c1 08          	add    $0x8,%rcx
+  803e36:	48 89 d6             	mov    %rdx,%rsi
+  803e39:	48 89 cf             	mov    %rcx,%rdi
+  803e3c:	49 89 c7             	mov    %rax,%r15
+  803e3f:	48 ba df 83 ff ff ff 	movabs $0xffffffffffff83df,%rdx
+  803e46:	ff ff ff 
+  803e49:	48 01 c2             	add    %rax,%rdx
+  803e4c:	ff d2                	call   *%rdx
+        b->idx = 0;
+  803e4e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e52:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  803e58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e5c:	8b 40 04             	mov    0x4(%rax),%eax
+  803e5f:	8d 50 01             	lea    0x1(%rax),%edx
+  803e62:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e66:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  803e69:	90                   	nop
+  803e6a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803e6e:	c9                   	leave
+  803e6f:	c3                   	ret
+
+0000000000803e70 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  803e70:	55                   	push   %rbp
+  803e71:	48 89 e5             	mov    %rsp,%rbp
+  803e74:	41 57                	push   %r15
+  803e76:	53                   	push   %rbx
+  803e77:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  803e7e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e7e <vcprintf+0xe>
+  803e85:	49 bb b2 41 00 00 00 	movabs $0x41b2,%r11
+  803e8c:	00 00 00 
+  803e8f:	4c 01 db             	add    %r11,%rbx
+  803e92:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  803e99:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  803ea0:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  803ea7:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  803eae:	48 8b 06             	mov    (%rsi),%rax
+  803eb1:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  803eb5:	48 89 01             	mov    %rax,(%rcx)
+  803eb8:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  803ebc:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  803ec0:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  803ec4:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  803ecb:	00 00 00 
+    b.cnt = 0;
+  803ece:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  803ed5:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  803ed8:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  803edf:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  803ee6:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  803eed:	48 89 c6             	mov    %rax,%rsi
+  803ef0:	48 b8 a2 bd ff ff ff 	movabs $0xffffffffffffbda2,%rax
+  803ef7:	ff ff ff 
+  803efa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803efe:	48 89 c7             	mov    %rax,%rdi
+  803f01:	49 89 df             	mov    %rbx,%r15
+  803f04:	48 b8 64 c3 ff ff ff 	movabs $0xffffffffffffc364,%rax
+  803f0b:	ff ff ff 
+  803f0e:	48 01 d8             	add    %rbx,%rax
+  803f11:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  803f13:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  803f19:	48 98                	cltq
+  803f1b:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  803f22:	48 83 c2 08          	add    $0x8,%rdx
+  803f26:	48 89 c6             	mov    %rax,%rsi
+  803f29:	48 89 d7             	mov    %rdx,%rdi
+  803f2c:	49 89 df             	mov    %rbx,%r15
+  803f2f:	48 b8 df 83 ff ff ff 	movabs $0xffffffffffff83df,%rax
+  803f36:	ff ff ff 
+  803f39:	48 01 d8             	add    %rbx,%rax
+  803f3c:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  803f3e:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  803f44:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  803f4b:	5b                   	pop    %rbx
+  803f4c:	41 5f                	pop    %r15
+  803f4e:	5d                   	pop    %rbp
+  803f4f:	c3                   	ret
+
+0000000000803f50 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  803f50:	55                   	push   %rbp
+  803f51:	48 89 e5             	mov    %rsp,%rbp
+  803f54:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  803f5b:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 803f5b <cprintf+0xb>
+  803f62:	49 bb d5 40 00 00 00 	movabs $0x40d5,%r11
+  803f69:	00 00 00 
+  803f6c:	4d 01 da             	add    %r11,%r10
+  803f6f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  803f76:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  803f7d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  803f84:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  803f8b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  803f92:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  803f99:	84 c0                	test   %al,%al
+  803f9b:	74 20                	je     803fbd <cprintf+0x6d>
+  803f9d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  803fa1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  803fa5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  803fa9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  803fad:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  803fb1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  803fb5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  803fb9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  803fbd:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  803fc4:	00 00 00 
+  803fc7:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  803fce:	00 00 00 
+  803fd1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803fd5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  803fdc:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  803fe3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  803fea:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  803ff1:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  803ff8:	48 8b 06             	mov    (%rsi),%rax
+  803ffb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  803fff:	48 89 01             	mov    %rax,(%rcx)
+  804002:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804006:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80400a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80400e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  804015:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80401c:	48 89 d6             	mov    %rdx,%rsi
+  80401f:	48 89 c7             	mov    %rax,%rdi
+  804022:	48 b8 40 be ff ff ff 	movabs $0xffffffffffffbe40,%rax
+  804029:	ff ff ff 
+  80402c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804030:	ff d0                	call   *%rax
+  804032:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  804038:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80403e:	c9                   	leave
+  80403f:	c3                   	ret
+
+0000000000804040 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  804040:	55                   	push   %rbp
+  804041:	48 89 e5             	mov    %rsp,%rbp
+  804044:	53                   	push   %rbx
+  804045:	48 83 ec 38          	sub    $0x38,%rsp
+  804049:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804049 <printnum+0x9>
+  804050:	49 bb e7 3f 00 00 00 	movabs $0x3fe7,%r11
+  804057:	00 00 00 
+  80405a:	4c 01 db             	add    %r11,%rbx
+  80405d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804061:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804065:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804069:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80406c:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  804070:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  804074:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804077:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80407b:	72 58                	jb     8040d5 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80407d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  804080:	8d 78 ff             	lea    -0x1(%rax),%edi
+  804083:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  804086:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80408a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80408f:	48 f7 f6             	div    %rsi
+  804092:	49 89 c2             	mov    %rax,%r10
+  804095:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  804098:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80409b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80409f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040a3:	41 89 c9             	mov    %ecx,%r9d
+  8040a6:	41 89 f8             	mov    %edi,%r8d
+  8040a9:	89 d1                	mov    %edx,%ecx
+  8040ab:	4c 89 d2             	mov    %r10,%rdx
+  8040ae:	48 89 c7             	mov    %rax,%rdi
+  8040b1:	48 b8 10 c0 ff ff ff 	movabs $0xffffffffffffc010,%rax
+  8040b8:	ff ff ff 
+  8040bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040bf:	ff d0                	call   *%rax
+  8040c1:	eb 1c                	jmp    8040df <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8040c3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8040c7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8040ca:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8040ce:	48 89 d6             	mov    %rdx,%rsi
+  8040d1:	89 c7                	mov    %eax,%edi
+  8040d3:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8040d5:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8040d9:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8040dd:	7f e4                	jg     8040c3 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8040df:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8040e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040eb:	48 f7 f1             	div    %rcx
+  8040ee:	48 b8 e7 e0 ff ff ff 	movabs $0xffffffffffffe0e7,%rax
+  8040f5:	ff ff ff 
+  8040f8:	48 01 d8             	add    %rbx,%rax
+  8040fb:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8040ff:	0f be c0             	movsbl %al,%eax
+  804102:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804106:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80410a:	48 89 d6             	mov    %rdx,%rsi
+  80410d:	89 c7                	mov    %eax,%edi
+  80410f:	ff d1                	call   *%rcx
+}
+  804111:	90                   	nop
+  804112:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804116:	c9                   	leave
+  804117:	c3                   	ret
+
+0000000000804118 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  804118:	55                   	push   %rbp
+  804119:	48 89 e5             	mov    %rsp,%rbp
+  80411c:	48 83 ec 20          	sub    $0x20,%rsp
+  804120:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804120 <getuint+0x8>
+  804127:	49 bb 10 3f 00 00 00 	movabs $0x3f10,%r11
+  80412e:	00 00 00 
+  804131:	4c 01 d8             	add    %r11,%rax
+  804134:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804138:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80413b:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80413f:	7e 4f                	jle    804190 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  804141:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804145:	8b 00                	mov    (%rax),%eax
+  804147:	83 f8 2f             	cmp    $0x2f,%eax
+  80414a:	77 24                	ja     804170 <getuint+0x58>
+  80414c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804150:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804154:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804158:	8b 00                	mov    (%rax),%eax
+  80415a:	89 c0                	mov    %eax,%eax
+  80415c:	48 01 d0             	add    %rdx,%rax
+  80415f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804163:	8b 12                	mov    (%rdx),%edx
+  804165:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804168:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80416c:	89 0a                	mov    %ecx,(%rdx)
+  80416e:	eb 14                	jmp    804184 <getuint+0x6c>
+  804170:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804174:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804178:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80417c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804180:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804184:	48 8b 00             	mov    (%rax),%rax
+  804187:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80418b:	e9 9d 00 00 00       	jmp    80422d <getuint+0x115>
+	else if (lflag)
+  804190:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804194:	74 4c                	je     8041e2 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  804196:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80419a:	8b 00                	mov    (%rax),%eax
+  80419c:	83 f8 2f             	cmp    $0x2f,%eax
+  80419f:	77 24                	ja     8041c5 <getuint+0xad>
+  8041a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041a5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8041a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ad:	8b 00                	mov    (%rax),%eax
+  8041af:	89 c0                	mov    %eax,%eax
+  8041b1:	48 01 d0             	add    %rdx,%rax
+  8041b4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041b8:	8b 12                	mov    (%rdx),%edx
+  8041ba:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8041bd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041c1:	89 0a                	mov    %ecx,(%rdx)
+  8041c3:	eb 14                	jmp    8041d9 <getuint+0xc1>
+  8041c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041c9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8041cd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8041d1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041d5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8041d9:	48 8b 00             	mov    (%rax),%rax
+  8041dc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8041e0:	eb 4b                	jmp    80422d <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8041e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041e6:	8b 00                	mov    (%rax),%eax
+  8041e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8041eb:	77 24                	ja     804211 <getuint+0xf9>
+  8041ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041f1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8041f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041f9:	8b 00                	mov    (%rax),%eax
+  8041fb:	89 c0                	mov    %eax,%eax
+  8041fd:	48 01 d0             	add    %rdx,%rax
+  804200:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804204:	8b 12                	mov    (%rdx),%edx
+  804206:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  804209:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80420d:	89 0a                	mov    %ecx,(%rdx)
+  80420f:	eb 14                	jmp    804225 <getuint+0x10d>
+  804211:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804215:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804219:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80421d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804221:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804225:	8b 00                	mov    (%rax),%eax
+  804227:	89 c0                	mov    %eax,%eax
+  804229:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80422d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804231:	c9                   	leave
+  804232:	c3                   	ret
+
+0000000000804233 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  804233:	55                   	push   %rbp
+  804234:	48 89 e5             	mov    %rsp,%rbp
+  804237:	48 83 ec 20          	sub    $0x20,%rsp
+  80423b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80423b <printfloat+0x8>
+  804242:	49 bb f5 3d 00 00 00 	movabs $0x3df5,%r11
+  804249:	00 00 00 
+  80424c:	4c 01 d8             	add    %r11,%rax
+  80424f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804253:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804257:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80425b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80425f:	48 85 c0             	test   %rax,%rax
+  804262:	79 12                	jns    804276 <printfloat+0x43>
+		putch('-',putdat);
+  804264:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804268:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80426c:	48 89 c6             	mov    %rax,%rsi
+  80426f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  804274:	ff d2                	call   *%rdx
+	
+}
+  804276:	90                   	nop
+  804277:	c9                   	leave
+  804278:	c3                   	ret
+
+0000000000804279 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  804279:	55                   	push   %rbp
+  80427a:	48 89 e5             	mov    %rsp,%rbp
+  80427d:	48 83 ec 20          	sub    $0x20,%rsp
+  804281:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804281 <getint+0x8>
+  804288:	49 bb af 3d 00 00 00 	movabs $0x3daf,%r11
+  80428f:	00 00 00 
+  804292:	4c 01 d8             	add    %r11,%rax
+  804295:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804299:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80429c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8042a0:	7e 4f                	jle    8042f1 <getint+0x78>
+		x=va_arg(*ap, long long);
+  8042a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042a6:	8b 00                	mov    (%rax),%eax
+  8042a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8042ab:	77 24                	ja     8042d1 <getint+0x58>
+  8042ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042b1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8042b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042b9:	8b 00                	mov    (%rax),%eax
+  8042bb:	89 c0                	mov    %eax,%eax
+  8042bd:	48 01 d0             	add    %rdx,%rax
+  8042c0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042c4:	8b 12                	mov    (%rdx),%edx
+  8042c6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8042c9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042cd:	89 0a                	mov    %ecx,(%rdx)
+  8042cf:	eb 14                	jmp    8042e5 <getint+0x6c>
+  8042d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8042d9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8042dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042e1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8042e5:	48 8b 00             	mov    (%rax),%rax
+  8042e8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8042ec:	e9 9d 00 00 00       	jmp    80438e <getint+0x115>
+	else if (lflag)
+  8042f1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8042f5:	74 4c                	je     804343 <getint+0xca>
+		x=va_arg(*ap, long);
+  8042f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042fb:	8b 00                	mov    (%rax),%eax
+  8042fd:	83 f8 2f             	cmp    $0x2f,%eax
+  804300:	77 24                	ja     804326 <getint+0xad>
+  804302:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804306:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80430a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80430e:	8b 00                	mov    (%rax),%eax
+  804310:	89 c0                	mov    %eax,%eax
+  804312:	48 01 d0             	add    %rdx,%rax
+  804315:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804319:	8b 12                	mov    (%rdx),%edx
+  80431b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80431e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804322:	89 0a                	mov    %ecx,(%rdx)
+  804324:	eb 14                	jmp    80433a <getint+0xc1>
+  804326:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80432a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80432e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  804332:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804336:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80433a:	48 8b 00             	mov    (%rax),%rax
+  80433d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804341:	eb 4b                	jmp    80438e <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  804343:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804347:	8b 00                	mov    (%rax),%eax
+  804349:	83 f8 2f             	cmp    $0x2f,%eax
+  80434c:	77 24                	ja     804372 <getint+0xf9>
+  80434e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804352:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804356:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80435a:	8b 00                	mov    (%rax),%eax
+  80435c:	89 c0                	mov    %eax,%eax
+  80435e:	48 01 d0             	add    %rdx,%rax
+  804361:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804365:	8b 12                	mov    (%rdx),%edx
+  804367:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80436a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80436e:	89 0a                	mov    %ecx,(%rdx)
+  804370:	eb 14                	jmp    804386 <getint+0x10d>
+  804372:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804376:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80437a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80437e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804382:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  804386:	8b 00                	mov    (%rax),%eax
+  804388:	48 98                	cltq
+  80438a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80438e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804392:	c9                   	leave
+  804393:	c3                   	ret
+
+0000000000804394 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  804394:	55                   	push   %rbp
+  804395:	48 89 e5             	mov    %rsp,%rbp
+  804398:	41 57                	push   %r15
+  80439a:	41 55                	push   %r13
+  80439c:	41 54                	push   %r12
+  80439e:	53                   	push   %rbx
+  80439f:	48 83 ec 60          	sub    $0x60,%rsp
+  8043a3:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 8043a3 <vprintfmt+0xf>
+  8043aa:	49 bb 8d 3c 00 00 00 	movabs $0x3c8d,%r11
+  8043b1:	00 00 00 
+  8043b4:	4d 01 dc             	add    %r11,%r12
+  8043b7:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  8043bb:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  8043bf:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8043c3:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  8043c7:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  8043ce:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  8043d2:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  8043d6:	48 8b 06             	mov    (%rsi),%rax
+  8043d9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8043dd:	48 89 01             	mov    %rax,(%rcx)
+  8043e0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8043e4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8043e8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8043ec:	eb 17                	jmp    804405 <vprintfmt+0x71>
+			if (ch == '\0')
+  8043ee:	85 db                	test   %ebx,%ebx
+  8043f0:	0f 84 97 05 00 00    	je     80498d <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  8043f6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8043fa:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8043fe:	48 89 c6             	mov    %rax,%rsi
+  804401:	89 df                	mov    %ebx,%edi
+  804403:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804405:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804409:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80440d:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804411:	0f b6 00             	movzbl (%rax),%eax
+  804414:	0f b6 d8             	movzbl %al,%ebx
+  804417:	83 fb 25             	cmp    $0x25,%ebx
+  80441a:	75 d2                	jne    8043ee <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  80441c:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  804420:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  804427:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  80442e:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  804435:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  80443c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804440:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804444:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  804448:	0f b6 00             	movzbl (%rax),%eax
+  80444b:	0f b6 d8             	movzbl %al,%ebx
+  80444e:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  804451:	83 f8 55             	cmp    $0x55,%eax
+  804454:	0f 87 00 05 00 00    	ja     80495a <vprintfmt+0x5c6>
+  80445a:	89 c0                	mov    %eax,%eax
+  80445c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804463:	00 
+  804464:	48 8d 05 d5 1c 00 00 	lea    0x1cd5(%rip),%rax        # 806140 <.LC18+0xc>
+  80446b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  80446f:	48 8d 15 ca 1c 00 00 	lea    0x1cca(%rip),%rdx        # 806140 <.LC18+0xc>
+  804476:	48 01 d0             	add    %rdx,%rax
+  804479:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  80447b:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  80447f:	eb bb                	jmp    80443c <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  804481:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  804485:	eb b5                	jmp    80443c <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  804487:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  80448e:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804491:	89 d0                	mov    %edx,%eax
+  804493:	c1 e0 02             	shl    $0x2,%eax
+  804496:	01 d0                	add    %edx,%eax
+  804498:	01 c0                	add    %eax,%eax
+  80449a:	01 d8                	add    %ebx,%eax
+  80449c:	83 e8 30             	sub    $0x30,%eax
+  80449f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  8044a2:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8044a6:	0f b6 00             	movzbl (%rax),%eax
+  8044a9:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  8044ac:	83 fb 2f             	cmp    $0x2f,%ebx
+  8044af:	7e 60                	jle    804511 <vprintfmt+0x17d>
+  8044b1:	83 fb 39             	cmp    $0x39,%ebx
+  8044b4:	7f 5b                	jg     804511 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  8044b6:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  8044bb:	eb d1                	jmp    80448e <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8044bd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8044c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8044c3:	77 17                	ja     8044dc <vprintfmt+0x148>
+  8044c5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8044c9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8044cc:	89 d2                	mov    %edx,%edx
+  8044ce:	48 01 d0             	add    %rdx,%rax
+  8044d1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8044d4:	83 c2 08             	add    $0x8,%edx
+  8044d7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8044da:	eb 0c                	jmp    8044e8 <vprintfmt+0x154>
+  8044dc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8044e0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8044e4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8044e8:	8b 00                	mov    (%rax),%eax
+  8044ea:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  8044ed:	eb 23                	jmp    804512 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  8044ef:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8044f3:	0f 89 43 ff ff ff    	jns    80443c <vprintfmt+0xa8>
+				width = 0;
+  8044f9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  804500:	e9 37 ff ff ff       	jmp    80443c <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  804505:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  80450c:	e9 2b ff ff ff       	jmp    80443c <vprintfmt+0xa8>
+			goto process_precision;
+  804511:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  804512:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804516:	0f 89 20 ff ff ff    	jns    80443c <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  80451c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80451f:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  804522:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  804529:	e9 0e ff ff ff       	jmp    80443c <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  80452e:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  804532:	e9 05 ff ff ff       	jmp    80443c <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  804537:	83 fb 39             	cmp    $0x39,%ebx
+  80453a:	7f 0b                	jg     804547 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  80453c:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  80453f:	c1 e0 08             	shl    $0x8,%eax
+  804542:	01 45 bc             	add    %eax,-0x44(%rbp)
+  804545:	eb 21                	jmp    804568 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  804547:	83 fb 60             	cmp    $0x60,%ebx
+  80454a:	7e 10                	jle    80455c <vprintfmt+0x1c8>
+  80454c:	83 fb 66             	cmp    $0x66,%ebx
+  80454f:	7f 0b                	jg     80455c <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  804551:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  804554:	c1 e0 08             	shl    $0x8,%eax
+  804557:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80455a:	eb 0c                	jmp    804568 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  80455c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  804563:	e9 04 01 00 00       	jmp    80466c <vprintfmt+0x2d8>
+  804568:	e9 ff 00 00 00       	jmp    80466c <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  80456d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804570:	83 f8 2f             	cmp    $0x2f,%eax
+  804573:	77 17                	ja     80458c <vprintfmt+0x1f8>
+  804575:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804579:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80457c:	89 d2                	mov    %edx,%edx
+  80457e:	48 01 d0             	add    %rdx,%rax
+  804581:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804584:	83 c2 08             	add    $0x8,%edx
+  804587:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80458a:	eb 0c                	jmp    804598 <vprintfmt+0x204>
+  80458c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804590:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804594:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804598:	8b 00                	mov    (%rax),%eax
+  80459a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80459e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8045a2:	48 89 d6             	mov    %rdx,%rsi
+  8045a5:	89 c7                	mov    %eax,%edi
+  8045a7:	ff d1                	call   *%rcx
+			break;
+  8045a9:	e9 da 03 00 00       	jmp    804988 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  8045ae:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8045b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8045b4:	77 17                	ja     8045cd <vprintfmt+0x239>
+  8045b6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8045ba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8045bd:	89 d2                	mov    %edx,%edx
+  8045bf:	48 01 d0             	add    %rdx,%rax
+  8045c2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8045c5:	83 c2 08             	add    $0x8,%edx
+  8045c8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8045cb:	eb 0c                	jmp    8045d9 <vprintfmt+0x245>
+  8045cd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8045d1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8045d5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8045d9:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  8045db:	85 db                	test   %ebx,%ebx
+  8045dd:	79 02                	jns    8045e1 <vprintfmt+0x24d>
+				err = -err;
+  8045df:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8045e1:	83 fb 15             	cmp    $0x15,%ebx
+  8045e4:	7f 19                	jg     8045ff <vprintfmt+0x26b>
+  8045e6:	48 ba 90 01 00 00 00 	movabs $0x190,%rdx
+  8045ed:	00 00 00 
+  8045f0:	48 63 c3             	movslq %ebx,%rax
+  8045f3:	4c 01 e2             	add    %r12,%rdx
+  8045f6:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  8045fa:	4d 85 ed             	test   %r13,%r13
+  8045fd:	75 36                	jne    804635 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  8045ff:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804603:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804607:	89 d9                	mov    %ebx,%ecx
+  804609:	48 ba f8 e0 ff ff ff 	movabs $0xffffffffffffe0f8,%rdx
+  804610:	ff ff ff 
+  804613:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  804617:	48 89 c7             	mov    %rax,%rdi
+  80461a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80461f:	49 b8 6b c9 ff ff ff 	movabs $0xffffffffffffc96b,%r8
+  804626:	ff ff ff 
+  804629:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  80462d:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  804630:	e9 53 03 00 00       	jmp    804988 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  804635:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  804639:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80463d:	4c 89 e9             	mov    %r13,%rcx
+  804640:	48 ba 01 e1 ff ff ff 	movabs $0xffffffffffffe101,%rdx
+  804647:	ff ff ff 
+  80464a:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  80464e:	48 89 c7             	mov    %rax,%rdi
+  804651:	b8 00 00 00 00       	mov    $0x0,%eax
+  804656:	49 b8 6b c9 ff ff ff 	movabs $0xffffffffffffc96b,%r8
+  80465d:	ff ff ff 
+  804660:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  804664:	41 ff d0             	call   *%r8
+			break;
+  804667:	e9 1c 03 00 00       	jmp    804988 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  80466c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80466f:	83 f8 2f             	cmp    $0x2f,%eax
+  804672:	77 17                	ja     80468b <vprintfmt+0x2f7>
+  804674:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804678:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80467b:	89 d2                	mov    %edx,%edx
+  80467d:	48 01 d0             	add    %rdx,%rax
+  804680:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804683:	83 c2 08             	add    $0x8,%edx
+  804686:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  804689:	eb 0c                	jmp    804697 <vprintfmt+0x303>
+  80468b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80468f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804693:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804697:	4c 8b 28             	mov    (%rax),%r13
+  80469a:	4d 85 ed             	test   %r13,%r13
+  80469d:	75 0e                	jne    8046ad <vprintfmt+0x319>
+				p = "(null)";
+  80469f:	48 b8 04 e1 ff ff ff 	movabs $0xffffffffffffe104,%rax
+  8046a6:	ff ff ff 
+  8046a9:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  8046ad:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8046b1:	0f 8e 84 00 00 00    	jle    80473b <vprintfmt+0x3a7>
+  8046b7:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  8046bb:	74 7e                	je     80473b <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8046bd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8046c0:	48 98                	cltq
+  8046c2:	48 89 c6             	mov    %rax,%rsi
+  8046c5:	4c 89 ef             	mov    %r13,%rdi
+  8046c8:	4d 89 e7             	mov    %r12,%r15
+  8046cb:	48 b8 90 cc ff ff ff 	movabs $0xffffffffffffcc90,%rax
+  8046d2:	ff ff ff 
+  8046d5:	4c 01 e0             	add    %r12,%rax
+  8046d8:	ff d0                	call   *%rax
+  8046da:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  8046dd:	eb 17                	jmp    8046f6 <vprintfmt+0x362>
+					putch(padc, putdat);
+  8046df:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  8046e3:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8046e7:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8046eb:	48 89 d6             	mov    %rdx,%rsi
+  8046ee:	89 c7                	mov    %eax,%edi
+  8046f0:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8046f2:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8046f6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8046fa:	7f e3                	jg     8046df <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8046fc:	eb 3d                	jmp    80473b <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8046fe:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  804702:	74 1e                	je     804722 <vprintfmt+0x38e>
+  804704:	83 fb 1f             	cmp    $0x1f,%ebx
+  804707:	7e 05                	jle    80470e <vprintfmt+0x37a>
+  804709:	83 fb 7e             	cmp    $0x7e,%ebx
+  80470c:	7e 14                	jle    804722 <vprintfmt+0x38e>
+					putch('?', putdat);
+  80470e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804712:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804716:	48 89 c6             	mov    %rax,%rsi
+  804719:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80471e:	ff d2                	call   *%rdx
+  804720:	eb 15                	jmp    804737 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  804722:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804725:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  804728:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80472c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804730:	48 89 c6             	mov    %rax,%rsi
+  804733:	89 cf                	mov    %ecx,%edi
+  804735:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  804737:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80473b:	4c 89 e8             	mov    %r13,%rax
+  80473e:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  804742:	0f b6 00             	movzbl (%rax),%eax
+  804745:	0f be d8             	movsbl %al,%ebx
+  804748:	85 db                	test   %ebx,%ebx
+  80474a:	74 28                	je     804774 <vprintfmt+0x3e0>
+  80474c:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804750:	78 ac                	js     8046fe <vprintfmt+0x36a>
+  804752:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  804756:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80475a:	79 a2                	jns    8046fe <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  80475c:	eb 16                	jmp    804774 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  80475e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804762:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804766:	48 89 c6             	mov    %rax,%rsi
+  804769:	bf 20 00 00 00       	mov    $0x20,%edi
+  80476e:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  804770:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  804774:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  804778:	7f e4                	jg     80475e <vprintfmt+0x3ca>
+			break;
+  80477a:	e9 09 02 00 00       	jmp    804988 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80477f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804783:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804787:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80478b:	0f b6 00             	movzbl (%rax),%eax
+  80478e:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  804791:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  804792:	83 fb 2f             	cmp    $0x2f,%ebx
+  804795:	0f 8e ac fd ff ff    	jle    804547 <vprintfmt+0x1b3>
+  80479b:	e9 97 fd ff ff       	jmp    804537 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8047a0:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8047a4:	be 03 00 00 00       	mov    $0x3,%esi
+  8047a9:	48 89 c7             	mov    %rax,%rdi
+  8047ac:	48 b8 49 c2 ff ff ff 	movabs $0xffffffffffffc249,%rax
+  8047b3:	ff ff ff 
+  8047b6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8047ba:	ff d0                	call   *%rax
+  8047bc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8047c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047c4:	48 85 c0             	test   %rax,%rax
+  8047c7:	79 1d                	jns    8047e6 <vprintfmt+0x452>
+				putch('-', putdat);
+  8047c9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8047cd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8047d1:	48 89 c6             	mov    %rax,%rsi
+  8047d4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8047d9:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8047db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047df:	48 f7 d8             	neg    %rax
+  8047e2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8047e6:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8047ed:	e9 de 00 00 00       	jmp    8048d0 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8047f2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8047f6:	be 03 00 00 00       	mov    $0x3,%esi
+  8047fb:	48 89 c7             	mov    %rax,%rdi
+  8047fe:	48 b8 e8 c0 ff ff ff 	movabs $0xffffffffffffc0e8,%rax
+  804805:	ff ff ff 
+  804808:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80480c:	ff d0                	call   *%rax
+  80480e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  804812:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  804819:	e9 b2 00 00 00       	jmp    8048d0 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  80481e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804822:	be 03 00 00 00       	mov    $0x3,%esi
+  804827:	48 89 c7             	mov    %rax,%rdi
+  80482a:	48 b8 e8 c0 ff ff ff 	movabs $0xffffffffffffc0e8,%rax
+  804831:	ff ff ff 
+  804834:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804838:	ff d0                	call   *%rax
+  80483a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  80483e:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  804845:	e9 86 00 00 00       	jmp    8048d0 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80484a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80484e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804852:	48 89 c6             	mov    %rax,%rsi
+  804855:	bf 30 00 00 00       	mov    $0x30,%edi
+  80485a:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80485c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  804860:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804864:	48 89 c6             	mov    %rax,%rsi
+  804867:	bf 78 00 00 00       	mov    $0x78,%edi
+  80486c:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80486e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804871:	83 f8 2f             	cmp    $0x2f,%eax
+  804874:	77 17                	ja     80488d <vprintfmt+0x4f9>
+  804876:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80487a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80487d:	89 d2                	mov    %edx,%edx
+  80487f:	48 01 d0             	add    %rdx,%rax
+  804882:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  804885:	83 c2 08             	add    $0x8,%edx
+  804888:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80488b:	eb 0c                	jmp    804899 <vprintfmt+0x505>
+  80488d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804891:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804895:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804899:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80489c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8048a0:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8048a7:	eb 27                	jmp    8048d0 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8048a9:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8048ad:	be 03 00 00 00       	mov    $0x3,%esi
+  8048b2:	48 89 c7             	mov    %rax,%rdi
+  8048b5:	48 b8 e8 c0 ff ff ff 	movabs $0xffffffffffffc0e8,%rax
+  8048bc:	ff ff ff 
+  8048bf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8048c3:	ff d0                	call   *%rax
+  8048c5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8048c9:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8048d0:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8048d5:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8048d8:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8048db:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8048df:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8048e3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8048e7:	45 89 c1             	mov    %r8d,%r9d
+  8048ea:	41 89 f8             	mov    %edi,%r8d
+  8048ed:	48 89 c7             	mov    %rax,%rdi
+  8048f0:	48 b8 10 c0 ff ff ff 	movabs $0xffffffffffffc010,%rax
+  8048f7:	ff ff ff 
+  8048fa:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8048fe:	ff d0                	call   *%rax
+			break;
+  804900:	e9 83 00 00 00       	jmp    804988 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  804905:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  804909:	be 03 00 00 00       	mov    $0x3,%esi
+  80490e:	48 89 c7             	mov    %rax,%rdi
+  804911:	48 b8 e8 c0 ff ff ff 	movabs $0xffffffffffffc0e8,%rax
+  804918:	ff ff ff 
+  80491b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80491f:	ff d0                	call   *%rax
+  804921:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  804925:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804929:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80492d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804931:	48 89 ce             	mov    %rcx,%rsi
+  804934:	48 89 c7             	mov    %rax,%rdi
+  804937:	48 b8 03 c2 ff ff ff 	movabs $0xffffffffffffc203,%rax
+  80493e:	ff ff ff 
+  804941:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804945:	ff d0                	call   *%rax
+	
+			break;
+  804947:	eb 3f                	jmp    804988 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  804949:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80494d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804951:	48 89 c6             	mov    %rax,%rsi
+  804954:	89 df                	mov    %ebx,%edi
+  804956:	ff d2                	call   *%rdx
+			break;
+  804958:	eb 2e                	jmp    804988 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80495a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80495e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804962:	48 89 c6             	mov    %rax,%rsi
+  804965:	bf 25 00 00 00       	mov    $0x25,%edi
+  80496a:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80496c:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  804971:	eb 05                	jmp    804978 <vprintfmt+0x5e4>
+  804973:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  804978:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80497c:	48 83 e8 01          	sub    $0x1,%rax
+  804980:	0f b6 00             	movzbl (%rax),%eax
+  804983:	3c 25                	cmp    $0x25,%al
+  804985:	75 ec                	jne    804973 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  804987:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  804988:	e9 78 fa ff ff       	jmp    804405 <vprintfmt+0x71>
+				return;
+  80498d:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80498e:	48 83 c4 60          	add    $0x60,%rsp
+  804992:	5b                   	pop    %rbx
+  804993:	41 5c                	pop    %r12
+  804995:	41 5d                	pop    %r13
+  804997:	41 5f                	pop    %r15
+  804999:	5d                   	pop    %rbp
+  80499a:	c3                   	ret
+
+000000000080499b <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80499b:	55                   	push   %rbp
+  80499c:	48 89 e5             	mov    %rsp,%rbp
+  80499f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8049a6:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8049a6 <printfmt+0xb>
+  8049ad:	49 bb 8a 36 00 00 00 	movabs $0x368a,%r11
+  8049b4:	00 00 00 
+  8049b7:	4d 01 da             	add    %r11,%r10
+  8049ba:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8049c1:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8049c8:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8049cf:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8049d6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8049dd:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8049e4:	84 c0                	test   %al,%al
+  8049e6:	74 20                	je     804a08 <printfmt+0x6d>
+  8049e8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8049ec:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8049f0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8049f4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8049f8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8049fc:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804a00:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804a04:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  804a08:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  804a0f:	00 00 00 
+  804a12:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  804a19:	00 00 00 
+  804a1c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a20:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  804a27:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804a2e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  804a35:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  804a3c:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  804a43:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  804a4a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804a51:	48 89 c7             	mov    %rax,%rdi
+  804a54:	48 b8 64 c3 ff ff ff 	movabs $0xffffffffffffc364,%rax
+  804a5b:	ff ff ff 
+  804a5e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804a62:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  804a64:	90                   	nop
+  804a65:	c9                   	leave
+  804a66:	c3                   	ret
+
+0000000000804a67 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  804a67:	55                   	push   %rbp
+  804a68:	48 89 e5             	mov    %rsp,%rbp
+  804a6b:	48 83 ec 10          	sub    $0x10,%rsp
+  804a6f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a6f <sprintputch+0x8>
+  804a76:	49 bb c1 35 00 00 00 	movabs $0x35c1,%r11
+  804a7d:	00 00 00 
+  804a80:	4c 01 d8             	add    %r11,%rax
+  804a83:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804a86:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  804a8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a8e:	8b 40 10             	mov    0x10(%rax),%eax
+  804a91:	8d 50 01             	lea    0x1(%rax),%edx
+  804a94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a98:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  804a9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a9f:	48 8b 10             	mov    (%rax),%rdx
+  804aa2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804aa6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804aaa:	48 39 c2             	cmp    %rax,%rdx
+  804aad:	73 17                	jae    804ac6 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  804aaf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ab3:	48 8b 00             	mov    (%rax),%rax
+  804ab6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804aba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804abe:	48 89 0a             	mov    %rcx,(%rdx)
+  804ac1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804ac4:	88 10                	mov    %dl,(%rax)
+}
+  804ac6:	90                   	nop
+  804ac7:	c9                   	leave
+  804ac8:	c3                   	ret
+
+0000000000804ac9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  804ac9:	55                   	push   %rbp
+  804aca:	48 89 e5             	mov    %rsp,%rbp
+  804acd:	53                   	push   %rbx
+  804ace:	48 83 ec 58          	sub    $0x58,%rsp
+  804ad2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804ad2 <vsnprintf+0x9>
+  804ad9:	49 bb 5e 35 00 00 00 	movabs $0x355e,%r11
+  804ae0:	00 00 00 
+  804ae3:	4c 01 d8             	add    %r11,%rax
+  804ae6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804aea:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  804aed:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  804af1:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  804af5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804af9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  804afd:	48 8b 0e             	mov    (%rsi),%rcx
+  804b00:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  804b04:	48 89 0a             	mov    %rcx,(%rdx)
+  804b07:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  804b0b:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  804b0f:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  804b13:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804b17:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804b1b:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  804b1e:	48 63 d2             	movslq %edx,%rdx
+  804b21:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  804b25:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804b29:	48 01 ca             	add    %rcx,%rdx
+  804b2c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804b30:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  804b37:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804b3c:	74 06                	je     804b44 <vsnprintf+0x7b>
+  804b3e:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  804b42:	7f 07                	jg     804b4b <vsnprintf+0x82>
+		return -E_INVAL;
+  804b44:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804b49:	eb 34                	jmp    804b7f <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  804b4b:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  804b4f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  804b53:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  804b57:	48 bf 37 ca ff ff ff 	movabs $0xffffffffffffca37,%rdi
+  804b5e:	ff ff ff 
+  804b61:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  804b65:	49 b8 64 c3 ff ff ff 	movabs $0xffffffffffffc364,%r8
+  804b6c:	ff ff ff 
+  804b6f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  804b73:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  804b75:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b79:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  804b7c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  804b7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804b83:	c9                   	leave
+  804b84:	c3                   	ret
+
+0000000000804b85 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  804b85:	55                   	push   %rbp
+  804b86:	48 89 e5             	mov    %rsp,%rbp
+  804b89:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  804b90:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804b90 <snprintf+0xb>
+  804b97:	49 bb a0 34 00 00 00 	movabs $0x34a0,%r11
+  804b9e:	00 00 00 
+  804ba1:	4d 01 da             	add    %r11,%r10
+  804ba4:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  804bab:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  804bb1:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  804bb8:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804bbf:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804bc6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804bcd:	84 c0                	test   %al,%al
+  804bcf:	74 20                	je     804bf1 <snprintf+0x6c>
+  804bd1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804bd5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804bd9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804bdd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804be1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804be5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804be9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804bed:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  804bf1:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  804bf8:	00 00 00 
+  804bfb:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804c02:	00 00 00 
+  804c05:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804c09:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804c10:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804c17:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  804c1e:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  804c25:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  804c2c:	48 8b 06             	mov    (%rsi),%rax
+  804c2f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  804c33:	48 89 01             	mov    %rax,(%rcx)
+  804c36:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804c3a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  804c3e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  804c42:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  804c49:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  804c50:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  804c56:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c5d:	48 89 c7             	mov    %rax,%rdi
+  804c60:	48 b8 99 ca ff ff ff 	movabs $0xffffffffffffca99,%rax
+  804c67:	ff ff ff 
+  804c6a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804c6e:	ff d0                	call   *%rax
+  804c70:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  804c76:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804c7c:	c9                   	leave
+  804c7d:	c3                   	ret
+
+0000000000804c7e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  804c7e:	55                   	push   %rbp
+  804c7f:	48 89 e5             	mov    %rsp,%rbp
+  804c82:	48 83 ec 18          	sub    $0x18,%rsp
+  804c86:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c86 <strlen+0x8>
+  804c8d:	49 bb aa 33 00 00 00 	movabs $0x33aa,%r11
+  804c94:	00 00 00 
+  804c97:	4c 01 d8             	add    %r11,%rax
+  804c9a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  804c9e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804ca5:	eb 09                	jmp    804cb0 <strlen+0x32>
+		n++;
+  804ca7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  804cab:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804cb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cb4:	0f b6 00             	movzbl (%rax),%eax
+  804cb7:	84 c0                	test   %al,%al
+  804cb9:	75 ec                	jne    804ca7 <strlen+0x29>
+	return n;
+  804cbb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804cbe:	c9                   	leave
+  804cbf:	c3                   	ret
+
+0000000000804cc0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  804cc0:	55                   	push   %rbp
+  804cc1:	48 89 e5             	mov    %rsp,%rbp
+  804cc4:	48 83 ec 20          	sub    $0x20,%rsp
+  804cc8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804cc8 <strnlen+0x8>
+  804ccf:	49 bb 68 33 00 00 00 	movabs $0x3368,%r11
+  804cd6:	00 00 00 
+  804cd9:	4c 01 d8             	add    %r11,%rax
+  804cdc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ce0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804ce4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804ceb:	eb 0e                	jmp    804cfb <strnlen+0x3b>
+		n++;
+  804ced:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  804cf1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  804cf6:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  804cfb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804d00:	74 0b                	je     804d0d <strnlen+0x4d>
+  804d02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d06:	0f b6 00             	movzbl (%rax),%eax
+  804d09:	84 c0                	test   %al,%al
+  804d0b:	75 e0                	jne    804ced <strnlen+0x2d>
+	return n;
+  804d0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d10:	c9                   	leave
+  804d11:	c3                   	ret
+
+0000000000804d12 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  804d12:	55                   	push   %rbp
+  804d13:	48 89 e5             	mov    %rsp,%rbp
+  804d16:	48 83 ec 20          	sub    $0x20,%rsp
+  804d1a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d1a <strcpy+0x8>
+  804d21:	49 bb 16 33 00 00 00 	movabs $0x3316,%r11
+  804d28:	00 00 00 
+  804d2b:	4c 01 d8             	add    %r11,%rax
+  804d2e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d32:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  804d36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d3a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  804d3e:	90                   	nop
+  804d3f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804d43:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804d47:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804d4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d4f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804d53:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804d57:	0f b6 12             	movzbl (%rdx),%edx
+  804d5a:	88 10                	mov    %dl,(%rax)
+  804d5c:	0f b6 00             	movzbl (%rax),%eax
+  804d5f:	84 c0                	test   %al,%al
+  804d61:	75 dc                	jne    804d3f <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  804d63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804d67:	c9                   	leave
+  804d68:	c3                   	ret
+
+0000000000804d69 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  804d69:	55                   	push   %rbp
+  804d6a:	48 89 e5             	mov    %rsp,%rbp
+  804d6d:	53                   	push   %rbx
+  804d6e:	48 83 ec 20          	sub    $0x20,%rsp
+  804d72:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d72 <strcat+0x9>
+  804d79:	49 bb be 32 00 00 00 	movabs $0x32be,%r11
+  804d80:	00 00 00 
+  804d83:	4c 01 db             	add    %r11,%rbx
+  804d86:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  804d8a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  804d8e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d92:	48 89 c7             	mov    %rax,%rdi
+  804d95:	48 b8 4e cc ff ff ff 	movabs $0xffffffffffffcc4e,%rax
+  804d9c:	ff ff ff 
+  804d9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804da3:	ff d0                	call   *%rax
+  804da5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  804da8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804dab:	48 63 d0             	movslq %eax,%rdx
+  804dae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804db2:	48 01 c2             	add    %rax,%rdx
+  804db5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804db9:	48 89 c6             	mov    %rax,%rsi
+  804dbc:	48 89 d7             	mov    %rdx,%rdi
+  804dbf:	48 b8 e2 cc ff ff ff 	movabs $0xffffffffffffcce2,%rax
+  804dc6:	ff ff ff 
+  804dc9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804dcd:	ff d0                	call   *%rax
+	return dst;
+  804dcf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  804dd3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804dd7:	c9                   	leave
+  804dd8:	c3                   	ret
+
+0000000000804dd9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  804dd9:	55                   	push   %rbp
+  804dda:	48 89 e5             	mov    %rsp,%rbp
+  804ddd:	48 83 ec 28          	sub    $0x28,%rsp
+  804de1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804de1 <strncpy+0x8>
+  804de8:	49 bb 4f 32 00 00 00 	movabs $0x324f,%r11
+  804def:	00 00 00 
+  804df2:	4c 01 d8             	add    %r11,%rax
+  804df5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804df9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804dfd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  804e01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e05:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  804e09:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804e10:	00 
+  804e11:	eb 2a                	jmp    804e3d <strncpy+0x64>
+		*dst++ = *src;
+  804e13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e17:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804e1b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  804e1f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e23:	0f b6 12             	movzbl (%rdx),%edx
+  804e26:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  804e28:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e2c:	0f b6 00             	movzbl (%rax),%eax
+  804e2f:	84 c0                	test   %al,%al
+  804e31:	74 05                	je     804e38 <strncpy+0x5f>
+			src++;
+  804e33:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  804e38:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804e3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e41:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804e45:	72 cc                	jb     804e13 <strncpy+0x3a>
+	}
+	return ret;
+  804e47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  804e4b:	c9                   	leave
+  804e4c:	c3                   	ret
+
+0000000000804e4d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  804e4d:	55                   	push   %rbp
+  804e4e:	48 89 e5             	mov    %rsp,%rbp
+  804e51:	48 83 ec 28          	sub    $0x28,%rsp
+  804e55:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e55 <strlcpy+0x8>
+  804e5c:	49 bb db 31 00 00 00 	movabs $0x31db,%r11
+  804e63:	00 00 00 
+  804e66:	4c 01 d8             	add    %r11,%rax
+  804e69:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804e6d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804e71:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  804e75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e79:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  804e7d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804e82:	74 3d                	je     804ec1 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  804e84:	eb 1d                	jmp    804ea3 <strlcpy+0x56>
+			*dst++ = *src++;
+  804e86:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e8a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804e8e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804e92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e96:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804e9a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804e9e:	0f b6 12             	movzbl (%rdx),%edx
+  804ea1:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  804ea3:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  804ea8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804ead:	74 0b                	je     804eba <strlcpy+0x6d>
+  804eaf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804eb3:	0f b6 00             	movzbl (%rax),%eax
+  804eb6:	84 c0                	test   %al,%al
+  804eb8:	75 cc                	jne    804e86 <strlcpy+0x39>
+		*dst = '\0';
+  804eba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ebe:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  804ec1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec5:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  804ec9:	c9                   	leave
+  804eca:	c3                   	ret
+
+0000000000804ecb <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  804ecb:	55                   	push   %rbp
+  804ecc:	48 89 e5             	mov    %rsp,%rbp
+  804ecf:	48 83 ec 10          	sub    $0x10,%rsp
+  804ed3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804ed3 <strcmp+0x8>
+  804eda:	49 bb 5d 31 00 00 00 	movabs $0x315d,%r11
+  804ee1:	00 00 00 
+  804ee4:	4c 01 d8             	add    %r11,%rax
+  804ee7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804eeb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  804eef:	eb 0a                	jmp    804efb <strcmp+0x30>
+		p++, q++;
+  804ef1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804ef6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  804efb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eff:	0f b6 00             	movzbl (%rax),%eax
+  804f02:	84 c0                	test   %al,%al
+  804f04:	74 12                	je     804f18 <strcmp+0x4d>
+  804f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f0a:	0f b6 10             	movzbl (%rax),%edx
+  804f0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f11:	0f b6 00             	movzbl (%rax),%eax
+  804f14:	38 c2                	cmp    %al,%dl
+  804f16:	74 d9                	je     804ef1 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  804f18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f1c:	0f b6 00             	movzbl (%rax),%eax
+  804f1f:	0f b6 d0             	movzbl %al,%edx
+  804f22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f26:	0f b6 00             	movzbl (%rax),%eax
+  804f29:	0f b6 c0             	movzbl %al,%eax
+  804f2c:	29 c2                	sub    %eax,%edx
+  804f2e:	89 d0                	mov    %edx,%eax
+}
+  804f30:	c9                   	leave
+  804f31:	c3                   	ret
+
+0000000000804f32 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  804f32:	55                   	push   %rbp
+  804f33:	48 89 e5             	mov    %rsp,%rbp
+  804f36:	48 83 ec 18          	sub    $0x18,%rsp
+  804f3a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804f3a <strncmp+0x8>
+  804f41:	49 bb f6 30 00 00 00 	movabs $0x30f6,%r11
+  804f48:	00 00 00 
+  804f4b:	4c 01 d8             	add    %r11,%rax
+  804f4e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804f52:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804f56:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  804f5a:	eb 0f                	jmp    804f6b <strncmp+0x39>
+		n--, p++, q++;
+  804f5c:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  804f61:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804f66:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  804f6b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804f70:	74 1d                	je     804f8f <strncmp+0x5d>
+  804f72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f76:	0f b6 00             	movzbl (%rax),%eax
+  804f79:	84 c0                	test   %al,%al
+  804f7b:	74 12                	je     804f8f <strncmp+0x5d>
+  804f7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f81:	0f b6 10             	movzbl (%rax),%edx
+  804f84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f88:	0f b6 00             	movzbl (%rax),%eax
+  804f8b:	38 c2                	cmp    %al,%dl
+  804f8d:	74 cd                	je     804f5c <strncmp+0x2a>
+	if (n == 0)
+  804f8f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804f94:	75 07                	jne    804f9d <strncmp+0x6b>
+		return 0;
+  804f96:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f9b:	eb 16                	jmp    804fb3 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  804f9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fa1:	0f b6 00             	movzbl (%rax),%eax
+  804fa4:	0f b6 d0             	movzbl %al,%edx
+  804fa7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fab:	0f b6 00             	movzbl (%rax),%eax
+  804fae:	0f b6 c0             	movzbl %al,%eax
+  804fb1:	29 c2                	sub    %eax,%edx
+}
+  804fb3:	89 d0                	mov    %edx,%eax
+  804fb5:	c9                   	leave
+  804fb6:	c3                   	ret
+
+0000000000804fb7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  804fb7:	55                   	push   %rbp
+  804fb8:	48 89 e5             	mov    %rsp,%rbp
+  804fbb:	48 83 ec 10          	sub    $0x10,%rsp
+  804fbf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804fbf <strchr+0x8>
+  804fc6:	49 bb 71 30 00 00 00 	movabs $0x3071,%r11
+  804fcd:	00 00 00 
+  804fd0:	4c 01 d8             	add    %r11,%rax
+  804fd3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804fd7:	89 f0                	mov    %esi,%eax
+  804fd9:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  804fdc:	eb 17                	jmp    804ff5 <strchr+0x3e>
+		if (*s == c)
+  804fde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fe2:	0f b6 00             	movzbl (%rax),%eax
+  804fe5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  804fe8:	75 06                	jne    804ff0 <strchr+0x39>
+			return (char *) s;
+  804fea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fee:	eb 15                	jmp    805005 <strchr+0x4e>
+	for (; *s; s++)
+  804ff0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  804ff5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ff9:	0f b6 00             	movzbl (%rax),%eax
+  804ffc:	84 c0                	test   %al,%al
+  804ffe:	75 de                	jne    804fde <strchr+0x27>
+	return 0;
+  805000:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805005:	c9                   	leave
+  805006:	c3                   	ret
+
+0000000000805007 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  805007:	55                   	push   %rbp
+  805008:	48 89 e5             	mov    %rsp,%rbp
+  80500b:	48 83 ec 10          	sub    $0x10,%rsp
+  80500f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80500f <strfind+0x8>
+  805016:	49 bb 21 30 00 00 00 	movabs $0x3021,%r11
+  80501d:	00 00 00 
+  805020:	4c 01 d8             	add    %r11,%rax
+  805023:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805027:	89 f0                	mov    %esi,%eax
+  805029:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80502c:	eb 11                	jmp    80503f <strfind+0x38>
+		if (*s == c)
+  80502e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805032:	0f b6 00             	movzbl (%rax),%eax
+  805035:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  805038:	74 12                	je     80504c <strfind+0x45>
+	for (; *s; s++)
+  80503a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80503f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805043:	0f b6 00             	movzbl (%rax),%eax
+  805046:	84 c0                	test   %al,%al
+  805048:	75 e4                	jne    80502e <strfind+0x27>
+  80504a:	eb 01                	jmp    80504d <strfind+0x46>
+			break;
+  80504c:	90                   	nop
+	return (char *) s;
+  80504d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805051:	c9                   	leave
+  805052:	c3                   	ret
+
+0000000000805053 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  805053:	55                   	push   %rbp
+  805054:	48 89 e5             	mov    %rsp,%rbp
+  805057:	48 83 ec 18          	sub    $0x18,%rsp
+  80505b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80505b <memset+0x8>
+  805062:	49 bb d5 2f 00 00 00 	movabs $0x2fd5,%r11
+  805069:	00 00 00 
+  80506c:	4c 01 d8             	add    %r11,%rax
+  80506f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805073:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  805076:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80507a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80507f:	75 06                	jne    805087 <memset+0x34>
+		return v;
+  805081:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805085:	eb 69                	jmp    8050f0 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  805087:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80508b:	83 e0 03             	and    $0x3,%eax
+  80508e:	48 85 c0             	test   %rax,%rax
+  805091:	75 48                	jne    8050db <memset+0x88>
+  805093:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805097:	83 e0 03             	and    $0x3,%eax
+  80509a:	48 85 c0             	test   %rax,%rax
+  80509d:	75 3c                	jne    8050db <memset+0x88>
+		c &= 0xFF;
+  80509f:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8050a6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050a9:	c1 e0 18             	shl    $0x18,%eax
+  8050ac:	89 c2                	mov    %eax,%edx
+  8050ae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050b1:	c1 e0 10             	shl    $0x10,%eax
+  8050b4:	09 c2                	or     %eax,%edx
+  8050b6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050b9:	c1 e0 08             	shl    $0x8,%eax
+  8050bc:	09 d0                	or     %edx,%eax
+  8050be:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8050c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050c5:	48 c1 e8 02          	shr    $0x2,%rax
+  8050c9:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8050cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050d3:	48 89 d7             	mov    %rdx,%rdi
+  8050d6:	fc                   	cld
+  8050d7:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8050d9:	eb 11                	jmp    8050ec <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8050db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050df:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8050e2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8050e6:	48 89 d7             	mov    %rdx,%rdi
+  8050e9:	fc                   	cld
+  8050ea:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8050ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8050f0:	c9                   	leave
+  8050f1:	c3                   	ret
+
+00000000008050f2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8050f2:	55                   	push   %rbp
+  8050f3:	48 89 e5             	mov    %rsp,%rbp
+  8050f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8050fa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050fa <memmove+0x8>
+  805101:	49 bb 36 2f 00 00 00 	movabs $0x2f36,%r11
+  805108:	00 00 00 
+  80510b:	4c 01 d8             	add    %r11,%rax
+  80510e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805112:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805116:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80511a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80511e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  805122:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805126:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80512a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80512e:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805132:	0f 83 88 00 00 00    	jae    8051c0 <memmove+0xce>
+  805138:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80513c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805140:	48 01 d0             	add    %rdx,%rax
+  805143:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  805147:	73 77                	jae    8051c0 <memmove+0xce>
+		s += n;
+  805149:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80514d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  805151:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805155:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  805159:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80515d:	83 e0 03             	and    $0x3,%eax
+  805160:	48 85 c0             	test   %rax,%rax
+  805163:	75 3b                	jne    8051a0 <memmove+0xae>
+  805165:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805169:	83 e0 03             	and    $0x3,%eax
+  80516c:	48 85 c0             	test   %rax,%rax
+  80516f:	75 2f                	jne    8051a0 <memmove+0xae>
+  805171:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805175:	83 e0 03             	and    $0x3,%eax
+  805178:	48 85 c0             	test   %rax,%rax
+  80517b:	75 23                	jne    8051a0 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80517d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805181:	48 83 e8 04          	sub    $0x4,%rax
+  805185:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805189:	48 83 ea 04          	sub    $0x4,%rdx
+  80518d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805191:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  805195:	48 89 c7             	mov    %rax,%rdi
+  805198:	48 89 d6             	mov    %rdx,%rsi
+  80519b:	fd                   	std
+  80519c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80519e:	eb 1d                	jmp    8051bd <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8051a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051a4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8051a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051ac:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8051b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051b4:	48 89 d7             	mov    %rdx,%rdi
+  8051b7:	48 89 c1             	mov    %rax,%rcx
+  8051ba:	fd                   	std
+  8051bb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8051bd:	fc                   	cld
+  8051be:	eb 57                	jmp    805217 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8051c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051c4:	83 e0 03             	and    $0x3,%eax
+  8051c7:	48 85 c0             	test   %rax,%rax
+  8051ca:	75 36                	jne    805202 <memmove+0x110>
+  8051cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051d0:	83 e0 03             	and    $0x3,%eax
+  8051d3:	48 85 c0             	test   %rax,%rax
+  8051d6:	75 2a                	jne    805202 <memmove+0x110>
+  8051d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051dc:	83 e0 03             	and    $0x3,%eax
+  8051df:	48 85 c0             	test   %rax,%rax
+  8051e2:	75 1e                	jne    805202 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8051e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051e8:	48 c1 e8 02          	shr    $0x2,%rax
+  8051ec:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8051ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8051f7:	48 89 c7             	mov    %rax,%rdi
+  8051fa:	48 89 d6             	mov    %rdx,%rsi
+  8051fd:	fc                   	cld
+  8051fe:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  805200:	eb 15                	jmp    805217 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  805202:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805206:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80520a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80520e:	48 89 c7             	mov    %rax,%rdi
+  805211:	48 89 d6             	mov    %rdx,%rsi
+  805214:	fc                   	cld
+  805215:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  805217:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80521b:	c9                   	leave
+  80521c:	c3                   	ret
+
+000000000080521d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80521d:	55                   	push   %rbp
+  80521e:	48 89 e5             	mov    %rsp,%rbp
+  805221:	48 83 ec 18          	sub    $0x18,%rsp
+  805225:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805225 <memcpy+0x8>
+  80522c:	49 bb 0b 2e 00 00 00 	movabs $0x2e0b,%r11
+  805233:	00 00 00 
+  805236:	4c 01 d8             	add    %r11,%rax
+  805239:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80523d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805241:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  805245:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805249:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80524d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  805251:	48 89 cf             	mov    %rcx,%rdi
+  805254:	48 b9 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rcx
+  80525b:	ff ff ff 
+  80525e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805262:	ff d0                	call   *%rax
+}
+  805264:	c9                   	leave
+  805265:	c3                   	ret
+
+0000000000805266 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  805266:	55                   	push   %rbp
+  805267:	48 89 e5             	mov    %rsp,%rbp
+  80526a:	48 83 ec 28          	sub    $0x28,%rsp
+  80526e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80526e <memcmp+0x8>
+  805275:	49 bb c2 2d 00 00 00 	movabs $0x2dc2,%r11
+  80527c:	00 00 00 
+  80527f:	4c 01 d8             	add    %r11,%rax
+  805282:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805286:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80528a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80528e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805292:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  805296:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80529a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80529e:	eb 34                	jmp    8052d4 <memcmp+0x6e>
+		if (*s1 != *s2)
+  8052a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052a4:	0f b6 10             	movzbl (%rax),%edx
+  8052a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052ab:	0f b6 00             	movzbl (%rax),%eax
+  8052ae:	38 c2                	cmp    %al,%dl
+  8052b0:	74 18                	je     8052ca <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  8052b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052b6:	0f b6 00             	movzbl (%rax),%eax
+  8052b9:	0f b6 d0             	movzbl %al,%edx
+  8052bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052c0:	0f b6 00             	movzbl (%rax),%eax
+  8052c3:	0f b6 c0             	movzbl %al,%eax
+  8052c6:	29 c2                	sub    %eax,%edx
+  8052c8:	eb 20                	jmp    8052ea <memcmp+0x84>
+		s1++, s2++;
+  8052ca:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8052cf:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8052d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052d8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8052dc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8052e0:	48 85 c0             	test   %rax,%rax
+  8052e3:	75 bb                	jne    8052a0 <memcmp+0x3a>
+	}
+
+	return 0;
+  8052e5:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8052ea:	89 d0                	mov    %edx,%eax
+  8052ec:	c9                   	leave
+  8052ed:	c3                   	ret
+
+00000000008052ee <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8052ee:	55                   	push   %rbp
+  8052ef:	48 89 e5             	mov    %rsp,%rbp
+  8052f2:	48 83 ec 28          	sub    $0x28,%rsp
+  8052f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8052f6 <memfind+0x8>
+  8052fd:	49 bb 3a 2d 00 00 00 	movabs $0x2d3a,%r11
+  805304:	00 00 00 
+  805307:	4c 01 d8             	add    %r11,%rax
+  80530a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80530e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805311:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  805315:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805319:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80531d:	48 01 d0             	add    %rdx,%rax
+  805320:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  805324:	eb 13                	jmp    805339 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  805326:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80532a:	0f b6 00             	movzbl (%rax),%eax
+  80532d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805330:	38 d0                	cmp    %dl,%al
+  805332:	74 11                	je     805345 <memfind+0x57>
+	for (; s < ends; s++)
+  805334:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805339:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80533d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805341:	72 e3                	jb     805326 <memfind+0x38>
+  805343:	eb 01                	jmp    805346 <memfind+0x58>
+			break;
+  805345:	90                   	nop
+	return (void *) s;
+  805346:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80534a:	c9                   	leave
+  80534b:	c3                   	ret
+
+000000000080534c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80534c:	55                   	push   %rbp
+  80534d:	48 89 e5             	mov    %rsp,%rbp
+  805350:	48 83 ec 38          	sub    $0x38,%rsp
+  805354:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805354 <strtol+0x8>
+  80535b:	49 bb dc 2c 00 00 00 	movabs $0x2cdc,%r11
+  805362:	00 00 00 
+  805365:	4c 01 d8             	add    %r11,%rax
+  805368:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80536c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805370:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  805373:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80537a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805381:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  805382:	eb 05                	jmp    805389 <strtol+0x3d>
+		s++;
+  805384:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  805389:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80538d:	0f b6 00             	movzbl (%rax),%eax
+  805390:	3c 20                	cmp    $0x20,%al
+  805392:	74 f0                	je     805384 <strtol+0x38>
+  805394:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805398:	0f b6 00             	movzbl (%rax),%eax
+  80539b:	3c 09                	cmp    $0x9,%al
+  80539d:	74 e5                	je     805384 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  80539f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053a3:	0f b6 00             	movzbl (%rax),%eax
+  8053a6:	3c 2b                	cmp    $0x2b,%al
+  8053a8:	75 07                	jne    8053b1 <strtol+0x65>
+		s++;
+  8053aa:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8053af:	eb 17                	jmp    8053c8 <strtol+0x7c>
+	else if (*s == '-')
+  8053b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053b5:	0f b6 00             	movzbl (%rax),%eax
+  8053b8:	3c 2d                	cmp    $0x2d,%al
+  8053ba:	75 0c                	jne    8053c8 <strtol+0x7c>
+		s++, neg = 1;
+  8053bc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8053c1:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8053c8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8053cc:	74 06                	je     8053d4 <strtol+0x88>
+  8053ce:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8053d2:	75 28                	jne    8053fc <strtol+0xb0>
+  8053d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053d8:	0f b6 00             	movzbl (%rax),%eax
+  8053db:	3c 30                	cmp    $0x30,%al
+  8053dd:	75 1d                	jne    8053fc <strtol+0xb0>
+  8053df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053e3:	48 83 c0 01          	add    $0x1,%rax
+  8053e7:	0f b6 00             	movzbl (%rax),%eax
+  8053ea:	3c 78                	cmp    $0x78,%al
+  8053ec:	75 0e                	jne    8053fc <strtol+0xb0>
+		s += 2, base = 16;
+  8053ee:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8053f3:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8053fa:	eb 2c                	jmp    805428 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  8053fc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  805400:	75 19                	jne    80541b <strtol+0xcf>
+  805402:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805406:	0f b6 00             	movzbl (%rax),%eax
+  805409:	3c 30                	cmp    $0x30,%al
+  80540b:	75 0e                	jne    80541b <strtol+0xcf>
+		s++, base = 8;
+  80540d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  805412:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  805419:	eb 0d                	jmp    805428 <strtol+0xdc>
+	else if (base == 0)
+  80541b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80541f:	75 07                	jne    805428 <strtol+0xdc>
+		base = 10;
+  805421:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  805428:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80542c:	0f b6 00             	movzbl (%rax),%eax
+  80542f:	3c 2f                	cmp    $0x2f,%al
+  805431:	7e 1d                	jle    805450 <strtol+0x104>
+  805433:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805437:	0f b6 00             	movzbl (%rax),%eax
+  80543a:	3c 39                	cmp    $0x39,%al
+  80543c:	7f 12                	jg     805450 <strtol+0x104>
+			dig = *s - '0';
+  80543e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805442:	0f b6 00             	movzbl (%rax),%eax
+  805445:	0f be c0             	movsbl %al,%eax
+  805448:	83 e8 30             	sub    $0x30,%eax
+  80544b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80544e:	eb 4e                	jmp    80549e <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  805450:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805454:	0f b6 00             	movzbl (%rax),%eax
+  805457:	3c 60                	cmp    $0x60,%al
+  805459:	7e 1d                	jle    805478 <strtol+0x12c>
+  80545b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80545f:	0f b6 00             	movzbl (%rax),%eax
+  805462:	3c 7a                	cmp    $0x7a,%al
+  805464:	7f 12                	jg     805478 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  805466:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80546a:	0f b6 00             	movzbl (%rax),%eax
+  80546d:	0f be c0             	movsbl %al,%eax
+  805470:	83 e8 57             	sub    $0x57,%eax
+  805473:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805476:	eb 26                	jmp    80549e <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  805478:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80547c:	0f b6 00             	movzbl (%rax),%eax
+  80547f:	3c 40                	cmp    $0x40,%al
+  805481:	7e 47                	jle    8054ca <strtol+0x17e>
+  805483:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805487:	0f b6 00             	movzbl (%rax),%eax
+  80548a:	3c 5a                	cmp    $0x5a,%al
+  80548c:	7f 3c                	jg     8054ca <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  80548e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805492:	0f b6 00             	movzbl (%rax),%eax
+  805495:	0f be c0             	movsbl %al,%eax
+  805498:	83 e8 37             	sub    $0x37,%eax
+  80549b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80549e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054a1:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8054a4:	7d 23                	jge    8054c9 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  8054a6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8054ab:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8054ae:	48 98                	cltq
+  8054b0:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8054b5:	48 89 c2             	mov    %rax,%rdx
+  8054b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054bb:	48 98                	cltq
+  8054bd:	48 01 d0             	add    %rdx,%rax
+  8054c0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  8054c4:	e9 5f ff ff ff       	jmp    805428 <strtol+0xdc>
+			break;
+  8054c9:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8054ca:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8054cf:	74 0b                	je     8054dc <strtol+0x190>
+		*endptr = (char *) s;
+  8054d1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054d5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8054d9:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8054dc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8054e0:	74 09                	je     8054eb <strtol+0x19f>
+  8054e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054e6:	48 f7 d8             	neg    %rax
+  8054e9:	eb 04                	jmp    8054ef <strtol+0x1a3>
+  8054eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8054ef:	c9                   	leave
+  8054f0:	c3                   	ret
+
+00000000008054f1 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  8054f1:	55                   	push   %rbp
+  8054f2:	48 89 e5             	mov    %rsp,%rbp
+  8054f5:	53                   	push   %rbx
+  8054f6:	48 83 ec 30          	sub    $0x30,%rsp
+  8054fa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054fa <strstr+0x9>
+  805501:	49 bb 36 2b 00 00 00 	movabs $0x2b36,%r11
+  805508:	00 00 00 
+  80550b:	4c 01 db             	add    %r11,%rbx
+  80550e:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  805512:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  805516:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80551a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80551e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  805522:	0f b6 00             	movzbl (%rax),%eax
+  805525:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  805528:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  80552c:	75 06                	jne    805534 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  80552e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805532:	eb 73                	jmp    8055a7 <strstr+0xb6>
+
+	len = strlen(str);
+  805534:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805538:	48 89 c7             	mov    %rax,%rdi
+  80553b:	48 b8 4e cc ff ff ff 	movabs $0xffffffffffffcc4e,%rax
+  805542:	ff ff ff 
+  805545:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805549:	ff d0                	call   *%rax
+  80554b:	48 98                	cltq
+  80554d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  805551:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805555:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  805559:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80555d:	0f b6 00             	movzbl (%rax),%eax
+  805560:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  805563:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  805567:	75 07                	jne    805570 <strstr+0x7f>
+				return (char *) 0;
+  805569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80556e:	eb 37                	jmp    8055a7 <strstr+0xb6>
+		} while (sc != c);
+  805570:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  805574:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  805577:	75 d8                	jne    805551 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  805579:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80557d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  805581:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805585:	48 89 ce             	mov    %rcx,%rsi
+  805588:	48 89 c7             	mov    %rax,%rdi
+  80558b:	48 b8 02 cf ff ff ff 	movabs $0xffffffffffffcf02,%rax
+  805592:	ff ff ff 
+  805595:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805599:	ff d0                	call   *%rax
+  80559b:	85 c0                	test   %eax,%eax
+  80559d:	75 b2                	jne    805551 <strstr+0x60>
+
+	return (char *) (in - 1);
+  80559f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8055a3:	48 83 e8 01          	sub    $0x1,%rax
+}
+  8055a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055ab:	c9                   	leave
+  8055ac:	c3                   	ret
+
+00000000008055ad <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8055ad:	55                   	push   %rbp
+  8055ae:	48 89 e5             	mov    %rsp,%rbp
+  8055b1:	41 57                	push   %r15
+  8055b3:	53                   	push   %rbx
+  8055b4:	48 83 ec 30          	sub    $0x30,%rsp
+  8055b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055b8 <ipc_recv+0xb>
+  8055bf:	49 bb 78 2a 00 00 00 	movabs $0x2a78,%r11
+  8055c6:	00 00 00 
+  8055c9:	4c 01 db             	add    %r11,%rbx
+  8055cc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8055d0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8055d4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8055d8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8055dd:	75 0e                	jne    8055ed <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8055df:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8055e6:	00 00 00 
+  8055e9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8055ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8055f1:	48 89 c7             	mov    %rax,%rdi
+  8055f4:	49 89 df             	mov    %rbx,%r15
+  8055f7:	48 b8 c0 88 ff ff ff 	movabs $0xffffffffffff88c0,%rax
+  8055fe:	ff ff ff 
+  805601:	48 01 d8             	add    %rbx,%rax
+  805604:	ff d0                	call   *%rax
+  805606:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  805609:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80560e:	74 2a                	je     80563a <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805610:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805614:	75 19                	jne    80562f <ipc_recv+0x82>
+  805616:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80561d:	ff ff ff 
+  805620:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805624:	48 8b 00             	mov    (%rax),%rax
+  805627:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80562d:	eb 05                	jmp    805634 <ipc_recv+0x87>
+  80562f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805634:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805638:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80563a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80563f:	74 2a                	je     80566b <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805641:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805645:	75 19                	jne    805660 <ipc_recv+0xb3>
+  805647:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80564e:	ff ff ff 
+  805651:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805655:	48 8b 00             	mov    (%rax),%rax
+  805658:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80565e:	eb 05                	jmp    805665 <ipc_recv+0xb8>
+  805660:	b8 00 00 00 00       	mov    $0x0,%eax
+  805665:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805669:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80566b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80566f:	74 05                	je     805676 <ipc_recv+0xc9>
+		return res;
+  805671:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805674:	eb 17                	jmp    80568d <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805676:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80567d:	ff ff ff 
+  805680:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805684:	48 8b 00             	mov    (%rax),%rax
+  805687:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80568d:	48 83 c4 30          	add    $0x30,%rsp
+  805691:	5b                   	pop    %rbx
+  805692:	41 5f                	pop    %r15
+  805694:	5d                   	pop    %rbp
+  805695:	c3                   	ret
+
+0000000000805696 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805696:	55                   	push   %rbp
+  805697:	48 89 e5             	mov    %rsp,%rbp
+  80569a:	41 57                	push   %r15
+  80569c:	53                   	push   %rbx
+  80569d:	48 83 ec 20          	sub    $0x20,%rsp
+  8056a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056a1 <ipc_send+0xb>
+  8056a8:	49 bb 8f 29 00 00 00 	movabs $0x298f,%r11
+  8056af:	00 00 00 
+  8056b2:	4c 01 db             	add    %r11,%rbx
+  8056b5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8056b8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8056bb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8056bf:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8056c2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8056c7:	75 0e                	jne    8056d7 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8056c9:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8056d0:	00 00 00 
+  8056d3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8056d7:	90                   	nop
+  8056d8:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8056db:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8056de:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8056e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056e5:	89 c7                	mov    %eax,%edi
+  8056e7:	49 89 df             	mov    %rbx,%r15
+  8056ea:	48 b8 56 88 ff ff ff 	movabs $0xffffffffffff8856,%rax
+  8056f1:	ff ff ff 
+  8056f4:	48 01 d8             	add    %rbx,%rax
+  8056f7:	ff d0                	call   *%rax
+  8056f9:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8056fc:	74 da                	je     8056d8 <ipc_send+0x42>
+		;
+}
+  8056fe:	90                   	nop
+  8056ff:	90                   	nop
+  805700:	48 83 c4 20          	add    $0x20,%rsp
+  805704:	5b                   	pop    %rbx
+  805705:	41 5f                	pop    %r15
+  805707:	5d                   	pop    %rbp
+  805708:	c3                   	ret
+
+0000000000805709 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805709:	55                   	push   %rbp
+  80570a:	48 89 e5             	mov    %rsp,%rbp
+  80570d:	41 57                	push   %r15
+  80570f:	53                   	push   %rbx
+  805710:	48 83 ec 40          	sub    $0x40,%rsp
+  805714:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805714 <ipc_call+0xb>
+  80571b:	49 bb 1c 29 00 00 00 	movabs $0x291c,%r11
+  805722:	00 00 00 
+  805725:	4c 01 db             	add    %r11,%rbx
+  805728:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80572b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80572e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805732:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805735:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805739:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80573d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805742:	75 0e                	jne    805752 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805744:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80574b:	00 00 00 
+  80574e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805752:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805757:	75 0e                	jne    805767 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805759:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805760:	00 00 00 
+  805763:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805767:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80576a:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80576e:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805771:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805775:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805778:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80577e:	49 89 f8             	mov    %rdi,%r8
+  805781:	89 c7                	mov    %eax,%edi
+  805783:	49 89 df             	mov    %rbx,%r15
+  805786:	48 b8 19 89 ff ff ff 	movabs $0xffffffffffff8919,%rax
+  80578d:	ff ff ff 
+  805790:	48 01 d8             	add    %rbx,%rax
+  805793:	ff d0                	call   *%rax
+  805795:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805798:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80579d:	74 2a                	je     8057c9 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80579f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057a3:	75 19                	jne    8057be <ipc_call+0xb5>
+  8057a5:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8057ac:	ff ff ff 
+  8057af:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8057b3:	48 8b 00             	mov    (%rax),%rax
+  8057b6:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8057bc:	eb 05                	jmp    8057c3 <ipc_call+0xba>
+  8057be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057c3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8057c7:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8057c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057cd:	74 05                	je     8057d4 <ipc_call+0xcb>
+		return r;
+  8057cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057d2:	eb 17                	jmp    8057eb <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8057d4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8057db:	ff ff ff 
+  8057de:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8057e2:	48 8b 00             	mov    (%rax),%rax
+  8057e5:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8057eb:	48 83 c4 40          	add    $0x40,%rsp
+  8057ef:	5b                   	pop    %rbx
+  8057f0:	41 5f                	pop    %r15
+  8057f2:	5d                   	pop    %rbp
+  8057f3:	c3                   	ret
+
+00000000008057f4 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8057f4:	55                   	push   %rbp
+  8057f5:	48 89 e5             	mov    %rsp,%rbp
+  8057f8:	41 57                	push   %r15
+  8057fa:	53                   	push   %rbx
+  8057fb:	48 83 ec 70          	sub    $0x70,%rsp
+  8057ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057ff <ipc_callw+0xb>
+  805806:	49 bb 31 28 00 00 00 	movabs $0x2831,%r11
+  80580d:	00 00 00 
+  805810:	4c 01 db             	add    %r11,%rbx
+  805813:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805816:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805819:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  80581d:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805821:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805826:	76 0a                	jbe    805832 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805828:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80582d:	e9 b7 00 00 00       	jmp    8058e9 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805832:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805836:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80583a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80583e:	48 89 ce             	mov    %rcx,%rsi
+  805841:	48 89 c7             	mov    %rax,%rdi
+  805844:	49 89 df             	mov    %rbx,%r15
+  805847:	48 b8 c2 d0 ff ff ff 	movabs $0xffffffffffffd0c2,%rax
+  80584e:	ff ff ff 
+  805851:	48 01 d8             	add    %rbx,%rax
+  805854:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805856:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80585d:	00 
+  80585e:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805862:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805866:	48 01 d0             	add    %rdx,%rax
+  805869:	48 83 e8 01          	sub    $0x1,%rax
+  80586d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805871:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805875:	ba 00 00 00 00       	mov    $0x0,%edx
+  80587a:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80587e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805882:	48 29 d0             	sub    %rdx,%rax
+  805885:	48 c1 e8 03          	shr    $0x3,%rax
+  805889:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  80588d:	89 c1                	mov    %eax,%ecx
+  80588f:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805892:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805896:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805899:	49 89 d1             	mov    %rdx,%r9
+  80589c:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8058a3:	00 00 00 
+  8058a6:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8058ad:	00 00 00 
+  8058b0:	89 c7                	mov    %eax,%edi
+  8058b2:	49 89 df             	mov    %rbx,%r15
+  8058b5:	48 b8 19 89 ff ff ff 	movabs $0xffffffffffff8919,%rax
+  8058bc:	ff ff ff 
+  8058bf:	48 01 d8             	add    %rbx,%rax
+  8058c2:	ff d0                	call   *%rax
+  8058c4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8058c7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8058cb:	74 05                	je     8058d2 <ipc_callw+0xde>
+		return r;
+  8058cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058d0:	eb 17                	jmp    8058e9 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8058d2:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8058d9:	ff ff ff 
+  8058dc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058e0:	48 8b 00             	mov    (%rax),%rax
+  8058e3:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8058e9:	48 83 c4 70          	add    $0x70,%rsp
+  8058ed:	5b                   	pop    %rbx
+  8058ee:	41 5f                	pop    %r15
+  8058f0:	5d                   	pop    %rbp
+  8058f1:	c3                   	ret
+
+00000000008058f2 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8058f2:	55                   	push   %rbp
+  8058f3:	48 89 e5             	mov    %rsp,%rbp
+  8058f6:	41 57                	push   %r15
+  8058f8:	53                   	push   %rbx
+  8058f9:	48 83 ec 40          	sub    $0x40,%rsp
+  8058fd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058fd <ipc_callv+0xb>
+  805904:	49 bb 33 27 00 00 00 	movabs $0x2733,%r11
+  80590b:	00 00 00 
+  80590e:	4c 01 db             	add    %r11,%rbx
+  805911:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805914:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805917:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80591b:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80591e:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805922:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805926:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80592d:	00 00 00 
+  805930:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805934:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805938:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80593c:	74 11                	je     80594f <ipc_callv+0x5d>
+		pg = (void *) segs;
+  80593e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805942:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805946:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805949:	c1 e0 14             	shl    $0x14,%eax
+  80594c:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  80594f:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805953:	74 14                	je     805969 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805955:	8b 45 20             	mov    0x20(%rbp),%eax
+  805958:	83 e8 01             	sub    $0x1,%eax
+  80595b:	48 63 d0             	movslq %eax,%rdx
+  80595e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805962:	48 09 d0             	or     %rdx,%rax
+  805965:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805969:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80596c:	c1 e0 10             	shl    $0x10,%eax
+  80596f:	0b 45 10             	or     0x10(%rbp),%eax
+  805972:	89 c1                	mov    %eax,%ecx
+  805974:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805977:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80597b:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80597f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805983:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805986:	4d 89 c1             	mov    %r8,%r9
+  805989:	49 89 f8             	mov    %rdi,%r8
+  80598c:	89 c7                	mov    %eax,%edi
+  80598e:	49 89 df             	mov    %rbx,%r15
+  805991:	48 b8 19 89 ff ff ff 	movabs $0xffffffffffff8919,%rax
+  805998:	ff ff ff 
+  80599b:	48 01 d8             	add    %rbx,%rax
+  80599e:	ff d0                	call   *%rax
+  8059a0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8059a3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8059a7:	74 05                	je     8059ae <ipc_callv+0xbc>
+		return r;
+  8059a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8059ac:	eb 17                	jmp    8059c5 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8059ae:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8059b5:	ff ff ff 
+  8059b8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059bc:	48 8b 00             	mov    (%rax),%rax
+  8059bf:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8059c5:	48 83 c4 40          	add    $0x40,%rsp
+  8059c9:	5b                   	pop    %rbx
+  8059ca:	41 5f                	pop    %r15
+  8059cc:	5d                   	pop    %rbp
+  8059cd:	c3                   	ret
+
+00000000008059ce <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8059ce:	55                   	push   %rbp
+  8059cf:	48 89 e5             	mov    %rsp,%rbp
+  8059d2:	41 57                	push   %r15
+  8059d4:	53                   	push   %rbx
+  8059d5:	48 83 ec 40          	sub    $0x40,%rsp
+  8059d9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059d9 <ipc_reply_recv+0xb>
+  8059e0:	49 bb 57 26 00 00 00 	movabs $0x2657,%r11
+  8059e7:	00 00 00 
+  8059ea:	4c 01 db             	add    %r11,%rbx
+  8059ed:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8059f0:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8059f3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8059f7:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8059fa:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8059fe:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805a02:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805a07:	75 0e                	jne    805a17 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805a09:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a10:	00 00 00 
+  805a13:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805a17:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805a1c:	75 0e                	jne    805a2c <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805a1e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805a25:	00 00 00 
+  805a28:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805a2c:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805a2f:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805a33:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805a37:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805a3a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805a3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a41:	4d 89 c1             	mov    %r8,%r9
+  805a44:	49 89 f8             	mov    %rdi,%r8
+  805a47:	89 c7                	mov    %eax,%edi
+  805a49:	49 89 df             	mov    %rbx,%r15
+  805a4c:	48 b8 8d 89 ff ff ff 	movabs $0xffffffffffff898d,%rax
+  805a53:	ff ff ff 
+  805a56:	48 01 d8             	add    %rbx,%rax
+  805a59:	ff d0                	call   *%rax
+  805a5b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805a5e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805a63:	74 2a                	je     805a8f <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805a65:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a69:	75 19                	jne    805a84 <ipc_reply_recv+0xb6>
+  805a6b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a72:	ff ff ff 
+  805a75:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a79:	48 8b 00             	mov    (%rax),%rax
+  805a7c:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805a82:	eb 05                	jmp    805a89 <ipc_reply_recv+0xbb>
+  805a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805a8d:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805a8f:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805a94:	74 2a                	je     805ac0 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805a96:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a9a:	75 19                	jne    805ab5 <ipc_reply_recv+0xe7>
+  805a9c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805aa3:	ff ff ff 
+  805aa6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805aaa:	48 8b 00             	mov    (%rax),%rax
+  805aad:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805ab3:	eb 05                	jmp    805aba <ipc_reply_recv+0xec>
+  805ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aba:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805abe:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805ac0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ac4:	74 05                	je     805acb <ipc_reply_recv+0xfd>
+		return r;
+  805ac6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ac9:	eb 17                	jmp    805ae2 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805acb:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ad2:	ff ff ff 
+  805ad5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ad9:	48 8b 00             	mov    (%rax),%rax
+  805adc:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805ae2:	48 83 c4 40          	add    $0x40,%rsp
+  805ae6:	5b                   	pop    %rbx
+  805ae7:	41 5f                	pop    %r15
+  805ae9:	5d                   	pop    %rbp
+  805aea:	c3                   	ret
+
+0000000000805aeb <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805aeb:	55                   	push   %rbp
+  805aec:	48 89 e5             	mov    %rsp,%rbp
+  805aef:	41 57                	push   %r15
+  805af1:	53                   	push   %rbx
+  805af2:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805af9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805af9 <ipc_window_batch+0xe>
+  805b00:	49 bb 37 25 00 00 00 	movabs $0x2537,%r11
+  805b07:	00 00 00 
+  805b0a:	4c 01 db             	add    %r11,%rbx
+  805b0d:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805b13:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805b1a:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805b20:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805b26:	e9 15 01 00 00       	jmp    805c40 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805b2b:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805b31:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805b34:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805b3b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b3e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805b41:	39 c2                	cmp    %eax,%edx
+  805b43:	0f 4e c2             	cmovle %edx,%eax
+  805b46:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805b49:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805b50:	eb 6b                	jmp    805bbd <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805b52:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b55:	48 98                	cltq
+  805b57:	48 c1 e0 05          	shl    $0x5,%rax
+  805b5b:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805b5f:	48 01 e8             	add    %rbp,%rax
+  805b62:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805b68:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805b6e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b71:	c1 e0 0c             	shl    $0xc,%eax
+  805b74:	48 63 d0             	movslq %eax,%rdx
+  805b77:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805b7e:	48 01 c2             	add    %rax,%rdx
+  805b81:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b84:	48 98                	cltq
+  805b86:	48 c1 e0 05          	shl    $0x5,%rax
+  805b8a:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805b8e:	48 01 e8             	add    %rbp,%rax
+  805b91:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805b97:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805b9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b9d:	48 98                	cltq
+  805b9f:	48 c1 e0 05          	shl    $0x5,%rax
+  805ba3:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805ba7:	48 01 e8             	add    %rbp,%rax
+  805baa:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805bb1:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805bb7:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805bb9:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805bbd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bc0:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805bc3:	7c 8d                	jl     805b52 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805bc5:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805bcc:	74 27                	je     805bf5 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805bce:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805bd1:	48 63 d0             	movslq %eax,%rdx
+  805bd4:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805bdb:	48 89 d6             	mov    %rdx,%rsi
+  805bde:	48 89 c7             	mov    %rax,%rdi
+  805be1:	49 89 df             	mov    %rbx,%r15
+  805be4:	48 b8 30 8c ff ff ff 	movabs $0xffffffffffff8c30,%rax
+  805beb:	ff ff ff 
+  805bee:	48 01 d8             	add    %rbx,%rax
+  805bf1:	ff d0                	call   *%rax
+  805bf3:	eb 25                	jmp    805c1a <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805bf5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805bf8:	48 63 d0             	movslq %eax,%rdx
+  805bfb:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805c02:	48 89 d6             	mov    %rdx,%rsi
+  805c05:	48 89 c7             	mov    %rax,%rdi
+  805c08:	49 89 df             	mov    %rbx,%r15
+  805c0b:	48 b8 8e 8c ff ff ff 	movabs $0xffffffffffff8c8e,%rax
+  805c12:	ff ff ff 
+  805c15:	48 01 d8             	add    %rbx,%rax
+  805c18:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805c1a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805c1d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805c21:	79 05                	jns    805c28 <ipc_window_batch+0x13d>
+			return r;
+  805c23:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c26:	eb 2a                	jmp    805c52 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805c28:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c2b:	c1 e0 0c             	shl    $0xc,%eax
+  805c2e:	48 98                	cltq
+  805c30:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805c37:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c3a:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805c40:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805c47:	0f 8f de fe ff ff    	jg     805b2b <ipc_window_batch+0x40>
+	}
+	return 0;
+  805c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c52:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805c59:	5b                   	pop    %rbx
+  805c5a:	41 5f                	pop    %r15
+  805c5c:	5d                   	pop    %rbp
+  805c5d:	c3                   	ret
+
+0000000000805c5e <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805c5e:	55                   	push   %rbp
+  805c5f:	48 89 e5             	mov    %rsp,%rbp
+  805c62:	48 83 ec 10          	sub    $0x10,%rsp
+  805c66:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805c66 <ipc_map_window+0x8>
+  805c6d:	49 bb ca 23 00 00 00 	movabs $0x23ca,%r11
+  805c74:	00 00 00 
+  805c77:	4c 01 d8             	add    %r11,%rax
+  805c7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805c7e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805c81:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805c84:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805c88:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805c8d:	bf 01 00 00 00       	mov    $0x1,%edi
+  805c92:	49 b8 bb da ff ff ff 	movabs $0xffffffffffffdabb,%r8
+  805c99:	ff ff ff 
+  805c9c:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805ca0:	ff d0                	call   *%rax
+}
+  805ca2:	c9                   	leave
+  805ca3:	c3                   	ret
+
+0000000000805ca4 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805ca4:	55                   	push   %rbp
+  805ca5:	48 89 e5             	mov    %rsp,%rbp
+  805ca8:	48 83 ec 10          	sub    $0x10,%rsp
+  805cac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805cac <ipc_unmap_window+0x8>
+  805cb3:	49 bb 84 23 00 00 00 	movabs $0x2384,%r11
+  805cba:	00 00 00 
+  805cbd:	4c 01 d8             	add    %r11,%rax
+  805cc0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805cc4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805cc7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805cca:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805cce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cd8:	49 b8 bb da ff ff ff 	movabs $0xffffffffffffdabb,%r8
+  805cdf:	ff ff ff 
+  805ce2:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805ce6:	ff d0                	call   *%rax
+}
+  805ce8:	c9                   	leave
+  805ce9:	c3                   	ret
+
+0000000000805cea <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805cea:	55                   	push   %rbp
+  805ceb:	48 89 e5             	mov    %rsp,%rbp
+  805cee:	48 83 ec 18          	sub    $0x18,%rsp
+  805cf2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805cf2 <ipc_find_env+0x8>
+  805cf9:	49 bb 3e 23 00 00 00 	movabs $0x233e,%r11
+  805d00:	00 00 00 
+  805d03:	4c 01 d8             	add    %r11,%rax
+  805d06:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805d09:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805d10:	eb 57                	jmp    805d69 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805d12:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805d19:	ff ff ff 
+  805d1c:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805d20:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805d23:	48 63 d2             	movslq %edx,%rdx
+  805d26:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805d2d:	48 01 ca             	add    %rcx,%rdx
+  805d30:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805d37:	8b 12                	mov    (%rdx),%edx
+  805d39:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805d3c:	75 27                	jne    805d65 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805d3e:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805d45:	ff ff ff 
+  805d48:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805d4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d4f:	48 98                	cltq
+  805d51:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  805d58:	48 01 d0             	add    %rdx,%rax
+  805d5b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805d61:	8b 00                	mov    (%rax),%eax
+  805d63:	eb 12                	jmp    805d77 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  805d65:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805d69:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805d70:	7e a0                	jle    805d12 <ipc_find_env+0x28>
+	}
+	return 0;
+  805d72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d77:	c9                   	leave
+  805d78:	c3                   	ret
+
+0000000000805d79 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  805d79:	55                   	push   %rbp
+  805d7a:	48 89 e5             	mov    %rsp,%rbp
+  805d7d:	48 83 ec 18          	sub    $0x18,%rsp
+  805d81:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d81 <pageref+0x8>
+  805d88:	49 bb af 22 00 00 00 	movabs $0x22af,%r11
+  805d8f:	00 00 00 
+  805d92:	4c 01 d8             	add    %r11,%rax
+  805d95:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  805d99:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805d9d:	48 89 d1             	mov    %rdx,%rcx
+  805da0:	48 c1 e9 15          	shr    $0x15,%rcx
+  805da4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  805dab:	ff ff ff 
+  805dae:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805db2:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805db6:	83 e2 01             	and    $0x1,%edx
+  805db9:	48 85 d2             	test   %rdx,%rdx
+  805dbc:	75 07                	jne    805dc5 <pageref+0x4c>
+		return 0;
+  805dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dc3:	eb 64                	jmp    805e29 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  805dc5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805dc9:	48 89 d1             	mov    %rdx,%rcx
+  805dcc:	48 c1 e9 0c          	shr    $0xc,%rcx
+  805dd0:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  805dd7:	ff ff ff 
+  805dda:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805dde:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  805de2:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  805de6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805dea:	83 e2 01             	and    $0x1,%edx
+  805ded:	48 85 d2             	test   %rdx,%rdx
+  805df0:	75 07                	jne    805df9 <pageref+0x80>
+		return 0;
+  805df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  805df7:	eb 30                	jmp    805e29 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  805df9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805dfd:	48 c1 ea 0c          	shr    $0xc,%rdx
+  805e01:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  805e08:	ff ff ff 
+  805e0b:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  805e0f:	48 89 d0             	mov    %rdx,%rax
+  805e12:	48 01 c0             	add    %rax,%rax
+  805e15:	48 01 d0             	add    %rdx,%rax
+  805e18:	48 c1 e0 03          	shl    $0x3,%rax
+  805e1c:	48 01 c8             	add    %rcx,%rax
+  805e1f:	48 83 c0 08          	add    $0x8,%rax
+  805e23:	0f b7 00             	movzwl (%rax),%eax
+  805e26:	0f b7 c0             	movzwl %ax,%eax
+}
+  805e29:	c9                   	leave
+  805e2a:	c3                   	ret
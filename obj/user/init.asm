@@ -0,0 +1,11189 @@
+
+obj/user/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 ee 08 00 00       	call   80092f <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <sum>:
+
+char bss[6000];
+
+int
+sum(const char *s, int n)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 20          	sub    $0x20,%rsp
+  80004b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80004b <sum+0x8>
+  800052:	49 bb 5d b7 00 00 00 	movabs $0xb75d,%r11
+  800059:	00 00 00 
+  80005c:	4c 01 d8             	add    %r11,%rax
+  80005f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800063:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	int i, tot = 0;
+  800066:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+	for (i = 0; i < n; i++)
+  80006d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800074:	eb 1e                	jmp    800094 <sum+0x51>
+		tot ^= i * s[i];
+  800076:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800079:	48 63 d0             	movslq %eax,%rdx
+  80007c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800080:	48 01 d0             	add    %rdx,%rax
+  800083:	0f b6 00             	movzbl (%rax),%eax
+  800086:	0f be c0             	movsbl %al,%eax
+  800089:	0f af 45 fc          	imul   -0x4(%rbp),%eax
+  80008d:	31 45 f8             	xor    %eax,-0x8(%rbp)
+	for (i = 0; i < n; i++)
+  800090:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800094:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800097:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80009a:	7c da                	jl     800076 <sum+0x33>
+	return tot;
+  80009c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80009f:	c9                   	leave
+  8000a0:	c3                   	ret
+
+00000000008000a1 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a1:	55                   	push   %rbp
+  8000a2:	48 89 e5             	mov    %rsp,%rbp
+  8000a5:	41 57                	push   %r15
+  8000a7:	53                   	push   %rbx
+  8000a8:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8000af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000af <umain+0xe>
+  8000b6:	49 bb f9 b6 00 00 00 	movabs $0xb6f9,%r11
+  8000bd:	00 00 00 
+  8000c0:	4c 01 db             	add    %r11,%rbx
+  8000c3:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  8000c9:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+	int i, r, x, want;
+	char args[256];
+
+	cprintf("init: running\n");
+  8000d0:	48 b8 48 be ff ff ff 	movabs $0xffffffffffffbe48,%rax
+  8000d7:	ff ff ff 
+  8000da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000de:	48 89 c7             	mov    %rax,%rdi
+  8000e1:	49 89 df             	mov    %rbx,%r15
+  8000e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e9:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  8000f0:	ff ff ff 
+  8000f3:	48 01 da             	add    %rbx,%rdx
+  8000f6:	ff d2                	call   *%rdx
+
+	want = 0xf989e;
+  8000f8:	c7 45 e8 9e 98 0f 00 	movl   $0xf989e,-0x18(%rbp)
+	if ((x = sum((char*)&data, sizeof data)) != want)
+  8000ff:	be 70 17 00 00       	mov    $0x1770,%esi
+  800104:	48 b8 58 e8 ff ff ff 	movabs $0xffffffffffffe858,%rax
+  80010b:	ff ff ff 
+  80010e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800112:	48 89 c7             	mov    %rax,%rdi
+  800115:	48 b8 9b 48 ff ff ff 	movabs $0xffffffffffff489b,%rax
+  80011c:	ff ff ff 
+  80011f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800123:	ff d0                	call   *%rax
+  800125:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800128:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80012b:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+  80012e:	74 32                	je     800162 <umain+0xc1>
+		cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  800130:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800133:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800136:	89 c6                	mov    %eax,%esi
+  800138:	48 b8 58 be ff ff ff 	movabs $0xffffffffffffbe58,%rax
+  80013f:	ff ff ff 
+  800142:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800146:	48 89 c7             	mov    %rax,%rdi
+  800149:	49 89 df             	mov    %rbx,%r15
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800151:	48 b9 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rcx
+  800158:	ff ff ff 
+  80015b:	48 01 d9             	add    %rbx,%rcx
+  80015e:	ff d1                	call   *%rcx
+  800160:	eb 28                	jmp    80018a <umain+0xe9>
+			x, want);
+	else
+		cprintf("init: data seems okay\n");
+  800162:	48 b8 91 be ff ff ff 	movabs $0xffffffffffffbe91,%rax
+  800169:	ff ff ff 
+  80016c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800170:	48 89 c7             	mov    %rax,%rdi
+  800173:	49 89 df             	mov    %rbx,%r15
+  800176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017b:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  800182:	ff ff ff 
+  800185:	48 01 da             	add    %rbx,%rdx
+  800188:	ff d2                	call   *%rdx
+	if ((x = sum(bss, sizeof bss)) != 0)
+  80018a:	be 70 17 00 00       	mov    $0x1770,%esi
+  80018f:	48 b8 78 18 01 00 00 	movabs $0x11878,%rax
+  800196:	00 00 00 
+  800199:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80019d:	48 89 c7             	mov    %rax,%rdi
+  8001a0:	48 b8 9b 48 ff ff ff 	movabs $0xffffffffffff489b,%rax
+  8001a7:	ff ff ff 
+  8001aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001ae:	ff d0                	call   *%rax
+  8001b0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8001b3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8001b7:	74 2f                	je     8001e8 <umain+0x147>
+		cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8001b9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8001bc:	89 c6                	mov    %eax,%esi
+  8001be:	48 b8 a8 be ff ff ff 	movabs $0xffffffffffffbea8,%rax
+  8001c5:	ff ff ff 
+  8001c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001cc:	48 89 c7             	mov    %rax,%rdi
+  8001cf:	49 89 df             	mov    %rbx,%r15
+  8001d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d7:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  8001de:	ff ff ff 
+  8001e1:	48 01 da             	add    %rbx,%rdx
+  8001e4:	ff d2                	call   *%rdx
+  8001e6:	eb 28                	jmp    800210 <umain+0x16f>
+	else
+		cprintf("init: bss seems okay\n");
+  8001e8:	48 b8 d7 be ff ff ff 	movabs $0xffffffffffffbed7,%rax
+  8001ef:	ff ff ff 
+  8001f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f6:	48 89 c7             	mov    %rax,%rdi
+  8001f9:	49 89 df             	mov    %rbx,%r15
+  8001fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800201:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  800208:	ff ff ff 
+  80020b:	48 01 da             	add    %rbx,%rdx
+  80020e:	ff d2                	call   *%rdx
+
+	// output in one syscall per line to avoid output interleaving 
+	strcat(args, "init: args:");
+  800210:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800217:	48 ba ed be ff ff ff 	movabs $0xffffffffffffbeed,%rdx
+  80021e:	ff ff ff 
+  800221:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800225:	48 89 d6             	mov    %rdx,%rsi
+  800228:	48 89 c7             	mov    %rax,%rdi
+  80022b:	49 89 df             	mov    %rbx,%r15
+  80022e:	48 b8 81 63 ff ff ff 	movabs $0xffffffffffff6381,%rax
+  800235:	ff ff ff 
+  800238:	48 01 d8             	add    %rbx,%rax
+  80023b:	ff d0                	call   *%rax
+	for (i = 0; i < argc; i++) {
+  80023d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800244:	e9 97 00 00 00       	jmp    8002e0 <umain+0x23f>
+		strcat(args, " '");
+  800249:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800250:	48 ba f9 be ff ff ff 	movabs $0xffffffffffffbef9,%rdx
+  800257:	ff ff ff 
+  80025a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80025e:	48 89 d6             	mov    %rdx,%rsi
+  800261:	48 89 c7             	mov    %rax,%rdi
+  800264:	49 89 df             	mov    %rbx,%r15
+  800267:	48 b8 81 63 ff ff ff 	movabs $0xffffffffffff6381,%rax
+  80026e:	ff ff ff 
+  800271:	48 01 d8             	add    %rbx,%rax
+  800274:	ff d0                	call   *%rax
+		strcat(args, argv[i]);
+  800276:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800279:	48 98                	cltq
+  80027b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800282:	00 
+  800283:	48 8b 85 d0 fe ff ff 	mov    -0x130(%rbp),%rax
+  80028a:	48 01 d0             	add    %rdx,%rax
+  80028d:	48 8b 10             	mov    (%rax),%rdx
+  800290:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800297:	48 89 d6             	mov    %rdx,%rsi
+  80029a:	48 89 c7             	mov    %rax,%rdi
+  80029d:	49 89 df             	mov    %rbx,%r15
+  8002a0:	48 b8 81 63 ff ff ff 	movabs $0xffffffffffff6381,%rax
+  8002a7:	ff ff ff 
+  8002aa:	48 01 d8             	add    %rbx,%rax
+  8002ad:	ff d0                	call   *%rax
+		strcat(args, "'");
+  8002af:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8002b6:	48 ba fc be ff ff ff 	movabs $0xffffffffffffbefc,%rdx
+  8002bd:	ff ff ff 
+  8002c0:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8002c4:	48 89 d6             	mov    %rdx,%rsi
+  8002c7:	48 89 c7             	mov    %rax,%rdi
+  8002ca:	49 89 df             	mov    %rbx,%r15
+  8002cd:	48 b8 81 63 ff ff ff 	movabs $0xffffffffffff6381,%rax
+  8002d4:	ff ff ff 
+  8002d7:	48 01 d8             	add    %rbx,%rax
+  8002da:	ff d0                	call   *%rax
+	for (i = 0; i < argc; i++) {
+  8002dc:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8002e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002e3:	3b 85 dc fe ff ff    	cmp    -0x124(%rbp),%eax
+  8002e9:	0f 8c 5a ff ff ff    	jl     800249 <umain+0x1a8>
+	}
+	cprintf("%s\n", args);
+  8002ef:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8002f6:	48 89 c6             	mov    %rax,%rsi
+  8002f9:	48 b8 fe be ff ff ff 	movabs $0xffffffffffffbefe,%rax
+  800300:	ff ff ff 
+  800303:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800307:	48 89 c7             	mov    %rax,%rdi
+  80030a:	49 89 df             	mov    %rbx,%r15
+  80030d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800312:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  800319:	ff ff ff 
+  80031c:	48 01 da             	add    %rbx,%rdx
+  80031f:	ff d2                	call   *%rdx
+
+	cprintf("init: running sh\n");
+  800321:	48 b8 02 bf ff ff ff 	movabs $0xffffffffffffbf02,%rax
+  800328:	ff ff ff 
+  80032b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80032f:	48 89 c7             	mov    %rax,%rdi
+  800332:	49 89 df             	mov    %rbx,%r15
+  800335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033a:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  800341:	ff ff ff 
+  800344:	48 01 da             	add    %rbx,%rdx
+  800347:	ff d2                	call   *%rdx
+
+	// being run directly from kernel, so no file descriptors open yet
+	close(0);
+  800349:	bf 00 00 00 00       	mov    $0x0,%edi
+  80034e:	49 89 df             	mov    %rbx,%r15
+  800351:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  800358:	ff ff ff 
+  80035b:	48 01 d8             	add    %rbx,%rax
+  80035e:	ff d0                	call   *%rax
+	if ((r = opencons()) < 0)
+  800360:	49 89 df             	mov    %rbx,%r15
+  800363:	48 b8 d3 4e ff ff ff 	movabs $0xffffffffffff4ed3,%rax
+  80036a:	ff ff ff 
+  80036d:	48 01 d8             	add    %rbx,%rax
+  800370:	ff d0                	call   *%rax
+  800372:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  800375:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800379:	79 44                	jns    8003bf <umain+0x31e>
+		panic("opencons: %e", r);
+  80037b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80037e:	89 c1                	mov    %eax,%ecx
+  800380:	48 b8 14 bf ff ff ff 	movabs $0xffffffffffffbf14,%rax
+  800387:	ff ff ff 
+  80038a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80038e:	48 89 c2             	mov    %rax,%rdx
+  800391:	be 37 00 00 00       	mov    $0x37,%esi
+  800396:	48 b8 21 bf ff ff ff 	movabs $0xffffffffffffbf21,%rax
+  80039d:	ff ff ff 
+  8003a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003a4:	48 89 c7             	mov    %rax,%rdi
+  8003a7:	49 89 df             	mov    %rbx,%r15
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  8003b6:	ff ff ff 
+  8003b9:	49 01 d8             	add    %rbx,%r8
+  8003bc:	41 ff d0             	call   *%r8
+	if (r != 0)
+  8003bf:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8003c3:	74 44                	je     800409 <umain+0x368>
+		panic("first opencons used fd %d", r);
+  8003c5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003c8:	89 c1                	mov    %eax,%ecx
+  8003ca:	48 b8 2d bf ff ff ff 	movabs $0xffffffffffffbf2d,%rax
+  8003d1:	ff ff ff 
+  8003d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003d8:	48 89 c2             	mov    %rax,%rdx
+  8003db:	be 39 00 00 00       	mov    $0x39,%esi
+  8003e0:	48 b8 21 bf ff ff ff 	movabs $0xffffffffffffbf21,%rax
+  8003e7:	ff ff ff 
+  8003ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003ee:	48 89 c7             	mov    %rax,%rdi
+  8003f1:	49 89 df             	mov    %rbx,%r15
+  8003f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f9:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  800400:	ff ff ff 
+  800403:	49 01 d8             	add    %rbx,%r8
+  800406:	41 ff d0             	call   *%r8
+	if ((r = dup(0, 1)) < 0)
+  800409:	be 01 00 00 00       	mov    $0x1,%esi
+  80040e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800413:	49 89 df             	mov    %rbx,%r15
+  800416:	48 b8 07 7c ff ff ff 	movabs $0xffffffffffff7c07,%rax
+  80041d:	ff ff ff 
+  800420:	48 01 d8             	add    %rbx,%rax
+  800423:	ff d0                	call   *%rax
+  800425:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  800428:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80042c:	79 44                	jns    800472 <umain+0x3d1>
+		panic("dup: %e", r);
+  80042e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800431:	89 c1                	mov    %eax,%ecx
+  800433:	48 b8 47 bf ff ff ff 	movabs $0xffffffffffffbf47,%rax
+  80043a:	ff ff ff 
+  80043d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800441:	48 89 c2             	mov    %rax,%rdx
+  800444:	be 3b 00 00 00       	mov    $0x3b,%esi
+  800449:	48 b8 21 bf ff ff ff 	movabs $0xffffffffffffbf21,%rax
+  800450:	ff ff ff 
+  800453:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800457:	48 89 c7             	mov    %rax,%rdi
+  80045a:	49 89 df             	mov    %rbx,%r15
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  800469:	ff ff ff 
+  80046c:	49 01 d8             	add    %rbx,%r8
+  80046f:	41 ff d0             	call   *%r8
+	while (1) {
+		cprintf("init: starting sh\n");
+  800472:	48 b8 4f bf ff ff ff 	movabs $0xffffffffffffbf4f,%rax
+  800479:	ff ff ff 
+  80047c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800480:	48 89 c7             	mov    %rax,%rdi
+  800483:	49 89 df             	mov    %rbx,%r15
+  800486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048b:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  800492:	ff ff ff 
+  800495:	48 01 da             	add    %rbx,%rdx
+  800498:	ff d2                	call   *%rdx
+		r = spawnl("/bin/sh", "sh", (char*)0);
+  80049a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049f:	48 b8 62 bf ff ff ff 	movabs $0xffffffffffffbf62,%rax
+  8004a6:	ff ff ff 
+  8004a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004ad:	48 89 c6             	mov    %rax,%rsi
+  8004b0:	48 b8 65 bf ff ff ff 	movabs $0xffffffffffffbf65,%rax
+  8004b7:	ff ff ff 
+  8004ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004be:	48 89 c7             	mov    %rax,%rdi
+  8004c1:	49 89 df             	mov    %rbx,%r15
+  8004c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c9:	48 b9 51 93 ff ff ff 	movabs $0xffffffffffff9351,%rcx
+  8004d0:	ff ff ff 
+  8004d3:	48 01 d9             	add    %rbx,%rcx
+  8004d6:	ff d1                	call   *%rcx
+  8004d8:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (r < 0) {
+  8004db:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8004df:	79 2f                	jns    800510 <umain+0x46f>
+			cprintf("init: spawn sh: %e\n", r);
+  8004e1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8004e4:	89 c6                	mov    %eax,%esi
+  8004e6:	48 b8 6d bf ff ff ff 	movabs $0xffffffffffffbf6d,%rax
+  8004ed:	ff ff ff 
+  8004f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004f4:	48 89 c7             	mov    %rax,%rdi
+  8004f7:	49 89 df             	mov    %rbx,%r15
+  8004fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ff:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  800506:	ff ff ff 
+  800509:	48 01 da             	add    %rbx,%rdx
+  80050c:	ff d2                	call   *%rdx
+			continue;
+  80050e:	eb 3f                	jmp    80054f <umain+0x4ae>
+		}
+		cprintf("init waiting\n");
+  800510:	48 b8 81 bf ff ff ff 	movabs $0xffffffffffffbf81,%rax
+  800517:	ff ff ff 
+  80051a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80051e:	48 89 c7             	mov    %rax,%rdi
+  800521:	49 89 df             	mov    %rbx,%r15
+  800524:	b8 00 00 00 00       	mov    $0x0,%eax
+  800529:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  800530:	ff ff ff 
+  800533:	48 01 da             	add    %rbx,%rdx
+  800536:	ff d2                	call   *%rdx
+		wait(r);
+  800538:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80053b:	89 c7                	mov    %eax,%edi
+  80053d:	49 89 df             	mov    %rbx,%r15
+  800540:	48 b8 ef b4 ff ff ff 	movabs $0xffffffffffffb4ef,%rax
+  800547:	ff ff ff 
+  80054a:	48 01 d8             	add    %rbx,%rax
+  80054d:	ff d0                	call   *%rax
+		cprintf("init: starting sh\n");
+  80054f:	e9 1e ff ff ff       	jmp    800472 <umain+0x3d1>
+
+0000000000800554 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  800554:	55                   	push   %rbp
+  800555:	48 89 e5             	mov    %rsp,%rbp
+  800558:	41 57                	push   %r15
+  80055a:	48 83 ec 28          	sub    $0x28,%rsp
+  80055e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80055e <cputchar+0xa>
+  800565:	49 bb 4a b2 00 00 00 	movabs $0xb24a,%r11
+  80056c:	00 00 00 
+  80056f:	4c 01 d8             	add    %r11,%rax
+  800572:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  800575:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  800578:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  80057b:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  80057f:	be 01 00 00 00       	mov    $0x1,%esi
+  800584:	48 89 d7             	mov    %rdx,%rdi
+  800587:	49 89 c7             	mov    %rax,%r15
+  80058a:	48 ba 2e 6e ff ff ff 	movabs $0xffffffffffff6e2e,%rdx
+  800591:	ff ff ff 
+  800594:	48 01 c2             	add    %rax,%rdx
+  800597:	ff d2                	call   *%rdx
+}
+  800599:	90                   	nop
+  80059a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80059e:	c9                   	leave
+  80059f:	c3                   	ret
+
+00000000008005a0 <getchar>:
+
+int
+getchar(void)
+{
+  8005a0:	55                   	push   %rbp
+  8005a1:	48 89 e5             	mov    %rsp,%rbp
+  8005a4:	41 57                	push   %r15
+  8005a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8005aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005aa <getchar+0xa>
+  8005b1:	49 bb fe b1 00 00 00 	movabs $0xb1fe,%r11
+  8005b8:	00 00 00 
+  8005bb:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8005be:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8005c2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8005c7:	48 89 ce             	mov    %rcx,%rsi
+  8005ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005cf:	49 89 c7             	mov    %rax,%r15
+  8005d2:	48 b9 06 7e ff ff ff 	movabs $0xffffffffffff7e06,%rcx
+  8005d9:	ff ff ff 
+  8005dc:	48 01 c1             	add    %rax,%rcx
+  8005df:	ff d1                	call   *%rcx
+  8005e1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8005e4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8005e8:	79 05                	jns    8005ef <getchar+0x4f>
+		return r;
+  8005ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8005ed:	eb 14                	jmp    800603 <getchar+0x63>
+	if (r < 1)
+  8005ef:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8005f3:	7f 07                	jg     8005fc <getchar+0x5c>
+		return -E_EOF;
+  8005f5:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8005fa:	eb 07                	jmp    800603 <getchar+0x63>
+	return c;
+  8005fc:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  800600:	0f b6 c0             	movzbl %al,%eax
+}
+  800603:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800607:	c9                   	leave
+  800608:	c3                   	ret
+
+0000000000800609 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  800609:	55                   	push   %rbp
+  80060a:	48 89 e5             	mov    %rsp,%rbp
+  80060d:	41 57                	push   %r15
+  80060f:	53                   	push   %rbx
+  800610:	48 83 ec 20          	sub    $0x20,%rsp
+  800614:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800614 <iscons+0xb>
+  80061b:	49 bb 94 b1 00 00 00 	movabs $0xb194,%r11
+  800622:	00 00 00 
+  800625:	4c 01 db             	add    %r11,%rbx
+  800628:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80062b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80062f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800632:	48 89 d6             	mov    %rdx,%rsi
+  800635:	89 c7                	mov    %eax,%edi
+  800637:	49 89 df             	mov    %rbx,%r15
+  80063a:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  800641:	ff ff ff 
+  800644:	48 01 d8             	add    %rbx,%rax
+  800647:	ff d0                	call   *%rax
+  800649:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80064c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800650:	79 05                	jns    800657 <iscons+0x4e>
+		return r;
+  800652:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800655:	eb 1b                	jmp    800672 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  800657:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80065b:	8b 10                	mov    (%rax),%edx
+  80065d:	48 b8 18 00 00 00 00 	movabs $0x18,%rax
+  800664:	00 00 00 
+  800667:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80066a:	39 c2                	cmp    %eax,%edx
+  80066c:	0f 94 c0             	sete   %al
+  80066f:	0f b6 c0             	movzbl %al,%eax
+}
+  800672:	48 83 c4 20          	add    $0x20,%rsp
+  800676:	5b                   	pop    %rbx
+  800677:	41 5f                	pop    %r15
+  800679:	5d                   	pop    %rbp
+  80067a:	c3                   	ret
+
+000000000080067b <opencons>:
+
+int
+opencons(void)
+{
+  80067b:	55                   	push   %rbp
+  80067c:	48 89 e5             	mov    %rsp,%rbp
+  80067f:	41 57                	push   %r15
+  800681:	53                   	push   %rbx
+  800682:	48 83 ec 10          	sub    $0x10,%rsp
+  800686:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800686 <opencons+0xb>
+  80068d:	49 bb 22 b1 00 00 00 	movabs $0xb122,%r11
+  800694:	00 00 00 
+  800697:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  80069a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80069e:	48 89 c7             	mov    %rax,%rdi
+  8006a1:	49 89 df             	mov    %rbx,%r15
+  8006a4:	48 b8 09 78 ff ff ff 	movabs $0xffffffffffff7809,%rax
+  8006ab:	ff ff ff 
+  8006ae:	48 01 d8             	add    %rbx,%rax
+  8006b1:	ff d0                	call   *%rax
+  8006b3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8006b6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8006ba:	79 05                	jns    8006c1 <opencons+0x46>
+		return r;
+  8006bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8006bf:	eb 68                	jmp    800729 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8006c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8006c5:	ba 07 04 00 00       	mov    $0x407,%edx
+  8006ca:	48 89 c6             	mov    %rax,%rsi
+  8006cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006d2:	49 89 df             	mov    %rbx,%r15
+  8006d5:	48 b8 e6 6f ff ff ff 	movabs $0xffffffffffff6fe6,%rax
+  8006dc:	ff ff ff 
+  8006df:	48 01 d8             	add    %rbx,%rax
+  8006e2:	ff d0                	call   *%rax
+  8006e4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8006e7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8006eb:	79 05                	jns    8006f2 <opencons+0x77>
+		return r;
+  8006ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8006f0:	eb 37                	jmp    800729 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8006f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8006f6:	48 ba 18 00 00 00 00 	movabs $0x18,%rdx
+  8006fd:	00 00 00 
+  800700:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  800703:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  800705:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800709:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  800710:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800714:	48 89 c7             	mov    %rax,%rdi
+  800717:	49 89 df             	mov    %rbx,%r15
+  80071a:	48 b8 8f 77 ff ff ff 	movabs $0xffffffffffff778f,%rax
+  800721:	ff ff ff 
+  800724:	48 01 d8             	add    %rbx,%rax
+  800727:	ff d0                	call   *%rax
+}
+  800729:	48 83 c4 10          	add    $0x10,%rsp
+  80072d:	5b                   	pop    %rbx
+  80072e:	41 5f                	pop    %r15
+  800730:	5d                   	pop    %rbp
+  800731:	c3                   	ret
+
+0000000000800732 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  800732:	55                   	push   %rbp
+  800733:	48 89 e5             	mov    %rsp,%rbp
+  800736:	41 57                	push   %r15
+  800738:	53                   	push   %rbx
+  800739:	48 83 ec 30          	sub    $0x30,%rsp
+  80073d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80073d <devcons_read+0xb>
+  800744:	49 bb 6b b0 00 00 00 	movabs $0xb06b,%r11
+  80074b:	00 00 00 
+  80074e:	4c 01 db             	add    %r11,%rbx
+  800751:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800755:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800759:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  80075d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800762:	75 19                	jne    80077d <devcons_read+0x4b>
+		return 0;
+  800764:	b8 00 00 00 00       	mov    $0x0,%eax
+  800769:	eb 55                	jmp    8007c0 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  80076b:	49 89 df             	mov    %rbx,%r15
+  80076e:	48 b8 91 6f ff ff ff 	movabs $0xffffffffffff6f91,%rax
+  800775:	ff ff ff 
+  800778:	48 01 d8             	add    %rbx,%rax
+  80077b:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  80077d:	49 89 df             	mov    %rbx,%r15
+  800780:	48 b8 8d 6e ff ff ff 	movabs $0xffffffffffff6e8d,%rax
+  800787:	ff ff ff 
+  80078a:	48 01 d8             	add    %rbx,%rax
+  80078d:	ff d0                	call   *%rax
+  80078f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800792:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800796:	74 d3                	je     80076b <devcons_read+0x39>
+	if (c < 0)
+  800798:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80079c:	79 05                	jns    8007a3 <devcons_read+0x71>
+		return c;
+  80079e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8007a1:	eb 1d                	jmp    8007c0 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8007a3:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8007a7:	75 07                	jne    8007b0 <devcons_read+0x7e>
+		return 0;
+  8007a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ae:	eb 10                	jmp    8007c0 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8007b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8007b3:	89 c2                	mov    %eax,%edx
+  8007b5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8007b9:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8007bb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8007c0:	48 83 c4 30          	add    $0x30,%rsp
+  8007c4:	5b                   	pop    %rbx
+  8007c5:	41 5f                	pop    %r15
+  8007c7:	5d                   	pop    %rbp
+  8007c8:	c3                   	ret
+
+00000000008007c9 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8007c9:	55                   	push   %rbp
+  8007ca:	48 89 e5             	mov    %rsp,%rbp
+  8007cd:	41 57                	push   %r15
+  8007cf:	53                   	push   %rbx
+  8007d0:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8007d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8007d7 <devcons_write+0xe>
+  8007de:	49 bb d1 af 00 00 00 	movabs $0xafd1,%r11
+  8007e5:	00 00 00 
+  8007e8:	4c 01 db             	add    %r11,%rbx
+  8007eb:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8007f2:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8007f9:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  800800:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800807:	e9 80 00 00 00       	jmp    80088c <devcons_write+0xc3>
+		m = n - tot;
+  80080c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800813:	89 c2                	mov    %eax,%edx
+  800815:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800818:	29 c2                	sub    %eax,%edx
+  80081a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  80081d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800820:	83 f8 7f             	cmp    $0x7f,%eax
+  800823:	76 07                	jbe    80082c <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  800825:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80082c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80082f:	48 63 d0             	movslq %eax,%rdx
+  800832:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800835:	48 63 c8             	movslq %eax,%rcx
+  800838:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80083f:	48 01 c1             	add    %rax,%rcx
+  800842:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  800849:	48 89 ce             	mov    %rcx,%rsi
+  80084c:	48 89 c7             	mov    %rax,%rdi
+  80084f:	49 89 df             	mov    %rbx,%r15
+  800852:	48 b8 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rax
+  800859:	ff ff ff 
+  80085c:	48 01 d8             	add    %rbx,%rax
+  80085f:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  800861:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800864:	48 63 d0             	movslq %eax,%rdx
+  800867:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80086e:	48 89 d6             	mov    %rdx,%rsi
+  800871:	48 89 c7             	mov    %rax,%rdi
+  800874:	49 89 df             	mov    %rbx,%r15
+  800877:	48 b8 2e 6e ff ff ff 	movabs $0xffffffffffff6e2e,%rax
+  80087e:	ff ff ff 
+  800881:	48 01 d8             	add    %rbx,%rax
+  800884:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  800886:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800889:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80088c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80088f:	48 98                	cltq
+  800891:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  800898:	0f 82 6e ff ff ff    	jb     80080c <devcons_write+0x43>
+	}
+	return tot;
+  80089e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8008a1:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8008a8:	5b                   	pop    %rbx
+  8008a9:	41 5f                	pop    %r15
+  8008ab:	5d                   	pop    %rbp
+  8008ac:	c3                   	ret
+
+00000000008008ad <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8008ad:	55                   	push   %rbp
+  8008ae:	48 89 e5             	mov    %rsp,%rbp
+  8008b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8008b5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008b5 <devcons_close+0x8>
+  8008bc:	49 bb f3 ae 00 00 00 	movabs $0xaef3,%r11
+  8008c3:	00 00 00 
+  8008c6:	4c 01 d8             	add    %r11,%rax
+  8008c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8008cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d2:	c9                   	leave
+  8008d3:	c3                   	ret
+
+00000000008008d4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8008d4:	55                   	push   %rbp
+  8008d5:	48 89 e5             	mov    %rsp,%rbp
+  8008d8:	41 57                	push   %r15
+  8008da:	48 83 ec 18          	sub    $0x18,%rsp
+  8008de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008de <devcons_stat+0xa>
+  8008e5:	49 bb ca ae 00 00 00 	movabs $0xaeca,%r11
+  8008ec:	00 00 00 
+  8008ef:	4c 01 d8             	add    %r11,%rax
+  8008f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008f6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8008fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008fe:	48 b9 94 bf ff ff ff 	movabs $0xffffffffffffbf94,%rcx
+  800905:	ff ff ff 
+  800908:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80090c:	48 89 ce             	mov    %rcx,%rsi
+  80090f:	48 89 d7             	mov    %rdx,%rdi
+  800912:	49 89 c7             	mov    %rax,%r15
+  800915:	48 ba 2a 63 ff ff ff 	movabs $0xffffffffffff632a,%rdx
+  80091c:	ff ff ff 
+  80091f:	48 01 c2             	add    %rax,%rdx
+  800922:	ff d2                	call   *%rdx
+	return 0;
+  800924:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800929:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80092d:	c9                   	leave
+  80092e:	c3                   	ret
+
+000000000080092f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80092f:	55                   	push   %rbp
+  800930:	48 89 e5             	mov    %rsp,%rbp
+  800933:	41 57                	push   %r15
+  800935:	53                   	push   %rbx
+  800936:	48 83 ec 20          	sub    $0x20,%rsp
+  80093a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80093a <libmain+0xb>
+  800941:	49 bb 6e ae 00 00 00 	movabs $0xae6e,%r11
+  800948:	00 00 00 
+  80094b:	4c 01 db             	add    %r11,%rbx
+  80094e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800951:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800955:	49 89 df             	mov    %rbx,%r15
+  800958:	48 b8 3d 6f ff ff ff 	movabs $0xffffffffffff6f3d,%rax
+  80095f:	ff ff ff 
+  800962:	48 01 d8             	add    %rbx,%rax
+  800965:	ff d0                	call   *%rax
+  800967:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  80096a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80096d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800972:	48 98                	cltq
+  800974:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80097b:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800982:	ff ff ff 
+  800985:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800989:	48 01 c2             	add    %rax,%rdx
+  80098c:	48 b8 e8 2f 01 00 00 	movabs $0x12fe8,%rax
+  800993:	00 00 00 
+  800996:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80099a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80099e:	7e 15                	jle    8009b5 <libmain+0x86>
+		binaryname = argv[0];
+  8009a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009a4:	48 8b 00             	mov    (%rax),%rax
+  8009a7:	48 ba 50 00 00 00 00 	movabs $0x50,%rdx
+  8009ae:	00 00 00 
+  8009b1:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8009b5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8009b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8009bc:	48 89 d6             	mov    %rdx,%rsi
+  8009bf:	89 c7                	mov    %eax,%edi
+  8009c1:	49 89 df             	mov    %rbx,%r15
+  8009c4:	48 b8 f9 48 ff ff ff 	movabs $0xffffffffffff48f9,%rax
+  8009cb:	ff ff ff 
+  8009ce:	48 01 d8             	add    %rbx,%rax
+  8009d1:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8009d3:	49 89 df             	mov    %rbx,%r15
+  8009d6:	48 b8 47 52 ff ff ff 	movabs $0xffffffffffff5247,%rax
+  8009dd:	ff ff ff 
+  8009e0:	48 01 d8             	add    %rbx,%rax
+  8009e3:	ff d0                	call   *%rax
+}
+  8009e5:	90                   	nop
+  8009e6:	48 83 c4 20          	add    $0x20,%rsp
+  8009ea:	5b                   	pop    %rbx
+  8009eb:	41 5f                	pop    %r15
+  8009ed:	5d                   	pop    %rbp
+  8009ee:	c3                   	ret
+
+00000000008009ef <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8009ef:	55                   	push   %rbp
+  8009f0:	48 89 e5             	mov    %rsp,%rbp
+  8009f3:	41 57                	push   %r15
+  8009f5:	53                   	push   %rbx
+  8009f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8009f6 <exit+0x7>
+  8009fd:	49 bb b2 ad 00 00 00 	movabs $0xadb2,%r11
+  800a04:	00 00 00 
+  800a07:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800a0a:	49 89 df             	mov    %rbx,%r15
+  800a0d:	48 b8 ba 7b ff ff ff 	movabs $0xffffffffffff7bba,%rax
+  800a14:	ff ff ff 
+  800a17:	48 01 d8             	add    %rbx,%rax
+  800a1a:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800a1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a21:	49 89 df             	mov    %rbx,%r15
+  800a24:	48 b8 e1 6e ff ff ff 	movabs $0xffffffffffff6ee1,%rax
+  800a2b:	ff ff ff 
+  800a2e:	48 01 d8             	add    %rbx,%rax
+  800a31:	ff d0                	call   *%rax
+}
+  800a33:	90                   	nop
+  800a34:	5b                   	pop    %rbx
+  800a35:	41 5f                	pop    %r15
+  800a37:	5d                   	pop    %rbp
+  800a38:	c3                   	ret
+
+0000000000800a39 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800a39:	55                   	push   %rbp
+  800a3a:	48 89 e5             	mov    %rsp,%rbp
+  800a3d:	41 57                	push   %r15
+  800a3f:	41 54                	push   %r12
+  800a41:	53                   	push   %rbx
+  800a42:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800a49:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800a49 <_panic+0x10>
+  800a50:	49 bb 5f ad 00 00 00 	movabs $0xad5f,%r11
+  800a57:	00 00 00 
+  800a5a:	4c 01 db             	add    %r11,%rbx
+  800a5d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800a64:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800a6a:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800a71:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800a78:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800a7f:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800a86:	84 c0                	test   %al,%al
+  800a88:	74 26                	je     800ab0 <_panic+0x77>
+  800a8a:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800a91:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800a98:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800a9c:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800aa0:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800aa4:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800aa8:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800aac:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800ab0:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800ab7:	00 00 00 
+  800aba:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800ac1:	00 00 00 
+  800ac4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ac8:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800acf:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800ad6:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800add:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  800ae4:	ff ff ff 
+  800ae7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800aeb:	4c 8b 20             	mov    (%rax),%r12
+  800aee:	49 89 df             	mov    %rbx,%r15
+  800af1:	48 b8 3d 6f ff ff ff 	movabs $0xffffffffffff6f3d,%rax
+  800af8:	ff ff ff 
+  800afb:	48 01 d8             	add    %rbx,%rax
+  800afe:	ff d0                	call   *%rax
+  800b00:	89 c6                	mov    %eax,%esi
+  800b02:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800b08:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800b0f:	41 89 d0             	mov    %edx,%r8d
+  800b12:	48 89 c1             	mov    %rax,%rcx
+  800b15:	4c 89 e2             	mov    %r12,%rdx
+  800b18:	48 b8 a8 bf ff ff ff 	movabs $0xffffffffffffbfa8,%rax
+  800b1f:	ff ff ff 
+  800b22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b26:	48 89 c7             	mov    %rax,%rdi
+  800b29:	49 89 df             	mov    %rbx,%r15
+  800b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b31:	49 b9 68 55 ff ff ff 	movabs $0xffffffffffff5568,%r9
+  800b38:	ff ff ff 
+  800b3b:	49 01 d9             	add    %rbx,%r9
+  800b3e:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800b41:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800b48:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800b4f:	48 89 d6             	mov    %rdx,%rsi
+  800b52:	48 89 c7             	mov    %rax,%rdi
+  800b55:	49 89 df             	mov    %rbx,%r15
+  800b58:	48 b8 88 54 ff ff ff 	movabs $0xffffffffffff5488,%rax
+  800b5f:	ff ff ff 
+  800b62:	48 01 d8             	add    %rbx,%rax
+  800b65:	ff d0                	call   *%rax
+	cprintf("\n");
+  800b67:	48 b8 cb bf ff ff ff 	movabs $0xffffffffffffbfcb,%rax
+  800b6e:	ff ff ff 
+  800b71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b75:	48 89 c7             	mov    %rax,%rdi
+  800b78:	49 89 df             	mov    %rbx,%r15
+  800b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b80:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  800b87:	ff ff ff 
+  800b8a:	48 01 da             	add    %rbx,%rdx
+  800b8d:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800b8f:	cc                   	int3
+  800b90:	eb fd                	jmp    800b8f <_panic+0x156>
+
+0000000000800b92 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800b92:	55                   	push   %rbp
+  800b93:	48 89 e5             	mov    %rsp,%rbp
+  800b96:	41 57                	push   %r15
+  800b98:	48 83 ec 18          	sub    $0x18,%rsp
+  800b9c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b9c <putch+0xa>
+  800ba3:	49 bb 0c ac 00 00 00 	movabs $0xac0c,%r11
+  800baa:	00 00 00 
+  800bad:	4c 01 d8             	add    %r11,%rax
+  800bb0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800bb3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800bb7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800bbb:	8b 12                	mov    (%rdx),%edx
+  800bbd:	8d 72 01             	lea    0x1(%rdx),%esi
+  800bc0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800bc4:	89 31                	mov    %esi,(%rcx)
+  800bc6:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800bc9:	89 ce                	mov    %ecx,%esi
+  800bcb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800bcf:	48 63 d2             	movslq %edx,%rdx
+  800bd2:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800bd7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800bdb:	8b 12                	mov    (%rdx),%edx
+  800bdd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800be3:	75 33                	jne    800c18 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800be5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800be9:	8b 12                	mov    (%rdx),%edx
+  800beb:	48 63 d2             	movslq %edx,%rdx
+  800bee:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800bf2:	48 83 c1 08          	add    $0x8,%rcx
+  800bf6:	48 89 d6             	mov    %rdx,%rsi
+  800bf9:	48 89 cf             	mov    %rcx,%rdi
+  800bfc:	49 89 c7             	mov    %rax,%r15
+  800bff:	48 ba 2e 6e ff ff ff 	movabs $0xffffffffffff6e2e,%rdx
+  800c06:	ff ff ff 
+  800c09:	48 01 c2             	add    %rax,%rdx
+  800c0c:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800c0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c12:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800c18:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c1c:	8b 40 04             	mov    0x4(%rax),%eax
+  800c1f:	8d 50 01             	lea    0x1(%rax),%edx
+  800c22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c26:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800c29:	90                   	nop
+  800c2a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800c2e:	c9                   	leave
+  800c2f:	c3                   	ret
+
+0000000000800c30 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800c30:	55                   	push   %rbp
+  800c31:	48 89 e5             	mov    %rsp,%rbp
+  800c34:	41 57                	push   %r15
+  800c36:	53                   	push   %rbx
+  800c37:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800c3e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800c3e <vcprintf+0xe>
+  800c45:	49 bb 6a ab 00 00 00 	movabs $0xab6a,%r11
+  800c4c:	00 00 00 
+  800c4f:	4c 01 db             	add    %r11,%rbx
+  800c52:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800c59:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800c60:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800c67:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800c6e:	48 8b 06             	mov    (%rsi),%rax
+  800c71:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800c75:	48 89 01             	mov    %rax,(%rcx)
+  800c78:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800c7c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800c80:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800c84:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800c8b:	00 00 00 
+    b.cnt = 0;
+  800c8e:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800c95:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800c98:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800c9f:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800ca6:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800cad:	48 89 c6             	mov    %rax,%rsi
+  800cb0:	48 b8 ea 53 ff ff ff 	movabs $0xffffffffffff53ea,%rax
+  800cb7:	ff ff ff 
+  800cba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800cbe:	48 89 c7             	mov    %rax,%rdi
+  800cc1:	49 89 df             	mov    %rbx,%r15
+  800cc4:	48 b8 ac 59 ff ff ff 	movabs $0xffffffffffff59ac,%rax
+  800ccb:	ff ff ff 
+  800cce:	48 01 d8             	add    %rbx,%rax
+  800cd1:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800cd3:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800cd9:	48 98                	cltq
+  800cdb:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800ce2:	48 83 c2 08          	add    $0x8,%rdx
+  800ce6:	48 89 c6             	mov    %rax,%rsi
+  800ce9:	48 89 d7             	mov    %rdx,%rdi
+  800cec:	49 89 df             	mov    %rbx,%r15
+  800cef:	48 b8 2e 6e ff ff ff 	movabs $0xffffffffffff6e2e,%rax
+  800cf6:	ff ff ff 
+  800cf9:	48 01 d8             	add    %rbx,%rax
+  800cfc:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800cfe:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800d04:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800d0b:	5b                   	pop    %rbx
+  800d0c:	41 5f                	pop    %r15
+  800d0e:	5d                   	pop    %rbp
+  800d0f:	c3                   	ret
+
+0000000000800d10 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800d10:	55                   	push   %rbp
+  800d11:	48 89 e5             	mov    %rsp,%rbp
+  800d14:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800d1b:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800d1b <cprintf+0xb>
+  800d22:	49 bb 8d aa 00 00 00 	movabs $0xaa8d,%r11
+  800d29:	00 00 00 
+  800d2c:	4d 01 da             	add    %r11,%r10
+  800d2f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800d36:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800d3d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800d44:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d4b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d52:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d59:	84 c0                	test   %al,%al
+  800d5b:	74 20                	je     800d7d <cprintf+0x6d>
+  800d5d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d61:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d65:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d69:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d6d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d71:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d75:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d79:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800d7d:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800d84:	00 00 00 
+  800d87:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800d8e:	00 00 00 
+  800d91:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d95:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800d9c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800da3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800daa:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800db1:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800db8:	48 8b 06             	mov    (%rsi),%rax
+  800dbb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800dbf:	48 89 01             	mov    %rax,(%rcx)
+  800dc2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800dca:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800dce:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800dd5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800ddc:	48 89 d6             	mov    %rdx,%rsi
+  800ddf:	48 89 c7             	mov    %rax,%rdi
+  800de2:	48 b8 88 54 ff ff ff 	movabs $0xffffffffffff5488,%rax
+  800de9:	ff ff ff 
+  800dec:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800df0:	ff d0                	call   *%rax
+  800df2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800df8:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800dfe:	c9                   	leave
+  800dff:	c3                   	ret
+
+0000000000800e00 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800e00:	55                   	push   %rbp
+  800e01:	48 89 e5             	mov    %rsp,%rbp
+  800e04:	53                   	push   %rbx
+  800e05:	48 83 ec 38          	sub    $0x38,%rsp
+  800e09:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800e09 <printnum+0x9>
+  800e10:	49 bb 9f a9 00 00 00 	movabs $0xa99f,%r11
+  800e17:	00 00 00 
+  800e1a:	4c 01 db             	add    %r11,%rbx
+  800e1d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e21:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800e25:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800e29:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800e2c:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800e30:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800e34:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800e37:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800e3b:	72 58                	jb     800e95 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800e3d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800e40:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800e43:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800e46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4f:	48 f7 f6             	div    %rsi
+  800e52:	49 89 c2             	mov    %rax,%r10
+  800e55:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800e58:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800e5b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800e5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e63:	41 89 c9             	mov    %ecx,%r9d
+  800e66:	41 89 f8             	mov    %edi,%r8d
+  800e69:	89 d1                	mov    %edx,%ecx
+  800e6b:	4c 89 d2             	mov    %r10,%rdx
+  800e6e:	48 89 c7             	mov    %rax,%rdi
+  800e71:	48 b8 58 56 ff ff ff 	movabs $0xffffffffffff5658,%rax
+  800e78:	ff ff ff 
+  800e7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e7f:	ff d0                	call   *%rax
+  800e81:	eb 1c                	jmp    800e9f <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800e83:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800e87:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800e8a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800e8e:	48 89 d6             	mov    %rdx,%rsi
+  800e91:	89 c7                	mov    %eax,%edi
+  800e93:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800e95:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800e99:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800e9d:	7f e4                	jg     800e83 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800e9f:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800ea2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ea6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eab:	48 f7 f1             	div    %rcx
+  800eae:	48 b8 07 c1 ff ff ff 	movabs $0xffffffffffffc107,%rax
+  800eb5:	ff ff ff 
+  800eb8:	48 01 d8             	add    %rbx,%rax
+  800ebb:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800ebf:	0f be c0             	movsbl %al,%eax
+  800ec2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ec6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800eca:	48 89 d6             	mov    %rdx,%rsi
+  800ecd:	89 c7                	mov    %eax,%edi
+  800ecf:	ff d1                	call   *%rcx
+}
+  800ed1:	90                   	nop
+  800ed2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800ed6:	c9                   	leave
+  800ed7:	c3                   	ret
+
+0000000000800ed8 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800ed8:	55                   	push   %rbp
+  800ed9:	48 89 e5             	mov    %rsp,%rbp
+  800edc:	48 83 ec 20          	sub    $0x20,%rsp
+  800ee0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ee0 <getuint+0x8>
+  800ee7:	49 bb c8 a8 00 00 00 	movabs $0xa8c8,%r11
+  800eee:	00 00 00 
+  800ef1:	4c 01 d8             	add    %r11,%rax
+  800ef4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ef8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800efb:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800eff:	7e 4f                	jle    800f50 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800f01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f05:	8b 00                	mov    (%rax),%eax
+  800f07:	83 f8 2f             	cmp    $0x2f,%eax
+  800f0a:	77 24                	ja     800f30 <getuint+0x58>
+  800f0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f10:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800f14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f18:	8b 00                	mov    (%rax),%eax
+  800f1a:	89 c0                	mov    %eax,%eax
+  800f1c:	48 01 d0             	add    %rdx,%rax
+  800f1f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800f23:	8b 12                	mov    (%rdx),%edx
+  800f25:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800f28:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800f2c:	89 0a                	mov    %ecx,(%rdx)
+  800f2e:	eb 14                	jmp    800f44 <getuint+0x6c>
+  800f30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f34:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f38:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800f3c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800f40:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800f44:	48 8b 00             	mov    (%rax),%rax
+  800f47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800f4b:	e9 9d 00 00 00       	jmp    800fed <getuint+0x115>
+	else if (lflag)
+  800f50:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800f54:	74 4c                	je     800fa2 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800f56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f5a:	8b 00                	mov    (%rax),%eax
+  800f5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f5f:	77 24                	ja     800f85 <getuint+0xad>
+  800f61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f65:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800f69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f6d:	8b 00                	mov    (%rax),%eax
+  800f6f:	89 c0                	mov    %eax,%eax
+  800f71:	48 01 d0             	add    %rdx,%rax
+  800f74:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800f78:	8b 12                	mov    (%rdx),%edx
+  800f7a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800f7d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800f81:	89 0a                	mov    %ecx,(%rdx)
+  800f83:	eb 14                	jmp    800f99 <getuint+0xc1>
+  800f85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f89:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f8d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800f91:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800f95:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800f99:	48 8b 00             	mov    (%rax),%rax
+  800f9c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800fa0:	eb 4b                	jmp    800fed <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800fa2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fa6:	8b 00                	mov    (%rax),%eax
+  800fa8:	83 f8 2f             	cmp    $0x2f,%eax
+  800fab:	77 24                	ja     800fd1 <getuint+0xf9>
+  800fad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fb1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800fb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fb9:	8b 00                	mov    (%rax),%eax
+  800fbb:	89 c0                	mov    %eax,%eax
+  800fbd:	48 01 d0             	add    %rdx,%rax
+  800fc0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800fc4:	8b 12                	mov    (%rdx),%edx
+  800fc6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800fc9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800fcd:	89 0a                	mov    %ecx,(%rdx)
+  800fcf:	eb 14                	jmp    800fe5 <getuint+0x10d>
+  800fd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800fd5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800fd9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800fdd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800fe1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800fe5:	8b 00                	mov    (%rax),%eax
+  800fe7:	89 c0                	mov    %eax,%eax
+  800fe9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800fed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800ff1:	c9                   	leave
+  800ff2:	c3                   	ret
+
+0000000000800ff3 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800ff3:	55                   	push   %rbp
+  800ff4:	48 89 e5             	mov    %rsp,%rbp
+  800ff7:	48 83 ec 20          	sub    $0x20,%rsp
+  800ffb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ffb <printfloat+0x8>
+  801002:	49 bb ad a7 00 00 00 	movabs $0xa7ad,%r11
+  801009:	00 00 00 
+  80100c:	4c 01 d8             	add    %r11,%rax
+  80100f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801013:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801017:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80101b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80101f:	48 85 c0             	test   %rax,%rax
+  801022:	79 12                	jns    801036 <printfloat+0x43>
+		putch('-',putdat);
+  801024:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801028:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80102c:	48 89 c6             	mov    %rax,%rsi
+  80102f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801034:	ff d2                	call   *%rdx
+	
+}
+  801036:	90                   	nop
+  801037:	c9                   	leave
+  801038:	c3                   	ret
+
+0000000000801039 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  801039:	55                   	push   %rbp
+  80103a:	48 89 e5             	mov    %rsp,%rbp
+  80103d:	48 83 ec 20          	sub    $0x20,%rsp
+  801041:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801041 <getint+0x8>
+  801048:	49 bb 67 a7 00 00 00 	movabs $0xa767,%r11
+  80104f:	00 00 00 
+  801052:	4c 01 d8             	add    %r11,%rax
+  801055:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801059:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80105c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801060:	7e 4f                	jle    8010b1 <getint+0x78>
+		x=va_arg(*ap, long long);
+  801062:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801066:	8b 00                	mov    (%rax),%eax
+  801068:	83 f8 2f             	cmp    $0x2f,%eax
+  80106b:	77 24                	ja     801091 <getint+0x58>
+  80106d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801071:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801075:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801079:	8b 00                	mov    (%rax),%eax
+  80107b:	89 c0                	mov    %eax,%eax
+  80107d:	48 01 d0             	add    %rdx,%rax
+  801080:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801084:	8b 12                	mov    (%rdx),%edx
+  801086:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801089:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80108d:	89 0a                	mov    %ecx,(%rdx)
+  80108f:	eb 14                	jmp    8010a5 <getint+0x6c>
+  801091:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801095:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801099:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80109d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010a1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8010a5:	48 8b 00             	mov    (%rax),%rax
+  8010a8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8010ac:	e9 9d 00 00 00       	jmp    80114e <getint+0x115>
+	else if (lflag)
+  8010b1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8010b5:	74 4c                	je     801103 <getint+0xca>
+		x=va_arg(*ap, long);
+  8010b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010bb:	8b 00                	mov    (%rax),%eax
+  8010bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8010c0:	77 24                	ja     8010e6 <getint+0xad>
+  8010c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010c6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8010ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ce:	8b 00                	mov    (%rax),%eax
+  8010d0:	89 c0                	mov    %eax,%eax
+  8010d2:	48 01 d0             	add    %rdx,%rax
+  8010d5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010d9:	8b 12                	mov    (%rdx),%edx
+  8010db:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8010de:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010e2:	89 0a                	mov    %ecx,(%rdx)
+  8010e4:	eb 14                	jmp    8010fa <getint+0xc1>
+  8010e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010ea:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8010ee:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8010f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8010f6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8010fa:	48 8b 00             	mov    (%rax),%rax
+  8010fd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801101:	eb 4b                	jmp    80114e <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  801103:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801107:	8b 00                	mov    (%rax),%eax
+  801109:	83 f8 2f             	cmp    $0x2f,%eax
+  80110c:	77 24                	ja     801132 <getint+0xf9>
+  80110e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801112:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801116:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80111a:	8b 00                	mov    (%rax),%eax
+  80111c:	89 c0                	mov    %eax,%eax
+  80111e:	48 01 d0             	add    %rdx,%rax
+  801121:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801125:	8b 12                	mov    (%rdx),%edx
+  801127:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80112a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80112e:	89 0a                	mov    %ecx,(%rdx)
+  801130:	eb 14                	jmp    801146 <getint+0x10d>
+  801132:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801136:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80113a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80113e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801142:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801146:	8b 00                	mov    (%rax),%eax
+  801148:	48 98                	cltq
+  80114a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80114e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801152:	c9                   	leave
+  801153:	c3                   	ret
+
+0000000000801154 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  801154:	55                   	push   %rbp
+  801155:	48 89 e5             	mov    %rsp,%rbp
+  801158:	41 57                	push   %r15
+  80115a:	41 55                	push   %r13
+  80115c:	41 54                	push   %r12
+  80115e:	53                   	push   %rbx
+  80115f:	48 83 ec 60          	sub    $0x60,%rsp
+  801163:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 801163 <vprintfmt+0xf>
+  80116a:	49 bb 45 a6 00 00 00 	movabs $0xa645,%r11
+  801171:	00 00 00 
+  801174:	4d 01 dc             	add    %r11,%r12
+  801177:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  80117b:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  80117f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801183:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  801187:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  80118e:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  801192:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  801196:	48 8b 06             	mov    (%rsi),%rax
+  801199:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80119d:	48 89 01             	mov    %rax,(%rcx)
+  8011a0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8011a4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8011a8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8011ac:	eb 17                	jmp    8011c5 <vprintfmt+0x71>
+			if (ch == '\0')
+  8011ae:	85 db                	test   %ebx,%ebx
+  8011b0:	0f 84 97 05 00 00    	je     80174d <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  8011b6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011ba:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011be:	48 89 c6             	mov    %rax,%rsi
+  8011c1:	89 df                	mov    %ebx,%edi
+  8011c3:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8011c5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8011c9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8011cd:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8011d1:	0f b6 00             	movzbl (%rax),%eax
+  8011d4:	0f b6 d8             	movzbl %al,%ebx
+  8011d7:	83 fb 25             	cmp    $0x25,%ebx
+  8011da:	75 d2                	jne    8011ae <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  8011dc:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  8011e0:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  8011e7:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8011ee:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  8011f5:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  8011fc:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801200:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801204:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801208:	0f b6 00             	movzbl (%rax),%eax
+  80120b:	0f b6 d8             	movzbl %al,%ebx
+  80120e:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  801211:	83 f8 55             	cmp    $0x55,%eax
+  801214:	0f 87 00 05 00 00    	ja     80171a <vprintfmt+0x5c6>
+  80121a:	89 c0                	mov    %eax,%eax
+  80121c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801223:	00 
+  801224:	48 8d 05 ad 66 00 00 	lea    0x66ad(%rip),%rax        # 8078d8 <.LC18+0xc>
+  80122b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  80122f:	48 8d 15 a2 66 00 00 	lea    0x66a2(%rip),%rdx        # 8078d8 <.LC18+0xc>
+  801236:	48 01 d0             	add    %rdx,%rax
+  801239:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  80123b:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  80123f:	eb bb                	jmp    8011fc <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  801241:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  801245:	eb b5                	jmp    8011fc <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  801247:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  80124e:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  801251:	89 d0                	mov    %edx,%eax
+  801253:	c1 e0 02             	shl    $0x2,%eax
+  801256:	01 d0                	add    %edx,%eax
+  801258:	01 c0                	add    %eax,%eax
+  80125a:	01 d8                	add    %ebx,%eax
+  80125c:	83 e8 30             	sub    $0x30,%eax
+  80125f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  801262:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801266:	0f b6 00             	movzbl (%rax),%eax
+  801269:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  80126c:	83 fb 2f             	cmp    $0x2f,%ebx
+  80126f:	7e 60                	jle    8012d1 <vprintfmt+0x17d>
+  801271:	83 fb 39             	cmp    $0x39,%ebx
+  801274:	7f 5b                	jg     8012d1 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  801276:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  80127b:	eb d1                	jmp    80124e <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  80127d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801280:	83 f8 2f             	cmp    $0x2f,%eax
+  801283:	77 17                	ja     80129c <vprintfmt+0x148>
+  801285:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801289:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80128c:	89 d2                	mov    %edx,%edx
+  80128e:	48 01 d0             	add    %rdx,%rax
+  801291:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801294:	83 c2 08             	add    $0x8,%edx
+  801297:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80129a:	eb 0c                	jmp    8012a8 <vprintfmt+0x154>
+  80129c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8012a0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8012a4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8012a8:	8b 00                	mov    (%rax),%eax
+  8012aa:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  8012ad:	eb 23                	jmp    8012d2 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  8012af:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8012b3:	0f 89 43 ff ff ff    	jns    8011fc <vprintfmt+0xa8>
+				width = 0;
+  8012b9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  8012c0:	e9 37 ff ff ff       	jmp    8011fc <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  8012c5:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  8012cc:	e9 2b ff ff ff       	jmp    8011fc <vprintfmt+0xa8>
+			goto process_precision;
+  8012d1:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8012d2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8012d6:	0f 89 20 ff ff ff    	jns    8011fc <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  8012dc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8012df:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8012e2:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  8012e9:	e9 0e ff ff ff       	jmp    8011fc <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  8012ee:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  8012f2:	e9 05 ff ff ff       	jmp    8011fc <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  8012f7:	83 fb 39             	cmp    $0x39,%ebx
+  8012fa:	7f 0b                	jg     801307 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  8012fc:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  8012ff:	c1 e0 08             	shl    $0x8,%eax
+  801302:	01 45 bc             	add    %eax,-0x44(%rbp)
+  801305:	eb 21                	jmp    801328 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  801307:	83 fb 60             	cmp    $0x60,%ebx
+  80130a:	7e 10                	jle    80131c <vprintfmt+0x1c8>
+  80130c:	83 fb 66             	cmp    $0x66,%ebx
+  80130f:	7f 0b                	jg     80131c <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  801311:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  801314:	c1 e0 08             	shl    $0x8,%eax
+  801317:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80131a:	eb 0c                	jmp    801328 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  80131c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  801323:	e9 04 01 00 00       	jmp    80142c <vprintfmt+0x2d8>
+  801328:	e9 ff 00 00 00       	jmp    80142c <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  80132d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801330:	83 f8 2f             	cmp    $0x2f,%eax
+  801333:	77 17                	ja     80134c <vprintfmt+0x1f8>
+  801335:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801339:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80133c:	89 d2                	mov    %edx,%edx
+  80133e:	48 01 d0             	add    %rdx,%rax
+  801341:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801344:	83 c2 08             	add    $0x8,%edx
+  801347:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80134a:	eb 0c                	jmp    801358 <vprintfmt+0x204>
+  80134c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801350:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801354:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801358:	8b 00                	mov    (%rax),%eax
+  80135a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80135e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801362:	48 89 d6             	mov    %rdx,%rsi
+  801365:	89 c7                	mov    %eax,%edi
+  801367:	ff d1                	call   *%rcx
+			break;
+  801369:	e9 da 03 00 00       	jmp    801748 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80136e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801371:	83 f8 2f             	cmp    $0x2f,%eax
+  801374:	77 17                	ja     80138d <vprintfmt+0x239>
+  801376:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80137a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80137d:	89 d2                	mov    %edx,%edx
+  80137f:	48 01 d0             	add    %rdx,%rax
+  801382:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801385:	83 c2 08             	add    $0x8,%edx
+  801388:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80138b:	eb 0c                	jmp    801399 <vprintfmt+0x245>
+  80138d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801391:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801395:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801399:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  80139b:	85 db                	test   %ebx,%ebx
+  80139d:	79 02                	jns    8013a1 <vprintfmt+0x24d>
+				err = -err;
+  80139f:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8013a1:	83 fb 15             	cmp    $0x15,%ebx
+  8013a4:	7f 19                	jg     8013bf <vprintfmt+0x26b>
+  8013a6:	48 ba 18 01 00 00 00 	movabs $0x118,%rdx
+  8013ad:	00 00 00 
+  8013b0:	48 63 c3             	movslq %ebx,%rax
+  8013b3:	4c 01 e2             	add    %r12,%rdx
+  8013b6:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  8013ba:	4d 85 ed             	test   %r13,%r13
+  8013bd:	75 36                	jne    8013f5 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  8013bf:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8013c3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8013c7:	89 d9                	mov    %ebx,%ecx
+  8013c9:	48 ba 18 c1 ff ff ff 	movabs $0xffffffffffffc118,%rdx
+  8013d0:	ff ff ff 
+  8013d3:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8013d7:	48 89 c7             	mov    %rax,%rdi
+  8013da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013df:	49 b8 b3 5f ff ff ff 	movabs $0xffffffffffff5fb3,%r8
+  8013e6:	ff ff ff 
+  8013e9:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8013ed:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8013f0:	e9 53 03 00 00       	jmp    801748 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  8013f5:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8013f9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8013fd:	4c 89 e9             	mov    %r13,%rcx
+  801400:	48 ba 21 c1 ff ff ff 	movabs $0xffffffffffffc121,%rdx
+  801407:	ff ff ff 
+  80140a:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  80140e:	48 89 c7             	mov    %rax,%rdi
+  801411:	b8 00 00 00 00       	mov    $0x0,%eax
+  801416:	49 b8 b3 5f ff ff ff 	movabs $0xffffffffffff5fb3,%r8
+  80141d:	ff ff ff 
+  801420:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801424:	41 ff d0             	call   *%r8
+			break;
+  801427:	e9 1c 03 00 00       	jmp    801748 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  80142c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80142f:	83 f8 2f             	cmp    $0x2f,%eax
+  801432:	77 17                	ja     80144b <vprintfmt+0x2f7>
+  801434:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801438:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80143b:	89 d2                	mov    %edx,%edx
+  80143d:	48 01 d0             	add    %rdx,%rax
+  801440:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801443:	83 c2 08             	add    $0x8,%edx
+  801446:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801449:	eb 0c                	jmp    801457 <vprintfmt+0x303>
+  80144b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80144f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801453:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801457:	4c 8b 28             	mov    (%rax),%r13
+  80145a:	4d 85 ed             	test   %r13,%r13
+  80145d:	75 0e                	jne    80146d <vprintfmt+0x319>
+				p = "(null)";
+  80145f:	48 b8 24 c1 ff ff ff 	movabs $0xffffffffffffc124,%rax
+  801466:	ff ff ff 
+  801469:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  80146d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801471:	0f 8e 84 00 00 00    	jle    8014fb <vprintfmt+0x3a7>
+  801477:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  80147b:	74 7e                	je     8014fb <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80147d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801480:	48 98                	cltq
+  801482:	48 89 c6             	mov    %rax,%rsi
+  801485:	4c 89 ef             	mov    %r13,%rdi
+  801488:	4d 89 e7             	mov    %r12,%r15
+  80148b:	48 b8 d8 62 ff ff ff 	movabs $0xffffffffffff62d8,%rax
+  801492:	ff ff ff 
+  801495:	4c 01 e0             	add    %r12,%rax
+  801498:	ff d0                	call   *%rax
+  80149a:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  80149d:	eb 17                	jmp    8014b6 <vprintfmt+0x362>
+					putch(padc, putdat);
+  80149f:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  8014a3:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8014a7:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8014ab:	48 89 d6             	mov    %rdx,%rsi
+  8014ae:	89 c7                	mov    %eax,%edi
+  8014b0:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8014b2:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8014b6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8014ba:	7f e3                	jg     80149f <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8014bc:	eb 3d                	jmp    8014fb <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8014be:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8014c2:	74 1e                	je     8014e2 <vprintfmt+0x38e>
+  8014c4:	83 fb 1f             	cmp    $0x1f,%ebx
+  8014c7:	7e 05                	jle    8014ce <vprintfmt+0x37a>
+  8014c9:	83 fb 7e             	cmp    $0x7e,%ebx
+  8014cc:	7e 14                	jle    8014e2 <vprintfmt+0x38e>
+					putch('?', putdat);
+  8014ce:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8014d2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8014d6:	48 89 c6             	mov    %rax,%rsi
+  8014d9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8014de:	ff d2                	call   *%rdx
+  8014e0:	eb 15                	jmp    8014f7 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  8014e2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8014e5:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  8014e8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8014ec:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8014f0:	48 89 c6             	mov    %rax,%rsi
+  8014f3:	89 cf                	mov    %ecx,%edi
+  8014f5:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8014f7:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8014fb:	4c 89 e8             	mov    %r13,%rax
+  8014fe:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801502:	0f b6 00             	movzbl (%rax),%eax
+  801505:	0f be d8             	movsbl %al,%ebx
+  801508:	85 db                	test   %ebx,%ebx
+  80150a:	74 28                	je     801534 <vprintfmt+0x3e0>
+  80150c:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801510:	78 ac                	js     8014be <vprintfmt+0x36a>
+  801512:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801516:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80151a:	79 a2                	jns    8014be <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  80151c:	eb 16                	jmp    801534 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  80151e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801522:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801526:	48 89 c6             	mov    %rax,%rsi
+  801529:	bf 20 00 00 00       	mov    $0x20,%edi
+  80152e:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801530:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801534:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801538:	7f e4                	jg     80151e <vprintfmt+0x3ca>
+			break;
+  80153a:	e9 09 02 00 00       	jmp    801748 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80153f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801543:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801547:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80154b:	0f b6 00             	movzbl (%rax),%eax
+  80154e:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801551:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801552:	83 fb 2f             	cmp    $0x2f,%ebx
+  801555:	0f 8e ac fd ff ff    	jle    801307 <vprintfmt+0x1b3>
+  80155b:	e9 97 fd ff ff       	jmp    8012f7 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801560:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801564:	be 03 00 00 00       	mov    $0x3,%esi
+  801569:	48 89 c7             	mov    %rax,%rdi
+  80156c:	48 b8 91 58 ff ff ff 	movabs $0xffffffffffff5891,%rax
+  801573:	ff ff ff 
+  801576:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80157a:	ff d0                	call   *%rax
+  80157c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  801580:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801584:	48 85 c0             	test   %rax,%rax
+  801587:	79 1d                	jns    8015a6 <vprintfmt+0x452>
+				putch('-', putdat);
+  801589:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80158d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801591:	48 89 c6             	mov    %rax,%rsi
+  801594:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801599:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  80159b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80159f:	48 f7 d8             	neg    %rax
+  8015a2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8015a6:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8015ad:	e9 de 00 00 00       	jmp    801690 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8015b2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8015b6:	be 03 00 00 00       	mov    $0x3,%esi
+  8015bb:	48 89 c7             	mov    %rax,%rdi
+  8015be:	48 b8 30 57 ff ff ff 	movabs $0xffffffffffff5730,%rax
+  8015c5:	ff ff ff 
+  8015c8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8015cc:	ff d0                	call   *%rax
+  8015ce:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  8015d2:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8015d9:	e9 b2 00 00 00       	jmp    801690 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8015de:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8015e2:	be 03 00 00 00       	mov    $0x3,%esi
+  8015e7:	48 89 c7             	mov    %rax,%rdi
+  8015ea:	48 b8 30 57 ff ff ff 	movabs $0xffffffffffff5730,%rax
+  8015f1:	ff ff ff 
+  8015f4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8015f8:	ff d0                	call   *%rax
+  8015fa:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  8015fe:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801605:	e9 86 00 00 00       	jmp    801690 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80160a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80160e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801612:	48 89 c6             	mov    %rax,%rsi
+  801615:	bf 30 00 00 00       	mov    $0x30,%edi
+  80161a:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80161c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801620:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801624:	48 89 c6             	mov    %rax,%rsi
+  801627:	bf 78 00 00 00       	mov    $0x78,%edi
+  80162c:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80162e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801631:	83 f8 2f             	cmp    $0x2f,%eax
+  801634:	77 17                	ja     80164d <vprintfmt+0x4f9>
+  801636:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80163a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80163d:	89 d2                	mov    %edx,%edx
+  80163f:	48 01 d0             	add    %rdx,%rax
+  801642:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801645:	83 c2 08             	add    $0x8,%edx
+  801648:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80164b:	eb 0c                	jmp    801659 <vprintfmt+0x505>
+  80164d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801651:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801655:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801659:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80165c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801660:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801667:	eb 27                	jmp    801690 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801669:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80166d:	be 03 00 00 00       	mov    $0x3,%esi
+  801672:	48 89 c7             	mov    %rax,%rdi
+  801675:	48 b8 30 57 ff ff ff 	movabs $0xffffffffffff5730,%rax
+  80167c:	ff ff ff 
+  80167f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801683:	ff d0                	call   *%rax
+  801685:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801689:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801690:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801695:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801698:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80169b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80169f:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8016a3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8016a7:	45 89 c1             	mov    %r8d,%r9d
+  8016aa:	41 89 f8             	mov    %edi,%r8d
+  8016ad:	48 89 c7             	mov    %rax,%rdi
+  8016b0:	48 b8 58 56 ff ff ff 	movabs $0xffffffffffff5658,%rax
+  8016b7:	ff ff ff 
+  8016ba:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8016be:	ff d0                	call   *%rax
+			break;
+  8016c0:	e9 83 00 00 00       	jmp    801748 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8016c5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8016c9:	be 03 00 00 00       	mov    $0x3,%esi
+  8016ce:	48 89 c7             	mov    %rax,%rdi
+  8016d1:	48 b8 30 57 ff ff ff 	movabs $0xffffffffffff5730,%rax
+  8016d8:	ff ff ff 
+  8016db:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8016df:	ff d0                	call   *%rax
+  8016e1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8016e5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016e9:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8016ed:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8016f1:	48 89 ce             	mov    %rcx,%rsi
+  8016f4:	48 89 c7             	mov    %rax,%rdi
+  8016f7:	48 b8 4b 58 ff ff ff 	movabs $0xffffffffffff584b,%rax
+  8016fe:	ff ff ff 
+  801701:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801705:	ff d0                	call   *%rax
+	
+			break;
+  801707:	eb 3f                	jmp    801748 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801709:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80170d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801711:	48 89 c6             	mov    %rax,%rsi
+  801714:	89 df                	mov    %ebx,%edi
+  801716:	ff d2                	call   *%rdx
+			break;
+  801718:	eb 2e                	jmp    801748 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80171a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80171e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801722:	48 89 c6             	mov    %rax,%rsi
+  801725:	bf 25 00 00 00       	mov    $0x25,%edi
+  80172a:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80172c:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801731:	eb 05                	jmp    801738 <vprintfmt+0x5e4>
+  801733:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801738:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80173c:	48 83 e8 01          	sub    $0x1,%rax
+  801740:	0f b6 00             	movzbl (%rax),%eax
+  801743:	3c 25                	cmp    $0x25,%al
+  801745:	75 ec                	jne    801733 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801747:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801748:	e9 78 fa ff ff       	jmp    8011c5 <vprintfmt+0x71>
+				return;
+  80174d:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80174e:	48 83 c4 60          	add    $0x60,%rsp
+  801752:	5b                   	pop    %rbx
+  801753:	41 5c                	pop    %r12
+  801755:	41 5d                	pop    %r13
+  801757:	41 5f                	pop    %r15
+  801759:	5d                   	pop    %rbp
+  80175a:	c3                   	ret
+
+000000000080175b <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80175b:	55                   	push   %rbp
+  80175c:	48 89 e5             	mov    %rsp,%rbp
+  80175f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801766:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801766 <printfmt+0xb>
+  80176d:	49 bb 42 a0 00 00 00 	movabs $0xa042,%r11
+  801774:	00 00 00 
+  801777:	4d 01 da             	add    %r11,%r10
+  80177a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801781:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801788:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80178f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801796:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80179d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8017a4:	84 c0                	test   %al,%al
+  8017a6:	74 20                	je     8017c8 <printfmt+0x6d>
+  8017a8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8017ac:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8017b0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8017b4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8017b8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8017bc:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8017c0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8017c4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8017c8:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8017cf:	00 00 00 
+  8017d2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8017d9:	00 00 00 
+  8017dc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017e0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8017e7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8017ee:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8017f5:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8017fc:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801803:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80180a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801811:	48 89 c7             	mov    %rax,%rdi
+  801814:	48 b8 ac 59 ff ff ff 	movabs $0xffffffffffff59ac,%rax
+  80181b:	ff ff ff 
+  80181e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801822:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801824:	90                   	nop
+  801825:	c9                   	leave
+  801826:	c3                   	ret
+
+0000000000801827 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801827:	55                   	push   %rbp
+  801828:	48 89 e5             	mov    %rsp,%rbp
+  80182b:	48 83 ec 10          	sub    $0x10,%rsp
+  80182f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80182f <sprintputch+0x8>
+  801836:	49 bb 79 9f 00 00 00 	movabs $0x9f79,%r11
+  80183d:	00 00 00 
+  801840:	4c 01 d8             	add    %r11,%rax
+  801843:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801846:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80184a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80184e:	8b 40 10             	mov    0x10(%rax),%eax
+  801851:	8d 50 01             	lea    0x1(%rax),%edx
+  801854:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801858:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80185b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80185f:	48 8b 10             	mov    (%rax),%rdx
+  801862:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801866:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80186a:	48 39 c2             	cmp    %rax,%rdx
+  80186d:	73 17                	jae    801886 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80186f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801873:	48 8b 00             	mov    (%rax),%rax
+  801876:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80187a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80187e:	48 89 0a             	mov    %rcx,(%rdx)
+  801881:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801884:	88 10                	mov    %dl,(%rax)
+}
+  801886:	90                   	nop
+  801887:	c9                   	leave
+  801888:	c3                   	ret
+
+0000000000801889 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801889:	55                   	push   %rbp
+  80188a:	48 89 e5             	mov    %rsp,%rbp
+  80188d:	53                   	push   %rbx
+  80188e:	48 83 ec 58          	sub    $0x58,%rsp
+  801892:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801892 <vsnprintf+0x9>
+  801899:	49 bb 16 9f 00 00 00 	movabs $0x9f16,%r11
+  8018a0:	00 00 00 
+  8018a3:	4c 01 d8             	add    %r11,%rax
+  8018a6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8018aa:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8018ad:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8018b1:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8018b5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8018b9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8018bd:	48 8b 0e             	mov    (%rsi),%rcx
+  8018c0:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8018c4:	48 89 0a             	mov    %rcx,(%rdx)
+  8018c7:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8018cb:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8018cf:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8018d3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8018d7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8018db:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8018de:	48 63 d2             	movslq %edx,%rdx
+  8018e1:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8018e5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8018e9:	48 01 ca             	add    %rcx,%rdx
+  8018ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018f0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8018f7:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8018fc:	74 06                	je     801904 <vsnprintf+0x7b>
+  8018fe:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801902:	7f 07                	jg     80190b <vsnprintf+0x82>
+		return -E_INVAL;
+  801904:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801909:	eb 34                	jmp    80193f <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80190b:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  80190f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801913:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801917:	48 bf 7f 60 ff ff ff 	movabs $0xffffffffffff607f,%rdi
+  80191e:	ff ff ff 
+  801921:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801925:	49 b8 ac 59 ff ff ff 	movabs $0xffffffffffff59ac,%r8
+  80192c:	ff ff ff 
+  80192f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801933:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801935:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801939:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80193c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80193f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801943:	c9                   	leave
+  801944:	c3                   	ret
+
+0000000000801945 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801945:	55                   	push   %rbp
+  801946:	48 89 e5             	mov    %rsp,%rbp
+  801949:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801950:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801950 <snprintf+0xb>
+  801957:	49 bb 58 9e 00 00 00 	movabs $0x9e58,%r11
+  80195e:	00 00 00 
+  801961:	4d 01 da             	add    %r11,%r10
+  801964:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80196b:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801971:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801978:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80197f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801986:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80198d:	84 c0                	test   %al,%al
+  80198f:	74 20                	je     8019b1 <snprintf+0x6c>
+  801991:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801995:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801999:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80199d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8019a1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8019a5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8019a9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8019ad:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8019b1:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8019b8:	00 00 00 
+  8019bb:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8019c2:	00 00 00 
+  8019c5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019c9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8019d0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8019d7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8019de:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8019e5:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8019ec:	48 8b 06             	mov    (%rsi),%rax
+  8019ef:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8019f3:	48 89 01             	mov    %rax,(%rcx)
+  8019f6:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8019fa:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8019fe:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801a02:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801a09:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801a10:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801a16:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801a1d:	48 89 c7             	mov    %rax,%rdi
+  801a20:	48 b8 e1 60 ff ff ff 	movabs $0xffffffffffff60e1,%rax
+  801a27:	ff ff ff 
+  801a2a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801a2e:	ff d0                	call   *%rax
+  801a30:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801a36:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801a3c:	c9                   	leave
+  801a3d:	c3                   	ret
+
+0000000000801a3e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801a3e:	55                   	push   %rbp
+  801a3f:	48 89 e5             	mov    %rsp,%rbp
+  801a42:	48 83 ec 18          	sub    $0x18,%rsp
+  801a46:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a46 <strlen+0x8>
+  801a4d:	49 bb 62 9d 00 00 00 	movabs $0x9d62,%r11
+  801a54:	00 00 00 
+  801a57:	4c 01 d8             	add    %r11,%rax
+  801a5a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801a5e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801a65:	eb 09                	jmp    801a70 <strlen+0x32>
+		n++;
+  801a67:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801a6b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801a70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a74:	0f b6 00             	movzbl (%rax),%eax
+  801a77:	84 c0                	test   %al,%al
+  801a79:	75 ec                	jne    801a67 <strlen+0x29>
+	return n;
+  801a7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801a7e:	c9                   	leave
+  801a7f:	c3                   	ret
+
+0000000000801a80 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801a80:	55                   	push   %rbp
+  801a81:	48 89 e5             	mov    %rsp,%rbp
+  801a84:	48 83 ec 20          	sub    $0x20,%rsp
+  801a88:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a88 <strnlen+0x8>
+  801a8f:	49 bb 20 9d 00 00 00 	movabs $0x9d20,%r11
+  801a96:	00 00 00 
+  801a99:	4c 01 d8             	add    %r11,%rax
+  801a9c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aa0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801aa4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801aab:	eb 0e                	jmp    801abb <strnlen+0x3b>
+		n++;
+  801aad:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801ab1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ab6:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801abb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801ac0:	74 0b                	je     801acd <strnlen+0x4d>
+  801ac2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ac6:	0f b6 00             	movzbl (%rax),%eax
+  801ac9:	84 c0                	test   %al,%al
+  801acb:	75 e0                	jne    801aad <strnlen+0x2d>
+	return n;
+  801acd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801ad0:	c9                   	leave
+  801ad1:	c3                   	ret
+
+0000000000801ad2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801ad2:	55                   	push   %rbp
+  801ad3:	48 89 e5             	mov    %rsp,%rbp
+  801ad6:	48 83 ec 20          	sub    $0x20,%rsp
+  801ada:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ada <strcpy+0x8>
+  801ae1:	49 bb ce 9c 00 00 00 	movabs $0x9cce,%r11
+  801ae8:	00 00 00 
+  801aeb:	4c 01 d8             	add    %r11,%rax
+  801aee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801af2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801af6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801afa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801afe:	90                   	nop
+  801aff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801b03:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801b07:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801b0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b0f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801b13:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b17:	0f b6 12             	movzbl (%rdx),%edx
+  801b1a:	88 10                	mov    %dl,(%rax)
+  801b1c:	0f b6 00             	movzbl (%rax),%eax
+  801b1f:	84 c0                	test   %al,%al
+  801b21:	75 dc                	jne    801aff <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801b23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801b27:	c9                   	leave
+  801b28:	c3                   	ret
+
+0000000000801b29 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801b29:	55                   	push   %rbp
+  801b2a:	48 89 e5             	mov    %rsp,%rbp
+  801b2d:	53                   	push   %rbx
+  801b2e:	48 83 ec 20          	sub    $0x20,%rsp
+  801b32:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801b32 <strcat+0x9>
+  801b39:	49 bb 76 9c 00 00 00 	movabs $0x9c76,%r11
+  801b40:	00 00 00 
+  801b43:	4c 01 db             	add    %r11,%rbx
+  801b46:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801b4a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801b4e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b52:	48 89 c7             	mov    %rax,%rdi
+  801b55:	48 b8 96 62 ff ff ff 	movabs $0xffffffffffff6296,%rax
+  801b5c:	ff ff ff 
+  801b5f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801b63:	ff d0                	call   *%rax
+  801b65:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801b68:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801b6b:	48 63 d0             	movslq %eax,%rdx
+  801b6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b72:	48 01 c2             	add    %rax,%rdx
+  801b75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b79:	48 89 c6             	mov    %rax,%rsi
+  801b7c:	48 89 d7             	mov    %rdx,%rdi
+  801b7f:	48 b8 2a 63 ff ff ff 	movabs $0xffffffffffff632a,%rax
+  801b86:	ff ff ff 
+  801b89:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801b8d:	ff d0                	call   *%rax
+	return dst;
+  801b8f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801b93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b97:	c9                   	leave
+  801b98:	c3                   	ret
+
+0000000000801b99 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801b99:	55                   	push   %rbp
+  801b9a:	48 89 e5             	mov    %rsp,%rbp
+  801b9d:	48 83 ec 28          	sub    $0x28,%rsp
+  801ba1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ba1 <strncpy+0x8>
+  801ba8:	49 bb 07 9c 00 00 00 	movabs $0x9c07,%r11
+  801baf:	00 00 00 
+  801bb2:	4c 01 d8             	add    %r11,%rax
+  801bb5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bb9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801bbd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801bc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801bc9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801bd0:	00 
+  801bd1:	eb 2a                	jmp    801bfd <strncpy+0x64>
+		*dst++ = *src;
+  801bd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bd7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bdb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801bdf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801be3:	0f b6 12             	movzbl (%rdx),%edx
+  801be6:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801be8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bec:	0f b6 00             	movzbl (%rax),%eax
+  801bef:	84 c0                	test   %al,%al
+  801bf1:	74 05                	je     801bf8 <strncpy+0x5f>
+			src++;
+  801bf3:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801bf8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c01:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801c05:	72 cc                	jb     801bd3 <strncpy+0x3a>
+	}
+	return ret;
+  801c07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801c0b:	c9                   	leave
+  801c0c:	c3                   	ret
+
+0000000000801c0d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801c0d:	55                   	push   %rbp
+  801c0e:	48 89 e5             	mov    %rsp,%rbp
+  801c11:	48 83 ec 28          	sub    $0x28,%rsp
+  801c15:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c15 <strlcpy+0x8>
+  801c1c:	49 bb 93 9b 00 00 00 	movabs $0x9b93,%r11
+  801c23:	00 00 00 
+  801c26:	4c 01 d8             	add    %r11,%rax
+  801c29:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c2d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c31:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801c35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c39:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801c3d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c42:	74 3d                	je     801c81 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801c44:	eb 1d                	jmp    801c63 <strlcpy+0x56>
+			*dst++ = *src++;
+  801c46:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801c4a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801c4e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801c52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c56:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c5a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c5e:	0f b6 12             	movzbl (%rdx),%edx
+  801c61:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801c63:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801c68:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801c6d:	74 0b                	je     801c7a <strlcpy+0x6d>
+  801c6f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c73:	0f b6 00             	movzbl (%rax),%eax
+  801c76:	84 c0                	test   %al,%al
+  801c78:	75 cc                	jne    801c46 <strlcpy+0x39>
+		*dst = '\0';
+  801c7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c7e:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801c81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c85:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801c89:	c9                   	leave
+  801c8a:	c3                   	ret
+
+0000000000801c8b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801c8b:	55                   	push   %rbp
+  801c8c:	48 89 e5             	mov    %rsp,%rbp
+  801c8f:	48 83 ec 10          	sub    $0x10,%rsp
+  801c93:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c93 <strcmp+0x8>
+  801c9a:	49 bb 15 9b 00 00 00 	movabs $0x9b15,%r11
+  801ca1:	00 00 00 
+  801ca4:	4c 01 d8             	add    %r11,%rax
+  801ca7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801cab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801caf:	eb 0a                	jmp    801cbb <strcmp+0x30>
+		p++, q++;
+  801cb1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801cb6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801cbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cbf:	0f b6 00             	movzbl (%rax),%eax
+  801cc2:	84 c0                	test   %al,%al
+  801cc4:	74 12                	je     801cd8 <strcmp+0x4d>
+  801cc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cca:	0f b6 10             	movzbl (%rax),%edx
+  801ccd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cd1:	0f b6 00             	movzbl (%rax),%eax
+  801cd4:	38 c2                	cmp    %al,%dl
+  801cd6:	74 d9                	je     801cb1 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801cd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cdc:	0f b6 00             	movzbl (%rax),%eax
+  801cdf:	0f b6 d0             	movzbl %al,%edx
+  801ce2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce6:	0f b6 00             	movzbl (%rax),%eax
+  801ce9:	0f b6 c0             	movzbl %al,%eax
+  801cec:	29 c2                	sub    %eax,%edx
+  801cee:	89 d0                	mov    %edx,%eax
+}
+  801cf0:	c9                   	leave
+  801cf1:	c3                   	ret
+
+0000000000801cf2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801cf2:	55                   	push   %rbp
+  801cf3:	48 89 e5             	mov    %rsp,%rbp
+  801cf6:	48 83 ec 18          	sub    $0x18,%rsp
+  801cfa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801cfa <strncmp+0x8>
+  801d01:	49 bb ae 9a 00 00 00 	movabs $0x9aae,%r11
+  801d08:	00 00 00 
+  801d0b:	4c 01 d8             	add    %r11,%rax
+  801d0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d12:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d16:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801d1a:	eb 0f                	jmp    801d2b <strncmp+0x39>
+		n--, p++, q++;
+  801d1c:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801d21:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801d26:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801d2b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d30:	74 1d                	je     801d4f <strncmp+0x5d>
+  801d32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d36:	0f b6 00             	movzbl (%rax),%eax
+  801d39:	84 c0                	test   %al,%al
+  801d3b:	74 12                	je     801d4f <strncmp+0x5d>
+  801d3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d41:	0f b6 10             	movzbl (%rax),%edx
+  801d44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d48:	0f b6 00             	movzbl (%rax),%eax
+  801d4b:	38 c2                	cmp    %al,%dl
+  801d4d:	74 cd                	je     801d1c <strncmp+0x2a>
+	if (n == 0)
+  801d4f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d54:	75 07                	jne    801d5d <strncmp+0x6b>
+		return 0;
+  801d56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5b:	eb 16                	jmp    801d73 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801d5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d61:	0f b6 00             	movzbl (%rax),%eax
+  801d64:	0f b6 d0             	movzbl %al,%edx
+  801d67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d6b:	0f b6 00             	movzbl (%rax),%eax
+  801d6e:	0f b6 c0             	movzbl %al,%eax
+  801d71:	29 c2                	sub    %eax,%edx
+}
+  801d73:	89 d0                	mov    %edx,%eax
+  801d75:	c9                   	leave
+  801d76:	c3                   	ret
+
+0000000000801d77 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801d77:	55                   	push   %rbp
+  801d78:	48 89 e5             	mov    %rsp,%rbp
+  801d7b:	48 83 ec 10          	sub    $0x10,%rsp
+  801d7f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d7f <strchr+0x8>
+  801d86:	49 bb 29 9a 00 00 00 	movabs $0x9a29,%r11
+  801d8d:	00 00 00 
+  801d90:	4c 01 d8             	add    %r11,%rax
+  801d93:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d97:	89 f0                	mov    %esi,%eax
+  801d99:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801d9c:	eb 17                	jmp    801db5 <strchr+0x3e>
+		if (*s == c)
+  801d9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801da2:	0f b6 00             	movzbl (%rax),%eax
+  801da5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801da8:	75 06                	jne    801db0 <strchr+0x39>
+			return (char *) s;
+  801daa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dae:	eb 15                	jmp    801dc5 <strchr+0x4e>
+	for (; *s; s++)
+  801db0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801db5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801db9:	0f b6 00             	movzbl (%rax),%eax
+  801dbc:	84 c0                	test   %al,%al
+  801dbe:	75 de                	jne    801d9e <strchr+0x27>
+	return 0;
+  801dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dc5:	c9                   	leave
+  801dc6:	c3                   	ret
+
+0000000000801dc7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801dc7:	55                   	push   %rbp
+  801dc8:	48 89 e5             	mov    %rsp,%rbp
+  801dcb:	48 83 ec 10          	sub    $0x10,%rsp
+  801dcf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dcf <strfind+0x8>
+  801dd6:	49 bb d9 99 00 00 00 	movabs $0x99d9,%r11
+  801ddd:	00 00 00 
+  801de0:	4c 01 d8             	add    %r11,%rax
+  801de3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801de7:	89 f0                	mov    %esi,%eax
+  801de9:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801dec:	eb 11                	jmp    801dff <strfind+0x38>
+		if (*s == c)
+  801dee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801df2:	0f b6 00             	movzbl (%rax),%eax
+  801df5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801df8:	74 12                	je     801e0c <strfind+0x45>
+	for (; *s; s++)
+  801dfa:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801dff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e03:	0f b6 00             	movzbl (%rax),%eax
+  801e06:	84 c0                	test   %al,%al
+  801e08:	75 e4                	jne    801dee <strfind+0x27>
+  801e0a:	eb 01                	jmp    801e0d <strfind+0x46>
+			break;
+  801e0c:	90                   	nop
+	return (char *) s;
+  801e0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801e11:	c9                   	leave
+  801e12:	c3                   	ret
+
+0000000000801e13 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801e13:	55                   	push   %rbp
+  801e14:	48 89 e5             	mov    %rsp,%rbp
+  801e17:	48 83 ec 18          	sub    $0x18,%rsp
+  801e1b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e1b <memset+0x8>
+  801e22:	49 bb 8d 99 00 00 00 	movabs $0x998d,%r11
+  801e29:	00 00 00 
+  801e2c:	4c 01 d8             	add    %r11,%rax
+  801e2f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e33:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801e36:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801e3a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e3f:	75 06                	jne    801e47 <memset+0x34>
+		return v;
+  801e41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e45:	eb 69                	jmp    801eb0 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801e47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e4b:	83 e0 03             	and    $0x3,%eax
+  801e4e:	48 85 c0             	test   %rax,%rax
+  801e51:	75 48                	jne    801e9b <memset+0x88>
+  801e53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e57:	83 e0 03             	and    $0x3,%eax
+  801e5a:	48 85 c0             	test   %rax,%rax
+  801e5d:	75 3c                	jne    801e9b <memset+0x88>
+		c &= 0xFF;
+  801e5f:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801e66:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e69:	c1 e0 18             	shl    $0x18,%eax
+  801e6c:	89 c2                	mov    %eax,%edx
+  801e6e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e71:	c1 e0 10             	shl    $0x10,%eax
+  801e74:	09 c2                	or     %eax,%edx
+  801e76:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e79:	c1 e0 08             	shl    $0x8,%eax
+  801e7c:	09 d0                	or     %edx,%eax
+  801e7e:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801e81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e85:	48 c1 e8 02          	shr    $0x2,%rax
+  801e89:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801e8c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e90:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801e93:	48 89 d7             	mov    %rdx,%rdi
+  801e96:	fc                   	cld
+  801e97:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801e99:	eb 11                	jmp    801eac <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801e9b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e9f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ea2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801ea6:	48 89 d7             	mov    %rdx,%rdi
+  801ea9:	fc                   	cld
+  801eaa:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801eac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801eb0:	c9                   	leave
+  801eb1:	c3                   	ret
+
+0000000000801eb2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801eb2:	55                   	push   %rbp
+  801eb3:	48 89 e5             	mov    %rsp,%rbp
+  801eb6:	48 83 ec 28          	sub    $0x28,%rsp
+  801eba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801eba <memmove+0x8>
+  801ec1:	49 bb ee 98 00 00 00 	movabs $0x98ee,%r11
+  801ec8:	00 00 00 
+  801ecb:	4c 01 d8             	add    %r11,%rax
+  801ece:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ed2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801ed6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801eda:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ede:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801ee2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ee6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801eea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801eee:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801ef2:	0f 83 88 00 00 00    	jae    801f80 <memmove+0xce>
+  801ef8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801efc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f00:	48 01 d0             	add    %rdx,%rax
+  801f03:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801f07:	73 77                	jae    801f80 <memmove+0xce>
+		s += n;
+  801f09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f0d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801f11:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f15:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801f19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f1d:	83 e0 03             	and    $0x3,%eax
+  801f20:	48 85 c0             	test   %rax,%rax
+  801f23:	75 3b                	jne    801f60 <memmove+0xae>
+  801f25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f29:	83 e0 03             	and    $0x3,%eax
+  801f2c:	48 85 c0             	test   %rax,%rax
+  801f2f:	75 2f                	jne    801f60 <memmove+0xae>
+  801f31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f35:	83 e0 03             	and    $0x3,%eax
+  801f38:	48 85 c0             	test   %rax,%rax
+  801f3b:	75 23                	jne    801f60 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801f3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f41:	48 83 e8 04          	sub    $0x4,%rax
+  801f45:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f49:	48 83 ea 04          	sub    $0x4,%rdx
+  801f4d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801f51:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801f55:	48 89 c7             	mov    %rax,%rdi
+  801f58:	48 89 d6             	mov    %rdx,%rsi
+  801f5b:	fd                   	std
+  801f5c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801f5e:	eb 1d                	jmp    801f7d <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801f60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f64:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f6c:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801f70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f74:	48 89 d7             	mov    %rdx,%rdi
+  801f77:	48 89 c1             	mov    %rax,%rcx
+  801f7a:	fd                   	std
+  801f7b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801f7d:	fc                   	cld
+  801f7e:	eb 57                	jmp    801fd7 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801f80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f84:	83 e0 03             	and    $0x3,%eax
+  801f87:	48 85 c0             	test   %rax,%rax
+  801f8a:	75 36                	jne    801fc2 <memmove+0x110>
+  801f8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f90:	83 e0 03             	and    $0x3,%eax
+  801f93:	48 85 c0             	test   %rax,%rax
+  801f96:	75 2a                	jne    801fc2 <memmove+0x110>
+  801f98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f9c:	83 e0 03             	and    $0x3,%eax
+  801f9f:	48 85 c0             	test   %rax,%rax
+  801fa2:	75 1e                	jne    801fc2 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801fa4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fa8:	48 c1 e8 02          	shr    $0x2,%rax
+  801fac:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801faf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fb3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801fb7:	48 89 c7             	mov    %rax,%rdi
+  801fba:	48 89 d6             	mov    %rdx,%rsi
+  801fbd:	fc                   	cld
+  801fbe:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801fc0:	eb 15                	jmp    801fd7 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801fc2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fc6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801fca:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801fce:	48 89 c7             	mov    %rax,%rdi
+  801fd1:	48 89 d6             	mov    %rdx,%rsi
+  801fd4:	fc                   	cld
+  801fd5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801fd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801fdb:	c9                   	leave
+  801fdc:	c3                   	ret
+
+0000000000801fdd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801fdd:	55                   	push   %rbp
+  801fde:	48 89 e5             	mov    %rsp,%rbp
+  801fe1:	48 83 ec 18          	sub    $0x18,%rsp
+  801fe5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fe5 <memcpy+0x8>
+  801fec:	49 bb c3 97 00 00 00 	movabs $0x97c3,%r11
+  801ff3:	00 00 00 
+  801ff6:	4c 01 d8             	add    %r11,%rax
+  801ff9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ffd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802001:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  802005:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802009:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80200d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802011:	48 89 cf             	mov    %rcx,%rdi
+  802014:	48 b9 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rcx
+  80201b:	ff ff ff 
+  80201e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802022:	ff d0                	call   *%rax
+}
+  802024:	c9                   	leave
+  802025:	c3                   	ret
+
+0000000000802026 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802026:	55                   	push   %rbp
+  802027:	48 89 e5             	mov    %rsp,%rbp
+  80202a:	48 83 ec 28          	sub    $0x28,%rsp
+  80202e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80202e <memcmp+0x8>
+  802035:	49 bb 7a 97 00 00 00 	movabs $0x977a,%r11
+  80203c:	00 00 00 
+  80203f:	4c 01 d8             	add    %r11,%rax
+  802042:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802046:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80204a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80204e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802052:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  802056:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80205a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80205e:	eb 34                	jmp    802094 <memcmp+0x6e>
+		if (*s1 != *s2)
+  802060:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802064:	0f b6 10             	movzbl (%rax),%edx
+  802067:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80206b:	0f b6 00             	movzbl (%rax),%eax
+  80206e:	38 c2                	cmp    %al,%dl
+  802070:	74 18                	je     80208a <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  802072:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802076:	0f b6 00             	movzbl (%rax),%eax
+  802079:	0f b6 d0             	movzbl %al,%edx
+  80207c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802080:	0f b6 00             	movzbl (%rax),%eax
+  802083:	0f b6 c0             	movzbl %al,%eax
+  802086:	29 c2                	sub    %eax,%edx
+  802088:	eb 20                	jmp    8020aa <memcmp+0x84>
+		s1++, s2++;
+  80208a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80208f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  802094:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802098:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80209c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8020a0:	48 85 c0             	test   %rax,%rax
+  8020a3:	75 bb                	jne    802060 <memcmp+0x3a>
+	}
+
+	return 0;
+  8020a5:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8020aa:	89 d0                	mov    %edx,%eax
+  8020ac:	c9                   	leave
+  8020ad:	c3                   	ret
+
+00000000008020ae <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8020ae:	55                   	push   %rbp
+  8020af:	48 89 e5             	mov    %rsp,%rbp
+  8020b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8020b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020b6 <memfind+0x8>
+  8020bd:	49 bb f2 96 00 00 00 	movabs $0x96f2,%r11
+  8020c4:	00 00 00 
+  8020c7:	4c 01 d8             	add    %r11,%rax
+  8020ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020ce:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8020d1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8020d5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020dd:	48 01 d0             	add    %rdx,%rax
+  8020e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8020e4:	eb 13                	jmp    8020f9 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8020e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020ea:	0f b6 00             	movzbl (%rax),%eax
+  8020ed:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8020f0:	38 d0                	cmp    %dl,%al
+  8020f2:	74 11                	je     802105 <memfind+0x57>
+	for (; s < ends; s++)
+  8020f4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8020f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020fd:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802101:	72 e3                	jb     8020e6 <memfind+0x38>
+  802103:	eb 01                	jmp    802106 <memfind+0x58>
+			break;
+  802105:	90                   	nop
+	return (void *) s;
+  802106:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80210a:	c9                   	leave
+  80210b:	c3                   	ret
+
+000000000080210c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80210c:	55                   	push   %rbp
+  80210d:	48 89 e5             	mov    %rsp,%rbp
+  802110:	48 83 ec 38          	sub    $0x38,%rsp
+  802114:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802114 <strtol+0x8>
+  80211b:	49 bb 94 96 00 00 00 	movabs $0x9694,%r11
+  802122:	00 00 00 
+  802125:	4c 01 d8             	add    %r11,%rax
+  802128:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80212c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802130:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  802133:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80213a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802141:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  802142:	eb 05                	jmp    802149 <strtol+0x3d>
+		s++;
+  802144:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  802149:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80214d:	0f b6 00             	movzbl (%rax),%eax
+  802150:	3c 20                	cmp    $0x20,%al
+  802152:	74 f0                	je     802144 <strtol+0x38>
+  802154:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802158:	0f b6 00             	movzbl (%rax),%eax
+  80215b:	3c 09                	cmp    $0x9,%al
+  80215d:	74 e5                	je     802144 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  80215f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802163:	0f b6 00             	movzbl (%rax),%eax
+  802166:	3c 2b                	cmp    $0x2b,%al
+  802168:	75 07                	jne    802171 <strtol+0x65>
+		s++;
+  80216a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80216f:	eb 17                	jmp    802188 <strtol+0x7c>
+	else if (*s == '-')
+  802171:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802175:	0f b6 00             	movzbl (%rax),%eax
+  802178:	3c 2d                	cmp    $0x2d,%al
+  80217a:	75 0c                	jne    802188 <strtol+0x7c>
+		s++, neg = 1;
+  80217c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802181:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802188:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80218c:	74 06                	je     802194 <strtol+0x88>
+  80218e:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802192:	75 28                	jne    8021bc <strtol+0xb0>
+  802194:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802198:	0f b6 00             	movzbl (%rax),%eax
+  80219b:	3c 30                	cmp    $0x30,%al
+  80219d:	75 1d                	jne    8021bc <strtol+0xb0>
+  80219f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021a3:	48 83 c0 01          	add    $0x1,%rax
+  8021a7:	0f b6 00             	movzbl (%rax),%eax
+  8021aa:	3c 78                	cmp    $0x78,%al
+  8021ac:	75 0e                	jne    8021bc <strtol+0xb0>
+		s += 2, base = 16;
+  8021ae:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8021b3:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8021ba:	eb 2c                	jmp    8021e8 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  8021bc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021c0:	75 19                	jne    8021db <strtol+0xcf>
+  8021c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021c6:	0f b6 00             	movzbl (%rax),%eax
+  8021c9:	3c 30                	cmp    $0x30,%al
+  8021cb:	75 0e                	jne    8021db <strtol+0xcf>
+		s++, base = 8;
+  8021cd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021d2:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8021d9:	eb 0d                	jmp    8021e8 <strtol+0xdc>
+	else if (base == 0)
+  8021db:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021df:	75 07                	jne    8021e8 <strtol+0xdc>
+		base = 10;
+  8021e1:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8021e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ec:	0f b6 00             	movzbl (%rax),%eax
+  8021ef:	3c 2f                	cmp    $0x2f,%al
+  8021f1:	7e 1d                	jle    802210 <strtol+0x104>
+  8021f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021f7:	0f b6 00             	movzbl (%rax),%eax
+  8021fa:	3c 39                	cmp    $0x39,%al
+  8021fc:	7f 12                	jg     802210 <strtol+0x104>
+			dig = *s - '0';
+  8021fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802202:	0f b6 00             	movzbl (%rax),%eax
+  802205:	0f be c0             	movsbl %al,%eax
+  802208:	83 e8 30             	sub    $0x30,%eax
+  80220b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80220e:	eb 4e                	jmp    80225e <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  802210:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802214:	0f b6 00             	movzbl (%rax),%eax
+  802217:	3c 60                	cmp    $0x60,%al
+  802219:	7e 1d                	jle    802238 <strtol+0x12c>
+  80221b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80221f:	0f b6 00             	movzbl (%rax),%eax
+  802222:	3c 7a                	cmp    $0x7a,%al
+  802224:	7f 12                	jg     802238 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  802226:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80222a:	0f b6 00             	movzbl (%rax),%eax
+  80222d:	0f be c0             	movsbl %al,%eax
+  802230:	83 e8 57             	sub    $0x57,%eax
+  802233:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802236:	eb 26                	jmp    80225e <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  802238:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80223c:	0f b6 00             	movzbl (%rax),%eax
+  80223f:	3c 40                	cmp    $0x40,%al
+  802241:	7e 47                	jle    80228a <strtol+0x17e>
+  802243:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802247:	0f b6 00             	movzbl (%rax),%eax
+  80224a:	3c 5a                	cmp    $0x5a,%al
+  80224c:	7f 3c                	jg     80228a <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  80224e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802252:	0f b6 00             	movzbl (%rax),%eax
+  802255:	0f be c0             	movsbl %al,%eax
+  802258:	83 e8 37             	sub    $0x37,%eax
+  80225b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80225e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802261:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802264:	7d 23                	jge    802289 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  802266:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80226b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80226e:	48 98                	cltq
+  802270:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802275:	48 89 c2             	mov    %rax,%rdx
+  802278:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80227b:	48 98                	cltq
+  80227d:	48 01 d0             	add    %rdx,%rax
+  802280:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  802284:	e9 5f ff ff ff       	jmp    8021e8 <strtol+0xdc>
+			break;
+  802289:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80228a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80228f:	74 0b                	je     80229c <strtol+0x190>
+		*endptr = (char *) s;
+  802291:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802295:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802299:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  80229c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8022a0:	74 09                	je     8022ab <strtol+0x19f>
+  8022a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022a6:	48 f7 d8             	neg    %rax
+  8022a9:	eb 04                	jmp    8022af <strtol+0x1a3>
+  8022ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8022af:	c9                   	leave
+  8022b0:	c3                   	ret
+
+00000000008022b1 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  8022b1:	55                   	push   %rbp
+  8022b2:	48 89 e5             	mov    %rsp,%rbp
+  8022b5:	53                   	push   %rbx
+  8022b6:	48 83 ec 30          	sub    $0x30,%rsp
+  8022ba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8022ba <strstr+0x9>
+  8022c1:	49 bb ee 94 00 00 00 	movabs $0x94ee,%r11
+  8022c8:	00 00 00 
+  8022cb:	4c 01 db             	add    %r11,%rbx
+  8022ce:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  8022d2:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  8022d6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022da:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8022de:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8022e2:	0f b6 00             	movzbl (%rax),%eax
+  8022e5:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  8022e8:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  8022ec:	75 06                	jne    8022f4 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  8022ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022f2:	eb 73                	jmp    802367 <strstr+0xb6>
+
+	len = strlen(str);
+  8022f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022f8:	48 89 c7             	mov    %rax,%rdi
+  8022fb:	48 b8 96 62 ff ff ff 	movabs $0xffffffffffff6296,%rax
+  802302:	ff ff ff 
+  802305:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802309:	ff d0                	call   *%rax
+  80230b:	48 98                	cltq
+  80230d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  802311:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802315:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802319:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80231d:	0f b6 00             	movzbl (%rax),%eax
+  802320:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  802323:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  802327:	75 07                	jne    802330 <strstr+0x7f>
+				return (char *) 0;
+  802329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232e:	eb 37                	jmp    802367 <strstr+0xb6>
+		} while (sc != c);
+  802330:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  802334:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  802337:	75 d8                	jne    802311 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  802339:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80233d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802341:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802345:	48 89 ce             	mov    %rcx,%rsi
+  802348:	48 89 c7             	mov    %rax,%rdi
+  80234b:	48 b8 4a 65 ff ff ff 	movabs $0xffffffffffff654a,%rax
+  802352:	ff ff ff 
+  802355:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802359:	ff d0                	call   *%rax
+  80235b:	85 c0                	test   %eax,%eax
+  80235d:	75 b2                	jne    802311 <strstr+0x60>
+
+	return (char *) (in - 1);
+  80235f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802363:	48 83 e8 01          	sub    $0x1,%rax
+}
+  802367:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80236b:	c9                   	leave
+  80236c:	c3                   	ret
+
+000000000080236d <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  80236d:	55                   	push   %rbp
+  80236e:	48 89 e5             	mov    %rsp,%rbp
+  802371:	41 57                	push   %r15
+  802373:	53                   	push   %rbx
+  802374:	48 83 ec 40          	sub    $0x40,%rsp
+  802378:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 802378 <syscall+0xb>
+  80237f:	49 bb 30 94 00 00 00 	movabs $0x9430,%r11
+  802386:	00 00 00 
+  802389:	4d 01 da             	add    %r11,%r10
+  80238c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80238f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  802392:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  802396:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80239a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80239e:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  8023a2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8023a5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8023a9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8023ad:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8023b1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8023b5:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8023b9:	4c 89 c3             	mov    %r8,%rbx
+  8023bc:	cd 30                	int    $0x30
+  8023be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  8023c2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8023c6:	74 52                	je     80241a <syscall+0xad>
+  8023c8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8023cd:	7e 4b                	jle    80241a <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8023cf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8023d3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8023d6:	49 89 d0             	mov    %rdx,%r8
+  8023d9:	89 c1                	mov    %eax,%ecx
+  8023db:	48 b8 e0 c3 ff ff ff 	movabs $0xffffffffffffc3e0,%rax
+  8023e2:	ff ff ff 
+  8023e5:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8023e9:	48 89 c2             	mov    %rax,%rdx
+  8023ec:	be 23 00 00 00       	mov    $0x23,%esi
+  8023f1:	48 b8 fd c3 ff ff ff 	movabs $0xffffffffffffc3fd,%rax
+  8023f8:	ff ff ff 
+  8023fb:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8023ff:	48 89 c7             	mov    %rax,%rdi
+  802402:	4d 89 d7             	mov    %r10,%r15
+  802405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240a:	49 b9 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r9
+  802411:	ff ff ff 
+  802414:	4d 01 d1             	add    %r10,%r9
+  802417:	41 ff d1             	call   *%r9
+
+	return ret;
+  80241a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80241e:	48 83 c4 40          	add    $0x40,%rsp
+  802422:	5b                   	pop    %rbx
+  802423:	41 5f                	pop    %r15
+  802425:	5d                   	pop    %rbp
+  802426:	c3                   	ret
+
+0000000000802427 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  802427:	55                   	push   %rbp
+  802428:	48 89 e5             	mov    %rsp,%rbp
+  80242b:	41 57                	push   %r15
+  80242d:	41 56                	push   %r14
+  80242f:	41 55                	push   %r13
+  802431:	41 54                	push   %r12
+  802433:	53                   	push   %rbx
+  802434:	48 83 ec 48          	sub    $0x48,%rsp
+  802438:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 802438 <syscall_words+0x11>
+  80243f:	49 bb 70 93 00 00 00 	movabs $0x9370,%r11
+  802446:	00 00 00 
+  802449:	4d 01 de             	add    %r11,%r14
+  80244c:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80244f:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  802452:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802456:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80245a:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  80245e:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  802462:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802467:	74 09                	je     802472 <syscall_words+0x4b>
+  802469:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80246d:	48 8b 00             	mov    (%rax),%rax
+  802470:	eb 05                	jmp    802477 <syscall_words+0x50>
+  802472:	b8 00 00 00 00       	mov    $0x0,%eax
+  802477:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  80247a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80247f:	74 0a                	je     80248b <syscall_words+0x64>
+  802481:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802485:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802489:	eb 05                	jmp    802490 <syscall_words+0x69>
+  80248b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802490:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  802493:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802498:	74 0a                	je     8024a4 <syscall_words+0x7d>
+  80249a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80249e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8024a2:	eb 05                	jmp    8024a9 <syscall_words+0x82>
+  8024a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a9:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8024ac:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8024b1:	74 0a                	je     8024bd <syscall_words+0x96>
+  8024b3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8024b7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8024bb:	eb 05                	jmp    8024c2 <syscall_words+0x9b>
+  8024bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c2:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  8024c5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8024ca:	74 0a                	je     8024d6 <syscall_words+0xaf>
+  8024cc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8024d0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8024d4:	eb 05                	jmp    8024db <syscall_words+0xb4>
+  8024d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024db:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  8024de:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8024e3:	74 0a                	je     8024ef <syscall_words+0xc8>
+  8024e5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8024e9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8024ed:	eb 05                	jmp    8024f4 <syscall_words+0xcd>
+  8024ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f4:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  8024f7:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8024fa:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8024fe:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802502:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802506:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80250a:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80250e:	cd 30                	int    $0x30
+  802510:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802514:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802519:	74 50                	je     80256b <syscall_words+0x144>
+		words[0] = r8;
+  80251b:	4c 89 c2             	mov    %r8,%rdx
+  80251e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802522:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802525:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802529:	48 83 c0 08          	add    $0x8,%rax
+  80252d:	4c 89 ca             	mov    %r9,%rdx
+  802530:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802533:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802537:	48 83 c0 10          	add    $0x10,%rax
+  80253b:	4c 89 d2             	mov    %r10,%rdx
+  80253e:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  802541:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802545:	48 83 c0 18          	add    $0x18,%rax
+  802549:	4c 89 da             	mov    %r11,%rdx
+  80254c:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80254f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802553:	48 83 c0 20          	add    $0x20,%rax
+  802557:	4c 89 e2             	mov    %r12,%rdx
+  80255a:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80255d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802561:	48 83 c0 28          	add    $0x28,%rax
+  802565:	4c 89 ea             	mov    %r13,%rdx
+  802568:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  80256b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80256f:	74 52                	je     8025c3 <syscall_words+0x19c>
+  802571:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802576:	7e 4b                	jle    8025c3 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802578:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80257c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80257f:	49 89 d0             	mov    %rdx,%r8
+  802582:	89 c1                	mov    %eax,%ecx
+  802584:	48 b8 e0 c3 ff ff ff 	movabs $0xffffffffffffc3e0,%rax
+  80258b:	ff ff ff 
+  80258e:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802592:	48 89 c2             	mov    %rax,%rdx
+  802595:	be 4e 00 00 00       	mov    $0x4e,%esi
+  80259a:	48 b8 fd c3 ff ff ff 	movabs $0xffffffffffffc3fd,%rax
+  8025a1:	ff ff ff 
+  8025a4:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8025a8:	48 89 c7             	mov    %rax,%rdi
+  8025ab:	4d 89 f7             	mov    %r14,%r15
+  8025ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b3:	49 b9 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r9
+  8025ba:	ff ff ff 
+  8025bd:	4d 01 f1             	add    %r14,%r9
+  8025c0:	41 ff d1             	call   *%r9
+
+	return ret;
+  8025c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8025c7:	48 83 c4 48          	add    $0x48,%rsp
+  8025cb:	5b                   	pop    %rbx
+  8025cc:	41 5c                	pop    %r12
+  8025ce:	41 5d                	pop    %r13
+  8025d0:	41 5e                	pop    %r14
+  8025d2:	41 5f                	pop    %r15
+  8025d4:	5d                   	pop    %rbp
+  8025d5:	c3                   	ret
+
+00000000008025d6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8025d6:	55                   	push   %rbp
+  8025d7:	48 89 e5             	mov    %rsp,%rbp
+  8025da:	48 83 ec 10          	sub    $0x10,%rsp
+  8025de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025de <sys_cputs+0x8>
+  8025e5:	49 bb ca 91 00 00 00 	movabs $0x91ca,%r11
+  8025ec:	00 00 00 
+  8025ef:	4c 01 d8             	add    %r11,%rax
+  8025f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8025fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025fe:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802602:	48 83 ec 08          	sub    $0x8,%rsp
+  802606:	6a 00                	push   $0x0
+  802608:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80260e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802614:	be 00 00 00 00       	mov    $0x0,%esi
+  802619:	bf 00 00 00 00       	mov    $0x0,%edi
+  80261e:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802625:	ff ff ff 
+  802628:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80262c:	ff d0                	call   *%rax
+  80262e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802632:	90                   	nop
+  802633:	c9                   	leave
+  802634:	c3                   	ret
+
+0000000000802635 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802635:	55                   	push   %rbp
+  802636:	48 89 e5             	mov    %rsp,%rbp
+  802639:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802639 <sys_cgetc+0x4>
+  802640:	49 bb 6f 91 00 00 00 	movabs $0x916f,%r11
+  802647:	00 00 00 
+  80264a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80264d:	48 83 ec 08          	sub    $0x8,%rsp
+  802651:	6a 00                	push   $0x0
+  802653:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802659:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80265f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802664:	ba 00 00 00 00       	mov    $0x0,%edx
+  802669:	be 00 00 00 00       	mov    $0x0,%esi
+  80266e:	bf 01 00 00 00       	mov    $0x1,%edi
+  802673:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  80267a:	ff ff ff 
+  80267d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802681:	ff d0                	call   *%rax
+  802683:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802687:	c9                   	leave
+  802688:	c3                   	ret
+
+0000000000802689 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802689:	55                   	push   %rbp
+  80268a:	48 89 e5             	mov    %rsp,%rbp
+  80268d:	48 83 ec 10          	sub    $0x10,%rsp
+  802691:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802691 <sys_env_destroy+0x8>
+  802698:	49 bb 17 91 00 00 00 	movabs $0x9117,%r11
+  80269f:	00 00 00 
+  8026a2:	4c 01 d8             	add    %r11,%rax
+  8026a5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8026a8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026ab:	48 63 d2             	movslq %edx,%rdx
+  8026ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b2:	6a 00                	push   $0x0
+  8026b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8026ca:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026cf:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  8026d6:	ff ff ff 
+  8026d9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026dd:	ff d0                	call   *%rax
+  8026df:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026e3:	c9                   	leave
+  8026e4:	c3                   	ret
+
+00000000008026e5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8026e5:	55                   	push   %rbp
+  8026e6:	48 89 e5             	mov    %rsp,%rbp
+  8026e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026e9 <sys_getenvid+0x4>
+  8026f0:	49 bb bf 90 00 00 00 	movabs $0x90bf,%r11
+  8026f7:	00 00 00 
+  8026fa:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8026fd:	48 83 ec 08          	sub    $0x8,%rsp
+  802701:	6a 00                	push   $0x0
+  802703:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802709:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80270f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802714:	ba 00 00 00 00       	mov    $0x0,%edx
+  802719:	be 00 00 00 00       	mov    $0x0,%esi
+  80271e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802723:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  80272a:	ff ff ff 
+  80272d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802731:	ff d0                	call   *%rax
+  802733:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802737:	c9                   	leave
+  802738:	c3                   	ret
+
+0000000000802739 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802739:	55                   	push   %rbp
+  80273a:	48 89 e5             	mov    %rsp,%rbp
+  80273d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80273d <sys_yield+0x4>
+  802744:	49 bb 6b 90 00 00 00 	movabs $0x906b,%r11
+  80274b:	00 00 00 
+  80274e:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802751:	48 83 ec 08          	sub    $0x8,%rsp
+  802755:	6a 00                	push   $0x0
+  802757:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80275d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802763:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802768:	ba 00 00 00 00       	mov    $0x0,%edx
+  80276d:	be 00 00 00 00       	mov    $0x0,%esi
+  802772:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802777:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  80277e:	ff ff ff 
+  802781:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802785:	ff d0                	call   *%rax
+  802787:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80278b:	90                   	nop
+  80278c:	c9                   	leave
+  80278d:	c3                   	ret
+
+000000000080278e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80278e:	55                   	push   %rbp
+  80278f:	48 89 e5             	mov    %rsp,%rbp
+  802792:	48 83 ec 10          	sub    $0x10,%rsp
+  802796:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802796 <sys_page_alloc+0x8>
+  80279d:	49 bb 12 90 00 00 00 	movabs $0x9012,%r11
+  8027a4:	00 00 00 
+  8027a7:	4c 01 d8             	add    %r11,%rax
+  8027aa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027b1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8027b4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027b7:	48 63 f2             	movslq %edx,%rsi
+  8027ba:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027c1:	48 63 d2             	movslq %edx,%rdx
+  8027c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c8:	6a 00                	push   $0x0
+  8027ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027d0:	49 89 f0             	mov    %rsi,%r8
+  8027d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8027d8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8027dd:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  8027e4:	ff ff ff 
+  8027e7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027eb:	ff d0                	call   *%rax
+  8027ed:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027f1:	c9                   	leave
+  8027f2:	c3                   	ret
+
+00000000008027f3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8027f3:	55                   	push   %rbp
+  8027f4:	48 89 e5             	mov    %rsp,%rbp
+  8027f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8027fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027fb <sys_page_map+0x8>
+  802802:	49 bb ad 8f 00 00 00 	movabs $0x8fad,%r11
+  802809:	00 00 00 
+  80280c:	4c 01 d8             	add    %r11,%rax
+  80280f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802812:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802816:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802819:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80281d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802821:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802824:	48 63 f2             	movslq %edx,%rsi
+  802827:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80282b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80282e:	48 63 fa             	movslq %edx,%rdi
+  802831:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802835:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802838:	48 63 d2             	movslq %edx,%rdx
+  80283b:	48 83 ec 08          	sub    $0x8,%rsp
+  80283f:	56                   	push   %rsi
+  802840:	4d 89 c1             	mov    %r8,%r9
+  802843:	49 89 f8             	mov    %rdi,%r8
+  802846:	be 01 00 00 00       	mov    $0x1,%esi
+  80284b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802850:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802857:	ff ff ff 
+  80285a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80285e:	ff d0                	call   *%rax
+  802860:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802864:	c9                   	leave
+  802865:	c3                   	ret
+
+0000000000802866 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802866:	55                   	push   %rbp
+  802867:	48 89 e5             	mov    %rsp,%rbp
+  80286a:	48 83 ec 10          	sub    $0x10,%rsp
+  80286e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80286e <sys_page_unmap+0x8>
+  802875:	49 bb 3a 8f 00 00 00 	movabs $0x8f3a,%r11
+  80287c:	00 00 00 
+  80287f:	4c 01 d8             	add    %r11,%rax
+  802882:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802885:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802889:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80288d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802890:	48 63 d2             	movslq %edx,%rdx
+  802893:	48 83 ec 08          	sub    $0x8,%rsp
+  802897:	6a 00                	push   $0x0
+  802899:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80289f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8028aa:	bf 06 00 00 00       	mov    $0x6,%edi
+  8028af:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  8028b6:	ff ff ff 
+  8028b9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028bd:	ff d0                	call   *%rax
+  8028bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028c3:	c9                   	leave
+  8028c4:	c3                   	ret
+
+00000000008028c5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8028c5:	55                   	push   %rbp
+  8028c6:	48 89 e5             	mov    %rsp,%rbp
+  8028c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8028cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028cd <sys_env_set_status+0x8>
+  8028d4:	49 bb db 8e 00 00 00 	movabs $0x8edb,%r11
+  8028db:	00 00 00 
+  8028de:	4c 01 d8             	add    %r11,%rax
+  8028e1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028e4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8028e7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8028ea:	48 63 ca             	movslq %edx,%rcx
+  8028ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8028f0:	48 63 d2             	movslq %edx,%rdx
+  8028f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f7:	6a 00                	push   $0x0
+  8028f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802905:	be 01 00 00 00       	mov    $0x1,%esi
+  80290a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80290f:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802916:	ff ff ff 
+  802919:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80291d:	ff d0                	call   *%rax
+  80291f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+
+0000000000802925 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802925:	55                   	push   %rbp
+  802926:	48 89 e5             	mov    %rsp,%rbp
+  802929:	48 83 ec 10          	sub    $0x10,%rsp
+  80292d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80292d <sys_env_set_trapframe+0x8>
+  802934:	49 bb 7b 8e 00 00 00 	movabs $0x8e7b,%r11
+  80293b:	00 00 00 
+  80293e:	4c 01 d8             	add    %r11,%rax
+  802941:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802944:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802948:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80294c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80294f:	48 63 d2             	movslq %edx,%rdx
+  802952:	48 83 ec 08          	sub    $0x8,%rsp
+  802956:	6a 00                	push   $0x0
+  802958:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80295e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802964:	be 01 00 00 00       	mov    $0x1,%esi
+  802969:	bf 09 00 00 00       	mov    $0x9,%edi
+  80296e:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802975:	ff ff ff 
+  802978:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80297c:	ff d0                	call   *%rax
+  80297e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802982:	c9                   	leave
+  802983:	c3                   	ret
+
+0000000000802984 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802984:	55                   	push   %rbp
+  802985:	48 89 e5             	mov    %rsp,%rbp
+  802988:	48 83 ec 10          	sub    $0x10,%rsp
+  80298c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80298c <sys_env_set_pgfault_upcall+0x8>
+  802993:	49 bb 1c 8e 00 00 00 	movabs $0x8e1c,%r11
+  80299a:	00 00 00 
+  80299d:	4c 01 d8             	add    %r11,%rax
+  8029a0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8029a7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029ab:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029ae:	48 63 d2             	movslq %edx,%rdx
+  8029b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b5:	6a 00                	push   $0x0
+  8029b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8029c8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8029cd:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  8029d4:	ff ff ff 
+  8029d7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029db:	ff d0                	call   *%rax
+  8029dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e1:	c9                   	leave
+  8029e2:	c3                   	ret
+
+00000000008029e3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8029e3:	55                   	push   %rbp
+  8029e4:	48 89 e5             	mov    %rsp,%rbp
+  8029e7:	48 83 ec 20          	sub    $0x20,%rsp
+  8029eb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029eb <sys_ipc_try_send+0x8>
+  8029f2:	49 bb bd 8d 00 00 00 	movabs $0x8dbd,%r11
+  8029f9:	00 00 00 
+  8029fc:	4c 01 d8             	add    %r11,%rax
+  8029ff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a02:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a06:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802a0a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802a0d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802a10:	48 63 fa             	movslq %edx,%rdi
+  802a13:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802a17:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a1a:	48 63 d2             	movslq %edx,%rdx
+  802a1d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a21:	48 83 ec 08          	sub    $0x8,%rsp
+  802a25:	6a 00                	push   $0x0
+  802a27:	49 89 f9             	mov    %rdi,%r9
+  802a2a:	49 89 f0             	mov    %rsi,%r8
+  802a2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a32:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802a37:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802a3e:	ff ff ff 
+  802a41:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a45:	ff d0                	call   *%rax
+  802a47:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a4b:	c9                   	leave
+  802a4c:	c3                   	ret
+
+0000000000802a4d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802a4d:	55                   	push   %rbp
+  802a4e:	48 89 e5             	mov    %rsp,%rbp
+  802a51:	48 83 ec 20          	sub    $0x20,%rsp
+  802a55:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a55 <sys_ipc_send+0x8>
+  802a5c:	49 bb 53 8d 00 00 00 	movabs $0x8d53,%r11
+  802a63:	00 00 00 
+  802a66:	4c 01 d8             	add    %r11,%rax
+  802a69:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a70:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802a74:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802a77:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802a7a:	48 63 fa             	movslq %edx,%rdi
+  802a7d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802a81:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a84:	48 63 d2             	movslq %edx,%rdx
+  802a87:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a8b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a8f:	6a 00                	push   $0x0
+  802a91:	49 89 f9             	mov    %rdi,%r9
+  802a94:	49 89 f0             	mov    %rsi,%r8
+  802a97:	be 00 00 00 00       	mov    $0x0,%esi
+  802a9c:	bf 17 00 00 00       	mov    $0x17,%edi
+  802aa1:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802aa8:	ff ff ff 
+  802aab:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802aaf:	ff d0                	call   *%rax
+  802ab1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ab5:	c9                   	leave
+  802ab6:	c3                   	ret
+
+0000000000802ab7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802ab7:	55                   	push   %rbp
+  802ab8:	48 89 e5             	mov    %rsp,%rbp
+  802abb:	48 83 ec 10          	sub    $0x10,%rsp
+  802abf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802abf <sys_ipc_recv+0x8>
+  802ac6:	49 bb e9 8c 00 00 00 	movabs $0x8ce9,%r11
+  802acd:	00 00 00 
+  802ad0:	4c 01 d8             	add    %r11,%rax
+  802ad3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802ad7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802adb:	6a 00                	push   $0x0
+  802add:	6a 00                	push   $0x0
+  802adf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ae5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802af0:	be 01 00 00 00       	mov    $0x1,%esi
+  802af5:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802afa:	49 ba 7f 6c ff ff ff 	movabs $0xffffffffffff6c7f,%r10
+  802b01:	ff ff ff 
+  802b04:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b08:	ff d0                	call   *%rax
+  802b0a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b0e:	c9                   	leave
+  802b0f:	c3                   	ret
+
+0000000000802b10 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802b10:	55                   	push   %rbp
+  802b11:	48 89 e5             	mov    %rsp,%rbp
+  802b14:	48 83 ec 30          	sub    $0x30,%rsp
+  802b18:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b18 <sys_ipc_call+0x8>
+  802b1f:	49 bb 90 8c 00 00 00 	movabs $0x8c90,%r11
+  802b26:	00 00 00 
+  802b29:	4c 01 d8             	add    %r11,%rax
+  802b2c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b2f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b33:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802b37:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802b3a:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802b3e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802b42:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802b46:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802b49:	4c 63 c2             	movslq %edx,%r8
+  802b4c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802b50:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b53:	48 63 d2             	movslq %edx,%rdx
+  802b56:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802b5a:	ff 75 d8             	push   -0x28(%rbp)
+  802b5d:	56                   	push   %rsi
+  802b5e:	4d 89 c1             	mov    %r8,%r9
+  802b61:	49 89 f8             	mov    %rdi,%r8
+  802b64:	be 00 00 00 00       	mov    $0x0,%esi
+  802b69:	bf 18 00 00 00       	mov    $0x18,%edi
+  802b6e:	49 ba 7f 6c ff ff ff 	movabs $0xffffffffffff6c7f,%r10
+  802b75:	ff ff ff 
+  802b78:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b7c:	ff d0                	call   *%rax
+  802b7e:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+
+0000000000802b84 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802b84:	55                   	push   %rbp
+  802b85:	48 89 e5             	mov    %rsp,%rbp
+  802b88:	48 83 ec 30          	sub    $0x30,%rsp
+  802b8c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b8c <sys_ipc_reply_recv+0x8>
+  802b93:	49 bb 1c 8c 00 00 00 	movabs $0x8c1c,%r11
+  802b9a:	00 00 00 
+  802b9d:	4c 01 d8             	add    %r11,%rax
+  802ba0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802ba3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802ba7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802bab:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802bae:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802bb2:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802bb6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802bba:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802bbd:	4c 63 c2             	movslq %edx,%r8
+  802bc0:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802bc4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802bc7:	48 63 d2             	movslq %edx,%rdx
+  802bca:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802bce:	ff 75 d8             	push   -0x28(%rbp)
+  802bd1:	56                   	push   %rsi
+  802bd2:	4d 89 c1             	mov    %r8,%r9
+  802bd5:	49 89 f8             	mov    %rdi,%r8
+  802bd8:	be 00 00 00 00       	mov    $0x0,%esi
+  802bdd:	bf 19 00 00 00       	mov    $0x19,%edi
+  802be2:	49 ba 7f 6c ff ff ff 	movabs $0xffffffffffff6c7f,%r10
+  802be9:	ff ff ff 
+  802bec:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802bf0:	ff d0                	call   *%rax
+  802bf2:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802bf6:	c9                   	leave
+  802bf7:	c3                   	ret
+
+0000000000802bf8 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802bf8:	55                   	push   %rbp
+  802bf9:	48 89 e5             	mov    %rsp,%rbp
+  802bfc:	48 83 ec 10          	sub    $0x10,%rsp
+  802c00:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c00 <sys_env_set_priority+0x8>
+  802c07:	49 bb a8 8b 00 00 00 	movabs $0x8ba8,%r11
+  802c0e:	00 00 00 
+  802c11:	4c 01 d8             	add    %r11,%rax
+  802c14:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c17:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802c1a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802c1d:	48 63 ca             	movslq %edx,%rcx
+  802c20:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802c23:	48 63 d2             	movslq %edx,%rdx
+  802c26:	48 83 ec 08          	sub    $0x8,%rsp
+  802c2a:	6a 00                	push   $0x0
+  802c2c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c38:	be 01 00 00 00       	mov    $0x1,%esi
+  802c3d:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802c42:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802c49:	ff ff ff 
+  802c4c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c50:	ff d0                	call   *%rax
+  802c52:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c56:	c9                   	leave
+  802c57:	c3                   	ret
+
+0000000000802c58 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802c58:	55                   	push   %rbp
+  802c59:	48 89 e5             	mov    %rsp,%rbp
+  802c5c:	48 83 ec 10          	sub    $0x10,%rsp
+  802c60:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c60 <sys_env_set_affinity+0x8>
+  802c67:	49 bb 48 8b 00 00 00 	movabs $0x8b48,%r11
+  802c6e:	00 00 00 
+  802c71:	4c 01 d8             	add    %r11,%rax
+  802c74:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802c77:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802c7a:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802c7d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802c80:	48 63 d2             	movslq %edx,%rdx
+  802c83:	48 83 ec 08          	sub    $0x8,%rsp
+  802c87:	6a 00                	push   $0x0
+  802c89:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c95:	be 01 00 00 00       	mov    $0x1,%esi
+  802c9a:	bf 10 00 00 00       	mov    $0x10,%edi
+  802c9f:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802ca6:	ff ff ff 
+  802ca9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802cad:	ff d0                	call   *%rax
+  802caf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cb3:	c9                   	leave
+  802cb4:	c3                   	ret
+
+0000000000802cb5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802cb5:	55                   	push   %rbp
+  802cb6:	48 89 e5             	mov    %rsp,%rbp
+  802cb9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802cb9 <sys_time_msec+0x4>
+  802cc0:	49 bb ef 8a 00 00 00 	movabs $0x8aef,%r11
+  802cc7:	00 00 00 
+  802cca:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802ccd:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd1:	6a 00                	push   $0x0
+  802cd3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802cd9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cdf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ce4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce9:	be 00 00 00 00       	mov    $0x0,%esi
+  802cee:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802cf3:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802cfa:	ff ff ff 
+  802cfd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d01:	ff d0                	call   *%rax
+  802d03:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d07:	c9                   	leave
+  802d08:	c3                   	ret
+
+0000000000802d09 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802d09:	55                   	push   %rbp
+  802d0a:	48 89 e5             	mov    %rsp,%rbp
+  802d0d:	48 83 ec 10          	sub    $0x10,%rsp
+  802d11:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d11 <sys_sleep_usec+0x8>
+  802d18:	49 bb 97 8a 00 00 00 	movabs $0x8a97,%r11
+  802d1f:	00 00 00 
+  802d22:	4c 01 d8             	add    %r11,%rax
+  802d25:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802d29:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d2d:	48 83 ec 08          	sub    $0x8,%rsp
+  802d31:	6a 00                	push   $0x0
+  802d33:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d3f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d44:	be 00 00 00 00       	mov    $0x0,%esi
+  802d49:	bf 11 00 00 00       	mov    $0x11,%edi
+  802d4e:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802d55:	ff ff ff 
+  802d58:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d5c:	ff d0                	call   *%rax
+  802d5e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d62:	c9                   	leave
+  802d63:	c3                   	ret
+
+0000000000802d64 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802d64:	55                   	push   %rbp
+  802d65:	48 89 e5             	mov    %rsp,%rbp
+  802d68:	48 83 ec 10          	sub    $0x10,%rsp
+  802d6c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d6c <sys_page_alloc_huge+0x8>
+  802d73:	49 bb 3c 8a 00 00 00 	movabs $0x8a3c,%r11
+  802d7a:	00 00 00 
+  802d7d:	4c 01 d8             	add    %r11,%rax
+  802d80:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802d83:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d87:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802d8a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802d8d:	48 63 f2             	movslq %edx,%rsi
+  802d90:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802d94:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802d97:	48 63 d2             	movslq %edx,%rdx
+  802d9a:	48 83 ec 08          	sub    $0x8,%rsp
+  802d9e:	6a 00                	push   $0x0
+  802da0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802da6:	49 89 f0             	mov    %rsi,%r8
+  802da9:	be 01 00 00 00       	mov    $0x1,%esi
+  802dae:	bf 12 00 00 00       	mov    $0x12,%edi
+  802db3:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802dba:	ff ff ff 
+  802dbd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802dc1:	ff d0                	call   *%rax
+  802dc3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802dc7:	c9                   	leave
+  802dc8:	c3                   	ret
+
+0000000000802dc9 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802dc9:	55                   	push   %rbp
+  802dca:	48 89 e5             	mov    %rsp,%rbp
+  802dcd:	48 83 ec 10          	sub    $0x10,%rsp
+  802dd1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802dd1 <sys_page_map_batch+0x8>
+  802dd8:	49 bb d7 89 00 00 00 	movabs $0x89d7,%r11
+  802ddf:	00 00 00 
+  802de2:	4c 01 d8             	add    %r11,%rax
+  802de5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802de9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802ded:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802df1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802df5:	48 83 ec 08          	sub    $0x8,%rsp
+  802df9:	6a 00                	push   $0x0
+  802dfb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e01:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e07:	be 01 00 00 00       	mov    $0x1,%esi
+  802e0c:	bf 13 00 00 00       	mov    $0x13,%edi
+  802e11:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802e18:	ff ff ff 
+  802e1b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e1f:	ff d0                	call   *%rax
+  802e21:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e25:	c9                   	leave
+  802e26:	c3                   	ret
+
+0000000000802e27 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802e27:	55                   	push   %rbp
+  802e28:	48 89 e5             	mov    %rsp,%rbp
+  802e2b:	48 83 ec 10          	sub    $0x10,%rsp
+  802e2f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e2f <sys_page_alloc_batch+0x8>
+  802e36:	49 bb 79 89 00 00 00 	movabs $0x8979,%r11
+  802e3d:	00 00 00 
+  802e40:	4c 01 d8             	add    %r11,%rax
+  802e43:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e47:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802e4b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e4f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802e53:	48 83 ec 08          	sub    $0x8,%rsp
+  802e57:	6a 00                	push   $0x0
+  802e59:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e65:	be 01 00 00 00       	mov    $0x1,%esi
+  802e6a:	bf 14 00 00 00       	mov    $0x14,%edi
+  802e6f:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802e76:	ff ff ff 
+  802e79:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e7d:	ff d0                	call   *%rax
+  802e7f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e83:	c9                   	leave
+  802e84:	c3                   	ret
+
+0000000000802e85 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+  802e89:	48 83 ec 10          	sub    $0x10,%rsp
+  802e8d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e8d <sys_page_unmap_batch+0x8>
+  802e94:	49 bb 1b 89 00 00 00 	movabs $0x891b,%r11
+  802e9b:	00 00 00 
+  802e9e:	4c 01 d8             	add    %r11,%rax
+  802ea1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ea5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802ea9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ead:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802eb1:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb5:	6a 00                	push   $0x0
+  802eb7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ebd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ec3:	be 01 00 00 00       	mov    $0x1,%esi
+  802ec8:	bf 15 00 00 00       	mov    $0x15,%edi
+  802ecd:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802ed4:	ff ff ff 
+  802ed7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802edb:	ff d0                	call   *%rax
+  802edd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ee1:	c9                   	leave
+  802ee2:	c3                   	ret
+
+0000000000802ee3 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802ee3:	55                   	push   %rbp
+  802ee4:	48 89 e5             	mov    %rsp,%rbp
+  802ee7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ee7 <sys_fork+0x4>
+  802eee:	49 bb c1 88 00 00 00 	movabs $0x88c1,%r11
+  802ef5:	00 00 00 
+  802ef8:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802efb:	48 83 ec 08          	sub    $0x8,%rsp
+  802eff:	6a 00                	push   $0x0
+  802f01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f17:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1c:	bf 16 00 00 00       	mov    $0x16,%edi
+  802f21:	49 ba c5 6b ff ff ff 	movabs $0xffffffffffff6bc5,%r10
+  802f28:	ff ff ff 
+  802f2b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f2f:	ff d0                	call   *%rax
+  802f31:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f35:	c9                   	leave
+  802f36:	c3                   	ret
+
+0000000000802f37 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802f37:	55                   	push   %rbp
+  802f38:	48 89 e5             	mov    %rsp,%rbp
+  802f3b:	48 83 ec 08          	sub    $0x8,%rsp
+  802f3f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f3f <fd2num+0x8>
+  802f46:	49 bb 69 88 00 00 00 	movabs $0x8869,%r11
+  802f4d:	00 00 00 
+  802f50:	4c 01 d8             	add    %r11,%rax
+  802f53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802f57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f5b:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802f62:	ff ff ff 
+  802f65:	48 01 d0             	add    %rdx,%rax
+  802f68:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802f6c:	c9                   	leave
+  802f6d:	c3                   	ret
+
+0000000000802f6e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802f6e:	55                   	push   %rbp
+  802f6f:	48 89 e5             	mov    %rsp,%rbp
+  802f72:	48 83 ec 08          	sub    $0x8,%rsp
+  802f76:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f76 <fd2data+0x8>
+  802f7d:	49 bb 32 88 00 00 00 	movabs $0x8832,%r11
+  802f84:	00 00 00 
+  802f87:	4c 01 d8             	add    %r11,%rax
+  802f8a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802f8e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f92:	48 89 d7             	mov    %rdx,%rdi
+  802f95:	48 ba 8f 77 ff ff ff 	movabs $0xffffffffffff778f,%rdx
+  802f9c:	ff ff ff 
+  802f9f:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802fa3:	ff d0                	call   *%rax
+  802fa5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802fab:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802faf:	c9                   	leave
+  802fb0:	c3                   	ret
+
+0000000000802fb1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802fb1:	55                   	push   %rbp
+  802fb2:	48 89 e5             	mov    %rsp,%rbp
+  802fb5:	48 83 ec 18          	sub    $0x18,%rsp
+  802fb9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802fb9 <fd_alloc+0x8>
+  802fc0:	49 bb ef 87 00 00 00 	movabs $0x87ef,%r11
+  802fc7:	00 00 00 
+  802fca:	4c 01 d8             	add    %r11,%rax
+  802fcd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802fd1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802fd8:	eb 75                	jmp    80304f <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802fda:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802fdd:	48 63 d2             	movslq %edx,%rdx
+  802fe0:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802fe7:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802feb:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802fef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ff3:	48 89 d1             	mov    %rdx,%rcx
+  802ff6:	48 c1 e9 15          	shr    $0x15,%rcx
+  802ffa:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803001:	ff ff ff 
+  803004:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803008:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80300c:	83 e2 01             	and    $0x1,%edx
+  80300f:	48 85 d2             	test   %rdx,%rdx
+  803012:	74 25                	je     803039 <fd_alloc+0x88>
+  803014:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803018:	48 89 d1             	mov    %rdx,%rcx
+  80301b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80301f:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803026:	ff ff ff 
+  803029:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80302d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803031:	83 e2 01             	and    $0x1,%edx
+  803034:	48 85 d2             	test   %rdx,%rdx
+  803037:	75 12                	jne    80304b <fd_alloc+0x9a>
+			*fd_store = fd;
+  803039:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80303d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803041:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803044:	b8 00 00 00 00       	mov    $0x0,%eax
+  803049:	eb 1a                	jmp    803065 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  80304b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80304f:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803053:	7e 85                	jle    802fda <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803055:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803059:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803060:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803065:	c9                   	leave
+  803066:	c3                   	ret
+
+0000000000803067 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803067:	55                   	push   %rbp
+  803068:	48 89 e5             	mov    %rsp,%rbp
+  80306b:	48 83 ec 20          	sub    $0x20,%rsp
+  80306f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80306f <fd_lookup+0x8>
+  803076:	49 bb 39 87 00 00 00 	movabs $0x8739,%r11
+  80307d:	00 00 00 
+  803080:	4c 01 d8             	add    %r11,%rax
+  803083:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803086:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80308a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80308e:	78 06                	js     803096 <fd_lookup+0x2f>
+  803090:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803094:	7e 07                	jle    80309d <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803096:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80309b:	eb 73                	jmp    803110 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  80309d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8030a0:	48 63 d2             	movslq %edx,%rdx
+  8030a3:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8030aa:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8030ae:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8030b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8030b6:	48 89 d1             	mov    %rdx,%rcx
+  8030b9:	48 c1 e9 15          	shr    $0x15,%rcx
+  8030bd:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8030c4:	ff ff ff 
+  8030c7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8030cb:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8030cf:	83 e2 01             	and    $0x1,%edx
+  8030d2:	48 85 d2             	test   %rdx,%rdx
+  8030d5:	74 22                	je     8030f9 <fd_lookup+0x92>
+  8030d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8030db:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8030df:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  8030e6:	ff ff ff 
+  8030e9:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8030ed:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030f1:	83 e0 01             	and    $0x1,%eax
+  8030f4:	48 85 c0             	test   %rax,%rax
+  8030f7:	75 07                	jne    803100 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8030f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030fe:	eb 10                	jmp    803110 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803100:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803104:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803108:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  80310b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803110:	c9                   	leave
+  803111:	c3                   	ret
+
+0000000000803112 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803112:	55                   	push   %rbp
+  803113:	48 89 e5             	mov    %rsp,%rbp
+  803116:	41 57                	push   %r15
+  803118:	53                   	push   %rbx
+  803119:	48 83 ec 30          	sub    $0x30,%rsp
+  80311d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80311d <fd_close+0xb>
+  803124:	49 bb 8b 86 00 00 00 	movabs $0x868b,%r11
+  80312b:	00 00 00 
+  80312e:	4c 01 db             	add    %r11,%rbx
+  803131:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803135:	89 f0                	mov    %esi,%eax
+  803137:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80313a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80313e:	48 89 c7             	mov    %rax,%rdi
+  803141:	48 b8 8f 77 ff ff ff 	movabs $0xffffffffffff778f,%rax
+  803148:	ff ff ff 
+  80314b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80314f:	ff d0                	call   *%rax
+  803151:	89 c2                	mov    %eax,%edx
+  803153:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803157:	48 89 c6             	mov    %rax,%rsi
+  80315a:	89 d7                	mov    %edx,%edi
+  80315c:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  803163:	ff ff ff 
+  803166:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80316a:	ff d0                	call   *%rax
+  80316c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80316f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803173:	78 0a                	js     80317f <fd_close+0x6d>
+	    || fd != fd2)
+  803175:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803179:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80317d:	74 12                	je     803191 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80317f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803183:	74 05                	je     80318a <fd_close+0x78>
+  803185:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803188:	eb 7a                	jmp    803204 <fd_close+0xf2>
+  80318a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80318f:	eb 73                	jmp    803204 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803191:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803195:	8b 00                	mov    (%rax),%eax
+  803197:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80319b:	48 89 d6             	mov    %rdx,%rsi
+  80319e:	89 c7                	mov    %eax,%edi
+  8031a0:	48 b8 65 7a ff ff ff 	movabs $0xffffffffffff7a65,%rax
+  8031a7:	ff ff ff 
+  8031aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031ae:	ff d0                	call   *%rax
+  8031b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031b7:	78 2a                	js     8031e3 <fd_close+0xd1>
+		if (dev->dev_close)
+  8031b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031bd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8031c1:	48 85 c0             	test   %rax,%rax
+  8031c4:	74 16                	je     8031dc <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8031c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031ca:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8031ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031d2:	48 89 c7             	mov    %rax,%rdi
+  8031d5:	ff d2                	call   *%rdx
+  8031d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031da:	eb 07                	jmp    8031e3 <fd_close+0xd1>
+		else
+			r = 0;
+  8031dc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8031e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031e7:	48 89 c6             	mov    %rax,%rsi
+  8031ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ef:	49 89 df             	mov    %rbx,%r15
+  8031f2:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  8031f9:	ff ff ff 
+  8031fc:	48 01 d8             	add    %rbx,%rax
+  8031ff:	ff d0                	call   *%rax
+	return r;
+  803201:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803204:	48 83 c4 30          	add    $0x30,%rsp
+  803208:	5b                   	pop    %rbx
+  803209:	41 5f                	pop    %r15
+  80320b:	5d                   	pop    %rbp
+  80320c:	c3                   	ret
+
+000000000080320d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80320d:	55                   	push   %rbp
+  80320e:	48 89 e5             	mov    %rsp,%rbp
+  803211:	41 57                	push   %r15
+  803213:	48 83 ec 28          	sub    $0x28,%rsp
+  803217:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803217 <dev_lookup+0xa>
+  80321e:	49 bb 91 85 00 00 00 	movabs $0x8591,%r11
+  803225:	00 00 00 
+  803228:	4c 01 d9             	add    %r11,%rcx
+  80322b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80322e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803232:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803239:	eb 45                	jmp    803280 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  80323b:	48 ba d8 01 00 00 00 	movabs $0x1d8,%rdx
+  803242:	00 00 00 
+  803245:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803248:	48 98                	cltq
+  80324a:	48 01 ca             	add    %rcx,%rdx
+  80324d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803251:	8b 00                	mov    (%rax),%eax
+  803253:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803256:	75 24                	jne    80327c <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803258:	48 ba d8 01 00 00 00 	movabs $0x1d8,%rdx
+  80325f:	00 00 00 
+  803262:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803265:	48 98                	cltq
+  803267:	48 01 ca             	add    %rcx,%rdx
+  80326a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80326e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803272:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803275:	b8 00 00 00 00       	mov    $0x0,%eax
+  80327a:	eb 74                	jmp    8032f0 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  80327c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803280:	48 ba d8 01 00 00 00 	movabs $0x1d8,%rdx
+  803287:	00 00 00 
+  80328a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80328d:	48 98                	cltq
+  80328f:	48 01 ca             	add    %rcx,%rdx
+  803292:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803296:	48 85 c0             	test   %rax,%rax
+  803299:	75 a0                	jne    80323b <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80329b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8032a2:	ff ff ff 
+  8032a5:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8032a9:	48 8b 00             	mov    (%rax),%rax
+  8032ac:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8032b2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8032b5:	89 c6                	mov    %eax,%esi
+  8032b7:	48 b8 10 c4 ff ff ff 	movabs $0xffffffffffffc410,%rax
+  8032be:	ff ff ff 
+  8032c1:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8032c5:	48 89 c7             	mov    %rax,%rdi
+  8032c8:	49 89 cf             	mov    %rcx,%r15
+  8032cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d0:	49 b8 68 55 ff ff ff 	movabs $0xffffffffffff5568,%r8
+  8032d7:	ff ff ff 
+  8032da:	49 01 c8             	add    %rcx,%r8
+  8032dd:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8032e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032e4:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8032eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8032f0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8032f4:	c9                   	leave
+  8032f5:	c3                   	ret
+
+00000000008032f6 <close>:
+
+int
+close(int fdnum)
+{
+  8032f6:	55                   	push   %rbp
+  8032f7:	48 89 e5             	mov    %rsp,%rbp
+  8032fa:	53                   	push   %rbx
+  8032fb:	48 83 ec 28          	sub    $0x28,%rsp
+  8032ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032ff <close+0x9>
+  803306:	49 bb a9 84 00 00 00 	movabs $0x84a9,%r11
+  80330d:	00 00 00 
+  803310:	4c 01 db             	add    %r11,%rbx
+  803313:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803316:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80331a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80331d:	48 89 d6             	mov    %rdx,%rsi
+  803320:	89 c7                	mov    %eax,%edi
+  803322:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  803329:	ff ff ff 
+  80332c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803330:	ff d0                	call   *%rax
+  803332:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803335:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803339:	79 05                	jns    803340 <close+0x4a>
+		return r;
+  80333b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80333e:	eb 1c                	jmp    80335c <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803340:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803344:	be 01 00 00 00       	mov    $0x1,%esi
+  803349:	48 89 c7             	mov    %rax,%rdi
+  80334c:	48 b8 6a 79 ff ff ff 	movabs $0xffffffffffff796a,%rax
+  803353:	ff ff ff 
+  803356:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80335a:	ff d0                	call   *%rax
+}
+  80335c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803360:	c9                   	leave
+  803361:	c3                   	ret
+
+0000000000803362 <close_all>:
+
+void
+close_all(void)
+{
+  803362:	55                   	push   %rbp
+  803363:	48 89 e5             	mov    %rsp,%rbp
+  803366:	53                   	push   %rbx
+  803367:	48 83 ec 18          	sub    $0x18,%rsp
+  80336b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80336b <close_all+0x9>
+  803372:	49 bb 3d 84 00 00 00 	movabs $0x843d,%r11
+  803379:	00 00 00 
+  80337c:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80337f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803386:	eb 19                	jmp    8033a1 <close_all+0x3f>
+		close(i);
+  803388:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80338b:	89 c7                	mov    %eax,%edi
+  80338d:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  803394:	ff ff ff 
+  803397:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80339b:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  80339d:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8033a1:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8033a5:	7e e1                	jle    803388 <close_all+0x26>
+}
+  8033a7:	90                   	nop
+  8033a8:	90                   	nop
+  8033a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033ad:	c9                   	leave
+  8033ae:	c3                   	ret
+
+00000000008033af <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8033af:	55                   	push   %rbp
+  8033b0:	48 89 e5             	mov    %rsp,%rbp
+  8033b3:	41 57                	push   %r15
+  8033b5:	53                   	push   %rbx
+  8033b6:	48 83 ec 40          	sub    $0x40,%rsp
+  8033ba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033ba <dup+0xb>
+  8033c1:	49 bb ee 83 00 00 00 	movabs $0x83ee,%r11
+  8033c8:	00 00 00 
+  8033cb:	4c 01 db             	add    %r11,%rbx
+  8033ce:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8033d1:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8033d4:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8033d8:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8033db:	48 89 d6             	mov    %rdx,%rsi
+  8033de:	89 c7                	mov    %eax,%edi
+  8033e0:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  8033e7:	ff ff ff 
+  8033ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033ee:	ff d0                	call   *%rax
+  8033f0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8033f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033f7:	79 08                	jns    803401 <dup+0x52>
+		return r;
+  8033f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033fc:	e9 a4 01 00 00       	jmp    8035a5 <dup+0x1f6>
+	close(newfdnum);
+  803401:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803404:	89 c7                	mov    %eax,%edi
+  803406:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  80340d:	ff ff ff 
+  803410:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803414:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803416:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803419:	48 98                	cltq
+  80341b:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803421:	48 c1 e0 0c          	shl    $0xc,%rax
+  803425:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803429:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80342d:	48 89 c7             	mov    %rax,%rdi
+  803430:	48 b8 c6 77 ff ff ff 	movabs $0xffffffffffff77c6,%rax
+  803437:	ff ff ff 
+  80343a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80343e:	ff d0                	call   *%rax
+  803440:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803444:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803448:	48 89 c7             	mov    %rax,%rdi
+  80344b:	48 b8 c6 77 ff ff ff 	movabs $0xffffffffffff77c6,%rax
+  803452:	ff ff ff 
+  803455:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803459:	ff d0                	call   *%rax
+  80345b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80345f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803463:	48 c1 e8 15          	shr    $0x15,%rax
+  803467:	48 89 c2             	mov    %rax,%rdx
+  80346a:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803471:	ff ff ff 
+  803474:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803478:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80347c:	83 e0 01             	and    $0x1,%eax
+  80347f:	48 85 c0             	test   %rax,%rax
+  803482:	74 7f                	je     803503 <dup+0x154>
+  803484:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803488:	48 c1 e8 0c          	shr    $0xc,%rax
+  80348c:	48 89 c2             	mov    %rax,%rdx
+  80348f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803496:	ff ff ff 
+  803499:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80349d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034a1:	83 e0 01             	and    $0x1,%eax
+  8034a4:	48 85 c0             	test   %rax,%rax
+  8034a7:	74 5a                	je     803503 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8034a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034ad:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034b1:	48 89 c2             	mov    %rax,%rdx
+  8034b4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8034bb:	ff ff ff 
+  8034be:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034c2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034c6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8034cb:	89 c1                	mov    %eax,%ecx
+  8034cd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8034d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034d5:	41 89 c8             	mov    %ecx,%r8d
+  8034d8:	48 89 d1             	mov    %rdx,%rcx
+  8034db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034e0:	48 89 c6             	mov    %rax,%rsi
+  8034e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034e8:	49 89 df             	mov    %rbx,%r15
+  8034eb:	48 b8 4b 70 ff ff ff 	movabs $0xffffffffffff704b,%rax
+  8034f2:	ff ff ff 
+  8034f5:	48 01 d8             	add    %rbx,%rax
+  8034f8:	ff d0                	call   *%rax
+  8034fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803501:	78 5f                	js     803562 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803503:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803507:	48 c1 e8 0c          	shr    $0xc,%rax
+  80350b:	48 89 c2             	mov    %rax,%rdx
+  80350e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803515:	ff ff ff 
+  803518:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80351c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803520:	25 07 0e 00 00       	and    $0xe07,%eax
+  803525:	89 c1                	mov    %eax,%ecx
+  803527:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80352b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80352f:	41 89 c8             	mov    %ecx,%r8d
+  803532:	48 89 d1             	mov    %rdx,%rcx
+  803535:	ba 00 00 00 00       	mov    $0x0,%edx
+  80353a:	48 89 c6             	mov    %rax,%rsi
+  80353d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803542:	49 89 df             	mov    %rbx,%r15
+  803545:	48 b8 4b 70 ff ff ff 	movabs $0xffffffffffff704b,%rax
+  80354c:	ff ff ff 
+  80354f:	48 01 d8             	add    %rbx,%rax
+  803552:	ff d0                	call   *%rax
+  803554:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803557:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80355b:	78 08                	js     803565 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  80355d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803560:	eb 43                	jmp    8035a5 <dup+0x1f6>
+			goto err;
+  803562:	90                   	nop
+  803563:	eb 01                	jmp    803566 <dup+0x1b7>
+		goto err;
+  803565:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803566:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80356a:	48 89 c6             	mov    %rax,%rsi
+  80356d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803572:	49 89 df             	mov    %rbx,%r15
+  803575:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  80357c:	ff ff ff 
+  80357f:	48 01 d8             	add    %rbx,%rax
+  803582:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803584:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803588:	48 89 c6             	mov    %rax,%rsi
+  80358b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803590:	49 89 df             	mov    %rbx,%r15
+  803593:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  80359a:	ff ff ff 
+  80359d:	48 01 d8             	add    %rbx,%rax
+  8035a0:	ff d0                	call   *%rax
+	return r;
+  8035a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8035a5:	48 83 c4 40          	add    $0x40,%rsp
+  8035a9:	5b                   	pop    %rbx
+  8035aa:	41 5f                	pop    %r15
+  8035ac:	5d                   	pop    %rbp
+  8035ad:	c3                   	ret
+
+00000000008035ae <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8035ae:	55                   	push   %rbp
+  8035af:	48 89 e5             	mov    %rsp,%rbp
+  8035b2:	41 57                	push   %r15
+  8035b4:	53                   	push   %rbx
+  8035b5:	48 83 ec 40          	sub    $0x40,%rsp
+  8035b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035b9 <read+0xb>
+  8035c0:	49 bb ef 81 00 00 00 	movabs $0x81ef,%r11
+  8035c7:	00 00 00 
+  8035ca:	4c 01 db             	add    %r11,%rbx
+  8035cd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8035d0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8035d4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8035d8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8035dc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8035df:	48 89 d6             	mov    %rdx,%rsi
+  8035e2:	89 c7                	mov    %eax,%edi
+  8035e4:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  8035eb:	ff ff ff 
+  8035ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035f2:	ff d0                	call   *%rax
+  8035f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8035f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035fb:	78 28                	js     803625 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8035fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803601:	8b 00                	mov    (%rax),%eax
+  803603:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803607:	48 89 d6             	mov    %rdx,%rsi
+  80360a:	89 c7                	mov    %eax,%edi
+  80360c:	48 b8 65 7a ff ff ff 	movabs $0xffffffffffff7a65,%rax
+  803613:	ff ff ff 
+  803616:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80361a:	ff d0                	call   *%rax
+  80361c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80361f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803623:	79 08                	jns    80362d <read+0x7f>
+		return r;
+  803625:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803628:	e9 8b 00 00 00       	jmp    8036b8 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80362d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803631:	8b 40 08             	mov    0x8(%rax),%eax
+  803634:	83 e0 03             	and    $0x3,%eax
+  803637:	83 f8 01             	cmp    $0x1,%eax
+  80363a:	75 4b                	jne    803687 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80363c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803643:	ff ff ff 
+  803646:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80364a:	48 8b 00             	mov    (%rax),%rax
+  80364d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803653:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803656:	89 c6                	mov    %eax,%esi
+  803658:	48 b8 2f c4 ff ff ff 	movabs $0xffffffffffffc42f,%rax
+  80365f:	ff ff ff 
+  803662:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803666:	48 89 c7             	mov    %rax,%rdi
+  803669:	49 89 df             	mov    %rbx,%r15
+  80366c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803671:	48 b9 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rcx
+  803678:	ff ff ff 
+  80367b:	48 01 d9             	add    %rbx,%rcx
+  80367e:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803680:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803685:	eb 31                	jmp    8036b8 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803687:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80368b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80368f:	48 85 c0             	test   %rax,%rax
+  803692:	75 07                	jne    80369b <read+0xed>
+		return -E_NOT_SUPP;
+  803694:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803699:	eb 1d                	jmp    8036b8 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  80369b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80369f:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8036a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036a7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8036ab:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8036af:	48 89 ce             	mov    %rcx,%rsi
+  8036b2:	48 89 c7             	mov    %rax,%rdi
+  8036b5:	41 ff d0             	call   *%r8
+}
+  8036b8:	48 83 c4 40          	add    $0x40,%rsp
+  8036bc:	5b                   	pop    %rbx
+  8036bd:	41 5f                	pop    %r15
+  8036bf:	5d                   	pop    %rbp
+  8036c0:	c3                   	ret
+
+00000000008036c1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8036c1:	55                   	push   %rbp
+  8036c2:	48 89 e5             	mov    %rsp,%rbp
+  8036c5:	53                   	push   %rbx
+  8036c6:	48 83 ec 38          	sub    $0x38,%rsp
+  8036ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036ca <readn+0x9>
+  8036d1:	49 bb de 80 00 00 00 	movabs $0x80de,%r11
+  8036d8:	00 00 00 
+  8036db:	4c 01 db             	add    %r11,%rbx
+  8036de:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8036e1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8036e5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8036e9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8036f0:	eb 4b                	jmp    80373d <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8036f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036f5:	48 98                	cltq
+  8036f7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8036fb:	48 29 c2             	sub    %rax,%rdx
+  8036fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803701:	48 63 c8             	movslq %eax,%rcx
+  803704:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803708:	48 01 c1             	add    %rax,%rcx
+  80370b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80370e:	48 89 ce             	mov    %rcx,%rsi
+  803711:	89 c7                	mov    %eax,%edi
+  803713:	48 b8 06 7e ff ff ff 	movabs $0xffffffffffff7e06,%rax
+  80371a:	ff ff ff 
+  80371d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803721:	ff d0                	call   *%rax
+  803723:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803726:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80372a:	79 05                	jns    803731 <readn+0x70>
+			return m;
+  80372c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80372f:	eb 1d                	jmp    80374e <readn+0x8d>
+		if (m == 0)
+  803731:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803735:	74 13                	je     80374a <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803737:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80373a:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80373d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803740:	48 98                	cltq
+  803742:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803746:	72 aa                	jb     8036f2 <readn+0x31>
+  803748:	eb 01                	jmp    80374b <readn+0x8a>
+			break;
+  80374a:	90                   	nop
+	}
+	return tot;
+  80374b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80374e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803752:	c9                   	leave
+  803753:	c3                   	ret
+
+0000000000803754 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803754:	55                   	push   %rbp
+  803755:	48 89 e5             	mov    %rsp,%rbp
+  803758:	41 57                	push   %r15
+  80375a:	53                   	push   %rbx
+  80375b:	48 83 ec 40          	sub    $0x40,%rsp
+  80375f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80375f <write+0xb>
+  803766:	49 bb 49 80 00 00 00 	movabs $0x8049,%r11
+  80376d:	00 00 00 
+  803770:	4c 01 db             	add    %r11,%rbx
+  803773:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803776:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80377a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80377e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803782:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803785:	48 89 d6             	mov    %rdx,%rsi
+  803788:	89 c7                	mov    %eax,%edi
+  80378a:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  803791:	ff ff ff 
+  803794:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803798:	ff d0                	call   *%rax
+  80379a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80379d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037a1:	78 28                	js     8037cb <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8037a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037a7:	8b 00                	mov    (%rax),%eax
+  8037a9:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8037ad:	48 89 d6             	mov    %rdx,%rsi
+  8037b0:	89 c7                	mov    %eax,%edi
+  8037b2:	48 b8 65 7a ff ff ff 	movabs $0xffffffffffff7a65,%rax
+  8037b9:	ff ff ff 
+  8037bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037c0:	ff d0                	call   *%rax
+  8037c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037c9:	79 08                	jns    8037d3 <write+0x7f>
+		return r;
+  8037cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037ce:	e9 8a 00 00 00       	jmp    80385d <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8037d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037d7:	8b 40 08             	mov    0x8(%rax),%eax
+  8037da:	83 e0 03             	and    $0x3,%eax
+  8037dd:	85 c0                	test   %eax,%eax
+  8037df:	75 4b                	jne    80382c <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8037e1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8037e8:	ff ff ff 
+  8037eb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037ef:	48 8b 00             	mov    (%rax),%rax
+  8037f2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8037f8:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8037fb:	89 c6                	mov    %eax,%esi
+  8037fd:	48 b8 4b c4 ff ff ff 	movabs $0xffffffffffffc44b,%rax
+  803804:	ff ff ff 
+  803807:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80380b:	48 89 c7             	mov    %rax,%rdi
+  80380e:	49 89 df             	mov    %rbx,%r15
+  803811:	b8 00 00 00 00       	mov    $0x0,%eax
+  803816:	48 b9 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rcx
+  80381d:	ff ff ff 
+  803820:	48 01 d9             	add    %rbx,%rcx
+  803823:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803825:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80382a:	eb 31                	jmp    80385d <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80382c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803830:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803834:	48 85 c0             	test   %rax,%rax
+  803837:	75 07                	jne    803840 <write+0xec>
+		return -E_NOT_SUPP;
+  803839:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80383e:	eb 1d                	jmp    80385d <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803840:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803844:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803848:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80384c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803850:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803854:	48 89 ce             	mov    %rcx,%rsi
+  803857:	48 89 c7             	mov    %rax,%rdi
+  80385a:	41 ff d0             	call   *%r8
+}
+  80385d:	48 83 c4 40          	add    $0x40,%rsp
+  803861:	5b                   	pop    %rbx
+  803862:	41 5f                	pop    %r15
+  803864:	5d                   	pop    %rbp
+  803865:	c3                   	ret
+
+0000000000803866 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803866:	55                   	push   %rbp
+  803867:	48 89 e5             	mov    %rsp,%rbp
+  80386a:	48 83 ec 18          	sub    $0x18,%rsp
+  80386e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80386e <seek+0x8>
+  803875:	49 bb 3a 7f 00 00 00 	movabs $0x7f3a,%r11
+  80387c:	00 00 00 
+  80387f:	4c 01 d8             	add    %r11,%rax
+  803882:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803885:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803888:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  80388c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80388f:	48 89 ce             	mov    %rcx,%rsi
+  803892:	89 d7                	mov    %edx,%edi
+  803894:	48 ba bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rdx
+  80389b:	ff ff ff 
+  80389e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8038a2:	ff d0                	call   *%rax
+  8038a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038ab:	79 05                	jns    8038b2 <seek+0x4c>
+		return r;
+  8038ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038b0:	eb 0f                	jmp    8038c1 <seek+0x5b>
+	fd->fd_offset = offset;
+  8038b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038b6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8038b9:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8038bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038c1:	c9                   	leave
+  8038c2:	c3                   	ret
+
+00000000008038c3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8038c3:	55                   	push   %rbp
+  8038c4:	48 89 e5             	mov    %rsp,%rbp
+  8038c7:	41 57                	push   %r15
+  8038c9:	53                   	push   %rbx
+  8038ca:	48 83 ec 30          	sub    $0x30,%rsp
+  8038ce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038ce <ftruncate+0xb>
+  8038d5:	49 bb da 7e 00 00 00 	movabs $0x7eda,%r11
+  8038dc:	00 00 00 
+  8038df:	4c 01 db             	add    %r11,%rbx
+  8038e2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8038e5:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8038e8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8038ec:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8038ef:	48 89 d6             	mov    %rdx,%rsi
+  8038f2:	89 c7                	mov    %eax,%edi
+  8038f4:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  8038fb:	ff ff ff 
+  8038fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803902:	ff d0                	call   *%rax
+  803904:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803907:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80390b:	78 28                	js     803935 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80390d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803911:	8b 00                	mov    (%rax),%eax
+  803913:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803917:	48 89 d6             	mov    %rdx,%rsi
+  80391a:	89 c7                	mov    %eax,%edi
+  80391c:	48 b8 65 7a ff ff ff 	movabs $0xffffffffffff7a65,%rax
+  803923:	ff ff ff 
+  803926:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80392a:	ff d0                	call   *%rax
+  80392c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80392f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803933:	79 08                	jns    80393d <ftruncate+0x7a>
+		return r;
+  803935:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803938:	e9 83 00 00 00       	jmp    8039c0 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80393d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803941:	8b 40 08             	mov    0x8(%rax),%eax
+  803944:	83 e0 03             	and    $0x3,%eax
+  803947:	85 c0                	test   %eax,%eax
+  803949:	75 4b                	jne    803996 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  80394b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803952:	ff ff ff 
+  803955:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803959:	48 8b 00             	mov    (%rax),%rax
+  80395c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803962:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803965:	89 c6                	mov    %eax,%esi
+  803967:	48 b8 68 c4 ff ff ff 	movabs $0xffffffffffffc468,%rax
+  80396e:	ff ff ff 
+  803971:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803975:	48 89 c7             	mov    %rax,%rdi
+  803978:	49 89 df             	mov    %rbx,%r15
+  80397b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803980:	48 b9 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rcx
+  803987:	ff ff ff 
+  80398a:	48 01 d9             	add    %rbx,%rcx
+  80398d:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80398f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803994:	eb 2a                	jmp    8039c0 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803996:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80399a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80399e:	48 85 c0             	test   %rax,%rax
+  8039a1:	75 07                	jne    8039aa <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8039a3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8039a8:	eb 16                	jmp    8039c0 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8039aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039ae:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8039b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039b6:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8039b9:	89 d6                	mov    %edx,%esi
+  8039bb:	48 89 c7             	mov    %rax,%rdi
+  8039be:	ff d1                	call   *%rcx
+}
+  8039c0:	48 83 c4 30          	add    $0x30,%rsp
+  8039c4:	5b                   	pop    %rbx
+  8039c5:	41 5f                	pop    %r15
+  8039c7:	5d                   	pop    %rbp
+  8039c8:	c3                   	ret
+
+00000000008039c9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8039c9:	55                   	push   %rbp
+  8039ca:	48 89 e5             	mov    %rsp,%rbp
+  8039cd:	53                   	push   %rbx
+  8039ce:	48 83 ec 38          	sub    $0x38,%rsp
+  8039d2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039d2 <fstat+0x9>
+  8039d9:	49 bb d6 7d 00 00 00 	movabs $0x7dd6,%r11
+  8039e0:	00 00 00 
+  8039e3:	4c 01 db             	add    %r11,%rbx
+  8039e6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8039e9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8039ed:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8039f1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8039f4:	48 89 d6             	mov    %rdx,%rsi
+  8039f7:	89 c7                	mov    %eax,%edi
+  8039f9:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  803a00:	ff ff ff 
+  803a03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a07:	ff d0                	call   *%rax
+  803a09:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a0c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a10:	78 28                	js     803a3a <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803a12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a16:	8b 00                	mov    (%rax),%eax
+  803a18:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803a1c:	48 89 d6             	mov    %rdx,%rsi
+  803a1f:	89 c7                	mov    %eax,%edi
+  803a21:	48 b8 65 7a ff ff ff 	movabs $0xffffffffffff7a65,%rax
+  803a28:	ff ff ff 
+  803a2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a2f:	ff d0                	call   *%rax
+  803a31:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a34:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a38:	79 05                	jns    803a3f <fstat+0x76>
+		return r;
+  803a3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a3d:	eb 5e                	jmp    803a9d <fstat+0xd4>
+	if (!dev->dev_stat)
+  803a3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a43:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803a47:	48 85 c0             	test   %rax,%rax
+  803a4a:	75 07                	jne    803a53 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803a4c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803a51:	eb 4a                	jmp    803a9d <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803a53:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a57:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803a5a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a5e:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803a65:	00 00 00 
+	stat->st_isdir = 0;
+  803a68:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a6c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803a73:	00 00 00 
+	stat->st_dev = dev;
+  803a76:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a7a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803a7e:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  803a85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a89:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803a8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a95:	48 89 d6             	mov    %rdx,%rsi
+  803a98:	48 89 c7             	mov    %rax,%rdi
+  803a9b:	ff d1                	call   *%rcx
+}
+  803a9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803aa1:	c9                   	leave
+  803aa2:	c3                   	ret
+
+0000000000803aa3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803aa3:	55                   	push   %rbp
+  803aa4:	48 89 e5             	mov    %rsp,%rbp
+  803aa7:	41 57                	push   %r15
+  803aa9:	53                   	push   %rbx
+  803aaa:	48 83 ec 20          	sub    $0x20,%rsp
+  803aae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803aae <stat+0xb>
+  803ab5:	49 bb fa 7c 00 00 00 	movabs $0x7cfa,%r11
+  803abc:	00 00 00 
+  803abf:	4c 01 db             	add    %r11,%rbx
+  803ac2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803ac6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803aca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ace:	be 00 00 00 00       	mov    $0x0,%esi
+  803ad3:	48 89 c7             	mov    %rax,%rdi
+  803ad6:	49 89 df             	mov    %rbx,%r15
+  803ad9:	48 b8 d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rax
+  803ae0:	ff ff ff 
+  803ae3:	48 01 d8             	add    %rbx,%rax
+  803ae6:	ff d0                	call   *%rax
+  803ae8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803aeb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803aef:	79 05                	jns    803af6 <stat+0x53>
+		return fd;
+  803af1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803af4:	eb 37                	jmp    803b2d <stat+0x8a>
+	r = fstat(fd, stat);
+  803af6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803afa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803afd:	48 89 d6             	mov    %rdx,%rsi
+  803b00:	89 c7                	mov    %eax,%edi
+  803b02:	48 b8 21 82 ff ff ff 	movabs $0xffffffffffff8221,%rax
+  803b09:	ff ff ff 
+  803b0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b10:	ff d0                	call   *%rax
+  803b12:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803b15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b18:	89 c7                	mov    %eax,%edi
+  803b1a:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  803b21:	ff ff ff 
+  803b24:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b28:	ff d0                	call   *%rax
+	return r;
+  803b2a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803b2d:	48 83 c4 20          	add    $0x20,%rsp
+  803b31:	5b                   	pop    %rbx
+  803b32:	41 5f                	pop    %r15
+  803b34:	5d                   	pop    %rbp
+  803b35:	c3                   	ret
+
+0000000000803b36 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803b36:	55                   	push   %rbp
+  803b37:	48 89 e5             	mov    %rsp,%rbp
+  803b3a:	41 57                	push   %r15
+  803b3c:	53                   	push   %rbx
+  803b3d:	48 83 ec 10          	sub    $0x10,%rsp
+  803b41:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b41 <fsipc+0xb>
+  803b48:	49 bb 67 7c 00 00 00 	movabs $0x7c67,%r11
+  803b4f:	00 00 00 
+  803b52:	4c 01 db             	add    %r11,%rbx
+  803b55:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b58:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803b5c:	48 b8 58 08 00 00 00 	movabs $0x858,%rax
+  803b63:	00 00 00 
+  803b66:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803b69:	85 c0                	test   %eax,%eax
+  803b6b:	75 24                	jne    803b91 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803b6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b72:	49 89 df             	mov    %rbx,%r15
+  803b75:	48 b8 05 bd ff ff ff 	movabs $0xffffffffffffbd05,%rax
+  803b7c:	ff ff ff 
+  803b7f:	48 01 d8             	add    %rbx,%rax
+  803b82:	ff d0                	call   *%rax
+  803b84:	48 ba 58 08 00 00 00 	movabs $0x858,%rdx
+  803b8b:	00 00 00 
+  803b8e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803b91:	48 b8 58 08 00 00 00 	movabs $0x858,%rax
+  803b98:	00 00 00 
+  803b9b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803b9e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ba2:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803ba5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bab:	49 89 d0             	mov    %rdx,%r8
+  803bae:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803bb3:	48 ba 58 38 01 00 00 	movabs $0x13858,%rdx
+  803bba:	00 00 00 
+  803bbd:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803bc1:	89 c7                	mov    %eax,%edi
+  803bc3:	49 89 df             	mov    %rbx,%r15
+  803bc6:	48 b8 24 b7 ff ff ff 	movabs $0xffffffffffffb724,%rax
+  803bcd:	ff ff ff 
+  803bd0:	48 01 d8             	add    %rbx,%rax
+  803bd3:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803bd5:	48 83 c4 10          	add    $0x10,%rsp
+  803bd9:	5b                   	pop    %rbx
+  803bda:	41 5f                	pop    %r15
+  803bdc:	5d                   	pop    %rbp
+  803bdd:	c3                   	ret
+
+0000000000803bde <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803bde:	55                   	push   %rbp
+  803bdf:	48 89 e5             	mov    %rsp,%rbp
+  803be2:	41 57                	push   %r15
+  803be4:	53                   	push   %rbx
+  803be5:	48 83 ec 20          	sub    $0x20,%rsp
+  803be9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803be9 <fsipc_words+0xb>
+  803bf0:	49 bb bf 7b 00 00 00 	movabs $0x7bbf,%r11
+  803bf7:	00 00 00 
+  803bfa:	4c 01 db             	add    %r11,%rbx
+  803bfd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803c00:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803c04:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803c08:	48 b8 58 08 00 00 00 	movabs $0x858,%rax
+  803c0f:	00 00 00 
+  803c12:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803c15:	85 c0                	test   %eax,%eax
+  803c17:	75 24                	jne    803c3d <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803c19:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c1e:	49 89 df             	mov    %rbx,%r15
+  803c21:	48 b8 05 bd ff ff ff 	movabs $0xffffffffffffbd05,%rax
+  803c28:	ff ff ff 
+  803c2b:	48 01 d8             	add    %rbx,%rax
+  803c2e:	ff d0                	call   *%rax
+  803c30:	48 ba 58 08 00 00 00 	movabs $0x858,%rdx
+  803c37:	00 00 00 
+  803c3a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803c3d:	48 b8 58 08 00 00 00 	movabs $0x858,%rax
+  803c44:	00 00 00 
+  803c47:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803c4a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803c4e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c52:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803c55:	89 c7                	mov    %eax,%edi
+  803c57:	49 89 df             	mov    %rbx,%r15
+  803c5a:	48 b8 0f b8 ff ff ff 	movabs $0xffffffffffffb80f,%rax
+  803c61:	ff ff ff 
+  803c64:	48 01 d8             	add    %rbx,%rax
+  803c67:	ff d0                	call   *%rax
+}
+  803c69:	48 83 c4 20          	add    $0x20,%rsp
+  803c6d:	5b                   	pop    %rbx
+  803c6e:	41 5f                	pop    %r15
+  803c70:	5d                   	pop    %rbp
+  803c71:	c3                   	ret
+
+0000000000803c72 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803c72:	55                   	push   %rbp
+  803c73:	48 89 e5             	mov    %rsp,%rbp
+  803c76:	41 57                	push   %r15
+  803c78:	53                   	push   %rbx
+  803c79:	48 83 ec 40          	sub    $0x40,%rsp
+  803c7d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c7d <fsipc_pages+0xb>
+  803c84:	49 bb 2b 7b 00 00 00 	movabs $0x7b2b,%r11
+  803c8b:	00 00 00 
+  803c8e:	4c 01 db             	add    %r11,%rbx
+  803c91:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803c94:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803c98:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803c9c:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803c9f:	48 b8 58 08 00 00 00 	movabs $0x858,%rax
+  803ca6:	00 00 00 
+  803ca9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803cac:	85 c0                	test   %eax,%eax
+  803cae:	75 24                	jne    803cd4 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803cb0:	bf 01 00 00 00       	mov    $0x1,%edi
+  803cb5:	49 89 df             	mov    %rbx,%r15
+  803cb8:	48 b8 05 bd ff ff ff 	movabs $0xffffffffffffbd05,%rax
+  803cbf:	ff ff ff 
+  803cc2:	48 01 d8             	add    %rbx,%rax
+  803cc5:	ff d0                	call   *%rax
+  803cc7:	48 ba 58 08 00 00 00 	movabs $0x858,%rdx
+  803cce:	00 00 00 
+  803cd1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803cd4:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803cd9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803cdd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803ce0:	48 98                	cltq
+  803ce2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  803ce6:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803cea:	0f 95 c0             	setne  %al
+  803ced:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803cf0:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803cf7:	00 
+  803cf8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803cfc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d00:	48 01 d0             	add    %rdx,%rax
+  803d03:	48 83 e8 01          	sub    $0x1,%rax
+  803d07:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803d0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d14:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803d18:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d1c:	48 29 d0             	sub    %rdx,%rax
+  803d1f:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803d23:	41 89 c2             	mov    %eax,%r10d
+  803d26:	48 b8 58 08 00 00 00 	movabs $0x858,%rax
+  803d2d:	00 00 00 
+  803d30:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803d33:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  803d37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d3b:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803d3e:	48 83 ec 08          	sub    $0x8,%rsp
+  803d42:	6a 40                	push   $0x40
+  803d44:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803d49:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803d50:	00 
+  803d51:	6a 05                	push   $0x5
+  803d53:	41 89 f9             	mov    %edi,%r9d
+  803d56:	49 89 c8             	mov    %rcx,%r8
+  803d59:	44 89 d1             	mov    %r10d,%ecx
+  803d5c:	89 c7                	mov    %eax,%edi
+  803d5e:	49 89 df             	mov    %rbx,%r15
+  803d61:	48 b8 0d b9 ff ff ff 	movabs $0xffffffffffffb90d,%rax
+  803d68:	ff ff ff 
+  803d6b:	48 01 d8             	add    %rbx,%rax
+  803d6e:	ff d0                	call   *%rax
+  803d70:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  803d74:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803d78:	5b                   	pop    %rbx
+  803d79:	41 5f                	pop    %r15
+  803d7b:	5d                   	pop    %rbp
+  803d7c:	c3                   	ret
+
+0000000000803d7d <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  803d7d:	55                   	push   %rbp
+  803d7e:	48 89 e5             	mov    %rsp,%rbp
+  803d81:	41 57                	push   %r15
+  803d83:	53                   	push   %rbx
+  803d84:	48 83 ec 20          	sub    $0x20,%rsp
+  803d88:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d88 <open+0xb>
+  803d8f:	49 bb 20 7a 00 00 00 	movabs $0x7a20,%r11
+  803d96:	00 00 00 
+  803d99:	4c 01 db             	add    %r11,%rbx
+  803d9c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803da0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  803da3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803da7:	48 89 c7             	mov    %rax,%rdi
+  803daa:	49 89 df             	mov    %rbx,%r15
+  803dad:	48 b8 96 62 ff ff ff 	movabs $0xffffffffffff6296,%rax
+  803db4:	ff ff ff 
+  803db7:	48 01 d8             	add    %rbx,%rax
+  803dba:	ff d0                	call   *%rax
+  803dbc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803dc1:	7e 0a                	jle    803dcd <open+0x50>
+		return -E_BAD_PATH;
+  803dc3:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803dc8:	e9 18 01 00 00       	jmp    803ee5 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803dcd:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803dd1:	48 89 c7             	mov    %rax,%rdi
+  803dd4:	49 89 df             	mov    %rbx,%r15
+  803dd7:	48 b8 09 78 ff ff ff 	movabs $0xffffffffffff7809,%rax
+  803dde:	ff ff ff 
+  803de1:	48 01 d8             	add    %rbx,%rax
+  803de4:	ff d0                	call   *%rax
+  803de6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803de9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ded:	74 08                	je     803df7 <open+0x7a>
+		return r;
+  803def:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803df2:	e9 ee 00 00 00       	jmp    803ee5 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  803df7:	48 ba 58 38 01 00 00 	movabs $0x13858,%rdx
+  803dfe:	00 00 00 
+  803e01:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803e04:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  803e0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e0f:	48 89 c6             	mov    %rax,%rsi
+  803e12:	48 b8 58 38 01 00 00 	movabs $0x13858,%rax
+  803e19:	00 00 00 
+  803e1c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e20:	48 89 c7             	mov    %rax,%rdi
+  803e23:	49 89 df             	mov    %rbx,%r15
+  803e26:	48 b8 2a 63 ff ff ff 	movabs $0xffffffffffff632a,%rax
+  803e2d:	ff ff ff 
+  803e30:	48 01 d8             	add    %rbx,%rax
+  803e33:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803e35:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e39:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803e3e:	48 89 c6             	mov    %rax,%rsi
+  803e41:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e46:	49 89 df             	mov    %rbx,%r15
+  803e49:	48 b8 e6 6f ff ff ff 	movabs $0xffffffffffff6fe6,%rax
+  803e50:	ff ff ff 
+  803e53:	48 01 d8             	add    %rbx,%rax
+  803e56:	ff d0                	call   *%rax
+  803e58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e5f:	74 23                	je     803e84 <open+0x107>
+		fd_close(fd,0);
+  803e61:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e65:	be 00 00 00 00       	mov    $0x0,%esi
+  803e6a:	48 89 c7             	mov    %rax,%rdi
+  803e6d:	49 89 df             	mov    %rbx,%r15
+  803e70:	48 b8 6a 79 ff ff ff 	movabs $0xffffffffffff796a,%rax
+  803e77:	ff ff ff 
+  803e7a:	48 01 d8             	add    %rbx,%rax
+  803e7d:	ff d0                	call   *%rax
+		return r;
+  803e7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e82:	eb 61                	jmp    803ee5 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  803e84:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e88:	48 89 c6             	mov    %rax,%rsi
+  803e8b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e90:	48 b8 8e 83 ff ff ff 	movabs $0xffffffffffff838e,%rax
+  803e97:	ff ff ff 
+  803e9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e9e:	ff d0                	call   *%rax
+  803ea0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ea3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ea7:	74 23                	je     803ecc <open+0x14f>
+		fd_close(fd,0);
+  803ea9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ead:	be 00 00 00 00       	mov    $0x0,%esi
+  803eb2:	48 89 c7             	mov    %rax,%rdi
+  803eb5:	49 89 df             	mov    %rbx,%r15
+  803eb8:	48 b8 6a 79 ff ff ff 	movabs $0xffffffffffff796a,%rax
+  803ebf:	ff ff ff 
+  803ec2:	48 01 d8             	add    %rbx,%rax
+  803ec5:	ff d0                	call   *%rax
+		return r;
+  803ec7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803eca:	eb 19                	jmp    803ee5 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803ecc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ed0:	48 89 c7             	mov    %rax,%rdi
+  803ed3:	49 89 df             	mov    %rbx,%r15
+  803ed6:	48 b8 8f 77 ff ff ff 	movabs $0xffffffffffff778f,%rax
+  803edd:	ff ff ff 
+  803ee0:	48 01 d8             	add    %rbx,%rax
+  803ee3:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  803ee5:	48 83 c4 20          	add    $0x20,%rsp
+  803ee9:	5b                   	pop    %rbx
+  803eea:	41 5f                	pop    %r15
+  803eec:	5d                   	pop    %rbp
+  803eed:	c3                   	ret
+
+0000000000803eee <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803eee:	55                   	push   %rbp
+  803eef:	48 89 e5             	mov    %rsp,%rbp
+  803ef2:	48 83 ec 20          	sub    $0x20,%rsp
+  803ef6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ef6 <devfile_flush+0x8>
+  803efd:	49 bb b2 78 00 00 00 	movabs $0x78b2,%r11
+  803f04:	00 00 00 
+  803f07:	4c 01 d8             	add    %r11,%rax
+  803f0a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803f0e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803f12:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803f15:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803f18:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803f1c:	ba 04 00 00 00       	mov    $0x4,%edx
+  803f21:	48 89 ce             	mov    %rcx,%rsi
+  803f24:	bf 06 00 00 00       	mov    $0x6,%edi
+  803f29:	48 b9 36 84 ff ff ff 	movabs $0xffffffffffff8436,%rcx
+  803f30:	ff ff ff 
+  803f33:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803f37:	ff d0                	call   *%rax
+}
+  803f39:	c9                   	leave
+  803f3a:	c3                   	ret
+
+0000000000803f3b <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803f3b:	55                   	push   %rbp
+  803f3c:	48 89 e5             	mov    %rsp,%rbp
+  803f3f:	41 57                	push   %r15
+  803f41:	53                   	push   %rbx
+  803f42:	48 83 ec 60          	sub    $0x60,%rsp
+  803f46:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f46 <devfile_read+0xb>
+  803f4d:	49 bb 62 78 00 00 00 	movabs $0x7862,%r11
+  803f54:	00 00 00 
+  803f57:	4c 01 db             	add    %r11,%rbx
+  803f5a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803f5e:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803f62:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  803f66:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803f6a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803f6e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803f72:	8b 50 0c             	mov    0xc(%rax),%edx
+  803f75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f79:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803f7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f7f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  803f83:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  803f87:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803f8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803f90:	ba 10 00 00 00       	mov    $0x10,%edx
+  803f95:	48 89 c6             	mov    %rax,%rsi
+  803f98:	bf 03 00 00 00       	mov    $0x3,%edi
+  803f9d:	48 b8 ca 84 ff ff ff 	movabs $0xffffffffffff84ca,%rax
+  803fa4:	ff ff ff 
+  803fa7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fab:	ff d0                	call   *%rax
+  803fad:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803fb0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803fb4:	79 05                	jns    803fbb <devfile_read+0x80>
+		return r;
+  803fb6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fb9:	eb 64                	jmp    80401f <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803fbb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fbe:	48 63 d0             	movslq %eax,%rdx
+  803fc1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803fc5:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803fca:	48 01 c1             	add    %rax,%rcx
+  803fcd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803fd1:	48 89 ce             	mov    %rcx,%rsi
+  803fd4:	48 89 c7             	mov    %rax,%rdi
+  803fd7:	49 89 df             	mov    %rbx,%r15
+  803fda:	48 b8 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rax
+  803fe1:	ff ff ff 
+  803fe4:	48 01 d8             	add    %rbx,%rax
+  803fe7:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803fe9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803ff0:	ff ff ff 
+  803ff3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ff7:	48 8b 00             	mov    (%rax),%rax
+  803ffa:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804000:	89 c6                	mov    %eax,%esi
+  804002:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804007:	48 89 c7             	mov    %rax,%rdi
+  80400a:	49 89 df             	mov    %rbx,%r15
+  80400d:	48 b8 bf bc ff ff ff 	movabs $0xffffffffffffbcbf,%rax
+  804014:	ff ff ff 
+  804017:	48 01 d8             	add    %rbx,%rax
+  80401a:	ff d0                	call   *%rax
+	return r;
+  80401c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  80401f:	48 83 c4 60          	add    $0x60,%rsp
+  804023:	5b                   	pop    %rbx
+  804024:	41 5f                	pop    %r15
+  804026:	5d                   	pop    %rbp
+  804027:	c3                   	ret
+
+0000000000804028 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804028:	55                   	push   %rbp
+  804029:	48 89 e5             	mov    %rsp,%rbp
+  80402c:	41 57                	push   %r15
+  80402e:	53                   	push   %rbx
+  80402f:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804033:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804033 <devfile_write+0xb>
+  80403a:	49 bb 75 77 00 00 00 	movabs $0x7775,%r11
+  804041:	00 00 00 
+  804044:	4c 01 db             	add    %r11,%rbx
+  804047:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80404b:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  80404f:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804056:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80405a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  80405e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804065:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804069:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804070:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804073:	48 63 d0             	movslq %eax,%rdx
+  804076:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80407a:	48 39 c2             	cmp    %rax,%rdx
+  80407d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804081:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804088:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80408f:	00 
+  804090:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804097:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80409b:	48 01 d0             	add    %rdx,%rax
+  80409e:	48 83 e8 01          	sub    $0x1,%rax
+  8040a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8040a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040af:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8040b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040b7:	48 29 d0             	sub    %rdx,%rax
+  8040ba:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040be:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8040c1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8040c4:	89 c6                	mov    %eax,%esi
+  8040c6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8040cb:	48 89 c7             	mov    %rax,%rdi
+  8040ce:	49 89 df             	mov    %rbx,%r15
+  8040d1:	48 b8 79 bc ff ff ff 	movabs $0xffffffffffffbc79,%rax
+  8040d8:	ff ff ff 
+  8040db:	48 01 d8             	add    %rbx,%rax
+  8040de:	ff d0                	call   *%rax
+  8040e0:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8040e3:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8040e7:	79 08                	jns    8040f1 <devfile_write+0xc9>
+		return r;
+  8040e9:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8040ec:	e9 8f 00 00 00       	jmp    804180 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8040f1:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8040f8:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8040fc:	48 89 c6             	mov    %rax,%rsi
+  8040ff:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804104:	48 89 c7             	mov    %rax,%rdi
+  804107:	49 89 df             	mov    %rbx,%r15
+  80410a:	48 b8 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rax
+  804111:	ff ff ff 
+  804114:	48 01 d8             	add    %rbx,%rax
+  804117:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804119:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80411d:	8b 50 0c             	mov    0xc(%rax),%edx
+  804120:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804124:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804126:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80412a:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804131:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804135:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804138:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80413c:	89 d1                	mov    %edx,%ecx
+  80413e:	ba 10 00 00 00       	mov    $0x10,%edx
+  804143:	48 89 c6             	mov    %rax,%rsi
+  804146:	bf 04 00 00 00       	mov    $0x4,%edi
+  80414b:	48 b8 ca 84 ff ff ff 	movabs $0xffffffffffff84ca,%rax
+  804152:	ff ff ff 
+  804155:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804159:	ff d0                	call   *%rax
+  80415b:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80415e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804161:	89 c6                	mov    %eax,%esi
+  804163:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804168:	48 89 c7             	mov    %rax,%rdi
+  80416b:	49 89 df             	mov    %rbx,%r15
+  80416e:	48 b8 bf bc ff ff ff 	movabs $0xffffffffffffbcbf,%rax
+  804175:	ff ff ff 
+  804178:	48 01 d8             	add    %rbx,%rax
+  80417b:	ff d0                	call   *%rax
+	return r;
+  80417d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804180:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804184:	5b                   	pop    %rbx
+  804185:	41 5f                	pop    %r15
+  804187:	5d                   	pop    %rbp
+  804188:	c3                   	ret
+
+0000000000804189 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804189:	55                   	push   %rbp
+  80418a:	48 89 e5             	mov    %rsp,%rbp
+  80418d:	41 57                	push   %r15
+  80418f:	53                   	push   %rbx
+  804190:	48 83 ec 20          	sub    $0x20,%rsp
+  804194:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804194 <devfile_stat+0xb>
+  80419b:	49 bb 14 76 00 00 00 	movabs $0x7614,%r11
+  8041a2:	00 00 00 
+  8041a5:	4c 01 db             	add    %r11,%rbx
+  8041a8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8041ac:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8041b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041b4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041b7:	48 ba 58 38 01 00 00 	movabs $0x13858,%rdx
+  8041be:	00 00 00 
+  8041c1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8041c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8041c9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8041ce:	48 b8 8e 83 ff ff ff 	movabs $0xffffffffffff838e,%rax
+  8041d5:	ff ff ff 
+  8041d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041dc:	ff d0                	call   *%rax
+  8041de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041e1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041e5:	79 05                	jns    8041ec <devfile_stat+0x63>
+		return r;
+  8041e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041ea:	eb 65                	jmp    804251 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8041ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8041f0:	48 ba 58 38 01 00 00 	movabs $0x13858,%rdx
+  8041f7:	00 00 00 
+  8041fa:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8041fe:	48 89 d6             	mov    %rdx,%rsi
+  804201:	48 89 c7             	mov    %rax,%rdi
+  804204:	49 89 df             	mov    %rbx,%r15
+  804207:	48 b8 2a 63 ff ff ff 	movabs $0xffffffffffff632a,%rax
+  80420e:	ff ff ff 
+  804211:	48 01 d8             	add    %rbx,%rax
+  804214:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804216:	48 b8 58 38 01 00 00 	movabs $0x13858,%rax
+  80421d:	00 00 00 
+  804220:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804227:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80422b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804231:	48 b8 58 38 01 00 00 	movabs $0x13858,%rax
+  804238:	00 00 00 
+  80423b:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804242:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804246:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  80424c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804251:	48 83 c4 20          	add    $0x20,%rsp
+  804255:	5b                   	pop    %rbx
+  804256:	41 5f                	pop    %r15
+  804258:	5d                   	pop    %rbp
+  804259:	c3                   	ret
+
+000000000080425a <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80425a:	55                   	push   %rbp
+  80425b:	48 89 e5             	mov    %rsp,%rbp
+  80425e:	48 83 ec 20          	sub    $0x20,%rsp
+  804262:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804262 <devfile_trunc+0x8>
+  804269:	49 bb 46 75 00 00 00 	movabs $0x7546,%r11
+  804270:	00 00 00 
+  804273:	4c 01 d8             	add    %r11,%rax
+  804276:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80427a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80427d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804281:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804284:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804287:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80428a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80428d:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804291:	ba 08 00 00 00       	mov    $0x8,%edx
+  804296:	48 89 ce             	mov    %rcx,%rsi
+  804299:	bf 02 00 00 00       	mov    $0x2,%edi
+  80429e:	48 b9 36 84 ff ff ff 	movabs $0xffffffffffff8436,%rcx
+  8042a5:	ff ff ff 
+  8042a8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8042ac:	ff d0                	call   *%rax
+}
+  8042ae:	c9                   	leave
+  8042af:	c3                   	ret
+
+00000000008042b0 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8042b0:	55                   	push   %rbp
+  8042b1:	48 89 e5             	mov    %rsp,%rbp
+  8042b4:	41 57                	push   %r15
+  8042b6:	53                   	push   %rbx
+  8042b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8042bb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042bb <remove+0xb>
+  8042c2:	49 bb ed 74 00 00 00 	movabs $0x74ed,%r11
+  8042c9:	00 00 00 
+  8042cc:	4c 01 db             	add    %r11,%rbx
+  8042cf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8042d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d7:	48 89 c7             	mov    %rax,%rdi
+  8042da:	49 89 df             	mov    %rbx,%r15
+  8042dd:	48 b8 96 62 ff ff ff 	movabs $0xffffffffffff6296,%rax
+  8042e4:	ff ff ff 
+  8042e7:	48 01 d8             	add    %rbx,%rax
+  8042ea:	ff d0                	call   *%rax
+  8042ec:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8042f1:	7e 07                	jle    8042fa <remove+0x4a>
+		return -E_BAD_PATH;
+  8042f3:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8042f8:	eb 44                	jmp    80433e <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8042fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042fe:	48 89 c6             	mov    %rax,%rsi
+  804301:	48 b8 58 38 01 00 00 	movabs $0x13858,%rax
+  804308:	00 00 00 
+  80430b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80430f:	48 89 c7             	mov    %rax,%rdi
+  804312:	49 89 df             	mov    %rbx,%r15
+  804315:	48 b8 2a 63 ff ff ff 	movabs $0xffffffffffff632a,%rax
+  80431c:	ff ff ff 
+  80431f:	48 01 d8             	add    %rbx,%rax
+  804322:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804324:	be 00 00 00 00       	mov    $0x0,%esi
+  804329:	bf 07 00 00 00       	mov    $0x7,%edi
+  80432e:	48 b8 8e 83 ff ff ff 	movabs $0xffffffffffff838e,%rax
+  804335:	ff ff ff 
+  804338:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80433c:	ff d0                	call   *%rax
+}
+  80433e:	48 83 c4 10          	add    $0x10,%rsp
+  804342:	5b                   	pop    %rbx
+  804343:	41 5f                	pop    %r15
+  804345:	5d                   	pop    %rbp
+  804346:	c3                   	ret
+
+0000000000804347 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804347:	55                   	push   %rbp
+  804348:	48 89 e5             	mov    %rsp,%rbp
+  80434b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80434b <sync+0x4>
+  804352:	49 bb 5d 74 00 00 00 	movabs $0x745d,%r11
+  804359:	00 00 00 
+  80435c:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80435f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804364:	be 00 00 00 00       	mov    $0x0,%esi
+  804369:	bf 08 00 00 00       	mov    $0x8,%edi
+  80436e:	48 b9 36 84 ff ff ff 	movabs $0xffffffffffff8436,%rcx
+  804375:	ff ff ff 
+  804378:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80437c:	ff d0                	call   *%rax
+}
+  80437e:	5d                   	pop    %rbp
+  80437f:	c3                   	ret
+
+0000000000804380 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804380:	55                   	push   %rbp
+  804381:	48 89 e5             	mov    %rsp,%rbp
+  804384:	41 57                	push   %r15
+  804386:	53                   	push   %rbx
+  804387:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80438e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80438e <copy+0xe>
+  804395:	49 bb 1a 74 00 00 00 	movabs $0x741a,%r11
+  80439c:	00 00 00 
+  80439f:	4c 01 db             	add    %r11,%rbx
+  8043a2:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8043a9:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8043b0:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8043b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8043bc:	48 89 c7             	mov    %rax,%rdi
+  8043bf:	48 b8 d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rax
+  8043c6:	ff ff ff 
+  8043c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043cd:	ff d0                	call   *%rax
+  8043cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8043d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043d6:	79 35                	jns    80440d <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8043d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043db:	89 c6                	mov    %eax,%esi
+  8043dd:	48 b8 8e c4 ff ff ff 	movabs $0xffffffffffffc48e,%rax
+  8043e4:	ff ff ff 
+  8043e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043eb:	48 89 c7             	mov    %rax,%rdi
+  8043ee:	49 89 df             	mov    %rbx,%r15
+  8043f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043f6:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  8043fd:	ff ff ff 
+  804400:	48 01 da             	add    %rbx,%rdx
+  804403:	ff d2                	call   *%rdx
+		return fd_src;
+  804405:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804408:	e9 d7 01 00 00       	jmp    8045e4 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  80440d:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804414:	be 01 01 00 00       	mov    $0x101,%esi
+  804419:	48 89 c7             	mov    %rax,%rdi
+  80441c:	48 b8 d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rax
+  804423:	ff ff ff 
+  804426:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80442a:	ff d0                	call   *%rax
+  80442c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  80442f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804433:	0f 89 df 00 00 00    	jns    804518 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804439:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80443c:	89 c6                	mov    %eax,%esi
+  80443e:	48 b8 a4 c4 ff ff ff 	movabs $0xffffffffffffc4a4,%rax
+  804445:	ff ff ff 
+  804448:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80444c:	48 89 c7             	mov    %rax,%rdi
+  80444f:	49 89 df             	mov    %rbx,%r15
+  804452:	b8 00 00 00 00       	mov    $0x0,%eax
+  804457:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  80445e:	ff ff ff 
+  804461:	48 01 da             	add    %rbx,%rdx
+  804464:	ff d2                	call   *%rdx
+		close(fd_src);
+  804466:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804469:	89 c7                	mov    %eax,%edi
+  80446b:	49 89 df             	mov    %rbx,%r15
+  80446e:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  804475:	ff ff ff 
+  804478:	48 01 d8             	add    %rbx,%rax
+  80447b:	ff d0                	call   *%rax
+		return fd_dest;
+  80447d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804480:	e9 5f 01 00 00       	jmp    8045e4 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804485:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804488:	48 63 d0             	movslq %eax,%rdx
+  80448b:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804492:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804495:	48 89 ce             	mov    %rcx,%rsi
+  804498:	89 c7                	mov    %eax,%edi
+  80449a:	49 89 df             	mov    %rbx,%r15
+  80449d:	48 b8 ac 7f ff ff ff 	movabs $0xffffffffffff7fac,%rax
+  8044a4:	ff ff ff 
+  8044a7:	48 01 d8             	add    %rbx,%rax
+  8044aa:	ff d0                	call   *%rax
+  8044ac:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8044af:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8044b3:	79 63                	jns    804518 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8044b5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8044b8:	89 c6                	mov    %eax,%esi
+  8044ba:	48 b8 be c4 ff ff ff 	movabs $0xffffffffffffc4be,%rax
+  8044c1:	ff ff ff 
+  8044c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044c8:	48 89 c7             	mov    %rax,%rdi
+  8044cb:	49 89 df             	mov    %rbx,%r15
+  8044ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d3:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  8044da:	ff ff ff 
+  8044dd:	48 01 da             	add    %rbx,%rdx
+  8044e0:	ff d2                	call   *%rdx
+			close(fd_src);
+  8044e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044e5:	89 c7                	mov    %eax,%edi
+  8044e7:	49 89 df             	mov    %rbx,%r15
+  8044ea:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  8044f1:	ff ff ff 
+  8044f4:	48 01 d8             	add    %rbx,%rax
+  8044f7:	ff d0                	call   *%rax
+			close(fd_dest);
+  8044f9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8044fc:	89 c7                	mov    %eax,%edi
+  8044fe:	49 89 df             	mov    %rbx,%r15
+  804501:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  804508:	ff ff ff 
+  80450b:	48 01 d8             	add    %rbx,%rax
+  80450e:	ff d0                	call   *%rax
+			return write_size;
+  804510:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804513:	e9 cc 00 00 00       	jmp    8045e4 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804518:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80451f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804522:	ba 00 02 00 00       	mov    $0x200,%edx
+  804527:	48 89 ce             	mov    %rcx,%rsi
+  80452a:	89 c7                	mov    %eax,%edi
+  80452c:	49 89 df             	mov    %rbx,%r15
+  80452f:	48 b8 06 7e ff ff ff 	movabs $0xffffffffffff7e06,%rax
+  804536:	ff ff ff 
+  804539:	48 01 d8             	add    %rbx,%rax
+  80453c:	ff d0                	call   *%rax
+  80453e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804541:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804545:	0f 8f 3a ff ff ff    	jg     804485 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  80454b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80454f:	79 60                	jns    8045b1 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804551:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804554:	89 c6                	mov    %eax,%esi
+  804556:	48 b8 d1 c4 ff ff ff 	movabs $0xffffffffffffc4d1,%rax
+  80455d:	ff ff ff 
+  804560:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804564:	48 89 c7             	mov    %rax,%rdi
+  804567:	49 89 df             	mov    %rbx,%r15
+  80456a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80456f:	48 ba 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rdx
+  804576:	ff ff ff 
+  804579:	48 01 da             	add    %rbx,%rdx
+  80457c:	ff d2                	call   *%rdx
+		close(fd_src);
+  80457e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804581:	89 c7                	mov    %eax,%edi
+  804583:	49 89 df             	mov    %rbx,%r15
+  804586:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  80458d:	ff ff ff 
+  804590:	48 01 d8             	add    %rbx,%rax
+  804593:	ff d0                	call   *%rax
+		close(fd_dest);
+  804595:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804598:	89 c7                	mov    %eax,%edi
+  80459a:	49 89 df             	mov    %rbx,%r15
+  80459d:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  8045a4:	ff ff ff 
+  8045a7:	48 01 d8             	add    %rbx,%rax
+  8045aa:	ff d0                	call   *%rax
+		return read_size;
+  8045ac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045af:	eb 33                	jmp    8045e4 <copy+0x264>
+	}
+	close(fd_src);
+  8045b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045b4:	89 c7                	mov    %eax,%edi
+  8045b6:	49 89 df             	mov    %rbx,%r15
+  8045b9:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  8045c0:	ff ff ff 
+  8045c3:	48 01 d8             	add    %rbx,%rax
+  8045c6:	ff d0                	call   *%rax
+	close(fd_dest);
+  8045c8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045cb:	89 c7                	mov    %eax,%edi
+  8045cd:	49 89 df             	mov    %rbx,%r15
+  8045d0:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  8045d7:	ff ff ff 
+  8045da:	48 01 d8             	add    %rbx,%rax
+  8045dd:	ff d0                	call   *%rax
+	return 0;
+  8045df:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8045e4:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8045eb:	5b                   	pop    %rbx
+  8045ec:	41 5f                	pop    %r15
+  8045ee:	5d                   	pop    %rbp
+  8045ef:	c3                   	ret
+
+00000000008045f0 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8045f0:	55                   	push   %rbp
+  8045f1:	48 89 e5             	mov    %rsp,%rbp
+  8045f4:	41 57                	push   %r15
+  8045f6:	53                   	push   %rbx
+  8045f7:	48 81 ec 00 03 00 00 	sub    $0x300,%rsp
+  8045fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045fe <spawn+0xe>
+  804605:	49 bb aa 71 00 00 00 	movabs $0x71aa,%r11
+  80460c:	00 00 00 
+  80460f:	4c 01 db             	add    %r11,%rbx
+  804612:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  804619:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  804620:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804627:	be 00 00 00 00       	mov    $0x0,%esi
+  80462c:	48 89 c7             	mov    %rax,%rdi
+  80462f:	49 89 df             	mov    %rbx,%r15
+  804632:	48 b8 d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rax
+  804639:	ff ff ff 
+  80463c:	48 01 d8             	add    %rbx,%rax
+  80463f:	ff d0                	call   *%rax
+  804641:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804644:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804648:	79 08                	jns    804652 <spawn+0x62>
+		return r;
+  80464a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80464d:	e9 9e 04 00 00       	jmp    804af0 <spawn+0x500>
+	fd = r;
+  804652:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804655:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+  804658:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+  80465f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  804663:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+  80466a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80466d:	ba 00 02 00 00       	mov    $0x200,%edx
+  804672:	48 89 ce             	mov    %rcx,%rsi
+  804675:	89 c7                	mov    %eax,%edi
+  804677:	49 89 df             	mov    %rbx,%r15
+  80467a:	48 b8 19 7f ff ff ff 	movabs $0xffffffffffff7f19,%rax
+  804681:	ff ff ff 
+  804684:	48 01 d8             	add    %rbx,%rax
+  804687:	ff d0                	call   *%rax
+  804689:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80468e:	75 0d                	jne    80469d <spawn+0xad>
+            || elf->e_magic != ELF_MAGIC) {
+  804690:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804694:	8b 00                	mov    (%rax),%eax
+  804696:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  80469b:	74 56                	je     8046f3 <spawn+0x103>
+		close(fd);
+  80469d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8046a0:	89 c7                	mov    %eax,%edi
+  8046a2:	49 89 df             	mov    %rbx,%r15
+  8046a5:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  8046ac:	ff ff ff 
+  8046af:	48 01 d8             	add    %rbx,%rax
+  8046b2:	ff d0                	call   *%rax
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8046b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046b8:	8b 00                	mov    (%rax),%eax
+  8046ba:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8046bf:	89 c6                	mov    %eax,%esi
+  8046c1:	48 b8 e8 c4 ff ff ff 	movabs $0xffffffffffffc4e8,%rax
+  8046c8:	ff ff ff 
+  8046cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046cf:	48 89 c7             	mov    %rax,%rdi
+  8046d2:	49 89 df             	mov    %rbx,%r15
+  8046d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046da:	48 b9 68 55 ff ff ff 	movabs $0xffffffffffff5568,%rcx
+  8046e1:	ff ff ff 
+  8046e4:	48 01 d9             	add    %rbx,%rcx
+  8046e7:	ff d1                	call   *%rcx
+		return -E_NOT_EXEC;
+  8046e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8046ee:	e9 fd 03 00 00       	jmp    804af0 <spawn+0x500>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8046f3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8046f8:	cd 30                	int    $0x30
+  8046fa:	89 45 c0             	mov    %eax,-0x40(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8046fd:	8b 45 c0             	mov    -0x40(%rbp),%eax
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  804700:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804703:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804707:	79 08                	jns    804711 <spawn+0x121>
+		return r;
+  804709:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80470c:	e9 df 03 00 00       	jmp    804af0 <spawn+0x500>
+	child = r;
+  804711:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804714:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  804717:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80471a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80471f:	89 c1                	mov    %eax,%ecx
+  804721:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  804728:	ff ff ff 
+  80472b:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  80472f:	48 63 c1             	movslq %ecx,%rax
+  804732:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  804739:	48 01 d0             	add    %rdx,%rax
+  80473c:	48 8b 30             	mov    (%rax),%rsi
+  80473f:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  804743:	48 89 b5 00 fd ff ff 	mov    %rsi,-0x300(%rbp)
+  80474a:	48 89 bd 08 fd ff ff 	mov    %rdi,-0x2f8(%rbp)
+  804751:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  804755:	48 8b 78 18          	mov    0x18(%rax),%rdi
+  804759:	48 89 b5 10 fd ff ff 	mov    %rsi,-0x2f0(%rbp)
+  804760:	48 89 bd 18 fd ff ff 	mov    %rdi,-0x2e8(%rbp)
+  804767:	48 8b 70 20          	mov    0x20(%rax),%rsi
+  80476b:	48 8b 78 28          	mov    0x28(%rax),%rdi
+  80476f:	48 89 b5 20 fd ff ff 	mov    %rsi,-0x2e0(%rbp)
+  804776:	48 89 bd 28 fd ff ff 	mov    %rdi,-0x2d8(%rbp)
+  80477d:	48 8b 70 30          	mov    0x30(%rax),%rsi
+  804781:	48 8b 78 38          	mov    0x38(%rax),%rdi
+  804785:	48 89 b5 30 fd ff ff 	mov    %rsi,-0x2d0(%rbp)
+  80478c:	48 89 bd 38 fd ff ff 	mov    %rdi,-0x2c8(%rbp)
+  804793:	48 8b 70 40          	mov    0x40(%rax),%rsi
+  804797:	48 8b 78 48          	mov    0x48(%rax),%rdi
+  80479b:	48 89 b5 40 fd ff ff 	mov    %rsi,-0x2c0(%rbp)
+  8047a2:	48 89 bd 48 fd ff ff 	mov    %rdi,-0x2b8(%rbp)
+  8047a9:	48 8b 70 50          	mov    0x50(%rax),%rsi
+  8047ad:	48 8b 78 58          	mov    0x58(%rax),%rdi
+  8047b1:	48 89 b5 50 fd ff ff 	mov    %rsi,-0x2b0(%rbp)
+  8047b8:	48 89 bd 58 fd ff ff 	mov    %rdi,-0x2a8(%rbp)
+  8047bf:	48 8b 70 60          	mov    0x60(%rax),%rsi
+  8047c3:	48 8b 78 68          	mov    0x68(%rax),%rdi
+  8047c7:	48 89 b5 60 fd ff ff 	mov    %rsi,-0x2a0(%rbp)
+  8047ce:	48 89 bd 68 fd ff ff 	mov    %rdi,-0x298(%rbp)
+  8047d5:	48 8b 70 70          	mov    0x70(%rax),%rsi
+  8047d9:	48 8b 78 78          	mov    0x78(%rax),%rdi
+  8047dd:	48 89 b5 70 fd ff ff 	mov    %rsi,-0x290(%rbp)
+  8047e4:	48 89 bd 78 fd ff ff 	mov    %rdi,-0x288(%rbp)
+  8047eb:	48 8b b0 80 00 00 00 	mov    0x80(%rax),%rsi
+  8047f2:	48 8b b8 88 00 00 00 	mov    0x88(%rax),%rdi
+  8047f9:	48 89 b5 80 fd ff ff 	mov    %rsi,-0x280(%rbp)
+  804800:	48 89 bd 88 fd ff ff 	mov    %rdi,-0x278(%rbp)
+  804807:	48 8b b0 90 00 00 00 	mov    0x90(%rax),%rsi
+  80480e:	48 8b b8 98 00 00 00 	mov    0x98(%rax),%rdi
+  804815:	48 89 b5 90 fd ff ff 	mov    %rsi,-0x270(%rbp)
+  80481c:	48 89 bd 98 fd ff ff 	mov    %rdi,-0x268(%rbp)
+  804823:	48 8b b0 a0 00 00 00 	mov    0xa0(%rax),%rsi
+  80482a:	48 8b b8 a8 00 00 00 	mov    0xa8(%rax),%rdi
+  804831:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  804838:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  80483f:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  804846:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  80484d:	48 89 85 b0 fd ff ff 	mov    %rax,-0x250(%rbp)
+  804854:	48 89 95 b8 fd ff ff 	mov    %rdx,-0x248(%rbp)
+	child_tf.tf_rip = elf->e_entry;
+  80485b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80485f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804863:	48 89 85 98 fd ff ff 	mov    %rax,-0x268(%rbp)
+
+	if ((r = init_stack(child, argv, &child_tf.tf_rsp)) < 0)
+  80486a:	48 8d 85 00 fd ff ff 	lea    -0x300(%rbp),%rax
+  804871:	48 8d 90 b0 00 00 00 	lea    0xb0(%rax),%rdx
+  804878:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  80487f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804882:	48 89 ce             	mov    %rcx,%rsi
+  804885:	89 c7                	mov    %eax,%edi
+  804887:	48 b8 d6 95 ff ff ff 	movabs $0xffffffffffff95d6,%rax
+  80488e:	ff ff ff 
+  804891:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804895:	ff d0                	call   *%rax
+  804897:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80489a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80489e:	79 08                	jns    8048a8 <spawn+0x2b8>
+		return r;
+  8048a0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8048a3:	e9 48 02 00 00       	jmp    804af0 <spawn+0x500>
+
+	// Set up program segments as defined in ELF header.
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  8048a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048ac:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8048b0:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8048b7:	48 01 d0             	add    %rdx,%rax
+  8048ba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8048be:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8048c5:	e9 84 00 00 00       	jmp    80494e <spawn+0x35e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8048ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048ce:	8b 00                	mov    (%rax),%eax
+  8048d0:	83 f8 01             	cmp    $0x1,%eax
+  8048d3:	75 6f                	jne    804944 <spawn+0x354>
+			continue;
+		perm = PTE_P | PTE_U;
+  8048d5:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8048dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048e0:	8b 40 04             	mov    0x4(%rax),%eax
+  8048e3:	83 e0 02             	and    $0x2,%eax
+  8048e6:	85 c0                	test   %eax,%eax
+  8048e8:	74 04                	je     8048ee <spawn+0x2fe>
+			perm |= PTE_W;
+  8048ea:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+				     fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  8048ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048f2:	48 8b 40 08          	mov    0x8(%rax),%rax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8048f6:	41 89 c1             	mov    %eax,%r9d
+  8048f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048fd:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  804901:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804905:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  804909:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80490d:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  804911:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804914:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804917:	48 83 ec 08          	sub    $0x8,%rsp
+  80491b:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80491e:	57                   	push   %rdi
+  80491f:	89 c7                	mov    %eax,%edi
+  804921:	48 b8 e8 98 ff ff ff 	movabs $0xffffffffffff98e8,%rax
+  804928:	ff ff ff 
+  80492b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80492f:	ff d0                	call   *%rax
+  804931:	48 83 c4 10          	add    $0x10,%rsp
+  804935:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804938:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80493c:	0f 88 7c 01 00 00    	js     804abe <spawn+0x4ce>
+  804942:	eb 01                	jmp    804945 <spawn+0x355>
+			continue;
+  804944:	90                   	nop
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  804945:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804949:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  80494e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804952:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  804956:	0f b7 c0             	movzwl %ax,%eax
+  804959:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80495c:	0f 8c 68 ff ff ff    	jl     8048ca <spawn+0x2da>
+			goto error;
+	}
+	close(fd);
+  804962:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804965:	89 c7                	mov    %eax,%edi
+  804967:	49 89 df             	mov    %rbx,%r15
+  80496a:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  804971:	ff ff ff 
+  804974:	48 01 d8             	add    %rbx,%rax
+  804977:	ff d0                	call   *%rax
+	fd = -1;
+  804979:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+	// Copy shared library state.
+	if ((r = copy_shared_pages(child)) < 0)
+  804980:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804983:	89 c7                	mov    %eax,%edi
+  804985:	48 b8 af 9d ff ff ff 	movabs $0xffffffffffff9daf,%rax
+  80498c:	ff ff ff 
+  80498f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804993:	ff d0                	call   *%rax
+  804995:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804998:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80499c:	79 44                	jns    8049e2 <spawn+0x3f2>
+		panic("copy_shared_pages: %e", r);
+  80499e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8049a1:	89 c1                	mov    %eax,%ecx
+  8049a3:	48 b8 02 c5 ff ff ff 	movabs $0xffffffffffffc502,%rax
+  8049aa:	ff ff ff 
+  8049ad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049b1:	48 89 c2             	mov    %rax,%rdx
+  8049b4:	be 82 00 00 00       	mov    $0x82,%esi
+  8049b9:	48 b8 18 c5 ff ff ff 	movabs $0xffffffffffffc518,%rax
+  8049c0:	ff ff ff 
+  8049c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049c7:	48 89 c7             	mov    %rax,%rdi
+  8049ca:	49 89 df             	mov    %rbx,%r15
+  8049cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049d2:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  8049d9:	ff ff ff 
+  8049dc:	49 01 d8             	add    %rbx,%r8
+  8049df:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8049e2:	48 8d 95 00 fd ff ff 	lea    -0x300(%rbp),%rdx
+  8049e9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049ec:	48 89 d6             	mov    %rdx,%rsi
+  8049ef:	89 c7                	mov    %eax,%edi
+  8049f1:	49 89 df             	mov    %rbx,%r15
+  8049f4:	48 b8 7d 71 ff ff ff 	movabs $0xffffffffffff717d,%rax
+  8049fb:	ff ff ff 
+  8049fe:	48 01 d8             	add    %rbx,%rax
+  804a01:	ff d0                	call   *%rax
+  804a03:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804a06:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804a0a:	79 44                	jns    804a50 <spawn+0x460>
+		panic("sys_env_set_trapframe: %e", r);
+  804a0c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804a0f:	89 c1                	mov    %eax,%ecx
+  804a11:	48 b8 24 c5 ff ff ff 	movabs $0xffffffffffffc524,%rax
+  804a18:	ff ff ff 
+  804a1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a1f:	48 89 c2             	mov    %rax,%rdx
+  804a22:	be 85 00 00 00       	mov    $0x85,%esi
+  804a27:	48 b8 18 c5 ff ff ff 	movabs $0xffffffffffffc518,%rax
+  804a2e:	ff ff ff 
+  804a31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a35:	48 89 c7             	mov    %rax,%rdi
+  804a38:	49 89 df             	mov    %rbx,%r15
+  804a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a40:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  804a47:	ff ff ff 
+  804a4a:	49 01 d8             	add    %rbx,%r8
+  804a4d:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  804a50:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a53:	be 02 00 00 00       	mov    $0x2,%esi
+  804a58:	89 c7                	mov    %eax,%edi
+  804a5a:	49 89 df             	mov    %rbx,%r15
+  804a5d:	48 b8 1d 71 ff ff ff 	movabs $0xffffffffffff711d,%rax
+  804a64:	ff ff ff 
+  804a67:	48 01 d8             	add    %rbx,%rax
+  804a6a:	ff d0                	call   *%rax
+  804a6c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804a6f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804a73:	79 44                	jns    804ab9 <spawn+0x4c9>
+		panic("sys_env_set_status: %e", r);
+  804a75:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804a78:	89 c1                	mov    %eax,%ecx
+  804a7a:	48 b8 3e c5 ff ff ff 	movabs $0xffffffffffffc53e,%rax
+  804a81:	ff ff ff 
+  804a84:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a88:	48 89 c2             	mov    %rax,%rdx
+  804a8b:	be 88 00 00 00       	mov    $0x88,%esi
+  804a90:	48 b8 18 c5 ff ff ff 	movabs $0xffffffffffffc518,%rax
+  804a97:	ff ff ff 
+  804a9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a9e:	48 89 c7             	mov    %rax,%rdi
+  804aa1:	49 89 df             	mov    %rbx,%r15
+  804aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aa9:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  804ab0:	ff ff ff 
+  804ab3:	49 01 d8             	add    %rbx,%r8
+  804ab6:	41 ff d0             	call   *%r8
+
+	return child;
+  804ab9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804abc:	eb 32                	jmp    804af0 <spawn+0x500>
+			goto error;
+  804abe:	90                   	nop
+
+error:
+	sys_env_destroy(child);
+  804abf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804ac2:	89 c7                	mov    %eax,%edi
+  804ac4:	49 89 df             	mov    %rbx,%r15
+  804ac7:	48 b8 e1 6e ff ff ff 	movabs $0xffffffffffff6ee1,%rax
+  804ace:	ff ff ff 
+  804ad1:	48 01 d8             	add    %rbx,%rax
+  804ad4:	ff d0                	call   *%rax
+	close(fd);
+  804ad6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804ad9:	89 c7                	mov    %eax,%edi
+  804adb:	49 89 df             	mov    %rbx,%r15
+  804ade:	48 b8 4e 7b ff ff ff 	movabs $0xffffffffffff7b4e,%rax
+  804ae5:	ff ff ff 
+  804ae8:	48 01 d8             	add    %rbx,%rax
+  804aeb:	ff d0                	call   *%rax
+	return r;
+  804aed:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  804af0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804af4:	5b                   	pop    %rbx
+  804af5:	41 5f                	pop    %r15
+  804af7:	5d                   	pop    %rbp
+  804af8:	c3                   	ret
+
+0000000000804af9 <spawnl>:
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...)
+{
+  804af9:	55                   	push   %rbp
+  804afa:	48 89 e5             	mov    %rsp,%rbp
+  804afd:	41 57                	push   %r15
+  804aff:	41 56                	push   %r14
+  804b01:	41 55                	push   %r13
+  804b03:	41 54                	push   %r12
+  804b05:	53                   	push   %rbx
+  804b06:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804b0d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804b0d <spawnl+0x14>
+  804b14:	49 bb 9b 6c 00 00 00 	movabs $0x6c9b,%r11
+  804b1b:	00 00 00 
+  804b1e:	4d 01 da             	add    %r11,%r10
+  804b21:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  804b28:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  804b2f:	48 89 95 30 ff ff ff 	mov    %rdx,-0xd0(%rbp)
+  804b36:	48 89 8d 38 ff ff ff 	mov    %rcx,-0xc8(%rbp)
+  804b3d:	4c 89 85 40 ff ff ff 	mov    %r8,-0xc0(%rbp)
+  804b44:	4c 89 8d 48 ff ff ff 	mov    %r9,-0xb8(%rbp)
+  804b4b:	84 c0                	test   %al,%al
+  804b4d:	74 29                	je     804b78 <spawnl+0x7f>
+  804b4f:	0f 29 85 50 ff ff ff 	movaps %xmm0,-0xb0(%rbp)
+  804b56:	0f 29 8d 60 ff ff ff 	movaps %xmm1,-0xa0(%rbp)
+  804b5d:	0f 29 95 70 ff ff ff 	movaps %xmm2,-0x90(%rbp)
+  804b64:	0f 29 5d 80          	movaps %xmm3,-0x80(%rbp)
+  804b68:	0f 29 65 90          	movaps %xmm4,-0x70(%rbp)
+  804b6c:	0f 29 6d a0          	movaps %xmm5,-0x60(%rbp)
+  804b70:	0f 29 75 b0          	movaps %xmm6,-0x50(%rbp)
+  804b74:	0f 29 7d c0          	movaps %xmm7,-0x40(%rbp)
+  804b78:	48 89 e0             	mov    %rsp,%rax
+  804b7b:	48 89 c3             	mov    %rax,%rbx
+	// We calculate argc by advancing the args until we hit NULL.
+	// The contract of the function guarantees that the last
+	// argument will always be NULL, and that none of the other
+	// arguments will be NULL.
+	int argc=0;
+  804b7e:	c7 85 1c ff ff ff 00 	movl   $0x0,-0xe4(%rbp)
+  804b85:	00 00 00 
+	va_list vl;
+	va_start(vl, arg0);
+  804b88:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  804b8f:	00 00 00 
+  804b92:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  804b99:	00 00 00 
+  804b9c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804ba0:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  804ba7:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  804bae:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  804bb5:	eb 07                	jmp    804bbe <spawnl+0xc5>
+		argc++;
+  804bb7:	83 85 1c ff ff ff 01 	addl   $0x1,-0xe4(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  804bbe:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  804bc4:	83 f8 2f             	cmp    $0x2f,%eax
+  804bc7:	77 23                	ja     804bec <spawnl+0xf3>
+  804bc9:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  804bd0:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  804bd6:	89 d2                	mov    %edx,%edx
+  804bd8:	48 01 d0             	add    %rdx,%rax
+  804bdb:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  804be1:	83 c2 08             	add    $0x8,%edx
+  804be4:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  804bea:	eb 12                	jmp    804bfe <spawnl+0x105>
+  804bec:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  804bf3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804bf7:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  804bfe:	48 8b 00             	mov    (%rax),%rax
+  804c01:	48 85 c0             	test   %rax,%rax
+  804c04:	75 b1                	jne    804bb7 <spawnl+0xbe>
+	va_end(vl);
+
+	// Now that we have the size of the args, do a second pass
+	// and store the values in a VLA, which has the format of argv
+	const char *argv[argc+2];
+  804c06:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  804c0c:	83 c0 02             	add    $0x2,%eax
+  804c0f:	48 63 d0             	movslq %eax,%rdx
+  804c12:	48 83 ea 01          	sub    $0x1,%rdx
+  804c16:	48 89 95 10 ff ff ff 	mov    %rdx,-0xf0(%rbp)
+  804c1d:	48 63 d0             	movslq %eax,%rdx
+  804c20:	49 89 d6             	mov    %rdx,%r14
+  804c23:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  804c29:	48 63 d0             	movslq %eax,%rdx
+  804c2c:	49 89 d4             	mov    %rdx,%r12
+  804c2f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804c35:	48 98                	cltq
+  804c37:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804c3e:	00 
+  804c3f:	b8 10 00 00 00       	mov    $0x10,%eax
+  804c44:	48 83 e8 01          	sub    $0x1,%rax
+  804c48:	48 01 d0             	add    %rdx,%rax
+  804c4b:	be 10 00 00 00       	mov    $0x10,%esi
+  804c50:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c55:	48 f7 f6             	div    %rsi
+  804c58:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  804c5c:	48 29 c4             	sub    %rax,%rsp
+  804c5f:	48 89 e0             	mov    %rsp,%rax
+  804c62:	48 83 c0 07          	add    $0x7,%rax
+  804c66:	48 c1 e8 03          	shr    $0x3,%rax
+  804c6a:	48 c1 e0 03          	shl    $0x3,%rax
+  804c6e:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+	argv[0] = arg0;
+  804c75:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c7c:	48 8b 95 e0 fe ff ff 	mov    -0x120(%rbp),%rdx
+  804c83:	48 89 10             	mov    %rdx,(%rax)
+	argv[argc+1] = NULL;
+  804c86:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  804c8c:	8d 50 01             	lea    0x1(%rax),%edx
+  804c8f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c96:	48 63 d2             	movslq %edx,%rdx
+  804c99:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  804ca0:	00 
+
+	va_start(vl, arg0);
+  804ca1:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  804ca8:	00 00 00 
+  804cab:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  804cb2:	00 00 00 
+  804cb5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804cb9:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  804cc0:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  804cc7:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	unsigned i;
+	for(i=0;i<argc;i++)
+  804cce:	c7 85 18 ff ff ff 00 	movl   $0x0,-0xe8(%rbp)
+  804cd5:	00 00 00 
+  804cd8:	eb 60                	jmp    804d3a <spawnl+0x241>
+		argv[i+1] = va_arg(vl, const char *);
+  804cda:	8b 85 18 ff ff ff    	mov    -0xe8(%rbp),%eax
+  804ce0:	8d 48 01             	lea    0x1(%rax),%ecx
+  804ce3:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  804ce9:	83 f8 2f             	cmp    $0x2f,%eax
+  804cec:	77 23                	ja     804d11 <spawnl+0x218>
+  804cee:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  804cf5:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  804cfb:	89 d2                	mov    %edx,%edx
+  804cfd:	48 01 d0             	add    %rdx,%rax
+  804d00:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  804d06:	83 c2 08             	add    $0x8,%edx
+  804d09:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  804d0f:	eb 12                	jmp    804d23 <spawnl+0x22a>
+  804d11:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  804d18:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804d1c:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  804d23:	48 8b 10             	mov    (%rax),%rdx
+  804d26:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804d2d:	89 c9                	mov    %ecx,%ecx
+  804d2f:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+	for(i=0;i<argc;i++)
+  804d33:	83 85 18 ff ff ff 01 	addl   $0x1,-0xe8(%rbp)
+  804d3a:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  804d40:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%rbp)
+  804d46:	72 92                	jb     804cda <spawnl+0x1e1>
+	va_end(vl);
+	return spawn(prog, argv);
+  804d48:	48 8b 95 08 ff ff ff 	mov    -0xf8(%rbp),%rdx
+  804d4f:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  804d56:	48 89 d6             	mov    %rdx,%rsi
+  804d59:	48 89 c7             	mov    %rax,%rdi
+  804d5c:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  804d63:	ff ff ff 
+  804d66:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804d6a:	ff d0                	call   *%rax
+  804d6c:	48 89 dc             	mov    %rbx,%rsp
+}
+  804d6f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804d73:	5b                   	pop    %rbx
+  804d74:	41 5c                	pop    %r12
+  804d76:	41 5d                	pop    %r13
+  804d78:	41 5e                	pop    %r14
+  804d7a:	41 5f                	pop    %r15
+  804d7c:	5d                   	pop    %rbp
+  804d7d:	c3                   	ret
+
+0000000000804d7e <init_stack>:
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp)
+{
+  804d7e:	55                   	push   %rbp
+  804d7f:	48 89 e5             	mov    %rsp,%rbp
+  804d82:	41 57                	push   %r15
+  804d84:	53                   	push   %rbx
+  804d85:	48 83 ec 50          	sub    $0x50,%rsp
+  804d89:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d89 <init_stack+0xb>
+  804d90:	49 bb 1f 6a 00 00 00 	movabs $0x6a1f,%r11
+  804d97:	00 00 00 
+  804d9a:	4c 01 db             	add    %r11,%rbx
+  804d9d:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  804da0:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  804da4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *string_store;
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+  804da8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804daf:	00 
+	for (argc = 0; argv[argc] != 0; argc++)
+  804db0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  804db7:	eb 39                	jmp    804df2 <init_stack+0x74>
+		string_size += strlen(argv[argc]) + 1;
+  804db9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804dbc:	48 98                	cltq
+  804dbe:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804dc5:	00 
+  804dc6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804dca:	48 01 d0             	add    %rdx,%rax
+  804dcd:	48 8b 00             	mov    (%rax),%rax
+  804dd0:	48 89 c7             	mov    %rax,%rdi
+  804dd3:	49 89 df             	mov    %rbx,%r15
+  804dd6:	48 b8 96 62 ff ff ff 	movabs $0xffffffffffff6296,%rax
+  804ddd:	ff ff ff 
+  804de0:	48 01 d8             	add    %rbx,%rax
+  804de3:	ff d0                	call   *%rax
+  804de5:	83 c0 01             	add    $0x1,%eax
+  804de8:	48 98                	cltq
+  804dea:	48 01 45 e8          	add    %rax,-0x18(%rbp)
+	for (argc = 0; argv[argc] != 0; argc++)
+  804dee:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  804df2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804df5:	48 98                	cltq
+  804df7:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804dfe:	00 
+  804dff:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e03:	48 01 d0             	add    %rdx,%rax
+  804e06:	48 8b 00             	mov    (%rax),%rax
+  804e09:	48 85 c0             	test   %rax,%rax
+  804e0c:	75 ab                	jne    804db9 <init_stack+0x3b>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  804e0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e12:	48 f7 d8             	neg    %rax
+  804e15:	48 05 00 10 40 00    	add    $0x401000,%rax
+  804e1b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  804e1f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e23:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804e27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e2b:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  804e2f:	48 89 c2             	mov    %rax,%rdx
+  804e32:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e35:	83 c0 01             	add    $0x1,%eax
+  804e38:	c1 e0 03             	shl    $0x3,%eax
+  804e3b:	48 98                	cltq
+  804e3d:	48 f7 d8             	neg    %rax
+  804e40:	48 01 d0             	add    %rdx,%rax
+  804e43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  804e47:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e4b:	48 83 e8 10          	sub    $0x10,%rax
+  804e4f:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  804e55:	77 0a                	ja     804e61 <init_stack+0xe3>
+		return -E_NO_MEM;
+  804e57:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  804e5c:	e9 26 02 00 00       	jmp    805087 <init_stack+0x309>
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  804e61:	ba 07 00 00 00       	mov    $0x7,%edx
+  804e66:	be 00 00 40 00       	mov    $0x400000,%esi
+  804e6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e70:	49 89 df             	mov    %rbx,%r15
+  804e73:	48 b8 e6 6f ff ff ff 	movabs $0xffffffffffff6fe6,%rax
+  804e7a:	ff ff ff 
+  804e7d:	48 01 d8             	add    %rbx,%rax
+  804e80:	ff d0                	call   *%rax
+  804e82:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804e85:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804e89:	79 08                	jns    804e93 <init_stack+0x115>
+		return r;
+  804e8b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e8e:	e9 f4 01 00 00       	jmp    805087 <init_stack+0x309>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  804e93:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+  804e9a:	e9 96 00 00 00       	jmp    804f35 <init_stack+0x1b7>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  804e9f:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  804ea4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ea8:	48 01 d0             	add    %rdx,%rax
+  804eab:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  804eb2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804eb5:	48 98                	cltq
+  804eb7:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  804ebe:	00 
+  804ebf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ec3:	48 01 c8             	add    %rcx,%rax
+  804ec6:	48 89 10             	mov    %rdx,(%rax)
+		strcpy(string_store, argv[i]);
+  804ec9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804ecc:	48 98                	cltq
+  804ece:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804ed5:	00 
+  804ed6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804eda:	48 01 d0             	add    %rdx,%rax
+  804edd:	48 8b 10             	mov    (%rax),%rdx
+  804ee0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ee4:	48 89 d6             	mov    %rdx,%rsi
+  804ee7:	48 89 c7             	mov    %rax,%rdi
+  804eea:	49 89 df             	mov    %rbx,%r15
+  804eed:	48 b8 2a 63 ff ff ff 	movabs $0xffffffffffff632a,%rax
+  804ef4:	ff ff ff 
+  804ef7:	48 01 d8             	add    %rbx,%rax
+  804efa:	ff d0                	call   *%rax
+		string_store += strlen(argv[i]) + 1;
+  804efc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804eff:	48 98                	cltq
+  804f01:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804f08:	00 
+  804f09:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f0d:	48 01 d0             	add    %rdx,%rax
+  804f10:	48 8b 00             	mov    (%rax),%rax
+  804f13:	48 89 c7             	mov    %rax,%rdi
+  804f16:	49 89 df             	mov    %rbx,%r15
+  804f19:	48 b8 96 62 ff ff ff 	movabs $0xffffffffffff6296,%rax
+  804f20:	ff ff ff 
+  804f23:	48 01 d8             	add    %rbx,%rax
+  804f26:	ff d0                	call   *%rax
+  804f28:	83 c0 01             	add    $0x1,%eax
+  804f2b:	48 98                	cltq
+  804f2d:	48 01 45 d0          	add    %rax,-0x30(%rbp)
+	for (i = 0; i < argc; i++) {
+  804f31:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+  804f35:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804f38:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804f3b:	0f 8c 5e ff ff ff    	jl     804e9f <init_stack+0x121>
+	}
+	argv_store[argc] = 0;
+  804f41:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804f44:	48 98                	cltq
+  804f46:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804f4d:	00 
+  804f4e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f52:	48 01 d0             	add    %rdx,%rax
+  804f55:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  804f5c:	48 81 7d d0 00 10 40 	cmpq   $0x401000,-0x30(%rbp)
+  804f63:	00 
+  804f64:	74 50                	je     804fb6 <init_stack+0x238>
+  804f66:	48 b8 58 c5 ff ff ff 	movabs $0xffffffffffffc558,%rax
+  804f6d:	ff ff ff 
+  804f70:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f74:	48 89 c1             	mov    %rax,%rcx
+  804f77:	48 b8 7e c5 ff ff ff 	movabs $0xffffffffffffc57e,%rax
+  804f7e:	ff ff ff 
+  804f81:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f85:	48 89 c2             	mov    %rax,%rdx
+  804f88:	be f1 00 00 00       	mov    $0xf1,%esi
+  804f8d:	48 b8 18 c5 ff ff ff 	movabs $0xffffffffffffc518,%rax
+  804f94:	ff ff ff 
+  804f97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f9b:	48 89 c7             	mov    %rax,%rdi
+  804f9e:	49 89 df             	mov    %rbx,%r15
+  804fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fa6:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  804fad:	ff ff ff 
+  804fb0:	49 01 d8             	add    %rbx,%r8
+  804fb3:	41 ff d0             	call   *%r8
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  804fb6:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  804fbb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804fbf:	48 01 d0             	add    %rdx,%rax
+  804fc2:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  804fc9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804fcd:	48 83 e8 08          	sub    $0x8,%rax
+  804fd1:	48 89 10             	mov    %rdx,(%rax)
+	argv_store[-2] = argc;
+  804fd4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804fd8:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  804fdc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804fdf:	48 98                	cltq
+  804fe1:	48 89 02             	mov    %rax,(%rdx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  804fe4:	ba f0 cf 7f ef       	mov    $0xef7fcff0,%edx
+  804fe9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804fed:	48 01 d0             	add    %rdx,%rax
+  804ff0:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  804ff6:	48 89 c2             	mov    %rax,%rdx
+  804ff9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804ffd:	48 89 10             	mov    %rdx,(%rax)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  805000:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805003:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  805009:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  80500e:	48 89 d1             	mov    %rdx,%rcx
+  805011:	89 c2                	mov    %eax,%edx
+  805013:	be 00 00 40 00       	mov    $0x400000,%esi
+  805018:	bf 00 00 00 00       	mov    $0x0,%edi
+  80501d:	49 89 df             	mov    %rbx,%r15
+  805020:	48 b8 4b 70 ff ff ff 	movabs $0xffffffffffff704b,%rax
+  805027:	ff ff ff 
+  80502a:	48 01 d8             	add    %rbx,%rax
+  80502d:	ff d0                	call   *%rax
+  80502f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  805032:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805036:	78 2c                	js     805064 <init_stack+0x2e6>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  805038:	be 00 00 40 00       	mov    $0x400000,%esi
+  80503d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805042:	49 89 df             	mov    %rbx,%r15
+  805045:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  80504c:	ff ff ff 
+  80504f:	48 01 d8             	add    %rbx,%rax
+  805052:	ff d0                	call   *%rax
+  805054:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  805057:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80505b:	78 0a                	js     805067 <init_stack+0x2e9>
+		goto error;
+
+	return 0;
+  80505d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805062:	eb 23                	jmp    805087 <init_stack+0x309>
+		goto error;
+  805064:	90                   	nop
+  805065:	eb 01                	jmp    805068 <init_stack+0x2ea>
+		goto error;
+  805067:	90                   	nop
+
+error:
+	sys_page_unmap(0, UTEMP);
+  805068:	be 00 00 40 00       	mov    $0x400000,%esi
+  80506d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805072:	49 89 df             	mov    %rbx,%r15
+  805075:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  80507c:	ff ff ff 
+  80507f:	48 01 d8             	add    %rbx,%rax
+  805082:	ff d0                	call   *%rax
+	return r;
+  805084:	8b 45 dc             	mov    -0x24(%rbp),%eax
+}
+  805087:	48 83 c4 50          	add    $0x50,%rsp
+  80508b:	5b                   	pop    %rbx
+  80508c:	41 5f                	pop    %r15
+  80508e:	5d                   	pop    %rbp
+  80508f:	c3                   	ret
+
+0000000000805090 <map_segment>:
+#define SEG_BATCH	PAGE_BATCH_CHUNK
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+	    int fd, size_t filesz, off_t fileoffset, int perm)
+{
+  805090:	55                   	push   %rbp
+  805091:	48 89 e5             	mov    %rsp,%rbp
+  805094:	41 57                	push   %r15
+  805096:	53                   	push   %rbx
+  805097:	48 81 ec 70 0c 00 00 	sub    $0xc70,%rsp
+  80509e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80509e <map_segment+0xe>
+  8050a5:	49 bb 0a 67 00 00 00 	movabs $0x670a,%r11
+  8050ac:	00 00 00 
+  8050af:	4c 01 db             	add    %r11,%rbx
+  8050b2:	89 bd ac f3 ff ff    	mov    %edi,-0xc54(%rbp)
+  8050b8:	48 89 b5 a0 f3 ff ff 	mov    %rsi,-0xc60(%rbp)
+  8050bf:	48 89 95 98 f3 ff ff 	mov    %rdx,-0xc68(%rbp)
+  8050c6:	89 8d a8 f3 ff ff    	mov    %ecx,-0xc58(%rbp)
+  8050cc:	4c 89 85 90 f3 ff ff 	mov    %r8,-0xc70(%rbp)
+  8050d3:	44 89 8d 8c f3 ff ff 	mov    %r9d,-0xc74(%rbp)
+	int i, j, n, nfile, r;
+	void *tmp;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  8050da:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  8050e1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8050e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050ed:	74 2d                	je     80511c <map_segment+0x8c>
+		va -= i;
+  8050ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050f2:	48 98                	cltq
+  8050f4:	48 29 85 a0 f3 ff ff 	sub    %rax,-0xc60(%rbp)
+		memsz += i;
+  8050fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050fe:	48 98                	cltq
+  805100:	48 01 85 98 f3 ff ff 	add    %rax,-0xc68(%rbp)
+		filesz += i;
+  805107:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80510a:	48 98                	cltq
+  80510c:	48 01 85 90 f3 ff ff 	add    %rax,-0xc70(%rbp)
+		fileoffset -= i;
+  805113:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805116:	29 85 8c f3 ff ff    	sub    %eax,-0xc74(%rbp)
+	}
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  80511c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805123:	e9 db 03 00 00       	jmp    805503 <map_segment+0x473>
+		n = MIN((memsz - i + PGSIZE - 1) / PGSIZE, SEG_BATCH);
+  805128:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80512b:	48 98                	cltq
+  80512d:	48 8b 95 98 f3 ff ff 	mov    -0xc68(%rbp),%rdx
+  805134:	48 29 c2             	sub    %rax,%rdx
+  805137:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80513e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805142:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  805146:	c7 45 d4 20 00 00 00 	movl   $0x20,-0x2c(%rbp)
+  80514d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805150:	48 63 d0             	movslq %eax,%rdx
+  805153:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805157:	48 39 c2             	cmp    %rax,%rdx
+  80515a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80515e:	89 45 d0             	mov    %eax,-0x30(%rbp)
+
+		// Allocate blank pages straight into the child, and pages
+		// for the file's contents at UTEMP in our address space.
+		nfile = 0;
+  805161:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+		for (j = 0; j < n; j++) {
+  805168:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  80516f:	e9 ea 01 00 00       	jmp    80535e <map_segment+0x2ce>
+			if (i + j * PGSIZE < filesz) {
+  805174:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805177:	c1 e0 0c             	shl    $0xc,%eax
+  80517a:	89 c2                	mov    %eax,%edx
+  80517c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80517f:	01 d0                	add    %edx,%eax
+  805181:	48 98                	cltq
+  805183:	48 3b 85 90 f3 ff ff 	cmp    -0xc70(%rbp),%rax
+  80518a:	0f 83 57 01 00 00    	jae    8052e7 <map_segment+0x257>
+				tmp = UTEMP + nfile * PGSIZE;
+  805190:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805193:	c1 e0 0c             	shl    $0xc,%eax
+  805196:	48 98                	cltq
+  805198:	48 05 00 00 40 00    	add    $0x400000,%rax
+  80519e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+				alloc[j].dstenvid = 0;
+  8051a2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8051a5:	48 98                	cltq
+  8051a7:	48 c1 e0 05          	shl    $0x5,%rax
+  8051ab:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8051af:	48 01 e8             	add    %rbp,%rax
+  8051b2:	48 2d 3c 04 00 00    	sub    $0x43c,%rax
+  8051b8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				alloc[j].dstva = (uintptr_t) tmp;
+  8051be:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8051c2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8051c5:	48 63 d2             	movslq %edx,%rdx
+  8051c8:	48 c1 e2 05          	shl    $0x5,%rdx
+  8051cc:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  8051d0:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  8051d4:	48 81 ea 30 04 00 00 	sub    $0x430,%rdx
+  8051db:	48 89 02             	mov    %rax,(%rdx)
+				alloc[j].perm = PTE_P|PTE_U|PTE_W;
+  8051de:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8051e1:	48 98                	cltq
+  8051e3:	48 c1 e0 05          	shl    $0x5,%rax
+  8051e7:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8051eb:	48 01 e8             	add    %rbp,%rax
+  8051ee:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  8051f4:	c7 00 07 00 00 00    	movl   $0x7,(%rax)
+				map[nfile].srcenvid = 0;
+  8051fa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8051fd:	48 98                	cltq
+  8051ff:	48 c1 e0 05          	shl    $0x5,%rax
+  805203:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805207:	48 01 e8             	add    %rbp,%rax
+  80520a:	48 2d 40 08 00 00    	sub    $0x840,%rax
+  805210:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				map[nfile].srcva = (uintptr_t) tmp;
+  805216:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80521a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80521d:	48 63 d2             	movslq %edx,%rdx
+  805220:	48 c1 e2 05          	shl    $0x5,%rdx
+  805224:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  805228:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  80522c:	48 81 ea 38 08 00 00 	sub    $0x838,%rdx
+  805233:	48 89 02             	mov    %rax,(%rdx)
+				map[nfile].dstenvid = child;
+  805236:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805239:	48 98                	cltq
+  80523b:	48 c1 e0 05          	shl    $0x5,%rax
+  80523f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805243:	48 01 e8             	add    %rbp,%rax
+  805246:	48 8d 90 c4 f7 ff ff 	lea    -0x83c(%rax),%rdx
+  80524d:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  805253:	89 02                	mov    %eax,(%rdx)
+				map[nfile].dstva = va + i + j * PGSIZE;
+  805255:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805258:	48 63 d0             	movslq %eax,%rdx
+  80525b:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  805262:	48 01 c2             	add    %rax,%rdx
+  805265:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805268:	c1 e0 0c             	shl    $0xc,%eax
+  80526b:	48 98                	cltq
+  80526d:	48 01 c2             	add    %rax,%rdx
+  805270:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805273:	48 98                	cltq
+  805275:	48 c1 e0 05          	shl    $0x5,%rax
+  805279:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80527d:	48 01 e8             	add    %rbp,%rax
+  805280:	48 2d 30 08 00 00    	sub    $0x830,%rax
+  805286:	48 89 10             	mov    %rdx,(%rax)
+				map[nfile].perm = perm;
+  805289:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80528c:	48 98                	cltq
+  80528e:	48 c1 e0 05          	shl    $0x5,%rax
+  805292:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805296:	48 01 e8             	add    %rbp,%rax
+  805299:	48 8d 90 d8 f7 ff ff 	lea    -0x828(%rax),%rdx
+  8052a0:	8b 45 10             	mov    0x10(%rbp),%eax
+  8052a3:	89 02                	mov    %eax,(%rdx)
+				unmap[nfile].dstenvid = 0;
+  8052a5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8052a8:	48 98                	cltq
+  8052aa:	48 c1 e0 05          	shl    $0x5,%rax
+  8052ae:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8052b2:	48 01 e8             	add    %rbp,%rax
+  8052b5:	48 2d 3c 0c 00 00    	sub    $0xc3c,%rax
+  8052bb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				unmap[nfile].dstva = (uintptr_t) tmp;
+  8052c1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8052c5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8052c8:	48 63 d2             	movslq %edx,%rdx
+  8052cb:	48 c1 e2 05          	shl    $0x5,%rdx
+  8052cf:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  8052d3:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  8052d7:	48 81 ea 30 0c 00 00 	sub    $0xc30,%rdx
+  8052de:	48 89 02             	mov    %rax,(%rdx)
+				nfile++;
+  8052e1:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  8052e5:	eb 73                	jmp    80535a <map_segment+0x2ca>
+			} else {
+				// Blank (BSS) pages are only allocated
+				// once the child writes to them.
+				alloc[j].dstenvid = child;
+  8052e7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8052ea:	48 98                	cltq
+  8052ec:	48 c1 e0 05          	shl    $0x5,%rax
+  8052f0:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8052f4:	48 01 e8             	add    %rbp,%rax
+  8052f7:	48 8d 90 c4 fb ff ff 	lea    -0x43c(%rax),%rdx
+  8052fe:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  805304:	89 02                	mov    %eax,(%rdx)
+				alloc[j].dstva = va + i + j * PGSIZE;
+  805306:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805309:	48 63 d0             	movslq %eax,%rdx
+  80530c:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  805313:	48 01 c2             	add    %rax,%rdx
+  805316:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805319:	c1 e0 0c             	shl    $0xc,%eax
+  80531c:	48 98                	cltq
+  80531e:	48 01 c2             	add    %rax,%rdx
+  805321:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805324:	48 98                	cltq
+  805326:	48 c1 e0 05          	shl    $0x5,%rax
+  80532a:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80532e:	48 01 e8             	add    %rbp,%rax
+  805331:	48 2d 30 04 00 00    	sub    $0x430,%rax
+  805337:	48 89 10             	mov    %rdx,(%rax)
+				alloc[j].perm = perm | PTE_LAZY;
+  80533a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80533d:	80 cc 10             	or     $0x10,%ah
+  805340:	89 c2                	mov    %eax,%edx
+  805342:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805345:	48 98                	cltq
+  805347:	48 c1 e0 05          	shl    $0x5,%rax
+  80534b:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80534f:	48 01 e8             	add    %rbp,%rax
+  805352:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  805358:	89 10                	mov    %edx,(%rax)
+		for (j = 0; j < n; j++) {
+  80535a:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  80535e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805361:	3b 45 d0             	cmp    -0x30(%rbp),%eax
+  805364:	0f 8c 0a fe ff ff    	jl     805174 <map_segment+0xe4>
+			}
+		}
+		if ((r = sys_page_alloc_batch(alloc, n)) < 0)
+  80536a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80536d:	48 63 d0             	movslq %eax,%rdx
+  805370:	48 8d 85 b0 fb ff ff 	lea    -0x450(%rbp),%rax
+  805377:	48 89 d6             	mov    %rdx,%rsi
+  80537a:	48 89 c7             	mov    %rax,%rdi
+  80537d:	49 89 df             	mov    %rbx,%r15
+  805380:	48 b8 7f 76 ff ff ff 	movabs $0xffffffffffff767f,%rax
+  805387:	ff ff ff 
+  80538a:	48 01 d8             	add    %rbx,%rax
+  80538d:	ff d0                	call   *%rax
+  80538f:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  805392:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805396:	0f 88 80 01 00 00    	js     80551c <map_segment+0x48c>
+			goto out;
+
+		// from file
+		for (j = 0; j < nfile; j++) {
+  80539c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  8053a3:	e9 af 00 00 00       	jmp    805457 <map_segment+0x3c7>
+			if ((r = seek(fd, fileoffset + i + j * PGSIZE)) < 0)
+  8053a8:	8b 95 8c f3 ff ff    	mov    -0xc74(%rbp),%edx
+  8053ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b1:	01 c2                	add    %eax,%edx
+  8053b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053b6:	c1 e0 0c             	shl    $0xc,%eax
+  8053b9:	01 c2                	add    %eax,%edx
+  8053bb:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  8053c1:	89 d6                	mov    %edx,%esi
+  8053c3:	89 c7                	mov    %eax,%edi
+  8053c5:	49 89 df             	mov    %rbx,%r15
+  8053c8:	48 b8 be 80 ff ff ff 	movabs $0xffffffffffff80be,%rax
+  8053cf:	ff ff ff 
+  8053d2:	48 01 d8             	add    %rbx,%rax
+  8053d5:	ff d0                	call   *%rax
+  8053d7:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8053da:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8053de:	0f 88 3b 01 00 00    	js     80551f <map_segment+0x48f>
+				goto out;
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+				       MIN(PGSIZE, filesz - i - j * PGSIZE))) < 0)
+  8053e4:	c7 45 cc 00 10 00 00 	movl   $0x1000,-0x34(%rbp)
+  8053eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053ee:	48 98                	cltq
+  8053f0:	48 8b 95 90 f3 ff ff 	mov    -0xc70(%rbp),%rdx
+  8053f7:	48 29 c2             	sub    %rax,%rdx
+  8053fa:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053fd:	c1 e0 0c             	shl    $0xc,%eax
+  805400:	48 98                	cltq
+  805402:	48 29 c2             	sub    %rax,%rdx
+  805405:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805409:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80540c:	48 63 d0             	movslq %eax,%rdx
+  80540f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805413:	48 39 c2             	cmp    %rax,%rdx
+  805416:	48 0f 47 d0          	cmova  %rax,%rdx
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+  80541a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80541d:	c1 e0 0c             	shl    $0xc,%eax
+  805420:	48 98                	cltq
+  805422:	48 8d 88 00 00 40 00 	lea    0x400000(%rax),%rcx
+  805429:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  80542f:	48 89 ce             	mov    %rcx,%rsi
+  805432:	89 c7                	mov    %eax,%edi
+  805434:	49 89 df             	mov    %rbx,%r15
+  805437:	48 b8 19 7f ff ff ff 	movabs $0xffffffffffff7f19,%rax
+  80543e:	ff ff ff 
+  805441:	48 01 d8             	add    %rbx,%rax
+  805444:	ff d0                	call   *%rax
+  805446:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  805449:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80544d:	0f 88 cf 00 00 00    	js     805522 <map_segment+0x492>
+		for (j = 0; j < nfile; j++) {
+  805453:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  805457:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80545a:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80545d:	0f 8c 45 ff ff ff    	jl     8053a8 <map_segment+0x318>
+				goto out;
+		}
+		if ((r = sys_page_map_batch(map, nfile)) < 0)
+  805463:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805466:	48 63 d0             	movslq %eax,%rdx
+  805469:	48 8d 85 b0 f7 ff ff 	lea    -0x850(%rbp),%rax
+  805470:	48 89 d6             	mov    %rdx,%rsi
+  805473:	48 89 c7             	mov    %rax,%rdi
+  805476:	49 89 df             	mov    %rbx,%r15
+  805479:	48 b8 21 76 ff ff ff 	movabs $0xffffffffffff7621,%rax
+  805480:	ff ff ff 
+  805483:	48 01 d8             	add    %rbx,%rax
+  805486:	ff d0                	call   *%rax
+  805488:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80548b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80548f:	79 44                	jns    8054d5 <map_segment+0x445>
+			panic("spawn: sys_page_map_batch data: %e", r);
+  805491:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805494:	89 c1                	mov    %eax,%ecx
+  805496:	48 b8 98 c5 ff ff ff 	movabs $0xffffffffffffc598,%rax
+  80549d:	ff ff ff 
+  8054a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054a4:	48 89 c2             	mov    %rax,%rdx
+  8054a7:	be 43 01 00 00       	mov    $0x143,%esi
+  8054ac:	48 b8 18 c5 ff ff ff 	movabs $0xffffffffffffc518,%rax
+  8054b3:	ff ff ff 
+  8054b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054ba:	48 89 c7             	mov    %rax,%rdi
+  8054bd:	49 89 df             	mov    %rbx,%r15
+  8054c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054c5:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  8054cc:	ff ff ff 
+  8054cf:	49 01 d8             	add    %rbx,%r8
+  8054d2:	41 ff d0             	call   *%r8
+		sys_page_unmap_batch(unmap, nfile);
+  8054d5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8054d8:	48 63 d0             	movslq %eax,%rdx
+  8054db:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  8054e2:	48 89 d6             	mov    %rdx,%rsi
+  8054e5:	48 89 c7             	mov    %rax,%rdi
+  8054e8:	49 89 df             	mov    %rbx,%r15
+  8054eb:	48 b8 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rax
+  8054f2:	ff ff ff 
+  8054f5:	48 01 d8             	add    %rbx,%rax
+  8054f8:	ff d0                	call   *%rax
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  8054fa:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8054fd:	c1 e0 0c             	shl    $0xc,%eax
+  805500:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805503:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805506:	48 98                	cltq
+  805508:	48 3b 85 98 f3 ff ff 	cmp    -0xc68(%rbp),%rax
+  80550f:	0f 82 13 fc ff ff    	jb     805128 <map_segment+0x98>
+	}
+	return 0;
+  805515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80551a:	eb 2f                	jmp    80554b <map_segment+0x4bb>
+			goto out;
+  80551c:	90                   	nop
+  80551d:	eb 04                	jmp    805523 <map_segment+0x493>
+				goto out;
+  80551f:	90                   	nop
+  805520:	eb 01                	jmp    805523 <map_segment+0x493>
+				goto out;
+  805522:	90                   	nop
+
+out:
+	sys_page_unmap_batch(unmap, nfile);
+  805523:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805526:	48 63 d0             	movslq %eax,%rdx
+  805529:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  805530:	48 89 d6             	mov    %rdx,%rsi
+  805533:	48 89 c7             	mov    %rax,%rdi
+  805536:	49 89 df             	mov    %rbx,%r15
+  805539:	48 b8 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rax
+  805540:	ff ff ff 
+  805543:	48 01 d8             	add    %rbx,%rax
+  805546:	ff d0                	call   *%rax
+	return r;
+  805548:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  80554b:	48 81 c4 70 0c 00 00 	add    $0xc70,%rsp
+  805552:	5b                   	pop    %rbx
+  805553:	41 5f                	pop    %r15
+  805555:	5d                   	pop    %rbp
+  805556:	c3                   	ret
+
+0000000000805557 <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  805557:	55                   	push   %rbp
+  805558:	48 89 e5             	mov    %rsp,%rbp
+  80555b:	41 57                	push   %r15
+  80555d:	53                   	push   %rbx
+  80555e:	48 83 ec 30          	sub    $0x30,%rsp
+  805562:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805562 <copy_shared_pages+0xb>
+  805569:	49 bb 46 62 00 00 00 	movabs $0x6246,%r11
+  805570:	00 00 00 
+  805573:	4c 01 db             	add    %r11,%rbx
+  805576:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	int r;
+	uint64_t addr = 0;
+  805579:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805580:	00 
+	for (; addr < USTACKTOP;){
+  805581:	e9 7f 02 00 00       	jmp    805805 <copy_shared_pages+0x2ae>
+		if (uvpde[VPDPE(addr)] & PTE_P){
+  805586:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80558a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80558e:	48 89 c2             	mov    %rax,%rdx
+  805591:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805598:	ff ff ff 
+  80559b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80559f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8055a3:	83 e0 01             	and    $0x1,%eax
+  8055a6:	48 85 c0             	test   %rax,%rax
+  8055a9:	0f 84 4e 02 00 00    	je     8057fd <copy_shared_pages+0x2a6>
+			//a 2MB page is described by its PDE, not by uvpt
+			if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  8055af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055b3:	48 c1 e8 15          	shr    $0x15,%rax
+  8055b7:	48 89 c2             	mov    %rax,%rdx
+  8055ba:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8055c1:	ff ff ff 
+  8055c4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8055c8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8055cc:	25 81 00 00 00       	and    $0x81,%eax
+  8055d1:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  8055d7:	0f 85 cf 00 00 00    	jne    8056ac <copy_shared_pages+0x155>
+				if (uvpd[VPD(addr)] & PTE_SHARE){
+  8055dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055e1:	48 c1 e8 15          	shr    $0x15,%rax
+  8055e5:	48 89 c2             	mov    %rax,%rdx
+  8055e8:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8055ef:	ff ff ff 
+  8055f2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8055f6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8055fa:	25 00 04 00 00       	and    $0x400,%eax
+  8055ff:	48 85 c0             	test   %rax,%rax
+  805602:	0f 84 97 00 00 00    	je     80569f <copy_shared_pages+0x148>
+					unsigned int perm = uvpd[VPD(addr)] & (PTE_SYSCALL);
+  805608:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80560c:	48 c1 e8 15          	shr    $0x15,%rax
+  805610:	48 89 c2             	mov    %rax,%rdx
+  805613:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80561a:	ff ff ff 
+  80561d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805621:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805625:	25 07 0e 00 00       	and    $0xe07,%eax
+  80562a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  80562d:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  805630:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805634:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805638:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80563b:	41 89 f0             	mov    %esi,%r8d
+  80563e:	48 89 c6             	mov    %rax,%rsi
+  805641:	bf 00 00 00 00       	mov    $0x0,%edi
+  805646:	49 89 df             	mov    %rbx,%r15
+  805649:	48 b8 4b 70 ff ff ff 	movabs $0xffffffffffff704b,%rax
+  805650:	ff ff ff 
+  805653:	48 01 d8             	add    %rbx,%rax
+  805656:	ff d0                	call   *%rax
+  805658:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  80565b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80565f:	79 3e                	jns    80569f <copy_shared_pages+0x148>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  805661:	48 b8 c0 c5 ff ff ff 	movabs $0xffffffffffffc5c0,%rax
+  805668:	ff ff ff 
+  80566b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80566f:	48 89 c2             	mov    %rax,%rdx
+  805672:	be 5b 01 00 00       	mov    $0x15b,%esi
+  805677:	48 b8 18 c5 ff ff ff 	movabs $0xffffffffffffc518,%rax
+  80567e:	ff ff ff 
+  805681:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805685:	48 89 c7             	mov    %rax,%rdi
+  805688:	49 89 df             	mov    %rbx,%r15
+  80568b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805690:	48 b9 91 52 ff ff ff 	movabs $0xffffffffffff5291,%rcx
+  805697:	ff ff ff 
+  80569a:	48 01 d9             	add    %rbx,%rcx
+  80569d:	ff d1                	call   *%rcx
+				}
+				addr += PTSIZE;
+  80569f:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8056a6:	00 
+  8056a7:	e9 59 01 00 00       	jmp    805805 <copy_shared_pages+0x2ae>
+			}
+			else if (uvpd[VPD(addr)] & PTE_P){
+  8056ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056b0:	48 c1 e8 15          	shr    $0x15,%rax
+  8056b4:	48 89 c2             	mov    %rax,%rdx
+  8056b7:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8056be:	ff ff ff 
+  8056c1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8056c5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8056c9:	83 e0 01             	and    $0x1,%eax
+  8056cc:	48 85 c0             	test   %rax,%rax
+  8056cf:	0f 84 1e 01 00 00    	je     8057f3 <copy_shared_pages+0x29c>
+				if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_SHARE && uvpt[VPN(addr)] & PTE_U){
+  8056d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056d9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8056dd:	48 89 c2             	mov    %rax,%rdx
+  8056e0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8056e7:	ff ff ff 
+  8056ea:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8056ee:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8056f2:	83 e0 01             	and    $0x1,%eax
+  8056f5:	48 85 c0             	test   %rax,%rax
+  8056f8:	0f 84 eb 00 00 00    	je     8057e9 <copy_shared_pages+0x292>
+  8056fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805702:	48 c1 e8 0c          	shr    $0xc,%rax
+  805706:	48 89 c2             	mov    %rax,%rdx
+  805709:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805710:	ff ff ff 
+  805713:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805717:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80571b:	25 00 04 00 00       	and    $0x400,%eax
+  805720:	48 85 c0             	test   %rax,%rax
+  805723:	0f 84 c0 00 00 00    	je     8057e9 <copy_shared_pages+0x292>
+  805729:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80572d:	48 c1 e8 0c          	shr    $0xc,%rax
+  805731:	48 89 c2             	mov    %rax,%rdx
+  805734:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80573b:	ff ff ff 
+  80573e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805742:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805746:	83 e0 04             	and    $0x4,%eax
+  805749:	48 85 c0             	test   %rax,%rax
+  80574c:	0f 84 97 00 00 00    	je     8057e9 <copy_shared_pages+0x292>
+					unsigned int perm = uvpt[VPN(addr)] & (PTE_SYSCALL);
+  805752:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805756:	48 c1 e8 0c          	shr    $0xc,%rax
+  80575a:	48 89 c2             	mov    %rax,%rdx
+  80575d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805764:	ff ff ff 
+  805767:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80576b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80576f:	25 07 0e 00 00       	and    $0xe07,%eax
+  805774:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  805777:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80577a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80577e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805782:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  805785:	41 89 f0             	mov    %esi,%r8d
+  805788:	48 89 c6             	mov    %rax,%rsi
+  80578b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805790:	49 89 df             	mov    %rbx,%r15
+  805793:	48 b8 4b 70 ff ff ff 	movabs $0xffffffffffff704b,%rax
+  80579a:	ff ff ff 
+  80579d:	48 01 d8             	add    %rbx,%rax
+  8057a0:	ff d0                	call   *%rax
+  8057a2:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  8057a5:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8057a9:	79 3e                	jns    8057e9 <copy_shared_pages+0x292>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  8057ab:	48 b8 c0 c5 ff ff ff 	movabs $0xffffffffffffc5c0,%rax
+  8057b2:	ff ff ff 
+  8057b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057b9:	48 89 c2             	mov    %rax,%rdx
+  8057bc:	be 64 01 00 00       	mov    $0x164,%esi
+  8057c1:	48 b8 18 c5 ff ff ff 	movabs $0xffffffffffffc518,%rax
+  8057c8:	ff ff ff 
+  8057cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057cf:	48 89 c7             	mov    %rax,%rdi
+  8057d2:	49 89 df             	mov    %rbx,%r15
+  8057d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057da:	48 b9 91 52 ff ff ff 	movabs $0xffffffffffff5291,%rcx
+  8057e1:	ff ff ff 
+  8057e4:	48 01 d9             	add    %rbx,%rcx
+  8057e7:	ff d1                	call   *%rcx
+				}
+				addr += PGSIZE;
+  8057e9:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8057f0:	00 
+  8057f1:	eb 12                	jmp    805805 <copy_shared_pages+0x2ae>
+			}
+			//we will discover a PDE not present is at 
+			//a multiple of PTSIZE;
+			else {
+				addr += PTSIZE;
+  8057f3:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8057fa:	00 
+  8057fb:	eb 08                	jmp    805805 <copy_shared_pages+0x2ae>
+			}
+		}
+		//we will discover a PDPE not present is at
+		//a multiple of PTSIZE * NPDENTRIES;    
+		else {
+			addr += PTSIZE * NPDENTRIES;
+  8057fd:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  805804:	40 
+	for (; addr < USTACKTOP;){
+  805805:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80580a:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80580e:	0f 83 72 fd ff ff    	jae    805586 <copy_shared_pages+0x2f>
+        	}
+        }
+
+	return 0;
+  805814:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805819:	48 83 c4 30          	add    $0x30,%rsp
+  80581d:	5b                   	pop    %rbx
+  80581e:	41 5f                	pop    %r15
+  805820:	5d                   	pop    %rbp
+  805821:	c3                   	ret
+
+0000000000805822 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805822:	55                   	push   %rbp
+  805823:	48 89 e5             	mov    %rsp,%rbp
+  805826:	41 57                	push   %r15
+  805828:	53                   	push   %rbx
+  805829:	48 83 ec 20          	sub    $0x20,%rsp
+  80582d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80582d <fd2sockid+0xb>
+  805834:	49 bb 7b 5f 00 00 00 	movabs $0x5f7b,%r11
+  80583b:	00 00 00 
+  80583e:	4c 01 db             	add    %r11,%rbx
+  805841:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805844:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805848:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80584b:	48 89 d6             	mov    %rdx,%rsi
+  80584e:	89 c7                	mov    %eax,%edi
+  805850:	49 89 df             	mov    %rbx,%r15
+  805853:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  80585a:	ff ff ff 
+  80585d:	48 01 d8             	add    %rbx,%rax
+  805860:	ff d0                	call   *%rax
+  805862:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805865:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805869:	79 05                	jns    805870 <fd2sockid+0x4e>
+		return r;
+  80586b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80586e:	eb 25                	jmp    805895 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805870:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805874:	8b 10                	mov    (%rax),%edx
+  805876:	48 b8 98 00 00 00 00 	movabs $0x98,%rax
+  80587d:	00 00 00 
+  805880:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805883:	39 c2                	cmp    %eax,%edx
+  805885:	74 07                	je     80588e <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  805887:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80588c:	eb 07                	jmp    805895 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  80588e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805892:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  805895:	48 83 c4 20          	add    $0x20,%rsp
+  805899:	5b                   	pop    %rbx
+  80589a:	41 5f                	pop    %r15
+  80589c:	5d                   	pop    %rbp
+  80589d:	c3                   	ret
+
+000000000080589e <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  80589e:	55                   	push   %rbp
+  80589f:	48 89 e5             	mov    %rsp,%rbp
+  8058a2:	41 57                	push   %r15
+  8058a4:	53                   	push   %rbx
+  8058a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8058a9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058a9 <alloc_sockfd+0xb>
+  8058b0:	49 bb ff 5e 00 00 00 	movabs $0x5eff,%r11
+  8058b7:	00 00 00 
+  8058ba:	4c 01 db             	add    %r11,%rbx
+  8058bd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8058c0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8058c4:	48 89 c7             	mov    %rax,%rdi
+  8058c7:	49 89 df             	mov    %rbx,%r15
+  8058ca:	48 b8 09 78 ff ff ff 	movabs $0xffffffffffff7809,%rax
+  8058d1:	ff ff ff 
+  8058d4:	48 01 d8             	add    %rbx,%rax
+  8058d7:	ff d0                	call   *%rax
+  8058d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058dc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058e0:	78 2c                	js     80590e <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8058e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058e6:	ba 07 04 00 00       	mov    $0x407,%edx
+  8058eb:	48 89 c6             	mov    %rax,%rsi
+  8058ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058f3:	49 89 df             	mov    %rbx,%r15
+  8058f6:	48 b8 e6 6f ff ff ff 	movabs $0xffffffffffff6fe6,%rax
+  8058fd:	ff ff ff 
+  805900:	48 01 d8             	add    %rbx,%rax
+  805903:	ff d0                	call   *%rax
+  805905:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805908:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80590c:	79 1c                	jns    80592a <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80590e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805911:	89 c7                	mov    %eax,%edi
+  805913:	49 89 df             	mov    %rbx,%r15
+  805916:	48 b8 ea a8 ff ff ff 	movabs $0xffffffffffffa8ea,%rax
+  80591d:	ff ff ff 
+  805920:	48 01 d8             	add    %rbx,%rax
+  805923:	ff d0                	call   *%rax
+		return r;
+  805925:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805928:	eb 41                	jmp    80596b <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80592a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80592e:	48 ba 98 00 00 00 00 	movabs $0x98,%rdx
+  805935:	00 00 00 
+  805938:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80593b:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  80593d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805941:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  805948:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80594c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80594f:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805952:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805956:	48 89 c7             	mov    %rax,%rdi
+  805959:	49 89 df             	mov    %rbx,%r15
+  80595c:	48 b8 8f 77 ff ff ff 	movabs $0xffffffffffff778f,%rax
+  805963:	ff ff ff 
+  805966:	48 01 d8             	add    %rbx,%rax
+  805969:	ff d0                	call   *%rax
+}
+  80596b:	48 83 c4 20          	add    $0x20,%rsp
+  80596f:	5b                   	pop    %rbx
+  805970:	41 5f                	pop    %r15
+  805972:	5d                   	pop    %rbp
+  805973:	c3                   	ret
+
+0000000000805974 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805974:	55                   	push   %rbp
+  805975:	48 89 e5             	mov    %rsp,%rbp
+  805978:	41 57                	push   %r15
+  80597a:	53                   	push   %rbx
+  80597b:	48 83 ec 30          	sub    $0x30,%rsp
+  80597f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80597f <accept+0xb>
+  805986:	49 bb 29 5e 00 00 00 	movabs $0x5e29,%r11
+  80598d:	00 00 00 
+  805990:	4c 01 db             	add    %r11,%rbx
+  805993:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805996:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80599a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80599e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8059a1:	89 c7                	mov    %eax,%edi
+  8059a3:	48 b8 7a a0 ff ff ff 	movabs $0xffffffffffffa07a,%rax
+  8059aa:	ff ff ff 
+  8059ad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8059b1:	ff d0                	call   *%rax
+  8059b3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059b6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059ba:	79 05                	jns    8059c1 <accept+0x4d>
+		return r;
+  8059bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059bf:	eb 45                	jmp    805a06 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8059c1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8059c5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8059c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059cc:	48 89 ce             	mov    %rcx,%rsi
+  8059cf:	89 c7                	mov    %eax,%edi
+  8059d1:	49 89 df             	mov    %rbx,%r15
+  8059d4:	48 b8 58 a7 ff ff ff 	movabs $0xffffffffffffa758,%rax
+  8059db:	ff ff ff 
+  8059de:	48 01 d8             	add    %rbx,%rax
+  8059e1:	ff d0                	call   *%rax
+  8059e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059ea:	79 05                	jns    8059f1 <accept+0x7d>
+		return r;
+  8059ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059ef:	eb 15                	jmp    805a06 <accept+0x92>
+	return alloc_sockfd(r);
+  8059f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059f4:	89 c7                	mov    %eax,%edi
+  8059f6:	48 b8 f6 a0 ff ff ff 	movabs $0xffffffffffffa0f6,%rax
+  8059fd:	ff ff ff 
+  805a00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a04:	ff d0                	call   *%rax
+}
+  805a06:	48 83 c4 30          	add    $0x30,%rsp
+  805a0a:	5b                   	pop    %rbx
+  805a0b:	41 5f                	pop    %r15
+  805a0d:	5d                   	pop    %rbp
+  805a0e:	c3                   	ret
+
+0000000000805a0f <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805a0f:	55                   	push   %rbp
+  805a10:	48 89 e5             	mov    %rsp,%rbp
+  805a13:	41 57                	push   %r15
+  805a15:	53                   	push   %rbx
+  805a16:	48 83 ec 20          	sub    $0x20,%rsp
+  805a1a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a1a <bind+0xb>
+  805a21:	49 bb 8e 5d 00 00 00 	movabs $0x5d8e,%r11
+  805a28:	00 00 00 
+  805a2b:	4c 01 db             	add    %r11,%rbx
+  805a2e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805a31:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805a35:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805a38:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a3b:	89 c7                	mov    %eax,%edi
+  805a3d:	48 b8 7a a0 ff ff ff 	movabs $0xffffffffffffa07a,%rax
+  805a44:	ff ff ff 
+  805a47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a4b:	ff d0                	call   *%rax
+  805a4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a50:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a54:	79 05                	jns    805a5b <bind+0x4c>
+		return r;
+  805a56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a59:	eb 21                	jmp    805a7c <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  805a5b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805a5e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805a62:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a65:	48 89 ce             	mov    %rcx,%rsi
+  805a68:	89 c7                	mov    %eax,%edi
+  805a6a:	49 89 df             	mov    %rbx,%r15
+  805a6d:	48 b8 04 a8 ff ff ff 	movabs $0xffffffffffffa804,%rax
+  805a74:	ff ff ff 
+  805a77:	48 01 d8             	add    %rbx,%rax
+  805a7a:	ff d0                	call   *%rax
+}
+  805a7c:	48 83 c4 20          	add    $0x20,%rsp
+  805a80:	5b                   	pop    %rbx
+  805a81:	41 5f                	pop    %r15
+  805a83:	5d                   	pop    %rbp
+  805a84:	c3                   	ret
+
+0000000000805a85 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  805a85:	55                   	push   %rbp
+  805a86:	48 89 e5             	mov    %rsp,%rbp
+  805a89:	41 57                	push   %r15
+  805a8b:	53                   	push   %rbx
+  805a8c:	48 83 ec 20          	sub    $0x20,%rsp
+  805a90:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a90 <shutdown+0xb>
+  805a97:	49 bb 18 5d 00 00 00 	movabs $0x5d18,%r11
+  805a9e:	00 00 00 
+  805aa1:	4c 01 db             	add    %r11,%rbx
+  805aa4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805aa7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805aaa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805aad:	89 c7                	mov    %eax,%edi
+  805aaf:	48 b8 7a a0 ff ff ff 	movabs $0xffffffffffffa07a,%rax
+  805ab6:	ff ff ff 
+  805ab9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805abd:	ff d0                	call   *%rax
+  805abf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ac2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ac6:	79 05                	jns    805acd <shutdown+0x48>
+		return r;
+  805ac8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805acb:	eb 1c                	jmp    805ae9 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  805acd:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805ad0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ad3:	89 d6                	mov    %edx,%esi
+  805ad5:	89 c7                	mov    %eax,%edi
+  805ad7:	49 89 df             	mov    %rbx,%r15
+  805ada:	48 b8 99 a8 ff ff ff 	movabs $0xffffffffffffa899,%rax
+  805ae1:	ff ff ff 
+  805ae4:	48 01 d8             	add    %rbx,%rax
+  805ae7:	ff d0                	call   *%rax
+}
+  805ae9:	48 83 c4 20          	add    $0x20,%rsp
+  805aed:	5b                   	pop    %rbx
+  805aee:	41 5f                	pop    %r15
+  805af0:	5d                   	pop    %rbp
+  805af1:	c3                   	ret
+
+0000000000805af2 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805af2:	55                   	push   %rbp
+  805af3:	48 89 e5             	mov    %rsp,%rbp
+  805af6:	41 57                	push   %r15
+  805af8:	53                   	push   %rbx
+  805af9:	48 83 ec 10          	sub    $0x10,%rsp
+  805afd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805afd <devsock_close+0xb>
+  805b04:	49 bb ab 5c 00 00 00 	movabs $0x5cab,%r11
+  805b0b:	00 00 00 
+  805b0e:	4c 01 db             	add    %r11,%rbx
+  805b11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805b15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b19:	48 89 c7             	mov    %rax,%rdi
+  805b1c:	49 89 df             	mov    %rbx,%r15
+  805b1f:	48 b8 94 bd ff ff ff 	movabs $0xffffffffffffbd94,%rax
+  805b26:	ff ff ff 
+  805b29:	48 01 d8             	add    %rbx,%rax
+  805b2c:	ff d0                	call   *%rax
+  805b2e:	83 f8 01             	cmp    $0x1,%eax
+  805b31:	75 1d                	jne    805b50 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805b33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b37:	8b 40 0c             	mov    0xc(%rax),%eax
+  805b3a:	89 c7                	mov    %eax,%edi
+  805b3c:	49 89 df             	mov    %rbx,%r15
+  805b3f:	48 b8 ea a8 ff ff ff 	movabs $0xffffffffffffa8ea,%rax
+  805b46:	ff ff ff 
+  805b49:	48 01 d8             	add    %rbx,%rax
+  805b4c:	ff d0                	call   *%rax
+  805b4e:	eb 05                	jmp    805b55 <devsock_close+0x63>
+	else
+		return 0;
+  805b50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b55:	48 83 c4 10          	add    $0x10,%rsp
+  805b59:	5b                   	pop    %rbx
+  805b5a:	41 5f                	pop    %r15
+  805b5c:	5d                   	pop    %rbp
+  805b5d:	c3                   	ret
+
+0000000000805b5e <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805b5e:	55                   	push   %rbp
+  805b5f:	48 89 e5             	mov    %rsp,%rbp
+  805b62:	41 57                	push   %r15
+  805b64:	53                   	push   %rbx
+  805b65:	48 83 ec 20          	sub    $0x20,%rsp
+  805b69:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b69 <connect+0xb>
+  805b70:	49 bb 3f 5c 00 00 00 	movabs $0x5c3f,%r11
+  805b77:	00 00 00 
+  805b7a:	4c 01 db             	add    %r11,%rbx
+  805b7d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805b80:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805b84:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805b87:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b8a:	89 c7                	mov    %eax,%edi
+  805b8c:	48 b8 7a a0 ff ff ff 	movabs $0xffffffffffffa07a,%rax
+  805b93:	ff ff ff 
+  805b96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b9a:	ff d0                	call   *%rax
+  805b9c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b9f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ba3:	79 05                	jns    805baa <connect+0x4c>
+		return r;
+  805ba5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ba8:	eb 21                	jmp    805bcb <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  805baa:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805bad:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805bb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bb4:	48 89 ce             	mov    %rcx,%rsi
+  805bb7:	89 c7                	mov    %eax,%edi
+  805bb9:	49 89 df             	mov    %rbx,%r15
+  805bbc:	48 b8 32 a9 ff ff ff 	movabs $0xffffffffffffa932,%rax
+  805bc3:	ff ff ff 
+  805bc6:	48 01 d8             	add    %rbx,%rax
+  805bc9:	ff d0                	call   *%rax
+}
+  805bcb:	48 83 c4 20          	add    $0x20,%rsp
+  805bcf:	5b                   	pop    %rbx
+  805bd0:	41 5f                	pop    %r15
+  805bd2:	5d                   	pop    %rbp
+  805bd3:	c3                   	ret
+
+0000000000805bd4 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  805bd4:	55                   	push   %rbp
+  805bd5:	48 89 e5             	mov    %rsp,%rbp
+  805bd8:	41 57                	push   %r15
+  805bda:	53                   	push   %rbx
+  805bdb:	48 83 ec 20          	sub    $0x20,%rsp
+  805bdf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bdf <listen+0xb>
+  805be6:	49 bb c9 5b 00 00 00 	movabs $0x5bc9,%r11
+  805bed:	00 00 00 
+  805bf0:	4c 01 db             	add    %r11,%rbx
+  805bf3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805bf6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805bf9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bfc:	89 c7                	mov    %eax,%edi
+  805bfe:	48 b8 7a a0 ff ff ff 	movabs $0xffffffffffffa07a,%rax
+  805c05:	ff ff ff 
+  805c08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c0c:	ff d0                	call   *%rax
+  805c0e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c11:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c15:	79 05                	jns    805c1c <listen+0x48>
+		return r;
+  805c17:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c1a:	eb 1c                	jmp    805c38 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805c1c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805c1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c22:	89 d6                	mov    %edx,%esi
+  805c24:	89 c7                	mov    %eax,%edi
+  805c26:	49 89 df             	mov    %rbx,%r15
+  805c29:	48 b8 c7 a9 ff ff ff 	movabs $0xffffffffffffa9c7,%rax
+  805c30:	ff ff ff 
+  805c33:	48 01 d8             	add    %rbx,%rax
+  805c36:	ff d0                	call   *%rax
+}
+  805c38:	48 83 c4 20          	add    $0x20,%rsp
+  805c3c:	5b                   	pop    %rbx
+  805c3d:	41 5f                	pop    %r15
+  805c3f:	5d                   	pop    %rbp
+  805c40:	c3                   	ret
+
+0000000000805c41 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805c41:	55                   	push   %rbp
+  805c42:	48 89 e5             	mov    %rsp,%rbp
+  805c45:	41 57                	push   %r15
+  805c47:	48 83 ec 28          	sub    $0x28,%rsp
+  805c4b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805c4b <devsock_read+0xa>
+  805c52:	49 bb 5d 5b 00 00 00 	movabs $0x5b5d,%r11
+  805c59:	00 00 00 
+  805c5c:	4c 01 d8             	add    %r11,%rax
+  805c5f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805c63:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805c67:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805c6b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805c6f:	41 89 d0             	mov    %edx,%r8d
+  805c72:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805c76:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805c79:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805c7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805c82:	44 89 c2             	mov    %r8d,%edx
+  805c85:	49 89 c7             	mov    %rax,%r15
+  805c88:	49 b8 18 aa ff ff ff 	movabs $0xffffffffffffaa18,%r8
+  805c8f:	ff ff ff 
+  805c92:	49 01 c0             	add    %rax,%r8
+  805c95:	41 ff d0             	call   *%r8
+}
+  805c98:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805c9c:	c9                   	leave
+  805c9d:	c3                   	ret
+
+0000000000805c9e <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805c9e:	55                   	push   %rbp
+  805c9f:	48 89 e5             	mov    %rsp,%rbp
+  805ca2:	41 57                	push   %r15
+  805ca4:	48 83 ec 28          	sub    $0x28,%rsp
+  805ca8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ca8 <devsock_write+0xa>
+  805caf:	49 bb 00 5b 00 00 00 	movabs $0x5b00,%r11
+  805cb6:	00 00 00 
+  805cb9:	4c 01 d8             	add    %r11,%rax
+  805cbc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805cc0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805cc4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805cc8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805ccc:	41 89 d0             	mov    %edx,%r8d
+  805ccf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805cd3:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805cd6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805cda:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805cdf:	44 89 c2             	mov    %r8d,%edx
+  805ce2:	49 89 c7             	mov    %rax,%r15
+  805ce5:	49 b8 35 ab ff ff ff 	movabs $0xffffffffffffab35,%r8
+  805cec:	ff ff ff 
+  805cef:	49 01 c0             	add    %rax,%r8
+  805cf2:	41 ff d0             	call   *%r8
+}
+  805cf5:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805cf9:	c9                   	leave
+  805cfa:	c3                   	ret
+
+0000000000805cfb <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805cfb:	55                   	push   %rbp
+  805cfc:	48 89 e5             	mov    %rsp,%rbp
+  805cff:	41 57                	push   %r15
+  805d01:	48 83 ec 18          	sub    $0x18,%rsp
+  805d05:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d05 <devsock_stat+0xa>
+  805d0c:	49 bb a3 5a 00 00 00 	movabs $0x5aa3,%r11
+  805d13:	00 00 00 
+  805d16:	4c 01 d8             	add    %r11,%rax
+  805d19:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805d1d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805d21:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d25:	48 b9 ef c5 ff ff ff 	movabs $0xffffffffffffc5ef,%rcx
+  805d2c:	ff ff ff 
+  805d2f:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805d33:	48 89 ce             	mov    %rcx,%rsi
+  805d36:	48 89 d7             	mov    %rdx,%rdi
+  805d39:	49 89 c7             	mov    %rax,%r15
+  805d3c:	48 ba 2a 63 ff ff ff 	movabs $0xffffffffffff632a,%rdx
+  805d43:	ff ff ff 
+  805d46:	48 01 c2             	add    %rax,%rdx
+  805d49:	ff d2                	call   *%rdx
+	return 0;
+  805d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d50:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805d54:	c9                   	leave
+  805d55:	c3                   	ret
+
+0000000000805d56 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  805d56:	55                   	push   %rbp
+  805d57:	48 89 e5             	mov    %rsp,%rbp
+  805d5a:	41 57                	push   %r15
+  805d5c:	53                   	push   %rbx
+  805d5d:	48 83 ec 20          	sub    $0x20,%rsp
+  805d61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d61 <socket+0xb>
+  805d68:	49 bb 47 5a 00 00 00 	movabs $0x5a47,%r11
+  805d6f:	00 00 00 
+  805d72:	4c 01 db             	add    %r11,%rbx
+  805d75:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805d78:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805d7b:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805d7e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805d81:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805d84:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d87:	89 ce                	mov    %ecx,%esi
+  805d89:	89 c7                	mov    %eax,%edi
+  805d8b:	49 89 df             	mov    %rbx,%r15
+  805d8e:	48 b8 0c ad ff ff ff 	movabs $0xffffffffffffad0c,%rax
+  805d95:	ff ff ff 
+  805d98:	48 01 d8             	add    %rbx,%rax
+  805d9b:	ff d0                	call   *%rax
+  805d9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805da0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805da4:	79 05                	jns    805dab <socket+0x55>
+		return r;
+  805da6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805da9:	eb 15                	jmp    805dc0 <socket+0x6a>
+	return alloc_sockfd(r);
+  805dab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dae:	89 c7                	mov    %eax,%edi
+  805db0:	48 b8 f6 a0 ff ff ff 	movabs $0xffffffffffffa0f6,%rax
+  805db7:	ff ff ff 
+  805dba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dbe:	ff d0                	call   *%rax
+}
+  805dc0:	48 83 c4 20          	add    $0x20,%rsp
+  805dc4:	5b                   	pop    %rbx
+  805dc5:	41 5f                	pop    %r15
+  805dc7:	5d                   	pop    %rbp
+  805dc8:	c3                   	ret
+
+0000000000805dc9 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805dc9:	55                   	push   %rbp
+  805dca:	48 89 e5             	mov    %rsp,%rbp
+  805dcd:	41 57                	push   %r15
+  805dcf:	53                   	push   %rbx
+  805dd0:	48 83 ec 10          	sub    $0x10,%rsp
+  805dd4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805dd4 <nsipc+0xb>
+  805ddb:	49 bb d4 59 00 00 00 	movabs $0x59d4,%r11
+  805de2:	00 00 00 
+  805de5:	4c 01 db             	add    %r11,%rbx
+  805de8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805deb:	48 b8 58 18 01 00 00 	movabs $0x11858,%rax
+  805df2:	00 00 00 
+  805df5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805df8:	85 c0                	test   %eax,%eax
+  805dfa:	75 24                	jne    805e20 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805dfc:	bf 02 00 00 00       	mov    $0x2,%edi
+  805e01:	49 89 df             	mov    %rbx,%r15
+  805e04:	48 b8 05 bd ff ff ff 	movabs $0xffffffffffffbd05,%rax
+  805e0b:	ff ff ff 
+  805e0e:	48 01 d8             	add    %rbx,%rax
+  805e11:	ff d0                	call   *%rax
+  805e13:	48 ba 58 18 01 00 00 	movabs $0x11858,%rdx
+  805e1a:	00 00 00 
+  805e1d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805e20:	48 b8 58 18 01 00 00 	movabs $0x11858,%rax
+  805e27:	00 00 00 
+  805e2a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805e2d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805e30:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805e36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805e3c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805e41:	48 ba 58 48 01 00 00 	movabs $0x14858,%rdx
+  805e48:	00 00 00 
+  805e4b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805e4f:	89 c7                	mov    %eax,%edi
+  805e51:	49 89 df             	mov    %rbx,%r15
+  805e54:	48 b8 24 b7 ff ff ff 	movabs $0xffffffffffffb724,%rax
+  805e5b:	ff ff ff 
+  805e5e:	48 01 d8             	add    %rbx,%rax
+  805e61:	ff d0                	call   *%rax
+}
+  805e63:	48 83 c4 10          	add    $0x10,%rsp
+  805e67:	5b                   	pop    %rbx
+  805e68:	41 5f                	pop    %r15
+  805e6a:	5d                   	pop    %rbp
+  805e6b:	c3                   	ret
+
+0000000000805e6c <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805e6c:	55                   	push   %rbp
+  805e6d:	48 89 e5             	mov    %rsp,%rbp
+  805e70:	41 57                	push   %r15
+  805e72:	53                   	push   %rbx
+  805e73:	48 83 ec 20          	sub    $0x20,%rsp
+  805e77:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e77 <nsipc_words+0xb>
+  805e7e:	49 bb 31 59 00 00 00 	movabs $0x5931,%r11
+  805e85:	00 00 00 
+  805e88:	4c 01 db             	add    %r11,%rbx
+  805e8b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805e8e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805e92:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805e96:	48 b8 58 18 01 00 00 	movabs $0x11858,%rax
+  805e9d:	00 00 00 
+  805ea0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805ea3:	85 c0                	test   %eax,%eax
+  805ea5:	75 24                	jne    805ecb <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805ea7:	bf 02 00 00 00       	mov    $0x2,%edi
+  805eac:	49 89 df             	mov    %rbx,%r15
+  805eaf:	48 b8 05 bd ff ff ff 	movabs $0xffffffffffffbd05,%rax
+  805eb6:	ff ff ff 
+  805eb9:	48 01 d8             	add    %rbx,%rax
+  805ebc:	ff d0                	call   *%rax
+  805ebe:	48 ba 58 18 01 00 00 	movabs $0x11858,%rdx
+  805ec5:	00 00 00 
+  805ec8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805ecb:	48 b8 58 18 01 00 00 	movabs $0x11858,%rax
+  805ed2:	00 00 00 
+  805ed5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805ed8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805edc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ee0:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805ee3:	89 c7                	mov    %eax,%edi
+  805ee5:	49 89 df             	mov    %rbx,%r15
+  805ee8:	48 b8 0f b8 ff ff ff 	movabs $0xffffffffffffb80f,%rax
+  805eef:	ff ff ff 
+  805ef2:	48 01 d8             	add    %rbx,%rax
+  805ef5:	ff d0                	call   *%rax
+}
+  805ef7:	48 83 c4 20          	add    $0x20,%rsp
+  805efb:	5b                   	pop    %rbx
+  805efc:	41 5f                	pop    %r15
+  805efe:	5d                   	pop    %rbp
+  805eff:	c3                   	ret
+
+0000000000805f00 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805f00:	55                   	push   %rbp
+  805f01:	48 89 e5             	mov    %rsp,%rbp
+  805f04:	41 57                	push   %r15
+  805f06:	53                   	push   %rbx
+  805f07:	48 83 ec 30          	sub    $0x30,%rsp
+  805f0b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f0b <nsipc_accept+0xb>
+  805f12:	49 bb 9d 58 00 00 00 	movabs $0x589d,%r11
+  805f19:	00 00 00 
+  805f1c:	4c 01 db             	add    %r11,%rbx
+  805f1f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805f22:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805f26:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805f2a:	48 ba 58 48 01 00 00 	movabs $0x14858,%rdx
+  805f31:	00 00 00 
+  805f34:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f37:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805f3a:	bf 01 00 00 00       	mov    $0x1,%edi
+  805f3f:	48 b8 21 a6 ff ff ff 	movabs $0xffffffffffffa621,%rax
+  805f46:	ff ff ff 
+  805f49:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f4d:	ff d0                	call   *%rax
+  805f4f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f52:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f56:	78 48                	js     805fa0 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805f58:	48 b8 58 48 01 00 00 	movabs $0x14858,%rax
+  805f5f:	00 00 00 
+  805f62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f66:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805f6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f6e:	8b 40 10             	mov    0x10(%rax),%eax
+  805f71:	89 c2                	mov    %eax,%edx
+  805f73:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805f77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f7b:	48 89 ce             	mov    %rcx,%rsi
+  805f7e:	48 89 c7             	mov    %rax,%rdi
+  805f81:	49 89 df             	mov    %rbx,%r15
+  805f84:	48 b8 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rax
+  805f8b:	ff ff ff 
+  805f8e:	48 01 d8             	add    %rbx,%rax
+  805f91:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805f93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f97:	8b 50 10             	mov    0x10(%rax),%edx
+  805f9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805f9e:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805fa0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805fa3:	48 83 c4 30          	add    $0x30,%rsp
+  805fa7:	5b                   	pop    %rbx
+  805fa8:	41 5f                	pop    %r15
+  805faa:	5d                   	pop    %rbp
+  805fab:	c3                   	ret
+
+0000000000805fac <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805fac:	55                   	push   %rbp
+  805fad:	48 89 e5             	mov    %rsp,%rbp
+  805fb0:	41 57                	push   %r15
+  805fb2:	53                   	push   %rbx
+  805fb3:	48 83 ec 10          	sub    $0x10,%rsp
+  805fb7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fb7 <nsipc_bind+0xb>
+  805fbe:	49 bb f1 57 00 00 00 	movabs $0x57f1,%r11
+  805fc5:	00 00 00 
+  805fc8:	4c 01 db             	add    %r11,%rbx
+  805fcb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805fce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805fd2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805fd5:	48 ba 58 48 01 00 00 	movabs $0x14858,%rdx
+  805fdc:	00 00 00 
+  805fdf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805fe2:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805fe5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805fe8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805fec:	48 89 c6             	mov    %rax,%rsi
+  805fef:	48 b8 5c 48 01 00 00 	movabs $0x1485c,%rax
+  805ff6:	00 00 00 
+  805ff9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ffd:	48 89 c7             	mov    %rax,%rdi
+  806000:	49 89 df             	mov    %rbx,%r15
+  806003:	48 b8 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rax
+  80600a:	ff ff ff 
+  80600d:	48 01 d8             	add    %rbx,%rax
+  806010:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  806012:	48 ba 58 48 01 00 00 	movabs $0x14858,%rdx
+  806019:	00 00 00 
+  80601c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80601f:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  806023:	bf 02 00 00 00       	mov    $0x2,%edi
+  806028:	48 b8 21 a6 ff ff ff 	movabs $0xffffffffffffa621,%rax
+  80602f:	ff ff ff 
+  806032:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806036:	ff d0                	call   *%rax
+}
+  806038:	48 83 c4 10          	add    $0x10,%rsp
+  80603c:	5b                   	pop    %rbx
+  80603d:	41 5f                	pop    %r15
+  80603f:	5d                   	pop    %rbp
+  806040:	c3                   	ret
+
+0000000000806041 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  806041:	55                   	push   %rbp
+  806042:	48 89 e5             	mov    %rsp,%rbp
+  806045:	48 83 ec 20          	sub    $0x20,%rsp
+  806049:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806049 <nsipc_shutdown+0x8>
+  806050:	49 bb 5f 57 00 00 00 	movabs $0x575f,%r11
+  806057:	00 00 00 
+  80605a:	4c 01 d8             	add    %r11,%rax
+  80605d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806060:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  806063:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  806066:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  806069:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80606c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80606f:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  806073:	ba 08 00 00 00       	mov    $0x8,%edx
+  806078:	48 89 ce             	mov    %rcx,%rsi
+  80607b:	bf 03 00 00 00       	mov    $0x3,%edi
+  806080:	48 b9 c4 a6 ff ff ff 	movabs $0xffffffffffffa6c4,%rcx
+  806087:	ff ff ff 
+  80608a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80608e:	ff d0                	call   *%rax
+}
+  806090:	c9                   	leave
+  806091:	c3                   	ret
+
+0000000000806092 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  806092:	55                   	push   %rbp
+  806093:	48 89 e5             	mov    %rsp,%rbp
+  806096:	48 83 ec 20          	sub    $0x20,%rsp
+  80609a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80609a <nsipc_close+0x8>
+  8060a1:	49 bb 0e 57 00 00 00 	movabs $0x570e,%r11
+  8060a8:	00 00 00 
+  8060ab:	4c 01 d8             	add    %r11,%rax
+  8060ae:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8060b1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8060b4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8060b7:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8060bb:	ba 04 00 00 00       	mov    $0x4,%edx
+  8060c0:	48 89 ce             	mov    %rcx,%rsi
+  8060c3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8060c8:	48 b9 c4 a6 ff ff ff 	movabs $0xffffffffffffa6c4,%rcx
+  8060cf:	ff ff ff 
+  8060d2:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8060d6:	ff d0                	call   *%rax
+}
+  8060d8:	c9                   	leave
+  8060d9:	c3                   	ret
+
+00000000008060da <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8060da:	55                   	push   %rbp
+  8060db:	48 89 e5             	mov    %rsp,%rbp
+  8060de:	41 57                	push   %r15
+  8060e0:	53                   	push   %rbx
+  8060e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8060e5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060e5 <nsipc_connect+0xb>
+  8060ec:	49 bb c3 56 00 00 00 	movabs $0x56c3,%r11
+  8060f3:	00 00 00 
+  8060f6:	4c 01 db             	add    %r11,%rbx
+  8060f9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8060fc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806100:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  806103:	48 ba 58 48 01 00 00 	movabs $0x14858,%rdx
+  80610a:	00 00 00 
+  80610d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806110:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  806113:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806116:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80611a:	48 89 c6             	mov    %rax,%rsi
+  80611d:	48 b8 5c 48 01 00 00 	movabs $0x1485c,%rax
+  806124:	00 00 00 
+  806127:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80612b:	48 89 c7             	mov    %rax,%rdi
+  80612e:	49 89 df             	mov    %rbx,%r15
+  806131:	48 b8 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rax
+  806138:	ff ff ff 
+  80613b:	48 01 d8             	add    %rbx,%rax
+  80613e:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  806140:	48 ba 58 48 01 00 00 	movabs $0x14858,%rdx
+  806147:	00 00 00 
+  80614a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80614d:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  806151:	bf 05 00 00 00       	mov    $0x5,%edi
+  806156:	48 b8 21 a6 ff ff ff 	movabs $0xffffffffffffa621,%rax
+  80615d:	ff ff ff 
+  806160:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806164:	ff d0                	call   *%rax
+}
+  806166:	48 83 c4 10          	add    $0x10,%rsp
+  80616a:	5b                   	pop    %rbx
+  80616b:	41 5f                	pop    %r15
+  80616d:	5d                   	pop    %rbp
+  80616e:	c3                   	ret
+
+000000000080616f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80616f:	55                   	push   %rbp
+  806170:	48 89 e5             	mov    %rsp,%rbp
+  806173:	48 83 ec 20          	sub    $0x20,%rsp
+  806177:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806177 <nsipc_listen+0x8>
+  80617e:	49 bb 31 56 00 00 00 	movabs $0x5631,%r11
+  806185:	00 00 00 
+  806188:	4c 01 d8             	add    %r11,%rax
+  80618b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80618e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  806191:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  806194:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  806197:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80619a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  80619d:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8061a1:	ba 08 00 00 00       	mov    $0x8,%edx
+  8061a6:	48 89 ce             	mov    %rcx,%rsi
+  8061a9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8061ae:	48 b9 c4 a6 ff ff ff 	movabs $0xffffffffffffa6c4,%rcx
+  8061b5:	ff ff ff 
+  8061b8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8061bc:	ff d0                	call   *%rax
+}
+  8061be:	c9                   	leave
+  8061bf:	c3                   	ret
+
+00000000008061c0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8061c0:	55                   	push   %rbp
+  8061c1:	48 89 e5             	mov    %rsp,%rbp
+  8061c4:	41 57                	push   %r15
+  8061c6:	53                   	push   %rbx
+  8061c7:	48 83 ec 30          	sub    $0x30,%rsp
+  8061cb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061cb <nsipc_recv+0xb>
+  8061d2:	49 bb dd 55 00 00 00 	movabs $0x55dd,%r11
+  8061d9:	00 00 00 
+  8061dc:	4c 01 db             	add    %r11,%rbx
+  8061df:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8061e2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8061e6:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8061e9:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8061ec:	48 ba 58 48 01 00 00 	movabs $0x14858,%rdx
+  8061f3:	00 00 00 
+  8061f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8061f9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8061fc:	48 ba 58 48 01 00 00 	movabs $0x14858,%rdx
+  806203:	00 00 00 
+  806206:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806209:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  80620d:	48 ba 58 48 01 00 00 	movabs $0x14858,%rdx
+  806214:	00 00 00 
+  806217:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80621a:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80621e:	bf 07 00 00 00       	mov    $0x7,%edi
+  806223:	48 b8 21 a6 ff ff ff 	movabs $0xffffffffffffa621,%rax
+  80622a:	ff ff ff 
+  80622d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806231:	ff d0                	call   *%rax
+  806233:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806236:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80623a:	0f 88 91 00 00 00    	js     8062d1 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  806240:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  806247:	7f 08                	jg     806251 <nsipc_recv+0x91>
+  806249:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80624c:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  80624f:	7e 50                	jle    8062a1 <nsipc_recv+0xe1>
+  806251:	48 b8 f6 c5 ff ff ff 	movabs $0xffffffffffffc5f6,%rax
+  806258:	ff ff ff 
+  80625b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80625f:	48 89 c1             	mov    %rax,%rcx
+  806262:	48 b8 0b c6 ff ff ff 	movabs $0xffffffffffffc60b,%rax
+  806269:	ff ff ff 
+  80626c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806270:	48 89 c2             	mov    %rax,%rdx
+  806273:	be 79 00 00 00       	mov    $0x79,%esi
+  806278:	48 b8 20 c6 ff ff ff 	movabs $0xffffffffffffc620,%rax
+  80627f:	ff ff ff 
+  806282:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806286:	48 89 c7             	mov    %rax,%rdi
+  806289:	49 89 df             	mov    %rbx,%r15
+  80628c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806291:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  806298:	ff ff ff 
+  80629b:	49 01 d8             	add    %rbx,%r8
+  80629e:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8062a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062a4:	48 63 d0             	movslq %eax,%rdx
+  8062a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062ab:	48 b9 58 48 01 00 00 	movabs $0x14858,%rcx
+  8062b2:	00 00 00 
+  8062b5:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8062b9:	48 89 ce             	mov    %rcx,%rsi
+  8062bc:	48 89 c7             	mov    %rax,%rdi
+  8062bf:	49 89 df             	mov    %rbx,%r15
+  8062c2:	48 b8 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rax
+  8062c9:	ff ff ff 
+  8062cc:	48 01 d8             	add    %rbx,%rax
+  8062cf:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8062d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8062d4:	48 83 c4 30          	add    $0x30,%rsp
+  8062d8:	5b                   	pop    %rbx
+  8062d9:	41 5f                	pop    %r15
+  8062db:	5d                   	pop    %rbp
+  8062dc:	c3                   	ret
+
+00000000008062dd <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8062dd:	55                   	push   %rbp
+  8062de:	48 89 e5             	mov    %rsp,%rbp
+  8062e1:	41 57                	push   %r15
+  8062e3:	53                   	push   %rbx
+  8062e4:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8062eb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8062eb <nsipc_send+0xe>
+  8062f2:	49 bb bd 54 00 00 00 	movabs $0x54bd,%r11
+  8062f9:	00 00 00 
+  8062fc:	4c 01 db             	add    %r11,%rbx
+  8062ff:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  806305:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  80630c:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  806312:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  806318:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80631c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  806320:	48 b8 58 18 01 00 00 	movabs $0x11858,%rax
+  806327:	00 00 00 
+  80632a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80632d:	85 c0                	test   %eax,%eax
+  80632f:	75 24                	jne    806355 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  806331:	bf 02 00 00 00       	mov    $0x2,%edi
+  806336:	49 89 df             	mov    %rbx,%r15
+  806339:	48 b8 05 bd ff ff ff 	movabs $0xffffffffffffbd05,%rax
+  806340:	ff ff ff 
+  806343:	48 01 d8             	add    %rbx,%rax
+  806346:	ff d0                	call   *%rax
+  806348:	48 ba 58 18 01 00 00 	movabs $0x11858,%rdx
+  80634f:	00 00 00 
+  806352:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  806355:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80635b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80635e:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  806365:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  806368:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80636b:	39 c2                	cmp    %eax,%edx
+  80636d:	0f 4e c2             	cmovle %edx,%eax
+  806370:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  806376:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80637c:	48 63 d0             	movslq %eax,%rdx
+  80637f:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  806386:	48 89 c6             	mov    %rax,%rsi
+  806389:	48 b8 58 18 00 00 00 	movabs $0x1858,%rax
+  806390:	00 00 00 
+  806393:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806397:	48 89 c7             	mov    %rax,%rdi
+  80639a:	49 89 df             	mov    %rbx,%r15
+  80639d:	48 b8 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rax
+  8063a4:	ff ff ff 
+  8063a7:	48 01 d8             	add    %rbx,%rax
+  8063aa:	ff d0                	call   *%rax
+	req->req_s = s;
+  8063ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063b0:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  8063b6:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  8063b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063bc:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8063c2:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  8063c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063c9:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8063cf:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  8063d2:	48 b8 58 18 00 00 00 	movabs $0x1858,%rax
+  8063d9:	00 00 00 
+  8063dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063e0:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8063e4:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8063eb:	00 
+  8063ec:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8063f2:	48 63 d0             	movslq %eax,%rdx
+  8063f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063f9:	48 01 d0             	add    %rdx,%rax
+  8063fc:	48 83 e8 01          	sub    $0x1,%rax
+  806400:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  806404:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806408:	ba 00 00 00 00       	mov    $0x0,%edx
+  80640d:	48 f7 75 d8          	divq   -0x28(%rbp)
+  806411:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806415:	48 29 d0             	sub    %rdx,%rax
+  806418:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  80641e:	85 c0                	test   %eax,%eax
+  806420:	0f 48 c2             	cmovs  %edx,%eax
+  806423:	c1 f8 0c             	sar    $0xc,%eax
+  806426:	48 98                	cltq
+  806428:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  80642c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806430:	48 85 c0             	test   %rax,%rax
+  806433:	0f 95 c0             	setne  %al
+  806436:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  806439:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  806440:	00 
+  806441:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806445:	48 83 c0 0b          	add    $0xb,%rax
+  806449:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80644d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806451:	ba 00 00 00 00       	mov    $0x0,%edx
+  806456:	48 f7 75 c8          	divq   -0x38(%rbp)
+  80645a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80645e:	48 29 d0             	sub    %rdx,%rax
+  806461:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806465:	89 c7                	mov    %eax,%edi
+  806467:	48 b8 58 18 01 00 00 	movabs $0x11858,%rax
+  80646e:	00 00 00 
+  806471:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806474:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  806478:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  80647c:	48 83 ec 08          	sub    $0x8,%rsp
+  806480:	6a 00                	push   $0x0
+  806482:	6a 00                	push   $0x0
+  806484:	6a 05                	push   $0x5
+  806486:	41 89 f1             	mov    %esi,%r9d
+  806489:	49 89 c8             	mov    %rcx,%r8
+  80648c:	89 f9                	mov    %edi,%ecx
+  80648e:	be 08 00 00 00       	mov    $0x8,%esi
+  806493:	89 c7                	mov    %eax,%edi
+  806495:	49 89 df             	mov    %rbx,%r15
+  806498:	48 b8 0d b9 ff ff ff 	movabs $0xffffffffffffb90d,%rax
+  80649f:	ff ff ff 
+  8064a2:	48 01 d8             	add    %rbx,%rax
+  8064a5:	ff d0                	call   *%rax
+  8064a7:	48 83 c4 20          	add    $0x20,%rsp
+}
+  8064ab:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8064af:	5b                   	pop    %rbx
+  8064b0:	41 5f                	pop    %r15
+  8064b2:	5d                   	pop    %rbp
+  8064b3:	c3                   	ret
+
+00000000008064b4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8064b4:	55                   	push   %rbp
+  8064b5:	48 89 e5             	mov    %rsp,%rbp
+  8064b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8064bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064bc <nsipc_socket+0x8>
+  8064c3:	49 bb ec 52 00 00 00 	movabs $0x52ec,%r11
+  8064ca:	00 00 00 
+  8064cd:	4c 01 d8             	add    %r11,%rax
+  8064d0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8064d3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8064d6:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8064d9:	48 b9 58 48 01 00 00 	movabs $0x14858,%rcx
+  8064e0:	00 00 00 
+  8064e3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8064e6:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8064e9:	48 b9 58 48 01 00 00 	movabs $0x14858,%rcx
+  8064f0:	00 00 00 
+  8064f3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8064f6:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8064fa:	48 b9 58 48 01 00 00 	movabs $0x14858,%rcx
+  806501:	00 00 00 
+  806504:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806507:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  80650b:	bf 09 00 00 00       	mov    $0x9,%edi
+  806510:	48 ba 21 a6 ff ff ff 	movabs $0xffffffffffffa621,%rdx
+  806517:	ff ff ff 
+  80651a:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80651e:	ff d0                	call   *%rax
+}
+  806520:	c9                   	leave
+  806521:	c3                   	ret
+
+0000000000806522 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  806522:	55                   	push   %rbp
+  806523:	48 89 e5             	mov    %rsp,%rbp
+  806526:	41 57                	push   %r15
+  806528:	53                   	push   %rbx
+  806529:	48 83 ec 30          	sub    $0x30,%rsp
+  80652d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80652d <pipe+0xb>
+  806534:	49 bb 7b 52 00 00 00 	movabs $0x527b,%r11
+  80653b:	00 00 00 
+  80653e:	4c 01 db             	add    %r11,%rbx
+  806541:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  806545:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  806549:	48 89 c7             	mov    %rax,%rdi
+  80654c:	49 89 df             	mov    %rbx,%r15
+  80654f:	48 b8 09 78 ff ff ff 	movabs $0xffffffffffff7809,%rax
+  806556:	ff ff ff 
+  806559:	48 01 d8             	add    %rbx,%rax
+  80655c:	ff d0                	call   *%rax
+  80655e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806561:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806565:	0f 88 12 02 00 00    	js     80677d <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80656b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80656f:	ba 07 04 00 00       	mov    $0x407,%edx
+  806574:	48 89 c6             	mov    %rax,%rsi
+  806577:	bf 00 00 00 00       	mov    $0x0,%edi
+  80657c:	49 89 df             	mov    %rbx,%r15
+  80657f:	48 b8 e6 6f ff ff ff 	movabs $0xffffffffffff6fe6,%rax
+  806586:	ff ff ff 
+  806589:	48 01 d8             	add    %rbx,%rax
+  80658c:	ff d0                	call   *%rax
+  80658e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806591:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806595:	0f 88 e2 01 00 00    	js     80677d <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  80659b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80659f:	48 89 c7             	mov    %rax,%rdi
+  8065a2:	49 89 df             	mov    %rbx,%r15
+  8065a5:	48 b8 09 78 ff ff ff 	movabs $0xffffffffffff7809,%rax
+  8065ac:	ff ff ff 
+  8065af:	48 01 d8             	add    %rbx,%rax
+  8065b2:	ff d0                	call   *%rax
+  8065b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8065b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065bb:	0f 88 9b 01 00 00    	js     80675c <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8065c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065c5:	ba 07 04 00 00       	mov    $0x407,%edx
+  8065ca:	48 89 c6             	mov    %rax,%rsi
+  8065cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8065d2:	49 89 df             	mov    %rbx,%r15
+  8065d5:	48 b8 e6 6f ff ff ff 	movabs $0xffffffffffff6fe6,%rax
+  8065dc:	ff ff ff 
+  8065df:	48 01 d8             	add    %rbx,%rax
+  8065e2:	ff d0                	call   *%rax
+  8065e4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8065e7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065eb:	0f 88 6b 01 00 00    	js     80675c <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8065f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065f5:	48 89 c7             	mov    %rax,%rdi
+  8065f8:	49 89 df             	mov    %rbx,%r15
+  8065fb:	48 b8 c6 77 ff ff ff 	movabs $0xffffffffffff77c6,%rax
+  806602:	ff ff ff 
+  806605:	48 01 d8             	add    %rbx,%rax
+  806608:	ff d0                	call   *%rax
+  80660a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80660e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806612:	ba 07 04 00 00       	mov    $0x407,%edx
+  806617:	48 89 c6             	mov    %rax,%rsi
+  80661a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80661f:	49 89 df             	mov    %rbx,%r15
+  806622:	48 b8 e6 6f ff ff ff 	movabs $0xffffffffffff6fe6,%rax
+  806629:	ff ff ff 
+  80662c:	48 01 d8             	add    %rbx,%rax
+  80662f:	ff d0                	call   *%rax
+  806631:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806634:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806638:	0f 88 fd 00 00 00    	js     80673b <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80663e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806642:	48 89 c7             	mov    %rax,%rdi
+  806645:	49 89 df             	mov    %rbx,%r15
+  806648:	48 b8 c6 77 ff ff ff 	movabs $0xffffffffffff77c6,%rax
+  80664f:	ff ff ff 
+  806652:	48 01 d8             	add    %rbx,%rax
+  806655:	ff d0                	call   *%rax
+  806657:	48 89 c2             	mov    %rax,%rdx
+  80665a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80665e:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  806664:	48 89 d1             	mov    %rdx,%rcx
+  806667:	ba 00 00 00 00       	mov    $0x0,%edx
+  80666c:	48 89 c6             	mov    %rax,%rsi
+  80666f:	bf 00 00 00 00       	mov    $0x0,%edi
+  806674:	49 89 df             	mov    %rbx,%r15
+  806677:	48 b8 4b 70 ff ff ff 	movabs $0xffffffffffff704b,%rax
+  80667e:	ff ff ff 
+  806681:	48 01 d8             	add    %rbx,%rax
+  806684:	ff d0                	call   *%rax
+  806686:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806689:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80668d:	0f 88 87 00 00 00    	js     80671a <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  806693:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806697:	48 ba d8 00 00 00 00 	movabs $0xd8,%rdx
+  80669e:	00 00 00 
+  8066a1:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8066a4:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  8066a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8066aa:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8066b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8066b5:	48 ba d8 00 00 00 00 	movabs $0xd8,%rdx
+  8066bc:	00 00 00 
+  8066bf:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8066c2:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8066c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8066c8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8066cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8066d3:	48 89 c7             	mov    %rax,%rdi
+  8066d6:	49 89 df             	mov    %rbx,%r15
+  8066d9:	48 b8 8f 77 ff ff ff 	movabs $0xffffffffffff778f,%rax
+  8066e0:	ff ff ff 
+  8066e3:	48 01 d8             	add    %rbx,%rax
+  8066e6:	ff d0                	call   *%rax
+  8066e8:	89 c2                	mov    %eax,%edx
+  8066ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8066ee:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8066f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8066f4:	48 89 c7             	mov    %rax,%rdi
+  8066f7:	49 89 df             	mov    %rbx,%r15
+  8066fa:	48 b8 8f 77 ff ff ff 	movabs $0xffffffffffff778f,%rax
+  806701:	ff ff ff 
+  806704:	48 01 d8             	add    %rbx,%rax
+  806707:	ff d0                	call   *%rax
+  806709:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80670d:	48 83 c2 04          	add    $0x4,%rdx
+  806711:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  806713:	b8 00 00 00 00       	mov    $0x0,%eax
+  806718:	eb 67                	jmp    806781 <pipe+0x25f>
+		goto err3;
+  80671a:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80671b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80671f:	48 89 c6             	mov    %rax,%rsi
+  806722:	bf 00 00 00 00       	mov    $0x0,%edi
+  806727:	49 89 df             	mov    %rbx,%r15
+  80672a:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  806731:	ff ff ff 
+  806734:	48 01 d8             	add    %rbx,%rax
+  806737:	ff d0                	call   *%rax
+  806739:	eb 01                	jmp    80673c <pipe+0x21a>
+		goto err2;
+  80673b:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80673c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806740:	48 89 c6             	mov    %rax,%rsi
+  806743:	bf 00 00 00 00       	mov    $0x0,%edi
+  806748:	49 89 df             	mov    %rbx,%r15
+  80674b:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  806752:	ff ff ff 
+  806755:	48 01 d8             	add    %rbx,%rax
+  806758:	ff d0                	call   *%rax
+  80675a:	eb 01                	jmp    80675d <pipe+0x23b>
+		goto err1;
+  80675c:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  80675d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806761:	48 89 c6             	mov    %rax,%rsi
+  806764:	bf 00 00 00 00       	mov    $0x0,%edi
+  806769:	49 89 df             	mov    %rbx,%r15
+  80676c:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  806773:	ff ff ff 
+  806776:	48 01 d8             	add    %rbx,%rax
+  806779:	ff d0                	call   *%rax
+  80677b:	eb 01                	jmp    80677e <pipe+0x25c>
+		goto err;
+  80677d:	90                   	nop
+err:
+	return r;
+  80677e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806781:	48 83 c4 30          	add    $0x30,%rsp
+  806785:	5b                   	pop    %rbx
+  806786:	41 5f                	pop    %r15
+  806788:	5d                   	pop    %rbp
+  806789:	c3                   	ret
+
+000000000080678a <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80678a:	55                   	push   %rbp
+  80678b:	48 89 e5             	mov    %rsp,%rbp
+  80678e:	41 57                	push   %r15
+  806790:	41 54                	push   %r12
+  806792:	53                   	push   %rbx
+  806793:	48 83 ec 28          	sub    $0x28,%rsp
+  806797:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806797 <_pipeisclosed+0xd>
+  80679e:	49 bb 11 50 00 00 00 	movabs $0x5011,%r11
+  8067a5:	00 00 00 
+  8067a8:	4c 01 db             	add    %r11,%rbx
+  8067ab:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8067af:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8067b3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8067ba:	ff ff ff 
+  8067bd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8067c1:	48 8b 00             	mov    (%rax),%rax
+  8067c4:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8067ca:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8067cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8067d1:	48 89 c7             	mov    %rax,%rdi
+  8067d4:	49 89 df             	mov    %rbx,%r15
+  8067d7:	48 b8 94 bd ff ff ff 	movabs $0xffffffffffffbd94,%rax
+  8067de:	ff ff ff 
+  8067e1:	48 01 d8             	add    %rbx,%rax
+  8067e4:	ff d0                	call   *%rax
+  8067e6:	41 89 c4             	mov    %eax,%r12d
+  8067e9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8067ed:	48 89 c7             	mov    %rax,%rdi
+  8067f0:	49 89 df             	mov    %rbx,%r15
+  8067f3:	48 b8 94 bd ff ff ff 	movabs $0xffffffffffffbd94,%rax
+  8067fa:	ff ff ff 
+  8067fd:	48 01 d8             	add    %rbx,%rax
+  806800:	ff d0                	call   *%rax
+  806802:	41 39 c4             	cmp    %eax,%r12d
+  806805:	0f 94 c0             	sete   %al
+  806808:	0f b6 c0             	movzbl %al,%eax
+  80680b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  80680e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806815:	ff ff ff 
+  806818:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80681c:	48 8b 00             	mov    (%rax),%rax
+  80681f:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806825:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  806828:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80682b:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80682e:	75 05                	jne    806835 <_pipeisclosed+0xab>
+			return ret;
+  806830:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806833:	eb 63                	jmp    806898 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  806835:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806838:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80683b:	0f 84 72 ff ff ff    	je     8067b3 <_pipeisclosed+0x29>
+  806841:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  806845:	0f 85 68 ff ff ff    	jne    8067b3 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80684b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806852:	ff ff ff 
+  806855:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806859:	48 8b 00             	mov    (%rax),%rax
+  80685c:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806862:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  806865:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806868:	89 c6                	mov    %eax,%esi
+  80686a:	48 b8 31 c6 ff ff ff 	movabs $0xffffffffffffc631,%rax
+  806871:	ff ff ff 
+  806874:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806878:	48 89 c7             	mov    %rax,%rdi
+  80687b:	49 89 df             	mov    %rbx,%r15
+  80687e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806883:	49 b8 68 55 ff ff ff 	movabs $0xffffffffffff5568,%r8
+  80688a:	ff ff ff 
+  80688d:	49 01 d8             	add    %rbx,%r8
+  806890:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  806893:	e9 1b ff ff ff       	jmp    8067b3 <_pipeisclosed+0x29>
+	}
+}
+  806898:	48 83 c4 28          	add    $0x28,%rsp
+  80689c:	5b                   	pop    %rbx
+  80689d:	41 5c                	pop    %r12
+  80689f:	41 5f                	pop    %r15
+  8068a1:	5d                   	pop    %rbp
+  8068a2:	c3                   	ret
+
+00000000008068a3 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8068a3:	55                   	push   %rbp
+  8068a4:	48 89 e5             	mov    %rsp,%rbp
+  8068a7:	41 57                	push   %r15
+  8068a9:	53                   	push   %rbx
+  8068aa:	48 83 ec 30          	sub    $0x30,%rsp
+  8068ae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068ae <pipeisclosed+0xb>
+  8068b5:	49 bb fa 4e 00 00 00 	movabs $0x4efa,%r11
+  8068bc:	00 00 00 
+  8068bf:	4c 01 db             	add    %r11,%rbx
+  8068c2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8068c5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8068c9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8068cc:	48 89 d6             	mov    %rdx,%rsi
+  8068cf:	89 c7                	mov    %eax,%edi
+  8068d1:	49 89 df             	mov    %rbx,%r15
+  8068d4:	48 b8 bf 78 ff ff ff 	movabs $0xffffffffffff78bf,%rax
+  8068db:	ff ff ff 
+  8068de:	48 01 d8             	add    %rbx,%rax
+  8068e1:	ff d0                	call   *%rax
+  8068e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8068e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068ea:	79 05                	jns    8068f1 <pipeisclosed+0x4e>
+		return r;
+  8068ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068ef:	eb 3b                	jmp    80692c <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8068f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8068f5:	48 89 c7             	mov    %rax,%rdi
+  8068f8:	49 89 df             	mov    %rbx,%r15
+  8068fb:	48 b8 c6 77 ff ff ff 	movabs $0xffffffffffff77c6,%rax
+  806902:	ff ff ff 
+  806905:	48 01 d8             	add    %rbx,%rax
+  806908:	ff d0                	call   *%rax
+  80690a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80690e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806912:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806916:	48 89 d6             	mov    %rdx,%rsi
+  806919:	48 89 c7             	mov    %rax,%rdi
+  80691c:	48 b8 e2 af ff ff ff 	movabs $0xffffffffffffafe2,%rax
+  806923:	ff ff ff 
+  806926:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80692a:	ff d0                	call   *%rax
+}
+  80692c:	48 83 c4 30          	add    $0x30,%rsp
+  806930:	5b                   	pop    %rbx
+  806931:	41 5f                	pop    %r15
+  806933:	5d                   	pop    %rbp
+  806934:	c3                   	ret
+
+0000000000806935 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806935:	55                   	push   %rbp
+  806936:	48 89 e5             	mov    %rsp,%rbp
+  806939:	41 57                	push   %r15
+  80693b:	53                   	push   %rbx
+  80693c:	48 83 ec 40          	sub    $0x40,%rsp
+  806940:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806940 <devpipe_read+0xb>
+  806947:	49 bb 68 4e 00 00 00 	movabs $0x4e68,%r11
+  80694e:	00 00 00 
+  806951:	4c 01 db             	add    %r11,%rbx
+  806954:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806958:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80695c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806960:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806964:	48 89 c7             	mov    %rax,%rdi
+  806967:	49 89 df             	mov    %rbx,%r15
+  80696a:	48 b8 c6 77 ff ff ff 	movabs $0xffffffffffff77c6,%rax
+  806971:	ff ff ff 
+  806974:	48 01 d8             	add    %rbx,%rax
+  806977:	ff d0                	call   *%rax
+  806979:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80697d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806981:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806985:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80698c:	00 
+  80698d:	e9 a1 00 00 00       	jmp    806a33 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  806992:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806997:	74 09                	je     8069a2 <devpipe_read+0x6d>
+				return i;
+  806999:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80699d:	e9 9f 00 00 00       	jmp    806a41 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8069a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8069a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8069aa:	48 89 d6             	mov    %rdx,%rsi
+  8069ad:	48 89 c7             	mov    %rax,%rdi
+  8069b0:	48 b8 e2 af ff ff ff 	movabs $0xffffffffffffafe2,%rax
+  8069b7:	ff ff ff 
+  8069ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8069be:	ff d0                	call   *%rax
+  8069c0:	85 c0                	test   %eax,%eax
+  8069c2:	74 07                	je     8069cb <devpipe_read+0x96>
+				return 0;
+  8069c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8069c9:	eb 76                	jmp    806a41 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8069cb:	49 89 df             	mov    %rbx,%r15
+  8069ce:	48 b8 91 6f ff ff ff 	movabs $0xffffffffffff6f91,%rax
+  8069d5:	ff ff ff 
+  8069d8:	48 01 d8             	add    %rbx,%rax
+  8069db:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8069dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8069e1:	8b 10                	mov    (%rax),%edx
+  8069e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8069e7:	8b 40 04             	mov    0x4(%rax),%eax
+  8069ea:	39 c2                	cmp    %eax,%edx
+  8069ec:	74 a4                	je     806992 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8069ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8069f2:	8b 10                	mov    (%rax),%edx
+  8069f4:	89 d0                	mov    %edx,%eax
+  8069f6:	c1 f8 1f             	sar    $0x1f,%eax
+  8069f9:	c1 e8 1b             	shr    $0x1b,%eax
+  8069fc:	01 c2                	add    %eax,%edx
+  8069fe:	83 e2 1f             	and    $0x1f,%edx
+  806a01:	29 c2                	sub    %eax,%edx
+  806a03:	89 d6                	mov    %edx,%esi
+  806a05:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806a09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806a0d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806a11:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806a15:	48 63 c6             	movslq %esi,%rax
+  806a18:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806a1d:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806a1f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a23:	8b 00                	mov    (%rax),%eax
+  806a25:	8d 50 01             	lea    0x1(%rax),%edx
+  806a28:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a2c:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806a2e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806a33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806a37:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806a3b:	72 a0                	jb     8069dd <devpipe_read+0xa8>
+	}
+	return i;
+  806a3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806a41:	48 83 c4 40          	add    $0x40,%rsp
+  806a45:	5b                   	pop    %rbx
+  806a46:	41 5f                	pop    %r15
+  806a48:	5d                   	pop    %rbp
+  806a49:	c3                   	ret
+
+0000000000806a4a <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806a4a:	55                   	push   %rbp
+  806a4b:	48 89 e5             	mov    %rsp,%rbp
+  806a4e:	41 57                	push   %r15
+  806a50:	53                   	push   %rbx
+  806a51:	48 83 ec 40          	sub    $0x40,%rsp
+  806a55:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a55 <devpipe_write+0xb>
+  806a5c:	49 bb 53 4d 00 00 00 	movabs $0x4d53,%r11
+  806a63:	00 00 00 
+  806a66:	4c 01 db             	add    %r11,%rbx
+  806a69:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806a6d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806a71:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  806a75:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806a79:	48 89 c7             	mov    %rax,%rdi
+  806a7c:	49 89 df             	mov    %rbx,%r15
+  806a7f:	48 b8 c6 77 ff ff ff 	movabs $0xffffffffffff77c6,%rax
+  806a86:	ff ff ff 
+  806a89:	48 01 d8             	add    %rbx,%rax
+  806a8c:	ff d0                	call   *%rax
+  806a8e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806a92:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806a96:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806a9a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806aa1:	00 
+  806aa2:	e9 a0 00 00 00       	jmp    806b47 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  806aa7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806aab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806aaf:	48 89 d6             	mov    %rdx,%rsi
+  806ab2:	48 89 c7             	mov    %rax,%rdi
+  806ab5:	48 b8 e2 af ff ff ff 	movabs $0xffffffffffffafe2,%rax
+  806abc:	ff ff ff 
+  806abf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806ac3:	ff d0                	call   *%rax
+  806ac5:	85 c0                	test   %eax,%eax
+  806ac7:	74 0a                	je     806ad3 <devpipe_write+0x89>
+				return 0;
+  806ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ace:	e9 82 00 00 00       	jmp    806b55 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  806ad3:	49 89 df             	mov    %rbx,%r15
+  806ad6:	48 b8 91 6f ff ff ff 	movabs $0xffffffffffff6f91,%rax
+  806add:	ff ff ff 
+  806ae0:	48 01 d8             	add    %rbx,%rax
+  806ae3:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  806ae5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ae9:	8b 40 04             	mov    0x4(%rax),%eax
+  806aec:	48 63 d0             	movslq %eax,%rdx
+  806aef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806af3:	8b 00                	mov    (%rax),%eax
+  806af5:	48 98                	cltq
+  806af7:	48 83 c0 20          	add    $0x20,%rax
+  806afb:	48 39 c2             	cmp    %rax,%rdx
+  806afe:	73 a7                	jae    806aa7 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806b00:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806b04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806b08:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806b0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b10:	8b 50 04             	mov    0x4(%rax),%edx
+  806b13:	89 d0                	mov    %edx,%eax
+  806b15:	c1 f8 1f             	sar    $0x1f,%eax
+  806b18:	c1 e8 1b             	shr    $0x1b,%eax
+  806b1b:	01 c2                	add    %eax,%edx
+  806b1d:	83 e2 1f             	and    $0x1f,%edx
+  806b20:	29 c2                	sub    %eax,%edx
+  806b22:	89 d0                	mov    %edx,%eax
+  806b24:	0f b6 09             	movzbl (%rcx),%ecx
+  806b27:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806b2b:	48 98                	cltq
+  806b2d:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806b31:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b35:	8b 40 04             	mov    0x4(%rax),%eax
+  806b38:	8d 50 01             	lea    0x1(%rax),%edx
+  806b3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b3f:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806b42:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806b47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806b4b:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806b4f:	72 94                	jb     806ae5 <devpipe_write+0x9b>
+	}
+
+	return i;
+  806b51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806b55:	48 83 c4 40          	add    $0x40,%rsp
+  806b59:	5b                   	pop    %rbx
+  806b5a:	41 5f                	pop    %r15
+  806b5c:	5d                   	pop    %rbp
+  806b5d:	c3                   	ret
+
+0000000000806b5e <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806b5e:	55                   	push   %rbp
+  806b5f:	48 89 e5             	mov    %rsp,%rbp
+  806b62:	41 57                	push   %r15
+  806b64:	53                   	push   %rbx
+  806b65:	48 83 ec 20          	sub    $0x20,%rsp
+  806b69:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b69 <devpipe_stat+0xb>
+  806b70:	49 bb 3f 4c 00 00 00 	movabs $0x4c3f,%r11
+  806b77:	00 00 00 
+  806b7a:	4c 01 db             	add    %r11,%rbx
+  806b7d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806b81:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  806b85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806b89:	48 89 c7             	mov    %rax,%rdi
+  806b8c:	49 89 df             	mov    %rbx,%r15
+  806b8f:	48 b8 c6 77 ff ff ff 	movabs $0xffffffffffff77c6,%rax
+  806b96:	ff ff ff 
+  806b99:	48 01 d8             	add    %rbx,%rax
+  806b9c:	ff d0                	call   *%rax
+  806b9e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  806ba2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806ba6:	48 ba 44 c6 ff ff ff 	movabs $0xffffffffffffc644,%rdx
+  806bad:	ff ff ff 
+  806bb0:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806bb4:	48 89 d6             	mov    %rdx,%rsi
+  806bb7:	48 89 c7             	mov    %rax,%rdi
+  806bba:	49 89 df             	mov    %rbx,%r15
+  806bbd:	48 b8 2a 63 ff ff ff 	movabs $0xffffffffffff632a,%rax
+  806bc4:	ff ff ff 
+  806bc7:	48 01 d8             	add    %rbx,%rax
+  806bca:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  806bcc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806bd0:	8b 50 04             	mov    0x4(%rax),%edx
+  806bd3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806bd7:	8b 00                	mov    (%rax),%eax
+  806bd9:	29 c2                	sub    %eax,%edx
+  806bdb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806bdf:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  806be5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806be9:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806bf0:	00 00 00 
+	stat->st_dev = &devpipe;
+  806bf3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806bf7:	48 ba d8 00 00 00 00 	movabs $0xd8,%rdx
+  806bfe:	00 00 00 
+  806c01:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806c05:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806c11:	48 83 c4 20          	add    $0x20,%rsp
+  806c15:	5b                   	pop    %rbx
+  806c16:	41 5f                	pop    %r15
+  806c18:	5d                   	pop    %rbp
+  806c19:	c3                   	ret
+
+0000000000806c1a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806c1a:	55                   	push   %rbp
+  806c1b:	48 89 e5             	mov    %rsp,%rbp
+  806c1e:	41 57                	push   %r15
+  806c20:	53                   	push   %rbx
+  806c21:	48 83 ec 10          	sub    $0x10,%rsp
+  806c25:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c25 <devpipe_close+0xb>
+  806c2c:	49 bb 83 4b 00 00 00 	movabs $0x4b83,%r11
+  806c33:	00 00 00 
+  806c36:	4c 01 db             	add    %r11,%rbx
+  806c39:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806c3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806c41:	48 89 c6             	mov    %rax,%rsi
+  806c44:	bf 00 00 00 00       	mov    $0x0,%edi
+  806c49:	49 89 df             	mov    %rbx,%r15
+  806c4c:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  806c53:	ff ff ff 
+  806c56:	48 01 d8             	add    %rbx,%rax
+  806c59:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  806c5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806c5f:	48 89 c7             	mov    %rax,%rdi
+  806c62:	49 89 df             	mov    %rbx,%r15
+  806c65:	48 b8 c6 77 ff ff ff 	movabs $0xffffffffffff77c6,%rax
+  806c6c:	ff ff ff 
+  806c6f:	48 01 d8             	add    %rbx,%rax
+  806c72:	ff d0                	call   *%rax
+  806c74:	48 89 c6             	mov    %rax,%rsi
+  806c77:	bf 00 00 00 00       	mov    $0x0,%edi
+  806c7c:	49 89 df             	mov    %rbx,%r15
+  806c7f:	48 b8 be 70 ff ff ff 	movabs $0xffffffffffff70be,%rax
+  806c86:	ff ff ff 
+  806c89:	48 01 d8             	add    %rbx,%rax
+  806c8c:	ff d0                	call   *%rax
+}
+  806c8e:	48 83 c4 10          	add    $0x10,%rsp
+  806c92:	5b                   	pop    %rbx
+  806c93:	41 5f                	pop    %r15
+  806c95:	5d                   	pop    %rbp
+  806c96:	c3                   	ret
+
+0000000000806c97 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  806c97:	55                   	push   %rbp
+  806c98:	48 89 e5             	mov    %rsp,%rbp
+  806c9b:	41 57                	push   %r15
+  806c9d:	53                   	push   %rbx
+  806c9e:	48 83 ec 20          	sub    $0x20,%rsp
+  806ca2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ca2 <wait+0xb>
+  806ca9:	49 bb 06 4b 00 00 00 	movabs $0x4b06,%r11
+  806cb0:	00 00 00 
+  806cb3:	4c 01 db             	add    %r11,%rbx
+  806cb6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  806cb9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806cbd:	75 50                	jne    806d0f <wait+0x78>
+  806cbf:	48 b8 4b c6 ff ff ff 	movabs $0xffffffffffffc64b,%rax
+  806cc6:	ff ff ff 
+  806cc9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806ccd:	48 89 c1             	mov    %rax,%rcx
+  806cd0:	48 b8 56 c6 ff ff ff 	movabs $0xffffffffffffc656,%rax
+  806cd7:	ff ff ff 
+  806cda:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806cde:	48 89 c2             	mov    %rax,%rdx
+  806ce1:	be 09 00 00 00       	mov    $0x9,%esi
+  806ce6:	48 b8 6b c6 ff ff ff 	movabs $0xffffffffffffc66b,%rax
+  806ced:	ff ff ff 
+  806cf0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806cf4:	48 89 c7             	mov    %rax,%rdi
+  806cf7:	49 89 df             	mov    %rbx,%r15
+  806cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cff:	49 b8 91 52 ff ff ff 	movabs $0xffffffffffff5291,%r8
+  806d06:	ff ff ff 
+  806d09:	49 01 d8             	add    %rbx,%r8
+  806d0c:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  806d0f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806d12:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806d17:	48 98                	cltq
+  806d19:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806d20:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806d27:	ff ff ff 
+  806d2a:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806d2e:	48 01 d0             	add    %rdx,%rax
+  806d31:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  806d35:	eb 12                	jmp    806d49 <wait+0xb2>
+		sys_yield();
+  806d37:	49 89 df             	mov    %rbx,%r15
+  806d3a:	48 b8 91 6f ff ff ff 	movabs $0xffffffffffff6f91,%rax
+  806d41:	ff ff ff 
+  806d44:	48 01 d8             	add    %rbx,%rax
+  806d47:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  806d49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806d4d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  806d53:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  806d56:	75 0e                	jne    806d66 <wait+0xcf>
+  806d58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806d5c:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  806d62:	85 c0                	test   %eax,%eax
+  806d64:	75 d1                	jne    806d37 <wait+0xa0>
+}
+  806d66:	90                   	nop
+  806d67:	48 83 c4 20          	add    $0x20,%rsp
+  806d6b:	5b                   	pop    %rbx
+  806d6c:	41 5f                	pop    %r15
+  806d6e:	5d                   	pop    %rbp
+  806d6f:	c3                   	ret
+
+0000000000806d70 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806d70:	55                   	push   %rbp
+  806d71:	48 89 e5             	mov    %rsp,%rbp
+  806d74:	41 57                	push   %r15
+  806d76:	53                   	push   %rbx
+  806d77:	48 83 ec 30          	sub    $0x30,%rsp
+  806d7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d7b <ipc_recv+0xb>
+  806d82:	49 bb 2d 4a 00 00 00 	movabs $0x4a2d,%r11
+  806d89:	00 00 00 
+  806d8c:	4c 01 db             	add    %r11,%rbx
+  806d8f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806d93:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806d97:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  806d9b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806da0:	75 0e                	jne    806db0 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  806da2:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806da9:	00 00 00 
+  806dac:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  806db0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806db4:	48 89 c7             	mov    %rax,%rdi
+  806db7:	49 89 df             	mov    %rbx,%r15
+  806dba:	48 b8 0f 73 ff ff ff 	movabs $0xffffffffffff730f,%rax
+  806dc1:	ff ff ff 
+  806dc4:	48 01 d8             	add    %rbx,%rax
+  806dc7:	ff d0                	call   *%rax
+  806dc9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  806dcc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806dd1:	74 2a                	je     806dfd <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  806dd3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806dd7:	75 19                	jne    806df2 <ipc_recv+0x82>
+  806dd9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806de0:	ff ff ff 
+  806de3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806de7:	48 8b 00             	mov    (%rax),%rax
+  806dea:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806df0:	eb 05                	jmp    806df7 <ipc_recv+0x87>
+  806df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  806df7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806dfb:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806dfd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806e02:	74 2a                	je     806e2e <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  806e04:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806e08:	75 19                	jne    806e23 <ipc_recv+0xb3>
+  806e0a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806e11:	ff ff ff 
+  806e14:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e18:	48 8b 00             	mov    (%rax),%rax
+  806e1b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806e21:	eb 05                	jmp    806e28 <ipc_recv+0xb8>
+  806e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e28:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806e2c:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806e2e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806e32:	74 05                	je     806e39 <ipc_recv+0xc9>
+		return res;
+  806e34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e37:	eb 17                	jmp    806e50 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806e39:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806e40:	ff ff ff 
+  806e43:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e47:	48 8b 00             	mov    (%rax),%rax
+  806e4a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806e50:	48 83 c4 30          	add    $0x30,%rsp
+  806e54:	5b                   	pop    %rbx
+  806e55:	41 5f                	pop    %r15
+  806e57:	5d                   	pop    %rbp
+  806e58:	c3                   	ret
+
+0000000000806e59 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806e59:	55                   	push   %rbp
+  806e5a:	48 89 e5             	mov    %rsp,%rbp
+  806e5d:	41 57                	push   %r15
+  806e5f:	53                   	push   %rbx
+  806e60:	48 83 ec 20          	sub    $0x20,%rsp
+  806e64:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806e64 <ipc_send+0xb>
+  806e6b:	49 bb 44 49 00 00 00 	movabs $0x4944,%r11
+  806e72:	00 00 00 
+  806e75:	4c 01 db             	add    %r11,%rbx
+  806e78:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806e7b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806e7e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806e82:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  806e85:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806e8a:	75 0e                	jne    806e9a <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806e8c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806e93:	00 00 00 
+  806e96:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  806e9a:	90                   	nop
+  806e9b:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806e9e:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806ea1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806ea5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ea8:	89 c7                	mov    %eax,%edi
+  806eaa:	49 89 df             	mov    %rbx,%r15
+  806ead:	48 b8 a5 72 ff ff ff 	movabs $0xffffffffffff72a5,%rax
+  806eb4:	ff ff ff 
+  806eb7:	48 01 d8             	add    %rbx,%rax
+  806eba:	ff d0                	call   *%rax
+  806ebc:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  806ebf:	74 da                	je     806e9b <ipc_send+0x42>
+		;
+}
+  806ec1:	90                   	nop
+  806ec2:	90                   	nop
+  806ec3:	48 83 c4 20          	add    $0x20,%rsp
+  806ec7:	5b                   	pop    %rbx
+  806ec8:	41 5f                	pop    %r15
+  806eca:	5d                   	pop    %rbp
+  806ecb:	c3                   	ret
+
+0000000000806ecc <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  806ecc:	55                   	push   %rbp
+  806ecd:	48 89 e5             	mov    %rsp,%rbp
+  806ed0:	41 57                	push   %r15
+  806ed2:	53                   	push   %rbx
+  806ed3:	48 83 ec 40          	sub    $0x40,%rsp
+  806ed7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ed7 <ipc_call+0xb>
+  806ede:	49 bb d1 48 00 00 00 	movabs $0x48d1,%r11
+  806ee5:	00 00 00 
+  806ee8:	4c 01 db             	add    %r11,%rbx
+  806eeb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806eee:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806ef1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806ef5:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806ef8:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806efc:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806f00:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806f05:	75 0e                	jne    806f15 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806f07:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806f0e:	00 00 00 
+  806f11:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806f15:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806f1a:	75 0e                	jne    806f2a <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806f1c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806f23:	00 00 00 
+  806f26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806f2a:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806f2d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806f31:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806f34:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806f38:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806f3b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806f41:	49 89 f8             	mov    %rdi,%r8
+  806f44:	89 c7                	mov    %eax,%edi
+  806f46:	49 89 df             	mov    %rbx,%r15
+  806f49:	48 b8 68 73 ff ff ff 	movabs $0xffffffffffff7368,%rax
+  806f50:	ff ff ff 
+  806f53:	48 01 d8             	add    %rbx,%rax
+  806f56:	ff d0                	call   *%rax
+  806f58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806f5b:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806f60:	74 2a                	je     806f8c <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806f62:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806f66:	75 19                	jne    806f81 <ipc_call+0xb5>
+  806f68:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806f6f:	ff ff ff 
+  806f72:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806f76:	48 8b 00             	mov    (%rax),%rax
+  806f79:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806f7f:	eb 05                	jmp    806f86 <ipc_call+0xba>
+  806f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f86:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806f8a:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806f8c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806f90:	74 05                	je     806f97 <ipc_call+0xcb>
+		return r;
+  806f92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806f95:	eb 17                	jmp    806fae <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806f97:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806f9e:	ff ff ff 
+  806fa1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806fa5:	48 8b 00             	mov    (%rax),%rax
+  806fa8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806fae:	48 83 c4 40          	add    $0x40,%rsp
+  806fb2:	5b                   	pop    %rbx
+  806fb3:	41 5f                	pop    %r15
+  806fb5:	5d                   	pop    %rbp
+  806fb6:	c3                   	ret
+
+0000000000806fb7 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806fb7:	55                   	push   %rbp
+  806fb8:	48 89 e5             	mov    %rsp,%rbp
+  806fbb:	41 57                	push   %r15
+  806fbd:	53                   	push   %rbx
+  806fbe:	48 83 ec 70          	sub    $0x70,%rsp
+  806fc2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806fc2 <ipc_callw+0xb>
+  806fc9:	49 bb e6 47 00 00 00 	movabs $0x47e6,%r11
+  806fd0:	00 00 00 
+  806fd3:	4c 01 db             	add    %r11,%rbx
+  806fd6:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806fd9:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806fdc:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806fe0:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806fe4:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806fe9:	76 0a                	jbe    806ff5 <ipc_callw+0x3e>
+		return -E_INVAL;
+  806feb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806ff0:	e9 b7 00 00 00       	jmp    8070ac <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806ff5:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806ff9:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806ffd:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  807001:	48 89 ce             	mov    %rcx,%rsi
+  807004:	48 89 c7             	mov    %rax,%rdi
+  807007:	49 89 df             	mov    %rbx,%r15
+  80700a:	48 b8 0a 67 ff ff ff 	movabs $0xffffffffffff670a,%rax
+  807011:	ff ff ff 
+  807014:	48 01 d8             	add    %rbx,%rax
+  807017:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  807019:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  807020:	00 
+  807021:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  807025:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807029:	48 01 d0             	add    %rdx,%rax
+  80702c:	48 83 e8 01          	sub    $0x1,%rax
+  807030:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  807034:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807038:	ba 00 00 00 00       	mov    $0x0,%edx
+  80703d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  807041:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807045:	48 29 d0             	sub    %rdx,%rax
+  807048:	48 c1 e8 03          	shr    $0x3,%rax
+  80704c:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  807050:	89 c1                	mov    %eax,%ecx
+  807052:	8b 75 98             	mov    -0x68(%rbp),%esi
+  807055:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  807059:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80705c:	49 89 d1             	mov    %rdx,%r9
+  80705f:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  807066:	00 00 00 
+  807069:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  807070:	00 00 00 
+  807073:	89 c7                	mov    %eax,%edi
+  807075:	49 89 df             	mov    %rbx,%r15
+  807078:	48 b8 68 73 ff ff ff 	movabs $0xffffffffffff7368,%rax
+  80707f:	ff ff ff 
+  807082:	48 01 d8             	add    %rbx,%rax
+  807085:	ff d0                	call   *%rax
+  807087:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  80708a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80708e:	74 05                	je     807095 <ipc_callw+0xde>
+		return r;
+  807090:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807093:	eb 17                	jmp    8070ac <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  807095:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80709c:	ff ff ff 
+  80709f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8070a3:	48 8b 00             	mov    (%rax),%rax
+  8070a6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8070ac:	48 83 c4 70          	add    $0x70,%rsp
+  8070b0:	5b                   	pop    %rbx
+  8070b1:	41 5f                	pop    %r15
+  8070b3:	5d                   	pop    %rbp
+  8070b4:	c3                   	ret
+
+00000000008070b5 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8070b5:	55                   	push   %rbp
+  8070b6:	48 89 e5             	mov    %rsp,%rbp
+  8070b9:	41 57                	push   %r15
+  8070bb:	53                   	push   %rbx
+  8070bc:	48 83 ec 40          	sub    $0x40,%rsp
+  8070c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8070c0 <ipc_callv+0xb>
+  8070c7:	49 bb e8 46 00 00 00 	movabs $0x46e8,%r11
+  8070ce:	00 00 00 
+  8070d1:	4c 01 db             	add    %r11,%rbx
+  8070d4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8070d7:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8070da:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8070de:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8070e1:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8070e5:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  8070e9:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8070f0:	00 00 00 
+  8070f3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  8070f7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  8070fb:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8070ff:	74 11                	je     807112 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  807101:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  807105:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  807109:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80710c:	c1 e0 14             	shl    $0x14,%eax
+  80710f:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  807112:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  807116:	74 14                	je     80712c <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  807118:	8b 45 20             	mov    0x20(%rbp),%eax
+  80711b:	83 e8 01             	sub    $0x1,%eax
+  80711e:	48 63 d0             	movslq %eax,%rdx
+  807121:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  807125:	48 09 d0             	or     %rdx,%rax
+  807128:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  80712c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80712f:	c1 e0 10             	shl    $0x10,%eax
+  807132:	0b 45 10             	or     0x10(%rbp),%eax
+  807135:	89 c1                	mov    %eax,%ecx
+  807137:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80713a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80713e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  807142:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807146:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  807149:	4d 89 c1             	mov    %r8,%r9
+  80714c:	49 89 f8             	mov    %rdi,%r8
+  80714f:	89 c7                	mov    %eax,%edi
+  807151:	49 89 df             	mov    %rbx,%r15
+  807154:	48 b8 68 73 ff ff ff 	movabs $0xffffffffffff7368,%rax
+  80715b:	ff ff ff 
+  80715e:	48 01 d8             	add    %rbx,%rax
+  807161:	ff d0                	call   *%rax
+  807163:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  807166:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80716a:	74 05                	je     807171 <ipc_callv+0xbc>
+		return r;
+  80716c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80716f:	eb 17                	jmp    807188 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  807171:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807178:	ff ff ff 
+  80717b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80717f:	48 8b 00             	mov    (%rax),%rax
+  807182:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  807188:	48 83 c4 40          	add    $0x40,%rsp
+  80718c:	5b                   	pop    %rbx
+  80718d:	41 5f                	pop    %r15
+  80718f:	5d                   	pop    %rbp
+  807190:	c3                   	ret
+
+0000000000807191 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  807191:	55                   	push   %rbp
+  807192:	48 89 e5             	mov    %rsp,%rbp
+  807195:	41 57                	push   %r15
+  807197:	53                   	push   %rbx
+  807198:	48 83 ec 40          	sub    $0x40,%rsp
+  80719c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80719c <ipc_reply_recv+0xb>
+  8071a3:	49 bb 0c 46 00 00 00 	movabs $0x460c,%r11
+  8071aa:	00 00 00 
+  8071ad:	4c 01 db             	add    %r11,%rbx
+  8071b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8071b3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8071b6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8071ba:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8071bd:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8071c1:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8071c5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8071ca:	75 0e                	jne    8071da <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  8071cc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8071d3:	00 00 00 
+  8071d6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8071da:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8071df:	75 0e                	jne    8071ef <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8071e1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8071e8:	00 00 00 
+  8071eb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  8071ef:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8071f2:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  8071f6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8071fa:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8071fd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  807201:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807204:	4d 89 c1             	mov    %r8,%r9
+  807207:	49 89 f8             	mov    %rdi,%r8
+  80720a:	89 c7                	mov    %eax,%edi
+  80720c:	49 89 df             	mov    %rbx,%r15
+  80720f:	48 b8 dc 73 ff ff ff 	movabs $0xffffffffffff73dc,%rax
+  807216:	ff ff ff 
+  807219:	48 01 d8             	add    %rbx,%rax
+  80721c:	ff d0                	call   *%rax
+  80721e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  807221:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  807226:	74 2a                	je     807252 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  807228:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80722c:	75 19                	jne    807247 <ipc_reply_recv+0xb6>
+  80722e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807235:	ff ff ff 
+  807238:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80723c:	48 8b 00             	mov    (%rax),%rax
+  80723f:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  807245:	eb 05                	jmp    80724c <ipc_reply_recv+0xbb>
+  807247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80724c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807250:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  807252:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  807257:	74 2a                	je     807283 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  807259:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80725d:	75 19                	jne    807278 <ipc_reply_recv+0xe7>
+  80725f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807266:	ff ff ff 
+  807269:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80726d:	48 8b 00             	mov    (%rax),%rax
+  807270:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  807276:	eb 05                	jmp    80727d <ipc_reply_recv+0xec>
+  807278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80727d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  807281:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  807283:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807287:	74 05                	je     80728e <ipc_reply_recv+0xfd>
+		return r;
+  807289:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80728c:	eb 17                	jmp    8072a5 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  80728e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  807295:	ff ff ff 
+  807298:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80729c:	48 8b 00             	mov    (%rax),%rax
+  80729f:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8072a5:	48 83 c4 40          	add    $0x40,%rsp
+  8072a9:	5b                   	pop    %rbx
+  8072aa:	41 5f                	pop    %r15
+  8072ac:	5d                   	pop    %rbp
+  8072ad:	c3                   	ret
+
+00000000008072ae <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  8072ae:	55                   	push   %rbp
+  8072af:	48 89 e5             	mov    %rsp,%rbp
+  8072b2:	41 57                	push   %r15
+  8072b4:	53                   	push   %rbx
+  8072b5:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  8072bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8072bc <ipc_window_batch+0xe>
+  8072c3:	49 bb ec 44 00 00 00 	movabs $0x44ec,%r11
+  8072ca:	00 00 00 
+  8072cd:	4c 01 db             	add    %r11,%rbx
+  8072d0:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  8072d6:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  8072dd:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  8072e3:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  8072e9:	e9 15 01 00 00       	jmp    807403 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  8072ee:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  8072f4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8072f7:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  8072fe:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  807301:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807304:	39 c2                	cmp    %eax,%edx
+  807306:	0f 4e c2             	cmovle %edx,%eax
+  807309:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  80730c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  807313:	eb 6b                	jmp    807380 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  807315:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807318:	48 98                	cltq
+  80731a:	48 c1 e0 05          	shl    $0x5,%rax
+  80731e:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807322:	48 01 e8             	add    %rbp,%rax
+  807325:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  80732b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  807331:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807334:	c1 e0 0c             	shl    $0xc,%eax
+  807337:	48 63 d0             	movslq %eax,%rdx
+  80733a:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  807341:	48 01 c2             	add    %rax,%rdx
+  807344:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807347:	48 98                	cltq
+  807349:	48 c1 e0 05          	shl    $0x5,%rax
+  80734d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807351:	48 01 e8             	add    %rbp,%rax
+  807354:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  80735a:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  80735d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807360:	48 98                	cltq
+  807362:	48 c1 e0 05          	shl    $0x5,%rax
+  807366:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80736a:	48 01 e8             	add    %rbp,%rax
+  80736d:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  807374:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  80737a:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  80737c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  807380:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807383:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  807386:	7c 8d                	jl     807315 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  807388:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  80738f:	74 27                	je     8073b8 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  807391:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807394:	48 63 d0             	movslq %eax,%rdx
+  807397:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  80739e:	48 89 d6             	mov    %rdx,%rsi
+  8073a1:	48 89 c7             	mov    %rax,%rdi
+  8073a4:	49 89 df             	mov    %rbx,%r15
+  8073a7:	48 b8 7f 76 ff ff ff 	movabs $0xffffffffffff767f,%rax
+  8073ae:	ff ff ff 
+  8073b1:	48 01 d8             	add    %rbx,%rax
+  8073b4:	ff d0                	call   *%rax
+  8073b6:	eb 25                	jmp    8073dd <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  8073b8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8073bb:	48 63 d0             	movslq %eax,%rdx
+  8073be:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8073c5:	48 89 d6             	mov    %rdx,%rsi
+  8073c8:	48 89 c7             	mov    %rax,%rdi
+  8073cb:	49 89 df             	mov    %rbx,%r15
+  8073ce:	48 b8 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rax
+  8073d5:	ff ff ff 
+  8073d8:	48 01 d8             	add    %rbx,%rax
+  8073db:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8073dd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  8073e0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8073e4:	79 05                	jns    8073eb <ipc_window_batch+0x13d>
+			return r;
+  8073e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8073e9:	eb 2a                	jmp    807415 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  8073eb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8073ee:	c1 e0 0c             	shl    $0xc,%eax
+  8073f1:	48 98                	cltq
+  8073f3:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  8073fa:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8073fd:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  807403:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  80740a:	0f 8f de fe ff ff    	jg     8072ee <ipc_window_batch+0x40>
+	}
+	return 0;
+  807410:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807415:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  80741c:	5b                   	pop    %rbx
+  80741d:	41 5f                	pop    %r15
+  80741f:	5d                   	pop    %rbp
+  807420:	c3                   	ret
+
+0000000000807421 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  807421:	55                   	push   %rbp
+  807422:	48 89 e5             	mov    %rsp,%rbp
+  807425:	48 83 ec 10          	sub    $0x10,%rsp
+  807429:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807429 <ipc_map_window+0x8>
+  807430:	49 bb 7f 43 00 00 00 	movabs $0x437f,%r11
+  807437:	00 00 00 
+  80743a:	4c 01 d8             	add    %r11,%rax
+  80743d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  807441:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  807444:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  807447:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80744b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  807450:	bf 01 00 00 00       	mov    $0x1,%edi
+  807455:	49 b8 06 bb ff ff ff 	movabs $0xffffffffffffbb06,%r8
+  80745c:	ff ff ff 
+  80745f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  807463:	ff d0                	call   *%rax
+}
+  807465:	c9                   	leave
+  807466:	c3                   	ret
+
+0000000000807467 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  807467:	55                   	push   %rbp
+  807468:	48 89 e5             	mov    %rsp,%rbp
+  80746b:	48 83 ec 10          	sub    $0x10,%rsp
+  80746f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80746f <ipc_unmap_window+0x8>
+  807476:	49 bb 39 43 00 00 00 	movabs $0x4339,%r11
+  80747d:	00 00 00 
+  807480:	4c 01 d8             	add    %r11,%rax
+  807483:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  807487:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  80748a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80748d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  807491:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807496:	bf 00 00 00 00       	mov    $0x0,%edi
+  80749b:	49 b8 06 bb ff ff ff 	movabs $0xffffffffffffbb06,%r8
+  8074a2:	ff ff ff 
+  8074a5:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8074a9:	ff d0                	call   *%rax
+}
+  8074ab:	c9                   	leave
+  8074ac:	c3                   	ret
+
+00000000008074ad <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8074ad:	55                   	push   %rbp
+  8074ae:	48 89 e5             	mov    %rsp,%rbp
+  8074b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8074b5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8074b5 <ipc_find_env+0x8>
+  8074bc:	49 bb f3 42 00 00 00 	movabs $0x42f3,%r11
+  8074c3:	00 00 00 
+  8074c6:	4c 01 d8             	add    %r11,%rax
+  8074c9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  8074cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8074d3:	eb 57                	jmp    80752c <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  8074d5:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8074dc:	ff ff ff 
+  8074df:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8074e3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8074e6:	48 63 d2             	movslq %edx,%rdx
+  8074e9:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  8074f0:	48 01 ca             	add    %rcx,%rdx
+  8074f3:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  8074fa:	8b 12                	mov    (%rdx),%edx
+  8074fc:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  8074ff:	75 27                	jne    807528 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  807501:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  807508:	ff ff ff 
+  80750b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80750f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807512:	48 98                	cltq
+  807514:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80751b:	48 01 d0             	add    %rdx,%rax
+  80751e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  807524:	8b 00                	mov    (%rax),%eax
+  807526:	eb 12                	jmp    80753a <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  807528:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80752c:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  807533:	7e a0                	jle    8074d5 <ipc_find_env+0x28>
+	}
+	return 0;
+  807535:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80753a:	c9                   	leave
+  80753b:	c3                   	ret
+
+000000000080753c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80753c:	55                   	push   %rbp
+  80753d:	48 89 e5             	mov    %rsp,%rbp
+  807540:	48 83 ec 18          	sub    $0x18,%rsp
+  807544:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807544 <pageref+0x8>
+  80754b:	49 bb 64 42 00 00 00 	movabs $0x4264,%r11
+  807552:	00 00 00 
+  807555:	4c 01 d8             	add    %r11,%rax
+  807558:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80755c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807560:	48 89 d1             	mov    %rdx,%rcx
+  807563:	48 c1 e9 15          	shr    $0x15,%rcx
+  807567:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80756e:	ff ff ff 
+  807571:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807575:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807579:	83 e2 01             	and    $0x1,%edx
+  80757c:	48 85 d2             	test   %rdx,%rdx
+  80757f:	75 07                	jne    807588 <pageref+0x4c>
+		return 0;
+  807581:	b8 00 00 00 00       	mov    $0x0,%eax
+  807586:	eb 64                	jmp    8075ec <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  807588:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80758c:	48 89 d1             	mov    %rdx,%rcx
+  80758f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  807593:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80759a:	ff ff ff 
+  80759d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8075a1:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8075a5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8075a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8075ad:	83 e2 01             	and    $0x1,%edx
+  8075b0:	48 85 d2             	test   %rdx,%rdx
+  8075b3:	75 07                	jne    8075bc <pageref+0x80>
+		return 0;
+  8075b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8075ba:	eb 30                	jmp    8075ec <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8075bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8075c0:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8075c4:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  8075cb:	ff ff ff 
+  8075ce:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8075d2:	48 89 d0             	mov    %rdx,%rax
+  8075d5:	48 01 c0             	add    %rax,%rax
+  8075d8:	48 01 d0             	add    %rdx,%rax
+  8075db:	48 c1 e0 03          	shl    $0x3,%rax
+  8075df:	48 01 c8             	add    %rcx,%rax
+  8075e2:	48 83 c0 08          	add    $0x8,%rax
+  8075e6:	0f b7 00             	movzwl (%rax),%eax
+  8075e9:	0f b7 c0             	movzwl %ax,%eax
+}
+  8075ec:	c9                   	leave
+  8075ed:	c3                   	ret
@@ -0,0 +1,10405 @@
+
+obj/user/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 9a 06 00 00       	call   8006db <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <ls>:
+void lsdir(const char*, const char*);
+void ls1(const char*, bool, off_t, const char*);
+
+void
+ls(const char *path, const char *prefix)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  800051:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800051 <ls+0xe>
+  800058:	49 bb df 8f 00 00 00 	movabs $0x8fdf,%r11
+  80005f:	00 00 00 
+  800062:	4c 01 db             	add    %r11,%rbx
+  800065:	48 89 bd 48 ff ff ff 	mov    %rdi,-0xb8(%rbp)
+  80006c:	48 89 b5 40 ff ff ff 	mov    %rsi,-0xc0(%rbp)
+	int r;
+	struct Stat st;
+
+	if ((r = stat(path, &st)) < 0)
+  800073:	48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+  80007a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800081:	48 89 d6             	mov    %rdx,%rsi
+  800084:	48 89 c7             	mov    %rax,%rdi
+  800087:	49 89 df             	mov    %rbx,%r15
+  80008a:	48 b8 6a ab ff ff ff 	movabs $0xffffffffffffab6a,%rax
+  800091:	ff ff ff 
+  800094:	48 01 d8             	add    %rbx,%rax
+  800097:	ff d0                	call   *%rax
+  800099:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80009c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000a0:	79 4f                	jns    8000f1 <ls+0xae>
+		panic("stat %s: %e", path, r);
+  8000a2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8000a5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8000ac:	41 89 d0             	mov    %edx,%r8d
+  8000af:	48 89 c1             	mov    %rax,%rcx
+  8000b2:	48 b8 28 db ff ff ff 	movabs $0xffffffffffffdb28,%rax
+  8000b9:	ff ff ff 
+  8000bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c0:	48 89 c2             	mov    %rax,%rdx
+  8000c3:	be 0f 00 00 00       	mov    $0xf,%esi
+  8000c8:	48 b8 34 db ff ff ff 	movabs $0xffffffffffffdb34,%rax
+  8000cf:	ff ff ff 
+  8000d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000d6:	48 89 c7             	mov    %rax,%rdi
+  8000d9:	49 89 df             	mov    %rbx,%r15
+  8000dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e1:	49 b9 b5 77 ff ff ff 	movabs $0xffffffffffff77b5,%r9
+  8000e8:	ff ff ff 
+  8000eb:	49 01 d9             	add    %rbx,%r9
+  8000ee:	41 ff d1             	call   *%r9
+	if (st.st_isdir && !flag['d'])
+  8000f1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8000f4:	85 c0                	test   %eax,%eax
+  8000f6:	74 3b                	je     800133 <ls+0xf0>
+  8000f8:	48 b8 f0 1f 01 00 00 	movabs $0x11ff0,%rax
+  8000ff:	00 00 00 
+  800102:	8b 84 03 90 01 00 00 	mov    0x190(%rbx,%rax,1),%eax
+  800109:	85 c0                	test   %eax,%eax
+  80010b:	75 26                	jne    800133 <ls+0xf0>
+		lsdir(path, prefix);
+  80010d:	48 8b 95 40 ff ff ff 	mov    -0xc0(%rbp),%rdx
+  800114:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80011b:	48 89 d6             	mov    %rdx,%rsi
+  80011e:	48 89 c7             	mov    %rax,%rdi
+  800121:	48 b8 3d 71 ff ff ff 	movabs $0xffffffffffff713d,%rax
+  800128:	ff ff ff 
+  80012b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80012f:	ff d0                	call   *%rax
+  800131:	eb 2d                	jmp    800160 <ls+0x11d>
+	else
+		ls1(0, st.st_isdir, st.st_size, path);
+  800133:	8b 55 d0             	mov    -0x30(%rbp),%edx
+  800136:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800139:	85 c0                	test   %eax,%eax
+  80013b:	0f 95 c0             	setne  %al
+  80013e:	0f b6 c0             	movzbl %al,%eax
+  800141:	48 8b 8d 48 ff ff ff 	mov    -0xb8(%rbp),%rcx
+  800148:	89 c6                	mov    %eax,%esi
+  80014a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014f:	48 b8 0e 73 ff ff ff 	movabs $0xffffffffffff730e,%rax
+  800156:	ff ff ff 
+  800159:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80015d:	ff d0                	call   *%rax
+}
+  80015f:	90                   	nop
+  800160:	90                   	nop
+  800161:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  800168:	5b                   	pop    %rbx
+  800169:	41 5f                	pop    %r15
+  80016b:	5d                   	pop    %rbp
+  80016c:	c3                   	ret
+
+000000000080016d <lsdir>:
+
+void
+lsdir(const char *path, const char *prefix)
+{
+  80016d:	55                   	push   %rbp
+  80016e:	48 89 e5             	mov    %rsp,%rbp
+  800171:	41 57                	push   %r15
+  800173:	53                   	push   %rbx
+  800174:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80017b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80017b <lsdir+0xe>
+  800182:	49 bb b5 8e 00 00 00 	movabs $0x8eb5,%r11
+  800189:	00 00 00 
+  80018c:	4c 01 db             	add    %r11,%rbx
+  80018f:	48 89 bd d8 fe ff ff 	mov    %rdi,-0x128(%rbp)
+  800196:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+	int fd, n;
+	struct File f;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80019d:	48 8b 85 d8 fe ff ff 	mov    -0x128(%rbp),%rax
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a9:	48 89 c7             	mov    %rax,%rdi
+  8001ac:	49 89 df             	mov    %rbx,%r15
+  8001af:	48 b8 44 ae ff ff ff 	movabs $0xffffffffffffae44,%rax
+  8001b6:	ff ff ff 
+  8001b9:	48 01 d8             	add    %rbx,%rax
+  8001bc:	ff d0                	call   *%rax
+  8001be:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8001c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8001c5:	0f 89 90 00 00 00    	jns    80025b <lsdir+0xee>
+		panic("open %s: %e", path, fd);
+  8001cb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8001ce:	48 8b 85 d8 fe ff ff 	mov    -0x128(%rbp),%rax
+  8001d5:	41 89 d0             	mov    %edx,%r8d
+  8001d8:	48 89 c1             	mov    %rax,%rcx
+  8001db:	48 b8 3e db ff ff ff 	movabs $0xffffffffffffdb3e,%rax
+  8001e2:	ff ff ff 
+  8001e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001e9:	48 89 c2             	mov    %rax,%rdx
+  8001ec:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8001f1:	48 b8 34 db ff ff ff 	movabs $0xffffffffffffdb34,%rax
+  8001f8:	ff ff ff 
+  8001fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001ff:	48 89 c7             	mov    %rax,%rdi
+  800202:	49 89 df             	mov    %rbx,%r15
+  800205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020a:	49 b9 b5 77 ff ff ff 	movabs $0xffffffffffff77b5,%r9
+  800211:	ff ff ff 
+  800214:	49 01 d9             	add    %rbx,%r9
+  800217:	41 ff d1             	call   *%r9
+	while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+		if (f.f_name[0])
+  80021a:	0f b6 85 e0 fe ff ff 	movzbl -0x120(%rbp),%eax
+  800221:	84 c0                	test   %al,%al
+  800223:	74 36                	je     80025b <lsdir+0xee>
+			ls1(prefix, f.f_type==FTYPE_DIR, f.f_size, f.f_name);
+  800225:	8b 95 60 ff ff ff    	mov    -0xa0(%rbp),%edx
+  80022b:	8b 85 64 ff ff ff    	mov    -0x9c(%rbp),%eax
+  800231:	83 f8 01             	cmp    $0x1,%eax
+  800234:	0f 94 c0             	sete   %al
+  800237:	0f b6 f0             	movzbl %al,%esi
+  80023a:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+  800241:	48 8b 85 d0 fe ff ff 	mov    -0x130(%rbp),%rax
+  800248:	48 89 c7             	mov    %rax,%rdi
+  80024b:	48 b8 0e 73 ff ff ff 	movabs $0xffffffffffff730e,%rax
+  800252:	ff ff ff 
+  800255:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800259:	ff d0                	call   *%rax
+	while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  80025b:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+  800262:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800265:	ba 00 01 00 00       	mov    $0x100,%edx
+  80026a:	48 89 ce             	mov    %rcx,%rsi
+  80026d:	89 c7                	mov    %eax,%edi
+  80026f:	49 89 df             	mov    %rbx,%r15
+  800272:	48 b8 88 a7 ff ff ff 	movabs $0xffffffffffffa788,%rax
+  800279:	ff ff ff 
+  80027c:	48 01 d8             	add    %rbx,%rax
+  80027f:	ff d0                	call   *%rax
+  800281:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800284:	81 7d e8 00 01 00 00 	cmpl   $0x100,-0x18(%rbp)
+  80028b:	74 8d                	je     80021a <lsdir+0xad>
+	if (n > 0)
+  80028d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800291:	7e 49                	jle    8002dc <lsdir+0x16f>
+		panic("short read in directory %s", path);
+  800293:	48 8b 85 d8 fe ff ff 	mov    -0x128(%rbp),%rax
+  80029a:	48 89 c1             	mov    %rax,%rcx
+  80029d:	48 b8 4a db ff ff ff 	movabs $0xffffffffffffdb4a,%rax
+  8002a4:	ff ff ff 
+  8002a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002ab:	48 89 c2             	mov    %rax,%rdx
+  8002ae:	be 22 00 00 00       	mov    $0x22,%esi
+  8002b3:	48 b8 34 db ff ff ff 	movabs $0xffffffffffffdb34,%rax
+  8002ba:	ff ff ff 
+  8002bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002c1:	48 89 c7             	mov    %rax,%rdi
+  8002c4:	49 89 df             	mov    %rbx,%r15
+  8002c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cc:	49 b8 b5 77 ff ff ff 	movabs $0xffffffffffff77b5,%r8
+  8002d3:	ff ff ff 
+  8002d6:	49 01 d8             	add    %rbx,%r8
+  8002d9:	41 ff d0             	call   *%r8
+	if (n < 0)
+  8002dc:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8002e0:	79 4f                	jns    800331 <lsdir+0x1c4>
+		panic("error reading directory %s: %e", path, n);
+  8002e2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8002e5:	48 8b 85 d8 fe ff ff 	mov    -0x128(%rbp),%rax
+  8002ec:	41 89 d0             	mov    %edx,%r8d
+  8002ef:	48 89 c1             	mov    %rax,%rcx
+  8002f2:	48 b8 68 db ff ff ff 	movabs $0xffffffffffffdb68,%rax
+  8002f9:	ff ff ff 
+  8002fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800300:	48 89 c2             	mov    %rax,%rdx
+  800303:	be 24 00 00 00       	mov    $0x24,%esi
+  800308:	48 b8 34 db ff ff ff 	movabs $0xffffffffffffdb34,%rax
+  80030f:	ff ff ff 
+  800312:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800316:	48 89 c7             	mov    %rax,%rdi
+  800319:	49 89 df             	mov    %rbx,%r15
+  80031c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800321:	49 b9 b5 77 ff ff ff 	movabs $0xffffffffffff77b5,%r9
+  800328:	ff ff ff 
+  80032b:	49 01 d9             	add    %rbx,%r9
+  80032e:	41 ff d1             	call   *%r9
+}
+  800331:	90                   	nop
+  800332:	48 81 c4 20 01 00 00 	add    $0x120,%rsp
+  800339:	5b                   	pop    %rbx
+  80033a:	41 5f                	pop    %r15
+  80033c:	5d                   	pop    %rbp
+  80033d:	c3                   	ret
+
+000000000080033e <ls1>:
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name)
+{
+  80033e:	55                   	push   %rbp
+  80033f:	48 89 e5             	mov    %rsp,%rbp
+  800342:	41 57                	push   %r15
+  800344:	53                   	push   %rbx
+  800345:	48 83 ec 30          	sub    $0x30,%rsp
+  800349:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800349 <ls1+0xb>
+  800350:	49 bb e7 8c 00 00 00 	movabs $0x8ce7,%r11
+  800357:	00 00 00 
+  80035a:	4c 01 db             	add    %r11,%rbx
+  80035d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800361:	89 f0                	mov    %esi,%eax
+  800363:	89 55 d0             	mov    %edx,-0x30(%rbp)
+  800366:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80036a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+	const char *sep;
+
+	if(flag['l'])
+  80036d:	48 b8 f0 1f 01 00 00 	movabs $0x11ff0,%rax
+  800374:	00 00 00 
+  800377:	8b 84 03 b0 01 00 00 	mov    0x1b0(%rbx,%rax,1),%eax
+  80037e:	85 c0                	test   %eax,%eax
+  800380:	74 3f                	je     8003c1 <ls1+0x83>
+		printf("%11d %c ", size, isdir ? 'd' : '-');
+  800382:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  800386:	74 07                	je     80038f <ls1+0x51>
+  800388:	ba 64 00 00 00       	mov    $0x64,%edx
+  80038d:	eb 05                	jmp    800394 <ls1+0x56>
+  80038f:	ba 2d 00 00 00       	mov    $0x2d,%edx
+  800394:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800397:	89 c6                	mov    %eax,%esi
+  800399:	48 b8 87 db ff ff ff 	movabs $0xffffffffffffdb87,%rax
+  8003a0:	ff ff ff 
+  8003a3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003a7:	48 89 c7             	mov    %rax,%rdi
+  8003aa:	49 89 df             	mov    %rbx,%r15
+  8003ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b2:	48 b9 87 b9 ff ff ff 	movabs $0xffffffffffffb987,%rcx
+  8003b9:	ff ff ff 
+  8003bc:	48 01 d9             	add    %rbx,%rcx
+  8003bf:	ff d1                	call   *%rcx
+	if(prefix) {
+  8003c1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8003c6:	0f 84 91 00 00 00    	je     80045d <ls1+0x11f>
+		if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  8003cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003d0:	0f b6 00             	movzbl (%rax),%eax
+  8003d3:	84 c0                	test   %al,%al
+  8003d5:	74 41                	je     800418 <ls1+0xda>
+  8003d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003db:	48 89 c7             	mov    %rax,%rdi
+  8003de:	49 89 df             	mov    %rbx,%r15
+  8003e1:	48 b8 ba 87 ff ff ff 	movabs $0xffffffffffff87ba,%rax
+  8003e8:	ff ff ff 
+  8003eb:	48 01 d8             	add    %rbx,%rax
+  8003ee:	ff d0                	call   *%rax
+  8003f0:	48 98                	cltq
+  8003f2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8003f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003fa:	48 01 d0             	add    %rdx,%rax
+  8003fd:	0f b6 00             	movzbl (%rax),%eax
+  800400:	3c 2f                	cmp    $0x2f,%al
+  800402:	74 14                	je     800418 <ls1+0xda>
+			sep = "/";
+  800404:	48 b8 90 db ff ff ff 	movabs $0xffffffffffffdb90,%rax
+  80040b:	ff ff ff 
+  80040e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800412:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800416:	eb 12                	jmp    80042a <ls1+0xec>
+		else
+			sep = "";
+  800418:	48 b8 92 db ff ff ff 	movabs $0xffffffffffffdb92,%rax
+  80041f:	ff ff ff 
+  800422:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800426:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		printf("%s%s", prefix, sep);
+  80042a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80042e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800432:	48 89 c6             	mov    %rax,%rsi
+  800435:	48 b8 93 db ff ff ff 	movabs $0xffffffffffffdb93,%rax
+  80043c:	ff ff ff 
+  80043f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800443:	48 89 c7             	mov    %rax,%rdi
+  800446:	49 89 df             	mov    %rbx,%r15
+  800449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044e:	48 b9 87 b9 ff ff ff 	movabs $0xffffffffffffb987,%rcx
+  800455:	ff ff ff 
+  800458:	48 01 d9             	add    %rbx,%rcx
+  80045b:	ff d1                	call   *%rcx
+	}
+	printf("%s", name);
+  80045d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800461:	48 89 c6             	mov    %rax,%rsi
+  800464:	48 b8 98 db ff ff ff 	movabs $0xffffffffffffdb98,%rax
+  80046b:	ff ff ff 
+  80046e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800472:	48 89 c7             	mov    %rax,%rdi
+  800475:	49 89 df             	mov    %rbx,%r15
+  800478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047d:	48 ba 87 b9 ff ff ff 	movabs $0xffffffffffffb987,%rdx
+  800484:	ff ff ff 
+  800487:	48 01 da             	add    %rbx,%rdx
+  80048a:	ff d2                	call   *%rdx
+	if(flag['F'] && isdir)
+  80048c:	48 b8 f0 1f 01 00 00 	movabs $0x11ff0,%rax
+  800493:	00 00 00 
+  800496:	8b 84 03 18 01 00 00 	mov    0x118(%rbx,%rax,1),%eax
+  80049d:	85 c0                	test   %eax,%eax
+  80049f:	74 2e                	je     8004cf <ls1+0x191>
+  8004a1:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8004a5:	74 28                	je     8004cf <ls1+0x191>
+		printf("/");
+  8004a7:	48 b8 90 db ff ff ff 	movabs $0xffffffffffffdb90,%rax
+  8004ae:	ff ff ff 
+  8004b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004b5:	48 89 c7             	mov    %rax,%rdi
+  8004b8:	49 89 df             	mov    %rbx,%r15
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	48 ba 87 b9 ff ff ff 	movabs $0xffffffffffffb987,%rdx
+  8004c7:	ff ff ff 
+  8004ca:	48 01 da             	add    %rbx,%rdx
+  8004cd:	ff d2                	call   *%rdx
+	printf("\n");
+  8004cf:	48 b8 9b db ff ff ff 	movabs $0xffffffffffffdb9b,%rax
+  8004d6:	ff ff ff 
+  8004d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004dd:	48 89 c7             	mov    %rax,%rdi
+  8004e0:	49 89 df             	mov    %rbx,%r15
+  8004e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e8:	48 ba 87 b9 ff ff ff 	movabs $0xffffffffffffb987,%rdx
+  8004ef:	ff ff ff 
+  8004f2:	48 01 da             	add    %rbx,%rdx
+  8004f5:	ff d2                	call   *%rdx
+}
+  8004f7:	90                   	nop
+  8004f8:	48 83 c4 30          	add    $0x30,%rsp
+  8004fc:	5b                   	pop    %rbx
+  8004fd:	41 5f                	pop    %r15
+  8004ff:	5d                   	pop    %rbp
+  800500:	c3                   	ret
+
+0000000000800501 <usage>:
+
+void
+usage(void)
+{
+  800501:	55                   	push   %rbp
+  800502:	48 89 e5             	mov    %rsp,%rbp
+  800505:	41 57                	push   %r15
+  800507:	53                   	push   %rbx
+  800508:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800508 <usage+0x7>
+  80050f:	49 bb 28 8b 00 00 00 	movabs $0x8b28,%r11
+  800516:	00 00 00 
+  800519:	4c 01 db             	add    %r11,%rbx
+	printf("usage: ls [-dFl] [file...]\n");
+  80051c:	48 b8 9d db ff ff ff 	movabs $0xffffffffffffdb9d,%rax
+  800523:	ff ff ff 
+  800526:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80052a:	48 89 c7             	mov    %rax,%rdi
+  80052d:	49 89 df             	mov    %rbx,%r15
+  800530:	b8 00 00 00 00       	mov    $0x0,%eax
+  800535:	48 ba 87 b9 ff ff ff 	movabs $0xffffffffffffb987,%rdx
+  80053c:	ff ff ff 
+  80053f:	48 01 da             	add    %rbx,%rdx
+  800542:	ff d2                	call   *%rdx
+	exit();
+  800544:	49 89 df             	mov    %rbx,%r15
+  800547:	48 b8 6b 77 ff ff ff 	movabs $0xffffffffffff776b,%rax
+  80054e:	ff ff ff 
+  800551:	48 01 d8             	add    %rbx,%rax
+  800554:	ff d0                	call   *%rax
+}
+  800556:	90                   	nop
+  800557:	5b                   	pop    %rbx
+  800558:	41 5f                	pop    %r15
+  80055a:	5d                   	pop    %rbp
+  80055b:	c3                   	ret
+
+000000000080055c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80055c:	55                   	push   %rbp
+  80055d:	48 89 e5             	mov    %rsp,%rbp
+  800560:	41 57                	push   %r15
+  800562:	53                   	push   %rbx
+  800563:	48 83 ec 40          	sub    $0x40,%rsp
+  800567:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800567 <umain+0xb>
+  80056e:	49 bb c9 8a 00 00 00 	movabs $0x8ac9,%r11
+  800575:	00 00 00 
+  800578:	4c 01 db             	add    %r11,%rbx
+  80057b:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80057e:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+	int i;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  800582:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  800586:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  80058a:	48 8d 45 bc          	lea    -0x44(%rbp),%rax
+  80058e:	48 89 ce             	mov    %rcx,%rsi
+  800591:	48 89 c7             	mov    %rax,%rdi
+  800594:	49 89 df             	mov    %rbx,%r15
+  800597:	48 b8 b3 9c ff ff ff 	movabs $0xffffffffffff9cb3,%rax
+  80059e:	ff ff ff 
+  8005a1:	48 01 d8             	add    %rbx,%rax
+  8005a4:	ff d0                	call   *%rax
+	while ((i = argnext(&args)) >= 0)
+  8005a6:	eb 6e                	jmp    800616 <umain+0xba>
+		switch (i) {
+  8005a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8005ab:	83 e8 46             	sub    $0x46,%eax
+  8005ae:	83 f8 26             	cmp    $0x26,%eax
+  8005b1:	0f 97 c2             	seta   %dl
+  8005b4:	84 d2                	test   %dl,%dl
+  8005b6:	75 4e                	jne    800606 <umain+0xaa>
+  8005b8:	48 ba 01 00 00 40 40 	movabs $0x4040000001,%rdx
+  8005bf:	00 00 00 
+  8005c2:	89 c1                	mov    %eax,%ecx
+  8005c4:	48 d3 ea             	shr    %cl,%rdx
+  8005c7:	48 89 d0             	mov    %rdx,%rax
+  8005ca:	83 e0 01             	and    $0x1,%eax
+  8005cd:	48 85 c0             	test   %rax,%rax
+  8005d0:	0f 95 c0             	setne  %al
+  8005d3:	84 c0                	test   %al,%al
+  8005d5:	74 2f                	je     800606 <umain+0xaa>
+		case 'd':
+		case 'F':
+		case 'l':
+			flag[i]++;
+  8005d7:	48 ba f0 1f 01 00 00 	movabs $0x11ff0,%rdx
+  8005de:	00 00 00 
+  8005e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8005e4:	48 98                	cltq
+  8005e6:	48 01 da             	add    %rbx,%rdx
+  8005e9:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8005ec:	8d 48 01             	lea    0x1(%rax),%ecx
+  8005ef:	48 ba f0 1f 01 00 00 	movabs $0x11ff0,%rdx
+  8005f6:	00 00 00 
+  8005f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8005fc:	48 98                	cltq
+  8005fe:	48 01 da             	add    %rbx,%rdx
+  800601:	89 0c 82             	mov    %ecx,(%rdx,%rax,4)
+			break;
+  800604:	eb 10                	jmp    800616 <umain+0xba>
+		default:
+			usage();
+  800606:	48 b8 d1 74 ff ff ff 	movabs $0xffffffffffff74d1,%rax
+  80060d:	ff ff ff 
+  800610:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800614:	ff d0                	call   *%rax
+	while ((i = argnext(&args)) >= 0)
+  800616:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  80061a:	48 89 c7             	mov    %rax,%rdi
+  80061d:	49 89 df             	mov    %rbx,%r15
+  800620:	48 b8 30 9d ff ff ff 	movabs $0xffffffffffff9d30,%rax
+  800627:	ff ff ff 
+  80062a:	48 01 d8             	add    %rbx,%rax
+  80062d:	ff d0                	call   *%rax
+  80062f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800632:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800636:	0f 89 6c ff ff ff    	jns    8005a8 <umain+0x4c>
+		}
+
+	if (argc == 1)
+  80063c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80063f:	83 f8 01             	cmp    $0x1,%eax
+  800642:	75 34                	jne    800678 <umain+0x11c>
+		ls("/", "");
+  800644:	48 b8 92 db ff ff ff 	movabs $0xffffffffffffdb92,%rax
+  80064b:	ff ff ff 
+  80064e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800652:	48 89 c6             	mov    %rax,%rsi
+  800655:	48 b8 90 db ff ff ff 	movabs $0xffffffffffffdb90,%rax
+  80065c:	ff ff ff 
+  80065f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800663:	48 89 c7             	mov    %rax,%rdi
+  800666:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  80066d:	ff ff ff 
+  800670:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800674:	ff d0                	call   *%rax
+	else {
+		for (i = 1; i < argc; i++)
+			ls(argv[i], argv[i]);
+	}
+}
+  800676:	eb 59                	jmp    8006d1 <umain+0x175>
+		for (i = 1; i < argc; i++)
+  800678:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+  80067f:	eb 48                	jmp    8006c9 <umain+0x16d>
+			ls(argv[i], argv[i]);
+  800681:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800684:	48 98                	cltq
+  800686:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80068d:	00 
+  80068e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800692:	48 01 d0             	add    %rdx,%rax
+  800695:	48 8b 10             	mov    (%rax),%rdx
+  800698:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80069b:	48 98                	cltq
+  80069d:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  8006a4:	00 
+  8006a5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8006a9:	48 01 c8             	add    %rcx,%rax
+  8006ac:	48 8b 00             	mov    (%rax),%rax
+  8006af:	48 89 d6             	mov    %rdx,%rsi
+  8006b2:	48 89 c7             	mov    %rax,%rdi
+  8006b5:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  8006bc:	ff ff ff 
+  8006bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006c3:	ff d0                	call   *%rax
+		for (i = 1; i < argc; i++)
+  8006c5:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8006c9:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8006cc:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8006cf:	7c b0                	jl     800681 <umain+0x125>
+}
+  8006d1:	90                   	nop
+  8006d2:	48 83 c4 40          	add    $0x40,%rsp
+  8006d6:	5b                   	pop    %rbx
+  8006d7:	41 5f                	pop    %r15
+  8006d9:	5d                   	pop    %rbp
+  8006da:	c3                   	ret
+
+00000000008006db <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8006db:	55                   	push   %rbp
+  8006dc:	48 89 e5             	mov    %rsp,%rbp
+  8006df:	41 57                	push   %r15
+  8006e1:	53                   	push   %rbx
+  8006e2:	48 83 ec 20          	sub    $0x20,%rsp
+  8006e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006e6 <libmain+0xb>
+  8006ed:	49 bb 4a 89 00 00 00 	movabs $0x894a,%r11
+  8006f4:	00 00 00 
+  8006f7:	4c 01 db             	add    %r11,%rbx
+  8006fa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8006fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800701:	49 89 df             	mov    %rbx,%r15
+  800704:	48 b8 61 94 ff ff ff 	movabs $0xffffffffffff9461,%rax
+  80070b:	ff ff ff 
+  80070e:	48 01 d8             	add    %rbx,%rax
+  800711:	ff d0                	call   *%rax
+  800713:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800716:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800719:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80071e:	48 98                	cltq
+  800720:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800727:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  80072e:	ff ff ff 
+  800731:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800735:	48 01 c2             	add    %rax,%rdx
+  800738:	48 b8 f0 23 01 00 00 	movabs $0x123f0,%rax
+  80073f:	00 00 00 
+  800742:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800746:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80074a:	7e 15                	jle    800761 <libmain+0x86>
+		binaryname = argv[0];
+  80074c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800750:	48 8b 00             	mov    (%rax),%rax
+  800753:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  80075a:	00 00 00 
+  80075d:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800761:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800765:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800768:	48 89 d6             	mov    %rdx,%rsi
+  80076b:	89 c7                	mov    %eax,%edi
+  80076d:	49 89 df             	mov    %rbx,%r15
+  800770:	48 b8 2c 75 ff ff ff 	movabs $0xffffffffffff752c,%rax
+  800777:	ff ff ff 
+  80077a:	48 01 d8             	add    %rbx,%rax
+  80077d:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80077f:	49 89 df             	mov    %rbx,%r15
+  800782:	48 b8 6b 77 ff ff ff 	movabs $0xffffffffffff776b,%rax
+  800789:	ff ff ff 
+  80078c:	48 01 d8             	add    %rbx,%rax
+  80078f:	ff d0                	call   *%rax
+}
+  800791:	90                   	nop
+  800792:	48 83 c4 20          	add    $0x20,%rsp
+  800796:	5b                   	pop    %rbx
+  800797:	41 5f                	pop    %r15
+  800799:	5d                   	pop    %rbp
+  80079a:	c3                   	ret
+
+000000000080079b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80079b:	55                   	push   %rbp
+  80079c:	48 89 e5             	mov    %rsp,%rbp
+  80079f:	41 57                	push   %r15
+  8007a1:	53                   	push   %rbx
+  8007a2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8007a2 <exit+0x7>
+  8007a9:	49 bb 8e 88 00 00 00 	movabs $0x888e,%r11
+  8007b0:	00 00 00 
+  8007b3:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8007b6:	49 89 df             	mov    %rbx,%r15
+  8007b9:	48 b8 29 a4 ff ff ff 	movabs $0xffffffffffffa429,%rax
+  8007c0:	ff ff ff 
+  8007c3:	48 01 d8             	add    %rbx,%rax
+  8007c6:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8007c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007cd:	49 89 df             	mov    %rbx,%r15
+  8007d0:	48 b8 05 94 ff ff ff 	movabs $0xffffffffffff9405,%rax
+  8007d7:	ff ff ff 
+  8007da:	48 01 d8             	add    %rbx,%rax
+  8007dd:	ff d0                	call   *%rax
+}
+  8007df:	90                   	nop
+  8007e0:	5b                   	pop    %rbx
+  8007e1:	41 5f                	pop    %r15
+  8007e3:	5d                   	pop    %rbp
+  8007e4:	c3                   	ret
+
+00000000008007e5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8007e5:	55                   	push   %rbp
+  8007e6:	48 89 e5             	mov    %rsp,%rbp
+  8007e9:	41 57                	push   %r15
+  8007eb:	41 54                	push   %r12
+  8007ed:	53                   	push   %rbx
+  8007ee:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8007f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8007f5 <_panic+0x10>
+  8007fc:	49 bb 3b 88 00 00 00 	movabs $0x883b,%r11
+  800803:	00 00 00 
+  800806:	4c 01 db             	add    %r11,%rbx
+  800809:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800810:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800816:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80081d:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800824:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80082b:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800832:	84 c0                	test   %al,%al
+  800834:	74 26                	je     80085c <_panic+0x77>
+  800836:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80083d:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800844:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800848:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80084c:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800850:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800854:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800858:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80085c:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800863:	00 00 00 
+  800866:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80086d:	00 00 00 
+  800870:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800874:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80087b:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800882:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800889:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  800890:	ff ff ff 
+  800893:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800897:	4c 8b 20             	mov    (%rax),%r12
+  80089a:	49 89 df             	mov    %rbx,%r15
+  80089d:	48 b8 61 94 ff ff ff 	movabs $0xffffffffffff9461,%rax
+  8008a4:	ff ff ff 
+  8008a7:	48 01 d8             	add    %rbx,%rax
+  8008aa:	ff d0                	call   *%rax
+  8008ac:	89 c6                	mov    %eax,%esi
+  8008ae:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8008b4:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8008bb:	41 89 d0             	mov    %edx,%r8d
+  8008be:	48 89 c1             	mov    %rax,%rcx
+  8008c1:	4c 89 e2             	mov    %r12,%rdx
+  8008c4:	48 b8 c8 db ff ff ff 	movabs $0xffffffffffffdbc8,%rax
+  8008cb:	ff ff ff 
+  8008ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008d2:	48 89 c7             	mov    %rax,%rdi
+  8008d5:	49 89 df             	mov    %rbx,%r15
+  8008d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008dd:	49 b9 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%r9
+  8008e4:	ff ff ff 
+  8008e7:	49 01 d9             	add    %rbx,%r9
+  8008ea:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8008ed:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8008f4:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8008fb:	48 89 d6             	mov    %rdx,%rsi
+  8008fe:	48 89 c7             	mov    %rax,%rdi
+  800901:	49 89 df             	mov    %rbx,%r15
+  800904:	48 b8 ac 79 ff ff ff 	movabs $0xffffffffffff79ac,%rax
+  80090b:	ff ff ff 
+  80090e:	48 01 d8             	add    %rbx,%rax
+  800911:	ff d0                	call   *%rax
+	cprintf("\n");
+  800913:	48 b8 eb db ff ff ff 	movabs $0xffffffffffffdbeb,%rax
+  80091a:	ff ff ff 
+  80091d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800921:	48 89 c7             	mov    %rax,%rdi
+  800924:	49 89 df             	mov    %rbx,%r15
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	48 ba 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%rdx
+  800933:	ff ff ff 
+  800936:	48 01 da             	add    %rbx,%rdx
+  800939:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80093b:	cc                   	int3
+  80093c:	eb fd                	jmp    80093b <_panic+0x156>
+
+000000000080093e <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  80093e:	55                   	push   %rbp
+  80093f:	48 89 e5             	mov    %rsp,%rbp
+  800942:	41 57                	push   %r15
+  800944:	48 83 ec 18          	sub    $0x18,%rsp
+  800948:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800948 <putch+0xa>
+  80094f:	49 bb e8 86 00 00 00 	movabs $0x86e8,%r11
+  800956:	00 00 00 
+  800959:	4c 01 d8             	add    %r11,%rax
+  80095c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80095f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800963:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800967:	8b 12                	mov    (%rdx),%edx
+  800969:	8d 72 01             	lea    0x1(%rdx),%esi
+  80096c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800970:	89 31                	mov    %esi,(%rcx)
+  800972:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800975:	89 ce                	mov    %ecx,%esi
+  800977:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80097b:	48 63 d2             	movslq %edx,%rdx
+  80097e:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800983:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800987:	8b 12                	mov    (%rdx),%edx
+  800989:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80098f:	75 33                	jne    8009c4 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800991:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800995:	8b 12                	mov    (%rdx),%edx
+  800997:	48 63 d2             	movslq %edx,%rdx
+  80099a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80099e:	48 83 c1 08          	add    $0x8,%rcx
+  8009a2:	48 89 d6             	mov    %rdx,%rsi
+  8009a5:	48 89 cf             	mov    %rcx,%rdi
+  8009a8:	49 89 c7             	mov    %rax,%r15
+  8009ab:	48 ba 52 93 ff ff ff 	movabs $0xffffffffffff9352,%rdx
+  8009b2:	ff ff ff 
+  8009b5:	48 01 c2             	add    %rax,%rdx
+  8009b8:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8009ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009be:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8009c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009c8:	8b 40 04             	mov    0x4(%rax),%eax
+  8009cb:	8d 50 01             	lea    0x1(%rax),%edx
+  8009ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009d2:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8009d5:	90                   	nop
+  8009d6:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8009da:	c9                   	leave
+  8009db:	c3                   	ret
+
+00000000008009dc <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8009dc:	55                   	push   %rbp
+  8009dd:	48 89 e5             	mov    %rsp,%rbp
+  8009e0:	41 57                	push   %r15
+  8009e2:	53                   	push   %rbx
+  8009e3:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8009ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8009ea <vcprintf+0xe>
+  8009f1:	49 bb 46 86 00 00 00 	movabs $0x8646,%r11
+  8009f8:	00 00 00 
+  8009fb:	4c 01 db             	add    %r11,%rbx
+  8009fe:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800a05:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800a0c:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800a13:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800a1a:	48 8b 06             	mov    (%rsi),%rax
+  800a1d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a21:	48 89 01             	mov    %rax,(%rcx)
+  800a24:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a28:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a2c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800a30:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800a37:	00 00 00 
+    b.cnt = 0;
+  800a3a:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800a41:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800a44:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800a4b:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800a52:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800a59:	48 89 c6             	mov    %rax,%rsi
+  800a5c:	48 b8 0e 79 ff ff ff 	movabs $0xffffffffffff790e,%rax
+  800a63:	ff ff ff 
+  800a66:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a6a:	48 89 c7             	mov    %rax,%rdi
+  800a6d:	49 89 df             	mov    %rbx,%r15
+  800a70:	48 b8 d0 7e ff ff ff 	movabs $0xffffffffffff7ed0,%rax
+  800a77:	ff ff ff 
+  800a7a:	48 01 d8             	add    %rbx,%rax
+  800a7d:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800a7f:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800a85:	48 98                	cltq
+  800a87:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800a8e:	48 83 c2 08          	add    $0x8,%rdx
+  800a92:	48 89 c6             	mov    %rax,%rsi
+  800a95:	48 89 d7             	mov    %rdx,%rdi
+  800a98:	49 89 df             	mov    %rbx,%r15
+  800a9b:	48 b8 52 93 ff ff ff 	movabs $0xffffffffffff9352,%rax
+  800aa2:	ff ff ff 
+  800aa5:	48 01 d8             	add    %rbx,%rax
+  800aa8:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800aaa:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800ab0:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800ab7:	5b                   	pop    %rbx
+  800ab8:	41 5f                	pop    %r15
+  800aba:	5d                   	pop    %rbp
+  800abb:	c3                   	ret
+
+0000000000800abc <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800abc:	55                   	push   %rbp
+  800abd:	48 89 e5             	mov    %rsp,%rbp
+  800ac0:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800ac7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800ac7 <cprintf+0xb>
+  800ace:	49 bb 69 85 00 00 00 	movabs $0x8569,%r11
+  800ad5:	00 00 00 
+  800ad8:	4d 01 da             	add    %r11,%r10
+  800adb:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800ae2:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800ae9:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800af0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800af7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800afe:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b05:	84 c0                	test   %al,%al
+  800b07:	74 20                	je     800b29 <cprintf+0x6d>
+  800b09:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800b0d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800b11:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800b15:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800b19:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800b1d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800b21:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800b25:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800b29:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800b30:	00 00 00 
+  800b33:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800b3a:	00 00 00 
+  800b3d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b41:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800b48:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800b4f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800b56:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800b5d:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800b64:	48 8b 06             	mov    (%rsi),%rax
+  800b67:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800b6b:	48 89 01             	mov    %rax,(%rcx)
+  800b6e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800b72:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800b76:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800b7a:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800b81:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800b88:	48 89 d6             	mov    %rdx,%rsi
+  800b8b:	48 89 c7             	mov    %rax,%rdi
+  800b8e:	48 b8 ac 79 ff ff ff 	movabs $0xffffffffffff79ac,%rax
+  800b95:	ff ff ff 
+  800b98:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800b9c:	ff d0                	call   *%rax
+  800b9e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800ba4:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800baa:	c9                   	leave
+  800bab:	c3                   	ret
+
+0000000000800bac <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800bac:	55                   	push   %rbp
+  800bad:	48 89 e5             	mov    %rsp,%rbp
+  800bb0:	53                   	push   %rbx
+  800bb1:	48 83 ec 38          	sub    $0x38,%rsp
+  800bb5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800bb5 <printnum+0x9>
+  800bbc:	49 bb 7b 84 00 00 00 	movabs $0x847b,%r11
+  800bc3:	00 00 00 
+  800bc6:	4c 01 db             	add    %r11,%rbx
+  800bc9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bcd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800bd1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800bd5:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800bd8:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800bdc:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800be0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800be3:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800be7:	72 58                	jb     800c41 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800be9:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800bec:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800bef:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800bf2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfb:	48 f7 f6             	div    %rsi
+  800bfe:	49 89 c2             	mov    %rax,%r10
+  800c01:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800c04:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800c07:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800c0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c0f:	41 89 c9             	mov    %ecx,%r9d
+  800c12:	41 89 f8             	mov    %edi,%r8d
+  800c15:	89 d1                	mov    %edx,%ecx
+  800c17:	4c 89 d2             	mov    %r10,%rdx
+  800c1a:	48 89 c7             	mov    %rax,%rdi
+  800c1d:	48 b8 7c 7b ff ff ff 	movabs $0xffffffffffff7b7c,%rax
+  800c24:	ff ff ff 
+  800c27:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c2b:	ff d0                	call   *%rax
+  800c2d:	eb 1c                	jmp    800c4b <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800c2f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800c33:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800c36:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800c3a:	48 89 d6             	mov    %rdx,%rsi
+  800c3d:	89 c7                	mov    %eax,%edi
+  800c3f:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800c41:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800c45:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800c49:	7f e4                	jg     800c2f <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800c4b:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800c4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c57:	48 f7 f1             	div    %rcx
+  800c5a:	48 b8 27 dd ff ff ff 	movabs $0xffffffffffffdd27,%rax
+  800c61:	ff ff ff 
+  800c64:	48 01 d8             	add    %rbx,%rax
+  800c67:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800c6b:	0f be c0             	movsbl %al,%eax
+  800c6e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800c72:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800c76:	48 89 d6             	mov    %rdx,%rsi
+  800c79:	89 c7                	mov    %eax,%edi
+  800c7b:	ff d1                	call   *%rcx
+}
+  800c7d:	90                   	nop
+  800c7e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c82:	c9                   	leave
+  800c83:	c3                   	ret
+
+0000000000800c84 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800c84:	55                   	push   %rbp
+  800c85:	48 89 e5             	mov    %rsp,%rbp
+  800c88:	48 83 ec 20          	sub    $0x20,%rsp
+  800c8c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c8c <getuint+0x8>
+  800c93:	49 bb a4 83 00 00 00 	movabs $0x83a4,%r11
+  800c9a:	00 00 00 
+  800c9d:	4c 01 d8             	add    %r11,%rax
+  800ca0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ca4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800ca7:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800cab:	7e 4f                	jle    800cfc <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800cad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb1:	8b 00                	mov    (%rax),%eax
+  800cb3:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb6:	77 24                	ja     800cdc <getuint+0x58>
+  800cb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cbc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800cc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cc4:	8b 00                	mov    (%rax),%eax
+  800cc6:	89 c0                	mov    %eax,%eax
+  800cc8:	48 01 d0             	add    %rdx,%rax
+  800ccb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ccf:	8b 12                	mov    (%rdx),%edx
+  800cd1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cd4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cd8:	89 0a                	mov    %ecx,(%rdx)
+  800cda:	eb 14                	jmp    800cf0 <getuint+0x6c>
+  800cdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ce4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ce8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cec:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cf0:	48 8b 00             	mov    (%rax),%rax
+  800cf3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800cf7:	e9 9d 00 00 00       	jmp    800d99 <getuint+0x115>
+	else if (lflag)
+  800cfc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800d00:	74 4c                	je     800d4e <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800d02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d06:	8b 00                	mov    (%rax),%eax
+  800d08:	83 f8 2f             	cmp    $0x2f,%eax
+  800d0b:	77 24                	ja     800d31 <getuint+0xad>
+  800d0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d11:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d19:	8b 00                	mov    (%rax),%eax
+  800d1b:	89 c0                	mov    %eax,%eax
+  800d1d:	48 01 d0             	add    %rdx,%rax
+  800d20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d24:	8b 12                	mov    (%rdx),%edx
+  800d26:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d29:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d2d:	89 0a                	mov    %ecx,(%rdx)
+  800d2f:	eb 14                	jmp    800d45 <getuint+0xc1>
+  800d31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d35:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d39:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d3d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d41:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d45:	48 8b 00             	mov    (%rax),%rax
+  800d48:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800d4c:	eb 4b                	jmp    800d99 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800d4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d52:	8b 00                	mov    (%rax),%eax
+  800d54:	83 f8 2f             	cmp    $0x2f,%eax
+  800d57:	77 24                	ja     800d7d <getuint+0xf9>
+  800d59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d5d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d65:	8b 00                	mov    (%rax),%eax
+  800d67:	89 c0                	mov    %eax,%eax
+  800d69:	48 01 d0             	add    %rdx,%rax
+  800d6c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d70:	8b 12                	mov    (%rdx),%edx
+  800d72:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d75:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d79:	89 0a                	mov    %ecx,(%rdx)
+  800d7b:	eb 14                	jmp    800d91 <getuint+0x10d>
+  800d7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d81:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d85:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d89:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d8d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d91:	8b 00                	mov    (%rax),%eax
+  800d93:	89 c0                	mov    %eax,%eax
+  800d95:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800d99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800d9d:	c9                   	leave
+  800d9e:	c3                   	ret
+
+0000000000800d9f <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800d9f:	55                   	push   %rbp
+  800da0:	48 89 e5             	mov    %rsp,%rbp
+  800da3:	48 83 ec 20          	sub    $0x20,%rsp
+  800da7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800da7 <printfloat+0x8>
+  800dae:	49 bb 89 82 00 00 00 	movabs $0x8289,%r11
+  800db5:	00 00 00 
+  800db8:	4c 01 d8             	add    %r11,%rax
+  800dbb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800dbf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800dc3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800dc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dcb:	48 85 c0             	test   %rax,%rax
+  800dce:	79 12                	jns    800de2 <printfloat+0x43>
+		putch('-',putdat);
+  800dd0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800dd4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800dd8:	48 89 c6             	mov    %rax,%rsi
+  800ddb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800de0:	ff d2                	call   *%rdx
+	
+}
+  800de2:	90                   	nop
+  800de3:	c9                   	leave
+  800de4:	c3                   	ret
+
+0000000000800de5 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800de5:	55                   	push   %rbp
+  800de6:	48 89 e5             	mov    %rsp,%rbp
+  800de9:	48 83 ec 20          	sub    $0x20,%rsp
+  800ded:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ded <getint+0x8>
+  800df4:	49 bb 43 82 00 00 00 	movabs $0x8243,%r11
+  800dfb:	00 00 00 
+  800dfe:	4c 01 d8             	add    %r11,%rax
+  800e01:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e05:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800e08:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800e0c:	7e 4f                	jle    800e5d <getint+0x78>
+		x=va_arg(*ap, long long);
+  800e0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e12:	8b 00                	mov    (%rax),%eax
+  800e14:	83 f8 2f             	cmp    $0x2f,%eax
+  800e17:	77 24                	ja     800e3d <getint+0x58>
+  800e19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e1d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800e21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e25:	8b 00                	mov    (%rax),%eax
+  800e27:	89 c0                	mov    %eax,%eax
+  800e29:	48 01 d0             	add    %rdx,%rax
+  800e2c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e30:	8b 12                	mov    (%rdx),%edx
+  800e32:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800e35:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e39:	89 0a                	mov    %ecx,(%rdx)
+  800e3b:	eb 14                	jmp    800e51 <getint+0x6c>
+  800e3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e41:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e45:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800e49:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e4d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800e51:	48 8b 00             	mov    (%rax),%rax
+  800e54:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800e58:	e9 9d 00 00 00       	jmp    800efa <getint+0x115>
+	else if (lflag)
+  800e5d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800e61:	74 4c                	je     800eaf <getint+0xca>
+		x=va_arg(*ap, long);
+  800e63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e67:	8b 00                	mov    (%rax),%eax
+  800e69:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6c:	77 24                	ja     800e92 <getint+0xad>
+  800e6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e72:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800e76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e7a:	8b 00                	mov    (%rax),%eax
+  800e7c:	89 c0                	mov    %eax,%eax
+  800e7e:	48 01 d0             	add    %rdx,%rax
+  800e81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e85:	8b 12                	mov    (%rdx),%edx
+  800e87:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800e8a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e8e:	89 0a                	mov    %ecx,(%rdx)
+  800e90:	eb 14                	jmp    800ea6 <getint+0xc1>
+  800e92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e96:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e9a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800e9e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ea2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ea6:	48 8b 00             	mov    (%rax),%rax
+  800ea9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800ead:	eb 4b                	jmp    800efa <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800eaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800eb3:	8b 00                	mov    (%rax),%eax
+  800eb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800eb8:	77 24                	ja     800ede <getint+0xf9>
+  800eba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ebe:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ec2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ec6:	8b 00                	mov    (%rax),%eax
+  800ec8:	89 c0                	mov    %eax,%eax
+  800eca:	48 01 d0             	add    %rdx,%rax
+  800ecd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ed1:	8b 12                	mov    (%rdx),%edx
+  800ed3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ed6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800eda:	89 0a                	mov    %ecx,(%rdx)
+  800edc:	eb 14                	jmp    800ef2 <getint+0x10d>
+  800ede:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ee2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ee6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800eea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800eee:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ef2:	8b 00                	mov    (%rax),%eax
+  800ef4:	48 98                	cltq
+  800ef6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800efa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800efe:	c9                   	leave
+  800eff:	c3                   	ret
+
+0000000000800f00 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800f00:	55                   	push   %rbp
+  800f01:	48 89 e5             	mov    %rsp,%rbp
+  800f04:	41 57                	push   %r15
+  800f06:	41 55                	push   %r13
+  800f08:	41 54                	push   %r12
+  800f0a:	53                   	push   %rbx
+  800f0b:	48 83 ec 60          	sub    $0x60,%rsp
+  800f0f:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800f0f <vprintfmt+0xf>
+  800f16:	49 bb 21 81 00 00 00 	movabs $0x8121,%r11
+  800f1d:	00 00 00 
+  800f20:	4d 01 dc             	add    %r11,%r12
+  800f23:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800f27:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800f2b:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f2f:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800f33:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800f3a:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800f3e:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800f42:	48 8b 06             	mov    (%rsi),%rax
+  800f45:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800f49:	48 89 01             	mov    %rax,(%rcx)
+  800f4c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800f50:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800f54:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f58:	eb 17                	jmp    800f71 <vprintfmt+0x71>
+			if (ch == '\0')
+  800f5a:	85 db                	test   %ebx,%ebx
+  800f5c:	0f 84 97 05 00 00    	je     8014f9 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800f62:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f66:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f6a:	48 89 c6             	mov    %rax,%rsi
+  800f6d:	89 df                	mov    %ebx,%edi
+  800f6f:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f71:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f75:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f79:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f7d:	0f b6 00             	movzbl (%rax),%eax
+  800f80:	0f b6 d8             	movzbl %al,%ebx
+  800f83:	83 fb 25             	cmp    $0x25,%ebx
+  800f86:	75 d2                	jne    800f5a <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800f88:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800f8c:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800f93:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800f9a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800fa1:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800fa8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800fac:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fb0:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800fb4:	0f b6 00             	movzbl (%rax),%eax
+  800fb7:	0f b6 d8             	movzbl %al,%ebx
+  800fba:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800fbd:	83 f8 55             	cmp    $0x55,%eax
+  800fc0:	0f 87 00 05 00 00    	ja     8014c6 <vprintfmt+0x5c6>
+  800fc6:	89 c0                	mov    %eax,%eax
+  800fc8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800fcf:	00 
+  800fd0:	48 8d 05 a9 5d 00 00 	lea    0x5da9(%rip),%rax        # 806d80 <.LC18+0xc>
+  800fd7:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800fdb:	48 8d 15 9e 5d 00 00 	lea    0x5d9e(%rip),%rdx        # 806d80 <.LC18+0xc>
+  800fe2:	48 01 d0             	add    %rdx,%rax
+  800fe5:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800fe7:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800feb:	eb bb                	jmp    800fa8 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800fed:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800ff1:	eb b5                	jmp    800fa8 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800ff3:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800ffa:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800ffd:	89 d0                	mov    %edx,%eax
+  800fff:	c1 e0 02             	shl    $0x2,%eax
+  801002:	01 d0                	add    %edx,%eax
+  801004:	01 c0                	add    %eax,%eax
+  801006:	01 d8                	add    %ebx,%eax
+  801008:	83 e8 30             	sub    $0x30,%eax
+  80100b:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  80100e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801012:	0f b6 00             	movzbl (%rax),%eax
+  801015:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  801018:	83 fb 2f             	cmp    $0x2f,%ebx
+  80101b:	7e 60                	jle    80107d <vprintfmt+0x17d>
+  80101d:	83 fb 39             	cmp    $0x39,%ebx
+  801020:	7f 5b                	jg     80107d <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  801022:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  801027:	eb d1                	jmp    800ffa <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  801029:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80102c:	83 f8 2f             	cmp    $0x2f,%eax
+  80102f:	77 17                	ja     801048 <vprintfmt+0x148>
+  801031:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801035:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801038:	89 d2                	mov    %edx,%edx
+  80103a:	48 01 d0             	add    %rdx,%rax
+  80103d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801040:	83 c2 08             	add    $0x8,%edx
+  801043:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801046:	eb 0c                	jmp    801054 <vprintfmt+0x154>
+  801048:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80104c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801050:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801054:	8b 00                	mov    (%rax),%eax
+  801056:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  801059:	eb 23                	jmp    80107e <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  80105b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80105f:	0f 89 43 ff ff ff    	jns    800fa8 <vprintfmt+0xa8>
+				width = 0;
+  801065:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  80106c:	e9 37 ff ff ff       	jmp    800fa8 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  801071:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  801078:	e9 2b ff ff ff       	jmp    800fa8 <vprintfmt+0xa8>
+			goto process_precision;
+  80107d:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  80107e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801082:	0f 89 20 ff ff ff    	jns    800fa8 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  801088:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80108b:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80108e:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  801095:	e9 0e ff ff ff       	jmp    800fa8 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  80109a:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  80109e:	e9 05 ff ff ff       	jmp    800fa8 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  8010a3:	83 fb 39             	cmp    $0x39,%ebx
+  8010a6:	7f 0b                	jg     8010b3 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  8010a8:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  8010ab:	c1 e0 08             	shl    $0x8,%eax
+  8010ae:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8010b1:	eb 21                	jmp    8010d4 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  8010b3:	83 fb 60             	cmp    $0x60,%ebx
+  8010b6:	7e 10                	jle    8010c8 <vprintfmt+0x1c8>
+  8010b8:	83 fb 66             	cmp    $0x66,%ebx
+  8010bb:	7f 0b                	jg     8010c8 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  8010bd:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  8010c0:	c1 e0 08             	shl    $0x8,%eax
+  8010c3:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8010c6:	eb 0c                	jmp    8010d4 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  8010c8:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  8010cf:	e9 04 01 00 00       	jmp    8011d8 <vprintfmt+0x2d8>
+  8010d4:	e9 ff 00 00 00       	jmp    8011d8 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8010d9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8010dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8010df:	77 17                	ja     8010f8 <vprintfmt+0x1f8>
+  8010e1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8010e5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010e8:	89 d2                	mov    %edx,%edx
+  8010ea:	48 01 d0             	add    %rdx,%rax
+  8010ed:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010f0:	83 c2 08             	add    $0x8,%edx
+  8010f3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8010f6:	eb 0c                	jmp    801104 <vprintfmt+0x204>
+  8010f8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8010fc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801100:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801104:	8b 00                	mov    (%rax),%eax
+  801106:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80110a:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  80110e:	48 89 d6             	mov    %rdx,%rsi
+  801111:	89 c7                	mov    %eax,%edi
+  801113:	ff d1                	call   *%rcx
+			break;
+  801115:	e9 da 03 00 00       	jmp    8014f4 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  80111a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80111d:	83 f8 2f             	cmp    $0x2f,%eax
+  801120:	77 17                	ja     801139 <vprintfmt+0x239>
+  801122:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801126:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801129:	89 d2                	mov    %edx,%edx
+  80112b:	48 01 d0             	add    %rdx,%rax
+  80112e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801131:	83 c2 08             	add    $0x8,%edx
+  801134:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801137:	eb 0c                	jmp    801145 <vprintfmt+0x245>
+  801139:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80113d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801141:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801145:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  801147:	85 db                	test   %ebx,%ebx
+  801149:	79 02                	jns    80114d <vprintfmt+0x24d>
+				err = -err;
+  80114b:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80114d:	83 fb 15             	cmp    $0x15,%ebx
+  801150:	7f 19                	jg     80116b <vprintfmt+0x26b>
+  801152:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  801159:	00 00 00 
+  80115c:	48 63 c3             	movslq %ebx,%rax
+  80115f:	4c 01 e2             	add    %r12,%rdx
+  801162:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  801166:	4d 85 ed             	test   %r13,%r13
+  801169:	75 36                	jne    8011a1 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  80116b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80116f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801173:	89 d9                	mov    %ebx,%ecx
+  801175:	48 ba 38 dd ff ff ff 	movabs $0xffffffffffffdd38,%rdx
+  80117c:	ff ff ff 
+  80117f:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  801183:	48 89 c7             	mov    %rax,%rdi
+  801186:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118b:	49 b8 d7 84 ff ff ff 	movabs $0xffffffffffff84d7,%r8
+  801192:	ff ff ff 
+  801195:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801199:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  80119c:	e9 53 03 00 00       	jmp    8014f4 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  8011a1:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8011a5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8011a9:	4c 89 e9             	mov    %r13,%rcx
+  8011ac:	48 ba 41 dd ff ff ff 	movabs $0xffffffffffffdd41,%rdx
+  8011b3:	ff ff ff 
+  8011b6:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8011ba:	48 89 c7             	mov    %rax,%rdi
+  8011bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c2:	49 b8 d7 84 ff ff ff 	movabs $0xffffffffffff84d7,%r8
+  8011c9:	ff ff ff 
+  8011cc:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8011d0:	41 ff d0             	call   *%r8
+			break;
+  8011d3:	e9 1c 03 00 00       	jmp    8014f4 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  8011d8:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8011db:	83 f8 2f             	cmp    $0x2f,%eax
+  8011de:	77 17                	ja     8011f7 <vprintfmt+0x2f7>
+  8011e0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011e4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8011e7:	89 d2                	mov    %edx,%edx
+  8011e9:	48 01 d0             	add    %rdx,%rax
+  8011ec:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8011ef:	83 c2 08             	add    $0x8,%edx
+  8011f2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8011f5:	eb 0c                	jmp    801203 <vprintfmt+0x303>
+  8011f7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011fb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8011ff:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801203:	4c 8b 28             	mov    (%rax),%r13
+  801206:	4d 85 ed             	test   %r13,%r13
+  801209:	75 0e                	jne    801219 <vprintfmt+0x319>
+				p = "(null)";
+  80120b:	48 b8 44 dd ff ff ff 	movabs $0xffffffffffffdd44,%rax
+  801212:	ff ff ff 
+  801215:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  801219:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80121d:	0f 8e 84 00 00 00    	jle    8012a7 <vprintfmt+0x3a7>
+  801223:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  801227:	74 7e                	je     8012a7 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801229:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80122c:	48 98                	cltq
+  80122e:	48 89 c6             	mov    %rax,%rsi
+  801231:	4c 89 ef             	mov    %r13,%rdi
+  801234:	4d 89 e7             	mov    %r12,%r15
+  801237:	48 b8 fc 87 ff ff ff 	movabs $0xffffffffffff87fc,%rax
+  80123e:	ff ff ff 
+  801241:	4c 01 e0             	add    %r12,%rax
+  801244:	ff d0                	call   *%rax
+  801246:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  801249:	eb 17                	jmp    801262 <vprintfmt+0x362>
+					putch(padc, putdat);
+  80124b:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  80124f:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  801253:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801257:	48 89 d6             	mov    %rdx,%rsi
+  80125a:	89 c7                	mov    %eax,%edi
+  80125c:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80125e:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801262:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801266:	7f e3                	jg     80124b <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801268:	eb 3d                	jmp    8012a7 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80126a:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  80126e:	74 1e                	je     80128e <vprintfmt+0x38e>
+  801270:	83 fb 1f             	cmp    $0x1f,%ebx
+  801273:	7e 05                	jle    80127a <vprintfmt+0x37a>
+  801275:	83 fb 7e             	cmp    $0x7e,%ebx
+  801278:	7e 14                	jle    80128e <vprintfmt+0x38e>
+					putch('?', putdat);
+  80127a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80127e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801282:	48 89 c6             	mov    %rax,%rsi
+  801285:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80128a:	ff d2                	call   *%rdx
+  80128c:	eb 15                	jmp    8012a3 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  80128e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801291:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  801294:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801298:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80129c:	48 89 c6             	mov    %rax,%rsi
+  80129f:	89 cf                	mov    %ecx,%edi
+  8012a1:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8012a3:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8012a7:	4c 89 e8             	mov    %r13,%rax
+  8012aa:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  8012ae:	0f b6 00             	movzbl (%rax),%eax
+  8012b1:	0f be d8             	movsbl %al,%ebx
+  8012b4:	85 db                	test   %ebx,%ebx
+  8012b6:	74 28                	je     8012e0 <vprintfmt+0x3e0>
+  8012b8:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8012bc:	78 ac                	js     80126a <vprintfmt+0x36a>
+  8012be:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  8012c2:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8012c6:	79 a2                	jns    80126a <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  8012c8:	eb 16                	jmp    8012e0 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  8012ca:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8012ce:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8012d2:	48 89 c6             	mov    %rax,%rsi
+  8012d5:	bf 20 00 00 00       	mov    $0x20,%edi
+  8012da:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8012dc:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8012e0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8012e4:	7f e4                	jg     8012ca <vprintfmt+0x3ca>
+			break;
+  8012e6:	e9 09 02 00 00       	jmp    8014f4 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  8012eb:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8012ef:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8012f3:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8012f7:	0f b6 00             	movzbl (%rax),%eax
+  8012fa:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  8012fd:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  8012fe:	83 fb 2f             	cmp    $0x2f,%ebx
+  801301:	0f 8e ac fd ff ff    	jle    8010b3 <vprintfmt+0x1b3>
+  801307:	e9 97 fd ff ff       	jmp    8010a3 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  80130c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801310:	be 03 00 00 00       	mov    $0x3,%esi
+  801315:	48 89 c7             	mov    %rax,%rdi
+  801318:	48 b8 b5 7d ff ff ff 	movabs $0xffffffffffff7db5,%rax
+  80131f:	ff ff ff 
+  801322:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801326:	ff d0                	call   *%rax
+  801328:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  80132c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801330:	48 85 c0             	test   %rax,%rax
+  801333:	79 1d                	jns    801352 <vprintfmt+0x452>
+				putch('-', putdat);
+  801335:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801339:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80133d:	48 89 c6             	mov    %rax,%rsi
+  801340:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801345:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  801347:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80134b:	48 f7 d8             	neg    %rax
+  80134e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  801352:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801359:	e9 de 00 00 00       	jmp    80143c <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  80135e:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801362:	be 03 00 00 00       	mov    $0x3,%esi
+  801367:	48 89 c7             	mov    %rax,%rdi
+  80136a:	48 b8 54 7c ff ff ff 	movabs $0xffffffffffff7c54,%rax
+  801371:	ff ff ff 
+  801374:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801378:	ff d0                	call   *%rax
+  80137a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  80137e:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801385:	e9 b2 00 00 00       	jmp    80143c <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  80138a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80138e:	be 03 00 00 00       	mov    $0x3,%esi
+  801393:	48 89 c7             	mov    %rax,%rdi
+  801396:	48 b8 54 7c ff ff ff 	movabs $0xffffffffffff7c54,%rax
+  80139d:	ff ff ff 
+  8013a0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013a4:	ff d0                	call   *%rax
+  8013a6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  8013aa:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  8013b1:	e9 86 00 00 00       	jmp    80143c <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  8013b6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8013ba:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8013be:	48 89 c6             	mov    %rax,%rsi
+  8013c1:	bf 30 00 00 00       	mov    $0x30,%edi
+  8013c6:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  8013c8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8013cc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8013d0:	48 89 c6             	mov    %rax,%rsi
+  8013d3:	bf 78 00 00 00       	mov    $0x78,%edi
+  8013d8:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8013da:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8013dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8013e0:	77 17                	ja     8013f9 <vprintfmt+0x4f9>
+  8013e2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8013e6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8013e9:	89 d2                	mov    %edx,%edx
+  8013eb:	48 01 d0             	add    %rdx,%rax
+  8013ee:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8013f1:	83 c2 08             	add    $0x8,%edx
+  8013f4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8013f7:	eb 0c                	jmp    801405 <vprintfmt+0x505>
+  8013f9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8013fd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801401:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801405:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801408:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80140c:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801413:	eb 27                	jmp    80143c <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801415:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801419:	be 03 00 00 00       	mov    $0x3,%esi
+  80141e:	48 89 c7             	mov    %rax,%rdi
+  801421:	48 b8 54 7c ff ff ff 	movabs $0xffffffffffff7c54,%rax
+  801428:	ff ff ff 
+  80142b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80142f:	ff d0                	call   *%rax
+  801431:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801435:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  80143c:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801441:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801444:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801447:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80144b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80144f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801453:	45 89 c1             	mov    %r8d,%r9d
+  801456:	41 89 f8             	mov    %edi,%r8d
+  801459:	48 89 c7             	mov    %rax,%rdi
+  80145c:	48 b8 7c 7b ff ff ff 	movabs $0xffffffffffff7b7c,%rax
+  801463:	ff ff ff 
+  801466:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80146a:	ff d0                	call   *%rax
+			break;
+  80146c:	e9 83 00 00 00       	jmp    8014f4 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801471:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801475:	be 03 00 00 00       	mov    $0x3,%esi
+  80147a:	48 89 c7             	mov    %rax,%rdi
+  80147d:	48 b8 54 7c ff ff ff 	movabs $0xffffffffffff7c54,%rax
+  801484:	ff ff ff 
+  801487:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80148b:	ff d0                	call   *%rax
+  80148d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801491:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801495:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801499:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80149d:	48 89 ce             	mov    %rcx,%rsi
+  8014a0:	48 89 c7             	mov    %rax,%rdi
+  8014a3:	48 b8 6f 7d ff ff ff 	movabs $0xffffffffffff7d6f,%rax
+  8014aa:	ff ff ff 
+  8014ad:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8014b1:	ff d0                	call   *%rax
+	
+			break;
+  8014b3:	eb 3f                	jmp    8014f4 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8014b5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8014b9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8014bd:	48 89 c6             	mov    %rax,%rsi
+  8014c0:	89 df                	mov    %ebx,%edi
+  8014c2:	ff d2                	call   *%rdx
+			break;
+  8014c4:	eb 2e                	jmp    8014f4 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8014c6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8014ca:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8014ce:	48 89 c6             	mov    %rax,%rsi
+  8014d1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8014d6:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8014d8:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8014dd:	eb 05                	jmp    8014e4 <vprintfmt+0x5e4>
+  8014df:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8014e4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8014e8:	48 83 e8 01          	sub    $0x1,%rax
+  8014ec:	0f b6 00             	movzbl (%rax),%eax
+  8014ef:	3c 25                	cmp    $0x25,%al
+  8014f1:	75 ec                	jne    8014df <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8014f3:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8014f4:	e9 78 fa ff ff       	jmp    800f71 <vprintfmt+0x71>
+				return;
+  8014f9:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8014fa:	48 83 c4 60          	add    $0x60,%rsp
+  8014fe:	5b                   	pop    %rbx
+  8014ff:	41 5c                	pop    %r12
+  801501:	41 5d                	pop    %r13
+  801503:	41 5f                	pop    %r15
+  801505:	5d                   	pop    %rbp
+  801506:	c3                   	ret
+
+0000000000801507 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801507:	55                   	push   %rbp
+  801508:	48 89 e5             	mov    %rsp,%rbp
+  80150b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801512:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801512 <printfmt+0xb>
+  801519:	49 bb 1e 7b 00 00 00 	movabs $0x7b1e,%r11
+  801520:	00 00 00 
+  801523:	4d 01 da             	add    %r11,%r10
+  801526:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80152d:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801534:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80153b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801542:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801549:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801550:	84 c0                	test   %al,%al
+  801552:	74 20                	je     801574 <printfmt+0x6d>
+  801554:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801558:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80155c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801560:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801564:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801568:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80156c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801570:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801574:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80157b:	00 00 00 
+  80157e:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801585:	00 00 00 
+  801588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80158c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801593:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80159a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8015a1:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8015a8:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8015af:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8015b6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8015bd:	48 89 c7             	mov    %rax,%rdi
+  8015c0:	48 b8 d0 7e ff ff ff 	movabs $0xffffffffffff7ed0,%rax
+  8015c7:	ff ff ff 
+  8015ca:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8015ce:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8015d0:	90                   	nop
+  8015d1:	c9                   	leave
+  8015d2:	c3                   	ret
+
+00000000008015d3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8015d3:	55                   	push   %rbp
+  8015d4:	48 89 e5             	mov    %rsp,%rbp
+  8015d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8015db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015db <sprintputch+0x8>
+  8015e2:	49 bb 55 7a 00 00 00 	movabs $0x7a55,%r11
+  8015e9:	00 00 00 
+  8015ec:	4c 01 d8             	add    %r11,%rax
+  8015ef:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8015f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8015f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015fa:	8b 40 10             	mov    0x10(%rax),%eax
+  8015fd:	8d 50 01             	lea    0x1(%rax),%edx
+  801600:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801604:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801607:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80160b:	48 8b 10             	mov    (%rax),%rdx
+  80160e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801612:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801616:	48 39 c2             	cmp    %rax,%rdx
+  801619:	73 17                	jae    801632 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80161b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80161f:	48 8b 00             	mov    (%rax),%rax
+  801622:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801626:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80162a:	48 89 0a             	mov    %rcx,(%rdx)
+  80162d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801630:	88 10                	mov    %dl,(%rax)
+}
+  801632:	90                   	nop
+  801633:	c9                   	leave
+  801634:	c3                   	ret
+
+0000000000801635 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801635:	55                   	push   %rbp
+  801636:	48 89 e5             	mov    %rsp,%rbp
+  801639:	53                   	push   %rbx
+  80163a:	48 83 ec 58          	sub    $0x58,%rsp
+  80163e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80163e <vsnprintf+0x9>
+  801645:	49 bb f2 79 00 00 00 	movabs $0x79f2,%r11
+  80164c:	00 00 00 
+  80164f:	4c 01 d8             	add    %r11,%rax
+  801652:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801656:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801659:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80165d:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801661:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801665:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801669:	48 8b 0e             	mov    (%rsi),%rcx
+  80166c:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801670:	48 89 0a             	mov    %rcx,(%rdx)
+  801673:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801677:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  80167b:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80167f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801683:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801687:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80168a:	48 63 d2             	movslq %edx,%rdx
+  80168d:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801691:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801695:	48 01 ca             	add    %rcx,%rdx
+  801698:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80169c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8016a3:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8016a8:	74 06                	je     8016b0 <vsnprintf+0x7b>
+  8016aa:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8016ae:	7f 07                	jg     8016b7 <vsnprintf+0x82>
+		return -E_INVAL;
+  8016b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016b5:	eb 34                	jmp    8016eb <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8016b7:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8016bb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8016bf:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8016c3:	48 bf a3 85 ff ff ff 	movabs $0xffffffffffff85a3,%rdi
+  8016ca:	ff ff ff 
+  8016cd:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8016d1:	49 b8 d0 7e ff ff ff 	movabs $0xffffffffffff7ed0,%r8
+  8016d8:	ff ff ff 
+  8016db:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8016df:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8016e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8016e5:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8016e8:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8016eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016ef:	c9                   	leave
+  8016f0:	c3                   	ret
+
+00000000008016f1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8016f1:	55                   	push   %rbp
+  8016f2:	48 89 e5             	mov    %rsp,%rbp
+  8016f5:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8016fc:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8016fc <snprintf+0xb>
+  801703:	49 bb 34 79 00 00 00 	movabs $0x7934,%r11
+  80170a:	00 00 00 
+  80170d:	4d 01 da             	add    %r11,%r10
+  801710:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801717:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80171d:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801724:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80172b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801732:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801739:	84 c0                	test   %al,%al
+  80173b:	74 20                	je     80175d <snprintf+0x6c>
+  80173d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801741:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801745:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801749:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80174d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801751:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801755:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801759:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80175d:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801764:	00 00 00 
+  801767:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80176e:	00 00 00 
+  801771:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801775:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80177c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801783:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80178a:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801791:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801798:	48 8b 06             	mov    (%rsi),%rax
+  80179b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80179f:	48 89 01             	mov    %rax,(%rcx)
+  8017a2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8017a6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8017aa:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8017ae:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8017b5:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8017bc:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8017c2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8017c9:	48 89 c7             	mov    %rax,%rdi
+  8017cc:	48 b8 05 86 ff ff ff 	movabs $0xffffffffffff8605,%rax
+  8017d3:	ff ff ff 
+  8017d6:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8017da:	ff d0                	call   *%rax
+  8017dc:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8017e2:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8017e8:	c9                   	leave
+  8017e9:	c3                   	ret
+
+00000000008017ea <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8017ea:	55                   	push   %rbp
+  8017eb:	48 89 e5             	mov    %rsp,%rbp
+  8017ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8017f2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017f2 <strlen+0x8>
+  8017f9:	49 bb 3e 78 00 00 00 	movabs $0x783e,%r11
+  801800:	00 00 00 
+  801803:	4c 01 d8             	add    %r11,%rax
+  801806:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80180a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801811:	eb 09                	jmp    80181c <strlen+0x32>
+		n++;
+  801813:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801817:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80181c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801820:	0f b6 00             	movzbl (%rax),%eax
+  801823:	84 c0                	test   %al,%al
+  801825:	75 ec                	jne    801813 <strlen+0x29>
+	return n;
+  801827:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80182a:	c9                   	leave
+  80182b:	c3                   	ret
+
+000000000080182c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+  801830:	48 83 ec 20          	sub    $0x20,%rsp
+  801834:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801834 <strnlen+0x8>
+  80183b:	49 bb fc 77 00 00 00 	movabs $0x77fc,%r11
+  801842:	00 00 00 
+  801845:	4c 01 d8             	add    %r11,%rax
+  801848:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80184c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801850:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801857:	eb 0e                	jmp    801867 <strnlen+0x3b>
+		n++;
+  801859:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80185d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801862:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801867:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80186c:	74 0b                	je     801879 <strnlen+0x4d>
+  80186e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801872:	0f b6 00             	movzbl (%rax),%eax
+  801875:	84 c0                	test   %al,%al
+  801877:	75 e0                	jne    801859 <strnlen+0x2d>
+	return n;
+  801879:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80187c:	c9                   	leave
+  80187d:	c3                   	ret
+
+000000000080187e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80187e:	55                   	push   %rbp
+  80187f:	48 89 e5             	mov    %rsp,%rbp
+  801882:	48 83 ec 20          	sub    $0x20,%rsp
+  801886:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801886 <strcpy+0x8>
+  80188d:	49 bb aa 77 00 00 00 	movabs $0x77aa,%r11
+  801894:	00 00 00 
+  801897:	4c 01 d8             	add    %r11,%rax
+  80189a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80189e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8018a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8018aa:	90                   	nop
+  8018ab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018af:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018b3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8018b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018bb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018bf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018c3:	0f b6 12             	movzbl (%rdx),%edx
+  8018c6:	88 10                	mov    %dl,(%rax)
+  8018c8:	0f b6 00             	movzbl (%rax),%eax
+  8018cb:	84 c0                	test   %al,%al
+  8018cd:	75 dc                	jne    8018ab <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8018cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018d3:	c9                   	leave
+  8018d4:	c3                   	ret
+
+00000000008018d5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8018d5:	55                   	push   %rbp
+  8018d6:	48 89 e5             	mov    %rsp,%rbp
+  8018d9:	53                   	push   %rbx
+  8018da:	48 83 ec 20          	sub    $0x20,%rsp
+  8018de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8018de <strcat+0x9>
+  8018e5:	49 bb 52 77 00 00 00 	movabs $0x7752,%r11
+  8018ec:	00 00 00 
+  8018ef:	4c 01 db             	add    %r11,%rbx
+  8018f2:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8018f6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8018fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018fe:	48 89 c7             	mov    %rax,%rdi
+  801901:	48 b8 ba 87 ff ff ff 	movabs $0xffffffffffff87ba,%rax
+  801908:	ff ff ff 
+  80190b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80190f:	ff d0                	call   *%rax
+  801911:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801914:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801917:	48 63 d0             	movslq %eax,%rdx
+  80191a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80191e:	48 01 c2             	add    %rax,%rdx
+  801921:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801925:	48 89 c6             	mov    %rax,%rsi
+  801928:	48 89 d7             	mov    %rdx,%rdi
+  80192b:	48 b8 4e 88 ff ff ff 	movabs $0xffffffffffff884e,%rax
+  801932:	ff ff ff 
+  801935:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801939:	ff d0                	call   *%rax
+	return dst;
+  80193b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  80193f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801943:	c9                   	leave
+  801944:	c3                   	ret
+
+0000000000801945 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801945:	55                   	push   %rbp
+  801946:	48 89 e5             	mov    %rsp,%rbp
+  801949:	48 83 ec 28          	sub    $0x28,%rsp
+  80194d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80194d <strncpy+0x8>
+  801954:	49 bb e3 76 00 00 00 	movabs $0x76e3,%r11
+  80195b:	00 00 00 
+  80195e:	4c 01 d8             	add    %r11,%rax
+  801961:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801965:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801969:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80196d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801971:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801975:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80197c:	00 
+  80197d:	eb 2a                	jmp    8019a9 <strncpy+0x64>
+		*dst++ = *src;
+  80197f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801983:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801987:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80198b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80198f:	0f b6 12             	movzbl (%rdx),%edx
+  801992:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801994:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801998:	0f b6 00             	movzbl (%rax),%eax
+  80199b:	84 c0                	test   %al,%al
+  80199d:	74 05                	je     8019a4 <strncpy+0x5f>
+			src++;
+  80199f:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8019a4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019ad:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8019b1:	72 cc                	jb     80197f <strncpy+0x3a>
+	}
+	return ret;
+  8019b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8019b7:	c9                   	leave
+  8019b8:	c3                   	ret
+
+00000000008019b9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8019b9:	55                   	push   %rbp
+  8019ba:	48 89 e5             	mov    %rsp,%rbp
+  8019bd:	48 83 ec 28          	sub    $0x28,%rsp
+  8019c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019c1 <strlcpy+0x8>
+  8019c8:	49 bb 6f 76 00 00 00 	movabs $0x766f,%r11
+  8019cf:	00 00 00 
+  8019d2:	4c 01 d8             	add    %r11,%rax
+  8019d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8019dd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8019e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019e5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8019e9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8019ee:	74 3d                	je     801a2d <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8019f0:	eb 1d                	jmp    801a0f <strlcpy+0x56>
+			*dst++ = *src++;
+  8019f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8019f6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8019fa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8019fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a02:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a06:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a0a:	0f b6 12             	movzbl (%rdx),%edx
+  801a0d:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801a0f:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801a14:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801a19:	74 0b                	je     801a26 <strlcpy+0x6d>
+  801a1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a1f:	0f b6 00             	movzbl (%rax),%eax
+  801a22:	84 c0                	test   %al,%al
+  801a24:	75 cc                	jne    8019f2 <strlcpy+0x39>
+		*dst = '\0';
+  801a26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a2a:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801a2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a31:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801a35:	c9                   	leave
+  801a36:	c3                   	ret
+
+0000000000801a37 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801a37:	55                   	push   %rbp
+  801a38:	48 89 e5             	mov    %rsp,%rbp
+  801a3b:	48 83 ec 10          	sub    $0x10,%rsp
+  801a3f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a3f <strcmp+0x8>
+  801a46:	49 bb f1 75 00 00 00 	movabs $0x75f1,%r11
+  801a4d:	00 00 00 
+  801a50:	4c 01 d8             	add    %r11,%rax
+  801a53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a57:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801a5b:	eb 0a                	jmp    801a67 <strcmp+0x30>
+		p++, q++;
+  801a5d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a62:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801a67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a6b:	0f b6 00             	movzbl (%rax),%eax
+  801a6e:	84 c0                	test   %al,%al
+  801a70:	74 12                	je     801a84 <strcmp+0x4d>
+  801a72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a76:	0f b6 10             	movzbl (%rax),%edx
+  801a79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7d:	0f b6 00             	movzbl (%rax),%eax
+  801a80:	38 c2                	cmp    %al,%dl
+  801a82:	74 d9                	je     801a5d <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801a84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a88:	0f b6 00             	movzbl (%rax),%eax
+  801a8b:	0f b6 d0             	movzbl %al,%edx
+  801a8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a92:	0f b6 00             	movzbl (%rax),%eax
+  801a95:	0f b6 c0             	movzbl %al,%eax
+  801a98:	29 c2                	sub    %eax,%edx
+  801a9a:	89 d0                	mov    %edx,%eax
+}
+  801a9c:	c9                   	leave
+  801a9d:	c3                   	ret
+
+0000000000801a9e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801a9e:	55                   	push   %rbp
+  801a9f:	48 89 e5             	mov    %rsp,%rbp
+  801aa2:	48 83 ec 18          	sub    $0x18,%rsp
+  801aa6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801aa6 <strncmp+0x8>
+  801aad:	49 bb 8a 75 00 00 00 	movabs $0x758a,%r11
+  801ab4:	00 00 00 
+  801ab7:	4c 01 d8             	add    %r11,%rax
+  801aba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801abe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ac2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801ac6:	eb 0f                	jmp    801ad7 <strncmp+0x39>
+		n--, p++, q++;
+  801ac8:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801acd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ad2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801ad7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801adc:	74 1d                	je     801afb <strncmp+0x5d>
+  801ade:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae2:	0f b6 00             	movzbl (%rax),%eax
+  801ae5:	84 c0                	test   %al,%al
+  801ae7:	74 12                	je     801afb <strncmp+0x5d>
+  801ae9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aed:	0f b6 10             	movzbl (%rax),%edx
+  801af0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af4:	0f b6 00             	movzbl (%rax),%eax
+  801af7:	38 c2                	cmp    %al,%dl
+  801af9:	74 cd                	je     801ac8 <strncmp+0x2a>
+	if (n == 0)
+  801afb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b00:	75 07                	jne    801b09 <strncmp+0x6b>
+		return 0;
+  801b02:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b07:	eb 16                	jmp    801b1f <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801b09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b0d:	0f b6 00             	movzbl (%rax),%eax
+  801b10:	0f b6 d0             	movzbl %al,%edx
+  801b13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b17:	0f b6 00             	movzbl (%rax),%eax
+  801b1a:	0f b6 c0             	movzbl %al,%eax
+  801b1d:	29 c2                	sub    %eax,%edx
+}
+  801b1f:	89 d0                	mov    %edx,%eax
+  801b21:	c9                   	leave
+  801b22:	c3                   	ret
+
+0000000000801b23 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801b23:	55                   	push   %rbp
+  801b24:	48 89 e5             	mov    %rsp,%rbp
+  801b27:	48 83 ec 10          	sub    $0x10,%rsp
+  801b2b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b2b <strchr+0x8>
+  801b32:	49 bb 05 75 00 00 00 	movabs $0x7505,%r11
+  801b39:	00 00 00 
+  801b3c:	4c 01 d8             	add    %r11,%rax
+  801b3f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b43:	89 f0                	mov    %esi,%eax
+  801b45:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801b48:	eb 17                	jmp    801b61 <strchr+0x3e>
+		if (*s == c)
+  801b4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b4e:	0f b6 00             	movzbl (%rax),%eax
+  801b51:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801b54:	75 06                	jne    801b5c <strchr+0x39>
+			return (char *) s;
+  801b56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b5a:	eb 15                	jmp    801b71 <strchr+0x4e>
+	for (; *s; s++)
+  801b5c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b65:	0f b6 00             	movzbl (%rax),%eax
+  801b68:	84 c0                	test   %al,%al
+  801b6a:	75 de                	jne    801b4a <strchr+0x27>
+	return 0;
+  801b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b71:	c9                   	leave
+  801b72:	c3                   	ret
+
+0000000000801b73 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801b73:	55                   	push   %rbp
+  801b74:	48 89 e5             	mov    %rsp,%rbp
+  801b77:	48 83 ec 10          	sub    $0x10,%rsp
+  801b7b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b7b <strfind+0x8>
+  801b82:	49 bb b5 74 00 00 00 	movabs $0x74b5,%r11
+  801b89:	00 00 00 
+  801b8c:	4c 01 d8             	add    %r11,%rax
+  801b8f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b93:	89 f0                	mov    %esi,%eax
+  801b95:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801b98:	eb 11                	jmp    801bab <strfind+0x38>
+		if (*s == c)
+  801b9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b9e:	0f b6 00             	movzbl (%rax),%eax
+  801ba1:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801ba4:	74 12                	je     801bb8 <strfind+0x45>
+	for (; *s; s++)
+  801ba6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801baf:	0f b6 00             	movzbl (%rax),%eax
+  801bb2:	84 c0                	test   %al,%al
+  801bb4:	75 e4                	jne    801b9a <strfind+0x27>
+  801bb6:	eb 01                	jmp    801bb9 <strfind+0x46>
+			break;
+  801bb8:	90                   	nop
+	return (char *) s;
+  801bb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801bbd:	c9                   	leave
+  801bbe:	c3                   	ret
+
+0000000000801bbf <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801bbf:	55                   	push   %rbp
+  801bc0:	48 89 e5             	mov    %rsp,%rbp
+  801bc3:	48 83 ec 18          	sub    $0x18,%rsp
+  801bc7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bc7 <memset+0x8>
+  801bce:	49 bb 69 74 00 00 00 	movabs $0x7469,%r11
+  801bd5:	00 00 00 
+  801bd8:	4c 01 d8             	add    %r11,%rax
+  801bdb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801bdf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801be2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801be6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801beb:	75 06                	jne    801bf3 <memset+0x34>
+		return v;
+  801bed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf1:	eb 69                	jmp    801c5c <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801bf3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf7:	83 e0 03             	and    $0x3,%eax
+  801bfa:	48 85 c0             	test   %rax,%rax
+  801bfd:	75 48                	jne    801c47 <memset+0x88>
+  801bff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c03:	83 e0 03             	and    $0x3,%eax
+  801c06:	48 85 c0             	test   %rax,%rax
+  801c09:	75 3c                	jne    801c47 <memset+0x88>
+		c &= 0xFF;
+  801c0b:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801c12:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c15:	c1 e0 18             	shl    $0x18,%eax
+  801c18:	89 c2                	mov    %eax,%edx
+  801c1a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c1d:	c1 e0 10             	shl    $0x10,%eax
+  801c20:	09 c2                	or     %eax,%edx
+  801c22:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c25:	c1 e0 08             	shl    $0x8,%eax
+  801c28:	09 d0                	or     %edx,%eax
+  801c2a:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801c2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c31:	48 c1 e8 02          	shr    $0x2,%rax
+  801c35:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801c38:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c3c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c3f:	48 89 d7             	mov    %rdx,%rdi
+  801c42:	fc                   	cld
+  801c43:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801c45:	eb 11                	jmp    801c58 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801c47:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c4b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801c4e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801c52:	48 89 d7             	mov    %rdx,%rdi
+  801c55:	fc                   	cld
+  801c56:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801c58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801c5c:	c9                   	leave
+  801c5d:	c3                   	ret
+
+0000000000801c5e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801c5e:	55                   	push   %rbp
+  801c5f:	48 89 e5             	mov    %rsp,%rbp
+  801c62:	48 83 ec 28          	sub    $0x28,%rsp
+  801c66:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c66 <memmove+0x8>
+  801c6d:	49 bb ca 73 00 00 00 	movabs $0x73ca,%r11
+  801c74:	00 00 00 
+  801c77:	4c 01 d8             	add    %r11,%rax
+  801c7a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c7e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c82:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801c86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c8a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801c8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c92:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801c96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c9a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801c9e:	0f 83 88 00 00 00    	jae    801d2c <memmove+0xce>
+  801ca4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ca8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cac:	48 01 d0             	add    %rdx,%rax
+  801caf:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801cb3:	73 77                	jae    801d2c <memmove+0xce>
+		s += n;
+  801cb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb9:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801cbd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc1:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801cc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cc9:	83 e0 03             	and    $0x3,%eax
+  801ccc:	48 85 c0             	test   %rax,%rax
+  801ccf:	75 3b                	jne    801d0c <memmove+0xae>
+  801cd1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cd5:	83 e0 03             	and    $0x3,%eax
+  801cd8:	48 85 c0             	test   %rax,%rax
+  801cdb:	75 2f                	jne    801d0c <memmove+0xae>
+  801cdd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce1:	83 e0 03             	and    $0x3,%eax
+  801ce4:	48 85 c0             	test   %rax,%rax
+  801ce7:	75 23                	jne    801d0c <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801ce9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ced:	48 83 e8 04          	sub    $0x4,%rax
+  801cf1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cf5:	48 83 ea 04          	sub    $0x4,%rdx
+  801cf9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801cfd:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801d01:	48 89 c7             	mov    %rax,%rdi
+  801d04:	48 89 d6             	mov    %rdx,%rsi
+  801d07:	fd                   	std
+  801d08:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801d0a:	eb 1d                	jmp    801d29 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801d0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d10:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d18:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801d1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d20:	48 89 d7             	mov    %rdx,%rdi
+  801d23:	48 89 c1             	mov    %rax,%rcx
+  801d26:	fd                   	std
+  801d27:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801d29:	fc                   	cld
+  801d2a:	eb 57                	jmp    801d83 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801d2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d30:	83 e0 03             	and    $0x3,%eax
+  801d33:	48 85 c0             	test   %rax,%rax
+  801d36:	75 36                	jne    801d6e <memmove+0x110>
+  801d38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d3c:	83 e0 03             	and    $0x3,%eax
+  801d3f:	48 85 c0             	test   %rax,%rax
+  801d42:	75 2a                	jne    801d6e <memmove+0x110>
+  801d44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d48:	83 e0 03             	and    $0x3,%eax
+  801d4b:	48 85 c0             	test   %rax,%rax
+  801d4e:	75 1e                	jne    801d6e <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801d50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d54:	48 c1 e8 02          	shr    $0x2,%rax
+  801d58:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801d5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d5f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d63:	48 89 c7             	mov    %rax,%rdi
+  801d66:	48 89 d6             	mov    %rdx,%rsi
+  801d69:	fc                   	cld
+  801d6a:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801d6c:	eb 15                	jmp    801d83 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801d6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d72:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d76:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801d7a:	48 89 c7             	mov    %rax,%rdi
+  801d7d:	48 89 d6             	mov    %rdx,%rsi
+  801d80:	fc                   	cld
+  801d81:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801d83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d87:	c9                   	leave
+  801d88:	c3                   	ret
+
+0000000000801d89 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801d89:	55                   	push   %rbp
+  801d8a:	48 89 e5             	mov    %rsp,%rbp
+  801d8d:	48 83 ec 18          	sub    $0x18,%rsp
+  801d91:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d91 <memcpy+0x8>
+  801d98:	49 bb 9f 72 00 00 00 	movabs $0x729f,%r11
+  801d9f:	00 00 00 
+  801da2:	4c 01 d8             	add    %r11,%rax
+  801da5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801da9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801dad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801db1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801db5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801db9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801dbd:	48 89 cf             	mov    %rcx,%rdi
+  801dc0:	48 b9 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rcx
+  801dc7:	ff ff ff 
+  801dca:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801dce:	ff d0                	call   *%rax
+}
+  801dd0:	c9                   	leave
+  801dd1:	c3                   	ret
+
+0000000000801dd2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801dd2:	55                   	push   %rbp
+  801dd3:	48 89 e5             	mov    %rsp,%rbp
+  801dd6:	48 83 ec 28          	sub    $0x28,%rsp
+  801dda:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dda <memcmp+0x8>
+  801de1:	49 bb 56 72 00 00 00 	movabs $0x7256,%r11
+  801de8:	00 00 00 
+  801deb:	4c 01 d8             	add    %r11,%rax
+  801dee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801df2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801df6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801dfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dfe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801e02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e06:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801e0a:	eb 34                	jmp    801e40 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801e0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e10:	0f b6 10             	movzbl (%rax),%edx
+  801e13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e17:	0f b6 00             	movzbl (%rax),%eax
+  801e1a:	38 c2                	cmp    %al,%dl
+  801e1c:	74 18                	je     801e36 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801e1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e22:	0f b6 00             	movzbl (%rax),%eax
+  801e25:	0f b6 d0             	movzbl %al,%edx
+  801e28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e2c:	0f b6 00             	movzbl (%rax),%eax
+  801e2f:	0f b6 c0             	movzbl %al,%eax
+  801e32:	29 c2                	sub    %eax,%edx
+  801e34:	eb 20                	jmp    801e56 <memcmp+0x84>
+		s1++, s2++;
+  801e36:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e3b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801e40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e44:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e48:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801e4c:	48 85 c0             	test   %rax,%rax
+  801e4f:	75 bb                	jne    801e0c <memcmp+0x3a>
+	}
+
+	return 0;
+  801e51:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801e56:	89 d0                	mov    %edx,%eax
+  801e58:	c9                   	leave
+  801e59:	c3                   	ret
+
+0000000000801e5a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801e5a:	55                   	push   %rbp
+  801e5b:	48 89 e5             	mov    %rsp,%rbp
+  801e5e:	48 83 ec 28          	sub    $0x28,%rsp
+  801e62:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e62 <memfind+0x8>
+  801e69:	49 bb ce 71 00 00 00 	movabs $0x71ce,%r11
+  801e70:	00 00 00 
+  801e73:	4c 01 d8             	add    %r11,%rax
+  801e76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801e7a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801e7d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801e81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e89:	48 01 d0             	add    %rdx,%rax
+  801e8c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801e90:	eb 13                	jmp    801ea5 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801e92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e96:	0f b6 00             	movzbl (%rax),%eax
+  801e99:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801e9c:	38 d0                	cmp    %dl,%al
+  801e9e:	74 11                	je     801eb1 <memfind+0x57>
+	for (; s < ends; s++)
+  801ea0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ea5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ea9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801ead:	72 e3                	jb     801e92 <memfind+0x38>
+  801eaf:	eb 01                	jmp    801eb2 <memfind+0x58>
+			break;
+  801eb1:	90                   	nop
+	return (void *) s;
+  801eb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801eb6:	c9                   	leave
+  801eb7:	c3                   	ret
+
+0000000000801eb8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801eb8:	55                   	push   %rbp
+  801eb9:	48 89 e5             	mov    %rsp,%rbp
+  801ebc:	48 83 ec 38          	sub    $0x38,%rsp
+  801ec0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ec0 <strtol+0x8>
+  801ec7:	49 bb 70 71 00 00 00 	movabs $0x7170,%r11
+  801ece:	00 00 00 
+  801ed1:	4c 01 d8             	add    %r11,%rax
+  801ed4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ed8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801edc:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801edf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801ee6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801eed:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801eee:	eb 05                	jmp    801ef5 <strtol+0x3d>
+		s++;
+  801ef0:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801ef5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ef9:	0f b6 00             	movzbl (%rax),%eax
+  801efc:	3c 20                	cmp    $0x20,%al
+  801efe:	74 f0                	je     801ef0 <strtol+0x38>
+  801f00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f04:	0f b6 00             	movzbl (%rax),%eax
+  801f07:	3c 09                	cmp    $0x9,%al
+  801f09:	74 e5                	je     801ef0 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801f0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f0f:	0f b6 00             	movzbl (%rax),%eax
+  801f12:	3c 2b                	cmp    $0x2b,%al
+  801f14:	75 07                	jne    801f1d <strtol+0x65>
+		s++;
+  801f16:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f1b:	eb 17                	jmp    801f34 <strtol+0x7c>
+	else if (*s == '-')
+  801f1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f21:	0f b6 00             	movzbl (%rax),%eax
+  801f24:	3c 2d                	cmp    $0x2d,%al
+  801f26:	75 0c                	jne    801f34 <strtol+0x7c>
+		s++, neg = 1;
+  801f28:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f2d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801f34:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f38:	74 06                	je     801f40 <strtol+0x88>
+  801f3a:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801f3e:	75 28                	jne    801f68 <strtol+0xb0>
+  801f40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f44:	0f b6 00             	movzbl (%rax),%eax
+  801f47:	3c 30                	cmp    $0x30,%al
+  801f49:	75 1d                	jne    801f68 <strtol+0xb0>
+  801f4b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f4f:	48 83 c0 01          	add    $0x1,%rax
+  801f53:	0f b6 00             	movzbl (%rax),%eax
+  801f56:	3c 78                	cmp    $0x78,%al
+  801f58:	75 0e                	jne    801f68 <strtol+0xb0>
+		s += 2, base = 16;
+  801f5a:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801f5f:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801f66:	eb 2c                	jmp    801f94 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801f68:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f6c:	75 19                	jne    801f87 <strtol+0xcf>
+  801f6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f72:	0f b6 00             	movzbl (%rax),%eax
+  801f75:	3c 30                	cmp    $0x30,%al
+  801f77:	75 0e                	jne    801f87 <strtol+0xcf>
+		s++, base = 8;
+  801f79:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f7e:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801f85:	eb 0d                	jmp    801f94 <strtol+0xdc>
+	else if (base == 0)
+  801f87:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f8b:	75 07                	jne    801f94 <strtol+0xdc>
+		base = 10;
+  801f8d:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801f94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f98:	0f b6 00             	movzbl (%rax),%eax
+  801f9b:	3c 2f                	cmp    $0x2f,%al
+  801f9d:	7e 1d                	jle    801fbc <strtol+0x104>
+  801f9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fa3:	0f b6 00             	movzbl (%rax),%eax
+  801fa6:	3c 39                	cmp    $0x39,%al
+  801fa8:	7f 12                	jg     801fbc <strtol+0x104>
+			dig = *s - '0';
+  801faa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fae:	0f b6 00             	movzbl (%rax),%eax
+  801fb1:	0f be c0             	movsbl %al,%eax
+  801fb4:	83 e8 30             	sub    $0x30,%eax
+  801fb7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801fba:	eb 4e                	jmp    80200a <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801fbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fc0:	0f b6 00             	movzbl (%rax),%eax
+  801fc3:	3c 60                	cmp    $0x60,%al
+  801fc5:	7e 1d                	jle    801fe4 <strtol+0x12c>
+  801fc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fcb:	0f b6 00             	movzbl (%rax),%eax
+  801fce:	3c 7a                	cmp    $0x7a,%al
+  801fd0:	7f 12                	jg     801fe4 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801fd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fd6:	0f b6 00             	movzbl (%rax),%eax
+  801fd9:	0f be c0             	movsbl %al,%eax
+  801fdc:	83 e8 57             	sub    $0x57,%eax
+  801fdf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801fe2:	eb 26                	jmp    80200a <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801fe4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fe8:	0f b6 00             	movzbl (%rax),%eax
+  801feb:	3c 40                	cmp    $0x40,%al
+  801fed:	7e 47                	jle    802036 <strtol+0x17e>
+  801fef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ff3:	0f b6 00             	movzbl (%rax),%eax
+  801ff6:	3c 5a                	cmp    $0x5a,%al
+  801ff8:	7f 3c                	jg     802036 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801ffa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ffe:	0f b6 00             	movzbl (%rax),%eax
+  802001:	0f be c0             	movsbl %al,%eax
+  802004:	83 e8 37             	sub    $0x37,%eax
+  802007:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  80200a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80200d:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802010:	7d 23                	jge    802035 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  802012:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802017:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80201a:	48 98                	cltq
+  80201c:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802021:	48 89 c2             	mov    %rax,%rdx
+  802024:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802027:	48 98                	cltq
+  802029:	48 01 d0             	add    %rdx,%rax
+  80202c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  802030:	e9 5f ff ff ff       	jmp    801f94 <strtol+0xdc>
+			break;
+  802035:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  802036:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80203b:	74 0b                	je     802048 <strtol+0x190>
+		*endptr = (char *) s;
+  80203d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802041:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802045:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  802048:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80204c:	74 09                	je     802057 <strtol+0x19f>
+  80204e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802052:	48 f7 d8             	neg    %rax
+  802055:	eb 04                	jmp    80205b <strtol+0x1a3>
+  802057:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80205b:	c9                   	leave
+  80205c:	c3                   	ret
+
+000000000080205d <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  80205d:	55                   	push   %rbp
+  80205e:	48 89 e5             	mov    %rsp,%rbp
+  802061:	53                   	push   %rbx
+  802062:	48 83 ec 30          	sub    $0x30,%rsp
+  802066:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802066 <strstr+0x9>
+  80206d:	49 bb ca 6f 00 00 00 	movabs $0x6fca,%r11
+  802074:	00 00 00 
+  802077:	4c 01 db             	add    %r11,%rbx
+  80207a:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  80207e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  802082:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802086:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80208a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80208e:	0f b6 00             	movzbl (%rax),%eax
+  802091:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  802094:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  802098:	75 06                	jne    8020a0 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  80209a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80209e:	eb 73                	jmp    802113 <strstr+0xb6>
+
+	len = strlen(str);
+  8020a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020a4:	48 89 c7             	mov    %rax,%rdi
+  8020a7:	48 b8 ba 87 ff ff ff 	movabs $0xffffffffffff87ba,%rax
+  8020ae:	ff ff ff 
+  8020b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8020b5:	ff d0                	call   *%rax
+  8020b7:	48 98                	cltq
+  8020b9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  8020bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020c1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8020c5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8020c9:	0f b6 00             	movzbl (%rax),%eax
+  8020cc:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  8020cf:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  8020d3:	75 07                	jne    8020dc <strstr+0x7f>
+				return (char *) 0;
+  8020d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020da:	eb 37                	jmp    802113 <strstr+0xb6>
+		} while (sc != c);
+  8020dc:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  8020e0:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  8020e3:	75 d8                	jne    8020bd <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  8020e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020e9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8020ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020f1:	48 89 ce             	mov    %rcx,%rsi
+  8020f4:	48 89 c7             	mov    %rax,%rdi
+  8020f7:	48 b8 6e 8a ff ff ff 	movabs $0xffffffffffff8a6e,%rax
+  8020fe:	ff ff ff 
+  802101:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802105:	ff d0                	call   *%rax
+  802107:	85 c0                	test   %eax,%eax
+  802109:	75 b2                	jne    8020bd <strstr+0x60>
+
+	return (char *) (in - 1);
+  80210b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80210f:	48 83 e8 01          	sub    $0x1,%rax
+}
+  802113:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802117:	c9                   	leave
+  802118:	c3                   	ret
+
+0000000000802119 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  802119:	55                   	push   %rbp
+  80211a:	48 89 e5             	mov    %rsp,%rbp
+  80211d:	41 57                	push   %r15
+  80211f:	53                   	push   %rbx
+  802120:	48 83 ec 40          	sub    $0x40,%rsp
+  802124:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 802124 <syscall+0xb>
+  80212b:	49 bb 0c 6f 00 00 00 	movabs $0x6f0c,%r11
+  802132:	00 00 00 
+  802135:	4d 01 da             	add    %r11,%r10
+  802138:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80213b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80213e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  802142:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802146:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80214a:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  80214e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802151:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802155:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802159:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80215d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802161:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802165:	4c 89 c3             	mov    %r8,%rbx
+  802168:	cd 30                	int    $0x30
+  80216a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  80216e:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  802172:	74 52                	je     8021c6 <syscall+0xad>
+  802174:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802179:	7e 4b                	jle    8021c6 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80217b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80217f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802182:	49 89 d0             	mov    %rdx,%r8
+  802185:	89 c1                	mov    %eax,%ecx
+  802187:	48 b8 00 e0 ff ff ff 	movabs $0xffffffffffffe000,%rax
+  80218e:	ff ff ff 
+  802191:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  802195:	48 89 c2             	mov    %rax,%rdx
+  802198:	be 23 00 00 00       	mov    $0x23,%esi
+  80219d:	48 b8 1d e0 ff ff ff 	movabs $0xffffffffffffe01d,%rax
+  8021a4:	ff ff ff 
+  8021a7:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8021ab:	48 89 c7             	mov    %rax,%rdi
+  8021ae:	4d 89 d7             	mov    %r10,%r15
+  8021b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b6:	49 b9 b5 77 ff ff ff 	movabs $0xffffffffffff77b5,%r9
+  8021bd:	ff ff ff 
+  8021c0:	4d 01 d1             	add    %r10,%r9
+  8021c3:	41 ff d1             	call   *%r9
+
+	return ret;
+  8021c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8021ca:	48 83 c4 40          	add    $0x40,%rsp
+  8021ce:	5b                   	pop    %rbx
+  8021cf:	41 5f                	pop    %r15
+  8021d1:	5d                   	pop    %rbp
+  8021d2:	c3                   	ret
+
+00000000008021d3 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  8021d3:	55                   	push   %rbp
+  8021d4:	48 89 e5             	mov    %rsp,%rbp
+  8021d7:	41 57                	push   %r15
+  8021d9:	41 56                	push   %r14
+  8021db:	41 55                	push   %r13
+  8021dd:	41 54                	push   %r12
+  8021df:	53                   	push   %rbx
+  8021e0:	48 83 ec 48          	sub    $0x48,%rsp
+  8021e4:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 8021e4 <syscall_words+0x11>
+  8021eb:	49 bb 4c 6e 00 00 00 	movabs $0x6e4c,%r11
+  8021f2:	00 00 00 
+  8021f5:	4d 01 de             	add    %r11,%r14
+  8021f8:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8021fb:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  8021fe:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802202:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802206:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  80220a:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  80220e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802213:	74 09                	je     80221e <syscall_words+0x4b>
+  802215:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802219:	48 8b 00             	mov    (%rax),%rax
+  80221c:	eb 05                	jmp    802223 <syscall_words+0x50>
+  80221e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802223:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  802226:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80222b:	74 0a                	je     802237 <syscall_words+0x64>
+  80222d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802231:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802235:	eb 05                	jmp    80223c <syscall_words+0x69>
+  802237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80223c:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  80223f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802244:	74 0a                	je     802250 <syscall_words+0x7d>
+  802246:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80224a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80224e:	eb 05                	jmp    802255 <syscall_words+0x82>
+  802250:	b8 00 00 00 00       	mov    $0x0,%eax
+  802255:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  802258:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80225d:	74 0a                	je     802269 <syscall_words+0x96>
+  80225f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802263:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802267:	eb 05                	jmp    80226e <syscall_words+0x9b>
+  802269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226e:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  802271:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802276:	74 0a                	je     802282 <syscall_words+0xaf>
+  802278:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80227c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802280:	eb 05                	jmp    802287 <syscall_words+0xb4>
+  802282:	b8 00 00 00 00       	mov    $0x0,%eax
+  802287:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  80228a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80228f:	74 0a                	je     80229b <syscall_words+0xc8>
+  802291:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802295:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802299:	eb 05                	jmp    8022a0 <syscall_words+0xcd>
+  80229b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a0:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  8022a3:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8022a6:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8022aa:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8022ae:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  8022b2:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8022b6:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8022ba:	cd 30                	int    $0x30
+  8022bc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  8022c0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8022c5:	74 50                	je     802317 <syscall_words+0x144>
+		words[0] = r8;
+  8022c7:	4c 89 c2             	mov    %r8,%rdx
+  8022ca:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022ce:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  8022d1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022d5:	48 83 c0 08          	add    $0x8,%rax
+  8022d9:	4c 89 ca             	mov    %r9,%rdx
+  8022dc:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  8022df:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022e3:	48 83 c0 10          	add    $0x10,%rax
+  8022e7:	4c 89 d2             	mov    %r10,%rdx
+  8022ea:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  8022ed:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022f1:	48 83 c0 18          	add    $0x18,%rax
+  8022f5:	4c 89 da             	mov    %r11,%rdx
+  8022f8:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  8022fb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8022ff:	48 83 c0 20          	add    $0x20,%rax
+  802303:	4c 89 e2             	mov    %r12,%rdx
+  802306:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  802309:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80230d:	48 83 c0 28          	add    $0x28,%rax
+  802311:	4c 89 ea             	mov    %r13,%rdx
+  802314:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  802317:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80231b:	74 52                	je     80236f <syscall_words+0x19c>
+  80231d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802322:	7e 4b                	jle    80236f <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802324:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802328:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80232b:	49 89 d0             	mov    %rdx,%r8
+  80232e:	89 c1                	mov    %eax,%ecx
+  802330:	48 b8 00 e0 ff ff ff 	movabs $0xffffffffffffe000,%rax
+  802337:	ff ff ff 
+  80233a:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80233e:	48 89 c2             	mov    %rax,%rdx
+  802341:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802346:	48 b8 1d e0 ff ff ff 	movabs $0xffffffffffffe01d,%rax
+  80234d:	ff ff ff 
+  802350:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802354:	48 89 c7             	mov    %rax,%rdi
+  802357:	4d 89 f7             	mov    %r14,%r15
+  80235a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235f:	49 b9 b5 77 ff ff ff 	movabs $0xffffffffffff77b5,%r9
+  802366:	ff ff ff 
+  802369:	4d 01 f1             	add    %r14,%r9
+  80236c:	41 ff d1             	call   *%r9
+
+	return ret;
+  80236f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802373:	48 83 c4 48          	add    $0x48,%rsp
+  802377:	5b                   	pop    %rbx
+  802378:	41 5c                	pop    %r12
+  80237a:	41 5d                	pop    %r13
+  80237c:	41 5e                	pop    %r14
+  80237e:	41 5f                	pop    %r15
+  802380:	5d                   	pop    %rbp
+  802381:	c3                   	ret
+
+0000000000802382 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802382:	55                   	push   %rbp
+  802383:	48 89 e5             	mov    %rsp,%rbp
+  802386:	48 83 ec 10          	sub    $0x10,%rsp
+  80238a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80238a <sys_cputs+0x8>
+  802391:	49 bb a6 6c 00 00 00 	movabs $0x6ca6,%r11
+  802398:	00 00 00 
+  80239b:	4c 01 d8             	add    %r11,%rax
+  80239e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023a2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8023a6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8023aa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b2:	6a 00                	push   $0x0
+  8023b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ca:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  8023d1:	ff ff ff 
+  8023d4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023d8:	ff d0                	call   *%rax
+  8023da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023de:	90                   	nop
+  8023df:	c9                   	leave
+  8023e0:	c3                   	ret
+
+00000000008023e1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8023e1:	55                   	push   %rbp
+  8023e2:	48 89 e5             	mov    %rsp,%rbp
+  8023e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023e5 <sys_cgetc+0x4>
+  8023ec:	49 bb 4b 6c 00 00 00 	movabs $0x6c4b,%r11
+  8023f3:	00 00 00 
+  8023f6:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8023f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8023fd:	6a 00                	push   $0x0
+  8023ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802405:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80240b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802410:	ba 00 00 00 00       	mov    $0x0,%edx
+  802415:	be 00 00 00 00       	mov    $0x0,%esi
+  80241a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80241f:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802426:	ff ff ff 
+  802429:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80242d:	ff d0                	call   *%rax
+  80242f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802433:	c9                   	leave
+  802434:	c3                   	ret
+
+0000000000802435 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802435:	55                   	push   %rbp
+  802436:	48 89 e5             	mov    %rsp,%rbp
+  802439:	48 83 ec 10          	sub    $0x10,%rsp
+  80243d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80243d <sys_env_destroy+0x8>
+  802444:	49 bb f3 6b 00 00 00 	movabs $0x6bf3,%r11
+  80244b:	00 00 00 
+  80244e:	4c 01 d8             	add    %r11,%rax
+  802451:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802454:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802457:	48 63 d2             	movslq %edx,%rdx
+  80245a:	48 83 ec 08          	sub    $0x8,%rsp
+  80245e:	6a 00                	push   $0x0
+  802460:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802466:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80246c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802471:	be 01 00 00 00       	mov    $0x1,%esi
+  802476:	bf 03 00 00 00       	mov    $0x3,%edi
+  80247b:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802482:	ff ff ff 
+  802485:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802489:	ff d0                	call   *%rax
+  80248b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80248f:	c9                   	leave
+  802490:	c3                   	ret
+
+0000000000802491 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802491:	55                   	push   %rbp
+  802492:	48 89 e5             	mov    %rsp,%rbp
+  802495:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802495 <sys_getenvid+0x4>
+  80249c:	49 bb 9b 6b 00 00 00 	movabs $0x6b9b,%r11
+  8024a3:	00 00 00 
+  8024a6:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8024a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ad:	6a 00                	push   $0x0
+  8024af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ca:	bf 02 00 00 00       	mov    $0x2,%edi
+  8024cf:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  8024d6:	ff ff ff 
+  8024d9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024dd:	ff d0                	call   *%rax
+  8024df:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e3:	c9                   	leave
+  8024e4:	c3                   	ret
+
+00000000008024e5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024e9 <sys_yield+0x4>
+  8024f0:	49 bb 47 6b 00 00 00 	movabs $0x6b47,%r11
+  8024f7:	00 00 00 
+  8024fa:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8024fd:	48 83 ec 08          	sub    $0x8,%rsp
+  802501:	6a 00                	push   $0x0
+  802503:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802509:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80250f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802514:	ba 00 00 00 00       	mov    $0x0,%edx
+  802519:	be 00 00 00 00       	mov    $0x0,%esi
+  80251e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802523:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  80252a:	ff ff ff 
+  80252d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802531:	ff d0                	call   *%rax
+  802533:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802537:	90                   	nop
+  802538:	c9                   	leave
+  802539:	c3                   	ret
+
+000000000080253a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80253a:	55                   	push   %rbp
+  80253b:	48 89 e5             	mov    %rsp,%rbp
+  80253e:	48 83 ec 10          	sub    $0x10,%rsp
+  802542:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802542 <sys_page_alloc+0x8>
+  802549:	49 bb ee 6a 00 00 00 	movabs $0x6aee,%r11
+  802550:	00 00 00 
+  802553:	4c 01 d8             	add    %r11,%rax
+  802556:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802559:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80255d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802560:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802563:	48 63 f2             	movslq %edx,%rsi
+  802566:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80256a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80256d:	48 63 d2             	movslq %edx,%rdx
+  802570:	48 83 ec 08          	sub    $0x8,%rsp
+  802574:	6a 00                	push   $0x0
+  802576:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80257c:	49 89 f0             	mov    %rsi,%r8
+  80257f:	be 01 00 00 00       	mov    $0x1,%esi
+  802584:	bf 04 00 00 00       	mov    $0x4,%edi
+  802589:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802590:	ff ff ff 
+  802593:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802597:	ff d0                	call   *%rax
+  802599:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80259d:	c9                   	leave
+  80259e:	c3                   	ret
+
+000000000080259f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+  8025a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8025a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025a7 <sys_page_map+0x8>
+  8025ae:	49 bb 89 6a 00 00 00 	movabs $0x6a89,%r11
+  8025b5:	00 00 00 
+  8025b8:	4c 01 d8             	add    %r11,%rax
+  8025bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025c2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8025c5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8025c9:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8025cd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8025d0:	48 63 f2             	movslq %edx,%rsi
+  8025d3:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8025d7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025da:	48 63 fa             	movslq %edx,%rdi
+  8025dd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025e1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025e4:	48 63 d2             	movslq %edx,%rdx
+  8025e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8025eb:	56                   	push   %rsi
+  8025ec:	4d 89 c1             	mov    %r8,%r9
+  8025ef:	49 89 f8             	mov    %rdi,%r8
+  8025f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8025f7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8025fc:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802603:	ff ff ff 
+  802606:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80260a:	ff d0                	call   *%rax
+  80260c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802610:	c9                   	leave
+  802611:	c3                   	ret
+
+0000000000802612 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802612:	55                   	push   %rbp
+  802613:	48 89 e5             	mov    %rsp,%rbp
+  802616:	48 83 ec 10          	sub    $0x10,%rsp
+  80261a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80261a <sys_page_unmap+0x8>
+  802621:	49 bb 16 6a 00 00 00 	movabs $0x6a16,%r11
+  802628:	00 00 00 
+  80262b:	4c 01 d8             	add    %r11,%rax
+  80262e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802631:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802635:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802639:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80263c:	48 63 d2             	movslq %edx,%rdx
+  80263f:	48 83 ec 08          	sub    $0x8,%rsp
+  802643:	6a 00                	push   $0x0
+  802645:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80264b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802651:	be 01 00 00 00       	mov    $0x1,%esi
+  802656:	bf 06 00 00 00       	mov    $0x6,%edi
+  80265b:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802662:	ff ff ff 
+  802665:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802669:	ff d0                	call   *%rax
+  80266b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80266f:	c9                   	leave
+  802670:	c3                   	ret
+
+0000000000802671 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802671:	55                   	push   %rbp
+  802672:	48 89 e5             	mov    %rsp,%rbp
+  802675:	48 83 ec 10          	sub    $0x10,%rsp
+  802679:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802679 <sys_env_set_status+0x8>
+  802680:	49 bb b7 69 00 00 00 	movabs $0x69b7,%r11
+  802687:	00 00 00 
+  80268a:	4c 01 d8             	add    %r11,%rax
+  80268d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802690:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802693:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802696:	48 63 ca             	movslq %edx,%rcx
+  802699:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80269c:	48 63 d2             	movslq %edx,%rdx
+  80269f:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a3:	6a 00                	push   $0x0
+  8026a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8026b6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8026bb:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  8026c2:	ff ff ff 
+  8026c5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026c9:	ff d0                	call   *%rax
+  8026cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026cf:	c9                   	leave
+  8026d0:	c3                   	ret
+
+00000000008026d1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8026d1:	55                   	push   %rbp
+  8026d2:	48 89 e5             	mov    %rsp,%rbp
+  8026d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8026d9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026d9 <sys_env_set_trapframe+0x8>
+  8026e0:	49 bb 57 69 00 00 00 	movabs $0x6957,%r11
+  8026e7:	00 00 00 
+  8026ea:	4c 01 d8             	add    %r11,%rax
+  8026ed:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8026f4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026f8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026fb:	48 63 d2             	movslq %edx,%rdx
+  8026fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802702:	6a 00                	push   $0x0
+  802704:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80270a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802710:	be 01 00 00 00       	mov    $0x1,%esi
+  802715:	bf 09 00 00 00       	mov    $0x9,%edi
+  80271a:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802721:	ff ff ff 
+  802724:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802728:	ff d0                	call   *%rax
+  80272a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80272e:	c9                   	leave
+  80272f:	c3                   	ret
+
+0000000000802730 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802730:	55                   	push   %rbp
+  802731:	48 89 e5             	mov    %rsp,%rbp
+  802734:	48 83 ec 10          	sub    $0x10,%rsp
+  802738:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802738 <sys_env_set_pgfault_upcall+0x8>
+  80273f:	49 bb f8 68 00 00 00 	movabs $0x68f8,%r11
+  802746:	00 00 00 
+  802749:	4c 01 d8             	add    %r11,%rax
+  80274c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80274f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802753:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802757:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80275a:	48 63 d2             	movslq %edx,%rdx
+  80275d:	48 83 ec 08          	sub    $0x8,%rsp
+  802761:	6a 00                	push   $0x0
+  802763:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802769:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80276f:	be 01 00 00 00       	mov    $0x1,%esi
+  802774:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802779:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802780:	ff ff ff 
+  802783:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802787:	ff d0                	call   *%rax
+  802789:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80278d:	c9                   	leave
+  80278e:	c3                   	ret
+
+000000000080278f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80278f:	55                   	push   %rbp
+  802790:	48 89 e5             	mov    %rsp,%rbp
+  802793:	48 83 ec 20          	sub    $0x20,%rsp
+  802797:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802797 <sys_ipc_try_send+0x8>
+  80279e:	49 bb 99 68 00 00 00 	movabs $0x6899,%r11
+  8027a5:	00 00 00 
+  8027a8:	4c 01 d8             	add    %r11,%rax
+  8027ab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027b2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8027b6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8027b9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027bc:	48 63 fa             	movslq %edx,%rdi
+  8027bf:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8027c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027c6:	48 63 d2             	movslq %edx,%rdx
+  8027c9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d1:	6a 00                	push   $0x0
+  8027d3:	49 89 f9             	mov    %rdi,%r9
+  8027d6:	49 89 f0             	mov    %rsi,%r8
+  8027d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027de:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027e3:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  8027ea:	ff ff ff 
+  8027ed:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027f1:	ff d0                	call   *%rax
+  8027f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027f7:	c9                   	leave
+  8027f8:	c3                   	ret
+
+00000000008027f9 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8027f9:	55                   	push   %rbp
+  8027fa:	48 89 e5             	mov    %rsp,%rbp
+  8027fd:	48 83 ec 20          	sub    $0x20,%rsp
+  802801:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802801 <sys_ipc_send+0x8>
+  802808:	49 bb 2f 68 00 00 00 	movabs $0x682f,%r11
+  80280f:	00 00 00 
+  802812:	4c 01 d8             	add    %r11,%rax
+  802815:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802818:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80281c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802820:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802823:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802826:	48 63 fa             	movslq %edx,%rdi
+  802829:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80282d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802830:	48 63 d2             	movslq %edx,%rdx
+  802833:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802837:	48 83 ec 08          	sub    $0x8,%rsp
+  80283b:	6a 00                	push   $0x0
+  80283d:	49 89 f9             	mov    %rdi,%r9
+  802840:	49 89 f0             	mov    %rsi,%r8
+  802843:	be 00 00 00 00       	mov    $0x0,%esi
+  802848:	bf 17 00 00 00       	mov    $0x17,%edi
+  80284d:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802854:	ff ff ff 
+  802857:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80285b:	ff d0                	call   *%rax
+  80285d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802861:	c9                   	leave
+  802862:	c3                   	ret
+
+0000000000802863 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802863:	55                   	push   %rbp
+  802864:	48 89 e5             	mov    %rsp,%rbp
+  802867:	48 83 ec 10          	sub    $0x10,%rsp
+  80286b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80286b <sys_ipc_recv+0x8>
+  802872:	49 bb c5 67 00 00 00 	movabs $0x67c5,%r11
+  802879:	00 00 00 
+  80287c:	4c 01 d8             	add    %r11,%rax
+  80287f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802883:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802887:	6a 00                	push   $0x0
+  802889:	6a 00                	push   $0x0
+  80288b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802891:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802897:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80289c:	be 01 00 00 00       	mov    $0x1,%esi
+  8028a1:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8028a6:	49 ba a3 91 ff ff ff 	movabs $0xffffffffffff91a3,%r10
+  8028ad:	ff ff ff 
+  8028b0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028b4:	ff d0                	call   *%rax
+  8028b6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+
+00000000008028bc <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8028bc:	55                   	push   %rbp
+  8028bd:	48 89 e5             	mov    %rsp,%rbp
+  8028c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8028c4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028c4 <sys_ipc_call+0x8>
+  8028cb:	49 bb 6c 67 00 00 00 	movabs $0x676c,%r11
+  8028d2:	00 00 00 
+  8028d5:	4c 01 d8             	add    %r11,%rax
+  8028d8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028df:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8028e3:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8028e6:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8028ea:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8028ee:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8028f2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8028f5:	4c 63 c2             	movslq %edx,%r8
+  8028f8:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8028fc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8028ff:	48 63 d2             	movslq %edx,%rdx
+  802902:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802906:	ff 75 d8             	push   -0x28(%rbp)
+  802909:	56                   	push   %rsi
+  80290a:	4d 89 c1             	mov    %r8,%r9
+  80290d:	49 89 f8             	mov    %rdi,%r8
+  802910:	be 00 00 00 00       	mov    $0x0,%esi
+  802915:	bf 18 00 00 00       	mov    $0x18,%edi
+  80291a:	49 ba a3 91 ff ff ff 	movabs $0xffffffffffff91a3,%r10
+  802921:	ff ff ff 
+  802924:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802928:	ff d0                	call   *%rax
+  80292a:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80292e:	c9                   	leave
+  80292f:	c3                   	ret
+
+0000000000802930 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802930:	55                   	push   %rbp
+  802931:	48 89 e5             	mov    %rsp,%rbp
+  802934:	48 83 ec 30          	sub    $0x30,%rsp
+  802938:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802938 <sys_ipc_reply_recv+0x8>
+  80293f:	49 bb f8 66 00 00 00 	movabs $0x66f8,%r11
+  802946:	00 00 00 
+  802949:	4c 01 d8             	add    %r11,%rax
+  80294c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80294f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802953:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802957:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80295a:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80295e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802962:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802966:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802969:	4c 63 c2             	movslq %edx,%r8
+  80296c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802970:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802973:	48 63 d2             	movslq %edx,%rdx
+  802976:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80297a:	ff 75 d8             	push   -0x28(%rbp)
+  80297d:	56                   	push   %rsi
+  80297e:	4d 89 c1             	mov    %r8,%r9
+  802981:	49 89 f8             	mov    %rdi,%r8
+  802984:	be 00 00 00 00       	mov    $0x0,%esi
+  802989:	bf 19 00 00 00       	mov    $0x19,%edi
+  80298e:	49 ba a3 91 ff ff ff 	movabs $0xffffffffffff91a3,%r10
+  802995:	ff ff ff 
+  802998:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80299c:	ff d0                	call   *%rax
+  80299e:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8029a2:	c9                   	leave
+  8029a3:	c3                   	ret
+
+00000000008029a4 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8029a4:	55                   	push   %rbp
+  8029a5:	48 89 e5             	mov    %rsp,%rbp
+  8029a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8029ac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029ac <sys_env_set_priority+0x8>
+  8029b3:	49 bb 84 66 00 00 00 	movabs $0x6684,%r11
+  8029ba:	00 00 00 
+  8029bd:	4c 01 d8             	add    %r11,%rax
+  8029c0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029c3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8029c6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8029c9:	48 63 ca             	movslq %edx,%rcx
+  8029cc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029cf:	48 63 d2             	movslq %edx,%rdx
+  8029d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8029d6:	6a 00                	push   $0x0
+  8029d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8029e9:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8029ee:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  8029f5:	ff ff ff 
+  8029f8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029fc:	ff d0                	call   *%rax
+  8029fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a02:	c9                   	leave
+  802a03:	c3                   	ret
+
+0000000000802a04 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802a04:	55                   	push   %rbp
+  802a05:	48 89 e5             	mov    %rsp,%rbp
+  802a08:	48 83 ec 10          	sub    $0x10,%rsp
+  802a0c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a0c <sys_env_set_affinity+0x8>
+  802a13:	49 bb 24 66 00 00 00 	movabs $0x6624,%r11
+  802a1a:	00 00 00 
+  802a1d:	4c 01 d8             	add    %r11,%rax
+  802a20:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a23:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802a26:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802a29:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a2c:	48 63 d2             	movslq %edx,%rdx
+  802a2f:	48 83 ec 08          	sub    $0x8,%rsp
+  802a33:	6a 00                	push   $0x0
+  802a35:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a41:	be 01 00 00 00       	mov    $0x1,%esi
+  802a46:	bf 10 00 00 00       	mov    $0x10,%edi
+  802a4b:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802a52:	ff ff ff 
+  802a55:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a59:	ff d0                	call   *%rax
+  802a5b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a5f:	c9                   	leave
+  802a60:	c3                   	ret
+
+0000000000802a61 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802a61:	55                   	push   %rbp
+  802a62:	48 89 e5             	mov    %rsp,%rbp
+  802a65:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a65 <sys_time_msec+0x4>
+  802a6c:	49 bb cb 65 00 00 00 	movabs $0x65cb,%r11
+  802a73:	00 00 00 
+  802a76:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802a79:	48 83 ec 08          	sub    $0x8,%rsp
+  802a7d:	6a 00                	push   $0x0
+  802a7f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a90:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a95:	be 00 00 00 00       	mov    $0x0,%esi
+  802a9a:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802a9f:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802aa6:	ff ff ff 
+  802aa9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802aad:	ff d0                	call   *%rax
+  802aaf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ab3:	c9                   	leave
+  802ab4:	c3                   	ret
+
+0000000000802ab5 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802ab5:	55                   	push   %rbp
+  802ab6:	48 89 e5             	mov    %rsp,%rbp
+  802ab9:	48 83 ec 10          	sub    $0x10,%rsp
+  802abd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802abd <sys_sleep_usec+0x8>
+  802ac4:	49 bb 73 65 00 00 00 	movabs $0x6573,%r11
+  802acb:	00 00 00 
+  802ace:	4c 01 d8             	add    %r11,%rax
+  802ad1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802ad5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ad9:	48 83 ec 08          	sub    $0x8,%rsp
+  802add:	6a 00                	push   $0x0
+  802adf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ae5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802af0:	be 00 00 00 00       	mov    $0x0,%esi
+  802af5:	bf 11 00 00 00       	mov    $0x11,%edi
+  802afa:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802b01:	ff ff ff 
+  802b04:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b08:	ff d0                	call   *%rax
+  802b0a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b0e:	c9                   	leave
+  802b0f:	c3                   	ret
+
+0000000000802b10 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802b10:	55                   	push   %rbp
+  802b11:	48 89 e5             	mov    %rsp,%rbp
+  802b14:	48 83 ec 10          	sub    $0x10,%rsp
+  802b18:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b18 <sys_page_alloc_huge+0x8>
+  802b1f:	49 bb 18 65 00 00 00 	movabs $0x6518,%r11
+  802b26:	00 00 00 
+  802b29:	4c 01 d8             	add    %r11,%rax
+  802b2c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b2f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b33:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802b36:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802b39:	48 63 f2             	movslq %edx,%rsi
+  802b3c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802b40:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802b43:	48 63 d2             	movslq %edx,%rdx
+  802b46:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4a:	6a 00                	push   $0x0
+  802b4c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b52:	49 89 f0             	mov    %rsi,%r8
+  802b55:	be 01 00 00 00       	mov    $0x1,%esi
+  802b5a:	bf 12 00 00 00       	mov    $0x12,%edi
+  802b5f:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802b66:	ff ff ff 
+  802b69:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b6d:	ff d0                	call   *%rax
+  802b6f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b73:	c9                   	leave
+  802b74:	c3                   	ret
+
+0000000000802b75 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802b75:	55                   	push   %rbp
+  802b76:	48 89 e5             	mov    %rsp,%rbp
+  802b79:	48 83 ec 10          	sub    $0x10,%rsp
+  802b7d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b7d <sys_page_map_batch+0x8>
+  802b84:	49 bb b3 64 00 00 00 	movabs $0x64b3,%r11
+  802b8b:	00 00 00 
+  802b8e:	4c 01 d8             	add    %r11,%rax
+  802b91:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b95:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802b99:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b9d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802ba1:	48 83 ec 08          	sub    $0x8,%rsp
+  802ba5:	6a 00                	push   $0x0
+  802ba7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bb3:	be 01 00 00 00       	mov    $0x1,%esi
+  802bb8:	bf 13 00 00 00       	mov    $0x13,%edi
+  802bbd:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802bc4:	ff ff ff 
+  802bc7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802bcb:	ff d0                	call   *%rax
+  802bcd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bd1:	c9                   	leave
+  802bd2:	c3                   	ret
+
+0000000000802bd3 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802bd3:	55                   	push   %rbp
+  802bd4:	48 89 e5             	mov    %rsp,%rbp
+  802bd7:	48 83 ec 10          	sub    $0x10,%rsp
+  802bdb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802bdb <sys_page_alloc_batch+0x8>
+  802be2:	49 bb 55 64 00 00 00 	movabs $0x6455,%r11
+  802be9:	00 00 00 
+  802bec:	4c 01 d8             	add    %r11,%rax
+  802bef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802bf3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802bf7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bfb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802bff:	48 83 ec 08          	sub    $0x8,%rsp
+  802c03:	6a 00                	push   $0x0
+  802c05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c0b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c11:	be 01 00 00 00       	mov    $0x1,%esi
+  802c16:	bf 14 00 00 00       	mov    $0x14,%edi
+  802c1b:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802c22:	ff ff ff 
+  802c25:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c29:	ff d0                	call   *%rax
+  802c2b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c2f:	c9                   	leave
+  802c30:	c3                   	ret
+
+0000000000802c31 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802c31:	55                   	push   %rbp
+  802c32:	48 89 e5             	mov    %rsp,%rbp
+  802c35:	48 83 ec 10          	sub    $0x10,%rsp
+  802c39:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c39 <sys_page_unmap_batch+0x8>
+  802c40:	49 bb f7 63 00 00 00 	movabs $0x63f7,%r11
+  802c47:	00 00 00 
+  802c4a:	4c 01 d8             	add    %r11,%rax
+  802c4d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c51:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802c55:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c59:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802c5d:	48 83 ec 08          	sub    $0x8,%rsp
+  802c61:	6a 00                	push   $0x0
+  802c63:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c6f:	be 01 00 00 00       	mov    $0x1,%esi
+  802c74:	bf 15 00 00 00       	mov    $0x15,%edi
+  802c79:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802c80:	ff ff ff 
+  802c83:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c87:	ff d0                	call   *%rax
+  802c89:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c8d:	c9                   	leave
+  802c8e:	c3                   	ret
+
+0000000000802c8f <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802c8f:	55                   	push   %rbp
+  802c90:	48 89 e5             	mov    %rsp,%rbp
+  802c93:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c93 <sys_fork+0x4>
+  802c9a:	49 bb 9d 63 00 00 00 	movabs $0x639d,%r11
+  802ca1:	00 00 00 
+  802ca4:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802ca7:	48 83 ec 08          	sub    $0x8,%rsp
+  802cab:	6a 00                	push   $0x0
+  802cad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802cb3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cc3:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc8:	bf 16 00 00 00       	mov    $0x16,%edi
+  802ccd:	49 ba e9 90 ff ff ff 	movabs $0xffffffffffff90e9,%r10
+  802cd4:	ff ff ff 
+  802cd7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802cdb:	ff d0                	call   *%rax
+  802cdd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ce1:	c9                   	leave
+  802ce2:	c3                   	ret
+
+0000000000802ce3 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  802ce3:	55                   	push   %rbp
+  802ce4:	48 89 e5             	mov    %rsp,%rbp
+  802ce7:	48 83 ec 18          	sub    $0x18,%rsp
+  802ceb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ceb <argstart+0x8>
+  802cf2:	49 bb 45 63 00 00 00 	movabs $0x6345,%r11
+  802cf9:	00 00 00 
+  802cfc:	4c 01 d8             	add    %r11,%rax
+  802cff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d03:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802d07:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	args->argc = argc;
+  802d0b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802d0f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802d13:	48 89 0a             	mov    %rcx,(%rdx)
+	args->argv = (const char **) argv;
+  802d16:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802d1a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802d1e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  802d22:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d26:	8b 12                	mov    (%rdx),%edx
+  802d28:	83 fa 01             	cmp    $0x1,%edx
+  802d2b:	7e 17                	jle    802d44 <argstart+0x61>
+  802d2d:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802d32:	74 10                	je     802d44 <argstart+0x61>
+  802d34:	48 ba 2b e0 ff ff ff 	movabs $0xffffffffffffe02b,%rdx
+  802d3b:	ff ff ff 
+  802d3e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802d42:	eb 05                	jmp    802d49 <argstart+0x66>
+  802d44:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d49:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802d4d:	48 89 42 10          	mov    %rax,0x10(%rdx)
+	args->argvalue = 0;
+  802d51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d55:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  802d5c:	00 
+}
+  802d5d:	90                   	nop
+  802d5e:	c9                   	leave
+  802d5f:	c3                   	ret
+
+0000000000802d60 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  802d60:	55                   	push   %rbp
+  802d61:	48 89 e5             	mov    %rsp,%rbp
+  802d64:	41 57                	push   %r15
+  802d66:	48 83 ec 28          	sub    $0x28,%rsp
+  802d6a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d6a <argnext+0xa>
+  802d71:	49 bb c6 62 00 00 00 	movabs $0x62c6,%r11
+  802d78:	00 00 00 
+  802d7b:	4c 01 d8             	add    %r11,%rax
+  802d7e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int arg;
+
+	args->argvalue = 0;
+  802d82:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802d86:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  802d8d:	00 
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  802d8e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802d92:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  802d96:	48 85 d2             	test   %rdx,%rdx
+  802d99:	75 0a                	jne    802da5 <argnext+0x45>
+		return -1;
+  802d9b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802da0:	e9 28 01 00 00       	jmp    802ecd <argnext+0x16d>
+
+	if (!*args->curarg) {
+  802da5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802da9:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  802dad:	0f b6 12             	movzbl (%rdx),%edx
+  802db0:	84 d2                	test   %dl,%dl
+  802db2:	0f 85 d6 00 00 00    	jne    802e8e <argnext+0x12e>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  802db8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802dbc:	48 8b 12             	mov    (%rdx),%rdx
+  802dbf:	8b 12                	mov    (%rdx),%edx
+  802dc1:	83 fa 01             	cmp    $0x1,%edx
+  802dc4:	0f 84 ee 00 00 00    	je     802eb8 <argnext+0x158>
+		    || args->argv[1][0] != '-'
+  802dca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802dce:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  802dd2:	48 83 c2 08          	add    $0x8,%rdx
+  802dd6:	48 8b 12             	mov    (%rdx),%rdx
+  802dd9:	0f b6 12             	movzbl (%rdx),%edx
+  802ddc:	80 fa 2d             	cmp    $0x2d,%dl
+  802ddf:	0f 85 d3 00 00 00    	jne    802eb8 <argnext+0x158>
+		    || args->argv[1][1] == '\0')
+  802de5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802de9:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  802ded:	48 83 c2 08          	add    $0x8,%rdx
+  802df1:	48 8b 12             	mov    (%rdx),%rdx
+  802df4:	48 83 c2 01          	add    $0x1,%rdx
+  802df8:	0f b6 12             	movzbl (%rdx),%edx
+  802dfb:	84 d2                	test   %dl,%dl
+  802dfd:	0f 84 b5 00 00 00    	je     802eb8 <argnext+0x158>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  802e03:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e07:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  802e0b:	48 83 c2 08          	add    $0x8,%rdx
+  802e0f:	48 8b 12             	mov    (%rdx),%rdx
+  802e12:	48 8d 4a 01          	lea    0x1(%rdx),%rcx
+  802e16:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e1a:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802e1e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802e22:	48 8b 12             	mov    (%rdx),%rdx
+  802e25:	8b 12                	mov    (%rdx),%edx
+  802e27:	83 ea 01             	sub    $0x1,%edx
+  802e2a:	48 63 d2             	movslq %edx,%rdx
+  802e2d:	48 c1 e2 03          	shl    $0x3,%rdx
+  802e31:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802e35:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  802e39:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  802e3d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802e41:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  802e45:	48 83 c1 08          	add    $0x8,%rcx
+  802e49:	48 89 cf             	mov    %rcx,%rdi
+  802e4c:	49 89 c7             	mov    %rax,%r15
+  802e4f:	48 b9 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rcx
+  802e56:	ff ff ff 
+  802e59:	48 01 c1             	add    %rax,%rcx
+  802e5c:	ff d1                	call   *%rcx
+		(*args->argc)--;
+  802e5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e62:	48 8b 00             	mov    (%rax),%rax
+  802e65:	8b 10                	mov    (%rax),%edx
+  802e67:	83 ea 01             	sub    $0x1,%edx
+  802e6a:	89 10                	mov    %edx,(%rax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802e6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e70:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802e74:	0f b6 00             	movzbl (%rax),%eax
+  802e77:	3c 2d                	cmp    $0x2d,%al
+  802e79:	75 13                	jne    802e8e <argnext+0x12e>
+  802e7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e7f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802e83:	48 83 c0 01          	add    $0x1,%rax
+  802e87:	0f b6 00             	movzbl (%rax),%eax
+  802e8a:	84 c0                	test   %al,%al
+  802e8c:	74 2d                	je     802ebb <argnext+0x15b>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  802e8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e92:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802e96:	0f b6 00             	movzbl (%rax),%eax
+  802e99:	0f b6 c0             	movzbl %al,%eax
+  802e9c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	args->curarg++;
+  802e9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ea3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802ea7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802eab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802eaf:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	return arg;
+  802eb3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eb6:	eb 15                	jmp    802ecd <argnext+0x16d>
+			goto endofargs;
+  802eb8:	90                   	nop
+  802eb9:	eb 01                	jmp    802ebc <argnext+0x15c>
+			goto endofargs;
+  802ebb:	90                   	nop
+
+endofargs:
+	args->curarg = 0;
+  802ebc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ec0:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802ec7:	00 
+	return -1;
+  802ec8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  802ecd:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802ed1:	c9                   	leave
+  802ed2:	c3                   	ret
+
+0000000000802ed3 <argvalue>:
+
+char *
+argvalue(struct Argstate *args)
+{
+  802ed3:	55                   	push   %rbp
+  802ed4:	48 89 e5             	mov    %rsp,%rbp
+  802ed7:	48 83 ec 10          	sub    $0x10,%rsp
+  802edb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802edb <argvalue+0x8>
+  802ee2:	49 bb 55 61 00 00 00 	movabs $0x6155,%r11
+  802ee9:	00 00 00 
+  802eec:	4c 01 d8             	add    %r11,%rax
+  802eef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  802ef3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ef7:	48 8b 52 18          	mov    0x18(%rdx),%rdx
+  802efb:	48 85 d2             	test   %rdx,%rdx
+  802efe:	74 0a                	je     802f0a <argvalue+0x37>
+  802f00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f04:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802f08:	eb 17                	jmp    802f21 <argvalue+0x4e>
+  802f0a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f0e:	48 89 d7             	mov    %rdx,%rdi
+  802f11:	48 ba f3 9e ff ff ff 	movabs $0xffffffffffff9ef3,%rdx
+  802f18:	ff ff ff 
+  802f1b:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802f1f:	ff d0                	call   *%rax
+}
+  802f21:	c9                   	leave
+  802f22:	c3                   	ret
+
+0000000000802f23 <argnextvalue>:
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  802f23:	55                   	push   %rbp
+  802f24:	48 89 e5             	mov    %rsp,%rbp
+  802f27:	41 57                	push   %r15
+  802f29:	48 83 ec 18          	sub    $0x18,%rsp
+  802f2d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f2d <argnextvalue+0xa>
+  802f34:	49 bb 03 61 00 00 00 	movabs $0x6103,%r11
+  802f3b:	00 00 00 
+  802f3e:	4c 01 d8             	add    %r11,%rax
+  802f41:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (!args->curarg)
+  802f45:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f49:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  802f4d:	48 85 d2             	test   %rdx,%rdx
+  802f50:	75 0a                	jne    802f5c <argnextvalue+0x39>
+		return 0;
+  802f52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f57:	e9 cc 00 00 00       	jmp    803028 <argnextvalue+0x105>
+	if (*args->curarg) {
+  802f5c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f60:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  802f64:	0f b6 12             	movzbl (%rdx),%edx
+  802f67:	84 d2                	test   %dl,%dl
+  802f69:	74 2b                	je     802f96 <argnextvalue+0x73>
+		args->argvalue = args->curarg;
+  802f6b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f6f:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  802f73:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f77:	48 89 4a 18          	mov    %rcx,0x18(%rdx)
+		args->curarg = "";
+  802f7b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f7f:	48 b9 2b e0 ff ff ff 	movabs $0xffffffffffffe02b,%rcx
+  802f86:	ff ff ff 
+  802f89:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802f8d:	48 89 42 10          	mov    %rax,0x10(%rdx)
+  802f91:	e9 8a 00 00 00       	jmp    803020 <argnextvalue+0xfd>
+	} else if (*args->argc > 1) {
+  802f96:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f9a:	48 8b 12             	mov    (%rdx),%rdx
+  802f9d:	8b 12                	mov    (%rdx),%edx
+  802f9f:	83 fa 01             	cmp    $0x1,%edx
+  802fa2:	7e 64                	jle    803008 <argnextvalue+0xe5>
+		args->argvalue = args->argv[1];
+  802fa4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802fa8:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  802fac:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  802fb0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802fb4:	48 89 4a 18          	mov    %rcx,0x18(%rdx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  802fb8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802fbc:	48 8b 12             	mov    (%rdx),%rdx
+  802fbf:	8b 12                	mov    (%rdx),%edx
+  802fc1:	83 ea 01             	sub    $0x1,%edx
+  802fc4:	48 63 d2             	movslq %edx,%rdx
+  802fc7:	48 c1 e2 03          	shl    $0x3,%rdx
+  802fcb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802fcf:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  802fd3:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  802fd7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802fdb:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  802fdf:	48 83 c1 08          	add    $0x8,%rcx
+  802fe3:	48 89 cf             	mov    %rcx,%rdi
+  802fe6:	49 89 c7             	mov    %rax,%r15
+  802fe9:	48 b9 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rcx
+  802ff0:	ff ff ff 
+  802ff3:	48 01 c1             	add    %rax,%rcx
+  802ff6:	ff d1                	call   *%rcx
+		(*args->argc)--;
+  802ff8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ffc:	48 8b 00             	mov    (%rax),%rax
+  802fff:	8b 10                	mov    (%rax),%edx
+  803001:	83 ea 01             	sub    $0x1,%edx
+  803004:	89 10                	mov    %edx,(%rax)
+  803006:	eb 18                	jmp    803020 <argnextvalue+0xfd>
+	} else {
+		args->argvalue = 0;
+  803008:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80300c:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  803013:	00 
+		args->curarg = 0;
+  803014:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803018:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80301f:	00 
+	}
+	return (char*) args->argvalue;
+  803020:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803024:	48 8b 40 18          	mov    0x18(%rax),%rax
+}
+  803028:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80302c:	c9                   	leave
+  80302d:	c3                   	ret
+
+000000000080302e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80302e:	55                   	push   %rbp
+  80302f:	48 89 e5             	mov    %rsp,%rbp
+  803032:	48 83 ec 08          	sub    $0x8,%rsp
+  803036:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803036 <fd2num+0x8>
+  80303d:	49 bb fa 5f 00 00 00 	movabs $0x5ffa,%r11
+  803044:	00 00 00 
+  803047:	4c 01 d8             	add    %r11,%rax
+  80304a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80304e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803052:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803059:	ff ff ff 
+  80305c:	48 01 d0             	add    %rdx,%rax
+  80305f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803063:	c9                   	leave
+  803064:	c3                   	ret
+
+0000000000803065 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803065:	55                   	push   %rbp
+  803066:	48 89 e5             	mov    %rsp,%rbp
+  803069:	48 83 ec 08          	sub    $0x8,%rsp
+  80306d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80306d <fd2data+0x8>
+  803074:	49 bb c3 5f 00 00 00 	movabs $0x5fc3,%r11
+  80307b:	00 00 00 
+  80307e:	4c 01 d8             	add    %r11,%rax
+  803081:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803085:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803089:	48 89 d7             	mov    %rdx,%rdi
+  80308c:	48 ba fe 9f ff ff ff 	movabs $0xffffffffffff9ffe,%rdx
+  803093:	ff ff ff 
+  803096:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80309a:	ff d0                	call   *%rax
+  80309c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8030a2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8030a6:	c9                   	leave
+  8030a7:	c3                   	ret
+
+00000000008030a8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8030a8:	55                   	push   %rbp
+  8030a9:	48 89 e5             	mov    %rsp,%rbp
+  8030ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8030b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8030b0 <fd_alloc+0x8>
+  8030b7:	49 bb 80 5f 00 00 00 	movabs $0x5f80,%r11
+  8030be:	00 00 00 
+  8030c1:	4c 01 d8             	add    %r11,%rax
+  8030c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8030c8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8030cf:	eb 75                	jmp    803146 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8030d1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8030d4:	48 63 d2             	movslq %edx,%rdx
+  8030d7:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8030de:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8030e2:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8030e6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030ea:	48 89 d1             	mov    %rdx,%rcx
+  8030ed:	48 c1 e9 15          	shr    $0x15,%rcx
+  8030f1:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8030f8:	ff ff ff 
+  8030fb:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8030ff:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803103:	83 e2 01             	and    $0x1,%edx
+  803106:	48 85 d2             	test   %rdx,%rdx
+  803109:	74 25                	je     803130 <fd_alloc+0x88>
+  80310b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80310f:	48 89 d1             	mov    %rdx,%rcx
+  803112:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803116:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80311d:	ff ff ff 
+  803120:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803124:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803128:	83 e2 01             	and    $0x1,%edx
+  80312b:	48 85 d2             	test   %rdx,%rdx
+  80312e:	75 12                	jne    803142 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803130:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803134:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803138:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80313b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803140:	eb 1a                	jmp    80315c <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803142:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803146:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80314a:	7e 85                	jle    8030d1 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  80314c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803150:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803157:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  80315c:	c9                   	leave
+  80315d:	c3                   	ret
+
+000000000080315e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80315e:	55                   	push   %rbp
+  80315f:	48 89 e5             	mov    %rsp,%rbp
+  803162:	48 83 ec 20          	sub    $0x20,%rsp
+  803166:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803166 <fd_lookup+0x8>
+  80316d:	49 bb ca 5e 00 00 00 	movabs $0x5eca,%r11
+  803174:	00 00 00 
+  803177:	4c 01 d8             	add    %r11,%rax
+  80317a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80317d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803181:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803185:	78 06                	js     80318d <fd_lookup+0x2f>
+  803187:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80318b:	7e 07                	jle    803194 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80318d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803192:	eb 73                	jmp    803207 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803194:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803197:	48 63 d2             	movslq %edx,%rdx
+  80319a:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8031a1:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8031a5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8031a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031ad:	48 89 d1             	mov    %rdx,%rcx
+  8031b0:	48 c1 e9 15          	shr    $0x15,%rcx
+  8031b4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8031bb:	ff ff ff 
+  8031be:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8031c2:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8031c6:	83 e2 01             	and    $0x1,%edx
+  8031c9:	48 85 d2             	test   %rdx,%rdx
+  8031cc:	74 22                	je     8031f0 <fd_lookup+0x92>
+  8031ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031d2:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8031d6:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  8031dd:	ff ff ff 
+  8031e0:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8031e4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031e8:	83 e0 01             	and    $0x1,%eax
+  8031eb:	48 85 c0             	test   %rax,%rax
+  8031ee:	75 07                	jne    8031f7 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8031f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031f5:	eb 10                	jmp    803207 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8031f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031fb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031ff:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803202:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803207:	c9                   	leave
+  803208:	c3                   	ret
+
+0000000000803209 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803209:	55                   	push   %rbp
+  80320a:	48 89 e5             	mov    %rsp,%rbp
+  80320d:	41 57                	push   %r15
+  80320f:	53                   	push   %rbx
+  803210:	48 83 ec 30          	sub    $0x30,%rsp
+  803214:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803214 <fd_close+0xb>
+  80321b:	49 bb 1c 5e 00 00 00 	movabs $0x5e1c,%r11
+  803222:	00 00 00 
+  803225:	4c 01 db             	add    %r11,%rbx
+  803228:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80322c:	89 f0                	mov    %esi,%eax
+  80322e:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803231:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803235:	48 89 c7             	mov    %rax,%rdi
+  803238:	48 b8 fe 9f ff ff ff 	movabs $0xffffffffffff9ffe,%rax
+  80323f:	ff ff ff 
+  803242:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803246:	ff d0                	call   *%rax
+  803248:	89 c2                	mov    %eax,%edx
+  80324a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80324e:	48 89 c6             	mov    %rax,%rsi
+  803251:	89 d7                	mov    %edx,%edi
+  803253:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  80325a:	ff ff ff 
+  80325d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803261:	ff d0                	call   *%rax
+  803263:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803266:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80326a:	78 0a                	js     803276 <fd_close+0x6d>
+	    || fd != fd2)
+  80326c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803270:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803274:	74 12                	je     803288 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803276:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80327a:	74 05                	je     803281 <fd_close+0x78>
+  80327c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80327f:	eb 7a                	jmp    8032fb <fd_close+0xf2>
+  803281:	b8 00 00 00 00       	mov    $0x0,%eax
+  803286:	eb 73                	jmp    8032fb <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803288:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80328c:	8b 00                	mov    (%rax),%eax
+  80328e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803292:	48 89 d6             	mov    %rdx,%rsi
+  803295:	89 c7                	mov    %eax,%edi
+  803297:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  80329e:	ff ff ff 
+  8032a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032a5:	ff d0                	call   *%rax
+  8032a7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032aa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032ae:	78 2a                	js     8032da <fd_close+0xd1>
+		if (dev->dev_close)
+  8032b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032b4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8032b8:	48 85 c0             	test   %rax,%rax
+  8032bb:	74 16                	je     8032d3 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8032bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032c1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8032c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032c9:	48 89 c7             	mov    %rax,%rdi
+  8032cc:	ff d2                	call   *%rdx
+  8032ce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032d1:	eb 07                	jmp    8032da <fd_close+0xd1>
+		else
+			r = 0;
+  8032d3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8032da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032de:	48 89 c6             	mov    %rax,%rsi
+  8032e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032e6:	49 89 df             	mov    %rbx,%r15
+  8032e9:	48 b8 e2 95 ff ff ff 	movabs $0xffffffffffff95e2,%rax
+  8032f0:	ff ff ff 
+  8032f3:	48 01 d8             	add    %rbx,%rax
+  8032f6:	ff d0                	call   *%rax
+	return r;
+  8032f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8032fb:	48 83 c4 30          	add    $0x30,%rsp
+  8032ff:	5b                   	pop    %rbx
+  803300:	41 5f                	pop    %r15
+  803302:	5d                   	pop    %rbp
+  803303:	c3                   	ret
+
+0000000000803304 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803304:	55                   	push   %rbp
+  803305:	48 89 e5             	mov    %rsp,%rbp
+  803308:	41 57                	push   %r15
+  80330a:	48 83 ec 28          	sub    $0x28,%rsp
+  80330e:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80330e <dev_lookup+0xa>
+  803315:	49 bb 22 5d 00 00 00 	movabs $0x5d22,%r11
+  80331c:	00 00 00 
+  80331f:	4c 01 d9             	add    %r11,%rcx
+  803322:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803325:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803329:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803330:	eb 45                	jmp    803377 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803332:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  803339:	00 00 00 
+  80333c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80333f:	48 98                	cltq
+  803341:	48 01 ca             	add    %rcx,%rdx
+  803344:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803348:	8b 00                	mov    (%rax),%eax
+  80334a:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80334d:	75 24                	jne    803373 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  80334f:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  803356:	00 00 00 
+  803359:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80335c:	48 98                	cltq
+  80335e:	48 01 ca             	add    %rcx,%rdx
+  803361:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803365:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803369:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80336c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803371:	eb 74                	jmp    8033e7 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803373:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803377:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  80337e:	00 00 00 
+  803381:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803384:	48 98                	cltq
+  803386:	48 01 ca             	add    %rcx,%rdx
+  803389:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80338d:	48 85 c0             	test   %rax,%rax
+  803390:	75 a0                	jne    803332 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803392:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803399:	ff ff ff 
+  80339c:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8033a0:	48 8b 00             	mov    (%rax),%rax
+  8033a3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8033a9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8033ac:	89 c6                	mov    %eax,%esi
+  8033ae:	48 b8 30 e0 ff ff ff 	movabs $0xffffffffffffe030,%rax
+  8033b5:	ff ff ff 
+  8033b8:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8033bc:	48 89 c7             	mov    %rax,%rdi
+  8033bf:	49 89 cf             	mov    %rcx,%r15
+  8033c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c7:	49 b8 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%r8
+  8033ce:	ff ff ff 
+  8033d1:	49 01 c8             	add    %rcx,%r8
+  8033d4:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8033d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033db:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8033e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8033e7:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8033eb:	c9                   	leave
+  8033ec:	c3                   	ret
+
+00000000008033ed <close>:
+
+int
+close(int fdnum)
+{
+  8033ed:	55                   	push   %rbp
+  8033ee:	48 89 e5             	mov    %rsp,%rbp
+  8033f1:	53                   	push   %rbx
+  8033f2:	48 83 ec 28          	sub    $0x28,%rsp
+  8033f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033f6 <close+0x9>
+  8033fd:	49 bb 3a 5c 00 00 00 	movabs $0x5c3a,%r11
+  803404:	00 00 00 
+  803407:	4c 01 db             	add    %r11,%rbx
+  80340a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80340d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803411:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803414:	48 89 d6             	mov    %rdx,%rsi
+  803417:	89 c7                	mov    %eax,%edi
+  803419:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  803420:	ff ff ff 
+  803423:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803427:	ff d0                	call   *%rax
+  803429:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80342c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803430:	79 05                	jns    803437 <close+0x4a>
+		return r;
+  803432:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803435:	eb 1c                	jmp    803453 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803437:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80343b:	be 01 00 00 00       	mov    $0x1,%esi
+  803440:	48 89 c7             	mov    %rax,%rdi
+  803443:	48 b8 d9 a1 ff ff ff 	movabs $0xffffffffffffa1d9,%rax
+  80344a:	ff ff ff 
+  80344d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803451:	ff d0                	call   *%rax
+}
+  803453:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803457:	c9                   	leave
+  803458:	c3                   	ret
+
+0000000000803459 <close_all>:
+
+void
+close_all(void)
+{
+  803459:	55                   	push   %rbp
+  80345a:	48 89 e5             	mov    %rsp,%rbp
+  80345d:	53                   	push   %rbx
+  80345e:	48 83 ec 18          	sub    $0x18,%rsp
+  803462:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803462 <close_all+0x9>
+  803469:	49 bb ce 5b 00 00 00 	movabs $0x5bce,%r11
+  803470:	00 00 00 
+  803473:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803476:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80347d:	eb 19                	jmp    803498 <close_all+0x3f>
+		close(i);
+  80347f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803482:	89 c7                	mov    %eax,%edi
+  803484:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  80348b:	ff ff ff 
+  80348e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803492:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803494:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803498:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80349c:	7e e1                	jle    80347f <close_all+0x26>
+}
+  80349e:	90                   	nop
+  80349f:	90                   	nop
+  8034a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034a4:	c9                   	leave
+  8034a5:	c3                   	ret
+
+00000000008034a6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8034a6:	55                   	push   %rbp
+  8034a7:	48 89 e5             	mov    %rsp,%rbp
+  8034aa:	41 57                	push   %r15
+  8034ac:	53                   	push   %rbx
+  8034ad:	48 83 ec 40          	sub    $0x40,%rsp
+  8034b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034b1 <dup+0xb>
+  8034b8:	49 bb 7f 5b 00 00 00 	movabs $0x5b7f,%r11
+  8034bf:	00 00 00 
+  8034c2:	4c 01 db             	add    %r11,%rbx
+  8034c5:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8034c8:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8034cb:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8034cf:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8034d2:	48 89 d6             	mov    %rdx,%rsi
+  8034d5:	89 c7                	mov    %eax,%edi
+  8034d7:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  8034de:	ff ff ff 
+  8034e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034e5:	ff d0                	call   *%rax
+  8034e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034ee:	79 08                	jns    8034f8 <dup+0x52>
+		return r;
+  8034f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034f3:	e9 a4 01 00 00       	jmp    80369c <dup+0x1f6>
+	close(newfdnum);
+  8034f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8034fb:	89 c7                	mov    %eax,%edi
+  8034fd:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  803504:	ff ff ff 
+  803507:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80350b:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  80350d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803510:	48 98                	cltq
+  803512:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803518:	48 c1 e0 0c          	shl    $0xc,%rax
+  80351c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803520:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803524:	48 89 c7             	mov    %rax,%rdi
+  803527:	48 b8 35 a0 ff ff ff 	movabs $0xffffffffffffa035,%rax
+  80352e:	ff ff ff 
+  803531:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803535:	ff d0                	call   *%rax
+  803537:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  80353b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80353f:	48 89 c7             	mov    %rax,%rdi
+  803542:	48 b8 35 a0 ff ff ff 	movabs $0xffffffffffffa035,%rax
+  803549:	ff ff ff 
+  80354c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803550:	ff d0                	call   *%rax
+  803552:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803556:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80355a:	48 c1 e8 15          	shr    $0x15,%rax
+  80355e:	48 89 c2             	mov    %rax,%rdx
+  803561:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  803568:	ff ff ff 
+  80356b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80356f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803573:	83 e0 01             	and    $0x1,%eax
+  803576:	48 85 c0             	test   %rax,%rax
+  803579:	74 7f                	je     8035fa <dup+0x154>
+  80357b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80357f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803583:	48 89 c2             	mov    %rax,%rdx
+  803586:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80358d:	ff ff ff 
+  803590:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803594:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803598:	83 e0 01             	and    $0x1,%eax
+  80359b:	48 85 c0             	test   %rax,%rax
+  80359e:	74 5a                	je     8035fa <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8035a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035a4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8035a8:	48 89 c2             	mov    %rax,%rdx
+  8035ab:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8035b2:	ff ff ff 
+  8035b5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035b9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8035c2:	89 c1                	mov    %eax,%ecx
+  8035c4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8035c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035cc:	41 89 c8             	mov    %ecx,%r8d
+  8035cf:	48 89 d1             	mov    %rdx,%rcx
+  8035d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d7:	48 89 c6             	mov    %rax,%rsi
+  8035da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035df:	49 89 df             	mov    %rbx,%r15
+  8035e2:	48 b8 6f 95 ff ff ff 	movabs $0xffffffffffff956f,%rax
+  8035e9:	ff ff ff 
+  8035ec:	48 01 d8             	add    %rbx,%rax
+  8035ef:	ff d0                	call   *%rax
+  8035f1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8035f4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035f8:	78 5f                	js     803659 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8035fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035fe:	48 c1 e8 0c          	shr    $0xc,%rax
+  803602:	48 89 c2             	mov    %rax,%rdx
+  803605:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80360c:	ff ff ff 
+  80360f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803613:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803617:	25 07 0e 00 00       	and    $0xe07,%eax
+  80361c:	89 c1                	mov    %eax,%ecx
+  80361e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803622:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803626:	41 89 c8             	mov    %ecx,%r8d
+  803629:	48 89 d1             	mov    %rdx,%rcx
+  80362c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803631:	48 89 c6             	mov    %rax,%rsi
+  803634:	bf 00 00 00 00       	mov    $0x0,%edi
+  803639:	49 89 df             	mov    %rbx,%r15
+  80363c:	48 b8 6f 95 ff ff ff 	movabs $0xffffffffffff956f,%rax
+  803643:	ff ff ff 
+  803646:	48 01 d8             	add    %rbx,%rax
+  803649:	ff d0                	call   *%rax
+  80364b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80364e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803652:	78 08                	js     80365c <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803654:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803657:	eb 43                	jmp    80369c <dup+0x1f6>
+			goto err;
+  803659:	90                   	nop
+  80365a:	eb 01                	jmp    80365d <dup+0x1b7>
+		goto err;
+  80365c:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80365d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803661:	48 89 c6             	mov    %rax,%rsi
+  803664:	bf 00 00 00 00       	mov    $0x0,%edi
+  803669:	49 89 df             	mov    %rbx,%r15
+  80366c:	48 b8 e2 95 ff ff ff 	movabs $0xffffffffffff95e2,%rax
+  803673:	ff ff ff 
+  803676:	48 01 d8             	add    %rbx,%rax
+  803679:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  80367b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80367f:	48 89 c6             	mov    %rax,%rsi
+  803682:	bf 00 00 00 00       	mov    $0x0,%edi
+  803687:	49 89 df             	mov    %rbx,%r15
+  80368a:	48 b8 e2 95 ff ff ff 	movabs $0xffffffffffff95e2,%rax
+  803691:	ff ff ff 
+  803694:	48 01 d8             	add    %rbx,%rax
+  803697:	ff d0                	call   *%rax
+	return r;
+  803699:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80369c:	48 83 c4 40          	add    $0x40,%rsp
+  8036a0:	5b                   	pop    %rbx
+  8036a1:	41 5f                	pop    %r15
+  8036a3:	5d                   	pop    %rbp
+  8036a4:	c3                   	ret
+
+00000000008036a5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8036a5:	55                   	push   %rbp
+  8036a6:	48 89 e5             	mov    %rsp,%rbp
+  8036a9:	41 57                	push   %r15
+  8036ab:	53                   	push   %rbx
+  8036ac:	48 83 ec 40          	sub    $0x40,%rsp
+  8036b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036b0 <read+0xb>
+  8036b7:	49 bb 80 59 00 00 00 	movabs $0x5980,%r11
+  8036be:	00 00 00 
+  8036c1:	4c 01 db             	add    %r11,%rbx
+  8036c4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8036c7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8036cb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8036cf:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8036d3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8036d6:	48 89 d6             	mov    %rdx,%rsi
+  8036d9:	89 c7                	mov    %eax,%edi
+  8036db:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  8036e2:	ff ff ff 
+  8036e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036e9:	ff d0                	call   *%rax
+  8036eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8036ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036f2:	78 28                	js     80371c <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8036f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036f8:	8b 00                	mov    (%rax),%eax
+  8036fa:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8036fe:	48 89 d6             	mov    %rdx,%rsi
+  803701:	89 c7                	mov    %eax,%edi
+  803703:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  80370a:	ff ff ff 
+  80370d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803711:	ff d0                	call   *%rax
+  803713:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803716:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80371a:	79 08                	jns    803724 <read+0x7f>
+		return r;
+  80371c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80371f:	e9 8b 00 00 00       	jmp    8037af <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803724:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803728:	8b 40 08             	mov    0x8(%rax),%eax
+  80372b:	83 e0 03             	and    $0x3,%eax
+  80372e:	83 f8 01             	cmp    $0x1,%eax
+  803731:	75 4b                	jne    80377e <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803733:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80373a:	ff ff ff 
+  80373d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803741:	48 8b 00             	mov    (%rax),%rax
+  803744:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80374a:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80374d:	89 c6                	mov    %eax,%esi
+  80374f:	48 b8 4f e0 ff ff ff 	movabs $0xffffffffffffe04f,%rax
+  803756:	ff ff ff 
+  803759:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80375d:	48 89 c7             	mov    %rax,%rdi
+  803760:	49 89 df             	mov    %rbx,%r15
+  803763:	b8 00 00 00 00       	mov    $0x0,%eax
+  803768:	48 b9 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%rcx
+  80376f:	ff ff ff 
+  803772:	48 01 d9             	add    %rbx,%rcx
+  803775:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803777:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80377c:	eb 31                	jmp    8037af <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80377e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803782:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803786:	48 85 c0             	test   %rax,%rax
+  803789:	75 07                	jne    803792 <read+0xed>
+		return -E_NOT_SUPP;
+  80378b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803790:	eb 1d                	jmp    8037af <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803792:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803796:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80379a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80379e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8037a2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8037a6:	48 89 ce             	mov    %rcx,%rsi
+  8037a9:	48 89 c7             	mov    %rax,%rdi
+  8037ac:	41 ff d0             	call   *%r8
+}
+  8037af:	48 83 c4 40          	add    $0x40,%rsp
+  8037b3:	5b                   	pop    %rbx
+  8037b4:	41 5f                	pop    %r15
+  8037b6:	5d                   	pop    %rbp
+  8037b7:	c3                   	ret
+
+00000000008037b8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8037b8:	55                   	push   %rbp
+  8037b9:	48 89 e5             	mov    %rsp,%rbp
+  8037bc:	53                   	push   %rbx
+  8037bd:	48 83 ec 38          	sub    $0x38,%rsp
+  8037c1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037c1 <readn+0x9>
+  8037c8:	49 bb 6f 58 00 00 00 	movabs $0x586f,%r11
+  8037cf:	00 00 00 
+  8037d2:	4c 01 db             	add    %r11,%rbx
+  8037d5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8037d8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8037dc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8037e0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8037e7:	eb 4b                	jmp    803834 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8037e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037ec:	48 98                	cltq
+  8037ee:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8037f2:	48 29 c2             	sub    %rax,%rdx
+  8037f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037f8:	48 63 c8             	movslq %eax,%rcx
+  8037fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037ff:	48 01 c1             	add    %rax,%rcx
+  803802:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803805:	48 89 ce             	mov    %rcx,%rsi
+  803808:	89 c7                	mov    %eax,%edi
+  80380a:	48 b8 75 a6 ff ff ff 	movabs $0xffffffffffffa675,%rax
+  803811:	ff ff ff 
+  803814:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803818:	ff d0                	call   *%rax
+  80381a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80381d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803821:	79 05                	jns    803828 <readn+0x70>
+			return m;
+  803823:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803826:	eb 1d                	jmp    803845 <readn+0x8d>
+		if (m == 0)
+  803828:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80382c:	74 13                	je     803841 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80382e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803831:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803834:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803837:	48 98                	cltq
+  803839:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80383d:	72 aa                	jb     8037e9 <readn+0x31>
+  80383f:	eb 01                	jmp    803842 <readn+0x8a>
+			break;
+  803841:	90                   	nop
+	}
+	return tot;
+  803842:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803845:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803849:	c9                   	leave
+  80384a:	c3                   	ret
+
+000000000080384b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80384b:	55                   	push   %rbp
+  80384c:	48 89 e5             	mov    %rsp,%rbp
+  80384f:	41 57                	push   %r15
+  803851:	53                   	push   %rbx
+  803852:	48 83 ec 40          	sub    $0x40,%rsp
+  803856:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803856 <write+0xb>
+  80385d:	49 bb da 57 00 00 00 	movabs $0x57da,%r11
+  803864:	00 00 00 
+  803867:	4c 01 db             	add    %r11,%rbx
+  80386a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80386d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803871:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803875:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803879:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80387c:	48 89 d6             	mov    %rdx,%rsi
+  80387f:	89 c7                	mov    %eax,%edi
+  803881:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  803888:	ff ff ff 
+  80388b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80388f:	ff d0                	call   *%rax
+  803891:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803894:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803898:	78 28                	js     8038c2 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80389a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80389e:	8b 00                	mov    (%rax),%eax
+  8038a0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8038a4:	48 89 d6             	mov    %rdx,%rsi
+  8038a7:	89 c7                	mov    %eax,%edi
+  8038a9:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  8038b0:	ff ff ff 
+  8038b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038b7:	ff d0                	call   *%rax
+  8038b9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038c0:	79 08                	jns    8038ca <write+0x7f>
+		return r;
+  8038c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038c5:	e9 8a 00 00 00       	jmp    803954 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8038ce:	8b 40 08             	mov    0x8(%rax),%eax
+  8038d1:	83 e0 03             	and    $0x3,%eax
+  8038d4:	85 c0                	test   %eax,%eax
+  8038d6:	75 4b                	jne    803923 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8038d8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8038df:	ff ff ff 
+  8038e2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8038e6:	48 8b 00             	mov    (%rax),%rax
+  8038e9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8038ef:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8038f2:	89 c6                	mov    %eax,%esi
+  8038f4:	48 b8 6b e0 ff ff ff 	movabs $0xffffffffffffe06b,%rax
+  8038fb:	ff ff ff 
+  8038fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803902:	48 89 c7             	mov    %rax,%rdi
+  803905:	49 89 df             	mov    %rbx,%r15
+  803908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80390d:	48 b9 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%rcx
+  803914:	ff ff ff 
+  803917:	48 01 d9             	add    %rbx,%rcx
+  80391a:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80391c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803921:	eb 31                	jmp    803954 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803923:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803927:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80392b:	48 85 c0             	test   %rax,%rax
+  80392e:	75 07                	jne    803937 <write+0xec>
+		return -E_NOT_SUPP;
+  803930:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803935:	eb 1d                	jmp    803954 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803937:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80393b:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80393f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803943:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803947:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80394b:	48 89 ce             	mov    %rcx,%rsi
+  80394e:	48 89 c7             	mov    %rax,%rdi
+  803951:	41 ff d0             	call   *%r8
+}
+  803954:	48 83 c4 40          	add    $0x40,%rsp
+  803958:	5b                   	pop    %rbx
+  803959:	41 5f                	pop    %r15
+  80395b:	5d                   	pop    %rbp
+  80395c:	c3                   	ret
+
+000000000080395d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80395d:	55                   	push   %rbp
+  80395e:	48 89 e5             	mov    %rsp,%rbp
+  803961:	48 83 ec 18          	sub    $0x18,%rsp
+  803965:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803965 <seek+0x8>
+  80396c:	49 bb cb 56 00 00 00 	movabs $0x56cb,%r11
+  803973:	00 00 00 
+  803976:	4c 01 d8             	add    %r11,%rax
+  803979:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80397c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80397f:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803983:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803986:	48 89 ce             	mov    %rcx,%rsi
+  803989:	89 d7                	mov    %edx,%edi
+  80398b:	48 ba 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rdx
+  803992:	ff ff ff 
+  803995:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803999:	ff d0                	call   *%rax
+  80399b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80399e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039a2:	79 05                	jns    8039a9 <seek+0x4c>
+		return r;
+  8039a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039a7:	eb 0f                	jmp    8039b8 <seek+0x5b>
+	fd->fd_offset = offset;
+  8039a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039ad:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8039b0:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8039b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039b8:	c9                   	leave
+  8039b9:	c3                   	ret
+
+00000000008039ba <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8039ba:	55                   	push   %rbp
+  8039bb:	48 89 e5             	mov    %rsp,%rbp
+  8039be:	41 57                	push   %r15
+  8039c0:	53                   	push   %rbx
+  8039c1:	48 83 ec 30          	sub    $0x30,%rsp
+  8039c5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039c5 <ftruncate+0xb>
+  8039cc:	49 bb 6b 56 00 00 00 	movabs $0x566b,%r11
+  8039d3:	00 00 00 
+  8039d6:	4c 01 db             	add    %r11,%rbx
+  8039d9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8039dc:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8039df:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8039e3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8039e6:	48 89 d6             	mov    %rdx,%rsi
+  8039e9:	89 c7                	mov    %eax,%edi
+  8039eb:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  8039f2:	ff ff ff 
+  8039f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039f9:	ff d0                	call   *%rax
+  8039fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a02:	78 28                	js     803a2c <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803a04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a08:	8b 00                	mov    (%rax),%eax
+  803a0a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803a0e:	48 89 d6             	mov    %rdx,%rsi
+  803a11:	89 c7                	mov    %eax,%edi
+  803a13:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  803a1a:	ff ff ff 
+  803a1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a21:	ff d0                	call   *%rax
+  803a23:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a26:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a2a:	79 08                	jns    803a34 <ftruncate+0x7a>
+		return r;
+  803a2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a2f:	e9 83 00 00 00       	jmp    803ab7 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803a34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a38:	8b 40 08             	mov    0x8(%rax),%eax
+  803a3b:	83 e0 03             	and    $0x3,%eax
+  803a3e:	85 c0                	test   %eax,%eax
+  803a40:	75 4b                	jne    803a8d <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803a42:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803a49:	ff ff ff 
+  803a4c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a50:	48 8b 00             	mov    (%rax),%rax
+  803a53:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803a59:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803a5c:	89 c6                	mov    %eax,%esi
+  803a5e:	48 b8 88 e0 ff ff ff 	movabs $0xffffffffffffe088,%rax
+  803a65:	ff ff ff 
+  803a68:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a6c:	48 89 c7             	mov    %rax,%rdi
+  803a6f:	49 89 df             	mov    %rbx,%r15
+  803a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a77:	48 b9 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%rcx
+  803a7e:	ff ff ff 
+  803a81:	48 01 d9             	add    %rbx,%rcx
+  803a84:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803a86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a8b:	eb 2a                	jmp    803ab7 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803a8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a91:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803a95:	48 85 c0             	test   %rax,%rax
+  803a98:	75 07                	jne    803aa1 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803a9a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803a9f:	eb 16                	jmp    803ab7 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803aa1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803aa5:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803aa9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803aad:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803ab0:	89 d6                	mov    %edx,%esi
+  803ab2:	48 89 c7             	mov    %rax,%rdi
+  803ab5:	ff d1                	call   *%rcx
+}
+  803ab7:	48 83 c4 30          	add    $0x30,%rsp
+  803abb:	5b                   	pop    %rbx
+  803abc:	41 5f                	pop    %r15
+  803abe:	5d                   	pop    %rbp
+  803abf:	c3                   	ret
+
+0000000000803ac0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803ac0:	55                   	push   %rbp
+  803ac1:	48 89 e5             	mov    %rsp,%rbp
+  803ac4:	53                   	push   %rbx
+  803ac5:	48 83 ec 38          	sub    $0x38,%rsp
+  803ac9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ac9 <fstat+0x9>
+  803ad0:	49 bb 67 55 00 00 00 	movabs $0x5567,%r11
+  803ad7:	00 00 00 
+  803ada:	4c 01 db             	add    %r11,%rbx
+  803add:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803ae0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803ae4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803ae8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803aeb:	48 89 d6             	mov    %rdx,%rsi
+  803aee:	89 c7                	mov    %eax,%edi
+  803af0:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  803af7:	ff ff ff 
+  803afa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803afe:	ff d0                	call   *%rax
+  803b00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b03:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b07:	78 28                	js     803b31 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b0d:	8b 00                	mov    (%rax),%eax
+  803b0f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803b13:	48 89 d6             	mov    %rdx,%rsi
+  803b16:	89 c7                	mov    %eax,%edi
+  803b18:	48 b8 d4 a2 ff ff ff 	movabs $0xffffffffffffa2d4,%rax
+  803b1f:	ff ff ff 
+  803b22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b26:	ff d0                	call   *%rax
+  803b28:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b2b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b2f:	79 05                	jns    803b36 <fstat+0x76>
+		return r;
+  803b31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b34:	eb 5e                	jmp    803b94 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803b36:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b3a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803b3e:	48 85 c0             	test   %rax,%rax
+  803b41:	75 07                	jne    803b4a <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803b43:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803b48:	eb 4a                	jmp    803b94 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803b4a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b4e:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803b51:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b55:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803b5c:	00 00 00 
+	stat->st_isdir = 0;
+  803b5f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b63:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803b6a:	00 00 00 
+	stat->st_dev = dev;
+  803b6d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b71:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b75:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  803b7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b80:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803b84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b8c:	48 89 d6             	mov    %rdx,%rsi
+  803b8f:	48 89 c7             	mov    %rax,%rdi
+  803b92:	ff d1                	call   *%rcx
+}
+  803b94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b98:	c9                   	leave
+  803b99:	c3                   	ret
+
+0000000000803b9a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803b9a:	55                   	push   %rbp
+  803b9b:	48 89 e5             	mov    %rsp,%rbp
+  803b9e:	41 57                	push   %r15
+  803ba0:	53                   	push   %rbx
+  803ba1:	48 83 ec 20          	sub    $0x20,%rsp
+  803ba5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ba5 <stat+0xb>
+  803bac:	49 bb 8b 54 00 00 00 	movabs $0x548b,%r11
+  803bb3:	00 00 00 
+  803bb6:	4c 01 db             	add    %r11,%rbx
+  803bb9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803bbd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803bc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bc5:	be 00 00 00 00       	mov    $0x0,%esi
+  803bca:	48 89 c7             	mov    %rax,%rdi
+  803bcd:	49 89 df             	mov    %rbx,%r15
+  803bd0:	48 b8 44 ae ff ff ff 	movabs $0xffffffffffffae44,%rax
+  803bd7:	ff ff ff 
+  803bda:	48 01 d8             	add    %rbx,%rax
+  803bdd:	ff d0                	call   *%rax
+  803bdf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803be2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803be6:	79 05                	jns    803bed <stat+0x53>
+		return fd;
+  803be8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803beb:	eb 37                	jmp    803c24 <stat+0x8a>
+	r = fstat(fd, stat);
+  803bed:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803bf1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bf4:	48 89 d6             	mov    %rdx,%rsi
+  803bf7:	89 c7                	mov    %eax,%edi
+  803bf9:	48 b8 90 aa ff ff ff 	movabs $0xffffffffffffaa90,%rax
+  803c00:	ff ff ff 
+  803c03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c07:	ff d0                	call   *%rax
+  803c09:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803c0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c0f:	89 c7                	mov    %eax,%edi
+  803c11:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  803c18:	ff ff ff 
+  803c1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c1f:	ff d0                	call   *%rax
+	return r;
+  803c21:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803c24:	48 83 c4 20          	add    $0x20,%rsp
+  803c28:	5b                   	pop    %rbx
+  803c29:	41 5f                	pop    %r15
+  803c2b:	5d                   	pop    %rbp
+  803c2c:	c3                   	ret
+
+0000000000803c2d <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803c2d:	55                   	push   %rbp
+  803c2e:	48 89 e5             	mov    %rsp,%rbp
+  803c31:	41 57                	push   %r15
+  803c33:	53                   	push   %rbx
+  803c34:	48 83 ec 10          	sub    $0x10,%rsp
+  803c38:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c38 <fsipc+0xb>
+  803c3f:	49 bb f8 53 00 00 00 	movabs $0x53f8,%r11
+  803c46:	00 00 00 
+  803c49:	4c 01 db             	add    %r11,%rbx
+  803c4c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803c4f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803c53:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803c5a:	00 00 00 
+  803c5d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803c60:	85 c0                	test   %eax,%eax
+  803c62:	75 24                	jne    803c88 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803c64:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c69:	49 89 df             	mov    %rbx,%r15
+  803c6c:	48 b8 e2 d9 ff ff ff 	movabs $0xffffffffffffd9e2,%rax
+  803c73:	ff ff ff 
+  803c76:	48 01 d8             	add    %rbx,%rax
+  803c79:	ff d0                	call   *%rax
+  803c7b:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803c82:	00 00 00 
+  803c85:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803c88:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803c8f:	00 00 00 
+  803c92:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803c95:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c99:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803c9c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803ca2:	49 89 d0             	mov    %rdx,%r8
+  803ca5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803caa:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803cb1:	00 00 00 
+  803cb4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803cb8:	89 c7                	mov    %eax,%edi
+  803cba:	49 89 df             	mov    %rbx,%r15
+  803cbd:	48 b8 01 d4 ff ff ff 	movabs $0xffffffffffffd401,%rax
+  803cc4:	ff ff ff 
+  803cc7:	48 01 d8             	add    %rbx,%rax
+  803cca:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803ccc:	48 83 c4 10          	add    $0x10,%rsp
+  803cd0:	5b                   	pop    %rbx
+  803cd1:	41 5f                	pop    %r15
+  803cd3:	5d                   	pop    %rbp
+  803cd4:	c3                   	ret
+
+0000000000803cd5 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803cd5:	55                   	push   %rbp
+  803cd6:	48 89 e5             	mov    %rsp,%rbp
+  803cd9:	41 57                	push   %r15
+  803cdb:	53                   	push   %rbx
+  803cdc:	48 83 ec 20          	sub    $0x20,%rsp
+  803ce0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ce0 <fsipc_words+0xb>
+  803ce7:	49 bb 50 53 00 00 00 	movabs $0x5350,%r11
+  803cee:	00 00 00 
+  803cf1:	4c 01 db             	add    %r11,%rbx
+  803cf4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803cf7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803cfb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803cff:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803d06:	00 00 00 
+  803d09:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803d0c:	85 c0                	test   %eax,%eax
+  803d0e:	75 24                	jne    803d34 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803d10:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d15:	49 89 df             	mov    %rbx,%r15
+  803d18:	48 b8 e2 d9 ff ff ff 	movabs $0xffffffffffffd9e2,%rax
+  803d1f:	ff ff ff 
+  803d22:	48 01 d8             	add    %rbx,%rax
+  803d25:	ff d0                	call   *%rax
+  803d27:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803d2e:	00 00 00 
+  803d31:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803d34:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803d3b:	00 00 00 
+  803d3e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803d41:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803d45:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d49:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803d4c:	89 c7                	mov    %eax,%edi
+  803d4e:	49 89 df             	mov    %rbx,%r15
+  803d51:	48 b8 ec d4 ff ff ff 	movabs $0xffffffffffffd4ec,%rax
+  803d58:	ff ff ff 
+  803d5b:	48 01 d8             	add    %rbx,%rax
+  803d5e:	ff d0                	call   *%rax
+}
+  803d60:	48 83 c4 20          	add    $0x20,%rsp
+  803d64:	5b                   	pop    %rbx
+  803d65:	41 5f                	pop    %r15
+  803d67:	5d                   	pop    %rbp
+  803d68:	c3                   	ret
+
+0000000000803d69 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803d69:	55                   	push   %rbp
+  803d6a:	48 89 e5             	mov    %rsp,%rbp
+  803d6d:	41 57                	push   %r15
+  803d6f:	53                   	push   %rbx
+  803d70:	48 83 ec 40          	sub    $0x40,%rsp
+  803d74:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d74 <fsipc_pages+0xb>
+  803d7b:	49 bb bc 52 00 00 00 	movabs $0x52bc,%r11
+  803d82:	00 00 00 
+  803d85:	4c 01 db             	add    %r11,%rbx
+  803d88:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803d8b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d8f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803d93:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803d96:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803d9d:	00 00 00 
+  803da0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803da3:	85 c0                	test   %eax,%eax
+  803da5:	75 24                	jne    803dcb <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803da7:	bf 01 00 00 00       	mov    $0x1,%edi
+  803dac:	49 89 df             	mov    %rbx,%r15
+  803daf:	48 b8 e2 d9 ff ff ff 	movabs $0xffffffffffffd9e2,%rax
+  803db6:	ff ff ff 
+  803db9:	48 01 d8             	add    %rbx,%rax
+  803dbc:	ff d0                	call   *%rax
+  803dbe:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803dc5:	00 00 00 
+  803dc8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803dcb:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803dd0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803dd4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803dd7:	48 98                	cltq
+  803dd9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  803ddd:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803de1:	0f 95 c0             	setne  %al
+  803de4:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803de7:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803dee:	00 
+  803def:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803df3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803df7:	48 01 d0             	add    %rdx,%rax
+  803dfa:	48 83 e8 01          	sub    $0x1,%rax
+  803dfe:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803e02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e06:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e0b:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803e0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e13:	48 29 d0             	sub    %rdx,%rax
+  803e16:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803e1a:	41 89 c2             	mov    %eax,%r10d
+  803e1d:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803e24:	00 00 00 
+  803e27:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803e2a:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  803e2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803e32:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803e35:	48 83 ec 08          	sub    $0x8,%rsp
+  803e39:	6a 40                	push   $0x40
+  803e3b:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803e40:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803e47:	00 
+  803e48:	6a 05                	push   $0x5
+  803e4a:	41 89 f9             	mov    %edi,%r9d
+  803e4d:	49 89 c8             	mov    %rcx,%r8
+  803e50:	44 89 d1             	mov    %r10d,%ecx
+  803e53:	89 c7                	mov    %eax,%edi
+  803e55:	49 89 df             	mov    %rbx,%r15
+  803e58:	48 b8 ea d5 ff ff ff 	movabs $0xffffffffffffd5ea,%rax
+  803e5f:	ff ff ff 
+  803e62:	48 01 d8             	add    %rbx,%rax
+  803e65:	ff d0                	call   *%rax
+  803e67:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  803e6b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803e6f:	5b                   	pop    %rbx
+  803e70:	41 5f                	pop    %r15
+  803e72:	5d                   	pop    %rbp
+  803e73:	c3                   	ret
+
+0000000000803e74 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  803e74:	55                   	push   %rbp
+  803e75:	48 89 e5             	mov    %rsp,%rbp
+  803e78:	41 57                	push   %r15
+  803e7a:	53                   	push   %rbx
+  803e7b:	48 83 ec 20          	sub    $0x20,%rsp
+  803e7f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e7f <open+0xb>
+  803e86:	49 bb b1 51 00 00 00 	movabs $0x51b1,%r11
+  803e8d:	00 00 00 
+  803e90:	4c 01 db             	add    %r11,%rbx
+  803e93:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803e97:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  803e9a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e9e:	48 89 c7             	mov    %rax,%rdi
+  803ea1:	49 89 df             	mov    %rbx,%r15
+  803ea4:	48 b8 ba 87 ff ff ff 	movabs $0xffffffffffff87ba,%rax
+  803eab:	ff ff ff 
+  803eae:	48 01 d8             	add    %rbx,%rax
+  803eb1:	ff d0                	call   *%rax
+  803eb3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803eb8:	7e 0a                	jle    803ec4 <open+0x50>
+		return -E_BAD_PATH;
+  803eba:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803ebf:	e9 18 01 00 00       	jmp    803fdc <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803ec4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803ec8:	48 89 c7             	mov    %rax,%rdi
+  803ecb:	49 89 df             	mov    %rbx,%r15
+  803ece:	48 b8 78 a0 ff ff ff 	movabs $0xffffffffffffa078,%rax
+  803ed5:	ff ff ff 
+  803ed8:	48 01 d8             	add    %rbx,%rax
+  803edb:	ff d0                	call   *%rax
+  803edd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ee0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ee4:	74 08                	je     803eee <open+0x7a>
+		return r;
+  803ee6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ee9:	e9 ee 00 00 00       	jmp    803fdc <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  803eee:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803ef5:	00 00 00 
+  803ef8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803efb:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  803f02:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f06:	48 89 c6             	mov    %rax,%rsi
+  803f09:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803f10:	00 00 00 
+  803f13:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f17:	48 89 c7             	mov    %rax,%rdi
+  803f1a:	49 89 df             	mov    %rbx,%r15
+  803f1d:	48 b8 4e 88 ff ff ff 	movabs $0xffffffffffff884e,%rax
+  803f24:	ff ff ff 
+  803f27:	48 01 d8             	add    %rbx,%rax
+  803f2a:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803f2c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f30:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803f35:	48 89 c6             	mov    %rax,%rsi
+  803f38:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f3d:	49 89 df             	mov    %rbx,%r15
+  803f40:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  803f47:	ff ff ff 
+  803f4a:	48 01 d8             	add    %rbx,%rax
+  803f4d:	ff d0                	call   *%rax
+  803f4f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f52:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f56:	74 23                	je     803f7b <open+0x107>
+		fd_close(fd,0);
+  803f58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f5c:	be 00 00 00 00       	mov    $0x0,%esi
+  803f61:	48 89 c7             	mov    %rax,%rdi
+  803f64:	49 89 df             	mov    %rbx,%r15
+  803f67:	48 b8 d9 a1 ff ff ff 	movabs $0xffffffffffffa1d9,%rax
+  803f6e:	ff ff ff 
+  803f71:	48 01 d8             	add    %rbx,%rax
+  803f74:	ff d0                	call   *%rax
+		return r;
+  803f76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f79:	eb 61                	jmp    803fdc <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  803f7b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f7f:	48 89 c6             	mov    %rax,%rsi
+  803f82:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f87:	48 b8 fd ab ff ff ff 	movabs $0xffffffffffffabfd,%rax
+  803f8e:	ff ff ff 
+  803f91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f95:	ff d0                	call   *%rax
+  803f97:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f9a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f9e:	74 23                	je     803fc3 <open+0x14f>
+		fd_close(fd,0);
+  803fa0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fa4:	be 00 00 00 00       	mov    $0x0,%esi
+  803fa9:	48 89 c7             	mov    %rax,%rdi
+  803fac:	49 89 df             	mov    %rbx,%r15
+  803faf:	48 b8 d9 a1 ff ff ff 	movabs $0xffffffffffffa1d9,%rax
+  803fb6:	ff ff ff 
+  803fb9:	48 01 d8             	add    %rbx,%rax
+  803fbc:	ff d0                	call   *%rax
+		return r;
+  803fbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fc1:	eb 19                	jmp    803fdc <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803fc3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fc7:	48 89 c7             	mov    %rax,%rdi
+  803fca:	49 89 df             	mov    %rbx,%r15
+  803fcd:	48 b8 fe 9f ff ff ff 	movabs $0xffffffffffff9ffe,%rax
+  803fd4:	ff ff ff 
+  803fd7:	48 01 d8             	add    %rbx,%rax
+  803fda:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  803fdc:	48 83 c4 20          	add    $0x20,%rsp
+  803fe0:	5b                   	pop    %rbx
+  803fe1:	41 5f                	pop    %r15
+  803fe3:	5d                   	pop    %rbp
+  803fe4:	c3                   	ret
+
+0000000000803fe5 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803fe5:	55                   	push   %rbp
+  803fe6:	48 89 e5             	mov    %rsp,%rbp
+  803fe9:	48 83 ec 20          	sub    $0x20,%rsp
+  803fed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803fed <devfile_flush+0x8>
+  803ff4:	49 bb 43 50 00 00 00 	movabs $0x5043,%r11
+  803ffb:	00 00 00 
+  803ffe:	4c 01 d8             	add    %r11,%rax
+  804001:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804005:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804009:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80400c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  80400f:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804013:	ba 04 00 00 00       	mov    $0x4,%edx
+  804018:	48 89 ce             	mov    %rcx,%rsi
+  80401b:	bf 06 00 00 00       	mov    $0x6,%edi
+  804020:	48 b9 a5 ac ff ff ff 	movabs $0xffffffffffffaca5,%rcx
+  804027:	ff ff ff 
+  80402a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80402e:	ff d0                	call   *%rax
+}
+  804030:	c9                   	leave
+  804031:	c3                   	ret
+
+0000000000804032 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804032:	55                   	push   %rbp
+  804033:	48 89 e5             	mov    %rsp,%rbp
+  804036:	41 57                	push   %r15
+  804038:	53                   	push   %rbx
+  804039:	48 83 ec 60          	sub    $0x60,%rsp
+  80403d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80403d <devfile_read+0xb>
+  804044:	49 bb f3 4f 00 00 00 	movabs $0x4ff3,%r11
+  80404b:	00 00 00 
+  80404e:	4c 01 db             	add    %r11,%rbx
+  804051:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804055:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804059:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80405d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804061:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804065:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804069:	8b 50 0c             	mov    0xc(%rax),%edx
+  80406c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804070:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804072:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804076:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80407a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  80407e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804082:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804087:	ba 10 00 00 00       	mov    $0x10,%edx
+  80408c:	48 89 c6             	mov    %rax,%rsi
+  80408f:	bf 03 00 00 00       	mov    $0x3,%edi
+  804094:	48 b8 39 ad ff ff ff 	movabs $0xffffffffffffad39,%rax
+  80409b:	ff ff ff 
+  80409e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040a2:	ff d0                	call   *%rax
+  8040a4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8040a7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8040ab:	79 05                	jns    8040b2 <devfile_read+0x80>
+		return r;
+  8040ad:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8040b0:	eb 64                	jmp    804116 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8040b2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8040b5:	48 63 d0             	movslq %eax,%rdx
+  8040b8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8040bc:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8040c1:	48 01 c1             	add    %rax,%rcx
+  8040c4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8040c8:	48 89 ce             	mov    %rcx,%rsi
+  8040cb:	48 89 c7             	mov    %rax,%rdi
+  8040ce:	49 89 df             	mov    %rbx,%r15
+  8040d1:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  8040d8:	ff ff ff 
+  8040db:	48 01 d8             	add    %rbx,%rax
+  8040de:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8040e0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8040e7:	ff ff ff 
+  8040ea:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8040ee:	48 8b 00             	mov    (%rax),%rax
+  8040f1:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8040f7:	89 c6                	mov    %eax,%esi
+  8040f9:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8040fe:	48 89 c7             	mov    %rax,%rdi
+  804101:	49 89 df             	mov    %rbx,%r15
+  804104:	48 b8 9c d9 ff ff ff 	movabs $0xffffffffffffd99c,%rax
+  80410b:	ff ff ff 
+  80410e:	48 01 d8             	add    %rbx,%rax
+  804111:	ff d0                	call   *%rax
+	return r;
+  804113:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804116:	48 83 c4 60          	add    $0x60,%rsp
+  80411a:	5b                   	pop    %rbx
+  80411b:	41 5f                	pop    %r15
+  80411d:	5d                   	pop    %rbp
+  80411e:	c3                   	ret
+
+000000000080411f <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80411f:	55                   	push   %rbp
+  804120:	48 89 e5             	mov    %rsp,%rbp
+  804123:	41 57                	push   %r15
+  804125:	53                   	push   %rbx
+  804126:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  80412a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80412a <devfile_write+0xb>
+  804131:	49 bb 06 4f 00 00 00 	movabs $0x4f06,%r11
+  804138:	00 00 00 
+  80413b:	4c 01 db             	add    %r11,%rbx
+  80413e:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804142:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804146:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  80414d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804151:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804155:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  80415c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804160:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804167:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80416a:	48 63 d0             	movslq %eax,%rdx
+  80416d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804171:	48 39 c2             	cmp    %rax,%rdx
+  804174:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804178:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80417f:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804186:	00 
+  804187:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80418e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804192:	48 01 d0             	add    %rdx,%rax
+  804195:	48 83 e8 01          	sub    $0x1,%rax
+  804199:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80419d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041a6:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8041aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041ae:	48 29 d0             	sub    %rdx,%rax
+  8041b1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8041b5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8041b8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8041bb:	89 c6                	mov    %eax,%esi
+  8041bd:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8041c2:	48 89 c7             	mov    %rax,%rdi
+  8041c5:	49 89 df             	mov    %rbx,%r15
+  8041c8:	48 b8 56 d9 ff ff ff 	movabs $0xffffffffffffd956,%rax
+  8041cf:	ff ff ff 
+  8041d2:	48 01 d8             	add    %rbx,%rax
+  8041d5:	ff d0                	call   *%rax
+  8041d7:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8041da:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8041de:	79 08                	jns    8041e8 <devfile_write+0xc9>
+		return r;
+  8041e0:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8041e3:	e9 8f 00 00 00       	jmp    804277 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8041e8:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8041ef:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8041f3:	48 89 c6             	mov    %rax,%rsi
+  8041f6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8041fb:	48 89 c7             	mov    %rax,%rdi
+  8041fe:	49 89 df             	mov    %rbx,%r15
+  804201:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  804208:	ff ff ff 
+  80420b:	48 01 d8             	add    %rbx,%rax
+  80420e:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804210:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804214:	8b 50 0c             	mov    0xc(%rax),%edx
+  804217:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80421b:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80421d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804221:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804228:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  80422c:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80422f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804233:	89 d1                	mov    %edx,%ecx
+  804235:	ba 10 00 00 00       	mov    $0x10,%edx
+  80423a:	48 89 c6             	mov    %rax,%rsi
+  80423d:	bf 04 00 00 00       	mov    $0x4,%edi
+  804242:	48 b8 39 ad ff ff ff 	movabs $0xffffffffffffad39,%rax
+  804249:	ff ff ff 
+  80424c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804250:	ff d0                	call   *%rax
+  804252:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804255:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804258:	89 c6                	mov    %eax,%esi
+  80425a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80425f:	48 89 c7             	mov    %rax,%rdi
+  804262:	49 89 df             	mov    %rbx,%r15
+  804265:	48 b8 9c d9 ff ff ff 	movabs $0xffffffffffffd99c,%rax
+  80426c:	ff ff ff 
+  80426f:	48 01 d8             	add    %rbx,%rax
+  804272:	ff d0                	call   *%rax
+	return r;
+  804274:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804277:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  80427b:	5b                   	pop    %rbx
+  80427c:	41 5f                	pop    %r15
+  80427e:	5d                   	pop    %rbp
+  80427f:	c3                   	ret
+
+0000000000804280 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804280:	55                   	push   %rbp
+  804281:	48 89 e5             	mov    %rsp,%rbp
+  804284:	41 57                	push   %r15
+  804286:	53                   	push   %rbx
+  804287:	48 83 ec 20          	sub    $0x20,%rsp
+  80428b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80428b <devfile_stat+0xb>
+  804292:	49 bb a5 4d 00 00 00 	movabs $0x4da5,%r11
+  804299:	00 00 00 
+  80429c:	4c 01 db             	add    %r11,%rbx
+  80429f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8042a3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8042a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042ab:	8b 40 0c             	mov    0xc(%rax),%eax
+  8042ae:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8042b5:	00 00 00 
+  8042b8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8042bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8042c0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8042c5:	48 b8 fd ab ff ff ff 	movabs $0xffffffffffffabfd,%rax
+  8042cc:	ff ff ff 
+  8042cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042d3:	ff d0                	call   *%rax
+  8042d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042dc:	79 05                	jns    8042e3 <devfile_stat+0x63>
+		return r;
+  8042de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042e1:	eb 65                	jmp    804348 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8042e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042e7:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8042ee:	00 00 00 
+  8042f1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8042f5:	48 89 d6             	mov    %rdx,%rsi
+  8042f8:	48 89 c7             	mov    %rax,%rdi
+  8042fb:	49 89 df             	mov    %rbx,%r15
+  8042fe:	48 b8 4e 88 ff ff ff 	movabs $0xffffffffffff884e,%rax
+  804305:	ff ff ff 
+  804308:	48 01 d8             	add    %rbx,%rax
+  80430b:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80430d:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  804314:	00 00 00 
+  804317:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  80431e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804322:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804328:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80432f:	00 00 00 
+  804332:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804339:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80433d:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804343:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804348:	48 83 c4 20          	add    $0x20,%rsp
+  80434c:	5b                   	pop    %rbx
+  80434d:	41 5f                	pop    %r15
+  80434f:	5d                   	pop    %rbp
+  804350:	c3                   	ret
+
+0000000000804351 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804351:	55                   	push   %rbp
+  804352:	48 89 e5             	mov    %rsp,%rbp
+  804355:	48 83 ec 20          	sub    $0x20,%rsp
+  804359:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804359 <devfile_trunc+0x8>
+  804360:	49 bb d7 4c 00 00 00 	movabs $0x4cd7,%r11
+  804367:	00 00 00 
+  80436a:	4c 01 d8             	add    %r11,%rax
+  80436d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804371:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804374:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804378:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80437b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  80437e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804381:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804384:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804388:	ba 08 00 00 00       	mov    $0x8,%edx
+  80438d:	48 89 ce             	mov    %rcx,%rsi
+  804390:	bf 02 00 00 00       	mov    $0x2,%edi
+  804395:	48 b9 a5 ac ff ff ff 	movabs $0xffffffffffffaca5,%rcx
+  80439c:	ff ff ff 
+  80439f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8043a3:	ff d0                	call   *%rax
+}
+  8043a5:	c9                   	leave
+  8043a6:	c3                   	ret
+
+00000000008043a7 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8043a7:	55                   	push   %rbp
+  8043a8:	48 89 e5             	mov    %rsp,%rbp
+  8043ab:	41 57                	push   %r15
+  8043ad:	53                   	push   %rbx
+  8043ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8043b2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043b2 <remove+0xb>
+  8043b9:	49 bb 7e 4c 00 00 00 	movabs $0x4c7e,%r11
+  8043c0:	00 00 00 
+  8043c3:	4c 01 db             	add    %r11,%rbx
+  8043c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8043ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043ce:	48 89 c7             	mov    %rax,%rdi
+  8043d1:	49 89 df             	mov    %rbx,%r15
+  8043d4:	48 b8 ba 87 ff ff ff 	movabs $0xffffffffffff87ba,%rax
+  8043db:	ff ff ff 
+  8043de:	48 01 d8             	add    %rbx,%rax
+  8043e1:	ff d0                	call   *%rax
+  8043e3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043e8:	7e 07                	jle    8043f1 <remove+0x4a>
+		return -E_BAD_PATH;
+  8043ea:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8043ef:	eb 44                	jmp    804435 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8043f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043f5:	48 89 c6             	mov    %rax,%rsi
+  8043f8:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  8043ff:	00 00 00 
+  804402:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804406:	48 89 c7             	mov    %rax,%rdi
+  804409:	49 89 df             	mov    %rbx,%r15
+  80440c:	48 b8 4e 88 ff ff ff 	movabs $0xffffffffffff884e,%rax
+  804413:	ff ff ff 
+  804416:	48 01 d8             	add    %rbx,%rax
+  804419:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  80441b:	be 00 00 00 00       	mov    $0x0,%esi
+  804420:	bf 07 00 00 00       	mov    $0x7,%edi
+  804425:	48 b8 fd ab ff ff ff 	movabs $0xffffffffffffabfd,%rax
+  80442c:	ff ff ff 
+  80442f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804433:	ff d0                	call   *%rax
+}
+  804435:	48 83 c4 10          	add    $0x10,%rsp
+  804439:	5b                   	pop    %rbx
+  80443a:	41 5f                	pop    %r15
+  80443c:	5d                   	pop    %rbp
+  80443d:	c3                   	ret
+
+000000000080443e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80443e:	55                   	push   %rbp
+  80443f:	48 89 e5             	mov    %rsp,%rbp
+  804442:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804442 <sync+0x4>
+  804449:	49 bb ee 4b 00 00 00 	movabs $0x4bee,%r11
+  804450:	00 00 00 
+  804453:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804456:	ba 00 00 00 00       	mov    $0x0,%edx
+  80445b:	be 00 00 00 00       	mov    $0x0,%esi
+  804460:	bf 08 00 00 00       	mov    $0x8,%edi
+  804465:	48 b9 a5 ac ff ff ff 	movabs $0xffffffffffffaca5,%rcx
+  80446c:	ff ff ff 
+  80446f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804473:	ff d0                	call   *%rax
+}
+  804475:	5d                   	pop    %rbp
+  804476:	c3                   	ret
+
+0000000000804477 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804477:	55                   	push   %rbp
+  804478:	48 89 e5             	mov    %rsp,%rbp
+  80447b:	41 57                	push   %r15
+  80447d:	53                   	push   %rbx
+  80447e:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804485:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804485 <copy+0xe>
+  80448c:	49 bb ab 4b 00 00 00 	movabs $0x4bab,%r11
+  804493:	00 00 00 
+  804496:	4c 01 db             	add    %r11,%rbx
+  804499:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8044a0:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8044a7:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8044ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8044b3:	48 89 c7             	mov    %rax,%rdi
+  8044b6:	48 b8 44 ae ff ff ff 	movabs $0xffffffffffffae44,%rax
+  8044bd:	ff ff ff 
+  8044c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044c4:	ff d0                	call   *%rax
+  8044c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8044c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044cd:	79 35                	jns    804504 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8044cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044d2:	89 c6                	mov    %eax,%esi
+  8044d4:	48 b8 ae e0 ff ff ff 	movabs $0xffffffffffffe0ae,%rax
+  8044db:	ff ff ff 
+  8044de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044e2:	48 89 c7             	mov    %rax,%rdi
+  8044e5:	49 89 df             	mov    %rbx,%r15
+  8044e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ed:	48 ba 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%rdx
+  8044f4:	ff ff ff 
+  8044f7:	48 01 da             	add    %rbx,%rdx
+  8044fa:	ff d2                	call   *%rdx
+		return fd_src;
+  8044fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044ff:	e9 d7 01 00 00       	jmp    8046db <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804504:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  80450b:	be 01 01 00 00       	mov    $0x101,%esi
+  804510:	48 89 c7             	mov    %rax,%rdi
+  804513:	48 b8 44 ae ff ff ff 	movabs $0xffffffffffffae44,%rax
+  80451a:	ff ff ff 
+  80451d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804521:	ff d0                	call   *%rax
+  804523:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804526:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80452a:	0f 89 df 00 00 00    	jns    80460f <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804530:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804533:	89 c6                	mov    %eax,%esi
+  804535:	48 b8 c4 e0 ff ff ff 	movabs $0xffffffffffffe0c4,%rax
+  80453c:	ff ff ff 
+  80453f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804543:	48 89 c7             	mov    %rax,%rdi
+  804546:	49 89 df             	mov    %rbx,%r15
+  804549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80454e:	48 ba 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%rdx
+  804555:	ff ff ff 
+  804558:	48 01 da             	add    %rbx,%rdx
+  80455b:	ff d2                	call   *%rdx
+		close(fd_src);
+  80455d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804560:	89 c7                	mov    %eax,%edi
+  804562:	49 89 df             	mov    %rbx,%r15
+  804565:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  80456c:	ff ff ff 
+  80456f:	48 01 d8             	add    %rbx,%rax
+  804572:	ff d0                	call   *%rax
+		return fd_dest;
+  804574:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804577:	e9 5f 01 00 00       	jmp    8046db <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  80457c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80457f:	48 63 d0             	movslq %eax,%rdx
+  804582:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804589:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80458c:	48 89 ce             	mov    %rcx,%rsi
+  80458f:	89 c7                	mov    %eax,%edi
+  804591:	49 89 df             	mov    %rbx,%r15
+  804594:	48 b8 1b a8 ff ff ff 	movabs $0xffffffffffffa81b,%rax
+  80459b:	ff ff ff 
+  80459e:	48 01 d8             	add    %rbx,%rax
+  8045a1:	ff d0                	call   *%rax
+  8045a3:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8045a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8045aa:	79 63                	jns    80460f <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8045ac:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8045af:	89 c6                	mov    %eax,%esi
+  8045b1:	48 b8 de e0 ff ff ff 	movabs $0xffffffffffffe0de,%rax
+  8045b8:	ff ff ff 
+  8045bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045bf:	48 89 c7             	mov    %rax,%rdi
+  8045c2:	49 89 df             	mov    %rbx,%r15
+  8045c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ca:	48 ba 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%rdx
+  8045d1:	ff ff ff 
+  8045d4:	48 01 da             	add    %rbx,%rdx
+  8045d7:	ff d2                	call   *%rdx
+			close(fd_src);
+  8045d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045dc:	89 c7                	mov    %eax,%edi
+  8045de:	49 89 df             	mov    %rbx,%r15
+  8045e1:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  8045e8:	ff ff ff 
+  8045eb:	48 01 d8             	add    %rbx,%rax
+  8045ee:	ff d0                	call   *%rax
+			close(fd_dest);
+  8045f0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045f3:	89 c7                	mov    %eax,%edi
+  8045f5:	49 89 df             	mov    %rbx,%r15
+  8045f8:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  8045ff:	ff ff ff 
+  804602:	48 01 d8             	add    %rbx,%rax
+  804605:	ff d0                	call   *%rax
+			return write_size;
+  804607:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80460a:	e9 cc 00 00 00       	jmp    8046db <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  80460f:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804616:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804619:	ba 00 02 00 00       	mov    $0x200,%edx
+  80461e:	48 89 ce             	mov    %rcx,%rsi
+  804621:	89 c7                	mov    %eax,%edi
+  804623:	49 89 df             	mov    %rbx,%r15
+  804626:	48 b8 75 a6 ff ff ff 	movabs $0xffffffffffffa675,%rax
+  80462d:	ff ff ff 
+  804630:	48 01 d8             	add    %rbx,%rax
+  804633:	ff d0                	call   *%rax
+  804635:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804638:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80463c:	0f 8f 3a ff ff ff    	jg     80457c <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804642:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804646:	79 60                	jns    8046a8 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804648:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80464b:	89 c6                	mov    %eax,%esi
+  80464d:	48 b8 f1 e0 ff ff ff 	movabs $0xffffffffffffe0f1,%rax
+  804654:	ff ff ff 
+  804657:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80465b:	48 89 c7             	mov    %rax,%rdi
+  80465e:	49 89 df             	mov    %rbx,%r15
+  804661:	b8 00 00 00 00       	mov    $0x0,%eax
+  804666:	48 ba 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%rdx
+  80466d:	ff ff ff 
+  804670:	48 01 da             	add    %rbx,%rdx
+  804673:	ff d2                	call   *%rdx
+		close(fd_src);
+  804675:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804678:	89 c7                	mov    %eax,%edi
+  80467a:	49 89 df             	mov    %rbx,%r15
+  80467d:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  804684:	ff ff ff 
+  804687:	48 01 d8             	add    %rbx,%rax
+  80468a:	ff d0                	call   *%rax
+		close(fd_dest);
+  80468c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80468f:	89 c7                	mov    %eax,%edi
+  804691:	49 89 df             	mov    %rbx,%r15
+  804694:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  80469b:	ff ff ff 
+  80469e:	48 01 d8             	add    %rbx,%rax
+  8046a1:	ff d0                	call   *%rax
+		return read_size;
+  8046a3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8046a6:	eb 33                	jmp    8046db <copy+0x264>
+	}
+	close(fd_src);
+  8046a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046ab:	89 c7                	mov    %eax,%edi
+  8046ad:	49 89 df             	mov    %rbx,%r15
+  8046b0:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  8046b7:	ff ff ff 
+  8046ba:	48 01 d8             	add    %rbx,%rax
+  8046bd:	ff d0                	call   *%rax
+	close(fd_dest);
+  8046bf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8046c2:	89 c7                	mov    %eax,%edi
+  8046c4:	49 89 df             	mov    %rbx,%r15
+  8046c7:	48 b8 bd a3 ff ff ff 	movabs $0xffffffffffffa3bd,%rax
+  8046ce:	ff ff ff 
+  8046d1:	48 01 d8             	add    %rbx,%rax
+  8046d4:	ff d0                	call   *%rax
+	return 0;
+  8046d6:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8046db:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8046e2:	5b                   	pop    %rbx
+  8046e3:	41 5f                	pop    %r15
+  8046e5:	5d                   	pop    %rbp
+  8046e6:	c3                   	ret
+
+00000000008046e7 <writebuf>:
+};
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  8046e7:	55                   	push   %rbp
+  8046e8:	48 89 e5             	mov    %rsp,%rbp
+  8046eb:	41 57                	push   %r15
+  8046ed:	48 83 ec 28          	sub    $0x28,%rsp
+  8046f1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8046f1 <writebuf+0xa>
+  8046f8:	49 bb 3f 49 00 00 00 	movabs $0x493f,%r11
+  8046ff:	00 00 00 
+  804702:	4c 01 d8             	add    %r11,%rax
+  804705:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	if (b->error > 0) {
+  804709:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80470d:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804710:	85 d2                	test   %edx,%edx
+  804712:	7e 68                	jle    80477c <writebuf+0x95>
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  804714:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804718:	8b 52 04             	mov    0x4(%rdx),%edx
+  80471b:	48 63 d2             	movslq %edx,%rdx
+  80471e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804722:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  804726:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80472a:	8b 09                	mov    (%rcx),%ecx
+  80472c:	89 cf                	mov    %ecx,%edi
+  80472e:	49 89 c7             	mov    %rax,%r15
+  804731:	48 b9 1b a8 ff ff ff 	movabs $0xffffffffffffa81b,%rcx
+  804738:	ff ff ff 
+  80473b:	48 01 c1             	add    %rax,%rcx
+  80473e:	ff d1                	call   *%rcx
+  804740:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		if (result > 0)
+  804743:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804747:	7e 13                	jle    80475c <writebuf+0x75>
+			b->result += result;
+  804749:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80474d:	8b 50 08             	mov    0x8(%rax),%edx
+  804750:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804753:	01 c2                	add    %eax,%edx
+  804755:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804759:	89 50 08             	mov    %edx,0x8(%rax)
+		if (result != b->idx) // error, or wrote less than supplied
+  80475c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804760:	8b 40 04             	mov    0x4(%rax),%eax
+  804763:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804766:	74 14                	je     80477c <writebuf+0x95>
+			b->error = (result < 0 ? result : 0);
+  804768:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80476b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804770:	85 c0                	test   %eax,%eax
+  804772:	0f 4e d0             	cmovle %eax,%edx
+  804775:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804779:	89 50 0c             	mov    %edx,0xc(%rax)
+	}
+}
+  80477c:	90                   	nop
+  80477d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804781:	c9                   	leave
+  804782:	c3                   	ret
+
+0000000000804783 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  804783:	55                   	push   %rbp
+  804784:	48 89 e5             	mov    %rsp,%rbp
+  804787:	48 83 ec 20          	sub    $0x20,%rsp
+  80478b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80478b <putch+0x8>
+  804792:	49 bb a5 48 00 00 00 	movabs $0x48a5,%r11
+  804799:	00 00 00 
+  80479c:	4c 01 d8             	add    %r11,%rax
+  80479f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8047a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct printbuf *b = (struct printbuf *) thunk;
+  8047a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8047aa:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	b->buf[b->idx++] = ch;
+  8047ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047b2:	8b 52 04             	mov    0x4(%rdx),%edx
+  8047b5:	8d 72 01             	lea    0x1(%rdx),%esi
+  8047b8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8047bc:	89 71 04             	mov    %esi,0x4(%rcx)
+  8047bf:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8047c2:	89 ce                	mov    %ecx,%esi
+  8047c4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8047c8:	48 63 d2             	movslq %edx,%rdx
+  8047cb:	40 88 74 11 10       	mov    %sil,0x10(%rcx,%rdx,1)
+	if (b->idx == 256) {
+  8047d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047d4:	8b 52 04             	mov    0x4(%rdx),%edx
+  8047d7:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8047dd:	75 22                	jne    804801 <putch+0x7e>
+		writebuf(b);
+  8047df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047e3:	48 89 d7             	mov    %rdx,%rdi
+  8047e6:	48 ba b7 b6 ff ff ff 	movabs $0xffffffffffffb6b7,%rdx
+  8047ed:	ff ff ff 
+  8047f0:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8047f4:	ff d0                	call   *%rax
+		b->idx = 0;
+  8047f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047fa:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+	}
+}
+  804801:	90                   	nop
+  804802:	c9                   	leave
+  804803:	c3                   	ret
+
+0000000000804804 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  804804:	55                   	push   %rbp
+  804805:	48 89 e5             	mov    %rsp,%rbp
+  804808:	41 57                	push   %r15
+  80480a:	53                   	push   %rbx
+  80480b:	48 81 ec 30 01 00 00 	sub    $0x130,%rsp
+  804812:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804812 <vfprintf+0xe>
+  804819:	49 bb 1e 48 00 00 00 	movabs $0x481e,%r11
+  804820:	00 00 00 
+  804823:	4c 01 db             	add    %r11,%rbx
+  804826:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  80482c:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  804833:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+	struct printbuf b;
+
+	b.fd = fd;
+  80483a:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  804840:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+	b.idx = 0;
+  804846:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80484d:	00 00 00 
+	b.result = 0;
+  804850:	c7 85 e8 fe ff ff 00 	movl   $0x0,-0x118(%rbp)
+  804857:	00 00 00 
+	b.error = 1;
+  80485a:	c7 85 ec fe ff ff 01 	movl   $0x1,-0x114(%rbp)
+  804861:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  804864:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  80486b:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  804872:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804879:	48 89 c6             	mov    %rax,%rsi
+  80487c:	48 b8 53 b7 ff ff ff 	movabs $0xffffffffffffb753,%rax
+  804883:	ff ff ff 
+  804886:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80488a:	48 89 c7             	mov    %rax,%rdi
+  80488d:	49 89 df             	mov    %rbx,%r15
+  804890:	48 b8 d0 7e ff ff ff 	movabs $0xffffffffffff7ed0,%rax
+  804897:	ff ff ff 
+  80489a:	48 01 d8             	add    %rbx,%rax
+  80489d:	ff d0                	call   *%rax
+	if (b.idx > 0)
+  80489f:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  8048a5:	85 c0                	test   %eax,%eax
+  8048a7:	7e 1a                	jle    8048c3 <vfprintf+0xbf>
+		writebuf(&b);
+  8048a9:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8048b0:	48 89 c7             	mov    %rax,%rdi
+  8048b3:	48 b8 b7 b6 ff ff ff 	movabs $0xffffffffffffb6b7,%rax
+  8048ba:	ff ff ff 
+  8048bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048c1:	ff d0                	call   *%rax
+
+	return (b.result ? b.result : b.error);
+  8048c3:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  8048c9:	85 c0                	test   %eax,%eax
+  8048cb:	74 08                	je     8048d5 <vfprintf+0xd1>
+  8048cd:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  8048d3:	eb 06                	jmp    8048db <vfprintf+0xd7>
+  8048d5:	8b 85 ec fe ff ff    	mov    -0x114(%rbp),%eax
+}
+  8048db:	48 81 c4 30 01 00 00 	add    $0x130,%rsp
+  8048e2:	5b                   	pop    %rbx
+  8048e3:	41 5f                	pop    %r15
+  8048e5:	5d                   	pop    %rbp
+  8048e6:	c3                   	ret
+
+00000000008048e7 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8048e7:	55                   	push   %rbp
+  8048e8:	48 89 e5             	mov    %rsp,%rbp
+  8048eb:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8048f2:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8048f2 <fprintf+0xb>
+  8048f9:	49 bb 3e 47 00 00 00 	movabs $0x473e,%r11
+  804900:	00 00 00 
+  804903:	4d 01 da             	add    %r11,%r10
+  804906:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  80490c:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  804913:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80491a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804921:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804928:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80492f:	84 c0                	test   %al,%al
+  804931:	74 20                	je     804953 <fprintf+0x6c>
+  804933:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804937:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80493b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80493f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804943:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804947:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80494b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80494f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  804953:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  80495a:	00 00 00 
+  80495d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804964:	00 00 00 
+  804967:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80496b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804972:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804979:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(fd, fmt, ap);
+  804980:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804987:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  80498e:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804994:	48 89 ce             	mov    %rcx,%rsi
+  804997:	89 c7                	mov    %eax,%edi
+  804999:	48 b8 d4 b7 ff ff ff 	movabs $0xffffffffffffb7d4,%rax
+  8049a0:	ff ff ff 
+  8049a3:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8049a7:	ff d0                	call   *%rax
+  8049a9:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  8049af:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8049b5:	c9                   	leave
+  8049b6:	c3                   	ret
+
+00000000008049b7 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8049b7:	55                   	push   %rbp
+  8049b8:	48 89 e5             	mov    %rsp,%rbp
+  8049bb:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8049c2:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8049c2 <printf+0xb>
+  8049c9:	49 bb 6e 46 00 00 00 	movabs $0x466e,%r11
+  8049d0:	00 00 00 
+  8049d3:	4d 01 da             	add    %r11,%r10
+  8049d6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8049dd:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8049e4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8049eb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8049f2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8049f9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  804a00:	84 c0                	test   %al,%al
+  804a02:	74 20                	je     804a24 <printf+0x6d>
+  804a04:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804a08:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804a0c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804a10:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804a14:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804a18:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804a1c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804a20:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  804a24:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  804a2b:	00 00 00 
+  804a2e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804a35:	00 00 00 
+  804a38:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a3c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804a43:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804a4a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(1, fmt, ap);
+  804a51:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804a58:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  804a5f:	48 89 c6             	mov    %rax,%rsi
+  804a62:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a67:	48 b8 d4 b7 ff ff ff 	movabs $0xffffffffffffb7d4,%rax
+  804a6e:	ff ff ff 
+  804a71:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804a75:	ff d0                	call   *%rax
+  804a77:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  804a7d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804a83:	c9                   	leave
+  804a84:	c3                   	ret
+
+0000000000804a85 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804a85:	55                   	push   %rbp
+  804a86:	48 89 e5             	mov    %rsp,%rbp
+  804a89:	41 57                	push   %r15
+  804a8b:	53                   	push   %rbx
+  804a8c:	48 83 ec 20          	sub    $0x20,%rsp
+  804a90:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a90 <fd2sockid+0xb>
+  804a97:	49 bb a0 45 00 00 00 	movabs $0x45a0,%r11
+  804a9e:	00 00 00 
+  804aa1:	4c 01 db             	add    %r11,%rbx
+  804aa4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804aa7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804aab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804aae:	48 89 d6             	mov    %rdx,%rsi
+  804ab1:	89 c7                	mov    %eax,%edi
+  804ab3:	49 89 df             	mov    %rbx,%r15
+  804ab6:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  804abd:	ff ff ff 
+  804ac0:	48 01 d8             	add    %rbx,%rax
+  804ac3:	ff d0                	call   *%rax
+  804ac5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ac8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804acc:	79 05                	jns    804ad3 <fd2sockid+0x4e>
+		return r;
+  804ace:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ad1:	eb 25                	jmp    804af8 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804ad3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ad7:	8b 10                	mov    (%rax),%edx
+  804ad9:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  804ae0:	00 00 00 
+  804ae3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ae6:	39 c2                	cmp    %eax,%edx
+  804ae8:	74 07                	je     804af1 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804aea:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804aef:	eb 07                	jmp    804af8 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804af1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804af5:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804af8:	48 83 c4 20          	add    $0x20,%rsp
+  804afc:	5b                   	pop    %rbx
+  804afd:	41 5f                	pop    %r15
+  804aff:	5d                   	pop    %rbp
+  804b00:	c3                   	ret
+
+0000000000804b01 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804b01:	55                   	push   %rbp
+  804b02:	48 89 e5             	mov    %rsp,%rbp
+  804b05:	41 57                	push   %r15
+  804b07:	53                   	push   %rbx
+  804b08:	48 83 ec 20          	sub    $0x20,%rsp
+  804b0c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b0c <alloc_sockfd+0xb>
+  804b13:	49 bb 24 45 00 00 00 	movabs $0x4524,%r11
+  804b1a:	00 00 00 
+  804b1d:	4c 01 db             	add    %r11,%rbx
+  804b20:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804b23:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804b27:	48 89 c7             	mov    %rax,%rdi
+  804b2a:	49 89 df             	mov    %rbx,%r15
+  804b2d:	48 b8 78 a0 ff ff ff 	movabs $0xffffffffffffa078,%rax
+  804b34:	ff ff ff 
+  804b37:	48 01 d8             	add    %rbx,%rax
+  804b3a:	ff d0                	call   *%rax
+  804b3c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b3f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b43:	78 2c                	js     804b71 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804b45:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b49:	ba 07 04 00 00       	mov    $0x407,%edx
+  804b4e:	48 89 c6             	mov    %rax,%rsi
+  804b51:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b56:	49 89 df             	mov    %rbx,%r15
+  804b59:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  804b60:	ff ff ff 
+  804b63:	48 01 d8             	add    %rbx,%rax
+  804b66:	ff d0                	call   *%rax
+  804b68:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b6f:	79 1c                	jns    804b8d <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804b71:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b74:	89 c7                	mov    %eax,%edi
+  804b76:	49 89 df             	mov    %rbx,%r15
+  804b79:	48 b8 c5 c2 ff ff ff 	movabs $0xffffffffffffc2c5,%rax
+  804b80:	ff ff ff 
+  804b83:	48 01 d8             	add    %rbx,%rax
+  804b86:	ff d0                	call   *%rax
+		return r;
+  804b88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b8b:	eb 41                	jmp    804bce <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804b8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b91:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  804b98:	00 00 00 
+  804b9b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804b9e:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804ba0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ba4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804bab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804baf:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804bb2:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804bb5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bb9:	48 89 c7             	mov    %rax,%rdi
+  804bbc:	49 89 df             	mov    %rbx,%r15
+  804bbf:	48 b8 fe 9f ff ff ff 	movabs $0xffffffffffff9ffe,%rax
+  804bc6:	ff ff ff 
+  804bc9:	48 01 d8             	add    %rbx,%rax
+  804bcc:	ff d0                	call   *%rax
+}
+  804bce:	48 83 c4 20          	add    $0x20,%rsp
+  804bd2:	5b                   	pop    %rbx
+  804bd3:	41 5f                	pop    %r15
+  804bd5:	5d                   	pop    %rbp
+  804bd6:	c3                   	ret
+
+0000000000804bd7 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804bd7:	55                   	push   %rbp
+  804bd8:	48 89 e5             	mov    %rsp,%rbp
+  804bdb:	41 57                	push   %r15
+  804bdd:	53                   	push   %rbx
+  804bde:	48 83 ec 30          	sub    $0x30,%rsp
+  804be2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804be2 <accept+0xb>
+  804be9:	49 bb 4e 44 00 00 00 	movabs $0x444e,%r11
+  804bf0:	00 00 00 
+  804bf3:	4c 01 db             	add    %r11,%rbx
+  804bf6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804bf9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804bfd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804c01:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c04:	89 c7                	mov    %eax,%edi
+  804c06:	48 b8 55 ba ff ff ff 	movabs $0xffffffffffffba55,%rax
+  804c0d:	ff ff ff 
+  804c10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c14:	ff d0                	call   *%rax
+  804c16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c19:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c1d:	79 05                	jns    804c24 <accept+0x4d>
+		return r;
+  804c1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c22:	eb 45                	jmp    804c69 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804c24:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804c28:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804c2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c2f:	48 89 ce             	mov    %rcx,%rsi
+  804c32:	89 c7                	mov    %eax,%edi
+  804c34:	49 89 df             	mov    %rbx,%r15
+  804c37:	48 b8 33 c1 ff ff ff 	movabs $0xffffffffffffc133,%rax
+  804c3e:	ff ff ff 
+  804c41:	48 01 d8             	add    %rbx,%rax
+  804c44:	ff d0                	call   *%rax
+  804c46:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c49:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c4d:	79 05                	jns    804c54 <accept+0x7d>
+		return r;
+  804c4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c52:	eb 15                	jmp    804c69 <accept+0x92>
+	return alloc_sockfd(r);
+  804c54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c57:	89 c7                	mov    %eax,%edi
+  804c59:	48 b8 d1 ba ff ff ff 	movabs $0xffffffffffffbad1,%rax
+  804c60:	ff ff ff 
+  804c63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c67:	ff d0                	call   *%rax
+}
+  804c69:	48 83 c4 30          	add    $0x30,%rsp
+  804c6d:	5b                   	pop    %rbx
+  804c6e:	41 5f                	pop    %r15
+  804c70:	5d                   	pop    %rbp
+  804c71:	c3                   	ret
+
+0000000000804c72 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804c72:	55                   	push   %rbp
+  804c73:	48 89 e5             	mov    %rsp,%rbp
+  804c76:	41 57                	push   %r15
+  804c78:	53                   	push   %rbx
+  804c79:	48 83 ec 20          	sub    $0x20,%rsp
+  804c7d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c7d <bind+0xb>
+  804c84:	49 bb b3 43 00 00 00 	movabs $0x43b3,%r11
+  804c8b:	00 00 00 
+  804c8e:	4c 01 db             	add    %r11,%rbx
+  804c91:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804c94:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804c98:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804c9b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c9e:	89 c7                	mov    %eax,%edi
+  804ca0:	48 b8 55 ba ff ff ff 	movabs $0xffffffffffffba55,%rax
+  804ca7:	ff ff ff 
+  804caa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cae:	ff d0                	call   *%rax
+  804cb0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cb3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cb7:	79 05                	jns    804cbe <bind+0x4c>
+		return r;
+  804cb9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cbc:	eb 21                	jmp    804cdf <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804cbe:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804cc1:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804cc5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cc8:	48 89 ce             	mov    %rcx,%rsi
+  804ccb:	89 c7                	mov    %eax,%edi
+  804ccd:	49 89 df             	mov    %rbx,%r15
+  804cd0:	48 b8 df c1 ff ff ff 	movabs $0xffffffffffffc1df,%rax
+  804cd7:	ff ff ff 
+  804cda:	48 01 d8             	add    %rbx,%rax
+  804cdd:	ff d0                	call   *%rax
+}
+  804cdf:	48 83 c4 20          	add    $0x20,%rsp
+  804ce3:	5b                   	pop    %rbx
+  804ce4:	41 5f                	pop    %r15
+  804ce6:	5d                   	pop    %rbp
+  804ce7:	c3                   	ret
+
+0000000000804ce8 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804ce8:	55                   	push   %rbp
+  804ce9:	48 89 e5             	mov    %rsp,%rbp
+  804cec:	41 57                	push   %r15
+  804cee:	53                   	push   %rbx
+  804cef:	48 83 ec 20          	sub    $0x20,%rsp
+  804cf3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cf3 <shutdown+0xb>
+  804cfa:	49 bb 3d 43 00 00 00 	movabs $0x433d,%r11
+  804d01:	00 00 00 
+  804d04:	4c 01 db             	add    %r11,%rbx
+  804d07:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804d0a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804d0d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804d10:	89 c7                	mov    %eax,%edi
+  804d12:	48 b8 55 ba ff ff ff 	movabs $0xffffffffffffba55,%rax
+  804d19:	ff ff ff 
+  804d1c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d20:	ff d0                	call   *%rax
+  804d22:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d25:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d29:	79 05                	jns    804d30 <shutdown+0x48>
+		return r;
+  804d2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d2e:	eb 1c                	jmp    804d4c <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804d30:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804d33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d36:	89 d6                	mov    %edx,%esi
+  804d38:	89 c7                	mov    %eax,%edi
+  804d3a:	49 89 df             	mov    %rbx,%r15
+  804d3d:	48 b8 74 c2 ff ff ff 	movabs $0xffffffffffffc274,%rax
+  804d44:	ff ff ff 
+  804d47:	48 01 d8             	add    %rbx,%rax
+  804d4a:	ff d0                	call   *%rax
+}
+  804d4c:	48 83 c4 20          	add    $0x20,%rsp
+  804d50:	5b                   	pop    %rbx
+  804d51:	41 5f                	pop    %r15
+  804d53:	5d                   	pop    %rbp
+  804d54:	c3                   	ret
+
+0000000000804d55 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804d55:	55                   	push   %rbp
+  804d56:	48 89 e5             	mov    %rsp,%rbp
+  804d59:	41 57                	push   %r15
+  804d5b:	53                   	push   %rbx
+  804d5c:	48 83 ec 10          	sub    $0x10,%rsp
+  804d60:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d60 <devsock_close+0xb>
+  804d67:	49 bb d0 42 00 00 00 	movabs $0x42d0,%r11
+  804d6e:	00 00 00 
+  804d71:	4c 01 db             	add    %r11,%rbx
+  804d74:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804d78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d7c:	48 89 c7             	mov    %rax,%rdi
+  804d7f:	49 89 df             	mov    %rbx,%r15
+  804d82:	48 b8 71 da ff ff ff 	movabs $0xffffffffffffda71,%rax
+  804d89:	ff ff ff 
+  804d8c:	48 01 d8             	add    %rbx,%rax
+  804d8f:	ff d0                	call   *%rax
+  804d91:	83 f8 01             	cmp    $0x1,%eax
+  804d94:	75 1d                	jne    804db3 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804d96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d9a:	8b 40 0c             	mov    0xc(%rax),%eax
+  804d9d:	89 c7                	mov    %eax,%edi
+  804d9f:	49 89 df             	mov    %rbx,%r15
+  804da2:	48 b8 c5 c2 ff ff ff 	movabs $0xffffffffffffc2c5,%rax
+  804da9:	ff ff ff 
+  804dac:	48 01 d8             	add    %rbx,%rax
+  804daf:	ff d0                	call   *%rax
+  804db1:	eb 05                	jmp    804db8 <devsock_close+0x63>
+	else
+		return 0;
+  804db3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804db8:	48 83 c4 10          	add    $0x10,%rsp
+  804dbc:	5b                   	pop    %rbx
+  804dbd:	41 5f                	pop    %r15
+  804dbf:	5d                   	pop    %rbp
+  804dc0:	c3                   	ret
+
+0000000000804dc1 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804dc1:	55                   	push   %rbp
+  804dc2:	48 89 e5             	mov    %rsp,%rbp
+  804dc5:	41 57                	push   %r15
+  804dc7:	53                   	push   %rbx
+  804dc8:	48 83 ec 20          	sub    $0x20,%rsp
+  804dcc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804dcc <connect+0xb>
+  804dd3:	49 bb 64 42 00 00 00 	movabs $0x4264,%r11
+  804dda:	00 00 00 
+  804ddd:	4c 01 db             	add    %r11,%rbx
+  804de0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804de3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804de7:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804dea:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ded:	89 c7                	mov    %eax,%edi
+  804def:	48 b8 55 ba ff ff ff 	movabs $0xffffffffffffba55,%rax
+  804df6:	ff ff ff 
+  804df9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804dfd:	ff d0                	call   *%rax
+  804dff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e02:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e06:	79 05                	jns    804e0d <connect+0x4c>
+		return r;
+  804e08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e0b:	eb 21                	jmp    804e2e <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804e0d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804e10:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804e14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e17:	48 89 ce             	mov    %rcx,%rsi
+  804e1a:	89 c7                	mov    %eax,%edi
+  804e1c:	49 89 df             	mov    %rbx,%r15
+  804e1f:	48 b8 0d c3 ff ff ff 	movabs $0xffffffffffffc30d,%rax
+  804e26:	ff ff ff 
+  804e29:	48 01 d8             	add    %rbx,%rax
+  804e2c:	ff d0                	call   *%rax
+}
+  804e2e:	48 83 c4 20          	add    $0x20,%rsp
+  804e32:	5b                   	pop    %rbx
+  804e33:	41 5f                	pop    %r15
+  804e35:	5d                   	pop    %rbp
+  804e36:	c3                   	ret
+
+0000000000804e37 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804e37:	55                   	push   %rbp
+  804e38:	48 89 e5             	mov    %rsp,%rbp
+  804e3b:	41 57                	push   %r15
+  804e3d:	53                   	push   %rbx
+  804e3e:	48 83 ec 20          	sub    $0x20,%rsp
+  804e42:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e42 <listen+0xb>
+  804e49:	49 bb ee 41 00 00 00 	movabs $0x41ee,%r11
+  804e50:	00 00 00 
+  804e53:	4c 01 db             	add    %r11,%rbx
+  804e56:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e59:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804e5c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e5f:	89 c7                	mov    %eax,%edi
+  804e61:	48 b8 55 ba ff ff ff 	movabs $0xffffffffffffba55,%rax
+  804e68:	ff ff ff 
+  804e6b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e6f:	ff d0                	call   *%rax
+  804e71:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e74:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e78:	79 05                	jns    804e7f <listen+0x48>
+		return r;
+  804e7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e7d:	eb 1c                	jmp    804e9b <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804e7f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804e82:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e85:	89 d6                	mov    %edx,%esi
+  804e87:	89 c7                	mov    %eax,%edi
+  804e89:	49 89 df             	mov    %rbx,%r15
+  804e8c:	48 b8 a2 c3 ff ff ff 	movabs $0xffffffffffffc3a2,%rax
+  804e93:	ff ff ff 
+  804e96:	48 01 d8             	add    %rbx,%rax
+  804e99:	ff d0                	call   *%rax
+}
+  804e9b:	48 83 c4 20          	add    $0x20,%rsp
+  804e9f:	5b                   	pop    %rbx
+  804ea0:	41 5f                	pop    %r15
+  804ea2:	5d                   	pop    %rbp
+  804ea3:	c3                   	ret
+
+0000000000804ea4 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804ea4:	55                   	push   %rbp
+  804ea5:	48 89 e5             	mov    %rsp,%rbp
+  804ea8:	41 57                	push   %r15
+  804eaa:	48 83 ec 28          	sub    $0x28,%rsp
+  804eae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804eae <devsock_read+0xa>
+  804eb5:	49 bb 82 41 00 00 00 	movabs $0x4182,%r11
+  804ebc:	00 00 00 
+  804ebf:	4c 01 d8             	add    %r11,%rax
+  804ec2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ec6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804eca:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804ece:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804ed2:	41 89 d0             	mov    %edx,%r8d
+  804ed5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ed9:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804edc:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804ee0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804ee5:	44 89 c2             	mov    %r8d,%edx
+  804ee8:	49 89 c7             	mov    %rax,%r15
+  804eeb:	49 b8 f3 c3 ff ff ff 	movabs $0xffffffffffffc3f3,%r8
+  804ef2:	ff ff ff 
+  804ef5:	49 01 c0             	add    %rax,%r8
+  804ef8:	41 ff d0             	call   *%r8
+}
+  804efb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804eff:	c9                   	leave
+  804f00:	c3                   	ret
+
+0000000000804f01 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804f01:	55                   	push   %rbp
+  804f02:	48 89 e5             	mov    %rsp,%rbp
+  804f05:	41 57                	push   %r15
+  804f07:	48 83 ec 28          	sub    $0x28,%rsp
+  804f0b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804f0b <devsock_write+0xa>
+  804f12:	49 bb 25 41 00 00 00 	movabs $0x4125,%r11
+  804f19:	00 00 00 
+  804f1c:	4c 01 d8             	add    %r11,%rax
+  804f1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804f23:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804f27:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804f2b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804f2f:	41 89 d0             	mov    %edx,%r8d
+  804f32:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f36:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804f39:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804f3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804f42:	44 89 c2             	mov    %r8d,%edx
+  804f45:	49 89 c7             	mov    %rax,%r15
+  804f48:	49 b8 10 c5 ff ff ff 	movabs $0xffffffffffffc510,%r8
+  804f4f:	ff ff ff 
+  804f52:	49 01 c0             	add    %rax,%r8
+  804f55:	41 ff d0             	call   *%r8
+}
+  804f58:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804f5c:	c9                   	leave
+  804f5d:	c3                   	ret
+
+0000000000804f5e <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  804f5e:	55                   	push   %rbp
+  804f5f:	48 89 e5             	mov    %rsp,%rbp
+  804f62:	41 57                	push   %r15
+  804f64:	48 83 ec 18          	sub    $0x18,%rsp
+  804f68:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804f68 <devsock_stat+0xa>
+  804f6f:	49 bb c8 40 00 00 00 	movabs $0x40c8,%r11
+  804f76:	00 00 00 
+  804f79:	4c 01 d8             	add    %r11,%rax
+  804f7c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804f80:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804f84:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f88:	48 b9 0c e1 ff ff ff 	movabs $0xffffffffffffe10c,%rcx
+  804f8f:	ff ff ff 
+  804f92:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804f96:	48 89 ce             	mov    %rcx,%rsi
+  804f99:	48 89 d7             	mov    %rdx,%rdi
+  804f9c:	49 89 c7             	mov    %rax,%r15
+  804f9f:	48 ba 4e 88 ff ff ff 	movabs $0xffffffffffff884e,%rdx
+  804fa6:	ff ff ff 
+  804fa9:	48 01 c2             	add    %rax,%rdx
+  804fac:	ff d2                	call   *%rdx
+	return 0;
+  804fae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804fb3:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804fb7:	c9                   	leave
+  804fb8:	c3                   	ret
+
+0000000000804fb9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804fb9:	55                   	push   %rbp
+  804fba:	48 89 e5             	mov    %rsp,%rbp
+  804fbd:	41 57                	push   %r15
+  804fbf:	53                   	push   %rbx
+  804fc0:	48 83 ec 20          	sub    $0x20,%rsp
+  804fc4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fc4 <socket+0xb>
+  804fcb:	49 bb 6c 40 00 00 00 	movabs $0x406c,%r11
+  804fd2:	00 00 00 
+  804fd5:	4c 01 db             	add    %r11,%rbx
+  804fd8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804fdb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804fde:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804fe1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804fe4:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804fe7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fea:	89 ce                	mov    %ecx,%esi
+  804fec:	89 c7                	mov    %eax,%edi
+  804fee:	49 89 df             	mov    %rbx,%r15
+  804ff1:	48 b8 e7 c6 ff ff ff 	movabs $0xffffffffffffc6e7,%rax
+  804ff8:	ff ff ff 
+  804ffb:	48 01 d8             	add    %rbx,%rax
+  804ffe:	ff d0                	call   *%rax
+  805000:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805003:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805007:	79 05                	jns    80500e <socket+0x55>
+		return r;
+  805009:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80500c:	eb 15                	jmp    805023 <socket+0x6a>
+	return alloc_sockfd(r);
+  80500e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805011:	89 c7                	mov    %eax,%edi
+  805013:	48 b8 d1 ba ff ff ff 	movabs $0xffffffffffffbad1,%rax
+  80501a:	ff ff ff 
+  80501d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805021:	ff d0                	call   *%rax
+}
+  805023:	48 83 c4 20          	add    $0x20,%rsp
+  805027:	5b                   	pop    %rbx
+  805028:	41 5f                	pop    %r15
+  80502a:	5d                   	pop    %rbp
+  80502b:	c3                   	ret
+
+000000000080502c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80502c:	55                   	push   %rbp
+  80502d:	48 89 e5             	mov    %rsp,%rbp
+  805030:	41 57                	push   %r15
+  805032:	53                   	push   %rbx
+  805033:	48 83 ec 10          	sub    $0x10,%rsp
+  805037:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805037 <nsipc+0xb>
+  80503e:	49 bb f9 3f 00 00 00 	movabs $0x3ff9,%r11
+  805045:	00 00 00 
+  805048:	4c 01 db             	add    %r11,%rbx
+  80504b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  80504e:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  805055:	00 00 00 
+  805058:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80505b:	85 c0                	test   %eax,%eax
+  80505d:	75 24                	jne    805083 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80505f:	bf 02 00 00 00       	mov    $0x2,%edi
+  805064:	49 89 df             	mov    %rbx,%r15
+  805067:	48 b8 e2 d9 ff ff ff 	movabs $0xffffffffffffd9e2,%rax
+  80506e:	ff ff ff 
+  805071:	48 01 d8             	add    %rbx,%rax
+  805074:	ff d0                	call   *%rax
+  805076:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  80507d:	00 00 00 
+  805080:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805083:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80508a:	00 00 00 
+  80508d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805090:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805093:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805099:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80509f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8050a4:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8050ab:	00 00 00 
+  8050ae:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8050b2:	89 c7                	mov    %eax,%edi
+  8050b4:	49 89 df             	mov    %rbx,%r15
+  8050b7:	48 b8 01 d4 ff ff ff 	movabs $0xffffffffffffd401,%rax
+  8050be:	ff ff ff 
+  8050c1:	48 01 d8             	add    %rbx,%rax
+  8050c4:	ff d0                	call   *%rax
+}
+  8050c6:	48 83 c4 10          	add    $0x10,%rsp
+  8050ca:	5b                   	pop    %rbx
+  8050cb:	41 5f                	pop    %r15
+  8050cd:	5d                   	pop    %rbp
+  8050ce:	c3                   	ret
+
+00000000008050cf <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8050cf:	55                   	push   %rbp
+  8050d0:	48 89 e5             	mov    %rsp,%rbp
+  8050d3:	41 57                	push   %r15
+  8050d5:	53                   	push   %rbx
+  8050d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8050da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050da <nsipc_words+0xb>
+  8050e1:	49 bb 56 3f 00 00 00 	movabs $0x3f56,%r11
+  8050e8:	00 00 00 
+  8050eb:	4c 01 db             	add    %r11,%rbx
+  8050ee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8050f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8050f5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8050f9:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  805100:	00 00 00 
+  805103:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805106:	85 c0                	test   %eax,%eax
+  805108:	75 24                	jne    80512e <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80510a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80510f:	49 89 df             	mov    %rbx,%r15
+  805112:	48 b8 e2 d9 ff ff ff 	movabs $0xffffffffffffd9e2,%rax
+  805119:	ff ff ff 
+  80511c:	48 01 d8             	add    %rbx,%rax
+  80511f:	ff d0                	call   *%rax
+  805121:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  805128:	00 00 00 
+  80512b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  80512e:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  805135:	00 00 00 
+  805138:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80513b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80513f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805143:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805146:	89 c7                	mov    %eax,%edi
+  805148:	49 89 df             	mov    %rbx,%r15
+  80514b:	48 b8 ec d4 ff ff ff 	movabs $0xffffffffffffd4ec,%rax
+  805152:	ff ff ff 
+  805155:	48 01 d8             	add    %rbx,%rax
+  805158:	ff d0                	call   *%rax
+}
+  80515a:	48 83 c4 20          	add    $0x20,%rsp
+  80515e:	5b                   	pop    %rbx
+  80515f:	41 5f                	pop    %r15
+  805161:	5d                   	pop    %rbp
+  805162:	c3                   	ret
+
+0000000000805163 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805163:	55                   	push   %rbp
+  805164:	48 89 e5             	mov    %rsp,%rbp
+  805167:	41 57                	push   %r15
+  805169:	53                   	push   %rbx
+  80516a:	48 83 ec 30          	sub    $0x30,%rsp
+  80516e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80516e <nsipc_accept+0xb>
+  805175:	49 bb c2 3e 00 00 00 	movabs $0x3ec2,%r11
+  80517c:	00 00 00 
+  80517f:	4c 01 db             	add    %r11,%rbx
+  805182:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805185:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805189:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80518d:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  805194:	00 00 00 
+  805197:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80519a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80519d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8051a2:	48 b8 fc bf ff ff ff 	movabs $0xffffffffffffbffc,%rax
+  8051a9:	ff ff ff 
+  8051ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051b0:	ff d0                	call   *%rax
+  8051b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051b9:	78 48                	js     805203 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8051bb:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  8051c2:	00 00 00 
+  8051c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051c9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8051cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051d1:	8b 40 10             	mov    0x10(%rax),%eax
+  8051d4:	89 c2                	mov    %eax,%edx
+  8051d6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8051da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051de:	48 89 ce             	mov    %rcx,%rsi
+  8051e1:	48 89 c7             	mov    %rax,%rdi
+  8051e4:	49 89 df             	mov    %rbx,%r15
+  8051e7:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  8051ee:	ff ff ff 
+  8051f1:	48 01 d8             	add    %rbx,%rax
+  8051f4:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8051f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051fa:	8b 50 10             	mov    0x10(%rax),%edx
+  8051fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805201:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805203:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805206:	48 83 c4 30          	add    $0x30,%rsp
+  80520a:	5b                   	pop    %rbx
+  80520b:	41 5f                	pop    %r15
+  80520d:	5d                   	pop    %rbp
+  80520e:	c3                   	ret
+
+000000000080520f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80520f:	55                   	push   %rbp
+  805210:	48 89 e5             	mov    %rsp,%rbp
+  805213:	41 57                	push   %r15
+  805215:	53                   	push   %rbx
+  805216:	48 83 ec 10          	sub    $0x10,%rsp
+  80521a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80521a <nsipc_bind+0xb>
+  805221:	49 bb 16 3e 00 00 00 	movabs $0x3e16,%r11
+  805228:	00 00 00 
+  80522b:	4c 01 db             	add    %r11,%rbx
+  80522e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805231:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805235:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805238:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80523f:	00 00 00 
+  805242:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805245:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805248:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80524b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80524f:	48 89 c6             	mov    %rax,%rsi
+  805252:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  805259:	00 00 00 
+  80525c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805260:	48 89 c7             	mov    %rax,%rdi
+  805263:	49 89 df             	mov    %rbx,%r15
+  805266:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  80526d:	ff ff ff 
+  805270:	48 01 d8             	add    %rbx,%rax
+  805273:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805275:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80527c:	00 00 00 
+  80527f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805282:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805286:	bf 02 00 00 00       	mov    $0x2,%edi
+  80528b:	48 b8 fc bf ff ff ff 	movabs $0xffffffffffffbffc,%rax
+  805292:	ff ff ff 
+  805295:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805299:	ff d0                	call   *%rax
+}
+  80529b:	48 83 c4 10          	add    $0x10,%rsp
+  80529f:	5b                   	pop    %rbx
+  8052a0:	41 5f                	pop    %r15
+  8052a2:	5d                   	pop    %rbp
+  8052a3:	c3                   	ret
+
+00000000008052a4 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8052a4:	55                   	push   %rbp
+  8052a5:	48 89 e5             	mov    %rsp,%rbp
+  8052a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8052ac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8052ac <nsipc_shutdown+0x8>
+  8052b3:	49 bb 84 3d 00 00 00 	movabs $0x3d84,%r11
+  8052ba:	00 00 00 
+  8052bd:	4c 01 d8             	add    %r11,%rax
+  8052c0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8052c3:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8052c6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8052c9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8052cc:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8052cf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8052d2:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8052d6:	ba 08 00 00 00       	mov    $0x8,%edx
+  8052db:	48 89 ce             	mov    %rcx,%rsi
+  8052de:	bf 03 00 00 00       	mov    $0x3,%edi
+  8052e3:	48 b9 9f c0 ff ff ff 	movabs $0xffffffffffffc09f,%rcx
+  8052ea:	ff ff ff 
+  8052ed:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8052f1:	ff d0                	call   *%rax
+}
+  8052f3:	c9                   	leave
+  8052f4:	c3                   	ret
+
+00000000008052f5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8052f5:	55                   	push   %rbp
+  8052f6:	48 89 e5             	mov    %rsp,%rbp
+  8052f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8052fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8052fd <nsipc_close+0x8>
+  805304:	49 bb 33 3d 00 00 00 	movabs $0x3d33,%r11
+  80530b:	00 00 00 
+  80530e:	4c 01 d8             	add    %r11,%rax
+  805311:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805314:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805317:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80531a:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80531e:	ba 04 00 00 00       	mov    $0x4,%edx
+  805323:	48 89 ce             	mov    %rcx,%rsi
+  805326:	bf 04 00 00 00       	mov    $0x4,%edi
+  80532b:	48 b9 9f c0 ff ff ff 	movabs $0xffffffffffffc09f,%rcx
+  805332:	ff ff ff 
+  805335:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805339:	ff d0                	call   *%rax
+}
+  80533b:	c9                   	leave
+  80533c:	c3                   	ret
+
+000000000080533d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80533d:	55                   	push   %rbp
+  80533e:	48 89 e5             	mov    %rsp,%rbp
+  805341:	41 57                	push   %r15
+  805343:	53                   	push   %rbx
+  805344:	48 83 ec 10          	sub    $0x10,%rsp
+  805348:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805348 <nsipc_connect+0xb>
+  80534f:	49 bb e8 3c 00 00 00 	movabs $0x3ce8,%r11
+  805356:	00 00 00 
+  805359:	4c 01 db             	add    %r11,%rbx
+  80535c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80535f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805363:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805366:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80536d:	00 00 00 
+  805370:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805373:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805376:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805379:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80537d:	48 89 c6             	mov    %rax,%rsi
+  805380:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  805387:	00 00 00 
+  80538a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80538e:	48 89 c7             	mov    %rax,%rdi
+  805391:	49 89 df             	mov    %rbx,%r15
+  805394:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  80539b:	ff ff ff 
+  80539e:	48 01 d8             	add    %rbx,%rax
+  8053a1:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8053a3:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8053aa:	00 00 00 
+  8053ad:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053b0:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8053b4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8053b9:	48 b8 fc bf ff ff ff 	movabs $0xffffffffffffbffc,%rax
+  8053c0:	ff ff ff 
+  8053c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053c7:	ff d0                	call   *%rax
+}
+  8053c9:	48 83 c4 10          	add    $0x10,%rsp
+  8053cd:	5b                   	pop    %rbx
+  8053ce:	41 5f                	pop    %r15
+  8053d0:	5d                   	pop    %rbp
+  8053d1:	c3                   	ret
+
+00000000008053d2 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8053d2:	55                   	push   %rbp
+  8053d3:	48 89 e5             	mov    %rsp,%rbp
+  8053d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8053da:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8053da <nsipc_listen+0x8>
+  8053e1:	49 bb 56 3c 00 00 00 	movabs $0x3c56,%r11
+  8053e8:	00 00 00 
+  8053eb:	4c 01 d8             	add    %r11,%rax
+  8053ee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8053f1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8053f4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8053f7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8053fa:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8053fd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805400:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805404:	ba 08 00 00 00       	mov    $0x8,%edx
+  805409:	48 89 ce             	mov    %rcx,%rsi
+  80540c:	bf 06 00 00 00       	mov    $0x6,%edi
+  805411:	48 b9 9f c0 ff ff ff 	movabs $0xffffffffffffc09f,%rcx
+  805418:	ff ff ff 
+  80541b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80541f:	ff d0                	call   *%rax
+}
+  805421:	c9                   	leave
+  805422:	c3                   	ret
+
+0000000000805423 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805423:	55                   	push   %rbp
+  805424:	48 89 e5             	mov    %rsp,%rbp
+  805427:	41 57                	push   %r15
+  805429:	53                   	push   %rbx
+  80542a:	48 83 ec 30          	sub    $0x30,%rsp
+  80542e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80542e <nsipc_recv+0xb>
+  805435:	49 bb 02 3c 00 00 00 	movabs $0x3c02,%r11
+  80543c:	00 00 00 
+  80543f:	4c 01 db             	add    %r11,%rbx
+  805442:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805445:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805449:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  80544c:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80544f:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  805456:	00 00 00 
+  805459:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80545c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  80545f:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  805466:	00 00 00 
+  805469:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80546c:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805470:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  805477:	00 00 00 
+  80547a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80547d:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805481:	bf 07 00 00 00       	mov    $0x7,%edi
+  805486:	48 b8 fc bf ff ff ff 	movabs $0xffffffffffffbffc,%rax
+  80548d:	ff ff ff 
+  805490:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805494:	ff d0                	call   *%rax
+  805496:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805499:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80549d:	0f 88 91 00 00 00    	js     805534 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8054a3:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8054aa:	7f 08                	jg     8054b4 <nsipc_recv+0x91>
+  8054ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054af:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8054b2:	7e 50                	jle    805504 <nsipc_recv+0xe1>
+  8054b4:	48 b8 13 e1 ff ff ff 	movabs $0xffffffffffffe113,%rax
+  8054bb:	ff ff ff 
+  8054be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054c2:	48 89 c1             	mov    %rax,%rcx
+  8054c5:	48 b8 28 e1 ff ff ff 	movabs $0xffffffffffffe128,%rax
+  8054cc:	ff ff ff 
+  8054cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054d3:	48 89 c2             	mov    %rax,%rdx
+  8054d6:	be 79 00 00 00       	mov    $0x79,%esi
+  8054db:	48 b8 3d e1 ff ff ff 	movabs $0xffffffffffffe13d,%rax
+  8054e2:	ff ff ff 
+  8054e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054e9:	48 89 c7             	mov    %rax,%rdi
+  8054ec:	49 89 df             	mov    %rbx,%r15
+  8054ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054f4:	49 b8 b5 77 ff ff ff 	movabs $0xffffffffffff77b5,%r8
+  8054fb:	ff ff ff 
+  8054fe:	49 01 d8             	add    %rbx,%r8
+  805501:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805504:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805507:	48 63 d0             	movslq %eax,%rdx
+  80550a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80550e:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  805515:	00 00 00 
+  805518:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  80551c:	48 89 ce             	mov    %rcx,%rsi
+  80551f:	48 89 c7             	mov    %rax,%rdi
+  805522:	49 89 df             	mov    %rbx,%r15
+  805525:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  80552c:	ff ff ff 
+  80552f:	48 01 d8             	add    %rbx,%rax
+  805532:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805534:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805537:	48 83 c4 30          	add    $0x30,%rsp
+  80553b:	5b                   	pop    %rbx
+  80553c:	41 5f                	pop    %r15
+  80553e:	5d                   	pop    %rbp
+  80553f:	c3                   	ret
+
+0000000000805540 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805540:	55                   	push   %rbp
+  805541:	48 89 e5             	mov    %rsp,%rbp
+  805544:	41 57                	push   %r15
+  805546:	53                   	push   %rbx
+  805547:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80554e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80554e <nsipc_send+0xe>
+  805555:	49 bb e2 3a 00 00 00 	movabs $0x3ae2,%r11
+  80555c:	00 00 00 
+  80555f:	4c 01 db             	add    %r11,%rbx
+  805562:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805568:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  80556f:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805575:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  80557b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80557f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805583:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80558a:	00 00 00 
+  80558d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805590:	85 c0                	test   %eax,%eax
+  805592:	75 24                	jne    8055b8 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805594:	bf 02 00 00 00       	mov    $0x2,%edi
+  805599:	49 89 df             	mov    %rbx,%r15
+  80559c:	48 b8 e2 d9 ff ff ff 	movabs $0xffffffffffffd9e2,%rax
+  8055a3:	ff ff ff 
+  8055a6:	48 01 d8             	add    %rbx,%rax
+  8055a9:	ff d0                	call   *%rax
+  8055ab:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8055b2:	00 00 00 
+  8055b5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8055b8:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8055be:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8055c1:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8055c8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8055cb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8055ce:	39 c2                	cmp    %eax,%edx
+  8055d0:	0f 4e c2             	cmovle %edx,%eax
+  8055d3:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8055d9:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8055df:	48 63 d0             	movslq %eax,%rdx
+  8055e2:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8055e9:	48 89 c6             	mov    %rax,%rsi
+  8055ec:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  8055f3:	00 00 00 
+  8055f6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055fa:	48 89 c7             	mov    %rax,%rdi
+  8055fd:	49 89 df             	mov    %rbx,%r15
+  805600:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  805607:	ff ff ff 
+  80560a:	48 01 d8             	add    %rbx,%rax
+  80560d:	ff d0                	call   *%rax
+	req->req_s = s;
+  80560f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805613:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805619:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80561b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80561f:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805625:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805628:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80562c:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805632:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805635:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  80563c:	00 00 00 
+  80563f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805643:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805647:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80564e:	00 
+  80564f:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805655:	48 63 d0             	movslq %eax,%rdx
+  805658:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80565c:	48 01 d0             	add    %rdx,%rax
+  80565f:	48 83 e8 01          	sub    $0x1,%rax
+  805663:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805667:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80566b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805670:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805674:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805678:	48 29 d0             	sub    %rdx,%rax
+  80567b:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805681:	85 c0                	test   %eax,%eax
+  805683:	0f 48 c2             	cmovs  %edx,%eax
+  805686:	c1 f8 0c             	sar    $0xc,%eax
+  805689:	48 98                	cltq
+  80568b:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  80568f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805693:	48 85 c0             	test   %rax,%rax
+  805696:	0f 95 c0             	setne  %al
+  805699:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  80569c:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8056a3:	00 
+  8056a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8056a8:	48 83 c0 0b          	add    $0xb,%rax
+  8056ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8056b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8056b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056b9:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8056bd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8056c1:	48 29 d0             	sub    %rdx,%rax
+  8056c4:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8056c8:	89 c7                	mov    %eax,%edi
+  8056ca:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8056d1:	00 00 00 
+  8056d4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056d7:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8056db:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8056df:	48 83 ec 08          	sub    $0x8,%rsp
+  8056e3:	6a 00                	push   $0x0
+  8056e5:	6a 00                	push   $0x0
+  8056e7:	6a 05                	push   $0x5
+  8056e9:	41 89 f1             	mov    %esi,%r9d
+  8056ec:	49 89 c8             	mov    %rcx,%r8
+  8056ef:	89 f9                	mov    %edi,%ecx
+  8056f1:	be 08 00 00 00       	mov    $0x8,%esi
+  8056f6:	89 c7                	mov    %eax,%edi
+  8056f8:	49 89 df             	mov    %rbx,%r15
+  8056fb:	48 b8 ea d5 ff ff ff 	movabs $0xffffffffffffd5ea,%rax
+  805702:	ff ff ff 
+  805705:	48 01 d8             	add    %rbx,%rax
+  805708:	ff d0                	call   *%rax
+  80570a:	48 83 c4 20          	add    $0x20,%rsp
+}
+  80570e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805712:	5b                   	pop    %rbx
+  805713:	41 5f                	pop    %r15
+  805715:	5d                   	pop    %rbp
+  805716:	c3                   	ret
+
+0000000000805717 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805717:	55                   	push   %rbp
+  805718:	48 89 e5             	mov    %rsp,%rbp
+  80571b:	48 83 ec 10          	sub    $0x10,%rsp
+  80571f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80571f <nsipc_socket+0x8>
+  805726:	49 bb 11 39 00 00 00 	movabs $0x3911,%r11
+  80572d:	00 00 00 
+  805730:	4c 01 d8             	add    %r11,%rax
+  805733:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805736:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805739:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  80573c:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  805743:	00 00 00 
+  805746:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805749:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  80574c:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  805753:	00 00 00 
+  805756:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805759:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  80575d:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  805764:	00 00 00 
+  805767:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80576a:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  80576e:	bf 09 00 00 00       	mov    $0x9,%edi
+  805773:	48 ba fc bf ff ff ff 	movabs $0xffffffffffffbffc,%rdx
+  80577a:	ff ff ff 
+  80577d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805781:	ff d0                	call   *%rax
+}
+  805783:	c9                   	leave
+  805784:	c3                   	ret
+
+0000000000805785 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805785:	55                   	push   %rbp
+  805786:	48 89 e5             	mov    %rsp,%rbp
+  805789:	41 57                	push   %r15
+  80578b:	53                   	push   %rbx
+  80578c:	48 83 ec 30          	sub    $0x30,%rsp
+  805790:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805790 <pipe+0xb>
+  805797:	49 bb a0 38 00 00 00 	movabs $0x38a0,%r11
+  80579e:	00 00 00 
+  8057a1:	4c 01 db             	add    %r11,%rbx
+  8057a4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8057a8:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8057ac:	48 89 c7             	mov    %rax,%rdi
+  8057af:	49 89 df             	mov    %rbx,%r15
+  8057b2:	48 b8 78 a0 ff ff ff 	movabs $0xffffffffffffa078,%rax
+  8057b9:	ff ff ff 
+  8057bc:	48 01 d8             	add    %rbx,%rax
+  8057bf:	ff d0                	call   *%rax
+  8057c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057c8:	0f 88 12 02 00 00    	js     8059e0 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8057ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057d2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8057d7:	48 89 c6             	mov    %rax,%rsi
+  8057da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057df:	49 89 df             	mov    %rbx,%r15
+  8057e2:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  8057e9:	ff ff ff 
+  8057ec:	48 01 d8             	add    %rbx,%rax
+  8057ef:	ff d0                	call   *%rax
+  8057f1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057f4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057f8:	0f 88 e2 01 00 00    	js     8059e0 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8057fe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805802:	48 89 c7             	mov    %rax,%rdi
+  805805:	49 89 df             	mov    %rbx,%r15
+  805808:	48 b8 78 a0 ff ff ff 	movabs $0xffffffffffffa078,%rax
+  80580f:	ff ff ff 
+  805812:	48 01 d8             	add    %rbx,%rax
+  805815:	ff d0                	call   *%rax
+  805817:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80581a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80581e:	0f 88 9b 01 00 00    	js     8059bf <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805824:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805828:	ba 07 04 00 00       	mov    $0x407,%edx
+  80582d:	48 89 c6             	mov    %rax,%rsi
+  805830:	bf 00 00 00 00       	mov    $0x0,%edi
+  805835:	49 89 df             	mov    %rbx,%r15
+  805838:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  80583f:	ff ff ff 
+  805842:	48 01 d8             	add    %rbx,%rax
+  805845:	ff d0                	call   *%rax
+  805847:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80584a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80584e:	0f 88 6b 01 00 00    	js     8059bf <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805854:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805858:	48 89 c7             	mov    %rax,%rdi
+  80585b:	49 89 df             	mov    %rbx,%r15
+  80585e:	48 b8 35 a0 ff ff ff 	movabs $0xffffffffffffa035,%rax
+  805865:	ff ff ff 
+  805868:	48 01 d8             	add    %rbx,%rax
+  80586b:	ff d0                	call   *%rax
+  80586d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805871:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805875:	ba 07 04 00 00       	mov    $0x407,%edx
+  80587a:	48 89 c6             	mov    %rax,%rsi
+  80587d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805882:	49 89 df             	mov    %rbx,%r15
+  805885:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  80588c:	ff ff ff 
+  80588f:	48 01 d8             	add    %rbx,%rax
+  805892:	ff d0                	call   *%rax
+  805894:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805897:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80589b:	0f 88 fd 00 00 00    	js     80599e <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8058a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8058a5:	48 89 c7             	mov    %rax,%rdi
+  8058a8:	49 89 df             	mov    %rbx,%r15
+  8058ab:	48 b8 35 a0 ff ff ff 	movabs $0xffffffffffffa035,%rax
+  8058b2:	ff ff ff 
+  8058b5:	48 01 d8             	add    %rbx,%rax
+  8058b8:	ff d0                	call   *%rax
+  8058ba:	48 89 c2             	mov    %rax,%rdx
+  8058bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058c1:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8058c7:	48 89 d1             	mov    %rdx,%rcx
+  8058ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058cf:	48 89 c6             	mov    %rax,%rsi
+  8058d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058d7:	49 89 df             	mov    %rbx,%r15
+  8058da:	48 b8 6f 95 ff ff ff 	movabs $0xffffffffffff956f,%rax
+  8058e1:	ff ff ff 
+  8058e4:	48 01 d8             	add    %rbx,%rax
+  8058e7:	ff d0                	call   *%rax
+  8058e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058f0:	0f 88 87 00 00 00    	js     80597d <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8058f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8058fa:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805901:	00 00 00 
+  805904:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805907:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805909:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80590d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805914:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805918:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  80591f:	00 00 00 
+  805922:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805925:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805927:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80592b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805932:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805936:	48 89 c7             	mov    %rax,%rdi
+  805939:	49 89 df             	mov    %rbx,%r15
+  80593c:	48 b8 fe 9f ff ff ff 	movabs $0xffffffffffff9ffe,%rax
+  805943:	ff ff ff 
+  805946:	48 01 d8             	add    %rbx,%rax
+  805949:	ff d0                	call   *%rax
+  80594b:	89 c2                	mov    %eax,%edx
+  80594d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805951:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805953:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805957:	48 89 c7             	mov    %rax,%rdi
+  80595a:	49 89 df             	mov    %rbx,%r15
+  80595d:	48 b8 fe 9f ff ff ff 	movabs $0xffffffffffff9ffe,%rax
+  805964:	ff ff ff 
+  805967:	48 01 d8             	add    %rbx,%rax
+  80596a:	ff d0                	call   *%rax
+  80596c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805970:	48 83 c2 04          	add    $0x4,%rdx
+  805974:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80597b:	eb 67                	jmp    8059e4 <pipe+0x25f>
+		goto err3;
+  80597d:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80597e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805982:	48 89 c6             	mov    %rax,%rsi
+  805985:	bf 00 00 00 00       	mov    $0x0,%edi
+  80598a:	49 89 df             	mov    %rbx,%r15
+  80598d:	48 b8 e2 95 ff ff ff 	movabs $0xffffffffffff95e2,%rax
+  805994:	ff ff ff 
+  805997:	48 01 d8             	add    %rbx,%rax
+  80599a:	ff d0                	call   *%rax
+  80599c:	eb 01                	jmp    80599f <pipe+0x21a>
+		goto err2;
+  80599e:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80599f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059a3:	48 89 c6             	mov    %rax,%rsi
+  8059a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059ab:	49 89 df             	mov    %rbx,%r15
+  8059ae:	48 b8 e2 95 ff ff ff 	movabs $0xffffffffffff95e2,%rax
+  8059b5:	ff ff ff 
+  8059b8:	48 01 d8             	add    %rbx,%rax
+  8059bb:	ff d0                	call   *%rax
+  8059bd:	eb 01                	jmp    8059c0 <pipe+0x23b>
+		goto err1;
+  8059bf:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8059c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059c4:	48 89 c6             	mov    %rax,%rsi
+  8059c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059cc:	49 89 df             	mov    %rbx,%r15
+  8059cf:	48 b8 e2 95 ff ff ff 	movabs $0xffffffffffff95e2,%rax
+  8059d6:	ff ff ff 
+  8059d9:	48 01 d8             	add    %rbx,%rax
+  8059dc:	ff d0                	call   *%rax
+  8059de:	eb 01                	jmp    8059e1 <pipe+0x25c>
+		goto err;
+  8059e0:	90                   	nop
+err:
+	return r;
+  8059e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8059e4:	48 83 c4 30          	add    $0x30,%rsp
+  8059e8:	5b                   	pop    %rbx
+  8059e9:	41 5f                	pop    %r15
+  8059eb:	5d                   	pop    %rbp
+  8059ec:	c3                   	ret
+
+00000000008059ed <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8059ed:	55                   	push   %rbp
+  8059ee:	48 89 e5             	mov    %rsp,%rbp
+  8059f1:	41 57                	push   %r15
+  8059f3:	41 54                	push   %r12
+  8059f5:	53                   	push   %rbx
+  8059f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8059fa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059fa <_pipeisclosed+0xd>
+  805a01:	49 bb 36 36 00 00 00 	movabs $0x3636,%r11
+  805a08:	00 00 00 
+  805a0b:	4c 01 db             	add    %r11,%rbx
+  805a0e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805a12:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805a16:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a1d:	ff ff ff 
+  805a20:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a24:	48 8b 00             	mov    (%rax),%rax
+  805a27:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805a2d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805a30:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a34:	48 89 c7             	mov    %rax,%rdi
+  805a37:	49 89 df             	mov    %rbx,%r15
+  805a3a:	48 b8 71 da ff ff ff 	movabs $0xffffffffffffda71,%rax
+  805a41:	ff ff ff 
+  805a44:	48 01 d8             	add    %rbx,%rax
+  805a47:	ff d0                	call   *%rax
+  805a49:	41 89 c4             	mov    %eax,%r12d
+  805a4c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805a50:	48 89 c7             	mov    %rax,%rdi
+  805a53:	49 89 df             	mov    %rbx,%r15
+  805a56:	48 b8 71 da ff ff ff 	movabs $0xffffffffffffda71,%rax
+  805a5d:	ff ff ff 
+  805a60:	48 01 d8             	add    %rbx,%rax
+  805a63:	ff d0                	call   *%rax
+  805a65:	41 39 c4             	cmp    %eax,%r12d
+  805a68:	0f 94 c0             	sete   %al
+  805a6b:	0f b6 c0             	movzbl %al,%eax
+  805a6e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805a71:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a78:	ff ff ff 
+  805a7b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a7f:	48 8b 00             	mov    (%rax),%rax
+  805a82:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805a88:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805a8b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a8e:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805a91:	75 05                	jne    805a98 <_pipeisclosed+0xab>
+			return ret;
+  805a93:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805a96:	eb 63                	jmp    805afb <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805a98:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a9b:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805a9e:	0f 84 72 ff ff ff    	je     805a16 <_pipeisclosed+0x29>
+  805aa4:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805aa8:	0f 85 68 ff ff ff    	jne    805a16 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805aae:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ab5:	ff ff ff 
+  805ab8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805abc:	48 8b 00             	mov    (%rax),%rax
+  805abf:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805ac5:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805ac8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805acb:	89 c6                	mov    %eax,%esi
+  805acd:	48 b8 4e e1 ff ff ff 	movabs $0xffffffffffffe14e,%rax
+  805ad4:	ff ff ff 
+  805ad7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805adb:	48 89 c7             	mov    %rax,%rdi
+  805ade:	49 89 df             	mov    %rbx,%r15
+  805ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ae6:	49 b8 8c 7a ff ff ff 	movabs $0xffffffffffff7a8c,%r8
+  805aed:	ff ff ff 
+  805af0:	49 01 d8             	add    %rbx,%r8
+  805af3:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805af6:	e9 1b ff ff ff       	jmp    805a16 <_pipeisclosed+0x29>
+	}
+}
+  805afb:	48 83 c4 28          	add    $0x28,%rsp
+  805aff:	5b                   	pop    %rbx
+  805b00:	41 5c                	pop    %r12
+  805b02:	41 5f                	pop    %r15
+  805b04:	5d                   	pop    %rbp
+  805b05:	c3                   	ret
+
+0000000000805b06 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805b06:	55                   	push   %rbp
+  805b07:	48 89 e5             	mov    %rsp,%rbp
+  805b0a:	41 57                	push   %r15
+  805b0c:	53                   	push   %rbx
+  805b0d:	48 83 ec 30          	sub    $0x30,%rsp
+  805b11:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b11 <pipeisclosed+0xb>
+  805b18:	49 bb 1f 35 00 00 00 	movabs $0x351f,%r11
+  805b1f:	00 00 00 
+  805b22:	4c 01 db             	add    %r11,%rbx
+  805b25:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805b28:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805b2c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805b2f:	48 89 d6             	mov    %rdx,%rsi
+  805b32:	89 c7                	mov    %eax,%edi
+  805b34:	49 89 df             	mov    %rbx,%r15
+  805b37:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  805b3e:	ff ff ff 
+  805b41:	48 01 d8             	add    %rbx,%rax
+  805b44:	ff d0                	call   *%rax
+  805b46:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b49:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b4d:	79 05                	jns    805b54 <pipeisclosed+0x4e>
+		return r;
+  805b4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b52:	eb 3b                	jmp    805b8f <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805b54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b58:	48 89 c7             	mov    %rax,%rdi
+  805b5b:	49 89 df             	mov    %rbx,%r15
+  805b5e:	48 b8 35 a0 ff ff ff 	movabs $0xffffffffffffa035,%rax
+  805b65:	ff ff ff 
+  805b68:	48 01 d8             	add    %rbx,%rax
+  805b6b:	ff d0                	call   *%rax
+  805b6d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805b71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b75:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805b79:	48 89 d6             	mov    %rdx,%rsi
+  805b7c:	48 89 c7             	mov    %rax,%rdi
+  805b7f:	48 b8 bd c9 ff ff ff 	movabs $0xffffffffffffc9bd,%rax
+  805b86:	ff ff ff 
+  805b89:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b8d:	ff d0                	call   *%rax
+}
+  805b8f:	48 83 c4 30          	add    $0x30,%rsp
+  805b93:	5b                   	pop    %rbx
+  805b94:	41 5f                	pop    %r15
+  805b96:	5d                   	pop    %rbp
+  805b97:	c3                   	ret
+
+0000000000805b98 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805b98:	55                   	push   %rbp
+  805b99:	48 89 e5             	mov    %rsp,%rbp
+  805b9c:	41 57                	push   %r15
+  805b9e:	53                   	push   %rbx
+  805b9f:	48 83 ec 40          	sub    $0x40,%rsp
+  805ba3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ba3 <devpipe_read+0xb>
+  805baa:	49 bb 8d 34 00 00 00 	movabs $0x348d,%r11
+  805bb1:	00 00 00 
+  805bb4:	4c 01 db             	add    %r11,%rbx
+  805bb7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805bbb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805bbf:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805bc3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805bc7:	48 89 c7             	mov    %rax,%rdi
+  805bca:	49 89 df             	mov    %rbx,%r15
+  805bcd:	48 b8 35 a0 ff ff ff 	movabs $0xffffffffffffa035,%rax
+  805bd4:	ff ff ff 
+  805bd7:	48 01 d8             	add    %rbx,%rax
+  805bda:	ff d0                	call   *%rax
+  805bdc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805be0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805be4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805be8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805bef:	00 
+  805bf0:	e9 a1 00 00 00       	jmp    805c96 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805bf5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805bfa:	74 09                	je     805c05 <devpipe_read+0x6d>
+				return i;
+  805bfc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c00:	e9 9f 00 00 00       	jmp    805ca4 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805c05:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c09:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c0d:	48 89 d6             	mov    %rdx,%rsi
+  805c10:	48 89 c7             	mov    %rax,%rdi
+  805c13:	48 b8 bd c9 ff ff ff 	movabs $0xffffffffffffc9bd,%rax
+  805c1a:	ff ff ff 
+  805c1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c21:	ff d0                	call   *%rax
+  805c23:	85 c0                	test   %eax,%eax
+  805c25:	74 07                	je     805c2e <devpipe_read+0x96>
+				return 0;
+  805c27:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c2c:	eb 76                	jmp    805ca4 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805c2e:	49 89 df             	mov    %rbx,%r15
+  805c31:	48 b8 b5 94 ff ff ff 	movabs $0xffffffffffff94b5,%rax
+  805c38:	ff ff ff 
+  805c3b:	48 01 d8             	add    %rbx,%rax
+  805c3e:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805c40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c44:	8b 10                	mov    (%rax),%edx
+  805c46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c4a:	8b 40 04             	mov    0x4(%rax),%eax
+  805c4d:	39 c2                	cmp    %eax,%edx
+  805c4f:	74 a4                	je     805bf5 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805c51:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c55:	8b 10                	mov    (%rax),%edx
+  805c57:	89 d0                	mov    %edx,%eax
+  805c59:	c1 f8 1f             	sar    $0x1f,%eax
+  805c5c:	c1 e8 1b             	shr    $0x1b,%eax
+  805c5f:	01 c2                	add    %eax,%edx
+  805c61:	83 e2 1f             	and    $0x1f,%edx
+  805c64:	29 c2                	sub    %eax,%edx
+  805c66:	89 d6                	mov    %edx,%esi
+  805c68:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805c6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c70:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805c74:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c78:	48 63 c6             	movslq %esi,%rax
+  805c7b:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805c80:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805c82:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c86:	8b 00                	mov    (%rax),%eax
+  805c88:	8d 50 01             	lea    0x1(%rax),%edx
+  805c8b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c8f:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805c91:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805c96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c9a:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805c9e:	72 a0                	jb     805c40 <devpipe_read+0xa8>
+	}
+	return i;
+  805ca0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805ca4:	48 83 c4 40          	add    $0x40,%rsp
+  805ca8:	5b                   	pop    %rbx
+  805ca9:	41 5f                	pop    %r15
+  805cab:	5d                   	pop    %rbp
+  805cac:	c3                   	ret
+
+0000000000805cad <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805cad:	55                   	push   %rbp
+  805cae:	48 89 e5             	mov    %rsp,%rbp
+  805cb1:	41 57                	push   %r15
+  805cb3:	53                   	push   %rbx
+  805cb4:	48 83 ec 40          	sub    $0x40,%rsp
+  805cb8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cb8 <devpipe_write+0xb>
+  805cbf:	49 bb 78 33 00 00 00 	movabs $0x3378,%r11
+  805cc6:	00 00 00 
+  805cc9:	4c 01 db             	add    %r11,%rbx
+  805ccc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805cd0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805cd4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805cd8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805cdc:	48 89 c7             	mov    %rax,%rdi
+  805cdf:	49 89 df             	mov    %rbx,%r15
+  805ce2:	48 b8 35 a0 ff ff ff 	movabs $0xffffffffffffa035,%rax
+  805ce9:	ff ff ff 
+  805cec:	48 01 d8             	add    %rbx,%rax
+  805cef:	ff d0                	call   *%rax
+  805cf1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805cf5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805cf9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805cfd:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805d04:	00 
+  805d05:	e9 a0 00 00 00       	jmp    805daa <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805d0a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d12:	48 89 d6             	mov    %rdx,%rsi
+  805d15:	48 89 c7             	mov    %rax,%rdi
+  805d18:	48 b8 bd c9 ff ff ff 	movabs $0xffffffffffffc9bd,%rax
+  805d1f:	ff ff ff 
+  805d22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d26:	ff d0                	call   *%rax
+  805d28:	85 c0                	test   %eax,%eax
+  805d2a:	74 0a                	je     805d36 <devpipe_write+0x89>
+				return 0;
+  805d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d31:	e9 82 00 00 00       	jmp    805db8 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805d36:	49 89 df             	mov    %rbx,%r15
+  805d39:	48 b8 b5 94 ff ff ff 	movabs $0xffffffffffff94b5,%rax
+  805d40:	ff ff ff 
+  805d43:	48 01 d8             	add    %rbx,%rax
+  805d46:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805d48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d4c:	8b 40 04             	mov    0x4(%rax),%eax
+  805d4f:	48 63 d0             	movslq %eax,%rdx
+  805d52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d56:	8b 00                	mov    (%rax),%eax
+  805d58:	48 98                	cltq
+  805d5a:	48 83 c0 20          	add    $0x20,%rax
+  805d5e:	48 39 c2             	cmp    %rax,%rdx
+  805d61:	73 a7                	jae    805d0a <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805d63:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805d67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d6b:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805d6f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d73:	8b 50 04             	mov    0x4(%rax),%edx
+  805d76:	89 d0                	mov    %edx,%eax
+  805d78:	c1 f8 1f             	sar    $0x1f,%eax
+  805d7b:	c1 e8 1b             	shr    $0x1b,%eax
+  805d7e:	01 c2                	add    %eax,%edx
+  805d80:	83 e2 1f             	and    $0x1f,%edx
+  805d83:	29 c2                	sub    %eax,%edx
+  805d85:	89 d0                	mov    %edx,%eax
+  805d87:	0f b6 09             	movzbl (%rcx),%ecx
+  805d8a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d8e:	48 98                	cltq
+  805d90:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805d94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d98:	8b 40 04             	mov    0x4(%rax),%eax
+  805d9b:	8d 50 01             	lea    0x1(%rax),%edx
+  805d9e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805da2:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805da5:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805daa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dae:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805db2:	72 94                	jb     805d48 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805db4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805db8:	48 83 c4 40          	add    $0x40,%rsp
+  805dbc:	5b                   	pop    %rbx
+  805dbd:	41 5f                	pop    %r15
+  805dbf:	5d                   	pop    %rbp
+  805dc0:	c3                   	ret
+
+0000000000805dc1 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805dc1:	55                   	push   %rbp
+  805dc2:	48 89 e5             	mov    %rsp,%rbp
+  805dc5:	41 57                	push   %r15
+  805dc7:	53                   	push   %rbx
+  805dc8:	48 83 ec 20          	sub    $0x20,%rsp
+  805dcc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805dcc <devpipe_stat+0xb>
+  805dd3:	49 bb 64 32 00 00 00 	movabs $0x3264,%r11
+  805dda:	00 00 00 
+  805ddd:	4c 01 db             	add    %r11,%rbx
+  805de0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805de4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805de8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805dec:	48 89 c7             	mov    %rax,%rdi
+  805def:	49 89 df             	mov    %rbx,%r15
+  805df2:	48 b8 35 a0 ff ff ff 	movabs $0xffffffffffffa035,%rax
+  805df9:	ff ff ff 
+  805dfc:	48 01 d8             	add    %rbx,%rax
+  805dff:	ff d0                	call   *%rax
+  805e01:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805e05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e09:	48 ba 61 e1 ff ff ff 	movabs $0xffffffffffffe161,%rdx
+  805e10:	ff ff ff 
+  805e13:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805e17:	48 89 d6             	mov    %rdx,%rsi
+  805e1a:	48 89 c7             	mov    %rax,%rdi
+  805e1d:	49 89 df             	mov    %rbx,%r15
+  805e20:	48 b8 4e 88 ff ff ff 	movabs $0xffffffffffff884e,%rax
+  805e27:	ff ff ff 
+  805e2a:	48 01 d8             	add    %rbx,%rax
+  805e2d:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805e2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e33:	8b 50 04             	mov    0x4(%rax),%edx
+  805e36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e3a:	8b 00                	mov    (%rax),%eax
+  805e3c:	29 c2                	sub    %eax,%edx
+  805e3e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e42:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805e48:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e4c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805e53:	00 00 00 
+	stat->st_dev = &devpipe;
+  805e56:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e5a:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805e61:	00 00 00 
+  805e64:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805e68:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e74:	48 83 c4 20          	add    $0x20,%rsp
+  805e78:	5b                   	pop    %rbx
+  805e79:	41 5f                	pop    %r15
+  805e7b:	5d                   	pop    %rbp
+  805e7c:	c3                   	ret
+
+0000000000805e7d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805e7d:	55                   	push   %rbp
+  805e7e:	48 89 e5             	mov    %rsp,%rbp
+  805e81:	41 57                	push   %r15
+  805e83:	53                   	push   %rbx
+  805e84:	48 83 ec 10          	sub    $0x10,%rsp
+  805e88:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e88 <devpipe_close+0xb>
+  805e8f:	49 bb a8 31 00 00 00 	movabs $0x31a8,%r11
+  805e96:	00 00 00 
+  805e99:	4c 01 db             	add    %r11,%rbx
+  805e9c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805ea0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ea4:	48 89 c6             	mov    %rax,%rsi
+  805ea7:	bf 00 00 00 00       	mov    $0x0,%edi
+  805eac:	49 89 df             	mov    %rbx,%r15
+  805eaf:	48 b8 e2 95 ff ff ff 	movabs $0xffffffffffff95e2,%rax
+  805eb6:	ff ff ff 
+  805eb9:	48 01 d8             	add    %rbx,%rax
+  805ebc:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805ebe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ec2:	48 89 c7             	mov    %rax,%rdi
+  805ec5:	49 89 df             	mov    %rbx,%r15
+  805ec8:	48 b8 35 a0 ff ff ff 	movabs $0xffffffffffffa035,%rax
+  805ecf:	ff ff ff 
+  805ed2:	48 01 d8             	add    %rbx,%rax
+  805ed5:	ff d0                	call   *%rax
+  805ed7:	48 89 c6             	mov    %rax,%rsi
+  805eda:	bf 00 00 00 00       	mov    $0x0,%edi
+  805edf:	49 89 df             	mov    %rbx,%r15
+  805ee2:	48 b8 e2 95 ff ff ff 	movabs $0xffffffffffff95e2,%rax
+  805ee9:	ff ff ff 
+  805eec:	48 01 d8             	add    %rbx,%rax
+  805eef:	ff d0                	call   *%rax
+}
+  805ef1:	48 83 c4 10          	add    $0x10,%rsp
+  805ef5:	5b                   	pop    %rbx
+  805ef6:	41 5f                	pop    %r15
+  805ef8:	5d                   	pop    %rbp
+  805ef9:	c3                   	ret
+
+0000000000805efa <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  805efa:	55                   	push   %rbp
+  805efb:	48 89 e5             	mov    %rsp,%rbp
+  805efe:	41 57                	push   %r15
+  805f00:	48 83 ec 28          	sub    $0x28,%rsp
+  805f04:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f04 <cputchar+0xa>
+  805f0b:	49 bb 2c 31 00 00 00 	movabs $0x312c,%r11
+  805f12:	00 00 00 
+  805f15:	4c 01 d8             	add    %r11,%rax
+  805f18:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  805f1b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805f1e:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  805f21:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  805f25:	be 01 00 00 00       	mov    $0x1,%esi
+  805f2a:	48 89 d7             	mov    %rdx,%rdi
+  805f2d:	49 89 c7             	mov    %rax,%r15
+  805f30:	48 ba 52 93 ff ff ff 	movabs $0xffffffffffff9352,%rdx
+  805f37:	ff ff ff 
+  805f3a:	48 01 c2             	add    %rax,%rdx
+  805f3d:	ff d2                	call   *%rdx
+}
+  805f3f:	90                   	nop
+  805f40:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805f44:	c9                   	leave
+  805f45:	c3                   	ret
+
+0000000000805f46 <getchar>:
+
+int
+getchar(void)
+{
+  805f46:	55                   	push   %rbp
+  805f47:	48 89 e5             	mov    %rsp,%rbp
+  805f4a:	41 57                	push   %r15
+  805f4c:	48 83 ec 18          	sub    $0x18,%rsp
+  805f50:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f50 <getchar+0xa>
+  805f57:	49 bb e0 30 00 00 00 	movabs $0x30e0,%r11
+  805f5e:	00 00 00 
+  805f61:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805f64:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805f68:	ba 01 00 00 00       	mov    $0x1,%edx
+  805f6d:	48 89 ce             	mov    %rcx,%rsi
+  805f70:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f75:	49 89 c7             	mov    %rax,%r15
+  805f78:	48 b9 75 a6 ff ff ff 	movabs $0xffffffffffffa675,%rcx
+  805f7f:	ff ff ff 
+  805f82:	48 01 c1             	add    %rax,%rcx
+  805f85:	ff d1                	call   *%rcx
+  805f87:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  805f8a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f8e:	79 05                	jns    805f95 <getchar+0x4f>
+		return r;
+  805f90:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f93:	eb 14                	jmp    805fa9 <getchar+0x63>
+	if (r < 1)
+  805f95:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f99:	7f 07                	jg     805fa2 <getchar+0x5c>
+		return -E_EOF;
+  805f9b:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  805fa0:	eb 07                	jmp    805fa9 <getchar+0x63>
+	return c;
+  805fa2:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805fa6:	0f b6 c0             	movzbl %al,%eax
+}
+  805fa9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805fad:	c9                   	leave
+  805fae:	c3                   	ret
+
+0000000000805faf <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  805faf:	55                   	push   %rbp
+  805fb0:	48 89 e5             	mov    %rsp,%rbp
+  805fb3:	41 57                	push   %r15
+  805fb5:	53                   	push   %rbx
+  805fb6:	48 83 ec 20          	sub    $0x20,%rsp
+  805fba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fba <iscons+0xb>
+  805fc1:	49 bb 76 30 00 00 00 	movabs $0x3076,%r11
+  805fc8:	00 00 00 
+  805fcb:	4c 01 db             	add    %r11,%rbx
+  805fce:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805fd1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805fd5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805fd8:	48 89 d6             	mov    %rdx,%rsi
+  805fdb:	89 c7                	mov    %eax,%edi
+  805fdd:	49 89 df             	mov    %rbx,%r15
+  805fe0:	48 b8 2e a1 ff ff ff 	movabs $0xffffffffffffa12e,%rax
+  805fe7:	ff ff ff 
+  805fea:	48 01 d8             	add    %rbx,%rax
+  805fed:	ff d0                	call   *%rax
+  805fef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ff2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ff6:	79 05                	jns    805ffd <iscons+0x4e>
+		return r;
+  805ff8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ffb:	eb 1b                	jmp    806018 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  805ffd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806001:	8b 10                	mov    (%rax),%edx
+  806003:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  80600a:	00 00 00 
+  80600d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806010:	39 c2                	cmp    %eax,%edx
+  806012:	0f 94 c0             	sete   %al
+  806015:	0f b6 c0             	movzbl %al,%eax
+}
+  806018:	48 83 c4 20          	add    $0x20,%rsp
+  80601c:	5b                   	pop    %rbx
+  80601d:	41 5f                	pop    %r15
+  80601f:	5d                   	pop    %rbp
+  806020:	c3                   	ret
+
+0000000000806021 <opencons>:
+
+int
+opencons(void)
+{
+  806021:	55                   	push   %rbp
+  806022:	48 89 e5             	mov    %rsp,%rbp
+  806025:	41 57                	push   %r15
+  806027:	53                   	push   %rbx
+  806028:	48 83 ec 10          	sub    $0x10,%rsp
+  80602c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80602c <opencons+0xb>
+  806033:	49 bb 04 30 00 00 00 	movabs $0x3004,%r11
+  80603a:	00 00 00 
+  80603d:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806040:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806044:	48 89 c7             	mov    %rax,%rdi
+  806047:	49 89 df             	mov    %rbx,%r15
+  80604a:	48 b8 78 a0 ff ff ff 	movabs $0xffffffffffffa078,%rax
+  806051:	ff ff ff 
+  806054:	48 01 d8             	add    %rbx,%rax
+  806057:	ff d0                	call   *%rax
+  806059:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80605c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806060:	79 05                	jns    806067 <opencons+0x46>
+		return r;
+  806062:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806065:	eb 68                	jmp    8060cf <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806067:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80606b:	ba 07 04 00 00       	mov    $0x407,%edx
+  806070:	48 89 c6             	mov    %rax,%rsi
+  806073:	bf 00 00 00 00       	mov    $0x0,%edi
+  806078:	49 89 df             	mov    %rbx,%r15
+  80607b:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  806082:	ff ff ff 
+  806085:	48 01 d8             	add    %rbx,%rax
+  806088:	ff d0                	call   *%rax
+  80608a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80608d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806091:	79 05                	jns    806098 <opencons+0x77>
+		return r;
+  806093:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806096:	eb 37                	jmp    8060cf <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806098:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80609c:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  8060a3:	00 00 00 
+  8060a6:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8060a9:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8060ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060af:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8060b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060ba:	48 89 c7             	mov    %rax,%rdi
+  8060bd:	49 89 df             	mov    %rbx,%r15
+  8060c0:	48 b8 fe 9f ff ff ff 	movabs $0xffffffffffff9ffe,%rax
+  8060c7:	ff ff ff 
+  8060ca:	48 01 d8             	add    %rbx,%rax
+  8060cd:	ff d0                	call   *%rax
+}
+  8060cf:	48 83 c4 10          	add    $0x10,%rsp
+  8060d3:	5b                   	pop    %rbx
+  8060d4:	41 5f                	pop    %r15
+  8060d6:	5d                   	pop    %rbp
+  8060d7:	c3                   	ret
+
+00000000008060d8 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8060d8:	55                   	push   %rbp
+  8060d9:	48 89 e5             	mov    %rsp,%rbp
+  8060dc:	41 57                	push   %r15
+  8060de:	53                   	push   %rbx
+  8060df:	48 83 ec 30          	sub    $0x30,%rsp
+  8060e3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060e3 <devcons_read+0xb>
+  8060ea:	49 bb 4d 2f 00 00 00 	movabs $0x2f4d,%r11
+  8060f1:	00 00 00 
+  8060f4:	4c 01 db             	add    %r11,%rbx
+  8060f7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8060fb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8060ff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806103:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806108:	75 19                	jne    806123 <devcons_read+0x4b>
+		return 0;
+  80610a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80610f:	eb 55                	jmp    806166 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806111:	49 89 df             	mov    %rbx,%r15
+  806114:	48 b8 b5 94 ff ff ff 	movabs $0xffffffffffff94b5,%rax
+  80611b:	ff ff ff 
+  80611e:	48 01 d8             	add    %rbx,%rax
+  806121:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806123:	49 89 df             	mov    %rbx,%r15
+  806126:	48 b8 b1 93 ff ff ff 	movabs $0xffffffffffff93b1,%rax
+  80612d:	ff ff ff 
+  806130:	48 01 d8             	add    %rbx,%rax
+  806133:	ff d0                	call   *%rax
+  806135:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806138:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80613c:	74 d3                	je     806111 <devcons_read+0x39>
+	if (c < 0)
+  80613e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806142:	79 05                	jns    806149 <devcons_read+0x71>
+		return c;
+  806144:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806147:	eb 1d                	jmp    806166 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806149:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80614d:	75 07                	jne    806156 <devcons_read+0x7e>
+		return 0;
+  80614f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806154:	eb 10                	jmp    806166 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806156:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806159:	89 c2                	mov    %eax,%edx
+  80615b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80615f:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806161:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806166:	48 83 c4 30          	add    $0x30,%rsp
+  80616a:	5b                   	pop    %rbx
+  80616b:	41 5f                	pop    %r15
+  80616d:	5d                   	pop    %rbp
+  80616e:	c3                   	ret
+
+000000000080616f <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80616f:	55                   	push   %rbp
+  806170:	48 89 e5             	mov    %rsp,%rbp
+  806173:	41 57                	push   %r15
+  806175:	53                   	push   %rbx
+  806176:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80617d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80617d <devcons_write+0xe>
+  806184:	49 bb b3 2e 00 00 00 	movabs $0x2eb3,%r11
+  80618b:	00 00 00 
+  80618e:	4c 01 db             	add    %r11,%rbx
+  806191:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806198:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  80619f:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8061a6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8061ad:	e9 80 00 00 00       	jmp    806232 <devcons_write+0xc3>
+		m = n - tot;
+  8061b2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8061b9:	89 c2                	mov    %eax,%edx
+  8061bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061be:	29 c2                	sub    %eax,%edx
+  8061c0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8061c3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8061c6:	83 f8 7f             	cmp    $0x7f,%eax
+  8061c9:	76 07                	jbe    8061d2 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8061cb:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8061d2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8061d5:	48 63 d0             	movslq %eax,%rdx
+  8061d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061db:	48 63 c8             	movslq %eax,%rcx
+  8061de:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8061e5:	48 01 c1             	add    %rax,%rcx
+  8061e8:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8061ef:	48 89 ce             	mov    %rcx,%rsi
+  8061f2:	48 89 c7             	mov    %rax,%rdi
+  8061f5:	49 89 df             	mov    %rbx,%r15
+  8061f8:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  8061ff:	ff ff ff 
+  806202:	48 01 d8             	add    %rbx,%rax
+  806205:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806207:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80620a:	48 63 d0             	movslq %eax,%rdx
+  80620d:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806214:	48 89 d6             	mov    %rdx,%rsi
+  806217:	48 89 c7             	mov    %rax,%rdi
+  80621a:	49 89 df             	mov    %rbx,%r15
+  80621d:	48 b8 52 93 ff ff ff 	movabs $0xffffffffffff9352,%rax
+  806224:	ff ff ff 
+  806227:	48 01 d8             	add    %rbx,%rax
+  80622a:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80622c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80622f:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806232:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806235:	48 98                	cltq
+  806237:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  80623e:	0f 82 6e ff ff ff    	jb     8061b2 <devcons_write+0x43>
+	}
+	return tot;
+  806244:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806247:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  80624e:	5b                   	pop    %rbx
+  80624f:	41 5f                	pop    %r15
+  806251:	5d                   	pop    %rbp
+  806252:	c3                   	ret
+
+0000000000806253 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806253:	55                   	push   %rbp
+  806254:	48 89 e5             	mov    %rsp,%rbp
+  806257:	48 83 ec 08          	sub    $0x8,%rsp
+  80625b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80625b <devcons_close+0x8>
+  806262:	49 bb d5 2d 00 00 00 	movabs $0x2dd5,%r11
+  806269:	00 00 00 
+  80626c:	4c 01 d8             	add    %r11,%rax
+  80626f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806273:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806278:	c9                   	leave
+  806279:	c3                   	ret
+
+000000000080627a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80627a:	55                   	push   %rbp
+  80627b:	48 89 e5             	mov    %rsp,%rbp
+  80627e:	41 57                	push   %r15
+  806280:	48 83 ec 18          	sub    $0x18,%rsp
+  806284:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806284 <devcons_stat+0xa>
+  80628b:	49 bb ac 2d 00 00 00 	movabs $0x2dac,%r11
+  806292:	00 00 00 
+  806295:	4c 01 d8             	add    %r11,%rax
+  806298:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80629c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8062a0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8062a4:	48 b9 6d e1 ff ff ff 	movabs $0xffffffffffffe16d,%rcx
+  8062ab:	ff ff ff 
+  8062ae:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8062b2:	48 89 ce             	mov    %rcx,%rsi
+  8062b5:	48 89 d7             	mov    %rdx,%rdi
+  8062b8:	49 89 c7             	mov    %rax,%r15
+  8062bb:	48 ba 4e 88 ff ff ff 	movabs $0xffffffffffff884e,%rdx
+  8062c2:	ff ff ff 
+  8062c5:	48 01 c2             	add    %rax,%rdx
+  8062c8:	ff d2                	call   *%rdx
+	return 0;
+  8062ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8062cf:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8062d3:	c9                   	leave
+  8062d4:	c3                   	ret
+
+00000000008062d5 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8062d5:	55                   	push   %rbp
+  8062d6:	48 89 e5             	mov    %rsp,%rbp
+  8062d9:	41 57                	push   %r15
+  8062db:	53                   	push   %rbx
+  8062dc:	48 83 ec 30          	sub    $0x30,%rsp
+  8062e0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8062e0 <ipc_recv+0xb>
+  8062e7:	49 bb 50 2d 00 00 00 	movabs $0x2d50,%r11
+  8062ee:	00 00 00 
+  8062f1:	4c 01 db             	add    %r11,%rbx
+  8062f4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8062f8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8062fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  806300:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806305:	75 0e                	jne    806315 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  806307:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80630e:	00 00 00 
+  806311:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  806315:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806319:	48 89 c7             	mov    %rax,%rdi
+  80631c:	49 89 df             	mov    %rbx,%r15
+  80631f:	48 b8 33 98 ff ff ff 	movabs $0xffffffffffff9833,%rax
+  806326:	ff ff ff 
+  806329:	48 01 d8             	add    %rbx,%rax
+  80632c:	ff d0                	call   *%rax
+  80632e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  806331:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806336:	74 2a                	je     806362 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  806338:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80633c:	75 19                	jne    806357 <ipc_recv+0x82>
+  80633e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806345:	ff ff ff 
+  806348:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80634c:	48 8b 00             	mov    (%rax),%rax
+  80634f:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806355:	eb 05                	jmp    80635c <ipc_recv+0x87>
+  806357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80635c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806360:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806362:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806367:	74 2a                	je     806393 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  806369:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80636d:	75 19                	jne    806388 <ipc_recv+0xb3>
+  80636f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806376:	ff ff ff 
+  806379:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80637d:	48 8b 00             	mov    (%rax),%rax
+  806380:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806386:	eb 05                	jmp    80638d <ipc_recv+0xb8>
+  806388:	b8 00 00 00 00       	mov    $0x0,%eax
+  80638d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806391:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806393:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806397:	74 05                	je     80639e <ipc_recv+0xc9>
+		return res;
+  806399:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80639c:	eb 17                	jmp    8063b5 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  80639e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8063a5:	ff ff ff 
+  8063a8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8063ac:	48 8b 00             	mov    (%rax),%rax
+  8063af:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8063b5:	48 83 c4 30          	add    $0x30,%rsp
+  8063b9:	5b                   	pop    %rbx
+  8063ba:	41 5f                	pop    %r15
+  8063bc:	5d                   	pop    %rbp
+  8063bd:	c3                   	ret
+
+00000000008063be <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8063be:	55                   	push   %rbp
+  8063bf:	48 89 e5             	mov    %rsp,%rbp
+  8063c2:	41 57                	push   %r15
+  8063c4:	53                   	push   %rbx
+  8063c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8063c9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063c9 <ipc_send+0xb>
+  8063d0:	49 bb 67 2c 00 00 00 	movabs $0x2c67,%r11
+  8063d7:	00 00 00 
+  8063da:	4c 01 db             	add    %r11,%rbx
+  8063dd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8063e0:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8063e3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8063e7:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8063ea:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8063ef:	75 0e                	jne    8063ff <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8063f1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8063f8:	00 00 00 
+  8063fb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8063ff:	90                   	nop
+  806400:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806403:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806406:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80640a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80640d:	89 c7                	mov    %eax,%edi
+  80640f:	49 89 df             	mov    %rbx,%r15
+  806412:	48 b8 c9 97 ff ff ff 	movabs $0xffffffffffff97c9,%rax
+  806419:	ff ff ff 
+  80641c:	48 01 d8             	add    %rbx,%rax
+  80641f:	ff d0                	call   *%rax
+  806421:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  806424:	74 da                	je     806400 <ipc_send+0x42>
+		;
+}
+  806426:	90                   	nop
+  806427:	90                   	nop
+  806428:	48 83 c4 20          	add    $0x20,%rsp
+  80642c:	5b                   	pop    %rbx
+  80642d:	41 5f                	pop    %r15
+  80642f:	5d                   	pop    %rbp
+  806430:	c3                   	ret
+
+0000000000806431 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  806431:	55                   	push   %rbp
+  806432:	48 89 e5             	mov    %rsp,%rbp
+  806435:	41 57                	push   %r15
+  806437:	53                   	push   %rbx
+  806438:	48 83 ec 40          	sub    $0x40,%rsp
+  80643c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80643c <ipc_call+0xb>
+  806443:	49 bb f4 2b 00 00 00 	movabs $0x2bf4,%r11
+  80644a:	00 00 00 
+  80644d:	4c 01 db             	add    %r11,%rbx
+  806450:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806453:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806456:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80645a:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80645d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806461:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806465:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80646a:	75 0e                	jne    80647a <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  80646c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806473:	00 00 00 
+  806476:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80647a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80647f:	75 0e                	jne    80648f <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806481:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806488:	00 00 00 
+  80648b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80648f:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806492:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806496:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806499:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80649d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8064a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8064a6:	49 89 f8             	mov    %rdi,%r8
+  8064a9:	89 c7                	mov    %eax,%edi
+  8064ab:	49 89 df             	mov    %rbx,%r15
+  8064ae:	48 b8 8c 98 ff ff ff 	movabs $0xffffffffffff988c,%rax
+  8064b5:	ff ff ff 
+  8064b8:	48 01 d8             	add    %rbx,%rax
+  8064bb:	ff d0                	call   *%rax
+  8064bd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8064c0:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8064c5:	74 2a                	je     8064f1 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8064c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8064cb:	75 19                	jne    8064e6 <ipc_call+0xb5>
+  8064cd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8064d4:	ff ff ff 
+  8064d7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064db:	48 8b 00             	mov    (%rax),%rax
+  8064de:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8064e4:	eb 05                	jmp    8064eb <ipc_call+0xba>
+  8064e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064eb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8064ef:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8064f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8064f5:	74 05                	je     8064fc <ipc_call+0xcb>
+		return r;
+  8064f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064fa:	eb 17                	jmp    806513 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8064fc:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806503:	ff ff ff 
+  806506:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80650a:	48 8b 00             	mov    (%rax),%rax
+  80650d:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806513:	48 83 c4 40          	add    $0x40,%rsp
+  806517:	5b                   	pop    %rbx
+  806518:	41 5f                	pop    %r15
+  80651a:	5d                   	pop    %rbp
+  80651b:	c3                   	ret
+
+000000000080651c <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  80651c:	55                   	push   %rbp
+  80651d:	48 89 e5             	mov    %rsp,%rbp
+  806520:	41 57                	push   %r15
+  806522:	53                   	push   %rbx
+  806523:	48 83 ec 70          	sub    $0x70,%rsp
+  806527:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806527 <ipc_callw+0xb>
+  80652e:	49 bb 09 2b 00 00 00 	movabs $0x2b09,%r11
+  806535:	00 00 00 
+  806538:	4c 01 db             	add    %r11,%rbx
+  80653b:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  80653e:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806541:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806545:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806549:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  80654e:	76 0a                	jbe    80655a <ipc_callw+0x3e>
+		return -E_INVAL;
+  806550:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806555:	e9 b7 00 00 00       	jmp    806611 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  80655a:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80655e:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806562:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806566:	48 89 ce             	mov    %rcx,%rsi
+  806569:	48 89 c7             	mov    %rax,%rdi
+  80656c:	49 89 df             	mov    %rbx,%r15
+  80656f:	48 b8 2e 8c ff ff ff 	movabs $0xffffffffffff8c2e,%rax
+  806576:	ff ff ff 
+  806579:	48 01 d8             	add    %rbx,%rax
+  80657c:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  80657e:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806585:	00 
+  806586:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80658a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80658e:	48 01 d0             	add    %rdx,%rax
+  806591:	48 83 e8 01          	sub    $0x1,%rax
+  806595:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806599:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80659d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8065a2:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8065a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8065aa:	48 29 d0             	sub    %rdx,%rax
+  8065ad:	48 c1 e8 03          	shr    $0x3,%rax
+  8065b1:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  8065b5:	89 c1                	mov    %eax,%ecx
+  8065b7:	8b 75 98             	mov    -0x68(%rbp),%esi
+  8065ba:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  8065be:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8065c1:	49 89 d1             	mov    %rdx,%r9
+  8065c4:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8065cb:	00 00 00 
+  8065ce:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8065d5:	00 00 00 
+  8065d8:	89 c7                	mov    %eax,%edi
+  8065da:	49 89 df             	mov    %rbx,%r15
+  8065dd:	48 b8 8c 98 ff ff ff 	movabs $0xffffffffffff988c,%rax
+  8065e4:	ff ff ff 
+  8065e7:	48 01 d8             	add    %rbx,%rax
+  8065ea:	ff d0                	call   *%rax
+  8065ec:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8065ef:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8065f3:	74 05                	je     8065fa <ipc_callw+0xde>
+		return r;
+  8065f5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8065f8:	eb 17                	jmp    806611 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8065fa:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806601:	ff ff ff 
+  806604:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806608:	48 8b 00             	mov    (%rax),%rax
+  80660b:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806611:	48 83 c4 70          	add    $0x70,%rsp
+  806615:	5b                   	pop    %rbx
+  806616:	41 5f                	pop    %r15
+  806618:	5d                   	pop    %rbp
+  806619:	c3                   	ret
+
+000000000080661a <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  80661a:	55                   	push   %rbp
+  80661b:	48 89 e5             	mov    %rsp,%rbp
+  80661e:	41 57                	push   %r15
+  806620:	53                   	push   %rbx
+  806621:	48 83 ec 40          	sub    $0x40,%rsp
+  806625:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806625 <ipc_callv+0xb>
+  80662c:	49 bb 0b 2a 00 00 00 	movabs $0x2a0b,%r11
+  806633:	00 00 00 
+  806636:	4c 01 db             	add    %r11,%rbx
+  806639:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80663c:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  80663f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806643:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806646:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  80664a:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  80664e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806655:	00 00 00 
+  806658:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  80665c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806660:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806664:	74 11                	je     806677 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806666:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80666a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  80666e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806671:	c1 e0 14             	shl    $0x14,%eax
+  806674:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806677:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  80667b:	74 14                	je     806691 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  80667d:	8b 45 20             	mov    0x20(%rbp),%eax
+  806680:	83 e8 01             	sub    $0x1,%eax
+  806683:	48 63 d0             	movslq %eax,%rdx
+  806686:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80668a:	48 09 d0             	or     %rdx,%rax
+  80668d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806691:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806694:	c1 e0 10             	shl    $0x10,%eax
+  806697:	0b 45 10             	or     0x10(%rbp),%eax
+  80669a:	89 c1                	mov    %eax,%ecx
+  80669c:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80669f:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8066a3:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8066a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8066ab:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8066ae:	4d 89 c1             	mov    %r8,%r9
+  8066b1:	49 89 f8             	mov    %rdi,%r8
+  8066b4:	89 c7                	mov    %eax,%edi
+  8066b6:	49 89 df             	mov    %rbx,%r15
+  8066b9:	48 b8 8c 98 ff ff ff 	movabs $0xffffffffffff988c,%rax
+  8066c0:	ff ff ff 
+  8066c3:	48 01 d8             	add    %rbx,%rax
+  8066c6:	ff d0                	call   *%rax
+  8066c8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8066cb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8066cf:	74 05                	je     8066d6 <ipc_callv+0xbc>
+		return r;
+  8066d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8066d4:	eb 17                	jmp    8066ed <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8066d6:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8066dd:	ff ff ff 
+  8066e0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8066e4:	48 8b 00             	mov    (%rax),%rax
+  8066e7:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8066ed:	48 83 c4 40          	add    $0x40,%rsp
+  8066f1:	5b                   	pop    %rbx
+  8066f2:	41 5f                	pop    %r15
+  8066f4:	5d                   	pop    %rbp
+  8066f5:	c3                   	ret
+
+00000000008066f6 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8066f6:	55                   	push   %rbp
+  8066f7:	48 89 e5             	mov    %rsp,%rbp
+  8066fa:	41 57                	push   %r15
+  8066fc:	53                   	push   %rbx
+  8066fd:	48 83 ec 40          	sub    $0x40,%rsp
+  806701:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806701 <ipc_reply_recv+0xb>
+  806708:	49 bb 2f 29 00 00 00 	movabs $0x292f,%r11
+  80670f:	00 00 00 
+  806712:	4c 01 db             	add    %r11,%rbx
+  806715:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806718:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80671b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80671f:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806722:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806726:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80672a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80672f:	75 0e                	jne    80673f <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806731:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806738:	00 00 00 
+  80673b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80673f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806744:	75 0e                	jne    806754 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806746:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80674d:	00 00 00 
+  806750:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806754:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806757:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  80675b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80675f:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806762:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806766:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806769:	4d 89 c1             	mov    %r8,%r9
+  80676c:	49 89 f8             	mov    %rdi,%r8
+  80676f:	89 c7                	mov    %eax,%edi
+  806771:	49 89 df             	mov    %rbx,%r15
+  806774:	48 b8 00 99 ff ff ff 	movabs $0xffffffffffff9900,%rax
+  80677b:	ff ff ff 
+  80677e:	48 01 d8             	add    %rbx,%rax
+  806781:	ff d0                	call   *%rax
+  806783:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806786:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80678b:	74 2a                	je     8067b7 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80678d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806791:	75 19                	jne    8067ac <ipc_reply_recv+0xb6>
+  806793:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80679a:	ff ff ff 
+  80679d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8067a1:	48 8b 00             	mov    (%rax),%rax
+  8067a4:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8067aa:	eb 05                	jmp    8067b1 <ipc_reply_recv+0xbb>
+  8067ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8067b5:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  8067b7:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  8067bc:	74 2a                	je     8067e8 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8067be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067c2:	75 19                	jne    8067dd <ipc_reply_recv+0xe7>
+  8067c4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8067cb:	ff ff ff 
+  8067ce:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8067d2:	48 8b 00             	mov    (%rax),%rax
+  8067d5:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8067db:	eb 05                	jmp    8067e2 <ipc_reply_recv+0xec>
+  8067dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067e2:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  8067e6:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8067e8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067ec:	74 05                	je     8067f3 <ipc_reply_recv+0xfd>
+		return r;
+  8067ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067f1:	eb 17                	jmp    80680a <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8067f3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8067fa:	ff ff ff 
+  8067fd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806801:	48 8b 00             	mov    (%rax),%rax
+  806804:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80680a:	48 83 c4 40          	add    $0x40,%rsp
+  80680e:	5b                   	pop    %rbx
+  80680f:	41 5f                	pop    %r15
+  806811:	5d                   	pop    %rbp
+  806812:	c3                   	ret
+
+0000000000806813 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806813:	55                   	push   %rbp
+  806814:	48 89 e5             	mov    %rsp,%rbp
+  806817:	41 57                	push   %r15
+  806819:	53                   	push   %rbx
+  80681a:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806821:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806821 <ipc_window_batch+0xe>
+  806828:	49 bb 0f 28 00 00 00 	movabs $0x280f,%r11
+  80682f:	00 00 00 
+  806832:	4c 01 db             	add    %r11,%rbx
+  806835:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  80683b:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806842:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806848:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  80684e:	e9 15 01 00 00       	jmp    806968 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806853:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806859:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80685c:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806863:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806866:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806869:	39 c2                	cmp    %eax,%edx
+  80686b:	0f 4e c2             	cmovle %edx,%eax
+  80686e:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806871:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806878:	eb 6b                	jmp    8068e5 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  80687a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80687d:	48 98                	cltq
+  80687f:	48 c1 e0 05          	shl    $0x5,%rax
+  806883:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806887:	48 01 e8             	add    %rbp,%rax
+  80688a:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806890:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806896:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806899:	c1 e0 0c             	shl    $0xc,%eax
+  80689c:	48 63 d0             	movslq %eax,%rdx
+  80689f:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  8068a6:	48 01 c2             	add    %rax,%rdx
+  8068a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068ac:	48 98                	cltq
+  8068ae:	48 c1 e0 05          	shl    $0x5,%rax
+  8068b2:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8068b6:	48 01 e8             	add    %rbp,%rax
+  8068b9:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  8068bf:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  8068c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068c5:	48 98                	cltq
+  8068c7:	48 c1 e0 05          	shl    $0x5,%rax
+  8068cb:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8068cf:	48 01 e8             	add    %rbp,%rax
+  8068d2:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  8068d9:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  8068df:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  8068e1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8068e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068e8:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  8068eb:	7c 8d                	jl     80687a <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  8068ed:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8068f4:	74 27                	je     80691d <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8068f6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8068f9:	48 63 d0             	movslq %eax,%rdx
+  8068fc:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806903:	48 89 d6             	mov    %rdx,%rsi
+  806906:	48 89 c7             	mov    %rax,%rdi
+  806909:	49 89 df             	mov    %rbx,%r15
+  80690c:	48 b8 a3 9b ff ff ff 	movabs $0xffffffffffff9ba3,%rax
+  806913:	ff ff ff 
+  806916:	48 01 d8             	add    %rbx,%rax
+  806919:	ff d0                	call   *%rax
+  80691b:	eb 25                	jmp    806942 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  80691d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806920:	48 63 d0             	movslq %eax,%rdx
+  806923:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  80692a:	48 89 d6             	mov    %rdx,%rsi
+  80692d:	48 89 c7             	mov    %rax,%rdi
+  806930:	49 89 df             	mov    %rbx,%r15
+  806933:	48 b8 01 9c ff ff ff 	movabs $0xffffffffffff9c01,%rax
+  80693a:	ff ff ff 
+  80693d:	48 01 d8             	add    %rbx,%rax
+  806940:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806942:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806945:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806949:	79 05                	jns    806950 <ipc_window_batch+0x13d>
+			return r;
+  80694b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80694e:	eb 2a                	jmp    80697a <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806950:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806953:	c1 e0 0c             	shl    $0xc,%eax
+  806956:	48 98                	cltq
+  806958:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  80695f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806962:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806968:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  80696f:	0f 8f de fe ff ff    	jg     806853 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806975:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80697a:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806981:	5b                   	pop    %rbx
+  806982:	41 5f                	pop    %r15
+  806984:	5d                   	pop    %rbp
+  806985:	c3                   	ret
+
+0000000000806986 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806986:	55                   	push   %rbp
+  806987:	48 89 e5             	mov    %rsp,%rbp
+  80698a:	48 83 ec 10          	sub    $0x10,%rsp
+  80698e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80698e <ipc_map_window+0x8>
+  806995:	49 bb a2 26 00 00 00 	movabs $0x26a2,%r11
+  80699c:	00 00 00 
+  80699f:	4c 01 d8             	add    %r11,%rax
+  8069a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8069a6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  8069a9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8069ac:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8069b0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8069b5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8069ba:	49 b8 e3 d7 ff ff ff 	movabs $0xffffffffffffd7e3,%r8
+  8069c1:	ff ff ff 
+  8069c4:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8069c8:	ff d0                	call   *%rax
+}
+  8069ca:	c9                   	leave
+  8069cb:	c3                   	ret
+
+00000000008069cc <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  8069cc:	55                   	push   %rbp
+  8069cd:	48 89 e5             	mov    %rsp,%rbp
+  8069d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8069d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8069d4 <ipc_unmap_window+0x8>
+  8069db:	49 bb 5c 26 00 00 00 	movabs $0x265c,%r11
+  8069e2:	00 00 00 
+  8069e5:	4c 01 d8             	add    %r11,%rax
+  8069e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8069ec:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8069ef:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8069f2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8069f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8069fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a00:	49 b8 e3 d7 ff ff ff 	movabs $0xffffffffffffd7e3,%r8
+  806a07:	ff ff ff 
+  806a0a:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806a0e:	ff d0                	call   *%rax
+}
+  806a10:	c9                   	leave
+  806a11:	c3                   	ret
+
+0000000000806a12 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806a12:	55                   	push   %rbp
+  806a13:	48 89 e5             	mov    %rsp,%rbp
+  806a16:	48 83 ec 18          	sub    $0x18,%rsp
+  806a1a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a1a <ipc_find_env+0x8>
+  806a21:	49 bb 16 26 00 00 00 	movabs $0x2616,%r11
+  806a28:	00 00 00 
+  806a2b:	4c 01 d8             	add    %r11,%rax
+  806a2e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806a31:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806a38:	eb 57                	jmp    806a91 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806a3a:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  806a41:	ff ff ff 
+  806a44:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806a48:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806a4b:	48 63 d2             	movslq %edx,%rdx
+  806a4e:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806a55:	48 01 ca             	add    %rcx,%rdx
+  806a58:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806a5f:	8b 12                	mov    (%rdx),%edx
+  806a61:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806a64:	75 27                	jne    806a8d <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806a66:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  806a6d:	ff ff ff 
+  806a70:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806a74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806a77:	48 98                	cltq
+  806a79:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806a80:	48 01 d0             	add    %rdx,%rax
+  806a83:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806a89:	8b 00                	mov    (%rax),%eax
+  806a8b:	eb 12                	jmp    806a9f <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806a8d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806a91:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806a98:	7e a0                	jle    806a3a <ipc_find_env+0x28>
+	}
+	return 0;
+  806a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a9f:	c9                   	leave
+  806aa0:	c3                   	ret
+
+0000000000806aa1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806aa1:	55                   	push   %rbp
+  806aa2:	48 89 e5             	mov    %rsp,%rbp
+  806aa5:	48 83 ec 18          	sub    $0x18,%rsp
+  806aa9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806aa9 <pageref+0x8>
+  806ab0:	49 bb 87 25 00 00 00 	movabs $0x2587,%r11
+  806ab7:	00 00 00 
+  806aba:	4c 01 d8             	add    %r11,%rax
+  806abd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806ac1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806ac5:	48 89 d1             	mov    %rdx,%rcx
+  806ac8:	48 c1 e9 15          	shr    $0x15,%rcx
+  806acc:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806ad3:	ff ff ff 
+  806ad6:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806ada:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806ade:	83 e2 01             	and    $0x1,%edx
+  806ae1:	48 85 d2             	test   %rdx,%rdx
+  806ae4:	75 07                	jne    806aed <pageref+0x4c>
+		return 0;
+  806ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  806aeb:	eb 64                	jmp    806b51 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806aed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806af1:	48 89 d1             	mov    %rdx,%rcx
+  806af4:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806af8:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806aff:	ff ff ff 
+  806b02:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806b06:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806b0a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806b0e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806b12:	83 e2 01             	and    $0x1,%edx
+  806b15:	48 85 d2             	test   %rdx,%rdx
+  806b18:	75 07                	jne    806b21 <pageref+0x80>
+		return 0;
+  806b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b1f:	eb 30                	jmp    806b51 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806b21:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806b25:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806b29:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806b30:	ff ff ff 
+  806b33:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806b37:	48 89 d0             	mov    %rdx,%rax
+  806b3a:	48 01 c0             	add    %rax,%rax
+  806b3d:	48 01 d0             	add    %rdx,%rax
+  806b40:	48 c1 e0 03          	shl    $0x3,%rax
+  806b44:	48 01 c8             	add    %rcx,%rax
+  806b47:	48 83 c0 08          	add    $0x8,%rax
+  806b4b:	0f b7 00             	movzwl (%rax),%eax
+  806b4e:	0f b7 c0             	movzwl %ax,%eax
+}
+  806b51:	c9                   	leave
+  806b52:	c3                   	ret
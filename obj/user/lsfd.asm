@@ -0,0 +1,10026 @@
+
+obj/user/lsfd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 ff 01 00 00       	call   800240 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004a <usage+0x7>
+  800051:	49 bb e6 8f 00 00 00 	movabs $0x8fe6,%r11
+  800058:	00 00 00 
+  80005b:	4c 01 db             	add    %r11,%rbx
+	cprintf("usage: lsfd [-1]\n");
+  80005e:	48 b8 88 d6 ff ff ff 	movabs $0xffffffffffffd688,%rax
+  800065:	ff ff ff 
+  800068:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80006c:	48 89 c7             	mov    %rax,%rdi
+  80006f:	49 89 df             	mov    %rbx,%r15
+  800072:	b8 00 00 00 00       	mov    $0x0,%eax
+  800077:	48 ba 98 74 ff ff ff 	movabs $0xffffffffffff7498,%rdx
+  80007e:	ff ff ff 
+  800081:	48 01 da             	add    %rbx,%rdx
+  800084:	ff d2                	call   *%rdx
+	exit();
+  800086:	49 89 df             	mov    %rbx,%r15
+  800089:	48 b8 d0 72 ff ff ff 	movabs $0xffffffffffff72d0,%rax
+  800090:	ff ff ff 
+  800093:	48 01 d8             	add    %rbx,%rax
+  800096:	ff d0                	call   *%rax
+}
+  800098:	90                   	nop
+  800099:	5b                   	pop    %rbx
+  80009a:	41 5f                	pop    %r15
+  80009c:	5d                   	pop    %rbp
+  80009d:	c3                   	ret
+
+000000000080009e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80009e:	55                   	push   %rbp
+  80009f:	48 89 e5             	mov    %rsp,%rbp
+  8000a2:	41 57                	push   %r15
+  8000a4:	53                   	push   %rbx
+  8000a5:	48 81 ec d0 00 00 00 	sub    $0xd0,%rsp
+  8000ac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000ac <umain+0xe>
+  8000b3:	49 bb 84 8f 00 00 00 	movabs $0x8f84,%r11
+  8000ba:	00 00 00 
+  8000bd:	4c 01 db             	add    %r11,%rbx
+  8000c0:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  8000c6:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+	int i, usefprint = 0;
+  8000cd:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+  8000d4:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8000db:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  8000e2:	48 8d 85 2c ff ff ff 	lea    -0xd4(%rbp),%rax
+  8000e9:	48 89 ce             	mov    %rcx,%rsi
+  8000ec:	48 89 c7             	mov    %rax,%rdi
+  8000ef:	49 89 df             	mov    %rbx,%r15
+  8000f2:	48 b8 bf 96 ff ff ff 	movabs $0xffffffffffff96bf,%rax
+  8000f9:	ff ff ff 
+  8000fc:	48 01 d8             	add    %rbx,%rax
+  8000ff:	ff d0                	call   *%rax
+	while ((i = argnext(&args)) >= 0)
+  800101:	eb 1f                	jmp    800122 <umain+0x84>
+		if (i == '1')
+  800103:	83 7d ec 31          	cmpl   $0x31,-0x14(%rbp)
+  800107:	75 09                	jne    800112 <umain+0x74>
+			usefprint = 1;
+  800109:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%rbp)
+  800110:	eb 10                	jmp    800122 <umain+0x84>
+		else
+			usage();
+  800112:	48 b8 13 70 ff ff ff 	movabs $0xffffffffffff7013,%rax
+  800119:	ff ff ff 
+  80011c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800120:	ff d0                	call   *%rax
+	while ((i = argnext(&args)) >= 0)
+  800122:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800129:	48 89 c7             	mov    %rax,%rdi
+  80012c:	49 89 df             	mov    %rbx,%r15
+  80012f:	48 b8 3c 97 ff ff ff 	movabs $0xffffffffffff973c,%rax
+  800136:	ff ff ff 
+  800139:	48 01 d8             	add    %rbx,%rax
+  80013c:	ff d0                	call   *%rax
+  80013e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800141:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800145:	79 bc                	jns    800103 <umain+0x65>
+
+	for (i = 0; i < 32; i++)
+  800147:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80014e:	e9 d8 00 00 00       	jmp    80022b <umain+0x18d>
+		if (fstat(i, &st) >= 0) {
+  800153:	48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+  80015a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80015d:	48 89 d6             	mov    %rdx,%rsi
+  800160:	89 c7                	mov    %eax,%edi
+  800162:	49 89 df             	mov    %rbx,%r15
+  800165:	48 b8 9c a4 ff ff ff 	movabs $0xffffffffffffa49c,%rax
+  80016c:	ff ff ff 
+  80016f:	48 01 d8             	add    %rbx,%rax
+  800172:	ff d0                	call   *%rax
+  800174:	85 c0                	test   %eax,%eax
+  800176:	0f 88 ab 00 00 00    	js     800227 <umain+0x189>
+			if (usefprint)
+  80017c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800180:	74 5c                	je     8001de <umain+0x140>
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+  800182:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+				fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  800186:	48 8b 48 08          	mov    0x8(%rax),%rcx
+  80018a:	8b 7d d0             	mov    -0x30(%rbp),%edi
+  80018d:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800190:	48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+  800197:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80019a:	48 83 ec 08          	sub    $0x8,%rsp
+  80019e:	51                   	push   %rcx
+  80019f:	41 89 f9             	mov    %edi,%r9d
+  8001a2:	41 89 f0             	mov    %esi,%r8d
+  8001a5:	48 89 d1             	mov    %rdx,%rcx
+  8001a8:	89 c2                	mov    %eax,%edx
+  8001aa:	48 b8 a0 d6 ff ff ff 	movabs $0xffffffffffffd6a0,%rax
+  8001b1:	ff ff ff 
+  8001b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001b8:	48 89 c6             	mov    %rax,%rsi
+  8001bb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001c0:	49 89 df             	mov    %rbx,%r15
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	49 ba c3 b2 ff ff ff 	movabs $0xffffffffffffb2c3,%r10
+  8001cf:	ff ff ff 
+  8001d2:	49 01 da             	add    %rbx,%r10
+  8001d5:	41 ff d2             	call   *%r10
+  8001d8:	48 83 c4 10          	add    $0x10,%rsp
+  8001dc:	eb 49                	jmp    800227 <umain+0x189>
+			else
+				cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+					i, st.st_name, st.st_isdir,
+					st.st_size, st.st_dev->dev_name);
+  8001de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+				cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8001e2:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8001e6:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8001e9:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8001ec:	48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+  8001f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001f6:	49 89 f9             	mov    %rdi,%r9
+  8001f9:	41 89 f0             	mov    %esi,%r8d
+  8001fc:	89 c6                	mov    %eax,%esi
+  8001fe:	48 b8 a0 d6 ff ff ff 	movabs $0xffffffffffffd6a0,%rax
+  800205:	ff ff ff 
+  800208:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80020c:	48 89 c7             	mov    %rax,%rdi
+  80020f:	49 89 df             	mov    %rbx,%r15
+  800212:	b8 00 00 00 00       	mov    $0x0,%eax
+  800217:	49 ba 98 74 ff ff ff 	movabs $0xffffffffffff7498,%r10
+  80021e:	ff ff ff 
+  800221:	49 01 da             	add    %rbx,%r10
+  800224:	41 ff d2             	call   *%r10
+	for (i = 0; i < 32; i++)
+  800227:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80022b:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80022f:	0f 8e 1e ff ff ff    	jle    800153 <umain+0xb5>
+		}
+}
+  800235:	90                   	nop
+  800236:	90                   	nop
+  800237:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80023b:	5b                   	pop    %rbx
+  80023c:	41 5f                	pop    %r15
+  80023e:	5d                   	pop    %rbp
+  80023f:	c3                   	ret
+
+0000000000800240 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800240:	55                   	push   %rbp
+  800241:	48 89 e5             	mov    %rsp,%rbp
+  800244:	41 57                	push   %r15
+  800246:	53                   	push   %rbx
+  800247:	48 83 ec 20          	sub    $0x20,%rsp
+  80024b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80024b <libmain+0xb>
+  800252:	49 bb e5 8d 00 00 00 	movabs $0x8de5,%r11
+  800259:	00 00 00 
+  80025c:	4c 01 db             	add    %r11,%rbx
+  80025f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800262:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800266:	49 89 df             	mov    %rbx,%r15
+  800269:	48 b8 6d 8e ff ff ff 	movabs $0xffffffffffff8e6d,%rax
+  800270:	ff ff ff 
+  800273:	48 01 d8             	add    %rbx,%rax
+  800276:	ff d0                	call   *%rax
+  800278:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  80027b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80027e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800283:	48 98                	cltq
+  800285:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80028c:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  800293:	ff ff ff 
+  800296:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80029a:	48 01 c2             	add    %rax,%rdx
+  80029d:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  8002a4:	00 00 00 
+  8002a7:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002ab:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8002af:	7e 15                	jle    8002c6 <libmain+0x86>
+		binaryname = argv[0];
+  8002b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8002b5:	48 8b 00             	mov    (%rax),%rax
+  8002b8:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  8002bf:	00 00 00 
+  8002c2:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8002c6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8002ca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8002cd:	48 89 d6             	mov    %rdx,%rsi
+  8002d0:	89 c7                	mov    %eax,%edi
+  8002d2:	49 89 df             	mov    %rbx,%r15
+  8002d5:	48 b8 6e 70 ff ff ff 	movabs $0xffffffffffff706e,%rax
+  8002dc:	ff ff ff 
+  8002df:	48 01 d8             	add    %rbx,%rax
+  8002e2:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8002e4:	49 89 df             	mov    %rbx,%r15
+  8002e7:	48 b8 d0 72 ff ff ff 	movabs $0xffffffffffff72d0,%rax
+  8002ee:	ff ff ff 
+  8002f1:	48 01 d8             	add    %rbx,%rax
+  8002f4:	ff d0                	call   *%rax
+}
+  8002f6:	90                   	nop
+  8002f7:	48 83 c4 20          	add    $0x20,%rsp
+  8002fb:	5b                   	pop    %rbx
+  8002fc:	41 5f                	pop    %r15
+  8002fe:	5d                   	pop    %rbp
+  8002ff:	c3                   	ret
+
+0000000000800300 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800300:	55                   	push   %rbp
+  800301:	48 89 e5             	mov    %rsp,%rbp
+  800304:	41 57                	push   %r15
+  800306:	53                   	push   %rbx
+  800307:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800307 <exit+0x7>
+  80030e:	49 bb 29 8d 00 00 00 	movabs $0x8d29,%r11
+  800315:	00 00 00 
+  800318:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80031b:	49 89 df             	mov    %rbx,%r15
+  80031e:	48 b8 35 9e ff ff ff 	movabs $0xffffffffffff9e35,%rax
+  800325:	ff ff ff 
+  800328:	48 01 d8             	add    %rbx,%rax
+  80032b:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80032d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800332:	49 89 df             	mov    %rbx,%r15
+  800335:	48 b8 11 8e ff ff ff 	movabs $0xffffffffffff8e11,%rax
+  80033c:	ff ff ff 
+  80033f:	48 01 d8             	add    %rbx,%rax
+  800342:	ff d0                	call   *%rax
+}
+  800344:	90                   	nop
+  800345:	5b                   	pop    %rbx
+  800346:	41 5f                	pop    %r15
+  800348:	5d                   	pop    %rbp
+  800349:	c3                   	ret
+
+000000000080034a <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  80034a:	55                   	push   %rbp
+  80034b:	48 89 e5             	mov    %rsp,%rbp
+  80034e:	41 57                	push   %r15
+  800350:	48 83 ec 18          	sub    $0x18,%rsp
+  800354:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800354 <putch+0xa>
+  80035b:	49 bb dc 8c 00 00 00 	movabs $0x8cdc,%r11
+  800362:	00 00 00 
+  800365:	4c 01 d8             	add    %r11,%rax
+  800368:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80036b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80036f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800373:	8b 12                	mov    (%rdx),%edx
+  800375:	8d 72 01             	lea    0x1(%rdx),%esi
+  800378:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80037c:	89 31                	mov    %esi,(%rcx)
+  80037e:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800381:	89 ce                	mov    %ecx,%esi
+  800383:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800387:	48 63 d2             	movslq %edx,%rdx
+  80038a:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80038f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800393:	8b 12                	mov    (%rdx),%edx
+  800395:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80039b:	75 33                	jne    8003d0 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80039d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003a1:	8b 12                	mov    (%rdx),%edx
+  8003a3:	48 63 d2             	movslq %edx,%rdx
+  8003a6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8003aa:	48 83 c1 08          	add    $0x8,%rcx
+  8003ae:	48 89 d6             	mov    %rdx,%rsi
+  8003b1:	48 89 cf             	mov    %rcx,%rdi
+  8003b4:	49 89 c7             	mov    %rax,%r15
+  8003b7:	48 ba 5e 8d ff ff ff 	movabs $0xffffffffffff8d5e,%rdx
+  8003be:	ff ff ff 
+  8003c1:	48 01 c2             	add    %rax,%rdx
+  8003c4:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8003c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003ca:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8003d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003d4:	8b 40 04             	mov    0x4(%rax),%eax
+  8003d7:	8d 50 01             	lea    0x1(%rax),%edx
+  8003da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003de:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8003e1:	90                   	nop
+  8003e2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8003e6:	c9                   	leave
+  8003e7:	c3                   	ret
+
+00000000008003e8 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003e8:	55                   	push   %rbp
+  8003e9:	48 89 e5             	mov    %rsp,%rbp
+  8003ec:	41 57                	push   %r15
+  8003ee:	53                   	push   %rbx
+  8003ef:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8003f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8003f6 <vcprintf+0xe>
+  8003fd:	49 bb 3a 8c 00 00 00 	movabs $0x8c3a,%r11
+  800404:	00 00 00 
+  800407:	4c 01 db             	add    %r11,%rbx
+  80040a:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800411:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800418:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80041f:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800426:	48 8b 06             	mov    (%rsi),%rax
+  800429:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80042d:	48 89 01             	mov    %rax,(%rcx)
+  800430:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800434:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800438:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80043c:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800443:	00 00 00 
+    b.cnt = 0;
+  800446:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80044d:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800450:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800457:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80045e:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800465:	48 89 c6             	mov    %rax,%rsi
+  800468:	48 b8 1a 73 ff ff ff 	movabs $0xffffffffffff731a,%rax
+  80046f:	ff ff ff 
+  800472:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800476:	48 89 c7             	mov    %rax,%rdi
+  800479:	49 89 df             	mov    %rbx,%r15
+  80047c:	48 b8 dc 78 ff ff ff 	movabs $0xffffffffffff78dc,%rax
+  800483:	ff ff ff 
+  800486:	48 01 d8             	add    %rbx,%rax
+  800489:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  80048b:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800491:	48 98                	cltq
+  800493:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  80049a:	48 83 c2 08          	add    $0x8,%rdx
+  80049e:	48 89 c6             	mov    %rax,%rsi
+  8004a1:	48 89 d7             	mov    %rdx,%rdi
+  8004a4:	49 89 df             	mov    %rbx,%r15
+  8004a7:	48 b8 5e 8d ff ff ff 	movabs $0xffffffffffff8d5e,%rax
+  8004ae:	ff ff ff 
+  8004b1:	48 01 d8             	add    %rbx,%rax
+  8004b4:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8004b6:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8004bc:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8004c3:	5b                   	pop    %rbx
+  8004c4:	41 5f                	pop    %r15
+  8004c6:	5d                   	pop    %rbp
+  8004c7:	c3                   	ret
+
+00000000008004c8 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8004d3:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8004d3 <cprintf+0xb>
+  8004da:	49 bb 5d 8b 00 00 00 	movabs $0x8b5d,%r11
+  8004e1:	00 00 00 
+  8004e4:	4d 01 da             	add    %r11,%r10
+  8004e7:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004ee:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8004f5:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8004fc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800503:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80050a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800511:	84 c0                	test   %al,%al
+  800513:	74 20                	je     800535 <cprintf+0x6d>
+  800515:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800519:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80051d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800521:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800525:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800529:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80052d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800531:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800535:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80053c:	00 00 00 
+  80053f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800546:	00 00 00 
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800554:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80055b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800562:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800569:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800570:	48 8b 06             	mov    (%rsi),%rax
+  800573:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800577:	48 89 01             	mov    %rax,(%rcx)
+  80057a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80057e:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800582:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800586:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80058d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800594:	48 89 d6             	mov    %rdx,%rsi
+  800597:	48 89 c7             	mov    %rax,%rdi
+  80059a:	48 b8 b8 73 ff ff ff 	movabs $0xffffffffffff73b8,%rax
+  8005a1:	ff ff ff 
+  8005a4:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8005a8:	ff d0                	call   *%rax
+  8005aa:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8005b0:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8005b6:	c9                   	leave
+  8005b7:	c3                   	ret
+
+00000000008005b8 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005b8:	55                   	push   %rbp
+  8005b9:	48 89 e5             	mov    %rsp,%rbp
+  8005bc:	53                   	push   %rbx
+  8005bd:	48 83 ec 38          	sub    $0x38,%rsp
+  8005c1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8005c1 <printnum+0x9>
+  8005c8:	49 bb 6f 8a 00 00 00 	movabs $0x8a6f,%r11
+  8005cf:	00 00 00 
+  8005d2:	4c 01 db             	add    %r11,%rbx
+  8005d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8005d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8005dd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8005e1:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8005e4:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8005e8:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005ec:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8005ef:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8005f3:	72 58                	jb     80064d <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005f5:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8005f8:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8005fb:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8005fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800602:	ba 00 00 00 00       	mov    $0x0,%edx
+  800607:	48 f7 f6             	div    %rsi
+  80060a:	49 89 c2             	mov    %rax,%r10
+  80060d:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800610:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800613:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800617:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80061b:	41 89 c9             	mov    %ecx,%r9d
+  80061e:	41 89 f8             	mov    %edi,%r8d
+  800621:	89 d1                	mov    %edx,%ecx
+  800623:	4c 89 d2             	mov    %r10,%rdx
+  800626:	48 89 c7             	mov    %rax,%rdi
+  800629:	48 b8 88 75 ff ff ff 	movabs $0xffffffffffff7588,%rax
+  800630:	ff ff ff 
+  800633:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800637:	ff d0                	call   *%rax
+  800639:	eb 1c                	jmp    800657 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80063b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80063f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800642:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800646:	48 89 d6             	mov    %rdx,%rsi
+  800649:	89 c7                	mov    %eax,%edi
+  80064b:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80064d:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800651:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800655:	7f e4                	jg     80063b <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800657:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80065a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80065e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800663:	48 f7 f1             	div    %rcx
+  800666:	48 b8 0f d8 ff ff ff 	movabs $0xffffffffffffd80f,%rax
+  80066d:	ff ff ff 
+  800670:	48 01 d8             	add    %rbx,%rax
+  800673:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800677:	0f be c0             	movsbl %al,%eax
+  80067a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80067e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800682:	48 89 d6             	mov    %rdx,%rsi
+  800685:	89 c7                	mov    %eax,%edi
+  800687:	ff d1                	call   *%rcx
+}
+  800689:	90                   	nop
+  80068a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80068e:	c9                   	leave
+  80068f:	c3                   	ret
+
+0000000000800690 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800690:	55                   	push   %rbp
+  800691:	48 89 e5             	mov    %rsp,%rbp
+  800694:	48 83 ec 20          	sub    $0x20,%rsp
+  800698:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800698 <getuint+0x8>
+  80069f:	49 bb 98 89 00 00 00 	movabs $0x8998,%r11
+  8006a6:	00 00 00 
+  8006a9:	4c 01 d8             	add    %r11,%rax
+  8006ac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8006b0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8006b3:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8006b7:	7e 4f                	jle    800708 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8006b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006bd:	8b 00                	mov    (%rax),%eax
+  8006bf:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c2:	77 24                	ja     8006e8 <getuint+0x58>
+  8006c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006c8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d0:	8b 00                	mov    (%rax),%eax
+  8006d2:	89 c0                	mov    %eax,%eax
+  8006d4:	48 01 d0             	add    %rdx,%rax
+  8006d7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006db:	8b 12                	mov    (%rdx),%edx
+  8006dd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006e0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e4:	89 0a                	mov    %ecx,(%rdx)
+  8006e6:	eb 14                	jmp    8006fc <getuint+0x6c>
+  8006e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006ec:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006f0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006f4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006f8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006fc:	48 8b 00             	mov    (%rax),%rax
+  8006ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800703:	e9 9d 00 00 00       	jmp    8007a5 <getuint+0x115>
+	else if (lflag)
+  800708:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80070c:	74 4c                	je     80075a <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  80070e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800712:	8b 00                	mov    (%rax),%eax
+  800714:	83 f8 2f             	cmp    $0x2f,%eax
+  800717:	77 24                	ja     80073d <getuint+0xad>
+  800719:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80071d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800721:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800725:	8b 00                	mov    (%rax),%eax
+  800727:	89 c0                	mov    %eax,%eax
+  800729:	48 01 d0             	add    %rdx,%rax
+  80072c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800730:	8b 12                	mov    (%rdx),%edx
+  800732:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800735:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800739:	89 0a                	mov    %ecx,(%rdx)
+  80073b:	eb 14                	jmp    800751 <getuint+0xc1>
+  80073d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800741:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800745:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800749:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80074d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800751:	48 8b 00             	mov    (%rax),%rax
+  800754:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800758:	eb 4b                	jmp    8007a5 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  80075a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80075e:	8b 00                	mov    (%rax),%eax
+  800760:	83 f8 2f             	cmp    $0x2f,%eax
+  800763:	77 24                	ja     800789 <getuint+0xf9>
+  800765:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800769:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80076d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800771:	8b 00                	mov    (%rax),%eax
+  800773:	89 c0                	mov    %eax,%eax
+  800775:	48 01 d0             	add    %rdx,%rax
+  800778:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80077c:	8b 12                	mov    (%rdx),%edx
+  80077e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800781:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800785:	89 0a                	mov    %ecx,(%rdx)
+  800787:	eb 14                	jmp    80079d <getuint+0x10d>
+  800789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80078d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800791:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800795:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800799:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80079d:	8b 00                	mov    (%rax),%eax
+  80079f:	89 c0                	mov    %eax,%eax
+  8007a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8007a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8007a9:	c9                   	leave
+  8007aa:	c3                   	ret
+
+00000000008007ab <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8007ab:	55                   	push   %rbp
+  8007ac:	48 89 e5             	mov    %rsp,%rbp
+  8007af:	48 83 ec 20          	sub    $0x20,%rsp
+  8007b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007b3 <printfloat+0x8>
+  8007ba:	49 bb 7d 88 00 00 00 	movabs $0x887d,%r11
+  8007c1:	00 00 00 
+  8007c4:	4c 01 d8             	add    %r11,%rax
+  8007c7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007cb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8007cf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8007d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007d7:	48 85 c0             	test   %rax,%rax
+  8007da:	79 12                	jns    8007ee <printfloat+0x43>
+		putch('-',putdat);
+  8007dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007e4:	48 89 c6             	mov    %rax,%rsi
+  8007e7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007ec:	ff d2                	call   *%rdx
+	
+}
+  8007ee:	90                   	nop
+  8007ef:	c9                   	leave
+  8007f0:	c3                   	ret
+
+00000000008007f1 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8007f1:	55                   	push   %rbp
+  8007f2:	48 89 e5             	mov    %rsp,%rbp
+  8007f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8007f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007f9 <getint+0x8>
+  800800:	49 bb 37 88 00 00 00 	movabs $0x8837,%r11
+  800807:	00 00 00 
+  80080a:	4c 01 d8             	add    %r11,%rax
+  80080d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800811:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800814:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800818:	7e 4f                	jle    800869 <getint+0x78>
+		x=va_arg(*ap, long long);
+  80081a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80081e:	8b 00                	mov    (%rax),%eax
+  800820:	83 f8 2f             	cmp    $0x2f,%eax
+  800823:	77 24                	ja     800849 <getint+0x58>
+  800825:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800829:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80082d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800831:	8b 00                	mov    (%rax),%eax
+  800833:	89 c0                	mov    %eax,%eax
+  800835:	48 01 d0             	add    %rdx,%rax
+  800838:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80083c:	8b 12                	mov    (%rdx),%edx
+  80083e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800841:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800845:	89 0a                	mov    %ecx,(%rdx)
+  800847:	eb 14                	jmp    80085d <getint+0x6c>
+  800849:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80084d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800851:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800855:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800859:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80085d:	48 8b 00             	mov    (%rax),%rax
+  800860:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800864:	e9 9d 00 00 00       	jmp    800906 <getint+0x115>
+	else if (lflag)
+  800869:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80086d:	74 4c                	je     8008bb <getint+0xca>
+		x=va_arg(*ap, long);
+  80086f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800873:	8b 00                	mov    (%rax),%eax
+  800875:	83 f8 2f             	cmp    $0x2f,%eax
+  800878:	77 24                	ja     80089e <getint+0xad>
+  80087a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80087e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800882:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800886:	8b 00                	mov    (%rax),%eax
+  800888:	89 c0                	mov    %eax,%eax
+  80088a:	48 01 d0             	add    %rdx,%rax
+  80088d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800891:	8b 12                	mov    (%rdx),%edx
+  800893:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800896:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80089a:	89 0a                	mov    %ecx,(%rdx)
+  80089c:	eb 14                	jmp    8008b2 <getint+0xc1>
+  80089e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008a2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008a6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008aa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008ae:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008b2:	48 8b 00             	mov    (%rax),%rax
+  8008b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8008b9:	eb 4b                	jmp    800906 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8008bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008bf:	8b 00                	mov    (%rax),%eax
+  8008c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c4:	77 24                	ja     8008ea <getint+0xf9>
+  8008c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008ca:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008d2:	8b 00                	mov    (%rax),%eax
+  8008d4:	89 c0                	mov    %eax,%eax
+  8008d6:	48 01 d0             	add    %rdx,%rax
+  8008d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008dd:	8b 12                	mov    (%rdx),%edx
+  8008df:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008e2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008e6:	89 0a                	mov    %ecx,(%rdx)
+  8008e8:	eb 14                	jmp    8008fe <getint+0x10d>
+  8008ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008f2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008fa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008fe:	8b 00                	mov    (%rax),%eax
+  800900:	48 98                	cltq
+  800902:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800906:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80090a:	c9                   	leave
+  80090b:	c3                   	ret
+
+000000000080090c <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  80090c:	55                   	push   %rbp
+  80090d:	48 89 e5             	mov    %rsp,%rbp
+  800910:	41 57                	push   %r15
+  800912:	41 55                	push   %r13
+  800914:	41 54                	push   %r12
+  800916:	53                   	push   %rbx
+  800917:	48 83 ec 60          	sub    $0x60,%rsp
+  80091b:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 80091b <vprintfmt+0xf>
+  800922:	49 bb 15 87 00 00 00 	movabs $0x8715,%r11
+  800929:	00 00 00 
+  80092c:	4d 01 dc             	add    %r11,%r12
+  80092f:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800933:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800937:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80093b:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  80093f:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800946:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  80094a:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  80094e:	48 8b 06             	mov    (%rsi),%rax
+  800951:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800955:	48 89 01             	mov    %rax,(%rcx)
+  800958:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80095c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800960:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800964:	eb 17                	jmp    80097d <vprintfmt+0x71>
+			if (ch == '\0')
+  800966:	85 db                	test   %ebx,%ebx
+  800968:	0f 84 97 05 00 00    	je     800f05 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  80096e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800972:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800976:	48 89 c6             	mov    %rax,%rsi
+  800979:	89 df                	mov    %ebx,%edi
+  80097b:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80097d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800981:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800985:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800989:	0f b6 00             	movzbl (%rax),%eax
+  80098c:	0f b6 d8             	movzbl %al,%ebx
+  80098f:	83 fb 25             	cmp    $0x25,%ebx
+  800992:	75 d2                	jne    800966 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800994:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800998:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  80099f:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8009a6:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  8009ad:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  8009b4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8009b8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009bc:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8009c0:	0f b6 00             	movzbl (%rax),%eax
+  8009c3:	0f b6 d8             	movzbl %al,%ebx
+  8009c6:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8009c9:	83 f8 55             	cmp    $0x55,%eax
+  8009cc:	0f 87 00 05 00 00    	ja     800ed2 <vprintfmt+0x5c6>
+  8009d2:	89 c0                	mov    %eax,%eax
+  8009d4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8009db:	00 
+  8009dc:	48 8d 05 85 5e 00 00 	lea    0x5e85(%rip),%rax        # 806868 <.LC18+0xc>
+  8009e3:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  8009e7:	48 8d 15 7a 5e 00 00 	lea    0x5e7a(%rip),%rdx        # 806868 <.LC18+0xc>
+  8009ee:	48 01 d0             	add    %rdx,%rax
+  8009f1:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  8009f3:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  8009f7:	eb bb                	jmp    8009b4 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  8009f9:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  8009fd:	eb b5                	jmp    8009b4 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  8009ff:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800a06:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800a09:	89 d0                	mov    %edx,%eax
+  800a0b:	c1 e0 02             	shl    $0x2,%eax
+  800a0e:	01 d0                	add    %edx,%eax
+  800a10:	01 c0                	add    %eax,%eax
+  800a12:	01 d8                	add    %ebx,%eax
+  800a14:	83 e8 30             	sub    $0x30,%eax
+  800a17:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800a1a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800a1e:	0f b6 00             	movzbl (%rax),%eax
+  800a21:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800a24:	83 fb 2f             	cmp    $0x2f,%ebx
+  800a27:	7e 60                	jle    800a89 <vprintfmt+0x17d>
+  800a29:	83 fb 39             	cmp    $0x39,%ebx
+  800a2c:	7f 5b                	jg     800a89 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800a2e:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800a33:	eb d1                	jmp    800a06 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800a35:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a38:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3b:	77 17                	ja     800a54 <vprintfmt+0x148>
+  800a3d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a41:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a44:	89 d2                	mov    %edx,%edx
+  800a46:	48 01 d0             	add    %rdx,%rax
+  800a49:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a4c:	83 c2 08             	add    $0x8,%edx
+  800a4f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800a52:	eb 0c                	jmp    800a60 <vprintfmt+0x154>
+  800a54:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a58:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a5c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800a60:	8b 00                	mov    (%rax),%eax
+  800a62:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800a65:	eb 23                	jmp    800a8a <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800a67:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a6b:	0f 89 43 ff ff ff    	jns    8009b4 <vprintfmt+0xa8>
+				width = 0;
+  800a71:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800a78:	e9 37 ff ff ff       	jmp    8009b4 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800a7d:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800a84:	e9 2b ff ff ff       	jmp    8009b4 <vprintfmt+0xa8>
+			goto process_precision;
+  800a89:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800a8a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a8e:	0f 89 20 ff ff ff    	jns    8009b4 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800a94:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800a97:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800a9a:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800aa1:	e9 0e ff ff ff       	jmp    8009b4 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800aa6:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800aaa:	e9 05 ff ff ff       	jmp    8009b4 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800aaf:	83 fb 39             	cmp    $0x39,%ebx
+  800ab2:	7f 0b                	jg     800abf <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800ab4:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800ab7:	c1 e0 08             	shl    $0x8,%eax
+  800aba:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800abd:	eb 21                	jmp    800ae0 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800abf:	83 fb 60             	cmp    $0x60,%ebx
+  800ac2:	7e 10                	jle    800ad4 <vprintfmt+0x1c8>
+  800ac4:	83 fb 66             	cmp    $0x66,%ebx
+  800ac7:	7f 0b                	jg     800ad4 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800ac9:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800acc:	c1 e0 08             	shl    $0x8,%eax
+  800acf:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ad2:	eb 0c                	jmp    800ae0 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800ad4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800adb:	e9 04 01 00 00       	jmp    800be4 <vprintfmt+0x2d8>
+  800ae0:	e9 ff 00 00 00       	jmp    800be4 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800ae5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ae8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aeb:	77 17                	ja     800b04 <vprintfmt+0x1f8>
+  800aed:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800af1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800af4:	89 d2                	mov    %edx,%edx
+  800af6:	48 01 d0             	add    %rdx,%rax
+  800af9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800afc:	83 c2 08             	add    $0x8,%edx
+  800aff:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b02:	eb 0c                	jmp    800b10 <vprintfmt+0x204>
+  800b04:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b08:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b0c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b10:	8b 00                	mov    (%rax),%eax
+  800b12:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800b16:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800b1a:	48 89 d6             	mov    %rdx,%rsi
+  800b1d:	89 c7                	mov    %eax,%edi
+  800b1f:	ff d1                	call   *%rcx
+			break;
+  800b21:	e9 da 03 00 00       	jmp    800f00 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800b26:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b29:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2c:	77 17                	ja     800b45 <vprintfmt+0x239>
+  800b2e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b32:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b35:	89 d2                	mov    %edx,%edx
+  800b37:	48 01 d0             	add    %rdx,%rax
+  800b3a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b3d:	83 c2 08             	add    $0x8,%edx
+  800b40:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b43:	eb 0c                	jmp    800b51 <vprintfmt+0x245>
+  800b45:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b49:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b4d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b51:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800b53:	85 db                	test   %ebx,%ebx
+  800b55:	79 02                	jns    800b59 <vprintfmt+0x24d>
+				err = -err;
+  800b57:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b59:	83 fb 15             	cmp    $0x15,%ebx
+  800b5c:	7f 19                	jg     800b77 <vprintfmt+0x26b>
+  800b5e:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800b65:	00 00 00 
+  800b68:	48 63 c3             	movslq %ebx,%rax
+  800b6b:	4c 01 e2             	add    %r12,%rdx
+  800b6e:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800b72:	4d 85 ed             	test   %r13,%r13
+  800b75:	75 36                	jne    800bad <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800b77:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b7b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b7f:	89 d9                	mov    %ebx,%ecx
+  800b81:	48 ba 20 d8 ff ff ff 	movabs $0xffffffffffffd820,%rdx
+  800b88:	ff ff ff 
+  800b8b:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800b8f:	48 89 c7             	mov    %rax,%rdi
+  800b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b97:	49 b8 e3 7e ff ff ff 	movabs $0xffffffffffff7ee3,%r8
+  800b9e:	ff ff ff 
+  800ba1:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800ba5:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800ba8:	e9 53 03 00 00       	jmp    800f00 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800bad:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800bb1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bb5:	4c 89 e9             	mov    %r13,%rcx
+  800bb8:	48 ba 29 d8 ff ff ff 	movabs $0xffffffffffffd829,%rdx
+  800bbf:	ff ff ff 
+  800bc2:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800bc6:	48 89 c7             	mov    %rax,%rdi
+  800bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bce:	49 b8 e3 7e ff ff ff 	movabs $0xffffffffffff7ee3,%r8
+  800bd5:	ff ff ff 
+  800bd8:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800bdc:	41 ff d0             	call   *%r8
+			break;
+  800bdf:	e9 1c 03 00 00       	jmp    800f00 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800be4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800be7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bea:	77 17                	ja     800c03 <vprintfmt+0x2f7>
+  800bec:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800bf0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bf3:	89 d2                	mov    %edx,%edx
+  800bf5:	48 01 d0             	add    %rdx,%rax
+  800bf8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bfb:	83 c2 08             	add    $0x8,%edx
+  800bfe:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c01:	eb 0c                	jmp    800c0f <vprintfmt+0x303>
+  800c03:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c07:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c0b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c0f:	4c 8b 28             	mov    (%rax),%r13
+  800c12:	4d 85 ed             	test   %r13,%r13
+  800c15:	75 0e                	jne    800c25 <vprintfmt+0x319>
+				p = "(null)";
+  800c17:	48 b8 2c d8 ff ff ff 	movabs $0xffffffffffffd82c,%rax
+  800c1e:	ff ff ff 
+  800c21:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800c25:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c29:	0f 8e 84 00 00 00    	jle    800cb3 <vprintfmt+0x3a7>
+  800c2f:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800c33:	74 7e                	je     800cb3 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c35:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800c38:	48 98                	cltq
+  800c3a:	48 89 c6             	mov    %rax,%rsi
+  800c3d:	4c 89 ef             	mov    %r13,%rdi
+  800c40:	4d 89 e7             	mov    %r12,%r15
+  800c43:	48 b8 08 82 ff ff ff 	movabs $0xffffffffffff8208,%rax
+  800c4a:	ff ff ff 
+  800c4d:	4c 01 e0             	add    %r12,%rax
+  800c50:	ff d0                	call   *%rax
+  800c52:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800c55:	eb 17                	jmp    800c6e <vprintfmt+0x362>
+					putch(padc, putdat);
+  800c57:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800c5b:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c5f:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c63:	48 89 d6             	mov    %rdx,%rsi
+  800c66:	89 c7                	mov    %eax,%edi
+  800c68:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c6a:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800c6e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c72:	7f e3                	jg     800c57 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c74:	eb 3d                	jmp    800cb3 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800c76:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800c7a:	74 1e                	je     800c9a <vprintfmt+0x38e>
+  800c7c:	83 fb 1f             	cmp    $0x1f,%ebx
+  800c7f:	7e 05                	jle    800c86 <vprintfmt+0x37a>
+  800c81:	83 fb 7e             	cmp    $0x7e,%ebx
+  800c84:	7e 14                	jle    800c9a <vprintfmt+0x38e>
+					putch('?', putdat);
+  800c86:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c8a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c8e:	48 89 c6             	mov    %rax,%rsi
+  800c91:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c96:	ff d2                	call   *%rdx
+  800c98:	eb 15                	jmp    800caf <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800c9a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800c9d:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800ca0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ca4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ca8:	48 89 c6             	mov    %rax,%rsi
+  800cab:	89 cf                	mov    %ecx,%edi
+  800cad:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800caf:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800cb3:	4c 89 e8             	mov    %r13,%rax
+  800cb6:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800cba:	0f b6 00             	movzbl (%rax),%eax
+  800cbd:	0f be d8             	movsbl %al,%ebx
+  800cc0:	85 db                	test   %ebx,%ebx
+  800cc2:	74 28                	je     800cec <vprintfmt+0x3e0>
+  800cc4:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800cc8:	78 ac                	js     800c76 <vprintfmt+0x36a>
+  800cca:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800cce:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800cd2:	79 a2                	jns    800c76 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800cd4:	eb 16                	jmp    800cec <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800cd6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cda:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800cde:	48 89 c6             	mov    %rax,%rsi
+  800ce1:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ce6:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800ce8:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800cec:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800cf0:	7f e4                	jg     800cd6 <vprintfmt+0x3ca>
+			break;
+  800cf2:	e9 09 02 00 00       	jmp    800f00 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800cf7:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800cfb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800cff:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d03:	0f b6 00             	movzbl (%rax),%eax
+  800d06:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800d09:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800d0a:	83 fb 2f             	cmp    $0x2f,%ebx
+  800d0d:	0f 8e ac fd ff ff    	jle    800abf <vprintfmt+0x1b3>
+  800d13:	e9 97 fd ff ff       	jmp    800aaf <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800d18:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d1c:	be 03 00 00 00       	mov    $0x3,%esi
+  800d21:	48 89 c7             	mov    %rax,%rdi
+  800d24:	48 b8 c1 77 ff ff ff 	movabs $0xffffffffffff77c1,%rax
+  800d2b:	ff ff ff 
+  800d2e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d32:	ff d0                	call   *%rax
+  800d34:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800d38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d3c:	48 85 c0             	test   %rax,%rax
+  800d3f:	79 1d                	jns    800d5e <vprintfmt+0x452>
+				putch('-', putdat);
+  800d41:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d45:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d49:	48 89 c6             	mov    %rax,%rsi
+  800d4c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d51:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800d53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d57:	48 f7 d8             	neg    %rax
+  800d5a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800d5e:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800d65:	e9 de 00 00 00       	jmp    800e48 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800d6a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d6e:	be 03 00 00 00       	mov    $0x3,%esi
+  800d73:	48 89 c7             	mov    %rax,%rdi
+  800d76:	48 b8 60 76 ff ff ff 	movabs $0xffffffffffff7660,%rax
+  800d7d:	ff ff ff 
+  800d80:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d84:	ff d0                	call   *%rax
+  800d86:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800d8a:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800d91:	e9 b2 00 00 00       	jmp    800e48 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800d96:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d9a:	be 03 00 00 00       	mov    $0x3,%esi
+  800d9f:	48 89 c7             	mov    %rax,%rdi
+  800da2:	48 b8 60 76 ff ff ff 	movabs $0xffffffffffff7660,%rax
+  800da9:	ff ff ff 
+  800dac:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800db0:	ff d0                	call   *%rax
+  800db2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800db6:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800dbd:	e9 86 00 00 00       	jmp    800e48 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800dc2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dc6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dca:	48 89 c6             	mov    %rax,%rsi
+  800dcd:	bf 30 00 00 00       	mov    $0x30,%edi
+  800dd2:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800dd4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dd8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ddc:	48 89 c6             	mov    %rax,%rsi
+  800ddf:	bf 78 00 00 00       	mov    $0x78,%edi
+  800de4:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800de6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800de9:	83 f8 2f             	cmp    $0x2f,%eax
+  800dec:	77 17                	ja     800e05 <vprintfmt+0x4f9>
+  800dee:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800df2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800df5:	89 d2                	mov    %edx,%edx
+  800df7:	48 01 d0             	add    %rdx,%rax
+  800dfa:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dfd:	83 c2 08             	add    $0x8,%edx
+  800e00:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e03:	eb 0c                	jmp    800e11 <vprintfmt+0x505>
+  800e05:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e09:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e0d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e11:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800e14:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800e18:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800e1f:	eb 27                	jmp    800e48 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800e21:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e25:	be 03 00 00 00       	mov    $0x3,%esi
+  800e2a:	48 89 c7             	mov    %rax,%rdi
+  800e2d:	48 b8 60 76 ff ff ff 	movabs $0xffffffffffff7660,%rax
+  800e34:	ff ff ff 
+  800e37:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e3b:	ff d0                	call   *%rax
+  800e3d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800e41:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800e48:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800e4d:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800e50:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800e53:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800e57:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e5b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e5f:	45 89 c1             	mov    %r8d,%r9d
+  800e62:	41 89 f8             	mov    %edi,%r8d
+  800e65:	48 89 c7             	mov    %rax,%rdi
+  800e68:	48 b8 88 75 ff ff ff 	movabs $0xffffffffffff7588,%rax
+  800e6f:	ff ff ff 
+  800e72:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e76:	ff d0                	call   *%rax
+			break;
+  800e78:	e9 83 00 00 00       	jmp    800f00 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800e7d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e81:	be 03 00 00 00       	mov    $0x3,%esi
+  800e86:	48 89 c7             	mov    %rax,%rdi
+  800e89:	48 b8 60 76 ff ff ff 	movabs $0xffffffffffff7660,%rax
+  800e90:	ff ff ff 
+  800e93:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e97:	ff d0                	call   *%rax
+  800e99:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800e9d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800ea1:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800ea5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ea9:	48 89 ce             	mov    %rcx,%rsi
+  800eac:	48 89 c7             	mov    %rax,%rdi
+  800eaf:	48 b8 7b 77 ff ff ff 	movabs $0xffffffffffff777b,%rax
+  800eb6:	ff ff ff 
+  800eb9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ebd:	ff d0                	call   *%rax
+	
+			break;
+  800ebf:	eb 3f                	jmp    800f00 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800ec1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ec5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ec9:	48 89 c6             	mov    %rax,%rsi
+  800ecc:	89 df                	mov    %ebx,%edi
+  800ece:	ff d2                	call   *%rdx
+			break;
+  800ed0:	eb 2e                	jmp    800f00 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800ed2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ed6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800eda:	48 89 c6             	mov    %rax,%rsi
+  800edd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ee2:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ee4:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800ee9:	eb 05                	jmp    800ef0 <vprintfmt+0x5e4>
+  800eeb:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800ef0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ef4:	48 83 e8 01          	sub    $0x1,%rax
+  800ef8:	0f b6 00             	movzbl (%rax),%eax
+  800efb:	3c 25                	cmp    $0x25,%al
+  800efd:	75 ec                	jne    800eeb <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800eff:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f00:	e9 78 fa ff ff       	jmp    80097d <vprintfmt+0x71>
+				return;
+  800f05:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800f06:	48 83 c4 60          	add    $0x60,%rsp
+  800f0a:	5b                   	pop    %rbx
+  800f0b:	41 5c                	pop    %r12
+  800f0d:	41 5d                	pop    %r13
+  800f0f:	41 5f                	pop    %r15
+  800f11:	5d                   	pop    %rbp
+  800f12:	c3                   	ret
+
+0000000000800f13 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  800f13:	55                   	push   %rbp
+  800f14:	48 89 e5             	mov    %rsp,%rbp
+  800f17:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f1e:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800f1e <printfmt+0xb>
+  800f25:	49 bb 12 81 00 00 00 	movabs $0x8112,%r11
+  800f2c:	00 00 00 
+  800f2f:	4d 01 da             	add    %r11,%r10
+  800f32:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f39:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f40:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f47:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f4e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f55:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f5c:	84 c0                	test   %al,%al
+  800f5e:	74 20                	je     800f80 <printfmt+0x6d>
+  800f60:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f64:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f68:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f6c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f70:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f74:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f78:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f7c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800f80:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f87:	00 00 00 
+  800f8a:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f91:	00 00 00 
+  800f94:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f98:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f9f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800fa6:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800fad:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800fb4:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800fbb:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800fc2:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800fc9:	48 89 c7             	mov    %rax,%rdi
+  800fcc:	48 b8 dc 78 ff ff ff 	movabs $0xffffffffffff78dc,%rax
+  800fd3:	ff ff ff 
+  800fd6:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800fda:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800fdc:	90                   	nop
+  800fdd:	c9                   	leave
+  800fde:	c3                   	ret
+
+0000000000800fdf <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800fdf:	55                   	push   %rbp
+  800fe0:	48 89 e5             	mov    %rsp,%rbp
+  800fe3:	48 83 ec 10          	sub    $0x10,%rsp
+  800fe7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800fe7 <sprintputch+0x8>
+  800fee:	49 bb 49 80 00 00 00 	movabs $0x8049,%r11
+  800ff5:	00 00 00 
+  800ff8:	4c 01 d8             	add    %r11,%rax
+  800ffb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ffe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801002:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801006:	8b 40 10             	mov    0x10(%rax),%eax
+  801009:	8d 50 01             	lea    0x1(%rax),%edx
+  80100c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801010:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801013:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801017:	48 8b 10             	mov    (%rax),%rdx
+  80101a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80101e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801022:	48 39 c2             	cmp    %rax,%rdx
+  801025:	73 17                	jae    80103e <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801027:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80102b:	48 8b 00             	mov    (%rax),%rax
+  80102e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801032:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801036:	48 89 0a             	mov    %rcx,(%rdx)
+  801039:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80103c:	88 10                	mov    %dl,(%rax)
+}
+  80103e:	90                   	nop
+  80103f:	c9                   	leave
+  801040:	c3                   	ret
+
+0000000000801041 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801041:	55                   	push   %rbp
+  801042:	48 89 e5             	mov    %rsp,%rbp
+  801045:	53                   	push   %rbx
+  801046:	48 83 ec 58          	sub    $0x58,%rsp
+  80104a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80104a <vsnprintf+0x9>
+  801051:	49 bb e6 7f 00 00 00 	movabs $0x7fe6,%r11
+  801058:	00 00 00 
+  80105b:	4c 01 d8             	add    %r11,%rax
+  80105e:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801062:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801065:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801069:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80106d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801071:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801075:	48 8b 0e             	mov    (%rsi),%rcx
+  801078:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80107c:	48 89 0a             	mov    %rcx,(%rdx)
+  80107f:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801083:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801087:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80108b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80108f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801093:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801096:	48 63 d2             	movslq %edx,%rdx
+  801099:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80109d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8010a1:	48 01 ca             	add    %rcx,%rdx
+  8010a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8010a8:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8010af:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8010b4:	74 06                	je     8010bc <vsnprintf+0x7b>
+  8010b6:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8010ba:	7f 07                	jg     8010c3 <vsnprintf+0x82>
+		return -E_INVAL;
+  8010bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010c1:	eb 34                	jmp    8010f7 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8010c3:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8010c7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8010cb:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8010cf:	48 bf af 7f ff ff ff 	movabs $0xffffffffffff7faf,%rdi
+  8010d6:	ff ff ff 
+  8010d9:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8010dd:	49 b8 dc 78 ff ff ff 	movabs $0xffffffffffff78dc,%r8
+  8010e4:	ff ff ff 
+  8010e7:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8010eb:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8010ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8010f1:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8010f4:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8010f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010fb:	c9                   	leave
+  8010fc:	c3                   	ret
+
+00000000008010fd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8010fd:	55                   	push   %rbp
+  8010fe:	48 89 e5             	mov    %rsp,%rbp
+  801101:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801108:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801108 <snprintf+0xb>
+  80110f:	49 bb 28 7f 00 00 00 	movabs $0x7f28,%r11
+  801116:	00 00 00 
+  801119:	4d 01 da             	add    %r11,%r10
+  80111c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801123:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801129:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801130:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801137:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80113e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801145:	84 c0                	test   %al,%al
+  801147:	74 20                	je     801169 <snprintf+0x6c>
+  801149:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80114d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801151:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801155:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801159:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80115d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801161:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801165:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801169:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801170:	00 00 00 
+  801173:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80117a:	00 00 00 
+  80117d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801181:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801188:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80118f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801196:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80119d:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8011a4:	48 8b 06             	mov    (%rsi),%rax
+  8011a7:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8011ab:	48 89 01             	mov    %rax,(%rcx)
+  8011ae:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8011b2:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8011b6:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8011ba:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8011c1:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8011c8:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8011ce:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8011d5:	48 89 c7             	mov    %rax,%rdi
+  8011d8:	48 b8 11 80 ff ff ff 	movabs $0xffffffffffff8011,%rax
+  8011df:	ff ff ff 
+  8011e2:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8011e6:	ff d0                	call   *%rax
+  8011e8:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8011ee:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8011f4:	c9                   	leave
+  8011f5:	c3                   	ret
+
+00000000008011f6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8011f6:	55                   	push   %rbp
+  8011f7:	48 89 e5             	mov    %rsp,%rbp
+  8011fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8011fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011fe <strlen+0x8>
+  801205:	49 bb 32 7e 00 00 00 	movabs $0x7e32,%r11
+  80120c:	00 00 00 
+  80120f:	4c 01 d8             	add    %r11,%rax
+  801212:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801216:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80121d:	eb 09                	jmp    801228 <strlen+0x32>
+		n++;
+  80121f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801223:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801228:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80122c:	0f b6 00             	movzbl (%rax),%eax
+  80122f:	84 c0                	test   %al,%al
+  801231:	75 ec                	jne    80121f <strlen+0x29>
+	return n;
+  801233:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801236:	c9                   	leave
+  801237:	c3                   	ret
+
+0000000000801238 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801238:	55                   	push   %rbp
+  801239:	48 89 e5             	mov    %rsp,%rbp
+  80123c:	48 83 ec 20          	sub    $0x20,%rsp
+  801240:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801240 <strnlen+0x8>
+  801247:	49 bb f0 7d 00 00 00 	movabs $0x7df0,%r11
+  80124e:	00 00 00 
+  801251:	4c 01 d8             	add    %r11,%rax
+  801254:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801258:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80125c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801263:	eb 0e                	jmp    801273 <strnlen+0x3b>
+		n++;
+  801265:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801269:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80126e:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801273:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801278:	74 0b                	je     801285 <strnlen+0x4d>
+  80127a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80127e:	0f b6 00             	movzbl (%rax),%eax
+  801281:	84 c0                	test   %al,%al
+  801283:	75 e0                	jne    801265 <strnlen+0x2d>
+	return n;
+  801285:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801288:	c9                   	leave
+  801289:	c3                   	ret
+
+000000000080128a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80128a:	55                   	push   %rbp
+  80128b:	48 89 e5             	mov    %rsp,%rbp
+  80128e:	48 83 ec 20          	sub    $0x20,%rsp
+  801292:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801292 <strcpy+0x8>
+  801299:	49 bb 9e 7d 00 00 00 	movabs $0x7d9e,%r11
+  8012a0:	00 00 00 
+  8012a3:	4c 01 d8             	add    %r11,%rax
+  8012a6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012aa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8012ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012b2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8012b6:	90                   	nop
+  8012b7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012bb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012bf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012cb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012cf:	0f b6 12             	movzbl (%rdx),%edx
+  8012d2:	88 10                	mov    %dl,(%rax)
+  8012d4:	0f b6 00             	movzbl (%rax),%eax
+  8012d7:	84 c0                	test   %al,%al
+  8012d9:	75 dc                	jne    8012b7 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8012db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8012df:	c9                   	leave
+  8012e0:	c3                   	ret
+
+00000000008012e1 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8012e1:	55                   	push   %rbp
+  8012e2:	48 89 e5             	mov    %rsp,%rbp
+  8012e5:	53                   	push   %rbx
+  8012e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8012ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8012ea <strcat+0x9>
+  8012f1:	49 bb 46 7d 00 00 00 	movabs $0x7d46,%r11
+  8012f8:	00 00 00 
+  8012fb:	4c 01 db             	add    %r11,%rbx
+  8012fe:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801302:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801306:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80130a:	48 89 c7             	mov    %rax,%rdi
+  80130d:	48 b8 c6 81 ff ff ff 	movabs $0xffffffffffff81c6,%rax
+  801314:	ff ff ff 
+  801317:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80131b:	ff d0                	call   *%rax
+  80131d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801320:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801323:	48 63 d0             	movslq %eax,%rdx
+  801326:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80132a:	48 01 c2             	add    %rax,%rdx
+  80132d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801331:	48 89 c6             	mov    %rax,%rsi
+  801334:	48 89 d7             	mov    %rdx,%rdi
+  801337:	48 b8 5a 82 ff ff ff 	movabs $0xffffffffffff825a,%rax
+  80133e:	ff ff ff 
+  801341:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801345:	ff d0                	call   *%rax
+	return dst;
+  801347:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  80134b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80134f:	c9                   	leave
+  801350:	c3                   	ret
+
+0000000000801351 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801351:	55                   	push   %rbp
+  801352:	48 89 e5             	mov    %rsp,%rbp
+  801355:	48 83 ec 28          	sub    $0x28,%rsp
+  801359:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801359 <strncpy+0x8>
+  801360:	49 bb d7 7c 00 00 00 	movabs $0x7cd7,%r11
+  801367:	00 00 00 
+  80136a:	4c 01 d8             	add    %r11,%rax
+  80136d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801371:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801375:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801379:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80137d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801381:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801388:	00 
+  801389:	eb 2a                	jmp    8013b5 <strncpy+0x64>
+		*dst++ = *src;
+  80138b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80138f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801393:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801397:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80139b:	0f b6 12             	movzbl (%rdx),%edx
+  80139e:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8013a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013a4:	0f b6 00             	movzbl (%rax),%eax
+  8013a7:	84 c0                	test   %al,%al
+  8013a9:	74 05                	je     8013b0 <strncpy+0x5f>
+			src++;
+  8013ab:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8013b0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013b9:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8013bd:	72 cc                	jb     80138b <strncpy+0x3a>
+	}
+	return ret;
+  8013bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8013c3:	c9                   	leave
+  8013c4:	c3                   	ret
+
+00000000008013c5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8013c5:	55                   	push   %rbp
+  8013c6:	48 89 e5             	mov    %rsp,%rbp
+  8013c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8013cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013cd <strlcpy+0x8>
+  8013d4:	49 bb 63 7c 00 00 00 	movabs $0x7c63,%r11
+  8013db:	00 00 00 
+  8013de:	4c 01 d8             	add    %r11,%rax
+  8013e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013e9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8013ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013f1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8013f5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013fa:	74 3d                	je     801439 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8013fc:	eb 1d                	jmp    80141b <strlcpy+0x56>
+			*dst++ = *src++;
+  8013fe:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801402:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801406:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80140a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80140e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801412:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801416:	0f b6 12             	movzbl (%rdx),%edx
+  801419:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80141b:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801420:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801425:	74 0b                	je     801432 <strlcpy+0x6d>
+  801427:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80142b:	0f b6 00             	movzbl (%rax),%eax
+  80142e:	84 c0                	test   %al,%al
+  801430:	75 cc                	jne    8013fe <strlcpy+0x39>
+		*dst = '\0';
+  801432:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801436:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801439:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143d:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801441:	c9                   	leave
+  801442:	c3                   	ret
+
+0000000000801443 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801443:	55                   	push   %rbp
+  801444:	48 89 e5             	mov    %rsp,%rbp
+  801447:	48 83 ec 10          	sub    $0x10,%rsp
+  80144b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80144b <strcmp+0x8>
+  801452:	49 bb e5 7b 00 00 00 	movabs $0x7be5,%r11
+  801459:	00 00 00 
+  80145c:	4c 01 d8             	add    %r11,%rax
+  80145f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801463:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801467:	eb 0a                	jmp    801473 <strcmp+0x30>
+		p++, q++;
+  801469:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80146e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801473:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801477:	0f b6 00             	movzbl (%rax),%eax
+  80147a:	84 c0                	test   %al,%al
+  80147c:	74 12                	je     801490 <strcmp+0x4d>
+  80147e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801482:	0f b6 10             	movzbl (%rax),%edx
+  801485:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801489:	0f b6 00             	movzbl (%rax),%eax
+  80148c:	38 c2                	cmp    %al,%dl
+  80148e:	74 d9                	je     801469 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801490:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801494:	0f b6 00             	movzbl (%rax),%eax
+  801497:	0f b6 d0             	movzbl %al,%edx
+  80149a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80149e:	0f b6 00             	movzbl (%rax),%eax
+  8014a1:	0f b6 c0             	movzbl %al,%eax
+  8014a4:	29 c2                	sub    %eax,%edx
+  8014a6:	89 d0                	mov    %edx,%eax
+}
+  8014a8:	c9                   	leave
+  8014a9:	c3                   	ret
+
+00000000008014aa <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8014aa:	55                   	push   %rbp
+  8014ab:	48 89 e5             	mov    %rsp,%rbp
+  8014ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8014b2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014b2 <strncmp+0x8>
+  8014b9:	49 bb 7e 7b 00 00 00 	movabs $0x7b7e,%r11
+  8014c0:	00 00 00 
+  8014c3:	4c 01 d8             	add    %r11,%rax
+  8014c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8014ce:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8014d2:	eb 0f                	jmp    8014e3 <strncmp+0x39>
+		n--, p++, q++;
+  8014d4:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8014d9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014de:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8014e3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014e8:	74 1d                	je     801507 <strncmp+0x5d>
+  8014ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ee:	0f b6 00             	movzbl (%rax),%eax
+  8014f1:	84 c0                	test   %al,%al
+  8014f3:	74 12                	je     801507 <strncmp+0x5d>
+  8014f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014f9:	0f b6 10             	movzbl (%rax),%edx
+  8014fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801500:	0f b6 00             	movzbl (%rax),%eax
+  801503:	38 c2                	cmp    %al,%dl
+  801505:	74 cd                	je     8014d4 <strncmp+0x2a>
+	if (n == 0)
+  801507:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80150c:	75 07                	jne    801515 <strncmp+0x6b>
+		return 0;
+  80150e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801513:	eb 16                	jmp    80152b <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801515:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801519:	0f b6 00             	movzbl (%rax),%eax
+  80151c:	0f b6 d0             	movzbl %al,%edx
+  80151f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801523:	0f b6 00             	movzbl (%rax),%eax
+  801526:	0f b6 c0             	movzbl %al,%eax
+  801529:	29 c2                	sub    %eax,%edx
+}
+  80152b:	89 d0                	mov    %edx,%eax
+  80152d:	c9                   	leave
+  80152e:	c3                   	ret
+
+000000000080152f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80152f:	55                   	push   %rbp
+  801530:	48 89 e5             	mov    %rsp,%rbp
+  801533:	48 83 ec 10          	sub    $0x10,%rsp
+  801537:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801537 <strchr+0x8>
+  80153e:	49 bb f9 7a 00 00 00 	movabs $0x7af9,%r11
+  801545:	00 00 00 
+  801548:	4c 01 d8             	add    %r11,%rax
+  80154b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80154f:	89 f0                	mov    %esi,%eax
+  801551:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801554:	eb 17                	jmp    80156d <strchr+0x3e>
+		if (*s == c)
+  801556:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80155a:	0f b6 00             	movzbl (%rax),%eax
+  80155d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801560:	75 06                	jne    801568 <strchr+0x39>
+			return (char *) s;
+  801562:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801566:	eb 15                	jmp    80157d <strchr+0x4e>
+	for (; *s; s++)
+  801568:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80156d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801571:	0f b6 00             	movzbl (%rax),%eax
+  801574:	84 c0                	test   %al,%al
+  801576:	75 de                	jne    801556 <strchr+0x27>
+	return 0;
+  801578:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80157d:	c9                   	leave
+  80157e:	c3                   	ret
+
+000000000080157f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80157f:	55                   	push   %rbp
+  801580:	48 89 e5             	mov    %rsp,%rbp
+  801583:	48 83 ec 10          	sub    $0x10,%rsp
+  801587:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801587 <strfind+0x8>
+  80158e:	49 bb a9 7a 00 00 00 	movabs $0x7aa9,%r11
+  801595:	00 00 00 
+  801598:	4c 01 d8             	add    %r11,%rax
+  80159b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80159f:	89 f0                	mov    %esi,%eax
+  8015a1:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8015a4:	eb 11                	jmp    8015b7 <strfind+0x38>
+		if (*s == c)
+  8015a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015aa:	0f b6 00             	movzbl (%rax),%eax
+  8015ad:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8015b0:	74 12                	je     8015c4 <strfind+0x45>
+	for (; *s; s++)
+  8015b2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015bb:	0f b6 00             	movzbl (%rax),%eax
+  8015be:	84 c0                	test   %al,%al
+  8015c0:	75 e4                	jne    8015a6 <strfind+0x27>
+  8015c2:	eb 01                	jmp    8015c5 <strfind+0x46>
+			break;
+  8015c4:	90                   	nop
+	return (char *) s;
+  8015c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8015c9:	c9                   	leave
+  8015ca:	c3                   	ret
+
+00000000008015cb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8015cb:	55                   	push   %rbp
+  8015cc:	48 89 e5             	mov    %rsp,%rbp
+  8015cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8015d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015d3 <memset+0x8>
+  8015da:	49 bb 5d 7a 00 00 00 	movabs $0x7a5d,%r11
+  8015e1:	00 00 00 
+  8015e4:	4c 01 d8             	add    %r11,%rax
+  8015e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015eb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8015ee:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8015f2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8015f7:	75 06                	jne    8015ff <memset+0x34>
+		return v;
+  8015f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015fd:	eb 69                	jmp    801668 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8015ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801603:	83 e0 03             	and    $0x3,%eax
+  801606:	48 85 c0             	test   %rax,%rax
+  801609:	75 48                	jne    801653 <memset+0x88>
+  80160b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80160f:	83 e0 03             	and    $0x3,%eax
+  801612:	48 85 c0             	test   %rax,%rax
+  801615:	75 3c                	jne    801653 <memset+0x88>
+		c &= 0xFF;
+  801617:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  80161e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801621:	c1 e0 18             	shl    $0x18,%eax
+  801624:	89 c2                	mov    %eax,%edx
+  801626:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801629:	c1 e0 10             	shl    $0x10,%eax
+  80162c:	09 c2                	or     %eax,%edx
+  80162e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801631:	c1 e0 08             	shl    $0x8,%eax
+  801634:	09 d0                	or     %edx,%eax
+  801636:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801639:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80163d:	48 c1 e8 02          	shr    $0x2,%rax
+  801641:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801644:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801648:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80164b:	48 89 d7             	mov    %rdx,%rdi
+  80164e:	fc                   	cld
+  80164f:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801651:	eb 11                	jmp    801664 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801653:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801657:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80165a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80165e:	48 89 d7             	mov    %rdx,%rdi
+  801661:	fc                   	cld
+  801662:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801664:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801668:	c9                   	leave
+  801669:	c3                   	ret
+
+000000000080166a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80166a:	55                   	push   %rbp
+  80166b:	48 89 e5             	mov    %rsp,%rbp
+  80166e:	48 83 ec 28          	sub    $0x28,%rsp
+  801672:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801672 <memmove+0x8>
+  801679:	49 bb be 79 00 00 00 	movabs $0x79be,%r11
+  801680:	00 00 00 
+  801683:	4c 01 d8             	add    %r11,%rax
+  801686:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80168a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80168e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801692:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801696:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  80169a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80169e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8016a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a6:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8016aa:	0f 83 88 00 00 00    	jae    801738 <memmove+0xce>
+  8016b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016b8:	48 01 d0             	add    %rdx,%rax
+  8016bb:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8016bf:	73 77                	jae    801738 <memmove+0xce>
+		s += n;
+  8016c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016c5:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8016c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016cd:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8016d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016d5:	83 e0 03             	and    $0x3,%eax
+  8016d8:	48 85 c0             	test   %rax,%rax
+  8016db:	75 3b                	jne    801718 <memmove+0xae>
+  8016dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016e1:	83 e0 03             	and    $0x3,%eax
+  8016e4:	48 85 c0             	test   %rax,%rax
+  8016e7:	75 2f                	jne    801718 <memmove+0xae>
+  8016e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016ed:	83 e0 03             	and    $0x3,%eax
+  8016f0:	48 85 c0             	test   %rax,%rax
+  8016f3:	75 23                	jne    801718 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8016f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016f9:	48 83 e8 04          	sub    $0x4,%rax
+  8016fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801701:	48 83 ea 04          	sub    $0x4,%rdx
+  801705:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801709:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80170d:	48 89 c7             	mov    %rax,%rdi
+  801710:	48 89 d6             	mov    %rdx,%rsi
+  801713:	fd                   	std
+  801714:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801716:	eb 1d                	jmp    801735 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801718:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80171c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801720:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801724:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801728:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80172c:	48 89 d7             	mov    %rdx,%rdi
+  80172f:	48 89 c1             	mov    %rax,%rcx
+  801732:	fd                   	std
+  801733:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801735:	fc                   	cld
+  801736:	eb 57                	jmp    80178f <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801738:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80173c:	83 e0 03             	and    $0x3,%eax
+  80173f:	48 85 c0             	test   %rax,%rax
+  801742:	75 36                	jne    80177a <memmove+0x110>
+  801744:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801748:	83 e0 03             	and    $0x3,%eax
+  80174b:	48 85 c0             	test   %rax,%rax
+  80174e:	75 2a                	jne    80177a <memmove+0x110>
+  801750:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801754:	83 e0 03             	and    $0x3,%eax
+  801757:	48 85 c0             	test   %rax,%rax
+  80175a:	75 1e                	jne    80177a <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80175c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801760:	48 c1 e8 02          	shr    $0x2,%rax
+  801764:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801767:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80176b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80176f:	48 89 c7             	mov    %rax,%rdi
+  801772:	48 89 d6             	mov    %rdx,%rsi
+  801775:	fc                   	cld
+  801776:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801778:	eb 15                	jmp    80178f <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  80177a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80177e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801782:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801786:	48 89 c7             	mov    %rax,%rdi
+  801789:	48 89 d6             	mov    %rdx,%rsi
+  80178c:	fc                   	cld
+  80178d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  80178f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801793:	c9                   	leave
+  801794:	c3                   	ret
+
+0000000000801795 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	48 83 ec 18          	sub    $0x18,%rsp
+  80179d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80179d <memcpy+0x8>
+  8017a4:	49 bb 93 78 00 00 00 	movabs $0x7893,%r11
+  8017ab:	00 00 00 
+  8017ae:	4c 01 d8             	add    %r11,%rax
+  8017b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8017b9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8017bd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017c1:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8017c5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8017c9:	48 89 cf             	mov    %rcx,%rdi
+  8017cc:	48 b9 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rcx
+  8017d3:	ff ff ff 
+  8017d6:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8017da:	ff d0                	call   *%rax
+}
+  8017dc:	c9                   	leave
+  8017dd:	c3                   	ret
+
+00000000008017de <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8017de:	55                   	push   %rbp
+  8017df:	48 89 e5             	mov    %rsp,%rbp
+  8017e2:	48 83 ec 28          	sub    $0x28,%rsp
+  8017e6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e6 <memcmp+0x8>
+  8017ed:	49 bb 4a 78 00 00 00 	movabs $0x784a,%r11
+  8017f4:	00 00 00 
+  8017f7:	4c 01 d8             	add    %r11,%rax
+  8017fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801802:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801806:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80180a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  80180e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801812:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801816:	eb 34                	jmp    80184c <memcmp+0x6e>
+		if (*s1 != *s2)
+  801818:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181c:	0f b6 10             	movzbl (%rax),%edx
+  80181f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801823:	0f b6 00             	movzbl (%rax),%eax
+  801826:	38 c2                	cmp    %al,%dl
+  801828:	74 18                	je     801842 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  80182a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80182e:	0f b6 00             	movzbl (%rax),%eax
+  801831:	0f b6 d0             	movzbl %al,%edx
+  801834:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801838:	0f b6 00             	movzbl (%rax),%eax
+  80183b:	0f b6 c0             	movzbl %al,%eax
+  80183e:	29 c2                	sub    %eax,%edx
+  801840:	eb 20                	jmp    801862 <memcmp+0x84>
+		s1++, s2++;
+  801842:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801847:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  80184c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801850:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801854:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801858:	48 85 c0             	test   %rax,%rax
+  80185b:	75 bb                	jne    801818 <memcmp+0x3a>
+	}
+
+	return 0;
+  80185d:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801862:	89 d0                	mov    %edx,%eax
+  801864:	c9                   	leave
+  801865:	c3                   	ret
+
+0000000000801866 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801866:	55                   	push   %rbp
+  801867:	48 89 e5             	mov    %rsp,%rbp
+  80186a:	48 83 ec 28          	sub    $0x28,%rsp
+  80186e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80186e <memfind+0x8>
+  801875:	49 bb c2 77 00 00 00 	movabs $0x77c2,%r11
+  80187c:	00 00 00 
+  80187f:	4c 01 d8             	add    %r11,%rax
+  801882:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801886:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801889:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  80188d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801891:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801895:	48 01 d0             	add    %rdx,%rax
+  801898:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80189c:	eb 13                	jmp    8018b1 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80189e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018a2:	0f b6 00             	movzbl (%rax),%eax
+  8018a5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8018a8:	38 d0                	cmp    %dl,%al
+  8018aa:	74 11                	je     8018bd <memfind+0x57>
+	for (; s < ends; s++)
+  8018ac:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8018b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b5:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8018b9:	72 e3                	jb     80189e <memfind+0x38>
+  8018bb:	eb 01                	jmp    8018be <memfind+0x58>
+			break;
+  8018bd:	90                   	nop
+	return (void *) s;
+  8018be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018c2:	c9                   	leave
+  8018c3:	c3                   	ret
+
+00000000008018c4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8018c4:	55                   	push   %rbp
+  8018c5:	48 89 e5             	mov    %rsp,%rbp
+  8018c8:	48 83 ec 38          	sub    $0x38,%rsp
+  8018cc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018cc <strtol+0x8>
+  8018d3:	49 bb 64 77 00 00 00 	movabs $0x7764,%r11
+  8018da:	00 00 00 
+  8018dd:	4c 01 d8             	add    %r11,%rax
+  8018e0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8018e4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8018e8:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8018eb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8018f2:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8018f9:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8018fa:	eb 05                	jmp    801901 <strtol+0x3d>
+		s++;
+  8018fc:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801901:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801905:	0f b6 00             	movzbl (%rax),%eax
+  801908:	3c 20                	cmp    $0x20,%al
+  80190a:	74 f0                	je     8018fc <strtol+0x38>
+  80190c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801910:	0f b6 00             	movzbl (%rax),%eax
+  801913:	3c 09                	cmp    $0x9,%al
+  801915:	74 e5                	je     8018fc <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801917:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80191b:	0f b6 00             	movzbl (%rax),%eax
+  80191e:	3c 2b                	cmp    $0x2b,%al
+  801920:	75 07                	jne    801929 <strtol+0x65>
+		s++;
+  801922:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801927:	eb 17                	jmp    801940 <strtol+0x7c>
+	else if (*s == '-')
+  801929:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80192d:	0f b6 00             	movzbl (%rax),%eax
+  801930:	3c 2d                	cmp    $0x2d,%al
+  801932:	75 0c                	jne    801940 <strtol+0x7c>
+		s++, neg = 1;
+  801934:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801939:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801940:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801944:	74 06                	je     80194c <strtol+0x88>
+  801946:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  80194a:	75 28                	jne    801974 <strtol+0xb0>
+  80194c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801950:	0f b6 00             	movzbl (%rax),%eax
+  801953:	3c 30                	cmp    $0x30,%al
+  801955:	75 1d                	jne    801974 <strtol+0xb0>
+  801957:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80195b:	48 83 c0 01          	add    $0x1,%rax
+  80195f:	0f b6 00             	movzbl (%rax),%eax
+  801962:	3c 78                	cmp    $0x78,%al
+  801964:	75 0e                	jne    801974 <strtol+0xb0>
+		s += 2, base = 16;
+  801966:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  80196b:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801972:	eb 2c                	jmp    8019a0 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801974:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801978:	75 19                	jne    801993 <strtol+0xcf>
+  80197a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80197e:	0f b6 00             	movzbl (%rax),%eax
+  801981:	3c 30                	cmp    $0x30,%al
+  801983:	75 0e                	jne    801993 <strtol+0xcf>
+		s++, base = 8;
+  801985:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80198a:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801991:	eb 0d                	jmp    8019a0 <strtol+0xdc>
+	else if (base == 0)
+  801993:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801997:	75 07                	jne    8019a0 <strtol+0xdc>
+		base = 10;
+  801999:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8019a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019a4:	0f b6 00             	movzbl (%rax),%eax
+  8019a7:	3c 2f                	cmp    $0x2f,%al
+  8019a9:	7e 1d                	jle    8019c8 <strtol+0x104>
+  8019ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019af:	0f b6 00             	movzbl (%rax),%eax
+  8019b2:	3c 39                	cmp    $0x39,%al
+  8019b4:	7f 12                	jg     8019c8 <strtol+0x104>
+			dig = *s - '0';
+  8019b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ba:	0f b6 00             	movzbl (%rax),%eax
+  8019bd:	0f be c0             	movsbl %al,%eax
+  8019c0:	83 e8 30             	sub    $0x30,%eax
+  8019c3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019c6:	eb 4e                	jmp    801a16 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  8019c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019cc:	0f b6 00             	movzbl (%rax),%eax
+  8019cf:	3c 60                	cmp    $0x60,%al
+  8019d1:	7e 1d                	jle    8019f0 <strtol+0x12c>
+  8019d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d7:	0f b6 00             	movzbl (%rax),%eax
+  8019da:	3c 7a                	cmp    $0x7a,%al
+  8019dc:	7f 12                	jg     8019f0 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  8019de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e2:	0f b6 00             	movzbl (%rax),%eax
+  8019e5:	0f be c0             	movsbl %al,%eax
+  8019e8:	83 e8 57             	sub    $0x57,%eax
+  8019eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019ee:	eb 26                	jmp    801a16 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  8019f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f4:	0f b6 00             	movzbl (%rax),%eax
+  8019f7:	3c 40                	cmp    $0x40,%al
+  8019f9:	7e 47                	jle    801a42 <strtol+0x17e>
+  8019fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ff:	0f b6 00             	movzbl (%rax),%eax
+  801a02:	3c 5a                	cmp    $0x5a,%al
+  801a04:	7f 3c                	jg     801a42 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801a06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a0a:	0f b6 00             	movzbl (%rax),%eax
+  801a0d:	0f be c0             	movsbl %al,%eax
+  801a10:	83 e8 37             	sub    $0x37,%eax
+  801a13:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801a16:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a19:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801a1c:	7d 23                	jge    801a41 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801a1e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a23:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801a26:	48 98                	cltq
+  801a28:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801a2d:	48 89 c2             	mov    %rax,%rdx
+  801a30:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a33:	48 98                	cltq
+  801a35:	48 01 d0             	add    %rdx,%rax
+  801a38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801a3c:	e9 5f ff ff ff       	jmp    8019a0 <strtol+0xdc>
+			break;
+  801a41:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801a42:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801a47:	74 0b                	je     801a54 <strtol+0x190>
+		*endptr = (char *) s;
+  801a49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a4d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801a51:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801a54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a58:	74 09                	je     801a63 <strtol+0x19f>
+  801a5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a5e:	48 f7 d8             	neg    %rax
+  801a61:	eb 04                	jmp    801a67 <strtol+0x1a3>
+  801a63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801a67:	c9                   	leave
+  801a68:	c3                   	ret
+
+0000000000801a69 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801a69:	55                   	push   %rbp
+  801a6a:	48 89 e5             	mov    %rsp,%rbp
+  801a6d:	53                   	push   %rbx
+  801a6e:	48 83 ec 30          	sub    $0x30,%rsp
+  801a72:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801a72 <strstr+0x9>
+  801a79:	49 bb be 75 00 00 00 	movabs $0x75be,%r11
+  801a80:	00 00 00 
+  801a83:	4c 01 db             	add    %r11,%rbx
+  801a86:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801a8a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801a8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a92:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a96:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a9a:	0f b6 00             	movzbl (%rax),%eax
+  801a9d:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801aa0:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801aa4:	75 06                	jne    801aac <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801aa6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aaa:	eb 73                	jmp    801b1f <strstr+0xb6>
+
+	len = strlen(str);
+  801aac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ab0:	48 89 c7             	mov    %rax,%rdi
+  801ab3:	48 b8 c6 81 ff ff ff 	movabs $0xffffffffffff81c6,%rax
+  801aba:	ff ff ff 
+  801abd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801ac1:	ff d0                	call   *%rax
+  801ac3:	48 98                	cltq
+  801ac5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801ac9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801acd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ad1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ad5:	0f b6 00             	movzbl (%rax),%eax
+  801ad8:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801adb:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801adf:	75 07                	jne    801ae8 <strstr+0x7f>
+				return (char *) 0;
+  801ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae6:	eb 37                	jmp    801b1f <strstr+0xb6>
+		} while (sc != c);
+  801ae8:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801aec:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801aef:	75 d8                	jne    801ac9 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801af1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801af5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801af9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801afd:	48 89 ce             	mov    %rcx,%rsi
+  801b00:	48 89 c7             	mov    %rax,%rdi
+  801b03:	48 b8 7a 84 ff ff ff 	movabs $0xffffffffffff847a,%rax
+  801b0a:	ff ff ff 
+  801b0d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801b11:	ff d0                	call   *%rax
+  801b13:	85 c0                	test   %eax,%eax
+  801b15:	75 b2                	jne    801ac9 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801b17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b1b:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801b1f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b23:	c9                   	leave
+  801b24:	c3                   	ret
+
+0000000000801b25 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801b25:	55                   	push   %rbp
+  801b26:	48 89 e5             	mov    %rsp,%rbp
+  801b29:	41 57                	push   %r15
+  801b2b:	53                   	push   %rbx
+  801b2c:	48 83 ec 40          	sub    $0x40,%rsp
+  801b30:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801b30 <syscall+0xb>
+  801b37:	49 bb 00 75 00 00 00 	movabs $0x7500,%r11
+  801b3e:	00 00 00 
+  801b41:	4d 01 da             	add    %r11,%r10
+  801b44:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801b47:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801b4a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b4e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b52:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801b56:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801b5a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b5d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801b61:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801b65:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801b69:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b6d:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801b71:	4c 89 c3             	mov    %r8,%rbx
+  801b74:	cd 30                	int    $0x30
+  801b76:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801b7a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801b7e:	74 52                	je     801bd2 <syscall+0xad>
+  801b80:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b85:	7e 4b                	jle    801bd2 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b87:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b8b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b8e:	49 89 d0             	mov    %rdx,%r8
+  801b91:	89 c1                	mov    %eax,%ecx
+  801b93:	48 b8 e8 da ff ff ff 	movabs $0xffffffffffffdae8,%rax
+  801b9a:	ff ff ff 
+  801b9d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801ba1:	48 89 c2             	mov    %rax,%rdx
+  801ba4:	be 23 00 00 00       	mov    $0x23,%esi
+  801ba9:	48 b8 05 db ff ff ff 	movabs $0xffffffffffffdb05,%rax
+  801bb0:	ff ff ff 
+  801bb3:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801bb7:	48 89 c7             	mov    %rax,%rdi
+  801bba:	4d 89 d7             	mov    %r10,%r15
+  801bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc2:	49 b9 b1 cc ff ff ff 	movabs $0xffffffffffffccb1,%r9
+  801bc9:	ff ff ff 
+  801bcc:	4d 01 d1             	add    %r10,%r9
+  801bcf:	41 ff d1             	call   *%r9
+
+	return ret;
+  801bd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801bd6:	48 83 c4 40          	add    $0x40,%rsp
+  801bda:	5b                   	pop    %rbx
+  801bdb:	41 5f                	pop    %r15
+  801bdd:	5d                   	pop    %rbp
+  801bde:	c3                   	ret
+
+0000000000801bdf <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801bdf:	55                   	push   %rbp
+  801be0:	48 89 e5             	mov    %rsp,%rbp
+  801be3:	41 57                	push   %r15
+  801be5:	41 56                	push   %r14
+  801be7:	41 55                	push   %r13
+  801be9:	41 54                	push   %r12
+  801beb:	53                   	push   %rbx
+  801bec:	48 83 ec 48          	sub    $0x48,%rsp
+  801bf0:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801bf0 <syscall_words+0x11>
+  801bf7:	49 bb 40 74 00 00 00 	movabs $0x7440,%r11
+  801bfe:	00 00 00 
+  801c01:	4d 01 de             	add    %r11,%r14
+  801c04:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801c07:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801c0a:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801c0e:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801c12:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801c16:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801c1a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c1f:	74 09                	je     801c2a <syscall_words+0x4b>
+  801c21:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c25:	48 8b 00             	mov    (%rax),%rax
+  801c28:	eb 05                	jmp    801c2f <syscall_words+0x50>
+  801c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2f:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801c32:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c37:	74 0a                	je     801c43 <syscall_words+0x64>
+  801c39:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c3d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c41:	eb 05                	jmp    801c48 <syscall_words+0x69>
+  801c43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c48:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801c4b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c50:	74 0a                	je     801c5c <syscall_words+0x7d>
+  801c52:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c56:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c5a:	eb 05                	jmp    801c61 <syscall_words+0x82>
+  801c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c61:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801c64:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c69:	74 0a                	je     801c75 <syscall_words+0x96>
+  801c6b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c6f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c73:	eb 05                	jmp    801c7a <syscall_words+0x9b>
+  801c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7a:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801c7d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c82:	74 0a                	je     801c8e <syscall_words+0xaf>
+  801c84:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c88:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c8c:	eb 05                	jmp    801c93 <syscall_words+0xb4>
+  801c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c93:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801c96:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c9b:	74 0a                	je     801ca7 <syscall_words+0xc8>
+  801c9d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ca1:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801ca5:	eb 05                	jmp    801cac <syscall_words+0xcd>
+  801ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cac:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801caf:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801cb2:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801cb6:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801cba:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801cbe:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801cc2:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801cc6:	cd 30                	int    $0x30
+  801cc8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801ccc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801cd1:	74 50                	je     801d23 <syscall_words+0x144>
+		words[0] = r8;
+  801cd3:	4c 89 c2             	mov    %r8,%rdx
+  801cd6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cda:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801cdd:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ce1:	48 83 c0 08          	add    $0x8,%rax
+  801ce5:	4c 89 ca             	mov    %r9,%rdx
+  801ce8:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801ceb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cef:	48 83 c0 10          	add    $0x10,%rax
+  801cf3:	4c 89 d2             	mov    %r10,%rdx
+  801cf6:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801cf9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cfd:	48 83 c0 18          	add    $0x18,%rax
+  801d01:	4c 89 da             	mov    %r11,%rdx
+  801d04:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801d07:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d0b:	48 83 c0 20          	add    $0x20,%rax
+  801d0f:	4c 89 e2             	mov    %r12,%rdx
+  801d12:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801d15:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d19:	48 83 c0 28          	add    $0x28,%rax
+  801d1d:	4c 89 ea             	mov    %r13,%rdx
+  801d20:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801d23:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801d27:	74 52                	je     801d7b <syscall_words+0x19c>
+  801d29:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801d2e:	7e 4b                	jle    801d7b <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d30:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d34:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801d37:	49 89 d0             	mov    %rdx,%r8
+  801d3a:	89 c1                	mov    %eax,%ecx
+  801d3c:	48 b8 e8 da ff ff ff 	movabs $0xffffffffffffdae8,%rax
+  801d43:	ff ff ff 
+  801d46:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801d4a:	48 89 c2             	mov    %rax,%rdx
+  801d4d:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801d52:	48 b8 05 db ff ff ff 	movabs $0xffffffffffffdb05,%rax
+  801d59:	ff ff ff 
+  801d5c:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801d60:	48 89 c7             	mov    %rax,%rdi
+  801d63:	4d 89 f7             	mov    %r14,%r15
+  801d66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6b:	49 b9 b1 cc ff ff ff 	movabs $0xffffffffffffccb1,%r9
+  801d72:	ff ff ff 
+  801d75:	4d 01 f1             	add    %r14,%r9
+  801d78:	41 ff d1             	call   *%r9
+
+	return ret;
+  801d7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801d7f:	48 83 c4 48          	add    $0x48,%rsp
+  801d83:	5b                   	pop    %rbx
+  801d84:	41 5c                	pop    %r12
+  801d86:	41 5d                	pop    %r13
+  801d88:	41 5e                	pop    %r14
+  801d8a:	41 5f                	pop    %r15
+  801d8c:	5d                   	pop    %rbp
+  801d8d:	c3                   	ret
+
+0000000000801d8e <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801d8e:	55                   	push   %rbp
+  801d8f:	48 89 e5             	mov    %rsp,%rbp
+  801d92:	48 83 ec 10          	sub    $0x10,%rsp
+  801d96:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d96 <sys_cputs+0x8>
+  801d9d:	49 bb 9a 72 00 00 00 	movabs $0x729a,%r11
+  801da4:	00 00 00 
+  801da7:	4c 01 d8             	add    %r11,%rax
+  801daa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801dae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801db2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801db6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801dba:	48 83 ec 08          	sub    $0x8,%rsp
+  801dbe:	6a 00                	push   $0x0
+  801dc0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dc6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dcc:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd6:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  801ddd:	ff ff ff 
+  801de0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801de4:	ff d0                	call   *%rax
+  801de6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dea:	90                   	nop
+  801deb:	c9                   	leave
+  801dec:	c3                   	ret
+
+0000000000801ded <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801ded:	55                   	push   %rbp
+  801dee:	48 89 e5             	mov    %rsp,%rbp
+  801df1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801df1 <sys_cgetc+0x4>
+  801df8:	49 bb 3f 72 00 00 00 	movabs $0x723f,%r11
+  801dff:	00 00 00 
+  801e02:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801e05:	48 83 ec 08          	sub    $0x8,%rsp
+  801e09:	6a 00                	push   $0x0
+  801e0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e21:	be 00 00 00 00       	mov    $0x0,%esi
+  801e26:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e2b:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  801e32:	ff ff ff 
+  801e35:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e39:	ff d0                	call   *%rax
+  801e3b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e3f:	c9                   	leave
+  801e40:	c3                   	ret
+
+0000000000801e41 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801e41:	55                   	push   %rbp
+  801e42:	48 89 e5             	mov    %rsp,%rbp
+  801e45:	48 83 ec 10          	sub    $0x10,%rsp
+  801e49:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e49 <sys_env_destroy+0x8>
+  801e50:	49 bb e7 71 00 00 00 	movabs $0x71e7,%r11
+  801e57:	00 00 00 
+  801e5a:	4c 01 d8             	add    %r11,%rax
+  801e5d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e60:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801e63:	48 63 d2             	movslq %edx,%rdx
+  801e66:	48 83 ec 08          	sub    $0x8,%rsp
+  801e6a:	6a 00                	push   $0x0
+  801e6c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e7d:	be 01 00 00 00       	mov    $0x1,%esi
+  801e82:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e87:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  801e8e:	ff ff ff 
+  801e91:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e95:	ff d0                	call   *%rax
+  801e97:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e9b:	c9                   	leave
+  801e9c:	c3                   	ret
+
+0000000000801e9d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801e9d:	55                   	push   %rbp
+  801e9e:	48 89 e5             	mov    %rsp,%rbp
+  801ea1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ea1 <sys_getenvid+0x4>
+  801ea8:	49 bb 8f 71 00 00 00 	movabs $0x718f,%r11
+  801eaf:	00 00 00 
+  801eb2:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801eb5:	48 83 ec 08          	sub    $0x8,%rsp
+  801eb9:	6a 00                	push   $0x0
+  801ebb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ec1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ec7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ecc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed1:	be 00 00 00 00       	mov    $0x0,%esi
+  801ed6:	bf 02 00 00 00       	mov    $0x2,%edi
+  801edb:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  801ee2:	ff ff ff 
+  801ee5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ee9:	ff d0                	call   *%rax
+  801eeb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eef:	c9                   	leave
+  801ef0:	c3                   	ret
+
+0000000000801ef1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801ef1:	55                   	push   %rbp
+  801ef2:	48 89 e5             	mov    %rsp,%rbp
+  801ef5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ef5 <sys_yield+0x4>
+  801efc:	49 bb 3b 71 00 00 00 	movabs $0x713b,%r11
+  801f03:	00 00 00 
+  801f06:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f09:	48 83 ec 08          	sub    $0x8,%rsp
+  801f0d:	6a 00                	push   $0x0
+  801f0f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f25:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801f2f:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  801f36:	ff ff ff 
+  801f39:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f3d:	ff d0                	call   *%rax
+  801f3f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f43:	90                   	nop
+  801f44:	c9                   	leave
+  801f45:	c3                   	ret
+
+0000000000801f46 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801f46:	55                   	push   %rbp
+  801f47:	48 89 e5             	mov    %rsp,%rbp
+  801f4a:	48 83 ec 10          	sub    $0x10,%rsp
+  801f4e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f4e <sys_page_alloc+0x8>
+  801f55:	49 bb e2 70 00 00 00 	movabs $0x70e2,%r11
+  801f5c:	00 00 00 
+  801f5f:	4c 01 d8             	add    %r11,%rax
+  801f62:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f65:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f69:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801f6c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801f6f:	48 63 f2             	movslq %edx,%rsi
+  801f72:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f76:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f79:	48 63 d2             	movslq %edx,%rdx
+  801f7c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f80:	6a 00                	push   $0x0
+  801f82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f88:	49 89 f0             	mov    %rsi,%r8
+  801f8b:	be 01 00 00 00       	mov    $0x1,%esi
+  801f90:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f95:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  801f9c:	ff ff ff 
+  801f9f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fa3:	ff d0                	call   *%rax
+  801fa5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fa9:	c9                   	leave
+  801faa:	c3                   	ret
+
+0000000000801fab <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801fab:	55                   	push   %rbp
+  801fac:	48 89 e5             	mov    %rsp,%rbp
+  801faf:	48 83 ec 20          	sub    $0x20,%rsp
+  801fb3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fb3 <sys_page_map+0x8>
+  801fba:	49 bb 7d 70 00 00 00 	movabs $0x707d,%r11
+  801fc1:	00 00 00 
+  801fc4:	4c 01 d8             	add    %r11,%rax
+  801fc7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801fce:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801fd1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801fd5:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801fd9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801fdc:	48 63 f2             	movslq %edx,%rsi
+  801fdf:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  801fe3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801fe6:	48 63 fa             	movslq %edx,%rdi
+  801fe9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801ff0:	48 63 d2             	movslq %edx,%rdx
+  801ff3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ff7:	56                   	push   %rsi
+  801ff8:	4d 89 c1             	mov    %r8,%r9
+  801ffb:	49 89 f8             	mov    %rdi,%r8
+  801ffe:	be 01 00 00 00       	mov    $0x1,%esi
+  802003:	bf 05 00 00 00       	mov    $0x5,%edi
+  802008:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  80200f:	ff ff ff 
+  802012:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802016:	ff d0                	call   *%rax
+  802018:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80201c:	c9                   	leave
+  80201d:	c3                   	ret
+
+000000000080201e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80201e:	55                   	push   %rbp
+  80201f:	48 89 e5             	mov    %rsp,%rbp
+  802022:	48 83 ec 10          	sub    $0x10,%rsp
+  802026:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802026 <sys_page_unmap+0x8>
+  80202d:	49 bb 0a 70 00 00 00 	movabs $0x700a,%r11
+  802034:	00 00 00 
+  802037:	4c 01 d8             	add    %r11,%rax
+  80203a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80203d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802041:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802045:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802048:	48 63 d2             	movslq %edx,%rdx
+  80204b:	48 83 ec 08          	sub    $0x8,%rsp
+  80204f:	6a 00                	push   $0x0
+  802051:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802057:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80205d:	be 01 00 00 00       	mov    $0x1,%esi
+  802062:	bf 06 00 00 00       	mov    $0x6,%edi
+  802067:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  80206e:	ff ff ff 
+  802071:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802075:	ff d0                	call   *%rax
+  802077:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80207b:	c9                   	leave
+  80207c:	c3                   	ret
+
+000000000080207d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80207d:	55                   	push   %rbp
+  80207e:	48 89 e5             	mov    %rsp,%rbp
+  802081:	48 83 ec 10          	sub    $0x10,%rsp
+  802085:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802085 <sys_env_set_status+0x8>
+  80208c:	49 bb ab 6f 00 00 00 	movabs $0x6fab,%r11
+  802093:	00 00 00 
+  802096:	4c 01 d8             	add    %r11,%rax
+  802099:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80209c:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80209f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020a2:	48 63 ca             	movslq %edx,%rcx
+  8020a5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020a8:	48 63 d2             	movslq %edx,%rdx
+  8020ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8020af:	6a 00                	push   $0x0
+  8020b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8020c2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8020c7:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  8020ce:	ff ff ff 
+  8020d1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020d5:	ff d0                	call   *%rax
+  8020d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020db:	c9                   	leave
+  8020dc:	c3                   	ret
+
+00000000008020dd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8020dd:	55                   	push   %rbp
+  8020de:	48 89 e5             	mov    %rsp,%rbp
+  8020e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8020e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020e5 <sys_env_set_trapframe+0x8>
+  8020ec:	49 bb 4b 6f 00 00 00 	movabs $0x6f4b,%r11
+  8020f3:	00 00 00 
+  8020f6:	4c 01 d8             	add    %r11,%rax
+  8020f9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802100:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802104:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802107:	48 63 d2             	movslq %edx,%rdx
+  80210a:	48 83 ec 08          	sub    $0x8,%rsp
+  80210e:	6a 00                	push   $0x0
+  802110:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802116:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80211c:	be 01 00 00 00       	mov    $0x1,%esi
+  802121:	bf 09 00 00 00       	mov    $0x9,%edi
+  802126:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  80212d:	ff ff ff 
+  802130:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802134:	ff d0                	call   *%rax
+  802136:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80213a:	c9                   	leave
+  80213b:	c3                   	ret
+
+000000000080213c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80213c:	55                   	push   %rbp
+  80213d:	48 89 e5             	mov    %rsp,%rbp
+  802140:	48 83 ec 10          	sub    $0x10,%rsp
+  802144:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802144 <sys_env_set_pgfault_upcall+0x8>
+  80214b:	49 bb ec 6e 00 00 00 	movabs $0x6eec,%r11
+  802152:	00 00 00 
+  802155:	4c 01 d8             	add    %r11,%rax
+  802158:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80215b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80215f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802163:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802166:	48 63 d2             	movslq %edx,%rdx
+  802169:	48 83 ec 08          	sub    $0x8,%rsp
+  80216d:	6a 00                	push   $0x0
+  80216f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802175:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80217b:	be 01 00 00 00       	mov    $0x1,%esi
+  802180:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802185:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  80218c:	ff ff ff 
+  80218f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802193:	ff d0                	call   *%rax
+  802195:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802199:	c9                   	leave
+  80219a:	c3                   	ret
+
+000000000080219b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80219b:	55                   	push   %rbp
+  80219c:	48 89 e5             	mov    %rsp,%rbp
+  80219f:	48 83 ec 20          	sub    $0x20,%rsp
+  8021a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021a3 <sys_ipc_try_send+0x8>
+  8021aa:	49 bb 8d 6e 00 00 00 	movabs $0x6e8d,%r11
+  8021b1:	00 00 00 
+  8021b4:	4c 01 d8             	add    %r11,%rax
+  8021b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021be:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021c2:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8021c5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021c8:	48 63 fa             	movslq %edx,%rdi
+  8021cb:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8021cf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021d2:	48 63 d2             	movslq %edx,%rdx
+  8021d5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8021dd:	6a 00                	push   $0x0
+  8021df:	49 89 f9             	mov    %rdi,%r9
+  8021e2:	49 89 f0             	mov    %rsi,%r8
+  8021e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ea:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8021ef:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  8021f6:	ff ff ff 
+  8021f9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021fd:	ff d0                	call   *%rax
+  8021ff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802203:	c9                   	leave
+  802204:	c3                   	ret
+
+0000000000802205 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802205:	55                   	push   %rbp
+  802206:	48 89 e5             	mov    %rsp,%rbp
+  802209:	48 83 ec 20          	sub    $0x20,%rsp
+  80220d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80220d <sys_ipc_send+0x8>
+  802214:	49 bb 23 6e 00 00 00 	movabs $0x6e23,%r11
+  80221b:	00 00 00 
+  80221e:	4c 01 d8             	add    %r11,%rax
+  802221:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802224:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802228:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80222c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80222f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802232:	48 63 fa             	movslq %edx,%rdi
+  802235:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802239:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80223c:	48 63 d2             	movslq %edx,%rdx
+  80223f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802243:	48 83 ec 08          	sub    $0x8,%rsp
+  802247:	6a 00                	push   $0x0
+  802249:	49 89 f9             	mov    %rdi,%r9
+  80224c:	49 89 f0             	mov    %rsi,%r8
+  80224f:	be 00 00 00 00       	mov    $0x0,%esi
+  802254:	bf 17 00 00 00       	mov    $0x17,%edi
+  802259:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  802260:	ff ff ff 
+  802263:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802267:	ff d0                	call   *%rax
+  802269:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80226d:	c9                   	leave
+  80226e:	c3                   	ret
+
+000000000080226f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80226f:	55                   	push   %rbp
+  802270:	48 89 e5             	mov    %rsp,%rbp
+  802273:	48 83 ec 10          	sub    $0x10,%rsp
+  802277:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802277 <sys_ipc_recv+0x8>
+  80227e:	49 bb b9 6d 00 00 00 	movabs $0x6db9,%r11
+  802285:	00 00 00 
+  802288:	4c 01 d8             	add    %r11,%rax
+  80228b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80228f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802293:	6a 00                	push   $0x0
+  802295:	6a 00                	push   $0x0
+  802297:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80229d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ad:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8022b2:	49 ba af 8b ff ff ff 	movabs $0xffffffffffff8baf,%r10
+  8022b9:	ff ff ff 
+  8022bc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c0:	ff d0                	call   *%rax
+  8022c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c6:	c9                   	leave
+  8022c7:	c3                   	ret
+
+00000000008022c8 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8022c8:	55                   	push   %rbp
+  8022c9:	48 89 e5             	mov    %rsp,%rbp
+  8022cc:	48 83 ec 30          	sub    $0x30,%rsp
+  8022d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d0 <sys_ipc_call+0x8>
+  8022d7:	49 bb 60 6d 00 00 00 	movabs $0x6d60,%r11
+  8022de:	00 00 00 
+  8022e1:	4c 01 d8             	add    %r11,%rax
+  8022e4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022eb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8022ef:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8022f2:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8022f6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8022fa:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8022fe:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802301:	4c 63 c2             	movslq %edx,%r8
+  802304:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802308:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80230b:	48 63 d2             	movslq %edx,%rdx
+  80230e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802312:	ff 75 d8             	push   -0x28(%rbp)
+  802315:	56                   	push   %rsi
+  802316:	4d 89 c1             	mov    %r8,%r9
+  802319:	49 89 f8             	mov    %rdi,%r8
+  80231c:	be 00 00 00 00       	mov    $0x0,%esi
+  802321:	bf 18 00 00 00       	mov    $0x18,%edi
+  802326:	49 ba af 8b ff ff ff 	movabs $0xffffffffffff8baf,%r10
+  80232d:	ff ff ff 
+  802330:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802334:	ff d0                	call   *%rax
+  802336:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80233a:	c9                   	leave
+  80233b:	c3                   	ret
+
+000000000080233c <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80233c:	55                   	push   %rbp
+  80233d:	48 89 e5             	mov    %rsp,%rbp
+  802340:	48 83 ec 30          	sub    $0x30,%rsp
+  802344:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802344 <sys_ipc_reply_recv+0x8>
+  80234b:	49 bb ec 6c 00 00 00 	movabs $0x6cec,%r11
+  802352:	00 00 00 
+  802355:	4c 01 d8             	add    %r11,%rax
+  802358:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80235b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80235f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802363:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802366:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80236a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80236e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802372:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802375:	4c 63 c2             	movslq %edx,%r8
+  802378:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80237c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80237f:	48 63 d2             	movslq %edx,%rdx
+  802382:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802386:	ff 75 d8             	push   -0x28(%rbp)
+  802389:	56                   	push   %rsi
+  80238a:	4d 89 c1             	mov    %r8,%r9
+  80238d:	49 89 f8             	mov    %rdi,%r8
+  802390:	be 00 00 00 00       	mov    $0x0,%esi
+  802395:	bf 19 00 00 00       	mov    $0x19,%edi
+  80239a:	49 ba af 8b ff ff ff 	movabs $0xffffffffffff8baf,%r10
+  8023a1:	ff ff ff 
+  8023a4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023a8:	ff d0                	call   *%rax
+  8023aa:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+
+00000000008023b0 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8023b0:	55                   	push   %rbp
+  8023b1:	48 89 e5             	mov    %rsp,%rbp
+  8023b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023b8 <sys_env_set_priority+0x8>
+  8023bf:	49 bb 78 6c 00 00 00 	movabs $0x6c78,%r11
+  8023c6:	00 00 00 
+  8023c9:	4c 01 d8             	add    %r11,%rax
+  8023cc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023cf:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8023d2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023d5:	48 63 ca             	movslq %edx,%rcx
+  8023d8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023db:	48 63 d2             	movslq %edx,%rdx
+  8023de:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e2:	6a 00                	push   $0x0
+  8023e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8023f5:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8023fa:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  802401:	ff ff ff 
+  802404:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802408:	ff d0                	call   *%rax
+  80240a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80240e:	c9                   	leave
+  80240f:	c3                   	ret
+
+0000000000802410 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802410:	55                   	push   %rbp
+  802411:	48 89 e5             	mov    %rsp,%rbp
+  802414:	48 83 ec 10          	sub    $0x10,%rsp
+  802418:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802418 <sys_env_set_affinity+0x8>
+  80241f:	49 bb 18 6c 00 00 00 	movabs $0x6c18,%r11
+  802426:	00 00 00 
+  802429:	4c 01 d8             	add    %r11,%rax
+  80242c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80242f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802432:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802435:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802438:	48 63 d2             	movslq %edx,%rdx
+  80243b:	48 83 ec 08          	sub    $0x8,%rsp
+  80243f:	6a 00                	push   $0x0
+  802441:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802447:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80244d:	be 01 00 00 00       	mov    $0x1,%esi
+  802452:	bf 10 00 00 00       	mov    $0x10,%edi
+  802457:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  80245e:	ff ff ff 
+  802461:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802465:	ff d0                	call   *%rax
+  802467:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80246b:	c9                   	leave
+  80246c:	c3                   	ret
+
+000000000080246d <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80246d:	55                   	push   %rbp
+  80246e:	48 89 e5             	mov    %rsp,%rbp
+  802471:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802471 <sys_time_msec+0x4>
+  802478:	49 bb bf 6b 00 00 00 	movabs $0x6bbf,%r11
+  80247f:	00 00 00 
+  802482:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802485:	48 83 ec 08          	sub    $0x8,%rsp
+  802489:	6a 00                	push   $0x0
+  80248b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802491:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802497:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80249c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a6:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8024ab:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  8024b2:	ff ff ff 
+  8024b5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024b9:	ff d0                	call   *%rax
+  8024bb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024bf:	c9                   	leave
+  8024c0:	c3                   	ret
+
+00000000008024c1 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8024c1:	55                   	push   %rbp
+  8024c2:	48 89 e5             	mov    %rsp,%rbp
+  8024c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8024c9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024c9 <sys_sleep_usec+0x8>
+  8024d0:	49 bb 67 6b 00 00 00 	movabs $0x6b67,%r11
+  8024d7:	00 00 00 
+  8024da:	4c 01 d8             	add    %r11,%rax
+  8024dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8024e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8024e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8024e9:	6a 00                	push   $0x0
+  8024eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802501:	bf 11 00 00 00       	mov    $0x11,%edi
+  802506:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  80250d:	ff ff ff 
+  802510:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802514:	ff d0                	call   *%rax
+  802516:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80251a:	c9                   	leave
+  80251b:	c3                   	ret
+
+000000000080251c <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80251c:	55                   	push   %rbp
+  80251d:	48 89 e5             	mov    %rsp,%rbp
+  802520:	48 83 ec 10          	sub    $0x10,%rsp
+  802524:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802524 <sys_page_alloc_huge+0x8>
+  80252b:	49 bb 0c 6b 00 00 00 	movabs $0x6b0c,%r11
+  802532:	00 00 00 
+  802535:	4c 01 d8             	add    %r11,%rax
+  802538:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80253b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80253f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802542:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802545:	48 63 f2             	movslq %edx,%rsi
+  802548:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80254c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80254f:	48 63 d2             	movslq %edx,%rdx
+  802552:	48 83 ec 08          	sub    $0x8,%rsp
+  802556:	6a 00                	push   $0x0
+  802558:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80255e:	49 89 f0             	mov    %rsi,%r8
+  802561:	be 01 00 00 00       	mov    $0x1,%esi
+  802566:	bf 12 00 00 00       	mov    $0x12,%edi
+  80256b:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  802572:	ff ff ff 
+  802575:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802579:	ff d0                	call   *%rax
+  80257b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80257f:	c9                   	leave
+  802580:	c3                   	ret
+
+0000000000802581 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802581:	55                   	push   %rbp
+  802582:	48 89 e5             	mov    %rsp,%rbp
+  802585:	48 83 ec 10          	sub    $0x10,%rsp
+  802589:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802589 <sys_page_map_batch+0x8>
+  802590:	49 bb a7 6a 00 00 00 	movabs $0x6aa7,%r11
+  802597:	00 00 00 
+  80259a:	4c 01 d8             	add    %r11,%rax
+  80259d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025a1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8025a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025a9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b1:	6a 00                	push   $0x0
+  8025b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8025c4:	bf 13 00 00 00       	mov    $0x13,%edi
+  8025c9:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  8025d0:	ff ff ff 
+  8025d3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025d7:	ff d0                	call   *%rax
+  8025d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025dd:	c9                   	leave
+  8025de:	c3                   	ret
+
+00000000008025df <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8025df:	55                   	push   %rbp
+  8025e0:	48 89 e5             	mov    %rsp,%rbp
+  8025e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8025e7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025e7 <sys_page_alloc_batch+0x8>
+  8025ee:	49 bb 49 6a 00 00 00 	movabs $0x6a49,%r11
+  8025f5:	00 00 00 
+  8025f8:	4c 01 d8             	add    %r11,%rax
+  8025fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802603:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802607:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80260b:	48 83 ec 08          	sub    $0x8,%rsp
+  80260f:	6a 00                	push   $0x0
+  802611:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802617:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80261d:	be 01 00 00 00       	mov    $0x1,%esi
+  802622:	bf 14 00 00 00       	mov    $0x14,%edi
+  802627:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  80262e:	ff ff ff 
+  802631:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802635:	ff d0                	call   *%rax
+  802637:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80263b:	c9                   	leave
+  80263c:	c3                   	ret
+
+000000000080263d <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80263d:	55                   	push   %rbp
+  80263e:	48 89 e5             	mov    %rsp,%rbp
+  802641:	48 83 ec 10          	sub    $0x10,%rsp
+  802645:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802645 <sys_page_unmap_batch+0x8>
+  80264c:	49 bb eb 69 00 00 00 	movabs $0x69eb,%r11
+  802653:	00 00 00 
+  802656:	4c 01 d8             	add    %r11,%rax
+  802659:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80265d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802661:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802665:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802669:	48 83 ec 08          	sub    $0x8,%rsp
+  80266d:	6a 00                	push   $0x0
+  80266f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802675:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80267b:	be 01 00 00 00       	mov    $0x1,%esi
+  802680:	bf 15 00 00 00       	mov    $0x15,%edi
+  802685:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  80268c:	ff ff ff 
+  80268f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802693:	ff d0                	call   *%rax
+  802695:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802699:	c9                   	leave
+  80269a:	c3                   	ret
+
+000000000080269b <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80269b:	55                   	push   %rbp
+  80269c:	48 89 e5             	mov    %rsp,%rbp
+  80269f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80269f <sys_fork+0x4>
+  8026a6:	49 bb 91 69 00 00 00 	movabs $0x6991,%r11
+  8026ad:	00 00 00 
+  8026b0:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8026b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b7:	6a 00                	push   $0x0
+  8026b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8026d4:	bf 16 00 00 00       	mov    $0x16,%edi
+  8026d9:	49 ba f5 8a ff ff ff 	movabs $0xffffffffffff8af5,%r10
+  8026e0:	ff ff ff 
+  8026e3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026e7:	ff d0                	call   *%rax
+  8026e9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026ed:	c9                   	leave
+  8026ee:	c3                   	ret
+
+00000000008026ef <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  8026ef:	55                   	push   %rbp
+  8026f0:	48 89 e5             	mov    %rsp,%rbp
+  8026f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8026f7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026f7 <argstart+0x8>
+  8026fe:	49 bb 39 69 00 00 00 	movabs $0x6939,%r11
+  802705:	00 00 00 
+  802708:	4c 01 d8             	add    %r11,%rax
+  80270b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80270f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802713:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	args->argc = argc;
+  802717:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80271b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80271f:	48 89 0a             	mov    %rcx,(%rdx)
+	args->argv = (const char **) argv;
+  802722:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802726:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80272a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  80272e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802732:	8b 12                	mov    (%rdx),%edx
+  802734:	83 fa 01             	cmp    $0x1,%edx
+  802737:	7e 17                	jle    802750 <argstart+0x61>
+  802739:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80273e:	74 10                	je     802750 <argstart+0x61>
+  802740:	48 ba 13 db ff ff ff 	movabs $0xffffffffffffdb13,%rdx
+  802747:	ff ff ff 
+  80274a:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80274e:	eb 05                	jmp    802755 <argstart+0x66>
+  802750:	b8 00 00 00 00       	mov    $0x0,%eax
+  802755:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802759:	48 89 42 10          	mov    %rax,0x10(%rdx)
+	args->argvalue = 0;
+  80275d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802761:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  802768:	00 
+}
+  802769:	90                   	nop
+  80276a:	c9                   	leave
+  80276b:	c3                   	ret
+
+000000000080276c <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  80276c:	55                   	push   %rbp
+  80276d:	48 89 e5             	mov    %rsp,%rbp
+  802770:	41 57                	push   %r15
+  802772:	48 83 ec 28          	sub    $0x28,%rsp
+  802776:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802776 <argnext+0xa>
+  80277d:	49 bb ba 68 00 00 00 	movabs $0x68ba,%r11
+  802784:	00 00 00 
+  802787:	4c 01 d8             	add    %r11,%rax
+  80278a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int arg;
+
+	args->argvalue = 0;
+  80278e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802792:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  802799:	00 
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  80279a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80279e:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  8027a2:	48 85 d2             	test   %rdx,%rdx
+  8027a5:	75 0a                	jne    8027b1 <argnext+0x45>
+		return -1;
+  8027a7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8027ac:	e9 28 01 00 00       	jmp    8028d9 <argnext+0x16d>
+
+	if (!*args->curarg) {
+  8027b1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027b5:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  8027b9:	0f b6 12             	movzbl (%rdx),%edx
+  8027bc:	84 d2                	test   %dl,%dl
+  8027be:	0f 85 d6 00 00 00    	jne    80289a <argnext+0x12e>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  8027c4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027c8:	48 8b 12             	mov    (%rdx),%rdx
+  8027cb:	8b 12                	mov    (%rdx),%edx
+  8027cd:	83 fa 01             	cmp    $0x1,%edx
+  8027d0:	0f 84 ee 00 00 00    	je     8028c4 <argnext+0x158>
+		    || args->argv[1][0] != '-'
+  8027d6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027da:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  8027de:	48 83 c2 08          	add    $0x8,%rdx
+  8027e2:	48 8b 12             	mov    (%rdx),%rdx
+  8027e5:	0f b6 12             	movzbl (%rdx),%edx
+  8027e8:	80 fa 2d             	cmp    $0x2d,%dl
+  8027eb:	0f 85 d3 00 00 00    	jne    8028c4 <argnext+0x158>
+		    || args->argv[1][1] == '\0')
+  8027f1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8027f5:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  8027f9:	48 83 c2 08          	add    $0x8,%rdx
+  8027fd:	48 8b 12             	mov    (%rdx),%rdx
+  802800:	48 83 c2 01          	add    $0x1,%rdx
+  802804:	0f b6 12             	movzbl (%rdx),%edx
+  802807:	84 d2                	test   %dl,%dl
+  802809:	0f 84 b5 00 00 00    	je     8028c4 <argnext+0x158>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  80280f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802813:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  802817:	48 83 c2 08          	add    $0x8,%rdx
+  80281b:	48 8b 12             	mov    (%rdx),%rdx
+  80281e:	48 8d 4a 01          	lea    0x1(%rdx),%rcx
+  802822:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802826:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80282a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80282e:	48 8b 12             	mov    (%rdx),%rdx
+  802831:	8b 12                	mov    (%rdx),%edx
+  802833:	83 ea 01             	sub    $0x1,%edx
+  802836:	48 63 d2             	movslq %edx,%rdx
+  802839:	48 c1 e2 03          	shl    $0x3,%rdx
+  80283d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802841:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  802845:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  802849:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80284d:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  802851:	48 83 c1 08          	add    $0x8,%rcx
+  802855:	48 89 cf             	mov    %rcx,%rdi
+  802858:	49 89 c7             	mov    %rax,%r15
+  80285b:	48 b9 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rcx
+  802862:	ff ff ff 
+  802865:	48 01 c1             	add    %rax,%rcx
+  802868:	ff d1                	call   *%rcx
+		(*args->argc)--;
+  80286a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80286e:	48 8b 00             	mov    (%rax),%rax
+  802871:	8b 10                	mov    (%rax),%edx
+  802873:	83 ea 01             	sub    $0x1,%edx
+  802876:	89 10                	mov    %edx,(%rax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  802878:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80287c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802880:	0f b6 00             	movzbl (%rax),%eax
+  802883:	3c 2d                	cmp    $0x2d,%al
+  802885:	75 13                	jne    80289a <argnext+0x12e>
+  802887:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80288b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80288f:	48 83 c0 01          	add    $0x1,%rax
+  802893:	0f b6 00             	movzbl (%rax),%eax
+  802896:	84 c0                	test   %al,%al
+  802898:	74 2d                	je     8028c7 <argnext+0x15b>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  80289a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80289e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8028a2:	0f b6 00             	movzbl (%rax),%eax
+  8028a5:	0f b6 c0             	movzbl %al,%eax
+  8028a8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	args->curarg++;
+  8028ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028af:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8028b3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8028b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028bb:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	return arg;
+  8028bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028c2:	eb 15                	jmp    8028d9 <argnext+0x16d>
+			goto endofargs;
+  8028c4:	90                   	nop
+  8028c5:	eb 01                	jmp    8028c8 <argnext+0x15c>
+			goto endofargs;
+  8028c7:	90                   	nop
+
+endofargs:
+	args->curarg = 0;
+  8028c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028cc:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8028d3:	00 
+	return -1;
+  8028d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  8028d9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8028dd:	c9                   	leave
+  8028de:	c3                   	ret
+
+00000000008028df <argvalue>:
+
+char *
+argvalue(struct Argstate *args)
+{
+  8028df:	55                   	push   %rbp
+  8028e0:	48 89 e5             	mov    %rsp,%rbp
+  8028e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8028e7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028e7 <argvalue+0x8>
+  8028ee:	49 bb 49 67 00 00 00 	movabs $0x6749,%r11
+  8028f5:	00 00 00 
+  8028f8:	4c 01 d8             	add    %r11,%rax
+  8028fb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  8028ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802903:	48 8b 52 18          	mov    0x18(%rdx),%rdx
+  802907:	48 85 d2             	test   %rdx,%rdx
+  80290a:	74 0a                	je     802916 <argvalue+0x37>
+  80290c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802910:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802914:	eb 17                	jmp    80292d <argvalue+0x4e>
+  802916:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80291a:	48 89 d7             	mov    %rdx,%rdi
+  80291d:	48 ba ff 98 ff ff ff 	movabs $0xffffffffffff98ff,%rdx
+  802924:	ff ff ff 
+  802927:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80292b:	ff d0                	call   *%rax
+}
+  80292d:	c9                   	leave
+  80292e:	c3                   	ret
+
+000000000080292f <argnextvalue>:
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  80292f:	55                   	push   %rbp
+  802930:	48 89 e5             	mov    %rsp,%rbp
+  802933:	41 57                	push   %r15
+  802935:	48 83 ec 18          	sub    $0x18,%rsp
+  802939:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802939 <argnextvalue+0xa>
+  802940:	49 bb f7 66 00 00 00 	movabs $0x66f7,%r11
+  802947:	00 00 00 
+  80294a:	4c 01 d8             	add    %r11,%rax
+  80294d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (!args->curarg)
+  802951:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802955:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  802959:	48 85 d2             	test   %rdx,%rdx
+  80295c:	75 0a                	jne    802968 <argnextvalue+0x39>
+		return 0;
+  80295e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802963:	e9 cc 00 00 00       	jmp    802a34 <argnextvalue+0x105>
+	if (*args->curarg) {
+  802968:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80296c:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  802970:	0f b6 12             	movzbl (%rdx),%edx
+  802973:	84 d2                	test   %dl,%dl
+  802975:	74 2b                	je     8029a2 <argnextvalue+0x73>
+		args->argvalue = args->curarg;
+  802977:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80297b:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80297f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802983:	48 89 4a 18          	mov    %rcx,0x18(%rdx)
+		args->curarg = "";
+  802987:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80298b:	48 b9 13 db ff ff ff 	movabs $0xffffffffffffdb13,%rcx
+  802992:	ff ff ff 
+  802995:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802999:	48 89 42 10          	mov    %rax,0x10(%rdx)
+  80299d:	e9 8a 00 00 00       	jmp    802a2c <argnextvalue+0xfd>
+	} else if (*args->argc > 1) {
+  8029a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8029a6:	48 8b 12             	mov    (%rdx),%rdx
+  8029a9:	8b 12                	mov    (%rdx),%edx
+  8029ab:	83 fa 01             	cmp    $0x1,%edx
+  8029ae:	7e 64                	jle    802a14 <argnextvalue+0xe5>
+		args->argvalue = args->argv[1];
+  8029b0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8029b4:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  8029b8:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  8029bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8029c0:	48 89 4a 18          	mov    %rcx,0x18(%rdx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8029c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8029c8:	48 8b 12             	mov    (%rdx),%rdx
+  8029cb:	8b 12                	mov    (%rdx),%edx
+  8029cd:	83 ea 01             	sub    $0x1,%edx
+  8029d0:	48 63 d2             	movslq %edx,%rdx
+  8029d3:	48 c1 e2 03          	shl    $0x3,%rdx
+  8029d7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8029db:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  8029df:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  8029e3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8029e7:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  8029eb:	48 83 c1 08          	add    $0x8,%rcx
+  8029ef:	48 89 cf             	mov    %rcx,%rdi
+  8029f2:	49 89 c7             	mov    %rax,%r15
+  8029f5:	48 b9 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rcx
+  8029fc:	ff ff ff 
+  8029ff:	48 01 c1             	add    %rax,%rcx
+  802a02:	ff d1                	call   *%rcx
+		(*args->argc)--;
+  802a04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a08:	48 8b 00             	mov    (%rax),%rax
+  802a0b:	8b 10                	mov    (%rax),%edx
+  802a0d:	83 ea 01             	sub    $0x1,%edx
+  802a10:	89 10                	mov    %edx,(%rax)
+  802a12:	eb 18                	jmp    802a2c <argnextvalue+0xfd>
+	} else {
+		args->argvalue = 0;
+  802a14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a18:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  802a1f:	00 
+		args->curarg = 0;
+  802a20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a24:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802a2b:	00 
+	}
+	return (char*) args->argvalue;
+  802a2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a30:	48 8b 40 18          	mov    0x18(%rax),%rax
+}
+  802a34:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802a38:	c9                   	leave
+  802a39:	c3                   	ret
+
+0000000000802a3a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	48 83 ec 08          	sub    $0x8,%rsp
+  802a42:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a42 <fd2num+0x8>
+  802a49:	49 bb ee 65 00 00 00 	movabs $0x65ee,%r11
+  802a50:	00 00 00 
+  802a53:	4c 01 d8             	add    %r11,%rax
+  802a56:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802a5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a5e:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802a65:	ff ff ff 
+  802a68:	48 01 d0             	add    %rdx,%rax
+  802a6b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802a6f:	c9                   	leave
+  802a70:	c3                   	ret
+
+0000000000802a71 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802a71:	55                   	push   %rbp
+  802a72:	48 89 e5             	mov    %rsp,%rbp
+  802a75:	48 83 ec 08          	sub    $0x8,%rsp
+  802a79:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a79 <fd2data+0x8>
+  802a80:	49 bb b7 65 00 00 00 	movabs $0x65b7,%r11
+  802a87:	00 00 00 
+  802a8a:	4c 01 d8             	add    %r11,%rax
+  802a8d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802a91:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a95:	48 89 d7             	mov    %rdx,%rdi
+  802a98:	48 ba 0a 9a ff ff ff 	movabs $0xffffffffffff9a0a,%rdx
+  802a9f:	ff ff ff 
+  802aa2:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802aa6:	ff d0                	call   *%rax
+  802aa8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802aae:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802ab2:	c9                   	leave
+  802ab3:	c3                   	ret
+
+0000000000802ab4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802ab4:	55                   	push   %rbp
+  802ab5:	48 89 e5             	mov    %rsp,%rbp
+  802ab8:	48 83 ec 18          	sub    $0x18,%rsp
+  802abc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802abc <fd_alloc+0x8>
+  802ac3:	49 bb 74 65 00 00 00 	movabs $0x6574,%r11
+  802aca:	00 00 00 
+  802acd:	4c 01 d8             	add    %r11,%rax
+  802ad0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802ad4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802adb:	eb 75                	jmp    802b52 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802add:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802ae0:	48 63 d2             	movslq %edx,%rdx
+  802ae3:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802aea:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802aee:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802af2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802af6:	48 89 d1             	mov    %rdx,%rcx
+  802af9:	48 c1 e9 15          	shr    $0x15,%rcx
+  802afd:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802b04:	ff ff ff 
+  802b07:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802b0b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802b0f:	83 e2 01             	and    $0x1,%edx
+  802b12:	48 85 d2             	test   %rdx,%rdx
+  802b15:	74 25                	je     802b3c <fd_alloc+0x88>
+  802b17:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b1b:	48 89 d1             	mov    %rdx,%rcx
+  802b1e:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802b22:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802b29:	ff ff ff 
+  802b2c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802b30:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802b34:	83 e2 01             	and    $0x1,%edx
+  802b37:	48 85 d2             	test   %rdx,%rdx
+  802b3a:	75 12                	jne    802b4e <fd_alloc+0x9a>
+			*fd_store = fd;
+  802b3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b40:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b44:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4c:	eb 1a                	jmp    802b68 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802b4e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802b52:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802b56:	7e 85                	jle    802add <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802b58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b5c:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802b63:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802b68:	c9                   	leave
+  802b69:	c3                   	ret
+
+0000000000802b6a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802b6a:	55                   	push   %rbp
+  802b6b:	48 89 e5             	mov    %rsp,%rbp
+  802b6e:	48 83 ec 20          	sub    $0x20,%rsp
+  802b72:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b72 <fd_lookup+0x8>
+  802b79:	49 bb be 64 00 00 00 	movabs $0x64be,%r11
+  802b80:	00 00 00 
+  802b83:	4c 01 d8             	add    %r11,%rax
+  802b86:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b89:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802b8d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b91:	78 06                	js     802b99 <fd_lookup+0x2f>
+  802b93:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802b97:	7e 07                	jle    802ba0 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802b99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b9e:	eb 73                	jmp    802c13 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802ba0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ba3:	48 63 d2             	movslq %edx,%rdx
+  802ba6:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802bad:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802bb1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802bb5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bb9:	48 89 d1             	mov    %rdx,%rcx
+  802bbc:	48 c1 e9 15          	shr    $0x15,%rcx
+  802bc0:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802bc7:	ff ff ff 
+  802bca:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802bce:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802bd2:	83 e2 01             	and    $0x1,%edx
+  802bd5:	48 85 d2             	test   %rdx,%rdx
+  802bd8:	74 22                	je     802bfc <fd_lookup+0x92>
+  802bda:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802bde:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802be2:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802be9:	ff ff ff 
+  802bec:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802bf0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bf4:	83 e0 01             	and    $0x1,%eax
+  802bf7:	48 85 c0             	test   %rax,%rax
+  802bfa:	75 07                	jne    802c03 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802bfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c01:	eb 10                	jmp    802c13 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802c03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c07:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802c0b:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c13:	c9                   	leave
+  802c14:	c3                   	ret
+
+0000000000802c15 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802c15:	55                   	push   %rbp
+  802c16:	48 89 e5             	mov    %rsp,%rbp
+  802c19:	41 57                	push   %r15
+  802c1b:	53                   	push   %rbx
+  802c1c:	48 83 ec 30          	sub    $0x30,%rsp
+  802c20:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c20 <fd_close+0xb>
+  802c27:	49 bb 10 64 00 00 00 	movabs $0x6410,%r11
+  802c2e:	00 00 00 
+  802c31:	4c 01 db             	add    %r11,%rbx
+  802c34:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802c38:	89 f0                	mov    %esi,%eax
+  802c3a:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802c3d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c41:	48 89 c7             	mov    %rax,%rdi
+  802c44:	48 b8 0a 9a ff ff ff 	movabs $0xffffffffffff9a0a,%rax
+  802c4b:	ff ff ff 
+  802c4e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c52:	ff d0                	call   *%rax
+  802c54:	89 c2                	mov    %eax,%edx
+  802c56:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802c5a:	48 89 c6             	mov    %rax,%rsi
+  802c5d:	89 d7                	mov    %edx,%edi
+  802c5f:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  802c66:	ff ff ff 
+  802c69:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c6d:	ff d0                	call   *%rax
+  802c6f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c72:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c76:	78 0a                	js     802c82 <fd_close+0x6d>
+	    || fd != fd2)
+  802c78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c7c:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802c80:	74 12                	je     802c94 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802c82:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802c86:	74 05                	je     802c8d <fd_close+0x78>
+  802c88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c8b:	eb 7a                	jmp    802d07 <fd_close+0xf2>
+  802c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c92:	eb 73                	jmp    802d07 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802c94:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c98:	8b 00                	mov    (%rax),%eax
+  802c9a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802c9e:	48 89 d6             	mov    %rdx,%rsi
+  802ca1:	89 c7                	mov    %eax,%edi
+  802ca3:	48 b8 e0 9c ff ff ff 	movabs $0xffffffffffff9ce0,%rax
+  802caa:	ff ff ff 
+  802cad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cb1:	ff d0                	call   *%rax
+  802cb3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802cb6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802cba:	78 2a                	js     802ce6 <fd_close+0xd1>
+		if (dev->dev_close)
+  802cbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cc0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802cc4:	48 85 c0             	test   %rax,%rax
+  802cc7:	74 16                	je     802cdf <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802cc9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ccd:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802cd1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cd5:	48 89 c7             	mov    %rax,%rdi
+  802cd8:	ff d2                	call   *%rdx
+  802cda:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802cdd:	eb 07                	jmp    802ce6 <fd_close+0xd1>
+		else
+			r = 0;
+  802cdf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802ce6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cea:	48 89 c6             	mov    %rax,%rsi
+  802ced:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf2:	49 89 df             	mov    %rbx,%r15
+  802cf5:	48 b8 ee 8f ff ff ff 	movabs $0xffffffffffff8fee,%rax
+  802cfc:	ff ff ff 
+  802cff:	48 01 d8             	add    %rbx,%rax
+  802d02:	ff d0                	call   *%rax
+	return r;
+  802d04:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802d07:	48 83 c4 30          	add    $0x30,%rsp
+  802d0b:	5b                   	pop    %rbx
+  802d0c:	41 5f                	pop    %r15
+  802d0e:	5d                   	pop    %rbp
+  802d0f:	c3                   	ret
+
+0000000000802d10 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802d10:	55                   	push   %rbp
+  802d11:	48 89 e5             	mov    %rsp,%rbp
+  802d14:	41 57                	push   %r15
+  802d16:	48 83 ec 28          	sub    $0x28,%rsp
+  802d1a:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802d1a <dev_lookup+0xa>
+  802d21:	49 bb 16 63 00 00 00 	movabs $0x6316,%r11
+  802d28:	00 00 00 
+  802d2b:	4c 01 d9             	add    %r11,%rcx
+  802d2e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d31:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802d35:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802d3c:	eb 45                	jmp    802d83 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802d3e:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802d45:	00 00 00 
+  802d48:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d4b:	48 98                	cltq
+  802d4d:	48 01 ca             	add    %rcx,%rdx
+  802d50:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d54:	8b 00                	mov    (%rax),%eax
+  802d56:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802d59:	75 24                	jne    802d7f <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802d5b:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802d62:	00 00 00 
+  802d65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d68:	48 98                	cltq
+  802d6a:	48 01 ca             	add    %rcx,%rdx
+  802d6d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d75:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802d78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d7d:	eb 74                	jmp    802df3 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802d7f:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802d83:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802d8a:	00 00 00 
+  802d8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d90:	48 98                	cltq
+  802d92:	48 01 ca             	add    %rcx,%rdx
+  802d95:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d99:	48 85 c0             	test   %rax,%rax
+  802d9c:	75 a0                	jne    802d3e <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802d9e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802da5:	ff ff ff 
+  802da8:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802dac:	48 8b 00             	mov    (%rax),%rax
+  802daf:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802db5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802db8:	89 c6                	mov    %eax,%esi
+  802dba:	48 b8 18 db ff ff ff 	movabs $0xffffffffffffdb18,%rax
+  802dc1:	ff ff ff 
+  802dc4:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802dc8:	48 89 c7             	mov    %rax,%rdi
+  802dcb:	49 89 cf             	mov    %rcx,%r15
+  802dce:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd3:	49 b8 98 74 ff ff ff 	movabs $0xffffffffffff7498,%r8
+  802dda:	ff ff ff 
+  802ddd:	49 01 c8             	add    %rcx,%r8
+  802de0:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802de3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802de7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802dee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802df3:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802df7:	c9                   	leave
+  802df8:	c3                   	ret
+
+0000000000802df9 <close>:
+
+int
+close(int fdnum)
+{
+  802df9:	55                   	push   %rbp
+  802dfa:	48 89 e5             	mov    %rsp,%rbp
+  802dfd:	53                   	push   %rbx
+  802dfe:	48 83 ec 28          	sub    $0x28,%rsp
+  802e02:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e02 <close+0x9>
+  802e09:	49 bb 2e 62 00 00 00 	movabs $0x622e,%r11
+  802e10:	00 00 00 
+  802e13:	4c 01 db             	add    %r11,%rbx
+  802e16:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e19:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802e1d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e20:	48 89 d6             	mov    %rdx,%rsi
+  802e23:	89 c7                	mov    %eax,%edi
+  802e25:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  802e2c:	ff ff ff 
+  802e2f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e33:	ff d0                	call   *%rax
+  802e35:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e38:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e3c:	79 05                	jns    802e43 <close+0x4a>
+		return r;
+  802e3e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e41:	eb 1c                	jmp    802e5f <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802e43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e47:	be 01 00 00 00       	mov    $0x1,%esi
+  802e4c:	48 89 c7             	mov    %rax,%rdi
+  802e4f:	48 b8 e5 9b ff ff ff 	movabs $0xffffffffffff9be5,%rax
+  802e56:	ff ff ff 
+  802e59:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e5d:	ff d0                	call   *%rax
+}
+  802e5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e63:	c9                   	leave
+  802e64:	c3                   	ret
+
+0000000000802e65 <close_all>:
+
+void
+close_all(void)
+{
+  802e65:	55                   	push   %rbp
+  802e66:	48 89 e5             	mov    %rsp,%rbp
+  802e69:	53                   	push   %rbx
+  802e6a:	48 83 ec 18          	sub    $0x18,%rsp
+  802e6e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e6e <close_all+0x9>
+  802e75:	49 bb c2 61 00 00 00 	movabs $0x61c2,%r11
+  802e7c:	00 00 00 
+  802e7f:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802e82:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802e89:	eb 19                	jmp    802ea4 <close_all+0x3f>
+		close(i);
+  802e8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e8e:	89 c7                	mov    %eax,%edi
+  802e90:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  802e97:	ff ff ff 
+  802e9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e9e:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802ea0:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802ea4:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802ea8:	7e e1                	jle    802e8b <close_all+0x26>
+}
+  802eaa:	90                   	nop
+  802eab:	90                   	nop
+  802eac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eb0:	c9                   	leave
+  802eb1:	c3                   	ret
+
+0000000000802eb2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802eb2:	55                   	push   %rbp
+  802eb3:	48 89 e5             	mov    %rsp,%rbp
+  802eb6:	41 57                	push   %r15
+  802eb8:	53                   	push   %rbx
+  802eb9:	48 83 ec 40          	sub    $0x40,%rsp
+  802ebd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ebd <dup+0xb>
+  802ec4:	49 bb 73 61 00 00 00 	movabs $0x6173,%r11
+  802ecb:	00 00 00 
+  802ece:	4c 01 db             	add    %r11,%rbx
+  802ed1:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802ed4:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802ed7:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802edb:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802ede:	48 89 d6             	mov    %rdx,%rsi
+  802ee1:	89 c7                	mov    %eax,%edi
+  802ee3:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  802eea:	ff ff ff 
+  802eed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ef1:	ff d0                	call   *%rax
+  802ef3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ef6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802efa:	79 08                	jns    802f04 <dup+0x52>
+		return r;
+  802efc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eff:	e9 a4 01 00 00       	jmp    8030a8 <dup+0x1f6>
+	close(newfdnum);
+  802f04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f07:	89 c7                	mov    %eax,%edi
+  802f09:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  802f10:	ff ff ff 
+  802f13:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f17:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802f19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802f1c:	48 98                	cltq
+  802f1e:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802f24:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f28:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802f2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f30:	48 89 c7             	mov    %rax,%rdi
+  802f33:	48 b8 41 9a ff ff ff 	movabs $0xffffffffffff9a41,%rax
+  802f3a:	ff ff ff 
+  802f3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f41:	ff d0                	call   *%rax
+  802f43:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802f47:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f4b:	48 89 c7             	mov    %rax,%rdi
+  802f4e:	48 b8 41 9a ff ff ff 	movabs $0xffffffffffff9a41,%rax
+  802f55:	ff ff ff 
+  802f58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f5c:	ff d0                	call   *%rax
+  802f5e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802f62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f66:	48 c1 e8 15          	shr    $0x15,%rax
+  802f6a:	48 89 c2             	mov    %rax,%rdx
+  802f6d:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802f74:	ff ff ff 
+  802f77:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f7b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f7f:	83 e0 01             	and    $0x1,%eax
+  802f82:	48 85 c0             	test   %rax,%rax
+  802f85:	74 7f                	je     803006 <dup+0x154>
+  802f87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f8b:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f8f:	48 89 c2             	mov    %rax,%rdx
+  802f92:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f99:	ff ff ff 
+  802f9c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fa0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fa4:	83 e0 01             	and    $0x1,%eax
+  802fa7:	48 85 c0             	test   %rax,%rax
+  802faa:	74 5a                	je     803006 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802fac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fb0:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fb4:	48 89 c2             	mov    %rax,%rdx
+  802fb7:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802fbe:	ff ff ff 
+  802fc1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fc5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fc9:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fce:	89 c1                	mov    %eax,%ecx
+  802fd0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802fd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fd8:	41 89 c8             	mov    %ecx,%r8d
+  802fdb:	48 89 d1             	mov    %rdx,%rcx
+  802fde:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe3:	48 89 c6             	mov    %rax,%rsi
+  802fe6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802feb:	49 89 df             	mov    %rbx,%r15
+  802fee:	48 b8 7b 8f ff ff ff 	movabs $0xffffffffffff8f7b,%rax
+  802ff5:	ff ff ff 
+  802ff8:	48 01 d8             	add    %rbx,%rax
+  802ffb:	ff d0                	call   *%rax
+  802ffd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803000:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803004:	78 5f                	js     803065 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803006:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80300a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80300e:	48 89 c2             	mov    %rax,%rdx
+  803011:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803018:	ff ff ff 
+  80301b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80301f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803023:	25 07 0e 00 00       	and    $0xe07,%eax
+  803028:	89 c1                	mov    %eax,%ecx
+  80302a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80302e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803032:	41 89 c8             	mov    %ecx,%r8d
+  803035:	48 89 d1             	mov    %rdx,%rcx
+  803038:	ba 00 00 00 00       	mov    $0x0,%edx
+  80303d:	48 89 c6             	mov    %rax,%rsi
+  803040:	bf 00 00 00 00       	mov    $0x0,%edi
+  803045:	49 89 df             	mov    %rbx,%r15
+  803048:	48 b8 7b 8f ff ff ff 	movabs $0xffffffffffff8f7b,%rax
+  80304f:	ff ff ff 
+  803052:	48 01 d8             	add    %rbx,%rax
+  803055:	ff d0                	call   *%rax
+  803057:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80305a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80305e:	78 08                	js     803068 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803060:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803063:	eb 43                	jmp    8030a8 <dup+0x1f6>
+			goto err;
+  803065:	90                   	nop
+  803066:	eb 01                	jmp    803069 <dup+0x1b7>
+		goto err;
+  803068:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803069:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80306d:	48 89 c6             	mov    %rax,%rsi
+  803070:	bf 00 00 00 00       	mov    $0x0,%edi
+  803075:	49 89 df             	mov    %rbx,%r15
+  803078:	48 b8 ee 8f ff ff ff 	movabs $0xffffffffffff8fee,%rax
+  80307f:	ff ff ff 
+  803082:	48 01 d8             	add    %rbx,%rax
+  803085:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803087:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80308b:	48 89 c6             	mov    %rax,%rsi
+  80308e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803093:	49 89 df             	mov    %rbx,%r15
+  803096:	48 b8 ee 8f ff ff ff 	movabs $0xffffffffffff8fee,%rax
+  80309d:	ff ff ff 
+  8030a0:	48 01 d8             	add    %rbx,%rax
+  8030a3:	ff d0                	call   *%rax
+	return r;
+  8030a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8030a8:	48 83 c4 40          	add    $0x40,%rsp
+  8030ac:	5b                   	pop    %rbx
+  8030ad:	41 5f                	pop    %r15
+  8030af:	5d                   	pop    %rbp
+  8030b0:	c3                   	ret
+
+00000000008030b1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8030b1:	55                   	push   %rbp
+  8030b2:	48 89 e5             	mov    %rsp,%rbp
+  8030b5:	41 57                	push   %r15
+  8030b7:	53                   	push   %rbx
+  8030b8:	48 83 ec 40          	sub    $0x40,%rsp
+  8030bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030bc <read+0xb>
+  8030c3:	49 bb 74 5f 00 00 00 	movabs $0x5f74,%r11
+  8030ca:	00 00 00 
+  8030cd:	4c 01 db             	add    %r11,%rbx
+  8030d0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8030d3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8030d7:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8030db:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8030df:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8030e2:	48 89 d6             	mov    %rdx,%rsi
+  8030e5:	89 c7                	mov    %eax,%edi
+  8030e7:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  8030ee:	ff ff ff 
+  8030f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030f5:	ff d0                	call   *%rax
+  8030f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030fe:	78 28                	js     803128 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803100:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803104:	8b 00                	mov    (%rax),%eax
+  803106:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80310a:	48 89 d6             	mov    %rdx,%rsi
+  80310d:	89 c7                	mov    %eax,%edi
+  80310f:	48 b8 e0 9c ff ff ff 	movabs $0xffffffffffff9ce0,%rax
+  803116:	ff ff ff 
+  803119:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80311d:	ff d0                	call   *%rax
+  80311f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803122:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803126:	79 08                	jns    803130 <read+0x7f>
+		return r;
+  803128:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80312b:	e9 8b 00 00 00       	jmp    8031bb <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803130:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803134:	8b 40 08             	mov    0x8(%rax),%eax
+  803137:	83 e0 03             	and    $0x3,%eax
+  80313a:	83 f8 01             	cmp    $0x1,%eax
+  80313d:	75 4b                	jne    80318a <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80313f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803146:	ff ff ff 
+  803149:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80314d:	48 8b 00             	mov    (%rax),%rax
+  803150:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803156:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803159:	89 c6                	mov    %eax,%esi
+  80315b:	48 b8 37 db ff ff ff 	movabs $0xffffffffffffdb37,%rax
+  803162:	ff ff ff 
+  803165:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803169:	48 89 c7             	mov    %rax,%rdi
+  80316c:	49 89 df             	mov    %rbx,%r15
+  80316f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803174:	48 b9 98 74 ff ff ff 	movabs $0xffffffffffff7498,%rcx
+  80317b:	ff ff ff 
+  80317e:	48 01 d9             	add    %rbx,%rcx
+  803181:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803183:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803188:	eb 31                	jmp    8031bb <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80318a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80318e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803192:	48 85 c0             	test   %rax,%rax
+  803195:	75 07                	jne    80319e <read+0xed>
+		return -E_NOT_SUPP;
+  803197:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80319c:	eb 1d                	jmp    8031bb <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  80319e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031a2:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8031a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031aa:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8031ae:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8031b2:	48 89 ce             	mov    %rcx,%rsi
+  8031b5:	48 89 c7             	mov    %rax,%rdi
+  8031b8:	41 ff d0             	call   *%r8
+}
+  8031bb:	48 83 c4 40          	add    $0x40,%rsp
+  8031bf:	5b                   	pop    %rbx
+  8031c0:	41 5f                	pop    %r15
+  8031c2:	5d                   	pop    %rbp
+  8031c3:	c3                   	ret
+
+00000000008031c4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8031c4:	55                   	push   %rbp
+  8031c5:	48 89 e5             	mov    %rsp,%rbp
+  8031c8:	53                   	push   %rbx
+  8031c9:	48 83 ec 38          	sub    $0x38,%rsp
+  8031cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031cd <readn+0x9>
+  8031d4:	49 bb 63 5e 00 00 00 	movabs $0x5e63,%r11
+  8031db:	00 00 00 
+  8031de:	4c 01 db             	add    %r11,%rbx
+  8031e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031e4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8031e8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8031ec:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8031f3:	eb 4b                	jmp    803240 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8031f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031f8:	48 98                	cltq
+  8031fa:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8031fe:	48 29 c2             	sub    %rax,%rdx
+  803201:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803204:	48 63 c8             	movslq %eax,%rcx
+  803207:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80320b:	48 01 c1             	add    %rax,%rcx
+  80320e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803211:	48 89 ce             	mov    %rcx,%rsi
+  803214:	89 c7                	mov    %eax,%edi
+  803216:	48 b8 81 a0 ff ff ff 	movabs $0xffffffffffffa081,%rax
+  80321d:	ff ff ff 
+  803220:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803224:	ff d0                	call   *%rax
+  803226:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803229:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80322d:	79 05                	jns    803234 <readn+0x70>
+			return m;
+  80322f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803232:	eb 1d                	jmp    803251 <readn+0x8d>
+		if (m == 0)
+  803234:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803238:	74 13                	je     80324d <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80323a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80323d:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803240:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803243:	48 98                	cltq
+  803245:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803249:	72 aa                	jb     8031f5 <readn+0x31>
+  80324b:	eb 01                	jmp    80324e <readn+0x8a>
+			break;
+  80324d:	90                   	nop
+	}
+	return tot;
+  80324e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803251:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803255:	c9                   	leave
+  803256:	c3                   	ret
+
+0000000000803257 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803257:	55                   	push   %rbp
+  803258:	48 89 e5             	mov    %rsp,%rbp
+  80325b:	41 57                	push   %r15
+  80325d:	53                   	push   %rbx
+  80325e:	48 83 ec 40          	sub    $0x40,%rsp
+  803262:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803262 <write+0xb>
+  803269:	49 bb ce 5d 00 00 00 	movabs $0x5dce,%r11
+  803270:	00 00 00 
+  803273:	4c 01 db             	add    %r11,%rbx
+  803276:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803279:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80327d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803281:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803285:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803288:	48 89 d6             	mov    %rdx,%rsi
+  80328b:	89 c7                	mov    %eax,%edi
+  80328d:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  803294:	ff ff ff 
+  803297:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80329b:	ff d0                	call   *%rax
+  80329d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032a4:	78 28                	js     8032ce <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8032a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032aa:	8b 00                	mov    (%rax),%eax
+  8032ac:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8032b0:	48 89 d6             	mov    %rdx,%rsi
+  8032b3:	89 c7                	mov    %eax,%edi
+  8032b5:	48 b8 e0 9c ff ff ff 	movabs $0xffffffffffff9ce0,%rax
+  8032bc:	ff ff ff 
+  8032bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032c3:	ff d0                	call   *%rax
+  8032c5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032c8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032cc:	79 08                	jns    8032d6 <write+0x7f>
+		return r;
+  8032ce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032d1:	e9 8a 00 00 00       	jmp    803360 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8032d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032da:	8b 40 08             	mov    0x8(%rax),%eax
+  8032dd:	83 e0 03             	and    $0x3,%eax
+  8032e0:	85 c0                	test   %eax,%eax
+  8032e2:	75 4b                	jne    80332f <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032e4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8032eb:	ff ff ff 
+  8032ee:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032f2:	48 8b 00             	mov    (%rax),%rax
+  8032f5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8032fb:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8032fe:	89 c6                	mov    %eax,%esi
+  803300:	48 b8 53 db ff ff ff 	movabs $0xffffffffffffdb53,%rax
+  803307:	ff ff ff 
+  80330a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80330e:	48 89 c7             	mov    %rax,%rdi
+  803311:	49 89 df             	mov    %rbx,%r15
+  803314:	b8 00 00 00 00       	mov    $0x0,%eax
+  803319:	48 b9 98 74 ff ff ff 	movabs $0xffffffffffff7498,%rcx
+  803320:	ff ff ff 
+  803323:	48 01 d9             	add    %rbx,%rcx
+  803326:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803328:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80332d:	eb 31                	jmp    803360 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80332f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803333:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803337:	48 85 c0             	test   %rax,%rax
+  80333a:	75 07                	jne    803343 <write+0xec>
+		return -E_NOT_SUPP;
+  80333c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803341:	eb 1d                	jmp    803360 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803343:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803347:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80334b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80334f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803353:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803357:	48 89 ce             	mov    %rcx,%rsi
+  80335a:	48 89 c7             	mov    %rax,%rdi
+  80335d:	41 ff d0             	call   *%r8
+}
+  803360:	48 83 c4 40          	add    $0x40,%rsp
+  803364:	5b                   	pop    %rbx
+  803365:	41 5f                	pop    %r15
+  803367:	5d                   	pop    %rbp
+  803368:	c3                   	ret
+
+0000000000803369 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803369:	55                   	push   %rbp
+  80336a:	48 89 e5             	mov    %rsp,%rbp
+  80336d:	48 83 ec 18          	sub    $0x18,%rsp
+  803371:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803371 <seek+0x8>
+  803378:	49 bb bf 5c 00 00 00 	movabs $0x5cbf,%r11
+  80337f:	00 00 00 
+  803382:	4c 01 d8             	add    %r11,%rax
+  803385:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803388:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80338b:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  80338f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803392:	48 89 ce             	mov    %rcx,%rsi
+  803395:	89 d7                	mov    %edx,%edi
+  803397:	48 ba 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rdx
+  80339e:	ff ff ff 
+  8033a1:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8033a5:	ff d0                	call   *%rax
+  8033a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033ae:	79 05                	jns    8033b5 <seek+0x4c>
+		return r;
+  8033b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033b3:	eb 0f                	jmp    8033c4 <seek+0x5b>
+	fd->fd_offset = offset;
+  8033b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033b9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8033bc:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8033bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033c4:	c9                   	leave
+  8033c5:	c3                   	ret
+
+00000000008033c6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8033c6:	55                   	push   %rbp
+  8033c7:	48 89 e5             	mov    %rsp,%rbp
+  8033ca:	41 57                	push   %r15
+  8033cc:	53                   	push   %rbx
+  8033cd:	48 83 ec 30          	sub    $0x30,%rsp
+  8033d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033d1 <ftruncate+0xb>
+  8033d8:	49 bb 5f 5c 00 00 00 	movabs $0x5c5f,%r11
+  8033df:	00 00 00 
+  8033e2:	4c 01 db             	add    %r11,%rbx
+  8033e5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8033e8:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8033eb:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8033ef:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8033f2:	48 89 d6             	mov    %rdx,%rsi
+  8033f5:	89 c7                	mov    %eax,%edi
+  8033f7:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  8033fe:	ff ff ff 
+  803401:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803405:	ff d0                	call   *%rax
+  803407:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80340a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80340e:	78 28                	js     803438 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803410:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803414:	8b 00                	mov    (%rax),%eax
+  803416:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80341a:	48 89 d6             	mov    %rdx,%rsi
+  80341d:	89 c7                	mov    %eax,%edi
+  80341f:	48 b8 e0 9c ff ff ff 	movabs $0xffffffffffff9ce0,%rax
+  803426:	ff ff ff 
+  803429:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80342d:	ff d0                	call   *%rax
+  80342f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803432:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803436:	79 08                	jns    803440 <ftruncate+0x7a>
+		return r;
+  803438:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80343b:	e9 83 00 00 00       	jmp    8034c3 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803440:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803444:	8b 40 08             	mov    0x8(%rax),%eax
+  803447:	83 e0 03             	and    $0x3,%eax
+  80344a:	85 c0                	test   %eax,%eax
+  80344c:	75 4b                	jne    803499 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  80344e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803455:	ff ff ff 
+  803458:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80345c:	48 8b 00             	mov    (%rax),%rax
+  80345f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803465:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803468:	89 c6                	mov    %eax,%esi
+  80346a:	48 b8 70 db ff ff ff 	movabs $0xffffffffffffdb70,%rax
+  803471:	ff ff ff 
+  803474:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803478:	48 89 c7             	mov    %rax,%rdi
+  80347b:	49 89 df             	mov    %rbx,%r15
+  80347e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803483:	48 b9 98 74 ff ff ff 	movabs $0xffffffffffff7498,%rcx
+  80348a:	ff ff ff 
+  80348d:	48 01 d9             	add    %rbx,%rcx
+  803490:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803492:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803497:	eb 2a                	jmp    8034c3 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803499:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80349d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8034a1:	48 85 c0             	test   %rax,%rax
+  8034a4:	75 07                	jne    8034ad <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8034a6:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034ab:	eb 16                	jmp    8034c3 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8034ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034b1:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8034b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034b9:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8034bc:	89 d6                	mov    %edx,%esi
+  8034be:	48 89 c7             	mov    %rax,%rdi
+  8034c1:	ff d1                	call   *%rcx
+}
+  8034c3:	48 83 c4 30          	add    $0x30,%rsp
+  8034c7:	5b                   	pop    %rbx
+  8034c8:	41 5f                	pop    %r15
+  8034ca:	5d                   	pop    %rbp
+  8034cb:	c3                   	ret
+
+00000000008034cc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8034cc:	55                   	push   %rbp
+  8034cd:	48 89 e5             	mov    %rsp,%rbp
+  8034d0:	53                   	push   %rbx
+  8034d1:	48 83 ec 38          	sub    $0x38,%rsp
+  8034d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034d5 <fstat+0x9>
+  8034dc:	49 bb 5b 5b 00 00 00 	movabs $0x5b5b,%r11
+  8034e3:	00 00 00 
+  8034e6:	4c 01 db             	add    %r11,%rbx
+  8034e9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8034ec:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8034f0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8034f4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8034f7:	48 89 d6             	mov    %rdx,%rsi
+  8034fa:	89 c7                	mov    %eax,%edi
+  8034fc:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  803503:	ff ff ff 
+  803506:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80350a:	ff d0                	call   *%rax
+  80350c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80350f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803513:	78 28                	js     80353d <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803515:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803519:	8b 00                	mov    (%rax),%eax
+  80351b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80351f:	48 89 d6             	mov    %rdx,%rsi
+  803522:	89 c7                	mov    %eax,%edi
+  803524:	48 b8 e0 9c ff ff ff 	movabs $0xffffffffffff9ce0,%rax
+  80352b:	ff ff ff 
+  80352e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803532:	ff d0                	call   *%rax
+  803534:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803537:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80353b:	79 05                	jns    803542 <fstat+0x76>
+		return r;
+  80353d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803540:	eb 5e                	jmp    8035a0 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803542:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803546:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80354a:	48 85 c0             	test   %rax,%rax
+  80354d:	75 07                	jne    803556 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80354f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803554:	eb 4a                	jmp    8035a0 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803556:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80355a:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80355d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803561:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803568:	00 00 00 
+	stat->st_isdir = 0;
+  80356b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80356f:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803576:	00 00 00 
+	stat->st_dev = dev;
+  803579:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80357d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803581:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  803588:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80358c:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803590:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803594:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803598:	48 89 d6             	mov    %rdx,%rsi
+  80359b:	48 89 c7             	mov    %rax,%rdi
+  80359e:	ff d1                	call   *%rcx
+}
+  8035a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035a4:	c9                   	leave
+  8035a5:	c3                   	ret
+
+00000000008035a6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8035a6:	55                   	push   %rbp
+  8035a7:	48 89 e5             	mov    %rsp,%rbp
+  8035aa:	41 57                	push   %r15
+  8035ac:	53                   	push   %rbx
+  8035ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8035b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035b1 <stat+0xb>
+  8035b8:	49 bb 7f 5a 00 00 00 	movabs $0x5a7f,%r11
+  8035bf:	00 00 00 
+  8035c2:	4c 01 db             	add    %r11,%rbx
+  8035c5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8035c9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8035cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8035d6:	48 89 c7             	mov    %rax,%rdi
+  8035d9:	49 89 df             	mov    %rbx,%r15
+  8035dc:	48 b8 50 a8 ff ff ff 	movabs $0xffffffffffffa850,%rax
+  8035e3:	ff ff ff 
+  8035e6:	48 01 d8             	add    %rbx,%rax
+  8035e9:	ff d0                	call   *%rax
+  8035eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8035ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035f2:	79 05                	jns    8035f9 <stat+0x53>
+		return fd;
+  8035f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035f7:	eb 37                	jmp    803630 <stat+0x8a>
+	r = fstat(fd, stat);
+  8035f9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8035fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803600:	48 89 d6             	mov    %rdx,%rsi
+  803603:	89 c7                	mov    %eax,%edi
+  803605:	48 b8 9c a4 ff ff ff 	movabs $0xffffffffffffa49c,%rax
+  80360c:	ff ff ff 
+  80360f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803613:	ff d0                	call   *%rax
+  803615:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803618:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80361b:	89 c7                	mov    %eax,%edi
+  80361d:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  803624:	ff ff ff 
+  803627:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80362b:	ff d0                	call   *%rax
+	return r;
+  80362d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803630:	48 83 c4 20          	add    $0x20,%rsp
+  803634:	5b                   	pop    %rbx
+  803635:	41 5f                	pop    %r15
+  803637:	5d                   	pop    %rbp
+  803638:	c3                   	ret
+
+0000000000803639 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803639:	55                   	push   %rbp
+  80363a:	48 89 e5             	mov    %rsp,%rbp
+  80363d:	41 57                	push   %r15
+  80363f:	53                   	push   %rbx
+  803640:	48 83 ec 10          	sub    $0x10,%rsp
+  803644:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803644 <fsipc+0xb>
+  80364b:	49 bb ec 59 00 00 00 	movabs $0x59ec,%r11
+  803652:	00 00 00 
+  803655:	4c 01 db             	add    %r11,%rbx
+  803658:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80365b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80365f:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803666:	00 00 00 
+  803669:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80366c:	85 c0                	test   %eax,%eax
+  80366e:	75 24                	jne    803694 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803670:	bf 01 00 00 00       	mov    $0x1,%edi
+  803675:	49 89 df             	mov    %rbx,%r15
+  803678:	48 b8 47 d5 ff ff ff 	movabs $0xffffffffffffd547,%rax
+  80367f:	ff ff ff 
+  803682:	48 01 d8             	add    %rbx,%rax
+  803685:	ff d0                	call   *%rax
+  803687:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  80368e:	00 00 00 
+  803691:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803694:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80369b:	00 00 00 
+  80369e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036a1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036a5:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8036a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8036ae:	49 89 d0             	mov    %rdx,%r8
+  8036b1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8036b6:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8036bd:	00 00 00 
+  8036c0:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8036c4:	89 c7                	mov    %eax,%edi
+  8036c6:	49 89 df             	mov    %rbx,%r15
+  8036c9:	48 b8 66 cf ff ff ff 	movabs $0xffffffffffffcf66,%rax
+  8036d0:	ff ff ff 
+  8036d3:	48 01 d8             	add    %rbx,%rax
+  8036d6:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8036d8:	48 83 c4 10          	add    $0x10,%rsp
+  8036dc:	5b                   	pop    %rbx
+  8036dd:	41 5f                	pop    %r15
+  8036df:	5d                   	pop    %rbp
+  8036e0:	c3                   	ret
+
+00000000008036e1 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8036e1:	55                   	push   %rbp
+  8036e2:	48 89 e5             	mov    %rsp,%rbp
+  8036e5:	41 57                	push   %r15
+  8036e7:	53                   	push   %rbx
+  8036e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8036ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036ec <fsipc_words+0xb>
+  8036f3:	49 bb 44 59 00 00 00 	movabs $0x5944,%r11
+  8036fa:	00 00 00 
+  8036fd:	4c 01 db             	add    %r11,%rbx
+  803700:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803703:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803707:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80370b:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803712:	00 00 00 
+  803715:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803718:	85 c0                	test   %eax,%eax
+  80371a:	75 24                	jne    803740 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80371c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803721:	49 89 df             	mov    %rbx,%r15
+  803724:	48 b8 47 d5 ff ff ff 	movabs $0xffffffffffffd547,%rax
+  80372b:	ff ff ff 
+  80372e:	48 01 d8             	add    %rbx,%rax
+  803731:	ff d0                	call   *%rax
+  803733:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  80373a:	00 00 00 
+  80373d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803740:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803747:	00 00 00 
+  80374a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80374d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803751:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803755:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803758:	89 c7                	mov    %eax,%edi
+  80375a:	49 89 df             	mov    %rbx,%r15
+  80375d:	48 b8 51 d0 ff ff ff 	movabs $0xffffffffffffd051,%rax
+  803764:	ff ff ff 
+  803767:	48 01 d8             	add    %rbx,%rax
+  80376a:	ff d0                	call   *%rax
+}
+  80376c:	48 83 c4 20          	add    $0x20,%rsp
+  803770:	5b                   	pop    %rbx
+  803771:	41 5f                	pop    %r15
+  803773:	5d                   	pop    %rbp
+  803774:	c3                   	ret
+
+0000000000803775 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803775:	55                   	push   %rbp
+  803776:	48 89 e5             	mov    %rsp,%rbp
+  803779:	41 57                	push   %r15
+  80377b:	53                   	push   %rbx
+  80377c:	48 83 ec 40          	sub    $0x40,%rsp
+  803780:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803780 <fsipc_pages+0xb>
+  803787:	49 bb b0 58 00 00 00 	movabs $0x58b0,%r11
+  80378e:	00 00 00 
+  803791:	4c 01 db             	add    %r11,%rbx
+  803794:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803797:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80379b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  80379f:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8037a2:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8037a9:	00 00 00 
+  8037ac:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8037af:	85 c0                	test   %eax,%eax
+  8037b1:	75 24                	jne    8037d7 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8037b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8037b8:	49 89 df             	mov    %rbx,%r15
+  8037bb:	48 b8 47 d5 ff ff ff 	movabs $0xffffffffffffd547,%rax
+  8037c2:	ff ff ff 
+  8037c5:	48 01 d8             	add    %rbx,%rax
+  8037c8:	ff d0                	call   *%rax
+  8037ca:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8037d1:	00 00 00 
+  8037d4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8037d7:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8037dc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8037e0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8037e3:	48 98                	cltq
+  8037e5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8037e9:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8037ed:	0f 95 c0             	setne  %al
+  8037f0:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  8037f3:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8037fa:	00 
+  8037fb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8037ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803803:	48 01 d0             	add    %rdx,%rax
+  803806:	48 83 e8 01          	sub    $0x1,%rax
+  80380a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80380e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803812:	ba 00 00 00 00       	mov    $0x0,%edx
+  803817:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80381b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80381f:	48 29 d0             	sub    %rdx,%rax
+  803822:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803826:	41 89 c2             	mov    %eax,%r10d
+  803829:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  803830:	00 00 00 
+  803833:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803836:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80383a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80383e:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  803841:	48 83 ec 08          	sub    $0x8,%rsp
+  803845:	6a 40                	push   $0x40
+  803847:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  80384c:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803853:	00 
+  803854:	6a 05                	push   $0x5
+  803856:	41 89 f9             	mov    %edi,%r9d
+  803859:	49 89 c8             	mov    %rcx,%r8
+  80385c:	44 89 d1             	mov    %r10d,%ecx
+  80385f:	89 c7                	mov    %eax,%edi
+  803861:	49 89 df             	mov    %rbx,%r15
+  803864:	48 b8 4f d1 ff ff ff 	movabs $0xffffffffffffd14f,%rax
+  80386b:	ff ff ff 
+  80386e:	48 01 d8             	add    %rbx,%rax
+  803871:	ff d0                	call   *%rax
+  803873:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  803877:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80387b:	5b                   	pop    %rbx
+  80387c:	41 5f                	pop    %r15
+  80387e:	5d                   	pop    %rbp
+  80387f:	c3                   	ret
+
+0000000000803880 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  803880:	55                   	push   %rbp
+  803881:	48 89 e5             	mov    %rsp,%rbp
+  803884:	41 57                	push   %r15
+  803886:	53                   	push   %rbx
+  803887:	48 83 ec 20          	sub    $0x20,%rsp
+  80388b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80388b <open+0xb>
+  803892:	49 bb a5 57 00 00 00 	movabs $0x57a5,%r11
+  803899:	00 00 00 
+  80389c:	4c 01 db             	add    %r11,%rbx
+  80389f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8038a3:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8038a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8038aa:	48 89 c7             	mov    %rax,%rdi
+  8038ad:	49 89 df             	mov    %rbx,%r15
+  8038b0:	48 b8 c6 81 ff ff ff 	movabs $0xffffffffffff81c6,%rax
+  8038b7:	ff ff ff 
+  8038ba:	48 01 d8             	add    %rbx,%rax
+  8038bd:	ff d0                	call   *%rax
+  8038bf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8038c4:	7e 0a                	jle    8038d0 <open+0x50>
+		return -E_BAD_PATH;
+  8038c6:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8038cb:	e9 18 01 00 00       	jmp    8039e8 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8038d0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8038d4:	48 89 c7             	mov    %rax,%rdi
+  8038d7:	49 89 df             	mov    %rbx,%r15
+  8038da:	48 b8 84 9a ff ff ff 	movabs $0xffffffffffff9a84,%rax
+  8038e1:	ff ff ff 
+  8038e4:	48 01 d8             	add    %rbx,%rax
+  8038e7:	ff d0                	call   *%rax
+  8038e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038f0:	74 08                	je     8038fa <open+0x7a>
+		return r;
+  8038f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038f5:	e9 ee 00 00 00       	jmp    8039e8 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8038fa:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803901:	00 00 00 
+  803904:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803907:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80390e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803912:	48 89 c6             	mov    %rax,%rsi
+  803915:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  80391c:	00 00 00 
+  80391f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803923:	48 89 c7             	mov    %rax,%rdi
+  803926:	49 89 df             	mov    %rbx,%r15
+  803929:	48 b8 5a 82 ff ff ff 	movabs $0xffffffffffff825a,%rax
+  803930:	ff ff ff 
+  803933:	48 01 d8             	add    %rbx,%rax
+  803936:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803938:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80393c:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  803941:	48 89 c6             	mov    %rax,%rsi
+  803944:	bf 00 00 00 00       	mov    $0x0,%edi
+  803949:	49 89 df             	mov    %rbx,%r15
+  80394c:	48 b8 16 8f ff ff ff 	movabs $0xffffffffffff8f16,%rax
+  803953:	ff ff ff 
+  803956:	48 01 d8             	add    %rbx,%rax
+  803959:	ff d0                	call   *%rax
+  80395b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80395e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803962:	74 23                	je     803987 <open+0x107>
+		fd_close(fd,0);
+  803964:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803968:	be 00 00 00 00       	mov    $0x0,%esi
+  80396d:	48 89 c7             	mov    %rax,%rdi
+  803970:	49 89 df             	mov    %rbx,%r15
+  803973:	48 b8 e5 9b ff ff ff 	movabs $0xffffffffffff9be5,%rax
+  80397a:	ff ff ff 
+  80397d:	48 01 d8             	add    %rbx,%rax
+  803980:	ff d0                	call   *%rax
+		return r;
+  803982:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803985:	eb 61                	jmp    8039e8 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  803987:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80398b:	48 89 c6             	mov    %rax,%rsi
+  80398e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803993:	48 b8 09 a6 ff ff ff 	movabs $0xffffffffffffa609,%rax
+  80399a:	ff ff ff 
+  80399d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039a1:	ff d0                	call   *%rax
+  8039a3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039aa:	74 23                	je     8039cf <open+0x14f>
+		fd_close(fd,0);
+  8039ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8039b5:	48 89 c7             	mov    %rax,%rdi
+  8039b8:	49 89 df             	mov    %rbx,%r15
+  8039bb:	48 b8 e5 9b ff ff ff 	movabs $0xffffffffffff9be5,%rax
+  8039c2:	ff ff ff 
+  8039c5:	48 01 d8             	add    %rbx,%rax
+  8039c8:	ff d0                	call   *%rax
+		return r;
+  8039ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039cd:	eb 19                	jmp    8039e8 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8039cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039d3:	48 89 c7             	mov    %rax,%rdi
+  8039d6:	49 89 df             	mov    %rbx,%r15
+  8039d9:	48 b8 0a 9a ff ff ff 	movabs $0xffffffffffff9a0a,%rax
+  8039e0:	ff ff ff 
+  8039e3:	48 01 d8             	add    %rbx,%rax
+  8039e6:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8039e8:	48 83 c4 20          	add    $0x20,%rsp
+  8039ec:	5b                   	pop    %rbx
+  8039ed:	41 5f                	pop    %r15
+  8039ef:	5d                   	pop    %rbp
+  8039f0:	c3                   	ret
+
+00000000008039f1 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8039f1:	55                   	push   %rbp
+  8039f2:	48 89 e5             	mov    %rsp,%rbp
+  8039f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8039f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8039f9 <devfile_flush+0x8>
+  803a00:	49 bb 37 56 00 00 00 	movabs $0x5637,%r11
+  803a07:	00 00 00 
+  803a0a:	4c 01 d8             	add    %r11,%rax
+  803a0d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803a11:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a15:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803a18:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803a1b:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803a1f:	ba 04 00 00 00       	mov    $0x4,%edx
+  803a24:	48 89 ce             	mov    %rcx,%rsi
+  803a27:	bf 06 00 00 00       	mov    $0x6,%edi
+  803a2c:	48 b9 b1 a6 ff ff ff 	movabs $0xffffffffffffa6b1,%rcx
+  803a33:	ff ff ff 
+  803a36:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803a3a:	ff d0                	call   *%rax
+}
+  803a3c:	c9                   	leave
+  803a3d:	c3                   	ret
+
+0000000000803a3e <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  803a3e:	55                   	push   %rbp
+  803a3f:	48 89 e5             	mov    %rsp,%rbp
+  803a42:	41 57                	push   %r15
+  803a44:	53                   	push   %rbx
+  803a45:	48 83 ec 60          	sub    $0x60,%rsp
+  803a49:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a49 <devfile_read+0xb>
+  803a50:	49 bb e7 55 00 00 00 	movabs $0x55e7,%r11
+  803a57:	00 00 00 
+  803a5a:	4c 01 db             	add    %r11,%rbx
+  803a5d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803a61:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803a65:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  803a69:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803a6d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803a71:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803a75:	8b 50 0c             	mov    0xc(%rax),%edx
+  803a78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a7c:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803a7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a82:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  803a86:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  803a8a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803a8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a93:	ba 10 00 00 00       	mov    $0x10,%edx
+  803a98:	48 89 c6             	mov    %rax,%rsi
+  803a9b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803aa0:	48 b8 45 a7 ff ff ff 	movabs $0xffffffffffffa745,%rax
+  803aa7:	ff ff ff 
+  803aaa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803aae:	ff d0                	call   *%rax
+  803ab0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803ab3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803ab7:	79 05                	jns    803abe <devfile_read+0x80>
+		return r;
+  803ab9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803abc:	eb 64                	jmp    803b22 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803abe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ac1:	48 63 d0             	movslq %eax,%rdx
+  803ac4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803ac8:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803acd:	48 01 c1             	add    %rax,%rcx
+  803ad0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803ad4:	48 89 ce             	mov    %rcx,%rsi
+  803ad7:	48 89 c7             	mov    %rax,%rdi
+  803ada:	49 89 df             	mov    %rbx,%r15
+  803add:	48 b8 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rax
+  803ae4:	ff ff ff 
+  803ae7:	48 01 d8             	add    %rbx,%rax
+  803aea:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803aec:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803af3:	ff ff ff 
+  803af6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803afa:	48 8b 00             	mov    (%rax),%rax
+  803afd:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803b03:	89 c6                	mov    %eax,%esi
+  803b05:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803b0a:	48 89 c7             	mov    %rax,%rdi
+  803b0d:	49 89 df             	mov    %rbx,%r15
+  803b10:	48 b8 01 d5 ff ff ff 	movabs $0xffffffffffffd501,%rax
+  803b17:	ff ff ff 
+  803b1a:	48 01 d8             	add    %rbx,%rax
+  803b1d:	ff d0                	call   *%rax
+	return r;
+  803b1f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803b22:	48 83 c4 60          	add    $0x60,%rsp
+  803b26:	5b                   	pop    %rbx
+  803b27:	41 5f                	pop    %r15
+  803b29:	5d                   	pop    %rbp
+  803b2a:	c3                   	ret
+
+0000000000803b2b <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803b2b:	55                   	push   %rbp
+  803b2c:	48 89 e5             	mov    %rsp,%rbp
+  803b2f:	41 57                	push   %r15
+  803b31:	53                   	push   %rbx
+  803b32:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803b36:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b36 <devfile_write+0xb>
+  803b3d:	49 bb fa 54 00 00 00 	movabs $0x54fa,%r11
+  803b44:	00 00 00 
+  803b47:	4c 01 db             	add    %r11,%rbx
+  803b4a:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803b4e:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803b52:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803b59:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803b5d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803b61:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803b68:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803b6c:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803b73:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b76:	48 63 d0             	movslq %eax,%rdx
+  803b79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b7d:	48 39 c2             	cmp    %rax,%rdx
+  803b80:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803b84:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803b8b:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803b92:	00 
+  803b93:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b9e:	48 01 d0             	add    %rdx,%rax
+  803ba1:	48 83 e8 01          	sub    $0x1,%rax
+  803ba5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803ba9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bad:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bb2:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803bb6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bba:	48 29 d0             	sub    %rdx,%rax
+  803bbd:	48 c1 e8 0c          	shr    $0xc,%rax
+  803bc1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803bc4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803bc7:	89 c6                	mov    %eax,%esi
+  803bc9:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803bce:	48 89 c7             	mov    %rax,%rdi
+  803bd1:	49 89 df             	mov    %rbx,%r15
+  803bd4:	48 b8 bb d4 ff ff ff 	movabs $0xffffffffffffd4bb,%rax
+  803bdb:	ff ff ff 
+  803bde:	48 01 d8             	add    %rbx,%rax
+  803be1:	ff d0                	call   *%rax
+  803be3:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803be6:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803bea:	79 08                	jns    803bf4 <devfile_write+0xc9>
+		return r;
+  803bec:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803bef:	e9 8f 00 00 00       	jmp    803c83 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803bf4:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803bfb:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803bff:	48 89 c6             	mov    %rax,%rsi
+  803c02:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803c07:	48 89 c7             	mov    %rax,%rdi
+  803c0a:	49 89 df             	mov    %rbx,%r15
+  803c0d:	48 b8 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rax
+  803c14:	ff ff ff 
+  803c17:	48 01 d8             	add    %rbx,%rax
+  803c1a:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803c1c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803c20:	8b 50 0c             	mov    0xc(%rax),%edx
+  803c23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c27:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803c29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c2d:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803c34:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803c38:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803c3b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803c3f:	89 d1                	mov    %edx,%ecx
+  803c41:	ba 10 00 00 00       	mov    $0x10,%edx
+  803c46:	48 89 c6             	mov    %rax,%rsi
+  803c49:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c4e:	48 b8 45 a7 ff ff ff 	movabs $0xffffffffffffa745,%rax
+  803c55:	ff ff ff 
+  803c58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c5c:	ff d0                	call   *%rax
+  803c5e:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803c61:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803c64:	89 c6                	mov    %eax,%esi
+  803c66:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803c6b:	48 89 c7             	mov    %rax,%rdi
+  803c6e:	49 89 df             	mov    %rbx,%r15
+  803c71:	48 b8 01 d5 ff ff ff 	movabs $0xffffffffffffd501,%rax
+  803c78:	ff ff ff 
+  803c7b:	48 01 d8             	add    %rbx,%rax
+  803c7e:	ff d0                	call   *%rax
+	return r;
+  803c80:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803c83:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803c87:	5b                   	pop    %rbx
+  803c88:	41 5f                	pop    %r15
+  803c8a:	5d                   	pop    %rbp
+  803c8b:	c3                   	ret
+
+0000000000803c8c <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803c8c:	55                   	push   %rbp
+  803c8d:	48 89 e5             	mov    %rsp,%rbp
+  803c90:	41 57                	push   %r15
+  803c92:	53                   	push   %rbx
+  803c93:	48 83 ec 20          	sub    $0x20,%rsp
+  803c97:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c97 <devfile_stat+0xb>
+  803c9e:	49 bb 99 53 00 00 00 	movabs $0x5399,%r11
+  803ca5:	00 00 00 
+  803ca8:	4c 01 db             	add    %r11,%rbx
+  803cab:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803caf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803cb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cb7:	8b 40 0c             	mov    0xc(%rax),%eax
+  803cba:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803cc1:	00 00 00 
+  803cc4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803cc7:	be 00 00 00 00       	mov    $0x0,%esi
+  803ccc:	bf 05 00 00 00       	mov    $0x5,%edi
+  803cd1:	48 b8 09 a6 ff ff ff 	movabs $0xffffffffffffa609,%rax
+  803cd8:	ff ff ff 
+  803cdb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cdf:	ff d0                	call   *%rax
+  803ce1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ce4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ce8:	79 05                	jns    803cef <devfile_stat+0x63>
+		return r;
+  803cea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ced:	eb 65                	jmp    803d54 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803cef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cf3:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803cfa:	00 00 00 
+  803cfd:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803d01:	48 89 d6             	mov    %rdx,%rsi
+  803d04:	48 89 c7             	mov    %rax,%rdi
+  803d07:	49 89 df             	mov    %rbx,%r15
+  803d0a:	48 b8 5a 82 ff ff ff 	movabs $0xffffffffffff825a,%rax
+  803d11:	ff ff ff 
+  803d14:	48 01 d8             	add    %rbx,%rax
+  803d17:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803d19:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803d20:	00 00 00 
+  803d23:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803d2a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d2e:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803d34:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803d3b:	00 00 00 
+  803d3e:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803d45:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d49:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d54:	48 83 c4 20          	add    $0x20,%rsp
+  803d58:	5b                   	pop    %rbx
+  803d59:	41 5f                	pop    %r15
+  803d5b:	5d                   	pop    %rbp
+  803d5c:	c3                   	ret
+
+0000000000803d5d <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803d5d:	55                   	push   %rbp
+  803d5e:	48 89 e5             	mov    %rsp,%rbp
+  803d61:	48 83 ec 20          	sub    $0x20,%rsp
+  803d65:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d65 <devfile_trunc+0x8>
+  803d6c:	49 bb cb 52 00 00 00 	movabs $0x52cb,%r11
+  803d73:	00 00 00 
+  803d76:	4c 01 d8             	add    %r11,%rax
+  803d79:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d7d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803d80:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803d84:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803d87:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803d8a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803d8d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803d90:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803d94:	ba 08 00 00 00       	mov    $0x8,%edx
+  803d99:	48 89 ce             	mov    %rcx,%rsi
+  803d9c:	bf 02 00 00 00       	mov    $0x2,%edi
+  803da1:	48 b9 b1 a6 ff ff ff 	movabs $0xffffffffffffa6b1,%rcx
+  803da8:	ff ff ff 
+  803dab:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803daf:	ff d0                	call   *%rax
+}
+  803db1:	c9                   	leave
+  803db2:	c3                   	ret
+
+0000000000803db3 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803db3:	55                   	push   %rbp
+  803db4:	48 89 e5             	mov    %rsp,%rbp
+  803db7:	41 57                	push   %r15
+  803db9:	53                   	push   %rbx
+  803dba:	48 83 ec 10          	sub    $0x10,%rsp
+  803dbe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803dbe <remove+0xb>
+  803dc5:	49 bb 72 52 00 00 00 	movabs $0x5272,%r11
+  803dcc:	00 00 00 
+  803dcf:	4c 01 db             	add    %r11,%rbx
+  803dd2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803dd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dda:	48 89 c7             	mov    %rax,%rdi
+  803ddd:	49 89 df             	mov    %rbx,%r15
+  803de0:	48 b8 c6 81 ff ff ff 	movabs $0xffffffffffff81c6,%rax
+  803de7:	ff ff ff 
+  803dea:	48 01 d8             	add    %rbx,%rax
+  803ded:	ff d0                	call   *%rax
+  803def:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803df4:	7e 07                	jle    803dfd <remove+0x4a>
+		return -E_BAD_PATH;
+  803df6:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803dfb:	eb 44                	jmp    803e41 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803dfd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e01:	48 89 c6             	mov    %rax,%rsi
+  803e04:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803e0b:	00 00 00 
+  803e0e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e12:	48 89 c7             	mov    %rax,%rdi
+  803e15:	49 89 df             	mov    %rbx,%r15
+  803e18:	48 b8 5a 82 ff ff ff 	movabs $0xffffffffffff825a,%rax
+  803e1f:	ff ff ff 
+  803e22:	48 01 d8             	add    %rbx,%rax
+  803e25:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803e27:	be 00 00 00 00       	mov    $0x0,%esi
+  803e2c:	bf 07 00 00 00       	mov    $0x7,%edi
+  803e31:	48 b8 09 a6 ff ff ff 	movabs $0xffffffffffffa609,%rax
+  803e38:	ff ff ff 
+  803e3b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e3f:	ff d0                	call   *%rax
+}
+  803e41:	48 83 c4 10          	add    $0x10,%rsp
+  803e45:	5b                   	pop    %rbx
+  803e46:	41 5f                	pop    %r15
+  803e48:	5d                   	pop    %rbp
+  803e49:	c3                   	ret
+
+0000000000803e4a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803e4a:	55                   	push   %rbp
+  803e4b:	48 89 e5             	mov    %rsp,%rbp
+  803e4e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e4e <sync+0x4>
+  803e55:	49 bb e2 51 00 00 00 	movabs $0x51e2,%r11
+  803e5c:	00 00 00 
+  803e5f:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803e62:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e67:	be 00 00 00 00       	mov    $0x0,%esi
+  803e6c:	bf 08 00 00 00       	mov    $0x8,%edi
+  803e71:	48 b9 b1 a6 ff ff ff 	movabs $0xffffffffffffa6b1,%rcx
+  803e78:	ff ff ff 
+  803e7b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803e7f:	ff d0                	call   *%rax
+}
+  803e81:	5d                   	pop    %rbp
+  803e82:	c3                   	ret
+
+0000000000803e83 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803e83:	55                   	push   %rbp
+  803e84:	48 89 e5             	mov    %rsp,%rbp
+  803e87:	41 57                	push   %r15
+  803e89:	53                   	push   %rbx
+  803e8a:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803e91:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e91 <copy+0xe>
+  803e98:	49 bb 9f 51 00 00 00 	movabs $0x519f,%r11
+  803e9f:	00 00 00 
+  803ea2:	4c 01 db             	add    %r11,%rbx
+  803ea5:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803eac:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803eb3:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803eba:	be 00 00 00 00       	mov    $0x0,%esi
+  803ebf:	48 89 c7             	mov    %rax,%rdi
+  803ec2:	48 b8 50 a8 ff ff ff 	movabs $0xffffffffffffa850,%rax
+  803ec9:	ff ff ff 
+  803ecc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ed0:	ff d0                	call   *%rax
+  803ed2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803ed5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ed9:	79 35                	jns    803f10 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803edb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ede:	89 c6                	mov    %eax,%esi
+  803ee0:	48 b8 96 db ff ff ff 	movabs $0xffffffffffffdb96,%rax
+  803ee7:	ff ff ff 
+  803eea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eee:	48 89 c7             	mov    %rax,%rdi
+  803ef1:	49 89 df             	mov    %rbx,%r15
+  803ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef9:	48 ba 98 74 ff ff ff 	movabs $0xffffffffffff7498,%rdx
+  803f00:	ff ff ff 
+  803f03:	48 01 da             	add    %rbx,%rdx
+  803f06:	ff d2                	call   *%rdx
+		return fd_src;
+  803f08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f0b:	e9 d7 01 00 00       	jmp    8040e7 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803f10:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803f17:	be 01 01 00 00       	mov    $0x101,%esi
+  803f1c:	48 89 c7             	mov    %rax,%rdi
+  803f1f:	48 b8 50 a8 ff ff ff 	movabs $0xffffffffffffa850,%rax
+  803f26:	ff ff ff 
+  803f29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f2d:	ff d0                	call   *%rax
+  803f2f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803f32:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803f36:	0f 89 df 00 00 00    	jns    80401b <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803f3c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f3f:	89 c6                	mov    %eax,%esi
+  803f41:	48 b8 ac db ff ff ff 	movabs $0xffffffffffffdbac,%rax
+  803f48:	ff ff ff 
+  803f4b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f4f:	48 89 c7             	mov    %rax,%rdi
+  803f52:	49 89 df             	mov    %rbx,%r15
+  803f55:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f5a:	48 ba 98 74 ff ff ff 	movabs $0xffffffffffff7498,%rdx
+  803f61:	ff ff ff 
+  803f64:	48 01 da             	add    %rbx,%rdx
+  803f67:	ff d2                	call   *%rdx
+		close(fd_src);
+  803f69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f6c:	89 c7                	mov    %eax,%edi
+  803f6e:	49 89 df             	mov    %rbx,%r15
+  803f71:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  803f78:	ff ff ff 
+  803f7b:	48 01 d8             	add    %rbx,%rax
+  803f7e:	ff d0                	call   *%rax
+		return fd_dest;
+  803f80:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f83:	e9 5f 01 00 00       	jmp    8040e7 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803f88:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f8b:	48 63 d0             	movslq %eax,%rdx
+  803f8e:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803f95:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f98:	48 89 ce             	mov    %rcx,%rsi
+  803f9b:	89 c7                	mov    %eax,%edi
+  803f9d:	49 89 df             	mov    %rbx,%r15
+  803fa0:	48 b8 27 a2 ff ff ff 	movabs $0xffffffffffffa227,%rax
+  803fa7:	ff ff ff 
+  803faa:	48 01 d8             	add    %rbx,%rax
+  803fad:	ff d0                	call   *%rax
+  803faf:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803fb2:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803fb6:	79 63                	jns    80401b <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803fb8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803fbb:	89 c6                	mov    %eax,%esi
+  803fbd:	48 b8 c6 db ff ff ff 	movabs $0xffffffffffffdbc6,%rax
+  803fc4:	ff ff ff 
+  803fc7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fcb:	48 89 c7             	mov    %rax,%rdi
+  803fce:	49 89 df             	mov    %rbx,%r15
+  803fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd6:	48 ba 98 74 ff ff ff 	movabs $0xffffffffffff7498,%rdx
+  803fdd:	ff ff ff 
+  803fe0:	48 01 da             	add    %rbx,%rdx
+  803fe3:	ff d2                	call   *%rdx
+			close(fd_src);
+  803fe5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fe8:	89 c7                	mov    %eax,%edi
+  803fea:	49 89 df             	mov    %rbx,%r15
+  803fed:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  803ff4:	ff ff ff 
+  803ff7:	48 01 d8             	add    %rbx,%rax
+  803ffa:	ff d0                	call   *%rax
+			close(fd_dest);
+  803ffc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803fff:	89 c7                	mov    %eax,%edi
+  804001:	49 89 df             	mov    %rbx,%r15
+  804004:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  80400b:	ff ff ff 
+  80400e:	48 01 d8             	add    %rbx,%rax
+  804011:	ff d0                	call   *%rax
+			return write_size;
+  804013:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804016:	e9 cc 00 00 00       	jmp    8040e7 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  80401b:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804022:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804025:	ba 00 02 00 00       	mov    $0x200,%edx
+  80402a:	48 89 ce             	mov    %rcx,%rsi
+  80402d:	89 c7                	mov    %eax,%edi
+  80402f:	49 89 df             	mov    %rbx,%r15
+  804032:	48 b8 81 a0 ff ff ff 	movabs $0xffffffffffffa081,%rax
+  804039:	ff ff ff 
+  80403c:	48 01 d8             	add    %rbx,%rax
+  80403f:	ff d0                	call   *%rax
+  804041:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804044:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804048:	0f 8f 3a ff ff ff    	jg     803f88 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  80404e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804052:	79 60                	jns    8040b4 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804054:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804057:	89 c6                	mov    %eax,%esi
+  804059:	48 b8 d9 db ff ff ff 	movabs $0xffffffffffffdbd9,%rax
+  804060:	ff ff ff 
+  804063:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804067:	48 89 c7             	mov    %rax,%rdi
+  80406a:	49 89 df             	mov    %rbx,%r15
+  80406d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804072:	48 ba 98 74 ff ff ff 	movabs $0xffffffffffff7498,%rdx
+  804079:	ff ff ff 
+  80407c:	48 01 da             	add    %rbx,%rdx
+  80407f:	ff d2                	call   *%rdx
+		close(fd_src);
+  804081:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804084:	89 c7                	mov    %eax,%edi
+  804086:	49 89 df             	mov    %rbx,%r15
+  804089:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  804090:	ff ff ff 
+  804093:	48 01 d8             	add    %rbx,%rax
+  804096:	ff d0                	call   *%rax
+		close(fd_dest);
+  804098:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80409b:	89 c7                	mov    %eax,%edi
+  80409d:	49 89 df             	mov    %rbx,%r15
+  8040a0:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  8040a7:	ff ff ff 
+  8040aa:	48 01 d8             	add    %rbx,%rax
+  8040ad:	ff d0                	call   *%rax
+		return read_size;
+  8040af:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8040b2:	eb 33                	jmp    8040e7 <copy+0x264>
+	}
+	close(fd_src);
+  8040b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040b7:	89 c7                	mov    %eax,%edi
+  8040b9:	49 89 df             	mov    %rbx,%r15
+  8040bc:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  8040c3:	ff ff ff 
+  8040c6:	48 01 d8             	add    %rbx,%rax
+  8040c9:	ff d0                	call   *%rax
+	close(fd_dest);
+  8040cb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8040ce:	89 c7                	mov    %eax,%edi
+  8040d0:	49 89 df             	mov    %rbx,%r15
+  8040d3:	48 b8 c9 9d ff ff ff 	movabs $0xffffffffffff9dc9,%rax
+  8040da:	ff ff ff 
+  8040dd:	48 01 d8             	add    %rbx,%rax
+  8040e0:	ff d0                	call   *%rax
+	return 0;
+  8040e2:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8040e7:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8040ee:	5b                   	pop    %rbx
+  8040ef:	41 5f                	pop    %r15
+  8040f1:	5d                   	pop    %rbp
+  8040f2:	c3                   	ret
+
+00000000008040f3 <writebuf>:
+};
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  8040f3:	55                   	push   %rbp
+  8040f4:	48 89 e5             	mov    %rsp,%rbp
+  8040f7:	41 57                	push   %r15
+  8040f9:	48 83 ec 28          	sub    $0x28,%rsp
+  8040fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8040fd <writebuf+0xa>
+  804104:	49 bb 33 4f 00 00 00 	movabs $0x4f33,%r11
+  80410b:	00 00 00 
+  80410e:	4c 01 d8             	add    %r11,%rax
+  804111:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	if (b->error > 0) {
+  804115:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804119:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80411c:	85 d2                	test   %edx,%edx
+  80411e:	7e 68                	jle    804188 <writebuf+0x95>
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  804120:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804124:	8b 52 04             	mov    0x4(%rdx),%edx
+  804127:	48 63 d2             	movslq %edx,%rdx
+  80412a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80412e:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  804132:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804136:	8b 09                	mov    (%rcx),%ecx
+  804138:	89 cf                	mov    %ecx,%edi
+  80413a:	49 89 c7             	mov    %rax,%r15
+  80413d:	48 b9 27 a2 ff ff ff 	movabs $0xffffffffffffa227,%rcx
+  804144:	ff ff ff 
+  804147:	48 01 c1             	add    %rax,%rcx
+  80414a:	ff d1                	call   *%rcx
+  80414c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		if (result > 0)
+  80414f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804153:	7e 13                	jle    804168 <writebuf+0x75>
+			b->result += result;
+  804155:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804159:	8b 50 08             	mov    0x8(%rax),%edx
+  80415c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80415f:	01 c2                	add    %eax,%edx
+  804161:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804165:	89 50 08             	mov    %edx,0x8(%rax)
+		if (result != b->idx) // error, or wrote less than supplied
+  804168:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80416c:	8b 40 04             	mov    0x4(%rax),%eax
+  80416f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804172:	74 14                	je     804188 <writebuf+0x95>
+			b->error = (result < 0 ? result : 0);
+  804174:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804177:	ba 00 00 00 00       	mov    $0x0,%edx
+  80417c:	85 c0                	test   %eax,%eax
+  80417e:	0f 4e d0             	cmovle %eax,%edx
+  804181:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804185:	89 50 0c             	mov    %edx,0xc(%rax)
+	}
+}
+  804188:	90                   	nop
+  804189:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80418d:	c9                   	leave
+  80418e:	c3                   	ret
+
+000000000080418f <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80418f:	55                   	push   %rbp
+  804190:	48 89 e5             	mov    %rsp,%rbp
+  804193:	48 83 ec 20          	sub    $0x20,%rsp
+  804197:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804197 <putch+0x8>
+  80419e:	49 bb 99 4e 00 00 00 	movabs $0x4e99,%r11
+  8041a5:	00 00 00 
+  8041a8:	4c 01 d8             	add    %r11,%rax
+  8041ab:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8041ae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct printbuf *b = (struct printbuf *) thunk;
+  8041b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041b6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	b->buf[b->idx++] = ch;
+  8041ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041be:	8b 52 04             	mov    0x4(%rdx),%edx
+  8041c1:	8d 72 01             	lea    0x1(%rdx),%esi
+  8041c4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8041c8:	89 71 04             	mov    %esi,0x4(%rcx)
+  8041cb:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8041ce:	89 ce                	mov    %ecx,%esi
+  8041d0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8041d4:	48 63 d2             	movslq %edx,%rdx
+  8041d7:	40 88 74 11 10       	mov    %sil,0x10(%rcx,%rdx,1)
+	if (b->idx == 256) {
+  8041dc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041e0:	8b 52 04             	mov    0x4(%rdx),%edx
+  8041e3:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8041e9:	75 22                	jne    80420d <putch+0x7e>
+		writebuf(b);
+  8041eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041ef:	48 89 d7             	mov    %rdx,%rdi
+  8041f2:	48 ba c3 b0 ff ff ff 	movabs $0xffffffffffffb0c3,%rdx
+  8041f9:	ff ff ff 
+  8041fc:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804200:	ff d0                	call   *%rax
+		b->idx = 0;
+  804202:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804206:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+	}
+}
+  80420d:	90                   	nop
+  80420e:	c9                   	leave
+  80420f:	c3                   	ret
+
+0000000000804210 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  804210:	55                   	push   %rbp
+  804211:	48 89 e5             	mov    %rsp,%rbp
+  804214:	41 57                	push   %r15
+  804216:	53                   	push   %rbx
+  804217:	48 81 ec 30 01 00 00 	sub    $0x130,%rsp
+  80421e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80421e <vfprintf+0xe>
+  804225:	49 bb 12 4e 00 00 00 	movabs $0x4e12,%r11
+  80422c:	00 00 00 
+  80422f:	4c 01 db             	add    %r11,%rbx
+  804232:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  804238:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  80423f:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+	struct printbuf b;
+
+	b.fd = fd;
+  804246:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  80424c:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+	b.idx = 0;
+  804252:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  804259:	00 00 00 
+	b.result = 0;
+  80425c:	c7 85 e8 fe ff ff 00 	movl   $0x0,-0x118(%rbp)
+  804263:	00 00 00 
+	b.error = 1;
+  804266:	c7 85 ec fe ff ff 01 	movl   $0x1,-0x114(%rbp)
+  80426d:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  804270:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  804277:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  80427e:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804285:	48 89 c6             	mov    %rax,%rsi
+  804288:	48 b8 5f b1 ff ff ff 	movabs $0xffffffffffffb15f,%rax
+  80428f:	ff ff ff 
+  804292:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804296:	48 89 c7             	mov    %rax,%rdi
+  804299:	49 89 df             	mov    %rbx,%r15
+  80429c:	48 b8 dc 78 ff ff ff 	movabs $0xffffffffffff78dc,%rax
+  8042a3:	ff ff ff 
+  8042a6:	48 01 d8             	add    %rbx,%rax
+  8042a9:	ff d0                	call   *%rax
+	if (b.idx > 0)
+  8042ab:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  8042b1:	85 c0                	test   %eax,%eax
+  8042b3:	7e 1a                	jle    8042cf <vfprintf+0xbf>
+		writebuf(&b);
+  8042b5:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8042bc:	48 89 c7             	mov    %rax,%rdi
+  8042bf:	48 b8 c3 b0 ff ff ff 	movabs $0xffffffffffffb0c3,%rax
+  8042c6:	ff ff ff 
+  8042c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042cd:	ff d0                	call   *%rax
+
+	return (b.result ? b.result : b.error);
+  8042cf:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  8042d5:	85 c0                	test   %eax,%eax
+  8042d7:	74 08                	je     8042e1 <vfprintf+0xd1>
+  8042d9:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  8042df:	eb 06                	jmp    8042e7 <vfprintf+0xd7>
+  8042e1:	8b 85 ec fe ff ff    	mov    -0x114(%rbp),%eax
+}
+  8042e7:	48 81 c4 30 01 00 00 	add    $0x130,%rsp
+  8042ee:	5b                   	pop    %rbx
+  8042ef:	41 5f                	pop    %r15
+  8042f1:	5d                   	pop    %rbp
+  8042f2:	c3                   	ret
+
+00000000008042f3 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8042f3:	55                   	push   %rbp
+  8042f4:	48 89 e5             	mov    %rsp,%rbp
+  8042f7:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8042fe:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8042fe <fprintf+0xb>
+  804305:	49 bb 32 4d 00 00 00 	movabs $0x4d32,%r11
+  80430c:	00 00 00 
+  80430f:	4d 01 da             	add    %r11,%r10
+  804312:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  804318:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80431f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804326:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80432d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804334:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80433b:	84 c0                	test   %al,%al
+  80433d:	74 20                	je     80435f <fprintf+0x6c>
+  80433f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804343:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804347:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80434b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80434f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804353:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804357:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80435b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80435f:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  804366:	00 00 00 
+  804369:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804370:	00 00 00 
+  804373:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804377:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80437e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804385:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(fd, fmt, ap);
+  80438c:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804393:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  80439a:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  8043a0:	48 89 ce             	mov    %rcx,%rsi
+  8043a3:	89 c7                	mov    %eax,%edi
+  8043a5:	48 b8 e0 b1 ff ff ff 	movabs $0xffffffffffffb1e0,%rax
+  8043ac:	ff ff ff 
+  8043af:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8043b3:	ff d0                	call   *%rax
+  8043b5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  8043bb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8043c1:	c9                   	leave
+  8043c2:	c3                   	ret
+
+00000000008043c3 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8043c3:	55                   	push   %rbp
+  8043c4:	48 89 e5             	mov    %rsp,%rbp
+  8043c7:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8043ce:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8043ce <printf+0xb>
+  8043d5:	49 bb 62 4c 00 00 00 	movabs $0x4c62,%r11
+  8043dc:	00 00 00 
+  8043df:	4d 01 da             	add    %r11,%r10
+  8043e2:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8043e9:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8043f0:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8043f7:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8043fe:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804405:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80440c:	84 c0                	test   %al,%al
+  80440e:	74 20                	je     804430 <printf+0x6d>
+  804410:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804414:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804418:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80441c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804420:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804424:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804428:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80442c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  804430:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  804437:	00 00 00 
+  80443a:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804441:	00 00 00 
+  804444:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804448:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80444f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  804456:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(1, fmt, ap);
+  80445d:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804464:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80446b:	48 89 c6             	mov    %rax,%rsi
+  80446e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804473:	48 b8 e0 b1 ff ff ff 	movabs $0xffffffffffffb1e0,%rax
+  80447a:	ff ff ff 
+  80447d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804481:	ff d0                	call   *%rax
+  804483:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  804489:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80448f:	c9                   	leave
+  804490:	c3                   	ret
+
+0000000000804491 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804491:	55                   	push   %rbp
+  804492:	48 89 e5             	mov    %rsp,%rbp
+  804495:	41 57                	push   %r15
+  804497:	53                   	push   %rbx
+  804498:	48 83 ec 20          	sub    $0x20,%rsp
+  80449c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80449c <fd2sockid+0xb>
+  8044a3:	49 bb 94 4b 00 00 00 	movabs $0x4b94,%r11
+  8044aa:	00 00 00 
+  8044ad:	4c 01 db             	add    %r11,%rbx
+  8044b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8044b3:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8044b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044ba:	48 89 d6             	mov    %rdx,%rsi
+  8044bd:	89 c7                	mov    %eax,%edi
+  8044bf:	49 89 df             	mov    %rbx,%r15
+  8044c2:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  8044c9:	ff ff ff 
+  8044cc:	48 01 d8             	add    %rbx,%rax
+  8044cf:	ff d0                	call   *%rax
+  8044d1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044d8:	79 05                	jns    8044df <fd2sockid+0x4e>
+		return r;
+  8044da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044dd:	eb 25                	jmp    804504 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8044df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044e3:	8b 10                	mov    (%rax),%edx
+  8044e5:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  8044ec:	00 00 00 
+  8044ef:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8044f2:	39 c2                	cmp    %eax,%edx
+  8044f4:	74 07                	je     8044fd <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8044f6:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8044fb:	eb 07                	jmp    804504 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8044fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804501:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804504:	48 83 c4 20          	add    $0x20,%rsp
+  804508:	5b                   	pop    %rbx
+  804509:	41 5f                	pop    %r15
+  80450b:	5d                   	pop    %rbp
+  80450c:	c3                   	ret
+
+000000000080450d <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  80450d:	55                   	push   %rbp
+  80450e:	48 89 e5             	mov    %rsp,%rbp
+  804511:	41 57                	push   %r15
+  804513:	53                   	push   %rbx
+  804514:	48 83 ec 20          	sub    $0x20,%rsp
+  804518:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804518 <alloc_sockfd+0xb>
+  80451f:	49 bb 18 4b 00 00 00 	movabs $0x4b18,%r11
+  804526:	00 00 00 
+  804529:	4c 01 db             	add    %r11,%rbx
+  80452c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  80452f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804533:	48 89 c7             	mov    %rax,%rdi
+  804536:	49 89 df             	mov    %rbx,%r15
+  804539:	48 b8 84 9a ff ff ff 	movabs $0xffffffffffff9a84,%rax
+  804540:	ff ff ff 
+  804543:	48 01 d8             	add    %rbx,%rax
+  804546:	ff d0                	call   *%rax
+  804548:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80454b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80454f:	78 2c                	js     80457d <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804551:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804555:	ba 07 04 00 00       	mov    $0x407,%edx
+  80455a:	48 89 c6             	mov    %rax,%rsi
+  80455d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804562:	49 89 df             	mov    %rbx,%r15
+  804565:	48 b8 16 8f ff ff ff 	movabs $0xffffffffffff8f16,%rax
+  80456c:	ff ff ff 
+  80456f:	48 01 d8             	add    %rbx,%rax
+  804572:	ff d0                	call   *%rax
+  804574:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804577:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80457b:	79 1c                	jns    804599 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80457d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804580:	89 c7                	mov    %eax,%edi
+  804582:	49 89 df             	mov    %rbx,%r15
+  804585:	48 b8 d1 bc ff ff ff 	movabs $0xffffffffffffbcd1,%rax
+  80458c:	ff ff ff 
+  80458f:	48 01 d8             	add    %rbx,%rax
+  804592:	ff d0                	call   *%rax
+		return r;
+  804594:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804597:	eb 41                	jmp    8045da <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804599:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80459d:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  8045a4:	00 00 00 
+  8045a7:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8045aa:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8045ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045b0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  8045b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045bb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8045be:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8045c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045c5:	48 89 c7             	mov    %rax,%rdi
+  8045c8:	49 89 df             	mov    %rbx,%r15
+  8045cb:	48 b8 0a 9a ff ff ff 	movabs $0xffffffffffff9a0a,%rax
+  8045d2:	ff ff ff 
+  8045d5:	48 01 d8             	add    %rbx,%rax
+  8045d8:	ff d0                	call   *%rax
+}
+  8045da:	48 83 c4 20          	add    $0x20,%rsp
+  8045de:	5b                   	pop    %rbx
+  8045df:	41 5f                	pop    %r15
+  8045e1:	5d                   	pop    %rbp
+  8045e2:	c3                   	ret
+
+00000000008045e3 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8045e3:	55                   	push   %rbp
+  8045e4:	48 89 e5             	mov    %rsp,%rbp
+  8045e7:	41 57                	push   %r15
+  8045e9:	53                   	push   %rbx
+  8045ea:	48 83 ec 30          	sub    $0x30,%rsp
+  8045ee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045ee <accept+0xb>
+  8045f5:	49 bb 42 4a 00 00 00 	movabs $0x4a42,%r11
+  8045fc:	00 00 00 
+  8045ff:	4c 01 db             	add    %r11,%rbx
+  804602:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804605:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804609:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80460d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804610:	89 c7                	mov    %eax,%edi
+  804612:	48 b8 61 b4 ff ff ff 	movabs $0xffffffffffffb461,%rax
+  804619:	ff ff ff 
+  80461c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804620:	ff d0                	call   *%rax
+  804622:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804625:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804629:	79 05                	jns    804630 <accept+0x4d>
+		return r;
+  80462b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80462e:	eb 45                	jmp    804675 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804630:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804634:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804638:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80463b:	48 89 ce             	mov    %rcx,%rsi
+  80463e:	89 c7                	mov    %eax,%edi
+  804640:	49 89 df             	mov    %rbx,%r15
+  804643:	48 b8 3f bb ff ff ff 	movabs $0xffffffffffffbb3f,%rax
+  80464a:	ff ff ff 
+  80464d:	48 01 d8             	add    %rbx,%rax
+  804650:	ff d0                	call   *%rax
+  804652:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804655:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804659:	79 05                	jns    804660 <accept+0x7d>
+		return r;
+  80465b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80465e:	eb 15                	jmp    804675 <accept+0x92>
+	return alloc_sockfd(r);
+  804660:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804663:	89 c7                	mov    %eax,%edi
+  804665:	48 b8 dd b4 ff ff ff 	movabs $0xffffffffffffb4dd,%rax
+  80466c:	ff ff ff 
+  80466f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804673:	ff d0                	call   *%rax
+}
+  804675:	48 83 c4 30          	add    $0x30,%rsp
+  804679:	5b                   	pop    %rbx
+  80467a:	41 5f                	pop    %r15
+  80467c:	5d                   	pop    %rbp
+  80467d:	c3                   	ret
+
+000000000080467e <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80467e:	55                   	push   %rbp
+  80467f:	48 89 e5             	mov    %rsp,%rbp
+  804682:	41 57                	push   %r15
+  804684:	53                   	push   %rbx
+  804685:	48 83 ec 20          	sub    $0x20,%rsp
+  804689:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804689 <bind+0xb>
+  804690:	49 bb a7 49 00 00 00 	movabs $0x49a7,%r11
+  804697:	00 00 00 
+  80469a:	4c 01 db             	add    %r11,%rbx
+  80469d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8046a0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8046a4:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8046a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8046aa:	89 c7                	mov    %eax,%edi
+  8046ac:	48 b8 61 b4 ff ff ff 	movabs $0xffffffffffffb461,%rax
+  8046b3:	ff ff ff 
+  8046b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046ba:	ff d0                	call   *%rax
+  8046bc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046bf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046c3:	79 05                	jns    8046ca <bind+0x4c>
+		return r;
+  8046c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046c8:	eb 21                	jmp    8046eb <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  8046ca:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8046cd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8046d1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046d4:	48 89 ce             	mov    %rcx,%rsi
+  8046d7:	89 c7                	mov    %eax,%edi
+  8046d9:	49 89 df             	mov    %rbx,%r15
+  8046dc:	48 b8 eb bb ff ff ff 	movabs $0xffffffffffffbbeb,%rax
+  8046e3:	ff ff ff 
+  8046e6:	48 01 d8             	add    %rbx,%rax
+  8046e9:	ff d0                	call   *%rax
+}
+  8046eb:	48 83 c4 20          	add    $0x20,%rsp
+  8046ef:	5b                   	pop    %rbx
+  8046f0:	41 5f                	pop    %r15
+  8046f2:	5d                   	pop    %rbp
+  8046f3:	c3                   	ret
+
+00000000008046f4 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8046f4:	55                   	push   %rbp
+  8046f5:	48 89 e5             	mov    %rsp,%rbp
+  8046f8:	41 57                	push   %r15
+  8046fa:	53                   	push   %rbx
+  8046fb:	48 83 ec 20          	sub    $0x20,%rsp
+  8046ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046ff <shutdown+0xb>
+  804706:	49 bb 31 49 00 00 00 	movabs $0x4931,%r11
+  80470d:	00 00 00 
+  804710:	4c 01 db             	add    %r11,%rbx
+  804713:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804716:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804719:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80471c:	89 c7                	mov    %eax,%edi
+  80471e:	48 b8 61 b4 ff ff ff 	movabs $0xffffffffffffb461,%rax
+  804725:	ff ff ff 
+  804728:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80472c:	ff d0                	call   *%rax
+  80472e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804731:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804735:	79 05                	jns    80473c <shutdown+0x48>
+		return r;
+  804737:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80473a:	eb 1c                	jmp    804758 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  80473c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80473f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804742:	89 d6                	mov    %edx,%esi
+  804744:	89 c7                	mov    %eax,%edi
+  804746:	49 89 df             	mov    %rbx,%r15
+  804749:	48 b8 80 bc ff ff ff 	movabs $0xffffffffffffbc80,%rax
+  804750:	ff ff ff 
+  804753:	48 01 d8             	add    %rbx,%rax
+  804756:	ff d0                	call   *%rax
+}
+  804758:	48 83 c4 20          	add    $0x20,%rsp
+  80475c:	5b                   	pop    %rbx
+  80475d:	41 5f                	pop    %r15
+  80475f:	5d                   	pop    %rbp
+  804760:	c3                   	ret
+
+0000000000804761 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804761:	55                   	push   %rbp
+  804762:	48 89 e5             	mov    %rsp,%rbp
+  804765:	41 57                	push   %r15
+  804767:	53                   	push   %rbx
+  804768:	48 83 ec 10          	sub    $0x10,%rsp
+  80476c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80476c <devsock_close+0xb>
+  804773:	49 bb c4 48 00 00 00 	movabs $0x48c4,%r11
+  80477a:	00 00 00 
+  80477d:	4c 01 db             	add    %r11,%rbx
+  804780:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804784:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804788:	48 89 c7             	mov    %rax,%rdi
+  80478b:	49 89 df             	mov    %rbx,%r15
+  80478e:	48 b8 d6 d5 ff ff ff 	movabs $0xffffffffffffd5d6,%rax
+  804795:	ff ff ff 
+  804798:	48 01 d8             	add    %rbx,%rax
+  80479b:	ff d0                	call   *%rax
+  80479d:	83 f8 01             	cmp    $0x1,%eax
+  8047a0:	75 1d                	jne    8047bf <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  8047a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047a6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8047a9:	89 c7                	mov    %eax,%edi
+  8047ab:	49 89 df             	mov    %rbx,%r15
+  8047ae:	48 b8 d1 bc ff ff ff 	movabs $0xffffffffffffbcd1,%rax
+  8047b5:	ff ff ff 
+  8047b8:	48 01 d8             	add    %rbx,%rax
+  8047bb:	ff d0                	call   *%rax
+  8047bd:	eb 05                	jmp    8047c4 <devsock_close+0x63>
+	else
+		return 0;
+  8047bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047c4:	48 83 c4 10          	add    $0x10,%rsp
+  8047c8:	5b                   	pop    %rbx
+  8047c9:	41 5f                	pop    %r15
+  8047cb:	5d                   	pop    %rbp
+  8047cc:	c3                   	ret
+
+00000000008047cd <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8047cd:	55                   	push   %rbp
+  8047ce:	48 89 e5             	mov    %rsp,%rbp
+  8047d1:	41 57                	push   %r15
+  8047d3:	53                   	push   %rbx
+  8047d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8047d8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047d8 <connect+0xb>
+  8047df:	49 bb 58 48 00 00 00 	movabs $0x4858,%r11
+  8047e6:	00 00 00 
+  8047e9:	4c 01 db             	add    %r11,%rbx
+  8047ec:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8047ef:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8047f3:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8047f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8047f9:	89 c7                	mov    %eax,%edi
+  8047fb:	48 b8 61 b4 ff ff ff 	movabs $0xffffffffffffb461,%rax
+  804802:	ff ff ff 
+  804805:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804809:	ff d0                	call   *%rax
+  80480b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80480e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804812:	79 05                	jns    804819 <connect+0x4c>
+		return r;
+  804814:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804817:	eb 21                	jmp    80483a <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804819:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80481c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804820:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804823:	48 89 ce             	mov    %rcx,%rsi
+  804826:	89 c7                	mov    %eax,%edi
+  804828:	49 89 df             	mov    %rbx,%r15
+  80482b:	48 b8 19 bd ff ff ff 	movabs $0xffffffffffffbd19,%rax
+  804832:	ff ff ff 
+  804835:	48 01 d8             	add    %rbx,%rax
+  804838:	ff d0                	call   *%rax
+}
+  80483a:	48 83 c4 20          	add    $0x20,%rsp
+  80483e:	5b                   	pop    %rbx
+  80483f:	41 5f                	pop    %r15
+  804841:	5d                   	pop    %rbp
+  804842:	c3                   	ret
+
+0000000000804843 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804843:	55                   	push   %rbp
+  804844:	48 89 e5             	mov    %rsp,%rbp
+  804847:	41 57                	push   %r15
+  804849:	53                   	push   %rbx
+  80484a:	48 83 ec 20          	sub    $0x20,%rsp
+  80484e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80484e <listen+0xb>
+  804855:	49 bb e2 47 00 00 00 	movabs $0x47e2,%r11
+  80485c:	00 00 00 
+  80485f:	4c 01 db             	add    %r11,%rbx
+  804862:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804865:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804868:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80486b:	89 c7                	mov    %eax,%edi
+  80486d:	48 b8 61 b4 ff ff ff 	movabs $0xffffffffffffb461,%rax
+  804874:	ff ff ff 
+  804877:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80487b:	ff d0                	call   *%rax
+  80487d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804880:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804884:	79 05                	jns    80488b <listen+0x48>
+		return r;
+  804886:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804889:	eb 1c                	jmp    8048a7 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80488b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80488e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804891:	89 d6                	mov    %edx,%esi
+  804893:	89 c7                	mov    %eax,%edi
+  804895:	49 89 df             	mov    %rbx,%r15
+  804898:	48 b8 ae bd ff ff ff 	movabs $0xffffffffffffbdae,%rax
+  80489f:	ff ff ff 
+  8048a2:	48 01 d8             	add    %rbx,%rax
+  8048a5:	ff d0                	call   *%rax
+}
+  8048a7:	48 83 c4 20          	add    $0x20,%rsp
+  8048ab:	5b                   	pop    %rbx
+  8048ac:	41 5f                	pop    %r15
+  8048ae:	5d                   	pop    %rbp
+  8048af:	c3                   	ret
+
+00000000008048b0 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8048b0:	55                   	push   %rbp
+  8048b1:	48 89 e5             	mov    %rsp,%rbp
+  8048b4:	41 57                	push   %r15
+  8048b6:	48 83 ec 28          	sub    $0x28,%rsp
+  8048ba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8048ba <devsock_read+0xa>
+  8048c1:	49 bb 76 47 00 00 00 	movabs $0x4776,%r11
+  8048c8:	00 00 00 
+  8048cb:	4c 01 d8             	add    %r11,%rax
+  8048ce:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8048d2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8048d6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8048da:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8048de:	41 89 d0             	mov    %edx,%r8d
+  8048e1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8048e5:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8048e8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8048ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8048f1:	44 89 c2             	mov    %r8d,%edx
+  8048f4:	49 89 c7             	mov    %rax,%r15
+  8048f7:	49 b8 ff bd ff ff ff 	movabs $0xffffffffffffbdff,%r8
+  8048fe:	ff ff ff 
+  804901:	49 01 c0             	add    %rax,%r8
+  804904:	41 ff d0             	call   *%r8
+}
+  804907:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80490b:	c9                   	leave
+  80490c:	c3                   	ret
+
+000000000080490d <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80490d:	55                   	push   %rbp
+  80490e:	48 89 e5             	mov    %rsp,%rbp
+  804911:	41 57                	push   %r15
+  804913:	48 83 ec 28          	sub    $0x28,%rsp
+  804917:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804917 <devsock_write+0xa>
+  80491e:	49 bb 19 47 00 00 00 	movabs $0x4719,%r11
+  804925:	00 00 00 
+  804928:	4c 01 d8             	add    %r11,%rax
+  80492b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80492f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804933:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804937:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80493b:	41 89 d0             	mov    %edx,%r8d
+  80493e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804942:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804945:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804949:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80494e:	44 89 c2             	mov    %r8d,%edx
+  804951:	49 89 c7             	mov    %rax,%r15
+  804954:	49 b8 1c bf ff ff ff 	movabs $0xffffffffffffbf1c,%r8
+  80495b:	ff ff ff 
+  80495e:	49 01 c0             	add    %rax,%r8
+  804961:	41 ff d0             	call   *%r8
+}
+  804964:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804968:	c9                   	leave
+  804969:	c3                   	ret
+
+000000000080496a <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80496a:	55                   	push   %rbp
+  80496b:	48 89 e5             	mov    %rsp,%rbp
+  80496e:	41 57                	push   %r15
+  804970:	48 83 ec 18          	sub    $0x18,%rsp
+  804974:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804974 <devsock_stat+0xa>
+  80497b:	49 bb bc 46 00 00 00 	movabs $0x46bc,%r11
+  804982:	00 00 00 
+  804985:	4c 01 d8             	add    %r11,%rax
+  804988:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80498c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804990:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804994:	48 b9 f4 db ff ff ff 	movabs $0xffffffffffffdbf4,%rcx
+  80499b:	ff ff ff 
+  80499e:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8049a2:	48 89 ce             	mov    %rcx,%rsi
+  8049a5:	48 89 d7             	mov    %rdx,%rdi
+  8049a8:	49 89 c7             	mov    %rax,%r15
+  8049ab:	48 ba 5a 82 ff ff ff 	movabs $0xffffffffffff825a,%rdx
+  8049b2:	ff ff ff 
+  8049b5:	48 01 c2             	add    %rax,%rdx
+  8049b8:	ff d2                	call   *%rdx
+	return 0;
+  8049ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049bf:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8049c3:	c9                   	leave
+  8049c4:	c3                   	ret
+
+00000000008049c5 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8049c5:	55                   	push   %rbp
+  8049c6:	48 89 e5             	mov    %rsp,%rbp
+  8049c9:	41 57                	push   %r15
+  8049cb:	53                   	push   %rbx
+  8049cc:	48 83 ec 20          	sub    $0x20,%rsp
+  8049d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049d0 <socket+0xb>
+  8049d7:	49 bb 60 46 00 00 00 	movabs $0x4660,%r11
+  8049de:	00 00 00 
+  8049e1:	4c 01 db             	add    %r11,%rbx
+  8049e4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8049e7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8049ea:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8049ed:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8049f0:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8049f3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8049f6:	89 ce                	mov    %ecx,%esi
+  8049f8:	89 c7                	mov    %eax,%edi
+  8049fa:	49 89 df             	mov    %rbx,%r15
+  8049fd:	48 b8 f3 c0 ff ff ff 	movabs $0xffffffffffffc0f3,%rax
+  804a04:	ff ff ff 
+  804a07:	48 01 d8             	add    %rbx,%rax
+  804a0a:	ff d0                	call   *%rax
+  804a0c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a0f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a13:	79 05                	jns    804a1a <socket+0x55>
+		return r;
+  804a15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a18:	eb 15                	jmp    804a2f <socket+0x6a>
+	return alloc_sockfd(r);
+  804a1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a1d:	89 c7                	mov    %eax,%edi
+  804a1f:	48 b8 dd b4 ff ff ff 	movabs $0xffffffffffffb4dd,%rax
+  804a26:	ff ff ff 
+  804a29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a2d:	ff d0                	call   *%rax
+}
+  804a2f:	48 83 c4 20          	add    $0x20,%rsp
+  804a33:	5b                   	pop    %rbx
+  804a34:	41 5f                	pop    %r15
+  804a36:	5d                   	pop    %rbp
+  804a37:	c3                   	ret
+
+0000000000804a38 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  804a38:	55                   	push   %rbp
+  804a39:	48 89 e5             	mov    %rsp,%rbp
+  804a3c:	41 57                	push   %r15
+  804a3e:	53                   	push   %rbx
+  804a3f:	48 83 ec 10          	sub    $0x10,%rsp
+  804a43:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a43 <nsipc+0xb>
+  804a4a:	49 bb ed 45 00 00 00 	movabs $0x45ed,%r11
+  804a51:	00 00 00 
+  804a54:	4c 01 db             	add    %r11,%rbx
+  804a57:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  804a5a:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804a61:	00 00 00 
+  804a64:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a67:	85 c0                	test   %eax,%eax
+  804a69:	75 24                	jne    804a8f <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804a6b:	bf 02 00 00 00       	mov    $0x2,%edi
+  804a70:	49 89 df             	mov    %rbx,%r15
+  804a73:	48 b8 47 d5 ff ff ff 	movabs $0xffffffffffffd547,%rax
+  804a7a:	ff ff ff 
+  804a7d:	48 01 d8             	add    %rbx,%rax
+  804a80:	ff d0                	call   *%rax
+  804a82:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804a89:	00 00 00 
+  804a8c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804a8f:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804a96:	00 00 00 
+  804a99:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a9c:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804a9f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804aa5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804aab:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804ab0:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804ab7:	00 00 00 
+  804aba:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804abe:	89 c7                	mov    %eax,%edi
+  804ac0:	49 89 df             	mov    %rbx,%r15
+  804ac3:	48 b8 66 cf ff ff ff 	movabs $0xffffffffffffcf66,%rax
+  804aca:	ff ff ff 
+  804acd:	48 01 d8             	add    %rbx,%rax
+  804ad0:	ff d0                	call   *%rax
+}
+  804ad2:	48 83 c4 10          	add    $0x10,%rsp
+  804ad6:	5b                   	pop    %rbx
+  804ad7:	41 5f                	pop    %r15
+  804ad9:	5d                   	pop    %rbp
+  804ada:	c3                   	ret
+
+0000000000804adb <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804adb:	55                   	push   %rbp
+  804adc:	48 89 e5             	mov    %rsp,%rbp
+  804adf:	41 57                	push   %r15
+  804ae1:	53                   	push   %rbx
+  804ae2:	48 83 ec 20          	sub    $0x20,%rsp
+  804ae6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ae6 <nsipc_words+0xb>
+  804aed:	49 bb 4a 45 00 00 00 	movabs $0x454a,%r11
+  804af4:	00 00 00 
+  804af7:	4c 01 db             	add    %r11,%rbx
+  804afa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804afd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804b01:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  804b05:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804b0c:	00 00 00 
+  804b0f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b12:	85 c0                	test   %eax,%eax
+  804b14:	75 24                	jne    804b3a <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804b16:	bf 02 00 00 00       	mov    $0x2,%edi
+  804b1b:	49 89 df             	mov    %rbx,%r15
+  804b1e:	48 b8 47 d5 ff ff ff 	movabs $0xffffffffffffd547,%rax
+  804b25:	ff ff ff 
+  804b28:	48 01 d8             	add    %rbx,%rax
+  804b2b:	ff d0                	call   *%rax
+  804b2d:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804b34:	00 00 00 
+  804b37:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804b3a:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804b41:	00 00 00 
+  804b44:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b47:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804b4b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804b4f:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804b52:	89 c7                	mov    %eax,%edi
+  804b54:	49 89 df             	mov    %rbx,%r15
+  804b57:	48 b8 51 d0 ff ff ff 	movabs $0xffffffffffffd051,%rax
+  804b5e:	ff ff ff 
+  804b61:	48 01 d8             	add    %rbx,%rax
+  804b64:	ff d0                	call   *%rax
+}
+  804b66:	48 83 c4 20          	add    $0x20,%rsp
+  804b6a:	5b                   	pop    %rbx
+  804b6b:	41 5f                	pop    %r15
+  804b6d:	5d                   	pop    %rbp
+  804b6e:	c3                   	ret
+
+0000000000804b6f <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804b6f:	55                   	push   %rbp
+  804b70:	48 89 e5             	mov    %rsp,%rbp
+  804b73:	41 57                	push   %r15
+  804b75:	53                   	push   %rbx
+  804b76:	48 83 ec 30          	sub    $0x30,%rsp
+  804b7a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b7a <nsipc_accept+0xb>
+  804b81:	49 bb b6 44 00 00 00 	movabs $0x44b6,%r11
+  804b88:	00 00 00 
+  804b8b:	4c 01 db             	add    %r11,%rbx
+  804b8e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804b91:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804b95:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  804b99:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804ba0:	00 00 00 
+  804ba3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ba6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  804ba9:	bf 01 00 00 00       	mov    $0x1,%edi
+  804bae:	48 b8 08 ba ff ff ff 	movabs $0xffffffffffffba08,%rax
+  804bb5:	ff ff ff 
+  804bb8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bbc:	ff d0                	call   *%rax
+  804bbe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bc1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804bc5:	78 48                	js     804c0f <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  804bc7:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  804bce:	00 00 00 
+  804bd1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bd5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804bd9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bdd:	8b 40 10             	mov    0x10(%rax),%eax
+  804be0:	89 c2                	mov    %eax,%edx
+  804be2:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804be6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bea:	48 89 ce             	mov    %rcx,%rsi
+  804bed:	48 89 c7             	mov    %rax,%rdi
+  804bf0:	49 89 df             	mov    %rbx,%r15
+  804bf3:	48 b8 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rax
+  804bfa:	ff ff ff 
+  804bfd:	48 01 d8             	add    %rbx,%rax
+  804c00:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  804c02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c06:	8b 50 10             	mov    0x10(%rax),%edx
+  804c09:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c0d:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  804c0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804c12:	48 83 c4 30          	add    $0x30,%rsp
+  804c16:	5b                   	pop    %rbx
+  804c17:	41 5f                	pop    %r15
+  804c19:	5d                   	pop    %rbp
+  804c1a:	c3                   	ret
+
+0000000000804c1b <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804c1b:	55                   	push   %rbp
+  804c1c:	48 89 e5             	mov    %rsp,%rbp
+  804c1f:	41 57                	push   %r15
+  804c21:	53                   	push   %rbx
+  804c22:	48 83 ec 10          	sub    $0x10,%rsp
+  804c26:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c26 <nsipc_bind+0xb>
+  804c2d:	49 bb 0a 44 00 00 00 	movabs $0x440a,%r11
+  804c34:	00 00 00 
+  804c37:	4c 01 db             	add    %r11,%rbx
+  804c3a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804c3d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c41:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  804c44:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804c4b:	00 00 00 
+  804c4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c51:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804c54:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804c57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c5b:	48 89 c6             	mov    %rax,%rsi
+  804c5e:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  804c65:	00 00 00 
+  804c68:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c6c:	48 89 c7             	mov    %rax,%rdi
+  804c6f:	49 89 df             	mov    %rbx,%r15
+  804c72:	48 b8 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rax
+  804c79:	ff ff ff 
+  804c7c:	48 01 d8             	add    %rbx,%rax
+  804c7f:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804c81:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804c88:	00 00 00 
+  804c8b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c8e:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804c92:	bf 02 00 00 00       	mov    $0x2,%edi
+  804c97:	48 b8 08 ba ff ff ff 	movabs $0xffffffffffffba08,%rax
+  804c9e:	ff ff ff 
+  804ca1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ca5:	ff d0                	call   *%rax
+}
+  804ca7:	48 83 c4 10          	add    $0x10,%rsp
+  804cab:	5b                   	pop    %rbx
+  804cac:	41 5f                	pop    %r15
+  804cae:	5d                   	pop    %rbp
+  804caf:	c3                   	ret
+
+0000000000804cb0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804cb0:	55                   	push   %rbp
+  804cb1:	48 89 e5             	mov    %rsp,%rbp
+  804cb4:	48 83 ec 20          	sub    $0x20,%rsp
+  804cb8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804cb8 <nsipc_shutdown+0x8>
+  804cbf:	49 bb 78 43 00 00 00 	movabs $0x4378,%r11
+  804cc6:	00 00 00 
+  804cc9:	4c 01 d8             	add    %r11,%rax
+  804ccc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804ccf:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  804cd2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804cd5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  804cd8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804cdb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  804cde:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804ce2:	ba 08 00 00 00       	mov    $0x8,%edx
+  804ce7:	48 89 ce             	mov    %rcx,%rsi
+  804cea:	bf 03 00 00 00       	mov    $0x3,%edi
+  804cef:	48 b9 ab ba ff ff ff 	movabs $0xffffffffffffbaab,%rcx
+  804cf6:	ff ff ff 
+  804cf9:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804cfd:	ff d0                	call   *%rax
+}
+  804cff:	c9                   	leave
+  804d00:	c3                   	ret
+
+0000000000804d01 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  804d01:	55                   	push   %rbp
+  804d02:	48 89 e5             	mov    %rsp,%rbp
+  804d05:	48 83 ec 20          	sub    $0x20,%rsp
+  804d09:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d09 <nsipc_close+0x8>
+  804d10:	49 bb 27 43 00 00 00 	movabs $0x4327,%r11
+  804d17:	00 00 00 
+  804d1a:	4c 01 d8             	add    %r11,%rax
+  804d1d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  804d20:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804d23:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  804d26:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804d2a:	ba 04 00 00 00       	mov    $0x4,%edx
+  804d2f:	48 89 ce             	mov    %rcx,%rsi
+  804d32:	bf 04 00 00 00       	mov    $0x4,%edi
+  804d37:	48 b9 ab ba ff ff ff 	movabs $0xffffffffffffbaab,%rcx
+  804d3e:	ff ff ff 
+  804d41:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804d45:	ff d0                	call   *%rax
+}
+  804d47:	c9                   	leave
+  804d48:	c3                   	ret
+
+0000000000804d49 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804d49:	55                   	push   %rbp
+  804d4a:	48 89 e5             	mov    %rsp,%rbp
+  804d4d:	41 57                	push   %r15
+  804d4f:	53                   	push   %rbx
+  804d50:	48 83 ec 10          	sub    $0x10,%rsp
+  804d54:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d54 <nsipc_connect+0xb>
+  804d5b:	49 bb dc 42 00 00 00 	movabs $0x42dc,%r11
+  804d62:	00 00 00 
+  804d65:	4c 01 db             	add    %r11,%rbx
+  804d68:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804d6b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804d6f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804d72:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804d79:	00 00 00 
+  804d7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d7f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804d82:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804d85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d89:	48 89 c6             	mov    %rax,%rsi
+  804d8c:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  804d93:	00 00 00 
+  804d96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d9a:	48 89 c7             	mov    %rax,%rdi
+  804d9d:	49 89 df             	mov    %rbx,%r15
+  804da0:	48 b8 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rax
+  804da7:	ff ff ff 
+  804daa:	48 01 d8             	add    %rbx,%rax
+  804dad:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  804daf:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804db6:	00 00 00 
+  804db9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804dbc:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  804dc0:	bf 05 00 00 00       	mov    $0x5,%edi
+  804dc5:	48 b8 08 ba ff ff ff 	movabs $0xffffffffffffba08,%rax
+  804dcc:	ff ff ff 
+  804dcf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804dd3:	ff d0                	call   *%rax
+}
+  804dd5:	48 83 c4 10          	add    $0x10,%rsp
+  804dd9:	5b                   	pop    %rbx
+  804dda:	41 5f                	pop    %r15
+  804ddc:	5d                   	pop    %rbp
+  804ddd:	c3                   	ret
+
+0000000000804dde <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804dde:	55                   	push   %rbp
+  804ddf:	48 89 e5             	mov    %rsp,%rbp
+  804de2:	48 83 ec 20          	sub    $0x20,%rsp
+  804de6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804de6 <nsipc_listen+0x8>
+  804ded:	49 bb 4a 42 00 00 00 	movabs $0x424a,%r11
+  804df4:	00 00 00 
+  804df7:	4c 01 d8             	add    %r11,%rax
+  804dfa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804dfd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804e00:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804e03:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  804e06:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804e09:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804e0c:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804e10:	ba 08 00 00 00       	mov    $0x8,%edx
+  804e15:	48 89 ce             	mov    %rcx,%rsi
+  804e18:	bf 06 00 00 00       	mov    $0x6,%edi
+  804e1d:	48 b9 ab ba ff ff ff 	movabs $0xffffffffffffbaab,%rcx
+  804e24:	ff ff ff 
+  804e27:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804e2b:	ff d0                	call   *%rax
+}
+  804e2d:	c9                   	leave
+  804e2e:	c3                   	ret
+
+0000000000804e2f <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  804e2f:	55                   	push   %rbp
+  804e30:	48 89 e5             	mov    %rsp,%rbp
+  804e33:	41 57                	push   %r15
+  804e35:	53                   	push   %rbx
+  804e36:	48 83 ec 30          	sub    $0x30,%rsp
+  804e3a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e3a <nsipc_recv+0xb>
+  804e41:	49 bb f6 41 00 00 00 	movabs $0x41f6,%r11
+  804e48:	00 00 00 
+  804e4b:	4c 01 db             	add    %r11,%rbx
+  804e4e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e51:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804e55:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  804e58:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804e5b:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804e62:	00 00 00 
+  804e65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e68:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  804e6b:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804e72:	00 00 00 
+  804e75:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804e78:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804e7c:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804e83:	00 00 00 
+  804e86:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804e89:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804e8d:	bf 07 00 00 00       	mov    $0x7,%edi
+  804e92:	48 b8 08 ba ff ff ff 	movabs $0xffffffffffffba08,%rax
+  804e99:	ff ff ff 
+  804e9c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ea0:	ff d0                	call   *%rax
+  804ea2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ea5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ea9:	0f 88 91 00 00 00    	js     804f40 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804eaf:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804eb6:	7f 08                	jg     804ec0 <nsipc_recv+0x91>
+  804eb8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ebb:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804ebe:	7e 50                	jle    804f10 <nsipc_recv+0xe1>
+  804ec0:	48 b8 fb db ff ff ff 	movabs $0xffffffffffffdbfb,%rax
+  804ec7:	ff ff ff 
+  804eca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ece:	48 89 c1             	mov    %rax,%rcx
+  804ed1:	48 b8 10 dc ff ff ff 	movabs $0xffffffffffffdc10,%rax
+  804ed8:	ff ff ff 
+  804edb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804edf:	48 89 c2             	mov    %rax,%rdx
+  804ee2:	be 79 00 00 00       	mov    $0x79,%esi
+  804ee7:	48 b8 25 dc ff ff ff 	movabs $0xffffffffffffdc25,%rax
+  804eee:	ff ff ff 
+  804ef1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ef5:	48 89 c7             	mov    %rax,%rdi
+  804ef8:	49 89 df             	mov    %rbx,%r15
+  804efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f00:	49 b8 b1 cc ff ff ff 	movabs $0xffffffffffffccb1,%r8
+  804f07:	ff ff ff 
+  804f0a:	49 01 d8             	add    %rbx,%r8
+  804f0d:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804f10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f13:	48 63 d0             	movslq %eax,%rdx
+  804f16:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f1a:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804f21:	00 00 00 
+  804f24:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  804f28:	48 89 ce             	mov    %rcx,%rsi
+  804f2b:	48 89 c7             	mov    %rax,%rdi
+  804f2e:	49 89 df             	mov    %rbx,%r15
+  804f31:	48 b8 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rax
+  804f38:	ff ff ff 
+  804f3b:	48 01 d8             	add    %rbx,%rax
+  804f3e:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804f40:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804f43:	48 83 c4 30          	add    $0x30,%rsp
+  804f47:	5b                   	pop    %rbx
+  804f48:	41 5f                	pop    %r15
+  804f4a:	5d                   	pop    %rbp
+  804f4b:	c3                   	ret
+
+0000000000804f4c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804f4c:	55                   	push   %rbp
+  804f4d:	48 89 e5             	mov    %rsp,%rbp
+  804f50:	41 57                	push   %r15
+  804f52:	53                   	push   %rbx
+  804f53:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804f5a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f5a <nsipc_send+0xe>
+  804f61:	49 bb d6 40 00 00 00 	movabs $0x40d6,%r11
+  804f68:	00 00 00 
+  804f6b:	4c 01 db             	add    %r11,%rbx
+  804f6e:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804f74:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804f7b:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804f81:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804f87:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804f8b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804f8f:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804f96:	00 00 00 
+  804f99:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f9c:	85 c0                	test   %eax,%eax
+  804f9e:	75 24                	jne    804fc4 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804fa0:	bf 02 00 00 00       	mov    $0x2,%edi
+  804fa5:	49 89 df             	mov    %rbx,%r15
+  804fa8:	48 b8 47 d5 ff ff ff 	movabs $0xffffffffffffd547,%rax
+  804faf:	ff ff ff 
+  804fb2:	48 01 d8             	add    %rbx,%rax
+  804fb5:	ff d0                	call   *%rax
+  804fb7:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  804fbe:	00 00 00 
+  804fc1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804fc4:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804fca:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804fcd:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804fd4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804fd7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804fda:	39 c2                	cmp    %eax,%edx
+  804fdc:	0f 4e c2             	cmovle %edx,%eax
+  804fdf:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804fe5:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804feb:	48 63 d0             	movslq %eax,%rdx
+  804fee:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804ff5:	48 89 c6             	mov    %rax,%rsi
+  804ff8:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804fff:	00 00 00 
+  805002:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805006:	48 89 c7             	mov    %rax,%rdi
+  805009:	49 89 df             	mov    %rbx,%r15
+  80500c:	48 b8 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rax
+  805013:	ff ff ff 
+  805016:	48 01 d8             	add    %rbx,%rax
+  805019:	ff d0                	call   *%rax
+	req->req_s = s;
+  80501b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80501f:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805025:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805027:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80502b:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805031:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805034:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805038:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80503e:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805041:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  805048:	00 00 00 
+  80504b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80504f:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805053:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80505a:	00 
+  80505b:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805061:	48 63 d0             	movslq %eax,%rdx
+  805064:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805068:	48 01 d0             	add    %rdx,%rax
+  80506b:	48 83 e8 01          	sub    $0x1,%rax
+  80506f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805073:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805077:	ba 00 00 00 00       	mov    $0x0,%edx
+  80507c:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805080:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805084:	48 29 d0             	sub    %rdx,%rax
+  805087:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  80508d:	85 c0                	test   %eax,%eax
+  80508f:	0f 48 c2             	cmovs  %edx,%eax
+  805092:	c1 f8 0c             	sar    $0xc,%eax
+  805095:	48 98                	cltq
+  805097:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  80509b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80509f:	48 85 c0             	test   %rax,%rax
+  8050a2:	0f 95 c0             	setne  %al
+  8050a5:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8050a8:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8050af:	00 
+  8050b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050b4:	48 83 c0 0b          	add    $0xb,%rax
+  8050b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8050bc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8050c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050c5:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8050c9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8050cd:	48 29 d0             	sub    %rdx,%rax
+  8050d0:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8050d4:	89 c7                	mov    %eax,%edi
+  8050d6:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8050dd:	00 00 00 
+  8050e0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8050e3:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8050e7:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8050eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8050ef:	6a 00                	push   $0x0
+  8050f1:	6a 00                	push   $0x0
+  8050f3:	6a 05                	push   $0x5
+  8050f5:	41 89 f1             	mov    %esi,%r9d
+  8050f8:	49 89 c8             	mov    %rcx,%r8
+  8050fb:	89 f9                	mov    %edi,%ecx
+  8050fd:	be 08 00 00 00       	mov    $0x8,%esi
+  805102:	89 c7                	mov    %eax,%edi
+  805104:	49 89 df             	mov    %rbx,%r15
+  805107:	48 b8 4f d1 ff ff ff 	movabs $0xffffffffffffd14f,%rax
+  80510e:	ff ff ff 
+  805111:	48 01 d8             	add    %rbx,%rax
+  805114:	ff d0                	call   *%rax
+  805116:	48 83 c4 20          	add    $0x20,%rsp
+}
+  80511a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80511e:	5b                   	pop    %rbx
+  80511f:	41 5f                	pop    %r15
+  805121:	5d                   	pop    %rbp
+  805122:	c3                   	ret
+
+0000000000805123 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805123:	55                   	push   %rbp
+  805124:	48 89 e5             	mov    %rsp,%rbp
+  805127:	48 83 ec 10          	sub    $0x10,%rsp
+  80512b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80512b <nsipc_socket+0x8>
+  805132:	49 bb 05 3f 00 00 00 	movabs $0x3f05,%r11
+  805139:	00 00 00 
+  80513c:	4c 01 d8             	add    %r11,%rax
+  80513f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805142:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805145:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805148:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  80514f:	00 00 00 
+  805152:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805155:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805158:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  80515f:	00 00 00 
+  805162:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805165:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805169:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  805170:	00 00 00 
+  805173:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805176:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  80517a:	bf 09 00 00 00       	mov    $0x9,%edi
+  80517f:	48 ba 08 ba ff ff ff 	movabs $0xffffffffffffba08,%rdx
+  805186:	ff ff ff 
+  805189:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80518d:	ff d0                	call   *%rax
+}
+  80518f:	c9                   	leave
+  805190:	c3                   	ret
+
+0000000000805191 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805191:	55                   	push   %rbp
+  805192:	48 89 e5             	mov    %rsp,%rbp
+  805195:	41 57                	push   %r15
+  805197:	53                   	push   %rbx
+  805198:	48 83 ec 30          	sub    $0x30,%rsp
+  80519c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80519c <pipe+0xb>
+  8051a3:	49 bb 94 3e 00 00 00 	movabs $0x3e94,%r11
+  8051aa:	00 00 00 
+  8051ad:	4c 01 db             	add    %r11,%rbx
+  8051b0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8051b4:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8051b8:	48 89 c7             	mov    %rax,%rdi
+  8051bb:	49 89 df             	mov    %rbx,%r15
+  8051be:	48 b8 84 9a ff ff ff 	movabs $0xffffffffffff9a84,%rax
+  8051c5:	ff ff ff 
+  8051c8:	48 01 d8             	add    %rbx,%rax
+  8051cb:	ff d0                	call   *%rax
+  8051cd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051d4:	0f 88 12 02 00 00    	js     8053ec <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8051da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051de:	ba 07 04 00 00       	mov    $0x407,%edx
+  8051e3:	48 89 c6             	mov    %rax,%rsi
+  8051e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051eb:	49 89 df             	mov    %rbx,%r15
+  8051ee:	48 b8 16 8f ff ff ff 	movabs $0xffffffffffff8f16,%rax
+  8051f5:	ff ff ff 
+  8051f8:	48 01 d8             	add    %rbx,%rax
+  8051fb:	ff d0                	call   *%rax
+  8051fd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805200:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805204:	0f 88 e2 01 00 00    	js     8053ec <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  80520a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80520e:	48 89 c7             	mov    %rax,%rdi
+  805211:	49 89 df             	mov    %rbx,%r15
+  805214:	48 b8 84 9a ff ff ff 	movabs $0xffffffffffff9a84,%rax
+  80521b:	ff ff ff 
+  80521e:	48 01 d8             	add    %rbx,%rax
+  805221:	ff d0                	call   *%rax
+  805223:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805226:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80522a:	0f 88 9b 01 00 00    	js     8053cb <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805230:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805234:	ba 07 04 00 00       	mov    $0x407,%edx
+  805239:	48 89 c6             	mov    %rax,%rsi
+  80523c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805241:	49 89 df             	mov    %rbx,%r15
+  805244:	48 b8 16 8f ff ff ff 	movabs $0xffffffffffff8f16,%rax
+  80524b:	ff ff ff 
+  80524e:	48 01 d8             	add    %rbx,%rax
+  805251:	ff d0                	call   *%rax
+  805253:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805256:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80525a:	0f 88 6b 01 00 00    	js     8053cb <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805260:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805264:	48 89 c7             	mov    %rax,%rdi
+  805267:	49 89 df             	mov    %rbx,%r15
+  80526a:	48 b8 41 9a ff ff ff 	movabs $0xffffffffffff9a41,%rax
+  805271:	ff ff ff 
+  805274:	48 01 d8             	add    %rbx,%rax
+  805277:	ff d0                	call   *%rax
+  805279:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80527d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805281:	ba 07 04 00 00       	mov    $0x407,%edx
+  805286:	48 89 c6             	mov    %rax,%rsi
+  805289:	bf 00 00 00 00       	mov    $0x0,%edi
+  80528e:	49 89 df             	mov    %rbx,%r15
+  805291:	48 b8 16 8f ff ff ff 	movabs $0xffffffffffff8f16,%rax
+  805298:	ff ff ff 
+  80529b:	48 01 d8             	add    %rbx,%rax
+  80529e:	ff d0                	call   *%rax
+  8052a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052a7:	0f 88 fd 00 00 00    	js     8053aa <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8052ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052b1:	48 89 c7             	mov    %rax,%rdi
+  8052b4:	49 89 df             	mov    %rbx,%r15
+  8052b7:	48 b8 41 9a ff ff ff 	movabs $0xffffffffffff9a41,%rax
+  8052be:	ff ff ff 
+  8052c1:	48 01 d8             	add    %rbx,%rax
+  8052c4:	ff d0                	call   *%rax
+  8052c6:	48 89 c2             	mov    %rax,%rdx
+  8052c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052cd:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8052d3:	48 89 d1             	mov    %rdx,%rcx
+  8052d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052db:	48 89 c6             	mov    %rax,%rsi
+  8052de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052e3:	49 89 df             	mov    %rbx,%r15
+  8052e6:	48 b8 7b 8f ff ff ff 	movabs $0xffffffffffff8f7b,%rax
+  8052ed:	ff ff ff 
+  8052f0:	48 01 d8             	add    %rbx,%rax
+  8052f3:	ff d0                	call   *%rax
+  8052f5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052f8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052fc:	0f 88 87 00 00 00    	js     805389 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805302:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805306:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  80530d:	00 00 00 
+  805310:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805313:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805315:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805319:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805320:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805324:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  80532b:	00 00 00 
+  80532e:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805331:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805333:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805337:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  80533e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805342:	48 89 c7             	mov    %rax,%rdi
+  805345:	49 89 df             	mov    %rbx,%r15
+  805348:	48 b8 0a 9a ff ff ff 	movabs $0xffffffffffff9a0a,%rax
+  80534f:	ff ff ff 
+  805352:	48 01 d8             	add    %rbx,%rax
+  805355:	ff d0                	call   *%rax
+  805357:	89 c2                	mov    %eax,%edx
+  805359:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80535d:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  80535f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805363:	48 89 c7             	mov    %rax,%rdi
+  805366:	49 89 df             	mov    %rbx,%r15
+  805369:	48 b8 0a 9a ff ff ff 	movabs $0xffffffffffff9a0a,%rax
+  805370:	ff ff ff 
+  805373:	48 01 d8             	add    %rbx,%rax
+  805376:	ff d0                	call   *%rax
+  805378:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80537c:	48 83 c2 04          	add    $0x4,%rdx
+  805380:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805382:	b8 00 00 00 00       	mov    $0x0,%eax
+  805387:	eb 67                	jmp    8053f0 <pipe+0x25f>
+		goto err3;
+  805389:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80538a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80538e:	48 89 c6             	mov    %rax,%rsi
+  805391:	bf 00 00 00 00       	mov    $0x0,%edi
+  805396:	49 89 df             	mov    %rbx,%r15
+  805399:	48 b8 ee 8f ff ff ff 	movabs $0xffffffffffff8fee,%rax
+  8053a0:	ff ff ff 
+  8053a3:	48 01 d8             	add    %rbx,%rax
+  8053a6:	ff d0                	call   *%rax
+  8053a8:	eb 01                	jmp    8053ab <pipe+0x21a>
+		goto err2;
+  8053aa:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  8053ab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053af:	48 89 c6             	mov    %rax,%rsi
+  8053b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053b7:	49 89 df             	mov    %rbx,%r15
+  8053ba:	48 b8 ee 8f ff ff ff 	movabs $0xffffffffffff8fee,%rax
+  8053c1:	ff ff ff 
+  8053c4:	48 01 d8             	add    %rbx,%rax
+  8053c7:	ff d0                	call   *%rax
+  8053c9:	eb 01                	jmp    8053cc <pipe+0x23b>
+		goto err1;
+  8053cb:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8053cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053d0:	48 89 c6             	mov    %rax,%rsi
+  8053d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053d8:	49 89 df             	mov    %rbx,%r15
+  8053db:	48 b8 ee 8f ff ff ff 	movabs $0xffffffffffff8fee,%rax
+  8053e2:	ff ff ff 
+  8053e5:	48 01 d8             	add    %rbx,%rax
+  8053e8:	ff d0                	call   *%rax
+  8053ea:	eb 01                	jmp    8053ed <pipe+0x25c>
+		goto err;
+  8053ec:	90                   	nop
+err:
+	return r;
+  8053ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8053f0:	48 83 c4 30          	add    $0x30,%rsp
+  8053f4:	5b                   	pop    %rbx
+  8053f5:	41 5f                	pop    %r15
+  8053f7:	5d                   	pop    %rbp
+  8053f8:	c3                   	ret
+
+00000000008053f9 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8053f9:	55                   	push   %rbp
+  8053fa:	48 89 e5             	mov    %rsp,%rbp
+  8053fd:	41 57                	push   %r15
+  8053ff:	41 54                	push   %r12
+  805401:	53                   	push   %rbx
+  805402:	48 83 ec 28          	sub    $0x28,%rsp
+  805406:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805406 <_pipeisclosed+0xd>
+  80540d:	49 bb 2a 3c 00 00 00 	movabs $0x3c2a,%r11
+  805414:	00 00 00 
+  805417:	4c 01 db             	add    %r11,%rbx
+  80541a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80541e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805422:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805429:	ff ff ff 
+  80542c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805430:	48 8b 00             	mov    (%rax),%rax
+  805433:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805439:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  80543c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805440:	48 89 c7             	mov    %rax,%rdi
+  805443:	49 89 df             	mov    %rbx,%r15
+  805446:	48 b8 d6 d5 ff ff ff 	movabs $0xffffffffffffd5d6,%rax
+  80544d:	ff ff ff 
+  805450:	48 01 d8             	add    %rbx,%rax
+  805453:	ff d0                	call   *%rax
+  805455:	41 89 c4             	mov    %eax,%r12d
+  805458:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80545c:	48 89 c7             	mov    %rax,%rdi
+  80545f:	49 89 df             	mov    %rbx,%r15
+  805462:	48 b8 d6 d5 ff ff ff 	movabs $0xffffffffffffd5d6,%rax
+  805469:	ff ff ff 
+  80546c:	48 01 d8             	add    %rbx,%rax
+  80546f:	ff d0                	call   *%rax
+  805471:	41 39 c4             	cmp    %eax,%r12d
+  805474:	0f 94 c0             	sete   %al
+  805477:	0f b6 c0             	movzbl %al,%eax
+  80547a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  80547d:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805484:	ff ff ff 
+  805487:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80548b:	48 8b 00             	mov    (%rax),%rax
+  80548e:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805494:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805497:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80549a:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80549d:	75 05                	jne    8054a4 <_pipeisclosed+0xab>
+			return ret;
+  80549f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8054a2:	eb 63                	jmp    805507 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  8054a4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054a7:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8054aa:	0f 84 72 ff ff ff    	je     805422 <_pipeisclosed+0x29>
+  8054b0:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  8054b4:	0f 85 68 ff ff ff    	jne    805422 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8054ba:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8054c1:	ff ff ff 
+  8054c4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8054c8:	48 8b 00             	mov    (%rax),%rax
+  8054cb:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8054d1:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8054d4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054d7:	89 c6                	mov    %eax,%esi
+  8054d9:	48 b8 36 dc ff ff ff 	movabs $0xffffffffffffdc36,%rax
+  8054e0:	ff ff ff 
+  8054e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054e7:	48 89 c7             	mov    %rax,%rdi
+  8054ea:	49 89 df             	mov    %rbx,%r15
+  8054ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054f2:	49 b8 98 74 ff ff ff 	movabs $0xffffffffffff7498,%r8
+  8054f9:	ff ff ff 
+  8054fc:	49 01 d8             	add    %rbx,%r8
+  8054ff:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805502:	e9 1b ff ff ff       	jmp    805422 <_pipeisclosed+0x29>
+	}
+}
+  805507:	48 83 c4 28          	add    $0x28,%rsp
+  80550b:	5b                   	pop    %rbx
+  80550c:	41 5c                	pop    %r12
+  80550e:	41 5f                	pop    %r15
+  805510:	5d                   	pop    %rbp
+  805511:	c3                   	ret
+
+0000000000805512 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805512:	55                   	push   %rbp
+  805513:	48 89 e5             	mov    %rsp,%rbp
+  805516:	41 57                	push   %r15
+  805518:	53                   	push   %rbx
+  805519:	48 83 ec 30          	sub    $0x30,%rsp
+  80551d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80551d <pipeisclosed+0xb>
+  805524:	49 bb 13 3b 00 00 00 	movabs $0x3b13,%r11
+  80552b:	00 00 00 
+  80552e:	4c 01 db             	add    %r11,%rbx
+  805531:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805534:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805538:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80553b:	48 89 d6             	mov    %rdx,%rsi
+  80553e:	89 c7                	mov    %eax,%edi
+  805540:	49 89 df             	mov    %rbx,%r15
+  805543:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  80554a:	ff ff ff 
+  80554d:	48 01 d8             	add    %rbx,%rax
+  805550:	ff d0                	call   *%rax
+  805552:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805555:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805559:	79 05                	jns    805560 <pipeisclosed+0x4e>
+		return r;
+  80555b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80555e:	eb 3b                	jmp    80559b <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805560:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805564:	48 89 c7             	mov    %rax,%rdi
+  805567:	49 89 df             	mov    %rbx,%r15
+  80556a:	48 b8 41 9a ff ff ff 	movabs $0xffffffffffff9a41,%rax
+  805571:	ff ff ff 
+  805574:	48 01 d8             	add    %rbx,%rax
+  805577:	ff d0                	call   *%rax
+  805579:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80557d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805581:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805585:	48 89 d6             	mov    %rdx,%rsi
+  805588:	48 89 c7             	mov    %rax,%rdi
+  80558b:	48 b8 c9 c3 ff ff ff 	movabs $0xffffffffffffc3c9,%rax
+  805592:	ff ff ff 
+  805595:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805599:	ff d0                	call   *%rax
+}
+  80559b:	48 83 c4 30          	add    $0x30,%rsp
+  80559f:	5b                   	pop    %rbx
+  8055a0:	41 5f                	pop    %r15
+  8055a2:	5d                   	pop    %rbp
+  8055a3:	c3                   	ret
+
+00000000008055a4 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8055a4:	55                   	push   %rbp
+  8055a5:	48 89 e5             	mov    %rsp,%rbp
+  8055a8:	41 57                	push   %r15
+  8055aa:	53                   	push   %rbx
+  8055ab:	48 83 ec 40          	sub    $0x40,%rsp
+  8055af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055af <devpipe_read+0xb>
+  8055b6:	49 bb 81 3a 00 00 00 	movabs $0x3a81,%r11
+  8055bd:	00 00 00 
+  8055c0:	4c 01 db             	add    %r11,%rbx
+  8055c3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8055c7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8055cb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8055cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055d3:	48 89 c7             	mov    %rax,%rdi
+  8055d6:	49 89 df             	mov    %rbx,%r15
+  8055d9:	48 b8 41 9a ff ff ff 	movabs $0xffffffffffff9a41,%rax
+  8055e0:	ff ff ff 
+  8055e3:	48 01 d8             	add    %rbx,%rax
+  8055e6:	ff d0                	call   *%rax
+  8055e8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8055ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8055f0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8055f4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8055fb:	00 
+  8055fc:	e9 a1 00 00 00       	jmp    8056a2 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805601:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805606:	74 09                	je     805611 <devpipe_read+0x6d>
+				return i;
+  805608:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80560c:	e9 9f 00 00 00       	jmp    8056b0 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805611:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805615:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805619:	48 89 d6             	mov    %rdx,%rsi
+  80561c:	48 89 c7             	mov    %rax,%rdi
+  80561f:	48 b8 c9 c3 ff ff ff 	movabs $0xffffffffffffc3c9,%rax
+  805626:	ff ff ff 
+  805629:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80562d:	ff d0                	call   *%rax
+  80562f:	85 c0                	test   %eax,%eax
+  805631:	74 07                	je     80563a <devpipe_read+0x96>
+				return 0;
+  805633:	b8 00 00 00 00       	mov    $0x0,%eax
+  805638:	eb 76                	jmp    8056b0 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  80563a:	49 89 df             	mov    %rbx,%r15
+  80563d:	48 b8 c1 8e ff ff ff 	movabs $0xffffffffffff8ec1,%rax
+  805644:	ff ff ff 
+  805647:	48 01 d8             	add    %rbx,%rax
+  80564a:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  80564c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805650:	8b 10                	mov    (%rax),%edx
+  805652:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805656:	8b 40 04             	mov    0x4(%rax),%eax
+  805659:	39 c2                	cmp    %eax,%edx
+  80565b:	74 a4                	je     805601 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80565d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805661:	8b 10                	mov    (%rax),%edx
+  805663:	89 d0                	mov    %edx,%eax
+  805665:	c1 f8 1f             	sar    $0x1f,%eax
+  805668:	c1 e8 1b             	shr    $0x1b,%eax
+  80566b:	01 c2                	add    %eax,%edx
+  80566d:	83 e2 1f             	and    $0x1f,%edx
+  805670:	29 c2                	sub    %eax,%edx
+  805672:	89 d6                	mov    %edx,%esi
+  805674:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805678:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80567c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805680:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805684:	48 63 c6             	movslq %esi,%rax
+  805687:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  80568c:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  80568e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805692:	8b 00                	mov    (%rax),%eax
+  805694:	8d 50 01             	lea    0x1(%rax),%edx
+  805697:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80569b:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80569d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8056a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056a6:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8056aa:	72 a0                	jb     80564c <devpipe_read+0xa8>
+	}
+	return i;
+  8056ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8056b0:	48 83 c4 40          	add    $0x40,%rsp
+  8056b4:	5b                   	pop    %rbx
+  8056b5:	41 5f                	pop    %r15
+  8056b7:	5d                   	pop    %rbp
+  8056b8:	c3                   	ret
+
+00000000008056b9 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8056b9:	55                   	push   %rbp
+  8056ba:	48 89 e5             	mov    %rsp,%rbp
+  8056bd:	41 57                	push   %r15
+  8056bf:	53                   	push   %rbx
+  8056c0:	48 83 ec 40          	sub    $0x40,%rsp
+  8056c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056c4 <devpipe_write+0xb>
+  8056cb:	49 bb 6c 39 00 00 00 	movabs $0x396c,%r11
+  8056d2:	00 00 00 
+  8056d5:	4c 01 db             	add    %r11,%rbx
+  8056d8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8056dc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8056e0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8056e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8056e8:	48 89 c7             	mov    %rax,%rdi
+  8056eb:	49 89 df             	mov    %rbx,%r15
+  8056ee:	48 b8 41 9a ff ff ff 	movabs $0xffffffffffff9a41,%rax
+  8056f5:	ff ff ff 
+  8056f8:	48 01 d8             	add    %rbx,%rax
+  8056fb:	ff d0                	call   *%rax
+  8056fd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805701:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805705:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805709:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805710:	00 
+  805711:	e9 a0 00 00 00       	jmp    8057b6 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805716:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80571a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80571e:	48 89 d6             	mov    %rdx,%rsi
+  805721:	48 89 c7             	mov    %rax,%rdi
+  805724:	48 b8 c9 c3 ff ff ff 	movabs $0xffffffffffffc3c9,%rax
+  80572b:	ff ff ff 
+  80572e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805732:	ff d0                	call   *%rax
+  805734:	85 c0                	test   %eax,%eax
+  805736:	74 0a                	je     805742 <devpipe_write+0x89>
+				return 0;
+  805738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80573d:	e9 82 00 00 00       	jmp    8057c4 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805742:	49 89 df             	mov    %rbx,%r15
+  805745:	48 b8 c1 8e ff ff ff 	movabs $0xffffffffffff8ec1,%rax
+  80574c:	ff ff ff 
+  80574f:	48 01 d8             	add    %rbx,%rax
+  805752:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805754:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805758:	8b 40 04             	mov    0x4(%rax),%eax
+  80575b:	48 63 d0             	movslq %eax,%rdx
+  80575e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805762:	8b 00                	mov    (%rax),%eax
+  805764:	48 98                	cltq
+  805766:	48 83 c0 20          	add    $0x20,%rax
+  80576a:	48 39 c2             	cmp    %rax,%rdx
+  80576d:	73 a7                	jae    805716 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80576f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805773:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805777:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80577b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80577f:	8b 50 04             	mov    0x4(%rax),%edx
+  805782:	89 d0                	mov    %edx,%eax
+  805784:	c1 f8 1f             	sar    $0x1f,%eax
+  805787:	c1 e8 1b             	shr    $0x1b,%eax
+  80578a:	01 c2                	add    %eax,%edx
+  80578c:	83 e2 1f             	and    $0x1f,%edx
+  80578f:	29 c2                	sub    %eax,%edx
+  805791:	89 d0                	mov    %edx,%eax
+  805793:	0f b6 09             	movzbl (%rcx),%ecx
+  805796:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80579a:	48 98                	cltq
+  80579c:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  8057a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057a4:	8b 40 04             	mov    0x4(%rax),%eax
+  8057a7:	8d 50 01             	lea    0x1(%rax),%edx
+  8057aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057ae:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8057b1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8057b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057ba:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8057be:	72 94                	jb     805754 <devpipe_write+0x9b>
+	}
+
+	return i;
+  8057c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8057c4:	48 83 c4 40          	add    $0x40,%rsp
+  8057c8:	5b                   	pop    %rbx
+  8057c9:	41 5f                	pop    %r15
+  8057cb:	5d                   	pop    %rbp
+  8057cc:	c3                   	ret
+
+00000000008057cd <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8057cd:	55                   	push   %rbp
+  8057ce:	48 89 e5             	mov    %rsp,%rbp
+  8057d1:	41 57                	push   %r15
+  8057d3:	53                   	push   %rbx
+  8057d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8057d8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057d8 <devpipe_stat+0xb>
+  8057df:	49 bb 58 38 00 00 00 	movabs $0x3858,%r11
+  8057e6:	00 00 00 
+  8057e9:	4c 01 db             	add    %r11,%rbx
+  8057ec:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8057f0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8057f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057f8:	48 89 c7             	mov    %rax,%rdi
+  8057fb:	49 89 df             	mov    %rbx,%r15
+  8057fe:	48 b8 41 9a ff ff ff 	movabs $0xffffffffffff9a41,%rax
+  805805:	ff ff ff 
+  805808:	48 01 d8             	add    %rbx,%rax
+  80580b:	ff d0                	call   *%rax
+  80580d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805811:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805815:	48 ba 49 dc ff ff ff 	movabs $0xffffffffffffdc49,%rdx
+  80581c:	ff ff ff 
+  80581f:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805823:	48 89 d6             	mov    %rdx,%rsi
+  805826:	48 89 c7             	mov    %rax,%rdi
+  805829:	49 89 df             	mov    %rbx,%r15
+  80582c:	48 b8 5a 82 ff ff ff 	movabs $0xffffffffffff825a,%rax
+  805833:	ff ff ff 
+  805836:	48 01 d8             	add    %rbx,%rax
+  805839:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80583b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80583f:	8b 50 04             	mov    0x4(%rax),%edx
+  805842:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805846:	8b 00                	mov    (%rax),%eax
+  805848:	29 c2                	sub    %eax,%edx
+  80584a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80584e:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805854:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805858:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80585f:	00 00 00 
+	stat->st_dev = &devpipe;
+  805862:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805866:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  80586d:	00 00 00 
+  805870:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805874:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80587b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805880:	48 83 c4 20          	add    $0x20,%rsp
+  805884:	5b                   	pop    %rbx
+  805885:	41 5f                	pop    %r15
+  805887:	5d                   	pop    %rbp
+  805888:	c3                   	ret
+
+0000000000805889 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805889:	55                   	push   %rbp
+  80588a:	48 89 e5             	mov    %rsp,%rbp
+  80588d:	41 57                	push   %r15
+  80588f:	53                   	push   %rbx
+  805890:	48 83 ec 10          	sub    $0x10,%rsp
+  805894:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805894 <devpipe_close+0xb>
+  80589b:	49 bb 9c 37 00 00 00 	movabs $0x379c,%r11
+  8058a2:	00 00 00 
+  8058a5:	4c 01 db             	add    %r11,%rbx
+  8058a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8058ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058b0:	48 89 c6             	mov    %rax,%rsi
+  8058b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058b8:	49 89 df             	mov    %rbx,%r15
+  8058bb:	48 b8 ee 8f ff ff ff 	movabs $0xffffffffffff8fee,%rax
+  8058c2:	ff ff ff 
+  8058c5:	48 01 d8             	add    %rbx,%rax
+  8058c8:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8058ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058ce:	48 89 c7             	mov    %rax,%rdi
+  8058d1:	49 89 df             	mov    %rbx,%r15
+  8058d4:	48 b8 41 9a ff ff ff 	movabs $0xffffffffffff9a41,%rax
+  8058db:	ff ff ff 
+  8058de:	48 01 d8             	add    %rbx,%rax
+  8058e1:	ff d0                	call   *%rax
+  8058e3:	48 89 c6             	mov    %rax,%rsi
+  8058e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058eb:	49 89 df             	mov    %rbx,%r15
+  8058ee:	48 b8 ee 8f ff ff ff 	movabs $0xffffffffffff8fee,%rax
+  8058f5:	ff ff ff 
+  8058f8:	48 01 d8             	add    %rbx,%rax
+  8058fb:	ff d0                	call   *%rax
+}
+  8058fd:	48 83 c4 10          	add    $0x10,%rsp
+  805901:	5b                   	pop    %rbx
+  805902:	41 5f                	pop    %r15
+  805904:	5d                   	pop    %rbp
+  805905:	c3                   	ret
+
+0000000000805906 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  805906:	55                   	push   %rbp
+  805907:	48 89 e5             	mov    %rsp,%rbp
+  80590a:	41 57                	push   %r15
+  80590c:	48 83 ec 28          	sub    $0x28,%rsp
+  805910:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805910 <cputchar+0xa>
+  805917:	49 bb 20 37 00 00 00 	movabs $0x3720,%r11
+  80591e:	00 00 00 
+  805921:	4c 01 d8             	add    %r11,%rax
+  805924:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  805927:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80592a:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  80592d:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  805931:	be 01 00 00 00       	mov    $0x1,%esi
+  805936:	48 89 d7             	mov    %rdx,%rdi
+  805939:	49 89 c7             	mov    %rax,%r15
+  80593c:	48 ba 5e 8d ff ff ff 	movabs $0xffffffffffff8d5e,%rdx
+  805943:	ff ff ff 
+  805946:	48 01 c2             	add    %rax,%rdx
+  805949:	ff d2                	call   *%rdx
+}
+  80594b:	90                   	nop
+  80594c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805950:	c9                   	leave
+  805951:	c3                   	ret
+
+0000000000805952 <getchar>:
+
+int
+getchar(void)
+{
+  805952:	55                   	push   %rbp
+  805953:	48 89 e5             	mov    %rsp,%rbp
+  805956:	41 57                	push   %r15
+  805958:	48 83 ec 18          	sub    $0x18,%rsp
+  80595c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80595c <getchar+0xa>
+  805963:	49 bb d4 36 00 00 00 	movabs $0x36d4,%r11
+  80596a:	00 00 00 
+  80596d:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805970:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805974:	ba 01 00 00 00       	mov    $0x1,%edx
+  805979:	48 89 ce             	mov    %rcx,%rsi
+  80597c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805981:	49 89 c7             	mov    %rax,%r15
+  805984:	48 b9 81 a0 ff ff ff 	movabs $0xffffffffffffa081,%rcx
+  80598b:	ff ff ff 
+  80598e:	48 01 c1             	add    %rax,%rcx
+  805991:	ff d1                	call   *%rcx
+  805993:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  805996:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80599a:	79 05                	jns    8059a1 <getchar+0x4f>
+		return r;
+  80599c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80599f:	eb 14                	jmp    8059b5 <getchar+0x63>
+	if (r < 1)
+  8059a1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059a5:	7f 07                	jg     8059ae <getchar+0x5c>
+		return -E_EOF;
+  8059a7:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8059ac:	eb 07                	jmp    8059b5 <getchar+0x63>
+	return c;
+  8059ae:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8059b2:	0f b6 c0             	movzbl %al,%eax
+}
+  8059b5:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8059b9:	c9                   	leave
+  8059ba:	c3                   	ret
+
+00000000008059bb <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8059bb:	55                   	push   %rbp
+  8059bc:	48 89 e5             	mov    %rsp,%rbp
+  8059bf:	41 57                	push   %r15
+  8059c1:	53                   	push   %rbx
+  8059c2:	48 83 ec 20          	sub    $0x20,%rsp
+  8059c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059c6 <iscons+0xb>
+  8059cd:	49 bb 6a 36 00 00 00 	movabs $0x366a,%r11
+  8059d4:	00 00 00 
+  8059d7:	4c 01 db             	add    %r11,%rbx
+  8059da:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8059dd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8059e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8059e4:	48 89 d6             	mov    %rdx,%rsi
+  8059e7:	89 c7                	mov    %eax,%edi
+  8059e9:	49 89 df             	mov    %rbx,%r15
+  8059ec:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  8059f3:	ff ff ff 
+  8059f6:	48 01 d8             	add    %rbx,%rax
+  8059f9:	ff d0                	call   *%rax
+  8059fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a02:	79 05                	jns    805a09 <iscons+0x4e>
+		return r;
+  805a04:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a07:	eb 1b                	jmp    805a24 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  805a09:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a0d:	8b 10                	mov    (%rax),%edx
+  805a0f:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  805a16:	00 00 00 
+  805a19:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805a1c:	39 c2                	cmp    %eax,%edx
+  805a1e:	0f 94 c0             	sete   %al
+  805a21:	0f b6 c0             	movzbl %al,%eax
+}
+  805a24:	48 83 c4 20          	add    $0x20,%rsp
+  805a28:	5b                   	pop    %rbx
+  805a29:	41 5f                	pop    %r15
+  805a2b:	5d                   	pop    %rbp
+  805a2c:	c3                   	ret
+
+0000000000805a2d <opencons>:
+
+int
+opencons(void)
+{
+  805a2d:	55                   	push   %rbp
+  805a2e:	48 89 e5             	mov    %rsp,%rbp
+  805a31:	41 57                	push   %r15
+  805a33:	53                   	push   %rbx
+  805a34:	48 83 ec 10          	sub    $0x10,%rsp
+  805a38:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a38 <opencons+0xb>
+  805a3f:	49 bb f8 35 00 00 00 	movabs $0x35f8,%r11
+  805a46:	00 00 00 
+  805a49:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805a4c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805a50:	48 89 c7             	mov    %rax,%rdi
+  805a53:	49 89 df             	mov    %rbx,%r15
+  805a56:	48 b8 84 9a ff ff ff 	movabs $0xffffffffffff9a84,%rax
+  805a5d:	ff ff ff 
+  805a60:	48 01 d8             	add    %rbx,%rax
+  805a63:	ff d0                	call   *%rax
+  805a65:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a68:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a6c:	79 05                	jns    805a73 <opencons+0x46>
+		return r;
+  805a6e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a71:	eb 68                	jmp    805adb <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805a73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a77:	ba 07 04 00 00       	mov    $0x407,%edx
+  805a7c:	48 89 c6             	mov    %rax,%rsi
+  805a7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a84:	49 89 df             	mov    %rbx,%r15
+  805a87:	48 b8 16 8f ff ff ff 	movabs $0xffffffffffff8f16,%rax
+  805a8e:	ff ff ff 
+  805a91:	48 01 d8             	add    %rbx,%rax
+  805a94:	ff d0                	call   *%rax
+  805a96:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a99:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a9d:	79 05                	jns    805aa4 <opencons+0x77>
+		return r;
+  805a9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805aa2:	eb 37                	jmp    805adb <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805aa4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805aa8:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  805aaf:	00 00 00 
+  805ab2:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805ab5:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  805ab7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805abb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805ac2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ac6:	48 89 c7             	mov    %rax,%rdi
+  805ac9:	49 89 df             	mov    %rbx,%r15
+  805acc:	48 b8 0a 9a ff ff ff 	movabs $0xffffffffffff9a0a,%rax
+  805ad3:	ff ff ff 
+  805ad6:	48 01 d8             	add    %rbx,%rax
+  805ad9:	ff d0                	call   *%rax
+}
+  805adb:	48 83 c4 10          	add    $0x10,%rsp
+  805adf:	5b                   	pop    %rbx
+  805ae0:	41 5f                	pop    %r15
+  805ae2:	5d                   	pop    %rbp
+  805ae3:	c3                   	ret
+
+0000000000805ae4 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805ae4:	55                   	push   %rbp
+  805ae5:	48 89 e5             	mov    %rsp,%rbp
+  805ae8:	41 57                	push   %r15
+  805aea:	53                   	push   %rbx
+  805aeb:	48 83 ec 30          	sub    $0x30,%rsp
+  805aef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805aef <devcons_read+0xb>
+  805af6:	49 bb 41 35 00 00 00 	movabs $0x3541,%r11
+  805afd:	00 00 00 
+  805b00:	4c 01 db             	add    %r11,%rbx
+  805b03:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805b07:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805b0b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  805b0f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805b14:	75 19                	jne    805b2f <devcons_read+0x4b>
+		return 0;
+  805b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b1b:	eb 55                	jmp    805b72 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  805b1d:	49 89 df             	mov    %rbx,%r15
+  805b20:	48 b8 c1 8e ff ff ff 	movabs $0xffffffffffff8ec1,%rax
+  805b27:	ff ff ff 
+  805b2a:	48 01 d8             	add    %rbx,%rax
+  805b2d:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  805b2f:	49 89 df             	mov    %rbx,%r15
+  805b32:	48 b8 bd 8d ff ff ff 	movabs $0xffffffffffff8dbd,%rax
+  805b39:	ff ff ff 
+  805b3c:	48 01 d8             	add    %rbx,%rax
+  805b3f:	ff d0                	call   *%rax
+  805b41:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b44:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b48:	74 d3                	je     805b1d <devcons_read+0x39>
+	if (c < 0)
+  805b4a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b4e:	79 05                	jns    805b55 <devcons_read+0x71>
+		return c;
+  805b50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b53:	eb 1d                	jmp    805b72 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  805b55:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  805b59:	75 07                	jne    805b62 <devcons_read+0x7e>
+		return 0;
+  805b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b60:	eb 10                	jmp    805b72 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805b62:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b65:	89 c2                	mov    %eax,%edx
+  805b67:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b6b:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805b6d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805b72:	48 83 c4 30          	add    $0x30,%rsp
+  805b76:	5b                   	pop    %rbx
+  805b77:	41 5f                	pop    %r15
+  805b79:	5d                   	pop    %rbp
+  805b7a:	c3                   	ret
+
+0000000000805b7b <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805b7b:	55                   	push   %rbp
+  805b7c:	48 89 e5             	mov    %rsp,%rbp
+  805b7f:	41 57                	push   %r15
+  805b81:	53                   	push   %rbx
+  805b82:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805b89:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b89 <devcons_write+0xe>
+  805b90:	49 bb a7 34 00 00 00 	movabs $0x34a7,%r11
+  805b97:	00 00 00 
+  805b9a:	4c 01 db             	add    %r11,%rbx
+  805b9d:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  805ba4:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  805bab:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805bb2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805bb9:	e9 80 00 00 00       	jmp    805c3e <devcons_write+0xc3>
+		m = n - tot;
+  805bbe:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805bc5:	89 c2                	mov    %eax,%edx
+  805bc7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bca:	29 c2                	sub    %eax,%edx
+  805bcc:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  805bcf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805bd2:	83 f8 7f             	cmp    $0x7f,%eax
+  805bd5:	76 07                	jbe    805bde <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  805bd7:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  805bde:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805be1:	48 63 d0             	movslq %eax,%rdx
+  805be4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805be7:	48 63 c8             	movslq %eax,%rcx
+  805bea:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  805bf1:	48 01 c1             	add    %rax,%rcx
+  805bf4:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805bfb:	48 89 ce             	mov    %rcx,%rsi
+  805bfe:	48 89 c7             	mov    %rax,%rdi
+  805c01:	49 89 df             	mov    %rbx,%r15
+  805c04:	48 b8 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rax
+  805c0b:	ff ff ff 
+  805c0e:	48 01 d8             	add    %rbx,%rax
+  805c11:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  805c13:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805c16:	48 63 d0             	movslq %eax,%rdx
+  805c19:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805c20:	48 89 d6             	mov    %rdx,%rsi
+  805c23:	48 89 c7             	mov    %rax,%rdi
+  805c26:	49 89 df             	mov    %rbx,%r15
+  805c29:	48 b8 5e 8d ff ff ff 	movabs $0xffffffffffff8d5e,%rax
+  805c30:	ff ff ff 
+  805c33:	48 01 d8             	add    %rbx,%rax
+  805c36:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  805c38:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805c3b:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805c3e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c41:	48 98                	cltq
+  805c43:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  805c4a:	0f 82 6e ff ff ff    	jb     805bbe <devcons_write+0x43>
+	}
+	return tot;
+  805c50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805c53:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  805c5a:	5b                   	pop    %rbx
+  805c5b:	41 5f                	pop    %r15
+  805c5d:	5d                   	pop    %rbp
+  805c5e:	c3                   	ret
+
+0000000000805c5f <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  805c5f:	55                   	push   %rbp
+  805c60:	48 89 e5             	mov    %rsp,%rbp
+  805c63:	48 83 ec 08          	sub    $0x8,%rsp
+  805c67:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805c67 <devcons_close+0x8>
+  805c6e:	49 bb c9 33 00 00 00 	movabs $0x33c9,%r11
+  805c75:	00 00 00 
+  805c78:	4c 01 d8             	add    %r11,%rax
+  805c7b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  805c7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c84:	c9                   	leave
+  805c85:	c3                   	ret
+
+0000000000805c86 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805c86:	55                   	push   %rbp
+  805c87:	48 89 e5             	mov    %rsp,%rbp
+  805c8a:	41 57                	push   %r15
+  805c8c:	48 83 ec 18          	sub    $0x18,%rsp
+  805c90:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805c90 <devcons_stat+0xa>
+  805c97:	49 bb a0 33 00 00 00 	movabs $0x33a0,%r11
+  805c9e:	00 00 00 
+  805ca1:	4c 01 d8             	add    %r11,%rax
+  805ca4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ca8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  805cac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805cb0:	48 b9 55 dc ff ff ff 	movabs $0xffffffffffffdc55,%rcx
+  805cb7:	ff ff ff 
+  805cba:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805cbe:	48 89 ce             	mov    %rcx,%rsi
+  805cc1:	48 89 d7             	mov    %rdx,%rdi
+  805cc4:	49 89 c7             	mov    %rax,%r15
+  805cc7:	48 ba 5a 82 ff ff ff 	movabs $0xffffffffffff825a,%rdx
+  805cce:	ff ff ff 
+  805cd1:	48 01 c2             	add    %rax,%rdx
+  805cd4:	ff d2                	call   *%rdx
+	return 0;
+  805cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805cdb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805cdf:	c9                   	leave
+  805ce0:	c3                   	ret
+
+0000000000805ce1 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  805ce1:	55                   	push   %rbp
+  805ce2:	48 89 e5             	mov    %rsp,%rbp
+  805ce5:	41 57                	push   %r15
+  805ce7:	41 54                	push   %r12
+  805ce9:	53                   	push   %rbx
+  805cea:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  805cf1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cf1 <_panic+0x10>
+  805cf8:	49 bb 3f 33 00 00 00 	movabs $0x333f,%r11
+  805cff:	00 00 00 
+  805d02:	4c 01 db             	add    %r11,%rbx
+  805d05:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  805d0c:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  805d12:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  805d19:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  805d20:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  805d27:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  805d2e:	84 c0                	test   %al,%al
+  805d30:	74 26                	je     805d58 <_panic+0x77>
+  805d32:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  805d39:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  805d40:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  805d44:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  805d48:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  805d4c:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  805d50:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  805d54:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  805d58:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  805d5f:	00 00 00 
+  805d62:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  805d69:	00 00 00 
+  805d6c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805d70:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  805d77:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  805d7e:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  805d85:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805d8c:	ff ff ff 
+  805d8f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d93:	4c 8b 20             	mov    (%rax),%r12
+  805d96:	49 89 df             	mov    %rbx,%r15
+  805d99:	48 b8 6d 8e ff ff ff 	movabs $0xffffffffffff8e6d,%rax
+  805da0:	ff ff ff 
+  805da3:	48 01 d8             	add    %rbx,%rax
+  805da6:	ff d0                	call   *%rax
+  805da8:	89 c6                	mov    %eax,%esi
+  805daa:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  805db0:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  805db7:	41 89 d0             	mov    %edx,%r8d
+  805dba:	48 89 c1             	mov    %rax,%rcx
+  805dbd:	4c 89 e2             	mov    %r12,%rdx
+  805dc0:	48 b8 60 dc ff ff ff 	movabs $0xffffffffffffdc60,%rax
+  805dc7:	ff ff ff 
+  805dca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dce:	48 89 c7             	mov    %rax,%rdi
+  805dd1:	49 89 df             	mov    %rbx,%r15
+  805dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dd9:	49 b9 98 74 ff ff ff 	movabs $0xffffffffffff7498,%r9
+  805de0:	ff ff ff 
+  805de3:	49 01 d9             	add    %rbx,%r9
+  805de6:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  805de9:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  805df0:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  805df7:	48 89 d6             	mov    %rdx,%rsi
+  805dfa:	48 89 c7             	mov    %rax,%rdi
+  805dfd:	49 89 df             	mov    %rbx,%r15
+  805e00:	48 b8 b8 73 ff ff ff 	movabs $0xffffffffffff73b8,%rax
+  805e07:	ff ff ff 
+  805e0a:	48 01 d8             	add    %rbx,%rax
+  805e0d:	ff d0                	call   *%rax
+	cprintf("\n");
+  805e0f:	48 b8 83 dc ff ff ff 	movabs $0xffffffffffffdc83,%rax
+  805e16:	ff ff ff 
+  805e19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e1d:	48 89 c7             	mov    %rax,%rdi
+  805e20:	49 89 df             	mov    %rbx,%r15
+  805e23:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e28:	48 ba 98 74 ff ff ff 	movabs $0xffffffffffff7498,%rdx
+  805e2f:	ff ff ff 
+  805e32:	48 01 da             	add    %rbx,%rdx
+  805e35:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  805e37:	cc                   	int3
+  805e38:	eb fd                	jmp    805e37 <_panic+0x156>
+
+0000000000805e3a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805e3a:	55                   	push   %rbp
+  805e3b:	48 89 e5             	mov    %rsp,%rbp
+  805e3e:	41 57                	push   %r15
+  805e40:	53                   	push   %rbx
+  805e41:	48 83 ec 30          	sub    $0x30,%rsp
+  805e45:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e45 <ipc_recv+0xb>
+  805e4c:	49 bb eb 31 00 00 00 	movabs $0x31eb,%r11
+  805e53:	00 00 00 
+  805e56:	4c 01 db             	add    %r11,%rbx
+  805e59:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805e5d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805e61:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  805e65:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805e6a:	75 0e                	jne    805e7a <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805e6c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805e73:	00 00 00 
+  805e76:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  805e7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e7e:	48 89 c7             	mov    %rax,%rdi
+  805e81:	49 89 df             	mov    %rbx,%r15
+  805e84:	48 b8 3f 92 ff ff ff 	movabs $0xffffffffffff923f,%rax
+  805e8b:	ff ff ff 
+  805e8e:	48 01 d8             	add    %rbx,%rax
+  805e91:	ff d0                	call   *%rax
+  805e93:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  805e96:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805e9b:	74 2a                	je     805ec7 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805e9d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ea1:	75 19                	jne    805ebc <ipc_recv+0x82>
+  805ea3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805eaa:	ff ff ff 
+  805ead:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805eb1:	48 8b 00             	mov    (%rax),%rax
+  805eb4:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805eba:	eb 05                	jmp    805ec1 <ipc_recv+0x87>
+  805ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ec1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805ec5:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  805ec7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805ecc:	74 2a                	je     805ef8 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805ece:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ed2:	75 19                	jne    805eed <ipc_recv+0xb3>
+  805ed4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805edb:	ff ff ff 
+  805ede:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ee2:	48 8b 00             	mov    (%rax),%rax
+  805ee5:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805eeb:	eb 05                	jmp    805ef2 <ipc_recv+0xb8>
+  805eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ef2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805ef6:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805ef8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805efc:	74 05                	je     805f03 <ipc_recv+0xc9>
+		return res;
+  805efe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f01:	eb 17                	jmp    805f1a <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805f03:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805f0a:	ff ff ff 
+  805f0d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f11:	48 8b 00             	mov    (%rax),%rax
+  805f14:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805f1a:	48 83 c4 30          	add    $0x30,%rsp
+  805f1e:	5b                   	pop    %rbx
+  805f1f:	41 5f                	pop    %r15
+  805f21:	5d                   	pop    %rbp
+  805f22:	c3                   	ret
+
+0000000000805f23 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805f23:	55                   	push   %rbp
+  805f24:	48 89 e5             	mov    %rsp,%rbp
+  805f27:	41 57                	push   %r15
+  805f29:	53                   	push   %rbx
+  805f2a:	48 83 ec 20          	sub    $0x20,%rsp
+  805f2e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f2e <ipc_send+0xb>
+  805f35:	49 bb 02 31 00 00 00 	movabs $0x3102,%r11
+  805f3c:	00 00 00 
+  805f3f:	4c 01 db             	add    %r11,%rbx
+  805f42:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805f45:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805f48:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805f4c:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805f4f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805f54:	75 0e                	jne    805f64 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805f56:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805f5d:	00 00 00 
+  805f60:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805f64:	90                   	nop
+  805f65:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805f68:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805f6b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f72:	89 c7                	mov    %eax,%edi
+  805f74:	49 89 df             	mov    %rbx,%r15
+  805f77:	48 b8 d5 91 ff ff ff 	movabs $0xffffffffffff91d5,%rax
+  805f7e:	ff ff ff 
+  805f81:	48 01 d8             	add    %rbx,%rax
+  805f84:	ff d0                	call   *%rax
+  805f86:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805f89:	74 da                	je     805f65 <ipc_send+0x42>
+		;
+}
+  805f8b:	90                   	nop
+  805f8c:	90                   	nop
+  805f8d:	48 83 c4 20          	add    $0x20,%rsp
+  805f91:	5b                   	pop    %rbx
+  805f92:	41 5f                	pop    %r15
+  805f94:	5d                   	pop    %rbp
+  805f95:	c3                   	ret
+
+0000000000805f96 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805f96:	55                   	push   %rbp
+  805f97:	48 89 e5             	mov    %rsp,%rbp
+  805f9a:	41 57                	push   %r15
+  805f9c:	53                   	push   %rbx
+  805f9d:	48 83 ec 40          	sub    $0x40,%rsp
+  805fa1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fa1 <ipc_call+0xb>
+  805fa8:	49 bb 8f 30 00 00 00 	movabs $0x308f,%r11
+  805faf:	00 00 00 
+  805fb2:	4c 01 db             	add    %r11,%rbx
+  805fb5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805fb8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805fbb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805fbf:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805fc2:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805fc6:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805fca:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805fcf:	75 0e                	jne    805fdf <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805fd1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805fd8:	00 00 00 
+  805fdb:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805fdf:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805fe4:	75 0e                	jne    805ff4 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805fe6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805fed:	00 00 00 
+  805ff0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805ff4:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805ff7:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805ffb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805ffe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806002:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806005:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80600b:	49 89 f8             	mov    %rdi,%r8
+  80600e:	89 c7                	mov    %eax,%edi
+  806010:	49 89 df             	mov    %rbx,%r15
+  806013:	48 b8 98 92 ff ff ff 	movabs $0xffffffffffff9298,%rax
+  80601a:	ff ff ff 
+  80601d:	48 01 d8             	add    %rbx,%rax
+  806020:	ff d0                	call   *%rax
+  806022:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806025:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80602a:	74 2a                	je     806056 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80602c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806030:	75 19                	jne    80604b <ipc_call+0xb5>
+  806032:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806039:	ff ff ff 
+  80603c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806040:	48 8b 00             	mov    (%rax),%rax
+  806043:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806049:	eb 05                	jmp    806050 <ipc_call+0xba>
+  80604b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806050:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806054:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806056:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80605a:	74 05                	je     806061 <ipc_call+0xcb>
+		return r;
+  80605c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80605f:	eb 17                	jmp    806078 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806061:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806068:	ff ff ff 
+  80606b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80606f:	48 8b 00             	mov    (%rax),%rax
+  806072:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806078:	48 83 c4 40          	add    $0x40,%rsp
+  80607c:	5b                   	pop    %rbx
+  80607d:	41 5f                	pop    %r15
+  80607f:	5d                   	pop    %rbp
+  806080:	c3                   	ret
+
+0000000000806081 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806081:	55                   	push   %rbp
+  806082:	48 89 e5             	mov    %rsp,%rbp
+  806085:	41 57                	push   %r15
+  806087:	53                   	push   %rbx
+  806088:	48 83 ec 70          	sub    $0x70,%rsp
+  80608c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80608c <ipc_callw+0xb>
+  806093:	49 bb a4 2f 00 00 00 	movabs $0x2fa4,%r11
+  80609a:	00 00 00 
+  80609d:	4c 01 db             	add    %r11,%rbx
+  8060a0:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8060a3:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8060a6:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8060aa:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8060ae:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8060b3:	76 0a                	jbe    8060bf <ipc_callw+0x3e>
+		return -E_INVAL;
+  8060b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8060ba:	e9 b7 00 00 00       	jmp    806176 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8060bf:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8060c3:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8060c7:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8060cb:	48 89 ce             	mov    %rcx,%rsi
+  8060ce:	48 89 c7             	mov    %rax,%rdi
+  8060d1:	49 89 df             	mov    %rbx,%r15
+  8060d4:	48 b8 3a 86 ff ff ff 	movabs $0xffffffffffff863a,%rax
+  8060db:	ff ff ff 
+  8060de:	48 01 d8             	add    %rbx,%rax
+  8060e1:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  8060e3:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8060ea:	00 
+  8060eb:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8060ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060f3:	48 01 d0             	add    %rdx,%rax
+  8060f6:	48 83 e8 01          	sub    $0x1,%rax
+  8060fa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8060fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806102:	ba 00 00 00 00       	mov    $0x0,%edx
+  806107:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80610b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80610f:	48 29 d0             	sub    %rdx,%rax
+  806112:	48 c1 e8 03          	shr    $0x3,%rax
+  806116:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  80611a:	89 c1                	mov    %eax,%ecx
+  80611c:	8b 75 98             	mov    -0x68(%rbp),%esi
+  80611f:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806123:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806126:	49 89 d1             	mov    %rdx,%r9
+  806129:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806130:	00 00 00 
+  806133:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  80613a:	00 00 00 
+  80613d:	89 c7                	mov    %eax,%edi
+  80613f:	49 89 df             	mov    %rbx,%r15
+  806142:	48 b8 98 92 ff ff ff 	movabs $0xffffffffffff9298,%rax
+  806149:	ff ff ff 
+  80614c:	48 01 d8             	add    %rbx,%rax
+  80614f:	ff d0                	call   *%rax
+  806151:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806154:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806158:	74 05                	je     80615f <ipc_callw+0xde>
+		return r;
+  80615a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80615d:	eb 17                	jmp    806176 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  80615f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806166:	ff ff ff 
+  806169:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80616d:	48 8b 00             	mov    (%rax),%rax
+  806170:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806176:	48 83 c4 70          	add    $0x70,%rsp
+  80617a:	5b                   	pop    %rbx
+  80617b:	41 5f                	pop    %r15
+  80617d:	5d                   	pop    %rbp
+  80617e:	c3                   	ret
+
+000000000080617f <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  80617f:	55                   	push   %rbp
+  806180:	48 89 e5             	mov    %rsp,%rbp
+  806183:	41 57                	push   %r15
+  806185:	53                   	push   %rbx
+  806186:	48 83 ec 40          	sub    $0x40,%rsp
+  80618a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80618a <ipc_callv+0xb>
+  806191:	49 bb a6 2e 00 00 00 	movabs $0x2ea6,%r11
+  806198:	00 00 00 
+  80619b:	4c 01 db             	add    %r11,%rbx
+  80619e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8061a1:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8061a4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8061a8:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8061ab:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8061af:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  8061b3:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8061ba:	00 00 00 
+  8061bd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  8061c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  8061c5:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8061c9:	74 11                	je     8061dc <ipc_callv+0x5d>
+		pg = (void *) segs;
+  8061cb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8061cf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  8061d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8061d6:	c1 e0 14             	shl    $0x14,%eax
+  8061d9:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  8061dc:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  8061e0:	74 14                	je     8061f6 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  8061e2:	8b 45 20             	mov    0x20(%rbp),%eax
+  8061e5:	83 e8 01             	sub    $0x1,%eax
+  8061e8:	48 63 d0             	movslq %eax,%rdx
+  8061eb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8061ef:	48 09 d0             	or     %rdx,%rax
+  8061f2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  8061f6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8061f9:	c1 e0 10             	shl    $0x10,%eax
+  8061fc:	0b 45 10             	or     0x10(%rbp),%eax
+  8061ff:	89 c1                	mov    %eax,%ecx
+  806201:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806204:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806208:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80620c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806210:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806213:	4d 89 c1             	mov    %r8,%r9
+  806216:	49 89 f8             	mov    %rdi,%r8
+  806219:	89 c7                	mov    %eax,%edi
+  80621b:	49 89 df             	mov    %rbx,%r15
+  80621e:	48 b8 98 92 ff ff ff 	movabs $0xffffffffffff9298,%rax
+  806225:	ff ff ff 
+  806228:	48 01 d8             	add    %rbx,%rax
+  80622b:	ff d0                	call   *%rax
+  80622d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806230:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806234:	74 05                	je     80623b <ipc_callv+0xbc>
+		return r;
+  806236:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806239:	eb 17                	jmp    806252 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  80623b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806242:	ff ff ff 
+  806245:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806249:	48 8b 00             	mov    (%rax),%rax
+  80624c:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806252:	48 83 c4 40          	add    $0x40,%rsp
+  806256:	5b                   	pop    %rbx
+  806257:	41 5f                	pop    %r15
+  806259:	5d                   	pop    %rbp
+  80625a:	c3                   	ret
+
+000000000080625b <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  80625b:	55                   	push   %rbp
+  80625c:	48 89 e5             	mov    %rsp,%rbp
+  80625f:	41 57                	push   %r15
+  806261:	53                   	push   %rbx
+  806262:	48 83 ec 40          	sub    $0x40,%rsp
+  806266:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806266 <ipc_reply_recv+0xb>
+  80626d:	49 bb ca 2d 00 00 00 	movabs $0x2dca,%r11
+  806274:	00 00 00 
+  806277:	4c 01 db             	add    %r11,%rbx
+  80627a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80627d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806280:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806284:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806287:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80628b:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80628f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806294:	75 0e                	jne    8062a4 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806296:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80629d:	00 00 00 
+  8062a0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8062a4:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8062a9:	75 0e                	jne    8062b9 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8062ab:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8062b2:	00 00 00 
+  8062b5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  8062b9:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8062bc:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  8062c0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8062c4:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8062c7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8062cb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8062ce:	4d 89 c1             	mov    %r8,%r9
+  8062d1:	49 89 f8             	mov    %rdi,%r8
+  8062d4:	89 c7                	mov    %eax,%edi
+  8062d6:	49 89 df             	mov    %rbx,%r15
+  8062d9:	48 b8 0c 93 ff ff ff 	movabs $0xffffffffffff930c,%rax
+  8062e0:	ff ff ff 
+  8062e3:	48 01 d8             	add    %rbx,%rax
+  8062e6:	ff d0                	call   *%rax
+  8062e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  8062eb:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8062f0:	74 2a                	je     80631c <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8062f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062f6:	75 19                	jne    806311 <ipc_reply_recv+0xb6>
+  8062f8:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8062ff:	ff ff ff 
+  806302:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806306:	48 8b 00             	mov    (%rax),%rax
+  806309:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80630f:	eb 05                	jmp    806316 <ipc_reply_recv+0xbb>
+  806311:	b8 00 00 00 00       	mov    $0x0,%eax
+  806316:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80631a:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  80631c:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806321:	74 2a                	je     80634d <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806323:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806327:	75 19                	jne    806342 <ipc_reply_recv+0xe7>
+  806329:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806330:	ff ff ff 
+  806333:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806337:	48 8b 00             	mov    (%rax),%rax
+  80633a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806340:	eb 05                	jmp    806347 <ipc_reply_recv+0xec>
+  806342:	b8 00 00 00 00       	mov    $0x0,%eax
+  806347:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  80634b:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  80634d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806351:	74 05                	je     806358 <ipc_reply_recv+0xfd>
+		return r;
+  806353:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806356:	eb 17                	jmp    80636f <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806358:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80635f:	ff ff ff 
+  806362:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806366:	48 8b 00             	mov    (%rax),%rax
+  806369:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80636f:	48 83 c4 40          	add    $0x40,%rsp
+  806373:	5b                   	pop    %rbx
+  806374:	41 5f                	pop    %r15
+  806376:	5d                   	pop    %rbp
+  806377:	c3                   	ret
+
+0000000000806378 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806378:	55                   	push   %rbp
+  806379:	48 89 e5             	mov    %rsp,%rbp
+  80637c:	41 57                	push   %r15
+  80637e:	53                   	push   %rbx
+  80637f:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806386:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806386 <ipc_window_batch+0xe>
+  80638d:	49 bb aa 2c 00 00 00 	movabs $0x2caa,%r11
+  806394:	00 00 00 
+  806397:	4c 01 db             	add    %r11,%rbx
+  80639a:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  8063a0:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  8063a7:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  8063ad:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  8063b3:	e9 15 01 00 00       	jmp    8064cd <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  8063b8:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  8063be:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8063c1:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  8063c8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8063cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8063ce:	39 c2                	cmp    %eax,%edx
+  8063d0:	0f 4e c2             	cmovle %edx,%eax
+  8063d3:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  8063d6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8063dd:	eb 6b                	jmp    80644a <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  8063df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063e2:	48 98                	cltq
+  8063e4:	48 c1 e0 05          	shl    $0x5,%rax
+  8063e8:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8063ec:	48 01 e8             	add    %rbp,%rax
+  8063ef:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  8063f5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  8063fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063fe:	c1 e0 0c             	shl    $0xc,%eax
+  806401:	48 63 d0             	movslq %eax,%rdx
+  806404:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  80640b:	48 01 c2             	add    %rax,%rdx
+  80640e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806411:	48 98                	cltq
+  806413:	48 c1 e0 05          	shl    $0x5,%rax
+  806417:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80641b:	48 01 e8             	add    %rbp,%rax
+  80641e:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806424:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806427:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80642a:	48 98                	cltq
+  80642c:	48 c1 e0 05          	shl    $0x5,%rax
+  806430:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806434:	48 01 e8             	add    %rbp,%rax
+  806437:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  80643e:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806444:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806446:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80644a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80644d:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806450:	7c 8d                	jl     8063df <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806452:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806459:	74 27                	je     806482 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  80645b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80645e:	48 63 d0             	movslq %eax,%rdx
+  806461:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806468:	48 89 d6             	mov    %rdx,%rsi
+  80646b:	48 89 c7             	mov    %rax,%rdi
+  80646e:	49 89 df             	mov    %rbx,%r15
+  806471:	48 b8 af 95 ff ff ff 	movabs $0xffffffffffff95af,%rax
+  806478:	ff ff ff 
+  80647b:	48 01 d8             	add    %rbx,%rax
+  80647e:	ff d0                	call   *%rax
+  806480:	eb 25                	jmp    8064a7 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806482:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806485:	48 63 d0             	movslq %eax,%rdx
+  806488:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  80648f:	48 89 d6             	mov    %rdx,%rsi
+  806492:	48 89 c7             	mov    %rax,%rdi
+  806495:	49 89 df             	mov    %rbx,%r15
+  806498:	48 b8 0d 96 ff ff ff 	movabs $0xffffffffffff960d,%rax
+  80649f:	ff ff ff 
+  8064a2:	48 01 d8             	add    %rbx,%rax
+  8064a5:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8064a7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  8064aa:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8064ae:	79 05                	jns    8064b5 <ipc_window_batch+0x13d>
+			return r;
+  8064b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8064b3:	eb 2a                	jmp    8064df <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  8064b5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8064b8:	c1 e0 0c             	shl    $0xc,%eax
+  8064bb:	48 98                	cltq
+  8064bd:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  8064c4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8064c7:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  8064cd:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  8064d4:	0f 8f de fe ff ff    	jg     8063b8 <ipc_window_batch+0x40>
+	}
+	return 0;
+  8064da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8064df:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  8064e6:	5b                   	pop    %rbx
+  8064e7:	41 5f                	pop    %r15
+  8064e9:	5d                   	pop    %rbp
+  8064ea:	c3                   	ret
+
+00000000008064eb <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  8064eb:	55                   	push   %rbp
+  8064ec:	48 89 e5             	mov    %rsp,%rbp
+  8064ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8064f3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064f3 <ipc_map_window+0x8>
+  8064fa:	49 bb 3d 2b 00 00 00 	movabs $0x2b3d,%r11
+  806501:	00 00 00 
+  806504:	4c 01 d8             	add    %r11,%rax
+  806507:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80650b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  80650e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806511:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806515:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80651a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80651f:	49 b8 48 d3 ff ff ff 	movabs $0xffffffffffffd348,%r8
+  806526:	ff ff ff 
+  806529:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80652d:	ff d0                	call   *%rax
+}
+  80652f:	c9                   	leave
+  806530:	c3                   	ret
+
+0000000000806531 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806531:	55                   	push   %rbp
+  806532:	48 89 e5             	mov    %rsp,%rbp
+  806535:	48 83 ec 10          	sub    $0x10,%rsp
+  806539:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806539 <ipc_unmap_window+0x8>
+  806540:	49 bb f7 2a 00 00 00 	movabs $0x2af7,%r11
+  806547:	00 00 00 
+  80654a:	4c 01 d8             	add    %r11,%rax
+  80654d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806551:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806554:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806557:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80655b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806560:	bf 00 00 00 00       	mov    $0x0,%edi
+  806565:	49 b8 48 d3 ff ff ff 	movabs $0xffffffffffffd348,%r8
+  80656c:	ff ff ff 
+  80656f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806573:	ff d0                	call   *%rax
+}
+  806575:	c9                   	leave
+  806576:	c3                   	ret
+
+0000000000806577 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806577:	55                   	push   %rbp
+  806578:	48 89 e5             	mov    %rsp,%rbp
+  80657b:	48 83 ec 18          	sub    $0x18,%rsp
+  80657f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80657f <ipc_find_env+0x8>
+  806586:	49 bb b1 2a 00 00 00 	movabs $0x2ab1,%r11
+  80658d:	00 00 00 
+  806590:	4c 01 d8             	add    %r11,%rax
+  806593:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806596:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80659d:	eb 57                	jmp    8065f6 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  80659f:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8065a6:	ff ff ff 
+  8065a9:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8065ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8065b0:	48 63 d2             	movslq %edx,%rdx
+  8065b3:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  8065ba:	48 01 ca             	add    %rcx,%rdx
+  8065bd:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  8065c4:	8b 12                	mov    (%rdx),%edx
+  8065c6:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  8065c9:	75 27                	jne    8065f2 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  8065cb:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8065d2:	ff ff ff 
+  8065d5:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8065d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8065dc:	48 98                	cltq
+  8065de:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8065e5:	48 01 d0             	add    %rdx,%rax
+  8065e8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8065ee:	8b 00                	mov    (%rax),%eax
+  8065f0:	eb 12                	jmp    806604 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  8065f2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8065f6:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8065fd:	7e a0                	jle    80659f <ipc_find_env+0x28>
+	}
+	return 0;
+  8065ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806604:	c9                   	leave
+  806605:	c3                   	ret
+
+0000000000806606 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806606:	55                   	push   %rbp
+  806607:	48 89 e5             	mov    %rsp,%rbp
+  80660a:	48 83 ec 18          	sub    $0x18,%rsp
+  80660e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80660e <pageref+0x8>
+  806615:	49 bb 22 2a 00 00 00 	movabs $0x2a22,%r11
+  80661c:	00 00 00 
+  80661f:	4c 01 d8             	add    %r11,%rax
+  806622:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806626:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80662a:	48 89 d1             	mov    %rdx,%rcx
+  80662d:	48 c1 e9 15          	shr    $0x15,%rcx
+  806631:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806638:	ff ff ff 
+  80663b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80663f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806643:	83 e2 01             	and    $0x1,%edx
+  806646:	48 85 d2             	test   %rdx,%rdx
+  806649:	75 07                	jne    806652 <pageref+0x4c>
+		return 0;
+  80664b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806650:	eb 64                	jmp    8066b6 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806652:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806656:	48 89 d1             	mov    %rdx,%rcx
+  806659:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80665d:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806664:	ff ff ff 
+  806667:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80666b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80666f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806673:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806677:	83 e2 01             	and    $0x1,%edx
+  80667a:	48 85 d2             	test   %rdx,%rdx
+  80667d:	75 07                	jne    806686 <pageref+0x80>
+		return 0;
+  80667f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806684:	eb 30                	jmp    8066b6 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806686:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80668a:	48 c1 ea 0c          	shr    $0xc,%rdx
+  80668e:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806695:	ff ff ff 
+  806698:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  80669c:	48 89 d0             	mov    %rdx,%rax
+  80669f:	48 01 c0             	add    %rax,%rax
+  8066a2:	48 01 d0             	add    %rdx,%rax
+  8066a5:	48 c1 e0 03          	shl    $0x3,%rax
+  8066a9:	48 01 c8             	add    %rcx,%rax
+  8066ac:	48 83 c0 08          	add    $0x8,%rax
+  8066b0:	0f b7 00             	movzwl (%rax),%eax
+  8066b3:	0f b7 c0             	movzwl %ax,%eax
+}
+  8066b6:	c9                   	leave
+  8066b7:	c3                   	ret
@@ -0,0 +1,9803 @@
+
+obj/user/num:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 53 03 00 00       	call   800394 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <num>:
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <num+0xb>
+  800055:	49 bb ea 7f 00 00 00 	movabs $0x7fea,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	long n;
+	int r;
+	char c;
+
+	while ((n = read(f, &c, 1)) > 0) {
+  800069:	e9 07 01 00 00       	jmp    800175 <num+0x132>
+		if (bol) {
+  80006e:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  800075:	ff ff ff 
+  800078:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80007b:	85 c0                	test   %eax,%eax
+  80007d:	74 65                	je     8000e4 <num+0xa1>
+			printf("%5d ", ++line);
+  80007f:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  800086:	00 00 00 
+  800089:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80008c:	8d 50 01             	lea    0x1(%rax),%edx
+  80008f:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  800096:	00 00 00 
+  800099:	89 14 03             	mov    %edx,(%rbx,%rax,1)
+  80009c:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8000a3:	00 00 00 
+  8000a6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8000a9:	89 c6                	mov    %eax,%esi
+  8000ab:	48 b8 90 e4 ff ff ff 	movabs $0xffffffffffffe490,%rax
+  8000b2:	ff ff ff 
+  8000b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000b9:	48 89 c7             	mov    %rax,%rdi
+  8000bc:	49 89 df             	mov    %rbx,%r15
+  8000bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c4:	48 ba ed c2 ff ff ff 	movabs $0xffffffffffffc2ed,%rdx
+  8000cb:	ff ff ff 
+  8000ce:	48 01 da             	add    %rbx,%rdx
+  8000d1:	ff d2                	call   *%rdx
+			bol = 0;
+  8000d3:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  8000da:	ff ff ff 
+  8000dd:	c7 04 03 00 00 00 00 	movl   $0x0,(%rbx,%rax,1)
+		}
+		if ((r = write(1, &c, 1)) != 1)
+  8000e4:	48 8d 45 e3          	lea    -0x1d(%rbp),%rax
+  8000e8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000ed:	48 89 c6             	mov    %rax,%rsi
+  8000f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000f5:	49 89 df             	mov    %rbx,%r15
+  8000f8:	48 b8 81 b1 ff ff ff 	movabs $0xffffffffffffb181,%rax
+  8000ff:	ff ff ff 
+  800102:	48 01 d8             	add    %rbx,%rax
+  800105:	ff d0                	call   *%rax
+  800107:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80010a:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80010e:	74 4c                	je     80015c <num+0x119>
+			panic("write error copying %s: %e", s, r);
+  800110:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800113:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800117:	41 89 d0             	mov    %edx,%r8d
+  80011a:	48 89 c1             	mov    %rax,%rcx
+  80011d:	48 b8 95 e4 ff ff ff 	movabs $0xffffffffffffe495,%rax
+  800124:	ff ff ff 
+  800127:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80012b:	48 89 c2             	mov    %rax,%rdx
+  80012e:	be 13 00 00 00       	mov    $0x13,%esi
+  800133:	48 b8 b0 e4 ff ff ff 	movabs $0xffffffffffffe4b0,%rax
+  80013a:	ff ff ff 
+  80013d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800141:	48 89 c7             	mov    %rax,%rdi
+  800144:	49 89 df             	mov    %rbx,%r15
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	49 b9 66 84 ff ff ff 	movabs $0xffffffffffff8466,%r9
+  800153:	ff ff ff 
+  800156:	49 01 d9             	add    %rbx,%r9
+  800159:	41 ff d1             	call   *%r9
+		if (c == '\n')
+  80015c:	0f b6 45 e3          	movzbl -0x1d(%rbp),%eax
+  800160:	3c 0a                	cmp    $0xa,%al
+  800162:	75 11                	jne    800175 <num+0x132>
+			bol = 1;
+  800164:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  80016b:	ff ff ff 
+  80016e:	c7 04 03 01 00 00 00 	movl   $0x1,(%rbx,%rax,1)
+	while ((n = read(f, &c, 1)) > 0) {
+  800175:	48 8d 4d e3          	lea    -0x1d(%rbp),%rcx
+  800179:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80017c:	ba 01 00 00 00       	mov    $0x1,%edx
+  800181:	48 89 ce             	mov    %rcx,%rsi
+  800184:	89 c7                	mov    %eax,%edi
+  800186:	49 89 df             	mov    %rbx,%r15
+  800189:	48 b8 db af ff ff ff 	movabs $0xffffffffffffafdb,%rax
+  800190:	ff ff ff 
+  800193:	48 01 d8             	add    %rbx,%rax
+  800196:	ff d0                	call   *%rax
+  800198:	48 98                	cltq
+  80019a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  80019e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8001a3:	0f 8f c5 fe ff ff    	jg     80006e <num+0x2b>
+	}
+	if (n < 0)
+  8001a9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8001ae:	79 4d                	jns    8001fd <num+0x1ba>
+		panic("error reading %s: %e", s, n);
+  8001b0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8001b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8001b8:	49 89 d0             	mov    %rdx,%r8
+  8001bb:	48 89 c1             	mov    %rax,%rcx
+  8001be:	48 b8 bb e4 ff ff ff 	movabs $0xffffffffffffe4bb,%rax
+  8001c5:	ff ff ff 
+  8001c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001cc:	48 89 c2             	mov    %rax,%rdx
+  8001cf:	be 18 00 00 00       	mov    $0x18,%esi
+  8001d4:	48 b8 b0 e4 ff ff ff 	movabs $0xffffffffffffe4b0,%rax
+  8001db:	ff ff ff 
+  8001de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001e2:	48 89 c7             	mov    %rax,%rdi
+  8001e5:	49 89 df             	mov    %rbx,%r15
+  8001e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ed:	49 b9 66 84 ff ff ff 	movabs $0xffffffffffff8466,%r9
+  8001f4:	ff ff ff 
+  8001f7:	49 01 d9             	add    %rbx,%r9
+  8001fa:	41 ff d1             	call   *%r9
+}
+  8001fd:	90                   	nop
+  8001fe:	48 83 c4 20          	add    $0x20,%rsp
+  800202:	5b                   	pop    %rbx
+  800203:	41 5f                	pop    %r15
+  800205:	5d                   	pop    %rbp
+  800206:	c3                   	ret
+
+0000000000800207 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800207:	55                   	push   %rbp
+  800208:	48 89 e5             	mov    %rsp,%rbp
+  80020b:	41 57                	push   %r15
+  80020d:	53                   	push   %rbx
+  80020e:	48 83 ec 20          	sub    $0x20,%rsp
+  800212:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800212 <umain+0xb>
+  800219:	49 bb 26 7e 00 00 00 	movabs $0x7e26,%r11
+  800220:	00 00 00 
+  800223:	4c 01 db             	add    %r11,%rbx
+  800226:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800229:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int f, i;
+
+	binaryname = "num";
+  80022d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  800234:	ff ff ff 
+  800237:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80023b:	48 ba d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rdx
+  800242:	ff ff ff 
+  800245:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800249:	48 89 10             	mov    %rdx,(%rax)
+	if (argc == 1)
+  80024c:	83 7d dc 01          	cmpl   $0x1,-0x24(%rbp)
+  800250:	75 2b                	jne    80027d <umain+0x76>
+		num(0, "<stdin>");
+  800252:	48 b8 d4 e4 ff ff ff 	movabs $0xffffffffffffe4d4,%rax
+  800259:	ff ff ff 
+  80025c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800260:	48 89 c6             	mov    %rax,%rsi
+  800263:	bf 00 00 00 00       	mov    $0x0,%edi
+  800268:	48 b8 0b 80 ff ff ff 	movabs $0xffffffffffff800b,%rax
+  80026f:	ff ff ff 
+  800272:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800276:	ff d0                	call   *%rax
+  800278:	e9 fb 00 00 00       	jmp    800378 <umain+0x171>
+	else
+		for (i = 1; i < argc; i++) {
+  80027d:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+  800284:	e9 e3 00 00 00       	jmp    80036c <umain+0x165>
+			f = open(argv[i], O_RDONLY);
+  800289:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80028c:	48 98                	cltq
+  80028e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800295:	00 
+  800296:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80029a:	48 01 d0             	add    %rdx,%rax
+  80029d:	48 8b 00             	mov    (%rax),%rax
+  8002a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a5:	48 89 c7             	mov    %rax,%rdi
+  8002a8:	49 89 df             	mov    %rbx,%r15
+  8002ab:	48 b8 aa b7 ff ff ff 	movabs $0xffffffffffffb7aa,%rax
+  8002b2:	ff ff ff 
+  8002b5:	48 01 d8             	add    %rbx,%rax
+  8002b8:	ff d0                	call   *%rax
+  8002ba:	89 45 e8             	mov    %eax,-0x18(%rbp)
+			if (f < 0)
+  8002bd:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8002c1:	79 5f                	jns    800322 <umain+0x11b>
+				panic("can't open %s: %e", argv[i], f);
+  8002c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002c6:	48 98                	cltq
+  8002c8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8002cf:	00 
+  8002d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8002d4:	48 01 d0             	add    %rdx,%rax
+  8002d7:	48 8b 00             	mov    (%rax),%rax
+  8002da:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8002dd:	41 89 d0             	mov    %edx,%r8d
+  8002e0:	48 89 c1             	mov    %rax,%rcx
+  8002e3:	48 b8 dc e4 ff ff ff 	movabs $0xffffffffffffe4dc,%rax
+  8002ea:	ff ff ff 
+  8002ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002f1:	48 89 c2             	mov    %rax,%rdx
+  8002f4:	be 27 00 00 00       	mov    $0x27,%esi
+  8002f9:	48 b8 b0 e4 ff ff ff 	movabs $0xffffffffffffe4b0,%rax
+  800300:	ff ff ff 
+  800303:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800307:	48 89 c7             	mov    %rax,%rdi
+  80030a:	49 89 df             	mov    %rbx,%r15
+  80030d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800312:	49 b9 66 84 ff ff ff 	movabs $0xffffffffffff8466,%r9
+  800319:	ff ff ff 
+  80031c:	49 01 d9             	add    %rbx,%r9
+  80031f:	41 ff d1             	call   *%r9
+			else {
+				num(f, argv[i]);
+  800322:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800325:	48 98                	cltq
+  800327:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80032e:	00 
+  80032f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800333:	48 01 d0             	add    %rdx,%rax
+  800336:	48 8b 10             	mov    (%rax),%rdx
+  800339:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80033c:	48 89 d6             	mov    %rdx,%rsi
+  80033f:	89 c7                	mov    %eax,%edi
+  800341:	48 b8 0b 80 ff ff ff 	movabs $0xffffffffffff800b,%rax
+  800348:	ff ff ff 
+  80034b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80034f:	ff d0                	call   *%rax
+				close(f);
+  800351:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800354:	89 c7                	mov    %eax,%edi
+  800356:	49 89 df             	mov    %rbx,%r15
+  800359:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  800360:	ff ff ff 
+  800363:	48 01 d8             	add    %rbx,%rax
+  800366:	ff d0                	call   *%rax
+		for (i = 1; i < argc; i++) {
+  800368:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80036c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80036f:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  800372:	0f 8c 11 ff ff ff    	jl     800289 <umain+0x82>
+			}
+		}
+	exit();
+  800378:	49 89 df             	mov    %rbx,%r15
+  80037b:	48 b8 1c 84 ff ff ff 	movabs $0xffffffffffff841c,%rax
+  800382:	ff ff ff 
+  800385:	48 01 d8             	add    %rbx,%rax
+  800388:	ff d0                	call   *%rax
+}
+  80038a:	90                   	nop
+  80038b:	48 83 c4 20          	add    $0x20,%rsp
+  80038f:	5b                   	pop    %rbx
+  800390:	41 5f                	pop    %r15
+  800392:	5d                   	pop    %rbp
+  800393:	c3                   	ret
+
+0000000000800394 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800394:	55                   	push   %rbp
+  800395:	48 89 e5             	mov    %rsp,%rbp
+  800398:	41 57                	push   %r15
+  80039a:	53                   	push   %rbx
+  80039b:	48 83 ec 20          	sub    $0x20,%rsp
+  80039f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80039f <libmain+0xb>
+  8003a6:	49 bb 99 7c 00 00 00 	movabs $0x7c99,%r11
+  8003ad:	00 00 00 
+  8003b0:	4c 01 db             	add    %r11,%rbx
+  8003b3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8003b6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8003ba:	49 89 df             	mov    %rbx,%r15
+  8003bd:	48 b8 12 a1 ff ff ff 	movabs $0xffffffffffffa112,%rax
+  8003c4:	ff ff ff 
+  8003c7:	48 01 d8             	add    %rbx,%rax
+  8003ca:	ff d0                	call   *%rax
+  8003cc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8003cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003d2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003d7:	48 98                	cltq
+  8003d9:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8003e0:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8003e7:	ff ff ff 
+  8003ea:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8003ee:	48 01 c2             	add    %rax,%rdx
+  8003f1:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8003f8:	00 00 00 
+  8003fb:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003ff:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800403:	7e 15                	jle    80041a <libmain+0x86>
+		binaryname = argv[0];
+  800405:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800409:	48 8b 00             	mov    (%rax),%rax
+  80040c:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  800413:	00 00 00 
+  800416:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80041a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80041e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800421:	48 89 d6             	mov    %rdx,%rsi
+  800424:	89 c7                	mov    %eax,%edi
+  800426:	49 89 df             	mov    %rbx,%r15
+  800429:	48 b8 cf 81 ff ff ff 	movabs $0xffffffffffff81cf,%rax
+  800430:	ff ff ff 
+  800433:	48 01 d8             	add    %rbx,%rax
+  800436:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800438:	49 89 df             	mov    %rbx,%r15
+  80043b:	48 b8 1c 84 ff ff ff 	movabs $0xffffffffffff841c,%rax
+  800442:	ff ff ff 
+  800445:	48 01 d8             	add    %rbx,%rax
+  800448:	ff d0                	call   *%rax
+}
+  80044a:	90                   	nop
+  80044b:	48 83 c4 20          	add    $0x20,%rsp
+  80044f:	5b                   	pop    %rbx
+  800450:	41 5f                	pop    %r15
+  800452:	5d                   	pop    %rbp
+  800453:	c3                   	ret
+
+0000000000800454 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800454:	55                   	push   %rbp
+  800455:	48 89 e5             	mov    %rsp,%rbp
+  800458:	41 57                	push   %r15
+  80045a:	53                   	push   %rbx
+  80045b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80045b <exit+0x7>
+  800462:	49 bb dd 7b 00 00 00 	movabs $0x7bdd,%r11
+  800469:	00 00 00 
+  80046c:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80046f:	49 89 df             	mov    %rbx,%r15
+  800472:	48 b8 8f ad ff ff ff 	movabs $0xffffffffffffad8f,%rax
+  800479:	ff ff ff 
+  80047c:	48 01 d8             	add    %rbx,%rax
+  80047f:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800481:	bf 00 00 00 00       	mov    $0x0,%edi
+  800486:	49 89 df             	mov    %rbx,%r15
+  800489:	48 b8 b6 a0 ff ff ff 	movabs $0xffffffffffffa0b6,%rax
+  800490:	ff ff ff 
+  800493:	48 01 d8             	add    %rbx,%rax
+  800496:	ff d0                	call   *%rax
+}
+  800498:	90                   	nop
+  800499:	5b                   	pop    %rbx
+  80049a:	41 5f                	pop    %r15
+  80049c:	5d                   	pop    %rbp
+  80049d:	c3                   	ret
+
+000000000080049e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80049e:	55                   	push   %rbp
+  80049f:	48 89 e5             	mov    %rsp,%rbp
+  8004a2:	41 57                	push   %r15
+  8004a4:	41 54                	push   %r12
+  8004a6:	53                   	push   %rbx
+  8004a7:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8004ae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004ae <_panic+0x10>
+  8004b5:	49 bb 8a 7b 00 00 00 	movabs $0x7b8a,%r11
+  8004bc:	00 00 00 
+  8004bf:	4c 01 db             	add    %r11,%rbx
+  8004c2:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004c9:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8004cf:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8004d6:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8004dd:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8004e4:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8004eb:	84 c0                	test   %al,%al
+  8004ed:	74 26                	je     800515 <_panic+0x77>
+  8004ef:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8004f6:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8004fd:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800501:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800505:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800509:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80050d:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800511:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800515:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80051c:	00 00 00 
+  80051f:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800526:	00 00 00 
+  800529:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80052d:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800534:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80053b:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800542:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  800549:	ff ff ff 
+  80054c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800550:	4c 8b 20             	mov    (%rax),%r12
+  800553:	49 89 df             	mov    %rbx,%r15
+  800556:	48 b8 12 a1 ff ff ff 	movabs $0xffffffffffffa112,%rax
+  80055d:	ff ff ff 
+  800560:	48 01 d8             	add    %rbx,%rax
+  800563:	ff d0                	call   *%rax
+  800565:	89 c6                	mov    %eax,%esi
+  800567:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80056d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800574:	41 89 d0             	mov    %edx,%r8d
+  800577:	48 89 c1             	mov    %rax,%rcx
+  80057a:	4c 89 e2             	mov    %r12,%rdx
+  80057d:	48 b8 f8 e4 ff ff ff 	movabs $0xffffffffffffe4f8,%rax
+  800584:	ff ff ff 
+  800587:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80058b:	48 89 c7             	mov    %rax,%rdi
+  80058e:	49 89 df             	mov    %rbx,%r15
+  800591:	b8 00 00 00 00       	mov    $0x0,%eax
+  800596:	49 b9 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%r9
+  80059d:	ff ff ff 
+  8005a0:	49 01 d9             	add    %rbx,%r9
+  8005a3:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005a6:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8005ad:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8005b4:	48 89 d6             	mov    %rdx,%rsi
+  8005b7:	48 89 c7             	mov    %rax,%rdi
+  8005ba:	49 89 df             	mov    %rbx,%r15
+  8005bd:	48 b8 5d 86 ff ff ff 	movabs $0xffffffffffff865d,%rax
+  8005c4:	ff ff ff 
+  8005c7:	48 01 d8             	add    %rbx,%rax
+  8005ca:	ff d0                	call   *%rax
+	cprintf("\n");
+  8005cc:	48 b8 1b e5 ff ff ff 	movabs $0xffffffffffffe51b,%rax
+  8005d3:	ff ff ff 
+  8005d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005da:	48 89 c7             	mov    %rax,%rdi
+  8005dd:	49 89 df             	mov    %rbx,%r15
+  8005e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e5:	48 ba 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%rdx
+  8005ec:	ff ff ff 
+  8005ef:	48 01 da             	add    %rbx,%rdx
+  8005f2:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8005f4:	cc                   	int3
+  8005f5:	eb fd                	jmp    8005f4 <_panic+0x156>
+
+00000000008005f7 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8005f7:	55                   	push   %rbp
+  8005f8:	48 89 e5             	mov    %rsp,%rbp
+  8005fb:	41 57                	push   %r15
+  8005fd:	48 83 ec 18          	sub    $0x18,%rsp
+  800601:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800601 <putch+0xa>
+  800608:	49 bb 37 7a 00 00 00 	movabs $0x7a37,%r11
+  80060f:	00 00 00 
+  800612:	4c 01 d8             	add    %r11,%rax
+  800615:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800618:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80061c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800620:	8b 12                	mov    (%rdx),%edx
+  800622:	8d 72 01             	lea    0x1(%rdx),%esi
+  800625:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800629:	89 31                	mov    %esi,(%rcx)
+  80062b:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80062e:	89 ce                	mov    %ecx,%esi
+  800630:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800634:	48 63 d2             	movslq %edx,%rdx
+  800637:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80063c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800640:	8b 12                	mov    (%rdx),%edx
+  800642:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800648:	75 33                	jne    80067d <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80064a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80064e:	8b 12                	mov    (%rdx),%edx
+  800650:	48 63 d2             	movslq %edx,%rdx
+  800653:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800657:	48 83 c1 08          	add    $0x8,%rcx
+  80065b:	48 89 d6             	mov    %rdx,%rsi
+  80065e:	48 89 cf             	mov    %rcx,%rdi
+  800661:	49 89 c7             	mov    %rax,%r15
+  800664:	48 ba 03 a0 ff ff ff 	movabs $0xffffffffffffa003,%rdx
+  80066b:	ff ff ff 
+  80066e:	48 01 c2             	add    %rax,%rdx
+  800671:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800673:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800677:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80067d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800681:	8b 40 04             	mov    0x4(%rax),%eax
+  800684:	8d 50 01             	lea    0x1(%rax),%edx
+  800687:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80068b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80068e:	90                   	nop
+  80068f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800693:	c9                   	leave
+  800694:	c3                   	ret
+
+0000000000800695 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800695:	55                   	push   %rbp
+  800696:	48 89 e5             	mov    %rsp,%rbp
+  800699:	41 57                	push   %r15
+  80069b:	53                   	push   %rbx
+  80069c:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8006a3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006a3 <vcprintf+0xe>
+  8006aa:	49 bb 95 79 00 00 00 	movabs $0x7995,%r11
+  8006b1:	00 00 00 
+  8006b4:	4c 01 db             	add    %r11,%rbx
+  8006b7:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8006be:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8006c5:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006cc:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8006d3:	48 8b 06             	mov    (%rsi),%rax
+  8006d6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006da:	48 89 01             	mov    %rax,(%rcx)
+  8006dd:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006e1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006e5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8006e9:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8006f0:	00 00 00 
+    b.cnt = 0;
+  8006f3:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8006fa:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8006fd:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800704:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80070b:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800712:	48 89 c6             	mov    %rax,%rsi
+  800715:	48 b8 bf 85 ff ff ff 	movabs $0xffffffffffff85bf,%rax
+  80071c:	ff ff ff 
+  80071f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800723:	48 89 c7             	mov    %rax,%rdi
+  800726:	49 89 df             	mov    %rbx,%r15
+  800729:	48 b8 81 8b ff ff ff 	movabs $0xffffffffffff8b81,%rax
+  800730:	ff ff ff 
+  800733:	48 01 d8             	add    %rbx,%rax
+  800736:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800738:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80073e:	48 98                	cltq
+  800740:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800747:	48 83 c2 08          	add    $0x8,%rdx
+  80074b:	48 89 c6             	mov    %rax,%rsi
+  80074e:	48 89 d7             	mov    %rdx,%rdi
+  800751:	49 89 df             	mov    %rbx,%r15
+  800754:	48 b8 03 a0 ff ff ff 	movabs $0xffffffffffffa003,%rax
+  80075b:	ff ff ff 
+  80075e:	48 01 d8             	add    %rbx,%rax
+  800761:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800763:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800769:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800770:	5b                   	pop    %rbx
+  800771:	41 5f                	pop    %r15
+  800773:	5d                   	pop    %rbp
+  800774:	c3                   	ret
+
+0000000000800775 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800775:	55                   	push   %rbp
+  800776:	48 89 e5             	mov    %rsp,%rbp
+  800779:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800780:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800780 <cprintf+0xb>
+  800787:	49 bb b8 78 00 00 00 	movabs $0x78b8,%r11
+  80078e:	00 00 00 
+  800791:	4d 01 da             	add    %r11,%r10
+  800794:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80079b:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8007a2:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8007a9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8007b0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8007b7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8007be:	84 c0                	test   %al,%al
+  8007c0:	74 20                	je     8007e2 <cprintf+0x6d>
+  8007c2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8007c6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8007ca:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8007ce:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8007d2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8007d6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8007da:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8007de:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8007e2:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8007e9:	00 00 00 
+  8007ec:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8007f3:	00 00 00 
+  8007f6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007fa:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800801:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800808:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  80080f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800816:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80081d:	48 8b 06             	mov    (%rsi),%rax
+  800820:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800824:	48 89 01             	mov    %rax,(%rcx)
+  800827:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80082b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80082f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800833:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80083a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800841:	48 89 d6             	mov    %rdx,%rsi
+  800844:	48 89 c7             	mov    %rax,%rdi
+  800847:	48 b8 5d 86 ff ff ff 	movabs $0xffffffffffff865d,%rax
+  80084e:	ff ff ff 
+  800851:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800855:	ff d0                	call   *%rax
+  800857:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80085d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800863:	c9                   	leave
+  800864:	c3                   	ret
+
+0000000000800865 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800865:	55                   	push   %rbp
+  800866:	48 89 e5             	mov    %rsp,%rbp
+  800869:	53                   	push   %rbx
+  80086a:	48 83 ec 38          	sub    $0x38,%rsp
+  80086e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80086e <printnum+0x9>
+  800875:	49 bb ca 77 00 00 00 	movabs $0x77ca,%r11
+  80087c:	00 00 00 
+  80087f:	4c 01 db             	add    %r11,%rbx
+  800882:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800886:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80088a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80088e:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800891:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800895:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800899:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80089c:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8008a0:	72 58                	jb     8008fa <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8008a2:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8008a5:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8008a8:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8008ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008b4:	48 f7 f6             	div    %rsi
+  8008b7:	49 89 c2             	mov    %rax,%r10
+  8008ba:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8008bd:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8008c0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8008c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008c8:	41 89 c9             	mov    %ecx,%r9d
+  8008cb:	41 89 f8             	mov    %edi,%r8d
+  8008ce:	89 d1                	mov    %edx,%ecx
+  8008d0:	4c 89 d2             	mov    %r10,%rdx
+  8008d3:	48 89 c7             	mov    %rax,%rdi
+  8008d6:	48 b8 2d 88 ff ff ff 	movabs $0xffffffffffff882d,%rax
+  8008dd:	ff ff ff 
+  8008e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008e4:	ff d0                	call   *%rax
+  8008e6:	eb 1c                	jmp    800904 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8008e8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008ec:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8008ef:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8008f3:	48 89 d6             	mov    %rdx,%rsi
+  8008f6:	89 c7                	mov    %eax,%edi
+  8008f8:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8008fa:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8008fe:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800902:	7f e4                	jg     8008e8 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800904:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800907:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80090b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800910:	48 f7 f1             	div    %rcx
+  800913:	48 b8 57 e6 ff ff ff 	movabs $0xffffffffffffe657,%rax
+  80091a:	ff ff ff 
+  80091d:	48 01 d8             	add    %rbx,%rax
+  800920:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800924:	0f be c0             	movsbl %al,%eax
+  800927:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80092b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80092f:	48 89 d6             	mov    %rdx,%rsi
+  800932:	89 c7                	mov    %eax,%edi
+  800934:	ff d1                	call   *%rcx
+}
+  800936:	90                   	nop
+  800937:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80093b:	c9                   	leave
+  80093c:	c3                   	ret
+
+000000000080093d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80093d:	55                   	push   %rbp
+  80093e:	48 89 e5             	mov    %rsp,%rbp
+  800941:	48 83 ec 20          	sub    $0x20,%rsp
+  800945:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800945 <getuint+0x8>
+  80094c:	49 bb f3 76 00 00 00 	movabs $0x76f3,%r11
+  800953:	00 00 00 
+  800956:	4c 01 d8             	add    %r11,%rax
+  800959:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80095d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800960:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800964:	7e 4f                	jle    8009b5 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800966:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80096a:	8b 00                	mov    (%rax),%eax
+  80096c:	83 f8 2f             	cmp    $0x2f,%eax
+  80096f:	77 24                	ja     800995 <getuint+0x58>
+  800971:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800975:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800979:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80097d:	8b 00                	mov    (%rax),%eax
+  80097f:	89 c0                	mov    %eax,%eax
+  800981:	48 01 d0             	add    %rdx,%rax
+  800984:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800988:	8b 12                	mov    (%rdx),%edx
+  80098a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80098d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800991:	89 0a                	mov    %ecx,(%rdx)
+  800993:	eb 14                	jmp    8009a9 <getuint+0x6c>
+  800995:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800999:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80099d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009a1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009a5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009a9:	48 8b 00             	mov    (%rax),%rax
+  8009ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009b0:	e9 9d 00 00 00       	jmp    800a52 <getuint+0x115>
+	else if (lflag)
+  8009b5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8009b9:	74 4c                	je     800a07 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8009bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009bf:	8b 00                	mov    (%rax),%eax
+  8009c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c4:	77 24                	ja     8009ea <getuint+0xad>
+  8009c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ca:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009d2:	8b 00                	mov    (%rax),%eax
+  8009d4:	89 c0                	mov    %eax,%eax
+  8009d6:	48 01 d0             	add    %rdx,%rax
+  8009d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009dd:	8b 12                	mov    (%rdx),%edx
+  8009df:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009e2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009e6:	89 0a                	mov    %ecx,(%rdx)
+  8009e8:	eb 14                	jmp    8009fe <getuint+0xc1>
+  8009ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ee:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009f2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009fa:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009fe:	48 8b 00             	mov    (%rax),%rax
+  800a01:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a05:	eb 4b                	jmp    800a52 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800a07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a0b:	8b 00                	mov    (%rax),%eax
+  800a0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a10:	77 24                	ja     800a36 <getuint+0xf9>
+  800a12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a16:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a1e:	8b 00                	mov    (%rax),%eax
+  800a20:	89 c0                	mov    %eax,%eax
+  800a22:	48 01 d0             	add    %rdx,%rax
+  800a25:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a29:	8b 12                	mov    (%rdx),%edx
+  800a2b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a2e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a32:	89 0a                	mov    %ecx,(%rdx)
+  800a34:	eb 14                	jmp    800a4a <getuint+0x10d>
+  800a36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a3a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a3e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a42:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a46:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a4a:	8b 00                	mov    (%rax),%eax
+  800a4c:	89 c0                	mov    %eax,%eax
+  800a4e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a56:	c9                   	leave
+  800a57:	c3                   	ret
+
+0000000000800a58 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800a58:	55                   	push   %rbp
+  800a59:	48 89 e5             	mov    %rsp,%rbp
+  800a5c:	48 83 ec 20          	sub    $0x20,%rsp
+  800a60:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a60 <printfloat+0x8>
+  800a67:	49 bb d8 75 00 00 00 	movabs $0x75d8,%r11
+  800a6e:	00 00 00 
+  800a71:	4c 01 d8             	add    %r11,%rax
+  800a74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a78:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a7c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800a80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a84:	48 85 c0             	test   %rax,%rax
+  800a87:	79 12                	jns    800a9b <printfloat+0x43>
+		putch('-',putdat);
+  800a89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a8d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a91:	48 89 c6             	mov    %rax,%rsi
+  800a94:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a99:	ff d2                	call   *%rdx
+	
+}
+  800a9b:	90                   	nop
+  800a9c:	c9                   	leave
+  800a9d:	c3                   	ret
+
+0000000000800a9e <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800a9e:	55                   	push   %rbp
+  800a9f:	48 89 e5             	mov    %rsp,%rbp
+  800aa2:	48 83 ec 20          	sub    $0x20,%rsp
+  800aa6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800aa6 <getint+0x8>
+  800aad:	49 bb 92 75 00 00 00 	movabs $0x7592,%r11
+  800ab4:	00 00 00 
+  800ab7:	4c 01 d8             	add    %r11,%rax
+  800aba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800abe:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800ac1:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800ac5:	7e 4f                	jle    800b16 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800ac7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800acb:	8b 00                	mov    (%rax),%eax
+  800acd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad0:	77 24                	ja     800af6 <getint+0x58>
+  800ad2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ada:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ade:	8b 00                	mov    (%rax),%eax
+  800ae0:	89 c0                	mov    %eax,%eax
+  800ae2:	48 01 d0             	add    %rdx,%rax
+  800ae5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ae9:	8b 12                	mov    (%rdx),%edx
+  800aeb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800aee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800af2:	89 0a                	mov    %ecx,(%rdx)
+  800af4:	eb 14                	jmp    800b0a <getint+0x6c>
+  800af6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800afe:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b02:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b06:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b0a:	48 8b 00             	mov    (%rax),%rax
+  800b0d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b11:	e9 9d 00 00 00       	jmp    800bb3 <getint+0x115>
+	else if (lflag)
+  800b16:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800b1a:	74 4c                	je     800b68 <getint+0xca>
+		x=va_arg(*ap, long);
+  800b1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b20:	8b 00                	mov    (%rax),%eax
+  800b22:	83 f8 2f             	cmp    $0x2f,%eax
+  800b25:	77 24                	ja     800b4b <getint+0xad>
+  800b27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b2b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b33:	8b 00                	mov    (%rax),%eax
+  800b35:	89 c0                	mov    %eax,%eax
+  800b37:	48 01 d0             	add    %rdx,%rax
+  800b3a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b3e:	8b 12                	mov    (%rdx),%edx
+  800b40:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b43:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b47:	89 0a                	mov    %ecx,(%rdx)
+  800b49:	eb 14                	jmp    800b5f <getint+0xc1>
+  800b4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b53:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b57:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b5b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b5f:	48 8b 00             	mov    (%rax),%rax
+  800b62:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b66:	eb 4b                	jmp    800bb3 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800b68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b6c:	8b 00                	mov    (%rax),%eax
+  800b6e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b71:	77 24                	ja     800b97 <getint+0xf9>
+  800b73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b77:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b7f:	8b 00                	mov    (%rax),%eax
+  800b81:	89 c0                	mov    %eax,%eax
+  800b83:	48 01 d0             	add    %rdx,%rax
+  800b86:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b8a:	8b 12                	mov    (%rdx),%edx
+  800b8c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b8f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b93:	89 0a                	mov    %ecx,(%rdx)
+  800b95:	eb 14                	jmp    800bab <getint+0x10d>
+  800b97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b9b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b9f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ba3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ba7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bab:	8b 00                	mov    (%rax),%eax
+  800bad:	48 98                	cltq
+  800baf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800bb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800bb7:	c9                   	leave
+  800bb8:	c3                   	ret
+
+0000000000800bb9 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800bb9:	55                   	push   %rbp
+  800bba:	48 89 e5             	mov    %rsp,%rbp
+  800bbd:	41 57                	push   %r15
+  800bbf:	41 55                	push   %r13
+  800bc1:	41 54                	push   %r12
+  800bc3:	53                   	push   %rbx
+  800bc4:	48 83 ec 60          	sub    $0x60,%rsp
+  800bc8:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800bc8 <vprintfmt+0xf>
+  800bcf:	49 bb 70 74 00 00 00 	movabs $0x7470,%r11
+  800bd6:	00 00 00 
+  800bd9:	4d 01 dc             	add    %r11,%r12
+  800bdc:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800be0:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800be4:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800be8:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800bec:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800bf3:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800bf7:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800bfb:	48 8b 06             	mov    (%rsi),%rax
+  800bfe:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800c02:	48 89 01             	mov    %rax,(%rcx)
+  800c05:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800c09:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800c0d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c11:	eb 17                	jmp    800c2a <vprintfmt+0x71>
+			if (ch == '\0')
+  800c13:	85 db                	test   %ebx,%ebx
+  800c15:	0f 84 97 05 00 00    	je     8011b2 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800c1b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c1f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c23:	48 89 c6             	mov    %rax,%rsi
+  800c26:	89 df                	mov    %ebx,%edi
+  800c28:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c2a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c2e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c32:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c36:	0f b6 00             	movzbl (%rax),%eax
+  800c39:	0f b6 d8             	movzbl %al,%ebx
+  800c3c:	83 fb 25             	cmp    $0x25,%ebx
+  800c3f:	75 d2                	jne    800c13 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800c41:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800c45:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800c4c:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800c53:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800c5a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800c61:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c65:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c69:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c6d:	0f b6 00             	movzbl (%rax),%eax
+  800c70:	0f b6 d8             	movzbl %al,%ebx
+  800c73:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c76:	83 f8 55             	cmp    $0x55,%eax
+  800c79:	0f 87 00 05 00 00    	ja     80117f <vprintfmt+0x5c6>
+  800c7f:	89 c0                	mov    %eax,%eax
+  800c81:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c88:	00 
+  800c89:	48 8d 05 28 5a 00 00 	lea    0x5a28(%rip),%rax        # 8066b8 <.LC18+0xc>
+  800c90:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800c94:	48 8d 15 1d 5a 00 00 	lea    0x5a1d(%rip),%rdx        # 8066b8 <.LC18+0xc>
+  800c9b:	48 01 d0             	add    %rdx,%rax
+  800c9e:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800ca0:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800ca4:	eb bb                	jmp    800c61 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800ca6:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800caa:	eb b5                	jmp    800c61 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800cac:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800cb3:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800cb6:	89 d0                	mov    %edx,%eax
+  800cb8:	c1 e0 02             	shl    $0x2,%eax
+  800cbb:	01 d0                	add    %edx,%eax
+  800cbd:	01 c0                	add    %eax,%eax
+  800cbf:	01 d8                	add    %ebx,%eax
+  800cc1:	83 e8 30             	sub    $0x30,%eax
+  800cc4:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800cc7:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ccb:	0f b6 00             	movzbl (%rax),%eax
+  800cce:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800cd1:	83 fb 2f             	cmp    $0x2f,%ebx
+  800cd4:	7e 60                	jle    800d36 <vprintfmt+0x17d>
+  800cd6:	83 fb 39             	cmp    $0x39,%ebx
+  800cd9:	7f 5b                	jg     800d36 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800cdb:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800ce0:	eb d1                	jmp    800cb3 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800ce2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ce5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce8:	77 17                	ja     800d01 <vprintfmt+0x148>
+  800cea:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800cee:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cf1:	89 d2                	mov    %edx,%edx
+  800cf3:	48 01 d0             	add    %rdx,%rax
+  800cf6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cf9:	83 c2 08             	add    $0x8,%edx
+  800cfc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cff:	eb 0c                	jmp    800d0d <vprintfmt+0x154>
+  800d01:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d05:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d09:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d0d:	8b 00                	mov    (%rax),%eax
+  800d0f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800d12:	eb 23                	jmp    800d37 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800d14:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d18:	0f 89 43 ff ff ff    	jns    800c61 <vprintfmt+0xa8>
+				width = 0;
+  800d1e:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800d25:	e9 37 ff ff ff       	jmp    800c61 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800d2a:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800d31:	e9 2b ff ff ff       	jmp    800c61 <vprintfmt+0xa8>
+			goto process_precision;
+  800d36:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800d37:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d3b:	0f 89 20 ff ff ff    	jns    800c61 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800d41:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d44:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800d47:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800d4e:	e9 0e ff ff ff       	jmp    800c61 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800d53:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800d57:	e9 05 ff ff ff       	jmp    800c61 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800d5c:	83 fb 39             	cmp    $0x39,%ebx
+  800d5f:	7f 0b                	jg     800d6c <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800d61:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800d64:	c1 e0 08             	shl    $0x8,%eax
+  800d67:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d6a:	eb 21                	jmp    800d8d <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800d6c:	83 fb 60             	cmp    $0x60,%ebx
+  800d6f:	7e 10                	jle    800d81 <vprintfmt+0x1c8>
+  800d71:	83 fb 66             	cmp    $0x66,%ebx
+  800d74:	7f 0b                	jg     800d81 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800d76:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800d79:	c1 e0 08             	shl    $0x8,%eax
+  800d7c:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d7f:	eb 0c                	jmp    800d8d <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800d81:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800d88:	e9 04 01 00 00       	jmp    800e91 <vprintfmt+0x2d8>
+  800d8d:	e9 ff 00 00 00       	jmp    800e91 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800d92:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d95:	83 f8 2f             	cmp    $0x2f,%eax
+  800d98:	77 17                	ja     800db1 <vprintfmt+0x1f8>
+  800d9a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d9e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800da1:	89 d2                	mov    %edx,%edx
+  800da3:	48 01 d0             	add    %rdx,%rax
+  800da6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800da9:	83 c2 08             	add    $0x8,%edx
+  800dac:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800daf:	eb 0c                	jmp    800dbd <vprintfmt+0x204>
+  800db1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800db5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800db9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800dbd:	8b 00                	mov    (%rax),%eax
+  800dbf:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800dc3:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800dc7:	48 89 d6             	mov    %rdx,%rsi
+  800dca:	89 c7                	mov    %eax,%edi
+  800dcc:	ff d1                	call   *%rcx
+			break;
+  800dce:	e9 da 03 00 00       	jmp    8011ad <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800dd3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800dd6:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd9:	77 17                	ja     800df2 <vprintfmt+0x239>
+  800ddb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ddf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800de2:	89 d2                	mov    %edx,%edx
+  800de4:	48 01 d0             	add    %rdx,%rax
+  800de7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dea:	83 c2 08             	add    $0x8,%edx
+  800ded:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800df0:	eb 0c                	jmp    800dfe <vprintfmt+0x245>
+  800df2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800df6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dfa:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800dfe:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800e00:	85 db                	test   %ebx,%ebx
+  800e02:	79 02                	jns    800e06 <vprintfmt+0x24d>
+				err = -err;
+  800e04:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800e06:	83 fb 15             	cmp    $0x15,%ebx
+  800e09:	7f 19                	jg     800e24 <vprintfmt+0x26b>
+  800e0b:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  800e12:	00 00 00 
+  800e15:	48 63 c3             	movslq %ebx,%rax
+  800e18:	4c 01 e2             	add    %r12,%rdx
+  800e1b:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800e1f:	4d 85 ed             	test   %r13,%r13
+  800e22:	75 36                	jne    800e5a <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800e24:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e28:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e2c:	89 d9                	mov    %ebx,%ecx
+  800e2e:	48 ba 68 e6 ff ff ff 	movabs $0xffffffffffffe668,%rdx
+  800e35:	ff ff ff 
+  800e38:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e3c:	48 89 c7             	mov    %rax,%rdi
+  800e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e44:	49 b8 88 91 ff ff ff 	movabs $0xffffffffffff9188,%r8
+  800e4b:	ff ff ff 
+  800e4e:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e52:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800e55:	e9 53 03 00 00       	jmp    8011ad <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800e5a:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e5e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e62:	4c 89 e9             	mov    %r13,%rcx
+  800e65:	48 ba 71 e6 ff ff ff 	movabs $0xffffffffffffe671,%rdx
+  800e6c:	ff ff ff 
+  800e6f:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e73:	48 89 c7             	mov    %rax,%rdi
+  800e76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7b:	49 b8 88 91 ff ff ff 	movabs $0xffffffffffff9188,%r8
+  800e82:	ff ff ff 
+  800e85:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e89:	41 ff d0             	call   *%r8
+			break;
+  800e8c:	e9 1c 03 00 00       	jmp    8011ad <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800e91:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e94:	83 f8 2f             	cmp    $0x2f,%eax
+  800e97:	77 17                	ja     800eb0 <vprintfmt+0x2f7>
+  800e99:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e9d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ea0:	89 d2                	mov    %edx,%edx
+  800ea2:	48 01 d0             	add    %rdx,%rax
+  800ea5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ea8:	83 c2 08             	add    $0x8,%edx
+  800eab:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800eae:	eb 0c                	jmp    800ebc <vprintfmt+0x303>
+  800eb0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800eb4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800eb8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ebc:	4c 8b 28             	mov    (%rax),%r13
+  800ebf:	4d 85 ed             	test   %r13,%r13
+  800ec2:	75 0e                	jne    800ed2 <vprintfmt+0x319>
+				p = "(null)";
+  800ec4:	48 b8 74 e6 ff ff ff 	movabs $0xffffffffffffe674,%rax
+  800ecb:	ff ff ff 
+  800ece:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800ed2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ed6:	0f 8e 84 00 00 00    	jle    800f60 <vprintfmt+0x3a7>
+  800edc:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800ee0:	74 7e                	je     800f60 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ee2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ee5:	48 98                	cltq
+  800ee7:	48 89 c6             	mov    %rax,%rsi
+  800eea:	4c 89 ef             	mov    %r13,%rdi
+  800eed:	4d 89 e7             	mov    %r12,%r15
+  800ef0:	48 b8 ad 94 ff ff ff 	movabs $0xffffffffffff94ad,%rax
+  800ef7:	ff ff ff 
+  800efa:	4c 01 e0             	add    %r12,%rax
+  800efd:	ff d0                	call   *%rax
+  800eff:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800f02:	eb 17                	jmp    800f1b <vprintfmt+0x362>
+					putch(padc, putdat);
+  800f04:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800f08:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800f0c:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800f10:	48 89 d6             	mov    %rdx,%rsi
+  800f13:	89 c7                	mov    %eax,%edi
+  800f15:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f17:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f1b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f1f:	7f e3                	jg     800f04 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f21:	eb 3d                	jmp    800f60 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800f23:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800f27:	74 1e                	je     800f47 <vprintfmt+0x38e>
+  800f29:	83 fb 1f             	cmp    $0x1f,%ebx
+  800f2c:	7e 05                	jle    800f33 <vprintfmt+0x37a>
+  800f2e:	83 fb 7e             	cmp    $0x7e,%ebx
+  800f31:	7e 14                	jle    800f47 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800f33:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f37:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f3b:	48 89 c6             	mov    %rax,%rsi
+  800f3e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800f43:	ff d2                	call   *%rdx
+  800f45:	eb 15                	jmp    800f5c <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800f47:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800f4a:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800f4d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f51:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f55:	48 89 c6             	mov    %rax,%rsi
+  800f58:	89 cf                	mov    %ecx,%edi
+  800f5a:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f5c:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f60:	4c 89 e8             	mov    %r13,%rax
+  800f63:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800f67:	0f b6 00             	movzbl (%rax),%eax
+  800f6a:	0f be d8             	movsbl %al,%ebx
+  800f6d:	85 db                	test   %ebx,%ebx
+  800f6f:	74 28                	je     800f99 <vprintfmt+0x3e0>
+  800f71:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f75:	78 ac                	js     800f23 <vprintfmt+0x36a>
+  800f77:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800f7b:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f7f:	79 a2                	jns    800f23 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800f81:	eb 16                	jmp    800f99 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800f83:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f87:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f8b:	48 89 c6             	mov    %rax,%rsi
+  800f8e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f93:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800f95:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f99:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f9d:	7f e4                	jg     800f83 <vprintfmt+0x3ca>
+			break;
+  800f9f:	e9 09 02 00 00       	jmp    8011ad <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800fa4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800fa8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fac:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800fb0:	0f b6 00             	movzbl (%rax),%eax
+  800fb3:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800fb6:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800fb7:	83 fb 2f             	cmp    $0x2f,%ebx
+  800fba:	0f 8e ac fd ff ff    	jle    800d6c <vprintfmt+0x1b3>
+  800fc0:	e9 97 fd ff ff       	jmp    800d5c <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800fc5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fc9:	be 03 00 00 00       	mov    $0x3,%esi
+  800fce:	48 89 c7             	mov    %rax,%rdi
+  800fd1:	48 b8 66 8a ff ff ff 	movabs $0xffffffffffff8a66,%rax
+  800fd8:	ff ff ff 
+  800fdb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fdf:	ff d0                	call   *%rax
+  800fe1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800fe5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fe9:	48 85 c0             	test   %rax,%rax
+  800fec:	79 1d                	jns    80100b <vprintfmt+0x452>
+				putch('-', putdat);
+  800fee:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ff2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ff6:	48 89 c6             	mov    %rax,%rsi
+  800ff9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ffe:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  801000:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801004:	48 f7 d8             	neg    %rax
+  801007:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  80100b:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801012:	e9 de 00 00 00       	jmp    8010f5 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801017:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80101b:	be 03 00 00 00       	mov    $0x3,%esi
+  801020:	48 89 c7             	mov    %rax,%rdi
+  801023:	48 b8 05 89 ff ff ff 	movabs $0xffffffffffff8905,%rax
+  80102a:	ff ff ff 
+  80102d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801031:	ff d0                	call   *%rax
+  801033:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801037:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80103e:	e9 b2 00 00 00       	jmp    8010f5 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801043:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801047:	be 03 00 00 00       	mov    $0x3,%esi
+  80104c:	48 89 c7             	mov    %rax,%rdi
+  80104f:	48 b8 05 89 ff ff ff 	movabs $0xffffffffffff8905,%rax
+  801056:	ff ff ff 
+  801059:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80105d:	ff d0                	call   *%rax
+  80105f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801063:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  80106a:	e9 86 00 00 00       	jmp    8010f5 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80106f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801073:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801077:	48 89 c6             	mov    %rax,%rsi
+  80107a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80107f:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801081:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801085:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801089:	48 89 c6             	mov    %rax,%rsi
+  80108c:	bf 78 00 00 00       	mov    $0x78,%edi
+  801091:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801093:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801096:	83 f8 2f             	cmp    $0x2f,%eax
+  801099:	77 17                	ja     8010b2 <vprintfmt+0x4f9>
+  80109b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80109f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010a2:	89 d2                	mov    %edx,%edx
+  8010a4:	48 01 d0             	add    %rdx,%rax
+  8010a7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010aa:	83 c2 08             	add    $0x8,%edx
+  8010ad:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8010b0:	eb 0c                	jmp    8010be <vprintfmt+0x505>
+  8010b2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8010b6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8010ba:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8010be:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8010c1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010c5:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8010cc:	eb 27                	jmp    8010f5 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8010ce:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010d2:	be 03 00 00 00       	mov    $0x3,%esi
+  8010d7:	48 89 c7             	mov    %rax,%rdi
+  8010da:	48 b8 05 89 ff ff ff 	movabs $0xffffffffffff8905,%rax
+  8010e1:	ff ff ff 
+  8010e4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010e8:	ff d0                	call   *%rax
+  8010ea:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010ee:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8010f5:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8010fa:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8010fd:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801100:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801104:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801108:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80110c:	45 89 c1             	mov    %r8d,%r9d
+  80110f:	41 89 f8             	mov    %edi,%r8d
+  801112:	48 89 c7             	mov    %rax,%rdi
+  801115:	48 b8 2d 88 ff ff ff 	movabs $0xffffffffffff882d,%rax
+  80111c:	ff ff ff 
+  80111f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801123:	ff d0                	call   *%rax
+			break;
+  801125:	e9 83 00 00 00       	jmp    8011ad <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80112a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80112e:	be 03 00 00 00       	mov    $0x3,%esi
+  801133:	48 89 c7             	mov    %rax,%rdi
+  801136:	48 b8 05 89 ff ff ff 	movabs $0xffffffffffff8905,%rax
+  80113d:	ff ff ff 
+  801140:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801144:	ff d0                	call   *%rax
+  801146:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80114a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80114e:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801152:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801156:	48 89 ce             	mov    %rcx,%rsi
+  801159:	48 89 c7             	mov    %rax,%rdi
+  80115c:	48 b8 20 8a ff ff ff 	movabs $0xffffffffffff8a20,%rax
+  801163:	ff ff ff 
+  801166:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80116a:	ff d0                	call   *%rax
+	
+			break;
+  80116c:	eb 3f                	jmp    8011ad <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80116e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801172:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801176:	48 89 c6             	mov    %rax,%rsi
+  801179:	89 df                	mov    %ebx,%edi
+  80117b:	ff d2                	call   *%rdx
+			break;
+  80117d:	eb 2e                	jmp    8011ad <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80117f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801183:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801187:	48 89 c6             	mov    %rax,%rsi
+  80118a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80118f:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801191:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801196:	eb 05                	jmp    80119d <vprintfmt+0x5e4>
+  801198:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80119d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8011a1:	48 83 e8 01          	sub    $0x1,%rax
+  8011a5:	0f b6 00             	movzbl (%rax),%eax
+  8011a8:	3c 25                	cmp    $0x25,%al
+  8011aa:	75 ec                	jne    801198 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8011ac:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8011ad:	e9 78 fa ff ff       	jmp    800c2a <vprintfmt+0x71>
+				return;
+  8011b2:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8011b3:	48 83 c4 60          	add    $0x60,%rsp
+  8011b7:	5b                   	pop    %rbx
+  8011b8:	41 5c                	pop    %r12
+  8011ba:	41 5d                	pop    %r13
+  8011bc:	41 5f                	pop    %r15
+  8011be:	5d                   	pop    %rbp
+  8011bf:	c3                   	ret
+
+00000000008011c0 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8011c0:	55                   	push   %rbp
+  8011c1:	48 89 e5             	mov    %rsp,%rbp
+  8011c4:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8011cb:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8011cb <printfmt+0xb>
+  8011d2:	49 bb 6d 6e 00 00 00 	movabs $0x6e6d,%r11
+  8011d9:	00 00 00 
+  8011dc:	4d 01 da             	add    %r11,%r10
+  8011df:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8011e6:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8011ed:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8011f4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8011fb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801202:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801209:	84 c0                	test   %al,%al
+  80120b:	74 20                	je     80122d <printfmt+0x6d>
+  80120d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801211:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801215:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801219:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80121d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801221:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801225:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801229:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80122d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801234:	00 00 00 
+  801237:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80123e:	00 00 00 
+  801241:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801245:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80124c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801253:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80125a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801261:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801268:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80126f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801276:	48 89 c7             	mov    %rax,%rdi
+  801279:	48 b8 81 8b ff ff ff 	movabs $0xffffffffffff8b81,%rax
+  801280:	ff ff ff 
+  801283:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801287:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801289:	90                   	nop
+  80128a:	c9                   	leave
+  80128b:	c3                   	ret
+
+000000000080128c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80128c:	55                   	push   %rbp
+  80128d:	48 89 e5             	mov    %rsp,%rbp
+  801290:	48 83 ec 10          	sub    $0x10,%rsp
+  801294:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801294 <sprintputch+0x8>
+  80129b:	49 bb a4 6d 00 00 00 	movabs $0x6da4,%r11
+  8012a2:	00 00 00 
+  8012a5:	4c 01 d8             	add    %r11,%rax
+  8012a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8012ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8012af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012b3:	8b 40 10             	mov    0x10(%rax),%eax
+  8012b6:	8d 50 01             	lea    0x1(%rax),%edx
+  8012b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012bd:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8012c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012c4:	48 8b 10             	mov    (%rax),%rdx
+  8012c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012cf:	48 39 c2             	cmp    %rax,%rdx
+  8012d2:	73 17                	jae    8012eb <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8012d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012d8:	48 8b 00             	mov    (%rax),%rax
+  8012db:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012df:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012e3:	48 89 0a             	mov    %rcx,(%rdx)
+  8012e6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8012e9:	88 10                	mov    %dl,(%rax)
+}
+  8012eb:	90                   	nop
+  8012ec:	c9                   	leave
+  8012ed:	c3                   	ret
+
+00000000008012ee <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8012ee:	55                   	push   %rbp
+  8012ef:	48 89 e5             	mov    %rsp,%rbp
+  8012f2:	53                   	push   %rbx
+  8012f3:	48 83 ec 58          	sub    $0x58,%rsp
+  8012f7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012f7 <vsnprintf+0x9>
+  8012fe:	49 bb 41 6d 00 00 00 	movabs $0x6d41,%r11
+  801305:	00 00 00 
+  801308:	4c 01 d8             	add    %r11,%rax
+  80130b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80130f:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801312:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801316:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80131a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80131e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801322:	48 8b 0e             	mov    (%rsi),%rcx
+  801325:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801329:	48 89 0a             	mov    %rcx,(%rdx)
+  80132c:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801330:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801334:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801338:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80133c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801340:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801343:	48 63 d2             	movslq %edx,%rdx
+  801346:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80134a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80134e:	48 01 ca             	add    %rcx,%rdx
+  801351:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801355:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80135c:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801361:	74 06                	je     801369 <vsnprintf+0x7b>
+  801363:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801367:	7f 07                	jg     801370 <vsnprintf+0x82>
+		return -E_INVAL;
+  801369:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80136e:	eb 34                	jmp    8013a4 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801370:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801374:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801378:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80137c:	48 bf 54 92 ff ff ff 	movabs $0xffffffffffff9254,%rdi
+  801383:	ff ff ff 
+  801386:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  80138a:	49 b8 81 8b ff ff ff 	movabs $0xffffffffffff8b81,%r8
+  801391:	ff ff ff 
+  801394:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801398:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  80139a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80139e:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8013a1:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8013a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a8:	c9                   	leave
+  8013a9:	c3                   	ret
+
+00000000008013aa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8013aa:	55                   	push   %rbp
+  8013ab:	48 89 e5             	mov    %rsp,%rbp
+  8013ae:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8013b5:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8013b5 <snprintf+0xb>
+  8013bc:	49 bb 83 6c 00 00 00 	movabs $0x6c83,%r11
+  8013c3:	00 00 00 
+  8013c6:	4d 01 da             	add    %r11,%r10
+  8013c9:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8013d0:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8013d6:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8013dd:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8013e4:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8013eb:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8013f2:	84 c0                	test   %al,%al
+  8013f4:	74 20                	je     801416 <snprintf+0x6c>
+  8013f6:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8013fa:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8013fe:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801402:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801406:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80140a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80140e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801412:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801416:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80141d:	00 00 00 
+  801420:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801427:	00 00 00 
+  80142a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80142e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801435:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80143c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801443:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80144a:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801451:	48 8b 06             	mov    (%rsi),%rax
+  801454:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801458:	48 89 01             	mov    %rax,(%rcx)
+  80145b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80145f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801463:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801467:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80146e:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801475:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80147b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801482:	48 89 c7             	mov    %rax,%rdi
+  801485:	48 b8 b6 92 ff ff ff 	movabs $0xffffffffffff92b6,%rax
+  80148c:	ff ff ff 
+  80148f:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801493:	ff d0                	call   *%rax
+  801495:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  80149b:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8014a1:	c9                   	leave
+  8014a2:	c3                   	ret
+
+00000000008014a3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8014a3:	55                   	push   %rbp
+  8014a4:	48 89 e5             	mov    %rsp,%rbp
+  8014a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8014ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014ab <strlen+0x8>
+  8014b2:	49 bb 8d 6b 00 00 00 	movabs $0x6b8d,%r11
+  8014b9:	00 00 00 
+  8014bc:	4c 01 d8             	add    %r11,%rax
+  8014bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8014c3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014ca:	eb 09                	jmp    8014d5 <strlen+0x32>
+		n++;
+  8014cc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8014d0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d9:	0f b6 00             	movzbl (%rax),%eax
+  8014dc:	84 c0                	test   %al,%al
+  8014de:	75 ec                	jne    8014cc <strlen+0x29>
+	return n;
+  8014e0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8014e3:	c9                   	leave
+  8014e4:	c3                   	ret
+
+00000000008014e5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8014e5:	55                   	push   %rbp
+  8014e6:	48 89 e5             	mov    %rsp,%rbp
+  8014e9:	48 83 ec 20          	sub    $0x20,%rsp
+  8014ed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014ed <strnlen+0x8>
+  8014f4:	49 bb 4b 6b 00 00 00 	movabs $0x6b4b,%r11
+  8014fb:	00 00 00 
+  8014fe:	4c 01 d8             	add    %r11,%rax
+  801501:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801505:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801509:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801510:	eb 0e                	jmp    801520 <strnlen+0x3b>
+		n++;
+  801512:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801516:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80151b:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801520:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801525:	74 0b                	je     801532 <strnlen+0x4d>
+  801527:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80152b:	0f b6 00             	movzbl (%rax),%eax
+  80152e:	84 c0                	test   %al,%al
+  801530:	75 e0                	jne    801512 <strnlen+0x2d>
+	return n;
+  801532:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801535:	c9                   	leave
+  801536:	c3                   	ret
+
+0000000000801537 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801537:	55                   	push   %rbp
+  801538:	48 89 e5             	mov    %rsp,%rbp
+  80153b:	48 83 ec 20          	sub    $0x20,%rsp
+  80153f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80153f <strcpy+0x8>
+  801546:	49 bb f9 6a 00 00 00 	movabs $0x6af9,%r11
+  80154d:	00 00 00 
+  801550:	4c 01 d8             	add    %r11,%rax
+  801553:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801557:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80155b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80155f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801563:	90                   	nop
+  801564:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801568:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80156c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801570:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801574:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801578:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80157c:	0f b6 12             	movzbl (%rdx),%edx
+  80157f:	88 10                	mov    %dl,(%rax)
+  801581:	0f b6 00             	movzbl (%rax),%eax
+  801584:	84 c0                	test   %al,%al
+  801586:	75 dc                	jne    801564 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801588:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80158c:	c9                   	leave
+  80158d:	c3                   	ret
+
+000000000080158e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80158e:	55                   	push   %rbp
+  80158f:	48 89 e5             	mov    %rsp,%rbp
+  801592:	53                   	push   %rbx
+  801593:	48 83 ec 20          	sub    $0x20,%rsp
+  801597:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801597 <strcat+0x9>
+  80159e:	49 bb a1 6a 00 00 00 	movabs $0x6aa1,%r11
+  8015a5:	00 00 00 
+  8015a8:	4c 01 db             	add    %r11,%rbx
+  8015ab:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8015af:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8015b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b7:	48 89 c7             	mov    %rax,%rdi
+  8015ba:	48 b8 6b 94 ff ff ff 	movabs $0xffffffffffff946b,%rax
+  8015c1:	ff ff ff 
+  8015c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015c8:	ff d0                	call   *%rax
+  8015ca:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8015cd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015d0:	48 63 d0             	movslq %eax,%rdx
+  8015d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015d7:	48 01 c2             	add    %rax,%rdx
+  8015da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015de:	48 89 c6             	mov    %rax,%rsi
+  8015e1:	48 89 d7             	mov    %rdx,%rdi
+  8015e4:	48 b8 ff 94 ff ff ff 	movabs $0xffffffffffff94ff,%rax
+  8015eb:	ff ff ff 
+  8015ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015f2:	ff d0                	call   *%rax
+	return dst;
+  8015f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8015f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fc:	c9                   	leave
+  8015fd:	c3                   	ret
+
+00000000008015fe <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8015fe:	55                   	push   %rbp
+  8015ff:	48 89 e5             	mov    %rsp,%rbp
+  801602:	48 83 ec 28          	sub    $0x28,%rsp
+  801606:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801606 <strncpy+0x8>
+  80160d:	49 bb 32 6a 00 00 00 	movabs $0x6a32,%r11
+  801614:	00 00 00 
+  801617:	4c 01 d8             	add    %r11,%rax
+  80161a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80161e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801622:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801626:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80162a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80162e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801635:	00 
+  801636:	eb 2a                	jmp    801662 <strncpy+0x64>
+		*dst++ = *src;
+  801638:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80163c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801640:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801644:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801648:	0f b6 12             	movzbl (%rdx),%edx
+  80164b:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80164d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801651:	0f b6 00             	movzbl (%rax),%eax
+  801654:	84 c0                	test   %al,%al
+  801656:	74 05                	je     80165d <strncpy+0x5f>
+			src++;
+  801658:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80165d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801662:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801666:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80166a:	72 cc                	jb     801638 <strncpy+0x3a>
+	}
+	return ret;
+  80166c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801670:	c9                   	leave
+  801671:	c3                   	ret
+
+0000000000801672 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801672:	55                   	push   %rbp
+  801673:	48 89 e5             	mov    %rsp,%rbp
+  801676:	48 83 ec 28          	sub    $0x28,%rsp
+  80167a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80167a <strlcpy+0x8>
+  801681:	49 bb be 69 00 00 00 	movabs $0x69be,%r11
+  801688:	00 00 00 
+  80168b:	4c 01 d8             	add    %r11,%rax
+  80168e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801692:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801696:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80169a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80169e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8016a2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016a7:	74 3d                	je     8016e6 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8016a9:	eb 1d                	jmp    8016c8 <strlcpy+0x56>
+			*dst++ = *src++;
+  8016ab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016af:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016b3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016bb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016bf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016c3:	0f b6 12             	movzbl (%rdx),%edx
+  8016c6:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8016c8:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016cd:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016d2:	74 0b                	je     8016df <strlcpy+0x6d>
+  8016d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016d8:	0f b6 00             	movzbl (%rax),%eax
+  8016db:	84 c0                	test   %al,%al
+  8016dd:	75 cc                	jne    8016ab <strlcpy+0x39>
+		*dst = '\0';
+  8016df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e3:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8016e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016ea:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8016ee:	c9                   	leave
+  8016ef:	c3                   	ret
+
+00000000008016f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8016f0:	55                   	push   %rbp
+  8016f1:	48 89 e5             	mov    %rsp,%rbp
+  8016f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8016f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016f8 <strcmp+0x8>
+  8016ff:	49 bb 40 69 00 00 00 	movabs $0x6940,%r11
+  801706:	00 00 00 
+  801709:	4c 01 d8             	add    %r11,%rax
+  80170c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801710:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801714:	eb 0a                	jmp    801720 <strcmp+0x30>
+		p++, q++;
+  801716:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80171b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801720:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801724:	0f b6 00             	movzbl (%rax),%eax
+  801727:	84 c0                	test   %al,%al
+  801729:	74 12                	je     80173d <strcmp+0x4d>
+  80172b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172f:	0f b6 10             	movzbl (%rax),%edx
+  801732:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801736:	0f b6 00             	movzbl (%rax),%eax
+  801739:	38 c2                	cmp    %al,%dl
+  80173b:	74 d9                	je     801716 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80173d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801741:	0f b6 00             	movzbl (%rax),%eax
+  801744:	0f b6 d0             	movzbl %al,%edx
+  801747:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80174b:	0f b6 00             	movzbl (%rax),%eax
+  80174e:	0f b6 c0             	movzbl %al,%eax
+  801751:	29 c2                	sub    %eax,%edx
+  801753:	89 d0                	mov    %edx,%eax
+}
+  801755:	c9                   	leave
+  801756:	c3                   	ret
+
+0000000000801757 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801757:	55                   	push   %rbp
+  801758:	48 89 e5             	mov    %rsp,%rbp
+  80175b:	48 83 ec 18          	sub    $0x18,%rsp
+  80175f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80175f <strncmp+0x8>
+  801766:	49 bb d9 68 00 00 00 	movabs $0x68d9,%r11
+  80176d:	00 00 00 
+  801770:	4c 01 d8             	add    %r11,%rax
+  801773:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801777:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80177b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80177f:	eb 0f                	jmp    801790 <strncmp+0x39>
+		n--, p++, q++;
+  801781:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801786:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80178b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801790:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801795:	74 1d                	je     8017b4 <strncmp+0x5d>
+  801797:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179b:	0f b6 00             	movzbl (%rax),%eax
+  80179e:	84 c0                	test   %al,%al
+  8017a0:	74 12                	je     8017b4 <strncmp+0x5d>
+  8017a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017a6:	0f b6 10             	movzbl (%rax),%edx
+  8017a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ad:	0f b6 00             	movzbl (%rax),%eax
+  8017b0:	38 c2                	cmp    %al,%dl
+  8017b2:	74 cd                	je     801781 <strncmp+0x2a>
+	if (n == 0)
+  8017b4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8017b9:	75 07                	jne    8017c2 <strncmp+0x6b>
+		return 0;
+  8017bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c0:	eb 16                	jmp    8017d8 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8017c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c6:	0f b6 00             	movzbl (%rax),%eax
+  8017c9:	0f b6 d0             	movzbl %al,%edx
+  8017cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d0:	0f b6 00             	movzbl (%rax),%eax
+  8017d3:	0f b6 c0             	movzbl %al,%eax
+  8017d6:	29 c2                	sub    %eax,%edx
+}
+  8017d8:	89 d0                	mov    %edx,%eax
+  8017da:	c9                   	leave
+  8017db:	c3                   	ret
+
+00000000008017dc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8017dc:	55                   	push   %rbp
+  8017dd:	48 89 e5             	mov    %rsp,%rbp
+  8017e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8017e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e4 <strchr+0x8>
+  8017eb:	49 bb 54 68 00 00 00 	movabs $0x6854,%r11
+  8017f2:	00 00 00 
+  8017f5:	4c 01 d8             	add    %r11,%rax
+  8017f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017fc:	89 f0                	mov    %esi,%eax
+  8017fe:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801801:	eb 17                	jmp    80181a <strchr+0x3e>
+		if (*s == c)
+  801803:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801807:	0f b6 00             	movzbl (%rax),%eax
+  80180a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80180d:	75 06                	jne    801815 <strchr+0x39>
+			return (char *) s;
+  80180f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801813:	eb 15                	jmp    80182a <strchr+0x4e>
+	for (; *s; s++)
+  801815:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80181a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181e:	0f b6 00             	movzbl (%rax),%eax
+  801821:	84 c0                	test   %al,%al
+  801823:	75 de                	jne    801803 <strchr+0x27>
+	return 0;
+  801825:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80182a:	c9                   	leave
+  80182b:	c3                   	ret
+
+000000000080182c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+  801830:	48 83 ec 10          	sub    $0x10,%rsp
+  801834:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801834 <strfind+0x8>
+  80183b:	49 bb 04 68 00 00 00 	movabs $0x6804,%r11
+  801842:	00 00 00 
+  801845:	4c 01 d8             	add    %r11,%rax
+  801848:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80184c:	89 f0                	mov    %esi,%eax
+  80184e:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801851:	eb 11                	jmp    801864 <strfind+0x38>
+		if (*s == c)
+  801853:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801857:	0f b6 00             	movzbl (%rax),%eax
+  80185a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80185d:	74 12                	je     801871 <strfind+0x45>
+	for (; *s; s++)
+  80185f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801864:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801868:	0f b6 00             	movzbl (%rax),%eax
+  80186b:	84 c0                	test   %al,%al
+  80186d:	75 e4                	jne    801853 <strfind+0x27>
+  80186f:	eb 01                	jmp    801872 <strfind+0x46>
+			break;
+  801871:	90                   	nop
+	return (char *) s;
+  801872:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801876:	c9                   	leave
+  801877:	c3                   	ret
+
+0000000000801878 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801878:	55                   	push   %rbp
+  801879:	48 89 e5             	mov    %rsp,%rbp
+  80187c:	48 83 ec 18          	sub    $0x18,%rsp
+  801880:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801880 <memset+0x8>
+  801887:	49 bb b8 67 00 00 00 	movabs $0x67b8,%r11
+  80188e:	00 00 00 
+  801891:	4c 01 d8             	add    %r11,%rax
+  801894:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801898:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80189b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80189f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018a4:	75 06                	jne    8018ac <memset+0x34>
+		return v;
+  8018a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018aa:	eb 69                	jmp    801915 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8018ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018b0:	83 e0 03             	and    $0x3,%eax
+  8018b3:	48 85 c0             	test   %rax,%rax
+  8018b6:	75 48                	jne    801900 <memset+0x88>
+  8018b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018bc:	83 e0 03             	and    $0x3,%eax
+  8018bf:	48 85 c0             	test   %rax,%rax
+  8018c2:	75 3c                	jne    801900 <memset+0x88>
+		c &= 0xFF;
+  8018c4:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8018cb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ce:	c1 e0 18             	shl    $0x18,%eax
+  8018d1:	89 c2                	mov    %eax,%edx
+  8018d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d6:	c1 e0 10             	shl    $0x10,%eax
+  8018d9:	09 c2                	or     %eax,%edx
+  8018db:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018de:	c1 e0 08             	shl    $0x8,%eax
+  8018e1:	09 d0                	or     %edx,%eax
+  8018e3:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8018e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018ea:	48 c1 e8 02          	shr    $0x2,%rax
+  8018ee:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8018f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018f8:	48 89 d7             	mov    %rdx,%rdi
+  8018fb:	fc                   	cld
+  8018fc:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8018fe:	eb 11                	jmp    801911 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801900:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801904:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801907:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80190b:	48 89 d7             	mov    %rdx,%rdi
+  80190e:	fc                   	cld
+  80190f:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801911:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801915:	c9                   	leave
+  801916:	c3                   	ret
+
+0000000000801917 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801917:	55                   	push   %rbp
+  801918:	48 89 e5             	mov    %rsp,%rbp
+  80191b:	48 83 ec 28          	sub    $0x28,%rsp
+  80191f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80191f <memmove+0x8>
+  801926:	49 bb 19 67 00 00 00 	movabs $0x6719,%r11
+  80192d:	00 00 00 
+  801930:	4c 01 d8             	add    %r11,%rax
+  801933:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801937:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80193b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80193f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801943:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801947:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80194b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80194f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801953:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801957:	0f 83 88 00 00 00    	jae    8019e5 <memmove+0xce>
+  80195d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801961:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801965:	48 01 d0             	add    %rdx,%rax
+  801968:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80196c:	73 77                	jae    8019e5 <memmove+0xce>
+		s += n;
+  80196e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801972:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801976:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80197a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80197e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801982:	83 e0 03             	and    $0x3,%eax
+  801985:	48 85 c0             	test   %rax,%rax
+  801988:	75 3b                	jne    8019c5 <memmove+0xae>
+  80198a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80198e:	83 e0 03             	and    $0x3,%eax
+  801991:	48 85 c0             	test   %rax,%rax
+  801994:	75 2f                	jne    8019c5 <memmove+0xae>
+  801996:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80199a:	83 e0 03             	and    $0x3,%eax
+  80199d:	48 85 c0             	test   %rax,%rax
+  8019a0:	75 23                	jne    8019c5 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8019a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a6:	48 83 e8 04          	sub    $0x4,%rax
+  8019aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019ae:	48 83 ea 04          	sub    $0x4,%rdx
+  8019b2:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8019b6:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8019ba:	48 89 c7             	mov    %rax,%rdi
+  8019bd:	48 89 d6             	mov    %rdx,%rsi
+  8019c0:	fd                   	std
+  8019c1:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8019c3:	eb 1d                	jmp    8019e2 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8019c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019d1:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8019d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d9:	48 89 d7             	mov    %rdx,%rdi
+  8019dc:	48 89 c1             	mov    %rax,%rcx
+  8019df:	fd                   	std
+  8019e0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8019e2:	fc                   	cld
+  8019e3:	eb 57                	jmp    801a3c <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8019e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019e9:	83 e0 03             	and    $0x3,%eax
+  8019ec:	48 85 c0             	test   %rax,%rax
+  8019ef:	75 36                	jne    801a27 <memmove+0x110>
+  8019f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019f5:	83 e0 03             	and    $0x3,%eax
+  8019f8:	48 85 c0             	test   %rax,%rax
+  8019fb:	75 2a                	jne    801a27 <memmove+0x110>
+  8019fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a01:	83 e0 03             	and    $0x3,%eax
+  801a04:	48 85 c0             	test   %rax,%rax
+  801a07:	75 1e                	jne    801a27 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801a09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a0d:	48 c1 e8 02          	shr    $0x2,%rax
+  801a11:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801a14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a18:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a1c:	48 89 c7             	mov    %rax,%rdi
+  801a1f:	48 89 d6             	mov    %rdx,%rsi
+  801a22:	fc                   	cld
+  801a23:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a25:	eb 15                	jmp    801a3c <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801a27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a2b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a2f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a33:	48 89 c7             	mov    %rax,%rdi
+  801a36:	48 89 d6             	mov    %rdx,%rsi
+  801a39:	fc                   	cld
+  801a3a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801a3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a40:	c9                   	leave
+  801a41:	c3                   	ret
+
+0000000000801a42 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801a42:	55                   	push   %rbp
+  801a43:	48 89 e5             	mov    %rsp,%rbp
+  801a46:	48 83 ec 18          	sub    $0x18,%rsp
+  801a4a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a4a <memcpy+0x8>
+  801a51:	49 bb ee 65 00 00 00 	movabs $0x65ee,%r11
+  801a58:	00 00 00 
+  801a5b:	4c 01 d8             	add    %r11,%rax
+  801a5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a62:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a66:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801a6a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a6e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801a72:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a76:	48 89 cf             	mov    %rcx,%rdi
+  801a79:	48 b9 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rcx
+  801a80:	ff ff ff 
+  801a83:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801a87:	ff d0                	call   *%rax
+}
+  801a89:	c9                   	leave
+  801a8a:	c3                   	ret
+
+0000000000801a8b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801a8b:	55                   	push   %rbp
+  801a8c:	48 89 e5             	mov    %rsp,%rbp
+  801a8f:	48 83 ec 28          	sub    $0x28,%rsp
+  801a93:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a93 <memcmp+0x8>
+  801a9a:	49 bb a5 65 00 00 00 	movabs $0x65a5,%r11
+  801aa1:	00 00 00 
+  801aa4:	4c 01 d8             	add    %r11,%rax
+  801aa7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801aaf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801ab3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ab7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801abb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801abf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801ac3:	eb 34                	jmp    801af9 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801ac5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac9:	0f b6 10             	movzbl (%rax),%edx
+  801acc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ad0:	0f b6 00             	movzbl (%rax),%eax
+  801ad3:	38 c2                	cmp    %al,%dl
+  801ad5:	74 18                	je     801aef <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801ad7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801adb:	0f b6 00             	movzbl (%rax),%eax
+  801ade:	0f b6 d0             	movzbl %al,%edx
+  801ae1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ae5:	0f b6 00             	movzbl (%rax),%eax
+  801ae8:	0f b6 c0             	movzbl %al,%eax
+  801aeb:	29 c2                	sub    %eax,%edx
+  801aed:	eb 20                	jmp    801b0f <memcmp+0x84>
+		s1++, s2++;
+  801aef:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801af4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801af9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801afd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b01:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801b05:	48 85 c0             	test   %rax,%rax
+  801b08:	75 bb                	jne    801ac5 <memcmp+0x3a>
+	}
+
+	return 0;
+  801b0a:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801b0f:	89 d0                	mov    %edx,%eax
+  801b11:	c9                   	leave
+  801b12:	c3                   	ret
+
+0000000000801b13 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801b13:	55                   	push   %rbp
+  801b14:	48 89 e5             	mov    %rsp,%rbp
+  801b17:	48 83 ec 28          	sub    $0x28,%rsp
+  801b1b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b1b <memfind+0x8>
+  801b22:	49 bb 1d 65 00 00 00 	movabs $0x651d,%r11
+  801b29:	00 00 00 
+  801b2c:	4c 01 d8             	add    %r11,%rax
+  801b2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b33:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801b36:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801b3a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b42:	48 01 d0             	add    %rdx,%rax
+  801b45:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801b49:	eb 13                	jmp    801b5e <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801b4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b4f:	0f b6 00             	movzbl (%rax),%eax
+  801b52:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801b55:	38 d0                	cmp    %dl,%al
+  801b57:	74 11                	je     801b6a <memfind+0x57>
+	for (; s < ends; s++)
+  801b59:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801b5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b62:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b66:	72 e3                	jb     801b4b <memfind+0x38>
+  801b68:	eb 01                	jmp    801b6b <memfind+0x58>
+			break;
+  801b6a:	90                   	nop
+	return (void *) s;
+  801b6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b6f:	c9                   	leave
+  801b70:	c3                   	ret
+
+0000000000801b71 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	48 83 ec 38          	sub    $0x38,%rsp
+  801b79:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b79 <strtol+0x8>
+  801b80:	49 bb bf 64 00 00 00 	movabs $0x64bf,%r11
+  801b87:	00 00 00 
+  801b8a:	4c 01 d8             	add    %r11,%rax
+  801b8d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b91:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b95:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801b98:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b9f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801ba6:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801ba7:	eb 05                	jmp    801bae <strtol+0x3d>
+		s++;
+  801ba9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801bae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb2:	0f b6 00             	movzbl (%rax),%eax
+  801bb5:	3c 20                	cmp    $0x20,%al
+  801bb7:	74 f0                	je     801ba9 <strtol+0x38>
+  801bb9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bbd:	0f b6 00             	movzbl (%rax),%eax
+  801bc0:	3c 09                	cmp    $0x9,%al
+  801bc2:	74 e5                	je     801ba9 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801bc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc8:	0f b6 00             	movzbl (%rax),%eax
+  801bcb:	3c 2b                	cmp    $0x2b,%al
+  801bcd:	75 07                	jne    801bd6 <strtol+0x65>
+		s++;
+  801bcf:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bd4:	eb 17                	jmp    801bed <strtol+0x7c>
+	else if (*s == '-')
+  801bd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bda:	0f b6 00             	movzbl (%rax),%eax
+  801bdd:	3c 2d                	cmp    $0x2d,%al
+  801bdf:	75 0c                	jne    801bed <strtol+0x7c>
+		s++, neg = 1;
+  801be1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801be6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801bed:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bf1:	74 06                	je     801bf9 <strtol+0x88>
+  801bf3:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bf7:	75 28                	jne    801c21 <strtol+0xb0>
+  801bf9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bfd:	0f b6 00             	movzbl (%rax),%eax
+  801c00:	3c 30                	cmp    $0x30,%al
+  801c02:	75 1d                	jne    801c21 <strtol+0xb0>
+  801c04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c08:	48 83 c0 01          	add    $0x1,%rax
+  801c0c:	0f b6 00             	movzbl (%rax),%eax
+  801c0f:	3c 78                	cmp    $0x78,%al
+  801c11:	75 0e                	jne    801c21 <strtol+0xb0>
+		s += 2, base = 16;
+  801c13:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801c18:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801c1f:	eb 2c                	jmp    801c4d <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801c21:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c25:	75 19                	jne    801c40 <strtol+0xcf>
+  801c27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2b:	0f b6 00             	movzbl (%rax),%eax
+  801c2e:	3c 30                	cmp    $0x30,%al
+  801c30:	75 0e                	jne    801c40 <strtol+0xcf>
+		s++, base = 8;
+  801c32:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c37:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c3e:	eb 0d                	jmp    801c4d <strtol+0xdc>
+	else if (base == 0)
+  801c40:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c44:	75 07                	jne    801c4d <strtol+0xdc>
+		base = 10;
+  801c46:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801c4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c51:	0f b6 00             	movzbl (%rax),%eax
+  801c54:	3c 2f                	cmp    $0x2f,%al
+  801c56:	7e 1d                	jle    801c75 <strtol+0x104>
+  801c58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5c:	0f b6 00             	movzbl (%rax),%eax
+  801c5f:	3c 39                	cmp    $0x39,%al
+  801c61:	7f 12                	jg     801c75 <strtol+0x104>
+			dig = *s - '0';
+  801c63:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c67:	0f b6 00             	movzbl (%rax),%eax
+  801c6a:	0f be c0             	movsbl %al,%eax
+  801c6d:	83 e8 30             	sub    $0x30,%eax
+  801c70:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c73:	eb 4e                	jmp    801cc3 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801c75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c79:	0f b6 00             	movzbl (%rax),%eax
+  801c7c:	3c 60                	cmp    $0x60,%al
+  801c7e:	7e 1d                	jle    801c9d <strtol+0x12c>
+  801c80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c84:	0f b6 00             	movzbl (%rax),%eax
+  801c87:	3c 7a                	cmp    $0x7a,%al
+  801c89:	7f 12                	jg     801c9d <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801c8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8f:	0f b6 00             	movzbl (%rax),%eax
+  801c92:	0f be c0             	movsbl %al,%eax
+  801c95:	83 e8 57             	sub    $0x57,%eax
+  801c98:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c9b:	eb 26                	jmp    801cc3 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca1:	0f b6 00             	movzbl (%rax),%eax
+  801ca4:	3c 40                	cmp    $0x40,%al
+  801ca6:	7e 47                	jle    801cef <strtol+0x17e>
+  801ca8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cac:	0f b6 00             	movzbl (%rax),%eax
+  801caf:	3c 5a                	cmp    $0x5a,%al
+  801cb1:	7f 3c                	jg     801cef <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801cb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb7:	0f b6 00             	movzbl (%rax),%eax
+  801cba:	0f be c0             	movsbl %al,%eax
+  801cbd:	83 e8 37             	sub    $0x37,%eax
+  801cc0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801cc3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cc6:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801cc9:	7d 23                	jge    801cee <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801ccb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cd0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801cd3:	48 98                	cltq
+  801cd5:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cda:	48 89 c2             	mov    %rax,%rdx
+  801cdd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ce0:	48 98                	cltq
+  801ce2:	48 01 d0             	add    %rdx,%rax
+  801ce5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801ce9:	e9 5f ff ff ff       	jmp    801c4d <strtol+0xdc>
+			break;
+  801cee:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801cef:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cf4:	74 0b                	je     801d01 <strtol+0x190>
+		*endptr = (char *) s;
+  801cf6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cfa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cfe:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801d01:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801d05:	74 09                	je     801d10 <strtol+0x19f>
+  801d07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d0b:	48 f7 d8             	neg    %rax
+  801d0e:	eb 04                	jmp    801d14 <strtol+0x1a3>
+  801d10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801d14:	c9                   	leave
+  801d15:	c3                   	ret
+
+0000000000801d16 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801d16:	55                   	push   %rbp
+  801d17:	48 89 e5             	mov    %rsp,%rbp
+  801d1a:	53                   	push   %rbx
+  801d1b:	48 83 ec 30          	sub    $0x30,%rsp
+  801d1f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801d1f <strstr+0x9>
+  801d26:	49 bb 19 63 00 00 00 	movabs $0x6319,%r11
+  801d2d:	00 00 00 
+  801d30:	4c 01 db             	add    %r11,%rbx
+  801d33:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801d37:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801d3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d3f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d43:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d47:	0f b6 00             	movzbl (%rax),%eax
+  801d4a:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801d4d:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801d51:	75 06                	jne    801d59 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801d53:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d57:	eb 73                	jmp    801dcc <strstr+0xb6>
+
+	len = strlen(str);
+  801d59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d5d:	48 89 c7             	mov    %rax,%rdi
+  801d60:	48 b8 6b 94 ff ff ff 	movabs $0xffffffffffff946b,%rax
+  801d67:	ff ff ff 
+  801d6a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d6e:	ff d0                	call   *%rax
+  801d70:	48 98                	cltq
+  801d72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801d76:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d7a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d7e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d82:	0f b6 00             	movzbl (%rax),%eax
+  801d85:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801d88:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801d8c:	75 07                	jne    801d95 <strstr+0x7f>
+				return (char *) 0;
+  801d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d93:	eb 37                	jmp    801dcc <strstr+0xb6>
+		} while (sc != c);
+  801d95:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801d99:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801d9c:	75 d8                	jne    801d76 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801d9e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801da2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801da6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801daa:	48 89 ce             	mov    %rcx,%rsi
+  801dad:	48 89 c7             	mov    %rax,%rdi
+  801db0:	48 b8 1f 97 ff ff ff 	movabs $0xffffffffffff971f,%rax
+  801db7:	ff ff ff 
+  801dba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801dbe:	ff d0                	call   *%rax
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	75 b2                	jne    801d76 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801dc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc8:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801dcc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dd0:	c9                   	leave
+  801dd1:	c3                   	ret
+
+0000000000801dd2 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801dd2:	55                   	push   %rbp
+  801dd3:	48 89 e5             	mov    %rsp,%rbp
+  801dd6:	41 57                	push   %r15
+  801dd8:	53                   	push   %rbx
+  801dd9:	48 83 ec 40          	sub    $0x40,%rsp
+  801ddd:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801ddd <syscall+0xb>
+  801de4:	49 bb 5b 62 00 00 00 	movabs $0x625b,%r11
+  801deb:	00 00 00 
+  801dee:	4d 01 da             	add    %r11,%r10
+  801df1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801df4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801df7:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801dfb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801dff:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801e03:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801e07:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e0a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801e0e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e12:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801e16:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801e1a:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e1e:	4c 89 c3             	mov    %r8,%rbx
+  801e21:	cd 30                	int    $0x30
+  801e23:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801e27:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801e2b:	74 52                	je     801e7f <syscall+0xad>
+  801e2d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e32:	7e 4b                	jle    801e7f <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e34:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e38:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e3b:	49 89 d0             	mov    %rdx,%r8
+  801e3e:	89 c1                	mov    %eax,%ecx
+  801e40:	48 b8 30 e9 ff ff ff 	movabs $0xffffffffffffe930,%rax
+  801e47:	ff ff ff 
+  801e4a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e4e:	48 89 c2             	mov    %rax,%rdx
+  801e51:	be 23 00 00 00       	mov    $0x23,%esi
+  801e56:	48 b8 4d e9 ff ff ff 	movabs $0xffffffffffffe94d,%rax
+  801e5d:	ff ff ff 
+  801e60:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e64:	48 89 c7             	mov    %rax,%rdi
+  801e67:	4d 89 d7             	mov    %r10,%r15
+  801e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6f:	49 b9 66 84 ff ff ff 	movabs $0xffffffffffff8466,%r9
+  801e76:	ff ff ff 
+  801e79:	4d 01 d1             	add    %r10,%r9
+  801e7c:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e83:	48 83 c4 40          	add    $0x40,%rsp
+  801e87:	5b                   	pop    %rbx
+  801e88:	41 5f                	pop    %r15
+  801e8a:	5d                   	pop    %rbp
+  801e8b:	c3                   	ret
+
+0000000000801e8c <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801e8c:	55                   	push   %rbp
+  801e8d:	48 89 e5             	mov    %rsp,%rbp
+  801e90:	41 57                	push   %r15
+  801e92:	41 56                	push   %r14
+  801e94:	41 55                	push   %r13
+  801e96:	41 54                	push   %r12
+  801e98:	53                   	push   %rbx
+  801e99:	48 83 ec 48          	sub    $0x48,%rsp
+  801e9d:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801e9d <syscall_words+0x11>
+  801ea4:	49 bb 9b 61 00 00 00 	movabs $0x619b,%r11
+  801eab:	00 00 00 
+  801eae:	4d 01 de             	add    %r11,%r14
+  801eb1:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801eb4:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801eb7:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801ebb:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801ebf:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801ec3:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801ec7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ecc:	74 09                	je     801ed7 <syscall_words+0x4b>
+  801ece:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ed2:	48 8b 00             	mov    (%rax),%rax
+  801ed5:	eb 05                	jmp    801edc <syscall_words+0x50>
+  801ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801edc:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801edf:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ee4:	74 0a                	je     801ef0 <syscall_words+0x64>
+  801ee6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801eea:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801eee:	eb 05                	jmp    801ef5 <syscall_words+0x69>
+  801ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef5:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801ef8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801efd:	74 0a                	je     801f09 <syscall_words+0x7d>
+  801eff:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f03:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f07:	eb 05                	jmp    801f0e <syscall_words+0x82>
+  801f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0e:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801f11:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f16:	74 0a                	je     801f22 <syscall_words+0x96>
+  801f18:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f1c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f20:	eb 05                	jmp    801f27 <syscall_words+0x9b>
+  801f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f27:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801f2a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f2f:	74 0a                	je     801f3b <syscall_words+0xaf>
+  801f31:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f35:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f39:	eb 05                	jmp    801f40 <syscall_words+0xb4>
+  801f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f40:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801f43:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f48:	74 0a                	je     801f54 <syscall_words+0xc8>
+  801f4a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f4e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801f52:	eb 05                	jmp    801f59 <syscall_words+0xcd>
+  801f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f59:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801f5c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f5f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801f63:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f67:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801f6b:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801f6f:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f73:	cd 30                	int    $0x30
+  801f75:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801f79:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f7e:	74 50                	je     801fd0 <syscall_words+0x144>
+		words[0] = r8;
+  801f80:	4c 89 c2             	mov    %r8,%rdx
+  801f83:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f87:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801f8a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f8e:	48 83 c0 08          	add    $0x8,%rax
+  801f92:	4c 89 ca             	mov    %r9,%rdx
+  801f95:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801f98:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f9c:	48 83 c0 10          	add    $0x10,%rax
+  801fa0:	4c 89 d2             	mov    %r10,%rdx
+  801fa3:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801fa6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801faa:	48 83 c0 18          	add    $0x18,%rax
+  801fae:	4c 89 da             	mov    %r11,%rdx
+  801fb1:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801fb4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fb8:	48 83 c0 20          	add    $0x20,%rax
+  801fbc:	4c 89 e2             	mov    %r12,%rdx
+  801fbf:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801fc2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fc6:	48 83 c0 28          	add    $0x28,%rax
+  801fca:	4c 89 ea             	mov    %r13,%rdx
+  801fcd:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801fd0:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801fd4:	74 52                	je     802028 <syscall_words+0x19c>
+  801fd6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801fdb:	7e 4b                	jle    802028 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fdd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801fe1:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801fe4:	49 89 d0             	mov    %rdx,%r8
+  801fe7:	89 c1                	mov    %eax,%ecx
+  801fe9:	48 b8 30 e9 ff ff ff 	movabs $0xffffffffffffe930,%rax
+  801ff0:	ff ff ff 
+  801ff3:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801ff7:	48 89 c2             	mov    %rax,%rdx
+  801ffa:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801fff:	48 b8 4d e9 ff ff ff 	movabs $0xffffffffffffe94d,%rax
+  802006:	ff ff ff 
+  802009:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80200d:	48 89 c7             	mov    %rax,%rdi
+  802010:	4d 89 f7             	mov    %r14,%r15
+  802013:	b8 00 00 00 00       	mov    $0x0,%eax
+  802018:	49 b9 66 84 ff ff ff 	movabs $0xffffffffffff8466,%r9
+  80201f:	ff ff ff 
+  802022:	4d 01 f1             	add    %r14,%r9
+  802025:	41 ff d1             	call   *%r9
+
+	return ret;
+  802028:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80202c:	48 83 c4 48          	add    $0x48,%rsp
+  802030:	5b                   	pop    %rbx
+  802031:	41 5c                	pop    %r12
+  802033:	41 5d                	pop    %r13
+  802035:	41 5e                	pop    %r14
+  802037:	41 5f                	pop    %r15
+  802039:	5d                   	pop    %rbp
+  80203a:	c3                   	ret
+
+000000000080203b <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80203b:	55                   	push   %rbp
+  80203c:	48 89 e5             	mov    %rsp,%rbp
+  80203f:	48 83 ec 10          	sub    $0x10,%rsp
+  802043:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802043 <sys_cputs+0x8>
+  80204a:	49 bb f5 5f 00 00 00 	movabs $0x5ff5,%r11
+  802051:	00 00 00 
+  802054:	4c 01 d8             	add    %r11,%rax
+  802057:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80205b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80205f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802063:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802067:	48 83 ec 08          	sub    $0x8,%rsp
+  80206b:	6a 00                	push   $0x0
+  80206d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802073:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802079:	be 00 00 00 00       	mov    $0x0,%esi
+  80207e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802083:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80208a:	ff ff ff 
+  80208d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802091:	ff d0                	call   *%rax
+  802093:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802097:	90                   	nop
+  802098:	c9                   	leave
+  802099:	c3                   	ret
+
+000000000080209a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80209a:	55                   	push   %rbp
+  80209b:	48 89 e5             	mov    %rsp,%rbp
+  80209e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80209e <sys_cgetc+0x4>
+  8020a5:	49 bb 9a 5f 00 00 00 	movabs $0x5f9a,%r11
+  8020ac:	00 00 00 
+  8020af:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8020b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8020b6:	6a 00                	push   $0x0
+  8020b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020d8:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  8020df:	ff ff ff 
+  8020e2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020e6:	ff d0                	call   *%rax
+  8020e8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020ec:	c9                   	leave
+  8020ed:	c3                   	ret
+
+00000000008020ee <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8020ee:	55                   	push   %rbp
+  8020ef:	48 89 e5             	mov    %rsp,%rbp
+  8020f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020f6 <sys_env_destroy+0x8>
+  8020fd:	49 bb 42 5f 00 00 00 	movabs $0x5f42,%r11
+  802104:	00 00 00 
+  802107:	4c 01 d8             	add    %r11,%rax
+  80210a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80210d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802110:	48 63 d2             	movslq %edx,%rdx
+  802113:	48 83 ec 08          	sub    $0x8,%rsp
+  802117:	6a 00                	push   $0x0
+  802119:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80211f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802125:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80212a:	be 01 00 00 00       	mov    $0x1,%esi
+  80212f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802134:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80213b:	ff ff ff 
+  80213e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802142:	ff d0                	call   *%rax
+  802144:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802148:	c9                   	leave
+  802149:	c3                   	ret
+
+000000000080214a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80214a:	55                   	push   %rbp
+  80214b:	48 89 e5             	mov    %rsp,%rbp
+  80214e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80214e <sys_getenvid+0x4>
+  802155:	49 bb ea 5e 00 00 00 	movabs $0x5eea,%r11
+  80215c:	00 00 00 
+  80215f:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802162:	48 83 ec 08          	sub    $0x8,%rsp
+  802166:	6a 00                	push   $0x0
+  802168:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80216e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802174:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217e:	be 00 00 00 00       	mov    $0x0,%esi
+  802183:	bf 02 00 00 00       	mov    $0x2,%edi
+  802188:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80218f:	ff ff ff 
+  802192:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802196:	ff d0                	call   *%rax
+  802198:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80219c:	c9                   	leave
+  80219d:	c3                   	ret
+
+000000000080219e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80219e:	55                   	push   %rbp
+  80219f:	48 89 e5             	mov    %rsp,%rbp
+  8021a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021a2 <sys_yield+0x4>
+  8021a9:	49 bb 96 5e 00 00 00 	movabs $0x5e96,%r11
+  8021b0:	00 00 00 
+  8021b3:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8021b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ba:	6a 00                	push   $0x0
+  8021bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021dc:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  8021e3:	ff ff ff 
+  8021e6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021ea:	ff d0                	call   *%rax
+  8021ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021f0:	90                   	nop
+  8021f1:	c9                   	leave
+  8021f2:	c3                   	ret
+
+00000000008021f3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8021f3:	55                   	push   %rbp
+  8021f4:	48 89 e5             	mov    %rsp,%rbp
+  8021f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8021fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021fb <sys_page_alloc+0x8>
+  802202:	49 bb 3d 5e 00 00 00 	movabs $0x5e3d,%r11
+  802209:	00 00 00 
+  80220c:	4c 01 d8             	add    %r11,%rax
+  80220f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802212:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802216:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802219:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80221c:	48 63 f2             	movslq %edx,%rsi
+  80221f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802223:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802226:	48 63 d2             	movslq %edx,%rdx
+  802229:	48 83 ec 08          	sub    $0x8,%rsp
+  80222d:	6a 00                	push   $0x0
+  80222f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802235:	49 89 f0             	mov    %rsi,%r8
+  802238:	be 01 00 00 00       	mov    $0x1,%esi
+  80223d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802242:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  802249:	ff ff ff 
+  80224c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802250:	ff d0                	call   *%rax
+  802252:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802256:	c9                   	leave
+  802257:	c3                   	ret
+
+0000000000802258 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802258:	55                   	push   %rbp
+  802259:	48 89 e5             	mov    %rsp,%rbp
+  80225c:	48 83 ec 20          	sub    $0x20,%rsp
+  802260:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802260 <sys_page_map+0x8>
+  802267:	49 bb d8 5d 00 00 00 	movabs $0x5dd8,%r11
+  80226e:	00 00 00 
+  802271:	4c 01 d8             	add    %r11,%rax
+  802274:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802277:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80227b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80227e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802282:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802286:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802289:	48 63 f2             	movslq %edx,%rsi
+  80228c:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802290:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802293:	48 63 fa             	movslq %edx,%rdi
+  802296:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80229a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80229d:	48 63 d2             	movslq %edx,%rdx
+  8022a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a4:	56                   	push   %rsi
+  8022a5:	4d 89 c1             	mov    %r8,%r9
+  8022a8:	49 89 f8             	mov    %rdi,%r8
+  8022ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8022b0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8022b5:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  8022bc:	ff ff ff 
+  8022bf:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c3:	ff d0                	call   *%rax
+  8022c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c9:	c9                   	leave
+  8022ca:	c3                   	ret
+
+00000000008022cb <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8022cb:	55                   	push   %rbp
+  8022cc:	48 89 e5             	mov    %rsp,%rbp
+  8022cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d3 <sys_page_unmap+0x8>
+  8022da:	49 bb 65 5d 00 00 00 	movabs $0x5d65,%r11
+  8022e1:	00 00 00 
+  8022e4:	4c 01 d8             	add    %r11,%rax
+  8022e7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8022ee:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022f2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022f5:	48 63 d2             	movslq %edx,%rdx
+  8022f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8022fc:	6a 00                	push   $0x0
+  8022fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802304:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80230a:	be 01 00 00 00       	mov    $0x1,%esi
+  80230f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802314:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80231b:	ff ff ff 
+  80231e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802322:	ff d0                	call   *%rax
+  802324:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802328:	c9                   	leave
+  802329:	c3                   	ret
+
+000000000080232a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80232a:	55                   	push   %rbp
+  80232b:	48 89 e5             	mov    %rsp,%rbp
+  80232e:	48 83 ec 10          	sub    $0x10,%rsp
+  802332:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802332 <sys_env_set_status+0x8>
+  802339:	49 bb 06 5d 00 00 00 	movabs $0x5d06,%r11
+  802340:	00 00 00 
+  802343:	4c 01 d8             	add    %r11,%rax
+  802346:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802349:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80234c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80234f:	48 63 ca             	movslq %edx,%rcx
+  802352:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802355:	48 63 d2             	movslq %edx,%rdx
+  802358:	48 83 ec 08          	sub    $0x8,%rsp
+  80235c:	6a 00                	push   $0x0
+  80235e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802364:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80236a:	be 01 00 00 00       	mov    $0x1,%esi
+  80236f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802374:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80237b:	ff ff ff 
+  80237e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802382:	ff d0                	call   *%rax
+  802384:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802388:	c9                   	leave
+  802389:	c3                   	ret
+
+000000000080238a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80238a:	55                   	push   %rbp
+  80238b:	48 89 e5             	mov    %rsp,%rbp
+  80238e:	48 83 ec 10          	sub    $0x10,%rsp
+  802392:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802392 <sys_env_set_trapframe+0x8>
+  802399:	49 bb a6 5c 00 00 00 	movabs $0x5ca6,%r11
+  8023a0:	00 00 00 
+  8023a3:	4c 01 d8             	add    %r11,%rax
+  8023a6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023a9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8023ad:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023b1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023b4:	48 63 d2             	movslq %edx,%rdx
+  8023b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8023bb:	6a 00                	push   $0x0
+  8023bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ce:	bf 09 00 00 00       	mov    $0x9,%edi
+  8023d3:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  8023da:	ff ff ff 
+  8023dd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023e1:	ff d0                	call   *%rax
+  8023e3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e7:	c9                   	leave
+  8023e8:	c3                   	ret
+
+00000000008023e9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8023e9:	55                   	push   %rbp
+  8023ea:	48 89 e5             	mov    %rsp,%rbp
+  8023ed:	48 83 ec 10          	sub    $0x10,%rsp
+  8023f1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023f1 <sys_env_set_pgfault_upcall+0x8>
+  8023f8:	49 bb 47 5c 00 00 00 	movabs $0x5c47,%r11
+  8023ff:	00 00 00 
+  802402:	4c 01 d8             	add    %r11,%rax
+  802405:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802408:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80240c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802410:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802413:	48 63 d2             	movslq %edx,%rdx
+  802416:	48 83 ec 08          	sub    $0x8,%rsp
+  80241a:	6a 00                	push   $0x0
+  80241c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802422:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802428:	be 01 00 00 00       	mov    $0x1,%esi
+  80242d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802432:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  802439:	ff ff ff 
+  80243c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802440:	ff d0                	call   *%rax
+  802442:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802446:	c9                   	leave
+  802447:	c3                   	ret
+
+0000000000802448 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802448:	55                   	push   %rbp
+  802449:	48 89 e5             	mov    %rsp,%rbp
+  80244c:	48 83 ec 20          	sub    $0x20,%rsp
+  802450:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802450 <sys_ipc_try_send+0x8>
+  802457:	49 bb e8 5b 00 00 00 	movabs $0x5be8,%r11
+  80245e:	00 00 00 
+  802461:	4c 01 d8             	add    %r11,%rax
+  802464:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802467:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80246b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80246f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802472:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802475:	48 63 fa             	movslq %edx,%rdi
+  802478:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80247c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80247f:	48 63 d2             	movslq %edx,%rdx
+  802482:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802486:	48 83 ec 08          	sub    $0x8,%rsp
+  80248a:	6a 00                	push   $0x0
+  80248c:	49 89 f9             	mov    %rdi,%r9
+  80248f:	49 89 f0             	mov    %rsi,%r8
+  802492:	be 00 00 00 00       	mov    $0x0,%esi
+  802497:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80249c:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  8024a3:	ff ff ff 
+  8024a6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024aa:	ff d0                	call   *%rax
+  8024ac:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024b0:	c9                   	leave
+  8024b1:	c3                   	ret
+
+00000000008024b2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8024b2:	55                   	push   %rbp
+  8024b3:	48 89 e5             	mov    %rsp,%rbp
+  8024b6:	48 83 ec 20          	sub    $0x20,%rsp
+  8024ba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024ba <sys_ipc_send+0x8>
+  8024c1:	49 bb 7e 5b 00 00 00 	movabs $0x5b7e,%r11
+  8024c8:	00 00 00 
+  8024cb:	4c 01 d8             	add    %r11,%rax
+  8024ce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024d5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024d9:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8024dc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024df:	48 63 fa             	movslq %edx,%rdi
+  8024e2:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024e6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024e9:	48 63 d2             	movslq %edx,%rdx
+  8024ec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f4:	6a 00                	push   $0x0
+  8024f6:	49 89 f9             	mov    %rdi,%r9
+  8024f9:	49 89 f0             	mov    %rsi,%r8
+  8024fc:	be 00 00 00 00       	mov    $0x0,%esi
+  802501:	bf 17 00 00 00       	mov    $0x17,%edi
+  802506:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80250d:	ff ff ff 
+  802510:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802514:	ff d0                	call   *%rax
+  802516:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80251a:	c9                   	leave
+  80251b:	c3                   	ret
+
+000000000080251c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80251c:	55                   	push   %rbp
+  80251d:	48 89 e5             	mov    %rsp,%rbp
+  802520:	48 83 ec 10          	sub    $0x10,%rsp
+  802524:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802524 <sys_ipc_recv+0x8>
+  80252b:	49 bb 14 5b 00 00 00 	movabs $0x5b14,%r11
+  802532:	00 00 00 
+  802535:	4c 01 d8             	add    %r11,%rax
+  802538:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80253c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802540:	6a 00                	push   $0x0
+  802542:	6a 00                	push   $0x0
+  802544:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80254a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802555:	be 01 00 00 00       	mov    $0x1,%esi
+  80255a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80255f:	49 ba 54 9e ff ff ff 	movabs $0xffffffffffff9e54,%r10
+  802566:	ff ff ff 
+  802569:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80256d:	ff d0                	call   *%rax
+  80256f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802573:	c9                   	leave
+  802574:	c3                   	ret
+
+0000000000802575 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802575:	55                   	push   %rbp
+  802576:	48 89 e5             	mov    %rsp,%rbp
+  802579:	48 83 ec 30          	sub    $0x30,%rsp
+  80257d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80257d <sys_ipc_call+0x8>
+  802584:	49 bb bb 5a 00 00 00 	movabs $0x5abb,%r11
+  80258b:	00 00 00 
+  80258e:	4c 01 d8             	add    %r11,%rax
+  802591:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802594:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802598:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80259c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80259f:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8025a3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8025a7:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8025ab:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025ae:	4c 63 c2             	movslq %edx,%r8
+  8025b1:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8025b5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025b8:	48 63 d2             	movslq %edx,%rdx
+  8025bb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025bf:	ff 75 d8             	push   -0x28(%rbp)
+  8025c2:	56                   	push   %rsi
+  8025c3:	4d 89 c1             	mov    %r8,%r9
+  8025c6:	49 89 f8             	mov    %rdi,%r8
+  8025c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ce:	bf 18 00 00 00       	mov    $0x18,%edi
+  8025d3:	49 ba 54 9e ff ff ff 	movabs $0xffffffffffff9e54,%r10
+  8025da:	ff ff ff 
+  8025dd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025e1:	ff d0                	call   *%rax
+  8025e3:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8025e7:	c9                   	leave
+  8025e8:	c3                   	ret
+
+00000000008025e9 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8025e9:	55                   	push   %rbp
+  8025ea:	48 89 e5             	mov    %rsp,%rbp
+  8025ed:	48 83 ec 30          	sub    $0x30,%rsp
+  8025f1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025f1 <sys_ipc_reply_recv+0x8>
+  8025f8:	49 bb 47 5a 00 00 00 	movabs $0x5a47,%r11
+  8025ff:	00 00 00 
+  802602:	4c 01 d8             	add    %r11,%rax
+  802605:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802608:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80260c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802610:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802613:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802617:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80261b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80261f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802622:	4c 63 c2             	movslq %edx,%r8
+  802625:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802629:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80262c:	48 63 d2             	movslq %edx,%rdx
+  80262f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802633:	ff 75 d8             	push   -0x28(%rbp)
+  802636:	56                   	push   %rsi
+  802637:	4d 89 c1             	mov    %r8,%r9
+  80263a:	49 89 f8             	mov    %rdi,%r8
+  80263d:	be 00 00 00 00       	mov    $0x0,%esi
+  802642:	bf 19 00 00 00       	mov    $0x19,%edi
+  802647:	49 ba 54 9e ff ff ff 	movabs $0xffffffffffff9e54,%r10
+  80264e:	ff ff ff 
+  802651:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802655:	ff d0                	call   *%rax
+  802657:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80265b:	c9                   	leave
+  80265c:	c3                   	ret
+
+000000000080265d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80265d:	55                   	push   %rbp
+  80265e:	48 89 e5             	mov    %rsp,%rbp
+  802661:	48 83 ec 10          	sub    $0x10,%rsp
+  802665:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802665 <sys_env_set_priority+0x8>
+  80266c:	49 bb d3 59 00 00 00 	movabs $0x59d3,%r11
+  802673:	00 00 00 
+  802676:	4c 01 d8             	add    %r11,%rax
+  802679:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80267c:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80267f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802682:	48 63 ca             	movslq %edx,%rcx
+  802685:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802688:	48 63 d2             	movslq %edx,%rdx
+  80268b:	48 83 ec 08          	sub    $0x8,%rsp
+  80268f:	6a 00                	push   $0x0
+  802691:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802697:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80269d:	be 01 00 00 00       	mov    $0x1,%esi
+  8026a2:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8026a7:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  8026ae:	ff ff ff 
+  8026b1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026b5:	ff d0                	call   *%rax
+  8026b7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026bb:	c9                   	leave
+  8026bc:	c3                   	ret
+
+00000000008026bd <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8026bd:	55                   	push   %rbp
+  8026be:	48 89 e5             	mov    %rsp,%rbp
+  8026c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8026c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026c5 <sys_env_set_affinity+0x8>
+  8026cc:	49 bb 73 59 00 00 00 	movabs $0x5973,%r11
+  8026d3:	00 00 00 
+  8026d6:	4c 01 d8             	add    %r11,%rax
+  8026d9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026dc:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8026df:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8026e2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026e5:	48 63 d2             	movslq %edx,%rdx
+  8026e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ec:	6a 00                	push   $0x0
+  8026ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8026ff:	bf 10 00 00 00       	mov    $0x10,%edi
+  802704:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80270b:	ff ff ff 
+  80270e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802712:	ff d0                	call   *%rax
+  802714:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802718:	c9                   	leave
+  802719:	c3                   	ret
+
+000000000080271a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80271a:	55                   	push   %rbp
+  80271b:	48 89 e5             	mov    %rsp,%rbp
+  80271e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80271e <sys_time_msec+0x4>
+  802725:	49 bb 1a 59 00 00 00 	movabs $0x591a,%r11
+  80272c:	00 00 00 
+  80272f:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802732:	48 83 ec 08          	sub    $0x8,%rsp
+  802736:	6a 00                	push   $0x0
+  802738:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80273e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802744:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802749:	ba 00 00 00 00       	mov    $0x0,%edx
+  80274e:	be 00 00 00 00       	mov    $0x0,%esi
+  802753:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802758:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80275f:	ff ff ff 
+  802762:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802766:	ff d0                	call   *%rax
+  802768:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80276c:	c9                   	leave
+  80276d:	c3                   	ret
+
+000000000080276e <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80276e:	55                   	push   %rbp
+  80276f:	48 89 e5             	mov    %rsp,%rbp
+  802772:	48 83 ec 10          	sub    $0x10,%rsp
+  802776:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802776 <sys_sleep_usec+0x8>
+  80277d:	49 bb c2 58 00 00 00 	movabs $0x58c2,%r11
+  802784:	00 00 00 
+  802787:	4c 01 d8             	add    %r11,%rax
+  80278a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80278e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802792:	48 83 ec 08          	sub    $0x8,%rsp
+  802796:	6a 00                	push   $0x0
+  802798:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80279e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ae:	bf 11 00 00 00       	mov    $0x11,%edi
+  8027b3:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  8027ba:	ff ff ff 
+  8027bd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027c1:	ff d0                	call   *%rax
+  8027c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027c7:	c9                   	leave
+  8027c8:	c3                   	ret
+
+00000000008027c9 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8027c9:	55                   	push   %rbp
+  8027ca:	48 89 e5             	mov    %rsp,%rbp
+  8027cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8027d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027d1 <sys_page_alloc_huge+0x8>
+  8027d8:	49 bb 67 58 00 00 00 	movabs $0x5867,%r11
+  8027df:	00 00 00 
+  8027e2:	4c 01 d8             	add    %r11,%rax
+  8027e5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027e8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027ec:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8027ef:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027f2:	48 63 f2             	movslq %edx,%rsi
+  8027f5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027f9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027fc:	48 63 d2             	movslq %edx,%rdx
+  8027ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802803:	6a 00                	push   $0x0
+  802805:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80280b:	49 89 f0             	mov    %rsi,%r8
+  80280e:	be 01 00 00 00       	mov    $0x1,%esi
+  802813:	bf 12 00 00 00       	mov    $0x12,%edi
+  802818:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80281f:	ff ff ff 
+  802822:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802826:	ff d0                	call   *%rax
+  802828:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80282c:	c9                   	leave
+  80282d:	c3                   	ret
+
+000000000080282e <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80282e:	55                   	push   %rbp
+  80282f:	48 89 e5             	mov    %rsp,%rbp
+  802832:	48 83 ec 10          	sub    $0x10,%rsp
+  802836:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802836 <sys_page_map_batch+0x8>
+  80283d:	49 bb 02 58 00 00 00 	movabs $0x5802,%r11
+  802844:	00 00 00 
+  802847:	4c 01 d8             	add    %r11,%rax
+  80284a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80284e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802852:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802856:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80285a:	48 83 ec 08          	sub    $0x8,%rsp
+  80285e:	6a 00                	push   $0x0
+  802860:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802866:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80286c:	be 01 00 00 00       	mov    $0x1,%esi
+  802871:	bf 13 00 00 00       	mov    $0x13,%edi
+  802876:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80287d:	ff ff ff 
+  802880:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802884:	ff d0                	call   *%rax
+  802886:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80288a:	c9                   	leave
+  80288b:	c3                   	ret
+
+000000000080288c <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80288c:	55                   	push   %rbp
+  80288d:	48 89 e5             	mov    %rsp,%rbp
+  802890:	48 83 ec 10          	sub    $0x10,%rsp
+  802894:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802894 <sys_page_alloc_batch+0x8>
+  80289b:	49 bb a4 57 00 00 00 	movabs $0x57a4,%r11
+  8028a2:	00 00 00 
+  8028a5:	4c 01 d8             	add    %r11,%rax
+  8028a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8028b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028b4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028bc:	6a 00                	push   $0x0
+  8028be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8028cf:	bf 14 00 00 00       	mov    $0x14,%edi
+  8028d4:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  8028db:	ff ff ff 
+  8028de:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028e2:	ff d0                	call   *%rax
+  8028e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028e8:	c9                   	leave
+  8028e9:	c3                   	ret
+
+00000000008028ea <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8028ea:	55                   	push   %rbp
+  8028eb:	48 89 e5             	mov    %rsp,%rbp
+  8028ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8028f2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028f2 <sys_page_unmap_batch+0x8>
+  8028f9:	49 bb 46 57 00 00 00 	movabs $0x5746,%r11
+  802900:	00 00 00 
+  802903:	4c 01 d8             	add    %r11,%rax
+  802906:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80290a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80290e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802912:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802916:	48 83 ec 08          	sub    $0x8,%rsp
+  80291a:	6a 00                	push   $0x0
+  80291c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802922:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802928:	be 01 00 00 00       	mov    $0x1,%esi
+  80292d:	bf 15 00 00 00       	mov    $0x15,%edi
+  802932:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  802939:	ff ff ff 
+  80293c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802940:	ff d0                	call   *%rax
+  802942:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802946:	c9                   	leave
+  802947:	c3                   	ret
+
+0000000000802948 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802948:	55                   	push   %rbp
+  802949:	48 89 e5             	mov    %rsp,%rbp
+  80294c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80294c <sys_fork+0x4>
+  802953:	49 bb ec 56 00 00 00 	movabs $0x56ec,%r11
+  80295a:	00 00 00 
+  80295d:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802960:	48 83 ec 08          	sub    $0x8,%rsp
+  802964:	6a 00                	push   $0x0
+  802966:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80296c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802972:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297c:	be 00 00 00 00       	mov    $0x0,%esi
+  802981:	bf 16 00 00 00       	mov    $0x16,%edi
+  802986:	49 ba 9a 9d ff ff ff 	movabs $0xffffffffffff9d9a,%r10
+  80298d:	ff ff ff 
+  802990:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802994:	ff d0                	call   *%rax
+  802996:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80299a:	c9                   	leave
+  80299b:	c3                   	ret
+
+000000000080299c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  80299c:	55                   	push   %rbp
+  80299d:	48 89 e5             	mov    %rsp,%rbp
+  8029a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029a4 <fd2num+0x8>
+  8029ab:	49 bb 94 56 00 00 00 	movabs $0x5694,%r11
+  8029b2:	00 00 00 
+  8029b5:	4c 01 d8             	add    %r11,%rax
+  8029b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8029bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029c0:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8029c7:	ff ff ff 
+  8029ca:	48 01 d0             	add    %rdx,%rax
+  8029cd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8029d1:	c9                   	leave
+  8029d2:	c3                   	ret
+
+00000000008029d3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8029d3:	55                   	push   %rbp
+  8029d4:	48 89 e5             	mov    %rsp,%rbp
+  8029d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029db <fd2data+0x8>
+  8029e2:	49 bb 5d 56 00 00 00 	movabs $0x565d,%r11
+  8029e9:	00 00 00 
+  8029ec:	4c 01 d8             	add    %r11,%rax
+  8029ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8029f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029f7:	48 89 d7             	mov    %rdx,%rdi
+  8029fa:	48 ba 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rdx
+  802a01:	ff ff ff 
+  802a04:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  802a08:	ff d0                	call   *%rax
+  802a0a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802a10:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802a14:	c9                   	leave
+  802a15:	c3                   	ret
+
+0000000000802a16 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802a16:	55                   	push   %rbp
+  802a17:	48 89 e5             	mov    %rsp,%rbp
+  802a1a:	48 83 ec 18          	sub    $0x18,%rsp
+  802a1e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a1e <fd_alloc+0x8>
+  802a25:	49 bb 1a 56 00 00 00 	movabs $0x561a,%r11
+  802a2c:	00 00 00 
+  802a2f:	4c 01 d8             	add    %r11,%rax
+  802a32:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802a36:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a3d:	eb 75                	jmp    802ab4 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802a3f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a42:	48 63 d2             	movslq %edx,%rdx
+  802a45:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802a4c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802a50:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802a54:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a58:	48 89 d1             	mov    %rdx,%rcx
+  802a5b:	48 c1 e9 15          	shr    $0x15,%rcx
+  802a5f:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802a66:	ff ff ff 
+  802a69:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a6d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a71:	83 e2 01             	and    $0x1,%edx
+  802a74:	48 85 d2             	test   %rdx,%rdx
+  802a77:	74 25                	je     802a9e <fd_alloc+0x88>
+  802a79:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a7d:	48 89 d1             	mov    %rdx,%rcx
+  802a80:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802a84:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802a8b:	ff ff ff 
+  802a8e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a92:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a96:	83 e2 01             	and    $0x1,%edx
+  802a99:	48 85 d2             	test   %rdx,%rdx
+  802a9c:	75 12                	jne    802ab0 <fd_alloc+0x9a>
+			*fd_store = fd;
+  802a9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802aa2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802aa6:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aae:	eb 1a                	jmp    802aca <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  802ab0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802ab4:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802ab8:	7e 85                	jle    802a3f <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802aba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802abe:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802ac5:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802aca:	c9                   	leave
+  802acb:	c3                   	ret
+
+0000000000802acc <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802acc:	55                   	push   %rbp
+  802acd:	48 89 e5             	mov    %rsp,%rbp
+  802ad0:	48 83 ec 20          	sub    $0x20,%rsp
+  802ad4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ad4 <fd_lookup+0x8>
+  802adb:	49 bb 64 55 00 00 00 	movabs $0x5564,%r11
+  802ae2:	00 00 00 
+  802ae5:	4c 01 d8             	add    %r11,%rax
+  802ae8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802aeb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802aef:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802af3:	78 06                	js     802afb <fd_lookup+0x2f>
+  802af5:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802af9:	7e 07                	jle    802b02 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802afb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b00:	eb 73                	jmp    802b75 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802b02:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802b05:	48 63 d2             	movslq %edx,%rdx
+  802b08:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802b0f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802b13:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802b17:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b1b:	48 89 d1             	mov    %rdx,%rcx
+  802b1e:	48 c1 e9 15          	shr    $0x15,%rcx
+  802b22:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802b29:	ff ff ff 
+  802b2c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802b30:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802b34:	83 e2 01             	and    $0x1,%edx
+  802b37:	48 85 d2             	test   %rdx,%rdx
+  802b3a:	74 22                	je     802b5e <fd_lookup+0x92>
+  802b3c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b40:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802b44:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  802b4b:	ff ff ff 
+  802b4e:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802b52:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b56:	83 e0 01             	and    $0x1,%eax
+  802b59:	48 85 c0             	test   %rax,%rax
+  802b5c:	75 07                	jne    802b65 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802b5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b63:	eb 10                	jmp    802b75 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802b65:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b69:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b6d:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802b70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b75:	c9                   	leave
+  802b76:	c3                   	ret
+
+0000000000802b77 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802b77:	55                   	push   %rbp
+  802b78:	48 89 e5             	mov    %rsp,%rbp
+  802b7b:	41 57                	push   %r15
+  802b7d:	53                   	push   %rbx
+  802b7e:	48 83 ec 30          	sub    $0x30,%rsp
+  802b82:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b82 <fd_close+0xb>
+  802b89:	49 bb b6 54 00 00 00 	movabs $0x54b6,%r11
+  802b90:	00 00 00 
+  802b93:	4c 01 db             	add    %r11,%rbx
+  802b96:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802b9a:	89 f0                	mov    %esi,%eax
+  802b9c:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802b9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ba3:	48 89 c7             	mov    %rax,%rdi
+  802ba6:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  802bad:	ff ff ff 
+  802bb0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bb4:	ff d0                	call   *%rax
+  802bb6:	89 c2                	mov    %eax,%edx
+  802bb8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802bbc:	48 89 c6             	mov    %rax,%rsi
+  802bbf:	89 d7                	mov    %edx,%edi
+  802bc1:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  802bc8:	ff ff ff 
+  802bcb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bcf:	ff d0                	call   *%rax
+  802bd1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bd4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802bd8:	78 0a                	js     802be4 <fd_close+0x6d>
+	    || fd != fd2)
+  802bda:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bde:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802be2:	74 12                	je     802bf6 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802be4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802be8:	74 05                	je     802bef <fd_close+0x78>
+  802bea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bed:	eb 7a                	jmp    802c69 <fd_close+0xf2>
+  802bef:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf4:	eb 73                	jmp    802c69 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802bf6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bfa:	8b 00                	mov    (%rax),%eax
+  802bfc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802c00:	48 89 d6             	mov    %rdx,%rsi
+  802c03:	89 c7                	mov    %eax,%edi
+  802c05:	48 b8 3a ac ff ff ff 	movabs $0xffffffffffffac3a,%rax
+  802c0c:	ff ff ff 
+  802c0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c13:	ff d0                	call   *%rax
+  802c15:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c18:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c1c:	78 2a                	js     802c48 <fd_close+0xd1>
+		if (dev->dev_close)
+  802c1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c22:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802c26:	48 85 c0             	test   %rax,%rax
+  802c29:	74 16                	je     802c41 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802c2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c2f:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802c33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c37:	48 89 c7             	mov    %rax,%rdi
+  802c3a:	ff d2                	call   *%rdx
+  802c3c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c3f:	eb 07                	jmp    802c48 <fd_close+0xd1>
+		else
+			r = 0;
+  802c41:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802c48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c4c:	48 89 c6             	mov    %rax,%rsi
+  802c4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c54:	49 89 df             	mov    %rbx,%r15
+  802c57:	48 b8 93 a2 ff ff ff 	movabs $0xffffffffffffa293,%rax
+  802c5e:	ff ff ff 
+  802c61:	48 01 d8             	add    %rbx,%rax
+  802c64:	ff d0                	call   *%rax
+	return r;
+  802c66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802c69:	48 83 c4 30          	add    $0x30,%rsp
+  802c6d:	5b                   	pop    %rbx
+  802c6e:	41 5f                	pop    %r15
+  802c70:	5d                   	pop    %rbp
+  802c71:	c3                   	ret
+
+0000000000802c72 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802c72:	55                   	push   %rbp
+  802c73:	48 89 e5             	mov    %rsp,%rbp
+  802c76:	41 57                	push   %r15
+  802c78:	48 83 ec 28          	sub    $0x28,%rsp
+  802c7c:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802c7c <dev_lookup+0xa>
+  802c83:	49 bb bc 53 00 00 00 	movabs $0x53bc,%r11
+  802c8a:	00 00 00 
+  802c8d:	4c 01 d9             	add    %r11,%rcx
+  802c90:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c93:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802c97:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802c9e:	eb 45                	jmp    802ce5 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802ca0:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802ca7:	00 00 00 
+  802caa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cad:	48 98                	cltq
+  802caf:	48 01 ca             	add    %rcx,%rdx
+  802cb2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cb6:	8b 00                	mov    (%rax),%eax
+  802cb8:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802cbb:	75 24                	jne    802ce1 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802cbd:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802cc4:	00 00 00 
+  802cc7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cca:	48 98                	cltq
+  802ccc:	48 01 ca             	add    %rcx,%rdx
+  802ccf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802cd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cd7:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802cda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cdf:	eb 74                	jmp    802d55 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802ce1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802ce5:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802cec:	00 00 00 
+  802cef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cf2:	48 98                	cltq
+  802cf4:	48 01 ca             	add    %rcx,%rdx
+  802cf7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802cfb:	48 85 c0             	test   %rax,%rax
+  802cfe:	75 a0                	jne    802ca0 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802d00:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802d07:	ff ff ff 
+  802d0a:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802d0e:	48 8b 00             	mov    (%rax),%rax
+  802d11:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802d17:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802d1a:	89 c6                	mov    %eax,%esi
+  802d1c:	48 b8 60 e9 ff ff ff 	movabs $0xffffffffffffe960,%rax
+  802d23:	ff ff ff 
+  802d26:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802d2a:	48 89 c7             	mov    %rax,%rdi
+  802d2d:	49 89 cf             	mov    %rcx,%r15
+  802d30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d35:	49 b8 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%r8
+  802d3c:	ff ff ff 
+  802d3f:	49 01 c8             	add    %rcx,%r8
+  802d42:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802d45:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d49:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802d50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802d55:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802d59:	c9                   	leave
+  802d5a:	c3                   	ret
+
+0000000000802d5b <close>:
+
+int
+close(int fdnum)
+{
+  802d5b:	55                   	push   %rbp
+  802d5c:	48 89 e5             	mov    %rsp,%rbp
+  802d5f:	53                   	push   %rbx
+  802d60:	48 83 ec 28          	sub    $0x28,%rsp
+  802d64:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d64 <close+0x9>
+  802d6b:	49 bb d4 52 00 00 00 	movabs $0x52d4,%r11
+  802d72:	00 00 00 
+  802d75:	4c 01 db             	add    %r11,%rbx
+  802d78:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d7b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802d7f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d82:	48 89 d6             	mov    %rdx,%rsi
+  802d85:	89 c7                	mov    %eax,%edi
+  802d87:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  802d8e:	ff ff ff 
+  802d91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d95:	ff d0                	call   *%rax
+  802d97:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d9a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d9e:	79 05                	jns    802da5 <close+0x4a>
+		return r;
+  802da0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802da3:	eb 1c                	jmp    802dc1 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802da5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802da9:	be 01 00 00 00       	mov    $0x1,%esi
+  802dae:	48 89 c7             	mov    %rax,%rdi
+  802db1:	48 b8 3f ab ff ff ff 	movabs $0xffffffffffffab3f,%rax
+  802db8:	ff ff ff 
+  802dbb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dbf:	ff d0                	call   *%rax
+}
+  802dc1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc5:	c9                   	leave
+  802dc6:	c3                   	ret
+
+0000000000802dc7 <close_all>:
+
+void
+close_all(void)
+{
+  802dc7:	55                   	push   %rbp
+  802dc8:	48 89 e5             	mov    %rsp,%rbp
+  802dcb:	53                   	push   %rbx
+  802dcc:	48 83 ec 18          	sub    $0x18,%rsp
+  802dd0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dd0 <close_all+0x9>
+  802dd7:	49 bb 68 52 00 00 00 	movabs $0x5268,%r11
+  802dde:	00 00 00 
+  802de1:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802de4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802deb:	eb 19                	jmp    802e06 <close_all+0x3f>
+		close(i);
+  802ded:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802df0:	89 c7                	mov    %eax,%edi
+  802df2:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  802df9:	ff ff ff 
+  802dfc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e00:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802e02:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802e06:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802e0a:	7e e1                	jle    802ded <close_all+0x26>
+}
+  802e0c:	90                   	nop
+  802e0d:	90                   	nop
+  802e0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e12:	c9                   	leave
+  802e13:	c3                   	ret
+
+0000000000802e14 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802e14:	55                   	push   %rbp
+  802e15:	48 89 e5             	mov    %rsp,%rbp
+  802e18:	41 57                	push   %r15
+  802e1a:	53                   	push   %rbx
+  802e1b:	48 83 ec 40          	sub    $0x40,%rsp
+  802e1f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e1f <dup+0xb>
+  802e26:	49 bb 19 52 00 00 00 	movabs $0x5219,%r11
+  802e2d:	00 00 00 
+  802e30:	4c 01 db             	add    %r11,%rbx
+  802e33:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802e36:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802e39:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e3d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802e40:	48 89 d6             	mov    %rdx,%rsi
+  802e43:	89 c7                	mov    %eax,%edi
+  802e45:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  802e4c:	ff ff ff 
+  802e4f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e53:	ff d0                	call   *%rax
+  802e55:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e58:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e5c:	79 08                	jns    802e66 <dup+0x52>
+		return r;
+  802e5e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e61:	e9 a4 01 00 00       	jmp    80300a <dup+0x1f6>
+	close(newfdnum);
+  802e66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e69:	89 c7                	mov    %eax,%edi
+  802e6b:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  802e72:	ff ff ff 
+  802e75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e79:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802e7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e7e:	48 98                	cltq
+  802e80:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802e86:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e8a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802e8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e92:	48 89 c7             	mov    %rax,%rdi
+  802e95:	48 b8 9b a9 ff ff ff 	movabs $0xffffffffffffa99b,%rax
+  802e9c:	ff ff ff 
+  802e9f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ea3:	ff d0                	call   *%rax
+  802ea5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802ea9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ead:	48 89 c7             	mov    %rax,%rdi
+  802eb0:	48 b8 9b a9 ff ff ff 	movabs $0xffffffffffffa99b,%rax
+  802eb7:	ff ff ff 
+  802eba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ebe:	ff d0                	call   *%rax
+  802ec0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802ec4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ec8:	48 c1 e8 15          	shr    $0x15,%rax
+  802ecc:	48 89 c2             	mov    %rax,%rdx
+  802ecf:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802ed6:	ff ff ff 
+  802ed9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802edd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ee1:	83 e0 01             	and    $0x1,%eax
+  802ee4:	48 85 c0             	test   %rax,%rax
+  802ee7:	74 7f                	je     802f68 <dup+0x154>
+  802ee9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802eed:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ef1:	48 89 c2             	mov    %rax,%rdx
+  802ef4:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802efb:	ff ff ff 
+  802efe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f02:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f06:	83 e0 01             	and    $0x1,%eax
+  802f09:	48 85 c0             	test   %rax,%rax
+  802f0c:	74 5a                	je     802f68 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802f0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f12:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f16:	48 89 c2             	mov    %rax,%rdx
+  802f19:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f20:	ff ff ff 
+  802f23:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f27:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f2b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f30:	89 c1                	mov    %eax,%ecx
+  802f32:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f3a:	41 89 c8             	mov    %ecx,%r8d
+  802f3d:	48 89 d1             	mov    %rdx,%rcx
+  802f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f45:	48 89 c6             	mov    %rax,%rsi
+  802f48:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f4d:	49 89 df             	mov    %rbx,%r15
+  802f50:	48 b8 20 a2 ff ff ff 	movabs $0xffffffffffffa220,%rax
+  802f57:	ff ff ff 
+  802f5a:	48 01 d8             	add    %rbx,%rax
+  802f5d:	ff d0                	call   *%rax
+  802f5f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f62:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f66:	78 5f                	js     802fc7 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802f68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f6c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f70:	48 89 c2             	mov    %rax,%rdx
+  802f73:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f7a:	ff ff ff 
+  802f7d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f81:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f85:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f8a:	89 c1                	mov    %eax,%ecx
+  802f8c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f90:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802f94:	41 89 c8             	mov    %ecx,%r8d
+  802f97:	48 89 d1             	mov    %rdx,%rcx
+  802f9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9f:	48 89 c6             	mov    %rax,%rsi
+  802fa2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa7:	49 89 df             	mov    %rbx,%r15
+  802faa:	48 b8 20 a2 ff ff ff 	movabs $0xffffffffffffa220,%rax
+  802fb1:	ff ff ff 
+  802fb4:	48 01 d8             	add    %rbx,%rax
+  802fb7:	ff d0                	call   *%rax
+  802fb9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fbc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fc0:	78 08                	js     802fca <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802fc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802fc5:	eb 43                	jmp    80300a <dup+0x1f6>
+			goto err;
+  802fc7:	90                   	nop
+  802fc8:	eb 01                	jmp    802fcb <dup+0x1b7>
+		goto err;
+  802fca:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802fcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fcf:	48 89 c6             	mov    %rax,%rsi
+  802fd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd7:	49 89 df             	mov    %rbx,%r15
+  802fda:	48 b8 93 a2 ff ff ff 	movabs $0xffffffffffffa293,%rax
+  802fe1:	ff ff ff 
+  802fe4:	48 01 d8             	add    %rbx,%rax
+  802fe7:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802fe9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fed:	48 89 c6             	mov    %rax,%rsi
+  802ff0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ff5:	49 89 df             	mov    %rbx,%r15
+  802ff8:	48 b8 93 a2 ff ff ff 	movabs $0xffffffffffffa293,%rax
+  802fff:	ff ff ff 
+  803002:	48 01 d8             	add    %rbx,%rax
+  803005:	ff d0                	call   *%rax
+	return r;
+  803007:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80300a:	48 83 c4 40          	add    $0x40,%rsp
+  80300e:	5b                   	pop    %rbx
+  80300f:	41 5f                	pop    %r15
+  803011:	5d                   	pop    %rbp
+  803012:	c3                   	ret
+
+0000000000803013 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803013:	55                   	push   %rbp
+  803014:	48 89 e5             	mov    %rsp,%rbp
+  803017:	41 57                	push   %r15
+  803019:	53                   	push   %rbx
+  80301a:	48 83 ec 40          	sub    $0x40,%rsp
+  80301e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80301e <read+0xb>
+  803025:	49 bb 1a 50 00 00 00 	movabs $0x501a,%r11
+  80302c:	00 00 00 
+  80302f:	4c 01 db             	add    %r11,%rbx
+  803032:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803035:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803039:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80303d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803041:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803044:	48 89 d6             	mov    %rdx,%rsi
+  803047:	89 c7                	mov    %eax,%edi
+  803049:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  803050:	ff ff ff 
+  803053:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803057:	ff d0                	call   *%rax
+  803059:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80305c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803060:	78 28                	js     80308a <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803062:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803066:	8b 00                	mov    (%rax),%eax
+  803068:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80306c:	48 89 d6             	mov    %rdx,%rsi
+  80306f:	89 c7                	mov    %eax,%edi
+  803071:	48 b8 3a ac ff ff ff 	movabs $0xffffffffffffac3a,%rax
+  803078:	ff ff ff 
+  80307b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80307f:	ff d0                	call   *%rax
+  803081:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803084:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803088:	79 08                	jns    803092 <read+0x7f>
+		return r;
+  80308a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80308d:	e9 8b 00 00 00       	jmp    80311d <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803092:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803096:	8b 40 08             	mov    0x8(%rax),%eax
+  803099:	83 e0 03             	and    $0x3,%eax
+  80309c:	83 f8 01             	cmp    $0x1,%eax
+  80309f:	75 4b                	jne    8030ec <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8030a1:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8030a8:	ff ff ff 
+  8030ab:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030af:	48 8b 00             	mov    (%rax),%rax
+  8030b2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8030b8:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8030bb:	89 c6                	mov    %eax,%esi
+  8030bd:	48 b8 7f e9 ff ff ff 	movabs $0xffffffffffffe97f,%rax
+  8030c4:	ff ff ff 
+  8030c7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030cb:	48 89 c7             	mov    %rax,%rdi
+  8030ce:	49 89 df             	mov    %rbx,%r15
+  8030d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d6:	48 b9 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%rcx
+  8030dd:	ff ff ff 
+  8030e0:	48 01 d9             	add    %rbx,%rcx
+  8030e3:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8030e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030ea:	eb 31                	jmp    80311d <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8030ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030f0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8030f4:	48 85 c0             	test   %rax,%rax
+  8030f7:	75 07                	jne    803100 <read+0xed>
+		return -E_NOT_SUPP;
+  8030f9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030fe:	eb 1d                	jmp    80311d <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803100:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803104:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803108:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80310c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803110:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803114:	48 89 ce             	mov    %rcx,%rsi
+  803117:	48 89 c7             	mov    %rax,%rdi
+  80311a:	41 ff d0             	call   *%r8
+}
+  80311d:	48 83 c4 40          	add    $0x40,%rsp
+  803121:	5b                   	pop    %rbx
+  803122:	41 5f                	pop    %r15
+  803124:	5d                   	pop    %rbp
+  803125:	c3                   	ret
+
+0000000000803126 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803126:	55                   	push   %rbp
+  803127:	48 89 e5             	mov    %rsp,%rbp
+  80312a:	53                   	push   %rbx
+  80312b:	48 83 ec 38          	sub    $0x38,%rsp
+  80312f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80312f <readn+0x9>
+  803136:	49 bb 09 4f 00 00 00 	movabs $0x4f09,%r11
+  80313d:	00 00 00 
+  803140:	4c 01 db             	add    %r11,%rbx
+  803143:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803146:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80314a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80314e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803155:	eb 4b                	jmp    8031a2 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803157:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80315a:	48 98                	cltq
+  80315c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803160:	48 29 c2             	sub    %rax,%rdx
+  803163:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803166:	48 63 c8             	movslq %eax,%rcx
+  803169:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80316d:	48 01 c1             	add    %rax,%rcx
+  803170:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803173:	48 89 ce             	mov    %rcx,%rsi
+  803176:	89 c7                	mov    %eax,%edi
+  803178:	48 b8 db af ff ff ff 	movabs $0xffffffffffffafdb,%rax
+  80317f:	ff ff ff 
+  803182:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803186:	ff d0                	call   *%rax
+  803188:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80318b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80318f:	79 05                	jns    803196 <readn+0x70>
+			return m;
+  803191:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803194:	eb 1d                	jmp    8031b3 <readn+0x8d>
+		if (m == 0)
+  803196:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80319a:	74 13                	je     8031af <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80319c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80319f:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8031a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031a5:	48 98                	cltq
+  8031a7:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  8031ab:	72 aa                	jb     803157 <readn+0x31>
+  8031ad:	eb 01                	jmp    8031b0 <readn+0x8a>
+			break;
+  8031af:	90                   	nop
+	}
+	return tot;
+  8031b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8031b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031b7:	c9                   	leave
+  8031b8:	c3                   	ret
+
+00000000008031b9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8031b9:	55                   	push   %rbp
+  8031ba:	48 89 e5             	mov    %rsp,%rbp
+  8031bd:	41 57                	push   %r15
+  8031bf:	53                   	push   %rbx
+  8031c0:	48 83 ec 40          	sub    $0x40,%rsp
+  8031c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031c4 <write+0xb>
+  8031cb:	49 bb 74 4e 00 00 00 	movabs $0x4e74,%r11
+  8031d2:	00 00 00 
+  8031d5:	4c 01 db             	add    %r11,%rbx
+  8031d8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8031db:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8031df:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8031e3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8031e7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8031ea:	48 89 d6             	mov    %rdx,%rsi
+  8031ed:	89 c7                	mov    %eax,%edi
+  8031ef:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  8031f6:	ff ff ff 
+  8031f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031fd:	ff d0                	call   *%rax
+  8031ff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803202:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803206:	78 28                	js     803230 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803208:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80320c:	8b 00                	mov    (%rax),%eax
+  80320e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803212:	48 89 d6             	mov    %rdx,%rsi
+  803215:	89 c7                	mov    %eax,%edi
+  803217:	48 b8 3a ac ff ff ff 	movabs $0xffffffffffffac3a,%rax
+  80321e:	ff ff ff 
+  803221:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803225:	ff d0                	call   *%rax
+  803227:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80322a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80322e:	79 08                	jns    803238 <write+0x7f>
+		return r;
+  803230:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803233:	e9 8a 00 00 00       	jmp    8032c2 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803238:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80323c:	8b 40 08             	mov    0x8(%rax),%eax
+  80323f:	83 e0 03             	and    $0x3,%eax
+  803242:	85 c0                	test   %eax,%eax
+  803244:	75 4b                	jne    803291 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803246:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80324d:	ff ff ff 
+  803250:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803254:	48 8b 00             	mov    (%rax),%rax
+  803257:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80325d:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803260:	89 c6                	mov    %eax,%esi
+  803262:	48 b8 9b e9 ff ff ff 	movabs $0xffffffffffffe99b,%rax
+  803269:	ff ff ff 
+  80326c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803270:	48 89 c7             	mov    %rax,%rdi
+  803273:	49 89 df             	mov    %rbx,%r15
+  803276:	b8 00 00 00 00       	mov    $0x0,%eax
+  80327b:	48 b9 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%rcx
+  803282:	ff ff ff 
+  803285:	48 01 d9             	add    %rbx,%rcx
+  803288:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80328a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80328f:	eb 31                	jmp    8032c2 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803291:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803295:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803299:	48 85 c0             	test   %rax,%rax
+  80329c:	75 07                	jne    8032a5 <write+0xec>
+		return -E_NOT_SUPP;
+  80329e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8032a3:	eb 1d                	jmp    8032c2 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  8032a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032a9:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8032ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032b1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8032b5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8032b9:	48 89 ce             	mov    %rcx,%rsi
+  8032bc:	48 89 c7             	mov    %rax,%rdi
+  8032bf:	41 ff d0             	call   *%r8
+}
+  8032c2:	48 83 c4 40          	add    $0x40,%rsp
+  8032c6:	5b                   	pop    %rbx
+  8032c7:	41 5f                	pop    %r15
+  8032c9:	5d                   	pop    %rbp
+  8032ca:	c3                   	ret
+
+00000000008032cb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8032cb:	55                   	push   %rbp
+  8032cc:	48 89 e5             	mov    %rsp,%rbp
+  8032cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8032d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8032d3 <seek+0x8>
+  8032da:	49 bb 65 4d 00 00 00 	movabs $0x4d65,%r11
+  8032e1:	00 00 00 
+  8032e4:	4c 01 d8             	add    %r11,%rax
+  8032e7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8032ea:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032ed:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8032f1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032f4:	48 89 ce             	mov    %rcx,%rsi
+  8032f7:	89 d7                	mov    %edx,%edi
+  8032f9:	48 ba 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rdx
+  803300:	ff ff ff 
+  803303:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803307:	ff d0                	call   *%rax
+  803309:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80330c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803310:	79 05                	jns    803317 <seek+0x4c>
+		return r;
+  803312:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803315:	eb 0f                	jmp    803326 <seek+0x5b>
+	fd->fd_offset = offset;
+  803317:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80331b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80331e:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803321:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803326:	c9                   	leave
+  803327:	c3                   	ret
+
+0000000000803328 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803328:	55                   	push   %rbp
+  803329:	48 89 e5             	mov    %rsp,%rbp
+  80332c:	41 57                	push   %r15
+  80332e:	53                   	push   %rbx
+  80332f:	48 83 ec 30          	sub    $0x30,%rsp
+  803333:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803333 <ftruncate+0xb>
+  80333a:	49 bb 05 4d 00 00 00 	movabs $0x4d05,%r11
+  803341:	00 00 00 
+  803344:	4c 01 db             	add    %r11,%rbx
+  803347:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80334a:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80334d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803351:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803354:	48 89 d6             	mov    %rdx,%rsi
+  803357:	89 c7                	mov    %eax,%edi
+  803359:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  803360:	ff ff ff 
+  803363:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803367:	ff d0                	call   *%rax
+  803369:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80336c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803370:	78 28                	js     80339a <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803372:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803376:	8b 00                	mov    (%rax),%eax
+  803378:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80337c:	48 89 d6             	mov    %rdx,%rsi
+  80337f:	89 c7                	mov    %eax,%edi
+  803381:	48 b8 3a ac ff ff ff 	movabs $0xffffffffffffac3a,%rax
+  803388:	ff ff ff 
+  80338b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80338f:	ff d0                	call   *%rax
+  803391:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803394:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803398:	79 08                	jns    8033a2 <ftruncate+0x7a>
+		return r;
+  80339a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80339d:	e9 83 00 00 00       	jmp    803425 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033a6:	8b 40 08             	mov    0x8(%rax),%eax
+  8033a9:	83 e0 03             	and    $0x3,%eax
+  8033ac:	85 c0                	test   %eax,%eax
+  8033ae:	75 4b                	jne    8033fb <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8033b0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8033b7:	ff ff ff 
+  8033ba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033be:	48 8b 00             	mov    (%rax),%rax
+  8033c1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033c7:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8033ca:	89 c6                	mov    %eax,%esi
+  8033cc:	48 b8 b8 e9 ff ff ff 	movabs $0xffffffffffffe9b8,%rax
+  8033d3:	ff ff ff 
+  8033d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033da:	48 89 c7             	mov    %rax,%rdi
+  8033dd:	49 89 df             	mov    %rbx,%r15
+  8033e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e5:	48 b9 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%rcx
+  8033ec:	ff ff ff 
+  8033ef:	48 01 d9             	add    %rbx,%rcx
+  8033f2:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8033f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033f9:	eb 2a                	jmp    803425 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8033fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033ff:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803403:	48 85 c0             	test   %rax,%rax
+  803406:	75 07                	jne    80340f <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803408:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80340d:	eb 16                	jmp    803425 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  80340f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803413:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803417:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80341b:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80341e:	89 d6                	mov    %edx,%esi
+  803420:	48 89 c7             	mov    %rax,%rdi
+  803423:	ff d1                	call   *%rcx
+}
+  803425:	48 83 c4 30          	add    $0x30,%rsp
+  803429:	5b                   	pop    %rbx
+  80342a:	41 5f                	pop    %r15
+  80342c:	5d                   	pop    %rbp
+  80342d:	c3                   	ret
+
+000000000080342e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80342e:	55                   	push   %rbp
+  80342f:	48 89 e5             	mov    %rsp,%rbp
+  803432:	53                   	push   %rbx
+  803433:	48 83 ec 38          	sub    $0x38,%rsp
+  803437:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803437 <fstat+0x9>
+  80343e:	49 bb 01 4c 00 00 00 	movabs $0x4c01,%r11
+  803445:	00 00 00 
+  803448:	4c 01 db             	add    %r11,%rbx
+  80344b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80344e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803452:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803456:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803459:	48 89 d6             	mov    %rdx,%rsi
+  80345c:	89 c7                	mov    %eax,%edi
+  80345e:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  803465:	ff ff ff 
+  803468:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80346c:	ff d0                	call   *%rax
+  80346e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803471:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803475:	78 28                	js     80349f <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803477:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80347b:	8b 00                	mov    (%rax),%eax
+  80347d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803481:	48 89 d6             	mov    %rdx,%rsi
+  803484:	89 c7                	mov    %eax,%edi
+  803486:	48 b8 3a ac ff ff ff 	movabs $0xffffffffffffac3a,%rax
+  80348d:	ff ff ff 
+  803490:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803494:	ff d0                	call   *%rax
+  803496:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803499:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80349d:	79 05                	jns    8034a4 <fstat+0x76>
+		return r;
+  80349f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034a2:	eb 5e                	jmp    803502 <fstat+0xd4>
+	if (!dev->dev_stat)
+  8034a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034a8:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034ac:	48 85 c0             	test   %rax,%rax
+  8034af:	75 07                	jne    8034b8 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8034b1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034b6:	eb 4a                	jmp    803502 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8034b8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034bc:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8034bf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034c3:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8034ca:	00 00 00 
+	stat->st_isdir = 0;
+  8034cd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034d1:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8034d8:	00 00 00 
+	stat->st_dev = dev;
+  8034db:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034df:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8034e3:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8034ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034ee:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8034f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8034fa:	48 89 d6             	mov    %rdx,%rsi
+  8034fd:	48 89 c7             	mov    %rax,%rdi
+  803500:	ff d1                	call   *%rcx
+}
+  803502:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803506:	c9                   	leave
+  803507:	c3                   	ret
+
+0000000000803508 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803508:	55                   	push   %rbp
+  803509:	48 89 e5             	mov    %rsp,%rbp
+  80350c:	41 57                	push   %r15
+  80350e:	53                   	push   %rbx
+  80350f:	48 83 ec 20          	sub    $0x20,%rsp
+  803513:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803513 <stat+0xb>
+  80351a:	49 bb 25 4b 00 00 00 	movabs $0x4b25,%r11
+  803521:	00 00 00 
+  803524:	4c 01 db             	add    %r11,%rbx
+  803527:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80352b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80352f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803533:	be 00 00 00 00       	mov    $0x0,%esi
+  803538:	48 89 c7             	mov    %rax,%rdi
+  80353b:	49 89 df             	mov    %rbx,%r15
+  80353e:	48 b8 aa b7 ff ff ff 	movabs $0xffffffffffffb7aa,%rax
+  803545:	ff ff ff 
+  803548:	48 01 d8             	add    %rbx,%rax
+  80354b:	ff d0                	call   *%rax
+  80354d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803550:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803554:	79 05                	jns    80355b <stat+0x53>
+		return fd;
+  803556:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803559:	eb 37                	jmp    803592 <stat+0x8a>
+	r = fstat(fd, stat);
+  80355b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80355f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803562:	48 89 d6             	mov    %rdx,%rsi
+  803565:	89 c7                	mov    %eax,%edi
+  803567:	48 b8 f6 b3 ff ff ff 	movabs $0xffffffffffffb3f6,%rax
+  80356e:	ff ff ff 
+  803571:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803575:	ff d0                	call   *%rax
+  803577:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80357a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80357d:	89 c7                	mov    %eax,%edi
+  80357f:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  803586:	ff ff ff 
+  803589:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80358d:	ff d0                	call   *%rax
+	return r;
+  80358f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803592:	48 83 c4 20          	add    $0x20,%rsp
+  803596:	5b                   	pop    %rbx
+  803597:	41 5f                	pop    %r15
+  803599:	5d                   	pop    %rbp
+  80359a:	c3                   	ret
+
+000000000080359b <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80359b:	55                   	push   %rbp
+  80359c:	48 89 e5             	mov    %rsp,%rbp
+  80359f:	41 57                	push   %r15
+  8035a1:	53                   	push   %rbx
+  8035a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8035a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035a6 <fsipc+0xb>
+  8035ad:	49 bb 92 4a 00 00 00 	movabs $0x4a92,%r11
+  8035b4:	00 00 00 
+  8035b7:	4c 01 db             	add    %r11,%rbx
+  8035ba:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8035c1:	48 b8 cc 0f 00 00 00 	movabs $0xfcc,%rax
+  8035c8:	00 00 00 
+  8035cb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8035ce:	85 c0                	test   %eax,%eax
+  8035d0:	75 24                	jne    8035f6 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8035d2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035d7:	49 89 df             	mov    %rbx,%r15
+  8035da:	48 b8 48 e3 ff ff ff 	movabs $0xffffffffffffe348,%rax
+  8035e1:	ff ff ff 
+  8035e4:	48 01 d8             	add    %rbx,%rax
+  8035e7:	ff d0                	call   *%rax
+  8035e9:	48 ba cc 0f 00 00 00 	movabs $0xfcc,%rdx
+  8035f0:	00 00 00 
+  8035f3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8035f6:	48 b8 cc 0f 00 00 00 	movabs $0xfcc,%rax
+  8035fd:	00 00 00 
+  803600:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803603:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803607:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80360a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803610:	49 89 d0             	mov    %rdx,%r8
+  803613:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803618:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  80361f:	00 00 00 
+  803622:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803626:	89 c7                	mov    %eax,%edi
+  803628:	49 89 df             	mov    %rbx,%r15
+  80362b:	48 b8 67 dd ff ff ff 	movabs $0xffffffffffffdd67,%rax
+  803632:	ff ff ff 
+  803635:	48 01 d8             	add    %rbx,%rax
+  803638:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  80363a:	48 83 c4 10          	add    $0x10,%rsp
+  80363e:	5b                   	pop    %rbx
+  80363f:	41 5f                	pop    %r15
+  803641:	5d                   	pop    %rbp
+  803642:	c3                   	ret
+
+0000000000803643 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803643:	55                   	push   %rbp
+  803644:	48 89 e5             	mov    %rsp,%rbp
+  803647:	41 57                	push   %r15
+  803649:	53                   	push   %rbx
+  80364a:	48 83 ec 20          	sub    $0x20,%rsp
+  80364e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80364e <fsipc_words+0xb>
+  803655:	49 bb ea 49 00 00 00 	movabs $0x49ea,%r11
+  80365c:	00 00 00 
+  80365f:	4c 01 db             	add    %r11,%rbx
+  803662:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803665:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803669:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80366d:	48 b8 cc 0f 00 00 00 	movabs $0xfcc,%rax
+  803674:	00 00 00 
+  803677:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80367a:	85 c0                	test   %eax,%eax
+  80367c:	75 24                	jne    8036a2 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80367e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803683:	49 89 df             	mov    %rbx,%r15
+  803686:	48 b8 48 e3 ff ff ff 	movabs $0xffffffffffffe348,%rax
+  80368d:	ff ff ff 
+  803690:	48 01 d8             	add    %rbx,%rax
+  803693:	ff d0                	call   *%rax
+  803695:	48 ba cc 0f 00 00 00 	movabs $0xfcc,%rdx
+  80369c:	00 00 00 
+  80369f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8036a2:	48 b8 cc 0f 00 00 00 	movabs $0xfcc,%rax
+  8036a9:	00 00 00 
+  8036ac:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8036af:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8036b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036b7:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8036ba:	89 c7                	mov    %eax,%edi
+  8036bc:	49 89 df             	mov    %rbx,%r15
+  8036bf:	48 b8 52 de ff ff ff 	movabs $0xffffffffffffde52,%rax
+  8036c6:	ff ff ff 
+  8036c9:	48 01 d8             	add    %rbx,%rax
+  8036cc:	ff d0                	call   *%rax
+}
+  8036ce:	48 83 c4 20          	add    $0x20,%rsp
+  8036d2:	5b                   	pop    %rbx
+  8036d3:	41 5f                	pop    %r15
+  8036d5:	5d                   	pop    %rbp
+  8036d6:	c3                   	ret
+
+00000000008036d7 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8036d7:	55                   	push   %rbp
+  8036d8:	48 89 e5             	mov    %rsp,%rbp
+  8036db:	41 57                	push   %r15
+  8036dd:	53                   	push   %rbx
+  8036de:	48 83 ec 40          	sub    $0x40,%rsp
+  8036e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036e2 <fsipc_pages+0xb>
+  8036e9:	49 bb 56 49 00 00 00 	movabs $0x4956,%r11
+  8036f0:	00 00 00 
+  8036f3:	4c 01 db             	add    %r11,%rbx
+  8036f6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8036f9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8036fd:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803701:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803704:	48 b8 cc 0f 00 00 00 	movabs $0xfcc,%rax
+  80370b:	00 00 00 
+  80370e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803711:	85 c0                	test   %eax,%eax
+  803713:	75 24                	jne    803739 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803715:	bf 01 00 00 00       	mov    $0x1,%edi
+  80371a:	49 89 df             	mov    %rbx,%r15
+  80371d:	48 b8 48 e3 ff ff ff 	movabs $0xffffffffffffe348,%rax
+  803724:	ff ff ff 
+  803727:	48 01 d8             	add    %rbx,%rax
+  80372a:	ff d0                	call   *%rax
+  80372c:	48 ba cc 0f 00 00 00 	movabs $0xfcc,%rdx
+  803733:	00 00 00 
+  803736:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803739:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80373e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803742:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803745:	48 98                	cltq
+  803747:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80374b:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80374f:	0f 95 c0             	setne  %al
+  803752:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803755:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80375c:	00 
+  80375d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803761:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803765:	48 01 d0             	add    %rdx,%rax
+  803768:	48 83 e8 01          	sub    $0x1,%rax
+  80376c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803770:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803774:	ba 00 00 00 00       	mov    $0x0,%edx
+  803779:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80377d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803781:	48 29 d0             	sub    %rdx,%rax
+  803784:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803788:	41 89 c2             	mov    %eax,%r10d
+  80378b:	48 b8 cc 0f 00 00 00 	movabs $0xfcc,%rax
+  803792:	00 00 00 
+  803795:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803798:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80379c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037a0:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8037a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8037a7:	6a 40                	push   $0x40
+  8037a9:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8037ae:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8037b5:	00 
+  8037b6:	6a 05                	push   $0x5
+  8037b8:	41 89 f9             	mov    %edi,%r9d
+  8037bb:	49 89 c8             	mov    %rcx,%r8
+  8037be:	44 89 d1             	mov    %r10d,%ecx
+  8037c1:	89 c7                	mov    %eax,%edi
+  8037c3:	49 89 df             	mov    %rbx,%r15
+  8037c6:	48 b8 50 df ff ff ff 	movabs $0xffffffffffffdf50,%rax
+  8037cd:	ff ff ff 
+  8037d0:	48 01 d8             	add    %rbx,%rax
+  8037d3:	ff d0                	call   *%rax
+  8037d5:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8037d9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8037dd:	5b                   	pop    %rbx
+  8037de:	41 5f                	pop    %r15
+  8037e0:	5d                   	pop    %rbp
+  8037e1:	c3                   	ret
+
+00000000008037e2 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8037e2:	55                   	push   %rbp
+  8037e3:	48 89 e5             	mov    %rsp,%rbp
+  8037e6:	41 57                	push   %r15
+  8037e8:	53                   	push   %rbx
+  8037e9:	48 83 ec 20          	sub    $0x20,%rsp
+  8037ed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037ed <open+0xb>
+  8037f4:	49 bb 4b 48 00 00 00 	movabs $0x484b,%r11
+  8037fb:	00 00 00 
+  8037fe:	4c 01 db             	add    %r11,%rbx
+  803801:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803805:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  803808:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80380c:	48 89 c7             	mov    %rax,%rdi
+  80380f:	49 89 df             	mov    %rbx,%r15
+  803812:	48 b8 6b 94 ff ff ff 	movabs $0xffffffffffff946b,%rax
+  803819:	ff ff ff 
+  80381c:	48 01 d8             	add    %rbx,%rax
+  80381f:	ff d0                	call   *%rax
+  803821:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803826:	7e 0a                	jle    803832 <open+0x50>
+		return -E_BAD_PATH;
+  803828:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80382d:	e9 18 01 00 00       	jmp    80394a <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803832:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803836:	48 89 c7             	mov    %rax,%rdi
+  803839:	49 89 df             	mov    %rbx,%r15
+  80383c:	48 b8 de a9 ff ff ff 	movabs $0xffffffffffffa9de,%rax
+  803843:	ff ff ff 
+  803846:	48 01 d8             	add    %rbx,%rax
+  803849:	ff d0                	call   *%rax
+  80384b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80384e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803852:	74 08                	je     80385c <open+0x7a>
+		return r;
+  803854:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803857:	e9 ee 00 00 00       	jmp    80394a <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80385c:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803863:	00 00 00 
+  803866:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803869:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  803870:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803874:	48 89 c6             	mov    %rax,%rsi
+  803877:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  80387e:	00 00 00 
+  803881:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803885:	48 89 c7             	mov    %rax,%rdi
+  803888:	49 89 df             	mov    %rbx,%r15
+  80388b:	48 b8 ff 94 ff ff ff 	movabs $0xffffffffffff94ff,%rax
+  803892:	ff ff ff 
+  803895:	48 01 d8             	add    %rbx,%rax
+  803898:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  80389a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80389e:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  8038a3:	48 89 c6             	mov    %rax,%rsi
+  8038a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ab:	49 89 df             	mov    %rbx,%r15
+  8038ae:	48 b8 bb a1 ff ff ff 	movabs $0xffffffffffffa1bb,%rax
+  8038b5:	ff ff ff 
+  8038b8:	48 01 d8             	add    %rbx,%rax
+  8038bb:	ff d0                	call   *%rax
+  8038bd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038c4:	74 23                	je     8038e9 <open+0x107>
+		fd_close(fd,0);
+  8038c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8038cf:	48 89 c7             	mov    %rax,%rdi
+  8038d2:	49 89 df             	mov    %rbx,%r15
+  8038d5:	48 b8 3f ab ff ff ff 	movabs $0xffffffffffffab3f,%rax
+  8038dc:	ff ff ff 
+  8038df:	48 01 d8             	add    %rbx,%rax
+  8038e2:	ff d0                	call   *%rax
+		return r;
+  8038e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038e7:	eb 61                	jmp    80394a <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8038e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038ed:	48 89 c6             	mov    %rax,%rsi
+  8038f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8038f5:	48 b8 63 b5 ff ff ff 	movabs $0xffffffffffffb563,%rax
+  8038fc:	ff ff ff 
+  8038ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803903:	ff d0                	call   *%rax
+  803905:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803908:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80390c:	74 23                	je     803931 <open+0x14f>
+		fd_close(fd,0);
+  80390e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803912:	be 00 00 00 00       	mov    $0x0,%esi
+  803917:	48 89 c7             	mov    %rax,%rdi
+  80391a:	49 89 df             	mov    %rbx,%r15
+  80391d:	48 b8 3f ab ff ff ff 	movabs $0xffffffffffffab3f,%rax
+  803924:	ff ff ff 
+  803927:	48 01 d8             	add    %rbx,%rax
+  80392a:	ff d0                	call   *%rax
+		return r;
+  80392c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80392f:	eb 19                	jmp    80394a <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803931:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803935:	48 89 c7             	mov    %rax,%rdi
+  803938:	49 89 df             	mov    %rbx,%r15
+  80393b:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  803942:	ff ff ff 
+  803945:	48 01 d8             	add    %rbx,%rax
+  803948:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  80394a:	48 83 c4 20          	add    $0x20,%rsp
+  80394e:	5b                   	pop    %rbx
+  80394f:	41 5f                	pop    %r15
+  803951:	5d                   	pop    %rbp
+  803952:	c3                   	ret
+
+0000000000803953 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803953:	55                   	push   %rbp
+  803954:	48 89 e5             	mov    %rsp,%rbp
+  803957:	48 83 ec 20          	sub    $0x20,%rsp
+  80395b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80395b <devfile_flush+0x8>
+  803962:	49 bb dd 46 00 00 00 	movabs $0x46dd,%r11
+  803969:	00 00 00 
+  80396c:	4c 01 d8             	add    %r11,%rax
+  80396f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  803973:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803977:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80397a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  80397d:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  803981:	ba 04 00 00 00       	mov    $0x4,%edx
+  803986:	48 89 ce             	mov    %rcx,%rsi
+  803989:	bf 06 00 00 00       	mov    $0x6,%edi
+  80398e:	48 b9 0b b6 ff ff ff 	movabs $0xffffffffffffb60b,%rcx
+  803995:	ff ff ff 
+  803998:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80399c:	ff d0                	call   *%rax
+}
+  80399e:	c9                   	leave
+  80399f:	c3                   	ret
+
+00000000008039a0 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  8039a0:	55                   	push   %rbp
+  8039a1:	48 89 e5             	mov    %rsp,%rbp
+  8039a4:	41 57                	push   %r15
+  8039a6:	53                   	push   %rbx
+  8039a7:	48 83 ec 60          	sub    $0x60,%rsp
+  8039ab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039ab <devfile_read+0xb>
+  8039b2:	49 bb 8d 46 00 00 00 	movabs $0x468d,%r11
+  8039b9:	00 00 00 
+  8039bc:	4c 01 db             	add    %r11,%rbx
+  8039bf:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8039c3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8039c7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  8039cb:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8039cf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  8039d3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8039d7:	8b 50 0c             	mov    0xc(%rax),%edx
+  8039da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039de:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8039e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039e4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8039e8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8039ec:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8039f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8039f5:	ba 10 00 00 00       	mov    $0x10,%edx
+  8039fa:	48 89 c6             	mov    %rax,%rsi
+  8039fd:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a02:	48 b8 9f b6 ff ff ff 	movabs $0xffffffffffffb69f,%rax
+  803a09:	ff ff ff 
+  803a0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a10:	ff d0                	call   *%rax
+  803a12:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803a15:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803a19:	79 05                	jns    803a20 <devfile_read+0x80>
+		return r;
+  803a1b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a1e:	eb 64                	jmp    803a84 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803a20:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a23:	48 63 d0             	movslq %eax,%rdx
+  803a26:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a2a:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803a2f:	48 01 c1             	add    %rax,%rcx
+  803a32:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803a36:	48 89 ce             	mov    %rcx,%rsi
+  803a39:	48 89 c7             	mov    %rax,%rdi
+  803a3c:	49 89 df             	mov    %rbx,%r15
+  803a3f:	48 b8 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rax
+  803a46:	ff ff ff 
+  803a49:	48 01 d8             	add    %rbx,%rax
+  803a4c:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803a4e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803a55:	ff ff ff 
+  803a58:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a5c:	48 8b 00             	mov    (%rax),%rax
+  803a5f:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803a65:	89 c6                	mov    %eax,%esi
+  803a67:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803a6c:	48 89 c7             	mov    %rax,%rdi
+  803a6f:	49 89 df             	mov    %rbx,%r15
+  803a72:	48 b8 02 e3 ff ff ff 	movabs $0xffffffffffffe302,%rax
+  803a79:	ff ff ff 
+  803a7c:	48 01 d8             	add    %rbx,%rax
+  803a7f:	ff d0                	call   *%rax
+	return r;
+  803a81:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803a84:	48 83 c4 60          	add    $0x60,%rsp
+  803a88:	5b                   	pop    %rbx
+  803a89:	41 5f                	pop    %r15
+  803a8b:	5d                   	pop    %rbp
+  803a8c:	c3                   	ret
+
+0000000000803a8d <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803a8d:	55                   	push   %rbp
+  803a8e:	48 89 e5             	mov    %rsp,%rbp
+  803a91:	41 57                	push   %r15
+  803a93:	53                   	push   %rbx
+  803a94:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803a98:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a98 <devfile_write+0xb>
+  803a9f:	49 bb a0 45 00 00 00 	movabs $0x45a0,%r11
+  803aa6:	00 00 00 
+  803aa9:	4c 01 db             	add    %r11,%rbx
+  803aac:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  803ab0:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803ab4:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803abb:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803abf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803ac3:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803aca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803ace:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803ad5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ad8:	48 63 d0             	movslq %eax,%rdx
+  803adb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803adf:	48 39 c2             	cmp    %rax,%rdx
+  803ae2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803ae6:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803aed:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803af4:	00 
+  803af5:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803afc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b00:	48 01 d0             	add    %rdx,%rax
+  803b03:	48 83 e8 01          	sub    $0x1,%rax
+  803b07:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  803b0b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b14:	48 f7 75 d0          	divq   -0x30(%rbp)
+  803b18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b1c:	48 29 d0             	sub    %rdx,%rax
+  803b1f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b23:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803b26:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803b29:	89 c6                	mov    %eax,%esi
+  803b2b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b30:	48 89 c7             	mov    %rax,%rdi
+  803b33:	49 89 df             	mov    %rbx,%r15
+  803b36:	48 b8 bc e2 ff ff ff 	movabs $0xffffffffffffe2bc,%rax
+  803b3d:	ff ff ff 
+  803b40:	48 01 d8             	add    %rbx,%rax
+  803b43:	ff d0                	call   *%rax
+  803b45:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803b48:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803b4c:	79 08                	jns    803b56 <devfile_write+0xc9>
+		return r;
+  803b4e:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803b51:	e9 8f 00 00 00       	jmp    803be5 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803b56:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b5d:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803b61:	48 89 c6             	mov    %rax,%rsi
+  803b64:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803b69:	48 89 c7             	mov    %rax,%rdi
+  803b6c:	49 89 df             	mov    %rbx,%r15
+  803b6f:	48 b8 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rax
+  803b76:	ff ff ff 
+  803b79:	48 01 d8             	add    %rbx,%rax
+  803b7c:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803b7e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803b82:	8b 50 0c             	mov    0xc(%rax),%edx
+  803b85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b89:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803b8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b8f:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803b96:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803b9a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803b9d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803ba1:	89 d1                	mov    %edx,%ecx
+  803ba3:	ba 10 00 00 00       	mov    $0x10,%edx
+  803ba8:	48 89 c6             	mov    %rax,%rsi
+  803bab:	bf 04 00 00 00       	mov    $0x4,%edi
+  803bb0:	48 b8 9f b6 ff ff ff 	movabs $0xffffffffffffb69f,%rax
+  803bb7:	ff ff ff 
+  803bba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bbe:	ff d0                	call   *%rax
+  803bc0:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803bc3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803bc6:	89 c6                	mov    %eax,%esi
+  803bc8:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803bcd:	48 89 c7             	mov    %rax,%rdi
+  803bd0:	49 89 df             	mov    %rbx,%r15
+  803bd3:	48 b8 02 e3 ff ff ff 	movabs $0xffffffffffffe302,%rax
+  803bda:	ff ff ff 
+  803bdd:	48 01 d8             	add    %rbx,%rax
+  803be0:	ff d0                	call   *%rax
+	return r;
+  803be2:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803be5:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803be9:	5b                   	pop    %rbx
+  803bea:	41 5f                	pop    %r15
+  803bec:	5d                   	pop    %rbp
+  803bed:	c3                   	ret
+
+0000000000803bee <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803bee:	55                   	push   %rbp
+  803bef:	48 89 e5             	mov    %rsp,%rbp
+  803bf2:	41 57                	push   %r15
+  803bf4:	53                   	push   %rbx
+  803bf5:	48 83 ec 20          	sub    $0x20,%rsp
+  803bf9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bf9 <devfile_stat+0xb>
+  803c00:	49 bb 3f 44 00 00 00 	movabs $0x443f,%r11
+  803c07:	00 00 00 
+  803c0a:	4c 01 db             	add    %r11,%rbx
+  803c0d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803c11:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803c15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c19:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c1c:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803c23:	00 00 00 
+  803c26:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803c29:	be 00 00 00 00       	mov    $0x0,%esi
+  803c2e:	bf 05 00 00 00       	mov    $0x5,%edi
+  803c33:	48 b8 63 b5 ff ff ff 	movabs $0xffffffffffffb563,%rax
+  803c3a:	ff ff ff 
+  803c3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c41:	ff d0                	call   *%rax
+  803c43:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c46:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c4a:	79 05                	jns    803c51 <devfile_stat+0x63>
+		return r;
+  803c4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c4f:	eb 65                	jmp    803cb6 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c51:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c55:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803c5c:	00 00 00 
+  803c5f:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803c63:	48 89 d6             	mov    %rdx,%rsi
+  803c66:	48 89 c7             	mov    %rax,%rdi
+  803c69:	49 89 df             	mov    %rbx,%r15
+  803c6c:	48 b8 ff 94 ff ff ff 	movabs $0xffffffffffff94ff,%rax
+  803c73:	ff ff ff 
+  803c76:	48 01 d8             	add    %rbx,%rax
+  803c79:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803c7b:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803c82:	00 00 00 
+  803c85:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803c8c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c90:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c96:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803c9d:	00 00 00 
+  803ca0:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803ca7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cab:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cb6:	48 83 c4 20          	add    $0x20,%rsp
+  803cba:	5b                   	pop    %rbx
+  803cbb:	41 5f                	pop    %r15
+  803cbd:	5d                   	pop    %rbp
+  803cbe:	c3                   	ret
+
+0000000000803cbf <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803cbf:	55                   	push   %rbp
+  803cc0:	48 89 e5             	mov    %rsp,%rbp
+  803cc3:	48 83 ec 20          	sub    $0x20,%rsp
+  803cc7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cc7 <devfile_trunc+0x8>
+  803cce:	49 bb 71 43 00 00 00 	movabs $0x4371,%r11
+  803cd5:	00 00 00 
+  803cd8:	4c 01 d8             	add    %r11,%rax
+  803cdb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803cdf:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803ce2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803ce6:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ce9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803cec:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803cef:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803cf2:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803cf6:	ba 08 00 00 00       	mov    $0x8,%edx
+  803cfb:	48 89 ce             	mov    %rcx,%rsi
+  803cfe:	bf 02 00 00 00       	mov    $0x2,%edi
+  803d03:	48 b9 0b b6 ff ff ff 	movabs $0xffffffffffffb60b,%rcx
+  803d0a:	ff ff ff 
+  803d0d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803d11:	ff d0                	call   *%rax
+}
+  803d13:	c9                   	leave
+  803d14:	c3                   	ret
+
+0000000000803d15 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803d15:	55                   	push   %rbp
+  803d16:	48 89 e5             	mov    %rsp,%rbp
+  803d19:	41 57                	push   %r15
+  803d1b:	53                   	push   %rbx
+  803d1c:	48 83 ec 10          	sub    $0x10,%rsp
+  803d20:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d20 <remove+0xb>
+  803d27:	49 bb 18 43 00 00 00 	movabs $0x4318,%r11
+  803d2e:	00 00 00 
+  803d31:	4c 01 db             	add    %r11,%rbx
+  803d34:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803d38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d3c:	48 89 c7             	mov    %rax,%rdi
+  803d3f:	49 89 df             	mov    %rbx,%r15
+  803d42:	48 b8 6b 94 ff ff ff 	movabs $0xffffffffffff946b,%rax
+  803d49:	ff ff ff 
+  803d4c:	48 01 d8             	add    %rbx,%rax
+  803d4f:	ff d0                	call   *%rax
+  803d51:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803d56:	7e 07                	jle    803d5f <remove+0x4a>
+		return -E_BAD_PATH;
+  803d58:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803d5d:	eb 44                	jmp    803da3 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803d5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d63:	48 89 c6             	mov    %rax,%rsi
+  803d66:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803d6d:	00 00 00 
+  803d70:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d74:	48 89 c7             	mov    %rax,%rdi
+  803d77:	49 89 df             	mov    %rbx,%r15
+  803d7a:	48 b8 ff 94 ff ff ff 	movabs $0xffffffffffff94ff,%rax
+  803d81:	ff ff ff 
+  803d84:	48 01 d8             	add    %rbx,%rax
+  803d87:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803d89:	be 00 00 00 00       	mov    $0x0,%esi
+  803d8e:	bf 07 00 00 00       	mov    $0x7,%edi
+  803d93:	48 b8 63 b5 ff ff ff 	movabs $0xffffffffffffb563,%rax
+  803d9a:	ff ff ff 
+  803d9d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803da1:	ff d0                	call   *%rax
+}
+  803da3:	48 83 c4 10          	add    $0x10,%rsp
+  803da7:	5b                   	pop    %rbx
+  803da8:	41 5f                	pop    %r15
+  803daa:	5d                   	pop    %rbp
+  803dab:	c3                   	ret
+
+0000000000803dac <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803dac:	55                   	push   %rbp
+  803dad:	48 89 e5             	mov    %rsp,%rbp
+  803db0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803db0 <sync+0x4>
+  803db7:	49 bb 88 42 00 00 00 	movabs $0x4288,%r11
+  803dbe:	00 00 00 
+  803dc1:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803dc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dc9:	be 00 00 00 00       	mov    $0x0,%esi
+  803dce:	bf 08 00 00 00       	mov    $0x8,%edi
+  803dd3:	48 b9 0b b6 ff ff ff 	movabs $0xffffffffffffb60b,%rcx
+  803dda:	ff ff ff 
+  803ddd:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803de1:	ff d0                	call   *%rax
+}
+  803de3:	5d                   	pop    %rbp
+  803de4:	c3                   	ret
+
+0000000000803de5 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803de5:	55                   	push   %rbp
+  803de6:	48 89 e5             	mov    %rsp,%rbp
+  803de9:	41 57                	push   %r15
+  803deb:	53                   	push   %rbx
+  803dec:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803df3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803df3 <copy+0xe>
+  803dfa:	49 bb 45 42 00 00 00 	movabs $0x4245,%r11
+  803e01:	00 00 00 
+  803e04:	4c 01 db             	add    %r11,%rbx
+  803e07:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803e0e:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803e15:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803e1c:	be 00 00 00 00       	mov    $0x0,%esi
+  803e21:	48 89 c7             	mov    %rax,%rdi
+  803e24:	48 b8 aa b7 ff ff ff 	movabs $0xffffffffffffb7aa,%rax
+  803e2b:	ff ff ff 
+  803e2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e32:	ff d0                	call   *%rax
+  803e34:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803e37:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e3b:	79 35                	jns    803e72 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803e3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e40:	89 c6                	mov    %eax,%esi
+  803e42:	48 b8 de e9 ff ff ff 	movabs $0xffffffffffffe9de,%rax
+  803e49:	ff ff ff 
+  803e4c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e50:	48 89 c7             	mov    %rax,%rdi
+  803e53:	49 89 df             	mov    %rbx,%r15
+  803e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5b:	48 ba 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%rdx
+  803e62:	ff ff ff 
+  803e65:	48 01 da             	add    %rbx,%rdx
+  803e68:	ff d2                	call   *%rdx
+		return fd_src;
+  803e6a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e6d:	e9 d7 01 00 00       	jmp    804049 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803e72:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803e79:	be 01 01 00 00       	mov    $0x101,%esi
+  803e7e:	48 89 c7             	mov    %rax,%rdi
+  803e81:	48 b8 aa b7 ff ff ff 	movabs $0xffffffffffffb7aa,%rax
+  803e88:	ff ff ff 
+  803e8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e8f:	ff d0                	call   *%rax
+  803e91:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803e94:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803e98:	0f 89 df 00 00 00    	jns    803f7d <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803e9e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ea1:	89 c6                	mov    %eax,%esi
+  803ea3:	48 b8 f4 e9 ff ff ff 	movabs $0xffffffffffffe9f4,%rax
+  803eaa:	ff ff ff 
+  803ead:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eb1:	48 89 c7             	mov    %rax,%rdi
+  803eb4:	49 89 df             	mov    %rbx,%r15
+  803eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebc:	48 ba 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%rdx
+  803ec3:	ff ff ff 
+  803ec6:	48 01 da             	add    %rbx,%rdx
+  803ec9:	ff d2                	call   *%rdx
+		close(fd_src);
+  803ecb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ece:	89 c7                	mov    %eax,%edi
+  803ed0:	49 89 df             	mov    %rbx,%r15
+  803ed3:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  803eda:	ff ff ff 
+  803edd:	48 01 d8             	add    %rbx,%rax
+  803ee0:	ff d0                	call   *%rax
+		return fd_dest;
+  803ee2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ee5:	e9 5f 01 00 00       	jmp    804049 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803eea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803eed:	48 63 d0             	movslq %eax,%rdx
+  803ef0:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803ef7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803efa:	48 89 ce             	mov    %rcx,%rsi
+  803efd:	89 c7                	mov    %eax,%edi
+  803eff:	49 89 df             	mov    %rbx,%r15
+  803f02:	48 b8 81 b1 ff ff ff 	movabs $0xffffffffffffb181,%rax
+  803f09:	ff ff ff 
+  803f0c:	48 01 d8             	add    %rbx,%rax
+  803f0f:	ff d0                	call   *%rax
+  803f11:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803f14:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803f18:	79 63                	jns    803f7d <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803f1a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803f1d:	89 c6                	mov    %eax,%esi
+  803f1f:	48 b8 0e ea ff ff ff 	movabs $0xffffffffffffea0e,%rax
+  803f26:	ff ff ff 
+  803f29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f2d:	48 89 c7             	mov    %rax,%rdi
+  803f30:	49 89 df             	mov    %rbx,%r15
+  803f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f38:	48 ba 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%rdx
+  803f3f:	ff ff ff 
+  803f42:	48 01 da             	add    %rbx,%rdx
+  803f45:	ff d2                	call   *%rdx
+			close(fd_src);
+  803f47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f4a:	89 c7                	mov    %eax,%edi
+  803f4c:	49 89 df             	mov    %rbx,%r15
+  803f4f:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  803f56:	ff ff ff 
+  803f59:	48 01 d8             	add    %rbx,%rax
+  803f5c:	ff d0                	call   *%rax
+			close(fd_dest);
+  803f5e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f61:	89 c7                	mov    %eax,%edi
+  803f63:	49 89 df             	mov    %rbx,%r15
+  803f66:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  803f6d:	ff ff ff 
+  803f70:	48 01 d8             	add    %rbx,%rax
+  803f73:	ff d0                	call   *%rax
+			return write_size;
+  803f75:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803f78:	e9 cc 00 00 00       	jmp    804049 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803f7d:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803f84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f87:	ba 00 02 00 00       	mov    $0x200,%edx
+  803f8c:	48 89 ce             	mov    %rcx,%rsi
+  803f8f:	89 c7                	mov    %eax,%edi
+  803f91:	49 89 df             	mov    %rbx,%r15
+  803f94:	48 b8 db af ff ff ff 	movabs $0xffffffffffffafdb,%rax
+  803f9b:	ff ff ff 
+  803f9e:	48 01 d8             	add    %rbx,%rax
+  803fa1:	ff d0                	call   *%rax
+  803fa3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803fa6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803faa:	0f 8f 3a ff ff ff    	jg     803eea <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803fb0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803fb4:	79 60                	jns    804016 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803fb6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803fb9:	89 c6                	mov    %eax,%esi
+  803fbb:	48 b8 21 ea ff ff ff 	movabs $0xffffffffffffea21,%rax
+  803fc2:	ff ff ff 
+  803fc5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fc9:	48 89 c7             	mov    %rax,%rdi
+  803fcc:	49 89 df             	mov    %rbx,%r15
+  803fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd4:	48 ba 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%rdx
+  803fdb:	ff ff ff 
+  803fde:	48 01 da             	add    %rbx,%rdx
+  803fe1:	ff d2                	call   *%rdx
+		close(fd_src);
+  803fe3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fe6:	89 c7                	mov    %eax,%edi
+  803fe8:	49 89 df             	mov    %rbx,%r15
+  803feb:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  803ff2:	ff ff ff 
+  803ff5:	48 01 d8             	add    %rbx,%rax
+  803ff8:	ff d0                	call   *%rax
+		close(fd_dest);
+  803ffa:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ffd:	89 c7                	mov    %eax,%edi
+  803fff:	49 89 df             	mov    %rbx,%r15
+  804002:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  804009:	ff ff ff 
+  80400c:	48 01 d8             	add    %rbx,%rax
+  80400f:	ff d0                	call   *%rax
+		return read_size;
+  804011:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804014:	eb 33                	jmp    804049 <copy+0x264>
+	}
+	close(fd_src);
+  804016:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804019:	89 c7                	mov    %eax,%edi
+  80401b:	49 89 df             	mov    %rbx,%r15
+  80401e:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  804025:	ff ff ff 
+  804028:	48 01 d8             	add    %rbx,%rax
+  80402b:	ff d0                	call   *%rax
+	close(fd_dest);
+  80402d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804030:	89 c7                	mov    %eax,%edi
+  804032:	49 89 df             	mov    %rbx,%r15
+  804035:	48 b8 23 ad ff ff ff 	movabs $0xffffffffffffad23,%rax
+  80403c:	ff ff ff 
+  80403f:	48 01 d8             	add    %rbx,%rax
+  804042:	ff d0                	call   *%rax
+	return 0;
+  804044:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804049:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804050:	5b                   	pop    %rbx
+  804051:	41 5f                	pop    %r15
+  804053:	5d                   	pop    %rbp
+  804054:	c3                   	ret
+
+0000000000804055 <writebuf>:
+};
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  804055:	55                   	push   %rbp
+  804056:	48 89 e5             	mov    %rsp,%rbp
+  804059:	41 57                	push   %r15
+  80405b:	48 83 ec 28          	sub    $0x28,%rsp
+  80405f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80405f <writebuf+0xa>
+  804066:	49 bb d9 3f 00 00 00 	movabs $0x3fd9,%r11
+  80406d:	00 00 00 
+  804070:	4c 01 d8             	add    %r11,%rax
+  804073:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	if (b->error > 0) {
+  804077:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80407b:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80407e:	85 d2                	test   %edx,%edx
+  804080:	7e 68                	jle    8040ea <writebuf+0x95>
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  804082:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804086:	8b 52 04             	mov    0x4(%rdx),%edx
+  804089:	48 63 d2             	movslq %edx,%rdx
+  80408c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804090:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  804094:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804098:	8b 09                	mov    (%rcx),%ecx
+  80409a:	89 cf                	mov    %ecx,%edi
+  80409c:	49 89 c7             	mov    %rax,%r15
+  80409f:	48 b9 81 b1 ff ff ff 	movabs $0xffffffffffffb181,%rcx
+  8040a6:	ff ff ff 
+  8040a9:	48 01 c1             	add    %rax,%rcx
+  8040ac:	ff d1                	call   *%rcx
+  8040ae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		if (result > 0)
+  8040b1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040b5:	7e 13                	jle    8040ca <writebuf+0x75>
+			b->result += result;
+  8040b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040bb:	8b 50 08             	mov    0x8(%rax),%edx
+  8040be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040c1:	01 c2                	add    %eax,%edx
+  8040c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040c7:	89 50 08             	mov    %edx,0x8(%rax)
+		if (result != b->idx) // error, or wrote less than supplied
+  8040ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040ce:	8b 40 04             	mov    0x4(%rax),%eax
+  8040d1:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8040d4:	74 14                	je     8040ea <writebuf+0x95>
+			b->error = (result < 0 ? result : 0);
+  8040d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040de:	85 c0                	test   %eax,%eax
+  8040e0:	0f 4e d0             	cmovle %eax,%edx
+  8040e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e7:	89 50 0c             	mov    %edx,0xc(%rax)
+	}
+}
+  8040ea:	90                   	nop
+  8040eb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8040ef:	c9                   	leave
+  8040f0:	c3                   	ret
+
+00000000008040f1 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8040f1:	55                   	push   %rbp
+  8040f2:	48 89 e5             	mov    %rsp,%rbp
+  8040f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8040f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8040f9 <putch+0x8>
+  804100:	49 bb 3f 3f 00 00 00 	movabs $0x3f3f,%r11
+  804107:	00 00 00 
+  80410a:	4c 01 d8             	add    %r11,%rax
+  80410d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804110:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct printbuf *b = (struct printbuf *) thunk;
+  804114:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804118:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	b->buf[b->idx++] = ch;
+  80411c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804120:	8b 52 04             	mov    0x4(%rdx),%edx
+  804123:	8d 72 01             	lea    0x1(%rdx),%esi
+  804126:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80412a:	89 71 04             	mov    %esi,0x4(%rcx)
+  80412d:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  804130:	89 ce                	mov    %ecx,%esi
+  804132:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804136:	48 63 d2             	movslq %edx,%rdx
+  804139:	40 88 74 11 10       	mov    %sil,0x10(%rcx,%rdx,1)
+	if (b->idx == 256) {
+  80413e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804142:	8b 52 04             	mov    0x4(%rdx),%edx
+  804145:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80414b:	75 22                	jne    80416f <putch+0x7e>
+		writebuf(b);
+  80414d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804151:	48 89 d7             	mov    %rdx,%rdi
+  804154:	48 ba 1d c0 ff ff ff 	movabs $0xffffffffffffc01d,%rdx
+  80415b:	ff ff ff 
+  80415e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804162:	ff d0                	call   *%rax
+		b->idx = 0;
+  804164:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804168:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+	}
+}
+  80416f:	90                   	nop
+  804170:	c9                   	leave
+  804171:	c3                   	ret
+
+0000000000804172 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  804172:	55                   	push   %rbp
+  804173:	48 89 e5             	mov    %rsp,%rbp
+  804176:	41 57                	push   %r15
+  804178:	53                   	push   %rbx
+  804179:	48 81 ec 30 01 00 00 	sub    $0x130,%rsp
+  804180:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804180 <vfprintf+0xe>
+  804187:	49 bb b8 3e 00 00 00 	movabs $0x3eb8,%r11
+  80418e:	00 00 00 
+  804191:	4c 01 db             	add    %r11,%rbx
+  804194:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  80419a:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  8041a1:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+	struct printbuf b;
+
+	b.fd = fd;
+  8041a8:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  8041ae:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+	b.idx = 0;
+  8041b4:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8041bb:	00 00 00 
+	b.result = 0;
+  8041be:	c7 85 e8 fe ff ff 00 	movl   $0x0,-0x118(%rbp)
+  8041c5:	00 00 00 
+	b.error = 1;
+  8041c8:	c7 85 ec fe ff ff 01 	movl   $0x1,-0x114(%rbp)
+  8041cf:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  8041d2:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  8041d9:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  8041e0:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8041e7:	48 89 c6             	mov    %rax,%rsi
+  8041ea:	48 b8 b9 c0 ff ff ff 	movabs $0xffffffffffffc0b9,%rax
+  8041f1:	ff ff ff 
+  8041f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041f8:	48 89 c7             	mov    %rax,%rdi
+  8041fb:	49 89 df             	mov    %rbx,%r15
+  8041fe:	48 b8 81 8b ff ff ff 	movabs $0xffffffffffff8b81,%rax
+  804205:	ff ff ff 
+  804208:	48 01 d8             	add    %rbx,%rax
+  80420b:	ff d0                	call   *%rax
+	if (b.idx > 0)
+  80420d:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  804213:	85 c0                	test   %eax,%eax
+  804215:	7e 1a                	jle    804231 <vfprintf+0xbf>
+		writebuf(&b);
+  804217:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80421e:	48 89 c7             	mov    %rax,%rdi
+  804221:	48 b8 1d c0 ff ff ff 	movabs $0xffffffffffffc01d,%rax
+  804228:	ff ff ff 
+  80422b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80422f:	ff d0                	call   *%rax
+
+	return (b.result ? b.result : b.error);
+  804231:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  804237:	85 c0                	test   %eax,%eax
+  804239:	74 08                	je     804243 <vfprintf+0xd1>
+  80423b:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  804241:	eb 06                	jmp    804249 <vfprintf+0xd7>
+  804243:	8b 85 ec fe ff ff    	mov    -0x114(%rbp),%eax
+}
+  804249:	48 81 c4 30 01 00 00 	add    $0x130,%rsp
+  804250:	5b                   	pop    %rbx
+  804251:	41 5f                	pop    %r15
+  804253:	5d                   	pop    %rbp
+  804254:	c3                   	ret
+
+0000000000804255 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  804255:	55                   	push   %rbp
+  804256:	48 89 e5             	mov    %rsp,%rbp
+  804259:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804260:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804260 <fprintf+0xb>
+  804267:	49 bb d8 3d 00 00 00 	movabs $0x3dd8,%r11
+  80426e:	00 00 00 
+  804271:	4d 01 da             	add    %r11,%r10
+  804274:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  80427a:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  804281:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804288:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80428f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804296:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80429d:	84 c0                	test   %al,%al
+  80429f:	74 20                	je     8042c1 <fprintf+0x6c>
+  8042a1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8042a5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8042a9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8042ad:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8042b1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8042b5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8042b9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8042bd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8042c1:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  8042c8:	00 00 00 
+  8042cb:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8042d2:	00 00 00 
+  8042d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042d9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8042e0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8042e7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(fd, fmt, ap);
+  8042ee:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8042f5:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  8042fc:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804302:	48 89 ce             	mov    %rcx,%rsi
+  804305:	89 c7                	mov    %eax,%edi
+  804307:	48 b8 3a c1 ff ff ff 	movabs $0xffffffffffffc13a,%rax
+  80430e:	ff ff ff 
+  804311:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  804315:	ff d0                	call   *%rax
+  804317:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  80431d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804323:	c9                   	leave
+  804324:	c3                   	ret
+
+0000000000804325 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  804325:	55                   	push   %rbp
+  804326:	48 89 e5             	mov    %rsp,%rbp
+  804329:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804330:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 804330 <printf+0xb>
+  804337:	49 bb 08 3d 00 00 00 	movabs $0x3d08,%r11
+  80433e:	00 00 00 
+  804341:	4d 01 da             	add    %r11,%r10
+  804344:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80434b:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  804352:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804359:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  804360:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  804367:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80436e:	84 c0                	test   %al,%al
+  804370:	74 20                	je     804392 <printf+0x6d>
+  804372:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  804376:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80437a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80437e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804382:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  804386:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80438a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80438e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  804392:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  804399:	00 00 00 
+  80439c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8043a3:	00 00 00 
+  8043a6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8043aa:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8043b1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8043b8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(1, fmt, ap);
+  8043bf:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8043c6:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8043cd:	48 89 c6             	mov    %rax,%rsi
+  8043d0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8043d5:	48 b8 3a c1 ff ff ff 	movabs $0xffffffffffffc13a,%rax
+  8043dc:	ff ff ff 
+  8043df:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8043e3:	ff d0                	call   *%rax
+  8043e5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  8043eb:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8043f1:	c9                   	leave
+  8043f2:	c3                   	ret
+
+00000000008043f3 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  8043f3:	55                   	push   %rbp
+  8043f4:	48 89 e5             	mov    %rsp,%rbp
+  8043f7:	41 57                	push   %r15
+  8043f9:	53                   	push   %rbx
+  8043fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8043fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043fe <fd2sockid+0xb>
+  804405:	49 bb 3a 3c 00 00 00 	movabs $0x3c3a,%r11
+  80440c:	00 00 00 
+  80440f:	4c 01 db             	add    %r11,%rbx
+  804412:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804415:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804419:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80441c:	48 89 d6             	mov    %rdx,%rsi
+  80441f:	89 c7                	mov    %eax,%edi
+  804421:	49 89 df             	mov    %rbx,%r15
+  804424:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  80442b:	ff ff ff 
+  80442e:	48 01 d8             	add    %rbx,%rax
+  804431:	ff d0                	call   *%rax
+  804433:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804436:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80443a:	79 05                	jns    804441 <fd2sockid+0x4e>
+		return r;
+  80443c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80443f:	eb 25                	jmp    804466 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804441:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804445:	8b 10                	mov    (%rax),%edx
+  804447:	48 b8 88 00 00 00 00 	movabs $0x88,%rax
+  80444e:	00 00 00 
+  804451:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804454:	39 c2                	cmp    %eax,%edx
+  804456:	74 07                	je     80445f <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804458:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80445d:	eb 07                	jmp    804466 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  80445f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804463:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804466:	48 83 c4 20          	add    $0x20,%rsp
+  80446a:	5b                   	pop    %rbx
+  80446b:	41 5f                	pop    %r15
+  80446d:	5d                   	pop    %rbp
+  80446e:	c3                   	ret
+
+000000000080446f <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  80446f:	55                   	push   %rbp
+  804470:	48 89 e5             	mov    %rsp,%rbp
+  804473:	41 57                	push   %r15
+  804475:	53                   	push   %rbx
+  804476:	48 83 ec 20          	sub    $0x20,%rsp
+  80447a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80447a <alloc_sockfd+0xb>
+  804481:	49 bb be 3b 00 00 00 	movabs $0x3bbe,%r11
+  804488:	00 00 00 
+  80448b:	4c 01 db             	add    %r11,%rbx
+  80448e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804491:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804495:	48 89 c7             	mov    %rax,%rdi
+  804498:	49 89 df             	mov    %rbx,%r15
+  80449b:	48 b8 de a9 ff ff ff 	movabs $0xffffffffffffa9de,%rax
+  8044a2:	ff ff ff 
+  8044a5:	48 01 d8             	add    %rbx,%rax
+  8044a8:	ff d0                	call   *%rax
+  8044aa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044b1:	78 2c                	js     8044df <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8044b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b7:	ba 07 04 00 00       	mov    $0x407,%edx
+  8044bc:	48 89 c6             	mov    %rax,%rsi
+  8044bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044c4:	49 89 df             	mov    %rbx,%r15
+  8044c7:	48 b8 bb a1 ff ff ff 	movabs $0xffffffffffffa1bb,%rax
+  8044ce:	ff ff ff 
+  8044d1:	48 01 d8             	add    %rbx,%rax
+  8044d4:	ff d0                	call   *%rax
+  8044d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044dd:	79 1c                	jns    8044fb <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8044df:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044e2:	89 c7                	mov    %eax,%edi
+  8044e4:	49 89 df             	mov    %rbx,%r15
+  8044e7:	48 b8 2b cc ff ff ff 	movabs $0xffffffffffffcc2b,%rax
+  8044ee:	ff ff ff 
+  8044f1:	48 01 d8             	add    %rbx,%rax
+  8044f4:	ff d0                	call   *%rax
+		return r;
+  8044f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044f9:	eb 41                	jmp    80453c <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  8044fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044ff:	48 ba 88 00 00 00 00 	movabs $0x88,%rdx
+  804506:	00 00 00 
+  804509:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80450c:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  80450e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804512:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804519:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80451d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804520:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804523:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804527:	48 89 c7             	mov    %rax,%rdi
+  80452a:	49 89 df             	mov    %rbx,%r15
+  80452d:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  804534:	ff ff ff 
+  804537:	48 01 d8             	add    %rbx,%rax
+  80453a:	ff d0                	call   *%rax
+}
+  80453c:	48 83 c4 20          	add    $0x20,%rsp
+  804540:	5b                   	pop    %rbx
+  804541:	41 5f                	pop    %r15
+  804543:	5d                   	pop    %rbp
+  804544:	c3                   	ret
+
+0000000000804545 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804545:	55                   	push   %rbp
+  804546:	48 89 e5             	mov    %rsp,%rbp
+  804549:	41 57                	push   %r15
+  80454b:	53                   	push   %rbx
+  80454c:	48 83 ec 30          	sub    $0x30,%rsp
+  804550:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804550 <accept+0xb>
+  804557:	49 bb e8 3a 00 00 00 	movabs $0x3ae8,%r11
+  80455e:	00 00 00 
+  804561:	4c 01 db             	add    %r11,%rbx
+  804564:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804567:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80456b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80456f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804572:	89 c7                	mov    %eax,%edi
+  804574:	48 b8 bb c3 ff ff ff 	movabs $0xffffffffffffc3bb,%rax
+  80457b:	ff ff ff 
+  80457e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804582:	ff d0                	call   *%rax
+  804584:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804587:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80458b:	79 05                	jns    804592 <accept+0x4d>
+		return r;
+  80458d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804590:	eb 45                	jmp    8045d7 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804592:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804596:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80459a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80459d:	48 89 ce             	mov    %rcx,%rsi
+  8045a0:	89 c7                	mov    %eax,%edi
+  8045a2:	49 89 df             	mov    %rbx,%r15
+  8045a5:	48 b8 99 ca ff ff ff 	movabs $0xffffffffffffca99,%rax
+  8045ac:	ff ff ff 
+  8045af:	48 01 d8             	add    %rbx,%rax
+  8045b2:	ff d0                	call   *%rax
+  8045b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8045b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045bb:	79 05                	jns    8045c2 <accept+0x7d>
+		return r;
+  8045bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045c0:	eb 15                	jmp    8045d7 <accept+0x92>
+	return alloc_sockfd(r);
+  8045c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045c5:	89 c7                	mov    %eax,%edi
+  8045c7:	48 b8 37 c4 ff ff ff 	movabs $0xffffffffffffc437,%rax
+  8045ce:	ff ff ff 
+  8045d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045d5:	ff d0                	call   *%rax
+}
+  8045d7:	48 83 c4 30          	add    $0x30,%rsp
+  8045db:	5b                   	pop    %rbx
+  8045dc:	41 5f                	pop    %r15
+  8045de:	5d                   	pop    %rbp
+  8045df:	c3                   	ret
+
+00000000008045e0 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8045e0:	55                   	push   %rbp
+  8045e1:	48 89 e5             	mov    %rsp,%rbp
+  8045e4:	41 57                	push   %r15
+  8045e6:	53                   	push   %rbx
+  8045e7:	48 83 ec 20          	sub    $0x20,%rsp
+  8045eb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045eb <bind+0xb>
+  8045f2:	49 bb 4d 3a 00 00 00 	movabs $0x3a4d,%r11
+  8045f9:	00 00 00 
+  8045fc:	4c 01 db             	add    %r11,%rbx
+  8045ff:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804602:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804606:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804609:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80460c:	89 c7                	mov    %eax,%edi
+  80460e:	48 b8 bb c3 ff ff ff 	movabs $0xffffffffffffc3bb,%rax
+  804615:	ff ff ff 
+  804618:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80461c:	ff d0                	call   *%rax
+  80461e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804621:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804625:	79 05                	jns    80462c <bind+0x4c>
+		return r;
+  804627:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80462a:	eb 21                	jmp    80464d <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80462c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80462f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804633:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804636:	48 89 ce             	mov    %rcx,%rsi
+  804639:	89 c7                	mov    %eax,%edi
+  80463b:	49 89 df             	mov    %rbx,%r15
+  80463e:	48 b8 45 cb ff ff ff 	movabs $0xffffffffffffcb45,%rax
+  804645:	ff ff ff 
+  804648:	48 01 d8             	add    %rbx,%rax
+  80464b:	ff d0                	call   *%rax
+}
+  80464d:	48 83 c4 20          	add    $0x20,%rsp
+  804651:	5b                   	pop    %rbx
+  804652:	41 5f                	pop    %r15
+  804654:	5d                   	pop    %rbp
+  804655:	c3                   	ret
+
+0000000000804656 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804656:	55                   	push   %rbp
+  804657:	48 89 e5             	mov    %rsp,%rbp
+  80465a:	41 57                	push   %r15
+  80465c:	53                   	push   %rbx
+  80465d:	48 83 ec 20          	sub    $0x20,%rsp
+  804661:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804661 <shutdown+0xb>
+  804668:	49 bb d7 39 00 00 00 	movabs $0x39d7,%r11
+  80466f:	00 00 00 
+  804672:	4c 01 db             	add    %r11,%rbx
+  804675:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804678:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80467b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80467e:	89 c7                	mov    %eax,%edi
+  804680:	48 b8 bb c3 ff ff ff 	movabs $0xffffffffffffc3bb,%rax
+  804687:	ff ff ff 
+  80468a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80468e:	ff d0                	call   *%rax
+  804690:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804693:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804697:	79 05                	jns    80469e <shutdown+0x48>
+		return r;
+  804699:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80469c:	eb 1c                	jmp    8046ba <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  80469e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8046a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046a4:	89 d6                	mov    %edx,%esi
+  8046a6:	89 c7                	mov    %eax,%edi
+  8046a8:	49 89 df             	mov    %rbx,%r15
+  8046ab:	48 b8 da cb ff ff ff 	movabs $0xffffffffffffcbda,%rax
+  8046b2:	ff ff ff 
+  8046b5:	48 01 d8             	add    %rbx,%rax
+  8046b8:	ff d0                	call   *%rax
+}
+  8046ba:	48 83 c4 20          	add    $0x20,%rsp
+  8046be:	5b                   	pop    %rbx
+  8046bf:	41 5f                	pop    %r15
+  8046c1:	5d                   	pop    %rbp
+  8046c2:	c3                   	ret
+
+00000000008046c3 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8046c3:	55                   	push   %rbp
+  8046c4:	48 89 e5             	mov    %rsp,%rbp
+  8046c7:	41 57                	push   %r15
+  8046c9:	53                   	push   %rbx
+  8046ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8046ce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046ce <devsock_close+0xb>
+  8046d5:	49 bb 6a 39 00 00 00 	movabs $0x396a,%r11
+  8046dc:	00 00 00 
+  8046df:	4c 01 db             	add    %r11,%rbx
+  8046e2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  8046e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046ea:	48 89 c7             	mov    %rax,%rdi
+  8046ed:	49 89 df             	mov    %rbx,%r15
+  8046f0:	48 b8 d7 e3 ff ff ff 	movabs $0xffffffffffffe3d7,%rax
+  8046f7:	ff ff ff 
+  8046fa:	48 01 d8             	add    %rbx,%rax
+  8046fd:	ff d0                	call   *%rax
+  8046ff:	83 f8 01             	cmp    $0x1,%eax
+  804702:	75 1d                	jne    804721 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804704:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804708:	8b 40 0c             	mov    0xc(%rax),%eax
+  80470b:	89 c7                	mov    %eax,%edi
+  80470d:	49 89 df             	mov    %rbx,%r15
+  804710:	48 b8 2b cc ff ff ff 	movabs $0xffffffffffffcc2b,%rax
+  804717:	ff ff ff 
+  80471a:	48 01 d8             	add    %rbx,%rax
+  80471d:	ff d0                	call   *%rax
+  80471f:	eb 05                	jmp    804726 <devsock_close+0x63>
+	else
+		return 0;
+  804721:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804726:	48 83 c4 10          	add    $0x10,%rsp
+  80472a:	5b                   	pop    %rbx
+  80472b:	41 5f                	pop    %r15
+  80472d:	5d                   	pop    %rbp
+  80472e:	c3                   	ret
+
+000000000080472f <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80472f:	55                   	push   %rbp
+  804730:	48 89 e5             	mov    %rsp,%rbp
+  804733:	41 57                	push   %r15
+  804735:	53                   	push   %rbx
+  804736:	48 83 ec 20          	sub    $0x20,%rsp
+  80473a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80473a <connect+0xb>
+  804741:	49 bb fe 38 00 00 00 	movabs $0x38fe,%r11
+  804748:	00 00 00 
+  80474b:	4c 01 db             	add    %r11,%rbx
+  80474e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804751:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804755:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804758:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80475b:	89 c7                	mov    %eax,%edi
+  80475d:	48 b8 bb c3 ff ff ff 	movabs $0xffffffffffffc3bb,%rax
+  804764:	ff ff ff 
+  804767:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80476b:	ff d0                	call   *%rax
+  80476d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804770:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804774:	79 05                	jns    80477b <connect+0x4c>
+		return r;
+  804776:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804779:	eb 21                	jmp    80479c <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80477b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80477e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804782:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804785:	48 89 ce             	mov    %rcx,%rsi
+  804788:	89 c7                	mov    %eax,%edi
+  80478a:	49 89 df             	mov    %rbx,%r15
+  80478d:	48 b8 73 cc ff ff ff 	movabs $0xffffffffffffcc73,%rax
+  804794:	ff ff ff 
+  804797:	48 01 d8             	add    %rbx,%rax
+  80479a:	ff d0                	call   *%rax
+}
+  80479c:	48 83 c4 20          	add    $0x20,%rsp
+  8047a0:	5b                   	pop    %rbx
+  8047a1:	41 5f                	pop    %r15
+  8047a3:	5d                   	pop    %rbp
+  8047a4:	c3                   	ret
+
+00000000008047a5 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8047a5:	55                   	push   %rbp
+  8047a6:	48 89 e5             	mov    %rsp,%rbp
+  8047a9:	41 57                	push   %r15
+  8047ab:	53                   	push   %rbx
+  8047ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8047b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047b0 <listen+0xb>
+  8047b7:	49 bb 88 38 00 00 00 	movabs $0x3888,%r11
+  8047be:	00 00 00 
+  8047c1:	4c 01 db             	add    %r11,%rbx
+  8047c4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8047c7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8047ca:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8047cd:	89 c7                	mov    %eax,%edi
+  8047cf:	48 b8 bb c3 ff ff ff 	movabs $0xffffffffffffc3bb,%rax
+  8047d6:	ff ff ff 
+  8047d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047dd:	ff d0                	call   *%rax
+  8047df:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047e6:	79 05                	jns    8047ed <listen+0x48>
+		return r;
+  8047e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047eb:	eb 1c                	jmp    804809 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  8047ed:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8047f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047f3:	89 d6                	mov    %edx,%esi
+  8047f5:	89 c7                	mov    %eax,%edi
+  8047f7:	49 89 df             	mov    %rbx,%r15
+  8047fa:	48 b8 08 cd ff ff ff 	movabs $0xffffffffffffcd08,%rax
+  804801:	ff ff ff 
+  804804:	48 01 d8             	add    %rbx,%rax
+  804807:	ff d0                	call   *%rax
+}
+  804809:	48 83 c4 20          	add    $0x20,%rsp
+  80480d:	5b                   	pop    %rbx
+  80480e:	41 5f                	pop    %r15
+  804810:	5d                   	pop    %rbp
+  804811:	c3                   	ret
+
+0000000000804812 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804812:	55                   	push   %rbp
+  804813:	48 89 e5             	mov    %rsp,%rbp
+  804816:	41 57                	push   %r15
+  804818:	48 83 ec 28          	sub    $0x28,%rsp
+  80481c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80481c <devsock_read+0xa>
+  804823:	49 bb 1c 38 00 00 00 	movabs $0x381c,%r11
+  80482a:	00 00 00 
+  80482d:	4c 01 d8             	add    %r11,%rax
+  804830:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804834:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804838:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80483c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804840:	41 89 d0             	mov    %edx,%r8d
+  804843:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804847:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80484a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80484e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804853:	44 89 c2             	mov    %r8d,%edx
+  804856:	49 89 c7             	mov    %rax,%r15
+  804859:	49 b8 59 cd ff ff ff 	movabs $0xffffffffffffcd59,%r8
+  804860:	ff ff ff 
+  804863:	49 01 c0             	add    %rax,%r8
+  804866:	41 ff d0             	call   *%r8
+}
+  804869:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80486d:	c9                   	leave
+  80486e:	c3                   	ret
+
+000000000080486f <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80486f:	55                   	push   %rbp
+  804870:	48 89 e5             	mov    %rsp,%rbp
+  804873:	41 57                	push   %r15
+  804875:	48 83 ec 28          	sub    $0x28,%rsp
+  804879:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804879 <devsock_write+0xa>
+  804880:	49 bb bf 37 00 00 00 	movabs $0x37bf,%r11
+  804887:	00 00 00 
+  80488a:	4c 01 d8             	add    %r11,%rax
+  80488d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804891:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804895:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804899:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80489d:	41 89 d0             	mov    %edx,%r8d
+  8048a0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8048a4:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8048a7:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8048ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8048b0:	44 89 c2             	mov    %r8d,%edx
+  8048b3:	49 89 c7             	mov    %rax,%r15
+  8048b6:	49 b8 76 ce ff ff ff 	movabs $0xffffffffffffce76,%r8
+  8048bd:	ff ff ff 
+  8048c0:	49 01 c0             	add    %rax,%r8
+  8048c3:	41 ff d0             	call   *%r8
+}
+  8048c6:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8048ca:	c9                   	leave
+  8048cb:	c3                   	ret
+
+00000000008048cc <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8048cc:	55                   	push   %rbp
+  8048cd:	48 89 e5             	mov    %rsp,%rbp
+  8048d0:	41 57                	push   %r15
+  8048d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8048d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8048d6 <devsock_stat+0xa>
+  8048dd:	49 bb 62 37 00 00 00 	movabs $0x3762,%r11
+  8048e4:	00 00 00 
+  8048e7:	4c 01 d8             	add    %r11,%rax
+  8048ea:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8048ee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8048f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8048f6:	48 b9 3c ea ff ff ff 	movabs $0xffffffffffffea3c,%rcx
+  8048fd:	ff ff ff 
+  804900:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804904:	48 89 ce             	mov    %rcx,%rsi
+  804907:	48 89 d7             	mov    %rdx,%rdi
+  80490a:	49 89 c7             	mov    %rax,%r15
+  80490d:	48 ba ff 94 ff ff ff 	movabs $0xffffffffffff94ff,%rdx
+  804914:	ff ff ff 
+  804917:	48 01 c2             	add    %rax,%rdx
+  80491a:	ff d2                	call   *%rdx
+	return 0;
+  80491c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804921:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804925:	c9                   	leave
+  804926:	c3                   	ret
+
+0000000000804927 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804927:	55                   	push   %rbp
+  804928:	48 89 e5             	mov    %rsp,%rbp
+  80492b:	41 57                	push   %r15
+  80492d:	53                   	push   %rbx
+  80492e:	48 83 ec 20          	sub    $0x20,%rsp
+  804932:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804932 <socket+0xb>
+  804939:	49 bb 06 37 00 00 00 	movabs $0x3706,%r11
+  804940:	00 00 00 
+  804943:	4c 01 db             	add    %r11,%rbx
+  804946:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804949:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80494c:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80494f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804952:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804955:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804958:	89 ce                	mov    %ecx,%esi
+  80495a:	89 c7                	mov    %eax,%edi
+  80495c:	49 89 df             	mov    %rbx,%r15
+  80495f:	48 b8 4d d0 ff ff ff 	movabs $0xffffffffffffd04d,%rax
+  804966:	ff ff ff 
+  804969:	48 01 d8             	add    %rbx,%rax
+  80496c:	ff d0                	call   *%rax
+  80496e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804971:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804975:	79 05                	jns    80497c <socket+0x55>
+		return r;
+  804977:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80497a:	eb 15                	jmp    804991 <socket+0x6a>
+	return alloc_sockfd(r);
+  80497c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80497f:	89 c7                	mov    %eax,%edi
+  804981:	48 b8 37 c4 ff ff ff 	movabs $0xffffffffffffc437,%rax
+  804988:	ff ff ff 
+  80498b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80498f:	ff d0                	call   *%rax
+}
+  804991:	48 83 c4 20          	add    $0x20,%rsp
+  804995:	5b                   	pop    %rbx
+  804996:	41 5f                	pop    %r15
+  804998:	5d                   	pop    %rbp
+  804999:	c3                   	ret
+
+000000000080499a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80499a:	55                   	push   %rbp
+  80499b:	48 89 e5             	mov    %rsp,%rbp
+  80499e:	41 57                	push   %r15
+  8049a0:	53                   	push   %rbx
+  8049a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8049a5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049a5 <nsipc+0xb>
+  8049ac:	49 bb 93 36 00 00 00 	movabs $0x3693,%r11
+  8049b3:	00 00 00 
+  8049b6:	4c 01 db             	add    %r11,%rbx
+  8049b9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8049bc:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8049c3:	00 00 00 
+  8049c6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049c9:	85 c0                	test   %eax,%eax
+  8049cb:	75 24                	jne    8049f1 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8049cd:	bf 02 00 00 00       	mov    $0x2,%edi
+  8049d2:	49 89 df             	mov    %rbx,%r15
+  8049d5:	48 b8 48 e3 ff ff ff 	movabs $0xffffffffffffe348,%rax
+  8049dc:	ff ff ff 
+  8049df:	48 01 d8             	add    %rbx,%rax
+  8049e2:	ff d0                	call   *%rax
+  8049e4:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  8049eb:	00 00 00 
+  8049ee:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  8049f1:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8049f8:	00 00 00 
+  8049fb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049fe:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804a01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804a07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804a0d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804a12:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804a19:	00 00 00 
+  804a1c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804a20:	89 c7                	mov    %eax,%edi
+  804a22:	49 89 df             	mov    %rbx,%r15
+  804a25:	48 b8 67 dd ff ff ff 	movabs $0xffffffffffffdd67,%rax
+  804a2c:	ff ff ff 
+  804a2f:	48 01 d8             	add    %rbx,%rax
+  804a32:	ff d0                	call   *%rax
+}
+  804a34:	48 83 c4 10          	add    $0x10,%rsp
+  804a38:	5b                   	pop    %rbx
+  804a39:	41 5f                	pop    %r15
+  804a3b:	5d                   	pop    %rbp
+  804a3c:	c3                   	ret
+
+0000000000804a3d <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804a3d:	55                   	push   %rbp
+  804a3e:	48 89 e5             	mov    %rsp,%rbp
+  804a41:	41 57                	push   %r15
+  804a43:	53                   	push   %rbx
+  804a44:	48 83 ec 20          	sub    $0x20,%rsp
+  804a48:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a48 <nsipc_words+0xb>
+  804a4f:	49 bb f0 35 00 00 00 	movabs $0x35f0,%r11
+  804a56:	00 00 00 
+  804a59:	4c 01 db             	add    %r11,%rbx
+  804a5c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804a5f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804a63:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  804a67:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804a6e:	00 00 00 
+  804a71:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a74:	85 c0                	test   %eax,%eax
+  804a76:	75 24                	jne    804a9c <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804a78:	bf 02 00 00 00       	mov    $0x2,%edi
+  804a7d:	49 89 df             	mov    %rbx,%r15
+  804a80:	48 b8 48 e3 ff ff ff 	movabs $0xffffffffffffe348,%rax
+  804a87:	ff ff ff 
+  804a8a:	48 01 d8             	add    %rbx,%rax
+  804a8d:	ff d0                	call   *%rax
+  804a8f:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  804a96:	00 00 00 
+  804a99:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804a9c:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804aa3:	00 00 00 
+  804aa6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804aa9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804aad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804ab1:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804ab4:	89 c7                	mov    %eax,%edi
+  804ab6:	49 89 df             	mov    %rbx,%r15
+  804ab9:	48 b8 52 de ff ff ff 	movabs $0xffffffffffffde52,%rax
+  804ac0:	ff ff ff 
+  804ac3:	48 01 d8             	add    %rbx,%rax
+  804ac6:	ff d0                	call   *%rax
+}
+  804ac8:	48 83 c4 20          	add    $0x20,%rsp
+  804acc:	5b                   	pop    %rbx
+  804acd:	41 5f                	pop    %r15
+  804acf:	5d                   	pop    %rbp
+  804ad0:	c3                   	ret
+
+0000000000804ad1 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804ad1:	55                   	push   %rbp
+  804ad2:	48 89 e5             	mov    %rsp,%rbp
+  804ad5:	41 57                	push   %r15
+  804ad7:	53                   	push   %rbx
+  804ad8:	48 83 ec 30          	sub    $0x30,%rsp
+  804adc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804adc <nsipc_accept+0xb>
+  804ae3:	49 bb 5c 35 00 00 00 	movabs $0x355c,%r11
+  804aea:	00 00 00 
+  804aed:	4c 01 db             	add    %r11,%rbx
+  804af0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804af3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804af7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  804afb:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804b02:	00 00 00 
+  804b05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b08:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  804b0b:	bf 01 00 00 00       	mov    $0x1,%edi
+  804b10:	48 b8 62 c9 ff ff ff 	movabs $0xffffffffffffc962,%rax
+  804b17:	ff ff ff 
+  804b1a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b1e:	ff d0                	call   *%rax
+  804b20:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b23:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b27:	78 48                	js     804b71 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  804b29:	48 b8 c8 3f 01 00 00 	movabs $0x13fc8,%rax
+  804b30:	00 00 00 
+  804b33:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b37:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804b3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b3f:	8b 40 10             	mov    0x10(%rax),%eax
+  804b42:	89 c2                	mov    %eax,%edx
+  804b44:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804b48:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b4c:	48 89 ce             	mov    %rcx,%rsi
+  804b4f:	48 89 c7             	mov    %rax,%rdi
+  804b52:	49 89 df             	mov    %rbx,%r15
+  804b55:	48 b8 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rax
+  804b5c:	ff ff ff 
+  804b5f:	48 01 d8             	add    %rbx,%rax
+  804b62:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  804b64:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b68:	8b 50 10             	mov    0x10(%rax),%edx
+  804b6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b6f:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  804b71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804b74:	48 83 c4 30          	add    $0x30,%rsp
+  804b78:	5b                   	pop    %rbx
+  804b79:	41 5f                	pop    %r15
+  804b7b:	5d                   	pop    %rbp
+  804b7c:	c3                   	ret
+
+0000000000804b7d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804b7d:	55                   	push   %rbp
+  804b7e:	48 89 e5             	mov    %rsp,%rbp
+  804b81:	41 57                	push   %r15
+  804b83:	53                   	push   %rbx
+  804b84:	48 83 ec 10          	sub    $0x10,%rsp
+  804b88:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b88 <nsipc_bind+0xb>
+  804b8f:	49 bb b0 34 00 00 00 	movabs $0x34b0,%r11
+  804b96:	00 00 00 
+  804b99:	4c 01 db             	add    %r11,%rbx
+  804b9c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804b9f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804ba3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  804ba6:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804bad:	00 00 00 
+  804bb0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bb3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  804bb6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804bb9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bbd:	48 89 c6             	mov    %rax,%rsi
+  804bc0:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  804bc7:	00 00 00 
+  804bca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bce:	48 89 c7             	mov    %rax,%rdi
+  804bd1:	49 89 df             	mov    %rbx,%r15
+  804bd4:	48 b8 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rax
+  804bdb:	ff ff ff 
+  804bde:	48 01 d8             	add    %rbx,%rax
+  804be1:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804be3:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804bea:	00 00 00 
+  804bed:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bf0:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804bf4:	bf 02 00 00 00       	mov    $0x2,%edi
+  804bf9:	48 b8 62 c9 ff ff ff 	movabs $0xffffffffffffc962,%rax
+  804c00:	ff ff ff 
+  804c03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c07:	ff d0                	call   *%rax
+}
+  804c09:	48 83 c4 10          	add    $0x10,%rsp
+  804c0d:	5b                   	pop    %rbx
+  804c0e:	41 5f                	pop    %r15
+  804c10:	5d                   	pop    %rbp
+  804c11:	c3                   	ret
+
+0000000000804c12 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804c12:	55                   	push   %rbp
+  804c13:	48 89 e5             	mov    %rsp,%rbp
+  804c16:	48 83 ec 20          	sub    $0x20,%rsp
+  804c1a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c1a <nsipc_shutdown+0x8>
+  804c21:	49 bb 1e 34 00 00 00 	movabs $0x341e,%r11
+  804c28:	00 00 00 
+  804c2b:	4c 01 d8             	add    %r11,%rax
+  804c2e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804c31:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  804c34:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804c37:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  804c3a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804c3d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  804c40:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804c44:	ba 08 00 00 00       	mov    $0x8,%edx
+  804c49:	48 89 ce             	mov    %rcx,%rsi
+  804c4c:	bf 03 00 00 00       	mov    $0x3,%edi
+  804c51:	48 b9 05 ca ff ff ff 	movabs $0xffffffffffffca05,%rcx
+  804c58:	ff ff ff 
+  804c5b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804c5f:	ff d0                	call   *%rax
+}
+  804c61:	c9                   	leave
+  804c62:	c3                   	ret
+
+0000000000804c63 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  804c63:	55                   	push   %rbp
+  804c64:	48 89 e5             	mov    %rsp,%rbp
+  804c67:	48 83 ec 20          	sub    $0x20,%rsp
+  804c6b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c6b <nsipc_close+0x8>
+  804c72:	49 bb cd 33 00 00 00 	movabs $0x33cd,%r11
+  804c79:	00 00 00 
+  804c7c:	4c 01 d8             	add    %r11,%rax
+  804c7f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  804c82:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804c85:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  804c88:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804c8c:	ba 04 00 00 00       	mov    $0x4,%edx
+  804c91:	48 89 ce             	mov    %rcx,%rsi
+  804c94:	bf 04 00 00 00       	mov    $0x4,%edi
+  804c99:	48 b9 05 ca ff ff ff 	movabs $0xffffffffffffca05,%rcx
+  804ca0:	ff ff ff 
+  804ca3:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804ca7:	ff d0                	call   *%rax
+}
+  804ca9:	c9                   	leave
+  804caa:	c3                   	ret
+
+0000000000804cab <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804cab:	55                   	push   %rbp
+  804cac:	48 89 e5             	mov    %rsp,%rbp
+  804caf:	41 57                	push   %r15
+  804cb1:	53                   	push   %rbx
+  804cb2:	48 83 ec 10          	sub    $0x10,%rsp
+  804cb6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cb6 <nsipc_connect+0xb>
+  804cbd:	49 bb 82 33 00 00 00 	movabs $0x3382,%r11
+  804cc4:	00 00 00 
+  804cc7:	4c 01 db             	add    %r11,%rbx
+  804cca:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804ccd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804cd1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804cd4:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804cdb:	00 00 00 
+  804cde:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ce1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804ce4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804ce7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ceb:	48 89 c6             	mov    %rax,%rsi
+  804cee:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  804cf5:	00 00 00 
+  804cf8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cfc:	48 89 c7             	mov    %rax,%rdi
+  804cff:	49 89 df             	mov    %rbx,%r15
+  804d02:	48 b8 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rax
+  804d09:	ff ff ff 
+  804d0c:	48 01 d8             	add    %rbx,%rax
+  804d0f:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  804d11:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804d18:	00 00 00 
+  804d1b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d1e:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  804d22:	bf 05 00 00 00       	mov    $0x5,%edi
+  804d27:	48 b8 62 c9 ff ff ff 	movabs $0xffffffffffffc962,%rax
+  804d2e:	ff ff ff 
+  804d31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d35:	ff d0                	call   *%rax
+}
+  804d37:	48 83 c4 10          	add    $0x10,%rsp
+  804d3b:	5b                   	pop    %rbx
+  804d3c:	41 5f                	pop    %r15
+  804d3e:	5d                   	pop    %rbp
+  804d3f:	c3                   	ret
+
+0000000000804d40 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  804d40:	55                   	push   %rbp
+  804d41:	48 89 e5             	mov    %rsp,%rbp
+  804d44:	48 83 ec 20          	sub    $0x20,%rsp
+  804d48:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d48 <nsipc_listen+0x8>
+  804d4f:	49 bb f0 32 00 00 00 	movabs $0x32f0,%r11
+  804d56:	00 00 00 
+  804d59:	4c 01 d8             	add    %r11,%rax
+  804d5c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804d5f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804d62:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804d65:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  804d68:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804d6b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804d6e:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804d72:	ba 08 00 00 00       	mov    $0x8,%edx
+  804d77:	48 89 ce             	mov    %rcx,%rsi
+  804d7a:	bf 06 00 00 00       	mov    $0x6,%edi
+  804d7f:	48 b9 05 ca ff ff ff 	movabs $0xffffffffffffca05,%rcx
+  804d86:	ff ff ff 
+  804d89:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804d8d:	ff d0                	call   *%rax
+}
+  804d8f:	c9                   	leave
+  804d90:	c3                   	ret
+
+0000000000804d91 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  804d91:	55                   	push   %rbp
+  804d92:	48 89 e5             	mov    %rsp,%rbp
+  804d95:	41 57                	push   %r15
+  804d97:	53                   	push   %rbx
+  804d98:	48 83 ec 30          	sub    $0x30,%rsp
+  804d9c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d9c <nsipc_recv+0xb>
+  804da3:	49 bb 9c 32 00 00 00 	movabs $0x329c,%r11
+  804daa:	00 00 00 
+  804dad:	4c 01 db             	add    %r11,%rbx
+  804db0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804db3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804db7:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  804dba:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804dbd:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804dc4:	00 00 00 
+  804dc7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804dca:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  804dcd:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804dd4:	00 00 00 
+  804dd7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804dda:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804dde:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  804de5:	00 00 00 
+  804de8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804deb:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804def:	bf 07 00 00 00       	mov    $0x7,%edi
+  804df4:	48 b8 62 c9 ff ff ff 	movabs $0xffffffffffffc962,%rax
+  804dfb:	ff ff ff 
+  804dfe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e02:	ff d0                	call   *%rax
+  804e04:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e07:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e0b:	0f 88 91 00 00 00    	js     804ea2 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  804e11:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804e18:	7f 08                	jg     804e22 <nsipc_recv+0x91>
+  804e1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e1d:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  804e20:	7e 50                	jle    804e72 <nsipc_recv+0xe1>
+  804e22:	48 b8 43 ea ff ff ff 	movabs $0xffffffffffffea43,%rax
+  804e29:	ff ff ff 
+  804e2c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e30:	48 89 c1             	mov    %rax,%rcx
+  804e33:	48 b8 58 ea ff ff ff 	movabs $0xffffffffffffea58,%rax
+  804e3a:	ff ff ff 
+  804e3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e41:	48 89 c2             	mov    %rax,%rdx
+  804e44:	be 79 00 00 00       	mov    $0x79,%esi
+  804e49:	48 b8 6d ea ff ff ff 	movabs $0xffffffffffffea6d,%rax
+  804e50:	ff ff ff 
+  804e53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e57:	48 89 c7             	mov    %rax,%rdi
+  804e5a:	49 89 df             	mov    %rbx,%r15
+  804e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e62:	49 b8 66 84 ff ff ff 	movabs $0xffffffffffff8466,%r8
+  804e69:	ff ff ff 
+  804e6c:	49 01 d8             	add    %rbx,%r8
+  804e6f:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804e72:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e75:	48 63 d0             	movslq %eax,%rdx
+  804e78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e7c:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  804e83:	00 00 00 
+  804e86:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  804e8a:	48 89 ce             	mov    %rcx,%rsi
+  804e8d:	48 89 c7             	mov    %rax,%rdi
+  804e90:	49 89 df             	mov    %rbx,%r15
+  804e93:	48 b8 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rax
+  804e9a:	ff ff ff 
+  804e9d:	48 01 d8             	add    %rbx,%rax
+  804ea0:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804ea2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804ea5:	48 83 c4 30          	add    $0x30,%rsp
+  804ea9:	5b                   	pop    %rbx
+  804eaa:	41 5f                	pop    %r15
+  804eac:	5d                   	pop    %rbp
+  804ead:	c3                   	ret
+
+0000000000804eae <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804eae:	55                   	push   %rbp
+  804eaf:	48 89 e5             	mov    %rsp,%rbp
+  804eb2:	41 57                	push   %r15
+  804eb4:	53                   	push   %rbx
+  804eb5:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804ebc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ebc <nsipc_send+0xe>
+  804ec3:	49 bb 7c 31 00 00 00 	movabs $0x317c,%r11
+  804eca:	00 00 00 
+  804ecd:	4c 01 db             	add    %r11,%rbx
+  804ed0:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804ed6:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804edd:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804ee3:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804ee9:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804eed:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804ef1:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  804ef8:	00 00 00 
+  804efb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804efe:	85 c0                	test   %eax,%eax
+  804f00:	75 24                	jne    804f26 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804f02:	bf 02 00 00 00       	mov    $0x2,%edi
+  804f07:	49 89 df             	mov    %rbx,%r15
+  804f0a:	48 b8 48 e3 ff ff ff 	movabs $0xffffffffffffe348,%rax
+  804f11:	ff ff ff 
+  804f14:	48 01 d8             	add    %rbx,%rax
+  804f17:	ff d0                	call   *%rax
+  804f19:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  804f20:	00 00 00 
+  804f23:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804f26:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804f2c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804f2f:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804f36:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804f39:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804f3c:	39 c2                	cmp    %eax,%edx
+  804f3e:	0f 4e c2             	cmovle %edx,%eax
+  804f41:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804f47:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804f4d:	48 63 d0             	movslq %eax,%rdx
+  804f50:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804f57:	48 89 c6             	mov    %rax,%rsi
+  804f5a:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804f61:	00 00 00 
+  804f64:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f68:	48 89 c7             	mov    %rax,%rdi
+  804f6b:	49 89 df             	mov    %rbx,%r15
+  804f6e:	48 b8 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rax
+  804f75:	ff ff ff 
+  804f78:	48 01 d8             	add    %rbx,%rax
+  804f7b:	ff d0                	call   *%rax
+	req->req_s = s;
+  804f7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f81:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804f87:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804f89:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f8d:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804f93:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804f96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f9a:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804fa0:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804fa3:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804faa:	00 00 00 
+  804fad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fb1:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804fb5:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804fbc:	00 
+  804fbd:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804fc3:	48 63 d0             	movslq %eax,%rdx
+  804fc6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fca:	48 01 d0             	add    %rdx,%rax
+  804fcd:	48 83 e8 01          	sub    $0x1,%rax
+  804fd1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804fd5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fde:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804fe2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fe6:	48 29 d0             	sub    %rdx,%rax
+  804fe9:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804fef:	85 c0                	test   %eax,%eax
+  804ff1:	0f 48 c2             	cmovs  %edx,%eax
+  804ff4:	c1 f8 0c             	sar    $0xc,%eax
+  804ff7:	48 98                	cltq
+  804ff9:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804ffd:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805001:	48 85 c0             	test   %rax,%rax
+  805004:	0f 95 c0             	setne  %al
+  805007:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  80500a:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  805011:	00 
+  805012:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805016:	48 83 c0 0b          	add    $0xb,%rax
+  80501a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80501e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805022:	ba 00 00 00 00       	mov    $0x0,%edx
+  805027:	48 f7 75 c8          	divq   -0x38(%rbp)
+  80502b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80502f:	48 29 d0             	sub    %rdx,%rax
+  805032:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805036:	89 c7                	mov    %eax,%edi
+  805038:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  80503f:	00 00 00 
+  805042:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805045:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805049:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  80504d:	48 83 ec 08          	sub    $0x8,%rsp
+  805051:	6a 00                	push   $0x0
+  805053:	6a 00                	push   $0x0
+  805055:	6a 05                	push   $0x5
+  805057:	41 89 f1             	mov    %esi,%r9d
+  80505a:	49 89 c8             	mov    %rcx,%r8
+  80505d:	89 f9                	mov    %edi,%ecx
+  80505f:	be 08 00 00 00       	mov    $0x8,%esi
+  805064:	89 c7                	mov    %eax,%edi
+  805066:	49 89 df             	mov    %rbx,%r15
+  805069:	48 b8 50 df ff ff ff 	movabs $0xffffffffffffdf50,%rax
+  805070:	ff ff ff 
+  805073:	48 01 d8             	add    %rbx,%rax
+  805076:	ff d0                	call   *%rax
+  805078:	48 83 c4 20          	add    $0x20,%rsp
+}
+  80507c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805080:	5b                   	pop    %rbx
+  805081:	41 5f                	pop    %r15
+  805083:	5d                   	pop    %rbp
+  805084:	c3                   	ret
+
+0000000000805085 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805085:	55                   	push   %rbp
+  805086:	48 89 e5             	mov    %rsp,%rbp
+  805089:	48 83 ec 10          	sub    $0x10,%rsp
+  80508d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80508d <nsipc_socket+0x8>
+  805094:	49 bb ab 2f 00 00 00 	movabs $0x2fab,%r11
+  80509b:	00 00 00 
+  80509e:	4c 01 d8             	add    %r11,%rax
+  8050a1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8050a4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8050a7:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8050aa:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  8050b1:	00 00 00 
+  8050b4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8050b7:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8050ba:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  8050c1:	00 00 00 
+  8050c4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8050c7:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8050cb:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  8050d2:	00 00 00 
+  8050d5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8050d8:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8050dc:	bf 09 00 00 00       	mov    $0x9,%edi
+  8050e1:	48 ba 62 c9 ff ff ff 	movabs $0xffffffffffffc962,%rdx
+  8050e8:	ff ff ff 
+  8050eb:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8050ef:	ff d0                	call   *%rax
+}
+  8050f1:	c9                   	leave
+  8050f2:	c3                   	ret
+
+00000000008050f3 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8050f3:	55                   	push   %rbp
+  8050f4:	48 89 e5             	mov    %rsp,%rbp
+  8050f7:	41 57                	push   %r15
+  8050f9:	53                   	push   %rbx
+  8050fa:	48 83 ec 30          	sub    $0x30,%rsp
+  8050fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050fe <pipe+0xb>
+  805105:	49 bb 3a 2f 00 00 00 	movabs $0x2f3a,%r11
+  80510c:	00 00 00 
+  80510f:	4c 01 db             	add    %r11,%rbx
+  805112:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805116:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  80511a:	48 89 c7             	mov    %rax,%rdi
+  80511d:	49 89 df             	mov    %rbx,%r15
+  805120:	48 b8 de a9 ff ff ff 	movabs $0xffffffffffffa9de,%rax
+  805127:	ff ff ff 
+  80512a:	48 01 d8             	add    %rbx,%rax
+  80512d:	ff d0                	call   *%rax
+  80512f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805132:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805136:	0f 88 12 02 00 00    	js     80534e <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80513c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805140:	ba 07 04 00 00       	mov    $0x407,%edx
+  805145:	48 89 c6             	mov    %rax,%rsi
+  805148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80514d:	49 89 df             	mov    %rbx,%r15
+  805150:	48 b8 bb a1 ff ff ff 	movabs $0xffffffffffffa1bb,%rax
+  805157:	ff ff ff 
+  80515a:	48 01 d8             	add    %rbx,%rax
+  80515d:	ff d0                	call   *%rax
+  80515f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805162:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805166:	0f 88 e2 01 00 00    	js     80534e <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  80516c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805170:	48 89 c7             	mov    %rax,%rdi
+  805173:	49 89 df             	mov    %rbx,%r15
+  805176:	48 b8 de a9 ff ff ff 	movabs $0xffffffffffffa9de,%rax
+  80517d:	ff ff ff 
+  805180:	48 01 d8             	add    %rbx,%rax
+  805183:	ff d0                	call   *%rax
+  805185:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805188:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80518c:	0f 88 9b 01 00 00    	js     80532d <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805192:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805196:	ba 07 04 00 00       	mov    $0x407,%edx
+  80519b:	48 89 c6             	mov    %rax,%rsi
+  80519e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051a3:	49 89 df             	mov    %rbx,%r15
+  8051a6:	48 b8 bb a1 ff ff ff 	movabs $0xffffffffffffa1bb,%rax
+  8051ad:	ff ff ff 
+  8051b0:	48 01 d8             	add    %rbx,%rax
+  8051b3:	ff d0                	call   *%rax
+  8051b5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051b8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051bc:	0f 88 6b 01 00 00    	js     80532d <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8051c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051c6:	48 89 c7             	mov    %rax,%rdi
+  8051c9:	49 89 df             	mov    %rbx,%r15
+  8051cc:	48 b8 9b a9 ff ff ff 	movabs $0xffffffffffffa99b,%rax
+  8051d3:	ff ff ff 
+  8051d6:	48 01 d8             	add    %rbx,%rax
+  8051d9:	ff d0                	call   *%rax
+  8051db:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8051df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051e3:	ba 07 04 00 00       	mov    $0x407,%edx
+  8051e8:	48 89 c6             	mov    %rax,%rsi
+  8051eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051f0:	49 89 df             	mov    %rbx,%r15
+  8051f3:	48 b8 bb a1 ff ff ff 	movabs $0xffffffffffffa1bb,%rax
+  8051fa:	ff ff ff 
+  8051fd:	48 01 d8             	add    %rbx,%rax
+  805200:	ff d0                	call   *%rax
+  805202:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805205:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805209:	0f 88 fd 00 00 00    	js     80530c <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80520f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805213:	48 89 c7             	mov    %rax,%rdi
+  805216:	49 89 df             	mov    %rbx,%r15
+  805219:	48 b8 9b a9 ff ff ff 	movabs $0xffffffffffffa99b,%rax
+  805220:	ff ff ff 
+  805223:	48 01 d8             	add    %rbx,%rax
+  805226:	ff d0                	call   *%rax
+  805228:	48 89 c2             	mov    %rax,%rdx
+  80522b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80522f:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805235:	48 89 d1             	mov    %rdx,%rcx
+  805238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80523d:	48 89 c6             	mov    %rax,%rsi
+  805240:	bf 00 00 00 00       	mov    $0x0,%edi
+  805245:	49 89 df             	mov    %rbx,%r15
+  805248:	48 b8 20 a2 ff ff ff 	movabs $0xffffffffffffa220,%rax
+  80524f:	ff ff ff 
+  805252:	48 01 d8             	add    %rbx,%rax
+  805255:	ff d0                	call   *%rax
+  805257:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80525a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80525e:	0f 88 87 00 00 00    	js     8052eb <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805264:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805268:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  80526f:	00 00 00 
+  805272:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805275:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805277:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80527b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805282:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805286:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  80528d:	00 00 00 
+  805290:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805293:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805295:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805299:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8052a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052a4:	48 89 c7             	mov    %rax,%rdi
+  8052a7:	49 89 df             	mov    %rbx,%r15
+  8052aa:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  8052b1:	ff ff ff 
+  8052b4:	48 01 d8             	add    %rbx,%rax
+  8052b7:	ff d0                	call   *%rax
+  8052b9:	89 c2                	mov    %eax,%edx
+  8052bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052bf:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8052c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052c5:	48 89 c7             	mov    %rax,%rdi
+  8052c8:	49 89 df             	mov    %rbx,%r15
+  8052cb:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  8052d2:	ff ff ff 
+  8052d5:	48 01 d8             	add    %rbx,%rax
+  8052d8:	ff d0                	call   *%rax
+  8052da:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8052de:	48 83 c2 04          	add    $0x4,%rdx
+  8052e2:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  8052e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052e9:	eb 67                	jmp    805352 <pipe+0x25f>
+		goto err3;
+  8052eb:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  8052ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052f0:	48 89 c6             	mov    %rax,%rsi
+  8052f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052f8:	49 89 df             	mov    %rbx,%r15
+  8052fb:	48 b8 93 a2 ff ff ff 	movabs $0xffffffffffffa293,%rax
+  805302:	ff ff ff 
+  805305:	48 01 d8             	add    %rbx,%rax
+  805308:	ff d0                	call   *%rax
+  80530a:	eb 01                	jmp    80530d <pipe+0x21a>
+		goto err2;
+  80530c:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80530d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805311:	48 89 c6             	mov    %rax,%rsi
+  805314:	bf 00 00 00 00       	mov    $0x0,%edi
+  805319:	49 89 df             	mov    %rbx,%r15
+  80531c:	48 b8 93 a2 ff ff ff 	movabs $0xffffffffffffa293,%rax
+  805323:	ff ff ff 
+  805326:	48 01 d8             	add    %rbx,%rax
+  805329:	ff d0                	call   *%rax
+  80532b:	eb 01                	jmp    80532e <pipe+0x23b>
+		goto err1;
+  80532d:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  80532e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805332:	48 89 c6             	mov    %rax,%rsi
+  805335:	bf 00 00 00 00       	mov    $0x0,%edi
+  80533a:	49 89 df             	mov    %rbx,%r15
+  80533d:	48 b8 93 a2 ff ff ff 	movabs $0xffffffffffffa293,%rax
+  805344:	ff ff ff 
+  805347:	48 01 d8             	add    %rbx,%rax
+  80534a:	ff d0                	call   *%rax
+  80534c:	eb 01                	jmp    80534f <pipe+0x25c>
+		goto err;
+  80534e:	90                   	nop
+err:
+	return r;
+  80534f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805352:	48 83 c4 30          	add    $0x30,%rsp
+  805356:	5b                   	pop    %rbx
+  805357:	41 5f                	pop    %r15
+  805359:	5d                   	pop    %rbp
+  80535a:	c3                   	ret
+
+000000000080535b <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80535b:	55                   	push   %rbp
+  80535c:	48 89 e5             	mov    %rsp,%rbp
+  80535f:	41 57                	push   %r15
+  805361:	41 54                	push   %r12
+  805363:	53                   	push   %rbx
+  805364:	48 83 ec 28          	sub    $0x28,%rsp
+  805368:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805368 <_pipeisclosed+0xd>
+  80536f:	49 bb d0 2c 00 00 00 	movabs $0x2cd0,%r11
+  805376:	00 00 00 
+  805379:	4c 01 db             	add    %r11,%rbx
+  80537c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805380:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805384:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80538b:	ff ff ff 
+  80538e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805392:	48 8b 00             	mov    (%rax),%rax
+  805395:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80539b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  80539e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8053a2:	48 89 c7             	mov    %rax,%rdi
+  8053a5:	49 89 df             	mov    %rbx,%r15
+  8053a8:	48 b8 d7 e3 ff ff ff 	movabs $0xffffffffffffe3d7,%rax
+  8053af:	ff ff ff 
+  8053b2:	48 01 d8             	add    %rbx,%rax
+  8053b5:	ff d0                	call   *%rax
+  8053b7:	41 89 c4             	mov    %eax,%r12d
+  8053ba:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8053be:	48 89 c7             	mov    %rax,%rdi
+  8053c1:	49 89 df             	mov    %rbx,%r15
+  8053c4:	48 b8 d7 e3 ff ff ff 	movabs $0xffffffffffffe3d7,%rax
+  8053cb:	ff ff ff 
+  8053ce:	48 01 d8             	add    %rbx,%rax
+  8053d1:	ff d0                	call   *%rax
+  8053d3:	41 39 c4             	cmp    %eax,%r12d
+  8053d6:	0f 94 c0             	sete   %al
+  8053d9:	0f b6 c0             	movzbl %al,%eax
+  8053dc:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  8053df:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8053e6:	ff ff ff 
+  8053e9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8053ed:	48 8b 00             	mov    (%rax),%rax
+  8053f0:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8053f6:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  8053f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8053fc:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8053ff:	75 05                	jne    805406 <_pipeisclosed+0xab>
+			return ret;
+  805401:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805404:	eb 63                	jmp    805469 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805406:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805409:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80540c:	0f 84 72 ff ff ff    	je     805384 <_pipeisclosed+0x29>
+  805412:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805416:	0f 85 68 ff ff ff    	jne    805384 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80541c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805423:	ff ff ff 
+  805426:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80542a:	48 8b 00             	mov    (%rax),%rax
+  80542d:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805433:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805436:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805439:	89 c6                	mov    %eax,%esi
+  80543b:	48 b8 7e ea ff ff ff 	movabs $0xffffffffffffea7e,%rax
+  805442:	ff ff ff 
+  805445:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805449:	48 89 c7             	mov    %rax,%rdi
+  80544c:	49 89 df             	mov    %rbx,%r15
+  80544f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805454:	49 b8 3d 87 ff ff ff 	movabs $0xffffffffffff873d,%r8
+  80545b:	ff ff ff 
+  80545e:	49 01 d8             	add    %rbx,%r8
+  805461:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805464:	e9 1b ff ff ff       	jmp    805384 <_pipeisclosed+0x29>
+	}
+}
+  805469:	48 83 c4 28          	add    $0x28,%rsp
+  80546d:	5b                   	pop    %rbx
+  80546e:	41 5c                	pop    %r12
+  805470:	41 5f                	pop    %r15
+  805472:	5d                   	pop    %rbp
+  805473:	c3                   	ret
+
+0000000000805474 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805474:	55                   	push   %rbp
+  805475:	48 89 e5             	mov    %rsp,%rbp
+  805478:	41 57                	push   %r15
+  80547a:	53                   	push   %rbx
+  80547b:	48 83 ec 30          	sub    $0x30,%rsp
+  80547f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80547f <pipeisclosed+0xb>
+  805486:	49 bb b9 2b 00 00 00 	movabs $0x2bb9,%r11
+  80548d:	00 00 00 
+  805490:	4c 01 db             	add    %r11,%rbx
+  805493:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805496:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80549a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80549d:	48 89 d6             	mov    %rdx,%rsi
+  8054a0:	89 c7                	mov    %eax,%edi
+  8054a2:	49 89 df             	mov    %rbx,%r15
+  8054a5:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  8054ac:	ff ff ff 
+  8054af:	48 01 d8             	add    %rbx,%rax
+  8054b2:	ff d0                	call   *%rax
+  8054b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054bb:	79 05                	jns    8054c2 <pipeisclosed+0x4e>
+		return r;
+  8054bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054c0:	eb 3b                	jmp    8054fd <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8054c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054c6:	48 89 c7             	mov    %rax,%rdi
+  8054c9:	49 89 df             	mov    %rbx,%r15
+  8054cc:	48 b8 9b a9 ff ff ff 	movabs $0xffffffffffffa99b,%rax
+  8054d3:	ff ff ff 
+  8054d6:	48 01 d8             	add    %rbx,%rax
+  8054d9:	ff d0                	call   *%rax
+  8054db:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  8054df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054e3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8054e7:	48 89 d6             	mov    %rdx,%rsi
+  8054ea:	48 89 c7             	mov    %rax,%rdi
+  8054ed:	48 b8 23 d3 ff ff ff 	movabs $0xffffffffffffd323,%rax
+  8054f4:	ff ff ff 
+  8054f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054fb:	ff d0                	call   *%rax
+}
+  8054fd:	48 83 c4 30          	add    $0x30,%rsp
+  805501:	5b                   	pop    %rbx
+  805502:	41 5f                	pop    %r15
+  805504:	5d                   	pop    %rbp
+  805505:	c3                   	ret
+
+0000000000805506 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805506:	55                   	push   %rbp
+  805507:	48 89 e5             	mov    %rsp,%rbp
+  80550a:	41 57                	push   %r15
+  80550c:	53                   	push   %rbx
+  80550d:	48 83 ec 40          	sub    $0x40,%rsp
+  805511:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805511 <devpipe_read+0xb>
+  805518:	49 bb 27 2b 00 00 00 	movabs $0x2b27,%r11
+  80551f:	00 00 00 
+  805522:	4c 01 db             	add    %r11,%rbx
+  805525:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805529:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80552d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805531:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805535:	48 89 c7             	mov    %rax,%rdi
+  805538:	49 89 df             	mov    %rbx,%r15
+  80553b:	48 b8 9b a9 ff ff ff 	movabs $0xffffffffffffa99b,%rax
+  805542:	ff ff ff 
+  805545:	48 01 d8             	add    %rbx,%rax
+  805548:	ff d0                	call   *%rax
+  80554a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80554e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805552:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805556:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80555d:	00 
+  80555e:	e9 a1 00 00 00       	jmp    805604 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805563:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805568:	74 09                	je     805573 <devpipe_read+0x6d>
+				return i;
+  80556a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80556e:	e9 9f 00 00 00       	jmp    805612 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805573:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805577:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80557b:	48 89 d6             	mov    %rdx,%rsi
+  80557e:	48 89 c7             	mov    %rax,%rdi
+  805581:	48 b8 23 d3 ff ff ff 	movabs $0xffffffffffffd323,%rax
+  805588:	ff ff ff 
+  80558b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80558f:	ff d0                	call   *%rax
+  805591:	85 c0                	test   %eax,%eax
+  805593:	74 07                	je     80559c <devpipe_read+0x96>
+				return 0;
+  805595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80559a:	eb 76                	jmp    805612 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  80559c:	49 89 df             	mov    %rbx,%r15
+  80559f:	48 b8 66 a1 ff ff ff 	movabs $0xffffffffffffa166,%rax
+  8055a6:	ff ff ff 
+  8055a9:	48 01 d8             	add    %rbx,%rax
+  8055ac:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8055ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055b2:	8b 10                	mov    (%rax),%edx
+  8055b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055b8:	8b 40 04             	mov    0x4(%rax),%eax
+  8055bb:	39 c2                	cmp    %eax,%edx
+  8055bd:	74 a4                	je     805563 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8055bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055c3:	8b 10                	mov    (%rax),%edx
+  8055c5:	89 d0                	mov    %edx,%eax
+  8055c7:	c1 f8 1f             	sar    $0x1f,%eax
+  8055ca:	c1 e8 1b             	shr    $0x1b,%eax
+  8055cd:	01 c2                	add    %eax,%edx
+  8055cf:	83 e2 1f             	and    $0x1f,%edx
+  8055d2:	29 c2                	sub    %eax,%edx
+  8055d4:	89 d6                	mov    %edx,%esi
+  8055d6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8055da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055de:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8055e2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8055e6:	48 63 c6             	movslq %esi,%rax
+  8055e9:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  8055ee:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  8055f0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055f4:	8b 00                	mov    (%rax),%eax
+  8055f6:	8d 50 01             	lea    0x1(%rax),%edx
+  8055f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055fd:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  8055ff:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805604:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805608:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80560c:	72 a0                	jb     8055ae <devpipe_read+0xa8>
+	}
+	return i;
+  80560e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805612:	48 83 c4 40          	add    $0x40,%rsp
+  805616:	5b                   	pop    %rbx
+  805617:	41 5f                	pop    %r15
+  805619:	5d                   	pop    %rbp
+  80561a:	c3                   	ret
+
+000000000080561b <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80561b:	55                   	push   %rbp
+  80561c:	48 89 e5             	mov    %rsp,%rbp
+  80561f:	41 57                	push   %r15
+  805621:	53                   	push   %rbx
+  805622:	48 83 ec 40          	sub    $0x40,%rsp
+  805626:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805626 <devpipe_write+0xb>
+  80562d:	49 bb 12 2a 00 00 00 	movabs $0x2a12,%r11
+  805634:	00 00 00 
+  805637:	4c 01 db             	add    %r11,%rbx
+  80563a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80563e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805642:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805646:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80564a:	48 89 c7             	mov    %rax,%rdi
+  80564d:	49 89 df             	mov    %rbx,%r15
+  805650:	48 b8 9b a9 ff ff ff 	movabs $0xffffffffffffa99b,%rax
+  805657:	ff ff ff 
+  80565a:	48 01 d8             	add    %rbx,%rax
+  80565d:	ff d0                	call   *%rax
+  80565f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805663:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805667:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80566b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805672:	00 
+  805673:	e9 a0 00 00 00       	jmp    805718 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805678:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80567c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805680:	48 89 d6             	mov    %rdx,%rsi
+  805683:	48 89 c7             	mov    %rax,%rdi
+  805686:	48 b8 23 d3 ff ff ff 	movabs $0xffffffffffffd323,%rax
+  80568d:	ff ff ff 
+  805690:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805694:	ff d0                	call   *%rax
+  805696:	85 c0                	test   %eax,%eax
+  805698:	74 0a                	je     8056a4 <devpipe_write+0x89>
+				return 0;
+  80569a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80569f:	e9 82 00 00 00       	jmp    805726 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8056a4:	49 89 df             	mov    %rbx,%r15
+  8056a7:	48 b8 66 a1 ff ff ff 	movabs $0xffffffffffffa166,%rax
+  8056ae:	ff ff ff 
+  8056b1:	48 01 d8             	add    %rbx,%rax
+  8056b4:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8056b6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056ba:	8b 40 04             	mov    0x4(%rax),%eax
+  8056bd:	48 63 d0             	movslq %eax,%rdx
+  8056c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056c4:	8b 00                	mov    (%rax),%eax
+  8056c6:	48 98                	cltq
+  8056c8:	48 83 c0 20          	add    $0x20,%rax
+  8056cc:	48 39 c2             	cmp    %rax,%rdx
+  8056cf:	73 a7                	jae    805678 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8056d1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8056d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056d9:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8056dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056e1:	8b 50 04             	mov    0x4(%rax),%edx
+  8056e4:	89 d0                	mov    %edx,%eax
+  8056e6:	c1 f8 1f             	sar    $0x1f,%eax
+  8056e9:	c1 e8 1b             	shr    $0x1b,%eax
+  8056ec:	01 c2                	add    %eax,%edx
+  8056ee:	83 e2 1f             	and    $0x1f,%edx
+  8056f1:	29 c2                	sub    %eax,%edx
+  8056f3:	89 d0                	mov    %edx,%eax
+  8056f5:	0f b6 09             	movzbl (%rcx),%ecx
+  8056f8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8056fc:	48 98                	cltq
+  8056fe:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805702:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805706:	8b 40 04             	mov    0x4(%rax),%eax
+  805709:	8d 50 01             	lea    0x1(%rax),%edx
+  80570c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805710:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805713:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805718:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80571c:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805720:	72 94                	jb     8056b6 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805722:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805726:	48 83 c4 40          	add    $0x40,%rsp
+  80572a:	5b                   	pop    %rbx
+  80572b:	41 5f                	pop    %r15
+  80572d:	5d                   	pop    %rbp
+  80572e:	c3                   	ret
+
+000000000080572f <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80572f:	55                   	push   %rbp
+  805730:	48 89 e5             	mov    %rsp,%rbp
+  805733:	41 57                	push   %r15
+  805735:	53                   	push   %rbx
+  805736:	48 83 ec 20          	sub    $0x20,%rsp
+  80573a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80573a <devpipe_stat+0xb>
+  805741:	49 bb fe 28 00 00 00 	movabs $0x28fe,%r11
+  805748:	00 00 00 
+  80574b:	4c 01 db             	add    %r11,%rbx
+  80574e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805752:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805756:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80575a:	48 89 c7             	mov    %rax,%rdi
+  80575d:	49 89 df             	mov    %rbx,%r15
+  805760:	48 b8 9b a9 ff ff ff 	movabs $0xffffffffffffa99b,%rax
+  805767:	ff ff ff 
+  80576a:	48 01 d8             	add    %rbx,%rax
+  80576d:	ff d0                	call   *%rax
+  80576f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805773:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805777:	48 ba 91 ea ff ff ff 	movabs $0xffffffffffffea91,%rdx
+  80577e:	ff ff ff 
+  805781:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805785:	48 89 d6             	mov    %rdx,%rsi
+  805788:	48 89 c7             	mov    %rax,%rdi
+  80578b:	49 89 df             	mov    %rbx,%r15
+  80578e:	48 b8 ff 94 ff ff ff 	movabs $0xffffffffffff94ff,%rax
+  805795:	ff ff ff 
+  805798:	48 01 d8             	add    %rbx,%rax
+  80579b:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80579d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057a1:	8b 50 04             	mov    0x4(%rax),%edx
+  8057a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057a8:	8b 00                	mov    (%rax),%eax
+  8057aa:	29 c2                	sub    %eax,%edx
+  8057ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057b0:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8057b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057ba:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8057c1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8057c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057c8:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  8057cf:	00 00 00 
+  8057d2:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8057d6:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8057dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057e2:	48 83 c4 20          	add    $0x20,%rsp
+  8057e6:	5b                   	pop    %rbx
+  8057e7:	41 5f                	pop    %r15
+  8057e9:	5d                   	pop    %rbp
+  8057ea:	c3                   	ret
+
+00000000008057eb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8057eb:	55                   	push   %rbp
+  8057ec:	48 89 e5             	mov    %rsp,%rbp
+  8057ef:	41 57                	push   %r15
+  8057f1:	53                   	push   %rbx
+  8057f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8057f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057f6 <devpipe_close+0xb>
+  8057fd:	49 bb 42 28 00 00 00 	movabs $0x2842,%r11
+  805804:	00 00 00 
+  805807:	4c 01 db             	add    %r11,%rbx
+  80580a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80580e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805812:	48 89 c6             	mov    %rax,%rsi
+  805815:	bf 00 00 00 00       	mov    $0x0,%edi
+  80581a:	49 89 df             	mov    %rbx,%r15
+  80581d:	48 b8 93 a2 ff ff ff 	movabs $0xffffffffffffa293,%rax
+  805824:	ff ff ff 
+  805827:	48 01 d8             	add    %rbx,%rax
+  80582a:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80582c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805830:	48 89 c7             	mov    %rax,%rdi
+  805833:	49 89 df             	mov    %rbx,%r15
+  805836:	48 b8 9b a9 ff ff ff 	movabs $0xffffffffffffa99b,%rax
+  80583d:	ff ff ff 
+  805840:	48 01 d8             	add    %rbx,%rax
+  805843:	ff d0                	call   *%rax
+  805845:	48 89 c6             	mov    %rax,%rsi
+  805848:	bf 00 00 00 00       	mov    $0x0,%edi
+  80584d:	49 89 df             	mov    %rbx,%r15
+  805850:	48 b8 93 a2 ff ff ff 	movabs $0xffffffffffffa293,%rax
+  805857:	ff ff ff 
+  80585a:	48 01 d8             	add    %rbx,%rax
+  80585d:	ff d0                	call   *%rax
+}
+  80585f:	48 83 c4 10          	add    $0x10,%rsp
+  805863:	5b                   	pop    %rbx
+  805864:	41 5f                	pop    %r15
+  805866:	5d                   	pop    %rbp
+  805867:	c3                   	ret
+
+0000000000805868 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  805868:	55                   	push   %rbp
+  805869:	48 89 e5             	mov    %rsp,%rbp
+  80586c:	41 57                	push   %r15
+  80586e:	48 83 ec 28          	sub    $0x28,%rsp
+  805872:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805872 <cputchar+0xa>
+  805879:	49 bb c6 27 00 00 00 	movabs $0x27c6,%r11
+  805880:	00 00 00 
+  805883:	4c 01 d8             	add    %r11,%rax
+  805886:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  805889:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80588c:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  80588f:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  805893:	be 01 00 00 00       	mov    $0x1,%esi
+  805898:	48 89 d7             	mov    %rdx,%rdi
+  80589b:	49 89 c7             	mov    %rax,%r15
+  80589e:	48 ba 03 a0 ff ff ff 	movabs $0xffffffffffffa003,%rdx
+  8058a5:	ff ff ff 
+  8058a8:	48 01 c2             	add    %rax,%rdx
+  8058ab:	ff d2                	call   *%rdx
+}
+  8058ad:	90                   	nop
+  8058ae:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8058b2:	c9                   	leave
+  8058b3:	c3                   	ret
+
+00000000008058b4 <getchar>:
+
+int
+getchar(void)
+{
+  8058b4:	55                   	push   %rbp
+  8058b5:	48 89 e5             	mov    %rsp,%rbp
+  8058b8:	41 57                	push   %r15
+  8058ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8058be:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8058be <getchar+0xa>
+  8058c5:	49 bb 7a 27 00 00 00 	movabs $0x277a,%r11
+  8058cc:	00 00 00 
+  8058cf:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8058d2:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8058d6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8058db:	48 89 ce             	mov    %rcx,%rsi
+  8058de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058e3:	49 89 c7             	mov    %rax,%r15
+  8058e6:	48 b9 db af ff ff ff 	movabs $0xffffffffffffafdb,%rcx
+  8058ed:	ff ff ff 
+  8058f0:	48 01 c1             	add    %rax,%rcx
+  8058f3:	ff d1                	call   *%rcx
+  8058f5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8058f8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058fc:	79 05                	jns    805903 <getchar+0x4f>
+		return r;
+  8058fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805901:	eb 14                	jmp    805917 <getchar+0x63>
+	if (r < 1)
+  805903:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805907:	7f 07                	jg     805910 <getchar+0x5c>
+		return -E_EOF;
+  805909:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80590e:	eb 07                	jmp    805917 <getchar+0x63>
+	return c;
+  805910:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805914:	0f b6 c0             	movzbl %al,%eax
+}
+  805917:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80591b:	c9                   	leave
+  80591c:	c3                   	ret
+
+000000000080591d <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80591d:	55                   	push   %rbp
+  80591e:	48 89 e5             	mov    %rsp,%rbp
+  805921:	41 57                	push   %r15
+  805923:	53                   	push   %rbx
+  805924:	48 83 ec 20          	sub    $0x20,%rsp
+  805928:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805928 <iscons+0xb>
+  80592f:	49 bb 10 27 00 00 00 	movabs $0x2710,%r11
+  805936:	00 00 00 
+  805939:	4c 01 db             	add    %r11,%rbx
+  80593c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80593f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805943:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805946:	48 89 d6             	mov    %rdx,%rsi
+  805949:	89 c7                	mov    %eax,%edi
+  80594b:	49 89 df             	mov    %rbx,%r15
+  80594e:	48 b8 94 aa ff ff ff 	movabs $0xffffffffffffaa94,%rax
+  805955:	ff ff ff 
+  805958:	48 01 d8             	add    %rbx,%rax
+  80595b:	ff d0                	call   *%rax
+  80595d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805960:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805964:	79 05                	jns    80596b <iscons+0x4e>
+		return r;
+  805966:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805969:	eb 1b                	jmp    805986 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80596b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80596f:	8b 10                	mov    (%rax),%edx
+  805971:	48 b8 08 01 00 00 00 	movabs $0x108,%rax
+  805978:	00 00 00 
+  80597b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80597e:	39 c2                	cmp    %eax,%edx
+  805980:	0f 94 c0             	sete   %al
+  805983:	0f b6 c0             	movzbl %al,%eax
+}
+  805986:	48 83 c4 20          	add    $0x20,%rsp
+  80598a:	5b                   	pop    %rbx
+  80598b:	41 5f                	pop    %r15
+  80598d:	5d                   	pop    %rbp
+  80598e:	c3                   	ret
+
+000000000080598f <opencons>:
+
+int
+opencons(void)
+{
+  80598f:	55                   	push   %rbp
+  805990:	48 89 e5             	mov    %rsp,%rbp
+  805993:	41 57                	push   %r15
+  805995:	53                   	push   %rbx
+  805996:	48 83 ec 10          	sub    $0x10,%rsp
+  80599a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80599a <opencons+0xb>
+  8059a1:	49 bb 9e 26 00 00 00 	movabs $0x269e,%r11
+  8059a8:	00 00 00 
+  8059ab:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8059ae:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8059b2:	48 89 c7             	mov    %rax,%rdi
+  8059b5:	49 89 df             	mov    %rbx,%r15
+  8059b8:	48 b8 de a9 ff ff ff 	movabs $0xffffffffffffa9de,%rax
+  8059bf:	ff ff ff 
+  8059c2:	48 01 d8             	add    %rbx,%rax
+  8059c5:	ff d0                	call   *%rax
+  8059c7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059ce:	79 05                	jns    8059d5 <opencons+0x46>
+		return r;
+  8059d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059d3:	eb 68                	jmp    805a3d <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8059d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059d9:	ba 07 04 00 00       	mov    $0x407,%edx
+  8059de:	48 89 c6             	mov    %rax,%rsi
+  8059e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059e6:	49 89 df             	mov    %rbx,%r15
+  8059e9:	48 b8 bb a1 ff ff ff 	movabs $0xffffffffffffa1bb,%rax
+  8059f0:	ff ff ff 
+  8059f3:	48 01 d8             	add    %rbx,%rax
+  8059f6:	ff d0                	call   *%rax
+  8059f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059ff:	79 05                	jns    805a06 <opencons+0x77>
+		return r;
+  805a01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a04:	eb 37                	jmp    805a3d <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805a06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a0a:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  805a11:	00 00 00 
+  805a14:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805a17:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  805a19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a1d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805a24:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a28:	48 89 c7             	mov    %rax,%rdi
+  805a2b:	49 89 df             	mov    %rbx,%r15
+  805a2e:	48 b8 64 a9 ff ff ff 	movabs $0xffffffffffffa964,%rax
+  805a35:	ff ff ff 
+  805a38:	48 01 d8             	add    %rbx,%rax
+  805a3b:	ff d0                	call   *%rax
+}
+  805a3d:	48 83 c4 10          	add    $0x10,%rsp
+  805a41:	5b                   	pop    %rbx
+  805a42:	41 5f                	pop    %r15
+  805a44:	5d                   	pop    %rbp
+  805a45:	c3                   	ret
+
+0000000000805a46 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805a46:	55                   	push   %rbp
+  805a47:	48 89 e5             	mov    %rsp,%rbp
+  805a4a:	41 57                	push   %r15
+  805a4c:	53                   	push   %rbx
+  805a4d:	48 83 ec 30          	sub    $0x30,%rsp
+  805a51:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a51 <devcons_read+0xb>
+  805a58:	49 bb e7 25 00 00 00 	movabs $0x25e7,%r11
+  805a5f:	00 00 00 
+  805a62:	4c 01 db             	add    %r11,%rbx
+  805a65:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805a69:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805a6d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  805a71:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805a76:	75 19                	jne    805a91 <devcons_read+0x4b>
+		return 0;
+  805a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a7d:	eb 55                	jmp    805ad4 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  805a7f:	49 89 df             	mov    %rbx,%r15
+  805a82:	48 b8 66 a1 ff ff ff 	movabs $0xffffffffffffa166,%rax
+  805a89:	ff ff ff 
+  805a8c:	48 01 d8             	add    %rbx,%rax
+  805a8f:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  805a91:	49 89 df             	mov    %rbx,%r15
+  805a94:	48 b8 62 a0 ff ff ff 	movabs $0xffffffffffffa062,%rax
+  805a9b:	ff ff ff 
+  805a9e:	48 01 d8             	add    %rbx,%rax
+  805aa1:	ff d0                	call   *%rax
+  805aa3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805aa6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805aaa:	74 d3                	je     805a7f <devcons_read+0x39>
+	if (c < 0)
+  805aac:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ab0:	79 05                	jns    805ab7 <devcons_read+0x71>
+		return c;
+  805ab2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ab5:	eb 1d                	jmp    805ad4 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  805ab7:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  805abb:	75 07                	jne    805ac4 <devcons_read+0x7e>
+		return 0;
+  805abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ac2:	eb 10                	jmp    805ad4 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805ac4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ac7:	89 c2                	mov    %eax,%edx
+  805ac9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805acd:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805acf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805ad4:	48 83 c4 30          	add    $0x30,%rsp
+  805ad8:	5b                   	pop    %rbx
+  805ad9:	41 5f                	pop    %r15
+  805adb:	5d                   	pop    %rbp
+  805adc:	c3                   	ret
+
+0000000000805add <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805add:	55                   	push   %rbp
+  805ade:	48 89 e5             	mov    %rsp,%rbp
+  805ae1:	41 57                	push   %r15
+  805ae3:	53                   	push   %rbx
+  805ae4:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805aeb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805aeb <devcons_write+0xe>
+  805af2:	49 bb 4d 25 00 00 00 	movabs $0x254d,%r11
+  805af9:	00 00 00 
+  805afc:	4c 01 db             	add    %r11,%rbx
+  805aff:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  805b06:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  805b0d:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805b14:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805b1b:	e9 80 00 00 00       	jmp    805ba0 <devcons_write+0xc3>
+		m = n - tot;
+  805b20:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805b27:	89 c2                	mov    %eax,%edx
+  805b29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b2c:	29 c2                	sub    %eax,%edx
+  805b2e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  805b31:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805b34:	83 f8 7f             	cmp    $0x7f,%eax
+  805b37:	76 07                	jbe    805b40 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  805b39:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  805b40:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805b43:	48 63 d0             	movslq %eax,%rdx
+  805b46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b49:	48 63 c8             	movslq %eax,%rcx
+  805b4c:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  805b53:	48 01 c1             	add    %rax,%rcx
+  805b56:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805b5d:	48 89 ce             	mov    %rcx,%rsi
+  805b60:	48 89 c7             	mov    %rax,%rdi
+  805b63:	49 89 df             	mov    %rbx,%r15
+  805b66:	48 b8 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rax
+  805b6d:	ff ff ff 
+  805b70:	48 01 d8             	add    %rbx,%rax
+  805b73:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  805b75:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805b78:	48 63 d0             	movslq %eax,%rdx
+  805b7b:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805b82:	48 89 d6             	mov    %rdx,%rsi
+  805b85:	48 89 c7             	mov    %rax,%rdi
+  805b88:	49 89 df             	mov    %rbx,%r15
+  805b8b:	48 b8 03 a0 ff ff ff 	movabs $0xffffffffffffa003,%rax
+  805b92:	ff ff ff 
+  805b95:	48 01 d8             	add    %rbx,%rax
+  805b98:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  805b9a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805b9d:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805ba0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ba3:	48 98                	cltq
+  805ba5:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  805bac:	0f 82 6e ff ff ff    	jb     805b20 <devcons_write+0x43>
+	}
+	return tot;
+  805bb2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805bb5:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  805bbc:	5b                   	pop    %rbx
+  805bbd:	41 5f                	pop    %r15
+  805bbf:	5d                   	pop    %rbp
+  805bc0:	c3                   	ret
+
+0000000000805bc1 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  805bc1:	55                   	push   %rbp
+  805bc2:	48 89 e5             	mov    %rsp,%rbp
+  805bc5:	48 83 ec 08          	sub    $0x8,%rsp
+  805bc9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805bc9 <devcons_close+0x8>
+  805bd0:	49 bb 6f 24 00 00 00 	movabs $0x246f,%r11
+  805bd7:	00 00 00 
+  805bda:	4c 01 d8             	add    %r11,%rax
+  805bdd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  805be1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805be6:	c9                   	leave
+  805be7:	c3                   	ret
+
+0000000000805be8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805be8:	55                   	push   %rbp
+  805be9:	48 89 e5             	mov    %rsp,%rbp
+  805bec:	41 57                	push   %r15
+  805bee:	48 83 ec 18          	sub    $0x18,%rsp
+  805bf2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805bf2 <devcons_stat+0xa>
+  805bf9:	49 bb 46 24 00 00 00 	movabs $0x2446,%r11
+  805c00:	00 00 00 
+  805c03:	4c 01 d8             	add    %r11,%rax
+  805c06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805c0a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  805c0e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c12:	48 b9 9d ea ff ff ff 	movabs $0xffffffffffffea9d,%rcx
+  805c19:	ff ff ff 
+  805c1c:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805c20:	48 89 ce             	mov    %rcx,%rsi
+  805c23:	48 89 d7             	mov    %rdx,%rdi
+  805c26:	49 89 c7             	mov    %rax,%r15
+  805c29:	48 ba ff 94 ff ff ff 	movabs $0xffffffffffff94ff,%rdx
+  805c30:	ff ff ff 
+  805c33:	48 01 c2             	add    %rax,%rdx
+  805c36:	ff d2                	call   *%rdx
+	return 0;
+  805c38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c3d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805c41:	c9                   	leave
+  805c42:	c3                   	ret
+
+0000000000805c43 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805c43:	55                   	push   %rbp
+  805c44:	48 89 e5             	mov    %rsp,%rbp
+  805c47:	41 57                	push   %r15
+  805c49:	53                   	push   %rbx
+  805c4a:	48 83 ec 30          	sub    $0x30,%rsp
+  805c4e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c4e <ipc_recv+0xb>
+  805c55:	49 bb ea 23 00 00 00 	movabs $0x23ea,%r11
+  805c5c:	00 00 00 
+  805c5f:	4c 01 db             	add    %r11,%rbx
+  805c62:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805c66:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805c6a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  805c6e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805c73:	75 0e                	jne    805c83 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805c75:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805c7c:	00 00 00 
+  805c7f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  805c83:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c87:	48 89 c7             	mov    %rax,%rdi
+  805c8a:	49 89 df             	mov    %rbx,%r15
+  805c8d:	48 b8 e4 a4 ff ff ff 	movabs $0xffffffffffffa4e4,%rax
+  805c94:	ff ff ff 
+  805c97:	48 01 d8             	add    %rbx,%rax
+  805c9a:	ff d0                	call   *%rax
+  805c9c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  805c9f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805ca4:	74 2a                	je     805cd0 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  805ca6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805caa:	75 19                	jne    805cc5 <ipc_recv+0x82>
+  805cac:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805cb3:	ff ff ff 
+  805cb6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805cba:	48 8b 00             	mov    (%rax),%rax
+  805cbd:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805cc3:	eb 05                	jmp    805cca <ipc_recv+0x87>
+  805cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805cce:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  805cd0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805cd5:	74 2a                	je     805d01 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  805cd7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805cdb:	75 19                	jne    805cf6 <ipc_recv+0xb3>
+  805cdd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805ce4:	ff ff ff 
+  805ce7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805ceb:	48 8b 00             	mov    (%rax),%rax
+  805cee:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805cf4:	eb 05                	jmp    805cfb <ipc_recv+0xb8>
+  805cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cfb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805cff:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  805d01:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d05:	74 05                	je     805d0c <ipc_recv+0xc9>
+		return res;
+  805d07:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d0a:	eb 17                	jmp    805d23 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805d0c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d13:	ff ff ff 
+  805d16:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d1a:	48 8b 00             	mov    (%rax),%rax
+  805d1d:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805d23:	48 83 c4 30          	add    $0x30,%rsp
+  805d27:	5b                   	pop    %rbx
+  805d28:	41 5f                	pop    %r15
+  805d2a:	5d                   	pop    %rbp
+  805d2b:	c3                   	ret
+
+0000000000805d2c <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805d2c:	55                   	push   %rbp
+  805d2d:	48 89 e5             	mov    %rsp,%rbp
+  805d30:	41 57                	push   %r15
+  805d32:	53                   	push   %rbx
+  805d33:	48 83 ec 20          	sub    $0x20,%rsp
+  805d37:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d37 <ipc_send+0xb>
+  805d3e:	49 bb 01 23 00 00 00 	movabs $0x2301,%r11
+  805d45:	00 00 00 
+  805d48:	4c 01 db             	add    %r11,%rbx
+  805d4b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805d4e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805d51:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805d55:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805d58:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805d5d:	75 0e                	jne    805d6d <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  805d5f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805d66:	00 00 00 
+  805d69:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  805d6d:	90                   	nop
+  805d6e:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805d71:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805d74:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d7b:	89 c7                	mov    %eax,%edi
+  805d7d:	49 89 df             	mov    %rbx,%r15
+  805d80:	48 b8 7a a4 ff ff ff 	movabs $0xffffffffffffa47a,%rax
+  805d87:	ff ff ff 
+  805d8a:	48 01 d8             	add    %rbx,%rax
+  805d8d:	ff d0                	call   *%rax
+  805d8f:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  805d92:	74 da                	je     805d6e <ipc_send+0x42>
+		;
+}
+  805d94:	90                   	nop
+  805d95:	90                   	nop
+  805d96:	48 83 c4 20          	add    $0x20,%rsp
+  805d9a:	5b                   	pop    %rbx
+  805d9b:	41 5f                	pop    %r15
+  805d9d:	5d                   	pop    %rbp
+  805d9e:	c3                   	ret
+
+0000000000805d9f <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  805d9f:	55                   	push   %rbp
+  805da0:	48 89 e5             	mov    %rsp,%rbp
+  805da3:	41 57                	push   %r15
+  805da5:	53                   	push   %rbx
+  805da6:	48 83 ec 40          	sub    $0x40,%rsp
+  805daa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805daa <ipc_call+0xb>
+  805db1:	49 bb 8e 22 00 00 00 	movabs $0x228e,%r11
+  805db8:	00 00 00 
+  805dbb:	4c 01 db             	add    %r11,%rbx
+  805dbe:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805dc1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805dc4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805dc8:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805dcb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805dcf:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805dd3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805dd8:	75 0e                	jne    805de8 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  805dda:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805de1:	00 00 00 
+  805de4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805de8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805ded:	75 0e                	jne    805dfd <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805def:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805df6:	00 00 00 
+  805df9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  805dfd:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805e00:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805e04:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805e07:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805e0b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e0e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805e14:	49 89 f8             	mov    %rdi,%r8
+  805e17:	89 c7                	mov    %eax,%edi
+  805e19:	49 89 df             	mov    %rbx,%r15
+  805e1c:	48 b8 3d a5 ff ff ff 	movabs $0xffffffffffffa53d,%rax
+  805e23:	ff ff ff 
+  805e26:	48 01 d8             	add    %rbx,%rax
+  805e29:	ff d0                	call   *%rax
+  805e2b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805e2e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805e33:	74 2a                	je     805e5f <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805e35:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e39:	75 19                	jne    805e54 <ipc_call+0xb5>
+  805e3b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e42:	ff ff ff 
+  805e45:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e49:	48 8b 00             	mov    (%rax),%rax
+  805e4c:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805e52:	eb 05                	jmp    805e59 <ipc_call+0xba>
+  805e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e59:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805e5d:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805e5f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e63:	74 05                	je     805e6a <ipc_call+0xcb>
+		return r;
+  805e65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e68:	eb 17                	jmp    805e81 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805e6a:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805e71:	ff ff ff 
+  805e74:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e78:	48 8b 00             	mov    (%rax),%rax
+  805e7b:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805e81:	48 83 c4 40          	add    $0x40,%rsp
+  805e85:	5b                   	pop    %rbx
+  805e86:	41 5f                	pop    %r15
+  805e88:	5d                   	pop    %rbp
+  805e89:	c3                   	ret
+
+0000000000805e8a <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805e8a:	55                   	push   %rbp
+  805e8b:	48 89 e5             	mov    %rsp,%rbp
+  805e8e:	41 57                	push   %r15
+  805e90:	53                   	push   %rbx
+  805e91:	48 83 ec 70          	sub    $0x70,%rsp
+  805e95:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e95 <ipc_callw+0xb>
+  805e9c:	49 bb a3 21 00 00 00 	movabs $0x21a3,%r11
+  805ea3:	00 00 00 
+  805ea6:	4c 01 db             	add    %r11,%rbx
+  805ea9:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805eac:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805eaf:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805eb3:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805eb7:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805ebc:	76 0a                	jbe    805ec8 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805ebe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805ec3:	e9 b7 00 00 00       	jmp    805f7f <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805ec8:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805ecc:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805ed0:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805ed4:	48 89 ce             	mov    %rcx,%rsi
+  805ed7:	48 89 c7             	mov    %rax,%rdi
+  805eda:	49 89 df             	mov    %rbx,%r15
+  805edd:	48 b8 df 98 ff ff ff 	movabs $0xffffffffffff98df,%rax
+  805ee4:	ff ff ff 
+  805ee7:	48 01 d8             	add    %rbx,%rax
+  805eea:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805eec:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805ef3:	00 
+  805ef4:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805ef8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805efc:	48 01 d0             	add    %rdx,%rax
+  805eff:	48 83 e8 01          	sub    $0x1,%rax
+  805f03:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805f07:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f10:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805f14:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f18:	48 29 d0             	sub    %rdx,%rax
+  805f1b:	48 c1 e8 03          	shr    $0x3,%rax
+  805f1f:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805f23:	89 c1                	mov    %eax,%ecx
+  805f25:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805f28:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805f2c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805f2f:	49 89 d1             	mov    %rdx,%r9
+  805f32:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805f39:	00 00 00 
+  805f3c:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805f43:	00 00 00 
+  805f46:	89 c7                	mov    %eax,%edi
+  805f48:	49 89 df             	mov    %rbx,%r15
+  805f4b:	48 b8 3d a5 ff ff ff 	movabs $0xffffffffffffa53d,%rax
+  805f52:	ff ff ff 
+  805f55:	48 01 d8             	add    %rbx,%rax
+  805f58:	ff d0                	call   *%rax
+  805f5a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805f5d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805f61:	74 05                	je     805f68 <ipc_callw+0xde>
+		return r;
+  805f63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f66:	eb 17                	jmp    805f7f <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805f68:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805f6f:	ff ff ff 
+  805f72:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f76:	48 8b 00             	mov    (%rax),%rax
+  805f79:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805f7f:	48 83 c4 70          	add    $0x70,%rsp
+  805f83:	5b                   	pop    %rbx
+  805f84:	41 5f                	pop    %r15
+  805f86:	5d                   	pop    %rbp
+  805f87:	c3                   	ret
+
+0000000000805f88 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805f88:	55                   	push   %rbp
+  805f89:	48 89 e5             	mov    %rsp,%rbp
+  805f8c:	41 57                	push   %r15
+  805f8e:	53                   	push   %rbx
+  805f8f:	48 83 ec 40          	sub    $0x40,%rsp
+  805f93:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f93 <ipc_callv+0xb>
+  805f9a:	49 bb a5 20 00 00 00 	movabs $0x20a5,%r11
+  805fa1:	00 00 00 
+  805fa4:	4c 01 db             	add    %r11,%rbx
+  805fa7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805faa:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805fad:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805fb1:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805fb4:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805fb8:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805fbc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805fc3:	00 00 00 
+  805fc6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805fca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805fce:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805fd2:	74 11                	je     805fe5 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805fd4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805fd8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805fdc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805fdf:	c1 e0 14             	shl    $0x14,%eax
+  805fe2:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805fe5:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805fe9:	74 14                	je     805fff <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805feb:	8b 45 20             	mov    0x20(%rbp),%eax
+  805fee:	83 e8 01             	sub    $0x1,%eax
+  805ff1:	48 63 d0             	movslq %eax,%rdx
+  805ff4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805ff8:	48 09 d0             	or     %rdx,%rax
+  805ffb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805fff:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806002:	c1 e0 10             	shl    $0x10,%eax
+  806005:	0b 45 10             	or     0x10(%rbp),%eax
+  806008:	89 c1                	mov    %eax,%ecx
+  80600a:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80600d:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806011:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806015:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806019:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80601c:	4d 89 c1             	mov    %r8,%r9
+  80601f:	49 89 f8             	mov    %rdi,%r8
+  806022:	89 c7                	mov    %eax,%edi
+  806024:	49 89 df             	mov    %rbx,%r15
+  806027:	48 b8 3d a5 ff ff ff 	movabs $0xffffffffffffa53d,%rax
+  80602e:	ff ff ff 
+  806031:	48 01 d8             	add    %rbx,%rax
+  806034:	ff d0                	call   *%rax
+  806036:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806039:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80603d:	74 05                	je     806044 <ipc_callv+0xbc>
+		return r;
+  80603f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806042:	eb 17                	jmp    80605b <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806044:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80604b:	ff ff ff 
+  80604e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806052:	48 8b 00             	mov    (%rax),%rax
+  806055:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80605b:	48 83 c4 40          	add    $0x40,%rsp
+  80605f:	5b                   	pop    %rbx
+  806060:	41 5f                	pop    %r15
+  806062:	5d                   	pop    %rbp
+  806063:	c3                   	ret
+
+0000000000806064 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806064:	55                   	push   %rbp
+  806065:	48 89 e5             	mov    %rsp,%rbp
+  806068:	41 57                	push   %r15
+  80606a:	53                   	push   %rbx
+  80606b:	48 83 ec 40          	sub    $0x40,%rsp
+  80606f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80606f <ipc_reply_recv+0xb>
+  806076:	49 bb c9 1f 00 00 00 	movabs $0x1fc9,%r11
+  80607d:	00 00 00 
+  806080:	4c 01 db             	add    %r11,%rbx
+  806083:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806086:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806089:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80608d:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806090:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806094:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806098:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80609d:	75 0e                	jne    8060ad <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  80609f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8060a6:	00 00 00 
+  8060a9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8060ad:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8060b2:	75 0e                	jne    8060c2 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8060b4:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8060bb:	00 00 00 
+  8060be:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  8060c2:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8060c5:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  8060c9:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8060cd:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8060d0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8060d4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8060d7:	4d 89 c1             	mov    %r8,%r9
+  8060da:	49 89 f8             	mov    %rdi,%r8
+  8060dd:	89 c7                	mov    %eax,%edi
+  8060df:	49 89 df             	mov    %rbx,%r15
+  8060e2:	48 b8 b1 a5 ff ff ff 	movabs $0xffffffffffffa5b1,%rax
+  8060e9:	ff ff ff 
+  8060ec:	48 01 d8             	add    %rbx,%rax
+  8060ef:	ff d0                	call   *%rax
+  8060f1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  8060f4:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8060f9:	74 2a                	je     806125 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8060fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060ff:	75 19                	jne    80611a <ipc_reply_recv+0xb6>
+  806101:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806108:	ff ff ff 
+  80610b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80610f:	48 8b 00             	mov    (%rax),%rax
+  806112:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806118:	eb 05                	jmp    80611f <ipc_reply_recv+0xbb>
+  80611a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80611f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806123:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806125:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  80612a:	74 2a                	je     806156 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80612c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806130:	75 19                	jne    80614b <ipc_reply_recv+0xe7>
+  806132:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806139:	ff ff ff 
+  80613c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806140:	48 8b 00             	mov    (%rax),%rax
+  806143:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806149:	eb 05                	jmp    806150 <ipc_reply_recv+0xec>
+  80614b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806150:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806154:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806156:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80615a:	74 05                	je     806161 <ipc_reply_recv+0xfd>
+		return r;
+  80615c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80615f:	eb 17                	jmp    806178 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806161:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  806168:	ff ff ff 
+  80616b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80616f:	48 8b 00             	mov    (%rax),%rax
+  806172:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806178:	48 83 c4 40          	add    $0x40,%rsp
+  80617c:	5b                   	pop    %rbx
+  80617d:	41 5f                	pop    %r15
+  80617f:	5d                   	pop    %rbp
+  806180:	c3                   	ret
+
+0000000000806181 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806181:	55                   	push   %rbp
+  806182:	48 89 e5             	mov    %rsp,%rbp
+  806185:	41 57                	push   %r15
+  806187:	53                   	push   %rbx
+  806188:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  80618f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80618f <ipc_window_batch+0xe>
+  806196:	49 bb a9 1e 00 00 00 	movabs $0x1ea9,%r11
+  80619d:	00 00 00 
+  8061a0:	4c 01 db             	add    %r11,%rbx
+  8061a3:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  8061a9:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  8061b0:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  8061b6:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  8061bc:	e9 15 01 00 00       	jmp    8062d6 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  8061c1:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  8061c7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8061ca:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  8061d1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8061d4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8061d7:	39 c2                	cmp    %eax,%edx
+  8061d9:	0f 4e c2             	cmovle %edx,%eax
+  8061dc:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  8061df:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8061e6:	eb 6b                	jmp    806253 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  8061e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061eb:	48 98                	cltq
+  8061ed:	48 c1 e0 05          	shl    $0x5,%rax
+  8061f1:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8061f5:	48 01 e8             	add    %rbp,%rax
+  8061f8:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  8061fe:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806204:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806207:	c1 e0 0c             	shl    $0xc,%eax
+  80620a:	48 63 d0             	movslq %eax,%rdx
+  80620d:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806214:	48 01 c2             	add    %rax,%rdx
+  806217:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80621a:	48 98                	cltq
+  80621c:	48 c1 e0 05          	shl    $0x5,%rax
+  806220:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806224:	48 01 e8             	add    %rbp,%rax
+  806227:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  80622d:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806230:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806233:	48 98                	cltq
+  806235:	48 c1 e0 05          	shl    $0x5,%rax
+  806239:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80623d:	48 01 e8             	add    %rbp,%rax
+  806240:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806247:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  80624d:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  80624f:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806253:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806256:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806259:	7c 8d                	jl     8061e8 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  80625b:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806262:	74 27                	je     80628b <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806264:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806267:	48 63 d0             	movslq %eax,%rdx
+  80626a:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806271:	48 89 d6             	mov    %rdx,%rsi
+  806274:	48 89 c7             	mov    %rax,%rdi
+  806277:	49 89 df             	mov    %rbx,%r15
+  80627a:	48 b8 54 a8 ff ff ff 	movabs $0xffffffffffffa854,%rax
+  806281:	ff ff ff 
+  806284:	48 01 d8             	add    %rbx,%rax
+  806287:	ff d0                	call   *%rax
+  806289:	eb 25                	jmp    8062b0 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  80628b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80628e:	48 63 d0             	movslq %eax,%rdx
+  806291:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806298:	48 89 d6             	mov    %rdx,%rsi
+  80629b:	48 89 c7             	mov    %rax,%rdi
+  80629e:	49 89 df             	mov    %rbx,%r15
+  8062a1:	48 b8 b2 a8 ff ff ff 	movabs $0xffffffffffffa8b2,%rax
+  8062a8:	ff ff ff 
+  8062ab:	48 01 d8             	add    %rbx,%rax
+  8062ae:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8062b0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  8062b3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8062b7:	79 05                	jns    8062be <ipc_window_batch+0x13d>
+			return r;
+  8062b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8062bc:	eb 2a                	jmp    8062e8 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  8062be:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8062c1:	c1 e0 0c             	shl    $0xc,%eax
+  8062c4:	48 98                	cltq
+  8062c6:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  8062cd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8062d0:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  8062d6:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  8062dd:	0f 8f de fe ff ff    	jg     8061c1 <ipc_window_batch+0x40>
+	}
+	return 0;
+  8062e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8062e8:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  8062ef:	5b                   	pop    %rbx
+  8062f0:	41 5f                	pop    %r15
+  8062f2:	5d                   	pop    %rbp
+  8062f3:	c3                   	ret
+
+00000000008062f4 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  8062f4:	55                   	push   %rbp
+  8062f5:	48 89 e5             	mov    %rsp,%rbp
+  8062f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8062fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8062fc <ipc_map_window+0x8>
+  806303:	49 bb 3c 1d 00 00 00 	movabs $0x1d3c,%r11
+  80630a:	00 00 00 
+  80630d:	4c 01 d8             	add    %r11,%rax
+  806310:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806314:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806317:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80631a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80631e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806323:	bf 01 00 00 00       	mov    $0x1,%edi
+  806328:	49 b8 49 e1 ff ff ff 	movabs $0xffffffffffffe149,%r8
+  80632f:	ff ff ff 
+  806332:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806336:	ff d0                	call   *%rax
+}
+  806338:	c9                   	leave
+  806339:	c3                   	ret
+
+000000000080633a <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  80633a:	55                   	push   %rbp
+  80633b:	48 89 e5             	mov    %rsp,%rbp
+  80633e:	48 83 ec 10          	sub    $0x10,%rsp
+  806342:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806342 <ipc_unmap_window+0x8>
+  806349:	49 bb f6 1c 00 00 00 	movabs $0x1cf6,%r11
+  806350:	00 00 00 
+  806353:	4c 01 d8             	add    %r11,%rax
+  806356:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80635a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  80635d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806360:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806364:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806369:	bf 00 00 00 00       	mov    $0x0,%edi
+  80636e:	49 b8 49 e1 ff ff ff 	movabs $0xffffffffffffe149,%r8
+  806375:	ff ff ff 
+  806378:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80637c:	ff d0                	call   *%rax
+}
+  80637e:	c9                   	leave
+  80637f:	c3                   	ret
+
+0000000000806380 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806380:	55                   	push   %rbp
+  806381:	48 89 e5             	mov    %rsp,%rbp
+  806384:	48 83 ec 18          	sub    $0x18,%rsp
+  806388:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806388 <ipc_find_env+0x8>
+  80638f:	49 bb b0 1c 00 00 00 	movabs $0x1cb0,%r11
+  806396:	00 00 00 
+  806399:	4c 01 d8             	add    %r11,%rax
+  80639c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  80639f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8063a6:	eb 57                	jmp    8063ff <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  8063a8:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8063af:	ff ff ff 
+  8063b2:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  8063b6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8063b9:	48 63 d2             	movslq %edx,%rdx
+  8063bc:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  8063c3:	48 01 ca             	add    %rcx,%rdx
+  8063c6:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  8063cd:	8b 12                	mov    (%rdx),%edx
+  8063cf:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  8063d2:	75 27                	jne    8063fb <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  8063d4:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  8063db:	ff ff ff 
+  8063de:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8063e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8063e5:	48 98                	cltq
+  8063e7:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8063ee:	48 01 d0             	add    %rdx,%rax
+  8063f1:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8063f7:	8b 00                	mov    (%rax),%eax
+  8063f9:	eb 12                	jmp    80640d <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  8063fb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8063ff:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806406:	7e a0                	jle    8063a8 <ipc_find_env+0x28>
+	}
+	return 0;
+  806408:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80640d:	c9                   	leave
+  80640e:	c3                   	ret
+
+000000000080640f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80640f:	55                   	push   %rbp
+  806410:	48 89 e5             	mov    %rsp,%rbp
+  806413:	48 83 ec 18          	sub    $0x18,%rsp
+  806417:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806417 <pageref+0x8>
+  80641e:	49 bb 21 1c 00 00 00 	movabs $0x1c21,%r11
+  806425:	00 00 00 
+  806428:	4c 01 d8             	add    %r11,%rax
+  80642b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80642f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806433:	48 89 d1             	mov    %rdx,%rcx
+  806436:	48 c1 e9 15          	shr    $0x15,%rcx
+  80643a:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806441:	ff ff ff 
+  806444:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806448:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80644c:	83 e2 01             	and    $0x1,%edx
+  80644f:	48 85 d2             	test   %rdx,%rdx
+  806452:	75 07                	jne    80645b <pageref+0x4c>
+		return 0;
+  806454:	b8 00 00 00 00       	mov    $0x0,%eax
+  806459:	eb 64                	jmp    8064bf <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  80645b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80645f:	48 89 d1             	mov    %rdx,%rcx
+  806462:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806466:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80646d:	ff ff ff 
+  806470:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806474:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806478:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  80647c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806480:	83 e2 01             	and    $0x1,%edx
+  806483:	48 85 d2             	test   %rdx,%rdx
+  806486:	75 07                	jne    80648f <pageref+0x80>
+		return 0;
+  806488:	b8 00 00 00 00       	mov    $0x0,%eax
+  80648d:	eb 30                	jmp    8064bf <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  80648f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806493:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806497:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80649e:	ff ff ff 
+  8064a1:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8064a5:	48 89 d0             	mov    %rdx,%rax
+  8064a8:	48 01 c0             	add    %rax,%rax
+  8064ab:	48 01 d0             	add    %rdx,%rax
+  8064ae:	48 c1 e0 03          	shl    $0x3,%rax
+  8064b2:	48 01 c8             	add    %rcx,%rax
+  8064b5:	48 83 c0 08          	add    $0x8,%rax
+  8064b9:	0f b7 00             	movzwl (%rax),%eax
+  8064bc:	0f b7 c0             	movzwl %ax,%eax
+}
+  8064bf:	c9                   	leave
+  8064c0:	c3                   	ret
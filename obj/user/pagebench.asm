@@ -0,0 +1,10735 @@
+
+obj/user/pagebench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 2f 02 00 00       	call   800270 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <worker>:
+#define NROUNDS		200
+#define BASE		((char *) 0x10000000)
+
+static void
+worker(int id)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <worker+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int i, j, r;
+
+	for (i = 0; i < NROUNDS; i++) {
+  800065:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80006c:	e9 1d 01 00 00       	jmp    80018e <worker+0x14b>
+		for (j = 0; j < NPAGES; j++)
+  800071:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  800078:	eb 7e                	jmp    8000f8 <worker+0xb5>
+			if ((r = sys_page_alloc(0, BASE + j * PGSIZE,
+  80007a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80007d:	c1 e0 0c             	shl    $0xc,%eax
+  800080:	48 98                	cltq
+  800082:	48 05 00 00 00 10    	add    $0x10000000,%rax
+  800088:	ba 07 00 00 00       	mov    $0x7,%edx
+  80008d:	48 89 c6             	mov    %rax,%rsi
+  800090:	bf 00 00 00 00       	mov    $0x0,%edi
+  800095:	49 89 df             	mov    %rbx,%r15
+  800098:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  80009f:	ff ff ff 
+  8000a2:	48 01 d8             	add    %rbx,%rax
+  8000a5:	ff d0                	call   *%rax
+  8000a7:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8000aa:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8000ae:	79 44                	jns    8000f4 <worker+0xb1>
+						PTE_P|PTE_U|PTE_W)) < 0)
+				panic("sys_page_alloc: %e", r);
+  8000b0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8000b3:	89 c1                	mov    %eax,%ecx
+  8000b5:	48 b8 60 de ff ff ff 	movabs $0xffffffffffffde60,%rax
+  8000bc:	ff ff ff 
+  8000bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c3:	48 89 c2             	mov    %rax,%rdx
+  8000c6:	be 14 00 00 00       	mov    $0x14,%esi
+  8000cb:	48 b8 73 de ff ff ff 	movabs $0xffffffffffffde73,%rax
+  8000d2:	ff ff ff 
+  8000d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000d9:	48 89 c7             	mov    %rax,%rdi
+  8000dc:	49 89 df             	mov    %rbx,%r15
+  8000df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e4:	49 b8 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%r8
+  8000eb:	ff ff ff 
+  8000ee:	49 01 d8             	add    %rbx,%r8
+  8000f1:	41 ff d0             	call   *%r8
+		for (j = 0; j < NPAGES; j++)
+  8000f4:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  8000f8:	83 7d e8 3f          	cmpl   $0x3f,-0x18(%rbp)
+  8000fc:	0f 8e 78 ff ff ff    	jle    80007a <worker+0x37>
+		for (j = 0; j < NPAGES; j++)
+  800102:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  800109:	eb 79                	jmp    800184 <worker+0x141>
+			if ((r = sys_page_unmap(0, BASE + j * PGSIZE)) < 0)
+  80010b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80010e:	c1 e0 0c             	shl    $0xc,%eax
+  800111:	48 98                	cltq
+  800113:	48 05 00 00 00 10    	add    $0x10000000,%rax
+  800119:	48 89 c6             	mov    %rax,%rsi
+  80011c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800121:	49 89 df             	mov    %rbx,%r15
+  800124:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  80012b:	ff ff ff 
+  80012e:	48 01 d8             	add    %rbx,%rax
+  800131:	ff d0                	call   *%rax
+  800133:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800136:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80013a:	79 44                	jns    800180 <worker+0x13d>
+				panic("sys_page_unmap: %e", r);
+  80013c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80013f:	89 c1                	mov    %eax,%ecx
+  800141:	48 b8 84 de ff ff ff 	movabs $0xffffffffffffde84,%rax
+  800148:	ff ff ff 
+  80014b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80014f:	48 89 c2             	mov    %rax,%rdx
+  800152:	be 17 00 00 00       	mov    $0x17,%esi
+  800157:	48 b8 73 de ff ff ff 	movabs $0xffffffffffffde73,%rax
+  80015e:	ff ff ff 
+  800161:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800165:	48 89 c7             	mov    %rax,%rdi
+  800168:	49 89 df             	mov    %rbx,%r15
+  80016b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800170:	49 b8 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%r8
+  800177:	ff ff ff 
+  80017a:	49 01 d8             	add    %rbx,%r8
+  80017d:	41 ff d0             	call   *%r8
+		for (j = 0; j < NPAGES; j++)
+  800180:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  800184:	83 7d e8 3f          	cmpl   $0x3f,-0x18(%rbp)
+  800188:	7e 81                	jle    80010b <worker+0xc8>
+	for (i = 0; i < NROUNDS; i++) {
+  80018a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80018e:	81 7d ec c7 00 00 00 	cmpl   $0xc7,-0x14(%rbp)
+  800195:	0f 8e d6 fe ff ff    	jle    800071 <worker+0x2e>
+	}
+}
+  80019b:	90                   	nop
+  80019c:	90                   	nop
+  80019d:	48 83 c4 20          	add    $0x20,%rsp
+  8001a1:	5b                   	pop    %rbx
+  8001a2:	41 5f                	pop    %r15
+  8001a4:	5d                   	pop    %rbp
+  8001a5:	c3                   	ret
+
+00000000008001a6 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001a6:	55                   	push   %rbp
+  8001a7:	48 89 e5             	mov    %rsp,%rbp
+  8001aa:	41 57                	push   %r15
+  8001ac:	53                   	push   %rbx
+  8001ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8001b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8001b1 <umain+0xb>
+  8001b8:	49 bb 8f 8e 00 00 00 	movabs $0x8e8f,%r11
+  8001bf:	00 00 00 
+  8001c2:	4c 01 db             	add    %r11,%rbx
+  8001c5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8001c8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	unsigned ms = bench_workers(NWORKERS, worker);
+  8001cc:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8001d3:	ff ff ff 
+  8001d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001da:	48 89 c6             	mov    %rax,%rsi
+  8001dd:	bf 08 00 00 00       	mov    $0x8,%edi
+  8001e2:	49 89 df             	mov    %rbx,%r15
+  8001e5:	48 b8 66 c3 ff ff ff 	movabs $0xffffffffffffc366,%rax
+  8001ec:	ff ff ff 
+  8001ef:	48 01 d8             	add    %rbx,%rax
+  8001f2:	ff d0                	call   *%rax
+  8001f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	cprintf("pagebench: %d page alloc/free pairs in %u ms\n",
+  8001f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001fa:	89 c2                	mov    %eax,%edx
+  8001fc:	be 00 90 01 00       	mov    $0x19000,%esi
+  800201:	48 b8 98 de ff ff ff 	movabs $0xffffffffffffde98,%rax
+  800208:	ff ff ff 
+  80020b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80020f:	48 89 c7             	mov    %rax,%rdi
+  800212:	49 89 df             	mov    %rbx,%r15
+  800215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021a:	48 b9 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rcx
+  800221:	ff ff ff 
+  800224:	48 01 d9             	add    %rbx,%rcx
+  800227:	ff d1                	call   *%rcx
+		NWORKERS * NROUNDS * NPAGES, ms);
+	if (ms > 0)
+  800229:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80022d:	74 37                	je     800266 <umain+0xc0>
+		cprintf("pagebench: %u pairs/s\n",
+  80022f:	b8 00 80 1a 06       	mov    $0x61a8000,%eax
+  800234:	ba 00 00 00 00       	mov    $0x0,%edx
+  800239:	f7 75 ec             	divl   -0x14(%rbp)
+  80023c:	89 c6                	mov    %eax,%esi
+  80023e:	48 b8 c6 de ff ff ff 	movabs $0xffffffffffffdec6,%rax
+  800245:	ff ff ff 
+  800248:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80024c:	48 89 c7             	mov    %rax,%rdi
+  80024f:	49 89 df             	mov    %rbx,%r15
+  800252:	b8 00 00 00 00       	mov    $0x0,%eax
+  800257:	48 ba 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rdx
+  80025e:	ff ff ff 
+  800261:	48 01 da             	add    %rbx,%rdx
+  800264:	ff d2                	call   *%rdx
+			NWORKERS * NROUNDS * NPAGES * 1000 / ms);
+}
+  800266:	90                   	nop
+  800267:	48 83 c4 20          	add    $0x20,%rsp
+  80026b:	5b                   	pop    %rbx
+  80026c:	41 5f                	pop    %r15
+  80026e:	5d                   	pop    %rbp
+  80026f:	c3                   	ret
+
+0000000000800270 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800270:	55                   	push   %rbp
+  800271:	48 89 e5             	mov    %rsp,%rbp
+  800274:	41 57                	push   %r15
+  800276:	53                   	push   %rbx
+  800277:	48 83 ec 20          	sub    $0x20,%rsp
+  80027b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80027b <libmain+0xb>
+  800282:	49 bb c5 8d 00 00 00 	movabs $0x8dc5,%r11
+  800289:	00 00 00 
+  80028c:	4c 01 db             	add    %r11,%rbx
+  80028f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800292:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800296:	49 89 df             	mov    %rbx,%r15
+  800299:	48 b8 e6 8f ff ff ff 	movabs $0xffffffffffff8fe6,%rax
+  8002a0:	ff ff ff 
+  8002a3:	48 01 d8             	add    %rbx,%rax
+  8002a6:	ff d0                	call   *%rax
+  8002a8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8002ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002b3:	48 98                	cltq
+  8002b5:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8002bc:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8002c3:	ff ff ff 
+  8002c6:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8002ca:	48 01 c2             	add    %rax,%rdx
+  8002cd:	48 b8 e8 2f 01 00 00 	movabs $0x12fe8,%rax
+  8002d4:	00 00 00 
+  8002d7:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002db:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8002df:	7e 15                	jle    8002f6 <libmain+0x86>
+		binaryname = argv[0];
+  8002e1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8002e5:	48 8b 00             	mov    (%rax),%rax
+  8002e8:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8002ef:	00 00 00 
+  8002f2:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8002f6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8002fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8002fd:	48 89 d6             	mov    %rdx,%rsi
+  800300:	89 c7                	mov    %eax,%edi
+  800302:	49 89 df             	mov    %rbx,%r15
+  800305:	48 b8 66 71 ff ff ff 	movabs $0xffffffffffff7166,%rax
+  80030c:	ff ff ff 
+  80030f:	48 01 d8             	add    %rbx,%rax
+  800312:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800314:	49 89 df             	mov    %rbx,%r15
+  800317:	48 b8 f0 72 ff ff ff 	movabs $0xffffffffffff72f0,%rax
+  80031e:	ff ff ff 
+  800321:	48 01 d8             	add    %rbx,%rax
+  800324:	ff d0                	call   *%rax
+}
+  800326:	90                   	nop
+  800327:	48 83 c4 20          	add    $0x20,%rsp
+  80032b:	5b                   	pop    %rbx
+  80032c:	41 5f                	pop    %r15
+  80032e:	5d                   	pop    %rbp
+  80032f:	c3                   	ret
+
+0000000000800330 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800330:	55                   	push   %rbp
+  800331:	48 89 e5             	mov    %rsp,%rbp
+  800334:	41 57                	push   %r15
+  800336:	53                   	push   %rbx
+  800337:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800337 <exit+0x7>
+  80033e:	49 bb 09 8d 00 00 00 	movabs $0x8d09,%r11
+  800345:	00 00 00 
+  800348:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80034b:	49 89 df             	mov    %rbx,%r15
+  80034e:	48 b8 63 9c ff ff ff 	movabs $0xffffffffffff9c63,%rax
+  800355:	ff ff ff 
+  800358:	48 01 d8             	add    %rbx,%rax
+  80035b:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80035d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800362:	49 89 df             	mov    %rbx,%r15
+  800365:	48 b8 8a 8f ff ff ff 	movabs $0xffffffffffff8f8a,%rax
+  80036c:	ff ff ff 
+  80036f:	48 01 d8             	add    %rbx,%rax
+  800372:	ff d0                	call   *%rax
+}
+  800374:	90                   	nop
+  800375:	5b                   	pop    %rbx
+  800376:	41 5f                	pop    %r15
+  800378:	5d                   	pop    %rbp
+  800379:	c3                   	ret
+
+000000000080037a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80037a:	55                   	push   %rbp
+  80037b:	48 89 e5             	mov    %rsp,%rbp
+  80037e:	41 57                	push   %r15
+  800380:	41 54                	push   %r12
+  800382:	53                   	push   %rbx
+  800383:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80038a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80038a <_panic+0x10>
+  800391:	49 bb b6 8c 00 00 00 	movabs $0x8cb6,%r11
+  800398:	00 00 00 
+  80039b:	4c 01 db             	add    %r11,%rbx
+  80039e:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8003a5:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8003ab:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8003b2:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8003b9:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8003c0:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8003c7:	84 c0                	test   %al,%al
+  8003c9:	74 26                	je     8003f1 <_panic+0x77>
+  8003cb:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8003d2:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8003d9:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8003dd:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8003e1:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8003e5:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8003e9:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8003ed:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003f1:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8003f8:	00 00 00 
+  8003fb:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800402:	00 00 00 
+  800405:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800409:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800410:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800417:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80041e:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800425:	ff ff ff 
+  800428:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80042c:	4c 8b 20             	mov    (%rax),%r12
+  80042f:	49 89 df             	mov    %rbx,%r15
+  800432:	48 b8 e6 8f ff ff ff 	movabs $0xffffffffffff8fe6,%rax
+  800439:	ff ff ff 
+  80043c:	48 01 d8             	add    %rbx,%rax
+  80043f:	ff d0                	call   *%rax
+  800441:	89 c6                	mov    %eax,%esi
+  800443:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800449:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800450:	41 89 d0             	mov    %edx,%r8d
+  800453:	48 89 c1             	mov    %rax,%rcx
+  800456:	4c 89 e2             	mov    %r12,%rdx
+  800459:	48 b8 e8 de ff ff ff 	movabs $0xffffffffffffdee8,%rax
+  800460:	ff ff ff 
+  800463:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800467:	48 89 c7             	mov    %rax,%rdi
+  80046a:	49 89 df             	mov    %rbx,%r15
+  80046d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800472:	49 b9 11 76 ff ff ff 	movabs $0xffffffffffff7611,%r9
+  800479:	ff ff ff 
+  80047c:	49 01 d9             	add    %rbx,%r9
+  80047f:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800482:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800489:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800490:	48 89 d6             	mov    %rdx,%rsi
+  800493:	48 89 c7             	mov    %rax,%rdi
+  800496:	49 89 df             	mov    %rbx,%r15
+  800499:	48 b8 31 75 ff ff ff 	movabs $0xffffffffffff7531,%rax
+  8004a0:	ff ff ff 
+  8004a3:	48 01 d8             	add    %rbx,%rax
+  8004a6:	ff d0                	call   *%rax
+	cprintf("\n");
+  8004a8:	48 b8 0b df ff ff ff 	movabs $0xffffffffffffdf0b,%rax
+  8004af:	ff ff ff 
+  8004b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004b6:	48 89 c7             	mov    %rax,%rdi
+  8004b9:	49 89 df             	mov    %rbx,%r15
+  8004bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c1:	48 ba 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rdx
+  8004c8:	ff ff ff 
+  8004cb:	48 01 da             	add    %rbx,%rdx
+  8004ce:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8004d0:	cc                   	int3
+  8004d1:	eb fd                	jmp    8004d0 <_panic+0x156>
+
+00000000008004d3 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8004d3:	55                   	push   %rbp
+  8004d4:	48 89 e5             	mov    %rsp,%rbp
+  8004d7:	41 57                	push   %r15
+  8004d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8004dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8004dd <putch+0xa>
+  8004e4:	49 bb 63 8b 00 00 00 	movabs $0x8b63,%r11
+  8004eb:	00 00 00 
+  8004ee:	4c 01 d8             	add    %r11,%rax
+  8004f1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8004f4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8004f8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004fc:	8b 12                	mov    (%rdx),%edx
+  8004fe:	8d 72 01             	lea    0x1(%rdx),%esi
+  800501:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800505:	89 31                	mov    %esi,(%rcx)
+  800507:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80050a:	89 ce                	mov    %ecx,%esi
+  80050c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800510:	48 63 d2             	movslq %edx,%rdx
+  800513:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800518:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80051c:	8b 12                	mov    (%rdx),%edx
+  80051e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800524:	75 33                	jne    800559 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800526:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80052a:	8b 12                	mov    (%rdx),%edx
+  80052c:	48 63 d2             	movslq %edx,%rdx
+  80052f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800533:	48 83 c1 08          	add    $0x8,%rcx
+  800537:	48 89 d6             	mov    %rdx,%rsi
+  80053a:	48 89 cf             	mov    %rcx,%rdi
+  80053d:	49 89 c7             	mov    %rax,%r15
+  800540:	48 ba d7 8e ff ff ff 	movabs $0xffffffffffff8ed7,%rdx
+  800547:	ff ff ff 
+  80054a:	48 01 c2             	add    %rax,%rdx
+  80054d:	ff d2                	call   *%rdx
+        b->idx = 0;
+  80054f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800553:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800559:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80055d:	8b 40 04             	mov    0x4(%rax),%eax
+  800560:	8d 50 01             	lea    0x1(%rax),%edx
+  800563:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800567:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80056a:	90                   	nop
+  80056b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80056f:	c9                   	leave
+  800570:	c3                   	ret
+
+0000000000800571 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800571:	55                   	push   %rbp
+  800572:	48 89 e5             	mov    %rsp,%rbp
+  800575:	41 57                	push   %r15
+  800577:	53                   	push   %rbx
+  800578:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80057f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80057f <vcprintf+0xe>
+  800586:	49 bb c1 8a 00 00 00 	movabs $0x8ac1,%r11
+  80058d:	00 00 00 
+  800590:	4c 01 db             	add    %r11,%rbx
+  800593:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80059a:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8005a1:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8005a8:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8005af:	48 8b 06             	mov    (%rsi),%rax
+  8005b2:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005b6:	48 89 01             	mov    %rax,(%rcx)
+  8005b9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005bd:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005c1:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8005c5:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8005cc:	00 00 00 
+    b.cnt = 0;
+  8005cf:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8005d6:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8005d9:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8005e0:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8005e7:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8005ee:	48 89 c6             	mov    %rax,%rsi
+  8005f1:	48 b8 93 74 ff ff ff 	movabs $0xffffffffffff7493,%rax
+  8005f8:	ff ff ff 
+  8005fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005ff:	48 89 c7             	mov    %rax,%rdi
+  800602:	49 89 df             	mov    %rbx,%r15
+  800605:	48 b8 55 7a ff ff ff 	movabs $0xffffffffffff7a55,%rax
+  80060c:	ff ff ff 
+  80060f:	48 01 d8             	add    %rbx,%rax
+  800612:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800614:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80061a:	48 98                	cltq
+  80061c:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800623:	48 83 c2 08          	add    $0x8,%rdx
+  800627:	48 89 c6             	mov    %rax,%rsi
+  80062a:	48 89 d7             	mov    %rdx,%rdi
+  80062d:	49 89 df             	mov    %rbx,%r15
+  800630:	48 b8 d7 8e ff ff ff 	movabs $0xffffffffffff8ed7,%rax
+  800637:	ff ff ff 
+  80063a:	48 01 d8             	add    %rbx,%rax
+  80063d:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  80063f:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800645:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80064c:	5b                   	pop    %rbx
+  80064d:	41 5f                	pop    %r15
+  80064f:	5d                   	pop    %rbp
+  800650:	c3                   	ret
+
+0000000000800651 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800651:	55                   	push   %rbp
+  800652:	48 89 e5             	mov    %rsp,%rbp
+  800655:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80065c:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80065c <cprintf+0xb>
+  800663:	49 bb e4 89 00 00 00 	movabs $0x89e4,%r11
+  80066a:	00 00 00 
+  80066d:	4d 01 da             	add    %r11,%r10
+  800670:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800677:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80067e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800685:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80068c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800693:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80069a:	84 c0                	test   %al,%al
+  80069c:	74 20                	je     8006be <cprintf+0x6d>
+  80069e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8006a2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8006a6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8006aa:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8006ae:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8006b2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8006b6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8006ba:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8006be:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8006c5:	00 00 00 
+  8006c8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8006cf:	00 00 00 
+  8006d2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006d6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8006dd:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8006e4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8006eb:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8006f2:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8006f9:	48 8b 06             	mov    (%rsi),%rax
+  8006fc:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800700:	48 89 01             	mov    %rax,(%rcx)
+  800703:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800707:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80070b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80070f:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800716:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80071d:	48 89 d6             	mov    %rdx,%rsi
+  800720:	48 89 c7             	mov    %rax,%rdi
+  800723:	48 b8 31 75 ff ff ff 	movabs $0xffffffffffff7531,%rax
+  80072a:	ff ff ff 
+  80072d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800731:	ff d0                	call   *%rax
+  800733:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800739:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80073f:	c9                   	leave
+  800740:	c3                   	ret
+
+0000000000800741 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800741:	55                   	push   %rbp
+  800742:	48 89 e5             	mov    %rsp,%rbp
+  800745:	53                   	push   %rbx
+  800746:	48 83 ec 38          	sub    $0x38,%rsp
+  80074a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80074a <printnum+0x9>
+  800751:	49 bb f6 88 00 00 00 	movabs $0x88f6,%r11
+  800758:	00 00 00 
+  80075b:	4c 01 db             	add    %r11,%rbx
+  80075e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800762:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800766:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80076a:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80076d:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800771:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800775:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800778:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80077c:	72 58                	jb     8007d6 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80077e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800781:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800784:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800787:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80078b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800790:	48 f7 f6             	div    %rsi
+  800793:	49 89 c2             	mov    %rax,%r10
+  800796:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800799:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80079c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8007a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a4:	41 89 c9             	mov    %ecx,%r9d
+  8007a7:	41 89 f8             	mov    %edi,%r8d
+  8007aa:	89 d1                	mov    %edx,%ecx
+  8007ac:	4c 89 d2             	mov    %r10,%rdx
+  8007af:	48 89 c7             	mov    %rax,%rdi
+  8007b2:	48 b8 01 77 ff ff ff 	movabs $0xffffffffffff7701,%rax
+  8007b9:	ff ff ff 
+  8007bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007c0:	ff d0                	call   *%rax
+  8007c2:	eb 1c                	jmp    8007e0 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007c4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007c8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8007cb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007cf:	48 89 d6             	mov    %rdx,%rsi
+  8007d2:	89 c7                	mov    %eax,%edi
+  8007d4:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8007d6:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8007da:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8007de:	7f e4                	jg     8007c4 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007e0:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8007e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8007e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007ec:	48 f7 f1             	div    %rcx
+  8007ef:	48 b8 47 e0 ff ff ff 	movabs $0xffffffffffffe047,%rax
+  8007f6:	ff ff ff 
+  8007f9:	48 01 d8             	add    %rbx,%rax
+  8007fc:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800800:	0f be c0             	movsbl %al,%eax
+  800803:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800807:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80080b:	48 89 d6             	mov    %rdx,%rsi
+  80080e:	89 c7                	mov    %eax,%edi
+  800810:	ff d1                	call   *%rcx
+}
+  800812:	90                   	nop
+  800813:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800817:	c9                   	leave
+  800818:	c3                   	ret
+
+0000000000800819 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800819:	55                   	push   %rbp
+  80081a:	48 89 e5             	mov    %rsp,%rbp
+  80081d:	48 83 ec 20          	sub    $0x20,%rsp
+  800821:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800821 <getuint+0x8>
+  800828:	49 bb 1f 88 00 00 00 	movabs $0x881f,%r11
+  80082f:	00 00 00 
+  800832:	4c 01 d8             	add    %r11,%rax
+  800835:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800839:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80083c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800840:	7e 4f                	jle    800891 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800842:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800846:	8b 00                	mov    (%rax),%eax
+  800848:	83 f8 2f             	cmp    $0x2f,%eax
+  80084b:	77 24                	ja     800871 <getuint+0x58>
+  80084d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800851:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800855:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800859:	8b 00                	mov    (%rax),%eax
+  80085b:	89 c0                	mov    %eax,%eax
+  80085d:	48 01 d0             	add    %rdx,%rax
+  800860:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800864:	8b 12                	mov    (%rdx),%edx
+  800866:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800869:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80086d:	89 0a                	mov    %ecx,(%rdx)
+  80086f:	eb 14                	jmp    800885 <getuint+0x6c>
+  800871:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800875:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800879:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80087d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800881:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800885:	48 8b 00             	mov    (%rax),%rax
+  800888:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80088c:	e9 9d 00 00 00       	jmp    80092e <getuint+0x115>
+	else if (lflag)
+  800891:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800895:	74 4c                	je     8008e3 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800897:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80089b:	8b 00                	mov    (%rax),%eax
+  80089d:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a0:	77 24                	ja     8008c6 <getuint+0xad>
+  8008a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008a6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008ae:	8b 00                	mov    (%rax),%eax
+  8008b0:	89 c0                	mov    %eax,%eax
+  8008b2:	48 01 d0             	add    %rdx,%rax
+  8008b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008b9:	8b 12                	mov    (%rdx),%edx
+  8008bb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008be:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008c2:	89 0a                	mov    %ecx,(%rdx)
+  8008c4:	eb 14                	jmp    8008da <getuint+0xc1>
+  8008c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008ca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008ce:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008d2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008d6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008da:	48 8b 00             	mov    (%rax),%rax
+  8008dd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8008e1:	eb 4b                	jmp    80092e <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8008e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008e7:	8b 00                	mov    (%rax),%eax
+  8008e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ec:	77 24                	ja     800912 <getuint+0xf9>
+  8008ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008f2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008fa:	8b 00                	mov    (%rax),%eax
+  8008fc:	89 c0                	mov    %eax,%eax
+  8008fe:	48 01 d0             	add    %rdx,%rax
+  800901:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800905:	8b 12                	mov    (%rdx),%edx
+  800907:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80090a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80090e:	89 0a                	mov    %ecx,(%rdx)
+  800910:	eb 14                	jmp    800926 <getuint+0x10d>
+  800912:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800916:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80091a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80091e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800922:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800926:	8b 00                	mov    (%rax),%eax
+  800928:	89 c0                	mov    %eax,%eax
+  80092a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80092e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800932:	c9                   	leave
+  800933:	c3                   	ret
+
+0000000000800934 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800934:	55                   	push   %rbp
+  800935:	48 89 e5             	mov    %rsp,%rbp
+  800938:	48 83 ec 20          	sub    $0x20,%rsp
+  80093c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80093c <printfloat+0x8>
+  800943:	49 bb 04 87 00 00 00 	movabs $0x8704,%r11
+  80094a:	00 00 00 
+  80094d:	4c 01 d8             	add    %r11,%rax
+  800950:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800954:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800958:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80095c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800960:	48 85 c0             	test   %rax,%rax
+  800963:	79 12                	jns    800977 <printfloat+0x43>
+		putch('-',putdat);
+  800965:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800969:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80096d:	48 89 c6             	mov    %rax,%rsi
+  800970:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800975:	ff d2                	call   *%rdx
+	
+}
+  800977:	90                   	nop
+  800978:	c9                   	leave
+  800979:	c3                   	ret
+
+000000000080097a <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  80097a:	55                   	push   %rbp
+  80097b:	48 89 e5             	mov    %rsp,%rbp
+  80097e:	48 83 ec 20          	sub    $0x20,%rsp
+  800982:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800982 <getint+0x8>
+  800989:	49 bb be 86 00 00 00 	movabs $0x86be,%r11
+  800990:	00 00 00 
+  800993:	4c 01 d8             	add    %r11,%rax
+  800996:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80099a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80099d:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8009a1:	7e 4f                	jle    8009f2 <getint+0x78>
+		x=va_arg(*ap, long long);
+  8009a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a7:	8b 00                	mov    (%rax),%eax
+  8009a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ac:	77 24                	ja     8009d2 <getint+0x58>
+  8009ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009b2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ba:	8b 00                	mov    (%rax),%eax
+  8009bc:	89 c0                	mov    %eax,%eax
+  8009be:	48 01 d0             	add    %rdx,%rax
+  8009c1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009c5:	8b 12                	mov    (%rdx),%edx
+  8009c7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009ca:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009ce:	89 0a                	mov    %ecx,(%rdx)
+  8009d0:	eb 14                	jmp    8009e6 <getint+0x6c>
+  8009d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009d6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009da:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009de:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009e2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009e6:	48 8b 00             	mov    (%rax),%rax
+  8009e9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009ed:	e9 9d 00 00 00       	jmp    800a8f <getint+0x115>
+	else if (lflag)
+  8009f2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8009f6:	74 4c                	je     800a44 <getint+0xca>
+		x=va_arg(*ap, long);
+  8009f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009fc:	8b 00                	mov    (%rax),%eax
+  8009fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800a01:	77 24                	ja     800a27 <getint+0xad>
+  800a03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a07:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a0f:	8b 00                	mov    (%rax),%eax
+  800a11:	89 c0                	mov    %eax,%eax
+  800a13:	48 01 d0             	add    %rdx,%rax
+  800a16:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a1a:	8b 12                	mov    (%rdx),%edx
+  800a1c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a1f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a23:	89 0a                	mov    %ecx,(%rdx)
+  800a25:	eb 14                	jmp    800a3b <getint+0xc1>
+  800a27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a2b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a2f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a33:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a37:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a3b:	48 8b 00             	mov    (%rax),%rax
+  800a3e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a42:	eb 4b                	jmp    800a8f <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800a44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a48:	8b 00                	mov    (%rax),%eax
+  800a4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4d:	77 24                	ja     800a73 <getint+0xf9>
+  800a4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a53:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5b:	8b 00                	mov    (%rax),%eax
+  800a5d:	89 c0                	mov    %eax,%eax
+  800a5f:	48 01 d0             	add    %rdx,%rax
+  800a62:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a66:	8b 12                	mov    (%rdx),%edx
+  800a68:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a6b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a6f:	89 0a                	mov    %ecx,(%rdx)
+  800a71:	eb 14                	jmp    800a87 <getint+0x10d>
+  800a73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a77:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a7b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a7f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a83:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a87:	8b 00                	mov    (%rax),%eax
+  800a89:	48 98                	cltq
+  800a8b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a93:	c9                   	leave
+  800a94:	c3                   	ret
+
+0000000000800a95 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800a95:	55                   	push   %rbp
+  800a96:	48 89 e5             	mov    %rsp,%rbp
+  800a99:	41 57                	push   %r15
+  800a9b:	41 55                	push   %r13
+  800a9d:	41 54                	push   %r12
+  800a9f:	53                   	push   %rbx
+  800aa0:	48 83 ec 60          	sub    $0x60,%rsp
+  800aa4:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800aa4 <vprintfmt+0xf>
+  800aab:	49 bb 9c 85 00 00 00 	movabs $0x859c,%r11
+  800ab2:	00 00 00 
+  800ab5:	4d 01 dc             	add    %r11,%r12
+  800ab8:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800abc:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800ac0:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800ac4:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800ac8:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800acf:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800ad3:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800ad7:	48 8b 06             	mov    (%rsi),%rax
+  800ada:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800ade:	48 89 01             	mov    %rax,(%rcx)
+  800ae1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ae5:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ae9:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800aed:	eb 17                	jmp    800b06 <vprintfmt+0x71>
+			if (ch == '\0')
+  800aef:	85 db                	test   %ebx,%ebx
+  800af1:	0f 84 97 05 00 00    	je     80108e <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800af7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800afb:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800aff:	48 89 c6             	mov    %rax,%rsi
+  800b02:	89 df                	mov    %ebx,%edi
+  800b04:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800b06:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b0a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b0e:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b12:	0f b6 00             	movzbl (%rax),%eax
+  800b15:	0f b6 d8             	movzbl %al,%ebx
+  800b18:	83 fb 25             	cmp    $0x25,%ebx
+  800b1b:	75 d2                	jne    800aef <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800b1d:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800b21:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800b28:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800b2f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800b36:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800b3d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b41:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b45:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b49:	0f b6 00             	movzbl (%rax),%eax
+  800b4c:	0f b6 d8             	movzbl %al,%ebx
+  800b4f:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800b52:	83 f8 55             	cmp    $0x55,%eax
+  800b55:	0f 87 00 05 00 00    	ja     80105b <vprintfmt+0x5c6>
+  800b5b:	89 c0                	mov    %eax,%eax
+  800b5d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800b64:	00 
+  800b65:	48 8d 05 44 65 00 00 	lea    0x6544(%rip),%rax        # 8070b0 <.LC18+0xc>
+  800b6c:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800b70:	48 8d 15 39 65 00 00 	lea    0x6539(%rip),%rdx        # 8070b0 <.LC18+0xc>
+  800b77:	48 01 d0             	add    %rdx,%rax
+  800b7a:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800b7c:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800b80:	eb bb                	jmp    800b3d <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800b82:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800b86:	eb b5                	jmp    800b3d <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800b88:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800b8f:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800b92:	89 d0                	mov    %edx,%eax
+  800b94:	c1 e0 02             	shl    $0x2,%eax
+  800b97:	01 d0                	add    %edx,%eax
+  800b99:	01 c0                	add    %eax,%eax
+  800b9b:	01 d8                	add    %ebx,%eax
+  800b9d:	83 e8 30             	sub    $0x30,%eax
+  800ba0:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800ba3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ba7:	0f b6 00             	movzbl (%rax),%eax
+  800baa:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800bad:	83 fb 2f             	cmp    $0x2f,%ebx
+  800bb0:	7e 60                	jle    800c12 <vprintfmt+0x17d>
+  800bb2:	83 fb 39             	cmp    $0x39,%ebx
+  800bb5:	7f 5b                	jg     800c12 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800bb7:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800bbc:	eb d1                	jmp    800b8f <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800bbe:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800bc1:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc4:	77 17                	ja     800bdd <vprintfmt+0x148>
+  800bc6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800bca:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bcd:	89 d2                	mov    %edx,%edx
+  800bcf:	48 01 d0             	add    %rdx,%rax
+  800bd2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bd5:	83 c2 08             	add    $0x8,%edx
+  800bd8:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800bdb:	eb 0c                	jmp    800be9 <vprintfmt+0x154>
+  800bdd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800be1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800be5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800be9:	8b 00                	mov    (%rax),%eax
+  800beb:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800bee:	eb 23                	jmp    800c13 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800bf0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800bf4:	0f 89 43 ff ff ff    	jns    800b3d <vprintfmt+0xa8>
+				width = 0;
+  800bfa:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800c01:	e9 37 ff ff ff       	jmp    800b3d <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800c06:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800c0d:	e9 2b ff ff ff       	jmp    800b3d <vprintfmt+0xa8>
+			goto process_precision;
+  800c12:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800c13:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c17:	0f 89 20 ff ff ff    	jns    800b3d <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800c1d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800c20:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800c23:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800c2a:	e9 0e ff ff ff       	jmp    800b3d <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800c2f:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800c33:	e9 05 ff ff ff       	jmp    800b3d <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800c38:	83 fb 39             	cmp    $0x39,%ebx
+  800c3b:	7f 0b                	jg     800c48 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800c3d:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800c40:	c1 e0 08             	shl    $0x8,%eax
+  800c43:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800c46:	eb 21                	jmp    800c69 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800c48:	83 fb 60             	cmp    $0x60,%ebx
+  800c4b:	7e 10                	jle    800c5d <vprintfmt+0x1c8>
+  800c4d:	83 fb 66             	cmp    $0x66,%ebx
+  800c50:	7f 0b                	jg     800c5d <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800c52:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800c55:	c1 e0 08             	shl    $0x8,%eax
+  800c58:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800c5b:	eb 0c                	jmp    800c69 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800c5d:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800c64:	e9 04 01 00 00       	jmp    800d6d <vprintfmt+0x2d8>
+  800c69:	e9 ff 00 00 00       	jmp    800d6d <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800c6e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c71:	83 f8 2f             	cmp    $0x2f,%eax
+  800c74:	77 17                	ja     800c8d <vprintfmt+0x1f8>
+  800c76:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c7a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c7d:	89 d2                	mov    %edx,%edx
+  800c7f:	48 01 d0             	add    %rdx,%rax
+  800c82:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c85:	83 c2 08             	add    $0x8,%edx
+  800c88:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c8b:	eb 0c                	jmp    800c99 <vprintfmt+0x204>
+  800c8d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c91:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c95:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c99:	8b 00                	mov    (%rax),%eax
+  800c9b:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c9f:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800ca3:	48 89 d6             	mov    %rdx,%rsi
+  800ca6:	89 c7                	mov    %eax,%edi
+  800ca8:	ff d1                	call   *%rcx
+			break;
+  800caa:	e9 da 03 00 00       	jmp    801089 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800caf:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800cb2:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb5:	77 17                	ja     800cce <vprintfmt+0x239>
+  800cb7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800cbb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cbe:	89 d2                	mov    %edx,%edx
+  800cc0:	48 01 d0             	add    %rdx,%rax
+  800cc3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cc6:	83 c2 08             	add    $0x8,%edx
+  800cc9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ccc:	eb 0c                	jmp    800cda <vprintfmt+0x245>
+  800cce:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cd2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cd6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800cda:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800cdc:	85 db                	test   %ebx,%ebx
+  800cde:	79 02                	jns    800ce2 <vprintfmt+0x24d>
+				err = -err;
+  800ce0:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800ce2:	83 fb 15             	cmp    $0x15,%ebx
+  800ce5:	7f 19                	jg     800d00 <vprintfmt+0x26b>
+  800ce7:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800cee:	00 00 00 
+  800cf1:	48 63 c3             	movslq %ebx,%rax
+  800cf4:	4c 01 e2             	add    %r12,%rdx
+  800cf7:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800cfb:	4d 85 ed             	test   %r13,%r13
+  800cfe:	75 36                	jne    800d36 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800d00:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800d04:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d08:	89 d9                	mov    %ebx,%ecx
+  800d0a:	48 ba 58 e0 ff ff ff 	movabs $0xffffffffffffe058,%rdx
+  800d11:	ff ff ff 
+  800d14:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800d18:	48 89 c7             	mov    %rax,%rdi
+  800d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d20:	49 b8 5c 80 ff ff ff 	movabs $0xffffffffffff805c,%r8
+  800d27:	ff ff ff 
+  800d2a:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800d2e:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800d31:	e9 53 03 00 00       	jmp    801089 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800d36:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800d3a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d3e:	4c 89 e9             	mov    %r13,%rcx
+  800d41:	48 ba 61 e0 ff ff ff 	movabs $0xffffffffffffe061,%rdx
+  800d48:	ff ff ff 
+  800d4b:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800d4f:	48 89 c7             	mov    %rax,%rdi
+  800d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d57:	49 b8 5c 80 ff ff ff 	movabs $0xffffffffffff805c,%r8
+  800d5e:	ff ff ff 
+  800d61:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800d65:	41 ff d0             	call   *%r8
+			break;
+  800d68:	e9 1c 03 00 00       	jmp    801089 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800d6d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d70:	83 f8 2f             	cmp    $0x2f,%eax
+  800d73:	77 17                	ja     800d8c <vprintfmt+0x2f7>
+  800d75:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d79:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d7c:	89 d2                	mov    %edx,%edx
+  800d7e:	48 01 d0             	add    %rdx,%rax
+  800d81:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d84:	83 c2 08             	add    $0x8,%edx
+  800d87:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d8a:	eb 0c                	jmp    800d98 <vprintfmt+0x303>
+  800d8c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d90:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d94:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d98:	4c 8b 28             	mov    (%rax),%r13
+  800d9b:	4d 85 ed             	test   %r13,%r13
+  800d9e:	75 0e                	jne    800dae <vprintfmt+0x319>
+				p = "(null)";
+  800da0:	48 b8 64 e0 ff ff ff 	movabs $0xffffffffffffe064,%rax
+  800da7:	ff ff ff 
+  800daa:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800dae:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800db2:	0f 8e 84 00 00 00    	jle    800e3c <vprintfmt+0x3a7>
+  800db8:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800dbc:	74 7e                	je     800e3c <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800dbe:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800dc1:	48 98                	cltq
+  800dc3:	48 89 c6             	mov    %rax,%rsi
+  800dc6:	4c 89 ef             	mov    %r13,%rdi
+  800dc9:	4d 89 e7             	mov    %r12,%r15
+  800dcc:	48 b8 81 83 ff ff ff 	movabs $0xffffffffffff8381,%rax
+  800dd3:	ff ff ff 
+  800dd6:	4c 01 e0             	add    %r12,%rax
+  800dd9:	ff d0                	call   *%rax
+  800ddb:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800dde:	eb 17                	jmp    800df7 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800de0:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800de4:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800de8:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800dec:	48 89 d6             	mov    %rdx,%rsi
+  800def:	89 c7                	mov    %eax,%edi
+  800df1:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800df3:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800df7:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800dfb:	7f e3                	jg     800de0 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800dfd:	eb 3d                	jmp    800e3c <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800dff:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800e03:	74 1e                	je     800e23 <vprintfmt+0x38e>
+  800e05:	83 fb 1f             	cmp    $0x1f,%ebx
+  800e08:	7e 05                	jle    800e0f <vprintfmt+0x37a>
+  800e0a:	83 fb 7e             	cmp    $0x7e,%ebx
+  800e0d:	7e 14                	jle    800e23 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800e0f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e13:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e17:	48 89 c6             	mov    %rax,%rsi
+  800e1a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800e1f:	ff d2                	call   *%rdx
+  800e21:	eb 15                	jmp    800e38 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800e23:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800e26:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800e29:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e2d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e31:	48 89 c6             	mov    %rax,%rsi
+  800e34:	89 cf                	mov    %ecx,%edi
+  800e36:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e38:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e3c:	4c 89 e8             	mov    %r13,%rax
+  800e3f:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800e43:	0f b6 00             	movzbl (%rax),%eax
+  800e46:	0f be d8             	movsbl %al,%ebx
+  800e49:	85 db                	test   %ebx,%ebx
+  800e4b:	74 28                	je     800e75 <vprintfmt+0x3e0>
+  800e4d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800e51:	78 ac                	js     800dff <vprintfmt+0x36a>
+  800e53:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800e57:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800e5b:	79 a2                	jns    800dff <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800e5d:	eb 16                	jmp    800e75 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800e5f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e63:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e67:	48 89 c6             	mov    %rax,%rsi
+  800e6a:	bf 20 00 00 00       	mov    $0x20,%edi
+  800e6f:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800e71:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e75:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e79:	7f e4                	jg     800e5f <vprintfmt+0x3ca>
+			break;
+  800e7b:	e9 09 02 00 00       	jmp    801089 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800e80:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e84:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e88:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800e8c:	0f b6 00             	movzbl (%rax),%eax
+  800e8f:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800e92:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800e93:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e96:	0f 8e ac fd ff ff    	jle    800c48 <vprintfmt+0x1b3>
+  800e9c:	e9 97 fd ff ff       	jmp    800c38 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800ea1:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ea5:	be 03 00 00 00       	mov    $0x3,%esi
+  800eaa:	48 89 c7             	mov    %rax,%rdi
+  800ead:	48 b8 3a 79 ff ff ff 	movabs $0xffffffffffff793a,%rax
+  800eb4:	ff ff ff 
+  800eb7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ebb:	ff d0                	call   *%rax
+  800ebd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800ec1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ec5:	48 85 c0             	test   %rax,%rax
+  800ec8:	79 1d                	jns    800ee7 <vprintfmt+0x452>
+				putch('-', putdat);
+  800eca:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ece:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ed2:	48 89 c6             	mov    %rax,%rsi
+  800ed5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800eda:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800edc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ee0:	48 f7 d8             	neg    %rax
+  800ee3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800ee7:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800eee:	e9 de 00 00 00       	jmp    800fd1 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800ef3:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ef7:	be 03 00 00 00       	mov    $0x3,%esi
+  800efc:	48 89 c7             	mov    %rax,%rdi
+  800eff:	48 b8 d9 77 ff ff ff 	movabs $0xffffffffffff77d9,%rax
+  800f06:	ff ff ff 
+  800f09:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f0d:	ff d0                	call   *%rax
+  800f0f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800f13:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800f1a:	e9 b2 00 00 00       	jmp    800fd1 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800f1f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f23:	be 03 00 00 00       	mov    $0x3,%esi
+  800f28:	48 89 c7             	mov    %rax,%rdi
+  800f2b:	48 b8 d9 77 ff ff ff 	movabs $0xffffffffffff77d9,%rax
+  800f32:	ff ff ff 
+  800f35:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f39:	ff d0                	call   *%rax
+  800f3b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800f3f:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800f46:	e9 86 00 00 00       	jmp    800fd1 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800f4b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f4f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f53:	48 89 c6             	mov    %rax,%rsi
+  800f56:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f5b:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800f5d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f61:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f65:	48 89 c6             	mov    %rax,%rsi
+  800f68:	bf 78 00 00 00       	mov    $0x78,%edi
+  800f6d:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800f6f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f72:	83 f8 2f             	cmp    $0x2f,%eax
+  800f75:	77 17                	ja     800f8e <vprintfmt+0x4f9>
+  800f77:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f7b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f7e:	89 d2                	mov    %edx,%edx
+  800f80:	48 01 d0             	add    %rdx,%rax
+  800f83:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f86:	83 c2 08             	add    $0x8,%edx
+  800f89:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f8c:	eb 0c                	jmp    800f9a <vprintfmt+0x505>
+  800f8e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f92:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f96:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f9a:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800f9d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800fa1:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800fa8:	eb 27                	jmp    800fd1 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800faa:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fae:	be 03 00 00 00       	mov    $0x3,%esi
+  800fb3:	48 89 c7             	mov    %rax,%rdi
+  800fb6:	48 b8 d9 77 ff ff ff 	movabs $0xffffffffffff77d9,%rax
+  800fbd:	ff ff ff 
+  800fc0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fc4:	ff d0                	call   *%rax
+  800fc6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800fca:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800fd1:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800fd6:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800fd9:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800fdc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800fe0:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800fe4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fe8:	45 89 c1             	mov    %r8d,%r9d
+  800feb:	41 89 f8             	mov    %edi,%r8d
+  800fee:	48 89 c7             	mov    %rax,%rdi
+  800ff1:	48 b8 01 77 ff ff ff 	movabs $0xffffffffffff7701,%rax
+  800ff8:	ff ff ff 
+  800ffb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fff:	ff d0                	call   *%rax
+			break;
+  801001:	e9 83 00 00 00       	jmp    801089 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801006:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80100a:	be 03 00 00 00       	mov    $0x3,%esi
+  80100f:	48 89 c7             	mov    %rax,%rdi
+  801012:	48 b8 d9 77 ff ff ff 	movabs $0xffffffffffff77d9,%rax
+  801019:	ff ff ff 
+  80101c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801020:	ff d0                	call   *%rax
+  801022:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801026:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80102a:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80102e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801032:	48 89 ce             	mov    %rcx,%rsi
+  801035:	48 89 c7             	mov    %rax,%rdi
+  801038:	48 b8 f4 78 ff ff ff 	movabs $0xffffffffffff78f4,%rax
+  80103f:	ff ff ff 
+  801042:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801046:	ff d0                	call   *%rax
+	
+			break;
+  801048:	eb 3f                	jmp    801089 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80104a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80104e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801052:	48 89 c6             	mov    %rax,%rsi
+  801055:	89 df                	mov    %ebx,%edi
+  801057:	ff d2                	call   *%rdx
+			break;
+  801059:	eb 2e                	jmp    801089 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80105b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80105f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801063:	48 89 c6             	mov    %rax,%rsi
+  801066:	bf 25 00 00 00       	mov    $0x25,%edi
+  80106b:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80106d:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801072:	eb 05                	jmp    801079 <vprintfmt+0x5e4>
+  801074:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801079:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80107d:	48 83 e8 01          	sub    $0x1,%rax
+  801081:	0f b6 00             	movzbl (%rax),%eax
+  801084:	3c 25                	cmp    $0x25,%al
+  801086:	75 ec                	jne    801074 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801088:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801089:	e9 78 fa ff ff       	jmp    800b06 <vprintfmt+0x71>
+				return;
+  80108e:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80108f:	48 83 c4 60          	add    $0x60,%rsp
+  801093:	5b                   	pop    %rbx
+  801094:	41 5c                	pop    %r12
+  801096:	41 5d                	pop    %r13
+  801098:	41 5f                	pop    %r15
+  80109a:	5d                   	pop    %rbp
+  80109b:	c3                   	ret
+
+000000000080109c <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80109c:	55                   	push   %rbp
+  80109d:	48 89 e5             	mov    %rsp,%rbp
+  8010a0:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8010a7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8010a7 <printfmt+0xb>
+  8010ae:	49 bb 99 7f 00 00 00 	movabs $0x7f99,%r11
+  8010b5:	00 00 00 
+  8010b8:	4d 01 da             	add    %r11,%r10
+  8010bb:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8010c2:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8010c9:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8010d0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010d7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010de:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010e5:	84 c0                	test   %al,%al
+  8010e7:	74 20                	je     801109 <printfmt+0x6d>
+  8010e9:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010ed:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010f1:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010f5:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010f9:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010fd:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801101:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801105:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801109:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801110:	00 00 00 
+  801113:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80111a:	00 00 00 
+  80111d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801121:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801128:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80112f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801136:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80113d:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801144:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80114b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801152:	48 89 c7             	mov    %rax,%rdi
+  801155:	48 b8 55 7a ff ff ff 	movabs $0xffffffffffff7a55,%rax
+  80115c:	ff ff ff 
+  80115f:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801163:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801165:	90                   	nop
+  801166:	c9                   	leave
+  801167:	c3                   	ret
+
+0000000000801168 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801168:	55                   	push   %rbp
+  801169:	48 89 e5             	mov    %rsp,%rbp
+  80116c:	48 83 ec 10          	sub    $0x10,%rsp
+  801170:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801170 <sprintputch+0x8>
+  801177:	49 bb d0 7e 00 00 00 	movabs $0x7ed0,%r11
+  80117e:	00 00 00 
+  801181:	4c 01 d8             	add    %r11,%rax
+  801184:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801187:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80118b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80118f:	8b 40 10             	mov    0x10(%rax),%eax
+  801192:	8d 50 01             	lea    0x1(%rax),%edx
+  801195:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801199:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80119c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011a0:	48 8b 10             	mov    (%rax),%rdx
+  8011a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011a7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8011ab:	48 39 c2             	cmp    %rax,%rdx
+  8011ae:	73 17                	jae    8011c7 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8011b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011b4:	48 8b 00             	mov    (%rax),%rax
+  8011b7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011bf:	48 89 0a             	mov    %rcx,(%rdx)
+  8011c2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8011c5:	88 10                	mov    %dl,(%rax)
+}
+  8011c7:	90                   	nop
+  8011c8:	c9                   	leave
+  8011c9:	c3                   	ret
+
+00000000008011ca <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8011ca:	55                   	push   %rbp
+  8011cb:	48 89 e5             	mov    %rsp,%rbp
+  8011ce:	53                   	push   %rbx
+  8011cf:	48 83 ec 58          	sub    $0x58,%rsp
+  8011d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011d3 <vsnprintf+0x9>
+  8011da:	49 bb 6d 7e 00 00 00 	movabs $0x7e6d,%r11
+  8011e1:	00 00 00 
+  8011e4:	4c 01 d8             	add    %r11,%rax
+  8011e7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8011eb:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8011ee:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8011f2:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8011f6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8011fa:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8011fe:	48 8b 0e             	mov    (%rsi),%rcx
+  801201:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801205:	48 89 0a             	mov    %rcx,(%rdx)
+  801208:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80120c:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801210:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801214:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801218:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80121c:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80121f:	48 63 d2             	movslq %edx,%rdx
+  801222:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801226:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80122a:	48 01 ca             	add    %rcx,%rdx
+  80122d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801231:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801238:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80123d:	74 06                	je     801245 <vsnprintf+0x7b>
+  80123f:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801243:	7f 07                	jg     80124c <vsnprintf+0x82>
+		return -E_INVAL;
+  801245:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80124a:	eb 34                	jmp    801280 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80124c:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801250:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801254:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801258:	48 bf 28 81 ff ff ff 	movabs $0xffffffffffff8128,%rdi
+  80125f:	ff ff ff 
+  801262:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801266:	49 b8 55 7a ff ff ff 	movabs $0xffffffffffff7a55,%r8
+  80126d:	ff ff ff 
+  801270:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801274:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801276:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80127a:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80127d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801280:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801284:	c9                   	leave
+  801285:	c3                   	ret
+
+0000000000801286 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801286:	55                   	push   %rbp
+  801287:	48 89 e5             	mov    %rsp,%rbp
+  80128a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801291:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801291 <snprintf+0xb>
+  801298:	49 bb af 7d 00 00 00 	movabs $0x7daf,%r11
+  80129f:	00 00 00 
+  8012a2:	4d 01 da             	add    %r11,%r10
+  8012a5:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8012ac:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8012b2:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8012b9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8012c0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8012c7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8012ce:	84 c0                	test   %al,%al
+  8012d0:	74 20                	je     8012f2 <snprintf+0x6c>
+  8012d2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8012d6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8012da:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012de:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8012e2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012e6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8012ea:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8012ee:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8012f2:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8012f9:	00 00 00 
+  8012fc:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801303:	00 00 00 
+  801306:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80130a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801311:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801318:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80131f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801326:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80132d:	48 8b 06             	mov    (%rsi),%rax
+  801330:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801334:	48 89 01             	mov    %rax,(%rcx)
+  801337:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80133b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80133f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801343:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80134a:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801351:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801357:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80135e:	48 89 c7             	mov    %rax,%rdi
+  801361:	48 b8 8a 81 ff ff ff 	movabs $0xffffffffffff818a,%rax
+  801368:	ff ff ff 
+  80136b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80136f:	ff d0                	call   *%rax
+  801371:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801377:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80137d:	c9                   	leave
+  80137e:	c3                   	ret
+
+000000000080137f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80137f:	55                   	push   %rbp
+  801380:	48 89 e5             	mov    %rsp,%rbp
+  801383:	48 83 ec 18          	sub    $0x18,%rsp
+  801387:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801387 <strlen+0x8>
+  80138e:	49 bb b9 7c 00 00 00 	movabs $0x7cb9,%r11
+  801395:	00 00 00 
+  801398:	4c 01 d8             	add    %r11,%rax
+  80139b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80139f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8013a6:	eb 09                	jmp    8013b1 <strlen+0x32>
+		n++;
+  8013a8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8013ac:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8013b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b5:	0f b6 00             	movzbl (%rax),%eax
+  8013b8:	84 c0                	test   %al,%al
+  8013ba:	75 ec                	jne    8013a8 <strlen+0x29>
+	return n;
+  8013bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013bf:	c9                   	leave
+  8013c0:	c3                   	ret
+
+00000000008013c1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8013c1:	55                   	push   %rbp
+  8013c2:	48 89 e5             	mov    %rsp,%rbp
+  8013c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8013c9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013c9 <strnlen+0x8>
+  8013d0:	49 bb 77 7c 00 00 00 	movabs $0x7c77,%r11
+  8013d7:	00 00 00 
+  8013da:	4c 01 d8             	add    %r11,%rax
+  8013dd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013e1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013e5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8013ec:	eb 0e                	jmp    8013fc <strnlen+0x3b>
+		n++;
+  8013ee:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013f2:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8013f7:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8013fc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801401:	74 0b                	je     80140e <strnlen+0x4d>
+  801403:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801407:	0f b6 00             	movzbl (%rax),%eax
+  80140a:	84 c0                	test   %al,%al
+  80140c:	75 e0                	jne    8013ee <strnlen+0x2d>
+	return n;
+  80140e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801411:	c9                   	leave
+  801412:	c3                   	ret
+
+0000000000801413 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801413:	55                   	push   %rbp
+  801414:	48 89 e5             	mov    %rsp,%rbp
+  801417:	48 83 ec 20          	sub    $0x20,%rsp
+  80141b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80141b <strcpy+0x8>
+  801422:	49 bb 25 7c 00 00 00 	movabs $0x7c25,%r11
+  801429:	00 00 00 
+  80142c:	4c 01 d8             	add    %r11,%rax
+  80142f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801433:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801437:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80143f:	90                   	nop
+  801440:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801444:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801448:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80144c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801450:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801454:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801458:	0f b6 12             	movzbl (%rdx),%edx
+  80145b:	88 10                	mov    %dl,(%rax)
+  80145d:	0f b6 00             	movzbl (%rax),%eax
+  801460:	84 c0                	test   %al,%al
+  801462:	75 dc                	jne    801440 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801464:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801468:	c9                   	leave
+  801469:	c3                   	ret
+
+000000000080146a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80146a:	55                   	push   %rbp
+  80146b:	48 89 e5             	mov    %rsp,%rbp
+  80146e:	53                   	push   %rbx
+  80146f:	48 83 ec 20          	sub    $0x20,%rsp
+  801473:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801473 <strcat+0x9>
+  80147a:	49 bb cd 7b 00 00 00 	movabs $0x7bcd,%r11
+  801481:	00 00 00 
+  801484:	4c 01 db             	add    %r11,%rbx
+  801487:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80148b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80148f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801493:	48 89 c7             	mov    %rax,%rdi
+  801496:	48 b8 3f 83 ff ff ff 	movabs $0xffffffffffff833f,%rax
+  80149d:	ff ff ff 
+  8014a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014a4:	ff d0                	call   *%rax
+  8014a6:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8014a9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8014ac:	48 63 d0             	movslq %eax,%rdx
+  8014af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014b3:	48 01 c2             	add    %rax,%rdx
+  8014b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014ba:	48 89 c6             	mov    %rax,%rsi
+  8014bd:	48 89 d7             	mov    %rdx,%rdi
+  8014c0:	48 b8 d3 83 ff ff ff 	movabs $0xffffffffffff83d3,%rax
+  8014c7:	ff ff ff 
+  8014ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014ce:	ff d0                	call   *%rax
+	return dst;
+  8014d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8014d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014d8:	c9                   	leave
+  8014d9:	c3                   	ret
+
+00000000008014da <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8014da:	55                   	push   %rbp
+  8014db:	48 89 e5             	mov    %rsp,%rbp
+  8014de:	48 83 ec 28          	sub    $0x28,%rsp
+  8014e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014e2 <strncpy+0x8>
+  8014e9:	49 bb 5e 7b 00 00 00 	movabs $0x7b5e,%r11
+  8014f0:	00 00 00 
+  8014f3:	4c 01 d8             	add    %r11,%rax
+  8014f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014fa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014fe:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801502:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801506:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80150a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801511:	00 
+  801512:	eb 2a                	jmp    80153e <strncpy+0x64>
+		*dst++ = *src;
+  801514:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801518:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80151c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801520:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801524:	0f b6 12             	movzbl (%rdx),%edx
+  801527:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801529:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80152d:	0f b6 00             	movzbl (%rax),%eax
+  801530:	84 c0                	test   %al,%al
+  801532:	74 05                	je     801539 <strncpy+0x5f>
+			src++;
+  801534:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801539:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80153e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801542:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801546:	72 cc                	jb     801514 <strncpy+0x3a>
+	}
+	return ret;
+  801548:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80154c:	c9                   	leave
+  80154d:	c3                   	ret
+
+000000000080154e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80154e:	55                   	push   %rbp
+  80154f:	48 89 e5             	mov    %rsp,%rbp
+  801552:	48 83 ec 28          	sub    $0x28,%rsp
+  801556:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801556 <strlcpy+0x8>
+  80155d:	49 bb ea 7a 00 00 00 	movabs $0x7aea,%r11
+  801564:	00 00 00 
+  801567:	4c 01 d8             	add    %r11,%rax
+  80156a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80156e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801572:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801576:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80157a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80157e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801583:	74 3d                	je     8015c2 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801585:	eb 1d                	jmp    8015a4 <strlcpy+0x56>
+			*dst++ = *src++;
+  801587:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80158b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80158f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801593:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801597:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80159b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80159f:	0f b6 12             	movzbl (%rdx),%edx
+  8015a2:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8015a4:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8015a9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8015ae:	74 0b                	je     8015bb <strlcpy+0x6d>
+  8015b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b4:	0f b6 00             	movzbl (%rax),%eax
+  8015b7:	84 c0                	test   %al,%al
+  8015b9:	75 cc                	jne    801587 <strlcpy+0x39>
+		*dst = '\0';
+  8015bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015bf:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8015c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015c6:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8015ca:	c9                   	leave
+  8015cb:	c3                   	ret
+
+00000000008015cc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8015cc:	55                   	push   %rbp
+  8015cd:	48 89 e5             	mov    %rsp,%rbp
+  8015d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8015d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015d4 <strcmp+0x8>
+  8015db:	49 bb 6c 7a 00 00 00 	movabs $0x7a6c,%r11
+  8015e2:	00 00 00 
+  8015e5:	4c 01 d8             	add    %r11,%rax
+  8015e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015ec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8015f0:	eb 0a                	jmp    8015fc <strcmp+0x30>
+		p++, q++;
+  8015f2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015f7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8015fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801600:	0f b6 00             	movzbl (%rax),%eax
+  801603:	84 c0                	test   %al,%al
+  801605:	74 12                	je     801619 <strcmp+0x4d>
+  801607:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80160b:	0f b6 10             	movzbl (%rax),%edx
+  80160e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801612:	0f b6 00             	movzbl (%rax),%eax
+  801615:	38 c2                	cmp    %al,%dl
+  801617:	74 d9                	je     8015f2 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801619:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80161d:	0f b6 00             	movzbl (%rax),%eax
+  801620:	0f b6 d0             	movzbl %al,%edx
+  801623:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801627:	0f b6 00             	movzbl (%rax),%eax
+  80162a:	0f b6 c0             	movzbl %al,%eax
+  80162d:	29 c2                	sub    %eax,%edx
+  80162f:	89 d0                	mov    %edx,%eax
+}
+  801631:	c9                   	leave
+  801632:	c3                   	ret
+
+0000000000801633 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801633:	55                   	push   %rbp
+  801634:	48 89 e5             	mov    %rsp,%rbp
+  801637:	48 83 ec 18          	sub    $0x18,%rsp
+  80163b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80163b <strncmp+0x8>
+  801642:	49 bb 05 7a 00 00 00 	movabs $0x7a05,%r11
+  801649:	00 00 00 
+  80164c:	4c 01 d8             	add    %r11,%rax
+  80164f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801653:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801657:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80165b:	eb 0f                	jmp    80166c <strncmp+0x39>
+		n--, p++, q++;
+  80165d:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801662:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801667:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80166c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801671:	74 1d                	je     801690 <strncmp+0x5d>
+  801673:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801677:	0f b6 00             	movzbl (%rax),%eax
+  80167a:	84 c0                	test   %al,%al
+  80167c:	74 12                	je     801690 <strncmp+0x5d>
+  80167e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801682:	0f b6 10             	movzbl (%rax),%edx
+  801685:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801689:	0f b6 00             	movzbl (%rax),%eax
+  80168c:	38 c2                	cmp    %al,%dl
+  80168e:	74 cd                	je     80165d <strncmp+0x2a>
+	if (n == 0)
+  801690:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801695:	75 07                	jne    80169e <strncmp+0x6b>
+		return 0;
+  801697:	ba 00 00 00 00       	mov    $0x0,%edx
+  80169c:	eb 16                	jmp    8016b4 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80169e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a2:	0f b6 00             	movzbl (%rax),%eax
+  8016a5:	0f b6 d0             	movzbl %al,%edx
+  8016a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016ac:	0f b6 00             	movzbl (%rax),%eax
+  8016af:	0f b6 c0             	movzbl %al,%eax
+  8016b2:	29 c2                	sub    %eax,%edx
+}
+  8016b4:	89 d0                	mov    %edx,%eax
+  8016b6:	c9                   	leave
+  8016b7:	c3                   	ret
+
+00000000008016b8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8016b8:	55                   	push   %rbp
+  8016b9:	48 89 e5             	mov    %rsp,%rbp
+  8016bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8016c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016c0 <strchr+0x8>
+  8016c7:	49 bb 80 79 00 00 00 	movabs $0x7980,%r11
+  8016ce:	00 00 00 
+  8016d1:	4c 01 d8             	add    %r11,%rax
+  8016d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016d8:	89 f0                	mov    %esi,%eax
+  8016da:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8016dd:	eb 17                	jmp    8016f6 <strchr+0x3e>
+		if (*s == c)
+  8016df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016e3:	0f b6 00             	movzbl (%rax),%eax
+  8016e6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016e9:	75 06                	jne    8016f1 <strchr+0x39>
+			return (char *) s;
+  8016eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ef:	eb 15                	jmp    801706 <strchr+0x4e>
+	for (; *s; s++)
+  8016f1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016fa:	0f b6 00             	movzbl (%rax),%eax
+  8016fd:	84 c0                	test   %al,%al
+  8016ff:	75 de                	jne    8016df <strchr+0x27>
+	return 0;
+  801701:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801706:	c9                   	leave
+  801707:	c3                   	ret
+
+0000000000801708 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801708:	55                   	push   %rbp
+  801709:	48 89 e5             	mov    %rsp,%rbp
+  80170c:	48 83 ec 10          	sub    $0x10,%rsp
+  801710:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801710 <strfind+0x8>
+  801717:	49 bb 30 79 00 00 00 	movabs $0x7930,%r11
+  80171e:	00 00 00 
+  801721:	4c 01 d8             	add    %r11,%rax
+  801724:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801728:	89 f0                	mov    %esi,%eax
+  80172a:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80172d:	eb 11                	jmp    801740 <strfind+0x38>
+		if (*s == c)
+  80172f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801733:	0f b6 00             	movzbl (%rax),%eax
+  801736:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801739:	74 12                	je     80174d <strfind+0x45>
+	for (; *s; s++)
+  80173b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801740:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801744:	0f b6 00             	movzbl (%rax),%eax
+  801747:	84 c0                	test   %al,%al
+  801749:	75 e4                	jne    80172f <strfind+0x27>
+  80174b:	eb 01                	jmp    80174e <strfind+0x46>
+			break;
+  80174d:	90                   	nop
+	return (char *) s;
+  80174e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801752:	c9                   	leave
+  801753:	c3                   	ret
+
+0000000000801754 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801754:	55                   	push   %rbp
+  801755:	48 89 e5             	mov    %rsp,%rbp
+  801758:	48 83 ec 18          	sub    $0x18,%rsp
+  80175c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80175c <memset+0x8>
+  801763:	49 bb e4 78 00 00 00 	movabs $0x78e4,%r11
+  80176a:	00 00 00 
+  80176d:	4c 01 d8             	add    %r11,%rax
+  801770:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801774:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801777:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80177b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801780:	75 06                	jne    801788 <memset+0x34>
+		return v;
+  801782:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801786:	eb 69                	jmp    8017f1 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801788:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80178c:	83 e0 03             	and    $0x3,%eax
+  80178f:	48 85 c0             	test   %rax,%rax
+  801792:	75 48                	jne    8017dc <memset+0x88>
+  801794:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801798:	83 e0 03             	and    $0x3,%eax
+  80179b:	48 85 c0             	test   %rax,%rax
+  80179e:	75 3c                	jne    8017dc <memset+0x88>
+		c &= 0xFF;
+  8017a0:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8017a7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017aa:	c1 e0 18             	shl    $0x18,%eax
+  8017ad:	89 c2                	mov    %eax,%edx
+  8017af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017b2:	c1 e0 10             	shl    $0x10,%eax
+  8017b5:	09 c2                	or     %eax,%edx
+  8017b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017ba:	c1 e0 08             	shl    $0x8,%eax
+  8017bd:	09 d0                	or     %edx,%eax
+  8017bf:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8017c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c6:	48 c1 e8 02          	shr    $0x2,%rax
+  8017ca:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8017cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017d4:	48 89 d7             	mov    %rdx,%rdi
+  8017d7:	fc                   	cld
+  8017d8:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8017da:	eb 11                	jmp    8017ed <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8017dc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017e0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017e3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8017e7:	48 89 d7             	mov    %rdx,%rdi
+  8017ea:	fc                   	cld
+  8017eb:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8017ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017f1:	c9                   	leave
+  8017f2:	c3                   	ret
+
+00000000008017f3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8017f3:	55                   	push   %rbp
+  8017f4:	48 89 e5             	mov    %rsp,%rbp
+  8017f7:	48 83 ec 28          	sub    $0x28,%rsp
+  8017fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017fb <memmove+0x8>
+  801802:	49 bb 45 78 00 00 00 	movabs $0x7845,%r11
+  801809:	00 00 00 
+  80180c:	4c 01 d8             	add    %r11,%rax
+  80180f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801813:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801817:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80181b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80181f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801823:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801827:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80182b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80182f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801833:	0f 83 88 00 00 00    	jae    8018c1 <memmove+0xce>
+  801839:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80183d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801841:	48 01 d0             	add    %rdx,%rax
+  801844:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801848:	73 77                	jae    8018c1 <memmove+0xce>
+		s += n;
+  80184a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80184e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801852:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801856:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80185a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80185e:	83 e0 03             	and    $0x3,%eax
+  801861:	48 85 c0             	test   %rax,%rax
+  801864:	75 3b                	jne    8018a1 <memmove+0xae>
+  801866:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186a:	83 e0 03             	and    $0x3,%eax
+  80186d:	48 85 c0             	test   %rax,%rax
+  801870:	75 2f                	jne    8018a1 <memmove+0xae>
+  801872:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801876:	83 e0 03             	and    $0x3,%eax
+  801879:	48 85 c0             	test   %rax,%rax
+  80187c:	75 23                	jne    8018a1 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80187e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801882:	48 83 e8 04          	sub    $0x4,%rax
+  801886:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80188a:	48 83 ea 04          	sub    $0x4,%rdx
+  80188e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801892:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801896:	48 89 c7             	mov    %rax,%rdi
+  801899:	48 89 d6             	mov    %rdx,%rsi
+  80189c:	fd                   	std
+  80189d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80189f:	eb 1d                	jmp    8018be <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8018a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018a5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ad:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8018b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018b5:	48 89 d7             	mov    %rdx,%rdi
+  8018b8:	48 89 c1             	mov    %rax,%rcx
+  8018bb:	fd                   	std
+  8018bc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8018be:	fc                   	cld
+  8018bf:	eb 57                	jmp    801918 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8018c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018c5:	83 e0 03             	and    $0x3,%eax
+  8018c8:	48 85 c0             	test   %rax,%rax
+  8018cb:	75 36                	jne    801903 <memmove+0x110>
+  8018cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018d1:	83 e0 03             	and    $0x3,%eax
+  8018d4:	48 85 c0             	test   %rax,%rax
+  8018d7:	75 2a                	jne    801903 <memmove+0x110>
+  8018d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018dd:	83 e0 03             	and    $0x3,%eax
+  8018e0:	48 85 c0             	test   %rax,%rax
+  8018e3:	75 1e                	jne    801903 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8018e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018e9:	48 c1 e8 02          	shr    $0x2,%rax
+  8018ed:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8018f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018f8:	48 89 c7             	mov    %rax,%rdi
+  8018fb:	48 89 d6             	mov    %rdx,%rsi
+  8018fe:	fc                   	cld
+  8018ff:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801901:	eb 15                	jmp    801918 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801903:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801907:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80190b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80190f:	48 89 c7             	mov    %rax,%rdi
+  801912:	48 89 d6             	mov    %rdx,%rsi
+  801915:	fc                   	cld
+  801916:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801918:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80191c:	c9                   	leave
+  80191d:	c3                   	ret
+
+000000000080191e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80191e:	55                   	push   %rbp
+  80191f:	48 89 e5             	mov    %rsp,%rbp
+  801922:	48 83 ec 18          	sub    $0x18,%rsp
+  801926:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801926 <memcpy+0x8>
+  80192d:	49 bb 1a 77 00 00 00 	movabs $0x771a,%r11
+  801934:	00 00 00 
+  801937:	4c 01 d8             	add    %r11,%rax
+  80193a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80193e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801942:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801946:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80194a:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80194e:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801952:	48 89 cf             	mov    %rcx,%rdi
+  801955:	48 b9 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rcx
+  80195c:	ff ff ff 
+  80195f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801963:	ff d0                	call   *%rax
+}
+  801965:	c9                   	leave
+  801966:	c3                   	ret
+
+0000000000801967 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801967:	55                   	push   %rbp
+  801968:	48 89 e5             	mov    %rsp,%rbp
+  80196b:	48 83 ec 28          	sub    $0x28,%rsp
+  80196f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80196f <memcmp+0x8>
+  801976:	49 bb d1 76 00 00 00 	movabs $0x76d1,%r11
+  80197d:	00 00 00 
+  801980:	4c 01 d8             	add    %r11,%rax
+  801983:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801987:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80198b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80198f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801993:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801997:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80199b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80199f:	eb 34                	jmp    8019d5 <memcmp+0x6e>
+		if (*s1 != *s2)
+  8019a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a5:	0f b6 10             	movzbl (%rax),%edx
+  8019a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ac:	0f b6 00             	movzbl (%rax),%eax
+  8019af:	38 c2                	cmp    %al,%dl
+  8019b1:	74 18                	je     8019cb <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  8019b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b7:	0f b6 00             	movzbl (%rax),%eax
+  8019ba:	0f b6 d0             	movzbl %al,%edx
+  8019bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c1:	0f b6 00             	movzbl (%rax),%eax
+  8019c4:	0f b6 c0             	movzbl %al,%eax
+  8019c7:	29 c2                	sub    %eax,%edx
+  8019c9:	eb 20                	jmp    8019eb <memcmp+0x84>
+		s1++, s2++;
+  8019cb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019d0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8019d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019dd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8019e1:	48 85 c0             	test   %rax,%rax
+  8019e4:	75 bb                	jne    8019a1 <memcmp+0x3a>
+	}
+
+	return 0;
+  8019e6:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8019eb:	89 d0                	mov    %edx,%eax
+  8019ed:	c9                   	leave
+  8019ee:	c3                   	ret
+
+00000000008019ef <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8019ef:	55                   	push   %rbp
+  8019f0:	48 89 e5             	mov    %rsp,%rbp
+  8019f3:	48 83 ec 28          	sub    $0x28,%rsp
+  8019f7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019f7 <memfind+0x8>
+  8019fe:	49 bb 49 76 00 00 00 	movabs $0x7649,%r11
+  801a05:	00 00 00 
+  801a08:	4c 01 d8             	add    %r11,%rax
+  801a0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a0f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801a12:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801a16:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a1e:	48 01 d0             	add    %rdx,%rax
+  801a21:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801a25:	eb 13                	jmp    801a3a <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801a27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a2b:	0f b6 00             	movzbl (%rax),%eax
+  801a2e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801a31:	38 d0                	cmp    %dl,%al
+  801a33:	74 11                	je     801a46 <memfind+0x57>
+	for (; s < ends; s++)
+  801a35:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801a3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a3e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801a42:	72 e3                	jb     801a27 <memfind+0x38>
+  801a44:	eb 01                	jmp    801a47 <memfind+0x58>
+			break;
+  801a46:	90                   	nop
+	return (void *) s;
+  801a47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a4b:	c9                   	leave
+  801a4c:	c3                   	ret
+
+0000000000801a4d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801a4d:	55                   	push   %rbp
+  801a4e:	48 89 e5             	mov    %rsp,%rbp
+  801a51:	48 83 ec 38          	sub    $0x38,%rsp
+  801a55:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a55 <strtol+0x8>
+  801a5c:	49 bb eb 75 00 00 00 	movabs $0x75eb,%r11
+  801a63:	00 00 00 
+  801a66:	4c 01 d8             	add    %r11,%rax
+  801a69:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a6d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a71:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801a74:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801a7b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801a82:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801a83:	eb 05                	jmp    801a8a <strtol+0x3d>
+		s++;
+  801a85:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801a8a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a8e:	0f b6 00             	movzbl (%rax),%eax
+  801a91:	3c 20                	cmp    $0x20,%al
+  801a93:	74 f0                	je     801a85 <strtol+0x38>
+  801a95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a99:	0f b6 00             	movzbl (%rax),%eax
+  801a9c:	3c 09                	cmp    $0x9,%al
+  801a9e:	74 e5                	je     801a85 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801aa0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa4:	0f b6 00             	movzbl (%rax),%eax
+  801aa7:	3c 2b                	cmp    $0x2b,%al
+  801aa9:	75 07                	jne    801ab2 <strtol+0x65>
+		s++;
+  801aab:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ab0:	eb 17                	jmp    801ac9 <strtol+0x7c>
+	else if (*s == '-')
+  801ab2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ab6:	0f b6 00             	movzbl (%rax),%eax
+  801ab9:	3c 2d                	cmp    $0x2d,%al
+  801abb:	75 0c                	jne    801ac9 <strtol+0x7c>
+		s++, neg = 1;
+  801abd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ac2:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801ac9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801acd:	74 06                	je     801ad5 <strtol+0x88>
+  801acf:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801ad3:	75 28                	jne    801afd <strtol+0xb0>
+  801ad5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad9:	0f b6 00             	movzbl (%rax),%eax
+  801adc:	3c 30                	cmp    $0x30,%al
+  801ade:	75 1d                	jne    801afd <strtol+0xb0>
+  801ae0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae4:	48 83 c0 01          	add    $0x1,%rax
+  801ae8:	0f b6 00             	movzbl (%rax),%eax
+  801aeb:	3c 78                	cmp    $0x78,%al
+  801aed:	75 0e                	jne    801afd <strtol+0xb0>
+		s += 2, base = 16;
+  801aef:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801af4:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801afb:	eb 2c                	jmp    801b29 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801afd:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b01:	75 19                	jne    801b1c <strtol+0xcf>
+  801b03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b07:	0f b6 00             	movzbl (%rax),%eax
+  801b0a:	3c 30                	cmp    $0x30,%al
+  801b0c:	75 0e                	jne    801b1c <strtol+0xcf>
+		s++, base = 8;
+  801b0e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b13:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801b1a:	eb 0d                	jmp    801b29 <strtol+0xdc>
+	else if (base == 0)
+  801b1c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b20:	75 07                	jne    801b29 <strtol+0xdc>
+		base = 10;
+  801b22:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801b29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b2d:	0f b6 00             	movzbl (%rax),%eax
+  801b30:	3c 2f                	cmp    $0x2f,%al
+  801b32:	7e 1d                	jle    801b51 <strtol+0x104>
+  801b34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b38:	0f b6 00             	movzbl (%rax),%eax
+  801b3b:	3c 39                	cmp    $0x39,%al
+  801b3d:	7f 12                	jg     801b51 <strtol+0x104>
+			dig = *s - '0';
+  801b3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b43:	0f b6 00             	movzbl (%rax),%eax
+  801b46:	0f be c0             	movsbl %al,%eax
+  801b49:	83 e8 30             	sub    $0x30,%eax
+  801b4c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801b4f:	eb 4e                	jmp    801b9f <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801b51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b55:	0f b6 00             	movzbl (%rax),%eax
+  801b58:	3c 60                	cmp    $0x60,%al
+  801b5a:	7e 1d                	jle    801b79 <strtol+0x12c>
+  801b5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b60:	0f b6 00             	movzbl (%rax),%eax
+  801b63:	3c 7a                	cmp    $0x7a,%al
+  801b65:	7f 12                	jg     801b79 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801b67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b6b:	0f b6 00             	movzbl (%rax),%eax
+  801b6e:	0f be c0             	movsbl %al,%eax
+  801b71:	83 e8 57             	sub    $0x57,%eax
+  801b74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801b77:	eb 26                	jmp    801b9f <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801b79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b7d:	0f b6 00             	movzbl (%rax),%eax
+  801b80:	3c 40                	cmp    $0x40,%al
+  801b82:	7e 47                	jle    801bcb <strtol+0x17e>
+  801b84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b88:	0f b6 00             	movzbl (%rax),%eax
+  801b8b:	3c 5a                	cmp    $0x5a,%al
+  801b8d:	7f 3c                	jg     801bcb <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801b8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b93:	0f b6 00             	movzbl (%rax),%eax
+  801b96:	0f be c0             	movsbl %al,%eax
+  801b99:	83 e8 37             	sub    $0x37,%eax
+  801b9c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801b9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ba2:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ba5:	7d 23                	jge    801bca <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801ba7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bac:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801baf:	48 98                	cltq
+  801bb1:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801bb6:	48 89 c2             	mov    %rax,%rdx
+  801bb9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801bbc:	48 98                	cltq
+  801bbe:	48 01 d0             	add    %rdx,%rax
+  801bc1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801bc5:	e9 5f ff ff ff       	jmp    801b29 <strtol+0xdc>
+			break;
+  801bca:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801bcb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801bd0:	74 0b                	je     801bdd <strtol+0x190>
+		*endptr = (char *) s;
+  801bd2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bd6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801bda:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801bdd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801be1:	74 09                	je     801bec <strtol+0x19f>
+  801be3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be7:	48 f7 d8             	neg    %rax
+  801bea:	eb 04                	jmp    801bf0 <strtol+0x1a3>
+  801bec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801bf0:	c9                   	leave
+  801bf1:	c3                   	ret
+
+0000000000801bf2 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801bf2:	55                   	push   %rbp
+  801bf3:	48 89 e5             	mov    %rsp,%rbp
+  801bf6:	53                   	push   %rbx
+  801bf7:	48 83 ec 30          	sub    $0x30,%rsp
+  801bfb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801bfb <strstr+0x9>
+  801c02:	49 bb 45 74 00 00 00 	movabs $0x7445,%r11
+  801c09:	00 00 00 
+  801c0c:	4c 01 db             	add    %r11,%rbx
+  801c0f:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801c13:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801c17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c1b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c1f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c23:	0f b6 00             	movzbl (%rax),%eax
+  801c26:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801c29:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801c2d:	75 06                	jne    801c35 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801c2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c33:	eb 73                	jmp    801ca8 <strstr+0xb6>
+
+	len = strlen(str);
+  801c35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c39:	48 89 c7             	mov    %rax,%rdi
+  801c3c:	48 b8 3f 83 ff ff ff 	movabs $0xffffffffffff833f,%rax
+  801c43:	ff ff ff 
+  801c46:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c4a:	ff d0                	call   *%rax
+  801c4c:	48 98                	cltq
+  801c4e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801c52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c56:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c5a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801c5e:	0f b6 00             	movzbl (%rax),%eax
+  801c61:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801c64:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801c68:	75 07                	jne    801c71 <strstr+0x7f>
+				return (char *) 0;
+  801c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6f:	eb 37                	jmp    801ca8 <strstr+0xb6>
+		} while (sc != c);
+  801c71:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801c75:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801c78:	75 d8                	jne    801c52 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801c7a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c7e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c82:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c86:	48 89 ce             	mov    %rcx,%rsi
+  801c89:	48 89 c7             	mov    %rax,%rdi
+  801c8c:	48 b8 f3 85 ff ff ff 	movabs $0xffffffffffff85f3,%rax
+  801c93:	ff ff ff 
+  801c96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c9a:	ff d0                	call   *%rax
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	75 b2                	jne    801c52 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801ca0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ca4:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801ca8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801cac:	c9                   	leave
+  801cad:	c3                   	ret
+
+0000000000801cae <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801cae:	55                   	push   %rbp
+  801caf:	48 89 e5             	mov    %rsp,%rbp
+  801cb2:	41 57                	push   %r15
+  801cb4:	53                   	push   %rbx
+  801cb5:	48 83 ec 40          	sub    $0x40,%rsp
+  801cb9:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801cb9 <syscall+0xb>
+  801cc0:	49 bb 87 73 00 00 00 	movabs $0x7387,%r11
+  801cc7:	00 00 00 
+  801cca:	4d 01 da             	add    %r11,%r10
+  801ccd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801cd0:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801cd3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801cd7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801cdb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801cdf:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801ce3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ce6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801cea:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801cee:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801cf2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801cf6:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801cfa:	4c 89 c3             	mov    %r8,%rbx
+  801cfd:	cd 30                	int    $0x30
+  801cff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801d03:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801d07:	74 52                	je     801d5b <syscall+0xad>
+  801d09:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801d0e:	7e 4b                	jle    801d5b <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d10:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d14:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d17:	49 89 d0             	mov    %rdx,%r8
+  801d1a:	89 c1                	mov    %eax,%ecx
+  801d1c:	48 b8 20 e3 ff ff ff 	movabs $0xffffffffffffe320,%rax
+  801d23:	ff ff ff 
+  801d26:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801d2a:	48 89 c2             	mov    %rax,%rdx
+  801d2d:	be 23 00 00 00       	mov    $0x23,%esi
+  801d32:	48 b8 3d e3 ff ff ff 	movabs $0xffffffffffffe33d,%rax
+  801d39:	ff ff ff 
+  801d3c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801d40:	48 89 c7             	mov    %rax,%rdi
+  801d43:	4d 89 d7             	mov    %r10,%r15
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4b:	49 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%r9
+  801d52:	ff ff ff 
+  801d55:	4d 01 d1             	add    %r10,%r9
+  801d58:	41 ff d1             	call   *%r9
+
+	return ret;
+  801d5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d5f:	48 83 c4 40          	add    $0x40,%rsp
+  801d63:	5b                   	pop    %rbx
+  801d64:	41 5f                	pop    %r15
+  801d66:	5d                   	pop    %rbp
+  801d67:	c3                   	ret
+
+0000000000801d68 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801d68:	55                   	push   %rbp
+  801d69:	48 89 e5             	mov    %rsp,%rbp
+  801d6c:	41 57                	push   %r15
+  801d6e:	41 56                	push   %r14
+  801d70:	41 55                	push   %r13
+  801d72:	41 54                	push   %r12
+  801d74:	53                   	push   %rbx
+  801d75:	48 83 ec 48          	sub    $0x48,%rsp
+  801d79:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801d79 <syscall_words+0x11>
+  801d80:	49 bb c7 72 00 00 00 	movabs $0x72c7,%r11
+  801d87:	00 00 00 
+  801d8a:	4d 01 de             	add    %r11,%r14
+  801d8d:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801d90:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801d93:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801d97:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801d9b:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801d9f:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801da3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801da8:	74 09                	je     801db3 <syscall_words+0x4b>
+  801daa:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dae:	48 8b 00             	mov    (%rax),%rax
+  801db1:	eb 05                	jmp    801db8 <syscall_words+0x50>
+  801db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db8:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801dbb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dc0:	74 0a                	je     801dcc <syscall_words+0x64>
+  801dc2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dc6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801dca:	eb 05                	jmp    801dd1 <syscall_words+0x69>
+  801dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd1:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801dd4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dd9:	74 0a                	je     801de5 <syscall_words+0x7d>
+  801ddb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ddf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801de3:	eb 05                	jmp    801dea <syscall_words+0x82>
+  801de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dea:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801ded:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801df2:	74 0a                	je     801dfe <syscall_words+0x96>
+  801df4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801df8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801dfc:	eb 05                	jmp    801e03 <syscall_words+0x9b>
+  801dfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e03:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801e06:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e0b:	74 0a                	je     801e17 <syscall_words+0xaf>
+  801e0d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e11:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e15:	eb 05                	jmp    801e1c <syscall_words+0xb4>
+  801e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1c:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801e1f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e24:	74 0a                	je     801e30 <syscall_words+0xc8>
+  801e26:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e2a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801e2e:	eb 05                	jmp    801e35 <syscall_words+0xcd>
+  801e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e35:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801e38:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801e3b:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801e3f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801e43:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801e47:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801e4b:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e4f:	cd 30                	int    $0x30
+  801e51:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801e55:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e5a:	74 50                	je     801eac <syscall_words+0x144>
+		words[0] = r8;
+  801e5c:	4c 89 c2             	mov    %r8,%rdx
+  801e5f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e63:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801e66:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e6a:	48 83 c0 08          	add    $0x8,%rax
+  801e6e:	4c 89 ca             	mov    %r9,%rdx
+  801e71:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801e74:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e78:	48 83 c0 10          	add    $0x10,%rax
+  801e7c:	4c 89 d2             	mov    %r10,%rdx
+  801e7f:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801e82:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e86:	48 83 c0 18          	add    $0x18,%rax
+  801e8a:	4c 89 da             	mov    %r11,%rdx
+  801e8d:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801e90:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e94:	48 83 c0 20          	add    $0x20,%rax
+  801e98:	4c 89 e2             	mov    %r12,%rdx
+  801e9b:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801e9e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ea2:	48 83 c0 28          	add    $0x28,%rax
+  801ea6:	4c 89 ea             	mov    %r13,%rdx
+  801ea9:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801eac:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801eb0:	74 52                	je     801f04 <syscall_words+0x19c>
+  801eb2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801eb7:	7e 4b                	jle    801f04 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801eb9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ebd:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801ec0:	49 89 d0             	mov    %rdx,%r8
+  801ec3:	89 c1                	mov    %eax,%ecx
+  801ec5:	48 b8 20 e3 ff ff ff 	movabs $0xffffffffffffe320,%rax
+  801ecc:	ff ff ff 
+  801ecf:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801ed3:	48 89 c2             	mov    %rax,%rdx
+  801ed6:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801edb:	48 b8 3d e3 ff ff ff 	movabs $0xffffffffffffe33d,%rax
+  801ee2:	ff ff ff 
+  801ee5:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801ee9:	48 89 c7             	mov    %rax,%rdi
+  801eec:	4d 89 f7             	mov    %r14,%r15
+  801eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef4:	49 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%r9
+  801efb:	ff ff ff 
+  801efe:	4d 01 f1             	add    %r14,%r9
+  801f01:	41 ff d1             	call   *%r9
+
+	return ret;
+  801f04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801f08:	48 83 c4 48          	add    $0x48,%rsp
+  801f0c:	5b                   	pop    %rbx
+  801f0d:	41 5c                	pop    %r12
+  801f0f:	41 5d                	pop    %r13
+  801f11:	41 5e                	pop    %r14
+  801f13:	41 5f                	pop    %r15
+  801f15:	5d                   	pop    %rbp
+  801f16:	c3                   	ret
+
+0000000000801f17 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801f17:	55                   	push   %rbp
+  801f18:	48 89 e5             	mov    %rsp,%rbp
+  801f1b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f1f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f1f <sys_cputs+0x8>
+  801f26:	49 bb 21 71 00 00 00 	movabs $0x7121,%r11
+  801f2d:	00 00 00 
+  801f30:	4c 01 d8             	add    %r11,%rax
+  801f33:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f37:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801f3b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f3f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f43:	48 83 ec 08          	sub    $0x8,%rsp
+  801f47:	6a 00                	push   $0x0
+  801f49:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f55:	be 00 00 00 00       	mov    $0x0,%esi
+  801f5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f5f:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  801f66:	ff ff ff 
+  801f69:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f6d:	ff d0                	call   *%rax
+  801f6f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f73:	90                   	nop
+  801f74:	c9                   	leave
+  801f75:	c3                   	ret
+
+0000000000801f76 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801f76:	55                   	push   %rbp
+  801f77:	48 89 e5             	mov    %rsp,%rbp
+  801f7a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f7a <sys_cgetc+0x4>
+  801f81:	49 bb c6 70 00 00 00 	movabs $0x70c6,%r11
+  801f88:	00 00 00 
+  801f8b:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801f8e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f92:	6a 00                	push   $0x0
+  801f94:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801faa:	be 00 00 00 00       	mov    $0x0,%esi
+  801faf:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fb4:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  801fbb:	ff ff ff 
+  801fbe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fc2:	ff d0                	call   *%rax
+  801fc4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fc8:	c9                   	leave
+  801fc9:	c3                   	ret
+
+0000000000801fca <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801fca:	55                   	push   %rbp
+  801fcb:	48 89 e5             	mov    %rsp,%rbp
+  801fce:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fd2 <sys_env_destroy+0x8>
+  801fd9:	49 bb 6e 70 00 00 00 	movabs $0x706e,%r11
+  801fe0:	00 00 00 
+  801fe3:	4c 01 d8             	add    %r11,%rax
+  801fe6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801fe9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fec:	48 63 d2             	movslq %edx,%rdx
+  801fef:	48 83 ec 08          	sub    $0x8,%rsp
+  801ff3:	6a 00                	push   $0x0
+  801ff5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ffb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802001:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802006:	be 01 00 00 00       	mov    $0x1,%esi
+  80200b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802010:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  802017:	ff ff ff 
+  80201a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80201e:	ff d0                	call   *%rax
+  802020:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802024:	c9                   	leave
+  802025:	c3                   	ret
+
+0000000000802026 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802026:	55                   	push   %rbp
+  802027:	48 89 e5             	mov    %rsp,%rbp
+  80202a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80202a <sys_getenvid+0x4>
+  802031:	49 bb 16 70 00 00 00 	movabs $0x7016,%r11
+  802038:	00 00 00 
+  80203b:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80203e:	48 83 ec 08          	sub    $0x8,%rsp
+  802042:	6a 00                	push   $0x0
+  802044:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80204a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802050:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802055:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205a:	be 00 00 00 00       	mov    $0x0,%esi
+  80205f:	bf 02 00 00 00       	mov    $0x2,%edi
+  802064:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  80206b:	ff ff ff 
+  80206e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802072:	ff d0                	call   *%rax
+  802074:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802078:	c9                   	leave
+  802079:	c3                   	ret
+
+000000000080207a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80207a:	55                   	push   %rbp
+  80207b:	48 89 e5             	mov    %rsp,%rbp
+  80207e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80207e <sys_yield+0x4>
+  802085:	49 bb c2 6f 00 00 00 	movabs $0x6fc2,%r11
+  80208c:	00 00 00 
+  80208f:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802092:	48 83 ec 08          	sub    $0x8,%rsp
+  802096:	6a 00                	push   $0x0
+  802098:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80209e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b3:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8020b8:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  8020bf:	ff ff ff 
+  8020c2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020c6:	ff d0                	call   *%rax
+  8020c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020cc:	90                   	nop
+  8020cd:	c9                   	leave
+  8020ce:	c3                   	ret
+
+00000000008020cf <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8020cf:	55                   	push   %rbp
+  8020d0:	48 89 e5             	mov    %rsp,%rbp
+  8020d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8020d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020d7 <sys_page_alloc+0x8>
+  8020de:	49 bb 69 6f 00 00 00 	movabs $0x6f69,%r11
+  8020e5:	00 00 00 
+  8020e8:	4c 01 d8             	add    %r11,%rax
+  8020eb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020f2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8020f5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020f8:	48 63 f2             	movslq %edx,%rsi
+  8020fb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020ff:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802102:	48 63 d2             	movslq %edx,%rdx
+  802105:	48 83 ec 08          	sub    $0x8,%rsp
+  802109:	6a 00                	push   $0x0
+  80210b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802111:	49 89 f0             	mov    %rsi,%r8
+  802114:	be 01 00 00 00       	mov    $0x1,%esi
+  802119:	bf 04 00 00 00       	mov    $0x4,%edi
+  80211e:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  802125:	ff ff ff 
+  802128:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80212c:	ff d0                	call   *%rax
+  80212e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802132:	c9                   	leave
+  802133:	c3                   	ret
+
+0000000000802134 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802134:	55                   	push   %rbp
+  802135:	48 89 e5             	mov    %rsp,%rbp
+  802138:	48 83 ec 20          	sub    $0x20,%rsp
+  80213c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80213c <sys_page_map+0x8>
+  802143:	49 bb 04 6f 00 00 00 	movabs $0x6f04,%r11
+  80214a:	00 00 00 
+  80214d:	4c 01 d8             	add    %r11,%rax
+  802150:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802153:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802157:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80215a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80215e:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802162:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802165:	48 63 f2             	movslq %edx,%rsi
+  802168:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80216c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80216f:	48 63 fa             	movslq %edx,%rdi
+  802172:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802176:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802179:	48 63 d2             	movslq %edx,%rdx
+  80217c:	48 83 ec 08          	sub    $0x8,%rsp
+  802180:	56                   	push   %rsi
+  802181:	4d 89 c1             	mov    %r8,%r9
+  802184:	49 89 f8             	mov    %rdi,%r8
+  802187:	be 01 00 00 00       	mov    $0x1,%esi
+  80218c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802191:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  802198:	ff ff ff 
+  80219b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80219f:	ff d0                	call   *%rax
+  8021a1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021a5:	c9                   	leave
+  8021a6:	c3                   	ret
+
+00000000008021a7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8021a7:	55                   	push   %rbp
+  8021a8:	48 89 e5             	mov    %rsp,%rbp
+  8021ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8021af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021af <sys_page_unmap+0x8>
+  8021b6:	49 bb 91 6e 00 00 00 	movabs $0x6e91,%r11
+  8021bd:	00 00 00 
+  8021c0:	4c 01 d8             	add    %r11,%rax
+  8021c3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8021ca:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021ce:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021d1:	48 63 d2             	movslq %edx,%rdx
+  8021d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8021d8:	6a 00                	push   $0x0
+  8021da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8021eb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021f0:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  8021f7:	ff ff ff 
+  8021fa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021fe:	ff d0                	call   *%rax
+  802200:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802204:	c9                   	leave
+  802205:	c3                   	ret
+
+0000000000802206 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802206:	55                   	push   %rbp
+  802207:	48 89 e5             	mov    %rsp,%rbp
+  80220a:	48 83 ec 10          	sub    $0x10,%rsp
+  80220e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80220e <sys_env_set_status+0x8>
+  802215:	49 bb 32 6e 00 00 00 	movabs $0x6e32,%r11
+  80221c:	00 00 00 
+  80221f:	4c 01 d8             	add    %r11,%rax
+  802222:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802225:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802228:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80222b:	48 63 ca             	movslq %edx,%rcx
+  80222e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802231:	48 63 d2             	movslq %edx,%rdx
+  802234:	48 83 ec 08          	sub    $0x8,%rsp
+  802238:	6a 00                	push   $0x0
+  80223a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802246:	be 01 00 00 00       	mov    $0x1,%esi
+  80224b:	bf 08 00 00 00       	mov    $0x8,%edi
+  802250:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  802257:	ff ff ff 
+  80225a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80225e:	ff d0                	call   *%rax
+  802260:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802264:	c9                   	leave
+  802265:	c3                   	ret
+
+0000000000802266 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802266:	55                   	push   %rbp
+  802267:	48 89 e5             	mov    %rsp,%rbp
+  80226a:	48 83 ec 10          	sub    $0x10,%rsp
+  80226e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80226e <sys_env_set_trapframe+0x8>
+  802275:	49 bb d2 6d 00 00 00 	movabs $0x6dd2,%r11
+  80227c:	00 00 00 
+  80227f:	4c 01 d8             	add    %r11,%rax
+  802282:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802285:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802289:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80228d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802290:	48 63 d2             	movslq %edx,%rdx
+  802293:	48 83 ec 08          	sub    $0x8,%rsp
+  802297:	6a 00                	push   $0x0
+  802299:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80229f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8022aa:	bf 09 00 00 00       	mov    $0x9,%edi
+  8022af:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  8022b6:	ff ff ff 
+  8022b9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022bd:	ff d0                	call   *%rax
+  8022bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c3:	c9                   	leave
+  8022c4:	c3                   	ret
+
+00000000008022c5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8022c5:	55                   	push   %rbp
+  8022c6:	48 89 e5             	mov    %rsp,%rbp
+  8022c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8022cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022cd <sys_env_set_pgfault_upcall+0x8>
+  8022d4:	49 bb 73 6d 00 00 00 	movabs $0x6d73,%r11
+  8022db:	00 00 00 
+  8022de:	4c 01 d8             	add    %r11,%rax
+  8022e1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022e4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8022e8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022ec:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022ef:	48 63 d2             	movslq %edx,%rdx
+  8022f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8022f6:	6a 00                	push   $0x0
+  8022f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802304:	be 01 00 00 00       	mov    $0x1,%esi
+  802309:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80230e:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  802315:	ff ff ff 
+  802318:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80231c:	ff d0                	call   *%rax
+  80231e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802322:	c9                   	leave
+  802323:	c3                   	ret
+
+0000000000802324 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802324:	55                   	push   %rbp
+  802325:	48 89 e5             	mov    %rsp,%rbp
+  802328:	48 83 ec 20          	sub    $0x20,%rsp
+  80232c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80232c <sys_ipc_try_send+0x8>
+  802333:	49 bb 14 6d 00 00 00 	movabs $0x6d14,%r11
+  80233a:	00 00 00 
+  80233d:	4c 01 d8             	add    %r11,%rax
+  802340:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802343:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802347:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80234b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80234e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802351:	48 63 fa             	movslq %edx,%rdi
+  802354:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802358:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80235b:	48 63 d2             	movslq %edx,%rdx
+  80235e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802362:	48 83 ec 08          	sub    $0x8,%rsp
+  802366:	6a 00                	push   $0x0
+  802368:	49 89 f9             	mov    %rdi,%r9
+  80236b:	49 89 f0             	mov    %rsi,%r8
+  80236e:	be 00 00 00 00       	mov    $0x0,%esi
+  802373:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802378:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  80237f:	ff ff ff 
+  802382:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802386:	ff d0                	call   *%rax
+  802388:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80238c:	c9                   	leave
+  80238d:	c3                   	ret
+
+000000000080238e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80238e:	55                   	push   %rbp
+  80238f:	48 89 e5             	mov    %rsp,%rbp
+  802392:	48 83 ec 20          	sub    $0x20,%rsp
+  802396:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802396 <sys_ipc_send+0x8>
+  80239d:	49 bb aa 6c 00 00 00 	movabs $0x6caa,%r11
+  8023a4:	00 00 00 
+  8023a7:	4c 01 d8             	add    %r11,%rax
+  8023aa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023ad:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023b1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023b5:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8023b8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023bb:	48 63 fa             	movslq %edx,%rdi
+  8023be:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8023c2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023c5:	48 63 d2             	movslq %edx,%rdx
+  8023c8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d0:	6a 00                	push   $0x0
+  8023d2:	49 89 f9             	mov    %rdi,%r9
+  8023d5:	49 89 f0             	mov    %rsi,%r8
+  8023d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8023dd:	bf 17 00 00 00       	mov    $0x17,%edi
+  8023e2:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  8023e9:	ff ff ff 
+  8023ec:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023f0:	ff d0                	call   *%rax
+  8023f2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023f6:	c9                   	leave
+  8023f7:	c3                   	ret
+
+00000000008023f8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8023f8:	55                   	push   %rbp
+  8023f9:	48 89 e5             	mov    %rsp,%rbp
+  8023fc:	48 83 ec 10          	sub    $0x10,%rsp
+  802400:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802400 <sys_ipc_recv+0x8>
+  802407:	49 bb 40 6c 00 00 00 	movabs $0x6c40,%r11
+  80240e:	00 00 00 
+  802411:	4c 01 d8             	add    %r11,%rax
+  802414:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802418:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80241c:	6a 00                	push   $0x0
+  80241e:	6a 00                	push   $0x0
+  802420:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802426:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80242c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802431:	be 01 00 00 00       	mov    $0x1,%esi
+  802436:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80243b:	49 ba 28 8d ff ff ff 	movabs $0xffffffffffff8d28,%r10
+  802442:	ff ff ff 
+  802445:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802449:	ff d0                	call   *%rax
+  80244b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80244f:	c9                   	leave
+  802450:	c3                   	ret
+
+0000000000802451 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802451:	55                   	push   %rbp
+  802452:	48 89 e5             	mov    %rsp,%rbp
+  802455:	48 83 ec 30          	sub    $0x30,%rsp
+  802459:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802459 <sys_ipc_call+0x8>
+  802460:	49 bb e7 6b 00 00 00 	movabs $0x6be7,%r11
+  802467:	00 00 00 
+  80246a:	4c 01 d8             	add    %r11,%rax
+  80246d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802470:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802474:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802478:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80247b:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80247f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802483:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802487:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80248a:	4c 63 c2             	movslq %edx,%r8
+  80248d:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802491:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802494:	48 63 d2             	movslq %edx,%rdx
+  802497:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80249b:	ff 75 d8             	push   -0x28(%rbp)
+  80249e:	56                   	push   %rsi
+  80249f:	4d 89 c1             	mov    %r8,%r9
+  8024a2:	49 89 f8             	mov    %rdi,%r8
+  8024a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8024aa:	bf 18 00 00 00       	mov    $0x18,%edi
+  8024af:	49 ba 28 8d ff ff ff 	movabs $0xffffffffffff8d28,%r10
+  8024b6:	ff ff ff 
+  8024b9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024bd:	ff d0                	call   *%rax
+  8024bf:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8024c3:	c9                   	leave
+  8024c4:	c3                   	ret
+
+00000000008024c5 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8024c5:	55                   	push   %rbp
+  8024c6:	48 89 e5             	mov    %rsp,%rbp
+  8024c9:	48 83 ec 30          	sub    $0x30,%rsp
+  8024cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024cd <sys_ipc_reply_recv+0x8>
+  8024d4:	49 bb 73 6b 00 00 00 	movabs $0x6b73,%r11
+  8024db:	00 00 00 
+  8024de:	4c 01 d8             	add    %r11,%rax
+  8024e1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024e4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024e8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024ec:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8024ef:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8024f3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8024f7:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8024fb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024fe:	4c 63 c2             	movslq %edx,%r8
+  802501:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802505:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802508:	48 63 d2             	movslq %edx,%rdx
+  80250b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80250f:	ff 75 d8             	push   -0x28(%rbp)
+  802512:	56                   	push   %rsi
+  802513:	4d 89 c1             	mov    %r8,%r9
+  802516:	49 89 f8             	mov    %rdi,%r8
+  802519:	be 00 00 00 00       	mov    $0x0,%esi
+  80251e:	bf 19 00 00 00       	mov    $0x19,%edi
+  802523:	49 ba 28 8d ff ff ff 	movabs $0xffffffffffff8d28,%r10
+  80252a:	ff ff ff 
+  80252d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802531:	ff d0                	call   *%rax
+  802533:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802537:	c9                   	leave
+  802538:	c3                   	ret
+
+0000000000802539 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802539:	55                   	push   %rbp
+  80253a:	48 89 e5             	mov    %rsp,%rbp
+  80253d:	48 83 ec 10          	sub    $0x10,%rsp
+  802541:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802541 <sys_env_set_priority+0x8>
+  802548:	49 bb ff 6a 00 00 00 	movabs $0x6aff,%r11
+  80254f:	00 00 00 
+  802552:	4c 01 d8             	add    %r11,%rax
+  802555:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802558:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80255b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80255e:	48 63 ca             	movslq %edx,%rcx
+  802561:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802564:	48 63 d2             	movslq %edx,%rdx
+  802567:	48 83 ec 08          	sub    $0x8,%rsp
+  80256b:	6a 00                	push   $0x0
+  80256d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802573:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802579:	be 01 00 00 00       	mov    $0x1,%esi
+  80257e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802583:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  80258a:	ff ff ff 
+  80258d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802591:	ff d0                	call   *%rax
+  802593:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802597:	c9                   	leave
+  802598:	c3                   	ret
+
+0000000000802599 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802599:	55                   	push   %rbp
+  80259a:	48 89 e5             	mov    %rsp,%rbp
+  80259d:	48 83 ec 10          	sub    $0x10,%rsp
+  8025a1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025a1 <sys_env_set_affinity+0x8>
+  8025a8:	49 bb 9f 6a 00 00 00 	movabs $0x6a9f,%r11
+  8025af:	00 00 00 
+  8025b2:	4c 01 d8             	add    %r11,%rax
+  8025b5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025b8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8025bb:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8025be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025c1:	48 63 d2             	movslq %edx,%rdx
+  8025c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c8:	6a 00                	push   $0x0
+  8025ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8025db:	bf 10 00 00 00       	mov    $0x10,%edi
+  8025e0:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  8025e7:	ff ff ff 
+  8025ea:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025ee:	ff d0                	call   *%rax
+  8025f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f4:	c9                   	leave
+  8025f5:	c3                   	ret
+
+00000000008025f6 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8025f6:	55                   	push   %rbp
+  8025f7:	48 89 e5             	mov    %rsp,%rbp
+  8025fa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025fa <sys_time_msec+0x4>
+  802601:	49 bb 46 6a 00 00 00 	movabs $0x6a46,%r11
+  802608:	00 00 00 
+  80260b:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80260e:	48 83 ec 08          	sub    $0x8,%rsp
+  802612:	6a 00                	push   $0x0
+  802614:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80261a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802625:	ba 00 00 00 00       	mov    $0x0,%edx
+  80262a:	be 00 00 00 00       	mov    $0x0,%esi
+  80262f:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802634:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  80263b:	ff ff ff 
+  80263e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802642:	ff d0                	call   *%rax
+  802644:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802648:	c9                   	leave
+  802649:	c3                   	ret
+
+000000000080264a <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80264a:	55                   	push   %rbp
+  80264b:	48 89 e5             	mov    %rsp,%rbp
+  80264e:	48 83 ec 10          	sub    $0x10,%rsp
+  802652:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802652 <sys_sleep_usec+0x8>
+  802659:	49 bb ee 69 00 00 00 	movabs $0x69ee,%r11
+  802660:	00 00 00 
+  802663:	4c 01 d8             	add    %r11,%rax
+  802666:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80266a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80266e:	48 83 ec 08          	sub    $0x8,%rsp
+  802672:	6a 00                	push   $0x0
+  802674:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80267a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802685:	be 00 00 00 00       	mov    $0x0,%esi
+  80268a:	bf 11 00 00 00       	mov    $0x11,%edi
+  80268f:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  802696:	ff ff ff 
+  802699:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80269d:	ff d0                	call   *%rax
+  80269f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026a3:	c9                   	leave
+  8026a4:	c3                   	ret
+
+00000000008026a5 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8026a5:	55                   	push   %rbp
+  8026a6:	48 89 e5             	mov    %rsp,%rbp
+  8026a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8026ad:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026ad <sys_page_alloc_huge+0x8>
+  8026b4:	49 bb 93 69 00 00 00 	movabs $0x6993,%r11
+  8026bb:	00 00 00 
+  8026be:	4c 01 d8             	add    %r11,%rax
+  8026c1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026c8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8026cb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026ce:	48 63 f2             	movslq %edx,%rsi
+  8026d1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026d5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026d8:	48 63 d2             	movslq %edx,%rdx
+  8026db:	48 83 ec 08          	sub    $0x8,%rsp
+  8026df:	6a 00                	push   $0x0
+  8026e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026e7:	49 89 f0             	mov    %rsi,%r8
+  8026ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8026ef:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026f4:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  8026fb:	ff ff ff 
+  8026fe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802702:	ff d0                	call   *%rax
+  802704:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802708:	c9                   	leave
+  802709:	c3                   	ret
+
+000000000080270a <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80270a:	55                   	push   %rbp
+  80270b:	48 89 e5             	mov    %rsp,%rbp
+  80270e:	48 83 ec 10          	sub    $0x10,%rsp
+  802712:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802712 <sys_page_map_batch+0x8>
+  802719:	49 bb 2e 69 00 00 00 	movabs $0x692e,%r11
+  802720:	00 00 00 
+  802723:	4c 01 d8             	add    %r11,%rax
+  802726:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80272a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80272e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802732:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802736:	48 83 ec 08          	sub    $0x8,%rsp
+  80273a:	6a 00                	push   $0x0
+  80273c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802742:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802748:	be 01 00 00 00       	mov    $0x1,%esi
+  80274d:	bf 13 00 00 00       	mov    $0x13,%edi
+  802752:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  802759:	ff ff ff 
+  80275c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802760:	ff d0                	call   *%rax
+  802762:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802766:	c9                   	leave
+  802767:	c3                   	ret
+
+0000000000802768 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802768:	55                   	push   %rbp
+  802769:	48 89 e5             	mov    %rsp,%rbp
+  80276c:	48 83 ec 10          	sub    $0x10,%rsp
+  802770:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802770 <sys_page_alloc_batch+0x8>
+  802777:	49 bb d0 68 00 00 00 	movabs $0x68d0,%r11
+  80277e:	00 00 00 
+  802781:	4c 01 d8             	add    %r11,%rax
+  802784:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802788:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80278c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802790:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802794:	48 83 ec 08          	sub    $0x8,%rsp
+  802798:	6a 00                	push   $0x0
+  80279a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8027ab:	bf 14 00 00 00       	mov    $0x14,%edi
+  8027b0:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  8027b7:	ff ff ff 
+  8027ba:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027be:	ff d0                	call   *%rax
+  8027c0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027c4:	c9                   	leave
+  8027c5:	c3                   	ret
+
+00000000008027c6 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8027c6:	55                   	push   %rbp
+  8027c7:	48 89 e5             	mov    %rsp,%rbp
+  8027ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8027ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027ce <sys_page_unmap_batch+0x8>
+  8027d5:	49 bb 72 68 00 00 00 	movabs $0x6872,%r11
+  8027dc:	00 00 00 
+  8027df:	4c 01 d8             	add    %r11,%rax
+  8027e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8027ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027ee:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f6:	6a 00                	push   $0x0
+  8027f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802804:	be 01 00 00 00       	mov    $0x1,%esi
+  802809:	bf 15 00 00 00       	mov    $0x15,%edi
+  80280e:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  802815:	ff ff ff 
+  802818:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80281c:	ff d0                	call   *%rax
+  80281e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802822:	c9                   	leave
+  802823:	c3                   	ret
+
+0000000000802824 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802824:	55                   	push   %rbp
+  802825:	48 89 e5             	mov    %rsp,%rbp
+  802828:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802828 <sys_fork+0x4>
+  80282f:	49 bb 18 68 00 00 00 	movabs $0x6818,%r11
+  802836:	00 00 00 
+  802839:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80283c:	48 83 ec 08          	sub    $0x8,%rsp
+  802840:	6a 00                	push   $0x0
+  802842:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802848:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80284e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802853:	ba 00 00 00 00       	mov    $0x0,%edx
+  802858:	be 00 00 00 00       	mov    $0x0,%esi
+  80285d:	bf 16 00 00 00       	mov    $0x16,%edi
+  802862:	49 ba 6e 8c ff ff ff 	movabs $0xffffffffffff8c6e,%r10
+  802869:	ff ff ff 
+  80286c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802870:	ff d0                	call   *%rax
+  802872:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802876:	c9                   	leave
+  802877:	c3                   	ret
+
+0000000000802878 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802878:	55                   	push   %rbp
+  802879:	48 89 e5             	mov    %rsp,%rbp
+  80287c:	48 83 ec 08          	sub    $0x8,%rsp
+  802880:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802880 <fd2num+0x8>
+  802887:	49 bb c0 67 00 00 00 	movabs $0x67c0,%r11
+  80288e:	00 00 00 
+  802891:	4c 01 d8             	add    %r11,%rax
+  802894:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802898:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80289c:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8028a3:	ff ff ff 
+  8028a6:	48 01 d0             	add    %rdx,%rax
+  8028a9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8028ad:	c9                   	leave
+  8028ae:	c3                   	ret
+
+00000000008028af <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8028af:	55                   	push   %rbp
+  8028b0:	48 89 e5             	mov    %rsp,%rbp
+  8028b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028b7 <fd2data+0x8>
+  8028be:	49 bb 89 67 00 00 00 	movabs $0x6789,%r11
+  8028c5:	00 00 00 
+  8028c8:	4c 01 d8             	add    %r11,%rax
+  8028cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  8028cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028d3:	48 89 d7             	mov    %rdx,%rdi
+  8028d6:	48 ba 38 98 ff ff ff 	movabs $0xffffffffffff9838,%rdx
+  8028dd:	ff ff ff 
+  8028e0:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8028e4:	ff d0                	call   *%rax
+  8028e6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8028ec:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8028f0:	c9                   	leave
+  8028f1:	c3                   	ret
+
+00000000008028f2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8028f2:	55                   	push   %rbp
+  8028f3:	48 89 e5             	mov    %rsp,%rbp
+  8028f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8028fa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028fa <fd_alloc+0x8>
+  802901:	49 bb 46 67 00 00 00 	movabs $0x6746,%r11
+  802908:	00 00 00 
+  80290b:	4c 01 d8             	add    %r11,%rax
+  80290e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802912:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802919:	eb 75                	jmp    802990 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  80291b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80291e:	48 63 d2             	movslq %edx,%rdx
+  802921:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802928:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80292c:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802930:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802934:	48 89 d1             	mov    %rdx,%rcx
+  802937:	48 c1 e9 15          	shr    $0x15,%rcx
+  80293b:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802942:	ff ff ff 
+  802945:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802949:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80294d:	83 e2 01             	and    $0x1,%edx
+  802950:	48 85 d2             	test   %rdx,%rdx
+  802953:	74 25                	je     80297a <fd_alloc+0x88>
+  802955:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802959:	48 89 d1             	mov    %rdx,%rcx
+  80295c:	48 c1 e9 0c          	shr    $0xc,%rcx
+  802960:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  802967:	ff ff ff 
+  80296a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80296e:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802972:	83 e2 01             	and    $0x1,%edx
+  802975:	48 85 d2             	test   %rdx,%rdx
+  802978:	75 12                	jne    80298c <fd_alloc+0x9a>
+			*fd_store = fd;
+  80297a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80297e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802982:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298a:	eb 1a                	jmp    8029a6 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  80298c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802990:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802994:	7e 85                	jle    80291b <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802996:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80299a:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  8029a1:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  8029a6:	c9                   	leave
+  8029a7:	c3                   	ret
+
+00000000008029a8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8029a8:	55                   	push   %rbp
+  8029a9:	48 89 e5             	mov    %rsp,%rbp
+  8029ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8029b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029b0 <fd_lookup+0x8>
+  8029b7:	49 bb 90 66 00 00 00 	movabs $0x6690,%r11
+  8029be:	00 00 00 
+  8029c1:	4c 01 d8             	add    %r11,%rax
+  8029c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8029c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8029cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8029cf:	78 06                	js     8029d7 <fd_lookup+0x2f>
+  8029d1:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8029d5:	7e 07                	jle    8029de <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8029d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029dc:	eb 73                	jmp    802a51 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8029de:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8029e1:	48 63 d2             	movslq %edx,%rdx
+  8029e4:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8029eb:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8029ef:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8029f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029f7:	48 89 d1             	mov    %rdx,%rcx
+  8029fa:	48 c1 e9 15          	shr    $0x15,%rcx
+  8029fe:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802a05:	ff ff ff 
+  802a08:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802a0c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802a10:	83 e2 01             	and    $0x1,%edx
+  802a13:	48 85 d2             	test   %rdx,%rdx
+  802a16:	74 22                	je     802a3a <fd_lookup+0x92>
+  802a18:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a1c:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802a20:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  802a27:	ff ff ff 
+  802a2a:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802a2e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a32:	83 e0 01             	and    $0x1,%eax
+  802a35:	48 85 c0             	test   %rax,%rax
+  802a38:	75 07                	jne    802a41 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802a3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a3f:	eb 10                	jmp    802a51 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802a41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a45:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a49:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  802a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a51:	c9                   	leave
+  802a52:	c3                   	ret
+
+0000000000802a53 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802a53:	55                   	push   %rbp
+  802a54:	48 89 e5             	mov    %rsp,%rbp
+  802a57:	41 57                	push   %r15
+  802a59:	53                   	push   %rbx
+  802a5a:	48 83 ec 30          	sub    $0x30,%rsp
+  802a5e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a5e <fd_close+0xb>
+  802a65:	49 bb e2 65 00 00 00 	movabs $0x65e2,%r11
+  802a6c:	00 00 00 
+  802a6f:	4c 01 db             	add    %r11,%rbx
+  802a72:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802a76:	89 f0                	mov    %esi,%eax
+  802a78:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802a7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a7f:	48 89 c7             	mov    %rax,%rdi
+  802a82:	48 b8 38 98 ff ff ff 	movabs $0xffffffffffff9838,%rax
+  802a89:	ff ff ff 
+  802a8c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a90:	ff d0                	call   *%rax
+  802a92:	89 c2                	mov    %eax,%edx
+  802a94:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802a98:	48 89 c6             	mov    %rax,%rsi
+  802a9b:	89 d7                	mov    %edx,%edi
+  802a9d:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  802aa4:	ff ff ff 
+  802aa7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aab:	ff d0                	call   *%rax
+  802aad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ab0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ab4:	78 0a                	js     802ac0 <fd_close+0x6d>
+	    || fd != fd2)
+  802ab6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802aba:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802abe:	74 12                	je     802ad2 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802ac0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802ac4:	74 05                	je     802acb <fd_close+0x78>
+  802ac6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ac9:	eb 7a                	jmp    802b45 <fd_close+0xf2>
+  802acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad0:	eb 73                	jmp    802b45 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802ad2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ad6:	8b 00                	mov    (%rax),%eax
+  802ad8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802adc:	48 89 d6             	mov    %rdx,%rsi
+  802adf:	89 c7                	mov    %eax,%edi
+  802ae1:	48 b8 0e 9b ff ff ff 	movabs $0xffffffffffff9b0e,%rax
+  802ae8:	ff ff ff 
+  802aeb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aef:	ff d0                	call   *%rax
+  802af1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802af4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802af8:	78 2a                	js     802b24 <fd_close+0xd1>
+		if (dev->dev_close)
+  802afa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802afe:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802b02:	48 85 c0             	test   %rax,%rax
+  802b05:	74 16                	je     802b1d <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802b07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b0b:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802b0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b13:	48 89 c7             	mov    %rax,%rdi
+  802b16:	ff d2                	call   *%rdx
+  802b18:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b1b:	eb 07                	jmp    802b24 <fd_close+0xd1>
+		else
+			r = 0;
+  802b1d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802b24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b28:	48 89 c6             	mov    %rax,%rsi
+  802b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b30:	49 89 df             	mov    %rbx,%r15
+  802b33:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  802b3a:	ff ff ff 
+  802b3d:	48 01 d8             	add    %rbx,%rax
+  802b40:	ff d0                	call   *%rax
+	return r;
+  802b42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802b45:	48 83 c4 30          	add    $0x30,%rsp
+  802b49:	5b                   	pop    %rbx
+  802b4a:	41 5f                	pop    %r15
+  802b4c:	5d                   	pop    %rbp
+  802b4d:	c3                   	ret
+
+0000000000802b4e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802b4e:	55                   	push   %rbp
+  802b4f:	48 89 e5             	mov    %rsp,%rbp
+  802b52:	41 57                	push   %r15
+  802b54:	48 83 ec 28          	sub    $0x28,%rsp
+  802b58:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802b58 <dev_lookup+0xa>
+  802b5f:	49 bb e8 64 00 00 00 	movabs $0x64e8,%r11
+  802b66:	00 00 00 
+  802b69:	4c 01 d9             	add    %r11,%rcx
+  802b6c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802b6f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802b73:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802b7a:	eb 45                	jmp    802bc1 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802b7c:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  802b83:	00 00 00 
+  802b86:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b89:	48 98                	cltq
+  802b8b:	48 01 ca             	add    %rcx,%rdx
+  802b8e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b92:	8b 00                	mov    (%rax),%eax
+  802b94:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802b97:	75 24                	jne    802bbd <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802b99:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  802ba0:	00 00 00 
+  802ba3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ba6:	48 98                	cltq
+  802ba8:	48 01 ca             	add    %rcx,%rdx
+  802bab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802baf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bb3:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbb:	eb 74                	jmp    802c31 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802bbd:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802bc1:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  802bc8:	00 00 00 
+  802bcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bce:	48 98                	cltq
+  802bd0:	48 01 ca             	add    %rcx,%rdx
+  802bd3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802bd7:	48 85 c0             	test   %rax,%rax
+  802bda:	75 a0                	jne    802b7c <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802bdc:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802be3:	ff ff ff 
+  802be6:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802bea:	48 8b 00             	mov    (%rax),%rax
+  802bed:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802bf3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802bf6:	89 c6                	mov    %eax,%esi
+  802bf8:	48 b8 50 e3 ff ff ff 	movabs $0xffffffffffffe350,%rax
+  802bff:	ff ff ff 
+  802c02:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802c06:	48 89 c7             	mov    %rax,%rdi
+  802c09:	49 89 cf             	mov    %rcx,%r15
+  802c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c11:	49 b8 11 76 ff ff ff 	movabs $0xffffffffffff7611,%r8
+  802c18:	ff ff ff 
+  802c1b:	49 01 c8             	add    %rcx,%r8
+  802c1e:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802c21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c25:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802c2c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802c31:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802c35:	c9                   	leave
+  802c36:	c3                   	ret
+
+0000000000802c37 <close>:
+
+int
+close(int fdnum)
+{
+  802c37:	55                   	push   %rbp
+  802c38:	48 89 e5             	mov    %rsp,%rbp
+  802c3b:	53                   	push   %rbx
+  802c3c:	48 83 ec 28          	sub    $0x28,%rsp
+  802c40:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c40 <close+0x9>
+  802c47:	49 bb 00 64 00 00 00 	movabs $0x6400,%r11
+  802c4e:	00 00 00 
+  802c51:	4c 01 db             	add    %r11,%rbx
+  802c54:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c57:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802c5b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802c5e:	48 89 d6             	mov    %rdx,%rsi
+  802c61:	89 c7                	mov    %eax,%edi
+  802c63:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  802c6a:	ff ff ff 
+  802c6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c71:	ff d0                	call   *%rax
+  802c73:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c76:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c7a:	79 05                	jns    802c81 <close+0x4a>
+		return r;
+  802c7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c7f:	eb 1c                	jmp    802c9d <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802c81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c85:	be 01 00 00 00       	mov    $0x1,%esi
+  802c8a:	48 89 c7             	mov    %rax,%rdi
+  802c8d:	48 b8 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%rax
+  802c94:	ff ff ff 
+  802c97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c9b:	ff d0                	call   *%rax
+}
+  802c9d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ca1:	c9                   	leave
+  802ca2:	c3                   	ret
+
+0000000000802ca3 <close_all>:
+
+void
+close_all(void)
+{
+  802ca3:	55                   	push   %rbp
+  802ca4:	48 89 e5             	mov    %rsp,%rbp
+  802ca7:	53                   	push   %rbx
+  802ca8:	48 83 ec 18          	sub    $0x18,%rsp
+  802cac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802cac <close_all+0x9>
+  802cb3:	49 bb 94 63 00 00 00 	movabs $0x6394,%r11
+  802cba:	00 00 00 
+  802cbd:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802cc0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802cc7:	eb 19                	jmp    802ce2 <close_all+0x3f>
+		close(i);
+  802cc9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ccc:	89 c7                	mov    %eax,%edi
+  802cce:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  802cd5:	ff ff ff 
+  802cd8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cdc:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802cde:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802ce2:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802ce6:	7e e1                	jle    802cc9 <close_all+0x26>
+}
+  802ce8:	90                   	nop
+  802ce9:	90                   	nop
+  802cea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cee:	c9                   	leave
+  802cef:	c3                   	ret
+
+0000000000802cf0 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802cf0:	55                   	push   %rbp
+  802cf1:	48 89 e5             	mov    %rsp,%rbp
+  802cf4:	41 57                	push   %r15
+  802cf6:	53                   	push   %rbx
+  802cf7:	48 83 ec 40          	sub    $0x40,%rsp
+  802cfb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802cfb <dup+0xb>
+  802d02:	49 bb 45 63 00 00 00 	movabs $0x6345,%r11
+  802d09:	00 00 00 
+  802d0c:	4c 01 db             	add    %r11,%rbx
+  802d0f:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802d12:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802d15:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802d19:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802d1c:	48 89 d6             	mov    %rdx,%rsi
+  802d1f:	89 c7                	mov    %eax,%edi
+  802d21:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  802d28:	ff ff ff 
+  802d2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d2f:	ff d0                	call   *%rax
+  802d31:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d34:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d38:	79 08                	jns    802d42 <dup+0x52>
+		return r;
+  802d3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d3d:	e9 a4 01 00 00       	jmp    802ee6 <dup+0x1f6>
+	close(newfdnum);
+  802d42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d45:	89 c7                	mov    %eax,%edi
+  802d47:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  802d4e:	ff ff ff 
+  802d51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d55:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802d57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d5a:	48 98                	cltq
+  802d5c:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802d62:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d66:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802d6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d6e:	48 89 c7             	mov    %rax,%rdi
+  802d71:	48 b8 6f 98 ff ff ff 	movabs $0xffffffffffff986f,%rax
+  802d78:	ff ff ff 
+  802d7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d7f:	ff d0                	call   *%rax
+  802d81:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802d85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d89:	48 89 c7             	mov    %rax,%rdi
+  802d8c:	48 b8 6f 98 ff ff ff 	movabs $0xffffffffffff986f,%rax
+  802d93:	ff ff ff 
+  802d96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d9a:	ff d0                	call   *%rax
+  802d9c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802da0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802da4:	48 c1 e8 15          	shr    $0x15,%rax
+  802da8:	48 89 c2             	mov    %rax,%rdx
+  802dab:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802db2:	ff ff ff 
+  802db5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802db9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802dbd:	83 e0 01             	and    $0x1,%eax
+  802dc0:	48 85 c0             	test   %rax,%rax
+  802dc3:	74 7f                	je     802e44 <dup+0x154>
+  802dc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802dc9:	48 c1 e8 0c          	shr    $0xc,%rax
+  802dcd:	48 89 c2             	mov    %rax,%rdx
+  802dd0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802dd7:	ff ff ff 
+  802dda:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802dde:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802de2:	83 e0 01             	and    $0x1,%eax
+  802de5:	48 85 c0             	test   %rax,%rax
+  802de8:	74 5a                	je     802e44 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802dea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802dee:	48 c1 e8 0c          	shr    $0xc,%rax
+  802df2:	48 89 c2             	mov    %rax,%rdx
+  802df5:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802dfc:	ff ff ff 
+  802dff:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e03:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e07:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e0c:	89 c1                	mov    %eax,%ecx
+  802e0e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802e12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e16:	41 89 c8             	mov    %ecx,%r8d
+  802e19:	48 89 d1             	mov    %rdx,%rcx
+  802e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e21:	48 89 c6             	mov    %rax,%rsi
+  802e24:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e29:	49 89 df             	mov    %rbx,%r15
+  802e2c:	48 b8 f4 90 ff ff ff 	movabs $0xffffffffffff90f4,%rax
+  802e33:	ff ff ff 
+  802e36:	48 01 d8             	add    %rbx,%rax
+  802e39:	ff d0                	call   *%rax
+  802e3b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e3e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e42:	78 5f                	js     802ea3 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802e44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e48:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e4c:	48 89 c2             	mov    %rax,%rdx
+  802e4f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802e56:	ff ff ff 
+  802e59:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e5d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e61:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e66:	89 c1                	mov    %eax,%ecx
+  802e68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e6c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e70:	41 89 c8             	mov    %ecx,%r8d
+  802e73:	48 89 d1             	mov    %rdx,%rcx
+  802e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e7b:	48 89 c6             	mov    %rax,%rsi
+  802e7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e83:	49 89 df             	mov    %rbx,%r15
+  802e86:	48 b8 f4 90 ff ff ff 	movabs $0xffffffffffff90f4,%rax
+  802e8d:	ff ff ff 
+  802e90:	48 01 d8             	add    %rbx,%rax
+  802e93:	ff d0                	call   *%rax
+  802e95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e9c:	78 08                	js     802ea6 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802e9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802ea1:	eb 43                	jmp    802ee6 <dup+0x1f6>
+			goto err;
+  802ea3:	90                   	nop
+  802ea4:	eb 01                	jmp    802ea7 <dup+0x1b7>
+		goto err;
+  802ea6:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802ea7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802eab:	48 89 c6             	mov    %rax,%rsi
+  802eae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb3:	49 89 df             	mov    %rbx,%r15
+  802eb6:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  802ebd:	ff ff ff 
+  802ec0:	48 01 d8             	add    %rbx,%rax
+  802ec3:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802ec5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ec9:	48 89 c6             	mov    %rax,%rsi
+  802ecc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ed1:	49 89 df             	mov    %rbx,%r15
+  802ed4:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  802edb:	ff ff ff 
+  802ede:	48 01 d8             	add    %rbx,%rax
+  802ee1:	ff d0                	call   *%rax
+	return r;
+  802ee3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802ee6:	48 83 c4 40          	add    $0x40,%rsp
+  802eea:	5b                   	pop    %rbx
+  802eeb:	41 5f                	pop    %r15
+  802eed:	5d                   	pop    %rbp
+  802eee:	c3                   	ret
+
+0000000000802eef <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802eef:	55                   	push   %rbp
+  802ef0:	48 89 e5             	mov    %rsp,%rbp
+  802ef3:	41 57                	push   %r15
+  802ef5:	53                   	push   %rbx
+  802ef6:	48 83 ec 40          	sub    $0x40,%rsp
+  802efa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802efa <read+0xb>
+  802f01:	49 bb 46 61 00 00 00 	movabs $0x6146,%r11
+  802f08:	00 00 00 
+  802f0b:	4c 01 db             	add    %r11,%rbx
+  802f0e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802f11:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802f15:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802f19:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802f1d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802f20:	48 89 d6             	mov    %rdx,%rsi
+  802f23:	89 c7                	mov    %eax,%edi
+  802f25:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  802f2c:	ff ff ff 
+  802f2f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f33:	ff d0                	call   *%rax
+  802f35:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f38:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f3c:	78 28                	js     802f66 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802f3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f42:	8b 00                	mov    (%rax),%eax
+  802f44:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802f48:	48 89 d6             	mov    %rdx,%rsi
+  802f4b:	89 c7                	mov    %eax,%edi
+  802f4d:	48 b8 0e 9b ff ff ff 	movabs $0xffffffffffff9b0e,%rax
+  802f54:	ff ff ff 
+  802f57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f5b:	ff d0                	call   *%rax
+  802f5d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f60:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f64:	79 08                	jns    802f6e <read+0x7f>
+		return r;
+  802f66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f69:	e9 8b 00 00 00       	jmp    802ff9 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802f6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f72:	8b 40 08             	mov    0x8(%rax),%eax
+  802f75:	83 e0 03             	and    $0x3,%eax
+  802f78:	83 f8 01             	cmp    $0x1,%eax
+  802f7b:	75 4b                	jne    802fc8 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802f7d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802f84:	ff ff ff 
+  802f87:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f8b:	48 8b 00             	mov    (%rax),%rax
+  802f8e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802f94:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802f97:	89 c6                	mov    %eax,%esi
+  802f99:	48 b8 6f e3 ff ff ff 	movabs $0xffffffffffffe36f,%rax
+  802fa0:	ff ff ff 
+  802fa3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fa7:	48 89 c7             	mov    %rax,%rdi
+  802faa:	49 89 df             	mov    %rbx,%r15
+  802fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb2:	48 b9 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rcx
+  802fb9:	ff ff ff 
+  802fbc:	48 01 d9             	add    %rbx,%rcx
+  802fbf:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802fc1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fc6:	eb 31                	jmp    802ff9 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  802fc8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fcc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802fd0:	48 85 c0             	test   %rax,%rax
+  802fd3:	75 07                	jne    802fdc <read+0xed>
+		return -E_NOT_SUPP;
+  802fd5:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802fda:	eb 1d                	jmp    802ff9 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  802fdc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fe0:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802fe4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fe8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802fec:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ff0:	48 89 ce             	mov    %rcx,%rsi
+  802ff3:	48 89 c7             	mov    %rax,%rdi
+  802ff6:	41 ff d0             	call   *%r8
+}
+  802ff9:	48 83 c4 40          	add    $0x40,%rsp
+  802ffd:	5b                   	pop    %rbx
+  802ffe:	41 5f                	pop    %r15
+  803000:	5d                   	pop    %rbp
+  803001:	c3                   	ret
+
+0000000000803002 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803002:	55                   	push   %rbp
+  803003:	48 89 e5             	mov    %rsp,%rbp
+  803006:	53                   	push   %rbx
+  803007:	48 83 ec 38          	sub    $0x38,%rsp
+  80300b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80300b <readn+0x9>
+  803012:	49 bb 35 60 00 00 00 	movabs $0x6035,%r11
+  803019:	00 00 00 
+  80301c:	4c 01 db             	add    %r11,%rbx
+  80301f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803022:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803026:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80302a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803031:	eb 4b                	jmp    80307e <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803033:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803036:	48 98                	cltq
+  803038:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80303c:	48 29 c2             	sub    %rax,%rdx
+  80303f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803042:	48 63 c8             	movslq %eax,%rcx
+  803045:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803049:	48 01 c1             	add    %rax,%rcx
+  80304c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80304f:	48 89 ce             	mov    %rcx,%rsi
+  803052:	89 c7                	mov    %eax,%edi
+  803054:	48 b8 af 9e ff ff ff 	movabs $0xffffffffffff9eaf,%rax
+  80305b:	ff ff ff 
+  80305e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803062:	ff d0                	call   *%rax
+  803064:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803067:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80306b:	79 05                	jns    803072 <readn+0x70>
+			return m;
+  80306d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803070:	eb 1d                	jmp    80308f <readn+0x8d>
+		if (m == 0)
+  803072:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803076:	74 13                	je     80308b <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803078:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80307b:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80307e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803081:	48 98                	cltq
+  803083:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803087:	72 aa                	jb     803033 <readn+0x31>
+  803089:	eb 01                	jmp    80308c <readn+0x8a>
+			break;
+  80308b:	90                   	nop
+	}
+	return tot;
+  80308c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80308f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803093:	c9                   	leave
+  803094:	c3                   	ret
+
+0000000000803095 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803095:	55                   	push   %rbp
+  803096:	48 89 e5             	mov    %rsp,%rbp
+  803099:	41 57                	push   %r15
+  80309b:	53                   	push   %rbx
+  80309c:	48 83 ec 40          	sub    $0x40,%rsp
+  8030a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030a0 <write+0xb>
+  8030a7:	49 bb a0 5f 00 00 00 	movabs $0x5fa0,%r11
+  8030ae:	00 00 00 
+  8030b1:	4c 01 db             	add    %r11,%rbx
+  8030b4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8030b7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8030bb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8030bf:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8030c3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8030c6:	48 89 d6             	mov    %rdx,%rsi
+  8030c9:	89 c7                	mov    %eax,%edi
+  8030cb:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  8030d2:	ff ff ff 
+  8030d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030d9:	ff d0                	call   *%rax
+  8030db:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030de:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030e2:	78 28                	js     80310c <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030e8:	8b 00                	mov    (%rax),%eax
+  8030ea:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8030ee:	48 89 d6             	mov    %rdx,%rsi
+  8030f1:	89 c7                	mov    %eax,%edi
+  8030f3:	48 b8 0e 9b ff ff ff 	movabs $0xffffffffffff9b0e,%rax
+  8030fa:	ff ff ff 
+  8030fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803101:	ff d0                	call   *%rax
+  803103:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803106:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80310a:	79 08                	jns    803114 <write+0x7f>
+		return r;
+  80310c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80310f:	e9 8a 00 00 00       	jmp    80319e <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803114:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803118:	8b 40 08             	mov    0x8(%rax),%eax
+  80311b:	83 e0 03             	and    $0x3,%eax
+  80311e:	85 c0                	test   %eax,%eax
+  803120:	75 4b                	jne    80316d <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803122:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803129:	ff ff ff 
+  80312c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803130:	48 8b 00             	mov    (%rax),%rax
+  803133:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803139:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80313c:	89 c6                	mov    %eax,%esi
+  80313e:	48 b8 8b e3 ff ff ff 	movabs $0xffffffffffffe38b,%rax
+  803145:	ff ff ff 
+  803148:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80314c:	48 89 c7             	mov    %rax,%rdi
+  80314f:	49 89 df             	mov    %rbx,%r15
+  803152:	b8 00 00 00 00       	mov    $0x0,%eax
+  803157:	48 b9 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rcx
+  80315e:	ff ff ff 
+  803161:	48 01 d9             	add    %rbx,%rcx
+  803164:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803166:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80316b:	eb 31                	jmp    80319e <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80316d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803171:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803175:	48 85 c0             	test   %rax,%rax
+  803178:	75 07                	jne    803181 <write+0xec>
+		return -E_NOT_SUPP;
+  80317a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80317f:	eb 1d                	jmp    80319e <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803181:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803185:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803189:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80318d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803191:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803195:	48 89 ce             	mov    %rcx,%rsi
+  803198:	48 89 c7             	mov    %rax,%rdi
+  80319b:	41 ff d0             	call   *%r8
+}
+  80319e:	48 83 c4 40          	add    $0x40,%rsp
+  8031a2:	5b                   	pop    %rbx
+  8031a3:	41 5f                	pop    %r15
+  8031a5:	5d                   	pop    %rbp
+  8031a6:	c3                   	ret
+
+00000000008031a7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8031a7:	55                   	push   %rbp
+  8031a8:	48 89 e5             	mov    %rsp,%rbp
+  8031ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8031af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8031af <seek+0x8>
+  8031b6:	49 bb 91 5e 00 00 00 	movabs $0x5e91,%r11
+  8031bd:	00 00 00 
+  8031c0:	4c 01 d8             	add    %r11,%rax
+  8031c3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031c6:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031c9:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8031cd:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8031d0:	48 89 ce             	mov    %rcx,%rsi
+  8031d3:	89 d7                	mov    %edx,%edi
+  8031d5:	48 ba 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rdx
+  8031dc:	ff ff ff 
+  8031df:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8031e3:	ff d0                	call   *%rax
+  8031e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031e8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031ec:	79 05                	jns    8031f3 <seek+0x4c>
+		return r;
+  8031ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031f1:	eb 0f                	jmp    803202 <seek+0x5b>
+	fd->fd_offset = offset;
+  8031f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031f7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8031fa:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8031fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803202:	c9                   	leave
+  803203:	c3                   	ret
+
+0000000000803204 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803204:	55                   	push   %rbp
+  803205:	48 89 e5             	mov    %rsp,%rbp
+  803208:	41 57                	push   %r15
+  80320a:	53                   	push   %rbx
+  80320b:	48 83 ec 30          	sub    $0x30,%rsp
+  80320f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80320f <ftruncate+0xb>
+  803216:	49 bb 31 5e 00 00 00 	movabs $0x5e31,%r11
+  80321d:	00 00 00 
+  803220:	4c 01 db             	add    %r11,%rbx
+  803223:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803226:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803229:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80322d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803230:	48 89 d6             	mov    %rdx,%rsi
+  803233:	89 c7                	mov    %eax,%edi
+  803235:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  80323c:	ff ff ff 
+  80323f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803243:	ff d0                	call   *%rax
+  803245:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803248:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80324c:	78 28                	js     803276 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80324e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803252:	8b 00                	mov    (%rax),%eax
+  803254:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803258:	48 89 d6             	mov    %rdx,%rsi
+  80325b:	89 c7                	mov    %eax,%edi
+  80325d:	48 b8 0e 9b ff ff ff 	movabs $0xffffffffffff9b0e,%rax
+  803264:	ff ff ff 
+  803267:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80326b:	ff d0                	call   *%rax
+  80326d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803270:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803274:	79 08                	jns    80327e <ftruncate+0x7a>
+		return r;
+  803276:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803279:	e9 83 00 00 00       	jmp    803301 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80327e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803282:	8b 40 08             	mov    0x8(%rax),%eax
+  803285:	83 e0 03             	and    $0x3,%eax
+  803288:	85 c0                	test   %eax,%eax
+  80328a:	75 4b                	jne    8032d7 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  80328c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803293:	ff ff ff 
+  803296:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80329a:	48 8b 00             	mov    (%rax),%rax
+  80329d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8032a3:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8032a6:	89 c6                	mov    %eax,%esi
+  8032a8:	48 b8 a8 e3 ff ff ff 	movabs $0xffffffffffffe3a8,%rax
+  8032af:	ff ff ff 
+  8032b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032b6:	48 89 c7             	mov    %rax,%rdi
+  8032b9:	49 89 df             	mov    %rbx,%r15
+  8032bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c1:	48 b9 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rcx
+  8032c8:	ff ff ff 
+  8032cb:	48 01 d9             	add    %rbx,%rcx
+  8032ce:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8032d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032d5:	eb 2a                	jmp    803301 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8032d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032db:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8032df:	48 85 c0             	test   %rax,%rax
+  8032e2:	75 07                	jne    8032eb <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8032e4:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8032e9:	eb 16                	jmp    803301 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8032eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032ef:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8032f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032f7:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8032fa:	89 d6                	mov    %edx,%esi
+  8032fc:	48 89 c7             	mov    %rax,%rdi
+  8032ff:	ff d1                	call   *%rcx
+}
+  803301:	48 83 c4 30          	add    $0x30,%rsp
+  803305:	5b                   	pop    %rbx
+  803306:	41 5f                	pop    %r15
+  803308:	5d                   	pop    %rbp
+  803309:	c3                   	ret
+
+000000000080330a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80330a:	55                   	push   %rbp
+  80330b:	48 89 e5             	mov    %rsp,%rbp
+  80330e:	53                   	push   %rbx
+  80330f:	48 83 ec 38          	sub    $0x38,%rsp
+  803313:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803313 <fstat+0x9>
+  80331a:	49 bb 2d 5d 00 00 00 	movabs $0x5d2d,%r11
+  803321:	00 00 00 
+  803324:	4c 01 db             	add    %r11,%rbx
+  803327:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80332a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80332e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803332:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803335:	48 89 d6             	mov    %rdx,%rsi
+  803338:	89 c7                	mov    %eax,%edi
+  80333a:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  803341:	ff ff ff 
+  803344:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803348:	ff d0                	call   *%rax
+  80334a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80334d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803351:	78 28                	js     80337b <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803353:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803357:	8b 00                	mov    (%rax),%eax
+  803359:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80335d:	48 89 d6             	mov    %rdx,%rsi
+  803360:	89 c7                	mov    %eax,%edi
+  803362:	48 b8 0e 9b ff ff ff 	movabs $0xffffffffffff9b0e,%rax
+  803369:	ff ff ff 
+  80336c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803370:	ff d0                	call   *%rax
+  803372:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803375:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803379:	79 05                	jns    803380 <fstat+0x76>
+		return r;
+  80337b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80337e:	eb 5e                	jmp    8033de <fstat+0xd4>
+	if (!dev->dev_stat)
+  803380:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803384:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803388:	48 85 c0             	test   %rax,%rax
+  80338b:	75 07                	jne    803394 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80338d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803392:	eb 4a                	jmp    8033de <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803394:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803398:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80339b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80339f:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8033a6:	00 00 00 
+	stat->st_isdir = 0;
+  8033a9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033ad:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8033b4:	00 00 00 
+	stat->st_dev = dev;
+  8033b7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033bb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8033bf:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8033c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033ca:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8033ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8033d6:	48 89 d6             	mov    %rdx,%rsi
+  8033d9:	48 89 c7             	mov    %rax,%rdi
+  8033dc:	ff d1                	call   *%rcx
+}
+  8033de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033e2:	c9                   	leave
+  8033e3:	c3                   	ret
+
+00000000008033e4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8033e4:	55                   	push   %rbp
+  8033e5:	48 89 e5             	mov    %rsp,%rbp
+  8033e8:	41 57                	push   %r15
+  8033ea:	53                   	push   %rbx
+  8033eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8033ef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033ef <stat+0xb>
+  8033f6:	49 bb 51 5c 00 00 00 	movabs $0x5c51,%r11
+  8033fd:	00 00 00 
+  803400:	4c 01 db             	add    %r11,%rbx
+  803403:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803407:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80340b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80340f:	be 00 00 00 00       	mov    $0x0,%esi
+  803414:	48 89 c7             	mov    %rax,%rdi
+  803417:	49 89 df             	mov    %rbx,%r15
+  80341a:	48 b8 7e a6 ff ff ff 	movabs $0xffffffffffffa67e,%rax
+  803421:	ff ff ff 
+  803424:	48 01 d8             	add    %rbx,%rax
+  803427:	ff d0                	call   *%rax
+  803429:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80342c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803430:	79 05                	jns    803437 <stat+0x53>
+		return fd;
+  803432:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803435:	eb 37                	jmp    80346e <stat+0x8a>
+	r = fstat(fd, stat);
+  803437:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80343b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80343e:	48 89 d6             	mov    %rdx,%rsi
+  803441:	89 c7                	mov    %eax,%edi
+  803443:	48 b8 ca a2 ff ff ff 	movabs $0xffffffffffffa2ca,%rax
+  80344a:	ff ff ff 
+  80344d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803451:	ff d0                	call   *%rax
+  803453:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803456:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803459:	89 c7                	mov    %eax,%edi
+  80345b:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  803462:	ff ff ff 
+  803465:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803469:	ff d0                	call   *%rax
+	return r;
+  80346b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  80346e:	48 83 c4 20          	add    $0x20,%rsp
+  803472:	5b                   	pop    %rbx
+  803473:	41 5f                	pop    %r15
+  803475:	5d                   	pop    %rbp
+  803476:	c3                   	ret
+
+0000000000803477 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803477:	55                   	push   %rbp
+  803478:	48 89 e5             	mov    %rsp,%rbp
+  80347b:	41 57                	push   %r15
+  80347d:	53                   	push   %rbx
+  80347e:	48 83 ec 10          	sub    $0x10,%rsp
+  803482:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803482 <fsipc+0xb>
+  803489:	49 bb be 5b 00 00 00 	movabs $0x5bbe,%r11
+  803490:	00 00 00 
+  803493:	4c 01 db             	add    %r11,%rbx
+  803496:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803499:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80349d:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  8034a4:	00 00 00 
+  8034a7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8034aa:	85 c0                	test   %eax,%eax
+  8034ac:	75 24                	jne    8034d2 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034ae:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034b3:	49 89 df             	mov    %rbx,%r15
+  8034b6:	48 b8 97 db ff ff ff 	movabs $0xffffffffffffdb97,%rax
+  8034bd:	ff ff ff 
+  8034c0:	48 01 d8             	add    %rbx,%rax
+  8034c3:	ff d0                	call   *%rax
+  8034c5:	48 ba c0 0f 00 00 00 	movabs $0xfc0,%rdx
+  8034cc:	00 00 00 
+  8034cf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8034d2:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  8034d9:	00 00 00 
+  8034dc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8034df:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034e3:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8034e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8034ec:	49 89 d0             	mov    %rdx,%r8
+  8034ef:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8034f4:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8034fb:	00 00 00 
+  8034fe:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803502:	89 c7                	mov    %eax,%edi
+  803504:	49 89 df             	mov    %rbx,%r15
+  803507:	48 b8 b6 d5 ff ff ff 	movabs $0xffffffffffffd5b6,%rax
+  80350e:	ff ff ff 
+  803511:	48 01 d8             	add    %rbx,%rax
+  803514:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803516:	48 83 c4 10          	add    $0x10,%rsp
+  80351a:	5b                   	pop    %rbx
+  80351b:	41 5f                	pop    %r15
+  80351d:	5d                   	pop    %rbp
+  80351e:	c3                   	ret
+
+000000000080351f <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  80351f:	55                   	push   %rbp
+  803520:	48 89 e5             	mov    %rsp,%rbp
+  803523:	41 57                	push   %r15
+  803525:	53                   	push   %rbx
+  803526:	48 83 ec 20          	sub    $0x20,%rsp
+  80352a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80352a <fsipc_words+0xb>
+  803531:	49 bb 16 5b 00 00 00 	movabs $0x5b16,%r11
+  803538:	00 00 00 
+  80353b:	4c 01 db             	add    %r11,%rbx
+  80353e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803541:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803545:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803549:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803550:	00 00 00 
+  803553:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803556:	85 c0                	test   %eax,%eax
+  803558:	75 24                	jne    80357e <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80355a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80355f:	49 89 df             	mov    %rbx,%r15
+  803562:	48 b8 97 db ff ff ff 	movabs $0xffffffffffffdb97,%rax
+  803569:	ff ff ff 
+  80356c:	48 01 d8             	add    %rbx,%rax
+  80356f:	ff d0                	call   *%rax
+  803571:	48 ba c0 0f 00 00 00 	movabs $0xfc0,%rdx
+  803578:	00 00 00 
+  80357b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  80357e:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  803585:	00 00 00 
+  803588:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80358b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80358f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803593:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803596:	89 c7                	mov    %eax,%edi
+  803598:	49 89 df             	mov    %rbx,%r15
+  80359b:	48 b8 a1 d6 ff ff ff 	movabs $0xffffffffffffd6a1,%rax
+  8035a2:	ff ff ff 
+  8035a5:	48 01 d8             	add    %rbx,%rax
+  8035a8:	ff d0                	call   *%rax
+}
+  8035aa:	48 83 c4 20          	add    $0x20,%rsp
+  8035ae:	5b                   	pop    %rbx
+  8035af:	41 5f                	pop    %r15
+  8035b1:	5d                   	pop    %rbp
+  8035b2:	c3                   	ret
+
+00000000008035b3 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8035b3:	55                   	push   %rbp
+  8035b4:	48 89 e5             	mov    %rsp,%rbp
+  8035b7:	41 57                	push   %r15
+  8035b9:	53                   	push   %rbx
+  8035ba:	48 83 ec 40          	sub    $0x40,%rsp
+  8035be:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035be <fsipc_pages+0xb>
+  8035c5:	49 bb 82 5a 00 00 00 	movabs $0x5a82,%r11
+  8035cc:	00 00 00 
+  8035cf:	4c 01 db             	add    %r11,%rbx
+  8035d2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8035d5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8035d9:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8035dd:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8035e0:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  8035e7:	00 00 00 
+  8035ea:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8035ed:	85 c0                	test   %eax,%eax
+  8035ef:	75 24                	jne    803615 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8035f1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035f6:	49 89 df             	mov    %rbx,%r15
+  8035f9:	48 b8 97 db ff ff ff 	movabs $0xffffffffffffdb97,%rax
+  803600:	ff ff ff 
+  803603:	48 01 d8             	add    %rbx,%rax
+  803606:	ff d0                	call   *%rax
+  803608:	48 ba c0 0f 00 00 00 	movabs $0xfc0,%rdx
+  80360f:	00 00 00 
+  803612:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803615:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80361a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  80361e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803621:	48 98                	cltq
+  803623:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  803627:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80362b:	0f 95 c0             	setne  %al
+  80362e:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803631:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803638:	00 
+  803639:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80363d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803641:	48 01 d0             	add    %rdx,%rax
+  803644:	48 83 e8 01          	sub    $0x1,%rax
+  803648:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80364c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803650:	ba 00 00 00 00       	mov    $0x0,%edx
+  803655:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803659:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80365d:	48 29 d0             	sub    %rdx,%rax
+  803660:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803664:	41 89 c2             	mov    %eax,%r10d
+  803667:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  80366e:	00 00 00 
+  803671:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803674:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  803678:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80367c:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80367f:	48 83 ec 08          	sub    $0x8,%rsp
+  803683:	6a 40                	push   $0x40
+  803685:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  80368a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803691:	00 
+  803692:	6a 05                	push   $0x5
+  803694:	41 89 f9             	mov    %edi,%r9d
+  803697:	49 89 c8             	mov    %rcx,%r8
+  80369a:	44 89 d1             	mov    %r10d,%ecx
+  80369d:	89 c7                	mov    %eax,%edi
+  80369f:	49 89 df             	mov    %rbx,%r15
+  8036a2:	48 b8 9f d7 ff ff ff 	movabs $0xffffffffffffd79f,%rax
+  8036a9:	ff ff ff 
+  8036ac:	48 01 d8             	add    %rbx,%rax
+  8036af:	ff d0                	call   *%rax
+  8036b1:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8036b5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8036b9:	5b                   	pop    %rbx
+  8036ba:	41 5f                	pop    %r15
+  8036bc:	5d                   	pop    %rbp
+  8036bd:	c3                   	ret
+
+00000000008036be <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8036be:	55                   	push   %rbp
+  8036bf:	48 89 e5             	mov    %rsp,%rbp
+  8036c2:	41 57                	push   %r15
+  8036c4:	53                   	push   %rbx
+  8036c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8036c9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036c9 <open+0xb>
+  8036d0:	49 bb 77 59 00 00 00 	movabs $0x5977,%r11
+  8036d7:	00 00 00 
+  8036da:	4c 01 db             	add    %r11,%rbx
+  8036dd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8036e1:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8036e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036e8:	48 89 c7             	mov    %rax,%rdi
+  8036eb:	49 89 df             	mov    %rbx,%r15
+  8036ee:	48 b8 3f 83 ff ff ff 	movabs $0xffffffffffff833f,%rax
+  8036f5:	ff ff ff 
+  8036f8:	48 01 d8             	add    %rbx,%rax
+  8036fb:	ff d0                	call   *%rax
+  8036fd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803702:	7e 0a                	jle    80370e <open+0x50>
+		return -E_BAD_PATH;
+  803704:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803709:	e9 18 01 00 00       	jmp    803826 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  80370e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803712:	48 89 c7             	mov    %rax,%rdi
+  803715:	49 89 df             	mov    %rbx,%r15
+  803718:	48 b8 b2 98 ff ff ff 	movabs $0xffffffffffff98b2,%rax
+  80371f:	ff ff ff 
+  803722:	48 01 d8             	add    %rbx,%rax
+  803725:	ff d0                	call   *%rax
+  803727:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80372a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80372e:	74 08                	je     803738 <open+0x7a>
+		return r;
+  803730:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803733:	e9 ee 00 00 00       	jmp    803826 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  803738:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80373f:	00 00 00 
+  803742:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803745:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80374c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803750:	48 89 c6             	mov    %rax,%rsi
+  803753:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80375a:	00 00 00 
+  80375d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803761:	48 89 c7             	mov    %rax,%rdi
+  803764:	49 89 df             	mov    %rbx,%r15
+  803767:	48 b8 d3 83 ff ff ff 	movabs $0xffffffffffff83d3,%rax
+  80376e:	ff ff ff 
+  803771:	48 01 d8             	add    %rbx,%rax
+  803774:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803776:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80377a:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  80377f:	48 89 c6             	mov    %rax,%rsi
+  803782:	bf 00 00 00 00       	mov    $0x0,%edi
+  803787:	49 89 df             	mov    %rbx,%r15
+  80378a:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  803791:	ff ff ff 
+  803794:	48 01 d8             	add    %rbx,%rax
+  803797:	ff d0                	call   *%rax
+  803799:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80379c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037a0:	74 23                	je     8037c5 <open+0x107>
+		fd_close(fd,0);
+  8037a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ab:	48 89 c7             	mov    %rax,%rdi
+  8037ae:	49 89 df             	mov    %rbx,%r15
+  8037b1:	48 b8 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%rax
+  8037b8:	ff ff ff 
+  8037bb:	48 01 d8             	add    %rbx,%rax
+  8037be:	ff d0                	call   *%rax
+		return r;
+  8037c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037c3:	eb 61                	jmp    803826 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8037c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037c9:	48 89 c6             	mov    %rax,%rsi
+  8037cc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8037d1:	48 b8 37 a4 ff ff ff 	movabs $0xffffffffffffa437,%rax
+  8037d8:	ff ff ff 
+  8037db:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037df:	ff d0                	call   *%rax
+  8037e1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037e4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037e8:	74 23                	je     80380d <open+0x14f>
+		fd_close(fd,0);
+  8037ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8037f3:	48 89 c7             	mov    %rax,%rdi
+  8037f6:	49 89 df             	mov    %rbx,%r15
+  8037f9:	48 b8 13 9a ff ff ff 	movabs $0xffffffffffff9a13,%rax
+  803800:	ff ff ff 
+  803803:	48 01 d8             	add    %rbx,%rax
+  803806:	ff d0                	call   *%rax
+		return r;
+  803808:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80380b:	eb 19                	jmp    803826 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  80380d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803811:	48 89 c7             	mov    %rax,%rdi
+  803814:	49 89 df             	mov    %rbx,%r15
+  803817:	48 b8 38 98 ff ff ff 	movabs $0xffffffffffff9838,%rax
+  80381e:	ff ff ff 
+  803821:	48 01 d8             	add    %rbx,%rax
+  803824:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  803826:	48 83 c4 20          	add    $0x20,%rsp
+  80382a:	5b                   	pop    %rbx
+  80382b:	41 5f                	pop    %r15
+  80382d:	5d                   	pop    %rbp
+  80382e:	c3                   	ret
+
+000000000080382f <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  80382f:	55                   	push   %rbp
+  803830:	48 89 e5             	mov    %rsp,%rbp
+  803833:	48 83 ec 20          	sub    $0x20,%rsp
+  803837:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803837 <devfile_flush+0x8>
+  80383e:	49 bb 09 58 00 00 00 	movabs $0x5809,%r11
+  803845:	00 00 00 
+  803848:	4c 01 d8             	add    %r11,%rax
+  80384b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  80384f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803853:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803856:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803859:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80385d:	ba 04 00 00 00       	mov    $0x4,%edx
+  803862:	48 89 ce             	mov    %rcx,%rsi
+  803865:	bf 06 00 00 00       	mov    $0x6,%edi
+  80386a:	48 b9 df a4 ff ff ff 	movabs $0xffffffffffffa4df,%rcx
+  803871:	ff ff ff 
+  803874:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803878:	ff d0                	call   *%rax
+}
+  80387a:	c9                   	leave
+  80387b:	c3                   	ret
+
+000000000080387c <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  80387c:	55                   	push   %rbp
+  80387d:	48 89 e5             	mov    %rsp,%rbp
+  803880:	41 57                	push   %r15
+  803882:	53                   	push   %rbx
+  803883:	48 83 ec 60          	sub    $0x60,%rsp
+  803887:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803887 <devfile_read+0xb>
+  80388e:	49 bb b9 57 00 00 00 	movabs $0x57b9,%r11
+  803895:	00 00 00 
+  803898:	4c 01 db             	add    %r11,%rbx
+  80389b:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80389f:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8038a3:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  8038a7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8038ab:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  8038af:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8038b3:	8b 50 0c             	mov    0xc(%rax),%edx
+  8038b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038ba:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8038bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038c0:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8038c4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  8038c8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8038cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8038d1:	ba 10 00 00 00       	mov    $0x10,%edx
+  8038d6:	48 89 c6             	mov    %rax,%rsi
+  8038d9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8038de:	48 b8 73 a5 ff ff ff 	movabs $0xffffffffffffa573,%rax
+  8038e5:	ff ff ff 
+  8038e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038ec:	ff d0                	call   *%rax
+  8038ee:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8038f1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8038f5:	79 05                	jns    8038fc <devfile_read+0x80>
+		return r;
+  8038f7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8038fa:	eb 64                	jmp    803960 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8038fc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8038ff:	48 63 d0             	movslq %eax,%rdx
+  803902:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803906:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  80390b:	48 01 c1             	add    %rax,%rcx
+  80390e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803912:	48 89 ce             	mov    %rcx,%rsi
+  803915:	48 89 c7             	mov    %rax,%rdi
+  803918:	49 89 df             	mov    %rbx,%r15
+  80391b:	48 b8 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rax
+  803922:	ff ff ff 
+  803925:	48 01 d8             	add    %rbx,%rax
+  803928:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  80392a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803931:	ff ff ff 
+  803934:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803938:	48 8b 00             	mov    (%rax),%rax
+  80393b:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803941:	89 c6                	mov    %eax,%esi
+  803943:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803948:	48 89 c7             	mov    %rax,%rdi
+  80394b:	49 89 df             	mov    %rbx,%r15
+  80394e:	48 b8 51 db ff ff ff 	movabs $0xffffffffffffdb51,%rax
+  803955:	ff ff ff 
+  803958:	48 01 d8             	add    %rbx,%rax
+  80395b:	ff d0                	call   *%rax
+	return r;
+  80395d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  803960:	48 83 c4 60          	add    $0x60,%rsp
+  803964:	5b                   	pop    %rbx
+  803965:	41 5f                	pop    %r15
+  803967:	5d                   	pop    %rbp
+  803968:	c3                   	ret
+
+0000000000803969 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803969:	55                   	push   %rbp
+  80396a:	48 89 e5             	mov    %rsp,%rbp
+  80396d:	41 57                	push   %r15
+  80396f:	53                   	push   %rbx
+  803970:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803974:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803974 <devfile_write+0xb>
+  80397b:	49 bb cc 56 00 00 00 	movabs $0x56cc,%r11
+  803982:	00 00 00 
+  803985:	4c 01 db             	add    %r11,%rbx
+  803988:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80398c:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  803990:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803997:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80399b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  80399f:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  8039a6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8039aa:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  8039b1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039b4:	48 63 d0             	movslq %eax,%rdx
+  8039b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039bb:	48 39 c2             	cmp    %rax,%rdx
+  8039be:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8039c2:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8039c9:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  8039d0:	00 
+  8039d1:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8039d8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039dc:	48 01 d0             	add    %rdx,%rax
+  8039df:	48 83 e8 01          	sub    $0x1,%rax
+  8039e3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8039e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039f0:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8039f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039f8:	48 29 d0             	sub    %rdx,%rax
+  8039fb:	48 c1 e8 0c          	shr    $0xc,%rax
+  8039ff:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803a02:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803a05:	89 c6                	mov    %eax,%esi
+  803a07:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803a0c:	48 89 c7             	mov    %rax,%rdi
+  803a0f:	49 89 df             	mov    %rbx,%r15
+  803a12:	48 b8 0b db ff ff ff 	movabs $0xffffffffffffdb0b,%rax
+  803a19:	ff ff ff 
+  803a1c:	48 01 d8             	add    %rbx,%rax
+  803a1f:	ff d0                	call   *%rax
+  803a21:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  803a24:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  803a28:	79 08                	jns    803a32 <devfile_write+0xc9>
+		return r;
+  803a2a:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803a2d:	e9 8f 00 00 00       	jmp    803ac1 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803a32:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803a39:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  803a3d:	48 89 c6             	mov    %rax,%rsi
+  803a40:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803a45:	48 89 c7             	mov    %rax,%rdi
+  803a48:	49 89 df             	mov    %rbx,%r15
+  803a4b:	48 b8 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rax
+  803a52:	ff ff ff 
+  803a55:	48 01 d8             	add    %rbx,%rax
+  803a58:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803a5a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  803a5e:	8b 50 0c             	mov    0xc(%rax),%edx
+  803a61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a65:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803a67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a6b:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803a72:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803a76:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803a79:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803a7d:	89 d1                	mov    %edx,%ecx
+  803a7f:	ba 10 00 00 00       	mov    $0x10,%edx
+  803a84:	48 89 c6             	mov    %rax,%rsi
+  803a87:	bf 04 00 00 00       	mov    $0x4,%edi
+  803a8c:	48 b8 73 a5 ff ff ff 	movabs $0xffffffffffffa573,%rax
+  803a93:	ff ff ff 
+  803a96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a9a:	ff d0                	call   *%rax
+  803a9c:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803a9f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803aa2:	89 c6                	mov    %eax,%esi
+  803aa4:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803aa9:	48 89 c7             	mov    %rax,%rdi
+  803aac:	49 89 df             	mov    %rbx,%r15
+  803aaf:	48 b8 51 db ff ff ff 	movabs $0xffffffffffffdb51,%rax
+  803ab6:	ff ff ff 
+  803ab9:	48 01 d8             	add    %rbx,%rax
+  803abc:	ff d0                	call   *%rax
+	return r;
+  803abe:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803ac1:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803ac5:	5b                   	pop    %rbx
+  803ac6:	41 5f                	pop    %r15
+  803ac8:	5d                   	pop    %rbp
+  803ac9:	c3                   	ret
+
+0000000000803aca <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803aca:	55                   	push   %rbp
+  803acb:	48 89 e5             	mov    %rsp,%rbp
+  803ace:	41 57                	push   %r15
+  803ad0:	53                   	push   %rbx
+  803ad1:	48 83 ec 20          	sub    $0x20,%rsp
+  803ad5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ad5 <devfile_stat+0xb>
+  803adc:	49 bb 6b 55 00 00 00 	movabs $0x556b,%r11
+  803ae3:	00 00 00 
+  803ae6:	4c 01 db             	add    %r11,%rbx
+  803ae9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803aed:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803af1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803af5:	8b 40 0c             	mov    0xc(%rax),%eax
+  803af8:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  803aff:	00 00 00 
+  803b02:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803b05:	be 00 00 00 00       	mov    $0x0,%esi
+  803b0a:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b0f:	48 b8 37 a4 ff ff ff 	movabs $0xffffffffffffa437,%rax
+  803b16:	ff ff ff 
+  803b19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b1d:	ff d0                	call   *%rax
+  803b1f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b22:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b26:	79 05                	jns    803b2d <devfile_stat+0x63>
+		return r;
+  803b28:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b2b:	eb 65                	jmp    803b92 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803b2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b31:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  803b38:	00 00 00 
+  803b3b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803b3f:	48 89 d6             	mov    %rdx,%rsi
+  803b42:	48 89 c7             	mov    %rax,%rdi
+  803b45:	49 89 df             	mov    %rbx,%r15
+  803b48:	48 b8 d3 83 ff ff ff 	movabs $0xffffffffffff83d3,%rax
+  803b4f:	ff ff ff 
+  803b52:	48 01 d8             	add    %rbx,%rax
+  803b55:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803b57:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  803b5e:	00 00 00 
+  803b61:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803b68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b6c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803b72:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  803b79:	00 00 00 
+  803b7c:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803b83:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b87:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b92:	48 83 c4 20          	add    $0x20,%rsp
+  803b96:	5b                   	pop    %rbx
+  803b97:	41 5f                	pop    %r15
+  803b99:	5d                   	pop    %rbp
+  803b9a:	c3                   	ret
+
+0000000000803b9b <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803b9b:	55                   	push   %rbp
+  803b9c:	48 89 e5             	mov    %rsp,%rbp
+  803b9f:	48 83 ec 20          	sub    $0x20,%rsp
+  803ba3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ba3 <devfile_trunc+0x8>
+  803baa:	49 bb 9d 54 00 00 00 	movabs $0x549d,%r11
+  803bb1:	00 00 00 
+  803bb4:	4c 01 d8             	add    %r11,%rax
+  803bb7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803bbb:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803bbe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803bc2:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803bc5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803bc8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803bcb:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803bce:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803bd2:	ba 08 00 00 00       	mov    $0x8,%edx
+  803bd7:	48 89 ce             	mov    %rcx,%rsi
+  803bda:	bf 02 00 00 00       	mov    $0x2,%edi
+  803bdf:	48 b9 df a4 ff ff ff 	movabs $0xffffffffffffa4df,%rcx
+  803be6:	ff ff ff 
+  803be9:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803bed:	ff d0                	call   *%rax
+}
+  803bef:	c9                   	leave
+  803bf0:	c3                   	ret
+
+0000000000803bf1 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803bf1:	55                   	push   %rbp
+  803bf2:	48 89 e5             	mov    %rsp,%rbp
+  803bf5:	41 57                	push   %r15
+  803bf7:	53                   	push   %rbx
+  803bf8:	48 83 ec 10          	sub    $0x10,%rsp
+  803bfc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bfc <remove+0xb>
+  803c03:	49 bb 44 54 00 00 00 	movabs $0x5444,%r11
+  803c0a:	00 00 00 
+  803c0d:	4c 01 db             	add    %r11,%rbx
+  803c10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803c14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c18:	48 89 c7             	mov    %rax,%rdi
+  803c1b:	49 89 df             	mov    %rbx,%r15
+  803c1e:	48 b8 3f 83 ff ff ff 	movabs $0xffffffffffff833f,%rax
+  803c25:	ff ff ff 
+  803c28:	48 01 d8             	add    %rbx,%rax
+  803c2b:	ff d0                	call   *%rax
+  803c2d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803c32:	7e 07                	jle    803c3b <remove+0x4a>
+		return -E_BAD_PATH;
+  803c34:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803c39:	eb 44                	jmp    803c7f <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803c3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c3f:	48 89 c6             	mov    %rax,%rsi
+  803c42:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  803c49:	00 00 00 
+  803c4c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c50:	48 89 c7             	mov    %rax,%rdi
+  803c53:	49 89 df             	mov    %rbx,%r15
+  803c56:	48 b8 d3 83 ff ff ff 	movabs $0xffffffffffff83d3,%rax
+  803c5d:	ff ff ff 
+  803c60:	48 01 d8             	add    %rbx,%rax
+  803c63:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803c65:	be 00 00 00 00       	mov    $0x0,%esi
+  803c6a:	bf 07 00 00 00       	mov    $0x7,%edi
+  803c6f:	48 b8 37 a4 ff ff ff 	movabs $0xffffffffffffa437,%rax
+  803c76:	ff ff ff 
+  803c79:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c7d:	ff d0                	call   *%rax
+}
+  803c7f:	48 83 c4 10          	add    $0x10,%rsp
+  803c83:	5b                   	pop    %rbx
+  803c84:	41 5f                	pop    %r15
+  803c86:	5d                   	pop    %rbp
+  803c87:	c3                   	ret
+
+0000000000803c88 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803c88:	55                   	push   %rbp
+  803c89:	48 89 e5             	mov    %rsp,%rbp
+  803c8c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c8c <sync+0x4>
+  803c93:	49 bb b4 53 00 00 00 	movabs $0x53b4,%r11
+  803c9a:	00 00 00 
+  803c9d:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803ca0:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ca5:	be 00 00 00 00       	mov    $0x0,%esi
+  803caa:	bf 08 00 00 00       	mov    $0x8,%edi
+  803caf:	48 b9 df a4 ff ff ff 	movabs $0xffffffffffffa4df,%rcx
+  803cb6:	ff ff ff 
+  803cb9:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803cbd:	ff d0                	call   *%rax
+}
+  803cbf:	5d                   	pop    %rbp
+  803cc0:	c3                   	ret
+
+0000000000803cc1 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803cc1:	55                   	push   %rbp
+  803cc2:	48 89 e5             	mov    %rsp,%rbp
+  803cc5:	41 57                	push   %r15
+  803cc7:	53                   	push   %rbx
+  803cc8:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803ccf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ccf <copy+0xe>
+  803cd6:	49 bb 71 53 00 00 00 	movabs $0x5371,%r11
+  803cdd:	00 00 00 
+  803ce0:	4c 01 db             	add    %r11,%rbx
+  803ce3:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803cea:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803cf1:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803cf8:	be 00 00 00 00       	mov    $0x0,%esi
+  803cfd:	48 89 c7             	mov    %rax,%rdi
+  803d00:	48 b8 7e a6 ff ff ff 	movabs $0xffffffffffffa67e,%rax
+  803d07:	ff ff ff 
+  803d0a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d0e:	ff d0                	call   *%rax
+  803d10:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803d13:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d17:	79 35                	jns    803d4e <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803d19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d1c:	89 c6                	mov    %eax,%esi
+  803d1e:	48 b8 ce e3 ff ff ff 	movabs $0xffffffffffffe3ce,%rax
+  803d25:	ff ff ff 
+  803d28:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d2c:	48 89 c7             	mov    %rax,%rdi
+  803d2f:	49 89 df             	mov    %rbx,%r15
+  803d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d37:	48 ba 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rdx
+  803d3e:	ff ff ff 
+  803d41:	48 01 da             	add    %rbx,%rdx
+  803d44:	ff d2                	call   *%rdx
+		return fd_src;
+  803d46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d49:	e9 d7 01 00 00       	jmp    803f25 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803d4e:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803d55:	be 01 01 00 00       	mov    $0x101,%esi
+  803d5a:	48 89 c7             	mov    %rax,%rdi
+  803d5d:	48 b8 7e a6 ff ff ff 	movabs $0xffffffffffffa67e,%rax
+  803d64:	ff ff ff 
+  803d67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d6b:	ff d0                	call   *%rax
+  803d6d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803d70:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803d74:	0f 89 df 00 00 00    	jns    803e59 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803d7a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d7d:	89 c6                	mov    %eax,%esi
+  803d7f:	48 b8 e4 e3 ff ff ff 	movabs $0xffffffffffffe3e4,%rax
+  803d86:	ff ff ff 
+  803d89:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d8d:	48 89 c7             	mov    %rax,%rdi
+  803d90:	49 89 df             	mov    %rbx,%r15
+  803d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d98:	48 ba 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rdx
+  803d9f:	ff ff ff 
+  803da2:	48 01 da             	add    %rbx,%rdx
+  803da5:	ff d2                	call   *%rdx
+		close(fd_src);
+  803da7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803daa:	89 c7                	mov    %eax,%edi
+  803dac:	49 89 df             	mov    %rbx,%r15
+  803daf:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  803db6:	ff ff ff 
+  803db9:	48 01 d8             	add    %rbx,%rax
+  803dbc:	ff d0                	call   *%rax
+		return fd_dest;
+  803dbe:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803dc1:	e9 5f 01 00 00       	jmp    803f25 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803dc6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803dc9:	48 63 d0             	movslq %eax,%rdx
+  803dcc:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803dd3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803dd6:	48 89 ce             	mov    %rcx,%rsi
+  803dd9:	89 c7                	mov    %eax,%edi
+  803ddb:	49 89 df             	mov    %rbx,%r15
+  803dde:	48 b8 55 a0 ff ff ff 	movabs $0xffffffffffffa055,%rax
+  803de5:	ff ff ff 
+  803de8:	48 01 d8             	add    %rbx,%rax
+  803deb:	ff d0                	call   *%rax
+  803ded:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803df0:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803df4:	79 63                	jns    803e59 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803df6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803df9:	89 c6                	mov    %eax,%esi
+  803dfb:	48 b8 fe e3 ff ff ff 	movabs $0xffffffffffffe3fe,%rax
+  803e02:	ff ff ff 
+  803e05:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e09:	48 89 c7             	mov    %rax,%rdi
+  803e0c:	49 89 df             	mov    %rbx,%r15
+  803e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e14:	48 ba 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rdx
+  803e1b:	ff ff ff 
+  803e1e:	48 01 da             	add    %rbx,%rdx
+  803e21:	ff d2                	call   *%rdx
+			close(fd_src);
+  803e23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e26:	89 c7                	mov    %eax,%edi
+  803e28:	49 89 df             	mov    %rbx,%r15
+  803e2b:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  803e32:	ff ff ff 
+  803e35:	48 01 d8             	add    %rbx,%rax
+  803e38:	ff d0                	call   *%rax
+			close(fd_dest);
+  803e3a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e3d:	89 c7                	mov    %eax,%edi
+  803e3f:	49 89 df             	mov    %rbx,%r15
+  803e42:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  803e49:	ff ff ff 
+  803e4c:	48 01 d8             	add    %rbx,%rax
+  803e4f:	ff d0                	call   *%rax
+			return write_size;
+  803e51:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803e54:	e9 cc 00 00 00       	jmp    803f25 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803e59:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803e60:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e63:	ba 00 02 00 00       	mov    $0x200,%edx
+  803e68:	48 89 ce             	mov    %rcx,%rsi
+  803e6b:	89 c7                	mov    %eax,%edi
+  803e6d:	49 89 df             	mov    %rbx,%r15
+  803e70:	48 b8 af 9e ff ff ff 	movabs $0xffffffffffff9eaf,%rax
+  803e77:	ff ff ff 
+  803e7a:	48 01 d8             	add    %rbx,%rax
+  803e7d:	ff d0                	call   *%rax
+  803e7f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803e82:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803e86:	0f 8f 3a ff ff ff    	jg     803dc6 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803e8c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803e90:	79 60                	jns    803ef2 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803e92:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803e95:	89 c6                	mov    %eax,%esi
+  803e97:	48 b8 11 e4 ff ff ff 	movabs $0xffffffffffffe411,%rax
+  803e9e:	ff ff ff 
+  803ea1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ea5:	48 89 c7             	mov    %rax,%rdi
+  803ea8:	49 89 df             	mov    %rbx,%r15
+  803eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb0:	48 ba 11 76 ff ff ff 	movabs $0xffffffffffff7611,%rdx
+  803eb7:	ff ff ff 
+  803eba:	48 01 da             	add    %rbx,%rdx
+  803ebd:	ff d2                	call   *%rdx
+		close(fd_src);
+  803ebf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ec2:	89 c7                	mov    %eax,%edi
+  803ec4:	49 89 df             	mov    %rbx,%r15
+  803ec7:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  803ece:	ff ff ff 
+  803ed1:	48 01 d8             	add    %rbx,%rax
+  803ed4:	ff d0                	call   *%rax
+		close(fd_dest);
+  803ed6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ed9:	89 c7                	mov    %eax,%edi
+  803edb:	49 89 df             	mov    %rbx,%r15
+  803ede:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  803ee5:	ff ff ff 
+  803ee8:	48 01 d8             	add    %rbx,%rax
+  803eeb:	ff d0                	call   *%rax
+		return read_size;
+  803eed:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ef0:	eb 33                	jmp    803f25 <copy+0x264>
+	}
+	close(fd_src);
+  803ef2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ef5:	89 c7                	mov    %eax,%edi
+  803ef7:	49 89 df             	mov    %rbx,%r15
+  803efa:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  803f01:	ff ff ff 
+  803f04:	48 01 d8             	add    %rbx,%rax
+  803f07:	ff d0                	call   *%rax
+	close(fd_dest);
+  803f09:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803f0c:	89 c7                	mov    %eax,%edi
+  803f0e:	49 89 df             	mov    %rbx,%r15
+  803f11:	48 b8 f7 9b ff ff ff 	movabs $0xffffffffffff9bf7,%rax
+  803f18:	ff ff ff 
+  803f1b:	48 01 d8             	add    %rbx,%rax
+  803f1e:	ff d0                	call   *%rax
+	return 0;
+  803f20:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803f25:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803f2c:	5b                   	pop    %rbx
+  803f2d:	41 5f                	pop    %r15
+  803f2f:	5d                   	pop    %rbp
+  803f30:	c3                   	ret
+
+0000000000803f31 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  803f31:	55                   	push   %rbp
+  803f32:	48 89 e5             	mov    %rsp,%rbp
+  803f35:	41 57                	push   %r15
+  803f37:	53                   	push   %rbx
+  803f38:	48 83 ec 20          	sub    $0x20,%rsp
+  803f3c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f3c <fd2sockid+0xb>
+  803f43:	49 bb 04 51 00 00 00 	movabs $0x5104,%r11
+  803f4a:	00 00 00 
+  803f4d:	4c 01 db             	add    %r11,%rbx
+  803f50:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803f53:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f57:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f5a:	48 89 d6             	mov    %rdx,%rsi
+  803f5d:	89 c7                	mov    %eax,%edi
+  803f5f:	49 89 df             	mov    %rbx,%r15
+  803f62:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  803f69:	ff ff ff 
+  803f6c:	48 01 d8             	add    %rbx,%rax
+  803f6f:	ff d0                	call   *%rax
+  803f71:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f74:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f78:	79 05                	jns    803f7f <fd2sockid+0x4e>
+		return r;
+  803f7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f7d:	eb 25                	jmp    803fa4 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803f7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f83:	8b 10                	mov    (%rax),%edx
+  803f85:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  803f8c:	00 00 00 
+  803f8f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803f92:	39 c2                	cmp    %eax,%edx
+  803f94:	74 07                	je     803f9d <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  803f96:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f9b:	eb 07                	jmp    803fa4 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  803f9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fa1:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  803fa4:	48 83 c4 20          	add    $0x20,%rsp
+  803fa8:	5b                   	pop    %rbx
+  803fa9:	41 5f                	pop    %r15
+  803fab:	5d                   	pop    %rbp
+  803fac:	c3                   	ret
+
+0000000000803fad <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  803fad:	55                   	push   %rbp
+  803fae:	48 89 e5             	mov    %rsp,%rbp
+  803fb1:	41 57                	push   %r15
+  803fb3:	53                   	push   %rbx
+  803fb4:	48 83 ec 20          	sub    $0x20,%rsp
+  803fb8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fb8 <alloc_sockfd+0xb>
+  803fbf:	49 bb 88 50 00 00 00 	movabs $0x5088,%r11
+  803fc6:	00 00 00 
+  803fc9:	4c 01 db             	add    %r11,%rbx
+  803fcc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  803fcf:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803fd3:	48 89 c7             	mov    %rax,%rdi
+  803fd6:	49 89 df             	mov    %rbx,%r15
+  803fd9:	48 b8 b2 98 ff ff ff 	movabs $0xffffffffffff98b2,%rax
+  803fe0:	ff ff ff 
+  803fe3:	48 01 d8             	add    %rbx,%rax
+  803fe6:	ff d0                	call   *%rax
+  803fe8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803feb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fef:	78 2c                	js     80401d <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803ff1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ff5:	ba 07 04 00 00       	mov    $0x407,%edx
+  803ffa:	48 89 c6             	mov    %rax,%rsi
+  803ffd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804002:	49 89 df             	mov    %rbx,%r15
+  804005:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  80400c:	ff ff ff 
+  80400f:	48 01 d8             	add    %rbx,%rax
+  804012:	ff d0                	call   *%rax
+  804014:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804017:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80401b:	79 1c                	jns    804039 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80401d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804020:	89 c7                	mov    %eax,%edi
+  804022:	49 89 df             	mov    %rbx,%r15
+  804025:	48 b8 61 b7 ff ff ff 	movabs $0xffffffffffffb761,%rax
+  80402c:	ff ff ff 
+  80402f:	48 01 d8             	add    %rbx,%rax
+  804032:	ff d0                	call   *%rax
+		return r;
+  804034:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804037:	eb 41                	jmp    80407a <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804039:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80403d:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  804044:	00 00 00 
+  804047:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80404a:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  80404c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804050:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804057:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80405b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80405e:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804061:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804065:	48 89 c7             	mov    %rax,%rdi
+  804068:	49 89 df             	mov    %rbx,%r15
+  80406b:	48 b8 38 98 ff ff ff 	movabs $0xffffffffffff9838,%rax
+  804072:	ff ff ff 
+  804075:	48 01 d8             	add    %rbx,%rax
+  804078:	ff d0                	call   *%rax
+}
+  80407a:	48 83 c4 20          	add    $0x20,%rsp
+  80407e:	5b                   	pop    %rbx
+  80407f:	41 5f                	pop    %r15
+  804081:	5d                   	pop    %rbp
+  804082:	c3                   	ret
+
+0000000000804083 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804083:	55                   	push   %rbp
+  804084:	48 89 e5             	mov    %rsp,%rbp
+  804087:	41 57                	push   %r15
+  804089:	53                   	push   %rbx
+  80408a:	48 83 ec 30          	sub    $0x30,%rsp
+  80408e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80408e <accept+0xb>
+  804095:	49 bb b2 4f 00 00 00 	movabs $0x4fb2,%r11
+  80409c:	00 00 00 
+  80409f:	4c 01 db             	add    %r11,%rbx
+  8040a2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8040a5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8040a9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8040ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040b0:	89 c7                	mov    %eax,%edi
+  8040b2:	48 b8 f1 ae ff ff ff 	movabs $0xffffffffffffaef1,%rax
+  8040b9:	ff ff ff 
+  8040bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040c0:	ff d0                	call   *%rax
+  8040c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040c9:	79 05                	jns    8040d0 <accept+0x4d>
+		return r;
+  8040cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040ce:	eb 45                	jmp    804115 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8040d0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8040d4:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8040d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040db:	48 89 ce             	mov    %rcx,%rsi
+  8040de:	89 c7                	mov    %eax,%edi
+  8040e0:	49 89 df             	mov    %rbx,%r15
+  8040e3:	48 b8 cf b5 ff ff ff 	movabs $0xffffffffffffb5cf,%rax
+  8040ea:	ff ff ff 
+  8040ed:	48 01 d8             	add    %rbx,%rax
+  8040f0:	ff d0                	call   *%rax
+  8040f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040f9:	79 05                	jns    804100 <accept+0x7d>
+		return r;
+  8040fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040fe:	eb 15                	jmp    804115 <accept+0x92>
+	return alloc_sockfd(r);
+  804100:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804103:	89 c7                	mov    %eax,%edi
+  804105:	48 b8 6d af ff ff ff 	movabs $0xffffffffffffaf6d,%rax
+  80410c:	ff ff ff 
+  80410f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804113:	ff d0                	call   *%rax
+}
+  804115:	48 83 c4 30          	add    $0x30,%rsp
+  804119:	5b                   	pop    %rbx
+  80411a:	41 5f                	pop    %r15
+  80411c:	5d                   	pop    %rbp
+  80411d:	c3                   	ret
+
+000000000080411e <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80411e:	55                   	push   %rbp
+  80411f:	48 89 e5             	mov    %rsp,%rbp
+  804122:	41 57                	push   %r15
+  804124:	53                   	push   %rbx
+  804125:	48 83 ec 20          	sub    $0x20,%rsp
+  804129:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804129 <bind+0xb>
+  804130:	49 bb 17 4f 00 00 00 	movabs $0x4f17,%r11
+  804137:	00 00 00 
+  80413a:	4c 01 db             	add    %r11,%rbx
+  80413d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804140:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804144:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804147:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80414a:	89 c7                	mov    %eax,%edi
+  80414c:	48 b8 f1 ae ff ff ff 	movabs $0xffffffffffffaef1,%rax
+  804153:	ff ff ff 
+  804156:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80415a:	ff d0                	call   *%rax
+  80415c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80415f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804163:	79 05                	jns    80416a <bind+0x4c>
+		return r;
+  804165:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804168:	eb 21                	jmp    80418b <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80416a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80416d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804171:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804174:	48 89 ce             	mov    %rcx,%rsi
+  804177:	89 c7                	mov    %eax,%edi
+  804179:	49 89 df             	mov    %rbx,%r15
+  80417c:	48 b8 7b b6 ff ff ff 	movabs $0xffffffffffffb67b,%rax
+  804183:	ff ff ff 
+  804186:	48 01 d8             	add    %rbx,%rax
+  804189:	ff d0                	call   *%rax
+}
+  80418b:	48 83 c4 20          	add    $0x20,%rsp
+  80418f:	5b                   	pop    %rbx
+  804190:	41 5f                	pop    %r15
+  804192:	5d                   	pop    %rbp
+  804193:	c3                   	ret
+
+0000000000804194 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804194:	55                   	push   %rbp
+  804195:	48 89 e5             	mov    %rsp,%rbp
+  804198:	41 57                	push   %r15
+  80419a:	53                   	push   %rbx
+  80419b:	48 83 ec 20          	sub    $0x20,%rsp
+  80419f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80419f <shutdown+0xb>
+  8041a6:	49 bb a1 4e 00 00 00 	movabs $0x4ea1,%r11
+  8041ad:	00 00 00 
+  8041b0:	4c 01 db             	add    %r11,%rbx
+  8041b3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8041b6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8041b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041bc:	89 c7                	mov    %eax,%edi
+  8041be:	48 b8 f1 ae ff ff ff 	movabs $0xffffffffffffaef1,%rax
+  8041c5:	ff ff ff 
+  8041c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041cc:	ff d0                	call   *%rax
+  8041ce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041d1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041d5:	79 05                	jns    8041dc <shutdown+0x48>
+		return r;
+  8041d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041da:	eb 1c                	jmp    8041f8 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8041dc:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8041df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041e2:	89 d6                	mov    %edx,%esi
+  8041e4:	89 c7                	mov    %eax,%edi
+  8041e6:	49 89 df             	mov    %rbx,%r15
+  8041e9:	48 b8 10 b7 ff ff ff 	movabs $0xffffffffffffb710,%rax
+  8041f0:	ff ff ff 
+  8041f3:	48 01 d8             	add    %rbx,%rax
+  8041f6:	ff d0                	call   *%rax
+}
+  8041f8:	48 83 c4 20          	add    $0x20,%rsp
+  8041fc:	5b                   	pop    %rbx
+  8041fd:	41 5f                	pop    %r15
+  8041ff:	5d                   	pop    %rbp
+  804200:	c3                   	ret
+
+0000000000804201 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804201:	55                   	push   %rbp
+  804202:	48 89 e5             	mov    %rsp,%rbp
+  804205:	41 57                	push   %r15
+  804207:	53                   	push   %rbx
+  804208:	48 83 ec 10          	sub    $0x10,%rsp
+  80420c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80420c <devsock_close+0xb>
+  804213:	49 bb 34 4e 00 00 00 	movabs $0x4e34,%r11
+  80421a:	00 00 00 
+  80421d:	4c 01 db             	add    %r11,%rbx
+  804220:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804224:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804228:	48 89 c7             	mov    %rax,%rdi
+  80422b:	49 89 df             	mov    %rbx,%r15
+  80422e:	48 b8 26 dc ff ff ff 	movabs $0xffffffffffffdc26,%rax
+  804235:	ff ff ff 
+  804238:	48 01 d8             	add    %rbx,%rax
+  80423b:	ff d0                	call   *%rax
+  80423d:	83 f8 01             	cmp    $0x1,%eax
+  804240:	75 1d                	jne    80425f <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804242:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804246:	8b 40 0c             	mov    0xc(%rax),%eax
+  804249:	89 c7                	mov    %eax,%edi
+  80424b:	49 89 df             	mov    %rbx,%r15
+  80424e:	48 b8 61 b7 ff ff ff 	movabs $0xffffffffffffb761,%rax
+  804255:	ff ff ff 
+  804258:	48 01 d8             	add    %rbx,%rax
+  80425b:	ff d0                	call   *%rax
+  80425d:	eb 05                	jmp    804264 <devsock_close+0x63>
+	else
+		return 0;
+  80425f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804264:	48 83 c4 10          	add    $0x10,%rsp
+  804268:	5b                   	pop    %rbx
+  804269:	41 5f                	pop    %r15
+  80426b:	5d                   	pop    %rbp
+  80426c:	c3                   	ret
+
+000000000080426d <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80426d:	55                   	push   %rbp
+  80426e:	48 89 e5             	mov    %rsp,%rbp
+  804271:	41 57                	push   %r15
+  804273:	53                   	push   %rbx
+  804274:	48 83 ec 20          	sub    $0x20,%rsp
+  804278:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804278 <connect+0xb>
+  80427f:	49 bb c8 4d 00 00 00 	movabs $0x4dc8,%r11
+  804286:	00 00 00 
+  804289:	4c 01 db             	add    %r11,%rbx
+  80428c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80428f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804293:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804296:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804299:	89 c7                	mov    %eax,%edi
+  80429b:	48 b8 f1 ae ff ff ff 	movabs $0xffffffffffffaef1,%rax
+  8042a2:	ff ff ff 
+  8042a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042a9:	ff d0                	call   *%rax
+  8042ab:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042b2:	79 05                	jns    8042b9 <connect+0x4c>
+		return r;
+  8042b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042b7:	eb 21                	jmp    8042da <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8042b9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8042bc:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8042c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042c3:	48 89 ce             	mov    %rcx,%rsi
+  8042c6:	89 c7                	mov    %eax,%edi
+  8042c8:	49 89 df             	mov    %rbx,%r15
+  8042cb:	48 b8 a9 b7 ff ff ff 	movabs $0xffffffffffffb7a9,%rax
+  8042d2:	ff ff ff 
+  8042d5:	48 01 d8             	add    %rbx,%rax
+  8042d8:	ff d0                	call   *%rax
+}
+  8042da:	48 83 c4 20          	add    $0x20,%rsp
+  8042de:	5b                   	pop    %rbx
+  8042df:	41 5f                	pop    %r15
+  8042e1:	5d                   	pop    %rbp
+  8042e2:	c3                   	ret
+
+00000000008042e3 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8042e3:	55                   	push   %rbp
+  8042e4:	48 89 e5             	mov    %rsp,%rbp
+  8042e7:	41 57                	push   %r15
+  8042e9:	53                   	push   %rbx
+  8042ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8042ee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042ee <listen+0xb>
+  8042f5:	49 bb 52 4d 00 00 00 	movabs $0x4d52,%r11
+  8042fc:	00 00 00 
+  8042ff:	4c 01 db             	add    %r11,%rbx
+  804302:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804305:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804308:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80430b:	89 c7                	mov    %eax,%edi
+  80430d:	48 b8 f1 ae ff ff ff 	movabs $0xffffffffffffaef1,%rax
+  804314:	ff ff ff 
+  804317:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80431b:	ff d0                	call   *%rax
+  80431d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804320:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804324:	79 05                	jns    80432b <listen+0x48>
+		return r;
+  804326:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804329:	eb 1c                	jmp    804347 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80432b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80432e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804331:	89 d6                	mov    %edx,%esi
+  804333:	89 c7                	mov    %eax,%edi
+  804335:	49 89 df             	mov    %rbx,%r15
+  804338:	48 b8 3e b8 ff ff ff 	movabs $0xffffffffffffb83e,%rax
+  80433f:	ff ff ff 
+  804342:	48 01 d8             	add    %rbx,%rax
+  804345:	ff d0                	call   *%rax
+}
+  804347:	48 83 c4 20          	add    $0x20,%rsp
+  80434b:	5b                   	pop    %rbx
+  80434c:	41 5f                	pop    %r15
+  80434e:	5d                   	pop    %rbp
+  80434f:	c3                   	ret
+
+0000000000804350 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804350:	55                   	push   %rbp
+  804351:	48 89 e5             	mov    %rsp,%rbp
+  804354:	41 57                	push   %r15
+  804356:	48 83 ec 28          	sub    $0x28,%rsp
+  80435a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80435a <devsock_read+0xa>
+  804361:	49 bb e6 4c 00 00 00 	movabs $0x4ce6,%r11
+  804368:	00 00 00 
+  80436b:	4c 01 d8             	add    %r11,%rax
+  80436e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804372:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804376:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80437a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80437e:	41 89 d0             	mov    %edx,%r8d
+  804381:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804385:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804388:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80438c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804391:	44 89 c2             	mov    %r8d,%edx
+  804394:	49 89 c7             	mov    %rax,%r15
+  804397:	49 b8 8f b8 ff ff ff 	movabs $0xffffffffffffb88f,%r8
+  80439e:	ff ff ff 
+  8043a1:	49 01 c0             	add    %rax,%r8
+  8043a4:	41 ff d0             	call   *%r8
+}
+  8043a7:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8043ab:	c9                   	leave
+  8043ac:	c3                   	ret
+
+00000000008043ad <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8043ad:	55                   	push   %rbp
+  8043ae:	48 89 e5             	mov    %rsp,%rbp
+  8043b1:	41 57                	push   %r15
+  8043b3:	48 83 ec 28          	sub    $0x28,%rsp
+  8043b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8043b7 <devsock_write+0xa>
+  8043be:	49 bb 89 4c 00 00 00 	movabs $0x4c89,%r11
+  8043c5:	00 00 00 
+  8043c8:	4c 01 d8             	add    %r11,%rax
+  8043cb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8043cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8043d3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8043d7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8043db:	41 89 d0             	mov    %edx,%r8d
+  8043de:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043e2:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8043e5:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8043e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8043ee:	44 89 c2             	mov    %r8d,%edx
+  8043f1:	49 89 c7             	mov    %rax,%r15
+  8043f4:	49 b8 ac b9 ff ff ff 	movabs $0xffffffffffffb9ac,%r8
+  8043fb:	ff ff ff 
+  8043fe:	49 01 c0             	add    %rax,%r8
+  804401:	41 ff d0             	call   *%r8
+}
+  804404:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804408:	c9                   	leave
+  804409:	c3                   	ret
+
+000000000080440a <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80440a:	55                   	push   %rbp
+  80440b:	48 89 e5             	mov    %rsp,%rbp
+  80440e:	41 57                	push   %r15
+  804410:	48 83 ec 18          	sub    $0x18,%rsp
+  804414:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804414 <devsock_stat+0xa>
+  80441b:	49 bb 2c 4c 00 00 00 	movabs $0x4c2c,%r11
+  804422:	00 00 00 
+  804425:	4c 01 d8             	add    %r11,%rax
+  804428:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80442c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804430:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804434:	48 b9 2c e4 ff ff ff 	movabs $0xffffffffffffe42c,%rcx
+  80443b:	ff ff ff 
+  80443e:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804442:	48 89 ce             	mov    %rcx,%rsi
+  804445:	48 89 d7             	mov    %rdx,%rdi
+  804448:	49 89 c7             	mov    %rax,%r15
+  80444b:	48 ba d3 83 ff ff ff 	movabs $0xffffffffffff83d3,%rdx
+  804452:	ff ff ff 
+  804455:	48 01 c2             	add    %rax,%rdx
+  804458:	ff d2                	call   *%rdx
+	return 0;
+  80445a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80445f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804463:	c9                   	leave
+  804464:	c3                   	ret
+
+0000000000804465 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804465:	55                   	push   %rbp
+  804466:	48 89 e5             	mov    %rsp,%rbp
+  804469:	41 57                	push   %r15
+  80446b:	53                   	push   %rbx
+  80446c:	48 83 ec 20          	sub    $0x20,%rsp
+  804470:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804470 <socket+0xb>
+  804477:	49 bb d0 4b 00 00 00 	movabs $0x4bd0,%r11
+  80447e:	00 00 00 
+  804481:	4c 01 db             	add    %r11,%rbx
+  804484:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804487:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80448a:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80448d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804490:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804493:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804496:	89 ce                	mov    %ecx,%esi
+  804498:	89 c7                	mov    %eax,%edi
+  80449a:	49 89 df             	mov    %rbx,%r15
+  80449d:	48 b8 83 bb ff ff ff 	movabs $0xffffffffffffbb83,%rax
+  8044a4:	ff ff ff 
+  8044a7:	48 01 d8             	add    %rbx,%rax
+  8044aa:	ff d0                	call   *%rax
+  8044ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044b3:	79 05                	jns    8044ba <socket+0x55>
+		return r;
+  8044b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044b8:	eb 15                	jmp    8044cf <socket+0x6a>
+	return alloc_sockfd(r);
+  8044ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044bd:	89 c7                	mov    %eax,%edi
+  8044bf:	48 b8 6d af ff ff ff 	movabs $0xffffffffffffaf6d,%rax
+  8044c6:	ff ff ff 
+  8044c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044cd:	ff d0                	call   *%rax
+}
+  8044cf:	48 83 c4 20          	add    $0x20,%rsp
+  8044d3:	5b                   	pop    %rbx
+  8044d4:	41 5f                	pop    %r15
+  8044d6:	5d                   	pop    %rbp
+  8044d7:	c3                   	ret
+
+00000000008044d8 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8044d8:	55                   	push   %rbp
+  8044d9:	48 89 e5             	mov    %rsp,%rbp
+  8044dc:	41 57                	push   %r15
+  8044de:	53                   	push   %rbx
+  8044df:	48 83 ec 10          	sub    $0x10,%rsp
+  8044e3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044e3 <nsipc+0xb>
+  8044ea:	49 bb 5d 4b 00 00 00 	movabs $0x4b5d,%r11
+  8044f1:	00 00 00 
+  8044f4:	4c 01 db             	add    %r11,%rbx
+  8044f7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8044fa:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  804501:	00 00 00 
+  804504:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804507:	85 c0                	test   %eax,%eax
+  804509:	75 24                	jne    80452f <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80450b:	bf 02 00 00 00       	mov    $0x2,%edi
+  804510:	49 89 df             	mov    %rbx,%r15
+  804513:	48 b8 97 db ff ff ff 	movabs $0xffffffffffffdb97,%rax
+  80451a:	ff ff ff 
+  80451d:	48 01 d8             	add    %rbx,%rax
+  804520:	ff d0                	call   *%rax
+  804522:	48 ba c0 1f 01 00 00 	movabs $0x11fc0,%rdx
+  804529:	00 00 00 
+  80452c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  80452f:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  804536:	00 00 00 
+  804539:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80453c:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80453f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804545:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80454b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804550:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804557:	00 00 00 
+  80455a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80455e:	89 c7                	mov    %eax,%edi
+  804560:	49 89 df             	mov    %rbx,%r15
+  804563:	48 b8 b6 d5 ff ff ff 	movabs $0xffffffffffffd5b6,%rax
+  80456a:	ff ff ff 
+  80456d:	48 01 d8             	add    %rbx,%rax
+  804570:	ff d0                	call   *%rax
+}
+  804572:	48 83 c4 10          	add    $0x10,%rsp
+  804576:	5b                   	pop    %rbx
+  804577:	41 5f                	pop    %r15
+  804579:	5d                   	pop    %rbp
+  80457a:	c3                   	ret
+
+000000000080457b <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  80457b:	55                   	push   %rbp
+  80457c:	48 89 e5             	mov    %rsp,%rbp
+  80457f:	41 57                	push   %r15
+  804581:	53                   	push   %rbx
+  804582:	48 83 ec 20          	sub    $0x20,%rsp
+  804586:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804586 <nsipc_words+0xb>
+  80458d:	49 bb ba 4a 00 00 00 	movabs $0x4aba,%r11
+  804594:	00 00 00 
+  804597:	4c 01 db             	add    %r11,%rbx
+  80459a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80459d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8045a1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8045a5:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  8045ac:	00 00 00 
+  8045af:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8045b2:	85 c0                	test   %eax,%eax
+  8045b4:	75 24                	jne    8045da <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8045b6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8045bb:	49 89 df             	mov    %rbx,%r15
+  8045be:	48 b8 97 db ff ff ff 	movabs $0xffffffffffffdb97,%rax
+  8045c5:	ff ff ff 
+  8045c8:	48 01 d8             	add    %rbx,%rax
+  8045cb:	ff d0                	call   *%rax
+  8045cd:	48 ba c0 1f 01 00 00 	movabs $0x11fc0,%rdx
+  8045d4:	00 00 00 
+  8045d7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8045da:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  8045e1:	00 00 00 
+  8045e4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8045e7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8045eb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8045ef:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8045f2:	89 c7                	mov    %eax,%edi
+  8045f4:	49 89 df             	mov    %rbx,%r15
+  8045f7:	48 b8 a1 d6 ff ff ff 	movabs $0xffffffffffffd6a1,%rax
+  8045fe:	ff ff ff 
+  804601:	48 01 d8             	add    %rbx,%rax
+  804604:	ff d0                	call   *%rax
+}
+  804606:	48 83 c4 20          	add    $0x20,%rsp
+  80460a:	5b                   	pop    %rbx
+  80460b:	41 5f                	pop    %r15
+  80460d:	5d                   	pop    %rbp
+  80460e:	c3                   	ret
+
+000000000080460f <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80460f:	55                   	push   %rbp
+  804610:	48 89 e5             	mov    %rsp,%rbp
+  804613:	41 57                	push   %r15
+  804615:	53                   	push   %rbx
+  804616:	48 83 ec 30          	sub    $0x30,%rsp
+  80461a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80461a <nsipc_accept+0xb>
+  804621:	49 bb 26 4a 00 00 00 	movabs $0x4a26,%r11
+  804628:	00 00 00 
+  80462b:	4c 01 db             	add    %r11,%rbx
+  80462e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804631:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804635:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  804639:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804640:	00 00 00 
+  804643:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804646:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  804649:	bf 01 00 00 00       	mov    $0x1,%edi
+  80464e:	48 b8 98 b4 ff ff ff 	movabs $0xffffffffffffb498,%rax
+  804655:	ff ff ff 
+  804658:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80465c:	ff d0                	call   *%rax
+  80465e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804661:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804665:	78 48                	js     8046af <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  804667:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  80466e:	00 00 00 
+  804671:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804675:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  804679:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80467d:	8b 40 10             	mov    0x10(%rax),%eax
+  804680:	89 c2                	mov    %eax,%edx
+  804682:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804686:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80468a:	48 89 ce             	mov    %rcx,%rsi
+  80468d:	48 89 c7             	mov    %rax,%rdi
+  804690:	49 89 df             	mov    %rbx,%r15
+  804693:	48 b8 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rax
+  80469a:	ff ff ff 
+  80469d:	48 01 d8             	add    %rbx,%rax
+  8046a0:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8046a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046a6:	8b 50 10             	mov    0x10(%rax),%edx
+  8046a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046ad:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8046af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8046b2:	48 83 c4 30          	add    $0x30,%rsp
+  8046b6:	5b                   	pop    %rbx
+  8046b7:	41 5f                	pop    %r15
+  8046b9:	5d                   	pop    %rbp
+  8046ba:	c3                   	ret
+
+00000000008046bb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8046bb:	55                   	push   %rbp
+  8046bc:	48 89 e5             	mov    %rsp,%rbp
+  8046bf:	41 57                	push   %r15
+  8046c1:	53                   	push   %rbx
+  8046c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8046c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046c6 <nsipc_bind+0xb>
+  8046cd:	49 bb 7a 49 00 00 00 	movabs $0x497a,%r11
+  8046d4:	00 00 00 
+  8046d7:	4c 01 db             	add    %r11,%rbx
+  8046da:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8046dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8046e1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8046e4:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8046eb:	00 00 00 
+  8046ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046f1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8046f4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8046f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046fb:	48 89 c6             	mov    %rax,%rsi
+  8046fe:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  804705:	00 00 00 
+  804708:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80470c:	48 89 c7             	mov    %rax,%rdi
+  80470f:	49 89 df             	mov    %rbx,%r15
+  804712:	48 b8 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rax
+  804719:	ff ff ff 
+  80471c:	48 01 d8             	add    %rbx,%rax
+  80471f:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804721:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804728:	00 00 00 
+  80472b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80472e:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804732:	bf 02 00 00 00       	mov    $0x2,%edi
+  804737:	48 b8 98 b4 ff ff ff 	movabs $0xffffffffffffb498,%rax
+  80473e:	ff ff ff 
+  804741:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804745:	ff d0                	call   *%rax
+}
+  804747:	48 83 c4 10          	add    $0x10,%rsp
+  80474b:	5b                   	pop    %rbx
+  80474c:	41 5f                	pop    %r15
+  80474e:	5d                   	pop    %rbp
+  80474f:	c3                   	ret
+
+0000000000804750 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  804750:	55                   	push   %rbp
+  804751:	48 89 e5             	mov    %rsp,%rbp
+  804754:	48 83 ec 20          	sub    $0x20,%rsp
+  804758:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804758 <nsipc_shutdown+0x8>
+  80475f:	49 bb e8 48 00 00 00 	movabs $0x48e8,%r11
+  804766:	00 00 00 
+  804769:	4c 01 d8             	add    %r11,%rax
+  80476c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80476f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  804772:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804775:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  804778:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80477b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80477e:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804782:	ba 08 00 00 00       	mov    $0x8,%edx
+  804787:	48 89 ce             	mov    %rcx,%rsi
+  80478a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80478f:	48 b9 3b b5 ff ff ff 	movabs $0xffffffffffffb53b,%rcx
+  804796:	ff ff ff 
+  804799:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80479d:	ff d0                	call   *%rax
+}
+  80479f:	c9                   	leave
+  8047a0:	c3                   	ret
+
+00000000008047a1 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8047a1:	55                   	push   %rbp
+  8047a2:	48 89 e5             	mov    %rsp,%rbp
+  8047a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8047a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8047a9 <nsipc_close+0x8>
+  8047b0:	49 bb 97 48 00 00 00 	movabs $0x4897,%r11
+  8047b7:	00 00 00 
+  8047ba:	4c 01 d8             	add    %r11,%rax
+  8047bd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8047c0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8047c3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8047c6:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8047ca:	ba 04 00 00 00       	mov    $0x4,%edx
+  8047cf:	48 89 ce             	mov    %rcx,%rsi
+  8047d2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8047d7:	48 b9 3b b5 ff ff ff 	movabs $0xffffffffffffb53b,%rcx
+  8047de:	ff ff ff 
+  8047e1:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8047e5:	ff d0                	call   *%rax
+}
+  8047e7:	c9                   	leave
+  8047e8:	c3                   	ret
+
+00000000008047e9 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8047e9:	55                   	push   %rbp
+  8047ea:	48 89 e5             	mov    %rsp,%rbp
+  8047ed:	41 57                	push   %r15
+  8047ef:	53                   	push   %rbx
+  8047f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8047f4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047f4 <nsipc_connect+0xb>
+  8047fb:	49 bb 4c 48 00 00 00 	movabs $0x484c,%r11
+  804802:	00 00 00 
+  804805:	4c 01 db             	add    %r11,%rbx
+  804808:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80480b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80480f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804812:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804819:	00 00 00 
+  80481c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80481f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804822:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804825:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804829:	48 89 c6             	mov    %rax,%rsi
+  80482c:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  804833:	00 00 00 
+  804836:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80483a:	48 89 c7             	mov    %rax,%rdi
+  80483d:	49 89 df             	mov    %rbx,%r15
+  804840:	48 b8 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rax
+  804847:	ff ff ff 
+  80484a:	48 01 d8             	add    %rbx,%rax
+  80484d:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  80484f:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804856:	00 00 00 
+  804859:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80485c:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  804860:	bf 05 00 00 00       	mov    $0x5,%edi
+  804865:	48 b8 98 b4 ff ff ff 	movabs $0xffffffffffffb498,%rax
+  80486c:	ff ff ff 
+  80486f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804873:	ff d0                	call   *%rax
+}
+  804875:	48 83 c4 10          	add    $0x10,%rsp
+  804879:	5b                   	pop    %rbx
+  80487a:	41 5f                	pop    %r15
+  80487c:	5d                   	pop    %rbp
+  80487d:	c3                   	ret
+
+000000000080487e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80487e:	55                   	push   %rbp
+  80487f:	48 89 e5             	mov    %rsp,%rbp
+  804882:	48 83 ec 20          	sub    $0x20,%rsp
+  804886:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804886 <nsipc_listen+0x8>
+  80488d:	49 bb ba 47 00 00 00 	movabs $0x47ba,%r11
+  804894:	00 00 00 
+  804897:	4c 01 d8             	add    %r11,%rax
+  80489a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80489d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8048a0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8048a3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8048a6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8048a9:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8048ac:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8048b0:	ba 08 00 00 00       	mov    $0x8,%edx
+  8048b5:	48 89 ce             	mov    %rcx,%rsi
+  8048b8:	bf 06 00 00 00       	mov    $0x6,%edi
+  8048bd:	48 b9 3b b5 ff ff ff 	movabs $0xffffffffffffb53b,%rcx
+  8048c4:	ff ff ff 
+  8048c7:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8048cb:	ff d0                	call   *%rax
+}
+  8048cd:	c9                   	leave
+  8048ce:	c3                   	ret
+
+00000000008048cf <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8048cf:	55                   	push   %rbp
+  8048d0:	48 89 e5             	mov    %rsp,%rbp
+  8048d3:	41 57                	push   %r15
+  8048d5:	53                   	push   %rbx
+  8048d6:	48 83 ec 30          	sub    $0x30,%rsp
+  8048da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048da <nsipc_recv+0xb>
+  8048e1:	49 bb 66 47 00 00 00 	movabs $0x4766,%r11
+  8048e8:	00 00 00 
+  8048eb:	4c 01 db             	add    %r11,%rbx
+  8048ee:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8048f1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8048f5:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8048f8:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8048fb:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804902:	00 00 00 
+  804905:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804908:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  80490b:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804912:	00 00 00 
+  804915:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804918:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  80491c:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804923:	00 00 00 
+  804926:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804929:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80492d:	bf 07 00 00 00       	mov    $0x7,%edi
+  804932:	48 b8 98 b4 ff ff ff 	movabs $0xffffffffffffb498,%rax
+  804939:	ff ff ff 
+  80493c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804940:	ff d0                	call   *%rax
+  804942:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804945:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804949:	0f 88 91 00 00 00    	js     8049e0 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  80494f:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  804956:	7f 08                	jg     804960 <nsipc_recv+0x91>
+  804958:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80495b:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  80495e:	7e 50                	jle    8049b0 <nsipc_recv+0xe1>
+  804960:	48 b8 33 e4 ff ff ff 	movabs $0xffffffffffffe433,%rax
+  804967:	ff ff ff 
+  80496a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80496e:	48 89 c1             	mov    %rax,%rcx
+  804971:	48 b8 48 e4 ff ff ff 	movabs $0xffffffffffffe448,%rax
+  804978:	ff ff ff 
+  80497b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80497f:	48 89 c2             	mov    %rax,%rdx
+  804982:	be 79 00 00 00       	mov    $0x79,%esi
+  804987:	48 b8 5d e4 ff ff ff 	movabs $0xffffffffffffe45d,%rax
+  80498e:	ff ff ff 
+  804991:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804995:	48 89 c7             	mov    %rax,%rdi
+  804998:	49 89 df             	mov    %rbx,%r15
+  80499b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049a0:	49 b8 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%r8
+  8049a7:	ff ff ff 
+  8049aa:	49 01 d8             	add    %rbx,%r8
+  8049ad:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8049b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049b3:	48 63 d0             	movslq %eax,%rdx
+  8049b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049ba:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8049c1:	00 00 00 
+  8049c4:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8049c8:	48 89 ce             	mov    %rcx,%rsi
+  8049cb:	48 89 c7             	mov    %rax,%rdi
+  8049ce:	49 89 df             	mov    %rbx,%r15
+  8049d1:	48 b8 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rax
+  8049d8:	ff ff ff 
+  8049db:	48 01 d8             	add    %rbx,%rax
+  8049de:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8049e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8049e3:	48 83 c4 30          	add    $0x30,%rsp
+  8049e7:	5b                   	pop    %rbx
+  8049e8:	41 5f                	pop    %r15
+  8049ea:	5d                   	pop    %rbp
+  8049eb:	c3                   	ret
+
+00000000008049ec <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8049ec:	55                   	push   %rbp
+  8049ed:	48 89 e5             	mov    %rsp,%rbp
+  8049f0:	41 57                	push   %r15
+  8049f2:	53                   	push   %rbx
+  8049f3:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8049fa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049fa <nsipc_send+0xe>
+  804a01:	49 bb 46 46 00 00 00 	movabs $0x4646,%r11
+  804a08:	00 00 00 
+  804a0b:	4c 01 db             	add    %r11,%rbx
+  804a0e:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  804a14:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804a1b:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804a21:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  804a27:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804a2b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804a2f:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  804a36:	00 00 00 
+  804a39:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a3c:	85 c0                	test   %eax,%eax
+  804a3e:	75 24                	jne    804a64 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804a40:	bf 02 00 00 00       	mov    $0x2,%edi
+  804a45:	49 89 df             	mov    %rbx,%r15
+  804a48:	48 b8 97 db ff ff ff 	movabs $0xffffffffffffdb97,%rax
+  804a4f:	ff ff ff 
+  804a52:	48 01 d8             	add    %rbx,%rax
+  804a55:	ff d0                	call   *%rax
+  804a57:	48 ba c0 1f 01 00 00 	movabs $0x11fc0,%rdx
+  804a5e:	00 00 00 
+  804a61:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  804a64:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804a6a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804a6d:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  804a74:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804a77:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804a7a:	39 c2                	cmp    %eax,%edx
+  804a7c:	0f 4e c2             	cmovle %edx,%eax
+  804a7f:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  804a85:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804a8b:	48 63 d0             	movslq %eax,%rdx
+  804a8e:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  804a95:	48 89 c6             	mov    %rax,%rsi
+  804a98:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  804a9f:	00 00 00 
+  804aa2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804aa6:	48 89 c7             	mov    %rax,%rdi
+  804aa9:	49 89 df             	mov    %rbx,%r15
+  804aac:	48 b8 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rax
+  804ab3:	ff ff ff 
+  804ab6:	48 01 d8             	add    %rbx,%rax
+  804ab9:	ff d0                	call   *%rax
+	req->req_s = s;
+  804abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804abf:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804ac5:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804ac7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804acb:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804ad1:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804ad4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ad8:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804ade:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804ae1:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  804ae8:	00 00 00 
+  804aeb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804aef:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804af3:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804afa:	00 
+  804afb:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804b01:	48 63 d0             	movslq %eax,%rdx
+  804b04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b08:	48 01 d0             	add    %rdx,%rax
+  804b0b:	48 83 e8 01          	sub    $0x1,%rax
+  804b0f:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804b13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b17:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b1c:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804b20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b24:	48 29 d0             	sub    %rdx,%rax
+  804b27:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804b2d:	85 c0                	test   %eax,%eax
+  804b2f:	0f 48 c2             	cmovs  %edx,%eax
+  804b32:	c1 f8 0c             	sar    $0xc,%eax
+  804b35:	48 98                	cltq
+  804b37:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804b3b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804b3f:	48 85 c0             	test   %rax,%rax
+  804b42:	0f 95 c0             	setne  %al
+  804b45:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804b48:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804b4f:	00 
+  804b50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b54:	48 83 c0 0b          	add    $0xb,%rax
+  804b58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804b5c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b60:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b65:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804b69:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b6d:	48 29 d0             	sub    %rdx,%rax
+  804b70:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804b74:	89 c7                	mov    %eax,%edi
+  804b76:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  804b7d:	00 00 00 
+  804b80:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b83:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804b87:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804b8b:	48 83 ec 08          	sub    $0x8,%rsp
+  804b8f:	6a 00                	push   $0x0
+  804b91:	6a 00                	push   $0x0
+  804b93:	6a 05                	push   $0x5
+  804b95:	41 89 f1             	mov    %esi,%r9d
+  804b98:	49 89 c8             	mov    %rcx,%r8
+  804b9b:	89 f9                	mov    %edi,%ecx
+  804b9d:	be 08 00 00 00       	mov    $0x8,%esi
+  804ba2:	89 c7                	mov    %eax,%edi
+  804ba4:	49 89 df             	mov    %rbx,%r15
+  804ba7:	48 b8 9f d7 ff ff ff 	movabs $0xffffffffffffd79f,%rax
+  804bae:	ff ff ff 
+  804bb1:	48 01 d8             	add    %rbx,%rax
+  804bb4:	ff d0                	call   *%rax
+  804bb6:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804bba:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804bbe:	5b                   	pop    %rbx
+  804bbf:	41 5f                	pop    %r15
+  804bc1:	5d                   	pop    %rbp
+  804bc2:	c3                   	ret
+
+0000000000804bc3 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804bc3:	55                   	push   %rbp
+  804bc4:	48 89 e5             	mov    %rsp,%rbp
+  804bc7:	48 83 ec 10          	sub    $0x10,%rsp
+  804bcb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804bcb <nsipc_socket+0x8>
+  804bd2:	49 bb 75 44 00 00 00 	movabs $0x4475,%r11
+  804bd9:	00 00 00 
+  804bdc:	4c 01 d8             	add    %r11,%rax
+  804bdf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804be2:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804be5:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804be8:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  804bef:	00 00 00 
+  804bf2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804bf5:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804bf8:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  804bff:	00 00 00 
+  804c02:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804c05:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804c09:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  804c10:	00 00 00 
+  804c13:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804c16:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804c1a:	bf 09 00 00 00       	mov    $0x9,%edi
+  804c1f:	48 ba 98 b4 ff ff ff 	movabs $0xffffffffffffb498,%rdx
+  804c26:	ff ff ff 
+  804c29:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804c2d:	ff d0                	call   *%rax
+}
+  804c2f:	c9                   	leave
+  804c30:	c3                   	ret
+
+0000000000804c31 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804c31:	55                   	push   %rbp
+  804c32:	48 89 e5             	mov    %rsp,%rbp
+  804c35:	41 57                	push   %r15
+  804c37:	53                   	push   %rbx
+  804c38:	48 83 ec 30          	sub    $0x30,%rsp
+  804c3c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c3c <pipe+0xb>
+  804c43:	49 bb 04 44 00 00 00 	movabs $0x4404,%r11
+  804c4a:	00 00 00 
+  804c4d:	4c 01 db             	add    %r11,%rbx
+  804c50:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804c54:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804c58:	48 89 c7             	mov    %rax,%rdi
+  804c5b:	49 89 df             	mov    %rbx,%r15
+  804c5e:	48 b8 b2 98 ff ff ff 	movabs $0xffffffffffff98b2,%rax
+  804c65:	ff ff ff 
+  804c68:	48 01 d8             	add    %rbx,%rax
+  804c6b:	ff d0                	call   *%rax
+  804c6d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c70:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c74:	0f 88 12 02 00 00    	js     804e8c <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c7e:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c83:	48 89 c6             	mov    %rax,%rsi
+  804c86:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c8b:	49 89 df             	mov    %rbx,%r15
+  804c8e:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  804c95:	ff ff ff 
+  804c98:	48 01 d8             	add    %rbx,%rax
+  804c9b:	ff d0                	call   *%rax
+  804c9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ca0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ca4:	0f 88 e2 01 00 00    	js     804e8c <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804caa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804cae:	48 89 c7             	mov    %rax,%rdi
+  804cb1:	49 89 df             	mov    %rbx,%r15
+  804cb4:	48 b8 b2 98 ff ff ff 	movabs $0xffffffffffff98b2,%rax
+  804cbb:	ff ff ff 
+  804cbe:	48 01 d8             	add    %rbx,%rax
+  804cc1:	ff d0                	call   *%rax
+  804cc3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cc6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cca:	0f 88 9b 01 00 00    	js     804e6b <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804cd0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cd4:	ba 07 04 00 00       	mov    $0x407,%edx
+  804cd9:	48 89 c6             	mov    %rax,%rsi
+  804cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ce1:	49 89 df             	mov    %rbx,%r15
+  804ce4:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  804ceb:	ff ff ff 
+  804cee:	48 01 d8             	add    %rbx,%rax
+  804cf1:	ff d0                	call   *%rax
+  804cf3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cf6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cfa:	0f 88 6b 01 00 00    	js     804e6b <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804d00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d04:	48 89 c7             	mov    %rax,%rdi
+  804d07:	49 89 df             	mov    %rbx,%r15
+  804d0a:	48 b8 6f 98 ff ff ff 	movabs $0xffffffffffff986f,%rax
+  804d11:	ff ff ff 
+  804d14:	48 01 d8             	add    %rbx,%rax
+  804d17:	ff d0                	call   *%rax
+  804d19:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804d1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d21:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d26:	48 89 c6             	mov    %rax,%rsi
+  804d29:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d2e:	49 89 df             	mov    %rbx,%r15
+  804d31:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  804d38:	ff ff ff 
+  804d3b:	48 01 d8             	add    %rbx,%rax
+  804d3e:	ff d0                	call   *%rax
+  804d40:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d43:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d47:	0f 88 fd 00 00 00    	js     804e4a <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804d4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d51:	48 89 c7             	mov    %rax,%rdi
+  804d54:	49 89 df             	mov    %rbx,%r15
+  804d57:	48 b8 6f 98 ff ff ff 	movabs $0xffffffffffff986f,%rax
+  804d5e:	ff ff ff 
+  804d61:	48 01 d8             	add    %rbx,%rax
+  804d64:	ff d0                	call   *%rax
+  804d66:	48 89 c2             	mov    %rax,%rdx
+  804d69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d6d:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804d73:	48 89 d1             	mov    %rdx,%rcx
+  804d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d7b:	48 89 c6             	mov    %rax,%rsi
+  804d7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d83:	49 89 df             	mov    %rbx,%r15
+  804d86:	48 b8 f4 90 ff ff ff 	movabs $0xffffffffffff90f4,%rax
+  804d8d:	ff ff ff 
+  804d90:	48 01 d8             	add    %rbx,%rax
+  804d93:	ff d0                	call   *%rax
+  804d95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d9c:	0f 88 87 00 00 00    	js     804e29 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804da2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804da6:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  804dad:	00 00 00 
+  804db0:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804db3:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804db5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804db9:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804dc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804dc4:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  804dcb:	00 00 00 
+  804dce:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804dd1:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804dd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804dd7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804dde:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804de2:	48 89 c7             	mov    %rax,%rdi
+  804de5:	49 89 df             	mov    %rbx,%r15
+  804de8:	48 b8 38 98 ff ff ff 	movabs $0xffffffffffff9838,%rax
+  804def:	ff ff ff 
+  804df2:	48 01 d8             	add    %rbx,%rax
+  804df5:	ff d0                	call   *%rax
+  804df7:	89 c2                	mov    %eax,%edx
+  804df9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dfd:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804dff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e03:	48 89 c7             	mov    %rax,%rdi
+  804e06:	49 89 df             	mov    %rbx,%r15
+  804e09:	48 b8 38 98 ff ff ff 	movabs $0xffffffffffff9838,%rax
+  804e10:	ff ff ff 
+  804e13:	48 01 d8             	add    %rbx,%rax
+  804e16:	ff d0                	call   *%rax
+  804e18:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e1c:	48 83 c2 04          	add    $0x4,%rdx
+  804e20:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e27:	eb 67                	jmp    804e90 <pipe+0x25f>
+		goto err3;
+  804e29:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804e2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e2e:	48 89 c6             	mov    %rax,%rsi
+  804e31:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e36:	49 89 df             	mov    %rbx,%r15
+  804e39:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  804e40:	ff ff ff 
+  804e43:	48 01 d8             	add    %rbx,%rax
+  804e46:	ff d0                	call   *%rax
+  804e48:	eb 01                	jmp    804e4b <pipe+0x21a>
+		goto err2;
+  804e4a:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804e4b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e4f:	48 89 c6             	mov    %rax,%rsi
+  804e52:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e57:	49 89 df             	mov    %rbx,%r15
+  804e5a:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  804e61:	ff ff ff 
+  804e64:	48 01 d8             	add    %rbx,%rax
+  804e67:	ff d0                	call   *%rax
+  804e69:	eb 01                	jmp    804e6c <pipe+0x23b>
+		goto err1;
+  804e6b:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804e6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e70:	48 89 c6             	mov    %rax,%rsi
+  804e73:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e78:	49 89 df             	mov    %rbx,%r15
+  804e7b:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  804e82:	ff ff ff 
+  804e85:	48 01 d8             	add    %rbx,%rax
+  804e88:	ff d0                	call   *%rax
+  804e8a:	eb 01                	jmp    804e8d <pipe+0x25c>
+		goto err;
+  804e8c:	90                   	nop
+err:
+	return r;
+  804e8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804e90:	48 83 c4 30          	add    $0x30,%rsp
+  804e94:	5b                   	pop    %rbx
+  804e95:	41 5f                	pop    %r15
+  804e97:	5d                   	pop    %rbp
+  804e98:	c3                   	ret
+
+0000000000804e99 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804e99:	55                   	push   %rbp
+  804e9a:	48 89 e5             	mov    %rsp,%rbp
+  804e9d:	41 57                	push   %r15
+  804e9f:	41 54                	push   %r12
+  804ea1:	53                   	push   %rbx
+  804ea2:	48 83 ec 28          	sub    $0x28,%rsp
+  804ea6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ea6 <_pipeisclosed+0xd>
+  804ead:	49 bb 9a 41 00 00 00 	movabs $0x419a,%r11
+  804eb4:	00 00 00 
+  804eb7:	4c 01 db             	add    %r11,%rbx
+  804eba:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804ebe:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804ec2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804ec9:	ff ff ff 
+  804ecc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804ed0:	48 8b 00             	mov    (%rax),%rax
+  804ed3:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804ed9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  804edc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ee0:	48 89 c7             	mov    %rax,%rdi
+  804ee3:	49 89 df             	mov    %rbx,%r15
+  804ee6:	48 b8 26 dc ff ff ff 	movabs $0xffffffffffffdc26,%rax
+  804eed:	ff ff ff 
+  804ef0:	48 01 d8             	add    %rbx,%rax
+  804ef3:	ff d0                	call   *%rax
+  804ef5:	41 89 c4             	mov    %eax,%r12d
+  804ef8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804efc:	48 89 c7             	mov    %rax,%rdi
+  804eff:	49 89 df             	mov    %rbx,%r15
+  804f02:	48 b8 26 dc ff ff ff 	movabs $0xffffffffffffdc26,%rax
+  804f09:	ff ff ff 
+  804f0c:	48 01 d8             	add    %rbx,%rax
+  804f0f:	ff d0                	call   *%rax
+  804f11:	41 39 c4             	cmp    %eax,%r12d
+  804f14:	0f 94 c0             	sete   %al
+  804f17:	0f b6 c0             	movzbl %al,%eax
+  804f1a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  804f1d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804f24:	ff ff ff 
+  804f27:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f2b:	48 8b 00             	mov    (%rax),%rax
+  804f2e:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804f34:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  804f37:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f3a:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804f3d:	75 05                	jne    804f44 <_pipeisclosed+0xab>
+			return ret;
+  804f3f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804f42:	eb 63                	jmp    804fa7 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  804f44:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f47:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804f4a:	0f 84 72 ff ff ff    	je     804ec2 <_pipeisclosed+0x29>
+  804f50:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  804f54:	0f 85 68 ff ff ff    	jne    804ec2 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804f5a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804f61:	ff ff ff 
+  804f64:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f68:	48 8b 00             	mov    (%rax),%rax
+  804f6b:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  804f71:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804f74:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f77:	89 c6                	mov    %eax,%esi
+  804f79:	48 b8 6e e4 ff ff ff 	movabs $0xffffffffffffe46e,%rax
+  804f80:	ff ff ff 
+  804f83:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f87:	48 89 c7             	mov    %rax,%rdi
+  804f8a:	49 89 df             	mov    %rbx,%r15
+  804f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f92:	49 b8 11 76 ff ff ff 	movabs $0xffffffffffff7611,%r8
+  804f99:	ff ff ff 
+  804f9c:	49 01 d8             	add    %rbx,%r8
+  804f9f:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  804fa2:	e9 1b ff ff ff       	jmp    804ec2 <_pipeisclosed+0x29>
+	}
+}
+  804fa7:	48 83 c4 28          	add    $0x28,%rsp
+  804fab:	5b                   	pop    %rbx
+  804fac:	41 5c                	pop    %r12
+  804fae:	41 5f                	pop    %r15
+  804fb0:	5d                   	pop    %rbp
+  804fb1:	c3                   	ret
+
+0000000000804fb2 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  804fb2:	55                   	push   %rbp
+  804fb3:	48 89 e5             	mov    %rsp,%rbp
+  804fb6:	41 57                	push   %r15
+  804fb8:	53                   	push   %rbx
+  804fb9:	48 83 ec 30          	sub    $0x30,%rsp
+  804fbd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fbd <pipeisclosed+0xb>
+  804fc4:	49 bb 83 40 00 00 00 	movabs $0x4083,%r11
+  804fcb:	00 00 00 
+  804fce:	4c 01 db             	add    %r11,%rbx
+  804fd1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804fd4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804fd8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804fdb:	48 89 d6             	mov    %rdx,%rsi
+  804fde:	89 c7                	mov    %eax,%edi
+  804fe0:	49 89 df             	mov    %rbx,%r15
+  804fe3:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  804fea:	ff ff ff 
+  804fed:	48 01 d8             	add    %rbx,%rax
+  804ff0:	ff d0                	call   *%rax
+  804ff2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ff5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ff9:	79 05                	jns    805000 <pipeisclosed+0x4e>
+		return r;
+  804ffb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ffe:	eb 3b                	jmp    80503b <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805000:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805004:	48 89 c7             	mov    %rax,%rdi
+  805007:	49 89 df             	mov    %rbx,%r15
+  80500a:	48 b8 6f 98 ff ff ff 	movabs $0xffffffffffff986f,%rax
+  805011:	ff ff ff 
+  805014:	48 01 d8             	add    %rbx,%rax
+  805017:	ff d0                	call   *%rax
+  805019:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80501d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805021:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805025:	48 89 d6             	mov    %rdx,%rsi
+  805028:	48 89 c7             	mov    %rax,%rdi
+  80502b:	48 b8 59 be ff ff ff 	movabs $0xffffffffffffbe59,%rax
+  805032:	ff ff ff 
+  805035:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805039:	ff d0                	call   *%rax
+}
+  80503b:	48 83 c4 30          	add    $0x30,%rsp
+  80503f:	5b                   	pop    %rbx
+  805040:	41 5f                	pop    %r15
+  805042:	5d                   	pop    %rbp
+  805043:	c3                   	ret
+
+0000000000805044 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805044:	55                   	push   %rbp
+  805045:	48 89 e5             	mov    %rsp,%rbp
+  805048:	41 57                	push   %r15
+  80504a:	53                   	push   %rbx
+  80504b:	48 83 ec 40          	sub    $0x40,%rsp
+  80504f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80504f <devpipe_read+0xb>
+  805056:	49 bb f1 3f 00 00 00 	movabs $0x3ff1,%r11
+  80505d:	00 00 00 
+  805060:	4c 01 db             	add    %r11,%rbx
+  805063:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805067:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80506b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  80506f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805073:	48 89 c7             	mov    %rax,%rdi
+  805076:	49 89 df             	mov    %rbx,%r15
+  805079:	48 b8 6f 98 ff ff ff 	movabs $0xffffffffffff986f,%rax
+  805080:	ff ff ff 
+  805083:	48 01 d8             	add    %rbx,%rax
+  805086:	ff d0                	call   *%rax
+  805088:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80508c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805090:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805094:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80509b:	00 
+  80509c:	e9 a1 00 00 00       	jmp    805142 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8050a1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8050a6:	74 09                	je     8050b1 <devpipe_read+0x6d>
+				return i;
+  8050a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050ac:	e9 9f 00 00 00       	jmp    805150 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8050b1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8050b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050b9:	48 89 d6             	mov    %rdx,%rsi
+  8050bc:	48 89 c7             	mov    %rax,%rdi
+  8050bf:	48 b8 59 be ff ff ff 	movabs $0xffffffffffffbe59,%rax
+  8050c6:	ff ff ff 
+  8050c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050cd:	ff d0                	call   *%rax
+  8050cf:	85 c0                	test   %eax,%eax
+  8050d1:	74 07                	je     8050da <devpipe_read+0x96>
+				return 0;
+  8050d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050d8:	eb 76                	jmp    805150 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8050da:	49 89 df             	mov    %rbx,%r15
+  8050dd:	48 b8 3a 90 ff ff ff 	movabs $0xffffffffffff903a,%rax
+  8050e4:	ff ff ff 
+  8050e7:	48 01 d8             	add    %rbx,%rax
+  8050ea:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8050ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050f0:	8b 10                	mov    (%rax),%edx
+  8050f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050f6:	8b 40 04             	mov    0x4(%rax),%eax
+  8050f9:	39 c2                	cmp    %eax,%edx
+  8050fb:	74 a4                	je     8050a1 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8050fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805101:	8b 10                	mov    (%rax),%edx
+  805103:	89 d0                	mov    %edx,%eax
+  805105:	c1 f8 1f             	sar    $0x1f,%eax
+  805108:	c1 e8 1b             	shr    $0x1b,%eax
+  80510b:	01 c2                	add    %eax,%edx
+  80510d:	83 e2 1f             	and    $0x1f,%edx
+  805110:	29 c2                	sub    %eax,%edx
+  805112:	89 d6                	mov    %edx,%esi
+  805114:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805118:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80511c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805120:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805124:	48 63 c6             	movslq %esi,%rax
+  805127:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  80512c:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  80512e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805132:	8b 00                	mov    (%rax),%eax
+  805134:	8d 50 01             	lea    0x1(%rax),%edx
+  805137:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80513b:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80513d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805142:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805146:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80514a:	72 a0                	jb     8050ec <devpipe_read+0xa8>
+	}
+	return i;
+  80514c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805150:	48 83 c4 40          	add    $0x40,%rsp
+  805154:	5b                   	pop    %rbx
+  805155:	41 5f                	pop    %r15
+  805157:	5d                   	pop    %rbp
+  805158:	c3                   	ret
+
+0000000000805159 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805159:	55                   	push   %rbp
+  80515a:	48 89 e5             	mov    %rsp,%rbp
+  80515d:	41 57                	push   %r15
+  80515f:	53                   	push   %rbx
+  805160:	48 83 ec 40          	sub    $0x40,%rsp
+  805164:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805164 <devpipe_write+0xb>
+  80516b:	49 bb dc 3e 00 00 00 	movabs $0x3edc,%r11
+  805172:	00 00 00 
+  805175:	4c 01 db             	add    %r11,%rbx
+  805178:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80517c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805180:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805184:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805188:	48 89 c7             	mov    %rax,%rdi
+  80518b:	49 89 df             	mov    %rbx,%r15
+  80518e:	48 b8 6f 98 ff ff ff 	movabs $0xffffffffffff986f,%rax
+  805195:	ff ff ff 
+  805198:	48 01 d8             	add    %rbx,%rax
+  80519b:	ff d0                	call   *%rax
+  80519d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8051a1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8051a5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8051a9:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8051b0:	00 
+  8051b1:	e9 a0 00 00 00       	jmp    805256 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8051b6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051be:	48 89 d6             	mov    %rdx,%rsi
+  8051c1:	48 89 c7             	mov    %rax,%rdi
+  8051c4:	48 b8 59 be ff ff ff 	movabs $0xffffffffffffbe59,%rax
+  8051cb:	ff ff ff 
+  8051ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051d2:	ff d0                	call   *%rax
+  8051d4:	85 c0                	test   %eax,%eax
+  8051d6:	74 0a                	je     8051e2 <devpipe_write+0x89>
+				return 0;
+  8051d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051dd:	e9 82 00 00 00       	jmp    805264 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8051e2:	49 89 df             	mov    %rbx,%r15
+  8051e5:	48 b8 3a 90 ff ff ff 	movabs $0xffffffffffff903a,%rax
+  8051ec:	ff ff ff 
+  8051ef:	48 01 d8             	add    %rbx,%rax
+  8051f2:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8051f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051f8:	8b 40 04             	mov    0x4(%rax),%eax
+  8051fb:	48 63 d0             	movslq %eax,%rdx
+  8051fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805202:	8b 00                	mov    (%rax),%eax
+  805204:	48 98                	cltq
+  805206:	48 83 c0 20          	add    $0x20,%rax
+  80520a:	48 39 c2             	cmp    %rax,%rdx
+  80520d:	73 a7                	jae    8051b6 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80520f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805213:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805217:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80521b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80521f:	8b 50 04             	mov    0x4(%rax),%edx
+  805222:	89 d0                	mov    %edx,%eax
+  805224:	c1 f8 1f             	sar    $0x1f,%eax
+  805227:	c1 e8 1b             	shr    $0x1b,%eax
+  80522a:	01 c2                	add    %eax,%edx
+  80522c:	83 e2 1f             	and    $0x1f,%edx
+  80522f:	29 c2                	sub    %eax,%edx
+  805231:	89 d0                	mov    %edx,%eax
+  805233:	0f b6 09             	movzbl (%rcx),%ecx
+  805236:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80523a:	48 98                	cltq
+  80523c:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805240:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805244:	8b 40 04             	mov    0x4(%rax),%eax
+  805247:	8d 50 01             	lea    0x1(%rax),%edx
+  80524a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80524e:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805251:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805256:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80525a:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80525e:	72 94                	jb     8051f4 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805260:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805264:	48 83 c4 40          	add    $0x40,%rsp
+  805268:	5b                   	pop    %rbx
+  805269:	41 5f                	pop    %r15
+  80526b:	5d                   	pop    %rbp
+  80526c:	c3                   	ret
+
+000000000080526d <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80526d:	55                   	push   %rbp
+  80526e:	48 89 e5             	mov    %rsp,%rbp
+  805271:	41 57                	push   %r15
+  805273:	53                   	push   %rbx
+  805274:	48 83 ec 20          	sub    $0x20,%rsp
+  805278:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805278 <devpipe_stat+0xb>
+  80527f:	49 bb c8 3d 00 00 00 	movabs $0x3dc8,%r11
+  805286:	00 00 00 
+  805289:	4c 01 db             	add    %r11,%rbx
+  80528c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805290:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805294:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805298:	48 89 c7             	mov    %rax,%rdi
+  80529b:	49 89 df             	mov    %rbx,%r15
+  80529e:	48 b8 6f 98 ff ff ff 	movabs $0xffffffffffff986f,%rax
+  8052a5:	ff ff ff 
+  8052a8:	48 01 d8             	add    %rbx,%rax
+  8052ab:	ff d0                	call   *%rax
+  8052ad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8052b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052b5:	48 ba 81 e4 ff ff ff 	movabs $0xffffffffffffe481,%rdx
+  8052bc:	ff ff ff 
+  8052bf:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8052c3:	48 89 d6             	mov    %rdx,%rsi
+  8052c6:	48 89 c7             	mov    %rax,%rdi
+  8052c9:	49 89 df             	mov    %rbx,%r15
+  8052cc:	48 b8 d3 83 ff ff ff 	movabs $0xffffffffffff83d3,%rax
+  8052d3:	ff ff ff 
+  8052d6:	48 01 d8             	add    %rbx,%rax
+  8052d9:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8052db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052df:	8b 50 04             	mov    0x4(%rax),%edx
+  8052e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052e6:	8b 00                	mov    (%rax),%eax
+  8052e8:	29 c2                	sub    %eax,%edx
+  8052ea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052ee:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8052f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8052f8:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8052ff:	00 00 00 
+	stat->st_dev = &devpipe;
+  805302:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805306:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  80530d:	00 00 00 
+  805310:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805314:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80531b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805320:	48 83 c4 20          	add    $0x20,%rsp
+  805324:	5b                   	pop    %rbx
+  805325:	41 5f                	pop    %r15
+  805327:	5d                   	pop    %rbp
+  805328:	c3                   	ret
+
+0000000000805329 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805329:	55                   	push   %rbp
+  80532a:	48 89 e5             	mov    %rsp,%rbp
+  80532d:	41 57                	push   %r15
+  80532f:	53                   	push   %rbx
+  805330:	48 83 ec 10          	sub    $0x10,%rsp
+  805334:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805334 <devpipe_close+0xb>
+  80533b:	49 bb 0c 3d 00 00 00 	movabs $0x3d0c,%r11
+  805342:	00 00 00 
+  805345:	4c 01 db             	add    %r11,%rbx
+  805348:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80534c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805350:	48 89 c6             	mov    %rax,%rsi
+  805353:	bf 00 00 00 00       	mov    $0x0,%edi
+  805358:	49 89 df             	mov    %rbx,%r15
+  80535b:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  805362:	ff ff ff 
+  805365:	48 01 d8             	add    %rbx,%rax
+  805368:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80536a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80536e:	48 89 c7             	mov    %rax,%rdi
+  805371:	49 89 df             	mov    %rbx,%r15
+  805374:	48 b8 6f 98 ff ff ff 	movabs $0xffffffffffff986f,%rax
+  80537b:	ff ff ff 
+  80537e:	48 01 d8             	add    %rbx,%rax
+  805381:	ff d0                	call   *%rax
+  805383:	48 89 c6             	mov    %rax,%rsi
+  805386:	bf 00 00 00 00       	mov    $0x0,%edi
+  80538b:	49 89 df             	mov    %rbx,%r15
+  80538e:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  805395:	ff ff ff 
+  805398:	48 01 d8             	add    %rbx,%rax
+  80539b:	ff d0                	call   *%rax
+}
+  80539d:	48 83 c4 10          	add    $0x10,%rsp
+  8053a1:	5b                   	pop    %rbx
+  8053a2:	41 5f                	pop    %r15
+  8053a4:	5d                   	pop    %rbp
+  8053a5:	c3                   	ret
+
+00000000008053a6 <bench_workers>:
+
+// Runs fn(id) in 'n' forked workers, worker id pinned to CPU id where
+// there is one, and returns the milliseconds until all have finished.
+unsigned
+bench_workers(int n, void (*fn)(int id))
+{
+  8053a6:	55                   	push   %rbp
+  8053a7:	48 89 e5             	mov    %rsp,%rbp
+  8053aa:	41 57                	push   %r15
+  8053ac:	53                   	push   %rbx
+  8053ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8053b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053b1 <bench_workers+0xb>
+  8053b8:	49 bb 8f 3c 00 00 00 	movabs $0x3c8f,%r11
+  8053bf:	00 00 00 
+  8053c2:	4c 01 db             	add    %r11,%rbx
+  8053c5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8053c8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	envid_t parent = sys_getenvid();
+  8053cc:	49 89 df             	mov    %rbx,%r15
+  8053cf:	48 b8 e6 8f ff ff ff 	movabs $0xffffffffffff8fe6,%rax
+  8053d6:	ff ff ff 
+  8053d9:	48 01 d8             	add    %rbx,%rax
+  8053dc:	ff d0                	call   *%rax
+  8053de:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	unsigned start;
+	int i, r;
+
+	start = sys_time_msec();
+  8053e1:	49 89 df             	mov    %rbx,%r15
+  8053e4:	48 b8 b6 95 ff ff ff 	movabs $0xffffffffffff95b6,%rax
+  8053eb:	ff ff ff 
+  8053ee:	48 01 d8             	add    %rbx,%rax
+  8053f1:	ff d0                	call   *%rax
+  8053f3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	for (i = 0; i < n; i++) {
+  8053f6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8053fd:	e9 d1 00 00 00       	jmp    8054d3 <bench_workers+0x12d>
+		if ((r = fork()) < 0)
+  805402:	49 89 df             	mov    %rbx,%r15
+  805405:	48 b8 b4 d0 ff ff ff 	movabs $0xffffffffffffd0b4,%rax
+  80540c:	ff ff ff 
+  80540f:	48 01 d8             	add    %rbx,%rax
+  805412:	ff d0                	call   *%rax
+  805414:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  805417:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80541b:	79 44                	jns    805461 <bench_workers+0xbb>
+			panic("fork: %e", r);
+  80541d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805420:	89 c1                	mov    %eax,%ecx
+  805422:	48 b8 88 e4 ff ff ff 	movabs $0xffffffffffffe488,%rax
+  805429:	ff ff ff 
+  80542c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805430:	48 89 c2             	mov    %rax,%rdx
+  805433:	be 0f 00 00 00       	mov    $0xf,%esi
+  805438:	48 b8 91 e4 ff ff ff 	movabs $0xffffffffffffe491,%rax
+  80543f:	ff ff ff 
+  805442:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805446:	48 89 c7             	mov    %rax,%rdi
+  805449:	49 89 df             	mov    %rbx,%r15
+  80544c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805451:	49 b8 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%r8
+  805458:	ff ff ff 
+  80545b:	49 01 d8             	add    %rbx,%r8
+  80545e:	41 ff d0             	call   *%r8
+		if (r == 0) {
+  805461:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805465:	75 68                	jne    8054cf <bench_workers+0x129>
+			// Fails harmlessly on machines with fewer CPUs.
+			sys_env_set_affinity(0, 1 << i);
+  805467:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80546a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80546f:	89 c1                	mov    %eax,%ecx
+  805471:	d3 e2                	shl    %cl,%edx
+  805473:	89 d0                	mov    %edx,%eax
+  805475:	89 c6                	mov    %eax,%esi
+  805477:	bf 00 00 00 00       	mov    $0x0,%edi
+  80547c:	49 89 df             	mov    %rbx,%r15
+  80547f:	48 b8 59 95 ff ff ff 	movabs $0xffffffffffff9559,%rax
+  805486:	ff ff ff 
+  805489:	48 01 d8             	add    %rbx,%rax
+  80548c:	ff d0                	call   *%rax
+			fn(i);
+  80548e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805491:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805495:	89 c7                	mov    %eax,%edi
+  805497:	ff d2                	call   *%rdx
+			ipc_send(parent, i, 0, 0);
+  805499:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80549c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80549f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8054a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054a9:	89 c7                	mov    %eax,%edi
+  8054ab:	49 89 df             	mov    %rbx,%r15
+  8054ae:	48 b8 43 d5 ff ff ff 	movabs $0xffffffffffffd543,%rax
+  8054b5:	ff ff ff 
+  8054b8:	48 01 d8             	add    %rbx,%rax
+  8054bb:	ff d0                	call   *%rax
+			exit();
+  8054bd:	49 89 df             	mov    %rbx,%r15
+  8054c0:	48 b8 f0 72 ff ff ff 	movabs $0xffffffffffff72f0,%rax
+  8054c7:	ff ff ff 
+  8054ca:	48 01 d8             	add    %rbx,%rax
+  8054cd:	ff d0                	call   *%rax
+	for (i = 0; i < n; i++) {
+  8054cf:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8054d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054d6:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  8054d9:	0f 8c 23 ff ff ff    	jl     805402 <bench_workers+0x5c>
+		}
+	}
+	for (i = 0; i < n; i++)
+  8054df:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8054e6:	eb 25                	jmp    80550d <bench_workers+0x167>
+		ipc_recv(0, 0, 0);
+  8054e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8054f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054f7:	49 89 df             	mov    %rbx,%r15
+  8054fa:	48 b8 5a d4 ff ff ff 	movabs $0xffffffffffffd45a,%rax
+  805501:	ff ff ff 
+  805504:	48 01 d8             	add    %rbx,%rax
+  805507:	ff d0                	call   *%rax
+	for (i = 0; i < n; i++)
+  805509:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80550d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805510:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  805513:	7c d3                	jl     8054e8 <bench_workers+0x142>
+	return sys_time_msec() - start;
+  805515:	49 89 df             	mov    %rbx,%r15
+  805518:	48 b8 b6 95 ff ff ff 	movabs $0xffffffffffff95b6,%rax
+  80551f:	ff ff ff 
+  805522:	48 01 d8             	add    %rbx,%rax
+  805525:	ff d0                	call   *%rax
+  805527:	2b 45 e4             	sub    -0x1c(%rbp),%eax
+}
+  80552a:	48 83 c4 20          	add    $0x20,%rsp
+  80552e:	5b                   	pop    %rbx
+  80552f:	41 5f                	pop    %r15
+  805531:	5d                   	pop    %rbp
+  805532:	c3                   	ret
+
+0000000000805533 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  805533:	55                   	push   %rbp
+  805534:	48 89 e5             	mov    %rsp,%rbp
+  805537:	41 57                	push   %r15
+  805539:	48 83 ec 28          	sub    $0x28,%rsp
+  80553d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80553d <cputchar+0xa>
+  805544:	49 bb 03 3b 00 00 00 	movabs $0x3b03,%r11
+  80554b:	00 00 00 
+  80554e:	4c 01 d8             	add    %r11,%rax
+  805551:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  805554:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805557:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  80555a:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  80555e:	be 01 00 00 00       	mov    $0x1,%esi
+  805563:	48 89 d7             	mov    %rdx,%rdi
+  805566:	49 89 c7             	mov    %rax,%r15
+  805569:	48 ba d7 8e ff ff ff 	movabs $0xffffffffffff8ed7,%rdx
+  805570:	ff ff ff 
+  805573:	48 01 c2             	add    %rax,%rdx
+  805576:	ff d2                	call   *%rdx
+}
+  805578:	90                   	nop
+  805579:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80557d:	c9                   	leave
+  80557e:	c3                   	ret
+
+000000000080557f <getchar>:
+
+int
+getchar(void)
+{
+  80557f:	55                   	push   %rbp
+  805580:	48 89 e5             	mov    %rsp,%rbp
+  805583:	41 57                	push   %r15
+  805585:	48 83 ec 18          	sub    $0x18,%rsp
+  805589:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805589 <getchar+0xa>
+  805590:	49 bb b7 3a 00 00 00 	movabs $0x3ab7,%r11
+  805597:	00 00 00 
+  80559a:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  80559d:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8055a1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8055a6:	48 89 ce             	mov    %rcx,%rsi
+  8055a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055ae:	49 89 c7             	mov    %rax,%r15
+  8055b1:	48 b9 af 9e ff ff ff 	movabs $0xffffffffffff9eaf,%rcx
+  8055b8:	ff ff ff 
+  8055bb:	48 01 c1             	add    %rax,%rcx
+  8055be:	ff d1                	call   *%rcx
+  8055c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8055c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055c7:	79 05                	jns    8055ce <getchar+0x4f>
+		return r;
+  8055c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055cc:	eb 14                	jmp    8055e2 <getchar+0x63>
+	if (r < 1)
+  8055ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055d2:	7f 07                	jg     8055db <getchar+0x5c>
+		return -E_EOF;
+  8055d4:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8055d9:	eb 07                	jmp    8055e2 <getchar+0x63>
+	return c;
+  8055db:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8055df:	0f b6 c0             	movzbl %al,%eax
+}
+  8055e2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8055e6:	c9                   	leave
+  8055e7:	c3                   	ret
+
+00000000008055e8 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8055e8:	55                   	push   %rbp
+  8055e9:	48 89 e5             	mov    %rsp,%rbp
+  8055ec:	41 57                	push   %r15
+  8055ee:	53                   	push   %rbx
+  8055ef:	48 83 ec 20          	sub    $0x20,%rsp
+  8055f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055f3 <iscons+0xb>
+  8055fa:	49 bb 4d 3a 00 00 00 	movabs $0x3a4d,%r11
+  805601:	00 00 00 
+  805604:	4c 01 db             	add    %r11,%rbx
+  805607:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80560a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80560e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805611:	48 89 d6             	mov    %rdx,%rsi
+  805614:	89 c7                	mov    %eax,%edi
+  805616:	49 89 df             	mov    %rbx,%r15
+  805619:	48 b8 68 99 ff ff ff 	movabs $0xffffffffffff9968,%rax
+  805620:	ff ff ff 
+  805623:	48 01 d8             	add    %rbx,%rax
+  805626:	ff d0                	call   *%rax
+  805628:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80562b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80562f:	79 05                	jns    805636 <iscons+0x4e>
+		return r;
+  805631:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805634:	eb 1b                	jmp    805651 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  805636:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80563a:	8b 10                	mov    (%rax),%edx
+  80563c:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  805643:	00 00 00 
+  805646:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805649:	39 c2                	cmp    %eax,%edx
+  80564b:	0f 94 c0             	sete   %al
+  80564e:	0f b6 c0             	movzbl %al,%eax
+}
+  805651:	48 83 c4 20          	add    $0x20,%rsp
+  805655:	5b                   	pop    %rbx
+  805656:	41 5f                	pop    %r15
+  805658:	5d                   	pop    %rbp
+  805659:	c3                   	ret
+
+000000000080565a <opencons>:
+
+int
+opencons(void)
+{
+  80565a:	55                   	push   %rbp
+  80565b:	48 89 e5             	mov    %rsp,%rbp
+  80565e:	41 57                	push   %r15
+  805660:	53                   	push   %rbx
+  805661:	48 83 ec 10          	sub    $0x10,%rsp
+  805665:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805665 <opencons+0xb>
+  80566c:	49 bb db 39 00 00 00 	movabs $0x39db,%r11
+  805673:	00 00 00 
+  805676:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805679:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80567d:	48 89 c7             	mov    %rax,%rdi
+  805680:	49 89 df             	mov    %rbx,%r15
+  805683:	48 b8 b2 98 ff ff ff 	movabs $0xffffffffffff98b2,%rax
+  80568a:	ff ff ff 
+  80568d:	48 01 d8             	add    %rbx,%rax
+  805690:	ff d0                	call   *%rax
+  805692:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805695:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805699:	79 05                	jns    8056a0 <opencons+0x46>
+		return r;
+  80569b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80569e:	eb 68                	jmp    805708 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8056a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056a4:	ba 07 04 00 00       	mov    $0x407,%edx
+  8056a9:	48 89 c6             	mov    %rax,%rsi
+  8056ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056b1:	49 89 df             	mov    %rbx,%r15
+  8056b4:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  8056bb:	ff ff ff 
+  8056be:	48 01 d8             	add    %rbx,%rax
+  8056c1:	ff d0                	call   *%rax
+  8056c3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056ca:	79 05                	jns    8056d1 <opencons+0x77>
+		return r;
+  8056cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056cf:	eb 37                	jmp    805708 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8056d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056d5:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  8056dc:	00 00 00 
+  8056df:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8056e2:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8056e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056e8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8056ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056f3:	48 89 c7             	mov    %rax,%rdi
+  8056f6:	49 89 df             	mov    %rbx,%r15
+  8056f9:	48 b8 38 98 ff ff ff 	movabs $0xffffffffffff9838,%rax
+  805700:	ff ff ff 
+  805703:	48 01 d8             	add    %rbx,%rax
+  805706:	ff d0                	call   *%rax
+}
+  805708:	48 83 c4 10          	add    $0x10,%rsp
+  80570c:	5b                   	pop    %rbx
+  80570d:	41 5f                	pop    %r15
+  80570f:	5d                   	pop    %rbp
+  805710:	c3                   	ret
+
+0000000000805711 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805711:	55                   	push   %rbp
+  805712:	48 89 e5             	mov    %rsp,%rbp
+  805715:	41 57                	push   %r15
+  805717:	53                   	push   %rbx
+  805718:	48 83 ec 30          	sub    $0x30,%rsp
+  80571c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80571c <devcons_read+0xb>
+  805723:	49 bb 24 39 00 00 00 	movabs $0x3924,%r11
+  80572a:	00 00 00 
+  80572d:	4c 01 db             	add    %r11,%rbx
+  805730:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805734:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805738:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  80573c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805741:	75 19                	jne    80575c <devcons_read+0x4b>
+		return 0;
+  805743:	b8 00 00 00 00       	mov    $0x0,%eax
+  805748:	eb 55                	jmp    80579f <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  80574a:	49 89 df             	mov    %rbx,%r15
+  80574d:	48 b8 3a 90 ff ff ff 	movabs $0xffffffffffff903a,%rax
+  805754:	ff ff ff 
+  805757:	48 01 d8             	add    %rbx,%rax
+  80575a:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  80575c:	49 89 df             	mov    %rbx,%r15
+  80575f:	48 b8 36 8f ff ff ff 	movabs $0xffffffffffff8f36,%rax
+  805766:	ff ff ff 
+  805769:	48 01 d8             	add    %rbx,%rax
+  80576c:	ff d0                	call   *%rax
+  80576e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805771:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805775:	74 d3                	je     80574a <devcons_read+0x39>
+	if (c < 0)
+  805777:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80577b:	79 05                	jns    805782 <devcons_read+0x71>
+		return c;
+  80577d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805780:	eb 1d                	jmp    80579f <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  805782:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  805786:	75 07                	jne    80578f <devcons_read+0x7e>
+		return 0;
+  805788:	b8 00 00 00 00       	mov    $0x0,%eax
+  80578d:	eb 10                	jmp    80579f <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  80578f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805792:	89 c2                	mov    %eax,%edx
+  805794:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805798:	88 10                	mov    %dl,(%rax)
+	return 1;
+  80579a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80579f:	48 83 c4 30          	add    $0x30,%rsp
+  8057a3:	5b                   	pop    %rbx
+  8057a4:	41 5f                	pop    %r15
+  8057a6:	5d                   	pop    %rbp
+  8057a7:	c3                   	ret
+
+00000000008057a8 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8057a8:	55                   	push   %rbp
+  8057a9:	48 89 e5             	mov    %rsp,%rbp
+  8057ac:	41 57                	push   %r15
+  8057ae:	53                   	push   %rbx
+  8057af:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8057b6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057b6 <devcons_write+0xe>
+  8057bd:	49 bb 8a 38 00 00 00 	movabs $0x388a,%r11
+  8057c4:	00 00 00 
+  8057c7:	4c 01 db             	add    %r11,%rbx
+  8057ca:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8057d1:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8057d8:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8057df:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8057e6:	e9 80 00 00 00       	jmp    80586b <devcons_write+0xc3>
+		m = n - tot;
+  8057eb:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8057f2:	89 c2                	mov    %eax,%edx
+  8057f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057f7:	29 c2                	sub    %eax,%edx
+  8057f9:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8057fc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8057ff:	83 f8 7f             	cmp    $0x7f,%eax
+  805802:	76 07                	jbe    80580b <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  805804:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80580b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80580e:	48 63 d0             	movslq %eax,%rdx
+  805811:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805814:	48 63 c8             	movslq %eax,%rcx
+  805817:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80581e:	48 01 c1             	add    %rax,%rcx
+  805821:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805828:	48 89 ce             	mov    %rcx,%rsi
+  80582b:	48 89 c7             	mov    %rax,%rdi
+  80582e:	49 89 df             	mov    %rbx,%r15
+  805831:	48 b8 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rax
+  805838:	ff ff ff 
+  80583b:	48 01 d8             	add    %rbx,%rax
+  80583e:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  805840:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805843:	48 63 d0             	movslq %eax,%rdx
+  805846:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80584d:	48 89 d6             	mov    %rdx,%rsi
+  805850:	48 89 c7             	mov    %rax,%rdi
+  805853:	49 89 df             	mov    %rbx,%r15
+  805856:	48 b8 d7 8e ff ff ff 	movabs $0xffffffffffff8ed7,%rax
+  80585d:	ff ff ff 
+  805860:	48 01 d8             	add    %rbx,%rax
+  805863:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  805865:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805868:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80586b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80586e:	48 98                	cltq
+  805870:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  805877:	0f 82 6e ff ff ff    	jb     8057eb <devcons_write+0x43>
+	}
+	return tot;
+  80587d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805880:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  805887:	5b                   	pop    %rbx
+  805888:	41 5f                	pop    %r15
+  80588a:	5d                   	pop    %rbp
+  80588b:	c3                   	ret
+
+000000000080588c <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  80588c:	55                   	push   %rbp
+  80588d:	48 89 e5             	mov    %rsp,%rbp
+  805890:	48 83 ec 08          	sub    $0x8,%rsp
+  805894:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805894 <devcons_close+0x8>
+  80589b:	49 bb ac 37 00 00 00 	movabs $0x37ac,%r11
+  8058a2:	00 00 00 
+  8058a5:	4c 01 d8             	add    %r11,%rax
+  8058a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8058ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058b1:	c9                   	leave
+  8058b2:	c3                   	ret
+
+00000000008058b3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8058b3:	55                   	push   %rbp
+  8058b4:	48 89 e5             	mov    %rsp,%rbp
+  8058b7:	41 57                	push   %r15
+  8058b9:	48 83 ec 18          	sub    $0x18,%rsp
+  8058bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8058bd <devcons_stat+0xa>
+  8058c4:	49 bb 83 37 00 00 00 	movabs $0x3783,%r11
+  8058cb:	00 00 00 
+  8058ce:	4c 01 d8             	add    %r11,%rax
+  8058d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8058d5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8058d9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8058dd:	48 b9 a2 e4 ff ff ff 	movabs $0xffffffffffffe4a2,%rcx
+  8058e4:	ff ff ff 
+  8058e7:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8058eb:	48 89 ce             	mov    %rcx,%rsi
+  8058ee:	48 89 d7             	mov    %rdx,%rdi
+  8058f1:	49 89 c7             	mov    %rax,%r15
+  8058f4:	48 ba d3 83 ff ff ff 	movabs $0xffffffffffff83d3,%rdx
+  8058fb:	ff ff ff 
+  8058fe:	48 01 c2             	add    %rax,%rdx
+  805901:	ff d2                	call   *%rdx
+	return 0;
+  805903:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805908:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80590c:	c9                   	leave
+  80590d:	c3                   	ret
+
+000000000080590e <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80590e:	55                   	push   %rbp
+  80590f:	48 89 e5             	mov    %rsp,%rbp
+  805912:	41 57                	push   %r15
+  805914:	53                   	push   %rbx
+  805915:	48 83 ec 40          	sub    $0x40,%rsp
+  805919:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805919 <pgfault+0xb>
+  805920:	49 bb 27 37 00 00 00 	movabs $0x3727,%r11
+  805927:	00 00 00 
+  80592a:	4c 01 db             	add    %r11,%rbx
+  80592d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  805931:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805935:	48 8b 00             	mov    (%rax),%rax
+  805938:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  80593c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805940:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805944:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  805947:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80594b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80594f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805953:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  805959:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  80595d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805960:	83 e0 02             	and    $0x2,%eax
+  805963:	85 c0                	test   %eax,%eax
+  805965:	0f 84 91 03 00 00    	je     805cfc <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  80596b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80596f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805973:	48 89 c2             	mov    %rax,%rdx
+  805976:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80597d:	ff ff ff 
+  805980:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805984:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805988:	83 e0 01             	and    $0x1,%eax
+  80598b:	48 85 c0             	test   %rax,%rax
+  80598e:	0f 84 a7 01 00 00    	je     805b3b <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  805994:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805998:	48 c1 e8 15          	shr    $0x15,%rax
+  80599c:	48 89 c2             	mov    %rax,%rdx
+  80599f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8059a6:	ff ff ff 
+  8059a9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8059ad:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8059b1:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8059b6:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  8059bc:	0f 85 79 01 00 00    	jne    805b3b <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  8059c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8059c6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8059ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059ce:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  8059d4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  8059d8:	ba 07 00 00 00       	mov    $0x7,%edx
+  8059dd:	be 00 00 60 00       	mov    $0x600000,%esi
+  8059e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059e7:	49 89 df             	mov    %rbx,%r15
+  8059ea:	48 b8 65 96 ff ff ff 	movabs $0xffffffffffff9665,%rax
+  8059f1:	ff ff ff 
+  8059f4:	48 01 d8             	add    %rbx,%rax
+  8059f7:	ff d0                	call   *%rax
+  8059f9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8059fc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  805a00:	79 44                	jns    805a46 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  805a02:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805a05:	89 c1                	mov    %eax,%ecx
+  805a07:	48 b8 b0 e4 ff ff ff 	movabs $0xffffffffffffe4b0,%rax
+  805a0e:	ff ff ff 
+  805a11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a15:	48 89 c2             	mov    %rax,%rdx
+  805a18:	be 20 00 00 00       	mov    $0x20,%esi
+  805a1d:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  805a24:	ff ff ff 
+  805a27:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a2b:	48 89 c7             	mov    %rax,%rdi
+  805a2e:	49 89 df             	mov    %rbx,%r15
+  805a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a36:	49 b8 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%r8
+  805a3d:	ff ff ff 
+  805a40:	49 01 d8             	add    %rbx,%r8
+  805a43:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  805a46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a4a:	ba 00 00 20 00       	mov    $0x200000,%edx
+  805a4f:	48 89 c6             	mov    %rax,%rsi
+  805a52:	bf 00 00 60 00       	mov    $0x600000,%edi
+  805a57:	49 89 df             	mov    %rbx,%r15
+  805a5a:	48 b8 de 88 ff ff ff 	movabs $0xffffffffffff88de,%rax
+  805a61:	ff ff ff 
+  805a64:	48 01 d8             	add    %rbx,%rax
+  805a67:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  805a69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a6d:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  805a73:	48 89 c1             	mov    %rax,%rcx
+  805a76:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a7b:	be 00 00 60 00       	mov    $0x600000,%esi
+  805a80:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a85:	49 89 df             	mov    %rbx,%r15
+  805a88:	48 b8 f4 90 ff ff ff 	movabs $0xffffffffffff90f4,%rax
+  805a8f:	ff ff ff 
+  805a92:	48 01 d8             	add    %rbx,%rax
+  805a95:	ff d0                	call   *%rax
+  805a97:	85 c0                	test   %eax,%eax
+  805a99:	74 3e                	je     805ad9 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  805a9b:	48 b8 db e4 ff ff ff 	movabs $0xffffffffffffe4db,%rax
+  805aa2:	ff ff ff 
+  805aa5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805aa9:	48 89 c2             	mov    %rax,%rdx
+  805aac:	be 23 00 00 00       	mov    $0x23,%esi
+  805ab1:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  805ab8:	ff ff ff 
+  805abb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805abf:	48 89 c7             	mov    %rax,%rdi
+  805ac2:	49 89 df             	mov    %rbx,%r15
+  805ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aca:	48 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%rcx
+  805ad1:	ff ff ff 
+  805ad4:	48 01 d9             	add    %rbx,%rcx
+  805ad7:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  805ad9:	be 00 00 60 00       	mov    $0x600000,%esi
+  805ade:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ae3:	49 89 df             	mov    %rbx,%r15
+  805ae6:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  805aed:	ff ff ff 
+  805af0:	48 01 d8             	add    %rbx,%rax
+  805af3:	ff d0                	call   *%rax
+  805af5:	85 c0                	test   %eax,%eax
+  805af7:	0f 84 3d 02 00 00    	je     805d3a <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  805afd:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  805b04:	ff ff ff 
+  805b07:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b0b:	48 89 c2             	mov    %rax,%rdx
+  805b0e:	be 25 00 00 00       	mov    $0x25,%esi
+  805b13:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  805b1a:	ff ff ff 
+  805b1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b21:	48 89 c7             	mov    %rax,%rdi
+  805b24:	49 89 df             	mov    %rbx,%r15
+  805b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b2c:	48 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%rcx
+  805b33:	ff ff ff 
+  805b36:	48 01 d9             	add    %rbx,%rcx
+  805b39:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  805b3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b3f:	48 c1 e8 0c          	shr    $0xc,%rax
+  805b43:	48 89 c2             	mov    %rax,%rdx
+  805b46:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805b4d:	ff ff ff 
+  805b50:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b54:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805b58:	25 00 08 00 00       	and    $0x800,%eax
+  805b5d:	48 85 c0             	test   %rax,%rax
+  805b60:	0f 84 58 01 00 00    	je     805cbe <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  805b66:	ba 07 00 00 00       	mov    $0x7,%edx
+  805b6b:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  805b70:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b75:	49 89 df             	mov    %rbx,%r15
+  805b78:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  805b7f:	ff ff ff 
+  805b82:	48 01 d8             	add    %rbx,%rax
+  805b85:	ff d0                	call   *%rax
+  805b87:	85 c0                	test   %eax,%eax
+  805b89:	74 3e                	je     805bc9 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  805b8b:	48 b8 07 e5 ff ff ff 	movabs $0xffffffffffffe507,%rax
+  805b92:	ff ff ff 
+  805b95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b99:	48 89 c2             	mov    %rax,%rdx
+  805b9c:	be 2a 00 00 00       	mov    $0x2a,%esi
+  805ba1:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  805ba8:	ff ff ff 
+  805bab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805baf:	48 89 c7             	mov    %rax,%rdi
+  805bb2:	49 89 df             	mov    %rbx,%r15
+  805bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bba:	48 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%rcx
+  805bc1:	ff ff ff 
+  805bc4:	48 01 d9             	add    %rbx,%rcx
+  805bc7:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  805bc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bcd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805bd2:	48 89 c6             	mov    %rax,%rsi
+  805bd5:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  805bda:	49 89 df             	mov    %rbx,%r15
+  805bdd:	48 b8 de 88 ff ff ff 	movabs $0xffffffffffff88de,%rax
+  805be4:	ff ff ff 
+  805be7:	48 01 d8             	add    %rbx,%rax
+  805bea:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  805bec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bf0:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  805bf6:	48 89 c1             	mov    %rax,%rcx
+  805bf9:	ba 00 00 00 00       	mov    $0x0,%edx
+  805bfe:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  805c03:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c08:	49 89 df             	mov    %rbx,%r15
+  805c0b:	48 b8 f4 90 ff ff ff 	movabs $0xffffffffffff90f4,%rax
+  805c12:	ff ff ff 
+  805c15:	48 01 d8             	add    %rbx,%rax
+  805c18:	ff d0                	call   *%rax
+  805c1a:	85 c0                	test   %eax,%eax
+  805c1c:	74 3e                	je     805c5c <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  805c1e:	48 b8 db e4 ff ff ff 	movabs $0xffffffffffffe4db,%rax
+  805c25:	ff ff ff 
+  805c28:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c2c:	48 89 c2             	mov    %rax,%rdx
+  805c2f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  805c34:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  805c3b:	ff ff ff 
+  805c3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c42:	48 89 c7             	mov    %rax,%rdi
+  805c45:	49 89 df             	mov    %rbx,%r15
+  805c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c4d:	48 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%rcx
+  805c54:	ff ff ff 
+  805c57:	48 01 d9             	add    %rbx,%rcx
+  805c5a:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  805c5c:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  805c61:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c66:	49 89 df             	mov    %rbx,%r15
+  805c69:	48 b8 67 91 ff ff ff 	movabs $0xffffffffffff9167,%rax
+  805c70:	ff ff ff 
+  805c73:	48 01 d8             	add    %rbx,%rax
+  805c76:	ff d0                	call   *%rax
+  805c78:	85 c0                	test   %eax,%eax
+  805c7a:	0f 84 bb 00 00 00    	je     805d3b <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  805c80:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  805c87:	ff ff ff 
+  805c8a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c8e:	48 89 c2             	mov    %rax,%rdx
+  805c91:	be 32 00 00 00       	mov    $0x32,%esi
+  805c96:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  805c9d:	ff ff ff 
+  805ca0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ca4:	48 89 c7             	mov    %rax,%rdi
+  805ca7:	49 89 df             	mov    %rbx,%r15
+  805caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  805caf:	48 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%rcx
+  805cb6:	ff ff ff 
+  805cb9:	48 01 d9             	add    %rbx,%rcx
+  805cbc:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  805cbe:	48 b8 20 e5 ff ff ff 	movabs $0xffffffffffffe520,%rax
+  805cc5:	ff ff ff 
+  805cc8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ccc:	48 89 c2             	mov    %rax,%rdx
+  805ccf:	be 36 00 00 00       	mov    $0x36,%esi
+  805cd4:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  805cdb:	ff ff ff 
+  805cde:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ce2:	48 89 c7             	mov    %rax,%rdi
+  805ce5:	49 89 df             	mov    %rbx,%r15
+  805ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ced:	48 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%rcx
+  805cf4:	ff ff ff 
+  805cf7:	48 01 d9             	add    %rbx,%rcx
+  805cfa:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  805cfc:	48 b8 3f e5 ff ff ff 	movabs $0xffffffffffffe53f,%rax
+  805d03:	ff ff ff 
+  805d06:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d0a:	48 89 c2             	mov    %rax,%rdx
+  805d0d:	be 3a 00 00 00       	mov    $0x3a,%esi
+  805d12:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  805d19:	ff ff ff 
+  805d1c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d20:	48 89 c7             	mov    %rax,%rdi
+  805d23:	49 89 df             	mov    %rbx,%r15
+  805d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d2b:	48 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%rcx
+  805d32:	ff ff ff 
+  805d35:	48 01 d9             	add    %rbx,%rcx
+  805d38:	ff d1                	call   *%rcx
+			return;
+  805d3a:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  805d3b:	48 83 c4 40          	add    $0x40,%rsp
+  805d3f:	5b                   	pop    %rbx
+  805d40:	41 5f                	pop    %r15
+  805d42:	5d                   	pop    %rbp
+  805d43:	c3                   	ret
+
+0000000000805d44 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  805d44:	55                   	push   %rbp
+  805d45:	48 89 e5             	mov    %rsp,%rbp
+  805d48:	41 57                	push   %r15
+  805d4a:	53                   	push   %rbx
+  805d4b:	48 83 ec 10          	sub    $0x10,%rsp
+  805d4f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d4f <fork_flush+0xb>
+  805d56:	49 bb f1 32 00 00 00 	movabs $0x32f1,%r11
+  805d5d:	00 00 00 
+  805d60:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  805d63:	48 b8 e0 2f 01 00 00 	movabs $0x12fe0,%rax
+  805d6a:	00 00 00 
+  805d6d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d71:	48 85 c0             	test   %rax,%rax
+  805d74:	0f 84 81 00 00 00    	je     805dfb <fork_flush+0xb7>
+  805d7a:	48 b8 e0 2f 01 00 00 	movabs $0x12fe0,%rax
+  805d81:	00 00 00 
+  805d84:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d88:	48 89 c6             	mov    %rax,%rsi
+  805d8b:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805d92:	00 00 00 
+  805d95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d99:	48 89 c7             	mov    %rax,%rdi
+  805d9c:	49 89 df             	mov    %rbx,%r15
+  805d9f:	48 b8 ca 96 ff ff ff 	movabs $0xffffffffffff96ca,%rax
+  805da6:	ff ff ff 
+  805da9:	48 01 d8             	add    %rbx,%rax
+  805dac:	ff d0                	call   *%rax
+  805dae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805db1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805db5:	79 44                	jns    805dfb <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  805db7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dba:	89 c1                	mov    %eax,%ecx
+  805dbc:	48 b8 58 e5 ff ff ff 	movabs $0xffffffffffffe558,%rax
+  805dc3:	ff ff ff 
+  805dc6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dca:	48 89 c2             	mov    %rax,%rdx
+  805dcd:	be 56 00 00 00       	mov    $0x56,%esi
+  805dd2:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  805dd9:	ff ff ff 
+  805ddc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805de0:	48 89 c7             	mov    %rax,%rdi
+  805de3:	49 89 df             	mov    %rbx,%r15
+  805de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805deb:	49 b8 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%r8
+  805df2:	ff ff ff 
+  805df5:	49 01 d8             	add    %rbx,%r8
+  805df8:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  805dfb:	48 b8 e0 2f 01 00 00 	movabs $0x12fe0,%rax
+  805e02:	00 00 00 
+  805e05:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  805e0c:	00 
+}
+  805e0d:	90                   	nop
+  805e0e:	48 83 c4 10          	add    $0x10,%rsp
+  805e12:	5b                   	pop    %rbx
+  805e13:	41 5f                	pop    %r15
+  805e15:	5d                   	pop    %rbp
+  805e16:	c3                   	ret
+
+0000000000805e17 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  805e17:	55                   	push   %rbp
+  805e18:	48 89 e5             	mov    %rsp,%rbp
+  805e1b:	53                   	push   %rbx
+  805e1c:	48 83 ec 28          	sub    $0x28,%rsp
+  805e20:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e20 <fork_map+0x9>
+  805e27:	49 bb 20 32 00 00 00 	movabs $0x3220,%r11
+  805e2e:	00 00 00 
+  805e31:	4c 01 db             	add    %r11,%rbx
+  805e34:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805e37:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805e3b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  805e3e:	48 b8 e0 2f 01 00 00 	movabs $0x12fe0,%rax
+  805e45:	00 00 00 
+  805e48:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e4c:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  805e52:	75 10                	jne    805e64 <fork_map+0x4d>
+		fork_flush();
+  805e54:	48 b8 04 cd ff ff ff 	movabs $0xffffffffffffcd04,%rax
+  805e5b:	ff ff ff 
+  805e5e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e62:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  805e64:	48 b8 e0 2f 01 00 00 	movabs $0x12fe0,%rax
+  805e6b:	00 00 00 
+  805e6e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e72:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  805e76:	48 b9 e0 2f 01 00 00 	movabs $0x12fe0,%rcx
+  805e7d:	00 00 00 
+  805e80:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  805e84:	48 c1 e0 05          	shl    $0x5,%rax
+  805e88:	48 89 c2             	mov    %rax,%rdx
+  805e8b:	48 b8 e0 1f 01 00 00 	movabs $0x11fe0,%rax
+  805e92:	00 00 00 
+  805e95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e99:	48 01 d0             	add    %rdx,%rax
+  805e9c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  805ea0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ea4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  805eaa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805eae:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805eb2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  805eb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805eba:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805ebd:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  805ec0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ec4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805ec8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  805ecc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ed0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805ed3:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  805ed6:	90                   	nop
+  805ed7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805edb:	c9                   	leave
+  805edc:	c3                   	ret
+
+0000000000805edd <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  805edd:	55                   	push   %rbp
+  805ede:	48 89 e5             	mov    %rsp,%rbp
+  805ee1:	53                   	push   %rbx
+  805ee2:	48 83 ec 28          	sub    $0x28,%rsp
+  805ee6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ee6 <duppage+0x9>
+  805eed:	49 bb 5a 31 00 00 00 	movabs $0x315a,%r11
+  805ef4:	00 00 00 
+  805ef7:	4c 01 db             	add    %r11,%rbx
+  805efa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805efd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  805f00:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805f03:	48 c1 e0 0c          	shl    $0xc,%rax
+  805f07:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  805f0b:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805f12:	ff ff ff 
+  805f15:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f19:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805f1c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f20:	25 00 04 00 00       	and    $0x400,%eax
+  805f25:	48 85 c0             	test   %rax,%rax
+  805f28:	74 42                	je     805f6c <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  805f2a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805f31:	ff ff ff 
+  805f34:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f38:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805f3b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f3f:	25 07 0e 00 00       	and    $0xe07,%eax
+  805f44:	89 c2                	mov    %eax,%edx
+  805f46:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805f4a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f4d:	48 89 ce             	mov    %rcx,%rsi
+  805f50:	89 c7                	mov    %eax,%edi
+  805f52:	48 b8 d7 cd ff ff ff 	movabs $0xffffffffffffcdd7,%rax
+  805f59:	ff ff ff 
+  805f5c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f60:	ff d0                	call   *%rax
+		return 0;
+  805f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f67:	e9 ae 00 00 00       	jmp    80601a <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  805f6c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805f73:	ff ff ff 
+  805f76:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f7a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805f7d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f81:	83 e0 02             	and    $0x2,%eax
+  805f84:	48 85 c0             	test   %rax,%rax
+  805f87:	75 1f                	jne    805fa8 <duppage+0xcb>
+  805f89:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805f90:	ff ff ff 
+  805f93:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805f97:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805f9a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f9e:	25 00 08 00 00       	and    $0x800,%eax
+  805fa3:	48 85 c0             	test   %rax,%rax
+  805fa6:	74 4c                	je     805ff4 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  805fa8:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  805faf:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805fb2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805fb6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805fb9:	48 89 ce             	mov    %rcx,%rsi
+  805fbc:	89 c7                	mov    %eax,%edi
+  805fbe:	48 b8 d7 cd ff ff ff 	movabs $0xffffffffffffcdd7,%rax
+  805fc5:	ff ff ff 
+  805fc8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805fcc:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  805fce:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805fd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fd5:	48 89 c6             	mov    %rax,%rsi
+  805fd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fdd:	48 b8 d7 cd ff ff ff 	movabs $0xffffffffffffcdd7,%rax
+  805fe4:	ff ff ff 
+  805fe7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805feb:	ff d0                	call   *%rax
+		return 0;
+  805fed:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ff2:	eb 26                	jmp    80601a <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  805ff4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805ff8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ffb:	ba 05 00 00 00       	mov    $0x5,%edx
+  806000:	48 89 ce             	mov    %rcx,%rsi
+  806003:	89 c7                	mov    %eax,%edi
+  806005:	48 b8 d7 cd ff ff ff 	movabs $0xffffffffffffcdd7,%rax
+  80600c:	ff ff ff 
+  80600f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806013:	ff d0                	call   *%rax
+		return 0;
+  806015:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  80601a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80601e:	c9                   	leave
+  80601f:	c3                   	ret
+
+0000000000806020 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  806020:	55                   	push   %rbp
+  806021:	48 89 e5             	mov    %rsp,%rbp
+  806024:	53                   	push   %rbx
+  806025:	48 83 ec 28          	sub    $0x28,%rsp
+  806029:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806029 <duphuge+0x9>
+  806030:	49 bb 17 30 00 00 00 	movabs $0x3017,%r11
+  806037:	00 00 00 
+  80603a:	4c 01 db             	add    %r11,%rbx
+  80603d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806040:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  806044:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806048:	48 c1 e8 15          	shr    $0x15,%rax
+  80604c:	48 89 c2             	mov    %rax,%rdx
+  80604f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806056:	ff ff ff 
+  806059:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80605d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806061:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  806065:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806069:	25 00 04 00 00       	and    $0x400,%eax
+  80606e:	48 85 c0             	test   %rax,%rax
+  806071:	74 0e                	je     806081 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  806073:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806077:	25 07 0e 00 00       	and    $0xe07,%eax
+  80607c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80607f:	eb 1e                	jmp    80609f <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  806081:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806085:	25 02 08 00 00       	and    $0x802,%eax
+  80608a:	48 85 c0             	test   %rax,%rax
+  80608d:	74 09                	je     806098 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  80608f:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  806096:	eb 07                	jmp    80609f <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  806098:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  80609f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8060a2:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8060a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8060a9:	48 89 ce             	mov    %rcx,%rsi
+  8060ac:	89 c7                	mov    %eax,%edi
+  8060ae:	48 b8 d7 cd ff ff ff 	movabs $0xffffffffffffcdd7,%rax
+  8060b5:	ff ff ff 
+  8060b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060bc:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  8060be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060c1:	25 00 08 00 00       	and    $0x800,%eax
+  8060c6:	85 c0                	test   %eax,%eax
+  8060c8:	74 1f                	je     8060e9 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  8060ca:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8060cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060d1:	48 89 c6             	mov    %rax,%rsi
+  8060d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060d9:	48 b8 d7 cd ff ff ff 	movabs $0xffffffffffffcdd7,%rax
+  8060e0:	ff ff ff 
+  8060e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060e7:	ff d0                	call   *%rax
+	return 0;
+  8060e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8060ee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8060f2:	c9                   	leave
+  8060f3:	c3                   	ret
+
+00000000008060f4 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8060f4:	55                   	push   %rbp
+  8060f5:	48 89 e5             	mov    %rsp,%rbp
+  8060f8:	41 57                	push   %r15
+  8060fa:	53                   	push   %rbx
+  8060fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8060ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060ff <fork+0xb>
+  806106:	49 bb 41 2f 00 00 00 	movabs $0x2f41,%r11
+  80610d:	00 00 00 
+  806110:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  806113:	49 89 df             	mov    %rbx,%r15
+  806116:	48 b8 e4 97 ff ff ff 	movabs $0xffffffffffff97e4,%rax
+  80611d:	ff ff ff 
+  806120:	48 01 d8             	add    %rbx,%rax
+  806123:	ff d0                	call   *%rax
+  806125:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806128:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80612c:	75 42                	jne    806170 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80612e:	49 89 df             	mov    %rbx,%r15
+  806131:	48 b8 e6 8f ff ff ff 	movabs $0xffffffffffff8fe6,%rax
+  806138:	ff ff ff 
+  80613b:	48 01 d8             	add    %rbx,%rax
+  80613e:	ff d0                	call   *%rax
+  806140:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806145:	48 98                	cltq
+  806147:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80614e:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806155:	ff ff ff 
+  806158:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80615c:	48 01 c2             	add    %rax,%rdx
+  80615f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806166:	ff ff ff 
+  806169:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80616d:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  806170:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806173:	48 83 c4 10          	add    $0x10,%rsp
+  806177:	5b                   	pop    %rbx
+  806178:	41 5f                	pop    %r15
+  80617a:	5d                   	pop    %rbp
+  80617b:	c3                   	ret
+
+000000000080617c <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  80617c:	55                   	push   %rbp
+  80617d:	48 89 e5             	mov    %rsp,%rbp
+  806180:	41 57                	push   %r15
+  806182:	53                   	push   %rbx
+  806183:	48 83 ec 10          	sub    $0x10,%rsp
+  806187:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806187 <ufork+0xb>
+  80618e:	49 bb b9 2e 00 00 00 	movabs $0x2eb9,%r11
+  806195:	00 00 00 
+  806198:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  80619b:	48 b8 ce c8 ff ff ff 	movabs $0xffffffffffffc8ce,%rax
+  8061a2:	ff ff ff 
+  8061a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8061a9:	48 89 c7             	mov    %rax,%rdi
+  8061ac:	49 89 df             	mov    %rbx,%r15
+  8061af:	48 b8 d8 dc ff ff ff 	movabs $0xffffffffffffdcd8,%rax
+  8061b6:	ff ff ff 
+  8061b9:	48 01 d8             	add    %rbx,%rax
+  8061bc:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8061be:	b8 07 00 00 00       	mov    $0x7,%eax
+  8061c3:	cd 30                	int    $0x30
+  8061c5:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8061c8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  8061cb:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  8061ce:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8061d2:	0f 84 03 02 00 00    	je     8063db <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  8061d8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8061df:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  8061e0:	e9 28 01 00 00       	jmp    80630d <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  8061e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061e9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8061ed:	48 89 c2             	mov    %rax,%rdx
+  8061f0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8061f7:	ff ff ff 
+  8061fa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8061fe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806202:	83 e0 01             	and    $0x1,%eax
+  806205:	48 85 c0             	test   %rax,%rax
+  806208:	0f 84 f7 00 00 00    	je     806305 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  80620e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806212:	48 c1 e8 15          	shr    $0x15,%rax
+  806216:	48 89 c2             	mov    %rax,%rdx
+  806219:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806220:	ff ff ff 
+  806223:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806227:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80622b:	25 81 00 00 00       	and    $0x81,%eax
+  806230:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  806236:	75 29                	jne    806261 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  806238:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80623c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80623f:	48 89 d6             	mov    %rdx,%rsi
+  806242:	89 c7                	mov    %eax,%edi
+  806244:	48 b8 e0 cf ff ff ff 	movabs $0xffffffffffffcfe0,%rax
+  80624b:	ff ff ff 
+  80624e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806252:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  806254:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80625b:	00 
+  80625c:	e9 ac 00 00 00       	jmp    80630d <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  806261:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806265:	48 c1 e8 15          	shr    $0x15,%rax
+  806269:	48 89 c2             	mov    %rax,%rdx
+  80626c:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  806273:	ff ff ff 
+  806276:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80627a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80627e:	83 e0 01             	and    $0x1,%eax
+  806281:	48 85 c0             	test   %rax,%rax
+  806284:	74 75                	je     8062fb <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  806286:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80628a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80628e:	48 89 c2             	mov    %rax,%rdx
+  806291:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  806298:	ff ff ff 
+  80629b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80629f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8062a3:	83 e0 01             	and    $0x1,%eax
+  8062a6:	48 85 c0             	test   %rax,%rax
+  8062a9:	74 46                	je     8062f1 <ufork+0x175>
+  8062ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062af:	48 c1 e8 0c          	shr    $0xc,%rax
+  8062b3:	48 89 c2             	mov    %rax,%rdx
+  8062b6:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8062bd:	ff ff ff 
+  8062c0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8062c4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8062c8:	83 e0 04             	and    $0x4,%eax
+  8062cb:	48 85 c0             	test   %rax,%rax
+  8062ce:	74 21                	je     8062f1 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  8062d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062d4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8062d8:	89 c2                	mov    %eax,%edx
+  8062da:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8062dd:	89 d6                	mov    %edx,%esi
+  8062df:	89 c7                	mov    %eax,%edi
+  8062e1:	48 b8 9d ce ff ff ff 	movabs $0xffffffffffffce9d,%rax
+  8062e8:	ff ff ff 
+  8062eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8062ef:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  8062f1:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8062f8:	00 
+  8062f9:	eb 12                	jmp    80630d <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  8062fb:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  806302:	00 
+  806303:	eb 08                	jmp    80630d <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  806305:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  80630c:	40 
+		for (; addr < USTACKTOP;){
+  80630d:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  806312:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  806316:	0f 83 c9 fe ff ff    	jae    8061e5 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  80631c:	48 b8 04 cd ff ff ff 	movabs $0xffffffffffffcd04,%rax
+  806323:	ff ff ff 
+  806326:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80632a:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  80632c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80632f:	ba 07 00 00 00       	mov    $0x7,%edx
+  806334:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806339:	48 89 ce             	mov    %rcx,%rsi
+  80633c:	89 c7                	mov    %eax,%edi
+  80633e:	49 89 df             	mov    %rbx,%r15
+  806341:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  806348:	ff ff ff 
+  80634b:	48 01 d8             	add    %rbx,%rax
+  80634e:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  806350:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806353:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  80635a:	ff ff ff 
+  80635d:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806361:	48 89 d6             	mov    %rdx,%rsi
+  806364:	89 c7                	mov    %eax,%edi
+  806366:	49 89 df             	mov    %rbx,%r15
+  806369:	48 b8 85 92 ff ff ff 	movabs $0xffffffffffff9285,%rax
+  806370:	ff ff ff 
+  806373:	48 01 d8             	add    %rbx,%rax
+  806376:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  806378:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80637b:	be 02 00 00 00       	mov    $0x2,%esi
+  806380:	89 c7                	mov    %eax,%edi
+  806382:	49 89 df             	mov    %rbx,%r15
+  806385:	48 b8 c6 91 ff ff ff 	movabs $0xffffffffffff91c6,%rax
+  80638c:	ff ff ff 
+  80638f:	48 01 d8             	add    %rbx,%rax
+  806392:	ff d0                	call   *%rax
+  806394:	85 c0                	test   %eax,%eax
+  806396:	74 3e                	je     8063d6 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  806398:	48 b8 7f e5 ff ff ff 	movabs $0xffffffffffffe57f,%rax
+  80639f:	ff ff ff 
+  8063a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063a6:	48 89 c2             	mov    %rax,%rdx
+  8063a9:	be 07 01 00 00       	mov    $0x107,%esi
+  8063ae:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  8063b5:	ff ff ff 
+  8063b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063bc:	48 89 c7             	mov    %rax,%rdi
+  8063bf:	49 89 df             	mov    %rbx,%r15
+  8063c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063c7:	48 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%rcx
+  8063ce:	ff ff ff 
+  8063d1:	48 01 d9             	add    %rbx,%rcx
+  8063d4:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  8063d6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8063d9:	eb 59                	jmp    806434 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8063db:	49 89 df             	mov    %rbx,%r15
+  8063de:	48 b8 e6 8f ff ff ff 	movabs $0xffffffffffff8fe6,%rax
+  8063e5:	ff ff ff 
+  8063e8:	48 01 d8             	add    %rbx,%rax
+  8063eb:	ff d0                	call   *%rax
+  8063ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8063f2:	48 98                	cltq
+  8063f4:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8063fb:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806402:	ff ff ff 
+  806405:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806409:	48 01 c2             	add    %rax,%rdx
+  80640c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806413:	ff ff ff 
+  806416:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80641a:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  80641d:	48 b8 e0 2f 01 00 00 	movabs $0x12fe0,%rax
+  806424:	00 00 00 
+  806427:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  80642e:	00 
+		return 0;
+  80642f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  806434:	48 83 c4 10          	add    $0x10,%rsp
+  806438:	5b                   	pop    %rbx
+  806439:	41 5f                	pop    %r15
+  80643b:	5d                   	pop    %rbp
+  80643c:	c3                   	ret
+
+000000000080643d <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80643d:	55                   	push   %rbp
+  80643e:	48 89 e5             	mov    %rsp,%rbp
+  806441:	41 57                	push   %r15
+  806443:	48 83 ec 08          	sub    $0x8,%rsp
+  806447:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 806447 <sfork+0xa>
+  80644e:	49 bb f9 2b 00 00 00 	movabs $0x2bf9,%r11
+  806455:	00 00 00 
+  806458:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  80645b:	48 b8 9a e5 ff ff ff 	movabs $0xffffffffffffe59a,%rax
+  806462:	ff ff ff 
+  806465:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  806469:	48 89 c2             	mov    %rax,%rdx
+  80646c:	be 1a 01 00 00       	mov    $0x11a,%esi
+  806471:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  806478:	ff ff ff 
+  80647b:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80647f:	48 89 c7             	mov    %rax,%rdi
+  806482:	49 89 cf             	mov    %rcx,%r15
+  806485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80648a:	49 b8 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%r8
+  806491:	ff ff ff 
+  806494:	49 01 c8             	add    %rcx,%r8
+  806497:	41 ff d0             	call   *%r8
+
+000000000080649a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80649a:	55                   	push   %rbp
+  80649b:	48 89 e5             	mov    %rsp,%rbp
+  80649e:	41 57                	push   %r15
+  8064a0:	53                   	push   %rbx
+  8064a1:	48 83 ec 30          	sub    $0x30,%rsp
+  8064a5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064a5 <ipc_recv+0xb>
+  8064ac:	49 bb 9b 2b 00 00 00 	movabs $0x2b9b,%r11
+  8064b3:	00 00 00 
+  8064b6:	4c 01 db             	add    %r11,%rbx
+  8064b9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8064bd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8064c1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8064c5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8064ca:	75 0e                	jne    8064da <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8064cc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8064d3:	00 00 00 
+  8064d6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8064da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064de:	48 89 c7             	mov    %rax,%rdi
+  8064e1:	49 89 df             	mov    %rbx,%r15
+  8064e4:	48 b8 b8 93 ff ff ff 	movabs $0xffffffffffff93b8,%rax
+  8064eb:	ff ff ff 
+  8064ee:	48 01 d8             	add    %rbx,%rax
+  8064f1:	ff d0                	call   *%rax
+  8064f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8064f6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8064fb:	74 2a                	je     806527 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8064fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806501:	75 19                	jne    80651c <ipc_recv+0x82>
+  806503:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80650a:	ff ff ff 
+  80650d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806511:	48 8b 00             	mov    (%rax),%rax
+  806514:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80651a:	eb 05                	jmp    806521 <ipc_recv+0x87>
+  80651c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806521:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806525:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806527:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80652c:	74 2a                	je     806558 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  80652e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806532:	75 19                	jne    80654d <ipc_recv+0xb3>
+  806534:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80653b:	ff ff ff 
+  80653e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806542:	48 8b 00             	mov    (%rax),%rax
+  806545:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80654b:	eb 05                	jmp    806552 <ipc_recv+0xb8>
+  80654d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806552:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806556:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806558:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80655c:	74 05                	je     806563 <ipc_recv+0xc9>
+		return res;
+  80655e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806561:	eb 17                	jmp    80657a <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806563:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80656a:	ff ff ff 
+  80656d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806571:	48 8b 00             	mov    (%rax),%rax
+  806574:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80657a:	48 83 c4 30          	add    $0x30,%rsp
+  80657e:	5b                   	pop    %rbx
+  80657f:	41 5f                	pop    %r15
+  806581:	5d                   	pop    %rbp
+  806582:	c3                   	ret
+
+0000000000806583 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806583:	55                   	push   %rbp
+  806584:	48 89 e5             	mov    %rsp,%rbp
+  806587:	41 57                	push   %r15
+  806589:	53                   	push   %rbx
+  80658a:	48 83 ec 20          	sub    $0x20,%rsp
+  80658e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80658e <ipc_send+0xb>
+  806595:	49 bb b2 2a 00 00 00 	movabs $0x2ab2,%r11
+  80659c:	00 00 00 
+  80659f:	4c 01 db             	add    %r11,%rbx
+  8065a2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8065a5:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8065a8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8065ac:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8065af:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8065b4:	75 0e                	jne    8065c4 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8065b6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8065bd:	00 00 00 
+  8065c0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8065c4:	90                   	nop
+  8065c5:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8065c8:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8065cb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8065cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065d2:	89 c7                	mov    %eax,%edi
+  8065d4:	49 89 df             	mov    %rbx,%r15
+  8065d7:	48 b8 4e 93 ff ff ff 	movabs $0xffffffffffff934e,%rax
+  8065de:	ff ff ff 
+  8065e1:	48 01 d8             	add    %rbx,%rax
+  8065e4:	ff d0                	call   *%rax
+  8065e6:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8065e9:	74 da                	je     8065c5 <ipc_send+0x42>
+		;
+}
+  8065eb:	90                   	nop
+  8065ec:	90                   	nop
+  8065ed:	48 83 c4 20          	add    $0x20,%rsp
+  8065f1:	5b                   	pop    %rbx
+  8065f2:	41 5f                	pop    %r15
+  8065f4:	5d                   	pop    %rbp
+  8065f5:	c3                   	ret
+
+00000000008065f6 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8065f6:	55                   	push   %rbp
+  8065f7:	48 89 e5             	mov    %rsp,%rbp
+  8065fa:	41 57                	push   %r15
+  8065fc:	53                   	push   %rbx
+  8065fd:	48 83 ec 40          	sub    $0x40,%rsp
+  806601:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806601 <ipc_call+0xb>
+  806608:	49 bb 3f 2a 00 00 00 	movabs $0x2a3f,%r11
+  80660f:	00 00 00 
+  806612:	4c 01 db             	add    %r11,%rbx
+  806615:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806618:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80661b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80661f:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806622:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806626:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80662a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80662f:	75 0e                	jne    80663f <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806631:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806638:	00 00 00 
+  80663b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80663f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806644:	75 0e                	jne    806654 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806646:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80664d:	00 00 00 
+  806650:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806654:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806657:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80665b:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80665e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806662:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806665:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80666b:	49 89 f8             	mov    %rdi,%r8
+  80666e:	89 c7                	mov    %eax,%edi
+  806670:	49 89 df             	mov    %rbx,%r15
+  806673:	48 b8 11 94 ff ff ff 	movabs $0xffffffffffff9411,%rax
+  80667a:	ff ff ff 
+  80667d:	48 01 d8             	add    %rbx,%rax
+  806680:	ff d0                	call   *%rax
+  806682:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806685:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80668a:	74 2a                	je     8066b6 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80668c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806690:	75 19                	jne    8066ab <ipc_call+0xb5>
+  806692:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806699:	ff ff ff 
+  80669c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8066a0:	48 8b 00             	mov    (%rax),%rax
+  8066a3:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8066a9:	eb 05                	jmp    8066b0 <ipc_call+0xba>
+  8066ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8066b0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8066b4:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8066b6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066ba:	74 05                	je     8066c1 <ipc_call+0xcb>
+		return r;
+  8066bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066bf:	eb 17                	jmp    8066d8 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8066c1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8066c8:	ff ff ff 
+  8066cb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8066cf:	48 8b 00             	mov    (%rax),%rax
+  8066d2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8066d8:	48 83 c4 40          	add    $0x40,%rsp
+  8066dc:	5b                   	pop    %rbx
+  8066dd:	41 5f                	pop    %r15
+  8066df:	5d                   	pop    %rbp
+  8066e0:	c3                   	ret
+
+00000000008066e1 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8066e1:	55                   	push   %rbp
+  8066e2:	48 89 e5             	mov    %rsp,%rbp
+  8066e5:	41 57                	push   %r15
+  8066e7:	53                   	push   %rbx
+  8066e8:	48 83 ec 70          	sub    $0x70,%rsp
+  8066ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8066ec <ipc_callw+0xb>
+  8066f3:	49 bb 54 29 00 00 00 	movabs $0x2954,%r11
+  8066fa:	00 00 00 
+  8066fd:	4c 01 db             	add    %r11,%rbx
+  806700:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806703:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806706:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  80670a:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  80670e:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806713:	76 0a                	jbe    80671f <ipc_callw+0x3e>
+		return -E_INVAL;
+  806715:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80671a:	e9 b7 00 00 00       	jmp    8067d6 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  80671f:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806723:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806727:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80672b:	48 89 ce             	mov    %rcx,%rsi
+  80672e:	48 89 c7             	mov    %rax,%rdi
+  806731:	49 89 df             	mov    %rbx,%r15
+  806734:	48 b8 b3 87 ff ff ff 	movabs $0xffffffffffff87b3,%rax
+  80673b:	ff ff ff 
+  80673e:	48 01 d8             	add    %rbx,%rax
+  806741:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806743:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80674a:	00 
+  80674b:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80674f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806753:	48 01 d0             	add    %rdx,%rax
+  806756:	48 83 e8 01          	sub    $0x1,%rax
+  80675a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80675e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806762:	ba 00 00 00 00       	mov    $0x0,%edx
+  806767:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80676b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80676f:	48 29 d0             	sub    %rdx,%rax
+  806772:	48 c1 e8 03          	shr    $0x3,%rax
+  806776:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  80677a:	89 c1                	mov    %eax,%ecx
+  80677c:	8b 75 98             	mov    -0x68(%rbp),%esi
+  80677f:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806783:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806786:	49 89 d1             	mov    %rdx,%r9
+  806789:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806790:	00 00 00 
+  806793:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  80679a:	00 00 00 
+  80679d:	89 c7                	mov    %eax,%edi
+  80679f:	49 89 df             	mov    %rbx,%r15
+  8067a2:	48 b8 11 94 ff ff ff 	movabs $0xffffffffffff9411,%rax
+  8067a9:	ff ff ff 
+  8067ac:	48 01 d8             	add    %rbx,%rax
+  8067af:	ff d0                	call   *%rax
+  8067b1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8067b4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8067b8:	74 05                	je     8067bf <ipc_callw+0xde>
+		return r;
+  8067ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8067bd:	eb 17                	jmp    8067d6 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8067bf:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8067c6:	ff ff ff 
+  8067c9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8067cd:	48 8b 00             	mov    (%rax),%rax
+  8067d0:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8067d6:	48 83 c4 70          	add    $0x70,%rsp
+  8067da:	5b                   	pop    %rbx
+  8067db:	41 5f                	pop    %r15
+  8067dd:	5d                   	pop    %rbp
+  8067de:	c3                   	ret
+
+00000000008067df <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8067df:	55                   	push   %rbp
+  8067e0:	48 89 e5             	mov    %rsp,%rbp
+  8067e3:	41 57                	push   %r15
+  8067e5:	53                   	push   %rbx
+  8067e6:	48 83 ec 40          	sub    $0x40,%rsp
+  8067ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067ea <ipc_callv+0xb>
+  8067f1:	49 bb 56 28 00 00 00 	movabs $0x2856,%r11
+  8067f8:	00 00 00 
+  8067fb:	4c 01 db             	add    %r11,%rbx
+  8067fe:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806801:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806804:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806808:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80680b:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  80680f:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806813:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80681a:	00 00 00 
+  80681d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806821:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806825:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806829:	74 11                	je     80683c <ipc_callv+0x5d>
+		pg = (void *) segs;
+  80682b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80682f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806833:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806836:	c1 e0 14             	shl    $0x14,%eax
+  806839:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  80683c:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806840:	74 14                	je     806856 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806842:	8b 45 20             	mov    0x20(%rbp),%eax
+  806845:	83 e8 01             	sub    $0x1,%eax
+  806848:	48 63 d0             	movslq %eax,%rdx
+  80684b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80684f:	48 09 d0             	or     %rdx,%rax
+  806852:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806856:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806859:	c1 e0 10             	shl    $0x10,%eax
+  80685c:	0b 45 10             	or     0x10(%rbp),%eax
+  80685f:	89 c1                	mov    %eax,%ecx
+  806861:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806864:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806868:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80686c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806870:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806873:	4d 89 c1             	mov    %r8,%r9
+  806876:	49 89 f8             	mov    %rdi,%r8
+  806879:	89 c7                	mov    %eax,%edi
+  80687b:	49 89 df             	mov    %rbx,%r15
+  80687e:	48 b8 11 94 ff ff ff 	movabs $0xffffffffffff9411,%rax
+  806885:	ff ff ff 
+  806888:	48 01 d8             	add    %rbx,%rax
+  80688b:	ff d0                	call   *%rax
+  80688d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806890:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806894:	74 05                	je     80689b <ipc_callv+0xbc>
+		return r;
+  806896:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806899:	eb 17                	jmp    8068b2 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  80689b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068a2:	ff ff ff 
+  8068a5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068a9:	48 8b 00             	mov    (%rax),%rax
+  8068ac:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8068b2:	48 83 c4 40          	add    $0x40,%rsp
+  8068b6:	5b                   	pop    %rbx
+  8068b7:	41 5f                	pop    %r15
+  8068b9:	5d                   	pop    %rbp
+  8068ba:	c3                   	ret
+
+00000000008068bb <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8068bb:	55                   	push   %rbp
+  8068bc:	48 89 e5             	mov    %rsp,%rbp
+  8068bf:	41 57                	push   %r15
+  8068c1:	53                   	push   %rbx
+  8068c2:	48 83 ec 40          	sub    $0x40,%rsp
+  8068c6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068c6 <ipc_reply_recv+0xb>
+  8068cd:	49 bb 7a 27 00 00 00 	movabs $0x277a,%r11
+  8068d4:	00 00 00 
+  8068d7:	4c 01 db             	add    %r11,%rbx
+  8068da:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8068dd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8068e0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8068e4:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8068e7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8068eb:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8068ef:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8068f4:	75 0e                	jne    806904 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  8068f6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8068fd:	00 00 00 
+  806900:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806904:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806909:	75 0e                	jne    806919 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80690b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806912:	00 00 00 
+  806915:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806919:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80691c:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806920:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806924:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806927:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80692b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80692e:	4d 89 c1             	mov    %r8,%r9
+  806931:	49 89 f8             	mov    %rdi,%r8
+  806934:	89 c7                	mov    %eax,%edi
+  806936:	49 89 df             	mov    %rbx,%r15
+  806939:	48 b8 85 94 ff ff ff 	movabs $0xffffffffffff9485,%rax
+  806940:	ff ff ff 
+  806943:	48 01 d8             	add    %rbx,%rax
+  806946:	ff d0                	call   *%rax
+  806948:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  80694b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806950:	74 2a                	je     80697c <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806952:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806956:	75 19                	jne    806971 <ipc_reply_recv+0xb6>
+  806958:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80695f:	ff ff ff 
+  806962:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806966:	48 8b 00             	mov    (%rax),%rax
+  806969:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80696f:	eb 05                	jmp    806976 <ipc_reply_recv+0xbb>
+  806971:	b8 00 00 00 00       	mov    $0x0,%eax
+  806976:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80697a:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  80697c:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806981:	74 2a                	je     8069ad <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806983:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806987:	75 19                	jne    8069a2 <ipc_reply_recv+0xe7>
+  806989:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806990:	ff ff ff 
+  806993:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806997:	48 8b 00             	mov    (%rax),%rax
+  80699a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8069a0:	eb 05                	jmp    8069a7 <ipc_reply_recv+0xec>
+  8069a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8069a7:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  8069ab:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8069ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8069b1:	74 05                	je     8069b8 <ipc_reply_recv+0xfd>
+		return r;
+  8069b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069b6:	eb 17                	jmp    8069cf <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8069b8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8069bf:	ff ff ff 
+  8069c2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8069c6:	48 8b 00             	mov    (%rax),%rax
+  8069c9:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8069cf:	48 83 c4 40          	add    $0x40,%rsp
+  8069d3:	5b                   	pop    %rbx
+  8069d4:	41 5f                	pop    %r15
+  8069d6:	5d                   	pop    %rbp
+  8069d7:	c3                   	ret
+
+00000000008069d8 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  8069d8:	55                   	push   %rbp
+  8069d9:	48 89 e5             	mov    %rsp,%rbp
+  8069dc:	41 57                	push   %r15
+  8069de:	53                   	push   %rbx
+  8069df:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  8069e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069e6 <ipc_window_batch+0xe>
+  8069ed:	49 bb 5a 26 00 00 00 	movabs $0x265a,%r11
+  8069f4:	00 00 00 
+  8069f7:	4c 01 db             	add    %r11,%rbx
+  8069fa:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806a00:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806a07:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806a0d:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806a13:	e9 15 01 00 00       	jmp    806b2d <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806a18:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806a1e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806a21:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806a28:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806a2b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806a2e:	39 c2                	cmp    %eax,%edx
+  806a30:	0f 4e c2             	cmovle %edx,%eax
+  806a33:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806a36:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806a3d:	eb 6b                	jmp    806aaa <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806a3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a42:	48 98                	cltq
+  806a44:	48 c1 e0 05          	shl    $0x5,%rax
+  806a48:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806a4c:	48 01 e8             	add    %rbp,%rax
+  806a4f:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806a55:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806a5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a5e:	c1 e0 0c             	shl    $0xc,%eax
+  806a61:	48 63 d0             	movslq %eax,%rdx
+  806a64:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806a6b:	48 01 c2             	add    %rax,%rdx
+  806a6e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a71:	48 98                	cltq
+  806a73:	48 c1 e0 05          	shl    $0x5,%rax
+  806a77:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806a7b:	48 01 e8             	add    %rbp,%rax
+  806a7e:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806a84:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806a87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a8a:	48 98                	cltq
+  806a8c:	48 c1 e0 05          	shl    $0x5,%rax
+  806a90:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806a94:	48 01 e8             	add    %rbp,%rax
+  806a97:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806a9e:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806aa4:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806aa6:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806aaa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806aad:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806ab0:	7c 8d                	jl     806a3f <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806ab2:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806ab9:	74 27                	je     806ae2 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806abb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806abe:	48 63 d0             	movslq %eax,%rdx
+  806ac1:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806ac8:	48 89 d6             	mov    %rdx,%rsi
+  806acb:	48 89 c7             	mov    %rax,%rdi
+  806ace:	49 89 df             	mov    %rbx,%r15
+  806ad1:	48 b8 28 97 ff ff ff 	movabs $0xffffffffffff9728,%rax
+  806ad8:	ff ff ff 
+  806adb:	48 01 d8             	add    %rbx,%rax
+  806ade:	ff d0                	call   *%rax
+  806ae0:	eb 25                	jmp    806b07 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806ae2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806ae5:	48 63 d0             	movslq %eax,%rdx
+  806ae8:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806aef:	48 89 d6             	mov    %rdx,%rsi
+  806af2:	48 89 c7             	mov    %rax,%rdi
+  806af5:	49 89 df             	mov    %rbx,%r15
+  806af8:	48 b8 86 97 ff ff ff 	movabs $0xffffffffffff9786,%rax
+  806aff:	ff ff ff 
+  806b02:	48 01 d8             	add    %rbx,%rax
+  806b05:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806b07:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806b0a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806b0e:	79 05                	jns    806b15 <ipc_window_batch+0x13d>
+			return r;
+  806b10:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b13:	eb 2a                	jmp    806b3f <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806b15:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806b18:	c1 e0 0c             	shl    $0xc,%eax
+  806b1b:	48 98                	cltq
+  806b1d:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806b24:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806b27:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806b2d:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806b34:	0f 8f de fe ff ff    	jg     806a18 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806b3f:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806b46:	5b                   	pop    %rbx
+  806b47:	41 5f                	pop    %r15
+  806b49:	5d                   	pop    %rbp
+  806b4a:	c3                   	ret
+
+0000000000806b4b <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806b4b:	55                   	push   %rbp
+  806b4c:	48 89 e5             	mov    %rsp,%rbp
+  806b4f:	48 83 ec 10          	sub    $0x10,%rsp
+  806b53:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806b53 <ipc_map_window+0x8>
+  806b5a:	49 bb ed 24 00 00 00 	movabs $0x24ed,%r11
+  806b61:	00 00 00 
+  806b64:	4c 01 d8             	add    %r11,%rax
+  806b67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806b6b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806b6e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806b71:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806b75:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806b7a:	bf 01 00 00 00       	mov    $0x1,%edi
+  806b7f:	49 b8 98 d9 ff ff ff 	movabs $0xffffffffffffd998,%r8
+  806b86:	ff ff ff 
+  806b89:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806b8d:	ff d0                	call   *%rax
+}
+  806b8f:	c9                   	leave
+  806b90:	c3                   	ret
+
+0000000000806b91 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806b91:	55                   	push   %rbp
+  806b92:	48 89 e5             	mov    %rsp,%rbp
+  806b95:	48 83 ec 10          	sub    $0x10,%rsp
+  806b99:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806b99 <ipc_unmap_window+0x8>
+  806ba0:	49 bb a7 24 00 00 00 	movabs $0x24a7,%r11
+  806ba7:	00 00 00 
+  806baa:	4c 01 d8             	add    %r11,%rax
+  806bad:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806bb1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806bb4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806bb7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806bbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806bc0:	bf 00 00 00 00       	mov    $0x0,%edi
+  806bc5:	49 b8 98 d9 ff ff ff 	movabs $0xffffffffffffd998,%r8
+  806bcc:	ff ff ff 
+  806bcf:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806bd3:	ff d0                	call   *%rax
+}
+  806bd5:	c9                   	leave
+  806bd6:	c3                   	ret
+
+0000000000806bd7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806bd7:	55                   	push   %rbp
+  806bd8:	48 89 e5             	mov    %rsp,%rbp
+  806bdb:	48 83 ec 18          	sub    $0x18,%rsp
+  806bdf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806bdf <ipc_find_env+0x8>
+  806be6:	49 bb 61 24 00 00 00 	movabs $0x2461,%r11
+  806bed:	00 00 00 
+  806bf0:	4c 01 d8             	add    %r11,%rax
+  806bf3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806bf6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806bfd:	eb 57                	jmp    806c56 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806bff:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806c06:	ff ff ff 
+  806c09:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806c0d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806c10:	48 63 d2             	movslq %edx,%rdx
+  806c13:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806c1a:	48 01 ca             	add    %rcx,%rdx
+  806c1d:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806c24:	8b 12                	mov    (%rdx),%edx
+  806c26:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806c29:	75 27                	jne    806c52 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806c2b:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806c32:	ff ff ff 
+  806c35:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806c39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806c3c:	48 98                	cltq
+  806c3e:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806c45:	48 01 d0             	add    %rdx,%rax
+  806c48:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806c4e:	8b 00                	mov    (%rax),%eax
+  806c50:	eb 12                	jmp    806c64 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806c52:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806c56:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806c5d:	7e a0                	jle    806bff <ipc_find_env+0x28>
+	}
+	return 0;
+  806c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806c64:	c9                   	leave
+  806c65:	c3                   	ret
+
+0000000000806c66 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806c66:	55                   	push   %rbp
+  806c67:	48 89 e5             	mov    %rsp,%rbp
+  806c6a:	48 83 ec 18          	sub    $0x18,%rsp
+  806c6e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806c6e <pageref+0x8>
+  806c75:	49 bb d2 23 00 00 00 	movabs $0x23d2,%r11
+  806c7c:	00 00 00 
+  806c7f:	4c 01 d8             	add    %r11,%rax
+  806c82:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806c86:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c8a:	48 89 d1             	mov    %rdx,%rcx
+  806c8d:	48 c1 e9 15          	shr    $0x15,%rcx
+  806c91:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806c98:	ff ff ff 
+  806c9b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806c9f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806ca3:	83 e2 01             	and    $0x1,%edx
+  806ca6:	48 85 d2             	test   %rdx,%rdx
+  806ca9:	75 07                	jne    806cb2 <pageref+0x4c>
+		return 0;
+  806cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cb0:	eb 64                	jmp    806d16 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806cb2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806cb6:	48 89 d1             	mov    %rdx,%rcx
+  806cb9:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806cbd:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806cc4:	ff ff ff 
+  806cc7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806ccb:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806ccf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806cd3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806cd7:	83 e2 01             	and    $0x1,%edx
+  806cda:	48 85 d2             	test   %rdx,%rdx
+  806cdd:	75 07                	jne    806ce6 <pageref+0x80>
+		return 0;
+  806cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ce4:	eb 30                	jmp    806d16 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806ce6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806cea:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806cee:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806cf5:	ff ff ff 
+  806cf8:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806cfc:	48 89 d0             	mov    %rdx,%rax
+  806cff:	48 01 c0             	add    %rax,%rax
+  806d02:	48 01 d0             	add    %rdx,%rax
+  806d05:	48 c1 e0 03          	shl    $0x3,%rax
+  806d09:	48 01 c8             	add    %rcx,%rax
+  806d0c:	48 83 c0 08          	add    $0x8,%rax
+  806d10:	0f b7 00             	movzwl (%rax),%eax
+  806d13:	0f b7 c0             	movzwl %ax,%eax
+}
+  806d16:	c9                   	leave
+  806d17:	c3                   	ret
+
+0000000000806d18 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806d18:	55                   	push   %rbp
+  806d19:	48 89 e5             	mov    %rsp,%rbp
+  806d1c:	41 57                	push   %r15
+  806d1e:	53                   	push   %rbx
+  806d1f:	48 83 ec 20          	sub    $0x20,%rsp
+  806d23:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d23 <set_pgfault_handler+0xb>
+  806d2a:	49 bb 1d 23 00 00 00 	movabs $0x231d,%r11
+  806d31:	00 00 00 
+  806d34:	4c 01 db             	add    %r11,%rbx
+  806d37:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806d3b:	49 89 df             	mov    %rbx,%r15
+  806d3e:	48 b8 e6 8f ff ff ff 	movabs $0xffffffffffff8fe6,%rax
+  806d45:	ff ff ff 
+  806d48:	48 01 d8             	add    %rbx,%rax
+  806d4b:	ff d0                	call   *%rax
+  806d4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806d50:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806d57:	00 00 00 
+  806d5a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d5e:	48 85 c0             	test   %rax,%rax
+  806d61:	75 6b                	jne    806dce <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806d63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d66:	ba 07 00 00 00       	mov    $0x7,%edx
+  806d6b:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806d70:	48 89 ce             	mov    %rcx,%rsi
+  806d73:	89 c7                	mov    %eax,%edi
+  806d75:	49 89 df             	mov    %rbx,%r15
+  806d78:	48 b8 8f 90 ff ff ff 	movabs $0xffffffffffff908f,%rax
+  806d7f:	ff ff ff 
+  806d82:	48 01 d8             	add    %rbx,%rax
+  806d85:	ff d0                	call   *%rax
+  806d87:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806d8a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806d8e:	74 3e                	je     806dce <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806d90:	48 b8 b0 e5 ff ff ff 	movabs $0xffffffffffffe5b0,%rax
+  806d97:	ff ff ff 
+  806d9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806d9e:	48 89 c2             	mov    %rax,%rdx
+  806da1:	be 23 00 00 00       	mov    $0x23,%esi
+  806da6:	48 b8 de e5 ff ff ff 	movabs $0xffffffffffffe5de,%rax
+  806dad:	ff ff ff 
+  806db0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806db4:	48 89 c7             	mov    %rax,%rdi
+  806db7:	49 89 df             	mov    %rbx,%r15
+  806dba:	b8 00 00 00 00       	mov    $0x0,%eax
+  806dbf:	48 b9 3a 73 ff ff ff 	movabs $0xffffffffffff733a,%rcx
+  806dc6:	ff ff ff 
+  806dc9:	48 01 d9             	add    %rbx,%rcx
+  806dcc:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806dce:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806dd5:	00 00 00 
+  806dd8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806ddc:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806de0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806de3:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806dea:	ff ff ff 
+  806ded:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806df1:	48 89 d6             	mov    %rdx,%rsi
+  806df4:	89 c7                	mov    %eax,%edi
+  806df6:	49 89 df             	mov    %rbx,%r15
+  806df9:	48 b8 85 92 ff ff ff 	movabs $0xffffffffffff9285,%rax
+  806e00:	ff ff ff 
+  806e03:	48 01 d8             	add    %rbx,%rax
+  806e06:	ff d0                	call   *%rax
+}
+  806e08:	90                   	nop
+  806e09:	48 83 c4 20          	add    $0x20,%rsp
+  806e0d:	5b                   	pop    %rbx
+  806e0e:	41 5f                	pop    %r15
+  806e10:	5d                   	pop    %rbp
+  806e11:	c3                   	ret
+
+0000000000806e12 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806e12:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806e15:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806e1c:	00 00 00 
+call *%rax
+  806e1f:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806e21:	58                   	pop    %rax
+	popq %rax;
+  806e22:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806e23:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806e2a:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806e2e:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806e32:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806e36:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806e3a:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806e3e:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806e41:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806e45:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806e49:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806e4e:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806e53:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806e58:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806e5d:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806e62:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806e67:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806e6c:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806e71:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806e76:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806e7b:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806e80:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806e85:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806e8a:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806e8f:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806e93:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806e97:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806e98:	5c                   	pop    %rsp
+	ret;			//return
+  806e99:	c3                   	ret
@@ -0,0 +1,10934 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 d2 05 00 00       	call   800613 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <bench_send_recv>:
+
+#define NROUNDS		1000
+
+static uint64_t
+bench_send_recv(envid_t who, bool parent)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 40          	sub    $0x40,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <bench_send_recv+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  800065:	89 f0                	mov    %esi,%eax
+  800067:	88 45 b8             	mov    %al,-0x48(%rbp)
+
+static __inline uint64_t
+read_tsc(void)
+{
+	uint32_t lo, hi;
+	__asm __volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  80006a:	0f 31                	rdtsc
+  80006c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80006f:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	return ((uint64_t) hi << 32) | lo;
+  800072:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800075:	48 c1 e0 20          	shl    $0x20,%rax
+  800079:	48 89 c2             	mov    %rax,%rdx
+  80007c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80007f:	48 09 d0             	or     %rdx,%rax
+	uint64_t start;
+	uint32_t v;
+	int i;
+
+	start = read_tsc();
+  800082:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < NROUNDS; i++) {
+  800086:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80008d:	e9 a0 00 00 00       	jmp    800132 <bench_send_recv+0xef>
+		if (parent) {
+  800092:	80 7d b8 00          	cmpb   $0x0,-0x48(%rbp)
+  800096:	74 4c                	je     8000e4 <bench_send_recv+0xa1>
+			ipc_send(who, i, 0, 0);
+  800098:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80009b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80009e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000a8:	89 c7                	mov    %eax,%edi
+  8000aa:	49 89 df             	mov    %rbx,%r15
+  8000ad:	48 b8 50 a8 ff ff ff 	movabs $0xffffffffffffa850,%rax
+  8000b4:	ff ff ff 
+  8000b7:	48 01 d8             	add    %rbx,%rax
+  8000ba:	ff d0                	call   *%rax
+			v = ipc_recv(&who, 0, 0);
+  8000bc:	48 8d 45 bc          	lea    -0x44(%rbp),%rax
+  8000c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8000ca:	48 89 c7             	mov    %rax,%rdi
+  8000cd:	49 89 df             	mov    %rbx,%r15
+  8000d0:	48 b8 67 a7 ff ff ff 	movabs $0xffffffffffffa767,%rax
+  8000d7:	ff ff ff 
+  8000da:	48 01 d8             	add    %rbx,%rax
+  8000dd:	ff d0                	call   *%rax
+  8000df:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8000e2:	eb 4a                	jmp    80012e <bench_send_recv+0xeb>
+		} else {
+			v = ipc_recv(&who, 0, 0);
+  8000e4:	48 8d 45 bc          	lea    -0x44(%rbp),%rax
+  8000e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8000f2:	48 89 c7             	mov    %rax,%rdi
+  8000f5:	49 89 df             	mov    %rbx,%r15
+  8000f8:	48 b8 67 a7 ff ff ff 	movabs $0xffffffffffffa767,%rax
+  8000ff:	ff ff ff 
+  800102:	48 01 d8             	add    %rbx,%rax
+  800105:	ff d0                	call   *%rax
+  800107:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			ipc_send(who, v, 0, 0);
+  80010a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80010d:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  800110:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011a:	89 c7                	mov    %eax,%edi
+  80011c:	49 89 df             	mov    %rbx,%r15
+  80011f:	48 b8 50 a8 ff ff ff 	movabs $0xffffffffffffa850,%rax
+  800126:	ff ff ff 
+  800129:	48 01 d8             	add    %rbx,%rax
+  80012c:	ff d0                	call   *%rax
+	for (i = 0; i < NROUNDS; i++) {
+  80012e:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  800132:	81 7d ec e7 03 00 00 	cmpl   $0x3e7,-0x14(%rbp)
+  800139:	0f 8e 53 ff ff ff    	jle    800092 <bench_send_recv+0x4f>
+	__asm __volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  80013f:	0f 31                	rdtsc
+  800141:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  800144:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	return ((uint64_t) hi << 32) | lo;
+  800147:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80014a:	48 c1 e0 20          	shl    $0x20,%rax
+  80014e:	48 89 c2             	mov    %rax,%rdx
+  800151:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800154:	48 09 d0             	or     %rdx,%rax
+		}
+	}
+	return (read_tsc() - start) / NROUNDS;
+  800157:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80015b:	48 c1 e8 03          	shr    $0x3,%rax
+  80015f:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800166:	9b c4 20 
+  800169:	48 f7 e2             	mul    %rdx
+  80016c:	48 89 d0             	mov    %rdx,%rax
+  80016f:	48 c1 e8 04          	shr    $0x4,%rax
+}
+  800173:	48 83 c4 40          	add    $0x40,%rsp
+  800177:	5b                   	pop    %rbx
+  800178:	41 5f                	pop    %r15
+  80017a:	5d                   	pop    %rbp
+  80017b:	c3                   	ret
+
+000000000080017c <bench_call>:
+
+static uint64_t
+bench_call(envid_t who)
+{
+  80017c:	55                   	push   %rbp
+  80017d:	48 89 e5             	mov    %rsp,%rbp
+  800180:	41 57                	push   %r15
+  800182:	53                   	push   %rbx
+  800183:	48 83 ec 30          	sub    $0x30,%rsp
+  800187:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800187 <bench_call+0xb>
+  80018e:	49 bb b9 8e 00 00 00 	movabs $0x8eb9,%r11
+  800195:	00 00 00 
+  800198:	4c 01 db             	add    %r11,%rbx
+  80019b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	__asm __volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  80019e:	0f 31                	rdtsc
+  8001a0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8001a3:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	return ((uint64_t) hi << 32) | lo;
+  8001a6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8001a9:	48 c1 e0 20          	shl    $0x20,%rax
+  8001ad:	48 89 c2             	mov    %rax,%rdx
+  8001b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001b3:	48 09 d0             	or     %rdx,%rax
+	uint64_t start;
+	int i;
+
+	start = read_tsc();
+  8001b6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < NROUNDS; i++)
+  8001ba:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8001c1:	eb 77                	jmp    80023a <bench_call+0xbe>
+		if (ipc_call(who, i, 0, 0, 0, 0) != i)
+  8001c3:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8001c6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8001c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001df:	89 c7                	mov    %eax,%edi
+  8001e1:	49 89 df             	mov    %rbx,%r15
+  8001e4:	48 b8 c3 a8 ff ff ff 	movabs $0xffffffffffffa8c3,%rax
+  8001eb:	ff ff ff 
+  8001ee:	48 01 d8             	add    %rbx,%rax
+  8001f1:	ff d0                	call   *%rax
+  8001f3:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8001f6:	74 3e                	je     800236 <bench_call+0xba>
+			panic("ipc_call: bad reply");
+  8001f8:	48 b8 70 e0 ff ff ff 	movabs $0xffffffffffffe070,%rax
+  8001ff:	ff ff ff 
+  800202:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800206:	48 89 c2             	mov    %rax,%rdx
+  800209:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80020e:	48 b8 84 e0 ff ff ff 	movabs $0xffffffffffffe084,%rax
+  800215:	ff ff ff 
+  800218:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80021c:	48 89 c7             	mov    %rax,%rdi
+  80021f:	49 89 df             	mov    %rbx,%r15
+  800222:	b8 00 00 00 00       	mov    $0x0,%eax
+  800227:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  80022e:	ff ff ff 
+  800231:	48 01 d9             	add    %rbx,%rcx
+  800234:	ff d1                	call   *%rcx
+	for (i = 0; i < NROUNDS; i++)
+  800236:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80023a:	81 7d ec e7 03 00 00 	cmpl   $0x3e7,-0x14(%rbp)
+  800241:	7e 80                	jle    8001c3 <bench_call+0x47>
+	__asm __volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  800243:	0f 31                	rdtsc
+  800245:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  800248:	89 55 d0             	mov    %edx,-0x30(%rbp)
+	return ((uint64_t) hi << 32) | lo;
+  80024b:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80024e:	48 c1 e0 20          	shl    $0x20,%rax
+  800252:	48 89 c2             	mov    %rax,%rdx
+  800255:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800258:	48 09 d0             	or     %rdx,%rax
+	return (read_tsc() - start) / NROUNDS;
+  80025b:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80025f:	48 c1 e8 03          	shr    $0x3,%rax
+  800263:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  80026a:	9b c4 20 
+  80026d:	48 f7 e2             	mul    %rdx
+  800270:	48 89 d0             	mov    %rdx,%rax
+  800273:	48 c1 e8 04          	shr    $0x4,%rax
+}
+  800277:	48 83 c4 30          	add    $0x30,%rsp
+  80027b:	5b                   	pop    %rbx
+  80027c:	41 5f                	pop    %r15
+  80027e:	5d                   	pop    %rbp
+  80027f:	c3                   	ret
+
+0000000000800280 <serve_calls>:
+
+static void
+serve_calls(void)
+{
+  800280:	55                   	push   %rbp
+  800281:	48 89 e5             	mov    %rsp,%rbp
+  800284:	41 57                	push   %r15
+  800286:	53                   	push   %rbx
+  800287:	48 83 ec 10          	sub    $0x10,%rsp
+  80028b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80028b <serve_calls+0xb>
+  800292:	49 bb b5 8d 00 00 00 	movabs $0x8db5,%r11
+  800299:	00 00 00 
+  80029c:	4c 01 db             	add    %r11,%rbx
+	envid_t who = 0;
+  80029f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+	uint32_t v = 0;
+  8002a6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	int i;
+
+	for (i = 0; i < NROUNDS; i++)
+  8002ad:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  8002b4:	eb 40                	jmp    8002f6 <serve_calls+0x76>
+		v = ipc_reply_recv(who, v, 0, 0, &who, 0, 0, 0);
+  8002b6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002b9:	48 8d 55 e4          	lea    -0x1c(%rbp),%rdx
+  8002bd:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8002c0:	6a 00                	push   $0x0
+  8002c2:	6a 00                	push   $0x0
+  8002c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8002ca:	49 89 d0             	mov    %rdx,%r8
+  8002cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d7:	89 c7                	mov    %eax,%edi
+  8002d9:	49 89 df             	mov    %rbx,%r15
+  8002dc:	48 b8 88 ab ff ff ff 	movabs $0xffffffffffffab88,%rax
+  8002e3:	ff ff ff 
+  8002e6:	48 01 d8             	add    %rbx,%rax
+  8002e9:	ff d0                	call   *%rax
+  8002eb:	48 83 c4 10          	add    $0x10,%rsp
+  8002ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	for (i = 0; i < NROUNDS; i++)
+  8002f2:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  8002f6:	81 7d e8 e7 03 00 00 	cmpl   $0x3e7,-0x18(%rbp)
+  8002fd:	7e b7                	jle    8002b6 <serve_calls+0x36>
+	ipc_send(who, v, 0, 0);
+  8002ff:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800302:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  800305:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80030a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030f:	89 c7                	mov    %eax,%edi
+  800311:	49 89 df             	mov    %rbx,%r15
+  800314:	48 b8 50 a8 ff ff ff 	movabs $0xffffffffffffa850,%rax
+  80031b:	ff ff ff 
+  80031e:	48 01 d8             	add    %rbx,%rax
+  800321:	ff d0                	call   *%rax
+}
+  800323:	90                   	nop
+  800324:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  800328:	5b                   	pop    %rbx
+  800329:	41 5f                	pop    %r15
+  80032b:	5d                   	pop    %rbp
+  80032c:	c3                   	ret
+
+000000000080032d <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	41 57                	push   %r15
+  800333:	41 54                	push   %r12
+  800335:	53                   	push   %rbx
+  800336:	48 83 ec 38          	sub    $0x38,%rsp
+  80033a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80033a <umain+0xd>
+  800341:	49 bb 06 8d 00 00 00 	movabs $0x8d06,%r11
+  800348:	00 00 00 
+  80034b:	4c 01 db             	add    %r11,%rbx
+  80034e:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  800351:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+	envid_t who;
+	uint64_t sr, call;
+	bool parent;
+
+	if ((parent = (who = fork()) != 0)) {
+  800355:	49 89 df             	mov    %rbx,%r15
+  800358:	48 b8 c1 a3 ff ff ff 	movabs $0xffffffffffffa3c1,%rax
+  80035f:	ff ff ff 
+  800362:	48 01 d8             	add    %rbx,%rax
+  800365:	ff d0                	call   *%rax
+  800367:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+  80036a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80036d:	85 c0                	test   %eax,%eax
+  80036f:	0f 95 c0             	setne  %al
+  800372:	88 45 df             	mov    %al,-0x21(%rbp)
+  800375:	80 7d df 00          	cmpb   $0x0,-0x21(%rbp)
+  800379:	74 69                	je     8003e4 <umain+0xb7>
+		// get the ball rolling
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80037b:	44 8b 65 c4          	mov    -0x3c(%rbp),%r12d
+  80037f:	49 89 df             	mov    %rbx,%r15
+  800382:	48 b8 89 93 ff ff ff 	movabs $0xffffffffffff9389,%rax
+  800389:	ff ff ff 
+  80038c:	48 01 d8             	add    %rbx,%rax
+  80038f:	ff d0                	call   *%rax
+  800391:	44 89 e2             	mov    %r12d,%edx
+  800394:	89 c6                	mov    %eax,%esi
+  800396:	48 b8 94 e0 ff ff ff 	movabs $0xffffffffffffe094,%rax
+  80039d:	ff ff ff 
+  8003a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003a4:	48 89 c7             	mov    %rax,%rdi
+  8003a7:	49 89 df             	mov    %rbx,%r15
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	48 b9 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rcx
+  8003b6:	ff ff ff 
+  8003b9:	48 01 d9             	add    %rbx,%rcx
+  8003bc:	ff d1                	call   *%rcx
+		ipc_send(who, 0, 0, 0);
+  8003be:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8003c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8003d0:	89 c7                	mov    %eax,%edi
+  8003d2:	49 89 df             	mov    %rbx,%r15
+  8003d5:	48 b8 50 a8 ff ff ff 	movabs $0xffffffffffffa850,%rax
+  8003dc:	ff ff ff 
+  8003df:	48 01 d8             	add    %rbx,%rax
+  8003e2:	ff d0                	call   *%rax
+	}
+
+	while (1) {
+		uint32_t i = ipc_recv(&who, 0, 0);
+  8003e4:	48 8d 45 c4          	lea    -0x3c(%rbp),%rax
+  8003e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8003f2:	48 89 c7             	mov    %rax,%rdi
+  8003f5:	49 89 df             	mov    %rbx,%r15
+  8003f8:	48 b8 67 a7 ff ff ff 	movabs $0xffffffffffffa767,%rax
+  8003ff:	ff ff ff 
+  800402:	48 01 d8             	add    %rbx,%rax
+  800405:	ff d0                	call   *%rax
+  800407:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80040a:	44 8b 65 c4          	mov    -0x3c(%rbp),%r12d
+  80040e:	49 89 df             	mov    %rbx,%r15
+  800411:	48 b8 89 93 ff ff ff 	movabs $0xffffffffffff9389,%rax
+  800418:	ff ff ff 
+  80041b:	48 01 d8             	add    %rbx,%rax
+  80041e:	ff d0                	call   *%rax
+  800420:	89 c6                	mov    %eax,%esi
+  800422:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800425:	44 89 e1             	mov    %r12d,%ecx
+  800428:	89 c2                	mov    %eax,%edx
+  80042a:	48 b8 aa e0 ff ff ff 	movabs $0xffffffffffffe0aa,%rax
+  800431:	ff ff ff 
+  800434:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800438:	48 89 c7             	mov    %rax,%rdi
+  80043b:	49 89 df             	mov    %rbx,%r15
+  80043e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800443:	49 b8 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%r8
+  80044a:	ff ff ff 
+  80044d:	49 01 d8             	add    %rbx,%r8
+  800450:	41 ff d0             	call   *%r8
+		if (i == 10)
+  800453:	83 7d d8 0a          	cmpl   $0xa,-0x28(%rbp)
+  800457:	74 33                	je     80048c <umain+0x15f>
+			break;
+		i++;
+  800459:	83 45 d8 01          	addl   $0x1,-0x28(%rbp)
+		ipc_send(who, i, 0, 0);
+  80045d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  800460:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  800463:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800468:	ba 00 00 00 00       	mov    $0x0,%edx
+  80046d:	89 c7                	mov    %eax,%edi
+  80046f:	49 89 df             	mov    %rbx,%r15
+  800472:	48 b8 50 a8 ff ff ff 	movabs $0xffffffffffffa850,%rax
+  800479:	ff ff ff 
+  80047c:	48 01 d8             	add    %rbx,%rax
+  80047f:	ff d0                	call   *%rax
+		if (i == 10)
+  800481:	83 7d d8 0a          	cmpl   $0xa,-0x28(%rbp)
+  800485:	74 08                	je     80048f <umain+0x162>
+	while (1) {
+  800487:	e9 58 ff ff ff       	jmp    8003e4 <umain+0xb7>
+			break;
+  80048c:	90                   	nop
+  80048d:	eb 01                	jmp    800490 <umain+0x163>
+			break;
+  80048f:	90                   	nop
+	}
+
+	// The parent sent 10, the child received it.
+	if (!parent) {
+  800490:	0f b6 45 df          	movzbl -0x21(%rbp),%eax
+  800494:	83 f0 01             	xor    $0x1,%eax
+  800497:	84 c0                	test   %al,%al
+  800499:	74 2f                	je     8004ca <umain+0x19d>
+		bench_send_recv(who, 0);
+  80049b:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80049e:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a3:	89 c7                	mov    %eax,%edi
+  8004a5:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8004ac:	ff ff ff 
+  8004af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004b3:	ff d0                	call   *%rax
+		serve_calls();
+  8004b5:	48 b8 40 72 ff ff ff 	movabs $0xffffffffffff7240,%rax
+  8004bc:	ff ff ff 
+  8004bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004c3:	ff d0                	call   *%rax
+  8004c5:	e9 3e 01 00 00       	jmp    800608 <umain+0x2db>
+		return;
+	}
+	sr = bench_send_recv(who, 1);
+  8004ca:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8004cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8004d2:	89 c7                	mov    %eax,%edi
+  8004d4:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8004db:	ff ff ff 
+  8004de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004e2:	ff d0                	call   *%rax
+  8004e4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	call = bench_call(who);
+  8004e8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8004eb:	89 c7                	mov    %eax,%edi
+  8004ed:	48 b8 3c 71 ff ff ff 	movabs $0xffffffffffff713c,%rax
+  8004f4:	ff ff ff 
+  8004f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004fb:	ff d0                	call   *%rax
+  8004fd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	cprintf("pingpong: send/recv: %llu cycles per round trip\n", sr);
+  800501:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800505:	48 89 c6             	mov    %rax,%rsi
+  800508:	48 b8 c0 e0 ff ff ff 	movabs $0xffffffffffffe0c0,%rax
+  80050f:	ff ff ff 
+  800512:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800516:	48 89 c7             	mov    %rax,%rdi
+  800519:	49 89 df             	mov    %rbx,%r15
+  80051c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800521:	48 ba b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rdx
+  800528:	ff ff ff 
+  80052b:	48 01 da             	add    %rbx,%rdx
+  80052e:	ff d2                	call   *%rdx
+	cprintf("pingpong: call/reply: %llu cycles per round trip\n", call);
+  800530:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800534:	48 89 c6             	mov    %rax,%rsi
+  800537:	48 b8 f8 e0 ff ff ff 	movabs $0xffffffffffffe0f8,%rax
+  80053e:	ff ff ff 
+  800541:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800545:	48 89 c7             	mov    %rax,%rdi
+  800548:	49 89 df             	mov    %rbx,%r15
+  80054b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800550:	48 ba b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rdx
+  800557:	ff ff ff 
+  80055a:	48 01 da             	add    %rbx,%rdx
+  80055d:	ff d2                	call   *%rdx
+	if (call > 0)
+  80055f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800564:	0f 84 9e 00 00 00    	je     800608 <umain+0x2db>
+		cprintf("pingpong: call/reply is %llu.%02llux faster\n",
+			sr / call, sr * 100 / call % 100);
+  80056a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80056e:	48 89 d0             	mov    %rdx,%rax
+  800571:	48 c1 e0 02          	shl    $0x2,%rax
+  800575:	48 01 d0             	add    %rdx,%rax
+  800578:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80057f:	00 
+  800580:	48 01 d0             	add    %rdx,%rax
+  800583:	48 c1 e0 02          	shl    $0x2,%rax
+  800587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058c:	48 f7 75 c8          	divq   -0x38(%rbp)
+  800590:	48 89 c6             	mov    %rax,%rsi
+		cprintf("pingpong: call/reply is %llu.%02llux faster\n",
+  800593:	48 89 f0             	mov    %rsi,%rax
+  800596:	48 c1 e8 02          	shr    $0x2,%rax
+  80059a:	48 ba c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdx
+  8005a1:	c2 f5 28 
+  8005a4:	48 f7 e2             	mul    %rdx
+  8005a7:	48 89 d1             	mov    %rdx,%rcx
+  8005aa:	48 c1 e9 02          	shr    $0x2,%rcx
+  8005ae:	48 89 c8             	mov    %rcx,%rax
+  8005b1:	48 c1 e0 02          	shl    $0x2,%rax
+  8005b5:	48 01 c8             	add    %rcx,%rax
+  8005b8:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  8005bf:	00 
+  8005c0:	48 01 d0             	add    %rdx,%rax
+  8005c3:	48 c1 e0 02          	shl    $0x2,%rax
+  8005c7:	48 89 f1             	mov    %rsi,%rcx
+  8005ca:	48 29 c1             	sub    %rax,%rcx
+  8005cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8005d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d6:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8005da:	48 89 ca             	mov    %rcx,%rdx
+  8005dd:	48 89 c6             	mov    %rax,%rsi
+  8005e0:	48 b8 30 e1 ff ff ff 	movabs $0xffffffffffffe130,%rax
+  8005e7:	ff ff ff 
+  8005ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005ee:	48 89 c7             	mov    %rax,%rdi
+  8005f1:	49 89 df             	mov    %rbx,%r15
+  8005f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f9:	48 b9 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rcx
+  800600:	ff ff ff 
+  800603:	48 01 d9             	add    %rbx,%rcx
+  800606:	ff d1                	call   *%rcx
+}
+  800608:	48 83 c4 38          	add    $0x38,%rsp
+  80060c:	5b                   	pop    %rbx
+  80060d:	41 5c                	pop    %r12
+  80060f:	41 5f                	pop    %r15
+  800611:	5d                   	pop    %rbp
+  800612:	c3                   	ret
+
+0000000000800613 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800613:	55                   	push   %rbp
+  800614:	48 89 e5             	mov    %rsp,%rbp
+  800617:	41 57                	push   %r15
+  800619:	53                   	push   %rbx
+  80061a:	48 83 ec 20          	sub    $0x20,%rsp
+  80061e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80061e <libmain+0xb>
+  800625:	49 bb 22 8a 00 00 00 	movabs $0x8a22,%r11
+  80062c:	00 00 00 
+  80062f:	4c 01 db             	add    %r11,%rbx
+  800632:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800635:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800639:	49 89 df             	mov    %rbx,%r15
+  80063c:	48 b8 89 93 ff ff ff 	movabs $0xffffffffffff9389,%rax
+  800643:	ff ff ff 
+  800646:	48 01 d8             	add    %rbx,%rax
+  800649:	ff d0                	call   *%rax
+  80064b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  80064e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800651:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800656:	48 98                	cltq
+  800658:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80065f:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800666:	ff ff ff 
+  800669:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80066d:	48 01 c2             	add    %rax,%rdx
+  800670:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  800677:	00 00 00 
+  80067a:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80067e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800682:	7e 15                	jle    800699 <libmain+0x86>
+		binaryname = argv[0];
+  800684:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800688:	48 8b 00             	mov    (%rax),%rax
+  80068b:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  800692:	00 00 00 
+  800695:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800699:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80069d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8006a0:	48 89 d6             	mov    %rdx,%rsi
+  8006a3:	89 c7                	mov    %eax,%edi
+  8006a5:	49 89 df             	mov    %rbx,%r15
+  8006a8:	48 b8 ed 72 ff ff ff 	movabs $0xffffffffffff72ed,%rax
+  8006af:	ff ff ff 
+  8006b2:	48 01 d8             	add    %rbx,%rax
+  8006b5:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8006b7:	49 89 df             	mov    %rbx,%r15
+  8006ba:	48 b8 93 76 ff ff ff 	movabs $0xffffffffffff7693,%rax
+  8006c1:	ff ff ff 
+  8006c4:	48 01 d8             	add    %rbx,%rax
+  8006c7:	ff d0                	call   *%rax
+}
+  8006c9:	90                   	nop
+  8006ca:	48 83 c4 20          	add    $0x20,%rsp
+  8006ce:	5b                   	pop    %rbx
+  8006cf:	41 5f                	pop    %r15
+  8006d1:	5d                   	pop    %rbp
+  8006d2:	c3                   	ret
+
+00000000008006d3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8006d3:	55                   	push   %rbp
+  8006d4:	48 89 e5             	mov    %rsp,%rbp
+  8006d7:	41 57                	push   %r15
+  8006d9:	53                   	push   %rbx
+  8006da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006da <exit+0x7>
+  8006e1:	49 bb 66 89 00 00 00 	movabs $0x8966,%r11
+  8006e8:	00 00 00 
+  8006eb:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8006ee:	49 89 df             	mov    %rbx,%r15
+  8006f1:	48 b8 5e b3 ff ff ff 	movabs $0xffffffffffffb35e,%rax
+  8006f8:	ff ff ff 
+  8006fb:	48 01 d8             	add    %rbx,%rax
+  8006fe:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800700:	bf 00 00 00 00       	mov    $0x0,%edi
+  800705:	49 89 df             	mov    %rbx,%r15
+  800708:	48 b8 2d 93 ff ff ff 	movabs $0xffffffffffff932d,%rax
+  80070f:	ff ff ff 
+  800712:	48 01 d8             	add    %rbx,%rax
+  800715:	ff d0                	call   *%rax
+}
+  800717:	90                   	nop
+  800718:	5b                   	pop    %rbx
+  800719:	41 5f                	pop    %r15
+  80071b:	5d                   	pop    %rbp
+  80071c:	c3                   	ret
+
+000000000080071d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80071d:	55                   	push   %rbp
+  80071e:	48 89 e5             	mov    %rsp,%rbp
+  800721:	41 57                	push   %r15
+  800723:	41 54                	push   %r12
+  800725:	53                   	push   %rbx
+  800726:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80072d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80072d <_panic+0x10>
+  800734:	49 bb 13 89 00 00 00 	movabs $0x8913,%r11
+  80073b:	00 00 00 
+  80073e:	4c 01 db             	add    %r11,%rbx
+  800741:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800748:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80074e:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800755:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80075c:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  800763:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80076a:	84 c0                	test   %al,%al
+  80076c:	74 26                	je     800794 <_panic+0x77>
+  80076e:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  800775:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80077c:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800780:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  800784:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800788:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80078c:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800790:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800794:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80079b:	00 00 00 
+  80079e:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8007a5:	00 00 00 
+  8007a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007ac:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8007b3:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8007ba:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8007c1:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8007c8:	ff ff ff 
+  8007cb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8007cf:	4c 8b 20             	mov    (%rax),%r12
+  8007d2:	49 89 df             	mov    %rbx,%r15
+  8007d5:	48 b8 89 93 ff ff ff 	movabs $0xffffffffffff9389,%rax
+  8007dc:	ff ff ff 
+  8007df:	48 01 d8             	add    %rbx,%rax
+  8007e2:	ff d0                	call   *%rax
+  8007e4:	89 c6                	mov    %eax,%esi
+  8007e6:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8007ec:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8007f3:	41 89 d0             	mov    %edx,%r8d
+  8007f6:	48 89 c1             	mov    %rax,%rcx
+  8007f9:	4c 89 e2             	mov    %r12,%rdx
+  8007fc:	48 b8 68 e1 ff ff ff 	movabs $0xffffffffffffe168,%rax
+  800803:	ff ff ff 
+  800806:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80080a:	48 89 c7             	mov    %rax,%rdi
+  80080d:	49 89 df             	mov    %rbx,%r15
+  800810:	b8 00 00 00 00       	mov    $0x0,%eax
+  800815:	49 b9 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%r9
+  80081c:	ff ff ff 
+  80081f:	49 01 d9             	add    %rbx,%r9
+  800822:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800825:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80082c:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800833:	48 89 d6             	mov    %rdx,%rsi
+  800836:	48 89 c7             	mov    %rax,%rdi
+  800839:	49 89 df             	mov    %rbx,%r15
+  80083c:	48 b8 d4 78 ff ff ff 	movabs $0xffffffffffff78d4,%rax
+  800843:	ff ff ff 
+  800846:	48 01 d8             	add    %rbx,%rax
+  800849:	ff d0                	call   *%rax
+	cprintf("\n");
+  80084b:	48 b8 8b e1 ff ff ff 	movabs $0xffffffffffffe18b,%rax
+  800852:	ff ff ff 
+  800855:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800859:	48 89 c7             	mov    %rax,%rdi
+  80085c:	49 89 df             	mov    %rbx,%r15
+  80085f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800864:	48 ba b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rdx
+  80086b:	ff ff ff 
+  80086e:	48 01 da             	add    %rbx,%rdx
+  800871:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800873:	cc                   	int3
+  800874:	eb fd                	jmp    800873 <_panic+0x156>
+
+0000000000800876 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800876:	55                   	push   %rbp
+  800877:	48 89 e5             	mov    %rsp,%rbp
+  80087a:	41 57                	push   %r15
+  80087c:	48 83 ec 18          	sub    $0x18,%rsp
+  800880:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800880 <putch+0xa>
+  800887:	49 bb c0 87 00 00 00 	movabs $0x87c0,%r11
+  80088e:	00 00 00 
+  800891:	4c 01 d8             	add    %r11,%rax
+  800894:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800897:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80089b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80089f:	8b 12                	mov    (%rdx),%edx
+  8008a1:	8d 72 01             	lea    0x1(%rdx),%esi
+  8008a4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8008a8:	89 31                	mov    %esi,(%rcx)
+  8008aa:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8008ad:	89 ce                	mov    %ecx,%esi
+  8008af:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8008b3:	48 63 d2             	movslq %edx,%rdx
+  8008b6:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8008bb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008bf:	8b 12                	mov    (%rdx),%edx
+  8008c1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8008c7:	75 33                	jne    8008fc <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8008c9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008cd:	8b 12                	mov    (%rdx),%edx
+  8008cf:	48 63 d2             	movslq %edx,%rdx
+  8008d2:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8008d6:	48 83 c1 08          	add    $0x8,%rcx
+  8008da:	48 89 d6             	mov    %rdx,%rsi
+  8008dd:	48 89 cf             	mov    %rcx,%rdi
+  8008e0:	49 89 c7             	mov    %rax,%r15
+  8008e3:	48 ba 7a 92 ff ff ff 	movabs $0xffffffffffff927a,%rdx
+  8008ea:	ff ff ff 
+  8008ed:	48 01 c2             	add    %rax,%rdx
+  8008f0:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8008f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8008f6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8008fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800900:	8b 40 04             	mov    0x4(%rax),%eax
+  800903:	8d 50 01             	lea    0x1(%rax),%edx
+  800906:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80090a:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80090d:	90                   	nop
+  80090e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800912:	c9                   	leave
+  800913:	c3                   	ret
+
+0000000000800914 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800914:	55                   	push   %rbp
+  800915:	48 89 e5             	mov    %rsp,%rbp
+  800918:	41 57                	push   %r15
+  80091a:	53                   	push   %rbx
+  80091b:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800922:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800922 <vcprintf+0xe>
+  800929:	49 bb 1e 87 00 00 00 	movabs $0x871e,%r11
+  800930:	00 00 00 
+  800933:	4c 01 db             	add    %r11,%rbx
+  800936:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80093d:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800944:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80094b:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800952:	48 8b 06             	mov    (%rsi),%rax
+  800955:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800959:	48 89 01             	mov    %rax,(%rcx)
+  80095c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800960:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800964:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800968:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  80096f:	00 00 00 
+    b.cnt = 0;
+  800972:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800979:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  80097c:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800983:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80098a:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800991:	48 89 c6             	mov    %rax,%rsi
+  800994:	48 b8 36 78 ff ff ff 	movabs $0xffffffffffff7836,%rax
+  80099b:	ff ff ff 
+  80099e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009a2:	48 89 c7             	mov    %rax,%rdi
+  8009a5:	49 89 df             	mov    %rbx,%r15
+  8009a8:	48 b8 f8 7d ff ff ff 	movabs $0xffffffffffff7df8,%rax
+  8009af:	ff ff ff 
+  8009b2:	48 01 d8             	add    %rbx,%rax
+  8009b5:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8009b7:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8009bd:	48 98                	cltq
+  8009bf:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8009c6:	48 83 c2 08          	add    $0x8,%rdx
+  8009ca:	48 89 c6             	mov    %rax,%rsi
+  8009cd:	48 89 d7             	mov    %rdx,%rdi
+  8009d0:	49 89 df             	mov    %rbx,%r15
+  8009d3:	48 b8 7a 92 ff ff ff 	movabs $0xffffffffffff927a,%rax
+  8009da:	ff ff ff 
+  8009dd:	48 01 d8             	add    %rbx,%rax
+  8009e0:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8009e2:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8009e8:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8009ef:	5b                   	pop    %rbx
+  8009f0:	41 5f                	pop    %r15
+  8009f2:	5d                   	pop    %rbp
+  8009f3:	c3                   	ret
+
+00000000008009f4 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8009f4:	55                   	push   %rbp
+  8009f5:	48 89 e5             	mov    %rsp,%rbp
+  8009f8:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8009ff:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8009ff <cprintf+0xb>
+  800a06:	49 bb 41 86 00 00 00 	movabs $0x8641,%r11
+  800a0d:	00 00 00 
+  800a10:	4d 01 da             	add    %r11,%r10
+  800a13:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800a1a:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800a21:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800a28:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800a2f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800a36:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800a3d:	84 c0                	test   %al,%al
+  800a3f:	74 20                	je     800a61 <cprintf+0x6d>
+  800a41:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800a45:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800a49:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800a4d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800a51:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800a55:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800a59:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800a5d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800a61:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800a68:	00 00 00 
+  800a6b:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800a72:	00 00 00 
+  800a75:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a79:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800a80:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800a87:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800a8e:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800a95:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800a9c:	48 8b 06             	mov    (%rsi),%rax
+  800a9f:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800aa3:	48 89 01             	mov    %rax,(%rcx)
+  800aa6:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800aaa:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800aae:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800ab2:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800ab9:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800ac0:	48 89 d6             	mov    %rdx,%rsi
+  800ac3:	48 89 c7             	mov    %rax,%rdi
+  800ac6:	48 b8 d4 78 ff ff ff 	movabs $0xffffffffffff78d4,%rax
+  800acd:	ff ff ff 
+  800ad0:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800ad4:	ff d0                	call   *%rax
+  800ad6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800adc:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800ae2:	c9                   	leave
+  800ae3:	c3                   	ret
+
+0000000000800ae4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800ae4:	55                   	push   %rbp
+  800ae5:	48 89 e5             	mov    %rsp,%rbp
+  800ae8:	53                   	push   %rbx
+  800ae9:	48 83 ec 38          	sub    $0x38,%rsp
+  800aed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800aed <printnum+0x9>
+  800af4:	49 bb 53 85 00 00 00 	movabs $0x8553,%r11
+  800afb:	00 00 00 
+  800afe:	4c 01 db             	add    %r11,%rbx
+  800b01:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b05:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800b09:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800b0d:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800b10:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800b14:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800b18:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800b1b:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800b1f:	72 58                	jb     800b79 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800b21:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800b24:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800b27:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800b2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b33:	48 f7 f6             	div    %rsi
+  800b36:	49 89 c2             	mov    %rax,%r10
+  800b39:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800b3c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800b3f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b47:	41 89 c9             	mov    %ecx,%r9d
+  800b4a:	41 89 f8             	mov    %edi,%r8d
+  800b4d:	89 d1                	mov    %edx,%ecx
+  800b4f:	4c 89 d2             	mov    %r10,%rdx
+  800b52:	48 89 c7             	mov    %rax,%rdi
+  800b55:	48 b8 a4 7a ff ff ff 	movabs $0xffffffffffff7aa4,%rax
+  800b5c:	ff ff ff 
+  800b5f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b63:	ff d0                	call   *%rax
+  800b65:	eb 1c                	jmp    800b83 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800b67:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800b6b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800b6e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800b72:	48 89 d6             	mov    %rdx,%rsi
+  800b75:	89 c7                	mov    %eax,%edi
+  800b77:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800b79:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800b7d:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800b81:	7f e4                	jg     800b67 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800b83:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800b86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8f:	48 f7 f1             	div    %rcx
+  800b92:	48 b8 c7 e2 ff ff ff 	movabs $0xffffffffffffe2c7,%rax
+  800b99:	ff ff ff 
+  800b9c:	48 01 d8             	add    %rbx,%rax
+  800b9f:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800ba3:	0f be c0             	movsbl %al,%eax
+  800ba6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800baa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800bae:	48 89 d6             	mov    %rdx,%rsi
+  800bb1:	89 c7                	mov    %eax,%edi
+  800bb3:	ff d1                	call   *%rcx
+}
+  800bb5:	90                   	nop
+  800bb6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800bba:	c9                   	leave
+  800bbb:	c3                   	ret
+
+0000000000800bbc <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800bbc:	55                   	push   %rbp
+  800bbd:	48 89 e5             	mov    %rsp,%rbp
+  800bc0:	48 83 ec 20          	sub    $0x20,%rsp
+  800bc4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800bc4 <getuint+0x8>
+  800bcb:	49 bb 7c 84 00 00 00 	movabs $0x847c,%r11
+  800bd2:	00 00 00 
+  800bd5:	4c 01 d8             	add    %r11,%rax
+  800bd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bdc:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800bdf:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800be3:	7e 4f                	jle    800c34 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800be5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800be9:	8b 00                	mov    (%rax),%eax
+  800beb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bee:	77 24                	ja     800c14 <getuint+0x58>
+  800bf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800bf8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bfc:	8b 00                	mov    (%rax),%eax
+  800bfe:	89 c0                	mov    %eax,%eax
+  800c00:	48 01 d0             	add    %rdx,%rax
+  800c03:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c07:	8b 12                	mov    (%rdx),%edx
+  800c09:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c0c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c10:	89 0a                	mov    %ecx,(%rdx)
+  800c12:	eb 14                	jmp    800c28 <getuint+0x6c>
+  800c14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c18:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c1c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c24:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c28:	48 8b 00             	mov    (%rax),%rax
+  800c2b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c2f:	e9 9d 00 00 00       	jmp    800cd1 <getuint+0x115>
+	else if (lflag)
+  800c34:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800c38:	74 4c                	je     800c86 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800c3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c3e:	8b 00                	mov    (%rax),%eax
+  800c40:	83 f8 2f             	cmp    $0x2f,%eax
+  800c43:	77 24                	ja     800c69 <getuint+0xad>
+  800c45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c49:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c51:	8b 00                	mov    (%rax),%eax
+  800c53:	89 c0                	mov    %eax,%eax
+  800c55:	48 01 d0             	add    %rdx,%rax
+  800c58:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c5c:	8b 12                	mov    (%rdx),%edx
+  800c5e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c61:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c65:	89 0a                	mov    %ecx,(%rdx)
+  800c67:	eb 14                	jmp    800c7d <getuint+0xc1>
+  800c69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c6d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c71:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c75:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c79:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c7d:	48 8b 00             	mov    (%rax),%rax
+  800c80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c84:	eb 4b                	jmp    800cd1 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800c86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c8a:	8b 00                	mov    (%rax),%eax
+  800c8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8f:	77 24                	ja     800cb5 <getuint+0xf9>
+  800c91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c95:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c9d:	8b 00                	mov    (%rax),%eax
+  800c9f:	89 c0                	mov    %eax,%eax
+  800ca1:	48 01 d0             	add    %rdx,%rax
+  800ca4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ca8:	8b 12                	mov    (%rdx),%edx
+  800caa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cad:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cb1:	89 0a                	mov    %ecx,(%rdx)
+  800cb3:	eb 14                	jmp    800cc9 <getuint+0x10d>
+  800cb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cbd:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800cc1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cc5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cc9:	8b 00                	mov    (%rax),%eax
+  800ccb:	89 c0                	mov    %eax,%eax
+  800ccd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800cd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800cd5:	c9                   	leave
+  800cd6:	c3                   	ret
+
+0000000000800cd7 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800cd7:	55                   	push   %rbp
+  800cd8:	48 89 e5             	mov    %rsp,%rbp
+  800cdb:	48 83 ec 20          	sub    $0x20,%rsp
+  800cdf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800cdf <printfloat+0x8>
+  800ce6:	49 bb 61 83 00 00 00 	movabs $0x8361,%r11
+  800ced:	00 00 00 
+  800cf0:	4c 01 d8             	add    %r11,%rax
+  800cf3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800cf7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800cfb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800cff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d03:	48 85 c0             	test   %rax,%rax
+  800d06:	79 12                	jns    800d1a <printfloat+0x43>
+		putch('-',putdat);
+  800d08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800d0c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800d10:	48 89 c6             	mov    %rax,%rsi
+  800d13:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d18:	ff d2                	call   *%rdx
+	
+}
+  800d1a:	90                   	nop
+  800d1b:	c9                   	leave
+  800d1c:	c3                   	ret
+
+0000000000800d1d <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800d1d:	55                   	push   %rbp
+  800d1e:	48 89 e5             	mov    %rsp,%rbp
+  800d21:	48 83 ec 20          	sub    $0x20,%rsp
+  800d25:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800d25 <getint+0x8>
+  800d2c:	49 bb 1b 83 00 00 00 	movabs $0x831b,%r11
+  800d33:	00 00 00 
+  800d36:	4c 01 d8             	add    %r11,%rax
+  800d39:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d3d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800d40:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800d44:	7e 4f                	jle    800d95 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800d46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d4a:	8b 00                	mov    (%rax),%eax
+  800d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4f:	77 24                	ja     800d75 <getint+0x58>
+  800d51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d55:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d5d:	8b 00                	mov    (%rax),%eax
+  800d5f:	89 c0                	mov    %eax,%eax
+  800d61:	48 01 d0             	add    %rdx,%rax
+  800d64:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d68:	8b 12                	mov    (%rdx),%edx
+  800d6a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d6d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d71:	89 0a                	mov    %ecx,(%rdx)
+  800d73:	eb 14                	jmp    800d89 <getint+0x6c>
+  800d75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d79:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d7d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d85:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d89:	48 8b 00             	mov    (%rax),%rax
+  800d8c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800d90:	e9 9d 00 00 00       	jmp    800e32 <getint+0x115>
+	else if (lflag)
+  800d95:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800d99:	74 4c                	je     800de7 <getint+0xca>
+		x=va_arg(*ap, long);
+  800d9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d9f:	8b 00                	mov    (%rax),%eax
+  800da1:	83 f8 2f             	cmp    $0x2f,%eax
+  800da4:	77 24                	ja     800dca <getint+0xad>
+  800da6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800daa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800dae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db2:	8b 00                	mov    (%rax),%eax
+  800db4:	89 c0                	mov    %eax,%eax
+  800db6:	48 01 d0             	add    %rdx,%rax
+  800db9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800dbd:	8b 12                	mov    (%rdx),%edx
+  800dbf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800dc2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800dc6:	89 0a                	mov    %ecx,(%rdx)
+  800dc8:	eb 14                	jmp    800dde <getint+0xc1>
+  800dca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800dd2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800dd6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800dda:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800dde:	48 8b 00             	mov    (%rax),%rax
+  800de1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800de5:	eb 4b                	jmp    800e32 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800de7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800deb:	8b 00                	mov    (%rax),%eax
+  800ded:	83 f8 2f             	cmp    $0x2f,%eax
+  800df0:	77 24                	ja     800e16 <getint+0xf9>
+  800df2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800df6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800dfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dfe:	8b 00                	mov    (%rax),%eax
+  800e00:	89 c0                	mov    %eax,%eax
+  800e02:	48 01 d0             	add    %rdx,%rax
+  800e05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e09:	8b 12                	mov    (%rdx),%edx
+  800e0b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800e0e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e12:	89 0a                	mov    %ecx,(%rdx)
+  800e14:	eb 14                	jmp    800e2a <getint+0x10d>
+  800e16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e1a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e1e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800e22:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e26:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800e2a:	8b 00                	mov    (%rax),%eax
+  800e2c:	48 98                	cltq
+  800e2e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800e32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800e36:	c9                   	leave
+  800e37:	c3                   	ret
+
+0000000000800e38 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800e38:	55                   	push   %rbp
+  800e39:	48 89 e5             	mov    %rsp,%rbp
+  800e3c:	41 57                	push   %r15
+  800e3e:	41 55                	push   %r13
+  800e40:	41 54                	push   %r12
+  800e42:	53                   	push   %rbx
+  800e43:	48 83 ec 60          	sub    $0x60,%rsp
+  800e47:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800e47 <vprintfmt+0xf>
+  800e4e:	49 bb f9 81 00 00 00 	movabs $0x81f9,%r11
+  800e55:	00 00 00 
+  800e58:	4d 01 dc             	add    %r11,%r12
+  800e5b:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800e5f:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800e63:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800e67:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800e6b:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800e72:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800e76:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800e7a:	48 8b 06             	mov    (%rsi),%rax
+  800e7d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800e81:	48 89 01             	mov    %rax,(%rcx)
+  800e84:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800e88:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800e8c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800e90:	eb 17                	jmp    800ea9 <vprintfmt+0x71>
+			if (ch == '\0')
+  800e92:	85 db                	test   %ebx,%ebx
+  800e94:	0f 84 97 05 00 00    	je     801431 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800e9a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e9e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ea2:	48 89 c6             	mov    %rax,%rsi
+  800ea5:	89 df                	mov    %ebx,%edi
+  800ea7:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ea9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ead:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800eb1:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800eb5:	0f b6 00             	movzbl (%rax),%eax
+  800eb8:	0f b6 d8             	movzbl %al,%ebx
+  800ebb:	83 fb 25             	cmp    $0x25,%ebx
+  800ebe:	75 d2                	jne    800e92 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800ec0:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800ec4:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800ecb:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800ed2:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800ed9:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800ee0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ee4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ee8:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800eec:	0f b6 00             	movzbl (%rax),%eax
+  800eef:	0f b6 d8             	movzbl %al,%ebx
+  800ef2:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800ef5:	83 f8 55             	cmp    $0x55,%eax
+  800ef8:	0f 87 00 05 00 00    	ja     8013fe <vprintfmt+0x5c6>
+  800efe:	89 c0                	mov    %eax,%eax
+  800f00:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800f07:	00 
+  800f08:	48 8d 05 21 64 00 00 	lea    0x6421(%rip),%rax        # 807330 <.LC18+0xc>
+  800f0f:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800f13:	48 8d 15 16 64 00 00 	lea    0x6416(%rip),%rdx        # 807330 <.LC18+0xc>
+  800f1a:	48 01 d0             	add    %rdx,%rax
+  800f1d:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800f1f:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800f23:	eb bb                	jmp    800ee0 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800f25:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800f29:	eb b5                	jmp    800ee0 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800f2b:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800f32:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800f35:	89 d0                	mov    %edx,%eax
+  800f37:	c1 e0 02             	shl    $0x2,%eax
+  800f3a:	01 d0                	add    %edx,%eax
+  800f3c:	01 c0                	add    %eax,%eax
+  800f3e:	01 d8                	add    %ebx,%eax
+  800f40:	83 e8 30             	sub    $0x30,%eax
+  800f43:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800f46:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f4a:	0f b6 00             	movzbl (%rax),%eax
+  800f4d:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800f50:	83 fb 2f             	cmp    $0x2f,%ebx
+  800f53:	7e 60                	jle    800fb5 <vprintfmt+0x17d>
+  800f55:	83 fb 39             	cmp    $0x39,%ebx
+  800f58:	7f 5b                	jg     800fb5 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800f5a:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800f5f:	eb d1                	jmp    800f32 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800f61:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f64:	83 f8 2f             	cmp    $0x2f,%eax
+  800f67:	77 17                	ja     800f80 <vprintfmt+0x148>
+  800f69:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f6d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f70:	89 d2                	mov    %edx,%edx
+  800f72:	48 01 d0             	add    %rdx,%rax
+  800f75:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f78:	83 c2 08             	add    $0x8,%edx
+  800f7b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f7e:	eb 0c                	jmp    800f8c <vprintfmt+0x154>
+  800f80:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f84:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f88:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f8c:	8b 00                	mov    (%rax),%eax
+  800f8e:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800f91:	eb 23                	jmp    800fb6 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800f93:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f97:	0f 89 43 ff ff ff    	jns    800ee0 <vprintfmt+0xa8>
+				width = 0;
+  800f9d:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800fa4:	e9 37 ff ff ff       	jmp    800ee0 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800fa9:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800fb0:	e9 2b ff ff ff       	jmp    800ee0 <vprintfmt+0xa8>
+			goto process_precision;
+  800fb5:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800fb6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800fba:	0f 89 20 ff ff ff    	jns    800ee0 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800fc0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800fc3:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800fc6:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800fcd:	e9 0e ff ff ff       	jmp    800ee0 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800fd2:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800fd6:	e9 05 ff ff ff       	jmp    800ee0 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800fdb:	83 fb 39             	cmp    $0x39,%ebx
+  800fde:	7f 0b                	jg     800feb <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800fe0:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800fe3:	c1 e0 08             	shl    $0x8,%eax
+  800fe6:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800fe9:	eb 21                	jmp    80100c <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800feb:	83 fb 60             	cmp    $0x60,%ebx
+  800fee:	7e 10                	jle    801000 <vprintfmt+0x1c8>
+  800ff0:	83 fb 66             	cmp    $0x66,%ebx
+  800ff3:	7f 0b                	jg     801000 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800ff5:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800ff8:	c1 e0 08             	shl    $0x8,%eax
+  800ffb:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800ffe:	eb 0c                	jmp    80100c <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  801000:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  801007:	e9 04 01 00 00       	jmp    801110 <vprintfmt+0x2d8>
+  80100c:	e9 ff 00 00 00       	jmp    801110 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  801011:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801014:	83 f8 2f             	cmp    $0x2f,%eax
+  801017:	77 17                	ja     801030 <vprintfmt+0x1f8>
+  801019:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80101d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801020:	89 d2                	mov    %edx,%edx
+  801022:	48 01 d0             	add    %rdx,%rax
+  801025:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801028:	83 c2 08             	add    $0x8,%edx
+  80102b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80102e:	eb 0c                	jmp    80103c <vprintfmt+0x204>
+  801030:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801034:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801038:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80103c:	8b 00                	mov    (%rax),%eax
+  80103e:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  801042:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801046:	48 89 d6             	mov    %rdx,%rsi
+  801049:	89 c7                	mov    %eax,%edi
+  80104b:	ff d1                	call   *%rcx
+			break;
+  80104d:	e9 da 03 00 00       	jmp    80142c <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  801052:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801055:	83 f8 2f             	cmp    $0x2f,%eax
+  801058:	77 17                	ja     801071 <vprintfmt+0x239>
+  80105a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80105e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801061:	89 d2                	mov    %edx,%edx
+  801063:	48 01 d0             	add    %rdx,%rax
+  801066:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801069:	83 c2 08             	add    $0x8,%edx
+  80106c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80106f:	eb 0c                	jmp    80107d <vprintfmt+0x245>
+  801071:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801075:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801079:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80107d:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  80107f:	85 db                	test   %ebx,%ebx
+  801081:	79 02                	jns    801085 <vprintfmt+0x24d>
+				err = -err;
+  801083:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801085:	83 fb 15             	cmp    $0x15,%ebx
+  801088:	7f 19                	jg     8010a3 <vprintfmt+0x26b>
+  80108a:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  801091:	00 00 00 
+  801094:	48 63 c3             	movslq %ebx,%rax
+  801097:	4c 01 e2             	add    %r12,%rdx
+  80109a:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  80109e:	4d 85 ed             	test   %r13,%r13
+  8010a1:	75 36                	jne    8010d9 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  8010a3:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8010a7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010ab:	89 d9                	mov    %ebx,%ecx
+  8010ad:	48 ba d8 e2 ff ff ff 	movabs $0xffffffffffffe2d8,%rdx
+  8010b4:	ff ff ff 
+  8010b7:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8010bb:	48 89 c7             	mov    %rax,%rdi
+  8010be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c3:	49 b8 ff 83 ff ff ff 	movabs $0xffffffffffff83ff,%r8
+  8010ca:	ff ff ff 
+  8010cd:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8010d1:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  8010d4:	e9 53 03 00 00       	jmp    80142c <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  8010d9:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8010dd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010e1:	4c 89 e9             	mov    %r13,%rcx
+  8010e4:	48 ba e1 e2 ff ff ff 	movabs $0xffffffffffffe2e1,%rdx
+  8010eb:	ff ff ff 
+  8010ee:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  8010f2:	48 89 c7             	mov    %rax,%rdi
+  8010f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010fa:	49 b8 ff 83 ff ff ff 	movabs $0xffffffffffff83ff,%r8
+  801101:	ff ff ff 
+  801104:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801108:	41 ff d0             	call   *%r8
+			break;
+  80110b:	e9 1c 03 00 00       	jmp    80142c <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  801110:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801113:	83 f8 2f             	cmp    $0x2f,%eax
+  801116:	77 17                	ja     80112f <vprintfmt+0x2f7>
+  801118:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80111c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80111f:	89 d2                	mov    %edx,%edx
+  801121:	48 01 d0             	add    %rdx,%rax
+  801124:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801127:	83 c2 08             	add    $0x8,%edx
+  80112a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80112d:	eb 0c                	jmp    80113b <vprintfmt+0x303>
+  80112f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801133:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801137:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80113b:	4c 8b 28             	mov    (%rax),%r13
+  80113e:	4d 85 ed             	test   %r13,%r13
+  801141:	75 0e                	jne    801151 <vprintfmt+0x319>
+				p = "(null)";
+  801143:	48 b8 e4 e2 ff ff ff 	movabs $0xffffffffffffe2e4,%rax
+  80114a:	ff ff ff 
+  80114d:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  801151:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801155:	0f 8e 84 00 00 00    	jle    8011df <vprintfmt+0x3a7>
+  80115b:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  80115f:	74 7e                	je     8011df <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801161:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801164:	48 98                	cltq
+  801166:	48 89 c6             	mov    %rax,%rsi
+  801169:	4c 89 ef             	mov    %r13,%rdi
+  80116c:	4d 89 e7             	mov    %r12,%r15
+  80116f:	48 b8 24 87 ff ff ff 	movabs $0xffffffffffff8724,%rax
+  801176:	ff ff ff 
+  801179:	4c 01 e0             	add    %r12,%rax
+  80117c:	ff d0                	call   *%rax
+  80117e:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  801181:	eb 17                	jmp    80119a <vprintfmt+0x362>
+					putch(padc, putdat);
+  801183:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  801187:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80118b:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  80118f:	48 89 d6             	mov    %rdx,%rsi
+  801192:	89 c7                	mov    %eax,%edi
+  801194:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801196:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80119a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80119e:	7f e3                	jg     801183 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8011a0:	eb 3d                	jmp    8011df <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8011a2:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8011a6:	74 1e                	je     8011c6 <vprintfmt+0x38e>
+  8011a8:	83 fb 1f             	cmp    $0x1f,%ebx
+  8011ab:	7e 05                	jle    8011b2 <vprintfmt+0x37a>
+  8011ad:	83 fb 7e             	cmp    $0x7e,%ebx
+  8011b0:	7e 14                	jle    8011c6 <vprintfmt+0x38e>
+					putch('?', putdat);
+  8011b2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011b6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011ba:	48 89 c6             	mov    %rax,%rsi
+  8011bd:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8011c2:	ff d2                	call   *%rdx
+  8011c4:	eb 15                	jmp    8011db <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  8011c6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8011c9:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  8011cc:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011d0:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011d4:	48 89 c6             	mov    %rax,%rsi
+  8011d7:	89 cf                	mov    %ecx,%edi
+  8011d9:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8011db:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8011df:	4c 89 e8             	mov    %r13,%rax
+  8011e2:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  8011e6:	0f b6 00             	movzbl (%rax),%eax
+  8011e9:	0f be d8             	movsbl %al,%ebx
+  8011ec:	85 db                	test   %ebx,%ebx
+  8011ee:	74 28                	je     801218 <vprintfmt+0x3e0>
+  8011f0:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8011f4:	78 ac                	js     8011a2 <vprintfmt+0x36a>
+  8011f6:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  8011fa:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8011fe:	79 a2                	jns    8011a2 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  801200:	eb 16                	jmp    801218 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  801202:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801206:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80120a:	48 89 c6             	mov    %rax,%rsi
+  80120d:	bf 20 00 00 00       	mov    $0x20,%edi
+  801212:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801214:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801218:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80121c:	7f e4                	jg     801202 <vprintfmt+0x3ca>
+			break;
+  80121e:	e9 09 02 00 00       	jmp    80142c <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  801223:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801227:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80122b:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80122f:	0f b6 00             	movzbl (%rax),%eax
+  801232:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801235:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801236:	83 fb 2f             	cmp    $0x2f,%ebx
+  801239:	0f 8e ac fd ff ff    	jle    800feb <vprintfmt+0x1b3>
+  80123f:	e9 97 fd ff ff       	jmp    800fdb <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801244:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801248:	be 03 00 00 00       	mov    $0x3,%esi
+  80124d:	48 89 c7             	mov    %rax,%rdi
+  801250:	48 b8 dd 7c ff ff ff 	movabs $0xffffffffffff7cdd,%rax
+  801257:	ff ff ff 
+  80125a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80125e:	ff d0                	call   *%rax
+  801260:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  801264:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801268:	48 85 c0             	test   %rax,%rax
+  80126b:	79 1d                	jns    80128a <vprintfmt+0x452>
+				putch('-', putdat);
+  80126d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801271:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801275:	48 89 c6             	mov    %rax,%rsi
+  801278:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80127d:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  80127f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801283:	48 f7 d8             	neg    %rax
+  801286:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  80128a:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801291:	e9 de 00 00 00       	jmp    801374 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801296:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80129a:	be 03 00 00 00       	mov    $0x3,%esi
+  80129f:	48 89 c7             	mov    %rax,%rdi
+  8012a2:	48 b8 7c 7b ff ff ff 	movabs $0xffffffffffff7b7c,%rax
+  8012a9:	ff ff ff 
+  8012ac:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012b0:	ff d0                	call   *%rax
+  8012b2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  8012b6:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8012bd:	e9 b2 00 00 00       	jmp    801374 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8012c2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8012c6:	be 03 00 00 00       	mov    $0x3,%esi
+  8012cb:	48 89 c7             	mov    %rax,%rdi
+  8012ce:	48 b8 7c 7b ff ff ff 	movabs $0xffffffffffff7b7c,%rax
+  8012d5:	ff ff ff 
+  8012d8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012dc:	ff d0                	call   *%rax
+  8012de:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  8012e2:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  8012e9:	e9 86 00 00 00       	jmp    801374 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  8012ee:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8012f2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8012f6:	48 89 c6             	mov    %rax,%rsi
+  8012f9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8012fe:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801300:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801304:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801308:	48 89 c6             	mov    %rax,%rsi
+  80130b:	bf 78 00 00 00       	mov    $0x78,%edi
+  801310:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801312:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801315:	83 f8 2f             	cmp    $0x2f,%eax
+  801318:	77 17                	ja     801331 <vprintfmt+0x4f9>
+  80131a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80131e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801321:	89 d2                	mov    %edx,%edx
+  801323:	48 01 d0             	add    %rdx,%rax
+  801326:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801329:	83 c2 08             	add    $0x8,%edx
+  80132c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80132f:	eb 0c                	jmp    80133d <vprintfmt+0x505>
+  801331:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801335:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801339:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80133d:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801340:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801344:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  80134b:	eb 27                	jmp    801374 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  80134d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801351:	be 03 00 00 00       	mov    $0x3,%esi
+  801356:	48 89 c7             	mov    %rax,%rdi
+  801359:	48 b8 7c 7b ff ff ff 	movabs $0xffffffffffff7b7c,%rax
+  801360:	ff ff ff 
+  801363:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801367:	ff d0                	call   *%rax
+  801369:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80136d:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801374:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801379:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80137c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80137f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801383:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801387:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80138b:	45 89 c1             	mov    %r8d,%r9d
+  80138e:	41 89 f8             	mov    %edi,%r8d
+  801391:	48 89 c7             	mov    %rax,%rdi
+  801394:	48 b8 a4 7a ff ff ff 	movabs $0xffffffffffff7aa4,%rax
+  80139b:	ff ff ff 
+  80139e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013a2:	ff d0                	call   *%rax
+			break;
+  8013a4:	e9 83 00 00 00       	jmp    80142c <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8013a9:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8013ad:	be 03 00 00 00       	mov    $0x3,%esi
+  8013b2:	48 89 c7             	mov    %rax,%rdi
+  8013b5:	48 b8 7c 7b ff ff ff 	movabs $0xffffffffffff7b7c,%rax
+  8013bc:	ff ff ff 
+  8013bf:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013c3:	ff d0                	call   *%rax
+  8013c5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8013c9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8013cd:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8013d1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8013d5:	48 89 ce             	mov    %rcx,%rsi
+  8013d8:	48 89 c7             	mov    %rax,%rdi
+  8013db:	48 b8 97 7c ff ff ff 	movabs $0xffffffffffff7c97,%rax
+  8013e2:	ff ff ff 
+  8013e5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013e9:	ff d0                	call   *%rax
+	
+			break;
+  8013eb:	eb 3f                	jmp    80142c <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8013ed:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8013f1:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8013f5:	48 89 c6             	mov    %rax,%rsi
+  8013f8:	89 df                	mov    %ebx,%edi
+  8013fa:	ff d2                	call   *%rdx
+			break;
+  8013fc:	eb 2e                	jmp    80142c <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8013fe:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801402:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801406:	48 89 c6             	mov    %rax,%rsi
+  801409:	bf 25 00 00 00       	mov    $0x25,%edi
+  80140e:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801410:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801415:	eb 05                	jmp    80141c <vprintfmt+0x5e4>
+  801417:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80141c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801420:	48 83 e8 01          	sub    $0x1,%rax
+  801424:	0f b6 00             	movzbl (%rax),%eax
+  801427:	3c 25                	cmp    $0x25,%al
+  801429:	75 ec                	jne    801417 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  80142b:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80142c:	e9 78 fa ff ff       	jmp    800ea9 <vprintfmt+0x71>
+				return;
+  801431:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801432:	48 83 c4 60          	add    $0x60,%rsp
+  801436:	5b                   	pop    %rbx
+  801437:	41 5c                	pop    %r12
+  801439:	41 5d                	pop    %r13
+  80143b:	41 5f                	pop    %r15
+  80143d:	5d                   	pop    %rbp
+  80143e:	c3                   	ret
+
+000000000080143f <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80143f:	55                   	push   %rbp
+  801440:	48 89 e5             	mov    %rsp,%rbp
+  801443:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80144a:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80144a <printfmt+0xb>
+  801451:	49 bb f6 7b 00 00 00 	movabs $0x7bf6,%r11
+  801458:	00 00 00 
+  80145b:	4d 01 da             	add    %r11,%r10
+  80145e:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801465:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80146c:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801473:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80147a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801481:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801488:	84 c0                	test   %al,%al
+  80148a:	74 20                	je     8014ac <printfmt+0x6d>
+  80148c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801490:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801494:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801498:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80149c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8014a0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8014a4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8014a8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8014ac:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8014b3:	00 00 00 
+  8014b6:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8014bd:	00 00 00 
+  8014c0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014c4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8014cb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8014d2:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8014d9:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8014e0:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8014e7:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8014ee:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8014f5:	48 89 c7             	mov    %rax,%rdi
+  8014f8:	48 b8 f8 7d ff ff ff 	movabs $0xffffffffffff7df8,%rax
+  8014ff:	ff ff ff 
+  801502:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801506:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801508:	90                   	nop
+  801509:	c9                   	leave
+  80150a:	c3                   	ret
+
+000000000080150b <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80150b:	55                   	push   %rbp
+  80150c:	48 89 e5             	mov    %rsp,%rbp
+  80150f:	48 83 ec 10          	sub    $0x10,%rsp
+  801513:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801513 <sprintputch+0x8>
+  80151a:	49 bb 2d 7b 00 00 00 	movabs $0x7b2d,%r11
+  801521:	00 00 00 
+  801524:	4c 01 d8             	add    %r11,%rax
+  801527:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80152a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80152e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801532:	8b 40 10             	mov    0x10(%rax),%eax
+  801535:	8d 50 01             	lea    0x1(%rax),%edx
+  801538:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80153c:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80153f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801543:	48 8b 10             	mov    (%rax),%rdx
+  801546:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80154a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80154e:	48 39 c2             	cmp    %rax,%rdx
+  801551:	73 17                	jae    80156a <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801553:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801557:	48 8b 00             	mov    (%rax),%rax
+  80155a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80155e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801562:	48 89 0a             	mov    %rcx,(%rdx)
+  801565:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801568:	88 10                	mov    %dl,(%rax)
+}
+  80156a:	90                   	nop
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+
+000000000080156d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80156d:	55                   	push   %rbp
+  80156e:	48 89 e5             	mov    %rsp,%rbp
+  801571:	53                   	push   %rbx
+  801572:	48 83 ec 58          	sub    $0x58,%rsp
+  801576:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801576 <vsnprintf+0x9>
+  80157d:	49 bb ca 7a 00 00 00 	movabs $0x7aca,%r11
+  801584:	00 00 00 
+  801587:	4c 01 d8             	add    %r11,%rax
+  80158a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80158e:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801591:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801595:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801599:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80159d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8015a1:	48 8b 0e             	mov    (%rsi),%rcx
+  8015a4:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8015a8:	48 89 0a             	mov    %rcx,(%rdx)
+  8015ab:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8015af:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8015b3:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8015b7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8015bb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8015bf:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8015c2:	48 63 d2             	movslq %edx,%rdx
+  8015c5:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8015c9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8015cd:	48 01 ca             	add    %rcx,%rdx
+  8015d0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8015d4:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8015db:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8015e0:	74 06                	je     8015e8 <vsnprintf+0x7b>
+  8015e2:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8015e6:	7f 07                	jg     8015ef <vsnprintf+0x82>
+		return -E_INVAL;
+  8015e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ed:	eb 34                	jmp    801623 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8015ef:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8015f3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8015f7:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8015fb:	48 bf cb 84 ff ff ff 	movabs $0xffffffffffff84cb,%rdi
+  801602:	ff ff ff 
+  801605:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801609:	49 b8 f8 7d ff ff ff 	movabs $0xffffffffffff7df8,%r8
+  801610:	ff ff ff 
+  801613:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801617:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801619:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80161d:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801620:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801623:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801627:	c9                   	leave
+  801628:	c3                   	ret
+
+0000000000801629 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801629:	55                   	push   %rbp
+  80162a:	48 89 e5             	mov    %rsp,%rbp
+  80162d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801634:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801634 <snprintf+0xb>
+  80163b:	49 bb 0c 7a 00 00 00 	movabs $0x7a0c,%r11
+  801642:	00 00 00 
+  801645:	4d 01 da             	add    %r11,%r10
+  801648:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80164f:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801655:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80165c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801663:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80166a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801671:	84 c0                	test   %al,%al
+  801673:	74 20                	je     801695 <snprintf+0x6c>
+  801675:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801679:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80167d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801681:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801685:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801689:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80168d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801691:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801695:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80169c:	00 00 00 
+  80169f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8016a6:	00 00 00 
+  8016a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016ad:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8016b4:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8016bb:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8016c2:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8016c9:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8016d0:	48 8b 06             	mov    (%rsi),%rax
+  8016d3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8016d7:	48 89 01             	mov    %rax,(%rcx)
+  8016da:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8016de:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8016e2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8016e6:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8016ed:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8016f4:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8016fa:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801701:	48 89 c7             	mov    %rax,%rdi
+  801704:	48 b8 2d 85 ff ff ff 	movabs $0xffffffffffff852d,%rax
+  80170b:	ff ff ff 
+  80170e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801712:	ff d0                	call   *%rax
+  801714:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  80171a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801720:	c9                   	leave
+  801721:	c3                   	ret
+
+0000000000801722 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801722:	55                   	push   %rbp
+  801723:	48 89 e5             	mov    %rsp,%rbp
+  801726:	48 83 ec 18          	sub    $0x18,%rsp
+  80172a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80172a <strlen+0x8>
+  801731:	49 bb 16 79 00 00 00 	movabs $0x7916,%r11
+  801738:	00 00 00 
+  80173b:	4c 01 d8             	add    %r11,%rax
+  80173e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801742:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801749:	eb 09                	jmp    801754 <strlen+0x32>
+		n++;
+  80174b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  80174f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801754:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801758:	0f b6 00             	movzbl (%rax),%eax
+  80175b:	84 c0                	test   %al,%al
+  80175d:	75 ec                	jne    80174b <strlen+0x29>
+	return n;
+  80175f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801762:	c9                   	leave
+  801763:	c3                   	ret
+
+0000000000801764 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801764:	55                   	push   %rbp
+  801765:	48 89 e5             	mov    %rsp,%rbp
+  801768:	48 83 ec 20          	sub    $0x20,%rsp
+  80176c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80176c <strnlen+0x8>
+  801773:	49 bb d4 78 00 00 00 	movabs $0x78d4,%r11
+  80177a:	00 00 00 
+  80177d:	4c 01 d8             	add    %r11,%rax
+  801780:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801784:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801788:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80178f:	eb 0e                	jmp    80179f <strnlen+0x3b>
+		n++;
+  801791:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801795:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80179a:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80179f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8017a4:	74 0b                	je     8017b1 <strnlen+0x4d>
+  8017a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017aa:	0f b6 00             	movzbl (%rax),%eax
+  8017ad:	84 c0                	test   %al,%al
+  8017af:	75 e0                	jne    801791 <strnlen+0x2d>
+	return n;
+  8017b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8017b4:	c9                   	leave
+  8017b5:	c3                   	ret
+
+00000000008017b6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8017b6:	55                   	push   %rbp
+  8017b7:	48 89 e5             	mov    %rsp,%rbp
+  8017ba:	48 83 ec 20          	sub    $0x20,%rsp
+  8017be:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017be <strcpy+0x8>
+  8017c5:	49 bb 82 78 00 00 00 	movabs $0x7882,%r11
+  8017cc:	00 00 00 
+  8017cf:	4c 01 d8             	add    %r11,%rax
+  8017d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017d6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8017da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8017e2:	90                   	nop
+  8017e3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017e7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017eb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017f7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017fb:	0f b6 12             	movzbl (%rdx),%edx
+  8017fe:	88 10                	mov    %dl,(%rax)
+  801800:	0f b6 00             	movzbl (%rax),%eax
+  801803:	84 c0                	test   %al,%al
+  801805:	75 dc                	jne    8017e3 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801807:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80180b:	c9                   	leave
+  80180c:	c3                   	ret
+
+000000000080180d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80180d:	55                   	push   %rbp
+  80180e:	48 89 e5             	mov    %rsp,%rbp
+  801811:	53                   	push   %rbx
+  801812:	48 83 ec 20          	sub    $0x20,%rsp
+  801816:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801816 <strcat+0x9>
+  80181d:	49 bb 2a 78 00 00 00 	movabs $0x782a,%r11
+  801824:	00 00 00 
+  801827:	4c 01 db             	add    %r11,%rbx
+  80182a:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80182e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801832:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801836:	48 89 c7             	mov    %rax,%rdi
+  801839:	48 b8 e2 86 ff ff ff 	movabs $0xffffffffffff86e2,%rax
+  801840:	ff ff ff 
+  801843:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801847:	ff d0                	call   *%rax
+  801849:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  80184c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80184f:	48 63 d0             	movslq %eax,%rdx
+  801852:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801856:	48 01 c2             	add    %rax,%rdx
+  801859:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80185d:	48 89 c6             	mov    %rax,%rsi
+  801860:	48 89 d7             	mov    %rdx,%rdi
+  801863:	48 b8 76 87 ff ff ff 	movabs $0xffffffffffff8776,%rax
+  80186a:	ff ff ff 
+  80186d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801871:	ff d0                	call   *%rax
+	return dst;
+  801873:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801877:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80187b:	c9                   	leave
+  80187c:	c3                   	ret
+
+000000000080187d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80187d:	55                   	push   %rbp
+  80187e:	48 89 e5             	mov    %rsp,%rbp
+  801881:	48 83 ec 28          	sub    $0x28,%rsp
+  801885:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801885 <strncpy+0x8>
+  80188c:	49 bb bb 77 00 00 00 	movabs $0x77bb,%r11
+  801893:	00 00 00 
+  801896:	4c 01 d8             	add    %r11,%rax
+  801899:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80189d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018a1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8018a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8018ad:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8018b4:	00 
+  8018b5:	eb 2a                	jmp    8018e1 <strncpy+0x64>
+		*dst++ = *src;
+  8018b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018bb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018bf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8018c3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018c7:	0f b6 12             	movzbl (%rdx),%edx
+  8018ca:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8018cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018d0:	0f b6 00             	movzbl (%rax),%eax
+  8018d3:	84 c0                	test   %al,%al
+  8018d5:	74 05                	je     8018dc <strncpy+0x5f>
+			src++;
+  8018d7:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8018dc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e5:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8018e9:	72 cc                	jb     8018b7 <strncpy+0x3a>
+	}
+	return ret;
+  8018eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8018ef:	c9                   	leave
+  8018f0:	c3                   	ret
+
+00000000008018f1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8018f1:	55                   	push   %rbp
+  8018f2:	48 89 e5             	mov    %rsp,%rbp
+  8018f5:	48 83 ec 28          	sub    $0x28,%rsp
+  8018f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018f9 <strlcpy+0x8>
+  801900:	49 bb 47 77 00 00 00 	movabs $0x7747,%r11
+  801907:	00 00 00 
+  80190a:	4c 01 d8             	add    %r11,%rax
+  80190d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801911:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801915:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801919:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80191d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801921:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801926:	74 3d                	je     801965 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801928:	eb 1d                	jmp    801947 <strlcpy+0x56>
+			*dst++ = *src++;
+  80192a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80192e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801932:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801936:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80193a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80193e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801942:	0f b6 12             	movzbl (%rdx),%edx
+  801945:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801947:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80194c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801951:	74 0b                	je     80195e <strlcpy+0x6d>
+  801953:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801957:	0f b6 00             	movzbl (%rax),%eax
+  80195a:	84 c0                	test   %al,%al
+  80195c:	75 cc                	jne    80192a <strlcpy+0x39>
+		*dst = '\0';
+  80195e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801962:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801965:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801969:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80196d:	c9                   	leave
+  80196e:	c3                   	ret
+
+000000000080196f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80196f:	55                   	push   %rbp
+  801970:	48 89 e5             	mov    %rsp,%rbp
+  801973:	48 83 ec 10          	sub    $0x10,%rsp
+  801977:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801977 <strcmp+0x8>
+  80197e:	49 bb c9 76 00 00 00 	movabs $0x76c9,%r11
+  801985:	00 00 00 
+  801988:	4c 01 d8             	add    %r11,%rax
+  80198b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80198f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801993:	eb 0a                	jmp    80199f <strcmp+0x30>
+		p++, q++;
+  801995:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80199a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80199f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a3:	0f b6 00             	movzbl (%rax),%eax
+  8019a6:	84 c0                	test   %al,%al
+  8019a8:	74 12                	je     8019bc <strcmp+0x4d>
+  8019aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019ae:	0f b6 10             	movzbl (%rax),%edx
+  8019b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019b5:	0f b6 00             	movzbl (%rax),%eax
+  8019b8:	38 c2                	cmp    %al,%dl
+  8019ba:	74 d9                	je     801995 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8019bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019c0:	0f b6 00             	movzbl (%rax),%eax
+  8019c3:	0f b6 d0             	movzbl %al,%edx
+  8019c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ca:	0f b6 00             	movzbl (%rax),%eax
+  8019cd:	0f b6 c0             	movzbl %al,%eax
+  8019d0:	29 c2                	sub    %eax,%edx
+  8019d2:	89 d0                	mov    %edx,%eax
+}
+  8019d4:	c9                   	leave
+  8019d5:	c3                   	ret
+
+00000000008019d6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8019d6:	55                   	push   %rbp
+  8019d7:	48 89 e5             	mov    %rsp,%rbp
+  8019da:	48 83 ec 18          	sub    $0x18,%rsp
+  8019de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019de <strncmp+0x8>
+  8019e5:	49 bb 62 76 00 00 00 	movabs $0x7662,%r11
+  8019ec:	00 00 00 
+  8019ef:	4c 01 d8             	add    %r11,%rax
+  8019f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8019fa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8019fe:	eb 0f                	jmp    801a0f <strncmp+0x39>
+		n--, p++, q++;
+  801a00:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801a05:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a0a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801a0f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a14:	74 1d                	je     801a33 <strncmp+0x5d>
+  801a16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a1a:	0f b6 00             	movzbl (%rax),%eax
+  801a1d:	84 c0                	test   %al,%al
+  801a1f:	74 12                	je     801a33 <strncmp+0x5d>
+  801a21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a25:	0f b6 10             	movzbl (%rax),%edx
+  801a28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a2c:	0f b6 00             	movzbl (%rax),%eax
+  801a2f:	38 c2                	cmp    %al,%dl
+  801a31:	74 cd                	je     801a00 <strncmp+0x2a>
+	if (n == 0)
+  801a33:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a38:	75 07                	jne    801a41 <strncmp+0x6b>
+		return 0;
+  801a3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3f:	eb 16                	jmp    801a57 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801a41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a45:	0f b6 00             	movzbl (%rax),%eax
+  801a48:	0f b6 d0             	movzbl %al,%edx
+  801a4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a4f:	0f b6 00             	movzbl (%rax),%eax
+  801a52:	0f b6 c0             	movzbl %al,%eax
+  801a55:	29 c2                	sub    %eax,%edx
+}
+  801a57:	89 d0                	mov    %edx,%eax
+  801a59:	c9                   	leave
+  801a5a:	c3                   	ret
+
+0000000000801a5b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801a5b:	55                   	push   %rbp
+  801a5c:	48 89 e5             	mov    %rsp,%rbp
+  801a5f:	48 83 ec 10          	sub    $0x10,%rsp
+  801a63:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a63 <strchr+0x8>
+  801a6a:	49 bb dd 75 00 00 00 	movabs $0x75dd,%r11
+  801a71:	00 00 00 
+  801a74:	4c 01 d8             	add    %r11,%rax
+  801a77:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a7b:	89 f0                	mov    %esi,%eax
+  801a7d:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801a80:	eb 17                	jmp    801a99 <strchr+0x3e>
+		if (*s == c)
+  801a82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a86:	0f b6 00             	movzbl (%rax),%eax
+  801a89:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801a8c:	75 06                	jne    801a94 <strchr+0x39>
+			return (char *) s;
+  801a8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a92:	eb 15                	jmp    801aa9 <strchr+0x4e>
+	for (; *s; s++)
+  801a94:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a9d:	0f b6 00             	movzbl (%rax),%eax
+  801aa0:	84 c0                	test   %al,%al
+  801aa2:	75 de                	jne    801a82 <strchr+0x27>
+	return 0;
+  801aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aa9:	c9                   	leave
+  801aaa:	c3                   	ret
+
+0000000000801aab <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801aab:	55                   	push   %rbp
+  801aac:	48 89 e5             	mov    %rsp,%rbp
+  801aaf:	48 83 ec 10          	sub    $0x10,%rsp
+  801ab3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ab3 <strfind+0x8>
+  801aba:	49 bb 8d 75 00 00 00 	movabs $0x758d,%r11
+  801ac1:	00 00 00 
+  801ac4:	4c 01 d8             	add    %r11,%rax
+  801ac7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801acb:	89 f0                	mov    %esi,%eax
+  801acd:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801ad0:	eb 11                	jmp    801ae3 <strfind+0x38>
+		if (*s == c)
+  801ad2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ad6:	0f b6 00             	movzbl (%rax),%eax
+  801ad9:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801adc:	74 12                	je     801af0 <strfind+0x45>
+	for (; *s; s++)
+  801ade:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ae3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae7:	0f b6 00             	movzbl (%rax),%eax
+  801aea:	84 c0                	test   %al,%al
+  801aec:	75 e4                	jne    801ad2 <strfind+0x27>
+  801aee:	eb 01                	jmp    801af1 <strfind+0x46>
+			break;
+  801af0:	90                   	nop
+	return (char *) s;
+  801af1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801af5:	c9                   	leave
+  801af6:	c3                   	ret
+
+0000000000801af7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801af7:	55                   	push   %rbp
+  801af8:	48 89 e5             	mov    %rsp,%rbp
+  801afb:	48 83 ec 18          	sub    $0x18,%rsp
+  801aff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801aff <memset+0x8>
+  801b06:	49 bb 41 75 00 00 00 	movabs $0x7541,%r11
+  801b0d:	00 00 00 
+  801b10:	4c 01 d8             	add    %r11,%rax
+  801b13:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b17:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801b1a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801b1e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b23:	75 06                	jne    801b2b <memset+0x34>
+		return v;
+  801b25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b29:	eb 69                	jmp    801b94 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801b2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b2f:	83 e0 03             	and    $0x3,%eax
+  801b32:	48 85 c0             	test   %rax,%rax
+  801b35:	75 48                	jne    801b7f <memset+0x88>
+  801b37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b3b:	83 e0 03             	and    $0x3,%eax
+  801b3e:	48 85 c0             	test   %rax,%rax
+  801b41:	75 3c                	jne    801b7f <memset+0x88>
+		c &= 0xFF;
+  801b43:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801b4a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801b4d:	c1 e0 18             	shl    $0x18,%eax
+  801b50:	89 c2                	mov    %eax,%edx
+  801b52:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801b55:	c1 e0 10             	shl    $0x10,%eax
+  801b58:	09 c2                	or     %eax,%edx
+  801b5a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801b5d:	c1 e0 08             	shl    $0x8,%eax
+  801b60:	09 d0                	or     %edx,%eax
+  801b62:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801b65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b69:	48 c1 e8 02          	shr    $0x2,%rax
+  801b6d:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801b70:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b74:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801b77:	48 89 d7             	mov    %rdx,%rdi
+  801b7a:	fc                   	cld
+  801b7b:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801b7d:	eb 11                	jmp    801b90 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801b7f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b83:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801b86:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801b8a:	48 89 d7             	mov    %rdx,%rdi
+  801b8d:	fc                   	cld
+  801b8e:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801b94:	c9                   	leave
+  801b95:	c3                   	ret
+
+0000000000801b96 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801b96:	55                   	push   %rbp
+  801b97:	48 89 e5             	mov    %rsp,%rbp
+  801b9a:	48 83 ec 28          	sub    $0x28,%rsp
+  801b9e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b9e <memmove+0x8>
+  801ba5:	49 bb a2 74 00 00 00 	movabs $0x74a2,%r11
+  801bac:	00 00 00 
+  801baf:	4c 01 d8             	add    %r11,%rax
+  801bb2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bb6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801bba:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801bbe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bc2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801bc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801bce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bd2:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801bd6:	0f 83 88 00 00 00    	jae    801c64 <memmove+0xce>
+  801bdc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801be0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be4:	48 01 d0             	add    %rdx,%rax
+  801be7:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801beb:	73 77                	jae    801c64 <memmove+0xce>
+		s += n;
+  801bed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bf1:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801bf5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bf9:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801bfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c01:	83 e0 03             	and    $0x3,%eax
+  801c04:	48 85 c0             	test   %rax,%rax
+  801c07:	75 3b                	jne    801c44 <memmove+0xae>
+  801c09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c0d:	83 e0 03             	and    $0x3,%eax
+  801c10:	48 85 c0             	test   %rax,%rax
+  801c13:	75 2f                	jne    801c44 <memmove+0xae>
+  801c15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c19:	83 e0 03             	and    $0x3,%eax
+  801c1c:	48 85 c0             	test   %rax,%rax
+  801c1f:	75 23                	jne    801c44 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801c21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c25:	48 83 e8 04          	sub    $0x4,%rax
+  801c29:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c2d:	48 83 ea 04          	sub    $0x4,%rdx
+  801c31:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801c35:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801c39:	48 89 c7             	mov    %rax,%rdi
+  801c3c:	48 89 d6             	mov    %rdx,%rsi
+  801c3f:	fd                   	std
+  801c40:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801c42:	eb 1d                	jmp    801c61 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801c44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c48:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c50:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801c54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c58:	48 89 d7             	mov    %rdx,%rdi
+  801c5b:	48 89 c1             	mov    %rax,%rcx
+  801c5e:	fd                   	std
+  801c5f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801c61:	fc                   	cld
+  801c62:	eb 57                	jmp    801cbb <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801c64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c68:	83 e0 03             	and    $0x3,%eax
+  801c6b:	48 85 c0             	test   %rax,%rax
+  801c6e:	75 36                	jne    801ca6 <memmove+0x110>
+  801c70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c74:	83 e0 03             	and    $0x3,%eax
+  801c77:	48 85 c0             	test   %rax,%rax
+  801c7a:	75 2a                	jne    801ca6 <memmove+0x110>
+  801c7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c80:	83 e0 03             	and    $0x3,%eax
+  801c83:	48 85 c0             	test   %rax,%rax
+  801c86:	75 1e                	jne    801ca6 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801c88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8c:	48 c1 e8 02          	shr    $0x2,%rax
+  801c90:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801c93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c97:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c9b:	48 89 c7             	mov    %rax,%rdi
+  801c9e:	48 89 d6             	mov    %rdx,%rsi
+  801ca1:	fc                   	cld
+  801ca2:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801ca4:	eb 15                	jmp    801cbb <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801ca6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801caa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cae:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801cb2:	48 89 c7             	mov    %rax,%rdi
+  801cb5:	48 89 d6             	mov    %rdx,%rsi
+  801cb8:	fc                   	cld
+  801cb9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801cbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801cbf:	c9                   	leave
+  801cc0:	c3                   	ret
+
+0000000000801cc1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801cc1:	55                   	push   %rbp
+  801cc2:	48 89 e5             	mov    %rsp,%rbp
+  801cc5:	48 83 ec 18          	sub    $0x18,%rsp
+  801cc9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801cc9 <memcpy+0x8>
+  801cd0:	49 bb 77 73 00 00 00 	movabs $0x7377,%r11
+  801cd7:	00 00 00 
+  801cda:	4c 01 d8             	add    %r11,%rax
+  801cdd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ce1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ce5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801ce9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ced:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801cf1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801cf5:	48 89 cf             	mov    %rcx,%rdi
+  801cf8:	48 b9 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rcx
+  801cff:	ff ff ff 
+  801d02:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801d06:	ff d0                	call   *%rax
+}
+  801d08:	c9                   	leave
+  801d09:	c3                   	ret
+
+0000000000801d0a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801d0a:	55                   	push   %rbp
+  801d0b:	48 89 e5             	mov    %rsp,%rbp
+  801d0e:	48 83 ec 28          	sub    $0x28,%rsp
+  801d12:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d12 <memcmp+0x8>
+  801d19:	49 bb 2e 73 00 00 00 	movabs $0x732e,%r11
+  801d20:	00 00 00 
+  801d23:	4c 01 d8             	add    %r11,%rax
+  801d26:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d2a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801d2e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801d32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d36:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801d3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d3e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801d42:	eb 34                	jmp    801d78 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801d44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d48:	0f b6 10             	movzbl (%rax),%edx
+  801d4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d4f:	0f b6 00             	movzbl (%rax),%eax
+  801d52:	38 c2                	cmp    %al,%dl
+  801d54:	74 18                	je     801d6e <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801d56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d5a:	0f b6 00             	movzbl (%rax),%eax
+  801d5d:	0f b6 d0             	movzbl %al,%edx
+  801d60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d64:	0f b6 00             	movzbl (%rax),%eax
+  801d67:	0f b6 c0             	movzbl %al,%eax
+  801d6a:	29 c2                	sub    %eax,%edx
+  801d6c:	eb 20                	jmp    801d8e <memcmp+0x84>
+		s1++, s2++;
+  801d6e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801d73:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801d78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d7c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d80:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801d84:	48 85 c0             	test   %rax,%rax
+  801d87:	75 bb                	jne    801d44 <memcmp+0x3a>
+	}
+
+	return 0;
+  801d89:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801d8e:	89 d0                	mov    %edx,%eax
+  801d90:	c9                   	leave
+  801d91:	c3                   	ret
+
+0000000000801d92 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801d92:	55                   	push   %rbp
+  801d93:	48 89 e5             	mov    %rsp,%rbp
+  801d96:	48 83 ec 28          	sub    $0x28,%rsp
+  801d9a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d9a <memfind+0x8>
+  801da1:	49 bb a6 72 00 00 00 	movabs $0x72a6,%r11
+  801da8:	00 00 00 
+  801dab:	4c 01 d8             	add    %r11,%rax
+  801dae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801db2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801db5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801db9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801dbd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dc1:	48 01 d0             	add    %rdx,%rax
+  801dc4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801dc8:	eb 13                	jmp    801ddd <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801dca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dce:	0f b6 00             	movzbl (%rax),%eax
+  801dd1:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801dd4:	38 d0                	cmp    %dl,%al
+  801dd6:	74 11                	je     801de9 <memfind+0x57>
+	for (; s < ends; s++)
+  801dd8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801ddd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801de1:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801de5:	72 e3                	jb     801dca <memfind+0x38>
+  801de7:	eb 01                	jmp    801dea <memfind+0x58>
+			break;
+  801de9:	90                   	nop
+	return (void *) s;
+  801dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801dee:	c9                   	leave
+  801def:	c3                   	ret
+
+0000000000801df0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801df0:	55                   	push   %rbp
+  801df1:	48 89 e5             	mov    %rsp,%rbp
+  801df4:	48 83 ec 38          	sub    $0x38,%rsp
+  801df8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801df8 <strtol+0x8>
+  801dff:	49 bb 48 72 00 00 00 	movabs $0x7248,%r11
+  801e06:	00 00 00 
+  801e09:	4c 01 d8             	add    %r11,%rax
+  801e0c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801e10:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801e14:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801e17:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801e1e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801e25:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801e26:	eb 05                	jmp    801e2d <strtol+0x3d>
+		s++;
+  801e28:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801e2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e31:	0f b6 00             	movzbl (%rax),%eax
+  801e34:	3c 20                	cmp    $0x20,%al
+  801e36:	74 f0                	je     801e28 <strtol+0x38>
+  801e38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e3c:	0f b6 00             	movzbl (%rax),%eax
+  801e3f:	3c 09                	cmp    $0x9,%al
+  801e41:	74 e5                	je     801e28 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801e43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e47:	0f b6 00             	movzbl (%rax),%eax
+  801e4a:	3c 2b                	cmp    $0x2b,%al
+  801e4c:	75 07                	jne    801e55 <strtol+0x65>
+		s++;
+  801e4e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e53:	eb 17                	jmp    801e6c <strtol+0x7c>
+	else if (*s == '-')
+  801e55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e59:	0f b6 00             	movzbl (%rax),%eax
+  801e5c:	3c 2d                	cmp    $0x2d,%al
+  801e5e:	75 0c                	jne    801e6c <strtol+0x7c>
+		s++, neg = 1;
+  801e60:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e65:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801e6c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801e70:	74 06                	je     801e78 <strtol+0x88>
+  801e72:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801e76:	75 28                	jne    801ea0 <strtol+0xb0>
+  801e78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e7c:	0f b6 00             	movzbl (%rax),%eax
+  801e7f:	3c 30                	cmp    $0x30,%al
+  801e81:	75 1d                	jne    801ea0 <strtol+0xb0>
+  801e83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e87:	48 83 c0 01          	add    $0x1,%rax
+  801e8b:	0f b6 00             	movzbl (%rax),%eax
+  801e8e:	3c 78                	cmp    $0x78,%al
+  801e90:	75 0e                	jne    801ea0 <strtol+0xb0>
+		s += 2, base = 16;
+  801e92:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801e97:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801e9e:	eb 2c                	jmp    801ecc <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801ea0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ea4:	75 19                	jne    801ebf <strtol+0xcf>
+  801ea6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eaa:	0f b6 00             	movzbl (%rax),%eax
+  801ead:	3c 30                	cmp    $0x30,%al
+  801eaf:	75 0e                	jne    801ebf <strtol+0xcf>
+		s++, base = 8;
+  801eb1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801eb6:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801ebd:	eb 0d                	jmp    801ecc <strtol+0xdc>
+	else if (base == 0)
+  801ebf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ec3:	75 07                	jne    801ecc <strtol+0xdc>
+		base = 10;
+  801ec5:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801ecc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ed0:	0f b6 00             	movzbl (%rax),%eax
+  801ed3:	3c 2f                	cmp    $0x2f,%al
+  801ed5:	7e 1d                	jle    801ef4 <strtol+0x104>
+  801ed7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801edb:	0f b6 00             	movzbl (%rax),%eax
+  801ede:	3c 39                	cmp    $0x39,%al
+  801ee0:	7f 12                	jg     801ef4 <strtol+0x104>
+			dig = *s - '0';
+  801ee2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ee6:	0f b6 00             	movzbl (%rax),%eax
+  801ee9:	0f be c0             	movsbl %al,%eax
+  801eec:	83 e8 30             	sub    $0x30,%eax
+  801eef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ef2:	eb 4e                	jmp    801f42 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801ef4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ef8:	0f b6 00             	movzbl (%rax),%eax
+  801efb:	3c 60                	cmp    $0x60,%al
+  801efd:	7e 1d                	jle    801f1c <strtol+0x12c>
+  801eff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f03:	0f b6 00             	movzbl (%rax),%eax
+  801f06:	3c 7a                	cmp    $0x7a,%al
+  801f08:	7f 12                	jg     801f1c <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801f0a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f0e:	0f b6 00             	movzbl (%rax),%eax
+  801f11:	0f be c0             	movsbl %al,%eax
+  801f14:	83 e8 57             	sub    $0x57,%eax
+  801f17:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801f1a:	eb 26                	jmp    801f42 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801f1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f20:	0f b6 00             	movzbl (%rax),%eax
+  801f23:	3c 40                	cmp    $0x40,%al
+  801f25:	7e 47                	jle    801f6e <strtol+0x17e>
+  801f27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f2b:	0f b6 00             	movzbl (%rax),%eax
+  801f2e:	3c 5a                	cmp    $0x5a,%al
+  801f30:	7f 3c                	jg     801f6e <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801f32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f36:	0f b6 00             	movzbl (%rax),%eax
+  801f39:	0f be c0             	movsbl %al,%eax
+  801f3c:	83 e8 37             	sub    $0x37,%eax
+  801f3f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801f42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f45:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801f48:	7d 23                	jge    801f6d <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801f4a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f4f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801f52:	48 98                	cltq
+  801f54:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801f59:	48 89 c2             	mov    %rax,%rdx
+  801f5c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f5f:	48 98                	cltq
+  801f61:	48 01 d0             	add    %rdx,%rax
+  801f64:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801f68:	e9 5f ff ff ff       	jmp    801ecc <strtol+0xdc>
+			break;
+  801f6d:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801f6e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801f73:	74 0b                	je     801f80 <strtol+0x190>
+		*endptr = (char *) s;
+  801f75:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f79:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801f7d:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801f80:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f84:	74 09                	je     801f8f <strtol+0x19f>
+  801f86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f8a:	48 f7 d8             	neg    %rax
+  801f8d:	eb 04                	jmp    801f93 <strtol+0x1a3>
+  801f8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801f93:	c9                   	leave
+  801f94:	c3                   	ret
+
+0000000000801f95 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801f95:	55                   	push   %rbp
+  801f96:	48 89 e5             	mov    %rsp,%rbp
+  801f99:	53                   	push   %rbx
+  801f9a:	48 83 ec 30          	sub    $0x30,%rsp
+  801f9e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801f9e <strstr+0x9>
+  801fa5:	49 bb a2 70 00 00 00 	movabs $0x70a2,%r11
+  801fac:	00 00 00 
+  801faf:	4c 01 db             	add    %r11,%rbx
+  801fb2:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801fb6:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801fba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fbe:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801fc2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801fc6:	0f b6 00             	movzbl (%rax),%eax
+  801fc9:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801fcc:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801fd0:	75 06                	jne    801fd8 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801fd2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fd6:	eb 73                	jmp    80204b <strstr+0xb6>
+
+	len = strlen(str);
+  801fd8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fdc:	48 89 c7             	mov    %rax,%rdi
+  801fdf:	48 b8 e2 86 ff ff ff 	movabs $0xffffffffffff86e2,%rax
+  801fe6:	ff ff ff 
+  801fe9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801fed:	ff d0                	call   *%rax
+  801fef:	48 98                	cltq
+  801ff1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801ff5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ff9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ffd:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  802001:	0f b6 00             	movzbl (%rax),%eax
+  802004:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  802007:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  80200b:	75 07                	jne    802014 <strstr+0x7f>
+				return (char *) 0;
+  80200d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802012:	eb 37                	jmp    80204b <strstr+0xb6>
+		} while (sc != c);
+  802014:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  802018:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  80201b:	75 d8                	jne    801ff5 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  80201d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802021:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802025:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802029:	48 89 ce             	mov    %rcx,%rsi
+  80202c:	48 89 c7             	mov    %rax,%rdi
+  80202f:	48 b8 96 89 ff ff ff 	movabs $0xffffffffffff8996,%rax
+  802036:	ff ff ff 
+  802039:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80203d:	ff d0                	call   *%rax
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	75 b2                	jne    801ff5 <strstr+0x60>
+
+	return (char *) (in - 1);
+  802043:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802047:	48 83 e8 01          	sub    $0x1,%rax
+}
+  80204b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80204f:	c9                   	leave
+  802050:	c3                   	ret
+
+0000000000802051 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  802051:	55                   	push   %rbp
+  802052:	48 89 e5             	mov    %rsp,%rbp
+  802055:	41 57                	push   %r15
+  802057:	53                   	push   %rbx
+  802058:	48 83 ec 40          	sub    $0x40,%rsp
+  80205c:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80205c <syscall+0xb>
+  802063:	49 bb e4 6f 00 00 00 	movabs $0x6fe4,%r11
+  80206a:	00 00 00 
+  80206d:	4d 01 da             	add    %r11,%r10
+  802070:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802073:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  802076:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80207a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80207e:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  802082:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  802086:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802089:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80208d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802091:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  802095:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802099:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80209d:	4c 89 c3             	mov    %r8,%rbx
+  8020a0:	cd 30                	int    $0x30
+  8020a2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  8020a6:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8020aa:	74 52                	je     8020fe <syscall+0xad>
+  8020ac:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8020b1:	7e 4b                	jle    8020fe <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020b3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8020ba:	49 89 d0             	mov    %rdx,%r8
+  8020bd:	89 c1                	mov    %eax,%ecx
+  8020bf:	48 b8 a0 e5 ff ff ff 	movabs $0xffffffffffffe5a0,%rax
+  8020c6:	ff ff ff 
+  8020c9:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8020cd:	48 89 c2             	mov    %rax,%rdx
+  8020d0:	be 23 00 00 00       	mov    $0x23,%esi
+  8020d5:	48 b8 bd e5 ff ff ff 	movabs $0xffffffffffffe5bd,%rax
+  8020dc:	ff ff ff 
+  8020df:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8020e3:	48 89 c7             	mov    %rax,%rdi
+  8020e6:	4d 89 d7             	mov    %r10,%r15
+  8020e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ee:	49 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%r9
+  8020f5:	ff ff ff 
+  8020f8:	4d 01 d1             	add    %r10,%r9
+  8020fb:	41 ff d1             	call   *%r9
+
+	return ret;
+  8020fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802102:	48 83 c4 40          	add    $0x40,%rsp
+  802106:	5b                   	pop    %rbx
+  802107:	41 5f                	pop    %r15
+  802109:	5d                   	pop    %rbp
+  80210a:	c3                   	ret
+
+000000000080210b <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  80210b:	55                   	push   %rbp
+  80210c:	48 89 e5             	mov    %rsp,%rbp
+  80210f:	41 57                	push   %r15
+  802111:	41 56                	push   %r14
+  802113:	41 55                	push   %r13
+  802115:	41 54                	push   %r12
+  802117:	53                   	push   %rbx
+  802118:	48 83 ec 48          	sub    $0x48,%rsp
+  80211c:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 80211c <syscall_words+0x11>
+  802123:	49 bb 24 6f 00 00 00 	movabs $0x6f24,%r11
+  80212a:	00 00 00 
+  80212d:	4d 01 de             	add    %r11,%r14
+  802130:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802133:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  802136:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  80213a:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80213e:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  802142:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  802146:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80214b:	74 09                	je     802156 <syscall_words+0x4b>
+  80214d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802151:	48 8b 00             	mov    (%rax),%rax
+  802154:	eb 05                	jmp    80215b <syscall_words+0x50>
+  802156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215b:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  80215e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802163:	74 0a                	je     80216f <syscall_words+0x64>
+  802165:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802169:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80216d:	eb 05                	jmp    802174 <syscall_words+0x69>
+  80216f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802174:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  802177:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80217c:	74 0a                	je     802188 <syscall_words+0x7d>
+  80217e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802182:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802186:	eb 05                	jmp    80218d <syscall_words+0x82>
+  802188:	b8 00 00 00 00       	mov    $0x0,%eax
+  80218d:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  802190:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802195:	74 0a                	je     8021a1 <syscall_words+0x96>
+  802197:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80219b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80219f:	eb 05                	jmp    8021a6 <syscall_words+0x9b>
+  8021a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a6:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  8021a9:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8021ae:	74 0a                	je     8021ba <syscall_words+0xaf>
+  8021b0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8021b4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8021b8:	eb 05                	jmp    8021bf <syscall_words+0xb4>
+  8021ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021bf:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  8021c2:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8021c7:	74 0a                	je     8021d3 <syscall_words+0xc8>
+  8021c9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8021cd:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8021d1:	eb 05                	jmp    8021d8 <syscall_words+0xcd>
+  8021d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d8:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  8021db:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8021de:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8021e2:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8021e6:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  8021ea:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8021ee:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8021f2:	cd 30                	int    $0x30
+  8021f4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  8021f8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8021fd:	74 50                	je     80224f <syscall_words+0x144>
+		words[0] = r8;
+  8021ff:	4c 89 c2             	mov    %r8,%rdx
+  802202:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802206:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802209:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80220d:	48 83 c0 08          	add    $0x8,%rax
+  802211:	4c 89 ca             	mov    %r9,%rdx
+  802214:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802217:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80221b:	48 83 c0 10          	add    $0x10,%rax
+  80221f:	4c 89 d2             	mov    %r10,%rdx
+  802222:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  802225:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802229:	48 83 c0 18          	add    $0x18,%rax
+  80222d:	4c 89 da             	mov    %r11,%rdx
+  802230:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  802233:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802237:	48 83 c0 20          	add    $0x20,%rax
+  80223b:	4c 89 e2             	mov    %r12,%rdx
+  80223e:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  802241:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802245:	48 83 c0 28          	add    $0x28,%rax
+  802249:	4c 89 ea             	mov    %r13,%rdx
+  80224c:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  80224f:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  802253:	74 52                	je     8022a7 <syscall_words+0x19c>
+  802255:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80225a:	7e 4b                	jle    8022a7 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80225c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802260:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802263:	49 89 d0             	mov    %rdx,%r8
+  802266:	89 c1                	mov    %eax,%ecx
+  802268:	48 b8 a0 e5 ff ff ff 	movabs $0xffffffffffffe5a0,%rax
+  80226f:	ff ff ff 
+  802272:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802276:	48 89 c2             	mov    %rax,%rdx
+  802279:	be 4e 00 00 00       	mov    $0x4e,%esi
+  80227e:	48 b8 bd e5 ff ff ff 	movabs $0xffffffffffffe5bd,%rax
+  802285:	ff ff ff 
+  802288:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80228c:	48 89 c7             	mov    %rax,%rdi
+  80228f:	4d 89 f7             	mov    %r14,%r15
+  802292:	b8 00 00 00 00       	mov    $0x0,%eax
+  802297:	49 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%r9
+  80229e:	ff ff ff 
+  8022a1:	4d 01 f1             	add    %r14,%r9
+  8022a4:	41 ff d1             	call   *%r9
+
+	return ret;
+  8022a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8022ab:	48 83 c4 48          	add    $0x48,%rsp
+  8022af:	5b                   	pop    %rbx
+  8022b0:	41 5c                	pop    %r12
+  8022b2:	41 5d                	pop    %r13
+  8022b4:	41 5e                	pop    %r14
+  8022b6:	41 5f                	pop    %r15
+  8022b8:	5d                   	pop    %rbp
+  8022b9:	c3                   	ret
+
+00000000008022ba <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8022ba:	55                   	push   %rbp
+  8022bb:	48 89 e5             	mov    %rsp,%rbp
+  8022be:	48 83 ec 10          	sub    $0x10,%rsp
+  8022c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022c2 <sys_cputs+0x8>
+  8022c9:	49 bb 7e 6d 00 00 00 	movabs $0x6d7e,%r11
+  8022d0:	00 00 00 
+  8022d3:	4c 01 d8             	add    %r11,%rax
+  8022d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8022de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8022e2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ea:	6a 00                	push   $0x0
+  8022ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8022fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802302:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802309:	ff ff ff 
+  80230c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802310:	ff d0                	call   *%rax
+  802312:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802316:	90                   	nop
+  802317:	c9                   	leave
+  802318:	c3                   	ret
+
+0000000000802319 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802319:	55                   	push   %rbp
+  80231a:	48 89 e5             	mov    %rsp,%rbp
+  80231d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80231d <sys_cgetc+0x4>
+  802324:	49 bb 23 6d 00 00 00 	movabs $0x6d23,%r11
+  80232b:	00 00 00 
+  80232e:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802331:	48 83 ec 08          	sub    $0x8,%rsp
+  802335:	6a 00                	push   $0x0
+  802337:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80233d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802343:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802348:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234d:	be 00 00 00 00       	mov    $0x0,%esi
+  802352:	bf 01 00 00 00       	mov    $0x1,%edi
+  802357:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  80235e:	ff ff ff 
+  802361:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802365:	ff d0                	call   *%rax
+  802367:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80236b:	c9                   	leave
+  80236c:	c3                   	ret
+
+000000000080236d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80236d:	55                   	push   %rbp
+  80236e:	48 89 e5             	mov    %rsp,%rbp
+  802371:	48 83 ec 10          	sub    $0x10,%rsp
+  802375:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802375 <sys_env_destroy+0x8>
+  80237c:	49 bb cb 6c 00 00 00 	movabs $0x6ccb,%r11
+  802383:	00 00 00 
+  802386:	4c 01 d8             	add    %r11,%rax
+  802389:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80238c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80238f:	48 63 d2             	movslq %edx,%rdx
+  802392:	48 83 ec 08          	sub    $0x8,%rsp
+  802396:	6a 00                	push   $0x0
+  802398:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80239e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ae:	bf 03 00 00 00       	mov    $0x3,%edi
+  8023b3:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  8023ba:	ff ff ff 
+  8023bd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023c1:	ff d0                	call   *%rax
+  8023c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023c7:	c9                   	leave
+  8023c8:	c3                   	ret
+
+00000000008023c9 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8023c9:	55                   	push   %rbp
+  8023ca:	48 89 e5             	mov    %rsp,%rbp
+  8023cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023cd <sys_getenvid+0x4>
+  8023d4:	49 bb 73 6c 00 00 00 	movabs $0x6c73,%r11
+  8023db:	00 00 00 
+  8023de:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8023e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e5:	6a 00                	push   $0x0
+  8023e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802402:	bf 02 00 00 00       	mov    $0x2,%edi
+  802407:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  80240e:	ff ff ff 
+  802411:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802415:	ff d0                	call   *%rax
+  802417:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80241b:	c9                   	leave
+  80241c:	c3                   	ret
+
+000000000080241d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80241d:	55                   	push   %rbp
+  80241e:	48 89 e5             	mov    %rsp,%rbp
+  802421:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802421 <sys_yield+0x4>
+  802428:	49 bb 1f 6c 00 00 00 	movabs $0x6c1f,%r11
+  80242f:	00 00 00 
+  802432:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802435:	48 83 ec 08          	sub    $0x8,%rsp
+  802439:	6a 00                	push   $0x0
+  80243b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802441:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802447:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80244c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802451:	be 00 00 00 00       	mov    $0x0,%esi
+  802456:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80245b:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802462:	ff ff ff 
+  802465:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802469:	ff d0                	call   *%rax
+  80246b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80246f:	90                   	nop
+  802470:	c9                   	leave
+  802471:	c3                   	ret
+
+0000000000802472 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802472:	55                   	push   %rbp
+  802473:	48 89 e5             	mov    %rsp,%rbp
+  802476:	48 83 ec 10          	sub    $0x10,%rsp
+  80247a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80247a <sys_page_alloc+0x8>
+  802481:	49 bb c6 6b 00 00 00 	movabs $0x6bc6,%r11
+  802488:	00 00 00 
+  80248b:	4c 01 d8             	add    %r11,%rax
+  80248e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802491:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802495:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802498:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80249b:	48 63 f2             	movslq %edx,%rsi
+  80249e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024a2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024a5:	48 63 d2             	movslq %edx,%rdx
+  8024a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ac:	6a 00                	push   $0x0
+  8024ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024b4:	49 89 f0             	mov    %rsi,%r8
+  8024b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8024bc:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024c1:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  8024c8:	ff ff ff 
+  8024cb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024cf:	ff d0                	call   *%rax
+  8024d1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d5:	c9                   	leave
+  8024d6:	c3                   	ret
+
+00000000008024d7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8024d7:	55                   	push   %rbp
+  8024d8:	48 89 e5             	mov    %rsp,%rbp
+  8024db:	48 83 ec 20          	sub    $0x20,%rsp
+  8024df:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024df <sys_page_map+0x8>
+  8024e6:	49 bb 61 6b 00 00 00 	movabs $0x6b61,%r11
+  8024ed:	00 00 00 
+  8024f0:	4c 01 d8             	add    %r11,%rax
+  8024f3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024fa:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8024fd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802501:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802505:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802508:	48 63 f2             	movslq %edx,%rsi
+  80250b:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80250f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802512:	48 63 fa             	movslq %edx,%rdi
+  802515:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802519:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80251c:	48 63 d2             	movslq %edx,%rdx
+  80251f:	48 83 ec 08          	sub    $0x8,%rsp
+  802523:	56                   	push   %rsi
+  802524:	4d 89 c1             	mov    %r8,%r9
+  802527:	49 89 f8             	mov    %rdi,%r8
+  80252a:	be 01 00 00 00       	mov    $0x1,%esi
+  80252f:	bf 05 00 00 00       	mov    $0x5,%edi
+  802534:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  80253b:	ff ff ff 
+  80253e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802542:	ff d0                	call   *%rax
+  802544:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802548:	c9                   	leave
+  802549:	c3                   	ret
+
+000000000080254a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80254a:	55                   	push   %rbp
+  80254b:	48 89 e5             	mov    %rsp,%rbp
+  80254e:	48 83 ec 10          	sub    $0x10,%rsp
+  802552:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802552 <sys_page_unmap+0x8>
+  802559:	49 bb ee 6a 00 00 00 	movabs $0x6aee,%r11
+  802560:	00 00 00 
+  802563:	4c 01 d8             	add    %r11,%rax
+  802566:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802569:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  80256d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802571:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802574:	48 63 d2             	movslq %edx,%rdx
+  802577:	48 83 ec 08          	sub    $0x8,%rsp
+  80257b:	6a 00                	push   $0x0
+  80257d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802583:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802589:	be 01 00 00 00       	mov    $0x1,%esi
+  80258e:	bf 06 00 00 00       	mov    $0x6,%edi
+  802593:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  80259a:	ff ff ff 
+  80259d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025a1:	ff d0                	call   *%rax
+  8025a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a7:	c9                   	leave
+  8025a8:	c3                   	ret
+
+00000000008025a9 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8025a9:	55                   	push   %rbp
+  8025aa:	48 89 e5             	mov    %rsp,%rbp
+  8025ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025b1 <sys_env_set_status+0x8>
+  8025b8:	49 bb 8f 6a 00 00 00 	movabs $0x6a8f,%r11
+  8025bf:	00 00 00 
+  8025c2:	4c 01 d8             	add    %r11,%rax
+  8025c5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025c8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8025cb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025ce:	48 63 ca             	movslq %edx,%rcx
+  8025d1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025d4:	48 63 d2             	movslq %edx,%rdx
+  8025d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8025db:	6a 00                	push   $0x0
+  8025dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025e9:	be 01 00 00 00       	mov    $0x1,%esi
+  8025ee:	bf 08 00 00 00       	mov    $0x8,%edi
+  8025f3:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  8025fa:	ff ff ff 
+  8025fd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802601:	ff d0                	call   *%rax
+  802603:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802607:	c9                   	leave
+  802608:	c3                   	ret
+
+0000000000802609 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802609:	55                   	push   %rbp
+  80260a:	48 89 e5             	mov    %rsp,%rbp
+  80260d:	48 83 ec 10          	sub    $0x10,%rsp
+  802611:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802611 <sys_env_set_trapframe+0x8>
+  802618:	49 bb 2f 6a 00 00 00 	movabs $0x6a2f,%r11
+  80261f:	00 00 00 
+  802622:	4c 01 d8             	add    %r11,%rax
+  802625:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802628:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80262c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802630:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802633:	48 63 d2             	movslq %edx,%rdx
+  802636:	48 83 ec 08          	sub    $0x8,%rsp
+  80263a:	6a 00                	push   $0x0
+  80263c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802642:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802648:	be 01 00 00 00       	mov    $0x1,%esi
+  80264d:	bf 09 00 00 00       	mov    $0x9,%edi
+  802652:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802659:	ff ff ff 
+  80265c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802660:	ff d0                	call   *%rax
+  802662:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802666:	c9                   	leave
+  802667:	c3                   	ret
+
+0000000000802668 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802668:	55                   	push   %rbp
+  802669:	48 89 e5             	mov    %rsp,%rbp
+  80266c:	48 83 ec 10          	sub    $0x10,%rsp
+  802670:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802670 <sys_env_set_pgfault_upcall+0x8>
+  802677:	49 bb d0 69 00 00 00 	movabs $0x69d0,%r11
+  80267e:	00 00 00 
+  802681:	4c 01 d8             	add    %r11,%rax
+  802684:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802687:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80268b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80268f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802692:	48 63 d2             	movslq %edx,%rdx
+  802695:	48 83 ec 08          	sub    $0x8,%rsp
+  802699:	6a 00                	push   $0x0
+  80269b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8026ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8026b1:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  8026b8:	ff ff ff 
+  8026bb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026bf:	ff d0                	call   *%rax
+  8026c1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026c5:	c9                   	leave
+  8026c6:	c3                   	ret
+
+00000000008026c7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8026c7:	55                   	push   %rbp
+  8026c8:	48 89 e5             	mov    %rsp,%rbp
+  8026cb:	48 83 ec 20          	sub    $0x20,%rsp
+  8026cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026cf <sys_ipc_try_send+0x8>
+  8026d6:	49 bb 71 69 00 00 00 	movabs $0x6971,%r11
+  8026dd:	00 00 00 
+  8026e0:	4c 01 d8             	add    %r11,%rax
+  8026e3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026ea:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026ee:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8026f1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026f4:	48 63 fa             	movslq %edx,%rdi
+  8026f7:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8026fb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026fe:	48 63 d2             	movslq %edx,%rdx
+  802701:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802705:	48 83 ec 08          	sub    $0x8,%rsp
+  802709:	6a 00                	push   $0x0
+  80270b:	49 89 f9             	mov    %rdi,%r9
+  80270e:	49 89 f0             	mov    %rsi,%r8
+  802711:	be 00 00 00 00       	mov    $0x0,%esi
+  802716:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80271b:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802722:	ff ff ff 
+  802725:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802729:	ff d0                	call   *%rax
+  80272b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80272f:	c9                   	leave
+  802730:	c3                   	ret
+
+0000000000802731 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802731:	55                   	push   %rbp
+  802732:	48 89 e5             	mov    %rsp,%rbp
+  802735:	48 83 ec 20          	sub    $0x20,%rsp
+  802739:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802739 <sys_ipc_send+0x8>
+  802740:	49 bb 07 69 00 00 00 	movabs $0x6907,%r11
+  802747:	00 00 00 
+  80274a:	4c 01 d8             	add    %r11,%rax
+  80274d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802750:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802754:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802758:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80275b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80275e:	48 63 fa             	movslq %edx,%rdi
+  802761:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802765:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802768:	48 63 d2             	movslq %edx,%rdx
+  80276b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80276f:	48 83 ec 08          	sub    $0x8,%rsp
+  802773:	6a 00                	push   $0x0
+  802775:	49 89 f9             	mov    %rdi,%r9
+  802778:	49 89 f0             	mov    %rsi,%r8
+  80277b:	be 00 00 00 00       	mov    $0x0,%esi
+  802780:	bf 17 00 00 00       	mov    $0x17,%edi
+  802785:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  80278c:	ff ff ff 
+  80278f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802793:	ff d0                	call   *%rax
+  802795:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802799:	c9                   	leave
+  80279a:	c3                   	ret
+
+000000000080279b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80279b:	55                   	push   %rbp
+  80279c:	48 89 e5             	mov    %rsp,%rbp
+  80279f:	48 83 ec 10          	sub    $0x10,%rsp
+  8027a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027a3 <sys_ipc_recv+0x8>
+  8027aa:	49 bb 9d 68 00 00 00 	movabs $0x689d,%r11
+  8027b1:	00 00 00 
+  8027b4:	4c 01 d8             	add    %r11,%rax
+  8027b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8027bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027bf:	6a 00                	push   $0x0
+  8027c1:	6a 00                	push   $0x0
+  8027c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027d4:	be 01 00 00 00       	mov    $0x1,%esi
+  8027d9:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8027de:	49 ba cb 90 ff ff ff 	movabs $0xffffffffffff90cb,%r10
+  8027e5:	ff ff ff 
+  8027e8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027ec:	ff d0                	call   *%rax
+  8027ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027f2:	c9                   	leave
+  8027f3:	c3                   	ret
+
+00000000008027f4 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8027f4:	55                   	push   %rbp
+  8027f5:	48 89 e5             	mov    %rsp,%rbp
+  8027f8:	48 83 ec 30          	sub    $0x30,%rsp
+  8027fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027fc <sys_ipc_call+0x8>
+  802803:	49 bb 44 68 00 00 00 	movabs $0x6844,%r11
+  80280a:	00 00 00 
+  80280d:	4c 01 d8             	add    %r11,%rax
+  802810:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802813:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802817:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80281b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80281e:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802822:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802826:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80282a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80282d:	4c 63 c2             	movslq %edx,%r8
+  802830:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802834:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802837:	48 63 d2             	movslq %edx,%rdx
+  80283a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80283e:	ff 75 d8             	push   -0x28(%rbp)
+  802841:	56                   	push   %rsi
+  802842:	4d 89 c1             	mov    %r8,%r9
+  802845:	49 89 f8             	mov    %rdi,%r8
+  802848:	be 00 00 00 00       	mov    $0x0,%esi
+  80284d:	bf 18 00 00 00       	mov    $0x18,%edi
+  802852:	49 ba cb 90 ff ff ff 	movabs $0xffffffffffff90cb,%r10
+  802859:	ff ff ff 
+  80285c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802860:	ff d0                	call   *%rax
+  802862:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802866:	c9                   	leave
+  802867:	c3                   	ret
+
+0000000000802868 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802868:	55                   	push   %rbp
+  802869:	48 89 e5             	mov    %rsp,%rbp
+  80286c:	48 83 ec 30          	sub    $0x30,%rsp
+  802870:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802870 <sys_ipc_reply_recv+0x8>
+  802877:	49 bb d0 67 00 00 00 	movabs $0x67d0,%r11
+  80287e:	00 00 00 
+  802881:	4c 01 d8             	add    %r11,%rax
+  802884:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802887:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80288b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80288f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802892:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802896:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80289a:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80289e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8028a1:	4c 63 c2             	movslq %edx,%r8
+  8028a4:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8028a8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8028ab:	48 63 d2             	movslq %edx,%rdx
+  8028ae:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028b2:	ff 75 d8             	push   -0x28(%rbp)
+  8028b5:	56                   	push   %rsi
+  8028b6:	4d 89 c1             	mov    %r8,%r9
+  8028b9:	49 89 f8             	mov    %rdi,%r8
+  8028bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c1:	bf 19 00 00 00       	mov    $0x19,%edi
+  8028c6:	49 ba cb 90 ff ff ff 	movabs $0xffffffffffff90cb,%r10
+  8028cd:	ff ff ff 
+  8028d0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028d4:	ff d0                	call   *%rax
+  8028d6:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8028da:	c9                   	leave
+  8028db:	c3                   	ret
+
+00000000008028dc <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8028dc:	55                   	push   %rbp
+  8028dd:	48 89 e5             	mov    %rsp,%rbp
+  8028e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8028e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028e4 <sys_env_set_priority+0x8>
+  8028eb:	49 bb 5c 67 00 00 00 	movabs $0x675c,%r11
+  8028f2:	00 00 00 
+  8028f5:	4c 01 d8             	add    %r11,%rax
+  8028f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028fb:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8028fe:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802901:	48 63 ca             	movslq %edx,%rcx
+  802904:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802907:	48 63 d2             	movslq %edx,%rdx
+  80290a:	48 83 ec 08          	sub    $0x8,%rsp
+  80290e:	6a 00                	push   $0x0
+  802910:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802916:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80291c:	be 01 00 00 00       	mov    $0x1,%esi
+  802921:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802926:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  80292d:	ff ff ff 
+  802930:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802934:	ff d0                	call   *%rax
+  802936:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80293a:	c9                   	leave
+  80293b:	c3                   	ret
+
+000000000080293c <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80293c:	55                   	push   %rbp
+  80293d:	48 89 e5             	mov    %rsp,%rbp
+  802940:	48 83 ec 10          	sub    $0x10,%rsp
+  802944:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802944 <sys_env_set_affinity+0x8>
+  80294b:	49 bb fc 66 00 00 00 	movabs $0x66fc,%r11
+  802952:	00 00 00 
+  802955:	4c 01 d8             	add    %r11,%rax
+  802958:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80295b:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  80295e:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802961:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802964:	48 63 d2             	movslq %edx,%rdx
+  802967:	48 83 ec 08          	sub    $0x8,%rsp
+  80296b:	6a 00                	push   $0x0
+  80296d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802973:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802979:	be 01 00 00 00       	mov    $0x1,%esi
+  80297e:	bf 10 00 00 00       	mov    $0x10,%edi
+  802983:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  80298a:	ff ff ff 
+  80298d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802991:	ff d0                	call   *%rax
+  802993:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802997:	c9                   	leave
+  802998:	c3                   	ret
+
+0000000000802999 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802999:	55                   	push   %rbp
+  80299a:	48 89 e5             	mov    %rsp,%rbp
+  80299d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80299d <sys_time_msec+0x4>
+  8029a4:	49 bb a3 66 00 00 00 	movabs $0x66a3,%r11
+  8029ab:	00 00 00 
+  8029ae:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8029b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b5:	6a 00                	push   $0x0
+  8029b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d2:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8029d7:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  8029de:	ff ff ff 
+  8029e1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029e5:	ff d0                	call   *%rax
+  8029e7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029eb:	c9                   	leave
+  8029ec:	c3                   	ret
+
+00000000008029ed <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8029ed:	55                   	push   %rbp
+  8029ee:	48 89 e5             	mov    %rsp,%rbp
+  8029f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8029f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029f5 <sys_sleep_usec+0x8>
+  8029fc:	49 bb 4b 66 00 00 00 	movabs $0x664b,%r11
+  802a03:	00 00 00 
+  802a06:	4c 01 d8             	add    %r11,%rax
+  802a09:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802a0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a11:	48 83 ec 08          	sub    $0x8,%rsp
+  802a15:	6a 00                	push   $0x0
+  802a17:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a28:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2d:	bf 11 00 00 00       	mov    $0x11,%edi
+  802a32:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802a39:	ff ff ff 
+  802a3c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a40:	ff d0                	call   *%rax
+  802a42:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a46:	c9                   	leave
+  802a47:	c3                   	ret
+
+0000000000802a48 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802a48:	55                   	push   %rbp
+  802a49:	48 89 e5             	mov    %rsp,%rbp
+  802a4c:	48 83 ec 10          	sub    $0x10,%rsp
+  802a50:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a50 <sys_page_alloc_huge+0x8>
+  802a57:	49 bb f0 65 00 00 00 	movabs $0x65f0,%r11
+  802a5e:	00 00 00 
+  802a61:	4c 01 d8             	add    %r11,%rax
+  802a64:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a67:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a6b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802a6e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802a71:	48 63 f2             	movslq %edx,%rsi
+  802a74:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a78:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802a7b:	48 63 d2             	movslq %edx,%rdx
+  802a7e:	48 83 ec 08          	sub    $0x8,%rsp
+  802a82:	6a 00                	push   $0x0
+  802a84:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a8a:	49 89 f0             	mov    %rsi,%r8
+  802a8d:	be 01 00 00 00       	mov    $0x1,%esi
+  802a92:	bf 12 00 00 00       	mov    $0x12,%edi
+  802a97:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802a9e:	ff ff ff 
+  802aa1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802aa5:	ff d0                	call   *%rax
+  802aa7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+
+0000000000802aad <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802aad:	55                   	push   %rbp
+  802aae:	48 89 e5             	mov    %rsp,%rbp
+  802ab1:	48 83 ec 10          	sub    $0x10,%rsp
+  802ab5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ab5 <sys_page_map_batch+0x8>
+  802abc:	49 bb 8b 65 00 00 00 	movabs $0x658b,%r11
+  802ac3:	00 00 00 
+  802ac6:	4c 01 d8             	add    %r11,%rax
+  802ac9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802acd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802ad1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ad5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802ad9:	48 83 ec 08          	sub    $0x8,%rsp
+  802add:	6a 00                	push   $0x0
+  802adf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ae5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aeb:	be 01 00 00 00       	mov    $0x1,%esi
+  802af0:	bf 13 00 00 00       	mov    $0x13,%edi
+  802af5:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802afc:	ff ff ff 
+  802aff:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b03:	ff d0                	call   *%rax
+  802b05:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b09:	c9                   	leave
+  802b0a:	c3                   	ret
+
+0000000000802b0b <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802b0b:	55                   	push   %rbp
+  802b0c:	48 89 e5             	mov    %rsp,%rbp
+  802b0f:	48 83 ec 10          	sub    $0x10,%rsp
+  802b13:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b13 <sys_page_alloc_batch+0x8>
+  802b1a:	49 bb 2d 65 00 00 00 	movabs $0x652d,%r11
+  802b21:	00 00 00 
+  802b24:	4c 01 d8             	add    %r11,%rax
+  802b27:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b2b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802b2f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b33:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802b37:	48 83 ec 08          	sub    $0x8,%rsp
+  802b3b:	6a 00                	push   $0x0
+  802b3d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b49:	be 01 00 00 00       	mov    $0x1,%esi
+  802b4e:	bf 14 00 00 00       	mov    $0x14,%edi
+  802b53:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802b5a:	ff ff ff 
+  802b5d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b61:	ff d0                	call   *%rax
+  802b63:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b67:	c9                   	leave
+  802b68:	c3                   	ret
+
+0000000000802b69 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802b69:	55                   	push   %rbp
+  802b6a:	48 89 e5             	mov    %rsp,%rbp
+  802b6d:	48 83 ec 10          	sub    $0x10,%rsp
+  802b71:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b71 <sys_page_unmap_batch+0x8>
+  802b78:	49 bb cf 64 00 00 00 	movabs $0x64cf,%r11
+  802b7f:	00 00 00 
+  802b82:	4c 01 d8             	add    %r11,%rax
+  802b85:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b89:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802b8d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802b91:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802b95:	48 83 ec 08          	sub    $0x8,%rsp
+  802b99:	6a 00                	push   $0x0
+  802b9b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ba1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ba7:	be 01 00 00 00       	mov    $0x1,%esi
+  802bac:	bf 15 00 00 00       	mov    $0x15,%edi
+  802bb1:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802bb8:	ff ff ff 
+  802bbb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802bbf:	ff d0                	call   *%rax
+  802bc1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bc5:	c9                   	leave
+  802bc6:	c3                   	ret
+
+0000000000802bc7 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802bc7:	55                   	push   %rbp
+  802bc8:	48 89 e5             	mov    %rsp,%rbp
+  802bcb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802bcb <sys_fork+0x4>
+  802bd2:	49 bb 75 64 00 00 00 	movabs $0x6475,%r11
+  802bd9:	00 00 00 
+  802bdc:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802bdf:	48 83 ec 08          	sub    $0x8,%rsp
+  802be3:	6a 00                	push   $0x0
+  802be5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802beb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802bf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bfb:	be 00 00 00 00       	mov    $0x0,%esi
+  802c00:	bf 16 00 00 00       	mov    $0x16,%edi
+  802c05:	49 ba 11 90 ff ff ff 	movabs $0xffffffffffff9011,%r10
+  802c0c:	ff ff ff 
+  802c0f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802c13:	ff d0                	call   *%rax
+  802c15:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c19:	c9                   	leave
+  802c1a:	c3                   	ret
+
+0000000000802c1b <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802c1b:	55                   	push   %rbp
+  802c1c:	48 89 e5             	mov    %rsp,%rbp
+  802c1f:	41 57                	push   %r15
+  802c21:	53                   	push   %rbx
+  802c22:	48 83 ec 40          	sub    $0x40,%rsp
+  802c26:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c26 <pgfault+0xb>
+  802c2d:	49 bb 1a 64 00 00 00 	movabs $0x641a,%r11
+  802c34:	00 00 00 
+  802c37:	4c 01 db             	add    %r11,%rbx
+  802c3a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802c3e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c42:	48 8b 00             	mov    (%rax),%rax
+  802c45:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802c49:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802c4d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802c51:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802c54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c58:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802c5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c60:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c66:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802c6a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c6d:	83 e0 02             	and    $0x2,%eax
+  802c70:	85 c0                	test   %eax,%eax
+  802c72:	0f 84 91 03 00 00    	je     803009 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802c78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c7c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c80:	48 89 c2             	mov    %rax,%rdx
+  802c83:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802c8a:	ff ff ff 
+  802c8d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c91:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c95:	83 e0 01             	and    $0x1,%eax
+  802c98:	48 85 c0             	test   %rax,%rax
+  802c9b:	0f 84 a7 01 00 00    	je     802e48 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802ca1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ca5:	48 c1 e8 15          	shr    $0x15,%rax
+  802ca9:	48 89 c2             	mov    %rax,%rdx
+  802cac:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802cb3:	ff ff ff 
+  802cb6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cba:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cbe:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802cc3:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802cc9:	0f 85 79 01 00 00    	jne    802e48 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802ccf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cd3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802cd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cdb:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802ce1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802ce5:	ba 07 00 00 00       	mov    $0x7,%edx
+  802cea:	be 00 00 60 00       	mov    $0x600000,%esi
+  802cef:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf4:	49 89 df             	mov    %rbx,%r15
+  802cf7:	48 b8 08 9a ff ff ff 	movabs $0xffffffffffff9a08,%rax
+  802cfe:	ff ff ff 
+  802d01:	48 01 d8             	add    %rbx,%rax
+  802d04:	ff d0                	call   *%rax
+  802d06:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802d09:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802d0d:	79 44                	jns    802d53 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802d0f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802d12:	89 c1                	mov    %eax,%ecx
+  802d14:	48 b8 d0 e5 ff ff ff 	movabs $0xffffffffffffe5d0,%rax
+  802d1b:	ff ff ff 
+  802d1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d22:	48 89 c2             	mov    %rax,%rdx
+  802d25:	be 20 00 00 00       	mov    $0x20,%esi
+  802d2a:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  802d31:	ff ff ff 
+  802d34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d38:	48 89 c7             	mov    %rax,%rdi
+  802d3b:	49 89 df             	mov    %rbx,%r15
+  802d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d43:	49 b8 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%r8
+  802d4a:	ff ff ff 
+  802d4d:	49 01 d8             	add    %rbx,%r8
+  802d50:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802d53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d57:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802d5c:	48 89 c6             	mov    %rax,%rsi
+  802d5f:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802d64:	49 89 df             	mov    %rbx,%r15
+  802d67:	48 b8 81 8c ff ff ff 	movabs $0xffffffffffff8c81,%rax
+  802d6e:	ff ff ff 
+  802d71:	48 01 d8             	add    %rbx,%rax
+  802d74:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802d76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d7a:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802d80:	48 89 c1             	mov    %rax,%rcx
+  802d83:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d88:	be 00 00 60 00       	mov    $0x600000,%esi
+  802d8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d92:	49 89 df             	mov    %rbx,%r15
+  802d95:	48 b8 97 94 ff ff ff 	movabs $0xffffffffffff9497,%rax
+  802d9c:	ff ff ff 
+  802d9f:	48 01 d8             	add    %rbx,%rax
+  802da2:	ff d0                	call   *%rax
+  802da4:	85 c0                	test   %eax,%eax
+  802da6:	74 3e                	je     802de6 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802da8:	48 b8 fb e5 ff ff ff 	movabs $0xffffffffffffe5fb,%rax
+  802daf:	ff ff ff 
+  802db2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802db6:	48 89 c2             	mov    %rax,%rdx
+  802db9:	be 23 00 00 00       	mov    $0x23,%esi
+  802dbe:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  802dc5:	ff ff ff 
+  802dc8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dcc:	48 89 c7             	mov    %rax,%rdi
+  802dcf:	49 89 df             	mov    %rbx,%r15
+  802dd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd7:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  802dde:	ff ff ff 
+  802de1:	48 01 d9             	add    %rbx,%rcx
+  802de4:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802de6:	be 00 00 60 00       	mov    $0x600000,%esi
+  802deb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802df0:	49 89 df             	mov    %rbx,%r15
+  802df3:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  802dfa:	ff ff ff 
+  802dfd:	48 01 d8             	add    %rbx,%rax
+  802e00:	ff d0                	call   *%rax
+  802e02:	85 c0                	test   %eax,%eax
+  802e04:	0f 84 3d 02 00 00    	je     803047 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802e0a:	48 b8 10 e6 ff ff ff 	movabs $0xffffffffffffe610,%rax
+  802e11:	ff ff ff 
+  802e14:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e18:	48 89 c2             	mov    %rax,%rdx
+  802e1b:	be 25 00 00 00       	mov    $0x25,%esi
+  802e20:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  802e27:	ff ff ff 
+  802e2a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e2e:	48 89 c7             	mov    %rax,%rdi
+  802e31:	49 89 df             	mov    %rbx,%r15
+  802e34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e39:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  802e40:	ff ff ff 
+  802e43:	48 01 d9             	add    %rbx,%rcx
+  802e46:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802e48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e4c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e50:	48 89 c2             	mov    %rax,%rdx
+  802e53:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802e5a:	ff ff ff 
+  802e5d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e61:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e65:	25 00 08 00 00       	and    $0x800,%eax
+  802e6a:	48 85 c0             	test   %rax,%rax
+  802e6d:	0f 84 58 01 00 00    	je     802fcb <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802e73:	ba 07 00 00 00       	mov    $0x7,%edx
+  802e78:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802e7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e82:	49 89 df             	mov    %rbx,%r15
+  802e85:	48 b8 32 94 ff ff ff 	movabs $0xffffffffffff9432,%rax
+  802e8c:	ff ff ff 
+  802e8f:	48 01 d8             	add    %rbx,%rax
+  802e92:	ff d0                	call   *%rax
+  802e94:	85 c0                	test   %eax,%eax
+  802e96:	74 3e                	je     802ed6 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802e98:	48 b8 27 e6 ff ff ff 	movabs $0xffffffffffffe627,%rax
+  802e9f:	ff ff ff 
+  802ea2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ea6:	48 89 c2             	mov    %rax,%rdx
+  802ea9:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802eae:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  802eb5:	ff ff ff 
+  802eb8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ebc:	48 89 c7             	mov    %rax,%rdi
+  802ebf:	49 89 df             	mov    %rbx,%r15
+  802ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec7:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  802ece:	ff ff ff 
+  802ed1:	48 01 d9             	add    %rbx,%rcx
+  802ed4:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802ed6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802eda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802edf:	48 89 c6             	mov    %rax,%rsi
+  802ee2:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802ee7:	49 89 df             	mov    %rbx,%r15
+  802eea:	48 b8 81 8c ff ff ff 	movabs $0xffffffffffff8c81,%rax
+  802ef1:	ff ff ff 
+  802ef4:	48 01 d8             	add    %rbx,%rax
+  802ef7:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802ef9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802efd:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802f03:	48 89 c1             	mov    %rax,%rcx
+  802f06:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f0b:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802f10:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f15:	49 89 df             	mov    %rbx,%r15
+  802f18:	48 b8 97 94 ff ff ff 	movabs $0xffffffffffff9497,%rax
+  802f1f:	ff ff ff 
+  802f22:	48 01 d8             	add    %rbx,%rax
+  802f25:	ff d0                	call   *%rax
+  802f27:	85 c0                	test   %eax,%eax
+  802f29:	74 3e                	je     802f69 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802f2b:	48 b8 fb e5 ff ff ff 	movabs $0xffffffffffffe5fb,%rax
+  802f32:	ff ff ff 
+  802f35:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f39:	48 89 c2             	mov    %rax,%rdx
+  802f3c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f41:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  802f48:	ff ff ff 
+  802f4b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f4f:	48 89 c7             	mov    %rax,%rdi
+  802f52:	49 89 df             	mov    %rbx,%r15
+  802f55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f5a:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  802f61:	ff ff ff 
+  802f64:	48 01 d9             	add    %rbx,%rcx
+  802f67:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802f69:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802f6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f73:	49 89 df             	mov    %rbx,%r15
+  802f76:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  802f7d:	ff ff ff 
+  802f80:	48 01 d8             	add    %rbx,%rax
+  802f83:	ff d0                	call   *%rax
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	0f 84 bb 00 00 00    	je     803048 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802f8d:	48 b8 10 e6 ff ff ff 	movabs $0xffffffffffffe610,%rax
+  802f94:	ff ff ff 
+  802f97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f9b:	48 89 c2             	mov    %rax,%rdx
+  802f9e:	be 32 00 00 00       	mov    $0x32,%esi
+  802fa3:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  802faa:	ff ff ff 
+  802fad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fb1:	48 89 c7             	mov    %rax,%rdi
+  802fb4:	49 89 df             	mov    %rbx,%r15
+  802fb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fbc:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  802fc3:	ff ff ff 
+  802fc6:	48 01 d9             	add    %rbx,%rcx
+  802fc9:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802fcb:	48 b8 40 e6 ff ff ff 	movabs $0xffffffffffffe640,%rax
+  802fd2:	ff ff ff 
+  802fd5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fd9:	48 89 c2             	mov    %rax,%rdx
+  802fdc:	be 36 00 00 00       	mov    $0x36,%esi
+  802fe1:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  802fe8:	ff ff ff 
+  802feb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fef:	48 89 c7             	mov    %rax,%rdi
+  802ff2:	49 89 df             	mov    %rbx,%r15
+  802ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffa:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  803001:	ff ff ff 
+  803004:	48 01 d9             	add    %rbx,%rcx
+  803007:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  803009:	48 b8 5f e6 ff ff ff 	movabs $0xffffffffffffe65f,%rax
+  803010:	ff ff ff 
+  803013:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803017:	48 89 c2             	mov    %rax,%rdx
+  80301a:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80301f:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  803026:	ff ff ff 
+  803029:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80302d:	48 89 c7             	mov    %rax,%rdi
+  803030:	49 89 df             	mov    %rbx,%r15
+  803033:	b8 00 00 00 00       	mov    $0x0,%eax
+  803038:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  80303f:	ff ff ff 
+  803042:	48 01 d9             	add    %rbx,%rcx
+  803045:	ff d1                	call   *%rcx
+			return;
+  803047:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  803048:	48 83 c4 40          	add    $0x40,%rsp
+  80304c:	5b                   	pop    %rbx
+  80304d:	41 5f                	pop    %r15
+  80304f:	5d                   	pop    %rbp
+  803050:	c3                   	ret
+
+0000000000803051 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  803051:	55                   	push   %rbp
+  803052:	48 89 e5             	mov    %rsp,%rbp
+  803055:	41 57                	push   %r15
+  803057:	53                   	push   %rbx
+  803058:	48 83 ec 10          	sub    $0x10,%rsp
+  80305c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80305c <fork_flush+0xb>
+  803063:	49 bb e4 5f 00 00 00 	movabs $0x5fe4,%r11
+  80306a:	00 00 00 
+  80306d:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  803070:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803077:	00 00 00 
+  80307a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80307e:	48 85 c0             	test   %rax,%rax
+  803081:	0f 84 81 00 00 00    	je     803108 <fork_flush+0xb7>
+  803087:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80308e:	00 00 00 
+  803091:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803095:	48 89 c6             	mov    %rax,%rsi
+  803098:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  80309f:	00 00 00 
+  8030a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030a6:	48 89 c7             	mov    %rax,%rdi
+  8030a9:	49 89 df             	mov    %rbx,%r15
+  8030ac:	48 b8 6d 9a ff ff ff 	movabs $0xffffffffffff9a6d,%rax
+  8030b3:	ff ff ff 
+  8030b6:	48 01 d8             	add    %rbx,%rax
+  8030b9:	ff d0                	call   *%rax
+  8030bb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8030c2:	79 44                	jns    803108 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  8030c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030c7:	89 c1                	mov    %eax,%ecx
+  8030c9:	48 b8 78 e6 ff ff ff 	movabs $0xffffffffffffe678,%rax
+  8030d0:	ff ff ff 
+  8030d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030d7:	48 89 c2             	mov    %rax,%rdx
+  8030da:	be 56 00 00 00       	mov    $0x56,%esi
+  8030df:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  8030e6:	ff ff ff 
+  8030e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030ed:	48 89 c7             	mov    %rax,%rdi
+  8030f0:	49 89 df             	mov    %rbx,%r15
+  8030f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f8:	49 b8 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%r8
+  8030ff:	ff ff ff 
+  803102:	49 01 d8             	add    %rbx,%r8
+  803105:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  803108:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80310f:	00 00 00 
+  803112:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803119:	00 
+}
+  80311a:	90                   	nop
+  80311b:	48 83 c4 10          	add    $0x10,%rsp
+  80311f:	5b                   	pop    %rbx
+  803120:	41 5f                	pop    %r15
+  803122:	5d                   	pop    %rbp
+  803123:	c3                   	ret
+
+0000000000803124 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  803124:	55                   	push   %rbp
+  803125:	48 89 e5             	mov    %rsp,%rbp
+  803128:	53                   	push   %rbx
+  803129:	48 83 ec 28          	sub    $0x28,%rsp
+  80312d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80312d <fork_map+0x9>
+  803134:	49 bb 13 5f 00 00 00 	movabs $0x5f13,%r11
+  80313b:	00 00 00 
+  80313e:	4c 01 db             	add    %r11,%rbx
+  803141:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803144:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803148:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  80314b:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803152:	00 00 00 
+  803155:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803159:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  80315f:	75 10                	jne    803171 <fork_map+0x4d>
+		fork_flush();
+  803161:	48 b8 11 a0 ff ff ff 	movabs $0xffffffffffffa011,%rax
+  803168:	ff ff ff 
+  80316b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80316f:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  803171:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803178:	00 00 00 
+  80317b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80317f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803183:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  80318a:	00 00 00 
+  80318d:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  803191:	48 c1 e0 05          	shl    $0x5,%rax
+  803195:	48 89 c2             	mov    %rax,%rdx
+  803198:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  80319f:	00 00 00 
+  8031a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031a6:	48 01 d0             	add    %rdx,%rax
+  8031a9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  8031ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031b1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  8031b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031bb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8031bf:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  8031c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031c7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8031ca:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  8031cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031d1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8031d5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  8031d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031dd:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8031e0:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  8031e3:	90                   	nop
+  8031e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031e8:	c9                   	leave
+  8031e9:	c3                   	ret
+
+00000000008031ea <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  8031ea:	55                   	push   %rbp
+  8031eb:	48 89 e5             	mov    %rsp,%rbp
+  8031ee:	53                   	push   %rbx
+  8031ef:	48 83 ec 28          	sub    $0x28,%rsp
+  8031f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031f3 <duppage+0x9>
+  8031fa:	49 bb 4d 5e 00 00 00 	movabs $0x5e4d,%r11
+  803201:	00 00 00 
+  803204:	4c 01 db             	add    %r11,%rbx
+  803207:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80320a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  80320d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803210:	48 c1 e0 0c          	shl    $0xc,%rax
+  803214:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  803218:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80321f:	ff ff ff 
+  803222:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803226:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803229:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80322d:	25 00 04 00 00       	and    $0x400,%eax
+  803232:	48 85 c0             	test   %rax,%rax
+  803235:	74 42                	je     803279 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  803237:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80323e:	ff ff ff 
+  803241:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803245:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803248:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80324c:	25 07 0e 00 00       	and    $0xe07,%eax
+  803251:	89 c2                	mov    %eax,%edx
+  803253:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803257:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80325a:	48 89 ce             	mov    %rcx,%rsi
+  80325d:	89 c7                	mov    %eax,%edi
+  80325f:	48 b8 e4 a0 ff ff ff 	movabs $0xffffffffffffa0e4,%rax
+  803266:	ff ff ff 
+  803269:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80326d:	ff d0                	call   *%rax
+		return 0;
+  80326f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803274:	e9 ae 00 00 00       	jmp    803327 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  803279:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803280:	ff ff ff 
+  803283:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803287:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80328a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80328e:	83 e0 02             	and    $0x2,%eax
+  803291:	48 85 c0             	test   %rax,%rax
+  803294:	75 1f                	jne    8032b5 <duppage+0xcb>
+  803296:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80329d:	ff ff ff 
+  8032a0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032a4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8032a7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032ab:	25 00 08 00 00       	and    $0x800,%eax
+  8032b0:	48 85 c0             	test   %rax,%rax
+  8032b3:	74 4c                	je     803301 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  8032b5:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  8032bc:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8032bf:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8032c3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032c6:	48 89 ce             	mov    %rcx,%rsi
+  8032c9:	89 c7                	mov    %eax,%edi
+  8032cb:	48 b8 e4 a0 ff ff ff 	movabs $0xffffffffffffa0e4,%rax
+  8032d2:	ff ff ff 
+  8032d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032d9:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  8032db:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8032de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032e2:	48 89 c6             	mov    %rax,%rsi
+  8032e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032ea:	48 b8 e4 a0 ff ff ff 	movabs $0xffffffffffffa0e4,%rax
+  8032f1:	ff ff ff 
+  8032f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032f8:	ff d0                	call   *%rax
+		return 0;
+  8032fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ff:	eb 26                	jmp    803327 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  803301:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803305:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803308:	ba 05 00 00 00       	mov    $0x5,%edx
+  80330d:	48 89 ce             	mov    %rcx,%rsi
+  803310:	89 c7                	mov    %eax,%edi
+  803312:	48 b8 e4 a0 ff ff ff 	movabs $0xffffffffffffa0e4,%rax
+  803319:	ff ff ff 
+  80331c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803320:	ff d0                	call   *%rax
+		return 0;
+  803322:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803327:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80332b:	c9                   	leave
+  80332c:	c3                   	ret
+
+000000000080332d <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  80332d:	55                   	push   %rbp
+  80332e:	48 89 e5             	mov    %rsp,%rbp
+  803331:	53                   	push   %rbx
+  803332:	48 83 ec 28          	sub    $0x28,%rsp
+  803336:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803336 <duphuge+0x9>
+  80333d:	49 bb 0a 5d 00 00 00 	movabs $0x5d0a,%r11
+  803344:	00 00 00 
+  803347:	4c 01 db             	add    %r11,%rbx
+  80334a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80334d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  803351:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803355:	48 c1 e8 15          	shr    $0x15,%rax
+  803359:	48 89 c2             	mov    %rax,%rdx
+  80335c:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803363:	ff ff ff 
+  803366:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80336a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80336e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  803372:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803376:	25 00 04 00 00       	and    $0x400,%eax
+  80337b:	48 85 c0             	test   %rax,%rax
+  80337e:	74 0e                	je     80338e <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  803380:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803384:	25 07 0e 00 00       	and    $0xe07,%eax
+  803389:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80338c:	eb 1e                	jmp    8033ac <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  80338e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803392:	25 02 08 00 00       	and    $0x802,%eax
+  803397:	48 85 c0             	test   %rax,%rax
+  80339a:	74 09                	je     8033a5 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  80339c:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  8033a3:	eb 07                	jmp    8033ac <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  8033a5:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  8033ac:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8033af:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8033b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8033b6:	48 89 ce             	mov    %rcx,%rsi
+  8033b9:	89 c7                	mov    %eax,%edi
+  8033bb:	48 b8 e4 a0 ff ff ff 	movabs $0xffffffffffffa0e4,%rax
+  8033c2:	ff ff ff 
+  8033c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033c9:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  8033cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033ce:	25 00 08 00 00       	and    $0x800,%eax
+  8033d3:	85 c0                	test   %eax,%eax
+  8033d5:	74 1f                	je     8033f6 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  8033d7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8033da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033de:	48 89 c6             	mov    %rax,%rsi
+  8033e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e6:	48 b8 e4 a0 ff ff ff 	movabs $0xffffffffffffa0e4,%rax
+  8033ed:	ff ff ff 
+  8033f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033f4:	ff d0                	call   *%rax
+	return 0;
+  8033f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033ff:	c9                   	leave
+  803400:	c3                   	ret
+
+0000000000803401 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  803401:	55                   	push   %rbp
+  803402:	48 89 e5             	mov    %rsp,%rbp
+  803405:	41 57                	push   %r15
+  803407:	53                   	push   %rbx
+  803408:	48 83 ec 10          	sub    $0x10,%rsp
+  80340c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80340c <fork+0xb>
+  803413:	49 bb 34 5c 00 00 00 	movabs $0x5c34,%r11
+  80341a:	00 00 00 
+  80341d:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  803420:	49 89 df             	mov    %rbx,%r15
+  803423:	48 b8 87 9b ff ff ff 	movabs $0xffffffffffff9b87,%rax
+  80342a:	ff ff ff 
+  80342d:	48 01 d8             	add    %rbx,%rax
+  803430:	ff d0                	call   *%rax
+  803432:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803435:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803439:	75 42                	jne    80347d <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80343b:	49 89 df             	mov    %rbx,%r15
+  80343e:	48 b8 89 93 ff ff ff 	movabs $0xffffffffffff9389,%rax
+  803445:	ff ff ff 
+  803448:	48 01 d8             	add    %rbx,%rax
+  80344b:	ff d0                	call   *%rax
+  80344d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803452:	48 98                	cltq
+  803454:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80345b:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803462:	ff ff ff 
+  803465:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803469:	48 01 c2             	add    %rax,%rdx
+  80346c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803473:	ff ff ff 
+  803476:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80347a:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  80347d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803480:	48 83 c4 10          	add    $0x10,%rsp
+  803484:	5b                   	pop    %rbx
+  803485:	41 5f                	pop    %r15
+  803487:	5d                   	pop    %rbp
+  803488:	c3                   	ret
+
+0000000000803489 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  803489:	55                   	push   %rbp
+  80348a:	48 89 e5             	mov    %rsp,%rbp
+  80348d:	41 57                	push   %r15
+  80348f:	53                   	push   %rbx
+  803490:	48 83 ec 10          	sub    $0x10,%rsp
+  803494:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803494 <ufork+0xb>
+  80349b:	49 bb ac 5b 00 00 00 	movabs $0x5bac,%r11
+  8034a2:	00 00 00 
+  8034a5:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  8034a8:	48 b8 db 9b ff ff ff 	movabs $0xffffffffffff9bdb,%rax
+  8034af:	ff ff ff 
+  8034b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034b6:	48 89 c7             	mov    %rax,%rdi
+  8034b9:	49 89 df             	mov    %rbx,%r15
+  8034bc:	48 b8 3c de ff ff ff 	movabs $0xffffffffffffde3c,%rax
+  8034c3:	ff ff ff 
+  8034c6:	48 01 d8             	add    %rbx,%rax
+  8034c9:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8034cb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8034d0:	cd 30                	int    $0x30
+  8034d2:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8034d5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  8034d8:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  8034db:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8034df:	0f 84 03 02 00 00    	je     8036e8 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  8034e5:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8034ec:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  8034ed:	e9 28 01 00 00       	jmp    80361a <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  8034f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034f6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8034fa:	48 89 c2             	mov    %rax,%rdx
+  8034fd:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803504:	ff ff ff 
+  803507:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80350b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80350f:	83 e0 01             	and    $0x1,%eax
+  803512:	48 85 c0             	test   %rax,%rax
+  803515:	0f 84 f7 00 00 00    	je     803612 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  80351b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80351f:	48 c1 e8 15          	shr    $0x15,%rax
+  803523:	48 89 c2             	mov    %rax,%rdx
+  803526:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80352d:	ff ff ff 
+  803530:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803534:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803538:	25 81 00 00 00       	and    $0x81,%eax
+  80353d:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  803543:	75 29                	jne    80356e <ufork+0xe5>
+					duphuge(child_envid, addr);
+  803545:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803549:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80354c:	48 89 d6             	mov    %rdx,%rsi
+  80354f:	89 c7                	mov    %eax,%edi
+  803551:	48 b8 ed a2 ff ff ff 	movabs $0xffffffffffffa2ed,%rax
+  803558:	ff ff ff 
+  80355b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80355f:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  803561:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803568:	00 
+  803569:	e9 ac 00 00 00       	jmp    80361a <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  80356e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803572:	48 c1 e8 15          	shr    $0x15,%rax
+  803576:	48 89 c2             	mov    %rax,%rdx
+  803579:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803580:	ff ff ff 
+  803583:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803587:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80358b:	83 e0 01             	and    $0x1,%eax
+  80358e:	48 85 c0             	test   %rax,%rax
+  803591:	74 75                	je     803608 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  803593:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803597:	48 c1 e8 0c          	shr    $0xc,%rax
+  80359b:	48 89 c2             	mov    %rax,%rdx
+  80359e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8035a5:	ff ff ff 
+  8035a8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035ac:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035b0:	83 e0 01             	and    $0x1,%eax
+  8035b3:	48 85 c0             	test   %rax,%rax
+  8035b6:	74 46                	je     8035fe <ufork+0x175>
+  8035b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035bc:	48 c1 e8 0c          	shr    $0xc,%rax
+  8035c0:	48 89 c2             	mov    %rax,%rdx
+  8035c3:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8035ca:	ff ff ff 
+  8035cd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035d1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035d5:	83 e0 04             	and    $0x4,%eax
+  8035d8:	48 85 c0             	test   %rax,%rax
+  8035db:	74 21                	je     8035fe <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  8035dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035e1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8035e5:	89 c2                	mov    %eax,%edx
+  8035e7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8035ea:	89 d6                	mov    %edx,%esi
+  8035ec:	89 c7                	mov    %eax,%edi
+  8035ee:	48 b8 aa a1 ff ff ff 	movabs $0xffffffffffffa1aa,%rax
+  8035f5:	ff ff ff 
+  8035f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035fc:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  8035fe:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803605:	00 
+  803606:	eb 12                	jmp    80361a <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803608:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80360f:	00 
+  803610:	eb 08                	jmp    80361a <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  803612:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803619:	40 
+		for (; addr < USTACKTOP;){
+  80361a:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80361f:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  803623:	0f 83 c9 fe ff ff    	jae    8034f2 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803629:	48 b8 11 a0 ff ff ff 	movabs $0xffffffffffffa011,%rax
+  803630:	ff ff ff 
+  803633:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803637:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803639:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80363c:	ba 07 00 00 00       	mov    $0x7,%edx
+  803641:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  803646:	48 89 ce             	mov    %rcx,%rsi
+  803649:	89 c7                	mov    %eax,%edi
+  80364b:	49 89 df             	mov    %rbx,%r15
+  80364e:	48 b8 32 94 ff ff ff 	movabs $0xffffffffffff9432,%rax
+  803655:	ff ff ff 
+  803658:	48 01 d8             	add    %rbx,%rax
+  80365b:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  80365d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803660:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803667:	ff ff ff 
+  80366a:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80366e:	48 89 d6             	mov    %rdx,%rsi
+  803671:	89 c7                	mov    %eax,%edi
+  803673:	49 89 df             	mov    %rbx,%r15
+  803676:	48 b8 28 96 ff ff ff 	movabs $0xffffffffffff9628,%rax
+  80367d:	ff ff ff 
+  803680:	48 01 d8             	add    %rbx,%rax
+  803683:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803685:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803688:	be 02 00 00 00       	mov    $0x2,%esi
+  80368d:	89 c7                	mov    %eax,%edi
+  80368f:	49 89 df             	mov    %rbx,%r15
+  803692:	48 b8 69 95 ff ff ff 	movabs $0xffffffffffff9569,%rax
+  803699:	ff ff ff 
+  80369c:	48 01 d8             	add    %rbx,%rax
+  80369f:	ff d0                	call   *%rax
+  8036a1:	85 c0                	test   %eax,%eax
+  8036a3:	74 3e                	je     8036e3 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  8036a5:	48 b8 9f e6 ff ff ff 	movabs $0xffffffffffffe69f,%rax
+  8036ac:	ff ff ff 
+  8036af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036b3:	48 89 c2             	mov    %rax,%rdx
+  8036b6:	be 07 01 00 00       	mov    $0x107,%esi
+  8036bb:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  8036c2:	ff ff ff 
+  8036c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036c9:	48 89 c7             	mov    %rax,%rdi
+  8036cc:	49 89 df             	mov    %rbx,%r15
+  8036cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d4:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  8036db:	ff ff ff 
+  8036de:	48 01 d9             	add    %rbx,%rcx
+  8036e1:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  8036e3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8036e6:	eb 59                	jmp    803741 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8036e8:	49 89 df             	mov    %rbx,%r15
+  8036eb:	48 b8 89 93 ff ff ff 	movabs $0xffffffffffff9389,%rax
+  8036f2:	ff ff ff 
+  8036f5:	48 01 d8             	add    %rbx,%rax
+  8036f8:	ff d0                	call   *%rax
+  8036fa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8036ff:	48 98                	cltq
+  803701:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803708:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80370f:	ff ff ff 
+  803712:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803716:	48 01 c2             	add    %rax,%rdx
+  803719:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803720:	ff ff ff 
+  803723:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803727:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  80372a:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803731:	00 00 00 
+  803734:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  80373b:	00 
+		return 0;
+  80373c:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  803741:	48 83 c4 10          	add    $0x10,%rsp
+  803745:	5b                   	pop    %rbx
+  803746:	41 5f                	pop    %r15
+  803748:	5d                   	pop    %rbp
+  803749:	c3                   	ret
+
+000000000080374a <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80374a:	55                   	push   %rbp
+  80374b:	48 89 e5             	mov    %rsp,%rbp
+  80374e:	41 57                	push   %r15
+  803750:	48 83 ec 08          	sub    $0x8,%rsp
+  803754:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803754 <sfork+0xa>
+  80375b:	49 bb ec 58 00 00 00 	movabs $0x58ec,%r11
+  803762:	00 00 00 
+  803765:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803768:	48 b8 ba e6 ff ff ff 	movabs $0xffffffffffffe6ba,%rax
+  80376f:	ff ff ff 
+  803772:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803776:	48 89 c2             	mov    %rax,%rdx
+  803779:	be 1a 01 00 00       	mov    $0x11a,%esi
+  80377e:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  803785:	ff ff ff 
+  803788:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80378c:	48 89 c7             	mov    %rax,%rdi
+  80378f:	49 89 cf             	mov    %rcx,%r15
+  803792:	b8 00 00 00 00       	mov    $0x0,%eax
+  803797:	49 b8 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%r8
+  80379e:	ff ff ff 
+  8037a1:	49 01 c8             	add    %rcx,%r8
+  8037a4:	41 ff d0             	call   *%r8
+
+00000000008037a7 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8037a7:	55                   	push   %rbp
+  8037a8:	48 89 e5             	mov    %rsp,%rbp
+  8037ab:	41 57                	push   %r15
+  8037ad:	53                   	push   %rbx
+  8037ae:	48 83 ec 30          	sub    $0x30,%rsp
+  8037b2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037b2 <ipc_recv+0xb>
+  8037b9:	49 bb 8e 58 00 00 00 	movabs $0x588e,%r11
+  8037c0:	00 00 00 
+  8037c3:	4c 01 db             	add    %r11,%rbx
+  8037c6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8037ca:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8037ce:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8037d2:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8037d7:	75 0e                	jne    8037e7 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8037d9:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8037e0:	00 00 00 
+  8037e3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8037e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037eb:	48 89 c7             	mov    %rax,%rdi
+  8037ee:	49 89 df             	mov    %rbx,%r15
+  8037f1:	48 b8 5b 97 ff ff ff 	movabs $0xffffffffffff975b,%rax
+  8037f8:	ff ff ff 
+  8037fb:	48 01 d8             	add    %rbx,%rax
+  8037fe:	ff d0                	call   *%rax
+  803800:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  803803:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803808:	74 2a                	je     803834 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  80380a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80380e:	75 19                	jne    803829 <ipc_recv+0x82>
+  803810:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803817:	ff ff ff 
+  80381a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80381e:	48 8b 00             	mov    (%rax),%rax
+  803821:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803827:	eb 05                	jmp    80382e <ipc_recv+0x87>
+  803829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80382e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803832:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  803834:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803839:	74 2a                	je     803865 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  80383b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80383f:	75 19                	jne    80385a <ipc_recv+0xb3>
+  803841:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803848:	ff ff ff 
+  80384b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80384f:	48 8b 00             	mov    (%rax),%rax
+  803852:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803858:	eb 05                	jmp    80385f <ipc_recv+0xb8>
+  80385a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803863:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  803865:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803869:	74 05                	je     803870 <ipc_recv+0xc9>
+		return res;
+  80386b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80386e:	eb 17                	jmp    803887 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  803870:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803877:	ff ff ff 
+  80387a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80387e:	48 8b 00             	mov    (%rax),%rax
+  803881:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803887:	48 83 c4 30          	add    $0x30,%rsp
+  80388b:	5b                   	pop    %rbx
+  80388c:	41 5f                	pop    %r15
+  80388e:	5d                   	pop    %rbp
+  80388f:	c3                   	ret
+
+0000000000803890 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803890:	55                   	push   %rbp
+  803891:	48 89 e5             	mov    %rsp,%rbp
+  803894:	41 57                	push   %r15
+  803896:	53                   	push   %rbx
+  803897:	48 83 ec 20          	sub    $0x20,%rsp
+  80389b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80389b <ipc_send+0xb>
+  8038a2:	49 bb a5 57 00 00 00 	movabs $0x57a5,%r11
+  8038a9:	00 00 00 
+  8038ac:	4c 01 db             	add    %r11,%rbx
+  8038af:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8038b2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8038b5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8038b9:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8038bc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8038c1:	75 0e                	jne    8038d1 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8038c3:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8038ca:	00 00 00 
+  8038cd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8038d1:	90                   	nop
+  8038d2:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8038d5:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8038d8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038df:	89 c7                	mov    %eax,%edi
+  8038e1:	49 89 df             	mov    %rbx,%r15
+  8038e4:	48 b8 f1 96 ff ff ff 	movabs $0xffffffffffff96f1,%rax
+  8038eb:	ff ff ff 
+  8038ee:	48 01 d8             	add    %rbx,%rax
+  8038f1:	ff d0                	call   *%rax
+  8038f3:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8038f6:	74 da                	je     8038d2 <ipc_send+0x42>
+		;
+}
+  8038f8:	90                   	nop
+  8038f9:	90                   	nop
+  8038fa:	48 83 c4 20          	add    $0x20,%rsp
+  8038fe:	5b                   	pop    %rbx
+  8038ff:	41 5f                	pop    %r15
+  803901:	5d                   	pop    %rbp
+  803902:	c3                   	ret
+
+0000000000803903 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  803903:	55                   	push   %rbp
+  803904:	48 89 e5             	mov    %rsp,%rbp
+  803907:	41 57                	push   %r15
+  803909:	53                   	push   %rbx
+  80390a:	48 83 ec 40          	sub    $0x40,%rsp
+  80390e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80390e <ipc_call+0xb>
+  803915:	49 bb 32 57 00 00 00 	movabs $0x5732,%r11
+  80391c:	00 00 00 
+  80391f:	4c 01 db             	add    %r11,%rbx
+  803922:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803925:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803928:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80392c:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80392f:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803933:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803937:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80393c:	75 0e                	jne    80394c <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  80393e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803945:	00 00 00 
+  803948:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80394c:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803951:	75 0e                	jne    803961 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803953:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80395a:	00 00 00 
+  80395d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  803961:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803964:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803968:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80396b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80396f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803972:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803978:	49 89 f8             	mov    %rdi,%r8
+  80397b:	89 c7                	mov    %eax,%edi
+  80397d:	49 89 df             	mov    %rbx,%r15
+  803980:	48 b8 b4 97 ff ff ff 	movabs $0xffffffffffff97b4,%rax
+  803987:	ff ff ff 
+  80398a:	48 01 d8             	add    %rbx,%rax
+  80398d:	ff d0                	call   *%rax
+  80398f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  803992:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803997:	74 2a                	je     8039c3 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803999:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80399d:	75 19                	jne    8039b8 <ipc_call+0xb5>
+  80399f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8039a6:	ff ff ff 
+  8039a9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039ad:	48 8b 00             	mov    (%rax),%rax
+  8039b0:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8039b6:	eb 05                	jmp    8039bd <ipc_call+0xba>
+  8039b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039bd:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8039c1:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8039c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039c7:	74 05                	je     8039ce <ipc_call+0xcb>
+		return r;
+  8039c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039cc:	eb 17                	jmp    8039e5 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8039ce:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8039d5:	ff ff ff 
+  8039d8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039dc:	48 8b 00             	mov    (%rax),%rax
+  8039df:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8039e5:	48 83 c4 40          	add    $0x40,%rsp
+  8039e9:	5b                   	pop    %rbx
+  8039ea:	41 5f                	pop    %r15
+  8039ec:	5d                   	pop    %rbp
+  8039ed:	c3                   	ret
+
+00000000008039ee <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8039ee:	55                   	push   %rbp
+  8039ef:	48 89 e5             	mov    %rsp,%rbp
+  8039f2:	41 57                	push   %r15
+  8039f4:	53                   	push   %rbx
+  8039f5:	48 83 ec 70          	sub    $0x70,%rsp
+  8039f9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039f9 <ipc_callw+0xb>
+  803a00:	49 bb 47 56 00 00 00 	movabs $0x5647,%r11
+  803a07:	00 00 00 
+  803a0a:	4c 01 db             	add    %r11,%rbx
+  803a0d:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  803a10:	89 75 98             	mov    %esi,-0x68(%rbp)
+  803a13:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  803a17:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  803a1b:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  803a20:	76 0a                	jbe    803a2c <ipc_callw+0x3e>
+		return -E_INVAL;
+  803a22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a27:	e9 b7 00 00 00       	jmp    803ae3 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  803a2c:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803a30:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  803a34:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803a38:	48 89 ce             	mov    %rcx,%rsi
+  803a3b:	48 89 c7             	mov    %rax,%rdi
+  803a3e:	49 89 df             	mov    %rbx,%r15
+  803a41:	48 b8 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rax
+  803a48:	ff ff ff 
+  803a4b:	48 01 d8             	add    %rbx,%rax
+  803a4e:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  803a50:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803a57:	00 
+  803a58:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803a5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a60:	48 01 d0             	add    %rdx,%rax
+  803a63:	48 83 e8 01          	sub    $0x1,%rax
+  803a67:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803a6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a74:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803a78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a7c:	48 29 d0             	sub    %rdx,%rax
+  803a7f:	48 c1 e8 03          	shr    $0x3,%rax
+  803a83:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  803a87:	89 c1                	mov    %eax,%ecx
+  803a89:	8b 75 98             	mov    -0x68(%rbp),%esi
+  803a8c:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  803a90:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  803a93:	49 89 d1             	mov    %rdx,%r9
+  803a96:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  803a9d:	00 00 00 
+  803aa0:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  803aa7:	00 00 00 
+  803aaa:	89 c7                	mov    %eax,%edi
+  803aac:	49 89 df             	mov    %rbx,%r15
+  803aaf:	48 b8 b4 97 ff ff ff 	movabs $0xffffffffffff97b4,%rax
+  803ab6:	ff ff ff 
+  803ab9:	48 01 d8             	add    %rbx,%rax
+  803abc:	ff d0                	call   *%rax
+  803abe:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  803ac1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803ac5:	74 05                	je     803acc <ipc_callw+0xde>
+		return r;
+  803ac7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803aca:	eb 17                	jmp    803ae3 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  803acc:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803ad3:	ff ff ff 
+  803ad6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ada:	48 8b 00             	mov    (%rax),%rax
+  803add:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803ae3:	48 83 c4 70          	add    $0x70,%rsp
+  803ae7:	5b                   	pop    %rbx
+  803ae8:	41 5f                	pop    %r15
+  803aea:	5d                   	pop    %rbp
+  803aeb:	c3                   	ret
+
+0000000000803aec <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  803aec:	55                   	push   %rbp
+  803aed:	48 89 e5             	mov    %rsp,%rbp
+  803af0:	41 57                	push   %r15
+  803af2:	53                   	push   %rbx
+  803af3:	48 83 ec 40          	sub    $0x40,%rsp
+  803af7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803af7 <ipc_callv+0xb>
+  803afe:	49 bb 49 55 00 00 00 	movabs $0x5549,%r11
+  803b05:	00 00 00 
+  803b08:	4c 01 db             	add    %r11,%rbx
+  803b0b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803b0e:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  803b11:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803b15:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803b18:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  803b1c:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  803b20:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803b27:	00 00 00 
+  803b2a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  803b2e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  803b32:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  803b36:	74 11                	je     803b49 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  803b38:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803b3c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  803b40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b43:	c1 e0 14             	shl    $0x14,%eax
+  803b46:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  803b49:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  803b4d:	74 14                	je     803b63 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  803b4f:	8b 45 20             	mov    0x20(%rbp),%eax
+  803b52:	83 e8 01             	sub    $0x1,%eax
+  803b55:	48 63 d0             	movslq %eax,%rdx
+  803b58:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803b5c:	48 09 d0             	or     %rdx,%rax
+  803b5f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  803b63:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803b66:	c1 e0 10             	shl    $0x10,%eax
+  803b69:	0b 45 10             	or     0x10(%rbp),%eax
+  803b6c:	89 c1                	mov    %eax,%ecx
+  803b6e:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  803b71:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  803b75:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  803b79:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803b7d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803b80:	4d 89 c1             	mov    %r8,%r9
+  803b83:	49 89 f8             	mov    %rdi,%r8
+  803b86:	89 c7                	mov    %eax,%edi
+  803b88:	49 89 df             	mov    %rbx,%r15
+  803b8b:	48 b8 b4 97 ff ff ff 	movabs $0xffffffffffff97b4,%rax
+  803b92:	ff ff ff 
+  803b95:	48 01 d8             	add    %rbx,%rax
+  803b98:	ff d0                	call   *%rax
+  803b9a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  803b9d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803ba1:	74 05                	je     803ba8 <ipc_callv+0xbc>
+		return r;
+  803ba3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ba6:	eb 17                	jmp    803bbf <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  803ba8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803baf:	ff ff ff 
+  803bb2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803bb6:	48 8b 00             	mov    (%rax),%rax
+  803bb9:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803bbf:	48 83 c4 40          	add    $0x40,%rsp
+  803bc3:	5b                   	pop    %rbx
+  803bc4:	41 5f                	pop    %r15
+  803bc6:	5d                   	pop    %rbp
+  803bc7:	c3                   	ret
+
+0000000000803bc8 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  803bc8:	55                   	push   %rbp
+  803bc9:	48 89 e5             	mov    %rsp,%rbp
+  803bcc:	41 57                	push   %r15
+  803bce:	53                   	push   %rbx
+  803bcf:	48 83 ec 40          	sub    $0x40,%rsp
+  803bd3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bd3 <ipc_reply_recv+0xb>
+  803bda:	49 bb 6d 54 00 00 00 	movabs $0x546d,%r11
+  803be1:	00 00 00 
+  803be4:	4c 01 db             	add    %r11,%rbx
+  803be7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803bea:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803bed:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803bf1:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803bf4:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803bf8:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803bfc:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803c01:	75 0e                	jne    803c11 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  803c03:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803c0a:	00 00 00 
+  803c0d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803c11:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803c16:	75 0e                	jne    803c26 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803c18:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803c1f:	00 00 00 
+  803c22:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803c26:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803c29:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  803c2d:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803c31:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803c34:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803c38:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c3b:	4d 89 c1             	mov    %r8,%r9
+  803c3e:	49 89 f8             	mov    %rdi,%r8
+  803c41:	89 c7                	mov    %eax,%edi
+  803c43:	49 89 df             	mov    %rbx,%r15
+  803c46:	48 b8 28 98 ff ff ff 	movabs $0xffffffffffff9828,%rax
+  803c4d:	ff ff ff 
+  803c50:	48 01 d8             	add    %rbx,%rax
+  803c53:	ff d0                	call   *%rax
+  803c55:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  803c58:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803c5d:	74 2a                	je     803c89 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803c5f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c63:	75 19                	jne    803c7e <ipc_reply_recv+0xb6>
+  803c65:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803c6c:	ff ff ff 
+  803c6f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c73:	48 8b 00             	mov    (%rax),%rax
+  803c76:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803c7c:	eb 05                	jmp    803c83 <ipc_reply_recv+0xbb>
+  803c7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c87:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  803c89:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  803c8e:	74 2a                	je     803cba <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803c90:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c94:	75 19                	jne    803caf <ipc_reply_recv+0xe7>
+  803c96:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803c9d:	ff ff ff 
+  803ca0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ca4:	48 8b 00             	mov    (%rax),%rax
+  803ca7:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803cad:	eb 05                	jmp    803cb4 <ipc_reply_recv+0xec>
+  803caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb4:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  803cb8:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803cba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cbe:	74 05                	je     803cc5 <ipc_reply_recv+0xfd>
+		return r;
+  803cc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cc3:	eb 17                	jmp    803cdc <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  803cc5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803ccc:	ff ff ff 
+  803ccf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803cd3:	48 8b 00             	mov    (%rax),%rax
+  803cd6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803cdc:	48 83 c4 40          	add    $0x40,%rsp
+  803ce0:	5b                   	pop    %rbx
+  803ce1:	41 5f                	pop    %r15
+  803ce3:	5d                   	pop    %rbp
+  803ce4:	c3                   	ret
+
+0000000000803ce5 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  803ce5:	55                   	push   %rbp
+  803ce6:	48 89 e5             	mov    %rsp,%rbp
+  803ce9:	41 57                	push   %r15
+  803ceb:	53                   	push   %rbx
+  803cec:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  803cf3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cf3 <ipc_window_batch+0xe>
+  803cfa:	49 bb 4d 53 00 00 00 	movabs $0x534d,%r11
+  803d01:	00 00 00 
+  803d04:	4c 01 db             	add    %r11,%rbx
+  803d07:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  803d0d:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  803d14:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803d1a:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  803d20:	e9 15 01 00 00       	jmp    803e3a <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803d25:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803d2b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803d2e:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803d35:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803d38:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803d3b:	39 c2                	cmp    %eax,%edx
+  803d3d:	0f 4e c2             	cmovle %edx,%eax
+  803d40:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  803d43:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803d4a:	eb 6b                	jmp    803db7 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803d4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d4f:	48 98                	cltq
+  803d51:	48 c1 e0 05          	shl    $0x5,%rax
+  803d55:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803d59:	48 01 e8             	add    %rbp,%rax
+  803d5c:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  803d62:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803d68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d6b:	c1 e0 0c             	shl    $0xc,%eax
+  803d6e:	48 63 d0             	movslq %eax,%rdx
+  803d71:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803d78:	48 01 c2             	add    %rax,%rdx
+  803d7b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d7e:	48 98                	cltq
+  803d80:	48 c1 e0 05          	shl    $0x5,%rax
+  803d84:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803d88:	48 01 e8             	add    %rbp,%rax
+  803d8b:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  803d91:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  803d94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d97:	48 98                	cltq
+  803d99:	48 c1 e0 05          	shl    $0x5,%rax
+  803d9d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803da1:	48 01 e8             	add    %rbp,%rax
+  803da4:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  803dab:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  803db1:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  803db3:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803db7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dba:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  803dbd:	7c 8d                	jl     803d4c <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  803dbf:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  803dc6:	74 27                	je     803def <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803dc8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803dcb:	48 63 d0             	movslq %eax,%rdx
+  803dce:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803dd5:	48 89 d6             	mov    %rdx,%rsi
+  803dd8:	48 89 c7             	mov    %rax,%rdi
+  803ddb:	49 89 df             	mov    %rbx,%r15
+  803dde:	48 b8 cb 9a ff ff ff 	movabs $0xffffffffffff9acb,%rax
+  803de5:	ff ff ff 
+  803de8:	48 01 d8             	add    %rbx,%rax
+  803deb:	ff d0                	call   *%rax
+  803ded:	eb 25                	jmp    803e14 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  803def:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803df2:	48 63 d0             	movslq %eax,%rdx
+  803df5:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803dfc:	48 89 d6             	mov    %rdx,%rsi
+  803dff:	48 89 c7             	mov    %rax,%rdi
+  803e02:	49 89 df             	mov    %rbx,%r15
+  803e05:	48 b8 29 9b ff ff ff 	movabs $0xffffffffffff9b29,%rax
+  803e0c:	ff ff ff 
+  803e0f:	48 01 d8             	add    %rbx,%rax
+  803e12:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803e14:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803e17:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803e1b:	79 05                	jns    803e22 <ipc_window_batch+0x13d>
+			return r;
+  803e1d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e20:	eb 2a                	jmp    803e4c <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  803e22:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803e25:	c1 e0 0c             	shl    $0xc,%eax
+  803e28:	48 98                	cltq
+  803e2a:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  803e31:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803e34:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803e3a:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  803e41:	0f 8f de fe ff ff    	jg     803d25 <ipc_window_batch+0x40>
+	}
+	return 0;
+  803e47:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e4c:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  803e53:	5b                   	pop    %rbx
+  803e54:	41 5f                	pop    %r15
+  803e56:	5d                   	pop    %rbp
+  803e57:	c3                   	ret
+
+0000000000803e58 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803e58:	55                   	push   %rbp
+  803e59:	48 89 e5             	mov    %rsp,%rbp
+  803e5c:	48 83 ec 10          	sub    $0x10,%rsp
+  803e60:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e60 <ipc_map_window+0x8>
+  803e67:	49 bb e0 51 00 00 00 	movabs $0x51e0,%r11
+  803e6e:	00 00 00 
+  803e71:	4c 01 d8             	add    %r11,%rax
+  803e74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803e78:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803e7b:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803e7e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803e82:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803e87:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e8c:	49 b8 a5 ac ff ff ff 	movabs $0xffffffffffffaca5,%r8
+  803e93:	ff ff ff 
+  803e96:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803e9a:	ff d0                	call   *%rax
+}
+  803e9c:	c9                   	leave
+  803e9d:	c3                   	ret
+
+0000000000803e9e <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803e9e:	55                   	push   %rbp
+  803e9f:	48 89 e5             	mov    %rsp,%rbp
+  803ea2:	48 83 ec 10          	sub    $0x10,%rsp
+  803ea6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ea6 <ipc_unmap_window+0x8>
+  803ead:	49 bb 9a 51 00 00 00 	movabs $0x519a,%r11
+  803eb4:	00 00 00 
+  803eb7:	4c 01 d8             	add    %r11,%rax
+  803eba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803ebe:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  803ec1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803ec4:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803ec8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ecd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ed2:	49 b8 a5 ac ff ff ff 	movabs $0xffffffffffffaca5,%r8
+  803ed9:	ff ff ff 
+  803edc:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803ee0:	ff d0                	call   *%rax
+}
+  803ee2:	c9                   	leave
+  803ee3:	c3                   	ret
+
+0000000000803ee4 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803ee4:	55                   	push   %rbp
+  803ee5:	48 89 e5             	mov    %rsp,%rbp
+  803ee8:	48 83 ec 18          	sub    $0x18,%rsp
+  803eec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803eec <ipc_find_env+0x8>
+  803ef3:	49 bb 54 51 00 00 00 	movabs $0x5154,%r11
+  803efa:	00 00 00 
+  803efd:	4c 01 d8             	add    %r11,%rax
+  803f00:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803f03:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803f0a:	eb 57                	jmp    803f63 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803f0c:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803f13:	ff ff ff 
+  803f16:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803f1a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803f1d:	48 63 d2             	movslq %edx,%rdx
+  803f20:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803f27:	48 01 ca             	add    %rcx,%rdx
+  803f2a:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803f31:	8b 12                	mov    (%rdx),%edx
+  803f33:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803f36:	75 27                	jne    803f5f <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803f38:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803f3f:	ff ff ff 
+  803f42:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803f46:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f49:	48 98                	cltq
+  803f4b:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803f52:	48 01 d0             	add    %rdx,%rax
+  803f55:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803f5b:	8b 00                	mov    (%rax),%eax
+  803f5d:	eb 12                	jmp    803f71 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803f5f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803f63:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803f6a:	7e a0                	jle    803f0c <ipc_find_env+0x28>
+	}
+	return 0;
+  803f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f71:	c9                   	leave
+  803f72:	c3                   	ret
+
+0000000000803f73 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803f73:	55                   	push   %rbp
+  803f74:	48 89 e5             	mov    %rsp,%rbp
+  803f77:	48 83 ec 08          	sub    $0x8,%rsp
+  803f7b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803f7b <fd2num+0x8>
+  803f82:	49 bb c5 50 00 00 00 	movabs $0x50c5,%r11
+  803f89:	00 00 00 
+  803f8c:	4c 01 d8             	add    %r11,%rax
+  803f8f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803f93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f97:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803f9e:	ff ff ff 
+  803fa1:	48 01 d0             	add    %rdx,%rax
+  803fa4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803fa8:	c9                   	leave
+  803fa9:	c3                   	ret
+
+0000000000803faa <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803faa:	55                   	push   %rbp
+  803fab:	48 89 e5             	mov    %rsp,%rbp
+  803fae:	48 83 ec 08          	sub    $0x8,%rsp
+  803fb2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803fb2 <fd2data+0x8>
+  803fb9:	49 bb 8e 50 00 00 00 	movabs $0x508e,%r11
+  803fc0:	00 00 00 
+  803fc3:	4c 01 d8             	add    %r11,%rax
+  803fc6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803fca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803fce:	48 89 d7             	mov    %rdx,%rdi
+  803fd1:	48 ba 33 af ff ff ff 	movabs $0xffffffffffffaf33,%rdx
+  803fd8:	ff ff ff 
+  803fdb:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803fdf:	ff d0                	call   *%rax
+  803fe1:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803fe7:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803feb:	c9                   	leave
+  803fec:	c3                   	ret
+
+0000000000803fed <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803fed:	55                   	push   %rbp
+  803fee:	48 89 e5             	mov    %rsp,%rbp
+  803ff1:	48 83 ec 18          	sub    $0x18,%rsp
+  803ff5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ff5 <fd_alloc+0x8>
+  803ffc:	49 bb 4b 50 00 00 00 	movabs $0x504b,%r11
+  804003:	00 00 00 
+  804006:	4c 01 d8             	add    %r11,%rax
+  804009:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80400d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804014:	eb 75                	jmp    80408b <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  804016:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804019:	48 63 d2             	movslq %edx,%rdx
+  80401c:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  804023:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804027:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80402b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80402f:	48 89 d1             	mov    %rdx,%rcx
+  804032:	48 c1 e9 15          	shr    $0x15,%rcx
+  804036:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80403d:	ff ff ff 
+  804040:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  804044:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  804048:	83 e2 01             	and    $0x1,%edx
+  80404b:	48 85 d2             	test   %rdx,%rdx
+  80404e:	74 25                	je     804075 <fd_alloc+0x88>
+  804050:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804054:	48 89 d1             	mov    %rdx,%rcx
+  804057:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80405b:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  804062:	ff ff ff 
+  804065:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  804069:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80406d:	83 e2 01             	and    $0x1,%edx
+  804070:	48 85 d2             	test   %rdx,%rdx
+  804073:	75 12                	jne    804087 <fd_alloc+0x9a>
+			*fd_store = fd;
+  804075:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804079:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80407d:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  804080:	b8 00 00 00 00       	mov    $0x0,%eax
+  804085:	eb 1a                	jmp    8040a1 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  804087:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80408b:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80408f:	7e 85                	jle    804016 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  804091:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804095:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  80409c:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  8040a1:	c9                   	leave
+  8040a2:	c3                   	ret
+
+00000000008040a3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8040a3:	55                   	push   %rbp
+  8040a4:	48 89 e5             	mov    %rsp,%rbp
+  8040a7:	48 83 ec 20          	sub    $0x20,%rsp
+  8040ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8040ab <fd_lookup+0x8>
+  8040b2:	49 bb 95 4f 00 00 00 	movabs $0x4f95,%r11
+  8040b9:	00 00 00 
+  8040bc:	4c 01 d8             	add    %r11,%rax
+  8040bf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8040c2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8040c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040ca:	78 06                	js     8040d2 <fd_lookup+0x2f>
+  8040cc:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8040d0:	7e 07                	jle    8040d9 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8040d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8040d7:	eb 73                	jmp    80414c <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8040d9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8040dc:	48 63 d2             	movslq %edx,%rdx
+  8040df:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8040e6:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8040ea:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8040ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040f2:	48 89 d1             	mov    %rdx,%rcx
+  8040f5:	48 c1 e9 15          	shr    $0x15,%rcx
+  8040f9:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  804100:	ff ff ff 
+  804103:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  804107:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80410b:	83 e2 01             	and    $0x1,%edx
+  80410e:	48 85 d2             	test   %rdx,%rdx
+  804111:	74 22                	je     804135 <fd_lookup+0x92>
+  804113:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804117:	48 c1 ea 0c          	shr    $0xc,%rdx
+  80411b:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  804122:	ff ff ff 
+  804125:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  804129:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80412d:	83 e0 01             	and    $0x1,%eax
+  804130:	48 85 c0             	test   %rax,%rax
+  804133:	75 07                	jne    80413c <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  804135:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80413a:	eb 10                	jmp    80414c <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  80413c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804140:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804144:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  804147:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80414c:	c9                   	leave
+  80414d:	c3                   	ret
+
+000000000080414e <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  80414e:	55                   	push   %rbp
+  80414f:	48 89 e5             	mov    %rsp,%rbp
+  804152:	41 57                	push   %r15
+  804154:	53                   	push   %rbx
+  804155:	48 83 ec 30          	sub    $0x30,%rsp
+  804159:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804159 <fd_close+0xb>
+  804160:	49 bb e7 4e 00 00 00 	movabs $0x4ee7,%r11
+  804167:	00 00 00 
+  80416a:	4c 01 db             	add    %r11,%rbx
+  80416d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804171:	89 f0                	mov    %esi,%eax
+  804173:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  804176:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80417a:	48 89 c7             	mov    %rax,%rdi
+  80417d:	48 b8 33 af ff ff ff 	movabs $0xffffffffffffaf33,%rax
+  804184:	ff ff ff 
+  804187:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80418b:	ff d0                	call   *%rax
+  80418d:	89 c2                	mov    %eax,%edx
+  80418f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804193:	48 89 c6             	mov    %rax,%rsi
+  804196:	89 d7                	mov    %edx,%edi
+  804198:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  80419f:	ff ff ff 
+  8041a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041a6:	ff d0                	call   *%rax
+  8041a8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041ab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041af:	78 0a                	js     8041bb <fd_close+0x6d>
+	    || fd != fd2)
+  8041b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041b5:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  8041b9:	74 12                	je     8041cd <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  8041bb:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8041bf:	74 05                	je     8041c6 <fd_close+0x78>
+  8041c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041c4:	eb 7a                	jmp    804240 <fd_close+0xf2>
+  8041c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041cb:	eb 73                	jmp    804240 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8041cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041d1:	8b 00                	mov    (%rax),%eax
+  8041d3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8041d7:	48 89 d6             	mov    %rdx,%rsi
+  8041da:	89 c7                	mov    %eax,%edi
+  8041dc:	48 b8 09 b2 ff ff ff 	movabs $0xffffffffffffb209,%rax
+  8041e3:	ff ff ff 
+  8041e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041ea:	ff d0                	call   *%rax
+  8041ec:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041ef:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041f3:	78 2a                	js     80421f <fd_close+0xd1>
+		if (dev->dev_close)
+  8041f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041f9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8041fd:	48 85 c0             	test   %rax,%rax
+  804200:	74 16                	je     804218 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  804202:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804206:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80420a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80420e:	48 89 c7             	mov    %rax,%rdi
+  804211:	ff d2                	call   *%rdx
+  804213:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804216:	eb 07                	jmp    80421f <fd_close+0xd1>
+		else
+			r = 0;
+  804218:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  80421f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804223:	48 89 c6             	mov    %rax,%rsi
+  804226:	bf 00 00 00 00       	mov    $0x0,%edi
+  80422b:	49 89 df             	mov    %rbx,%r15
+  80422e:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  804235:	ff ff ff 
+  804238:	48 01 d8             	add    %rbx,%rax
+  80423b:	ff d0                	call   *%rax
+	return r;
+  80423d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804240:	48 83 c4 30          	add    $0x30,%rsp
+  804244:	5b                   	pop    %rbx
+  804245:	41 5f                	pop    %r15
+  804247:	5d                   	pop    %rbp
+  804248:	c3                   	ret
+
+0000000000804249 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  804249:	55                   	push   %rbp
+  80424a:	48 89 e5             	mov    %rsp,%rbp
+  80424d:	41 57                	push   %r15
+  80424f:	48 83 ec 28          	sub    $0x28,%rsp
+  804253:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 804253 <dev_lookup+0xa>
+  80425a:	49 bb ed 4d 00 00 00 	movabs $0x4ded,%r11
+  804261:	00 00 00 
+  804264:	4c 01 d9             	add    %r11,%rcx
+  804267:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80426a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80426e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804275:	eb 45                	jmp    8042bc <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  804277:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80427e:	00 00 00 
+  804281:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804284:	48 98                	cltq
+  804286:	48 01 ca             	add    %rcx,%rdx
+  804289:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80428d:	8b 00                	mov    (%rax),%eax
+  80428f:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  804292:	75 24                	jne    8042b8 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  804294:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80429b:	00 00 00 
+  80429e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042a1:	48 98                	cltq
+  8042a3:	48 01 ca             	add    %rcx,%rdx
+  8042a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042ae:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8042b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b6:	eb 74                	jmp    80432c <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  8042b8:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8042bc:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  8042c3:	00 00 00 
+  8042c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042c9:	48 98                	cltq
+  8042cb:	48 01 ca             	add    %rcx,%rdx
+  8042ce:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042d2:	48 85 c0             	test   %rax,%rax
+  8042d5:	75 a0                	jne    804277 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8042d7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8042de:	ff ff ff 
+  8042e1:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8042e5:	48 8b 00             	mov    (%rax),%rax
+  8042e8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8042ee:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8042f1:	89 c6                	mov    %eax,%esi
+  8042f3:	48 b8 d0 e6 ff ff ff 	movabs $0xffffffffffffe6d0,%rax
+  8042fa:	ff ff ff 
+  8042fd:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  804301:	48 89 c7             	mov    %rax,%rdi
+  804304:	49 89 cf             	mov    %rcx,%r15
+  804307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80430c:	49 b8 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%r8
+  804313:	ff ff ff 
+  804316:	49 01 c8             	add    %rcx,%r8
+  804319:	41 ff d0             	call   *%r8
+	*dev = 0;
+  80431c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804320:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  804327:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80432c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804330:	c9                   	leave
+  804331:	c3                   	ret
+
+0000000000804332 <close>:
+
+int
+close(int fdnum)
+{
+  804332:	55                   	push   %rbp
+  804333:	48 89 e5             	mov    %rsp,%rbp
+  804336:	53                   	push   %rbx
+  804337:	48 83 ec 28          	sub    $0x28,%rsp
+  80433b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80433b <close+0x9>
+  804342:	49 bb 05 4d 00 00 00 	movabs $0x4d05,%r11
+  804349:	00 00 00 
+  80434c:	4c 01 db             	add    %r11,%rbx
+  80434f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804352:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804356:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804359:	48 89 d6             	mov    %rdx,%rsi
+  80435c:	89 c7                	mov    %eax,%edi
+  80435e:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  804365:	ff ff ff 
+  804368:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80436c:	ff d0                	call   *%rax
+  80436e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804371:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804375:	79 05                	jns    80437c <close+0x4a>
+		return r;
+  804377:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80437a:	eb 1c                	jmp    804398 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  80437c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804380:	be 01 00 00 00       	mov    $0x1,%esi
+  804385:	48 89 c7             	mov    %rax,%rdi
+  804388:	48 b8 0e b1 ff ff ff 	movabs $0xffffffffffffb10e,%rax
+  80438f:	ff ff ff 
+  804392:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804396:	ff d0                	call   *%rax
+}
+  804398:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80439c:	c9                   	leave
+  80439d:	c3                   	ret
+
+000000000080439e <close_all>:
+
+void
+close_all(void)
+{
+  80439e:	55                   	push   %rbp
+  80439f:	48 89 e5             	mov    %rsp,%rbp
+  8043a2:	53                   	push   %rbx
+  8043a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8043a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043a7 <close_all+0x9>
+  8043ae:	49 bb 99 4c 00 00 00 	movabs $0x4c99,%r11
+  8043b5:	00 00 00 
+  8043b8:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8043bb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8043c2:	eb 19                	jmp    8043dd <close_all+0x3f>
+		close(i);
+  8043c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043c7:	89 c7                	mov    %eax,%edi
+  8043c9:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  8043d0:	ff ff ff 
+  8043d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043d7:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8043d9:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8043dd:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8043e1:	7e e1                	jle    8043c4 <close_all+0x26>
+}
+  8043e3:	90                   	nop
+  8043e4:	90                   	nop
+  8043e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043e9:	c9                   	leave
+  8043ea:	c3                   	ret
+
+00000000008043eb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8043eb:	55                   	push   %rbp
+  8043ec:	48 89 e5             	mov    %rsp,%rbp
+  8043ef:	41 57                	push   %r15
+  8043f1:	53                   	push   %rbx
+  8043f2:	48 83 ec 40          	sub    $0x40,%rsp
+  8043f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043f6 <dup+0xb>
+  8043fd:	49 bb 4a 4c 00 00 00 	movabs $0x4c4a,%r11
+  804404:	00 00 00 
+  804407:	4c 01 db             	add    %r11,%rbx
+  80440a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80440d:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  804410:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  804414:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804417:	48 89 d6             	mov    %rdx,%rsi
+  80441a:	89 c7                	mov    %eax,%edi
+  80441c:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  804423:	ff ff ff 
+  804426:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80442a:	ff d0                	call   *%rax
+  80442c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80442f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804433:	79 08                	jns    80443d <dup+0x52>
+		return r;
+  804435:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804438:	e9 a4 01 00 00       	jmp    8045e1 <dup+0x1f6>
+	close(newfdnum);
+  80443d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804440:	89 c7                	mov    %eax,%edi
+  804442:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  804449:	ff ff ff 
+  80444c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804450:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  804452:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804455:	48 98                	cltq
+  804457:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80445d:	48 c1 e0 0c          	shl    $0xc,%rax
+  804461:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  804465:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804469:	48 89 c7             	mov    %rax,%rdi
+  80446c:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  804473:	ff ff ff 
+  804476:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80447a:	ff d0                	call   *%rax
+  80447c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  804480:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804484:	48 89 c7             	mov    %rax,%rdi
+  804487:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  80448e:	ff ff ff 
+  804491:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804495:	ff d0                	call   *%rax
+  804497:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80449b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80449f:	48 c1 e8 15          	shr    $0x15,%rax
+  8044a3:	48 89 c2             	mov    %rax,%rdx
+  8044a6:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8044ad:	ff ff ff 
+  8044b0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8044b4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8044b8:	83 e0 01             	and    $0x1,%eax
+  8044bb:	48 85 c0             	test   %rax,%rax
+  8044be:	74 7f                	je     80453f <dup+0x154>
+  8044c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044c4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8044c8:	48 89 c2             	mov    %rax,%rdx
+  8044cb:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8044d2:	ff ff ff 
+  8044d5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8044d9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8044dd:	83 e0 01             	and    $0x1,%eax
+  8044e0:	48 85 c0             	test   %rax,%rax
+  8044e3:	74 5a                	je     80453f <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8044e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044e9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8044ed:	48 89 c2             	mov    %rax,%rdx
+  8044f0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8044f7:	ff ff ff 
+  8044fa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8044fe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804502:	25 07 0e 00 00       	and    $0xe07,%eax
+  804507:	89 c1                	mov    %eax,%ecx
+  804509:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80450d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804511:	41 89 c8             	mov    %ecx,%r8d
+  804514:	48 89 d1             	mov    %rdx,%rcx
+  804517:	ba 00 00 00 00       	mov    $0x0,%edx
+  80451c:	48 89 c6             	mov    %rax,%rsi
+  80451f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804524:	49 89 df             	mov    %rbx,%r15
+  804527:	48 b8 97 94 ff ff ff 	movabs $0xffffffffffff9497,%rax
+  80452e:	ff ff ff 
+  804531:	48 01 d8             	add    %rbx,%rax
+  804534:	ff d0                	call   *%rax
+  804536:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804539:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80453d:	78 5f                	js     80459e <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80453f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804543:	48 c1 e8 0c          	shr    $0xc,%rax
+  804547:	48 89 c2             	mov    %rax,%rdx
+  80454a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804551:	ff ff ff 
+  804554:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804558:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80455c:	25 07 0e 00 00       	and    $0xe07,%eax
+  804561:	89 c1                	mov    %eax,%ecx
+  804563:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804567:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80456b:	41 89 c8             	mov    %ecx,%r8d
+  80456e:	48 89 d1             	mov    %rdx,%rcx
+  804571:	ba 00 00 00 00       	mov    $0x0,%edx
+  804576:	48 89 c6             	mov    %rax,%rsi
+  804579:	bf 00 00 00 00       	mov    $0x0,%edi
+  80457e:	49 89 df             	mov    %rbx,%r15
+  804581:	48 b8 97 94 ff ff ff 	movabs $0xffffffffffff9497,%rax
+  804588:	ff ff ff 
+  80458b:	48 01 d8             	add    %rbx,%rax
+  80458e:	ff d0                	call   *%rax
+  804590:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804593:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804597:	78 08                	js     8045a1 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  804599:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80459c:	eb 43                	jmp    8045e1 <dup+0x1f6>
+			goto err;
+  80459e:	90                   	nop
+  80459f:	eb 01                	jmp    8045a2 <dup+0x1b7>
+		goto err;
+  8045a1:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  8045a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045a6:	48 89 c6             	mov    %rax,%rsi
+  8045a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ae:	49 89 df             	mov    %rbx,%r15
+  8045b1:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  8045b8:	ff ff ff 
+  8045bb:	48 01 d8             	add    %rbx,%rax
+  8045be:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8045c0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045c4:	48 89 c6             	mov    %rax,%rsi
+  8045c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045cc:	49 89 df             	mov    %rbx,%r15
+  8045cf:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  8045d6:	ff ff ff 
+  8045d9:	48 01 d8             	add    %rbx,%rax
+  8045dc:	ff d0                	call   *%rax
+	return r;
+  8045de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8045e1:	48 83 c4 40          	add    $0x40,%rsp
+  8045e5:	5b                   	pop    %rbx
+  8045e6:	41 5f                	pop    %r15
+  8045e8:	5d                   	pop    %rbp
+  8045e9:	c3                   	ret
+
+00000000008045ea <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8045ea:	55                   	push   %rbp
+  8045eb:	48 89 e5             	mov    %rsp,%rbp
+  8045ee:	41 57                	push   %r15
+  8045f0:	53                   	push   %rbx
+  8045f1:	48 83 ec 40          	sub    $0x40,%rsp
+  8045f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045f5 <read+0xb>
+  8045fc:	49 bb 4b 4a 00 00 00 	movabs $0x4a4b,%r11
+  804603:	00 00 00 
+  804606:	4c 01 db             	add    %r11,%rbx
+  804609:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80460c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804610:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804614:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804618:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80461b:	48 89 d6             	mov    %rdx,%rsi
+  80461e:	89 c7                	mov    %eax,%edi
+  804620:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  804627:	ff ff ff 
+  80462a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80462e:	ff d0                	call   *%rax
+  804630:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804633:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804637:	78 28                	js     804661 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804639:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80463d:	8b 00                	mov    (%rax),%eax
+  80463f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804643:	48 89 d6             	mov    %rdx,%rsi
+  804646:	89 c7                	mov    %eax,%edi
+  804648:	48 b8 09 b2 ff ff ff 	movabs $0xffffffffffffb209,%rax
+  80464f:	ff ff ff 
+  804652:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804656:	ff d0                	call   *%rax
+  804658:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80465b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80465f:	79 08                	jns    804669 <read+0x7f>
+		return r;
+  804661:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804664:	e9 8b 00 00 00       	jmp    8046f4 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804669:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80466d:	8b 40 08             	mov    0x8(%rax),%eax
+  804670:	83 e0 03             	and    $0x3,%eax
+  804673:	83 f8 01             	cmp    $0x1,%eax
+  804676:	75 4b                	jne    8046c3 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804678:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80467f:	ff ff ff 
+  804682:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804686:	48 8b 00             	mov    (%rax),%rax
+  804689:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80468f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804692:	89 c6                	mov    %eax,%esi
+  804694:	48 b8 ef e6 ff ff ff 	movabs $0xffffffffffffe6ef,%rax
+  80469b:	ff ff ff 
+  80469e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046a2:	48 89 c7             	mov    %rax,%rdi
+  8046a5:	49 89 df             	mov    %rbx,%r15
+  8046a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ad:	48 b9 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rcx
+  8046b4:	ff ff ff 
+  8046b7:	48 01 d9             	add    %rbx,%rcx
+  8046ba:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8046bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8046c1:	eb 31                	jmp    8046f4 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8046c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046c7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8046cb:	48 85 c0             	test   %rax,%rax
+  8046ce:	75 07                	jne    8046d7 <read+0xed>
+		return -E_NOT_SUPP;
+  8046d0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8046d5:	eb 1d                	jmp    8046f4 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8046d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046db:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8046df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046e3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8046e7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8046eb:	48 89 ce             	mov    %rcx,%rsi
+  8046ee:	48 89 c7             	mov    %rax,%rdi
+  8046f1:	41 ff d0             	call   *%r8
+}
+  8046f4:	48 83 c4 40          	add    $0x40,%rsp
+  8046f8:	5b                   	pop    %rbx
+  8046f9:	41 5f                	pop    %r15
+  8046fb:	5d                   	pop    %rbp
+  8046fc:	c3                   	ret
+
+00000000008046fd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8046fd:	55                   	push   %rbp
+  8046fe:	48 89 e5             	mov    %rsp,%rbp
+  804701:	53                   	push   %rbx
+  804702:	48 83 ec 38          	sub    $0x38,%rsp
+  804706:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804706 <readn+0x9>
+  80470d:	49 bb 3a 49 00 00 00 	movabs $0x493a,%r11
+  804714:	00 00 00 
+  804717:	4c 01 db             	add    %r11,%rbx
+  80471a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80471d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804721:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  804725:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80472c:	eb 4b                	jmp    804779 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80472e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804731:	48 98                	cltq
+  804733:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804737:	48 29 c2             	sub    %rax,%rdx
+  80473a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80473d:	48 63 c8             	movslq %eax,%rcx
+  804740:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804744:	48 01 c1             	add    %rax,%rcx
+  804747:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80474a:	48 89 ce             	mov    %rcx,%rsi
+  80474d:	89 c7                	mov    %eax,%edi
+  80474f:	48 b8 aa b5 ff ff ff 	movabs $0xffffffffffffb5aa,%rax
+  804756:	ff ff ff 
+  804759:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80475d:	ff d0                	call   *%rax
+  80475f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  804762:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804766:	79 05                	jns    80476d <readn+0x70>
+			return m;
+  804768:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80476b:	eb 1d                	jmp    80478a <readn+0x8d>
+		if (m == 0)
+  80476d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804771:	74 13                	je     804786 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  804773:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804776:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804779:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80477c:	48 98                	cltq
+  80477e:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  804782:	72 aa                	jb     80472e <readn+0x31>
+  804784:	eb 01                	jmp    804787 <readn+0x8a>
+			break;
+  804786:	90                   	nop
+	}
+	return tot;
+  804787:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80478a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80478e:	c9                   	leave
+  80478f:	c3                   	ret
+
+0000000000804790 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  804790:	55                   	push   %rbp
+  804791:	48 89 e5             	mov    %rsp,%rbp
+  804794:	41 57                	push   %r15
+  804796:	53                   	push   %rbx
+  804797:	48 83 ec 40          	sub    $0x40,%rsp
+  80479b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80479b <write+0xb>
+  8047a2:	49 bb a5 48 00 00 00 	movabs $0x48a5,%r11
+  8047a9:	00 00 00 
+  8047ac:	4c 01 db             	add    %r11,%rbx
+  8047af:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8047b2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8047b6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8047ba:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8047be:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8047c1:	48 89 d6             	mov    %rdx,%rsi
+  8047c4:	89 c7                	mov    %eax,%edi
+  8047c6:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  8047cd:	ff ff ff 
+  8047d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047d4:	ff d0                	call   *%rax
+  8047d6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047dd:	78 28                	js     804807 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8047df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047e3:	8b 00                	mov    (%rax),%eax
+  8047e5:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8047e9:	48 89 d6             	mov    %rdx,%rsi
+  8047ec:	89 c7                	mov    %eax,%edi
+  8047ee:	48 b8 09 b2 ff ff ff 	movabs $0xffffffffffffb209,%rax
+  8047f5:	ff ff ff 
+  8047f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047fc:	ff d0                	call   *%rax
+  8047fe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804801:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804805:	79 08                	jns    80480f <write+0x7f>
+		return r;
+  804807:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80480a:	e9 8a 00 00 00       	jmp    804899 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80480f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804813:	8b 40 08             	mov    0x8(%rax),%eax
+  804816:	83 e0 03             	and    $0x3,%eax
+  804819:	85 c0                	test   %eax,%eax
+  80481b:	75 4b                	jne    804868 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80481d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804824:	ff ff ff 
+  804827:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80482b:	48 8b 00             	mov    (%rax),%rax
+  80482e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804834:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804837:	89 c6                	mov    %eax,%esi
+  804839:	48 b8 0b e7 ff ff ff 	movabs $0xffffffffffffe70b,%rax
+  804840:	ff ff ff 
+  804843:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804847:	48 89 c7             	mov    %rax,%rdi
+  80484a:	49 89 df             	mov    %rbx,%r15
+  80484d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804852:	48 b9 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rcx
+  804859:	ff ff ff 
+  80485c:	48 01 d9             	add    %rbx,%rcx
+  80485f:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804861:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804866:	eb 31                	jmp    804899 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  804868:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80486c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804870:	48 85 c0             	test   %rax,%rax
+  804873:	75 07                	jne    80487c <write+0xec>
+		return -E_NOT_SUPP;
+  804875:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80487a:	eb 1d                	jmp    804899 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  80487c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804880:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  804884:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804888:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80488c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804890:	48 89 ce             	mov    %rcx,%rsi
+  804893:	48 89 c7             	mov    %rax,%rdi
+  804896:	41 ff d0             	call   *%r8
+}
+  804899:	48 83 c4 40          	add    $0x40,%rsp
+  80489d:	5b                   	pop    %rbx
+  80489e:	41 5f                	pop    %r15
+  8048a0:	5d                   	pop    %rbp
+  8048a1:	c3                   	ret
+
+00000000008048a2 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8048a2:	55                   	push   %rbp
+  8048a3:	48 89 e5             	mov    %rsp,%rbp
+  8048a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8048aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8048aa <seek+0x8>
+  8048b1:	49 bb 96 47 00 00 00 	movabs $0x4796,%r11
+  8048b8:	00 00 00 
+  8048bb:	4c 01 d8             	add    %r11,%rax
+  8048be:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8048c1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8048c4:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8048c8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8048cb:	48 89 ce             	mov    %rcx,%rsi
+  8048ce:	89 d7                	mov    %edx,%edi
+  8048d0:	48 ba 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rdx
+  8048d7:	ff ff ff 
+  8048da:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8048de:	ff d0                	call   *%rax
+  8048e0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048e3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048e7:	79 05                	jns    8048ee <seek+0x4c>
+		return r;
+  8048e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048ec:	eb 0f                	jmp    8048fd <seek+0x5b>
+	fd->fd_offset = offset;
+  8048ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048f2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8048f5:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8048f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048fd:	c9                   	leave
+  8048fe:	c3                   	ret
+
+00000000008048ff <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8048ff:	55                   	push   %rbp
+  804900:	48 89 e5             	mov    %rsp,%rbp
+  804903:	41 57                	push   %r15
+  804905:	53                   	push   %rbx
+  804906:	48 83 ec 30          	sub    $0x30,%rsp
+  80490a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80490a <ftruncate+0xb>
+  804911:	49 bb 36 47 00 00 00 	movabs $0x4736,%r11
+  804918:	00 00 00 
+  80491b:	4c 01 db             	add    %r11,%rbx
+  80491e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804921:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804924:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804928:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80492b:	48 89 d6             	mov    %rdx,%rsi
+  80492e:	89 c7                	mov    %eax,%edi
+  804930:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  804937:	ff ff ff 
+  80493a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80493e:	ff d0                	call   *%rax
+  804940:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804943:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804947:	78 28                	js     804971 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804949:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80494d:	8b 00                	mov    (%rax),%eax
+  80494f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804953:	48 89 d6             	mov    %rdx,%rsi
+  804956:	89 c7                	mov    %eax,%edi
+  804958:	48 b8 09 b2 ff ff ff 	movabs $0xffffffffffffb209,%rax
+  80495f:	ff ff ff 
+  804962:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804966:	ff d0                	call   *%rax
+  804968:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80496b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80496f:	79 08                	jns    804979 <ftruncate+0x7a>
+		return r;
+  804971:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804974:	e9 83 00 00 00       	jmp    8049fc <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804979:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80497d:	8b 40 08             	mov    0x8(%rax),%eax
+  804980:	83 e0 03             	and    $0x3,%eax
+  804983:	85 c0                	test   %eax,%eax
+  804985:	75 4b                	jne    8049d2 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804987:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80498e:	ff ff ff 
+  804991:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804995:	48 8b 00             	mov    (%rax),%rax
+  804998:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80499e:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8049a1:	89 c6                	mov    %eax,%esi
+  8049a3:	48 b8 28 e7 ff ff ff 	movabs $0xffffffffffffe728,%rax
+  8049aa:	ff ff ff 
+  8049ad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049b1:	48 89 c7             	mov    %rax,%rdi
+  8049b4:	49 89 df             	mov    %rbx,%r15
+  8049b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049bc:	48 b9 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rcx
+  8049c3:	ff ff ff 
+  8049c6:	48 01 d9             	add    %rbx,%rcx
+  8049c9:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8049cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8049d0:	eb 2a                	jmp    8049fc <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8049d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049d6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8049da:	48 85 c0             	test   %rax,%rax
+  8049dd:	75 07                	jne    8049e6 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8049df:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8049e4:	eb 16                	jmp    8049fc <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8049e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049ea:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8049ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049f2:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8049f5:	89 d6                	mov    %edx,%esi
+  8049f7:	48 89 c7             	mov    %rax,%rdi
+  8049fa:	ff d1                	call   *%rcx
+}
+  8049fc:	48 83 c4 30          	add    $0x30,%rsp
+  804a00:	5b                   	pop    %rbx
+  804a01:	41 5f                	pop    %r15
+  804a03:	5d                   	pop    %rbp
+  804a04:	c3                   	ret
+
+0000000000804a05 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804a05:	55                   	push   %rbp
+  804a06:	48 89 e5             	mov    %rsp,%rbp
+  804a09:	53                   	push   %rbx
+  804a0a:	48 83 ec 38          	sub    $0x38,%rsp
+  804a0e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a0e <fstat+0x9>
+  804a15:	49 bb 32 46 00 00 00 	movabs $0x4632,%r11
+  804a1c:	00 00 00 
+  804a1f:	4c 01 db             	add    %r11,%rbx
+  804a22:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804a25:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804a29:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804a2d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804a30:	48 89 d6             	mov    %rdx,%rsi
+  804a33:	89 c7                	mov    %eax,%edi
+  804a35:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  804a3c:	ff ff ff 
+  804a3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a43:	ff d0                	call   *%rax
+  804a45:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a48:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a4c:	78 28                	js     804a76 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804a4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a52:	8b 00                	mov    (%rax),%eax
+  804a54:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804a58:	48 89 d6             	mov    %rdx,%rsi
+  804a5b:	89 c7                	mov    %eax,%edi
+  804a5d:	48 b8 09 b2 ff ff ff 	movabs $0xffffffffffffb209,%rax
+  804a64:	ff ff ff 
+  804a67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a6b:	ff d0                	call   *%rax
+  804a6d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a70:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a74:	79 05                	jns    804a7b <fstat+0x76>
+		return r;
+  804a76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a79:	eb 5e                	jmp    804ad9 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804a7b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a7f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804a83:	48 85 c0             	test   %rax,%rax
+  804a86:	75 07                	jne    804a8f <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804a88:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804a8d:	eb 4a                	jmp    804ad9 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804a8f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a93:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804a96:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a9a:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804aa1:	00 00 00 
+	stat->st_isdir = 0;
+  804aa4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aa8:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804aaf:	00 00 00 
+	stat->st_dev = dev;
+  804ab2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804ab6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aba:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804ac1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ac5:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804ac9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804acd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804ad1:	48 89 d6             	mov    %rdx,%rsi
+  804ad4:	48 89 c7             	mov    %rax,%rdi
+  804ad7:	ff d1                	call   *%rcx
+}
+  804ad9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804add:	c9                   	leave
+  804ade:	c3                   	ret
+
+0000000000804adf <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804adf:	55                   	push   %rbp
+  804ae0:	48 89 e5             	mov    %rsp,%rbp
+  804ae3:	41 57                	push   %r15
+  804ae5:	53                   	push   %rbx
+  804ae6:	48 83 ec 20          	sub    $0x20,%rsp
+  804aea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804aea <stat+0xb>
+  804af1:	49 bb 56 45 00 00 00 	movabs $0x4556,%r11
+  804af8:	00 00 00 
+  804afb:	4c 01 db             	add    %r11,%rbx
+  804afe:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b02:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804b06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b0a:	be 00 00 00 00       	mov    $0x0,%esi
+  804b0f:	48 89 c7             	mov    %rax,%rdi
+  804b12:	49 89 df             	mov    %rbx,%r15
+  804b15:	48 b8 79 bd ff ff ff 	movabs $0xffffffffffffbd79,%rax
+  804b1c:	ff ff ff 
+  804b1f:	48 01 d8             	add    %rbx,%rax
+  804b22:	ff d0                	call   *%rax
+  804b24:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b27:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b2b:	79 05                	jns    804b32 <stat+0x53>
+		return fd;
+  804b2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b30:	eb 37                	jmp    804b69 <stat+0x8a>
+	r = fstat(fd, stat);
+  804b32:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804b36:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b39:	48 89 d6             	mov    %rdx,%rsi
+  804b3c:	89 c7                	mov    %eax,%edi
+  804b3e:	48 b8 c5 b9 ff ff ff 	movabs $0xffffffffffffb9c5,%rax
+  804b45:	ff ff ff 
+  804b48:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b4c:	ff d0                	call   *%rax
+  804b4e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  804b51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b54:	89 c7                	mov    %eax,%edi
+  804b56:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  804b5d:	ff ff ff 
+  804b60:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b64:	ff d0                	call   *%rax
+	return r;
+  804b66:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804b69:	48 83 c4 20          	add    $0x20,%rsp
+  804b6d:	5b                   	pop    %rbx
+  804b6e:	41 5f                	pop    %r15
+  804b70:	5d                   	pop    %rbp
+  804b71:	c3                   	ret
+
+0000000000804b72 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  804b72:	55                   	push   %rbp
+  804b73:	48 89 e5             	mov    %rsp,%rbp
+  804b76:	41 57                	push   %r15
+  804b78:	53                   	push   %rbx
+  804b79:	48 83 ec 10          	sub    $0x10,%rsp
+  804b7d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b7d <fsipc+0xb>
+  804b84:	49 bb c3 44 00 00 00 	movabs $0x44c3,%r11
+  804b8b:	00 00 00 
+  804b8e:	4c 01 db             	add    %r11,%rbx
+  804b91:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804b94:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804b98:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804b9f:	00 00 00 
+  804ba2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ba5:	85 c0                	test   %eax,%eax
+  804ba7:	75 24                	jne    804bcd <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804ba9:	bf 01 00 00 00       	mov    $0x1,%edi
+  804bae:	49 89 df             	mov    %rbx,%r15
+  804bb1:	48 b8 a4 ae ff ff ff 	movabs $0xffffffffffffaea4,%rax
+  804bb8:	ff ff ff 
+  804bbb:	48 01 d8             	add    %rbx,%rax
+  804bbe:	ff d0                	call   *%rax
+  804bc0:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804bc7:	00 00 00 
+  804bca:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  804bcd:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804bd4:	00 00 00 
+  804bd7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804bda:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804bde:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804be1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804be7:	49 89 d0             	mov    %rdx,%r8
+  804bea:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804bef:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804bf6:	00 00 00 
+  804bf9:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804bfd:	89 c7                	mov    %eax,%edi
+  804bff:	49 89 df             	mov    %rbx,%r15
+  804c02:	48 b8 c3 a8 ff ff ff 	movabs $0xffffffffffffa8c3,%rax
+  804c09:	ff ff ff 
+  804c0c:	48 01 d8             	add    %rbx,%rax
+  804c0f:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804c11:	48 83 c4 10          	add    $0x10,%rsp
+  804c15:	5b                   	pop    %rbx
+  804c16:	41 5f                	pop    %r15
+  804c18:	5d                   	pop    %rbp
+  804c19:	c3                   	ret
+
+0000000000804c1a <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804c1a:	55                   	push   %rbp
+  804c1b:	48 89 e5             	mov    %rsp,%rbp
+  804c1e:	41 57                	push   %r15
+  804c20:	53                   	push   %rbx
+  804c21:	48 83 ec 20          	sub    $0x20,%rsp
+  804c25:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c25 <fsipc_words+0xb>
+  804c2c:	49 bb 1b 44 00 00 00 	movabs $0x441b,%r11
+  804c33:	00 00 00 
+  804c36:	4c 01 db             	add    %r11,%rbx
+  804c39:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804c3c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804c40:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804c44:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804c4b:	00 00 00 
+  804c4e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c51:	85 c0                	test   %eax,%eax
+  804c53:	75 24                	jne    804c79 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804c55:	bf 01 00 00 00       	mov    $0x1,%edi
+  804c5a:	49 89 df             	mov    %rbx,%r15
+  804c5d:	48 b8 a4 ae ff ff ff 	movabs $0xffffffffffffaea4,%rax
+  804c64:	ff ff ff 
+  804c67:	48 01 d8             	add    %rbx,%rax
+  804c6a:	ff d0                	call   *%rax
+  804c6c:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804c73:	00 00 00 
+  804c76:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804c79:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804c80:	00 00 00 
+  804c83:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c86:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804c8a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804c8e:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804c91:	89 c7                	mov    %eax,%edi
+  804c93:	49 89 df             	mov    %rbx,%r15
+  804c96:	48 b8 ae a9 ff ff ff 	movabs $0xffffffffffffa9ae,%rax
+  804c9d:	ff ff ff 
+  804ca0:	48 01 d8             	add    %rbx,%rax
+  804ca3:	ff d0                	call   *%rax
+}
+  804ca5:	48 83 c4 20          	add    $0x20,%rsp
+  804ca9:	5b                   	pop    %rbx
+  804caa:	41 5f                	pop    %r15
+  804cac:	5d                   	pop    %rbp
+  804cad:	c3                   	ret
+
+0000000000804cae <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804cae:	55                   	push   %rbp
+  804caf:	48 89 e5             	mov    %rsp,%rbp
+  804cb2:	41 57                	push   %r15
+  804cb4:	53                   	push   %rbx
+  804cb5:	48 83 ec 40          	sub    $0x40,%rsp
+  804cb9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cb9 <fsipc_pages+0xb>
+  804cc0:	49 bb 87 43 00 00 00 	movabs $0x4387,%r11
+  804cc7:	00 00 00 
+  804cca:	4c 01 db             	add    %r11,%rbx
+  804ccd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804cd0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804cd4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804cd8:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804cdb:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804ce2:	00 00 00 
+  804ce5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ce8:	85 c0                	test   %eax,%eax
+  804cea:	75 24                	jne    804d10 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804cec:	bf 01 00 00 00       	mov    $0x1,%edi
+  804cf1:	49 89 df             	mov    %rbx,%r15
+  804cf4:	48 b8 a4 ae ff ff ff 	movabs $0xffffffffffffaea4,%rax
+  804cfb:	ff ff ff 
+  804cfe:	48 01 d8             	add    %rbx,%rax
+  804d01:	ff d0                	call   *%rax
+  804d03:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804d0a:	00 00 00 
+  804d0d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804d10:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804d15:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804d19:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804d1c:	48 98                	cltq
+  804d1e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804d22:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804d26:	0f 95 c0             	setne  %al
+  804d29:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804d2c:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804d33:	00 
+  804d34:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804d38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d3c:	48 01 d0             	add    %rdx,%rax
+  804d3f:	48 83 e8 01          	sub    $0x1,%rax
+  804d43:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804d47:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d50:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804d54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d58:	48 29 d0             	sub    %rdx,%rax
+  804d5b:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804d5f:	41 89 c2             	mov    %eax,%r10d
+  804d62:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804d69:	00 00 00 
+  804d6c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804d6f:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804d73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804d77:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804d7a:	48 83 ec 08          	sub    $0x8,%rsp
+  804d7e:	6a 40                	push   $0x40
+  804d80:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804d85:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804d8c:	00 
+  804d8d:	6a 05                	push   $0x5
+  804d8f:	41 89 f9             	mov    %edi,%r9d
+  804d92:	49 89 c8             	mov    %rcx,%r8
+  804d95:	44 89 d1             	mov    %r10d,%ecx
+  804d98:	89 c7                	mov    %eax,%edi
+  804d9a:	49 89 df             	mov    %rbx,%r15
+  804d9d:	48 b8 ac aa ff ff ff 	movabs $0xffffffffffffaaac,%rax
+  804da4:	ff ff ff 
+  804da7:	48 01 d8             	add    %rbx,%rax
+  804daa:	ff d0                	call   *%rax
+  804dac:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804db0:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804db4:	5b                   	pop    %rbx
+  804db5:	41 5f                	pop    %r15
+  804db7:	5d                   	pop    %rbp
+  804db8:	c3                   	ret
+
+0000000000804db9 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804db9:	55                   	push   %rbp
+  804dba:	48 89 e5             	mov    %rsp,%rbp
+  804dbd:	41 57                	push   %r15
+  804dbf:	53                   	push   %rbx
+  804dc0:	48 83 ec 20          	sub    $0x20,%rsp
+  804dc4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804dc4 <open+0xb>
+  804dcb:	49 bb 7c 42 00 00 00 	movabs $0x427c,%r11
+  804dd2:	00 00 00 
+  804dd5:	4c 01 db             	add    %r11,%rbx
+  804dd8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804ddc:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804ddf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804de3:	48 89 c7             	mov    %rax,%rdi
+  804de6:	49 89 df             	mov    %rbx,%r15
+  804de9:	48 b8 e2 86 ff ff ff 	movabs $0xffffffffffff86e2,%rax
+  804df0:	ff ff ff 
+  804df3:	48 01 d8             	add    %rbx,%rax
+  804df6:	ff d0                	call   *%rax
+  804df8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804dfd:	7e 0a                	jle    804e09 <open+0x50>
+		return -E_BAD_PATH;
+  804dff:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804e04:	e9 18 01 00 00       	jmp    804f21 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804e09:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804e0d:	48 89 c7             	mov    %rax,%rdi
+  804e10:	49 89 df             	mov    %rbx,%r15
+  804e13:	48 b8 ad af ff ff ff 	movabs $0xffffffffffffafad,%rax
+  804e1a:	ff ff ff 
+  804e1d:	48 01 d8             	add    %rbx,%rax
+  804e20:	ff d0                	call   *%rax
+  804e22:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e25:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e29:	74 08                	je     804e33 <open+0x7a>
+		return r;
+  804e2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e2e:	e9 ee 00 00 00       	jmp    804f21 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804e33:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804e3a:	00 00 00 
+  804e3d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804e40:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804e47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e4b:	48 89 c6             	mov    %rax,%rsi
+  804e4e:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804e55:	00 00 00 
+  804e58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e5c:	48 89 c7             	mov    %rax,%rdi
+  804e5f:	49 89 df             	mov    %rbx,%r15
+  804e62:	48 b8 76 87 ff ff ff 	movabs $0xffffffffffff8776,%rax
+  804e69:	ff ff ff 
+  804e6c:	48 01 d8             	add    %rbx,%rax
+  804e6f:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804e71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e75:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804e7a:	48 89 c6             	mov    %rax,%rsi
+  804e7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e82:	49 89 df             	mov    %rbx,%r15
+  804e85:	48 b8 32 94 ff ff ff 	movabs $0xffffffffffff9432,%rax
+  804e8c:	ff ff ff 
+  804e8f:	48 01 d8             	add    %rbx,%rax
+  804e92:	ff d0                	call   *%rax
+  804e94:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e97:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e9b:	74 23                	je     804ec0 <open+0x107>
+		fd_close(fd,0);
+  804e9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ea1:	be 00 00 00 00       	mov    $0x0,%esi
+  804ea6:	48 89 c7             	mov    %rax,%rdi
+  804ea9:	49 89 df             	mov    %rbx,%r15
+  804eac:	48 b8 0e b1 ff ff ff 	movabs $0xffffffffffffb10e,%rax
+  804eb3:	ff ff ff 
+  804eb6:	48 01 d8             	add    %rbx,%rax
+  804eb9:	ff d0                	call   *%rax
+		return r;
+  804ebb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ebe:	eb 61                	jmp    804f21 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804ec0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ec4:	48 89 c6             	mov    %rax,%rsi
+  804ec7:	bf 01 00 00 00       	mov    $0x1,%edi
+  804ecc:	48 b8 32 bb ff ff ff 	movabs $0xffffffffffffbb32,%rax
+  804ed3:	ff ff ff 
+  804ed6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804eda:	ff d0                	call   *%rax
+  804edc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804edf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ee3:	74 23                	je     804f08 <open+0x14f>
+		fd_close(fd,0);
+  804ee5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ee9:	be 00 00 00 00       	mov    $0x0,%esi
+  804eee:	48 89 c7             	mov    %rax,%rdi
+  804ef1:	49 89 df             	mov    %rbx,%r15
+  804ef4:	48 b8 0e b1 ff ff ff 	movabs $0xffffffffffffb10e,%rax
+  804efb:	ff ff ff 
+  804efe:	48 01 d8             	add    %rbx,%rax
+  804f01:	ff d0                	call   *%rax
+		return r;
+  804f03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f06:	eb 19                	jmp    804f21 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804f08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f0c:	48 89 c7             	mov    %rax,%rdi
+  804f0f:	49 89 df             	mov    %rbx,%r15
+  804f12:	48 b8 33 af ff ff ff 	movabs $0xffffffffffffaf33,%rax
+  804f19:	ff ff ff 
+  804f1c:	48 01 d8             	add    %rbx,%rax
+  804f1f:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804f21:	48 83 c4 20          	add    $0x20,%rsp
+  804f25:	5b                   	pop    %rbx
+  804f26:	41 5f                	pop    %r15
+  804f28:	5d                   	pop    %rbp
+  804f29:	c3                   	ret
+
+0000000000804f2a <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804f2a:	55                   	push   %rbp
+  804f2b:	48 89 e5             	mov    %rsp,%rbp
+  804f2e:	48 83 ec 20          	sub    $0x20,%rsp
+  804f32:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804f32 <devfile_flush+0x8>
+  804f39:	49 bb 0e 41 00 00 00 	movabs $0x410e,%r11
+  804f40:	00 00 00 
+  804f43:	4c 01 d8             	add    %r11,%rax
+  804f46:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804f4a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f4e:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804f51:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804f54:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804f58:	ba 04 00 00 00       	mov    $0x4,%edx
+  804f5d:	48 89 ce             	mov    %rcx,%rsi
+  804f60:	bf 06 00 00 00       	mov    $0x6,%edi
+  804f65:	48 b9 da bb ff ff ff 	movabs $0xffffffffffffbbda,%rcx
+  804f6c:	ff ff ff 
+  804f6f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804f73:	ff d0                	call   *%rax
+}
+  804f75:	c9                   	leave
+  804f76:	c3                   	ret
+
+0000000000804f77 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804f77:	55                   	push   %rbp
+  804f78:	48 89 e5             	mov    %rsp,%rbp
+  804f7b:	41 57                	push   %r15
+  804f7d:	53                   	push   %rbx
+  804f7e:	48 83 ec 60          	sub    $0x60,%rsp
+  804f82:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f82 <devfile_read+0xb>
+  804f89:	49 bb be 40 00 00 00 	movabs $0x40be,%r11
+  804f90:	00 00 00 
+  804f93:	4c 01 db             	add    %r11,%rbx
+  804f96:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804f9a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804f9e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804fa2:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804fa6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804faa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804fae:	8b 50 0c             	mov    0xc(%rax),%edx
+  804fb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fb5:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804fb7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fbb:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804fbf:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804fc3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804fc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804fcc:	ba 10 00 00 00       	mov    $0x10,%edx
+  804fd1:	48 89 c6             	mov    %rax,%rsi
+  804fd4:	bf 03 00 00 00       	mov    $0x3,%edi
+  804fd9:	48 b8 6e bc ff ff ff 	movabs $0xffffffffffffbc6e,%rax
+  804fe0:	ff ff ff 
+  804fe3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fe7:	ff d0                	call   *%rax
+  804fe9:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804fec:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804ff0:	79 05                	jns    804ff7 <devfile_read+0x80>
+		return r;
+  804ff2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ff5:	eb 64                	jmp    80505b <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804ff7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ffa:	48 63 d0             	movslq %eax,%rdx
+  804ffd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805001:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  805006:	48 01 c1             	add    %rax,%rcx
+  805009:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80500d:	48 89 ce             	mov    %rcx,%rsi
+  805010:	48 89 c7             	mov    %rax,%rdi
+  805013:	49 89 df             	mov    %rbx,%r15
+  805016:	48 b8 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rax
+  80501d:	ff ff ff 
+  805020:	48 01 d8             	add    %rbx,%rax
+  805023:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  805025:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80502c:	ff ff ff 
+  80502f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805033:	48 8b 00             	mov    (%rax),%rax
+  805036:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  80503c:	89 c6                	mov    %eax,%esi
+  80503e:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  805043:	48 89 c7             	mov    %rax,%rdi
+  805046:	49 89 df             	mov    %rbx,%r15
+  805049:	48 b8 5e ae ff ff ff 	movabs $0xffffffffffffae5e,%rax
+  805050:	ff ff ff 
+  805053:	48 01 d8             	add    %rbx,%rax
+  805056:	ff d0                	call   *%rax
+	return r;
+  805058:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  80505b:	48 83 c4 60          	add    $0x60,%rsp
+  80505f:	5b                   	pop    %rbx
+  805060:	41 5f                	pop    %r15
+  805062:	5d                   	pop    %rbp
+  805063:	c3                   	ret
+
+0000000000805064 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805064:	55                   	push   %rbp
+  805065:	48 89 e5             	mov    %rsp,%rbp
+  805068:	41 57                	push   %r15
+  80506a:	53                   	push   %rbx
+  80506b:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  80506f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80506f <devfile_write+0xb>
+  805076:	49 bb d1 3f 00 00 00 	movabs $0x3fd1,%r11
+  80507d:	00 00 00 
+  805080:	4c 01 db             	add    %r11,%rbx
+  805083:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  805087:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  80508b:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  805092:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805096:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  80509a:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  8050a1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8050a5:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  8050ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8050af:	48 63 d0             	movslq %eax,%rdx
+  8050b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050b6:	48 39 c2             	cmp    %rax,%rdx
+  8050b9:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8050bd:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8050c4:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  8050cb:	00 
+  8050cc:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8050d3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050d7:	48 01 d0             	add    %rdx,%rax
+  8050da:	48 83 e8 01          	sub    $0x1,%rax
+  8050de:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8050e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050eb:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8050ef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050f3:	48 29 d0             	sub    %rdx,%rax
+  8050f6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8050fa:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8050fd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805100:	89 c6                	mov    %eax,%esi
+  805102:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  805107:	48 89 c7             	mov    %rax,%rdi
+  80510a:	49 89 df             	mov    %rbx,%r15
+  80510d:	48 b8 18 ae ff ff ff 	movabs $0xffffffffffffae18,%rax
+  805114:	ff ff ff 
+  805117:	48 01 d8             	add    %rbx,%rax
+  80511a:	ff d0                	call   *%rax
+  80511c:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  80511f:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  805123:	79 08                	jns    80512d <devfile_write+0xc9>
+		return r;
+  805125:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  805128:	e9 8f 00 00 00       	jmp    8051bc <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  80512d:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  805134:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  805138:	48 89 c6             	mov    %rax,%rsi
+  80513b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  805140:	48 89 c7             	mov    %rax,%rdi
+  805143:	49 89 df             	mov    %rbx,%r15
+  805146:	48 b8 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rax
+  80514d:	ff ff ff 
+  805150:	48 01 d8             	add    %rbx,%rax
+  805153:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  805155:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  805159:	8b 50 0c             	mov    0xc(%rax),%edx
+  80515c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805160:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  805162:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805166:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80516d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  805171:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  805174:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805178:	89 d1                	mov    %edx,%ecx
+  80517a:	ba 10 00 00 00       	mov    $0x10,%edx
+  80517f:	48 89 c6             	mov    %rax,%rsi
+  805182:	bf 04 00 00 00       	mov    $0x4,%edi
+  805187:	48 b8 6e bc ff ff ff 	movabs $0xffffffffffffbc6e,%rax
+  80518e:	ff ff ff 
+  805191:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805195:	ff d0                	call   *%rax
+  805197:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80519a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80519d:	89 c6                	mov    %eax,%esi
+  80519f:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8051a4:	48 89 c7             	mov    %rax,%rdi
+  8051a7:	49 89 df             	mov    %rbx,%r15
+  8051aa:	48 b8 5e ae ff ff ff 	movabs $0xffffffffffffae5e,%rax
+  8051b1:	ff ff ff 
+  8051b4:	48 01 d8             	add    %rbx,%rax
+  8051b7:	ff d0                	call   *%rax
+	return r;
+  8051b9:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  8051bc:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  8051c0:	5b                   	pop    %rbx
+  8051c1:	41 5f                	pop    %r15
+  8051c3:	5d                   	pop    %rbp
+  8051c4:	c3                   	ret
+
+00000000008051c5 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  8051c5:	55                   	push   %rbp
+  8051c6:	48 89 e5             	mov    %rsp,%rbp
+  8051c9:	41 57                	push   %r15
+  8051cb:	53                   	push   %rbx
+  8051cc:	48 83 ec 20          	sub    $0x20,%rsp
+  8051d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051d0 <devfile_stat+0xb>
+  8051d7:	49 bb 70 3e 00 00 00 	movabs $0x3e70,%r11
+  8051de:	00 00 00 
+  8051e1:	4c 01 db             	add    %r11,%rbx
+  8051e4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8051e8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8051ec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051f0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8051f3:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8051fa:	00 00 00 
+  8051fd:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  805200:	be 00 00 00 00       	mov    $0x0,%esi
+  805205:	bf 05 00 00 00       	mov    $0x5,%edi
+  80520a:	48 b8 32 bb ff ff ff 	movabs $0xffffffffffffbb32,%rax
+  805211:	ff ff ff 
+  805214:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805218:	ff d0                	call   *%rax
+  80521a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80521d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805221:	79 05                	jns    805228 <devfile_stat+0x63>
+		return r;
+  805223:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805226:	eb 65                	jmp    80528d <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  805228:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80522c:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805233:	00 00 00 
+  805236:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80523a:	48 89 d6             	mov    %rdx,%rsi
+  80523d:	48 89 c7             	mov    %rax,%rdi
+  805240:	49 89 df             	mov    %rbx,%r15
+  805243:	48 b8 76 87 ff ff ff 	movabs $0xffffffffffff8776,%rax
+  80524a:	ff ff ff 
+  80524d:	48 01 d8             	add    %rbx,%rax
+  805250:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  805252:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  805259:	00 00 00 
+  80525c:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  805263:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805267:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80526d:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  805274:	00 00 00 
+  805277:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  80527e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805282:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  805288:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80528d:	48 83 c4 20          	add    $0x20,%rsp
+  805291:	5b                   	pop    %rbx
+  805292:	41 5f                	pop    %r15
+  805294:	5d                   	pop    %rbp
+  805295:	c3                   	ret
+
+0000000000805296 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  805296:	55                   	push   %rbp
+  805297:	48 89 e5             	mov    %rsp,%rbp
+  80529a:	48 83 ec 20          	sub    $0x20,%rsp
+  80529e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80529e <devfile_trunc+0x8>
+  8052a5:	49 bb a2 3d 00 00 00 	movabs $0x3da2,%r11
+  8052ac:	00 00 00 
+  8052af:	4c 01 d8             	add    %r11,%rax
+  8052b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8052b6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  8052b9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8052bd:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8052c0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  8052c3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8052c6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8052c9:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8052cd:	ba 08 00 00 00       	mov    $0x8,%edx
+  8052d2:	48 89 ce             	mov    %rcx,%rsi
+  8052d5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8052da:	48 b9 da bb ff ff ff 	movabs $0xffffffffffffbbda,%rcx
+  8052e1:	ff ff ff 
+  8052e4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8052e8:	ff d0                	call   *%rax
+}
+  8052ea:	c9                   	leave
+  8052eb:	c3                   	ret
+
+00000000008052ec <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8052ec:	55                   	push   %rbp
+  8052ed:	48 89 e5             	mov    %rsp,%rbp
+  8052f0:	41 57                	push   %r15
+  8052f2:	53                   	push   %rbx
+  8052f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8052f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052f7 <remove+0xb>
+  8052fe:	49 bb 49 3d 00 00 00 	movabs $0x3d49,%r11
+  805305:	00 00 00 
+  805308:	4c 01 db             	add    %r11,%rbx
+  80530b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  80530f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805313:	48 89 c7             	mov    %rax,%rdi
+  805316:	49 89 df             	mov    %rbx,%r15
+  805319:	48 b8 e2 86 ff ff ff 	movabs $0xffffffffffff86e2,%rax
+  805320:	ff ff ff 
+  805323:	48 01 d8             	add    %rbx,%rax
+  805326:	ff d0                	call   *%rax
+  805328:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80532d:	7e 07                	jle    805336 <remove+0x4a>
+		return -E_BAD_PATH;
+  80532f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  805334:	eb 44                	jmp    80537a <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  805336:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80533a:	48 89 c6             	mov    %rax,%rsi
+  80533d:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  805344:	00 00 00 
+  805347:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80534b:	48 89 c7             	mov    %rax,%rdi
+  80534e:	49 89 df             	mov    %rbx,%r15
+  805351:	48 b8 76 87 ff ff ff 	movabs $0xffffffffffff8776,%rax
+  805358:	ff ff ff 
+  80535b:	48 01 d8             	add    %rbx,%rax
+  80535e:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  805360:	be 00 00 00 00       	mov    $0x0,%esi
+  805365:	bf 07 00 00 00       	mov    $0x7,%edi
+  80536a:	48 b8 32 bb ff ff ff 	movabs $0xffffffffffffbb32,%rax
+  805371:	ff ff ff 
+  805374:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805378:	ff d0                	call   *%rax
+}
+  80537a:	48 83 c4 10          	add    $0x10,%rsp
+  80537e:	5b                   	pop    %rbx
+  80537f:	41 5f                	pop    %r15
+  805381:	5d                   	pop    %rbp
+  805382:	c3                   	ret
+
+0000000000805383 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  805383:	55                   	push   %rbp
+  805384:	48 89 e5             	mov    %rsp,%rbp
+  805387:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805387 <sync+0x4>
+  80538e:	49 bb b9 3c 00 00 00 	movabs $0x3cb9,%r11
+  805395:	00 00 00 
+  805398:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80539b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8053a5:	bf 08 00 00 00       	mov    $0x8,%edi
+  8053aa:	48 b9 da bb ff ff ff 	movabs $0xffffffffffffbbda,%rcx
+  8053b1:	ff ff ff 
+  8053b4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8053b8:	ff d0                	call   *%rax
+}
+  8053ba:	5d                   	pop    %rbp
+  8053bb:	c3                   	ret
+
+00000000008053bc <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  8053bc:	55                   	push   %rbp
+  8053bd:	48 89 e5             	mov    %rsp,%rbp
+  8053c0:	41 57                	push   %r15
+  8053c2:	53                   	push   %rbx
+  8053c3:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8053ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053ca <copy+0xe>
+  8053d1:	49 bb 76 3c 00 00 00 	movabs $0x3c76,%r11
+  8053d8:	00 00 00 
+  8053db:	4c 01 db             	add    %r11,%rbx
+  8053de:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8053e5:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8053ec:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8053f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8053f8:	48 89 c7             	mov    %rax,%rdi
+  8053fb:	48 b8 79 bd ff ff ff 	movabs $0xffffffffffffbd79,%rax
+  805402:	ff ff ff 
+  805405:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805409:	ff d0                	call   *%rax
+  80540b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  80540e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805412:	79 35                	jns    805449 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  805414:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805417:	89 c6                	mov    %eax,%esi
+  805419:	48 b8 4e e7 ff ff ff 	movabs $0xffffffffffffe74e,%rax
+  805420:	ff ff ff 
+  805423:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805427:	48 89 c7             	mov    %rax,%rdi
+  80542a:	49 89 df             	mov    %rbx,%r15
+  80542d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805432:	48 ba b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rdx
+  805439:	ff ff ff 
+  80543c:	48 01 da             	add    %rbx,%rdx
+  80543f:	ff d2                	call   *%rdx
+		return fd_src;
+  805441:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805444:	e9 d7 01 00 00       	jmp    805620 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  805449:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  805450:	be 01 01 00 00       	mov    $0x101,%esi
+  805455:	48 89 c7             	mov    %rax,%rdi
+  805458:	48 b8 79 bd ff ff ff 	movabs $0xffffffffffffbd79,%rax
+  80545f:	ff ff ff 
+  805462:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805466:	ff d0                	call   *%rax
+  805468:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  80546b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80546f:	0f 89 df 00 00 00    	jns    805554 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  805475:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805478:	89 c6                	mov    %eax,%esi
+  80547a:	48 b8 64 e7 ff ff ff 	movabs $0xffffffffffffe764,%rax
+  805481:	ff ff ff 
+  805484:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805488:	48 89 c7             	mov    %rax,%rdi
+  80548b:	49 89 df             	mov    %rbx,%r15
+  80548e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805493:	48 ba b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rdx
+  80549a:	ff ff ff 
+  80549d:	48 01 da             	add    %rbx,%rdx
+  8054a0:	ff d2                	call   *%rdx
+		close(fd_src);
+  8054a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054a5:	89 c7                	mov    %eax,%edi
+  8054a7:	49 89 df             	mov    %rbx,%r15
+  8054aa:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  8054b1:	ff ff ff 
+  8054b4:	48 01 d8             	add    %rbx,%rax
+  8054b7:	ff d0                	call   *%rax
+		return fd_dest;
+  8054b9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8054bc:	e9 5f 01 00 00       	jmp    805620 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  8054c1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8054c4:	48 63 d0             	movslq %eax,%rdx
+  8054c7:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8054ce:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8054d1:	48 89 ce             	mov    %rcx,%rsi
+  8054d4:	89 c7                	mov    %eax,%edi
+  8054d6:	49 89 df             	mov    %rbx,%r15
+  8054d9:	48 b8 50 b7 ff ff ff 	movabs $0xffffffffffffb750,%rax
+  8054e0:	ff ff ff 
+  8054e3:	48 01 d8             	add    %rbx,%rax
+  8054e6:	ff d0                	call   *%rax
+  8054e8:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8054eb:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8054ef:	79 63                	jns    805554 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8054f1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8054f4:	89 c6                	mov    %eax,%esi
+  8054f6:	48 b8 7e e7 ff ff ff 	movabs $0xffffffffffffe77e,%rax
+  8054fd:	ff ff ff 
+  805500:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805504:	48 89 c7             	mov    %rax,%rdi
+  805507:	49 89 df             	mov    %rbx,%r15
+  80550a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80550f:	48 ba b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rdx
+  805516:	ff ff ff 
+  805519:	48 01 da             	add    %rbx,%rdx
+  80551c:	ff d2                	call   *%rdx
+			close(fd_src);
+  80551e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805521:	89 c7                	mov    %eax,%edi
+  805523:	49 89 df             	mov    %rbx,%r15
+  805526:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  80552d:	ff ff ff 
+  805530:	48 01 d8             	add    %rbx,%rax
+  805533:	ff d0                	call   *%rax
+			close(fd_dest);
+  805535:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805538:	89 c7                	mov    %eax,%edi
+  80553a:	49 89 df             	mov    %rbx,%r15
+  80553d:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  805544:	ff ff ff 
+  805547:	48 01 d8             	add    %rbx,%rax
+  80554a:	ff d0                	call   *%rax
+			return write_size;
+  80554c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80554f:	e9 cc 00 00 00       	jmp    805620 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  805554:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80555b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80555e:	ba 00 02 00 00       	mov    $0x200,%edx
+  805563:	48 89 ce             	mov    %rcx,%rsi
+  805566:	89 c7                	mov    %eax,%edi
+  805568:	49 89 df             	mov    %rbx,%r15
+  80556b:	48 b8 aa b5 ff ff ff 	movabs $0xffffffffffffb5aa,%rax
+  805572:	ff ff ff 
+  805575:	48 01 d8             	add    %rbx,%rax
+  805578:	ff d0                	call   *%rax
+  80557a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80557d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805581:	0f 8f 3a ff ff ff    	jg     8054c1 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805587:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80558b:	79 60                	jns    8055ed <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  80558d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805590:	89 c6                	mov    %eax,%esi
+  805592:	48 b8 91 e7 ff ff ff 	movabs $0xffffffffffffe791,%rax
+  805599:	ff ff ff 
+  80559c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055a0:	48 89 c7             	mov    %rax,%rdi
+  8055a3:	49 89 df             	mov    %rbx,%r15
+  8055a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055ab:	48 ba b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rdx
+  8055b2:	ff ff ff 
+  8055b5:	48 01 da             	add    %rbx,%rdx
+  8055b8:	ff d2                	call   *%rdx
+		close(fd_src);
+  8055ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055bd:	89 c7                	mov    %eax,%edi
+  8055bf:	49 89 df             	mov    %rbx,%r15
+  8055c2:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  8055c9:	ff ff ff 
+  8055cc:	48 01 d8             	add    %rbx,%rax
+  8055cf:	ff d0                	call   *%rax
+		close(fd_dest);
+  8055d1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8055d4:	89 c7                	mov    %eax,%edi
+  8055d6:	49 89 df             	mov    %rbx,%r15
+  8055d9:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  8055e0:	ff ff ff 
+  8055e3:	48 01 d8             	add    %rbx,%rax
+  8055e6:	ff d0                	call   *%rax
+		return read_size;
+  8055e8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8055eb:	eb 33                	jmp    805620 <copy+0x264>
+	}
+	close(fd_src);
+  8055ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055f0:	89 c7                	mov    %eax,%edi
+  8055f2:	49 89 df             	mov    %rbx,%r15
+  8055f5:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  8055fc:	ff ff ff 
+  8055ff:	48 01 d8             	add    %rbx,%rax
+  805602:	ff d0                	call   *%rax
+	close(fd_dest);
+  805604:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805607:	89 c7                	mov    %eax,%edi
+  805609:	49 89 df             	mov    %rbx,%r15
+  80560c:	48 b8 f2 b2 ff ff ff 	movabs $0xffffffffffffb2f2,%rax
+  805613:	ff ff ff 
+  805616:	48 01 d8             	add    %rbx,%rax
+  805619:	ff d0                	call   *%rax
+	return 0;
+  80561b:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  805620:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  805627:	5b                   	pop    %rbx
+  805628:	41 5f                	pop    %r15
+  80562a:	5d                   	pop    %rbp
+  80562b:	c3                   	ret
+
+000000000080562c <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  80562c:	55                   	push   %rbp
+  80562d:	48 89 e5             	mov    %rsp,%rbp
+  805630:	41 57                	push   %r15
+  805632:	53                   	push   %rbx
+  805633:	48 83 ec 20          	sub    $0x20,%rsp
+  805637:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805637 <fd2sockid+0xb>
+  80563e:	49 bb 09 3a 00 00 00 	movabs $0x3a09,%r11
+  805645:	00 00 00 
+  805648:	4c 01 db             	add    %r11,%rbx
+  80564b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80564e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805652:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805655:	48 89 d6             	mov    %rdx,%rsi
+  805658:	89 c7                	mov    %eax,%edi
+  80565a:	49 89 df             	mov    %rbx,%r15
+  80565d:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  805664:	ff ff ff 
+  805667:	48 01 d8             	add    %rbx,%rax
+  80566a:	ff d0                	call   *%rax
+  80566c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80566f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805673:	79 05                	jns    80567a <fd2sockid+0x4e>
+		return r;
+  805675:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805678:	eb 25                	jmp    80569f <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80567a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80567e:	8b 10                	mov    (%rax),%edx
+  805680:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  805687:	00 00 00 
+  80568a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80568d:	39 c2                	cmp    %eax,%edx
+  80568f:	74 07                	je     805698 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  805691:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  805696:	eb 07                	jmp    80569f <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  805698:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80569c:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  80569f:	48 83 c4 20          	add    $0x20,%rsp
+  8056a3:	5b                   	pop    %rbx
+  8056a4:	41 5f                	pop    %r15
+  8056a6:	5d                   	pop    %rbp
+  8056a7:	c3                   	ret
+
+00000000008056a8 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8056a8:	55                   	push   %rbp
+  8056a9:	48 89 e5             	mov    %rsp,%rbp
+  8056ac:	41 57                	push   %r15
+  8056ae:	53                   	push   %rbx
+  8056af:	48 83 ec 20          	sub    $0x20,%rsp
+  8056b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056b3 <alloc_sockfd+0xb>
+  8056ba:	49 bb 8d 39 00 00 00 	movabs $0x398d,%r11
+  8056c1:	00 00 00 
+  8056c4:	4c 01 db             	add    %r11,%rbx
+  8056c7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8056ca:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8056ce:	48 89 c7             	mov    %rax,%rdi
+  8056d1:	49 89 df             	mov    %rbx,%r15
+  8056d4:	48 b8 ad af ff ff ff 	movabs $0xffffffffffffafad,%rax
+  8056db:	ff ff ff 
+  8056de:	48 01 d8             	add    %rbx,%rax
+  8056e1:	ff d0                	call   *%rax
+  8056e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056ea:	78 2c                	js     805718 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8056ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056f0:	ba 07 04 00 00       	mov    $0x407,%edx
+  8056f5:	48 89 c6             	mov    %rax,%rsi
+  8056f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056fd:	49 89 df             	mov    %rbx,%r15
+  805700:	48 b8 32 94 ff ff ff 	movabs $0xffffffffffff9432,%rax
+  805707:	ff ff ff 
+  80570a:	48 01 d8             	add    %rbx,%rax
+  80570d:	ff d0                	call   *%rax
+  80570f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805712:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805716:	79 1c                	jns    805734 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805718:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80571b:	89 c7                	mov    %eax,%edi
+  80571d:	49 89 df             	mov    %rbx,%r15
+  805720:	48 b8 5c ce ff ff ff 	movabs $0xffffffffffffce5c,%rax
+  805727:	ff ff ff 
+  80572a:	48 01 d8             	add    %rbx,%rax
+  80572d:	ff d0                	call   *%rax
+		return r;
+  80572f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805732:	eb 41                	jmp    805775 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  805734:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805738:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  80573f:	00 00 00 
+  805742:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805745:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805747:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80574b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  805752:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805756:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805759:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  80575c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805760:	48 89 c7             	mov    %rax,%rdi
+  805763:	49 89 df             	mov    %rbx,%r15
+  805766:	48 b8 33 af ff ff ff 	movabs $0xffffffffffffaf33,%rax
+  80576d:	ff ff ff 
+  805770:	48 01 d8             	add    %rbx,%rax
+  805773:	ff d0                	call   *%rax
+}
+  805775:	48 83 c4 20          	add    $0x20,%rsp
+  805779:	5b                   	pop    %rbx
+  80577a:	41 5f                	pop    %r15
+  80577c:	5d                   	pop    %rbp
+  80577d:	c3                   	ret
+
+000000000080577e <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80577e:	55                   	push   %rbp
+  80577f:	48 89 e5             	mov    %rsp,%rbp
+  805782:	41 57                	push   %r15
+  805784:	53                   	push   %rbx
+  805785:	48 83 ec 30          	sub    $0x30,%rsp
+  805789:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805789 <accept+0xb>
+  805790:	49 bb b7 38 00 00 00 	movabs $0x38b7,%r11
+  805797:	00 00 00 
+  80579a:	4c 01 db             	add    %r11,%rbx
+  80579d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8057a0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8057a4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8057a8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8057ab:	89 c7                	mov    %eax,%edi
+  8057ad:	48 b8 ec c5 ff ff ff 	movabs $0xffffffffffffc5ec,%rax
+  8057b4:	ff ff ff 
+  8057b7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057bb:	ff d0                	call   *%rax
+  8057bd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057c4:	79 05                	jns    8057cb <accept+0x4d>
+		return r;
+  8057c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057c9:	eb 45                	jmp    805810 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8057cb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8057cf:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8057d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057d6:	48 89 ce             	mov    %rcx,%rsi
+  8057d9:	89 c7                	mov    %eax,%edi
+  8057db:	49 89 df             	mov    %rbx,%r15
+  8057de:	48 b8 ca cc ff ff ff 	movabs $0xffffffffffffccca,%rax
+  8057e5:	ff ff ff 
+  8057e8:	48 01 d8             	add    %rbx,%rax
+  8057eb:	ff d0                	call   *%rax
+  8057ed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057f4:	79 05                	jns    8057fb <accept+0x7d>
+		return r;
+  8057f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057f9:	eb 15                	jmp    805810 <accept+0x92>
+	return alloc_sockfd(r);
+  8057fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057fe:	89 c7                	mov    %eax,%edi
+  805800:	48 b8 68 c6 ff ff ff 	movabs $0xffffffffffffc668,%rax
+  805807:	ff ff ff 
+  80580a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80580e:	ff d0                	call   *%rax
+}
+  805810:	48 83 c4 30          	add    $0x30,%rsp
+  805814:	5b                   	pop    %rbx
+  805815:	41 5f                	pop    %r15
+  805817:	5d                   	pop    %rbp
+  805818:	c3                   	ret
+
+0000000000805819 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805819:	55                   	push   %rbp
+  80581a:	48 89 e5             	mov    %rsp,%rbp
+  80581d:	41 57                	push   %r15
+  80581f:	53                   	push   %rbx
+  805820:	48 83 ec 20          	sub    $0x20,%rsp
+  805824:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805824 <bind+0xb>
+  80582b:	49 bb 1c 38 00 00 00 	movabs $0x381c,%r11
+  805832:	00 00 00 
+  805835:	4c 01 db             	add    %r11,%rbx
+  805838:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80583b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80583f:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805842:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805845:	89 c7                	mov    %eax,%edi
+  805847:	48 b8 ec c5 ff ff ff 	movabs $0xffffffffffffc5ec,%rax
+  80584e:	ff ff ff 
+  805851:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805855:	ff d0                	call   *%rax
+  805857:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80585a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80585e:	79 05                	jns    805865 <bind+0x4c>
+		return r;
+  805860:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805863:	eb 21                	jmp    805886 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  805865:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805868:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80586c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80586f:	48 89 ce             	mov    %rcx,%rsi
+  805872:	89 c7                	mov    %eax,%edi
+  805874:	49 89 df             	mov    %rbx,%r15
+  805877:	48 b8 76 cd ff ff ff 	movabs $0xffffffffffffcd76,%rax
+  80587e:	ff ff ff 
+  805881:	48 01 d8             	add    %rbx,%rax
+  805884:	ff d0                	call   *%rax
+}
+  805886:	48 83 c4 20          	add    $0x20,%rsp
+  80588a:	5b                   	pop    %rbx
+  80588b:	41 5f                	pop    %r15
+  80588d:	5d                   	pop    %rbp
+  80588e:	c3                   	ret
+
+000000000080588f <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80588f:	55                   	push   %rbp
+  805890:	48 89 e5             	mov    %rsp,%rbp
+  805893:	41 57                	push   %r15
+  805895:	53                   	push   %rbx
+  805896:	48 83 ec 20          	sub    $0x20,%rsp
+  80589a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80589a <shutdown+0xb>
+  8058a1:	49 bb a6 37 00 00 00 	movabs $0x37a6,%r11
+  8058a8:	00 00 00 
+  8058ab:	4c 01 db             	add    %r11,%rbx
+  8058ae:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8058b1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8058b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058b7:	89 c7                	mov    %eax,%edi
+  8058b9:	48 b8 ec c5 ff ff ff 	movabs $0xffffffffffffc5ec,%rax
+  8058c0:	ff ff ff 
+  8058c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058c7:	ff d0                	call   *%rax
+  8058c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058d0:	79 05                	jns    8058d7 <shutdown+0x48>
+		return r;
+  8058d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058d5:	eb 1c                	jmp    8058f3 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8058d7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8058da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058dd:	89 d6                	mov    %edx,%esi
+  8058df:	89 c7                	mov    %eax,%edi
+  8058e1:	49 89 df             	mov    %rbx,%r15
+  8058e4:	48 b8 0b ce ff ff ff 	movabs $0xffffffffffffce0b,%rax
+  8058eb:	ff ff ff 
+  8058ee:	48 01 d8             	add    %rbx,%rax
+  8058f1:	ff d0                	call   *%rax
+}
+  8058f3:	48 83 c4 20          	add    $0x20,%rsp
+  8058f7:	5b                   	pop    %rbx
+  8058f8:	41 5f                	pop    %r15
+  8058fa:	5d                   	pop    %rbp
+  8058fb:	c3                   	ret
+
+00000000008058fc <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8058fc:	55                   	push   %rbp
+  8058fd:	48 89 e5             	mov    %rsp,%rbp
+  805900:	41 57                	push   %r15
+  805902:	53                   	push   %rbx
+  805903:	48 83 ec 10          	sub    $0x10,%rsp
+  805907:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805907 <devsock_close+0xb>
+  80590e:	49 bb 39 37 00 00 00 	movabs $0x3739,%r11
+  805915:	00 00 00 
+  805918:	4c 01 db             	add    %r11,%rbx
+  80591b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80591f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805923:	48 89 c7             	mov    %rax,%rdi
+  805926:	49 89 df             	mov    %rbx,%r15
+  805929:	48 b8 be df ff ff ff 	movabs $0xffffffffffffdfbe,%rax
+  805930:	ff ff ff 
+  805933:	48 01 d8             	add    %rbx,%rax
+  805936:	ff d0                	call   *%rax
+  805938:	83 f8 01             	cmp    $0x1,%eax
+  80593b:	75 1d                	jne    80595a <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  80593d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805941:	8b 40 0c             	mov    0xc(%rax),%eax
+  805944:	89 c7                	mov    %eax,%edi
+  805946:	49 89 df             	mov    %rbx,%r15
+  805949:	48 b8 5c ce ff ff ff 	movabs $0xffffffffffffce5c,%rax
+  805950:	ff ff ff 
+  805953:	48 01 d8             	add    %rbx,%rax
+  805956:	ff d0                	call   *%rax
+  805958:	eb 05                	jmp    80595f <devsock_close+0x63>
+	else
+		return 0;
+  80595a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80595f:	48 83 c4 10          	add    $0x10,%rsp
+  805963:	5b                   	pop    %rbx
+  805964:	41 5f                	pop    %r15
+  805966:	5d                   	pop    %rbp
+  805967:	c3                   	ret
+
+0000000000805968 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805968:	55                   	push   %rbp
+  805969:	48 89 e5             	mov    %rsp,%rbp
+  80596c:	41 57                	push   %r15
+  80596e:	53                   	push   %rbx
+  80596f:	48 83 ec 20          	sub    $0x20,%rsp
+  805973:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805973 <connect+0xb>
+  80597a:	49 bb cd 36 00 00 00 	movabs $0x36cd,%r11
+  805981:	00 00 00 
+  805984:	4c 01 db             	add    %r11,%rbx
+  805987:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80598a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80598e:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805991:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805994:	89 c7                	mov    %eax,%edi
+  805996:	48 b8 ec c5 ff ff ff 	movabs $0xffffffffffffc5ec,%rax
+  80599d:	ff ff ff 
+  8059a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8059a4:	ff d0                	call   *%rax
+  8059a6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059ad:	79 05                	jns    8059b4 <connect+0x4c>
+		return r;
+  8059af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059b2:	eb 21                	jmp    8059d5 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8059b4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8059b7:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8059bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059be:	48 89 ce             	mov    %rcx,%rsi
+  8059c1:	89 c7                	mov    %eax,%edi
+  8059c3:	49 89 df             	mov    %rbx,%r15
+  8059c6:	48 b8 a4 ce ff ff ff 	movabs $0xffffffffffffcea4,%rax
+  8059cd:	ff ff ff 
+  8059d0:	48 01 d8             	add    %rbx,%rax
+  8059d3:	ff d0                	call   *%rax
+}
+  8059d5:	48 83 c4 20          	add    $0x20,%rsp
+  8059d9:	5b                   	pop    %rbx
+  8059da:	41 5f                	pop    %r15
+  8059dc:	5d                   	pop    %rbp
+  8059dd:	c3                   	ret
+
+00000000008059de <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8059de:	55                   	push   %rbp
+  8059df:	48 89 e5             	mov    %rsp,%rbp
+  8059e2:	41 57                	push   %r15
+  8059e4:	53                   	push   %rbx
+  8059e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8059e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059e9 <listen+0xb>
+  8059f0:	49 bb 57 36 00 00 00 	movabs $0x3657,%r11
+  8059f7:	00 00 00 
+  8059fa:	4c 01 db             	add    %r11,%rbx
+  8059fd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805a00:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805a03:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a06:	89 c7                	mov    %eax,%edi
+  805a08:	48 b8 ec c5 ff ff ff 	movabs $0xffffffffffffc5ec,%rax
+  805a0f:	ff ff ff 
+  805a12:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a16:	ff d0                	call   *%rax
+  805a18:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a1b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a1f:	79 05                	jns    805a26 <listen+0x48>
+		return r;
+  805a21:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a24:	eb 1c                	jmp    805a42 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805a26:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805a29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a2c:	89 d6                	mov    %edx,%esi
+  805a2e:	89 c7                	mov    %eax,%edi
+  805a30:	49 89 df             	mov    %rbx,%r15
+  805a33:	48 b8 39 cf ff ff ff 	movabs $0xffffffffffffcf39,%rax
+  805a3a:	ff ff ff 
+  805a3d:	48 01 d8             	add    %rbx,%rax
+  805a40:	ff d0                	call   *%rax
+}
+  805a42:	48 83 c4 20          	add    $0x20,%rsp
+  805a46:	5b                   	pop    %rbx
+  805a47:	41 5f                	pop    %r15
+  805a49:	5d                   	pop    %rbp
+  805a4a:	c3                   	ret
+
+0000000000805a4b <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805a4b:	55                   	push   %rbp
+  805a4c:	48 89 e5             	mov    %rsp,%rbp
+  805a4f:	41 57                	push   %r15
+  805a51:	48 83 ec 28          	sub    $0x28,%rsp
+  805a55:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a55 <devsock_read+0xa>
+  805a5c:	49 bb eb 35 00 00 00 	movabs $0x35eb,%r11
+  805a63:	00 00 00 
+  805a66:	4c 01 d8             	add    %r11,%rax
+  805a69:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805a6d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805a71:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805a75:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805a79:	41 89 d0             	mov    %edx,%r8d
+  805a7c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805a80:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805a83:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805a8c:	44 89 c2             	mov    %r8d,%edx
+  805a8f:	49 89 c7             	mov    %rax,%r15
+  805a92:	49 b8 8a cf ff ff ff 	movabs $0xffffffffffffcf8a,%r8
+  805a99:	ff ff ff 
+  805a9c:	49 01 c0             	add    %rax,%r8
+  805a9f:	41 ff d0             	call   *%r8
+}
+  805aa2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805aa6:	c9                   	leave
+  805aa7:	c3                   	ret
+
+0000000000805aa8 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805aa8:	55                   	push   %rbp
+  805aa9:	48 89 e5             	mov    %rsp,%rbp
+  805aac:	41 57                	push   %r15
+  805aae:	48 83 ec 28          	sub    $0x28,%rsp
+  805ab2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ab2 <devsock_write+0xa>
+  805ab9:	49 bb 8e 35 00 00 00 	movabs $0x358e,%r11
+  805ac0:	00 00 00 
+  805ac3:	4c 01 d8             	add    %r11,%rax
+  805ac6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805aca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805ace:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805ad2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805ad6:	41 89 d0             	mov    %edx,%r8d
+  805ad9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805add:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805ae0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805ae4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805ae9:	44 89 c2             	mov    %r8d,%edx
+  805aec:	49 89 c7             	mov    %rax,%r15
+  805aef:	49 b8 a7 d0 ff ff ff 	movabs $0xffffffffffffd0a7,%r8
+  805af6:	ff ff ff 
+  805af9:	49 01 c0             	add    %rax,%r8
+  805afc:	41 ff d0             	call   *%r8
+}
+  805aff:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805b03:	c9                   	leave
+  805b04:	c3                   	ret
+
+0000000000805b05 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805b05:	55                   	push   %rbp
+  805b06:	48 89 e5             	mov    %rsp,%rbp
+  805b09:	41 57                	push   %r15
+  805b0b:	48 83 ec 18          	sub    $0x18,%rsp
+  805b0f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805b0f <devsock_stat+0xa>
+  805b16:	49 bb 31 35 00 00 00 	movabs $0x3531,%r11
+  805b1d:	00 00 00 
+  805b20:	4c 01 d8             	add    %r11,%rax
+  805b23:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805b27:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805b2b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805b2f:	48 b9 ac e7 ff ff ff 	movabs $0xffffffffffffe7ac,%rcx
+  805b36:	ff ff ff 
+  805b39:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805b3d:	48 89 ce             	mov    %rcx,%rsi
+  805b40:	48 89 d7             	mov    %rdx,%rdi
+  805b43:	49 89 c7             	mov    %rax,%r15
+  805b46:	48 ba 76 87 ff ff ff 	movabs $0xffffffffffff8776,%rdx
+  805b4d:	ff ff ff 
+  805b50:	48 01 c2             	add    %rax,%rdx
+  805b53:	ff d2                	call   *%rdx
+	return 0;
+  805b55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b5a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805b5e:	c9                   	leave
+  805b5f:	c3                   	ret
+
+0000000000805b60 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  805b60:	55                   	push   %rbp
+  805b61:	48 89 e5             	mov    %rsp,%rbp
+  805b64:	41 57                	push   %r15
+  805b66:	53                   	push   %rbx
+  805b67:	48 83 ec 20          	sub    $0x20,%rsp
+  805b6b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b6b <socket+0xb>
+  805b72:	49 bb d5 34 00 00 00 	movabs $0x34d5,%r11
+  805b79:	00 00 00 
+  805b7c:	4c 01 db             	add    %r11,%rbx
+  805b7f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805b82:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805b85:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805b88:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805b8b:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805b8e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b91:	89 ce                	mov    %ecx,%esi
+  805b93:	89 c7                	mov    %eax,%edi
+  805b95:	49 89 df             	mov    %rbx,%r15
+  805b98:	48 b8 7e d2 ff ff ff 	movabs $0xffffffffffffd27e,%rax
+  805b9f:	ff ff ff 
+  805ba2:	48 01 d8             	add    %rbx,%rax
+  805ba5:	ff d0                	call   *%rax
+  805ba7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805baa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805bae:	79 05                	jns    805bb5 <socket+0x55>
+		return r;
+  805bb0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bb3:	eb 15                	jmp    805bca <socket+0x6a>
+	return alloc_sockfd(r);
+  805bb5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bb8:	89 c7                	mov    %eax,%edi
+  805bba:	48 b8 68 c6 ff ff ff 	movabs $0xffffffffffffc668,%rax
+  805bc1:	ff ff ff 
+  805bc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805bc8:	ff d0                	call   *%rax
+}
+  805bca:	48 83 c4 20          	add    $0x20,%rsp
+  805bce:	5b                   	pop    %rbx
+  805bcf:	41 5f                	pop    %r15
+  805bd1:	5d                   	pop    %rbp
+  805bd2:	c3                   	ret
+
+0000000000805bd3 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805bd3:	55                   	push   %rbp
+  805bd4:	48 89 e5             	mov    %rsp,%rbp
+  805bd7:	41 57                	push   %r15
+  805bd9:	53                   	push   %rbx
+  805bda:	48 83 ec 10          	sub    $0x10,%rsp
+  805bde:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bde <nsipc+0xb>
+  805be5:	49 bb 62 34 00 00 00 	movabs $0x3462,%r11
+  805bec:	00 00 00 
+  805bef:	4c 01 db             	add    %r11,%rbx
+  805bf2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805bf5:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805bfc:	00 00 00 
+  805bff:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805c02:	85 c0                	test   %eax,%eax
+  805c04:	75 24                	jne    805c2a <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805c06:	bf 02 00 00 00       	mov    $0x2,%edi
+  805c0b:	49 89 df             	mov    %rbx,%r15
+  805c0e:	48 b8 a4 ae ff ff ff 	movabs $0xffffffffffffaea4,%rax
+  805c15:	ff ff ff 
+  805c18:	48 01 d8             	add    %rbx,%rax
+  805c1b:	ff d0                	call   *%rax
+  805c1d:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805c24:	00 00 00 
+  805c27:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805c2a:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805c31:	00 00 00 
+  805c34:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805c37:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805c3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805c40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805c46:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805c4b:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c52:	00 00 00 
+  805c55:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805c59:	89 c7                	mov    %eax,%edi
+  805c5b:	49 89 df             	mov    %rbx,%r15
+  805c5e:	48 b8 c3 a8 ff ff ff 	movabs $0xffffffffffffa8c3,%rax
+  805c65:	ff ff ff 
+  805c68:	48 01 d8             	add    %rbx,%rax
+  805c6b:	ff d0                	call   *%rax
+}
+  805c6d:	48 83 c4 10          	add    $0x10,%rsp
+  805c71:	5b                   	pop    %rbx
+  805c72:	41 5f                	pop    %r15
+  805c74:	5d                   	pop    %rbp
+  805c75:	c3                   	ret
+
+0000000000805c76 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805c76:	55                   	push   %rbp
+  805c77:	48 89 e5             	mov    %rsp,%rbp
+  805c7a:	41 57                	push   %r15
+  805c7c:	53                   	push   %rbx
+  805c7d:	48 83 ec 20          	sub    $0x20,%rsp
+  805c81:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c81 <nsipc_words+0xb>
+  805c88:	49 bb bf 33 00 00 00 	movabs $0x33bf,%r11
+  805c8f:	00 00 00 
+  805c92:	4c 01 db             	add    %r11,%rbx
+  805c95:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c98:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805c9c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805ca0:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805ca7:	00 00 00 
+  805caa:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805cad:	85 c0                	test   %eax,%eax
+  805caf:	75 24                	jne    805cd5 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805cb1:	bf 02 00 00 00       	mov    $0x2,%edi
+  805cb6:	49 89 df             	mov    %rbx,%r15
+  805cb9:	48 b8 a4 ae ff ff ff 	movabs $0xffffffffffffaea4,%rax
+  805cc0:	ff ff ff 
+  805cc3:	48 01 d8             	add    %rbx,%rax
+  805cc6:	ff d0                	call   *%rax
+  805cc8:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805ccf:	00 00 00 
+  805cd2:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805cd5:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805cdc:	00 00 00 
+  805cdf:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805ce2:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805ce6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805cea:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805ced:	89 c7                	mov    %eax,%edi
+  805cef:	49 89 df             	mov    %rbx,%r15
+  805cf2:	48 b8 ae a9 ff ff ff 	movabs $0xffffffffffffa9ae,%rax
+  805cf9:	ff ff ff 
+  805cfc:	48 01 d8             	add    %rbx,%rax
+  805cff:	ff d0                	call   *%rax
+}
+  805d01:	48 83 c4 20          	add    $0x20,%rsp
+  805d05:	5b                   	pop    %rbx
+  805d06:	41 5f                	pop    %r15
+  805d08:	5d                   	pop    %rbp
+  805d09:	c3                   	ret
+
+0000000000805d0a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805d0a:	55                   	push   %rbp
+  805d0b:	48 89 e5             	mov    %rsp,%rbp
+  805d0e:	41 57                	push   %r15
+  805d10:	53                   	push   %rbx
+  805d11:	48 83 ec 30          	sub    $0x30,%rsp
+  805d15:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d15 <nsipc_accept+0xb>
+  805d1c:	49 bb 2b 33 00 00 00 	movabs $0x332b,%r11
+  805d23:	00 00 00 
+  805d26:	4c 01 db             	add    %r11,%rbx
+  805d29:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805d2c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805d30:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805d34:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805d3b:	00 00 00 
+  805d3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d41:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805d44:	bf 01 00 00 00       	mov    $0x1,%edi
+  805d49:	48 b8 93 cb ff ff ff 	movabs $0xffffffffffffcb93,%rax
+  805d50:	ff ff ff 
+  805d53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d57:	ff d0                	call   *%rax
+  805d59:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d5c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d60:	78 48                	js     805daa <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805d62:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805d69:	00 00 00 
+  805d6c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d70:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805d74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d78:	8b 40 10             	mov    0x10(%rax),%eax
+  805d7b:	89 c2                	mov    %eax,%edx
+  805d7d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805d81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805d85:	48 89 ce             	mov    %rcx,%rsi
+  805d88:	48 89 c7             	mov    %rax,%rdi
+  805d8b:	49 89 df             	mov    %rbx,%r15
+  805d8e:	48 b8 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rax
+  805d95:	ff ff ff 
+  805d98:	48 01 d8             	add    %rbx,%rax
+  805d9b:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805d9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805da1:	8b 50 10             	mov    0x10(%rax),%edx
+  805da4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805da8:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805daa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805dad:	48 83 c4 30          	add    $0x30,%rsp
+  805db1:	5b                   	pop    %rbx
+  805db2:	41 5f                	pop    %r15
+  805db4:	5d                   	pop    %rbp
+  805db5:	c3                   	ret
+
+0000000000805db6 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805db6:	55                   	push   %rbp
+  805db7:	48 89 e5             	mov    %rsp,%rbp
+  805dba:	41 57                	push   %r15
+  805dbc:	53                   	push   %rbx
+  805dbd:	48 83 ec 10          	sub    $0x10,%rsp
+  805dc1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805dc1 <nsipc_bind+0xb>
+  805dc8:	49 bb 7f 32 00 00 00 	movabs $0x327f,%r11
+  805dcf:	00 00 00 
+  805dd2:	4c 01 db             	add    %r11,%rbx
+  805dd5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805dd8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805ddc:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805ddf:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805de6:	00 00 00 
+  805de9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dec:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805def:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805df2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805df6:	48 89 c6             	mov    %rax,%rsi
+  805df9:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805e00:	00 00 00 
+  805e03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e07:	48 89 c7             	mov    %rax,%rdi
+  805e0a:	49 89 df             	mov    %rbx,%r15
+  805e0d:	48 b8 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rax
+  805e14:	ff ff ff 
+  805e17:	48 01 d8             	add    %rbx,%rax
+  805e1a:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805e1c:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805e23:	00 00 00 
+  805e26:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805e29:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805e2d:	bf 02 00 00 00       	mov    $0x2,%edi
+  805e32:	48 b8 93 cb ff ff ff 	movabs $0xffffffffffffcb93,%rax
+  805e39:	ff ff ff 
+  805e3c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e40:	ff d0                	call   *%rax
+}
+  805e42:	48 83 c4 10          	add    $0x10,%rsp
+  805e46:	5b                   	pop    %rbx
+  805e47:	41 5f                	pop    %r15
+  805e49:	5d                   	pop    %rbp
+  805e4a:	c3                   	ret
+
+0000000000805e4b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805e4b:	55                   	push   %rbp
+  805e4c:	48 89 e5             	mov    %rsp,%rbp
+  805e4f:	48 83 ec 20          	sub    $0x20,%rsp
+  805e53:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e53 <nsipc_shutdown+0x8>
+  805e5a:	49 bb ed 31 00 00 00 	movabs $0x31ed,%r11
+  805e61:	00 00 00 
+  805e64:	4c 01 d8             	add    %r11,%rax
+  805e67:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805e6a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805e6d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805e70:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805e73:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805e76:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805e79:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805e7d:	ba 08 00 00 00       	mov    $0x8,%edx
+  805e82:	48 89 ce             	mov    %rcx,%rsi
+  805e85:	bf 03 00 00 00       	mov    $0x3,%edi
+  805e8a:	48 b9 36 cc ff ff ff 	movabs $0xffffffffffffcc36,%rcx
+  805e91:	ff ff ff 
+  805e94:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805e98:	ff d0                	call   *%rax
+}
+  805e9a:	c9                   	leave
+  805e9b:	c3                   	ret
+
+0000000000805e9c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805e9c:	55                   	push   %rbp
+  805e9d:	48 89 e5             	mov    %rsp,%rbp
+  805ea0:	48 83 ec 20          	sub    $0x20,%rsp
+  805ea4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ea4 <nsipc_close+0x8>
+  805eab:	49 bb 9c 31 00 00 00 	movabs $0x319c,%r11
+  805eb2:	00 00 00 
+  805eb5:	4c 01 d8             	add    %r11,%rax
+  805eb8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805ebb:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805ebe:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805ec1:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805ec5:	ba 04 00 00 00       	mov    $0x4,%edx
+  805eca:	48 89 ce             	mov    %rcx,%rsi
+  805ecd:	bf 04 00 00 00       	mov    $0x4,%edi
+  805ed2:	48 b9 36 cc ff ff ff 	movabs $0xffffffffffffcc36,%rcx
+  805ed9:	ff ff ff 
+  805edc:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805ee0:	ff d0                	call   *%rax
+}
+  805ee2:	c9                   	leave
+  805ee3:	c3                   	ret
+
+0000000000805ee4 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805ee4:	55                   	push   %rbp
+  805ee5:	48 89 e5             	mov    %rsp,%rbp
+  805ee8:	41 57                	push   %r15
+  805eea:	53                   	push   %rbx
+  805eeb:	48 83 ec 10          	sub    $0x10,%rsp
+  805eef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805eef <nsipc_connect+0xb>
+  805ef6:	49 bb 51 31 00 00 00 	movabs $0x3151,%r11
+  805efd:	00 00 00 
+  805f00:	4c 01 db             	add    %r11,%rbx
+  805f03:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805f06:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805f0a:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805f0d:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805f14:	00 00 00 
+  805f17:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f1a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805f1d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805f20:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f24:	48 89 c6             	mov    %rax,%rsi
+  805f27:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805f2e:	00 00 00 
+  805f31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f35:	48 89 c7             	mov    %rax,%rdi
+  805f38:	49 89 df             	mov    %rbx,%r15
+  805f3b:	48 b8 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rax
+  805f42:	ff ff ff 
+  805f45:	48 01 d8             	add    %rbx,%rax
+  805f48:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805f4a:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805f51:	00 00 00 
+  805f54:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805f57:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805f5b:	bf 05 00 00 00       	mov    $0x5,%edi
+  805f60:	48 b8 93 cb ff ff ff 	movabs $0xffffffffffffcb93,%rax
+  805f67:	ff ff ff 
+  805f6a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f6e:	ff d0                	call   *%rax
+}
+  805f70:	48 83 c4 10          	add    $0x10,%rsp
+  805f74:	5b                   	pop    %rbx
+  805f75:	41 5f                	pop    %r15
+  805f77:	5d                   	pop    %rbp
+  805f78:	c3                   	ret
+
+0000000000805f79 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805f79:	55                   	push   %rbp
+  805f7a:	48 89 e5             	mov    %rsp,%rbp
+  805f7d:	48 83 ec 20          	sub    $0x20,%rsp
+  805f81:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f81 <nsipc_listen+0x8>
+  805f88:	49 bb bf 30 00 00 00 	movabs $0x30bf,%r11
+  805f8f:	00 00 00 
+  805f92:	4c 01 d8             	add    %r11,%rax
+  805f95:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805f98:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805f9b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805f9e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805fa1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805fa4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805fa7:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805fab:	ba 08 00 00 00       	mov    $0x8,%edx
+  805fb0:	48 89 ce             	mov    %rcx,%rsi
+  805fb3:	bf 06 00 00 00       	mov    $0x6,%edi
+  805fb8:	48 b9 36 cc ff ff ff 	movabs $0xffffffffffffcc36,%rcx
+  805fbf:	ff ff ff 
+  805fc2:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805fc6:	ff d0                	call   *%rax
+}
+  805fc8:	c9                   	leave
+  805fc9:	c3                   	ret
+
+0000000000805fca <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805fca:	55                   	push   %rbp
+  805fcb:	48 89 e5             	mov    %rsp,%rbp
+  805fce:	41 57                	push   %r15
+  805fd0:	53                   	push   %rbx
+  805fd1:	48 83 ec 30          	sub    $0x30,%rsp
+  805fd5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fd5 <nsipc_recv+0xb>
+  805fdc:	49 bb 6b 30 00 00 00 	movabs $0x306b,%r11
+  805fe3:	00 00 00 
+  805fe6:	4c 01 db             	add    %r11,%rbx
+  805fe9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805fec:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805ff0:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805ff3:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805ff6:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805ffd:	00 00 00 
+  806000:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806003:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  806006:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80600d:	00 00 00 
+  806010:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806013:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  806017:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80601e:	00 00 00 
+  806021:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806024:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  806028:	bf 07 00 00 00       	mov    $0x7,%edi
+  80602d:	48 b8 93 cb ff ff ff 	movabs $0xffffffffffffcb93,%rax
+  806034:	ff ff ff 
+  806037:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80603b:	ff d0                	call   *%rax
+  80603d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806040:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806044:	0f 88 91 00 00 00    	js     8060db <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  80604a:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  806051:	7f 08                	jg     80605b <nsipc_recv+0x91>
+  806053:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806056:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  806059:	7e 50                	jle    8060ab <nsipc_recv+0xe1>
+  80605b:	48 b8 b3 e7 ff ff ff 	movabs $0xffffffffffffe7b3,%rax
+  806062:	ff ff ff 
+  806065:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806069:	48 89 c1             	mov    %rax,%rcx
+  80606c:	48 b8 c8 e7 ff ff ff 	movabs $0xffffffffffffe7c8,%rax
+  806073:	ff ff ff 
+  806076:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80607a:	48 89 c2             	mov    %rax,%rdx
+  80607d:	be 79 00 00 00       	mov    $0x79,%esi
+  806082:	48 b8 dd e7 ff ff ff 	movabs $0xffffffffffffe7dd,%rax
+  806089:	ff ff ff 
+  80608c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806090:	48 89 c7             	mov    %rax,%rdi
+  806093:	49 89 df             	mov    %rbx,%r15
+  806096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80609b:	49 b8 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%r8
+  8060a2:	ff ff ff 
+  8060a5:	49 01 d8             	add    %rbx,%r8
+  8060a8:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8060ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060ae:	48 63 d0             	movslq %eax,%rdx
+  8060b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060b5:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8060bc:	00 00 00 
+  8060bf:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8060c3:	48 89 ce             	mov    %rcx,%rsi
+  8060c6:	48 89 c7             	mov    %rax,%rdi
+  8060c9:	49 89 df             	mov    %rbx,%r15
+  8060cc:	48 b8 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rax
+  8060d3:	ff ff ff 
+  8060d6:	48 01 d8             	add    %rbx,%rax
+  8060d9:	ff d0                	call   *%rax
+	}
+
+	return r;
+  8060db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8060de:	48 83 c4 30          	add    $0x30,%rsp
+  8060e2:	5b                   	pop    %rbx
+  8060e3:	41 5f                	pop    %r15
+  8060e5:	5d                   	pop    %rbp
+  8060e6:	c3                   	ret
+
+00000000008060e7 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8060e7:	55                   	push   %rbp
+  8060e8:	48 89 e5             	mov    %rsp,%rbp
+  8060eb:	41 57                	push   %r15
+  8060ed:	53                   	push   %rbx
+  8060ee:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8060f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060f5 <nsipc_send+0xe>
+  8060fc:	49 bb 4b 2f 00 00 00 	movabs $0x2f4b,%r11
+  806103:	00 00 00 
+  806106:	4c 01 db             	add    %r11,%rbx
+  806109:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  80610f:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  806116:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  80611c:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  806122:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  806126:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  80612a:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806131:	00 00 00 
+  806134:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806137:	85 c0                	test   %eax,%eax
+  806139:	75 24                	jne    80615f <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80613b:	bf 02 00 00 00       	mov    $0x2,%edi
+  806140:	49 89 df             	mov    %rbx,%r15
+  806143:	48 b8 a4 ae ff ff ff 	movabs $0xffffffffffffaea4,%rax
+  80614a:	ff ff ff 
+  80614d:	48 01 d8             	add    %rbx,%rax
+  806150:	ff d0                	call   *%rax
+  806152:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  806159:	00 00 00 
+  80615c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  80615f:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  806165:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  806168:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  80616f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  806172:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806175:	39 c2                	cmp    %eax,%edx
+  806177:	0f 4e c2             	cmovle %edx,%eax
+  80617a:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  806180:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  806186:	48 63 d0             	movslq %eax,%rdx
+  806189:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  806190:	48 89 c6             	mov    %rax,%rsi
+  806193:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  80619a:	00 00 00 
+  80619d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8061a1:	48 89 c7             	mov    %rax,%rdi
+  8061a4:	49 89 df             	mov    %rbx,%r15
+  8061a7:	48 b8 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rax
+  8061ae:	ff ff ff 
+  8061b1:	48 01 d8             	add    %rbx,%rax
+  8061b4:	ff d0                	call   *%rax
+	req->req_s = s;
+  8061b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061ba:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  8061c0:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  8061c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061c6:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8061cc:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  8061cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061d3:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  8061d9:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  8061dc:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  8061e3:	00 00 00 
+  8061e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8061ea:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8061ee:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8061f5:	00 
+  8061f6:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8061fc:	48 63 d0             	movslq %eax,%rdx
+  8061ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806203:	48 01 d0             	add    %rdx,%rax
+  806206:	48 83 e8 01          	sub    $0x1,%rax
+  80620a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80620e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806212:	ba 00 00 00 00       	mov    $0x0,%edx
+  806217:	48 f7 75 d8          	divq   -0x28(%rbp)
+  80621b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80621f:	48 29 d0             	sub    %rdx,%rax
+  806222:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  806228:	85 c0                	test   %eax,%eax
+  80622a:	0f 48 c2             	cmovs  %edx,%eax
+  80622d:	c1 f8 0c             	sar    $0xc,%eax
+  806230:	48 98                	cltq
+  806232:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  806236:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80623a:	48 85 c0             	test   %rax,%rax
+  80623d:	0f 95 c0             	setne  %al
+  806240:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  806243:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  80624a:	00 
+  80624b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80624f:	48 83 c0 0b          	add    $0xb,%rax
+  806253:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806257:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80625b:	ba 00 00 00 00       	mov    $0x0,%edx
+  806260:	48 f7 75 c8          	divq   -0x38(%rbp)
+  806264:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806268:	48 29 d0             	sub    %rdx,%rax
+  80626b:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80626f:	89 c7                	mov    %eax,%edi
+  806271:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806278:	00 00 00 
+  80627b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80627e:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  806282:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  806286:	48 83 ec 08          	sub    $0x8,%rsp
+  80628a:	6a 00                	push   $0x0
+  80628c:	6a 00                	push   $0x0
+  80628e:	6a 05                	push   $0x5
+  806290:	41 89 f1             	mov    %esi,%r9d
+  806293:	49 89 c8             	mov    %rcx,%r8
+  806296:	89 f9                	mov    %edi,%ecx
+  806298:	be 08 00 00 00       	mov    $0x8,%esi
+  80629d:	89 c7                	mov    %eax,%edi
+  80629f:	49 89 df             	mov    %rbx,%r15
+  8062a2:	48 b8 ac aa ff ff ff 	movabs $0xffffffffffffaaac,%rax
+  8062a9:	ff ff ff 
+  8062ac:	48 01 d8             	add    %rbx,%rax
+  8062af:	ff d0                	call   *%rax
+  8062b1:	48 83 c4 20          	add    $0x20,%rsp
+}
+  8062b5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8062b9:	5b                   	pop    %rbx
+  8062ba:	41 5f                	pop    %r15
+  8062bc:	5d                   	pop    %rbp
+  8062bd:	c3                   	ret
+
+00000000008062be <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8062be:	55                   	push   %rbp
+  8062bf:	48 89 e5             	mov    %rsp,%rbp
+  8062c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8062c6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8062c6 <nsipc_socket+0x8>
+  8062cd:	49 bb 7a 2d 00 00 00 	movabs $0x2d7a,%r11
+  8062d4:	00 00 00 
+  8062d7:	4c 01 d8             	add    %r11,%rax
+  8062da:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8062dd:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8062e0:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8062e3:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8062ea:	00 00 00 
+  8062ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8062f0:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8062f3:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8062fa:	00 00 00 
+  8062fd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  806300:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  806304:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80630b:	00 00 00 
+  80630e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806311:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  806315:	bf 09 00 00 00       	mov    $0x9,%edi
+  80631a:	48 ba 93 cb ff ff ff 	movabs $0xffffffffffffcb93,%rdx
+  806321:	ff ff ff 
+  806324:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806328:	ff d0                	call   *%rax
+}
+  80632a:	c9                   	leave
+  80632b:	c3                   	ret
+
+000000000080632c <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  80632c:	55                   	push   %rbp
+  80632d:	48 89 e5             	mov    %rsp,%rbp
+  806330:	41 57                	push   %r15
+  806332:	53                   	push   %rbx
+  806333:	48 83 ec 30          	sub    $0x30,%rsp
+  806337:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806337 <pipe+0xb>
+  80633e:	49 bb 09 2d 00 00 00 	movabs $0x2d09,%r11
+  806345:	00 00 00 
+  806348:	4c 01 db             	add    %r11,%rbx
+  80634b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  80634f:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  806353:	48 89 c7             	mov    %rax,%rdi
+  806356:	49 89 df             	mov    %rbx,%r15
+  806359:	48 b8 ad af ff ff ff 	movabs $0xffffffffffffafad,%rax
+  806360:	ff ff ff 
+  806363:	48 01 d8             	add    %rbx,%rax
+  806366:	ff d0                	call   *%rax
+  806368:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80636b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80636f:	0f 88 12 02 00 00    	js     806587 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806375:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806379:	ba 07 04 00 00       	mov    $0x407,%edx
+  80637e:	48 89 c6             	mov    %rax,%rsi
+  806381:	bf 00 00 00 00       	mov    $0x0,%edi
+  806386:	49 89 df             	mov    %rbx,%r15
+  806389:	48 b8 32 94 ff ff ff 	movabs $0xffffffffffff9432,%rax
+  806390:	ff ff ff 
+  806393:	48 01 d8             	add    %rbx,%rax
+  806396:	ff d0                	call   *%rax
+  806398:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80639b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80639f:	0f 88 e2 01 00 00    	js     806587 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8063a5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8063a9:	48 89 c7             	mov    %rax,%rdi
+  8063ac:	49 89 df             	mov    %rbx,%r15
+  8063af:	48 b8 ad af ff ff ff 	movabs $0xffffffffffffafad,%rax
+  8063b6:	ff ff ff 
+  8063b9:	48 01 d8             	add    %rbx,%rax
+  8063bc:	ff d0                	call   *%rax
+  8063be:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8063c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8063c5:	0f 88 9b 01 00 00    	js     806566 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8063cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063cf:	ba 07 04 00 00       	mov    $0x407,%edx
+  8063d4:	48 89 c6             	mov    %rax,%rsi
+  8063d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8063dc:	49 89 df             	mov    %rbx,%r15
+  8063df:	48 b8 32 94 ff ff ff 	movabs $0xffffffffffff9432,%rax
+  8063e6:	ff ff ff 
+  8063e9:	48 01 d8             	add    %rbx,%rax
+  8063ec:	ff d0                	call   *%rax
+  8063ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8063f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8063f5:	0f 88 6b 01 00 00    	js     806566 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8063fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063ff:	48 89 c7             	mov    %rax,%rdi
+  806402:	49 89 df             	mov    %rbx,%r15
+  806405:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  80640c:	ff ff ff 
+  80640f:	48 01 d8             	add    %rbx,%rax
+  806412:	ff d0                	call   *%rax
+  806414:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806418:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80641c:	ba 07 04 00 00       	mov    $0x407,%edx
+  806421:	48 89 c6             	mov    %rax,%rsi
+  806424:	bf 00 00 00 00       	mov    $0x0,%edi
+  806429:	49 89 df             	mov    %rbx,%r15
+  80642c:	48 b8 32 94 ff ff ff 	movabs $0xffffffffffff9432,%rax
+  806433:	ff ff ff 
+  806436:	48 01 d8             	add    %rbx,%rax
+  806439:	ff d0                	call   *%rax
+  80643b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80643e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806442:	0f 88 fd 00 00 00    	js     806545 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806448:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80644c:	48 89 c7             	mov    %rax,%rdi
+  80644f:	49 89 df             	mov    %rbx,%r15
+  806452:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  806459:	ff ff ff 
+  80645c:	48 01 d8             	add    %rbx,%rax
+  80645f:	ff d0                	call   *%rax
+  806461:	48 89 c2             	mov    %rax,%rdx
+  806464:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806468:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80646e:	48 89 d1             	mov    %rdx,%rcx
+  806471:	ba 00 00 00 00       	mov    $0x0,%edx
+  806476:	48 89 c6             	mov    %rax,%rsi
+  806479:	bf 00 00 00 00       	mov    $0x0,%edi
+  80647e:	49 89 df             	mov    %rbx,%r15
+  806481:	48 b8 97 94 ff ff ff 	movabs $0xffffffffffff9497,%rax
+  806488:	ff ff ff 
+  80648b:	48 01 d8             	add    %rbx,%rax
+  80648e:	ff d0                	call   *%rax
+  806490:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806493:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806497:	0f 88 87 00 00 00    	js     806524 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  80649d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8064a1:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8064a8:	00 00 00 
+  8064ab:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8064ae:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  8064b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8064b4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8064bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064bf:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8064c6:	00 00 00 
+  8064c9:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8064cc:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8064ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064d2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8064d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8064dd:	48 89 c7             	mov    %rax,%rdi
+  8064e0:	49 89 df             	mov    %rbx,%r15
+  8064e3:	48 b8 33 af ff ff ff 	movabs $0xffffffffffffaf33,%rax
+  8064ea:	ff ff ff 
+  8064ed:	48 01 d8             	add    %rbx,%rax
+  8064f0:	ff d0                	call   *%rax
+  8064f2:	89 c2                	mov    %eax,%edx
+  8064f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8064f8:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8064fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064fe:	48 89 c7             	mov    %rax,%rdi
+  806501:	49 89 df             	mov    %rbx,%r15
+  806504:	48 b8 33 af ff ff ff 	movabs $0xffffffffffffaf33,%rax
+  80650b:	ff ff ff 
+  80650e:	48 01 d8             	add    %rbx,%rax
+  806511:	ff d0                	call   *%rax
+  806513:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806517:	48 83 c2 04          	add    $0x4,%rdx
+  80651b:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  80651d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806522:	eb 67                	jmp    80658b <pipe+0x25f>
+		goto err3;
+  806524:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806525:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806529:	48 89 c6             	mov    %rax,%rsi
+  80652c:	bf 00 00 00 00       	mov    $0x0,%edi
+  806531:	49 89 df             	mov    %rbx,%r15
+  806534:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  80653b:	ff ff ff 
+  80653e:	48 01 d8             	add    %rbx,%rax
+  806541:	ff d0                	call   *%rax
+  806543:	eb 01                	jmp    806546 <pipe+0x21a>
+		goto err2;
+  806545:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  806546:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80654a:	48 89 c6             	mov    %rax,%rsi
+  80654d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806552:	49 89 df             	mov    %rbx,%r15
+  806555:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  80655c:	ff ff ff 
+  80655f:	48 01 d8             	add    %rbx,%rax
+  806562:	ff d0                	call   *%rax
+  806564:	eb 01                	jmp    806567 <pipe+0x23b>
+		goto err1;
+  806566:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806567:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80656b:	48 89 c6             	mov    %rax,%rsi
+  80656e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806573:	49 89 df             	mov    %rbx,%r15
+  806576:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  80657d:	ff ff ff 
+  806580:	48 01 d8             	add    %rbx,%rax
+  806583:	ff d0                	call   *%rax
+  806585:	eb 01                	jmp    806588 <pipe+0x25c>
+		goto err;
+  806587:	90                   	nop
+err:
+	return r;
+  806588:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80658b:	48 83 c4 30          	add    $0x30,%rsp
+  80658f:	5b                   	pop    %rbx
+  806590:	41 5f                	pop    %r15
+  806592:	5d                   	pop    %rbp
+  806593:	c3                   	ret
+
+0000000000806594 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  806594:	55                   	push   %rbp
+  806595:	48 89 e5             	mov    %rsp,%rbp
+  806598:	41 57                	push   %r15
+  80659a:	41 54                	push   %r12
+  80659c:	53                   	push   %rbx
+  80659d:	48 83 ec 28          	sub    $0x28,%rsp
+  8065a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065a1 <_pipeisclosed+0xd>
+  8065a8:	49 bb 9f 2a 00 00 00 	movabs $0x2a9f,%r11
+  8065af:	00 00 00 
+  8065b2:	4c 01 db             	add    %r11,%rbx
+  8065b5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8065b9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8065bd:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8065c4:	ff ff ff 
+  8065c7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8065cb:	48 8b 00             	mov    (%rax),%rax
+  8065ce:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8065d4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8065d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8065db:	48 89 c7             	mov    %rax,%rdi
+  8065de:	49 89 df             	mov    %rbx,%r15
+  8065e1:	48 b8 be df ff ff ff 	movabs $0xffffffffffffdfbe,%rax
+  8065e8:	ff ff ff 
+  8065eb:	48 01 d8             	add    %rbx,%rax
+  8065ee:	ff d0                	call   *%rax
+  8065f0:	41 89 c4             	mov    %eax,%r12d
+  8065f3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8065f7:	48 89 c7             	mov    %rax,%rdi
+  8065fa:	49 89 df             	mov    %rbx,%r15
+  8065fd:	48 b8 be df ff ff ff 	movabs $0xffffffffffffdfbe,%rax
+  806604:	ff ff ff 
+  806607:	48 01 d8             	add    %rbx,%rax
+  80660a:	ff d0                	call   *%rax
+  80660c:	41 39 c4             	cmp    %eax,%r12d
+  80660f:	0f 94 c0             	sete   %al
+  806612:	0f b6 c0             	movzbl %al,%eax
+  806615:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806618:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80661f:	ff ff ff 
+  806622:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806626:	48 8b 00             	mov    (%rax),%rax
+  806629:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80662f:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  806632:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806635:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806638:	75 05                	jne    80663f <_pipeisclosed+0xab>
+			return ret;
+  80663a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80663d:	eb 63                	jmp    8066a2 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  80663f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806642:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806645:	0f 84 72 ff ff ff    	je     8065bd <_pipeisclosed+0x29>
+  80664b:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  80664f:	0f 85 68 ff ff ff    	jne    8065bd <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  806655:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80665c:	ff ff ff 
+  80665f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806663:	48 8b 00             	mov    (%rax),%rax
+  806666:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  80666c:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80666f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806672:	89 c6                	mov    %eax,%esi
+  806674:	48 b8 ee e7 ff ff ff 	movabs $0xffffffffffffe7ee,%rax
+  80667b:	ff ff ff 
+  80667e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806682:	48 89 c7             	mov    %rax,%rdi
+  806685:	49 89 df             	mov    %rbx,%r15
+  806688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80668d:	49 b8 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%r8
+  806694:	ff ff ff 
+  806697:	49 01 d8             	add    %rbx,%r8
+  80669a:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  80669d:	e9 1b ff ff ff       	jmp    8065bd <_pipeisclosed+0x29>
+	}
+}
+  8066a2:	48 83 c4 28          	add    $0x28,%rsp
+  8066a6:	5b                   	pop    %rbx
+  8066a7:	41 5c                	pop    %r12
+  8066a9:	41 5f                	pop    %r15
+  8066ab:	5d                   	pop    %rbp
+  8066ac:	c3                   	ret
+
+00000000008066ad <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8066ad:	55                   	push   %rbp
+  8066ae:	48 89 e5             	mov    %rsp,%rbp
+  8066b1:	41 57                	push   %r15
+  8066b3:	53                   	push   %rbx
+  8066b4:	48 83 ec 30          	sub    $0x30,%rsp
+  8066b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8066b8 <pipeisclosed+0xb>
+  8066bf:	49 bb 88 29 00 00 00 	movabs $0x2988,%r11
+  8066c6:	00 00 00 
+  8066c9:	4c 01 db             	add    %r11,%rbx
+  8066cc:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8066cf:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8066d3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8066d6:	48 89 d6             	mov    %rdx,%rsi
+  8066d9:	89 c7                	mov    %eax,%edi
+  8066db:	49 89 df             	mov    %rbx,%r15
+  8066de:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  8066e5:	ff ff ff 
+  8066e8:	48 01 d8             	add    %rbx,%rax
+  8066eb:	ff d0                	call   *%rax
+  8066ed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8066f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066f4:	79 05                	jns    8066fb <pipeisclosed+0x4e>
+		return r;
+  8066f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066f9:	eb 3b                	jmp    806736 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8066fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8066ff:	48 89 c7             	mov    %rax,%rdi
+  806702:	49 89 df             	mov    %rbx,%r15
+  806705:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  80670c:	ff ff ff 
+  80670f:	48 01 d8             	add    %rbx,%rax
+  806712:	ff d0                	call   *%rax
+  806714:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806718:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80671c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806720:	48 89 d6             	mov    %rdx,%rsi
+  806723:	48 89 c7             	mov    %rax,%rdi
+  806726:	48 b8 54 d5 ff ff ff 	movabs $0xffffffffffffd554,%rax
+  80672d:	ff ff ff 
+  806730:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806734:	ff d0                	call   *%rax
+}
+  806736:	48 83 c4 30          	add    $0x30,%rsp
+  80673a:	5b                   	pop    %rbx
+  80673b:	41 5f                	pop    %r15
+  80673d:	5d                   	pop    %rbp
+  80673e:	c3                   	ret
+
+000000000080673f <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80673f:	55                   	push   %rbp
+  806740:	48 89 e5             	mov    %rsp,%rbp
+  806743:	41 57                	push   %r15
+  806745:	53                   	push   %rbx
+  806746:	48 83 ec 40          	sub    $0x40,%rsp
+  80674a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80674a <devpipe_read+0xb>
+  806751:	49 bb f6 28 00 00 00 	movabs $0x28f6,%r11
+  806758:	00 00 00 
+  80675b:	4c 01 db             	add    %r11,%rbx
+  80675e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806762:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806766:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  80676a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80676e:	48 89 c7             	mov    %rax,%rdi
+  806771:	49 89 df             	mov    %rbx,%r15
+  806774:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  80677b:	ff ff ff 
+  80677e:	48 01 d8             	add    %rbx,%rax
+  806781:	ff d0                	call   *%rax
+  806783:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806787:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80678b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80678f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806796:	00 
+  806797:	e9 a1 00 00 00       	jmp    80683d <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  80679c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8067a1:	74 09                	je     8067ac <devpipe_read+0x6d>
+				return i;
+  8067a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8067a7:	e9 9f 00 00 00       	jmp    80684b <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8067ac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8067b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8067b4:	48 89 d6             	mov    %rdx,%rsi
+  8067b7:	48 89 c7             	mov    %rax,%rdi
+  8067ba:	48 b8 54 d5 ff ff ff 	movabs $0xffffffffffffd554,%rax
+  8067c1:	ff ff ff 
+  8067c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8067c8:	ff d0                	call   *%rax
+  8067ca:	85 c0                	test   %eax,%eax
+  8067cc:	74 07                	je     8067d5 <devpipe_read+0x96>
+				return 0;
+  8067ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067d3:	eb 76                	jmp    80684b <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8067d5:	49 89 df             	mov    %rbx,%r15
+  8067d8:	48 b8 dd 93 ff ff ff 	movabs $0xffffffffffff93dd,%rax
+  8067df:	ff ff ff 
+  8067e2:	48 01 d8             	add    %rbx,%rax
+  8067e5:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8067e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067eb:	8b 10                	mov    (%rax),%edx
+  8067ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067f1:	8b 40 04             	mov    0x4(%rax),%eax
+  8067f4:	39 c2                	cmp    %eax,%edx
+  8067f6:	74 a4                	je     80679c <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8067f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067fc:	8b 10                	mov    (%rax),%edx
+  8067fe:	89 d0                	mov    %edx,%eax
+  806800:	c1 f8 1f             	sar    $0x1f,%eax
+  806803:	c1 e8 1b             	shr    $0x1b,%eax
+  806806:	01 c2                	add    %eax,%edx
+  806808:	83 e2 1f             	and    $0x1f,%edx
+  80680b:	29 c2                	sub    %eax,%edx
+  80680d:	89 d6                	mov    %edx,%esi
+  80680f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806813:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806817:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80681b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80681f:	48 63 c6             	movslq %esi,%rax
+  806822:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806827:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806829:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80682d:	8b 00                	mov    (%rax),%eax
+  80682f:	8d 50 01             	lea    0x1(%rax),%edx
+  806832:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806836:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806838:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80683d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806841:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806845:	72 a0                	jb     8067e7 <devpipe_read+0xa8>
+	}
+	return i;
+  806847:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80684b:	48 83 c4 40          	add    $0x40,%rsp
+  80684f:	5b                   	pop    %rbx
+  806850:	41 5f                	pop    %r15
+  806852:	5d                   	pop    %rbp
+  806853:	c3                   	ret
+
+0000000000806854 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806854:	55                   	push   %rbp
+  806855:	48 89 e5             	mov    %rsp,%rbp
+  806858:	41 57                	push   %r15
+  80685a:	53                   	push   %rbx
+  80685b:	48 83 ec 40          	sub    $0x40,%rsp
+  80685f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80685f <devpipe_write+0xb>
+  806866:	49 bb e1 27 00 00 00 	movabs $0x27e1,%r11
+  80686d:	00 00 00 
+  806870:	4c 01 db             	add    %r11,%rbx
+  806873:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806877:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80687b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80687f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806883:	48 89 c7             	mov    %rax,%rdi
+  806886:	49 89 df             	mov    %rbx,%r15
+  806889:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  806890:	ff ff ff 
+  806893:	48 01 d8             	add    %rbx,%rax
+  806896:	ff d0                	call   *%rax
+  806898:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80689c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8068a0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8068a4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8068ab:	00 
+  8068ac:	e9 a0 00 00 00       	jmp    806951 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8068b1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8068b5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8068b9:	48 89 d6             	mov    %rdx,%rsi
+  8068bc:	48 89 c7             	mov    %rax,%rdi
+  8068bf:	48 b8 54 d5 ff ff ff 	movabs $0xffffffffffffd554,%rax
+  8068c6:	ff ff ff 
+  8068c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8068cd:	ff d0                	call   *%rax
+  8068cf:	85 c0                	test   %eax,%eax
+  8068d1:	74 0a                	je     8068dd <devpipe_write+0x89>
+				return 0;
+  8068d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068d8:	e9 82 00 00 00       	jmp    80695f <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8068dd:	49 89 df             	mov    %rbx,%r15
+  8068e0:	48 b8 dd 93 ff ff ff 	movabs $0xffffffffffff93dd,%rax
+  8068e7:	ff ff ff 
+  8068ea:	48 01 d8             	add    %rbx,%rax
+  8068ed:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8068ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8068f3:	8b 40 04             	mov    0x4(%rax),%eax
+  8068f6:	48 63 d0             	movslq %eax,%rdx
+  8068f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8068fd:	8b 00                	mov    (%rax),%eax
+  8068ff:	48 98                	cltq
+  806901:	48 83 c0 20          	add    $0x20,%rax
+  806905:	48 39 c2             	cmp    %rax,%rdx
+  806908:	73 a7                	jae    8068b1 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80690a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80690e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806912:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806916:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80691a:	8b 50 04             	mov    0x4(%rax),%edx
+  80691d:	89 d0                	mov    %edx,%eax
+  80691f:	c1 f8 1f             	sar    $0x1f,%eax
+  806922:	c1 e8 1b             	shr    $0x1b,%eax
+  806925:	01 c2                	add    %eax,%edx
+  806927:	83 e2 1f             	and    $0x1f,%edx
+  80692a:	29 c2                	sub    %eax,%edx
+  80692c:	89 d0                	mov    %edx,%eax
+  80692e:	0f b6 09             	movzbl (%rcx),%ecx
+  806931:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806935:	48 98                	cltq
+  806937:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  80693b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80693f:	8b 40 04             	mov    0x4(%rax),%eax
+  806942:	8d 50 01             	lea    0x1(%rax),%edx
+  806945:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806949:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  80694c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806951:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806955:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806959:	72 94                	jb     8068ef <devpipe_write+0x9b>
+	}
+
+	return i;
+  80695b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80695f:	48 83 c4 40          	add    $0x40,%rsp
+  806963:	5b                   	pop    %rbx
+  806964:	41 5f                	pop    %r15
+  806966:	5d                   	pop    %rbp
+  806967:	c3                   	ret
+
+0000000000806968 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806968:	55                   	push   %rbp
+  806969:	48 89 e5             	mov    %rsp,%rbp
+  80696c:	41 57                	push   %r15
+  80696e:	53                   	push   %rbx
+  80696f:	48 83 ec 20          	sub    $0x20,%rsp
+  806973:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806973 <devpipe_stat+0xb>
+  80697a:	49 bb cd 26 00 00 00 	movabs $0x26cd,%r11
+  806981:	00 00 00 
+  806984:	4c 01 db             	add    %r11,%rbx
+  806987:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80698b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80698f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806993:	48 89 c7             	mov    %rax,%rdi
+  806996:	49 89 df             	mov    %rbx,%r15
+  806999:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  8069a0:	ff ff ff 
+  8069a3:	48 01 d8             	add    %rbx,%rax
+  8069a6:	ff d0                	call   *%rax
+  8069a8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8069ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8069b0:	48 ba 01 e8 ff ff ff 	movabs $0xffffffffffffe801,%rdx
+  8069b7:	ff ff ff 
+  8069ba:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8069be:	48 89 d6             	mov    %rdx,%rsi
+  8069c1:	48 89 c7             	mov    %rax,%rdi
+  8069c4:	49 89 df             	mov    %rbx,%r15
+  8069c7:	48 b8 76 87 ff ff ff 	movabs $0xffffffffffff8776,%rax
+  8069ce:	ff ff ff 
+  8069d1:	48 01 d8             	add    %rbx,%rax
+  8069d4:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8069d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8069da:	8b 50 04             	mov    0x4(%rax),%edx
+  8069dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8069e1:	8b 00                	mov    (%rax),%eax
+  8069e3:	29 c2                	sub    %eax,%edx
+  8069e5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8069e9:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8069ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8069f3:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8069fa:	00 00 00 
+	stat->st_dev = &devpipe;
+  8069fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806a01:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806a08:	00 00 00 
+  806a0b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806a0f:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806a16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a1b:	48 83 c4 20          	add    $0x20,%rsp
+  806a1f:	5b                   	pop    %rbx
+  806a20:	41 5f                	pop    %r15
+  806a22:	5d                   	pop    %rbp
+  806a23:	c3                   	ret
+
+0000000000806a24 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806a24:	55                   	push   %rbp
+  806a25:	48 89 e5             	mov    %rsp,%rbp
+  806a28:	41 57                	push   %r15
+  806a2a:	53                   	push   %rbx
+  806a2b:	48 83 ec 10          	sub    $0x10,%rsp
+  806a2f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a2f <devpipe_close+0xb>
+  806a36:	49 bb 11 26 00 00 00 	movabs $0x2611,%r11
+  806a3d:	00 00 00 
+  806a40:	4c 01 db             	add    %r11,%rbx
+  806a43:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806a47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806a4b:	48 89 c6             	mov    %rax,%rsi
+  806a4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a53:	49 89 df             	mov    %rbx,%r15
+  806a56:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  806a5d:	ff ff ff 
+  806a60:	48 01 d8             	add    %rbx,%rax
+  806a63:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  806a65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806a69:	48 89 c7             	mov    %rax,%rdi
+  806a6c:	49 89 df             	mov    %rbx,%r15
+  806a6f:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  806a76:	ff ff ff 
+  806a79:	48 01 d8             	add    %rbx,%rax
+  806a7c:	ff d0                	call   *%rax
+  806a7e:	48 89 c6             	mov    %rax,%rsi
+  806a81:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a86:	49 89 df             	mov    %rbx,%r15
+  806a89:	48 b8 0a 95 ff ff ff 	movabs $0xffffffffffff950a,%rax
+  806a90:	ff ff ff 
+  806a93:	48 01 d8             	add    %rbx,%rax
+  806a96:	ff d0                	call   *%rax
+}
+  806a98:	48 83 c4 10          	add    $0x10,%rsp
+  806a9c:	5b                   	pop    %rbx
+  806a9d:	41 5f                	pop    %r15
+  806a9f:	5d                   	pop    %rbp
+  806aa0:	c3                   	ret
+
+0000000000806aa1 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  806aa1:	55                   	push   %rbp
+  806aa2:	48 89 e5             	mov    %rsp,%rbp
+  806aa5:	41 57                	push   %r15
+  806aa7:	48 83 ec 28          	sub    $0x28,%rsp
+  806aab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806aab <cputchar+0xa>
+  806ab2:	49 bb 95 25 00 00 00 	movabs $0x2595,%r11
+  806ab9:	00 00 00 
+  806abc:	4c 01 d8             	add    %r11,%rax
+  806abf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806ac2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806ac5:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806ac8:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806acc:	be 01 00 00 00       	mov    $0x1,%esi
+  806ad1:	48 89 d7             	mov    %rdx,%rdi
+  806ad4:	49 89 c7             	mov    %rax,%r15
+  806ad7:	48 ba 7a 92 ff ff ff 	movabs $0xffffffffffff927a,%rdx
+  806ade:	ff ff ff 
+  806ae1:	48 01 c2             	add    %rax,%rdx
+  806ae4:	ff d2                	call   *%rdx
+}
+  806ae6:	90                   	nop
+  806ae7:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806aeb:	c9                   	leave
+  806aec:	c3                   	ret
+
+0000000000806aed <getchar>:
+
+int
+getchar(void)
+{
+  806aed:	55                   	push   %rbp
+  806aee:	48 89 e5             	mov    %rsp,%rbp
+  806af1:	41 57                	push   %r15
+  806af3:	48 83 ec 18          	sub    $0x18,%rsp
+  806af7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806af7 <getchar+0xa>
+  806afe:	49 bb 49 25 00 00 00 	movabs $0x2549,%r11
+  806b05:	00 00 00 
+  806b08:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806b0b:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806b0f:	ba 01 00 00 00       	mov    $0x1,%edx
+  806b14:	48 89 ce             	mov    %rcx,%rsi
+  806b17:	bf 00 00 00 00       	mov    $0x0,%edi
+  806b1c:	49 89 c7             	mov    %rax,%r15
+  806b1f:	48 b9 aa b5 ff ff ff 	movabs $0xffffffffffffb5aa,%rcx
+  806b26:	ff ff ff 
+  806b29:	48 01 c1             	add    %rax,%rcx
+  806b2c:	ff d1                	call   *%rcx
+  806b2e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806b31:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b35:	79 05                	jns    806b3c <getchar+0x4f>
+		return r;
+  806b37:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b3a:	eb 14                	jmp    806b50 <getchar+0x63>
+	if (r < 1)
+  806b3c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b40:	7f 07                	jg     806b49 <getchar+0x5c>
+		return -E_EOF;
+  806b42:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806b47:	eb 07                	jmp    806b50 <getchar+0x63>
+	return c;
+  806b49:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806b4d:	0f b6 c0             	movzbl %al,%eax
+}
+  806b50:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806b54:	c9                   	leave
+  806b55:	c3                   	ret
+
+0000000000806b56 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806b56:	55                   	push   %rbp
+  806b57:	48 89 e5             	mov    %rsp,%rbp
+  806b5a:	41 57                	push   %r15
+  806b5c:	53                   	push   %rbx
+  806b5d:	48 83 ec 20          	sub    $0x20,%rsp
+  806b61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b61 <iscons+0xb>
+  806b68:	49 bb df 24 00 00 00 	movabs $0x24df,%r11
+  806b6f:	00 00 00 
+  806b72:	4c 01 db             	add    %r11,%rbx
+  806b75:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806b78:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806b7c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b7f:	48 89 d6             	mov    %rdx,%rsi
+  806b82:	89 c7                	mov    %eax,%edi
+  806b84:	49 89 df             	mov    %rbx,%r15
+  806b87:	48 b8 63 b0 ff ff ff 	movabs $0xffffffffffffb063,%rax
+  806b8e:	ff ff ff 
+  806b91:	48 01 d8             	add    %rbx,%rax
+  806b94:	ff d0                	call   *%rax
+  806b96:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b99:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b9d:	79 05                	jns    806ba4 <iscons+0x4e>
+		return r;
+  806b9f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ba2:	eb 1b                	jmp    806bbf <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  806ba4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ba8:	8b 10                	mov    (%rax),%edx
+  806baa:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  806bb1:	00 00 00 
+  806bb4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806bb7:	39 c2                	cmp    %eax,%edx
+  806bb9:	0f 94 c0             	sete   %al
+  806bbc:	0f b6 c0             	movzbl %al,%eax
+}
+  806bbf:	48 83 c4 20          	add    $0x20,%rsp
+  806bc3:	5b                   	pop    %rbx
+  806bc4:	41 5f                	pop    %r15
+  806bc6:	5d                   	pop    %rbp
+  806bc7:	c3                   	ret
+
+0000000000806bc8 <opencons>:
+
+int
+opencons(void)
+{
+  806bc8:	55                   	push   %rbp
+  806bc9:	48 89 e5             	mov    %rsp,%rbp
+  806bcc:	41 57                	push   %r15
+  806bce:	53                   	push   %rbx
+  806bcf:	48 83 ec 10          	sub    $0x10,%rsp
+  806bd3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806bd3 <opencons+0xb>
+  806bda:	49 bb 6d 24 00 00 00 	movabs $0x246d,%r11
+  806be1:	00 00 00 
+  806be4:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806be7:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806beb:	48 89 c7             	mov    %rax,%rdi
+  806bee:	49 89 df             	mov    %rbx,%r15
+  806bf1:	48 b8 ad af ff ff ff 	movabs $0xffffffffffffafad,%rax
+  806bf8:	ff ff ff 
+  806bfb:	48 01 d8             	add    %rbx,%rax
+  806bfe:	ff d0                	call   *%rax
+  806c00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806c03:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c07:	79 05                	jns    806c0e <opencons+0x46>
+		return r;
+  806c09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c0c:	eb 68                	jmp    806c76 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806c0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c12:	ba 07 04 00 00       	mov    $0x407,%edx
+  806c17:	48 89 c6             	mov    %rax,%rsi
+  806c1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  806c1f:	49 89 df             	mov    %rbx,%r15
+  806c22:	48 b8 32 94 ff ff ff 	movabs $0xffffffffffff9432,%rax
+  806c29:	ff ff ff 
+  806c2c:	48 01 d8             	add    %rbx,%rax
+  806c2f:	ff d0                	call   *%rax
+  806c31:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806c34:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c38:	79 05                	jns    806c3f <opencons+0x77>
+		return r;
+  806c3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c3d:	eb 37                	jmp    806c76 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806c3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c43:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806c4a:	00 00 00 
+  806c4d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806c50:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806c52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c56:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806c5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c61:	48 89 c7             	mov    %rax,%rdi
+  806c64:	49 89 df             	mov    %rbx,%r15
+  806c67:	48 b8 33 af ff ff ff 	movabs $0xffffffffffffaf33,%rax
+  806c6e:	ff ff ff 
+  806c71:	48 01 d8             	add    %rbx,%rax
+  806c74:	ff d0                	call   *%rax
+}
+  806c76:	48 83 c4 10          	add    $0x10,%rsp
+  806c7a:	5b                   	pop    %rbx
+  806c7b:	41 5f                	pop    %r15
+  806c7d:	5d                   	pop    %rbp
+  806c7e:	c3                   	ret
+
+0000000000806c7f <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806c7f:	55                   	push   %rbp
+  806c80:	48 89 e5             	mov    %rsp,%rbp
+  806c83:	41 57                	push   %r15
+  806c85:	53                   	push   %rbx
+  806c86:	48 83 ec 30          	sub    $0x30,%rsp
+  806c8a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c8a <devcons_read+0xb>
+  806c91:	49 bb b6 23 00 00 00 	movabs $0x23b6,%r11
+  806c98:	00 00 00 
+  806c9b:	4c 01 db             	add    %r11,%rbx
+  806c9e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806ca2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806ca6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806caa:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806caf:	75 19                	jne    806cca <devcons_read+0x4b>
+		return 0;
+  806cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cb6:	eb 55                	jmp    806d0d <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806cb8:	49 89 df             	mov    %rbx,%r15
+  806cbb:	48 b8 dd 93 ff ff ff 	movabs $0xffffffffffff93dd,%rax
+  806cc2:	ff ff ff 
+  806cc5:	48 01 d8             	add    %rbx,%rax
+  806cc8:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806cca:	49 89 df             	mov    %rbx,%r15
+  806ccd:	48 b8 d9 92 ff ff ff 	movabs $0xffffffffffff92d9,%rax
+  806cd4:	ff ff ff 
+  806cd7:	48 01 d8             	add    %rbx,%rax
+  806cda:	ff d0                	call   *%rax
+  806cdc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806cdf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ce3:	74 d3                	je     806cb8 <devcons_read+0x39>
+	if (c < 0)
+  806ce5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ce9:	79 05                	jns    806cf0 <devcons_read+0x71>
+		return c;
+  806ceb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806cee:	eb 1d                	jmp    806d0d <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806cf0:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806cf4:	75 07                	jne    806cfd <devcons_read+0x7e>
+		return 0;
+  806cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cfb:	eb 10                	jmp    806d0d <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806cfd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d00:	89 c2                	mov    %eax,%edx
+  806d02:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806d06:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806d08:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806d0d:	48 83 c4 30          	add    $0x30,%rsp
+  806d11:	5b                   	pop    %rbx
+  806d12:	41 5f                	pop    %r15
+  806d14:	5d                   	pop    %rbp
+  806d15:	c3                   	ret
+
+0000000000806d16 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806d16:	55                   	push   %rbp
+  806d17:	48 89 e5             	mov    %rsp,%rbp
+  806d1a:	41 57                	push   %r15
+  806d1c:	53                   	push   %rbx
+  806d1d:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806d24:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806d24 <devcons_write+0xe>
+  806d2b:	49 bb 1c 23 00 00 00 	movabs $0x231c,%r11
+  806d32:	00 00 00 
+  806d35:	4c 01 db             	add    %r11,%rbx
+  806d38:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806d3f:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806d46:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806d4d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806d54:	e9 80 00 00 00       	jmp    806dd9 <devcons_write+0xc3>
+		m = n - tot;
+  806d59:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806d60:	89 c2                	mov    %eax,%edx
+  806d62:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d65:	29 c2                	sub    %eax,%edx
+  806d67:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806d6a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806d6d:	83 f8 7f             	cmp    $0x7f,%eax
+  806d70:	76 07                	jbe    806d79 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806d72:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806d79:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806d7c:	48 63 d0             	movslq %eax,%rdx
+  806d7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d82:	48 63 c8             	movslq %eax,%rcx
+  806d85:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806d8c:	48 01 c1             	add    %rax,%rcx
+  806d8f:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806d96:	48 89 ce             	mov    %rcx,%rsi
+  806d99:	48 89 c7             	mov    %rax,%rdi
+  806d9c:	49 89 df             	mov    %rbx,%r15
+  806d9f:	48 b8 56 8b ff ff ff 	movabs $0xffffffffffff8b56,%rax
+  806da6:	ff ff ff 
+  806da9:	48 01 d8             	add    %rbx,%rax
+  806dac:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806dae:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806db1:	48 63 d0             	movslq %eax,%rdx
+  806db4:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806dbb:	48 89 d6             	mov    %rdx,%rsi
+  806dbe:	48 89 c7             	mov    %rax,%rdi
+  806dc1:	49 89 df             	mov    %rbx,%r15
+  806dc4:	48 b8 7a 92 ff ff ff 	movabs $0xffffffffffff927a,%rax
+  806dcb:	ff ff ff 
+  806dce:	48 01 d8             	add    %rbx,%rax
+  806dd1:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806dd3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806dd6:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806dd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ddc:	48 98                	cltq
+  806dde:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806de5:	0f 82 6e ff ff ff    	jb     806d59 <devcons_write+0x43>
+	}
+	return tot;
+  806deb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806dee:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806df5:	5b                   	pop    %rbx
+  806df6:	41 5f                	pop    %r15
+  806df8:	5d                   	pop    %rbp
+  806df9:	c3                   	ret
+
+0000000000806dfa <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806dfa:	55                   	push   %rbp
+  806dfb:	48 89 e5             	mov    %rsp,%rbp
+  806dfe:	48 83 ec 08          	sub    $0x8,%rsp
+  806e02:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e02 <devcons_close+0x8>
+  806e09:	49 bb 3e 22 00 00 00 	movabs $0x223e,%r11
+  806e10:	00 00 00 
+  806e13:	4c 01 d8             	add    %r11,%rax
+  806e16:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806e1f:	c9                   	leave
+  806e20:	c3                   	ret
+
+0000000000806e21 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806e21:	55                   	push   %rbp
+  806e22:	48 89 e5             	mov    %rsp,%rbp
+  806e25:	41 57                	push   %r15
+  806e27:	48 83 ec 18          	sub    $0x18,%rsp
+  806e2b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e2b <devcons_stat+0xa>
+  806e32:	49 bb 15 22 00 00 00 	movabs $0x2215,%r11
+  806e39:	00 00 00 
+  806e3c:	4c 01 d8             	add    %r11,%rax
+  806e3f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806e43:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806e47:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806e4b:	48 b9 0d e8 ff ff ff 	movabs $0xffffffffffffe80d,%rcx
+  806e52:	ff ff ff 
+  806e55:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806e59:	48 89 ce             	mov    %rcx,%rsi
+  806e5c:	48 89 d7             	mov    %rdx,%rdi
+  806e5f:	49 89 c7             	mov    %rax,%r15
+  806e62:	48 ba 76 87 ff ff ff 	movabs $0xffffffffffff8776,%rdx
+  806e69:	ff ff ff 
+  806e6c:	48 01 c2             	add    %rax,%rdx
+  806e6f:	ff d2                	call   *%rdx
+	return 0;
+  806e71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806e76:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806e7a:	c9                   	leave
+  806e7b:	c3                   	ret
+
+0000000000806e7c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806e7c:	55                   	push   %rbp
+  806e7d:	48 89 e5             	mov    %rsp,%rbp
+  806e80:	41 57                	push   %r15
+  806e82:	53                   	push   %rbx
+  806e83:	48 83 ec 20          	sub    $0x20,%rsp
+  806e87:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806e87 <set_pgfault_handler+0xb>
+  806e8e:	49 bb b9 21 00 00 00 	movabs $0x21b9,%r11
+  806e95:	00 00 00 
+  806e98:	4c 01 db             	add    %r11,%rbx
+  806e9b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806e9f:	49 89 df             	mov    %rbx,%r15
+  806ea2:	48 b8 89 93 ff ff ff 	movabs $0xffffffffffff9389,%rax
+  806ea9:	ff ff ff 
+  806eac:	48 01 d8             	add    %rbx,%rax
+  806eaf:	ff d0                	call   *%rax
+  806eb1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806eb4:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806ebb:	00 00 00 
+  806ebe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806ec2:	48 85 c0             	test   %rax,%rax
+  806ec5:	75 6b                	jne    806f32 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806ec7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806eca:	ba 07 00 00 00       	mov    $0x7,%edx
+  806ecf:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806ed4:	48 89 ce             	mov    %rcx,%rsi
+  806ed7:	89 c7                	mov    %eax,%edi
+  806ed9:	49 89 df             	mov    %rbx,%r15
+  806edc:	48 b8 32 94 ff ff ff 	movabs $0xffffffffffff9432,%rax
+  806ee3:	ff ff ff 
+  806ee6:	48 01 d8             	add    %rbx,%rax
+  806ee9:	ff d0                	call   *%rax
+  806eeb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806eee:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806ef2:	74 3e                	je     806f32 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806ef4:	48 b8 18 e8 ff ff ff 	movabs $0xffffffffffffe818,%rax
+  806efb:	ff ff ff 
+  806efe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806f02:	48 89 c2             	mov    %rax,%rdx
+  806f05:	be 23 00 00 00       	mov    $0x23,%esi
+  806f0a:	48 b8 46 e8 ff ff ff 	movabs $0xffffffffffffe846,%rax
+  806f11:	ff ff ff 
+  806f14:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806f18:	48 89 c7             	mov    %rax,%rdi
+  806f1b:	49 89 df             	mov    %rbx,%r15
+  806f1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f23:	48 b9 dd 76 ff ff ff 	movabs $0xffffffffffff76dd,%rcx
+  806f2a:	ff ff ff 
+  806f2d:	48 01 d9             	add    %rbx,%rcx
+  806f30:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806f32:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806f39:	00 00 00 
+  806f3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806f40:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806f44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806f47:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806f4e:	ff ff ff 
+  806f51:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806f55:	48 89 d6             	mov    %rdx,%rsi
+  806f58:	89 c7                	mov    %eax,%edi
+  806f5a:	49 89 df             	mov    %rbx,%r15
+  806f5d:	48 b8 28 96 ff ff ff 	movabs $0xffffffffffff9628,%rax
+  806f64:	ff ff ff 
+  806f67:	48 01 d8             	add    %rbx,%rax
+  806f6a:	ff d0                	call   *%rax
+}
+  806f6c:	90                   	nop
+  806f6d:	48 83 c4 20          	add    $0x20,%rsp
+  806f71:	5b                   	pop    %rbx
+  806f72:	41 5f                	pop    %r15
+  806f74:	5d                   	pop    %rbp
+  806f75:	c3                   	ret
+
+0000000000806f76 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806f76:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806f79:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806f80:	00 00 00 
+call *%rax
+  806f83:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806f85:	58                   	pop    %rax
+	popq %rax;
+  806f86:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806f87:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806f8e:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806f92:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806f96:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806f9a:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806f9e:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806fa2:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806fa5:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806fa9:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806fad:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806fb2:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806fb7:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806fbc:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806fc1:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806fc6:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806fcb:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806fd0:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806fd5:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806fda:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806fdf:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806fe4:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806fe9:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806fee:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806ff3:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806ff7:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806ffb:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806ffc:	5c                   	pop    %rsp
+	ret;			//return
+  806ffd:	c3                   	ret
+
+0000000000806ffe <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806ffe:	55                   	push   %rbp
+  806fff:	48 89 e5             	mov    %rsp,%rbp
+  807002:	48 83 ec 18          	sub    $0x18,%rsp
+  807006:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807006 <pageref+0x8>
+  80700d:	49 bb 3a 20 00 00 00 	movabs $0x203a,%r11
+  807014:	00 00 00 
+  807017:	4c 01 d8             	add    %r11,%rax
+  80701a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80701e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807022:	48 89 d1             	mov    %rdx,%rcx
+  807025:	48 c1 e9 15          	shr    $0x15,%rcx
+  807029:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  807030:	ff ff ff 
+  807033:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807037:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80703b:	83 e2 01             	and    $0x1,%edx
+  80703e:	48 85 d2             	test   %rdx,%rdx
+  807041:	75 07                	jne    80704a <pageref+0x4c>
+		return 0;
+  807043:	b8 00 00 00 00       	mov    $0x0,%eax
+  807048:	eb 64                	jmp    8070ae <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  80704a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80704e:	48 89 d1             	mov    %rdx,%rcx
+  807051:	48 c1 e9 0c          	shr    $0xc,%rcx
+  807055:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80705c:	ff ff ff 
+  80705f:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807063:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807067:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  80706b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80706f:	83 e2 01             	and    $0x1,%edx
+  807072:	48 85 d2             	test   %rdx,%rdx
+  807075:	75 07                	jne    80707e <pageref+0x80>
+		return 0;
+  807077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80707c:	eb 30                	jmp    8070ae <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  80707e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  807082:	48 c1 ea 0c          	shr    $0xc,%rdx
+  807086:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80708d:	ff ff ff 
+  807090:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  807094:	48 89 d0             	mov    %rdx,%rax
+  807097:	48 01 c0             	add    %rax,%rax
+  80709a:	48 01 d0             	add    %rdx,%rax
+  80709d:	48 c1 e0 03          	shl    $0x3,%rax
+  8070a1:	48 01 c8             	add    %rcx,%rax
+  8070a4:	48 83 c0 08          	add    $0x8,%rax
+  8070a8:	0f b7 00             	movzwl (%rax),%eax
+  8070ab:	0f b7 c0             	movzwl %ax,%eax
+}
+  8070ae:	c9                   	leave
+  8070af:	c3                   	ret
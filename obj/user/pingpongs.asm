@@ -0,0 +1,10592 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 37 02 00 00       	call   800278 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+uint32_t val;
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	41 56                	push   %r14
+  80004b:	41 55                	push   %r13
+  80004d:	41 54                	push   %r12
+  80004f:	53                   	push   %rbx
+  800050:	48 83 ec 28          	sub    $0x28,%rsp
+  800054:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800054 <umain+0x11>
+  80005b:	49 bb ec 8f 00 00 00 	movabs $0x8fec,%r11
+  800062:	00 00 00 
+  800065:	4c 01 db             	add    %r11,%rbx
+  800068:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80006b:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+	envid_t who;
+	uint32_t i;
+
+	i = 0;
+  80006f:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+	if ((who = sfork()) != 0) {
+  800076:	49 89 df             	mov    %rbx,%r15
+  800079:	48 b8 16 a2 ff ff ff 	movabs $0xffffffffffffa216,%rax
+  800080:	ff ff ff 
+  800083:	48 01 d8             	add    %rbx,%rax
+  800086:	ff d0                	call   *%rax
+  800088:	89 45 c8             	mov    %eax,-0x38(%rbp)
+  80008b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80008e:	85 c0                	test   %eax,%eax
+  800090:	0f 84 b9 00 00 00    	je     80014f <umain+0x10c>
+		cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800096:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80009d:	ff ff ff 
+  8000a0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8000a4:	4c 8b 20             	mov    (%rax),%r12
+  8000a7:	49 89 df             	mov    %rbx,%r15
+  8000aa:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  8000b1:	ff ff ff 
+  8000b4:	48 01 d8             	add    %rbx,%rax
+  8000b7:	ff d0                	call   *%rax
+  8000b9:	4c 89 e2             	mov    %r12,%rdx
+  8000bc:	89 c6                	mov    %eax,%esi
+  8000be:	48 b8 d8 dc ff ff ff 	movabs $0xffffffffffffdcd8,%rax
+  8000c5:	ff ff ff 
+  8000c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000cc:	48 89 c7             	mov    %rax,%rdi
+  8000cf:	49 89 df             	mov    %rbx,%r15
+  8000d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d7:	48 b9 c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rcx
+  8000de:	ff ff ff 
+  8000e1:	48 01 d9             	add    %rbx,%rcx
+  8000e4:	ff d1                	call   *%rcx
+		// get the ball rolling
+		cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000e6:	44 8b 65 c8          	mov    -0x38(%rbp),%r12d
+  8000ea:	49 89 df             	mov    %rbx,%r15
+  8000ed:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  8000f4:	ff ff ff 
+  8000f7:	48 01 d8             	add    %rbx,%rax
+  8000fa:	ff d0                	call   *%rax
+  8000fc:	44 89 e2             	mov    %r12d,%edx
+  8000ff:	89 c6                	mov    %eax,%esi
+  800101:	48 b8 f2 dc ff ff ff 	movabs $0xffffffffffffdcf2,%rax
+  800108:	ff ff ff 
+  80010b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80010f:	48 89 c7             	mov    %rax,%rdi
+  800112:	49 89 df             	mov    %rbx,%r15
+  800115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011a:	48 b9 c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rcx
+  800121:	ff ff ff 
+  800124:	48 01 d9             	add    %rbx,%rcx
+  800127:	ff d1                	call   *%rcx
+		ipc_send(who, 0, 0, 0);
+  800129:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80012c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800131:	ba 00 00 00 00       	mov    $0x0,%edx
+  800136:	be 00 00 00 00       	mov    $0x0,%esi
+  80013b:	89 c7                	mov    %eax,%edi
+  80013d:	49 89 df             	mov    %rbx,%r15
+  800140:	48 b8 5c a3 ff ff ff 	movabs $0xffffffffffffa35c,%rax
+  800147:	ff ff ff 
+  80014a:	48 01 d8             	add    %rbx,%rax
+  80014d:	ff d0                	call   *%rax
+	}
+
+	while (1) {
+		ipc_recv(&who, 0, 0);
+  80014f:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  800153:	ba 00 00 00 00       	mov    $0x0,%edx
+  800158:	be 00 00 00 00       	mov    $0x0,%esi
+  80015d:	48 89 c7             	mov    %rax,%rdi
+  800160:	49 89 df             	mov    %rbx,%r15
+  800163:	48 b8 73 a2 ff ff ff 	movabs $0xffffffffffffa273,%rax
+  80016a:	ff ff ff 
+  80016d:	48 01 d8             	add    %rbx,%rax
+  800170:	ff d0                	call   *%rax
+		cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800172:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800179:	ff ff ff 
+  80017c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800180:	48 8b 00             	mov    (%rax),%rax
+  800183:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800189:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80018c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800193:	ff ff ff 
+  800196:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80019a:	4c 8b 30             	mov    (%rax),%r14
+  80019d:	44 8b 6d c8          	mov    -0x38(%rbp),%r13d
+  8001a1:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  8001a8:	00 00 00 
+  8001ab:	44 8b 24 03          	mov    (%rbx,%rax,1),%r12d
+  8001af:	49 89 df             	mov    %rbx,%r15
+  8001b2:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  8001b9:	ff ff ff 
+  8001bc:	48 01 d8             	add    %rbx,%rax
+  8001bf:	ff d0                	call   *%rax
+  8001c1:	44 8b 4d b8          	mov    -0x48(%rbp),%r9d
+  8001c5:	4d 89 f0             	mov    %r14,%r8
+  8001c8:	44 89 e9             	mov    %r13d,%ecx
+  8001cb:	44 89 e2             	mov    %r12d,%edx
+  8001ce:	89 c6                	mov    %eax,%esi
+  8001d0:	48 b8 08 dd ff ff ff 	movabs $0xffffffffffffdd08,%rax
+  8001d7:	ff ff ff 
+  8001da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001de:	48 89 c7             	mov    %rax,%rdi
+  8001e1:	49 89 df             	mov    %rbx,%r15
+  8001e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e9:	49 ba c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%r10
+  8001f0:	ff ff ff 
+  8001f3:	49 01 da             	add    %rbx,%r10
+  8001f6:	41 ff d2             	call   *%r10
+		if (val == 10)
+  8001f9:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  800200:	00 00 00 
+  800203:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800206:	83 f8 0a             	cmp    $0xa,%eax
+  800209:	74 5a                	je     800265 <umain+0x222>
+			return;
+		++val;
+  80020b:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  800212:	00 00 00 
+  800215:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800218:	8d 50 01             	lea    0x1(%rax),%edx
+  80021b:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  800222:	00 00 00 
+  800225:	89 14 03             	mov    %edx,(%rbx,%rax,1)
+		ipc_send(who, 0, 0, 0);
+  800228:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80022b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800230:	ba 00 00 00 00       	mov    $0x0,%edx
+  800235:	be 00 00 00 00       	mov    $0x0,%esi
+  80023a:	89 c7                	mov    %eax,%edi
+  80023c:	49 89 df             	mov    %rbx,%r15
+  80023f:	48 b8 5c a3 ff ff ff 	movabs $0xffffffffffffa35c,%rax
+  800246:	ff ff ff 
+  800249:	48 01 d8             	add    %rbx,%rax
+  80024c:	ff d0                	call   *%rax
+		if (val == 10)
+  80024e:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  800255:	00 00 00 
+  800258:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80025b:	83 f8 0a             	cmp    $0xa,%eax
+  80025e:	74 08                	je     800268 <umain+0x225>
+		ipc_recv(&who, 0, 0);
+  800260:	e9 ea fe ff ff       	jmp    80014f <umain+0x10c>
+			return;
+  800265:	90                   	nop
+  800266:	eb 01                	jmp    800269 <umain+0x226>
+			return;
+  800268:	90                   	nop
+	}
+
+}
+  800269:	48 83 c4 28          	add    $0x28,%rsp
+  80026d:	5b                   	pop    %rbx
+  80026e:	41 5c                	pop    %r12
+  800270:	41 5d                	pop    %r13
+  800272:	41 5e                	pop    %r14
+  800274:	41 5f                	pop    %r15
+  800276:	5d                   	pop    %rbp
+  800277:	c3                   	ret
+
+0000000000800278 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800278:	55                   	push   %rbp
+  800279:	48 89 e5             	mov    %rsp,%rbp
+  80027c:	41 57                	push   %r15
+  80027e:	53                   	push   %rbx
+  80027f:	48 83 ec 20          	sub    $0x20,%rsp
+  800283:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800283 <libmain+0xb>
+  80028a:	49 bb bd 8d 00 00 00 	movabs $0x8dbd,%r11
+  800291:	00 00 00 
+  800294:	4c 01 db             	add    %r11,%rbx
+  800297:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80029a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80029e:	49 89 df             	mov    %rbx,%r15
+  8002a1:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  8002a8:	ff ff ff 
+  8002ab:	48 01 d8             	add    %rbx,%rax
+  8002ae:	ff d0                	call   *%rax
+  8002b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8002b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002b6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002bb:	48 98                	cltq
+  8002bd:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8002c4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8002cb:	ff ff ff 
+  8002ce:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8002d2:	48 01 c2             	add    %rax,%rdx
+  8002d5:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8002dc:	00 00 00 
+  8002df:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002e3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8002e7:	7e 15                	jle    8002fe <libmain+0x86>
+		binaryname = argv[0];
+  8002e9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8002ed:	48 8b 00             	mov    (%rax),%rax
+  8002f0:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8002f7:	00 00 00 
+  8002fa:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8002fe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800302:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800305:	48 89 d6             	mov    %rdx,%rsi
+  800308:	89 c7                	mov    %eax,%edi
+  80030a:	49 89 df             	mov    %rbx,%r15
+  80030d:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800314:	ff ff ff 
+  800317:	48 01 d8             	add    %rbx,%rax
+  80031a:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80031c:	49 89 df             	mov    %rbx,%r15
+  80031f:	48 b8 f8 72 ff ff ff 	movabs $0xffffffffffff72f8,%rax
+  800326:	ff ff ff 
+  800329:	48 01 d8             	add    %rbx,%rax
+  80032c:	ff d0                	call   *%rax
+}
+  80032e:	90                   	nop
+  80032f:	48 83 c4 20          	add    $0x20,%rsp
+  800333:	5b                   	pop    %rbx
+  800334:	41 5f                	pop    %r15
+  800336:	5d                   	pop    %rbp
+  800337:	c3                   	ret
+
+0000000000800338 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800338:	55                   	push   %rbp
+  800339:	48 89 e5             	mov    %rsp,%rbp
+  80033c:	41 57                	push   %r15
+  80033e:	53                   	push   %rbx
+  80033f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80033f <exit+0x7>
+  800346:	49 bb 01 8d 00 00 00 	movabs $0x8d01,%r11
+  80034d:	00 00 00 
+  800350:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800353:	49 89 df             	mov    %rbx,%r15
+  800356:	48 b8 6a ae ff ff ff 	movabs $0xffffffffffffae6a,%rax
+  80035d:	ff ff ff 
+  800360:	48 01 d8             	add    %rbx,%rax
+  800363:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800365:	bf 00 00 00 00       	mov    $0x0,%edi
+  80036a:	49 89 df             	mov    %rbx,%r15
+  80036d:	48 b8 39 8e ff ff ff 	movabs $0xffffffffffff8e39,%rax
+  800374:	ff ff ff 
+  800377:	48 01 d8             	add    %rbx,%rax
+  80037a:	ff d0                	call   *%rax
+}
+  80037c:	90                   	nop
+  80037d:	5b                   	pop    %rbx
+  80037e:	41 5f                	pop    %r15
+  800380:	5d                   	pop    %rbp
+  800381:	c3                   	ret
+
+0000000000800382 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800382:	55                   	push   %rbp
+  800383:	48 89 e5             	mov    %rsp,%rbp
+  800386:	41 57                	push   %r15
+  800388:	48 83 ec 18          	sub    $0x18,%rsp
+  80038c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80038c <putch+0xa>
+  800393:	49 bb b4 8c 00 00 00 	movabs $0x8cb4,%r11
+  80039a:	00 00 00 
+  80039d:	4c 01 d8             	add    %r11,%rax
+  8003a0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8003a7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003ab:	8b 12                	mov    (%rdx),%edx
+  8003ad:	8d 72 01             	lea    0x1(%rdx),%esi
+  8003b0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8003b4:	89 31                	mov    %esi,(%rcx)
+  8003b6:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8003b9:	89 ce                	mov    %ecx,%esi
+  8003bb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8003bf:	48 63 d2             	movslq %edx,%rdx
+  8003c2:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8003c7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003cb:	8b 12                	mov    (%rdx),%edx
+  8003cd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003d3:	75 33                	jne    800408 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8003d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003d9:	8b 12                	mov    (%rdx),%edx
+  8003db:	48 63 d2             	movslq %edx,%rdx
+  8003de:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8003e2:	48 83 c1 08          	add    $0x8,%rcx
+  8003e6:	48 89 d6             	mov    %rdx,%rsi
+  8003e9:	48 89 cf             	mov    %rcx,%rdi
+  8003ec:	49 89 c7             	mov    %rax,%r15
+  8003ef:	48 ba 86 8d ff ff ff 	movabs $0xffffffffffff8d86,%rdx
+  8003f6:	ff ff ff 
+  8003f9:	48 01 c2             	add    %rax,%rdx
+  8003fc:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8003fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800402:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800408:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80040c:	8b 40 04             	mov    0x4(%rax),%eax
+  80040f:	8d 50 01             	lea    0x1(%rax),%edx
+  800412:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800416:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800419:	90                   	nop
+  80041a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80041e:	c9                   	leave
+  80041f:	c3                   	ret
+
+0000000000800420 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800420:	55                   	push   %rbp
+  800421:	48 89 e5             	mov    %rsp,%rbp
+  800424:	41 57                	push   %r15
+  800426:	53                   	push   %rbx
+  800427:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80042e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80042e <vcprintf+0xe>
+  800435:	49 bb 12 8c 00 00 00 	movabs $0x8c12,%r11
+  80043c:	00 00 00 
+  80043f:	4c 01 db             	add    %r11,%rbx
+  800442:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800449:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800450:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800457:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80045e:	48 8b 06             	mov    (%rsi),%rax
+  800461:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800465:	48 89 01             	mov    %rax,(%rcx)
+  800468:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80046c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800470:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800474:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  80047b:	00 00 00 
+    b.cnt = 0;
+  80047e:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800485:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800488:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80048f:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800496:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80049d:	48 89 c6             	mov    %rax,%rsi
+  8004a0:	48 b8 42 73 ff ff ff 	movabs $0xffffffffffff7342,%rax
+  8004a7:	ff ff ff 
+  8004aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004ae:	48 89 c7             	mov    %rax,%rdi
+  8004b1:	49 89 df             	mov    %rbx,%r15
+  8004b4:	48 b8 04 79 ff ff ff 	movabs $0xffffffffffff7904,%rax
+  8004bb:	ff ff ff 
+  8004be:	48 01 d8             	add    %rbx,%rax
+  8004c1:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8004c3:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8004c9:	48 98                	cltq
+  8004cb:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8004d2:	48 83 c2 08          	add    $0x8,%rdx
+  8004d6:	48 89 c6             	mov    %rax,%rsi
+  8004d9:	48 89 d7             	mov    %rdx,%rdi
+  8004dc:	49 89 df             	mov    %rbx,%r15
+  8004df:	48 b8 86 8d ff ff ff 	movabs $0xffffffffffff8d86,%rax
+  8004e6:	ff ff ff 
+  8004e9:	48 01 d8             	add    %rbx,%rax
+  8004ec:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8004ee:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8004f4:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8004fb:	5b                   	pop    %rbx
+  8004fc:	41 5f                	pop    %r15
+  8004fe:	5d                   	pop    %rbp
+  8004ff:	c3                   	ret
+
+0000000000800500 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800500:	55                   	push   %rbp
+  800501:	48 89 e5             	mov    %rsp,%rbp
+  800504:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80050b:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80050b <cprintf+0xb>
+  800512:	49 bb 35 8b 00 00 00 	movabs $0x8b35,%r11
+  800519:	00 00 00 
+  80051c:	4d 01 da             	add    %r11,%r10
+  80051f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800526:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80052d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800534:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80053b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800542:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800549:	84 c0                	test   %al,%al
+  80054b:	74 20                	je     80056d <cprintf+0x6d>
+  80054d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800551:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800555:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800559:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80055d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800561:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800565:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800569:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80056d:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800574:	00 00 00 
+  800577:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80057e:	00 00 00 
+  800581:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800585:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80058c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800593:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  80059a:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8005a1:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8005a8:	48 8b 06             	mov    (%rsi),%rax
+  8005ab:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005af:	48 89 01             	mov    %rax,(%rcx)
+  8005b2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005b6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005ba:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8005be:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8005c5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8005cc:	48 89 d6             	mov    %rdx,%rsi
+  8005cf:	48 89 c7             	mov    %rax,%rdi
+  8005d2:	48 b8 e0 73 ff ff ff 	movabs $0xffffffffffff73e0,%rax
+  8005d9:	ff ff ff 
+  8005dc:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8005e0:	ff d0                	call   *%rax
+  8005e2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8005e8:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8005ee:	c9                   	leave
+  8005ef:	c3                   	ret
+
+00000000008005f0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005f0:	55                   	push   %rbp
+  8005f1:	48 89 e5             	mov    %rsp,%rbp
+  8005f4:	53                   	push   %rbx
+  8005f5:	48 83 ec 38          	sub    $0x38,%rsp
+  8005f9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8005f9 <printnum+0x9>
+  800600:	49 bb 47 8a 00 00 00 	movabs $0x8a47,%r11
+  800607:	00 00 00 
+  80060a:	4c 01 db             	add    %r11,%rbx
+  80060d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800611:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800615:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800619:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80061c:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800620:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800624:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800627:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80062b:	72 58                	jb     800685 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80062d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800630:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800633:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800636:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80063a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063f:	48 f7 f6             	div    %rsi
+  800642:	49 89 c2             	mov    %rax,%r10
+  800645:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800648:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80064b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80064f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800653:	41 89 c9             	mov    %ecx,%r9d
+  800656:	41 89 f8             	mov    %edi,%r8d
+  800659:	89 d1                	mov    %edx,%ecx
+  80065b:	4c 89 d2             	mov    %r10,%rdx
+  80065e:	48 89 c7             	mov    %rax,%rdi
+  800661:	48 b8 b0 75 ff ff ff 	movabs $0xffffffffffff75b0,%rax
+  800668:	ff ff ff 
+  80066b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80066f:	ff d0                	call   *%rax
+  800671:	eb 1c                	jmp    80068f <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800673:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800677:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80067a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80067e:	48 89 d6             	mov    %rdx,%rsi
+  800681:	89 c7                	mov    %eax,%edi
+  800683:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800685:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800689:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80068d:	7f e4                	jg     800673 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80068f:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800692:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800696:	ba 00 00 00 00       	mov    $0x0,%edx
+  80069b:	48 f7 f1             	div    %rcx
+  80069e:	48 b8 6f de ff ff ff 	movabs $0xffffffffffffde6f,%rax
+  8006a5:	ff ff ff 
+  8006a8:	48 01 d8             	add    %rbx,%rax
+  8006ab:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8006af:	0f be c0             	movsbl %al,%eax
+  8006b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006b6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8006ba:	48 89 d6             	mov    %rdx,%rsi
+  8006bd:	89 c7                	mov    %eax,%edi
+  8006bf:	ff d1                	call   *%rcx
+}
+  8006c1:	90                   	nop
+  8006c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006c6:	c9                   	leave
+  8006c7:	c3                   	ret
+
+00000000008006c8 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8006c8:	55                   	push   %rbp
+  8006c9:	48 89 e5             	mov    %rsp,%rbp
+  8006cc:	48 83 ec 20          	sub    $0x20,%rsp
+  8006d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006d0 <getuint+0x8>
+  8006d7:	49 bb 70 89 00 00 00 	movabs $0x8970,%r11
+  8006de:	00 00 00 
+  8006e1:	4c 01 d8             	add    %r11,%rax
+  8006e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8006e8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8006eb:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8006ef:	7e 4f                	jle    800740 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8006f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006f5:	8b 00                	mov    (%rax),%eax
+  8006f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fa:	77 24                	ja     800720 <getuint+0x58>
+  8006fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800700:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800704:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800708:	8b 00                	mov    (%rax),%eax
+  80070a:	89 c0                	mov    %eax,%eax
+  80070c:	48 01 d0             	add    %rdx,%rax
+  80070f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800713:	8b 12                	mov    (%rdx),%edx
+  800715:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800718:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80071c:	89 0a                	mov    %ecx,(%rdx)
+  80071e:	eb 14                	jmp    800734 <getuint+0x6c>
+  800720:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800724:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800728:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80072c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800730:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800734:	48 8b 00             	mov    (%rax),%rax
+  800737:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80073b:	e9 9d 00 00 00       	jmp    8007dd <getuint+0x115>
+	else if (lflag)
+  800740:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800744:	74 4c                	je     800792 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800746:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80074a:	8b 00                	mov    (%rax),%eax
+  80074c:	83 f8 2f             	cmp    $0x2f,%eax
+  80074f:	77 24                	ja     800775 <getuint+0xad>
+  800751:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800755:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800759:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80075d:	8b 00                	mov    (%rax),%eax
+  80075f:	89 c0                	mov    %eax,%eax
+  800761:	48 01 d0             	add    %rdx,%rax
+  800764:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800768:	8b 12                	mov    (%rdx),%edx
+  80076a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80076d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800771:	89 0a                	mov    %ecx,(%rdx)
+  800773:	eb 14                	jmp    800789 <getuint+0xc1>
+  800775:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800779:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80077d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800781:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800785:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800789:	48 8b 00             	mov    (%rax),%rax
+  80078c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800790:	eb 4b                	jmp    8007dd <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800792:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800796:	8b 00                	mov    (%rax),%eax
+  800798:	83 f8 2f             	cmp    $0x2f,%eax
+  80079b:	77 24                	ja     8007c1 <getuint+0xf9>
+  80079d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a9:	8b 00                	mov    (%rax),%eax
+  8007ab:	89 c0                	mov    %eax,%eax
+  8007ad:	48 01 d0             	add    %rdx,%rax
+  8007b0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007b4:	8b 12                	mov    (%rdx),%edx
+  8007b6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007b9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007bd:	89 0a                	mov    %ecx,(%rdx)
+  8007bf:	eb 14                	jmp    8007d5 <getuint+0x10d>
+  8007c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007c9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007cd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007d1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007d5:	8b 00                	mov    (%rax),%eax
+  8007d7:	89 c0                	mov    %eax,%eax
+  8007d9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8007dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8007e1:	c9                   	leave
+  8007e2:	c3                   	ret
+
+00000000008007e3 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8007e3:	55                   	push   %rbp
+  8007e4:	48 89 e5             	mov    %rsp,%rbp
+  8007e7:	48 83 ec 20          	sub    $0x20,%rsp
+  8007eb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007eb <printfloat+0x8>
+  8007f2:	49 bb 55 88 00 00 00 	movabs $0x8855,%r11
+  8007f9:	00 00 00 
+  8007fc:	4c 01 d8             	add    %r11,%rax
+  8007ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800803:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800807:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80080b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80080f:	48 85 c0             	test   %rax,%rax
+  800812:	79 12                	jns    800826 <printfloat+0x43>
+		putch('-',putdat);
+  800814:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800818:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80081c:	48 89 c6             	mov    %rax,%rsi
+  80081f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800824:	ff d2                	call   *%rdx
+	
+}
+  800826:	90                   	nop
+  800827:	c9                   	leave
+  800828:	c3                   	ret
+
+0000000000800829 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800829:	55                   	push   %rbp
+  80082a:	48 89 e5             	mov    %rsp,%rbp
+  80082d:	48 83 ec 20          	sub    $0x20,%rsp
+  800831:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800831 <getint+0x8>
+  800838:	49 bb 0f 88 00 00 00 	movabs $0x880f,%r11
+  80083f:	00 00 00 
+  800842:	4c 01 d8             	add    %r11,%rax
+  800845:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800849:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80084c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800850:	7e 4f                	jle    8008a1 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800852:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800856:	8b 00                	mov    (%rax),%eax
+  800858:	83 f8 2f             	cmp    $0x2f,%eax
+  80085b:	77 24                	ja     800881 <getint+0x58>
+  80085d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800861:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800865:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800869:	8b 00                	mov    (%rax),%eax
+  80086b:	89 c0                	mov    %eax,%eax
+  80086d:	48 01 d0             	add    %rdx,%rax
+  800870:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800874:	8b 12                	mov    (%rdx),%edx
+  800876:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800879:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80087d:	89 0a                	mov    %ecx,(%rdx)
+  80087f:	eb 14                	jmp    800895 <getint+0x6c>
+  800881:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800885:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800889:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80088d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800891:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800895:	48 8b 00             	mov    (%rax),%rax
+  800898:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80089c:	e9 9d 00 00 00       	jmp    80093e <getint+0x115>
+	else if (lflag)
+  8008a1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8008a5:	74 4c                	je     8008f3 <getint+0xca>
+		x=va_arg(*ap, long);
+  8008a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008ab:	8b 00                	mov    (%rax),%eax
+  8008ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b0:	77 24                	ja     8008d6 <getint+0xad>
+  8008b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008b6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008be:	8b 00                	mov    (%rax),%eax
+  8008c0:	89 c0                	mov    %eax,%eax
+  8008c2:	48 01 d0             	add    %rdx,%rax
+  8008c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008c9:	8b 12                	mov    (%rdx),%edx
+  8008cb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008ce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008d2:	89 0a                	mov    %ecx,(%rdx)
+  8008d4:	eb 14                	jmp    8008ea <getint+0xc1>
+  8008d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008da:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008de:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008e2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008e6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008ea:	48 8b 00             	mov    (%rax),%rax
+  8008ed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8008f1:	eb 4b                	jmp    80093e <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8008f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008f7:	8b 00                	mov    (%rax),%eax
+  8008f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fc:	77 24                	ja     800922 <getint+0xf9>
+  8008fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800902:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800906:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80090a:	8b 00                	mov    (%rax),%eax
+  80090c:	89 c0                	mov    %eax,%eax
+  80090e:	48 01 d0             	add    %rdx,%rax
+  800911:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800915:	8b 12                	mov    (%rdx),%edx
+  800917:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80091a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80091e:	89 0a                	mov    %ecx,(%rdx)
+  800920:	eb 14                	jmp    800936 <getint+0x10d>
+  800922:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800926:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80092a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80092e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800932:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800936:	8b 00                	mov    (%rax),%eax
+  800938:	48 98                	cltq
+  80093a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80093e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800942:	c9                   	leave
+  800943:	c3                   	ret
+
+0000000000800944 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800944:	55                   	push   %rbp
+  800945:	48 89 e5             	mov    %rsp,%rbp
+  800948:	41 57                	push   %r15
+  80094a:	41 55                	push   %r13
+  80094c:	41 54                	push   %r12
+  80094e:	53                   	push   %rbx
+  80094f:	48 83 ec 60          	sub    $0x60,%rsp
+  800953:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800953 <vprintfmt+0xf>
+  80095a:	49 bb ed 86 00 00 00 	movabs $0x86ed,%r11
+  800961:	00 00 00 
+  800964:	4d 01 dc             	add    %r11,%r12
+  800967:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  80096b:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  80096f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800973:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800977:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  80097e:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800982:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800986:	48 8b 06             	mov    (%rsi),%rax
+  800989:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80098d:	48 89 01             	mov    %rax,(%rcx)
+  800990:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800994:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800998:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80099c:	eb 17                	jmp    8009b5 <vprintfmt+0x71>
+			if (ch == '\0')
+  80099e:	85 db                	test   %ebx,%ebx
+  8009a0:	0f 84 97 05 00 00    	je     800f3d <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  8009a6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8009aa:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8009ae:	48 89 c6             	mov    %rax,%rsi
+  8009b1:	89 df                	mov    %ebx,%edi
+  8009b3:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8009b5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8009b9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009bd:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8009c1:	0f b6 00             	movzbl (%rax),%eax
+  8009c4:	0f b6 d8             	movzbl %al,%ebx
+  8009c7:	83 fb 25             	cmp    $0x25,%ebx
+  8009ca:	75 d2                	jne    80099e <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  8009cc:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  8009d0:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  8009d7:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8009de:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  8009e5:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  8009ec:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8009f0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009f4:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8009f8:	0f b6 00             	movzbl (%rax),%eax
+  8009fb:	0f b6 d8             	movzbl %al,%ebx
+  8009fe:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800a01:	83 f8 55             	cmp    $0x55,%eax
+  800a04:	0f 87 00 05 00 00    	ja     800f0a <vprintfmt+0x5c6>
+  800a0a:	89 c0                	mov    %eax,%eax
+  800a0c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800a13:	00 
+  800a14:	48 8d 05 bd 64 00 00 	lea    0x64bd(%rip),%rax        # 806ed8 <.LC18+0xc>
+  800a1b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800a1f:	48 8d 15 b2 64 00 00 	lea    0x64b2(%rip),%rdx        # 806ed8 <.LC18+0xc>
+  800a26:	48 01 d0             	add    %rdx,%rax
+  800a29:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800a2b:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800a2f:	eb bb                	jmp    8009ec <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800a31:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800a35:	eb b5                	jmp    8009ec <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800a37:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800a3e:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800a41:	89 d0                	mov    %edx,%eax
+  800a43:	c1 e0 02             	shl    $0x2,%eax
+  800a46:	01 d0                	add    %edx,%eax
+  800a48:	01 c0                	add    %eax,%eax
+  800a4a:	01 d8                	add    %ebx,%eax
+  800a4c:	83 e8 30             	sub    $0x30,%eax
+  800a4f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800a52:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800a56:	0f b6 00             	movzbl (%rax),%eax
+  800a59:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800a5c:	83 fb 2f             	cmp    $0x2f,%ebx
+  800a5f:	7e 60                	jle    800ac1 <vprintfmt+0x17d>
+  800a61:	83 fb 39             	cmp    $0x39,%ebx
+  800a64:	7f 5b                	jg     800ac1 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800a66:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800a6b:	eb d1                	jmp    800a3e <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800a6d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a70:	83 f8 2f             	cmp    $0x2f,%eax
+  800a73:	77 17                	ja     800a8c <vprintfmt+0x148>
+  800a75:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a79:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a7c:	89 d2                	mov    %edx,%edx
+  800a7e:	48 01 d0             	add    %rdx,%rax
+  800a81:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a84:	83 c2 08             	add    $0x8,%edx
+  800a87:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800a8a:	eb 0c                	jmp    800a98 <vprintfmt+0x154>
+  800a8c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a90:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a94:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800a98:	8b 00                	mov    (%rax),%eax
+  800a9a:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800a9d:	eb 23                	jmp    800ac2 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800a9f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800aa3:	0f 89 43 ff ff ff    	jns    8009ec <vprintfmt+0xa8>
+				width = 0;
+  800aa9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800ab0:	e9 37 ff ff ff       	jmp    8009ec <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800ab5:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800abc:	e9 2b ff ff ff       	jmp    8009ec <vprintfmt+0xa8>
+			goto process_precision;
+  800ac1:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800ac2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ac6:	0f 89 20 ff ff ff    	jns    8009ec <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800acc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800acf:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800ad2:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800ad9:	e9 0e ff ff ff       	jmp    8009ec <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800ade:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800ae2:	e9 05 ff ff ff       	jmp    8009ec <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800ae7:	83 fb 39             	cmp    $0x39,%ebx
+  800aea:	7f 0b                	jg     800af7 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800aec:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800aef:	c1 e0 08             	shl    $0x8,%eax
+  800af2:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800af5:	eb 21                	jmp    800b18 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800af7:	83 fb 60             	cmp    $0x60,%ebx
+  800afa:	7e 10                	jle    800b0c <vprintfmt+0x1c8>
+  800afc:	83 fb 66             	cmp    $0x66,%ebx
+  800aff:	7f 0b                	jg     800b0c <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800b01:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800b04:	c1 e0 08             	shl    $0x8,%eax
+  800b07:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800b0a:	eb 0c                	jmp    800b18 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800b0c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800b13:	e9 04 01 00 00       	jmp    800c1c <vprintfmt+0x2d8>
+  800b18:	e9 ff 00 00 00       	jmp    800c1c <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800b1d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b20:	83 f8 2f             	cmp    $0x2f,%eax
+  800b23:	77 17                	ja     800b3c <vprintfmt+0x1f8>
+  800b25:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b29:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b2c:	89 d2                	mov    %edx,%edx
+  800b2e:	48 01 d0             	add    %rdx,%rax
+  800b31:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b34:	83 c2 08             	add    $0x8,%edx
+  800b37:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b3a:	eb 0c                	jmp    800b48 <vprintfmt+0x204>
+  800b3c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b40:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b44:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b48:	8b 00                	mov    (%rax),%eax
+  800b4a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800b4e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800b52:	48 89 d6             	mov    %rdx,%rsi
+  800b55:	89 c7                	mov    %eax,%edi
+  800b57:	ff d1                	call   *%rcx
+			break;
+  800b59:	e9 da 03 00 00       	jmp    800f38 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800b5e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b61:	83 f8 2f             	cmp    $0x2f,%eax
+  800b64:	77 17                	ja     800b7d <vprintfmt+0x239>
+  800b66:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b6a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b6d:	89 d2                	mov    %edx,%edx
+  800b6f:	48 01 d0             	add    %rdx,%rax
+  800b72:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b75:	83 c2 08             	add    $0x8,%edx
+  800b78:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b7b:	eb 0c                	jmp    800b89 <vprintfmt+0x245>
+  800b7d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b81:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b85:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b89:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800b8b:	85 db                	test   %ebx,%ebx
+  800b8d:	79 02                	jns    800b91 <vprintfmt+0x24d>
+				err = -err;
+  800b8f:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b91:	83 fb 15             	cmp    $0x15,%ebx
+  800b94:	7f 19                	jg     800baf <vprintfmt+0x26b>
+  800b96:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800b9d:	00 00 00 
+  800ba0:	48 63 c3             	movslq %ebx,%rax
+  800ba3:	4c 01 e2             	add    %r12,%rdx
+  800ba6:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800baa:	4d 85 ed             	test   %r13,%r13
+  800bad:	75 36                	jne    800be5 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800baf:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800bb3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bb7:	89 d9                	mov    %ebx,%ecx
+  800bb9:	48 ba 80 de ff ff ff 	movabs $0xffffffffffffde80,%rdx
+  800bc0:	ff ff ff 
+  800bc3:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800bc7:	48 89 c7             	mov    %rax,%rdi
+  800bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcf:	49 b8 0b 7f ff ff ff 	movabs $0xffffffffffff7f0b,%r8
+  800bd6:	ff ff ff 
+  800bd9:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800bdd:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800be0:	e9 53 03 00 00       	jmp    800f38 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800be5:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800be9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bed:	4c 89 e9             	mov    %r13,%rcx
+  800bf0:	48 ba 89 de ff ff ff 	movabs $0xffffffffffffde89,%rdx
+  800bf7:	ff ff ff 
+  800bfa:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800bfe:	48 89 c7             	mov    %rax,%rdi
+  800c01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c06:	49 b8 0b 7f ff ff ff 	movabs $0xffffffffffff7f0b,%r8
+  800c0d:	ff ff ff 
+  800c10:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800c14:	41 ff d0             	call   *%r8
+			break;
+  800c17:	e9 1c 03 00 00       	jmp    800f38 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800c1c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c22:	77 17                	ja     800c3b <vprintfmt+0x2f7>
+  800c24:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c28:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c2b:	89 d2                	mov    %edx,%edx
+  800c2d:	48 01 d0             	add    %rdx,%rax
+  800c30:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c33:	83 c2 08             	add    $0x8,%edx
+  800c36:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c39:	eb 0c                	jmp    800c47 <vprintfmt+0x303>
+  800c3b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c3f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c43:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c47:	4c 8b 28             	mov    (%rax),%r13
+  800c4a:	4d 85 ed             	test   %r13,%r13
+  800c4d:	75 0e                	jne    800c5d <vprintfmt+0x319>
+				p = "(null)";
+  800c4f:	48 b8 8c de ff ff ff 	movabs $0xffffffffffffde8c,%rax
+  800c56:	ff ff ff 
+  800c59:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800c5d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c61:	0f 8e 84 00 00 00    	jle    800ceb <vprintfmt+0x3a7>
+  800c67:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800c6b:	74 7e                	je     800ceb <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c6d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800c70:	48 98                	cltq
+  800c72:	48 89 c6             	mov    %rax,%rsi
+  800c75:	4c 89 ef             	mov    %r13,%rdi
+  800c78:	4d 89 e7             	mov    %r12,%r15
+  800c7b:	48 b8 30 82 ff ff ff 	movabs $0xffffffffffff8230,%rax
+  800c82:	ff ff ff 
+  800c85:	4c 01 e0             	add    %r12,%rax
+  800c88:	ff d0                	call   *%rax
+  800c8a:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800c8d:	eb 17                	jmp    800ca6 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800c8f:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800c93:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c97:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c9b:	48 89 d6             	mov    %rdx,%rsi
+  800c9e:	89 c7                	mov    %eax,%edi
+  800ca0:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ca2:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ca6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800caa:	7f e3                	jg     800c8f <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800cac:	eb 3d                	jmp    800ceb <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800cae:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800cb2:	74 1e                	je     800cd2 <vprintfmt+0x38e>
+  800cb4:	83 fb 1f             	cmp    $0x1f,%ebx
+  800cb7:	7e 05                	jle    800cbe <vprintfmt+0x37a>
+  800cb9:	83 fb 7e             	cmp    $0x7e,%ebx
+  800cbc:	7e 14                	jle    800cd2 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800cbe:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cc2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800cc6:	48 89 c6             	mov    %rax,%rsi
+  800cc9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800cce:	ff d2                	call   *%rdx
+  800cd0:	eb 15                	jmp    800ce7 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800cd2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800cd5:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800cd8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cdc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ce0:	48 89 c6             	mov    %rax,%rsi
+  800ce3:	89 cf                	mov    %ecx,%edi
+  800ce5:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ce7:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ceb:	4c 89 e8             	mov    %r13,%rax
+  800cee:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800cf2:	0f b6 00             	movzbl (%rax),%eax
+  800cf5:	0f be d8             	movsbl %al,%ebx
+  800cf8:	85 db                	test   %ebx,%ebx
+  800cfa:	74 28                	je     800d24 <vprintfmt+0x3e0>
+  800cfc:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800d00:	78 ac                	js     800cae <vprintfmt+0x36a>
+  800d02:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800d06:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800d0a:	79 a2                	jns    800cae <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800d0c:	eb 16                	jmp    800d24 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800d0e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d12:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d16:	48 89 c6             	mov    %rax,%rsi
+  800d19:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d1e:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800d20:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800d24:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d28:	7f e4                	jg     800d0e <vprintfmt+0x3ca>
+			break;
+  800d2a:	e9 09 02 00 00       	jmp    800f38 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800d2f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d33:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d37:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d3b:	0f b6 00             	movzbl (%rax),%eax
+  800d3e:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800d41:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800d42:	83 fb 2f             	cmp    $0x2f,%ebx
+  800d45:	0f 8e ac fd ff ff    	jle    800af7 <vprintfmt+0x1b3>
+  800d4b:	e9 97 fd ff ff       	jmp    800ae7 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800d50:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d54:	be 03 00 00 00       	mov    $0x3,%esi
+  800d59:	48 89 c7             	mov    %rax,%rdi
+  800d5c:	48 b8 e9 77 ff ff ff 	movabs $0xffffffffffff77e9,%rax
+  800d63:	ff ff ff 
+  800d66:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d6a:	ff d0                	call   *%rax
+  800d6c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800d70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d74:	48 85 c0             	test   %rax,%rax
+  800d77:	79 1d                	jns    800d96 <vprintfmt+0x452>
+				putch('-', putdat);
+  800d79:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d7d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d81:	48 89 c6             	mov    %rax,%rsi
+  800d84:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d89:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800d8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d8f:	48 f7 d8             	neg    %rax
+  800d92:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800d96:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800d9d:	e9 de 00 00 00       	jmp    800e80 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800da2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800da6:	be 03 00 00 00       	mov    $0x3,%esi
+  800dab:	48 89 c7             	mov    %rax,%rdi
+  800dae:	48 b8 88 76 ff ff ff 	movabs $0xffffffffffff7688,%rax
+  800db5:	ff ff ff 
+  800db8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800dbc:	ff d0                	call   *%rax
+  800dbe:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800dc2:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800dc9:	e9 b2 00 00 00       	jmp    800e80 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800dce:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800dd2:	be 03 00 00 00       	mov    $0x3,%esi
+  800dd7:	48 89 c7             	mov    %rax,%rdi
+  800dda:	48 b8 88 76 ff ff ff 	movabs $0xffffffffffff7688,%rax
+  800de1:	ff ff ff 
+  800de4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800de8:	ff d0                	call   *%rax
+  800dea:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800dee:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800df5:	e9 86 00 00 00       	jmp    800e80 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800dfa:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dfe:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e02:	48 89 c6             	mov    %rax,%rsi
+  800e05:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e0a:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800e0c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e10:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e14:	48 89 c6             	mov    %rax,%rsi
+  800e17:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e1c:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800e1e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e21:	83 f8 2f             	cmp    $0x2f,%eax
+  800e24:	77 17                	ja     800e3d <vprintfmt+0x4f9>
+  800e26:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e2a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e2d:	89 d2                	mov    %edx,%edx
+  800e2f:	48 01 d0             	add    %rdx,%rax
+  800e32:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e35:	83 c2 08             	add    $0x8,%edx
+  800e38:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e3b:	eb 0c                	jmp    800e49 <vprintfmt+0x505>
+  800e3d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e41:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e45:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e49:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800e4c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800e50:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800e57:	eb 27                	jmp    800e80 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800e59:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e5d:	be 03 00 00 00       	mov    $0x3,%esi
+  800e62:	48 89 c7             	mov    %rax,%rdi
+  800e65:	48 b8 88 76 ff ff ff 	movabs $0xffffffffffff7688,%rax
+  800e6c:	ff ff ff 
+  800e6f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e73:	ff d0                	call   *%rax
+  800e75:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800e79:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800e80:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800e85:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800e88:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800e8b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800e8f:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e93:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e97:	45 89 c1             	mov    %r8d,%r9d
+  800e9a:	41 89 f8             	mov    %edi,%r8d
+  800e9d:	48 89 c7             	mov    %rax,%rdi
+  800ea0:	48 b8 b0 75 ff ff ff 	movabs $0xffffffffffff75b0,%rax
+  800ea7:	ff ff ff 
+  800eaa:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800eae:	ff d0                	call   *%rax
+			break;
+  800eb0:	e9 83 00 00 00       	jmp    800f38 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800eb5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800eb9:	be 03 00 00 00       	mov    $0x3,%esi
+  800ebe:	48 89 c7             	mov    %rax,%rdi
+  800ec1:	48 b8 88 76 ff ff ff 	movabs $0xffffffffffff7688,%rax
+  800ec8:	ff ff ff 
+  800ecb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ecf:	ff d0                	call   *%rax
+  800ed1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800ed5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800ed9:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800edd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ee1:	48 89 ce             	mov    %rcx,%rsi
+  800ee4:	48 89 c7             	mov    %rax,%rdi
+  800ee7:	48 b8 a3 77 ff ff ff 	movabs $0xffffffffffff77a3,%rax
+  800eee:	ff ff ff 
+  800ef1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ef5:	ff d0                	call   *%rax
+	
+			break;
+  800ef7:	eb 3f                	jmp    800f38 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800ef9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800efd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f01:	48 89 c6             	mov    %rax,%rsi
+  800f04:	89 df                	mov    %ebx,%edi
+  800f06:	ff d2                	call   *%rdx
+			break;
+  800f08:	eb 2e                	jmp    800f38 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800f0a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f0e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f12:	48 89 c6             	mov    %rax,%rsi
+  800f15:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f1a:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800f1c:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800f21:	eb 05                	jmp    800f28 <vprintfmt+0x5e4>
+  800f23:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800f28:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f2c:	48 83 e8 01          	sub    $0x1,%rax
+  800f30:	0f b6 00             	movzbl (%rax),%eax
+  800f33:	3c 25                	cmp    $0x25,%al
+  800f35:	75 ec                	jne    800f23 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800f37:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f38:	e9 78 fa ff ff       	jmp    8009b5 <vprintfmt+0x71>
+				return;
+  800f3d:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800f3e:	48 83 c4 60          	add    $0x60,%rsp
+  800f42:	5b                   	pop    %rbx
+  800f43:	41 5c                	pop    %r12
+  800f45:	41 5d                	pop    %r13
+  800f47:	41 5f                	pop    %r15
+  800f49:	5d                   	pop    %rbp
+  800f4a:	c3                   	ret
+
+0000000000800f4b <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  800f4b:	55                   	push   %rbp
+  800f4c:	48 89 e5             	mov    %rsp,%rbp
+  800f4f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f56:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800f56 <printfmt+0xb>
+  800f5d:	49 bb ea 80 00 00 00 	movabs $0x80ea,%r11
+  800f64:	00 00 00 
+  800f67:	4d 01 da             	add    %r11,%r10
+  800f6a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f71:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f78:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f7f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f86:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f8d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f94:	84 c0                	test   %al,%al
+  800f96:	74 20                	je     800fb8 <printfmt+0x6d>
+  800f98:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f9c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800fa0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800fa4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800fa8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800fac:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800fb0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800fb4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800fb8:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800fbf:	00 00 00 
+  800fc2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800fc9:	00 00 00 
+  800fcc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fd0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800fd7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800fde:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800fe5:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800fec:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ff3:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800ffa:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801001:	48 89 c7             	mov    %rax,%rdi
+  801004:	48 b8 04 79 ff ff ff 	movabs $0xffffffffffff7904,%rax
+  80100b:	ff ff ff 
+  80100e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801012:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801014:	90                   	nop
+  801015:	c9                   	leave
+  801016:	c3                   	ret
+
+0000000000801017 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801017:	55                   	push   %rbp
+  801018:	48 89 e5             	mov    %rsp,%rbp
+  80101b:	48 83 ec 10          	sub    $0x10,%rsp
+  80101f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80101f <sprintputch+0x8>
+  801026:	49 bb 21 80 00 00 00 	movabs $0x8021,%r11
+  80102d:	00 00 00 
+  801030:	4c 01 d8             	add    %r11,%rax
+  801033:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801036:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80103a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80103e:	8b 40 10             	mov    0x10(%rax),%eax
+  801041:	8d 50 01             	lea    0x1(%rax),%edx
+  801044:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801048:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80104b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80104f:	48 8b 10             	mov    (%rax),%rdx
+  801052:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801056:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80105a:	48 39 c2             	cmp    %rax,%rdx
+  80105d:	73 17                	jae    801076 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80105f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801063:	48 8b 00             	mov    (%rax),%rax
+  801066:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80106a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80106e:	48 89 0a             	mov    %rcx,(%rdx)
+  801071:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801074:	88 10                	mov    %dl,(%rax)
+}
+  801076:	90                   	nop
+  801077:	c9                   	leave
+  801078:	c3                   	ret
+
+0000000000801079 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801079:	55                   	push   %rbp
+  80107a:	48 89 e5             	mov    %rsp,%rbp
+  80107d:	53                   	push   %rbx
+  80107e:	48 83 ec 58          	sub    $0x58,%rsp
+  801082:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801082 <vsnprintf+0x9>
+  801089:	49 bb be 7f 00 00 00 	movabs $0x7fbe,%r11
+  801090:	00 00 00 
+  801093:	4c 01 d8             	add    %r11,%rax
+  801096:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80109a:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80109d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8010a1:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8010a5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8010a9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8010ad:	48 8b 0e             	mov    (%rsi),%rcx
+  8010b0:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8010b4:	48 89 0a             	mov    %rcx,(%rdx)
+  8010b7:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8010bb:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8010bf:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8010c3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8010c7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8010cb:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8010ce:	48 63 d2             	movslq %edx,%rdx
+  8010d1:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8010d5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8010d9:	48 01 ca             	add    %rcx,%rdx
+  8010dc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8010e0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8010e7:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8010ec:	74 06                	je     8010f4 <vsnprintf+0x7b>
+  8010ee:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8010f2:	7f 07                	jg     8010fb <vsnprintf+0x82>
+		return -E_INVAL;
+  8010f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010f9:	eb 34                	jmp    80112f <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8010fb:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8010ff:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801103:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801107:	48 bf d7 7f ff ff ff 	movabs $0xffffffffffff7fd7,%rdi
+  80110e:	ff ff ff 
+  801111:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801115:	49 b8 04 79 ff ff ff 	movabs $0xffffffffffff7904,%r8
+  80111c:	ff ff ff 
+  80111f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801123:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801125:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801129:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80112c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80112f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801133:	c9                   	leave
+  801134:	c3                   	ret
+
+0000000000801135 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801135:	55                   	push   %rbp
+  801136:	48 89 e5             	mov    %rsp,%rbp
+  801139:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801140:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801140 <snprintf+0xb>
+  801147:	49 bb 00 7f 00 00 00 	movabs $0x7f00,%r11
+  80114e:	00 00 00 
+  801151:	4d 01 da             	add    %r11,%r10
+  801154:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80115b:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801161:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801168:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80116f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801176:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80117d:	84 c0                	test   %al,%al
+  80117f:	74 20                	je     8011a1 <snprintf+0x6c>
+  801181:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801185:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801189:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80118d:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801191:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801195:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801199:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80119d:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8011a1:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8011a8:	00 00 00 
+  8011ab:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8011b2:	00 00 00 
+  8011b5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011b9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8011c0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8011c7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8011ce:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8011d5:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8011dc:	48 8b 06             	mov    (%rsi),%rax
+  8011df:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8011e3:	48 89 01             	mov    %rax,(%rcx)
+  8011e6:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8011ea:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8011ee:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8011f2:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8011f9:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801200:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801206:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80120d:	48 89 c7             	mov    %rax,%rdi
+  801210:	48 b8 39 80 ff ff ff 	movabs $0xffffffffffff8039,%rax
+  801217:	ff ff ff 
+  80121a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80121e:	ff d0                	call   *%rax
+  801220:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801226:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80122c:	c9                   	leave
+  80122d:	c3                   	ret
+
+000000000080122e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80122e:	55                   	push   %rbp
+  80122f:	48 89 e5             	mov    %rsp,%rbp
+  801232:	48 83 ec 18          	sub    $0x18,%rsp
+  801236:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801236 <strlen+0x8>
+  80123d:	49 bb 0a 7e 00 00 00 	movabs $0x7e0a,%r11
+  801244:	00 00 00 
+  801247:	4c 01 d8             	add    %r11,%rax
+  80124a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80124e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801255:	eb 09                	jmp    801260 <strlen+0x32>
+		n++;
+  801257:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  80125b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801260:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801264:	0f b6 00             	movzbl (%rax),%eax
+  801267:	84 c0                	test   %al,%al
+  801269:	75 ec                	jne    801257 <strlen+0x29>
+	return n;
+  80126b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80126e:	c9                   	leave
+  80126f:	c3                   	ret
+
+0000000000801270 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801270:	55                   	push   %rbp
+  801271:	48 89 e5             	mov    %rsp,%rbp
+  801274:	48 83 ec 20          	sub    $0x20,%rsp
+  801278:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801278 <strnlen+0x8>
+  80127f:	49 bb c8 7d 00 00 00 	movabs $0x7dc8,%r11
+  801286:	00 00 00 
+  801289:	4c 01 d8             	add    %r11,%rax
+  80128c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801290:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801294:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80129b:	eb 0e                	jmp    8012ab <strnlen+0x3b>
+		n++;
+  80129d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8012a1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8012a6:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8012ab:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8012b0:	74 0b                	je     8012bd <strnlen+0x4d>
+  8012b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012b6:	0f b6 00             	movzbl (%rax),%eax
+  8012b9:	84 c0                	test   %al,%al
+  8012bb:	75 e0                	jne    80129d <strnlen+0x2d>
+	return n;
+  8012bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8012c0:	c9                   	leave
+  8012c1:	c3                   	ret
+
+00000000008012c2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8012c2:	55                   	push   %rbp
+  8012c3:	48 89 e5             	mov    %rsp,%rbp
+  8012c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8012ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012ca <strcpy+0x8>
+  8012d1:	49 bb 76 7d 00 00 00 	movabs $0x7d76,%r11
+  8012d8:	00 00 00 
+  8012db:	4c 01 d8             	add    %r11,%rax
+  8012de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8012e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8012ee:	90                   	nop
+  8012ef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012f3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012f7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012ff:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801303:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801307:	0f b6 12             	movzbl (%rdx),%edx
+  80130a:	88 10                	mov    %dl,(%rax)
+  80130c:	0f b6 00             	movzbl (%rax),%eax
+  80130f:	84 c0                	test   %al,%al
+  801311:	75 dc                	jne    8012ef <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801313:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801317:	c9                   	leave
+  801318:	c3                   	ret
+
+0000000000801319 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801319:	55                   	push   %rbp
+  80131a:	48 89 e5             	mov    %rsp,%rbp
+  80131d:	53                   	push   %rbx
+  80131e:	48 83 ec 20          	sub    $0x20,%rsp
+  801322:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801322 <strcat+0x9>
+  801329:	49 bb 1e 7d 00 00 00 	movabs $0x7d1e,%r11
+  801330:	00 00 00 
+  801333:	4c 01 db             	add    %r11,%rbx
+  801336:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80133a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80133e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801342:	48 89 c7             	mov    %rax,%rdi
+  801345:	48 b8 ee 81 ff ff ff 	movabs $0xffffffffffff81ee,%rax
+  80134c:	ff ff ff 
+  80134f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801353:	ff d0                	call   *%rax
+  801355:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801358:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80135b:	48 63 d0             	movslq %eax,%rdx
+  80135e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801362:	48 01 c2             	add    %rax,%rdx
+  801365:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801369:	48 89 c6             	mov    %rax,%rsi
+  80136c:	48 89 d7             	mov    %rdx,%rdi
+  80136f:	48 b8 82 82 ff ff ff 	movabs $0xffffffffffff8282,%rax
+  801376:	ff ff ff 
+  801379:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80137d:	ff d0                	call   *%rax
+	return dst;
+  80137f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801383:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801387:	c9                   	leave
+  801388:	c3                   	ret
+
+0000000000801389 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801389:	55                   	push   %rbp
+  80138a:	48 89 e5             	mov    %rsp,%rbp
+  80138d:	48 83 ec 28          	sub    $0x28,%rsp
+  801391:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801391 <strncpy+0x8>
+  801398:	49 bb af 7c 00 00 00 	movabs $0x7caf,%r11
+  80139f:	00 00 00 
+  8013a2:	4c 01 d8             	add    %r11,%rax
+  8013a5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013a9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013ad:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8013b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8013b9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8013c0:	00 
+  8013c1:	eb 2a                	jmp    8013ed <strncpy+0x64>
+		*dst++ = *src;
+  8013c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013c7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013cb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8013cf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013d3:	0f b6 12             	movzbl (%rdx),%edx
+  8013d6:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8013d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013dc:	0f b6 00             	movzbl (%rax),%eax
+  8013df:	84 c0                	test   %al,%al
+  8013e1:	74 05                	je     8013e8 <strncpy+0x5f>
+			src++;
+  8013e3:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8013e8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8013ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013f1:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8013f5:	72 cc                	jb     8013c3 <strncpy+0x3a>
+	}
+	return ret;
+  8013f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8013fb:	c9                   	leave
+  8013fc:	c3                   	ret
+
+00000000008013fd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8013fd:	55                   	push   %rbp
+  8013fe:	48 89 e5             	mov    %rsp,%rbp
+  801401:	48 83 ec 28          	sub    $0x28,%rsp
+  801405:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801405 <strlcpy+0x8>
+  80140c:	49 bb 3b 7c 00 00 00 	movabs $0x7c3b,%r11
+  801413:	00 00 00 
+  801416:	4c 01 d8             	add    %r11,%rax
+  801419:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80141d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801421:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801425:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801429:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80142d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801432:	74 3d                	je     801471 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801434:	eb 1d                	jmp    801453 <strlcpy+0x56>
+			*dst++ = *src++;
+  801436:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80143a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80143e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801442:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801446:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80144a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80144e:	0f b6 12             	movzbl (%rdx),%edx
+  801451:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801453:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801458:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80145d:	74 0b                	je     80146a <strlcpy+0x6d>
+  80145f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801463:	0f b6 00             	movzbl (%rax),%eax
+  801466:	84 c0                	test   %al,%al
+  801468:	75 cc                	jne    801436 <strlcpy+0x39>
+		*dst = '\0';
+  80146a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80146e:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801471:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801475:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801479:	c9                   	leave
+  80147a:	c3                   	ret
+
+000000000080147b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80147b:	55                   	push   %rbp
+  80147c:	48 89 e5             	mov    %rsp,%rbp
+  80147f:	48 83 ec 10          	sub    $0x10,%rsp
+  801483:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801483 <strcmp+0x8>
+  80148a:	49 bb bd 7b 00 00 00 	movabs $0x7bbd,%r11
+  801491:	00 00 00 
+  801494:	4c 01 d8             	add    %r11,%rax
+  801497:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80149b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  80149f:	eb 0a                	jmp    8014ab <strcmp+0x30>
+		p++, q++;
+  8014a1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014a6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8014ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014af:	0f b6 00             	movzbl (%rax),%eax
+  8014b2:	84 c0                	test   %al,%al
+  8014b4:	74 12                	je     8014c8 <strcmp+0x4d>
+  8014b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ba:	0f b6 10             	movzbl (%rax),%edx
+  8014bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014c1:	0f b6 00             	movzbl (%rax),%eax
+  8014c4:	38 c2                	cmp    %al,%dl
+  8014c6:	74 d9                	je     8014a1 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8014c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014cc:	0f b6 00             	movzbl (%rax),%eax
+  8014cf:	0f b6 d0             	movzbl %al,%edx
+  8014d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014d6:	0f b6 00             	movzbl (%rax),%eax
+  8014d9:	0f b6 c0             	movzbl %al,%eax
+  8014dc:	29 c2                	sub    %eax,%edx
+  8014de:	89 d0                	mov    %edx,%eax
+}
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+
+00000000008014e2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8014e2:	55                   	push   %rbp
+  8014e3:	48 89 e5             	mov    %rsp,%rbp
+  8014e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8014ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014ea <strncmp+0x8>
+  8014f1:	49 bb 56 7b 00 00 00 	movabs $0x7b56,%r11
+  8014f8:	00 00 00 
+  8014fb:	4c 01 d8             	add    %r11,%rax
+  8014fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801502:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801506:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80150a:	eb 0f                	jmp    80151b <strncmp+0x39>
+		n--, p++, q++;
+  80150c:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801511:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801516:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80151b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801520:	74 1d                	je     80153f <strncmp+0x5d>
+  801522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801526:	0f b6 00             	movzbl (%rax),%eax
+  801529:	84 c0                	test   %al,%al
+  80152b:	74 12                	je     80153f <strncmp+0x5d>
+  80152d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801531:	0f b6 10             	movzbl (%rax),%edx
+  801534:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801538:	0f b6 00             	movzbl (%rax),%eax
+  80153b:	38 c2                	cmp    %al,%dl
+  80153d:	74 cd                	je     80150c <strncmp+0x2a>
+	if (n == 0)
+  80153f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801544:	75 07                	jne    80154d <strncmp+0x6b>
+		return 0;
+  801546:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154b:	eb 16                	jmp    801563 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80154d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801551:	0f b6 00             	movzbl (%rax),%eax
+  801554:	0f b6 d0             	movzbl %al,%edx
+  801557:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80155b:	0f b6 00             	movzbl (%rax),%eax
+  80155e:	0f b6 c0             	movzbl %al,%eax
+  801561:	29 c2                	sub    %eax,%edx
+}
+  801563:	89 d0                	mov    %edx,%eax
+  801565:	c9                   	leave
+  801566:	c3                   	ret
+
+0000000000801567 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801567:	55                   	push   %rbp
+  801568:	48 89 e5             	mov    %rsp,%rbp
+  80156b:	48 83 ec 10          	sub    $0x10,%rsp
+  80156f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80156f <strchr+0x8>
+  801576:	49 bb d1 7a 00 00 00 	movabs $0x7ad1,%r11
+  80157d:	00 00 00 
+  801580:	4c 01 d8             	add    %r11,%rax
+  801583:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801587:	89 f0                	mov    %esi,%eax
+  801589:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80158c:	eb 17                	jmp    8015a5 <strchr+0x3e>
+		if (*s == c)
+  80158e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801592:	0f b6 00             	movzbl (%rax),%eax
+  801595:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801598:	75 06                	jne    8015a0 <strchr+0x39>
+			return (char *) s;
+  80159a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80159e:	eb 15                	jmp    8015b5 <strchr+0x4e>
+	for (; *s; s++)
+  8015a0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015a9:	0f b6 00             	movzbl (%rax),%eax
+  8015ac:	84 c0                	test   %al,%al
+  8015ae:	75 de                	jne    80158e <strchr+0x27>
+	return 0;
+  8015b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015b5:	c9                   	leave
+  8015b6:	c3                   	ret
+
+00000000008015b7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8015b7:	55                   	push   %rbp
+  8015b8:	48 89 e5             	mov    %rsp,%rbp
+  8015bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8015bf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015bf <strfind+0x8>
+  8015c6:	49 bb 81 7a 00 00 00 	movabs $0x7a81,%r11
+  8015cd:	00 00 00 
+  8015d0:	4c 01 d8             	add    %r11,%rax
+  8015d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015d7:	89 f0                	mov    %esi,%eax
+  8015d9:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8015dc:	eb 11                	jmp    8015ef <strfind+0x38>
+		if (*s == c)
+  8015de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e2:	0f b6 00             	movzbl (%rax),%eax
+  8015e5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8015e8:	74 12                	je     8015fc <strfind+0x45>
+	for (; *s; s++)
+  8015ea:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f3:	0f b6 00             	movzbl (%rax),%eax
+  8015f6:	84 c0                	test   %al,%al
+  8015f8:	75 e4                	jne    8015de <strfind+0x27>
+  8015fa:	eb 01                	jmp    8015fd <strfind+0x46>
+			break;
+  8015fc:	90                   	nop
+	return (char *) s;
+  8015fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801601:	c9                   	leave
+  801602:	c3                   	ret
+
+0000000000801603 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801603:	55                   	push   %rbp
+  801604:	48 89 e5             	mov    %rsp,%rbp
+  801607:	48 83 ec 18          	sub    $0x18,%rsp
+  80160b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80160b <memset+0x8>
+  801612:	49 bb 35 7a 00 00 00 	movabs $0x7a35,%r11
+  801619:	00 00 00 
+  80161c:	4c 01 d8             	add    %r11,%rax
+  80161f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801623:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801626:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80162a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80162f:	75 06                	jne    801637 <memset+0x34>
+		return v;
+  801631:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801635:	eb 69                	jmp    8016a0 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801637:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80163b:	83 e0 03             	and    $0x3,%eax
+  80163e:	48 85 c0             	test   %rax,%rax
+  801641:	75 48                	jne    80168b <memset+0x88>
+  801643:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801647:	83 e0 03             	and    $0x3,%eax
+  80164a:	48 85 c0             	test   %rax,%rax
+  80164d:	75 3c                	jne    80168b <memset+0x88>
+		c &= 0xFF;
+  80164f:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801656:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801659:	c1 e0 18             	shl    $0x18,%eax
+  80165c:	89 c2                	mov    %eax,%edx
+  80165e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801661:	c1 e0 10             	shl    $0x10,%eax
+  801664:	09 c2                	or     %eax,%edx
+  801666:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801669:	c1 e0 08             	shl    $0x8,%eax
+  80166c:	09 d0                	or     %edx,%eax
+  80166e:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801671:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801675:	48 c1 e8 02          	shr    $0x2,%rax
+  801679:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  80167c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801680:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801683:	48 89 d7             	mov    %rdx,%rdi
+  801686:	fc                   	cld
+  801687:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801689:	eb 11                	jmp    80169c <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80168b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80168f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801692:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801696:	48 89 d7             	mov    %rdx,%rdi
+  801699:	fc                   	cld
+  80169a:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  80169c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016a0:	c9                   	leave
+  8016a1:	c3                   	ret
+
+00000000008016a2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8016a2:	55                   	push   %rbp
+  8016a3:	48 89 e5             	mov    %rsp,%rbp
+  8016a6:	48 83 ec 28          	sub    $0x28,%rsp
+  8016aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016aa <memmove+0x8>
+  8016b1:	49 bb 96 79 00 00 00 	movabs $0x7996,%r11
+  8016b8:	00 00 00 
+  8016bb:	4c 01 d8             	add    %r11,%rax
+  8016be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016c2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016c6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8016ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016ce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8016d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016d6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8016da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016de:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8016e2:	0f 83 88 00 00 00    	jae    801770 <memmove+0xce>
+  8016e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016ec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016f0:	48 01 d0             	add    %rdx,%rax
+  8016f3:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8016f7:	73 77                	jae    801770 <memmove+0xce>
+		s += n;
+  8016f9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016fd:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801701:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801705:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801709:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80170d:	83 e0 03             	and    $0x3,%eax
+  801710:	48 85 c0             	test   %rax,%rax
+  801713:	75 3b                	jne    801750 <memmove+0xae>
+  801715:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801719:	83 e0 03             	and    $0x3,%eax
+  80171c:	48 85 c0             	test   %rax,%rax
+  80171f:	75 2f                	jne    801750 <memmove+0xae>
+  801721:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801725:	83 e0 03             	and    $0x3,%eax
+  801728:	48 85 c0             	test   %rax,%rax
+  80172b:	75 23                	jne    801750 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80172d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801731:	48 83 e8 04          	sub    $0x4,%rax
+  801735:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801739:	48 83 ea 04          	sub    $0x4,%rdx
+  80173d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801741:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801745:	48 89 c7             	mov    %rax,%rdi
+  801748:	48 89 d6             	mov    %rdx,%rsi
+  80174b:	fd                   	std
+  80174c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80174e:	eb 1d                	jmp    80176d <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801750:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801754:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801758:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80175c:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801760:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801764:	48 89 d7             	mov    %rdx,%rdi
+  801767:	48 89 c1             	mov    %rax,%rcx
+  80176a:	fd                   	std
+  80176b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80176d:	fc                   	cld
+  80176e:	eb 57                	jmp    8017c7 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801770:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801774:	83 e0 03             	and    $0x3,%eax
+  801777:	48 85 c0             	test   %rax,%rax
+  80177a:	75 36                	jne    8017b2 <memmove+0x110>
+  80177c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801780:	83 e0 03             	and    $0x3,%eax
+  801783:	48 85 c0             	test   %rax,%rax
+  801786:	75 2a                	jne    8017b2 <memmove+0x110>
+  801788:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80178c:	83 e0 03             	and    $0x3,%eax
+  80178f:	48 85 c0             	test   %rax,%rax
+  801792:	75 1e                	jne    8017b2 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801794:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801798:	48 c1 e8 02          	shr    $0x2,%rax
+  80179c:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  80179f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017a7:	48 89 c7             	mov    %rax,%rdi
+  8017aa:	48 89 d6             	mov    %rdx,%rsi
+  8017ad:	fc                   	cld
+  8017ae:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8017b0:	eb 15                	jmp    8017c7 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8017b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017ba:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8017be:	48 89 c7             	mov    %rax,%rdi
+  8017c1:	48 89 d6             	mov    %rdx,%rsi
+  8017c4:	fc                   	cld
+  8017c5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8017c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017cb:	c9                   	leave
+  8017cc:	c3                   	ret
+
+00000000008017cd <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8017cd:	55                   	push   %rbp
+  8017ce:	48 89 e5             	mov    %rsp,%rbp
+  8017d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8017d5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017d5 <memcpy+0x8>
+  8017dc:	49 bb 6b 78 00 00 00 	movabs $0x786b,%r11
+  8017e3:	00 00 00 
+  8017e6:	4c 01 d8             	add    %r11,%rax
+  8017e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017ed:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8017f1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8017f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017f9:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8017fd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801801:	48 89 cf             	mov    %rcx,%rdi
+  801804:	48 b9 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rcx
+  80180b:	ff ff ff 
+  80180e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801812:	ff d0                	call   *%rax
+}
+  801814:	c9                   	leave
+  801815:	c3                   	ret
+
+0000000000801816 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801816:	55                   	push   %rbp
+  801817:	48 89 e5             	mov    %rsp,%rbp
+  80181a:	48 83 ec 28          	sub    $0x28,%rsp
+  80181e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80181e <memcmp+0x8>
+  801825:	49 bb 22 78 00 00 00 	movabs $0x7822,%r11
+  80182c:	00 00 00 
+  80182f:	4c 01 d8             	add    %r11,%rax
+  801832:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801836:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80183a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80183e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801842:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801846:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80184a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80184e:	eb 34                	jmp    801884 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801850:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801854:	0f b6 10             	movzbl (%rax),%edx
+  801857:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80185b:	0f b6 00             	movzbl (%rax),%eax
+  80185e:	38 c2                	cmp    %al,%dl
+  801860:	74 18                	je     80187a <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801862:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801866:	0f b6 00             	movzbl (%rax),%eax
+  801869:	0f b6 d0             	movzbl %al,%edx
+  80186c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801870:	0f b6 00             	movzbl (%rax),%eax
+  801873:	0f b6 c0             	movzbl %al,%eax
+  801876:	29 c2                	sub    %eax,%edx
+  801878:	eb 20                	jmp    80189a <memcmp+0x84>
+		s1++, s2++;
+  80187a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80187f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801884:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801888:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80188c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801890:	48 85 c0             	test   %rax,%rax
+  801893:	75 bb                	jne    801850 <memcmp+0x3a>
+	}
+
+	return 0;
+  801895:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80189a:	89 d0                	mov    %edx,%eax
+  80189c:	c9                   	leave
+  80189d:	c3                   	ret
+
+000000000080189e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80189e:	55                   	push   %rbp
+  80189f:	48 89 e5             	mov    %rsp,%rbp
+  8018a2:	48 83 ec 28          	sub    $0x28,%rsp
+  8018a6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018a6 <memfind+0x8>
+  8018ad:	49 bb 9a 77 00 00 00 	movabs $0x779a,%r11
+  8018b4:	00 00 00 
+  8018b7:	4c 01 d8             	add    %r11,%rax
+  8018ba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018be:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8018c1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8018c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018cd:	48 01 d0             	add    %rdx,%rax
+  8018d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8018d4:	eb 13                	jmp    8018e9 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8018d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018da:	0f b6 00             	movzbl (%rax),%eax
+  8018dd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8018e0:	38 d0                	cmp    %dl,%al
+  8018e2:	74 11                	je     8018f5 <memfind+0x57>
+	for (; s < ends; s++)
+  8018e4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8018e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018ed:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8018f1:	72 e3                	jb     8018d6 <memfind+0x38>
+  8018f3:	eb 01                	jmp    8018f6 <memfind+0x58>
+			break;
+  8018f5:	90                   	nop
+	return (void *) s;
+  8018f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018fa:	c9                   	leave
+  8018fb:	c3                   	ret
+
+00000000008018fc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8018fc:	55                   	push   %rbp
+  8018fd:	48 89 e5             	mov    %rsp,%rbp
+  801900:	48 83 ec 38          	sub    $0x38,%rsp
+  801904:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801904 <strtol+0x8>
+  80190b:	49 bb 3c 77 00 00 00 	movabs $0x773c,%r11
+  801912:	00 00 00 
+  801915:	4c 01 d8             	add    %r11,%rax
+  801918:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80191c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801920:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801923:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80192a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801931:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801932:	eb 05                	jmp    801939 <strtol+0x3d>
+		s++;
+  801934:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801939:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80193d:	0f b6 00             	movzbl (%rax),%eax
+  801940:	3c 20                	cmp    $0x20,%al
+  801942:	74 f0                	je     801934 <strtol+0x38>
+  801944:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801948:	0f b6 00             	movzbl (%rax),%eax
+  80194b:	3c 09                	cmp    $0x9,%al
+  80194d:	74 e5                	je     801934 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  80194f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801953:	0f b6 00             	movzbl (%rax),%eax
+  801956:	3c 2b                	cmp    $0x2b,%al
+  801958:	75 07                	jne    801961 <strtol+0x65>
+		s++;
+  80195a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80195f:	eb 17                	jmp    801978 <strtol+0x7c>
+	else if (*s == '-')
+  801961:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801965:	0f b6 00             	movzbl (%rax),%eax
+  801968:	3c 2d                	cmp    $0x2d,%al
+  80196a:	75 0c                	jne    801978 <strtol+0x7c>
+		s++, neg = 1;
+  80196c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801971:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801978:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80197c:	74 06                	je     801984 <strtol+0x88>
+  80197e:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801982:	75 28                	jne    8019ac <strtol+0xb0>
+  801984:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801988:	0f b6 00             	movzbl (%rax),%eax
+  80198b:	3c 30                	cmp    $0x30,%al
+  80198d:	75 1d                	jne    8019ac <strtol+0xb0>
+  80198f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801993:	48 83 c0 01          	add    $0x1,%rax
+  801997:	0f b6 00             	movzbl (%rax),%eax
+  80199a:	3c 78                	cmp    $0x78,%al
+  80199c:	75 0e                	jne    8019ac <strtol+0xb0>
+		s += 2, base = 16;
+  80199e:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8019a3:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8019aa:	eb 2c                	jmp    8019d8 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  8019ac:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019b0:	75 19                	jne    8019cb <strtol+0xcf>
+  8019b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b6:	0f b6 00             	movzbl (%rax),%eax
+  8019b9:	3c 30                	cmp    $0x30,%al
+  8019bb:	75 0e                	jne    8019cb <strtol+0xcf>
+		s++, base = 8;
+  8019bd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019c2:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8019c9:	eb 0d                	jmp    8019d8 <strtol+0xdc>
+	else if (base == 0)
+  8019cb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019cf:	75 07                	jne    8019d8 <strtol+0xdc>
+		base = 10;
+  8019d1:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8019d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019dc:	0f b6 00             	movzbl (%rax),%eax
+  8019df:	3c 2f                	cmp    $0x2f,%al
+  8019e1:	7e 1d                	jle    801a00 <strtol+0x104>
+  8019e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e7:	0f b6 00             	movzbl (%rax),%eax
+  8019ea:	3c 39                	cmp    $0x39,%al
+  8019ec:	7f 12                	jg     801a00 <strtol+0x104>
+			dig = *s - '0';
+  8019ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f2:	0f b6 00             	movzbl (%rax),%eax
+  8019f5:	0f be c0             	movsbl %al,%eax
+  8019f8:	83 e8 30             	sub    $0x30,%eax
+  8019fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8019fe:	eb 4e                	jmp    801a4e <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801a00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a04:	0f b6 00             	movzbl (%rax),%eax
+  801a07:	3c 60                	cmp    $0x60,%al
+  801a09:	7e 1d                	jle    801a28 <strtol+0x12c>
+  801a0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a0f:	0f b6 00             	movzbl (%rax),%eax
+  801a12:	3c 7a                	cmp    $0x7a,%al
+  801a14:	7f 12                	jg     801a28 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801a16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a1a:	0f b6 00             	movzbl (%rax),%eax
+  801a1d:	0f be c0             	movsbl %al,%eax
+  801a20:	83 e8 57             	sub    $0x57,%eax
+  801a23:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a26:	eb 26                	jmp    801a4e <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801a28:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a2c:	0f b6 00             	movzbl (%rax),%eax
+  801a2f:	3c 40                	cmp    $0x40,%al
+  801a31:	7e 47                	jle    801a7a <strtol+0x17e>
+  801a33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a37:	0f b6 00             	movzbl (%rax),%eax
+  801a3a:	3c 5a                	cmp    $0x5a,%al
+  801a3c:	7f 3c                	jg     801a7a <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801a3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a42:	0f b6 00             	movzbl (%rax),%eax
+  801a45:	0f be c0             	movsbl %al,%eax
+  801a48:	83 e8 37             	sub    $0x37,%eax
+  801a4b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801a4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a51:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801a54:	7d 23                	jge    801a79 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801a56:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a5b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801a5e:	48 98                	cltq
+  801a60:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801a65:	48 89 c2             	mov    %rax,%rdx
+  801a68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a6b:	48 98                	cltq
+  801a6d:	48 01 d0             	add    %rdx,%rax
+  801a70:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801a74:	e9 5f ff ff ff       	jmp    8019d8 <strtol+0xdc>
+			break;
+  801a79:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801a7a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801a7f:	74 0b                	je     801a8c <strtol+0x190>
+		*endptr = (char *) s;
+  801a81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a85:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801a89:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801a8c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a90:	74 09                	je     801a9b <strtol+0x19f>
+  801a92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a96:	48 f7 d8             	neg    %rax
+  801a99:	eb 04                	jmp    801a9f <strtol+0x1a3>
+  801a9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801a9f:	c9                   	leave
+  801aa0:	c3                   	ret
+
+0000000000801aa1 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801aa1:	55                   	push   %rbp
+  801aa2:	48 89 e5             	mov    %rsp,%rbp
+  801aa5:	53                   	push   %rbx
+  801aa6:	48 83 ec 30          	sub    $0x30,%rsp
+  801aaa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801aaa <strstr+0x9>
+  801ab1:	49 bb 96 75 00 00 00 	movabs $0x7596,%r11
+  801ab8:	00 00 00 
+  801abb:	4c 01 db             	add    %r11,%rbx
+  801abe:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801ac2:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801ac6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aca:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ace:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ad2:	0f b6 00             	movzbl (%rax),%eax
+  801ad5:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801ad8:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801adc:	75 06                	jne    801ae4 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801ade:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae2:	eb 73                	jmp    801b57 <strstr+0xb6>
+
+	len = strlen(str);
+  801ae4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ae8:	48 89 c7             	mov    %rax,%rdi
+  801aeb:	48 b8 ee 81 ff ff ff 	movabs $0xffffffffffff81ee,%rax
+  801af2:	ff ff ff 
+  801af5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801af9:	ff d0                	call   *%rax
+  801afb:	48 98                	cltq
+  801afd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801b01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b05:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b09:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b0d:	0f b6 00             	movzbl (%rax),%eax
+  801b10:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801b13:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801b17:	75 07                	jne    801b20 <strstr+0x7f>
+				return (char *) 0;
+  801b19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1e:	eb 37                	jmp    801b57 <strstr+0xb6>
+		} while (sc != c);
+  801b20:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801b24:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801b27:	75 d8                	jne    801b01 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801b29:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b2d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801b31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b35:	48 89 ce             	mov    %rcx,%rsi
+  801b38:	48 89 c7             	mov    %rax,%rdi
+  801b3b:	48 b8 a2 84 ff ff ff 	movabs $0xffffffffffff84a2,%rax
+  801b42:	ff ff ff 
+  801b45:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801b49:	ff d0                	call   *%rax
+  801b4b:	85 c0                	test   %eax,%eax
+  801b4d:	75 b2                	jne    801b01 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801b4f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b53:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801b57:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b5b:	c9                   	leave
+  801b5c:	c3                   	ret
+
+0000000000801b5d <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801b5d:	55                   	push   %rbp
+  801b5e:	48 89 e5             	mov    %rsp,%rbp
+  801b61:	41 57                	push   %r15
+  801b63:	53                   	push   %rbx
+  801b64:	48 83 ec 40          	sub    $0x40,%rsp
+  801b68:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801b68 <syscall+0xb>
+  801b6f:	49 bb d8 74 00 00 00 	movabs $0x74d8,%r11
+  801b76:	00 00 00 
+  801b79:	4d 01 da             	add    %r11,%r10
+  801b7c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801b7f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801b82:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b86:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b8a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801b8e:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801b92:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b95:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801b99:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801b9d:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801ba1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801ba5:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ba9:	4c 89 c3             	mov    %r8,%rbx
+  801bac:	cd 30                	int    $0x30
+  801bae:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801bb2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801bb6:	74 52                	je     801c0a <syscall+0xad>
+  801bb8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bbd:	7e 4b                	jle    801c0a <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bbf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801bc3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801bc6:	49 89 d0             	mov    %rdx,%r8
+  801bc9:	89 c1                	mov    %eax,%ecx
+  801bcb:	48 b8 48 e1 ff ff ff 	movabs $0xffffffffffffe148,%rax
+  801bd2:	ff ff ff 
+  801bd5:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801bd9:	48 89 c2             	mov    %rax,%rdx
+  801bdc:	be 23 00 00 00       	mov    $0x23,%esi
+  801be1:	48 b8 65 e1 ff ff ff 	movabs $0xffffffffffffe165,%rax
+  801be8:	ff ff ff 
+  801beb:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801bef:	48 89 c7             	mov    %rax,%rdi
+  801bf2:	4d 89 d7             	mov    %r10,%r15
+  801bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfa:	49 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%r9
+  801c01:	ff ff ff 
+  801c04:	4d 01 d1             	add    %r10,%r9
+  801c07:	41 ff d1             	call   *%r9
+
+	return ret;
+  801c0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c0e:	48 83 c4 40          	add    $0x40,%rsp
+  801c12:	5b                   	pop    %rbx
+  801c13:	41 5f                	pop    %r15
+  801c15:	5d                   	pop    %rbp
+  801c16:	c3                   	ret
+
+0000000000801c17 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801c17:	55                   	push   %rbp
+  801c18:	48 89 e5             	mov    %rsp,%rbp
+  801c1b:	41 57                	push   %r15
+  801c1d:	41 56                	push   %r14
+  801c1f:	41 55                	push   %r13
+  801c21:	41 54                	push   %r12
+  801c23:	53                   	push   %rbx
+  801c24:	48 83 ec 48          	sub    $0x48,%rsp
+  801c28:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801c28 <syscall_words+0x11>
+  801c2f:	49 bb 18 74 00 00 00 	movabs $0x7418,%r11
+  801c36:	00 00 00 
+  801c39:	4d 01 de             	add    %r11,%r14
+  801c3c:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801c3f:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801c42:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801c46:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801c4a:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801c4e:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801c52:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c57:	74 09                	je     801c62 <syscall_words+0x4b>
+  801c59:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c5d:	48 8b 00             	mov    (%rax),%rax
+  801c60:	eb 05                	jmp    801c67 <syscall_words+0x50>
+  801c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c67:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801c6a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c6f:	74 0a                	je     801c7b <syscall_words+0x64>
+  801c71:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c75:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c79:	eb 05                	jmp    801c80 <syscall_words+0x69>
+  801c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c80:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801c83:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c88:	74 0a                	je     801c94 <syscall_words+0x7d>
+  801c8a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c8e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c92:	eb 05                	jmp    801c99 <syscall_words+0x82>
+  801c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c99:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801c9c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ca1:	74 0a                	je     801cad <syscall_words+0x96>
+  801ca3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ca7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801cab:	eb 05                	jmp    801cb2 <syscall_words+0x9b>
+  801cad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb2:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801cb5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801cba:	74 0a                	je     801cc6 <syscall_words+0xaf>
+  801cbc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cc0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801cc4:	eb 05                	jmp    801ccb <syscall_words+0xb4>
+  801cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ccb:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801cce:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801cd3:	74 0a                	je     801cdf <syscall_words+0xc8>
+  801cd5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cd9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801cdd:	eb 05                	jmp    801ce4 <syscall_words+0xcd>
+  801cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce4:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801ce7:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801cea:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801cee:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801cf2:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801cf6:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801cfa:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801cfe:	cd 30                	int    $0x30
+  801d00:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801d04:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d09:	74 50                	je     801d5b <syscall_words+0x144>
+		words[0] = r8;
+  801d0b:	4c 89 c2             	mov    %r8,%rdx
+  801d0e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d12:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801d15:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d19:	48 83 c0 08          	add    $0x8,%rax
+  801d1d:	4c 89 ca             	mov    %r9,%rdx
+  801d20:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801d23:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d27:	48 83 c0 10          	add    $0x10,%rax
+  801d2b:	4c 89 d2             	mov    %r10,%rdx
+  801d2e:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801d31:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d35:	48 83 c0 18          	add    $0x18,%rax
+  801d39:	4c 89 da             	mov    %r11,%rdx
+  801d3c:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801d3f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d43:	48 83 c0 20          	add    $0x20,%rax
+  801d47:	4c 89 e2             	mov    %r12,%rdx
+  801d4a:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801d4d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d51:	48 83 c0 28          	add    $0x28,%rax
+  801d55:	4c 89 ea             	mov    %r13,%rdx
+  801d58:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801d5b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801d5f:	74 52                	je     801db3 <syscall_words+0x19c>
+  801d61:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801d66:	7e 4b                	jle    801db3 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d68:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d6c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801d6f:	49 89 d0             	mov    %rdx,%r8
+  801d72:	89 c1                	mov    %eax,%ecx
+  801d74:	48 b8 48 e1 ff ff ff 	movabs $0xffffffffffffe148,%rax
+  801d7b:	ff ff ff 
+  801d7e:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801d82:	48 89 c2             	mov    %rax,%rdx
+  801d85:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801d8a:	48 b8 65 e1 ff ff ff 	movabs $0xffffffffffffe165,%rax
+  801d91:	ff ff ff 
+  801d94:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801d98:	48 89 c7             	mov    %rax,%rdi
+  801d9b:	4d 89 f7             	mov    %r14,%r15
+  801d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da3:	49 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%r9
+  801daa:	ff ff ff 
+  801dad:	4d 01 f1             	add    %r14,%r9
+  801db0:	41 ff d1             	call   *%r9
+
+	return ret;
+  801db3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801db7:	48 83 c4 48          	add    $0x48,%rsp
+  801dbb:	5b                   	pop    %rbx
+  801dbc:	41 5c                	pop    %r12
+  801dbe:	41 5d                	pop    %r13
+  801dc0:	41 5e                	pop    %r14
+  801dc2:	41 5f                	pop    %r15
+  801dc4:	5d                   	pop    %rbp
+  801dc5:	c3                   	ret
+
+0000000000801dc6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801dc6:	55                   	push   %rbp
+  801dc7:	48 89 e5             	mov    %rsp,%rbp
+  801dca:	48 83 ec 10          	sub    $0x10,%rsp
+  801dce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dce <sys_cputs+0x8>
+  801dd5:	49 bb 72 72 00 00 00 	movabs $0x7272,%r11
+  801ddc:	00 00 00 
+  801ddf:	4c 01 d8             	add    %r11,%rax
+  801de2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801de6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801dea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801dee:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801df2:	48 83 ec 08          	sub    $0x8,%rsp
+  801df6:	6a 00                	push   $0x0
+  801df8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801dfe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e04:	be 00 00 00 00       	mov    $0x0,%esi
+  801e09:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e0e:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  801e15:	ff ff ff 
+  801e18:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e1c:	ff d0                	call   *%rax
+  801e1e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e22:	90                   	nop
+  801e23:	c9                   	leave
+  801e24:	c3                   	ret
+
+0000000000801e25 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801e25:	55                   	push   %rbp
+  801e26:	48 89 e5             	mov    %rsp,%rbp
+  801e29:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e29 <sys_cgetc+0x4>
+  801e30:	49 bb 17 72 00 00 00 	movabs $0x7217,%r11
+  801e37:	00 00 00 
+  801e3a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801e3d:	48 83 ec 08          	sub    $0x8,%rsp
+  801e41:	6a 00                	push   $0x0
+  801e43:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e49:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e4f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e59:	be 00 00 00 00       	mov    $0x0,%esi
+  801e5e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e63:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  801e6a:	ff ff ff 
+  801e6d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e71:	ff d0                	call   *%rax
+  801e73:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e77:	c9                   	leave
+  801e78:	c3                   	ret
+
+0000000000801e79 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801e79:	55                   	push   %rbp
+  801e7a:	48 89 e5             	mov    %rsp,%rbp
+  801e7d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e81:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e81 <sys_env_destroy+0x8>
+  801e88:	49 bb bf 71 00 00 00 	movabs $0x71bf,%r11
+  801e8f:	00 00 00 
+  801e92:	4c 01 d8             	add    %r11,%rax
+  801e95:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801e98:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801e9b:	48 63 d2             	movslq %edx,%rdx
+  801e9e:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801eaa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eb5:	be 01 00 00 00       	mov    $0x1,%esi
+  801eba:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ebf:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  801ec6:	ff ff ff 
+  801ec9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ecd:	ff d0                	call   *%rax
+  801ecf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ed3:	c9                   	leave
+  801ed4:	c3                   	ret
+
+0000000000801ed5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801ed5:	55                   	push   %rbp
+  801ed6:	48 89 e5             	mov    %rsp,%rbp
+  801ed9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ed9 <sys_getenvid+0x4>
+  801ee0:	49 bb 67 71 00 00 00 	movabs $0x7167,%r11
+  801ee7:	00 00 00 
+  801eea:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801eed:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef1:	6a 00                	push   $0x0
+  801ef3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ef9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f09:	be 00 00 00 00       	mov    $0x0,%esi
+  801f0e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f13:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  801f1a:	ff ff ff 
+  801f1d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f21:	ff d0                	call   *%rax
+  801f23:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f27:	c9                   	leave
+  801f28:	c3                   	ret
+
+0000000000801f29 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801f29:	55                   	push   %rbp
+  801f2a:	48 89 e5             	mov    %rsp,%rbp
+  801f2d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f2d <sys_yield+0x4>
+  801f34:	49 bb 13 71 00 00 00 	movabs $0x7113,%r11
+  801f3b:	00 00 00 
+  801f3e:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f41:	48 83 ec 08          	sub    $0x8,%rsp
+  801f45:	6a 00                	push   $0x0
+  801f47:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f62:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801f67:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  801f6e:	ff ff ff 
+  801f71:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f75:	ff d0                	call   *%rax
+  801f77:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f7b:	90                   	nop
+  801f7c:	c9                   	leave
+  801f7d:	c3                   	ret
+
+0000000000801f7e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801f7e:	55                   	push   %rbp
+  801f7f:	48 89 e5             	mov    %rsp,%rbp
+  801f82:	48 83 ec 10          	sub    $0x10,%rsp
+  801f86:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f86 <sys_page_alloc+0x8>
+  801f8d:	49 bb ba 70 00 00 00 	movabs $0x70ba,%r11
+  801f94:	00 00 00 
+  801f97:	4c 01 d8             	add    %r11,%rax
+  801f9a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f9d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801fa1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801fa4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801fa7:	48 63 f2             	movslq %edx,%rsi
+  801faa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fae:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fb1:	48 63 d2             	movslq %edx,%rdx
+  801fb4:	48 83 ec 08          	sub    $0x8,%rsp
+  801fb8:	6a 00                	push   $0x0
+  801fba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fc0:	49 89 f0             	mov    %rsi,%r8
+  801fc3:	be 01 00 00 00       	mov    $0x1,%esi
+  801fc8:	bf 04 00 00 00       	mov    $0x4,%edi
+  801fcd:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  801fd4:	ff ff ff 
+  801fd7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fdb:	ff d0                	call   *%rax
+  801fdd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fe1:	c9                   	leave
+  801fe2:	c3                   	ret
+
+0000000000801fe3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801fe3:	55                   	push   %rbp
+  801fe4:	48 89 e5             	mov    %rsp,%rbp
+  801fe7:	48 83 ec 20          	sub    $0x20,%rsp
+  801feb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801feb <sys_page_map+0x8>
+  801ff2:	49 bb 55 70 00 00 00 	movabs $0x7055,%r11
+  801ff9:	00 00 00 
+  801ffc:	4c 01 d8             	add    %r11,%rax
+  801fff:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802002:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802006:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802009:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80200d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802011:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802014:	48 63 f2             	movslq %edx,%rsi
+  802017:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80201b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80201e:	48 63 fa             	movslq %edx,%rdi
+  802021:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802025:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802028:	48 63 d2             	movslq %edx,%rdx
+  80202b:	48 83 ec 08          	sub    $0x8,%rsp
+  80202f:	56                   	push   %rsi
+  802030:	4d 89 c1             	mov    %r8,%r9
+  802033:	49 89 f8             	mov    %rdi,%r8
+  802036:	be 01 00 00 00       	mov    $0x1,%esi
+  80203b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802040:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802047:	ff ff ff 
+  80204a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80204e:	ff d0                	call   *%rax
+  802050:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802054:	c9                   	leave
+  802055:	c3                   	ret
+
+0000000000802056 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802056:	55                   	push   %rbp
+  802057:	48 89 e5             	mov    %rsp,%rbp
+  80205a:	48 83 ec 10          	sub    $0x10,%rsp
+  80205e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80205e <sys_page_unmap+0x8>
+  802065:	49 bb e2 6f 00 00 00 	movabs $0x6fe2,%r11
+  80206c:	00 00 00 
+  80206f:	4c 01 d8             	add    %r11,%rax
+  802072:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802075:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802079:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80207d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802080:	48 63 d2             	movslq %edx,%rdx
+  802083:	48 83 ec 08          	sub    $0x8,%rsp
+  802087:	6a 00                	push   $0x0
+  802089:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80208f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802095:	be 01 00 00 00       	mov    $0x1,%esi
+  80209a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80209f:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  8020a6:	ff ff ff 
+  8020a9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020ad:	ff d0                	call   *%rax
+  8020af:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020b3:	c9                   	leave
+  8020b4:	c3                   	ret
+
+00000000008020b5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8020b5:	55                   	push   %rbp
+  8020b6:	48 89 e5             	mov    %rsp,%rbp
+  8020b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8020bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020bd <sys_env_set_status+0x8>
+  8020c4:	49 bb 83 6f 00 00 00 	movabs $0x6f83,%r11
+  8020cb:	00 00 00 
+  8020ce:	4c 01 d8             	add    %r11,%rax
+  8020d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020d4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8020d7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020da:	48 63 ca             	movslq %edx,%rcx
+  8020dd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020e0:	48 63 d2             	movslq %edx,%rdx
+  8020e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e7:	6a 00                	push   $0x0
+  8020e9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8020fa:	bf 08 00 00 00       	mov    $0x8,%edi
+  8020ff:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802106:	ff ff ff 
+  802109:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80210d:	ff d0                	call   *%rax
+  80210f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802113:	c9                   	leave
+  802114:	c3                   	ret
+
+0000000000802115 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802115:	55                   	push   %rbp
+  802116:	48 89 e5             	mov    %rsp,%rbp
+  802119:	48 83 ec 10          	sub    $0x10,%rsp
+  80211d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80211d <sys_env_set_trapframe+0x8>
+  802124:	49 bb 23 6f 00 00 00 	movabs $0x6f23,%r11
+  80212b:	00 00 00 
+  80212e:	4c 01 d8             	add    %r11,%rax
+  802131:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802134:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802138:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80213c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80213f:	48 63 d2             	movslq %edx,%rdx
+  802142:	48 83 ec 08          	sub    $0x8,%rsp
+  802146:	6a 00                	push   $0x0
+  802148:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80214e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802154:	be 01 00 00 00       	mov    $0x1,%esi
+  802159:	bf 09 00 00 00       	mov    $0x9,%edi
+  80215e:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802165:	ff ff ff 
+  802168:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80216c:	ff d0                	call   *%rax
+  80216e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802172:	c9                   	leave
+  802173:	c3                   	ret
+
+0000000000802174 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802174:	55                   	push   %rbp
+  802175:	48 89 e5             	mov    %rsp,%rbp
+  802178:	48 83 ec 10          	sub    $0x10,%rsp
+  80217c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80217c <sys_env_set_pgfault_upcall+0x8>
+  802183:	49 bb c4 6e 00 00 00 	movabs $0x6ec4,%r11
+  80218a:	00 00 00 
+  80218d:	4c 01 d8             	add    %r11,%rax
+  802190:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802193:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802197:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80219b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80219e:	48 63 d2             	movslq %edx,%rdx
+  8021a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a5:	6a 00                	push   $0x0
+  8021a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8021b8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8021bd:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  8021c4:	ff ff ff 
+  8021c7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021cb:	ff d0                	call   *%rax
+  8021cd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021d1:	c9                   	leave
+  8021d2:	c3                   	ret
+
+00000000008021d3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8021d3:	55                   	push   %rbp
+  8021d4:	48 89 e5             	mov    %rsp,%rbp
+  8021d7:	48 83 ec 20          	sub    $0x20,%rsp
+  8021db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021db <sys_ipc_try_send+0x8>
+  8021e2:	49 bb 65 6e 00 00 00 	movabs $0x6e65,%r11
+  8021e9:	00 00 00 
+  8021ec:	4c 01 d8             	add    %r11,%rax
+  8021ef:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021fa:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8021fd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802200:	48 63 fa             	movslq %edx,%rdi
+  802203:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802207:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80220a:	48 63 d2             	movslq %edx,%rdx
+  80220d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802211:	48 83 ec 08          	sub    $0x8,%rsp
+  802215:	6a 00                	push   $0x0
+  802217:	49 89 f9             	mov    %rdi,%r9
+  80221a:	49 89 f0             	mov    %rsi,%r8
+  80221d:	be 00 00 00 00       	mov    $0x0,%esi
+  802222:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802227:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  80222e:	ff ff ff 
+  802231:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802235:	ff d0                	call   *%rax
+  802237:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80223b:	c9                   	leave
+  80223c:	c3                   	ret
+
+000000000080223d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80223d:	55                   	push   %rbp
+  80223e:	48 89 e5             	mov    %rsp,%rbp
+  802241:	48 83 ec 20          	sub    $0x20,%rsp
+  802245:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802245 <sys_ipc_send+0x8>
+  80224c:	49 bb fb 6d 00 00 00 	movabs $0x6dfb,%r11
+  802253:	00 00 00 
+  802256:	4c 01 d8             	add    %r11,%rax
+  802259:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80225c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802260:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802264:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802267:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80226a:	48 63 fa             	movslq %edx,%rdi
+  80226d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802271:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802274:	48 63 d2             	movslq %edx,%rdx
+  802277:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80227b:	48 83 ec 08          	sub    $0x8,%rsp
+  80227f:	6a 00                	push   $0x0
+  802281:	49 89 f9             	mov    %rdi,%r9
+  802284:	49 89 f0             	mov    %rsi,%r8
+  802287:	be 00 00 00 00       	mov    $0x0,%esi
+  80228c:	bf 17 00 00 00       	mov    $0x17,%edi
+  802291:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802298:	ff ff ff 
+  80229b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80229f:	ff d0                	call   *%rax
+  8022a1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a5:	c9                   	leave
+  8022a6:	c3                   	ret
+
+00000000008022a7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8022a7:	55                   	push   %rbp
+  8022a8:	48 89 e5             	mov    %rsp,%rbp
+  8022ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8022af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022af <sys_ipc_recv+0x8>
+  8022b6:	49 bb 91 6d 00 00 00 	movabs $0x6d91,%r11
+  8022bd:	00 00 00 
+  8022c0:	4c 01 d8             	add    %r11,%rax
+  8022c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8022c7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8022cb:	6a 00                	push   $0x0
+  8022cd:	6a 00                	push   $0x0
+  8022cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8022e5:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8022ea:	49 ba d7 8b ff ff ff 	movabs $0xffffffffffff8bd7,%r10
+  8022f1:	ff ff ff 
+  8022f4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022f8:	ff d0                	call   *%rax
+  8022fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022fe:	c9                   	leave
+  8022ff:	c3                   	ret
+
+0000000000802300 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802300:	55                   	push   %rbp
+  802301:	48 89 e5             	mov    %rsp,%rbp
+  802304:	48 83 ec 30          	sub    $0x30,%rsp
+  802308:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802308 <sys_ipc_call+0x8>
+  80230f:	49 bb 38 6d 00 00 00 	movabs $0x6d38,%r11
+  802316:	00 00 00 
+  802319:	4c 01 d8             	add    %r11,%rax
+  80231c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80231f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802323:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802327:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80232a:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80232e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802332:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802336:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802339:	4c 63 c2             	movslq %edx,%r8
+  80233c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802340:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802343:	48 63 d2             	movslq %edx,%rdx
+  802346:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80234a:	ff 75 d8             	push   -0x28(%rbp)
+  80234d:	56                   	push   %rsi
+  80234e:	4d 89 c1             	mov    %r8,%r9
+  802351:	49 89 f8             	mov    %rdi,%r8
+  802354:	be 00 00 00 00       	mov    $0x0,%esi
+  802359:	bf 18 00 00 00       	mov    $0x18,%edi
+  80235e:	49 ba d7 8b ff ff ff 	movabs $0xffffffffffff8bd7,%r10
+  802365:	ff ff ff 
+  802368:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80236c:	ff d0                	call   *%rax
+  80236e:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802372:	c9                   	leave
+  802373:	c3                   	ret
+
+0000000000802374 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802374:	55                   	push   %rbp
+  802375:	48 89 e5             	mov    %rsp,%rbp
+  802378:	48 83 ec 30          	sub    $0x30,%rsp
+  80237c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80237c <sys_ipc_reply_recv+0x8>
+  802383:	49 bb c4 6c 00 00 00 	movabs $0x6cc4,%r11
+  80238a:	00 00 00 
+  80238d:	4c 01 d8             	add    %r11,%rax
+  802390:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802393:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802397:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80239b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80239e:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8023a2:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8023a6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8023aa:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023ad:	4c 63 c2             	movslq %edx,%r8
+  8023b0:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8023b4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023b7:	48 63 d2             	movslq %edx,%rdx
+  8023ba:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023be:	ff 75 d8             	push   -0x28(%rbp)
+  8023c1:	56                   	push   %rsi
+  8023c2:	4d 89 c1             	mov    %r8,%r9
+  8023c5:	49 89 f8             	mov    %rdi,%r8
+  8023c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cd:	bf 19 00 00 00       	mov    $0x19,%edi
+  8023d2:	49 ba d7 8b ff ff ff 	movabs $0xffffffffffff8bd7,%r10
+  8023d9:	ff ff ff 
+  8023dc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023e0:	ff d0                	call   *%rax
+  8023e2:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8023e6:	c9                   	leave
+  8023e7:	c3                   	ret
+
+00000000008023e8 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8023e8:	55                   	push   %rbp
+  8023e9:	48 89 e5             	mov    %rsp,%rbp
+  8023ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8023f0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023f0 <sys_env_set_priority+0x8>
+  8023f7:	49 bb 50 6c 00 00 00 	movabs $0x6c50,%r11
+  8023fe:	00 00 00 
+  802401:	4c 01 d8             	add    %r11,%rax
+  802404:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802407:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80240a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80240d:	48 63 ca             	movslq %edx,%rcx
+  802410:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802413:	48 63 d2             	movslq %edx,%rdx
+  802416:	48 83 ec 08          	sub    $0x8,%rsp
+  80241a:	6a 00                	push   $0x0
+  80241c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802422:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802428:	be 01 00 00 00       	mov    $0x1,%esi
+  80242d:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802432:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802439:	ff ff ff 
+  80243c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802440:	ff d0                	call   *%rax
+  802442:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802446:	c9                   	leave
+  802447:	c3                   	ret
+
+0000000000802448 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802448:	55                   	push   %rbp
+  802449:	48 89 e5             	mov    %rsp,%rbp
+  80244c:	48 83 ec 10          	sub    $0x10,%rsp
+  802450:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802450 <sys_env_set_affinity+0x8>
+  802457:	49 bb f0 6b 00 00 00 	movabs $0x6bf0,%r11
+  80245e:	00 00 00 
+  802461:	4c 01 d8             	add    %r11,%rax
+  802464:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802467:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  80246a:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  80246d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802470:	48 63 d2             	movslq %edx,%rdx
+  802473:	48 83 ec 08          	sub    $0x8,%rsp
+  802477:	6a 00                	push   $0x0
+  802479:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80247f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802485:	be 01 00 00 00       	mov    $0x1,%esi
+  80248a:	bf 10 00 00 00       	mov    $0x10,%edi
+  80248f:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802496:	ff ff ff 
+  802499:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80249d:	ff d0                	call   *%rax
+  80249f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024a3:	c9                   	leave
+  8024a4:	c3                   	ret
+
+00000000008024a5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8024a5:	55                   	push   %rbp
+  8024a6:	48 89 e5             	mov    %rsp,%rbp
+  8024a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024a9 <sys_time_msec+0x4>
+  8024b0:	49 bb 97 6b 00 00 00 	movabs $0x6b97,%r11
+  8024b7:	00 00 00 
+  8024ba:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8024bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8024c1:	6a 00                	push   $0x0
+  8024c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024de:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8024e3:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  8024ea:	ff ff ff 
+  8024ed:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024f1:	ff d0                	call   *%rax
+  8024f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f7:	c9                   	leave
+  8024f8:	c3                   	ret
+
+00000000008024f9 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8024f9:	55                   	push   %rbp
+  8024fa:	48 89 e5             	mov    %rsp,%rbp
+  8024fd:	48 83 ec 10          	sub    $0x10,%rsp
+  802501:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802501 <sys_sleep_usec+0x8>
+  802508:	49 bb 3f 6b 00 00 00 	movabs $0x6b3f,%r11
+  80250f:	00 00 00 
+  802512:	4c 01 d8             	add    %r11,%rax
+  802515:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802519:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80251d:	48 83 ec 08          	sub    $0x8,%rsp
+  802521:	6a 00                	push   $0x0
+  802523:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802529:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80252f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802534:	be 00 00 00 00       	mov    $0x0,%esi
+  802539:	bf 11 00 00 00       	mov    $0x11,%edi
+  80253e:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802545:	ff ff ff 
+  802548:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80254c:	ff d0                	call   *%rax
+  80254e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802552:	c9                   	leave
+  802553:	c3                   	ret
+
+0000000000802554 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802554:	55                   	push   %rbp
+  802555:	48 89 e5             	mov    %rsp,%rbp
+  802558:	48 83 ec 10          	sub    $0x10,%rsp
+  80255c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80255c <sys_page_alloc_huge+0x8>
+  802563:	49 bb e4 6a 00 00 00 	movabs $0x6ae4,%r11
+  80256a:	00 00 00 
+  80256d:	4c 01 d8             	add    %r11,%rax
+  802570:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802573:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802577:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  80257a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80257d:	48 63 f2             	movslq %edx,%rsi
+  802580:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802584:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802587:	48 63 d2             	movslq %edx,%rdx
+  80258a:	48 83 ec 08          	sub    $0x8,%rsp
+  80258e:	6a 00                	push   $0x0
+  802590:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802596:	49 89 f0             	mov    %rsi,%r8
+  802599:	be 01 00 00 00       	mov    $0x1,%esi
+  80259e:	bf 12 00 00 00       	mov    $0x12,%edi
+  8025a3:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  8025aa:	ff ff ff 
+  8025ad:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025b1:	ff d0                	call   *%rax
+  8025b3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025b7:	c9                   	leave
+  8025b8:	c3                   	ret
+
+00000000008025b9 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8025b9:	55                   	push   %rbp
+  8025ba:	48 89 e5             	mov    %rsp,%rbp
+  8025bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8025c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025c1 <sys_page_map_batch+0x8>
+  8025c8:	49 bb 7f 6a 00 00 00 	movabs $0x6a7f,%r11
+  8025cf:	00 00 00 
+  8025d2:	4c 01 d8             	add    %r11,%rax
+  8025d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8025dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025e1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8025e9:	6a 00                	push   $0x0
+  8025eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8025fc:	bf 13 00 00 00       	mov    $0x13,%edi
+  802601:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802608:	ff ff ff 
+  80260b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80260f:	ff d0                	call   *%rax
+  802611:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802615:	c9                   	leave
+  802616:	c3                   	ret
+
+0000000000802617 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802617:	55                   	push   %rbp
+  802618:	48 89 e5             	mov    %rsp,%rbp
+  80261b:	48 83 ec 10          	sub    $0x10,%rsp
+  80261f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80261f <sys_page_alloc_batch+0x8>
+  802626:	49 bb 21 6a 00 00 00 	movabs $0x6a21,%r11
+  80262d:	00 00 00 
+  802630:	4c 01 d8             	add    %r11,%rax
+  802633:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802637:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80263b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80263f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802643:	48 83 ec 08          	sub    $0x8,%rsp
+  802647:	6a 00                	push   $0x0
+  802649:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80264f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802655:	be 01 00 00 00       	mov    $0x1,%esi
+  80265a:	bf 14 00 00 00       	mov    $0x14,%edi
+  80265f:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802666:	ff ff ff 
+  802669:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80266d:	ff d0                	call   *%rax
+  80266f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802673:	c9                   	leave
+  802674:	c3                   	ret
+
+0000000000802675 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802675:	55                   	push   %rbp
+  802676:	48 89 e5             	mov    %rsp,%rbp
+  802679:	48 83 ec 10          	sub    $0x10,%rsp
+  80267d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80267d <sys_page_unmap_batch+0x8>
+  802684:	49 bb c3 69 00 00 00 	movabs $0x69c3,%r11
+  80268b:	00 00 00 
+  80268e:	4c 01 d8             	add    %r11,%rax
+  802691:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802695:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802699:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80269d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a5:	6a 00                	push   $0x0
+  8026a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8026b8:	bf 15 00 00 00       	mov    $0x15,%edi
+  8026bd:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  8026c4:	ff ff ff 
+  8026c7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026cb:	ff d0                	call   *%rax
+  8026cd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+
+00000000008026d3 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8026d3:	55                   	push   %rbp
+  8026d4:	48 89 e5             	mov    %rsp,%rbp
+  8026d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026d7 <sys_fork+0x4>
+  8026de:	49 bb 69 69 00 00 00 	movabs $0x6969,%r11
+  8026e5:	00 00 00 
+  8026e8:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8026eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ef:	6a 00                	push   $0x0
+  8026f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802702:	ba 00 00 00 00       	mov    $0x0,%edx
+  802707:	be 00 00 00 00       	mov    $0x0,%esi
+  80270c:	bf 16 00 00 00       	mov    $0x16,%edi
+  802711:	49 ba 1d 8b ff ff ff 	movabs $0xffffffffffff8b1d,%r10
+  802718:	ff ff ff 
+  80271b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80271f:	ff d0                	call   *%rax
+  802721:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802725:	c9                   	leave
+  802726:	c3                   	ret
+
+0000000000802727 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802727:	55                   	push   %rbp
+  802728:	48 89 e5             	mov    %rsp,%rbp
+  80272b:	41 57                	push   %r15
+  80272d:	53                   	push   %rbx
+  80272e:	48 83 ec 40          	sub    $0x40,%rsp
+  802732:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802732 <pgfault+0xb>
+  802739:	49 bb 0e 69 00 00 00 	movabs $0x690e,%r11
+  802740:	00 00 00 
+  802743:	4c 01 db             	add    %r11,%rbx
+  802746:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  80274a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80274e:	48 8b 00             	mov    (%rax),%rax
+  802751:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802755:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802759:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80275d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802760:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802764:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802768:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80276c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802772:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802776:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802779:	83 e0 02             	and    $0x2,%eax
+  80277c:	85 c0                	test   %eax,%eax
+  80277e:	0f 84 91 03 00 00    	je     802b15 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802784:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802788:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80278c:	48 89 c2             	mov    %rax,%rdx
+  80278f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802796:	ff ff ff 
+  802799:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80279d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027a1:	83 e0 01             	and    $0x1,%eax
+  8027a4:	48 85 c0             	test   %rax,%rax
+  8027a7:	0f 84 a7 01 00 00    	je     802954 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  8027ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027b1:	48 c1 e8 15          	shr    $0x15,%rax
+  8027b5:	48 89 c2             	mov    %rax,%rdx
+  8027b8:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8027bf:	ff ff ff 
+  8027c2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8027c6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027ca:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8027cf:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  8027d5:	0f 85 79 01 00 00    	jne    802954 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  8027db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027df:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8027e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8027e7:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  8027ed:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  8027f1:	ba 07 00 00 00       	mov    $0x7,%edx
+  8027f6:	be 00 00 60 00       	mov    $0x600000,%esi
+  8027fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802800:	49 89 df             	mov    %rbx,%r15
+  802803:	48 b8 14 95 ff ff ff 	movabs $0xffffffffffff9514,%rax
+  80280a:	ff ff ff 
+  80280d:	48 01 d8             	add    %rbx,%rax
+  802810:	ff d0                	call   *%rax
+  802812:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802815:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802819:	79 44                	jns    80285f <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  80281b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80281e:	89 c1                	mov    %eax,%ecx
+  802820:	48 b8 78 e1 ff ff ff 	movabs $0xffffffffffffe178,%rax
+  802827:	ff ff ff 
+  80282a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80282e:	48 89 c2             	mov    %rax,%rdx
+  802831:	be 20 00 00 00       	mov    $0x20,%esi
+  802836:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  80283d:	ff ff ff 
+  802840:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802844:	48 89 c7             	mov    %rax,%rdi
+  802847:	49 89 df             	mov    %rbx,%r15
+  80284a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284f:	49 b8 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%r8
+  802856:	ff ff ff 
+  802859:	49 01 d8             	add    %rbx,%r8
+  80285c:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  80285f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802863:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802868:	48 89 c6             	mov    %rax,%rsi
+  80286b:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802870:	49 89 df             	mov    %rbx,%r15
+  802873:	48 b8 8d 87 ff ff ff 	movabs $0xffffffffffff878d,%rax
+  80287a:	ff ff ff 
+  80287d:	48 01 d8             	add    %rbx,%rax
+  802880:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802882:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802886:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80288c:	48 89 c1             	mov    %rax,%rcx
+  80288f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802894:	be 00 00 60 00       	mov    $0x600000,%esi
+  802899:	bf 00 00 00 00       	mov    $0x0,%edi
+  80289e:	49 89 df             	mov    %rbx,%r15
+  8028a1:	48 b8 a3 8f ff ff ff 	movabs $0xffffffffffff8fa3,%rax
+  8028a8:	ff ff ff 
+  8028ab:	48 01 d8             	add    %rbx,%rax
+  8028ae:	ff d0                	call   *%rax
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	74 3e                	je     8028f2 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  8028b4:	48 b8 a3 e1 ff ff ff 	movabs $0xffffffffffffe1a3,%rax
+  8028bb:	ff ff ff 
+  8028be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8028c2:	48 89 c2             	mov    %rax,%rdx
+  8028c5:	be 23 00 00 00       	mov    $0x23,%esi
+  8028ca:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  8028d1:	ff ff ff 
+  8028d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8028d8:	48 89 c7             	mov    %rax,%rdi
+  8028db:	49 89 df             	mov    %rbx,%r15
+  8028de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e3:	48 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rcx
+  8028ea:	ff ff ff 
+  8028ed:	48 01 d9             	add    %rbx,%rcx
+  8028f0:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  8028f2:	be 00 00 60 00       	mov    $0x600000,%esi
+  8028f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fc:	49 89 df             	mov    %rbx,%r15
+  8028ff:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  802906:	ff ff ff 
+  802909:	48 01 d8             	add    %rbx,%rax
+  80290c:	ff d0                	call   *%rax
+  80290e:	85 c0                	test   %eax,%eax
+  802910:	0f 84 3d 02 00 00    	je     802b53 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802916:	48 b8 b8 e1 ff ff ff 	movabs $0xffffffffffffe1b8,%rax
+  80291d:	ff ff ff 
+  802920:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802924:	48 89 c2             	mov    %rax,%rdx
+  802927:	be 25 00 00 00       	mov    $0x25,%esi
+  80292c:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  802933:	ff ff ff 
+  802936:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80293a:	48 89 c7             	mov    %rax,%rdi
+  80293d:	49 89 df             	mov    %rbx,%r15
+  802940:	b8 00 00 00 00       	mov    $0x0,%eax
+  802945:	48 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rcx
+  80294c:	ff ff ff 
+  80294f:	48 01 d9             	add    %rbx,%rcx
+  802952:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802954:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802958:	48 c1 e8 0c          	shr    $0xc,%rax
+  80295c:	48 89 c2             	mov    %rax,%rdx
+  80295f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802966:	ff ff ff 
+  802969:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80296d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802971:	25 00 08 00 00       	and    $0x800,%eax
+  802976:	48 85 c0             	test   %rax,%rax
+  802979:	0f 84 58 01 00 00    	je     802ad7 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  80297f:	ba 07 00 00 00       	mov    $0x7,%edx
+  802984:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802989:	bf 00 00 00 00       	mov    $0x0,%edi
+  80298e:	49 89 df             	mov    %rbx,%r15
+  802991:	48 b8 3e 8f ff ff ff 	movabs $0xffffffffffff8f3e,%rax
+  802998:	ff ff ff 
+  80299b:	48 01 d8             	add    %rbx,%rax
+  80299e:	ff d0                	call   *%rax
+  8029a0:	85 c0                	test   %eax,%eax
+  8029a2:	74 3e                	je     8029e2 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  8029a4:	48 b8 cf e1 ff ff ff 	movabs $0xffffffffffffe1cf,%rax
+  8029ab:	ff ff ff 
+  8029ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029b2:	48 89 c2             	mov    %rax,%rdx
+  8029b5:	be 2a 00 00 00       	mov    $0x2a,%esi
+  8029ba:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  8029c1:	ff ff ff 
+  8029c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029c8:	48 89 c7             	mov    %rax,%rdi
+  8029cb:	49 89 df             	mov    %rbx,%r15
+  8029ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d3:	48 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rcx
+  8029da:	ff ff ff 
+  8029dd:	48 01 d9             	add    %rbx,%rcx
+  8029e0:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  8029e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029eb:	48 89 c6             	mov    %rax,%rsi
+  8029ee:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  8029f3:	49 89 df             	mov    %rbx,%r15
+  8029f6:	48 b8 8d 87 ff ff ff 	movabs $0xffffffffffff878d,%rax
+  8029fd:	ff ff ff 
+  802a00:	48 01 d8             	add    %rbx,%rax
+  802a03:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802a05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a09:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802a0f:	48 89 c1             	mov    %rax,%rcx
+  802a12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a17:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802a1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a21:	49 89 df             	mov    %rbx,%r15
+  802a24:	48 b8 a3 8f ff ff ff 	movabs $0xffffffffffff8fa3,%rax
+  802a2b:	ff ff ff 
+  802a2e:	48 01 d8             	add    %rbx,%rax
+  802a31:	ff d0                	call   *%rax
+  802a33:	85 c0                	test   %eax,%eax
+  802a35:	74 3e                	je     802a75 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802a37:	48 b8 a3 e1 ff ff ff 	movabs $0xffffffffffffe1a3,%rax
+  802a3e:	ff ff ff 
+  802a41:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a45:	48 89 c2             	mov    %rax,%rdx
+  802a48:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802a4d:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  802a54:	ff ff ff 
+  802a57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a5b:	48 89 c7             	mov    %rax,%rdi
+  802a5e:	49 89 df             	mov    %rbx,%r15
+  802a61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a66:	48 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rcx
+  802a6d:	ff ff ff 
+  802a70:	48 01 d9             	add    %rbx,%rcx
+  802a73:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802a75:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802a7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a7f:	49 89 df             	mov    %rbx,%r15
+  802a82:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  802a89:	ff ff ff 
+  802a8c:	48 01 d8             	add    %rbx,%rax
+  802a8f:	ff d0                	call   *%rax
+  802a91:	85 c0                	test   %eax,%eax
+  802a93:	0f 84 bb 00 00 00    	je     802b54 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802a99:	48 b8 b8 e1 ff ff ff 	movabs $0xffffffffffffe1b8,%rax
+  802aa0:	ff ff ff 
+  802aa3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aa7:	48 89 c2             	mov    %rax,%rdx
+  802aaa:	be 32 00 00 00       	mov    $0x32,%esi
+  802aaf:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  802ab6:	ff ff ff 
+  802ab9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802abd:	48 89 c7             	mov    %rax,%rdi
+  802ac0:	49 89 df             	mov    %rbx,%r15
+  802ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac8:	48 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rcx
+  802acf:	ff ff ff 
+  802ad2:	48 01 d9             	add    %rbx,%rcx
+  802ad5:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802ad7:	48 b8 e8 e1 ff ff ff 	movabs $0xffffffffffffe1e8,%rax
+  802ade:	ff ff ff 
+  802ae1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ae5:	48 89 c2             	mov    %rax,%rdx
+  802ae8:	be 36 00 00 00       	mov    $0x36,%esi
+  802aed:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  802af4:	ff ff ff 
+  802af7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802afb:	48 89 c7             	mov    %rax,%rdi
+  802afe:	49 89 df             	mov    %rbx,%r15
+  802b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b06:	48 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rcx
+  802b0d:	ff ff ff 
+  802b10:	48 01 d9             	add    %rbx,%rcx
+  802b13:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802b15:	48 b8 07 e2 ff ff ff 	movabs $0xffffffffffffe207,%rax
+  802b1c:	ff ff ff 
+  802b1f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b23:	48 89 c2             	mov    %rax,%rdx
+  802b26:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802b2b:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  802b32:	ff ff ff 
+  802b35:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b39:	48 89 c7             	mov    %rax,%rdi
+  802b3c:	49 89 df             	mov    %rbx,%r15
+  802b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b44:	48 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rcx
+  802b4b:	ff ff ff 
+  802b4e:	48 01 d9             	add    %rbx,%rcx
+  802b51:	ff d1                	call   *%rcx
+			return;
+  802b53:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802b54:	48 83 c4 40          	add    $0x40,%rsp
+  802b58:	5b                   	pop    %rbx
+  802b59:	41 5f                	pop    %r15
+  802b5b:	5d                   	pop    %rbp
+  802b5c:	c3                   	ret
+
+0000000000802b5d <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802b5d:	55                   	push   %rbp
+  802b5e:	48 89 e5             	mov    %rsp,%rbp
+  802b61:	41 57                	push   %r15
+  802b63:	53                   	push   %rbx
+  802b64:	48 83 ec 10          	sub    $0x10,%rsp
+  802b68:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b68 <fork_flush+0xb>
+  802b6f:	49 bb d8 64 00 00 00 	movabs $0x64d8,%r11
+  802b76:	00 00 00 
+  802b79:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802b7c:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802b83:	00 00 00 
+  802b86:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b8a:	48 85 c0             	test   %rax,%rax
+  802b8d:	0f 84 81 00 00 00    	je     802c14 <fork_flush+0xb7>
+  802b93:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802b9a:	00 00 00 
+  802b9d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ba1:	48 89 c6             	mov    %rax,%rsi
+  802ba4:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802bab:	00 00 00 
+  802bae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bb2:	48 89 c7             	mov    %rax,%rdi
+  802bb5:	49 89 df             	mov    %rbx,%r15
+  802bb8:	48 b8 79 95 ff ff ff 	movabs $0xffffffffffff9579,%rax
+  802bbf:	ff ff ff 
+  802bc2:	48 01 d8             	add    %rbx,%rax
+  802bc5:	ff d0                	call   *%rax
+  802bc7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802bce:	79 44                	jns    802c14 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802bd0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802bd3:	89 c1                	mov    %eax,%ecx
+  802bd5:	48 b8 20 e2 ff ff ff 	movabs $0xffffffffffffe220,%rax
+  802bdc:	ff ff ff 
+  802bdf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802be3:	48 89 c2             	mov    %rax,%rdx
+  802be6:	be 56 00 00 00       	mov    $0x56,%esi
+  802beb:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  802bf2:	ff ff ff 
+  802bf5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bf9:	48 89 c7             	mov    %rax,%rdi
+  802bfc:	49 89 df             	mov    %rbx,%r15
+  802bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c04:	49 b8 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%r8
+  802c0b:	ff ff ff 
+  802c0e:	49 01 d8             	add    %rbx,%r8
+  802c11:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802c14:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802c1b:	00 00 00 
+  802c1e:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802c25:	00 
+}
+  802c26:	90                   	nop
+  802c27:	48 83 c4 10          	add    $0x10,%rsp
+  802c2b:	5b                   	pop    %rbx
+  802c2c:	41 5f                	pop    %r15
+  802c2e:	5d                   	pop    %rbp
+  802c2f:	c3                   	ret
+
+0000000000802c30 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802c30:	55                   	push   %rbp
+  802c31:	48 89 e5             	mov    %rsp,%rbp
+  802c34:	53                   	push   %rbx
+  802c35:	48 83 ec 28          	sub    $0x28,%rsp
+  802c39:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c39 <fork_map+0x9>
+  802c40:	49 bb 07 64 00 00 00 	movabs $0x6407,%r11
+  802c47:	00 00 00 
+  802c4a:	4c 01 db             	add    %r11,%rbx
+  802c4d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c50:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802c54:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802c57:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802c5e:	00 00 00 
+  802c61:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c65:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802c6b:	75 10                	jne    802c7d <fork_map+0x4d>
+		fork_flush();
+  802c6d:	48 b8 1d 9b ff ff ff 	movabs $0xffffffffffff9b1d,%rax
+  802c74:	ff ff ff 
+  802c77:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c7b:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802c7d:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802c84:	00 00 00 
+  802c87:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c8b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802c8f:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802c96:	00 00 00 
+  802c99:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802c9d:	48 c1 e0 05          	shl    $0x5,%rax
+  802ca1:	48 89 c2             	mov    %rax,%rdx
+  802ca4:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802cab:	00 00 00 
+  802cae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cb2:	48 01 d0             	add    %rdx,%rax
+  802cb5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802cb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cbd:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802cc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cc7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ccb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802ccf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cd3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802cd6:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802cd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cdd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ce1:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802ce5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ce9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802cec:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802cef:	90                   	nop
+  802cf0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cf4:	c9                   	leave
+  802cf5:	c3                   	ret
+
+0000000000802cf6 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802cf6:	55                   	push   %rbp
+  802cf7:	48 89 e5             	mov    %rsp,%rbp
+  802cfa:	53                   	push   %rbx
+  802cfb:	48 83 ec 28          	sub    $0x28,%rsp
+  802cff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802cff <duppage+0x9>
+  802d06:	49 bb 41 63 00 00 00 	movabs $0x6341,%r11
+  802d0d:	00 00 00 
+  802d10:	4c 01 db             	add    %r11,%rbx
+  802d13:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d16:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802d19:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802d1c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802d24:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d2b:	ff ff ff 
+  802d2e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d32:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d35:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d39:	25 00 04 00 00       	and    $0x400,%eax
+  802d3e:	48 85 c0             	test   %rax,%rax
+  802d41:	74 42                	je     802d85 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802d43:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d4a:	ff ff ff 
+  802d4d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d51:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d54:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d58:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d5d:	89 c2                	mov    %eax,%edx
+  802d5f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d63:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d66:	48 89 ce             	mov    %rcx,%rsi
+  802d69:	89 c7                	mov    %eax,%edi
+  802d6b:	48 b8 f0 9b ff ff ff 	movabs $0xffffffffffff9bf0,%rax
+  802d72:	ff ff ff 
+  802d75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d79:	ff d0                	call   *%rax
+		return 0;
+  802d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d80:	e9 ae 00 00 00       	jmp    802e33 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802d85:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d8c:	ff ff ff 
+  802d8f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d93:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d96:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d9a:	83 e0 02             	and    $0x2,%eax
+  802d9d:	48 85 c0             	test   %rax,%rax
+  802da0:	75 1f                	jne    802dc1 <duppage+0xcb>
+  802da2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802da9:	ff ff ff 
+  802dac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802db0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802db3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802db7:	25 00 08 00 00       	and    $0x800,%eax
+  802dbc:	48 85 c0             	test   %rax,%rax
+  802dbf:	74 4c                	je     802e0d <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  802dc1:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  802dc8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802dcb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802dcf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802dd2:	48 89 ce             	mov    %rcx,%rsi
+  802dd5:	89 c7                	mov    %eax,%edi
+  802dd7:	48 b8 f0 9b ff ff ff 	movabs $0xffffffffffff9bf0,%rax
+  802dde:	ff ff ff 
+  802de1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802de5:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  802de7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dee:	48 89 c6             	mov    %rax,%rsi
+  802df1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802df6:	48 b8 f0 9b ff ff ff 	movabs $0xffffffffffff9bf0,%rax
+  802dfd:	ff ff ff 
+  802e00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e04:	ff d0                	call   *%rax
+		return 0;
+  802e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0b:	eb 26                	jmp    802e33 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  802e0d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802e11:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e14:	ba 05 00 00 00       	mov    $0x5,%edx
+  802e19:	48 89 ce             	mov    %rcx,%rsi
+  802e1c:	89 c7                	mov    %eax,%edi
+  802e1e:	48 b8 f0 9b ff ff ff 	movabs $0xffffffffffff9bf0,%rax
+  802e25:	ff ff ff 
+  802e28:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e2c:	ff d0                	call   *%rax
+		return 0;
+  802e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  802e33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e37:	c9                   	leave
+  802e38:	c3                   	ret
+
+0000000000802e39 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  802e39:	55                   	push   %rbp
+  802e3a:	48 89 e5             	mov    %rsp,%rbp
+  802e3d:	53                   	push   %rbx
+  802e3e:	48 83 ec 28          	sub    $0x28,%rsp
+  802e42:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e42 <duphuge+0x9>
+  802e49:	49 bb fe 61 00 00 00 	movabs $0x61fe,%r11
+  802e50:	00 00 00 
+  802e53:	4c 01 db             	add    %r11,%rbx
+  802e56:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e59:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  802e5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e61:	48 c1 e8 15          	shr    $0x15,%rax
+  802e65:	48 89 c2             	mov    %rax,%rdx
+  802e68:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802e6f:	ff ff ff 
+  802e72:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e76:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e7a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  802e7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e82:	25 00 04 00 00       	and    $0x400,%eax
+  802e87:	48 85 c0             	test   %rax,%rax
+  802e8a:	74 0e                	je     802e9a <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  802e8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e90:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e98:	eb 1e                	jmp    802eb8 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  802e9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e9e:	25 02 08 00 00       	and    $0x802,%eax
+  802ea3:	48 85 c0             	test   %rax,%rax
+  802ea6:	74 09                	je     802eb1 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  802ea8:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  802eaf:	eb 07                	jmp    802eb8 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  802eb1:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  802eb8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ebb:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802ebf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ec2:	48 89 ce             	mov    %rcx,%rsi
+  802ec5:	89 c7                	mov    %eax,%edi
+  802ec7:	48 b8 f0 9b ff ff ff 	movabs $0xffffffffffff9bf0,%rax
+  802ece:	ff ff ff 
+  802ed1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ed5:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  802ed7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eda:	25 00 08 00 00       	and    $0x800,%eax
+  802edf:	85 c0                	test   %eax,%eax
+  802ee1:	74 1f                	je     802f02 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  802ee3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ee6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802eea:	48 89 c6             	mov    %rax,%rsi
+  802eed:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef2:	48 b8 f0 9b ff ff ff 	movabs $0xffffffffffff9bf0,%rax
+  802ef9:	ff ff ff 
+  802efc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f00:	ff d0                	call   *%rax
+	return 0;
+  802f02:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f07:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f0b:	c9                   	leave
+  802f0c:	c3                   	ret
+
+0000000000802f0d <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802f0d:	55                   	push   %rbp
+  802f0e:	48 89 e5             	mov    %rsp,%rbp
+  802f11:	41 57                	push   %r15
+  802f13:	53                   	push   %rbx
+  802f14:	48 83 ec 10          	sub    $0x10,%rsp
+  802f18:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f18 <fork+0xb>
+  802f1f:	49 bb 28 61 00 00 00 	movabs $0x6128,%r11
+  802f26:	00 00 00 
+  802f29:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  802f2c:	49 89 df             	mov    %rbx,%r15
+  802f2f:	48 b8 93 96 ff ff ff 	movabs $0xffffffffffff9693,%rax
+  802f36:	ff ff ff 
+  802f39:	48 01 d8             	add    %rbx,%rax
+  802f3c:	ff d0                	call   *%rax
+  802f3e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f41:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f45:	75 42                	jne    802f89 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802f47:	49 89 df             	mov    %rbx,%r15
+  802f4a:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  802f51:	ff ff ff 
+  802f54:	48 01 d8             	add    %rbx,%rax
+  802f57:	ff d0                	call   *%rax
+  802f59:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f5e:	48 98                	cltq
+  802f60:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  802f67:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802f6e:	ff ff ff 
+  802f71:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  802f75:	48 01 c2             	add    %rax,%rdx
+  802f78:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802f7f:	ff ff ff 
+  802f82:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f86:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  802f89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f8c:	48 83 c4 10          	add    $0x10,%rsp
+  802f90:	5b                   	pop    %rbx
+  802f91:	41 5f                	pop    %r15
+  802f93:	5d                   	pop    %rbp
+  802f94:	c3                   	ret
+
+0000000000802f95 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  802f95:	55                   	push   %rbp
+  802f96:	48 89 e5             	mov    %rsp,%rbp
+  802f99:	41 57                	push   %r15
+  802f9b:	53                   	push   %rbx
+  802f9c:	48 83 ec 10          	sub    $0x10,%rsp
+  802fa0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802fa0 <ufork+0xb>
+  802fa7:	49 bb a0 60 00 00 00 	movabs $0x60a0,%r11
+  802fae:	00 00 00 
+  802fb1:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  802fb4:	48 b8 e7 96 ff ff ff 	movabs $0xffffffffffff96e7,%rax
+  802fbb:	ff ff ff 
+  802fbe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fc2:	48 89 c7             	mov    %rax,%rdi
+  802fc5:	49 89 df             	mov    %rbx,%r15
+  802fc8:	48 b8 a1 da ff ff ff 	movabs $0xffffffffffffdaa1,%rax
+  802fcf:	ff ff ff 
+  802fd2:	48 01 d8             	add    %rbx,%rax
+  802fd5:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802fd7:	b8 07 00 00 00       	mov    $0x7,%eax
+  802fdc:	cd 30                	int    $0x30
+  802fde:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  802fe1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  802fe4:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  802fe7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802feb:	0f 84 03 02 00 00    	je     8031f4 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  802ff1:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802ff8:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  802ff9:	e9 28 01 00 00       	jmp    803126 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  802ffe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803002:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803006:	48 89 c2             	mov    %rax,%rdx
+  803009:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803010:	ff ff ff 
+  803013:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803017:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80301b:	83 e0 01             	and    $0x1,%eax
+  80301e:	48 85 c0             	test   %rax,%rax
+  803021:	0f 84 f7 00 00 00    	je     80311e <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803027:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80302b:	48 c1 e8 15          	shr    $0x15,%rax
+  80302f:	48 89 c2             	mov    %rax,%rdx
+  803032:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803039:	ff ff ff 
+  80303c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803040:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803044:	25 81 00 00 00       	and    $0x81,%eax
+  803049:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  80304f:	75 29                	jne    80307a <ufork+0xe5>
+					duphuge(child_envid, addr);
+  803051:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803055:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803058:	48 89 d6             	mov    %rdx,%rsi
+  80305b:	89 c7                	mov    %eax,%edi
+  80305d:	48 b8 f9 9d ff ff ff 	movabs $0xffffffffffff9df9,%rax
+  803064:	ff ff ff 
+  803067:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80306b:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  80306d:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803074:	00 
+  803075:	e9 ac 00 00 00       	jmp    803126 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  80307a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80307e:	48 c1 e8 15          	shr    $0x15,%rax
+  803082:	48 89 c2             	mov    %rax,%rdx
+  803085:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80308c:	ff ff ff 
+  80308f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803093:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803097:	83 e0 01             	and    $0x1,%eax
+  80309a:	48 85 c0             	test   %rax,%rax
+  80309d:	74 75                	je     803114 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  80309f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030a3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030a7:	48 89 c2             	mov    %rax,%rdx
+  8030aa:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030b1:	ff ff ff 
+  8030b4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030b8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030bc:	83 e0 01             	and    $0x1,%eax
+  8030bf:	48 85 c0             	test   %rax,%rax
+  8030c2:	74 46                	je     80310a <ufork+0x175>
+  8030c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030c8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030cc:	48 89 c2             	mov    %rax,%rdx
+  8030cf:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030d6:	ff ff ff 
+  8030d9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030dd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030e1:	83 e0 04             	and    $0x4,%eax
+  8030e4:	48 85 c0             	test   %rax,%rax
+  8030e7:	74 21                	je     80310a <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  8030e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030ed:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030f1:	89 c2                	mov    %eax,%edx
+  8030f3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8030f6:	89 d6                	mov    %edx,%esi
+  8030f8:	89 c7                	mov    %eax,%edi
+  8030fa:	48 b8 b6 9c ff ff ff 	movabs $0xffffffffffff9cb6,%rax
+  803101:	ff ff ff 
+  803104:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803108:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  80310a:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803111:	00 
+  803112:	eb 12                	jmp    803126 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803114:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80311b:	00 
+  80311c:	eb 08                	jmp    803126 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  80311e:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803125:	40 
+		for (; addr < USTACKTOP;){
+  803126:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80312b:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80312f:	0f 83 c9 fe ff ff    	jae    802ffe <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803135:	48 b8 1d 9b ff ff ff 	movabs $0xffffffffffff9b1d,%rax
+  80313c:	ff ff ff 
+  80313f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803143:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803145:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803148:	ba 07 00 00 00       	mov    $0x7,%edx
+  80314d:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  803152:	48 89 ce             	mov    %rcx,%rsi
+  803155:	89 c7                	mov    %eax,%edi
+  803157:	49 89 df             	mov    %rbx,%r15
+  80315a:	48 b8 3e 8f ff ff ff 	movabs $0xffffffffffff8f3e,%rax
+  803161:	ff ff ff 
+  803164:	48 01 d8             	add    %rbx,%rax
+  803167:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803169:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80316c:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803173:	ff ff ff 
+  803176:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80317a:	48 89 d6             	mov    %rdx,%rsi
+  80317d:	89 c7                	mov    %eax,%edi
+  80317f:	49 89 df             	mov    %rbx,%r15
+  803182:	48 b8 34 91 ff ff ff 	movabs $0xffffffffffff9134,%rax
+  803189:	ff ff ff 
+  80318c:	48 01 d8             	add    %rbx,%rax
+  80318f:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803191:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803194:	be 02 00 00 00       	mov    $0x2,%esi
+  803199:	89 c7                	mov    %eax,%edi
+  80319b:	49 89 df             	mov    %rbx,%r15
+  80319e:	48 b8 75 90 ff ff ff 	movabs $0xffffffffffff9075,%rax
+  8031a5:	ff ff ff 
+  8031a8:	48 01 d8             	add    %rbx,%rax
+  8031ab:	ff d0                	call   *%rax
+  8031ad:	85 c0                	test   %eax,%eax
+  8031af:	74 3e                	je     8031ef <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  8031b1:	48 b8 47 e2 ff ff ff 	movabs $0xffffffffffffe247,%rax
+  8031b8:	ff ff ff 
+  8031bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031bf:	48 89 c2             	mov    %rax,%rdx
+  8031c2:	be 07 01 00 00       	mov    $0x107,%esi
+  8031c7:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  8031ce:	ff ff ff 
+  8031d1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031d5:	48 89 c7             	mov    %rax,%rdi
+  8031d8:	49 89 df             	mov    %rbx,%r15
+  8031db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e0:	48 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rcx
+  8031e7:	ff ff ff 
+  8031ea:	48 01 d9             	add    %rbx,%rcx
+  8031ed:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  8031ef:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8031f2:	eb 59                	jmp    80324d <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8031f4:	49 89 df             	mov    %rbx,%r15
+  8031f7:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  8031fe:	ff ff ff 
+  803201:	48 01 d8             	add    %rbx,%rax
+  803204:	ff d0                	call   *%rax
+  803206:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80320b:	48 98                	cltq
+  80320d:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803214:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80321b:	ff ff ff 
+  80321e:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803222:	48 01 c2             	add    %rax,%rdx
+  803225:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80322c:	ff ff ff 
+  80322f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803233:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803236:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80323d:	00 00 00 
+  803240:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803247:	00 
+		return 0;
+  803248:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  80324d:	48 83 c4 10          	add    $0x10,%rsp
+  803251:	5b                   	pop    %rbx
+  803252:	41 5f                	pop    %r15
+  803254:	5d                   	pop    %rbp
+  803255:	c3                   	ret
+
+0000000000803256 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803256:	55                   	push   %rbp
+  803257:	48 89 e5             	mov    %rsp,%rbp
+  80325a:	41 57                	push   %r15
+  80325c:	48 83 ec 08          	sub    $0x8,%rsp
+  803260:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803260 <sfork+0xa>
+  803267:	49 bb e0 5d 00 00 00 	movabs $0x5de0,%r11
+  80326e:	00 00 00 
+  803271:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803274:	48 b8 62 e2 ff ff ff 	movabs $0xffffffffffffe262,%rax
+  80327b:	ff ff ff 
+  80327e:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803282:	48 89 c2             	mov    %rax,%rdx
+  803285:	be 1a 01 00 00       	mov    $0x11a,%esi
+  80328a:	48 b8 98 e1 ff ff ff 	movabs $0xffffffffffffe198,%rax
+  803291:	ff ff ff 
+  803294:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803298:	48 89 c7             	mov    %rax,%rdi
+  80329b:	49 89 cf             	mov    %rcx,%r15
+  80329e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a3:	49 b8 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%r8
+  8032aa:	ff ff ff 
+  8032ad:	49 01 c8             	add    %rcx,%r8
+  8032b0:	41 ff d0             	call   *%r8
+
+00000000008032b3 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8032b3:	55                   	push   %rbp
+  8032b4:	48 89 e5             	mov    %rsp,%rbp
+  8032b7:	41 57                	push   %r15
+  8032b9:	53                   	push   %rbx
+  8032ba:	48 83 ec 30          	sub    $0x30,%rsp
+  8032be:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032be <ipc_recv+0xb>
+  8032c5:	49 bb 82 5d 00 00 00 	movabs $0x5d82,%r11
+  8032cc:	00 00 00 
+  8032cf:	4c 01 db             	add    %r11,%rbx
+  8032d2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8032d6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8032da:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8032de:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8032e3:	75 0e                	jne    8032f3 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8032e5:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8032ec:	00 00 00 
+  8032ef:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8032f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032f7:	48 89 c7             	mov    %rax,%rdi
+  8032fa:	49 89 df             	mov    %rbx,%r15
+  8032fd:	48 b8 67 92 ff ff ff 	movabs $0xffffffffffff9267,%rax
+  803304:	ff ff ff 
+  803307:	48 01 d8             	add    %rbx,%rax
+  80330a:	ff d0                	call   *%rax
+  80330c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  80330f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803314:	74 2a                	je     803340 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  803316:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80331a:	75 19                	jne    803335 <ipc_recv+0x82>
+  80331c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803323:	ff ff ff 
+  803326:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80332a:	48 8b 00             	mov    (%rax),%rax
+  80332d:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803333:	eb 05                	jmp    80333a <ipc_recv+0x87>
+  803335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80333e:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  803340:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803345:	74 2a                	je     803371 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  803347:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80334b:	75 19                	jne    803366 <ipc_recv+0xb3>
+  80334d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803354:	ff ff ff 
+  803357:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80335b:	48 8b 00             	mov    (%rax),%rax
+  80335e:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803364:	eb 05                	jmp    80336b <ipc_recv+0xb8>
+  803366:	b8 00 00 00 00       	mov    $0x0,%eax
+  80336b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80336f:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  803371:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803375:	74 05                	je     80337c <ipc_recv+0xc9>
+		return res;
+  803377:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80337a:	eb 17                	jmp    803393 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  80337c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803383:	ff ff ff 
+  803386:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80338a:	48 8b 00             	mov    (%rax),%rax
+  80338d:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803393:	48 83 c4 30          	add    $0x30,%rsp
+  803397:	5b                   	pop    %rbx
+  803398:	41 5f                	pop    %r15
+  80339a:	5d                   	pop    %rbp
+  80339b:	c3                   	ret
+
+000000000080339c <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80339c:	55                   	push   %rbp
+  80339d:	48 89 e5             	mov    %rsp,%rbp
+  8033a0:	41 57                	push   %r15
+  8033a2:	53                   	push   %rbx
+  8033a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8033a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033a7 <ipc_send+0xb>
+  8033ae:	49 bb 99 5c 00 00 00 	movabs $0x5c99,%r11
+  8033b5:	00 00 00 
+  8033b8:	4c 01 db             	add    %r11,%rbx
+  8033bb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8033be:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8033c1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8033c5:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8033c8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8033cd:	75 0e                	jne    8033dd <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8033cf:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8033d6:	00 00 00 
+  8033d9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8033dd:	90                   	nop
+  8033de:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8033e1:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8033e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033eb:	89 c7                	mov    %eax,%edi
+  8033ed:	49 89 df             	mov    %rbx,%r15
+  8033f0:	48 b8 fd 91 ff ff ff 	movabs $0xffffffffffff91fd,%rax
+  8033f7:	ff ff ff 
+  8033fa:	48 01 d8             	add    %rbx,%rax
+  8033fd:	ff d0                	call   *%rax
+  8033ff:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  803402:	74 da                	je     8033de <ipc_send+0x42>
+		;
+}
+  803404:	90                   	nop
+  803405:	90                   	nop
+  803406:	48 83 c4 20          	add    $0x20,%rsp
+  80340a:	5b                   	pop    %rbx
+  80340b:	41 5f                	pop    %r15
+  80340d:	5d                   	pop    %rbp
+  80340e:	c3                   	ret
+
+000000000080340f <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  80340f:	55                   	push   %rbp
+  803410:	48 89 e5             	mov    %rsp,%rbp
+  803413:	41 57                	push   %r15
+  803415:	53                   	push   %rbx
+  803416:	48 83 ec 40          	sub    $0x40,%rsp
+  80341a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80341a <ipc_call+0xb>
+  803421:	49 bb 26 5c 00 00 00 	movabs $0x5c26,%r11
+  803428:	00 00 00 
+  80342b:	4c 01 db             	add    %r11,%rbx
+  80342e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803431:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803434:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803438:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80343b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80343f:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803443:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803448:	75 0e                	jne    803458 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  80344a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803451:	00 00 00 
+  803454:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803458:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80345d:	75 0e                	jne    80346d <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80345f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803466:	00 00 00 
+  803469:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80346d:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803470:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803474:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803477:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80347b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80347e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803484:	49 89 f8             	mov    %rdi,%r8
+  803487:	89 c7                	mov    %eax,%edi
+  803489:	49 89 df             	mov    %rbx,%r15
+  80348c:	48 b8 c0 92 ff ff ff 	movabs $0xffffffffffff92c0,%rax
+  803493:	ff ff ff 
+  803496:	48 01 d8             	add    %rbx,%rax
+  803499:	ff d0                	call   *%rax
+  80349b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80349e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8034a3:	74 2a                	je     8034cf <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8034a5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034a9:	75 19                	jne    8034c4 <ipc_call+0xb5>
+  8034ab:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8034b2:	ff ff ff 
+  8034b5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034b9:	48 8b 00             	mov    (%rax),%rax
+  8034bc:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8034c2:	eb 05                	jmp    8034c9 <ipc_call+0xba>
+  8034c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8034cd:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8034cf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034d3:	74 05                	je     8034da <ipc_call+0xcb>
+		return r;
+  8034d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034d8:	eb 17                	jmp    8034f1 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8034da:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8034e1:	ff ff ff 
+  8034e4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034e8:	48 8b 00             	mov    (%rax),%rax
+  8034eb:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8034f1:	48 83 c4 40          	add    $0x40,%rsp
+  8034f5:	5b                   	pop    %rbx
+  8034f6:	41 5f                	pop    %r15
+  8034f8:	5d                   	pop    %rbp
+  8034f9:	c3                   	ret
+
+00000000008034fa <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8034fa:	55                   	push   %rbp
+  8034fb:	48 89 e5             	mov    %rsp,%rbp
+  8034fe:	41 57                	push   %r15
+  803500:	53                   	push   %rbx
+  803501:	48 83 ec 70          	sub    $0x70,%rsp
+  803505:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803505 <ipc_callw+0xb>
+  80350c:	49 bb 3b 5b 00 00 00 	movabs $0x5b3b,%r11
+  803513:	00 00 00 
+  803516:	4c 01 db             	add    %r11,%rbx
+  803519:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  80351c:	89 75 98             	mov    %esi,-0x68(%rbp)
+  80351f:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  803523:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  803527:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  80352c:	76 0a                	jbe    803538 <ipc_callw+0x3e>
+		return -E_INVAL;
+  80352e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803533:	e9 b7 00 00 00       	jmp    8035ef <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  803538:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80353c:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  803540:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803544:	48 89 ce             	mov    %rcx,%rsi
+  803547:	48 89 c7             	mov    %rax,%rdi
+  80354a:	49 89 df             	mov    %rbx,%r15
+  80354d:	48 b8 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rax
+  803554:	ff ff ff 
+  803557:	48 01 d8             	add    %rbx,%rax
+  80355a:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  80355c:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803563:	00 
+  803564:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803568:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80356c:	48 01 d0             	add    %rdx,%rax
+  80356f:	48 83 e8 01          	sub    $0x1,%rax
+  803573:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803577:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80357b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803580:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803584:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803588:	48 29 d0             	sub    %rdx,%rax
+  80358b:	48 c1 e8 03          	shr    $0x3,%rax
+  80358f:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  803593:	89 c1                	mov    %eax,%ecx
+  803595:	8b 75 98             	mov    -0x68(%rbp),%esi
+  803598:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  80359c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80359f:	49 89 d1             	mov    %rdx,%r9
+  8035a2:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8035a9:	00 00 00 
+  8035ac:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8035b3:	00 00 00 
+  8035b6:	89 c7                	mov    %eax,%edi
+  8035b8:	49 89 df             	mov    %rbx,%r15
+  8035bb:	48 b8 c0 92 ff ff ff 	movabs $0xffffffffffff92c0,%rax
+  8035c2:	ff ff ff 
+  8035c5:	48 01 d8             	add    %rbx,%rax
+  8035c8:	ff d0                	call   *%rax
+  8035ca:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8035cd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8035d1:	74 05                	je     8035d8 <ipc_callw+0xde>
+		return r;
+  8035d3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035d6:	eb 17                	jmp    8035ef <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8035d8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8035df:	ff ff ff 
+  8035e2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035e6:	48 8b 00             	mov    (%rax),%rax
+  8035e9:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8035ef:	48 83 c4 70          	add    $0x70,%rsp
+  8035f3:	5b                   	pop    %rbx
+  8035f4:	41 5f                	pop    %r15
+  8035f6:	5d                   	pop    %rbp
+  8035f7:	c3                   	ret
+
+00000000008035f8 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8035f8:	55                   	push   %rbp
+  8035f9:	48 89 e5             	mov    %rsp,%rbp
+  8035fc:	41 57                	push   %r15
+  8035fe:	53                   	push   %rbx
+  8035ff:	48 83 ec 40          	sub    $0x40,%rsp
+  803603:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803603 <ipc_callv+0xb>
+  80360a:	49 bb 3d 5a 00 00 00 	movabs $0x5a3d,%r11
+  803611:	00 00 00 
+  803614:	4c 01 db             	add    %r11,%rbx
+  803617:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80361a:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  80361d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803621:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803624:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  803628:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  80362c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803633:	00 00 00 
+  803636:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  80363a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80363e:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  803642:	74 11                	je     803655 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  803644:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803648:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  80364c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80364f:	c1 e0 14             	shl    $0x14,%eax
+  803652:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  803655:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  803659:	74 14                	je     80366f <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  80365b:	8b 45 20             	mov    0x20(%rbp),%eax
+  80365e:	83 e8 01             	sub    $0x1,%eax
+  803661:	48 63 d0             	movslq %eax,%rdx
+  803664:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803668:	48 09 d0             	or     %rdx,%rax
+  80366b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  80366f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803672:	c1 e0 10             	shl    $0x10,%eax
+  803675:	0b 45 10             	or     0x10(%rbp),%eax
+  803678:	89 c1                	mov    %eax,%ecx
+  80367a:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80367d:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  803681:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  803685:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803689:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80368c:	4d 89 c1             	mov    %r8,%r9
+  80368f:	49 89 f8             	mov    %rdi,%r8
+  803692:	89 c7                	mov    %eax,%edi
+  803694:	49 89 df             	mov    %rbx,%r15
+  803697:	48 b8 c0 92 ff ff ff 	movabs $0xffffffffffff92c0,%rax
+  80369e:	ff ff ff 
+  8036a1:	48 01 d8             	add    %rbx,%rax
+  8036a4:	ff d0                	call   *%rax
+  8036a6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8036a9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8036ad:	74 05                	je     8036b4 <ipc_callv+0xbc>
+		return r;
+  8036af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8036b2:	eb 17                	jmp    8036cb <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8036b4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8036bb:	ff ff ff 
+  8036be:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036c2:	48 8b 00             	mov    (%rax),%rax
+  8036c5:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8036cb:	48 83 c4 40          	add    $0x40,%rsp
+  8036cf:	5b                   	pop    %rbx
+  8036d0:	41 5f                	pop    %r15
+  8036d2:	5d                   	pop    %rbp
+  8036d3:	c3                   	ret
+
+00000000008036d4 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8036d4:	55                   	push   %rbp
+  8036d5:	48 89 e5             	mov    %rsp,%rbp
+  8036d8:	41 57                	push   %r15
+  8036da:	53                   	push   %rbx
+  8036db:	48 83 ec 40          	sub    $0x40,%rsp
+  8036df:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036df <ipc_reply_recv+0xb>
+  8036e6:	49 bb 61 59 00 00 00 	movabs $0x5961,%r11
+  8036ed:	00 00 00 
+  8036f0:	4c 01 db             	add    %r11,%rbx
+  8036f3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8036f6:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8036f9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8036fd:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803700:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803704:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803708:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80370d:	75 0e                	jne    80371d <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  80370f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803716:	00 00 00 
+  803719:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80371d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803722:	75 0e                	jne    803732 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803724:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80372b:	00 00 00 
+  80372e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803732:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803735:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  803739:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80373d:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803740:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803744:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803747:	4d 89 c1             	mov    %r8,%r9
+  80374a:	49 89 f8             	mov    %rdi,%r8
+  80374d:	89 c7                	mov    %eax,%edi
+  80374f:	49 89 df             	mov    %rbx,%r15
+  803752:	48 b8 34 93 ff ff ff 	movabs $0xffffffffffff9334,%rax
+  803759:	ff ff ff 
+  80375c:	48 01 d8             	add    %rbx,%rax
+  80375f:	ff d0                	call   *%rax
+  803761:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  803764:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803769:	74 2a                	je     803795 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80376b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80376f:	75 19                	jne    80378a <ipc_reply_recv+0xb6>
+  803771:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803778:	ff ff ff 
+  80377b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80377f:	48 8b 00             	mov    (%rax),%rax
+  803782:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803788:	eb 05                	jmp    80378f <ipc_reply_recv+0xbb>
+  80378a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80378f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803793:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  803795:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  80379a:	74 2a                	je     8037c6 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80379c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037a0:	75 19                	jne    8037bb <ipc_reply_recv+0xe7>
+  8037a2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8037a9:	ff ff ff 
+  8037ac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037b0:	48 8b 00             	mov    (%rax),%rax
+  8037b3:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8037b9:	eb 05                	jmp    8037c0 <ipc_reply_recv+0xec>
+  8037bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c0:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  8037c4:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8037c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037ca:	74 05                	je     8037d1 <ipc_reply_recv+0xfd>
+		return r;
+  8037cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037cf:	eb 17                	jmp    8037e8 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8037d1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8037d8:	ff ff ff 
+  8037db:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037df:	48 8b 00             	mov    (%rax),%rax
+  8037e2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8037e8:	48 83 c4 40          	add    $0x40,%rsp
+  8037ec:	5b                   	pop    %rbx
+  8037ed:	41 5f                	pop    %r15
+  8037ef:	5d                   	pop    %rbp
+  8037f0:	c3                   	ret
+
+00000000008037f1 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  8037f1:	55                   	push   %rbp
+  8037f2:	48 89 e5             	mov    %rsp,%rbp
+  8037f5:	41 57                	push   %r15
+  8037f7:	53                   	push   %rbx
+  8037f8:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  8037ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037ff <ipc_window_batch+0xe>
+  803806:	49 bb 41 58 00 00 00 	movabs $0x5841,%r11
+  80380d:	00 00 00 
+  803810:	4c 01 db             	add    %r11,%rbx
+  803813:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  803819:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  803820:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803826:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  80382c:	e9 15 01 00 00       	jmp    803946 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803831:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803837:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80383a:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803841:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803844:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803847:	39 c2                	cmp    %eax,%edx
+  803849:	0f 4e c2             	cmovle %edx,%eax
+  80384c:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  80384f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803856:	eb 6b                	jmp    8038c3 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803858:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80385b:	48 98                	cltq
+  80385d:	48 c1 e0 05          	shl    $0x5,%rax
+  803861:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803865:	48 01 e8             	add    %rbp,%rax
+  803868:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  80386e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803874:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803877:	c1 e0 0c             	shl    $0xc,%eax
+  80387a:	48 63 d0             	movslq %eax,%rdx
+  80387d:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803884:	48 01 c2             	add    %rax,%rdx
+  803887:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80388a:	48 98                	cltq
+  80388c:	48 c1 e0 05          	shl    $0x5,%rax
+  803890:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803894:	48 01 e8             	add    %rbp,%rax
+  803897:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  80389d:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  8038a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038a3:	48 98                	cltq
+  8038a5:	48 c1 e0 05          	shl    $0x5,%rax
+  8038a9:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8038ad:	48 01 e8             	add    %rbp,%rax
+  8038b0:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  8038b7:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  8038bd:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  8038bf:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8038c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038c6:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  8038c9:	7c 8d                	jl     803858 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  8038cb:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8038d2:	74 27                	je     8038fb <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8038d4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8038d7:	48 63 d0             	movslq %eax,%rdx
+  8038da:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8038e1:	48 89 d6             	mov    %rdx,%rsi
+  8038e4:	48 89 c7             	mov    %rax,%rdi
+  8038e7:	49 89 df             	mov    %rbx,%r15
+  8038ea:	48 b8 d7 95 ff ff ff 	movabs $0xffffffffffff95d7,%rax
+  8038f1:	ff ff ff 
+  8038f4:	48 01 d8             	add    %rbx,%rax
+  8038f7:	ff d0                	call   *%rax
+  8038f9:	eb 25                	jmp    803920 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  8038fb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8038fe:	48 63 d0             	movslq %eax,%rdx
+  803901:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803908:	48 89 d6             	mov    %rdx,%rsi
+  80390b:	48 89 c7             	mov    %rax,%rdi
+  80390e:	49 89 df             	mov    %rbx,%r15
+  803911:	48 b8 35 96 ff ff ff 	movabs $0xffffffffffff9635,%rax
+  803918:	ff ff ff 
+  80391b:	48 01 d8             	add    %rbx,%rax
+  80391e:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803920:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803923:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803927:	79 05                	jns    80392e <ipc_window_batch+0x13d>
+			return r;
+  803929:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80392c:	eb 2a                	jmp    803958 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  80392e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803931:	c1 e0 0c             	shl    $0xc,%eax
+  803934:	48 98                	cltq
+  803936:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  80393d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803940:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803946:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  80394d:	0f 8f de fe ff ff    	jg     803831 <ipc_window_batch+0x40>
+	}
+	return 0;
+  803953:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803958:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  80395f:	5b                   	pop    %rbx
+  803960:	41 5f                	pop    %r15
+  803962:	5d                   	pop    %rbp
+  803963:	c3                   	ret
+
+0000000000803964 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803964:	55                   	push   %rbp
+  803965:	48 89 e5             	mov    %rsp,%rbp
+  803968:	48 83 ec 10          	sub    $0x10,%rsp
+  80396c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80396c <ipc_map_window+0x8>
+  803973:	49 bb d4 56 00 00 00 	movabs $0x56d4,%r11
+  80397a:	00 00 00 
+  80397d:	4c 01 d8             	add    %r11,%rax
+  803980:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803984:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803987:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80398a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80398e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803993:	bf 01 00 00 00       	mov    $0x1,%edi
+  803998:	49 b8 b1 a7 ff ff ff 	movabs $0xffffffffffffa7b1,%r8
+  80399f:	ff ff ff 
+  8039a2:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8039a6:	ff d0                	call   *%rax
+}
+  8039a8:	c9                   	leave
+  8039a9:	c3                   	ret
+
+00000000008039aa <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  8039aa:	55                   	push   %rbp
+  8039ab:	48 89 e5             	mov    %rsp,%rbp
+  8039ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8039b2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8039b2 <ipc_unmap_window+0x8>
+  8039b9:	49 bb 8e 56 00 00 00 	movabs $0x568e,%r11
+  8039c0:	00 00 00 
+  8039c3:	4c 01 d8             	add    %r11,%rax
+  8039c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8039ca:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8039cd:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8039d0:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8039d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8039d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039de:	49 b8 b1 a7 ff ff ff 	movabs $0xffffffffffffa7b1,%r8
+  8039e5:	ff ff ff 
+  8039e8:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8039ec:	ff d0                	call   *%rax
+}
+  8039ee:	c9                   	leave
+  8039ef:	c3                   	ret
+
+00000000008039f0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8039f0:	55                   	push   %rbp
+  8039f1:	48 89 e5             	mov    %rsp,%rbp
+  8039f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8039f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8039f8 <ipc_find_env+0x8>
+  8039ff:	49 bb 48 56 00 00 00 	movabs $0x5648,%r11
+  803a06:	00 00 00 
+  803a09:	4c 01 d8             	add    %r11,%rax
+  803a0c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803a0f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803a16:	eb 57                	jmp    803a6f <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803a18:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803a1f:	ff ff ff 
+  803a22:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803a26:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803a29:	48 63 d2             	movslq %edx,%rdx
+  803a2c:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803a33:	48 01 ca             	add    %rcx,%rdx
+  803a36:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803a3d:	8b 12                	mov    (%rdx),%edx
+  803a3f:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803a42:	75 27                	jne    803a6b <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803a44:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803a4b:	ff ff ff 
+  803a4e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803a52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a55:	48 98                	cltq
+  803a57:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803a5e:	48 01 d0             	add    %rdx,%rax
+  803a61:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803a67:	8b 00                	mov    (%rax),%eax
+  803a69:	eb 12                	jmp    803a7d <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803a6b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803a6f:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803a76:	7e a0                	jle    803a18 <ipc_find_env+0x28>
+	}
+	return 0;
+  803a78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a7d:	c9                   	leave
+  803a7e:	c3                   	ret
+
+0000000000803a7f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803a7f:	55                   	push   %rbp
+  803a80:	48 89 e5             	mov    %rsp,%rbp
+  803a83:	48 83 ec 08          	sub    $0x8,%rsp
+  803a87:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a87 <fd2num+0x8>
+  803a8e:	49 bb b9 55 00 00 00 	movabs $0x55b9,%r11
+  803a95:	00 00 00 
+  803a98:	4c 01 d8             	add    %r11,%rax
+  803a9b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803a9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803aa3:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803aaa:	ff ff ff 
+  803aad:	48 01 d0             	add    %rdx,%rax
+  803ab0:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803ab4:	c9                   	leave
+  803ab5:	c3                   	ret
+
+0000000000803ab6 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803ab6:	55                   	push   %rbp
+  803ab7:	48 89 e5             	mov    %rsp,%rbp
+  803aba:	48 83 ec 08          	sub    $0x8,%rsp
+  803abe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803abe <fd2data+0x8>
+  803ac5:	49 bb 82 55 00 00 00 	movabs $0x5582,%r11
+  803acc:	00 00 00 
+  803acf:	4c 01 d8             	add    %r11,%rax
+  803ad2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803ad6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ada:	48 89 d7             	mov    %rdx,%rdi
+  803add:	48 ba 3f aa ff ff ff 	movabs $0xffffffffffffaa3f,%rdx
+  803ae4:	ff ff ff 
+  803ae7:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803aeb:	ff d0                	call   *%rax
+  803aed:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803af3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803af7:	c9                   	leave
+  803af8:	c3                   	ret
+
+0000000000803af9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803af9:	55                   	push   %rbp
+  803afa:	48 89 e5             	mov    %rsp,%rbp
+  803afd:	48 83 ec 18          	sub    $0x18,%rsp
+  803b01:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b01 <fd_alloc+0x8>
+  803b08:	49 bb 3f 55 00 00 00 	movabs $0x553f,%r11
+  803b0f:	00 00 00 
+  803b12:	4c 01 d8             	add    %r11,%rax
+  803b15:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803b19:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803b20:	eb 75                	jmp    803b97 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803b22:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803b25:	48 63 d2             	movslq %edx,%rdx
+  803b28:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803b2f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803b33:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803b37:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b3b:	48 89 d1             	mov    %rdx,%rcx
+  803b3e:	48 c1 e9 15          	shr    $0x15,%rcx
+  803b42:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803b49:	ff ff ff 
+  803b4c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803b50:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803b54:	83 e2 01             	and    $0x1,%edx
+  803b57:	48 85 d2             	test   %rdx,%rdx
+  803b5a:	74 25                	je     803b81 <fd_alloc+0x88>
+  803b5c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b60:	48 89 d1             	mov    %rdx,%rcx
+  803b63:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803b67:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803b6e:	ff ff ff 
+  803b71:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803b75:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803b79:	83 e2 01             	and    $0x1,%edx
+  803b7c:	48 85 d2             	test   %rdx,%rdx
+  803b7f:	75 12                	jne    803b93 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803b81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b85:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803b89:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b91:	eb 1a                	jmp    803bad <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803b93:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803b97:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803b9b:	7e 85                	jle    803b22 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803b9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ba1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803ba8:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803bad:	c9                   	leave
+  803bae:	c3                   	ret
+
+0000000000803baf <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803baf:	55                   	push   %rbp
+  803bb0:	48 89 e5             	mov    %rsp,%rbp
+  803bb3:	48 83 ec 20          	sub    $0x20,%rsp
+  803bb7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803bb7 <fd_lookup+0x8>
+  803bbe:	49 bb 89 54 00 00 00 	movabs $0x5489,%r11
+  803bc5:	00 00 00 
+  803bc8:	4c 01 d8             	add    %r11,%rax
+  803bcb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803bce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803bd2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bd6:	78 06                	js     803bde <fd_lookup+0x2f>
+  803bd8:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803bdc:	7e 07                	jle    803be5 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803bde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803be3:	eb 73                	jmp    803c58 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803be5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803be8:	48 63 d2             	movslq %edx,%rdx
+  803beb:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803bf2:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803bf6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803bfa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803bfe:	48 89 d1             	mov    %rdx,%rcx
+  803c01:	48 c1 e9 15          	shr    $0x15,%rcx
+  803c05:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803c0c:	ff ff ff 
+  803c0f:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803c13:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803c17:	83 e2 01             	and    $0x1,%edx
+  803c1a:	48 85 d2             	test   %rdx,%rdx
+  803c1d:	74 22                	je     803c41 <fd_lookup+0x92>
+  803c1f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803c23:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803c27:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803c2e:	ff ff ff 
+  803c31:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803c35:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c39:	83 e0 01             	and    $0x1,%eax
+  803c3c:	48 85 c0             	test   %rax,%rax
+  803c3f:	75 07                	jne    803c48 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803c41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c46:	eb 10                	jmp    803c58 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803c48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c4c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803c50:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803c53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c58:	c9                   	leave
+  803c59:	c3                   	ret
+
+0000000000803c5a <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803c5a:	55                   	push   %rbp
+  803c5b:	48 89 e5             	mov    %rsp,%rbp
+  803c5e:	41 57                	push   %r15
+  803c60:	53                   	push   %rbx
+  803c61:	48 83 ec 30          	sub    $0x30,%rsp
+  803c65:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c65 <fd_close+0xb>
+  803c6c:	49 bb db 53 00 00 00 	movabs $0x53db,%r11
+  803c73:	00 00 00 
+  803c76:	4c 01 db             	add    %r11,%rbx
+  803c79:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c7d:	89 f0                	mov    %esi,%eax
+  803c7f:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803c82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c86:	48 89 c7             	mov    %rax,%rdi
+  803c89:	48 b8 3f aa ff ff ff 	movabs $0xffffffffffffaa3f,%rax
+  803c90:	ff ff ff 
+  803c93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c97:	ff d0                	call   *%rax
+  803c99:	89 c2                	mov    %eax,%edx
+  803c9b:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803c9f:	48 89 c6             	mov    %rax,%rsi
+  803ca2:	89 d7                	mov    %edx,%edi
+  803ca4:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  803cab:	ff ff ff 
+  803cae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cb2:	ff d0                	call   *%rax
+  803cb4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cb7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cbb:	78 0a                	js     803cc7 <fd_close+0x6d>
+	    || fd != fd2)
+  803cbd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cc1:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803cc5:	74 12                	je     803cd9 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803cc7:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803ccb:	74 05                	je     803cd2 <fd_close+0x78>
+  803ccd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cd0:	eb 7a                	jmp    803d4c <fd_close+0xf2>
+  803cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cd7:	eb 73                	jmp    803d4c <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803cd9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cdd:	8b 00                	mov    (%rax),%eax
+  803cdf:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803ce3:	48 89 d6             	mov    %rdx,%rsi
+  803ce6:	89 c7                	mov    %eax,%edi
+  803ce8:	48 b8 15 ad ff ff ff 	movabs $0xffffffffffffad15,%rax
+  803cef:	ff ff ff 
+  803cf2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cf6:	ff d0                	call   *%rax
+  803cf8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cfb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cff:	78 2a                	js     803d2b <fd_close+0xd1>
+		if (dev->dev_close)
+  803d01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d05:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803d09:	48 85 c0             	test   %rax,%rax
+  803d0c:	74 16                	je     803d24 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803d0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d12:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803d16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d1a:	48 89 c7             	mov    %rax,%rdi
+  803d1d:	ff d2                	call   *%rdx
+  803d1f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d22:	eb 07                	jmp    803d2b <fd_close+0xd1>
+		else
+			r = 0;
+  803d24:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  803d2b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d2f:	48 89 c6             	mov    %rax,%rsi
+  803d32:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d37:	49 89 df             	mov    %rbx,%r15
+  803d3a:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  803d41:	ff ff ff 
+  803d44:	48 01 d8             	add    %rbx,%rax
+  803d47:	ff d0                	call   *%rax
+	return r;
+  803d49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803d4c:	48 83 c4 30          	add    $0x30,%rsp
+  803d50:	5b                   	pop    %rbx
+  803d51:	41 5f                	pop    %r15
+  803d53:	5d                   	pop    %rbp
+  803d54:	c3                   	ret
+
+0000000000803d55 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803d55:	55                   	push   %rbp
+  803d56:	48 89 e5             	mov    %rsp,%rbp
+  803d59:	41 57                	push   %r15
+  803d5b:	48 83 ec 28          	sub    $0x28,%rsp
+  803d5f:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803d5f <dev_lookup+0xa>
+  803d66:	49 bb e1 52 00 00 00 	movabs $0x52e1,%r11
+  803d6d:	00 00 00 
+  803d70:	4c 01 d9             	add    %r11,%rcx
+  803d73:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d76:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803d7a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803d81:	eb 45                	jmp    803dc8 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803d83:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803d8a:	00 00 00 
+  803d8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d90:	48 98                	cltq
+  803d92:	48 01 ca             	add    %rcx,%rdx
+  803d95:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803d99:	8b 00                	mov    (%rax),%eax
+  803d9b:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803d9e:	75 24                	jne    803dc4 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803da0:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803da7:	00 00 00 
+  803daa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dad:	48 98                	cltq
+  803daf:	48 01 ca             	add    %rcx,%rdx
+  803db2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803db6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803dba:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc2:	eb 74                	jmp    803e38 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803dc4:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803dc8:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803dcf:	00 00 00 
+  803dd2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dd5:	48 98                	cltq
+  803dd7:	48 01 ca             	add    %rcx,%rdx
+  803dda:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dde:	48 85 c0             	test   %rax,%rax
+  803de1:	75 a0                	jne    803d83 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803de3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803dea:	ff ff ff 
+  803ded:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803df1:	48 8b 00             	mov    (%rax),%rax
+  803df4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803dfa:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803dfd:	89 c6                	mov    %eax,%esi
+  803dff:	48 b8 78 e2 ff ff ff 	movabs $0xffffffffffffe278,%rax
+  803e06:	ff ff ff 
+  803e09:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803e0d:	48 89 c7             	mov    %rax,%rdi
+  803e10:	49 89 cf             	mov    %rcx,%r15
+  803e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e18:	49 b8 c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%r8
+  803e1f:	ff ff ff 
+  803e22:	49 01 c8             	add    %rcx,%r8
+  803e25:	41 ff d0             	call   *%r8
+	*dev = 0;
+  803e28:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e2c:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  803e33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803e38:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803e3c:	c9                   	leave
+  803e3d:	c3                   	ret
+
+0000000000803e3e <close>:
+
+int
+close(int fdnum)
+{
+  803e3e:	55                   	push   %rbp
+  803e3f:	48 89 e5             	mov    %rsp,%rbp
+  803e42:	53                   	push   %rbx
+  803e43:	48 83 ec 28          	sub    $0x28,%rsp
+  803e47:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e47 <close+0x9>
+  803e4e:	49 bb f9 51 00 00 00 	movabs $0x51f9,%r11
+  803e55:	00 00 00 
+  803e58:	4c 01 db             	add    %r11,%rbx
+  803e5b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e5e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803e62:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e65:	48 89 d6             	mov    %rdx,%rsi
+  803e68:	89 c7                	mov    %eax,%edi
+  803e6a:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  803e71:	ff ff ff 
+  803e74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e78:	ff d0                	call   *%rax
+  803e7a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e7d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e81:	79 05                	jns    803e88 <close+0x4a>
+		return r;
+  803e83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e86:	eb 1c                	jmp    803ea4 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803e88:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e8c:	be 01 00 00 00       	mov    $0x1,%esi
+  803e91:	48 89 c7             	mov    %rax,%rdi
+  803e94:	48 b8 1a ac ff ff ff 	movabs $0xffffffffffffac1a,%rax
+  803e9b:	ff ff ff 
+  803e9e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ea2:	ff d0                	call   *%rax
+}
+  803ea4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ea8:	c9                   	leave
+  803ea9:	c3                   	ret
+
+0000000000803eaa <close_all>:
+
+void
+close_all(void)
+{
+  803eaa:	55                   	push   %rbp
+  803eab:	48 89 e5             	mov    %rsp,%rbp
+  803eae:	53                   	push   %rbx
+  803eaf:	48 83 ec 18          	sub    $0x18,%rsp
+  803eb3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803eb3 <close_all+0x9>
+  803eba:	49 bb 8d 51 00 00 00 	movabs $0x518d,%r11
+  803ec1:	00 00 00 
+  803ec4:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803ec7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803ece:	eb 19                	jmp    803ee9 <close_all+0x3f>
+		close(i);
+  803ed0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ed3:	89 c7                	mov    %eax,%edi
+  803ed5:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  803edc:	ff ff ff 
+  803edf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ee3:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803ee5:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803ee9:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803eed:	7e e1                	jle    803ed0 <close_all+0x26>
+}
+  803eef:	90                   	nop
+  803ef0:	90                   	nop
+  803ef1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ef5:	c9                   	leave
+  803ef6:	c3                   	ret
+
+0000000000803ef7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803ef7:	55                   	push   %rbp
+  803ef8:	48 89 e5             	mov    %rsp,%rbp
+  803efb:	41 57                	push   %r15
+  803efd:	53                   	push   %rbx
+  803efe:	48 83 ec 40          	sub    $0x40,%rsp
+  803f02:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f02 <dup+0xb>
+  803f09:	49 bb 3e 51 00 00 00 	movabs $0x513e,%r11
+  803f10:	00 00 00 
+  803f13:	4c 01 db             	add    %r11,%rbx
+  803f16:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803f19:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803f1c:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803f20:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803f23:	48 89 d6             	mov    %rdx,%rsi
+  803f26:	89 c7                	mov    %eax,%edi
+  803f28:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  803f2f:	ff ff ff 
+  803f32:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f36:	ff d0                	call   *%rax
+  803f38:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f3b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f3f:	79 08                	jns    803f49 <dup+0x52>
+		return r;
+  803f41:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f44:	e9 a4 01 00 00       	jmp    8040ed <dup+0x1f6>
+	close(newfdnum);
+  803f49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f4c:	89 c7                	mov    %eax,%edi
+  803f4e:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  803f55:	ff ff ff 
+  803f58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f5c:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803f5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f61:	48 98                	cltq
+  803f63:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803f69:	48 c1 e0 0c          	shl    $0xc,%rax
+  803f6d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803f71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f75:	48 89 c7             	mov    %rax,%rdi
+  803f78:	48 b8 76 aa ff ff ff 	movabs $0xffffffffffffaa76,%rax
+  803f7f:	ff ff ff 
+  803f82:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f86:	ff d0                	call   *%rax
+  803f88:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803f8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f90:	48 89 c7             	mov    %rax,%rdi
+  803f93:	48 b8 76 aa ff ff ff 	movabs $0xffffffffffffaa76,%rax
+  803f9a:	ff ff ff 
+  803f9d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fa1:	ff d0                	call   *%rax
+  803fa3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803fa7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fab:	48 c1 e8 15          	shr    $0x15,%rax
+  803faf:	48 89 c2             	mov    %rax,%rdx
+  803fb2:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803fb9:	ff ff ff 
+  803fbc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803fc0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803fc4:	83 e0 01             	and    $0x1,%eax
+  803fc7:	48 85 c0             	test   %rax,%rax
+  803fca:	74 7f                	je     80404b <dup+0x154>
+  803fcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fd0:	48 c1 e8 0c          	shr    $0xc,%rax
+  803fd4:	48 89 c2             	mov    %rax,%rdx
+  803fd7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803fde:	ff ff ff 
+  803fe1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803fe5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803fe9:	83 e0 01             	and    $0x1,%eax
+  803fec:	48 85 c0             	test   %rax,%rax
+  803fef:	74 5a                	je     80404b <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803ff1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ff5:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ff9:	48 89 c2             	mov    %rax,%rdx
+  803ffc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804003:	ff ff ff 
+  804006:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80400a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80400e:	25 07 0e 00 00       	and    $0xe07,%eax
+  804013:	89 c1                	mov    %eax,%ecx
+  804015:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804019:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80401d:	41 89 c8             	mov    %ecx,%r8d
+  804020:	48 89 d1             	mov    %rdx,%rcx
+  804023:	ba 00 00 00 00       	mov    $0x0,%edx
+  804028:	48 89 c6             	mov    %rax,%rsi
+  80402b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804030:	49 89 df             	mov    %rbx,%r15
+  804033:	48 b8 a3 8f ff ff ff 	movabs $0xffffffffffff8fa3,%rax
+  80403a:	ff ff ff 
+  80403d:	48 01 d8             	add    %rbx,%rax
+  804040:	ff d0                	call   *%rax
+  804042:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804045:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804049:	78 5f                	js     8040aa <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80404b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80404f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804053:	48 89 c2             	mov    %rax,%rdx
+  804056:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80405d:	ff ff ff 
+  804060:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804064:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804068:	25 07 0e 00 00       	and    $0xe07,%eax
+  80406d:	89 c1                	mov    %eax,%ecx
+  80406f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804073:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804077:	41 89 c8             	mov    %ecx,%r8d
+  80407a:	48 89 d1             	mov    %rdx,%rcx
+  80407d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804082:	48 89 c6             	mov    %rax,%rsi
+  804085:	bf 00 00 00 00       	mov    $0x0,%edi
+  80408a:	49 89 df             	mov    %rbx,%r15
+  80408d:	48 b8 a3 8f ff ff ff 	movabs $0xffffffffffff8fa3,%rax
+  804094:	ff ff ff 
+  804097:	48 01 d8             	add    %rbx,%rax
+  80409a:	ff d0                	call   *%rax
+  80409c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80409f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040a3:	78 08                	js     8040ad <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  8040a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8040a8:	eb 43                	jmp    8040ed <dup+0x1f6>
+			goto err;
+  8040aa:	90                   	nop
+  8040ab:	eb 01                	jmp    8040ae <dup+0x1b7>
+		goto err;
+  8040ad:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  8040ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040b2:	48 89 c6             	mov    %rax,%rsi
+  8040b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ba:	49 89 df             	mov    %rbx,%r15
+  8040bd:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  8040c4:	ff ff ff 
+  8040c7:	48 01 d8             	add    %rbx,%rax
+  8040ca:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8040cc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040d0:	48 89 c6             	mov    %rax,%rsi
+  8040d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d8:	49 89 df             	mov    %rbx,%r15
+  8040db:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  8040e2:	ff ff ff 
+  8040e5:	48 01 d8             	add    %rbx,%rax
+  8040e8:	ff d0                	call   *%rax
+	return r;
+  8040ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8040ed:	48 83 c4 40          	add    $0x40,%rsp
+  8040f1:	5b                   	pop    %rbx
+  8040f2:	41 5f                	pop    %r15
+  8040f4:	5d                   	pop    %rbp
+  8040f5:	c3                   	ret
+
+00000000008040f6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8040f6:	55                   	push   %rbp
+  8040f7:	48 89 e5             	mov    %rsp,%rbp
+  8040fa:	41 57                	push   %r15
+  8040fc:	53                   	push   %rbx
+  8040fd:	48 83 ec 40          	sub    $0x40,%rsp
+  804101:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804101 <read+0xb>
+  804108:	49 bb 3f 4f 00 00 00 	movabs $0x4f3f,%r11
+  80410f:	00 00 00 
+  804112:	4c 01 db             	add    %r11,%rbx
+  804115:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804118:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80411c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804120:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804124:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804127:	48 89 d6             	mov    %rdx,%rsi
+  80412a:	89 c7                	mov    %eax,%edi
+  80412c:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  804133:	ff ff ff 
+  804136:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80413a:	ff d0                	call   *%rax
+  80413c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80413f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804143:	78 28                	js     80416d <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804145:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804149:	8b 00                	mov    (%rax),%eax
+  80414b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80414f:	48 89 d6             	mov    %rdx,%rsi
+  804152:	89 c7                	mov    %eax,%edi
+  804154:	48 b8 15 ad ff ff ff 	movabs $0xffffffffffffad15,%rax
+  80415b:	ff ff ff 
+  80415e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804162:	ff d0                	call   *%rax
+  804164:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804167:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80416b:	79 08                	jns    804175 <read+0x7f>
+		return r;
+  80416d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804170:	e9 8b 00 00 00       	jmp    804200 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804175:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804179:	8b 40 08             	mov    0x8(%rax),%eax
+  80417c:	83 e0 03             	and    $0x3,%eax
+  80417f:	83 f8 01             	cmp    $0x1,%eax
+  804182:	75 4b                	jne    8041cf <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804184:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80418b:	ff ff ff 
+  80418e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804192:	48 8b 00             	mov    (%rax),%rax
+  804195:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80419b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80419e:	89 c6                	mov    %eax,%esi
+  8041a0:	48 b8 97 e2 ff ff ff 	movabs $0xffffffffffffe297,%rax
+  8041a7:	ff ff ff 
+  8041aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041ae:	48 89 c7             	mov    %rax,%rdi
+  8041b1:	49 89 df             	mov    %rbx,%r15
+  8041b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b9:	48 b9 c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rcx
+  8041c0:	ff ff ff 
+  8041c3:	48 01 d9             	add    %rbx,%rcx
+  8041c6:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8041c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8041cd:	eb 31                	jmp    804200 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8041cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041d3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8041d7:	48 85 c0             	test   %rax,%rax
+  8041da:	75 07                	jne    8041e3 <read+0xed>
+		return -E_NOT_SUPP;
+  8041dc:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8041e1:	eb 1d                	jmp    804200 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8041e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041e7:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8041eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041ef:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8041f3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041f7:	48 89 ce             	mov    %rcx,%rsi
+  8041fa:	48 89 c7             	mov    %rax,%rdi
+  8041fd:	41 ff d0             	call   *%r8
+}
+  804200:	48 83 c4 40          	add    $0x40,%rsp
+  804204:	5b                   	pop    %rbx
+  804205:	41 5f                	pop    %r15
+  804207:	5d                   	pop    %rbp
+  804208:	c3                   	ret
+
+0000000000804209 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  804209:	55                   	push   %rbp
+  80420a:	48 89 e5             	mov    %rsp,%rbp
+  80420d:	53                   	push   %rbx
+  80420e:	48 83 ec 38          	sub    $0x38,%rsp
+  804212:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804212 <readn+0x9>
+  804219:	49 bb 2e 4e 00 00 00 	movabs $0x4e2e,%r11
+  804220:	00 00 00 
+  804223:	4c 01 db             	add    %r11,%rbx
+  804226:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804229:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80422d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  804231:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804238:	eb 4b                	jmp    804285 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80423a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80423d:	48 98                	cltq
+  80423f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804243:	48 29 c2             	sub    %rax,%rdx
+  804246:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804249:	48 63 c8             	movslq %eax,%rcx
+  80424c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804250:	48 01 c1             	add    %rax,%rcx
+  804253:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804256:	48 89 ce             	mov    %rcx,%rsi
+  804259:	89 c7                	mov    %eax,%edi
+  80425b:	48 b8 b6 b0 ff ff ff 	movabs $0xffffffffffffb0b6,%rax
+  804262:	ff ff ff 
+  804265:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804269:	ff d0                	call   *%rax
+  80426b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80426e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804272:	79 05                	jns    804279 <readn+0x70>
+			return m;
+  804274:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804277:	eb 1d                	jmp    804296 <readn+0x8d>
+		if (m == 0)
+  804279:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80427d:	74 13                	je     804292 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80427f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804282:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804285:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804288:	48 98                	cltq
+  80428a:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80428e:	72 aa                	jb     80423a <readn+0x31>
+  804290:	eb 01                	jmp    804293 <readn+0x8a>
+			break;
+  804292:	90                   	nop
+	}
+	return tot;
+  804293:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804296:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80429a:	c9                   	leave
+  80429b:	c3                   	ret
+
+000000000080429c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80429c:	55                   	push   %rbp
+  80429d:	48 89 e5             	mov    %rsp,%rbp
+  8042a0:	41 57                	push   %r15
+  8042a2:	53                   	push   %rbx
+  8042a3:	48 83 ec 40          	sub    $0x40,%rsp
+  8042a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042a7 <write+0xb>
+  8042ae:	49 bb 99 4d 00 00 00 	movabs $0x4d99,%r11
+  8042b5:	00 00 00 
+  8042b8:	4c 01 db             	add    %r11,%rbx
+  8042bb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8042be:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8042c2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8042c6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8042ca:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8042cd:	48 89 d6             	mov    %rdx,%rsi
+  8042d0:	89 c7                	mov    %eax,%edi
+  8042d2:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  8042d9:	ff ff ff 
+  8042dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042e0:	ff d0                	call   *%rax
+  8042e2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042e9:	78 28                	js     804313 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8042eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042ef:	8b 00                	mov    (%rax),%eax
+  8042f1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8042f5:	48 89 d6             	mov    %rdx,%rsi
+  8042f8:	89 c7                	mov    %eax,%edi
+  8042fa:	48 b8 15 ad ff ff ff 	movabs $0xffffffffffffad15,%rax
+  804301:	ff ff ff 
+  804304:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804308:	ff d0                	call   *%rax
+  80430a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80430d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804311:	79 08                	jns    80431b <write+0x7f>
+		return r;
+  804313:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804316:	e9 8a 00 00 00       	jmp    8043a5 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80431b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80431f:	8b 40 08             	mov    0x8(%rax),%eax
+  804322:	83 e0 03             	and    $0x3,%eax
+  804325:	85 c0                	test   %eax,%eax
+  804327:	75 4b                	jne    804374 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  804329:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804330:	ff ff ff 
+  804333:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804337:	48 8b 00             	mov    (%rax),%rax
+  80433a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804340:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804343:	89 c6                	mov    %eax,%esi
+  804345:	48 b8 b3 e2 ff ff ff 	movabs $0xffffffffffffe2b3,%rax
+  80434c:	ff ff ff 
+  80434f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804353:	48 89 c7             	mov    %rax,%rdi
+  804356:	49 89 df             	mov    %rbx,%r15
+  804359:	b8 00 00 00 00       	mov    $0x0,%eax
+  80435e:	48 b9 c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rcx
+  804365:	ff ff ff 
+  804368:	48 01 d9             	add    %rbx,%rcx
+  80436b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80436d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804372:	eb 31                	jmp    8043a5 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  804374:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804378:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80437c:	48 85 c0             	test   %rax,%rax
+  80437f:	75 07                	jne    804388 <write+0xec>
+		return -E_NOT_SUPP;
+  804381:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804386:	eb 1d                	jmp    8043a5 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  804388:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80438c:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  804390:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804394:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804398:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80439c:	48 89 ce             	mov    %rcx,%rsi
+  80439f:	48 89 c7             	mov    %rax,%rdi
+  8043a2:	41 ff d0             	call   *%r8
+}
+  8043a5:	48 83 c4 40          	add    $0x40,%rsp
+  8043a9:	5b                   	pop    %rbx
+  8043aa:	41 5f                	pop    %r15
+  8043ac:	5d                   	pop    %rbp
+  8043ad:	c3                   	ret
+
+00000000008043ae <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8043ae:	55                   	push   %rbp
+  8043af:	48 89 e5             	mov    %rsp,%rbp
+  8043b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8043b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8043b6 <seek+0x8>
+  8043bd:	49 bb 8a 4c 00 00 00 	movabs $0x4c8a,%r11
+  8043c4:	00 00 00 
+  8043c7:	4c 01 d8             	add    %r11,%rax
+  8043ca:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8043cd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8043d0:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8043d4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8043d7:	48 89 ce             	mov    %rcx,%rsi
+  8043da:	89 d7                	mov    %edx,%edi
+  8043dc:	48 ba 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rdx
+  8043e3:	ff ff ff 
+  8043e6:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8043ea:	ff d0                	call   *%rax
+  8043ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043f3:	79 05                	jns    8043fa <seek+0x4c>
+		return r;
+  8043f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043f8:	eb 0f                	jmp    804409 <seek+0x5b>
+	fd->fd_offset = offset;
+  8043fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043fe:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804401:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  804404:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804409:	c9                   	leave
+  80440a:	c3                   	ret
+
+000000000080440b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80440b:	55                   	push   %rbp
+  80440c:	48 89 e5             	mov    %rsp,%rbp
+  80440f:	41 57                	push   %r15
+  804411:	53                   	push   %rbx
+  804412:	48 83 ec 30          	sub    $0x30,%rsp
+  804416:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804416 <ftruncate+0xb>
+  80441d:	49 bb 2a 4c 00 00 00 	movabs $0x4c2a,%r11
+  804424:	00 00 00 
+  804427:	4c 01 db             	add    %r11,%rbx
+  80442a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80442d:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804430:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804434:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804437:	48 89 d6             	mov    %rdx,%rsi
+  80443a:	89 c7                	mov    %eax,%edi
+  80443c:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  804443:	ff ff ff 
+  804446:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80444a:	ff d0                	call   *%rax
+  80444c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80444f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804453:	78 28                	js     80447d <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804455:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804459:	8b 00                	mov    (%rax),%eax
+  80445b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80445f:	48 89 d6             	mov    %rdx,%rsi
+  804462:	89 c7                	mov    %eax,%edi
+  804464:	48 b8 15 ad ff ff ff 	movabs $0xffffffffffffad15,%rax
+  80446b:	ff ff ff 
+  80446e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804472:	ff d0                	call   *%rax
+  804474:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804477:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80447b:	79 08                	jns    804485 <ftruncate+0x7a>
+		return r;
+  80447d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804480:	e9 83 00 00 00       	jmp    804508 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804485:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804489:	8b 40 08             	mov    0x8(%rax),%eax
+  80448c:	83 e0 03             	and    $0x3,%eax
+  80448f:	85 c0                	test   %eax,%eax
+  804491:	75 4b                	jne    8044de <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804493:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80449a:	ff ff ff 
+  80449d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8044a1:	48 8b 00             	mov    (%rax),%rax
+  8044a4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8044aa:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8044ad:	89 c6                	mov    %eax,%esi
+  8044af:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  8044b6:	ff ff ff 
+  8044b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044bd:	48 89 c7             	mov    %rax,%rdi
+  8044c0:	49 89 df             	mov    %rbx,%r15
+  8044c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044c8:	48 b9 c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rcx
+  8044cf:	ff ff ff 
+  8044d2:	48 01 d9             	add    %rbx,%rcx
+  8044d5:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8044d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8044dc:	eb 2a                	jmp    804508 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8044de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044e2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8044e6:	48 85 c0             	test   %rax,%rax
+  8044e9:	75 07                	jne    8044f2 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8044eb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8044f0:	eb 16                	jmp    804508 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8044f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044f6:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8044fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044fe:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804501:	89 d6                	mov    %edx,%esi
+  804503:	48 89 c7             	mov    %rax,%rdi
+  804506:	ff d1                	call   *%rcx
+}
+  804508:	48 83 c4 30          	add    $0x30,%rsp
+  80450c:	5b                   	pop    %rbx
+  80450d:	41 5f                	pop    %r15
+  80450f:	5d                   	pop    %rbp
+  804510:	c3                   	ret
+
+0000000000804511 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804511:	55                   	push   %rbp
+  804512:	48 89 e5             	mov    %rsp,%rbp
+  804515:	53                   	push   %rbx
+  804516:	48 83 ec 38          	sub    $0x38,%rsp
+  80451a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80451a <fstat+0x9>
+  804521:	49 bb 26 4b 00 00 00 	movabs $0x4b26,%r11
+  804528:	00 00 00 
+  80452b:	4c 01 db             	add    %r11,%rbx
+  80452e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804531:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804535:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804539:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80453c:	48 89 d6             	mov    %rdx,%rsi
+  80453f:	89 c7                	mov    %eax,%edi
+  804541:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  804548:	ff ff ff 
+  80454b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80454f:	ff d0                	call   *%rax
+  804551:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804554:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804558:	78 28                	js     804582 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80455a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80455e:	8b 00                	mov    (%rax),%eax
+  804560:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804564:	48 89 d6             	mov    %rdx,%rsi
+  804567:	89 c7                	mov    %eax,%edi
+  804569:	48 b8 15 ad ff ff ff 	movabs $0xffffffffffffad15,%rax
+  804570:	ff ff ff 
+  804573:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804577:	ff d0                	call   *%rax
+  804579:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80457c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804580:	79 05                	jns    804587 <fstat+0x76>
+		return r;
+  804582:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804585:	eb 5e                	jmp    8045e5 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804587:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80458b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80458f:	48 85 c0             	test   %rax,%rax
+  804592:	75 07                	jne    80459b <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804594:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804599:	eb 4a                	jmp    8045e5 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80459b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80459f:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8045a2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045a6:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8045ad:	00 00 00 
+	stat->st_isdir = 0;
+  8045b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045b4:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8045bb:	00 00 00 
+	stat->st_dev = dev;
+  8045be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8045c2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045c6:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8045cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045d1:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8045d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8045dd:	48 89 d6             	mov    %rdx,%rsi
+  8045e0:	48 89 c7             	mov    %rax,%rdi
+  8045e3:	ff d1                	call   *%rcx
+}
+  8045e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045e9:	c9                   	leave
+  8045ea:	c3                   	ret
+
+00000000008045eb <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8045eb:	55                   	push   %rbp
+  8045ec:	48 89 e5             	mov    %rsp,%rbp
+  8045ef:	41 57                	push   %r15
+  8045f1:	53                   	push   %rbx
+  8045f2:	48 83 ec 20          	sub    $0x20,%rsp
+  8045f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045f6 <stat+0xb>
+  8045fd:	49 bb 4a 4a 00 00 00 	movabs $0x4a4a,%r11
+  804604:	00 00 00 
+  804607:	4c 01 db             	add    %r11,%rbx
+  80460a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80460e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804612:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804616:	be 00 00 00 00       	mov    $0x0,%esi
+  80461b:	48 89 c7             	mov    %rax,%rdi
+  80461e:	49 89 df             	mov    %rbx,%r15
+  804621:	48 b8 85 b8 ff ff ff 	movabs $0xffffffffffffb885,%rax
+  804628:	ff ff ff 
+  80462b:	48 01 d8             	add    %rbx,%rax
+  80462e:	ff d0                	call   *%rax
+  804630:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804633:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804637:	79 05                	jns    80463e <stat+0x53>
+		return fd;
+  804639:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80463c:	eb 37                	jmp    804675 <stat+0x8a>
+	r = fstat(fd, stat);
+  80463e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804642:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804645:	48 89 d6             	mov    %rdx,%rsi
+  804648:	89 c7                	mov    %eax,%edi
+  80464a:	48 b8 d1 b4 ff ff ff 	movabs $0xffffffffffffb4d1,%rax
+  804651:	ff ff ff 
+  804654:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804658:	ff d0                	call   *%rax
+  80465a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80465d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804660:	89 c7                	mov    %eax,%edi
+  804662:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  804669:	ff ff ff 
+  80466c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804670:	ff d0                	call   *%rax
+	return r;
+  804672:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804675:	48 83 c4 20          	add    $0x20,%rsp
+  804679:	5b                   	pop    %rbx
+  80467a:	41 5f                	pop    %r15
+  80467c:	5d                   	pop    %rbp
+  80467d:	c3                   	ret
+
+000000000080467e <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80467e:	55                   	push   %rbp
+  80467f:	48 89 e5             	mov    %rsp,%rbp
+  804682:	41 57                	push   %r15
+  804684:	53                   	push   %rbx
+  804685:	48 83 ec 10          	sub    $0x10,%rsp
+  804689:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804689 <fsipc+0xb>
+  804690:	49 bb b7 49 00 00 00 	movabs $0x49b7,%r11
+  804697:	00 00 00 
+  80469a:	4c 01 db             	add    %r11,%rbx
+  80469d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8046a0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8046a4:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8046ab:	00 00 00 
+  8046ae:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8046b1:	85 c0                	test   %eax,%eax
+  8046b3:	75 24                	jne    8046d9 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8046b5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8046ba:	49 89 df             	mov    %rbx,%r15
+  8046bd:	48 b8 b0 a9 ff ff ff 	movabs $0xffffffffffffa9b0,%rax
+  8046c4:	ff ff ff 
+  8046c7:	48 01 d8             	add    %rbx,%rax
+  8046ca:	ff d0                	call   *%rax
+  8046cc:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8046d3:	00 00 00 
+  8046d6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8046d9:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8046e0:	00 00 00 
+  8046e3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8046e6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8046ea:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8046ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8046f3:	49 89 d0             	mov    %rdx,%r8
+  8046f6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8046fb:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804702:	00 00 00 
+  804705:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804709:	89 c7                	mov    %eax,%edi
+  80470b:	49 89 df             	mov    %rbx,%r15
+  80470e:	48 b8 cf a3 ff ff ff 	movabs $0xffffffffffffa3cf,%rax
+  804715:	ff ff ff 
+  804718:	48 01 d8             	add    %rbx,%rax
+  80471b:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  80471d:	48 83 c4 10          	add    $0x10,%rsp
+  804721:	5b                   	pop    %rbx
+  804722:	41 5f                	pop    %r15
+  804724:	5d                   	pop    %rbp
+  804725:	c3                   	ret
+
+0000000000804726 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804726:	55                   	push   %rbp
+  804727:	48 89 e5             	mov    %rsp,%rbp
+  80472a:	41 57                	push   %r15
+  80472c:	53                   	push   %rbx
+  80472d:	48 83 ec 20          	sub    $0x20,%rsp
+  804731:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804731 <fsipc_words+0xb>
+  804738:	49 bb 0f 49 00 00 00 	movabs $0x490f,%r11
+  80473f:	00 00 00 
+  804742:	4c 01 db             	add    %r11,%rbx
+  804745:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804748:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80474c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804750:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804757:	00 00 00 
+  80475a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80475d:	85 c0                	test   %eax,%eax
+  80475f:	75 24                	jne    804785 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804761:	bf 01 00 00 00       	mov    $0x1,%edi
+  804766:	49 89 df             	mov    %rbx,%r15
+  804769:	48 b8 b0 a9 ff ff ff 	movabs $0xffffffffffffa9b0,%rax
+  804770:	ff ff ff 
+  804773:	48 01 d8             	add    %rbx,%rax
+  804776:	ff d0                	call   *%rax
+  804778:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80477f:	00 00 00 
+  804782:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804785:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80478c:	00 00 00 
+  80478f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804792:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804796:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80479a:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80479d:	89 c7                	mov    %eax,%edi
+  80479f:	49 89 df             	mov    %rbx,%r15
+  8047a2:	48 b8 ba a4 ff ff ff 	movabs $0xffffffffffffa4ba,%rax
+  8047a9:	ff ff ff 
+  8047ac:	48 01 d8             	add    %rbx,%rax
+  8047af:	ff d0                	call   *%rax
+}
+  8047b1:	48 83 c4 20          	add    $0x20,%rsp
+  8047b5:	5b                   	pop    %rbx
+  8047b6:	41 5f                	pop    %r15
+  8047b8:	5d                   	pop    %rbp
+  8047b9:	c3                   	ret
+
+00000000008047ba <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8047ba:	55                   	push   %rbp
+  8047bb:	48 89 e5             	mov    %rsp,%rbp
+  8047be:	41 57                	push   %r15
+  8047c0:	53                   	push   %rbx
+  8047c1:	48 83 ec 40          	sub    $0x40,%rsp
+  8047c5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047c5 <fsipc_pages+0xb>
+  8047cc:	49 bb 7b 48 00 00 00 	movabs $0x487b,%r11
+  8047d3:	00 00 00 
+  8047d6:	4c 01 db             	add    %r11,%rbx
+  8047d9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8047dc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8047e0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8047e4:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8047e7:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8047ee:	00 00 00 
+  8047f1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8047f4:	85 c0                	test   %eax,%eax
+  8047f6:	75 24                	jne    80481c <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8047f8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8047fd:	49 89 df             	mov    %rbx,%r15
+  804800:	48 b8 b0 a9 ff ff ff 	movabs $0xffffffffffffa9b0,%rax
+  804807:	ff ff ff 
+  80480a:	48 01 d8             	add    %rbx,%rax
+  80480d:	ff d0                	call   *%rax
+  80480f:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804816:	00 00 00 
+  804819:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  80481c:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804821:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804825:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804828:	48 98                	cltq
+  80482a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80482e:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804832:	0f 95 c0             	setne  %al
+  804835:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804838:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80483f:	00 
+  804840:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804844:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804848:	48 01 d0             	add    %rdx,%rax
+  80484b:	48 83 e8 01          	sub    $0x1,%rax
+  80484f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804853:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804857:	ba 00 00 00 00       	mov    $0x0,%edx
+  80485c:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804860:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804864:	48 29 d0             	sub    %rdx,%rax
+  804867:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  80486b:	41 89 c2             	mov    %eax,%r10d
+  80486e:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804875:	00 00 00 
+  804878:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80487b:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  80487f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804883:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804886:	48 83 ec 08          	sub    $0x8,%rsp
+  80488a:	6a 40                	push   $0x40
+  80488c:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804891:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804898:	00 
+  804899:	6a 05                	push   $0x5
+  80489b:	41 89 f9             	mov    %edi,%r9d
+  80489e:	49 89 c8             	mov    %rcx,%r8
+  8048a1:	44 89 d1             	mov    %r10d,%ecx
+  8048a4:	89 c7                	mov    %eax,%edi
+  8048a6:	49 89 df             	mov    %rbx,%r15
+  8048a9:	48 b8 b8 a5 ff ff ff 	movabs $0xffffffffffffa5b8,%rax
+  8048b0:	ff ff ff 
+  8048b3:	48 01 d8             	add    %rbx,%rax
+  8048b6:	ff d0                	call   *%rax
+  8048b8:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8048bc:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8048c0:	5b                   	pop    %rbx
+  8048c1:	41 5f                	pop    %r15
+  8048c3:	5d                   	pop    %rbp
+  8048c4:	c3                   	ret
+
+00000000008048c5 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8048c5:	55                   	push   %rbp
+  8048c6:	48 89 e5             	mov    %rsp,%rbp
+  8048c9:	41 57                	push   %r15
+  8048cb:	53                   	push   %rbx
+  8048cc:	48 83 ec 20          	sub    $0x20,%rsp
+  8048d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048d0 <open+0xb>
+  8048d7:	49 bb 70 47 00 00 00 	movabs $0x4770,%r11
+  8048de:	00 00 00 
+  8048e1:	4c 01 db             	add    %r11,%rbx
+  8048e4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048e8:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8048eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048ef:	48 89 c7             	mov    %rax,%rdi
+  8048f2:	49 89 df             	mov    %rbx,%r15
+  8048f5:	48 b8 ee 81 ff ff ff 	movabs $0xffffffffffff81ee,%rax
+  8048fc:	ff ff ff 
+  8048ff:	48 01 d8             	add    %rbx,%rax
+  804902:	ff d0                	call   *%rax
+  804904:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804909:	7e 0a                	jle    804915 <open+0x50>
+		return -E_BAD_PATH;
+  80490b:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804910:	e9 18 01 00 00       	jmp    804a2d <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804915:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804919:	48 89 c7             	mov    %rax,%rdi
+  80491c:	49 89 df             	mov    %rbx,%r15
+  80491f:	48 b8 b9 aa ff ff ff 	movabs $0xffffffffffffaab9,%rax
+  804926:	ff ff ff 
+  804929:	48 01 d8             	add    %rbx,%rax
+  80492c:	ff d0                	call   *%rax
+  80492e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804931:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804935:	74 08                	je     80493f <open+0x7a>
+		return r;
+  804937:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80493a:	e9 ee 00 00 00       	jmp    804a2d <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80493f:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804946:	00 00 00 
+  804949:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80494c:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804953:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804957:	48 89 c6             	mov    %rax,%rsi
+  80495a:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804961:	00 00 00 
+  804964:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804968:	48 89 c7             	mov    %rax,%rdi
+  80496b:	49 89 df             	mov    %rbx,%r15
+  80496e:	48 b8 82 82 ff ff ff 	movabs $0xffffffffffff8282,%rax
+  804975:	ff ff ff 
+  804978:	48 01 d8             	add    %rbx,%rax
+  80497b:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  80497d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804981:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804986:	48 89 c6             	mov    %rax,%rsi
+  804989:	bf 00 00 00 00       	mov    $0x0,%edi
+  80498e:	49 89 df             	mov    %rbx,%r15
+  804991:	48 b8 3e 8f ff ff ff 	movabs $0xffffffffffff8f3e,%rax
+  804998:	ff ff ff 
+  80499b:	48 01 d8             	add    %rbx,%rax
+  80499e:	ff d0                	call   *%rax
+  8049a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049a7:	74 23                	je     8049cc <open+0x107>
+		fd_close(fd,0);
+  8049a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8049b2:	48 89 c7             	mov    %rax,%rdi
+  8049b5:	49 89 df             	mov    %rbx,%r15
+  8049b8:	48 b8 1a ac ff ff ff 	movabs $0xffffffffffffac1a,%rax
+  8049bf:	ff ff ff 
+  8049c2:	48 01 d8             	add    %rbx,%rax
+  8049c5:	ff d0                	call   *%rax
+		return r;
+  8049c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049ca:	eb 61                	jmp    804a2d <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  8049cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049d0:	48 89 c6             	mov    %rax,%rsi
+  8049d3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8049d8:	48 b8 3e b6 ff ff ff 	movabs $0xffffffffffffb63e,%rax
+  8049df:	ff ff ff 
+  8049e2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049e6:	ff d0                	call   *%rax
+  8049e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049ef:	74 23                	je     804a14 <open+0x14f>
+		fd_close(fd,0);
+  8049f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8049fa:	48 89 c7             	mov    %rax,%rdi
+  8049fd:	49 89 df             	mov    %rbx,%r15
+  804a00:	48 b8 1a ac ff ff ff 	movabs $0xffffffffffffac1a,%rax
+  804a07:	ff ff ff 
+  804a0a:	48 01 d8             	add    %rbx,%rax
+  804a0d:	ff d0                	call   *%rax
+		return r;
+  804a0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a12:	eb 19                	jmp    804a2d <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804a14:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a18:	48 89 c7             	mov    %rax,%rdi
+  804a1b:	49 89 df             	mov    %rbx,%r15
+  804a1e:	48 b8 3f aa ff ff ff 	movabs $0xffffffffffffaa3f,%rax
+  804a25:	ff ff ff 
+  804a28:	48 01 d8             	add    %rbx,%rax
+  804a2b:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804a2d:	48 83 c4 20          	add    $0x20,%rsp
+  804a31:	5b                   	pop    %rbx
+  804a32:	41 5f                	pop    %r15
+  804a34:	5d                   	pop    %rbp
+  804a35:	c3                   	ret
+
+0000000000804a36 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804a36:	55                   	push   %rbp
+  804a37:	48 89 e5             	mov    %rsp,%rbp
+  804a3a:	48 83 ec 20          	sub    $0x20,%rsp
+  804a3e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a3e <devfile_flush+0x8>
+  804a45:	49 bb 02 46 00 00 00 	movabs $0x4602,%r11
+  804a4c:	00 00 00 
+  804a4f:	4c 01 d8             	add    %r11,%rax
+  804a52:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804a56:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a5a:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804a5d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804a60:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804a64:	ba 04 00 00 00       	mov    $0x4,%edx
+  804a69:	48 89 ce             	mov    %rcx,%rsi
+  804a6c:	bf 06 00 00 00       	mov    $0x6,%edi
+  804a71:	48 b9 e6 b6 ff ff ff 	movabs $0xffffffffffffb6e6,%rcx
+  804a78:	ff ff ff 
+  804a7b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804a7f:	ff d0                	call   *%rax
+}
+  804a81:	c9                   	leave
+  804a82:	c3                   	ret
+
+0000000000804a83 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804a83:	55                   	push   %rbp
+  804a84:	48 89 e5             	mov    %rsp,%rbp
+  804a87:	41 57                	push   %r15
+  804a89:	53                   	push   %rbx
+  804a8a:	48 83 ec 60          	sub    $0x60,%rsp
+  804a8e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a8e <devfile_read+0xb>
+  804a95:	49 bb b2 45 00 00 00 	movabs $0x45b2,%r11
+  804a9c:	00 00 00 
+  804a9f:	4c 01 db             	add    %r11,%rbx
+  804aa2:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804aa6:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804aaa:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804aae:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804ab2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804ab6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804aba:	8b 50 0c             	mov    0xc(%rax),%edx
+  804abd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ac1:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804ac3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ac7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804acb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804acf:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804ad3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804ad8:	ba 10 00 00 00       	mov    $0x10,%edx
+  804add:	48 89 c6             	mov    %rax,%rsi
+  804ae0:	bf 03 00 00 00       	mov    $0x3,%edi
+  804ae5:	48 b8 7a b7 ff ff ff 	movabs $0xffffffffffffb77a,%rax
+  804aec:	ff ff ff 
+  804aef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804af3:	ff d0                	call   *%rax
+  804af5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804af8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804afc:	79 05                	jns    804b03 <devfile_read+0x80>
+		return r;
+  804afe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b01:	eb 64                	jmp    804b67 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804b03:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b06:	48 63 d0             	movslq %eax,%rdx
+  804b09:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804b0d:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804b12:	48 01 c1             	add    %rax,%rcx
+  804b15:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804b19:	48 89 ce             	mov    %rcx,%rsi
+  804b1c:	48 89 c7             	mov    %rax,%rdi
+  804b1f:	49 89 df             	mov    %rbx,%r15
+  804b22:	48 b8 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rax
+  804b29:	ff ff ff 
+  804b2c:	48 01 d8             	add    %rbx,%rax
+  804b2f:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804b31:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804b38:	ff ff ff 
+  804b3b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804b3f:	48 8b 00             	mov    (%rax),%rax
+  804b42:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804b48:	89 c6                	mov    %eax,%esi
+  804b4a:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804b4f:	48 89 c7             	mov    %rax,%rdi
+  804b52:	49 89 df             	mov    %rbx,%r15
+  804b55:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  804b5c:	ff ff ff 
+  804b5f:	48 01 d8             	add    %rbx,%rax
+  804b62:	ff d0                	call   *%rax
+	return r;
+  804b64:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804b67:	48 83 c4 60          	add    $0x60,%rsp
+  804b6b:	5b                   	pop    %rbx
+  804b6c:	41 5f                	pop    %r15
+  804b6e:	5d                   	pop    %rbp
+  804b6f:	c3                   	ret
+
+0000000000804b70 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804b70:	55                   	push   %rbp
+  804b71:	48 89 e5             	mov    %rsp,%rbp
+  804b74:	41 57                	push   %r15
+  804b76:	53                   	push   %rbx
+  804b77:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804b7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b7b <devfile_write+0xb>
+  804b82:	49 bb c5 44 00 00 00 	movabs $0x44c5,%r11
+  804b89:	00 00 00 
+  804b8c:	4c 01 db             	add    %r11,%rbx
+  804b8f:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804b93:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804b97:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804b9e:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804ba2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804ba6:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804bad:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804bb1:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804bb8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804bbb:	48 63 d0             	movslq %eax,%rdx
+  804bbe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bc2:	48 39 c2             	cmp    %rax,%rdx
+  804bc5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804bc9:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804bd0:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804bd7:	00 
+  804bd8:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804bdf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804be3:	48 01 d0             	add    %rdx,%rax
+  804be6:	48 83 e8 01          	sub    $0x1,%rax
+  804bea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804bee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bf2:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bf7:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804bfb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bff:	48 29 d0             	sub    %rdx,%rax
+  804c02:	48 c1 e8 0c          	shr    $0xc,%rax
+  804c06:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804c09:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804c0c:	89 c6                	mov    %eax,%esi
+  804c0e:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804c13:	48 89 c7             	mov    %rax,%rdi
+  804c16:	49 89 df             	mov    %rbx,%r15
+  804c19:	48 b8 24 a9 ff ff ff 	movabs $0xffffffffffffa924,%rax
+  804c20:	ff ff ff 
+  804c23:	48 01 d8             	add    %rbx,%rax
+  804c26:	ff d0                	call   *%rax
+  804c28:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804c2b:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804c2f:	79 08                	jns    804c39 <devfile_write+0xc9>
+		return r;
+  804c31:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804c34:	e9 8f 00 00 00       	jmp    804cc8 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804c39:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804c40:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804c44:	48 89 c6             	mov    %rax,%rsi
+  804c47:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804c4c:	48 89 c7             	mov    %rax,%rdi
+  804c4f:	49 89 df             	mov    %rbx,%r15
+  804c52:	48 b8 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rax
+  804c59:	ff ff ff 
+  804c5c:	48 01 d8             	add    %rbx,%rax
+  804c5f:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804c61:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804c65:	8b 50 0c             	mov    0xc(%rax),%edx
+  804c68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c6c:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804c6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c72:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804c79:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804c7d:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804c80:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804c84:	89 d1                	mov    %edx,%ecx
+  804c86:	ba 10 00 00 00       	mov    $0x10,%edx
+  804c8b:	48 89 c6             	mov    %rax,%rsi
+  804c8e:	bf 04 00 00 00       	mov    $0x4,%edi
+  804c93:	48 b8 7a b7 ff ff ff 	movabs $0xffffffffffffb77a,%rax
+  804c9a:	ff ff ff 
+  804c9d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ca1:	ff d0                	call   *%rax
+  804ca3:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804ca6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804ca9:	89 c6                	mov    %eax,%esi
+  804cab:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804cb0:	48 89 c7             	mov    %rax,%rdi
+  804cb3:	49 89 df             	mov    %rbx,%r15
+  804cb6:	48 b8 6a a9 ff ff ff 	movabs $0xffffffffffffa96a,%rax
+  804cbd:	ff ff ff 
+  804cc0:	48 01 d8             	add    %rbx,%rax
+  804cc3:	ff d0                	call   *%rax
+	return r;
+  804cc5:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804cc8:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804ccc:	5b                   	pop    %rbx
+  804ccd:	41 5f                	pop    %r15
+  804ccf:	5d                   	pop    %rbp
+  804cd0:	c3                   	ret
+
+0000000000804cd1 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804cd1:	55                   	push   %rbp
+  804cd2:	48 89 e5             	mov    %rsp,%rbp
+  804cd5:	41 57                	push   %r15
+  804cd7:	53                   	push   %rbx
+  804cd8:	48 83 ec 20          	sub    $0x20,%rsp
+  804cdc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cdc <devfile_stat+0xb>
+  804ce3:	49 bb 64 43 00 00 00 	movabs $0x4364,%r11
+  804cea:	00 00 00 
+  804ced:	4c 01 db             	add    %r11,%rbx
+  804cf0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804cf4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804cf8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cfc:	8b 40 0c             	mov    0xc(%rax),%eax
+  804cff:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804d06:	00 00 00 
+  804d09:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804d0c:	be 00 00 00 00       	mov    $0x0,%esi
+  804d11:	bf 05 00 00 00       	mov    $0x5,%edi
+  804d16:	48 b8 3e b6 ff ff ff 	movabs $0xffffffffffffb63e,%rax
+  804d1d:	ff ff ff 
+  804d20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d24:	ff d0                	call   *%rax
+  804d26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d2d:	79 05                	jns    804d34 <devfile_stat+0x63>
+		return r;
+  804d2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d32:	eb 65                	jmp    804d99 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804d34:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d38:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804d3f:	00 00 00 
+  804d42:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804d46:	48 89 d6             	mov    %rdx,%rsi
+  804d49:	48 89 c7             	mov    %rax,%rdi
+  804d4c:	49 89 df             	mov    %rbx,%r15
+  804d4f:	48 b8 82 82 ff ff ff 	movabs $0xffffffffffff8282,%rax
+  804d56:	ff ff ff 
+  804d59:	48 01 d8             	add    %rbx,%rax
+  804d5c:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804d5e:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804d65:	00 00 00 
+  804d68:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804d6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d73:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804d79:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804d80:	00 00 00 
+  804d83:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804d8a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d8e:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804d94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d99:	48 83 c4 20          	add    $0x20,%rsp
+  804d9d:	5b                   	pop    %rbx
+  804d9e:	41 5f                	pop    %r15
+  804da0:	5d                   	pop    %rbp
+  804da1:	c3                   	ret
+
+0000000000804da2 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804da2:	55                   	push   %rbp
+  804da3:	48 89 e5             	mov    %rsp,%rbp
+  804da6:	48 83 ec 20          	sub    $0x20,%rsp
+  804daa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804daa <devfile_trunc+0x8>
+  804db1:	49 bb 96 42 00 00 00 	movabs $0x4296,%r11
+  804db8:	00 00 00 
+  804dbb:	4c 01 d8             	add    %r11,%rax
+  804dbe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804dc2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804dc5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804dc9:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804dcc:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804dcf:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804dd2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804dd5:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804dd9:	ba 08 00 00 00       	mov    $0x8,%edx
+  804dde:	48 89 ce             	mov    %rcx,%rsi
+  804de1:	bf 02 00 00 00       	mov    $0x2,%edi
+  804de6:	48 b9 e6 b6 ff ff ff 	movabs $0xffffffffffffb6e6,%rcx
+  804ded:	ff ff ff 
+  804df0:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804df4:	ff d0                	call   *%rax
+}
+  804df6:	c9                   	leave
+  804df7:	c3                   	ret
+
+0000000000804df8 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  804df8:	55                   	push   %rbp
+  804df9:	48 89 e5             	mov    %rsp,%rbp
+  804dfc:	41 57                	push   %r15
+  804dfe:	53                   	push   %rbx
+  804dff:	48 83 ec 10          	sub    $0x10,%rsp
+  804e03:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e03 <remove+0xb>
+  804e0a:	49 bb 3d 42 00 00 00 	movabs $0x423d,%r11
+  804e11:	00 00 00 
+  804e14:	4c 01 db             	add    %r11,%rbx
+  804e17:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  804e1b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e1f:	48 89 c7             	mov    %rax,%rdi
+  804e22:	49 89 df             	mov    %rbx,%r15
+  804e25:	48 b8 ee 81 ff ff ff 	movabs $0xffffffffffff81ee,%rax
+  804e2c:	ff ff ff 
+  804e2f:	48 01 d8             	add    %rbx,%rax
+  804e32:	ff d0                	call   *%rax
+  804e34:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804e39:	7e 07                	jle    804e42 <remove+0x4a>
+		return -E_BAD_PATH;
+  804e3b:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804e40:	eb 44                	jmp    804e86 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804e42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e46:	48 89 c6             	mov    %rax,%rsi
+  804e49:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804e50:	00 00 00 
+  804e53:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e57:	48 89 c7             	mov    %rax,%rdi
+  804e5a:	49 89 df             	mov    %rbx,%r15
+  804e5d:	48 b8 82 82 ff ff ff 	movabs $0xffffffffffff8282,%rax
+  804e64:	ff ff ff 
+  804e67:	48 01 d8             	add    %rbx,%rax
+  804e6a:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804e6c:	be 00 00 00 00       	mov    $0x0,%esi
+  804e71:	bf 07 00 00 00       	mov    $0x7,%edi
+  804e76:	48 b8 3e b6 ff ff ff 	movabs $0xffffffffffffb63e,%rax
+  804e7d:	ff ff ff 
+  804e80:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e84:	ff d0                	call   *%rax
+}
+  804e86:	48 83 c4 10          	add    $0x10,%rsp
+  804e8a:	5b                   	pop    %rbx
+  804e8b:	41 5f                	pop    %r15
+  804e8d:	5d                   	pop    %rbp
+  804e8e:	c3                   	ret
+
+0000000000804e8f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804e8f:	55                   	push   %rbp
+  804e90:	48 89 e5             	mov    %rsp,%rbp
+  804e93:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e93 <sync+0x4>
+  804e9a:	49 bb ad 41 00 00 00 	movabs $0x41ad,%r11
+  804ea1:	00 00 00 
+  804ea4:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  804eac:	be 00 00 00 00       	mov    $0x0,%esi
+  804eb1:	bf 08 00 00 00       	mov    $0x8,%edi
+  804eb6:	48 b9 e6 b6 ff ff ff 	movabs $0xffffffffffffb6e6,%rcx
+  804ebd:	ff ff ff 
+  804ec0:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804ec4:	ff d0                	call   *%rax
+}
+  804ec6:	5d                   	pop    %rbp
+  804ec7:	c3                   	ret
+
+0000000000804ec8 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804ec8:	55                   	push   %rbp
+  804ec9:	48 89 e5             	mov    %rsp,%rbp
+  804ecc:	41 57                	push   %r15
+  804ece:	53                   	push   %rbx
+  804ecf:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804ed6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ed6 <copy+0xe>
+  804edd:	49 bb 6a 41 00 00 00 	movabs $0x416a,%r11
+  804ee4:	00 00 00 
+  804ee7:	4c 01 db             	add    %r11,%rbx
+  804eea:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804ef1:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  804ef8:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804eff:	be 00 00 00 00       	mov    $0x0,%esi
+  804f04:	48 89 c7             	mov    %rax,%rdi
+  804f07:	48 b8 85 b8 ff ff ff 	movabs $0xffffffffffffb885,%rax
+  804f0e:	ff ff ff 
+  804f11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f15:	ff d0                	call   *%rax
+  804f17:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  804f1a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f1e:	79 35                	jns    804f55 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  804f20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f23:	89 c6                	mov    %eax,%esi
+  804f25:	48 b8 f6 e2 ff ff ff 	movabs $0xffffffffffffe2f6,%rax
+  804f2c:	ff ff ff 
+  804f2f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f33:	48 89 c7             	mov    %rax,%rdi
+  804f36:	49 89 df             	mov    %rbx,%r15
+  804f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f3e:	48 ba c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rdx
+  804f45:	ff ff ff 
+  804f48:	48 01 da             	add    %rbx,%rdx
+  804f4b:	ff d2                	call   *%rdx
+		return fd_src;
+  804f4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f50:	e9 d7 01 00 00       	jmp    80512c <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804f55:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804f5c:	be 01 01 00 00       	mov    $0x101,%esi
+  804f61:	48 89 c7             	mov    %rax,%rdi
+  804f64:	48 b8 85 b8 ff ff ff 	movabs $0xffffffffffffb885,%rax
+  804f6b:	ff ff ff 
+  804f6e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f72:	ff d0                	call   *%rax
+  804f74:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804f77:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804f7b:	0f 89 df 00 00 00    	jns    805060 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804f81:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804f84:	89 c6                	mov    %eax,%esi
+  804f86:	48 b8 0c e3 ff ff ff 	movabs $0xffffffffffffe30c,%rax
+  804f8d:	ff ff ff 
+  804f90:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f94:	48 89 c7             	mov    %rax,%rdi
+  804f97:	49 89 df             	mov    %rbx,%r15
+  804f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f9f:	48 ba c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rdx
+  804fa6:	ff ff ff 
+  804fa9:	48 01 da             	add    %rbx,%rdx
+  804fac:	ff d2                	call   *%rdx
+		close(fd_src);
+  804fae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fb1:	89 c7                	mov    %eax,%edi
+  804fb3:	49 89 df             	mov    %rbx,%r15
+  804fb6:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  804fbd:	ff ff ff 
+  804fc0:	48 01 d8             	add    %rbx,%rax
+  804fc3:	ff d0                	call   *%rax
+		return fd_dest;
+  804fc5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804fc8:	e9 5f 01 00 00       	jmp    80512c <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804fcd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804fd0:	48 63 d0             	movslq %eax,%rdx
+  804fd3:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804fda:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804fdd:	48 89 ce             	mov    %rcx,%rsi
+  804fe0:	89 c7                	mov    %eax,%edi
+  804fe2:	49 89 df             	mov    %rbx,%r15
+  804fe5:	48 b8 5c b2 ff ff ff 	movabs $0xffffffffffffb25c,%rax
+  804fec:	ff ff ff 
+  804fef:	48 01 d8             	add    %rbx,%rax
+  804ff2:	ff d0                	call   *%rax
+  804ff4:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804ff7:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804ffb:	79 63                	jns    805060 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804ffd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805000:	89 c6                	mov    %eax,%esi
+  805002:	48 b8 26 e3 ff ff ff 	movabs $0xffffffffffffe326,%rax
+  805009:	ff ff ff 
+  80500c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805010:	48 89 c7             	mov    %rax,%rdi
+  805013:	49 89 df             	mov    %rbx,%r15
+  805016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80501b:	48 ba c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rdx
+  805022:	ff ff ff 
+  805025:	48 01 da             	add    %rbx,%rdx
+  805028:	ff d2                	call   *%rdx
+			close(fd_src);
+  80502a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80502d:	89 c7                	mov    %eax,%edi
+  80502f:	49 89 df             	mov    %rbx,%r15
+  805032:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  805039:	ff ff ff 
+  80503c:	48 01 d8             	add    %rbx,%rax
+  80503f:	ff d0                	call   *%rax
+			close(fd_dest);
+  805041:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805044:	89 c7                	mov    %eax,%edi
+  805046:	49 89 df             	mov    %rbx,%r15
+  805049:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  805050:	ff ff ff 
+  805053:	48 01 d8             	add    %rbx,%rax
+  805056:	ff d0                	call   *%rax
+			return write_size;
+  805058:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80505b:	e9 cc 00 00 00       	jmp    80512c <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  805060:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805067:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80506a:	ba 00 02 00 00       	mov    $0x200,%edx
+  80506f:	48 89 ce             	mov    %rcx,%rsi
+  805072:	89 c7                	mov    %eax,%edi
+  805074:	49 89 df             	mov    %rbx,%r15
+  805077:	48 b8 b6 b0 ff ff ff 	movabs $0xffffffffffffb0b6,%rax
+  80507e:	ff ff ff 
+  805081:	48 01 d8             	add    %rbx,%rax
+  805084:	ff d0                	call   *%rax
+  805086:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805089:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80508d:	0f 8f 3a ff ff ff    	jg     804fcd <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805093:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805097:	79 60                	jns    8050f9 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  805099:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80509c:	89 c6                	mov    %eax,%esi
+  80509e:	48 b8 39 e3 ff ff ff 	movabs $0xffffffffffffe339,%rax
+  8050a5:	ff ff ff 
+  8050a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050ac:	48 89 c7             	mov    %rax,%rdi
+  8050af:	49 89 df             	mov    %rbx,%r15
+  8050b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050b7:	48 ba c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rdx
+  8050be:	ff ff ff 
+  8050c1:	48 01 da             	add    %rbx,%rdx
+  8050c4:	ff d2                	call   *%rdx
+		close(fd_src);
+  8050c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050c9:	89 c7                	mov    %eax,%edi
+  8050cb:	49 89 df             	mov    %rbx,%r15
+  8050ce:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  8050d5:	ff ff ff 
+  8050d8:	48 01 d8             	add    %rbx,%rax
+  8050db:	ff d0                	call   *%rax
+		close(fd_dest);
+  8050dd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8050e0:	89 c7                	mov    %eax,%edi
+  8050e2:	49 89 df             	mov    %rbx,%r15
+  8050e5:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  8050ec:	ff ff ff 
+  8050ef:	48 01 d8             	add    %rbx,%rax
+  8050f2:	ff d0                	call   *%rax
+		return read_size;
+  8050f4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8050f7:	eb 33                	jmp    80512c <copy+0x264>
+	}
+	close(fd_src);
+  8050f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050fc:	89 c7                	mov    %eax,%edi
+  8050fe:	49 89 df             	mov    %rbx,%r15
+  805101:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  805108:	ff ff ff 
+  80510b:	48 01 d8             	add    %rbx,%rax
+  80510e:	ff d0                	call   *%rax
+	close(fd_dest);
+  805110:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805113:	89 c7                	mov    %eax,%edi
+  805115:	49 89 df             	mov    %rbx,%r15
+  805118:	48 b8 fe ad ff ff ff 	movabs $0xffffffffffffadfe,%rax
+  80511f:	ff ff ff 
+  805122:	48 01 d8             	add    %rbx,%rax
+  805125:	ff d0                	call   *%rax
+	return 0;
+  805127:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  80512c:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  805133:	5b                   	pop    %rbx
+  805134:	41 5f                	pop    %r15
+  805136:	5d                   	pop    %rbp
+  805137:	c3                   	ret
+
+0000000000805138 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805138:	55                   	push   %rbp
+  805139:	48 89 e5             	mov    %rsp,%rbp
+  80513c:	41 57                	push   %r15
+  80513e:	53                   	push   %rbx
+  80513f:	48 83 ec 20          	sub    $0x20,%rsp
+  805143:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805143 <fd2sockid+0xb>
+  80514a:	49 bb fd 3e 00 00 00 	movabs $0x3efd,%r11
+  805151:	00 00 00 
+  805154:	4c 01 db             	add    %r11,%rbx
+  805157:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80515a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80515e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805161:	48 89 d6             	mov    %rdx,%rsi
+  805164:	89 c7                	mov    %eax,%edi
+  805166:	49 89 df             	mov    %rbx,%r15
+  805169:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  805170:	ff ff ff 
+  805173:	48 01 d8             	add    %rbx,%rax
+  805176:	ff d0                	call   *%rax
+  805178:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80517b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80517f:	79 05                	jns    805186 <fd2sockid+0x4e>
+		return r;
+  805181:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805184:	eb 25                	jmp    8051ab <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805186:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80518a:	8b 10                	mov    (%rax),%edx
+  80518c:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  805193:	00 00 00 
+  805196:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805199:	39 c2                	cmp    %eax,%edx
+  80519b:	74 07                	je     8051a4 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80519d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8051a2:	eb 07                	jmp    8051ab <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8051a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051a8:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8051ab:	48 83 c4 20          	add    $0x20,%rsp
+  8051af:	5b                   	pop    %rbx
+  8051b0:	41 5f                	pop    %r15
+  8051b2:	5d                   	pop    %rbp
+  8051b3:	c3                   	ret
+
+00000000008051b4 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8051b4:	55                   	push   %rbp
+  8051b5:	48 89 e5             	mov    %rsp,%rbp
+  8051b8:	41 57                	push   %r15
+  8051ba:	53                   	push   %rbx
+  8051bb:	48 83 ec 20          	sub    $0x20,%rsp
+  8051bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051bf <alloc_sockfd+0xb>
+  8051c6:	49 bb 81 3e 00 00 00 	movabs $0x3e81,%r11
+  8051cd:	00 00 00 
+  8051d0:	4c 01 db             	add    %r11,%rbx
+  8051d3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8051d6:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8051da:	48 89 c7             	mov    %rax,%rdi
+  8051dd:	49 89 df             	mov    %rbx,%r15
+  8051e0:	48 b8 b9 aa ff ff ff 	movabs $0xffffffffffffaab9,%rax
+  8051e7:	ff ff ff 
+  8051ea:	48 01 d8             	add    %rbx,%rax
+  8051ed:	ff d0                	call   *%rax
+  8051ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051f6:	78 2c                	js     805224 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8051f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051fc:	ba 07 04 00 00       	mov    $0x407,%edx
+  805201:	48 89 c6             	mov    %rax,%rsi
+  805204:	bf 00 00 00 00       	mov    $0x0,%edi
+  805209:	49 89 df             	mov    %rbx,%r15
+  80520c:	48 b8 3e 8f ff ff ff 	movabs $0xffffffffffff8f3e,%rax
+  805213:	ff ff ff 
+  805216:	48 01 d8             	add    %rbx,%rax
+  805219:	ff d0                	call   *%rax
+  80521b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80521e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805222:	79 1c                	jns    805240 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805224:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805227:	89 c7                	mov    %eax,%edi
+  805229:	49 89 df             	mov    %rbx,%r15
+  80522c:	48 b8 68 c9 ff ff ff 	movabs $0xffffffffffffc968,%rax
+  805233:	ff ff ff 
+  805236:	48 01 d8             	add    %rbx,%rax
+  805239:	ff d0                	call   *%rax
+		return r;
+  80523b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80523e:	eb 41                	jmp    805281 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  805240:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805244:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  80524b:	00 00 00 
+  80524e:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805251:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805253:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805257:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80525e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805262:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805265:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805268:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80526c:	48 89 c7             	mov    %rax,%rdi
+  80526f:	49 89 df             	mov    %rbx,%r15
+  805272:	48 b8 3f aa ff ff ff 	movabs $0xffffffffffffaa3f,%rax
+  805279:	ff ff ff 
+  80527c:	48 01 d8             	add    %rbx,%rax
+  80527f:	ff d0                	call   *%rax
+}
+  805281:	48 83 c4 20          	add    $0x20,%rsp
+  805285:	5b                   	pop    %rbx
+  805286:	41 5f                	pop    %r15
+  805288:	5d                   	pop    %rbp
+  805289:	c3                   	ret
+
+000000000080528a <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80528a:	55                   	push   %rbp
+  80528b:	48 89 e5             	mov    %rsp,%rbp
+  80528e:	41 57                	push   %r15
+  805290:	53                   	push   %rbx
+  805291:	48 83 ec 30          	sub    $0x30,%rsp
+  805295:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805295 <accept+0xb>
+  80529c:	49 bb ab 3d 00 00 00 	movabs $0x3dab,%r11
+  8052a3:	00 00 00 
+  8052a6:	4c 01 db             	add    %r11,%rbx
+  8052a9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8052ac:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8052b0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8052b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052b7:	89 c7                	mov    %eax,%edi
+  8052b9:	48 b8 f8 c0 ff ff ff 	movabs $0xffffffffffffc0f8,%rax
+  8052c0:	ff ff ff 
+  8052c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052c7:	ff d0                	call   *%rax
+  8052c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052d0:	79 05                	jns    8052d7 <accept+0x4d>
+		return r;
+  8052d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052d5:	eb 45                	jmp    80531c <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8052d7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8052db:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8052df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052e2:	48 89 ce             	mov    %rcx,%rsi
+  8052e5:	89 c7                	mov    %eax,%edi
+  8052e7:	49 89 df             	mov    %rbx,%r15
+  8052ea:	48 b8 d6 c7 ff ff ff 	movabs $0xffffffffffffc7d6,%rax
+  8052f1:	ff ff ff 
+  8052f4:	48 01 d8             	add    %rbx,%rax
+  8052f7:	ff d0                	call   *%rax
+  8052f9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805300:	79 05                	jns    805307 <accept+0x7d>
+		return r;
+  805302:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805305:	eb 15                	jmp    80531c <accept+0x92>
+	return alloc_sockfd(r);
+  805307:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80530a:	89 c7                	mov    %eax,%edi
+  80530c:	48 b8 74 c1 ff ff ff 	movabs $0xffffffffffffc174,%rax
+  805313:	ff ff ff 
+  805316:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80531a:	ff d0                	call   *%rax
+}
+  80531c:	48 83 c4 30          	add    $0x30,%rsp
+  805320:	5b                   	pop    %rbx
+  805321:	41 5f                	pop    %r15
+  805323:	5d                   	pop    %rbp
+  805324:	c3                   	ret
+
+0000000000805325 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805325:	55                   	push   %rbp
+  805326:	48 89 e5             	mov    %rsp,%rbp
+  805329:	41 57                	push   %r15
+  80532b:	53                   	push   %rbx
+  80532c:	48 83 ec 20          	sub    $0x20,%rsp
+  805330:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805330 <bind+0xb>
+  805337:	49 bb 10 3d 00 00 00 	movabs $0x3d10,%r11
+  80533e:	00 00 00 
+  805341:	4c 01 db             	add    %r11,%rbx
+  805344:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805347:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80534b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80534e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805351:	89 c7                	mov    %eax,%edi
+  805353:	48 b8 f8 c0 ff ff ff 	movabs $0xffffffffffffc0f8,%rax
+  80535a:	ff ff ff 
+  80535d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805361:	ff d0                	call   *%rax
+  805363:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805366:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80536a:	79 05                	jns    805371 <bind+0x4c>
+		return r;
+  80536c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80536f:	eb 21                	jmp    805392 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  805371:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805374:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805378:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80537b:	48 89 ce             	mov    %rcx,%rsi
+  80537e:	89 c7                	mov    %eax,%edi
+  805380:	49 89 df             	mov    %rbx,%r15
+  805383:	48 b8 82 c8 ff ff ff 	movabs $0xffffffffffffc882,%rax
+  80538a:	ff ff ff 
+  80538d:	48 01 d8             	add    %rbx,%rax
+  805390:	ff d0                	call   *%rax
+}
+  805392:	48 83 c4 20          	add    $0x20,%rsp
+  805396:	5b                   	pop    %rbx
+  805397:	41 5f                	pop    %r15
+  805399:	5d                   	pop    %rbp
+  80539a:	c3                   	ret
+
+000000000080539b <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80539b:	55                   	push   %rbp
+  80539c:	48 89 e5             	mov    %rsp,%rbp
+  80539f:	41 57                	push   %r15
+  8053a1:	53                   	push   %rbx
+  8053a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8053a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053a6 <shutdown+0xb>
+  8053ad:	49 bb 9a 3c 00 00 00 	movabs $0x3c9a,%r11
+  8053b4:	00 00 00 
+  8053b7:	4c 01 db             	add    %r11,%rbx
+  8053ba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8053bd:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8053c0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8053c3:	89 c7                	mov    %eax,%edi
+  8053c5:	48 b8 f8 c0 ff ff ff 	movabs $0xffffffffffffc0f8,%rax
+  8053cc:	ff ff ff 
+  8053cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053d3:	ff d0                	call   *%rax
+  8053d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053dc:	79 05                	jns    8053e3 <shutdown+0x48>
+		return r;
+  8053de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053e1:	eb 1c                	jmp    8053ff <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8053e3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8053e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053e9:	89 d6                	mov    %edx,%esi
+  8053eb:	89 c7                	mov    %eax,%edi
+  8053ed:	49 89 df             	mov    %rbx,%r15
+  8053f0:	48 b8 17 c9 ff ff ff 	movabs $0xffffffffffffc917,%rax
+  8053f7:	ff ff ff 
+  8053fa:	48 01 d8             	add    %rbx,%rax
+  8053fd:	ff d0                	call   *%rax
+}
+  8053ff:	48 83 c4 20          	add    $0x20,%rsp
+  805403:	5b                   	pop    %rbx
+  805404:	41 5f                	pop    %r15
+  805406:	5d                   	pop    %rbp
+  805407:	c3                   	ret
+
+0000000000805408 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805408:	55                   	push   %rbp
+  805409:	48 89 e5             	mov    %rsp,%rbp
+  80540c:	41 57                	push   %r15
+  80540e:	53                   	push   %rbx
+  80540f:	48 83 ec 10          	sub    $0x10,%rsp
+  805413:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805413 <devsock_close+0xb>
+  80541a:	49 bb 2d 3c 00 00 00 	movabs $0x3c2d,%r11
+  805421:	00 00 00 
+  805424:	4c 01 db             	add    %r11,%rbx
+  805427:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80542b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80542f:	48 89 c7             	mov    %rax,%rdi
+  805432:	49 89 df             	mov    %rbx,%r15
+  805435:	48 b8 23 dc ff ff ff 	movabs $0xffffffffffffdc23,%rax
+  80543c:	ff ff ff 
+  80543f:	48 01 d8             	add    %rbx,%rax
+  805442:	ff d0                	call   *%rax
+  805444:	83 f8 01             	cmp    $0x1,%eax
+  805447:	75 1d                	jne    805466 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805449:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80544d:	8b 40 0c             	mov    0xc(%rax),%eax
+  805450:	89 c7                	mov    %eax,%edi
+  805452:	49 89 df             	mov    %rbx,%r15
+  805455:	48 b8 68 c9 ff ff ff 	movabs $0xffffffffffffc968,%rax
+  80545c:	ff ff ff 
+  80545f:	48 01 d8             	add    %rbx,%rax
+  805462:	ff d0                	call   *%rax
+  805464:	eb 05                	jmp    80546b <devsock_close+0x63>
+	else
+		return 0;
+  805466:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80546b:	48 83 c4 10          	add    $0x10,%rsp
+  80546f:	5b                   	pop    %rbx
+  805470:	41 5f                	pop    %r15
+  805472:	5d                   	pop    %rbp
+  805473:	c3                   	ret
+
+0000000000805474 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805474:	55                   	push   %rbp
+  805475:	48 89 e5             	mov    %rsp,%rbp
+  805478:	41 57                	push   %r15
+  80547a:	53                   	push   %rbx
+  80547b:	48 83 ec 20          	sub    $0x20,%rsp
+  80547f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80547f <connect+0xb>
+  805486:	49 bb c1 3b 00 00 00 	movabs $0x3bc1,%r11
+  80548d:	00 00 00 
+  805490:	4c 01 db             	add    %r11,%rbx
+  805493:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805496:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80549a:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80549d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054a0:	89 c7                	mov    %eax,%edi
+  8054a2:	48 b8 f8 c0 ff ff ff 	movabs $0xffffffffffffc0f8,%rax
+  8054a9:	ff ff ff 
+  8054ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054b0:	ff d0                	call   *%rax
+  8054b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054b9:	79 05                	jns    8054c0 <connect+0x4c>
+		return r;
+  8054bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054be:	eb 21                	jmp    8054e1 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8054c0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8054c3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8054c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054ca:	48 89 ce             	mov    %rcx,%rsi
+  8054cd:	89 c7                	mov    %eax,%edi
+  8054cf:	49 89 df             	mov    %rbx,%r15
+  8054d2:	48 b8 b0 c9 ff ff ff 	movabs $0xffffffffffffc9b0,%rax
+  8054d9:	ff ff ff 
+  8054dc:	48 01 d8             	add    %rbx,%rax
+  8054df:	ff d0                	call   *%rax
+}
+  8054e1:	48 83 c4 20          	add    $0x20,%rsp
+  8054e5:	5b                   	pop    %rbx
+  8054e6:	41 5f                	pop    %r15
+  8054e8:	5d                   	pop    %rbp
+  8054e9:	c3                   	ret
+
+00000000008054ea <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8054ea:	55                   	push   %rbp
+  8054eb:	48 89 e5             	mov    %rsp,%rbp
+  8054ee:	41 57                	push   %r15
+  8054f0:	53                   	push   %rbx
+  8054f1:	48 83 ec 20          	sub    $0x20,%rsp
+  8054f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054f5 <listen+0xb>
+  8054fc:	49 bb 4b 3b 00 00 00 	movabs $0x3b4b,%r11
+  805503:	00 00 00 
+  805506:	4c 01 db             	add    %r11,%rbx
+  805509:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80550c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80550f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805512:	89 c7                	mov    %eax,%edi
+  805514:	48 b8 f8 c0 ff ff ff 	movabs $0xffffffffffffc0f8,%rax
+  80551b:	ff ff ff 
+  80551e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805522:	ff d0                	call   *%rax
+  805524:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805527:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80552b:	79 05                	jns    805532 <listen+0x48>
+		return r;
+  80552d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805530:	eb 1c                	jmp    80554e <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805532:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805535:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805538:	89 d6                	mov    %edx,%esi
+  80553a:	89 c7                	mov    %eax,%edi
+  80553c:	49 89 df             	mov    %rbx,%r15
+  80553f:	48 b8 45 ca ff ff ff 	movabs $0xffffffffffffca45,%rax
+  805546:	ff ff ff 
+  805549:	48 01 d8             	add    %rbx,%rax
+  80554c:	ff d0                	call   *%rax
+}
+  80554e:	48 83 c4 20          	add    $0x20,%rsp
+  805552:	5b                   	pop    %rbx
+  805553:	41 5f                	pop    %r15
+  805555:	5d                   	pop    %rbp
+  805556:	c3                   	ret
+
+0000000000805557 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805557:	55                   	push   %rbp
+  805558:	48 89 e5             	mov    %rsp,%rbp
+  80555b:	41 57                	push   %r15
+  80555d:	48 83 ec 28          	sub    $0x28,%rsp
+  805561:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805561 <devsock_read+0xa>
+  805568:	49 bb df 3a 00 00 00 	movabs $0x3adf,%r11
+  80556f:	00 00 00 
+  805572:	4c 01 d8             	add    %r11,%rax
+  805575:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805579:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80557d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805581:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805585:	41 89 d0             	mov    %edx,%r8d
+  805588:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80558c:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80558f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805593:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805598:	44 89 c2             	mov    %r8d,%edx
+  80559b:	49 89 c7             	mov    %rax,%r15
+  80559e:	49 b8 96 ca ff ff ff 	movabs $0xffffffffffffca96,%r8
+  8055a5:	ff ff ff 
+  8055a8:	49 01 c0             	add    %rax,%r8
+  8055ab:	41 ff d0             	call   *%r8
+}
+  8055ae:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8055b2:	c9                   	leave
+  8055b3:	c3                   	ret
+
+00000000008055b4 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8055b4:	55                   	push   %rbp
+  8055b5:	48 89 e5             	mov    %rsp,%rbp
+  8055b8:	41 57                	push   %r15
+  8055ba:	48 83 ec 28          	sub    $0x28,%rsp
+  8055be:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055be <devsock_write+0xa>
+  8055c5:	49 bb 82 3a 00 00 00 	movabs $0x3a82,%r11
+  8055cc:	00 00 00 
+  8055cf:	4c 01 d8             	add    %r11,%rax
+  8055d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8055d6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8055da:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8055de:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8055e2:	41 89 d0             	mov    %edx,%r8d
+  8055e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8055e9:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8055ec:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8055f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055f5:	44 89 c2             	mov    %r8d,%edx
+  8055f8:	49 89 c7             	mov    %rax,%r15
+  8055fb:	49 b8 b3 cb ff ff ff 	movabs $0xffffffffffffcbb3,%r8
+  805602:	ff ff ff 
+  805605:	49 01 c0             	add    %rax,%r8
+  805608:	41 ff d0             	call   *%r8
+}
+  80560b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80560f:	c9                   	leave
+  805610:	c3                   	ret
+
+0000000000805611 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805611:	55                   	push   %rbp
+  805612:	48 89 e5             	mov    %rsp,%rbp
+  805615:	41 57                	push   %r15
+  805617:	48 83 ec 18          	sub    $0x18,%rsp
+  80561b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80561b <devsock_stat+0xa>
+  805622:	49 bb 25 3a 00 00 00 	movabs $0x3a25,%r11
+  805629:	00 00 00 
+  80562c:	4c 01 d8             	add    %r11,%rax
+  80562f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805633:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805637:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80563b:	48 b9 54 e3 ff ff ff 	movabs $0xffffffffffffe354,%rcx
+  805642:	ff ff ff 
+  805645:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805649:	48 89 ce             	mov    %rcx,%rsi
+  80564c:	48 89 d7             	mov    %rdx,%rdi
+  80564f:	49 89 c7             	mov    %rax,%r15
+  805652:	48 ba 82 82 ff ff ff 	movabs $0xffffffffffff8282,%rdx
+  805659:	ff ff ff 
+  80565c:	48 01 c2             	add    %rax,%rdx
+  80565f:	ff d2                	call   *%rdx
+	return 0;
+  805661:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805666:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80566a:	c9                   	leave
+  80566b:	c3                   	ret
+
+000000000080566c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80566c:	55                   	push   %rbp
+  80566d:	48 89 e5             	mov    %rsp,%rbp
+  805670:	41 57                	push   %r15
+  805672:	53                   	push   %rbx
+  805673:	48 83 ec 20          	sub    $0x20,%rsp
+  805677:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805677 <socket+0xb>
+  80567e:	49 bb c9 39 00 00 00 	movabs $0x39c9,%r11
+  805685:	00 00 00 
+  805688:	4c 01 db             	add    %r11,%rbx
+  80568b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80568e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805691:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805694:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805697:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80569a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80569d:	89 ce                	mov    %ecx,%esi
+  80569f:	89 c7                	mov    %eax,%edi
+  8056a1:	49 89 df             	mov    %rbx,%r15
+  8056a4:	48 b8 8a cd ff ff ff 	movabs $0xffffffffffffcd8a,%rax
+  8056ab:	ff ff ff 
+  8056ae:	48 01 d8             	add    %rbx,%rax
+  8056b1:	ff d0                	call   *%rax
+  8056b3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056b6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056ba:	79 05                	jns    8056c1 <socket+0x55>
+		return r;
+  8056bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056bf:	eb 15                	jmp    8056d6 <socket+0x6a>
+	return alloc_sockfd(r);
+  8056c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056c4:	89 c7                	mov    %eax,%edi
+  8056c6:	48 b8 74 c1 ff ff ff 	movabs $0xffffffffffffc174,%rax
+  8056cd:	ff ff ff 
+  8056d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056d4:	ff d0                	call   *%rax
+}
+  8056d6:	48 83 c4 20          	add    $0x20,%rsp
+  8056da:	5b                   	pop    %rbx
+  8056db:	41 5f                	pop    %r15
+  8056dd:	5d                   	pop    %rbp
+  8056de:	c3                   	ret
+
+00000000008056df <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8056df:	55                   	push   %rbp
+  8056e0:	48 89 e5             	mov    %rsp,%rbp
+  8056e3:	41 57                	push   %r15
+  8056e5:	53                   	push   %rbx
+  8056e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8056ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056ea <nsipc+0xb>
+  8056f1:	49 bb 56 39 00 00 00 	movabs $0x3956,%r11
+  8056f8:	00 00 00 
+  8056fb:	4c 01 db             	add    %r11,%rbx
+  8056fe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805701:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805708:	00 00 00 
+  80570b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80570e:	85 c0                	test   %eax,%eax
+  805710:	75 24                	jne    805736 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805712:	bf 02 00 00 00       	mov    $0x2,%edi
+  805717:	49 89 df             	mov    %rbx,%r15
+  80571a:	48 b8 b0 a9 ff ff ff 	movabs $0xffffffffffffa9b0,%rax
+  805721:	ff ff ff 
+  805724:	48 01 d8             	add    %rbx,%rax
+  805727:	ff d0                	call   *%rax
+  805729:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805730:	00 00 00 
+  805733:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805736:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80573d:	00 00 00 
+  805740:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805743:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805746:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80574c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805752:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805757:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80575e:	00 00 00 
+  805761:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805765:	89 c7                	mov    %eax,%edi
+  805767:	49 89 df             	mov    %rbx,%r15
+  80576a:	48 b8 cf a3 ff ff ff 	movabs $0xffffffffffffa3cf,%rax
+  805771:	ff ff ff 
+  805774:	48 01 d8             	add    %rbx,%rax
+  805777:	ff d0                	call   *%rax
+}
+  805779:	48 83 c4 10          	add    $0x10,%rsp
+  80577d:	5b                   	pop    %rbx
+  80577e:	41 5f                	pop    %r15
+  805780:	5d                   	pop    %rbp
+  805781:	c3                   	ret
+
+0000000000805782 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805782:	55                   	push   %rbp
+  805783:	48 89 e5             	mov    %rsp,%rbp
+  805786:	41 57                	push   %r15
+  805788:	53                   	push   %rbx
+  805789:	48 83 ec 20          	sub    $0x20,%rsp
+  80578d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80578d <nsipc_words+0xb>
+  805794:	49 bb b3 38 00 00 00 	movabs $0x38b3,%r11
+  80579b:	00 00 00 
+  80579e:	4c 01 db             	add    %r11,%rbx
+  8057a1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8057a4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8057a8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8057ac:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8057b3:	00 00 00 
+  8057b6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8057b9:	85 c0                	test   %eax,%eax
+  8057bb:	75 24                	jne    8057e1 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8057bd:	bf 02 00 00 00       	mov    $0x2,%edi
+  8057c2:	49 89 df             	mov    %rbx,%r15
+  8057c5:	48 b8 b0 a9 ff ff ff 	movabs $0xffffffffffffa9b0,%rax
+  8057cc:	ff ff ff 
+  8057cf:	48 01 d8             	add    %rbx,%rax
+  8057d2:	ff d0                	call   *%rax
+  8057d4:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8057db:	00 00 00 
+  8057de:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8057e1:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8057e8:	00 00 00 
+  8057eb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8057ee:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8057f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8057f6:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8057f9:	89 c7                	mov    %eax,%edi
+  8057fb:	49 89 df             	mov    %rbx,%r15
+  8057fe:	48 b8 ba a4 ff ff ff 	movabs $0xffffffffffffa4ba,%rax
+  805805:	ff ff ff 
+  805808:	48 01 d8             	add    %rbx,%rax
+  80580b:	ff d0                	call   *%rax
+}
+  80580d:	48 83 c4 20          	add    $0x20,%rsp
+  805811:	5b                   	pop    %rbx
+  805812:	41 5f                	pop    %r15
+  805814:	5d                   	pop    %rbp
+  805815:	c3                   	ret
+
+0000000000805816 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805816:	55                   	push   %rbp
+  805817:	48 89 e5             	mov    %rsp,%rbp
+  80581a:	41 57                	push   %r15
+  80581c:	53                   	push   %rbx
+  80581d:	48 83 ec 30          	sub    $0x30,%rsp
+  805821:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805821 <nsipc_accept+0xb>
+  805828:	49 bb 1f 38 00 00 00 	movabs $0x381f,%r11
+  80582f:	00 00 00 
+  805832:	4c 01 db             	add    %r11,%rbx
+  805835:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805838:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80583c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805840:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805847:	00 00 00 
+  80584a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80584d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805850:	bf 01 00 00 00       	mov    $0x1,%edi
+  805855:	48 b8 9f c6 ff ff ff 	movabs $0xffffffffffffc69f,%rax
+  80585c:	ff ff ff 
+  80585f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805863:	ff d0                	call   *%rax
+  805865:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805868:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80586c:	78 48                	js     8058b6 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80586e:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805875:	00 00 00 
+  805878:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80587c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805880:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805884:	8b 40 10             	mov    0x10(%rax),%eax
+  805887:	89 c2                	mov    %eax,%edx
+  805889:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80588d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805891:	48 89 ce             	mov    %rcx,%rsi
+  805894:	48 89 c7             	mov    %rax,%rdi
+  805897:	49 89 df             	mov    %rbx,%r15
+  80589a:	48 b8 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rax
+  8058a1:	ff ff ff 
+  8058a4:	48 01 d8             	add    %rbx,%rax
+  8058a7:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8058a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058ad:	8b 50 10             	mov    0x10(%rax),%edx
+  8058b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8058b4:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8058b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8058b9:	48 83 c4 30          	add    $0x30,%rsp
+  8058bd:	5b                   	pop    %rbx
+  8058be:	41 5f                	pop    %r15
+  8058c0:	5d                   	pop    %rbp
+  8058c1:	c3                   	ret
+
+00000000008058c2 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8058c2:	55                   	push   %rbp
+  8058c3:	48 89 e5             	mov    %rsp,%rbp
+  8058c6:	41 57                	push   %r15
+  8058c8:	53                   	push   %rbx
+  8058c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8058cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058cd <nsipc_bind+0xb>
+  8058d4:	49 bb 73 37 00 00 00 	movabs $0x3773,%r11
+  8058db:	00 00 00 
+  8058de:	4c 01 db             	add    %r11,%rbx
+  8058e1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8058e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8058e8:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8058eb:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8058f2:	00 00 00 
+  8058f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058f8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8058fb:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8058fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805902:	48 89 c6             	mov    %rax,%rsi
+  805905:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  80590c:	00 00 00 
+  80590f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805913:	48 89 c7             	mov    %rax,%rdi
+  805916:	49 89 df             	mov    %rbx,%r15
+  805919:	48 b8 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rax
+  805920:	ff ff ff 
+  805923:	48 01 d8             	add    %rbx,%rax
+  805926:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805928:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80592f:	00 00 00 
+  805932:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805935:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805939:	bf 02 00 00 00       	mov    $0x2,%edi
+  80593e:	48 b8 9f c6 ff ff ff 	movabs $0xffffffffffffc69f,%rax
+  805945:	ff ff ff 
+  805948:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80594c:	ff d0                	call   *%rax
+}
+  80594e:	48 83 c4 10          	add    $0x10,%rsp
+  805952:	5b                   	pop    %rbx
+  805953:	41 5f                	pop    %r15
+  805955:	5d                   	pop    %rbp
+  805956:	c3                   	ret
+
+0000000000805957 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805957:	55                   	push   %rbp
+  805958:	48 89 e5             	mov    %rsp,%rbp
+  80595b:	48 83 ec 20          	sub    $0x20,%rsp
+  80595f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80595f <nsipc_shutdown+0x8>
+  805966:	49 bb e1 36 00 00 00 	movabs $0x36e1,%r11
+  80596d:	00 00 00 
+  805970:	4c 01 d8             	add    %r11,%rax
+  805973:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805976:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805979:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80597c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  80597f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805982:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805985:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805989:	ba 08 00 00 00       	mov    $0x8,%edx
+  80598e:	48 89 ce             	mov    %rcx,%rsi
+  805991:	bf 03 00 00 00       	mov    $0x3,%edi
+  805996:	48 b9 42 c7 ff ff ff 	movabs $0xffffffffffffc742,%rcx
+  80599d:	ff ff ff 
+  8059a0:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8059a4:	ff d0                	call   *%rax
+}
+  8059a6:	c9                   	leave
+  8059a7:	c3                   	ret
+
+00000000008059a8 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8059a8:	55                   	push   %rbp
+  8059a9:	48 89 e5             	mov    %rsp,%rbp
+  8059ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8059b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8059b0 <nsipc_close+0x8>
+  8059b7:	49 bb 90 36 00 00 00 	movabs $0x3690,%r11
+  8059be:	00 00 00 
+  8059c1:	4c 01 d8             	add    %r11,%rax
+  8059c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8059c7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8059ca:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8059cd:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8059d1:	ba 04 00 00 00       	mov    $0x4,%edx
+  8059d6:	48 89 ce             	mov    %rcx,%rsi
+  8059d9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8059de:	48 b9 42 c7 ff ff ff 	movabs $0xffffffffffffc742,%rcx
+  8059e5:	ff ff ff 
+  8059e8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8059ec:	ff d0                	call   *%rax
+}
+  8059ee:	c9                   	leave
+  8059ef:	c3                   	ret
+
+00000000008059f0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8059f0:	55                   	push   %rbp
+  8059f1:	48 89 e5             	mov    %rsp,%rbp
+  8059f4:	41 57                	push   %r15
+  8059f6:	53                   	push   %rbx
+  8059f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8059fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059fb <nsipc_connect+0xb>
+  805a02:	49 bb 45 36 00 00 00 	movabs $0x3645,%r11
+  805a09:	00 00 00 
+  805a0c:	4c 01 db             	add    %r11,%rbx
+  805a0f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a12:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805a16:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805a19:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805a20:	00 00 00 
+  805a23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a26:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805a29:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a2c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a30:	48 89 c6             	mov    %rax,%rsi
+  805a33:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805a3a:	00 00 00 
+  805a3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a41:	48 89 c7             	mov    %rax,%rdi
+  805a44:	49 89 df             	mov    %rbx,%r15
+  805a47:	48 b8 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rax
+  805a4e:	ff ff ff 
+  805a51:	48 01 d8             	add    %rbx,%rax
+  805a54:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805a56:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805a5d:	00 00 00 
+  805a60:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a63:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805a67:	bf 05 00 00 00       	mov    $0x5,%edi
+  805a6c:	48 b8 9f c6 ff ff ff 	movabs $0xffffffffffffc69f,%rax
+  805a73:	ff ff ff 
+  805a76:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a7a:	ff d0                	call   *%rax
+}
+  805a7c:	48 83 c4 10          	add    $0x10,%rsp
+  805a80:	5b                   	pop    %rbx
+  805a81:	41 5f                	pop    %r15
+  805a83:	5d                   	pop    %rbp
+  805a84:	c3                   	ret
+
+0000000000805a85 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805a85:	55                   	push   %rbp
+  805a86:	48 89 e5             	mov    %rsp,%rbp
+  805a89:	48 83 ec 20          	sub    $0x20,%rsp
+  805a8d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a8d <nsipc_listen+0x8>
+  805a94:	49 bb b3 35 00 00 00 	movabs $0x35b3,%r11
+  805a9b:	00 00 00 
+  805a9e:	4c 01 d8             	add    %r11,%rax
+  805aa1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805aa4:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805aa7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805aaa:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805aad:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805ab0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805ab3:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805ab7:	ba 08 00 00 00       	mov    $0x8,%edx
+  805abc:	48 89 ce             	mov    %rcx,%rsi
+  805abf:	bf 06 00 00 00       	mov    $0x6,%edi
+  805ac4:	48 b9 42 c7 ff ff ff 	movabs $0xffffffffffffc742,%rcx
+  805acb:	ff ff ff 
+  805ace:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805ad2:	ff d0                	call   *%rax
+}
+  805ad4:	c9                   	leave
+  805ad5:	c3                   	ret
+
+0000000000805ad6 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805ad6:	55                   	push   %rbp
+  805ad7:	48 89 e5             	mov    %rsp,%rbp
+  805ada:	41 57                	push   %r15
+  805adc:	53                   	push   %rbx
+  805add:	48 83 ec 30          	sub    $0x30,%rsp
+  805ae1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ae1 <nsipc_recv+0xb>
+  805ae8:	49 bb 5f 35 00 00 00 	movabs $0x355f,%r11
+  805aef:	00 00 00 
+  805af2:	4c 01 db             	add    %r11,%rbx
+  805af5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805af8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805afc:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805aff:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805b02:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b09:	00 00 00 
+  805b0c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b0f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805b12:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b19:	00 00 00 
+  805b1c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805b1f:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805b23:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b2a:	00 00 00 
+  805b2d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805b30:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805b34:	bf 07 00 00 00       	mov    $0x7,%edi
+  805b39:	48 b8 9f c6 ff ff ff 	movabs $0xffffffffffffc69f,%rax
+  805b40:	ff ff ff 
+  805b43:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b47:	ff d0                	call   *%rax
+  805b49:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b4c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b50:	0f 88 91 00 00 00    	js     805be7 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805b56:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805b5d:	7f 08                	jg     805b67 <nsipc_recv+0x91>
+  805b5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b62:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805b65:	7e 50                	jle    805bb7 <nsipc_recv+0xe1>
+  805b67:	48 b8 5b e3 ff ff ff 	movabs $0xffffffffffffe35b,%rax
+  805b6e:	ff ff ff 
+  805b71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b75:	48 89 c1             	mov    %rax,%rcx
+  805b78:	48 b8 70 e3 ff ff ff 	movabs $0xffffffffffffe370,%rax
+  805b7f:	ff ff ff 
+  805b82:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b86:	48 89 c2             	mov    %rax,%rdx
+  805b89:	be 79 00 00 00       	mov    $0x79,%esi
+  805b8e:	48 b8 85 e3 ff ff ff 	movabs $0xffffffffffffe385,%rax
+  805b95:	ff ff ff 
+  805b98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b9c:	48 89 c7             	mov    %rax,%rdi
+  805b9f:	49 89 df             	mov    %rbx,%r15
+  805ba2:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ba7:	49 b8 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%r8
+  805bae:	ff ff ff 
+  805bb1:	49 01 d8             	add    %rbx,%r8
+  805bb4:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805bb7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bba:	48 63 d0             	movslq %eax,%rdx
+  805bbd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bc1:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805bc8:	00 00 00 
+  805bcb:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805bcf:	48 89 ce             	mov    %rcx,%rsi
+  805bd2:	48 89 c7             	mov    %rax,%rdi
+  805bd5:	49 89 df             	mov    %rbx,%r15
+  805bd8:	48 b8 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rax
+  805bdf:	ff ff ff 
+  805be2:	48 01 d8             	add    %rbx,%rax
+  805be5:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805be7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805bea:	48 83 c4 30          	add    $0x30,%rsp
+  805bee:	5b                   	pop    %rbx
+  805bef:	41 5f                	pop    %r15
+  805bf1:	5d                   	pop    %rbp
+  805bf2:	c3                   	ret
+
+0000000000805bf3 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805bf3:	55                   	push   %rbp
+  805bf4:	48 89 e5             	mov    %rsp,%rbp
+  805bf7:	41 57                	push   %r15
+  805bf9:	53                   	push   %rbx
+  805bfa:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805c01:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c01 <nsipc_send+0xe>
+  805c08:	49 bb 3f 34 00 00 00 	movabs $0x343f,%r11
+  805c0f:	00 00 00 
+  805c12:	4c 01 db             	add    %r11,%rbx
+  805c15:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805c1b:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805c22:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805c28:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805c2e:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805c32:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805c36:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805c3d:	00 00 00 
+  805c40:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805c43:	85 c0                	test   %eax,%eax
+  805c45:	75 24                	jne    805c6b <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805c47:	bf 02 00 00 00       	mov    $0x2,%edi
+  805c4c:	49 89 df             	mov    %rbx,%r15
+  805c4f:	48 b8 b0 a9 ff ff ff 	movabs $0xffffffffffffa9b0,%rax
+  805c56:	ff ff ff 
+  805c59:	48 01 d8             	add    %rbx,%rax
+  805c5c:	ff d0                	call   *%rax
+  805c5e:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805c65:	00 00 00 
+  805c68:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805c6b:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805c71:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805c74:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805c7b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805c7e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805c81:	39 c2                	cmp    %eax,%edx
+  805c83:	0f 4e c2             	cmovle %edx,%eax
+  805c86:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805c8c:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805c92:	48 63 d0             	movslq %eax,%rdx
+  805c95:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805c9c:	48 89 c6             	mov    %rax,%rsi
+  805c9f:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805ca6:	00 00 00 
+  805ca9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cad:	48 89 c7             	mov    %rax,%rdi
+  805cb0:	49 89 df             	mov    %rbx,%r15
+  805cb3:	48 b8 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rax
+  805cba:	ff ff ff 
+  805cbd:	48 01 d8             	add    %rbx,%rax
+  805cc0:	ff d0                	call   *%rax
+	req->req_s = s;
+  805cc2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cc6:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805ccc:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805cce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cd2:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805cd8:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805cdb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cdf:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805ce5:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805ce8:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805cef:	00 00 00 
+  805cf2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cf6:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805cfa:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805d01:	00 
+  805d02:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805d08:	48 63 d0             	movslq %eax,%rdx
+  805d0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d0f:	48 01 d0             	add    %rdx,%rax
+  805d12:	48 83 e8 01          	sub    $0x1,%rax
+  805d16:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805d1a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d23:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805d27:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805d2b:	48 29 d0             	sub    %rdx,%rax
+  805d2e:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805d34:	85 c0                	test   %eax,%eax
+  805d36:	0f 48 c2             	cmovs  %edx,%eax
+  805d39:	c1 f8 0c             	sar    $0xc,%eax
+  805d3c:	48 98                	cltq
+  805d3e:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805d42:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805d46:	48 85 c0             	test   %rax,%rax
+  805d49:	0f 95 c0             	setne  %al
+  805d4c:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805d4f:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  805d56:	00 
+  805d57:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d5b:	48 83 c0 0b          	add    $0xb,%rax
+  805d5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805d63:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d6c:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805d70:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d74:	48 29 d0             	sub    %rdx,%rax
+  805d77:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805d7b:	89 c7                	mov    %eax,%edi
+  805d7d:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805d84:	00 00 00 
+  805d87:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805d8a:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805d8e:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805d92:	48 83 ec 08          	sub    $0x8,%rsp
+  805d96:	6a 00                	push   $0x0
+  805d98:	6a 00                	push   $0x0
+  805d9a:	6a 05                	push   $0x5
+  805d9c:	41 89 f1             	mov    %esi,%r9d
+  805d9f:	49 89 c8             	mov    %rcx,%r8
+  805da2:	89 f9                	mov    %edi,%ecx
+  805da4:	be 08 00 00 00       	mov    $0x8,%esi
+  805da9:	89 c7                	mov    %eax,%edi
+  805dab:	49 89 df             	mov    %rbx,%r15
+  805dae:	48 b8 b8 a5 ff ff ff 	movabs $0xffffffffffffa5b8,%rax
+  805db5:	ff ff ff 
+  805db8:	48 01 d8             	add    %rbx,%rax
+  805dbb:	ff d0                	call   *%rax
+  805dbd:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805dc1:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805dc5:	5b                   	pop    %rbx
+  805dc6:	41 5f                	pop    %r15
+  805dc8:	5d                   	pop    %rbp
+  805dc9:	c3                   	ret
+
+0000000000805dca <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805dca:	55                   	push   %rbp
+  805dcb:	48 89 e5             	mov    %rsp,%rbp
+  805dce:	48 83 ec 10          	sub    $0x10,%rsp
+  805dd2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805dd2 <nsipc_socket+0x8>
+  805dd9:	49 bb 6e 32 00 00 00 	movabs $0x326e,%r11
+  805de0:	00 00 00 
+  805de3:	4c 01 d8             	add    %r11,%rax
+  805de6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805de9:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805dec:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805def:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805df6:	00 00 00 
+  805df9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805dfc:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805dff:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805e06:	00 00 00 
+  805e09:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805e0c:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805e10:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805e17:	00 00 00 
+  805e1a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805e1d:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805e21:	bf 09 00 00 00       	mov    $0x9,%edi
+  805e26:	48 ba 9f c6 ff ff ff 	movabs $0xffffffffffffc69f,%rdx
+  805e2d:	ff ff ff 
+  805e30:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805e34:	ff d0                	call   *%rax
+}
+  805e36:	c9                   	leave
+  805e37:	c3                   	ret
+
+0000000000805e38 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805e38:	55                   	push   %rbp
+  805e39:	48 89 e5             	mov    %rsp,%rbp
+  805e3c:	41 57                	push   %r15
+  805e3e:	53                   	push   %rbx
+  805e3f:	48 83 ec 30          	sub    $0x30,%rsp
+  805e43:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e43 <pipe+0xb>
+  805e4a:	49 bb fd 31 00 00 00 	movabs $0x31fd,%r11
+  805e51:	00 00 00 
+  805e54:	4c 01 db             	add    %r11,%rbx
+  805e57:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805e5b:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805e5f:	48 89 c7             	mov    %rax,%rdi
+  805e62:	49 89 df             	mov    %rbx,%r15
+  805e65:	48 b8 b9 aa ff ff ff 	movabs $0xffffffffffffaab9,%rax
+  805e6c:	ff ff ff 
+  805e6f:	48 01 d8             	add    %rbx,%rax
+  805e72:	ff d0                	call   *%rax
+  805e74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e77:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e7b:	0f 88 12 02 00 00    	js     806093 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805e81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e85:	ba 07 04 00 00       	mov    $0x407,%edx
+  805e8a:	48 89 c6             	mov    %rax,%rsi
+  805e8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e92:	49 89 df             	mov    %rbx,%r15
+  805e95:	48 b8 3e 8f ff ff ff 	movabs $0xffffffffffff8f3e,%rax
+  805e9c:	ff ff ff 
+  805e9f:	48 01 d8             	add    %rbx,%rax
+  805ea2:	ff d0                	call   *%rax
+  805ea4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ea7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805eab:	0f 88 e2 01 00 00    	js     806093 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805eb1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805eb5:	48 89 c7             	mov    %rax,%rdi
+  805eb8:	49 89 df             	mov    %rbx,%r15
+  805ebb:	48 b8 b9 aa ff ff ff 	movabs $0xffffffffffffaab9,%rax
+  805ec2:	ff ff ff 
+  805ec5:	48 01 d8             	add    %rbx,%rax
+  805ec8:	ff d0                	call   *%rax
+  805eca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ecd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ed1:	0f 88 9b 01 00 00    	js     806072 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805ed7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805edb:	ba 07 04 00 00       	mov    $0x407,%edx
+  805ee0:	48 89 c6             	mov    %rax,%rsi
+  805ee3:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ee8:	49 89 df             	mov    %rbx,%r15
+  805eeb:	48 b8 3e 8f ff ff ff 	movabs $0xffffffffffff8f3e,%rax
+  805ef2:	ff ff ff 
+  805ef5:	48 01 d8             	add    %rbx,%rax
+  805ef8:	ff d0                	call   *%rax
+  805efa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805efd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f01:	0f 88 6b 01 00 00    	js     806072 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805f07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f0b:	48 89 c7             	mov    %rax,%rdi
+  805f0e:	49 89 df             	mov    %rbx,%r15
+  805f11:	48 b8 76 aa ff ff ff 	movabs $0xffffffffffffaa76,%rax
+  805f18:	ff ff ff 
+  805f1b:	48 01 d8             	add    %rbx,%rax
+  805f1e:	ff d0                	call   *%rax
+  805f20:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805f24:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f28:	ba 07 04 00 00       	mov    $0x407,%edx
+  805f2d:	48 89 c6             	mov    %rax,%rsi
+  805f30:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f35:	49 89 df             	mov    %rbx,%r15
+  805f38:	48 b8 3e 8f ff ff ff 	movabs $0xffffffffffff8f3e,%rax
+  805f3f:	ff ff ff 
+  805f42:	48 01 d8             	add    %rbx,%rax
+  805f45:	ff d0                	call   *%rax
+  805f47:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f4a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f4e:	0f 88 fd 00 00 00    	js     806051 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805f54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f58:	48 89 c7             	mov    %rax,%rdi
+  805f5b:	49 89 df             	mov    %rbx,%r15
+  805f5e:	48 b8 76 aa ff ff ff 	movabs $0xffffffffffffaa76,%rax
+  805f65:	ff ff ff 
+  805f68:	48 01 d8             	add    %rbx,%rax
+  805f6b:	ff d0                	call   *%rax
+  805f6d:	48 89 c2             	mov    %rax,%rdx
+  805f70:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f74:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805f7a:	48 89 d1             	mov    %rdx,%rcx
+  805f7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f82:	48 89 c6             	mov    %rax,%rsi
+  805f85:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f8a:	49 89 df             	mov    %rbx,%r15
+  805f8d:	48 b8 a3 8f ff ff ff 	movabs $0xffffffffffff8fa3,%rax
+  805f94:	ff ff ff 
+  805f97:	48 01 d8             	add    %rbx,%rax
+  805f9a:	ff d0                	call   *%rax
+  805f9c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f9f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fa3:	0f 88 87 00 00 00    	js     806030 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805fa9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fad:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805fb4:	00 00 00 
+  805fb7:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805fba:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805fbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fc0:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805fc7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fcb:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805fd2:	00 00 00 
+  805fd5:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805fd8:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805fda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fde:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805fe5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fe9:	48 89 c7             	mov    %rax,%rdi
+  805fec:	49 89 df             	mov    %rbx,%r15
+  805fef:	48 b8 3f aa ff ff ff 	movabs $0xffffffffffffaa3f,%rax
+  805ff6:	ff ff ff 
+  805ff9:	48 01 d8             	add    %rbx,%rax
+  805ffc:	ff d0                	call   *%rax
+  805ffe:	89 c2                	mov    %eax,%edx
+  806000:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806004:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  806006:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80600a:	48 89 c7             	mov    %rax,%rdi
+  80600d:	49 89 df             	mov    %rbx,%r15
+  806010:	48 b8 3f aa ff ff ff 	movabs $0xffffffffffffaa3f,%rax
+  806017:	ff ff ff 
+  80601a:	48 01 d8             	add    %rbx,%rax
+  80601d:	ff d0                	call   *%rax
+  80601f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806023:	48 83 c2 04          	add    $0x4,%rdx
+  806027:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  806029:	b8 00 00 00 00       	mov    $0x0,%eax
+  80602e:	eb 67                	jmp    806097 <pipe+0x25f>
+		goto err3;
+  806030:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806031:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806035:	48 89 c6             	mov    %rax,%rsi
+  806038:	bf 00 00 00 00       	mov    $0x0,%edi
+  80603d:	49 89 df             	mov    %rbx,%r15
+  806040:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  806047:	ff ff ff 
+  80604a:	48 01 d8             	add    %rbx,%rax
+  80604d:	ff d0                	call   *%rax
+  80604f:	eb 01                	jmp    806052 <pipe+0x21a>
+		goto err2;
+  806051:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  806052:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806056:	48 89 c6             	mov    %rax,%rsi
+  806059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80605e:	49 89 df             	mov    %rbx,%r15
+  806061:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  806068:	ff ff ff 
+  80606b:	48 01 d8             	add    %rbx,%rax
+  80606e:	ff d0                	call   *%rax
+  806070:	eb 01                	jmp    806073 <pipe+0x23b>
+		goto err1;
+  806072:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806073:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806077:	48 89 c6             	mov    %rax,%rsi
+  80607a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80607f:	49 89 df             	mov    %rbx,%r15
+  806082:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  806089:	ff ff ff 
+  80608c:	48 01 d8             	add    %rbx,%rax
+  80608f:	ff d0                	call   *%rax
+  806091:	eb 01                	jmp    806094 <pipe+0x25c>
+		goto err;
+  806093:	90                   	nop
+err:
+	return r;
+  806094:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806097:	48 83 c4 30          	add    $0x30,%rsp
+  80609b:	5b                   	pop    %rbx
+  80609c:	41 5f                	pop    %r15
+  80609e:	5d                   	pop    %rbp
+  80609f:	c3                   	ret
+
+00000000008060a0 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8060a0:	55                   	push   %rbp
+  8060a1:	48 89 e5             	mov    %rsp,%rbp
+  8060a4:	41 57                	push   %r15
+  8060a6:	41 54                	push   %r12
+  8060a8:	53                   	push   %rbx
+  8060a9:	48 83 ec 28          	sub    $0x28,%rsp
+  8060ad:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060ad <_pipeisclosed+0xd>
+  8060b4:	49 bb 93 2f 00 00 00 	movabs $0x2f93,%r11
+  8060bb:	00 00 00 
+  8060be:	4c 01 db             	add    %r11,%rbx
+  8060c1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8060c5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8060c9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8060d0:	ff ff ff 
+  8060d3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8060d7:	48 8b 00             	mov    (%rax),%rax
+  8060da:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8060e0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8060e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8060e7:	48 89 c7             	mov    %rax,%rdi
+  8060ea:	49 89 df             	mov    %rbx,%r15
+  8060ed:	48 b8 23 dc ff ff ff 	movabs $0xffffffffffffdc23,%rax
+  8060f4:	ff ff ff 
+  8060f7:	48 01 d8             	add    %rbx,%rax
+  8060fa:	ff d0                	call   *%rax
+  8060fc:	41 89 c4             	mov    %eax,%r12d
+  8060ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806103:	48 89 c7             	mov    %rax,%rdi
+  806106:	49 89 df             	mov    %rbx,%r15
+  806109:	48 b8 23 dc ff ff ff 	movabs $0xffffffffffffdc23,%rax
+  806110:	ff ff ff 
+  806113:	48 01 d8             	add    %rbx,%rax
+  806116:	ff d0                	call   *%rax
+  806118:	41 39 c4             	cmp    %eax,%r12d
+  80611b:	0f 94 c0             	sete   %al
+  80611e:	0f b6 c0             	movzbl %al,%eax
+  806121:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806124:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80612b:	ff ff ff 
+  80612e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806132:	48 8b 00             	mov    (%rax),%rax
+  806135:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80613b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80613e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806141:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806144:	75 05                	jne    80614b <_pipeisclosed+0xab>
+			return ret;
+  806146:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806149:	eb 63                	jmp    8061ae <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  80614b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80614e:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806151:	0f 84 72 ff ff ff    	je     8060c9 <_pipeisclosed+0x29>
+  806157:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  80615b:	0f 85 68 ff ff ff    	jne    8060c9 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  806161:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806168:	ff ff ff 
+  80616b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80616f:	48 8b 00             	mov    (%rax),%rax
+  806172:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806178:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80617b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80617e:	89 c6                	mov    %eax,%esi
+  806180:	48 b8 96 e3 ff ff ff 	movabs $0xffffffffffffe396,%rax
+  806187:	ff ff ff 
+  80618a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80618e:	48 89 c7             	mov    %rax,%rdi
+  806191:	49 89 df             	mov    %rbx,%r15
+  806194:	b8 00 00 00 00       	mov    $0x0,%eax
+  806199:	49 b8 c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%r8
+  8061a0:	ff ff ff 
+  8061a3:	49 01 d8             	add    %rbx,%r8
+  8061a6:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8061a9:	e9 1b ff ff ff       	jmp    8060c9 <_pipeisclosed+0x29>
+	}
+}
+  8061ae:	48 83 c4 28          	add    $0x28,%rsp
+  8061b2:	5b                   	pop    %rbx
+  8061b3:	41 5c                	pop    %r12
+  8061b5:	41 5f                	pop    %r15
+  8061b7:	5d                   	pop    %rbp
+  8061b8:	c3                   	ret
+
+00000000008061b9 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8061b9:	55                   	push   %rbp
+  8061ba:	48 89 e5             	mov    %rsp,%rbp
+  8061bd:	41 57                	push   %r15
+  8061bf:	53                   	push   %rbx
+  8061c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8061c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061c4 <pipeisclosed+0xb>
+  8061cb:	49 bb 7c 2e 00 00 00 	movabs $0x2e7c,%r11
+  8061d2:	00 00 00 
+  8061d5:	4c 01 db             	add    %r11,%rbx
+  8061d8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8061db:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8061df:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8061e2:	48 89 d6             	mov    %rdx,%rsi
+  8061e5:	89 c7                	mov    %eax,%edi
+  8061e7:	49 89 df             	mov    %rbx,%r15
+  8061ea:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  8061f1:	ff ff ff 
+  8061f4:	48 01 d8             	add    %rbx,%rax
+  8061f7:	ff d0                	call   *%rax
+  8061f9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806200:	79 05                	jns    806207 <pipeisclosed+0x4e>
+		return r;
+  806202:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806205:	eb 3b                	jmp    806242 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  806207:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80620b:	48 89 c7             	mov    %rax,%rdi
+  80620e:	49 89 df             	mov    %rbx,%r15
+  806211:	48 b8 76 aa ff ff ff 	movabs $0xffffffffffffaa76,%rax
+  806218:	ff ff ff 
+  80621b:	48 01 d8             	add    %rbx,%rax
+  80621e:	ff d0                	call   *%rax
+  806220:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806224:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806228:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80622c:	48 89 d6             	mov    %rdx,%rsi
+  80622f:	48 89 c7             	mov    %rax,%rdi
+  806232:	48 b8 60 d0 ff ff ff 	movabs $0xffffffffffffd060,%rax
+  806239:	ff ff ff 
+  80623c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806240:	ff d0                	call   *%rax
+}
+  806242:	48 83 c4 30          	add    $0x30,%rsp
+  806246:	5b                   	pop    %rbx
+  806247:	41 5f                	pop    %r15
+  806249:	5d                   	pop    %rbp
+  80624a:	c3                   	ret
+
+000000000080624b <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80624b:	55                   	push   %rbp
+  80624c:	48 89 e5             	mov    %rsp,%rbp
+  80624f:	41 57                	push   %r15
+  806251:	53                   	push   %rbx
+  806252:	48 83 ec 40          	sub    $0x40,%rsp
+  806256:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806256 <devpipe_read+0xb>
+  80625d:	49 bb ea 2d 00 00 00 	movabs $0x2dea,%r11
+  806264:	00 00 00 
+  806267:	4c 01 db             	add    %r11,%rbx
+  80626a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80626e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806272:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806276:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80627a:	48 89 c7             	mov    %rax,%rdi
+  80627d:	49 89 df             	mov    %rbx,%r15
+  806280:	48 b8 76 aa ff ff ff 	movabs $0xffffffffffffaa76,%rax
+  806287:	ff ff ff 
+  80628a:	48 01 d8             	add    %rbx,%rax
+  80628d:	ff d0                	call   *%rax
+  80628f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806293:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806297:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80629b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8062a2:	00 
+  8062a3:	e9 a1 00 00 00       	jmp    806349 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8062a8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8062ad:	74 09                	je     8062b8 <devpipe_read+0x6d>
+				return i;
+  8062af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062b3:	e9 9f 00 00 00       	jmp    806357 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8062b8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8062bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8062c0:	48 89 d6             	mov    %rdx,%rsi
+  8062c3:	48 89 c7             	mov    %rax,%rdi
+  8062c6:	48 b8 60 d0 ff ff ff 	movabs $0xffffffffffffd060,%rax
+  8062cd:	ff ff ff 
+  8062d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8062d4:	ff d0                	call   *%rax
+  8062d6:	85 c0                	test   %eax,%eax
+  8062d8:	74 07                	je     8062e1 <devpipe_read+0x96>
+				return 0;
+  8062da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062df:	eb 76                	jmp    806357 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8062e1:	49 89 df             	mov    %rbx,%r15
+  8062e4:	48 b8 e9 8e ff ff ff 	movabs $0xffffffffffff8ee9,%rax
+  8062eb:	ff ff ff 
+  8062ee:	48 01 d8             	add    %rbx,%rax
+  8062f1:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8062f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062f7:	8b 10                	mov    (%rax),%edx
+  8062f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062fd:	8b 40 04             	mov    0x4(%rax),%eax
+  806300:	39 c2                	cmp    %eax,%edx
+  806302:	74 a4                	je     8062a8 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  806304:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806308:	8b 10                	mov    (%rax),%edx
+  80630a:	89 d0                	mov    %edx,%eax
+  80630c:	c1 f8 1f             	sar    $0x1f,%eax
+  80630f:	c1 e8 1b             	shr    $0x1b,%eax
+  806312:	01 c2                	add    %eax,%edx
+  806314:	83 e2 1f             	and    $0x1f,%edx
+  806317:	29 c2                	sub    %eax,%edx
+  806319:	89 d6                	mov    %edx,%esi
+  80631b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80631f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806323:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806327:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80632b:	48 63 c6             	movslq %esi,%rax
+  80632e:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806333:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806335:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806339:	8b 00                	mov    (%rax),%eax
+  80633b:	8d 50 01             	lea    0x1(%rax),%edx
+  80633e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806342:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806344:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806349:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80634d:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806351:	72 a0                	jb     8062f3 <devpipe_read+0xa8>
+	}
+	return i;
+  806353:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806357:	48 83 c4 40          	add    $0x40,%rsp
+  80635b:	5b                   	pop    %rbx
+  80635c:	41 5f                	pop    %r15
+  80635e:	5d                   	pop    %rbp
+  80635f:	c3                   	ret
+
+0000000000806360 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806360:	55                   	push   %rbp
+  806361:	48 89 e5             	mov    %rsp,%rbp
+  806364:	41 57                	push   %r15
+  806366:	53                   	push   %rbx
+  806367:	48 83 ec 40          	sub    $0x40,%rsp
+  80636b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80636b <devpipe_write+0xb>
+  806372:	49 bb d5 2c 00 00 00 	movabs $0x2cd5,%r11
+  806379:	00 00 00 
+  80637c:	4c 01 db             	add    %r11,%rbx
+  80637f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806383:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806387:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80638b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80638f:	48 89 c7             	mov    %rax,%rdi
+  806392:	49 89 df             	mov    %rbx,%r15
+  806395:	48 b8 76 aa ff ff ff 	movabs $0xffffffffffffaa76,%rax
+  80639c:	ff ff ff 
+  80639f:	48 01 d8             	add    %rbx,%rax
+  8063a2:	ff d0                	call   *%rax
+  8063a4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8063a8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8063ac:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8063b0:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8063b7:	00 
+  8063b8:	e9 a0 00 00 00       	jmp    80645d <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8063bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8063c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063c5:	48 89 d6             	mov    %rdx,%rsi
+  8063c8:	48 89 c7             	mov    %rax,%rdi
+  8063cb:	48 b8 60 d0 ff ff ff 	movabs $0xffffffffffffd060,%rax
+  8063d2:	ff ff ff 
+  8063d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063d9:	ff d0                	call   *%rax
+  8063db:	85 c0                	test   %eax,%eax
+  8063dd:	74 0a                	je     8063e9 <devpipe_write+0x89>
+				return 0;
+  8063df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063e4:	e9 82 00 00 00       	jmp    80646b <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8063e9:	49 89 df             	mov    %rbx,%r15
+  8063ec:	48 b8 e9 8e ff ff ff 	movabs $0xffffffffffff8ee9,%rax
+  8063f3:	ff ff ff 
+  8063f6:	48 01 d8             	add    %rbx,%rax
+  8063f9:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8063fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063ff:	8b 40 04             	mov    0x4(%rax),%eax
+  806402:	48 63 d0             	movslq %eax,%rdx
+  806405:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806409:	8b 00                	mov    (%rax),%eax
+  80640b:	48 98                	cltq
+  80640d:	48 83 c0 20          	add    $0x20,%rax
+  806411:	48 39 c2             	cmp    %rax,%rdx
+  806414:	73 a7                	jae    8063bd <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806416:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80641a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80641e:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806422:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806426:	8b 50 04             	mov    0x4(%rax),%edx
+  806429:	89 d0                	mov    %edx,%eax
+  80642b:	c1 f8 1f             	sar    $0x1f,%eax
+  80642e:	c1 e8 1b             	shr    $0x1b,%eax
+  806431:	01 c2                	add    %eax,%edx
+  806433:	83 e2 1f             	and    $0x1f,%edx
+  806436:	29 c2                	sub    %eax,%edx
+  806438:	89 d0                	mov    %edx,%eax
+  80643a:	0f b6 09             	movzbl (%rcx),%ecx
+  80643d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806441:	48 98                	cltq
+  806443:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806447:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80644b:	8b 40 04             	mov    0x4(%rax),%eax
+  80644e:	8d 50 01             	lea    0x1(%rax),%edx
+  806451:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806455:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806458:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80645d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806461:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806465:	72 94                	jb     8063fb <devpipe_write+0x9b>
+	}
+
+	return i;
+  806467:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80646b:	48 83 c4 40          	add    $0x40,%rsp
+  80646f:	5b                   	pop    %rbx
+  806470:	41 5f                	pop    %r15
+  806472:	5d                   	pop    %rbp
+  806473:	c3                   	ret
+
+0000000000806474 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806474:	55                   	push   %rbp
+  806475:	48 89 e5             	mov    %rsp,%rbp
+  806478:	41 57                	push   %r15
+  80647a:	53                   	push   %rbx
+  80647b:	48 83 ec 20          	sub    $0x20,%rsp
+  80647f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80647f <devpipe_stat+0xb>
+  806486:	49 bb c1 2b 00 00 00 	movabs $0x2bc1,%r11
+  80648d:	00 00 00 
+  806490:	4c 01 db             	add    %r11,%rbx
+  806493:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806497:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80649b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80649f:	48 89 c7             	mov    %rax,%rdi
+  8064a2:	49 89 df             	mov    %rbx,%r15
+  8064a5:	48 b8 76 aa ff ff ff 	movabs $0xffffffffffffaa76,%rax
+  8064ac:	ff ff ff 
+  8064af:	48 01 d8             	add    %rbx,%rax
+  8064b2:	ff d0                	call   *%rax
+  8064b4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8064b8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064bc:	48 ba a9 e3 ff ff ff 	movabs $0xffffffffffffe3a9,%rdx
+  8064c3:	ff ff ff 
+  8064c6:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8064ca:	48 89 d6             	mov    %rdx,%rsi
+  8064cd:	48 89 c7             	mov    %rax,%rdi
+  8064d0:	49 89 df             	mov    %rbx,%r15
+  8064d3:	48 b8 82 82 ff ff ff 	movabs $0xffffffffffff8282,%rax
+  8064da:	ff ff ff 
+  8064dd:	48 01 d8             	add    %rbx,%rax
+  8064e0:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8064e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8064e6:	8b 50 04             	mov    0x4(%rax),%edx
+  8064e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8064ed:	8b 00                	mov    (%rax),%eax
+  8064ef:	29 c2                	sub    %eax,%edx
+  8064f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064f5:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8064fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064ff:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806506:	00 00 00 
+	stat->st_dev = &devpipe;
+  806509:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80650d:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806514:	00 00 00 
+  806517:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80651b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806522:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806527:	48 83 c4 20          	add    $0x20,%rsp
+  80652b:	5b                   	pop    %rbx
+  80652c:	41 5f                	pop    %r15
+  80652e:	5d                   	pop    %rbp
+  80652f:	c3                   	ret
+
+0000000000806530 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806530:	55                   	push   %rbp
+  806531:	48 89 e5             	mov    %rsp,%rbp
+  806534:	41 57                	push   %r15
+  806536:	53                   	push   %rbx
+  806537:	48 83 ec 10          	sub    $0x10,%rsp
+  80653b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80653b <devpipe_close+0xb>
+  806542:	49 bb 05 2b 00 00 00 	movabs $0x2b05,%r11
+  806549:	00 00 00 
+  80654c:	4c 01 db             	add    %r11,%rbx
+  80654f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806553:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806557:	48 89 c6             	mov    %rax,%rsi
+  80655a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80655f:	49 89 df             	mov    %rbx,%r15
+  806562:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  806569:	ff ff ff 
+  80656c:	48 01 d8             	add    %rbx,%rax
+  80656f:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  806571:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806575:	48 89 c7             	mov    %rax,%rdi
+  806578:	49 89 df             	mov    %rbx,%r15
+  80657b:	48 b8 76 aa ff ff ff 	movabs $0xffffffffffffaa76,%rax
+  806582:	ff ff ff 
+  806585:	48 01 d8             	add    %rbx,%rax
+  806588:	ff d0                	call   *%rax
+  80658a:	48 89 c6             	mov    %rax,%rsi
+  80658d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806592:	49 89 df             	mov    %rbx,%r15
+  806595:	48 b8 16 90 ff ff ff 	movabs $0xffffffffffff9016,%rax
+  80659c:	ff ff ff 
+  80659f:	48 01 d8             	add    %rbx,%rax
+  8065a2:	ff d0                	call   *%rax
+}
+  8065a4:	48 83 c4 10          	add    $0x10,%rsp
+  8065a8:	5b                   	pop    %rbx
+  8065a9:	41 5f                	pop    %r15
+  8065ab:	5d                   	pop    %rbp
+  8065ac:	c3                   	ret
+
+00000000008065ad <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8065ad:	55                   	push   %rbp
+  8065ae:	48 89 e5             	mov    %rsp,%rbp
+  8065b1:	41 57                	push   %r15
+  8065b3:	48 83 ec 28          	sub    $0x28,%rsp
+  8065b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8065b7 <cputchar+0xa>
+  8065be:	49 bb 89 2a 00 00 00 	movabs $0x2a89,%r11
+  8065c5:	00 00 00 
+  8065c8:	4c 01 d8             	add    %r11,%rax
+  8065cb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8065ce:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8065d1:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8065d4:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8065d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8065dd:	48 89 d7             	mov    %rdx,%rdi
+  8065e0:	49 89 c7             	mov    %rax,%r15
+  8065e3:	48 ba 86 8d ff ff ff 	movabs $0xffffffffffff8d86,%rdx
+  8065ea:	ff ff ff 
+  8065ed:	48 01 c2             	add    %rax,%rdx
+  8065f0:	ff d2                	call   *%rdx
+}
+  8065f2:	90                   	nop
+  8065f3:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8065f7:	c9                   	leave
+  8065f8:	c3                   	ret
+
+00000000008065f9 <getchar>:
+
+int
+getchar(void)
+{
+  8065f9:	55                   	push   %rbp
+  8065fa:	48 89 e5             	mov    %rsp,%rbp
+  8065fd:	41 57                	push   %r15
+  8065ff:	48 83 ec 18          	sub    $0x18,%rsp
+  806603:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806603 <getchar+0xa>
+  80660a:	49 bb 3d 2a 00 00 00 	movabs $0x2a3d,%r11
+  806611:	00 00 00 
+  806614:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806617:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80661b:	ba 01 00 00 00       	mov    $0x1,%edx
+  806620:	48 89 ce             	mov    %rcx,%rsi
+  806623:	bf 00 00 00 00       	mov    $0x0,%edi
+  806628:	49 89 c7             	mov    %rax,%r15
+  80662b:	48 b9 b6 b0 ff ff ff 	movabs $0xffffffffffffb0b6,%rcx
+  806632:	ff ff ff 
+  806635:	48 01 c1             	add    %rax,%rcx
+  806638:	ff d1                	call   *%rcx
+  80663a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80663d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806641:	79 05                	jns    806648 <getchar+0x4f>
+		return r;
+  806643:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806646:	eb 14                	jmp    80665c <getchar+0x63>
+	if (r < 1)
+  806648:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80664c:	7f 07                	jg     806655 <getchar+0x5c>
+		return -E_EOF;
+  80664e:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806653:	eb 07                	jmp    80665c <getchar+0x63>
+	return c;
+  806655:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806659:	0f b6 c0             	movzbl %al,%eax
+}
+  80665c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806660:	c9                   	leave
+  806661:	c3                   	ret
+
+0000000000806662 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806662:	55                   	push   %rbp
+  806663:	48 89 e5             	mov    %rsp,%rbp
+  806666:	41 57                	push   %r15
+  806668:	53                   	push   %rbx
+  806669:	48 83 ec 20          	sub    $0x20,%rsp
+  80666d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80666d <iscons+0xb>
+  806674:	49 bb d3 29 00 00 00 	movabs $0x29d3,%r11
+  80667b:	00 00 00 
+  80667e:	4c 01 db             	add    %r11,%rbx
+  806681:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806684:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806688:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80668b:	48 89 d6             	mov    %rdx,%rsi
+  80668e:	89 c7                	mov    %eax,%edi
+  806690:	49 89 df             	mov    %rbx,%r15
+  806693:	48 b8 6f ab ff ff ff 	movabs $0xffffffffffffab6f,%rax
+  80669a:	ff ff ff 
+  80669d:	48 01 d8             	add    %rbx,%rax
+  8066a0:	ff d0                	call   *%rax
+  8066a2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8066a5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066a9:	79 05                	jns    8066b0 <iscons+0x4e>
+		return r;
+  8066ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066ae:	eb 1b                	jmp    8066cb <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8066b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066b4:	8b 10                	mov    (%rax),%edx
+  8066b6:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  8066bd:	00 00 00 
+  8066c0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8066c3:	39 c2                	cmp    %eax,%edx
+  8066c5:	0f 94 c0             	sete   %al
+  8066c8:	0f b6 c0             	movzbl %al,%eax
+}
+  8066cb:	48 83 c4 20          	add    $0x20,%rsp
+  8066cf:	5b                   	pop    %rbx
+  8066d0:	41 5f                	pop    %r15
+  8066d2:	5d                   	pop    %rbp
+  8066d3:	c3                   	ret
+
+00000000008066d4 <opencons>:
+
+int
+opencons(void)
+{
+  8066d4:	55                   	push   %rbp
+  8066d5:	48 89 e5             	mov    %rsp,%rbp
+  8066d8:	41 57                	push   %r15
+  8066da:	53                   	push   %rbx
+  8066db:	48 83 ec 10          	sub    $0x10,%rsp
+  8066df:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8066df <opencons+0xb>
+  8066e6:	49 bb 61 29 00 00 00 	movabs $0x2961,%r11
+  8066ed:	00 00 00 
+  8066f0:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8066f3:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8066f7:	48 89 c7             	mov    %rax,%rdi
+  8066fa:	49 89 df             	mov    %rbx,%r15
+  8066fd:	48 b8 b9 aa ff ff ff 	movabs $0xffffffffffffaab9,%rax
+  806704:	ff ff ff 
+  806707:	48 01 d8             	add    %rbx,%rax
+  80670a:	ff d0                	call   *%rax
+  80670c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80670f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806713:	79 05                	jns    80671a <opencons+0x46>
+		return r;
+  806715:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806718:	eb 68                	jmp    806782 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80671a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80671e:	ba 07 04 00 00       	mov    $0x407,%edx
+  806723:	48 89 c6             	mov    %rax,%rsi
+  806726:	bf 00 00 00 00       	mov    $0x0,%edi
+  80672b:	49 89 df             	mov    %rbx,%r15
+  80672e:	48 b8 3e 8f ff ff ff 	movabs $0xffffffffffff8f3e,%rax
+  806735:	ff ff ff 
+  806738:	48 01 d8             	add    %rbx,%rax
+  80673b:	ff d0                	call   *%rax
+  80673d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806740:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806744:	79 05                	jns    80674b <opencons+0x77>
+		return r;
+  806746:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806749:	eb 37                	jmp    806782 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80674b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80674f:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806756:	00 00 00 
+  806759:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80675c:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80675e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806762:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806769:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80676d:	48 89 c7             	mov    %rax,%rdi
+  806770:	49 89 df             	mov    %rbx,%r15
+  806773:	48 b8 3f aa ff ff ff 	movabs $0xffffffffffffaa3f,%rax
+  80677a:	ff ff ff 
+  80677d:	48 01 d8             	add    %rbx,%rax
+  806780:	ff d0                	call   *%rax
+}
+  806782:	48 83 c4 10          	add    $0x10,%rsp
+  806786:	5b                   	pop    %rbx
+  806787:	41 5f                	pop    %r15
+  806789:	5d                   	pop    %rbp
+  80678a:	c3                   	ret
+
+000000000080678b <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80678b:	55                   	push   %rbp
+  80678c:	48 89 e5             	mov    %rsp,%rbp
+  80678f:	41 57                	push   %r15
+  806791:	53                   	push   %rbx
+  806792:	48 83 ec 30          	sub    $0x30,%rsp
+  806796:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806796 <devcons_read+0xb>
+  80679d:	49 bb aa 28 00 00 00 	movabs $0x28aa,%r11
+  8067a4:	00 00 00 
+  8067a7:	4c 01 db             	add    %r11,%rbx
+  8067aa:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8067ae:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8067b2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8067b6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8067bb:	75 19                	jne    8067d6 <devcons_read+0x4b>
+		return 0;
+  8067bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067c2:	eb 55                	jmp    806819 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8067c4:	49 89 df             	mov    %rbx,%r15
+  8067c7:	48 b8 e9 8e ff ff ff 	movabs $0xffffffffffff8ee9,%rax
+  8067ce:	ff ff ff 
+  8067d1:	48 01 d8             	add    %rbx,%rax
+  8067d4:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8067d6:	49 89 df             	mov    %rbx,%r15
+  8067d9:	48 b8 e5 8d ff ff ff 	movabs $0xffffffffffff8de5,%rax
+  8067e0:	ff ff ff 
+  8067e3:	48 01 d8             	add    %rbx,%rax
+  8067e6:	ff d0                	call   *%rax
+  8067e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8067eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067ef:	74 d3                	je     8067c4 <devcons_read+0x39>
+	if (c < 0)
+  8067f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067f5:	79 05                	jns    8067fc <devcons_read+0x71>
+		return c;
+  8067f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067fa:	eb 1d                	jmp    806819 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8067fc:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806800:	75 07                	jne    806809 <devcons_read+0x7e>
+		return 0;
+  806802:	b8 00 00 00 00       	mov    $0x0,%eax
+  806807:	eb 10                	jmp    806819 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806809:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80680c:	89 c2                	mov    %eax,%edx
+  80680e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806812:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806814:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806819:	48 83 c4 30          	add    $0x30,%rsp
+  80681d:	5b                   	pop    %rbx
+  80681e:	41 5f                	pop    %r15
+  806820:	5d                   	pop    %rbp
+  806821:	c3                   	ret
+
+0000000000806822 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806822:	55                   	push   %rbp
+  806823:	48 89 e5             	mov    %rsp,%rbp
+  806826:	41 57                	push   %r15
+  806828:	53                   	push   %rbx
+  806829:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806830:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806830 <devcons_write+0xe>
+  806837:	49 bb 10 28 00 00 00 	movabs $0x2810,%r11
+  80683e:	00 00 00 
+  806841:	4c 01 db             	add    %r11,%rbx
+  806844:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80684b:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806852:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806859:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806860:	e9 80 00 00 00       	jmp    8068e5 <devcons_write+0xc3>
+		m = n - tot;
+  806865:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80686c:	89 c2                	mov    %eax,%edx
+  80686e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806871:	29 c2                	sub    %eax,%edx
+  806873:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806876:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806879:	83 f8 7f             	cmp    $0x7f,%eax
+  80687c:	76 07                	jbe    806885 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  80687e:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806885:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806888:	48 63 d0             	movslq %eax,%rdx
+  80688b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80688e:	48 63 c8             	movslq %eax,%rcx
+  806891:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806898:	48 01 c1             	add    %rax,%rcx
+  80689b:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8068a2:	48 89 ce             	mov    %rcx,%rsi
+  8068a5:	48 89 c7             	mov    %rax,%rdi
+  8068a8:	49 89 df             	mov    %rbx,%r15
+  8068ab:	48 b8 62 86 ff ff ff 	movabs $0xffffffffffff8662,%rax
+  8068b2:	ff ff ff 
+  8068b5:	48 01 d8             	add    %rbx,%rax
+  8068b8:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8068ba:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8068bd:	48 63 d0             	movslq %eax,%rdx
+  8068c0:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8068c7:	48 89 d6             	mov    %rdx,%rsi
+  8068ca:	48 89 c7             	mov    %rax,%rdi
+  8068cd:	49 89 df             	mov    %rbx,%r15
+  8068d0:	48 b8 86 8d ff ff ff 	movabs $0xffffffffffff8d86,%rax
+  8068d7:	ff ff ff 
+  8068da:	48 01 d8             	add    %rbx,%rax
+  8068dd:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8068df:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8068e2:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8068e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068e8:	48 98                	cltq
+  8068ea:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8068f1:	0f 82 6e ff ff ff    	jb     806865 <devcons_write+0x43>
+	}
+	return tot;
+  8068f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8068fa:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806901:	5b                   	pop    %rbx
+  806902:	41 5f                	pop    %r15
+  806904:	5d                   	pop    %rbp
+  806905:	c3                   	ret
+
+0000000000806906 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806906:	55                   	push   %rbp
+  806907:	48 89 e5             	mov    %rsp,%rbp
+  80690a:	48 83 ec 08          	sub    $0x8,%rsp
+  80690e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80690e <devcons_close+0x8>
+  806915:	49 bb 32 27 00 00 00 	movabs $0x2732,%r11
+  80691c:	00 00 00 
+  80691f:	4c 01 d8             	add    %r11,%rax
+  806922:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806926:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80692b:	c9                   	leave
+  80692c:	c3                   	ret
+
+000000000080692d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80692d:	55                   	push   %rbp
+  80692e:	48 89 e5             	mov    %rsp,%rbp
+  806931:	41 57                	push   %r15
+  806933:	48 83 ec 18          	sub    $0x18,%rsp
+  806937:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806937 <devcons_stat+0xa>
+  80693e:	49 bb 09 27 00 00 00 	movabs $0x2709,%r11
+  806945:	00 00 00 
+  806948:	4c 01 d8             	add    %r11,%rax
+  80694b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80694f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806953:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806957:	48 b9 b5 e3 ff ff ff 	movabs $0xffffffffffffe3b5,%rcx
+  80695e:	ff ff ff 
+  806961:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806965:	48 89 ce             	mov    %rcx,%rsi
+  806968:	48 89 d7             	mov    %rdx,%rdi
+  80696b:	49 89 c7             	mov    %rax,%r15
+  80696e:	48 ba 82 82 ff ff ff 	movabs $0xffffffffffff8282,%rdx
+  806975:	ff ff ff 
+  806978:	48 01 c2             	add    %rax,%rdx
+  80697b:	ff d2                	call   *%rdx
+	return 0;
+  80697d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806982:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806986:	c9                   	leave
+  806987:	c3                   	ret
+
+0000000000806988 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  806988:	55                   	push   %rbp
+  806989:	48 89 e5             	mov    %rsp,%rbp
+  80698c:	41 57                	push   %r15
+  80698e:	41 54                	push   %r12
+  806990:	53                   	push   %rbx
+  806991:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  806998:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806998 <_panic+0x10>
+  80699f:	49 bb a8 26 00 00 00 	movabs $0x26a8,%r11
+  8069a6:	00 00 00 
+  8069a9:	4c 01 db             	add    %r11,%rbx
+  8069ac:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8069b3:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8069b9:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8069c0:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8069c7:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8069ce:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8069d5:	84 c0                	test   %al,%al
+  8069d7:	74 26                	je     8069ff <_panic+0x77>
+  8069d9:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8069e0:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8069e7:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8069eb:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8069ef:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8069f3:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8069f7:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8069fb:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8069ff:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  806a06:	00 00 00 
+  806a09:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  806a10:	00 00 00 
+  806a13:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  806a17:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  806a1e:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  806a25:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  806a2c:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  806a33:	ff ff ff 
+  806a36:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a3a:	4c 8b 20             	mov    (%rax),%r12
+  806a3d:	49 89 df             	mov    %rbx,%r15
+  806a40:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  806a47:	ff ff ff 
+  806a4a:	48 01 d8             	add    %rbx,%rax
+  806a4d:	ff d0                	call   *%rax
+  806a4f:	89 c6                	mov    %eax,%esi
+  806a51:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  806a57:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  806a5e:	41 89 d0             	mov    %edx,%r8d
+  806a61:	48 89 c1             	mov    %rax,%rcx
+  806a64:	4c 89 e2             	mov    %r12,%rdx
+  806a67:	48 b8 c0 e3 ff ff ff 	movabs $0xffffffffffffe3c0,%rax
+  806a6e:	ff ff ff 
+  806a71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806a75:	48 89 c7             	mov    %rax,%rdi
+  806a78:	49 89 df             	mov    %rbx,%r15
+  806a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a80:	49 b9 c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%r9
+  806a87:	ff ff ff 
+  806a8a:	49 01 d9             	add    %rbx,%r9
+  806a8d:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  806a90:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  806a97:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  806a9e:	48 89 d6             	mov    %rdx,%rsi
+  806aa1:	48 89 c7             	mov    %rax,%rdi
+  806aa4:	49 89 df             	mov    %rbx,%r15
+  806aa7:	48 b8 e0 73 ff ff ff 	movabs $0xffffffffffff73e0,%rax
+  806aae:	ff ff ff 
+  806ab1:	48 01 d8             	add    %rbx,%rax
+  806ab4:	ff d0                	call   *%rax
+	cprintf("\n");
+  806ab6:	48 b8 e3 e3 ff ff ff 	movabs $0xffffffffffffe3e3,%rax
+  806abd:	ff ff ff 
+  806ac0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806ac4:	48 89 c7             	mov    %rax,%rdi
+  806ac7:	49 89 df             	mov    %rbx,%r15
+  806aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  806acf:	48 ba c0 74 ff ff ff 	movabs $0xffffffffffff74c0,%rdx
+  806ad6:	ff ff ff 
+  806ad9:	48 01 da             	add    %rbx,%rdx
+  806adc:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  806ade:	cc                   	int3
+  806adf:	eb fd                	jmp    806ade <_panic+0x156>
+
+0000000000806ae1 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806ae1:	55                   	push   %rbp
+  806ae2:	48 89 e5             	mov    %rsp,%rbp
+  806ae5:	41 57                	push   %r15
+  806ae7:	53                   	push   %rbx
+  806ae8:	48 83 ec 20          	sub    $0x20,%rsp
+  806aec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806aec <set_pgfault_handler+0xb>
+  806af3:	49 bb 54 25 00 00 00 	movabs $0x2554,%r11
+  806afa:	00 00 00 
+  806afd:	4c 01 db             	add    %r11,%rbx
+  806b00:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806b04:	49 89 df             	mov    %rbx,%r15
+  806b07:	48 b8 95 8e ff ff ff 	movabs $0xffffffffffff8e95,%rax
+  806b0e:	ff ff ff 
+  806b11:	48 01 d8             	add    %rbx,%rax
+  806b14:	ff d0                	call   *%rax
+  806b16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806b19:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806b20:	00 00 00 
+  806b23:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b27:	48 85 c0             	test   %rax,%rax
+  806b2a:	75 6b                	jne    806b97 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806b2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b2f:	ba 07 00 00 00       	mov    $0x7,%edx
+  806b34:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806b39:	48 89 ce             	mov    %rcx,%rsi
+  806b3c:	89 c7                	mov    %eax,%edi
+  806b3e:	49 89 df             	mov    %rbx,%r15
+  806b41:	48 b8 3e 8f ff ff ff 	movabs $0xffffffffffff8f3e,%rax
+  806b48:	ff ff ff 
+  806b4b:	48 01 d8             	add    %rbx,%rax
+  806b4e:	ff d0                	call   *%rax
+  806b50:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806b53:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806b57:	74 3e                	je     806b97 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806b59:	48 b8 e8 e3 ff ff ff 	movabs $0xffffffffffffe3e8,%rax
+  806b60:	ff ff ff 
+  806b63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b67:	48 89 c2             	mov    %rax,%rdx
+  806b6a:	be 23 00 00 00       	mov    $0x23,%esi
+  806b6f:	48 b8 16 e4 ff ff ff 	movabs $0xffffffffffffe416,%rax
+  806b76:	ff ff ff 
+  806b79:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b7d:	48 89 c7             	mov    %rax,%rdi
+  806b80:	49 89 df             	mov    %rbx,%r15
+  806b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b88:	48 b9 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rcx
+  806b8f:	ff ff ff 
+  806b92:	48 01 d9             	add    %rbx,%rcx
+  806b95:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806b97:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806b9e:	00 00 00 
+  806ba1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806ba5:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806ba9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bac:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806bb3:	ff ff ff 
+  806bb6:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806bba:	48 89 d6             	mov    %rdx,%rsi
+  806bbd:	89 c7                	mov    %eax,%edi
+  806bbf:	49 89 df             	mov    %rbx,%r15
+  806bc2:	48 b8 34 91 ff ff ff 	movabs $0xffffffffffff9134,%rax
+  806bc9:	ff ff ff 
+  806bcc:	48 01 d8             	add    %rbx,%rax
+  806bcf:	ff d0                	call   *%rax
+}
+  806bd1:	90                   	nop
+  806bd2:	48 83 c4 20          	add    $0x20,%rsp
+  806bd6:	5b                   	pop    %rbx
+  806bd7:	41 5f                	pop    %r15
+  806bd9:	5d                   	pop    %rbp
+  806bda:	c3                   	ret
+
+0000000000806bdb <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806bdb:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806bde:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806be5:	00 00 00 
+call *%rax
+  806be8:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806bea:	58                   	pop    %rax
+	popq %rax;
+  806beb:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806bec:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806bf3:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806bf7:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806bfb:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806bff:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806c03:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806c07:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806c0a:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806c0e:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806c12:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806c17:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806c1c:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806c21:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806c26:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806c2b:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806c30:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806c35:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806c3a:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806c3f:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806c44:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806c49:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806c4e:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806c53:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806c58:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806c5c:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806c60:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806c61:	5c                   	pop    %rsp
+	ret;			//return
+  806c62:	c3                   	ret
+
+0000000000806c63 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806c63:	55                   	push   %rbp
+  806c64:	48 89 e5             	mov    %rsp,%rbp
+  806c67:	48 83 ec 18          	sub    $0x18,%rsp
+  806c6b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806c6b <pageref+0x8>
+  806c72:	49 bb d5 23 00 00 00 	movabs $0x23d5,%r11
+  806c79:	00 00 00 
+  806c7c:	4c 01 d8             	add    %r11,%rax
+  806c7f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806c83:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c87:	48 89 d1             	mov    %rdx,%rcx
+  806c8a:	48 c1 e9 15          	shr    $0x15,%rcx
+  806c8e:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806c95:	ff ff ff 
+  806c98:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806c9c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806ca0:	83 e2 01             	and    $0x1,%edx
+  806ca3:	48 85 d2             	test   %rdx,%rdx
+  806ca6:	75 07                	jne    806caf <pageref+0x4c>
+		return 0;
+  806ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cad:	eb 64                	jmp    806d13 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806caf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806cb3:	48 89 d1             	mov    %rdx,%rcx
+  806cb6:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806cba:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806cc1:	ff ff ff 
+  806cc4:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806cc8:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806ccc:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806cd0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806cd4:	83 e2 01             	and    $0x1,%edx
+  806cd7:	48 85 d2             	test   %rdx,%rdx
+  806cda:	75 07                	jne    806ce3 <pageref+0x80>
+		return 0;
+  806cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ce1:	eb 30                	jmp    806d13 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806ce3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806ce7:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806ceb:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806cf2:	ff ff ff 
+  806cf5:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806cf9:	48 89 d0             	mov    %rdx,%rax
+  806cfc:	48 01 c0             	add    %rax,%rax
+  806cff:	48 01 d0             	add    %rdx,%rax
+  806d02:	48 c1 e0 03          	shl    $0x3,%rax
+  806d06:	48 01 c8             	add    %rcx,%rax
+  806d09:	48 83 c0 08          	add    $0x8,%rax
+  806d0d:	0f b7 00             	movzwl (%rax),%eax
+  806d10:	0f b7 c0             	movzwl %ax,%eax
+}
+  806d13:	c9                   	leave
+  806d14:	c3                   	ret
@@ -0,0 +1,10599 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 1a 02 00 00       	call   80025b <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 10          	sub    $0x10,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <primeproc+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+	int i, id, p;
+	envid_t envid;
+
+	// fetch a prime from our left neighbor
+top:
+	p = ipc_recv(&envid, 0, 0);
+  800062:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80006b:	be 00 00 00 00       	mov    $0x0,%esi
+  800070:	48 89 c7             	mov    %rax,%rdi
+  800073:	49 89 df             	mov    %rbx,%r15
+  800076:	48 b8 af a3 ff ff ff 	movabs $0xffffffffffffa3af,%rax
+  80007d:	ff ff ff 
+  800080:	48 01 d8             	add    %rbx,%rax
+  800083:	ff d0                	call   *%rax
+  800085:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  800088:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80008f:	ff ff ff 
+  800092:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800096:	48 8b 00             	mov    (%rax),%rax
+  800099:	8b 80 dc 00 00 00    	mov    0xdc(%rax),%eax
+  80009f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8000a2:	89 c6                	mov    %eax,%esi
+  8000a4:	48 b8 b8 dc ff ff ff 	movabs $0xffffffffffffdcb8,%rax
+  8000ab:	ff ff ff 
+  8000ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000b2:	48 89 c7             	mov    %rax,%rdi
+  8000b5:	49 89 df             	mov    %rbx,%r15
+  8000b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bd:	48 b9 fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%rcx
+  8000c4:	ff ff ff 
+  8000c7:	48 01 d9             	add    %rbx,%rcx
+  8000ca:	ff d1                	call   *%rcx
+
+	// fork a right neighbor to continue the chain
+	if ((id = fork()) < 0)
+  8000cc:	49 89 df             	mov    %rbx,%r15
+  8000cf:	48 b8 09 a0 ff ff ff 	movabs $0xffffffffffffa009,%rax
+  8000d6:	ff ff ff 
+  8000d9:	48 01 d8             	add    %rbx,%rax
+  8000dc:	ff d0                	call   *%rax
+  8000de:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8000e1:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8000e5:	79 44                	jns    80012b <primeproc+0xe8>
+		panic("fork: %e", id);
+  8000e7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8000ea:	89 c1                	mov    %eax,%ecx
+  8000ec:	48 b8 c4 dc ff ff ff 	movabs $0xffffffffffffdcc4,%rax
+  8000f3:	ff ff ff 
+  8000f6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000fa:	48 89 c2             	mov    %rax,%rdx
+  8000fd:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800102:	48 b8 cd dc ff ff ff 	movabs $0xffffffffffffdccd,%rax
+  800109:	ff ff ff 
+  80010c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800110:	48 89 c7             	mov    %rax,%rdi
+  800113:	49 89 df             	mov    %rbx,%r15
+  800116:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011b:	49 b8 25 73 ff ff ff 	movabs $0xffffffffffff7325,%r8
+  800122:	ff ff ff 
+  800125:	49 01 d8             	add    %rbx,%r8
+  800128:	41 ff d0             	call   *%r8
+	if (id == 0)
+  80012b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80012f:	75 05                	jne    800136 <primeproc+0xf3>
+		goto top;
+  800131:	e9 2c ff ff ff       	jmp    800062 <primeproc+0x1f>
+
+	// filter out multiples of our prime
+	while (1) {
+		i = ipc_recv(&envid, 0, 0);
+  800136:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80013a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013f:	be 00 00 00 00       	mov    $0x0,%esi
+  800144:	48 89 c7             	mov    %rax,%rdi
+  800147:	49 89 df             	mov    %rbx,%r15
+  80014a:	48 b8 af a3 ff ff ff 	movabs $0xffffffffffffa3af,%rax
+  800151:	ff ff ff 
+  800154:	48 01 d8             	add    %rbx,%rax
+  800157:	ff d0                	call   *%rax
+  800159:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+		if (i % p)
+  80015c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80015f:	99                   	cltd
+  800160:	f7 7d ec             	idivl  -0x14(%rbp)
+  800163:	89 d0                	mov    %edx,%eax
+  800165:	85 c0                	test   %eax,%eax
+  800167:	74 cd                	je     800136 <primeproc+0xf3>
+			ipc_send(id, i, 0, 0);
+  800169:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80016c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80016f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800174:	ba 00 00 00 00       	mov    $0x0,%edx
+  800179:	89 c7                	mov    %eax,%edi
+  80017b:	49 89 df             	mov    %rbx,%r15
+  80017e:	48 b8 98 a4 ff ff ff 	movabs $0xffffffffffffa498,%rax
+  800185:	ff ff ff 
+  800188:	48 01 d8             	add    %rbx,%rax
+  80018b:	ff d0                	call   *%rax
+		i = ipc_recv(&envid, 0, 0);
+  80018d:	eb a7                	jmp    800136 <primeproc+0xf3>
+
+000000000080018f <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  80018f:	55                   	push   %rbp
+  800190:	48 89 e5             	mov    %rsp,%rbp
+  800193:	41 57                	push   %r15
+  800195:	53                   	push   %rbx
+  800196:	48 83 ec 20          	sub    $0x20,%rsp
+  80019a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80019a <umain+0xb>
+  8001a1:	49 bb a6 8e 00 00 00 	movabs $0x8ea6,%r11
+  8001a8:	00 00 00 
+  8001ab:	4c 01 db             	add    %r11,%rbx
+  8001ae:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8001b1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i, id;
+
+	// fork the first prime process in the chain
+	if ((id = fork()) < 0)
+  8001b5:	49 89 df             	mov    %rbx,%r15
+  8001b8:	48 b8 09 a0 ff ff ff 	movabs $0xffffffffffffa009,%rax
+  8001bf:	ff ff ff 
+  8001c2:	48 01 d8             	add    %rbx,%rax
+  8001c5:	ff d0                	call   *%rax
+  8001c7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8001ca:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8001ce:	79 44                	jns    800214 <umain+0x85>
+		panic("fork: %e", id);
+  8001d0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8001d3:	89 c1                	mov    %eax,%ecx
+  8001d5:	48 b8 c4 dc ff ff ff 	movabs $0xffffffffffffdcc4,%rax
+  8001dc:	ff ff ff 
+  8001df:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001e3:	48 89 c2             	mov    %rax,%rdx
+  8001e6:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8001eb:	48 b8 cd dc ff ff ff 	movabs $0xffffffffffffdccd,%rax
+  8001f2:	ff ff ff 
+  8001f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001f9:	48 89 c7             	mov    %rax,%rdi
+  8001fc:	49 89 df             	mov    %rbx,%r15
+  8001ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800204:	49 b8 25 73 ff ff ff 	movabs $0xffffffffffff7325,%r8
+  80020b:	ff ff ff 
+  80020e:	49 01 d8             	add    %rbx,%r8
+  800211:	41 ff d0             	call   *%r8
+	if (id == 0)
+  800214:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800218:	75 10                	jne    80022a <umain+0x9b>
+		primeproc();
+  80021a:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800221:	ff ff ff 
+  800224:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800228:	ff d0                	call   *%rax
+
+	// feed all the integers through
+	for (i = 2; ; i++)
+  80022a:	c7 45 ec 02 00 00 00 	movl   $0x2,-0x14(%rbp)
+		ipc_send(id, i, 0, 0);
+  800231:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  800234:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800237:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80023c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800241:	89 c7                	mov    %eax,%edi
+  800243:	49 89 df             	mov    %rbx,%r15
+  800246:	48 b8 98 a4 ff ff ff 	movabs $0xffffffffffffa498,%rax
+  80024d:	ff ff ff 
+  800250:	48 01 d8             	add    %rbx,%rax
+  800253:	ff d0                	call   *%rax
+	for (i = 2; ; i++)
+  800255:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+		ipc_send(id, i, 0, 0);
+  800259:	eb d6                	jmp    800231 <umain+0xa2>
+
+000000000080025b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80025b:	55                   	push   %rbp
+  80025c:	48 89 e5             	mov    %rsp,%rbp
+  80025f:	41 57                	push   %r15
+  800261:	53                   	push   %rbx
+  800262:	48 83 ec 20          	sub    $0x20,%rsp
+  800266:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800266 <libmain+0xb>
+  80026d:	49 bb da 8d 00 00 00 	movabs $0x8dda,%r11
+  800274:	00 00 00 
+  800277:	4c 01 db             	add    %r11,%rbx
+  80027a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80027d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800281:	49 89 df             	mov    %rbx,%r15
+  800284:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  80028b:	ff ff ff 
+  80028e:	48 01 d8             	add    %rbx,%rax
+  800291:	ff d0                	call   *%rax
+  800293:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800296:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800299:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80029e:	48 98                	cltq
+  8002a0:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8002a7:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8002ae:	ff ff ff 
+  8002b1:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8002b5:	48 01 c2             	add    %rax,%rdx
+  8002b8:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8002bf:	00 00 00 
+  8002c2:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002c6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8002ca:	7e 15                	jle    8002e1 <libmain+0x86>
+		binaryname = argv[0];
+  8002cc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8002d0:	48 8b 00             	mov    (%rax),%rax
+  8002d3:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8002da:	00 00 00 
+  8002dd:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8002e1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8002e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8002e8:	48 89 d6             	mov    %rdx,%rsi
+  8002eb:	89 c7                	mov    %eax,%edi
+  8002ed:	49 89 df             	mov    %rbx,%r15
+  8002f0:	48 b8 4f 71 ff ff ff 	movabs $0xffffffffffff714f,%rax
+  8002f7:	ff ff ff 
+  8002fa:	48 01 d8             	add    %rbx,%rax
+  8002fd:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8002ff:	49 89 df             	mov    %rbx,%r15
+  800302:	48 b8 db 72 ff ff ff 	movabs $0xffffffffffff72db,%rax
+  800309:	ff ff ff 
+  80030c:	48 01 d8             	add    %rbx,%rax
+  80030f:	ff d0                	call   *%rax
+}
+  800311:	90                   	nop
+  800312:	48 83 c4 20          	add    $0x20,%rsp
+  800316:	5b                   	pop    %rbx
+  800317:	41 5f                	pop    %r15
+  800319:	5d                   	pop    %rbp
+  80031a:	c3                   	ret
+
+000000000080031b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80031b:	55                   	push   %rbp
+  80031c:	48 89 e5             	mov    %rsp,%rbp
+  80031f:	41 57                	push   %r15
+  800321:	53                   	push   %rbx
+  800322:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800322 <exit+0x7>
+  800329:	49 bb 1e 8d 00 00 00 	movabs $0x8d1e,%r11
+  800330:	00 00 00 
+  800333:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800336:	49 89 df             	mov    %rbx,%r15
+  800339:	48 b8 a6 af ff ff ff 	movabs $0xffffffffffffafa6,%rax
+  800340:	ff ff ff 
+  800343:	48 01 d8             	add    %rbx,%rax
+  800346:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800348:	bf 00 00 00 00       	mov    $0x0,%edi
+  80034d:	49 89 df             	mov    %rbx,%r15
+  800350:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  800357:	ff ff ff 
+  80035a:	48 01 d8             	add    %rbx,%rax
+  80035d:	ff d0                	call   *%rax
+}
+  80035f:	90                   	nop
+  800360:	5b                   	pop    %rbx
+  800361:	41 5f                	pop    %r15
+  800363:	5d                   	pop    %rbp
+  800364:	c3                   	ret
+
+0000000000800365 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800365:	55                   	push   %rbp
+  800366:	48 89 e5             	mov    %rsp,%rbp
+  800369:	41 57                	push   %r15
+  80036b:	41 54                	push   %r12
+  80036d:	53                   	push   %rbx
+  80036e:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800375:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800375 <_panic+0x10>
+  80037c:	49 bb cb 8c 00 00 00 	movabs $0x8ccb,%r11
+  800383:	00 00 00 
+  800386:	4c 01 db             	add    %r11,%rbx
+  800389:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800390:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800396:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80039d:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8003a4:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8003ab:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8003b2:	84 c0                	test   %al,%al
+  8003b4:	74 26                	je     8003dc <_panic+0x77>
+  8003b6:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8003bd:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8003c4:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8003c8:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8003cc:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8003d0:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8003d4:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8003d8:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003dc:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8003e3:	00 00 00 
+  8003e6:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8003ed:	00 00 00 
+  8003f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f4:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8003fb:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800402:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800409:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800410:	ff ff ff 
+  800413:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800417:	4c 8b 20             	mov    (%rax),%r12
+  80041a:	49 89 df             	mov    %rbx,%r15
+  80041d:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  800424:	ff ff ff 
+  800427:	48 01 d8             	add    %rbx,%rax
+  80042a:	ff d0                	call   *%rax
+  80042c:	89 c6                	mov    %eax,%esi
+  80042e:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800434:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80043b:	41 89 d0             	mov    %edx,%r8d
+  80043e:	48 89 c1             	mov    %rax,%rcx
+  800441:	4c 89 e2             	mov    %r12,%rdx
+  800444:	48 b8 e8 dc ff ff ff 	movabs $0xffffffffffffdce8,%rax
+  80044b:	ff ff ff 
+  80044e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800452:	48 89 c7             	mov    %rax,%rdi
+  800455:	49 89 df             	mov    %rbx,%r15
+  800458:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045d:	49 b9 fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%r9
+  800464:	ff ff ff 
+  800467:	49 01 d9             	add    %rbx,%r9
+  80046a:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80046d:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800474:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80047b:	48 89 d6             	mov    %rdx,%rsi
+  80047e:	48 89 c7             	mov    %rax,%rdi
+  800481:	49 89 df             	mov    %rbx,%r15
+  800484:	48 b8 1c 75 ff ff ff 	movabs $0xffffffffffff751c,%rax
+  80048b:	ff ff ff 
+  80048e:	48 01 d8             	add    %rbx,%rax
+  800491:	ff d0                	call   *%rax
+	cprintf("\n");
+  800493:	48 b8 0b dd ff ff ff 	movabs $0xffffffffffffdd0b,%rax
+  80049a:	ff ff ff 
+  80049d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004a1:	48 89 c7             	mov    %rax,%rdi
+  8004a4:	49 89 df             	mov    %rbx,%r15
+  8004a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ac:	48 ba fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%rdx
+  8004b3:	ff ff ff 
+  8004b6:	48 01 da             	add    %rbx,%rdx
+  8004b9:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8004bb:	cc                   	int3
+  8004bc:	eb fd                	jmp    8004bb <_panic+0x156>
+
+00000000008004be <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8004be:	55                   	push   %rbp
+  8004bf:	48 89 e5             	mov    %rsp,%rbp
+  8004c2:	41 57                	push   %r15
+  8004c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8004c8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8004c8 <putch+0xa>
+  8004cf:	49 bb 78 8b 00 00 00 	movabs $0x8b78,%r11
+  8004d6:	00 00 00 
+  8004d9:	4c 01 d8             	add    %r11,%rax
+  8004dc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8004df:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8004e3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004e7:	8b 12                	mov    (%rdx),%edx
+  8004e9:	8d 72 01             	lea    0x1(%rdx),%esi
+  8004ec:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8004f0:	89 31                	mov    %esi,(%rcx)
+  8004f2:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8004f5:	89 ce                	mov    %ecx,%esi
+  8004f7:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8004fb:	48 63 d2             	movslq %edx,%rdx
+  8004fe:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800503:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800507:	8b 12                	mov    (%rdx),%edx
+  800509:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80050f:	75 33                	jne    800544 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800511:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800515:	8b 12                	mov    (%rdx),%edx
+  800517:	48 63 d2             	movslq %edx,%rdx
+  80051a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80051e:	48 83 c1 08          	add    $0x8,%rcx
+  800522:	48 89 d6             	mov    %rdx,%rsi
+  800525:	48 89 cf             	mov    %rcx,%rdi
+  800528:	49 89 c7             	mov    %rax,%r15
+  80052b:	48 ba c2 8e ff ff ff 	movabs $0xffffffffffff8ec2,%rdx
+  800532:	ff ff ff 
+  800535:	48 01 c2             	add    %rax,%rdx
+  800538:	ff d2                	call   *%rdx
+        b->idx = 0;
+  80053a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80053e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800544:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800548:	8b 40 04             	mov    0x4(%rax),%eax
+  80054b:	8d 50 01             	lea    0x1(%rax),%edx
+  80054e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800552:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800555:	90                   	nop
+  800556:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80055a:	c9                   	leave
+  80055b:	c3                   	ret
+
+000000000080055c <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80055c:	55                   	push   %rbp
+  80055d:	48 89 e5             	mov    %rsp,%rbp
+  800560:	41 57                	push   %r15
+  800562:	53                   	push   %rbx
+  800563:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80056a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80056a <vcprintf+0xe>
+  800571:	49 bb d6 8a 00 00 00 	movabs $0x8ad6,%r11
+  800578:	00 00 00 
+  80057b:	4c 01 db             	add    %r11,%rbx
+  80057e:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800585:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80058c:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800593:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80059a:	48 8b 06             	mov    (%rsi),%rax
+  80059d:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005a1:	48 89 01             	mov    %rax,(%rcx)
+  8005a4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005a8:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005ac:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8005b0:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8005b7:	00 00 00 
+    b.cnt = 0;
+  8005ba:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8005c1:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8005c4:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8005cb:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8005d2:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8005d9:	48 89 c6             	mov    %rax,%rsi
+  8005dc:	48 b8 7e 74 ff ff ff 	movabs $0xffffffffffff747e,%rax
+  8005e3:	ff ff ff 
+  8005e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005ea:	48 89 c7             	mov    %rax,%rdi
+  8005ed:	49 89 df             	mov    %rbx,%r15
+  8005f0:	48 b8 40 7a ff ff ff 	movabs $0xffffffffffff7a40,%rax
+  8005f7:	ff ff ff 
+  8005fa:	48 01 d8             	add    %rbx,%rax
+  8005fd:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8005ff:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800605:	48 98                	cltq
+  800607:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  80060e:	48 83 c2 08          	add    $0x8,%rdx
+  800612:	48 89 c6             	mov    %rax,%rsi
+  800615:	48 89 d7             	mov    %rdx,%rdi
+  800618:	49 89 df             	mov    %rbx,%r15
+  80061b:	48 b8 c2 8e ff ff ff 	movabs $0xffffffffffff8ec2,%rax
+  800622:	ff ff ff 
+  800625:	48 01 d8             	add    %rbx,%rax
+  800628:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  80062a:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800630:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800637:	5b                   	pop    %rbx
+  800638:	41 5f                	pop    %r15
+  80063a:	5d                   	pop    %rbp
+  80063b:	c3                   	ret
+
+000000000080063c <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  80063c:	55                   	push   %rbp
+  80063d:	48 89 e5             	mov    %rsp,%rbp
+  800640:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800647:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800647 <cprintf+0xb>
+  80064e:	49 bb f9 89 00 00 00 	movabs $0x89f9,%r11
+  800655:	00 00 00 
+  800658:	4d 01 da             	add    %r11,%r10
+  80065b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800662:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800669:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800670:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800677:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80067e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800685:	84 c0                	test   %al,%al
+  800687:	74 20                	je     8006a9 <cprintf+0x6d>
+  800689:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80068d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800691:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800695:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800699:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80069d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8006a1:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8006a5:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8006a9:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8006b0:	00 00 00 
+  8006b3:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8006ba:	00 00 00 
+  8006bd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006c1:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8006c8:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8006cf:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8006d6:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8006dd:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8006e4:	48 8b 06             	mov    (%rsi),%rax
+  8006e7:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006eb:	48 89 01             	mov    %rax,(%rcx)
+  8006ee:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006f2:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006f6:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8006fa:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800701:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800708:	48 89 d6             	mov    %rdx,%rsi
+  80070b:	48 89 c7             	mov    %rax,%rdi
+  80070e:	48 b8 1c 75 ff ff ff 	movabs $0xffffffffffff751c,%rax
+  800715:	ff ff ff 
+  800718:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80071c:	ff d0                	call   *%rax
+  80071e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800724:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80072a:	c9                   	leave
+  80072b:	c3                   	ret
+
+000000000080072c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80072c:	55                   	push   %rbp
+  80072d:	48 89 e5             	mov    %rsp,%rbp
+  800730:	53                   	push   %rbx
+  800731:	48 83 ec 38          	sub    $0x38,%rsp
+  800735:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800735 <printnum+0x9>
+  80073c:	49 bb 0b 89 00 00 00 	movabs $0x890b,%r11
+  800743:	00 00 00 
+  800746:	4c 01 db             	add    %r11,%rbx
+  800749:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80074d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800751:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800755:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800758:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  80075c:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800760:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800763:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800767:	72 58                	jb     8007c1 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800769:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80076c:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80076f:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800772:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800776:	ba 00 00 00 00       	mov    $0x0,%edx
+  80077b:	48 f7 f6             	div    %rsi
+  80077e:	49 89 c2             	mov    %rax,%r10
+  800781:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800784:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800787:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80078b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80078f:	41 89 c9             	mov    %ecx,%r9d
+  800792:	41 89 f8             	mov    %edi,%r8d
+  800795:	89 d1                	mov    %edx,%ecx
+  800797:	4c 89 d2             	mov    %r10,%rdx
+  80079a:	48 89 c7             	mov    %rax,%rdi
+  80079d:	48 b8 ec 76 ff ff ff 	movabs $0xffffffffffff76ec,%rax
+  8007a4:	ff ff ff 
+  8007a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007ab:	ff d0                	call   *%rax
+  8007ad:	eb 1c                	jmp    8007cb <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007b3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8007b6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007ba:	48 89 d6             	mov    %rdx,%rsi
+  8007bd:	89 c7                	mov    %eax,%edi
+  8007bf:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8007c1:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8007c5:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8007c9:	7f e4                	jg     8007af <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007cb:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8007ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8007d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007d7:	48 f7 f1             	div    %rcx
+  8007da:	48 b8 47 de ff ff ff 	movabs $0xffffffffffffde47,%rax
+  8007e1:	ff ff ff 
+  8007e4:	48 01 d8             	add    %rbx,%rax
+  8007e7:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8007eb:	0f be c0             	movsbl %al,%eax
+  8007ee:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007f2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8007f6:	48 89 d6             	mov    %rdx,%rsi
+  8007f9:	89 c7                	mov    %eax,%edi
+  8007fb:	ff d1                	call   *%rcx
+}
+  8007fd:	90                   	nop
+  8007fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800802:	c9                   	leave
+  800803:	c3                   	ret
+
+0000000000800804 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800804:	55                   	push   %rbp
+  800805:	48 89 e5             	mov    %rsp,%rbp
+  800808:	48 83 ec 20          	sub    $0x20,%rsp
+  80080c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80080c <getuint+0x8>
+  800813:	49 bb 34 88 00 00 00 	movabs $0x8834,%r11
+  80081a:	00 00 00 
+  80081d:	4c 01 d8             	add    %r11,%rax
+  800820:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800824:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800827:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80082b:	7e 4f                	jle    80087c <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  80082d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800831:	8b 00                	mov    (%rax),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 24                	ja     80085c <getuint+0x58>
+  800838:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80083c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800840:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800844:	8b 00                	mov    (%rax),%eax
+  800846:	89 c0                	mov    %eax,%eax
+  800848:	48 01 d0             	add    %rdx,%rax
+  80084b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80084f:	8b 12                	mov    (%rdx),%edx
+  800851:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800854:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800858:	89 0a                	mov    %ecx,(%rdx)
+  80085a:	eb 14                	jmp    800870 <getuint+0x6c>
+  80085c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800860:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800864:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800868:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80086c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800870:	48 8b 00             	mov    (%rax),%rax
+  800873:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800877:	e9 9d 00 00 00       	jmp    800919 <getuint+0x115>
+	else if (lflag)
+  80087c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800880:	74 4c                	je     8008ce <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800882:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800886:	8b 00                	mov    (%rax),%eax
+  800888:	83 f8 2f             	cmp    $0x2f,%eax
+  80088b:	77 24                	ja     8008b1 <getuint+0xad>
+  80088d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800891:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800895:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800899:	8b 00                	mov    (%rax),%eax
+  80089b:	89 c0                	mov    %eax,%eax
+  80089d:	48 01 d0             	add    %rdx,%rax
+  8008a0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008a4:	8b 12                	mov    (%rdx),%edx
+  8008a6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008a9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008ad:	89 0a                	mov    %ecx,(%rdx)
+  8008af:	eb 14                	jmp    8008c5 <getuint+0xc1>
+  8008b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008b5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008b9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008bd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008c1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008c5:	48 8b 00             	mov    (%rax),%rax
+  8008c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8008cc:	eb 4b                	jmp    800919 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8008ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008d2:	8b 00                	mov    (%rax),%eax
+  8008d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d7:	77 24                	ja     8008fd <getuint+0xf9>
+  8008d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008dd:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008e5:	8b 00                	mov    (%rax),%eax
+  8008e7:	89 c0                	mov    %eax,%eax
+  8008e9:	48 01 d0             	add    %rdx,%rax
+  8008ec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008f0:	8b 12                	mov    (%rdx),%edx
+  8008f2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008f5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008f9:	89 0a                	mov    %ecx,(%rdx)
+  8008fb:	eb 14                	jmp    800911 <getuint+0x10d>
+  8008fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800901:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800905:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800909:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80090d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800911:	8b 00                	mov    (%rax),%eax
+  800913:	89 c0                	mov    %eax,%eax
+  800915:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800919:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80091d:	c9                   	leave
+  80091e:	c3                   	ret
+
+000000000080091f <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  80091f:	55                   	push   %rbp
+  800920:	48 89 e5             	mov    %rsp,%rbp
+  800923:	48 83 ec 20          	sub    $0x20,%rsp
+  800927:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800927 <printfloat+0x8>
+  80092e:	49 bb 19 87 00 00 00 	movabs $0x8719,%r11
+  800935:	00 00 00 
+  800938:	4c 01 d8             	add    %r11,%rax
+  80093b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80093f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800943:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800947:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80094b:	48 85 c0             	test   %rax,%rax
+  80094e:	79 12                	jns    800962 <printfloat+0x43>
+		putch('-',putdat);
+  800950:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800954:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800958:	48 89 c6             	mov    %rax,%rsi
+  80095b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800960:	ff d2                	call   *%rdx
+	
+}
+  800962:	90                   	nop
+  800963:	c9                   	leave
+  800964:	c3                   	ret
+
+0000000000800965 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800965:	55                   	push   %rbp
+  800966:	48 89 e5             	mov    %rsp,%rbp
+  800969:	48 83 ec 20          	sub    $0x20,%rsp
+  80096d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80096d <getint+0x8>
+  800974:	49 bb d3 86 00 00 00 	movabs $0x86d3,%r11
+  80097b:	00 00 00 
+  80097e:	4c 01 d8             	add    %r11,%rax
+  800981:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800985:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800988:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80098c:	7e 4f                	jle    8009dd <getint+0x78>
+		x=va_arg(*ap, long long);
+  80098e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800992:	8b 00                	mov    (%rax),%eax
+  800994:	83 f8 2f             	cmp    $0x2f,%eax
+  800997:	77 24                	ja     8009bd <getint+0x58>
+  800999:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80099d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a5:	8b 00                	mov    (%rax),%eax
+  8009a7:	89 c0                	mov    %eax,%eax
+  8009a9:	48 01 d0             	add    %rdx,%rax
+  8009ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009b0:	8b 12                	mov    (%rdx),%edx
+  8009b2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009b9:	89 0a                	mov    %ecx,(%rdx)
+  8009bb:	eb 14                	jmp    8009d1 <getint+0x6c>
+  8009bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009c5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009c9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009cd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009d1:	48 8b 00             	mov    (%rax),%rax
+  8009d4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009d8:	e9 9d 00 00 00       	jmp    800a7a <getint+0x115>
+	else if (lflag)
+  8009dd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8009e1:	74 4c                	je     800a2f <getint+0xca>
+		x=va_arg(*ap, long);
+  8009e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e7:	8b 00                	mov    (%rax),%eax
+  8009e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ec:	77 24                	ja     800a12 <getint+0xad>
+  8009ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009f2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009fa:	8b 00                	mov    (%rax),%eax
+  8009fc:	89 c0                	mov    %eax,%eax
+  8009fe:	48 01 d0             	add    %rdx,%rax
+  800a01:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a05:	8b 12                	mov    (%rdx),%edx
+  800a07:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a0a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a0e:	89 0a                	mov    %ecx,(%rdx)
+  800a10:	eb 14                	jmp    800a26 <getint+0xc1>
+  800a12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a16:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a1a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a1e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a22:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a26:	48 8b 00             	mov    (%rax),%rax
+  800a29:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a2d:	eb 4b                	jmp    800a7a <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800a2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a33:	8b 00                	mov    (%rax),%eax
+  800a35:	83 f8 2f             	cmp    $0x2f,%eax
+  800a38:	77 24                	ja     800a5e <getint+0xf9>
+  800a3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a3e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a46:	8b 00                	mov    (%rax),%eax
+  800a48:	89 c0                	mov    %eax,%eax
+  800a4a:	48 01 d0             	add    %rdx,%rax
+  800a4d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a51:	8b 12                	mov    (%rdx),%edx
+  800a53:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a56:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a5a:	89 0a                	mov    %ecx,(%rdx)
+  800a5c:	eb 14                	jmp    800a72 <getint+0x10d>
+  800a5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a62:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a66:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a6a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a6e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a72:	8b 00                	mov    (%rax),%eax
+  800a74:	48 98                	cltq
+  800a76:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a7e:	c9                   	leave
+  800a7f:	c3                   	ret
+
+0000000000800a80 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800a80:	55                   	push   %rbp
+  800a81:	48 89 e5             	mov    %rsp,%rbp
+  800a84:	41 57                	push   %r15
+  800a86:	41 55                	push   %r13
+  800a88:	41 54                	push   %r12
+  800a8a:	53                   	push   %rbx
+  800a8b:	48 83 ec 60          	sub    $0x60,%rsp
+  800a8f:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800a8f <vprintfmt+0xf>
+  800a96:	49 bb b1 85 00 00 00 	movabs $0x85b1,%r11
+  800a9d:	00 00 00 
+  800aa0:	4d 01 dc             	add    %r11,%r12
+  800aa3:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800aa7:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800aab:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800aaf:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800ab3:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800aba:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800abe:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800ac2:	48 8b 06             	mov    (%rsi),%rax
+  800ac5:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800ac9:	48 89 01             	mov    %rax,(%rcx)
+  800acc:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ad0:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ad4:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ad8:	eb 17                	jmp    800af1 <vprintfmt+0x71>
+			if (ch == '\0')
+  800ada:	85 db                	test   %ebx,%ebx
+  800adc:	0f 84 97 05 00 00    	je     801079 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800ae2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ae6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800aea:	48 89 c6             	mov    %rax,%rsi
+  800aed:	89 df                	mov    %ebx,%edi
+  800aef:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800af1:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800af5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800af9:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800afd:	0f b6 00             	movzbl (%rax),%eax
+  800b00:	0f b6 d8             	movzbl %al,%ebx
+  800b03:	83 fb 25             	cmp    $0x25,%ebx
+  800b06:	75 d2                	jne    800ada <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800b08:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800b0c:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800b13:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800b1a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800b21:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800b28:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b2c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b30:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800b34:	0f b6 00             	movzbl (%rax),%eax
+  800b37:	0f b6 d8             	movzbl %al,%ebx
+  800b3a:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800b3d:	83 f8 55             	cmp    $0x55,%eax
+  800b40:	0f 87 00 05 00 00    	ja     801046 <vprintfmt+0x5c6>
+  800b46:	89 c0                	mov    %eax,%eax
+  800b48:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800b4f:	00 
+  800b50:	48 8d 05 59 63 00 00 	lea    0x6359(%rip),%rax        # 806eb0 <.LC18+0xc>
+  800b57:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800b5b:	48 8d 15 4e 63 00 00 	lea    0x634e(%rip),%rdx        # 806eb0 <.LC18+0xc>
+  800b62:	48 01 d0             	add    %rdx,%rax
+  800b65:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800b67:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800b6b:	eb bb                	jmp    800b28 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800b6d:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800b71:	eb b5                	jmp    800b28 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800b73:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800b7a:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800b7d:	89 d0                	mov    %edx,%eax
+  800b7f:	c1 e0 02             	shl    $0x2,%eax
+  800b82:	01 d0                	add    %edx,%eax
+  800b84:	01 c0                	add    %eax,%eax
+  800b86:	01 d8                	add    %ebx,%eax
+  800b88:	83 e8 30             	sub    $0x30,%eax
+  800b8b:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800b8e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b92:	0f b6 00             	movzbl (%rax),%eax
+  800b95:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800b98:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b9b:	7e 60                	jle    800bfd <vprintfmt+0x17d>
+  800b9d:	83 fb 39             	cmp    $0x39,%ebx
+  800ba0:	7f 5b                	jg     800bfd <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800ba2:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800ba7:	eb d1                	jmp    800b7a <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800ba9:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800bac:	83 f8 2f             	cmp    $0x2f,%eax
+  800baf:	77 17                	ja     800bc8 <vprintfmt+0x148>
+  800bb1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800bb5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bb8:	89 d2                	mov    %edx,%edx
+  800bba:	48 01 d0             	add    %rdx,%rax
+  800bbd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800bc0:	83 c2 08             	add    $0x8,%edx
+  800bc3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800bc6:	eb 0c                	jmp    800bd4 <vprintfmt+0x154>
+  800bc8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bcc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bd0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800bd4:	8b 00                	mov    (%rax),%eax
+  800bd6:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800bd9:	eb 23                	jmp    800bfe <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800bdb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800bdf:	0f 89 43 ff ff ff    	jns    800b28 <vprintfmt+0xa8>
+				width = 0;
+  800be5:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800bec:	e9 37 ff ff ff       	jmp    800b28 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800bf1:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800bf8:	e9 2b ff ff ff       	jmp    800b28 <vprintfmt+0xa8>
+			goto process_precision;
+  800bfd:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800bfe:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c02:	0f 89 20 ff ff ff    	jns    800b28 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800c08:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800c0b:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800c0e:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800c15:	e9 0e ff ff ff       	jmp    800b28 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800c1a:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800c1e:	e9 05 ff ff ff       	jmp    800b28 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800c23:	83 fb 39             	cmp    $0x39,%ebx
+  800c26:	7f 0b                	jg     800c33 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800c28:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800c2b:	c1 e0 08             	shl    $0x8,%eax
+  800c2e:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800c31:	eb 21                	jmp    800c54 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800c33:	83 fb 60             	cmp    $0x60,%ebx
+  800c36:	7e 10                	jle    800c48 <vprintfmt+0x1c8>
+  800c38:	83 fb 66             	cmp    $0x66,%ebx
+  800c3b:	7f 0b                	jg     800c48 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800c3d:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800c40:	c1 e0 08             	shl    $0x8,%eax
+  800c43:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800c46:	eb 0c                	jmp    800c54 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800c48:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800c4f:	e9 04 01 00 00       	jmp    800d58 <vprintfmt+0x2d8>
+  800c54:	e9 ff 00 00 00       	jmp    800d58 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800c59:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5f:	77 17                	ja     800c78 <vprintfmt+0x1f8>
+  800c61:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c65:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c68:	89 d2                	mov    %edx,%edx
+  800c6a:	48 01 d0             	add    %rdx,%rax
+  800c6d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c70:	83 c2 08             	add    $0x8,%edx
+  800c73:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c76:	eb 0c                	jmp    800c84 <vprintfmt+0x204>
+  800c78:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c7c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c80:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c84:	8b 00                	mov    (%rax),%eax
+  800c86:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c8a:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c8e:	48 89 d6             	mov    %rdx,%rsi
+  800c91:	89 c7                	mov    %eax,%edi
+  800c93:	ff d1                	call   *%rcx
+			break;
+  800c95:	e9 da 03 00 00       	jmp    801074 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800c9a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c9d:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca0:	77 17                	ja     800cb9 <vprintfmt+0x239>
+  800ca2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ca6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ca9:	89 d2                	mov    %edx,%edx
+  800cab:	48 01 d0             	add    %rdx,%rax
+  800cae:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cb1:	83 c2 08             	add    $0x8,%edx
+  800cb4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cb7:	eb 0c                	jmp    800cc5 <vprintfmt+0x245>
+  800cb9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cbd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cc1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800cc5:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800cc7:	85 db                	test   %ebx,%ebx
+  800cc9:	79 02                	jns    800ccd <vprintfmt+0x24d>
+				err = -err;
+  800ccb:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800ccd:	83 fb 15             	cmp    $0x15,%ebx
+  800cd0:	7f 19                	jg     800ceb <vprintfmt+0x26b>
+  800cd2:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800cd9:	00 00 00 
+  800cdc:	48 63 c3             	movslq %ebx,%rax
+  800cdf:	4c 01 e2             	add    %r12,%rdx
+  800ce2:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800ce6:	4d 85 ed             	test   %r13,%r13
+  800ce9:	75 36                	jne    800d21 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800ceb:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800cef:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cf3:	89 d9                	mov    %ebx,%ecx
+  800cf5:	48 ba 58 de ff ff ff 	movabs $0xffffffffffffde58,%rdx
+  800cfc:	ff ff ff 
+  800cff:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800d03:	48 89 c7             	mov    %rax,%rdi
+  800d06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0b:	49 b8 47 80 ff ff ff 	movabs $0xffffffffffff8047,%r8
+  800d12:	ff ff ff 
+  800d15:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800d19:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800d1c:	e9 53 03 00 00       	jmp    801074 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800d21:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800d25:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800d29:	4c 89 e9             	mov    %r13,%rcx
+  800d2c:	48 ba 61 de ff ff ff 	movabs $0xffffffffffffde61,%rdx
+  800d33:	ff ff ff 
+  800d36:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800d3a:	48 89 c7             	mov    %rax,%rdi
+  800d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d42:	49 b8 47 80 ff ff ff 	movabs $0xffffffffffff8047,%r8
+  800d49:	ff ff ff 
+  800d4c:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800d50:	41 ff d0             	call   *%r8
+			break;
+  800d53:	e9 1c 03 00 00       	jmp    801074 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800d58:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d5b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d5e:	77 17                	ja     800d77 <vprintfmt+0x2f7>
+  800d60:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d64:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d67:	89 d2                	mov    %edx,%edx
+  800d69:	48 01 d0             	add    %rdx,%rax
+  800d6c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d6f:	83 c2 08             	add    $0x8,%edx
+  800d72:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d75:	eb 0c                	jmp    800d83 <vprintfmt+0x303>
+  800d77:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d7b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d7f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d83:	4c 8b 28             	mov    (%rax),%r13
+  800d86:	4d 85 ed             	test   %r13,%r13
+  800d89:	75 0e                	jne    800d99 <vprintfmt+0x319>
+				p = "(null)";
+  800d8b:	48 b8 64 de ff ff ff 	movabs $0xffffffffffffde64,%rax
+  800d92:	ff ff ff 
+  800d95:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800d99:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d9d:	0f 8e 84 00 00 00    	jle    800e27 <vprintfmt+0x3a7>
+  800da3:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800da7:	74 7e                	je     800e27 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800da9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800dac:	48 98                	cltq
+  800dae:	48 89 c6             	mov    %rax,%rsi
+  800db1:	4c 89 ef             	mov    %r13,%rdi
+  800db4:	4d 89 e7             	mov    %r12,%r15
+  800db7:	48 b8 6c 83 ff ff ff 	movabs $0xffffffffffff836c,%rax
+  800dbe:	ff ff ff 
+  800dc1:	4c 01 e0             	add    %r12,%rax
+  800dc4:	ff d0                	call   *%rax
+  800dc6:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800dc9:	eb 17                	jmp    800de2 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800dcb:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800dcf:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800dd3:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800dd7:	48 89 d6             	mov    %rdx,%rsi
+  800dda:	89 c7                	mov    %eax,%edi
+  800ddc:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800dde:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800de2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800de6:	7f e3                	jg     800dcb <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800de8:	eb 3d                	jmp    800e27 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800dea:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800dee:	74 1e                	je     800e0e <vprintfmt+0x38e>
+  800df0:	83 fb 1f             	cmp    $0x1f,%ebx
+  800df3:	7e 05                	jle    800dfa <vprintfmt+0x37a>
+  800df5:	83 fb 7e             	cmp    $0x7e,%ebx
+  800df8:	7e 14                	jle    800e0e <vprintfmt+0x38e>
+					putch('?', putdat);
+  800dfa:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dfe:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e02:	48 89 c6             	mov    %rax,%rsi
+  800e05:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800e0a:	ff d2                	call   *%rdx
+  800e0c:	eb 15                	jmp    800e23 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800e0e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800e11:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800e14:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e18:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e1c:	48 89 c6             	mov    %rax,%rsi
+  800e1f:	89 cf                	mov    %ecx,%edi
+  800e21:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e23:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e27:	4c 89 e8             	mov    %r13,%rax
+  800e2a:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800e2e:	0f b6 00             	movzbl (%rax),%eax
+  800e31:	0f be d8             	movsbl %al,%ebx
+  800e34:	85 db                	test   %ebx,%ebx
+  800e36:	74 28                	je     800e60 <vprintfmt+0x3e0>
+  800e38:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800e3c:	78 ac                	js     800dea <vprintfmt+0x36a>
+  800e3e:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800e42:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800e46:	79 a2                	jns    800dea <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800e48:	eb 16                	jmp    800e60 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800e4a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e4e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e52:	48 89 c6             	mov    %rax,%rsi
+  800e55:	bf 20 00 00 00       	mov    $0x20,%edi
+  800e5a:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800e5c:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e60:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e64:	7f e4                	jg     800e4a <vprintfmt+0x3ca>
+			break;
+  800e66:	e9 09 02 00 00       	jmp    801074 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800e6b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e6f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e73:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800e77:	0f b6 00             	movzbl (%rax),%eax
+  800e7a:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800e7d:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800e7e:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e81:	0f 8e ac fd ff ff    	jle    800c33 <vprintfmt+0x1b3>
+  800e87:	e9 97 fd ff ff       	jmp    800c23 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800e8c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e90:	be 03 00 00 00       	mov    $0x3,%esi
+  800e95:	48 89 c7             	mov    %rax,%rdi
+  800e98:	48 b8 25 79 ff ff ff 	movabs $0xffffffffffff7925,%rax
+  800e9f:	ff ff ff 
+  800ea2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ea6:	ff d0                	call   *%rax
+  800ea8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800eac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800eb0:	48 85 c0             	test   %rax,%rax
+  800eb3:	79 1d                	jns    800ed2 <vprintfmt+0x452>
+				putch('-', putdat);
+  800eb5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800eb9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ebd:	48 89 c6             	mov    %rax,%rsi
+  800ec0:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ec5:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800ec7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ecb:	48 f7 d8             	neg    %rax
+  800ece:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800ed2:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800ed9:	e9 de 00 00 00       	jmp    800fbc <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800ede:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ee2:	be 03 00 00 00       	mov    $0x3,%esi
+  800ee7:	48 89 c7             	mov    %rax,%rdi
+  800eea:	48 b8 c4 77 ff ff ff 	movabs $0xffffffffffff77c4,%rax
+  800ef1:	ff ff ff 
+  800ef4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ef8:	ff d0                	call   *%rax
+  800efa:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800efe:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800f05:	e9 b2 00 00 00       	jmp    800fbc <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800f0a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f0e:	be 03 00 00 00       	mov    $0x3,%esi
+  800f13:	48 89 c7             	mov    %rax,%rdi
+  800f16:	48 b8 c4 77 ff ff ff 	movabs $0xffffffffffff77c4,%rax
+  800f1d:	ff ff ff 
+  800f20:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f24:	ff d0                	call   *%rax
+  800f26:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800f2a:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800f31:	e9 86 00 00 00       	jmp    800fbc <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800f36:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f3a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f3e:	48 89 c6             	mov    %rax,%rsi
+  800f41:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f46:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800f48:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f4c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f50:	48 89 c6             	mov    %rax,%rsi
+  800f53:	bf 78 00 00 00       	mov    $0x78,%edi
+  800f58:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800f5a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800f60:	77 17                	ja     800f79 <vprintfmt+0x4f9>
+  800f62:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f66:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f69:	89 d2                	mov    %edx,%edx
+  800f6b:	48 01 d0             	add    %rdx,%rax
+  800f6e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f71:	83 c2 08             	add    $0x8,%edx
+  800f74:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f77:	eb 0c                	jmp    800f85 <vprintfmt+0x505>
+  800f79:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f7d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f81:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f85:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800f88:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f8c:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800f93:	eb 27                	jmp    800fbc <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800f95:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f99:	be 03 00 00 00       	mov    $0x3,%esi
+  800f9e:	48 89 c7             	mov    %rax,%rdi
+  800fa1:	48 b8 c4 77 ff ff ff 	movabs $0xffffffffffff77c4,%rax
+  800fa8:	ff ff ff 
+  800fab:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800faf:	ff d0                	call   *%rax
+  800fb1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800fb5:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800fbc:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800fc1:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800fc4:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800fc7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800fcb:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800fcf:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fd3:	45 89 c1             	mov    %r8d,%r9d
+  800fd6:	41 89 f8             	mov    %edi,%r8d
+  800fd9:	48 89 c7             	mov    %rax,%rdi
+  800fdc:	48 b8 ec 76 ff ff ff 	movabs $0xffffffffffff76ec,%rax
+  800fe3:	ff ff ff 
+  800fe6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fea:	ff d0                	call   *%rax
+			break;
+  800fec:	e9 83 00 00 00       	jmp    801074 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800ff1:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ff5:	be 03 00 00 00       	mov    $0x3,%esi
+  800ffa:	48 89 c7             	mov    %rax,%rdi
+  800ffd:	48 b8 c4 77 ff ff ff 	movabs $0xffffffffffff77c4,%rax
+  801004:	ff ff ff 
+  801007:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80100b:	ff d0                	call   *%rax
+  80100d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801011:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801015:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801019:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80101d:	48 89 ce             	mov    %rcx,%rsi
+  801020:	48 89 c7             	mov    %rax,%rdi
+  801023:	48 b8 df 78 ff ff ff 	movabs $0xffffffffffff78df,%rax
+  80102a:	ff ff ff 
+  80102d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801031:	ff d0                	call   *%rax
+	
+			break;
+  801033:	eb 3f                	jmp    801074 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801035:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801039:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80103d:	48 89 c6             	mov    %rax,%rsi
+  801040:	89 df                	mov    %ebx,%edi
+  801042:	ff d2                	call   *%rdx
+			break;
+  801044:	eb 2e                	jmp    801074 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801046:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80104a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80104e:	48 89 c6             	mov    %rax,%rsi
+  801051:	bf 25 00 00 00       	mov    $0x25,%edi
+  801056:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801058:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80105d:	eb 05                	jmp    801064 <vprintfmt+0x5e4>
+  80105f:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801064:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801068:	48 83 e8 01          	sub    $0x1,%rax
+  80106c:	0f b6 00             	movzbl (%rax),%eax
+  80106f:	3c 25                	cmp    $0x25,%al
+  801071:	75 ec                	jne    80105f <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801073:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801074:	e9 78 fa ff ff       	jmp    800af1 <vprintfmt+0x71>
+				return;
+  801079:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80107a:	48 83 c4 60          	add    $0x60,%rsp
+  80107e:	5b                   	pop    %rbx
+  80107f:	41 5c                	pop    %r12
+  801081:	41 5d                	pop    %r13
+  801083:	41 5f                	pop    %r15
+  801085:	5d                   	pop    %rbp
+  801086:	c3                   	ret
+
+0000000000801087 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801087:	55                   	push   %rbp
+  801088:	48 89 e5             	mov    %rsp,%rbp
+  80108b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801092:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801092 <printfmt+0xb>
+  801099:	49 bb ae 7f 00 00 00 	movabs $0x7fae,%r11
+  8010a0:	00 00 00 
+  8010a3:	4d 01 da             	add    %r11,%r10
+  8010a6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8010ad:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8010b4:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8010bb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010c2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010c9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010d0:	84 c0                	test   %al,%al
+  8010d2:	74 20                	je     8010f4 <printfmt+0x6d>
+  8010d4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010d8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010dc:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010e0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010e4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010e8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010ec:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010f0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8010f4:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8010fb:	00 00 00 
+  8010fe:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801105:	00 00 00 
+  801108:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80110c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801113:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80111a:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801121:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801128:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80112f:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801136:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80113d:	48 89 c7             	mov    %rax,%rdi
+  801140:	48 b8 40 7a ff ff ff 	movabs $0xffffffffffff7a40,%rax
+  801147:	ff ff ff 
+  80114a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80114e:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801150:	90                   	nop
+  801151:	c9                   	leave
+  801152:	c3                   	ret
+
+0000000000801153 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801153:	55                   	push   %rbp
+  801154:	48 89 e5             	mov    %rsp,%rbp
+  801157:	48 83 ec 10          	sub    $0x10,%rsp
+  80115b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80115b <sprintputch+0x8>
+  801162:	49 bb e5 7e 00 00 00 	movabs $0x7ee5,%r11
+  801169:	00 00 00 
+  80116c:	4c 01 d8             	add    %r11,%rax
+  80116f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801172:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801176:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80117a:	8b 40 10             	mov    0x10(%rax),%eax
+  80117d:	8d 50 01             	lea    0x1(%rax),%edx
+  801180:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801184:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801187:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80118b:	48 8b 10             	mov    (%rax),%rdx
+  80118e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801192:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801196:	48 39 c2             	cmp    %rax,%rdx
+  801199:	73 17                	jae    8011b2 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80119b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80119f:	48 8b 00             	mov    (%rax),%rax
+  8011a2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011a6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011aa:	48 89 0a             	mov    %rcx,(%rdx)
+  8011ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8011b0:	88 10                	mov    %dl,(%rax)
+}
+  8011b2:	90                   	nop
+  8011b3:	c9                   	leave
+  8011b4:	c3                   	ret
+
+00000000008011b5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8011b5:	55                   	push   %rbp
+  8011b6:	48 89 e5             	mov    %rsp,%rbp
+  8011b9:	53                   	push   %rbx
+  8011ba:	48 83 ec 58          	sub    $0x58,%rsp
+  8011be:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011be <vsnprintf+0x9>
+  8011c5:	49 bb 82 7e 00 00 00 	movabs $0x7e82,%r11
+  8011cc:	00 00 00 
+  8011cf:	4c 01 d8             	add    %r11,%rax
+  8011d2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8011d6:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8011d9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8011dd:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8011e1:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8011e5:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8011e9:	48 8b 0e             	mov    (%rsi),%rcx
+  8011ec:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8011f0:	48 89 0a             	mov    %rcx,(%rdx)
+  8011f3:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8011f7:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8011fb:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8011ff:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801203:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801207:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80120a:	48 63 d2             	movslq %edx,%rdx
+  80120d:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801211:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801215:	48 01 ca             	add    %rcx,%rdx
+  801218:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80121c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801223:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801228:	74 06                	je     801230 <vsnprintf+0x7b>
+  80122a:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  80122e:	7f 07                	jg     801237 <vsnprintf+0x82>
+		return -E_INVAL;
+  801230:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801235:	eb 34                	jmp    80126b <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801237:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  80123b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80123f:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801243:	48 bf 13 81 ff ff ff 	movabs $0xffffffffffff8113,%rdi
+  80124a:	ff ff ff 
+  80124d:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801251:	49 b8 40 7a ff ff ff 	movabs $0xffffffffffff7a40,%r8
+  801258:	ff ff ff 
+  80125b:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80125f:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801261:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801265:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801268:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80126b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80126f:	c9                   	leave
+  801270:	c3                   	ret
+
+0000000000801271 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801271:	55                   	push   %rbp
+  801272:	48 89 e5             	mov    %rsp,%rbp
+  801275:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80127c:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80127c <snprintf+0xb>
+  801283:	49 bb c4 7d 00 00 00 	movabs $0x7dc4,%r11
+  80128a:	00 00 00 
+  80128d:	4d 01 da             	add    %r11,%r10
+  801290:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801297:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80129d:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8012a4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8012ab:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8012b2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8012b9:	84 c0                	test   %al,%al
+  8012bb:	74 20                	je     8012dd <snprintf+0x6c>
+  8012bd:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8012c1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8012c5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012c9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8012cd:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012d1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8012d5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8012d9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8012dd:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8012e4:	00 00 00 
+  8012e7:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8012ee:	00 00 00 
+  8012f1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8012f5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8012fc:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801303:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80130a:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801311:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801318:	48 8b 06             	mov    (%rsi),%rax
+  80131b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80131f:	48 89 01             	mov    %rax,(%rcx)
+  801322:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801326:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80132a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80132e:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801335:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80133c:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801342:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801349:	48 89 c7             	mov    %rax,%rdi
+  80134c:	48 b8 75 81 ff ff ff 	movabs $0xffffffffffff8175,%rax
+  801353:	ff ff ff 
+  801356:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80135a:	ff d0                	call   *%rax
+  80135c:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801362:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801368:	c9                   	leave
+  801369:	c3                   	ret
+
+000000000080136a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80136a:	55                   	push   %rbp
+  80136b:	48 89 e5             	mov    %rsp,%rbp
+  80136e:	48 83 ec 18          	sub    $0x18,%rsp
+  801372:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801372 <strlen+0x8>
+  801379:	49 bb ce 7c 00 00 00 	movabs $0x7cce,%r11
+  801380:	00 00 00 
+  801383:	4c 01 d8             	add    %r11,%rax
+  801386:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80138a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801391:	eb 09                	jmp    80139c <strlen+0x32>
+		n++;
+  801393:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801397:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80139c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013a0:	0f b6 00             	movzbl (%rax),%eax
+  8013a3:	84 c0                	test   %al,%al
+  8013a5:	75 ec                	jne    801393 <strlen+0x29>
+	return n;
+  8013a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013aa:	c9                   	leave
+  8013ab:	c3                   	ret
+
+00000000008013ac <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8013ac:	55                   	push   %rbp
+  8013ad:	48 89 e5             	mov    %rsp,%rbp
+  8013b0:	48 83 ec 20          	sub    $0x20,%rsp
+  8013b4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013b4 <strnlen+0x8>
+  8013bb:	49 bb 8c 7c 00 00 00 	movabs $0x7c8c,%r11
+  8013c2:	00 00 00 
+  8013c5:	4c 01 d8             	add    %r11,%rax
+  8013c8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013cc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8013d7:	eb 0e                	jmp    8013e7 <strnlen+0x3b>
+		n++;
+  8013d9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8013dd:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8013e2:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8013e7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8013ec:	74 0b                	je     8013f9 <strnlen+0x4d>
+  8013ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013f2:	0f b6 00             	movzbl (%rax),%eax
+  8013f5:	84 c0                	test   %al,%al
+  8013f7:	75 e0                	jne    8013d9 <strnlen+0x2d>
+	return n;
+  8013f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013fc:	c9                   	leave
+  8013fd:	c3                   	ret
+
+00000000008013fe <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8013fe:	55                   	push   %rbp
+  8013ff:	48 89 e5             	mov    %rsp,%rbp
+  801402:	48 83 ec 20          	sub    $0x20,%rsp
+  801406:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801406 <strcpy+0x8>
+  80140d:	49 bb 3a 7c 00 00 00 	movabs $0x7c3a,%r11
+  801414:	00 00 00 
+  801417:	4c 01 d8             	add    %r11,%rax
+  80141a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80141e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801422:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801426:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80142a:	90                   	nop
+  80142b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80142f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801433:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801437:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80143b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80143f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801443:	0f b6 12             	movzbl (%rdx),%edx
+  801446:	88 10                	mov    %dl,(%rax)
+  801448:	0f b6 00             	movzbl (%rax),%eax
+  80144b:	84 c0                	test   %al,%al
+  80144d:	75 dc                	jne    80142b <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  80144f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801453:	c9                   	leave
+  801454:	c3                   	ret
+
+0000000000801455 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801455:	55                   	push   %rbp
+  801456:	48 89 e5             	mov    %rsp,%rbp
+  801459:	53                   	push   %rbx
+  80145a:	48 83 ec 20          	sub    $0x20,%rsp
+  80145e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80145e <strcat+0x9>
+  801465:	49 bb e2 7b 00 00 00 	movabs $0x7be2,%r11
+  80146c:	00 00 00 
+  80146f:	4c 01 db             	add    %r11,%rbx
+  801472:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801476:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80147a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80147e:	48 89 c7             	mov    %rax,%rdi
+  801481:	48 b8 2a 83 ff ff ff 	movabs $0xffffffffffff832a,%rax
+  801488:	ff ff ff 
+  80148b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80148f:	ff d0                	call   *%rax
+  801491:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801494:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801497:	48 63 d0             	movslq %eax,%rdx
+  80149a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80149e:	48 01 c2             	add    %rax,%rdx
+  8014a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014a5:	48 89 c6             	mov    %rax,%rsi
+  8014a8:	48 89 d7             	mov    %rdx,%rdi
+  8014ab:	48 b8 be 83 ff ff ff 	movabs $0xffffffffffff83be,%rax
+  8014b2:	ff ff ff 
+  8014b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8014b9:	ff d0                	call   *%rax
+	return dst;
+  8014bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8014bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c3:	c9                   	leave
+  8014c4:	c3                   	ret
+
+00000000008014c5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+  8014c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8014cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014cd <strncpy+0x8>
+  8014d4:	49 bb 73 7b 00 00 00 	movabs $0x7b73,%r11
+  8014db:	00 00 00 
+  8014de:	4c 01 d8             	add    %r11,%rax
+  8014e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014e9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8014ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014f1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8014f5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8014fc:	00 
+  8014fd:	eb 2a                	jmp    801529 <strncpy+0x64>
+		*dst++ = *src;
+  8014ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801503:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801507:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80150b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80150f:	0f b6 12             	movzbl (%rdx),%edx
+  801512:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801514:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801518:	0f b6 00             	movzbl (%rax),%eax
+  80151b:	84 c0                	test   %al,%al
+  80151d:	74 05                	je     801524 <strncpy+0x5f>
+			src++;
+  80151f:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801524:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801529:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80152d:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801531:	72 cc                	jb     8014ff <strncpy+0x3a>
+	}
+	return ret;
+  801533:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801537:	c9                   	leave
+  801538:	c3                   	ret
+
+0000000000801539 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801539:	55                   	push   %rbp
+  80153a:	48 89 e5             	mov    %rsp,%rbp
+  80153d:	48 83 ec 28          	sub    $0x28,%rsp
+  801541:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801541 <strlcpy+0x8>
+  801548:	49 bb ff 7a 00 00 00 	movabs $0x7aff,%r11
+  80154f:	00 00 00 
+  801552:	4c 01 d8             	add    %r11,%rax
+  801555:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801559:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80155d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801561:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801565:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801569:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80156e:	74 3d                	je     8015ad <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801570:	eb 1d                	jmp    80158f <strlcpy+0x56>
+			*dst++ = *src++;
+  801572:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801576:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80157a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80157e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801582:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801586:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80158a:	0f b6 12             	movzbl (%rdx),%edx
+  80158d:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80158f:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801594:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801599:	74 0b                	je     8015a6 <strlcpy+0x6d>
+  80159b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80159f:	0f b6 00             	movzbl (%rax),%eax
+  8015a2:	84 c0                	test   %al,%al
+  8015a4:	75 cc                	jne    801572 <strlcpy+0x39>
+		*dst = '\0';
+  8015a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015aa:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8015ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8015b5:	c9                   	leave
+  8015b6:	c3                   	ret
+
+00000000008015b7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8015b7:	55                   	push   %rbp
+  8015b8:	48 89 e5             	mov    %rsp,%rbp
+  8015bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8015bf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015bf <strcmp+0x8>
+  8015c6:	49 bb 81 7a 00 00 00 	movabs $0x7a81,%r11
+  8015cd:	00 00 00 
+  8015d0:	4c 01 d8             	add    %r11,%rax
+  8015d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8015db:	eb 0a                	jmp    8015e7 <strcmp+0x30>
+		p++, q++;
+  8015dd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015e2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8015e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015eb:	0f b6 00             	movzbl (%rax),%eax
+  8015ee:	84 c0                	test   %al,%al
+  8015f0:	74 12                	je     801604 <strcmp+0x4d>
+  8015f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015f6:	0f b6 10             	movzbl (%rax),%edx
+  8015f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015fd:	0f b6 00             	movzbl (%rax),%eax
+  801600:	38 c2                	cmp    %al,%dl
+  801602:	74 d9                	je     8015dd <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801604:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801608:	0f b6 00             	movzbl (%rax),%eax
+  80160b:	0f b6 d0             	movzbl %al,%edx
+  80160e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801612:	0f b6 00             	movzbl (%rax),%eax
+  801615:	0f b6 c0             	movzbl %al,%eax
+  801618:	29 c2                	sub    %eax,%edx
+  80161a:	89 d0                	mov    %edx,%eax
+}
+  80161c:	c9                   	leave
+  80161d:	c3                   	ret
+
+000000000080161e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80161e:	55                   	push   %rbp
+  80161f:	48 89 e5             	mov    %rsp,%rbp
+  801622:	48 83 ec 18          	sub    $0x18,%rsp
+  801626:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801626 <strncmp+0x8>
+  80162d:	49 bb 1a 7a 00 00 00 	movabs $0x7a1a,%r11
+  801634:	00 00 00 
+  801637:	4c 01 d8             	add    %r11,%rax
+  80163a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80163e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801642:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801646:	eb 0f                	jmp    801657 <strncmp+0x39>
+		n--, p++, q++;
+  801648:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80164d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801652:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801657:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80165c:	74 1d                	je     80167b <strncmp+0x5d>
+  80165e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801662:	0f b6 00             	movzbl (%rax),%eax
+  801665:	84 c0                	test   %al,%al
+  801667:	74 12                	je     80167b <strncmp+0x5d>
+  801669:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80166d:	0f b6 10             	movzbl (%rax),%edx
+  801670:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801674:	0f b6 00             	movzbl (%rax),%eax
+  801677:	38 c2                	cmp    %al,%dl
+  801679:	74 cd                	je     801648 <strncmp+0x2a>
+	if (n == 0)
+  80167b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801680:	75 07                	jne    801689 <strncmp+0x6b>
+		return 0;
+  801682:	ba 00 00 00 00       	mov    $0x0,%edx
+  801687:	eb 16                	jmp    80169f <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801689:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80168d:	0f b6 00             	movzbl (%rax),%eax
+  801690:	0f b6 d0             	movzbl %al,%edx
+  801693:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801697:	0f b6 00             	movzbl (%rax),%eax
+  80169a:	0f b6 c0             	movzbl %al,%eax
+  80169d:	29 c2                	sub    %eax,%edx
+}
+  80169f:	89 d0                	mov    %edx,%eax
+  8016a1:	c9                   	leave
+  8016a2:	c3                   	ret
+
+00000000008016a3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8016a3:	55                   	push   %rbp
+  8016a4:	48 89 e5             	mov    %rsp,%rbp
+  8016a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8016ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016ab <strchr+0x8>
+  8016b2:	49 bb 95 79 00 00 00 	movabs $0x7995,%r11
+  8016b9:	00 00 00 
+  8016bc:	4c 01 d8             	add    %r11,%rax
+  8016bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016c3:	89 f0                	mov    %esi,%eax
+  8016c5:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8016c8:	eb 17                	jmp    8016e1 <strchr+0x3e>
+		if (*s == c)
+  8016ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ce:	0f b6 00             	movzbl (%rax),%eax
+  8016d1:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016d4:	75 06                	jne    8016dc <strchr+0x39>
+			return (char *) s;
+  8016d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016da:	eb 15                	jmp    8016f1 <strchr+0x4e>
+	for (; *s; s++)
+  8016dc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016e5:	0f b6 00             	movzbl (%rax),%eax
+  8016e8:	84 c0                	test   %al,%al
+  8016ea:	75 de                	jne    8016ca <strchr+0x27>
+	return 0;
+  8016ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016f1:	c9                   	leave
+  8016f2:	c3                   	ret
+
+00000000008016f3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8016f3:	55                   	push   %rbp
+  8016f4:	48 89 e5             	mov    %rsp,%rbp
+  8016f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8016fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016fb <strfind+0x8>
+  801702:	49 bb 45 79 00 00 00 	movabs $0x7945,%r11
+  801709:	00 00 00 
+  80170c:	4c 01 d8             	add    %r11,%rax
+  80170f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801713:	89 f0                	mov    %esi,%eax
+  801715:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801718:	eb 11                	jmp    80172b <strfind+0x38>
+		if (*s == c)
+  80171a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80171e:	0f b6 00             	movzbl (%rax),%eax
+  801721:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801724:	74 12                	je     801738 <strfind+0x45>
+	for (; *s; s++)
+  801726:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80172b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172f:	0f b6 00             	movzbl (%rax),%eax
+  801732:	84 c0                	test   %al,%al
+  801734:	75 e4                	jne    80171a <strfind+0x27>
+  801736:	eb 01                	jmp    801739 <strfind+0x46>
+			break;
+  801738:	90                   	nop
+	return (char *) s;
+  801739:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80173d:	c9                   	leave
+  80173e:	c3                   	ret
+
+000000000080173f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80173f:	55                   	push   %rbp
+  801740:	48 89 e5             	mov    %rsp,%rbp
+  801743:	48 83 ec 18          	sub    $0x18,%rsp
+  801747:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801747 <memset+0x8>
+  80174e:	49 bb f9 78 00 00 00 	movabs $0x78f9,%r11
+  801755:	00 00 00 
+  801758:	4c 01 d8             	add    %r11,%rax
+  80175b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80175f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801762:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801766:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80176b:	75 06                	jne    801773 <memset+0x34>
+		return v;
+  80176d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801771:	eb 69                	jmp    8017dc <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801777:	83 e0 03             	and    $0x3,%eax
+  80177a:	48 85 c0             	test   %rax,%rax
+  80177d:	75 48                	jne    8017c7 <memset+0x88>
+  80177f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801783:	83 e0 03             	and    $0x3,%eax
+  801786:	48 85 c0             	test   %rax,%rax
+  801789:	75 3c                	jne    8017c7 <memset+0x88>
+		c &= 0xFF;
+  80178b:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801792:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801795:	c1 e0 18             	shl    $0x18,%eax
+  801798:	89 c2                	mov    %eax,%edx
+  80179a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80179d:	c1 e0 10             	shl    $0x10,%eax
+  8017a0:	09 c2                	or     %eax,%edx
+  8017a2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017a5:	c1 e0 08             	shl    $0x8,%eax
+  8017a8:	09 d0                	or     %edx,%eax
+  8017aa:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8017ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b1:	48 c1 e8 02          	shr    $0x2,%rax
+  8017b5:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8017b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017bc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017bf:	48 89 d7             	mov    %rdx,%rdi
+  8017c2:	fc                   	cld
+  8017c3:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8017c5:	eb 11                	jmp    8017d8 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8017c7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017cb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017ce:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8017d2:	48 89 d7             	mov    %rdx,%rdi
+  8017d5:	fc                   	cld
+  8017d6:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8017d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017dc:	c9                   	leave
+  8017dd:	c3                   	ret
+
+00000000008017de <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8017de:	55                   	push   %rbp
+  8017df:	48 89 e5             	mov    %rsp,%rbp
+  8017e2:	48 83 ec 28          	sub    $0x28,%rsp
+  8017e6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017e6 <memmove+0x8>
+  8017ed:	49 bb 5a 78 00 00 00 	movabs $0x785a,%r11
+  8017f4:	00 00 00 
+  8017f7:	4c 01 d8             	add    %r11,%rax
+  8017fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801802:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801806:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80180a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  80180e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801812:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801816:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181a:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80181e:	0f 83 88 00 00 00    	jae    8018ac <memmove+0xce>
+  801824:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801828:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80182c:	48 01 d0             	add    %rdx,%rax
+  80182f:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801833:	73 77                	jae    8018ac <memmove+0xce>
+		s += n;
+  801835:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801839:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80183d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801841:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801845:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801849:	83 e0 03             	and    $0x3,%eax
+  80184c:	48 85 c0             	test   %rax,%rax
+  80184f:	75 3b                	jne    80188c <memmove+0xae>
+  801851:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801855:	83 e0 03             	and    $0x3,%eax
+  801858:	48 85 c0             	test   %rax,%rax
+  80185b:	75 2f                	jne    80188c <memmove+0xae>
+  80185d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801861:	83 e0 03             	and    $0x3,%eax
+  801864:	48 85 c0             	test   %rax,%rax
+  801867:	75 23                	jne    80188c <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801869:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186d:	48 83 e8 04          	sub    $0x4,%rax
+  801871:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801875:	48 83 ea 04          	sub    $0x4,%rdx
+  801879:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80187d:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801881:	48 89 c7             	mov    %rax,%rdi
+  801884:	48 89 d6             	mov    %rdx,%rsi
+  801887:	fd                   	std
+  801888:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80188a:	eb 1d                	jmp    8018a9 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80188c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801890:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801894:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801898:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  80189c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a0:	48 89 d7             	mov    %rdx,%rdi
+  8018a3:	48 89 c1             	mov    %rax,%rcx
+  8018a6:	fd                   	std
+  8018a7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8018a9:	fc                   	cld
+  8018aa:	eb 57                	jmp    801903 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8018ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018b0:	83 e0 03             	and    $0x3,%eax
+  8018b3:	48 85 c0             	test   %rax,%rax
+  8018b6:	75 36                	jne    8018ee <memmove+0x110>
+  8018b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018bc:	83 e0 03             	and    $0x3,%eax
+  8018bf:	48 85 c0             	test   %rax,%rax
+  8018c2:	75 2a                	jne    8018ee <memmove+0x110>
+  8018c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c8:	83 e0 03             	and    $0x3,%eax
+  8018cb:	48 85 c0             	test   %rax,%rax
+  8018ce:	75 1e                	jne    8018ee <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8018d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d4:	48 c1 e8 02          	shr    $0x2,%rax
+  8018d8:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8018db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018e3:	48 89 c7             	mov    %rax,%rdi
+  8018e6:	48 89 d6             	mov    %rdx,%rsi
+  8018e9:	fc                   	cld
+  8018ea:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8018ec:	eb 15                	jmp    801903 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8018ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018f6:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8018fa:	48 89 c7             	mov    %rax,%rdi
+  8018fd:	48 89 d6             	mov    %rdx,%rsi
+  801900:	fc                   	cld
+  801901:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801903:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801907:	c9                   	leave
+  801908:	c3                   	ret
+
+0000000000801909 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801909:	55                   	push   %rbp
+  80190a:	48 89 e5             	mov    %rsp,%rbp
+  80190d:	48 83 ec 18          	sub    $0x18,%rsp
+  801911:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801911 <memcpy+0x8>
+  801918:	49 bb 2f 77 00 00 00 	movabs $0x772f,%r11
+  80191f:	00 00 00 
+  801922:	4c 01 d8             	add    %r11,%rax
+  801925:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801929:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80192d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801931:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801935:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801939:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80193d:	48 89 cf             	mov    %rcx,%rdi
+  801940:	48 b9 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rcx
+  801947:	ff ff ff 
+  80194a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80194e:	ff d0                	call   *%rax
+}
+  801950:	c9                   	leave
+  801951:	c3                   	ret
+
+0000000000801952 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801952:	55                   	push   %rbp
+  801953:	48 89 e5             	mov    %rsp,%rbp
+  801956:	48 83 ec 28          	sub    $0x28,%rsp
+  80195a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80195a <memcmp+0x8>
+  801961:	49 bb e6 76 00 00 00 	movabs $0x76e6,%r11
+  801968:	00 00 00 
+  80196b:	4c 01 d8             	add    %r11,%rax
+  80196e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801972:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801976:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80197a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80197e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801982:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801986:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80198a:	eb 34                	jmp    8019c0 <memcmp+0x6e>
+		if (*s1 != *s2)
+  80198c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801990:	0f b6 10             	movzbl (%rax),%edx
+  801993:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801997:	0f b6 00             	movzbl (%rax),%eax
+  80199a:	38 c2                	cmp    %al,%dl
+  80199c:	74 18                	je     8019b6 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  80199e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a2:	0f b6 00             	movzbl (%rax),%eax
+  8019a5:	0f b6 d0             	movzbl %al,%edx
+  8019a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ac:	0f b6 00             	movzbl (%rax),%eax
+  8019af:	0f b6 c0             	movzbl %al,%eax
+  8019b2:	29 c2                	sub    %eax,%edx
+  8019b4:	eb 20                	jmp    8019d6 <memcmp+0x84>
+		s1++, s2++;
+  8019b6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019bb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8019c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019c8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8019cc:	48 85 c0             	test   %rax,%rax
+  8019cf:	75 bb                	jne    80198c <memcmp+0x3a>
+	}
+
+	return 0;
+  8019d1:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8019d6:	89 d0                	mov    %edx,%eax
+  8019d8:	c9                   	leave
+  8019d9:	c3                   	ret
+
+00000000008019da <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8019da:	55                   	push   %rbp
+  8019db:	48 89 e5             	mov    %rsp,%rbp
+  8019de:	48 83 ec 28          	sub    $0x28,%rsp
+  8019e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019e2 <memfind+0x8>
+  8019e9:	49 bb 5e 76 00 00 00 	movabs $0x765e,%r11
+  8019f0:	00 00 00 
+  8019f3:	4c 01 d8             	add    %r11,%rax
+  8019f6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019fa:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8019fd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801a01:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a09:	48 01 d0             	add    %rdx,%rax
+  801a0c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801a10:	eb 13                	jmp    801a25 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801a12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a16:	0f b6 00             	movzbl (%rax),%eax
+  801a19:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801a1c:	38 d0                	cmp    %dl,%al
+  801a1e:	74 11                	je     801a31 <memfind+0x57>
+	for (; s < ends; s++)
+  801a20:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801a25:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a29:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801a2d:	72 e3                	jb     801a12 <memfind+0x38>
+  801a2f:	eb 01                	jmp    801a32 <memfind+0x58>
+			break;
+  801a31:	90                   	nop
+	return (void *) s;
+  801a32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a36:	c9                   	leave
+  801a37:	c3                   	ret
+
+0000000000801a38 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	48 83 ec 38          	sub    $0x38,%rsp
+  801a40:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a40 <strtol+0x8>
+  801a47:	49 bb 00 76 00 00 00 	movabs $0x7600,%r11
+  801a4e:	00 00 00 
+  801a51:	4c 01 d8             	add    %r11,%rax
+  801a54:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a58:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a5c:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801a5f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801a66:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801a6d:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801a6e:	eb 05                	jmp    801a75 <strtol+0x3d>
+		s++;
+  801a70:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801a75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a79:	0f b6 00             	movzbl (%rax),%eax
+  801a7c:	3c 20                	cmp    $0x20,%al
+  801a7e:	74 f0                	je     801a70 <strtol+0x38>
+  801a80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a84:	0f b6 00             	movzbl (%rax),%eax
+  801a87:	3c 09                	cmp    $0x9,%al
+  801a89:	74 e5                	je     801a70 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801a8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a8f:	0f b6 00             	movzbl (%rax),%eax
+  801a92:	3c 2b                	cmp    $0x2b,%al
+  801a94:	75 07                	jne    801a9d <strtol+0x65>
+		s++;
+  801a96:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a9b:	eb 17                	jmp    801ab4 <strtol+0x7c>
+	else if (*s == '-')
+  801a9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa1:	0f b6 00             	movzbl (%rax),%eax
+  801aa4:	3c 2d                	cmp    $0x2d,%al
+  801aa6:	75 0c                	jne    801ab4 <strtol+0x7c>
+		s++, neg = 1;
+  801aa8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801aad:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801ab4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ab8:	74 06                	je     801ac0 <strtol+0x88>
+  801aba:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801abe:	75 28                	jne    801ae8 <strtol+0xb0>
+  801ac0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ac4:	0f b6 00             	movzbl (%rax),%eax
+  801ac7:	3c 30                	cmp    $0x30,%al
+  801ac9:	75 1d                	jne    801ae8 <strtol+0xb0>
+  801acb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801acf:	48 83 c0 01          	add    $0x1,%rax
+  801ad3:	0f b6 00             	movzbl (%rax),%eax
+  801ad6:	3c 78                	cmp    $0x78,%al
+  801ad8:	75 0e                	jne    801ae8 <strtol+0xb0>
+		s += 2, base = 16;
+  801ada:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801adf:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801ae6:	eb 2c                	jmp    801b14 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801ae8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801aec:	75 19                	jne    801b07 <strtol+0xcf>
+  801aee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801af2:	0f b6 00             	movzbl (%rax),%eax
+  801af5:	3c 30                	cmp    $0x30,%al
+  801af7:	75 0e                	jne    801b07 <strtol+0xcf>
+		s++, base = 8;
+  801af9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801afe:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801b05:	eb 0d                	jmp    801b14 <strtol+0xdc>
+	else if (base == 0)
+  801b07:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b0b:	75 07                	jne    801b14 <strtol+0xdc>
+		base = 10;
+  801b0d:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801b14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b18:	0f b6 00             	movzbl (%rax),%eax
+  801b1b:	3c 2f                	cmp    $0x2f,%al
+  801b1d:	7e 1d                	jle    801b3c <strtol+0x104>
+  801b1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b23:	0f b6 00             	movzbl (%rax),%eax
+  801b26:	3c 39                	cmp    $0x39,%al
+  801b28:	7f 12                	jg     801b3c <strtol+0x104>
+			dig = *s - '0';
+  801b2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b2e:	0f b6 00             	movzbl (%rax),%eax
+  801b31:	0f be c0             	movsbl %al,%eax
+  801b34:	83 e8 30             	sub    $0x30,%eax
+  801b37:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801b3a:	eb 4e                	jmp    801b8a <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801b3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b40:	0f b6 00             	movzbl (%rax),%eax
+  801b43:	3c 60                	cmp    $0x60,%al
+  801b45:	7e 1d                	jle    801b64 <strtol+0x12c>
+  801b47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b4b:	0f b6 00             	movzbl (%rax),%eax
+  801b4e:	3c 7a                	cmp    $0x7a,%al
+  801b50:	7f 12                	jg     801b64 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801b52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b56:	0f b6 00             	movzbl (%rax),%eax
+  801b59:	0f be c0             	movsbl %al,%eax
+  801b5c:	83 e8 57             	sub    $0x57,%eax
+  801b5f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801b62:	eb 26                	jmp    801b8a <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801b64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b68:	0f b6 00             	movzbl (%rax),%eax
+  801b6b:	3c 40                	cmp    $0x40,%al
+  801b6d:	7e 47                	jle    801bb6 <strtol+0x17e>
+  801b6f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b73:	0f b6 00             	movzbl (%rax),%eax
+  801b76:	3c 5a                	cmp    $0x5a,%al
+  801b78:	7f 3c                	jg     801bb6 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801b7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b7e:	0f b6 00             	movzbl (%rax),%eax
+  801b81:	0f be c0             	movsbl %al,%eax
+  801b84:	83 e8 37             	sub    $0x37,%eax
+  801b87:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801b8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b8d:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801b90:	7d 23                	jge    801bb5 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801b92:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b97:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801b9a:	48 98                	cltq
+  801b9c:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801ba1:	48 89 c2             	mov    %rax,%rdx
+  801ba4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ba7:	48 98                	cltq
+  801ba9:	48 01 d0             	add    %rdx,%rax
+  801bac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801bb0:	e9 5f ff ff ff       	jmp    801b14 <strtol+0xdc>
+			break;
+  801bb5:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801bb6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801bbb:	74 0b                	je     801bc8 <strtol+0x190>
+		*endptr = (char *) s;
+  801bbd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801bc5:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801bc8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801bcc:	74 09                	je     801bd7 <strtol+0x19f>
+  801bce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bd2:	48 f7 d8             	neg    %rax
+  801bd5:	eb 04                	jmp    801bdb <strtol+0x1a3>
+  801bd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801bdb:	c9                   	leave
+  801bdc:	c3                   	ret
+
+0000000000801bdd <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801bdd:	55                   	push   %rbp
+  801bde:	48 89 e5             	mov    %rsp,%rbp
+  801be1:	53                   	push   %rbx
+  801be2:	48 83 ec 30          	sub    $0x30,%rsp
+  801be6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801be6 <strstr+0x9>
+  801bed:	49 bb 5a 74 00 00 00 	movabs $0x745a,%r11
+  801bf4:	00 00 00 
+  801bf7:	4c 01 db             	add    %r11,%rbx
+  801bfa:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801bfe:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801c02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c06:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c0a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c0e:	0f b6 00             	movzbl (%rax),%eax
+  801c11:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801c14:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801c18:	75 06                	jne    801c20 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801c1a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c1e:	eb 73                	jmp    801c93 <strstr+0xb6>
+
+	len = strlen(str);
+  801c20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c24:	48 89 c7             	mov    %rax,%rdi
+  801c27:	48 b8 2a 83 ff ff ff 	movabs $0xffffffffffff832a,%rax
+  801c2e:	ff ff ff 
+  801c31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c35:	ff d0                	call   *%rax
+  801c37:	48 98                	cltq
+  801c39:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801c3d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c41:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c45:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801c49:	0f b6 00             	movzbl (%rax),%eax
+  801c4c:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801c4f:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801c53:	75 07                	jne    801c5c <strstr+0x7f>
+				return (char *) 0;
+  801c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5a:	eb 37                	jmp    801c93 <strstr+0xb6>
+		} while (sc != c);
+  801c5c:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801c60:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801c63:	75 d8                	jne    801c3d <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801c65:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c69:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c71:	48 89 ce             	mov    %rcx,%rsi
+  801c74:	48 89 c7             	mov    %rax,%rdi
+  801c77:	48 b8 de 85 ff ff ff 	movabs $0xffffffffffff85de,%rax
+  801c7e:	ff ff ff 
+  801c81:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c85:	ff d0                	call   *%rax
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	75 b2                	jne    801c3d <strstr+0x60>
+
+	return (char *) (in - 1);
+  801c8b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c8f:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801c93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c97:	c9                   	leave
+  801c98:	c3                   	ret
+
+0000000000801c99 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801c99:	55                   	push   %rbp
+  801c9a:	48 89 e5             	mov    %rsp,%rbp
+  801c9d:	41 57                	push   %r15
+  801c9f:	53                   	push   %rbx
+  801ca0:	48 83 ec 40          	sub    $0x40,%rsp
+  801ca4:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801ca4 <syscall+0xb>
+  801cab:	49 bb 9c 73 00 00 00 	movabs $0x739c,%r11
+  801cb2:	00 00 00 
+  801cb5:	4d 01 da             	add    %r11,%r10
+  801cb8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801cbb:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801cbe:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801cc2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801cc6:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801cca:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801cce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801cd1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801cd5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801cd9:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801cdd:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801ce1:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ce5:	4c 89 c3             	mov    %r8,%rbx
+  801ce8:	cd 30                	int    $0x30
+  801cea:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801cee:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801cf2:	74 52                	je     801d46 <syscall+0xad>
+  801cf4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801cf9:	7e 4b                	jle    801d46 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801cfb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801d02:	49 89 d0             	mov    %rdx,%r8
+  801d05:	89 c1                	mov    %eax,%ecx
+  801d07:	48 b8 20 e1 ff ff ff 	movabs $0xffffffffffffe120,%rax
+  801d0e:	ff ff ff 
+  801d11:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801d15:	48 89 c2             	mov    %rax,%rdx
+  801d18:	be 23 00 00 00       	mov    $0x23,%esi
+  801d1d:	48 b8 3d e1 ff ff ff 	movabs $0xffffffffffffe13d,%rax
+  801d24:	ff ff ff 
+  801d27:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801d2b:	48 89 c7             	mov    %rax,%rdi
+  801d2e:	4d 89 d7             	mov    %r10,%r15
+  801d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d36:	49 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%r9
+  801d3d:	ff ff ff 
+  801d40:	4d 01 d1             	add    %r10,%r9
+  801d43:	41 ff d1             	call   *%r9
+
+	return ret;
+  801d46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d4a:	48 83 c4 40          	add    $0x40,%rsp
+  801d4e:	5b                   	pop    %rbx
+  801d4f:	41 5f                	pop    %r15
+  801d51:	5d                   	pop    %rbp
+  801d52:	c3                   	ret
+
+0000000000801d53 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801d53:	55                   	push   %rbp
+  801d54:	48 89 e5             	mov    %rsp,%rbp
+  801d57:	41 57                	push   %r15
+  801d59:	41 56                	push   %r14
+  801d5b:	41 55                	push   %r13
+  801d5d:	41 54                	push   %r12
+  801d5f:	53                   	push   %rbx
+  801d60:	48 83 ec 48          	sub    $0x48,%rsp
+  801d64:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801d64 <syscall_words+0x11>
+  801d6b:	49 bb dc 72 00 00 00 	movabs $0x72dc,%r11
+  801d72:	00 00 00 
+  801d75:	4d 01 de             	add    %r11,%r14
+  801d78:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801d7b:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801d7e:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801d82:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801d86:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801d8a:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801d8e:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d93:	74 09                	je     801d9e <syscall_words+0x4b>
+  801d95:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d99:	48 8b 00             	mov    (%rax),%rax
+  801d9c:	eb 05                	jmp    801da3 <syscall_words+0x50>
+  801d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da3:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801da6:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dab:	74 0a                	je     801db7 <syscall_words+0x64>
+  801dad:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801db1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801db5:	eb 05                	jmp    801dbc <syscall_words+0x69>
+  801db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dbc:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801dbf:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dc4:	74 0a                	je     801dd0 <syscall_words+0x7d>
+  801dc6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dca:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801dce:	eb 05                	jmp    801dd5 <syscall_words+0x82>
+  801dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd5:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801dd8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ddd:	74 0a                	je     801de9 <syscall_words+0x96>
+  801ddf:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801de3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801de7:	eb 05                	jmp    801dee <syscall_words+0x9b>
+  801de9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dee:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801df1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801df6:	74 0a                	je     801e02 <syscall_words+0xaf>
+  801df8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dfc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801e00:	eb 05                	jmp    801e07 <syscall_words+0xb4>
+  801e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e07:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801e0a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e0f:	74 0a                	je     801e1b <syscall_words+0xc8>
+  801e11:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e15:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801e19:	eb 05                	jmp    801e20 <syscall_words+0xcd>
+  801e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e20:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801e23:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801e26:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801e2a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801e2e:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801e32:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801e36:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e3a:	cd 30                	int    $0x30
+  801e3c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801e40:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801e45:	74 50                	je     801e97 <syscall_words+0x144>
+		words[0] = r8;
+  801e47:	4c 89 c2             	mov    %r8,%rdx
+  801e4a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e4e:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801e51:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e55:	48 83 c0 08          	add    $0x8,%rax
+  801e59:	4c 89 ca             	mov    %r9,%rdx
+  801e5c:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801e5f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e63:	48 83 c0 10          	add    $0x10,%rax
+  801e67:	4c 89 d2             	mov    %r10,%rdx
+  801e6a:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801e6d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e71:	48 83 c0 18          	add    $0x18,%rax
+  801e75:	4c 89 da             	mov    %r11,%rdx
+  801e78:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801e7b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e7f:	48 83 c0 20          	add    $0x20,%rax
+  801e83:	4c 89 e2             	mov    %r12,%rdx
+  801e86:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801e89:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e8d:	48 83 c0 28          	add    $0x28,%rax
+  801e91:	4c 89 ea             	mov    %r13,%rdx
+  801e94:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801e97:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801e9b:	74 52                	je     801eef <syscall_words+0x19c>
+  801e9d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801ea2:	7e 4b                	jle    801eef <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ea4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ea8:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801eab:	49 89 d0             	mov    %rdx,%r8
+  801eae:	89 c1                	mov    %eax,%ecx
+  801eb0:	48 b8 20 e1 ff ff ff 	movabs $0xffffffffffffe120,%rax
+  801eb7:	ff ff ff 
+  801eba:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801ebe:	48 89 c2             	mov    %rax,%rdx
+  801ec1:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801ec6:	48 b8 3d e1 ff ff ff 	movabs $0xffffffffffffe13d,%rax
+  801ecd:	ff ff ff 
+  801ed0:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801ed4:	48 89 c7             	mov    %rax,%rdi
+  801ed7:	4d 89 f7             	mov    %r14,%r15
+  801eda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801edf:	49 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%r9
+  801ee6:	ff ff ff 
+  801ee9:	4d 01 f1             	add    %r14,%r9
+  801eec:	41 ff d1             	call   *%r9
+
+	return ret;
+  801eef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801ef3:	48 83 c4 48          	add    $0x48,%rsp
+  801ef7:	5b                   	pop    %rbx
+  801ef8:	41 5c                	pop    %r12
+  801efa:	41 5d                	pop    %r13
+  801efc:	41 5e                	pop    %r14
+  801efe:	41 5f                	pop    %r15
+  801f00:	5d                   	pop    %rbp
+  801f01:	c3                   	ret
+
+0000000000801f02 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801f02:	55                   	push   %rbp
+  801f03:	48 89 e5             	mov    %rsp,%rbp
+  801f06:	48 83 ec 10          	sub    $0x10,%rsp
+  801f0a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f0a <sys_cputs+0x8>
+  801f11:	49 bb 36 71 00 00 00 	movabs $0x7136,%r11
+  801f18:	00 00 00 
+  801f1b:	4c 01 d8             	add    %r11,%rax
+  801f1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f22:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801f26:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f2a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f2e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f32:	6a 00                	push   $0x0
+  801f34:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f40:	be 00 00 00 00       	mov    $0x0,%esi
+  801f45:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f4a:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  801f51:	ff ff ff 
+  801f54:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f58:	ff d0                	call   *%rax
+  801f5a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f5e:	90                   	nop
+  801f5f:	c9                   	leave
+  801f60:	c3                   	ret
+
+0000000000801f61 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801f61:	55                   	push   %rbp
+  801f62:	48 89 e5             	mov    %rsp,%rbp
+  801f65:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f65 <sys_cgetc+0x4>
+  801f6c:	49 bb db 70 00 00 00 	movabs $0x70db,%r11
+  801f73:	00 00 00 
+  801f76:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801f79:	48 83 ec 08          	sub    $0x8,%rsp
+  801f7d:	6a 00                	push   $0x0
+  801f7f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f90:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f95:	be 00 00 00 00       	mov    $0x0,%esi
+  801f9a:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f9f:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  801fa6:	ff ff ff 
+  801fa9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fad:	ff d0                	call   *%rax
+  801faf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fb3:	c9                   	leave
+  801fb4:	c3                   	ret
+
+0000000000801fb5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801fb5:	55                   	push   %rbp
+  801fb6:	48 89 e5             	mov    %rsp,%rbp
+  801fb9:	48 83 ec 10          	sub    $0x10,%rsp
+  801fbd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fbd <sys_env_destroy+0x8>
+  801fc4:	49 bb 83 70 00 00 00 	movabs $0x7083,%r11
+  801fcb:	00 00 00 
+  801fce:	4c 01 d8             	add    %r11,%rax
+  801fd1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801fd4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fd7:	48 63 d2             	movslq %edx,%rdx
+  801fda:	48 83 ec 08          	sub    $0x8,%rsp
+  801fde:	6a 00                	push   $0x0
+  801fe0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fe6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ff1:	be 01 00 00 00       	mov    $0x1,%esi
+  801ff6:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ffb:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802002:	ff ff ff 
+  802005:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802009:	ff d0                	call   *%rax
+  80200b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80200f:	c9                   	leave
+  802010:	c3                   	ret
+
+0000000000802011 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802011:	55                   	push   %rbp
+  802012:	48 89 e5             	mov    %rsp,%rbp
+  802015:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802015 <sys_getenvid+0x4>
+  80201c:	49 bb 2b 70 00 00 00 	movabs $0x702b,%r11
+  802023:	00 00 00 
+  802026:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802029:	48 83 ec 08          	sub    $0x8,%rsp
+  80202d:	6a 00                	push   $0x0
+  80202f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802035:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80203b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802040:	ba 00 00 00 00       	mov    $0x0,%edx
+  802045:	be 00 00 00 00       	mov    $0x0,%esi
+  80204a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80204f:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802056:	ff ff ff 
+  802059:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80205d:	ff d0                	call   *%rax
+  80205f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802063:	c9                   	leave
+  802064:	c3                   	ret
+
+0000000000802065 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802065:	55                   	push   %rbp
+  802066:	48 89 e5             	mov    %rsp,%rbp
+  802069:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802069 <sys_yield+0x4>
+  802070:	49 bb d7 6f 00 00 00 	movabs $0x6fd7,%r11
+  802077:	00 00 00 
+  80207a:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80207d:	48 83 ec 08          	sub    $0x8,%rsp
+  802081:	6a 00                	push   $0x0
+  802083:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802089:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80208f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802094:	ba 00 00 00 00       	mov    $0x0,%edx
+  802099:	be 00 00 00 00       	mov    $0x0,%esi
+  80209e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8020a3:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  8020aa:	ff ff ff 
+  8020ad:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020b1:	ff d0                	call   *%rax
+  8020b3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020b7:	90                   	nop
+  8020b8:	c9                   	leave
+  8020b9:	c3                   	ret
+
+00000000008020ba <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8020ba:	55                   	push   %rbp
+  8020bb:	48 89 e5             	mov    %rsp,%rbp
+  8020be:	48 83 ec 10          	sub    $0x10,%rsp
+  8020c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020c2 <sys_page_alloc+0x8>
+  8020c9:	49 bb 7e 6f 00 00 00 	movabs $0x6f7e,%r11
+  8020d0:	00 00 00 
+  8020d3:	4c 01 d8             	add    %r11,%rax
+  8020d6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020dd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8020e0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020e3:	48 63 f2             	movslq %edx,%rsi
+  8020e6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020ea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020ed:	48 63 d2             	movslq %edx,%rdx
+  8020f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f4:	6a 00                	push   $0x0
+  8020f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020fc:	49 89 f0             	mov    %rsi,%r8
+  8020ff:	be 01 00 00 00       	mov    $0x1,%esi
+  802104:	bf 04 00 00 00       	mov    $0x4,%edi
+  802109:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802110:	ff ff ff 
+  802113:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802117:	ff d0                	call   *%rax
+  802119:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80211d:	c9                   	leave
+  80211e:	c3                   	ret
+
+000000000080211f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80211f:	55                   	push   %rbp
+  802120:	48 89 e5             	mov    %rsp,%rbp
+  802123:	48 83 ec 20          	sub    $0x20,%rsp
+  802127:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802127 <sys_page_map+0x8>
+  80212e:	49 bb 19 6f 00 00 00 	movabs $0x6f19,%r11
+  802135:	00 00 00 
+  802138:	4c 01 d8             	add    %r11,%rax
+  80213b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80213e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802142:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802145:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802149:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80214d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802150:	48 63 f2             	movslq %edx,%rsi
+  802153:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802157:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80215a:	48 63 fa             	movslq %edx,%rdi
+  80215d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802161:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802164:	48 63 d2             	movslq %edx,%rdx
+  802167:	48 83 ec 08          	sub    $0x8,%rsp
+  80216b:	56                   	push   %rsi
+  80216c:	4d 89 c1             	mov    %r8,%r9
+  80216f:	49 89 f8             	mov    %rdi,%r8
+  802172:	be 01 00 00 00       	mov    $0x1,%esi
+  802177:	bf 05 00 00 00       	mov    $0x5,%edi
+  80217c:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802183:	ff ff ff 
+  802186:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80218a:	ff d0                	call   *%rax
+  80218c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802190:	c9                   	leave
+  802191:	c3                   	ret
+
+0000000000802192 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802192:	55                   	push   %rbp
+  802193:	48 89 e5             	mov    %rsp,%rbp
+  802196:	48 83 ec 10          	sub    $0x10,%rsp
+  80219a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80219a <sys_page_unmap+0x8>
+  8021a1:	49 bb a6 6e 00 00 00 	movabs $0x6ea6,%r11
+  8021a8:	00 00 00 
+  8021ab:	4c 01 d8             	add    %r11,%rax
+  8021ae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8021b5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021b9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021bc:	48 63 d2             	movslq %edx,%rdx
+  8021bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c3:	6a 00                	push   $0x0
+  8021c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d1:	be 01 00 00 00       	mov    $0x1,%esi
+  8021d6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8021db:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  8021e2:	ff ff ff 
+  8021e5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021e9:	ff d0                	call   *%rax
+  8021eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ef:	c9                   	leave
+  8021f0:	c3                   	ret
+
+00000000008021f1 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8021f1:	55                   	push   %rbp
+  8021f2:	48 89 e5             	mov    %rsp,%rbp
+  8021f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021f9 <sys_env_set_status+0x8>
+  802200:	49 bb 47 6e 00 00 00 	movabs $0x6e47,%r11
+  802207:	00 00 00 
+  80220a:	4c 01 d8             	add    %r11,%rax
+  80220d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802210:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802213:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802216:	48 63 ca             	movslq %edx,%rcx
+  802219:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80221c:	48 63 d2             	movslq %edx,%rdx
+  80221f:	48 83 ec 08          	sub    $0x8,%rsp
+  802223:	6a 00                	push   $0x0
+  802225:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80222b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802231:	be 01 00 00 00       	mov    $0x1,%esi
+  802236:	bf 08 00 00 00       	mov    $0x8,%edi
+  80223b:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802242:	ff ff ff 
+  802245:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802249:	ff d0                	call   *%rax
+  80224b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80224f:	c9                   	leave
+  802250:	c3                   	ret
+
+0000000000802251 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802251:	55                   	push   %rbp
+  802252:	48 89 e5             	mov    %rsp,%rbp
+  802255:	48 83 ec 10          	sub    $0x10,%rsp
+  802259:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802259 <sys_env_set_trapframe+0x8>
+  802260:	49 bb e7 6d 00 00 00 	movabs $0x6de7,%r11
+  802267:	00 00 00 
+  80226a:	4c 01 d8             	add    %r11,%rax
+  80226d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802270:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802274:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802278:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80227b:	48 63 d2             	movslq %edx,%rdx
+  80227e:	48 83 ec 08          	sub    $0x8,%rsp
+  802282:	6a 00                	push   $0x0
+  802284:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80228a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802290:	be 01 00 00 00       	mov    $0x1,%esi
+  802295:	bf 09 00 00 00       	mov    $0x9,%edi
+  80229a:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  8022a1:	ff ff ff 
+  8022a4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022a8:	ff d0                	call   *%rax
+  8022aa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ae:	c9                   	leave
+  8022af:	c3                   	ret
+
+00000000008022b0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8022b0:	55                   	push   %rbp
+  8022b1:	48 89 e5             	mov    %rsp,%rbp
+  8022b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022b8 <sys_env_set_pgfault_upcall+0x8>
+  8022bf:	49 bb 88 6d 00 00 00 	movabs $0x6d88,%r11
+  8022c6:	00 00 00 
+  8022c9:	4c 01 d8             	add    %r11,%rax
+  8022cc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8022d3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022d7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022da:	48 63 d2             	movslq %edx,%rdx
+  8022dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e1:	6a 00                	push   $0x0
+  8022e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8022f4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8022f9:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802300:	ff ff ff 
+  802303:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802307:	ff d0                	call   *%rax
+  802309:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80230d:	c9                   	leave
+  80230e:	c3                   	ret
+
+000000000080230f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80230f:	55                   	push   %rbp
+  802310:	48 89 e5             	mov    %rsp,%rbp
+  802313:	48 83 ec 20          	sub    $0x20,%rsp
+  802317:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802317 <sys_ipc_try_send+0x8>
+  80231e:	49 bb 29 6d 00 00 00 	movabs $0x6d29,%r11
+  802325:	00 00 00 
+  802328:	4c 01 d8             	add    %r11,%rax
+  80232b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80232e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802332:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802336:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802339:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80233c:	48 63 fa             	movslq %edx,%rdi
+  80233f:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802343:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802346:	48 63 d2             	movslq %edx,%rdx
+  802349:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80234d:	48 83 ec 08          	sub    $0x8,%rsp
+  802351:	6a 00                	push   $0x0
+  802353:	49 89 f9             	mov    %rdi,%r9
+  802356:	49 89 f0             	mov    %rsi,%r8
+  802359:	be 00 00 00 00       	mov    $0x0,%esi
+  80235e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802363:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  80236a:	ff ff ff 
+  80236d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802371:	ff d0                	call   *%rax
+  802373:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802377:	c9                   	leave
+  802378:	c3                   	ret
+
+0000000000802379 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802379:	55                   	push   %rbp
+  80237a:	48 89 e5             	mov    %rsp,%rbp
+  80237d:	48 83 ec 20          	sub    $0x20,%rsp
+  802381:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802381 <sys_ipc_send+0x8>
+  802388:	49 bb bf 6c 00 00 00 	movabs $0x6cbf,%r11
+  80238f:	00 00 00 
+  802392:	4c 01 d8             	add    %r11,%rax
+  802395:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802398:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80239c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023a0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8023a3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023a6:	48 63 fa             	movslq %edx,%rdi
+  8023a9:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8023ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023b0:	48 63 d2             	movslq %edx,%rdx
+  8023b3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8023bb:	6a 00                	push   $0x0
+  8023bd:	49 89 f9             	mov    %rdi,%r9
+  8023c0:	49 89 f0             	mov    %rsi,%r8
+  8023c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c8:	bf 17 00 00 00       	mov    $0x17,%edi
+  8023cd:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  8023d4:	ff ff ff 
+  8023d7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023db:	ff d0                	call   *%rax
+  8023dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e1:	c9                   	leave
+  8023e2:	c3                   	ret
+
+00000000008023e3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8023e3:	55                   	push   %rbp
+  8023e4:	48 89 e5             	mov    %rsp,%rbp
+  8023e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8023eb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023eb <sys_ipc_recv+0x8>
+  8023f2:	49 bb 55 6c 00 00 00 	movabs $0x6c55,%r11
+  8023f9:	00 00 00 
+  8023fc:	4c 01 d8             	add    %r11,%rax
+  8023ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802403:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802407:	6a 00                	push   $0x0
+  802409:	6a 00                	push   $0x0
+  80240b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802411:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802417:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80241c:	be 01 00 00 00       	mov    $0x1,%esi
+  802421:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802426:	49 ba 13 8d ff ff ff 	movabs $0xffffffffffff8d13,%r10
+  80242d:	ff ff ff 
+  802430:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802434:	ff d0                	call   *%rax
+  802436:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80243a:	c9                   	leave
+  80243b:	c3                   	ret
+
+000000000080243c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  80243c:	55                   	push   %rbp
+  80243d:	48 89 e5             	mov    %rsp,%rbp
+  802440:	48 83 ec 30          	sub    $0x30,%rsp
+  802444:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802444 <sys_ipc_call+0x8>
+  80244b:	49 bb fc 6b 00 00 00 	movabs $0x6bfc,%r11
+  802452:	00 00 00 
+  802455:	4c 01 d8             	add    %r11,%rax
+  802458:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80245b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80245f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802463:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802466:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80246a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80246e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802472:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802475:	4c 63 c2             	movslq %edx,%r8
+  802478:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80247c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80247f:	48 63 d2             	movslq %edx,%rdx
+  802482:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802486:	ff 75 d8             	push   -0x28(%rbp)
+  802489:	56                   	push   %rsi
+  80248a:	4d 89 c1             	mov    %r8,%r9
+  80248d:	49 89 f8             	mov    %rdi,%r8
+  802490:	be 00 00 00 00       	mov    $0x0,%esi
+  802495:	bf 18 00 00 00       	mov    $0x18,%edi
+  80249a:	49 ba 13 8d ff ff ff 	movabs $0xffffffffffff8d13,%r10
+  8024a1:	ff ff ff 
+  8024a4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024a8:	ff d0                	call   *%rax
+  8024aa:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8024ae:	c9                   	leave
+  8024af:	c3                   	ret
+
+00000000008024b0 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8024b0:	55                   	push   %rbp
+  8024b1:	48 89 e5             	mov    %rsp,%rbp
+  8024b4:	48 83 ec 30          	sub    $0x30,%rsp
+  8024b8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024b8 <sys_ipc_reply_recv+0x8>
+  8024bf:	49 bb 88 6b 00 00 00 	movabs $0x6b88,%r11
+  8024c6:	00 00 00 
+  8024c9:	4c 01 d8             	add    %r11,%rax
+  8024cc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024cf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024d3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024d7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8024da:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8024de:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8024e2:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8024e6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024e9:	4c 63 c2             	movslq %edx,%r8
+  8024ec:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8024f0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024f3:	48 63 d2             	movslq %edx,%rdx
+  8024f6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024fa:	ff 75 d8             	push   -0x28(%rbp)
+  8024fd:	56                   	push   %rsi
+  8024fe:	4d 89 c1             	mov    %r8,%r9
+  802501:	49 89 f8             	mov    %rdi,%r8
+  802504:	be 00 00 00 00       	mov    $0x0,%esi
+  802509:	bf 19 00 00 00       	mov    $0x19,%edi
+  80250e:	49 ba 13 8d ff ff ff 	movabs $0xffffffffffff8d13,%r10
+  802515:	ff ff ff 
+  802518:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80251c:	ff d0                	call   *%rax
+  80251e:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802522:	c9                   	leave
+  802523:	c3                   	ret
+
+0000000000802524 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802524:	55                   	push   %rbp
+  802525:	48 89 e5             	mov    %rsp,%rbp
+  802528:	48 83 ec 10          	sub    $0x10,%rsp
+  80252c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80252c <sys_env_set_priority+0x8>
+  802533:	49 bb 14 6b 00 00 00 	movabs $0x6b14,%r11
+  80253a:	00 00 00 
+  80253d:	4c 01 d8             	add    %r11,%rax
+  802540:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802543:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802546:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802549:	48 63 ca             	movslq %edx,%rcx
+  80254c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80254f:	48 63 d2             	movslq %edx,%rdx
+  802552:	48 83 ec 08          	sub    $0x8,%rsp
+  802556:	6a 00                	push   $0x0
+  802558:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80255e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802564:	be 01 00 00 00       	mov    $0x1,%esi
+  802569:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80256e:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802575:	ff ff ff 
+  802578:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80257c:	ff d0                	call   *%rax
+  80257e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802582:	c9                   	leave
+  802583:	c3                   	ret
+
+0000000000802584 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802584:	55                   	push   %rbp
+  802585:	48 89 e5             	mov    %rsp,%rbp
+  802588:	48 83 ec 10          	sub    $0x10,%rsp
+  80258c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80258c <sys_env_set_affinity+0x8>
+  802593:	49 bb b4 6a 00 00 00 	movabs $0x6ab4,%r11
+  80259a:	00 00 00 
+  80259d:	4c 01 d8             	add    %r11,%rax
+  8025a0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025a3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8025a6:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8025a9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025ac:	48 63 d2             	movslq %edx,%rdx
+  8025af:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b3:	6a 00                	push   $0x0
+  8025b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8025c6:	bf 10 00 00 00       	mov    $0x10,%edi
+  8025cb:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  8025d2:	ff ff ff 
+  8025d5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025d9:	ff d0                	call   *%rax
+  8025db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025df:	c9                   	leave
+  8025e0:	c3                   	ret
+
+00000000008025e1 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8025e1:	55                   	push   %rbp
+  8025e2:	48 89 e5             	mov    %rsp,%rbp
+  8025e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025e5 <sys_time_msec+0x4>
+  8025ec:	49 bb 5b 6a 00 00 00 	movabs $0x6a5b,%r11
+  8025f3:	00 00 00 
+  8025f6:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8025f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8025fd:	6a 00                	push   $0x0
+  8025ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802605:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80260b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802610:	ba 00 00 00 00       	mov    $0x0,%edx
+  802615:	be 00 00 00 00       	mov    $0x0,%esi
+  80261a:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80261f:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802626:	ff ff ff 
+  802629:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80262d:	ff d0                	call   *%rax
+  80262f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802633:	c9                   	leave
+  802634:	c3                   	ret
+
+0000000000802635 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802635:	55                   	push   %rbp
+  802636:	48 89 e5             	mov    %rsp,%rbp
+  802639:	48 83 ec 10          	sub    $0x10,%rsp
+  80263d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80263d <sys_sleep_usec+0x8>
+  802644:	49 bb 03 6a 00 00 00 	movabs $0x6a03,%r11
+  80264b:	00 00 00 
+  80264e:	4c 01 d8             	add    %r11,%rax
+  802651:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802655:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802659:	48 83 ec 08          	sub    $0x8,%rsp
+  80265d:	6a 00                	push   $0x0
+  80265f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802665:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80266b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802670:	be 00 00 00 00       	mov    $0x0,%esi
+  802675:	bf 11 00 00 00       	mov    $0x11,%edi
+  80267a:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802681:	ff ff ff 
+  802684:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802688:	ff d0                	call   *%rax
+  80268a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80268e:	c9                   	leave
+  80268f:	c3                   	ret
+
+0000000000802690 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802690:	55                   	push   %rbp
+  802691:	48 89 e5             	mov    %rsp,%rbp
+  802694:	48 83 ec 10          	sub    $0x10,%rsp
+  802698:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802698 <sys_page_alloc_huge+0x8>
+  80269f:	49 bb a8 69 00 00 00 	movabs $0x69a8,%r11
+  8026a6:	00 00 00 
+  8026a9:	4c 01 d8             	add    %r11,%rax
+  8026ac:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026b3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8026b6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026b9:	48 63 f2             	movslq %edx,%rsi
+  8026bc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026c0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026c3:	48 63 d2             	movslq %edx,%rdx
+  8026c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ca:	6a 00                	push   $0x0
+  8026cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026d2:	49 89 f0             	mov    %rsi,%r8
+  8026d5:	be 01 00 00 00       	mov    $0x1,%esi
+  8026da:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026df:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  8026e6:	ff ff ff 
+  8026e9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026ed:	ff d0                	call   *%rax
+  8026ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f3:	c9                   	leave
+  8026f4:	c3                   	ret
+
+00000000008026f5 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8026f5:	55                   	push   %rbp
+  8026f6:	48 89 e5             	mov    %rsp,%rbp
+  8026f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8026fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026fd <sys_page_map_batch+0x8>
+  802704:	49 bb 43 69 00 00 00 	movabs $0x6943,%r11
+  80270b:	00 00 00 
+  80270e:	4c 01 d8             	add    %r11,%rax
+  802711:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802715:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802719:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80271d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802721:	48 83 ec 08          	sub    $0x8,%rsp
+  802725:	6a 00                	push   $0x0
+  802727:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80272d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802733:	be 01 00 00 00       	mov    $0x1,%esi
+  802738:	bf 13 00 00 00       	mov    $0x13,%edi
+  80273d:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802744:	ff ff ff 
+  802747:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80274b:	ff d0                	call   *%rax
+  80274d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802751:	c9                   	leave
+  802752:	c3                   	ret
+
+0000000000802753 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802753:	55                   	push   %rbp
+  802754:	48 89 e5             	mov    %rsp,%rbp
+  802757:	48 83 ec 10          	sub    $0x10,%rsp
+  80275b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80275b <sys_page_alloc_batch+0x8>
+  802762:	49 bb e5 68 00 00 00 	movabs $0x68e5,%r11
+  802769:	00 00 00 
+  80276c:	4c 01 d8             	add    %r11,%rax
+  80276f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802773:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802777:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80277b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80277f:	48 83 ec 08          	sub    $0x8,%rsp
+  802783:	6a 00                	push   $0x0
+  802785:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80278b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802791:	be 01 00 00 00       	mov    $0x1,%esi
+  802796:	bf 14 00 00 00       	mov    $0x14,%edi
+  80279b:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  8027a2:	ff ff ff 
+  8027a5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027a9:	ff d0                	call   *%rax
+  8027ab:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027af:	c9                   	leave
+  8027b0:	c3                   	ret
+
+00000000008027b1 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8027b1:	55                   	push   %rbp
+  8027b2:	48 89 e5             	mov    %rsp,%rbp
+  8027b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8027b9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027b9 <sys_page_unmap_batch+0x8>
+  8027c0:	49 bb 87 68 00 00 00 	movabs $0x6887,%r11
+  8027c7:	00 00 00 
+  8027ca:	4c 01 d8             	add    %r11,%rax
+  8027cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8027d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027d9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e1:	6a 00                	push   $0x0
+  8027e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8027f4:	bf 15 00 00 00       	mov    $0x15,%edi
+  8027f9:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802800:	ff ff ff 
+  802803:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802807:	ff d0                	call   *%rax
+  802809:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80280d:	c9                   	leave
+  80280e:	c3                   	ret
+
+000000000080280f <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80280f:	55                   	push   %rbp
+  802810:	48 89 e5             	mov    %rsp,%rbp
+  802813:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802813 <sys_fork+0x4>
+  80281a:	49 bb 2d 68 00 00 00 	movabs $0x682d,%r11
+  802821:	00 00 00 
+  802824:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802827:	48 83 ec 08          	sub    $0x8,%rsp
+  80282b:	6a 00                	push   $0x0
+  80282d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802833:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802839:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80283e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802843:	be 00 00 00 00       	mov    $0x0,%esi
+  802848:	bf 16 00 00 00       	mov    $0x16,%edi
+  80284d:	49 ba 59 8c ff ff ff 	movabs $0xffffffffffff8c59,%r10
+  802854:	ff ff ff 
+  802857:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80285b:	ff d0                	call   *%rax
+  80285d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802861:	c9                   	leave
+  802862:	c3                   	ret
+
+0000000000802863 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802863:	55                   	push   %rbp
+  802864:	48 89 e5             	mov    %rsp,%rbp
+  802867:	41 57                	push   %r15
+  802869:	53                   	push   %rbx
+  80286a:	48 83 ec 40          	sub    $0x40,%rsp
+  80286e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80286e <pgfault+0xb>
+  802875:	49 bb d2 67 00 00 00 	movabs $0x67d2,%r11
+  80287c:	00 00 00 
+  80287f:	4c 01 db             	add    %r11,%rbx
+  802882:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802886:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80288a:	48 8b 00             	mov    (%rax),%rax
+  80288d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802891:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802895:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802899:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  80289c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028a0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8028a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028a8:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8028ae:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  8028b2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8028b5:	83 e0 02             	and    $0x2,%eax
+  8028b8:	85 c0                	test   %eax,%eax
+  8028ba:	0f 84 91 03 00 00    	je     802c51 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8028c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028c4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8028c8:	48 89 c2             	mov    %rax,%rdx
+  8028cb:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8028d2:	ff ff ff 
+  8028d5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8028d9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028dd:	83 e0 01             	and    $0x1,%eax
+  8028e0:	48 85 c0             	test   %rax,%rax
+  8028e3:	0f 84 a7 01 00 00    	je     802a90 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  8028e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028ed:	48 c1 e8 15          	shr    $0x15,%rax
+  8028f1:	48 89 c2             	mov    %rax,%rdx
+  8028f4:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8028fb:	ff ff ff 
+  8028fe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802902:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802906:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  80290b:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802911:	0f 85 79 01 00 00    	jne    802a90 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802917:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80291b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80291f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802923:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802929:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  80292d:	ba 07 00 00 00       	mov    $0x7,%edx
+  802932:	be 00 00 60 00       	mov    $0x600000,%esi
+  802937:	bf 00 00 00 00       	mov    $0x0,%edi
+  80293c:	49 89 df             	mov    %rbx,%r15
+  80293f:	48 b8 50 96 ff ff ff 	movabs $0xffffffffffff9650,%rax
+  802946:	ff ff ff 
+  802949:	48 01 d8             	add    %rbx,%rax
+  80294c:	ff d0                	call   *%rax
+  80294e:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802951:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802955:	79 44                	jns    80299b <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802957:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80295a:	89 c1                	mov    %eax,%ecx
+  80295c:	48 b8 50 e1 ff ff ff 	movabs $0xffffffffffffe150,%rax
+  802963:	ff ff ff 
+  802966:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80296a:	48 89 c2             	mov    %rax,%rdx
+  80296d:	be 20 00 00 00       	mov    $0x20,%esi
+  802972:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  802979:	ff ff ff 
+  80297c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802980:	48 89 c7             	mov    %rax,%rdi
+  802983:	49 89 df             	mov    %rbx,%r15
+  802986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298b:	49 b8 25 73 ff ff ff 	movabs $0xffffffffffff7325,%r8
+  802992:	ff ff ff 
+  802995:	49 01 d8             	add    %rbx,%r8
+  802998:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  80299b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80299f:	ba 00 00 20 00       	mov    $0x200000,%edx
+  8029a4:	48 89 c6             	mov    %rax,%rsi
+  8029a7:	bf 00 00 60 00       	mov    $0x600000,%edi
+  8029ac:	49 89 df             	mov    %rbx,%r15
+  8029af:	48 b8 c9 88 ff ff ff 	movabs $0xffffffffffff88c9,%rax
+  8029b6:	ff ff ff 
+  8029b9:	48 01 d8             	add    %rbx,%rax
+  8029bc:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  8029be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029c2:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8029c8:	48 89 c1             	mov    %rax,%rcx
+  8029cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d0:	be 00 00 60 00       	mov    $0x600000,%esi
+  8029d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029da:	49 89 df             	mov    %rbx,%r15
+  8029dd:	48 b8 df 90 ff ff ff 	movabs $0xffffffffffff90df,%rax
+  8029e4:	ff ff ff 
+  8029e7:	48 01 d8             	add    %rbx,%rax
+  8029ea:	ff d0                	call   *%rax
+  8029ec:	85 c0                	test   %eax,%eax
+  8029ee:	74 3e                	je     802a2e <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  8029f0:	48 b8 7b e1 ff ff ff 	movabs $0xffffffffffffe17b,%rax
+  8029f7:	ff ff ff 
+  8029fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029fe:	48 89 c2             	mov    %rax,%rdx
+  802a01:	be 23 00 00 00       	mov    $0x23,%esi
+  802a06:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  802a0d:	ff ff ff 
+  802a10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a14:	48 89 c7             	mov    %rax,%rdi
+  802a17:	49 89 df             	mov    %rbx,%r15
+  802a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a1f:	48 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%rcx
+  802a26:	ff ff ff 
+  802a29:	48 01 d9             	add    %rbx,%rcx
+  802a2c:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802a2e:	be 00 00 60 00       	mov    $0x600000,%esi
+  802a33:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a38:	49 89 df             	mov    %rbx,%r15
+  802a3b:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  802a42:	ff ff ff 
+  802a45:	48 01 d8             	add    %rbx,%rax
+  802a48:	ff d0                	call   *%rax
+  802a4a:	85 c0                	test   %eax,%eax
+  802a4c:	0f 84 3d 02 00 00    	je     802c8f <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802a52:	48 b8 90 e1 ff ff ff 	movabs $0xffffffffffffe190,%rax
+  802a59:	ff ff ff 
+  802a5c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a60:	48 89 c2             	mov    %rax,%rdx
+  802a63:	be 25 00 00 00       	mov    $0x25,%esi
+  802a68:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  802a6f:	ff ff ff 
+  802a72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a76:	48 89 c7             	mov    %rax,%rdi
+  802a79:	49 89 df             	mov    %rbx,%r15
+  802a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a81:	48 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%rcx
+  802a88:	ff ff ff 
+  802a8b:	48 01 d9             	add    %rbx,%rcx
+  802a8e:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802a90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a94:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a98:	48 89 c2             	mov    %rax,%rdx
+  802a9b:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802aa2:	ff ff ff 
+  802aa5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802aa9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802aad:	25 00 08 00 00       	and    $0x800,%eax
+  802ab2:	48 85 c0             	test   %rax,%rax
+  802ab5:	0f 84 58 01 00 00    	je     802c13 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802abb:	ba 07 00 00 00       	mov    $0x7,%edx
+  802ac0:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802ac5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aca:	49 89 df             	mov    %rbx,%r15
+  802acd:	48 b8 7a 90 ff ff ff 	movabs $0xffffffffffff907a,%rax
+  802ad4:	ff ff ff 
+  802ad7:	48 01 d8             	add    %rbx,%rax
+  802ada:	ff d0                	call   *%rax
+  802adc:	85 c0                	test   %eax,%eax
+  802ade:	74 3e                	je     802b1e <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802ae0:	48 b8 a7 e1 ff ff ff 	movabs $0xffffffffffffe1a7,%rax
+  802ae7:	ff ff ff 
+  802aea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aee:	48 89 c2             	mov    %rax,%rdx
+  802af1:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802af6:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  802afd:	ff ff ff 
+  802b00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b04:	48 89 c7             	mov    %rax,%rdi
+  802b07:	49 89 df             	mov    %rbx,%r15
+  802b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0f:	48 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%rcx
+  802b16:	ff ff ff 
+  802b19:	48 01 d9             	add    %rbx,%rcx
+  802b1c:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802b1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b22:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b27:	48 89 c6             	mov    %rax,%rsi
+  802b2a:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802b2f:	49 89 df             	mov    %rbx,%r15
+  802b32:	48 b8 c9 88 ff ff ff 	movabs $0xffffffffffff88c9,%rax
+  802b39:	ff ff ff 
+  802b3c:	48 01 d8             	add    %rbx,%rax
+  802b3f:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802b41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b45:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802b4b:	48 89 c1             	mov    %rax,%rcx
+  802b4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b53:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802b58:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b5d:	49 89 df             	mov    %rbx,%r15
+  802b60:	48 b8 df 90 ff ff ff 	movabs $0xffffffffffff90df,%rax
+  802b67:	ff ff ff 
+  802b6a:	48 01 d8             	add    %rbx,%rax
+  802b6d:	ff d0                	call   *%rax
+  802b6f:	85 c0                	test   %eax,%eax
+  802b71:	74 3e                	je     802bb1 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802b73:	48 b8 7b e1 ff ff ff 	movabs $0xffffffffffffe17b,%rax
+  802b7a:	ff ff ff 
+  802b7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b81:	48 89 c2             	mov    %rax,%rdx
+  802b84:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802b89:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  802b90:	ff ff ff 
+  802b93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b97:	48 89 c7             	mov    %rax,%rdi
+  802b9a:	49 89 df             	mov    %rbx,%r15
+  802b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba2:	48 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%rcx
+  802ba9:	ff ff ff 
+  802bac:	48 01 d9             	add    %rbx,%rcx
+  802baf:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802bb1:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802bb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bbb:	49 89 df             	mov    %rbx,%r15
+  802bbe:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  802bc5:	ff ff ff 
+  802bc8:	48 01 d8             	add    %rbx,%rax
+  802bcb:	ff d0                	call   *%rax
+  802bcd:	85 c0                	test   %eax,%eax
+  802bcf:	0f 84 bb 00 00 00    	je     802c90 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802bd5:	48 b8 90 e1 ff ff ff 	movabs $0xffffffffffffe190,%rax
+  802bdc:	ff ff ff 
+  802bdf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802be3:	48 89 c2             	mov    %rax,%rdx
+  802be6:	be 32 00 00 00       	mov    $0x32,%esi
+  802beb:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  802bf2:	ff ff ff 
+  802bf5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bf9:	48 89 c7             	mov    %rax,%rdi
+  802bfc:	49 89 df             	mov    %rbx,%r15
+  802bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c04:	48 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%rcx
+  802c0b:	ff ff ff 
+  802c0e:	48 01 d9             	add    %rbx,%rcx
+  802c11:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802c13:	48 b8 c0 e1 ff ff ff 	movabs $0xffffffffffffe1c0,%rax
+  802c1a:	ff ff ff 
+  802c1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c21:	48 89 c2             	mov    %rax,%rdx
+  802c24:	be 36 00 00 00       	mov    $0x36,%esi
+  802c29:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  802c30:	ff ff ff 
+  802c33:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c37:	48 89 c7             	mov    %rax,%rdi
+  802c3a:	49 89 df             	mov    %rbx,%r15
+  802c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c42:	48 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%rcx
+  802c49:	ff ff ff 
+  802c4c:	48 01 d9             	add    %rbx,%rcx
+  802c4f:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802c51:	48 b8 df e1 ff ff ff 	movabs $0xffffffffffffe1df,%rax
+  802c58:	ff ff ff 
+  802c5b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c5f:	48 89 c2             	mov    %rax,%rdx
+  802c62:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802c67:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  802c6e:	ff ff ff 
+  802c71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c75:	48 89 c7             	mov    %rax,%rdi
+  802c78:	49 89 df             	mov    %rbx,%r15
+  802c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c80:	48 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%rcx
+  802c87:	ff ff ff 
+  802c8a:	48 01 d9             	add    %rbx,%rcx
+  802c8d:	ff d1                	call   *%rcx
+			return;
+  802c8f:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802c90:	48 83 c4 40          	add    $0x40,%rsp
+  802c94:	5b                   	pop    %rbx
+  802c95:	41 5f                	pop    %r15
+  802c97:	5d                   	pop    %rbp
+  802c98:	c3                   	ret
+
+0000000000802c99 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802c99:	55                   	push   %rbp
+  802c9a:	48 89 e5             	mov    %rsp,%rbp
+  802c9d:	41 57                	push   %r15
+  802c9f:	53                   	push   %rbx
+  802ca0:	48 83 ec 10          	sub    $0x10,%rsp
+  802ca4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ca4 <fork_flush+0xb>
+  802cab:	49 bb 9c 63 00 00 00 	movabs $0x639c,%r11
+  802cb2:	00 00 00 
+  802cb5:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802cb8:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802cbf:	00 00 00 
+  802cc2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cc6:	48 85 c0             	test   %rax,%rax
+  802cc9:	0f 84 81 00 00 00    	je     802d50 <fork_flush+0xb7>
+  802ccf:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802cd6:	00 00 00 
+  802cd9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cdd:	48 89 c6             	mov    %rax,%rsi
+  802ce0:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802ce7:	00 00 00 
+  802cea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cee:	48 89 c7             	mov    %rax,%rdi
+  802cf1:	49 89 df             	mov    %rbx,%r15
+  802cf4:	48 b8 b5 96 ff ff ff 	movabs $0xffffffffffff96b5,%rax
+  802cfb:	ff ff ff 
+  802cfe:	48 01 d8             	add    %rbx,%rax
+  802d01:	ff d0                	call   *%rax
+  802d03:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d06:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d0a:	79 44                	jns    802d50 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802d0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d0f:	89 c1                	mov    %eax,%ecx
+  802d11:	48 b8 f8 e1 ff ff ff 	movabs $0xffffffffffffe1f8,%rax
+  802d18:	ff ff ff 
+  802d1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d1f:	48 89 c2             	mov    %rax,%rdx
+  802d22:	be 56 00 00 00       	mov    $0x56,%esi
+  802d27:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  802d2e:	ff ff ff 
+  802d31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d35:	48 89 c7             	mov    %rax,%rdi
+  802d38:	49 89 df             	mov    %rbx,%r15
+  802d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d40:	49 b8 25 73 ff ff ff 	movabs $0xffffffffffff7325,%r8
+  802d47:	ff ff ff 
+  802d4a:	49 01 d8             	add    %rbx,%r8
+  802d4d:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802d50:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802d57:	00 00 00 
+  802d5a:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802d61:	00 
+}
+  802d62:	90                   	nop
+  802d63:	48 83 c4 10          	add    $0x10,%rsp
+  802d67:	5b                   	pop    %rbx
+  802d68:	41 5f                	pop    %r15
+  802d6a:	5d                   	pop    %rbp
+  802d6b:	c3                   	ret
+
+0000000000802d6c <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802d6c:	55                   	push   %rbp
+  802d6d:	48 89 e5             	mov    %rsp,%rbp
+  802d70:	53                   	push   %rbx
+  802d71:	48 83 ec 28          	sub    $0x28,%rsp
+  802d75:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d75 <fork_map+0x9>
+  802d7c:	49 bb cb 62 00 00 00 	movabs $0x62cb,%r11
+  802d83:	00 00 00 
+  802d86:	4c 01 db             	add    %r11,%rbx
+  802d89:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d8c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802d90:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802d93:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802d9a:	00 00 00 
+  802d9d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802da1:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802da7:	75 10                	jne    802db9 <fork_map+0x4d>
+		fork_flush();
+  802da9:	48 b8 59 9c ff ff ff 	movabs $0xffffffffffff9c59,%rax
+  802db0:	ff ff ff 
+  802db3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802db7:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802db9:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802dc0:	00 00 00 
+  802dc3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802dc7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802dcb:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802dd2:	00 00 00 
+  802dd5:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802dd9:	48 c1 e0 05          	shl    $0x5,%rax
+  802ddd:	48 89 c2             	mov    %rax,%rdx
+  802de0:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802de7:	00 00 00 
+  802dea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dee:	48 01 d0             	add    %rdx,%rax
+  802df1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802df5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802df9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802dff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e03:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802e07:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802e0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e0f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e12:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802e15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e19:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802e1d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802e21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e25:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802e28:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802e2b:	90                   	nop
+  802e2c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e30:	c9                   	leave
+  802e31:	c3                   	ret
+
+0000000000802e32 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802e32:	55                   	push   %rbp
+  802e33:	48 89 e5             	mov    %rsp,%rbp
+  802e36:	53                   	push   %rbx
+  802e37:	48 83 ec 28          	sub    $0x28,%rsp
+  802e3b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e3b <duppage+0x9>
+  802e42:	49 bb 05 62 00 00 00 	movabs $0x6205,%r11
+  802e49:	00 00 00 
+  802e4c:	4c 01 db             	add    %r11,%rbx
+  802e4f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802e52:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802e55:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802e58:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e5c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802e60:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802e67:	ff ff ff 
+  802e6a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e6e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802e71:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e75:	25 00 04 00 00       	and    $0x400,%eax
+  802e7a:	48 85 c0             	test   %rax,%rax
+  802e7d:	74 42                	je     802ec1 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802e7f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802e86:	ff ff ff 
+  802e89:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e8d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802e90:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e94:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e99:	89 c2                	mov    %eax,%edx
+  802e9b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802e9f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ea2:	48 89 ce             	mov    %rcx,%rsi
+  802ea5:	89 c7                	mov    %eax,%edi
+  802ea7:	48 b8 2c 9d ff ff ff 	movabs $0xffffffffffff9d2c,%rax
+  802eae:	ff ff ff 
+  802eb1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802eb5:	ff d0                	call   *%rax
+		return 0;
+  802eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebc:	e9 ae 00 00 00       	jmp    802f6f <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802ec1:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ec8:	ff ff ff 
+  802ecb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ecf:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802ed2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ed6:	83 e0 02             	and    $0x2,%eax
+  802ed9:	48 85 c0             	test   %rax,%rax
+  802edc:	75 1f                	jne    802efd <duppage+0xcb>
+  802ede:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ee5:	ff ff ff 
+  802ee8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802eec:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802eef:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ef3:	25 00 08 00 00       	and    $0x800,%eax
+  802ef8:	48 85 c0             	test   %rax,%rax
+  802efb:	74 4c                	je     802f49 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  802efd:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  802f04:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802f07:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802f0b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802f0e:	48 89 ce             	mov    %rcx,%rsi
+  802f11:	89 c7                	mov    %eax,%edi
+  802f13:	48 b8 2c 9d ff ff ff 	movabs $0xffffffffffff9d2c,%rax
+  802f1a:	ff ff ff 
+  802f1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f21:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  802f23:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f2a:	48 89 c6             	mov    %rax,%rsi
+  802f2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f32:	48 b8 2c 9d ff ff ff 	movabs $0xffffffffffff9d2c,%rax
+  802f39:	ff ff ff 
+  802f3c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f40:	ff d0                	call   *%rax
+		return 0;
+  802f42:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f47:	eb 26                	jmp    802f6f <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  802f49:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802f4d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802f50:	ba 05 00 00 00       	mov    $0x5,%edx
+  802f55:	48 89 ce             	mov    %rcx,%rsi
+  802f58:	89 c7                	mov    %eax,%edi
+  802f5a:	48 b8 2c 9d ff ff ff 	movabs $0xffffffffffff9d2c,%rax
+  802f61:	ff ff ff 
+  802f64:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f68:	ff d0                	call   *%rax
+		return 0;
+  802f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  802f6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f73:	c9                   	leave
+  802f74:	c3                   	ret
+
+0000000000802f75 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  802f75:	55                   	push   %rbp
+  802f76:	48 89 e5             	mov    %rsp,%rbp
+  802f79:	53                   	push   %rbx
+  802f7a:	48 83 ec 28          	sub    $0x28,%rsp
+  802f7e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f7e <duphuge+0x9>
+  802f85:	49 bb c2 60 00 00 00 	movabs $0x60c2,%r11
+  802f8c:	00 00 00 
+  802f8f:	4c 01 db             	add    %r11,%rbx
+  802f92:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f95:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  802f99:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f9d:	48 c1 e8 15          	shr    $0x15,%rax
+  802fa1:	48 89 c2             	mov    %rax,%rdx
+  802fa4:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802fab:	ff ff ff 
+  802fae:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fb2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fb6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  802fba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fbe:	25 00 04 00 00       	and    $0x400,%eax
+  802fc3:	48 85 c0             	test   %rax,%rax
+  802fc6:	74 0e                	je     802fd6 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  802fc8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fcc:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fd1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fd4:	eb 1e                	jmp    802ff4 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  802fd6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fda:	25 02 08 00 00       	and    $0x802,%eax
+  802fdf:	48 85 c0             	test   %rax,%rax
+  802fe2:	74 09                	je     802fed <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  802fe4:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  802feb:	eb 07                	jmp    802ff4 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  802fed:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  802ff4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ff7:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802ffb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ffe:	48 89 ce             	mov    %rcx,%rsi
+  803001:	89 c7                	mov    %eax,%edi
+  803003:	48 b8 2c 9d ff ff ff 	movabs $0xffffffffffff9d2c,%rax
+  80300a:	ff ff ff 
+  80300d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803011:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  803013:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803016:	25 00 08 00 00       	and    $0x800,%eax
+  80301b:	85 c0                	test   %eax,%eax
+  80301d:	74 1f                	je     80303e <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  80301f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803022:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803026:	48 89 c6             	mov    %rax,%rsi
+  803029:	bf 00 00 00 00       	mov    $0x0,%edi
+  80302e:	48 b8 2c 9d ff ff ff 	movabs $0xffffffffffff9d2c,%rax
+  803035:	ff ff ff 
+  803038:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80303c:	ff d0                	call   *%rax
+	return 0;
+  80303e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803043:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803047:	c9                   	leave
+  803048:	c3                   	ret
+
+0000000000803049 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  803049:	55                   	push   %rbp
+  80304a:	48 89 e5             	mov    %rsp,%rbp
+  80304d:	41 57                	push   %r15
+  80304f:	53                   	push   %rbx
+  803050:	48 83 ec 10          	sub    $0x10,%rsp
+  803054:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803054 <fork+0xb>
+  80305b:	49 bb ec 5f 00 00 00 	movabs $0x5fec,%r11
+  803062:	00 00 00 
+  803065:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  803068:	49 89 df             	mov    %rbx,%r15
+  80306b:	48 b8 cf 97 ff ff ff 	movabs $0xffffffffffff97cf,%rax
+  803072:	ff ff ff 
+  803075:	48 01 d8             	add    %rbx,%rax
+  803078:	ff d0                	call   *%rax
+  80307a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80307d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803081:	75 42                	jne    8030c5 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803083:	49 89 df             	mov    %rbx,%r15
+  803086:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  80308d:	ff ff ff 
+  803090:	48 01 d8             	add    %rbx,%rax
+  803093:	ff d0                	call   *%rax
+  803095:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80309a:	48 98                	cltq
+  80309c:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8030a3:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8030aa:	ff ff ff 
+  8030ad:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8030b1:	48 01 c2             	add    %rax,%rdx
+  8030b4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8030bb:	ff ff ff 
+  8030be:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030c2:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8030c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8030c8:	48 83 c4 10          	add    $0x10,%rsp
+  8030cc:	5b                   	pop    %rbx
+  8030cd:	41 5f                	pop    %r15
+  8030cf:	5d                   	pop    %rbp
+  8030d0:	c3                   	ret
+
+00000000008030d1 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8030d1:	55                   	push   %rbp
+  8030d2:	48 89 e5             	mov    %rsp,%rbp
+  8030d5:	41 57                	push   %r15
+  8030d7:	53                   	push   %rbx
+  8030d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8030dc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030dc <ufork+0xb>
+  8030e3:	49 bb 64 5f 00 00 00 	movabs $0x5f64,%r11
+  8030ea:	00 00 00 
+  8030ed:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  8030f0:	48 b8 23 98 ff ff ff 	movabs $0xffffffffffff9823,%rax
+  8030f7:	ff ff ff 
+  8030fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030fe:	48 89 c7             	mov    %rax,%rdi
+  803101:	49 89 df             	mov    %rbx,%r15
+  803104:	48 b8 84 da ff ff ff 	movabs $0xffffffffffffda84,%rax
+  80310b:	ff ff ff 
+  80310e:	48 01 d8             	add    %rbx,%rax
+  803111:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  803113:	b8 07 00 00 00       	mov    $0x7,%eax
+  803118:	cd 30                	int    $0x30
+  80311a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  80311d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  803120:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  803123:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803127:	0f 84 03 02 00 00    	je     803330 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  80312d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803134:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  803135:	e9 28 01 00 00       	jmp    803262 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  80313a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80313e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803142:	48 89 c2             	mov    %rax,%rdx
+  803145:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80314c:	ff ff ff 
+  80314f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803153:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803157:	83 e0 01             	and    $0x1,%eax
+  80315a:	48 85 c0             	test   %rax,%rax
+  80315d:	0f 84 f7 00 00 00    	je     80325a <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803163:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803167:	48 c1 e8 15          	shr    $0x15,%rax
+  80316b:	48 89 c2             	mov    %rax,%rdx
+  80316e:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803175:	ff ff ff 
+  803178:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80317c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803180:	25 81 00 00 00       	and    $0x81,%eax
+  803185:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  80318b:	75 29                	jne    8031b6 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  80318d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803191:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803194:	48 89 d6             	mov    %rdx,%rsi
+  803197:	89 c7                	mov    %eax,%edi
+  803199:	48 b8 35 9f ff ff ff 	movabs $0xffffffffffff9f35,%rax
+  8031a0:	ff ff ff 
+  8031a3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031a7:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  8031a9:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8031b0:	00 
+  8031b1:	e9 ac 00 00 00       	jmp    803262 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8031b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031ba:	48 c1 e8 15          	shr    $0x15,%rax
+  8031be:	48 89 c2             	mov    %rax,%rdx
+  8031c1:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8031c8:	ff ff ff 
+  8031cb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031cf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031d3:	83 e0 01             	and    $0x1,%eax
+  8031d6:	48 85 c0             	test   %rax,%rax
+  8031d9:	74 75                	je     803250 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  8031db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031df:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031e3:	48 89 c2             	mov    %rax,%rdx
+  8031e6:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8031ed:	ff ff ff 
+  8031f0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031f4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031f8:	83 e0 01             	and    $0x1,%eax
+  8031fb:	48 85 c0             	test   %rax,%rax
+  8031fe:	74 46                	je     803246 <ufork+0x175>
+  803200:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803204:	48 c1 e8 0c          	shr    $0xc,%rax
+  803208:	48 89 c2             	mov    %rax,%rdx
+  80320b:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803212:	ff ff ff 
+  803215:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803219:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80321d:	83 e0 04             	and    $0x4,%eax
+  803220:	48 85 c0             	test   %rax,%rax
+  803223:	74 21                	je     803246 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  803225:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803229:	48 c1 e8 0c          	shr    $0xc,%rax
+  80322d:	89 c2                	mov    %eax,%edx
+  80322f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803232:	89 d6                	mov    %edx,%esi
+  803234:	89 c7                	mov    %eax,%edi
+  803236:	48 b8 f2 9d ff ff ff 	movabs $0xffffffffffff9df2,%rax
+  80323d:	ff ff ff 
+  803240:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803244:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  803246:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  80324d:	00 
+  80324e:	eb 12                	jmp    803262 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803250:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803257:	00 
+  803258:	eb 08                	jmp    803262 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  80325a:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803261:	40 
+		for (; addr < USTACKTOP;){
+  803262:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803267:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80326b:	0f 83 c9 fe ff ff    	jae    80313a <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803271:	48 b8 59 9c ff ff ff 	movabs $0xffffffffffff9c59,%rax
+  803278:	ff ff ff 
+  80327b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80327f:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803281:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803284:	ba 07 00 00 00       	mov    $0x7,%edx
+  803289:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80328e:	48 89 ce             	mov    %rcx,%rsi
+  803291:	89 c7                	mov    %eax,%edi
+  803293:	49 89 df             	mov    %rbx,%r15
+  803296:	48 b8 7a 90 ff ff ff 	movabs $0xffffffffffff907a,%rax
+  80329d:	ff ff ff 
+  8032a0:	48 01 d8             	add    %rbx,%rax
+  8032a3:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8032a5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032a8:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8032af:	ff ff ff 
+  8032b2:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8032b6:	48 89 d6             	mov    %rdx,%rsi
+  8032b9:	89 c7                	mov    %eax,%edi
+  8032bb:	49 89 df             	mov    %rbx,%r15
+  8032be:	48 b8 70 92 ff ff ff 	movabs $0xffffffffffff9270,%rax
+  8032c5:	ff ff ff 
+  8032c8:	48 01 d8             	add    %rbx,%rax
+  8032cb:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8032cd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032d0:	be 02 00 00 00       	mov    $0x2,%esi
+  8032d5:	89 c7                	mov    %eax,%edi
+  8032d7:	49 89 df             	mov    %rbx,%r15
+  8032da:	48 b8 b1 91 ff ff ff 	movabs $0xffffffffffff91b1,%rax
+  8032e1:	ff ff ff 
+  8032e4:	48 01 d8             	add    %rbx,%rax
+  8032e7:	ff d0                	call   *%rax
+  8032e9:	85 c0                	test   %eax,%eax
+  8032eb:	74 3e                	je     80332b <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  8032ed:	48 b8 1f e2 ff ff ff 	movabs $0xffffffffffffe21f,%rax
+  8032f4:	ff ff ff 
+  8032f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032fb:	48 89 c2             	mov    %rax,%rdx
+  8032fe:	be 07 01 00 00       	mov    $0x107,%esi
+  803303:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  80330a:	ff ff ff 
+  80330d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803311:	48 89 c7             	mov    %rax,%rdi
+  803314:	49 89 df             	mov    %rbx,%r15
+  803317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80331c:	48 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%rcx
+  803323:	ff ff ff 
+  803326:	48 01 d9             	add    %rbx,%rcx
+  803329:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  80332b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80332e:	eb 59                	jmp    803389 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803330:	49 89 df             	mov    %rbx,%r15
+  803333:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  80333a:	ff ff ff 
+  80333d:	48 01 d8             	add    %rbx,%rax
+  803340:	ff d0                	call   *%rax
+  803342:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803347:	48 98                	cltq
+  803349:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803350:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803357:	ff ff ff 
+  80335a:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80335e:	48 01 c2             	add    %rax,%rdx
+  803361:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803368:	ff ff ff 
+  80336b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80336f:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803372:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803379:	00 00 00 
+  80337c:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803383:	00 
+		return 0;
+  803384:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  803389:	48 83 c4 10          	add    $0x10,%rsp
+  80338d:	5b                   	pop    %rbx
+  80338e:	41 5f                	pop    %r15
+  803390:	5d                   	pop    %rbp
+  803391:	c3                   	ret
+
+0000000000803392 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803392:	55                   	push   %rbp
+  803393:	48 89 e5             	mov    %rsp,%rbp
+  803396:	41 57                	push   %r15
+  803398:	48 83 ec 08          	sub    $0x8,%rsp
+  80339c:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80339c <sfork+0xa>
+  8033a3:	49 bb a4 5c 00 00 00 	movabs $0x5ca4,%r11
+  8033aa:	00 00 00 
+  8033ad:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8033b0:	48 b8 3a e2 ff ff ff 	movabs $0xffffffffffffe23a,%rax
+  8033b7:	ff ff ff 
+  8033ba:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8033be:	48 89 c2             	mov    %rax,%rdx
+  8033c1:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8033c6:	48 b8 70 e1 ff ff ff 	movabs $0xffffffffffffe170,%rax
+  8033cd:	ff ff ff 
+  8033d0:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8033d4:	48 89 c7             	mov    %rax,%rdi
+  8033d7:	49 89 cf             	mov    %rcx,%r15
+  8033da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033df:	49 b8 25 73 ff ff ff 	movabs $0xffffffffffff7325,%r8
+  8033e6:	ff ff ff 
+  8033e9:	49 01 c8             	add    %rcx,%r8
+  8033ec:	41 ff d0             	call   *%r8
+
+00000000008033ef <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8033ef:	55                   	push   %rbp
+  8033f0:	48 89 e5             	mov    %rsp,%rbp
+  8033f3:	41 57                	push   %r15
+  8033f5:	53                   	push   %rbx
+  8033f6:	48 83 ec 30          	sub    $0x30,%rsp
+  8033fa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033fa <ipc_recv+0xb>
+  803401:	49 bb 46 5c 00 00 00 	movabs $0x5c46,%r11
+  803408:	00 00 00 
+  80340b:	4c 01 db             	add    %r11,%rbx
+  80340e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803412:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803416:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80341a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80341f:	75 0e                	jne    80342f <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  803421:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803428:	00 00 00 
+  80342b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  80342f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803433:	48 89 c7             	mov    %rax,%rdi
+  803436:	49 89 df             	mov    %rbx,%r15
+  803439:	48 b8 a3 93 ff ff ff 	movabs $0xffffffffffff93a3,%rax
+  803440:	ff ff ff 
+  803443:	48 01 d8             	add    %rbx,%rax
+  803446:	ff d0                	call   *%rax
+  803448:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  80344b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803450:	74 2a                	je     80347c <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  803452:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803456:	75 19                	jne    803471 <ipc_recv+0x82>
+  803458:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80345f:	ff ff ff 
+  803462:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803466:	48 8b 00             	mov    (%rax),%rax
+  803469:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80346f:	eb 05                	jmp    803476 <ipc_recv+0x87>
+  803471:	b8 00 00 00 00       	mov    $0x0,%eax
+  803476:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80347a:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80347c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803481:	74 2a                	je     8034ad <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  803483:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803487:	75 19                	jne    8034a2 <ipc_recv+0xb3>
+  803489:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803490:	ff ff ff 
+  803493:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803497:	48 8b 00             	mov    (%rax),%rax
+  80349a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8034a0:	eb 05                	jmp    8034a7 <ipc_recv+0xb8>
+  8034a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8034ab:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  8034ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034b1:	74 05                	je     8034b8 <ipc_recv+0xc9>
+		return res;
+  8034b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034b6:	eb 17                	jmp    8034cf <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  8034b8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8034bf:	ff ff ff 
+  8034c2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034c6:	48 8b 00             	mov    (%rax),%rax
+  8034c9:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8034cf:	48 83 c4 30          	add    $0x30,%rsp
+  8034d3:	5b                   	pop    %rbx
+  8034d4:	41 5f                	pop    %r15
+  8034d6:	5d                   	pop    %rbp
+  8034d7:	c3                   	ret
+
+00000000008034d8 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8034d8:	55                   	push   %rbp
+  8034d9:	48 89 e5             	mov    %rsp,%rbp
+  8034dc:	41 57                	push   %r15
+  8034de:	53                   	push   %rbx
+  8034df:	48 83 ec 20          	sub    $0x20,%rsp
+  8034e3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034e3 <ipc_send+0xb>
+  8034ea:	49 bb 5d 5b 00 00 00 	movabs $0x5b5d,%r11
+  8034f1:	00 00 00 
+  8034f4:	4c 01 db             	add    %r11,%rbx
+  8034f7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8034fa:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8034fd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803501:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  803504:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803509:	75 0e                	jne    803519 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  80350b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803512:	00 00 00 
+  803515:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  803519:	90                   	nop
+  80351a:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80351d:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803520:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803524:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803527:	89 c7                	mov    %eax,%edi
+  803529:	49 89 df             	mov    %rbx,%r15
+  80352c:	48 b8 39 93 ff ff ff 	movabs $0xffffffffffff9339,%rax
+  803533:	ff ff ff 
+  803536:	48 01 d8             	add    %rbx,%rax
+  803539:	ff d0                	call   *%rax
+  80353b:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  80353e:	74 da                	je     80351a <ipc_send+0x42>
+		;
+}
+  803540:	90                   	nop
+  803541:	90                   	nop
+  803542:	48 83 c4 20          	add    $0x20,%rsp
+  803546:	5b                   	pop    %rbx
+  803547:	41 5f                	pop    %r15
+  803549:	5d                   	pop    %rbp
+  80354a:	c3                   	ret
+
+000000000080354b <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  80354b:	55                   	push   %rbp
+  80354c:	48 89 e5             	mov    %rsp,%rbp
+  80354f:	41 57                	push   %r15
+  803551:	53                   	push   %rbx
+  803552:	48 83 ec 40          	sub    $0x40,%rsp
+  803556:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803556 <ipc_call+0xb>
+  80355d:	49 bb ea 5a 00 00 00 	movabs $0x5aea,%r11
+  803564:	00 00 00 
+  803567:	4c 01 db             	add    %r11,%rbx
+  80356a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80356d:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803570:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803574:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803577:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80357b:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80357f:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803584:	75 0e                	jne    803594 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  803586:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80358d:	00 00 00 
+  803590:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803594:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803599:	75 0e                	jne    8035a9 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80359b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8035a2:	00 00 00 
+  8035a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8035a9:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8035ac:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8035b0:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8035b3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8035b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8035c0:	49 89 f8             	mov    %rdi,%r8
+  8035c3:	89 c7                	mov    %eax,%edi
+  8035c5:	49 89 df             	mov    %rbx,%r15
+  8035c8:	48 b8 fc 93 ff ff ff 	movabs $0xffffffffffff93fc,%rax
+  8035cf:	ff ff ff 
+  8035d2:	48 01 d8             	add    %rbx,%rax
+  8035d5:	ff d0                	call   *%rax
+  8035d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8035da:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8035df:	74 2a                	je     80360b <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8035e1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035e5:	75 19                	jne    803600 <ipc_call+0xb5>
+  8035e7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8035ee:	ff ff ff 
+  8035f1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035f5:	48 8b 00             	mov    (%rax),%rax
+  8035f8:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8035fe:	eb 05                	jmp    803605 <ipc_call+0xba>
+  803600:	b8 00 00 00 00       	mov    $0x0,%eax
+  803605:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803609:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  80360b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80360f:	74 05                	je     803616 <ipc_call+0xcb>
+		return r;
+  803611:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803614:	eb 17                	jmp    80362d <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  803616:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80361d:	ff ff ff 
+  803620:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803624:	48 8b 00             	mov    (%rax),%rax
+  803627:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80362d:	48 83 c4 40          	add    $0x40,%rsp
+  803631:	5b                   	pop    %rbx
+  803632:	41 5f                	pop    %r15
+  803634:	5d                   	pop    %rbp
+  803635:	c3                   	ret
+
+0000000000803636 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  803636:	55                   	push   %rbp
+  803637:	48 89 e5             	mov    %rsp,%rbp
+  80363a:	41 57                	push   %r15
+  80363c:	53                   	push   %rbx
+  80363d:	48 83 ec 70          	sub    $0x70,%rsp
+  803641:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803641 <ipc_callw+0xb>
+  803648:	49 bb ff 59 00 00 00 	movabs $0x59ff,%r11
+  80364f:	00 00 00 
+  803652:	4c 01 db             	add    %r11,%rbx
+  803655:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  803658:	89 75 98             	mov    %esi,-0x68(%rbp)
+  80365b:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  80365f:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  803663:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  803668:	76 0a                	jbe    803674 <ipc_callw+0x3e>
+		return -E_INVAL;
+  80366a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80366f:	e9 b7 00 00 00       	jmp    80372b <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  803674:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803678:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80367c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803680:	48 89 ce             	mov    %rcx,%rsi
+  803683:	48 89 c7             	mov    %rax,%rdi
+  803686:	49 89 df             	mov    %rbx,%r15
+  803689:	48 b8 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rax
+  803690:	ff ff ff 
+  803693:	48 01 d8             	add    %rbx,%rax
+  803696:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  803698:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80369f:	00 
+  8036a0:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8036a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036a8:	48 01 d0             	add    %rdx,%rax
+  8036ab:	48 83 e8 01          	sub    $0x1,%rax
+  8036af:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8036b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036bc:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8036c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036c4:	48 29 d0             	sub    %rdx,%rax
+  8036c7:	48 c1 e8 03          	shr    $0x3,%rax
+  8036cb:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  8036cf:	89 c1                	mov    %eax,%ecx
+  8036d1:	8b 75 98             	mov    -0x68(%rbp),%esi
+  8036d4:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  8036d8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8036db:	49 89 d1             	mov    %rdx,%r9
+  8036de:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8036e5:	00 00 00 
+  8036e8:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8036ef:	00 00 00 
+  8036f2:	89 c7                	mov    %eax,%edi
+  8036f4:	49 89 df             	mov    %rbx,%r15
+  8036f7:	48 b8 fc 93 ff ff ff 	movabs $0xffffffffffff93fc,%rax
+  8036fe:	ff ff ff 
+  803701:	48 01 d8             	add    %rbx,%rax
+  803704:	ff d0                	call   *%rax
+  803706:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  803709:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80370d:	74 05                	je     803714 <ipc_callw+0xde>
+		return r;
+  80370f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803712:	eb 17                	jmp    80372b <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  803714:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80371b:	ff ff ff 
+  80371e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803722:	48 8b 00             	mov    (%rax),%rax
+  803725:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80372b:	48 83 c4 70          	add    $0x70,%rsp
+  80372f:	5b                   	pop    %rbx
+  803730:	41 5f                	pop    %r15
+  803732:	5d                   	pop    %rbp
+  803733:	c3                   	ret
+
+0000000000803734 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  803734:	55                   	push   %rbp
+  803735:	48 89 e5             	mov    %rsp,%rbp
+  803738:	41 57                	push   %r15
+  80373a:	53                   	push   %rbx
+  80373b:	48 83 ec 40          	sub    $0x40,%rsp
+  80373f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80373f <ipc_callv+0xb>
+  803746:	49 bb 01 59 00 00 00 	movabs $0x5901,%r11
+  80374d:	00 00 00 
+  803750:	4c 01 db             	add    %r11,%rbx
+  803753:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803756:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  803759:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80375d:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803760:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  803764:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  803768:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80376f:	00 00 00 
+  803772:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  803776:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80377a:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80377e:	74 11                	je     803791 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  803780:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803784:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  803788:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80378b:	c1 e0 14             	shl    $0x14,%eax
+  80378e:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  803791:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  803795:	74 14                	je     8037ab <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  803797:	8b 45 20             	mov    0x20(%rbp),%eax
+  80379a:	83 e8 01             	sub    $0x1,%eax
+  80379d:	48 63 d0             	movslq %eax,%rdx
+  8037a0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8037a4:	48 09 d0             	or     %rdx,%rax
+  8037a7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  8037ab:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8037ae:	c1 e0 10             	shl    $0x10,%eax
+  8037b1:	0b 45 10             	or     0x10(%rbp),%eax
+  8037b4:	89 c1                	mov    %eax,%ecx
+  8037b6:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  8037b9:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8037bd:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8037c1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8037c5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8037c8:	4d 89 c1             	mov    %r8,%r9
+  8037cb:	49 89 f8             	mov    %rdi,%r8
+  8037ce:	89 c7                	mov    %eax,%edi
+  8037d0:	49 89 df             	mov    %rbx,%r15
+  8037d3:	48 b8 fc 93 ff ff ff 	movabs $0xffffffffffff93fc,%rax
+  8037da:	ff ff ff 
+  8037dd:	48 01 d8             	add    %rbx,%rax
+  8037e0:	ff d0                	call   *%rax
+  8037e2:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8037e5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8037e9:	74 05                	je     8037f0 <ipc_callv+0xbc>
+		return r;
+  8037eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037ee:	eb 17                	jmp    803807 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8037f0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8037f7:	ff ff ff 
+  8037fa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037fe:	48 8b 00             	mov    (%rax),%rax
+  803801:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803807:	48 83 c4 40          	add    $0x40,%rsp
+  80380b:	5b                   	pop    %rbx
+  80380c:	41 5f                	pop    %r15
+  80380e:	5d                   	pop    %rbp
+  80380f:	c3                   	ret
+
+0000000000803810 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  803810:	55                   	push   %rbp
+  803811:	48 89 e5             	mov    %rsp,%rbp
+  803814:	41 57                	push   %r15
+  803816:	53                   	push   %rbx
+  803817:	48 83 ec 40          	sub    $0x40,%rsp
+  80381b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80381b <ipc_reply_recv+0xb>
+  803822:	49 bb 25 58 00 00 00 	movabs $0x5825,%r11
+  803829:	00 00 00 
+  80382c:	4c 01 db             	add    %r11,%rbx
+  80382f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803832:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803835:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803839:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80383c:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803840:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803844:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803849:	75 0e                	jne    803859 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  80384b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803852:	00 00 00 
+  803855:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803859:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80385e:	75 0e                	jne    80386e <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803860:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803867:	00 00 00 
+  80386a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  80386e:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803871:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  803875:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803879:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80387c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803880:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803883:	4d 89 c1             	mov    %r8,%r9
+  803886:	49 89 f8             	mov    %rdi,%r8
+  803889:	89 c7                	mov    %eax,%edi
+  80388b:	49 89 df             	mov    %rbx,%r15
+  80388e:	48 b8 70 94 ff ff ff 	movabs $0xffffffffffff9470,%rax
+  803895:	ff ff ff 
+  803898:	48 01 d8             	add    %rbx,%rax
+  80389b:	ff d0                	call   *%rax
+  80389d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  8038a0:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8038a5:	74 2a                	je     8038d1 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8038a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038ab:	75 19                	jne    8038c6 <ipc_reply_recv+0xb6>
+  8038ad:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8038b4:	ff ff ff 
+  8038b7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8038bb:	48 8b 00             	mov    (%rax),%rax
+  8038be:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8038c4:	eb 05                	jmp    8038cb <ipc_reply_recv+0xbb>
+  8038c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038cf:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  8038d1:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  8038d6:	74 2a                	je     803902 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8038d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038dc:	75 19                	jne    8038f7 <ipc_reply_recv+0xe7>
+  8038de:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8038e5:	ff ff ff 
+  8038e8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8038ec:	48 8b 00             	mov    (%rax),%rax
+  8038ef:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8038f5:	eb 05                	jmp    8038fc <ipc_reply_recv+0xec>
+  8038f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038fc:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  803900:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803902:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803906:	74 05                	je     80390d <ipc_reply_recv+0xfd>
+		return r;
+  803908:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80390b:	eb 17                	jmp    803924 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  80390d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803914:	ff ff ff 
+  803917:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80391b:	48 8b 00             	mov    (%rax),%rax
+  80391e:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803924:	48 83 c4 40          	add    $0x40,%rsp
+  803928:	5b                   	pop    %rbx
+  803929:	41 5f                	pop    %r15
+  80392b:	5d                   	pop    %rbp
+  80392c:	c3                   	ret
+
+000000000080392d <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  80392d:	55                   	push   %rbp
+  80392e:	48 89 e5             	mov    %rsp,%rbp
+  803931:	41 57                	push   %r15
+  803933:	53                   	push   %rbx
+  803934:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  80393b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80393b <ipc_window_batch+0xe>
+  803942:	49 bb 05 57 00 00 00 	movabs $0x5705,%r11
+  803949:	00 00 00 
+  80394c:	4c 01 db             	add    %r11,%rbx
+  80394f:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  803955:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  80395c:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803962:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  803968:	e9 15 01 00 00       	jmp    803a82 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  80396d:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803973:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803976:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  80397d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803980:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803983:	39 c2                	cmp    %eax,%edx
+  803985:	0f 4e c2             	cmovle %edx,%eax
+  803988:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  80398b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803992:	eb 6b                	jmp    8039ff <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803994:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803997:	48 98                	cltq
+  803999:	48 c1 e0 05          	shl    $0x5,%rax
+  80399d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8039a1:	48 01 e8             	add    %rbp,%rax
+  8039a4:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  8039aa:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  8039b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039b3:	c1 e0 0c             	shl    $0xc,%eax
+  8039b6:	48 63 d0             	movslq %eax,%rdx
+  8039b9:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  8039c0:	48 01 c2             	add    %rax,%rdx
+  8039c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039c6:	48 98                	cltq
+  8039c8:	48 c1 e0 05          	shl    $0x5,%rax
+  8039cc:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8039d0:	48 01 e8             	add    %rbp,%rax
+  8039d3:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  8039d9:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  8039dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039df:	48 98                	cltq
+  8039e1:	48 c1 e0 05          	shl    $0x5,%rax
+  8039e5:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8039e9:	48 01 e8             	add    %rbp,%rax
+  8039ec:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  8039f3:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  8039f9:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  8039fb:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8039ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a02:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  803a05:	7c 8d                	jl     803994 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  803a07:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  803a0e:	74 27                	je     803a37 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803a10:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803a13:	48 63 d0             	movslq %eax,%rdx
+  803a16:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803a1d:	48 89 d6             	mov    %rdx,%rsi
+  803a20:	48 89 c7             	mov    %rax,%rdi
+  803a23:	49 89 df             	mov    %rbx,%r15
+  803a26:	48 b8 13 97 ff ff ff 	movabs $0xffffffffffff9713,%rax
+  803a2d:	ff ff ff 
+  803a30:	48 01 d8             	add    %rbx,%rax
+  803a33:	ff d0                	call   *%rax
+  803a35:	eb 25                	jmp    803a5c <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  803a37:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803a3a:	48 63 d0             	movslq %eax,%rdx
+  803a3d:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803a44:	48 89 d6             	mov    %rdx,%rsi
+  803a47:	48 89 c7             	mov    %rax,%rdi
+  803a4a:	49 89 df             	mov    %rbx,%r15
+  803a4d:	48 b8 71 97 ff ff ff 	movabs $0xffffffffffff9771,%rax
+  803a54:	ff ff ff 
+  803a57:	48 01 d8             	add    %rbx,%rax
+  803a5a:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803a5c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803a5f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803a63:	79 05                	jns    803a6a <ipc_window_batch+0x13d>
+			return r;
+  803a65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a68:	eb 2a                	jmp    803a94 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  803a6a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803a6d:	c1 e0 0c             	shl    $0xc,%eax
+  803a70:	48 98                	cltq
+  803a72:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  803a79:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803a7c:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803a82:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  803a89:	0f 8f de fe ff ff    	jg     80396d <ipc_window_batch+0x40>
+	}
+	return 0;
+  803a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a94:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  803a9b:	5b                   	pop    %rbx
+  803a9c:	41 5f                	pop    %r15
+  803a9e:	5d                   	pop    %rbp
+  803a9f:	c3                   	ret
+
+0000000000803aa0 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803aa0:	55                   	push   %rbp
+  803aa1:	48 89 e5             	mov    %rsp,%rbp
+  803aa4:	48 83 ec 10          	sub    $0x10,%rsp
+  803aa8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803aa8 <ipc_map_window+0x8>
+  803aaf:	49 bb 98 55 00 00 00 	movabs $0x5598,%r11
+  803ab6:	00 00 00 
+  803ab9:	4c 01 d8             	add    %r11,%rax
+  803abc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803ac0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803ac3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803ac6:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803aca:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803acf:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ad4:	49 b8 ed a8 ff ff ff 	movabs $0xffffffffffffa8ed,%r8
+  803adb:	ff ff ff 
+  803ade:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803ae2:	ff d0                	call   *%rax
+}
+  803ae4:	c9                   	leave
+  803ae5:	c3                   	ret
+
+0000000000803ae6 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803ae6:	55                   	push   %rbp
+  803ae7:	48 89 e5             	mov    %rsp,%rbp
+  803aea:	48 83 ec 10          	sub    $0x10,%rsp
+  803aee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803aee <ipc_unmap_window+0x8>
+  803af5:	49 bb 52 55 00 00 00 	movabs $0x5552,%r11
+  803afc:	00 00 00 
+  803aff:	4c 01 d8             	add    %r11,%rax
+  803b02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803b06:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  803b09:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803b0c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803b10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803b15:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b1a:	49 b8 ed a8 ff ff ff 	movabs $0xffffffffffffa8ed,%r8
+  803b21:	ff ff ff 
+  803b24:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803b28:	ff d0                	call   *%rax
+}
+  803b2a:	c9                   	leave
+  803b2b:	c3                   	ret
+
+0000000000803b2c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803b2c:	55                   	push   %rbp
+  803b2d:	48 89 e5             	mov    %rsp,%rbp
+  803b30:	48 83 ec 18          	sub    $0x18,%rsp
+  803b34:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b34 <ipc_find_env+0x8>
+  803b3b:	49 bb 0c 55 00 00 00 	movabs $0x550c,%r11
+  803b42:	00 00 00 
+  803b45:	4c 01 d8             	add    %r11,%rax
+  803b48:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803b4b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803b52:	eb 57                	jmp    803bab <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803b54:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803b5b:	ff ff ff 
+  803b5e:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803b62:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803b65:	48 63 d2             	movslq %edx,%rdx
+  803b68:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803b6f:	48 01 ca             	add    %rcx,%rdx
+  803b72:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803b79:	8b 12                	mov    (%rdx),%edx
+  803b7b:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803b7e:	75 27                	jne    803ba7 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803b80:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803b87:	ff ff ff 
+  803b8a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803b8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b91:	48 98                	cltq
+  803b93:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803b9a:	48 01 d0             	add    %rdx,%rax
+  803b9d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803ba3:	8b 00                	mov    (%rax),%eax
+  803ba5:	eb 12                	jmp    803bb9 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803ba7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803bab:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803bb2:	7e a0                	jle    803b54 <ipc_find_env+0x28>
+	}
+	return 0;
+  803bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bb9:	c9                   	leave
+  803bba:	c3                   	ret
+
+0000000000803bbb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803bbb:	55                   	push   %rbp
+  803bbc:	48 89 e5             	mov    %rsp,%rbp
+  803bbf:	48 83 ec 08          	sub    $0x8,%rsp
+  803bc3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803bc3 <fd2num+0x8>
+  803bca:	49 bb 7d 54 00 00 00 	movabs $0x547d,%r11
+  803bd1:	00 00 00 
+  803bd4:	4c 01 d8             	add    %r11,%rax
+  803bd7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803bdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803bdf:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803be6:	ff ff ff 
+  803be9:	48 01 d0             	add    %rdx,%rax
+  803bec:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803bf0:	c9                   	leave
+  803bf1:	c3                   	ret
+
+0000000000803bf2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803bf2:	55                   	push   %rbp
+  803bf3:	48 89 e5             	mov    %rsp,%rbp
+  803bf6:	48 83 ec 08          	sub    $0x8,%rsp
+  803bfa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803bfa <fd2data+0x8>
+  803c01:	49 bb 46 54 00 00 00 	movabs $0x5446,%r11
+  803c08:	00 00 00 
+  803c0b:	4c 01 d8             	add    %r11,%rax
+  803c0e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803c12:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803c16:	48 89 d7             	mov    %rdx,%rdi
+  803c19:	48 ba 7b ab ff ff ff 	movabs $0xffffffffffffab7b,%rdx
+  803c20:	ff ff ff 
+  803c23:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803c27:	ff d0                	call   *%rax
+  803c29:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803c2f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803c33:	c9                   	leave
+  803c34:	c3                   	ret
+
+0000000000803c35 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803c35:	55                   	push   %rbp
+  803c36:	48 89 e5             	mov    %rsp,%rbp
+  803c39:	48 83 ec 18          	sub    $0x18,%rsp
+  803c3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c3d <fd_alloc+0x8>
+  803c44:	49 bb 03 54 00 00 00 	movabs $0x5403,%r11
+  803c4b:	00 00 00 
+  803c4e:	4c 01 d8             	add    %r11,%rax
+  803c51:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803c55:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803c5c:	eb 75                	jmp    803cd3 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803c5e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803c61:	48 63 d2             	movslq %edx,%rdx
+  803c64:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803c6b:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803c6f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803c73:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c77:	48 89 d1             	mov    %rdx,%rcx
+  803c7a:	48 c1 e9 15          	shr    $0x15,%rcx
+  803c7e:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803c85:	ff ff ff 
+  803c88:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803c8c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803c90:	83 e2 01             	and    $0x1,%edx
+  803c93:	48 85 d2             	test   %rdx,%rdx
+  803c96:	74 25                	je     803cbd <fd_alloc+0x88>
+  803c98:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c9c:	48 89 d1             	mov    %rdx,%rcx
+  803c9f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803ca3:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803caa:	ff ff ff 
+  803cad:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803cb1:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803cb5:	83 e2 01             	and    $0x1,%edx
+  803cb8:	48 85 d2             	test   %rdx,%rdx
+  803cbb:	75 12                	jne    803ccf <fd_alloc+0x9a>
+			*fd_store = fd;
+  803cbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cc1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803cc5:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ccd:	eb 1a                	jmp    803ce9 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803ccf:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803cd3:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803cd7:	7e 85                	jle    803c5e <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803cd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cdd:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803ce4:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803ce9:	c9                   	leave
+  803cea:	c3                   	ret
+
+0000000000803ceb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803ceb:	55                   	push   %rbp
+  803cec:	48 89 e5             	mov    %rsp,%rbp
+  803cef:	48 83 ec 20          	sub    $0x20,%rsp
+  803cf3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cf3 <fd_lookup+0x8>
+  803cfa:	49 bb 4d 53 00 00 00 	movabs $0x534d,%r11
+  803d01:	00 00 00 
+  803d04:	4c 01 d8             	add    %r11,%rax
+  803d07:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803d0a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803d0e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d12:	78 06                	js     803d1a <fd_lookup+0x2f>
+  803d14:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803d18:	7e 07                	jle    803d21 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803d1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d1f:	eb 73                	jmp    803d94 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803d21:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803d24:	48 63 d2             	movslq %edx,%rdx
+  803d27:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803d2e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803d32:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803d36:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d3a:	48 89 d1             	mov    %rdx,%rcx
+  803d3d:	48 c1 e9 15          	shr    $0x15,%rcx
+  803d41:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803d48:	ff ff ff 
+  803d4b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803d4f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803d53:	83 e2 01             	and    $0x1,%edx
+  803d56:	48 85 d2             	test   %rdx,%rdx
+  803d59:	74 22                	je     803d7d <fd_lookup+0x92>
+  803d5b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d5f:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803d63:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803d6a:	ff ff ff 
+  803d6d:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803d71:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d75:	83 e0 01             	and    $0x1,%eax
+  803d78:	48 85 c0             	test   %rax,%rax
+  803d7b:	75 07                	jne    803d84 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803d7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d82:	eb 10                	jmp    803d94 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803d84:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d88:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d8c:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d94:	c9                   	leave
+  803d95:	c3                   	ret
+
+0000000000803d96 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803d96:	55                   	push   %rbp
+  803d97:	48 89 e5             	mov    %rsp,%rbp
+  803d9a:	41 57                	push   %r15
+  803d9c:	53                   	push   %rbx
+  803d9d:	48 83 ec 30          	sub    $0x30,%rsp
+  803da1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803da1 <fd_close+0xb>
+  803da8:	49 bb 9f 52 00 00 00 	movabs $0x529f,%r11
+  803daf:	00 00 00 
+  803db2:	4c 01 db             	add    %r11,%rbx
+  803db5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803db9:	89 f0                	mov    %esi,%eax
+  803dbb:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803dbe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dc2:	48 89 c7             	mov    %rax,%rdi
+  803dc5:	48 b8 7b ab ff ff ff 	movabs $0xffffffffffffab7b,%rax
+  803dcc:	ff ff ff 
+  803dcf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dd3:	ff d0                	call   *%rax
+  803dd5:	89 c2                	mov    %eax,%edx
+  803dd7:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803ddb:	48 89 c6             	mov    %rax,%rsi
+  803dde:	89 d7                	mov    %edx,%edi
+  803de0:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  803de7:	ff ff ff 
+  803dea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dee:	ff d0                	call   *%rax
+  803df0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803df3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803df7:	78 0a                	js     803e03 <fd_close+0x6d>
+	    || fd != fd2)
+  803df9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dfd:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803e01:	74 12                	je     803e15 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803e03:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803e07:	74 05                	je     803e0e <fd_close+0x78>
+  803e09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e0c:	eb 7a                	jmp    803e88 <fd_close+0xf2>
+  803e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e13:	eb 73                	jmp    803e88 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803e15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e19:	8b 00                	mov    (%rax),%eax
+  803e1b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803e1f:	48 89 d6             	mov    %rdx,%rsi
+  803e22:	89 c7                	mov    %eax,%edi
+  803e24:	48 b8 51 ae ff ff ff 	movabs $0xffffffffffffae51,%rax
+  803e2b:	ff ff ff 
+  803e2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e32:	ff d0                	call   *%rax
+  803e34:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e37:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e3b:	78 2a                	js     803e67 <fd_close+0xd1>
+		if (dev->dev_close)
+  803e3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e41:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803e45:	48 85 c0             	test   %rax,%rax
+  803e48:	74 16                	je     803e60 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803e4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e4e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803e52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e56:	48 89 c7             	mov    %rax,%rdi
+  803e59:	ff d2                	call   *%rdx
+  803e5b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e5e:	eb 07                	jmp    803e67 <fd_close+0xd1>
+		else
+			r = 0;
+  803e60:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  803e67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e6b:	48 89 c6             	mov    %rax,%rsi
+  803e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e73:	49 89 df             	mov    %rbx,%r15
+  803e76:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  803e7d:	ff ff ff 
+  803e80:	48 01 d8             	add    %rbx,%rax
+  803e83:	ff d0                	call   *%rax
+	return r;
+  803e85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803e88:	48 83 c4 30          	add    $0x30,%rsp
+  803e8c:	5b                   	pop    %rbx
+  803e8d:	41 5f                	pop    %r15
+  803e8f:	5d                   	pop    %rbp
+  803e90:	c3                   	ret
+
+0000000000803e91 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803e91:	55                   	push   %rbp
+  803e92:	48 89 e5             	mov    %rsp,%rbp
+  803e95:	41 57                	push   %r15
+  803e97:	48 83 ec 28          	sub    $0x28,%rsp
+  803e9b:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803e9b <dev_lookup+0xa>
+  803ea2:	49 bb a5 51 00 00 00 	movabs $0x51a5,%r11
+  803ea9:	00 00 00 
+  803eac:	4c 01 d9             	add    %r11,%rcx
+  803eaf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803eb2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803eb6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803ebd:	eb 45                	jmp    803f04 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803ebf:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803ec6:	00 00 00 
+  803ec9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ecc:	48 98                	cltq
+  803ece:	48 01 ca             	add    %rcx,%rdx
+  803ed1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ed5:	8b 00                	mov    (%rax),%eax
+  803ed7:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803eda:	75 24                	jne    803f00 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803edc:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803ee3:	00 00 00 
+  803ee6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ee9:	48 98                	cltq
+  803eeb:	48 01 ca             	add    %rcx,%rdx
+  803eee:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ef2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ef6:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efe:	eb 74                	jmp    803f74 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803f00:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803f04:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803f0b:	00 00 00 
+  803f0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f11:	48 98                	cltq
+  803f13:	48 01 ca             	add    %rcx,%rdx
+  803f16:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f1a:	48 85 c0             	test   %rax,%rax
+  803f1d:	75 a0                	jne    803ebf <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803f1f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803f26:	ff ff ff 
+  803f29:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803f2d:	48 8b 00             	mov    (%rax),%rax
+  803f30:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803f36:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803f39:	89 c6                	mov    %eax,%esi
+  803f3b:	48 b8 50 e2 ff ff ff 	movabs $0xffffffffffffe250,%rax
+  803f42:	ff ff ff 
+  803f45:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803f49:	48 89 c7             	mov    %rax,%rdi
+  803f4c:	49 89 cf             	mov    %rcx,%r15
+  803f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f54:	49 b8 fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%r8
+  803f5b:	ff ff ff 
+  803f5e:	49 01 c8             	add    %rcx,%r8
+  803f61:	41 ff d0             	call   *%r8
+	*dev = 0;
+  803f64:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f68:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  803f6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803f74:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803f78:	c9                   	leave
+  803f79:	c3                   	ret
+
+0000000000803f7a <close>:
+
+int
+close(int fdnum)
+{
+  803f7a:	55                   	push   %rbp
+  803f7b:	48 89 e5             	mov    %rsp,%rbp
+  803f7e:	53                   	push   %rbx
+  803f7f:	48 83 ec 28          	sub    $0x28,%rsp
+  803f83:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f83 <close+0x9>
+  803f8a:	49 bb bd 50 00 00 00 	movabs $0x50bd,%r11
+  803f91:	00 00 00 
+  803f94:	4c 01 db             	add    %r11,%rbx
+  803f97:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803f9a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f9e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803fa1:	48 89 d6             	mov    %rdx,%rsi
+  803fa4:	89 c7                	mov    %eax,%edi
+  803fa6:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  803fad:	ff ff ff 
+  803fb0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fb4:	ff d0                	call   *%rax
+  803fb6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fb9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fbd:	79 05                	jns    803fc4 <close+0x4a>
+		return r;
+  803fbf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fc2:	eb 1c                	jmp    803fe0 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803fc4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fc8:	be 01 00 00 00       	mov    $0x1,%esi
+  803fcd:	48 89 c7             	mov    %rax,%rdi
+  803fd0:	48 b8 56 ad ff ff ff 	movabs $0xffffffffffffad56,%rax
+  803fd7:	ff ff ff 
+  803fda:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fde:	ff d0                	call   *%rax
+}
+  803fe0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803fe4:	c9                   	leave
+  803fe5:	c3                   	ret
+
+0000000000803fe6 <close_all>:
+
+void
+close_all(void)
+{
+  803fe6:	55                   	push   %rbp
+  803fe7:	48 89 e5             	mov    %rsp,%rbp
+  803fea:	53                   	push   %rbx
+  803feb:	48 83 ec 18          	sub    $0x18,%rsp
+  803fef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fef <close_all+0x9>
+  803ff6:	49 bb 51 50 00 00 00 	movabs $0x5051,%r11
+  803ffd:	00 00 00 
+  804000:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  804003:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80400a:	eb 19                	jmp    804025 <close_all+0x3f>
+		close(i);
+  80400c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80400f:	89 c7                	mov    %eax,%edi
+  804011:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  804018:	ff ff ff 
+  80401b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80401f:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  804021:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804025:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  804029:	7e e1                	jle    80400c <close_all+0x26>
+}
+  80402b:	90                   	nop
+  80402c:	90                   	nop
+  80402d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804031:	c9                   	leave
+  804032:	c3                   	ret
+
+0000000000804033 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  804033:	55                   	push   %rbp
+  804034:	48 89 e5             	mov    %rsp,%rbp
+  804037:	41 57                	push   %r15
+  804039:	53                   	push   %rbx
+  80403a:	48 83 ec 40          	sub    $0x40,%rsp
+  80403e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80403e <dup+0xb>
+  804045:	49 bb 02 50 00 00 00 	movabs $0x5002,%r11
+  80404c:	00 00 00 
+  80404f:	4c 01 db             	add    %r11,%rbx
+  804052:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  804055:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  804058:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80405c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80405f:	48 89 d6             	mov    %rdx,%rsi
+  804062:	89 c7                	mov    %eax,%edi
+  804064:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  80406b:	ff ff ff 
+  80406e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804072:	ff d0                	call   *%rax
+  804074:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804077:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80407b:	79 08                	jns    804085 <dup+0x52>
+		return r;
+  80407d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804080:	e9 a4 01 00 00       	jmp    804229 <dup+0x1f6>
+	close(newfdnum);
+  804085:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804088:	89 c7                	mov    %eax,%edi
+  80408a:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  804091:	ff ff ff 
+  804094:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804098:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  80409a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80409d:	48 98                	cltq
+  80409f:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8040a5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8040a9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  8040ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040b1:	48 89 c7             	mov    %rax,%rdi
+  8040b4:	48 b8 b2 ab ff ff ff 	movabs $0xffffffffffffabb2,%rax
+  8040bb:	ff ff ff 
+  8040be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040c2:	ff d0                	call   *%rax
+  8040c4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  8040c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040cc:	48 89 c7             	mov    %rax,%rdi
+  8040cf:	48 b8 b2 ab ff ff ff 	movabs $0xffffffffffffabb2,%rax
+  8040d6:	ff ff ff 
+  8040d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040dd:	ff d0                	call   *%rax
+  8040df:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8040e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e7:	48 c1 e8 15          	shr    $0x15,%rax
+  8040eb:	48 89 c2             	mov    %rax,%rdx
+  8040ee:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8040f5:	ff ff ff 
+  8040f8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8040fc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804100:	83 e0 01             	and    $0x1,%eax
+  804103:	48 85 c0             	test   %rax,%rax
+  804106:	74 7f                	je     804187 <dup+0x154>
+  804108:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80410c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804110:	48 89 c2             	mov    %rax,%rdx
+  804113:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80411a:	ff ff ff 
+  80411d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804121:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804125:	83 e0 01             	and    $0x1,%eax
+  804128:	48 85 c0             	test   %rax,%rax
+  80412b:	74 5a                	je     804187 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80412d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804131:	48 c1 e8 0c          	shr    $0xc,%rax
+  804135:	48 89 c2             	mov    %rax,%rdx
+  804138:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80413f:	ff ff ff 
+  804142:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804146:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80414a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80414f:	89 c1                	mov    %eax,%ecx
+  804151:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804155:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804159:	41 89 c8             	mov    %ecx,%r8d
+  80415c:	48 89 d1             	mov    %rdx,%rcx
+  80415f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804164:	48 89 c6             	mov    %rax,%rsi
+  804167:	bf 00 00 00 00       	mov    $0x0,%edi
+  80416c:	49 89 df             	mov    %rbx,%r15
+  80416f:	48 b8 df 90 ff ff ff 	movabs $0xffffffffffff90df,%rax
+  804176:	ff ff ff 
+  804179:	48 01 d8             	add    %rbx,%rax
+  80417c:	ff d0                	call   *%rax
+  80417e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804181:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804185:	78 5f                	js     8041e6 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  804187:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80418b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80418f:	48 89 c2             	mov    %rax,%rdx
+  804192:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804199:	ff ff ff 
+  80419c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8041a0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8041a4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8041a9:	89 c1                	mov    %eax,%ecx
+  8041ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041b3:	41 89 c8             	mov    %ecx,%r8d
+  8041b6:	48 89 d1             	mov    %rdx,%rcx
+  8041b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041be:	48 89 c6             	mov    %rax,%rsi
+  8041c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041c6:	49 89 df             	mov    %rbx,%r15
+  8041c9:	48 b8 df 90 ff ff ff 	movabs $0xffffffffffff90df,%rax
+  8041d0:	ff ff ff 
+  8041d3:	48 01 d8             	add    %rbx,%rax
+  8041d6:	ff d0                	call   *%rax
+  8041d8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041db:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041df:	78 08                	js     8041e9 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  8041e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8041e4:	eb 43                	jmp    804229 <dup+0x1f6>
+			goto err;
+  8041e6:	90                   	nop
+  8041e7:	eb 01                	jmp    8041ea <dup+0x1b7>
+		goto err;
+  8041e9:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  8041ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041ee:	48 89 c6             	mov    %rax,%rsi
+  8041f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041f6:	49 89 df             	mov    %rbx,%r15
+  8041f9:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  804200:	ff ff ff 
+  804203:	48 01 d8             	add    %rbx,%rax
+  804206:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  804208:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80420c:	48 89 c6             	mov    %rax,%rsi
+  80420f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804214:	49 89 df             	mov    %rbx,%r15
+  804217:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  80421e:	ff ff ff 
+  804221:	48 01 d8             	add    %rbx,%rax
+  804224:	ff d0                	call   *%rax
+	return r;
+  804226:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804229:	48 83 c4 40          	add    $0x40,%rsp
+  80422d:	5b                   	pop    %rbx
+  80422e:	41 5f                	pop    %r15
+  804230:	5d                   	pop    %rbp
+  804231:	c3                   	ret
+
+0000000000804232 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  804232:	55                   	push   %rbp
+  804233:	48 89 e5             	mov    %rsp,%rbp
+  804236:	41 57                	push   %r15
+  804238:	53                   	push   %rbx
+  804239:	48 83 ec 40          	sub    $0x40,%rsp
+  80423d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80423d <read+0xb>
+  804244:	49 bb 03 4e 00 00 00 	movabs $0x4e03,%r11
+  80424b:	00 00 00 
+  80424e:	4c 01 db             	add    %r11,%rbx
+  804251:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804254:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804258:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80425c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804260:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804263:	48 89 d6             	mov    %rdx,%rsi
+  804266:	89 c7                	mov    %eax,%edi
+  804268:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  80426f:	ff ff ff 
+  804272:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804276:	ff d0                	call   *%rax
+  804278:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80427b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80427f:	78 28                	js     8042a9 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804281:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804285:	8b 00                	mov    (%rax),%eax
+  804287:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80428b:	48 89 d6             	mov    %rdx,%rsi
+  80428e:	89 c7                	mov    %eax,%edi
+  804290:	48 b8 51 ae ff ff ff 	movabs $0xffffffffffffae51,%rax
+  804297:	ff ff ff 
+  80429a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80429e:	ff d0                	call   *%rax
+  8042a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042a7:	79 08                	jns    8042b1 <read+0x7f>
+		return r;
+  8042a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042ac:	e9 8b 00 00 00       	jmp    80433c <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8042b1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042b5:	8b 40 08             	mov    0x8(%rax),%eax
+  8042b8:	83 e0 03             	and    $0x3,%eax
+  8042bb:	83 f8 01             	cmp    $0x1,%eax
+  8042be:	75 4b                	jne    80430b <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8042c0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8042c7:	ff ff ff 
+  8042ca:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8042ce:	48 8b 00             	mov    (%rax),%rax
+  8042d1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8042d7:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8042da:	89 c6                	mov    %eax,%esi
+  8042dc:	48 b8 6f e2 ff ff ff 	movabs $0xffffffffffffe26f,%rax
+  8042e3:	ff ff ff 
+  8042e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042ea:	48 89 c7             	mov    %rax,%rdi
+  8042ed:	49 89 df             	mov    %rbx,%r15
+  8042f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042f5:	48 b9 fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%rcx
+  8042fc:	ff ff ff 
+  8042ff:	48 01 d9             	add    %rbx,%rcx
+  804302:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804304:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804309:	eb 31                	jmp    80433c <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80430b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80430f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804313:	48 85 c0             	test   %rax,%rax
+  804316:	75 07                	jne    80431f <read+0xed>
+		return -E_NOT_SUPP;
+  804318:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80431d:	eb 1d                	jmp    80433c <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  80431f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804323:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  804327:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80432b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80432f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804333:	48 89 ce             	mov    %rcx,%rsi
+  804336:	48 89 c7             	mov    %rax,%rdi
+  804339:	41 ff d0             	call   *%r8
+}
+  80433c:	48 83 c4 40          	add    $0x40,%rsp
+  804340:	5b                   	pop    %rbx
+  804341:	41 5f                	pop    %r15
+  804343:	5d                   	pop    %rbp
+  804344:	c3                   	ret
+
+0000000000804345 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  804345:	55                   	push   %rbp
+  804346:	48 89 e5             	mov    %rsp,%rbp
+  804349:	53                   	push   %rbx
+  80434a:	48 83 ec 38          	sub    $0x38,%rsp
+  80434e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80434e <readn+0x9>
+  804355:	49 bb f2 4c 00 00 00 	movabs $0x4cf2,%r11
+  80435c:	00 00 00 
+  80435f:	4c 01 db             	add    %r11,%rbx
+  804362:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804365:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804369:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80436d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804374:	eb 4b                	jmp    8043c1 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  804376:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804379:	48 98                	cltq
+  80437b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80437f:	48 29 c2             	sub    %rax,%rdx
+  804382:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804385:	48 63 c8             	movslq %eax,%rcx
+  804388:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80438c:	48 01 c1             	add    %rax,%rcx
+  80438f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804392:	48 89 ce             	mov    %rcx,%rsi
+  804395:	89 c7                	mov    %eax,%edi
+  804397:	48 b8 f2 b1 ff ff ff 	movabs $0xffffffffffffb1f2,%rax
+  80439e:	ff ff ff 
+  8043a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043a5:	ff d0                	call   *%rax
+  8043a7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  8043aa:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8043ae:	79 05                	jns    8043b5 <readn+0x70>
+			return m;
+  8043b0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8043b3:	eb 1d                	jmp    8043d2 <readn+0x8d>
+		if (m == 0)
+  8043b5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8043b9:	74 13                	je     8043ce <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  8043bb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8043be:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8043c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043c4:	48 98                	cltq
+  8043c6:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  8043ca:	72 aa                	jb     804376 <readn+0x31>
+  8043cc:	eb 01                	jmp    8043cf <readn+0x8a>
+			break;
+  8043ce:	90                   	nop
+	}
+	return tot;
+  8043cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8043d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043d6:	c9                   	leave
+  8043d7:	c3                   	ret
+
+00000000008043d8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8043d8:	55                   	push   %rbp
+  8043d9:	48 89 e5             	mov    %rsp,%rbp
+  8043dc:	41 57                	push   %r15
+  8043de:	53                   	push   %rbx
+  8043df:	48 83 ec 40          	sub    $0x40,%rsp
+  8043e3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043e3 <write+0xb>
+  8043ea:	49 bb 5d 4c 00 00 00 	movabs $0x4c5d,%r11
+  8043f1:	00 00 00 
+  8043f4:	4c 01 db             	add    %r11,%rbx
+  8043f7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8043fa:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8043fe:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804402:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804406:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804409:	48 89 d6             	mov    %rdx,%rsi
+  80440c:	89 c7                	mov    %eax,%edi
+  80440e:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  804415:	ff ff ff 
+  804418:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80441c:	ff d0                	call   *%rax
+  80441e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804421:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804425:	78 28                	js     80444f <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804427:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80442b:	8b 00                	mov    (%rax),%eax
+  80442d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804431:	48 89 d6             	mov    %rdx,%rsi
+  804434:	89 c7                	mov    %eax,%edi
+  804436:	48 b8 51 ae ff ff ff 	movabs $0xffffffffffffae51,%rax
+  80443d:	ff ff ff 
+  804440:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804444:	ff d0                	call   *%rax
+  804446:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804449:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80444d:	79 08                	jns    804457 <write+0x7f>
+		return r;
+  80444f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804452:	e9 8a 00 00 00       	jmp    8044e1 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804457:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80445b:	8b 40 08             	mov    0x8(%rax),%eax
+  80445e:	83 e0 03             	and    $0x3,%eax
+  804461:	85 c0                	test   %eax,%eax
+  804463:	75 4b                	jne    8044b0 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  804465:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80446c:	ff ff ff 
+  80446f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804473:	48 8b 00             	mov    (%rax),%rax
+  804476:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80447c:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80447f:	89 c6                	mov    %eax,%esi
+  804481:	48 b8 8b e2 ff ff ff 	movabs $0xffffffffffffe28b,%rax
+  804488:	ff ff ff 
+  80448b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80448f:	48 89 c7             	mov    %rax,%rdi
+  804492:	49 89 df             	mov    %rbx,%r15
+  804495:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449a:	48 b9 fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%rcx
+  8044a1:	ff ff ff 
+  8044a4:	48 01 d9             	add    %rbx,%rcx
+  8044a7:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8044a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8044ae:	eb 31                	jmp    8044e1 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8044b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8044b8:	48 85 c0             	test   %rax,%rax
+  8044bb:	75 07                	jne    8044c4 <write+0xec>
+		return -E_NOT_SUPP;
+  8044bd:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8044c2:	eb 1d                	jmp    8044e1 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  8044c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044c8:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8044cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044d0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8044d4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8044d8:	48 89 ce             	mov    %rcx,%rsi
+  8044db:	48 89 c7             	mov    %rax,%rdi
+  8044de:	41 ff d0             	call   *%r8
+}
+  8044e1:	48 83 c4 40          	add    $0x40,%rsp
+  8044e5:	5b                   	pop    %rbx
+  8044e6:	41 5f                	pop    %r15
+  8044e8:	5d                   	pop    %rbp
+  8044e9:	c3                   	ret
+
+00000000008044ea <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8044ea:	55                   	push   %rbp
+  8044eb:	48 89 e5             	mov    %rsp,%rbp
+  8044ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8044f2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044f2 <seek+0x8>
+  8044f9:	49 bb 4e 4b 00 00 00 	movabs $0x4b4e,%r11
+  804500:	00 00 00 
+  804503:	4c 01 d8             	add    %r11,%rax
+  804506:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804509:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80450c:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  804510:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804513:	48 89 ce             	mov    %rcx,%rsi
+  804516:	89 d7                	mov    %edx,%edi
+  804518:	48 ba ab ac ff ff ff 	movabs $0xffffffffffffacab,%rdx
+  80451f:	ff ff ff 
+  804522:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804526:	ff d0                	call   *%rax
+  804528:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80452b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80452f:	79 05                	jns    804536 <seek+0x4c>
+		return r;
+  804531:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804534:	eb 0f                	jmp    804545 <seek+0x5b>
+	fd->fd_offset = offset;
+  804536:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80453a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80453d:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  804540:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804545:	c9                   	leave
+  804546:	c3                   	ret
+
+0000000000804547 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  804547:	55                   	push   %rbp
+  804548:	48 89 e5             	mov    %rsp,%rbp
+  80454b:	41 57                	push   %r15
+  80454d:	53                   	push   %rbx
+  80454e:	48 83 ec 30          	sub    $0x30,%rsp
+  804552:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804552 <ftruncate+0xb>
+  804559:	49 bb ee 4a 00 00 00 	movabs $0x4aee,%r11
+  804560:	00 00 00 
+  804563:	4c 01 db             	add    %r11,%rbx
+  804566:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804569:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80456c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804570:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804573:	48 89 d6             	mov    %rdx,%rsi
+  804576:	89 c7                	mov    %eax,%edi
+  804578:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  80457f:	ff ff ff 
+  804582:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804586:	ff d0                	call   *%rax
+  804588:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80458b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80458f:	78 28                	js     8045b9 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804591:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804595:	8b 00                	mov    (%rax),%eax
+  804597:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80459b:	48 89 d6             	mov    %rdx,%rsi
+  80459e:	89 c7                	mov    %eax,%edi
+  8045a0:	48 b8 51 ae ff ff ff 	movabs $0xffffffffffffae51,%rax
+  8045a7:	ff ff ff 
+  8045aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045ae:	ff d0                	call   *%rax
+  8045b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8045b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045b7:	79 08                	jns    8045c1 <ftruncate+0x7a>
+		return r;
+  8045b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045bc:	e9 83 00 00 00       	jmp    804644 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8045c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045c5:	8b 40 08             	mov    0x8(%rax),%eax
+  8045c8:	83 e0 03             	and    $0x3,%eax
+  8045cb:	85 c0                	test   %eax,%eax
+  8045cd:	75 4b                	jne    80461a <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8045cf:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8045d6:	ff ff ff 
+  8045d9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8045dd:	48 8b 00             	mov    (%rax),%rax
+  8045e0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8045e6:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8045e9:	89 c6                	mov    %eax,%esi
+  8045eb:	48 b8 a8 e2 ff ff ff 	movabs $0xffffffffffffe2a8,%rax
+  8045f2:	ff ff ff 
+  8045f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045f9:	48 89 c7             	mov    %rax,%rdi
+  8045fc:	49 89 df             	mov    %rbx,%r15
+  8045ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804604:	48 b9 fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%rcx
+  80460b:	ff ff ff 
+  80460e:	48 01 d9             	add    %rbx,%rcx
+  804611:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804613:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804618:	eb 2a                	jmp    804644 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80461a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80461e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  804622:	48 85 c0             	test   %rax,%rax
+  804625:	75 07                	jne    80462e <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  804627:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80462c:	eb 16                	jmp    804644 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  80462e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804632:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804636:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80463a:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80463d:	89 d6                	mov    %edx,%esi
+  80463f:	48 89 c7             	mov    %rax,%rdi
+  804642:	ff d1                	call   *%rcx
+}
+  804644:	48 83 c4 30          	add    $0x30,%rsp
+  804648:	5b                   	pop    %rbx
+  804649:	41 5f                	pop    %r15
+  80464b:	5d                   	pop    %rbp
+  80464c:	c3                   	ret
+
+000000000080464d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80464d:	55                   	push   %rbp
+  80464e:	48 89 e5             	mov    %rsp,%rbp
+  804651:	53                   	push   %rbx
+  804652:	48 83 ec 38          	sub    $0x38,%rsp
+  804656:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804656 <fstat+0x9>
+  80465d:	49 bb ea 49 00 00 00 	movabs $0x49ea,%r11
+  804664:	00 00 00 
+  804667:	4c 01 db             	add    %r11,%rbx
+  80466a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80466d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804671:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804675:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804678:	48 89 d6             	mov    %rdx,%rsi
+  80467b:	89 c7                	mov    %eax,%edi
+  80467d:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  804684:	ff ff ff 
+  804687:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80468b:	ff d0                	call   *%rax
+  80468d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804690:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804694:	78 28                	js     8046be <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804696:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80469a:	8b 00                	mov    (%rax),%eax
+  80469c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8046a0:	48 89 d6             	mov    %rdx,%rsi
+  8046a3:	89 c7                	mov    %eax,%edi
+  8046a5:	48 b8 51 ae ff ff ff 	movabs $0xffffffffffffae51,%rax
+  8046ac:	ff ff ff 
+  8046af:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046b3:	ff d0                	call   *%rax
+  8046b5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046b8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046bc:	79 05                	jns    8046c3 <fstat+0x76>
+		return r;
+  8046be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046c1:	eb 5e                	jmp    804721 <fstat+0xd4>
+	if (!dev->dev_stat)
+  8046c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046c7:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8046cb:	48 85 c0             	test   %rax,%rax
+  8046ce:	75 07                	jne    8046d7 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8046d0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8046d5:	eb 4a                	jmp    804721 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8046d7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046db:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8046de:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046e2:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8046e9:	00 00 00 
+	stat->st_isdir = 0;
+  8046ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046f0:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8046f7:	00 00 00 
+	stat->st_dev = dev;
+  8046fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8046fe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804702:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804709:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80470d:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804711:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804715:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804719:	48 89 d6             	mov    %rdx,%rsi
+  80471c:	48 89 c7             	mov    %rax,%rdi
+  80471f:	ff d1                	call   *%rcx
+}
+  804721:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804725:	c9                   	leave
+  804726:	c3                   	ret
+
+0000000000804727 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804727:	55                   	push   %rbp
+  804728:	48 89 e5             	mov    %rsp,%rbp
+  80472b:	41 57                	push   %r15
+  80472d:	53                   	push   %rbx
+  80472e:	48 83 ec 20          	sub    $0x20,%rsp
+  804732:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804732 <stat+0xb>
+  804739:	49 bb 0e 49 00 00 00 	movabs $0x490e,%r11
+  804740:	00 00 00 
+  804743:	4c 01 db             	add    %r11,%rbx
+  804746:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80474a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80474e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804752:	be 00 00 00 00       	mov    $0x0,%esi
+  804757:	48 89 c7             	mov    %rax,%rdi
+  80475a:	49 89 df             	mov    %rbx,%r15
+  80475d:	48 b8 c1 b9 ff ff ff 	movabs $0xffffffffffffb9c1,%rax
+  804764:	ff ff ff 
+  804767:	48 01 d8             	add    %rbx,%rax
+  80476a:	ff d0                	call   *%rax
+  80476c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80476f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804773:	79 05                	jns    80477a <stat+0x53>
+		return fd;
+  804775:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804778:	eb 37                	jmp    8047b1 <stat+0x8a>
+	r = fstat(fd, stat);
+  80477a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80477e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804781:	48 89 d6             	mov    %rdx,%rsi
+  804784:	89 c7                	mov    %eax,%edi
+  804786:	48 b8 0d b6 ff ff ff 	movabs $0xffffffffffffb60d,%rax
+  80478d:	ff ff ff 
+  804790:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804794:	ff d0                	call   *%rax
+  804796:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  804799:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80479c:	89 c7                	mov    %eax,%edi
+  80479e:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  8047a5:	ff ff ff 
+  8047a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047ac:	ff d0                	call   *%rax
+	return r;
+  8047ae:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8047b1:	48 83 c4 20          	add    $0x20,%rsp
+  8047b5:	5b                   	pop    %rbx
+  8047b6:	41 5f                	pop    %r15
+  8047b8:	5d                   	pop    %rbp
+  8047b9:	c3                   	ret
+
+00000000008047ba <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8047ba:	55                   	push   %rbp
+  8047bb:	48 89 e5             	mov    %rsp,%rbp
+  8047be:	41 57                	push   %r15
+  8047c0:	53                   	push   %rbx
+  8047c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8047c5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047c5 <fsipc+0xb>
+  8047cc:	49 bb 7b 48 00 00 00 	movabs $0x487b,%r11
+  8047d3:	00 00 00 
+  8047d6:	4c 01 db             	add    %r11,%rbx
+  8047d9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8047dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8047e0:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8047e7:	00 00 00 
+  8047ea:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8047ed:	85 c0                	test   %eax,%eax
+  8047ef:	75 24                	jne    804815 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8047f1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8047f6:	49 89 df             	mov    %rbx,%r15
+  8047f9:	48 b8 ec aa ff ff ff 	movabs $0xffffffffffffaaec,%rax
+  804800:	ff ff ff 
+  804803:	48 01 d8             	add    %rbx,%rax
+  804806:	ff d0                	call   *%rax
+  804808:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80480f:	00 00 00 
+  804812:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  804815:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80481c:	00 00 00 
+  80481f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804822:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804826:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804829:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80482f:	49 89 d0             	mov    %rdx,%r8
+  804832:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804837:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80483e:	00 00 00 
+  804841:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804845:	89 c7                	mov    %eax,%edi
+  804847:	49 89 df             	mov    %rbx,%r15
+  80484a:	48 b8 0b a5 ff ff ff 	movabs $0xffffffffffffa50b,%rax
+  804851:	ff ff ff 
+  804854:	48 01 d8             	add    %rbx,%rax
+  804857:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804859:	48 83 c4 10          	add    $0x10,%rsp
+  80485d:	5b                   	pop    %rbx
+  80485e:	41 5f                	pop    %r15
+  804860:	5d                   	pop    %rbp
+  804861:	c3                   	ret
+
+0000000000804862 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804862:	55                   	push   %rbp
+  804863:	48 89 e5             	mov    %rsp,%rbp
+  804866:	41 57                	push   %r15
+  804868:	53                   	push   %rbx
+  804869:	48 83 ec 20          	sub    $0x20,%rsp
+  80486d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80486d <fsipc_words+0xb>
+  804874:	49 bb d3 47 00 00 00 	movabs $0x47d3,%r11
+  80487b:	00 00 00 
+  80487e:	4c 01 db             	add    %r11,%rbx
+  804881:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804884:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804888:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  80488c:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804893:	00 00 00 
+  804896:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804899:	85 c0                	test   %eax,%eax
+  80489b:	75 24                	jne    8048c1 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80489d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8048a2:	49 89 df             	mov    %rbx,%r15
+  8048a5:	48 b8 ec aa ff ff ff 	movabs $0xffffffffffffaaec,%rax
+  8048ac:	ff ff ff 
+  8048af:	48 01 d8             	add    %rbx,%rax
+  8048b2:	ff d0                	call   *%rax
+  8048b4:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8048bb:	00 00 00 
+  8048be:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8048c1:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8048c8:	00 00 00 
+  8048cb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8048ce:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8048d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8048d6:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8048d9:	89 c7                	mov    %eax,%edi
+  8048db:	49 89 df             	mov    %rbx,%r15
+  8048de:	48 b8 f6 a5 ff ff ff 	movabs $0xffffffffffffa5f6,%rax
+  8048e5:	ff ff ff 
+  8048e8:	48 01 d8             	add    %rbx,%rax
+  8048eb:	ff d0                	call   *%rax
+}
+  8048ed:	48 83 c4 20          	add    $0x20,%rsp
+  8048f1:	5b                   	pop    %rbx
+  8048f2:	41 5f                	pop    %r15
+  8048f4:	5d                   	pop    %rbp
+  8048f5:	c3                   	ret
+
+00000000008048f6 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  8048f6:	55                   	push   %rbp
+  8048f7:	48 89 e5             	mov    %rsp,%rbp
+  8048fa:	41 57                	push   %r15
+  8048fc:	53                   	push   %rbx
+  8048fd:	48 83 ec 40          	sub    $0x40,%rsp
+  804901:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804901 <fsipc_pages+0xb>
+  804908:	49 bb 3f 47 00 00 00 	movabs $0x473f,%r11
+  80490f:	00 00 00 
+  804912:	4c 01 db             	add    %r11,%rbx
+  804915:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804918:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80491c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804920:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804923:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80492a:	00 00 00 
+  80492d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804930:	85 c0                	test   %eax,%eax
+  804932:	75 24                	jne    804958 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804934:	bf 01 00 00 00       	mov    $0x1,%edi
+  804939:	49 89 df             	mov    %rbx,%r15
+  80493c:	48 b8 ec aa ff ff ff 	movabs $0xffffffffffffaaec,%rax
+  804943:	ff ff ff 
+  804946:	48 01 d8             	add    %rbx,%rax
+  804949:	ff d0                	call   *%rax
+  80494b:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804952:	00 00 00 
+  804955:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804958:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80495d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804961:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804964:	48 98                	cltq
+  804966:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80496a:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80496e:	0f 95 c0             	setne  %al
+  804971:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804974:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80497b:	00 
+  80497c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804980:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804984:	48 01 d0             	add    %rdx,%rax
+  804987:	48 83 e8 01          	sub    $0x1,%rax
+  80498b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80498f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804993:	ba 00 00 00 00       	mov    $0x0,%edx
+  804998:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80499c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049a0:	48 29 d0             	sub    %rdx,%rax
+  8049a3:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8049a7:	41 89 c2             	mov    %eax,%r10d
+  8049aa:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8049b1:	00 00 00 
+  8049b4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049b7:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8049bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8049bf:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8049c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8049c6:	6a 40                	push   $0x40
+  8049c8:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8049cd:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8049d4:	00 
+  8049d5:	6a 05                	push   $0x5
+  8049d7:	41 89 f9             	mov    %edi,%r9d
+  8049da:	49 89 c8             	mov    %rcx,%r8
+  8049dd:	44 89 d1             	mov    %r10d,%ecx
+  8049e0:	89 c7                	mov    %eax,%edi
+  8049e2:	49 89 df             	mov    %rbx,%r15
+  8049e5:	48 b8 f4 a6 ff ff ff 	movabs $0xffffffffffffa6f4,%rax
+  8049ec:	ff ff ff 
+  8049ef:	48 01 d8             	add    %rbx,%rax
+  8049f2:	ff d0                	call   *%rax
+  8049f4:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  8049f8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8049fc:	5b                   	pop    %rbx
+  8049fd:	41 5f                	pop    %r15
+  8049ff:	5d                   	pop    %rbp
+  804a00:	c3                   	ret
+
+0000000000804a01 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804a01:	55                   	push   %rbp
+  804a02:	48 89 e5             	mov    %rsp,%rbp
+  804a05:	41 57                	push   %r15
+  804a07:	53                   	push   %rbx
+  804a08:	48 83 ec 20          	sub    $0x20,%rsp
+  804a0c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a0c <open+0xb>
+  804a13:	49 bb 34 46 00 00 00 	movabs $0x4634,%r11
+  804a1a:	00 00 00 
+  804a1d:	4c 01 db             	add    %r11,%rbx
+  804a20:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804a24:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804a27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a2b:	48 89 c7             	mov    %rax,%rdi
+  804a2e:	49 89 df             	mov    %rbx,%r15
+  804a31:	48 b8 2a 83 ff ff ff 	movabs $0xffffffffffff832a,%rax
+  804a38:	ff ff ff 
+  804a3b:	48 01 d8             	add    %rbx,%rax
+  804a3e:	ff d0                	call   *%rax
+  804a40:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804a45:	7e 0a                	jle    804a51 <open+0x50>
+		return -E_BAD_PATH;
+  804a47:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804a4c:	e9 18 01 00 00       	jmp    804b69 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804a51:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804a55:	48 89 c7             	mov    %rax,%rdi
+  804a58:	49 89 df             	mov    %rbx,%r15
+  804a5b:	48 b8 f5 ab ff ff ff 	movabs $0xffffffffffffabf5,%rax
+  804a62:	ff ff ff 
+  804a65:	48 01 d8             	add    %rbx,%rax
+  804a68:	ff d0                	call   *%rax
+  804a6a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a6d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a71:	74 08                	je     804a7b <open+0x7a>
+		return r;
+  804a73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a76:	e9 ee 00 00 00       	jmp    804b69 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804a7b:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804a82:	00 00 00 
+  804a85:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804a88:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804a8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a93:	48 89 c6             	mov    %rax,%rsi
+  804a96:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804a9d:	00 00 00 
+  804aa0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804aa4:	48 89 c7             	mov    %rax,%rdi
+  804aa7:	49 89 df             	mov    %rbx,%r15
+  804aaa:	48 b8 be 83 ff ff ff 	movabs $0xffffffffffff83be,%rax
+  804ab1:	ff ff ff 
+  804ab4:	48 01 d8             	add    %rbx,%rax
+  804ab7:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804ab9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804abd:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804ac2:	48 89 c6             	mov    %rax,%rsi
+  804ac5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aca:	49 89 df             	mov    %rbx,%r15
+  804acd:	48 b8 7a 90 ff ff ff 	movabs $0xffffffffffff907a,%rax
+  804ad4:	ff ff ff 
+  804ad7:	48 01 d8             	add    %rbx,%rax
+  804ada:	ff d0                	call   *%rax
+  804adc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804adf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ae3:	74 23                	je     804b08 <open+0x107>
+		fd_close(fd,0);
+  804ae5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ae9:	be 00 00 00 00       	mov    $0x0,%esi
+  804aee:	48 89 c7             	mov    %rax,%rdi
+  804af1:	49 89 df             	mov    %rbx,%r15
+  804af4:	48 b8 56 ad ff ff ff 	movabs $0xffffffffffffad56,%rax
+  804afb:	ff ff ff 
+  804afe:	48 01 d8             	add    %rbx,%rax
+  804b01:	ff d0                	call   *%rax
+		return r;
+  804b03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b06:	eb 61                	jmp    804b69 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804b08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b0c:	48 89 c6             	mov    %rax,%rsi
+  804b0f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804b14:	48 b8 7a b7 ff ff ff 	movabs $0xffffffffffffb77a,%rax
+  804b1b:	ff ff ff 
+  804b1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b22:	ff d0                	call   *%rax
+  804b24:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b27:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b2b:	74 23                	je     804b50 <open+0x14f>
+		fd_close(fd,0);
+  804b2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b31:	be 00 00 00 00       	mov    $0x0,%esi
+  804b36:	48 89 c7             	mov    %rax,%rdi
+  804b39:	49 89 df             	mov    %rbx,%r15
+  804b3c:	48 b8 56 ad ff ff ff 	movabs $0xffffffffffffad56,%rax
+  804b43:	ff ff ff 
+  804b46:	48 01 d8             	add    %rbx,%rax
+  804b49:	ff d0                	call   *%rax
+		return r;
+  804b4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b4e:	eb 19                	jmp    804b69 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804b50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b54:	48 89 c7             	mov    %rax,%rdi
+  804b57:	49 89 df             	mov    %rbx,%r15
+  804b5a:	48 b8 7b ab ff ff ff 	movabs $0xffffffffffffab7b,%rax
+  804b61:	ff ff ff 
+  804b64:	48 01 d8             	add    %rbx,%rax
+  804b67:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804b69:	48 83 c4 20          	add    $0x20,%rsp
+  804b6d:	5b                   	pop    %rbx
+  804b6e:	41 5f                	pop    %r15
+  804b70:	5d                   	pop    %rbp
+  804b71:	c3                   	ret
+
+0000000000804b72 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804b72:	55                   	push   %rbp
+  804b73:	48 89 e5             	mov    %rsp,%rbp
+  804b76:	48 83 ec 20          	sub    $0x20,%rsp
+  804b7a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804b7a <devfile_flush+0x8>
+  804b81:	49 bb c6 44 00 00 00 	movabs $0x44c6,%r11
+  804b88:	00 00 00 
+  804b8b:	4c 01 d8             	add    %r11,%rax
+  804b8e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804b92:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804b96:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804b99:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804b9c:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804ba0:	ba 04 00 00 00       	mov    $0x4,%edx
+  804ba5:	48 89 ce             	mov    %rcx,%rsi
+  804ba8:	bf 06 00 00 00       	mov    $0x6,%edi
+  804bad:	48 b9 22 b8 ff ff ff 	movabs $0xffffffffffffb822,%rcx
+  804bb4:	ff ff ff 
+  804bb7:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804bbb:	ff d0                	call   *%rax
+}
+  804bbd:	c9                   	leave
+  804bbe:	c3                   	ret
+
+0000000000804bbf <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804bbf:	55                   	push   %rbp
+  804bc0:	48 89 e5             	mov    %rsp,%rbp
+  804bc3:	41 57                	push   %r15
+  804bc5:	53                   	push   %rbx
+  804bc6:	48 83 ec 60          	sub    $0x60,%rsp
+  804bca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804bca <devfile_read+0xb>
+  804bd1:	49 bb 76 44 00 00 00 	movabs $0x4476,%r11
+  804bd8:	00 00 00 
+  804bdb:	4c 01 db             	add    %r11,%rbx
+  804bde:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804be2:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804be6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804bea:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804bee:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804bf2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804bf6:	8b 50 0c             	mov    0xc(%rax),%edx
+  804bf9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bfd:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804bff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c03:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804c07:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804c0b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804c0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804c14:	ba 10 00 00 00       	mov    $0x10,%edx
+  804c19:	48 89 c6             	mov    %rax,%rsi
+  804c1c:	bf 03 00 00 00       	mov    $0x3,%edi
+  804c21:	48 b8 b6 b8 ff ff ff 	movabs $0xffffffffffffb8b6,%rax
+  804c28:	ff ff ff 
+  804c2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c2f:	ff d0                	call   *%rax
+  804c31:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804c34:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804c38:	79 05                	jns    804c3f <devfile_read+0x80>
+		return r;
+  804c3a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c3d:	eb 64                	jmp    804ca3 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804c3f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c42:	48 63 d0             	movslq %eax,%rdx
+  804c45:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c49:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804c4e:	48 01 c1             	add    %rax,%rcx
+  804c51:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804c55:	48 89 ce             	mov    %rcx,%rsi
+  804c58:	48 89 c7             	mov    %rax,%rdi
+  804c5b:	49 89 df             	mov    %rbx,%r15
+  804c5e:	48 b8 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rax
+  804c65:	ff ff ff 
+  804c68:	48 01 d8             	add    %rbx,%rax
+  804c6b:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804c6d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804c74:	ff ff ff 
+  804c77:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804c7b:	48 8b 00             	mov    (%rax),%rax
+  804c7e:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804c84:	89 c6                	mov    %eax,%esi
+  804c86:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804c8b:	48 89 c7             	mov    %rax,%rdi
+  804c8e:	49 89 df             	mov    %rbx,%r15
+  804c91:	48 b8 a6 aa ff ff ff 	movabs $0xffffffffffffaaa6,%rax
+  804c98:	ff ff ff 
+  804c9b:	48 01 d8             	add    %rbx,%rax
+  804c9e:	ff d0                	call   *%rax
+	return r;
+  804ca0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804ca3:	48 83 c4 60          	add    $0x60,%rsp
+  804ca7:	5b                   	pop    %rbx
+  804ca8:	41 5f                	pop    %r15
+  804caa:	5d                   	pop    %rbp
+  804cab:	c3                   	ret
+
+0000000000804cac <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804cac:	55                   	push   %rbp
+  804cad:	48 89 e5             	mov    %rsp,%rbp
+  804cb0:	41 57                	push   %r15
+  804cb2:	53                   	push   %rbx
+  804cb3:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804cb7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cb7 <devfile_write+0xb>
+  804cbe:	49 bb 89 43 00 00 00 	movabs $0x4389,%r11
+  804cc5:	00 00 00 
+  804cc8:	4c 01 db             	add    %r11,%rbx
+  804ccb:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804ccf:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804cd3:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804cda:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804cde:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804ce2:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804ce9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804ced:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804cf4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804cf7:	48 63 d0             	movslq %eax,%rdx
+  804cfa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cfe:	48 39 c2             	cmp    %rax,%rdx
+  804d01:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804d05:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804d0c:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804d13:	00 
+  804d14:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804d1b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d1f:	48 01 d0             	add    %rdx,%rax
+  804d22:	48 83 e8 01          	sub    $0x1,%rax
+  804d26:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804d2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d33:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804d37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d3b:	48 29 d0             	sub    %rdx,%rax
+  804d3e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804d42:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804d45:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804d48:	89 c6                	mov    %eax,%esi
+  804d4a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804d4f:	48 89 c7             	mov    %rax,%rdi
+  804d52:	49 89 df             	mov    %rbx,%r15
+  804d55:	48 b8 60 aa ff ff ff 	movabs $0xffffffffffffaa60,%rax
+  804d5c:	ff ff ff 
+  804d5f:	48 01 d8             	add    %rbx,%rax
+  804d62:	ff d0                	call   *%rax
+  804d64:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804d67:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804d6b:	79 08                	jns    804d75 <devfile_write+0xc9>
+		return r;
+  804d6d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804d70:	e9 8f 00 00 00       	jmp    804e04 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804d75:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804d7c:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804d80:	48 89 c6             	mov    %rax,%rsi
+  804d83:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804d88:	48 89 c7             	mov    %rax,%rdi
+  804d8b:	49 89 df             	mov    %rbx,%r15
+  804d8e:	48 b8 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rax
+  804d95:	ff ff ff 
+  804d98:	48 01 d8             	add    %rbx,%rax
+  804d9b:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804d9d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804da1:	8b 50 0c             	mov    0xc(%rax),%edx
+  804da4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804da8:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804daa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804dae:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804db5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804db9:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804dbc:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804dc0:	89 d1                	mov    %edx,%ecx
+  804dc2:	ba 10 00 00 00       	mov    $0x10,%edx
+  804dc7:	48 89 c6             	mov    %rax,%rsi
+  804dca:	bf 04 00 00 00       	mov    $0x4,%edi
+  804dcf:	48 b8 b6 b8 ff ff ff 	movabs $0xffffffffffffb8b6,%rax
+  804dd6:	ff ff ff 
+  804dd9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ddd:	ff d0                	call   *%rax
+  804ddf:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804de2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804de5:	89 c6                	mov    %eax,%esi
+  804de7:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804dec:	48 89 c7             	mov    %rax,%rdi
+  804def:	49 89 df             	mov    %rbx,%r15
+  804df2:	48 b8 a6 aa ff ff ff 	movabs $0xffffffffffffaaa6,%rax
+  804df9:	ff ff ff 
+  804dfc:	48 01 d8             	add    %rbx,%rax
+  804dff:	ff d0                	call   *%rax
+	return r;
+  804e01:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804e04:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804e08:	5b                   	pop    %rbx
+  804e09:	41 5f                	pop    %r15
+  804e0b:	5d                   	pop    %rbp
+  804e0c:	c3                   	ret
+
+0000000000804e0d <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804e0d:	55                   	push   %rbp
+  804e0e:	48 89 e5             	mov    %rsp,%rbp
+  804e11:	41 57                	push   %r15
+  804e13:	53                   	push   %rbx
+  804e14:	48 83 ec 20          	sub    $0x20,%rsp
+  804e18:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e18 <devfile_stat+0xb>
+  804e1f:	49 bb 28 42 00 00 00 	movabs $0x4228,%r11
+  804e26:	00 00 00 
+  804e29:	4c 01 db             	add    %r11,%rbx
+  804e2c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804e30:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804e34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e38:	8b 40 0c             	mov    0xc(%rax),%eax
+  804e3b:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804e42:	00 00 00 
+  804e45:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804e48:	be 00 00 00 00       	mov    $0x0,%esi
+  804e4d:	bf 05 00 00 00       	mov    $0x5,%edi
+  804e52:	48 b8 7a b7 ff ff ff 	movabs $0xffffffffffffb77a,%rax
+  804e59:	ff ff ff 
+  804e5c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e60:	ff d0                	call   *%rax
+  804e62:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e65:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e69:	79 05                	jns    804e70 <devfile_stat+0x63>
+		return r;
+  804e6b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e6e:	eb 65                	jmp    804ed5 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804e70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e74:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804e7b:	00 00 00 
+  804e7e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804e82:	48 89 d6             	mov    %rdx,%rsi
+  804e85:	48 89 c7             	mov    %rax,%rdi
+  804e88:	49 89 df             	mov    %rbx,%r15
+  804e8b:	48 b8 be 83 ff ff ff 	movabs $0xffffffffffff83be,%rax
+  804e92:	ff ff ff 
+  804e95:	48 01 d8             	add    %rbx,%rax
+  804e98:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804e9a:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804ea1:	00 00 00 
+  804ea4:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804eab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804eaf:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804eb5:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804ebc:	00 00 00 
+  804ebf:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804ec6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804eca:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ed5:	48 83 c4 20          	add    $0x20,%rsp
+  804ed9:	5b                   	pop    %rbx
+  804eda:	41 5f                	pop    %r15
+  804edc:	5d                   	pop    %rbp
+  804edd:	c3                   	ret
+
+0000000000804ede <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804ede:	55                   	push   %rbp
+  804edf:	48 89 e5             	mov    %rsp,%rbp
+  804ee2:	48 83 ec 20          	sub    $0x20,%rsp
+  804ee6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804ee6 <devfile_trunc+0x8>
+  804eed:	49 bb 5a 41 00 00 00 	movabs $0x415a,%r11
+  804ef4:	00 00 00 
+  804ef7:	4c 01 d8             	add    %r11,%rax
+  804efa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804efe:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804f01:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f05:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804f08:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804f0b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804f0e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804f11:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804f15:	ba 08 00 00 00       	mov    $0x8,%edx
+  804f1a:	48 89 ce             	mov    %rcx,%rsi
+  804f1d:	bf 02 00 00 00       	mov    $0x2,%edi
+  804f22:	48 b9 22 b8 ff ff ff 	movabs $0xffffffffffffb822,%rcx
+  804f29:	ff ff ff 
+  804f2c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804f30:	ff d0                	call   *%rax
+}
+  804f32:	c9                   	leave
+  804f33:	c3                   	ret
+
+0000000000804f34 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  804f34:	55                   	push   %rbp
+  804f35:	48 89 e5             	mov    %rsp,%rbp
+  804f38:	41 57                	push   %r15
+  804f3a:	53                   	push   %rbx
+  804f3b:	48 83 ec 10          	sub    $0x10,%rsp
+  804f3f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f3f <remove+0xb>
+  804f46:	49 bb 01 41 00 00 00 	movabs $0x4101,%r11
+  804f4d:	00 00 00 
+  804f50:	4c 01 db             	add    %r11,%rbx
+  804f53:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  804f57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5b:	48 89 c7             	mov    %rax,%rdi
+  804f5e:	49 89 df             	mov    %rbx,%r15
+  804f61:	48 b8 2a 83 ff ff ff 	movabs $0xffffffffffff832a,%rax
+  804f68:	ff ff ff 
+  804f6b:	48 01 d8             	add    %rbx,%rax
+  804f6e:	ff d0                	call   *%rax
+  804f70:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804f75:	7e 07                	jle    804f7e <remove+0x4a>
+		return -E_BAD_PATH;
+  804f77:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804f7c:	eb 44                	jmp    804fc2 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804f7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f82:	48 89 c6             	mov    %rax,%rsi
+  804f85:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804f8c:	00 00 00 
+  804f8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f93:	48 89 c7             	mov    %rax,%rdi
+  804f96:	49 89 df             	mov    %rbx,%r15
+  804f99:	48 b8 be 83 ff ff ff 	movabs $0xffffffffffff83be,%rax
+  804fa0:	ff ff ff 
+  804fa3:	48 01 d8             	add    %rbx,%rax
+  804fa6:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804fa8:	be 00 00 00 00       	mov    $0x0,%esi
+  804fad:	bf 07 00 00 00       	mov    $0x7,%edi
+  804fb2:	48 b8 7a b7 ff ff ff 	movabs $0xffffffffffffb77a,%rax
+  804fb9:	ff ff ff 
+  804fbc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fc0:	ff d0                	call   *%rax
+}
+  804fc2:	48 83 c4 10          	add    $0x10,%rsp
+  804fc6:	5b                   	pop    %rbx
+  804fc7:	41 5f                	pop    %r15
+  804fc9:	5d                   	pop    %rbp
+  804fca:	c3                   	ret
+
+0000000000804fcb <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804fcb:	55                   	push   %rbp
+  804fcc:	48 89 e5             	mov    %rsp,%rbp
+  804fcf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804fcf <sync+0x4>
+  804fd6:	49 bb 71 40 00 00 00 	movabs $0x4071,%r11
+  804fdd:	00 00 00 
+  804fe0:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fe8:	be 00 00 00 00       	mov    $0x0,%esi
+  804fed:	bf 08 00 00 00       	mov    $0x8,%edi
+  804ff2:	48 b9 22 b8 ff ff ff 	movabs $0xffffffffffffb822,%rcx
+  804ff9:	ff ff ff 
+  804ffc:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805000:	ff d0                	call   *%rax
+}
+  805002:	5d                   	pop    %rbp
+  805003:	c3                   	ret
+
+0000000000805004 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  805004:	55                   	push   %rbp
+  805005:	48 89 e5             	mov    %rsp,%rbp
+  805008:	41 57                	push   %r15
+  80500a:	53                   	push   %rbx
+  80500b:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  805012:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805012 <copy+0xe>
+  805019:	49 bb 2e 40 00 00 00 	movabs $0x402e,%r11
+  805020:	00 00 00 
+  805023:	4c 01 db             	add    %r11,%rbx
+  805026:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  80502d:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  805034:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  80503b:	be 00 00 00 00       	mov    $0x0,%esi
+  805040:	48 89 c7             	mov    %rax,%rdi
+  805043:	48 b8 c1 b9 ff ff ff 	movabs $0xffffffffffffb9c1,%rax
+  80504a:	ff ff ff 
+  80504d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805051:	ff d0                	call   *%rax
+  805053:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  805056:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80505a:	79 35                	jns    805091 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  80505c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80505f:	89 c6                	mov    %eax,%esi
+  805061:	48 b8 ce e2 ff ff ff 	movabs $0xffffffffffffe2ce,%rax
+  805068:	ff ff ff 
+  80506b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80506f:	48 89 c7             	mov    %rax,%rdi
+  805072:	49 89 df             	mov    %rbx,%r15
+  805075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80507a:	48 ba fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%rdx
+  805081:	ff ff ff 
+  805084:	48 01 da             	add    %rbx,%rdx
+  805087:	ff d2                	call   *%rdx
+		return fd_src;
+  805089:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80508c:	e9 d7 01 00 00       	jmp    805268 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  805091:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  805098:	be 01 01 00 00       	mov    $0x101,%esi
+  80509d:	48 89 c7             	mov    %rax,%rdi
+  8050a0:	48 b8 c1 b9 ff ff ff 	movabs $0xffffffffffffb9c1,%rax
+  8050a7:	ff ff ff 
+  8050aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050ae:	ff d0                	call   *%rax
+  8050b0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  8050b3:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8050b7:	0f 89 df 00 00 00    	jns    80519c <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  8050bd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8050c0:	89 c6                	mov    %eax,%esi
+  8050c2:	48 b8 e4 e2 ff ff ff 	movabs $0xffffffffffffe2e4,%rax
+  8050c9:	ff ff ff 
+  8050cc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050d0:	48 89 c7             	mov    %rax,%rdi
+  8050d3:	49 89 df             	mov    %rbx,%r15
+  8050d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050db:	48 ba fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%rdx
+  8050e2:	ff ff ff 
+  8050e5:	48 01 da             	add    %rbx,%rdx
+  8050e8:	ff d2                	call   *%rdx
+		close(fd_src);
+  8050ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050ed:	89 c7                	mov    %eax,%edi
+  8050ef:	49 89 df             	mov    %rbx,%r15
+  8050f2:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  8050f9:	ff ff ff 
+  8050fc:	48 01 d8             	add    %rbx,%rax
+  8050ff:	ff d0                	call   *%rax
+		return fd_dest;
+  805101:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805104:	e9 5f 01 00 00       	jmp    805268 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  805109:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80510c:	48 63 d0             	movslq %eax,%rdx
+  80510f:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805116:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805119:	48 89 ce             	mov    %rcx,%rsi
+  80511c:	89 c7                	mov    %eax,%edi
+  80511e:	49 89 df             	mov    %rbx,%r15
+  805121:	48 b8 98 b3 ff ff ff 	movabs $0xffffffffffffb398,%rax
+  805128:	ff ff ff 
+  80512b:	48 01 d8             	add    %rbx,%rax
+  80512e:	ff d0                	call   *%rax
+  805130:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  805133:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805137:	79 63                	jns    80519c <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  805139:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80513c:	89 c6                	mov    %eax,%esi
+  80513e:	48 b8 fe e2 ff ff ff 	movabs $0xffffffffffffe2fe,%rax
+  805145:	ff ff ff 
+  805148:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80514c:	48 89 c7             	mov    %rax,%rdi
+  80514f:	49 89 df             	mov    %rbx,%r15
+  805152:	b8 00 00 00 00       	mov    $0x0,%eax
+  805157:	48 ba fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%rdx
+  80515e:	ff ff ff 
+  805161:	48 01 da             	add    %rbx,%rdx
+  805164:	ff d2                	call   *%rdx
+			close(fd_src);
+  805166:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805169:	89 c7                	mov    %eax,%edi
+  80516b:	49 89 df             	mov    %rbx,%r15
+  80516e:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  805175:	ff ff ff 
+  805178:	48 01 d8             	add    %rbx,%rax
+  80517b:	ff d0                	call   *%rax
+			close(fd_dest);
+  80517d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805180:	89 c7                	mov    %eax,%edi
+  805182:	49 89 df             	mov    %rbx,%r15
+  805185:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  80518c:	ff ff ff 
+  80518f:	48 01 d8             	add    %rbx,%rax
+  805192:	ff d0                	call   *%rax
+			return write_size;
+  805194:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805197:	e9 cc 00 00 00       	jmp    805268 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  80519c:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8051a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051a6:	ba 00 02 00 00       	mov    $0x200,%edx
+  8051ab:	48 89 ce             	mov    %rcx,%rsi
+  8051ae:	89 c7                	mov    %eax,%edi
+  8051b0:	49 89 df             	mov    %rbx,%r15
+  8051b3:	48 b8 f2 b1 ff ff ff 	movabs $0xffffffffffffb1f2,%rax
+  8051ba:	ff ff ff 
+  8051bd:	48 01 d8             	add    %rbx,%rax
+  8051c0:	ff d0                	call   *%rax
+  8051c2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8051c5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8051c9:	0f 8f 3a ff ff ff    	jg     805109 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  8051cf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8051d3:	79 60                	jns    805235 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  8051d5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8051d8:	89 c6                	mov    %eax,%esi
+  8051da:	48 b8 11 e3 ff ff ff 	movabs $0xffffffffffffe311,%rax
+  8051e1:	ff ff ff 
+  8051e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051e8:	48 89 c7             	mov    %rax,%rdi
+  8051eb:	49 89 df             	mov    %rbx,%r15
+  8051ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f3:	48 ba fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%rdx
+  8051fa:	ff ff ff 
+  8051fd:	48 01 da             	add    %rbx,%rdx
+  805200:	ff d2                	call   *%rdx
+		close(fd_src);
+  805202:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805205:	89 c7                	mov    %eax,%edi
+  805207:	49 89 df             	mov    %rbx,%r15
+  80520a:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  805211:	ff ff ff 
+  805214:	48 01 d8             	add    %rbx,%rax
+  805217:	ff d0                	call   *%rax
+		close(fd_dest);
+  805219:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80521c:	89 c7                	mov    %eax,%edi
+  80521e:	49 89 df             	mov    %rbx,%r15
+  805221:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  805228:	ff ff ff 
+  80522b:	48 01 d8             	add    %rbx,%rax
+  80522e:	ff d0                	call   *%rax
+		return read_size;
+  805230:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805233:	eb 33                	jmp    805268 <copy+0x264>
+	}
+	close(fd_src);
+  805235:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805238:	89 c7                	mov    %eax,%edi
+  80523a:	49 89 df             	mov    %rbx,%r15
+  80523d:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  805244:	ff ff ff 
+  805247:	48 01 d8             	add    %rbx,%rax
+  80524a:	ff d0                	call   *%rax
+	close(fd_dest);
+  80524c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80524f:	89 c7                	mov    %eax,%edi
+  805251:	49 89 df             	mov    %rbx,%r15
+  805254:	48 b8 3a af ff ff ff 	movabs $0xffffffffffffaf3a,%rax
+  80525b:	ff ff ff 
+  80525e:	48 01 d8             	add    %rbx,%rax
+  805261:	ff d0                	call   *%rax
+	return 0;
+  805263:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  805268:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  80526f:	5b                   	pop    %rbx
+  805270:	41 5f                	pop    %r15
+  805272:	5d                   	pop    %rbp
+  805273:	c3                   	ret
+
+0000000000805274 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805274:	55                   	push   %rbp
+  805275:	48 89 e5             	mov    %rsp,%rbp
+  805278:	41 57                	push   %r15
+  80527a:	53                   	push   %rbx
+  80527b:	48 83 ec 20          	sub    $0x20,%rsp
+  80527f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80527f <fd2sockid+0xb>
+  805286:	49 bb c1 3d 00 00 00 	movabs $0x3dc1,%r11
+  80528d:	00 00 00 
+  805290:	4c 01 db             	add    %r11,%rbx
+  805293:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805296:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80529a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80529d:	48 89 d6             	mov    %rdx,%rsi
+  8052a0:	89 c7                	mov    %eax,%edi
+  8052a2:	49 89 df             	mov    %rbx,%r15
+  8052a5:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  8052ac:	ff ff ff 
+  8052af:	48 01 d8             	add    %rbx,%rax
+  8052b2:	ff d0                	call   *%rax
+  8052b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052bb:	79 05                	jns    8052c2 <fd2sockid+0x4e>
+		return r;
+  8052bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052c0:	eb 25                	jmp    8052e7 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8052c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052c6:	8b 10                	mov    (%rax),%edx
+  8052c8:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  8052cf:	00 00 00 
+  8052d2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8052d5:	39 c2                	cmp    %eax,%edx
+  8052d7:	74 07                	je     8052e0 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8052d9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8052de:	eb 07                	jmp    8052e7 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8052e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052e4:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8052e7:	48 83 c4 20          	add    $0x20,%rsp
+  8052eb:	5b                   	pop    %rbx
+  8052ec:	41 5f                	pop    %r15
+  8052ee:	5d                   	pop    %rbp
+  8052ef:	c3                   	ret
+
+00000000008052f0 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8052f0:	55                   	push   %rbp
+  8052f1:	48 89 e5             	mov    %rsp,%rbp
+  8052f4:	41 57                	push   %r15
+  8052f6:	53                   	push   %rbx
+  8052f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8052fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052fb <alloc_sockfd+0xb>
+  805302:	49 bb 45 3d 00 00 00 	movabs $0x3d45,%r11
+  805309:	00 00 00 
+  80530c:	4c 01 db             	add    %r11,%rbx
+  80530f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  805312:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805316:	48 89 c7             	mov    %rax,%rdi
+  805319:	49 89 df             	mov    %rbx,%r15
+  80531c:	48 b8 f5 ab ff ff ff 	movabs $0xffffffffffffabf5,%rax
+  805323:	ff ff ff 
+  805326:	48 01 d8             	add    %rbx,%rax
+  805329:	ff d0                	call   *%rax
+  80532b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80532e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805332:	78 2c                	js     805360 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  805334:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805338:	ba 07 04 00 00       	mov    $0x407,%edx
+  80533d:	48 89 c6             	mov    %rax,%rsi
+  805340:	bf 00 00 00 00       	mov    $0x0,%edi
+  805345:	49 89 df             	mov    %rbx,%r15
+  805348:	48 b8 7a 90 ff ff ff 	movabs $0xffffffffffff907a,%rax
+  80534f:	ff ff ff 
+  805352:	48 01 d8             	add    %rbx,%rax
+  805355:	ff d0                	call   *%rax
+  805357:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80535a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80535e:	79 1c                	jns    80537c <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805360:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805363:	89 c7                	mov    %eax,%edi
+  805365:	49 89 df             	mov    %rbx,%r15
+  805368:	48 b8 a4 ca ff ff ff 	movabs $0xffffffffffffcaa4,%rax
+  80536f:	ff ff ff 
+  805372:	48 01 d8             	add    %rbx,%rax
+  805375:	ff d0                	call   *%rax
+		return r;
+  805377:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80537a:	eb 41                	jmp    8053bd <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80537c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805380:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  805387:	00 00 00 
+  80538a:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80538d:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  80538f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805393:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80539a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80539e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8053a1:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8053a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053a8:	48 89 c7             	mov    %rax,%rdi
+  8053ab:	49 89 df             	mov    %rbx,%r15
+  8053ae:	48 b8 7b ab ff ff ff 	movabs $0xffffffffffffab7b,%rax
+  8053b5:	ff ff ff 
+  8053b8:	48 01 d8             	add    %rbx,%rax
+  8053bb:	ff d0                	call   *%rax
+}
+  8053bd:	48 83 c4 20          	add    $0x20,%rsp
+  8053c1:	5b                   	pop    %rbx
+  8053c2:	41 5f                	pop    %r15
+  8053c4:	5d                   	pop    %rbp
+  8053c5:	c3                   	ret
+
+00000000008053c6 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8053c6:	55                   	push   %rbp
+  8053c7:	48 89 e5             	mov    %rsp,%rbp
+  8053ca:	41 57                	push   %r15
+  8053cc:	53                   	push   %rbx
+  8053cd:	48 83 ec 30          	sub    $0x30,%rsp
+  8053d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053d1 <accept+0xb>
+  8053d8:	49 bb 6f 3c 00 00 00 	movabs $0x3c6f,%r11
+  8053df:	00 00 00 
+  8053e2:	4c 01 db             	add    %r11,%rbx
+  8053e5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8053e8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8053ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8053f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8053f3:	89 c7                	mov    %eax,%edi
+  8053f5:	48 b8 34 c2 ff ff ff 	movabs $0xffffffffffffc234,%rax
+  8053fc:	ff ff ff 
+  8053ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805403:	ff d0                	call   *%rax
+  805405:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805408:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80540c:	79 05                	jns    805413 <accept+0x4d>
+		return r;
+  80540e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805411:	eb 45                	jmp    805458 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  805413:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805417:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80541b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80541e:	48 89 ce             	mov    %rcx,%rsi
+  805421:	89 c7                	mov    %eax,%edi
+  805423:	49 89 df             	mov    %rbx,%r15
+  805426:	48 b8 12 c9 ff ff ff 	movabs $0xffffffffffffc912,%rax
+  80542d:	ff ff ff 
+  805430:	48 01 d8             	add    %rbx,%rax
+  805433:	ff d0                	call   *%rax
+  805435:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805438:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80543c:	79 05                	jns    805443 <accept+0x7d>
+		return r;
+  80543e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805441:	eb 15                	jmp    805458 <accept+0x92>
+	return alloc_sockfd(r);
+  805443:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805446:	89 c7                	mov    %eax,%edi
+  805448:	48 b8 b0 c2 ff ff ff 	movabs $0xffffffffffffc2b0,%rax
+  80544f:	ff ff ff 
+  805452:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805456:	ff d0                	call   *%rax
+}
+  805458:	48 83 c4 30          	add    $0x30,%rsp
+  80545c:	5b                   	pop    %rbx
+  80545d:	41 5f                	pop    %r15
+  80545f:	5d                   	pop    %rbp
+  805460:	c3                   	ret
+
+0000000000805461 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805461:	55                   	push   %rbp
+  805462:	48 89 e5             	mov    %rsp,%rbp
+  805465:	41 57                	push   %r15
+  805467:	53                   	push   %rbx
+  805468:	48 83 ec 20          	sub    $0x20,%rsp
+  80546c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80546c <bind+0xb>
+  805473:	49 bb d4 3b 00 00 00 	movabs $0x3bd4,%r11
+  80547a:	00 00 00 
+  80547d:	4c 01 db             	add    %r11,%rbx
+  805480:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805483:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805487:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80548a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80548d:	89 c7                	mov    %eax,%edi
+  80548f:	48 b8 34 c2 ff ff ff 	movabs $0xffffffffffffc234,%rax
+  805496:	ff ff ff 
+  805499:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80549d:	ff d0                	call   *%rax
+  80549f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054a6:	79 05                	jns    8054ad <bind+0x4c>
+		return r;
+  8054a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054ab:	eb 21                	jmp    8054ce <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  8054ad:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8054b0:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8054b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054b7:	48 89 ce             	mov    %rcx,%rsi
+  8054ba:	89 c7                	mov    %eax,%edi
+  8054bc:	49 89 df             	mov    %rbx,%r15
+  8054bf:	48 b8 be c9 ff ff ff 	movabs $0xffffffffffffc9be,%rax
+  8054c6:	ff ff ff 
+  8054c9:	48 01 d8             	add    %rbx,%rax
+  8054cc:	ff d0                	call   *%rax
+}
+  8054ce:	48 83 c4 20          	add    $0x20,%rsp
+  8054d2:	5b                   	pop    %rbx
+  8054d3:	41 5f                	pop    %r15
+  8054d5:	5d                   	pop    %rbp
+  8054d6:	c3                   	ret
+
+00000000008054d7 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8054d7:	55                   	push   %rbp
+  8054d8:	48 89 e5             	mov    %rsp,%rbp
+  8054db:	41 57                	push   %r15
+  8054dd:	53                   	push   %rbx
+  8054de:	48 83 ec 20          	sub    $0x20,%rsp
+  8054e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054e2 <shutdown+0xb>
+  8054e9:	49 bb 5e 3b 00 00 00 	movabs $0x3b5e,%r11
+  8054f0:	00 00 00 
+  8054f3:	4c 01 db             	add    %r11,%rbx
+  8054f6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8054f9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8054fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054ff:	89 c7                	mov    %eax,%edi
+  805501:	48 b8 34 c2 ff ff ff 	movabs $0xffffffffffffc234,%rax
+  805508:	ff ff ff 
+  80550b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80550f:	ff d0                	call   *%rax
+  805511:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805514:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805518:	79 05                	jns    80551f <shutdown+0x48>
+		return r;
+  80551a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80551d:	eb 1c                	jmp    80553b <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  80551f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805522:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805525:	89 d6                	mov    %edx,%esi
+  805527:	89 c7                	mov    %eax,%edi
+  805529:	49 89 df             	mov    %rbx,%r15
+  80552c:	48 b8 53 ca ff ff ff 	movabs $0xffffffffffffca53,%rax
+  805533:	ff ff ff 
+  805536:	48 01 d8             	add    %rbx,%rax
+  805539:	ff d0                	call   *%rax
+}
+  80553b:	48 83 c4 20          	add    $0x20,%rsp
+  80553f:	5b                   	pop    %rbx
+  805540:	41 5f                	pop    %r15
+  805542:	5d                   	pop    %rbp
+  805543:	c3                   	ret
+
+0000000000805544 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805544:	55                   	push   %rbp
+  805545:	48 89 e5             	mov    %rsp,%rbp
+  805548:	41 57                	push   %r15
+  80554a:	53                   	push   %rbx
+  80554b:	48 83 ec 10          	sub    $0x10,%rsp
+  80554f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80554f <devsock_close+0xb>
+  805556:	49 bb f1 3a 00 00 00 	movabs $0x3af1,%r11
+  80555d:	00 00 00 
+  805560:	4c 01 db             	add    %r11,%rbx
+  805563:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805567:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80556b:	48 89 c7             	mov    %rax,%rdi
+  80556e:	49 89 df             	mov    %rbx,%r15
+  805571:	48 b8 06 dc ff ff ff 	movabs $0xffffffffffffdc06,%rax
+  805578:	ff ff ff 
+  80557b:	48 01 d8             	add    %rbx,%rax
+  80557e:	ff d0                	call   *%rax
+  805580:	83 f8 01             	cmp    $0x1,%eax
+  805583:	75 1d                	jne    8055a2 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805585:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805589:	8b 40 0c             	mov    0xc(%rax),%eax
+  80558c:	89 c7                	mov    %eax,%edi
+  80558e:	49 89 df             	mov    %rbx,%r15
+  805591:	48 b8 a4 ca ff ff ff 	movabs $0xffffffffffffcaa4,%rax
+  805598:	ff ff ff 
+  80559b:	48 01 d8             	add    %rbx,%rax
+  80559e:	ff d0                	call   *%rax
+  8055a0:	eb 05                	jmp    8055a7 <devsock_close+0x63>
+	else
+		return 0;
+  8055a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055a7:	48 83 c4 10          	add    $0x10,%rsp
+  8055ab:	5b                   	pop    %rbx
+  8055ac:	41 5f                	pop    %r15
+  8055ae:	5d                   	pop    %rbp
+  8055af:	c3                   	ret
+
+00000000008055b0 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8055b0:	55                   	push   %rbp
+  8055b1:	48 89 e5             	mov    %rsp,%rbp
+  8055b4:	41 57                	push   %r15
+  8055b6:	53                   	push   %rbx
+  8055b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8055bb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055bb <connect+0xb>
+  8055c2:	49 bb 85 3a 00 00 00 	movabs $0x3a85,%r11
+  8055c9:	00 00 00 
+  8055cc:	4c 01 db             	add    %r11,%rbx
+  8055cf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8055d2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8055d6:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8055d9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8055dc:	89 c7                	mov    %eax,%edi
+  8055de:	48 b8 34 c2 ff ff ff 	movabs $0xffffffffffffc234,%rax
+  8055e5:	ff ff ff 
+  8055e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055ec:	ff d0                	call   *%rax
+  8055ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055f5:	79 05                	jns    8055fc <connect+0x4c>
+		return r;
+  8055f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055fa:	eb 21                	jmp    80561d <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8055fc:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8055ff:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805603:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805606:	48 89 ce             	mov    %rcx,%rsi
+  805609:	89 c7                	mov    %eax,%edi
+  80560b:	49 89 df             	mov    %rbx,%r15
+  80560e:	48 b8 ec ca ff ff ff 	movabs $0xffffffffffffcaec,%rax
+  805615:	ff ff ff 
+  805618:	48 01 d8             	add    %rbx,%rax
+  80561b:	ff d0                	call   *%rax
+}
+  80561d:	48 83 c4 20          	add    $0x20,%rsp
+  805621:	5b                   	pop    %rbx
+  805622:	41 5f                	pop    %r15
+  805624:	5d                   	pop    %rbp
+  805625:	c3                   	ret
+
+0000000000805626 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  805626:	55                   	push   %rbp
+  805627:	48 89 e5             	mov    %rsp,%rbp
+  80562a:	41 57                	push   %r15
+  80562c:	53                   	push   %rbx
+  80562d:	48 83 ec 20          	sub    $0x20,%rsp
+  805631:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805631 <listen+0xb>
+  805638:	49 bb 0f 3a 00 00 00 	movabs $0x3a0f,%r11
+  80563f:	00 00 00 
+  805642:	4c 01 db             	add    %r11,%rbx
+  805645:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805648:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80564b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80564e:	89 c7                	mov    %eax,%edi
+  805650:	48 b8 34 c2 ff ff ff 	movabs $0xffffffffffffc234,%rax
+  805657:	ff ff ff 
+  80565a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80565e:	ff d0                	call   *%rax
+  805660:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805663:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805667:	79 05                	jns    80566e <listen+0x48>
+		return r;
+  805669:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80566c:	eb 1c                	jmp    80568a <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80566e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805671:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805674:	89 d6                	mov    %edx,%esi
+  805676:	89 c7                	mov    %eax,%edi
+  805678:	49 89 df             	mov    %rbx,%r15
+  80567b:	48 b8 81 cb ff ff ff 	movabs $0xffffffffffffcb81,%rax
+  805682:	ff ff ff 
+  805685:	48 01 d8             	add    %rbx,%rax
+  805688:	ff d0                	call   *%rax
+}
+  80568a:	48 83 c4 20          	add    $0x20,%rsp
+  80568e:	5b                   	pop    %rbx
+  80568f:	41 5f                	pop    %r15
+  805691:	5d                   	pop    %rbp
+  805692:	c3                   	ret
+
+0000000000805693 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805693:	55                   	push   %rbp
+  805694:	48 89 e5             	mov    %rsp,%rbp
+  805697:	41 57                	push   %r15
+  805699:	48 83 ec 28          	sub    $0x28,%rsp
+  80569d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80569d <devsock_read+0xa>
+  8056a4:	49 bb a3 39 00 00 00 	movabs $0x39a3,%r11
+  8056ab:	00 00 00 
+  8056ae:	4c 01 d8             	add    %r11,%rax
+  8056b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8056b5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8056b9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8056bd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8056c1:	41 89 d0             	mov    %edx,%r8d
+  8056c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8056c8:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8056cb:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8056cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8056d4:	44 89 c2             	mov    %r8d,%edx
+  8056d7:	49 89 c7             	mov    %rax,%r15
+  8056da:	49 b8 d2 cb ff ff ff 	movabs $0xffffffffffffcbd2,%r8
+  8056e1:	ff ff ff 
+  8056e4:	49 01 c0             	add    %rax,%r8
+  8056e7:	41 ff d0             	call   *%r8
+}
+  8056ea:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8056ee:	c9                   	leave
+  8056ef:	c3                   	ret
+
+00000000008056f0 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8056f0:	55                   	push   %rbp
+  8056f1:	48 89 e5             	mov    %rsp,%rbp
+  8056f4:	41 57                	push   %r15
+  8056f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8056fa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8056fa <devsock_write+0xa>
+  805701:	49 bb 46 39 00 00 00 	movabs $0x3946,%r11
+  805708:	00 00 00 
+  80570b:	4c 01 d8             	add    %r11,%rax
+  80570e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805712:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805716:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80571a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80571e:	41 89 d0             	mov    %edx,%r8d
+  805721:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805725:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805728:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80572c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805731:	44 89 c2             	mov    %r8d,%edx
+  805734:	49 89 c7             	mov    %rax,%r15
+  805737:	49 b8 ef cc ff ff ff 	movabs $0xffffffffffffccef,%r8
+  80573e:	ff ff ff 
+  805741:	49 01 c0             	add    %rax,%r8
+  805744:	41 ff d0             	call   *%r8
+}
+  805747:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80574b:	c9                   	leave
+  80574c:	c3                   	ret
+
+000000000080574d <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80574d:	55                   	push   %rbp
+  80574e:	48 89 e5             	mov    %rsp,%rbp
+  805751:	41 57                	push   %r15
+  805753:	48 83 ec 18          	sub    $0x18,%rsp
+  805757:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805757 <devsock_stat+0xa>
+  80575e:	49 bb e9 38 00 00 00 	movabs $0x38e9,%r11
+  805765:	00 00 00 
+  805768:	4c 01 d8             	add    %r11,%rax
+  80576b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80576f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805773:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805777:	48 b9 2c e3 ff ff ff 	movabs $0xffffffffffffe32c,%rcx
+  80577e:	ff ff ff 
+  805781:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805785:	48 89 ce             	mov    %rcx,%rsi
+  805788:	48 89 d7             	mov    %rdx,%rdi
+  80578b:	49 89 c7             	mov    %rax,%r15
+  80578e:	48 ba be 83 ff ff ff 	movabs $0xffffffffffff83be,%rdx
+  805795:	ff ff ff 
+  805798:	48 01 c2             	add    %rax,%rdx
+  80579b:	ff d2                	call   *%rdx
+	return 0;
+  80579d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057a2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8057a6:	c9                   	leave
+  8057a7:	c3                   	ret
+
+00000000008057a8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8057a8:	55                   	push   %rbp
+  8057a9:	48 89 e5             	mov    %rsp,%rbp
+  8057ac:	41 57                	push   %r15
+  8057ae:	53                   	push   %rbx
+  8057af:	48 83 ec 20          	sub    $0x20,%rsp
+  8057b3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057b3 <socket+0xb>
+  8057ba:	49 bb 8d 38 00 00 00 	movabs $0x388d,%r11
+  8057c1:	00 00 00 
+  8057c4:	4c 01 db             	add    %r11,%rbx
+  8057c7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8057ca:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8057cd:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8057d0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8057d3:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8057d6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8057d9:	89 ce                	mov    %ecx,%esi
+  8057db:	89 c7                	mov    %eax,%edi
+  8057dd:	49 89 df             	mov    %rbx,%r15
+  8057e0:	48 b8 c6 ce ff ff ff 	movabs $0xffffffffffffcec6,%rax
+  8057e7:	ff ff ff 
+  8057ea:	48 01 d8             	add    %rbx,%rax
+  8057ed:	ff d0                	call   *%rax
+  8057ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057f6:	79 05                	jns    8057fd <socket+0x55>
+		return r;
+  8057f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057fb:	eb 15                	jmp    805812 <socket+0x6a>
+	return alloc_sockfd(r);
+  8057fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805800:	89 c7                	mov    %eax,%edi
+  805802:	48 b8 b0 c2 ff ff ff 	movabs $0xffffffffffffc2b0,%rax
+  805809:	ff ff ff 
+  80580c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805810:	ff d0                	call   *%rax
+}
+  805812:	48 83 c4 20          	add    $0x20,%rsp
+  805816:	5b                   	pop    %rbx
+  805817:	41 5f                	pop    %r15
+  805819:	5d                   	pop    %rbp
+  80581a:	c3                   	ret
+
+000000000080581b <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80581b:	55                   	push   %rbp
+  80581c:	48 89 e5             	mov    %rsp,%rbp
+  80581f:	41 57                	push   %r15
+  805821:	53                   	push   %rbx
+  805822:	48 83 ec 10          	sub    $0x10,%rsp
+  805826:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805826 <nsipc+0xb>
+  80582d:	49 bb 1a 38 00 00 00 	movabs $0x381a,%r11
+  805834:	00 00 00 
+  805837:	4c 01 db             	add    %r11,%rbx
+  80583a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  80583d:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805844:	00 00 00 
+  805847:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80584a:	85 c0                	test   %eax,%eax
+  80584c:	75 24                	jne    805872 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80584e:	bf 02 00 00 00       	mov    $0x2,%edi
+  805853:	49 89 df             	mov    %rbx,%r15
+  805856:	48 b8 ec aa ff ff ff 	movabs $0xffffffffffffaaec,%rax
+  80585d:	ff ff ff 
+  805860:	48 01 d8             	add    %rbx,%rax
+  805863:	ff d0                	call   *%rax
+  805865:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80586c:	00 00 00 
+  80586f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805872:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805879:	00 00 00 
+  80587c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80587f:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805882:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805888:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80588e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805893:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80589a:	00 00 00 
+  80589d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8058a1:	89 c7                	mov    %eax,%edi
+  8058a3:	49 89 df             	mov    %rbx,%r15
+  8058a6:	48 b8 0b a5 ff ff ff 	movabs $0xffffffffffffa50b,%rax
+  8058ad:	ff ff ff 
+  8058b0:	48 01 d8             	add    %rbx,%rax
+  8058b3:	ff d0                	call   *%rax
+}
+  8058b5:	48 83 c4 10          	add    $0x10,%rsp
+  8058b9:	5b                   	pop    %rbx
+  8058ba:	41 5f                	pop    %r15
+  8058bc:	5d                   	pop    %rbp
+  8058bd:	c3                   	ret
+
+00000000008058be <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8058be:	55                   	push   %rbp
+  8058bf:	48 89 e5             	mov    %rsp,%rbp
+  8058c2:	41 57                	push   %r15
+  8058c4:	53                   	push   %rbx
+  8058c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8058c9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058c9 <nsipc_words+0xb>
+  8058d0:	49 bb 77 37 00 00 00 	movabs $0x3777,%r11
+  8058d7:	00 00 00 
+  8058da:	4c 01 db             	add    %r11,%rbx
+  8058dd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8058e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8058e4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8058e8:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8058ef:	00 00 00 
+  8058f2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8058f5:	85 c0                	test   %eax,%eax
+  8058f7:	75 24                	jne    80591d <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8058f9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8058fe:	49 89 df             	mov    %rbx,%r15
+  805901:	48 b8 ec aa ff ff ff 	movabs $0xffffffffffffaaec,%rax
+  805908:	ff ff ff 
+  80590b:	48 01 d8             	add    %rbx,%rax
+  80590e:	ff d0                	call   *%rax
+  805910:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805917:	00 00 00 
+  80591a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  80591d:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805924:	00 00 00 
+  805927:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80592a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80592e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805932:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805935:	89 c7                	mov    %eax,%edi
+  805937:	49 89 df             	mov    %rbx,%r15
+  80593a:	48 b8 f6 a5 ff ff ff 	movabs $0xffffffffffffa5f6,%rax
+  805941:	ff ff ff 
+  805944:	48 01 d8             	add    %rbx,%rax
+  805947:	ff d0                	call   *%rax
+}
+  805949:	48 83 c4 20          	add    $0x20,%rsp
+  80594d:	5b                   	pop    %rbx
+  80594e:	41 5f                	pop    %r15
+  805950:	5d                   	pop    %rbp
+  805951:	c3                   	ret
+
+0000000000805952 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805952:	55                   	push   %rbp
+  805953:	48 89 e5             	mov    %rsp,%rbp
+  805956:	41 57                	push   %r15
+  805958:	53                   	push   %rbx
+  805959:	48 83 ec 30          	sub    $0x30,%rsp
+  80595d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80595d <nsipc_accept+0xb>
+  805964:	49 bb e3 36 00 00 00 	movabs $0x36e3,%r11
+  80596b:	00 00 00 
+  80596e:	4c 01 db             	add    %r11,%rbx
+  805971:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805974:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805978:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80597c:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805983:	00 00 00 
+  805986:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805989:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80598c:	bf 01 00 00 00       	mov    $0x1,%edi
+  805991:	48 b8 db c7 ff ff ff 	movabs $0xffffffffffffc7db,%rax
+  805998:	ff ff ff 
+  80599b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80599f:	ff d0                	call   *%rax
+  8059a1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059a4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059a8:	78 48                	js     8059f2 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8059aa:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  8059b1:	00 00 00 
+  8059b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8059b8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8059bc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059c0:	8b 40 10             	mov    0x10(%rax),%eax
+  8059c3:	89 c2                	mov    %eax,%edx
+  8059c5:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8059c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059cd:	48 89 ce             	mov    %rcx,%rsi
+  8059d0:	48 89 c7             	mov    %rax,%rdi
+  8059d3:	49 89 df             	mov    %rbx,%r15
+  8059d6:	48 b8 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rax
+  8059dd:	ff ff ff 
+  8059e0:	48 01 d8             	add    %rbx,%rax
+  8059e3:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8059e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059e9:	8b 50 10             	mov    0x10(%rax),%edx
+  8059ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8059f0:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8059f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8059f5:	48 83 c4 30          	add    $0x30,%rsp
+  8059f9:	5b                   	pop    %rbx
+  8059fa:	41 5f                	pop    %r15
+  8059fc:	5d                   	pop    %rbp
+  8059fd:	c3                   	ret
+
+00000000008059fe <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8059fe:	55                   	push   %rbp
+  8059ff:	48 89 e5             	mov    %rsp,%rbp
+  805a02:	41 57                	push   %r15
+  805a04:	53                   	push   %rbx
+  805a05:	48 83 ec 10          	sub    $0x10,%rsp
+  805a09:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a09 <nsipc_bind+0xb>
+  805a10:	49 bb 37 36 00 00 00 	movabs $0x3637,%r11
+  805a17:	00 00 00 
+  805a1a:	4c 01 db             	add    %r11,%rbx
+  805a1d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a20:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805a24:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805a27:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805a2e:	00 00 00 
+  805a31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a34:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805a37:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a3e:	48 89 c6             	mov    %rax,%rsi
+  805a41:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805a48:	00 00 00 
+  805a4b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a4f:	48 89 c7             	mov    %rax,%rdi
+  805a52:	49 89 df             	mov    %rbx,%r15
+  805a55:	48 b8 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rax
+  805a5c:	ff ff ff 
+  805a5f:	48 01 d8             	add    %rbx,%rax
+  805a62:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805a64:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805a6b:	00 00 00 
+  805a6e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a71:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805a75:	bf 02 00 00 00       	mov    $0x2,%edi
+  805a7a:	48 b8 db c7 ff ff ff 	movabs $0xffffffffffffc7db,%rax
+  805a81:	ff ff ff 
+  805a84:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a88:	ff d0                	call   *%rax
+}
+  805a8a:	48 83 c4 10          	add    $0x10,%rsp
+  805a8e:	5b                   	pop    %rbx
+  805a8f:	41 5f                	pop    %r15
+  805a91:	5d                   	pop    %rbp
+  805a92:	c3                   	ret
+
+0000000000805a93 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805a93:	55                   	push   %rbp
+  805a94:	48 89 e5             	mov    %rsp,%rbp
+  805a97:	48 83 ec 20          	sub    $0x20,%rsp
+  805a9b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a9b <nsipc_shutdown+0x8>
+  805aa2:	49 bb a5 35 00 00 00 	movabs $0x35a5,%r11
+  805aa9:	00 00 00 
+  805aac:	4c 01 d8             	add    %r11,%rax
+  805aaf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805ab2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805ab5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805ab8:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805abb:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805abe:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805ac1:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805ac5:	ba 08 00 00 00       	mov    $0x8,%edx
+  805aca:	48 89 ce             	mov    %rcx,%rsi
+  805acd:	bf 03 00 00 00       	mov    $0x3,%edi
+  805ad2:	48 b9 7e c8 ff ff ff 	movabs $0xffffffffffffc87e,%rcx
+  805ad9:	ff ff ff 
+  805adc:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805ae0:	ff d0                	call   *%rax
+}
+  805ae2:	c9                   	leave
+  805ae3:	c3                   	ret
+
+0000000000805ae4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805ae4:	55                   	push   %rbp
+  805ae5:	48 89 e5             	mov    %rsp,%rbp
+  805ae8:	48 83 ec 20          	sub    $0x20,%rsp
+  805aec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805aec <nsipc_close+0x8>
+  805af3:	49 bb 54 35 00 00 00 	movabs $0x3554,%r11
+  805afa:	00 00 00 
+  805afd:	4c 01 d8             	add    %r11,%rax
+  805b00:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805b03:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805b06:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805b09:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805b0d:	ba 04 00 00 00       	mov    $0x4,%edx
+  805b12:	48 89 ce             	mov    %rcx,%rsi
+  805b15:	bf 04 00 00 00       	mov    $0x4,%edi
+  805b1a:	48 b9 7e c8 ff ff ff 	movabs $0xffffffffffffc87e,%rcx
+  805b21:	ff ff ff 
+  805b24:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805b28:	ff d0                	call   *%rax
+}
+  805b2a:	c9                   	leave
+  805b2b:	c3                   	ret
+
+0000000000805b2c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805b2c:	55                   	push   %rbp
+  805b2d:	48 89 e5             	mov    %rsp,%rbp
+  805b30:	41 57                	push   %r15
+  805b32:	53                   	push   %rbx
+  805b33:	48 83 ec 10          	sub    $0x10,%rsp
+  805b37:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b37 <nsipc_connect+0xb>
+  805b3e:	49 bb 09 35 00 00 00 	movabs $0x3509,%r11
+  805b45:	00 00 00 
+  805b48:	4c 01 db             	add    %r11,%rbx
+  805b4b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805b4e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805b52:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805b55:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b5c:	00 00 00 
+  805b5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b62:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805b65:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b68:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b6c:	48 89 c6             	mov    %rax,%rsi
+  805b6f:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805b76:	00 00 00 
+  805b79:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b7d:	48 89 c7             	mov    %rax,%rdi
+  805b80:	49 89 df             	mov    %rbx,%r15
+  805b83:	48 b8 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rax
+  805b8a:	ff ff ff 
+  805b8d:	48 01 d8             	add    %rbx,%rax
+  805b90:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805b92:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b99:	00 00 00 
+  805b9c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805b9f:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805ba3:	bf 05 00 00 00       	mov    $0x5,%edi
+  805ba8:	48 b8 db c7 ff ff ff 	movabs $0xffffffffffffc7db,%rax
+  805baf:	ff ff ff 
+  805bb2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805bb6:	ff d0                	call   *%rax
+}
+  805bb8:	48 83 c4 10          	add    $0x10,%rsp
+  805bbc:	5b                   	pop    %rbx
+  805bbd:	41 5f                	pop    %r15
+  805bbf:	5d                   	pop    %rbp
+  805bc0:	c3                   	ret
+
+0000000000805bc1 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805bc1:	55                   	push   %rbp
+  805bc2:	48 89 e5             	mov    %rsp,%rbp
+  805bc5:	48 83 ec 20          	sub    $0x20,%rsp
+  805bc9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805bc9 <nsipc_listen+0x8>
+  805bd0:	49 bb 77 34 00 00 00 	movabs $0x3477,%r11
+  805bd7:	00 00 00 
+  805bda:	4c 01 d8             	add    %r11,%rax
+  805bdd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805be0:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805be3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805be6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805be9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805bec:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805bef:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805bf3:	ba 08 00 00 00       	mov    $0x8,%edx
+  805bf8:	48 89 ce             	mov    %rcx,%rsi
+  805bfb:	bf 06 00 00 00       	mov    $0x6,%edi
+  805c00:	48 b9 7e c8 ff ff ff 	movabs $0xffffffffffffc87e,%rcx
+  805c07:	ff ff ff 
+  805c0a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805c0e:	ff d0                	call   *%rax
+}
+  805c10:	c9                   	leave
+  805c11:	c3                   	ret
+
+0000000000805c12 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805c12:	55                   	push   %rbp
+  805c13:	48 89 e5             	mov    %rsp,%rbp
+  805c16:	41 57                	push   %r15
+  805c18:	53                   	push   %rbx
+  805c19:	48 83 ec 30          	sub    $0x30,%rsp
+  805c1d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c1d <nsipc_recv+0xb>
+  805c24:	49 bb 23 34 00 00 00 	movabs $0x3423,%r11
+  805c2b:	00 00 00 
+  805c2e:	4c 01 db             	add    %r11,%rbx
+  805c31:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805c34:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805c38:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805c3b:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805c3e:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c45:	00 00 00 
+  805c48:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c4b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805c4e:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c55:	00 00 00 
+  805c58:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805c5b:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805c5f:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c66:	00 00 00 
+  805c69:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c6c:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805c70:	bf 07 00 00 00       	mov    $0x7,%edi
+  805c75:	48 b8 db c7 ff ff ff 	movabs $0xffffffffffffc7db,%rax
+  805c7c:	ff ff ff 
+  805c7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c83:	ff d0                	call   *%rax
+  805c85:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c88:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c8c:	0f 88 91 00 00 00    	js     805d23 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805c92:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805c99:	7f 08                	jg     805ca3 <nsipc_recv+0x91>
+  805c9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c9e:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805ca1:	7e 50                	jle    805cf3 <nsipc_recv+0xe1>
+  805ca3:	48 b8 33 e3 ff ff ff 	movabs $0xffffffffffffe333,%rax
+  805caa:	ff ff ff 
+  805cad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cb1:	48 89 c1             	mov    %rax,%rcx
+  805cb4:	48 b8 48 e3 ff ff ff 	movabs $0xffffffffffffe348,%rax
+  805cbb:	ff ff ff 
+  805cbe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cc2:	48 89 c2             	mov    %rax,%rdx
+  805cc5:	be 79 00 00 00       	mov    $0x79,%esi
+  805cca:	48 b8 5d e3 ff ff ff 	movabs $0xffffffffffffe35d,%rax
+  805cd1:	ff ff ff 
+  805cd4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cd8:	48 89 c7             	mov    %rax,%rdi
+  805cdb:	49 89 df             	mov    %rbx,%r15
+  805cde:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ce3:	49 b8 25 73 ff ff ff 	movabs $0xffffffffffff7325,%r8
+  805cea:	ff ff ff 
+  805ced:	49 01 d8             	add    %rbx,%r8
+  805cf0:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805cf3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cf6:	48 63 d0             	movslq %eax,%rdx
+  805cf9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cfd:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805d04:	00 00 00 
+  805d07:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805d0b:	48 89 ce             	mov    %rcx,%rsi
+  805d0e:	48 89 c7             	mov    %rax,%rdi
+  805d11:	49 89 df             	mov    %rbx,%r15
+  805d14:	48 b8 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rax
+  805d1b:	ff ff ff 
+  805d1e:	48 01 d8             	add    %rbx,%rax
+  805d21:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805d23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805d26:	48 83 c4 30          	add    $0x30,%rsp
+  805d2a:	5b                   	pop    %rbx
+  805d2b:	41 5f                	pop    %r15
+  805d2d:	5d                   	pop    %rbp
+  805d2e:	c3                   	ret
+
+0000000000805d2f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805d2f:	55                   	push   %rbp
+  805d30:	48 89 e5             	mov    %rsp,%rbp
+  805d33:	41 57                	push   %r15
+  805d35:	53                   	push   %rbx
+  805d36:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805d3d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d3d <nsipc_send+0xe>
+  805d44:	49 bb 03 33 00 00 00 	movabs $0x3303,%r11
+  805d4b:	00 00 00 
+  805d4e:	4c 01 db             	add    %r11,%rbx
+  805d51:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805d57:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805d5e:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805d64:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805d6a:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805d6e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805d72:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805d79:	00 00 00 
+  805d7c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805d7f:	85 c0                	test   %eax,%eax
+  805d81:	75 24                	jne    805da7 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805d83:	bf 02 00 00 00       	mov    $0x2,%edi
+  805d88:	49 89 df             	mov    %rbx,%r15
+  805d8b:	48 b8 ec aa ff ff ff 	movabs $0xffffffffffffaaec,%rax
+  805d92:	ff ff ff 
+  805d95:	48 01 d8             	add    %rbx,%rax
+  805d98:	ff d0                	call   *%rax
+  805d9a:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805da1:	00 00 00 
+  805da4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805da7:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805dad:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805db0:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805db7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805dba:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805dbd:	39 c2                	cmp    %eax,%edx
+  805dbf:	0f 4e c2             	cmovle %edx,%eax
+  805dc2:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805dc8:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805dce:	48 63 d0             	movslq %eax,%rdx
+  805dd1:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805dd8:	48 89 c6             	mov    %rax,%rsi
+  805ddb:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805de2:	00 00 00 
+  805de5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805de9:	48 89 c7             	mov    %rax,%rdi
+  805dec:	49 89 df             	mov    %rbx,%r15
+  805def:	48 b8 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rax
+  805df6:	ff ff ff 
+  805df9:	48 01 d8             	add    %rbx,%rax
+  805dfc:	ff d0                	call   *%rax
+	req->req_s = s;
+  805dfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e02:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805e08:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805e0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e0e:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805e14:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805e17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e1b:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805e21:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805e24:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805e2b:	00 00 00 
+  805e2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e32:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805e36:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805e3d:	00 
+  805e3e:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805e44:	48 63 d0             	movslq %eax,%rdx
+  805e47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e4b:	48 01 d0             	add    %rdx,%rax
+  805e4e:	48 83 e8 01          	sub    $0x1,%rax
+  805e52:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805e56:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e5f:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805e63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e67:	48 29 d0             	sub    %rdx,%rax
+  805e6a:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805e70:	85 c0                	test   %eax,%eax
+  805e72:	0f 48 c2             	cmovs  %edx,%eax
+  805e75:	c1 f8 0c             	sar    $0xc,%eax
+  805e78:	48 98                	cltq
+  805e7a:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805e7e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805e82:	48 85 c0             	test   %rax,%rax
+  805e85:	0f 95 c0             	setne  %al
+  805e88:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805e8b:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  805e92:	00 
+  805e93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e97:	48 83 c0 0b          	add    $0xb,%rax
+  805e9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805e9f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805ea3:	ba 00 00 00 00       	mov    $0x0,%edx
+  805ea8:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805eac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805eb0:	48 29 d0             	sub    %rdx,%rax
+  805eb3:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805eb7:	89 c7                	mov    %eax,%edi
+  805eb9:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805ec0:	00 00 00 
+  805ec3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805ec6:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805eca:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805ece:	48 83 ec 08          	sub    $0x8,%rsp
+  805ed2:	6a 00                	push   $0x0
+  805ed4:	6a 00                	push   $0x0
+  805ed6:	6a 05                	push   $0x5
+  805ed8:	41 89 f1             	mov    %esi,%r9d
+  805edb:	49 89 c8             	mov    %rcx,%r8
+  805ede:	89 f9                	mov    %edi,%ecx
+  805ee0:	be 08 00 00 00       	mov    $0x8,%esi
+  805ee5:	89 c7                	mov    %eax,%edi
+  805ee7:	49 89 df             	mov    %rbx,%r15
+  805eea:	48 b8 f4 a6 ff ff ff 	movabs $0xffffffffffffa6f4,%rax
+  805ef1:	ff ff ff 
+  805ef4:	48 01 d8             	add    %rbx,%rax
+  805ef7:	ff d0                	call   *%rax
+  805ef9:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805efd:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805f01:	5b                   	pop    %rbx
+  805f02:	41 5f                	pop    %r15
+  805f04:	5d                   	pop    %rbp
+  805f05:	c3                   	ret
+
+0000000000805f06 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805f06:	55                   	push   %rbp
+  805f07:	48 89 e5             	mov    %rsp,%rbp
+  805f0a:	48 83 ec 10          	sub    $0x10,%rsp
+  805f0e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f0e <nsipc_socket+0x8>
+  805f15:	49 bb 32 31 00 00 00 	movabs $0x3132,%r11
+  805f1c:	00 00 00 
+  805f1f:	4c 01 d8             	add    %r11,%rax
+  805f22:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805f25:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805f28:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805f2b:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805f32:	00 00 00 
+  805f35:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805f38:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805f3b:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805f42:	00 00 00 
+  805f45:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805f48:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805f4c:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805f53:	00 00 00 
+  805f56:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805f59:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805f5d:	bf 09 00 00 00       	mov    $0x9,%edi
+  805f62:	48 ba db c7 ff ff ff 	movabs $0xffffffffffffc7db,%rdx
+  805f69:	ff ff ff 
+  805f6c:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805f70:	ff d0                	call   *%rax
+}
+  805f72:	c9                   	leave
+  805f73:	c3                   	ret
+
+0000000000805f74 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805f74:	55                   	push   %rbp
+  805f75:	48 89 e5             	mov    %rsp,%rbp
+  805f78:	41 57                	push   %r15
+  805f7a:	53                   	push   %rbx
+  805f7b:	48 83 ec 30          	sub    $0x30,%rsp
+  805f7f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f7f <pipe+0xb>
+  805f86:	49 bb c1 30 00 00 00 	movabs $0x30c1,%r11
+  805f8d:	00 00 00 
+  805f90:	4c 01 db             	add    %r11,%rbx
+  805f93:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805f97:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805f9b:	48 89 c7             	mov    %rax,%rdi
+  805f9e:	49 89 df             	mov    %rbx,%r15
+  805fa1:	48 b8 f5 ab ff ff ff 	movabs $0xffffffffffffabf5,%rax
+  805fa8:	ff ff ff 
+  805fab:	48 01 d8             	add    %rbx,%rax
+  805fae:	ff d0                	call   *%rax
+  805fb0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fb3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fb7:	0f 88 12 02 00 00    	js     8061cf <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805fbd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fc1:	ba 07 04 00 00       	mov    $0x407,%edx
+  805fc6:	48 89 c6             	mov    %rax,%rsi
+  805fc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fce:	49 89 df             	mov    %rbx,%r15
+  805fd1:	48 b8 7a 90 ff ff ff 	movabs $0xffffffffffff907a,%rax
+  805fd8:	ff ff ff 
+  805fdb:	48 01 d8             	add    %rbx,%rax
+  805fde:	ff d0                	call   *%rax
+  805fe0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fe3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fe7:	0f 88 e2 01 00 00    	js     8061cf <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805fed:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805ff1:	48 89 c7             	mov    %rax,%rdi
+  805ff4:	49 89 df             	mov    %rbx,%r15
+  805ff7:	48 b8 f5 ab ff ff ff 	movabs $0xffffffffffffabf5,%rax
+  805ffe:	ff ff ff 
+  806001:	48 01 d8             	add    %rbx,%rax
+  806004:	ff d0                	call   *%rax
+  806006:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806009:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80600d:	0f 88 9b 01 00 00    	js     8061ae <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806013:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806017:	ba 07 04 00 00       	mov    $0x407,%edx
+  80601c:	48 89 c6             	mov    %rax,%rsi
+  80601f:	bf 00 00 00 00       	mov    $0x0,%edi
+  806024:	49 89 df             	mov    %rbx,%r15
+  806027:	48 b8 7a 90 ff ff ff 	movabs $0xffffffffffff907a,%rax
+  80602e:	ff ff ff 
+  806031:	48 01 d8             	add    %rbx,%rax
+  806034:	ff d0                	call   *%rax
+  806036:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806039:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80603d:	0f 88 6b 01 00 00    	js     8061ae <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  806043:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806047:	48 89 c7             	mov    %rax,%rdi
+  80604a:	49 89 df             	mov    %rbx,%r15
+  80604d:	48 b8 b2 ab ff ff ff 	movabs $0xffffffffffffabb2,%rax
+  806054:	ff ff ff 
+  806057:	48 01 d8             	add    %rbx,%rax
+  80605a:	ff d0                	call   *%rax
+  80605c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806060:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806064:	ba 07 04 00 00       	mov    $0x407,%edx
+  806069:	48 89 c6             	mov    %rax,%rsi
+  80606c:	bf 00 00 00 00       	mov    $0x0,%edi
+  806071:	49 89 df             	mov    %rbx,%r15
+  806074:	48 b8 7a 90 ff ff ff 	movabs $0xffffffffffff907a,%rax
+  80607b:	ff ff ff 
+  80607e:	48 01 d8             	add    %rbx,%rax
+  806081:	ff d0                	call   *%rax
+  806083:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806086:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80608a:	0f 88 fd 00 00 00    	js     80618d <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806090:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806094:	48 89 c7             	mov    %rax,%rdi
+  806097:	49 89 df             	mov    %rbx,%r15
+  80609a:	48 b8 b2 ab ff ff ff 	movabs $0xffffffffffffabb2,%rax
+  8060a1:	ff ff ff 
+  8060a4:	48 01 d8             	add    %rbx,%rax
+  8060a7:	ff d0                	call   *%rax
+  8060a9:	48 89 c2             	mov    %rax,%rdx
+  8060ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060b0:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8060b6:	48 89 d1             	mov    %rdx,%rcx
+  8060b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8060be:	48 89 c6             	mov    %rax,%rsi
+  8060c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060c6:	49 89 df             	mov    %rbx,%r15
+  8060c9:	48 b8 df 90 ff ff ff 	movabs $0xffffffffffff90df,%rax
+  8060d0:	ff ff ff 
+  8060d3:	48 01 d8             	add    %rbx,%rax
+  8060d6:	ff d0                	call   *%rax
+  8060d8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8060db:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060df:	0f 88 87 00 00 00    	js     80616c <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8060e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060e9:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8060f0:	00 00 00 
+  8060f3:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8060f6:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  8060f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060fc:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  806103:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806107:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  80610e:	00 00 00 
+  806111:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806114:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  806116:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80611a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  806121:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806125:	48 89 c7             	mov    %rax,%rdi
+  806128:	49 89 df             	mov    %rbx,%r15
+  80612b:	48 b8 7b ab ff ff ff 	movabs $0xffffffffffffab7b,%rax
+  806132:	ff ff ff 
+  806135:	48 01 d8             	add    %rbx,%rax
+  806138:	ff d0                	call   *%rax
+  80613a:	89 c2                	mov    %eax,%edx
+  80613c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806140:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  806142:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806146:	48 89 c7             	mov    %rax,%rdi
+  806149:	49 89 df             	mov    %rbx,%r15
+  80614c:	48 b8 7b ab ff ff ff 	movabs $0xffffffffffffab7b,%rax
+  806153:	ff ff ff 
+  806156:	48 01 d8             	add    %rbx,%rax
+  806159:	ff d0                	call   *%rax
+  80615b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80615f:	48 83 c2 04          	add    $0x4,%rdx
+  806163:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  806165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80616a:	eb 67                	jmp    8061d3 <pipe+0x25f>
+		goto err3;
+  80616c:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80616d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806171:	48 89 c6             	mov    %rax,%rsi
+  806174:	bf 00 00 00 00       	mov    $0x0,%edi
+  806179:	49 89 df             	mov    %rbx,%r15
+  80617c:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  806183:	ff ff ff 
+  806186:	48 01 d8             	add    %rbx,%rax
+  806189:	ff d0                	call   *%rax
+  80618b:	eb 01                	jmp    80618e <pipe+0x21a>
+		goto err2;
+  80618d:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80618e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806192:	48 89 c6             	mov    %rax,%rsi
+  806195:	bf 00 00 00 00       	mov    $0x0,%edi
+  80619a:	49 89 df             	mov    %rbx,%r15
+  80619d:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  8061a4:	ff ff ff 
+  8061a7:	48 01 d8             	add    %rbx,%rax
+  8061aa:	ff d0                	call   *%rax
+  8061ac:	eb 01                	jmp    8061af <pipe+0x23b>
+		goto err1;
+  8061ae:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8061af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8061b3:	48 89 c6             	mov    %rax,%rsi
+  8061b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061bb:	49 89 df             	mov    %rbx,%r15
+  8061be:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  8061c5:	ff ff ff 
+  8061c8:	48 01 d8             	add    %rbx,%rax
+  8061cb:	ff d0                	call   *%rax
+  8061cd:	eb 01                	jmp    8061d0 <pipe+0x25c>
+		goto err;
+  8061cf:	90                   	nop
+err:
+	return r;
+  8061d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8061d3:	48 83 c4 30          	add    $0x30,%rsp
+  8061d7:	5b                   	pop    %rbx
+  8061d8:	41 5f                	pop    %r15
+  8061da:	5d                   	pop    %rbp
+  8061db:	c3                   	ret
+
+00000000008061dc <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8061dc:	55                   	push   %rbp
+  8061dd:	48 89 e5             	mov    %rsp,%rbp
+  8061e0:	41 57                	push   %r15
+  8061e2:	41 54                	push   %r12
+  8061e4:	53                   	push   %rbx
+  8061e5:	48 83 ec 28          	sub    $0x28,%rsp
+  8061e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061e9 <_pipeisclosed+0xd>
+  8061f0:	49 bb 57 2e 00 00 00 	movabs $0x2e57,%r11
+  8061f7:	00 00 00 
+  8061fa:	4c 01 db             	add    %r11,%rbx
+  8061fd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806201:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  806205:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80620c:	ff ff ff 
+  80620f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806213:	48 8b 00             	mov    (%rax),%rax
+  806216:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80621c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  80621f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806223:	48 89 c7             	mov    %rax,%rdi
+  806226:	49 89 df             	mov    %rbx,%r15
+  806229:	48 b8 06 dc ff ff ff 	movabs $0xffffffffffffdc06,%rax
+  806230:	ff ff ff 
+  806233:	48 01 d8             	add    %rbx,%rax
+  806236:	ff d0                	call   *%rax
+  806238:	41 89 c4             	mov    %eax,%r12d
+  80623b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80623f:	48 89 c7             	mov    %rax,%rdi
+  806242:	49 89 df             	mov    %rbx,%r15
+  806245:	48 b8 06 dc ff ff ff 	movabs $0xffffffffffffdc06,%rax
+  80624c:	ff ff ff 
+  80624f:	48 01 d8             	add    %rbx,%rax
+  806252:	ff d0                	call   *%rax
+  806254:	41 39 c4             	cmp    %eax,%r12d
+  806257:	0f 94 c0             	sete   %al
+  80625a:	0f b6 c0             	movzbl %al,%eax
+  80625d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806260:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806267:	ff ff ff 
+  80626a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80626e:	48 8b 00             	mov    (%rax),%rax
+  806271:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806277:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80627a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80627d:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806280:	75 05                	jne    806287 <_pipeisclosed+0xab>
+			return ret;
+  806282:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806285:	eb 63                	jmp    8062ea <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  806287:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80628a:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80628d:	0f 84 72 ff ff ff    	je     806205 <_pipeisclosed+0x29>
+  806293:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  806297:	0f 85 68 ff ff ff    	jne    806205 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80629d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8062a4:	ff ff ff 
+  8062a7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8062ab:	48 8b 00             	mov    (%rax),%rax
+  8062ae:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8062b4:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8062b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8062ba:	89 c6                	mov    %eax,%esi
+  8062bc:	48 b8 6e e3 ff ff ff 	movabs $0xffffffffffffe36e,%rax
+  8062c3:	ff ff ff 
+  8062c6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8062ca:	48 89 c7             	mov    %rax,%rdi
+  8062cd:	49 89 df             	mov    %rbx,%r15
+  8062d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062d5:	49 b8 fc 75 ff ff ff 	movabs $0xffffffffffff75fc,%r8
+  8062dc:	ff ff ff 
+  8062df:	49 01 d8             	add    %rbx,%r8
+  8062e2:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8062e5:	e9 1b ff ff ff       	jmp    806205 <_pipeisclosed+0x29>
+	}
+}
+  8062ea:	48 83 c4 28          	add    $0x28,%rsp
+  8062ee:	5b                   	pop    %rbx
+  8062ef:	41 5c                	pop    %r12
+  8062f1:	41 5f                	pop    %r15
+  8062f3:	5d                   	pop    %rbp
+  8062f4:	c3                   	ret
+
+00000000008062f5 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8062f5:	55                   	push   %rbp
+  8062f6:	48 89 e5             	mov    %rsp,%rbp
+  8062f9:	41 57                	push   %r15
+  8062fb:	53                   	push   %rbx
+  8062fc:	48 83 ec 30          	sub    $0x30,%rsp
+  806300:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806300 <pipeisclosed+0xb>
+  806307:	49 bb 40 2d 00 00 00 	movabs $0x2d40,%r11
+  80630e:	00 00 00 
+  806311:	4c 01 db             	add    %r11,%rbx
+  806314:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806317:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80631b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80631e:	48 89 d6             	mov    %rdx,%rsi
+  806321:	89 c7                	mov    %eax,%edi
+  806323:	49 89 df             	mov    %rbx,%r15
+  806326:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  80632d:	ff ff ff 
+  806330:	48 01 d8             	add    %rbx,%rax
+  806333:	ff d0                	call   *%rax
+  806335:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806338:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80633c:	79 05                	jns    806343 <pipeisclosed+0x4e>
+		return r;
+  80633e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806341:	eb 3b                	jmp    80637e <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  806343:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806347:	48 89 c7             	mov    %rax,%rdi
+  80634a:	49 89 df             	mov    %rbx,%r15
+  80634d:	48 b8 b2 ab ff ff ff 	movabs $0xffffffffffffabb2,%rax
+  806354:	ff ff ff 
+  806357:	48 01 d8             	add    %rbx,%rax
+  80635a:	ff d0                	call   *%rax
+  80635c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806360:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806364:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806368:	48 89 d6             	mov    %rdx,%rsi
+  80636b:	48 89 c7             	mov    %rax,%rdi
+  80636e:	48 b8 9c d1 ff ff ff 	movabs $0xffffffffffffd19c,%rax
+  806375:	ff ff ff 
+  806378:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80637c:	ff d0                	call   *%rax
+}
+  80637e:	48 83 c4 30          	add    $0x30,%rsp
+  806382:	5b                   	pop    %rbx
+  806383:	41 5f                	pop    %r15
+  806385:	5d                   	pop    %rbp
+  806386:	c3                   	ret
+
+0000000000806387 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806387:	55                   	push   %rbp
+  806388:	48 89 e5             	mov    %rsp,%rbp
+  80638b:	41 57                	push   %r15
+  80638d:	53                   	push   %rbx
+  80638e:	48 83 ec 40          	sub    $0x40,%rsp
+  806392:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806392 <devpipe_read+0xb>
+  806399:	49 bb ae 2c 00 00 00 	movabs $0x2cae,%r11
+  8063a0:	00 00 00 
+  8063a3:	4c 01 db             	add    %r11,%rbx
+  8063a6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8063aa:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8063ae:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8063b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063b6:	48 89 c7             	mov    %rax,%rdi
+  8063b9:	49 89 df             	mov    %rbx,%r15
+  8063bc:	48 b8 b2 ab ff ff ff 	movabs $0xffffffffffffabb2,%rax
+  8063c3:	ff ff ff 
+  8063c6:	48 01 d8             	add    %rbx,%rax
+  8063c9:	ff d0                	call   *%rax
+  8063cb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8063cf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8063d3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8063d7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8063de:	00 
+  8063df:	e9 a1 00 00 00       	jmp    806485 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8063e4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8063e9:	74 09                	je     8063f4 <devpipe_read+0x6d>
+				return i;
+  8063eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063ef:	e9 9f 00 00 00       	jmp    806493 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8063f4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8063f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063fc:	48 89 d6             	mov    %rdx,%rsi
+  8063ff:	48 89 c7             	mov    %rax,%rdi
+  806402:	48 b8 9c d1 ff ff ff 	movabs $0xffffffffffffd19c,%rax
+  806409:	ff ff ff 
+  80640c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806410:	ff d0                	call   *%rax
+  806412:	85 c0                	test   %eax,%eax
+  806414:	74 07                	je     80641d <devpipe_read+0x96>
+				return 0;
+  806416:	b8 00 00 00 00       	mov    $0x0,%eax
+  80641b:	eb 76                	jmp    806493 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  80641d:	49 89 df             	mov    %rbx,%r15
+  806420:	48 b8 25 90 ff ff ff 	movabs $0xffffffffffff9025,%rax
+  806427:	ff ff ff 
+  80642a:	48 01 d8             	add    %rbx,%rax
+  80642d:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  80642f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806433:	8b 10                	mov    (%rax),%edx
+  806435:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806439:	8b 40 04             	mov    0x4(%rax),%eax
+  80643c:	39 c2                	cmp    %eax,%edx
+  80643e:	74 a4                	je     8063e4 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  806440:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806444:	8b 10                	mov    (%rax),%edx
+  806446:	89 d0                	mov    %edx,%eax
+  806448:	c1 f8 1f             	sar    $0x1f,%eax
+  80644b:	c1 e8 1b             	shr    $0x1b,%eax
+  80644e:	01 c2                	add    %eax,%edx
+  806450:	83 e2 1f             	and    $0x1f,%edx
+  806453:	29 c2                	sub    %eax,%edx
+  806455:	89 d6                	mov    %edx,%esi
+  806457:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80645b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80645f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806463:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806467:	48 63 c6             	movslq %esi,%rax
+  80646a:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  80646f:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806471:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806475:	8b 00                	mov    (%rax),%eax
+  806477:	8d 50 01             	lea    0x1(%rax),%edx
+  80647a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80647e:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806480:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806485:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806489:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80648d:	72 a0                	jb     80642f <devpipe_read+0xa8>
+	}
+	return i;
+  80648f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806493:	48 83 c4 40          	add    $0x40,%rsp
+  806497:	5b                   	pop    %rbx
+  806498:	41 5f                	pop    %r15
+  80649a:	5d                   	pop    %rbp
+  80649b:	c3                   	ret
+
+000000000080649c <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80649c:	55                   	push   %rbp
+  80649d:	48 89 e5             	mov    %rsp,%rbp
+  8064a0:	41 57                	push   %r15
+  8064a2:	53                   	push   %rbx
+  8064a3:	48 83 ec 40          	sub    $0x40,%rsp
+  8064a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064a7 <devpipe_write+0xb>
+  8064ae:	49 bb 99 2b 00 00 00 	movabs $0x2b99,%r11
+  8064b5:	00 00 00 
+  8064b8:	4c 01 db             	add    %r11,%rbx
+  8064bb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8064bf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8064c3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8064c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8064cb:	48 89 c7             	mov    %rax,%rdi
+  8064ce:	49 89 df             	mov    %rbx,%r15
+  8064d1:	48 b8 b2 ab ff ff ff 	movabs $0xffffffffffffabb2,%rax
+  8064d8:	ff ff ff 
+  8064db:	48 01 d8             	add    %rbx,%rax
+  8064de:	ff d0                	call   *%rax
+  8064e0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8064e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8064e8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8064ec:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8064f3:	00 
+  8064f4:	e9 a0 00 00 00       	jmp    806599 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8064f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8064fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806501:	48 89 d6             	mov    %rdx,%rsi
+  806504:	48 89 c7             	mov    %rax,%rdi
+  806507:	48 b8 9c d1 ff ff ff 	movabs $0xffffffffffffd19c,%rax
+  80650e:	ff ff ff 
+  806511:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806515:	ff d0                	call   *%rax
+  806517:	85 c0                	test   %eax,%eax
+  806519:	74 0a                	je     806525 <devpipe_write+0x89>
+				return 0;
+  80651b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806520:	e9 82 00 00 00       	jmp    8065a7 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  806525:	49 89 df             	mov    %rbx,%r15
+  806528:	48 b8 25 90 ff ff ff 	movabs $0xffffffffffff9025,%rax
+  80652f:	ff ff ff 
+  806532:	48 01 d8             	add    %rbx,%rax
+  806535:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  806537:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80653b:	8b 40 04             	mov    0x4(%rax),%eax
+  80653e:	48 63 d0             	movslq %eax,%rdx
+  806541:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806545:	8b 00                	mov    (%rax),%eax
+  806547:	48 98                	cltq
+  806549:	48 83 c0 20          	add    $0x20,%rax
+  80654d:	48 39 c2             	cmp    %rax,%rdx
+  806550:	73 a7                	jae    8064f9 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806552:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806556:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80655a:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80655e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806562:	8b 50 04             	mov    0x4(%rax),%edx
+  806565:	89 d0                	mov    %edx,%eax
+  806567:	c1 f8 1f             	sar    $0x1f,%eax
+  80656a:	c1 e8 1b             	shr    $0x1b,%eax
+  80656d:	01 c2                	add    %eax,%edx
+  80656f:	83 e2 1f             	and    $0x1f,%edx
+  806572:	29 c2                	sub    %eax,%edx
+  806574:	89 d0                	mov    %edx,%eax
+  806576:	0f b6 09             	movzbl (%rcx),%ecx
+  806579:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80657d:	48 98                	cltq
+  80657f:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806583:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806587:	8b 40 04             	mov    0x4(%rax),%eax
+  80658a:	8d 50 01             	lea    0x1(%rax),%edx
+  80658d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806591:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806594:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806599:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80659d:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8065a1:	72 94                	jb     806537 <devpipe_write+0x9b>
+	}
+
+	return i;
+  8065a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8065a7:	48 83 c4 40          	add    $0x40,%rsp
+  8065ab:	5b                   	pop    %rbx
+  8065ac:	41 5f                	pop    %r15
+  8065ae:	5d                   	pop    %rbp
+  8065af:	c3                   	ret
+
+00000000008065b0 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8065b0:	55                   	push   %rbp
+  8065b1:	48 89 e5             	mov    %rsp,%rbp
+  8065b4:	41 57                	push   %r15
+  8065b6:	53                   	push   %rbx
+  8065b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8065bb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065bb <devpipe_stat+0xb>
+  8065c2:	49 bb 85 2a 00 00 00 	movabs $0x2a85,%r11
+  8065c9:	00 00 00 
+  8065cc:	4c 01 db             	add    %r11,%rbx
+  8065cf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8065d3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8065d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065db:	48 89 c7             	mov    %rax,%rdi
+  8065de:	49 89 df             	mov    %rbx,%r15
+  8065e1:	48 b8 b2 ab ff ff ff 	movabs $0xffffffffffffabb2,%rax
+  8065e8:	ff ff ff 
+  8065eb:	48 01 d8             	add    %rbx,%rax
+  8065ee:	ff d0                	call   *%rax
+  8065f0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8065f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065f8:	48 ba 81 e3 ff ff ff 	movabs $0xffffffffffffe381,%rdx
+  8065ff:	ff ff ff 
+  806602:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806606:	48 89 d6             	mov    %rdx,%rsi
+  806609:	48 89 c7             	mov    %rax,%rdi
+  80660c:	49 89 df             	mov    %rbx,%r15
+  80660f:	48 b8 be 83 ff ff ff 	movabs $0xffffffffffff83be,%rax
+  806616:	ff ff ff 
+  806619:	48 01 d8             	add    %rbx,%rax
+  80661c:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80661e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806622:	8b 50 04             	mov    0x4(%rax),%edx
+  806625:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806629:	8b 00                	mov    (%rax),%eax
+  80662b:	29 c2                	sub    %eax,%edx
+  80662d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806631:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  806637:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80663b:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806642:	00 00 00 
+	stat->st_dev = &devpipe;
+  806645:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806649:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806650:	00 00 00 
+  806653:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806657:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80665e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806663:	48 83 c4 20          	add    $0x20,%rsp
+  806667:	5b                   	pop    %rbx
+  806668:	41 5f                	pop    %r15
+  80666a:	5d                   	pop    %rbp
+  80666b:	c3                   	ret
+
+000000000080666c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80666c:	55                   	push   %rbp
+  80666d:	48 89 e5             	mov    %rsp,%rbp
+  806670:	41 57                	push   %r15
+  806672:	53                   	push   %rbx
+  806673:	48 83 ec 10          	sub    $0x10,%rsp
+  806677:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806677 <devpipe_close+0xb>
+  80667e:	49 bb c9 29 00 00 00 	movabs $0x29c9,%r11
+  806685:	00 00 00 
+  806688:	4c 01 db             	add    %r11,%rbx
+  80668b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80668f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806693:	48 89 c6             	mov    %rax,%rsi
+  806696:	bf 00 00 00 00       	mov    $0x0,%edi
+  80669b:	49 89 df             	mov    %rbx,%r15
+  80669e:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  8066a5:	ff ff ff 
+  8066a8:	48 01 d8             	add    %rbx,%rax
+  8066ab:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8066ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066b1:	48 89 c7             	mov    %rax,%rdi
+  8066b4:	49 89 df             	mov    %rbx,%r15
+  8066b7:	48 b8 b2 ab ff ff ff 	movabs $0xffffffffffffabb2,%rax
+  8066be:	ff ff ff 
+  8066c1:	48 01 d8             	add    %rbx,%rax
+  8066c4:	ff d0                	call   *%rax
+  8066c6:	48 89 c6             	mov    %rax,%rsi
+  8066c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8066ce:	49 89 df             	mov    %rbx,%r15
+  8066d1:	48 b8 52 91 ff ff ff 	movabs $0xffffffffffff9152,%rax
+  8066d8:	ff ff ff 
+  8066db:	48 01 d8             	add    %rbx,%rax
+  8066de:	ff d0                	call   *%rax
+}
+  8066e0:	48 83 c4 10          	add    $0x10,%rsp
+  8066e4:	5b                   	pop    %rbx
+  8066e5:	41 5f                	pop    %r15
+  8066e7:	5d                   	pop    %rbp
+  8066e8:	c3                   	ret
+
+00000000008066e9 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8066e9:	55                   	push   %rbp
+  8066ea:	48 89 e5             	mov    %rsp,%rbp
+  8066ed:	41 57                	push   %r15
+  8066ef:	48 83 ec 28          	sub    $0x28,%rsp
+  8066f3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8066f3 <cputchar+0xa>
+  8066fa:	49 bb 4d 29 00 00 00 	movabs $0x294d,%r11
+  806701:	00 00 00 
+  806704:	4c 01 d8             	add    %r11,%rax
+  806707:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80670a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80670d:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806710:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806714:	be 01 00 00 00       	mov    $0x1,%esi
+  806719:	48 89 d7             	mov    %rdx,%rdi
+  80671c:	49 89 c7             	mov    %rax,%r15
+  80671f:	48 ba c2 8e ff ff ff 	movabs $0xffffffffffff8ec2,%rdx
+  806726:	ff ff ff 
+  806729:	48 01 c2             	add    %rax,%rdx
+  80672c:	ff d2                	call   *%rdx
+}
+  80672e:	90                   	nop
+  80672f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806733:	c9                   	leave
+  806734:	c3                   	ret
+
+0000000000806735 <getchar>:
+
+int
+getchar(void)
+{
+  806735:	55                   	push   %rbp
+  806736:	48 89 e5             	mov    %rsp,%rbp
+  806739:	41 57                	push   %r15
+  80673b:	48 83 ec 18          	sub    $0x18,%rsp
+  80673f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80673f <getchar+0xa>
+  806746:	49 bb 01 29 00 00 00 	movabs $0x2901,%r11
+  80674d:	00 00 00 
+  806750:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806753:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806757:	ba 01 00 00 00       	mov    $0x1,%edx
+  80675c:	48 89 ce             	mov    %rcx,%rsi
+  80675f:	bf 00 00 00 00       	mov    $0x0,%edi
+  806764:	49 89 c7             	mov    %rax,%r15
+  806767:	48 b9 f2 b1 ff ff ff 	movabs $0xffffffffffffb1f2,%rcx
+  80676e:	ff ff ff 
+  806771:	48 01 c1             	add    %rax,%rcx
+  806774:	ff d1                	call   *%rcx
+  806776:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806779:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80677d:	79 05                	jns    806784 <getchar+0x4f>
+		return r;
+  80677f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806782:	eb 14                	jmp    806798 <getchar+0x63>
+	if (r < 1)
+  806784:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806788:	7f 07                	jg     806791 <getchar+0x5c>
+		return -E_EOF;
+  80678a:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80678f:	eb 07                	jmp    806798 <getchar+0x63>
+	return c;
+  806791:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806795:	0f b6 c0             	movzbl %al,%eax
+}
+  806798:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80679c:	c9                   	leave
+  80679d:	c3                   	ret
+
+000000000080679e <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80679e:	55                   	push   %rbp
+  80679f:	48 89 e5             	mov    %rsp,%rbp
+  8067a2:	41 57                	push   %r15
+  8067a4:	53                   	push   %rbx
+  8067a5:	48 83 ec 20          	sub    $0x20,%rsp
+  8067a9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067a9 <iscons+0xb>
+  8067b0:	49 bb 97 28 00 00 00 	movabs $0x2897,%r11
+  8067b7:	00 00 00 
+  8067ba:	4c 01 db             	add    %r11,%rbx
+  8067bd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8067c0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8067c4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8067c7:	48 89 d6             	mov    %rdx,%rsi
+  8067ca:	89 c7                	mov    %eax,%edi
+  8067cc:	49 89 df             	mov    %rbx,%r15
+  8067cf:	48 b8 ab ac ff ff ff 	movabs $0xffffffffffffacab,%rax
+  8067d6:	ff ff ff 
+  8067d9:	48 01 d8             	add    %rbx,%rax
+  8067dc:	ff d0                	call   *%rax
+  8067de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8067e1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067e5:	79 05                	jns    8067ec <iscons+0x4e>
+		return r;
+  8067e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067ea:	eb 1b                	jmp    806807 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8067ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067f0:	8b 10                	mov    (%rax),%edx
+  8067f2:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  8067f9:	00 00 00 
+  8067fc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8067ff:	39 c2                	cmp    %eax,%edx
+  806801:	0f 94 c0             	sete   %al
+  806804:	0f b6 c0             	movzbl %al,%eax
+}
+  806807:	48 83 c4 20          	add    $0x20,%rsp
+  80680b:	5b                   	pop    %rbx
+  80680c:	41 5f                	pop    %r15
+  80680e:	5d                   	pop    %rbp
+  80680f:	c3                   	ret
+
+0000000000806810 <opencons>:
+
+int
+opencons(void)
+{
+  806810:	55                   	push   %rbp
+  806811:	48 89 e5             	mov    %rsp,%rbp
+  806814:	41 57                	push   %r15
+  806816:	53                   	push   %rbx
+  806817:	48 83 ec 10          	sub    $0x10,%rsp
+  80681b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80681b <opencons+0xb>
+  806822:	49 bb 25 28 00 00 00 	movabs $0x2825,%r11
+  806829:	00 00 00 
+  80682c:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  80682f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806833:	48 89 c7             	mov    %rax,%rdi
+  806836:	49 89 df             	mov    %rbx,%r15
+  806839:	48 b8 f5 ab ff ff ff 	movabs $0xffffffffffffabf5,%rax
+  806840:	ff ff ff 
+  806843:	48 01 d8             	add    %rbx,%rax
+  806846:	ff d0                	call   *%rax
+  806848:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80684b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80684f:	79 05                	jns    806856 <opencons+0x46>
+		return r;
+  806851:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806854:	eb 68                	jmp    8068be <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806856:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80685a:	ba 07 04 00 00       	mov    $0x407,%edx
+  80685f:	48 89 c6             	mov    %rax,%rsi
+  806862:	bf 00 00 00 00       	mov    $0x0,%edi
+  806867:	49 89 df             	mov    %rbx,%r15
+  80686a:	48 b8 7a 90 ff ff ff 	movabs $0xffffffffffff907a,%rax
+  806871:	ff ff ff 
+  806874:	48 01 d8             	add    %rbx,%rax
+  806877:	ff d0                	call   *%rax
+  806879:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80687c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806880:	79 05                	jns    806887 <opencons+0x77>
+		return r;
+  806882:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806885:	eb 37                	jmp    8068be <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806887:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80688b:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806892:	00 00 00 
+  806895:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806898:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80689a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80689e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8068a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8068a9:	48 89 c7             	mov    %rax,%rdi
+  8068ac:	49 89 df             	mov    %rbx,%r15
+  8068af:	48 b8 7b ab ff ff ff 	movabs $0xffffffffffffab7b,%rax
+  8068b6:	ff ff ff 
+  8068b9:	48 01 d8             	add    %rbx,%rax
+  8068bc:	ff d0                	call   *%rax
+}
+  8068be:	48 83 c4 10          	add    $0x10,%rsp
+  8068c2:	5b                   	pop    %rbx
+  8068c3:	41 5f                	pop    %r15
+  8068c5:	5d                   	pop    %rbp
+  8068c6:	c3                   	ret
+
+00000000008068c7 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8068c7:	55                   	push   %rbp
+  8068c8:	48 89 e5             	mov    %rsp,%rbp
+  8068cb:	41 57                	push   %r15
+  8068cd:	53                   	push   %rbx
+  8068ce:	48 83 ec 30          	sub    $0x30,%rsp
+  8068d2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068d2 <devcons_read+0xb>
+  8068d9:	49 bb 6e 27 00 00 00 	movabs $0x276e,%r11
+  8068e0:	00 00 00 
+  8068e3:	4c 01 db             	add    %r11,%rbx
+  8068e6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8068ea:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8068ee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8068f2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8068f7:	75 19                	jne    806912 <devcons_read+0x4b>
+		return 0;
+  8068f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068fe:	eb 55                	jmp    806955 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806900:	49 89 df             	mov    %rbx,%r15
+  806903:	48 b8 25 90 ff ff ff 	movabs $0xffffffffffff9025,%rax
+  80690a:	ff ff ff 
+  80690d:	48 01 d8             	add    %rbx,%rax
+  806910:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806912:	49 89 df             	mov    %rbx,%r15
+  806915:	48 b8 21 8f ff ff ff 	movabs $0xffffffffffff8f21,%rax
+  80691c:	ff ff ff 
+  80691f:	48 01 d8             	add    %rbx,%rax
+  806922:	ff d0                	call   *%rax
+  806924:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806927:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80692b:	74 d3                	je     806900 <devcons_read+0x39>
+	if (c < 0)
+  80692d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806931:	79 05                	jns    806938 <devcons_read+0x71>
+		return c;
+  806933:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806936:	eb 1d                	jmp    806955 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806938:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80693c:	75 07                	jne    806945 <devcons_read+0x7e>
+		return 0;
+  80693e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806943:	eb 10                	jmp    806955 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806945:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806948:	89 c2                	mov    %eax,%edx
+  80694a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80694e:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806950:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806955:	48 83 c4 30          	add    $0x30,%rsp
+  806959:	5b                   	pop    %rbx
+  80695a:	41 5f                	pop    %r15
+  80695c:	5d                   	pop    %rbp
+  80695d:	c3                   	ret
+
+000000000080695e <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80695e:	55                   	push   %rbp
+  80695f:	48 89 e5             	mov    %rsp,%rbp
+  806962:	41 57                	push   %r15
+  806964:	53                   	push   %rbx
+  806965:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80696c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80696c <devcons_write+0xe>
+  806973:	49 bb d4 26 00 00 00 	movabs $0x26d4,%r11
+  80697a:	00 00 00 
+  80697d:	4c 01 db             	add    %r11,%rbx
+  806980:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806987:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  80698e:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806995:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80699c:	e9 80 00 00 00       	jmp    806a21 <devcons_write+0xc3>
+		m = n - tot;
+  8069a1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8069a8:	89 c2                	mov    %eax,%edx
+  8069aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069ad:	29 c2                	sub    %eax,%edx
+  8069af:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8069b2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8069b5:	83 f8 7f             	cmp    $0x7f,%eax
+  8069b8:	76 07                	jbe    8069c1 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8069ba:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8069c1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8069c4:	48 63 d0             	movslq %eax,%rdx
+  8069c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069ca:	48 63 c8             	movslq %eax,%rcx
+  8069cd:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8069d4:	48 01 c1             	add    %rax,%rcx
+  8069d7:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8069de:	48 89 ce             	mov    %rcx,%rsi
+  8069e1:	48 89 c7             	mov    %rax,%rdi
+  8069e4:	49 89 df             	mov    %rbx,%r15
+  8069e7:	48 b8 9e 87 ff ff ff 	movabs $0xffffffffffff879e,%rax
+  8069ee:	ff ff ff 
+  8069f1:	48 01 d8             	add    %rbx,%rax
+  8069f4:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8069f6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8069f9:	48 63 d0             	movslq %eax,%rdx
+  8069fc:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806a03:	48 89 d6             	mov    %rdx,%rsi
+  806a06:	48 89 c7             	mov    %rax,%rdi
+  806a09:	49 89 df             	mov    %rbx,%r15
+  806a0c:	48 b8 c2 8e ff ff ff 	movabs $0xffffffffffff8ec2,%rax
+  806a13:	ff ff ff 
+  806a16:	48 01 d8             	add    %rbx,%rax
+  806a19:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806a1b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806a1e:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806a21:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a24:	48 98                	cltq
+  806a26:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806a2d:	0f 82 6e ff ff ff    	jb     8069a1 <devcons_write+0x43>
+	}
+	return tot;
+  806a33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806a36:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806a3d:	5b                   	pop    %rbx
+  806a3e:	41 5f                	pop    %r15
+  806a40:	5d                   	pop    %rbp
+  806a41:	c3                   	ret
+
+0000000000806a42 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806a42:	55                   	push   %rbp
+  806a43:	48 89 e5             	mov    %rsp,%rbp
+  806a46:	48 83 ec 08          	sub    $0x8,%rsp
+  806a4a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a4a <devcons_close+0x8>
+  806a51:	49 bb f6 25 00 00 00 	movabs $0x25f6,%r11
+  806a58:	00 00 00 
+  806a5b:	4c 01 d8             	add    %r11,%rax
+  806a5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806a62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a67:	c9                   	leave
+  806a68:	c3                   	ret
+
+0000000000806a69 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806a69:	55                   	push   %rbp
+  806a6a:	48 89 e5             	mov    %rsp,%rbp
+  806a6d:	41 57                	push   %r15
+  806a6f:	48 83 ec 18          	sub    $0x18,%rsp
+  806a73:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a73 <devcons_stat+0xa>
+  806a7a:	49 bb cd 25 00 00 00 	movabs $0x25cd,%r11
+  806a81:	00 00 00 
+  806a84:	4c 01 d8             	add    %r11,%rax
+  806a87:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806a8b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806a8f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806a93:	48 b9 8d e3 ff ff ff 	movabs $0xffffffffffffe38d,%rcx
+  806a9a:	ff ff ff 
+  806a9d:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806aa1:	48 89 ce             	mov    %rcx,%rsi
+  806aa4:	48 89 d7             	mov    %rdx,%rdi
+  806aa7:	49 89 c7             	mov    %rax,%r15
+  806aaa:	48 ba be 83 ff ff ff 	movabs $0xffffffffffff83be,%rdx
+  806ab1:	ff ff ff 
+  806ab4:	48 01 c2             	add    %rax,%rdx
+  806ab7:	ff d2                	call   *%rdx
+	return 0;
+  806ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806abe:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806ac2:	c9                   	leave
+  806ac3:	c3                   	ret
+
+0000000000806ac4 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806ac4:	55                   	push   %rbp
+  806ac5:	48 89 e5             	mov    %rsp,%rbp
+  806ac8:	41 57                	push   %r15
+  806aca:	53                   	push   %rbx
+  806acb:	48 83 ec 20          	sub    $0x20,%rsp
+  806acf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806acf <set_pgfault_handler+0xb>
+  806ad6:	49 bb 71 25 00 00 00 	movabs $0x2571,%r11
+  806add:	00 00 00 
+  806ae0:	4c 01 db             	add    %r11,%rbx
+  806ae3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806ae7:	49 89 df             	mov    %rbx,%r15
+  806aea:	48 b8 d1 8f ff ff ff 	movabs $0xffffffffffff8fd1,%rax
+  806af1:	ff ff ff 
+  806af4:	48 01 d8             	add    %rbx,%rax
+  806af7:	ff d0                	call   *%rax
+  806af9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806afc:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806b03:	00 00 00 
+  806b06:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b0a:	48 85 c0             	test   %rax,%rax
+  806b0d:	75 6b                	jne    806b7a <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806b0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b12:	ba 07 00 00 00       	mov    $0x7,%edx
+  806b17:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806b1c:	48 89 ce             	mov    %rcx,%rsi
+  806b1f:	89 c7                	mov    %eax,%edi
+  806b21:	49 89 df             	mov    %rbx,%r15
+  806b24:	48 b8 7a 90 ff ff ff 	movabs $0xffffffffffff907a,%rax
+  806b2b:	ff ff ff 
+  806b2e:	48 01 d8             	add    %rbx,%rax
+  806b31:	ff d0                	call   *%rax
+  806b33:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806b36:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806b3a:	74 3e                	je     806b7a <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806b3c:	48 b8 98 e3 ff ff ff 	movabs $0xffffffffffffe398,%rax
+  806b43:	ff ff ff 
+  806b46:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b4a:	48 89 c2             	mov    %rax,%rdx
+  806b4d:	be 23 00 00 00       	mov    $0x23,%esi
+  806b52:	48 b8 c6 e3 ff ff ff 	movabs $0xffffffffffffe3c6,%rax
+  806b59:	ff ff ff 
+  806b5c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b60:	48 89 c7             	mov    %rax,%rdi
+  806b63:	49 89 df             	mov    %rbx,%r15
+  806b66:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b6b:	48 b9 25 73 ff ff ff 	movabs $0xffffffffffff7325,%rcx
+  806b72:	ff ff ff 
+  806b75:	48 01 d9             	add    %rbx,%rcx
+  806b78:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806b7a:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806b81:	00 00 00 
+  806b84:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806b88:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806b8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b8f:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806b96:	ff ff ff 
+  806b99:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806b9d:	48 89 d6             	mov    %rdx,%rsi
+  806ba0:	89 c7                	mov    %eax,%edi
+  806ba2:	49 89 df             	mov    %rbx,%r15
+  806ba5:	48 b8 70 92 ff ff ff 	movabs $0xffffffffffff9270,%rax
+  806bac:	ff ff ff 
+  806baf:	48 01 d8             	add    %rbx,%rax
+  806bb2:	ff d0                	call   *%rax
+}
+  806bb4:	90                   	nop
+  806bb5:	48 83 c4 20          	add    $0x20,%rsp
+  806bb9:	5b                   	pop    %rbx
+  806bba:	41 5f                	pop    %r15
+  806bbc:	5d                   	pop    %rbp
+  806bbd:	c3                   	ret
+
+0000000000806bbe <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806bbe:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806bc1:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806bc8:	00 00 00 
+call *%rax
+  806bcb:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806bcd:	58                   	pop    %rax
+	popq %rax;
+  806bce:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806bcf:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806bd6:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806bda:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806bde:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806be2:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806be6:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806bea:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806bed:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806bf1:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806bf5:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806bfa:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806bff:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806c04:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806c09:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806c0e:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806c13:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806c18:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806c1d:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806c22:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806c27:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806c2c:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806c31:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806c36:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806c3b:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806c3f:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806c43:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806c44:	5c                   	pop    %rsp
+	ret;			//return
+  806c45:	c3                   	ret
+
+0000000000806c46 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806c46:	55                   	push   %rbp
+  806c47:	48 89 e5             	mov    %rsp,%rbp
+  806c4a:	48 83 ec 18          	sub    $0x18,%rsp
+  806c4e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806c4e <pageref+0x8>
+  806c55:	49 bb f2 23 00 00 00 	movabs $0x23f2,%r11
+  806c5c:	00 00 00 
+  806c5f:	4c 01 d8             	add    %r11,%rax
+  806c62:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806c66:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c6a:	48 89 d1             	mov    %rdx,%rcx
+  806c6d:	48 c1 e9 15          	shr    $0x15,%rcx
+  806c71:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806c78:	ff ff ff 
+  806c7b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806c7f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806c83:	83 e2 01             	and    $0x1,%edx
+  806c86:	48 85 d2             	test   %rdx,%rdx
+  806c89:	75 07                	jne    806c92 <pageref+0x4c>
+		return 0;
+  806c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c90:	eb 64                	jmp    806cf6 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806c92:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c96:	48 89 d1             	mov    %rdx,%rcx
+  806c99:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806c9d:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806ca4:	ff ff ff 
+  806ca7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806cab:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806caf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806cb3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806cb7:	83 e2 01             	and    $0x1,%edx
+  806cba:	48 85 d2             	test   %rdx,%rdx
+  806cbd:	75 07                	jne    806cc6 <pageref+0x80>
+		return 0;
+  806cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cc4:	eb 30                	jmp    806cf6 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806cc6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806cca:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806cce:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806cd5:	ff ff ff 
+  806cd8:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806cdc:	48 89 d0             	mov    %rdx,%rax
+  806cdf:	48 01 c0             	add    %rax,%rax
+  806ce2:	48 01 d0             	add    %rdx,%rax
+  806ce5:	48 c1 e0 03          	shl    $0x3,%rax
+  806ce9:	48 01 c8             	add    %rcx,%rax
+  806cec:	48 83 c0 08          	add    $0x8,%rax
+  806cf0:	0f b7 00             	movzwl (%rax),%eax
+  806cf3:	0f b7 c0             	movzwl %ax,%eax
+}
+  806cf6:	c9                   	leave
+  806cf7:	c3                   	ret
@@ -0,0 +1,10831 @@
+
+obj/user/primespipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 09 05 00 00       	call   80054a <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 30          	sub    $0x30,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <primeproc+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	int i, id, p, pfd[2], wfd, r;
+
+	// fetch a prime from our left neighbor
+top:
+	if ((r = readn(fd, &p, 4)) != 4)
+  800065:	48 8d 4d dc          	lea    -0x24(%rbp),%rcx
+  800069:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80006c:	ba 04 00 00 00       	mov    $0x4,%edx
+  800071:	48 89 ce             	mov    %rcx,%rsi
+  800074:	89 c7                	mov    %eax,%edi
+  800076:	49 89 df             	mov    %rbx,%r15
+  800079:	48 b8 28 ae ff ff ff 	movabs $0xffffffffffffae28,%rax
+  800080:	ff ff ff 
+  800083:	48 01 d8             	add    %rbx,%rax
+  800086:	ff d0                	call   *%rax
+  800088:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80008b:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80008f:	74 54                	je     8000e5 <primeproc+0xa2>
+		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+  800091:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800094:	ba 00 00 00 00       	mov    $0x0,%edx
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	0f 4e d0             	cmovle %eax,%edx
+  80009e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000a1:	41 89 d0             	mov    %edx,%r8d
+  8000a4:	89 c1                	mov    %eax,%ecx
+  8000a6:	48 b8 a8 df ff ff ff 	movabs $0xffffffffffffdfa8,%rax
+  8000ad:	ff ff ff 
+  8000b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000b4:	48 89 c2             	mov    %rax,%rdx
+  8000b7:	be 15 00 00 00       	mov    $0x15,%esi
+  8000bc:	48 b8 d7 df ff ff ff 	movabs $0xffffffffffffdfd7,%rax
+  8000c3:	ff ff ff 
+  8000c6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000ca:	48 89 c7             	mov    %rax,%rdi
+  8000cd:	49 89 df             	mov    %rbx,%r15
+  8000d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d5:	49 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r9
+  8000dc:	ff ff ff 
+  8000df:	49 01 d9             	add    %rbx,%r9
+  8000e2:	41 ff d1             	call   *%r9
+
+	cprintf("%d\n", p);
+  8000e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8000e8:	89 c6                	mov    %eax,%esi
+  8000ea:	48 b8 e9 df ff ff ff 	movabs $0xffffffffffffdfe9,%rax
+  8000f1:	ff ff ff 
+  8000f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000f8:	48 89 c7             	mov    %rax,%rdi
+  8000fb:	49 89 df             	mov    %rbx,%r15
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	48 ba eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%rdx
+  80010a:	ff ff ff 
+  80010d:	48 01 da             	add    %rbx,%rdx
+  800110:	ff d2                	call   *%rdx
+
+	// fork a right neighbor to continue the chain
+	if ((i=pipe(pfd)) < 0)
+  800112:	48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+  800116:	48 89 c7             	mov    %rax,%rdi
+  800119:	49 89 df             	mov    %rbx,%r15
+  80011c:	48 b8 57 ca ff ff ff 	movabs $0xffffffffffffca57,%rax
+  800123:	ff ff ff 
+  800126:	48 01 d8             	add    %rbx,%rax
+  800129:	ff d0                	call   *%rax
+  80012b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80012e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800131:	85 c0                	test   %eax,%eax
+  800133:	79 44                	jns    800179 <primeproc+0x136>
+		panic("pipe: %e", i);
+  800135:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800138:	89 c1                	mov    %eax,%ecx
+  80013a:	48 b8 ed df ff ff ff 	movabs $0xffffffffffffdfed,%rax
+  800141:	ff ff ff 
+  800144:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800148:	48 89 c2             	mov    %rax,%rdx
+  80014b:	be 1b 00 00 00       	mov    $0x1b,%esi
+  800150:	48 b8 d7 df ff ff ff 	movabs $0xffffffffffffdfd7,%rax
+  800157:	ff ff ff 
+  80015a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80015e:	48 89 c7             	mov    %rax,%rdi
+  800161:	49 89 df             	mov    %rbx,%r15
+  800164:	b8 00 00 00 00       	mov    $0x0,%eax
+  800169:	49 b8 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r8
+  800170:	ff ff ff 
+  800173:	49 01 d8             	add    %rbx,%r8
+  800176:	41 ff d0             	call   *%r8
+	if ((id = fork()) < 0)
+  800179:	49 89 df             	mov    %rbx,%r15
+  80017c:	48 b8 f8 a2 ff ff ff 	movabs $0xffffffffffffa2f8,%rax
+  800183:	ff ff ff 
+  800186:	48 01 d8             	add    %rbx,%rax
+  800189:	ff d0                	call   *%rax
+  80018b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80018e:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800192:	79 44                	jns    8001d8 <primeproc+0x195>
+		panic("fork: %e", id);
+  800194:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800197:	89 c1                	mov    %eax,%ecx
+  800199:	48 b8 f6 df ff ff ff 	movabs $0xffffffffffffdff6,%rax
+  8001a0:	ff ff ff 
+  8001a3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001a7:	48 89 c2             	mov    %rax,%rdx
+  8001aa:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8001af:	48 b8 d7 df ff ff ff 	movabs $0xffffffffffffdfd7,%rax
+  8001b6:	ff ff ff 
+  8001b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001bd:	48 89 c7             	mov    %rax,%rdi
+  8001c0:	49 89 df             	mov    %rbx,%r15
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	49 b8 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r8
+  8001cf:	ff ff ff 
+  8001d2:	49 01 d8             	add    %rbx,%r8
+  8001d5:	41 ff d0             	call   *%r8
+	if (id == 0) {
+  8001d8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8001dc:	75 39                	jne    800217 <primeproc+0x1d4>
+		close(fd);
+  8001de:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8001e1:	89 c7                	mov    %eax,%edi
+  8001e3:	49 89 df             	mov    %rbx,%r15
+  8001e6:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  8001ed:	ff ff ff 
+  8001f0:	48 01 d8             	add    %rbx,%rax
+  8001f3:	ff d0                	call   *%rax
+		close(pfd[1]);
+  8001f5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8001f8:	89 c7                	mov    %eax,%edi
+  8001fa:	49 89 df             	mov    %rbx,%r15
+  8001fd:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  800204:	ff ff ff 
+  800207:	48 01 d8             	add    %rbx,%rax
+  80020a:	ff d0                	call   *%rax
+		fd = pfd[0];
+  80020c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80020f:	89 45 cc             	mov    %eax,-0x34(%rbp)
+		goto top;
+  800212:	e9 4e fe ff ff       	jmp    800065 <primeproc+0x22>
+	}
+
+	close(pfd[0]);
+  800217:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80021a:	89 c7                	mov    %eax,%edi
+  80021c:	49 89 df             	mov    %rbx,%r15
+  80021f:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  800226:	ff ff ff 
+  800229:	48 01 d8             	add    %rbx,%rax
+  80022c:	ff d0                	call   *%rax
+	wfd = pfd[1];
+  80022e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800231:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+
+	// filter out multiples of our prime
+	for (;;) {
+		if ((r=readn(fd, &i, 4)) != 4)
+  800234:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+  800238:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80023b:	ba 04 00 00 00       	mov    $0x4,%edx
+  800240:	48 89 ce             	mov    %rcx,%rsi
+  800243:	89 c7                	mov    %eax,%edi
+  800245:	49 89 df             	mov    %rbx,%r15
+  800248:	48 b8 28 ae ff ff ff 	movabs $0xffffffffffffae28,%rax
+  80024f:	ff ff ff 
+  800252:	48 01 d8             	add    %rbx,%rax
+  800255:	ff d0                	call   *%rax
+  800257:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80025a:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80025e:	74 62                	je     8002c2 <primeproc+0x27f>
+			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+  800260:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800263:	ba 00 00 00 00       	mov    $0x0,%edx
+  800268:	85 c0                	test   %eax,%eax
+  80026a:	0f 4e d0             	cmovle %eax,%edx
+  80026d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800270:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  800273:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800276:	48 83 ec 08          	sub    $0x8,%rsp
+  80027a:	52                   	push   %rdx
+  80027b:	41 89 f1             	mov    %esi,%r9d
+  80027e:	41 89 c8             	mov    %ecx,%r8d
+  800281:	89 c1                	mov    %eax,%ecx
+  800283:	48 b8 ff df ff ff ff 	movabs $0xffffffffffffdfff,%rax
+  80028a:	ff ff ff 
+  80028d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800291:	48 89 c2             	mov    %rax,%rdx
+  800294:	be 2b 00 00 00       	mov    $0x2b,%esi
+  800299:	48 b8 d7 df ff ff ff 	movabs $0xffffffffffffdfd7,%rax
+  8002a0:	ff ff ff 
+  8002a3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002a7:	48 89 c7             	mov    %rax,%rdi
+  8002aa:	49 89 df             	mov    %rbx,%r15
+  8002ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b2:	49 ba 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r10
+  8002b9:	ff ff ff 
+  8002bc:	49 01 da             	add    %rbx,%r10
+  8002bf:	41 ff d2             	call   *%r10
+		if (i%p)
+  8002c2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8002c5:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8002c8:	99                   	cltd
+  8002c9:	f7 f9                	idiv   %ecx
+  8002cb:	89 d0                	mov    %edx,%eax
+  8002cd:	85 c0                	test   %eax,%eax
+  8002cf:	0f 84 5f ff ff ff    	je     800234 <primeproc+0x1f1>
+			if ((r=write(wfd, &i, 4)) != 4)
+  8002d5:	48 8d 4d e0          	lea    -0x20(%rbp),%rcx
+  8002d9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002dc:	ba 04 00 00 00       	mov    $0x4,%edx
+  8002e1:	48 89 ce             	mov    %rcx,%rsi
+  8002e4:	89 c7                	mov    %eax,%edi
+  8002e6:	49 89 df             	mov    %rbx,%r15
+  8002e9:	48 b8 bb ae ff ff ff 	movabs $0xffffffffffffaebb,%rax
+  8002f0:	ff ff ff 
+  8002f3:	48 01 d8             	add    %rbx,%rax
+  8002f6:	ff d0                	call   *%rax
+  8002f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8002fb:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8002ff:	0f 84 2f ff ff ff    	je     800234 <primeproc+0x1f1>
+				panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+  800305:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800308:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030d:	85 c0                	test   %eax,%eax
+  80030f:	89 d1                	mov    %edx,%ecx
+  800311:	0f 4e c8             	cmovle %eax,%ecx
+  800314:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800317:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80031a:	41 89 c9             	mov    %ecx,%r9d
+  80031d:	41 89 d0             	mov    %edx,%r8d
+  800320:	89 c1                	mov    %eax,%ecx
+  800322:	48 b8 1b e0 ff ff ff 	movabs $0xffffffffffffe01b,%rax
+  800329:	ff ff ff 
+  80032c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800330:	48 89 c2             	mov    %rax,%rdx
+  800333:	be 2e 00 00 00       	mov    $0x2e,%esi
+  800338:	48 b8 d7 df ff ff ff 	movabs $0xffffffffffffdfd7,%rax
+  80033f:	ff ff ff 
+  800342:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800346:	48 89 c7             	mov    %rax,%rdi
+  800349:	49 89 df             	mov    %rbx,%r15
+  80034c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800351:	49 ba 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r10
+  800358:	ff ff ff 
+  80035b:	49 01 da             	add    %rbx,%r10
+  80035e:	41 ff d2             	call   *%r10
+
+0000000000800361 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  800361:	55                   	push   %rbp
+  800362:	48 89 e5             	mov    %rsp,%rbp
+  800365:	41 57                	push   %r15
+  800367:	53                   	push   %rbx
+  800368:	48 83 ec 30          	sub    $0x30,%rsp
+  80036c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80036c <umain+0xb>
+  800373:	49 bb d4 8c 00 00 00 	movabs $0x8cd4,%r11
+  80037a:	00 00 00 
+  80037d:	4c 01 db             	add    %r11,%rbx
+  800380:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800383:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int i, id, p[2], r;
+
+	binaryname = "primespipe";
+  800387:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80038e:	ff ff ff 
+  800391:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800395:	48 ba 35 e0 ff ff ff 	movabs $0xffffffffffffe035,%rdx
+  80039c:	ff ff ff 
+  80039f:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8003a3:	48 89 10             	mov    %rdx,(%rax)
+
+	if ((i=pipe(p)) < 0)
+  8003a6:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+  8003aa:	48 89 c7             	mov    %rax,%rdi
+  8003ad:	49 89 df             	mov    %rbx,%r15
+  8003b0:	48 b8 57 ca ff ff ff 	movabs $0xffffffffffffca57,%rax
+  8003b7:	ff ff ff 
+  8003ba:	48 01 d8             	add    %rbx,%rax
+  8003bd:	ff d0                	call   *%rax
+  8003bf:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8003c2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003c5:	85 c0                	test   %eax,%eax
+  8003c7:	79 44                	jns    80040d <umain+0xac>
+		panic("pipe: %e", i);
+  8003c9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003cc:	89 c1                	mov    %eax,%ecx
+  8003ce:	48 b8 ed df ff ff ff 	movabs $0xffffffffffffdfed,%rax
+  8003d5:	ff ff ff 
+  8003d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003dc:	48 89 c2             	mov    %rax,%rdx
+  8003df:	be 3a 00 00 00       	mov    $0x3a,%esi
+  8003e4:	48 b8 d7 df ff ff ff 	movabs $0xffffffffffffdfd7,%rax
+  8003eb:	ff ff ff 
+  8003ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003f2:	48 89 c7             	mov    %rax,%rdi
+  8003f5:	49 89 df             	mov    %rbx,%r15
+  8003f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fd:	49 b8 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r8
+  800404:	ff ff ff 
+  800407:	49 01 d8             	add    %rbx,%r8
+  80040a:	41 ff d0             	call   *%r8
+
+	// fork the first prime process in the chain
+	if ((id=fork()) < 0)
+  80040d:	49 89 df             	mov    %rbx,%r15
+  800410:	48 b8 f8 a2 ff ff ff 	movabs $0xffffffffffffa2f8,%rax
+  800417:	ff ff ff 
+  80041a:	48 01 d8             	add    %rbx,%rax
+  80041d:	ff d0                	call   *%rax
+  80041f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800422:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800426:	79 44                	jns    80046c <umain+0x10b>
+		panic("fork: %e", id);
+  800428:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80042b:	89 c1                	mov    %eax,%ecx
+  80042d:	48 b8 f6 df ff ff ff 	movabs $0xffffffffffffdff6,%rax
+  800434:	ff ff ff 
+  800437:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80043b:	48 89 c2             	mov    %rax,%rdx
+  80043e:	be 3e 00 00 00       	mov    $0x3e,%esi
+  800443:	48 b8 d7 df ff ff ff 	movabs $0xffffffffffffdfd7,%rax
+  80044a:	ff ff ff 
+  80044d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800451:	48 89 c7             	mov    %rax,%rdi
+  800454:	49 89 df             	mov    %rbx,%r15
+  800457:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045c:	49 b8 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r8
+  800463:	ff ff ff 
+  800466:	49 01 d8             	add    %rbx,%r8
+  800469:	41 ff d0             	call   *%r8
+
+	if (id == 0) {
+  80046c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800470:	75 2c                	jne    80049e <umain+0x13d>
+		close(p[1]);
+  800472:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800475:	89 c7                	mov    %eax,%edi
+  800477:	49 89 df             	mov    %rbx,%r15
+  80047a:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  800481:	ff ff ff 
+  800484:	48 01 d8             	add    %rbx,%rax
+  800487:	ff d0                	call   *%rax
+		primeproc(p[0]);
+  800489:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80048c:	89 c7                	mov    %eax,%edi
+  80048e:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800495:	ff ff ff 
+  800498:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80049c:	ff d0                	call   *%rax
+	}
+
+	close(p[0]);
+  80049e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004a1:	89 c7                	mov    %eax,%edi
+  8004a3:	49 89 df             	mov    %rbx,%r15
+  8004a6:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  8004ad:	ff ff ff 
+  8004b0:	48 01 d8             	add    %rbx,%rax
+  8004b3:	ff d0                	call   *%rax
+
+	// feed all the integers through
+	for (i=2;; i++)
+  8004b5:	c7 45 e4 02 00 00 00 	movl   $0x2,-0x1c(%rbp)
+		if ((r=write(p[1], &i, 4)) != 4)
+  8004bc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8004bf:	48 8d 4d e4          	lea    -0x1c(%rbp),%rcx
+  8004c3:	ba 04 00 00 00       	mov    $0x4,%edx
+  8004c8:	48 89 ce             	mov    %rcx,%rsi
+  8004cb:	89 c7                	mov    %eax,%edi
+  8004cd:	49 89 df             	mov    %rbx,%r15
+  8004d0:	48 b8 bb ae ff ff ff 	movabs $0xffffffffffffaebb,%rax
+  8004d7:	ff ff ff 
+  8004da:	48 01 d8             	add    %rbx,%rax
+  8004dd:	ff d0                	call   *%rax
+  8004df:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8004e2:	83 7d e8 04          	cmpl   $0x4,-0x18(%rbp)
+  8004e6:	74 54                	je     80053c <umain+0x1db>
+			panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
+  8004e8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8004eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f0:	85 c0                	test   %eax,%eax
+  8004f2:	0f 4e d0             	cmovle %eax,%edx
+  8004f5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8004f8:	41 89 d0             	mov    %edx,%r8d
+  8004fb:	89 c1                	mov    %eax,%ecx
+  8004fd:	48 b8 40 e0 ff ff ff 	movabs $0xffffffffffffe040,%rax
+  800504:	ff ff ff 
+  800507:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80050b:	48 89 c2             	mov    %rax,%rdx
+  80050e:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800513:	48 b8 d7 df ff ff ff 	movabs $0xffffffffffffdfd7,%rax
+  80051a:	ff ff ff 
+  80051d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800521:	48 89 c7             	mov    %rax,%rdi
+  800524:	49 89 df             	mov    %rbx,%r15
+  800527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052c:	49 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r9
+  800533:	ff ff ff 
+  800536:	49 01 d9             	add    %rbx,%r9
+  800539:	41 ff d1             	call   *%r9
+	for (i=2;; i++)
+  80053c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80053f:	83 c0 01             	add    $0x1,%eax
+  800542:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+		if ((r=write(p[1], &i, 4)) != 4)
+  800545:	e9 72 ff ff ff       	jmp    8004bc <umain+0x15b>
+
+000000000080054a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80054a:	55                   	push   %rbp
+  80054b:	48 89 e5             	mov    %rsp,%rbp
+  80054e:	41 57                	push   %r15
+  800550:	53                   	push   %rbx
+  800551:	48 83 ec 20          	sub    $0x20,%rsp
+  800555:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800555 <libmain+0xb>
+  80055c:	49 bb eb 8a 00 00 00 	movabs $0x8aeb,%r11
+  800563:	00 00 00 
+  800566:	4c 01 db             	add    %r11,%rbx
+  800569:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80056c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800570:	49 89 df             	mov    %rbx,%r15
+  800573:	48 b8 c0 92 ff ff ff 	movabs $0xffffffffffff92c0,%rax
+  80057a:	ff ff ff 
+  80057d:	48 01 d8             	add    %rbx,%rax
+  800580:	ff d0                	call   *%rax
+  800582:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800585:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800588:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80058d:	48 98                	cltq
+  80058f:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800596:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80059d:	ff ff ff 
+  8005a0:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8005a4:	48 01 c2             	add    %rax,%rdx
+  8005a7:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8005ae:	00 00 00 
+  8005b1:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8005b5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8005b9:	7e 15                	jle    8005d0 <libmain+0x86>
+		binaryname = argv[0];
+  8005bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8005bf:	48 8b 00             	mov    (%rax),%rax
+  8005c2:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8005c9:	00 00 00 
+  8005cc:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8005d0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8005d4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8005d7:	48 89 d6             	mov    %rdx,%rsi
+  8005da:	89 c7                	mov    %eax,%edi
+  8005dc:	49 89 df             	mov    %rbx,%r15
+  8005df:	48 b8 21 73 ff ff ff 	movabs $0xffffffffffff7321,%rax
+  8005e6:	ff ff ff 
+  8005e9:	48 01 d8             	add    %rbx,%rax
+  8005ec:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8005ee:	49 89 df             	mov    %rbx,%r15
+  8005f1:	48 b8 ca 75 ff ff ff 	movabs $0xffffffffffff75ca,%rax
+  8005f8:	ff ff ff 
+  8005fb:	48 01 d8             	add    %rbx,%rax
+  8005fe:	ff d0                	call   *%rax
+}
+  800600:	90                   	nop
+  800601:	48 83 c4 20          	add    $0x20,%rsp
+  800605:	5b                   	pop    %rbx
+  800606:	41 5f                	pop    %r15
+  800608:	5d                   	pop    %rbp
+  800609:	c3                   	ret
+
+000000000080060a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80060a:	55                   	push   %rbp
+  80060b:	48 89 e5             	mov    %rsp,%rbp
+  80060e:	41 57                	push   %r15
+  800610:	53                   	push   %rbx
+  800611:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800611 <exit+0x7>
+  800618:	49 bb 2f 8a 00 00 00 	movabs $0x8a2f,%r11
+  80061f:	00 00 00 
+  800622:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800625:	49 89 df             	mov    %rbx,%r15
+  800628:	48 b8 c9 aa ff ff ff 	movabs $0xffffffffffffaac9,%rax
+  80062f:	ff ff ff 
+  800632:	48 01 d8             	add    %rbx,%rax
+  800635:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800637:	bf 00 00 00 00       	mov    $0x0,%edi
+  80063c:	49 89 df             	mov    %rbx,%r15
+  80063f:	48 b8 64 92 ff ff ff 	movabs $0xffffffffffff9264,%rax
+  800646:	ff ff ff 
+  800649:	48 01 d8             	add    %rbx,%rax
+  80064c:	ff d0                	call   *%rax
+}
+  80064e:	90                   	nop
+  80064f:	5b                   	pop    %rbx
+  800650:	41 5f                	pop    %r15
+  800652:	5d                   	pop    %rbp
+  800653:	c3                   	ret
+
+0000000000800654 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800654:	55                   	push   %rbp
+  800655:	48 89 e5             	mov    %rsp,%rbp
+  800658:	41 57                	push   %r15
+  80065a:	41 54                	push   %r12
+  80065c:	53                   	push   %rbx
+  80065d:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800664:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800664 <_panic+0x10>
+  80066b:	49 bb dc 89 00 00 00 	movabs $0x89dc,%r11
+  800672:	00 00 00 
+  800675:	4c 01 db             	add    %r11,%rbx
+  800678:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80067f:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800685:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80068c:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800693:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80069a:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8006a1:	84 c0                	test   %al,%al
+  8006a3:	74 26                	je     8006cb <_panic+0x77>
+  8006a5:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8006ac:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8006b3:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8006b7:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8006bb:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8006bf:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8006c3:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8006c7:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8006cb:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8006d2:	00 00 00 
+  8006d5:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8006dc:	00 00 00 
+  8006df:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006e3:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8006ea:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8006f1:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006f8:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8006ff:	ff ff ff 
+  800702:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800706:	4c 8b 20             	mov    (%rax),%r12
+  800709:	49 89 df             	mov    %rbx,%r15
+  80070c:	48 b8 c0 92 ff ff ff 	movabs $0xffffffffffff92c0,%rax
+  800713:	ff ff ff 
+  800716:	48 01 d8             	add    %rbx,%rax
+  800719:	ff d0                	call   *%rax
+  80071b:	89 c6                	mov    %eax,%esi
+  80071d:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800723:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80072a:	41 89 d0             	mov    %edx,%r8d
+  80072d:	48 89 c1             	mov    %rax,%rcx
+  800730:	4c 89 e2             	mov    %r12,%rdx
+  800733:	48 b8 68 e0 ff ff ff 	movabs $0xffffffffffffe068,%rax
+  80073a:	ff ff ff 
+  80073d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800741:	48 89 c7             	mov    %rax,%rdi
+  800744:	49 89 df             	mov    %rbx,%r15
+  800747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074c:	49 b9 eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%r9
+  800753:	ff ff ff 
+  800756:	49 01 d9             	add    %rbx,%r9
+  800759:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80075c:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800763:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80076a:	48 89 d6             	mov    %rdx,%rsi
+  80076d:	48 89 c7             	mov    %rax,%rdi
+  800770:	49 89 df             	mov    %rbx,%r15
+  800773:	48 b8 0b 78 ff ff ff 	movabs $0xffffffffffff780b,%rax
+  80077a:	ff ff ff 
+  80077d:	48 01 d8             	add    %rbx,%rax
+  800780:	ff d0                	call   *%rax
+	cprintf("\n");
+  800782:	48 b8 8b e0 ff ff ff 	movabs $0xffffffffffffe08b,%rax
+  800789:	ff ff ff 
+  80078c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800790:	48 89 c7             	mov    %rax,%rdi
+  800793:	49 89 df             	mov    %rbx,%r15
+  800796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079b:	48 ba eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%rdx
+  8007a2:	ff ff ff 
+  8007a5:	48 01 da             	add    %rbx,%rdx
+  8007a8:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8007aa:	cc                   	int3
+  8007ab:	eb fd                	jmp    8007aa <_panic+0x156>
+
+00000000008007ad <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8007ad:	55                   	push   %rbp
+  8007ae:	48 89 e5             	mov    %rsp,%rbp
+  8007b1:	41 57                	push   %r15
+  8007b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8007b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007b7 <putch+0xa>
+  8007be:	49 bb 89 88 00 00 00 	movabs $0x8889,%r11
+  8007c5:	00 00 00 
+  8007c8:	4c 01 d8             	add    %r11,%rax
+  8007cb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8007ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8007d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007d6:	8b 12                	mov    (%rdx),%edx
+  8007d8:	8d 72 01             	lea    0x1(%rdx),%esi
+  8007db:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8007df:	89 31                	mov    %esi,(%rcx)
+  8007e1:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8007e4:	89 ce                	mov    %ecx,%esi
+  8007e6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8007ea:	48 63 d2             	movslq %edx,%rdx
+  8007ed:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8007f2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007f6:	8b 12                	mov    (%rdx),%edx
+  8007f8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8007fe:	75 33                	jne    800833 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800800:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800804:	8b 12                	mov    (%rdx),%edx
+  800806:	48 63 d2             	movslq %edx,%rdx
+  800809:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80080d:	48 83 c1 08          	add    $0x8,%rcx
+  800811:	48 89 d6             	mov    %rdx,%rsi
+  800814:	48 89 cf             	mov    %rcx,%rdi
+  800817:	49 89 c7             	mov    %rax,%r15
+  80081a:	48 ba b1 91 ff ff ff 	movabs $0xffffffffffff91b1,%rdx
+  800821:	ff ff ff 
+  800824:	48 01 c2             	add    %rax,%rdx
+  800827:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800829:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80082d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800833:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800837:	8b 40 04             	mov    0x4(%rax),%eax
+  80083a:	8d 50 01             	lea    0x1(%rax),%edx
+  80083d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800841:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800844:	90                   	nop
+  800845:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800849:	c9                   	leave
+  80084a:	c3                   	ret
+
+000000000080084b <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80084b:	55                   	push   %rbp
+  80084c:	48 89 e5             	mov    %rsp,%rbp
+  80084f:	41 57                	push   %r15
+  800851:	53                   	push   %rbx
+  800852:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800859:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800859 <vcprintf+0xe>
+  800860:	49 bb e7 87 00 00 00 	movabs $0x87e7,%r11
+  800867:	00 00 00 
+  80086a:	4c 01 db             	add    %r11,%rbx
+  80086d:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800874:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80087b:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800882:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800889:	48 8b 06             	mov    (%rsi),%rax
+  80088c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800890:	48 89 01             	mov    %rax,(%rcx)
+  800893:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800897:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80089b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80089f:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8008a6:	00 00 00 
+    b.cnt = 0;
+  8008a9:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8008b0:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8008b3:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8008ba:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8008c1:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8008c8:	48 89 c6             	mov    %rax,%rsi
+  8008cb:	48 b8 6d 77 ff ff ff 	movabs $0xffffffffffff776d,%rax
+  8008d2:	ff ff ff 
+  8008d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008d9:	48 89 c7             	mov    %rax,%rdi
+  8008dc:	49 89 df             	mov    %rbx,%r15
+  8008df:	48 b8 2f 7d ff ff ff 	movabs $0xffffffffffff7d2f,%rax
+  8008e6:	ff ff ff 
+  8008e9:	48 01 d8             	add    %rbx,%rax
+  8008ec:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8008ee:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8008f4:	48 98                	cltq
+  8008f6:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8008fd:	48 83 c2 08          	add    $0x8,%rdx
+  800901:	48 89 c6             	mov    %rax,%rsi
+  800904:	48 89 d7             	mov    %rdx,%rdi
+  800907:	49 89 df             	mov    %rbx,%r15
+  80090a:	48 b8 b1 91 ff ff ff 	movabs $0xffffffffffff91b1,%rax
+  800911:	ff ff ff 
+  800914:	48 01 d8             	add    %rbx,%rax
+  800917:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800919:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80091f:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800926:	5b                   	pop    %rbx
+  800927:	41 5f                	pop    %r15
+  800929:	5d                   	pop    %rbp
+  80092a:	c3                   	ret
+
+000000000080092b <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  80092b:	55                   	push   %rbp
+  80092c:	48 89 e5             	mov    %rsp,%rbp
+  80092f:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800936:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800936 <cprintf+0xb>
+  80093d:	49 bb 0a 87 00 00 00 	movabs $0x870a,%r11
+  800944:	00 00 00 
+  800947:	4d 01 da             	add    %r11,%r10
+  80094a:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800951:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800958:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80095f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800966:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80096d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800974:	84 c0                	test   %al,%al
+  800976:	74 20                	je     800998 <cprintf+0x6d>
+  800978:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80097c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800980:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800984:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800988:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80098c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800990:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800994:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800998:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80099f:	00 00 00 
+  8009a2:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8009a9:	00 00 00 
+  8009ac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8009b0:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8009b7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8009be:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8009c5:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8009cc:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8009d3:	48 8b 06             	mov    (%rsi),%rax
+  8009d6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8009da:	48 89 01             	mov    %rax,(%rcx)
+  8009dd:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8009e1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8009e5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8009e9:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8009f0:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8009f7:	48 89 d6             	mov    %rdx,%rsi
+  8009fa:	48 89 c7             	mov    %rax,%rdi
+  8009fd:	48 b8 0b 78 ff ff ff 	movabs $0xffffffffffff780b,%rax
+  800a04:	ff ff ff 
+  800a07:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800a0b:	ff d0                	call   *%rax
+  800a0d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800a13:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800a19:	c9                   	leave
+  800a1a:	c3                   	ret
+
+0000000000800a1b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800a1b:	55                   	push   %rbp
+  800a1c:	48 89 e5             	mov    %rsp,%rbp
+  800a1f:	53                   	push   %rbx
+  800a20:	48 83 ec 38          	sub    $0x38,%rsp
+  800a24:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800a24 <printnum+0x9>
+  800a2b:	49 bb 1c 86 00 00 00 	movabs $0x861c,%r11
+  800a32:	00 00 00 
+  800a35:	4c 01 db             	add    %r11,%rbx
+  800a38:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a3c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800a40:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800a44:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800a47:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800a4b:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800a4f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800a52:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800a56:	72 58                	jb     800ab0 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800a58:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800a5b:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800a5e:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800a61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800a65:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a6a:	48 f7 f6             	div    %rsi
+  800a6d:	49 89 c2             	mov    %rax,%r10
+  800a70:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800a73:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800a76:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800a7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a7e:	41 89 c9             	mov    %ecx,%r9d
+  800a81:	41 89 f8             	mov    %edi,%r8d
+  800a84:	89 d1                	mov    %edx,%ecx
+  800a86:	4c 89 d2             	mov    %r10,%rdx
+  800a89:	48 89 c7             	mov    %rax,%rdi
+  800a8c:	48 b8 db 79 ff ff ff 	movabs $0xffffffffffff79db,%rax
+  800a93:	ff ff ff 
+  800a96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a9a:	ff d0                	call   *%rax
+  800a9c:	eb 1c                	jmp    800aba <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800a9e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800aa2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800aa5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800aa9:	48 89 d6             	mov    %rdx,%rsi
+  800aac:	89 c7                	mov    %eax,%edi
+  800aae:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800ab0:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800ab4:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800ab8:	7f e4                	jg     800a9e <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800aba:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800abd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ac6:	48 f7 f1             	div    %rcx
+  800ac9:	48 b8 c7 e1 ff ff ff 	movabs $0xffffffffffffe1c7,%rax
+  800ad0:	ff ff ff 
+  800ad3:	48 01 d8             	add    %rbx,%rax
+  800ad6:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800ada:	0f be c0             	movsbl %al,%eax
+  800add:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ae1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800ae5:	48 89 d6             	mov    %rdx,%rsi
+  800ae8:	89 c7                	mov    %eax,%edi
+  800aea:	ff d1                	call   *%rcx
+}
+  800aec:	90                   	nop
+  800aed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800af1:	c9                   	leave
+  800af2:	c3                   	ret
+
+0000000000800af3 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800af3:	55                   	push   %rbp
+  800af4:	48 89 e5             	mov    %rsp,%rbp
+  800af7:	48 83 ec 20          	sub    $0x20,%rsp
+  800afb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800afb <getuint+0x8>
+  800b02:	49 bb 45 85 00 00 00 	movabs $0x8545,%r11
+  800b09:	00 00 00 
+  800b0c:	4c 01 d8             	add    %r11,%rax
+  800b0f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b13:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800b16:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800b1a:	7e 4f                	jle    800b6b <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800b1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b20:	8b 00                	mov    (%rax),%eax
+  800b22:	83 f8 2f             	cmp    $0x2f,%eax
+  800b25:	77 24                	ja     800b4b <getuint+0x58>
+  800b27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b2b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b33:	8b 00                	mov    (%rax),%eax
+  800b35:	89 c0                	mov    %eax,%eax
+  800b37:	48 01 d0             	add    %rdx,%rax
+  800b3a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b3e:	8b 12                	mov    (%rdx),%edx
+  800b40:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b43:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b47:	89 0a                	mov    %ecx,(%rdx)
+  800b49:	eb 14                	jmp    800b5f <getuint+0x6c>
+  800b4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b53:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b57:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b5b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b5f:	48 8b 00             	mov    (%rax),%rax
+  800b62:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b66:	e9 9d 00 00 00       	jmp    800c08 <getuint+0x115>
+	else if (lflag)
+  800b6b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800b6f:	74 4c                	je     800bbd <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800b71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b75:	8b 00                	mov    (%rax),%eax
+  800b77:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7a:	77 24                	ja     800ba0 <getuint+0xad>
+  800b7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b80:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b88:	8b 00                	mov    (%rax),%eax
+  800b8a:	89 c0                	mov    %eax,%eax
+  800b8c:	48 01 d0             	add    %rdx,%rax
+  800b8f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b93:	8b 12                	mov    (%rdx),%edx
+  800b95:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b98:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b9c:	89 0a                	mov    %ecx,(%rdx)
+  800b9e:	eb 14                	jmp    800bb4 <getuint+0xc1>
+  800ba0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ba8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bb0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bb4:	48 8b 00             	mov    (%rax),%rax
+  800bb7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800bbb:	eb 4b                	jmp    800c08 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800bbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc1:	8b 00                	mov    (%rax),%eax
+  800bc3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc6:	77 24                	ja     800bec <getuint+0xf9>
+  800bc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bcc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800bd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bd4:	8b 00                	mov    (%rax),%eax
+  800bd6:	89 c0                	mov    %eax,%eax
+  800bd8:	48 01 d0             	add    %rdx,%rax
+  800bdb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bdf:	8b 12                	mov    (%rdx),%edx
+  800be1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800be4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800be8:	89 0a                	mov    %ecx,(%rdx)
+  800bea:	eb 14                	jmp    800c00 <getuint+0x10d>
+  800bec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bf4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bf8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bfc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c00:	8b 00                	mov    (%rax),%eax
+  800c02:	89 c0                	mov    %eax,%eax
+  800c04:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800c08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800c0c:	c9                   	leave
+  800c0d:	c3                   	ret
+
+0000000000800c0e <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800c0e:	55                   	push   %rbp
+  800c0f:	48 89 e5             	mov    %rsp,%rbp
+  800c12:	48 83 ec 20          	sub    $0x20,%rsp
+  800c16:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c16 <printfloat+0x8>
+  800c1d:	49 bb 2a 84 00 00 00 	movabs $0x842a,%r11
+  800c24:	00 00 00 
+  800c27:	4c 01 d8             	add    %r11,%rax
+  800c2a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800c2e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800c32:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800c36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c3a:	48 85 c0             	test   %rax,%rax
+  800c3d:	79 12                	jns    800c51 <printfloat+0x43>
+		putch('-',putdat);
+  800c3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c43:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800c47:	48 89 c6             	mov    %rax,%rsi
+  800c4a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c4f:	ff d2                	call   *%rdx
+	
+}
+  800c51:	90                   	nop
+  800c52:	c9                   	leave
+  800c53:	c3                   	ret
+
+0000000000800c54 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800c54:	55                   	push   %rbp
+  800c55:	48 89 e5             	mov    %rsp,%rbp
+  800c58:	48 83 ec 20          	sub    $0x20,%rsp
+  800c5c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800c5c <getint+0x8>
+  800c63:	49 bb e4 83 00 00 00 	movabs $0x83e4,%r11
+  800c6a:	00 00 00 
+  800c6d:	4c 01 d8             	add    %r11,%rax
+  800c70:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c74:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800c77:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800c7b:	7e 4f                	jle    800ccc <getint+0x78>
+		x=va_arg(*ap, long long);
+  800c7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c81:	8b 00                	mov    (%rax),%eax
+  800c83:	83 f8 2f             	cmp    $0x2f,%eax
+  800c86:	77 24                	ja     800cac <getint+0x58>
+  800c88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c8c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c94:	8b 00                	mov    (%rax),%eax
+  800c96:	89 c0                	mov    %eax,%eax
+  800c98:	48 01 d0             	add    %rdx,%rax
+  800c9b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c9f:	8b 12                	mov    (%rdx),%edx
+  800ca1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ca4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ca8:	89 0a                	mov    %ecx,(%rdx)
+  800caa:	eb 14                	jmp    800cc0 <getint+0x6c>
+  800cac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cb0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800cb4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800cb8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cbc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800cc0:	48 8b 00             	mov    (%rax),%rax
+  800cc3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800cc7:	e9 9d 00 00 00       	jmp    800d69 <getint+0x115>
+	else if (lflag)
+  800ccc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800cd0:	74 4c                	je     800d1e <getint+0xca>
+		x=va_arg(*ap, long);
+  800cd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cd6:	8b 00                	mov    (%rax),%eax
+  800cd8:	83 f8 2f             	cmp    $0x2f,%eax
+  800cdb:	77 24                	ja     800d01 <getint+0xad>
+  800cdd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ce5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ce9:	8b 00                	mov    (%rax),%eax
+  800ceb:	89 c0                	mov    %eax,%eax
+  800ced:	48 01 d0             	add    %rdx,%rax
+  800cf0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cf4:	8b 12                	mov    (%rdx),%edx
+  800cf6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800cf9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800cfd:	89 0a                	mov    %ecx,(%rdx)
+  800cff:	eb 14                	jmp    800d15 <getint+0xc1>
+  800d01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d05:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d09:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d0d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d11:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d15:	48 8b 00             	mov    (%rax),%rax
+  800d18:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800d1c:	eb 4b                	jmp    800d69 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800d1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d22:	8b 00                	mov    (%rax),%eax
+  800d24:	83 f8 2f             	cmp    $0x2f,%eax
+  800d27:	77 24                	ja     800d4d <getint+0xf9>
+  800d29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d2d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d35:	8b 00                	mov    (%rax),%eax
+  800d37:	89 c0                	mov    %eax,%eax
+  800d39:	48 01 d0             	add    %rdx,%rax
+  800d3c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d40:	8b 12                	mov    (%rdx),%edx
+  800d42:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800d45:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d49:	89 0a                	mov    %ecx,(%rdx)
+  800d4b:	eb 14                	jmp    800d61 <getint+0x10d>
+  800d4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800d55:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800d59:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d5d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800d61:	8b 00                	mov    (%rax),%eax
+  800d63:	48 98                	cltq
+  800d65:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800d69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800d6d:	c9                   	leave
+  800d6e:	c3                   	ret
+
+0000000000800d6f <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+  800d73:	41 57                	push   %r15
+  800d75:	41 55                	push   %r13
+  800d77:	41 54                	push   %r12
+  800d79:	53                   	push   %rbx
+  800d7a:	48 83 ec 60          	sub    $0x60,%rsp
+  800d7e:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800d7e <vprintfmt+0xf>
+  800d85:	49 bb c2 82 00 00 00 	movabs $0x82c2,%r11
+  800d8c:	00 00 00 
+  800d8f:	4d 01 dc             	add    %r11,%r12
+  800d92:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800d96:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800d9a:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d9e:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800da2:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800da9:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800dad:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800db1:	48 8b 06             	mov    (%rsi),%rax
+  800db4:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800db8:	48 89 01             	mov    %rax,(%rcx)
+  800dbb:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dbf:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800dc3:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800dc7:	eb 17                	jmp    800de0 <vprintfmt+0x71>
+			if (ch == '\0')
+  800dc9:	85 db                	test   %ebx,%ebx
+  800dcb:	0f 84 97 05 00 00    	je     801368 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800dd1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dd5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dd9:	48 89 c6             	mov    %rax,%rsi
+  800ddc:	89 df                	mov    %ebx,%edi
+  800dde:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800de0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800de4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800de8:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800dec:	0f b6 00             	movzbl (%rax),%eax
+  800def:	0f b6 d8             	movzbl %al,%ebx
+  800df2:	83 fb 25             	cmp    $0x25,%ebx
+  800df5:	75 d2                	jne    800dc9 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800df7:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800dfb:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800e02:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800e09:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800e10:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800e17:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e1b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e1f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800e23:	0f b6 00             	movzbl (%rax),%eax
+  800e26:	0f b6 d8             	movzbl %al,%ebx
+  800e29:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800e2c:	83 f8 55             	cmp    $0x55,%eax
+  800e2f:	0f 87 00 05 00 00    	ja     801335 <vprintfmt+0x5c6>
+  800e35:	89 c0                	mov    %eax,%eax
+  800e37:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800e3e:	00 
+  800e3f:	48 8d 05 ea 63 00 00 	lea    0x63ea(%rip),%rax        # 807230 <.LC18+0xc>
+  800e46:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800e4a:	48 8d 15 df 63 00 00 	lea    0x63df(%rip),%rdx        # 807230 <.LC18+0xc>
+  800e51:	48 01 d0             	add    %rdx,%rax
+  800e54:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800e56:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800e5a:	eb bb                	jmp    800e17 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800e5c:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800e60:	eb b5                	jmp    800e17 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800e62:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800e69:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800e6c:	89 d0                	mov    %edx,%eax
+  800e6e:	c1 e0 02             	shl    $0x2,%eax
+  800e71:	01 d0                	add    %edx,%eax
+  800e73:	01 c0                	add    %eax,%eax
+  800e75:	01 d8                	add    %ebx,%eax
+  800e77:	83 e8 30             	sub    $0x30,%eax
+  800e7a:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800e7d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e81:	0f b6 00             	movzbl (%rax),%eax
+  800e84:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800e87:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e8a:	7e 60                	jle    800eec <vprintfmt+0x17d>
+  800e8c:	83 fb 39             	cmp    $0x39,%ebx
+  800e8f:	7f 5b                	jg     800eec <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800e91:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800e96:	eb d1                	jmp    800e69 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800e98:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800e9e:	77 17                	ja     800eb7 <vprintfmt+0x148>
+  800ea0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ea4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ea7:	89 d2                	mov    %edx,%edx
+  800ea9:	48 01 d0             	add    %rdx,%rax
+  800eac:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800eaf:	83 c2 08             	add    $0x8,%edx
+  800eb2:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800eb5:	eb 0c                	jmp    800ec3 <vprintfmt+0x154>
+  800eb7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ebb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ebf:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ec3:	8b 00                	mov    (%rax),%eax
+  800ec5:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800ec8:	eb 23                	jmp    800eed <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800eca:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ece:	0f 89 43 ff ff ff    	jns    800e17 <vprintfmt+0xa8>
+				width = 0;
+  800ed4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800edb:	e9 37 ff ff ff       	jmp    800e17 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800ee0:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800ee7:	e9 2b ff ff ff       	jmp    800e17 <vprintfmt+0xa8>
+			goto process_precision;
+  800eec:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800eed:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ef1:	0f 89 20 ff ff ff    	jns    800e17 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800ef7:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800efa:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800efd:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800f04:	e9 0e ff ff ff       	jmp    800e17 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800f09:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800f0d:	e9 05 ff ff ff       	jmp    800e17 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800f12:	83 fb 39             	cmp    $0x39,%ebx
+  800f15:	7f 0b                	jg     800f22 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800f17:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800f1a:	c1 e0 08             	shl    $0x8,%eax
+  800f1d:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800f20:	eb 21                	jmp    800f43 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800f22:	83 fb 60             	cmp    $0x60,%ebx
+  800f25:	7e 10                	jle    800f37 <vprintfmt+0x1c8>
+  800f27:	83 fb 66             	cmp    $0x66,%ebx
+  800f2a:	7f 0b                	jg     800f37 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800f2c:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800f2f:	c1 e0 08             	shl    $0x8,%eax
+  800f32:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800f35:	eb 0c                	jmp    800f43 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800f37:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800f3e:	e9 04 01 00 00       	jmp    801047 <vprintfmt+0x2d8>
+  800f43:	e9 ff 00 00 00       	jmp    801047 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800f48:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800f4e:	77 17                	ja     800f67 <vprintfmt+0x1f8>
+  800f50:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f54:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f57:	89 d2                	mov    %edx,%edx
+  800f59:	48 01 d0             	add    %rdx,%rax
+  800f5c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f5f:	83 c2 08             	add    $0x8,%edx
+  800f62:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f65:	eb 0c                	jmp    800f73 <vprintfmt+0x204>
+  800f67:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f6b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f6f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f73:	8b 00                	mov    (%rax),%eax
+  800f75:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800f79:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800f7d:	48 89 d6             	mov    %rdx,%rsi
+  800f80:	89 c7                	mov    %eax,%edi
+  800f82:	ff d1                	call   *%rcx
+			break;
+  800f84:	e9 da 03 00 00       	jmp    801363 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800f89:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f8f:	77 17                	ja     800fa8 <vprintfmt+0x239>
+  800f91:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f95:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f98:	89 d2                	mov    %edx,%edx
+  800f9a:	48 01 d0             	add    %rdx,%rax
+  800f9d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800fa0:	83 c2 08             	add    $0x8,%edx
+  800fa3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800fa6:	eb 0c                	jmp    800fb4 <vprintfmt+0x245>
+  800fa8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800fac:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800fb0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800fb4:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800fb6:	85 db                	test   %ebx,%ebx
+  800fb8:	79 02                	jns    800fbc <vprintfmt+0x24d>
+				err = -err;
+  800fba:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800fbc:	83 fb 15             	cmp    $0x15,%ebx
+  800fbf:	7f 19                	jg     800fda <vprintfmt+0x26b>
+  800fc1:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800fc8:	00 00 00 
+  800fcb:	48 63 c3             	movslq %ebx,%rax
+  800fce:	4c 01 e2             	add    %r12,%rdx
+  800fd1:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800fd5:	4d 85 ed             	test   %r13,%r13
+  800fd8:	75 36                	jne    801010 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800fda:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800fde:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fe2:	89 d9                	mov    %ebx,%ecx
+  800fe4:	48 ba d8 e1 ff ff ff 	movabs $0xffffffffffffe1d8,%rdx
+  800feb:	ff ff ff 
+  800fee:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800ff2:	48 89 c7             	mov    %rax,%rdi
+  800ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ffa:	49 b8 36 83 ff ff ff 	movabs $0xffffffffffff8336,%r8
+  801001:	ff ff ff 
+  801004:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801008:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  80100b:	e9 53 03 00 00       	jmp    801363 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  801010:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801014:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801018:	4c 89 e9             	mov    %r13,%rcx
+  80101b:	48 ba e1 e1 ff ff ff 	movabs $0xffffffffffffe1e1,%rdx
+  801022:	ff ff ff 
+  801025:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  801029:	48 89 c7             	mov    %rax,%rdi
+  80102c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801031:	49 b8 36 83 ff ff ff 	movabs $0xffffffffffff8336,%r8
+  801038:	ff ff ff 
+  80103b:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  80103f:	41 ff d0             	call   *%r8
+			break;
+  801042:	e9 1c 03 00 00       	jmp    801363 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  801047:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80104a:	83 f8 2f             	cmp    $0x2f,%eax
+  80104d:	77 17                	ja     801066 <vprintfmt+0x2f7>
+  80104f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801053:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801056:	89 d2                	mov    %edx,%edx
+  801058:	48 01 d0             	add    %rdx,%rax
+  80105b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80105e:	83 c2 08             	add    $0x8,%edx
+  801061:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801064:	eb 0c                	jmp    801072 <vprintfmt+0x303>
+  801066:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80106a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80106e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801072:	4c 8b 28             	mov    (%rax),%r13
+  801075:	4d 85 ed             	test   %r13,%r13
+  801078:	75 0e                	jne    801088 <vprintfmt+0x319>
+				p = "(null)";
+  80107a:	48 b8 e4 e1 ff ff ff 	movabs $0xffffffffffffe1e4,%rax
+  801081:	ff ff ff 
+  801084:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  801088:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80108c:	0f 8e 84 00 00 00    	jle    801116 <vprintfmt+0x3a7>
+  801092:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  801096:	74 7e                	je     801116 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801098:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80109b:	48 98                	cltq
+  80109d:	48 89 c6             	mov    %rax,%rsi
+  8010a0:	4c 89 ef             	mov    %r13,%rdi
+  8010a3:	4d 89 e7             	mov    %r12,%r15
+  8010a6:	48 b8 5b 86 ff ff ff 	movabs $0xffffffffffff865b,%rax
+  8010ad:	ff ff ff 
+  8010b0:	4c 01 e0             	add    %r12,%rax
+  8010b3:	ff d0                	call   *%rax
+  8010b5:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  8010b8:	eb 17                	jmp    8010d1 <vprintfmt+0x362>
+					putch(padc, putdat);
+  8010ba:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  8010be:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8010c2:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8010c6:	48 89 d6             	mov    %rdx,%rsi
+  8010c9:	89 c7                	mov    %eax,%edi
+  8010cb:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8010cd:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8010d1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8010d5:	7f e3                	jg     8010ba <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8010d7:	eb 3d                	jmp    801116 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8010d9:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  8010dd:	74 1e                	je     8010fd <vprintfmt+0x38e>
+  8010df:	83 fb 1f             	cmp    $0x1f,%ebx
+  8010e2:	7e 05                	jle    8010e9 <vprintfmt+0x37a>
+  8010e4:	83 fb 7e             	cmp    $0x7e,%ebx
+  8010e7:	7e 14                	jle    8010fd <vprintfmt+0x38e>
+					putch('?', putdat);
+  8010e9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010ed:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010f1:	48 89 c6             	mov    %rax,%rsi
+  8010f4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8010f9:	ff d2                	call   *%rdx
+  8010fb:	eb 15                	jmp    801112 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  8010fd:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801100:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  801103:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801107:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80110b:	48 89 c6             	mov    %rax,%rsi
+  80110e:	89 cf                	mov    %ecx,%edi
+  801110:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801112:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801116:	4c 89 e8             	mov    %r13,%rax
+  801119:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  80111d:	0f b6 00             	movzbl (%rax),%eax
+  801120:	0f be d8             	movsbl %al,%ebx
+  801123:	85 db                	test   %ebx,%ebx
+  801125:	74 28                	je     80114f <vprintfmt+0x3e0>
+  801127:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80112b:	78 ac                	js     8010d9 <vprintfmt+0x36a>
+  80112d:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801131:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801135:	79 a2                	jns    8010d9 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  801137:	eb 16                	jmp    80114f <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  801139:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80113d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801141:	48 89 c6             	mov    %rax,%rsi
+  801144:	bf 20 00 00 00       	mov    $0x20,%edi
+  801149:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  80114b:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80114f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801153:	7f e4                	jg     801139 <vprintfmt+0x3ca>
+			break;
+  801155:	e9 09 02 00 00       	jmp    801363 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80115a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80115e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801162:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801166:	0f b6 00             	movzbl (%rax),%eax
+  801169:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  80116c:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  80116d:	83 fb 2f             	cmp    $0x2f,%ebx
+  801170:	0f 8e ac fd ff ff    	jle    800f22 <vprintfmt+0x1b3>
+  801176:	e9 97 fd ff ff       	jmp    800f12 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  80117b:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80117f:	be 03 00 00 00       	mov    $0x3,%esi
+  801184:	48 89 c7             	mov    %rax,%rdi
+  801187:	48 b8 14 7c ff ff ff 	movabs $0xffffffffffff7c14,%rax
+  80118e:	ff ff ff 
+  801191:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801195:	ff d0                	call   *%rax
+  801197:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  80119b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80119f:	48 85 c0             	test   %rax,%rax
+  8011a2:	79 1d                	jns    8011c1 <vprintfmt+0x452>
+				putch('-', putdat);
+  8011a4:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011a8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011ac:	48 89 c6             	mov    %rax,%rsi
+  8011af:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8011b4:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8011b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011ba:	48 f7 d8             	neg    %rax
+  8011bd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8011c1:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8011c8:	e9 de 00 00 00       	jmp    8012ab <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8011cd:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011d1:	be 03 00 00 00       	mov    $0x3,%esi
+  8011d6:	48 89 c7             	mov    %rax,%rdi
+  8011d9:	48 b8 b3 7a ff ff ff 	movabs $0xffffffffffff7ab3,%rax
+  8011e0:	ff ff ff 
+  8011e3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011e7:	ff d0                	call   *%rax
+  8011e9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  8011ed:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8011f4:	e9 b2 00 00 00       	jmp    8012ab <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8011f9:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011fd:	be 03 00 00 00       	mov    $0x3,%esi
+  801202:	48 89 c7             	mov    %rax,%rdi
+  801205:	48 b8 b3 7a ff ff ff 	movabs $0xffffffffffff7ab3,%rax
+  80120c:	ff ff ff 
+  80120f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801213:	ff d0                	call   *%rax
+  801215:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801219:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801220:	e9 86 00 00 00       	jmp    8012ab <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801225:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801229:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80122d:	48 89 c6             	mov    %rax,%rsi
+  801230:	bf 30 00 00 00       	mov    $0x30,%edi
+  801235:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801237:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80123b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80123f:	48 89 c6             	mov    %rax,%rsi
+  801242:	bf 78 00 00 00       	mov    $0x78,%edi
+  801247:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801249:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80124c:	83 f8 2f             	cmp    $0x2f,%eax
+  80124f:	77 17                	ja     801268 <vprintfmt+0x4f9>
+  801251:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801255:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801258:	89 d2                	mov    %edx,%edx
+  80125a:	48 01 d0             	add    %rdx,%rax
+  80125d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801260:	83 c2 08             	add    $0x8,%edx
+  801263:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801266:	eb 0c                	jmp    801274 <vprintfmt+0x505>
+  801268:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80126c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801270:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801274:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801277:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80127b:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801282:	eb 27                	jmp    8012ab <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801284:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801288:	be 03 00 00 00       	mov    $0x3,%esi
+  80128d:	48 89 c7             	mov    %rax,%rdi
+  801290:	48 b8 b3 7a ff ff ff 	movabs $0xffffffffffff7ab3,%rax
+  801297:	ff ff ff 
+  80129a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80129e:	ff d0                	call   *%rax
+  8012a0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8012a4:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8012ab:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8012b0:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8012b3:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8012b6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8012ba:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8012be:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8012c2:	45 89 c1             	mov    %r8d,%r9d
+  8012c5:	41 89 f8             	mov    %edi,%r8d
+  8012c8:	48 89 c7             	mov    %rax,%rdi
+  8012cb:	48 b8 db 79 ff ff ff 	movabs $0xffffffffffff79db,%rax
+  8012d2:	ff ff ff 
+  8012d5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012d9:	ff d0                	call   *%rax
+			break;
+  8012db:	e9 83 00 00 00       	jmp    801363 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8012e0:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8012e4:	be 03 00 00 00       	mov    $0x3,%esi
+  8012e9:	48 89 c7             	mov    %rax,%rdi
+  8012ec:	48 b8 b3 7a ff ff ff 	movabs $0xffffffffffff7ab3,%rax
+  8012f3:	ff ff ff 
+  8012f6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012fa:	ff d0                	call   *%rax
+  8012fc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801300:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801304:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801308:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80130c:	48 89 ce             	mov    %rcx,%rsi
+  80130f:	48 89 c7             	mov    %rax,%rdi
+  801312:	48 b8 ce 7b ff ff ff 	movabs $0xffffffffffff7bce,%rax
+  801319:	ff ff ff 
+  80131c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801320:	ff d0                	call   *%rax
+	
+			break;
+  801322:	eb 3f                	jmp    801363 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801324:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801328:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80132c:	48 89 c6             	mov    %rax,%rsi
+  80132f:	89 df                	mov    %ebx,%edi
+  801331:	ff d2                	call   *%rdx
+			break;
+  801333:	eb 2e                	jmp    801363 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801335:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801339:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80133d:	48 89 c6             	mov    %rax,%rsi
+  801340:	bf 25 00 00 00       	mov    $0x25,%edi
+  801345:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801347:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80134c:	eb 05                	jmp    801353 <vprintfmt+0x5e4>
+  80134e:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801353:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801357:	48 83 e8 01          	sub    $0x1,%rax
+  80135b:	0f b6 00             	movzbl (%rax),%eax
+  80135e:	3c 25                	cmp    $0x25,%al
+  801360:	75 ec                	jne    80134e <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801362:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801363:	e9 78 fa ff ff       	jmp    800de0 <vprintfmt+0x71>
+				return;
+  801368:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801369:	48 83 c4 60          	add    $0x60,%rsp
+  80136d:	5b                   	pop    %rbx
+  80136e:	41 5c                	pop    %r12
+  801370:	41 5d                	pop    %r13
+  801372:	41 5f                	pop    %r15
+  801374:	5d                   	pop    %rbp
+  801375:	c3                   	ret
+
+0000000000801376 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801376:	55                   	push   %rbp
+  801377:	48 89 e5             	mov    %rsp,%rbp
+  80137a:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801381:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801381 <printfmt+0xb>
+  801388:	49 bb bf 7c 00 00 00 	movabs $0x7cbf,%r11
+  80138f:	00 00 00 
+  801392:	4d 01 da             	add    %r11,%r10
+  801395:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80139c:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8013a3:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8013aa:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8013b1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8013b8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8013bf:	84 c0                	test   %al,%al
+  8013c1:	74 20                	je     8013e3 <printfmt+0x6d>
+  8013c3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8013c7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8013cb:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8013cf:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8013d3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8013d7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8013db:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8013df:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8013e3:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8013ea:	00 00 00 
+  8013ed:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8013f4:	00 00 00 
+  8013f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8013fb:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801402:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801409:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801410:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801417:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80141e:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801425:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80142c:	48 89 c7             	mov    %rax,%rdi
+  80142f:	48 b8 2f 7d ff ff ff 	movabs $0xffffffffffff7d2f,%rax
+  801436:	ff ff ff 
+  801439:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80143d:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  80143f:	90                   	nop
+  801440:	c9                   	leave
+  801441:	c3                   	ret
+
+0000000000801442 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801442:	55                   	push   %rbp
+  801443:	48 89 e5             	mov    %rsp,%rbp
+  801446:	48 83 ec 10          	sub    $0x10,%rsp
+  80144a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80144a <sprintputch+0x8>
+  801451:	49 bb f6 7b 00 00 00 	movabs $0x7bf6,%r11
+  801458:	00 00 00 
+  80145b:	4c 01 d8             	add    %r11,%rax
+  80145e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801461:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801465:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801469:	8b 40 10             	mov    0x10(%rax),%eax
+  80146c:	8d 50 01             	lea    0x1(%rax),%edx
+  80146f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801473:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801476:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80147a:	48 8b 10             	mov    (%rax),%rdx
+  80147d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801481:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801485:	48 39 c2             	cmp    %rax,%rdx
+  801488:	73 17                	jae    8014a1 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80148a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80148e:	48 8b 00             	mov    (%rax),%rax
+  801491:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801495:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801499:	48 89 0a             	mov    %rcx,(%rdx)
+  80149c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80149f:	88 10                	mov    %dl,(%rax)
+}
+  8014a1:	90                   	nop
+  8014a2:	c9                   	leave
+  8014a3:	c3                   	ret
+
+00000000008014a4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8014a4:	55                   	push   %rbp
+  8014a5:	48 89 e5             	mov    %rsp,%rbp
+  8014a8:	53                   	push   %rbx
+  8014a9:	48 83 ec 58          	sub    $0x58,%rsp
+  8014ad:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014ad <vsnprintf+0x9>
+  8014b4:	49 bb 93 7b 00 00 00 	movabs $0x7b93,%r11
+  8014bb:	00 00 00 
+  8014be:	4c 01 d8             	add    %r11,%rax
+  8014c1:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8014c5:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8014c8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8014cc:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8014d0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014d4:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8014d8:	48 8b 0e             	mov    (%rsi),%rcx
+  8014db:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8014df:	48 89 0a             	mov    %rcx,(%rdx)
+  8014e2:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8014e6:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8014ea:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8014ee:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8014f2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8014f6:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8014f9:	48 63 d2             	movslq %edx,%rdx
+  8014fc:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801500:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801504:	48 01 ca             	add    %rcx,%rdx
+  801507:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80150b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801512:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801517:	74 06                	je     80151f <vsnprintf+0x7b>
+  801519:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  80151d:	7f 07                	jg     801526 <vsnprintf+0x82>
+		return -E_INVAL;
+  80151f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801524:	eb 34                	jmp    80155a <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801526:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  80152a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80152e:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801532:	48 bf 02 84 ff ff ff 	movabs $0xffffffffffff8402,%rdi
+  801539:	ff ff ff 
+  80153c:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801540:	49 b8 2f 7d ff ff ff 	movabs $0xffffffffffff7d2f,%r8
+  801547:	ff ff ff 
+  80154a:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80154e:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801550:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801554:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801557:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80155a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80155e:	c9                   	leave
+  80155f:	c3                   	ret
+
+0000000000801560 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801560:	55                   	push   %rbp
+  801561:	48 89 e5             	mov    %rsp,%rbp
+  801564:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80156b:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80156b <snprintf+0xb>
+  801572:	49 bb d5 7a 00 00 00 	movabs $0x7ad5,%r11
+  801579:	00 00 00 
+  80157c:	4d 01 da             	add    %r11,%r10
+  80157f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801586:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80158c:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801593:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80159a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8015a1:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8015a8:	84 c0                	test   %al,%al
+  8015aa:	74 20                	je     8015cc <snprintf+0x6c>
+  8015ac:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8015b0:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8015b4:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8015b8:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8015bc:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8015c0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8015c4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8015c8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8015cc:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8015d3:	00 00 00 
+  8015d6:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8015dd:	00 00 00 
+  8015e0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8015e4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8015eb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8015f2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8015f9:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801600:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801607:	48 8b 06             	mov    (%rsi),%rax
+  80160a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80160e:	48 89 01             	mov    %rax,(%rcx)
+  801611:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801615:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801619:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80161d:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801624:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80162b:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801631:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801638:	48 89 c7             	mov    %rax,%rdi
+  80163b:	48 b8 64 84 ff ff ff 	movabs $0xffffffffffff8464,%rax
+  801642:	ff ff ff 
+  801645:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801649:	ff d0                	call   *%rax
+  80164b:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801651:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801657:	c9                   	leave
+  801658:	c3                   	ret
+
+0000000000801659 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801659:	55                   	push   %rbp
+  80165a:	48 89 e5             	mov    %rsp,%rbp
+  80165d:	48 83 ec 18          	sub    $0x18,%rsp
+  801661:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801661 <strlen+0x8>
+  801668:	49 bb df 79 00 00 00 	movabs $0x79df,%r11
+  80166f:	00 00 00 
+  801672:	4c 01 d8             	add    %r11,%rax
+  801675:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801679:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801680:	eb 09                	jmp    80168b <strlen+0x32>
+		n++;
+  801682:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801686:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80168b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80168f:	0f b6 00             	movzbl (%rax),%eax
+  801692:	84 c0                	test   %al,%al
+  801694:	75 ec                	jne    801682 <strlen+0x29>
+	return n;
+  801696:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801699:	c9                   	leave
+  80169a:	c3                   	ret
+
+000000000080169b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80169b:	55                   	push   %rbp
+  80169c:	48 89 e5             	mov    %rsp,%rbp
+  80169f:	48 83 ec 20          	sub    $0x20,%rsp
+  8016a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016a3 <strnlen+0x8>
+  8016aa:	49 bb 9d 79 00 00 00 	movabs $0x799d,%r11
+  8016b1:	00 00 00 
+  8016b4:	4c 01 d8             	add    %r11,%rax
+  8016b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016bb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8016bf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8016c6:	eb 0e                	jmp    8016d6 <strnlen+0x3b>
+		n++;
+  8016c8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8016cc:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8016d1:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8016d6:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8016db:	74 0b                	je     8016e8 <strnlen+0x4d>
+  8016dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e1:	0f b6 00             	movzbl (%rax),%eax
+  8016e4:	84 c0                	test   %al,%al
+  8016e6:	75 e0                	jne    8016c8 <strnlen+0x2d>
+	return n;
+  8016e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+
+00000000008016ed <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8016ed:	55                   	push   %rbp
+  8016ee:	48 89 e5             	mov    %rsp,%rbp
+  8016f1:	48 83 ec 20          	sub    $0x20,%rsp
+  8016f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016f5 <strcpy+0x8>
+  8016fc:	49 bb 4b 79 00 00 00 	movabs $0x794b,%r11
+  801703:	00 00 00 
+  801706:	4c 01 d8             	add    %r11,%rax
+  801709:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80170d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801711:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801715:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801719:	90                   	nop
+  80171a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80171e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801722:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801726:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80172a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80172e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801732:	0f b6 12             	movzbl (%rdx),%edx
+  801735:	88 10                	mov    %dl,(%rax)
+  801737:	0f b6 00             	movzbl (%rax),%eax
+  80173a:	84 c0                	test   %al,%al
+  80173c:	75 dc                	jne    80171a <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  80173e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801742:	c9                   	leave
+  801743:	c3                   	ret
+
+0000000000801744 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801744:	55                   	push   %rbp
+  801745:	48 89 e5             	mov    %rsp,%rbp
+  801748:	53                   	push   %rbx
+  801749:	48 83 ec 20          	sub    $0x20,%rsp
+  80174d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80174d <strcat+0x9>
+  801754:	49 bb f3 78 00 00 00 	movabs $0x78f3,%r11
+  80175b:	00 00 00 
+  80175e:	4c 01 db             	add    %r11,%rbx
+  801761:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801765:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801769:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80176d:	48 89 c7             	mov    %rax,%rdi
+  801770:	48 b8 19 86 ff ff ff 	movabs $0xffffffffffff8619,%rax
+  801777:	ff ff ff 
+  80177a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80177e:	ff d0                	call   *%rax
+  801780:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801783:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801786:	48 63 d0             	movslq %eax,%rdx
+  801789:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80178d:	48 01 c2             	add    %rax,%rdx
+  801790:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801794:	48 89 c6             	mov    %rax,%rsi
+  801797:	48 89 d7             	mov    %rdx,%rdi
+  80179a:	48 b8 ad 86 ff ff ff 	movabs $0xffffffffffff86ad,%rax
+  8017a1:	ff ff ff 
+  8017a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8017a8:	ff d0                	call   *%rax
+	return dst;
+  8017aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8017ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017b2:	c9                   	leave
+  8017b3:	c3                   	ret
+
+00000000008017b4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8017b4:	55                   	push   %rbp
+  8017b5:	48 89 e5             	mov    %rsp,%rbp
+  8017b8:	48 83 ec 28          	sub    $0x28,%rsp
+  8017bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017bc <strncpy+0x8>
+  8017c3:	49 bb 84 78 00 00 00 	movabs $0x7884,%r11
+  8017ca:	00 00 00 
+  8017cd:	4c 01 d8             	add    %r11,%rax
+  8017d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017d4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017d8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8017dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017e0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8017e4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8017eb:	00 
+  8017ec:	eb 2a                	jmp    801818 <strncpy+0x64>
+		*dst++ = *src;
+  8017ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8017fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017fe:	0f b6 12             	movzbl (%rdx),%edx
+  801801:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801803:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801807:	0f b6 00             	movzbl (%rax),%eax
+  80180a:	84 c0                	test   %al,%al
+  80180c:	74 05                	je     801813 <strncpy+0x5f>
+			src++;
+  80180e:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801813:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801818:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181c:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801820:	72 cc                	jb     8017ee <strncpy+0x3a>
+	}
+	return ret;
+  801822:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801826:	c9                   	leave
+  801827:	c3                   	ret
+
+0000000000801828 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+  80182c:	48 83 ec 28          	sub    $0x28,%rsp
+  801830:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801830 <strlcpy+0x8>
+  801837:	49 bb 10 78 00 00 00 	movabs $0x7810,%r11
+  80183e:	00 00 00 
+  801841:	4c 01 d8             	add    %r11,%rax
+  801844:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801848:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80184c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801850:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801854:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801858:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80185d:	74 3d                	je     80189c <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  80185f:	eb 1d                	jmp    80187e <strlcpy+0x56>
+			*dst++ = *src++;
+  801861:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801865:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801869:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80186d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801871:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801875:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801879:	0f b6 12             	movzbl (%rdx),%edx
+  80187c:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80187e:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801883:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801888:	74 0b                	je     801895 <strlcpy+0x6d>
+  80188a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80188e:	0f b6 00             	movzbl (%rax),%eax
+  801891:	84 c0                	test   %al,%al
+  801893:	75 cc                	jne    801861 <strlcpy+0x39>
+		*dst = '\0';
+  801895:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801899:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80189c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018a0:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8018a4:	c9                   	leave
+  8018a5:	c3                   	ret
+
+00000000008018a6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8018a6:	55                   	push   %rbp
+  8018a7:	48 89 e5             	mov    %rsp,%rbp
+  8018aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8018ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018ae <strcmp+0x8>
+  8018b5:	49 bb 92 77 00 00 00 	movabs $0x7792,%r11
+  8018bc:	00 00 00 
+  8018bf:	4c 01 d8             	add    %r11,%rax
+  8018c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8018ca:	eb 0a                	jmp    8018d6 <strcmp+0x30>
+		p++, q++;
+  8018cc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018d1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8018d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018da:	0f b6 00             	movzbl (%rax),%eax
+  8018dd:	84 c0                	test   %al,%al
+  8018df:	74 12                	je     8018f3 <strcmp+0x4d>
+  8018e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e5:	0f b6 10             	movzbl (%rax),%edx
+  8018e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ec:	0f b6 00             	movzbl (%rax),%eax
+  8018ef:	38 c2                	cmp    %al,%dl
+  8018f1:	74 d9                	je     8018cc <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8018f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f7:	0f b6 00             	movzbl (%rax),%eax
+  8018fa:	0f b6 d0             	movzbl %al,%edx
+  8018fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801901:	0f b6 00             	movzbl (%rax),%eax
+  801904:	0f b6 c0             	movzbl %al,%eax
+  801907:	29 c2                	sub    %eax,%edx
+  801909:	89 d0                	mov    %edx,%eax
+}
+  80190b:	c9                   	leave
+  80190c:	c3                   	ret
+
+000000000080190d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80190d:	55                   	push   %rbp
+  80190e:	48 89 e5             	mov    %rsp,%rbp
+  801911:	48 83 ec 18          	sub    $0x18,%rsp
+  801915:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801915 <strncmp+0x8>
+  80191c:	49 bb 2b 77 00 00 00 	movabs $0x772b,%r11
+  801923:	00 00 00 
+  801926:	4c 01 d8             	add    %r11,%rax
+  801929:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80192d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801931:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801935:	eb 0f                	jmp    801946 <strncmp+0x39>
+		n--, p++, q++;
+  801937:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80193c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801941:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801946:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80194b:	74 1d                	je     80196a <strncmp+0x5d>
+  80194d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801951:	0f b6 00             	movzbl (%rax),%eax
+  801954:	84 c0                	test   %al,%al
+  801956:	74 12                	je     80196a <strncmp+0x5d>
+  801958:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80195c:	0f b6 10             	movzbl (%rax),%edx
+  80195f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801963:	0f b6 00             	movzbl (%rax),%eax
+  801966:	38 c2                	cmp    %al,%dl
+  801968:	74 cd                	je     801937 <strncmp+0x2a>
+	if (n == 0)
+  80196a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80196f:	75 07                	jne    801978 <strncmp+0x6b>
+		return 0;
+  801971:	ba 00 00 00 00       	mov    $0x0,%edx
+  801976:	eb 16                	jmp    80198e <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801978:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80197c:	0f b6 00             	movzbl (%rax),%eax
+  80197f:	0f b6 d0             	movzbl %al,%edx
+  801982:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801986:	0f b6 00             	movzbl (%rax),%eax
+  801989:	0f b6 c0             	movzbl %al,%eax
+  80198c:	29 c2                	sub    %eax,%edx
+}
+  80198e:	89 d0                	mov    %edx,%eax
+  801990:	c9                   	leave
+  801991:	c3                   	ret
+
+0000000000801992 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801992:	55                   	push   %rbp
+  801993:	48 89 e5             	mov    %rsp,%rbp
+  801996:	48 83 ec 10          	sub    $0x10,%rsp
+  80199a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80199a <strchr+0x8>
+  8019a1:	49 bb a6 76 00 00 00 	movabs $0x76a6,%r11
+  8019a8:	00 00 00 
+  8019ab:	4c 01 d8             	add    %r11,%rax
+  8019ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019b2:	89 f0                	mov    %esi,%eax
+  8019b4:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8019b7:	eb 17                	jmp    8019d0 <strchr+0x3e>
+		if (*s == c)
+  8019b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019bd:	0f b6 00             	movzbl (%rax),%eax
+  8019c0:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8019c3:	75 06                	jne    8019cb <strchr+0x39>
+			return (char *) s;
+  8019c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019c9:	eb 15                	jmp    8019e0 <strchr+0x4e>
+	for (; *s; s++)
+  8019cb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019d4:	0f b6 00             	movzbl (%rax),%eax
+  8019d7:	84 c0                	test   %al,%al
+  8019d9:	75 de                	jne    8019b9 <strchr+0x27>
+	return 0;
+  8019db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e0:	c9                   	leave
+  8019e1:	c3                   	ret
+
+00000000008019e2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8019e2:	55                   	push   %rbp
+  8019e3:	48 89 e5             	mov    %rsp,%rbp
+  8019e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8019ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019ea <strfind+0x8>
+  8019f1:	49 bb 56 76 00 00 00 	movabs $0x7656,%r11
+  8019f8:	00 00 00 
+  8019fb:	4c 01 d8             	add    %r11,%rax
+  8019fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a02:	89 f0                	mov    %esi,%eax
+  801a04:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801a07:	eb 11                	jmp    801a1a <strfind+0x38>
+		if (*s == c)
+  801a09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a0d:	0f b6 00             	movzbl (%rax),%eax
+  801a10:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801a13:	74 12                	je     801a27 <strfind+0x45>
+	for (; *s; s++)
+  801a15:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a1e:	0f b6 00             	movzbl (%rax),%eax
+  801a21:	84 c0                	test   %al,%al
+  801a23:	75 e4                	jne    801a09 <strfind+0x27>
+  801a25:	eb 01                	jmp    801a28 <strfind+0x46>
+			break;
+  801a27:	90                   	nop
+	return (char *) s;
+  801a28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a2c:	c9                   	leave
+  801a2d:	c3                   	ret
+
+0000000000801a2e <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801a2e:	55                   	push   %rbp
+  801a2f:	48 89 e5             	mov    %rsp,%rbp
+  801a32:	48 83 ec 18          	sub    $0x18,%rsp
+  801a36:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a36 <memset+0x8>
+  801a3d:	49 bb 0a 76 00 00 00 	movabs $0x760a,%r11
+  801a44:	00 00 00 
+  801a47:	4c 01 d8             	add    %r11,%rax
+  801a4a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a4e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801a51:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801a55:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a5a:	75 06                	jne    801a62 <memset+0x34>
+		return v;
+  801a5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a60:	eb 69                	jmp    801acb <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801a62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a66:	83 e0 03             	and    $0x3,%eax
+  801a69:	48 85 c0             	test   %rax,%rax
+  801a6c:	75 48                	jne    801ab6 <memset+0x88>
+  801a6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a72:	83 e0 03             	and    $0x3,%eax
+  801a75:	48 85 c0             	test   %rax,%rax
+  801a78:	75 3c                	jne    801ab6 <memset+0x88>
+		c &= 0xFF;
+  801a7a:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801a81:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a84:	c1 e0 18             	shl    $0x18,%eax
+  801a87:	89 c2                	mov    %eax,%edx
+  801a89:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a8c:	c1 e0 10             	shl    $0x10,%eax
+  801a8f:	09 c2                	or     %eax,%edx
+  801a91:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801a94:	c1 e0 08             	shl    $0x8,%eax
+  801a97:	09 d0                	or     %edx,%eax
+  801a99:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801a9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aa0:	48 c1 e8 02          	shr    $0x2,%rax
+  801aa4:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801aa7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801aae:	48 89 d7             	mov    %rdx,%rdi
+  801ab1:	fc                   	cld
+  801ab2:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801ab4:	eb 11                	jmp    801ac7 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801ab6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801abd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801ac1:	48 89 d7             	mov    %rdx,%rdi
+  801ac4:	fc                   	cld
+  801ac5:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801ac7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801acb:	c9                   	leave
+  801acc:	c3                   	ret
+
+0000000000801acd <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801acd:	55                   	push   %rbp
+  801ace:	48 89 e5             	mov    %rsp,%rbp
+  801ad1:	48 83 ec 28          	sub    $0x28,%rsp
+  801ad5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ad5 <memmove+0x8>
+  801adc:	49 bb 6b 75 00 00 00 	movabs $0x756b,%r11
+  801ae3:	00 00 00 
+  801ae6:	4c 01 d8             	add    %r11,%rax
+  801ae9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801af1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801af5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801af9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801afd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b01:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801b05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b09:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801b0d:	0f 83 88 00 00 00    	jae    801b9b <memmove+0xce>
+  801b13:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b1b:	48 01 d0             	add    %rdx,%rax
+  801b1e:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801b22:	73 77                	jae    801b9b <memmove+0xce>
+		s += n;
+  801b24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b28:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801b2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b30:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801b34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b38:	83 e0 03             	and    $0x3,%eax
+  801b3b:	48 85 c0             	test   %rax,%rax
+  801b3e:	75 3b                	jne    801b7b <memmove+0xae>
+  801b40:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b44:	83 e0 03             	and    $0x3,%eax
+  801b47:	48 85 c0             	test   %rax,%rax
+  801b4a:	75 2f                	jne    801b7b <memmove+0xae>
+  801b4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b50:	83 e0 03             	and    $0x3,%eax
+  801b53:	48 85 c0             	test   %rax,%rax
+  801b56:	75 23                	jne    801b7b <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801b58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b5c:	48 83 e8 04          	sub    $0x4,%rax
+  801b60:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b64:	48 83 ea 04          	sub    $0x4,%rdx
+  801b68:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b6c:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801b70:	48 89 c7             	mov    %rax,%rdi
+  801b73:	48 89 d6             	mov    %rdx,%rsi
+  801b76:	fd                   	std
+  801b77:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801b79:	eb 1d                	jmp    801b98 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801b7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b7f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b83:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b87:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801b8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b8f:	48 89 d7             	mov    %rdx,%rdi
+  801b92:	48 89 c1             	mov    %rax,%rcx
+  801b95:	fd                   	std
+  801b96:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801b98:	fc                   	cld
+  801b99:	eb 57                	jmp    801bf2 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801b9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b9f:	83 e0 03             	and    $0x3,%eax
+  801ba2:	48 85 c0             	test   %rax,%rax
+  801ba5:	75 36                	jne    801bdd <memmove+0x110>
+  801ba7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bab:	83 e0 03             	and    $0x3,%eax
+  801bae:	48 85 c0             	test   %rax,%rax
+  801bb1:	75 2a                	jne    801bdd <memmove+0x110>
+  801bb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb7:	83 e0 03             	and    $0x3,%eax
+  801bba:	48 85 c0             	test   %rax,%rax
+  801bbd:	75 1e                	jne    801bdd <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801bbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc3:	48 c1 e8 02          	shr    $0x2,%rax
+  801bc7:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801bca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bd2:	48 89 c7             	mov    %rax,%rdi
+  801bd5:	48 89 d6             	mov    %rdx,%rsi
+  801bd8:	fc                   	cld
+  801bd9:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801bdb:	eb 15                	jmp    801bf2 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801bdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801be1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801be5:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801be9:	48 89 c7             	mov    %rax,%rdi
+  801bec:	48 89 d6             	mov    %rdx,%rsi
+  801bef:	fc                   	cld
+  801bf0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801bf2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801bf6:	c9                   	leave
+  801bf7:	c3                   	ret
+
+0000000000801bf8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801bf8:	55                   	push   %rbp
+  801bf9:	48 89 e5             	mov    %rsp,%rbp
+  801bfc:	48 83 ec 18          	sub    $0x18,%rsp
+  801c00:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c00 <memcpy+0x8>
+  801c07:	49 bb 40 74 00 00 00 	movabs $0x7440,%r11
+  801c0e:	00 00 00 
+  801c11:	4c 01 d8             	add    %r11,%rax
+  801c14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c18:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c1c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801c20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c24:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801c28:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801c2c:	48 89 cf             	mov    %rcx,%rdi
+  801c2f:	48 b9 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rcx
+  801c36:	ff ff ff 
+  801c39:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801c3d:	ff d0                	call   *%rax
+}
+  801c3f:	c9                   	leave
+  801c40:	c3                   	ret
+
+0000000000801c41 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801c41:	55                   	push   %rbp
+  801c42:	48 89 e5             	mov    %rsp,%rbp
+  801c45:	48 83 ec 28          	sub    $0x28,%rsp
+  801c49:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c49 <memcmp+0x8>
+  801c50:	49 bb f7 73 00 00 00 	movabs $0x73f7,%r11
+  801c57:	00 00 00 
+  801c5a:	4c 01 d8             	add    %r11,%rax
+  801c5d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c61:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c65:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801c69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c6d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801c71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c75:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801c79:	eb 34                	jmp    801caf <memcmp+0x6e>
+		if (*s1 != *s2)
+  801c7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c7f:	0f b6 10             	movzbl (%rax),%edx
+  801c82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c86:	0f b6 00             	movzbl (%rax),%eax
+  801c89:	38 c2                	cmp    %al,%dl
+  801c8b:	74 18                	je     801ca5 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801c8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c91:	0f b6 00             	movzbl (%rax),%eax
+  801c94:	0f b6 d0             	movzbl %al,%edx
+  801c97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c9b:	0f b6 00             	movzbl (%rax),%eax
+  801c9e:	0f b6 c0             	movzbl %al,%eax
+  801ca1:	29 c2                	sub    %eax,%edx
+  801ca3:	eb 20                	jmp    801cc5 <memcmp+0x84>
+		s1++, s2++;
+  801ca5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801caa:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801caf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801cb7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801cbb:	48 85 c0             	test   %rax,%rax
+  801cbe:	75 bb                	jne    801c7b <memcmp+0x3a>
+	}
+
+	return 0;
+  801cc0:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801cc5:	89 d0                	mov    %edx,%eax
+  801cc7:	c9                   	leave
+  801cc8:	c3                   	ret
+
+0000000000801cc9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801cc9:	55                   	push   %rbp
+  801cca:	48 89 e5             	mov    %rsp,%rbp
+  801ccd:	48 83 ec 28          	sub    $0x28,%rsp
+  801cd1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801cd1 <memfind+0x8>
+  801cd8:	49 bb 6f 73 00 00 00 	movabs $0x736f,%r11
+  801cdf:	00 00 00 
+  801ce2:	4c 01 d8             	add    %r11,%rax
+  801ce5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ce9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801cec:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801cf0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cf4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cf8:	48 01 d0             	add    %rdx,%rax
+  801cfb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801cff:	eb 13                	jmp    801d14 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801d01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d05:	0f b6 00             	movzbl (%rax),%eax
+  801d08:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801d0b:	38 d0                	cmp    %dl,%al
+  801d0d:	74 11                	je     801d20 <memfind+0x57>
+	for (; s < ends; s++)
+  801d0f:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801d14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d18:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801d1c:	72 e3                	jb     801d01 <memfind+0x38>
+  801d1e:	eb 01                	jmp    801d21 <memfind+0x58>
+			break;
+  801d20:	90                   	nop
+	return (void *) s;
+  801d21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801d25:	c9                   	leave
+  801d26:	c3                   	ret
+
+0000000000801d27 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801d27:	55                   	push   %rbp
+  801d28:	48 89 e5             	mov    %rsp,%rbp
+  801d2b:	48 83 ec 38          	sub    $0x38,%rsp
+  801d2f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d2f <strtol+0x8>
+  801d36:	49 bb 11 73 00 00 00 	movabs $0x7311,%r11
+  801d3d:	00 00 00 
+  801d40:	4c 01 d8             	add    %r11,%rax
+  801d43:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d47:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d4b:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801d4e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801d55:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801d5c:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801d5d:	eb 05                	jmp    801d64 <strtol+0x3d>
+		s++;
+  801d5f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801d64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d68:	0f b6 00             	movzbl (%rax),%eax
+  801d6b:	3c 20                	cmp    $0x20,%al
+  801d6d:	74 f0                	je     801d5f <strtol+0x38>
+  801d6f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d73:	0f b6 00             	movzbl (%rax),%eax
+  801d76:	3c 09                	cmp    $0x9,%al
+  801d78:	74 e5                	je     801d5f <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801d7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d7e:	0f b6 00             	movzbl (%rax),%eax
+  801d81:	3c 2b                	cmp    $0x2b,%al
+  801d83:	75 07                	jne    801d8c <strtol+0x65>
+		s++;
+  801d85:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d8a:	eb 17                	jmp    801da3 <strtol+0x7c>
+	else if (*s == '-')
+  801d8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d90:	0f b6 00             	movzbl (%rax),%eax
+  801d93:	3c 2d                	cmp    $0x2d,%al
+  801d95:	75 0c                	jne    801da3 <strtol+0x7c>
+		s++, neg = 1;
+  801d97:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d9c:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801da3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801da7:	74 06                	je     801daf <strtol+0x88>
+  801da9:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801dad:	75 28                	jne    801dd7 <strtol+0xb0>
+  801daf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db3:	0f b6 00             	movzbl (%rax),%eax
+  801db6:	3c 30                	cmp    $0x30,%al
+  801db8:	75 1d                	jne    801dd7 <strtol+0xb0>
+  801dba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dbe:	48 83 c0 01          	add    $0x1,%rax
+  801dc2:	0f b6 00             	movzbl (%rax),%eax
+  801dc5:	3c 78                	cmp    $0x78,%al
+  801dc7:	75 0e                	jne    801dd7 <strtol+0xb0>
+		s += 2, base = 16;
+  801dc9:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801dce:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801dd5:	eb 2c                	jmp    801e03 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801dd7:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ddb:	75 19                	jne    801df6 <strtol+0xcf>
+  801ddd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801de1:	0f b6 00             	movzbl (%rax),%eax
+  801de4:	3c 30                	cmp    $0x30,%al
+  801de6:	75 0e                	jne    801df6 <strtol+0xcf>
+		s++, base = 8;
+  801de8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ded:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801df4:	eb 0d                	jmp    801e03 <strtol+0xdc>
+	else if (base == 0)
+  801df6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801dfa:	75 07                	jne    801e03 <strtol+0xdc>
+		base = 10;
+  801dfc:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801e03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e07:	0f b6 00             	movzbl (%rax),%eax
+  801e0a:	3c 2f                	cmp    $0x2f,%al
+  801e0c:	7e 1d                	jle    801e2b <strtol+0x104>
+  801e0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e12:	0f b6 00             	movzbl (%rax),%eax
+  801e15:	3c 39                	cmp    $0x39,%al
+  801e17:	7f 12                	jg     801e2b <strtol+0x104>
+			dig = *s - '0';
+  801e19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e1d:	0f b6 00             	movzbl (%rax),%eax
+  801e20:	0f be c0             	movsbl %al,%eax
+  801e23:	83 e8 30             	sub    $0x30,%eax
+  801e26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e29:	eb 4e                	jmp    801e79 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801e2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e2f:	0f b6 00             	movzbl (%rax),%eax
+  801e32:	3c 60                	cmp    $0x60,%al
+  801e34:	7e 1d                	jle    801e53 <strtol+0x12c>
+  801e36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e3a:	0f b6 00             	movzbl (%rax),%eax
+  801e3d:	3c 7a                	cmp    $0x7a,%al
+  801e3f:	7f 12                	jg     801e53 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801e41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e45:	0f b6 00             	movzbl (%rax),%eax
+  801e48:	0f be c0             	movsbl %al,%eax
+  801e4b:	83 e8 57             	sub    $0x57,%eax
+  801e4e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801e51:	eb 26                	jmp    801e79 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801e53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e57:	0f b6 00             	movzbl (%rax),%eax
+  801e5a:	3c 40                	cmp    $0x40,%al
+  801e5c:	7e 47                	jle    801ea5 <strtol+0x17e>
+  801e5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e62:	0f b6 00             	movzbl (%rax),%eax
+  801e65:	3c 5a                	cmp    $0x5a,%al
+  801e67:	7f 3c                	jg     801ea5 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801e69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e6d:	0f b6 00             	movzbl (%rax),%eax
+  801e70:	0f be c0             	movsbl %al,%eax
+  801e73:	83 e8 37             	sub    $0x37,%eax
+  801e76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801e79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e7c:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801e7f:	7d 23                	jge    801ea4 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801e81:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801e86:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e89:	48 98                	cltq
+  801e8b:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801e90:	48 89 c2             	mov    %rax,%rdx
+  801e93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e96:	48 98                	cltq
+  801e98:	48 01 d0             	add    %rdx,%rax
+  801e9b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801e9f:	e9 5f ff ff ff       	jmp    801e03 <strtol+0xdc>
+			break;
+  801ea4:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ea5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801eaa:	74 0b                	je     801eb7 <strtol+0x190>
+		*endptr = (char *) s;
+  801eac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801eb0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801eb4:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801eb7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ebb:	74 09                	je     801ec6 <strtol+0x19f>
+  801ebd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ec1:	48 f7 d8             	neg    %rax
+  801ec4:	eb 04                	jmp    801eca <strtol+0x1a3>
+  801ec6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801eca:	c9                   	leave
+  801ecb:	c3                   	ret
+
+0000000000801ecc <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801ecc:	55                   	push   %rbp
+  801ecd:	48 89 e5             	mov    %rsp,%rbp
+  801ed0:	53                   	push   %rbx
+  801ed1:	48 83 ec 30          	sub    $0x30,%rsp
+  801ed5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801ed5 <strstr+0x9>
+  801edc:	49 bb 6b 71 00 00 00 	movabs $0x716b,%r11
+  801ee3:	00 00 00 
+  801ee6:	4c 01 db             	add    %r11,%rbx
+  801ee9:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801eed:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801ef1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ef5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ef9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801efd:	0f b6 00             	movzbl (%rax),%eax
+  801f00:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801f03:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801f07:	75 06                	jne    801f0f <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801f09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f0d:	eb 73                	jmp    801f82 <strstr+0xb6>
+
+	len = strlen(str);
+  801f0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f13:	48 89 c7             	mov    %rax,%rdi
+  801f16:	48 b8 19 86 ff ff ff 	movabs $0xffffffffffff8619,%rax
+  801f1d:	ff ff ff 
+  801f20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f24:	ff d0                	call   *%rax
+  801f26:	48 98                	cltq
+  801f28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801f2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f30:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801f34:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801f38:	0f b6 00             	movzbl (%rax),%eax
+  801f3b:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801f3e:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801f42:	75 07                	jne    801f4b <strstr+0x7f>
+				return (char *) 0;
+  801f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f49:	eb 37                	jmp    801f82 <strstr+0xb6>
+		} while (sc != c);
+  801f4b:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801f4f:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801f52:	75 d8                	jne    801f2c <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801f54:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f58:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801f5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f60:	48 89 ce             	mov    %rcx,%rsi
+  801f63:	48 89 c7             	mov    %rax,%rdi
+  801f66:	48 b8 cd 88 ff ff ff 	movabs $0xffffffffffff88cd,%rax
+  801f6d:	ff ff ff 
+  801f70:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801f74:	ff d0                	call   *%rax
+  801f76:	85 c0                	test   %eax,%eax
+  801f78:	75 b2                	jne    801f2c <strstr+0x60>
+
+	return (char *) (in - 1);
+  801f7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f7e:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801f82:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801f86:	c9                   	leave
+  801f87:	c3                   	ret
+
+0000000000801f88 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801f88:	55                   	push   %rbp
+  801f89:	48 89 e5             	mov    %rsp,%rbp
+  801f8c:	41 57                	push   %r15
+  801f8e:	53                   	push   %rbx
+  801f8f:	48 83 ec 40          	sub    $0x40,%rsp
+  801f93:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801f93 <syscall+0xb>
+  801f9a:	49 bb ad 70 00 00 00 	movabs $0x70ad,%r11
+  801fa1:	00 00 00 
+  801fa4:	4d 01 da             	add    %r11,%r10
+  801fa7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801faa:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801fad:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801fb1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801fb5:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801fb9:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801fbd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801fc0:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801fc4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801fc8:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801fcc:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801fd0:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801fd4:	4c 89 c3             	mov    %r8,%rbx
+  801fd7:	cd 30                	int    $0x30
+  801fd9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801fdd:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801fe1:	74 52                	je     802035 <syscall+0xad>
+  801fe3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801fe8:	7e 4b                	jle    802035 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fea:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801fee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ff1:	49 89 d0             	mov    %rdx,%r8
+  801ff4:	89 c1                	mov    %eax,%ecx
+  801ff6:	48 b8 a0 e4 ff ff ff 	movabs $0xffffffffffffe4a0,%rax
+  801ffd:	ff ff ff 
+  802000:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  802004:	48 89 c2             	mov    %rax,%rdx
+  802007:	be 23 00 00 00       	mov    $0x23,%esi
+  80200c:	48 b8 bd e4 ff ff ff 	movabs $0xffffffffffffe4bd,%rax
+  802013:	ff ff ff 
+  802016:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80201a:	48 89 c7             	mov    %rax,%rdi
+  80201d:	4d 89 d7             	mov    %r10,%r15
+  802020:	b8 00 00 00 00       	mov    $0x0,%eax
+  802025:	49 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r9
+  80202c:	ff ff ff 
+  80202f:	4d 01 d1             	add    %r10,%r9
+  802032:	41 ff d1             	call   *%r9
+
+	return ret;
+  802035:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802039:	48 83 c4 40          	add    $0x40,%rsp
+  80203d:	5b                   	pop    %rbx
+  80203e:	41 5f                	pop    %r15
+  802040:	5d                   	pop    %rbp
+  802041:	c3                   	ret
+
+0000000000802042 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  802042:	55                   	push   %rbp
+  802043:	48 89 e5             	mov    %rsp,%rbp
+  802046:	41 57                	push   %r15
+  802048:	41 56                	push   %r14
+  80204a:	41 55                	push   %r13
+  80204c:	41 54                	push   %r12
+  80204e:	53                   	push   %rbx
+  80204f:	48 83 ec 48          	sub    $0x48,%rsp
+  802053:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 802053 <syscall_words+0x11>
+  80205a:	49 bb ed 6f 00 00 00 	movabs $0x6fed,%r11
+  802061:	00 00 00 
+  802064:	4d 01 de             	add    %r11,%r14
+  802067:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80206a:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  80206d:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802071:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802075:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  802079:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  80207d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802082:	74 09                	je     80208d <syscall_words+0x4b>
+  802084:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802088:	48 8b 00             	mov    (%rax),%rax
+  80208b:	eb 05                	jmp    802092 <syscall_words+0x50>
+  80208d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802092:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  802095:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80209a:	74 0a                	je     8020a6 <syscall_words+0x64>
+  80209c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020a0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8020a4:	eb 05                	jmp    8020ab <syscall_words+0x69>
+  8020a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ab:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  8020ae:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020b3:	74 0a                	je     8020bf <syscall_words+0x7d>
+  8020b5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020b9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8020bd:	eb 05                	jmp    8020c4 <syscall_words+0x82>
+  8020bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c4:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8020c7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020cc:	74 0a                	je     8020d8 <syscall_words+0x96>
+  8020ce:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020d2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8020d6:	eb 05                	jmp    8020dd <syscall_words+0x9b>
+  8020d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020dd:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  8020e0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020e5:	74 0a                	je     8020f1 <syscall_words+0xaf>
+  8020e7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020eb:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8020ef:	eb 05                	jmp    8020f6 <syscall_words+0xb4>
+  8020f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f6:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  8020f9:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8020fe:	74 0a                	je     80210a <syscall_words+0xc8>
+  802100:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802104:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802108:	eb 05                	jmp    80210f <syscall_words+0xcd>
+  80210a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80210f:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  802112:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802115:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802119:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80211d:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802121:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  802125:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802129:	cd 30                	int    $0x30
+  80212b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  80212f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802134:	74 50                	je     802186 <syscall_words+0x144>
+		words[0] = r8;
+  802136:	4c 89 c2             	mov    %r8,%rdx
+  802139:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80213d:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802140:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802144:	48 83 c0 08          	add    $0x8,%rax
+  802148:	4c 89 ca             	mov    %r9,%rdx
+  80214b:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  80214e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802152:	48 83 c0 10          	add    $0x10,%rax
+  802156:	4c 89 d2             	mov    %r10,%rdx
+  802159:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  80215c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802160:	48 83 c0 18          	add    $0x18,%rax
+  802164:	4c 89 da             	mov    %r11,%rdx
+  802167:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80216a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80216e:	48 83 c0 20          	add    $0x20,%rax
+  802172:	4c 89 e2             	mov    %r12,%rdx
+  802175:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  802178:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80217c:	48 83 c0 28          	add    $0x28,%rax
+  802180:	4c 89 ea             	mov    %r13,%rdx
+  802183:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  802186:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80218a:	74 52                	je     8021de <syscall_words+0x19c>
+  80218c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802191:	7e 4b                	jle    8021de <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802193:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802197:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80219a:	49 89 d0             	mov    %rdx,%r8
+  80219d:	89 c1                	mov    %eax,%ecx
+  80219f:	48 b8 a0 e4 ff ff ff 	movabs $0xffffffffffffe4a0,%rax
+  8021a6:	ff ff ff 
+  8021a9:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8021ad:	48 89 c2             	mov    %rax,%rdx
+  8021b0:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8021b5:	48 b8 bd e4 ff ff ff 	movabs $0xffffffffffffe4bd,%rax
+  8021bc:	ff ff ff 
+  8021bf:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8021c3:	48 89 c7             	mov    %rax,%rdi
+  8021c6:	4d 89 f7             	mov    %r14,%r15
+  8021c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ce:	49 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r9
+  8021d5:	ff ff ff 
+  8021d8:	4d 01 f1             	add    %r14,%r9
+  8021db:	41 ff d1             	call   *%r9
+
+	return ret;
+  8021de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8021e2:	48 83 c4 48          	add    $0x48,%rsp
+  8021e6:	5b                   	pop    %rbx
+  8021e7:	41 5c                	pop    %r12
+  8021e9:	41 5d                	pop    %r13
+  8021eb:	41 5e                	pop    %r14
+  8021ed:	41 5f                	pop    %r15
+  8021ef:	5d                   	pop    %rbp
+  8021f0:	c3                   	ret
+
+00000000008021f1 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8021f1:	55                   	push   %rbp
+  8021f2:	48 89 e5             	mov    %rsp,%rbp
+  8021f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021f9 <sys_cputs+0x8>
+  802200:	49 bb 47 6e 00 00 00 	movabs $0x6e47,%r11
+  802207:	00 00 00 
+  80220a:	4c 01 d8             	add    %r11,%rax
+  80220d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802211:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802215:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802219:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80221d:	48 83 ec 08          	sub    $0x8,%rsp
+  802221:	6a 00                	push   $0x0
+  802223:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80222f:	be 00 00 00 00       	mov    $0x0,%esi
+  802234:	bf 00 00 00 00       	mov    $0x0,%edi
+  802239:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802240:	ff ff ff 
+  802243:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802247:	ff d0                	call   *%rax
+  802249:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80224d:	90                   	nop
+  80224e:	c9                   	leave
+  80224f:	c3                   	ret
+
+0000000000802250 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+  802254:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802254 <sys_cgetc+0x4>
+  80225b:	49 bb ec 6d 00 00 00 	movabs $0x6dec,%r11
+  802262:	00 00 00 
+  802265:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802268:	48 83 ec 08          	sub    $0x8,%rsp
+  80226c:	6a 00                	push   $0x0
+  80226e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802274:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80227a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80227f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802284:	be 00 00 00 00       	mov    $0x0,%esi
+  802289:	bf 01 00 00 00       	mov    $0x1,%edi
+  80228e:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802295:	ff ff ff 
+  802298:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80229c:	ff d0                	call   *%rax
+  80229e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a2:	c9                   	leave
+  8022a3:	c3                   	ret
+
+00000000008022a4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8022a4:	55                   	push   %rbp
+  8022a5:	48 89 e5             	mov    %rsp,%rbp
+  8022a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022ac <sys_env_destroy+0x8>
+  8022b3:	49 bb 94 6d 00 00 00 	movabs $0x6d94,%r11
+  8022ba:	00 00 00 
+  8022bd:	4c 01 d8             	add    %r11,%rax
+  8022c0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8022c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022c6:	48 63 d2             	movslq %edx,%rdx
+  8022c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8022cd:	6a 00                	push   $0x0
+  8022cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8022e5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022ea:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  8022f1:	ff ff ff 
+  8022f4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022f8:	ff d0                	call   *%rax
+  8022fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022fe:	c9                   	leave
+  8022ff:	c3                   	ret
+
+0000000000802300 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802300:	55                   	push   %rbp
+  802301:	48 89 e5             	mov    %rsp,%rbp
+  802304:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802304 <sys_getenvid+0x4>
+  80230b:	49 bb 3c 6d 00 00 00 	movabs $0x6d3c,%r11
+  802312:	00 00 00 
+  802315:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802318:	48 83 ec 08          	sub    $0x8,%rsp
+  80231c:	6a 00                	push   $0x0
+  80231e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80232a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80232f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802334:	be 00 00 00 00       	mov    $0x0,%esi
+  802339:	bf 02 00 00 00       	mov    $0x2,%edi
+  80233e:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802345:	ff ff ff 
+  802348:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80234c:	ff d0                	call   *%rax
+  80234e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802352:	c9                   	leave
+  802353:	c3                   	ret
+
+0000000000802354 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802354:	55                   	push   %rbp
+  802355:	48 89 e5             	mov    %rsp,%rbp
+  802358:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802358 <sys_yield+0x4>
+  80235f:	49 bb e8 6c 00 00 00 	movabs $0x6ce8,%r11
+  802366:	00 00 00 
+  802369:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80236c:	48 83 ec 08          	sub    $0x8,%rsp
+  802370:	6a 00                	push   $0x0
+  802372:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802378:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80237e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802383:	ba 00 00 00 00       	mov    $0x0,%edx
+  802388:	be 00 00 00 00       	mov    $0x0,%esi
+  80238d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802392:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802399:	ff ff ff 
+  80239c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023a0:	ff d0                	call   *%rax
+  8023a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a6:	90                   	nop
+  8023a7:	c9                   	leave
+  8023a8:	c3                   	ret
+
+00000000008023a9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8023a9:	55                   	push   %rbp
+  8023aa:	48 89 e5             	mov    %rsp,%rbp
+  8023ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023b1 <sys_page_alloc+0x8>
+  8023b8:	49 bb 8f 6c 00 00 00 	movabs $0x6c8f,%r11
+  8023bf:	00 00 00 
+  8023c2:	4c 01 d8             	add    %r11,%rax
+  8023c5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023cc:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8023cf:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023d2:	48 63 f2             	movslq %edx,%rsi
+  8023d5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023d9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023dc:	48 63 d2             	movslq %edx,%rdx
+  8023df:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e3:	6a 00                	push   $0x0
+  8023e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023eb:	49 89 f0             	mov    %rsi,%r8
+  8023ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8023f3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8023f8:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  8023ff:	ff ff ff 
+  802402:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802406:	ff d0                	call   *%rax
+  802408:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80240c:	c9                   	leave
+  80240d:	c3                   	ret
+
+000000000080240e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80240e:	55                   	push   %rbp
+  80240f:	48 89 e5             	mov    %rsp,%rbp
+  802412:	48 83 ec 20          	sub    $0x20,%rsp
+  802416:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802416 <sys_page_map+0x8>
+  80241d:	49 bb 2a 6c 00 00 00 	movabs $0x6c2a,%r11
+  802424:	00 00 00 
+  802427:	4c 01 d8             	add    %r11,%rax
+  80242a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80242d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802431:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802434:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802438:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80243c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80243f:	48 63 f2             	movslq %edx,%rsi
+  802442:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802446:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802449:	48 63 fa             	movslq %edx,%rdi
+  80244c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802450:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802453:	48 63 d2             	movslq %edx,%rdx
+  802456:	48 83 ec 08          	sub    $0x8,%rsp
+  80245a:	56                   	push   %rsi
+  80245b:	4d 89 c1             	mov    %r8,%r9
+  80245e:	49 89 f8             	mov    %rdi,%r8
+  802461:	be 01 00 00 00       	mov    $0x1,%esi
+  802466:	bf 05 00 00 00       	mov    $0x5,%edi
+  80246b:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802472:	ff ff ff 
+  802475:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802479:	ff d0                	call   *%rax
+  80247b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80247f:	c9                   	leave
+  802480:	c3                   	ret
+
+0000000000802481 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802481:	55                   	push   %rbp
+  802482:	48 89 e5             	mov    %rsp,%rbp
+  802485:	48 83 ec 10          	sub    $0x10,%rsp
+  802489:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802489 <sys_page_unmap+0x8>
+  802490:	49 bb b7 6b 00 00 00 	movabs $0x6bb7,%r11
+  802497:	00 00 00 
+  80249a:	4c 01 d8             	add    %r11,%rax
+  80249d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024a0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8024a4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024a8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024ab:	48 63 d2             	movslq %edx,%rdx
+  8024ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b2:	6a 00                	push   $0x0
+  8024b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8024c5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8024ca:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  8024d1:	ff ff ff 
+  8024d4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024d8:	ff d0                	call   *%rax
+  8024da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024de:	c9                   	leave
+  8024df:	c3                   	ret
+
+00000000008024e0 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8024e0:	55                   	push   %rbp
+  8024e1:	48 89 e5             	mov    %rsp,%rbp
+  8024e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8024e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024e8 <sys_env_set_status+0x8>
+  8024ef:	49 bb 58 6b 00 00 00 	movabs $0x6b58,%r11
+  8024f6:	00 00 00 
+  8024f9:	4c 01 d8             	add    %r11,%rax
+  8024fc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024ff:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802502:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802505:	48 63 ca             	movslq %edx,%rcx
+  802508:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80250b:	48 63 d2             	movslq %edx,%rdx
+  80250e:	48 83 ec 08          	sub    $0x8,%rsp
+  802512:	6a 00                	push   $0x0
+  802514:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80251a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802520:	be 01 00 00 00       	mov    $0x1,%esi
+  802525:	bf 08 00 00 00       	mov    $0x8,%edi
+  80252a:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802531:	ff ff ff 
+  802534:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802538:	ff d0                	call   *%rax
+  80253a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80253e:	c9                   	leave
+  80253f:	c3                   	ret
+
+0000000000802540 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802540:	55                   	push   %rbp
+  802541:	48 89 e5             	mov    %rsp,%rbp
+  802544:	48 83 ec 10          	sub    $0x10,%rsp
+  802548:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802548 <sys_env_set_trapframe+0x8>
+  80254f:	49 bb f8 6a 00 00 00 	movabs $0x6af8,%r11
+  802556:	00 00 00 
+  802559:	4c 01 d8             	add    %r11,%rax
+  80255c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80255f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802563:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802567:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80256a:	48 63 d2             	movslq %edx,%rdx
+  80256d:	48 83 ec 08          	sub    $0x8,%rsp
+  802571:	6a 00                	push   $0x0
+  802573:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802579:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80257f:	be 01 00 00 00       	mov    $0x1,%esi
+  802584:	bf 09 00 00 00       	mov    $0x9,%edi
+  802589:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802590:	ff ff ff 
+  802593:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802597:	ff d0                	call   *%rax
+  802599:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80259d:	c9                   	leave
+  80259e:	c3                   	ret
+
+000000000080259f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+  8025a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8025a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025a7 <sys_env_set_pgfault_upcall+0x8>
+  8025ae:	49 bb 99 6a 00 00 00 	movabs $0x6a99,%r11
+  8025b5:	00 00 00 
+  8025b8:	4c 01 d8             	add    %r11,%rax
+  8025bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8025c2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025c6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025c9:	48 63 d2             	movslq %edx,%rdx
+  8025cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d0:	6a 00                	push   $0x0
+  8025d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025de:	be 01 00 00 00       	mov    $0x1,%esi
+  8025e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8025e8:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  8025ef:	ff ff ff 
+  8025f2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025f6:	ff d0                	call   *%rax
+  8025f8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025fc:	c9                   	leave
+  8025fd:	c3                   	ret
+
+00000000008025fe <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8025fe:	55                   	push   %rbp
+  8025ff:	48 89 e5             	mov    %rsp,%rbp
+  802602:	48 83 ec 20          	sub    $0x20,%rsp
+  802606:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802606 <sys_ipc_try_send+0x8>
+  80260d:	49 bb 3a 6a 00 00 00 	movabs $0x6a3a,%r11
+  802614:	00 00 00 
+  802617:	4c 01 d8             	add    %r11,%rax
+  80261a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80261d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802621:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802625:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802628:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80262b:	48 63 fa             	movslq %edx,%rdi
+  80262e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802632:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802635:	48 63 d2             	movslq %edx,%rdx
+  802638:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80263c:	48 83 ec 08          	sub    $0x8,%rsp
+  802640:	6a 00                	push   $0x0
+  802642:	49 89 f9             	mov    %rdi,%r9
+  802645:	49 89 f0             	mov    %rsi,%r8
+  802648:	be 00 00 00 00       	mov    $0x0,%esi
+  80264d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802652:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802659:	ff ff ff 
+  80265c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802660:	ff d0                	call   *%rax
+  802662:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802666:	c9                   	leave
+  802667:	c3                   	ret
+
+0000000000802668 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802668:	55                   	push   %rbp
+  802669:	48 89 e5             	mov    %rsp,%rbp
+  80266c:	48 83 ec 20          	sub    $0x20,%rsp
+  802670:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802670 <sys_ipc_send+0x8>
+  802677:	49 bb d0 69 00 00 00 	movabs $0x69d0,%r11
+  80267e:	00 00 00 
+  802681:	4c 01 d8             	add    %r11,%rax
+  802684:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802687:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80268b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80268f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802692:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802695:	48 63 fa             	movslq %edx,%rdi
+  802698:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80269c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80269f:	48 63 d2             	movslq %edx,%rdx
+  8026a2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8026aa:	6a 00                	push   $0x0
+  8026ac:	49 89 f9             	mov    %rdi,%r9
+  8026af:	49 89 f0             	mov    %rsi,%r8
+  8026b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b7:	bf 17 00 00 00       	mov    $0x17,%edi
+  8026bc:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  8026c3:	ff ff ff 
+  8026c6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026ca:	ff d0                	call   *%rax
+  8026cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d0:	c9                   	leave
+  8026d1:	c3                   	ret
+
+00000000008026d2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8026d2:	55                   	push   %rbp
+  8026d3:	48 89 e5             	mov    %rsp,%rbp
+  8026d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8026da:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026da <sys_ipc_recv+0x8>
+  8026e1:	49 bb 66 69 00 00 00 	movabs $0x6966,%r11
+  8026e8:	00 00 00 
+  8026eb:	4c 01 d8             	add    %r11,%rax
+  8026ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8026f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026f6:	6a 00                	push   $0x0
+  8026f8:	6a 00                	push   $0x0
+  8026fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802700:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802706:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80270b:	be 01 00 00 00       	mov    $0x1,%esi
+  802710:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802715:	49 ba 02 90 ff ff ff 	movabs $0xffffffffffff9002,%r10
+  80271c:	ff ff ff 
+  80271f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802723:	ff d0                	call   *%rax
+  802725:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802729:	c9                   	leave
+  80272a:	c3                   	ret
+
+000000000080272b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  80272b:	55                   	push   %rbp
+  80272c:	48 89 e5             	mov    %rsp,%rbp
+  80272f:	48 83 ec 30          	sub    $0x30,%rsp
+  802733:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802733 <sys_ipc_call+0x8>
+  80273a:	49 bb 0d 69 00 00 00 	movabs $0x690d,%r11
+  802741:	00 00 00 
+  802744:	4c 01 d8             	add    %r11,%rax
+  802747:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80274a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80274e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802752:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802755:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802759:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80275d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802761:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802764:	4c 63 c2             	movslq %edx,%r8
+  802767:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80276b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80276e:	48 63 d2             	movslq %edx,%rdx
+  802771:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802775:	ff 75 d8             	push   -0x28(%rbp)
+  802778:	56                   	push   %rsi
+  802779:	4d 89 c1             	mov    %r8,%r9
+  80277c:	49 89 f8             	mov    %rdi,%r8
+  80277f:	be 00 00 00 00       	mov    $0x0,%esi
+  802784:	bf 18 00 00 00       	mov    $0x18,%edi
+  802789:	49 ba 02 90 ff ff ff 	movabs $0xffffffffffff9002,%r10
+  802790:	ff ff ff 
+  802793:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802797:	ff d0                	call   *%rax
+  802799:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80279d:	c9                   	leave
+  80279e:	c3                   	ret
+
+000000000080279f <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80279f:	55                   	push   %rbp
+  8027a0:	48 89 e5             	mov    %rsp,%rbp
+  8027a3:	48 83 ec 30          	sub    $0x30,%rsp
+  8027a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027a7 <sys_ipc_reply_recv+0x8>
+  8027ae:	49 bb 99 68 00 00 00 	movabs $0x6899,%r11
+  8027b5:	00 00 00 
+  8027b8:	4c 01 d8             	add    %r11,%rax
+  8027bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027c2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8027c6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8027c9:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8027cd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8027d1:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8027d5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027d8:	4c 63 c2             	movslq %edx,%r8
+  8027db:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8027df:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027e2:	48 63 d2             	movslq %edx,%rdx
+  8027e5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027e9:	ff 75 d8             	push   -0x28(%rbp)
+  8027ec:	56                   	push   %rsi
+  8027ed:	4d 89 c1             	mov    %r8,%r9
+  8027f0:	49 89 f8             	mov    %rdi,%r8
+  8027f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f8:	bf 19 00 00 00       	mov    $0x19,%edi
+  8027fd:	49 ba 02 90 ff ff ff 	movabs $0xffffffffffff9002,%r10
+  802804:	ff ff ff 
+  802807:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80280b:	ff d0                	call   *%rax
+  80280d:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802811:	c9                   	leave
+  802812:	c3                   	ret
+
+0000000000802813 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802813:	55                   	push   %rbp
+  802814:	48 89 e5             	mov    %rsp,%rbp
+  802817:	48 83 ec 10          	sub    $0x10,%rsp
+  80281b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80281b <sys_env_set_priority+0x8>
+  802822:	49 bb 25 68 00 00 00 	movabs $0x6825,%r11
+  802829:	00 00 00 
+  80282c:	4c 01 d8             	add    %r11,%rax
+  80282f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802832:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802835:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802838:	48 63 ca             	movslq %edx,%rcx
+  80283b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80283e:	48 63 d2             	movslq %edx,%rdx
+  802841:	48 83 ec 08          	sub    $0x8,%rsp
+  802845:	6a 00                	push   $0x0
+  802847:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80284d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802853:	be 01 00 00 00       	mov    $0x1,%esi
+  802858:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80285d:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802864:	ff ff ff 
+  802867:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80286b:	ff d0                	call   *%rax
+  80286d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802871:	c9                   	leave
+  802872:	c3                   	ret
+
+0000000000802873 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802873:	55                   	push   %rbp
+  802874:	48 89 e5             	mov    %rsp,%rbp
+  802877:	48 83 ec 10          	sub    $0x10,%rsp
+  80287b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80287b <sys_env_set_affinity+0x8>
+  802882:	49 bb c5 67 00 00 00 	movabs $0x67c5,%r11
+  802889:	00 00 00 
+  80288c:	4c 01 d8             	add    %r11,%rax
+  80288f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802892:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802895:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802898:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80289b:	48 63 d2             	movslq %edx,%rdx
+  80289e:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a2:	6a 00                	push   $0x0
+  8028a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8028b5:	bf 10 00 00 00       	mov    $0x10,%edi
+  8028ba:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  8028c1:	ff ff ff 
+  8028c4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028c8:	ff d0                	call   *%rax
+  8028ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028ce:	c9                   	leave
+  8028cf:	c3                   	ret
+
+00000000008028d0 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8028d0:	55                   	push   %rbp
+  8028d1:	48 89 e5             	mov    %rsp,%rbp
+  8028d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028d4 <sys_time_msec+0x4>
+  8028db:	49 bb 6c 67 00 00 00 	movabs $0x676c,%r11
+  8028e2:	00 00 00 
+  8028e5:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8028e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028ec:	6a 00                	push   $0x0
+  8028ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802904:	be 00 00 00 00       	mov    $0x0,%esi
+  802909:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80290e:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802915:	ff ff ff 
+  802918:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80291c:	ff d0                	call   *%rax
+  80291e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802922:	c9                   	leave
+  802923:	c3                   	ret
+
+0000000000802924 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802924:	55                   	push   %rbp
+  802925:	48 89 e5             	mov    %rsp,%rbp
+  802928:	48 83 ec 10          	sub    $0x10,%rsp
+  80292c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80292c <sys_sleep_usec+0x8>
+  802933:	49 bb 14 67 00 00 00 	movabs $0x6714,%r11
+  80293a:	00 00 00 
+  80293d:	4c 01 d8             	add    %r11,%rax
+  802940:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802944:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802948:	48 83 ec 08          	sub    $0x8,%rsp
+  80294c:	6a 00                	push   $0x0
+  80294e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802954:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80295a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80295f:	be 00 00 00 00       	mov    $0x0,%esi
+  802964:	bf 11 00 00 00       	mov    $0x11,%edi
+  802969:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802970:	ff ff ff 
+  802973:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802977:	ff d0                	call   *%rax
+  802979:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80297d:	c9                   	leave
+  80297e:	c3                   	ret
+
+000000000080297f <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80297f:	55                   	push   %rbp
+  802980:	48 89 e5             	mov    %rsp,%rbp
+  802983:	48 83 ec 10          	sub    $0x10,%rsp
+  802987:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802987 <sys_page_alloc_huge+0x8>
+  80298e:	49 bb b9 66 00 00 00 	movabs $0x66b9,%r11
+  802995:	00 00 00 
+  802998:	4c 01 d8             	add    %r11,%rax
+  80299b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80299e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029a2:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8029a5:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8029a8:	48 63 f2             	movslq %edx,%rsi
+  8029ab:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029af:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8029b2:	48 63 d2             	movslq %edx,%rdx
+  8029b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b9:	6a 00                	push   $0x0
+  8029bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029c1:	49 89 f0             	mov    %rsi,%r8
+  8029c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8029c9:	bf 12 00 00 00       	mov    $0x12,%edi
+  8029ce:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  8029d5:	ff ff ff 
+  8029d8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029dc:	ff d0                	call   *%rax
+  8029de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e2:	c9                   	leave
+  8029e3:	c3                   	ret
+
+00000000008029e4 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8029e4:	55                   	push   %rbp
+  8029e5:	48 89 e5             	mov    %rsp,%rbp
+  8029e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8029ec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029ec <sys_page_map_batch+0x8>
+  8029f3:	49 bb 54 66 00 00 00 	movabs $0x6654,%r11
+  8029fa:	00 00 00 
+  8029fd:	4c 01 d8             	add    %r11,%rax
+  802a00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a04:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802a08:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a0c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a10:	48 83 ec 08          	sub    $0x8,%rsp
+  802a14:	6a 00                	push   $0x0
+  802a16:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a22:	be 01 00 00 00       	mov    $0x1,%esi
+  802a27:	bf 13 00 00 00       	mov    $0x13,%edi
+  802a2c:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802a33:	ff ff ff 
+  802a36:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a3a:	ff d0                	call   *%rax
+  802a3c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a40:	c9                   	leave
+  802a41:	c3                   	ret
+
+0000000000802a42 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802a42:	55                   	push   %rbp
+  802a43:	48 89 e5             	mov    %rsp,%rbp
+  802a46:	48 83 ec 10          	sub    $0x10,%rsp
+  802a4a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a4a <sys_page_alloc_batch+0x8>
+  802a51:	49 bb f6 65 00 00 00 	movabs $0x65f6,%r11
+  802a58:	00 00 00 
+  802a5b:	4c 01 d8             	add    %r11,%rax
+  802a5e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a62:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802a66:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802a6a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802a6e:	48 83 ec 08          	sub    $0x8,%rsp
+  802a72:	6a 00                	push   $0x0
+  802a74:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a7a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a80:	be 01 00 00 00       	mov    $0x1,%esi
+  802a85:	bf 14 00 00 00       	mov    $0x14,%edi
+  802a8a:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802a91:	ff ff ff 
+  802a94:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a98:	ff d0                	call   *%rax
+  802a9a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a9e:	c9                   	leave
+  802a9f:	c3                   	ret
+
+0000000000802aa0 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802aa0:	55                   	push   %rbp
+  802aa1:	48 89 e5             	mov    %rsp,%rbp
+  802aa4:	48 83 ec 10          	sub    $0x10,%rsp
+  802aa8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802aa8 <sys_page_unmap_batch+0x8>
+  802aaf:	49 bb 98 65 00 00 00 	movabs $0x6598,%r11
+  802ab6:	00 00 00 
+  802ab9:	4c 01 d8             	add    %r11,%rax
+  802abc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ac0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802ac4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ac8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802acc:	48 83 ec 08          	sub    $0x8,%rsp
+  802ad0:	6a 00                	push   $0x0
+  802ad2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ad8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ade:	be 01 00 00 00       	mov    $0x1,%esi
+  802ae3:	bf 15 00 00 00       	mov    $0x15,%edi
+  802ae8:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802aef:	ff ff ff 
+  802af2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802af6:	ff d0                	call   *%rax
+  802af8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802afc:	c9                   	leave
+  802afd:	c3                   	ret
+
+0000000000802afe <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802afe:	55                   	push   %rbp
+  802aff:	48 89 e5             	mov    %rsp,%rbp
+  802b02:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b02 <sys_fork+0x4>
+  802b09:	49 bb 3e 65 00 00 00 	movabs $0x653e,%r11
+  802b10:	00 00 00 
+  802b13:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802b16:	48 83 ec 08          	sub    $0x8,%rsp
+  802b1a:	6a 00                	push   $0x0
+  802b1c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b32:	be 00 00 00 00       	mov    $0x0,%esi
+  802b37:	bf 16 00 00 00       	mov    $0x16,%edi
+  802b3c:	49 ba 48 8f ff ff ff 	movabs $0xffffffffffff8f48,%r10
+  802b43:	ff ff ff 
+  802b46:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802b4a:	ff d0                	call   *%rax
+  802b4c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b50:	c9                   	leave
+  802b51:	c3                   	ret
+
+0000000000802b52 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802b52:	55                   	push   %rbp
+  802b53:	48 89 e5             	mov    %rsp,%rbp
+  802b56:	41 57                	push   %r15
+  802b58:	53                   	push   %rbx
+  802b59:	48 83 ec 40          	sub    $0x40,%rsp
+  802b5d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b5d <pgfault+0xb>
+  802b64:	49 bb e3 64 00 00 00 	movabs $0x64e3,%r11
+  802b6b:	00 00 00 
+  802b6e:	4c 01 db             	add    %r11,%rbx
+  802b71:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802b75:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b79:	48 8b 00             	mov    (%rax),%rax
+  802b7c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802b80:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802b84:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b88:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802b8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b8f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802b93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b97:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b9d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802ba1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ba4:	83 e0 02             	and    $0x2,%eax
+  802ba7:	85 c0                	test   %eax,%eax
+  802ba9:	0f 84 91 03 00 00    	je     802f40 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802baf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bb3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802bb7:	48 89 c2             	mov    %rax,%rdx
+  802bba:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802bc1:	ff ff ff 
+  802bc4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bc8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bcc:	83 e0 01             	and    $0x1,%eax
+  802bcf:	48 85 c0             	test   %rax,%rax
+  802bd2:	0f 84 a7 01 00 00    	je     802d7f <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802bd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bdc:	48 c1 e8 15          	shr    $0x15,%rax
+  802be0:	48 89 c2             	mov    %rax,%rdx
+  802be3:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802bea:	ff ff ff 
+  802bed:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bf1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bf5:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802bfa:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802c00:	0f 85 79 01 00 00    	jne    802d7f <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802c06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c0a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802c0e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c12:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802c18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802c1c:	ba 07 00 00 00       	mov    $0x7,%edx
+  802c21:	be 00 00 60 00       	mov    $0x600000,%esi
+  802c26:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c2b:	49 89 df             	mov    %rbx,%r15
+  802c2e:	48 b8 3f 99 ff ff ff 	movabs $0xffffffffffff993f,%rax
+  802c35:	ff ff ff 
+  802c38:	48 01 d8             	add    %rbx,%rax
+  802c3b:	ff d0                	call   *%rax
+  802c3d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802c40:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802c44:	79 44                	jns    802c8a <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802c46:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802c49:	89 c1                	mov    %eax,%ecx
+  802c4b:	48 b8 d0 e4 ff ff ff 	movabs $0xffffffffffffe4d0,%rax
+  802c52:	ff ff ff 
+  802c55:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c59:	48 89 c2             	mov    %rax,%rdx
+  802c5c:	be 20 00 00 00       	mov    $0x20,%esi
+  802c61:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  802c68:	ff ff ff 
+  802c6b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c6f:	48 89 c7             	mov    %rax,%rdi
+  802c72:	49 89 df             	mov    %rbx,%r15
+  802c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7a:	49 b8 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r8
+  802c81:	ff ff ff 
+  802c84:	49 01 d8             	add    %rbx,%r8
+  802c87:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802c8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c8e:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802c93:	48 89 c6             	mov    %rax,%rsi
+  802c96:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802c9b:	49 89 df             	mov    %rbx,%r15
+  802c9e:	48 b8 b8 8b ff ff ff 	movabs $0xffffffffffff8bb8,%rax
+  802ca5:	ff ff ff 
+  802ca8:	48 01 d8             	add    %rbx,%rax
+  802cab:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802cad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cb1:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802cb7:	48 89 c1             	mov    %rax,%rcx
+  802cba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cbf:	be 00 00 60 00       	mov    $0x600000,%esi
+  802cc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc9:	49 89 df             	mov    %rbx,%r15
+  802ccc:	48 b8 ce 93 ff ff ff 	movabs $0xffffffffffff93ce,%rax
+  802cd3:	ff ff ff 
+  802cd6:	48 01 d8             	add    %rbx,%rax
+  802cd9:	ff d0                	call   *%rax
+  802cdb:	85 c0                	test   %eax,%eax
+  802cdd:	74 3e                	je     802d1d <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802cdf:	48 b8 fb e4 ff ff ff 	movabs $0xffffffffffffe4fb,%rax
+  802ce6:	ff ff ff 
+  802ce9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ced:	48 89 c2             	mov    %rax,%rdx
+  802cf0:	be 23 00 00 00       	mov    $0x23,%esi
+  802cf5:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  802cfc:	ff ff ff 
+  802cff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d03:	48 89 c7             	mov    %rax,%rdi
+  802d06:	49 89 df             	mov    %rbx,%r15
+  802d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0e:	48 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%rcx
+  802d15:	ff ff ff 
+  802d18:	48 01 d9             	add    %rbx,%rcx
+  802d1b:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802d1d:	be 00 00 60 00       	mov    $0x600000,%esi
+  802d22:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d27:	49 89 df             	mov    %rbx,%r15
+  802d2a:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  802d31:	ff ff ff 
+  802d34:	48 01 d8             	add    %rbx,%rax
+  802d37:	ff d0                	call   *%rax
+  802d39:	85 c0                	test   %eax,%eax
+  802d3b:	0f 84 3d 02 00 00    	je     802f7e <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802d41:	48 b8 10 e5 ff ff ff 	movabs $0xffffffffffffe510,%rax
+  802d48:	ff ff ff 
+  802d4b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d4f:	48 89 c2             	mov    %rax,%rdx
+  802d52:	be 25 00 00 00       	mov    $0x25,%esi
+  802d57:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  802d5e:	ff ff ff 
+  802d61:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d65:	48 89 c7             	mov    %rax,%rdi
+  802d68:	49 89 df             	mov    %rbx,%r15
+  802d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d70:	48 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%rcx
+  802d77:	ff ff ff 
+  802d7a:	48 01 d9             	add    %rbx,%rcx
+  802d7d:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802d7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d83:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d87:	48 89 c2             	mov    %rax,%rdx
+  802d8a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d91:	ff ff ff 
+  802d94:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d98:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d9c:	25 00 08 00 00       	and    $0x800,%eax
+  802da1:	48 85 c0             	test   %rax,%rax
+  802da4:	0f 84 58 01 00 00    	je     802f02 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802daa:	ba 07 00 00 00       	mov    $0x7,%edx
+  802daf:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802db4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802db9:	49 89 df             	mov    %rbx,%r15
+  802dbc:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  802dc3:	ff ff ff 
+  802dc6:	48 01 d8             	add    %rbx,%rax
+  802dc9:	ff d0                	call   *%rax
+  802dcb:	85 c0                	test   %eax,%eax
+  802dcd:	74 3e                	je     802e0d <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802dcf:	48 b8 27 e5 ff ff ff 	movabs $0xffffffffffffe527,%rax
+  802dd6:	ff ff ff 
+  802dd9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ddd:	48 89 c2             	mov    %rax,%rdx
+  802de0:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802de5:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  802dec:	ff ff ff 
+  802def:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802df3:	48 89 c7             	mov    %rax,%rdi
+  802df6:	49 89 df             	mov    %rbx,%r15
+  802df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfe:	48 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%rcx
+  802e05:	ff ff ff 
+  802e08:	48 01 d9             	add    %rbx,%rcx
+  802e0b:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802e0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e11:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e16:	48 89 c6             	mov    %rax,%rsi
+  802e19:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802e1e:	49 89 df             	mov    %rbx,%r15
+  802e21:	48 b8 b8 8b ff ff ff 	movabs $0xffffffffffff8bb8,%rax
+  802e28:	ff ff ff 
+  802e2b:	48 01 d8             	add    %rbx,%rax
+  802e2e:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802e30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e34:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802e3a:	48 89 c1             	mov    %rax,%rcx
+  802e3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e42:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802e47:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e4c:	49 89 df             	mov    %rbx,%r15
+  802e4f:	48 b8 ce 93 ff ff ff 	movabs $0xffffffffffff93ce,%rax
+  802e56:	ff ff ff 
+  802e59:	48 01 d8             	add    %rbx,%rax
+  802e5c:	ff d0                	call   *%rax
+  802e5e:	85 c0                	test   %eax,%eax
+  802e60:	74 3e                	je     802ea0 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802e62:	48 b8 fb e4 ff ff ff 	movabs $0xffffffffffffe4fb,%rax
+  802e69:	ff ff ff 
+  802e6c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e70:	48 89 c2             	mov    %rax,%rdx
+  802e73:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802e78:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  802e7f:	ff ff ff 
+  802e82:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e86:	48 89 c7             	mov    %rax,%rdi
+  802e89:	49 89 df             	mov    %rbx,%r15
+  802e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e91:	48 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%rcx
+  802e98:	ff ff ff 
+  802e9b:	48 01 d9             	add    %rbx,%rcx
+  802e9e:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802ea0:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802ea5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eaa:	49 89 df             	mov    %rbx,%r15
+  802ead:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  802eb4:	ff ff ff 
+  802eb7:	48 01 d8             	add    %rbx,%rax
+  802eba:	ff d0                	call   *%rax
+  802ebc:	85 c0                	test   %eax,%eax
+  802ebe:	0f 84 bb 00 00 00    	je     802f7f <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802ec4:	48 b8 10 e5 ff ff ff 	movabs $0xffffffffffffe510,%rax
+  802ecb:	ff ff ff 
+  802ece:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ed2:	48 89 c2             	mov    %rax,%rdx
+  802ed5:	be 32 00 00 00       	mov    $0x32,%esi
+  802eda:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  802ee1:	ff ff ff 
+  802ee4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ee8:	48 89 c7             	mov    %rax,%rdi
+  802eeb:	49 89 df             	mov    %rbx,%r15
+  802eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef3:	48 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%rcx
+  802efa:	ff ff ff 
+  802efd:	48 01 d9             	add    %rbx,%rcx
+  802f00:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802f02:	48 b8 40 e5 ff ff ff 	movabs $0xffffffffffffe540,%rax
+  802f09:	ff ff ff 
+  802f0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f10:	48 89 c2             	mov    %rax,%rdx
+  802f13:	be 36 00 00 00       	mov    $0x36,%esi
+  802f18:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  802f1f:	ff ff ff 
+  802f22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f26:	48 89 c7             	mov    %rax,%rdi
+  802f29:	49 89 df             	mov    %rbx,%r15
+  802f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f31:	48 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%rcx
+  802f38:	ff ff ff 
+  802f3b:	48 01 d9             	add    %rbx,%rcx
+  802f3e:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802f40:	48 b8 5f e5 ff ff ff 	movabs $0xffffffffffffe55f,%rax
+  802f47:	ff ff ff 
+  802f4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f4e:	48 89 c2             	mov    %rax,%rdx
+  802f51:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802f56:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  802f5d:	ff ff ff 
+  802f60:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f64:	48 89 c7             	mov    %rax,%rdi
+  802f67:	49 89 df             	mov    %rbx,%r15
+  802f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6f:	48 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%rcx
+  802f76:	ff ff ff 
+  802f79:	48 01 d9             	add    %rbx,%rcx
+  802f7c:	ff d1                	call   *%rcx
+			return;
+  802f7e:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802f7f:	48 83 c4 40          	add    $0x40,%rsp
+  802f83:	5b                   	pop    %rbx
+  802f84:	41 5f                	pop    %r15
+  802f86:	5d                   	pop    %rbp
+  802f87:	c3                   	ret
+
+0000000000802f88 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802f88:	55                   	push   %rbp
+  802f89:	48 89 e5             	mov    %rsp,%rbp
+  802f8c:	41 57                	push   %r15
+  802f8e:	53                   	push   %rbx
+  802f8f:	48 83 ec 10          	sub    $0x10,%rsp
+  802f93:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f93 <fork_flush+0xb>
+  802f9a:	49 bb ad 60 00 00 00 	movabs $0x60ad,%r11
+  802fa1:	00 00 00 
+  802fa4:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802fa7:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fae:	00 00 00 
+  802fb1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fb5:	48 85 c0             	test   %rax,%rax
+  802fb8:	0f 84 81 00 00 00    	je     80303f <fork_flush+0xb7>
+  802fbe:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fc5:	00 00 00 
+  802fc8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fcc:	48 89 c6             	mov    %rax,%rsi
+  802fcf:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802fd6:	00 00 00 
+  802fd9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fdd:	48 89 c7             	mov    %rax,%rdi
+  802fe0:	49 89 df             	mov    %rbx,%r15
+  802fe3:	48 b8 a4 99 ff ff ff 	movabs $0xffffffffffff99a4,%rax
+  802fea:	ff ff ff 
+  802fed:	48 01 d8             	add    %rbx,%rax
+  802ff0:	ff d0                	call   *%rax
+  802ff2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ff5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ff9:	79 44                	jns    80303f <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802ffb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ffe:	89 c1                	mov    %eax,%ecx
+  803000:	48 b8 78 e5 ff ff ff 	movabs $0xffffffffffffe578,%rax
+  803007:	ff ff ff 
+  80300a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80300e:	48 89 c2             	mov    %rax,%rdx
+  803011:	be 56 00 00 00       	mov    $0x56,%esi
+  803016:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  80301d:	ff ff ff 
+  803020:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803024:	48 89 c7             	mov    %rax,%rdi
+  803027:	49 89 df             	mov    %rbx,%r15
+  80302a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302f:	49 b8 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r8
+  803036:	ff ff ff 
+  803039:	49 01 d8             	add    %rbx,%r8
+  80303c:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  80303f:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803046:	00 00 00 
+  803049:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803050:	00 
+}
+  803051:	90                   	nop
+  803052:	48 83 c4 10          	add    $0x10,%rsp
+  803056:	5b                   	pop    %rbx
+  803057:	41 5f                	pop    %r15
+  803059:	5d                   	pop    %rbp
+  80305a:	c3                   	ret
+
+000000000080305b <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  80305b:	55                   	push   %rbp
+  80305c:	48 89 e5             	mov    %rsp,%rbp
+  80305f:	53                   	push   %rbx
+  803060:	48 83 ec 28          	sub    $0x28,%rsp
+  803064:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803064 <fork_map+0x9>
+  80306b:	49 bb dc 5f 00 00 00 	movabs $0x5fdc,%r11
+  803072:	00 00 00 
+  803075:	4c 01 db             	add    %r11,%rbx
+  803078:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80307b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80307f:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  803082:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803089:	00 00 00 
+  80308c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803090:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  803096:	75 10                	jne    8030a8 <fork_map+0x4d>
+		fork_flush();
+  803098:	48 b8 48 9f ff ff ff 	movabs $0xffffffffffff9f48,%rax
+  80309f:	ff ff ff 
+  8030a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030a6:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  8030a8:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8030af:	00 00 00 
+  8030b2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030b6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8030ba:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  8030c1:	00 00 00 
+  8030c4:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  8030c8:	48 c1 e0 05          	shl    $0x5,%rax
+  8030cc:	48 89 c2             	mov    %rax,%rdx
+  8030cf:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  8030d6:	00 00 00 
+  8030d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030dd:	48 01 d0             	add    %rdx,%rax
+  8030e0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  8030e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030e8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  8030ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030f2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8030f6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  8030fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030fe:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803101:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  803104:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803108:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80310c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  803110:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803114:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803117:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  80311a:	90                   	nop
+  80311b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80311f:	c9                   	leave
+  803120:	c3                   	ret
+
+0000000000803121 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  803121:	55                   	push   %rbp
+  803122:	48 89 e5             	mov    %rsp,%rbp
+  803125:	53                   	push   %rbx
+  803126:	48 83 ec 28          	sub    $0x28,%rsp
+  80312a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80312a <duppage+0x9>
+  803131:	49 bb 16 5f 00 00 00 	movabs $0x5f16,%r11
+  803138:	00 00 00 
+  80313b:	4c 01 db             	add    %r11,%rbx
+  80313e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803141:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  803144:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803147:	48 c1 e0 0c          	shl    $0xc,%rax
+  80314b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  80314f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803156:	ff ff ff 
+  803159:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80315d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803160:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803164:	25 00 04 00 00       	and    $0x400,%eax
+  803169:	48 85 c0             	test   %rax,%rax
+  80316c:	74 42                	je     8031b0 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  80316e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803175:	ff ff ff 
+  803178:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80317c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80317f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803183:	25 07 0e 00 00       	and    $0xe07,%eax
+  803188:	89 c2                	mov    %eax,%edx
+  80318a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80318e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803191:	48 89 ce             	mov    %rcx,%rsi
+  803194:	89 c7                	mov    %eax,%edi
+  803196:	48 b8 1b a0 ff ff ff 	movabs $0xffffffffffffa01b,%rax
+  80319d:	ff ff ff 
+  8031a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031a4:	ff d0                	call   *%rax
+		return 0;
+  8031a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ab:	e9 ae 00 00 00       	jmp    80325e <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  8031b0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8031b7:	ff ff ff 
+  8031ba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031be:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8031c1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031c5:	83 e0 02             	and    $0x2,%eax
+  8031c8:	48 85 c0             	test   %rax,%rax
+  8031cb:	75 1f                	jne    8031ec <duppage+0xcb>
+  8031cd:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8031d4:	ff ff ff 
+  8031d7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031db:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8031de:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031e2:	25 00 08 00 00       	and    $0x800,%eax
+  8031e7:	48 85 c0             	test   %rax,%rax
+  8031ea:	74 4c                	je     803238 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  8031ec:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  8031f3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8031f6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8031fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031fd:	48 89 ce             	mov    %rcx,%rsi
+  803200:	89 c7                	mov    %eax,%edi
+  803202:	48 b8 1b a0 ff ff ff 	movabs $0xffffffffffffa01b,%rax
+  803209:	ff ff ff 
+  80320c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803210:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  803212:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803215:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803219:	48 89 c6             	mov    %rax,%rsi
+  80321c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803221:	48 b8 1b a0 ff ff ff 	movabs $0xffffffffffffa01b,%rax
+  803228:	ff ff ff 
+  80322b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80322f:	ff d0                	call   *%rax
+		return 0;
+  803231:	b8 00 00 00 00       	mov    $0x0,%eax
+  803236:	eb 26                	jmp    80325e <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  803238:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80323c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80323f:	ba 05 00 00 00       	mov    $0x5,%edx
+  803244:	48 89 ce             	mov    %rcx,%rsi
+  803247:	89 c7                	mov    %eax,%edi
+  803249:	48 b8 1b a0 ff ff ff 	movabs $0xffffffffffffa01b,%rax
+  803250:	ff ff ff 
+  803253:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803257:	ff d0                	call   *%rax
+		return 0;
+  803259:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  80325e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803262:	c9                   	leave
+  803263:	c3                   	ret
+
+0000000000803264 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  803264:	55                   	push   %rbp
+  803265:	48 89 e5             	mov    %rsp,%rbp
+  803268:	53                   	push   %rbx
+  803269:	48 83 ec 28          	sub    $0x28,%rsp
+  80326d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80326d <duphuge+0x9>
+  803274:	49 bb d3 5d 00 00 00 	movabs $0x5dd3,%r11
+  80327b:	00 00 00 
+  80327e:	4c 01 db             	add    %r11,%rbx
+  803281:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803284:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  803288:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80328c:	48 c1 e8 15          	shr    $0x15,%rax
+  803290:	48 89 c2             	mov    %rax,%rdx
+  803293:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80329a:	ff ff ff 
+  80329d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032a1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032a5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8032a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032ad:	25 00 04 00 00       	and    $0x400,%eax
+  8032b2:	48 85 c0             	test   %rax,%rax
+  8032b5:	74 0e                	je     8032c5 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8032b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032bb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8032c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032c3:	eb 1e                	jmp    8032e3 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  8032c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032c9:	25 02 08 00 00       	and    $0x802,%eax
+  8032ce:	48 85 c0             	test   %rax,%rax
+  8032d1:	74 09                	je     8032dc <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  8032d3:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  8032da:	eb 07                	jmp    8032e3 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  8032dc:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  8032e3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8032e6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8032ea:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032ed:	48 89 ce             	mov    %rcx,%rsi
+  8032f0:	89 c7                	mov    %eax,%edi
+  8032f2:	48 b8 1b a0 ff ff ff 	movabs $0xffffffffffffa01b,%rax
+  8032f9:	ff ff ff 
+  8032fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803300:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  803302:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803305:	25 00 08 00 00       	and    $0x800,%eax
+  80330a:	85 c0                	test   %eax,%eax
+  80330c:	74 1f                	je     80332d <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  80330e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803311:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803315:	48 89 c6             	mov    %rax,%rsi
+  803318:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331d:	48 b8 1b a0 ff ff ff 	movabs $0xffffffffffffa01b,%rax
+  803324:	ff ff ff 
+  803327:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80332b:	ff d0                	call   *%rax
+	return 0;
+  80332d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803332:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803336:	c9                   	leave
+  803337:	c3                   	ret
+
+0000000000803338 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  803338:	55                   	push   %rbp
+  803339:	48 89 e5             	mov    %rsp,%rbp
+  80333c:	41 57                	push   %r15
+  80333e:	53                   	push   %rbx
+  80333f:	48 83 ec 10          	sub    $0x10,%rsp
+  803343:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803343 <fork+0xb>
+  80334a:	49 bb fd 5c 00 00 00 	movabs $0x5cfd,%r11
+  803351:	00 00 00 
+  803354:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  803357:	49 89 df             	mov    %rbx,%r15
+  80335a:	48 b8 be 9a ff ff ff 	movabs $0xffffffffffff9abe,%rax
+  803361:	ff ff ff 
+  803364:	48 01 d8             	add    %rbx,%rax
+  803367:	ff d0                	call   *%rax
+  803369:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80336c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803370:	75 42                	jne    8033b4 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803372:	49 89 df             	mov    %rbx,%r15
+  803375:	48 b8 c0 92 ff ff ff 	movabs $0xffffffffffff92c0,%rax
+  80337c:	ff ff ff 
+  80337f:	48 01 d8             	add    %rbx,%rax
+  803382:	ff d0                	call   *%rax
+  803384:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803389:	48 98                	cltq
+  80338b:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803392:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803399:	ff ff ff 
+  80339c:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8033a0:	48 01 c2             	add    %rax,%rdx
+  8033a3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8033aa:	ff ff ff 
+  8033ad:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033b1:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8033b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8033b7:	48 83 c4 10          	add    $0x10,%rsp
+  8033bb:	5b                   	pop    %rbx
+  8033bc:	41 5f                	pop    %r15
+  8033be:	5d                   	pop    %rbp
+  8033bf:	c3                   	ret
+
+00000000008033c0 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8033c0:	55                   	push   %rbp
+  8033c1:	48 89 e5             	mov    %rsp,%rbp
+  8033c4:	41 57                	push   %r15
+  8033c6:	53                   	push   %rbx
+  8033c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8033cb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033cb <ufork+0xb>
+  8033d2:	49 bb 75 5c 00 00 00 	movabs $0x5c75,%r11
+  8033d9:	00 00 00 
+  8033dc:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  8033df:	48 b8 12 9b ff ff ff 	movabs $0xffffffffffff9b12,%rax
+  8033e6:	ff ff ff 
+  8033e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033ed:	48 89 c7             	mov    %rax,%rdi
+  8033f0:	49 89 df             	mov    %rbx,%r15
+  8033f3:	48 b8 a7 d5 ff ff ff 	movabs $0xffffffffffffd5a7,%rax
+  8033fa:	ff ff ff 
+  8033fd:	48 01 d8             	add    %rbx,%rax
+  803400:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  803402:	b8 07 00 00 00       	mov    $0x7,%eax
+  803407:	cd 30                	int    $0x30
+  803409:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  80340c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  80340f:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  803412:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803416:	0f 84 03 02 00 00    	je     80361f <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  80341c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803423:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  803424:	e9 28 01 00 00       	jmp    803551 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  803429:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80342d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803431:	48 89 c2             	mov    %rax,%rdx
+  803434:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80343b:	ff ff ff 
+  80343e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803442:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803446:	83 e0 01             	and    $0x1,%eax
+  803449:	48 85 c0             	test   %rax,%rax
+  80344c:	0f 84 f7 00 00 00    	je     803549 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803452:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803456:	48 c1 e8 15          	shr    $0x15,%rax
+  80345a:	48 89 c2             	mov    %rax,%rdx
+  80345d:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803464:	ff ff ff 
+  803467:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80346b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80346f:	25 81 00 00 00       	and    $0x81,%eax
+  803474:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  80347a:	75 29                	jne    8034a5 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  80347c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803480:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803483:	48 89 d6             	mov    %rdx,%rsi
+  803486:	89 c7                	mov    %eax,%edi
+  803488:	48 b8 24 a2 ff ff ff 	movabs $0xffffffffffffa224,%rax
+  80348f:	ff ff ff 
+  803492:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803496:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  803498:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80349f:	00 
+  8034a0:	e9 ac 00 00 00       	jmp    803551 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8034a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034a9:	48 c1 e8 15          	shr    $0x15,%rax
+  8034ad:	48 89 c2             	mov    %rax,%rdx
+  8034b0:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8034b7:	ff ff ff 
+  8034ba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034be:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034c2:	83 e0 01             	and    $0x1,%eax
+  8034c5:	48 85 c0             	test   %rax,%rax
+  8034c8:	74 75                	je     80353f <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  8034ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034ce:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034d2:	48 89 c2             	mov    %rax,%rdx
+  8034d5:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8034dc:	ff ff ff 
+  8034df:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034e3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034e7:	83 e0 01             	and    $0x1,%eax
+  8034ea:	48 85 c0             	test   %rax,%rax
+  8034ed:	74 46                	je     803535 <ufork+0x175>
+  8034ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034f3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034f7:	48 89 c2             	mov    %rax,%rdx
+  8034fa:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803501:	ff ff ff 
+  803504:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803508:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80350c:	83 e0 04             	and    $0x4,%eax
+  80350f:	48 85 c0             	test   %rax,%rax
+  803512:	74 21                	je     803535 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  803514:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803518:	48 c1 e8 0c          	shr    $0xc,%rax
+  80351c:	89 c2                	mov    %eax,%edx
+  80351e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803521:	89 d6                	mov    %edx,%esi
+  803523:	89 c7                	mov    %eax,%edi
+  803525:	48 b8 e1 a0 ff ff ff 	movabs $0xffffffffffffa0e1,%rax
+  80352c:	ff ff ff 
+  80352f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803533:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  803535:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  80353c:	00 
+  80353d:	eb 12                	jmp    803551 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  80353f:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803546:	00 
+  803547:	eb 08                	jmp    803551 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  803549:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803550:	40 
+		for (; addr < USTACKTOP;){
+  803551:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803556:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80355a:	0f 83 c9 fe ff ff    	jae    803429 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803560:	48 b8 48 9f ff ff ff 	movabs $0xffffffffffff9f48,%rax
+  803567:	ff ff ff 
+  80356a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80356e:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803570:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803573:	ba 07 00 00 00       	mov    $0x7,%edx
+  803578:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80357d:	48 89 ce             	mov    %rcx,%rsi
+  803580:	89 c7                	mov    %eax,%edi
+  803582:	49 89 df             	mov    %rbx,%r15
+  803585:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  80358c:	ff ff ff 
+  80358f:	48 01 d8             	add    %rbx,%rax
+  803592:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803594:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803597:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  80359e:	ff ff ff 
+  8035a1:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8035a5:	48 89 d6             	mov    %rdx,%rsi
+  8035a8:	89 c7                	mov    %eax,%edi
+  8035aa:	49 89 df             	mov    %rbx,%r15
+  8035ad:	48 b8 5f 95 ff ff ff 	movabs $0xffffffffffff955f,%rax
+  8035b4:	ff ff ff 
+  8035b7:	48 01 d8             	add    %rbx,%rax
+  8035ba:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8035bc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8035bf:	be 02 00 00 00       	mov    $0x2,%esi
+  8035c4:	89 c7                	mov    %eax,%edi
+  8035c6:	49 89 df             	mov    %rbx,%r15
+  8035c9:	48 b8 a0 94 ff ff ff 	movabs $0xffffffffffff94a0,%rax
+  8035d0:	ff ff ff 
+  8035d3:	48 01 d8             	add    %rbx,%rax
+  8035d6:	ff d0                	call   *%rax
+  8035d8:	85 c0                	test   %eax,%eax
+  8035da:	74 3e                	je     80361a <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  8035dc:	48 b8 9f e5 ff ff ff 	movabs $0xffffffffffffe59f,%rax
+  8035e3:	ff ff ff 
+  8035e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8035ea:	48 89 c2             	mov    %rax,%rdx
+  8035ed:	be 07 01 00 00       	mov    $0x107,%esi
+  8035f2:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  8035f9:	ff ff ff 
+  8035fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803600:	48 89 c7             	mov    %rax,%rdi
+  803603:	49 89 df             	mov    %rbx,%r15
+  803606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360b:	48 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%rcx
+  803612:	ff ff ff 
+  803615:	48 01 d9             	add    %rbx,%rcx
+  803618:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  80361a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80361d:	eb 59                	jmp    803678 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80361f:	49 89 df             	mov    %rbx,%r15
+  803622:	48 b8 c0 92 ff ff ff 	movabs $0xffffffffffff92c0,%rax
+  803629:	ff ff ff 
+  80362c:	48 01 d8             	add    %rbx,%rax
+  80362f:	ff d0                	call   *%rax
+  803631:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803636:	48 98                	cltq
+  803638:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80363f:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803646:	ff ff ff 
+  803649:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80364d:	48 01 c2             	add    %rax,%rdx
+  803650:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803657:	ff ff ff 
+  80365a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80365e:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803661:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803668:	00 00 00 
+  80366b:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803672:	00 
+		return 0;
+  803673:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  803678:	48 83 c4 10          	add    $0x10,%rsp
+  80367c:	5b                   	pop    %rbx
+  80367d:	41 5f                	pop    %r15
+  80367f:	5d                   	pop    %rbp
+  803680:	c3                   	ret
+
+0000000000803681 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803681:	55                   	push   %rbp
+  803682:	48 89 e5             	mov    %rsp,%rbp
+  803685:	41 57                	push   %r15
+  803687:	48 83 ec 08          	sub    $0x8,%rsp
+  80368b:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80368b <sfork+0xa>
+  803692:	49 bb b5 59 00 00 00 	movabs $0x59b5,%r11
+  803699:	00 00 00 
+  80369c:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  80369f:	48 b8 ba e5 ff ff ff 	movabs $0xffffffffffffe5ba,%rax
+  8036a6:	ff ff ff 
+  8036a9:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8036ad:	48 89 c2             	mov    %rax,%rdx
+  8036b0:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8036b5:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  8036bc:	ff ff ff 
+  8036bf:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8036c3:	48 89 c7             	mov    %rax,%rdi
+  8036c6:	49 89 cf             	mov    %rcx,%r15
+  8036c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ce:	49 b8 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r8
+  8036d5:	ff ff ff 
+  8036d8:	49 01 c8             	add    %rcx,%r8
+  8036db:	41 ff d0             	call   *%r8
+
+00000000008036de <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  8036de:	55                   	push   %rbp
+  8036df:	48 89 e5             	mov    %rsp,%rbp
+  8036e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8036e6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8036e6 <fd2num+0x8>
+  8036ed:	49 bb 5a 59 00 00 00 	movabs $0x595a,%r11
+  8036f4:	00 00 00 
+  8036f7:	4c 01 d8             	add    %r11,%rax
+  8036fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8036fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803702:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803709:	ff ff ff 
+  80370c:	48 01 d0             	add    %rdx,%rax
+  80370f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803713:	c9                   	leave
+  803714:	c3                   	ret
+
+0000000000803715 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803715:	55                   	push   %rbp
+  803716:	48 89 e5             	mov    %rsp,%rbp
+  803719:	48 83 ec 08          	sub    $0x8,%rsp
+  80371d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80371d <fd2data+0x8>
+  803724:	49 bb 23 59 00 00 00 	movabs $0x5923,%r11
+  80372b:	00 00 00 
+  80372e:	4c 01 d8             	add    %r11,%rax
+  803731:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803735:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803739:	48 89 d7             	mov    %rdx,%rdi
+  80373c:	48 ba 9e a6 ff ff ff 	movabs $0xffffffffffffa69e,%rdx
+  803743:	ff ff ff 
+  803746:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80374a:	ff d0                	call   *%rax
+  80374c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803752:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803756:	c9                   	leave
+  803757:	c3                   	ret
+
+0000000000803758 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803758:	55                   	push   %rbp
+  803759:	48 89 e5             	mov    %rsp,%rbp
+  80375c:	48 83 ec 18          	sub    $0x18,%rsp
+  803760:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803760 <fd_alloc+0x8>
+  803767:	49 bb e0 58 00 00 00 	movabs $0x58e0,%r11
+  80376e:	00 00 00 
+  803771:	4c 01 d8             	add    %r11,%rax
+  803774:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803778:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80377f:	eb 75                	jmp    8037f6 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803781:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803784:	48 63 d2             	movslq %edx,%rdx
+  803787:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  80378e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803792:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803796:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80379a:	48 89 d1             	mov    %rdx,%rcx
+  80379d:	48 c1 e9 15          	shr    $0x15,%rcx
+  8037a1:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8037a8:	ff ff ff 
+  8037ab:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8037af:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8037b3:	83 e2 01             	and    $0x1,%edx
+  8037b6:	48 85 d2             	test   %rdx,%rdx
+  8037b9:	74 25                	je     8037e0 <fd_alloc+0x88>
+  8037bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8037bf:	48 89 d1             	mov    %rdx,%rcx
+  8037c2:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8037c6:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8037cd:	ff ff ff 
+  8037d0:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8037d4:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8037d8:	83 e2 01             	and    $0x1,%edx
+  8037db:	48 85 d2             	test   %rdx,%rdx
+  8037de:	75 12                	jne    8037f2 <fd_alloc+0x9a>
+			*fd_store = fd;
+  8037e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037e4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8037e8:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8037eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f0:	eb 1a                	jmp    80380c <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  8037f2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8037f6:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8037fa:	7e 85                	jle    803781 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  8037fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803800:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803807:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  80380c:	c9                   	leave
+  80380d:	c3                   	ret
+
+000000000080380e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80380e:	55                   	push   %rbp
+  80380f:	48 89 e5             	mov    %rsp,%rbp
+  803812:	48 83 ec 20          	sub    $0x20,%rsp
+  803816:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803816 <fd_lookup+0x8>
+  80381d:	49 bb 2a 58 00 00 00 	movabs $0x582a,%r11
+  803824:	00 00 00 
+  803827:	4c 01 d8             	add    %r11,%rax
+  80382a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80382d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803831:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803835:	78 06                	js     80383d <fd_lookup+0x2f>
+  803837:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80383b:	7e 07                	jle    803844 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80383d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803842:	eb 73                	jmp    8038b7 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803844:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803847:	48 63 d2             	movslq %edx,%rdx
+  80384a:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803851:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803855:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803859:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80385d:	48 89 d1             	mov    %rdx,%rcx
+  803860:	48 c1 e9 15          	shr    $0x15,%rcx
+  803864:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80386b:	ff ff ff 
+  80386e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803872:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803876:	83 e2 01             	and    $0x1,%edx
+  803879:	48 85 d2             	test   %rdx,%rdx
+  80387c:	74 22                	je     8038a0 <fd_lookup+0x92>
+  80387e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803882:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803886:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  80388d:	ff ff ff 
+  803890:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803894:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803898:	83 e0 01             	and    $0x1,%eax
+  80389b:	48 85 c0             	test   %rax,%rax
+  80389e:	75 07                	jne    8038a7 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8038a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038a5:	eb 10                	jmp    8038b7 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8038a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8038af:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8038b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038b7:	c9                   	leave
+  8038b8:	c3                   	ret
+
+00000000008038b9 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8038b9:	55                   	push   %rbp
+  8038ba:	48 89 e5             	mov    %rsp,%rbp
+  8038bd:	41 57                	push   %r15
+  8038bf:	53                   	push   %rbx
+  8038c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8038c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038c4 <fd_close+0xb>
+  8038cb:	49 bb 7c 57 00 00 00 	movabs $0x577c,%r11
+  8038d2:	00 00 00 
+  8038d5:	4c 01 db             	add    %r11,%rbx
+  8038d8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8038dc:	89 f0                	mov    %esi,%eax
+  8038de:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8038e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038e5:	48 89 c7             	mov    %rax,%rdi
+  8038e8:	48 b8 9e a6 ff ff ff 	movabs $0xffffffffffffa69e,%rax
+  8038ef:	ff ff ff 
+  8038f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038f6:	ff d0                	call   *%rax
+  8038f8:	89 c2                	mov    %eax,%edx
+  8038fa:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8038fe:	48 89 c6             	mov    %rax,%rsi
+  803901:	89 d7                	mov    %edx,%edi
+  803903:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  80390a:	ff ff ff 
+  80390d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803911:	ff d0                	call   *%rax
+  803913:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803916:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80391a:	78 0a                	js     803926 <fd_close+0x6d>
+	    || fd != fd2)
+  80391c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803920:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803924:	74 12                	je     803938 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803926:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80392a:	74 05                	je     803931 <fd_close+0x78>
+  80392c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80392f:	eb 7a                	jmp    8039ab <fd_close+0xf2>
+  803931:	b8 00 00 00 00       	mov    $0x0,%eax
+  803936:	eb 73                	jmp    8039ab <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803938:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80393c:	8b 00                	mov    (%rax),%eax
+  80393e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803942:	48 89 d6             	mov    %rdx,%rsi
+  803945:	89 c7                	mov    %eax,%edi
+  803947:	48 b8 74 a9 ff ff ff 	movabs $0xffffffffffffa974,%rax
+  80394e:	ff ff ff 
+  803951:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803955:	ff d0                	call   *%rax
+  803957:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80395a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80395e:	78 2a                	js     80398a <fd_close+0xd1>
+		if (dev->dev_close)
+  803960:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803964:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803968:	48 85 c0             	test   %rax,%rax
+  80396b:	74 16                	je     803983 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  80396d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803971:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803975:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803979:	48 89 c7             	mov    %rax,%rdi
+  80397c:	ff d2                	call   *%rdx
+  80397e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803981:	eb 07                	jmp    80398a <fd_close+0xd1>
+		else
+			r = 0;
+  803983:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  80398a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80398e:	48 89 c6             	mov    %rax,%rsi
+  803991:	bf 00 00 00 00       	mov    $0x0,%edi
+  803996:	49 89 df             	mov    %rbx,%r15
+  803999:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  8039a0:	ff ff ff 
+  8039a3:	48 01 d8             	add    %rbx,%rax
+  8039a6:	ff d0                	call   *%rax
+	return r;
+  8039a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8039ab:	48 83 c4 30          	add    $0x30,%rsp
+  8039af:	5b                   	pop    %rbx
+  8039b0:	41 5f                	pop    %r15
+  8039b2:	5d                   	pop    %rbp
+  8039b3:	c3                   	ret
+
+00000000008039b4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8039b4:	55                   	push   %rbp
+  8039b5:	48 89 e5             	mov    %rsp,%rbp
+  8039b8:	41 57                	push   %r15
+  8039ba:	48 83 ec 28          	sub    $0x28,%rsp
+  8039be:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8039be <dev_lookup+0xa>
+  8039c5:	49 bb 82 56 00 00 00 	movabs $0x5682,%r11
+  8039cc:	00 00 00 
+  8039cf:	4c 01 d9             	add    %r11,%rcx
+  8039d2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039d5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8039d9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8039e0:	eb 45                	jmp    803a27 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  8039e2:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  8039e9:	00 00 00 
+  8039ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039ef:	48 98                	cltq
+  8039f1:	48 01 ca             	add    %rcx,%rdx
+  8039f4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8039f8:	8b 00                	mov    (%rax),%eax
+  8039fa:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8039fd:	75 24                	jne    803a23 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  8039ff:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803a06:	00 00 00 
+  803a09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a0c:	48 98                	cltq
+  803a0e:	48 01 ca             	add    %rcx,%rdx
+  803a11:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803a15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a19:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a21:	eb 74                	jmp    803a97 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803a23:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803a27:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803a2e:	00 00 00 
+  803a31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a34:	48 98                	cltq
+  803a36:	48 01 ca             	add    %rcx,%rdx
+  803a39:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803a3d:	48 85 c0             	test   %rax,%rax
+  803a40:	75 a0                	jne    8039e2 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803a42:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803a49:	ff ff ff 
+  803a4c:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803a50:	48 8b 00             	mov    (%rax),%rax
+  803a53:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803a59:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803a5c:	89 c6                	mov    %eax,%esi
+  803a5e:	48 b8 d0 e5 ff ff ff 	movabs $0xffffffffffffe5d0,%rax
+  803a65:	ff ff ff 
+  803a68:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803a6c:	48 89 c7             	mov    %rax,%rdi
+  803a6f:	49 89 cf             	mov    %rcx,%r15
+  803a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a77:	49 b8 eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%r8
+  803a7e:	ff ff ff 
+  803a81:	49 01 c8             	add    %rcx,%r8
+  803a84:	41 ff d0             	call   *%r8
+	*dev = 0;
+  803a87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a8b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  803a92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803a97:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803a9b:	c9                   	leave
+  803a9c:	c3                   	ret
+
+0000000000803a9d <close>:
+
+int
+close(int fdnum)
+{
+  803a9d:	55                   	push   %rbp
+  803a9e:	48 89 e5             	mov    %rsp,%rbp
+  803aa1:	53                   	push   %rbx
+  803aa2:	48 83 ec 28          	sub    $0x28,%rsp
+  803aa6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803aa6 <close+0x9>
+  803aad:	49 bb 9a 55 00 00 00 	movabs $0x559a,%r11
+  803ab4:	00 00 00 
+  803ab7:	4c 01 db             	add    %r11,%rbx
+  803aba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803abd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803ac1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ac4:	48 89 d6             	mov    %rdx,%rsi
+  803ac7:	89 c7                	mov    %eax,%edi
+  803ac9:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  803ad0:	ff ff ff 
+  803ad3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ad7:	ff d0                	call   *%rax
+  803ad9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803adc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ae0:	79 05                	jns    803ae7 <close+0x4a>
+		return r;
+  803ae2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ae5:	eb 1c                	jmp    803b03 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803ae7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803aeb:	be 01 00 00 00       	mov    $0x1,%esi
+  803af0:	48 89 c7             	mov    %rax,%rdi
+  803af3:	48 b8 79 a8 ff ff ff 	movabs $0xffffffffffffa879,%rax
+  803afa:	ff ff ff 
+  803afd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b01:	ff d0                	call   *%rax
+}
+  803b03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b07:	c9                   	leave
+  803b08:	c3                   	ret
+
+0000000000803b09 <close_all>:
+
+void
+close_all(void)
+{
+  803b09:	55                   	push   %rbp
+  803b0a:	48 89 e5             	mov    %rsp,%rbp
+  803b0d:	53                   	push   %rbx
+  803b0e:	48 83 ec 18          	sub    $0x18,%rsp
+  803b12:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b12 <close_all+0x9>
+  803b19:	49 bb 2e 55 00 00 00 	movabs $0x552e,%r11
+  803b20:	00 00 00 
+  803b23:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803b26:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803b2d:	eb 19                	jmp    803b48 <close_all+0x3f>
+		close(i);
+  803b2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b32:	89 c7                	mov    %eax,%edi
+  803b34:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  803b3b:	ff ff ff 
+  803b3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b42:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803b44:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803b48:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803b4c:	7e e1                	jle    803b2f <close_all+0x26>
+}
+  803b4e:	90                   	nop
+  803b4f:	90                   	nop
+  803b50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b54:	c9                   	leave
+  803b55:	c3                   	ret
+
+0000000000803b56 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803b56:	55                   	push   %rbp
+  803b57:	48 89 e5             	mov    %rsp,%rbp
+  803b5a:	41 57                	push   %r15
+  803b5c:	53                   	push   %rbx
+  803b5d:	48 83 ec 40          	sub    $0x40,%rsp
+  803b61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b61 <dup+0xb>
+  803b68:	49 bb df 54 00 00 00 	movabs $0x54df,%r11
+  803b6f:	00 00 00 
+  803b72:	4c 01 db             	add    %r11,%rbx
+  803b75:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803b78:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803b7b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803b7f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803b82:	48 89 d6             	mov    %rdx,%rsi
+  803b85:	89 c7                	mov    %eax,%edi
+  803b87:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  803b8e:	ff ff ff 
+  803b91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b95:	ff d0                	call   *%rax
+  803b97:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b9a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b9e:	79 08                	jns    803ba8 <dup+0x52>
+		return r;
+  803ba0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ba3:	e9 a4 01 00 00       	jmp    803d4c <dup+0x1f6>
+	close(newfdnum);
+  803ba8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bab:	89 c7                	mov    %eax,%edi
+  803bad:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  803bb4:	ff ff ff 
+  803bb7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bbb:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803bbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bc0:	48 98                	cltq
+  803bc2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803bc8:	48 c1 e0 0c          	shl    $0xc,%rax
+  803bcc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803bd0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bd4:	48 89 c7             	mov    %rax,%rdi
+  803bd7:	48 b8 d5 a6 ff ff ff 	movabs $0xffffffffffffa6d5,%rax
+  803bde:	ff ff ff 
+  803be1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803be5:	ff d0                	call   *%rax
+  803be7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803beb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bef:	48 89 c7             	mov    %rax,%rdi
+  803bf2:	48 b8 d5 a6 ff ff ff 	movabs $0xffffffffffffa6d5,%rax
+  803bf9:	ff ff ff 
+  803bfc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c00:	ff d0                	call   *%rax
+  803c02:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803c06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c0a:	48 c1 e8 15          	shr    $0x15,%rax
+  803c0e:	48 89 c2             	mov    %rax,%rdx
+  803c11:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803c18:	ff ff ff 
+  803c1b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c1f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c23:	83 e0 01             	and    $0x1,%eax
+  803c26:	48 85 c0             	test   %rax,%rax
+  803c29:	74 7f                	je     803caa <dup+0x154>
+  803c2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c2f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c33:	48 89 c2             	mov    %rax,%rdx
+  803c36:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803c3d:	ff ff ff 
+  803c40:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c44:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c48:	83 e0 01             	and    $0x1,%eax
+  803c4b:	48 85 c0             	test   %rax,%rax
+  803c4e:	74 5a                	je     803caa <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803c50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c54:	48 c1 e8 0c          	shr    $0xc,%rax
+  803c58:	48 89 c2             	mov    %rax,%rdx
+  803c5b:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803c62:	ff ff ff 
+  803c65:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c69:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803c6d:	25 07 0e 00 00       	and    $0xe07,%eax
+  803c72:	89 c1                	mov    %eax,%ecx
+  803c74:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803c78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c7c:	41 89 c8             	mov    %ecx,%r8d
+  803c7f:	48 89 d1             	mov    %rdx,%rcx
+  803c82:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c87:	48 89 c6             	mov    %rax,%rsi
+  803c8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c8f:	49 89 df             	mov    %rbx,%r15
+  803c92:	48 b8 ce 93 ff ff ff 	movabs $0xffffffffffff93ce,%rax
+  803c99:	ff ff ff 
+  803c9c:	48 01 d8             	add    %rbx,%rax
+  803c9f:	ff d0                	call   *%rax
+  803ca1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ca4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ca8:	78 5f                	js     803d09 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803caa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cae:	48 c1 e8 0c          	shr    $0xc,%rax
+  803cb2:	48 89 c2             	mov    %rax,%rdx
+  803cb5:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803cbc:	ff ff ff 
+  803cbf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803cc3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803cc7:	25 07 0e 00 00       	and    $0xe07,%eax
+  803ccc:	89 c1                	mov    %eax,%ecx
+  803cce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803cd2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803cd6:	41 89 c8             	mov    %ecx,%r8d
+  803cd9:	48 89 d1             	mov    %rdx,%rcx
+  803cdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ce1:	48 89 c6             	mov    %rax,%rsi
+  803ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ce9:	49 89 df             	mov    %rbx,%r15
+  803cec:	48 b8 ce 93 ff ff ff 	movabs $0xffffffffffff93ce,%rax
+  803cf3:	ff ff ff 
+  803cf6:	48 01 d8             	add    %rbx,%rax
+  803cf9:	ff d0                	call   *%rax
+  803cfb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cfe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d02:	78 08                	js     803d0c <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803d04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803d07:	eb 43                	jmp    803d4c <dup+0x1f6>
+			goto err;
+  803d09:	90                   	nop
+  803d0a:	eb 01                	jmp    803d0d <dup+0x1b7>
+		goto err;
+  803d0c:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803d0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d11:	48 89 c6             	mov    %rax,%rsi
+  803d14:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d19:	49 89 df             	mov    %rbx,%r15
+  803d1c:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  803d23:	ff ff ff 
+  803d26:	48 01 d8             	add    %rbx,%rax
+  803d29:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803d2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d2f:	48 89 c6             	mov    %rax,%rsi
+  803d32:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d37:	49 89 df             	mov    %rbx,%r15
+  803d3a:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  803d41:	ff ff ff 
+  803d44:	48 01 d8             	add    %rbx,%rax
+  803d47:	ff d0                	call   *%rax
+	return r;
+  803d49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803d4c:	48 83 c4 40          	add    $0x40,%rsp
+  803d50:	5b                   	pop    %rbx
+  803d51:	41 5f                	pop    %r15
+  803d53:	5d                   	pop    %rbp
+  803d54:	c3                   	ret
+
+0000000000803d55 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803d55:	55                   	push   %rbp
+  803d56:	48 89 e5             	mov    %rsp,%rbp
+  803d59:	41 57                	push   %r15
+  803d5b:	53                   	push   %rbx
+  803d5c:	48 83 ec 40          	sub    $0x40,%rsp
+  803d60:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d60 <read+0xb>
+  803d67:	49 bb e0 52 00 00 00 	movabs $0x52e0,%r11
+  803d6e:	00 00 00 
+  803d71:	4c 01 db             	add    %r11,%rbx
+  803d74:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803d77:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d7b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803d7f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803d83:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803d86:	48 89 d6             	mov    %rdx,%rsi
+  803d89:	89 c7                	mov    %eax,%edi
+  803d8b:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  803d92:	ff ff ff 
+  803d95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d99:	ff d0                	call   *%rax
+  803d9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d9e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803da2:	78 28                	js     803dcc <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803da4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803da8:	8b 00                	mov    (%rax),%eax
+  803daa:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803dae:	48 89 d6             	mov    %rdx,%rsi
+  803db1:	89 c7                	mov    %eax,%edi
+  803db3:	48 b8 74 a9 ff ff ff 	movabs $0xffffffffffffa974,%rax
+  803dba:	ff ff ff 
+  803dbd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dc1:	ff d0                	call   *%rax
+  803dc3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803dc6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803dca:	79 08                	jns    803dd4 <read+0x7f>
+		return r;
+  803dcc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dcf:	e9 8b 00 00 00       	jmp    803e5f <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803dd4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dd8:	8b 40 08             	mov    0x8(%rax),%eax
+  803ddb:	83 e0 03             	and    $0x3,%eax
+  803dde:	83 f8 01             	cmp    $0x1,%eax
+  803de1:	75 4b                	jne    803e2e <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803de3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803dea:	ff ff ff 
+  803ded:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803df1:	48 8b 00             	mov    (%rax),%rax
+  803df4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803dfa:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803dfd:	89 c6                	mov    %eax,%esi
+  803dff:	48 b8 ef e5 ff ff ff 	movabs $0xffffffffffffe5ef,%rax
+  803e06:	ff ff ff 
+  803e09:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e0d:	48 89 c7             	mov    %rax,%rdi
+  803e10:	49 89 df             	mov    %rbx,%r15
+  803e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e18:	48 b9 eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%rcx
+  803e1f:	ff ff ff 
+  803e22:	48 01 d9             	add    %rbx,%rcx
+  803e25:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803e27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e2c:	eb 31                	jmp    803e5f <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803e2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e32:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803e36:	48 85 c0             	test   %rax,%rax
+  803e39:	75 07                	jne    803e42 <read+0xed>
+		return -E_NOT_SUPP;
+  803e3b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803e40:	eb 1d                	jmp    803e5f <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803e42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e46:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803e4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e4e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e52:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e56:	48 89 ce             	mov    %rcx,%rsi
+  803e59:	48 89 c7             	mov    %rax,%rdi
+  803e5c:	41 ff d0             	call   *%r8
+}
+  803e5f:	48 83 c4 40          	add    $0x40,%rsp
+  803e63:	5b                   	pop    %rbx
+  803e64:	41 5f                	pop    %r15
+  803e66:	5d                   	pop    %rbp
+  803e67:	c3                   	ret
+
+0000000000803e68 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803e68:	55                   	push   %rbp
+  803e69:	48 89 e5             	mov    %rsp,%rbp
+  803e6c:	53                   	push   %rbx
+  803e6d:	48 83 ec 38          	sub    $0x38,%rsp
+  803e71:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e71 <readn+0x9>
+  803e78:	49 bb cf 51 00 00 00 	movabs $0x51cf,%r11
+  803e7f:	00 00 00 
+  803e82:	4c 01 db             	add    %r11,%rbx
+  803e85:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e88:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803e8c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803e90:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803e97:	eb 4b                	jmp    803ee4 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803e99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e9c:	48 98                	cltq
+  803e9e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803ea2:	48 29 c2             	sub    %rax,%rdx
+  803ea5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ea8:	48 63 c8             	movslq %eax,%rcx
+  803eab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803eaf:	48 01 c1             	add    %rax,%rcx
+  803eb2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803eb5:	48 89 ce             	mov    %rcx,%rsi
+  803eb8:	89 c7                	mov    %eax,%edi
+  803eba:	48 b8 15 ad ff ff ff 	movabs $0xffffffffffffad15,%rax
+  803ec1:	ff ff ff 
+  803ec4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ec8:	ff d0                	call   *%rax
+  803eca:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803ecd:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803ed1:	79 05                	jns    803ed8 <readn+0x70>
+			return m;
+  803ed3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ed6:	eb 1d                	jmp    803ef5 <readn+0x8d>
+		if (m == 0)
+  803ed8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803edc:	74 13                	je     803ef1 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803ede:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ee1:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803ee4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ee7:	48 98                	cltq
+  803ee9:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803eed:	72 aa                	jb     803e99 <readn+0x31>
+  803eef:	eb 01                	jmp    803ef2 <readn+0x8a>
+			break;
+  803ef1:	90                   	nop
+	}
+	return tot;
+  803ef2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803ef5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ef9:	c9                   	leave
+  803efa:	c3                   	ret
+
+0000000000803efb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803efb:	55                   	push   %rbp
+  803efc:	48 89 e5             	mov    %rsp,%rbp
+  803eff:	41 57                	push   %r15
+  803f01:	53                   	push   %rbx
+  803f02:	48 83 ec 40          	sub    $0x40,%rsp
+  803f06:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f06 <write+0xb>
+  803f0d:	49 bb 3a 51 00 00 00 	movabs $0x513a,%r11
+  803f14:	00 00 00 
+  803f17:	4c 01 db             	add    %r11,%rbx
+  803f1a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803f1d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803f21:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803f25:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803f29:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803f2c:	48 89 d6             	mov    %rdx,%rsi
+  803f2f:	89 c7                	mov    %eax,%edi
+  803f31:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  803f38:	ff ff ff 
+  803f3b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f3f:	ff d0                	call   *%rax
+  803f41:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f44:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f48:	78 28                	js     803f72 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f4e:	8b 00                	mov    (%rax),%eax
+  803f50:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f54:	48 89 d6             	mov    %rdx,%rsi
+  803f57:	89 c7                	mov    %eax,%edi
+  803f59:	48 b8 74 a9 ff ff ff 	movabs $0xffffffffffffa974,%rax
+  803f60:	ff ff ff 
+  803f63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f67:	ff d0                	call   *%rax
+  803f69:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f6c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f70:	79 08                	jns    803f7a <write+0x7f>
+		return r;
+  803f72:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f75:	e9 8a 00 00 00       	jmp    804004 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803f7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f7e:	8b 40 08             	mov    0x8(%rax),%eax
+  803f81:	83 e0 03             	and    $0x3,%eax
+  803f84:	85 c0                	test   %eax,%eax
+  803f86:	75 4b                	jne    803fd3 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803f88:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803f8f:	ff ff ff 
+  803f92:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f96:	48 8b 00             	mov    (%rax),%rax
+  803f99:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803f9f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803fa2:	89 c6                	mov    %eax,%esi
+  803fa4:	48 b8 0b e6 ff ff ff 	movabs $0xffffffffffffe60b,%rax
+  803fab:	ff ff ff 
+  803fae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fb2:	48 89 c7             	mov    %rax,%rdi
+  803fb5:	49 89 df             	mov    %rbx,%r15
+  803fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fbd:	48 b9 eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%rcx
+  803fc4:	ff ff ff 
+  803fc7:	48 01 d9             	add    %rbx,%rcx
+  803fca:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803fcc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fd1:	eb 31                	jmp    804004 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803fd3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fd7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803fdb:	48 85 c0             	test   %rax,%rax
+  803fde:	75 07                	jne    803fe7 <write+0xec>
+		return -E_NOT_SUPP;
+  803fe0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803fe5:	eb 1d                	jmp    804004 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803fe7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803feb:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803fef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ff3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803ff7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803ffb:	48 89 ce             	mov    %rcx,%rsi
+  803ffe:	48 89 c7             	mov    %rax,%rdi
+  804001:	41 ff d0             	call   *%r8
+}
+  804004:	48 83 c4 40          	add    $0x40,%rsp
+  804008:	5b                   	pop    %rbx
+  804009:	41 5f                	pop    %r15
+  80400b:	5d                   	pop    %rbp
+  80400c:	c3                   	ret
+
+000000000080400d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80400d:	55                   	push   %rbp
+  80400e:	48 89 e5             	mov    %rsp,%rbp
+  804011:	48 83 ec 18          	sub    $0x18,%rsp
+  804015:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804015 <seek+0x8>
+  80401c:	49 bb 2b 50 00 00 00 	movabs $0x502b,%r11
+  804023:	00 00 00 
+  804026:	4c 01 d8             	add    %r11,%rax
+  804029:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80402c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80402f:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  804033:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804036:	48 89 ce             	mov    %rcx,%rsi
+  804039:	89 d7                	mov    %edx,%edi
+  80403b:	48 ba ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rdx
+  804042:	ff ff ff 
+  804045:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804049:	ff d0                	call   *%rax
+  80404b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80404e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804052:	79 05                	jns    804059 <seek+0x4c>
+		return r;
+  804054:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804057:	eb 0f                	jmp    804068 <seek+0x5b>
+	fd->fd_offset = offset;
+  804059:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80405d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804060:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  804063:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804068:	c9                   	leave
+  804069:	c3                   	ret
+
+000000000080406a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80406a:	55                   	push   %rbp
+  80406b:	48 89 e5             	mov    %rsp,%rbp
+  80406e:	41 57                	push   %r15
+  804070:	53                   	push   %rbx
+  804071:	48 83 ec 30          	sub    $0x30,%rsp
+  804075:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804075 <ftruncate+0xb>
+  80407c:	49 bb cb 4f 00 00 00 	movabs $0x4fcb,%r11
+  804083:	00 00 00 
+  804086:	4c 01 db             	add    %r11,%rbx
+  804089:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80408c:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80408f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804093:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804096:	48 89 d6             	mov    %rdx,%rsi
+  804099:	89 c7                	mov    %eax,%edi
+  80409b:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  8040a2:	ff ff ff 
+  8040a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040a9:	ff d0                	call   *%rax
+  8040ab:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040b2:	78 28                	js     8040dc <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8040b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040b8:	8b 00                	mov    (%rax),%eax
+  8040ba:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8040be:	48 89 d6             	mov    %rdx,%rsi
+  8040c1:	89 c7                	mov    %eax,%edi
+  8040c3:	48 b8 74 a9 ff ff ff 	movabs $0xffffffffffffa974,%rax
+  8040ca:	ff ff ff 
+  8040cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040d1:	ff d0                	call   *%rax
+  8040d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040da:	79 08                	jns    8040e4 <ftruncate+0x7a>
+		return r;
+  8040dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040df:	e9 83 00 00 00       	jmp    804167 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8040e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e8:	8b 40 08             	mov    0x8(%rax),%eax
+  8040eb:	83 e0 03             	and    $0x3,%eax
+  8040ee:	85 c0                	test   %eax,%eax
+  8040f0:	75 4b                	jne    80413d <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8040f2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8040f9:	ff ff ff 
+  8040fc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804100:	48 8b 00             	mov    (%rax),%rax
+  804103:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804109:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80410c:	89 c6                	mov    %eax,%esi
+  80410e:	48 b8 28 e6 ff ff ff 	movabs $0xffffffffffffe628,%rax
+  804115:	ff ff ff 
+  804118:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80411c:	48 89 c7             	mov    %rax,%rdi
+  80411f:	49 89 df             	mov    %rbx,%r15
+  804122:	b8 00 00 00 00       	mov    $0x0,%eax
+  804127:	48 b9 eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%rcx
+  80412e:	ff ff ff 
+  804131:	48 01 d9             	add    %rbx,%rcx
+  804134:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804136:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80413b:	eb 2a                	jmp    804167 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80413d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804141:	48 8b 40 30          	mov    0x30(%rax),%rax
+  804145:	48 85 c0             	test   %rax,%rax
+  804148:	75 07                	jne    804151 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  80414a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80414f:	eb 16                	jmp    804167 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  804151:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804155:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804159:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80415d:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804160:	89 d6                	mov    %edx,%esi
+  804162:	48 89 c7             	mov    %rax,%rdi
+  804165:	ff d1                	call   *%rcx
+}
+  804167:	48 83 c4 30          	add    $0x30,%rsp
+  80416b:	5b                   	pop    %rbx
+  80416c:	41 5f                	pop    %r15
+  80416e:	5d                   	pop    %rbp
+  80416f:	c3                   	ret
+
+0000000000804170 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804170:	55                   	push   %rbp
+  804171:	48 89 e5             	mov    %rsp,%rbp
+  804174:	53                   	push   %rbx
+  804175:	48 83 ec 38          	sub    $0x38,%rsp
+  804179:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804179 <fstat+0x9>
+  804180:	49 bb c7 4e 00 00 00 	movabs $0x4ec7,%r11
+  804187:	00 00 00 
+  80418a:	4c 01 db             	add    %r11,%rbx
+  80418d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804190:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804194:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804198:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80419b:	48 89 d6             	mov    %rdx,%rsi
+  80419e:	89 c7                	mov    %eax,%edi
+  8041a0:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  8041a7:	ff ff ff 
+  8041aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041ae:	ff d0                	call   *%rax
+  8041b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041b7:	78 28                	js     8041e1 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8041b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8041bd:	8b 00                	mov    (%rax),%eax
+  8041bf:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8041c3:	48 89 d6             	mov    %rdx,%rsi
+  8041c6:	89 c7                	mov    %eax,%edi
+  8041c8:	48 b8 74 a9 ff ff ff 	movabs $0xffffffffffffa974,%rax
+  8041cf:	ff ff ff 
+  8041d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041d6:	ff d0                	call   *%rax
+  8041d8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041db:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041df:	79 05                	jns    8041e6 <fstat+0x76>
+		return r;
+  8041e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041e4:	eb 5e                	jmp    804244 <fstat+0xd4>
+	if (!dev->dev_stat)
+  8041e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041ea:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8041ee:	48 85 c0             	test   %rax,%rax
+  8041f1:	75 07                	jne    8041fa <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8041f3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8041f8:	eb 4a                	jmp    804244 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8041fa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041fe:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804201:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804205:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80420c:	00 00 00 
+	stat->st_isdir = 0;
+  80420f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804213:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80421a:	00 00 00 
+	stat->st_dev = dev;
+  80421d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804221:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804225:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80422c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804230:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804234:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804238:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80423c:	48 89 d6             	mov    %rdx,%rsi
+  80423f:	48 89 c7             	mov    %rax,%rdi
+  804242:	ff d1                	call   *%rcx
+}
+  804244:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804248:	c9                   	leave
+  804249:	c3                   	ret
+
+000000000080424a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80424a:	55                   	push   %rbp
+  80424b:	48 89 e5             	mov    %rsp,%rbp
+  80424e:	41 57                	push   %r15
+  804250:	53                   	push   %rbx
+  804251:	48 83 ec 20          	sub    $0x20,%rsp
+  804255:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804255 <stat+0xb>
+  80425c:	49 bb eb 4d 00 00 00 	movabs $0x4deb,%r11
+  804263:	00 00 00 
+  804266:	4c 01 db             	add    %r11,%rbx
+  804269:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80426d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804271:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804275:	be 00 00 00 00       	mov    $0x0,%esi
+  80427a:	48 89 c7             	mov    %rax,%rdi
+  80427d:	49 89 df             	mov    %rbx,%r15
+  804280:	48 b8 e4 b4 ff ff ff 	movabs $0xffffffffffffb4e4,%rax
+  804287:	ff ff ff 
+  80428a:	48 01 d8             	add    %rbx,%rax
+  80428d:	ff d0                	call   *%rax
+  80428f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804292:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804296:	79 05                	jns    80429d <stat+0x53>
+		return fd;
+  804298:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80429b:	eb 37                	jmp    8042d4 <stat+0x8a>
+	r = fstat(fd, stat);
+  80429d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8042a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042a4:	48 89 d6             	mov    %rdx,%rsi
+  8042a7:	89 c7                	mov    %eax,%edi
+  8042a9:	48 b8 30 b1 ff ff ff 	movabs $0xffffffffffffb130,%rax
+  8042b0:	ff ff ff 
+  8042b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042b7:	ff d0                	call   *%rax
+  8042b9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8042bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042bf:	89 c7                	mov    %eax,%edi
+  8042c1:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  8042c8:	ff ff ff 
+  8042cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042cf:	ff d0                	call   *%rax
+	return r;
+  8042d1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8042d4:	48 83 c4 20          	add    $0x20,%rsp
+  8042d8:	5b                   	pop    %rbx
+  8042d9:	41 5f                	pop    %r15
+  8042db:	5d                   	pop    %rbp
+  8042dc:	c3                   	ret
+
+00000000008042dd <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8042dd:	55                   	push   %rbp
+  8042de:	48 89 e5             	mov    %rsp,%rbp
+  8042e1:	41 57                	push   %r15
+  8042e3:	53                   	push   %rbx
+  8042e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8042e8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042e8 <fsipc+0xb>
+  8042ef:	49 bb 58 4d 00 00 00 	movabs $0x4d58,%r11
+  8042f6:	00 00 00 
+  8042f9:	4c 01 db             	add    %r11,%rbx
+  8042fc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8042ff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804303:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80430a:	00 00 00 
+  80430d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804310:	85 c0                	test   %eax,%eax
+  804312:	75 24                	jne    804338 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804314:	bf 01 00 00 00       	mov    $0x1,%edi
+  804319:	49 89 df             	mov    %rbx,%r15
+  80431c:	48 b8 66 de ff ff ff 	movabs $0xffffffffffffde66,%rax
+  804323:	ff ff ff 
+  804326:	48 01 d8             	add    %rbx,%rax
+  804329:	ff d0                	call   *%rax
+  80432b:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804332:	00 00 00 
+  804335:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  804338:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80433f:	00 00 00 
+  804342:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804345:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804349:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80434c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804352:	49 89 d0             	mov    %rdx,%r8
+  804355:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80435a:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804361:	00 00 00 
+  804364:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804368:	89 c7                	mov    %eax,%edi
+  80436a:	49 89 df             	mov    %rbx,%r15
+  80436d:	48 b8 85 d8 ff ff ff 	movabs $0xffffffffffffd885,%rax
+  804374:	ff ff ff 
+  804377:	48 01 d8             	add    %rbx,%rax
+  80437a:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  80437c:	48 83 c4 10          	add    $0x10,%rsp
+  804380:	5b                   	pop    %rbx
+  804381:	41 5f                	pop    %r15
+  804383:	5d                   	pop    %rbp
+  804384:	c3                   	ret
+
+0000000000804385 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804385:	55                   	push   %rbp
+  804386:	48 89 e5             	mov    %rsp,%rbp
+  804389:	41 57                	push   %r15
+  80438b:	53                   	push   %rbx
+  80438c:	48 83 ec 20          	sub    $0x20,%rsp
+  804390:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804390 <fsipc_words+0xb>
+  804397:	49 bb b0 4c 00 00 00 	movabs $0x4cb0,%r11
+  80439e:	00 00 00 
+  8043a1:	4c 01 db             	add    %r11,%rbx
+  8043a4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8043a7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8043ab:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8043af:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8043b6:	00 00 00 
+  8043b9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8043bc:	85 c0                	test   %eax,%eax
+  8043be:	75 24                	jne    8043e4 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8043c0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8043c5:	49 89 df             	mov    %rbx,%r15
+  8043c8:	48 b8 66 de ff ff ff 	movabs $0xffffffffffffde66,%rax
+  8043cf:	ff ff ff 
+  8043d2:	48 01 d8             	add    %rbx,%rax
+  8043d5:	ff d0                	call   *%rax
+  8043d7:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8043de:	00 00 00 
+  8043e1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8043e4:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8043eb:	00 00 00 
+  8043ee:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8043f1:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8043f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8043f9:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8043fc:	89 c7                	mov    %eax,%edi
+  8043fe:	49 89 df             	mov    %rbx,%r15
+  804401:	48 b8 70 d9 ff ff ff 	movabs $0xffffffffffffd970,%rax
+  804408:	ff ff ff 
+  80440b:	48 01 d8             	add    %rbx,%rax
+  80440e:	ff d0                	call   *%rax
+}
+  804410:	48 83 c4 20          	add    $0x20,%rsp
+  804414:	5b                   	pop    %rbx
+  804415:	41 5f                	pop    %r15
+  804417:	5d                   	pop    %rbp
+  804418:	c3                   	ret
+
+0000000000804419 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804419:	55                   	push   %rbp
+  80441a:	48 89 e5             	mov    %rsp,%rbp
+  80441d:	41 57                	push   %r15
+  80441f:	53                   	push   %rbx
+  804420:	48 83 ec 40          	sub    $0x40,%rsp
+  804424:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804424 <fsipc_pages+0xb>
+  80442b:	49 bb 1c 4c 00 00 00 	movabs $0x4c1c,%r11
+  804432:	00 00 00 
+  804435:	4c 01 db             	add    %r11,%rbx
+  804438:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80443b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80443f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804443:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804446:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80444d:	00 00 00 
+  804450:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804453:	85 c0                	test   %eax,%eax
+  804455:	75 24                	jne    80447b <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804457:	bf 01 00 00 00       	mov    $0x1,%edi
+  80445c:	49 89 df             	mov    %rbx,%r15
+  80445f:	48 b8 66 de ff ff ff 	movabs $0xffffffffffffde66,%rax
+  804466:	ff ff ff 
+  804469:	48 01 d8             	add    %rbx,%rax
+  80446c:	ff d0                	call   *%rax
+  80446e:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804475:	00 00 00 
+  804478:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  80447b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804480:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804484:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804487:	48 98                	cltq
+  804489:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80448d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804491:	0f 95 c0             	setne  %al
+  804494:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804497:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80449e:	00 
+  80449f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8044a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044a7:	48 01 d0             	add    %rdx,%rax
+  8044aa:	48 83 e8 01          	sub    $0x1,%rax
+  8044ae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8044b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044bb:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8044bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044c3:	48 29 d0             	sub    %rdx,%rax
+  8044c6:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8044ca:	41 89 c2             	mov    %eax,%r10d
+  8044cd:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8044d4:	00 00 00 
+  8044d7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8044da:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8044de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8044e2:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8044e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8044e9:	6a 40                	push   $0x40
+  8044eb:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8044f0:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8044f7:	00 
+  8044f8:	6a 05                	push   $0x5
+  8044fa:	41 89 f9             	mov    %edi,%r9d
+  8044fd:	49 89 c8             	mov    %rcx,%r8
+  804500:	44 89 d1             	mov    %r10d,%ecx
+  804503:	89 c7                	mov    %eax,%edi
+  804505:	49 89 df             	mov    %rbx,%r15
+  804508:	48 b8 6e da ff ff ff 	movabs $0xffffffffffffda6e,%rax
+  80450f:	ff ff ff 
+  804512:	48 01 d8             	add    %rbx,%rax
+  804515:	ff d0                	call   *%rax
+  804517:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80451b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80451f:	5b                   	pop    %rbx
+  804520:	41 5f                	pop    %r15
+  804522:	5d                   	pop    %rbp
+  804523:	c3                   	ret
+
+0000000000804524 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804524:	55                   	push   %rbp
+  804525:	48 89 e5             	mov    %rsp,%rbp
+  804528:	41 57                	push   %r15
+  80452a:	53                   	push   %rbx
+  80452b:	48 83 ec 20          	sub    $0x20,%rsp
+  80452f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80452f <open+0xb>
+  804536:	49 bb 11 4b 00 00 00 	movabs $0x4b11,%r11
+  80453d:	00 00 00 
+  804540:	4c 01 db             	add    %r11,%rbx
+  804543:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804547:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  80454a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80454e:	48 89 c7             	mov    %rax,%rdi
+  804551:	49 89 df             	mov    %rbx,%r15
+  804554:	48 b8 19 86 ff ff ff 	movabs $0xffffffffffff8619,%rax
+  80455b:	ff ff ff 
+  80455e:	48 01 d8             	add    %rbx,%rax
+  804561:	ff d0                	call   *%rax
+  804563:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804568:	7e 0a                	jle    804574 <open+0x50>
+		return -E_BAD_PATH;
+  80456a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80456f:	e9 18 01 00 00       	jmp    80468c <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804574:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804578:	48 89 c7             	mov    %rax,%rdi
+  80457b:	49 89 df             	mov    %rbx,%r15
+  80457e:	48 b8 18 a7 ff ff ff 	movabs $0xffffffffffffa718,%rax
+  804585:	ff ff ff 
+  804588:	48 01 d8             	add    %rbx,%rax
+  80458b:	ff d0                	call   *%rax
+  80458d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804590:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804594:	74 08                	je     80459e <open+0x7a>
+		return r;
+  804596:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804599:	e9 ee 00 00 00       	jmp    80468c <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80459e:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8045a5:	00 00 00 
+  8045a8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045ab:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8045b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045b6:	48 89 c6             	mov    %rax,%rsi
+  8045b9:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8045c0:	00 00 00 
+  8045c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045c7:	48 89 c7             	mov    %rax,%rdi
+  8045ca:	49 89 df             	mov    %rbx,%r15
+  8045cd:	48 b8 ad 86 ff ff ff 	movabs $0xffffffffffff86ad,%rax
+  8045d4:	ff ff ff 
+  8045d7:	48 01 d8             	add    %rbx,%rax
+  8045da:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8045dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045e0:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  8045e5:	48 89 c6             	mov    %rax,%rsi
+  8045e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ed:	49 89 df             	mov    %rbx,%r15
+  8045f0:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  8045f7:	ff ff ff 
+  8045fa:	48 01 d8             	add    %rbx,%rax
+  8045fd:	ff d0                	call   *%rax
+  8045ff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804602:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804606:	74 23                	je     80462b <open+0x107>
+		fd_close(fd,0);
+  804608:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80460c:	be 00 00 00 00       	mov    $0x0,%esi
+  804611:	48 89 c7             	mov    %rax,%rdi
+  804614:	49 89 df             	mov    %rbx,%r15
+  804617:	48 b8 79 a8 ff ff ff 	movabs $0xffffffffffffa879,%rax
+  80461e:	ff ff ff 
+  804621:	48 01 d8             	add    %rbx,%rax
+  804624:	ff d0                	call   *%rax
+		return r;
+  804626:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804629:	eb 61                	jmp    80468c <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80462b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80462f:	48 89 c6             	mov    %rax,%rsi
+  804632:	bf 01 00 00 00       	mov    $0x1,%edi
+  804637:	48 b8 9d b2 ff ff ff 	movabs $0xffffffffffffb29d,%rax
+  80463e:	ff ff ff 
+  804641:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804645:	ff d0                	call   *%rax
+  804647:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80464a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80464e:	74 23                	je     804673 <open+0x14f>
+		fd_close(fd,0);
+  804650:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804654:	be 00 00 00 00       	mov    $0x0,%esi
+  804659:	48 89 c7             	mov    %rax,%rdi
+  80465c:	49 89 df             	mov    %rbx,%r15
+  80465f:	48 b8 79 a8 ff ff ff 	movabs $0xffffffffffffa879,%rax
+  804666:	ff ff ff 
+  804669:	48 01 d8             	add    %rbx,%rax
+  80466c:	ff d0                	call   *%rax
+		return r;
+  80466e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804671:	eb 19                	jmp    80468c <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804673:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804677:	48 89 c7             	mov    %rax,%rdi
+  80467a:	49 89 df             	mov    %rbx,%r15
+  80467d:	48 b8 9e a6 ff ff ff 	movabs $0xffffffffffffa69e,%rax
+  804684:	ff ff ff 
+  804687:	48 01 d8             	add    %rbx,%rax
+  80468a:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  80468c:	48 83 c4 20          	add    $0x20,%rsp
+  804690:	5b                   	pop    %rbx
+  804691:	41 5f                	pop    %r15
+  804693:	5d                   	pop    %rbp
+  804694:	c3                   	ret
+
+0000000000804695 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804695:	55                   	push   %rbp
+  804696:	48 89 e5             	mov    %rsp,%rbp
+  804699:	48 83 ec 20          	sub    $0x20,%rsp
+  80469d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80469d <devfile_flush+0x8>
+  8046a4:	49 bb a3 49 00 00 00 	movabs $0x49a3,%r11
+  8046ab:	00 00 00 
+  8046ae:	4c 01 d8             	add    %r11,%rax
+  8046b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8046b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8046b9:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8046bc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8046bf:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8046c3:	ba 04 00 00 00       	mov    $0x4,%edx
+  8046c8:	48 89 ce             	mov    %rcx,%rsi
+  8046cb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8046d0:	48 b9 45 b3 ff ff ff 	movabs $0xffffffffffffb345,%rcx
+  8046d7:	ff ff ff 
+  8046da:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8046de:	ff d0                	call   *%rax
+}
+  8046e0:	c9                   	leave
+  8046e1:	c3                   	ret
+
+00000000008046e2 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  8046e2:	55                   	push   %rbp
+  8046e3:	48 89 e5             	mov    %rsp,%rbp
+  8046e6:	41 57                	push   %r15
+  8046e8:	53                   	push   %rbx
+  8046e9:	48 83 ec 60          	sub    $0x60,%rsp
+  8046ed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046ed <devfile_read+0xb>
+  8046f4:	49 bb 53 49 00 00 00 	movabs $0x4953,%r11
+  8046fb:	00 00 00 
+  8046fe:	4c 01 db             	add    %r11,%rbx
+  804701:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804705:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804709:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80470d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804711:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804715:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804719:	8b 50 0c             	mov    0xc(%rax),%edx
+  80471c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804720:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804722:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804726:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80472a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  80472e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804732:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804737:	ba 10 00 00 00       	mov    $0x10,%edx
+  80473c:	48 89 c6             	mov    %rax,%rsi
+  80473f:	bf 03 00 00 00       	mov    $0x3,%edi
+  804744:	48 b8 d9 b3 ff ff ff 	movabs $0xffffffffffffb3d9,%rax
+  80474b:	ff ff ff 
+  80474e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804752:	ff d0                	call   *%rax
+  804754:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804757:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80475b:	79 05                	jns    804762 <devfile_read+0x80>
+		return r;
+  80475d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804760:	eb 64                	jmp    8047c6 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804762:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804765:	48 63 d0             	movslq %eax,%rdx
+  804768:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80476c:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804771:	48 01 c1             	add    %rax,%rcx
+  804774:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804778:	48 89 ce             	mov    %rcx,%rsi
+  80477b:	48 89 c7             	mov    %rax,%rdi
+  80477e:	49 89 df             	mov    %rbx,%r15
+  804781:	48 b8 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rax
+  804788:	ff ff ff 
+  80478b:	48 01 d8             	add    %rbx,%rax
+  80478e:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804790:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804797:	ff ff ff 
+  80479a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80479e:	48 8b 00             	mov    (%rax),%rax
+  8047a1:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8047a7:	89 c6                	mov    %eax,%esi
+  8047a9:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8047ae:	48 89 c7             	mov    %rax,%rdi
+  8047b1:	49 89 df             	mov    %rbx,%r15
+  8047b4:	48 b8 20 de ff ff ff 	movabs $0xffffffffffffde20,%rax
+  8047bb:	ff ff ff 
+  8047be:	48 01 d8             	add    %rbx,%rax
+  8047c1:	ff d0                	call   *%rax
+	return r;
+  8047c3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8047c6:	48 83 c4 60          	add    $0x60,%rsp
+  8047ca:	5b                   	pop    %rbx
+  8047cb:	41 5f                	pop    %r15
+  8047cd:	5d                   	pop    %rbp
+  8047ce:	c3                   	ret
+
+00000000008047cf <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8047cf:	55                   	push   %rbp
+  8047d0:	48 89 e5             	mov    %rsp,%rbp
+  8047d3:	41 57                	push   %r15
+  8047d5:	53                   	push   %rbx
+  8047d6:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  8047da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047da <devfile_write+0xb>
+  8047e1:	49 bb 66 48 00 00 00 	movabs $0x4866,%r11
+  8047e8:	00 00 00 
+  8047eb:	4c 01 db             	add    %r11,%rbx
+  8047ee:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  8047f2:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  8047f6:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  8047fd:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804801:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804805:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  80480c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804810:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804817:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80481a:	48 63 d0             	movslq %eax,%rdx
+  80481d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804821:	48 39 c2             	cmp    %rax,%rdx
+  804824:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804828:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80482f:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804836:	00 
+  804837:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80483e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804842:	48 01 d0             	add    %rdx,%rax
+  804845:	48 83 e8 01          	sub    $0x1,%rax
+  804849:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80484d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804851:	ba 00 00 00 00       	mov    $0x0,%edx
+  804856:	48 f7 75 d0          	divq   -0x30(%rbp)
+  80485a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80485e:	48 29 d0             	sub    %rdx,%rax
+  804861:	48 c1 e8 0c          	shr    $0xc,%rax
+  804865:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804868:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80486b:	89 c6                	mov    %eax,%esi
+  80486d:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804872:	48 89 c7             	mov    %rax,%rdi
+  804875:	49 89 df             	mov    %rbx,%r15
+  804878:	48 b8 da dd ff ff ff 	movabs $0xffffffffffffddda,%rax
+  80487f:	ff ff ff 
+  804882:	48 01 d8             	add    %rbx,%rax
+  804885:	ff d0                	call   *%rax
+  804887:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  80488a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  80488e:	79 08                	jns    804898 <devfile_write+0xc9>
+		return r;
+  804890:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804893:	e9 8f 00 00 00       	jmp    804927 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804898:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80489f:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8048a3:	48 89 c6             	mov    %rax,%rsi
+  8048a6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8048ab:	48 89 c7             	mov    %rax,%rdi
+  8048ae:	49 89 df             	mov    %rbx,%r15
+  8048b1:	48 b8 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rax
+  8048b8:	ff ff ff 
+  8048bb:	48 01 d8             	add    %rbx,%rax
+  8048be:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8048c0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8048c4:	8b 50 0c             	mov    0xc(%rax),%edx
+  8048c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048cb:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8048cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048d1:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8048d8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  8048dc:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  8048df:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8048e3:	89 d1                	mov    %edx,%ecx
+  8048e5:	ba 10 00 00 00       	mov    $0x10,%edx
+  8048ea:	48 89 c6             	mov    %rax,%rsi
+  8048ed:	bf 04 00 00 00       	mov    $0x4,%edi
+  8048f2:	48 b8 d9 b3 ff ff ff 	movabs $0xffffffffffffb3d9,%rax
+  8048f9:	ff ff ff 
+  8048fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804900:	ff d0                	call   *%rax
+  804902:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804905:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804908:	89 c6                	mov    %eax,%esi
+  80490a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80490f:	48 89 c7             	mov    %rax,%rdi
+  804912:	49 89 df             	mov    %rbx,%r15
+  804915:	48 b8 20 de ff ff ff 	movabs $0xffffffffffffde20,%rax
+  80491c:	ff ff ff 
+  80491f:	48 01 d8             	add    %rbx,%rax
+  804922:	ff d0                	call   *%rax
+	return r;
+  804924:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804927:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  80492b:	5b                   	pop    %rbx
+  80492c:	41 5f                	pop    %r15
+  80492e:	5d                   	pop    %rbp
+  80492f:	c3                   	ret
+
+0000000000804930 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804930:	55                   	push   %rbp
+  804931:	48 89 e5             	mov    %rsp,%rbp
+  804934:	41 57                	push   %r15
+  804936:	53                   	push   %rbx
+  804937:	48 83 ec 20          	sub    $0x20,%rsp
+  80493b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80493b <devfile_stat+0xb>
+  804942:	49 bb 05 47 00 00 00 	movabs $0x4705,%r11
+  804949:	00 00 00 
+  80494c:	4c 01 db             	add    %r11,%rbx
+  80494f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804953:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804957:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80495b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80495e:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804965:	00 00 00 
+  804968:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80496b:	be 00 00 00 00       	mov    $0x0,%esi
+  804970:	bf 05 00 00 00       	mov    $0x5,%edi
+  804975:	48 b8 9d b2 ff ff ff 	movabs $0xffffffffffffb29d,%rax
+  80497c:	ff ff ff 
+  80497f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804983:	ff d0                	call   *%rax
+  804985:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804988:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80498c:	79 05                	jns    804993 <devfile_stat+0x63>
+		return r;
+  80498e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804991:	eb 65                	jmp    8049f8 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804993:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804997:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80499e:	00 00 00 
+  8049a1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8049a5:	48 89 d6             	mov    %rdx,%rsi
+  8049a8:	48 89 c7             	mov    %rax,%rdi
+  8049ab:	49 89 df             	mov    %rbx,%r15
+  8049ae:	48 b8 ad 86 ff ff ff 	movabs $0xffffffffffff86ad,%rax
+  8049b5:	ff ff ff 
+  8049b8:	48 01 d8             	add    %rbx,%rax
+  8049bb:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8049bd:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8049c4:	00 00 00 
+  8049c7:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8049ce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049d2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8049d8:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8049df:	00 00 00 
+  8049e2:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  8049e9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049ed:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  8049f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049f8:	48 83 c4 20          	add    $0x20,%rsp
+  8049fc:	5b                   	pop    %rbx
+  8049fd:	41 5f                	pop    %r15
+  8049ff:	5d                   	pop    %rbp
+  804a00:	c3                   	ret
+
+0000000000804a01 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804a01:	55                   	push   %rbp
+  804a02:	48 89 e5             	mov    %rsp,%rbp
+  804a05:	48 83 ec 20          	sub    $0x20,%rsp
+  804a09:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a09 <devfile_trunc+0x8>
+  804a10:	49 bb 37 46 00 00 00 	movabs $0x4637,%r11
+  804a17:	00 00 00 
+  804a1a:	4c 01 d8             	add    %r11,%rax
+  804a1d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804a21:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804a24:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a28:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804a2b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804a2e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804a31:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804a34:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804a38:	ba 08 00 00 00       	mov    $0x8,%edx
+  804a3d:	48 89 ce             	mov    %rcx,%rsi
+  804a40:	bf 02 00 00 00       	mov    $0x2,%edi
+  804a45:	48 b9 45 b3 ff ff ff 	movabs $0xffffffffffffb345,%rcx
+  804a4c:	ff ff ff 
+  804a4f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804a53:	ff d0                	call   *%rax
+}
+  804a55:	c9                   	leave
+  804a56:	c3                   	ret
+
+0000000000804a57 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  804a57:	55                   	push   %rbp
+  804a58:	48 89 e5             	mov    %rsp,%rbp
+  804a5b:	41 57                	push   %r15
+  804a5d:	53                   	push   %rbx
+  804a5e:	48 83 ec 10          	sub    $0x10,%rsp
+  804a62:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a62 <remove+0xb>
+  804a69:	49 bb de 45 00 00 00 	movabs $0x45de,%r11
+  804a70:	00 00 00 
+  804a73:	4c 01 db             	add    %r11,%rbx
+  804a76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  804a7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a7e:	48 89 c7             	mov    %rax,%rdi
+  804a81:	49 89 df             	mov    %rbx,%r15
+  804a84:	48 b8 19 86 ff ff ff 	movabs $0xffffffffffff8619,%rax
+  804a8b:	ff ff ff 
+  804a8e:	48 01 d8             	add    %rbx,%rax
+  804a91:	ff d0                	call   *%rax
+  804a93:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804a98:	7e 07                	jle    804aa1 <remove+0x4a>
+		return -E_BAD_PATH;
+  804a9a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804a9f:	eb 44                	jmp    804ae5 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804aa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aa5:	48 89 c6             	mov    %rax,%rsi
+  804aa8:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804aaf:	00 00 00 
+  804ab2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ab6:	48 89 c7             	mov    %rax,%rdi
+  804ab9:	49 89 df             	mov    %rbx,%r15
+  804abc:	48 b8 ad 86 ff ff ff 	movabs $0xffffffffffff86ad,%rax
+  804ac3:	ff ff ff 
+  804ac6:	48 01 d8             	add    %rbx,%rax
+  804ac9:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804acb:	be 00 00 00 00       	mov    $0x0,%esi
+  804ad0:	bf 07 00 00 00       	mov    $0x7,%edi
+  804ad5:	48 b8 9d b2 ff ff ff 	movabs $0xffffffffffffb29d,%rax
+  804adc:	ff ff ff 
+  804adf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ae3:	ff d0                	call   *%rax
+}
+  804ae5:	48 83 c4 10          	add    $0x10,%rsp
+  804ae9:	5b                   	pop    %rbx
+  804aea:	41 5f                	pop    %r15
+  804aec:	5d                   	pop    %rbp
+  804aed:	c3                   	ret
+
+0000000000804aee <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804aee:	55                   	push   %rbp
+  804aef:	48 89 e5             	mov    %rsp,%rbp
+  804af2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804af2 <sync+0x4>
+  804af9:	49 bb 4e 45 00 00 00 	movabs $0x454e,%r11
+  804b00:	00 00 00 
+  804b03:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804b06:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b0b:	be 00 00 00 00       	mov    $0x0,%esi
+  804b10:	bf 08 00 00 00       	mov    $0x8,%edi
+  804b15:	48 b9 45 b3 ff ff ff 	movabs $0xffffffffffffb345,%rcx
+  804b1c:	ff ff ff 
+  804b1f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804b23:	ff d0                	call   *%rax
+}
+  804b25:	5d                   	pop    %rbp
+  804b26:	c3                   	ret
+
+0000000000804b27 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804b27:	55                   	push   %rbp
+  804b28:	48 89 e5             	mov    %rsp,%rbp
+  804b2b:	41 57                	push   %r15
+  804b2d:	53                   	push   %rbx
+  804b2e:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804b35:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b35 <copy+0xe>
+  804b3c:	49 bb 0b 45 00 00 00 	movabs $0x450b,%r11
+  804b43:	00 00 00 
+  804b46:	4c 01 db             	add    %r11,%rbx
+  804b49:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804b50:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  804b57:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804b5e:	be 00 00 00 00       	mov    $0x0,%esi
+  804b63:	48 89 c7             	mov    %rax,%rdi
+  804b66:	48 b8 e4 b4 ff ff ff 	movabs $0xffffffffffffb4e4,%rax
+  804b6d:	ff ff ff 
+  804b70:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b74:	ff d0                	call   *%rax
+  804b76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  804b79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b7d:	79 35                	jns    804bb4 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  804b7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b82:	89 c6                	mov    %eax,%esi
+  804b84:	48 b8 4e e6 ff ff ff 	movabs $0xffffffffffffe64e,%rax
+  804b8b:	ff ff ff 
+  804b8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b92:	48 89 c7             	mov    %rax,%rdi
+  804b95:	49 89 df             	mov    %rbx,%r15
+  804b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b9d:	48 ba eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%rdx
+  804ba4:	ff ff ff 
+  804ba7:	48 01 da             	add    %rbx,%rdx
+  804baa:	ff d2                	call   *%rdx
+		return fd_src;
+  804bac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804baf:	e9 d7 01 00 00       	jmp    804d8b <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804bb4:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804bbb:	be 01 01 00 00       	mov    $0x101,%esi
+  804bc0:	48 89 c7             	mov    %rax,%rdi
+  804bc3:	48 b8 e4 b4 ff ff ff 	movabs $0xffffffffffffb4e4,%rax
+  804bca:	ff ff ff 
+  804bcd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bd1:	ff d0                	call   *%rax
+  804bd3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804bd6:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804bda:	0f 89 df 00 00 00    	jns    804cbf <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804be0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804be3:	89 c6                	mov    %eax,%esi
+  804be5:	48 b8 64 e6 ff ff ff 	movabs $0xffffffffffffe664,%rax
+  804bec:	ff ff ff 
+  804bef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bf3:	48 89 c7             	mov    %rax,%rdi
+  804bf6:	49 89 df             	mov    %rbx,%r15
+  804bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bfe:	48 ba eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%rdx
+  804c05:	ff ff ff 
+  804c08:	48 01 da             	add    %rbx,%rdx
+  804c0b:	ff d2                	call   *%rdx
+		close(fd_src);
+  804c0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c10:	89 c7                	mov    %eax,%edi
+  804c12:	49 89 df             	mov    %rbx,%r15
+  804c15:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  804c1c:	ff ff ff 
+  804c1f:	48 01 d8             	add    %rbx,%rax
+  804c22:	ff d0                	call   *%rax
+		return fd_dest;
+  804c24:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c27:	e9 5f 01 00 00       	jmp    804d8b <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804c2c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c2f:	48 63 d0             	movslq %eax,%rdx
+  804c32:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804c39:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c3c:	48 89 ce             	mov    %rcx,%rsi
+  804c3f:	89 c7                	mov    %eax,%edi
+  804c41:	49 89 df             	mov    %rbx,%r15
+  804c44:	48 b8 bb ae ff ff ff 	movabs $0xffffffffffffaebb,%rax
+  804c4b:	ff ff ff 
+  804c4e:	48 01 d8             	add    %rbx,%rax
+  804c51:	ff d0                	call   *%rax
+  804c53:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804c56:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804c5a:	79 63                	jns    804cbf <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804c5c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804c5f:	89 c6                	mov    %eax,%esi
+  804c61:	48 b8 7e e6 ff ff ff 	movabs $0xffffffffffffe67e,%rax
+  804c68:	ff ff ff 
+  804c6b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c6f:	48 89 c7             	mov    %rax,%rdi
+  804c72:	49 89 df             	mov    %rbx,%r15
+  804c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c7a:	48 ba eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%rdx
+  804c81:	ff ff ff 
+  804c84:	48 01 da             	add    %rbx,%rdx
+  804c87:	ff d2                	call   *%rdx
+			close(fd_src);
+  804c89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c8c:	89 c7                	mov    %eax,%edi
+  804c8e:	49 89 df             	mov    %rbx,%r15
+  804c91:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  804c98:	ff ff ff 
+  804c9b:	48 01 d8             	add    %rbx,%rax
+  804c9e:	ff d0                	call   *%rax
+			close(fd_dest);
+  804ca0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804ca3:	89 c7                	mov    %eax,%edi
+  804ca5:	49 89 df             	mov    %rbx,%r15
+  804ca8:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  804caf:	ff ff ff 
+  804cb2:	48 01 d8             	add    %rbx,%rax
+  804cb5:	ff d0                	call   *%rax
+			return write_size;
+  804cb7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804cba:	e9 cc 00 00 00       	jmp    804d8b <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804cbf:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804cc6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cc9:	ba 00 02 00 00       	mov    $0x200,%edx
+  804cce:	48 89 ce             	mov    %rcx,%rsi
+  804cd1:	89 c7                	mov    %eax,%edi
+  804cd3:	49 89 df             	mov    %rbx,%r15
+  804cd6:	48 b8 15 ad ff ff ff 	movabs $0xffffffffffffad15,%rax
+  804cdd:	ff ff ff 
+  804ce0:	48 01 d8             	add    %rbx,%rax
+  804ce3:	ff d0                	call   *%rax
+  804ce5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804ce8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804cec:	0f 8f 3a ff ff ff    	jg     804c2c <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804cf2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804cf6:	79 60                	jns    804d58 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804cf8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804cfb:	89 c6                	mov    %eax,%esi
+  804cfd:	48 b8 91 e6 ff ff ff 	movabs $0xffffffffffffe691,%rax
+  804d04:	ff ff ff 
+  804d07:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d0b:	48 89 c7             	mov    %rax,%rdi
+  804d0e:	49 89 df             	mov    %rbx,%r15
+  804d11:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d16:	48 ba eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%rdx
+  804d1d:	ff ff ff 
+  804d20:	48 01 da             	add    %rbx,%rdx
+  804d23:	ff d2                	call   *%rdx
+		close(fd_src);
+  804d25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d28:	89 c7                	mov    %eax,%edi
+  804d2a:	49 89 df             	mov    %rbx,%r15
+  804d2d:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  804d34:	ff ff ff 
+  804d37:	48 01 d8             	add    %rbx,%rax
+  804d3a:	ff d0                	call   *%rax
+		close(fd_dest);
+  804d3c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d3f:	89 c7                	mov    %eax,%edi
+  804d41:	49 89 df             	mov    %rbx,%r15
+  804d44:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  804d4b:	ff ff ff 
+  804d4e:	48 01 d8             	add    %rbx,%rax
+  804d51:	ff d0                	call   *%rax
+		return read_size;
+  804d53:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d56:	eb 33                	jmp    804d8b <copy+0x264>
+	}
+	close(fd_src);
+  804d58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d5b:	89 c7                	mov    %eax,%edi
+  804d5d:	49 89 df             	mov    %rbx,%r15
+  804d60:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  804d67:	ff ff ff 
+  804d6a:	48 01 d8             	add    %rbx,%rax
+  804d6d:	ff d0                	call   *%rax
+	close(fd_dest);
+  804d6f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804d72:	89 c7                	mov    %eax,%edi
+  804d74:	49 89 df             	mov    %rbx,%r15
+  804d77:	48 b8 5d aa ff ff ff 	movabs $0xffffffffffffaa5d,%rax
+  804d7e:	ff ff ff 
+  804d81:	48 01 d8             	add    %rbx,%rax
+  804d84:	ff d0                	call   *%rax
+	return 0;
+  804d86:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804d8b:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804d92:	5b                   	pop    %rbx
+  804d93:	41 5f                	pop    %r15
+  804d95:	5d                   	pop    %rbp
+  804d96:	c3                   	ret
+
+0000000000804d97 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804d97:	55                   	push   %rbp
+  804d98:	48 89 e5             	mov    %rsp,%rbp
+  804d9b:	41 57                	push   %r15
+  804d9d:	53                   	push   %rbx
+  804d9e:	48 83 ec 20          	sub    $0x20,%rsp
+  804da2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804da2 <fd2sockid+0xb>
+  804da9:	49 bb 9e 42 00 00 00 	movabs $0x429e,%r11
+  804db0:	00 00 00 
+  804db3:	4c 01 db             	add    %r11,%rbx
+  804db6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804db9:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804dbd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804dc0:	48 89 d6             	mov    %rdx,%rsi
+  804dc3:	89 c7                	mov    %eax,%edi
+  804dc5:	49 89 df             	mov    %rbx,%r15
+  804dc8:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  804dcf:	ff ff ff 
+  804dd2:	48 01 d8             	add    %rbx,%rax
+  804dd5:	ff d0                	call   *%rax
+  804dd7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804dda:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804dde:	79 05                	jns    804de5 <fd2sockid+0x4e>
+		return r;
+  804de0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804de3:	eb 25                	jmp    804e0a <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804de5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804de9:	8b 10                	mov    (%rax),%edx
+  804deb:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  804df2:	00 00 00 
+  804df5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804df8:	39 c2                	cmp    %eax,%edx
+  804dfa:	74 07                	je     804e03 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804dfc:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804e01:	eb 07                	jmp    804e0a <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804e03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e07:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804e0a:	48 83 c4 20          	add    $0x20,%rsp
+  804e0e:	5b                   	pop    %rbx
+  804e0f:	41 5f                	pop    %r15
+  804e11:	5d                   	pop    %rbp
+  804e12:	c3                   	ret
+
+0000000000804e13 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804e13:	55                   	push   %rbp
+  804e14:	48 89 e5             	mov    %rsp,%rbp
+  804e17:	41 57                	push   %r15
+  804e19:	53                   	push   %rbx
+  804e1a:	48 83 ec 20          	sub    $0x20,%rsp
+  804e1e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e1e <alloc_sockfd+0xb>
+  804e25:	49 bb 22 42 00 00 00 	movabs $0x4222,%r11
+  804e2c:	00 00 00 
+  804e2f:	4c 01 db             	add    %r11,%rbx
+  804e32:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804e35:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804e39:	48 89 c7             	mov    %rax,%rdi
+  804e3c:	49 89 df             	mov    %rbx,%r15
+  804e3f:	48 b8 18 a7 ff ff ff 	movabs $0xffffffffffffa718,%rax
+  804e46:	ff ff ff 
+  804e49:	48 01 d8             	add    %rbx,%rax
+  804e4c:	ff d0                	call   *%rax
+  804e4e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e51:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e55:	78 2c                	js     804e83 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804e57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e5b:	ba 07 04 00 00       	mov    $0x407,%edx
+  804e60:	48 89 c6             	mov    %rax,%rsi
+  804e63:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e68:	49 89 df             	mov    %rbx,%r15
+  804e6b:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  804e72:	ff ff ff 
+  804e75:	48 01 d8             	add    %rbx,%rax
+  804e78:	ff d0                	call   *%rax
+  804e7a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e7d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e81:	79 1c                	jns    804e9f <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804e83:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e86:	89 c7                	mov    %eax,%edi
+  804e88:	49 89 df             	mov    %rbx,%r15
+  804e8b:	48 b8 c7 c5 ff ff ff 	movabs $0xffffffffffffc5c7,%rax
+  804e92:	ff ff ff 
+  804e95:	48 01 d8             	add    %rbx,%rax
+  804e98:	ff d0                	call   *%rax
+		return r;
+  804e9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e9d:	eb 41                	jmp    804ee0 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804e9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ea3:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  804eaa:	00 00 00 
+  804ead:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804eb0:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804eb2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804eb6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804ebd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ec1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804ec4:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804ec7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ecb:	48 89 c7             	mov    %rax,%rdi
+  804ece:	49 89 df             	mov    %rbx,%r15
+  804ed1:	48 b8 9e a6 ff ff ff 	movabs $0xffffffffffffa69e,%rax
+  804ed8:	ff ff ff 
+  804edb:	48 01 d8             	add    %rbx,%rax
+  804ede:	ff d0                	call   *%rax
+}
+  804ee0:	48 83 c4 20          	add    $0x20,%rsp
+  804ee4:	5b                   	pop    %rbx
+  804ee5:	41 5f                	pop    %r15
+  804ee7:	5d                   	pop    %rbp
+  804ee8:	c3                   	ret
+
+0000000000804ee9 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804ee9:	55                   	push   %rbp
+  804eea:	48 89 e5             	mov    %rsp,%rbp
+  804eed:	41 57                	push   %r15
+  804eef:	53                   	push   %rbx
+  804ef0:	48 83 ec 30          	sub    $0x30,%rsp
+  804ef4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ef4 <accept+0xb>
+  804efb:	49 bb 4c 41 00 00 00 	movabs $0x414c,%r11
+  804f02:	00 00 00 
+  804f05:	4c 01 db             	add    %r11,%rbx
+  804f08:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f0b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804f0f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804f13:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f16:	89 c7                	mov    %eax,%edi
+  804f18:	48 b8 57 bd ff ff ff 	movabs $0xffffffffffffbd57,%rax
+  804f1f:	ff ff ff 
+  804f22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f26:	ff d0                	call   *%rax
+  804f28:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f2b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f2f:	79 05                	jns    804f36 <accept+0x4d>
+		return r;
+  804f31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f34:	eb 45                	jmp    804f7b <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804f36:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804f3a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804f3e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f41:	48 89 ce             	mov    %rcx,%rsi
+  804f44:	89 c7                	mov    %eax,%edi
+  804f46:	49 89 df             	mov    %rbx,%r15
+  804f49:	48 b8 35 c4 ff ff ff 	movabs $0xffffffffffffc435,%rax
+  804f50:	ff ff ff 
+  804f53:	48 01 d8             	add    %rbx,%rax
+  804f56:	ff d0                	call   *%rax
+  804f58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f5f:	79 05                	jns    804f66 <accept+0x7d>
+		return r;
+  804f61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f64:	eb 15                	jmp    804f7b <accept+0x92>
+	return alloc_sockfd(r);
+  804f66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f69:	89 c7                	mov    %eax,%edi
+  804f6b:	48 b8 d3 bd ff ff ff 	movabs $0xffffffffffffbdd3,%rax
+  804f72:	ff ff ff 
+  804f75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f79:	ff d0                	call   *%rax
+}
+  804f7b:	48 83 c4 30          	add    $0x30,%rsp
+  804f7f:	5b                   	pop    %rbx
+  804f80:	41 5f                	pop    %r15
+  804f82:	5d                   	pop    %rbp
+  804f83:	c3                   	ret
+
+0000000000804f84 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804f84:	55                   	push   %rbp
+  804f85:	48 89 e5             	mov    %rsp,%rbp
+  804f88:	41 57                	push   %r15
+  804f8a:	53                   	push   %rbx
+  804f8b:	48 83 ec 20          	sub    $0x20,%rsp
+  804f8f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f8f <bind+0xb>
+  804f96:	49 bb b1 40 00 00 00 	movabs $0x40b1,%r11
+  804f9d:	00 00 00 
+  804fa0:	4c 01 db             	add    %r11,%rbx
+  804fa3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804fa6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804faa:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804fad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fb0:	89 c7                	mov    %eax,%edi
+  804fb2:	48 b8 57 bd ff ff ff 	movabs $0xffffffffffffbd57,%rax
+  804fb9:	ff ff ff 
+  804fbc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fc0:	ff d0                	call   *%rax
+  804fc2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fc5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fc9:	79 05                	jns    804fd0 <bind+0x4c>
+		return r;
+  804fcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fce:	eb 21                	jmp    804ff1 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804fd0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804fd3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804fd7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fda:	48 89 ce             	mov    %rcx,%rsi
+  804fdd:	89 c7                	mov    %eax,%edi
+  804fdf:	49 89 df             	mov    %rbx,%r15
+  804fe2:	48 b8 e1 c4 ff ff ff 	movabs $0xffffffffffffc4e1,%rax
+  804fe9:	ff ff ff 
+  804fec:	48 01 d8             	add    %rbx,%rax
+  804fef:	ff d0                	call   *%rax
+}
+  804ff1:	48 83 c4 20          	add    $0x20,%rsp
+  804ff5:	5b                   	pop    %rbx
+  804ff6:	41 5f                	pop    %r15
+  804ff8:	5d                   	pop    %rbp
+  804ff9:	c3                   	ret
+
+0000000000804ffa <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804ffa:	55                   	push   %rbp
+  804ffb:	48 89 e5             	mov    %rsp,%rbp
+  804ffe:	41 57                	push   %r15
+  805000:	53                   	push   %rbx
+  805001:	48 83 ec 20          	sub    $0x20,%rsp
+  805005:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805005 <shutdown+0xb>
+  80500c:	49 bb 3b 40 00 00 00 	movabs $0x403b,%r11
+  805013:	00 00 00 
+  805016:	4c 01 db             	add    %r11,%rbx
+  805019:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80501c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80501f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805022:	89 c7                	mov    %eax,%edi
+  805024:	48 b8 57 bd ff ff ff 	movabs $0xffffffffffffbd57,%rax
+  80502b:	ff ff ff 
+  80502e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805032:	ff d0                	call   *%rax
+  805034:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805037:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80503b:	79 05                	jns    805042 <shutdown+0x48>
+		return r;
+  80503d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805040:	eb 1c                	jmp    80505e <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  805042:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805045:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805048:	89 d6                	mov    %edx,%esi
+  80504a:	89 c7                	mov    %eax,%edi
+  80504c:	49 89 df             	mov    %rbx,%r15
+  80504f:	48 b8 76 c5 ff ff ff 	movabs $0xffffffffffffc576,%rax
+  805056:	ff ff ff 
+  805059:	48 01 d8             	add    %rbx,%rax
+  80505c:	ff d0                	call   *%rax
+}
+  80505e:	48 83 c4 20          	add    $0x20,%rsp
+  805062:	5b                   	pop    %rbx
+  805063:	41 5f                	pop    %r15
+  805065:	5d                   	pop    %rbp
+  805066:	c3                   	ret
+
+0000000000805067 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805067:	55                   	push   %rbp
+  805068:	48 89 e5             	mov    %rsp,%rbp
+  80506b:	41 57                	push   %r15
+  80506d:	53                   	push   %rbx
+  80506e:	48 83 ec 10          	sub    $0x10,%rsp
+  805072:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805072 <devsock_close+0xb>
+  805079:	49 bb ce 3f 00 00 00 	movabs $0x3fce,%r11
+  805080:	00 00 00 
+  805083:	4c 01 db             	add    %r11,%rbx
+  805086:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80508a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80508e:	48 89 c7             	mov    %rax,%rdi
+  805091:	49 89 df             	mov    %rbx,%r15
+  805094:	48 b8 f5 de ff ff ff 	movabs $0xffffffffffffdef5,%rax
+  80509b:	ff ff ff 
+  80509e:	48 01 d8             	add    %rbx,%rax
+  8050a1:	ff d0                	call   *%rax
+  8050a3:	83 f8 01             	cmp    $0x1,%eax
+  8050a6:	75 1d                	jne    8050c5 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  8050a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050ac:	8b 40 0c             	mov    0xc(%rax),%eax
+  8050af:	89 c7                	mov    %eax,%edi
+  8050b1:	49 89 df             	mov    %rbx,%r15
+  8050b4:	48 b8 c7 c5 ff ff ff 	movabs $0xffffffffffffc5c7,%rax
+  8050bb:	ff ff ff 
+  8050be:	48 01 d8             	add    %rbx,%rax
+  8050c1:	ff d0                	call   *%rax
+  8050c3:	eb 05                	jmp    8050ca <devsock_close+0x63>
+	else
+		return 0;
+  8050c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050ca:	48 83 c4 10          	add    $0x10,%rsp
+  8050ce:	5b                   	pop    %rbx
+  8050cf:	41 5f                	pop    %r15
+  8050d1:	5d                   	pop    %rbp
+  8050d2:	c3                   	ret
+
+00000000008050d3 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8050d3:	55                   	push   %rbp
+  8050d4:	48 89 e5             	mov    %rsp,%rbp
+  8050d7:	41 57                	push   %r15
+  8050d9:	53                   	push   %rbx
+  8050da:	48 83 ec 20          	sub    $0x20,%rsp
+  8050de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050de <connect+0xb>
+  8050e5:	49 bb 62 3f 00 00 00 	movabs $0x3f62,%r11
+  8050ec:	00 00 00 
+  8050ef:	4c 01 db             	add    %r11,%rbx
+  8050f2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8050f5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8050f9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8050fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8050ff:	89 c7                	mov    %eax,%edi
+  805101:	48 b8 57 bd ff ff ff 	movabs $0xffffffffffffbd57,%rax
+  805108:	ff ff ff 
+  80510b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80510f:	ff d0                	call   *%rax
+  805111:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805114:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805118:	79 05                	jns    80511f <connect+0x4c>
+		return r;
+  80511a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80511d:	eb 21                	jmp    805140 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80511f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805122:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805126:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805129:	48 89 ce             	mov    %rcx,%rsi
+  80512c:	89 c7                	mov    %eax,%edi
+  80512e:	49 89 df             	mov    %rbx,%r15
+  805131:	48 b8 0f c6 ff ff ff 	movabs $0xffffffffffffc60f,%rax
+  805138:	ff ff ff 
+  80513b:	48 01 d8             	add    %rbx,%rax
+  80513e:	ff d0                	call   *%rax
+}
+  805140:	48 83 c4 20          	add    $0x20,%rsp
+  805144:	5b                   	pop    %rbx
+  805145:	41 5f                	pop    %r15
+  805147:	5d                   	pop    %rbp
+  805148:	c3                   	ret
+
+0000000000805149 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  805149:	55                   	push   %rbp
+  80514a:	48 89 e5             	mov    %rsp,%rbp
+  80514d:	41 57                	push   %r15
+  80514f:	53                   	push   %rbx
+  805150:	48 83 ec 20          	sub    $0x20,%rsp
+  805154:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805154 <listen+0xb>
+  80515b:	49 bb ec 3e 00 00 00 	movabs $0x3eec,%r11
+  805162:	00 00 00 
+  805165:	4c 01 db             	add    %r11,%rbx
+  805168:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80516b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80516e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805171:	89 c7                	mov    %eax,%edi
+  805173:	48 b8 57 bd ff ff ff 	movabs $0xffffffffffffbd57,%rax
+  80517a:	ff ff ff 
+  80517d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805181:	ff d0                	call   *%rax
+  805183:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805186:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80518a:	79 05                	jns    805191 <listen+0x48>
+		return r;
+  80518c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80518f:	eb 1c                	jmp    8051ad <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805191:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805194:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805197:	89 d6                	mov    %edx,%esi
+  805199:	89 c7                	mov    %eax,%edi
+  80519b:	49 89 df             	mov    %rbx,%r15
+  80519e:	48 b8 a4 c6 ff ff ff 	movabs $0xffffffffffffc6a4,%rax
+  8051a5:	ff ff ff 
+  8051a8:	48 01 d8             	add    %rbx,%rax
+  8051ab:	ff d0                	call   *%rax
+}
+  8051ad:	48 83 c4 20          	add    $0x20,%rsp
+  8051b1:	5b                   	pop    %rbx
+  8051b2:	41 5f                	pop    %r15
+  8051b4:	5d                   	pop    %rbp
+  8051b5:	c3                   	ret
+
+00000000008051b6 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8051b6:	55                   	push   %rbp
+  8051b7:	48 89 e5             	mov    %rsp,%rbp
+  8051ba:	41 57                	push   %r15
+  8051bc:	48 83 ec 28          	sub    $0x28,%rsp
+  8051c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8051c0 <devsock_read+0xa>
+  8051c7:	49 bb 80 3e 00 00 00 	movabs $0x3e80,%r11
+  8051ce:	00 00 00 
+  8051d1:	4c 01 d8             	add    %r11,%rax
+  8051d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8051d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8051dc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8051e0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8051e4:	41 89 d0             	mov    %edx,%r8d
+  8051e7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8051eb:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8051ee:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8051f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8051f7:	44 89 c2             	mov    %r8d,%edx
+  8051fa:	49 89 c7             	mov    %rax,%r15
+  8051fd:	49 b8 f5 c6 ff ff ff 	movabs $0xffffffffffffc6f5,%r8
+  805204:	ff ff ff 
+  805207:	49 01 c0             	add    %rax,%r8
+  80520a:	41 ff d0             	call   *%r8
+}
+  80520d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805211:	c9                   	leave
+  805212:	c3                   	ret
+
+0000000000805213 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805213:	55                   	push   %rbp
+  805214:	48 89 e5             	mov    %rsp,%rbp
+  805217:	41 57                	push   %r15
+  805219:	48 83 ec 28          	sub    $0x28,%rsp
+  80521d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80521d <devsock_write+0xa>
+  805224:	49 bb 23 3e 00 00 00 	movabs $0x3e23,%r11
+  80522b:	00 00 00 
+  80522e:	4c 01 d8             	add    %r11,%rax
+  805231:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805235:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805239:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80523d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805241:	41 89 d0             	mov    %edx,%r8d
+  805244:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805248:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80524b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80524f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805254:	44 89 c2             	mov    %r8d,%edx
+  805257:	49 89 c7             	mov    %rax,%r15
+  80525a:	49 b8 12 c8 ff ff ff 	movabs $0xffffffffffffc812,%r8
+  805261:	ff ff ff 
+  805264:	49 01 c0             	add    %rax,%r8
+  805267:	41 ff d0             	call   *%r8
+}
+  80526a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80526e:	c9                   	leave
+  80526f:	c3                   	ret
+
+0000000000805270 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805270:	55                   	push   %rbp
+  805271:	48 89 e5             	mov    %rsp,%rbp
+  805274:	41 57                	push   %r15
+  805276:	48 83 ec 18          	sub    $0x18,%rsp
+  80527a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80527a <devsock_stat+0xa>
+  805281:	49 bb c6 3d 00 00 00 	movabs $0x3dc6,%r11
+  805288:	00 00 00 
+  80528b:	4c 01 d8             	add    %r11,%rax
+  80528e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805292:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805296:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80529a:	48 b9 ac e6 ff ff ff 	movabs $0xffffffffffffe6ac,%rcx
+  8052a1:	ff ff ff 
+  8052a4:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8052a8:	48 89 ce             	mov    %rcx,%rsi
+  8052ab:	48 89 d7             	mov    %rdx,%rdi
+  8052ae:	49 89 c7             	mov    %rax,%r15
+  8052b1:	48 ba ad 86 ff ff ff 	movabs $0xffffffffffff86ad,%rdx
+  8052b8:	ff ff ff 
+  8052bb:	48 01 c2             	add    %rax,%rdx
+  8052be:	ff d2                	call   *%rdx
+	return 0;
+  8052c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052c5:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8052c9:	c9                   	leave
+  8052ca:	c3                   	ret
+
+00000000008052cb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8052cb:	55                   	push   %rbp
+  8052cc:	48 89 e5             	mov    %rsp,%rbp
+  8052cf:	41 57                	push   %r15
+  8052d1:	53                   	push   %rbx
+  8052d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8052d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052d6 <socket+0xb>
+  8052dd:	49 bb 6a 3d 00 00 00 	movabs $0x3d6a,%r11
+  8052e4:	00 00 00 
+  8052e7:	4c 01 db             	add    %r11,%rbx
+  8052ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8052ed:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8052f0:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8052f3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8052f6:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8052f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052fc:	89 ce                	mov    %ecx,%esi
+  8052fe:	89 c7                	mov    %eax,%edi
+  805300:	49 89 df             	mov    %rbx,%r15
+  805303:	48 b8 e9 c9 ff ff ff 	movabs $0xffffffffffffc9e9,%rax
+  80530a:	ff ff ff 
+  80530d:	48 01 d8             	add    %rbx,%rax
+  805310:	ff d0                	call   *%rax
+  805312:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805315:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805319:	79 05                	jns    805320 <socket+0x55>
+		return r;
+  80531b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80531e:	eb 15                	jmp    805335 <socket+0x6a>
+	return alloc_sockfd(r);
+  805320:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805323:	89 c7                	mov    %eax,%edi
+  805325:	48 b8 d3 bd ff ff ff 	movabs $0xffffffffffffbdd3,%rax
+  80532c:	ff ff ff 
+  80532f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805333:	ff d0                	call   *%rax
+}
+  805335:	48 83 c4 20          	add    $0x20,%rsp
+  805339:	5b                   	pop    %rbx
+  80533a:	41 5f                	pop    %r15
+  80533c:	5d                   	pop    %rbp
+  80533d:	c3                   	ret
+
+000000000080533e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80533e:	55                   	push   %rbp
+  80533f:	48 89 e5             	mov    %rsp,%rbp
+  805342:	41 57                	push   %r15
+  805344:	53                   	push   %rbx
+  805345:	48 83 ec 10          	sub    $0x10,%rsp
+  805349:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805349 <nsipc+0xb>
+  805350:	49 bb f7 3c 00 00 00 	movabs $0x3cf7,%r11
+  805357:	00 00 00 
+  80535a:	4c 01 db             	add    %r11,%rbx
+  80535d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805360:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805367:	00 00 00 
+  80536a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80536d:	85 c0                	test   %eax,%eax
+  80536f:	75 24                	jne    805395 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805371:	bf 02 00 00 00       	mov    $0x2,%edi
+  805376:	49 89 df             	mov    %rbx,%r15
+  805379:	48 b8 66 de ff ff ff 	movabs $0xffffffffffffde66,%rax
+  805380:	ff ff ff 
+  805383:	48 01 d8             	add    %rbx,%rax
+  805386:	ff d0                	call   *%rax
+  805388:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80538f:	00 00 00 
+  805392:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805395:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80539c:	00 00 00 
+  80539f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8053a2:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8053a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8053ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8053b1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8053b6:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8053bd:	00 00 00 
+  8053c0:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8053c4:	89 c7                	mov    %eax,%edi
+  8053c6:	49 89 df             	mov    %rbx,%r15
+  8053c9:	48 b8 85 d8 ff ff ff 	movabs $0xffffffffffffd885,%rax
+  8053d0:	ff ff ff 
+  8053d3:	48 01 d8             	add    %rbx,%rax
+  8053d6:	ff d0                	call   *%rax
+}
+  8053d8:	48 83 c4 10          	add    $0x10,%rsp
+  8053dc:	5b                   	pop    %rbx
+  8053dd:	41 5f                	pop    %r15
+  8053df:	5d                   	pop    %rbp
+  8053e0:	c3                   	ret
+
+00000000008053e1 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8053e1:	55                   	push   %rbp
+  8053e2:	48 89 e5             	mov    %rsp,%rbp
+  8053e5:	41 57                	push   %r15
+  8053e7:	53                   	push   %rbx
+  8053e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8053ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053ec <nsipc_words+0xb>
+  8053f3:	49 bb 54 3c 00 00 00 	movabs $0x3c54,%r11
+  8053fa:	00 00 00 
+  8053fd:	4c 01 db             	add    %r11,%rbx
+  805400:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805403:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805407:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80540b:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805412:	00 00 00 
+  805415:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805418:	85 c0                	test   %eax,%eax
+  80541a:	75 24                	jne    805440 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80541c:	bf 02 00 00 00       	mov    $0x2,%edi
+  805421:	49 89 df             	mov    %rbx,%r15
+  805424:	48 b8 66 de ff ff ff 	movabs $0xffffffffffffde66,%rax
+  80542b:	ff ff ff 
+  80542e:	48 01 d8             	add    %rbx,%rax
+  805431:	ff d0                	call   *%rax
+  805433:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80543a:	00 00 00 
+  80543d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805440:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805447:	00 00 00 
+  80544a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80544d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805451:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805455:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805458:	89 c7                	mov    %eax,%edi
+  80545a:	49 89 df             	mov    %rbx,%r15
+  80545d:	48 b8 70 d9 ff ff ff 	movabs $0xffffffffffffd970,%rax
+  805464:	ff ff ff 
+  805467:	48 01 d8             	add    %rbx,%rax
+  80546a:	ff d0                	call   *%rax
+}
+  80546c:	48 83 c4 20          	add    $0x20,%rsp
+  805470:	5b                   	pop    %rbx
+  805471:	41 5f                	pop    %r15
+  805473:	5d                   	pop    %rbp
+  805474:	c3                   	ret
+
+0000000000805475 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805475:	55                   	push   %rbp
+  805476:	48 89 e5             	mov    %rsp,%rbp
+  805479:	41 57                	push   %r15
+  80547b:	53                   	push   %rbx
+  80547c:	48 83 ec 30          	sub    $0x30,%rsp
+  805480:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805480 <nsipc_accept+0xb>
+  805487:	49 bb c0 3b 00 00 00 	movabs $0x3bc0,%r11
+  80548e:	00 00 00 
+  805491:	4c 01 db             	add    %r11,%rbx
+  805494:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805497:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80549b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80549f:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8054a6:	00 00 00 
+  8054a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054ac:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8054af:	bf 01 00 00 00       	mov    $0x1,%edi
+  8054b4:	48 b8 fe c2 ff ff ff 	movabs $0xffffffffffffc2fe,%rax
+  8054bb:	ff ff ff 
+  8054be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054c2:	ff d0                	call   *%rax
+  8054c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054cb:	78 48                	js     805515 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8054cd:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  8054d4:	00 00 00 
+  8054d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054db:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8054df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054e3:	8b 40 10             	mov    0x10(%rax),%eax
+  8054e6:	89 c2                	mov    %eax,%edx
+  8054e8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8054ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054f0:	48 89 ce             	mov    %rcx,%rsi
+  8054f3:	48 89 c7             	mov    %rax,%rdi
+  8054f6:	49 89 df             	mov    %rbx,%r15
+  8054f9:	48 b8 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rax
+  805500:	ff ff ff 
+  805503:	48 01 d8             	add    %rbx,%rax
+  805506:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805508:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80550c:	8b 50 10             	mov    0x10(%rax),%edx
+  80550f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805513:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805515:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805518:	48 83 c4 30          	add    $0x30,%rsp
+  80551c:	5b                   	pop    %rbx
+  80551d:	41 5f                	pop    %r15
+  80551f:	5d                   	pop    %rbp
+  805520:	c3                   	ret
+
+0000000000805521 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805521:	55                   	push   %rbp
+  805522:	48 89 e5             	mov    %rsp,%rbp
+  805525:	41 57                	push   %r15
+  805527:	53                   	push   %rbx
+  805528:	48 83 ec 10          	sub    $0x10,%rsp
+  80552c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80552c <nsipc_bind+0xb>
+  805533:	49 bb 14 3b 00 00 00 	movabs $0x3b14,%r11
+  80553a:	00 00 00 
+  80553d:	4c 01 db             	add    %r11,%rbx
+  805540:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805543:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805547:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  80554a:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805551:	00 00 00 
+  805554:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805557:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80555a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80555d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805561:	48 89 c6             	mov    %rax,%rsi
+  805564:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  80556b:	00 00 00 
+  80556e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805572:	48 89 c7             	mov    %rax,%rdi
+  805575:	49 89 df             	mov    %rbx,%r15
+  805578:	48 b8 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rax
+  80557f:	ff ff ff 
+  805582:	48 01 d8             	add    %rbx,%rax
+  805585:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805587:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80558e:	00 00 00 
+  805591:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805594:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805598:	bf 02 00 00 00       	mov    $0x2,%edi
+  80559d:	48 b8 fe c2 ff ff ff 	movabs $0xffffffffffffc2fe,%rax
+  8055a4:	ff ff ff 
+  8055a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055ab:	ff d0                	call   *%rax
+}
+  8055ad:	48 83 c4 10          	add    $0x10,%rsp
+  8055b1:	5b                   	pop    %rbx
+  8055b2:	41 5f                	pop    %r15
+  8055b4:	5d                   	pop    %rbp
+  8055b5:	c3                   	ret
+
+00000000008055b6 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8055b6:	55                   	push   %rbp
+  8055b7:	48 89 e5             	mov    %rsp,%rbp
+  8055ba:	48 83 ec 20          	sub    $0x20,%rsp
+  8055be:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8055be <nsipc_shutdown+0x8>
+  8055c5:	49 bb 82 3a 00 00 00 	movabs $0x3a82,%r11
+  8055cc:	00 00 00 
+  8055cf:	4c 01 d8             	add    %r11,%rax
+  8055d2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8055d5:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8055d8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8055db:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8055de:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8055e1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8055e4:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8055e8:	ba 08 00 00 00       	mov    $0x8,%edx
+  8055ed:	48 89 ce             	mov    %rcx,%rsi
+  8055f0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8055f5:	48 b9 a1 c3 ff ff ff 	movabs $0xffffffffffffc3a1,%rcx
+  8055fc:	ff ff ff 
+  8055ff:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805603:	ff d0                	call   *%rax
+}
+  805605:	c9                   	leave
+  805606:	c3                   	ret
+
+0000000000805607 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805607:	55                   	push   %rbp
+  805608:	48 89 e5             	mov    %rsp,%rbp
+  80560b:	48 83 ec 20          	sub    $0x20,%rsp
+  80560f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80560f <nsipc_close+0x8>
+  805616:	49 bb 31 3a 00 00 00 	movabs $0x3a31,%r11
+  80561d:	00 00 00 
+  805620:	4c 01 d8             	add    %r11,%rax
+  805623:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805626:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805629:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80562c:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805630:	ba 04 00 00 00       	mov    $0x4,%edx
+  805635:	48 89 ce             	mov    %rcx,%rsi
+  805638:	bf 04 00 00 00       	mov    $0x4,%edi
+  80563d:	48 b9 a1 c3 ff ff ff 	movabs $0xffffffffffffc3a1,%rcx
+  805644:	ff ff ff 
+  805647:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80564b:	ff d0                	call   *%rax
+}
+  80564d:	c9                   	leave
+  80564e:	c3                   	ret
+
+000000000080564f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80564f:	55                   	push   %rbp
+  805650:	48 89 e5             	mov    %rsp,%rbp
+  805653:	41 57                	push   %r15
+  805655:	53                   	push   %rbx
+  805656:	48 83 ec 10          	sub    $0x10,%rsp
+  80565a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80565a <nsipc_connect+0xb>
+  805661:	49 bb e6 39 00 00 00 	movabs $0x39e6,%r11
+  805668:	00 00 00 
+  80566b:	4c 01 db             	add    %r11,%rbx
+  80566e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805671:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805675:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805678:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80567f:	00 00 00 
+  805682:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805685:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805688:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80568b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80568f:	48 89 c6             	mov    %rax,%rsi
+  805692:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805699:	00 00 00 
+  80569c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056a0:	48 89 c7             	mov    %rax,%rdi
+  8056a3:	49 89 df             	mov    %rbx,%r15
+  8056a6:	48 b8 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rax
+  8056ad:	ff ff ff 
+  8056b0:	48 01 d8             	add    %rbx,%rax
+  8056b3:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8056b5:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8056bc:	00 00 00 
+  8056bf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8056c2:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8056c6:	bf 05 00 00 00       	mov    $0x5,%edi
+  8056cb:	48 b8 fe c2 ff ff ff 	movabs $0xffffffffffffc2fe,%rax
+  8056d2:	ff ff ff 
+  8056d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056d9:	ff d0                	call   *%rax
+}
+  8056db:	48 83 c4 10          	add    $0x10,%rsp
+  8056df:	5b                   	pop    %rbx
+  8056e0:	41 5f                	pop    %r15
+  8056e2:	5d                   	pop    %rbp
+  8056e3:	c3                   	ret
+
+00000000008056e4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8056e4:	55                   	push   %rbp
+  8056e5:	48 89 e5             	mov    %rsp,%rbp
+  8056e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8056ec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8056ec <nsipc_listen+0x8>
+  8056f3:	49 bb 54 39 00 00 00 	movabs $0x3954,%r11
+  8056fa:	00 00 00 
+  8056fd:	4c 01 d8             	add    %r11,%rax
+  805700:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805703:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805706:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805709:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  80570c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80570f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805712:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805716:	ba 08 00 00 00       	mov    $0x8,%edx
+  80571b:	48 89 ce             	mov    %rcx,%rsi
+  80571e:	bf 06 00 00 00       	mov    $0x6,%edi
+  805723:	48 b9 a1 c3 ff ff ff 	movabs $0xffffffffffffc3a1,%rcx
+  80572a:	ff ff ff 
+  80572d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805731:	ff d0                	call   *%rax
+}
+  805733:	c9                   	leave
+  805734:	c3                   	ret
+
+0000000000805735 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805735:	55                   	push   %rbp
+  805736:	48 89 e5             	mov    %rsp,%rbp
+  805739:	41 57                	push   %r15
+  80573b:	53                   	push   %rbx
+  80573c:	48 83 ec 30          	sub    $0x30,%rsp
+  805740:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805740 <nsipc_recv+0xb>
+  805747:	49 bb 00 39 00 00 00 	movabs $0x3900,%r11
+  80574e:	00 00 00 
+  805751:	4c 01 db             	add    %r11,%rbx
+  805754:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805757:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80575b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  80575e:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805761:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805768:	00 00 00 
+  80576b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80576e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805771:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805778:	00 00 00 
+  80577b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80577e:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805782:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805789:	00 00 00 
+  80578c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80578f:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805793:	bf 07 00 00 00       	mov    $0x7,%edi
+  805798:	48 b8 fe c2 ff ff ff 	movabs $0xffffffffffffc2fe,%rax
+  80579f:	ff ff ff 
+  8057a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057a6:	ff d0                	call   *%rax
+  8057a8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057ab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057af:	0f 88 91 00 00 00    	js     805846 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8057b5:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8057bc:	7f 08                	jg     8057c6 <nsipc_recv+0x91>
+  8057be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057c1:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8057c4:	7e 50                	jle    805816 <nsipc_recv+0xe1>
+  8057c6:	48 b8 b3 e6 ff ff ff 	movabs $0xffffffffffffe6b3,%rax
+  8057cd:	ff ff ff 
+  8057d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057d4:	48 89 c1             	mov    %rax,%rcx
+  8057d7:	48 b8 c8 e6 ff ff ff 	movabs $0xffffffffffffe6c8,%rax
+  8057de:	ff ff ff 
+  8057e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057e5:	48 89 c2             	mov    %rax,%rdx
+  8057e8:	be 79 00 00 00       	mov    $0x79,%esi
+  8057ed:	48 b8 dd e6 ff ff ff 	movabs $0xffffffffffffe6dd,%rax
+  8057f4:	ff ff ff 
+  8057f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057fb:	48 89 c7             	mov    %rax,%rdi
+  8057fe:	49 89 df             	mov    %rbx,%r15
+  805801:	b8 00 00 00 00       	mov    $0x0,%eax
+  805806:	49 b8 14 76 ff ff ff 	movabs $0xffffffffffff7614,%r8
+  80580d:	ff ff ff 
+  805810:	49 01 d8             	add    %rbx,%r8
+  805813:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805816:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805819:	48 63 d0             	movslq %eax,%rdx
+  80581c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805820:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805827:	00 00 00 
+  80582a:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  80582e:	48 89 ce             	mov    %rcx,%rsi
+  805831:	48 89 c7             	mov    %rax,%rdi
+  805834:	49 89 df             	mov    %rbx,%r15
+  805837:	48 b8 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rax
+  80583e:	ff ff ff 
+  805841:	48 01 d8             	add    %rbx,%rax
+  805844:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805846:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805849:	48 83 c4 30          	add    $0x30,%rsp
+  80584d:	5b                   	pop    %rbx
+  80584e:	41 5f                	pop    %r15
+  805850:	5d                   	pop    %rbp
+  805851:	c3                   	ret
+
+0000000000805852 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805852:	55                   	push   %rbp
+  805853:	48 89 e5             	mov    %rsp,%rbp
+  805856:	41 57                	push   %r15
+  805858:	53                   	push   %rbx
+  805859:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805860:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805860 <nsipc_send+0xe>
+  805867:	49 bb e0 37 00 00 00 	movabs $0x37e0,%r11
+  80586e:	00 00 00 
+  805871:	4c 01 db             	add    %r11,%rbx
+  805874:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  80587a:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805881:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805887:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  80588d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805891:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805895:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80589c:	00 00 00 
+  80589f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8058a2:	85 c0                	test   %eax,%eax
+  8058a4:	75 24                	jne    8058ca <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8058a6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8058ab:	49 89 df             	mov    %rbx,%r15
+  8058ae:	48 b8 66 de ff ff ff 	movabs $0xffffffffffffde66,%rax
+  8058b5:	ff ff ff 
+  8058b8:	48 01 d8             	add    %rbx,%rax
+  8058bb:	ff d0                	call   *%rax
+  8058bd:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8058c4:	00 00 00 
+  8058c7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8058ca:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8058d0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8058d3:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8058da:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8058dd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8058e0:	39 c2                	cmp    %eax,%edx
+  8058e2:	0f 4e c2             	cmovle %edx,%eax
+  8058e5:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8058eb:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8058f1:	48 63 d0             	movslq %eax,%rdx
+  8058f4:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8058fb:	48 89 c6             	mov    %rax,%rsi
+  8058fe:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805905:	00 00 00 
+  805908:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80590c:	48 89 c7             	mov    %rax,%rdi
+  80590f:	49 89 df             	mov    %rbx,%r15
+  805912:	48 b8 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rax
+  805919:	ff ff ff 
+  80591c:	48 01 d8             	add    %rbx,%rax
+  80591f:	ff d0                	call   *%rax
+	req->req_s = s;
+  805921:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805925:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80592b:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80592d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805931:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805937:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  80593a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80593e:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805944:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805947:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  80594e:	00 00 00 
+  805951:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805955:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805959:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805960:	00 
+  805961:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805967:	48 63 d0             	movslq %eax,%rdx
+  80596a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80596e:	48 01 d0             	add    %rdx,%rax
+  805971:	48 83 e8 01          	sub    $0x1,%rax
+  805975:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805979:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80597d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805982:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805986:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80598a:	48 29 d0             	sub    %rdx,%rax
+  80598d:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805993:	85 c0                	test   %eax,%eax
+  805995:	0f 48 c2             	cmovs  %edx,%eax
+  805998:	c1 f8 0c             	sar    $0xc,%eax
+  80599b:	48 98                	cltq
+  80599d:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8059a1:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8059a5:	48 85 c0             	test   %rax,%rax
+  8059a8:	0f 95 c0             	setne  %al
+  8059ab:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8059ae:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8059b5:	00 
+  8059b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8059ba:	48 83 c0 0b          	add    $0xb,%rax
+  8059be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8059c2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8059c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8059cb:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8059cf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8059d3:	48 29 d0             	sub    %rdx,%rax
+  8059d6:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8059da:	89 c7                	mov    %eax,%edi
+  8059dc:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8059e3:	00 00 00 
+  8059e6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8059e9:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8059ed:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8059f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8059f5:	6a 00                	push   $0x0
+  8059f7:	6a 00                	push   $0x0
+  8059f9:	6a 05                	push   $0x5
+  8059fb:	41 89 f1             	mov    %esi,%r9d
+  8059fe:	49 89 c8             	mov    %rcx,%r8
+  805a01:	89 f9                	mov    %edi,%ecx
+  805a03:	be 08 00 00 00       	mov    $0x8,%esi
+  805a08:	89 c7                	mov    %eax,%edi
+  805a0a:	49 89 df             	mov    %rbx,%r15
+  805a0d:	48 b8 6e da ff ff ff 	movabs $0xffffffffffffda6e,%rax
+  805a14:	ff ff ff 
+  805a17:	48 01 d8             	add    %rbx,%rax
+  805a1a:	ff d0                	call   *%rax
+  805a1c:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805a20:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805a24:	5b                   	pop    %rbx
+  805a25:	41 5f                	pop    %r15
+  805a27:	5d                   	pop    %rbp
+  805a28:	c3                   	ret
+
+0000000000805a29 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805a29:	55                   	push   %rbp
+  805a2a:	48 89 e5             	mov    %rsp,%rbp
+  805a2d:	48 83 ec 10          	sub    $0x10,%rsp
+  805a31:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a31 <nsipc_socket+0x8>
+  805a38:	49 bb 0f 36 00 00 00 	movabs $0x360f,%r11
+  805a3f:	00 00 00 
+  805a42:	4c 01 d8             	add    %r11,%rax
+  805a45:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805a48:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805a4b:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805a4e:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805a55:	00 00 00 
+  805a58:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805a5b:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805a5e:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805a65:	00 00 00 
+  805a68:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805a6b:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805a6f:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805a76:	00 00 00 
+  805a79:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805a7c:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805a80:	bf 09 00 00 00       	mov    $0x9,%edi
+  805a85:	48 ba fe c2 ff ff ff 	movabs $0xffffffffffffc2fe,%rdx
+  805a8c:	ff ff ff 
+  805a8f:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805a93:	ff d0                	call   *%rax
+}
+  805a95:	c9                   	leave
+  805a96:	c3                   	ret
+
+0000000000805a97 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805a97:	55                   	push   %rbp
+  805a98:	48 89 e5             	mov    %rsp,%rbp
+  805a9b:	41 57                	push   %r15
+  805a9d:	53                   	push   %rbx
+  805a9e:	48 83 ec 30          	sub    $0x30,%rsp
+  805aa2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805aa2 <pipe+0xb>
+  805aa9:	49 bb 9e 35 00 00 00 	movabs $0x359e,%r11
+  805ab0:	00 00 00 
+  805ab3:	4c 01 db             	add    %r11,%rbx
+  805ab6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805aba:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805abe:	48 89 c7             	mov    %rax,%rdi
+  805ac1:	49 89 df             	mov    %rbx,%r15
+  805ac4:	48 b8 18 a7 ff ff ff 	movabs $0xffffffffffffa718,%rax
+  805acb:	ff ff ff 
+  805ace:	48 01 d8             	add    %rbx,%rax
+  805ad1:	ff d0                	call   *%rax
+  805ad3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ad6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ada:	0f 88 12 02 00 00    	js     805cf2 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805ae0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ae4:	ba 07 04 00 00       	mov    $0x407,%edx
+  805ae9:	48 89 c6             	mov    %rax,%rsi
+  805aec:	bf 00 00 00 00       	mov    $0x0,%edi
+  805af1:	49 89 df             	mov    %rbx,%r15
+  805af4:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  805afb:	ff ff ff 
+  805afe:	48 01 d8             	add    %rbx,%rax
+  805b01:	ff d0                	call   *%rax
+  805b03:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b06:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b0a:	0f 88 e2 01 00 00    	js     805cf2 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805b10:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805b14:	48 89 c7             	mov    %rax,%rdi
+  805b17:	49 89 df             	mov    %rbx,%r15
+  805b1a:	48 b8 18 a7 ff ff ff 	movabs $0xffffffffffffa718,%rax
+  805b21:	ff ff ff 
+  805b24:	48 01 d8             	add    %rbx,%rax
+  805b27:	ff d0                	call   *%rax
+  805b29:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b2c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b30:	0f 88 9b 01 00 00    	js     805cd1 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805b36:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b3a:	ba 07 04 00 00       	mov    $0x407,%edx
+  805b3f:	48 89 c6             	mov    %rax,%rsi
+  805b42:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b47:	49 89 df             	mov    %rbx,%r15
+  805b4a:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  805b51:	ff ff ff 
+  805b54:	48 01 d8             	add    %rbx,%rax
+  805b57:	ff d0                	call   *%rax
+  805b59:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b5c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b60:	0f 88 6b 01 00 00    	js     805cd1 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805b66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b6a:	48 89 c7             	mov    %rax,%rdi
+  805b6d:	49 89 df             	mov    %rbx,%r15
+  805b70:	48 b8 d5 a6 ff ff ff 	movabs $0xffffffffffffa6d5,%rax
+  805b77:	ff ff ff 
+  805b7a:	48 01 d8             	add    %rbx,%rax
+  805b7d:	ff d0                	call   *%rax
+  805b7f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805b83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b87:	ba 07 04 00 00       	mov    $0x407,%edx
+  805b8c:	48 89 c6             	mov    %rax,%rsi
+  805b8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b94:	49 89 df             	mov    %rbx,%r15
+  805b97:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  805b9e:	ff ff ff 
+  805ba1:	48 01 d8             	add    %rbx,%rax
+  805ba4:	ff d0                	call   *%rax
+  805ba6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ba9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805bad:	0f 88 fd 00 00 00    	js     805cb0 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805bb3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bb7:	48 89 c7             	mov    %rax,%rdi
+  805bba:	49 89 df             	mov    %rbx,%r15
+  805bbd:	48 b8 d5 a6 ff ff ff 	movabs $0xffffffffffffa6d5,%rax
+  805bc4:	ff ff ff 
+  805bc7:	48 01 d8             	add    %rbx,%rax
+  805bca:	ff d0                	call   *%rax
+  805bcc:	48 89 c2             	mov    %rax,%rdx
+  805bcf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bd3:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805bd9:	48 89 d1             	mov    %rdx,%rcx
+  805bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  805be1:	48 89 c6             	mov    %rax,%rsi
+  805be4:	bf 00 00 00 00       	mov    $0x0,%edi
+  805be9:	49 89 df             	mov    %rbx,%r15
+  805bec:	48 b8 ce 93 ff ff ff 	movabs $0xffffffffffff93ce,%rax
+  805bf3:	ff ff ff 
+  805bf6:	48 01 d8             	add    %rbx,%rax
+  805bf9:	ff d0                	call   *%rax
+  805bfb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805bfe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c02:	0f 88 87 00 00 00    	js     805c8f <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805c08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c0c:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805c13:	00 00 00 
+  805c16:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805c19:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805c1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c1f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805c26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c2a:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805c31:	00 00 00 
+  805c34:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805c37:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805c39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c3d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805c44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c48:	48 89 c7             	mov    %rax,%rdi
+  805c4b:	49 89 df             	mov    %rbx,%r15
+  805c4e:	48 b8 9e a6 ff ff ff 	movabs $0xffffffffffffa69e,%rax
+  805c55:	ff ff ff 
+  805c58:	48 01 d8             	add    %rbx,%rax
+  805c5b:	ff d0                	call   *%rax
+  805c5d:	89 c2                	mov    %eax,%edx
+  805c5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c63:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805c65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c69:	48 89 c7             	mov    %rax,%rdi
+  805c6c:	49 89 df             	mov    %rbx,%r15
+  805c6f:	48 b8 9e a6 ff ff ff 	movabs $0xffffffffffffa69e,%rax
+  805c76:	ff ff ff 
+  805c79:	48 01 d8             	add    %rbx,%rax
+  805c7c:	ff d0                	call   *%rax
+  805c7e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805c82:	48 83 c2 04          	add    $0x4,%rdx
+  805c86:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c8d:	eb 67                	jmp    805cf6 <pipe+0x25f>
+		goto err3;
+  805c8f:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805c90:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c94:	48 89 c6             	mov    %rax,%rsi
+  805c97:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c9c:	49 89 df             	mov    %rbx,%r15
+  805c9f:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  805ca6:	ff ff ff 
+  805ca9:	48 01 d8             	add    %rbx,%rax
+  805cac:	ff d0                	call   *%rax
+  805cae:	eb 01                	jmp    805cb1 <pipe+0x21a>
+		goto err2;
+  805cb0:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805cb1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805cb5:	48 89 c6             	mov    %rax,%rsi
+  805cb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cbd:	49 89 df             	mov    %rbx,%r15
+  805cc0:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  805cc7:	ff ff ff 
+  805cca:	48 01 d8             	add    %rbx,%rax
+  805ccd:	ff d0                	call   *%rax
+  805ccf:	eb 01                	jmp    805cd2 <pipe+0x23b>
+		goto err1;
+  805cd1:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805cd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cd6:	48 89 c6             	mov    %rax,%rsi
+  805cd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cde:	49 89 df             	mov    %rbx,%r15
+  805ce1:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  805ce8:	ff ff ff 
+  805ceb:	48 01 d8             	add    %rbx,%rax
+  805cee:	ff d0                	call   *%rax
+  805cf0:	eb 01                	jmp    805cf3 <pipe+0x25c>
+		goto err;
+  805cf2:	90                   	nop
+err:
+	return r;
+  805cf3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805cf6:	48 83 c4 30          	add    $0x30,%rsp
+  805cfa:	5b                   	pop    %rbx
+  805cfb:	41 5f                	pop    %r15
+  805cfd:	5d                   	pop    %rbp
+  805cfe:	c3                   	ret
+
+0000000000805cff <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805cff:	55                   	push   %rbp
+  805d00:	48 89 e5             	mov    %rsp,%rbp
+  805d03:	41 57                	push   %r15
+  805d05:	41 54                	push   %r12
+  805d07:	53                   	push   %rbx
+  805d08:	48 83 ec 28          	sub    $0x28,%rsp
+  805d0c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d0c <_pipeisclosed+0xd>
+  805d13:	49 bb 34 33 00 00 00 	movabs $0x3334,%r11
+  805d1a:	00 00 00 
+  805d1d:	4c 01 db             	add    %r11,%rbx
+  805d20:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805d24:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805d28:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805d2f:	ff ff ff 
+  805d32:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d36:	48 8b 00             	mov    (%rax),%rax
+  805d39:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805d3f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805d42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d46:	48 89 c7             	mov    %rax,%rdi
+  805d49:	49 89 df             	mov    %rbx,%r15
+  805d4c:	48 b8 f5 de ff ff ff 	movabs $0xffffffffffffdef5,%rax
+  805d53:	ff ff ff 
+  805d56:	48 01 d8             	add    %rbx,%rax
+  805d59:	ff d0                	call   *%rax
+  805d5b:	41 89 c4             	mov    %eax,%r12d
+  805d5e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d62:	48 89 c7             	mov    %rax,%rdi
+  805d65:	49 89 df             	mov    %rbx,%r15
+  805d68:	48 b8 f5 de ff ff ff 	movabs $0xffffffffffffdef5,%rax
+  805d6f:	ff ff ff 
+  805d72:	48 01 d8             	add    %rbx,%rax
+  805d75:	ff d0                	call   *%rax
+  805d77:	41 39 c4             	cmp    %eax,%r12d
+  805d7a:	0f 94 c0             	sete   %al
+  805d7d:	0f b6 c0             	movzbl %al,%eax
+  805d80:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805d83:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805d8a:	ff ff ff 
+  805d8d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d91:	48 8b 00             	mov    (%rax),%rax
+  805d94:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805d9a:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805d9d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805da0:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805da3:	75 05                	jne    805daa <_pipeisclosed+0xab>
+			return ret;
+  805da5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805da8:	eb 63                	jmp    805e0d <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805daa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805dad:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805db0:	0f 84 72 ff ff ff    	je     805d28 <_pipeisclosed+0x29>
+  805db6:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805dba:	0f 85 68 ff ff ff    	jne    805d28 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805dc0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805dc7:	ff ff ff 
+  805dca:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805dce:	48 8b 00             	mov    (%rax),%rax
+  805dd1:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805dd7:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805dda:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ddd:	89 c6                	mov    %eax,%esi
+  805ddf:	48 b8 ee e6 ff ff ff 	movabs $0xffffffffffffe6ee,%rax
+  805de6:	ff ff ff 
+  805de9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ded:	48 89 c7             	mov    %rax,%rdi
+  805df0:	49 89 df             	mov    %rbx,%r15
+  805df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  805df8:	49 b8 eb 78 ff ff ff 	movabs $0xffffffffffff78eb,%r8
+  805dff:	ff ff ff 
+  805e02:	49 01 d8             	add    %rbx,%r8
+  805e05:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805e08:	e9 1b ff ff ff       	jmp    805d28 <_pipeisclosed+0x29>
+	}
+}
+  805e0d:	48 83 c4 28          	add    $0x28,%rsp
+  805e11:	5b                   	pop    %rbx
+  805e12:	41 5c                	pop    %r12
+  805e14:	41 5f                	pop    %r15
+  805e16:	5d                   	pop    %rbp
+  805e17:	c3                   	ret
+
+0000000000805e18 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805e18:	55                   	push   %rbp
+  805e19:	48 89 e5             	mov    %rsp,%rbp
+  805e1c:	41 57                	push   %r15
+  805e1e:	53                   	push   %rbx
+  805e1f:	48 83 ec 30          	sub    $0x30,%rsp
+  805e23:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e23 <pipeisclosed+0xb>
+  805e2a:	49 bb 1d 32 00 00 00 	movabs $0x321d,%r11
+  805e31:	00 00 00 
+  805e34:	4c 01 db             	add    %r11,%rbx
+  805e37:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805e3a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805e3e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805e41:	48 89 d6             	mov    %rdx,%rsi
+  805e44:	89 c7                	mov    %eax,%edi
+  805e46:	49 89 df             	mov    %rbx,%r15
+  805e49:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  805e50:	ff ff ff 
+  805e53:	48 01 d8             	add    %rbx,%rax
+  805e56:	ff d0                	call   *%rax
+  805e58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e5f:	79 05                	jns    805e66 <pipeisclosed+0x4e>
+		return r;
+  805e61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e64:	eb 3b                	jmp    805ea1 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805e66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e6a:	48 89 c7             	mov    %rax,%rdi
+  805e6d:	49 89 df             	mov    %rbx,%r15
+  805e70:	48 b8 d5 a6 ff ff ff 	movabs $0xffffffffffffa6d5,%rax
+  805e77:	ff ff ff 
+  805e7a:	48 01 d8             	add    %rbx,%rax
+  805e7d:	ff d0                	call   *%rax
+  805e7f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805e83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e87:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e8b:	48 89 d6             	mov    %rdx,%rsi
+  805e8e:	48 89 c7             	mov    %rax,%rdi
+  805e91:	48 b8 bf cc ff ff ff 	movabs $0xffffffffffffccbf,%rax
+  805e98:	ff ff ff 
+  805e9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e9f:	ff d0                	call   *%rax
+}
+  805ea1:	48 83 c4 30          	add    $0x30,%rsp
+  805ea5:	5b                   	pop    %rbx
+  805ea6:	41 5f                	pop    %r15
+  805ea8:	5d                   	pop    %rbp
+  805ea9:	c3                   	ret
+
+0000000000805eaa <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805eaa:	55                   	push   %rbp
+  805eab:	48 89 e5             	mov    %rsp,%rbp
+  805eae:	41 57                	push   %r15
+  805eb0:	53                   	push   %rbx
+  805eb1:	48 83 ec 40          	sub    $0x40,%rsp
+  805eb5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805eb5 <devpipe_read+0xb>
+  805ebc:	49 bb 8b 31 00 00 00 	movabs $0x318b,%r11
+  805ec3:	00 00 00 
+  805ec6:	4c 01 db             	add    %r11,%rbx
+  805ec9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805ecd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805ed1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805ed5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ed9:	48 89 c7             	mov    %rax,%rdi
+  805edc:	49 89 df             	mov    %rbx,%r15
+  805edf:	48 b8 d5 a6 ff ff ff 	movabs $0xffffffffffffa6d5,%rax
+  805ee6:	ff ff ff 
+  805ee9:	48 01 d8             	add    %rbx,%rax
+  805eec:	ff d0                	call   *%rax
+  805eee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805ef2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805ef6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805efa:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805f01:	00 
+  805f02:	e9 a1 00 00 00       	jmp    805fa8 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805f07:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805f0c:	74 09                	je     805f17 <devpipe_read+0x6d>
+				return i;
+  805f0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f12:	e9 9f 00 00 00       	jmp    805fb6 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805f17:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805f1f:	48 89 d6             	mov    %rdx,%rsi
+  805f22:	48 89 c7             	mov    %rax,%rdi
+  805f25:	48 b8 bf cc ff ff ff 	movabs $0xffffffffffffccbf,%rax
+  805f2c:	ff ff ff 
+  805f2f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f33:	ff d0                	call   *%rax
+  805f35:	85 c0                	test   %eax,%eax
+  805f37:	74 07                	je     805f40 <devpipe_read+0x96>
+				return 0;
+  805f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f3e:	eb 76                	jmp    805fb6 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805f40:	49 89 df             	mov    %rbx,%r15
+  805f43:	48 b8 14 93 ff ff ff 	movabs $0xffffffffffff9314,%rax
+  805f4a:	ff ff ff 
+  805f4d:	48 01 d8             	add    %rbx,%rax
+  805f50:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805f52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f56:	8b 10                	mov    (%rax),%edx
+  805f58:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f5c:	8b 40 04             	mov    0x4(%rax),%eax
+  805f5f:	39 c2                	cmp    %eax,%edx
+  805f61:	74 a4                	je     805f07 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805f63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f67:	8b 10                	mov    (%rax),%edx
+  805f69:	89 d0                	mov    %edx,%eax
+  805f6b:	c1 f8 1f             	sar    $0x1f,%eax
+  805f6e:	c1 e8 1b             	shr    $0x1b,%eax
+  805f71:	01 c2                	add    %eax,%edx
+  805f73:	83 e2 1f             	and    $0x1f,%edx
+  805f76:	29 c2                	sub    %eax,%edx
+  805f78:	89 d6                	mov    %edx,%esi
+  805f7a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805f7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f82:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805f86:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f8a:	48 63 c6             	movslq %esi,%rax
+  805f8d:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805f92:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805f94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f98:	8b 00                	mov    (%rax),%eax
+  805f9a:	8d 50 01             	lea    0x1(%rax),%edx
+  805f9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805fa1:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805fa3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805fa8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fac:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805fb0:	72 a0                	jb     805f52 <devpipe_read+0xa8>
+	}
+	return i;
+  805fb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805fb6:	48 83 c4 40          	add    $0x40,%rsp
+  805fba:	5b                   	pop    %rbx
+  805fbb:	41 5f                	pop    %r15
+  805fbd:	5d                   	pop    %rbp
+  805fbe:	c3                   	ret
+
+0000000000805fbf <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805fbf:	55                   	push   %rbp
+  805fc0:	48 89 e5             	mov    %rsp,%rbp
+  805fc3:	41 57                	push   %r15
+  805fc5:	53                   	push   %rbx
+  805fc6:	48 83 ec 40          	sub    $0x40,%rsp
+  805fca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fca <devpipe_write+0xb>
+  805fd1:	49 bb 76 30 00 00 00 	movabs $0x3076,%r11
+  805fd8:	00 00 00 
+  805fdb:	4c 01 db             	add    %r11,%rbx
+  805fde:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805fe2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805fe6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805fea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805fee:	48 89 c7             	mov    %rax,%rdi
+  805ff1:	49 89 df             	mov    %rbx,%r15
+  805ff4:	48 b8 d5 a6 ff ff ff 	movabs $0xffffffffffffa6d5,%rax
+  805ffb:	ff ff ff 
+  805ffe:	48 01 d8             	add    %rbx,%rax
+  806001:	ff d0                	call   *%rax
+  806003:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806007:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80600b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80600f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806016:	00 
+  806017:	e9 a0 00 00 00       	jmp    8060bc <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80601c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806020:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806024:	48 89 d6             	mov    %rdx,%rsi
+  806027:	48 89 c7             	mov    %rax,%rdi
+  80602a:	48 b8 bf cc ff ff ff 	movabs $0xffffffffffffccbf,%rax
+  806031:	ff ff ff 
+  806034:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806038:	ff d0                	call   *%rax
+  80603a:	85 c0                	test   %eax,%eax
+  80603c:	74 0a                	je     806048 <devpipe_write+0x89>
+				return 0;
+  80603e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806043:	e9 82 00 00 00       	jmp    8060ca <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  806048:	49 89 df             	mov    %rbx,%r15
+  80604b:	48 b8 14 93 ff ff ff 	movabs $0xffffffffffff9314,%rax
+  806052:	ff ff ff 
+  806055:	48 01 d8             	add    %rbx,%rax
+  806058:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80605a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80605e:	8b 40 04             	mov    0x4(%rax),%eax
+  806061:	48 63 d0             	movslq %eax,%rdx
+  806064:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806068:	8b 00                	mov    (%rax),%eax
+  80606a:	48 98                	cltq
+  80606c:	48 83 c0 20          	add    $0x20,%rax
+  806070:	48 39 c2             	cmp    %rax,%rdx
+  806073:	73 a7                	jae    80601c <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806075:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806079:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80607d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806081:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806085:	8b 50 04             	mov    0x4(%rax),%edx
+  806088:	89 d0                	mov    %edx,%eax
+  80608a:	c1 f8 1f             	sar    $0x1f,%eax
+  80608d:	c1 e8 1b             	shr    $0x1b,%eax
+  806090:	01 c2                	add    %eax,%edx
+  806092:	83 e2 1f             	and    $0x1f,%edx
+  806095:	29 c2                	sub    %eax,%edx
+  806097:	89 d0                	mov    %edx,%eax
+  806099:	0f b6 09             	movzbl (%rcx),%ecx
+  80609c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8060a0:	48 98                	cltq
+  8060a2:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  8060a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060aa:	8b 40 04             	mov    0x4(%rax),%eax
+  8060ad:	8d 50 01             	lea    0x1(%rax),%edx
+  8060b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8060b4:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8060b7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8060bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060c0:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8060c4:	72 94                	jb     80605a <devpipe_write+0x9b>
+	}
+
+	return i;
+  8060c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8060ca:	48 83 c4 40          	add    $0x40,%rsp
+  8060ce:	5b                   	pop    %rbx
+  8060cf:	41 5f                	pop    %r15
+  8060d1:	5d                   	pop    %rbp
+  8060d2:	c3                   	ret
+
+00000000008060d3 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8060d3:	55                   	push   %rbp
+  8060d4:	48 89 e5             	mov    %rsp,%rbp
+  8060d7:	41 57                	push   %r15
+  8060d9:	53                   	push   %rbx
+  8060da:	48 83 ec 20          	sub    $0x20,%rsp
+  8060de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060de <devpipe_stat+0xb>
+  8060e5:	49 bb 62 2f 00 00 00 	movabs $0x2f62,%r11
+  8060ec:	00 00 00 
+  8060ef:	4c 01 db             	add    %r11,%rbx
+  8060f2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8060f6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8060fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060fe:	48 89 c7             	mov    %rax,%rdi
+  806101:	49 89 df             	mov    %rbx,%r15
+  806104:	48 b8 d5 a6 ff ff ff 	movabs $0xffffffffffffa6d5,%rax
+  80610b:	ff ff ff 
+  80610e:	48 01 d8             	add    %rbx,%rax
+  806111:	ff d0                	call   *%rax
+  806113:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  806117:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80611b:	48 ba 01 e7 ff ff ff 	movabs $0xffffffffffffe701,%rdx
+  806122:	ff ff ff 
+  806125:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806129:	48 89 d6             	mov    %rdx,%rsi
+  80612c:	48 89 c7             	mov    %rax,%rdi
+  80612f:	49 89 df             	mov    %rbx,%r15
+  806132:	48 b8 ad 86 ff ff ff 	movabs $0xffffffffffff86ad,%rax
+  806139:	ff ff ff 
+  80613c:	48 01 d8             	add    %rbx,%rax
+  80613f:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  806141:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806145:	8b 50 04             	mov    0x4(%rax),%edx
+  806148:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80614c:	8b 00                	mov    (%rax),%eax
+  80614e:	29 c2                	sub    %eax,%edx
+  806150:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806154:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  80615a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80615e:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806165:	00 00 00 
+	stat->st_dev = &devpipe;
+  806168:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80616c:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806173:	00 00 00 
+  806176:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80617a:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806181:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806186:	48 83 c4 20          	add    $0x20,%rsp
+  80618a:	5b                   	pop    %rbx
+  80618b:	41 5f                	pop    %r15
+  80618d:	5d                   	pop    %rbp
+  80618e:	c3                   	ret
+
+000000000080618f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80618f:	55                   	push   %rbp
+  806190:	48 89 e5             	mov    %rsp,%rbp
+  806193:	41 57                	push   %r15
+  806195:	53                   	push   %rbx
+  806196:	48 83 ec 10          	sub    $0x10,%rsp
+  80619a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80619a <devpipe_close+0xb>
+  8061a1:	49 bb a6 2e 00 00 00 	movabs $0x2ea6,%r11
+  8061a8:	00 00 00 
+  8061ab:	4c 01 db             	add    %r11,%rbx
+  8061ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8061b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061b6:	48 89 c6             	mov    %rax,%rsi
+  8061b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061be:	49 89 df             	mov    %rbx,%r15
+  8061c1:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  8061c8:	ff ff ff 
+  8061cb:	48 01 d8             	add    %rbx,%rax
+  8061ce:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8061d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061d4:	48 89 c7             	mov    %rax,%rdi
+  8061d7:	49 89 df             	mov    %rbx,%r15
+  8061da:	48 b8 d5 a6 ff ff ff 	movabs $0xffffffffffffa6d5,%rax
+  8061e1:	ff ff ff 
+  8061e4:	48 01 d8             	add    %rbx,%rax
+  8061e7:	ff d0                	call   *%rax
+  8061e9:	48 89 c6             	mov    %rax,%rsi
+  8061ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061f1:	49 89 df             	mov    %rbx,%r15
+  8061f4:	48 b8 41 94 ff ff ff 	movabs $0xffffffffffff9441,%rax
+  8061fb:	ff ff ff 
+  8061fe:	48 01 d8             	add    %rbx,%rax
+  806201:	ff d0                	call   *%rax
+}
+  806203:	48 83 c4 10          	add    $0x10,%rsp
+  806207:	5b                   	pop    %rbx
+  806208:	41 5f                	pop    %r15
+  80620a:	5d                   	pop    %rbp
+  80620b:	c3                   	ret
+
+000000000080620c <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80620c:	55                   	push   %rbp
+  80620d:	48 89 e5             	mov    %rsp,%rbp
+  806210:	41 57                	push   %r15
+  806212:	48 83 ec 28          	sub    $0x28,%rsp
+  806216:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806216 <cputchar+0xa>
+  80621d:	49 bb 2a 2e 00 00 00 	movabs $0x2e2a,%r11
+  806224:	00 00 00 
+  806227:	4c 01 d8             	add    %r11,%rax
+  80622a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80622d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806230:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806233:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806237:	be 01 00 00 00       	mov    $0x1,%esi
+  80623c:	48 89 d7             	mov    %rdx,%rdi
+  80623f:	49 89 c7             	mov    %rax,%r15
+  806242:	48 ba b1 91 ff ff ff 	movabs $0xffffffffffff91b1,%rdx
+  806249:	ff ff ff 
+  80624c:	48 01 c2             	add    %rax,%rdx
+  80624f:	ff d2                	call   *%rdx
+}
+  806251:	90                   	nop
+  806252:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806256:	c9                   	leave
+  806257:	c3                   	ret
+
+0000000000806258 <getchar>:
+
+int
+getchar(void)
+{
+  806258:	55                   	push   %rbp
+  806259:	48 89 e5             	mov    %rsp,%rbp
+  80625c:	41 57                	push   %r15
+  80625e:	48 83 ec 18          	sub    $0x18,%rsp
+  806262:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806262 <getchar+0xa>
+  806269:	49 bb de 2d 00 00 00 	movabs $0x2dde,%r11
+  806270:	00 00 00 
+  806273:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806276:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80627a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80627f:	48 89 ce             	mov    %rcx,%rsi
+  806282:	bf 00 00 00 00       	mov    $0x0,%edi
+  806287:	49 89 c7             	mov    %rax,%r15
+  80628a:	48 b9 15 ad ff ff ff 	movabs $0xffffffffffffad15,%rcx
+  806291:	ff ff ff 
+  806294:	48 01 c1             	add    %rax,%rcx
+  806297:	ff d1                	call   *%rcx
+  806299:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80629c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062a0:	79 05                	jns    8062a7 <getchar+0x4f>
+		return r;
+  8062a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062a5:	eb 14                	jmp    8062bb <getchar+0x63>
+	if (r < 1)
+  8062a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062ab:	7f 07                	jg     8062b4 <getchar+0x5c>
+		return -E_EOF;
+  8062ad:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8062b2:	eb 07                	jmp    8062bb <getchar+0x63>
+	return c;
+  8062b4:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8062b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8062bb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8062bf:	c9                   	leave
+  8062c0:	c3                   	ret
+
+00000000008062c1 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8062c1:	55                   	push   %rbp
+  8062c2:	48 89 e5             	mov    %rsp,%rbp
+  8062c5:	41 57                	push   %r15
+  8062c7:	53                   	push   %rbx
+  8062c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8062cc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8062cc <iscons+0xb>
+  8062d3:	49 bb 74 2d 00 00 00 	movabs $0x2d74,%r11
+  8062da:	00 00 00 
+  8062dd:	4c 01 db             	add    %r11,%rbx
+  8062e0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8062e3:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8062e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8062ea:	48 89 d6             	mov    %rdx,%rsi
+  8062ed:	89 c7                	mov    %eax,%edi
+  8062ef:	49 89 df             	mov    %rbx,%r15
+  8062f2:	48 b8 ce a7 ff ff ff 	movabs $0xffffffffffffa7ce,%rax
+  8062f9:	ff ff ff 
+  8062fc:	48 01 d8             	add    %rbx,%rax
+  8062ff:	ff d0                	call   *%rax
+  806301:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806304:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806308:	79 05                	jns    80630f <iscons+0x4e>
+		return r;
+  80630a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80630d:	eb 1b                	jmp    80632a <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80630f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806313:	8b 10                	mov    (%rax),%edx
+  806315:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  80631c:	00 00 00 
+  80631f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806322:	39 c2                	cmp    %eax,%edx
+  806324:	0f 94 c0             	sete   %al
+  806327:	0f b6 c0             	movzbl %al,%eax
+}
+  80632a:	48 83 c4 20          	add    $0x20,%rsp
+  80632e:	5b                   	pop    %rbx
+  80632f:	41 5f                	pop    %r15
+  806331:	5d                   	pop    %rbp
+  806332:	c3                   	ret
+
+0000000000806333 <opencons>:
+
+int
+opencons(void)
+{
+  806333:	55                   	push   %rbp
+  806334:	48 89 e5             	mov    %rsp,%rbp
+  806337:	41 57                	push   %r15
+  806339:	53                   	push   %rbx
+  80633a:	48 83 ec 10          	sub    $0x10,%rsp
+  80633e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80633e <opencons+0xb>
+  806345:	49 bb 02 2d 00 00 00 	movabs $0x2d02,%r11
+  80634c:	00 00 00 
+  80634f:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806352:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806356:	48 89 c7             	mov    %rax,%rdi
+  806359:	49 89 df             	mov    %rbx,%r15
+  80635c:	48 b8 18 a7 ff ff ff 	movabs $0xffffffffffffa718,%rax
+  806363:	ff ff ff 
+  806366:	48 01 d8             	add    %rbx,%rax
+  806369:	ff d0                	call   *%rax
+  80636b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80636e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806372:	79 05                	jns    806379 <opencons+0x46>
+		return r;
+  806374:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806377:	eb 68                	jmp    8063e1 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806379:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80637d:	ba 07 04 00 00       	mov    $0x407,%edx
+  806382:	48 89 c6             	mov    %rax,%rsi
+  806385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80638a:	49 89 df             	mov    %rbx,%r15
+  80638d:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  806394:	ff ff ff 
+  806397:	48 01 d8             	add    %rbx,%rax
+  80639a:	ff d0                	call   *%rax
+  80639c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80639f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8063a3:	79 05                	jns    8063aa <opencons+0x77>
+		return r;
+  8063a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063a8:	eb 37                	jmp    8063e1 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8063aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063ae:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  8063b5:	00 00 00 
+  8063b8:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8063bb:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8063bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063c1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8063c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063cc:	48 89 c7             	mov    %rax,%rdi
+  8063cf:	49 89 df             	mov    %rbx,%r15
+  8063d2:	48 b8 9e a6 ff ff ff 	movabs $0xffffffffffffa69e,%rax
+  8063d9:	ff ff ff 
+  8063dc:	48 01 d8             	add    %rbx,%rax
+  8063df:	ff d0                	call   *%rax
+}
+  8063e1:	48 83 c4 10          	add    $0x10,%rsp
+  8063e5:	5b                   	pop    %rbx
+  8063e6:	41 5f                	pop    %r15
+  8063e8:	5d                   	pop    %rbp
+  8063e9:	c3                   	ret
+
+00000000008063ea <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8063ea:	55                   	push   %rbp
+  8063eb:	48 89 e5             	mov    %rsp,%rbp
+  8063ee:	41 57                	push   %r15
+  8063f0:	53                   	push   %rbx
+  8063f1:	48 83 ec 30          	sub    $0x30,%rsp
+  8063f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063f5 <devcons_read+0xb>
+  8063fc:	49 bb 4b 2c 00 00 00 	movabs $0x2c4b,%r11
+  806403:	00 00 00 
+  806406:	4c 01 db             	add    %r11,%rbx
+  806409:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80640d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806411:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806415:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80641a:	75 19                	jne    806435 <devcons_read+0x4b>
+		return 0;
+  80641c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806421:	eb 55                	jmp    806478 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806423:	49 89 df             	mov    %rbx,%r15
+  806426:	48 b8 14 93 ff ff ff 	movabs $0xffffffffffff9314,%rax
+  80642d:	ff ff ff 
+  806430:	48 01 d8             	add    %rbx,%rax
+  806433:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806435:	49 89 df             	mov    %rbx,%r15
+  806438:	48 b8 10 92 ff ff ff 	movabs $0xffffffffffff9210,%rax
+  80643f:	ff ff ff 
+  806442:	48 01 d8             	add    %rbx,%rax
+  806445:	ff d0                	call   *%rax
+  806447:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80644a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80644e:	74 d3                	je     806423 <devcons_read+0x39>
+	if (c < 0)
+  806450:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806454:	79 05                	jns    80645b <devcons_read+0x71>
+		return c;
+  806456:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806459:	eb 1d                	jmp    806478 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  80645b:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80645f:	75 07                	jne    806468 <devcons_read+0x7e>
+		return 0;
+  806461:	b8 00 00 00 00       	mov    $0x0,%eax
+  806466:	eb 10                	jmp    806478 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806468:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80646b:	89 c2                	mov    %eax,%edx
+  80646d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806471:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806473:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806478:	48 83 c4 30          	add    $0x30,%rsp
+  80647c:	5b                   	pop    %rbx
+  80647d:	41 5f                	pop    %r15
+  80647f:	5d                   	pop    %rbp
+  806480:	c3                   	ret
+
+0000000000806481 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806481:	55                   	push   %rbp
+  806482:	48 89 e5             	mov    %rsp,%rbp
+  806485:	41 57                	push   %r15
+  806487:	53                   	push   %rbx
+  806488:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80648f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80648f <devcons_write+0xe>
+  806496:	49 bb b1 2b 00 00 00 	movabs $0x2bb1,%r11
+  80649d:	00 00 00 
+  8064a0:	4c 01 db             	add    %r11,%rbx
+  8064a3:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8064aa:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8064b1:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8064b8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8064bf:	e9 80 00 00 00       	jmp    806544 <devcons_write+0xc3>
+		m = n - tot;
+  8064c4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8064cb:	89 c2                	mov    %eax,%edx
+  8064cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064d0:	29 c2                	sub    %eax,%edx
+  8064d2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8064d5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8064d8:	83 f8 7f             	cmp    $0x7f,%eax
+  8064db:	76 07                	jbe    8064e4 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8064dd:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8064e4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8064e7:	48 63 d0             	movslq %eax,%rdx
+  8064ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064ed:	48 63 c8             	movslq %eax,%rcx
+  8064f0:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8064f7:	48 01 c1             	add    %rax,%rcx
+  8064fa:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806501:	48 89 ce             	mov    %rcx,%rsi
+  806504:	48 89 c7             	mov    %rax,%rdi
+  806507:	49 89 df             	mov    %rbx,%r15
+  80650a:	48 b8 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rax
+  806511:	ff ff ff 
+  806514:	48 01 d8             	add    %rbx,%rax
+  806517:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806519:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80651c:	48 63 d0             	movslq %eax,%rdx
+  80651f:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806526:	48 89 d6             	mov    %rdx,%rsi
+  806529:	48 89 c7             	mov    %rax,%rdi
+  80652c:	49 89 df             	mov    %rbx,%r15
+  80652f:	48 b8 b1 91 ff ff ff 	movabs $0xffffffffffff91b1,%rax
+  806536:	ff ff ff 
+  806539:	48 01 d8             	add    %rbx,%rax
+  80653c:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80653e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806541:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806544:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806547:	48 98                	cltq
+  806549:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806550:	0f 82 6e ff ff ff    	jb     8064c4 <devcons_write+0x43>
+	}
+	return tot;
+  806556:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806559:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806560:	5b                   	pop    %rbx
+  806561:	41 5f                	pop    %r15
+  806563:	5d                   	pop    %rbp
+  806564:	c3                   	ret
+
+0000000000806565 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806565:	55                   	push   %rbp
+  806566:	48 89 e5             	mov    %rsp,%rbp
+  806569:	48 83 ec 08          	sub    $0x8,%rsp
+  80656d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80656d <devcons_close+0x8>
+  806574:	49 bb d3 2a 00 00 00 	movabs $0x2ad3,%r11
+  80657b:	00 00 00 
+  80657e:	4c 01 d8             	add    %r11,%rax
+  806581:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806585:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80658a:	c9                   	leave
+  80658b:	c3                   	ret
+
+000000000080658c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80658c:	55                   	push   %rbp
+  80658d:	48 89 e5             	mov    %rsp,%rbp
+  806590:	41 57                	push   %r15
+  806592:	48 83 ec 18          	sub    $0x18,%rsp
+  806596:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806596 <devcons_stat+0xa>
+  80659d:	49 bb aa 2a 00 00 00 	movabs $0x2aaa,%r11
+  8065a4:	00 00 00 
+  8065a7:	4c 01 d8             	add    %r11,%rax
+  8065aa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8065ae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8065b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8065b6:	48 b9 0d e7 ff ff ff 	movabs $0xffffffffffffe70d,%rcx
+  8065bd:	ff ff ff 
+  8065c0:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8065c4:	48 89 ce             	mov    %rcx,%rsi
+  8065c7:	48 89 d7             	mov    %rdx,%rdi
+  8065ca:	49 89 c7             	mov    %rax,%r15
+  8065cd:	48 ba ad 86 ff ff ff 	movabs $0xffffffffffff86ad,%rdx
+  8065d4:	ff ff ff 
+  8065d7:	48 01 c2             	add    %rax,%rdx
+  8065da:	ff d2                	call   *%rdx
+	return 0;
+  8065dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8065e1:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8065e5:	c9                   	leave
+  8065e6:	c3                   	ret
+
+00000000008065e7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8065e7:	55                   	push   %rbp
+  8065e8:	48 89 e5             	mov    %rsp,%rbp
+  8065eb:	41 57                	push   %r15
+  8065ed:	53                   	push   %rbx
+  8065ee:	48 83 ec 20          	sub    $0x20,%rsp
+  8065f2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065f2 <set_pgfault_handler+0xb>
+  8065f9:	49 bb 4e 2a 00 00 00 	movabs $0x2a4e,%r11
+  806600:	00 00 00 
+  806603:	4c 01 db             	add    %r11,%rbx
+  806606:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  80660a:	49 89 df             	mov    %rbx,%r15
+  80660d:	48 b8 c0 92 ff ff ff 	movabs $0xffffffffffff92c0,%rax
+  806614:	ff ff ff 
+  806617:	48 01 d8             	add    %rbx,%rax
+  80661a:	ff d0                	call   *%rax
+  80661c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  80661f:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806626:	00 00 00 
+  806629:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80662d:	48 85 c0             	test   %rax,%rax
+  806630:	75 6b                	jne    80669d <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806632:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806635:	ba 07 00 00 00       	mov    $0x7,%edx
+  80663a:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80663f:	48 89 ce             	mov    %rcx,%rsi
+  806642:	89 c7                	mov    %eax,%edi
+  806644:	49 89 df             	mov    %rbx,%r15
+  806647:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  80664e:	ff ff ff 
+  806651:	48 01 d8             	add    %rbx,%rax
+  806654:	ff d0                	call   *%rax
+  806656:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806659:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80665d:	74 3e                	je     80669d <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  80665f:	48 b8 18 e7 ff ff ff 	movabs $0xffffffffffffe718,%rax
+  806666:	ff ff ff 
+  806669:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80666d:	48 89 c2             	mov    %rax,%rdx
+  806670:	be 23 00 00 00       	mov    $0x23,%esi
+  806675:	48 b8 46 e7 ff ff ff 	movabs $0xffffffffffffe746,%rax
+  80667c:	ff ff ff 
+  80667f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806683:	48 89 c7             	mov    %rax,%rdi
+  806686:	49 89 df             	mov    %rbx,%r15
+  806689:	b8 00 00 00 00       	mov    $0x0,%eax
+  80668e:	48 b9 14 76 ff ff ff 	movabs $0xffffffffffff7614,%rcx
+  806695:	ff ff ff 
+  806698:	48 01 d9             	add    %rbx,%rcx
+  80669b:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80669d:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  8066a4:	00 00 00 
+  8066a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8066ab:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  8066af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066b2:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8066b9:	ff ff ff 
+  8066bc:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8066c0:	48 89 d6             	mov    %rdx,%rsi
+  8066c3:	89 c7                	mov    %eax,%edi
+  8066c5:	49 89 df             	mov    %rbx,%r15
+  8066c8:	48 b8 5f 95 ff ff ff 	movabs $0xffffffffffff955f,%rax
+  8066cf:	ff ff ff 
+  8066d2:	48 01 d8             	add    %rbx,%rax
+  8066d5:	ff d0                	call   *%rax
+}
+  8066d7:	90                   	nop
+  8066d8:	48 83 c4 20          	add    $0x20,%rsp
+  8066dc:	5b                   	pop    %rbx
+  8066dd:	41 5f                	pop    %r15
+  8066df:	5d                   	pop    %rbp
+  8066e0:	c3                   	ret
+
+00000000008066e1 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  8066e1:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  8066e4:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  8066eb:	00 00 00 
+call *%rax
+  8066ee:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  8066f0:	58                   	pop    %rax
+	popq %rax;
+  8066f1:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  8066f2:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  8066f9:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  8066fd:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806701:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806705:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806709:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  80670d:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806710:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806714:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806718:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80671d:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806722:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806727:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80672c:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806731:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806736:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80673b:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806740:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806745:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80674a:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80674f:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806754:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806759:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80675e:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806762:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806766:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806767:	5c                   	pop    %rsp
+	ret;			//return
+  806768:	c3                   	ret
+
+0000000000806769 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806769:	55                   	push   %rbp
+  80676a:	48 89 e5             	mov    %rsp,%rbp
+  80676d:	41 57                	push   %r15
+  80676f:	53                   	push   %rbx
+  806770:	48 83 ec 30          	sub    $0x30,%rsp
+  806774:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806774 <ipc_recv+0xb>
+  80677b:	49 bb cc 28 00 00 00 	movabs $0x28cc,%r11
+  806782:	00 00 00 
+  806785:	4c 01 db             	add    %r11,%rbx
+  806788:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80678c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806790:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  806794:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806799:	75 0e                	jne    8067a9 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  80679b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8067a2:	00 00 00 
+  8067a5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8067a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8067ad:	48 89 c7             	mov    %rax,%rdi
+  8067b0:	49 89 df             	mov    %rbx,%r15
+  8067b3:	48 b8 92 96 ff ff ff 	movabs $0xffffffffffff9692,%rax
+  8067ba:	ff ff ff 
+  8067bd:	48 01 d8             	add    %rbx,%rax
+  8067c0:	ff d0                	call   *%rax
+  8067c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8067c5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8067ca:	74 2a                	je     8067f6 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8067cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067d0:	75 19                	jne    8067eb <ipc_recv+0x82>
+  8067d2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8067d9:	ff ff ff 
+  8067dc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8067e0:	48 8b 00             	mov    (%rax),%rax
+  8067e3:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8067e9:	eb 05                	jmp    8067f0 <ipc_recv+0x87>
+  8067eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067f0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8067f4:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8067f6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8067fb:	74 2a                	je     806827 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8067fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806801:	75 19                	jne    80681c <ipc_recv+0xb3>
+  806803:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80680a:	ff ff ff 
+  80680d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806811:	48 8b 00             	mov    (%rax),%rax
+  806814:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80681a:	eb 05                	jmp    806821 <ipc_recv+0xb8>
+  80681c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806821:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806825:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806827:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80682b:	74 05                	je     806832 <ipc_recv+0xc9>
+		return res;
+  80682d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806830:	eb 17                	jmp    806849 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806832:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806839:	ff ff ff 
+  80683c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806840:	48 8b 00             	mov    (%rax),%rax
+  806843:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806849:	48 83 c4 30          	add    $0x30,%rsp
+  80684d:	5b                   	pop    %rbx
+  80684e:	41 5f                	pop    %r15
+  806850:	5d                   	pop    %rbp
+  806851:	c3                   	ret
+
+0000000000806852 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806852:	55                   	push   %rbp
+  806853:	48 89 e5             	mov    %rsp,%rbp
+  806856:	41 57                	push   %r15
+  806858:	53                   	push   %rbx
+  806859:	48 83 ec 20          	sub    $0x20,%rsp
+  80685d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80685d <ipc_send+0xb>
+  806864:	49 bb e3 27 00 00 00 	movabs $0x27e3,%r11
+  80686b:	00 00 00 
+  80686e:	4c 01 db             	add    %r11,%rbx
+  806871:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806874:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806877:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80687b:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  80687e:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806883:	75 0e                	jne    806893 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806885:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80688c:	00 00 00 
+  80688f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  806893:	90                   	nop
+  806894:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806897:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80689a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80689e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068a1:	89 c7                	mov    %eax,%edi
+  8068a3:	49 89 df             	mov    %rbx,%r15
+  8068a6:	48 b8 28 96 ff ff ff 	movabs $0xffffffffffff9628,%rax
+  8068ad:	ff ff ff 
+  8068b0:	48 01 d8             	add    %rbx,%rax
+  8068b3:	ff d0                	call   *%rax
+  8068b5:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8068b8:	74 da                	je     806894 <ipc_send+0x42>
+		;
+}
+  8068ba:	90                   	nop
+  8068bb:	90                   	nop
+  8068bc:	48 83 c4 20          	add    $0x20,%rsp
+  8068c0:	5b                   	pop    %rbx
+  8068c1:	41 5f                	pop    %r15
+  8068c3:	5d                   	pop    %rbp
+  8068c4:	c3                   	ret
+
+00000000008068c5 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8068c5:	55                   	push   %rbp
+  8068c6:	48 89 e5             	mov    %rsp,%rbp
+  8068c9:	41 57                	push   %r15
+  8068cb:	53                   	push   %rbx
+  8068cc:	48 83 ec 40          	sub    $0x40,%rsp
+  8068d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068d0 <ipc_call+0xb>
+  8068d7:	49 bb 70 27 00 00 00 	movabs $0x2770,%r11
+  8068de:	00 00 00 
+  8068e1:	4c 01 db             	add    %r11,%rbx
+  8068e4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8068e7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8068ea:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8068ee:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8068f1:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8068f5:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8068f9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8068fe:	75 0e                	jne    80690e <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806900:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806907:	00 00 00 
+  80690a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80690e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806913:	75 0e                	jne    806923 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806915:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80691c:	00 00 00 
+  80691f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806923:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806926:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80692a:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80692d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806931:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806934:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80693a:	49 89 f8             	mov    %rdi,%r8
+  80693d:	89 c7                	mov    %eax,%edi
+  80693f:	49 89 df             	mov    %rbx,%r15
+  806942:	48 b8 eb 96 ff ff ff 	movabs $0xffffffffffff96eb,%rax
+  806949:	ff ff ff 
+  80694c:	48 01 d8             	add    %rbx,%rax
+  80694f:	ff d0                	call   *%rax
+  806951:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806954:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806959:	74 2a                	je     806985 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80695b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80695f:	75 19                	jne    80697a <ipc_call+0xb5>
+  806961:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806968:	ff ff ff 
+  80696b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80696f:	48 8b 00             	mov    (%rax),%rax
+  806972:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806978:	eb 05                	jmp    80697f <ipc_call+0xba>
+  80697a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80697f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806983:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806985:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806989:	74 05                	je     806990 <ipc_call+0xcb>
+		return r;
+  80698b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80698e:	eb 17                	jmp    8069a7 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806990:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806997:	ff ff ff 
+  80699a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80699e:	48 8b 00             	mov    (%rax),%rax
+  8069a1:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8069a7:	48 83 c4 40          	add    $0x40,%rsp
+  8069ab:	5b                   	pop    %rbx
+  8069ac:	41 5f                	pop    %r15
+  8069ae:	5d                   	pop    %rbp
+  8069af:	c3                   	ret
+
+00000000008069b0 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8069b0:	55                   	push   %rbp
+  8069b1:	48 89 e5             	mov    %rsp,%rbp
+  8069b4:	41 57                	push   %r15
+  8069b6:	53                   	push   %rbx
+  8069b7:	48 83 ec 70          	sub    $0x70,%rsp
+  8069bb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069bb <ipc_callw+0xb>
+  8069c2:	49 bb 85 26 00 00 00 	movabs $0x2685,%r11
+  8069c9:	00 00 00 
+  8069cc:	4c 01 db             	add    %r11,%rbx
+  8069cf:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8069d2:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8069d5:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8069d9:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8069dd:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8069e2:	76 0a                	jbe    8069ee <ipc_callw+0x3e>
+		return -E_INVAL;
+  8069e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8069e9:	e9 b7 00 00 00       	jmp    806aa5 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8069ee:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8069f2:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8069f6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8069fa:	48 89 ce             	mov    %rcx,%rsi
+  8069fd:	48 89 c7             	mov    %rax,%rdi
+  806a00:	49 89 df             	mov    %rbx,%r15
+  806a03:	48 b8 8d 8a ff ff ff 	movabs $0xffffffffffff8a8d,%rax
+  806a0a:	ff ff ff 
+  806a0d:	48 01 d8             	add    %rbx,%rax
+  806a10:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806a12:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806a19:	00 
+  806a1a:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806a1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806a22:	48 01 d0             	add    %rdx,%rax
+  806a25:	48 83 e8 01          	sub    $0x1,%rax
+  806a29:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806a2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a31:	ba 00 00 00 00       	mov    $0x0,%edx
+  806a36:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806a3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a3e:	48 29 d0             	sub    %rdx,%rax
+  806a41:	48 c1 e8 03          	shr    $0x3,%rax
+  806a45:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806a49:	89 c1                	mov    %eax,%ecx
+  806a4b:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806a4e:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806a52:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806a55:	49 89 d1             	mov    %rdx,%r9
+  806a58:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806a5f:	00 00 00 
+  806a62:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806a69:	00 00 00 
+  806a6c:	89 c7                	mov    %eax,%edi
+  806a6e:	49 89 df             	mov    %rbx,%r15
+  806a71:	48 b8 eb 96 ff ff ff 	movabs $0xffffffffffff96eb,%rax
+  806a78:	ff ff ff 
+  806a7b:	48 01 d8             	add    %rbx,%rax
+  806a7e:	ff d0                	call   *%rax
+  806a80:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806a83:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806a87:	74 05                	je     806a8e <ipc_callw+0xde>
+		return r;
+  806a89:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a8c:	eb 17                	jmp    806aa5 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806a8e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a95:	ff ff ff 
+  806a98:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a9c:	48 8b 00             	mov    (%rax),%rax
+  806a9f:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806aa5:	48 83 c4 70          	add    $0x70,%rsp
+  806aa9:	5b                   	pop    %rbx
+  806aaa:	41 5f                	pop    %r15
+  806aac:	5d                   	pop    %rbp
+  806aad:	c3                   	ret
+
+0000000000806aae <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806aae:	55                   	push   %rbp
+  806aaf:	48 89 e5             	mov    %rsp,%rbp
+  806ab2:	41 57                	push   %r15
+  806ab4:	53                   	push   %rbx
+  806ab5:	48 83 ec 40          	sub    $0x40,%rsp
+  806ab9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ab9 <ipc_callv+0xb>
+  806ac0:	49 bb 87 25 00 00 00 	movabs $0x2587,%r11
+  806ac7:	00 00 00 
+  806aca:	4c 01 db             	add    %r11,%rbx
+  806acd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806ad0:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806ad3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806ad7:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806ada:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806ade:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806ae2:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806ae9:	00 00 00 
+  806aec:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806af0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806af4:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806af8:	74 11                	je     806b0b <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806afa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806afe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806b02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806b05:	c1 e0 14             	shl    $0x14,%eax
+  806b08:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806b0b:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806b0f:	74 14                	je     806b25 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806b11:	8b 45 20             	mov    0x20(%rbp),%eax
+  806b14:	83 e8 01             	sub    $0x1,%eax
+  806b17:	48 63 d0             	movslq %eax,%rdx
+  806b1a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806b1e:	48 09 d0             	or     %rdx,%rax
+  806b21:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806b25:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806b28:	c1 e0 10             	shl    $0x10,%eax
+  806b2b:	0b 45 10             	or     0x10(%rbp),%eax
+  806b2e:	89 c1                	mov    %eax,%ecx
+  806b30:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806b33:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806b37:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806b3b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806b3f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806b42:	4d 89 c1             	mov    %r8,%r9
+  806b45:	49 89 f8             	mov    %rdi,%r8
+  806b48:	89 c7                	mov    %eax,%edi
+  806b4a:	49 89 df             	mov    %rbx,%r15
+  806b4d:	48 b8 eb 96 ff ff ff 	movabs $0xffffffffffff96eb,%rax
+  806b54:	ff ff ff 
+  806b57:	48 01 d8             	add    %rbx,%rax
+  806b5a:	ff d0                	call   *%rax
+  806b5c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806b5f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806b63:	74 05                	je     806b6a <ipc_callv+0xbc>
+		return r;
+  806b65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b68:	eb 17                	jmp    806b81 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806b6a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b71:	ff ff ff 
+  806b74:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b78:	48 8b 00             	mov    (%rax),%rax
+  806b7b:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806b81:	48 83 c4 40          	add    $0x40,%rsp
+  806b85:	5b                   	pop    %rbx
+  806b86:	41 5f                	pop    %r15
+  806b88:	5d                   	pop    %rbp
+  806b89:	c3                   	ret
+
+0000000000806b8a <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806b8a:	55                   	push   %rbp
+  806b8b:	48 89 e5             	mov    %rsp,%rbp
+  806b8e:	41 57                	push   %r15
+  806b90:	53                   	push   %rbx
+  806b91:	48 83 ec 40          	sub    $0x40,%rsp
+  806b95:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b95 <ipc_reply_recv+0xb>
+  806b9c:	49 bb ab 24 00 00 00 	movabs $0x24ab,%r11
+  806ba3:	00 00 00 
+  806ba6:	4c 01 db             	add    %r11,%rbx
+  806ba9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806bac:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806baf:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806bb3:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806bb6:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806bba:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806bbe:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806bc3:	75 0e                	jne    806bd3 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806bc5:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806bcc:	00 00 00 
+  806bcf:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806bd3:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806bd8:	75 0e                	jne    806be8 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806bda:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806be1:	00 00 00 
+  806be4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806be8:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806beb:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806bef:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806bf3:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806bf6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806bfa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806bfd:	4d 89 c1             	mov    %r8,%r9
+  806c00:	49 89 f8             	mov    %rdi,%r8
+  806c03:	89 c7                	mov    %eax,%edi
+  806c05:	49 89 df             	mov    %rbx,%r15
+  806c08:	48 b8 5f 97 ff ff ff 	movabs $0xffffffffffff975f,%rax
+  806c0f:	ff ff ff 
+  806c12:	48 01 d8             	add    %rbx,%rax
+  806c15:	ff d0                	call   *%rax
+  806c17:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806c1a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806c1f:	74 2a                	je     806c4b <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806c21:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c25:	75 19                	jne    806c40 <ipc_reply_recv+0xb6>
+  806c27:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c2e:	ff ff ff 
+  806c31:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c35:	48 8b 00             	mov    (%rax),%rax
+  806c38:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806c3e:	eb 05                	jmp    806c45 <ipc_reply_recv+0xbb>
+  806c40:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806c49:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806c4b:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806c50:	74 2a                	je     806c7c <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806c52:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c56:	75 19                	jne    806c71 <ipc_reply_recv+0xe7>
+  806c58:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c5f:	ff ff ff 
+  806c62:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c66:	48 8b 00             	mov    (%rax),%rax
+  806c69:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806c6f:	eb 05                	jmp    806c76 <ipc_reply_recv+0xec>
+  806c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c76:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806c7a:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806c7c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c80:	74 05                	je     806c87 <ipc_reply_recv+0xfd>
+		return r;
+  806c82:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c85:	eb 17                	jmp    806c9e <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806c87:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c8e:	ff ff ff 
+  806c91:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c95:	48 8b 00             	mov    (%rax),%rax
+  806c98:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806c9e:	48 83 c4 40          	add    $0x40,%rsp
+  806ca2:	5b                   	pop    %rbx
+  806ca3:	41 5f                	pop    %r15
+  806ca5:	5d                   	pop    %rbp
+  806ca6:	c3                   	ret
+
+0000000000806ca7 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806ca7:	55                   	push   %rbp
+  806ca8:	48 89 e5             	mov    %rsp,%rbp
+  806cab:	41 57                	push   %r15
+  806cad:	53                   	push   %rbx
+  806cae:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806cb5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806cb5 <ipc_window_batch+0xe>
+  806cbc:	49 bb 8b 23 00 00 00 	movabs $0x238b,%r11
+  806cc3:	00 00 00 
+  806cc6:	4c 01 db             	add    %r11,%rbx
+  806cc9:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806ccf:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806cd6:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806cdc:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806ce2:	e9 15 01 00 00       	jmp    806dfc <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806ce7:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806ced:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806cf0:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806cf7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806cfa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806cfd:	39 c2                	cmp    %eax,%edx
+  806cff:	0f 4e c2             	cmovle %edx,%eax
+  806d02:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806d05:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806d0c:	eb 6b                	jmp    806d79 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806d0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d11:	48 98                	cltq
+  806d13:	48 c1 e0 05          	shl    $0x5,%rax
+  806d17:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806d1b:	48 01 e8             	add    %rbp,%rax
+  806d1e:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806d24:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806d2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d2d:	c1 e0 0c             	shl    $0xc,%eax
+  806d30:	48 63 d0             	movslq %eax,%rdx
+  806d33:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806d3a:	48 01 c2             	add    %rax,%rdx
+  806d3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d40:	48 98                	cltq
+  806d42:	48 c1 e0 05          	shl    $0x5,%rax
+  806d46:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806d4a:	48 01 e8             	add    %rbp,%rax
+  806d4d:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806d53:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806d56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d59:	48 98                	cltq
+  806d5b:	48 c1 e0 05          	shl    $0x5,%rax
+  806d5f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806d63:	48 01 e8             	add    %rbp,%rax
+  806d66:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806d6d:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806d73:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806d75:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806d79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d7c:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806d7f:	7c 8d                	jl     806d0e <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806d81:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806d88:	74 27                	je     806db1 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806d8a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806d8d:	48 63 d0             	movslq %eax,%rdx
+  806d90:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806d97:	48 89 d6             	mov    %rdx,%rsi
+  806d9a:	48 89 c7             	mov    %rax,%rdi
+  806d9d:	49 89 df             	mov    %rbx,%r15
+  806da0:	48 b8 02 9a ff ff ff 	movabs $0xffffffffffff9a02,%rax
+  806da7:	ff ff ff 
+  806daa:	48 01 d8             	add    %rbx,%rax
+  806dad:	ff d0                	call   *%rax
+  806daf:	eb 25                	jmp    806dd6 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806db1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806db4:	48 63 d0             	movslq %eax,%rdx
+  806db7:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806dbe:	48 89 d6             	mov    %rdx,%rsi
+  806dc1:	48 89 c7             	mov    %rax,%rdi
+  806dc4:	49 89 df             	mov    %rbx,%r15
+  806dc7:	48 b8 60 9a ff ff ff 	movabs $0xffffffffffff9a60,%rax
+  806dce:	ff ff ff 
+  806dd1:	48 01 d8             	add    %rbx,%rax
+  806dd4:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806dd6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806dd9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806ddd:	79 05                	jns    806de4 <ipc_window_batch+0x13d>
+			return r;
+  806ddf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806de2:	eb 2a                	jmp    806e0e <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806de4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806de7:	c1 e0 0c             	shl    $0xc,%eax
+  806dea:	48 98                	cltq
+  806dec:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806df3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806df6:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806dfc:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806e03:	0f 8f de fe ff ff    	jg     806ce7 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806e09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806e0e:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806e15:	5b                   	pop    %rbx
+  806e16:	41 5f                	pop    %r15
+  806e18:	5d                   	pop    %rbp
+  806e19:	c3                   	ret
+
+0000000000806e1a <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806e1a:	55                   	push   %rbp
+  806e1b:	48 89 e5             	mov    %rsp,%rbp
+  806e1e:	48 83 ec 10          	sub    $0x10,%rsp
+  806e22:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e22 <ipc_map_window+0x8>
+  806e29:	49 bb 1e 22 00 00 00 	movabs $0x221e,%r11
+  806e30:	00 00 00 
+  806e33:	4c 01 d8             	add    %r11,%rax
+  806e36:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806e3a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806e3d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806e40:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806e44:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806e49:	bf 01 00 00 00       	mov    $0x1,%edi
+  806e4e:	49 b8 67 dc ff ff ff 	movabs $0xffffffffffffdc67,%r8
+  806e55:	ff ff ff 
+  806e58:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806e5c:	ff d0                	call   *%rax
+}
+  806e5e:	c9                   	leave
+  806e5f:	c3                   	ret
+
+0000000000806e60 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806e60:	55                   	push   %rbp
+  806e61:	48 89 e5             	mov    %rsp,%rbp
+  806e64:	48 83 ec 10          	sub    $0x10,%rsp
+  806e68:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e68 <ipc_unmap_window+0x8>
+  806e6f:	49 bb d8 21 00 00 00 	movabs $0x21d8,%r11
+  806e76:	00 00 00 
+  806e79:	4c 01 d8             	add    %r11,%rax
+  806e7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806e80:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806e83:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806e86:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806e8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806e8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  806e94:	49 b8 67 dc ff ff ff 	movabs $0xffffffffffffdc67,%r8
+  806e9b:	ff ff ff 
+  806e9e:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806ea2:	ff d0                	call   *%rax
+}
+  806ea4:	c9                   	leave
+  806ea5:	c3                   	ret
+
+0000000000806ea6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806ea6:	55                   	push   %rbp
+  806ea7:	48 89 e5             	mov    %rsp,%rbp
+  806eaa:	48 83 ec 18          	sub    $0x18,%rsp
+  806eae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806eae <ipc_find_env+0x8>
+  806eb5:	49 bb 92 21 00 00 00 	movabs $0x2192,%r11
+  806ebc:	00 00 00 
+  806ebf:	4c 01 d8             	add    %r11,%rax
+  806ec2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806ec5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806ecc:	eb 57                	jmp    806f25 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806ece:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806ed5:	ff ff ff 
+  806ed8:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806edc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806edf:	48 63 d2             	movslq %edx,%rdx
+  806ee2:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806ee9:	48 01 ca             	add    %rcx,%rdx
+  806eec:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806ef3:	8b 12                	mov    (%rdx),%edx
+  806ef5:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806ef8:	75 27                	jne    806f21 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806efa:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806f01:	ff ff ff 
+  806f04:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806f08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806f0b:	48 98                	cltq
+  806f0d:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806f14:	48 01 d0             	add    %rdx,%rax
+  806f17:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806f1d:	8b 00                	mov    (%rax),%eax
+  806f1f:	eb 12                	jmp    806f33 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806f21:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806f25:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806f2c:	7e a0                	jle    806ece <ipc_find_env+0x28>
+	}
+	return 0;
+  806f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806f33:	c9                   	leave
+  806f34:	c3                   	ret
+
+0000000000806f35 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806f35:	55                   	push   %rbp
+  806f36:	48 89 e5             	mov    %rsp,%rbp
+  806f39:	48 83 ec 18          	sub    $0x18,%rsp
+  806f3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806f3d <pageref+0x8>
+  806f44:	49 bb 03 21 00 00 00 	movabs $0x2103,%r11
+  806f4b:	00 00 00 
+  806f4e:	4c 01 d8             	add    %r11,%rax
+  806f51:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806f55:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806f59:	48 89 d1             	mov    %rdx,%rcx
+  806f5c:	48 c1 e9 15          	shr    $0x15,%rcx
+  806f60:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806f67:	ff ff ff 
+  806f6a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806f6e:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806f72:	83 e2 01             	and    $0x1,%edx
+  806f75:	48 85 d2             	test   %rdx,%rdx
+  806f78:	75 07                	jne    806f81 <pageref+0x4c>
+		return 0;
+  806f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f7f:	eb 64                	jmp    806fe5 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806f81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806f85:	48 89 d1             	mov    %rdx,%rcx
+  806f88:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806f8c:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806f93:	ff ff ff 
+  806f96:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806f9a:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806f9e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806fa2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806fa6:	83 e2 01             	and    $0x1,%edx
+  806fa9:	48 85 d2             	test   %rdx,%rdx
+  806fac:	75 07                	jne    806fb5 <pageref+0x80>
+		return 0;
+  806fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  806fb3:	eb 30                	jmp    806fe5 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806fb5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806fb9:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806fbd:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806fc4:	ff ff ff 
+  806fc7:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806fcb:	48 89 d0             	mov    %rdx,%rax
+  806fce:	48 01 c0             	add    %rax,%rax
+  806fd1:	48 01 d0             	add    %rdx,%rax
+  806fd4:	48 c1 e0 03          	shl    $0x3,%rax
+  806fd8:	48 01 c8             	add    %rcx,%rax
+  806fdb:	48 83 c0 08          	add    $0x8,%rax
+  806fdf:	0f b7 00             	movzwl (%rax),%eax
+  806fe2:	0f b7 c0             	movzwl %ax,%eax
+}
+  806fe5:	c9                   	leave
+  806fe6:	c3                   	ret
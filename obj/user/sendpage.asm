@@ -0,0 +1,10647 @@
+
+obj/user/sendpage:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 18 03 00 00       	call   800359 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#define TEMP_ADDR	((char*)0xa00000)
+#define TEMP_ADDR_CHILD	((char*)0xb00000)
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	envid_t who;
+
+	if ((who = fork()) == 0) {
+  800069:	49 89 df             	mov    %rbx,%r15
+  80006c:	48 b8 ae 9f ff ff ff 	movabs $0xffffffffffff9fae,%rax
+  800073:	ff ff ff 
+  800076:	48 01 d8             	add    %rbx,%rax
+  800079:	ff d0                	call   *%rax
+  80007b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80007e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800081:	85 c0                	test   %eax,%eax
+  800083:	0f 85 4b 01 00 00    	jne    8001d4 <umain+0x191>
+		// Child
+		ipc_recv(&who, TEMP_ADDR_CHILD, 0);
+  800089:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+  80008d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800092:	be 00 00 b0 00       	mov    $0xb00000,%esi
+  800097:	48 89 c7             	mov    %rax,%rdi
+  80009a:	49 89 df             	mov    %rbx,%r15
+  80009d:	48 b8 54 a3 ff ff ff 	movabs $0xffffffffffffa354,%rax
+  8000a4:	ff ff ff 
+  8000a7:	48 01 d8             	add    %rbx,%rax
+  8000aa:	ff d0                	call   *%rax
+		cprintf("%x got message : %s\n", who, TEMP_ADDR_CHILD);
+  8000ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000af:	ba 00 00 b0 00       	mov    $0xb00000,%edx
+  8000b4:	89 c6                	mov    %eax,%esi
+  8000b6:	48 b8 04 de ff ff ff 	movabs $0xffffffffffffde04,%rax
+  8000bd:	ff ff ff 
+  8000c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c4:	48 89 c7             	mov    %rax,%rdi
+  8000c7:	49 89 df             	mov    %rbx,%r15
+  8000ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cf:	48 b9 a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rcx
+  8000d6:	ff ff ff 
+  8000d9:	48 01 d9             	add    %rbx,%rcx
+  8000dc:	ff d1                	call   *%rcx
+		if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  8000de:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  8000e5:	00 00 00 
+  8000e8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8000ec:	48 89 c7             	mov    %rax,%rdi
+  8000ef:	49 89 df             	mov    %rbx,%r15
+  8000f2:	48 b8 cf 82 ff ff ff 	movabs $0xffffffffffff82cf,%rax
+  8000f9:	ff ff ff 
+  8000fc:	48 01 d8             	add    %rbx,%rax
+  8000ff:	ff d0                	call   *%rax
+  800101:	48 63 d0             	movslq %eax,%rdx
+  800104:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  80010b:	00 00 00 
+  80010e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800112:	48 89 c6             	mov    %rax,%rsi
+  800115:	bf 00 00 b0 00       	mov    $0xb00000,%edi
+  80011a:	49 89 df             	mov    %rbx,%r15
+  80011d:	48 b8 83 85 ff ff ff 	movabs $0xffffffffffff8583,%rax
+  800124:	ff ff ff 
+  800127:	48 01 d8             	add    %rbx,%rax
+  80012a:	ff d0                	call   *%rax
+  80012c:	85 c0                	test   %eax,%eax
+  80012e:	75 28                	jne    800158 <umain+0x115>
+			cprintf("child received correct message\n");
+  800130:	48 b8 20 de ff ff ff 	movabs $0xffffffffffffde20,%rax
+  800137:	ff ff ff 
+  80013a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80013e:	48 89 c7             	mov    %rax,%rdi
+  800141:	49 89 df             	mov    %rbx,%r15
+  800144:	b8 00 00 00 00       	mov    $0x0,%eax
+  800149:	48 ba a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rdx
+  800150:	ff ff ff 
+  800153:	48 01 da             	add    %rbx,%rdx
+  800156:	ff d2                	call   *%rdx
+
+		memcpy(TEMP_ADDR_CHILD, str2, strlen(str1) + 1);
+  800158:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  80015f:	00 00 00 
+  800162:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800166:	48 89 c7             	mov    %rax,%rdi
+  800169:	49 89 df             	mov    %rbx,%r15
+  80016c:	48 b8 cf 82 ff ff ff 	movabs $0xffffffffffff82cf,%rax
+  800173:	ff ff ff 
+  800176:	48 01 d8             	add    %rbx,%rax
+  800179:	ff d0                	call   *%rax
+  80017b:	83 c0 01             	add    $0x1,%eax
+  80017e:	48 63 d0             	movslq %eax,%rdx
+  800181:	48 b8 28 00 00 00 00 	movabs $0x28,%rax
+  800188:	00 00 00 
+  80018b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80018f:	48 89 c6             	mov    %rax,%rsi
+  800192:	bf 00 00 b0 00       	mov    $0xb00000,%edi
+  800197:	49 89 df             	mov    %rbx,%r15
+  80019a:	48 b8 6e 88 ff ff ff 	movabs $0xffffffffffff886e,%rax
+  8001a1:	ff ff ff 
+  8001a4:	48 01 d8             	add    %rbx,%rax
+  8001a7:	ff d0                	call   *%rax
+		ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+  8001a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001ac:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8001b1:	ba 00 00 b0 00       	mov    $0xb00000,%edx
+  8001b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bb:	89 c7                	mov    %eax,%edi
+  8001bd:	49 89 df             	mov    %rbx,%r15
+  8001c0:	48 b8 3d a4 ff ff ff 	movabs $0xffffffffffffa43d,%rax
+  8001c7:	ff ff ff 
+  8001ca:	48 01 d8             	add    %rbx,%rax
+  8001cd:	ff d0                	call   *%rax
+		return;
+  8001cf:	e9 7c 01 00 00       	jmp    800350 <umain+0x30d>
+	}
+
+	// Parent
+	sys_page_alloc(thisenv->env_id, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  8001d4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8001db:	ff ff ff 
+  8001de:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8001e2:	48 8b 00             	mov    (%rax),%rax
+  8001e5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8001eb:	ba 07 00 00 00       	mov    $0x7,%edx
+  8001f0:	be 00 00 a0 00       	mov    $0xa00000,%esi
+  8001f5:	89 c7                	mov    %eax,%edi
+  8001f7:	49 89 df             	mov    %rbx,%r15
+  8001fa:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  800201:	ff ff ff 
+  800204:	48 01 d8             	add    %rbx,%rax
+  800207:	ff d0                	call   *%rax
+	memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  800209:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  800210:	00 00 00 
+  800213:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800217:	48 89 c7             	mov    %rax,%rdi
+  80021a:	49 89 df             	mov    %rbx,%r15
+  80021d:	48 b8 cf 82 ff ff ff 	movabs $0xffffffffffff82cf,%rax
+  800224:	ff ff ff 
+  800227:	48 01 d8             	add    %rbx,%rax
+  80022a:	ff d0                	call   *%rax
+  80022c:	83 c0 01             	add    $0x1,%eax
+  80022f:	48 63 d0             	movslq %eax,%rdx
+  800232:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  800239:	00 00 00 
+  80023c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800240:	48 89 c6             	mov    %rax,%rsi
+  800243:	bf 00 00 a0 00       	mov    $0xa00000,%edi
+  800248:	49 89 df             	mov    %rbx,%r15
+  80024b:	48 b8 6e 88 ff ff ff 	movabs $0xffffffffffff886e,%rax
+  800252:	ff ff ff 
+  800255:	48 01 d8             	add    %rbx,%rax
+  800258:	ff d0                	call   *%rax
+	ipc_send(who, 0, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  80025a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80025d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  800262:	ba 00 00 a0 00       	mov    $0xa00000,%edx
+  800267:	be 00 00 00 00       	mov    $0x0,%esi
+  80026c:	89 c7                	mov    %eax,%edi
+  80026e:	49 89 df             	mov    %rbx,%r15
+  800271:	48 b8 3d a4 ff ff ff 	movabs $0xffffffffffffa43d,%rax
+  800278:	ff ff ff 
+  80027b:	48 01 d8             	add    %rbx,%rax
+  80027e:	ff d0                	call   *%rax
+	
+	ipc_recv(&who, TEMP_ADDR, 0);
+  800280:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+  800284:	ba 00 00 00 00       	mov    $0x0,%edx
+  800289:	be 00 00 a0 00       	mov    $0xa00000,%esi
+  80028e:	48 89 c7             	mov    %rax,%rdi
+  800291:	49 89 df             	mov    %rbx,%r15
+  800294:	48 b8 54 a3 ff ff ff 	movabs $0xffffffffffffa354,%rax
+  80029b:	ff ff ff 
+  80029e:	48 01 d8             	add    %rbx,%rax
+  8002a1:	ff d0                	call   *%rax
+	cprintf("%x got message : %s\n", who, TEMP_ADDR);
+  8002a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002a6:	ba 00 00 a0 00       	mov    $0xa00000,%edx
+  8002ab:	89 c6                	mov    %eax,%esi
+  8002ad:	48 b8 04 de ff ff ff 	movabs $0xffffffffffffde04,%rax
+  8002b4:	ff ff ff 
+  8002b7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002bb:	48 89 c7             	mov    %rax,%rdi
+  8002be:	49 89 df             	mov    %rbx,%r15
+  8002c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c6:	48 b9 a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rcx
+  8002cd:	ff ff ff 
+  8002d0:	48 01 d9             	add    %rbx,%rcx
+  8002d3:	ff d1                	call   *%rcx
+	if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  8002d5:	48 b8 28 00 00 00 00 	movabs $0x28,%rax
+  8002dc:	00 00 00 
+  8002df:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002e3:	48 89 c7             	mov    %rax,%rdi
+  8002e6:	49 89 df             	mov    %rbx,%r15
+  8002e9:	48 b8 cf 82 ff ff ff 	movabs $0xffffffffffff82cf,%rax
+  8002f0:	ff ff ff 
+  8002f3:	48 01 d8             	add    %rbx,%rax
+  8002f6:	ff d0                	call   *%rax
+  8002f8:	48 63 d0             	movslq %eax,%rdx
+  8002fb:	48 b8 28 00 00 00 00 	movabs $0x28,%rax
+  800302:	00 00 00 
+  800305:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800309:	48 89 c6             	mov    %rax,%rsi
+  80030c:	bf 00 00 a0 00       	mov    $0xa00000,%edi
+  800311:	49 89 df             	mov    %rbx,%r15
+  800314:	48 b8 83 85 ff ff ff 	movabs $0xffffffffffff8583,%rax
+  80031b:	ff ff ff 
+  80031e:	48 01 d8             	add    %rbx,%rax
+  800321:	ff d0                	call   *%rax
+  800323:	85 c0                	test   %eax,%eax
+  800325:	75 28                	jne    80034f <umain+0x30c>
+		cprintf("parent received correct message\n");
+  800327:	48 b8 40 de ff ff ff 	movabs $0xffffffffffffde40,%rax
+  80032e:	ff ff ff 
+  800331:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800335:	48 89 c7             	mov    %rax,%rdi
+  800338:	49 89 df             	mov    %rbx,%r15
+  80033b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800340:	48 ba a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rdx
+  800347:	ff ff ff 
+  80034a:	48 01 da             	add    %rbx,%rdx
+  80034d:	ff d2                	call   *%rdx
+	return;
+  80034f:	90                   	nop
+}
+  800350:	48 83 c4 20          	add    $0x20,%rsp
+  800354:	5b                   	pop    %rbx
+  800355:	41 5f                	pop    %r15
+  800357:	5d                   	pop    %rbp
+  800358:	c3                   	ret
+
+0000000000800359 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 57                	push   %r15
+  80035f:	53                   	push   %rbx
+  800360:	48 83 ec 20          	sub    $0x20,%rsp
+  800364:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800364 <libmain+0xb>
+  80036b:	49 bb dc 8c 00 00 00 	movabs $0x8cdc,%r11
+  800372:	00 00 00 
+  800375:	4c 01 db             	add    %r11,%rbx
+  800378:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80037b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80037f:	49 89 df             	mov    %rbx,%r15
+  800382:	48 b8 76 8f ff ff ff 	movabs $0xffffffffffff8f76,%rax
+  800389:	ff ff ff 
+  80038c:	48 01 d8             	add    %rbx,%rax
+  80038f:	ff d0                	call   *%rax
+  800391:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800394:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800397:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80039c:	48 98                	cltq
+  80039e:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8003a5:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8003ac:	ff ff ff 
+  8003af:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8003b3:	48 01 c2             	add    %rax,%rdx
+  8003b6:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8003bd:	00 00 00 
+  8003c0:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003c4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8003c8:	7e 15                	jle    8003df <libmain+0x86>
+		binaryname = argv[0];
+  8003ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8003ce:	48 8b 00             	mov    (%rax),%rax
+  8003d1:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  8003d8:	00 00 00 
+  8003db:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8003df:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8003e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8003e6:	48 89 d6             	mov    %rdx,%rsi
+  8003e9:	89 c7                	mov    %eax,%edi
+  8003eb:	49 89 df             	mov    %rbx,%r15
+  8003ee:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8003f5:	ff ff ff 
+  8003f8:	48 01 d8             	add    %rbx,%rax
+  8003fb:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8003fd:	49 89 df             	mov    %rbx,%r15
+  800400:	48 b8 d9 73 ff ff ff 	movabs $0xffffffffffff73d9,%rax
+  800407:	ff ff ff 
+  80040a:	48 01 d8             	add    %rbx,%rax
+  80040d:	ff d0                	call   *%rax
+}
+  80040f:	90                   	nop
+  800410:	48 83 c4 20          	add    $0x20,%rsp
+  800414:	5b                   	pop    %rbx
+  800415:	41 5f                	pop    %r15
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800419:	55                   	push   %rbp
+  80041a:	48 89 e5             	mov    %rsp,%rbp
+  80041d:	41 57                	push   %r15
+  80041f:	53                   	push   %rbx
+  800420:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800420 <exit+0x7>
+  800427:	49 bb 20 8c 00 00 00 	movabs $0x8c20,%r11
+  80042e:	00 00 00 
+  800431:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800434:	49 89 df             	mov    %rbx,%r15
+  800437:	48 b8 4b af ff ff ff 	movabs $0xffffffffffffaf4b,%rax
+  80043e:	ff ff ff 
+  800441:	48 01 d8             	add    %rbx,%rax
+  800444:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800446:	bf 00 00 00 00       	mov    $0x0,%edi
+  80044b:	49 89 df             	mov    %rbx,%r15
+  80044e:	48 b8 1a 8f ff ff ff 	movabs $0xffffffffffff8f1a,%rax
+  800455:	ff ff ff 
+  800458:	48 01 d8             	add    %rbx,%rax
+  80045b:	ff d0                	call   *%rax
+}
+  80045d:	90                   	nop
+  80045e:	5b                   	pop    %rbx
+  80045f:	41 5f                	pop    %r15
+  800461:	5d                   	pop    %rbp
+  800462:	c3                   	ret
+
+0000000000800463 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800463:	55                   	push   %rbp
+  800464:	48 89 e5             	mov    %rsp,%rbp
+  800467:	41 57                	push   %r15
+  800469:	48 83 ec 18          	sub    $0x18,%rsp
+  80046d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80046d <putch+0xa>
+  800474:	49 bb d3 8b 00 00 00 	movabs $0x8bd3,%r11
+  80047b:	00 00 00 
+  80047e:	4c 01 d8             	add    %r11,%rax
+  800481:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800484:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800488:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80048c:	8b 12                	mov    (%rdx),%edx
+  80048e:	8d 72 01             	lea    0x1(%rdx),%esi
+  800491:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800495:	89 31                	mov    %esi,(%rcx)
+  800497:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80049a:	89 ce                	mov    %ecx,%esi
+  80049c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8004a0:	48 63 d2             	movslq %edx,%rdx
+  8004a3:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8004a8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004ac:	8b 12                	mov    (%rdx),%edx
+  8004ae:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004b4:	75 33                	jne    8004e9 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8004b6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004ba:	8b 12                	mov    (%rdx),%edx
+  8004bc:	48 63 d2             	movslq %edx,%rdx
+  8004bf:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8004c3:	48 83 c1 08          	add    $0x8,%rcx
+  8004c7:	48 89 d6             	mov    %rdx,%rsi
+  8004ca:	48 89 cf             	mov    %rcx,%rdi
+  8004cd:	49 89 c7             	mov    %rax,%r15
+  8004d0:	48 ba 67 8e ff ff ff 	movabs $0xffffffffffff8e67,%rdx
+  8004d7:	ff ff ff 
+  8004da:	48 01 c2             	add    %rax,%rdx
+  8004dd:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8004df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004e3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8004e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004ed:	8b 40 04             	mov    0x4(%rax),%eax
+  8004f0:	8d 50 01             	lea    0x1(%rax),%edx
+  8004f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004f7:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8004fa:	90                   	nop
+  8004fb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8004ff:	c9                   	leave
+  800500:	c3                   	ret
+
+0000000000800501 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800501:	55                   	push   %rbp
+  800502:	48 89 e5             	mov    %rsp,%rbp
+  800505:	41 57                	push   %r15
+  800507:	53                   	push   %rbx
+  800508:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80050f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80050f <vcprintf+0xe>
+  800516:	49 bb 31 8b 00 00 00 	movabs $0x8b31,%r11
+  80051d:	00 00 00 
+  800520:	4c 01 db             	add    %r11,%rbx
+  800523:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80052a:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800531:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800538:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80053f:	48 8b 06             	mov    (%rsi),%rax
+  800542:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800546:	48 89 01             	mov    %rax,(%rcx)
+  800549:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80054d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800551:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800555:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  80055c:	00 00 00 
+    b.cnt = 0;
+  80055f:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800566:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800569:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800570:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800577:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80057e:	48 89 c6             	mov    %rax,%rsi
+  800581:	48 b8 23 74 ff ff ff 	movabs $0xffffffffffff7423,%rax
+  800588:	ff ff ff 
+  80058b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80058f:	48 89 c7             	mov    %rax,%rdi
+  800592:	49 89 df             	mov    %rbx,%r15
+  800595:	48 b8 e5 79 ff ff ff 	movabs $0xffffffffffff79e5,%rax
+  80059c:	ff ff ff 
+  80059f:	48 01 d8             	add    %rbx,%rax
+  8005a2:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8005a4:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8005aa:	48 98                	cltq
+  8005ac:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8005b3:	48 83 c2 08          	add    $0x8,%rdx
+  8005b7:	48 89 c6             	mov    %rax,%rsi
+  8005ba:	48 89 d7             	mov    %rdx,%rdi
+  8005bd:	49 89 df             	mov    %rbx,%r15
+  8005c0:	48 b8 67 8e ff ff ff 	movabs $0xffffffffffff8e67,%rax
+  8005c7:	ff ff ff 
+  8005ca:	48 01 d8             	add    %rbx,%rax
+  8005cd:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8005cf:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8005d5:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8005dc:	5b                   	pop    %rbx
+  8005dd:	41 5f                	pop    %r15
+  8005df:	5d                   	pop    %rbp
+  8005e0:	c3                   	ret
+
+00000000008005e1 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8005e1:	55                   	push   %rbp
+  8005e2:	48 89 e5             	mov    %rsp,%rbp
+  8005e5:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8005ec:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8005ec <cprintf+0xb>
+  8005f3:	49 bb 54 8a 00 00 00 	movabs $0x8a54,%r11
+  8005fa:	00 00 00 
+  8005fd:	4d 01 da             	add    %r11,%r10
+  800600:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800607:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80060e:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800615:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80061c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800623:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80062a:	84 c0                	test   %al,%al
+  80062c:	74 20                	je     80064e <cprintf+0x6d>
+  80062e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800632:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800636:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80063a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80063e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800642:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800646:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80064a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80064e:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800655:	00 00 00 
+  800658:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80065f:	00 00 00 
+  800662:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800666:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80066d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800674:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  80067b:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800682:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800689:	48 8b 06             	mov    (%rsi),%rax
+  80068c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800690:	48 89 01             	mov    %rax,(%rcx)
+  800693:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800697:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80069b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80069f:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8006a6:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8006ad:	48 89 d6             	mov    %rdx,%rsi
+  8006b0:	48 89 c7             	mov    %rax,%rdi
+  8006b3:	48 b8 c1 74 ff ff ff 	movabs $0xffffffffffff74c1,%rax
+  8006ba:	ff ff ff 
+  8006bd:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8006c1:	ff d0                	call   *%rax
+  8006c3:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8006c9:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8006cf:	c9                   	leave
+  8006d0:	c3                   	ret
+
+00000000008006d1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8006d1:	55                   	push   %rbp
+  8006d2:	48 89 e5             	mov    %rsp,%rbp
+  8006d5:	53                   	push   %rbx
+  8006d6:	48 83 ec 38          	sub    $0x38,%rsp
+  8006da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006da <printnum+0x9>
+  8006e1:	49 bb 66 89 00 00 00 	movabs $0x8966,%r11
+  8006e8:	00 00 00 
+  8006eb:	4c 01 db             	add    %r11,%rbx
+  8006ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8006f2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8006f6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8006fa:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8006fd:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800701:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800705:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800708:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80070c:	72 58                	jb     800766 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80070e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800711:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800714:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800717:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80071b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800720:	48 f7 f6             	div    %rsi
+  800723:	49 89 c2             	mov    %rax,%r10
+  800726:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800729:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80072c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800730:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800734:	41 89 c9             	mov    %ecx,%r9d
+  800737:	41 89 f8             	mov    %edi,%r8d
+  80073a:	89 d1                	mov    %edx,%ecx
+  80073c:	4c 89 d2             	mov    %r10,%rdx
+  80073f:	48 89 c7             	mov    %rax,%rdi
+  800742:	48 b8 91 76 ff ff ff 	movabs $0xffffffffffff7691,%rax
+  800749:	ff ff ff 
+  80074c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800750:	ff d0                	call   *%rax
+  800752:	eb 1c                	jmp    800770 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800754:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800758:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80075b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80075f:	48 89 d6             	mov    %rdx,%rsi
+  800762:	89 c7                	mov    %eax,%edi
+  800764:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800766:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  80076a:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80076e:	7f e4                	jg     800754 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800770:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800773:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800777:	ba 00 00 00 00       	mov    $0x0,%edx
+  80077c:	48 f7 f1             	div    %rcx
+  80077f:	48 b8 a7 df ff ff ff 	movabs $0xffffffffffffdfa7,%rax
+  800786:	ff ff ff 
+  800789:	48 01 d8             	add    %rbx,%rax
+  80078c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800790:	0f be c0             	movsbl %al,%eax
+  800793:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800797:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80079b:	48 89 d6             	mov    %rdx,%rsi
+  80079e:	89 c7                	mov    %eax,%edi
+  8007a0:	ff d1                	call   *%rcx
+}
+  8007a2:	90                   	nop
+  8007a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007a7:	c9                   	leave
+  8007a8:	c3                   	ret
+
+00000000008007a9 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8007a9:	55                   	push   %rbp
+  8007aa:	48 89 e5             	mov    %rsp,%rbp
+  8007ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8007b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8007b1 <getuint+0x8>
+  8007b8:	49 bb 8f 88 00 00 00 	movabs $0x888f,%r11
+  8007bf:	00 00 00 
+  8007c2:	4c 01 d8             	add    %r11,%rax
+  8007c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007c9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8007cc:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8007d0:	7e 4f                	jle    800821 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8007d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007d6:	8b 00                	mov    (%rax),%eax
+  8007d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007db:	77 24                	ja     800801 <getuint+0x58>
+  8007dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e9:	8b 00                	mov    (%rax),%eax
+  8007eb:	89 c0                	mov    %eax,%eax
+  8007ed:	48 01 d0             	add    %rdx,%rax
+  8007f0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007f4:	8b 12                	mov    (%rdx),%edx
+  8007f6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007fd:	89 0a                	mov    %ecx,(%rdx)
+  8007ff:	eb 14                	jmp    800815 <getuint+0x6c>
+  800801:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800805:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800809:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80080d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800811:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800815:	48 8b 00             	mov    (%rax),%rax
+  800818:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80081c:	e9 9d 00 00 00       	jmp    8008be <getuint+0x115>
+	else if (lflag)
+  800821:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800825:	74 4c                	je     800873 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800827:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80082b:	8b 00                	mov    (%rax),%eax
+  80082d:	83 f8 2f             	cmp    $0x2f,%eax
+  800830:	77 24                	ja     800856 <getuint+0xad>
+  800832:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800836:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80083a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80083e:	8b 00                	mov    (%rax),%eax
+  800840:	89 c0                	mov    %eax,%eax
+  800842:	48 01 d0             	add    %rdx,%rax
+  800845:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800849:	8b 12                	mov    (%rdx),%edx
+  80084b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80084e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800852:	89 0a                	mov    %ecx,(%rdx)
+  800854:	eb 14                	jmp    80086a <getuint+0xc1>
+  800856:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80085a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80085e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800862:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800866:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80086a:	48 8b 00             	mov    (%rax),%rax
+  80086d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800871:	eb 4b                	jmp    8008be <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800873:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800877:	8b 00                	mov    (%rax),%eax
+  800879:	83 f8 2f             	cmp    $0x2f,%eax
+  80087c:	77 24                	ja     8008a2 <getuint+0xf9>
+  80087e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800882:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800886:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80088a:	8b 00                	mov    (%rax),%eax
+  80088c:	89 c0                	mov    %eax,%eax
+  80088e:	48 01 d0             	add    %rdx,%rax
+  800891:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800895:	8b 12                	mov    (%rdx),%edx
+  800897:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80089a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80089e:	89 0a                	mov    %ecx,(%rdx)
+  8008a0:	eb 14                	jmp    8008b6 <getuint+0x10d>
+  8008a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008a6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008aa:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008ae:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008b2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008b6:	8b 00                	mov    (%rax),%eax
+  8008b8:	89 c0                	mov    %eax,%eax
+  8008ba:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8008be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8008c2:	c9                   	leave
+  8008c3:	c3                   	ret
+
+00000000008008c4 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  8008c4:	55                   	push   %rbp
+  8008c5:	48 89 e5             	mov    %rsp,%rbp
+  8008c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8008cc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008cc <printfloat+0x8>
+  8008d3:	49 bb 74 87 00 00 00 	movabs $0x8774,%r11
+  8008da:	00 00 00 
+  8008dd:	4c 01 d8             	add    %r11,%rax
+  8008e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008e4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008e8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8008ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008f0:	48 85 c0             	test   %rax,%rax
+  8008f3:	79 12                	jns    800907 <printfloat+0x43>
+		putch('-',putdat);
+  8008f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8008f9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008fd:	48 89 c6             	mov    %rax,%rsi
+  800900:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800905:	ff d2                	call   *%rdx
+	
+}
+  800907:	90                   	nop
+  800908:	c9                   	leave
+  800909:	c3                   	ret
+
+000000000080090a <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  80090a:	55                   	push   %rbp
+  80090b:	48 89 e5             	mov    %rsp,%rbp
+  80090e:	48 83 ec 20          	sub    $0x20,%rsp
+  800912:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800912 <getint+0x8>
+  800919:	49 bb 2e 87 00 00 00 	movabs $0x872e,%r11
+  800920:	00 00 00 
+  800923:	4c 01 d8             	add    %r11,%rax
+  800926:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80092a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80092d:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800931:	7e 4f                	jle    800982 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800933:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800937:	8b 00                	mov    (%rax),%eax
+  800939:	83 f8 2f             	cmp    $0x2f,%eax
+  80093c:	77 24                	ja     800962 <getint+0x58>
+  80093e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800942:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800946:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80094a:	8b 00                	mov    (%rax),%eax
+  80094c:	89 c0                	mov    %eax,%eax
+  80094e:	48 01 d0             	add    %rdx,%rax
+  800951:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800955:	8b 12                	mov    (%rdx),%edx
+  800957:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80095a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80095e:	89 0a                	mov    %ecx,(%rdx)
+  800960:	eb 14                	jmp    800976 <getint+0x6c>
+  800962:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800966:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80096a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80096e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800972:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800976:	48 8b 00             	mov    (%rax),%rax
+  800979:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80097d:	e9 9d 00 00 00       	jmp    800a1f <getint+0x115>
+	else if (lflag)
+  800982:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800986:	74 4c                	je     8009d4 <getint+0xca>
+		x=va_arg(*ap, long);
+  800988:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80098c:	8b 00                	mov    (%rax),%eax
+  80098e:	83 f8 2f             	cmp    $0x2f,%eax
+  800991:	77 24                	ja     8009b7 <getint+0xad>
+  800993:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800997:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80099b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80099f:	8b 00                	mov    (%rax),%eax
+  8009a1:	89 c0                	mov    %eax,%eax
+  8009a3:	48 01 d0             	add    %rdx,%rax
+  8009a6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009aa:	8b 12                	mov    (%rdx),%edx
+  8009ac:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009af:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009b3:	89 0a                	mov    %ecx,(%rdx)
+  8009b5:	eb 14                	jmp    8009cb <getint+0xc1>
+  8009b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009bb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009bf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009c3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009c7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009cb:	48 8b 00             	mov    (%rax),%rax
+  8009ce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009d2:	eb 4b                	jmp    800a1f <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8009d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009d8:	8b 00                	mov    (%rax),%eax
+  8009da:	83 f8 2f             	cmp    $0x2f,%eax
+  8009dd:	77 24                	ja     800a03 <getint+0xf9>
+  8009df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009eb:	8b 00                	mov    (%rax),%eax
+  8009ed:	89 c0                	mov    %eax,%eax
+  8009ef:	48 01 d0             	add    %rdx,%rax
+  8009f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009f6:	8b 12                	mov    (%rdx),%edx
+  8009f8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009fb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009ff:	89 0a                	mov    %ecx,(%rdx)
+  800a01:	eb 14                	jmp    800a17 <getint+0x10d>
+  800a03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a07:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a0b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a0f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a13:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a17:	8b 00                	mov    (%rax),%eax
+  800a19:	48 98                	cltq
+  800a1b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a23:	c9                   	leave
+  800a24:	c3                   	ret
+
+0000000000800a25 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800a25:	55                   	push   %rbp
+  800a26:	48 89 e5             	mov    %rsp,%rbp
+  800a29:	41 57                	push   %r15
+  800a2b:	41 55                	push   %r13
+  800a2d:	41 54                	push   %r12
+  800a2f:	53                   	push   %rbx
+  800a30:	48 83 ec 60          	sub    $0x60,%rsp
+  800a34:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800a34 <vprintfmt+0xf>
+  800a3b:	49 bb 0c 86 00 00 00 	movabs $0x860c,%r11
+  800a42:	00 00 00 
+  800a45:	4d 01 dc             	add    %r11,%r12
+  800a48:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800a4c:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800a50:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800a54:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800a58:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800a5f:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800a63:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800a67:	48 8b 06             	mov    (%rsi),%rax
+  800a6a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a6e:	48 89 01             	mov    %rax,(%rcx)
+  800a71:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a75:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a79:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a7d:	eb 17                	jmp    800a96 <vprintfmt+0x71>
+			if (ch == '\0')
+  800a7f:	85 db                	test   %ebx,%ebx
+  800a81:	0f 84 97 05 00 00    	je     80101e <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800a87:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800a8b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800a8f:	48 89 c6             	mov    %rax,%rsi
+  800a92:	89 df                	mov    %ebx,%edi
+  800a94:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a96:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800a9a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a9e:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800aa2:	0f b6 00             	movzbl (%rax),%eax
+  800aa5:	0f b6 d8             	movzbl %al,%ebx
+  800aa8:	83 fb 25             	cmp    $0x25,%ebx
+  800aab:	75 d2                	jne    800a7f <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800aad:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800ab1:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800ab8:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800abf:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800ac6:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800acd:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ad1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ad5:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800ad9:	0f b6 00             	movzbl (%rax),%eax
+  800adc:	0f b6 d8             	movzbl %al,%ebx
+  800adf:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800ae2:	83 f8 55             	cmp    $0x55,%eax
+  800ae5:	0f 87 00 05 00 00    	ja     800feb <vprintfmt+0x5c6>
+  800aeb:	89 c0                	mov    %eax,%eax
+  800aed:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800af4:	00 
+  800af5:	48 8d 05 14 65 00 00 	lea    0x6514(%rip),%rax        # 807010 <.LC18+0xc>
+  800afc:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800b00:	48 8d 15 09 65 00 00 	lea    0x6509(%rip),%rdx        # 807010 <.LC18+0xc>
+  800b07:	48 01 d0             	add    %rdx,%rax
+  800b0a:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800b0c:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800b10:	eb bb                	jmp    800acd <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800b12:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800b16:	eb b5                	jmp    800acd <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800b18:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800b1f:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800b22:	89 d0                	mov    %edx,%eax
+  800b24:	c1 e0 02             	shl    $0x2,%eax
+  800b27:	01 d0                	add    %edx,%eax
+  800b29:	01 c0                	add    %eax,%eax
+  800b2b:	01 d8                	add    %ebx,%eax
+  800b2d:	83 e8 30             	sub    $0x30,%eax
+  800b30:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800b33:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b37:	0f b6 00             	movzbl (%rax),%eax
+  800b3a:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800b3d:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b40:	7e 60                	jle    800ba2 <vprintfmt+0x17d>
+  800b42:	83 fb 39             	cmp    $0x39,%ebx
+  800b45:	7f 5b                	jg     800ba2 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800b47:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800b4c:	eb d1                	jmp    800b1f <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800b4e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b51:	83 f8 2f             	cmp    $0x2f,%eax
+  800b54:	77 17                	ja     800b6d <vprintfmt+0x148>
+  800b56:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b5a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b5d:	89 d2                	mov    %edx,%edx
+  800b5f:	48 01 d0             	add    %rdx,%rax
+  800b62:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b65:	83 c2 08             	add    $0x8,%edx
+  800b68:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b6b:	eb 0c                	jmp    800b79 <vprintfmt+0x154>
+  800b6d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b71:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b75:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b79:	8b 00                	mov    (%rax),%eax
+  800b7b:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800b7e:	eb 23                	jmp    800ba3 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800b80:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b84:	0f 89 43 ff ff ff    	jns    800acd <vprintfmt+0xa8>
+				width = 0;
+  800b8a:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800b91:	e9 37 ff ff ff       	jmp    800acd <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800b96:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800b9d:	e9 2b ff ff ff       	jmp    800acd <vprintfmt+0xa8>
+			goto process_precision;
+  800ba2:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800ba3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ba7:	0f 89 20 ff ff ff    	jns    800acd <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800bad:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800bb0:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800bb3:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800bba:	e9 0e ff ff ff       	jmp    800acd <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800bbf:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800bc3:	e9 05 ff ff ff       	jmp    800acd <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800bc8:	83 fb 39             	cmp    $0x39,%ebx
+  800bcb:	7f 0b                	jg     800bd8 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800bcd:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800bd0:	c1 e0 08             	shl    $0x8,%eax
+  800bd3:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800bd6:	eb 21                	jmp    800bf9 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800bd8:	83 fb 60             	cmp    $0x60,%ebx
+  800bdb:	7e 10                	jle    800bed <vprintfmt+0x1c8>
+  800bdd:	83 fb 66             	cmp    $0x66,%ebx
+  800be0:	7f 0b                	jg     800bed <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800be2:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800be5:	c1 e0 08             	shl    $0x8,%eax
+  800be8:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800beb:	eb 0c                	jmp    800bf9 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800bed:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800bf4:	e9 04 01 00 00       	jmp    800cfd <vprintfmt+0x2d8>
+  800bf9:	e9 ff 00 00 00       	jmp    800cfd <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800bfe:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c01:	83 f8 2f             	cmp    $0x2f,%eax
+  800c04:	77 17                	ja     800c1d <vprintfmt+0x1f8>
+  800c06:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c0a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c0d:	89 d2                	mov    %edx,%edx
+  800c0f:	48 01 d0             	add    %rdx,%rax
+  800c12:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c15:	83 c2 08             	add    $0x8,%edx
+  800c18:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c1b:	eb 0c                	jmp    800c29 <vprintfmt+0x204>
+  800c1d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c21:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c25:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c29:	8b 00                	mov    (%rax),%eax
+  800c2b:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c2f:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c33:	48 89 d6             	mov    %rdx,%rsi
+  800c36:	89 c7                	mov    %eax,%edi
+  800c38:	ff d1                	call   *%rcx
+			break;
+  800c3a:	e9 da 03 00 00       	jmp    801019 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800c3f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c42:	83 f8 2f             	cmp    $0x2f,%eax
+  800c45:	77 17                	ja     800c5e <vprintfmt+0x239>
+  800c47:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c4b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c4e:	89 d2                	mov    %edx,%edx
+  800c50:	48 01 d0             	add    %rdx,%rax
+  800c53:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c56:	83 c2 08             	add    $0x8,%edx
+  800c59:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c5c:	eb 0c                	jmp    800c6a <vprintfmt+0x245>
+  800c5e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c62:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c66:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c6a:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800c6c:	85 db                	test   %ebx,%ebx
+  800c6e:	79 02                	jns    800c72 <vprintfmt+0x24d>
+				err = -err;
+  800c70:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800c72:	83 fb 15             	cmp    $0x15,%ebx
+  800c75:	7f 19                	jg     800c90 <vprintfmt+0x26b>
+  800c77:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800c7e:	00 00 00 
+  800c81:	48 63 c3             	movslq %ebx,%rax
+  800c84:	4c 01 e2             	add    %r12,%rdx
+  800c87:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800c8b:	4d 85 ed             	test   %r13,%r13
+  800c8e:	75 36                	jne    800cc6 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800c90:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800c94:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c98:	89 d9                	mov    %ebx,%ecx
+  800c9a:	48 ba b8 df ff ff ff 	movabs $0xffffffffffffdfb8,%rdx
+  800ca1:	ff ff ff 
+  800ca4:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800ca8:	48 89 c7             	mov    %rax,%rdi
+  800cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb0:	49 b8 ec 7f ff ff ff 	movabs $0xffffffffffff7fec,%r8
+  800cb7:	ff ff ff 
+  800cba:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800cbe:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800cc1:	e9 53 03 00 00       	jmp    801019 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800cc6:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800cca:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cce:	4c 89 e9             	mov    %r13,%rcx
+  800cd1:	48 ba c1 df ff ff ff 	movabs $0xffffffffffffdfc1,%rdx
+  800cd8:	ff ff ff 
+  800cdb:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800cdf:	48 89 c7             	mov    %rax,%rdi
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	49 b8 ec 7f ff ff ff 	movabs $0xffffffffffff7fec,%r8
+  800cee:	ff ff ff 
+  800cf1:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800cf5:	41 ff d0             	call   *%r8
+			break;
+  800cf8:	e9 1c 03 00 00       	jmp    801019 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800cfd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d00:	83 f8 2f             	cmp    $0x2f,%eax
+  800d03:	77 17                	ja     800d1c <vprintfmt+0x2f7>
+  800d05:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d09:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d0c:	89 d2                	mov    %edx,%edx
+  800d0e:	48 01 d0             	add    %rdx,%rax
+  800d11:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d14:	83 c2 08             	add    $0x8,%edx
+  800d17:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d1a:	eb 0c                	jmp    800d28 <vprintfmt+0x303>
+  800d1c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d20:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d24:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d28:	4c 8b 28             	mov    (%rax),%r13
+  800d2b:	4d 85 ed             	test   %r13,%r13
+  800d2e:	75 0e                	jne    800d3e <vprintfmt+0x319>
+				p = "(null)";
+  800d30:	48 b8 c4 df ff ff ff 	movabs $0xffffffffffffdfc4,%rax
+  800d37:	ff ff ff 
+  800d3a:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800d3e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d42:	0f 8e 84 00 00 00    	jle    800dcc <vprintfmt+0x3a7>
+  800d48:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800d4c:	74 7e                	je     800dcc <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d4e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d51:	48 98                	cltq
+  800d53:	48 89 c6             	mov    %rax,%rsi
+  800d56:	4c 89 ef             	mov    %r13,%rdi
+  800d59:	4d 89 e7             	mov    %r12,%r15
+  800d5c:	48 b8 11 83 ff ff ff 	movabs $0xffffffffffff8311,%rax
+  800d63:	ff ff ff 
+  800d66:	4c 01 e0             	add    %r12,%rax
+  800d69:	ff d0                	call   *%rax
+  800d6b:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800d6e:	eb 17                	jmp    800d87 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800d70:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800d74:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800d78:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800d7c:	48 89 d6             	mov    %rdx,%rsi
+  800d7f:	89 c7                	mov    %eax,%edi
+  800d81:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d83:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800d87:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d8b:	7f e3                	jg     800d70 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d8d:	eb 3d                	jmp    800dcc <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800d8f:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800d93:	74 1e                	je     800db3 <vprintfmt+0x38e>
+  800d95:	83 fb 1f             	cmp    $0x1f,%ebx
+  800d98:	7e 05                	jle    800d9f <vprintfmt+0x37a>
+  800d9a:	83 fb 7e             	cmp    $0x7e,%ebx
+  800d9d:	7e 14                	jle    800db3 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800d9f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800da3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800da7:	48 89 c6             	mov    %rax,%rsi
+  800daa:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800daf:	ff d2                	call   *%rdx
+  800db1:	eb 15                	jmp    800dc8 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800db3:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800db6:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800db9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dbd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dc1:	48 89 c6             	mov    %rax,%rsi
+  800dc4:	89 cf                	mov    %ecx,%edi
+  800dc6:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800dc8:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800dcc:	4c 89 e8             	mov    %r13,%rax
+  800dcf:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800dd3:	0f b6 00             	movzbl (%rax),%eax
+  800dd6:	0f be d8             	movsbl %al,%ebx
+  800dd9:	85 db                	test   %ebx,%ebx
+  800ddb:	74 28                	je     800e05 <vprintfmt+0x3e0>
+  800ddd:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800de1:	78 ac                	js     800d8f <vprintfmt+0x36a>
+  800de3:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800de7:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800deb:	79 a2                	jns    800d8f <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800ded:	eb 16                	jmp    800e05 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800def:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800df3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800df7:	48 89 c6             	mov    %rax,%rsi
+  800dfa:	bf 20 00 00 00       	mov    $0x20,%edi
+  800dff:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800e01:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800e05:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e09:	7f e4                	jg     800def <vprintfmt+0x3ca>
+			break;
+  800e0b:	e9 09 02 00 00       	jmp    801019 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800e10:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e14:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800e18:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800e1c:	0f b6 00             	movzbl (%rax),%eax
+  800e1f:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800e22:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800e23:	83 fb 2f             	cmp    $0x2f,%ebx
+  800e26:	0f 8e ac fd ff ff    	jle    800bd8 <vprintfmt+0x1b3>
+  800e2c:	e9 97 fd ff ff       	jmp    800bc8 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800e31:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e35:	be 03 00 00 00       	mov    $0x3,%esi
+  800e3a:	48 89 c7             	mov    %rax,%rdi
+  800e3d:	48 b8 ca 78 ff ff ff 	movabs $0xffffffffffff78ca,%rax
+  800e44:	ff ff ff 
+  800e47:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e4b:	ff d0                	call   *%rax
+  800e4d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800e51:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e55:	48 85 c0             	test   %rax,%rax
+  800e58:	79 1d                	jns    800e77 <vprintfmt+0x452>
+				putch('-', putdat);
+  800e5a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e5e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e62:	48 89 c6             	mov    %rax,%rsi
+  800e65:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e6a:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800e6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e70:	48 f7 d8             	neg    %rax
+  800e73:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800e77:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800e7e:	e9 de 00 00 00       	jmp    800f61 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800e83:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e87:	be 03 00 00 00       	mov    $0x3,%esi
+  800e8c:	48 89 c7             	mov    %rax,%rdi
+  800e8f:	48 b8 69 77 ff ff ff 	movabs $0xffffffffffff7769,%rax
+  800e96:	ff ff ff 
+  800e99:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e9d:	ff d0                	call   *%rax
+  800e9f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800ea3:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800eaa:	e9 b2 00 00 00       	jmp    800f61 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800eaf:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800eb3:	be 03 00 00 00       	mov    $0x3,%esi
+  800eb8:	48 89 c7             	mov    %rax,%rdi
+  800ebb:	48 b8 69 77 ff ff ff 	movabs $0xffffffffffff7769,%rax
+  800ec2:	ff ff ff 
+  800ec5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ec9:	ff d0                	call   *%rax
+  800ecb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800ecf:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800ed6:	e9 86 00 00 00       	jmp    800f61 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800edb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800edf:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ee3:	48 89 c6             	mov    %rax,%rsi
+  800ee6:	bf 30 00 00 00       	mov    $0x30,%edi
+  800eeb:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800eed:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ef1:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ef5:	48 89 c6             	mov    %rax,%rsi
+  800ef8:	bf 78 00 00 00       	mov    $0x78,%edi
+  800efd:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800eff:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f02:	83 f8 2f             	cmp    $0x2f,%eax
+  800f05:	77 17                	ja     800f1e <vprintfmt+0x4f9>
+  800f07:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f0b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f0e:	89 d2                	mov    %edx,%edx
+  800f10:	48 01 d0             	add    %rdx,%rax
+  800f13:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f16:	83 c2 08             	add    $0x8,%edx
+  800f19:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f1c:	eb 0c                	jmp    800f2a <vprintfmt+0x505>
+  800f1e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f22:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f26:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f2a:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800f2d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f31:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800f38:	eb 27                	jmp    800f61 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800f3a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f3e:	be 03 00 00 00       	mov    $0x3,%esi
+  800f43:	48 89 c7             	mov    %rax,%rdi
+  800f46:	48 b8 69 77 ff ff ff 	movabs $0xffffffffffff7769,%rax
+  800f4d:	ff ff ff 
+  800f50:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f54:	ff d0                	call   *%rax
+  800f56:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f5a:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800f61:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800f66:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800f69:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800f6c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800f70:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f74:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f78:	45 89 c1             	mov    %r8d,%r9d
+  800f7b:	41 89 f8             	mov    %edi,%r8d
+  800f7e:	48 89 c7             	mov    %rax,%rdi
+  800f81:	48 b8 91 76 ff ff ff 	movabs $0xffffffffffff7691,%rax
+  800f88:	ff ff ff 
+  800f8b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f8f:	ff d0                	call   *%rax
+			break;
+  800f91:	e9 83 00 00 00       	jmp    801019 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800f96:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f9a:	be 03 00 00 00       	mov    $0x3,%esi
+  800f9f:	48 89 c7             	mov    %rax,%rdi
+  800fa2:	48 b8 69 77 ff ff ff 	movabs $0xffffffffffff7769,%rax
+  800fa9:	ff ff ff 
+  800fac:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fb0:	ff d0                	call   *%rax
+  800fb2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800fb6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800fba:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800fbe:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fc2:	48 89 ce             	mov    %rcx,%rsi
+  800fc5:	48 89 c7             	mov    %rax,%rdi
+  800fc8:	48 b8 84 78 ff ff ff 	movabs $0xffffffffffff7884,%rax
+  800fcf:	ff ff ff 
+  800fd2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fd6:	ff d0                	call   *%rax
+	
+			break;
+  800fd8:	eb 3f                	jmp    801019 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800fda:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fde:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fe2:	48 89 c6             	mov    %rax,%rsi
+  800fe5:	89 df                	mov    %ebx,%edi
+  800fe7:	ff d2                	call   *%rdx
+			break;
+  800fe9:	eb 2e                	jmp    801019 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800feb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fef:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ff3:	48 89 c6             	mov    %rax,%rsi
+  800ff6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ffb:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800ffd:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801002:	eb 05                	jmp    801009 <vprintfmt+0x5e4>
+  801004:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801009:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80100d:	48 83 e8 01          	sub    $0x1,%rax
+  801011:	0f b6 00             	movzbl (%rax),%eax
+  801014:	3c 25                	cmp    $0x25,%al
+  801016:	75 ec                	jne    801004 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801018:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801019:	e9 78 fa ff ff       	jmp    800a96 <vprintfmt+0x71>
+				return;
+  80101e:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80101f:	48 83 c4 60          	add    $0x60,%rsp
+  801023:	5b                   	pop    %rbx
+  801024:	41 5c                	pop    %r12
+  801026:	41 5d                	pop    %r13
+  801028:	41 5f                	pop    %r15
+  80102a:	5d                   	pop    %rbp
+  80102b:	c3                   	ret
+
+000000000080102c <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80102c:	55                   	push   %rbp
+  80102d:	48 89 e5             	mov    %rsp,%rbp
+  801030:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801037:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801037 <printfmt+0xb>
+  80103e:	49 bb 09 80 00 00 00 	movabs $0x8009,%r11
+  801045:	00 00 00 
+  801048:	4d 01 da             	add    %r11,%r10
+  80104b:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801052:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801059:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801060:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801067:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80106e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801075:	84 c0                	test   %al,%al
+  801077:	74 20                	je     801099 <printfmt+0x6d>
+  801079:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80107d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801081:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801085:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801089:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80108d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801091:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801095:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801099:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8010a0:	00 00 00 
+  8010a3:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8010aa:	00 00 00 
+  8010ad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010b1:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8010b8:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010bf:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8010c6:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8010cd:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8010d4:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8010db:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8010e2:	48 89 c7             	mov    %rax,%rdi
+  8010e5:	48 b8 e5 79 ff ff ff 	movabs $0xffffffffffff79e5,%rax
+  8010ec:	ff ff ff 
+  8010ef:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8010f3:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8010f5:	90                   	nop
+  8010f6:	c9                   	leave
+  8010f7:	c3                   	ret
+
+00000000008010f8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8010f8:	55                   	push   %rbp
+  8010f9:	48 89 e5             	mov    %rsp,%rbp
+  8010fc:	48 83 ec 10          	sub    $0x10,%rsp
+  801100:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801100 <sprintputch+0x8>
+  801107:	49 bb 40 7f 00 00 00 	movabs $0x7f40,%r11
+  80110e:	00 00 00 
+  801111:	4c 01 d8             	add    %r11,%rax
+  801114:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801117:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80111b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80111f:	8b 40 10             	mov    0x10(%rax),%eax
+  801122:	8d 50 01             	lea    0x1(%rax),%edx
+  801125:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801129:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80112c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801130:	48 8b 10             	mov    (%rax),%rdx
+  801133:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801137:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80113b:	48 39 c2             	cmp    %rax,%rdx
+  80113e:	73 17                	jae    801157 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801140:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801144:	48 8b 00             	mov    (%rax),%rax
+  801147:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80114b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80114f:	48 89 0a             	mov    %rcx,(%rdx)
+  801152:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801155:	88 10                	mov    %dl,(%rax)
+}
+  801157:	90                   	nop
+  801158:	c9                   	leave
+  801159:	c3                   	ret
+
+000000000080115a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80115a:	55                   	push   %rbp
+  80115b:	48 89 e5             	mov    %rsp,%rbp
+  80115e:	53                   	push   %rbx
+  80115f:	48 83 ec 58          	sub    $0x58,%rsp
+  801163:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801163 <vsnprintf+0x9>
+  80116a:	49 bb dd 7e 00 00 00 	movabs $0x7edd,%r11
+  801171:	00 00 00 
+  801174:	4c 01 d8             	add    %r11,%rax
+  801177:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80117b:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80117e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801182:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801186:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80118a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80118e:	48 8b 0e             	mov    (%rsi),%rcx
+  801191:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801195:	48 89 0a             	mov    %rcx,(%rdx)
+  801198:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80119c:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8011a0:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8011a4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8011a8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8011ac:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8011af:	48 63 d2             	movslq %edx,%rdx
+  8011b2:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8011b6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8011ba:	48 01 ca             	add    %rcx,%rdx
+  8011bd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8011c1:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8011c8:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8011cd:	74 06                	je     8011d5 <vsnprintf+0x7b>
+  8011cf:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8011d3:	7f 07                	jg     8011dc <vsnprintf+0x82>
+		return -E_INVAL;
+  8011d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011da:	eb 34                	jmp    801210 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8011dc:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8011e0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8011e4:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8011e8:	48 bf b8 80 ff ff ff 	movabs $0xffffffffffff80b8,%rdi
+  8011ef:	ff ff ff 
+  8011f2:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8011f6:	49 b8 e5 79 ff ff ff 	movabs $0xffffffffffff79e5,%r8
+  8011fd:	ff ff ff 
+  801200:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801204:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801206:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80120a:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80120d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801210:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801214:	c9                   	leave
+  801215:	c3                   	ret
+
+0000000000801216 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801216:	55                   	push   %rbp
+  801217:	48 89 e5             	mov    %rsp,%rbp
+  80121a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801221:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801221 <snprintf+0xb>
+  801228:	49 bb 1f 7e 00 00 00 	movabs $0x7e1f,%r11
+  80122f:	00 00 00 
+  801232:	4d 01 da             	add    %r11,%r10
+  801235:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80123c:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801242:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801249:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801250:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801257:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80125e:	84 c0                	test   %al,%al
+  801260:	74 20                	je     801282 <snprintf+0x6c>
+  801262:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801266:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80126a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80126e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801272:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801276:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80127a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80127e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801282:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801289:	00 00 00 
+  80128c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801293:	00 00 00 
+  801296:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80129a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8012a1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8012a8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8012af:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8012b6:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8012bd:	48 8b 06             	mov    (%rsi),%rax
+  8012c0:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8012c4:	48 89 01             	mov    %rax,(%rcx)
+  8012c7:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8012cb:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8012cf:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8012d3:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8012da:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8012e1:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8012e7:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8012ee:	48 89 c7             	mov    %rax,%rdi
+  8012f1:	48 b8 1a 81 ff ff ff 	movabs $0xffffffffffff811a,%rax
+  8012f8:	ff ff ff 
+  8012fb:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8012ff:	ff d0                	call   *%rax
+  801301:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801307:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+000000000080130f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+  801313:	48 83 ec 18          	sub    $0x18,%rsp
+  801317:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801317 <strlen+0x8>
+  80131e:	49 bb 29 7d 00 00 00 	movabs $0x7d29,%r11
+  801325:	00 00 00 
+  801328:	4c 01 d8             	add    %r11,%rax
+  80132b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80132f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801336:	eb 09                	jmp    801341 <strlen+0x32>
+		n++;
+  801338:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  80133c:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801341:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801345:	0f b6 00             	movzbl (%rax),%eax
+  801348:	84 c0                	test   %al,%al
+  80134a:	75 ec                	jne    801338 <strlen+0x29>
+	return n;
+  80134c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80134f:	c9                   	leave
+  801350:	c3                   	ret
+
+0000000000801351 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801351:	55                   	push   %rbp
+  801352:	48 89 e5             	mov    %rsp,%rbp
+  801355:	48 83 ec 20          	sub    $0x20,%rsp
+  801359:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801359 <strnlen+0x8>
+  801360:	49 bb e7 7c 00 00 00 	movabs $0x7ce7,%r11
+  801367:	00 00 00 
+  80136a:	4c 01 d8             	add    %r11,%rax
+  80136d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801371:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801375:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80137c:	eb 0e                	jmp    80138c <strnlen+0x3b>
+		n++;
+  80137e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801382:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801387:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80138c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801391:	74 0b                	je     80139e <strnlen+0x4d>
+  801393:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801397:	0f b6 00             	movzbl (%rax),%eax
+  80139a:	84 c0                	test   %al,%al
+  80139c:	75 e0                	jne    80137e <strnlen+0x2d>
+	return n;
+  80139e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8013a1:	c9                   	leave
+  8013a2:	c3                   	ret
+
+00000000008013a3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8013a3:	55                   	push   %rbp
+  8013a4:	48 89 e5             	mov    %rsp,%rbp
+  8013a7:	48 83 ec 20          	sub    $0x20,%rsp
+  8013ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013ab <strcpy+0x8>
+  8013b2:	49 bb 95 7c 00 00 00 	movabs $0x7c95,%r11
+  8013b9:	00 00 00 
+  8013bc:	4c 01 d8             	add    %r11,%rax
+  8013bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8013c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013cb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8013cf:	90                   	nop
+  8013d0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013d4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013d8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013e8:	0f b6 12             	movzbl (%rdx),%edx
+  8013eb:	88 10                	mov    %dl,(%rax)
+  8013ed:	0f b6 00             	movzbl (%rax),%eax
+  8013f0:	84 c0                	test   %al,%al
+  8013f2:	75 dc                	jne    8013d0 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8013f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8013f8:	c9                   	leave
+  8013f9:	c3                   	ret
+
+00000000008013fa <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8013fa:	55                   	push   %rbp
+  8013fb:	48 89 e5             	mov    %rsp,%rbp
+  8013fe:	53                   	push   %rbx
+  8013ff:	48 83 ec 20          	sub    $0x20,%rsp
+  801403:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801403 <strcat+0x9>
+  80140a:	49 bb 3d 7c 00 00 00 	movabs $0x7c3d,%r11
+  801411:	00 00 00 
+  801414:	4c 01 db             	add    %r11,%rbx
+  801417:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80141b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80141f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801423:	48 89 c7             	mov    %rax,%rdi
+  801426:	48 b8 cf 82 ff ff ff 	movabs $0xffffffffffff82cf,%rax
+  80142d:	ff ff ff 
+  801430:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801434:	ff d0                	call   *%rax
+  801436:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801439:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80143c:	48 63 d0             	movslq %eax,%rdx
+  80143f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801443:	48 01 c2             	add    %rax,%rdx
+  801446:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80144a:	48 89 c6             	mov    %rax,%rsi
+  80144d:	48 89 d7             	mov    %rdx,%rdi
+  801450:	48 b8 63 83 ff ff ff 	movabs $0xffffffffffff8363,%rax
+  801457:	ff ff ff 
+  80145a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80145e:	ff d0                	call   *%rax
+	return dst;
+  801460:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801464:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801468:	c9                   	leave
+  801469:	c3                   	ret
+
+000000000080146a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80146a:	55                   	push   %rbp
+  80146b:	48 89 e5             	mov    %rsp,%rbp
+  80146e:	48 83 ec 28          	sub    $0x28,%rsp
+  801472:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801472 <strncpy+0x8>
+  801479:	49 bb ce 7b 00 00 00 	movabs $0x7bce,%r11
+  801480:	00 00 00 
+  801483:	4c 01 d8             	add    %r11,%rax
+  801486:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80148a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80148e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801492:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801496:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80149a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8014a1:	00 
+  8014a2:	eb 2a                	jmp    8014ce <strncpy+0x64>
+		*dst++ = *src;
+  8014a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014a8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8014ac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8014b0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014b4:	0f b6 12             	movzbl (%rdx),%edx
+  8014b7:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8014b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014bd:	0f b6 00             	movzbl (%rax),%eax
+  8014c0:	84 c0                	test   %al,%al
+  8014c2:	74 05                	je     8014c9 <strncpy+0x5f>
+			src++;
+  8014c4:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8014c9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014d2:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8014d6:	72 cc                	jb     8014a4 <strncpy+0x3a>
+	}
+	return ret;
+  8014d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8014dc:	c9                   	leave
+  8014dd:	c3                   	ret
+
+00000000008014de <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8014de:	55                   	push   %rbp
+  8014df:	48 89 e5             	mov    %rsp,%rbp
+  8014e2:	48 83 ec 28          	sub    $0x28,%rsp
+  8014e6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014e6 <strlcpy+0x8>
+  8014ed:	49 bb 5a 7b 00 00 00 	movabs $0x7b5a,%r11
+  8014f4:	00 00 00 
+  8014f7:	4c 01 d8             	add    %r11,%rax
+  8014fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801502:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801506:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80150a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80150e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801513:	74 3d                	je     801552 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801515:	eb 1d                	jmp    801534 <strlcpy+0x56>
+			*dst++ = *src++;
+  801517:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80151b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80151f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801523:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801527:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80152b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80152f:	0f b6 12             	movzbl (%rdx),%edx
+  801532:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801534:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801539:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80153e:	74 0b                	je     80154b <strlcpy+0x6d>
+  801540:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801544:	0f b6 00             	movzbl (%rax),%eax
+  801547:	84 c0                	test   %al,%al
+  801549:	75 cc                	jne    801517 <strlcpy+0x39>
+		*dst = '\0';
+  80154b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80154f:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801552:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801556:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80155a:	c9                   	leave
+  80155b:	c3                   	ret
+
+000000000080155c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80155c:	55                   	push   %rbp
+  80155d:	48 89 e5             	mov    %rsp,%rbp
+  801560:	48 83 ec 10          	sub    $0x10,%rsp
+  801564:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801564 <strcmp+0x8>
+  80156b:	49 bb dc 7a 00 00 00 	movabs $0x7adc,%r11
+  801572:	00 00 00 
+  801575:	4c 01 d8             	add    %r11,%rax
+  801578:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80157c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801580:	eb 0a                	jmp    80158c <strcmp+0x30>
+		p++, q++;
+  801582:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801587:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80158c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801590:	0f b6 00             	movzbl (%rax),%eax
+  801593:	84 c0                	test   %al,%al
+  801595:	74 12                	je     8015a9 <strcmp+0x4d>
+  801597:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80159b:	0f b6 10             	movzbl (%rax),%edx
+  80159e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015a2:	0f b6 00             	movzbl (%rax),%eax
+  8015a5:	38 c2                	cmp    %al,%dl
+  8015a7:	74 d9                	je     801582 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8015a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ad:	0f b6 00             	movzbl (%rax),%eax
+  8015b0:	0f b6 d0             	movzbl %al,%edx
+  8015b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b7:	0f b6 00             	movzbl (%rax),%eax
+  8015ba:	0f b6 c0             	movzbl %al,%eax
+  8015bd:	29 c2                	sub    %eax,%edx
+  8015bf:	89 d0                	mov    %edx,%eax
+}
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+
+00000000008015c3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8015cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015cb <strncmp+0x8>
+  8015d2:	49 bb 75 7a 00 00 00 	movabs $0x7a75,%r11
+  8015d9:	00 00 00 
+  8015dc:	4c 01 d8             	add    %r11,%rax
+  8015df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8015e7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8015eb:	eb 0f                	jmp    8015fc <strncmp+0x39>
+		n--, p++, q++;
+  8015ed:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8015f2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015f7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8015fc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801601:	74 1d                	je     801620 <strncmp+0x5d>
+  801603:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801607:	0f b6 00             	movzbl (%rax),%eax
+  80160a:	84 c0                	test   %al,%al
+  80160c:	74 12                	je     801620 <strncmp+0x5d>
+  80160e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801612:	0f b6 10             	movzbl (%rax),%edx
+  801615:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801619:	0f b6 00             	movzbl (%rax),%eax
+  80161c:	38 c2                	cmp    %al,%dl
+  80161e:	74 cd                	je     8015ed <strncmp+0x2a>
+	if (n == 0)
+  801620:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801625:	75 07                	jne    80162e <strncmp+0x6b>
+		return 0;
+  801627:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162c:	eb 16                	jmp    801644 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80162e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801632:	0f b6 00             	movzbl (%rax),%eax
+  801635:	0f b6 d0             	movzbl %al,%edx
+  801638:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80163c:	0f b6 00             	movzbl (%rax),%eax
+  80163f:	0f b6 c0             	movzbl %al,%eax
+  801642:	29 c2                	sub    %eax,%edx
+}
+  801644:	89 d0                	mov    %edx,%eax
+  801646:	c9                   	leave
+  801647:	c3                   	ret
+
+0000000000801648 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801648:	55                   	push   %rbp
+  801649:	48 89 e5             	mov    %rsp,%rbp
+  80164c:	48 83 ec 10          	sub    $0x10,%rsp
+  801650:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801650 <strchr+0x8>
+  801657:	49 bb f0 79 00 00 00 	movabs $0x79f0,%r11
+  80165e:	00 00 00 
+  801661:	4c 01 d8             	add    %r11,%rax
+  801664:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801668:	89 f0                	mov    %esi,%eax
+  80166a:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80166d:	eb 17                	jmp    801686 <strchr+0x3e>
+		if (*s == c)
+  80166f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801673:	0f b6 00             	movzbl (%rax),%eax
+  801676:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801679:	75 06                	jne    801681 <strchr+0x39>
+			return (char *) s;
+  80167b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80167f:	eb 15                	jmp    801696 <strchr+0x4e>
+	for (; *s; s++)
+  801681:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801686:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80168a:	0f b6 00             	movzbl (%rax),%eax
+  80168d:	84 c0                	test   %al,%al
+  80168f:	75 de                	jne    80166f <strchr+0x27>
+	return 0;
+  801691:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801696:	c9                   	leave
+  801697:	c3                   	ret
+
+0000000000801698 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801698:	55                   	push   %rbp
+  801699:	48 89 e5             	mov    %rsp,%rbp
+  80169c:	48 83 ec 10          	sub    $0x10,%rsp
+  8016a0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016a0 <strfind+0x8>
+  8016a7:	49 bb a0 79 00 00 00 	movabs $0x79a0,%r11
+  8016ae:	00 00 00 
+  8016b1:	4c 01 d8             	add    %r11,%rax
+  8016b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016b8:	89 f0                	mov    %esi,%eax
+  8016ba:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8016bd:	eb 11                	jmp    8016d0 <strfind+0x38>
+		if (*s == c)
+  8016bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016c3:	0f b6 00             	movzbl (%rax),%eax
+  8016c6:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016c9:	74 12                	je     8016dd <strfind+0x45>
+	for (; *s; s++)
+  8016cb:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016d4:	0f b6 00             	movzbl (%rax),%eax
+  8016d7:	84 c0                	test   %al,%al
+  8016d9:	75 e4                	jne    8016bf <strfind+0x27>
+  8016db:	eb 01                	jmp    8016de <strfind+0x46>
+			break;
+  8016dd:	90                   	nop
+	return (char *) s;
+  8016de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016e2:	c9                   	leave
+  8016e3:	c3                   	ret
+
+00000000008016e4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8016e4:	55                   	push   %rbp
+  8016e5:	48 89 e5             	mov    %rsp,%rbp
+  8016e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8016ec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016ec <memset+0x8>
+  8016f3:	49 bb 54 79 00 00 00 	movabs $0x7954,%r11
+  8016fa:	00 00 00 
+  8016fd:	4c 01 d8             	add    %r11,%rax
+  801700:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801704:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801707:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80170b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801710:	75 06                	jne    801718 <memset+0x34>
+		return v;
+  801712:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801716:	eb 69                	jmp    801781 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801718:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80171c:	83 e0 03             	and    $0x3,%eax
+  80171f:	48 85 c0             	test   %rax,%rax
+  801722:	75 48                	jne    80176c <memset+0x88>
+  801724:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801728:	83 e0 03             	and    $0x3,%eax
+  80172b:	48 85 c0             	test   %rax,%rax
+  80172e:	75 3c                	jne    80176c <memset+0x88>
+		c &= 0xFF;
+  801730:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801737:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80173a:	c1 e0 18             	shl    $0x18,%eax
+  80173d:	89 c2                	mov    %eax,%edx
+  80173f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801742:	c1 e0 10             	shl    $0x10,%eax
+  801745:	09 c2                	or     %eax,%edx
+  801747:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80174a:	c1 e0 08             	shl    $0x8,%eax
+  80174d:	09 d0                	or     %edx,%eax
+  80174f:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801752:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801756:	48 c1 e8 02          	shr    $0x2,%rax
+  80175a:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  80175d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801761:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801764:	48 89 d7             	mov    %rdx,%rdi
+  801767:	fc                   	cld
+  801768:	f3 ab                	rep stos %eax,%es:(%rdi)
+  80176a:	eb 11                	jmp    80177d <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80176c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801770:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801773:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801777:	48 89 d7             	mov    %rdx,%rdi
+  80177a:	fc                   	cld
+  80177b:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  80177d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801781:	c9                   	leave
+  801782:	c3                   	ret
+
+0000000000801783 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801783:	55                   	push   %rbp
+  801784:	48 89 e5             	mov    %rsp,%rbp
+  801787:	48 83 ec 28          	sub    $0x28,%rsp
+  80178b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80178b <memmove+0x8>
+  801792:	49 bb b5 78 00 00 00 	movabs $0x78b5,%r11
+  801799:	00 00 00 
+  80179c:	4c 01 d8             	add    %r11,%rax
+  80179f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017a3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017a7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8017ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8017b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8017bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017bf:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8017c3:	0f 83 88 00 00 00    	jae    801851 <memmove+0xce>
+  8017c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017d1:	48 01 d0             	add    %rdx,%rax
+  8017d4:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8017d8:	73 77                	jae    801851 <memmove+0xce>
+		s += n;
+  8017da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017de:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8017e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017e6:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8017ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ee:	83 e0 03             	and    $0x3,%eax
+  8017f1:	48 85 c0             	test   %rax,%rax
+  8017f4:	75 3b                	jne    801831 <memmove+0xae>
+  8017f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017fa:	83 e0 03             	and    $0x3,%eax
+  8017fd:	48 85 c0             	test   %rax,%rax
+  801800:	75 2f                	jne    801831 <memmove+0xae>
+  801802:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801806:	83 e0 03             	and    $0x3,%eax
+  801809:	48 85 c0             	test   %rax,%rax
+  80180c:	75 23                	jne    801831 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80180e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801812:	48 83 e8 04          	sub    $0x4,%rax
+  801816:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80181a:	48 83 ea 04          	sub    $0x4,%rdx
+  80181e:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801822:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801826:	48 89 c7             	mov    %rax,%rdi
+  801829:	48 89 d6             	mov    %rdx,%rsi
+  80182c:	fd                   	std
+  80182d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80182f:	eb 1d                	jmp    80184e <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801831:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801835:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801839:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80183d:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801841:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801845:	48 89 d7             	mov    %rdx,%rdi
+  801848:	48 89 c1             	mov    %rax,%rcx
+  80184b:	fd                   	std
+  80184c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80184e:	fc                   	cld
+  80184f:	eb 57                	jmp    8018a8 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801851:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801855:	83 e0 03             	and    $0x3,%eax
+  801858:	48 85 c0             	test   %rax,%rax
+  80185b:	75 36                	jne    801893 <memmove+0x110>
+  80185d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801861:	83 e0 03             	and    $0x3,%eax
+  801864:	48 85 c0             	test   %rax,%rax
+  801867:	75 2a                	jne    801893 <memmove+0x110>
+  801869:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80186d:	83 e0 03             	and    $0x3,%eax
+  801870:	48 85 c0             	test   %rax,%rax
+  801873:	75 1e                	jne    801893 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801875:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801879:	48 c1 e8 02          	shr    $0x2,%rax
+  80187d:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801880:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801884:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801888:	48 89 c7             	mov    %rax,%rdi
+  80188b:	48 89 d6             	mov    %rdx,%rsi
+  80188e:	fc                   	cld
+  80188f:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801891:	eb 15                	jmp    8018a8 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801893:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801897:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80189b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80189f:	48 89 c7             	mov    %rax,%rdi
+  8018a2:	48 89 d6             	mov    %rdx,%rsi
+  8018a5:	fc                   	cld
+  8018a6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8018a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018ac:	c9                   	leave
+  8018ad:	c3                   	ret
+
+00000000008018ae <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8018ae:	55                   	push   %rbp
+  8018af:	48 89 e5             	mov    %rsp,%rbp
+  8018b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8018b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018b6 <memcpy+0x8>
+  8018bd:	49 bb 8a 77 00 00 00 	movabs $0x778a,%r11
+  8018c4:	00 00 00 
+  8018c7:	4c 01 d8             	add    %r11,%rax
+  8018ca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018ce:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018d2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8018d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018da:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8018de:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8018e2:	48 89 cf             	mov    %rcx,%rdi
+  8018e5:	48 b9 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rcx
+  8018ec:	ff ff ff 
+  8018ef:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8018f3:	ff d0                	call   *%rax
+}
+  8018f5:	c9                   	leave
+  8018f6:	c3                   	ret
+
+00000000008018f7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8018f7:	55                   	push   %rbp
+  8018f8:	48 89 e5             	mov    %rsp,%rbp
+  8018fb:	48 83 ec 28          	sub    $0x28,%rsp
+  8018ff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018ff <memcmp+0x8>
+  801906:	49 bb 41 77 00 00 00 	movabs $0x7741,%r11
+  80190d:	00 00 00 
+  801910:	4c 01 d8             	add    %r11,%rax
+  801913:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801917:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80191b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80191f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801923:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801927:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80192b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80192f:	eb 34                	jmp    801965 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801931:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801935:	0f b6 10             	movzbl (%rax),%edx
+  801938:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80193c:	0f b6 00             	movzbl (%rax),%eax
+  80193f:	38 c2                	cmp    %al,%dl
+  801941:	74 18                	je     80195b <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801943:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801947:	0f b6 00             	movzbl (%rax),%eax
+  80194a:	0f b6 d0             	movzbl %al,%edx
+  80194d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801951:	0f b6 00             	movzbl (%rax),%eax
+  801954:	0f b6 c0             	movzbl %al,%eax
+  801957:	29 c2                	sub    %eax,%edx
+  801959:	eb 20                	jmp    80197b <memcmp+0x84>
+		s1++, s2++;
+  80195b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801960:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801965:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801969:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80196d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801971:	48 85 c0             	test   %rax,%rax
+  801974:	75 bb                	jne    801931 <memcmp+0x3a>
+	}
+
+	return 0;
+  801976:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80197b:	89 d0                	mov    %edx,%eax
+  80197d:	c9                   	leave
+  80197e:	c3                   	ret
+
+000000000080197f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80197f:	55                   	push   %rbp
+  801980:	48 89 e5             	mov    %rsp,%rbp
+  801983:	48 83 ec 28          	sub    $0x28,%rsp
+  801987:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801987 <memfind+0x8>
+  80198e:	49 bb b9 76 00 00 00 	movabs $0x76b9,%r11
+  801995:	00 00 00 
+  801998:	4c 01 d8             	add    %r11,%rax
+  80199b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80199f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8019a2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8019a6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8019aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ae:	48 01 d0             	add    %rdx,%rax
+  8019b1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8019b5:	eb 13                	jmp    8019ca <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8019b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019bb:	0f b6 00             	movzbl (%rax),%eax
+  8019be:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8019c1:	38 d0                	cmp    %dl,%al
+  8019c3:	74 11                	je     8019d6 <memfind+0x57>
+	for (; s < ends; s++)
+  8019c5:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8019ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ce:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8019d2:	72 e3                	jb     8019b7 <memfind+0x38>
+  8019d4:	eb 01                	jmp    8019d7 <memfind+0x58>
+			break;
+  8019d6:	90                   	nop
+	return (void *) s;
+  8019d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019db:	c9                   	leave
+  8019dc:	c3                   	ret
+
+00000000008019dd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8019dd:	55                   	push   %rbp
+  8019de:	48 89 e5             	mov    %rsp,%rbp
+  8019e1:	48 83 ec 38          	sub    $0x38,%rsp
+  8019e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019e5 <strtol+0x8>
+  8019ec:	49 bb 5b 76 00 00 00 	movabs $0x765b,%r11
+  8019f3:	00 00 00 
+  8019f6:	4c 01 d8             	add    %r11,%rax
+  8019f9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a01:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801a04:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801a0b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801a12:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801a13:	eb 05                	jmp    801a1a <strtol+0x3d>
+		s++;
+  801a15:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801a1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a1e:	0f b6 00             	movzbl (%rax),%eax
+  801a21:	3c 20                	cmp    $0x20,%al
+  801a23:	74 f0                	je     801a15 <strtol+0x38>
+  801a25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a29:	0f b6 00             	movzbl (%rax),%eax
+  801a2c:	3c 09                	cmp    $0x9,%al
+  801a2e:	74 e5                	je     801a15 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801a30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a34:	0f b6 00             	movzbl (%rax),%eax
+  801a37:	3c 2b                	cmp    $0x2b,%al
+  801a39:	75 07                	jne    801a42 <strtol+0x65>
+		s++;
+  801a3b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a40:	eb 17                	jmp    801a59 <strtol+0x7c>
+	else if (*s == '-')
+  801a42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a46:	0f b6 00             	movzbl (%rax),%eax
+  801a49:	3c 2d                	cmp    $0x2d,%al
+  801a4b:	75 0c                	jne    801a59 <strtol+0x7c>
+		s++, neg = 1;
+  801a4d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a52:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801a59:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a5d:	74 06                	je     801a65 <strtol+0x88>
+  801a5f:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801a63:	75 28                	jne    801a8d <strtol+0xb0>
+  801a65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a69:	0f b6 00             	movzbl (%rax),%eax
+  801a6c:	3c 30                	cmp    $0x30,%al
+  801a6e:	75 1d                	jne    801a8d <strtol+0xb0>
+  801a70:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a74:	48 83 c0 01          	add    $0x1,%rax
+  801a78:	0f b6 00             	movzbl (%rax),%eax
+  801a7b:	3c 78                	cmp    $0x78,%al
+  801a7d:	75 0e                	jne    801a8d <strtol+0xb0>
+		s += 2, base = 16;
+  801a7f:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801a84:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801a8b:	eb 2c                	jmp    801ab9 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801a8d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a91:	75 19                	jne    801aac <strtol+0xcf>
+  801a93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a97:	0f b6 00             	movzbl (%rax),%eax
+  801a9a:	3c 30                	cmp    $0x30,%al
+  801a9c:	75 0e                	jne    801aac <strtol+0xcf>
+		s++, base = 8;
+  801a9e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801aa3:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801aaa:	eb 0d                	jmp    801ab9 <strtol+0xdc>
+	else if (base == 0)
+  801aac:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ab0:	75 07                	jne    801ab9 <strtol+0xdc>
+		base = 10;
+  801ab2:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801ab9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801abd:	0f b6 00             	movzbl (%rax),%eax
+  801ac0:	3c 2f                	cmp    $0x2f,%al
+  801ac2:	7e 1d                	jle    801ae1 <strtol+0x104>
+  801ac4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ac8:	0f b6 00             	movzbl (%rax),%eax
+  801acb:	3c 39                	cmp    $0x39,%al
+  801acd:	7f 12                	jg     801ae1 <strtol+0x104>
+			dig = *s - '0';
+  801acf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad3:	0f b6 00             	movzbl (%rax),%eax
+  801ad6:	0f be c0             	movsbl %al,%eax
+  801ad9:	83 e8 30             	sub    $0x30,%eax
+  801adc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801adf:	eb 4e                	jmp    801b2f <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801ae1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae5:	0f b6 00             	movzbl (%rax),%eax
+  801ae8:	3c 60                	cmp    $0x60,%al
+  801aea:	7e 1d                	jle    801b09 <strtol+0x12c>
+  801aec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801af0:	0f b6 00             	movzbl (%rax),%eax
+  801af3:	3c 7a                	cmp    $0x7a,%al
+  801af5:	7f 12                	jg     801b09 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801af7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801afb:	0f b6 00             	movzbl (%rax),%eax
+  801afe:	0f be c0             	movsbl %al,%eax
+  801b01:	83 e8 57             	sub    $0x57,%eax
+  801b04:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801b07:	eb 26                	jmp    801b2f <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801b09:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b0d:	0f b6 00             	movzbl (%rax),%eax
+  801b10:	3c 40                	cmp    $0x40,%al
+  801b12:	7e 47                	jle    801b5b <strtol+0x17e>
+  801b14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b18:	0f b6 00             	movzbl (%rax),%eax
+  801b1b:	3c 5a                	cmp    $0x5a,%al
+  801b1d:	7f 3c                	jg     801b5b <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801b1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b23:	0f b6 00             	movzbl (%rax),%eax
+  801b26:	0f be c0             	movsbl %al,%eax
+  801b29:	83 e8 37             	sub    $0x37,%eax
+  801b2c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801b2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b32:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801b35:	7d 23                	jge    801b5a <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801b37:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b3c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801b3f:	48 98                	cltq
+  801b41:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801b46:	48 89 c2             	mov    %rax,%rdx
+  801b49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b4c:	48 98                	cltq
+  801b4e:	48 01 d0             	add    %rdx,%rax
+  801b51:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801b55:	e9 5f ff ff ff       	jmp    801ab9 <strtol+0xdc>
+			break;
+  801b5a:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801b5b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801b60:	74 0b                	je     801b6d <strtol+0x190>
+		*endptr = (char *) s;
+  801b62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b66:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b6a:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801b6d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b71:	74 09                	je     801b7c <strtol+0x19f>
+  801b73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b77:	48 f7 d8             	neg    %rax
+  801b7a:	eb 04                	jmp    801b80 <strtol+0x1a3>
+  801b7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801b80:	c9                   	leave
+  801b81:	c3                   	ret
+
+0000000000801b82 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801b82:	55                   	push   %rbp
+  801b83:	48 89 e5             	mov    %rsp,%rbp
+  801b86:	53                   	push   %rbx
+  801b87:	48 83 ec 30          	sub    $0x30,%rsp
+  801b8b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801b8b <strstr+0x9>
+  801b92:	49 bb b5 74 00 00 00 	movabs $0x74b5,%r11
+  801b99:	00 00 00 
+  801b9c:	4c 01 db             	add    %r11,%rbx
+  801b9f:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801ba3:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801ba7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bab:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801baf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801bb3:	0f b6 00             	movzbl (%rax),%eax
+  801bb6:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801bb9:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801bbd:	75 06                	jne    801bc5 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801bbf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc3:	eb 73                	jmp    801c38 <strstr+0xb6>
+
+	len = strlen(str);
+  801bc5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bc9:	48 89 c7             	mov    %rax,%rdi
+  801bcc:	48 b8 cf 82 ff ff ff 	movabs $0xffffffffffff82cf,%rax
+  801bd3:	ff ff ff 
+  801bd6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801bda:	ff d0                	call   *%rax
+  801bdc:	48 98                	cltq
+  801bde:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801be2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801be6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bea:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801bee:	0f b6 00             	movzbl (%rax),%eax
+  801bf1:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801bf4:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801bf8:	75 07                	jne    801c01 <strstr+0x7f>
+				return (char *) 0;
+  801bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bff:	eb 37                	jmp    801c38 <strstr+0xb6>
+		} while (sc != c);
+  801c01:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801c05:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801c08:	75 d8                	jne    801be2 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801c0a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c0e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c12:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c16:	48 89 ce             	mov    %rcx,%rsi
+  801c19:	48 89 c7             	mov    %rax,%rdi
+  801c1c:	48 b8 83 85 ff ff ff 	movabs $0xffffffffffff8583,%rax
+  801c23:	ff ff ff 
+  801c26:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c2a:	ff d0                	call   *%rax
+  801c2c:	85 c0                	test   %eax,%eax
+  801c2e:	75 b2                	jne    801be2 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801c30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c34:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801c38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c3c:	c9                   	leave
+  801c3d:	c3                   	ret
+
+0000000000801c3e <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801c3e:	55                   	push   %rbp
+  801c3f:	48 89 e5             	mov    %rsp,%rbp
+  801c42:	41 57                	push   %r15
+  801c44:	53                   	push   %rbx
+  801c45:	48 83 ec 40          	sub    $0x40,%rsp
+  801c49:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801c49 <syscall+0xb>
+  801c50:	49 bb f7 73 00 00 00 	movabs $0x73f7,%r11
+  801c57:	00 00 00 
+  801c5a:	4d 01 da             	add    %r11,%r10
+  801c5d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801c60:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801c63:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801c67:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c6b:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801c6f:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801c73:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801c76:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801c7a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c7e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801c82:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801c86:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801c8a:	4c 89 c3             	mov    %r8,%rbx
+  801c8d:	cd 30                	int    $0x30
+  801c8f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801c93:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801c97:	74 52                	je     801ceb <syscall+0xad>
+  801c99:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c9e:	7e 4b                	jle    801ceb <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ca0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ca4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ca7:	49 89 d0             	mov    %rdx,%r8
+  801caa:	89 c1                	mov    %eax,%ecx
+  801cac:	48 b8 80 e2 ff ff ff 	movabs $0xffffffffffffe280,%rax
+  801cb3:	ff ff ff 
+  801cb6:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801cba:	48 89 c2             	mov    %rax,%rdx
+  801cbd:	be 23 00 00 00       	mov    $0x23,%esi
+  801cc2:	48 b8 9d e2 ff ff ff 	movabs $0xffffffffffffe29d,%rax
+  801cc9:	ff ff ff 
+  801ccc:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801cd0:	48 89 c7             	mov    %rax,%rdi
+  801cd3:	4d 89 d7             	mov    %r10,%r15
+  801cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdb:	49 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%r9
+  801ce2:	ff ff ff 
+  801ce5:	4d 01 d1             	add    %r10,%r9
+  801ce8:	41 ff d1             	call   *%r9
+
+	return ret;
+  801ceb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801cef:	48 83 c4 40          	add    $0x40,%rsp
+  801cf3:	5b                   	pop    %rbx
+  801cf4:	41 5f                	pop    %r15
+  801cf6:	5d                   	pop    %rbp
+  801cf7:	c3                   	ret
+
+0000000000801cf8 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801cf8:	55                   	push   %rbp
+  801cf9:	48 89 e5             	mov    %rsp,%rbp
+  801cfc:	41 57                	push   %r15
+  801cfe:	41 56                	push   %r14
+  801d00:	41 55                	push   %r13
+  801d02:	41 54                	push   %r12
+  801d04:	53                   	push   %rbx
+  801d05:	48 83 ec 48          	sub    $0x48,%rsp
+  801d09:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801d09 <syscall_words+0x11>
+  801d10:	49 bb 37 73 00 00 00 	movabs $0x7337,%r11
+  801d17:	00 00 00 
+  801d1a:	4d 01 de             	add    %r11,%r14
+  801d1d:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801d20:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801d23:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801d27:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801d2b:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801d2f:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801d33:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d38:	74 09                	je     801d43 <syscall_words+0x4b>
+  801d3a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d3e:	48 8b 00             	mov    (%rax),%rax
+  801d41:	eb 05                	jmp    801d48 <syscall_words+0x50>
+  801d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d48:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801d4b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d50:	74 0a                	je     801d5c <syscall_words+0x64>
+  801d52:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d56:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d5a:	eb 05                	jmp    801d61 <syscall_words+0x69>
+  801d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d61:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801d64:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d69:	74 0a                	je     801d75 <syscall_words+0x7d>
+  801d6b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d6f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d73:	eb 05                	jmp    801d7a <syscall_words+0x82>
+  801d75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7a:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801d7d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d82:	74 0a                	je     801d8e <syscall_words+0x96>
+  801d84:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d88:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d8c:	eb 05                	jmp    801d93 <syscall_words+0x9b>
+  801d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d93:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801d96:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d9b:	74 0a                	je     801da7 <syscall_words+0xaf>
+  801d9d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801da1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801da5:	eb 05                	jmp    801dac <syscall_words+0xb4>
+  801da7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dac:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801daf:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801db4:	74 0a                	je     801dc0 <syscall_words+0xc8>
+  801db6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dba:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801dbe:	eb 05                	jmp    801dc5 <syscall_words+0xcd>
+  801dc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc5:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801dc8:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801dcb:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801dcf:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801dd3:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801dd7:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801ddb:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ddf:	cd 30                	int    $0x30
+  801de1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801de5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dea:	74 50                	je     801e3c <syscall_words+0x144>
+		words[0] = r8;
+  801dec:	4c 89 c2             	mov    %r8,%rdx
+  801def:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801df3:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801df6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dfa:	48 83 c0 08          	add    $0x8,%rax
+  801dfe:	4c 89 ca             	mov    %r9,%rdx
+  801e01:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801e04:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e08:	48 83 c0 10          	add    $0x10,%rax
+  801e0c:	4c 89 d2             	mov    %r10,%rdx
+  801e0f:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801e12:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e16:	48 83 c0 18          	add    $0x18,%rax
+  801e1a:	4c 89 da             	mov    %r11,%rdx
+  801e1d:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801e20:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e24:	48 83 c0 20          	add    $0x20,%rax
+  801e28:	4c 89 e2             	mov    %r12,%rdx
+  801e2b:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801e2e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e32:	48 83 c0 28          	add    $0x28,%rax
+  801e36:	4c 89 ea             	mov    %r13,%rdx
+  801e39:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801e3c:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801e40:	74 52                	je     801e94 <syscall_words+0x19c>
+  801e42:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e47:	7e 4b                	jle    801e94 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e49:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e4d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801e50:	49 89 d0             	mov    %rdx,%r8
+  801e53:	89 c1                	mov    %eax,%ecx
+  801e55:	48 b8 80 e2 ff ff ff 	movabs $0xffffffffffffe280,%rax
+  801e5c:	ff ff ff 
+  801e5f:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801e63:	48 89 c2             	mov    %rax,%rdx
+  801e66:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801e6b:	48 b8 9d e2 ff ff ff 	movabs $0xffffffffffffe29d,%rax
+  801e72:	ff ff ff 
+  801e75:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801e79:	48 89 c7             	mov    %rax,%rdi
+  801e7c:	4d 89 f7             	mov    %r14,%r15
+  801e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e84:	49 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%r9
+  801e8b:	ff ff ff 
+  801e8e:	4d 01 f1             	add    %r14,%r9
+  801e91:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e94:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801e98:	48 83 c4 48          	add    $0x48,%rsp
+  801e9c:	5b                   	pop    %rbx
+  801e9d:	41 5c                	pop    %r12
+  801e9f:	41 5d                	pop    %r13
+  801ea1:	41 5e                	pop    %r14
+  801ea3:	41 5f                	pop    %r15
+  801ea5:	5d                   	pop    %rbp
+  801ea6:	c3                   	ret
+
+0000000000801ea7 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801ea7:	55                   	push   %rbp
+  801ea8:	48 89 e5             	mov    %rsp,%rbp
+  801eab:	48 83 ec 10          	sub    $0x10,%rsp
+  801eaf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801eaf <sys_cputs+0x8>
+  801eb6:	49 bb 91 71 00 00 00 	movabs $0x7191,%r11
+  801ebd:	00 00 00 
+  801ec0:	4c 01 d8             	add    %r11,%rax
+  801ec3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ec7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801ecb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ecf:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ed3:	48 83 ec 08          	sub    $0x8,%rsp
+  801ed7:	6a 00                	push   $0x0
+  801ed9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801edf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ee5:	be 00 00 00 00       	mov    $0x0,%esi
+  801eea:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eef:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  801ef6:	ff ff ff 
+  801ef9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801efd:	ff d0                	call   *%rax
+  801eff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f03:	90                   	nop
+  801f04:	c9                   	leave
+  801f05:	c3                   	ret
+
+0000000000801f06 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801f06:	55                   	push   %rbp
+  801f07:	48 89 e5             	mov    %rsp,%rbp
+  801f0a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f0a <sys_cgetc+0x4>
+  801f11:	49 bb 36 71 00 00 00 	movabs $0x7136,%r11
+  801f18:	00 00 00 
+  801f1b:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801f1e:	48 83 ec 08          	sub    $0x8,%rsp
+  801f22:	6a 00                	push   $0x0
+  801f24:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3a:	be 00 00 00 00       	mov    $0x0,%esi
+  801f3f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f44:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  801f4b:	ff ff ff 
+  801f4e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f52:	ff d0                	call   *%rax
+  801f54:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f58:	c9                   	leave
+  801f59:	c3                   	ret
+
+0000000000801f5a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801f5a:	55                   	push   %rbp
+  801f5b:	48 89 e5             	mov    %rsp,%rbp
+  801f5e:	48 83 ec 10          	sub    $0x10,%rsp
+  801f62:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f62 <sys_env_destroy+0x8>
+  801f69:	49 bb de 70 00 00 00 	movabs $0x70de,%r11
+  801f70:	00 00 00 
+  801f73:	4c 01 d8             	add    %r11,%rax
+  801f76:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801f79:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f7c:	48 63 d2             	movslq %edx,%rdx
+  801f7f:	48 83 ec 08          	sub    $0x8,%rsp
+  801f83:	6a 00                	push   $0x0
+  801f85:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f8b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f96:	be 01 00 00 00       	mov    $0x1,%esi
+  801f9b:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fa0:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  801fa7:	ff ff ff 
+  801faa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fae:	ff d0                	call   *%rax
+  801fb0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fb4:	c9                   	leave
+  801fb5:	c3                   	ret
+
+0000000000801fb6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801fb6:	55                   	push   %rbp
+  801fb7:	48 89 e5             	mov    %rsp,%rbp
+  801fba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fba <sys_getenvid+0x4>
+  801fc1:	49 bb 86 70 00 00 00 	movabs $0x7086,%r11
+  801fc8:	00 00 00 
+  801fcb:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801fce:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd2:	6a 00                	push   $0x0
+  801fd4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fda:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fe0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fea:	be 00 00 00 00       	mov    $0x0,%esi
+  801fef:	bf 02 00 00 00       	mov    $0x2,%edi
+  801ff4:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  801ffb:	ff ff ff 
+  801ffe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802002:	ff d0                	call   *%rax
+  802004:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802008:	c9                   	leave
+  802009:	c3                   	ret
+
+000000000080200a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80200a:	55                   	push   %rbp
+  80200b:	48 89 e5             	mov    %rsp,%rbp
+  80200e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80200e <sys_yield+0x4>
+  802015:	49 bb 32 70 00 00 00 	movabs $0x7032,%r11
+  80201c:	00 00 00 
+  80201f:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802022:	48 83 ec 08          	sub    $0x8,%rsp
+  802026:	6a 00                	push   $0x0
+  802028:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80202e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802034:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802039:	ba 00 00 00 00       	mov    $0x0,%edx
+  80203e:	be 00 00 00 00       	mov    $0x0,%esi
+  802043:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802048:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  80204f:	ff ff ff 
+  802052:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802056:	ff d0                	call   *%rax
+  802058:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80205c:	90                   	nop
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+
+000000000080205f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80205f:	55                   	push   %rbp
+  802060:	48 89 e5             	mov    %rsp,%rbp
+  802063:	48 83 ec 10          	sub    $0x10,%rsp
+  802067:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802067 <sys_page_alloc+0x8>
+  80206e:	49 bb d9 6f 00 00 00 	movabs $0x6fd9,%r11
+  802075:	00 00 00 
+  802078:	4c 01 d8             	add    %r11,%rax
+  80207b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80207e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802082:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802085:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802088:	48 63 f2             	movslq %edx,%rsi
+  80208b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80208f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802092:	48 63 d2             	movslq %edx,%rdx
+  802095:	48 83 ec 08          	sub    $0x8,%rsp
+  802099:	6a 00                	push   $0x0
+  80209b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020a1:	49 89 f0             	mov    %rsi,%r8
+  8020a4:	be 01 00 00 00       	mov    $0x1,%esi
+  8020a9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8020ae:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  8020b5:	ff ff ff 
+  8020b8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020bc:	ff d0                	call   *%rax
+  8020be:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020c2:	c9                   	leave
+  8020c3:	c3                   	ret
+
+00000000008020c4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8020c4:	55                   	push   %rbp
+  8020c5:	48 89 e5             	mov    %rsp,%rbp
+  8020c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8020cc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020cc <sys_page_map+0x8>
+  8020d3:	49 bb 74 6f 00 00 00 	movabs $0x6f74,%r11
+  8020da:	00 00 00 
+  8020dd:	4c 01 d8             	add    %r11,%rax
+  8020e0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020e7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8020ea:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020ee:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8020f2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8020f5:	48 63 f2             	movslq %edx,%rsi
+  8020f8:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8020fc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020ff:	48 63 fa             	movslq %edx,%rdi
+  802102:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802106:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802109:	48 63 d2             	movslq %edx,%rdx
+  80210c:	48 83 ec 08          	sub    $0x8,%rsp
+  802110:	56                   	push   %rsi
+  802111:	4d 89 c1             	mov    %r8,%r9
+  802114:	49 89 f8             	mov    %rdi,%r8
+  802117:	be 01 00 00 00       	mov    $0x1,%esi
+  80211c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802121:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  802128:	ff ff ff 
+  80212b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80212f:	ff d0                	call   *%rax
+  802131:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802135:	c9                   	leave
+  802136:	c3                   	ret
+
+0000000000802137 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802137:	55                   	push   %rbp
+  802138:	48 89 e5             	mov    %rsp,%rbp
+  80213b:	48 83 ec 10          	sub    $0x10,%rsp
+  80213f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80213f <sys_page_unmap+0x8>
+  802146:	49 bb 01 6f 00 00 00 	movabs $0x6f01,%r11
+  80214d:	00 00 00 
+  802150:	4c 01 d8             	add    %r11,%rax
+  802153:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802156:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  80215a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80215e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802161:	48 63 d2             	movslq %edx,%rdx
+  802164:	48 83 ec 08          	sub    $0x8,%rsp
+  802168:	6a 00                	push   $0x0
+  80216a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802170:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802176:	be 01 00 00 00       	mov    $0x1,%esi
+  80217b:	bf 06 00 00 00       	mov    $0x6,%edi
+  802180:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  802187:	ff ff ff 
+  80218a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80218e:	ff d0                	call   *%rax
+  802190:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802194:	c9                   	leave
+  802195:	c3                   	ret
+
+0000000000802196 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802196:	55                   	push   %rbp
+  802197:	48 89 e5             	mov    %rsp,%rbp
+  80219a:	48 83 ec 10          	sub    $0x10,%rsp
+  80219e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80219e <sys_env_set_status+0x8>
+  8021a5:	49 bb a2 6e 00 00 00 	movabs $0x6ea2,%r11
+  8021ac:	00 00 00 
+  8021af:	4c 01 d8             	add    %r11,%rax
+  8021b2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021b5:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8021b8:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021bb:	48 63 ca             	movslq %edx,%rcx
+  8021be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021c1:	48 63 d2             	movslq %edx,%rdx
+  8021c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c8:	6a 00                	push   $0x0
+  8021ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8021db:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021e0:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  8021e7:	ff ff ff 
+  8021ea:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021ee:	ff d0                	call   *%rax
+  8021f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021f4:	c9                   	leave
+  8021f5:	c3                   	ret
+
+00000000008021f6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8021f6:	55                   	push   %rbp
+  8021f7:	48 89 e5             	mov    %rsp,%rbp
+  8021fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8021fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021fe <sys_env_set_trapframe+0x8>
+  802205:	49 bb 42 6e 00 00 00 	movabs $0x6e42,%r11
+  80220c:	00 00 00 
+  80220f:	4c 01 d8             	add    %r11,%rax
+  802212:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802215:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802219:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80221d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802220:	48 63 d2             	movslq %edx,%rdx
+  802223:	48 83 ec 08          	sub    $0x8,%rsp
+  802227:	6a 00                	push   $0x0
+  802229:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80222f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802235:	be 01 00 00 00       	mov    $0x1,%esi
+  80223a:	bf 09 00 00 00       	mov    $0x9,%edi
+  80223f:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  802246:	ff ff ff 
+  802249:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80224d:	ff d0                	call   *%rax
+  80224f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802253:	c9                   	leave
+  802254:	c3                   	ret
+
+0000000000802255 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802255:	55                   	push   %rbp
+  802256:	48 89 e5             	mov    %rsp,%rbp
+  802259:	48 83 ec 10          	sub    $0x10,%rsp
+  80225d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80225d <sys_env_set_pgfault_upcall+0x8>
+  802264:	49 bb e3 6d 00 00 00 	movabs $0x6de3,%r11
+  80226b:	00 00 00 
+  80226e:	4c 01 d8             	add    %r11,%rax
+  802271:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802274:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802278:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80227c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80227f:	48 63 d2             	movslq %edx,%rdx
+  802282:	48 83 ec 08          	sub    $0x8,%rsp
+  802286:	6a 00                	push   $0x0
+  802288:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80228e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802294:	be 01 00 00 00       	mov    $0x1,%esi
+  802299:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80229e:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  8022a5:	ff ff ff 
+  8022a8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022ac:	ff d0                	call   *%rax
+  8022ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022b2:	c9                   	leave
+  8022b3:	c3                   	ret
+
+00000000008022b4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8022b4:	55                   	push   %rbp
+  8022b5:	48 89 e5             	mov    %rsp,%rbp
+  8022b8:	48 83 ec 20          	sub    $0x20,%rsp
+  8022bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022bc <sys_ipc_try_send+0x8>
+  8022c3:	49 bb 84 6d 00 00 00 	movabs $0x6d84,%r11
+  8022ca:	00 00 00 
+  8022cd:	4c 01 d8             	add    %r11,%rax
+  8022d0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022d3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022d7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8022db:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8022de:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022e1:	48 63 fa             	movslq %edx,%rdi
+  8022e4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8022e8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022eb:	48 63 d2             	movslq %edx,%rdx
+  8022ee:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8022f6:	6a 00                	push   $0x0
+  8022f8:	49 89 f9             	mov    %rdi,%r9
+  8022fb:	49 89 f0             	mov    %rsi,%r8
+  8022fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802303:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802308:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  80230f:	ff ff ff 
+  802312:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802316:	ff d0                	call   *%rax
+  802318:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80231c:	c9                   	leave
+  80231d:	c3                   	ret
+
+000000000080231e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80231e:	55                   	push   %rbp
+  80231f:	48 89 e5             	mov    %rsp,%rbp
+  802322:	48 83 ec 20          	sub    $0x20,%rsp
+  802326:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802326 <sys_ipc_send+0x8>
+  80232d:	49 bb 1a 6d 00 00 00 	movabs $0x6d1a,%r11
+  802334:	00 00 00 
+  802337:	4c 01 d8             	add    %r11,%rax
+  80233a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80233d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802341:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802345:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802348:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80234b:	48 63 fa             	movslq %edx,%rdi
+  80234e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802352:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802355:	48 63 d2             	movslq %edx,%rdx
+  802358:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80235c:	48 83 ec 08          	sub    $0x8,%rsp
+  802360:	6a 00                	push   $0x0
+  802362:	49 89 f9             	mov    %rdi,%r9
+  802365:	49 89 f0             	mov    %rsi,%r8
+  802368:	be 00 00 00 00       	mov    $0x0,%esi
+  80236d:	bf 17 00 00 00       	mov    $0x17,%edi
+  802372:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  802379:	ff ff ff 
+  80237c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802380:	ff d0                	call   *%rax
+  802382:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802386:	c9                   	leave
+  802387:	c3                   	ret
+
+0000000000802388 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802388:	55                   	push   %rbp
+  802389:	48 89 e5             	mov    %rsp,%rbp
+  80238c:	48 83 ec 10          	sub    $0x10,%rsp
+  802390:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802390 <sys_ipc_recv+0x8>
+  802397:	49 bb b0 6c 00 00 00 	movabs $0x6cb0,%r11
+  80239e:	00 00 00 
+  8023a1:	4c 01 d8             	add    %r11,%rax
+  8023a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8023a8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8023ac:	6a 00                	push   $0x0
+  8023ae:	6a 00                	push   $0x0
+  8023b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8023c6:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8023cb:	49 ba b8 8c ff ff ff 	movabs $0xffffffffffff8cb8,%r10
+  8023d2:	ff ff ff 
+  8023d5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023d9:	ff d0                	call   *%rax
+  8023db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023df:	c9                   	leave
+  8023e0:	c3                   	ret
+
+00000000008023e1 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8023e1:	55                   	push   %rbp
+  8023e2:	48 89 e5             	mov    %rsp,%rbp
+  8023e5:	48 83 ec 30          	sub    $0x30,%rsp
+  8023e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023e9 <sys_ipc_call+0x8>
+  8023f0:	49 bb 57 6c 00 00 00 	movabs $0x6c57,%r11
+  8023f7:	00 00 00 
+  8023fa:	4c 01 d8             	add    %r11,%rax
+  8023fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802400:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802404:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802408:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80240b:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80240f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802413:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802417:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80241a:	4c 63 c2             	movslq %edx,%r8
+  80241d:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802421:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802424:	48 63 d2             	movslq %edx,%rdx
+  802427:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80242b:	ff 75 d8             	push   -0x28(%rbp)
+  80242e:	56                   	push   %rsi
+  80242f:	4d 89 c1             	mov    %r8,%r9
+  802432:	49 89 f8             	mov    %rdi,%r8
+  802435:	be 00 00 00 00       	mov    $0x0,%esi
+  80243a:	bf 18 00 00 00       	mov    $0x18,%edi
+  80243f:	49 ba b8 8c ff ff ff 	movabs $0xffffffffffff8cb8,%r10
+  802446:	ff ff ff 
+  802449:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80244d:	ff d0                	call   *%rax
+  80244f:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802453:	c9                   	leave
+  802454:	c3                   	ret
+
+0000000000802455 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802455:	55                   	push   %rbp
+  802456:	48 89 e5             	mov    %rsp,%rbp
+  802459:	48 83 ec 30          	sub    $0x30,%rsp
+  80245d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80245d <sys_ipc_reply_recv+0x8>
+  802464:	49 bb e3 6b 00 00 00 	movabs $0x6be3,%r11
+  80246b:	00 00 00 
+  80246e:	4c 01 d8             	add    %r11,%rax
+  802471:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802474:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802478:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80247c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80247f:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802483:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802487:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80248b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80248e:	4c 63 c2             	movslq %edx,%r8
+  802491:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802495:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802498:	48 63 d2             	movslq %edx,%rdx
+  80249b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80249f:	ff 75 d8             	push   -0x28(%rbp)
+  8024a2:	56                   	push   %rsi
+  8024a3:	4d 89 c1             	mov    %r8,%r9
+  8024a6:	49 89 f8             	mov    %rdi,%r8
+  8024a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024ae:	bf 19 00 00 00       	mov    $0x19,%edi
+  8024b3:	49 ba b8 8c ff ff ff 	movabs $0xffffffffffff8cb8,%r10
+  8024ba:	ff ff ff 
+  8024bd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024c1:	ff d0                	call   *%rax
+  8024c3:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8024c7:	c9                   	leave
+  8024c8:	c3                   	ret
+
+00000000008024c9 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8024c9:	55                   	push   %rbp
+  8024ca:	48 89 e5             	mov    %rsp,%rbp
+  8024cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024d1 <sys_env_set_priority+0x8>
+  8024d8:	49 bb 6f 6b 00 00 00 	movabs $0x6b6f,%r11
+  8024df:	00 00 00 
+  8024e2:	4c 01 d8             	add    %r11,%rax
+  8024e5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024e8:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8024eb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024ee:	48 63 ca             	movslq %edx,%rcx
+  8024f1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024f4:	48 63 d2             	movslq %edx,%rdx
+  8024f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8024fb:	6a 00                	push   $0x0
+  8024fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802503:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802509:	be 01 00 00 00       	mov    $0x1,%esi
+  80250e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802513:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  80251a:	ff ff ff 
+  80251d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802521:	ff d0                	call   *%rax
+  802523:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802527:	c9                   	leave
+  802528:	c3                   	ret
+
+0000000000802529 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802529:	55                   	push   %rbp
+  80252a:	48 89 e5             	mov    %rsp,%rbp
+  80252d:	48 83 ec 10          	sub    $0x10,%rsp
+  802531:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802531 <sys_env_set_affinity+0x8>
+  802538:	49 bb 0f 6b 00 00 00 	movabs $0x6b0f,%r11
+  80253f:	00 00 00 
+  802542:	4c 01 d8             	add    %r11,%rax
+  802545:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802548:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  80254b:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  80254e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802551:	48 63 d2             	movslq %edx,%rdx
+  802554:	48 83 ec 08          	sub    $0x8,%rsp
+  802558:	6a 00                	push   $0x0
+  80255a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802560:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802566:	be 01 00 00 00       	mov    $0x1,%esi
+  80256b:	bf 10 00 00 00       	mov    $0x10,%edi
+  802570:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  802577:	ff ff ff 
+  80257a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80257e:	ff d0                	call   *%rax
+  802580:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802584:	c9                   	leave
+  802585:	c3                   	ret
+
+0000000000802586 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802586:	55                   	push   %rbp
+  802587:	48 89 e5             	mov    %rsp,%rbp
+  80258a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80258a <sys_time_msec+0x4>
+  802591:	49 bb b6 6a 00 00 00 	movabs $0x6ab6,%r11
+  802598:	00 00 00 
+  80259b:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80259e:	48 83 ec 08          	sub    $0x8,%rsp
+  8025a2:	6a 00                	push   $0x0
+  8025a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8025bf:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8025c4:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  8025cb:	ff ff ff 
+  8025ce:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025d2:	ff d0                	call   *%rax
+  8025d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025d8:	c9                   	leave
+  8025d9:	c3                   	ret
+
+00000000008025da <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8025da:	55                   	push   %rbp
+  8025db:	48 89 e5             	mov    %rsp,%rbp
+  8025de:	48 83 ec 10          	sub    $0x10,%rsp
+  8025e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025e2 <sys_sleep_usec+0x8>
+  8025e9:	49 bb 5e 6a 00 00 00 	movabs $0x6a5e,%r11
+  8025f0:	00 00 00 
+  8025f3:	4c 01 d8             	add    %r11,%rax
+  8025f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8025fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802602:	6a 00                	push   $0x0
+  802604:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80260a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802610:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802615:	be 00 00 00 00       	mov    $0x0,%esi
+  80261a:	bf 11 00 00 00       	mov    $0x11,%edi
+  80261f:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  802626:	ff ff ff 
+  802629:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80262d:	ff d0                	call   *%rax
+  80262f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802633:	c9                   	leave
+  802634:	c3                   	ret
+
+0000000000802635 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802635:	55                   	push   %rbp
+  802636:	48 89 e5             	mov    %rsp,%rbp
+  802639:	48 83 ec 10          	sub    $0x10,%rsp
+  80263d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80263d <sys_page_alloc_huge+0x8>
+  802644:	49 bb 03 6a 00 00 00 	movabs $0x6a03,%r11
+  80264b:	00 00 00 
+  80264e:	4c 01 d8             	add    %r11,%rax
+  802651:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802654:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802658:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  80265b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80265e:	48 63 f2             	movslq %edx,%rsi
+  802661:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802665:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802668:	48 63 d2             	movslq %edx,%rdx
+  80266b:	48 83 ec 08          	sub    $0x8,%rsp
+  80266f:	6a 00                	push   $0x0
+  802671:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802677:	49 89 f0             	mov    %rsi,%r8
+  80267a:	be 01 00 00 00       	mov    $0x1,%esi
+  80267f:	bf 12 00 00 00       	mov    $0x12,%edi
+  802684:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  80268b:	ff ff ff 
+  80268e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802692:	ff d0                	call   *%rax
+  802694:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802698:	c9                   	leave
+  802699:	c3                   	ret
+
+000000000080269a <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80269a:	55                   	push   %rbp
+  80269b:	48 89 e5             	mov    %rsp,%rbp
+  80269e:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026a2 <sys_page_map_batch+0x8>
+  8026a9:	49 bb 9e 69 00 00 00 	movabs $0x699e,%r11
+  8026b0:	00 00 00 
+  8026b3:	4c 01 d8             	add    %r11,%rax
+  8026b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8026be:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026c2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ca:	6a 00                	push   $0x0
+  8026cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8026dd:	bf 13 00 00 00       	mov    $0x13,%edi
+  8026e2:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  8026e9:	ff ff ff 
+  8026ec:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026f0:	ff d0                	call   *%rax
+  8026f2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f6:	c9                   	leave
+  8026f7:	c3                   	ret
+
+00000000008026f8 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8026f8:	55                   	push   %rbp
+  8026f9:	48 89 e5             	mov    %rsp,%rbp
+  8026fc:	48 83 ec 10          	sub    $0x10,%rsp
+  802700:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802700 <sys_page_alloc_batch+0x8>
+  802707:	49 bb 40 69 00 00 00 	movabs $0x6940,%r11
+  80270e:	00 00 00 
+  802711:	4c 01 d8             	add    %r11,%rax
+  802714:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802718:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80271c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802720:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802724:	48 83 ec 08          	sub    $0x8,%rsp
+  802728:	6a 00                	push   $0x0
+  80272a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802730:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802736:	be 01 00 00 00       	mov    $0x1,%esi
+  80273b:	bf 14 00 00 00       	mov    $0x14,%edi
+  802740:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  802747:	ff ff ff 
+  80274a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80274e:	ff d0                	call   *%rax
+  802750:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802754:	c9                   	leave
+  802755:	c3                   	ret
+
+0000000000802756 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802756:	55                   	push   %rbp
+  802757:	48 89 e5             	mov    %rsp,%rbp
+  80275a:	48 83 ec 10          	sub    $0x10,%rsp
+  80275e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80275e <sys_page_unmap_batch+0x8>
+  802765:	49 bb e2 68 00 00 00 	movabs $0x68e2,%r11
+  80276c:	00 00 00 
+  80276f:	4c 01 d8             	add    %r11,%rax
+  802772:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802776:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80277a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80277e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802782:	48 83 ec 08          	sub    $0x8,%rsp
+  802786:	6a 00                	push   $0x0
+  802788:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80278e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802794:	be 01 00 00 00       	mov    $0x1,%esi
+  802799:	bf 15 00 00 00       	mov    $0x15,%edi
+  80279e:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  8027a5:	ff ff ff 
+  8027a8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027ac:	ff d0                	call   *%rax
+  8027ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027b2:	c9                   	leave
+  8027b3:	c3                   	ret
+
+00000000008027b4 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8027b4:	55                   	push   %rbp
+  8027b5:	48 89 e5             	mov    %rsp,%rbp
+  8027b8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027b8 <sys_fork+0x4>
+  8027bf:	49 bb 88 68 00 00 00 	movabs $0x6888,%r11
+  8027c6:	00 00 00 
+  8027c9:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8027cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d0:	6a 00                	push   $0x0
+  8027d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ed:	bf 16 00 00 00       	mov    $0x16,%edi
+  8027f2:	49 ba fe 8b ff ff ff 	movabs $0xffffffffffff8bfe,%r10
+  8027f9:	ff ff ff 
+  8027fc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802800:	ff d0                	call   *%rax
+  802802:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802806:	c9                   	leave
+  802807:	c3                   	ret
+
+0000000000802808 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802808:	55                   	push   %rbp
+  802809:	48 89 e5             	mov    %rsp,%rbp
+  80280c:	41 57                	push   %r15
+  80280e:	53                   	push   %rbx
+  80280f:	48 83 ec 40          	sub    $0x40,%rsp
+  802813:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802813 <pgfault+0xb>
+  80281a:	49 bb 2d 68 00 00 00 	movabs $0x682d,%r11
+  802821:	00 00 00 
+  802824:	4c 01 db             	add    %r11,%rbx
+  802827:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  80282b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80282f:	48 8b 00             	mov    (%rax),%rax
+  802832:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802836:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80283a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80283e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802841:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802845:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802849:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80284d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802853:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802857:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80285a:	83 e0 02             	and    $0x2,%eax
+  80285d:	85 c0                	test   %eax,%eax
+  80285f:	0f 84 91 03 00 00    	je     802bf6 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802865:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802869:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80286d:	48 89 c2             	mov    %rax,%rdx
+  802870:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802877:	ff ff ff 
+  80287a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80287e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802882:	83 e0 01             	and    $0x1,%eax
+  802885:	48 85 c0             	test   %rax,%rax
+  802888:	0f 84 a7 01 00 00    	je     802a35 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  80288e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802892:	48 c1 e8 15          	shr    $0x15,%rax
+  802896:	48 89 c2             	mov    %rax,%rdx
+  802899:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8028a0:	ff ff ff 
+  8028a3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8028a7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028ab:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8028b0:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  8028b6:	0f 85 79 01 00 00    	jne    802a35 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  8028bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028c0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8028c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8028c8:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  8028ce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  8028d2:	ba 07 00 00 00       	mov    $0x7,%edx
+  8028d7:	be 00 00 60 00       	mov    $0x600000,%esi
+  8028dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028e1:	49 89 df             	mov    %rbx,%r15
+  8028e4:	48 b8 f5 95 ff ff ff 	movabs $0xffffffffffff95f5,%rax
+  8028eb:	ff ff ff 
+  8028ee:	48 01 d8             	add    %rbx,%rax
+  8028f1:	ff d0                	call   *%rax
+  8028f3:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8028f6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8028fa:	79 44                	jns    802940 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  8028fc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8028ff:	89 c1                	mov    %eax,%ecx
+  802901:	48 b8 b0 e2 ff ff ff 	movabs $0xffffffffffffe2b0,%rax
+  802908:	ff ff ff 
+  80290b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80290f:	48 89 c2             	mov    %rax,%rdx
+  802912:	be 20 00 00 00       	mov    $0x20,%esi
+  802917:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  80291e:	ff ff ff 
+  802921:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802925:	48 89 c7             	mov    %rax,%rdi
+  802928:	49 89 df             	mov    %rbx,%r15
+  80292b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802930:	49 b8 29 da ff ff ff 	movabs $0xffffffffffffda29,%r8
+  802937:	ff ff ff 
+  80293a:	49 01 d8             	add    %rbx,%r8
+  80293d:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802940:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802944:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802949:	48 89 c6             	mov    %rax,%rsi
+  80294c:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802951:	49 89 df             	mov    %rbx,%r15
+  802954:	48 b8 6e 88 ff ff ff 	movabs $0xffffffffffff886e,%rax
+  80295b:	ff ff ff 
+  80295e:	48 01 d8             	add    %rbx,%rax
+  802961:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802963:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802967:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80296d:	48 89 c1             	mov    %rax,%rcx
+  802970:	ba 00 00 00 00       	mov    $0x0,%edx
+  802975:	be 00 00 60 00       	mov    $0x600000,%esi
+  80297a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80297f:	49 89 df             	mov    %rbx,%r15
+  802982:	48 b8 84 90 ff ff ff 	movabs $0xffffffffffff9084,%rax
+  802989:	ff ff ff 
+  80298c:	48 01 d8             	add    %rbx,%rax
+  80298f:	ff d0                	call   *%rax
+  802991:	85 c0                	test   %eax,%eax
+  802993:	74 3e                	je     8029d3 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802995:	48 b8 db e2 ff ff ff 	movabs $0xffffffffffffe2db,%rax
+  80299c:	ff ff ff 
+  80299f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029a3:	48 89 c2             	mov    %rax,%rdx
+  8029a6:	be 23 00 00 00       	mov    $0x23,%esi
+  8029ab:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  8029b2:	ff ff ff 
+  8029b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029b9:	48 89 c7             	mov    %rax,%rdi
+  8029bc:	49 89 df             	mov    %rbx,%r15
+  8029bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c4:	48 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%rcx
+  8029cb:	ff ff ff 
+  8029ce:	48 01 d9             	add    %rbx,%rcx
+  8029d1:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  8029d3:	be 00 00 60 00       	mov    $0x600000,%esi
+  8029d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029dd:	49 89 df             	mov    %rbx,%r15
+  8029e0:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  8029e7:	ff ff ff 
+  8029ea:	48 01 d8             	add    %rbx,%rax
+  8029ed:	ff d0                	call   *%rax
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	0f 84 3d 02 00 00    	je     802c34 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  8029f7:	48 b8 f0 e2 ff ff ff 	movabs $0xffffffffffffe2f0,%rax
+  8029fe:	ff ff ff 
+  802a01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a05:	48 89 c2             	mov    %rax,%rdx
+  802a08:	be 25 00 00 00       	mov    $0x25,%esi
+  802a0d:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  802a14:	ff ff ff 
+  802a17:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a1b:	48 89 c7             	mov    %rax,%rdi
+  802a1e:	49 89 df             	mov    %rbx,%r15
+  802a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a26:	48 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%rcx
+  802a2d:	ff ff ff 
+  802a30:	48 01 d9             	add    %rbx,%rcx
+  802a33:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802a35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a39:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a3d:	48 89 c2             	mov    %rax,%rdx
+  802a40:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802a47:	ff ff ff 
+  802a4a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a4e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a52:	25 00 08 00 00       	and    $0x800,%eax
+  802a57:	48 85 c0             	test   %rax,%rax
+  802a5a:	0f 84 58 01 00 00    	je     802bb8 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802a60:	ba 07 00 00 00       	mov    $0x7,%edx
+  802a65:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802a6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a6f:	49 89 df             	mov    %rbx,%r15
+  802a72:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  802a79:	ff ff ff 
+  802a7c:	48 01 d8             	add    %rbx,%rax
+  802a7f:	ff d0                	call   *%rax
+  802a81:	85 c0                	test   %eax,%eax
+  802a83:	74 3e                	je     802ac3 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802a85:	48 b8 07 e3 ff ff ff 	movabs $0xffffffffffffe307,%rax
+  802a8c:	ff ff ff 
+  802a8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a93:	48 89 c2             	mov    %rax,%rdx
+  802a96:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802a9b:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  802aa2:	ff ff ff 
+  802aa5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aa9:	48 89 c7             	mov    %rax,%rdi
+  802aac:	49 89 df             	mov    %rbx,%r15
+  802aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab4:	48 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%rcx
+  802abb:	ff ff ff 
+  802abe:	48 01 d9             	add    %rbx,%rcx
+  802ac1:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802ac3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ac7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802acc:	48 89 c6             	mov    %rax,%rsi
+  802acf:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802ad4:	49 89 df             	mov    %rbx,%r15
+  802ad7:	48 b8 6e 88 ff ff ff 	movabs $0xffffffffffff886e,%rax
+  802ade:	ff ff ff 
+  802ae1:	48 01 d8             	add    %rbx,%rax
+  802ae4:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802ae6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802aea:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802af0:	48 89 c1             	mov    %rax,%rcx
+  802af3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802af8:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802afd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b02:	49 89 df             	mov    %rbx,%r15
+  802b05:	48 b8 84 90 ff ff ff 	movabs $0xffffffffffff9084,%rax
+  802b0c:	ff ff ff 
+  802b0f:	48 01 d8             	add    %rbx,%rax
+  802b12:	ff d0                	call   *%rax
+  802b14:	85 c0                	test   %eax,%eax
+  802b16:	74 3e                	je     802b56 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802b18:	48 b8 db e2 ff ff ff 	movabs $0xffffffffffffe2db,%rax
+  802b1f:	ff ff ff 
+  802b22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b26:	48 89 c2             	mov    %rax,%rdx
+  802b29:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802b2e:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  802b35:	ff ff ff 
+  802b38:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b3c:	48 89 c7             	mov    %rax,%rdi
+  802b3f:	49 89 df             	mov    %rbx,%r15
+  802b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b47:	48 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%rcx
+  802b4e:	ff ff ff 
+  802b51:	48 01 d9             	add    %rbx,%rcx
+  802b54:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802b56:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802b5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b60:	49 89 df             	mov    %rbx,%r15
+  802b63:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  802b6a:	ff ff ff 
+  802b6d:	48 01 d8             	add    %rbx,%rax
+  802b70:	ff d0                	call   *%rax
+  802b72:	85 c0                	test   %eax,%eax
+  802b74:	0f 84 bb 00 00 00    	je     802c35 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802b7a:	48 b8 f0 e2 ff ff ff 	movabs $0xffffffffffffe2f0,%rax
+  802b81:	ff ff ff 
+  802b84:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b88:	48 89 c2             	mov    %rax,%rdx
+  802b8b:	be 32 00 00 00       	mov    $0x32,%esi
+  802b90:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  802b97:	ff ff ff 
+  802b9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b9e:	48 89 c7             	mov    %rax,%rdi
+  802ba1:	49 89 df             	mov    %rbx,%r15
+  802ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba9:	48 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%rcx
+  802bb0:	ff ff ff 
+  802bb3:	48 01 d9             	add    %rbx,%rcx
+  802bb6:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802bb8:	48 b8 20 e3 ff ff ff 	movabs $0xffffffffffffe320,%rax
+  802bbf:	ff ff ff 
+  802bc2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bc6:	48 89 c2             	mov    %rax,%rdx
+  802bc9:	be 36 00 00 00       	mov    $0x36,%esi
+  802bce:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  802bd5:	ff ff ff 
+  802bd8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bdc:	48 89 c7             	mov    %rax,%rdi
+  802bdf:	49 89 df             	mov    %rbx,%r15
+  802be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be7:	48 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%rcx
+  802bee:	ff ff ff 
+  802bf1:	48 01 d9             	add    %rbx,%rcx
+  802bf4:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802bf6:	48 b8 3f e3 ff ff ff 	movabs $0xffffffffffffe33f,%rax
+  802bfd:	ff ff ff 
+  802c00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c04:	48 89 c2             	mov    %rax,%rdx
+  802c07:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802c0c:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  802c13:	ff ff ff 
+  802c16:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c1a:	48 89 c7             	mov    %rax,%rdi
+  802c1d:	49 89 df             	mov    %rbx,%r15
+  802c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c25:	48 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%rcx
+  802c2c:	ff ff ff 
+  802c2f:	48 01 d9             	add    %rbx,%rcx
+  802c32:	ff d1                	call   *%rcx
+			return;
+  802c34:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802c35:	48 83 c4 40          	add    $0x40,%rsp
+  802c39:	5b                   	pop    %rbx
+  802c3a:	41 5f                	pop    %r15
+  802c3c:	5d                   	pop    %rbp
+  802c3d:	c3                   	ret
+
+0000000000802c3e <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802c3e:	55                   	push   %rbp
+  802c3f:	48 89 e5             	mov    %rsp,%rbp
+  802c42:	41 57                	push   %r15
+  802c44:	53                   	push   %rbx
+  802c45:	48 83 ec 10          	sub    $0x10,%rsp
+  802c49:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c49 <fork_flush+0xb>
+  802c50:	49 bb f7 63 00 00 00 	movabs $0x63f7,%r11
+  802c57:	00 00 00 
+  802c5a:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802c5d:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802c64:	00 00 00 
+  802c67:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c6b:	48 85 c0             	test   %rax,%rax
+  802c6e:	0f 84 81 00 00 00    	je     802cf5 <fork_flush+0xb7>
+  802c74:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802c7b:	00 00 00 
+  802c7e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c82:	48 89 c6             	mov    %rax,%rsi
+  802c85:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802c8c:	00 00 00 
+  802c8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c93:	48 89 c7             	mov    %rax,%rdi
+  802c96:	49 89 df             	mov    %rbx,%r15
+  802c99:	48 b8 5a 96 ff ff ff 	movabs $0xffffffffffff965a,%rax
+  802ca0:	ff ff ff 
+  802ca3:	48 01 d8             	add    %rbx,%rax
+  802ca6:	ff d0                	call   *%rax
+  802ca8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802cab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802caf:	79 44                	jns    802cf5 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802cb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cb4:	89 c1                	mov    %eax,%ecx
+  802cb6:	48 b8 58 e3 ff ff ff 	movabs $0xffffffffffffe358,%rax
+  802cbd:	ff ff ff 
+  802cc0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cc4:	48 89 c2             	mov    %rax,%rdx
+  802cc7:	be 56 00 00 00       	mov    $0x56,%esi
+  802ccc:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  802cd3:	ff ff ff 
+  802cd6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cda:	48 89 c7             	mov    %rax,%rdi
+  802cdd:	49 89 df             	mov    %rbx,%r15
+  802ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce5:	49 b8 29 da ff ff ff 	movabs $0xffffffffffffda29,%r8
+  802cec:	ff ff ff 
+  802cef:	49 01 d8             	add    %rbx,%r8
+  802cf2:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802cf5:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802cfc:	00 00 00 
+  802cff:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802d06:	00 
+}
+  802d07:	90                   	nop
+  802d08:	48 83 c4 10          	add    $0x10,%rsp
+  802d0c:	5b                   	pop    %rbx
+  802d0d:	41 5f                	pop    %r15
+  802d0f:	5d                   	pop    %rbp
+  802d10:	c3                   	ret
+
+0000000000802d11 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802d11:	55                   	push   %rbp
+  802d12:	48 89 e5             	mov    %rsp,%rbp
+  802d15:	53                   	push   %rbx
+  802d16:	48 83 ec 28          	sub    $0x28,%rsp
+  802d1a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802d1a <fork_map+0x9>
+  802d21:	49 bb 26 63 00 00 00 	movabs $0x6326,%r11
+  802d28:	00 00 00 
+  802d2b:	4c 01 db             	add    %r11,%rbx
+  802d2e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d31:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802d35:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802d38:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802d3f:	00 00 00 
+  802d42:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d46:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802d4c:	75 10                	jne    802d5e <fork_map+0x4d>
+		fork_flush();
+  802d4e:	48 b8 fe 9b ff ff ff 	movabs $0xffffffffffff9bfe,%rax
+  802d55:	ff ff ff 
+  802d58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d5c:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802d5e:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802d65:	00 00 00 
+  802d68:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d6c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802d70:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802d77:	00 00 00 
+  802d7a:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802d7e:	48 c1 e0 05          	shl    $0x5,%rax
+  802d82:	48 89 c2             	mov    %rax,%rdx
+  802d85:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802d8c:	00 00 00 
+  802d8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d93:	48 01 d0             	add    %rdx,%rax
+  802d96:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802d9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d9e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802da4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802da8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802dac:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802db0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802db4:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802db7:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802dba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dbe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802dc2:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802dc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dca:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802dcd:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802dd0:	90                   	nop
+  802dd1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dd5:	c9                   	leave
+  802dd6:	c3                   	ret
+
+0000000000802dd7 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802dd7:	55                   	push   %rbp
+  802dd8:	48 89 e5             	mov    %rsp,%rbp
+  802ddb:	53                   	push   %rbx
+  802ddc:	48 83 ec 28          	sub    $0x28,%rsp
+  802de0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802de0 <duppage+0x9>
+  802de7:	49 bb 60 62 00 00 00 	movabs $0x6260,%r11
+  802dee:	00 00 00 
+  802df1:	4c 01 db             	add    %r11,%rbx
+  802df4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802df7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802dfa:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802dfd:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e01:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802e05:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802e0c:	ff ff ff 
+  802e0f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e13:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802e16:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e1a:	25 00 04 00 00       	and    $0x400,%eax
+  802e1f:	48 85 c0             	test   %rax,%rax
+  802e22:	74 42                	je     802e66 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802e24:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802e2b:	ff ff ff 
+  802e2e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e32:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802e35:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e39:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e3e:	89 c2                	mov    %eax,%edx
+  802e40:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802e44:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e47:	48 89 ce             	mov    %rcx,%rsi
+  802e4a:	89 c7                	mov    %eax,%edi
+  802e4c:	48 b8 d1 9c ff ff ff 	movabs $0xffffffffffff9cd1,%rax
+  802e53:	ff ff ff 
+  802e56:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e5a:	ff d0                	call   *%rax
+		return 0;
+  802e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e61:	e9 ae 00 00 00       	jmp    802f14 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802e66:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802e6d:	ff ff ff 
+  802e70:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e74:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802e77:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e7b:	83 e0 02             	and    $0x2,%eax
+  802e7e:	48 85 c0             	test   %rax,%rax
+  802e81:	75 1f                	jne    802ea2 <duppage+0xcb>
+  802e83:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802e8a:	ff ff ff 
+  802e8d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e91:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802e94:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e98:	25 00 08 00 00       	and    $0x800,%eax
+  802e9d:	48 85 c0             	test   %rax,%rax
+  802ea0:	74 4c                	je     802eee <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  802ea2:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  802ea9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802eac:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802eb0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802eb3:	48 89 ce             	mov    %rcx,%rsi
+  802eb6:	89 c7                	mov    %eax,%edi
+  802eb8:	48 b8 d1 9c ff ff ff 	movabs $0xffffffffffff9cd1,%rax
+  802ebf:	ff ff ff 
+  802ec2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ec6:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  802ec8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802ecb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ecf:	48 89 c6             	mov    %rax,%rsi
+  802ed2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ed7:	48 b8 d1 9c ff ff ff 	movabs $0xffffffffffff9cd1,%rax
+  802ede:	ff ff ff 
+  802ee1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ee5:	ff d0                	call   *%rax
+		return 0;
+  802ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eec:	eb 26                	jmp    802f14 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  802eee:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802ef2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ef5:	ba 05 00 00 00       	mov    $0x5,%edx
+  802efa:	48 89 ce             	mov    %rcx,%rsi
+  802efd:	89 c7                	mov    %eax,%edi
+  802eff:	48 b8 d1 9c ff ff ff 	movabs $0xffffffffffff9cd1,%rax
+  802f06:	ff ff ff 
+  802f09:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f0d:	ff d0                	call   *%rax
+		return 0;
+  802f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  802f14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f18:	c9                   	leave
+  802f19:	c3                   	ret
+
+0000000000802f1a <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  802f1a:	55                   	push   %rbp
+  802f1b:	48 89 e5             	mov    %rsp,%rbp
+  802f1e:	53                   	push   %rbx
+  802f1f:	48 83 ec 28          	sub    $0x28,%rsp
+  802f23:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f23 <duphuge+0x9>
+  802f2a:	49 bb 1d 61 00 00 00 	movabs $0x611d,%r11
+  802f31:	00 00 00 
+  802f34:	4c 01 db             	add    %r11,%rbx
+  802f37:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f3a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  802f3e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f42:	48 c1 e8 15          	shr    $0x15,%rax
+  802f46:	48 89 c2             	mov    %rax,%rdx
+  802f49:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f50:	ff ff ff 
+  802f53:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f57:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f5b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  802f5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f63:	25 00 04 00 00       	and    $0x400,%eax
+  802f68:	48 85 c0             	test   %rax,%rax
+  802f6b:	74 0e                	je     802f7b <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  802f6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f71:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f79:	eb 1e                	jmp    802f99 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  802f7b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f7f:	25 02 08 00 00       	and    $0x802,%eax
+  802f84:	48 85 c0             	test   %rax,%rax
+  802f87:	74 09                	je     802f92 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  802f89:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  802f90:	eb 07                	jmp    802f99 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  802f92:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  802f99:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802f9c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802fa0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fa3:	48 89 ce             	mov    %rcx,%rsi
+  802fa6:	89 c7                	mov    %eax,%edi
+  802fa8:	48 b8 d1 9c ff ff ff 	movabs $0xffffffffffff9cd1,%rax
+  802faf:	ff ff ff 
+  802fb2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fb6:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  802fb8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fbb:	25 00 08 00 00       	and    $0x800,%eax
+  802fc0:	85 c0                	test   %eax,%eax
+  802fc2:	74 1f                	je     802fe3 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  802fc4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802fc7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fcb:	48 89 c6             	mov    %rax,%rsi
+  802fce:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd3:	48 b8 d1 9c ff ff ff 	movabs $0xffffffffffff9cd1,%rax
+  802fda:	ff ff ff 
+  802fdd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fe1:	ff d0                	call   *%rax
+	return 0;
+  802fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fe8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fec:	c9                   	leave
+  802fed:	c3                   	ret
+
+0000000000802fee <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802fee:	55                   	push   %rbp
+  802fef:	48 89 e5             	mov    %rsp,%rbp
+  802ff2:	41 57                	push   %r15
+  802ff4:	53                   	push   %rbx
+  802ff5:	48 83 ec 10          	sub    $0x10,%rsp
+  802ff9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ff9 <fork+0xb>
+  803000:	49 bb 47 60 00 00 00 	movabs $0x6047,%r11
+  803007:	00 00 00 
+  80300a:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  80300d:	49 89 df             	mov    %rbx,%r15
+  803010:	48 b8 74 97 ff ff ff 	movabs $0xffffffffffff9774,%rax
+  803017:	ff ff ff 
+  80301a:	48 01 d8             	add    %rbx,%rax
+  80301d:	ff d0                	call   *%rax
+  80301f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803022:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803026:	75 42                	jne    80306a <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803028:	49 89 df             	mov    %rbx,%r15
+  80302b:	48 b8 76 8f ff ff ff 	movabs $0xffffffffffff8f76,%rax
+  803032:	ff ff ff 
+  803035:	48 01 d8             	add    %rbx,%rax
+  803038:	ff d0                	call   *%rax
+  80303a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80303f:	48 98                	cltq
+  803041:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803048:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80304f:	ff ff ff 
+  803052:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803056:	48 01 c2             	add    %rax,%rdx
+  803059:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803060:	ff ff ff 
+  803063:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803067:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  80306a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80306d:	48 83 c4 10          	add    $0x10,%rsp
+  803071:	5b                   	pop    %rbx
+  803072:	41 5f                	pop    %r15
+  803074:	5d                   	pop    %rbp
+  803075:	c3                   	ret
+
+0000000000803076 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  803076:	55                   	push   %rbp
+  803077:	48 89 e5             	mov    %rsp,%rbp
+  80307a:	41 57                	push   %r15
+  80307c:	53                   	push   %rbx
+  80307d:	48 83 ec 10          	sub    $0x10,%rsp
+  803081:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803081 <ufork+0xb>
+  803088:	49 bb bf 5f 00 00 00 	movabs $0x5fbf,%r11
+  80308f:	00 00 00 
+  803092:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  803095:	48 b8 c8 97 ff ff ff 	movabs $0xffffffffffff97c8,%rax
+  80309c:	ff ff ff 
+  80309f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030a3:	48 89 c7             	mov    %rax,%rdi
+  8030a6:	49 89 df             	mov    %rbx,%r15
+  8030a9:	48 b8 82 db ff ff ff 	movabs $0xffffffffffffdb82,%rax
+  8030b0:	ff ff ff 
+  8030b3:	48 01 d8             	add    %rbx,%rax
+  8030b6:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8030b8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8030bd:	cd 30                	int    $0x30
+  8030bf:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8030c2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  8030c5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  8030c8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8030cc:	0f 84 03 02 00 00    	je     8032d5 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  8030d2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8030d9:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  8030da:	e9 28 01 00 00       	jmp    803207 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  8030df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030e3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030e7:	48 89 c2             	mov    %rax,%rdx
+  8030ea:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8030f1:	ff ff ff 
+  8030f4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030f8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030fc:	83 e0 01             	and    $0x1,%eax
+  8030ff:	48 85 c0             	test   %rax,%rax
+  803102:	0f 84 f7 00 00 00    	je     8031ff <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803108:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80310c:	48 c1 e8 15          	shr    $0x15,%rax
+  803110:	48 89 c2             	mov    %rax,%rdx
+  803113:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80311a:	ff ff ff 
+  80311d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803121:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803125:	25 81 00 00 00       	and    $0x81,%eax
+  80312a:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  803130:	75 29                	jne    80315b <ufork+0xe5>
+					duphuge(child_envid, addr);
+  803132:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803136:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803139:	48 89 d6             	mov    %rdx,%rsi
+  80313c:	89 c7                	mov    %eax,%edi
+  80313e:	48 b8 da 9e ff ff ff 	movabs $0xffffffffffff9eda,%rax
+  803145:	ff ff ff 
+  803148:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80314c:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  80314e:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803155:	00 
+  803156:	e9 ac 00 00 00       	jmp    803207 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  80315b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80315f:	48 c1 e8 15          	shr    $0x15,%rax
+  803163:	48 89 c2             	mov    %rax,%rdx
+  803166:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80316d:	ff ff ff 
+  803170:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803174:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803178:	83 e0 01             	and    $0x1,%eax
+  80317b:	48 85 c0             	test   %rax,%rax
+  80317e:	74 75                	je     8031f5 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  803180:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803184:	48 c1 e8 0c          	shr    $0xc,%rax
+  803188:	48 89 c2             	mov    %rax,%rdx
+  80318b:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803192:	ff ff ff 
+  803195:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803199:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80319d:	83 e0 01             	and    $0x1,%eax
+  8031a0:	48 85 c0             	test   %rax,%rax
+  8031a3:	74 46                	je     8031eb <ufork+0x175>
+  8031a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031a9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031ad:	48 89 c2             	mov    %rax,%rdx
+  8031b0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8031b7:	ff ff ff 
+  8031ba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031be:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031c2:	83 e0 04             	and    $0x4,%eax
+  8031c5:	48 85 c0             	test   %rax,%rax
+  8031c8:	74 21                	je     8031eb <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  8031ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031ce:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031d2:	89 c2                	mov    %eax,%edx
+  8031d4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8031d7:	89 d6                	mov    %edx,%esi
+  8031d9:	89 c7                	mov    %eax,%edi
+  8031db:	48 b8 97 9d ff ff ff 	movabs $0xffffffffffff9d97,%rax
+  8031e2:	ff ff ff 
+  8031e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031e9:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  8031eb:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8031f2:	00 
+  8031f3:	eb 12                	jmp    803207 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  8031f5:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8031fc:	00 
+  8031fd:	eb 08                	jmp    803207 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  8031ff:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803206:	40 
+		for (; addr < USTACKTOP;){
+  803207:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80320c:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  803210:	0f 83 c9 fe ff ff    	jae    8030df <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803216:	48 b8 fe 9b ff ff ff 	movabs $0xffffffffffff9bfe,%rax
+  80321d:	ff ff ff 
+  803220:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803224:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803226:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803229:	ba 07 00 00 00       	mov    $0x7,%edx
+  80322e:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  803233:	48 89 ce             	mov    %rcx,%rsi
+  803236:	89 c7                	mov    %eax,%edi
+  803238:	49 89 df             	mov    %rbx,%r15
+  80323b:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  803242:	ff ff ff 
+  803245:	48 01 d8             	add    %rbx,%rax
+  803248:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  80324a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80324d:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803254:	ff ff ff 
+  803257:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80325b:	48 89 d6             	mov    %rdx,%rsi
+  80325e:	89 c7                	mov    %eax,%edi
+  803260:	49 89 df             	mov    %rbx,%r15
+  803263:	48 b8 15 92 ff ff ff 	movabs $0xffffffffffff9215,%rax
+  80326a:	ff ff ff 
+  80326d:	48 01 d8             	add    %rbx,%rax
+  803270:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  803272:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803275:	be 02 00 00 00       	mov    $0x2,%esi
+  80327a:	89 c7                	mov    %eax,%edi
+  80327c:	49 89 df             	mov    %rbx,%r15
+  80327f:	48 b8 56 91 ff ff ff 	movabs $0xffffffffffff9156,%rax
+  803286:	ff ff ff 
+  803289:	48 01 d8             	add    %rbx,%rax
+  80328c:	ff d0                	call   *%rax
+  80328e:	85 c0                	test   %eax,%eax
+  803290:	74 3e                	je     8032d0 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803292:	48 b8 7f e3 ff ff ff 	movabs $0xffffffffffffe37f,%rax
+  803299:	ff ff ff 
+  80329c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032a0:	48 89 c2             	mov    %rax,%rdx
+  8032a3:	be 07 01 00 00       	mov    $0x107,%esi
+  8032a8:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  8032af:	ff ff ff 
+  8032b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032b6:	48 89 c7             	mov    %rax,%rdi
+  8032b9:	49 89 df             	mov    %rbx,%r15
+  8032bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c1:	48 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%rcx
+  8032c8:	ff ff ff 
+  8032cb:	48 01 d9             	add    %rbx,%rcx
+  8032ce:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  8032d0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032d3:	eb 59                	jmp    80332e <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8032d5:	49 89 df             	mov    %rbx,%r15
+  8032d8:	48 b8 76 8f ff ff ff 	movabs $0xffffffffffff8f76,%rax
+  8032df:	ff ff ff 
+  8032e2:	48 01 d8             	add    %rbx,%rax
+  8032e5:	ff d0                	call   *%rax
+  8032e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032ec:	48 98                	cltq
+  8032ee:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8032f5:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8032fc:	ff ff ff 
+  8032ff:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803303:	48 01 c2             	add    %rax,%rdx
+  803306:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80330d:	ff ff ff 
+  803310:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803314:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803317:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80331e:	00 00 00 
+  803321:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803328:	00 
+		return 0;
+  803329:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  80332e:	48 83 c4 10          	add    $0x10,%rsp
+  803332:	5b                   	pop    %rbx
+  803333:	41 5f                	pop    %r15
+  803335:	5d                   	pop    %rbp
+  803336:	c3                   	ret
+
+0000000000803337 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803337:	55                   	push   %rbp
+  803338:	48 89 e5             	mov    %rsp,%rbp
+  80333b:	41 57                	push   %r15
+  80333d:	48 83 ec 08          	sub    $0x8,%rsp
+  803341:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803341 <sfork+0xa>
+  803348:	49 bb ff 5c 00 00 00 	movabs $0x5cff,%r11
+  80334f:	00 00 00 
+  803352:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803355:	48 b8 9a e3 ff ff ff 	movabs $0xffffffffffffe39a,%rax
+  80335c:	ff ff ff 
+  80335f:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803363:	48 89 c2             	mov    %rax,%rdx
+  803366:	be 1a 01 00 00       	mov    $0x11a,%esi
+  80336b:	48 b8 d0 e2 ff ff ff 	movabs $0xffffffffffffe2d0,%rax
+  803372:	ff ff ff 
+  803375:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803379:	48 89 c7             	mov    %rax,%rdi
+  80337c:	49 89 cf             	mov    %rcx,%r15
+  80337f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803384:	49 b8 29 da ff ff ff 	movabs $0xffffffffffffda29,%r8
+  80338b:	ff ff ff 
+  80338e:	49 01 c8             	add    %rcx,%r8
+  803391:	41 ff d0             	call   *%r8
+
+0000000000803394 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803394:	55                   	push   %rbp
+  803395:	48 89 e5             	mov    %rsp,%rbp
+  803398:	41 57                	push   %r15
+  80339a:	53                   	push   %rbx
+  80339b:	48 83 ec 30          	sub    $0x30,%rsp
+  80339f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80339f <ipc_recv+0xb>
+  8033a6:	49 bb a1 5c 00 00 00 	movabs $0x5ca1,%r11
+  8033ad:	00 00 00 
+  8033b0:	4c 01 db             	add    %r11,%rbx
+  8033b3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8033b7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8033bb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8033bf:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8033c4:	75 0e                	jne    8033d4 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8033c6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8033cd:	00 00 00 
+  8033d0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8033d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033d8:	48 89 c7             	mov    %rax,%rdi
+  8033db:	49 89 df             	mov    %rbx,%r15
+  8033de:	48 b8 48 93 ff ff ff 	movabs $0xffffffffffff9348,%rax
+  8033e5:	ff ff ff 
+  8033e8:	48 01 d8             	add    %rbx,%rax
+  8033eb:	ff d0                	call   *%rax
+  8033ed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8033f0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8033f5:	74 2a                	je     803421 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8033f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8033fb:	75 19                	jne    803416 <ipc_recv+0x82>
+  8033fd:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803404:	ff ff ff 
+  803407:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80340b:	48 8b 00             	mov    (%rax),%rax
+  80340e:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803414:	eb 05                	jmp    80341b <ipc_recv+0x87>
+  803416:	b8 00 00 00 00       	mov    $0x0,%eax
+  80341b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80341f:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  803421:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803426:	74 2a                	je     803452 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  803428:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80342c:	75 19                	jne    803447 <ipc_recv+0xb3>
+  80342e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803435:	ff ff ff 
+  803438:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80343c:	48 8b 00             	mov    (%rax),%rax
+  80343f:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803445:	eb 05                	jmp    80344c <ipc_recv+0xb8>
+  803447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803450:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  803452:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803456:	74 05                	je     80345d <ipc_recv+0xc9>
+		return res;
+  803458:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80345b:	eb 17                	jmp    803474 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  80345d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803464:	ff ff ff 
+  803467:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80346b:	48 8b 00             	mov    (%rax),%rax
+  80346e:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803474:	48 83 c4 30          	add    $0x30,%rsp
+  803478:	5b                   	pop    %rbx
+  803479:	41 5f                	pop    %r15
+  80347b:	5d                   	pop    %rbp
+  80347c:	c3                   	ret
+
+000000000080347d <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80347d:	55                   	push   %rbp
+  80347e:	48 89 e5             	mov    %rsp,%rbp
+  803481:	41 57                	push   %r15
+  803483:	53                   	push   %rbx
+  803484:	48 83 ec 20          	sub    $0x20,%rsp
+  803488:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803488 <ipc_send+0xb>
+  80348f:	49 bb b8 5b 00 00 00 	movabs $0x5bb8,%r11
+  803496:	00 00 00 
+  803499:	4c 01 db             	add    %r11,%rbx
+  80349c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80349f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8034a2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034a6:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8034a9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8034ae:	75 0e                	jne    8034be <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8034b0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8034b7:	00 00 00 
+  8034ba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8034be:	90                   	nop
+  8034bf:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8034c2:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8034c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034cc:	89 c7                	mov    %eax,%edi
+  8034ce:	49 89 df             	mov    %rbx,%r15
+  8034d1:	48 b8 de 92 ff ff ff 	movabs $0xffffffffffff92de,%rax
+  8034d8:	ff ff ff 
+  8034db:	48 01 d8             	add    %rbx,%rax
+  8034de:	ff d0                	call   *%rax
+  8034e0:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8034e3:	74 da                	je     8034bf <ipc_send+0x42>
+		;
+}
+  8034e5:	90                   	nop
+  8034e6:	90                   	nop
+  8034e7:	48 83 c4 20          	add    $0x20,%rsp
+  8034eb:	5b                   	pop    %rbx
+  8034ec:	41 5f                	pop    %r15
+  8034ee:	5d                   	pop    %rbp
+  8034ef:	c3                   	ret
+
+00000000008034f0 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8034f0:	55                   	push   %rbp
+  8034f1:	48 89 e5             	mov    %rsp,%rbp
+  8034f4:	41 57                	push   %r15
+  8034f6:	53                   	push   %rbx
+  8034f7:	48 83 ec 40          	sub    $0x40,%rsp
+  8034fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8034fb <ipc_call+0xb>
+  803502:	49 bb 45 5b 00 00 00 	movabs $0x5b45,%r11
+  803509:	00 00 00 
+  80350c:	4c 01 db             	add    %r11,%rbx
+  80350f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803512:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803515:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803519:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80351c:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803520:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803524:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803529:	75 0e                	jne    803539 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  80352b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803532:	00 00 00 
+  803535:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803539:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80353e:	75 0e                	jne    80354e <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803540:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803547:	00 00 00 
+  80354a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80354e:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803551:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803555:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803558:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80355c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80355f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803565:	49 89 f8             	mov    %rdi,%r8
+  803568:	89 c7                	mov    %eax,%edi
+  80356a:	49 89 df             	mov    %rbx,%r15
+  80356d:	48 b8 a1 93 ff ff ff 	movabs $0xffffffffffff93a1,%rax
+  803574:	ff ff ff 
+  803577:	48 01 d8             	add    %rbx,%rax
+  80357a:	ff d0                	call   *%rax
+  80357c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80357f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803584:	74 2a                	je     8035b0 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803586:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80358a:	75 19                	jne    8035a5 <ipc_call+0xb5>
+  80358c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803593:	ff ff ff 
+  803596:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80359a:	48 8b 00             	mov    (%rax),%rax
+  80359d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8035a3:	eb 05                	jmp    8035aa <ipc_call+0xba>
+  8035a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035aa:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8035ae:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8035b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035b4:	74 05                	je     8035bb <ipc_call+0xcb>
+		return r;
+  8035b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035b9:	eb 17                	jmp    8035d2 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8035bb:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8035c2:	ff ff ff 
+  8035c5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035c9:	48 8b 00             	mov    (%rax),%rax
+  8035cc:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8035d2:	48 83 c4 40          	add    $0x40,%rsp
+  8035d6:	5b                   	pop    %rbx
+  8035d7:	41 5f                	pop    %r15
+  8035d9:	5d                   	pop    %rbp
+  8035da:	c3                   	ret
+
+00000000008035db <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8035db:	55                   	push   %rbp
+  8035dc:	48 89 e5             	mov    %rsp,%rbp
+  8035df:	41 57                	push   %r15
+  8035e1:	53                   	push   %rbx
+  8035e2:	48 83 ec 70          	sub    $0x70,%rsp
+  8035e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035e6 <ipc_callw+0xb>
+  8035ed:	49 bb 5a 5a 00 00 00 	movabs $0x5a5a,%r11
+  8035f4:	00 00 00 
+  8035f7:	4c 01 db             	add    %r11,%rbx
+  8035fa:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8035fd:	89 75 98             	mov    %esi,-0x68(%rbp)
+  803600:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  803604:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  803608:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  80360d:	76 0a                	jbe    803619 <ipc_callw+0x3e>
+		return -E_INVAL;
+  80360f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803614:	e9 b7 00 00 00       	jmp    8036d0 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  803619:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80361d:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  803621:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803625:	48 89 ce             	mov    %rcx,%rsi
+  803628:	48 89 c7             	mov    %rax,%rdi
+  80362b:	49 89 df             	mov    %rbx,%r15
+  80362e:	48 b8 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rax
+  803635:	ff ff ff 
+  803638:	48 01 d8             	add    %rbx,%rax
+  80363b:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  80363d:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803644:	00 
+  803645:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803649:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80364d:	48 01 d0             	add    %rdx,%rax
+  803650:	48 83 e8 01          	sub    $0x1,%rax
+  803654:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803658:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80365c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803661:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803665:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803669:	48 29 d0             	sub    %rdx,%rax
+  80366c:	48 c1 e8 03          	shr    $0x3,%rax
+  803670:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  803674:	89 c1                	mov    %eax,%ecx
+  803676:	8b 75 98             	mov    -0x68(%rbp),%esi
+  803679:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  80367d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  803680:	49 89 d1             	mov    %rdx,%r9
+  803683:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  80368a:	00 00 00 
+  80368d:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  803694:	00 00 00 
+  803697:	89 c7                	mov    %eax,%edi
+  803699:	49 89 df             	mov    %rbx,%r15
+  80369c:	48 b8 a1 93 ff ff ff 	movabs $0xffffffffffff93a1,%rax
+  8036a3:	ff ff ff 
+  8036a6:	48 01 d8             	add    %rbx,%rax
+  8036a9:	ff d0                	call   *%rax
+  8036ab:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8036ae:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8036b2:	74 05                	je     8036b9 <ipc_callw+0xde>
+		return r;
+  8036b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8036b7:	eb 17                	jmp    8036d0 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8036b9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8036c0:	ff ff ff 
+  8036c3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036c7:	48 8b 00             	mov    (%rax),%rax
+  8036ca:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8036d0:	48 83 c4 70          	add    $0x70,%rsp
+  8036d4:	5b                   	pop    %rbx
+  8036d5:	41 5f                	pop    %r15
+  8036d7:	5d                   	pop    %rbp
+  8036d8:	c3                   	ret
+
+00000000008036d9 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8036d9:	55                   	push   %rbp
+  8036da:	48 89 e5             	mov    %rsp,%rbp
+  8036dd:	41 57                	push   %r15
+  8036df:	53                   	push   %rbx
+  8036e0:	48 83 ec 40          	sub    $0x40,%rsp
+  8036e4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036e4 <ipc_callv+0xb>
+  8036eb:	49 bb 5c 59 00 00 00 	movabs $0x595c,%r11
+  8036f2:	00 00 00 
+  8036f5:	4c 01 db             	add    %r11,%rbx
+  8036f8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8036fb:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8036fe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803702:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803705:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  803709:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  80370d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803714:	00 00 00 
+  803717:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  80371b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80371f:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  803723:	74 11                	je     803736 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  803725:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803729:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  80372d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803730:	c1 e0 14             	shl    $0x14,%eax
+  803733:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  803736:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  80373a:	74 14                	je     803750 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  80373c:	8b 45 20             	mov    0x20(%rbp),%eax
+  80373f:	83 e8 01             	sub    $0x1,%eax
+  803742:	48 63 d0             	movslq %eax,%rdx
+  803745:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803749:	48 09 d0             	or     %rdx,%rax
+  80374c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  803750:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803753:	c1 e0 10             	shl    $0x10,%eax
+  803756:	0b 45 10             	or     0x10(%rbp),%eax
+  803759:	89 c1                	mov    %eax,%ecx
+  80375b:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80375e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  803762:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  803766:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80376a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80376d:	4d 89 c1             	mov    %r8,%r9
+  803770:	49 89 f8             	mov    %rdi,%r8
+  803773:	89 c7                	mov    %eax,%edi
+  803775:	49 89 df             	mov    %rbx,%r15
+  803778:	48 b8 a1 93 ff ff ff 	movabs $0xffffffffffff93a1,%rax
+  80377f:	ff ff ff 
+  803782:	48 01 d8             	add    %rbx,%rax
+  803785:	ff d0                	call   *%rax
+  803787:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  80378a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80378e:	74 05                	je     803795 <ipc_callv+0xbc>
+		return r;
+  803790:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803793:	eb 17                	jmp    8037ac <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  803795:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80379c:	ff ff ff 
+  80379f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037a3:	48 8b 00             	mov    (%rax),%rax
+  8037a6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8037ac:	48 83 c4 40          	add    $0x40,%rsp
+  8037b0:	5b                   	pop    %rbx
+  8037b1:	41 5f                	pop    %r15
+  8037b3:	5d                   	pop    %rbp
+  8037b4:	c3                   	ret
+
+00000000008037b5 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8037b5:	55                   	push   %rbp
+  8037b6:	48 89 e5             	mov    %rsp,%rbp
+  8037b9:	41 57                	push   %r15
+  8037bb:	53                   	push   %rbx
+  8037bc:	48 83 ec 40          	sub    $0x40,%rsp
+  8037c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037c0 <ipc_reply_recv+0xb>
+  8037c7:	49 bb 80 58 00 00 00 	movabs $0x5880,%r11
+  8037ce:	00 00 00 
+  8037d1:	4c 01 db             	add    %r11,%rbx
+  8037d4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8037d7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8037da:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8037de:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8037e1:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8037e5:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8037e9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8037ee:	75 0e                	jne    8037fe <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  8037f0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8037f7:	00 00 00 
+  8037fa:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8037fe:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803803:	75 0e                	jne    803813 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803805:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80380c:	00 00 00 
+  80380f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803813:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803816:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  80381a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80381e:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803821:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803825:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803828:	4d 89 c1             	mov    %r8,%r9
+  80382b:	49 89 f8             	mov    %rdi,%r8
+  80382e:	89 c7                	mov    %eax,%edi
+  803830:	49 89 df             	mov    %rbx,%r15
+  803833:	48 b8 15 94 ff ff ff 	movabs $0xffffffffffff9415,%rax
+  80383a:	ff ff ff 
+  80383d:	48 01 d8             	add    %rbx,%rax
+  803840:	ff d0                	call   *%rax
+  803842:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  803845:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80384a:	74 2a                	je     803876 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  80384c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803850:	75 19                	jne    80386b <ipc_reply_recv+0xb6>
+  803852:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803859:	ff ff ff 
+  80385c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803860:	48 8b 00             	mov    (%rax),%rax
+  803863:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803869:	eb 05                	jmp    803870 <ipc_reply_recv+0xbb>
+  80386b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803870:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803874:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  803876:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  80387b:	74 2a                	je     8038a7 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80387d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803881:	75 19                	jne    80389c <ipc_reply_recv+0xe7>
+  803883:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80388a:	ff ff ff 
+  80388d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803891:	48 8b 00             	mov    (%rax),%rax
+  803894:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80389a:	eb 05                	jmp    8038a1 <ipc_reply_recv+0xec>
+  80389c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038a1:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  8038a5:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8038a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038ab:	74 05                	je     8038b2 <ipc_reply_recv+0xfd>
+		return r;
+  8038ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038b0:	eb 17                	jmp    8038c9 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8038b2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8038b9:	ff ff ff 
+  8038bc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8038c0:	48 8b 00             	mov    (%rax),%rax
+  8038c3:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8038c9:	48 83 c4 40          	add    $0x40,%rsp
+  8038cd:	5b                   	pop    %rbx
+  8038ce:	41 5f                	pop    %r15
+  8038d0:	5d                   	pop    %rbp
+  8038d1:	c3                   	ret
+
+00000000008038d2 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  8038d2:	55                   	push   %rbp
+  8038d3:	48 89 e5             	mov    %rsp,%rbp
+  8038d6:	41 57                	push   %r15
+  8038d8:	53                   	push   %rbx
+  8038d9:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  8038e0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038e0 <ipc_window_batch+0xe>
+  8038e7:	49 bb 60 57 00 00 00 	movabs $0x5760,%r11
+  8038ee:	00 00 00 
+  8038f1:	4c 01 db             	add    %r11,%rbx
+  8038f4:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  8038fa:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  803901:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803907:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  80390d:	e9 15 01 00 00       	jmp    803a27 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803912:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803918:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80391b:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803922:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803925:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803928:	39 c2                	cmp    %eax,%edx
+  80392a:	0f 4e c2             	cmovle %edx,%eax
+  80392d:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  803930:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803937:	eb 6b                	jmp    8039a4 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803939:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80393c:	48 98                	cltq
+  80393e:	48 c1 e0 05          	shl    $0x5,%rax
+  803942:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803946:	48 01 e8             	add    %rbp,%rax
+  803949:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  80394f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803955:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803958:	c1 e0 0c             	shl    $0xc,%eax
+  80395b:	48 63 d0             	movslq %eax,%rdx
+  80395e:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803965:	48 01 c2             	add    %rax,%rdx
+  803968:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80396b:	48 98                	cltq
+  80396d:	48 c1 e0 05          	shl    $0x5,%rax
+  803971:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803975:	48 01 e8             	add    %rbp,%rax
+  803978:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  80397e:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  803981:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803984:	48 98                	cltq
+  803986:	48 c1 e0 05          	shl    $0x5,%rax
+  80398a:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80398e:	48 01 e8             	add    %rbp,%rax
+  803991:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  803998:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  80399e:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  8039a0:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8039a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039a7:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  8039aa:	7c 8d                	jl     803939 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  8039ac:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8039b3:	74 27                	je     8039dc <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8039b5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8039b8:	48 63 d0             	movslq %eax,%rdx
+  8039bb:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8039c2:	48 89 d6             	mov    %rdx,%rsi
+  8039c5:	48 89 c7             	mov    %rax,%rdi
+  8039c8:	49 89 df             	mov    %rbx,%r15
+  8039cb:	48 b8 b8 96 ff ff ff 	movabs $0xffffffffffff96b8,%rax
+  8039d2:	ff ff ff 
+  8039d5:	48 01 d8             	add    %rbx,%rax
+  8039d8:	ff d0                	call   *%rax
+  8039da:	eb 25                	jmp    803a01 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  8039dc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8039df:	48 63 d0             	movslq %eax,%rdx
+  8039e2:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8039e9:	48 89 d6             	mov    %rdx,%rsi
+  8039ec:	48 89 c7             	mov    %rax,%rdi
+  8039ef:	49 89 df             	mov    %rbx,%r15
+  8039f2:	48 b8 16 97 ff ff ff 	movabs $0xffffffffffff9716,%rax
+  8039f9:	ff ff ff 
+  8039fc:	48 01 d8             	add    %rbx,%rax
+  8039ff:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803a01:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803a04:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803a08:	79 05                	jns    803a0f <ipc_window_batch+0x13d>
+			return r;
+  803a0a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a0d:	eb 2a                	jmp    803a39 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  803a0f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803a12:	c1 e0 0c             	shl    $0xc,%eax
+  803a15:	48 98                	cltq
+  803a17:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  803a1e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803a21:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803a27:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  803a2e:	0f 8f de fe ff ff    	jg     803912 <ipc_window_batch+0x40>
+	}
+	return 0;
+  803a34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a39:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  803a40:	5b                   	pop    %rbx
+  803a41:	41 5f                	pop    %r15
+  803a43:	5d                   	pop    %rbp
+  803a44:	c3                   	ret
+
+0000000000803a45 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803a45:	55                   	push   %rbp
+  803a46:	48 89 e5             	mov    %rsp,%rbp
+  803a49:	48 83 ec 10          	sub    $0x10,%rsp
+  803a4d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a4d <ipc_map_window+0x8>
+  803a54:	49 bb f3 55 00 00 00 	movabs $0x55f3,%r11
+  803a5b:	00 00 00 
+  803a5e:	4c 01 d8             	add    %r11,%rax
+  803a61:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803a65:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803a68:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803a6b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803a6f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803a74:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a79:	49 b8 92 a8 ff ff ff 	movabs $0xffffffffffffa892,%r8
+  803a80:	ff ff ff 
+  803a83:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803a87:	ff d0                	call   *%rax
+}
+  803a89:	c9                   	leave
+  803a8a:	c3                   	ret
+
+0000000000803a8b <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803a8b:	55                   	push   %rbp
+  803a8c:	48 89 e5             	mov    %rsp,%rbp
+  803a8f:	48 83 ec 10          	sub    $0x10,%rsp
+  803a93:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a93 <ipc_unmap_window+0x8>
+  803a9a:	49 bb ad 55 00 00 00 	movabs $0x55ad,%r11
+  803aa1:	00 00 00 
+  803aa4:	4c 01 d8             	add    %r11,%rax
+  803aa7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803aab:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  803aae:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803ab1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803ab5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803aba:	bf 00 00 00 00       	mov    $0x0,%edi
+  803abf:	49 b8 92 a8 ff ff ff 	movabs $0xffffffffffffa892,%r8
+  803ac6:	ff ff ff 
+  803ac9:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803acd:	ff d0                	call   *%rax
+}
+  803acf:	c9                   	leave
+  803ad0:	c3                   	ret
+
+0000000000803ad1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803ad1:	55                   	push   %rbp
+  803ad2:	48 89 e5             	mov    %rsp,%rbp
+  803ad5:	48 83 ec 18          	sub    $0x18,%rsp
+  803ad9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ad9 <ipc_find_env+0x8>
+  803ae0:	49 bb 67 55 00 00 00 	movabs $0x5567,%r11
+  803ae7:	00 00 00 
+  803aea:	4c 01 d8             	add    %r11,%rax
+  803aed:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803af0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803af7:	eb 57                	jmp    803b50 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803af9:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803b00:	ff ff ff 
+  803b03:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803b07:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803b0a:	48 63 d2             	movslq %edx,%rdx
+  803b0d:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803b14:	48 01 ca             	add    %rcx,%rdx
+  803b17:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803b1e:	8b 12                	mov    (%rdx),%edx
+  803b20:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803b23:	75 27                	jne    803b4c <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803b25:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803b2c:	ff ff ff 
+  803b2f:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803b33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b36:	48 98                	cltq
+  803b38:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803b3f:	48 01 d0             	add    %rdx,%rax
+  803b42:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803b48:	8b 00                	mov    (%rax),%eax
+  803b4a:	eb 12                	jmp    803b5e <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803b4c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803b50:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803b57:	7e a0                	jle    803af9 <ipc_find_env+0x28>
+	}
+	return 0;
+  803b59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b5e:	c9                   	leave
+  803b5f:	c3                   	ret
+
+0000000000803b60 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803b60:	55                   	push   %rbp
+  803b61:	48 89 e5             	mov    %rsp,%rbp
+  803b64:	48 83 ec 08          	sub    $0x8,%rsp
+  803b68:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b68 <fd2num+0x8>
+  803b6f:	49 bb d8 54 00 00 00 	movabs $0x54d8,%r11
+  803b76:	00 00 00 
+  803b79:	4c 01 d8             	add    %r11,%rax
+  803b7c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803b80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b84:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803b8b:	ff ff ff 
+  803b8e:	48 01 d0             	add    %rdx,%rax
+  803b91:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803b95:	c9                   	leave
+  803b96:	c3                   	ret
+
+0000000000803b97 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803b97:	55                   	push   %rbp
+  803b98:	48 89 e5             	mov    %rsp,%rbp
+  803b9b:	48 83 ec 08          	sub    $0x8,%rsp
+  803b9f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b9f <fd2data+0x8>
+  803ba6:	49 bb a1 54 00 00 00 	movabs $0x54a1,%r11
+  803bad:	00 00 00 
+  803bb0:	4c 01 d8             	add    %r11,%rax
+  803bb3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803bb7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803bbb:	48 89 d7             	mov    %rdx,%rdi
+  803bbe:	48 ba 20 ab ff ff ff 	movabs $0xffffffffffffab20,%rdx
+  803bc5:	ff ff ff 
+  803bc8:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803bcc:	ff d0                	call   *%rax
+  803bce:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803bd4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803bd8:	c9                   	leave
+  803bd9:	c3                   	ret
+
+0000000000803bda <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803bda:	55                   	push   %rbp
+  803bdb:	48 89 e5             	mov    %rsp,%rbp
+  803bde:	48 83 ec 18          	sub    $0x18,%rsp
+  803be2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803be2 <fd_alloc+0x8>
+  803be9:	49 bb 5e 54 00 00 00 	movabs $0x545e,%r11
+  803bf0:	00 00 00 
+  803bf3:	4c 01 d8             	add    %r11,%rax
+  803bf6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803bfa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803c01:	eb 75                	jmp    803c78 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803c03:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803c06:	48 63 d2             	movslq %edx,%rdx
+  803c09:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803c10:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803c14:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803c18:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c1c:	48 89 d1             	mov    %rdx,%rcx
+  803c1f:	48 c1 e9 15          	shr    $0x15,%rcx
+  803c23:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803c2a:	ff ff ff 
+  803c2d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803c31:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803c35:	83 e2 01             	and    $0x1,%edx
+  803c38:	48 85 d2             	test   %rdx,%rdx
+  803c3b:	74 25                	je     803c62 <fd_alloc+0x88>
+  803c3d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c41:	48 89 d1             	mov    %rdx,%rcx
+  803c44:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803c48:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803c4f:	ff ff ff 
+  803c52:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803c56:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803c5a:	83 e2 01             	and    $0x1,%edx
+  803c5d:	48 85 d2             	test   %rdx,%rdx
+  803c60:	75 12                	jne    803c74 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803c62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c66:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c6a:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c72:	eb 1a                	jmp    803c8e <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803c74:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803c78:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803c7c:	7e 85                	jle    803c03 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803c7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c82:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803c89:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803c8e:	c9                   	leave
+  803c8f:	c3                   	ret
+
+0000000000803c90 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803c90:	55                   	push   %rbp
+  803c91:	48 89 e5             	mov    %rsp,%rbp
+  803c94:	48 83 ec 20          	sub    $0x20,%rsp
+  803c98:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c98 <fd_lookup+0x8>
+  803c9f:	49 bb a8 53 00 00 00 	movabs $0x53a8,%r11
+  803ca6:	00 00 00 
+  803ca9:	4c 01 d8             	add    %r11,%rax
+  803cac:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803caf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803cb3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cb7:	78 06                	js     803cbf <fd_lookup+0x2f>
+  803cb9:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803cbd:	7e 07                	jle    803cc6 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803cbf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803cc4:	eb 73                	jmp    803d39 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803cc6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803cc9:	48 63 d2             	movslq %edx,%rdx
+  803ccc:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803cd3:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803cd7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803cdb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803cdf:	48 89 d1             	mov    %rdx,%rcx
+  803ce2:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ce6:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803ced:	ff ff ff 
+  803cf0:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803cf4:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803cf8:	83 e2 01             	and    $0x1,%edx
+  803cfb:	48 85 d2             	test   %rdx,%rdx
+  803cfe:	74 22                	je     803d22 <fd_lookup+0x92>
+  803d00:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d04:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803d08:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803d0f:	ff ff ff 
+  803d12:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803d16:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d1a:	83 e0 01             	and    $0x1,%eax
+  803d1d:	48 85 c0             	test   %rax,%rax
+  803d20:	75 07                	jne    803d29 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803d22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d27:	eb 10                	jmp    803d39 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803d29:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d2d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d31:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803d34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d39:	c9                   	leave
+  803d3a:	c3                   	ret
+
+0000000000803d3b <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803d3b:	55                   	push   %rbp
+  803d3c:	48 89 e5             	mov    %rsp,%rbp
+  803d3f:	41 57                	push   %r15
+  803d41:	53                   	push   %rbx
+  803d42:	48 83 ec 30          	sub    $0x30,%rsp
+  803d46:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d46 <fd_close+0xb>
+  803d4d:	49 bb fa 52 00 00 00 	movabs $0x52fa,%r11
+  803d54:	00 00 00 
+  803d57:	4c 01 db             	add    %r11,%rbx
+  803d5a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803d5e:	89 f0                	mov    %esi,%eax
+  803d60:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803d63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d67:	48 89 c7             	mov    %rax,%rdi
+  803d6a:	48 b8 20 ab ff ff ff 	movabs $0xffffffffffffab20,%rax
+  803d71:	ff ff ff 
+  803d74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d78:	ff d0                	call   *%rax
+  803d7a:	89 c2                	mov    %eax,%edx
+  803d7c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803d80:	48 89 c6             	mov    %rax,%rsi
+  803d83:	89 d7                	mov    %edx,%edi
+  803d85:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  803d8c:	ff ff ff 
+  803d8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d93:	ff d0                	call   *%rax
+  803d95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d9c:	78 0a                	js     803da8 <fd_close+0x6d>
+	    || fd != fd2)
+  803d9e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803da2:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803da6:	74 12                	je     803dba <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803da8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803dac:	74 05                	je     803db3 <fd_close+0x78>
+  803dae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803db1:	eb 7a                	jmp    803e2d <fd_close+0xf2>
+  803db3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803db8:	eb 73                	jmp    803e2d <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803dba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dbe:	8b 00                	mov    (%rax),%eax
+  803dc0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803dc4:	48 89 d6             	mov    %rdx,%rsi
+  803dc7:	89 c7                	mov    %eax,%edi
+  803dc9:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  803dd0:	ff ff ff 
+  803dd3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dd7:	ff d0                	call   *%rax
+  803dd9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ddc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803de0:	78 2a                	js     803e0c <fd_close+0xd1>
+		if (dev->dev_close)
+  803de2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803de6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803dea:	48 85 c0             	test   %rax,%rax
+  803ded:	74 16                	je     803e05 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803def:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803df3:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803df7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dfb:	48 89 c7             	mov    %rax,%rdi
+  803dfe:	ff d2                	call   *%rdx
+  803e00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e03:	eb 07                	jmp    803e0c <fd_close+0xd1>
+		else
+			r = 0;
+  803e05:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  803e0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e10:	48 89 c6             	mov    %rax,%rsi
+  803e13:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e18:	49 89 df             	mov    %rbx,%r15
+  803e1b:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  803e22:	ff ff ff 
+  803e25:	48 01 d8             	add    %rbx,%rax
+  803e28:	ff d0                	call   *%rax
+	return r;
+  803e2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803e2d:	48 83 c4 30          	add    $0x30,%rsp
+  803e31:	5b                   	pop    %rbx
+  803e32:	41 5f                	pop    %r15
+  803e34:	5d                   	pop    %rbp
+  803e35:	c3                   	ret
+
+0000000000803e36 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803e36:	55                   	push   %rbp
+  803e37:	48 89 e5             	mov    %rsp,%rbp
+  803e3a:	41 57                	push   %r15
+  803e3c:	48 83 ec 28          	sub    $0x28,%rsp
+  803e40:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803e40 <dev_lookup+0xa>
+  803e47:	49 bb 00 52 00 00 00 	movabs $0x5200,%r11
+  803e4e:	00 00 00 
+  803e51:	4c 01 d9             	add    %r11,%rcx
+  803e54:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e57:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803e5b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803e62:	eb 45                	jmp    803ea9 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803e64:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803e6b:	00 00 00 
+  803e6e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e71:	48 98                	cltq
+  803e73:	48 01 ca             	add    %rcx,%rdx
+  803e76:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e7a:	8b 00                	mov    (%rax),%eax
+  803e7c:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803e7f:	75 24                	jne    803ea5 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803e81:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803e88:	00 00 00 
+  803e8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e8e:	48 98                	cltq
+  803e90:	48 01 ca             	add    %rcx,%rdx
+  803e93:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e9b:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea3:	eb 74                	jmp    803f19 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803ea5:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803ea9:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803eb0:	00 00 00 
+  803eb3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803eb6:	48 98                	cltq
+  803eb8:	48 01 ca             	add    %rcx,%rdx
+  803ebb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ebf:	48 85 c0             	test   %rax,%rax
+  803ec2:	75 a0                	jne    803e64 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803ec4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803ecb:	ff ff ff 
+  803ece:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803ed2:	48 8b 00             	mov    (%rax),%rax
+  803ed5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803edb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803ede:	89 c6                	mov    %eax,%esi
+  803ee0:	48 b8 b0 e3 ff ff ff 	movabs $0xffffffffffffe3b0,%rax
+  803ee7:	ff ff ff 
+  803eea:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803eee:	48 89 c7             	mov    %rax,%rdi
+  803ef1:	49 89 cf             	mov    %rcx,%r15
+  803ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef9:	49 b8 a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%r8
+  803f00:	ff ff ff 
+  803f03:	49 01 c8             	add    %rcx,%r8
+  803f06:	41 ff d0             	call   *%r8
+	*dev = 0;
+  803f09:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f0d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  803f14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803f19:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  803f1d:	c9                   	leave
+  803f1e:	c3                   	ret
+
+0000000000803f1f <close>:
+
+int
+close(int fdnum)
+{
+  803f1f:	55                   	push   %rbp
+  803f20:	48 89 e5             	mov    %rsp,%rbp
+  803f23:	53                   	push   %rbx
+  803f24:	48 83 ec 28          	sub    $0x28,%rsp
+  803f28:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f28 <close+0x9>
+  803f2f:	49 bb 18 51 00 00 00 	movabs $0x5118,%r11
+  803f36:	00 00 00 
+  803f39:	4c 01 db             	add    %r11,%rbx
+  803f3c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803f3f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f46:	48 89 d6             	mov    %rdx,%rsi
+  803f49:	89 c7                	mov    %eax,%edi
+  803f4b:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  803f52:	ff ff ff 
+  803f55:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f59:	ff d0                	call   *%rax
+  803f5b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f5e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f62:	79 05                	jns    803f69 <close+0x4a>
+		return r;
+  803f64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f67:	eb 1c                	jmp    803f85 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803f69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f6d:	be 01 00 00 00       	mov    $0x1,%esi
+  803f72:	48 89 c7             	mov    %rax,%rdi
+  803f75:	48 b8 fb ac ff ff ff 	movabs $0xffffffffffffacfb,%rax
+  803f7c:	ff ff ff 
+  803f7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f83:	ff d0                	call   *%rax
+}
+  803f85:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f89:	c9                   	leave
+  803f8a:	c3                   	ret
+
+0000000000803f8b <close_all>:
+
+void
+close_all(void)
+{
+  803f8b:	55                   	push   %rbp
+  803f8c:	48 89 e5             	mov    %rsp,%rbp
+  803f8f:	53                   	push   %rbx
+  803f90:	48 83 ec 18          	sub    $0x18,%rsp
+  803f94:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f94 <close_all+0x9>
+  803f9b:	49 bb ac 50 00 00 00 	movabs $0x50ac,%r11
+  803fa2:	00 00 00 
+  803fa5:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803fa8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803faf:	eb 19                	jmp    803fca <close_all+0x3f>
+		close(i);
+  803fb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fb4:	89 c7                	mov    %eax,%edi
+  803fb6:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  803fbd:	ff ff ff 
+  803fc0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fc4:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803fc6:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803fca:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803fce:	7e e1                	jle    803fb1 <close_all+0x26>
+}
+  803fd0:	90                   	nop
+  803fd1:	90                   	nop
+  803fd2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803fd6:	c9                   	leave
+  803fd7:	c3                   	ret
+
+0000000000803fd8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803fd8:	55                   	push   %rbp
+  803fd9:	48 89 e5             	mov    %rsp,%rbp
+  803fdc:	41 57                	push   %r15
+  803fde:	53                   	push   %rbx
+  803fdf:	48 83 ec 40          	sub    $0x40,%rsp
+  803fe3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fe3 <dup+0xb>
+  803fea:	49 bb 5d 50 00 00 00 	movabs $0x505d,%r11
+  803ff1:	00 00 00 
+  803ff4:	4c 01 db             	add    %r11,%rbx
+  803ff7:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803ffa:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803ffd:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  804001:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804004:	48 89 d6             	mov    %rdx,%rsi
+  804007:	89 c7                	mov    %eax,%edi
+  804009:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  804010:	ff ff ff 
+  804013:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804017:	ff d0                	call   *%rax
+  804019:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80401c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804020:	79 08                	jns    80402a <dup+0x52>
+		return r;
+  804022:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804025:	e9 a4 01 00 00       	jmp    8041ce <dup+0x1f6>
+	close(newfdnum);
+  80402a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80402d:	89 c7                	mov    %eax,%edi
+  80402f:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  804036:	ff ff ff 
+  804039:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80403d:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  80403f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804042:	48 98                	cltq
+  804044:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80404a:	48 c1 e0 0c          	shl    $0xc,%rax
+  80404e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  804052:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804056:	48 89 c7             	mov    %rax,%rdi
+  804059:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  804060:	ff ff ff 
+  804063:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804067:	ff d0                	call   *%rax
+  804069:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  80406d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804071:	48 89 c7             	mov    %rax,%rdi
+  804074:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  80407b:	ff ff ff 
+  80407e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804082:	ff d0                	call   *%rax
+  804084:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  804088:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80408c:	48 c1 e8 15          	shr    $0x15,%rax
+  804090:	48 89 c2             	mov    %rax,%rdx
+  804093:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80409a:	ff ff ff 
+  80409d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8040a1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8040a5:	83 e0 01             	and    $0x1,%eax
+  8040a8:	48 85 c0             	test   %rax,%rax
+  8040ab:	74 7f                	je     80412c <dup+0x154>
+  8040ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040b1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040b5:	48 89 c2             	mov    %rax,%rdx
+  8040b8:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8040bf:	ff ff ff 
+  8040c2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8040c6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8040ca:	83 e0 01             	and    $0x1,%eax
+  8040cd:	48 85 c0             	test   %rax,%rax
+  8040d0:	74 5a                	je     80412c <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8040d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040d6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040da:	48 89 c2             	mov    %rax,%rdx
+  8040dd:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8040e4:	ff ff ff 
+  8040e7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8040eb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8040ef:	25 07 0e 00 00       	and    $0xe07,%eax
+  8040f4:	89 c1                	mov    %eax,%ecx
+  8040f6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040fe:	41 89 c8             	mov    %ecx,%r8d
+  804101:	48 89 d1             	mov    %rdx,%rcx
+  804104:	ba 00 00 00 00       	mov    $0x0,%edx
+  804109:	48 89 c6             	mov    %rax,%rsi
+  80410c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804111:	49 89 df             	mov    %rbx,%r15
+  804114:	48 b8 84 90 ff ff ff 	movabs $0xffffffffffff9084,%rax
+  80411b:	ff ff ff 
+  80411e:	48 01 d8             	add    %rbx,%rax
+  804121:	ff d0                	call   *%rax
+  804123:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804126:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80412a:	78 5f                	js     80418b <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80412c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804130:	48 c1 e8 0c          	shr    $0xc,%rax
+  804134:	48 89 c2             	mov    %rax,%rdx
+  804137:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80413e:	ff ff ff 
+  804141:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804145:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804149:	25 07 0e 00 00       	and    $0xe07,%eax
+  80414e:	89 c1                	mov    %eax,%ecx
+  804150:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804154:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804158:	41 89 c8             	mov    %ecx,%r8d
+  80415b:	48 89 d1             	mov    %rdx,%rcx
+  80415e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804163:	48 89 c6             	mov    %rax,%rsi
+  804166:	bf 00 00 00 00       	mov    $0x0,%edi
+  80416b:	49 89 df             	mov    %rbx,%r15
+  80416e:	48 b8 84 90 ff ff ff 	movabs $0xffffffffffff9084,%rax
+  804175:	ff ff ff 
+  804178:	48 01 d8             	add    %rbx,%rax
+  80417b:	ff d0                	call   *%rax
+  80417d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804180:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804184:	78 08                	js     80418e <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  804186:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804189:	eb 43                	jmp    8041ce <dup+0x1f6>
+			goto err;
+  80418b:	90                   	nop
+  80418c:	eb 01                	jmp    80418f <dup+0x1b7>
+		goto err;
+  80418e:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80418f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804193:	48 89 c6             	mov    %rax,%rsi
+  804196:	bf 00 00 00 00       	mov    $0x0,%edi
+  80419b:	49 89 df             	mov    %rbx,%r15
+  80419e:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  8041a5:	ff ff ff 
+  8041a8:	48 01 d8             	add    %rbx,%rax
+  8041ab:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8041ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8041b1:	48 89 c6             	mov    %rax,%rsi
+  8041b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041b9:	49 89 df             	mov    %rbx,%r15
+  8041bc:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  8041c3:	ff ff ff 
+  8041c6:	48 01 d8             	add    %rbx,%rax
+  8041c9:	ff d0                	call   *%rax
+	return r;
+  8041cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8041ce:	48 83 c4 40          	add    $0x40,%rsp
+  8041d2:	5b                   	pop    %rbx
+  8041d3:	41 5f                	pop    %r15
+  8041d5:	5d                   	pop    %rbp
+  8041d6:	c3                   	ret
+
+00000000008041d7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8041d7:	55                   	push   %rbp
+  8041d8:	48 89 e5             	mov    %rsp,%rbp
+  8041db:	41 57                	push   %r15
+  8041dd:	53                   	push   %rbx
+  8041de:	48 83 ec 40          	sub    $0x40,%rsp
+  8041e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041e2 <read+0xb>
+  8041e9:	49 bb 5e 4e 00 00 00 	movabs $0x4e5e,%r11
+  8041f0:	00 00 00 
+  8041f3:	4c 01 db             	add    %r11,%rbx
+  8041f6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8041f9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8041fd:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804201:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804205:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804208:	48 89 d6             	mov    %rdx,%rsi
+  80420b:	89 c7                	mov    %eax,%edi
+  80420d:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  804214:	ff ff ff 
+  804217:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80421b:	ff d0                	call   *%rax
+  80421d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804220:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804224:	78 28                	js     80424e <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804226:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80422a:	8b 00                	mov    (%rax),%eax
+  80422c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804230:	48 89 d6             	mov    %rdx,%rsi
+  804233:	89 c7                	mov    %eax,%edi
+  804235:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  80423c:	ff ff ff 
+  80423f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804243:	ff d0                	call   *%rax
+  804245:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804248:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80424c:	79 08                	jns    804256 <read+0x7f>
+		return r;
+  80424e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804251:	e9 8b 00 00 00       	jmp    8042e1 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804256:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80425a:	8b 40 08             	mov    0x8(%rax),%eax
+  80425d:	83 e0 03             	and    $0x3,%eax
+  804260:	83 f8 01             	cmp    $0x1,%eax
+  804263:	75 4b                	jne    8042b0 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804265:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80426c:	ff ff ff 
+  80426f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804273:	48 8b 00             	mov    (%rax),%rax
+  804276:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80427c:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80427f:	89 c6                	mov    %eax,%esi
+  804281:	48 b8 cf e3 ff ff ff 	movabs $0xffffffffffffe3cf,%rax
+  804288:	ff ff ff 
+  80428b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80428f:	48 89 c7             	mov    %rax,%rdi
+  804292:	49 89 df             	mov    %rbx,%r15
+  804295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80429a:	48 b9 a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rcx
+  8042a1:	ff ff ff 
+  8042a4:	48 01 d9             	add    %rbx,%rcx
+  8042a7:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8042a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8042ae:	eb 31                	jmp    8042e1 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8042b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042b4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042b8:	48 85 c0             	test   %rax,%rax
+  8042bb:	75 07                	jne    8042c4 <read+0xed>
+		return -E_NOT_SUPP;
+  8042bd:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8042c2:	eb 1d                	jmp    8042e1 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8042c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042c8:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8042cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042d0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8042d4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8042d8:	48 89 ce             	mov    %rcx,%rsi
+  8042db:	48 89 c7             	mov    %rax,%rdi
+  8042de:	41 ff d0             	call   *%r8
+}
+  8042e1:	48 83 c4 40          	add    $0x40,%rsp
+  8042e5:	5b                   	pop    %rbx
+  8042e6:	41 5f                	pop    %r15
+  8042e8:	5d                   	pop    %rbp
+  8042e9:	c3                   	ret
+
+00000000008042ea <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8042ea:	55                   	push   %rbp
+  8042eb:	48 89 e5             	mov    %rsp,%rbp
+  8042ee:	53                   	push   %rbx
+  8042ef:	48 83 ec 38          	sub    $0x38,%rsp
+  8042f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042f3 <readn+0x9>
+  8042fa:	49 bb 4d 4d 00 00 00 	movabs $0x4d4d,%r11
+  804301:	00 00 00 
+  804304:	4c 01 db             	add    %r11,%rbx
+  804307:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80430a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80430e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  804312:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804319:	eb 4b                	jmp    804366 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80431b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80431e:	48 98                	cltq
+  804320:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804324:	48 29 c2             	sub    %rax,%rdx
+  804327:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80432a:	48 63 c8             	movslq %eax,%rcx
+  80432d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804331:	48 01 c1             	add    %rax,%rcx
+  804334:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804337:	48 89 ce             	mov    %rcx,%rsi
+  80433a:	89 c7                	mov    %eax,%edi
+  80433c:	48 b8 97 b1 ff ff ff 	movabs $0xffffffffffffb197,%rax
+  804343:	ff ff ff 
+  804346:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80434a:	ff d0                	call   *%rax
+  80434c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80434f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804353:	79 05                	jns    80435a <readn+0x70>
+			return m;
+  804355:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804358:	eb 1d                	jmp    804377 <readn+0x8d>
+		if (m == 0)
+  80435a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80435e:	74 13                	je     804373 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  804360:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804363:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804366:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804369:	48 98                	cltq
+  80436b:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80436f:	72 aa                	jb     80431b <readn+0x31>
+  804371:	eb 01                	jmp    804374 <readn+0x8a>
+			break;
+  804373:	90                   	nop
+	}
+	return tot;
+  804374:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804377:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80437b:	c9                   	leave
+  80437c:	c3                   	ret
+
+000000000080437d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80437d:	55                   	push   %rbp
+  80437e:	48 89 e5             	mov    %rsp,%rbp
+  804381:	41 57                	push   %r15
+  804383:	53                   	push   %rbx
+  804384:	48 83 ec 40          	sub    $0x40,%rsp
+  804388:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804388 <write+0xb>
+  80438f:	49 bb b8 4c 00 00 00 	movabs $0x4cb8,%r11
+  804396:	00 00 00 
+  804399:	4c 01 db             	add    %r11,%rbx
+  80439c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80439f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8043a3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8043a7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8043ab:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8043ae:	48 89 d6             	mov    %rdx,%rsi
+  8043b1:	89 c7                	mov    %eax,%edi
+  8043b3:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  8043ba:	ff ff ff 
+  8043bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043c1:	ff d0                	call   *%rax
+  8043c3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043ca:	78 28                	js     8043f4 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8043cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043d0:	8b 00                	mov    (%rax),%eax
+  8043d2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8043d6:	48 89 d6             	mov    %rdx,%rsi
+  8043d9:	89 c7                	mov    %eax,%edi
+  8043db:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  8043e2:	ff ff ff 
+  8043e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043e9:	ff d0                	call   *%rax
+  8043eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043f2:	79 08                	jns    8043fc <write+0x7f>
+		return r;
+  8043f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043f7:	e9 8a 00 00 00       	jmp    804486 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8043fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804400:	8b 40 08             	mov    0x8(%rax),%eax
+  804403:	83 e0 03             	and    $0x3,%eax
+  804406:	85 c0                	test   %eax,%eax
+  804408:	75 4b                	jne    804455 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80440a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804411:	ff ff ff 
+  804414:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804418:	48 8b 00             	mov    (%rax),%rax
+  80441b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804421:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804424:	89 c6                	mov    %eax,%esi
+  804426:	48 b8 eb e3 ff ff ff 	movabs $0xffffffffffffe3eb,%rax
+  80442d:	ff ff ff 
+  804430:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804434:	48 89 c7             	mov    %rax,%rdi
+  804437:	49 89 df             	mov    %rbx,%r15
+  80443a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443f:	48 b9 a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rcx
+  804446:	ff ff ff 
+  804449:	48 01 d9             	add    %rbx,%rcx
+  80444c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80444e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804453:	eb 31                	jmp    804486 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  804455:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804459:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80445d:	48 85 c0             	test   %rax,%rax
+  804460:	75 07                	jne    804469 <write+0xec>
+		return -E_NOT_SUPP;
+  804462:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804467:	eb 1d                	jmp    804486 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  804469:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80446d:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  804471:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804475:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804479:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80447d:	48 89 ce             	mov    %rcx,%rsi
+  804480:	48 89 c7             	mov    %rax,%rdi
+  804483:	41 ff d0             	call   *%r8
+}
+  804486:	48 83 c4 40          	add    $0x40,%rsp
+  80448a:	5b                   	pop    %rbx
+  80448b:	41 5f                	pop    %r15
+  80448d:	5d                   	pop    %rbp
+  80448e:	c3                   	ret
+
+000000000080448f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80448f:	55                   	push   %rbp
+  804490:	48 89 e5             	mov    %rsp,%rbp
+  804493:	48 83 ec 18          	sub    $0x18,%rsp
+  804497:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804497 <seek+0x8>
+  80449e:	49 bb a9 4b 00 00 00 	movabs $0x4ba9,%r11
+  8044a5:	00 00 00 
+  8044a8:	4c 01 d8             	add    %r11,%rax
+  8044ab:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8044ae:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8044b1:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8044b5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8044b8:	48 89 ce             	mov    %rcx,%rsi
+  8044bb:	89 d7                	mov    %edx,%edi
+  8044bd:	48 ba 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rdx
+  8044c4:	ff ff ff 
+  8044c7:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8044cb:	ff d0                	call   *%rax
+  8044cd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044d0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044d4:	79 05                	jns    8044db <seek+0x4c>
+		return r;
+  8044d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044d9:	eb 0f                	jmp    8044ea <seek+0x5b>
+	fd->fd_offset = offset;
+  8044db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044df:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8044e2:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8044e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044ea:	c9                   	leave
+  8044eb:	c3                   	ret
+
+00000000008044ec <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8044ec:	55                   	push   %rbp
+  8044ed:	48 89 e5             	mov    %rsp,%rbp
+  8044f0:	41 57                	push   %r15
+  8044f2:	53                   	push   %rbx
+  8044f3:	48 83 ec 30          	sub    $0x30,%rsp
+  8044f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044f7 <ftruncate+0xb>
+  8044fe:	49 bb 49 4b 00 00 00 	movabs $0x4b49,%r11
+  804505:	00 00 00 
+  804508:	4c 01 db             	add    %r11,%rbx
+  80450b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80450e:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804511:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804515:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804518:	48 89 d6             	mov    %rdx,%rsi
+  80451b:	89 c7                	mov    %eax,%edi
+  80451d:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  804524:	ff ff ff 
+  804527:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80452b:	ff d0                	call   *%rax
+  80452d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804530:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804534:	78 28                	js     80455e <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804536:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80453a:	8b 00                	mov    (%rax),%eax
+  80453c:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804540:	48 89 d6             	mov    %rdx,%rsi
+  804543:	89 c7                	mov    %eax,%edi
+  804545:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  80454c:	ff ff ff 
+  80454f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804553:	ff d0                	call   *%rax
+  804555:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804558:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80455c:	79 08                	jns    804566 <ftruncate+0x7a>
+		return r;
+  80455e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804561:	e9 83 00 00 00       	jmp    8045e9 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804566:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80456a:	8b 40 08             	mov    0x8(%rax),%eax
+  80456d:	83 e0 03             	and    $0x3,%eax
+  804570:	85 c0                	test   %eax,%eax
+  804572:	75 4b                	jne    8045bf <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804574:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80457b:	ff ff ff 
+  80457e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804582:	48 8b 00             	mov    (%rax),%rax
+  804585:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80458b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80458e:	89 c6                	mov    %eax,%esi
+  804590:	48 b8 08 e4 ff ff ff 	movabs $0xffffffffffffe408,%rax
+  804597:	ff ff ff 
+  80459a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80459e:	48 89 c7             	mov    %rax,%rdi
+  8045a1:	49 89 df             	mov    %rbx,%r15
+  8045a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a9:	48 b9 a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rcx
+  8045b0:	ff ff ff 
+  8045b3:	48 01 d9             	add    %rbx,%rcx
+  8045b6:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8045b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045bd:	eb 2a                	jmp    8045e9 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8045bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045c3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8045c7:	48 85 c0             	test   %rax,%rax
+  8045ca:	75 07                	jne    8045d3 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8045cc:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8045d1:	eb 16                	jmp    8045e9 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8045d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045d7:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8045db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045df:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8045e2:	89 d6                	mov    %edx,%esi
+  8045e4:	48 89 c7             	mov    %rax,%rdi
+  8045e7:	ff d1                	call   *%rcx
+}
+  8045e9:	48 83 c4 30          	add    $0x30,%rsp
+  8045ed:	5b                   	pop    %rbx
+  8045ee:	41 5f                	pop    %r15
+  8045f0:	5d                   	pop    %rbp
+  8045f1:	c3                   	ret
+
+00000000008045f2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8045f2:	55                   	push   %rbp
+  8045f3:	48 89 e5             	mov    %rsp,%rbp
+  8045f6:	53                   	push   %rbx
+  8045f7:	48 83 ec 38          	sub    $0x38,%rsp
+  8045fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045fb <fstat+0x9>
+  804602:	49 bb 45 4a 00 00 00 	movabs $0x4a45,%r11
+  804609:	00 00 00 
+  80460c:	4c 01 db             	add    %r11,%rbx
+  80460f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804612:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804616:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80461a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80461d:	48 89 d6             	mov    %rdx,%rsi
+  804620:	89 c7                	mov    %eax,%edi
+  804622:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  804629:	ff ff ff 
+  80462c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804630:	ff d0                	call   *%rax
+  804632:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804635:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804639:	78 28                	js     804663 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80463b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80463f:	8b 00                	mov    (%rax),%eax
+  804641:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804645:	48 89 d6             	mov    %rdx,%rsi
+  804648:	89 c7                	mov    %eax,%edi
+  80464a:	48 b8 f6 ad ff ff ff 	movabs $0xffffffffffffadf6,%rax
+  804651:	ff ff ff 
+  804654:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804658:	ff d0                	call   *%rax
+  80465a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80465d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804661:	79 05                	jns    804668 <fstat+0x76>
+		return r;
+  804663:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804666:	eb 5e                	jmp    8046c6 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804668:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80466c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804670:	48 85 c0             	test   %rax,%rax
+  804673:	75 07                	jne    80467c <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804675:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80467a:	eb 4a                	jmp    8046c6 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80467c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804680:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804683:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804687:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80468e:	00 00 00 
+	stat->st_isdir = 0;
+  804691:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804695:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80469c:	00 00 00 
+	stat->st_dev = dev;
+  80469f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8046a3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046a7:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8046ae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046b2:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8046b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8046be:	48 89 d6             	mov    %rdx,%rsi
+  8046c1:	48 89 c7             	mov    %rax,%rdi
+  8046c4:	ff d1                	call   *%rcx
+}
+  8046c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8046ca:	c9                   	leave
+  8046cb:	c3                   	ret
+
+00000000008046cc <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8046cc:	55                   	push   %rbp
+  8046cd:	48 89 e5             	mov    %rsp,%rbp
+  8046d0:	41 57                	push   %r15
+  8046d2:	53                   	push   %rbx
+  8046d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8046d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046d7 <stat+0xb>
+  8046de:	49 bb 69 49 00 00 00 	movabs $0x4969,%r11
+  8046e5:	00 00 00 
+  8046e8:	4c 01 db             	add    %r11,%rbx
+  8046eb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8046ef:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8046f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8046fc:	48 89 c7             	mov    %rax,%rdi
+  8046ff:	49 89 df             	mov    %rbx,%r15
+  804702:	48 b8 66 b9 ff ff ff 	movabs $0xffffffffffffb966,%rax
+  804709:	ff ff ff 
+  80470c:	48 01 d8             	add    %rbx,%rax
+  80470f:	ff d0                	call   *%rax
+  804711:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804714:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804718:	79 05                	jns    80471f <stat+0x53>
+		return fd;
+  80471a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80471d:	eb 37                	jmp    804756 <stat+0x8a>
+	r = fstat(fd, stat);
+  80471f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804723:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804726:	48 89 d6             	mov    %rdx,%rsi
+  804729:	89 c7                	mov    %eax,%edi
+  80472b:	48 b8 b2 b5 ff ff ff 	movabs $0xffffffffffffb5b2,%rax
+  804732:	ff ff ff 
+  804735:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804739:	ff d0                	call   *%rax
+  80473b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80473e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804741:	89 c7                	mov    %eax,%edi
+  804743:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  80474a:	ff ff ff 
+  80474d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804751:	ff d0                	call   *%rax
+	return r;
+  804753:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804756:	48 83 c4 20          	add    $0x20,%rsp
+  80475a:	5b                   	pop    %rbx
+  80475b:	41 5f                	pop    %r15
+  80475d:	5d                   	pop    %rbp
+  80475e:	c3                   	ret
+
+000000000080475f <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80475f:	55                   	push   %rbp
+  804760:	48 89 e5             	mov    %rsp,%rbp
+  804763:	41 57                	push   %r15
+  804765:	53                   	push   %rbx
+  804766:	48 83 ec 10          	sub    $0x10,%rsp
+  80476a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80476a <fsipc+0xb>
+  804771:	49 bb d6 48 00 00 00 	movabs $0x48d6,%r11
+  804778:	00 00 00 
+  80477b:	4c 01 db             	add    %r11,%rbx
+  80477e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804781:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804785:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80478c:	00 00 00 
+  80478f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804792:	85 c0                	test   %eax,%eax
+  804794:	75 24                	jne    8047ba <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804796:	bf 01 00 00 00       	mov    $0x1,%edi
+  80479b:	49 89 df             	mov    %rbx,%r15
+  80479e:	48 b8 91 aa ff ff ff 	movabs $0xffffffffffffaa91,%rax
+  8047a5:	ff ff ff 
+  8047a8:	48 01 d8             	add    %rbx,%rax
+  8047ab:	ff d0                	call   *%rax
+  8047ad:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8047b4:	00 00 00 
+  8047b7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8047ba:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8047c1:	00 00 00 
+  8047c4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8047c7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8047cb:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8047ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8047d4:	49 89 d0             	mov    %rdx,%r8
+  8047d7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8047dc:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8047e3:	00 00 00 
+  8047e6:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8047ea:	89 c7                	mov    %eax,%edi
+  8047ec:	49 89 df             	mov    %rbx,%r15
+  8047ef:	48 b8 b0 a4 ff ff ff 	movabs $0xffffffffffffa4b0,%rax
+  8047f6:	ff ff ff 
+  8047f9:	48 01 d8             	add    %rbx,%rax
+  8047fc:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8047fe:	48 83 c4 10          	add    $0x10,%rsp
+  804802:	5b                   	pop    %rbx
+  804803:	41 5f                	pop    %r15
+  804805:	5d                   	pop    %rbp
+  804806:	c3                   	ret
+
+0000000000804807 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804807:	55                   	push   %rbp
+  804808:	48 89 e5             	mov    %rsp,%rbp
+  80480b:	41 57                	push   %r15
+  80480d:	53                   	push   %rbx
+  80480e:	48 83 ec 20          	sub    $0x20,%rsp
+  804812:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804812 <fsipc_words+0xb>
+  804819:	49 bb 2e 48 00 00 00 	movabs $0x482e,%r11
+  804820:	00 00 00 
+  804823:	4c 01 db             	add    %r11,%rbx
+  804826:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804829:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80482d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804831:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804838:	00 00 00 
+  80483b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80483e:	85 c0                	test   %eax,%eax
+  804840:	75 24                	jne    804866 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804842:	bf 01 00 00 00       	mov    $0x1,%edi
+  804847:	49 89 df             	mov    %rbx,%r15
+  80484a:	48 b8 91 aa ff ff ff 	movabs $0xffffffffffffaa91,%rax
+  804851:	ff ff ff 
+  804854:	48 01 d8             	add    %rbx,%rax
+  804857:	ff d0                	call   *%rax
+  804859:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804860:	00 00 00 
+  804863:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804866:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80486d:	00 00 00 
+  804870:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804873:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804877:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80487b:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80487e:	89 c7                	mov    %eax,%edi
+  804880:	49 89 df             	mov    %rbx,%r15
+  804883:	48 b8 9b a5 ff ff ff 	movabs $0xffffffffffffa59b,%rax
+  80488a:	ff ff ff 
+  80488d:	48 01 d8             	add    %rbx,%rax
+  804890:	ff d0                	call   *%rax
+}
+  804892:	48 83 c4 20          	add    $0x20,%rsp
+  804896:	5b                   	pop    %rbx
+  804897:	41 5f                	pop    %r15
+  804899:	5d                   	pop    %rbp
+  80489a:	c3                   	ret
+
+000000000080489b <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  80489b:	55                   	push   %rbp
+  80489c:	48 89 e5             	mov    %rsp,%rbp
+  80489f:	41 57                	push   %r15
+  8048a1:	53                   	push   %rbx
+  8048a2:	48 83 ec 40          	sub    $0x40,%rsp
+  8048a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048a6 <fsipc_pages+0xb>
+  8048ad:	49 bb 9a 47 00 00 00 	movabs $0x479a,%r11
+  8048b4:	00 00 00 
+  8048b7:	4c 01 db             	add    %r11,%rbx
+  8048ba:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8048bd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8048c1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8048c5:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8048c8:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8048cf:	00 00 00 
+  8048d2:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8048d5:	85 c0                	test   %eax,%eax
+  8048d7:	75 24                	jne    8048fd <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8048d9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8048de:	49 89 df             	mov    %rbx,%r15
+  8048e1:	48 b8 91 aa ff ff ff 	movabs $0xffffffffffffaa91,%rax
+  8048e8:	ff ff ff 
+  8048eb:	48 01 d8             	add    %rbx,%rax
+  8048ee:	ff d0                	call   *%rax
+  8048f0:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8048f7:	00 00 00 
+  8048fa:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8048fd:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804902:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804906:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804909:	48 98                	cltq
+  80490b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80490f:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804913:	0f 95 c0             	setne  %al
+  804916:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804919:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804920:	00 
+  804921:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804925:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804929:	48 01 d0             	add    %rdx,%rax
+  80492c:	48 83 e8 01          	sub    $0x1,%rax
+  804930:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804934:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804938:	ba 00 00 00 00       	mov    $0x0,%edx
+  80493d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804941:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804945:	48 29 d0             	sub    %rdx,%rax
+  804948:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  80494c:	41 89 c2             	mov    %eax,%r10d
+  80494f:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804956:	00 00 00 
+  804959:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80495c:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804960:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804964:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804967:	48 83 ec 08          	sub    $0x8,%rsp
+  80496b:	6a 40                	push   $0x40
+  80496d:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804972:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804979:	00 
+  80497a:	6a 05                	push   $0x5
+  80497c:	41 89 f9             	mov    %edi,%r9d
+  80497f:	49 89 c8             	mov    %rcx,%r8
+  804982:	44 89 d1             	mov    %r10d,%ecx
+  804985:	89 c7                	mov    %eax,%edi
+  804987:	49 89 df             	mov    %rbx,%r15
+  80498a:	48 b8 99 a6 ff ff ff 	movabs $0xffffffffffffa699,%rax
+  804991:	ff ff ff 
+  804994:	48 01 d8             	add    %rbx,%rax
+  804997:	ff d0                	call   *%rax
+  804999:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80499d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8049a1:	5b                   	pop    %rbx
+  8049a2:	41 5f                	pop    %r15
+  8049a4:	5d                   	pop    %rbp
+  8049a5:	c3                   	ret
+
+00000000008049a6 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  8049a6:	55                   	push   %rbp
+  8049a7:	48 89 e5             	mov    %rsp,%rbp
+  8049aa:	41 57                	push   %r15
+  8049ac:	53                   	push   %rbx
+  8049ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8049b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049b1 <open+0xb>
+  8049b8:	49 bb 8f 46 00 00 00 	movabs $0x468f,%r11
+  8049bf:	00 00 00 
+  8049c2:	4c 01 db             	add    %r11,%rbx
+  8049c5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8049c9:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8049cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049d0:	48 89 c7             	mov    %rax,%rdi
+  8049d3:	49 89 df             	mov    %rbx,%r15
+  8049d6:	48 b8 cf 82 ff ff ff 	movabs $0xffffffffffff82cf,%rax
+  8049dd:	ff ff ff 
+  8049e0:	48 01 d8             	add    %rbx,%rax
+  8049e3:	ff d0                	call   *%rax
+  8049e5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8049ea:	7e 0a                	jle    8049f6 <open+0x50>
+		return -E_BAD_PATH;
+  8049ec:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8049f1:	e9 18 01 00 00       	jmp    804b0e <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8049f6:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8049fa:	48 89 c7             	mov    %rax,%rdi
+  8049fd:	49 89 df             	mov    %rbx,%r15
+  804a00:	48 b8 9a ab ff ff ff 	movabs $0xffffffffffffab9a,%rax
+  804a07:	ff ff ff 
+  804a0a:	48 01 d8             	add    %rbx,%rax
+  804a0d:	ff d0                	call   *%rax
+  804a0f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a12:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a16:	74 08                	je     804a20 <open+0x7a>
+		return r;
+  804a18:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a1b:	e9 ee 00 00 00       	jmp    804b0e <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804a20:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804a27:	00 00 00 
+  804a2a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804a2d:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804a34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a38:	48 89 c6             	mov    %rax,%rsi
+  804a3b:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804a42:	00 00 00 
+  804a45:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a49:	48 89 c7             	mov    %rax,%rdi
+  804a4c:	49 89 df             	mov    %rbx,%r15
+  804a4f:	48 b8 63 83 ff ff ff 	movabs $0xffffffffffff8363,%rax
+  804a56:	ff ff ff 
+  804a59:	48 01 d8             	add    %rbx,%rax
+  804a5c:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804a5e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a62:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804a67:	48 89 c6             	mov    %rax,%rsi
+  804a6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a6f:	49 89 df             	mov    %rbx,%r15
+  804a72:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  804a79:	ff ff ff 
+  804a7c:	48 01 d8             	add    %rbx,%rax
+  804a7f:	ff d0                	call   *%rax
+  804a81:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a84:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a88:	74 23                	je     804aad <open+0x107>
+		fd_close(fd,0);
+  804a8a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a8e:	be 00 00 00 00       	mov    $0x0,%esi
+  804a93:	48 89 c7             	mov    %rax,%rdi
+  804a96:	49 89 df             	mov    %rbx,%r15
+  804a99:	48 b8 fb ac ff ff ff 	movabs $0xffffffffffffacfb,%rax
+  804aa0:	ff ff ff 
+  804aa3:	48 01 d8             	add    %rbx,%rax
+  804aa6:	ff d0                	call   *%rax
+		return r;
+  804aa8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aab:	eb 61                	jmp    804b0e <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804aad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ab1:	48 89 c6             	mov    %rax,%rsi
+  804ab4:	bf 01 00 00 00       	mov    $0x1,%edi
+  804ab9:	48 b8 1f b7 ff ff ff 	movabs $0xffffffffffffb71f,%rax
+  804ac0:	ff ff ff 
+  804ac3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ac7:	ff d0                	call   *%rax
+  804ac9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804acc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ad0:	74 23                	je     804af5 <open+0x14f>
+		fd_close(fd,0);
+  804ad2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ad6:	be 00 00 00 00       	mov    $0x0,%esi
+  804adb:	48 89 c7             	mov    %rax,%rdi
+  804ade:	49 89 df             	mov    %rbx,%r15
+  804ae1:	48 b8 fb ac ff ff ff 	movabs $0xffffffffffffacfb,%rax
+  804ae8:	ff ff ff 
+  804aeb:	48 01 d8             	add    %rbx,%rax
+  804aee:	ff d0                	call   *%rax
+		return r;
+  804af0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804af3:	eb 19                	jmp    804b0e <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804af5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804af9:	48 89 c7             	mov    %rax,%rdi
+  804afc:	49 89 df             	mov    %rbx,%r15
+  804aff:	48 b8 20 ab ff ff ff 	movabs $0xffffffffffffab20,%rax
+  804b06:	ff ff ff 
+  804b09:	48 01 d8             	add    %rbx,%rax
+  804b0c:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804b0e:	48 83 c4 20          	add    $0x20,%rsp
+  804b12:	5b                   	pop    %rbx
+  804b13:	41 5f                	pop    %r15
+  804b15:	5d                   	pop    %rbp
+  804b16:	c3                   	ret
+
+0000000000804b17 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804b17:	55                   	push   %rbp
+  804b18:	48 89 e5             	mov    %rsp,%rbp
+  804b1b:	48 83 ec 20          	sub    $0x20,%rsp
+  804b1f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804b1f <devfile_flush+0x8>
+  804b26:	49 bb 21 45 00 00 00 	movabs $0x4521,%r11
+  804b2d:	00 00 00 
+  804b30:	4c 01 d8             	add    %r11,%rax
+  804b33:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804b37:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804b3b:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804b3e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804b41:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804b45:	ba 04 00 00 00       	mov    $0x4,%edx
+  804b4a:	48 89 ce             	mov    %rcx,%rsi
+  804b4d:	bf 06 00 00 00       	mov    $0x6,%edi
+  804b52:	48 b9 c7 b7 ff ff ff 	movabs $0xffffffffffffb7c7,%rcx
+  804b59:	ff ff ff 
+  804b5c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804b60:	ff d0                	call   *%rax
+}
+  804b62:	c9                   	leave
+  804b63:	c3                   	ret
+
+0000000000804b64 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804b64:	55                   	push   %rbp
+  804b65:	48 89 e5             	mov    %rsp,%rbp
+  804b68:	41 57                	push   %r15
+  804b6a:	53                   	push   %rbx
+  804b6b:	48 83 ec 60          	sub    $0x60,%rsp
+  804b6f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b6f <devfile_read+0xb>
+  804b76:	49 bb d1 44 00 00 00 	movabs $0x44d1,%r11
+  804b7d:	00 00 00 
+  804b80:	4c 01 db             	add    %r11,%rbx
+  804b83:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804b87:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804b8b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804b8f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804b93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804b97:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804b9b:	8b 50 0c             	mov    0xc(%rax),%edx
+  804b9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ba2:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804ba4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ba8:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804bac:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804bb0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804bb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804bb9:	ba 10 00 00 00       	mov    $0x10,%edx
+  804bbe:	48 89 c6             	mov    %rax,%rsi
+  804bc1:	bf 03 00 00 00       	mov    $0x3,%edi
+  804bc6:	48 b8 5b b8 ff ff ff 	movabs $0xffffffffffffb85b,%rax
+  804bcd:	ff ff ff 
+  804bd0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bd4:	ff d0                	call   *%rax
+  804bd6:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804bd9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804bdd:	79 05                	jns    804be4 <devfile_read+0x80>
+		return r;
+  804bdf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804be2:	eb 64                	jmp    804c48 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804be4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804be7:	48 63 d0             	movslq %eax,%rdx
+  804bea:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804bee:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804bf3:	48 01 c1             	add    %rax,%rcx
+  804bf6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804bfa:	48 89 ce             	mov    %rcx,%rsi
+  804bfd:	48 89 c7             	mov    %rax,%rdi
+  804c00:	49 89 df             	mov    %rbx,%r15
+  804c03:	48 b8 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rax
+  804c0a:	ff ff ff 
+  804c0d:	48 01 d8             	add    %rbx,%rax
+  804c10:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804c12:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804c19:	ff ff ff 
+  804c1c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804c20:	48 8b 00             	mov    (%rax),%rax
+  804c23:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804c29:	89 c6                	mov    %eax,%esi
+  804c2b:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804c30:	48 89 c7             	mov    %rax,%rdi
+  804c33:	49 89 df             	mov    %rbx,%r15
+  804c36:	48 b8 4b aa ff ff ff 	movabs $0xffffffffffffaa4b,%rax
+  804c3d:	ff ff ff 
+  804c40:	48 01 d8             	add    %rbx,%rax
+  804c43:	ff d0                	call   *%rax
+	return r;
+  804c45:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804c48:	48 83 c4 60          	add    $0x60,%rsp
+  804c4c:	5b                   	pop    %rbx
+  804c4d:	41 5f                	pop    %r15
+  804c4f:	5d                   	pop    %rbp
+  804c50:	c3                   	ret
+
+0000000000804c51 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804c51:	55                   	push   %rbp
+  804c52:	48 89 e5             	mov    %rsp,%rbp
+  804c55:	41 57                	push   %r15
+  804c57:	53                   	push   %rbx
+  804c58:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804c5c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c5c <devfile_write+0xb>
+  804c63:	49 bb e4 43 00 00 00 	movabs $0x43e4,%r11
+  804c6a:	00 00 00 
+  804c6d:	4c 01 db             	add    %r11,%rbx
+  804c70:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804c74:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804c78:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804c7f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804c83:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804c87:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804c8e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804c92:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804c99:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c9c:	48 63 d0             	movslq %eax,%rdx
+  804c9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ca3:	48 39 c2             	cmp    %rax,%rdx
+  804ca6:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804caa:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804cb1:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804cb8:	00 
+  804cb9:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804cc0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cc4:	48 01 d0             	add    %rdx,%rax
+  804cc7:	48 83 e8 01          	sub    $0x1,%rax
+  804ccb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804ccf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cd8:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804cdc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ce0:	48 29 d0             	sub    %rdx,%rax
+  804ce3:	48 c1 e8 0c          	shr    $0xc,%rax
+  804ce7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804cea:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804ced:	89 c6                	mov    %eax,%esi
+  804cef:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804cf4:	48 89 c7             	mov    %rax,%rdi
+  804cf7:	49 89 df             	mov    %rbx,%r15
+  804cfa:	48 b8 05 aa ff ff ff 	movabs $0xffffffffffffaa05,%rax
+  804d01:	ff ff ff 
+  804d04:	48 01 d8             	add    %rbx,%rax
+  804d07:	ff d0                	call   *%rax
+  804d09:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804d0c:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804d10:	79 08                	jns    804d1a <devfile_write+0xc9>
+		return r;
+  804d12:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804d15:	e9 8f 00 00 00       	jmp    804da9 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804d1a:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804d21:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804d25:	48 89 c6             	mov    %rax,%rsi
+  804d28:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804d2d:	48 89 c7             	mov    %rax,%rdi
+  804d30:	49 89 df             	mov    %rbx,%r15
+  804d33:	48 b8 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rax
+  804d3a:	ff ff ff 
+  804d3d:	48 01 d8             	add    %rbx,%rax
+  804d40:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804d42:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804d46:	8b 50 0c             	mov    0xc(%rax),%edx
+  804d49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d4d:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804d4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d53:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804d5a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804d5e:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804d61:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804d65:	89 d1                	mov    %edx,%ecx
+  804d67:	ba 10 00 00 00       	mov    $0x10,%edx
+  804d6c:	48 89 c6             	mov    %rax,%rsi
+  804d6f:	bf 04 00 00 00       	mov    $0x4,%edi
+  804d74:	48 b8 5b b8 ff ff ff 	movabs $0xffffffffffffb85b,%rax
+  804d7b:	ff ff ff 
+  804d7e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d82:	ff d0                	call   *%rax
+  804d84:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804d87:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804d8a:	89 c6                	mov    %eax,%esi
+  804d8c:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804d91:	48 89 c7             	mov    %rax,%rdi
+  804d94:	49 89 df             	mov    %rbx,%r15
+  804d97:	48 b8 4b aa ff ff ff 	movabs $0xffffffffffffaa4b,%rax
+  804d9e:	ff ff ff 
+  804da1:	48 01 d8             	add    %rbx,%rax
+  804da4:	ff d0                	call   *%rax
+	return r;
+  804da6:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804da9:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804dad:	5b                   	pop    %rbx
+  804dae:	41 5f                	pop    %r15
+  804db0:	5d                   	pop    %rbp
+  804db1:	c3                   	ret
+
+0000000000804db2 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804db2:	55                   	push   %rbp
+  804db3:	48 89 e5             	mov    %rsp,%rbp
+  804db6:	41 57                	push   %r15
+  804db8:	53                   	push   %rbx
+  804db9:	48 83 ec 20          	sub    $0x20,%rsp
+  804dbd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804dbd <devfile_stat+0xb>
+  804dc4:	49 bb 83 42 00 00 00 	movabs $0x4283,%r11
+  804dcb:	00 00 00 
+  804dce:	4c 01 db             	add    %r11,%rbx
+  804dd1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804dd5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804dd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ddd:	8b 40 0c             	mov    0xc(%rax),%eax
+  804de0:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804de7:	00 00 00 
+  804dea:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804ded:	be 00 00 00 00       	mov    $0x0,%esi
+  804df2:	bf 05 00 00 00       	mov    $0x5,%edi
+  804df7:	48 b8 1f b7 ff ff ff 	movabs $0xffffffffffffb71f,%rax
+  804dfe:	ff ff ff 
+  804e01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e05:	ff d0                	call   *%rax
+  804e07:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e0a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e0e:	79 05                	jns    804e15 <devfile_stat+0x63>
+		return r;
+  804e10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e13:	eb 65                	jmp    804e7a <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804e15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e19:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804e20:	00 00 00 
+  804e23:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804e27:	48 89 d6             	mov    %rdx,%rsi
+  804e2a:	48 89 c7             	mov    %rax,%rdi
+  804e2d:	49 89 df             	mov    %rbx,%r15
+  804e30:	48 b8 63 83 ff ff ff 	movabs $0xffffffffffff8363,%rax
+  804e37:	ff ff ff 
+  804e3a:	48 01 d8             	add    %rbx,%rax
+  804e3d:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804e3f:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804e46:	00 00 00 
+  804e49:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804e50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e54:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804e5a:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804e61:	00 00 00 
+  804e64:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804e6b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e6f:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804e75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e7a:	48 83 c4 20          	add    $0x20,%rsp
+  804e7e:	5b                   	pop    %rbx
+  804e7f:	41 5f                	pop    %r15
+  804e81:	5d                   	pop    %rbp
+  804e82:	c3                   	ret
+
+0000000000804e83 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804e83:	55                   	push   %rbp
+  804e84:	48 89 e5             	mov    %rsp,%rbp
+  804e87:	48 83 ec 20          	sub    $0x20,%rsp
+  804e8b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e8b <devfile_trunc+0x8>
+  804e92:	49 bb b5 41 00 00 00 	movabs $0x41b5,%r11
+  804e99:	00 00 00 
+  804e9c:	4c 01 d8             	add    %r11,%rax
+  804e9f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804ea3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804ea6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804eaa:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804ead:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804eb0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804eb3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804eb6:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804eba:	ba 08 00 00 00       	mov    $0x8,%edx
+  804ebf:	48 89 ce             	mov    %rcx,%rsi
+  804ec2:	bf 02 00 00 00       	mov    $0x2,%edi
+  804ec7:	48 b9 c7 b7 ff ff ff 	movabs $0xffffffffffffb7c7,%rcx
+  804ece:	ff ff ff 
+  804ed1:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804ed5:	ff d0                	call   *%rax
+}
+  804ed7:	c9                   	leave
+  804ed8:	c3                   	ret
+
+0000000000804ed9 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  804ed9:	55                   	push   %rbp
+  804eda:	48 89 e5             	mov    %rsp,%rbp
+  804edd:	41 57                	push   %r15
+  804edf:	53                   	push   %rbx
+  804ee0:	48 83 ec 10          	sub    $0x10,%rsp
+  804ee4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ee4 <remove+0xb>
+  804eeb:	49 bb 5c 41 00 00 00 	movabs $0x415c,%r11
+  804ef2:	00 00 00 
+  804ef5:	4c 01 db             	add    %r11,%rbx
+  804ef8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  804efc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f00:	48 89 c7             	mov    %rax,%rdi
+  804f03:	49 89 df             	mov    %rbx,%r15
+  804f06:	48 b8 cf 82 ff ff ff 	movabs $0xffffffffffff82cf,%rax
+  804f0d:	ff ff ff 
+  804f10:	48 01 d8             	add    %rbx,%rax
+  804f13:	ff d0                	call   *%rax
+  804f15:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804f1a:	7e 07                	jle    804f23 <remove+0x4a>
+		return -E_BAD_PATH;
+  804f1c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804f21:	eb 44                	jmp    804f67 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  804f23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f27:	48 89 c6             	mov    %rax,%rsi
+  804f2a:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804f31:	00 00 00 
+  804f34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f38:	48 89 c7             	mov    %rax,%rdi
+  804f3b:	49 89 df             	mov    %rbx,%r15
+  804f3e:	48 b8 63 83 ff ff ff 	movabs $0xffffffffffff8363,%rax
+  804f45:	ff ff ff 
+  804f48:	48 01 d8             	add    %rbx,%rax
+  804f4b:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  804f4d:	be 00 00 00 00       	mov    $0x0,%esi
+  804f52:	bf 07 00 00 00       	mov    $0x7,%edi
+  804f57:	48 b8 1f b7 ff ff ff 	movabs $0xffffffffffffb71f,%rax
+  804f5e:	ff ff ff 
+  804f61:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f65:	ff d0                	call   *%rax
+}
+  804f67:	48 83 c4 10          	add    $0x10,%rsp
+  804f6b:	5b                   	pop    %rbx
+  804f6c:	41 5f                	pop    %r15
+  804f6e:	5d                   	pop    %rbp
+  804f6f:	c3                   	ret
+
+0000000000804f70 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804f70:	55                   	push   %rbp
+  804f71:	48 89 e5             	mov    %rsp,%rbp
+  804f74:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804f74 <sync+0x4>
+  804f7b:	49 bb cc 40 00 00 00 	movabs $0x40cc,%r11
+  804f82:	00 00 00 
+  804f85:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804f88:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f8d:	be 00 00 00 00       	mov    $0x0,%esi
+  804f92:	bf 08 00 00 00       	mov    $0x8,%edi
+  804f97:	48 b9 c7 b7 ff ff ff 	movabs $0xffffffffffffb7c7,%rcx
+  804f9e:	ff ff ff 
+  804fa1:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804fa5:	ff d0                	call   *%rax
+}
+  804fa7:	5d                   	pop    %rbp
+  804fa8:	c3                   	ret
+
+0000000000804fa9 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804fa9:	55                   	push   %rbp
+  804faa:	48 89 e5             	mov    %rsp,%rbp
+  804fad:	41 57                	push   %r15
+  804faf:	53                   	push   %rbx
+  804fb0:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804fb7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fb7 <copy+0xe>
+  804fbe:	49 bb 89 40 00 00 00 	movabs $0x4089,%r11
+  804fc5:	00 00 00 
+  804fc8:	4c 01 db             	add    %r11,%rbx
+  804fcb:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804fd2:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  804fd9:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804fe0:	be 00 00 00 00       	mov    $0x0,%esi
+  804fe5:	48 89 c7             	mov    %rax,%rdi
+  804fe8:	48 b8 66 b9 ff ff ff 	movabs $0xffffffffffffb966,%rax
+  804fef:	ff ff ff 
+  804ff2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ff6:	ff d0                	call   *%rax
+  804ff8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  804ffb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fff:	79 35                	jns    805036 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  805001:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805004:	89 c6                	mov    %eax,%esi
+  805006:	48 b8 2e e4 ff ff ff 	movabs $0xffffffffffffe42e,%rax
+  80500d:	ff ff ff 
+  805010:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805014:	48 89 c7             	mov    %rax,%rdi
+  805017:	49 89 df             	mov    %rbx,%r15
+  80501a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80501f:	48 ba a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rdx
+  805026:	ff ff ff 
+  805029:	48 01 da             	add    %rbx,%rdx
+  80502c:	ff d2                	call   *%rdx
+		return fd_src;
+  80502e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805031:	e9 d7 01 00 00       	jmp    80520d <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  805036:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  80503d:	be 01 01 00 00       	mov    $0x101,%esi
+  805042:	48 89 c7             	mov    %rax,%rdi
+  805045:	48 b8 66 b9 ff ff ff 	movabs $0xffffffffffffb966,%rax
+  80504c:	ff ff ff 
+  80504f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805053:	ff d0                	call   *%rax
+  805055:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  805058:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80505c:	0f 89 df 00 00 00    	jns    805141 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  805062:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805065:	89 c6                	mov    %eax,%esi
+  805067:	48 b8 44 e4 ff ff ff 	movabs $0xffffffffffffe444,%rax
+  80506e:	ff ff ff 
+  805071:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805075:	48 89 c7             	mov    %rax,%rdi
+  805078:	49 89 df             	mov    %rbx,%r15
+  80507b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805080:	48 ba a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rdx
+  805087:	ff ff ff 
+  80508a:	48 01 da             	add    %rbx,%rdx
+  80508d:	ff d2                	call   *%rdx
+		close(fd_src);
+  80508f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805092:	89 c7                	mov    %eax,%edi
+  805094:	49 89 df             	mov    %rbx,%r15
+  805097:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  80509e:	ff ff ff 
+  8050a1:	48 01 d8             	add    %rbx,%rax
+  8050a4:	ff d0                	call   *%rax
+		return fd_dest;
+  8050a6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8050a9:	e9 5f 01 00 00       	jmp    80520d <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  8050ae:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8050b1:	48 63 d0             	movslq %eax,%rdx
+  8050b4:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8050bb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8050be:	48 89 ce             	mov    %rcx,%rsi
+  8050c1:	89 c7                	mov    %eax,%edi
+  8050c3:	49 89 df             	mov    %rbx,%r15
+  8050c6:	48 b8 3d b3 ff ff ff 	movabs $0xffffffffffffb33d,%rax
+  8050cd:	ff ff ff 
+  8050d0:	48 01 d8             	add    %rbx,%rax
+  8050d3:	ff d0                	call   *%rax
+  8050d5:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8050d8:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8050dc:	79 63                	jns    805141 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8050de:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8050e1:	89 c6                	mov    %eax,%esi
+  8050e3:	48 b8 5e e4 ff ff ff 	movabs $0xffffffffffffe45e,%rax
+  8050ea:	ff ff ff 
+  8050ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050f1:	48 89 c7             	mov    %rax,%rdi
+  8050f4:	49 89 df             	mov    %rbx,%r15
+  8050f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050fc:	48 ba a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rdx
+  805103:	ff ff ff 
+  805106:	48 01 da             	add    %rbx,%rdx
+  805109:	ff d2                	call   *%rdx
+			close(fd_src);
+  80510b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80510e:	89 c7                	mov    %eax,%edi
+  805110:	49 89 df             	mov    %rbx,%r15
+  805113:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  80511a:	ff ff ff 
+  80511d:	48 01 d8             	add    %rbx,%rax
+  805120:	ff d0                	call   *%rax
+			close(fd_dest);
+  805122:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805125:	89 c7                	mov    %eax,%edi
+  805127:	49 89 df             	mov    %rbx,%r15
+  80512a:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  805131:	ff ff ff 
+  805134:	48 01 d8             	add    %rbx,%rax
+  805137:	ff d0                	call   *%rax
+			return write_size;
+  805139:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80513c:	e9 cc 00 00 00       	jmp    80520d <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  805141:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805148:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80514b:	ba 00 02 00 00       	mov    $0x200,%edx
+  805150:	48 89 ce             	mov    %rcx,%rsi
+  805153:	89 c7                	mov    %eax,%edi
+  805155:	49 89 df             	mov    %rbx,%r15
+  805158:	48 b8 97 b1 ff ff ff 	movabs $0xffffffffffffb197,%rax
+  80515f:	ff ff ff 
+  805162:	48 01 d8             	add    %rbx,%rax
+  805165:	ff d0                	call   *%rax
+  805167:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80516a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80516e:	0f 8f 3a ff ff ff    	jg     8050ae <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805174:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805178:	79 60                	jns    8051da <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  80517a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80517d:	89 c6                	mov    %eax,%esi
+  80517f:	48 b8 71 e4 ff ff ff 	movabs $0xffffffffffffe471,%rax
+  805186:	ff ff ff 
+  805189:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80518d:	48 89 c7             	mov    %rax,%rdi
+  805190:	49 89 df             	mov    %rbx,%r15
+  805193:	b8 00 00 00 00       	mov    $0x0,%eax
+  805198:	48 ba a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rdx
+  80519f:	ff ff ff 
+  8051a2:	48 01 da             	add    %rbx,%rdx
+  8051a5:	ff d2                	call   *%rdx
+		close(fd_src);
+  8051a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051aa:	89 c7                	mov    %eax,%edi
+  8051ac:	49 89 df             	mov    %rbx,%r15
+  8051af:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  8051b6:	ff ff ff 
+  8051b9:	48 01 d8             	add    %rbx,%rax
+  8051bc:	ff d0                	call   *%rax
+		close(fd_dest);
+  8051be:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8051c1:	89 c7                	mov    %eax,%edi
+  8051c3:	49 89 df             	mov    %rbx,%r15
+  8051c6:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  8051cd:	ff ff ff 
+  8051d0:	48 01 d8             	add    %rbx,%rax
+  8051d3:	ff d0                	call   *%rax
+		return read_size;
+  8051d5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8051d8:	eb 33                	jmp    80520d <copy+0x264>
+	}
+	close(fd_src);
+  8051da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051dd:	89 c7                	mov    %eax,%edi
+  8051df:	49 89 df             	mov    %rbx,%r15
+  8051e2:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  8051e9:	ff ff ff 
+  8051ec:	48 01 d8             	add    %rbx,%rax
+  8051ef:	ff d0                	call   *%rax
+	close(fd_dest);
+  8051f1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8051f4:	89 c7                	mov    %eax,%edi
+  8051f6:	49 89 df             	mov    %rbx,%r15
+  8051f9:	48 b8 df ae ff ff ff 	movabs $0xffffffffffffaedf,%rax
+  805200:	ff ff ff 
+  805203:	48 01 d8             	add    %rbx,%rax
+  805206:	ff d0                	call   *%rax
+	return 0;
+  805208:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  80520d:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  805214:	5b                   	pop    %rbx
+  805215:	41 5f                	pop    %r15
+  805217:	5d                   	pop    %rbp
+  805218:	c3                   	ret
+
+0000000000805219 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805219:	55                   	push   %rbp
+  80521a:	48 89 e5             	mov    %rsp,%rbp
+  80521d:	41 57                	push   %r15
+  80521f:	53                   	push   %rbx
+  805220:	48 83 ec 20          	sub    $0x20,%rsp
+  805224:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805224 <fd2sockid+0xb>
+  80522b:	49 bb 1c 3e 00 00 00 	movabs $0x3e1c,%r11
+  805232:	00 00 00 
+  805235:	4c 01 db             	add    %r11,%rbx
+  805238:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80523b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80523f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805242:	48 89 d6             	mov    %rdx,%rsi
+  805245:	89 c7                	mov    %eax,%edi
+  805247:	49 89 df             	mov    %rbx,%r15
+  80524a:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  805251:	ff ff ff 
+  805254:	48 01 d8             	add    %rbx,%rax
+  805257:	ff d0                	call   *%rax
+  805259:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80525c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805260:	79 05                	jns    805267 <fd2sockid+0x4e>
+		return r;
+  805262:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805265:	eb 25                	jmp    80528c <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805267:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80526b:	8b 10                	mov    (%rax),%edx
+  80526d:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  805274:	00 00 00 
+  805277:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80527a:	39 c2                	cmp    %eax,%edx
+  80527c:	74 07                	je     805285 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80527e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  805283:	eb 07                	jmp    80528c <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  805285:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805289:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  80528c:	48 83 c4 20          	add    $0x20,%rsp
+  805290:	5b                   	pop    %rbx
+  805291:	41 5f                	pop    %r15
+  805293:	5d                   	pop    %rbp
+  805294:	c3                   	ret
+
+0000000000805295 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  805295:	55                   	push   %rbp
+  805296:	48 89 e5             	mov    %rsp,%rbp
+  805299:	41 57                	push   %r15
+  80529b:	53                   	push   %rbx
+  80529c:	48 83 ec 20          	sub    $0x20,%rsp
+  8052a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052a0 <alloc_sockfd+0xb>
+  8052a7:	49 bb a0 3d 00 00 00 	movabs $0x3da0,%r11
+  8052ae:	00 00 00 
+  8052b1:	4c 01 db             	add    %r11,%rbx
+  8052b4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8052b7:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8052bb:	48 89 c7             	mov    %rax,%rdi
+  8052be:	49 89 df             	mov    %rbx,%r15
+  8052c1:	48 b8 9a ab ff ff ff 	movabs $0xffffffffffffab9a,%rax
+  8052c8:	ff ff ff 
+  8052cb:	48 01 d8             	add    %rbx,%rax
+  8052ce:	ff d0                	call   *%rax
+  8052d0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052d7:	78 2c                	js     805305 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8052d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052dd:	ba 07 04 00 00       	mov    $0x407,%edx
+  8052e2:	48 89 c6             	mov    %rax,%rsi
+  8052e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ea:	49 89 df             	mov    %rbx,%r15
+  8052ed:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  8052f4:	ff ff ff 
+  8052f7:	48 01 d8             	add    %rbx,%rax
+  8052fa:	ff d0                	call   *%rax
+  8052fc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052ff:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805303:	79 1c                	jns    805321 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805305:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805308:	89 c7                	mov    %eax,%edi
+  80530a:	49 89 df             	mov    %rbx,%r15
+  80530d:	48 b8 49 ca ff ff ff 	movabs $0xffffffffffffca49,%rax
+  805314:	ff ff ff 
+  805317:	48 01 d8             	add    %rbx,%rax
+  80531a:	ff d0                	call   *%rax
+		return r;
+  80531c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80531f:	eb 41                	jmp    805362 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  805321:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805325:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  80532c:	00 00 00 
+  80532f:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805332:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805334:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805338:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80533f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805343:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805346:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805349:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80534d:	48 89 c7             	mov    %rax,%rdi
+  805350:	49 89 df             	mov    %rbx,%r15
+  805353:	48 b8 20 ab ff ff ff 	movabs $0xffffffffffffab20,%rax
+  80535a:	ff ff ff 
+  80535d:	48 01 d8             	add    %rbx,%rax
+  805360:	ff d0                	call   *%rax
+}
+  805362:	48 83 c4 20          	add    $0x20,%rsp
+  805366:	5b                   	pop    %rbx
+  805367:	41 5f                	pop    %r15
+  805369:	5d                   	pop    %rbp
+  80536a:	c3                   	ret
+
+000000000080536b <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80536b:	55                   	push   %rbp
+  80536c:	48 89 e5             	mov    %rsp,%rbp
+  80536f:	41 57                	push   %r15
+  805371:	53                   	push   %rbx
+  805372:	48 83 ec 30          	sub    $0x30,%rsp
+  805376:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805376 <accept+0xb>
+  80537d:	49 bb ca 3c 00 00 00 	movabs $0x3cca,%r11
+  805384:	00 00 00 
+  805387:	4c 01 db             	add    %r11,%rbx
+  80538a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80538d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805391:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805395:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805398:	89 c7                	mov    %eax,%edi
+  80539a:	48 b8 d9 c1 ff ff ff 	movabs $0xffffffffffffc1d9,%rax
+  8053a1:	ff ff ff 
+  8053a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053a8:	ff d0                	call   *%rax
+  8053aa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053b1:	79 05                	jns    8053b8 <accept+0x4d>
+		return r;
+  8053b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b6:	eb 45                	jmp    8053fd <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8053b8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8053bc:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8053c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053c3:	48 89 ce             	mov    %rcx,%rsi
+  8053c6:	89 c7                	mov    %eax,%edi
+  8053c8:	49 89 df             	mov    %rbx,%r15
+  8053cb:	48 b8 b7 c8 ff ff ff 	movabs $0xffffffffffffc8b7,%rax
+  8053d2:	ff ff ff 
+  8053d5:	48 01 d8             	add    %rbx,%rax
+  8053d8:	ff d0                	call   *%rax
+  8053da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053dd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053e1:	79 05                	jns    8053e8 <accept+0x7d>
+		return r;
+  8053e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053e6:	eb 15                	jmp    8053fd <accept+0x92>
+	return alloc_sockfd(r);
+  8053e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053eb:	89 c7                	mov    %eax,%edi
+  8053ed:	48 b8 55 c2 ff ff ff 	movabs $0xffffffffffffc255,%rax
+  8053f4:	ff ff ff 
+  8053f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053fb:	ff d0                	call   *%rax
+}
+  8053fd:	48 83 c4 30          	add    $0x30,%rsp
+  805401:	5b                   	pop    %rbx
+  805402:	41 5f                	pop    %r15
+  805404:	5d                   	pop    %rbp
+  805405:	c3                   	ret
+
+0000000000805406 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805406:	55                   	push   %rbp
+  805407:	48 89 e5             	mov    %rsp,%rbp
+  80540a:	41 57                	push   %r15
+  80540c:	53                   	push   %rbx
+  80540d:	48 83 ec 20          	sub    $0x20,%rsp
+  805411:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805411 <bind+0xb>
+  805418:	49 bb 2f 3c 00 00 00 	movabs $0x3c2f,%r11
+  80541f:	00 00 00 
+  805422:	4c 01 db             	add    %r11,%rbx
+  805425:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805428:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80542c:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80542f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805432:	89 c7                	mov    %eax,%edi
+  805434:	48 b8 d9 c1 ff ff ff 	movabs $0xffffffffffffc1d9,%rax
+  80543b:	ff ff ff 
+  80543e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805442:	ff d0                	call   *%rax
+  805444:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805447:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80544b:	79 05                	jns    805452 <bind+0x4c>
+		return r;
+  80544d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805450:	eb 21                	jmp    805473 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  805452:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805455:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805459:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80545c:	48 89 ce             	mov    %rcx,%rsi
+  80545f:	89 c7                	mov    %eax,%edi
+  805461:	49 89 df             	mov    %rbx,%r15
+  805464:	48 b8 63 c9 ff ff ff 	movabs $0xffffffffffffc963,%rax
+  80546b:	ff ff ff 
+  80546e:	48 01 d8             	add    %rbx,%rax
+  805471:	ff d0                	call   *%rax
+}
+  805473:	48 83 c4 20          	add    $0x20,%rsp
+  805477:	5b                   	pop    %rbx
+  805478:	41 5f                	pop    %r15
+  80547a:	5d                   	pop    %rbp
+  80547b:	c3                   	ret
+
+000000000080547c <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  80547c:	55                   	push   %rbp
+  80547d:	48 89 e5             	mov    %rsp,%rbp
+  805480:	41 57                	push   %r15
+  805482:	53                   	push   %rbx
+  805483:	48 83 ec 20          	sub    $0x20,%rsp
+  805487:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805487 <shutdown+0xb>
+  80548e:	49 bb b9 3b 00 00 00 	movabs $0x3bb9,%r11
+  805495:	00 00 00 
+  805498:	4c 01 db             	add    %r11,%rbx
+  80549b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80549e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8054a1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054a4:	89 c7                	mov    %eax,%edi
+  8054a6:	48 b8 d9 c1 ff ff ff 	movabs $0xffffffffffffc1d9,%rax
+  8054ad:	ff ff ff 
+  8054b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054b4:	ff d0                	call   *%rax
+  8054b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054bd:	79 05                	jns    8054c4 <shutdown+0x48>
+		return r;
+  8054bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054c2:	eb 1c                	jmp    8054e0 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8054c4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8054c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054ca:	89 d6                	mov    %edx,%esi
+  8054cc:	89 c7                	mov    %eax,%edi
+  8054ce:	49 89 df             	mov    %rbx,%r15
+  8054d1:	48 b8 f8 c9 ff ff ff 	movabs $0xffffffffffffc9f8,%rax
+  8054d8:	ff ff ff 
+  8054db:	48 01 d8             	add    %rbx,%rax
+  8054de:	ff d0                	call   *%rax
+}
+  8054e0:	48 83 c4 20          	add    $0x20,%rsp
+  8054e4:	5b                   	pop    %rbx
+  8054e5:	41 5f                	pop    %r15
+  8054e7:	5d                   	pop    %rbp
+  8054e8:	c3                   	ret
+
+00000000008054e9 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8054e9:	55                   	push   %rbp
+  8054ea:	48 89 e5             	mov    %rsp,%rbp
+  8054ed:	41 57                	push   %r15
+  8054ef:	53                   	push   %rbx
+  8054f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8054f4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054f4 <devsock_close+0xb>
+  8054fb:	49 bb 4c 3b 00 00 00 	movabs $0x3b4c,%r11
+  805502:	00 00 00 
+  805505:	4c 01 db             	add    %r11,%rbx
+  805508:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80550c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805510:	48 89 c7             	mov    %rax,%rdi
+  805513:	49 89 df             	mov    %rbx,%r15
+  805516:	48 b8 04 dd ff ff ff 	movabs $0xffffffffffffdd04,%rax
+  80551d:	ff ff ff 
+  805520:	48 01 d8             	add    %rbx,%rax
+  805523:	ff d0                	call   *%rax
+  805525:	83 f8 01             	cmp    $0x1,%eax
+  805528:	75 1d                	jne    805547 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  80552a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80552e:	8b 40 0c             	mov    0xc(%rax),%eax
+  805531:	89 c7                	mov    %eax,%edi
+  805533:	49 89 df             	mov    %rbx,%r15
+  805536:	48 b8 49 ca ff ff ff 	movabs $0xffffffffffffca49,%rax
+  80553d:	ff ff ff 
+  805540:	48 01 d8             	add    %rbx,%rax
+  805543:	ff d0                	call   *%rax
+  805545:	eb 05                	jmp    80554c <devsock_close+0x63>
+	else
+		return 0;
+  805547:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80554c:	48 83 c4 10          	add    $0x10,%rsp
+  805550:	5b                   	pop    %rbx
+  805551:	41 5f                	pop    %r15
+  805553:	5d                   	pop    %rbp
+  805554:	c3                   	ret
+
+0000000000805555 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805555:	55                   	push   %rbp
+  805556:	48 89 e5             	mov    %rsp,%rbp
+  805559:	41 57                	push   %r15
+  80555b:	53                   	push   %rbx
+  80555c:	48 83 ec 20          	sub    $0x20,%rsp
+  805560:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805560 <connect+0xb>
+  805567:	49 bb e0 3a 00 00 00 	movabs $0x3ae0,%r11
+  80556e:	00 00 00 
+  805571:	4c 01 db             	add    %r11,%rbx
+  805574:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805577:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80557b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80557e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805581:	89 c7                	mov    %eax,%edi
+  805583:	48 b8 d9 c1 ff ff ff 	movabs $0xffffffffffffc1d9,%rax
+  80558a:	ff ff ff 
+  80558d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805591:	ff d0                	call   *%rax
+  805593:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805596:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80559a:	79 05                	jns    8055a1 <connect+0x4c>
+		return r;
+  80559c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80559f:	eb 21                	jmp    8055c2 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8055a1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8055a4:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8055a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055ab:	48 89 ce             	mov    %rcx,%rsi
+  8055ae:	89 c7                	mov    %eax,%edi
+  8055b0:	49 89 df             	mov    %rbx,%r15
+  8055b3:	48 b8 91 ca ff ff ff 	movabs $0xffffffffffffca91,%rax
+  8055ba:	ff ff ff 
+  8055bd:	48 01 d8             	add    %rbx,%rax
+  8055c0:	ff d0                	call   *%rax
+}
+  8055c2:	48 83 c4 20          	add    $0x20,%rsp
+  8055c6:	5b                   	pop    %rbx
+  8055c7:	41 5f                	pop    %r15
+  8055c9:	5d                   	pop    %rbp
+  8055ca:	c3                   	ret
+
+00000000008055cb <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8055cb:	55                   	push   %rbp
+  8055cc:	48 89 e5             	mov    %rsp,%rbp
+  8055cf:	41 57                	push   %r15
+  8055d1:	53                   	push   %rbx
+  8055d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8055d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055d6 <listen+0xb>
+  8055dd:	49 bb 6a 3a 00 00 00 	movabs $0x3a6a,%r11
+  8055e4:	00 00 00 
+  8055e7:	4c 01 db             	add    %r11,%rbx
+  8055ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8055ed:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8055f0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8055f3:	89 c7                	mov    %eax,%edi
+  8055f5:	48 b8 d9 c1 ff ff ff 	movabs $0xffffffffffffc1d9,%rax
+  8055fc:	ff ff ff 
+  8055ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805603:	ff d0                	call   *%rax
+  805605:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805608:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80560c:	79 05                	jns    805613 <listen+0x48>
+		return r;
+  80560e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805611:	eb 1c                	jmp    80562f <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805613:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805616:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805619:	89 d6                	mov    %edx,%esi
+  80561b:	89 c7                	mov    %eax,%edi
+  80561d:	49 89 df             	mov    %rbx,%r15
+  805620:	48 b8 26 cb ff ff ff 	movabs $0xffffffffffffcb26,%rax
+  805627:	ff ff ff 
+  80562a:	48 01 d8             	add    %rbx,%rax
+  80562d:	ff d0                	call   *%rax
+}
+  80562f:	48 83 c4 20          	add    $0x20,%rsp
+  805633:	5b                   	pop    %rbx
+  805634:	41 5f                	pop    %r15
+  805636:	5d                   	pop    %rbp
+  805637:	c3                   	ret
+
+0000000000805638 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805638:	55                   	push   %rbp
+  805639:	48 89 e5             	mov    %rsp,%rbp
+  80563c:	41 57                	push   %r15
+  80563e:	48 83 ec 28          	sub    $0x28,%rsp
+  805642:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805642 <devsock_read+0xa>
+  805649:	49 bb fe 39 00 00 00 	movabs $0x39fe,%r11
+  805650:	00 00 00 
+  805653:	4c 01 d8             	add    %r11,%rax
+  805656:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80565a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80565e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805662:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805666:	41 89 d0             	mov    %edx,%r8d
+  805669:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80566d:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805670:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805674:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805679:	44 89 c2             	mov    %r8d,%edx
+  80567c:	49 89 c7             	mov    %rax,%r15
+  80567f:	49 b8 77 cb ff ff ff 	movabs $0xffffffffffffcb77,%r8
+  805686:	ff ff ff 
+  805689:	49 01 c0             	add    %rax,%r8
+  80568c:	41 ff d0             	call   *%r8
+}
+  80568f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805693:	c9                   	leave
+  805694:	c3                   	ret
+
+0000000000805695 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805695:	55                   	push   %rbp
+  805696:	48 89 e5             	mov    %rsp,%rbp
+  805699:	41 57                	push   %r15
+  80569b:	48 83 ec 28          	sub    $0x28,%rsp
+  80569f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80569f <devsock_write+0xa>
+  8056a6:	49 bb a1 39 00 00 00 	movabs $0x39a1,%r11
+  8056ad:	00 00 00 
+  8056b0:	4c 01 d8             	add    %r11,%rax
+  8056b3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8056b7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8056bb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8056bf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8056c3:	41 89 d0             	mov    %edx,%r8d
+  8056c6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8056ca:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8056cd:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8056d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8056d6:	44 89 c2             	mov    %r8d,%edx
+  8056d9:	49 89 c7             	mov    %rax,%r15
+  8056dc:	49 b8 94 cc ff ff ff 	movabs $0xffffffffffffcc94,%r8
+  8056e3:	ff ff ff 
+  8056e6:	49 01 c0             	add    %rax,%r8
+  8056e9:	41 ff d0             	call   *%r8
+}
+  8056ec:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8056f0:	c9                   	leave
+  8056f1:	c3                   	ret
+
+00000000008056f2 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8056f2:	55                   	push   %rbp
+  8056f3:	48 89 e5             	mov    %rsp,%rbp
+  8056f6:	41 57                	push   %r15
+  8056f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8056fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8056fc <devsock_stat+0xa>
+  805703:	49 bb 44 39 00 00 00 	movabs $0x3944,%r11
+  80570a:	00 00 00 
+  80570d:	4c 01 d8             	add    %r11,%rax
+  805710:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805714:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805718:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80571c:	48 b9 8c e4 ff ff ff 	movabs $0xffffffffffffe48c,%rcx
+  805723:	ff ff ff 
+  805726:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80572a:	48 89 ce             	mov    %rcx,%rsi
+  80572d:	48 89 d7             	mov    %rdx,%rdi
+  805730:	49 89 c7             	mov    %rax,%r15
+  805733:	48 ba 63 83 ff ff ff 	movabs $0xffffffffffff8363,%rdx
+  80573a:	ff ff ff 
+  80573d:	48 01 c2             	add    %rax,%rdx
+  805740:	ff d2                	call   *%rdx
+	return 0;
+  805742:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805747:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80574b:	c9                   	leave
+  80574c:	c3                   	ret
+
+000000000080574d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80574d:	55                   	push   %rbp
+  80574e:	48 89 e5             	mov    %rsp,%rbp
+  805751:	41 57                	push   %r15
+  805753:	53                   	push   %rbx
+  805754:	48 83 ec 20          	sub    $0x20,%rsp
+  805758:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805758 <socket+0xb>
+  80575f:	49 bb e8 38 00 00 00 	movabs $0x38e8,%r11
+  805766:	00 00 00 
+  805769:	4c 01 db             	add    %r11,%rbx
+  80576c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80576f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805772:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805775:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805778:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80577b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80577e:	89 ce                	mov    %ecx,%esi
+  805780:	89 c7                	mov    %eax,%edi
+  805782:	49 89 df             	mov    %rbx,%r15
+  805785:	48 b8 6b ce ff ff ff 	movabs $0xffffffffffffce6b,%rax
+  80578c:	ff ff ff 
+  80578f:	48 01 d8             	add    %rbx,%rax
+  805792:	ff d0                	call   *%rax
+  805794:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805797:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80579b:	79 05                	jns    8057a2 <socket+0x55>
+		return r;
+  80579d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057a0:	eb 15                	jmp    8057b7 <socket+0x6a>
+	return alloc_sockfd(r);
+  8057a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057a5:	89 c7                	mov    %eax,%edi
+  8057a7:	48 b8 55 c2 ff ff ff 	movabs $0xffffffffffffc255,%rax
+  8057ae:	ff ff ff 
+  8057b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057b5:	ff d0                	call   *%rax
+}
+  8057b7:	48 83 c4 20          	add    $0x20,%rsp
+  8057bb:	5b                   	pop    %rbx
+  8057bc:	41 5f                	pop    %r15
+  8057be:	5d                   	pop    %rbp
+  8057bf:	c3                   	ret
+
+00000000008057c0 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8057c0:	55                   	push   %rbp
+  8057c1:	48 89 e5             	mov    %rsp,%rbp
+  8057c4:	41 57                	push   %r15
+  8057c6:	53                   	push   %rbx
+  8057c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8057cb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057cb <nsipc+0xb>
+  8057d2:	49 bb 75 38 00 00 00 	movabs $0x3875,%r11
+  8057d9:	00 00 00 
+  8057dc:	4c 01 db             	add    %r11,%rbx
+  8057df:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8057e2:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8057e9:	00 00 00 
+  8057ec:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8057ef:	85 c0                	test   %eax,%eax
+  8057f1:	75 24                	jne    805817 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8057f3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8057f8:	49 89 df             	mov    %rbx,%r15
+  8057fb:	48 b8 91 aa ff ff ff 	movabs $0xffffffffffffaa91,%rax
+  805802:	ff ff ff 
+  805805:	48 01 d8             	add    %rbx,%rax
+  805808:	ff d0                	call   *%rax
+  80580a:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805811:	00 00 00 
+  805814:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805817:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80581e:	00 00 00 
+  805821:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805824:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805827:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80582d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805833:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805838:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80583f:	00 00 00 
+  805842:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805846:	89 c7                	mov    %eax,%edi
+  805848:	49 89 df             	mov    %rbx,%r15
+  80584b:	48 b8 b0 a4 ff ff ff 	movabs $0xffffffffffffa4b0,%rax
+  805852:	ff ff ff 
+  805855:	48 01 d8             	add    %rbx,%rax
+  805858:	ff d0                	call   *%rax
+}
+  80585a:	48 83 c4 10          	add    $0x10,%rsp
+  80585e:	5b                   	pop    %rbx
+  80585f:	41 5f                	pop    %r15
+  805861:	5d                   	pop    %rbp
+  805862:	c3                   	ret
+
+0000000000805863 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805863:	55                   	push   %rbp
+  805864:	48 89 e5             	mov    %rsp,%rbp
+  805867:	41 57                	push   %r15
+  805869:	53                   	push   %rbx
+  80586a:	48 83 ec 20          	sub    $0x20,%rsp
+  80586e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80586e <nsipc_words+0xb>
+  805875:	49 bb d2 37 00 00 00 	movabs $0x37d2,%r11
+  80587c:	00 00 00 
+  80587f:	4c 01 db             	add    %r11,%rbx
+  805882:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805885:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805889:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80588d:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805894:	00 00 00 
+  805897:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80589a:	85 c0                	test   %eax,%eax
+  80589c:	75 24                	jne    8058c2 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80589e:	bf 02 00 00 00       	mov    $0x2,%edi
+  8058a3:	49 89 df             	mov    %rbx,%r15
+  8058a6:	48 b8 91 aa ff ff ff 	movabs $0xffffffffffffaa91,%rax
+  8058ad:	ff ff ff 
+  8058b0:	48 01 d8             	add    %rbx,%rax
+  8058b3:	ff d0                	call   *%rax
+  8058b5:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8058bc:	00 00 00 
+  8058bf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8058c2:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8058c9:	00 00 00 
+  8058cc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8058cf:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8058d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8058d7:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8058da:	89 c7                	mov    %eax,%edi
+  8058dc:	49 89 df             	mov    %rbx,%r15
+  8058df:	48 b8 9b a5 ff ff ff 	movabs $0xffffffffffffa59b,%rax
+  8058e6:	ff ff ff 
+  8058e9:	48 01 d8             	add    %rbx,%rax
+  8058ec:	ff d0                	call   *%rax
+}
+  8058ee:	48 83 c4 20          	add    $0x20,%rsp
+  8058f2:	5b                   	pop    %rbx
+  8058f3:	41 5f                	pop    %r15
+  8058f5:	5d                   	pop    %rbp
+  8058f6:	c3                   	ret
+
+00000000008058f7 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8058f7:	55                   	push   %rbp
+  8058f8:	48 89 e5             	mov    %rsp,%rbp
+  8058fb:	41 57                	push   %r15
+  8058fd:	53                   	push   %rbx
+  8058fe:	48 83 ec 30          	sub    $0x30,%rsp
+  805902:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805902 <nsipc_accept+0xb>
+  805909:	49 bb 3e 37 00 00 00 	movabs $0x373e,%r11
+  805910:	00 00 00 
+  805913:	4c 01 db             	add    %r11,%rbx
+  805916:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805919:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80591d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805921:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805928:	00 00 00 
+  80592b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80592e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805931:	bf 01 00 00 00       	mov    $0x1,%edi
+  805936:	48 b8 80 c7 ff ff ff 	movabs $0xffffffffffffc780,%rax
+  80593d:	ff ff ff 
+  805940:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805944:	ff d0                	call   *%rax
+  805946:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805949:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80594d:	78 48                	js     805997 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80594f:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805956:	00 00 00 
+  805959:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80595d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805961:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805965:	8b 40 10             	mov    0x10(%rax),%eax
+  805968:	89 c2                	mov    %eax,%edx
+  80596a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80596e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805972:	48 89 ce             	mov    %rcx,%rsi
+  805975:	48 89 c7             	mov    %rax,%rdi
+  805978:	49 89 df             	mov    %rbx,%r15
+  80597b:	48 b8 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rax
+  805982:	ff ff ff 
+  805985:	48 01 d8             	add    %rbx,%rax
+  805988:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80598a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80598e:	8b 50 10             	mov    0x10(%rax),%edx
+  805991:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805995:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805997:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80599a:	48 83 c4 30          	add    $0x30,%rsp
+  80599e:	5b                   	pop    %rbx
+  80599f:	41 5f                	pop    %r15
+  8059a1:	5d                   	pop    %rbp
+  8059a2:	c3                   	ret
+
+00000000008059a3 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8059a3:	55                   	push   %rbp
+  8059a4:	48 89 e5             	mov    %rsp,%rbp
+  8059a7:	41 57                	push   %r15
+  8059a9:	53                   	push   %rbx
+  8059aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8059ae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059ae <nsipc_bind+0xb>
+  8059b5:	49 bb 92 36 00 00 00 	movabs $0x3692,%r11
+  8059bc:	00 00 00 
+  8059bf:	4c 01 db             	add    %r11,%rbx
+  8059c2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8059c5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8059c9:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8059cc:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8059d3:	00 00 00 
+  8059d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059d9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8059dc:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8059df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059e3:	48 89 c6             	mov    %rax,%rsi
+  8059e6:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  8059ed:	00 00 00 
+  8059f0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8059f4:	48 89 c7             	mov    %rax,%rdi
+  8059f7:	49 89 df             	mov    %rbx,%r15
+  8059fa:	48 b8 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rax
+  805a01:	ff ff ff 
+  805a04:	48 01 d8             	add    %rbx,%rax
+  805a07:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805a09:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805a10:	00 00 00 
+  805a13:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805a16:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805a1a:	bf 02 00 00 00       	mov    $0x2,%edi
+  805a1f:	48 b8 80 c7 ff ff ff 	movabs $0xffffffffffffc780,%rax
+  805a26:	ff ff ff 
+  805a29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a2d:	ff d0                	call   *%rax
+}
+  805a2f:	48 83 c4 10          	add    $0x10,%rsp
+  805a33:	5b                   	pop    %rbx
+  805a34:	41 5f                	pop    %r15
+  805a36:	5d                   	pop    %rbp
+  805a37:	c3                   	ret
+
+0000000000805a38 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805a38:	55                   	push   %rbp
+  805a39:	48 89 e5             	mov    %rsp,%rbp
+  805a3c:	48 83 ec 20          	sub    $0x20,%rsp
+  805a40:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a40 <nsipc_shutdown+0x8>
+  805a47:	49 bb 00 36 00 00 00 	movabs $0x3600,%r11
+  805a4e:	00 00 00 
+  805a51:	4c 01 d8             	add    %r11,%rax
+  805a54:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a57:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805a5a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805a5d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805a60:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a63:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805a66:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805a6a:	ba 08 00 00 00       	mov    $0x8,%edx
+  805a6f:	48 89 ce             	mov    %rcx,%rsi
+  805a72:	bf 03 00 00 00       	mov    $0x3,%edi
+  805a77:	48 b9 23 c8 ff ff ff 	movabs $0xffffffffffffc823,%rcx
+  805a7e:	ff ff ff 
+  805a81:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805a85:	ff d0                	call   *%rax
+}
+  805a87:	c9                   	leave
+  805a88:	c3                   	ret
+
+0000000000805a89 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805a89:	55                   	push   %rbp
+  805a8a:	48 89 e5             	mov    %rsp,%rbp
+  805a8d:	48 83 ec 20          	sub    $0x20,%rsp
+  805a91:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805a91 <nsipc_close+0x8>
+  805a98:	49 bb af 35 00 00 00 	movabs $0x35af,%r11
+  805a9f:	00 00 00 
+  805aa2:	4c 01 d8             	add    %r11,%rax
+  805aa5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805aa8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805aab:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805aae:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805ab2:	ba 04 00 00 00       	mov    $0x4,%edx
+  805ab7:	48 89 ce             	mov    %rcx,%rsi
+  805aba:	bf 04 00 00 00       	mov    $0x4,%edi
+  805abf:	48 b9 23 c8 ff ff ff 	movabs $0xffffffffffffc823,%rcx
+  805ac6:	ff ff ff 
+  805ac9:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805acd:	ff d0                	call   *%rax
+}
+  805acf:	c9                   	leave
+  805ad0:	c3                   	ret
+
+0000000000805ad1 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805ad1:	55                   	push   %rbp
+  805ad2:	48 89 e5             	mov    %rsp,%rbp
+  805ad5:	41 57                	push   %r15
+  805ad7:	53                   	push   %rbx
+  805ad8:	48 83 ec 10          	sub    $0x10,%rsp
+  805adc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805adc <nsipc_connect+0xb>
+  805ae3:	49 bb 64 35 00 00 00 	movabs $0x3564,%r11
+  805aea:	00 00 00 
+  805aed:	4c 01 db             	add    %r11,%rbx
+  805af0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805af3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805af7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805afa:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b01:	00 00 00 
+  805b04:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b07:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805b0a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b11:	48 89 c6             	mov    %rax,%rsi
+  805b14:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805b1b:	00 00 00 
+  805b1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b22:	48 89 c7             	mov    %rax,%rdi
+  805b25:	49 89 df             	mov    %rbx,%r15
+  805b28:	48 b8 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rax
+  805b2f:	ff ff ff 
+  805b32:	48 01 d8             	add    %rbx,%rax
+  805b35:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805b37:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b3e:	00 00 00 
+  805b41:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805b44:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805b48:	bf 05 00 00 00       	mov    $0x5,%edi
+  805b4d:	48 b8 80 c7 ff ff ff 	movabs $0xffffffffffffc780,%rax
+  805b54:	ff ff ff 
+  805b57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b5b:	ff d0                	call   *%rax
+}
+  805b5d:	48 83 c4 10          	add    $0x10,%rsp
+  805b61:	5b                   	pop    %rbx
+  805b62:	41 5f                	pop    %r15
+  805b64:	5d                   	pop    %rbp
+  805b65:	c3                   	ret
+
+0000000000805b66 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805b66:	55                   	push   %rbp
+  805b67:	48 89 e5             	mov    %rsp,%rbp
+  805b6a:	48 83 ec 20          	sub    $0x20,%rsp
+  805b6e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805b6e <nsipc_listen+0x8>
+  805b75:	49 bb d2 34 00 00 00 	movabs $0x34d2,%r11
+  805b7c:	00 00 00 
+  805b7f:	4c 01 d8             	add    %r11,%rax
+  805b82:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805b85:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805b88:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805b8b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805b8e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b91:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805b94:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805b98:	ba 08 00 00 00       	mov    $0x8,%edx
+  805b9d:	48 89 ce             	mov    %rcx,%rsi
+  805ba0:	bf 06 00 00 00       	mov    $0x6,%edi
+  805ba5:	48 b9 23 c8 ff ff ff 	movabs $0xffffffffffffc823,%rcx
+  805bac:	ff ff ff 
+  805baf:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805bb3:	ff d0                	call   *%rax
+}
+  805bb5:	c9                   	leave
+  805bb6:	c3                   	ret
+
+0000000000805bb7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805bb7:	55                   	push   %rbp
+  805bb8:	48 89 e5             	mov    %rsp,%rbp
+  805bbb:	41 57                	push   %r15
+  805bbd:	53                   	push   %rbx
+  805bbe:	48 83 ec 30          	sub    $0x30,%rsp
+  805bc2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bc2 <nsipc_recv+0xb>
+  805bc9:	49 bb 7e 34 00 00 00 	movabs $0x347e,%r11
+  805bd0:	00 00 00 
+  805bd3:	4c 01 db             	add    %r11,%rbx
+  805bd6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805bd9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805bdd:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805be0:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805be3:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805bea:	00 00 00 
+  805bed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bf0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805bf3:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805bfa:	00 00 00 
+  805bfd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805c00:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805c04:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c0b:	00 00 00 
+  805c0e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c11:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805c15:	bf 07 00 00 00       	mov    $0x7,%edi
+  805c1a:	48 b8 80 c7 ff ff ff 	movabs $0xffffffffffffc780,%rax
+  805c21:	ff ff ff 
+  805c24:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c28:	ff d0                	call   *%rax
+  805c2a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c2d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c31:	0f 88 91 00 00 00    	js     805cc8 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805c37:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805c3e:	7f 08                	jg     805c48 <nsipc_recv+0x91>
+  805c40:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c43:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805c46:	7e 50                	jle    805c98 <nsipc_recv+0xe1>
+  805c48:	48 b8 93 e4 ff ff ff 	movabs $0xffffffffffffe493,%rax
+  805c4f:	ff ff ff 
+  805c52:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c56:	48 89 c1             	mov    %rax,%rcx
+  805c59:	48 b8 a8 e4 ff ff ff 	movabs $0xffffffffffffe4a8,%rax
+  805c60:	ff ff ff 
+  805c63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c67:	48 89 c2             	mov    %rax,%rdx
+  805c6a:	be 79 00 00 00       	mov    $0x79,%esi
+  805c6f:	48 b8 bd e4 ff ff ff 	movabs $0xffffffffffffe4bd,%rax
+  805c76:	ff ff ff 
+  805c79:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c7d:	48 89 c7             	mov    %rax,%rdi
+  805c80:	49 89 df             	mov    %rbx,%r15
+  805c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c88:	49 b8 29 da ff ff ff 	movabs $0xffffffffffffda29,%r8
+  805c8f:	ff ff ff 
+  805c92:	49 01 d8             	add    %rbx,%r8
+  805c95:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805c98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c9b:	48 63 d0             	movslq %eax,%rdx
+  805c9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ca2:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805ca9:	00 00 00 
+  805cac:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805cb0:	48 89 ce             	mov    %rcx,%rsi
+  805cb3:	48 89 c7             	mov    %rax,%rdi
+  805cb6:	49 89 df             	mov    %rbx,%r15
+  805cb9:	48 b8 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rax
+  805cc0:	ff ff ff 
+  805cc3:	48 01 d8             	add    %rbx,%rax
+  805cc6:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805cc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805ccb:	48 83 c4 30          	add    $0x30,%rsp
+  805ccf:	5b                   	pop    %rbx
+  805cd0:	41 5f                	pop    %r15
+  805cd2:	5d                   	pop    %rbp
+  805cd3:	c3                   	ret
+
+0000000000805cd4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805cd4:	55                   	push   %rbp
+  805cd5:	48 89 e5             	mov    %rsp,%rbp
+  805cd8:	41 57                	push   %r15
+  805cda:	53                   	push   %rbx
+  805cdb:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805ce2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ce2 <nsipc_send+0xe>
+  805ce9:	49 bb 5e 33 00 00 00 	movabs $0x335e,%r11
+  805cf0:	00 00 00 
+  805cf3:	4c 01 db             	add    %r11,%rbx
+  805cf6:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805cfc:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805d03:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805d09:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805d0f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805d13:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805d17:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805d1e:	00 00 00 
+  805d21:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805d24:	85 c0                	test   %eax,%eax
+  805d26:	75 24                	jne    805d4c <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805d28:	bf 02 00 00 00       	mov    $0x2,%edi
+  805d2d:	49 89 df             	mov    %rbx,%r15
+  805d30:	48 b8 91 aa ff ff ff 	movabs $0xffffffffffffaa91,%rax
+  805d37:	ff ff ff 
+  805d3a:	48 01 d8             	add    %rbx,%rax
+  805d3d:	ff d0                	call   *%rax
+  805d3f:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805d46:	00 00 00 
+  805d49:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805d4c:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805d52:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805d55:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805d5c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805d5f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805d62:	39 c2                	cmp    %eax,%edx
+  805d64:	0f 4e c2             	cmovle %edx,%eax
+  805d67:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805d6d:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805d73:	48 63 d0             	movslq %eax,%rdx
+  805d76:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805d7d:	48 89 c6             	mov    %rax,%rsi
+  805d80:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805d87:	00 00 00 
+  805d8a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d8e:	48 89 c7             	mov    %rax,%rdi
+  805d91:	49 89 df             	mov    %rbx,%r15
+  805d94:	48 b8 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rax
+  805d9b:	ff ff ff 
+  805d9e:	48 01 d8             	add    %rbx,%rax
+  805da1:	ff d0                	call   *%rax
+	req->req_s = s;
+  805da3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805da7:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805dad:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805daf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805db3:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805db9:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805dbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dc0:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805dc6:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805dc9:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805dd0:	00 00 00 
+  805dd3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dd7:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805ddb:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805de2:	00 
+  805de3:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805de9:	48 63 d0             	movslq %eax,%rdx
+  805dec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805df0:	48 01 d0             	add    %rdx,%rax
+  805df3:	48 83 e8 01          	sub    $0x1,%rax
+  805df7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805dfb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805dff:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e04:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805e08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e0c:	48 29 d0             	sub    %rdx,%rax
+  805e0f:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805e15:	85 c0                	test   %eax,%eax
+  805e17:	0f 48 c2             	cmovs  %edx,%eax
+  805e1a:	c1 f8 0c             	sar    $0xc,%eax
+  805e1d:	48 98                	cltq
+  805e1f:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805e23:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805e27:	48 85 c0             	test   %rax,%rax
+  805e2a:	0f 95 c0             	setne  %al
+  805e2d:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805e30:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  805e37:	00 
+  805e38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e3c:	48 83 c0 0b          	add    $0xb,%rax
+  805e40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805e44:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805e48:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e4d:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805e51:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805e55:	48 29 d0             	sub    %rdx,%rax
+  805e58:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805e5c:	89 c7                	mov    %eax,%edi
+  805e5e:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805e65:	00 00 00 
+  805e68:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805e6b:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805e6f:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805e73:	48 83 ec 08          	sub    $0x8,%rsp
+  805e77:	6a 00                	push   $0x0
+  805e79:	6a 00                	push   $0x0
+  805e7b:	6a 05                	push   $0x5
+  805e7d:	41 89 f1             	mov    %esi,%r9d
+  805e80:	49 89 c8             	mov    %rcx,%r8
+  805e83:	89 f9                	mov    %edi,%ecx
+  805e85:	be 08 00 00 00       	mov    $0x8,%esi
+  805e8a:	89 c7                	mov    %eax,%edi
+  805e8c:	49 89 df             	mov    %rbx,%r15
+  805e8f:	48 b8 99 a6 ff ff ff 	movabs $0xffffffffffffa699,%rax
+  805e96:	ff ff ff 
+  805e99:	48 01 d8             	add    %rbx,%rax
+  805e9c:	ff d0                	call   *%rax
+  805e9e:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805ea2:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805ea6:	5b                   	pop    %rbx
+  805ea7:	41 5f                	pop    %r15
+  805ea9:	5d                   	pop    %rbp
+  805eaa:	c3                   	ret
+
+0000000000805eab <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805eab:	55                   	push   %rbp
+  805eac:	48 89 e5             	mov    %rsp,%rbp
+  805eaf:	48 83 ec 10          	sub    $0x10,%rsp
+  805eb3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805eb3 <nsipc_socket+0x8>
+  805eba:	49 bb 8d 31 00 00 00 	movabs $0x318d,%r11
+  805ec1:	00 00 00 
+  805ec4:	4c 01 d8             	add    %r11,%rax
+  805ec7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805eca:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805ecd:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805ed0:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805ed7:	00 00 00 
+  805eda:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805edd:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805ee0:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805ee7:	00 00 00 
+  805eea:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805eed:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805ef1:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805ef8:	00 00 00 
+  805efb:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805efe:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805f02:	bf 09 00 00 00       	mov    $0x9,%edi
+  805f07:	48 ba 80 c7 ff ff ff 	movabs $0xffffffffffffc780,%rdx
+  805f0e:	ff ff ff 
+  805f11:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805f15:	ff d0                	call   *%rax
+}
+  805f17:	c9                   	leave
+  805f18:	c3                   	ret
+
+0000000000805f19 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805f19:	55                   	push   %rbp
+  805f1a:	48 89 e5             	mov    %rsp,%rbp
+  805f1d:	41 57                	push   %r15
+  805f1f:	53                   	push   %rbx
+  805f20:	48 83 ec 30          	sub    $0x30,%rsp
+  805f24:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f24 <pipe+0xb>
+  805f2b:	49 bb 1c 31 00 00 00 	movabs $0x311c,%r11
+  805f32:	00 00 00 
+  805f35:	4c 01 db             	add    %r11,%rbx
+  805f38:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805f3c:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805f40:	48 89 c7             	mov    %rax,%rdi
+  805f43:	49 89 df             	mov    %rbx,%r15
+  805f46:	48 b8 9a ab ff ff ff 	movabs $0xffffffffffffab9a,%rax
+  805f4d:	ff ff ff 
+  805f50:	48 01 d8             	add    %rbx,%rax
+  805f53:	ff d0                	call   *%rax
+  805f55:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f58:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f5c:	0f 88 12 02 00 00    	js     806174 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805f62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f66:	ba 07 04 00 00       	mov    $0x407,%edx
+  805f6b:	48 89 c6             	mov    %rax,%rsi
+  805f6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f73:	49 89 df             	mov    %rbx,%r15
+  805f76:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  805f7d:	ff ff ff 
+  805f80:	48 01 d8             	add    %rbx,%rax
+  805f83:	ff d0                	call   *%rax
+  805f85:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f88:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f8c:	0f 88 e2 01 00 00    	js     806174 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805f92:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805f96:	48 89 c7             	mov    %rax,%rdi
+  805f99:	49 89 df             	mov    %rbx,%r15
+  805f9c:	48 b8 9a ab ff ff ff 	movabs $0xffffffffffffab9a,%rax
+  805fa3:	ff ff ff 
+  805fa6:	48 01 d8             	add    %rbx,%rax
+  805fa9:	ff d0                	call   *%rax
+  805fab:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fae:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fb2:	0f 88 9b 01 00 00    	js     806153 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805fb8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fbc:	ba 07 04 00 00       	mov    $0x407,%edx
+  805fc1:	48 89 c6             	mov    %rax,%rsi
+  805fc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fc9:	49 89 df             	mov    %rbx,%r15
+  805fcc:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  805fd3:	ff ff ff 
+  805fd6:	48 01 d8             	add    %rbx,%rax
+  805fd9:	ff d0                	call   *%rax
+  805fdb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805fde:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805fe2:	0f 88 6b 01 00 00    	js     806153 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805fe8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fec:	48 89 c7             	mov    %rax,%rdi
+  805fef:	49 89 df             	mov    %rbx,%r15
+  805ff2:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  805ff9:	ff ff ff 
+  805ffc:	48 01 d8             	add    %rbx,%rax
+  805fff:	ff d0                	call   *%rax
+  806001:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806005:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806009:	ba 07 04 00 00       	mov    $0x407,%edx
+  80600e:	48 89 c6             	mov    %rax,%rsi
+  806011:	bf 00 00 00 00       	mov    $0x0,%edi
+  806016:	49 89 df             	mov    %rbx,%r15
+  806019:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  806020:	ff ff ff 
+  806023:	48 01 d8             	add    %rbx,%rax
+  806026:	ff d0                	call   *%rax
+  806028:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80602b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80602f:	0f 88 fd 00 00 00    	js     806132 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806035:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806039:	48 89 c7             	mov    %rax,%rdi
+  80603c:	49 89 df             	mov    %rbx,%r15
+  80603f:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  806046:	ff ff ff 
+  806049:	48 01 d8             	add    %rbx,%rax
+  80604c:	ff d0                	call   *%rax
+  80604e:	48 89 c2             	mov    %rax,%rdx
+  806051:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806055:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80605b:	48 89 d1             	mov    %rdx,%rcx
+  80605e:	ba 00 00 00 00       	mov    $0x0,%edx
+  806063:	48 89 c6             	mov    %rax,%rsi
+  806066:	bf 00 00 00 00       	mov    $0x0,%edi
+  80606b:	49 89 df             	mov    %rbx,%r15
+  80606e:	48 b8 84 90 ff ff ff 	movabs $0xffffffffffff9084,%rax
+  806075:	ff ff ff 
+  806078:	48 01 d8             	add    %rbx,%rax
+  80607b:	ff d0                	call   *%rax
+  80607d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806080:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806084:	0f 88 87 00 00 00    	js     806111 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  80608a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80608e:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806095:	00 00 00 
+  806098:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80609b:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  80609d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060a1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8060a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060ac:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8060b3:	00 00 00 
+  8060b6:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8060b9:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8060bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060bf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8060c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060ca:	48 89 c7             	mov    %rax,%rdi
+  8060cd:	49 89 df             	mov    %rbx,%r15
+  8060d0:	48 b8 20 ab ff ff ff 	movabs $0xffffffffffffab20,%rax
+  8060d7:	ff ff ff 
+  8060da:	48 01 d8             	add    %rbx,%rax
+  8060dd:	ff d0                	call   *%rax
+  8060df:	89 c2                	mov    %eax,%edx
+  8060e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8060e5:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8060e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060eb:	48 89 c7             	mov    %rax,%rdi
+  8060ee:	49 89 df             	mov    %rbx,%r15
+  8060f1:	48 b8 20 ab ff ff ff 	movabs $0xffffffffffffab20,%rax
+  8060f8:	ff ff ff 
+  8060fb:	48 01 d8             	add    %rbx,%rax
+  8060fe:	ff d0                	call   *%rax
+  806100:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806104:	48 83 c2 04          	add    $0x4,%rdx
+  806108:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  80610a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80610f:	eb 67                	jmp    806178 <pipe+0x25f>
+		goto err3;
+  806111:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806112:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806116:	48 89 c6             	mov    %rax,%rsi
+  806119:	bf 00 00 00 00       	mov    $0x0,%edi
+  80611e:	49 89 df             	mov    %rbx,%r15
+  806121:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  806128:	ff ff ff 
+  80612b:	48 01 d8             	add    %rbx,%rax
+  80612e:	ff d0                	call   *%rax
+  806130:	eb 01                	jmp    806133 <pipe+0x21a>
+		goto err2;
+  806132:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  806133:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806137:	48 89 c6             	mov    %rax,%rsi
+  80613a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80613f:	49 89 df             	mov    %rbx,%r15
+  806142:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  806149:	ff ff ff 
+  80614c:	48 01 d8             	add    %rbx,%rax
+  80614f:	ff d0                	call   *%rax
+  806151:	eb 01                	jmp    806154 <pipe+0x23b>
+		goto err1;
+  806153:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806154:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806158:	48 89 c6             	mov    %rax,%rsi
+  80615b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806160:	49 89 df             	mov    %rbx,%r15
+  806163:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  80616a:	ff ff ff 
+  80616d:	48 01 d8             	add    %rbx,%rax
+  806170:	ff d0                	call   *%rax
+  806172:	eb 01                	jmp    806175 <pipe+0x25c>
+		goto err;
+  806174:	90                   	nop
+err:
+	return r;
+  806175:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806178:	48 83 c4 30          	add    $0x30,%rsp
+  80617c:	5b                   	pop    %rbx
+  80617d:	41 5f                	pop    %r15
+  80617f:	5d                   	pop    %rbp
+  806180:	c3                   	ret
+
+0000000000806181 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  806181:	55                   	push   %rbp
+  806182:	48 89 e5             	mov    %rsp,%rbp
+  806185:	41 57                	push   %r15
+  806187:	41 54                	push   %r12
+  806189:	53                   	push   %rbx
+  80618a:	48 83 ec 28          	sub    $0x28,%rsp
+  80618e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80618e <_pipeisclosed+0xd>
+  806195:	49 bb b2 2e 00 00 00 	movabs $0x2eb2,%r11
+  80619c:	00 00 00 
+  80619f:	4c 01 db             	add    %r11,%rbx
+  8061a2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8061a6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8061aa:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8061b1:	ff ff ff 
+  8061b4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8061b8:	48 8b 00             	mov    (%rax),%rax
+  8061bb:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8061c1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8061c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8061c8:	48 89 c7             	mov    %rax,%rdi
+  8061cb:	49 89 df             	mov    %rbx,%r15
+  8061ce:	48 b8 04 dd ff ff ff 	movabs $0xffffffffffffdd04,%rax
+  8061d5:	ff ff ff 
+  8061d8:	48 01 d8             	add    %rbx,%rax
+  8061db:	ff d0                	call   *%rax
+  8061dd:	41 89 c4             	mov    %eax,%r12d
+  8061e0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8061e4:	48 89 c7             	mov    %rax,%rdi
+  8061e7:	49 89 df             	mov    %rbx,%r15
+  8061ea:	48 b8 04 dd ff ff ff 	movabs $0xffffffffffffdd04,%rax
+  8061f1:	ff ff ff 
+  8061f4:	48 01 d8             	add    %rbx,%rax
+  8061f7:	ff d0                	call   *%rax
+  8061f9:	41 39 c4             	cmp    %eax,%r12d
+  8061fc:	0f 94 c0             	sete   %al
+  8061ff:	0f b6 c0             	movzbl %al,%eax
+  806202:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806205:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80620c:	ff ff ff 
+  80620f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806213:	48 8b 00             	mov    (%rax),%rax
+  806216:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80621c:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80621f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806222:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806225:	75 05                	jne    80622c <_pipeisclosed+0xab>
+			return ret;
+  806227:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80622a:	eb 63                	jmp    80628f <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  80622c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80622f:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806232:	0f 84 72 ff ff ff    	je     8061aa <_pipeisclosed+0x29>
+  806238:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  80623c:	0f 85 68 ff ff ff    	jne    8061aa <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  806242:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806249:	ff ff ff 
+  80624c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806250:	48 8b 00             	mov    (%rax),%rax
+  806253:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806259:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80625c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80625f:	89 c6                	mov    %eax,%esi
+  806261:	48 b8 ce e4 ff ff ff 	movabs $0xffffffffffffe4ce,%rax
+  806268:	ff ff ff 
+  80626b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80626f:	48 89 c7             	mov    %rax,%rdi
+  806272:	49 89 df             	mov    %rbx,%r15
+  806275:	b8 00 00 00 00       	mov    $0x0,%eax
+  80627a:	49 b8 a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%r8
+  806281:	ff ff ff 
+  806284:	49 01 d8             	add    %rbx,%r8
+  806287:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  80628a:	e9 1b ff ff ff       	jmp    8061aa <_pipeisclosed+0x29>
+	}
+}
+  80628f:	48 83 c4 28          	add    $0x28,%rsp
+  806293:	5b                   	pop    %rbx
+  806294:	41 5c                	pop    %r12
+  806296:	41 5f                	pop    %r15
+  806298:	5d                   	pop    %rbp
+  806299:	c3                   	ret
+
+000000000080629a <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  80629a:	55                   	push   %rbp
+  80629b:	48 89 e5             	mov    %rsp,%rbp
+  80629e:	41 57                	push   %r15
+  8062a0:	53                   	push   %rbx
+  8062a1:	48 83 ec 30          	sub    $0x30,%rsp
+  8062a5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8062a5 <pipeisclosed+0xb>
+  8062ac:	49 bb 9b 2d 00 00 00 	movabs $0x2d9b,%r11
+  8062b3:	00 00 00 
+  8062b6:	4c 01 db             	add    %r11,%rbx
+  8062b9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8062bc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8062c0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8062c3:	48 89 d6             	mov    %rdx,%rsi
+  8062c6:	89 c7                	mov    %eax,%edi
+  8062c8:	49 89 df             	mov    %rbx,%r15
+  8062cb:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  8062d2:	ff ff ff 
+  8062d5:	48 01 d8             	add    %rbx,%rax
+  8062d8:	ff d0                	call   *%rax
+  8062da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062dd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062e1:	79 05                	jns    8062e8 <pipeisclosed+0x4e>
+		return r;
+  8062e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062e6:	eb 3b                	jmp    806323 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8062e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062ec:	48 89 c7             	mov    %rax,%rdi
+  8062ef:	49 89 df             	mov    %rbx,%r15
+  8062f2:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  8062f9:	ff ff ff 
+  8062fc:	48 01 d8             	add    %rbx,%rax
+  8062ff:	ff d0                	call   *%rax
+  806301:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806305:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806309:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80630d:	48 89 d6             	mov    %rdx,%rsi
+  806310:	48 89 c7             	mov    %rax,%rdi
+  806313:	48 b8 41 d1 ff ff ff 	movabs $0xffffffffffffd141,%rax
+  80631a:	ff ff ff 
+  80631d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806321:	ff d0                	call   *%rax
+}
+  806323:	48 83 c4 30          	add    $0x30,%rsp
+  806327:	5b                   	pop    %rbx
+  806328:	41 5f                	pop    %r15
+  80632a:	5d                   	pop    %rbp
+  80632b:	c3                   	ret
+
+000000000080632c <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80632c:	55                   	push   %rbp
+  80632d:	48 89 e5             	mov    %rsp,%rbp
+  806330:	41 57                	push   %r15
+  806332:	53                   	push   %rbx
+  806333:	48 83 ec 40          	sub    $0x40,%rsp
+  806337:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806337 <devpipe_read+0xb>
+  80633e:	49 bb 09 2d 00 00 00 	movabs $0x2d09,%r11
+  806345:	00 00 00 
+  806348:	4c 01 db             	add    %r11,%rbx
+  80634b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80634f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806353:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806357:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80635b:	48 89 c7             	mov    %rax,%rdi
+  80635e:	49 89 df             	mov    %rbx,%r15
+  806361:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  806368:	ff ff ff 
+  80636b:	48 01 d8             	add    %rbx,%rax
+  80636e:	ff d0                	call   *%rax
+  806370:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806374:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806378:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80637c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806383:	00 
+  806384:	e9 a1 00 00 00       	jmp    80642a <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  806389:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80638e:	74 09                	je     806399 <devpipe_read+0x6d>
+				return i;
+  806390:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806394:	e9 9f 00 00 00       	jmp    806438 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  806399:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80639d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063a1:	48 89 d6             	mov    %rdx,%rsi
+  8063a4:	48 89 c7             	mov    %rax,%rdi
+  8063a7:	48 b8 41 d1 ff ff ff 	movabs $0xffffffffffffd141,%rax
+  8063ae:	ff ff ff 
+  8063b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063b5:	ff d0                	call   *%rax
+  8063b7:	85 c0                	test   %eax,%eax
+  8063b9:	74 07                	je     8063c2 <devpipe_read+0x96>
+				return 0;
+  8063bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063c0:	eb 76                	jmp    806438 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8063c2:	49 89 df             	mov    %rbx,%r15
+  8063c5:	48 b8 ca 8f ff ff ff 	movabs $0xffffffffffff8fca,%rax
+  8063cc:	ff ff ff 
+  8063cf:	48 01 d8             	add    %rbx,%rax
+  8063d2:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8063d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063d8:	8b 10                	mov    (%rax),%edx
+  8063da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063de:	8b 40 04             	mov    0x4(%rax),%eax
+  8063e1:	39 c2                	cmp    %eax,%edx
+  8063e3:	74 a4                	je     806389 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8063e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063e9:	8b 10                	mov    (%rax),%edx
+  8063eb:	89 d0                	mov    %edx,%eax
+  8063ed:	c1 f8 1f             	sar    $0x1f,%eax
+  8063f0:	c1 e8 1b             	shr    $0x1b,%eax
+  8063f3:	01 c2                	add    %eax,%edx
+  8063f5:	83 e2 1f             	and    $0x1f,%edx
+  8063f8:	29 c2                	sub    %eax,%edx
+  8063fa:	89 d6                	mov    %edx,%esi
+  8063fc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806400:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806404:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806408:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80640c:	48 63 c6             	movslq %esi,%rax
+  80640f:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806414:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806416:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80641a:	8b 00                	mov    (%rax),%eax
+  80641c:	8d 50 01             	lea    0x1(%rax),%edx
+  80641f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806423:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806425:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80642a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80642e:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806432:	72 a0                	jb     8063d4 <devpipe_read+0xa8>
+	}
+	return i;
+  806434:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806438:	48 83 c4 40          	add    $0x40,%rsp
+  80643c:	5b                   	pop    %rbx
+  80643d:	41 5f                	pop    %r15
+  80643f:	5d                   	pop    %rbp
+  806440:	c3                   	ret
+
+0000000000806441 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806441:	55                   	push   %rbp
+  806442:	48 89 e5             	mov    %rsp,%rbp
+  806445:	41 57                	push   %r15
+  806447:	53                   	push   %rbx
+  806448:	48 83 ec 40          	sub    $0x40,%rsp
+  80644c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80644c <devpipe_write+0xb>
+  806453:	49 bb f4 2b 00 00 00 	movabs $0x2bf4,%r11
+  80645a:	00 00 00 
+  80645d:	4c 01 db             	add    %r11,%rbx
+  806460:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806464:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806468:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  80646c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806470:	48 89 c7             	mov    %rax,%rdi
+  806473:	49 89 df             	mov    %rbx,%r15
+  806476:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  80647d:	ff ff ff 
+  806480:	48 01 d8             	add    %rbx,%rax
+  806483:	ff d0                	call   *%rax
+  806485:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806489:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80648d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806491:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806498:	00 
+  806499:	e9 a0 00 00 00       	jmp    80653e <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80649e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8064a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8064a6:	48 89 d6             	mov    %rdx,%rsi
+  8064a9:	48 89 c7             	mov    %rax,%rdi
+  8064ac:	48 b8 41 d1 ff ff ff 	movabs $0xffffffffffffd141,%rax
+  8064b3:	ff ff ff 
+  8064b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8064ba:	ff d0                	call   *%rax
+  8064bc:	85 c0                	test   %eax,%eax
+  8064be:	74 0a                	je     8064ca <devpipe_write+0x89>
+				return 0;
+  8064c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064c5:	e9 82 00 00 00       	jmp    80654c <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8064ca:	49 89 df             	mov    %rbx,%r15
+  8064cd:	48 b8 ca 8f ff ff ff 	movabs $0xffffffffffff8fca,%rax
+  8064d4:	ff ff ff 
+  8064d7:	48 01 d8             	add    %rbx,%rax
+  8064da:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8064dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8064e0:	8b 40 04             	mov    0x4(%rax),%eax
+  8064e3:	48 63 d0             	movslq %eax,%rdx
+  8064e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8064ea:	8b 00                	mov    (%rax),%eax
+  8064ec:	48 98                	cltq
+  8064ee:	48 83 c0 20          	add    $0x20,%rax
+  8064f2:	48 39 c2             	cmp    %rax,%rdx
+  8064f5:	73 a7                	jae    80649e <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8064f7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8064fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8064ff:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806503:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806507:	8b 50 04             	mov    0x4(%rax),%edx
+  80650a:	89 d0                	mov    %edx,%eax
+  80650c:	c1 f8 1f             	sar    $0x1f,%eax
+  80650f:	c1 e8 1b             	shr    $0x1b,%eax
+  806512:	01 c2                	add    %eax,%edx
+  806514:	83 e2 1f             	and    $0x1f,%edx
+  806517:	29 c2                	sub    %eax,%edx
+  806519:	89 d0                	mov    %edx,%eax
+  80651b:	0f b6 09             	movzbl (%rcx),%ecx
+  80651e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806522:	48 98                	cltq
+  806524:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806528:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80652c:	8b 40 04             	mov    0x4(%rax),%eax
+  80652f:	8d 50 01             	lea    0x1(%rax),%edx
+  806532:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806536:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806539:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80653e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806542:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806546:	72 94                	jb     8064dc <devpipe_write+0x9b>
+	}
+
+	return i;
+  806548:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80654c:	48 83 c4 40          	add    $0x40,%rsp
+  806550:	5b                   	pop    %rbx
+  806551:	41 5f                	pop    %r15
+  806553:	5d                   	pop    %rbp
+  806554:	c3                   	ret
+
+0000000000806555 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806555:	55                   	push   %rbp
+  806556:	48 89 e5             	mov    %rsp,%rbp
+  806559:	41 57                	push   %r15
+  80655b:	53                   	push   %rbx
+  80655c:	48 83 ec 20          	sub    $0x20,%rsp
+  806560:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806560 <devpipe_stat+0xb>
+  806567:	49 bb e0 2a 00 00 00 	movabs $0x2ae0,%r11
+  80656e:	00 00 00 
+  806571:	4c 01 db             	add    %r11,%rbx
+  806574:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806578:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80657c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806580:	48 89 c7             	mov    %rax,%rdi
+  806583:	49 89 df             	mov    %rbx,%r15
+  806586:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  80658d:	ff ff ff 
+  806590:	48 01 d8             	add    %rbx,%rax
+  806593:	ff d0                	call   *%rax
+  806595:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  806599:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80659d:	48 ba e1 e4 ff ff ff 	movabs $0xffffffffffffe4e1,%rdx
+  8065a4:	ff ff ff 
+  8065a7:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8065ab:	48 89 d6             	mov    %rdx,%rsi
+  8065ae:	48 89 c7             	mov    %rax,%rdi
+  8065b1:	49 89 df             	mov    %rbx,%r15
+  8065b4:	48 b8 63 83 ff ff ff 	movabs $0xffffffffffff8363,%rax
+  8065bb:	ff ff ff 
+  8065be:	48 01 d8             	add    %rbx,%rax
+  8065c1:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8065c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065c7:	8b 50 04             	mov    0x4(%rax),%edx
+  8065ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065ce:	8b 00                	mov    (%rax),%eax
+  8065d0:	29 c2                	sub    %eax,%edx
+  8065d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065d6:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8065dc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065e0:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8065e7:	00 00 00 
+	stat->st_dev = &devpipe;
+  8065ea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065ee:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8065f5:	00 00 00 
+  8065f8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8065fc:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806603:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806608:	48 83 c4 20          	add    $0x20,%rsp
+  80660c:	5b                   	pop    %rbx
+  80660d:	41 5f                	pop    %r15
+  80660f:	5d                   	pop    %rbp
+  806610:	c3                   	ret
+
+0000000000806611 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806611:	55                   	push   %rbp
+  806612:	48 89 e5             	mov    %rsp,%rbp
+  806615:	41 57                	push   %r15
+  806617:	53                   	push   %rbx
+  806618:	48 83 ec 10          	sub    $0x10,%rsp
+  80661c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80661c <devpipe_close+0xb>
+  806623:	49 bb 24 2a 00 00 00 	movabs $0x2a24,%r11
+  80662a:	00 00 00 
+  80662d:	4c 01 db             	add    %r11,%rbx
+  806630:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806634:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806638:	48 89 c6             	mov    %rax,%rsi
+  80663b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806640:	49 89 df             	mov    %rbx,%r15
+  806643:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  80664a:	ff ff ff 
+  80664d:	48 01 d8             	add    %rbx,%rax
+  806650:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  806652:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806656:	48 89 c7             	mov    %rax,%rdi
+  806659:	49 89 df             	mov    %rbx,%r15
+  80665c:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  806663:	ff ff ff 
+  806666:	48 01 d8             	add    %rbx,%rax
+  806669:	ff d0                	call   *%rax
+  80666b:	48 89 c6             	mov    %rax,%rsi
+  80666e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806673:	49 89 df             	mov    %rbx,%r15
+  806676:	48 b8 f7 90 ff ff ff 	movabs $0xffffffffffff90f7,%rax
+  80667d:	ff ff ff 
+  806680:	48 01 d8             	add    %rbx,%rax
+  806683:	ff d0                	call   *%rax
+}
+  806685:	48 83 c4 10          	add    $0x10,%rsp
+  806689:	5b                   	pop    %rbx
+  80668a:	41 5f                	pop    %r15
+  80668c:	5d                   	pop    %rbp
+  80668d:	c3                   	ret
+
+000000000080668e <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80668e:	55                   	push   %rbp
+  80668f:	48 89 e5             	mov    %rsp,%rbp
+  806692:	41 57                	push   %r15
+  806694:	48 83 ec 28          	sub    $0x28,%rsp
+  806698:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806698 <cputchar+0xa>
+  80669f:	49 bb a8 29 00 00 00 	movabs $0x29a8,%r11
+  8066a6:	00 00 00 
+  8066a9:	4c 01 d8             	add    %r11,%rax
+  8066ac:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8066af:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8066b2:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8066b5:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8066b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8066be:	48 89 d7             	mov    %rdx,%rdi
+  8066c1:	49 89 c7             	mov    %rax,%r15
+  8066c4:	48 ba 67 8e ff ff ff 	movabs $0xffffffffffff8e67,%rdx
+  8066cb:	ff ff ff 
+  8066ce:	48 01 c2             	add    %rax,%rdx
+  8066d1:	ff d2                	call   *%rdx
+}
+  8066d3:	90                   	nop
+  8066d4:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8066d8:	c9                   	leave
+  8066d9:	c3                   	ret
+
+00000000008066da <getchar>:
+
+int
+getchar(void)
+{
+  8066da:	55                   	push   %rbp
+  8066db:	48 89 e5             	mov    %rsp,%rbp
+  8066de:	41 57                	push   %r15
+  8066e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8066e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8066e4 <getchar+0xa>
+  8066eb:	49 bb 5c 29 00 00 00 	movabs $0x295c,%r11
+  8066f2:	00 00 00 
+  8066f5:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8066f8:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8066fc:	ba 01 00 00 00       	mov    $0x1,%edx
+  806701:	48 89 ce             	mov    %rcx,%rsi
+  806704:	bf 00 00 00 00       	mov    $0x0,%edi
+  806709:	49 89 c7             	mov    %rax,%r15
+  80670c:	48 b9 97 b1 ff ff ff 	movabs $0xffffffffffffb197,%rcx
+  806713:	ff ff ff 
+  806716:	48 01 c1             	add    %rax,%rcx
+  806719:	ff d1                	call   *%rcx
+  80671b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80671e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806722:	79 05                	jns    806729 <getchar+0x4f>
+		return r;
+  806724:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806727:	eb 14                	jmp    80673d <getchar+0x63>
+	if (r < 1)
+  806729:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80672d:	7f 07                	jg     806736 <getchar+0x5c>
+		return -E_EOF;
+  80672f:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806734:	eb 07                	jmp    80673d <getchar+0x63>
+	return c;
+  806736:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  80673a:	0f b6 c0             	movzbl %al,%eax
+}
+  80673d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806741:	c9                   	leave
+  806742:	c3                   	ret
+
+0000000000806743 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806743:	55                   	push   %rbp
+  806744:	48 89 e5             	mov    %rsp,%rbp
+  806747:	41 57                	push   %r15
+  806749:	53                   	push   %rbx
+  80674a:	48 83 ec 20          	sub    $0x20,%rsp
+  80674e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80674e <iscons+0xb>
+  806755:	49 bb f2 28 00 00 00 	movabs $0x28f2,%r11
+  80675c:	00 00 00 
+  80675f:	4c 01 db             	add    %r11,%rbx
+  806762:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806765:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806769:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80676c:	48 89 d6             	mov    %rdx,%rsi
+  80676f:	89 c7                	mov    %eax,%edi
+  806771:	49 89 df             	mov    %rbx,%r15
+  806774:	48 b8 50 ac ff ff ff 	movabs $0xffffffffffffac50,%rax
+  80677b:	ff ff ff 
+  80677e:	48 01 d8             	add    %rbx,%rax
+  806781:	ff d0                	call   *%rax
+  806783:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806786:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80678a:	79 05                	jns    806791 <iscons+0x4e>
+		return r;
+  80678c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80678f:	eb 1b                	jmp    8067ac <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  806791:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806795:	8b 10                	mov    (%rax),%edx
+  806797:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  80679e:	00 00 00 
+  8067a1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8067a4:	39 c2                	cmp    %eax,%edx
+  8067a6:	0f 94 c0             	sete   %al
+  8067a9:	0f b6 c0             	movzbl %al,%eax
+}
+  8067ac:	48 83 c4 20          	add    $0x20,%rsp
+  8067b0:	5b                   	pop    %rbx
+  8067b1:	41 5f                	pop    %r15
+  8067b3:	5d                   	pop    %rbp
+  8067b4:	c3                   	ret
+
+00000000008067b5 <opencons>:
+
+int
+opencons(void)
+{
+  8067b5:	55                   	push   %rbp
+  8067b6:	48 89 e5             	mov    %rsp,%rbp
+  8067b9:	41 57                	push   %r15
+  8067bb:	53                   	push   %rbx
+  8067bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8067c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067c0 <opencons+0xb>
+  8067c7:	49 bb 80 28 00 00 00 	movabs $0x2880,%r11
+  8067ce:	00 00 00 
+  8067d1:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8067d4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8067d8:	48 89 c7             	mov    %rax,%rdi
+  8067db:	49 89 df             	mov    %rbx,%r15
+  8067de:	48 b8 9a ab ff ff ff 	movabs $0xffffffffffffab9a,%rax
+  8067e5:	ff ff ff 
+  8067e8:	48 01 d8             	add    %rbx,%rax
+  8067eb:	ff d0                	call   *%rax
+  8067ed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8067f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067f4:	79 05                	jns    8067fb <opencons+0x46>
+		return r;
+  8067f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067f9:	eb 68                	jmp    806863 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8067fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067ff:	ba 07 04 00 00       	mov    $0x407,%edx
+  806804:	48 89 c6             	mov    %rax,%rsi
+  806807:	bf 00 00 00 00       	mov    $0x0,%edi
+  80680c:	49 89 df             	mov    %rbx,%r15
+  80680f:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  806816:	ff ff ff 
+  806819:	48 01 d8             	add    %rbx,%rax
+  80681c:	ff d0                	call   *%rax
+  80681e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806821:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806825:	79 05                	jns    80682c <opencons+0x77>
+		return r;
+  806827:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80682a:	eb 37                	jmp    806863 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  80682c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806830:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806837:	00 00 00 
+  80683a:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80683d:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80683f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806843:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  80684a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80684e:	48 89 c7             	mov    %rax,%rdi
+  806851:	49 89 df             	mov    %rbx,%r15
+  806854:	48 b8 20 ab ff ff ff 	movabs $0xffffffffffffab20,%rax
+  80685b:	ff ff ff 
+  80685e:	48 01 d8             	add    %rbx,%rax
+  806861:	ff d0                	call   *%rax
+}
+  806863:	48 83 c4 10          	add    $0x10,%rsp
+  806867:	5b                   	pop    %rbx
+  806868:	41 5f                	pop    %r15
+  80686a:	5d                   	pop    %rbp
+  80686b:	c3                   	ret
+
+000000000080686c <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  80686c:	55                   	push   %rbp
+  80686d:	48 89 e5             	mov    %rsp,%rbp
+  806870:	41 57                	push   %r15
+  806872:	53                   	push   %rbx
+  806873:	48 83 ec 30          	sub    $0x30,%rsp
+  806877:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806877 <devcons_read+0xb>
+  80687e:	49 bb c9 27 00 00 00 	movabs $0x27c9,%r11
+  806885:	00 00 00 
+  806888:	4c 01 db             	add    %r11,%rbx
+  80688b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80688f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806893:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806897:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80689c:	75 19                	jne    8068b7 <devcons_read+0x4b>
+		return 0;
+  80689e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068a3:	eb 55                	jmp    8068fa <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8068a5:	49 89 df             	mov    %rbx,%r15
+  8068a8:	48 b8 ca 8f ff ff ff 	movabs $0xffffffffffff8fca,%rax
+  8068af:	ff ff ff 
+  8068b2:	48 01 d8             	add    %rbx,%rax
+  8068b5:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8068b7:	49 89 df             	mov    %rbx,%r15
+  8068ba:	48 b8 c6 8e ff ff ff 	movabs $0xffffffffffff8ec6,%rax
+  8068c1:	ff ff ff 
+  8068c4:	48 01 d8             	add    %rbx,%rax
+  8068c7:	ff d0                	call   *%rax
+  8068c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8068cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068d0:	74 d3                	je     8068a5 <devcons_read+0x39>
+	if (c < 0)
+  8068d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068d6:	79 05                	jns    8068dd <devcons_read+0x71>
+		return c;
+  8068d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068db:	eb 1d                	jmp    8068fa <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8068dd:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8068e1:	75 07                	jne    8068ea <devcons_read+0x7e>
+		return 0;
+  8068e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068e8:	eb 10                	jmp    8068fa <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  8068ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068ed:	89 c2                	mov    %eax,%edx
+  8068ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068f3:	88 10                	mov    %dl,(%rax)
+	return 1;
+  8068f5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8068fa:	48 83 c4 30          	add    $0x30,%rsp
+  8068fe:	5b                   	pop    %rbx
+  8068ff:	41 5f                	pop    %r15
+  806901:	5d                   	pop    %rbp
+  806902:	c3                   	ret
+
+0000000000806903 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806903:	55                   	push   %rbp
+  806904:	48 89 e5             	mov    %rsp,%rbp
+  806907:	41 57                	push   %r15
+  806909:	53                   	push   %rbx
+  80690a:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806911:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806911 <devcons_write+0xe>
+  806918:	49 bb 2f 27 00 00 00 	movabs $0x272f,%r11
+  80691f:	00 00 00 
+  806922:	4c 01 db             	add    %r11,%rbx
+  806925:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  80692c:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806933:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  80693a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806941:	e9 80 00 00 00       	jmp    8069c6 <devcons_write+0xc3>
+		m = n - tot;
+  806946:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80694d:	89 c2                	mov    %eax,%edx
+  80694f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806952:	29 c2                	sub    %eax,%edx
+  806954:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806957:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80695a:	83 f8 7f             	cmp    $0x7f,%eax
+  80695d:	76 07                	jbe    806966 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  80695f:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806966:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806969:	48 63 d0             	movslq %eax,%rdx
+  80696c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80696f:	48 63 c8             	movslq %eax,%rcx
+  806972:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806979:	48 01 c1             	add    %rax,%rcx
+  80697c:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806983:	48 89 ce             	mov    %rcx,%rsi
+  806986:	48 89 c7             	mov    %rax,%rdi
+  806989:	49 89 df             	mov    %rbx,%r15
+  80698c:	48 b8 43 87 ff ff ff 	movabs $0xffffffffffff8743,%rax
+  806993:	ff ff ff 
+  806996:	48 01 d8             	add    %rbx,%rax
+  806999:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  80699b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80699e:	48 63 d0             	movslq %eax,%rdx
+  8069a1:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8069a8:	48 89 d6             	mov    %rdx,%rsi
+  8069ab:	48 89 c7             	mov    %rax,%rdi
+  8069ae:	49 89 df             	mov    %rbx,%r15
+  8069b1:	48 b8 67 8e ff ff ff 	movabs $0xffffffffffff8e67,%rax
+  8069b8:	ff ff ff 
+  8069bb:	48 01 d8             	add    %rbx,%rax
+  8069be:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8069c0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8069c3:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8069c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069c9:	48 98                	cltq
+  8069cb:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8069d2:	0f 82 6e ff ff ff    	jb     806946 <devcons_write+0x43>
+	}
+	return tot;
+  8069d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8069db:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8069e2:	5b                   	pop    %rbx
+  8069e3:	41 5f                	pop    %r15
+  8069e5:	5d                   	pop    %rbp
+  8069e6:	c3                   	ret
+
+00000000008069e7 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  8069e7:	55                   	push   %rbp
+  8069e8:	48 89 e5             	mov    %rsp,%rbp
+  8069eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8069ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8069ef <devcons_close+0x8>
+  8069f6:	49 bb 51 26 00 00 00 	movabs $0x2651,%r11
+  8069fd:	00 00 00 
+  806a00:	4c 01 d8             	add    %r11,%rax
+  806a03:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806a07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a0c:	c9                   	leave
+  806a0d:	c3                   	ret
+
+0000000000806a0e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806a0e:	55                   	push   %rbp
+  806a0f:	48 89 e5             	mov    %rsp,%rbp
+  806a12:	41 57                	push   %r15
+  806a14:	48 83 ec 18          	sub    $0x18,%rsp
+  806a18:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a18 <devcons_stat+0xa>
+  806a1f:	49 bb 28 26 00 00 00 	movabs $0x2628,%r11
+  806a26:	00 00 00 
+  806a29:	4c 01 d8             	add    %r11,%rax
+  806a2c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806a30:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806a34:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806a38:	48 b9 ed e4 ff ff ff 	movabs $0xffffffffffffe4ed,%rcx
+  806a3f:	ff ff ff 
+  806a42:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806a46:	48 89 ce             	mov    %rcx,%rsi
+  806a49:	48 89 d7             	mov    %rdx,%rdi
+  806a4c:	49 89 c7             	mov    %rax,%r15
+  806a4f:	48 ba 63 83 ff ff ff 	movabs $0xffffffffffff8363,%rdx
+  806a56:	ff ff ff 
+  806a59:	48 01 c2             	add    %rax,%rdx
+  806a5c:	ff d2                	call   *%rdx
+	return 0;
+  806a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a63:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806a67:	c9                   	leave
+  806a68:	c3                   	ret
+
+0000000000806a69 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  806a69:	55                   	push   %rbp
+  806a6a:	48 89 e5             	mov    %rsp,%rbp
+  806a6d:	41 57                	push   %r15
+  806a6f:	41 54                	push   %r12
+  806a71:	53                   	push   %rbx
+  806a72:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  806a79:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a79 <_panic+0x10>
+  806a80:	49 bb c7 25 00 00 00 	movabs $0x25c7,%r11
+  806a87:	00 00 00 
+  806a8a:	4c 01 db             	add    %r11,%rbx
+  806a8d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  806a94:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  806a9a:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  806aa1:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  806aa8:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  806aaf:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  806ab6:	84 c0                	test   %al,%al
+  806ab8:	74 26                	je     806ae0 <_panic+0x77>
+  806aba:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  806ac1:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  806ac8:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  806acc:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  806ad0:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  806ad4:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  806ad8:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  806adc:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  806ae0:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  806ae7:	00 00 00 
+  806aea:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  806af1:	00 00 00 
+  806af4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  806af8:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  806aff:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  806b06:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  806b0d:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  806b14:	ff ff ff 
+  806b17:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b1b:	4c 8b 20             	mov    (%rax),%r12
+  806b1e:	49 89 df             	mov    %rbx,%r15
+  806b21:	48 b8 76 8f ff ff ff 	movabs $0xffffffffffff8f76,%rax
+  806b28:	ff ff ff 
+  806b2b:	48 01 d8             	add    %rbx,%rax
+  806b2e:	ff d0                	call   *%rax
+  806b30:	89 c6                	mov    %eax,%esi
+  806b32:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  806b38:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  806b3f:	41 89 d0             	mov    %edx,%r8d
+  806b42:	48 89 c1             	mov    %rax,%rcx
+  806b45:	4c 89 e2             	mov    %r12,%rdx
+  806b48:	48 b8 f8 e4 ff ff ff 	movabs $0xffffffffffffe4f8,%rax
+  806b4f:	ff ff ff 
+  806b52:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b56:	48 89 c7             	mov    %rax,%rdi
+  806b59:	49 89 df             	mov    %rbx,%r15
+  806b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b61:	49 b9 a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%r9
+  806b68:	ff ff ff 
+  806b6b:	49 01 d9             	add    %rbx,%r9
+  806b6e:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  806b71:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  806b78:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  806b7f:	48 89 d6             	mov    %rdx,%rsi
+  806b82:	48 89 c7             	mov    %rax,%rdi
+  806b85:	49 89 df             	mov    %rbx,%r15
+  806b88:	48 b8 c1 74 ff ff ff 	movabs $0xffffffffffff74c1,%rax
+  806b8f:	ff ff ff 
+  806b92:	48 01 d8             	add    %rbx,%rax
+  806b95:	ff d0                	call   *%rax
+	cprintf("\n");
+  806b97:	48 b8 1b e5 ff ff ff 	movabs $0xffffffffffffe51b,%rax
+  806b9e:	ff ff ff 
+  806ba1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806ba5:	48 89 c7             	mov    %rax,%rdi
+  806ba8:	49 89 df             	mov    %rbx,%r15
+  806bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  806bb0:	48 ba a1 75 ff ff ff 	movabs $0xffffffffffff75a1,%rdx
+  806bb7:	ff ff ff 
+  806bba:	48 01 da             	add    %rbx,%rdx
+  806bbd:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  806bbf:	cc                   	int3
+  806bc0:	eb fd                	jmp    806bbf <_panic+0x156>
+
+0000000000806bc2 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806bc2:	55                   	push   %rbp
+  806bc3:	48 89 e5             	mov    %rsp,%rbp
+  806bc6:	41 57                	push   %r15
+  806bc8:	53                   	push   %rbx
+  806bc9:	48 83 ec 20          	sub    $0x20,%rsp
+  806bcd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806bcd <set_pgfault_handler+0xb>
+  806bd4:	49 bb 73 24 00 00 00 	movabs $0x2473,%r11
+  806bdb:	00 00 00 
+  806bde:	4c 01 db             	add    %r11,%rbx
+  806be1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806be5:	49 89 df             	mov    %rbx,%r15
+  806be8:	48 b8 76 8f ff ff ff 	movabs $0xffffffffffff8f76,%rax
+  806bef:	ff ff ff 
+  806bf2:	48 01 d8             	add    %rbx,%rax
+  806bf5:	ff d0                	call   *%rax
+  806bf7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806bfa:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806c01:	00 00 00 
+  806c04:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c08:	48 85 c0             	test   %rax,%rax
+  806c0b:	75 6b                	jne    806c78 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806c0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c10:	ba 07 00 00 00       	mov    $0x7,%edx
+  806c15:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806c1a:	48 89 ce             	mov    %rcx,%rsi
+  806c1d:	89 c7                	mov    %eax,%edi
+  806c1f:	49 89 df             	mov    %rbx,%r15
+  806c22:	48 b8 1f 90 ff ff ff 	movabs $0xffffffffffff901f,%rax
+  806c29:	ff ff ff 
+  806c2c:	48 01 d8             	add    %rbx,%rax
+  806c2f:	ff d0                	call   *%rax
+  806c31:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806c34:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806c38:	74 3e                	je     806c78 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806c3a:	48 b8 20 e5 ff ff ff 	movabs $0xffffffffffffe520,%rax
+  806c41:	ff ff ff 
+  806c44:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806c48:	48 89 c2             	mov    %rax,%rdx
+  806c4b:	be 23 00 00 00       	mov    $0x23,%esi
+  806c50:	48 b8 4e e5 ff ff ff 	movabs $0xffffffffffffe54e,%rax
+  806c57:	ff ff ff 
+  806c5a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806c5e:	48 89 c7             	mov    %rax,%rdi
+  806c61:	49 89 df             	mov    %rbx,%r15
+  806c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c69:	48 b9 29 da ff ff ff 	movabs $0xffffffffffffda29,%rcx
+  806c70:	ff ff ff 
+  806c73:	48 01 d9             	add    %rbx,%rcx
+  806c76:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806c78:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806c7f:	00 00 00 
+  806c82:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806c86:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806c8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c8d:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806c94:	ff ff ff 
+  806c97:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806c9b:	48 89 d6             	mov    %rdx,%rsi
+  806c9e:	89 c7                	mov    %eax,%edi
+  806ca0:	49 89 df             	mov    %rbx,%r15
+  806ca3:	48 b8 15 92 ff ff ff 	movabs $0xffffffffffff9215,%rax
+  806caa:	ff ff ff 
+  806cad:	48 01 d8             	add    %rbx,%rax
+  806cb0:	ff d0                	call   *%rax
+}
+  806cb2:	90                   	nop
+  806cb3:	48 83 c4 20          	add    $0x20,%rsp
+  806cb7:	5b                   	pop    %rbx
+  806cb8:	41 5f                	pop    %r15
+  806cba:	5d                   	pop    %rbp
+  806cbb:	c3                   	ret
+
+0000000000806cbc <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806cbc:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806cbf:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806cc6:	00 00 00 
+call *%rax
+  806cc9:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806ccb:	58                   	pop    %rax
+	popq %rax;
+  806ccc:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806ccd:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806cd4:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806cd8:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806cdc:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806ce0:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806ce4:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806ce8:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806ceb:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806cef:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806cf3:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806cf8:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806cfd:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806d02:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806d07:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806d0c:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806d11:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806d16:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806d1b:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806d20:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806d25:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806d2a:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806d2f:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806d34:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806d39:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806d3d:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806d41:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806d42:	5c                   	pop    %rsp
+	ret;			//return
+  806d43:	c3                   	ret
+
+0000000000806d44 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806d44:	55                   	push   %rbp
+  806d45:	48 89 e5             	mov    %rsp,%rbp
+  806d48:	48 83 ec 18          	sub    $0x18,%rsp
+  806d4c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d4c <pageref+0x8>
+  806d53:	49 bb f4 22 00 00 00 	movabs $0x22f4,%r11
+  806d5a:	00 00 00 
+  806d5d:	4c 01 d8             	add    %r11,%rax
+  806d60:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806d64:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806d68:	48 89 d1             	mov    %rdx,%rcx
+  806d6b:	48 c1 e9 15          	shr    $0x15,%rcx
+  806d6f:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806d76:	ff ff ff 
+  806d79:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806d7d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806d81:	83 e2 01             	and    $0x1,%edx
+  806d84:	48 85 d2             	test   %rdx,%rdx
+  806d87:	75 07                	jne    806d90 <pageref+0x4c>
+		return 0;
+  806d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d8e:	eb 64                	jmp    806df4 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806d90:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806d94:	48 89 d1             	mov    %rdx,%rcx
+  806d97:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806d9b:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806da2:	ff ff ff 
+  806da5:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806da9:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806dad:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806db1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806db5:	83 e2 01             	and    $0x1,%edx
+  806db8:	48 85 d2             	test   %rdx,%rdx
+  806dbb:	75 07                	jne    806dc4 <pageref+0x80>
+		return 0;
+  806dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  806dc2:	eb 30                	jmp    806df4 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806dc4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806dc8:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806dcc:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806dd3:	ff ff ff 
+  806dd6:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806dda:	48 89 d0             	mov    %rdx,%rax
+  806ddd:	48 01 c0             	add    %rax,%rax
+  806de0:	48 01 d0             	add    %rdx,%rax
+  806de3:	48 c1 e0 03          	shl    $0x3,%rax
+  806de7:	48 01 c8             	add    %rcx,%rax
+  806dea:	48 83 c0 08          	add    $0x8,%rax
+  806dee:	0f b7 00             	movzwl (%rax),%eax
+  806df1:	0f b7 c0             	movzwl %ax,%eax
+}
+  806df4:	c9                   	leave
+  806df5:	c3                   	ret
@@ -0,0 +1,14317 @@
+
+obj/user/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 75 16 00 00       	call   8016b6 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <runcmd>:
+// runcmd() is called in a forked child,
+// so it's OK to manipulate file descriptor state.
+#define MAXARGS 16
+void
+runcmd(char* s)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 81 ec 60 05 00 00 	sub    $0x560,%rsp
+  800051:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800051 <runcmd+0xe>
+  800058:	49 bb f7 bf 00 00 00 	movabs $0xbff7,%r11
+  80005f:	00 00 00 
+  800062:	4c 01 db             	add    %r11,%rbx
+  800065:	48 89 bd 98 fa ff ff 	mov    %rdi,-0x568(%rbp)
+	char *argv[MAXARGS], *t, argv0buf[BUFSIZ];
+	int argc, c, i, r, p[2], fd, pipe_child;
+
+	pipe_child = 0;
+  80006c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+	gettoken(s, 0);
+  800073:	48 8b 85 98 fa ff ff 	mov    -0x568(%rbp),%rax
+  80007a:	be 00 00 00 00       	mov    $0x0,%esi
+  80007f:	48 89 c7             	mov    %rax,%rdi
+  800082:	48 b8 b1 4c ff ff ff 	movabs $0xffffffffffff4cb1,%rax
+  800089:	ff ff ff 
+  80008c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800090:	ff d0                	call   *%rax
+
+again:
+	argc = 0;
+  800092:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	while (1) {
+		switch ((c = gettoken(0, &t))) {
+  800099:	48 8d 85 48 ff ff ff 	lea    -0xb8(%rbp),%rax
+  8000a0:	48 89 c6             	mov    %rax,%rsi
+  8000a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a8:	48 b8 b1 4c ff ff ff 	movabs $0xffffffffffff4cb1,%rax
+  8000af:	ff ff ff 
+  8000b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000b6:	ff d0                	call   *%rax
+  8000b8:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8000bb:	83 7d e0 7c          	cmpl   $0x7c,-0x20(%rbp)
+  8000bf:	0f 84 c4 02 00 00    	je     800389 <runcmd+0x346>
+  8000c5:	83 7d e0 7c          	cmpl   $0x7c,-0x20(%rbp)
+  8000c9:	0f 8f 8d 04 00 00    	jg     80055c <runcmd+0x519>
+  8000cf:	83 7d e0 77          	cmpl   $0x77,-0x20(%rbp)
+  8000d3:	74 33                	je     800108 <runcmd+0xc5>
+  8000d5:	83 7d e0 77          	cmpl   $0x77,-0x20(%rbp)
+  8000d9:	0f 8f 7d 04 00 00    	jg     80055c <runcmd+0x519>
+  8000df:	83 7d e0 3e          	cmpl   $0x3e,-0x20(%rbp)
+  8000e3:	0f 84 8f 01 00 00    	je     800278 <runcmd+0x235>
+  8000e9:	83 7d e0 3e          	cmpl   $0x3e,-0x20(%rbp)
+  8000ed:	0f 8f 69 04 00 00    	jg     80055c <runcmd+0x519>
+  8000f3:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8000f7:	0f 84 af 04 00 00    	je     8005ac <runcmd+0x569>
+  8000fd:	83 7d e0 3c          	cmpl   $0x3c,-0x20(%rbp)
+  800101:	74 64                	je     800167 <runcmd+0x124>
+  800103:	e9 54 04 00 00       	jmp    80055c <runcmd+0x519>
+
+		case 'w':	// Add an argument
+			if (argc == MAXARGS) {
+  800108:	83 7d ec 10          	cmpl   $0x10,-0x14(%rbp)
+  80010c:	75 3a                	jne    800148 <runcmd+0x105>
+				cprintf("too many arguments\n");
+  80010e:	48 b8 f0 d8 ff ff ff 	movabs $0xffffffffffffd8f0,%rax
+  800115:	ff ff ff 
+  800118:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80011c:	48 89 c7             	mov    %rax,%rdi
+  80011f:	49 89 df             	mov    %rbx,%r15
+  800122:	b8 00 00 00 00       	mov    $0x0,%eax
+  800127:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  80012e:	ff ff ff 
+  800131:	48 01 da             	add    %rbx,%rdx
+  800134:	ff d2                	call   *%rdx
+				exit();
+  800136:	49 89 df             	mov    %rbx,%r15
+  800139:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  800140:	ff ff ff 
+  800143:	48 01 d8             	add    %rbx,%rax
+  800146:	ff d0                	call   *%rax
+			}
+			argv[argc++] = t;
+  800148:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80014b:	8d 50 01             	lea    0x1(%rax),%edx
+  80014e:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  800151:	48 8b 95 48 ff ff ff 	mov    -0xb8(%rbp),%rdx
+  800158:	48 98                	cltq
+  80015a:	48 89 94 c5 50 ff ff 	mov    %rdx,-0xb0(%rbp,%rax,8)
+  800161:	ff 
+			break;
+  800162:	e9 40 04 00 00       	jmp    8005a7 <runcmd+0x564>
+
+		case '<':	// Input redirection
+			// Grab the filename from the argument list
+			if (gettoken(0, &t) != 'w') {
+  800167:	48 8d 85 48 ff ff ff 	lea    -0xb8(%rbp),%rax
+  80016e:	48 89 c6             	mov    %rax,%rsi
+  800171:	bf 00 00 00 00       	mov    $0x0,%edi
+  800176:	48 b8 b1 4c ff ff ff 	movabs $0xffffffffffff4cb1,%rax
+  80017d:	ff ff ff 
+  800180:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800184:	ff d0                	call   *%rax
+  800186:	83 f8 77             	cmp    $0x77,%eax
+  800189:	74 3a                	je     8001c5 <runcmd+0x182>
+				cprintf("syntax error: < not followed by word\n");
+  80018b:	48 b8 08 d9 ff ff ff 	movabs $0xffffffffffffd908,%rax
+  800192:	ff ff ff 
+  800195:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800199:	48 89 c7             	mov    %rax,%rdi
+  80019c:	49 89 df             	mov    %rbx,%r15
+  80019f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a4:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8001ab:	ff ff ff 
+  8001ae:	48 01 da             	add    %rbx,%rdx
+  8001b1:	ff d2                	call   *%rdx
+				exit();
+  8001b3:	49 89 df             	mov    %rbx,%r15
+  8001b6:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  8001bd:	ff ff ff 
+  8001c0:	48 01 d8             	add    %rbx,%rax
+  8001c3:	ff d0                	call   *%rax
+			}
+			if ((fd = open(t, O_RDONLY)) < 0) {
+  8001c5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8001cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8001d1:	48 89 c7             	mov    %rax,%rdi
+  8001d4:	49 89 df             	mov    %rbx,%r15
+  8001d7:	48 b8 51 9b ff ff ff 	movabs $0xffffffffffff9b51,%rax
+  8001de:	ff ff ff 
+  8001e1:	48 01 d8             	add    %rbx,%rax
+  8001e4:	ff d0                	call   *%rax
+  8001e6:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8001e9:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8001ed:	79 47                	jns    800236 <runcmd+0x1f3>
+				cprintf("open %s for read: %e", t, fd);
+  8001ef:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8001f6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8001f9:	48 89 c6             	mov    %rax,%rsi
+  8001fc:	48 b8 2e d9 ff ff ff 	movabs $0xffffffffffffd92e,%rax
+  800203:	ff ff ff 
+  800206:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80020a:	48 89 c7             	mov    %rax,%rdi
+  80020d:	49 89 df             	mov    %rbx,%r15
+  800210:	b8 00 00 00 00       	mov    $0x0,%eax
+  800215:	48 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rcx
+  80021c:	ff ff ff 
+  80021f:	48 01 d9             	add    %rbx,%rcx
+  800222:	ff d1                	call   *%rcx
+				exit();
+  800224:	49 89 df             	mov    %rbx,%r15
+  800227:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  80022e:	ff ff ff 
+  800231:	48 01 d8             	add    %rbx,%rax
+  800234:	ff d0                	call   *%rax
+			}
+			if (fd != 0) {
+  800236:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80023a:	0f 84 60 03 00 00    	je     8005a0 <runcmd+0x55d>
+				dup(fd, 0);
+  800240:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800243:	be 00 00 00 00       	mov    $0x0,%esi
+  800248:	89 c7                	mov    %eax,%edi
+  80024a:	49 89 df             	mov    %rbx,%r15
+  80024d:	48 b8 83 91 ff ff ff 	movabs $0xffffffffffff9183,%rax
+  800254:	ff ff ff 
+  800257:	48 01 d8             	add    %rbx,%rax
+  80025a:	ff d0                	call   *%rax
+				close(fd);
+  80025c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80025f:	89 c7                	mov    %eax,%edi
+  800261:	49 89 df             	mov    %rbx,%r15
+  800264:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  80026b:	ff ff ff 
+  80026e:	48 01 d8             	add    %rbx,%rax
+  800271:	ff d0                	call   *%rax
+			}
+			break;
+  800273:	e9 28 03 00 00       	jmp    8005a0 <runcmd+0x55d>
+
+		case '>':	// Output redirection
+			// Grab the filename from the argument list
+			if (gettoken(0, &t) != 'w') {
+  800278:	48 8d 85 48 ff ff ff 	lea    -0xb8(%rbp),%rax
+  80027f:	48 89 c6             	mov    %rax,%rsi
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+  800287:	48 b8 b1 4c ff ff ff 	movabs $0xffffffffffff4cb1,%rax
+  80028e:	ff ff ff 
+  800291:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800295:	ff d0                	call   *%rax
+  800297:	83 f8 77             	cmp    $0x77,%eax
+  80029a:	74 3a                	je     8002d6 <runcmd+0x293>
+				cprintf("syntax error: > not followed by word\n");
+  80029c:	48 b8 48 d9 ff ff ff 	movabs $0xffffffffffffd948,%rax
+  8002a3:	ff ff ff 
+  8002a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002aa:	48 89 c7             	mov    %rax,%rdi
+  8002ad:	49 89 df             	mov    %rbx,%r15
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8002bc:	ff ff ff 
+  8002bf:	48 01 da             	add    %rbx,%rdx
+  8002c2:	ff d2                	call   *%rdx
+				exit();
+  8002c4:	49 89 df             	mov    %rbx,%r15
+  8002c7:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  8002ce:	ff ff ff 
+  8002d1:	48 01 d8             	add    %rbx,%rax
+  8002d4:	ff d0                	call   *%rax
+			}
+			if ((fd = open(t, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+  8002d6:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8002dd:	be 01 03 00 00       	mov    $0x301,%esi
+  8002e2:	48 89 c7             	mov    %rax,%rdi
+  8002e5:	49 89 df             	mov    %rbx,%r15
+  8002e8:	48 b8 51 9b ff ff ff 	movabs $0xffffffffffff9b51,%rax
+  8002ef:	ff ff ff 
+  8002f2:	48 01 d8             	add    %rbx,%rax
+  8002f5:	ff d0                	call   *%rax
+  8002f7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8002fa:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8002fe:	79 47                	jns    800347 <runcmd+0x304>
+				cprintf("open %s for write: %e", t, fd);
+  800300:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800307:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80030a:	48 89 c6             	mov    %rax,%rsi
+  80030d:	48 b8 6e d9 ff ff ff 	movabs $0xffffffffffffd96e,%rax
+  800314:	ff ff ff 
+  800317:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80031b:	48 89 c7             	mov    %rax,%rdi
+  80031e:	49 89 df             	mov    %rbx,%r15
+  800321:	b8 00 00 00 00       	mov    $0x0,%eax
+  800326:	48 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rcx
+  80032d:	ff ff ff 
+  800330:	48 01 d9             	add    %rbx,%rcx
+  800333:	ff d1                	call   *%rcx
+				exit();
+  800335:	49 89 df             	mov    %rbx,%r15
+  800338:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  80033f:	ff ff ff 
+  800342:	48 01 d8             	add    %rbx,%rax
+  800345:	ff d0                	call   *%rax
+			}
+			if (fd != 1) {
+  800347:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  80034b:	0f 84 55 02 00 00    	je     8005a6 <runcmd+0x563>
+				dup(fd, 1);
+  800351:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800354:	be 01 00 00 00       	mov    $0x1,%esi
+  800359:	89 c7                	mov    %eax,%edi
+  80035b:	49 89 df             	mov    %rbx,%r15
+  80035e:	48 b8 83 91 ff ff ff 	movabs $0xffffffffffff9183,%rax
+  800365:	ff ff ff 
+  800368:	48 01 d8             	add    %rbx,%rax
+  80036b:	ff d0                	call   *%rax
+				close(fd);
+  80036d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800370:	89 c7                	mov    %eax,%edi
+  800372:	49 89 df             	mov    %rbx,%r15
+  800375:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  80037c:	ff ff ff 
+  80037f:	48 01 d8             	add    %rbx,%rax
+  800382:	ff d0                	call   *%rax
+			}
+			break;
+  800384:	e9 1d 02 00 00       	jmp    8005a6 <runcmd+0x563>
+
+		case '|':	// Pipe
+			if ((r = pipe(p)) < 0) {
+  800389:	48 8d 85 38 fb ff ff 	lea    -0x4c8(%rbp),%rax
+  800390:	48 89 c7             	mov    %rax,%rdi
+  800393:	49 89 df             	mov    %rbx,%r15
+  800396:	48 b8 94 c6 ff ff ff 	movabs $0xffffffffffffc694,%rax
+  80039d:	ff ff ff 
+  8003a0:	48 01 d8             	add    %rbx,%rax
+  8003a3:	ff d0                	call   *%rax
+  8003a5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8003a8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8003ac:	79 3f                	jns    8003ed <runcmd+0x3aa>
+				cprintf("pipe: %e", r);
+  8003ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8003b1:	89 c6                	mov    %eax,%esi
+  8003b3:	48 b8 84 d9 ff ff ff 	movabs $0xffffffffffffd984,%rax
+  8003ba:	ff ff ff 
+  8003bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003c1:	48 89 c7             	mov    %rax,%rdi
+  8003c4:	49 89 df             	mov    %rbx,%r15
+  8003c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cc:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8003d3:	ff ff ff 
+  8003d6:	48 01 da             	add    %rbx,%rdx
+  8003d9:	ff d2                	call   *%rdx
+				exit();
+  8003db:	49 89 df             	mov    %rbx,%r15
+  8003de:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  8003e5:	ff ff ff 
+  8003e8:	48 01 d8             	add    %rbx,%rax
+  8003eb:	ff d0                	call   *%rax
+			}
+			if (debug)
+  8003ed:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  8003f4:	00 00 00 
+  8003f7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8003fa:	85 c0                	test   %eax,%eax
+  8003fc:	74 36                	je     800434 <runcmd+0x3f1>
+				cprintf("PIPE: %d %d\n", p[0], p[1]);
+  8003fe:	8b 95 3c fb ff ff    	mov    -0x4c4(%rbp),%edx
+  800404:	8b 85 38 fb ff ff    	mov    -0x4c8(%rbp),%eax
+  80040a:	89 c6                	mov    %eax,%esi
+  80040c:	48 b8 8d d9 ff ff ff 	movabs $0xffffffffffffd98d,%rax
+  800413:	ff ff ff 
+  800416:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80041a:	48 89 c7             	mov    %rax,%rdi
+  80041d:	49 89 df             	mov    %rbx,%r15
+  800420:	b8 00 00 00 00       	mov    $0x0,%eax
+  800425:	48 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rcx
+  80042c:	ff ff ff 
+  80042f:	48 01 d9             	add    %rbx,%rcx
+  800432:	ff d1                	call   *%rcx
+			if ((r = fork()) < 0) {
+  800434:	49 89 df             	mov    %rbx,%r15
+  800437:	48 b8 1a 86 ff ff ff 	movabs $0xffffffffffff861a,%rax
+  80043e:	ff ff ff 
+  800441:	48 01 d8             	add    %rbx,%rax
+  800444:	ff d0                	call   *%rax
+  800446:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800449:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80044d:	79 3f                	jns    80048e <runcmd+0x44b>
+				cprintf("fork: %e", r);
+  80044f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800452:	89 c6                	mov    %eax,%esi
+  800454:	48 b8 9a d9 ff ff ff 	movabs $0xffffffffffffd99a,%rax
+  80045b:	ff ff ff 
+  80045e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800462:	48 89 c7             	mov    %rax,%rdi
+  800465:	49 89 df             	mov    %rbx,%r15
+  800468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046d:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  800474:	ff ff ff 
+  800477:	48 01 da             	add    %rbx,%rdx
+  80047a:	ff d2                	call   *%rdx
+				exit();
+  80047c:	49 89 df             	mov    %rbx,%r15
+  80047f:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  800486:	ff ff ff 
+  800489:	48 01 d8             	add    %rbx,%rax
+  80048c:	ff d0                	call   *%rax
+			}
+			if (r == 0) {
+  80048e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800492:	75 62                	jne    8004f6 <runcmd+0x4b3>
+				if (p[0] != 0) {
+  800494:	8b 85 38 fb ff ff    	mov    -0x4c8(%rbp),%eax
+  80049a:	85 c0                	test   %eax,%eax
+  80049c:	74 39                	je     8004d7 <runcmd+0x494>
+					dup(p[0], 0);
+  80049e:	8b 85 38 fb ff ff    	mov    -0x4c8(%rbp),%eax
+  8004a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8004a9:	89 c7                	mov    %eax,%edi
+  8004ab:	49 89 df             	mov    %rbx,%r15
+  8004ae:	48 b8 83 91 ff ff ff 	movabs $0xffffffffffff9183,%rax
+  8004b5:	ff ff ff 
+  8004b8:	48 01 d8             	add    %rbx,%rax
+  8004bb:	ff d0                	call   *%rax
+					close(p[0]);
+  8004bd:	8b 85 38 fb ff ff    	mov    -0x4c8(%rbp),%eax
+  8004c3:	89 c7                	mov    %eax,%edi
+  8004c5:	49 89 df             	mov    %rbx,%r15
+  8004c8:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  8004cf:	ff ff ff 
+  8004d2:	48 01 d8             	add    %rbx,%rax
+  8004d5:	ff d0                	call   *%rax
+				}
+				close(p[1]);
+  8004d7:	8b 85 3c fb ff ff    	mov    -0x4c4(%rbp),%eax
+  8004dd:	89 c7                	mov    %eax,%edi
+  8004df:	49 89 df             	mov    %rbx,%r15
+  8004e2:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  8004e9:	ff ff ff 
+  8004ec:	48 01 d8             	add    %rbx,%rax
+  8004ef:	ff d0                	call   *%rax
+				goto again;
+  8004f1:	e9 9c fb ff ff       	jmp    800092 <runcmd+0x4f>
+			} else {
+				pipe_child = r;
+  8004f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004f9:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+				if (p[1] != 1) {
+  8004fc:	8b 85 3c fb ff ff    	mov    -0x4c4(%rbp),%eax
+  800502:	83 f8 01             	cmp    $0x1,%eax
+  800505:	74 39                	je     800540 <runcmd+0x4fd>
+					dup(p[1], 1);
+  800507:	8b 85 3c fb ff ff    	mov    -0x4c4(%rbp),%eax
+  80050d:	be 01 00 00 00       	mov    $0x1,%esi
+  800512:	89 c7                	mov    %eax,%edi
+  800514:	49 89 df             	mov    %rbx,%r15
+  800517:	48 b8 83 91 ff ff ff 	movabs $0xffffffffffff9183,%rax
+  80051e:	ff ff ff 
+  800521:	48 01 d8             	add    %rbx,%rax
+  800524:	ff d0                	call   *%rax
+					close(p[1]);
+  800526:	8b 85 3c fb ff ff    	mov    -0x4c4(%rbp),%eax
+  80052c:	89 c7                	mov    %eax,%edi
+  80052e:	49 89 df             	mov    %rbx,%r15
+  800531:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  800538:	ff ff ff 
+  80053b:	48 01 d8             	add    %rbx,%rax
+  80053e:	ff d0                	call   *%rax
+				}
+				close(p[0]);
+  800540:	8b 85 38 fb ff ff    	mov    -0x4c8(%rbp),%eax
+  800546:	89 c7                	mov    %eax,%edi
+  800548:	49 89 df             	mov    %rbx,%r15
+  80054b:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  800552:	ff ff ff 
+  800555:	48 01 d8             	add    %rbx,%rax
+  800558:	ff d0                	call   *%rax
+				goto runit;
+  80055a:	eb 51                	jmp    8005ad <runcmd+0x56a>
+		case 0:		// String is complete
+			// Run the current command!
+			goto runit;
+
+		default:
+			panic("bad return %d from gettoken", c);
+  80055c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80055f:	89 c1                	mov    %eax,%ecx
+  800561:	48 b8 a3 d9 ff ff ff 	movabs $0xffffffffffffd9a3,%rax
+  800568:	ff ff ff 
+  80056b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80056f:	48 89 c2             	mov    %rax,%rdx
+  800572:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800577:	48 b8 bf d9 ff ff ff 	movabs $0xffffffffffffd9bf,%rax
+  80057e:	ff ff ff 
+  800581:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800585:	48 89 c7             	mov    %rax,%rdi
+  800588:	49 89 df             	mov    %rbx,%r15
+  80058b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800590:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  800597:	ff ff ff 
+  80059a:	49 01 d8             	add    %rbx,%r8
+  80059d:	41 ff d0             	call   *%r8
+			break;
+  8005a0:	90                   	nop
+  8005a1:	e9 f3 fa ff ff       	jmp    800099 <runcmd+0x56>
+			break;
+  8005a6:	90                   	nop
+		switch ((c = gettoken(0, &t))) {
+  8005a7:	e9 ed fa ff ff       	jmp    800099 <runcmd+0x56>
+			goto runit;
+  8005ac:	90                   	nop
+		}
+	}
+
+runit:
+	// Return immediately if command line was empty.
+	if(argc == 0) {
+  8005ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8005b1:	75 42                	jne    8005f5 <runcmd+0x5b2>
+		if (debug)
+  8005b3:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  8005ba:	00 00 00 
+  8005bd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8005c0:	85 c0                	test   %eax,%eax
+  8005c2:	0f 84 42 04 00 00    	je     800a0a <runcmd+0x9c7>
+			cprintf("EMPTY COMMAND\n");
+  8005c8:	48 b8 c9 d9 ff ff ff 	movabs $0xffffffffffffd9c9,%rax
+  8005cf:	ff ff ff 
+  8005d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005d6:	48 89 c7             	mov    %rax,%rdi
+  8005d9:	49 89 df             	mov    %rbx,%r15
+  8005dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e1:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8005e8:	ff ff ff 
+  8005eb:	48 01 da             	add    %rbx,%rdx
+  8005ee:	ff d2                	call   *%rdx
+  8005f0:	e9 16 04 00 00       	jmp    800a0b <runcmd+0x9c8>
+		return;
+	}
+
+	//Search in all the PATH's for the binary
+	struct Stat st;
+	for(i=0;i<npaths;i++) {
+  8005f5:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  8005fc:	e9 9e 00 00 00       	jmp    80069f <runcmd+0x65c>
+		strcpy(argv0buf, PATH[i]);
+  800601:	48 ba 18 00 00 00 00 	movabs $0x18,%rdx
+  800608:	00 00 00 
+  80060b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80060e:	48 98                	cltq
+  800610:	48 01 da             	add    %rbx,%rdx
+  800613:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  800617:	48 8d 85 40 fb ff ff 	lea    -0x4c0(%rbp),%rax
+  80061e:	48 89 d6             	mov    %rdx,%rsi
+  800621:	48 89 c7             	mov    %rax,%rdi
+  800624:	49 89 df             	mov    %rbx,%r15
+  800627:	48 b8 cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rax
+  80062e:	ff ff ff 
+  800631:	48 01 d8             	add    %rbx,%rax
+  800634:	ff d0                	call   *%rax
+		strcat(argv0buf, argv[0]);
+  800636:	48 8b 95 50 ff ff ff 	mov    -0xb0(%rbp),%rdx
+  80063d:	48 8d 85 40 fb ff ff 	lea    -0x4c0(%rbp),%rax
+  800644:	48 89 d6             	mov    %rdx,%rsi
+  800647:	48 89 c7             	mov    %rax,%rdi
+  80064a:	49 89 df             	mov    %rbx,%r15
+  80064d:	48 b8 26 6a ff ff ff 	movabs $0xffffffffffff6a26,%rax
+  800654:	ff ff ff 
+  800657:	48 01 d8             	add    %rbx,%rax
+  80065a:	ff d0                	call   *%rax
+		r = stat(argv0buf, &st);
+  80065c:	48 8d 95 a0 fa ff ff 	lea    -0x560(%rbp),%rdx
+  800663:	48 8d 85 40 fb ff ff 	lea    -0x4c0(%rbp),%rax
+  80066a:	48 89 d6             	mov    %rdx,%rsi
+  80066d:	48 89 c7             	mov    %rax,%rdi
+  800670:	49 89 df             	mov    %rbx,%r15
+  800673:	48 b8 77 98 ff ff ff 	movabs $0xffffffffffff9877,%rax
+  80067a:	ff ff ff 
+  80067d:	48 01 d8             	add    %rbx,%rax
+  800680:	ff d0                	call   *%rax
+  800682:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if(r==0) {
+  800685:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800689:	75 10                	jne    80069b <runcmd+0x658>
+			argv[0] = argv0buf;
+  80068b:	48 8d 85 40 fb ff ff 	lea    -0x4c0(%rbp),%rax
+  800692:	48 89 85 50 ff ff ff 	mov    %rax,-0xb0(%rbp)
+			break; 
+  800699:	eb 1a                	jmp    8006b5 <runcmd+0x672>
+	for(i=0;i<npaths;i++) {
+  80069b:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  80069f:	48 b8 b8 ff ff ff ff 	movabs $0xffffffffffffffb8,%rax
+  8006a6:	ff ff ff 
+  8006a9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8006ac:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+  8006af:	0f 8c 4c ff ff ff    	jl     800601 <runcmd+0x5be>
+
+	// Clean up command line.
+	// Read all commands from the filesystem: add an initial '/' to
+	// the command name.
+	// This essentially acts like 'PATH=/'.
+	if (argv[0][0] != '/') {
+  8006b5:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8006bc:	0f b6 00             	movzbl (%rax),%eax
+  8006bf:	3c 2f                	cmp    $0x2f,%al
+  8006c1:	74 3f                	je     800702 <runcmd+0x6bf>
+		argv0buf[0] = '/';
+  8006c3:	c6 85 40 fb ff ff 2f 	movb   $0x2f,-0x4c0(%rbp)
+		strcpy(argv0buf + 1, argv[0]);
+  8006ca:	48 8b 95 50 ff ff ff 	mov    -0xb0(%rbp),%rdx
+  8006d1:	48 8d 85 40 fb ff ff 	lea    -0x4c0(%rbp),%rax
+  8006d8:	48 83 c0 01          	add    $0x1,%rax
+  8006dc:	48 89 d6             	mov    %rdx,%rsi
+  8006df:	48 89 c7             	mov    %rax,%rdi
+  8006e2:	49 89 df             	mov    %rbx,%r15
+  8006e5:	48 b8 cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rax
+  8006ec:	ff ff ff 
+  8006ef:	48 01 d8             	add    %rbx,%rax
+  8006f2:	ff d0                	call   *%rax
+		argv[0] = argv0buf;
+  8006f4:	48 8d 85 40 fb ff ff 	lea    -0x4c0(%rbp),%rax
+  8006fb:	48 89 85 50 ff ff ff 	mov    %rax,-0xb0(%rbp)
+	}
+	argv[argc] = 0;
+  800702:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800705:	48 98                	cltq
+  800707:	48 c7 84 c5 50 ff ff 	movq   $0x0,-0xb0(%rbp,%rax,8)
+  80070e:	ff 00 00 00 00 
+
+	// Print the command.
+	if (debug) {
+  800713:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  80071a:	00 00 00 
+  80071d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800720:	85 c0                	test   %eax,%eax
+  800722:	0f 84 c0 00 00 00    	je     8007e8 <runcmd+0x7a5>
+		cprintf("[%08x] SPAWN:", thisenv->env_id);
+  800728:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80072f:	ff ff ff 
+  800732:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800736:	48 8b 00             	mov    (%rax),%rax
+  800739:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80073f:	89 c6                	mov    %eax,%esi
+  800741:	48 b8 d8 d9 ff ff ff 	movabs $0xffffffffffffd9d8,%rax
+  800748:	ff ff ff 
+  80074b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80074f:	48 89 c7             	mov    %rax,%rdi
+  800752:	49 89 df             	mov    %rbx,%r15
+  800755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075a:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  800761:	ff ff ff 
+  800764:	48 01 da             	add    %rbx,%rdx
+  800767:	ff d2                	call   *%rdx
+		for (i = 0; argv[i]; i++)
+  800769:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  800770:	eb 3c                	jmp    8007ae <runcmd+0x76b>
+			cprintf(" %s", argv[i]);
+  800772:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800775:	48 98                	cltq
+  800777:	48 8b 84 c5 50 ff ff 	mov    -0xb0(%rbp,%rax,8),%rax
+  80077e:	ff 
+  80077f:	48 89 c6             	mov    %rax,%rsi
+  800782:	48 b8 e6 d9 ff ff ff 	movabs $0xffffffffffffd9e6,%rax
+  800789:	ff ff ff 
+  80078c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800790:	48 89 c7             	mov    %rax,%rdi
+  800793:	49 89 df             	mov    %rbx,%r15
+  800796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079b:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8007a2:	ff ff ff 
+  8007a5:	48 01 da             	add    %rbx,%rdx
+  8007a8:	ff d2                	call   *%rdx
+		for (i = 0; argv[i]; i++)
+  8007aa:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  8007ae:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8007b1:	48 98                	cltq
+  8007b3:	48 8b 84 c5 50 ff ff 	mov    -0xb0(%rbp,%rax,8),%rax
+  8007ba:	ff 
+  8007bb:	48 85 c0             	test   %rax,%rax
+  8007be:	75 b2                	jne    800772 <runcmd+0x72f>
+		cprintf("\n");
+  8007c0:	48 b8 ea d9 ff ff ff 	movabs $0xffffffffffffd9ea,%rax
+  8007c7:	ff ff ff 
+  8007ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007ce:	48 89 c7             	mov    %rax,%rdi
+  8007d1:	49 89 df             	mov    %rbx,%r15
+  8007d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d9:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8007e0:	ff ff ff 
+  8007e3:	48 01 da             	add    %rbx,%rdx
+  8007e6:	ff d2                	call   *%rdx
+	}
+
+	// Spawn the command!
+	if ((r = spawn(argv[0], (const char**) argv)) < 0)
+  8007e8:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8007ef:	48 8d 95 50 ff ff ff 	lea    -0xb0(%rbp),%rdx
+  8007f6:	48 89 d6             	mov    %rdx,%rsi
+  8007f9:	48 89 c7             	mov    %rax,%rdi
+  8007fc:	49 89 df             	mov    %rbx,%r15
+  8007ff:	48 b8 62 a7 ff ff ff 	movabs $0xffffffffffffa762,%rax
+  800806:	ff ff ff 
+  800809:	48 01 d8             	add    %rbx,%rax
+  80080c:	ff d0                	call   *%rax
+  80080e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800811:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800815:	79 35                	jns    80084c <runcmd+0x809>
+		cprintf("spawn %s: %e\n", argv[0], r);
+  800817:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80081e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  800821:	48 89 c6             	mov    %rax,%rsi
+  800824:	48 b8 ec d9 ff ff ff 	movabs $0xffffffffffffd9ec,%rax
+  80082b:	ff ff ff 
+  80082e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800832:	48 89 c7             	mov    %rax,%rdi
+  800835:	49 89 df             	mov    %rbx,%r15
+  800838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083d:	48 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rcx
+  800844:	ff ff ff 
+  800847:	48 01 d9             	add    %rbx,%rcx
+  80084a:	ff d1                	call   *%rcx
+
+	// In the parent, close all file descriptors and wait for the
+	// spawned command to exit.
+	close_all();
+  80084c:	49 89 df             	mov    %rbx,%r15
+  80084f:	48 b8 36 91 ff ff ff 	movabs $0xffffffffffff9136,%rax
+  800856:	ff ff ff 
+  800859:	48 01 d8             	add    %rbx,%rax
+  80085c:	ff d0                	call   *%rax
+	if (r >= 0) {
+  80085e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800862:	0f 88 c6 00 00 00    	js     80092e <runcmd+0x8eb>
+		if (debug)
+  800868:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  80086f:	00 00 00 
+  800872:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800875:	85 c0                	test   %eax,%eax
+  800877:	74 4c                	je     8008c5 <runcmd+0x882>
+			cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+  800879:	48 8b 95 50 ff ff ff 	mov    -0xb0(%rbp),%rdx
+  800880:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800887:	ff ff ff 
+  80088a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80088e:	48 8b 00             	mov    (%rax),%rax
+  800891:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800897:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80089a:	89 c6                	mov    %eax,%esi
+  80089c:	48 b8 fa d9 ff ff ff 	movabs $0xffffffffffffd9fa,%rax
+  8008a3:	ff ff ff 
+  8008a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008aa:	48 89 c7             	mov    %rax,%rdi
+  8008ad:	49 89 df             	mov    %rbx,%r15
+  8008b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b5:	49 b8 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%r8
+  8008bc:	ff ff ff 
+  8008bf:	49 01 d8             	add    %rbx,%r8
+  8008c2:	41 ff d0             	call   *%r8
+		wait(r);
+  8008c5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8008c8:	89 c7                	mov    %eax,%edi
+  8008ca:	49 89 df             	mov    %rbx,%r15
+  8008cd:	48 b8 09 ce ff ff ff 	movabs $0xffffffffffffce09,%rax
+  8008d4:	ff ff ff 
+  8008d7:	48 01 d8             	add    %rbx,%rax
+  8008da:	ff d0                	call   *%rax
+		if (debug)
+  8008dc:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  8008e3:	00 00 00 
+  8008e6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8008e9:	85 c0                	test   %eax,%eax
+  8008eb:	74 41                	je     80092e <runcmd+0x8eb>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  8008ed:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8008f4:	ff ff ff 
+  8008f7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8008fb:	48 8b 00             	mov    (%rax),%rax
+  8008fe:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800904:	89 c6                	mov    %eax,%esi
+  800906:	48 b8 0f da ff ff ff 	movabs $0xffffffffffffda0f,%rax
+  80090d:	ff ff ff 
+  800910:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800914:	48 89 c7             	mov    %rax,%rdi
+  800917:	49 89 df             	mov    %rbx,%r15
+  80091a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80091f:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  800926:	ff ff ff 
+  800929:	48 01 da             	add    %rbx,%rdx
+  80092c:	ff d2                	call   *%rdx
+	}
+
+	// If we were the left-hand part of a pipe,
+	// wait for the right-hand part to finish.
+	if (pipe_child) {
+  80092e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800932:	0f 84 be 00 00 00    	je     8009f6 <runcmd+0x9b3>
+		if (debug)
+  800938:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  80093f:	00 00 00 
+  800942:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800945:	85 c0                	test   %eax,%eax
+  800947:	74 44                	je     80098d <runcmd+0x94a>
+			cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+  800949:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800950:	ff ff ff 
+  800953:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800957:	48 8b 00             	mov    (%rax),%rax
+  80095a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800960:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800963:	89 c6                	mov    %eax,%esi
+  800965:	48 b8 25 da ff ff ff 	movabs $0xffffffffffffda25,%rax
+  80096c:	ff ff ff 
+  80096f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800973:	48 89 c7             	mov    %rax,%rdi
+  800976:	49 89 df             	mov    %rbx,%r15
+  800979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097e:	48 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rcx
+  800985:	ff ff ff 
+  800988:	48 01 d9             	add    %rbx,%rcx
+  80098b:	ff d1                	call   *%rcx
+		wait(pipe_child);
+  80098d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800990:	89 c7                	mov    %eax,%edi
+  800992:	49 89 df             	mov    %rbx,%r15
+  800995:	48 b8 09 ce ff ff ff 	movabs $0xffffffffffffce09,%rax
+  80099c:	ff ff ff 
+  80099f:	48 01 d8             	add    %rbx,%rax
+  8009a2:	ff d0                	call   *%rax
+		if (debug)
+  8009a4:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  8009ab:	00 00 00 
+  8009ae:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8009b1:	85 c0                	test   %eax,%eax
+  8009b3:	74 41                	je     8009f6 <runcmd+0x9b3>
+			cprintf("[%08x] wait finished\n", thisenv->env_id);
+  8009b5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8009bc:	ff ff ff 
+  8009bf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8009c3:	48 8b 00             	mov    (%rax),%rax
+  8009c6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8009cc:	89 c6                	mov    %eax,%esi
+  8009ce:	48 b8 0f da ff ff ff 	movabs $0xffffffffffffda0f,%rax
+  8009d5:	ff ff ff 
+  8009d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009dc:	48 89 c7             	mov    %rax,%rdi
+  8009df:	49 89 df             	mov    %rbx,%r15
+  8009e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e7:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8009ee:	ff ff ff 
+  8009f1:	48 01 da             	add    %rbx,%rdx
+  8009f4:	ff d2                	call   *%rdx
+	}
+
+	// Done!
+	exit();
+  8009f6:	49 89 df             	mov    %rbx,%r15
+  8009f9:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  800a00:	ff ff ff 
+  800a03:	48 01 d8             	add    %rbx,%rax
+  800a06:	ff d0                	call   *%rax
+  800a08:	eb 01                	jmp    800a0b <runcmd+0x9c8>
+		return;
+  800a0a:	90                   	nop
+}
+  800a0b:	48 81 c4 60 05 00 00 	add    $0x560,%rsp
+  800a12:	5b                   	pop    %rbx
+  800a13:	41 5f                	pop    %r15
+  800a15:	5d                   	pop    %rbp
+  800a16:	c3                   	ret
+
+0000000000800a17 <_gettoken>:
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2)
+{
+  800a17:	55                   	push   %rbp
+  800a18:	48 89 e5             	mov    %rsp,%rbp
+  800a1b:	41 57                	push   %r15
+  800a1d:	53                   	push   %rbx
+  800a1e:	48 83 ec 30          	sub    $0x30,%rsp
+  800a22:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800a22 <_gettoken+0xb>
+  800a29:	49 bb 26 b6 00 00 00 	movabs $0xb626,%r11
+  800a30:	00 00 00 
+  800a33:	4c 01 db             	add    %r11,%rbx
+  800a36:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800a3a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800a3e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int t;
+
+	if (s == 0) {
+  800a42:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800a47:	75 44                	jne    800a8d <_gettoken+0x76>
+		if (debug > 1)
+  800a49:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  800a50:	00 00 00 
+  800a53:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800a56:	83 f8 01             	cmp    $0x1,%eax
+  800a59:	7e 28                	jle    800a83 <_gettoken+0x6c>
+			cprintf("GETTOKEN NULL\n");
+  800a5b:	48 b8 42 da ff ff ff 	movabs $0xffffffffffffda42,%rax
+  800a62:	ff ff ff 
+  800a65:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a69:	48 89 c7             	mov    %rax,%rdi
+  800a6c:	49 89 df             	mov    %rbx,%r15
+  800a6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a74:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  800a7b:	ff ff ff 
+  800a7e:	48 01 da             	add    %rbx,%rdx
+  800a81:	ff d2                	call   *%rdx
+		return 0;
+  800a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a88:	e9 63 02 00 00       	jmp    800cf0 <_gettoken+0x2d9>
+	}
+
+	if (debug > 1)
+  800a8d:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  800a94:	00 00 00 
+  800a97:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800a9a:	83 f8 01             	cmp    $0x1,%eax
+  800a9d:	7e 2f                	jle    800ace <_gettoken+0xb7>
+		cprintf("GETTOKEN: %s\n", s);
+  800a9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800aa3:	48 89 c6             	mov    %rax,%rsi
+  800aa6:	48 b8 51 da ff ff ff 	movabs $0xffffffffffffda51,%rax
+  800aad:	ff ff ff 
+  800ab0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ab4:	48 89 c7             	mov    %rax,%rdi
+  800ab7:	49 89 df             	mov    %rbx,%r15
+  800aba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abf:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  800ac6:	ff ff ff 
+  800ac9:	48 01 da             	add    %rbx,%rdx
+  800acc:	ff d2                	call   *%rdx
+
+	*p1 = 0;
+  800ace:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ad2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	*p2 = 0;
+  800ad9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800add:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+
+	while (strchr(WHITESPACE, *s))
+  800ae4:	eb 0f                	jmp    800af5 <_gettoken+0xde>
+		*s++ = 0;
+  800ae6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800aea:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800aee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800af2:	c6 00 00             	movb   $0x0,(%rax)
+	while (strchr(WHITESPACE, *s))
+  800af5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800af9:	0f b6 00             	movzbl (%rax),%eax
+  800afc:	0f be c0             	movsbl %al,%eax
+  800aff:	89 c6                	mov    %eax,%esi
+  800b01:	48 b8 5f da ff ff ff 	movabs $0xffffffffffffda5f,%rax
+  800b08:	ff ff ff 
+  800b0b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b0f:	48 89 c7             	mov    %rax,%rdi
+  800b12:	49 89 df             	mov    %rbx,%r15
+  800b15:	48 b8 74 6c ff ff ff 	movabs $0xffffffffffff6c74,%rax
+  800b1c:	ff ff ff 
+  800b1f:	48 01 d8             	add    %rbx,%rax
+  800b22:	ff d0                	call   *%rax
+  800b24:	48 85 c0             	test   %rax,%rax
+  800b27:	75 bd                	jne    800ae6 <_gettoken+0xcf>
+	if (*s == 0) {
+  800b29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b2d:	0f b6 00             	movzbl (%rax),%eax
+  800b30:	84 c0                	test   %al,%al
+  800b32:	75 44                	jne    800b78 <_gettoken+0x161>
+		if (debug > 1)
+  800b34:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  800b3b:	00 00 00 
+  800b3e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800b41:	83 f8 01             	cmp    $0x1,%eax
+  800b44:	7e 28                	jle    800b6e <_gettoken+0x157>
+			cprintf("EOL\n");
+  800b46:	48 b8 64 da ff ff ff 	movabs $0xffffffffffffda64,%rax
+  800b4d:	ff ff ff 
+  800b50:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b54:	48 89 c7             	mov    %rax,%rdi
+  800b57:	49 89 df             	mov    %rbx,%r15
+  800b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5f:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  800b66:	ff ff ff 
+  800b69:	48 01 da             	add    %rbx,%rdx
+  800b6c:	ff d2                	call   *%rdx
+		return 0;
+  800b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b73:	e9 78 01 00 00       	jmp    800cf0 <_gettoken+0x2d9>
+	}
+	if (strchr(SYMBOLS, *s)) {
+  800b78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800b7c:	0f b6 00             	movzbl (%rax),%eax
+  800b7f:	0f be c0             	movsbl %al,%eax
+  800b82:	89 c6                	mov    %eax,%esi
+  800b84:	48 b8 69 da ff ff ff 	movabs $0xffffffffffffda69,%rax
+  800b8b:	ff ff ff 
+  800b8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b92:	48 89 c7             	mov    %rax,%rdi
+  800b95:	49 89 df             	mov    %rbx,%r15
+  800b98:	48 b8 74 6c ff ff ff 	movabs $0xffffffffffff6c74,%rax
+  800b9f:	ff ff ff 
+  800ba2:	48 01 d8             	add    %rbx,%rax
+  800ba5:	ff d0                	call   *%rax
+  800ba7:	48 85 c0             	test   %rax,%rax
+  800baa:	74 79                	je     800c25 <_gettoken+0x20e>
+		t = *s;
+  800bac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bb0:	0f b6 00             	movzbl (%rax),%eax
+  800bb3:	0f be c0             	movsbl %al,%eax
+  800bb6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		*p1 = s;
+  800bb9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bbd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800bc1:	48 89 10             	mov    %rdx,(%rax)
+		*s++ = 0;
+  800bc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800bc8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bcc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800bd0:	c6 00 00             	movb   $0x0,(%rax)
+		*p2 = s;
+  800bd3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bd7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800bdb:	48 89 10             	mov    %rdx,(%rax)
+		if (debug > 1)
+  800bde:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  800be5:	00 00 00 
+  800be8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800beb:	83 f8 01             	cmp    $0x1,%eax
+  800bee:	7e 2d                	jle    800c1d <_gettoken+0x206>
+			cprintf("TOK %c\n", t);
+  800bf0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800bf3:	89 c6                	mov    %eax,%esi
+  800bf5:	48 b8 71 da ff ff ff 	movabs $0xffffffffffffda71,%rax
+  800bfc:	ff ff ff 
+  800bff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c03:	48 89 c7             	mov    %rax,%rdi
+  800c06:	49 89 df             	mov    %rbx,%r15
+  800c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0e:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  800c15:	ff ff ff 
+  800c18:	48 01 da             	add    %rbx,%rdx
+  800c1b:	ff d2                	call   *%rdx
+		return t;
+  800c1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800c20:	e9 cb 00 00 00       	jmp    800cf0 <_gettoken+0x2d9>
+	}
+	*p1 = s;
+  800c25:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c29:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800c2d:	48 89 10             	mov    %rdx,(%rax)
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800c30:	eb 05                	jmp    800c37 <_gettoken+0x220>
+		s++;
+  800c32:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800c37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c3b:	0f b6 00             	movzbl (%rax),%eax
+  800c3e:	84 c0                	test   %al,%al
+  800c40:	74 34                	je     800c76 <_gettoken+0x25f>
+  800c42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c46:	0f b6 00             	movzbl (%rax),%eax
+  800c49:	0f be c0             	movsbl %al,%eax
+  800c4c:	89 c6                	mov    %eax,%esi
+  800c4e:	48 b8 79 da ff ff ff 	movabs $0xffffffffffffda79,%rax
+  800c55:	ff ff ff 
+  800c58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c5c:	48 89 c7             	mov    %rax,%rdi
+  800c5f:	49 89 df             	mov    %rbx,%r15
+  800c62:	48 b8 74 6c ff ff ff 	movabs $0xffffffffffff6c74,%rax
+  800c69:	ff ff ff 
+  800c6c:	48 01 d8             	add    %rbx,%rax
+  800c6f:	ff d0                	call   *%rax
+  800c71:	48 85 c0             	test   %rax,%rax
+  800c74:	74 bc                	je     800c32 <_gettoken+0x21b>
+	*p2 = s;
+  800c76:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c7a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800c7e:	48 89 10             	mov    %rdx,(%rax)
+	if (debug > 1) {
+  800c81:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  800c88:	00 00 00 
+  800c8b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800c8e:	83 f8 01             	cmp    $0x1,%eax
+  800c91:	7e 58                	jle    800ceb <_gettoken+0x2d4>
+		t = **p2;
+  800c93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c97:	48 8b 00             	mov    (%rax),%rax
+  800c9a:	0f b6 00             	movzbl (%rax),%eax
+  800c9d:	0f be c0             	movsbl %al,%eax
+  800ca0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		**p2 = 0;
+  800ca3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ca7:	48 8b 00             	mov    (%rax),%rax
+  800caa:	c6 00 00             	movb   $0x0,(%rax)
+		cprintf("WORD: %s\n", *p1);
+  800cad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cb1:	48 8b 00             	mov    (%rax),%rax
+  800cb4:	48 89 c6             	mov    %rax,%rsi
+  800cb7:	48 b8 85 da ff ff ff 	movabs $0xffffffffffffda85,%rax
+  800cbe:	ff ff ff 
+  800cc1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800cc5:	48 89 c7             	mov    %rax,%rdi
+  800cc8:	49 89 df             	mov    %rbx,%r15
+  800ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd0:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  800cd7:	ff ff ff 
+  800cda:	48 01 da             	add    %rbx,%rdx
+  800cdd:	ff d2                	call   *%rdx
+		**p2 = t;
+  800cdf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ce3:	48 8b 00             	mov    (%rax),%rax
+  800ce6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800ce9:	88 10                	mov    %dl,(%rax)
+	}
+	return 'w';
+  800ceb:	b8 77 00 00 00       	mov    $0x77,%eax
+}
+  800cf0:	48 83 c4 30          	add    $0x30,%rsp
+  800cf4:	5b                   	pop    %rbx
+  800cf5:	41 5f                	pop    %r15
+  800cf7:	5d                   	pop    %rbp
+  800cf8:	c3                   	ret
+
+0000000000800cf9 <gettoken>:
+
+int
+gettoken(char *s, char **p1)
+{
+  800cf9:	55                   	push   %rbp
+  800cfa:	48 89 e5             	mov    %rsp,%rbp
+  800cfd:	53                   	push   %rbx
+  800cfe:	48 83 ec 18          	sub    $0x18,%rsp
+  800d02:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800d02 <gettoken+0x9>
+  800d09:	49 bb 46 b3 00 00 00 	movabs $0xb346,%r11
+  800d10:	00 00 00 
+  800d13:	4c 01 db             	add    %r11,%rbx
+  800d16:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d1a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	static int c, nc;
+	static char* np1, *np2;
+
+	if (s) {
+  800d1e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800d23:	74 4d                	je     800d72 <gettoken+0x79>
+		nc = _gettoken(s, &np1, &np2);
+  800d25:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d29:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  800d30:	00 00 00 
+  800d33:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800d37:	48 b9 c0 0f 00 00 00 	movabs $0xfc0,%rcx
+  800d3e:	00 00 00 
+  800d41:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  800d45:	48 89 ce             	mov    %rcx,%rsi
+  800d48:	48 89 c7             	mov    %rax,%rdi
+  800d4b:	48 b8 cf 49 ff ff ff 	movabs $0xffffffffffff49cf,%rax
+  800d52:	ff ff ff 
+  800d55:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d59:	ff d0                	call   *%rax
+  800d5b:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  800d62:	00 00 00 
+  800d65:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+		return 0;
+  800d68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6d:	e9 89 00 00 00       	jmp    800dfb <gettoken+0x102>
+	}
+	c = nc;
+  800d72:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  800d79:	00 00 00 
+  800d7c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800d7f:	48 ba d4 0f 00 00 00 	movabs $0xfd4,%rdx
+  800d86:	00 00 00 
+  800d89:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	*p1 = np1;
+  800d8c:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  800d93:	00 00 00 
+  800d96:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  800d9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d9e:	48 89 10             	mov    %rdx,(%rax)
+	nc = _gettoken(np2, &np1, &np2);
+  800da1:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  800da8:	00 00 00 
+  800dab:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800daf:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  800db6:	00 00 00 
+  800db9:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  800dbd:	48 b9 c0 0f 00 00 00 	movabs $0xfc0,%rcx
+  800dc4:	00 00 00 
+  800dc7:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  800dcb:	48 89 ce             	mov    %rcx,%rsi
+  800dce:	48 89 c7             	mov    %rax,%rdi
+  800dd1:	48 b8 cf 49 ff ff ff 	movabs $0xffffffffffff49cf,%rax
+  800dd8:	ff ff ff 
+  800ddb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ddf:	ff d0                	call   *%rax
+  800de1:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  800de8:	00 00 00 
+  800deb:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	return c;
+  800dee:	48 b8 d4 0f 00 00 00 	movabs $0xfd4,%rax
+  800df5:	00 00 00 
+  800df8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+}
+  800dfb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800dff:	c9                   	leave
+  800e00:	c3                   	ret
+
+0000000000800e01 <usage>:
+
+
+void
+usage(void)
+{
+  800e01:	55                   	push   %rbp
+  800e02:	48 89 e5             	mov    %rsp,%rbp
+  800e05:	41 57                	push   %r15
+  800e07:	53                   	push   %rbx
+  800e08:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800e08 <usage+0x7>
+  800e0f:	49 bb 40 b2 00 00 00 	movabs $0xb240,%r11
+  800e16:	00 00 00 
+  800e19:	4c 01 db             	add    %r11,%rbx
+	cprintf("usage: sh [-dix] [command-file]\n");
+  800e1c:	48 b8 90 da ff ff ff 	movabs $0xffffffffffffda90,%rax
+  800e23:	ff ff ff 
+  800e26:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e2a:	48 89 c7             	mov    %rax,%rdi
+  800e2d:	49 89 df             	mov    %rbx,%r15
+  800e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e35:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  800e3c:	ff ff ff 
+  800e3f:	48 01 da             	add    %rbx,%rdx
+  800e42:	ff d2                	call   *%rdx
+	exit();
+  800e44:	49 89 df             	mov    %rbx,%r15
+  800e47:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  800e4e:	ff ff ff 
+  800e51:	48 01 d8             	add    %rbx,%rax
+  800e54:	ff d0                	call   *%rax
+}
+  800e56:	90                   	nop
+  800e57:	5b                   	pop    %rbx
+  800e58:	41 5f                	pop    %r15
+  800e5a:	5d                   	pop    %rbp
+  800e5b:	c3                   	ret
+
+0000000000800e5c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800e5c:	55                   	push   %rbp
+  800e5d:	48 89 e5             	mov    %rsp,%rbp
+  800e60:	41 57                	push   %r15
+  800e62:	53                   	push   %rbx
+  800e63:	48 83 ec 50          	sub    $0x50,%rsp
+  800e67:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800e67 <umain+0xb>
+  800e6e:	49 bb e1 b1 00 00 00 	movabs $0xb1e1,%r11
+  800e75:	00 00 00 
+  800e78:	4c 01 db             	add    %r11,%rbx
+  800e7b:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  800e7e:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+	int r, interactive, echocmds;
+	struct Argstate args;
+	interactive = '?';
+  800e82:	c7 45 ec 3f 00 00 00 	movl   $0x3f,-0x14(%rbp)
+	echocmds = 0;
+  800e89:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+	argstart(&argc, argv, &args);
+  800e90:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  800e94:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  800e98:	48 8d 45 ac          	lea    -0x54(%rbp),%rax
+  800e9c:	48 89 ce             	mov    %rcx,%rsi
+  800e9f:	48 89 c7             	mov    %rax,%rdi
+  800ea2:	49 89 df             	mov    %rbx,%r15
+  800ea5:	48 b8 c0 89 ff ff ff 	movabs $0xffffffffffff89c0,%rax
+  800eac:	ff ff ff 
+  800eaf:	48 01 d8             	add    %rbx,%rax
+  800eb2:	ff d0                	call   *%rax
+	while ((r = argnext(&args)) >= 0)
+  800eb4:	eb 5b                	jmp    800f11 <umain+0xb5>
+		switch (r) {
+  800eb6:	83 7d e4 78          	cmpl   $0x78,-0x1c(%rbp)
+  800eba:	74 3c                	je     800ef8 <umain+0x9c>
+  800ebc:	83 7d e4 78          	cmpl   $0x78,-0x1c(%rbp)
+  800ec0:	7f 3f                	jg     800f01 <umain+0xa5>
+  800ec2:	83 7d e4 64          	cmpl   $0x64,-0x1c(%rbp)
+  800ec6:	74 08                	je     800ed0 <umain+0x74>
+  800ec8:	83 7d e4 69          	cmpl   $0x69,-0x1c(%rbp)
+  800ecc:	74 21                	je     800eef <umain+0x93>
+  800ece:	eb 31                	jmp    800f01 <umain+0xa5>
+		case 'd':
+			debug++;
+  800ed0:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  800ed7:	00 00 00 
+  800eda:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800edd:	8d 50 01             	lea    0x1(%rax),%edx
+  800ee0:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  800ee7:	00 00 00 
+  800eea:	89 14 03             	mov    %edx,(%rbx,%rax,1)
+			break;
+  800eed:	eb 22                	jmp    800f11 <umain+0xb5>
+		case 'i':
+			interactive = 1;
+  800eef:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%rbp)
+			break;
+  800ef6:	eb 19                	jmp    800f11 <umain+0xb5>
+		case 'x':
+			echocmds = 1;
+  800ef8:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%rbp)
+			break;
+  800eff:	eb 10                	jmp    800f11 <umain+0xb5>
+		default:
+			usage();
+  800f01:	48 b8 b9 4d ff ff ff 	movabs $0xffffffffffff4db9,%rax
+  800f08:	ff ff ff 
+  800f0b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f0f:	ff d0                	call   *%rax
+	while ((r = argnext(&args)) >= 0)
+  800f11:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800f15:	48 89 c7             	mov    %rax,%rdi
+  800f18:	49 89 df             	mov    %rbx,%r15
+  800f1b:	48 b8 3d 8a ff ff ff 	movabs $0xffffffffffff8a3d,%rax
+  800f22:	ff ff ff 
+  800f25:	48 01 d8             	add    %rbx,%rax
+  800f28:	ff d0                	call   *%rax
+  800f2a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800f2d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800f31:	79 83                	jns    800eb6 <umain+0x5a>
+		}
+	if (argc > 2)
+  800f33:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800f36:	83 f8 02             	cmp    $0x2,%eax
+  800f39:	7e 10                	jle    800f4b <umain+0xef>
+		usage();
+  800f3b:	48 b8 b9 4d ff ff ff 	movabs $0xffffffffffff4db9,%rax
+  800f42:	ff ff ff 
+  800f45:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f49:	ff d0                	call   *%rax
+	if (argc == 2) {
+  800f4b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800f4e:	83 f8 02             	cmp    $0x2,%eax
+  800f51:	0f 85 ee 00 00 00    	jne    801045 <umain+0x1e9>
+		close(0);
+  800f57:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f5c:	49 89 df             	mov    %rbx,%r15
+  800f5f:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  800f66:	ff ff ff 
+  800f69:	48 01 d8             	add    %rbx,%rax
+  800f6c:	ff d0                	call   *%rax
+		if ((r = open(argv[1], O_RDONLY)) < 0)
+  800f6e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f72:	48 83 c0 08          	add    $0x8,%rax
+  800f76:	48 8b 00             	mov    (%rax),%rax
+  800f79:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7e:	48 89 c7             	mov    %rax,%rdi
+  800f81:	49 89 df             	mov    %rbx,%r15
+  800f84:	48 b8 51 9b ff ff ff 	movabs $0xffffffffffff9b51,%rax
+  800f8b:	ff ff ff 
+  800f8e:	48 01 d8             	add    %rbx,%rax
+  800f91:	ff d0                	call   *%rax
+  800f93:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800f96:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800f9a:	79 53                	jns    800fef <umain+0x193>
+			panic("open %s: %e", argv[1], r);
+  800f9c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800fa0:	48 83 c0 08          	add    $0x8,%rax
+  800fa4:	48 8b 00             	mov    (%rax),%rax
+  800fa7:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800faa:	41 89 d0             	mov    %edx,%r8d
+  800fad:	48 89 c1             	mov    %rax,%rcx
+  800fb0:	48 b8 b1 da ff ff ff 	movabs $0xffffffffffffdab1,%rax
+  800fb7:	ff ff ff 
+  800fba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fbe:	48 89 c2             	mov    %rax,%rdx
+  800fc1:	be 29 01 00 00       	mov    $0x129,%esi
+  800fc6:	48 b8 bf d9 ff ff ff 	movabs $0xffffffffffffd9bf,%rax
+  800fcd:	ff ff ff 
+  800fd0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fd4:	48 89 c7             	mov    %rax,%rdi
+  800fd7:	49 89 df             	mov    %rbx,%r15
+  800fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdf:	49 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r9
+  800fe6:	ff ff ff 
+  800fe9:	49 01 d9             	add    %rbx,%r9
+  800fec:	41 ff d1             	call   *%r9
+		assert(r == 0);
+  800fef:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800ff3:	74 50                	je     801045 <umain+0x1e9>
+  800ff5:	48 b8 bd da ff ff ff 	movabs $0xffffffffffffdabd,%rax
+  800ffc:	ff ff ff 
+  800fff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801003:	48 89 c1             	mov    %rax,%rcx
+  801006:	48 b8 c4 da ff ff ff 	movabs $0xffffffffffffdac4,%rax
+  80100d:	ff ff ff 
+  801010:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801014:	48 89 c2             	mov    %rax,%rdx
+  801017:	be 2a 01 00 00       	mov    $0x12a,%esi
+  80101c:	48 b8 bf d9 ff ff ff 	movabs $0xffffffffffffd9bf,%rax
+  801023:	ff ff ff 
+  801026:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80102a:	48 89 c7             	mov    %rax,%rdi
+  80102d:	49 89 df             	mov    %rbx,%r15
+  801030:	b8 00 00 00 00       	mov    $0x0,%eax
+  801035:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  80103c:	ff ff ff 
+  80103f:	49 01 d8             	add    %rbx,%r8
+  801042:	41 ff d0             	call   *%r8
+	}
+	if (interactive == '?')
+  801045:	83 7d ec 3f          	cmpl   $0x3f,-0x14(%rbp)
+  801049:	75 1a                	jne    801065 <umain+0x209>
+		interactive = iscons(0);
+  80104b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801050:	49 89 df             	mov    %rbx,%r15
+  801053:	48 b8 48 53 ff ff ff 	movabs $0xffffffffffff5348,%rax
+  80105a:	ff ff ff 
+  80105d:	48 01 d8             	add    %rbx,%rax
+  801060:	ff d0                	call   *%rax
+  801062:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	while (1) {
+		char *buf;
+		buf = readline(interactive ? "$ " : NULL);
+  801065:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801069:	74 10                	je     80107b <umain+0x21f>
+  80106b:	48 b8 d9 da ff ff ff 	movabs $0xffffffffffffdad9,%rax
+  801072:	ff ff ff 
+  801075:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801079:	eb 05                	jmp    801080 <umain+0x224>
+  80107b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801080:	48 89 c7             	mov    %rax,%rdi
+  801083:	49 89 df             	mov    %rbx,%r15
+  801086:	48 b8 7d 67 ff ff ff 	movabs $0xffffffffffff677d,%rax
+  80108d:	ff ff ff 
+  801090:	48 01 d8             	add    %rbx,%rax
+  801093:	ff d0                	call   *%rax
+  801095:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+		if (buf == NULL) {
+  801099:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80109e:	75 4b                	jne    8010eb <umain+0x28f>
+			if (debug)
+  8010a0:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  8010a7:	00 00 00 
+  8010aa:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8010ad:	85 c0                	test   %eax,%eax
+  8010af:	74 28                	je     8010d9 <umain+0x27d>
+				cprintf("EXITING\n");
+  8010b1:	48 b8 dc da ff ff ff 	movabs $0xffffffffffffdadc,%rax
+  8010b8:	ff ff ff 
+  8010bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8010bf:	48 89 c7             	mov    %rax,%rdi
+  8010c2:	49 89 df             	mov    %rbx,%r15
+  8010c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ca:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8010d1:	ff ff ff 
+  8010d4:	48 01 da             	add    %rbx,%rdx
+  8010d7:	ff d2                	call   *%rdx
+			exit();	// end of file
+  8010d9:	49 89 df             	mov    %rbx,%r15
+  8010dc:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  8010e3:	ff ff ff 
+  8010e6:	48 01 d8             	add    %rbx,%rax
+  8010e9:	ff d0                	call   *%rax
+		}
+		if(strcmp(buf, "quit")==0)
+  8010eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010ef:	48 ba e5 da ff ff ff 	movabs $0xffffffffffffdae5,%rdx
+  8010f6:	ff ff ff 
+  8010f9:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8010fd:	48 89 d6             	mov    %rdx,%rsi
+  801100:	48 89 c7             	mov    %rax,%rdi
+  801103:	49 89 df             	mov    %rbx,%r15
+  801106:	48 b8 88 6b ff ff ff 	movabs $0xffffffffffff6b88,%rax
+  80110d:	ff ff ff 
+  801110:	48 01 d8             	add    %rbx,%rax
+  801113:	ff d0                	call   *%rax
+  801115:	85 c0                	test   %eax,%eax
+  801117:	75 12                	jne    80112b <umain+0x2cf>
+			exit();
+  801119:	49 89 df             	mov    %rbx,%r15
+  80111c:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  801123:	ff ff ff 
+  801126:	48 01 d8             	add    %rbx,%rax
+  801129:	ff d0                	call   *%rax
+		if (debug)
+  80112b:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  801132:	00 00 00 
+  801135:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801138:	85 c0                	test   %eax,%eax
+  80113a:	74 2f                	je     80116b <umain+0x30f>
+			cprintf("LINE: %s\n", buf);
+  80113c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801140:	48 89 c6             	mov    %rax,%rsi
+  801143:	48 b8 ea da ff ff ff 	movabs $0xffffffffffffdaea,%rax
+  80114a:	ff ff ff 
+  80114d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801151:	48 89 c7             	mov    %rax,%rdi
+  801154:	49 89 df             	mov    %rbx,%r15
+  801157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80115c:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  801163:	ff ff ff 
+  801166:	48 01 da             	add    %rbx,%rdx
+  801169:	ff d2                	call   *%rdx
+		if (buf[0] == '#')
+  80116b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80116f:	0f b6 00             	movzbl (%rax),%eax
+  801172:	3c 23                	cmp    $0x23,%al
+  801174:	0f 84 5b 01 00 00    	je     8012d5 <umain+0x479>
+			continue;
+		if (echocmds)
+  80117a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80117e:	74 2f                	je     8011af <umain+0x353>
+			printf("# %s\n", buf);
+  801180:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801184:	48 89 c6             	mov    %rax,%rsi
+  801187:	48 b8 f4 da ff ff ff 	movabs $0xffffffffffffdaf4,%rax
+  80118e:	ff ff ff 
+  801191:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801195:	48 89 c7             	mov    %rax,%rdi
+  801198:	49 89 df             	mov    %rbx,%r15
+  80119b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a0:	48 ba 94 a6 ff ff ff 	movabs $0xffffffffffffa694,%rdx
+  8011a7:	ff ff ff 
+  8011aa:	48 01 da             	add    %rbx,%rdx
+  8011ad:	ff d2                	call   *%rdx
+		if (debug)
+  8011af:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  8011b6:	00 00 00 
+  8011b9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8011bc:	85 c0                	test   %eax,%eax
+  8011be:	74 28                	je     8011e8 <umain+0x38c>
+			cprintf("BEFORE FORK\n");
+  8011c0:	48 b8 fa da ff ff ff 	movabs $0xffffffffffffdafa,%rax
+  8011c7:	ff ff ff 
+  8011ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8011ce:	48 89 c7             	mov    %rax,%rdi
+  8011d1:	49 89 df             	mov    %rbx,%r15
+  8011d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d9:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8011e0:	ff ff ff 
+  8011e3:	48 01 da             	add    %rbx,%rdx
+  8011e6:	ff d2                	call   *%rdx
+		if ((r = fork()) < 0)
+  8011e8:	49 89 df             	mov    %rbx,%r15
+  8011eb:	48 b8 1a 86 ff ff ff 	movabs $0xffffffffffff861a,%rax
+  8011f2:	ff ff ff 
+  8011f5:	48 01 d8             	add    %rbx,%rax
+  8011f8:	ff d0                	call   *%rax
+  8011fa:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8011fd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801201:	79 44                	jns    801247 <umain+0x3eb>
+			panic("fork: %e", r);
+  801203:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801206:	89 c1                	mov    %eax,%ecx
+  801208:	48 b8 9a d9 ff ff ff 	movabs $0xffffffffffffd99a,%rax
+  80120f:	ff ff ff 
+  801212:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801216:	48 89 c2             	mov    %rax,%rdx
+  801219:	be 42 01 00 00       	mov    $0x142,%esi
+  80121e:	48 b8 bf d9 ff ff ff 	movabs $0xffffffffffffd9bf,%rax
+  801225:	ff ff ff 
+  801228:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80122c:	48 89 c7             	mov    %rax,%rdi
+  80122f:	49 89 df             	mov    %rbx,%r15
+  801232:	b8 00 00 00 00       	mov    $0x0,%eax
+  801237:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  80123e:	ff ff ff 
+  801241:	49 01 d8             	add    %rbx,%r8
+  801244:	41 ff d0             	call   *%r8
+		if (debug)
+  801247:	48 b8 b8 0f 00 00 00 	movabs $0xfb8,%rax
+  80124e:	00 00 00 
+  801251:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  801254:	85 c0                	test   %eax,%eax
+  801256:	74 2d                	je     801285 <umain+0x429>
+			cprintf("FORK: %d\n", r);
+  801258:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80125b:	89 c6                	mov    %eax,%esi
+  80125d:	48 b8 07 db ff ff ff 	movabs $0xffffffffffffdb07,%rax
+  801264:	ff ff ff 
+  801267:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80126b:	48 89 c7             	mov    %rax,%rdi
+  80126e:	49 89 df             	mov    %rbx,%r15
+  801271:	b8 00 00 00 00       	mov    $0x0,%eax
+  801276:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  80127d:	ff ff ff 
+  801280:	48 01 da             	add    %rbx,%rdx
+  801283:	ff d2                	call   *%rdx
+		if (r == 0) {
+  801285:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801289:	75 2e                	jne    8012b9 <umain+0x45d>
+			runcmd(buf);
+  80128b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80128f:	48 89 c7             	mov    %rax,%rdi
+  801292:	48 b8 fb 3f ff ff ff 	movabs $0xffffffffffff3ffb,%rax
+  801299:	ff ff ff 
+  80129c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8012a0:	ff d0                	call   *%rax
+			exit();
+  8012a2:	49 89 df             	mov    %rbx,%r15
+  8012a5:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  8012ac:	ff ff ff 
+  8012af:	48 01 d8             	add    %rbx,%rax
+  8012b2:	ff d0                	call   *%rax
+  8012b4:	e9 ac fd ff ff       	jmp    801065 <umain+0x209>
+		} else {
+			wait(r);
+  8012b9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8012bc:	89 c7                	mov    %eax,%edi
+  8012be:	49 89 df             	mov    %rbx,%r15
+  8012c1:	48 b8 09 ce ff ff ff 	movabs $0xffffffffffffce09,%rax
+  8012c8:	ff ff ff 
+  8012cb:	48 01 d8             	add    %rbx,%rax
+  8012ce:	ff d0                	call   *%rax
+  8012d0:	e9 90 fd ff ff       	jmp    801065 <umain+0x209>
+			continue;
+  8012d5:	90                   	nop
+	while (1) {
+  8012d6:	e9 8a fd ff ff       	jmp    801065 <umain+0x209>
+
+00000000008012db <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+  8012df:	41 57                	push   %r15
+  8012e1:	48 83 ec 28          	sub    $0x28,%rsp
+  8012e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012e5 <cputchar+0xa>
+  8012ec:	49 bb 63 ad 00 00 00 	movabs $0xad63,%r11
+  8012f3:	00 00 00 
+  8012f6:	4c 01 d8             	add    %r11,%rax
+  8012f9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8012fc:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8012ff:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  801302:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  801306:	be 01 00 00 00       	mov    $0x1,%esi
+  80130b:	48 89 d7             	mov    %rdx,%rdi
+  80130e:	49 89 c7             	mov    %rax,%r15
+  801311:	48 ba d3 74 ff ff ff 	movabs $0xffffffffffff74d3,%rdx
+  801318:	ff ff ff 
+  80131b:	48 01 c2             	add    %rax,%rdx
+  80131e:	ff d2                	call   *%rdx
+}
+  801320:	90                   	nop
+  801321:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  801325:	c9                   	leave
+  801326:	c3                   	ret
+
+0000000000801327 <getchar>:
+
+int
+getchar(void)
+{
+  801327:	55                   	push   %rbp
+  801328:	48 89 e5             	mov    %rsp,%rbp
+  80132b:	41 57                	push   %r15
+  80132d:	48 83 ec 18          	sub    $0x18,%rsp
+  801331:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801331 <getchar+0xa>
+  801338:	49 bb 17 ad 00 00 00 	movabs $0xad17,%r11
+  80133f:	00 00 00 
+  801342:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  801345:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  801349:	ba 01 00 00 00       	mov    $0x1,%edx
+  80134e:	48 89 ce             	mov    %rcx,%rsi
+  801351:	bf 00 00 00 00       	mov    $0x0,%edi
+  801356:	49 89 c7             	mov    %rax,%r15
+  801359:	48 b9 82 93 ff ff ff 	movabs $0xffffffffffff9382,%rcx
+  801360:	ff ff ff 
+  801363:	48 01 c1             	add    %rax,%rcx
+  801366:	ff d1                	call   *%rcx
+  801368:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80136b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80136f:	79 05                	jns    801376 <getchar+0x4f>
+		return r;
+  801371:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801374:	eb 14                	jmp    80138a <getchar+0x63>
+	if (r < 1)
+  801376:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80137a:	7f 07                	jg     801383 <getchar+0x5c>
+		return -E_EOF;
+  80137c:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  801381:	eb 07                	jmp    80138a <getchar+0x63>
+	return c;
+  801383:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  801387:	0f b6 c0             	movzbl %al,%eax
+}
+  80138a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80138e:	c9                   	leave
+  80138f:	c3                   	ret
+
+0000000000801390 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  801390:	55                   	push   %rbp
+  801391:	48 89 e5             	mov    %rsp,%rbp
+  801394:	41 57                	push   %r15
+  801396:	53                   	push   %rbx
+  801397:	48 83 ec 20          	sub    $0x20,%rsp
+  80139b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80139b <iscons+0xb>
+  8013a2:	49 bb ad ac 00 00 00 	movabs $0xacad,%r11
+  8013a9:	00 00 00 
+  8013ac:	4c 01 db             	add    %r11,%rbx
+  8013af:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013b2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8013b6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8013b9:	48 89 d6             	mov    %rdx,%rsi
+  8013bc:	89 c7                	mov    %eax,%edi
+  8013be:	49 89 df             	mov    %rbx,%r15
+  8013c1:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  8013c8:	ff ff ff 
+  8013cb:	48 01 d8             	add    %rbx,%rax
+  8013ce:	ff d0                	call   *%rax
+  8013d0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8013d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8013d7:	79 05                	jns    8013de <iscons+0x4e>
+		return r;
+  8013d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013dc:	eb 1b                	jmp    8013f9 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8013de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013e2:	8b 10                	mov    (%rax),%edx
+  8013e4:	48 b8 38 00 00 00 00 	movabs $0x38,%rax
+  8013eb:	00 00 00 
+  8013ee:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8013f1:	39 c2                	cmp    %eax,%edx
+  8013f3:	0f 94 c0             	sete   %al
+  8013f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8013f9:	48 83 c4 20          	add    $0x20,%rsp
+  8013fd:	5b                   	pop    %rbx
+  8013fe:	41 5f                	pop    %r15
+  801400:	5d                   	pop    %rbp
+  801401:	c3                   	ret
+
+0000000000801402 <opencons>:
+
+int
+opencons(void)
+{
+  801402:	55                   	push   %rbp
+  801403:	48 89 e5             	mov    %rsp,%rbp
+  801406:	41 57                	push   %r15
+  801408:	53                   	push   %rbx
+  801409:	48 83 ec 10          	sub    $0x10,%rsp
+  80140d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80140d <opencons+0xb>
+  801414:	49 bb 3b ac 00 00 00 	movabs $0xac3b,%r11
+  80141b:	00 00 00 
+  80141e:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  801421:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801425:	48 89 c7             	mov    %rax,%rdi
+  801428:	49 89 df             	mov    %rbx,%r15
+  80142b:	48 b8 85 8d ff ff ff 	movabs $0xffffffffffff8d85,%rax
+  801432:	ff ff ff 
+  801435:	48 01 d8             	add    %rbx,%rax
+  801438:	ff d0                	call   *%rax
+  80143a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80143d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801441:	79 05                	jns    801448 <opencons+0x46>
+		return r;
+  801443:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801446:	eb 68                	jmp    8014b0 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801448:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80144c:	ba 07 04 00 00       	mov    $0x407,%edx
+  801451:	48 89 c6             	mov    %rax,%rsi
+  801454:	bf 00 00 00 00       	mov    $0x0,%edi
+  801459:	49 89 df             	mov    %rbx,%r15
+  80145c:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  801463:	ff ff ff 
+  801466:	48 01 d8             	add    %rbx,%rax
+  801469:	ff d0                	call   *%rax
+  80146b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80146e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801472:	79 05                	jns    801479 <opencons+0x77>
+		return r;
+  801474:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801477:	eb 37                	jmp    8014b0 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  801479:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80147d:	48 ba 38 00 00 00 00 	movabs $0x38,%rdx
+  801484:	00 00 00 
+  801487:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80148a:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  80148c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801490:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  801497:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80149b:	48 89 c7             	mov    %rax,%rdi
+  80149e:	49 89 df             	mov    %rbx,%r15
+  8014a1:	48 b8 0b 8d ff ff ff 	movabs $0xffffffffffff8d0b,%rax
+  8014a8:	ff ff ff 
+  8014ab:	48 01 d8             	add    %rbx,%rax
+  8014ae:	ff d0                	call   *%rax
+}
+  8014b0:	48 83 c4 10          	add    $0x10,%rsp
+  8014b4:	5b                   	pop    %rbx
+  8014b5:	41 5f                	pop    %r15
+  8014b7:	5d                   	pop    %rbp
+  8014b8:	c3                   	ret
+
+00000000008014b9 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8014b9:	55                   	push   %rbp
+  8014ba:	48 89 e5             	mov    %rsp,%rbp
+  8014bd:	41 57                	push   %r15
+  8014bf:	53                   	push   %rbx
+  8014c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8014c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8014c4 <devcons_read+0xb>
+  8014cb:	49 bb 84 ab 00 00 00 	movabs $0xab84,%r11
+  8014d2:	00 00 00 
+  8014d5:	4c 01 db             	add    %r11,%rbx
+  8014d8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8014dc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8014e0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8014e4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8014e9:	75 19                	jne    801504 <devcons_read+0x4b>
+		return 0;
+  8014eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f0:	eb 55                	jmp    801547 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8014f2:	49 89 df             	mov    %rbx,%r15
+  8014f5:	48 b8 36 76 ff ff ff 	movabs $0xffffffffffff7636,%rax
+  8014fc:	ff ff ff 
+  8014ff:	48 01 d8             	add    %rbx,%rax
+  801502:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  801504:	49 89 df             	mov    %rbx,%r15
+  801507:	48 b8 32 75 ff ff ff 	movabs $0xffffffffffff7532,%rax
+  80150e:	ff ff ff 
+  801511:	48 01 d8             	add    %rbx,%rax
+  801514:	ff d0                	call   *%rax
+  801516:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801519:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80151d:	74 d3                	je     8014f2 <devcons_read+0x39>
+	if (c < 0)
+  80151f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  801523:	79 05                	jns    80152a <devcons_read+0x71>
+		return c;
+  801525:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801528:	eb 1d                	jmp    801547 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  80152a:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80152e:	75 07                	jne    801537 <devcons_read+0x7e>
+		return 0;
+  801530:	b8 00 00 00 00       	mov    $0x0,%eax
+  801535:	eb 10                	jmp    801547 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  801537:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80153a:	89 c2                	mov    %eax,%edx
+  80153c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801540:	88 10                	mov    %dl,(%rax)
+	return 1;
+  801542:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801547:	48 83 c4 30          	add    $0x30,%rsp
+  80154b:	5b                   	pop    %rbx
+  80154c:	41 5f                	pop    %r15
+  80154e:	5d                   	pop    %rbp
+  80154f:	c3                   	ret
+
+0000000000801550 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  801550:	55                   	push   %rbp
+  801551:	48 89 e5             	mov    %rsp,%rbp
+  801554:	41 57                	push   %r15
+  801556:	53                   	push   %rbx
+  801557:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80155e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80155e <devcons_write+0xe>
+  801565:	49 bb ea aa 00 00 00 	movabs $0xaaea,%r11
+  80156c:	00 00 00 
+  80156f:	4c 01 db             	add    %r11,%rbx
+  801572:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  801579:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  801580:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  801587:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80158e:	e9 80 00 00 00       	jmp    801613 <devcons_write+0xc3>
+		m = n - tot;
+  801593:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80159a:	89 c2                	mov    %eax,%edx
+  80159c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80159f:	29 c2                	sub    %eax,%edx
+  8015a1:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8015a4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8015a7:	83 f8 7f             	cmp    $0x7f,%eax
+  8015aa:	76 07                	jbe    8015b3 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8015ac:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8015b3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8015b6:	48 63 d0             	movslq %eax,%rdx
+  8015b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8015bc:	48 63 c8             	movslq %eax,%rcx
+  8015bf:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8015c6:	48 01 c1             	add    %rax,%rcx
+  8015c9:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8015d0:	48 89 ce             	mov    %rcx,%rsi
+  8015d3:	48 89 c7             	mov    %rax,%rdi
+  8015d6:	49 89 df             	mov    %rbx,%r15
+  8015d9:	48 b8 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rax
+  8015e0:	ff ff ff 
+  8015e3:	48 01 d8             	add    %rbx,%rax
+  8015e6:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8015e8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8015eb:	48 63 d0             	movslq %eax,%rdx
+  8015ee:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8015f5:	48 89 d6             	mov    %rdx,%rsi
+  8015f8:	48 89 c7             	mov    %rax,%rdi
+  8015fb:	49 89 df             	mov    %rbx,%r15
+  8015fe:	48 b8 d3 74 ff ff ff 	movabs $0xffffffffffff74d3,%rax
+  801605:	ff ff ff 
+  801608:	48 01 d8             	add    %rbx,%rax
+  80160b:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80160d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801610:	01 45 ec             	add    %eax,-0x14(%rbp)
+  801613:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801616:	48 98                	cltq
+  801618:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  80161f:	0f 82 6e ff ff ff    	jb     801593 <devcons_write+0x43>
+	}
+	return tot;
+  801625:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  801628:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  80162f:	5b                   	pop    %rbx
+  801630:	41 5f                	pop    %r15
+  801632:	5d                   	pop    %rbp
+  801633:	c3                   	ret
+
+0000000000801634 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  801634:	55                   	push   %rbp
+  801635:	48 89 e5             	mov    %rsp,%rbp
+  801638:	48 83 ec 08          	sub    $0x8,%rsp
+  80163c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80163c <devcons_close+0x8>
+  801643:	49 bb 0c aa 00 00 00 	movabs $0xaa0c,%r11
+  80164a:	00 00 00 
+  80164d:	4c 01 d8             	add    %r11,%rax
+  801650:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  801654:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801659:	c9                   	leave
+  80165a:	c3                   	ret
+
+000000000080165b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80165b:	55                   	push   %rbp
+  80165c:	48 89 e5             	mov    %rsp,%rbp
+  80165f:	41 57                	push   %r15
+  801661:	48 83 ec 18          	sub    $0x18,%rsp
+  801665:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801665 <devcons_stat+0xa>
+  80166c:	49 bb e3 a9 00 00 00 	movabs $0xa9e3,%r11
+  801673:	00 00 00 
+  801676:	4c 01 d8             	add    %r11,%rax
+  801679:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80167d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  801681:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801685:	48 b9 16 db ff ff ff 	movabs $0xffffffffffffdb16,%rcx
+  80168c:	ff ff ff 
+  80168f:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  801693:	48 89 ce             	mov    %rcx,%rsi
+  801696:	48 89 d7             	mov    %rdx,%rdi
+  801699:	49 89 c7             	mov    %rax,%r15
+  80169c:	48 ba cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rdx
+  8016a3:	ff ff ff 
+  8016a6:	48 01 c2             	add    %rax,%rdx
+  8016a9:	ff d2                	call   *%rdx
+	return 0;
+  8016ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016b0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8016b4:	c9                   	leave
+  8016b5:	c3                   	ret
+
+00000000008016b6 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8016b6:	55                   	push   %rbp
+  8016b7:	48 89 e5             	mov    %rsp,%rbp
+  8016ba:	41 57                	push   %r15
+  8016bc:	53                   	push   %rbx
+  8016bd:	48 83 ec 20          	sub    $0x20,%rsp
+  8016c1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8016c1 <libmain+0xb>
+  8016c8:	49 bb 87 a9 00 00 00 	movabs $0xa987,%r11
+  8016cf:	00 00 00 
+  8016d2:	4c 01 db             	add    %r11,%rbx
+  8016d5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8016d8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8016dc:	49 89 df             	mov    %rbx,%r15
+  8016df:	48 b8 e2 75 ff ff ff 	movabs $0xffffffffffff75e2,%rax
+  8016e6:	ff ff ff 
+  8016e9:	48 01 d8             	add    %rbx,%rax
+  8016ec:	ff d0                	call   *%rax
+  8016ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8016f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8016f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016f9:	48 98                	cltq
+  8016fb:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  801702:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  801709:	ff ff ff 
+  80170c:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  801710:	48 01 c2             	add    %rax,%rdx
+  801713:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80171a:	00 00 00 
+  80171d:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  801721:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801725:	7e 15                	jle    80173c <libmain+0x86>
+		binaryname = argv[0];
+  801727:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80172b:	48 8b 00             	mov    (%rax),%rax
+  80172e:	48 ba 70 00 00 00 00 	movabs $0x70,%rdx
+  801735:	00 00 00 
+  801738:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80173c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801740:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801743:	48 89 d6             	mov    %rdx,%rsi
+  801746:	89 c7                	mov    %eax,%edi
+  801748:	49 89 df             	mov    %rbx,%r15
+  80174b:	48 b8 14 4e ff ff ff 	movabs $0xffffffffffff4e14,%rax
+  801752:	ff ff ff 
+  801755:	48 01 d8             	add    %rbx,%rax
+  801758:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80175a:	49 89 df             	mov    %rbx,%r15
+  80175d:	48 b8 2e 57 ff ff ff 	movabs $0xffffffffffff572e,%rax
+  801764:	ff ff ff 
+  801767:	48 01 d8             	add    %rbx,%rax
+  80176a:	ff d0                	call   *%rax
+}
+  80176c:	90                   	nop
+  80176d:	48 83 c4 20          	add    $0x20,%rsp
+  801771:	5b                   	pop    %rbx
+  801772:	41 5f                	pop    %r15
+  801774:	5d                   	pop    %rbp
+  801775:	c3                   	ret
+
+0000000000801776 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  801776:	55                   	push   %rbp
+  801777:	48 89 e5             	mov    %rsp,%rbp
+  80177a:	41 57                	push   %r15
+  80177c:	53                   	push   %rbx
+  80177d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80177d <exit+0x7>
+  801784:	49 bb cb a8 00 00 00 	movabs $0xa8cb,%r11
+  80178b:	00 00 00 
+  80178e:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  801791:	49 89 df             	mov    %rbx,%r15
+  801794:	48 b8 36 91 ff ff ff 	movabs $0xffffffffffff9136,%rax
+  80179b:	ff ff ff 
+  80179e:	48 01 d8             	add    %rbx,%rax
+  8017a1:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8017a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017a8:	49 89 df             	mov    %rbx,%r15
+  8017ab:	48 b8 86 75 ff ff ff 	movabs $0xffffffffffff7586,%rax
+  8017b2:	ff ff ff 
+  8017b5:	48 01 d8             	add    %rbx,%rax
+  8017b8:	ff d0                	call   *%rax
+}
+  8017ba:	90                   	nop
+  8017bb:	5b                   	pop    %rbx
+  8017bc:	41 5f                	pop    %r15
+  8017be:	5d                   	pop    %rbp
+  8017bf:	c3                   	ret
+
+00000000008017c0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8017c0:	55                   	push   %rbp
+  8017c1:	48 89 e5             	mov    %rsp,%rbp
+  8017c4:	41 57                	push   %r15
+  8017c6:	41 54                	push   %r12
+  8017c8:	53                   	push   %rbx
+  8017c9:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8017d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8017d0 <_panic+0x10>
+  8017d7:	49 bb 78 a8 00 00 00 	movabs $0xa878,%r11
+  8017de:	00 00 00 
+  8017e1:	4c 01 db             	add    %r11,%rbx
+  8017e4:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8017eb:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8017f1:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8017f8:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8017ff:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  801806:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80180d:	84 c0                	test   %al,%al
+  80180f:	74 26                	je     801837 <_panic+0x77>
+  801811:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  801818:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80181f:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  801823:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  801827:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80182b:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80182f:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  801833:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801837:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  80183e:	00 00 00 
+  801841:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  801848:	00 00 00 
+  80184b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80184f:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  801856:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80185d:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801864:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80186b:	ff ff ff 
+  80186e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801872:	4c 8b 20             	mov    (%rax),%r12
+  801875:	49 89 df             	mov    %rbx,%r15
+  801878:	48 b8 e2 75 ff ff ff 	movabs $0xffffffffffff75e2,%rax
+  80187f:	ff ff ff 
+  801882:	48 01 d8             	add    %rbx,%rax
+  801885:	ff d0                	call   *%rax
+  801887:	89 c6                	mov    %eax,%esi
+  801889:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80188f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801896:	41 89 d0             	mov    %edx,%r8d
+  801899:	48 89 c1             	mov    %rax,%rcx
+  80189c:	4c 89 e2             	mov    %r12,%rdx
+  80189f:	48 b8 28 db ff ff ff 	movabs $0xffffffffffffdb28,%rax
+  8018a6:	ff ff ff 
+  8018a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8018ad:	48 89 c7             	mov    %rax,%rdi
+  8018b0:	49 89 df             	mov    %rbx,%r15
+  8018b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b8:	49 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%r9
+  8018bf:	ff ff ff 
+  8018c2:	49 01 d9             	add    %rbx,%r9
+  8018c5:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8018c8:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8018cf:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8018d6:	48 89 d6             	mov    %rdx,%rsi
+  8018d9:	48 89 c7             	mov    %rax,%rdi
+  8018dc:	49 89 df             	mov    %rbx,%r15
+  8018df:	48 b8 6f 59 ff ff ff 	movabs $0xffffffffffff596f,%rax
+  8018e6:	ff ff ff 
+  8018e9:	48 01 d8             	add    %rbx,%rax
+  8018ec:	ff d0                	call   *%rax
+	cprintf("\n");
+  8018ee:	48 b8 4b db ff ff ff 	movabs $0xffffffffffffdb4b,%rax
+  8018f5:	ff ff ff 
+  8018f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8018fc:	48 89 c7             	mov    %rax,%rdi
+  8018ff:	49 89 df             	mov    %rbx,%r15
+  801902:	b8 00 00 00 00       	mov    $0x0,%eax
+  801907:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  80190e:	ff ff ff 
+  801911:	48 01 da             	add    %rbx,%rdx
+  801914:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  801916:	cc                   	int3
+  801917:	eb fd                	jmp    801916 <_panic+0x156>
+
+0000000000801919 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  801919:	55                   	push   %rbp
+  80191a:	48 89 e5             	mov    %rsp,%rbp
+  80191d:	41 57                	push   %r15
+  80191f:	48 83 ec 18          	sub    $0x18,%rsp
+  801923:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801923 <putch+0xa>
+  80192a:	49 bb 25 a7 00 00 00 	movabs $0xa725,%r11
+  801931:	00 00 00 
+  801934:	4c 01 d8             	add    %r11,%rax
+  801937:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80193a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80193e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801942:	8b 12                	mov    (%rdx),%edx
+  801944:	8d 72 01             	lea    0x1(%rdx),%esi
+  801947:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80194b:	89 31                	mov    %esi,(%rcx)
+  80194d:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  801950:	89 ce                	mov    %ecx,%esi
+  801952:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801956:	48 63 d2             	movslq %edx,%rdx
+  801959:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80195e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801962:	8b 12                	mov    (%rdx),%edx
+  801964:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80196a:	75 33                	jne    80199f <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80196c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801970:	8b 12                	mov    (%rdx),%edx
+  801972:	48 63 d2             	movslq %edx,%rdx
+  801975:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  801979:	48 83 c1 08          	add    $0x8,%rcx
+  80197d:	48 89 d6             	mov    %rdx,%rsi
+  801980:	48 89 cf             	mov    %rcx,%rdi
+  801983:	49 89 c7             	mov    %rax,%r15
+  801986:	48 ba d3 74 ff ff ff 	movabs $0xffffffffffff74d3,%rdx
+  80198d:	ff ff ff 
+  801990:	48 01 c2             	add    %rax,%rdx
+  801993:	ff d2                	call   *%rdx
+        b->idx = 0;
+  801995:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801999:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80199f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019a3:	8b 40 04             	mov    0x4(%rax),%eax
+  8019a6:	8d 50 01             	lea    0x1(%rax),%edx
+  8019a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019ad:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8019b0:	90                   	nop
+  8019b1:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8019b5:	c9                   	leave
+  8019b6:	c3                   	ret
+
+00000000008019b7 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8019b7:	55                   	push   %rbp
+  8019b8:	48 89 e5             	mov    %rsp,%rbp
+  8019bb:	41 57                	push   %r15
+  8019bd:	53                   	push   %rbx
+  8019be:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8019c5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8019c5 <vcprintf+0xe>
+  8019cc:	49 bb 83 a6 00 00 00 	movabs $0xa683,%r11
+  8019d3:	00 00 00 
+  8019d6:	4c 01 db             	add    %r11,%rbx
+  8019d9:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8019e0:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8019e7:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8019ee:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8019f5:	48 8b 06             	mov    (%rsi),%rax
+  8019f8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8019fc:	48 89 01             	mov    %rax,(%rcx)
+  8019ff:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801a03:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801a07:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  801a0b:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  801a12:	00 00 00 
+    b.cnt = 0;
+  801a15:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  801a1c:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  801a1f:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  801a26:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  801a2d:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  801a34:	48 89 c6             	mov    %rax,%rsi
+  801a37:	48 b8 d1 58 ff ff ff 	movabs $0xffffffffffff58d1,%rax
+  801a3e:	ff ff ff 
+  801a41:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a45:	48 89 c7             	mov    %rax,%rdi
+  801a48:	49 89 df             	mov    %rbx,%r15
+  801a4b:	48 b8 93 5e ff ff ff 	movabs $0xffffffffffff5e93,%rax
+  801a52:	ff ff ff 
+  801a55:	48 01 d8             	add    %rbx,%rax
+  801a58:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  801a5a:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  801a60:	48 98                	cltq
+  801a62:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  801a69:	48 83 c2 08          	add    $0x8,%rdx
+  801a6d:	48 89 c6             	mov    %rax,%rsi
+  801a70:	48 89 d7             	mov    %rdx,%rdi
+  801a73:	49 89 df             	mov    %rbx,%r15
+  801a76:	48 b8 d3 74 ff ff ff 	movabs $0xffffffffffff74d3,%rax
+  801a7d:	ff ff ff 
+  801a80:	48 01 d8             	add    %rbx,%rax
+  801a83:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  801a85:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  801a8b:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  801a92:	5b                   	pop    %rbx
+  801a93:	41 5f                	pop    %r15
+  801a95:	5d                   	pop    %rbp
+  801a96:	c3                   	ret
+
+0000000000801a97 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  801a97:	55                   	push   %rbp
+  801a98:	48 89 e5             	mov    %rsp,%rbp
+  801a9b:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  801aa2:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801aa2 <cprintf+0xb>
+  801aa9:	49 bb a6 a5 00 00 00 	movabs $0xa5a6,%r11
+  801ab0:	00 00 00 
+  801ab3:	4d 01 da             	add    %r11,%r10
+  801ab6:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801abd:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  801ac4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  801acb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801ad2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801ad9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801ae0:	84 c0                	test   %al,%al
+  801ae2:	74 20                	je     801b04 <cprintf+0x6d>
+  801ae4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801ae8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801aec:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801af0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801af4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801af8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801afc:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801b00:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  801b04:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  801b0b:	00 00 00 
+  801b0e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801b15:	00 00 00 
+  801b18:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b1c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801b23:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801b2a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  801b31:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801b38:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801b3f:	48 8b 06             	mov    (%rsi),%rax
+  801b42:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801b46:	48 89 01             	mov    %rax,(%rcx)
+  801b49:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801b4d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801b51:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  801b55:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  801b5c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801b63:	48 89 d6             	mov    %rdx,%rsi
+  801b66:	48 89 c7             	mov    %rax,%rdi
+  801b69:	48 b8 6f 59 ff ff ff 	movabs $0xffffffffffff596f,%rax
+  801b70:	ff ff ff 
+  801b73:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801b77:	ff d0                	call   *%rax
+  801b79:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  801b7f:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801b85:	c9                   	leave
+  801b86:	c3                   	ret
+
+0000000000801b87 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801b87:	55                   	push   %rbp
+  801b88:	48 89 e5             	mov    %rsp,%rbp
+  801b8b:	53                   	push   %rbx
+  801b8c:	48 83 ec 38          	sub    $0x38,%rsp
+  801b90:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801b90 <printnum+0x9>
+  801b97:	49 bb b8 a4 00 00 00 	movabs $0xa4b8,%r11
+  801b9e:	00 00 00 
+  801ba1:	4c 01 db             	add    %r11,%rbx
+  801ba4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801ba8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801bac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801bb0:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  801bb3:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  801bb7:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  801bbb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801bbe:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  801bc2:	72 58                	jb     801c1c <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801bc4:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  801bc7:	8d 78 ff             	lea    -0x1(%rax),%edi
+  801bca:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  801bcd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd6:	48 f7 f6             	div    %rsi
+  801bd9:	49 89 c2             	mov    %rax,%r10
+  801bdc:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  801bdf:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801be2:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  801be6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bea:	41 89 c9             	mov    %ecx,%r9d
+  801bed:	41 89 f8             	mov    %edi,%r8d
+  801bf0:	89 d1                	mov    %edx,%ecx
+  801bf2:	4c 89 d2             	mov    %r10,%rdx
+  801bf5:	48 89 c7             	mov    %rax,%rdi
+  801bf8:	48 b8 3f 5b ff ff ff 	movabs $0xffffffffffff5b3f,%rax
+  801bff:	ff ff ff 
+  801c02:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c06:	ff d0                	call   *%rax
+  801c08:	eb 1c                	jmp    801c26 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  801c0a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801c0e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801c11:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801c15:	48 89 d6             	mov    %rdx,%rsi
+  801c18:	89 c7                	mov    %eax,%edi
+  801c1a:	ff d1                	call   *%rcx
+		while (--width > 0)
+  801c1c:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  801c20:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  801c24:	7f e4                	jg     801c0a <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  801c26:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801c29:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c32:	48 f7 f1             	div    %rcx
+  801c35:	48 b8 87 dc ff ff ff 	movabs $0xffffffffffffdc87,%rax
+  801c3c:	ff ff ff 
+  801c3f:	48 01 d8             	add    %rbx,%rax
+  801c42:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  801c46:	0f be c0             	movsbl %al,%eax
+  801c49:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801c4d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801c51:	48 89 d6             	mov    %rdx,%rsi
+  801c54:	89 c7                	mov    %eax,%edi
+  801c56:	ff d1                	call   *%rcx
+}
+  801c58:	90                   	nop
+  801c59:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+
+0000000000801c5f <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  801c5f:	55                   	push   %rbp
+  801c60:	48 89 e5             	mov    %rsp,%rbp
+  801c63:	48 83 ec 20          	sub    $0x20,%rsp
+  801c67:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c67 <getuint+0x8>
+  801c6e:	49 bb e1 a3 00 00 00 	movabs $0xa3e1,%r11
+  801c75:	00 00 00 
+  801c78:	4c 01 d8             	add    %r11,%rax
+  801c7b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c7f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  801c82:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801c86:	7e 4f                	jle    801cd7 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  801c88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c8c:	8b 00                	mov    (%rax),%eax
+  801c8e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c91:	77 24                	ja     801cb7 <getuint+0x58>
+  801c93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c97:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801c9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c9f:	8b 00                	mov    (%rax),%eax
+  801ca1:	89 c0                	mov    %eax,%eax
+  801ca3:	48 01 d0             	add    %rdx,%rax
+  801ca6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801caa:	8b 12                	mov    (%rdx),%edx
+  801cac:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801caf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cb3:	89 0a                	mov    %ecx,(%rdx)
+  801cb5:	eb 14                	jmp    801ccb <getuint+0x6c>
+  801cb7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cbb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801cbf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801cc3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cc7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801ccb:	48 8b 00             	mov    (%rax),%rax
+  801cce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801cd2:	e9 9d 00 00 00       	jmp    801d74 <getuint+0x115>
+	else if (lflag)
+  801cd7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801cdb:	74 4c                	je     801d29 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  801cdd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ce1:	8b 00                	mov    (%rax),%eax
+  801ce3:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce6:	77 24                	ja     801d0c <getuint+0xad>
+  801ce8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cec:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801cf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cf4:	8b 00                	mov    (%rax),%eax
+  801cf6:	89 c0                	mov    %eax,%eax
+  801cf8:	48 01 d0             	add    %rdx,%rax
+  801cfb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cff:	8b 12                	mov    (%rdx),%edx
+  801d01:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801d04:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d08:	89 0a                	mov    %ecx,(%rdx)
+  801d0a:	eb 14                	jmp    801d20 <getuint+0xc1>
+  801d0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d10:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d14:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801d18:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d1c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801d20:	48 8b 00             	mov    (%rax),%rax
+  801d23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801d27:	eb 4b                	jmp    801d74 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  801d29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d2d:	8b 00                	mov    (%rax),%eax
+  801d2f:	83 f8 2f             	cmp    $0x2f,%eax
+  801d32:	77 24                	ja     801d58 <getuint+0xf9>
+  801d34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d38:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801d3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d40:	8b 00                	mov    (%rax),%eax
+  801d42:	89 c0                	mov    %eax,%eax
+  801d44:	48 01 d0             	add    %rdx,%rax
+  801d47:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d4b:	8b 12                	mov    (%rdx),%edx
+  801d4d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801d50:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d54:	89 0a                	mov    %ecx,(%rdx)
+  801d56:	eb 14                	jmp    801d6c <getuint+0x10d>
+  801d58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d5c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d60:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801d64:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d68:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801d6c:	8b 00                	mov    (%rax),%eax
+  801d6e:	89 c0                	mov    %eax,%eax
+  801d70:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  801d74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801d78:	c9                   	leave
+  801d79:	c3                   	ret
+
+0000000000801d7a <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  801d7a:	55                   	push   %rbp
+  801d7b:	48 89 e5             	mov    %rsp,%rbp
+  801d7e:	48 83 ec 20          	sub    $0x20,%rsp
+  801d82:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d82 <printfloat+0x8>
+  801d89:	49 bb c6 a2 00 00 00 	movabs $0xa2c6,%r11
+  801d90:	00 00 00 
+  801d93:	4c 01 d8             	add    %r11,%rax
+  801d96:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d9a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d9e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  801da2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801da6:	48 85 c0             	test   %rax,%rax
+  801da9:	79 12                	jns    801dbd <printfloat+0x43>
+		putch('-',putdat);
+  801dab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801daf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801db3:	48 89 c6             	mov    %rax,%rsi
+  801db6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801dbb:	ff d2                	call   *%rdx
+	
+}
+  801dbd:	90                   	nop
+  801dbe:	c9                   	leave
+  801dbf:	c3                   	ret
+
+0000000000801dc0 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  801dc0:	55                   	push   %rbp
+  801dc1:	48 89 e5             	mov    %rsp,%rbp
+  801dc4:	48 83 ec 20          	sub    $0x20,%rsp
+  801dc8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dc8 <getint+0x8>
+  801dcf:	49 bb 80 a2 00 00 00 	movabs $0xa280,%r11
+  801dd6:	00 00 00 
+  801dd9:	4c 01 d8             	add    %r11,%rax
+  801ddc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801de0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  801de3:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801de7:	7e 4f                	jle    801e38 <getint+0x78>
+		x=va_arg(*ap, long long);
+  801de9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ded:	8b 00                	mov    (%rax),%eax
+  801def:	83 f8 2f             	cmp    $0x2f,%eax
+  801df2:	77 24                	ja     801e18 <getint+0x58>
+  801df4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801df8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801dfc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e00:	8b 00                	mov    (%rax),%eax
+  801e02:	89 c0                	mov    %eax,%eax
+  801e04:	48 01 d0             	add    %rdx,%rax
+  801e07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e0b:	8b 12                	mov    (%rdx),%edx
+  801e0d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801e10:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e14:	89 0a                	mov    %ecx,(%rdx)
+  801e16:	eb 14                	jmp    801e2c <getint+0x6c>
+  801e18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e1c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e20:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801e24:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e28:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801e2c:	48 8b 00             	mov    (%rax),%rax
+  801e2f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801e33:	e9 9d 00 00 00       	jmp    801ed5 <getint+0x115>
+	else if (lflag)
+  801e38:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  801e3c:	74 4c                	je     801e8a <getint+0xca>
+		x=va_arg(*ap, long);
+  801e3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e42:	8b 00                	mov    (%rax),%eax
+  801e44:	83 f8 2f             	cmp    $0x2f,%eax
+  801e47:	77 24                	ja     801e6d <getint+0xad>
+  801e49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e4d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801e51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e55:	8b 00                	mov    (%rax),%eax
+  801e57:	89 c0                	mov    %eax,%eax
+  801e59:	48 01 d0             	add    %rdx,%rax
+  801e5c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e60:	8b 12                	mov    (%rdx),%edx
+  801e62:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801e65:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e69:	89 0a                	mov    %ecx,(%rdx)
+  801e6b:	eb 14                	jmp    801e81 <getint+0xc1>
+  801e6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e71:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801e75:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801e79:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e7d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801e81:	48 8b 00             	mov    (%rax),%rax
+  801e84:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801e88:	eb 4b                	jmp    801ed5 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  801e8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e8e:	8b 00                	mov    (%rax),%eax
+  801e90:	83 f8 2f             	cmp    $0x2f,%eax
+  801e93:	77 24                	ja     801eb9 <getint+0xf9>
+  801e95:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e99:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801e9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ea1:	8b 00                	mov    (%rax),%eax
+  801ea3:	89 c0                	mov    %eax,%eax
+  801ea5:	48 01 d0             	add    %rdx,%rax
+  801ea8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801eac:	8b 12                	mov    (%rdx),%edx
+  801eae:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801eb1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801eb5:	89 0a                	mov    %ecx,(%rdx)
+  801eb7:	eb 14                	jmp    801ecd <getint+0x10d>
+  801eb9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ebd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ec1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801ec5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ec9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801ecd:	8b 00                	mov    (%rax),%eax
+  801ecf:	48 98                	cltq
+  801ed1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  801ed5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801ed9:	c9                   	leave
+  801eda:	c3                   	ret
+
+0000000000801edb <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  801edb:	55                   	push   %rbp
+  801edc:	48 89 e5             	mov    %rsp,%rbp
+  801edf:	41 57                	push   %r15
+  801ee1:	41 55                	push   %r13
+  801ee3:	41 54                	push   %r12
+  801ee5:	53                   	push   %rbx
+  801ee6:	48 83 ec 60          	sub    $0x60,%rsp
+  801eea:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 801eea <vprintfmt+0xf>
+  801ef1:	49 bb 5e a1 00 00 00 	movabs $0xa15e,%r11
+  801ef8:	00 00 00 
+  801efb:	4d 01 dc             	add    %r11,%r12
+  801efe:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  801f02:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  801f06:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801f0a:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  801f0e:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  801f15:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  801f19:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  801f1d:	48 8b 06             	mov    (%rsi),%rax
+  801f20:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801f24:	48 89 01             	mov    %rax,(%rcx)
+  801f27:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801f2b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801f2f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801f33:	eb 17                	jmp    801f4c <vprintfmt+0x71>
+			if (ch == '\0')
+  801f35:	85 db                	test   %ebx,%ebx
+  801f37:	0f 84 97 05 00 00    	je     8024d4 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  801f3d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801f41:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801f45:	48 89 c6             	mov    %rax,%rsi
+  801f48:	89 df                	mov    %ebx,%edi
+  801f4a:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801f4c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801f50:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801f54:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801f58:	0f b6 00             	movzbl (%rax),%eax
+  801f5b:	0f b6 d8             	movzbl %al,%ebx
+  801f5e:	83 fb 25             	cmp    $0x25,%ebx
+  801f61:	75 d2                	jne    801f35 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  801f63:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  801f67:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  801f6e:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  801f75:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  801f7c:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  801f83:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801f87:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801f8b:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801f8f:	0f b6 00             	movzbl (%rax),%eax
+  801f92:	0f b6 d8             	movzbl %al,%ebx
+  801f95:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  801f98:	83 f8 55             	cmp    $0x55,%eax
+  801f9b:	0f 87 00 05 00 00    	ja     8024a1 <vprintfmt+0x5c6>
+  801fa1:	89 c0                	mov    %eax,%eax
+  801fa3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801faa:	00 
+  801fab:	48 8d 05 46 7d 00 00 	lea    0x7d46(%rip),%rax        # 809cf8 <.LC18+0xc>
+  801fb2:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  801fb6:	48 8d 15 3b 7d 00 00 	lea    0x7d3b(%rip),%rdx        # 809cf8 <.LC18+0xc>
+  801fbd:	48 01 d0             	add    %rdx,%rax
+  801fc0:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  801fc2:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  801fc6:	eb bb                	jmp    801f83 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  801fc8:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  801fcc:	eb b5                	jmp    801f83 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  801fce:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  801fd5:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  801fd8:	89 d0                	mov    %edx,%eax
+  801fda:	c1 e0 02             	shl    $0x2,%eax
+  801fdd:	01 d0                	add    %edx,%eax
+  801fdf:	01 c0                	add    %eax,%eax
+  801fe1:	01 d8                	add    %ebx,%eax
+  801fe3:	83 e8 30             	sub    $0x30,%eax
+  801fe6:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  801fe9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801fed:	0f b6 00             	movzbl (%rax),%eax
+  801ff0:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  801ff3:	83 fb 2f             	cmp    $0x2f,%ebx
+  801ff6:	7e 60                	jle    802058 <vprintfmt+0x17d>
+  801ff8:	83 fb 39             	cmp    $0x39,%ebx
+  801ffb:	7f 5b                	jg     802058 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  801ffd:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  802002:	eb d1                	jmp    801fd5 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  802004:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  802007:	83 f8 2f             	cmp    $0x2f,%eax
+  80200a:	77 17                	ja     802023 <vprintfmt+0x148>
+  80200c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802010:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  802013:	89 d2                	mov    %edx,%edx
+  802015:	48 01 d0             	add    %rdx,%rax
+  802018:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80201b:	83 c2 08             	add    $0x8,%edx
+  80201e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  802021:	eb 0c                	jmp    80202f <vprintfmt+0x154>
+  802023:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802027:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80202b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80202f:	8b 00                	mov    (%rax),%eax
+  802031:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  802034:	eb 23                	jmp    802059 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  802036:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80203a:	0f 89 43 ff ff ff    	jns    801f83 <vprintfmt+0xa8>
+				width = 0;
+  802040:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  802047:	e9 37 ff ff ff       	jmp    801f83 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  80204c:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  802053:	e9 2b ff ff ff       	jmp    801f83 <vprintfmt+0xa8>
+			goto process_precision;
+  802058:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  802059:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80205d:	0f 89 20 ff ff ff    	jns    801f83 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  802063:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802066:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802069:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  802070:	e9 0e ff ff ff       	jmp    801f83 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  802075:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  802079:	e9 05 ff ff ff       	jmp    801f83 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  80207e:	83 fb 39             	cmp    $0x39,%ebx
+  802081:	7f 0b                	jg     80208e <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  802083:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  802086:	c1 e0 08             	shl    $0x8,%eax
+  802089:	01 45 bc             	add    %eax,-0x44(%rbp)
+  80208c:	eb 21                	jmp    8020af <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  80208e:	83 fb 60             	cmp    $0x60,%ebx
+  802091:	7e 10                	jle    8020a3 <vprintfmt+0x1c8>
+  802093:	83 fb 66             	cmp    $0x66,%ebx
+  802096:	7f 0b                	jg     8020a3 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  802098:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  80209b:	c1 e0 08             	shl    $0x8,%eax
+  80209e:	01 45 bc             	add    %eax,-0x44(%rbp)
+  8020a1:	eb 0c                	jmp    8020af <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  8020a3:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  8020aa:	e9 04 01 00 00       	jmp    8021b3 <vprintfmt+0x2d8>
+  8020af:	e9 ff 00 00 00       	jmp    8021b3 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  8020b4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8020b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ba:	77 17                	ja     8020d3 <vprintfmt+0x1f8>
+  8020bc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8020c0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8020c3:	89 d2                	mov    %edx,%edx
+  8020c5:	48 01 d0             	add    %rdx,%rax
+  8020c8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8020cb:	83 c2 08             	add    $0x8,%edx
+  8020ce:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8020d1:	eb 0c                	jmp    8020df <vprintfmt+0x204>
+  8020d3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8020d7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8020db:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8020df:	8b 00                	mov    (%rax),%eax
+  8020e1:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  8020e5:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  8020e9:	48 89 d6             	mov    %rdx,%rsi
+  8020ec:	89 c7                	mov    %eax,%edi
+  8020ee:	ff d1                	call   *%rcx
+			break;
+  8020f0:	e9 da 03 00 00       	jmp    8024cf <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  8020f5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8020f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8020fb:	77 17                	ja     802114 <vprintfmt+0x239>
+  8020fd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802101:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  802104:	89 d2                	mov    %edx,%edx
+  802106:	48 01 d0             	add    %rdx,%rax
+  802109:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80210c:	83 c2 08             	add    $0x8,%edx
+  80210f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  802112:	eb 0c                	jmp    802120 <vprintfmt+0x245>
+  802114:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802118:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80211c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  802120:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  802122:	85 db                	test   %ebx,%ebx
+  802124:	79 02                	jns    802128 <vprintfmt+0x24d>
+				err = -err;
+  802126:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802128:	83 fb 15             	cmp    $0x15,%ebx
+  80212b:	7f 19                	jg     802146 <vprintfmt+0x26b>
+  80212d:	48 ba 38 01 00 00 00 	movabs $0x138,%rdx
+  802134:	00 00 00 
+  802137:	48 63 c3             	movslq %ebx,%rax
+  80213a:	4c 01 e2             	add    %r12,%rdx
+  80213d:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  802141:	4d 85 ed             	test   %r13,%r13
+  802144:	75 36                	jne    80217c <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  802146:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80214a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80214e:	89 d9                	mov    %ebx,%ecx
+  802150:	48 ba 98 dc ff ff ff 	movabs $0xffffffffffffdc98,%rdx
+  802157:	ff ff ff 
+  80215a:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  80215e:	48 89 c7             	mov    %rax,%rdi
+  802161:	b8 00 00 00 00       	mov    $0x0,%eax
+  802166:	49 b8 9a 64 ff ff ff 	movabs $0xffffffffffff649a,%r8
+  80216d:	ff ff ff 
+  802170:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  802174:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  802177:	e9 53 03 00 00       	jmp    8024cf <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  80217c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  802180:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802184:	4c 89 e9             	mov    %r13,%rcx
+  802187:	48 ba a1 dc ff ff ff 	movabs $0xffffffffffffdca1,%rdx
+  80218e:	ff ff ff 
+  802191:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  802195:	48 89 c7             	mov    %rax,%rdi
+  802198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80219d:	49 b8 9a 64 ff ff ff 	movabs $0xffffffffffff649a,%r8
+  8021a4:	ff ff ff 
+  8021a7:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  8021ab:	41 ff d0             	call   *%r8
+			break;
+  8021ae:	e9 1c 03 00 00       	jmp    8024cf <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  8021b3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8021b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8021b9:	77 17                	ja     8021d2 <vprintfmt+0x2f7>
+  8021bb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021bf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8021c2:	89 d2                	mov    %edx,%edx
+  8021c4:	48 01 d0             	add    %rdx,%rax
+  8021c7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8021ca:	83 c2 08             	add    $0x8,%edx
+  8021cd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8021d0:	eb 0c                	jmp    8021de <vprintfmt+0x303>
+  8021d2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8021d6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8021da:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8021de:	4c 8b 28             	mov    (%rax),%r13
+  8021e1:	4d 85 ed             	test   %r13,%r13
+  8021e4:	75 0e                	jne    8021f4 <vprintfmt+0x319>
+				p = "(null)";
+  8021e6:	48 b8 a4 dc ff ff ff 	movabs $0xffffffffffffdca4,%rax
+  8021ed:	ff ff ff 
+  8021f0:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  8021f4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021f8:	0f 8e 84 00 00 00    	jle    802282 <vprintfmt+0x3a7>
+  8021fe:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  802202:	74 7e                	je     802282 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802204:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802207:	48 98                	cltq
+  802209:	48 89 c6             	mov    %rax,%rsi
+  80220c:	4c 89 ef             	mov    %r13,%rdi
+  80220f:	4d 89 e7             	mov    %r12,%r15
+  802212:	48 b8 7d 69 ff ff ff 	movabs $0xffffffffffff697d,%rax
+  802219:	ff ff ff 
+  80221c:	4c 01 e0             	add    %r12,%rax
+  80221f:	ff d0                	call   *%rax
+  802221:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  802224:	eb 17                	jmp    80223d <vprintfmt+0x362>
+					putch(padc, putdat);
+  802226:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  80222a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  80222e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  802232:	48 89 d6             	mov    %rdx,%rsi
+  802235:	89 c7                	mov    %eax,%edi
+  802237:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802239:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80223d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802241:	7f e3                	jg     802226 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802243:	eb 3d                	jmp    802282 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802245:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  802249:	74 1e                	je     802269 <vprintfmt+0x38e>
+  80224b:	83 fb 1f             	cmp    $0x1f,%ebx
+  80224e:	7e 05                	jle    802255 <vprintfmt+0x37a>
+  802250:	83 fb 7e             	cmp    $0x7e,%ebx
+  802253:	7e 14                	jle    802269 <vprintfmt+0x38e>
+					putch('?', putdat);
+  802255:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802259:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80225d:	48 89 c6             	mov    %rax,%rsi
+  802260:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802265:	ff d2                	call   *%rdx
+  802267:	eb 15                	jmp    80227e <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  802269:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80226c:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  80226f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802273:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  802277:	48 89 c6             	mov    %rax,%rsi
+  80227a:	89 cf                	mov    %ecx,%edi
+  80227c:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80227e:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  802282:	4c 89 e8             	mov    %r13,%rax
+  802285:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  802289:	0f b6 00             	movzbl (%rax),%eax
+  80228c:	0f be d8             	movsbl %al,%ebx
+  80228f:	85 db                	test   %ebx,%ebx
+  802291:	74 28                	je     8022bb <vprintfmt+0x3e0>
+  802293:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  802297:	78 ac                	js     802245 <vprintfmt+0x36a>
+  802299:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  80229d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8022a1:	79 a2                	jns    802245 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  8022a3:	eb 16                	jmp    8022bb <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  8022a5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8022a9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8022ad:	48 89 c6             	mov    %rax,%rsi
+  8022b0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8022b5:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  8022b7:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8022bb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8022bf:	7f e4                	jg     8022a5 <vprintfmt+0x3ca>
+			break;
+  8022c1:	e9 09 02 00 00       	jmp    8024cf <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  8022c6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8022ca:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8022ce:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8022d2:	0f b6 00             	movzbl (%rax),%eax
+  8022d5:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  8022d8:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  8022d9:	83 fb 2f             	cmp    $0x2f,%ebx
+  8022dc:	0f 8e ac fd ff ff    	jle    80208e <vprintfmt+0x1b3>
+  8022e2:	e9 97 fd ff ff       	jmp    80207e <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8022e7:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8022eb:	be 03 00 00 00       	mov    $0x3,%esi
+  8022f0:	48 89 c7             	mov    %rax,%rdi
+  8022f3:	48 b8 78 5d ff ff ff 	movabs $0xffffffffffff5d78,%rax
+  8022fa:	ff ff ff 
+  8022fd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802301:	ff d0                	call   *%rax
+  802303:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  802307:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80230b:	48 85 c0             	test   %rax,%rax
+  80230e:	79 1d                	jns    80232d <vprintfmt+0x452>
+				putch('-', putdat);
+  802310:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802314:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  802318:	48 89 c6             	mov    %rax,%rsi
+  80231b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802320:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  802322:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802326:	48 f7 d8             	neg    %rax
+  802329:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  80232d:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  802334:	e9 de 00 00 00       	jmp    802417 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  802339:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80233d:	be 03 00 00 00       	mov    $0x3,%esi
+  802342:	48 89 c7             	mov    %rax,%rdi
+  802345:	48 b8 17 5c ff ff ff 	movabs $0xffffffffffff5c17,%rax
+  80234c:	ff ff ff 
+  80234f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802353:	ff d0                	call   *%rax
+  802355:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  802359:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  802360:	e9 b2 00 00 00       	jmp    802417 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  802365:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  802369:	be 03 00 00 00       	mov    $0x3,%esi
+  80236e:	48 89 c7             	mov    %rax,%rdi
+  802371:	48 b8 17 5c ff ff ff 	movabs $0xffffffffffff5c17,%rax
+  802378:	ff ff ff 
+  80237b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80237f:	ff d0                	call   *%rax
+  802381:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  802385:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  80238c:	e9 86 00 00 00       	jmp    802417 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  802391:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802395:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  802399:	48 89 c6             	mov    %rax,%rsi
+  80239c:	bf 30 00 00 00       	mov    $0x30,%edi
+  8023a1:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  8023a3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8023a7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8023ab:	48 89 c6             	mov    %rax,%rsi
+  8023ae:	bf 78 00 00 00       	mov    $0x78,%edi
+  8023b3:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  8023b5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8023b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8023bb:	77 17                	ja     8023d4 <vprintfmt+0x4f9>
+  8023bd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8023c1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8023c4:	89 d2                	mov    %edx,%edx
+  8023c6:	48 01 d0             	add    %rdx,%rax
+  8023c9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8023cc:	83 c2 08             	add    $0x8,%edx
+  8023cf:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8023d2:	eb 0c                	jmp    8023e0 <vprintfmt+0x505>
+  8023d4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8023d8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8023dc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8023e0:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8023e3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8023e7:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8023ee:	eb 27                	jmp    802417 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8023f0:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8023f4:	be 03 00 00 00       	mov    $0x3,%esi
+  8023f9:	48 89 c7             	mov    %rax,%rdi
+  8023fc:	48 b8 17 5c ff ff ff 	movabs $0xffffffffffff5c17,%rax
+  802403:	ff ff ff 
+  802406:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80240a:	ff d0                	call   *%rax
+  80240c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  802410:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  802417:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  80241c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80241f:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  802422:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802426:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80242a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80242e:	45 89 c1             	mov    %r8d,%r9d
+  802431:	41 89 f8             	mov    %edi,%r8d
+  802434:	48 89 c7             	mov    %rax,%rdi
+  802437:	48 b8 3f 5b ff ff ff 	movabs $0xffffffffffff5b3f,%rax
+  80243e:	ff ff ff 
+  802441:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802445:	ff d0                	call   *%rax
+			break;
+  802447:	e9 83 00 00 00       	jmp    8024cf <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80244c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  802450:	be 03 00 00 00       	mov    $0x3,%esi
+  802455:	48 89 c7             	mov    %rax,%rdi
+  802458:	48 b8 17 5c ff ff ff 	movabs $0xffffffffffff5c17,%rax
+  80245f:	ff ff ff 
+  802462:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802466:	ff d0                	call   *%rax
+  802468:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80246c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802470:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  802474:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  802478:	48 89 ce             	mov    %rcx,%rsi
+  80247b:	48 89 c7             	mov    %rax,%rdi
+  80247e:	48 b8 32 5d ff ff ff 	movabs $0xffffffffffff5d32,%rax
+  802485:	ff ff ff 
+  802488:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80248c:	ff d0                	call   *%rax
+	
+			break;
+  80248e:	eb 3f                	jmp    8024cf <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  802490:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  802494:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  802498:	48 89 c6             	mov    %rax,%rsi
+  80249b:	89 df                	mov    %ebx,%edi
+  80249d:	ff d2                	call   *%rdx
+			break;
+  80249f:	eb 2e                	jmp    8024cf <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8024a1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8024a5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8024a9:	48 89 c6             	mov    %rax,%rsi
+  8024ac:	bf 25 00 00 00       	mov    $0x25,%edi
+  8024b1:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8024b3:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8024b8:	eb 05                	jmp    8024bf <vprintfmt+0x5e4>
+  8024ba:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  8024bf:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8024c3:	48 83 e8 01          	sub    $0x1,%rax
+  8024c7:	0f b6 00             	movzbl (%rax),%eax
+  8024ca:	3c 25                	cmp    $0x25,%al
+  8024cc:	75 ec                	jne    8024ba <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8024ce:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8024cf:	e9 78 fa ff ff       	jmp    801f4c <vprintfmt+0x71>
+				return;
+  8024d4:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8024d5:	48 83 c4 60          	add    $0x60,%rsp
+  8024d9:	5b                   	pop    %rbx
+  8024da:	41 5c                	pop    %r12
+  8024dc:	41 5d                	pop    %r13
+  8024de:	41 5f                	pop    %r15
+  8024e0:	5d                   	pop    %rbp
+  8024e1:	c3                   	ret
+
+00000000008024e2 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8024e2:	55                   	push   %rbp
+  8024e3:	48 89 e5             	mov    %rsp,%rbp
+  8024e6:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8024ed:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8024ed <printfmt+0xb>
+  8024f4:	49 bb 5b 9b 00 00 00 	movabs $0x9b5b,%r11
+  8024fb:	00 00 00 
+  8024fe:	4d 01 da             	add    %r11,%r10
+  802501:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  802508:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80250f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  802516:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80251d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  802524:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80252b:	84 c0                	test   %al,%al
+  80252d:	74 20                	je     80254f <printfmt+0x6d>
+  80252f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  802533:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  802537:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80253b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80253f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  802543:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  802547:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80254b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80254f:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  802556:	00 00 00 
+  802559:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  802560:	00 00 00 
+  802563:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802567:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80256e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  802575:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80257c:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  802583:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80258a:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  802591:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  802598:	48 89 c7             	mov    %rax,%rdi
+  80259b:	48 b8 93 5e ff ff ff 	movabs $0xffffffffffff5e93,%rax
+  8025a2:	ff ff ff 
+  8025a5:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8025a9:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8025ab:	90                   	nop
+  8025ac:	c9                   	leave
+  8025ad:	c3                   	ret
+
+00000000008025ae <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8025ae:	55                   	push   %rbp
+  8025af:	48 89 e5             	mov    %rsp,%rbp
+  8025b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025b6 <sprintputch+0x8>
+  8025bd:	49 bb 92 9a 00 00 00 	movabs $0x9a92,%r11
+  8025c4:	00 00 00 
+  8025c7:	4c 01 d8             	add    %r11,%rax
+  8025ca:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025cd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8025d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025d5:	8b 40 10             	mov    0x10(%rax),%eax
+  8025d8:	8d 50 01             	lea    0x1(%rax),%edx
+  8025db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025df:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8025e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025e6:	48 8b 10             	mov    (%rax),%rdx
+  8025e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025ed:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8025f1:	48 39 c2             	cmp    %rax,%rdx
+  8025f4:	73 17                	jae    80260d <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8025f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8025fa:	48 8b 00             	mov    (%rax),%rax
+  8025fd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802601:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802605:	48 89 0a             	mov    %rcx,(%rdx)
+  802608:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80260b:	88 10                	mov    %dl,(%rax)
+}
+  80260d:	90                   	nop
+  80260e:	c9                   	leave
+  80260f:	c3                   	ret
+
+0000000000802610 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802610:	55                   	push   %rbp
+  802611:	48 89 e5             	mov    %rsp,%rbp
+  802614:	53                   	push   %rbx
+  802615:	48 83 ec 58          	sub    $0x58,%rsp
+  802619:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802619 <vsnprintf+0x9>
+  802620:	49 bb 2f 9a 00 00 00 	movabs $0x9a2f,%r11
+  802627:	00 00 00 
+  80262a:	4c 01 d8             	add    %r11,%rax
+  80262d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802631:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  802634:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  802638:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80263c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802640:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  802644:	48 8b 0e             	mov    (%rsi),%rcx
+  802647:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80264b:	48 89 0a             	mov    %rcx,(%rdx)
+  80264e:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  802652:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  802656:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80265a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80265e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802662:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  802665:	48 63 d2             	movslq %edx,%rdx
+  802668:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80266c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802670:	48 01 ca             	add    %rcx,%rdx
+  802673:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802677:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80267e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  802683:	74 06                	je     80268b <vsnprintf+0x7b>
+  802685:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  802689:	7f 07                	jg     802692 <vsnprintf+0x82>
+		return -E_INVAL;
+  80268b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802690:	eb 34                	jmp    8026c6 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  802692:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  802696:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80269a:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80269e:	48 bf 66 65 ff ff ff 	movabs $0xffffffffffff6566,%rdi
+  8026a5:	ff ff ff 
+  8026a8:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8026ac:	49 b8 93 5e ff ff ff 	movabs $0xffffffffffff5e93,%r8
+  8026b3:	ff ff ff 
+  8026b6:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8026ba:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8026bc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026c0:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8026c3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8026c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026ca:	c9                   	leave
+  8026cb:	c3                   	ret
+
+00000000008026cc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8026cc:	55                   	push   %rbp
+  8026cd:	48 89 e5             	mov    %rsp,%rbp
+  8026d0:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8026d7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8026d7 <snprintf+0xb>
+  8026de:	49 bb 71 99 00 00 00 	movabs $0x9971,%r11
+  8026e5:	00 00 00 
+  8026e8:	4d 01 da             	add    %r11,%r10
+  8026eb:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8026f2:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8026f8:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8026ff:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  802706:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80270d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  802714:	84 c0                	test   %al,%al
+  802716:	74 20                	je     802738 <snprintf+0x6c>
+  802718:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80271c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  802720:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  802724:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  802728:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80272c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  802730:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  802734:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  802738:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80273f:	00 00 00 
+  802742:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  802749:	00 00 00 
+  80274c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802750:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  802757:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80275e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  802765:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80276c:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  802773:	48 8b 06             	mov    (%rsi),%rax
+  802776:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80277a:	48 89 01             	mov    %rax,(%rcx)
+  80277d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  802781:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  802785:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  802789:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  802790:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  802797:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80279d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8027a4:	48 89 c7             	mov    %rax,%rdi
+  8027a7:	48 b8 c8 65 ff ff ff 	movabs $0xffffffffffff65c8,%rax
+  8027ae:	ff ff ff 
+  8027b1:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8027b5:	ff d0                	call   *%rax
+  8027b7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8027bd:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8027c3:	c9                   	leave
+  8027c4:	c3                   	ret
+
+00000000008027c5 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  8027c5:	55                   	push   %rbp
+  8027c6:	48 89 e5             	mov    %rsp,%rbp
+  8027c9:	41 57                	push   %r15
+  8027cb:	53                   	push   %rbx
+  8027cc:	48 83 ec 20          	sub    $0x20,%rsp
+  8027d0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8027d0 <readline+0xb>
+  8027d7:	49 bb 78 98 00 00 00 	movabs $0x9878,%r11
+  8027de:	00 00 00 
+  8027e1:	4c 01 db             	add    %r11,%rbx
+  8027e4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  8027e8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8027ed:	74 34                	je     802823 <readline+0x5e>
+		fprintf(1, "%s", prompt);
+  8027ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027f3:	48 89 c2             	mov    %rax,%rdx
+  8027f6:	48 b8 60 df ff ff ff 	movabs $0xffffffffffffdf60,%rax
+  8027fd:	ff ff ff 
+  802800:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802804:	48 89 c6             	mov    %rax,%rsi
+  802807:	bf 01 00 00 00       	mov    $0x1,%edi
+  80280c:	49 89 df             	mov    %rbx,%r15
+  80280f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802814:	48 b9 c4 a5 ff ff ff 	movabs $0xffffffffffffa5c4,%rcx
+  80281b:	ff ff ff 
+  80281e:	48 01 d9             	add    %rbx,%rcx
+  802821:	ff d1                	call   *%rcx
+#endif
+
+	i = 0;
+  802823:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	echoing = iscons(0);
+  80282a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80282f:	49 89 df             	mov    %rbx,%r15
+  802832:	48 b8 48 53 ff ff ff 	movabs $0xffffffffffff5348,%rax
+  802839:	ff ff ff 
+  80283c:	48 01 d8             	add    %rbx,%rax
+  80283f:	ff d0                	call   *%rax
+  802841:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	while (1) {
+		c = getchar();
+  802844:	49 89 df             	mov    %rbx,%r15
+  802847:	48 b8 df 52 ff ff ff 	movabs $0xffffffffffff52df,%rax
+  80284e:	ff ff ff 
+  802851:	48 01 d8             	add    %rbx,%rax
+  802854:	ff d0                	call   *%rax
+  802856:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+		if (c < 0) {
+  802859:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80285d:	79 3d                	jns    80289c <readline+0xd7>
+			if (c != -E_EOF)
+  80285f:	83 7d e4 f7          	cmpl   $0xfffffff7,-0x1c(%rbp)
+  802863:	74 2d                	je     802892 <readline+0xcd>
+				cprintf("read error: %e\n", c);
+  802865:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802868:	89 c6                	mov    %eax,%esi
+  80286a:	48 b8 63 df ff ff ff 	movabs $0xffffffffffffdf63,%rax
+  802871:	ff ff ff 
+  802874:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802878:	48 89 c7             	mov    %rax,%rdi
+  80287b:	49 89 df             	mov    %rbx,%r15
+  80287e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802883:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  80288a:	ff ff ff 
+  80288d:	48 01 da             	add    %rbx,%rdx
+  802890:	ff d2                	call   *%rdx
+			return NULL;
+  802892:	b8 00 00 00 00       	mov    $0x0,%eax
+  802897:	e9 de 00 00 00       	jmp    80297a <readline+0x1b5>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  80289c:	83 7d e4 08          	cmpl   $0x8,-0x1c(%rbp)
+  8028a0:	74 06                	je     8028a8 <readline+0xe3>
+  8028a2:	83 7d e4 7f          	cmpl   $0x7f,-0x1c(%rbp)
+  8028a6:	75 2c                	jne    8028d4 <readline+0x10f>
+  8028a8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8028ac:	7e 26                	jle    8028d4 <readline+0x10f>
+			if (echoing)
+  8028ae:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8028b2:	74 17                	je     8028cb <readline+0x106>
+				cputchar('\b');
+  8028b4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8028b9:	49 89 df             	mov    %rbx,%r15
+  8028bc:	48 b8 93 52 ff ff ff 	movabs $0xffffffffffff5293,%rax
+  8028c3:	ff ff ff 
+  8028c6:	48 01 d8             	add    %rbx,%rax
+  8028c9:	ff d0                	call   *%rax
+			i--;
+  8028cb:	83 6d ec 01          	subl   $0x1,-0x14(%rbp)
+  8028cf:	e9 a1 00 00 00       	jmp    802975 <readline+0x1b0>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  8028d4:	83 7d e4 1f          	cmpl   $0x1f,-0x1c(%rbp)
+  8028d8:	7e 48                	jle    802922 <readline+0x15d>
+  8028da:	81 7d ec fe 03 00 00 	cmpl   $0x3fe,-0x14(%rbp)
+  8028e1:	7f 3f                	jg     802922 <readline+0x15d>
+			if (echoing)
+  8028e3:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8028e7:	74 17                	je     802900 <readline+0x13b>
+				cputchar(c);
+  8028e9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8028ec:	89 c7                	mov    %eax,%edi
+  8028ee:	49 89 df             	mov    %rbx,%r15
+  8028f1:	48 b8 93 52 ff ff ff 	movabs $0xffffffffffff5293,%rax
+  8028f8:	ff ff ff 
+  8028fb:	48 01 d8             	add    %rbx,%rax
+  8028fe:	ff d0                	call   *%rax
+			buf[i++] = c;
+  802900:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802903:	8d 50 01             	lea    0x1(%rax),%edx
+  802906:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  802909:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80290c:	89 d1                	mov    %edx,%ecx
+  80290e:	48 ba d8 0f 00 00 00 	movabs $0xfd8,%rdx
+  802915:	00 00 00 
+  802918:	48 98                	cltq
+  80291a:	48 01 da             	add    %rbx,%rdx
+  80291d:	88 0c 02             	mov    %cl,(%rdx,%rax,1)
+  802920:	eb 53                	jmp    802975 <readline+0x1b0>
+		} else if (c == '\n' || c == '\r') {
+  802922:	83 7d e4 0a          	cmpl   $0xa,-0x1c(%rbp)
+  802926:	74 0a                	je     802932 <readline+0x16d>
+  802928:	83 7d e4 0d          	cmpl   $0xd,-0x1c(%rbp)
+  80292c:	0f 85 12 ff ff ff    	jne    802844 <readline+0x7f>
+			if (echoing)
+  802932:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802936:	74 17                	je     80294f <readline+0x18a>
+				cputchar('\n');
+  802938:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80293d:	49 89 df             	mov    %rbx,%r15
+  802940:	48 b8 93 52 ff ff ff 	movabs $0xffffffffffff5293,%rax
+  802947:	ff ff ff 
+  80294a:	48 01 d8             	add    %rbx,%rax
+  80294d:	ff d0                	call   *%rax
+			buf[i] = 0;
+  80294f:	48 ba d8 0f 00 00 00 	movabs $0xfd8,%rdx
+  802956:	00 00 00 
+  802959:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80295c:	48 98                	cltq
+  80295e:	48 01 da             	add    %rbx,%rdx
+  802961:	c6 04 02 00          	movb   $0x0,(%rdx,%rax,1)
+			return buf;
+  802965:	48 b8 d8 0f 00 00 00 	movabs $0xfd8,%rax
+  80296c:	00 00 00 
+  80296f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802973:	eb 05                	jmp    80297a <readline+0x1b5>
+		c = getchar();
+  802975:	e9 ca fe ff ff       	jmp    802844 <readline+0x7f>
+		}
+	}
+}
+  80297a:	48 83 c4 20          	add    $0x20,%rsp
+  80297e:	5b                   	pop    %rbx
+  80297f:	41 5f                	pop    %r15
+  802981:	5d                   	pop    %rbp
+  802982:	c3                   	ret
+
+0000000000802983 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802983:	55                   	push   %rbp
+  802984:	48 89 e5             	mov    %rsp,%rbp
+  802987:	48 83 ec 18          	sub    $0x18,%rsp
+  80298b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80298b <strlen+0x8>
+  802992:	49 bb bd 96 00 00 00 	movabs $0x96bd,%r11
+  802999:	00 00 00 
+  80299c:	4c 01 d8             	add    %r11,%rax
+  80299f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8029a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029aa:	eb 09                	jmp    8029b5 <strlen+0x32>
+		n++;
+  8029ac:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8029b0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8029b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029b9:	0f b6 00             	movzbl (%rax),%eax
+  8029bc:	84 c0                	test   %al,%al
+  8029be:	75 ec                	jne    8029ac <strlen+0x29>
+	return n;
+  8029c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029c3:	c9                   	leave
+  8029c4:	c3                   	ret
+
+00000000008029c5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8029c5:	55                   	push   %rbp
+  8029c6:	48 89 e5             	mov    %rsp,%rbp
+  8029c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8029cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029cd <strnlen+0x8>
+  8029d4:	49 bb 7b 96 00 00 00 	movabs $0x967b,%r11
+  8029db:	00 00 00 
+  8029de:	4c 01 d8             	add    %r11,%rax
+  8029e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8029e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8029f0:	eb 0e                	jmp    802a00 <strnlen+0x3b>
+		n++;
+  8029f2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8029f6:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8029fb:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  802a00:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802a05:	74 0b                	je     802a12 <strnlen+0x4d>
+  802a07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a0b:	0f b6 00             	movzbl (%rax),%eax
+  802a0e:	84 c0                	test   %al,%al
+  802a10:	75 e0                	jne    8029f2 <strnlen+0x2d>
+	return n;
+  802a12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a15:	c9                   	leave
+  802a16:	c3                   	ret
+
+0000000000802a17 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802a17:	55                   	push   %rbp
+  802a18:	48 89 e5             	mov    %rsp,%rbp
+  802a1b:	48 83 ec 20          	sub    $0x20,%rsp
+  802a1f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a1f <strcpy+0x8>
+  802a26:	49 bb 29 96 00 00 00 	movabs $0x9629,%r11
+  802a2d:	00 00 00 
+  802a30:	4c 01 d8             	add    %r11,%rax
+  802a33:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802a37:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  802a3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  802a43:	90                   	nop
+  802a44:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802a48:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802a4c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802a50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a54:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802a58:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802a5c:	0f b6 12             	movzbl (%rdx),%edx
+  802a5f:	88 10                	mov    %dl,(%rax)
+  802a61:	0f b6 00             	movzbl (%rax),%eax
+  802a64:	84 c0                	test   %al,%al
+  802a66:	75 dc                	jne    802a44 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  802a68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802a6c:	c9                   	leave
+  802a6d:	c3                   	ret
+
+0000000000802a6e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802a6e:	55                   	push   %rbp
+  802a6f:	48 89 e5             	mov    %rsp,%rbp
+  802a72:	53                   	push   %rbx
+  802a73:	48 83 ec 20          	sub    $0x20,%rsp
+  802a77:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a77 <strcat+0x9>
+  802a7e:	49 bb d1 95 00 00 00 	movabs $0x95d1,%r11
+  802a85:	00 00 00 
+  802a88:	4c 01 db             	add    %r11,%rbx
+  802a8b:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  802a8f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  802a93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a97:	48 89 c7             	mov    %rax,%rdi
+  802a9a:	48 b8 3b 69 ff ff ff 	movabs $0xffffffffffff693b,%rax
+  802aa1:	ff ff ff 
+  802aa4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802aa8:	ff d0                	call   *%rax
+  802aaa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  802aad:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802ab0:	48 63 d0             	movslq %eax,%rdx
+  802ab3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ab7:	48 01 c2             	add    %rax,%rdx
+  802aba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802abe:	48 89 c6             	mov    %rax,%rsi
+  802ac1:	48 89 d7             	mov    %rdx,%rdi
+  802ac4:	48 b8 cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rax
+  802acb:	ff ff ff 
+  802ace:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ad2:	ff d0                	call   *%rax
+	return dst;
+  802ad4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  802ad8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802adc:	c9                   	leave
+  802add:	c3                   	ret
+
+0000000000802ade <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802ade:	55                   	push   %rbp
+  802adf:	48 89 e5             	mov    %rsp,%rbp
+  802ae2:	48 83 ec 28          	sub    $0x28,%rsp
+  802ae6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ae6 <strncpy+0x8>
+  802aed:	49 bb 62 95 00 00 00 	movabs $0x9562,%r11
+  802af4:	00 00 00 
+  802af7:	4c 01 d8             	add    %r11,%rax
+  802afa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802afe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802b02:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  802b06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b0a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  802b0e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802b15:	00 
+  802b16:	eb 2a                	jmp    802b42 <strncpy+0x64>
+		*dst++ = *src;
+  802b18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b1c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802b20:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802b24:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b28:	0f b6 12             	movzbl (%rdx),%edx
+  802b2b:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  802b2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b31:	0f b6 00             	movzbl (%rax),%eax
+  802b34:	84 c0                	test   %al,%al
+  802b36:	74 05                	je     802b3d <strncpy+0x5f>
+			src++;
+  802b38:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  802b3d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802b42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b46:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802b4a:	72 cc                	jb     802b18 <strncpy+0x3a>
+	}
+	return ret;
+  802b4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802b50:	c9                   	leave
+  802b51:	c3                   	ret
+
+0000000000802b52 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802b52:	55                   	push   %rbp
+  802b53:	48 89 e5             	mov    %rsp,%rbp
+  802b56:	48 83 ec 28          	sub    $0x28,%rsp
+  802b5a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802b5a <strlcpy+0x8>
+  802b61:	49 bb ee 94 00 00 00 	movabs $0x94ee,%r11
+  802b68:	00 00 00 
+  802b6b:	4c 01 d8             	add    %r11,%rax
+  802b6e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802b72:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802b76:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  802b7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b7e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  802b82:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802b87:	74 3d                	je     802bc6 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  802b89:	eb 1d                	jmp    802ba8 <strlcpy+0x56>
+			*dst++ = *src++;
+  802b8b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b8f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802b93:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802b97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b9b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802b9f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802ba3:	0f b6 12             	movzbl (%rdx),%edx
+  802ba6:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  802ba8:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  802bad:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802bb2:	74 0b                	je     802bbf <strlcpy+0x6d>
+  802bb4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802bb8:	0f b6 00             	movzbl (%rax),%eax
+  802bbb:	84 c0                	test   %al,%al
+  802bbd:	75 cc                	jne    802b8b <strlcpy+0x39>
+		*dst = '\0';
+  802bbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bc3:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  802bc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bca:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  802bce:	c9                   	leave
+  802bcf:	c3                   	ret
+
+0000000000802bd0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802bd0:	55                   	push   %rbp
+  802bd1:	48 89 e5             	mov    %rsp,%rbp
+  802bd4:	48 83 ec 10          	sub    $0x10,%rsp
+  802bd8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802bd8 <strcmp+0x8>
+  802bdf:	49 bb 70 94 00 00 00 	movabs $0x9470,%r11
+  802be6:	00 00 00 
+  802be9:	4c 01 d8             	add    %r11,%rax
+  802bec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802bf0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  802bf4:	eb 0a                	jmp    802c00 <strcmp+0x30>
+		p++, q++;
+  802bf6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802bfb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  802c00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c04:	0f b6 00             	movzbl (%rax),%eax
+  802c07:	84 c0                	test   %al,%al
+  802c09:	74 12                	je     802c1d <strcmp+0x4d>
+  802c0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c0f:	0f b6 10             	movzbl (%rax),%edx
+  802c12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c16:	0f b6 00             	movzbl (%rax),%eax
+  802c19:	38 c2                	cmp    %al,%dl
+  802c1b:	74 d9                	je     802bf6 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802c1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c21:	0f b6 00             	movzbl (%rax),%eax
+  802c24:	0f b6 d0             	movzbl %al,%edx
+  802c27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c2b:	0f b6 00             	movzbl (%rax),%eax
+  802c2e:	0f b6 c0             	movzbl %al,%eax
+  802c31:	29 c2                	sub    %eax,%edx
+  802c33:	89 d0                	mov    %edx,%eax
+}
+  802c35:	c9                   	leave
+  802c36:	c3                   	ret
+
+0000000000802c37 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802c37:	55                   	push   %rbp
+  802c38:	48 89 e5             	mov    %rsp,%rbp
+  802c3b:	48 83 ec 18          	sub    $0x18,%rsp
+  802c3f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802c3f <strncmp+0x8>
+  802c46:	49 bb 09 94 00 00 00 	movabs $0x9409,%r11
+  802c4d:	00 00 00 
+  802c50:	4c 01 d8             	add    %r11,%rax
+  802c53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c57:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802c5b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  802c5f:	eb 0f                	jmp    802c70 <strncmp+0x39>
+		n--, p++, q++;
+  802c61:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  802c66:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802c6b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  802c70:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802c75:	74 1d                	je     802c94 <strncmp+0x5d>
+  802c77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c7b:	0f b6 00             	movzbl (%rax),%eax
+  802c7e:	84 c0                	test   %al,%al
+  802c80:	74 12                	je     802c94 <strncmp+0x5d>
+  802c82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c86:	0f b6 10             	movzbl (%rax),%edx
+  802c89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c8d:	0f b6 00             	movzbl (%rax),%eax
+  802c90:	38 c2                	cmp    %al,%dl
+  802c92:	74 cd                	je     802c61 <strncmp+0x2a>
+	if (n == 0)
+  802c94:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802c99:	75 07                	jne    802ca2 <strncmp+0x6b>
+		return 0;
+  802c9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ca0:	eb 16                	jmp    802cb8 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802ca2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ca6:	0f b6 00             	movzbl (%rax),%eax
+  802ca9:	0f b6 d0             	movzbl %al,%edx
+  802cac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cb0:	0f b6 00             	movzbl (%rax),%eax
+  802cb3:	0f b6 c0             	movzbl %al,%eax
+  802cb6:	29 c2                	sub    %eax,%edx
+}
+  802cb8:	89 d0                	mov    %edx,%eax
+  802cba:	c9                   	leave
+  802cbb:	c3                   	ret
+
+0000000000802cbc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802cbc:	55                   	push   %rbp
+  802cbd:	48 89 e5             	mov    %rsp,%rbp
+  802cc0:	48 83 ec 10          	sub    $0x10,%rsp
+  802cc4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802cc4 <strchr+0x8>
+  802ccb:	49 bb 84 93 00 00 00 	movabs $0x9384,%r11
+  802cd2:	00 00 00 
+  802cd5:	4c 01 d8             	add    %r11,%rax
+  802cd8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802cdc:	89 f0                	mov    %esi,%eax
+  802cde:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  802ce1:	eb 17                	jmp    802cfa <strchr+0x3e>
+		if (*s == c)
+  802ce3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ce7:	0f b6 00             	movzbl (%rax),%eax
+  802cea:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  802ced:	75 06                	jne    802cf5 <strchr+0x39>
+			return (char *) s;
+  802cef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cf3:	eb 15                	jmp    802d0a <strchr+0x4e>
+	for (; *s; s++)
+  802cf5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802cfa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cfe:	0f b6 00             	movzbl (%rax),%eax
+  802d01:	84 c0                	test   %al,%al
+  802d03:	75 de                	jne    802ce3 <strchr+0x27>
+	return 0;
+  802d05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d0a:	c9                   	leave
+  802d0b:	c3                   	ret
+
+0000000000802d0c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802d0c:	55                   	push   %rbp
+  802d0d:	48 89 e5             	mov    %rsp,%rbp
+  802d10:	48 83 ec 10          	sub    $0x10,%rsp
+  802d14:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d14 <strfind+0x8>
+  802d1b:	49 bb 34 93 00 00 00 	movabs $0x9334,%r11
+  802d22:	00 00 00 
+  802d25:	4c 01 d8             	add    %r11,%rax
+  802d28:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d2c:	89 f0                	mov    %esi,%eax
+  802d2e:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  802d31:	eb 11                	jmp    802d44 <strfind+0x38>
+		if (*s == c)
+  802d33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d37:	0f b6 00             	movzbl (%rax),%eax
+  802d3a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  802d3d:	74 12                	je     802d51 <strfind+0x45>
+	for (; *s; s++)
+  802d3f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802d44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d48:	0f b6 00             	movzbl (%rax),%eax
+  802d4b:	84 c0                	test   %al,%al
+  802d4d:	75 e4                	jne    802d33 <strfind+0x27>
+  802d4f:	eb 01                	jmp    802d52 <strfind+0x46>
+			break;
+  802d51:	90                   	nop
+	return (char *) s;
+  802d52:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802d56:	c9                   	leave
+  802d57:	c3                   	ret
+
+0000000000802d58 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802d58:	55                   	push   %rbp
+  802d59:	48 89 e5             	mov    %rsp,%rbp
+  802d5c:	48 83 ec 18          	sub    $0x18,%rsp
+  802d60:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d60 <memset+0x8>
+  802d67:	49 bb e8 92 00 00 00 	movabs $0x92e8,%r11
+  802d6e:	00 00 00 
+  802d71:	4c 01 d8             	add    %r11,%rax
+  802d74:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d78:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802d7b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  802d7f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802d84:	75 06                	jne    802d8c <memset+0x34>
+		return v;
+  802d86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d8a:	eb 69                	jmp    802df5 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  802d8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d90:	83 e0 03             	and    $0x3,%eax
+  802d93:	48 85 c0             	test   %rax,%rax
+  802d96:	75 48                	jne    802de0 <memset+0x88>
+  802d98:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d9c:	83 e0 03             	and    $0x3,%eax
+  802d9f:	48 85 c0             	test   %rax,%rax
+  802da2:	75 3c                	jne    802de0 <memset+0x88>
+		c &= 0xFF;
+  802da4:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  802dab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802dae:	c1 e0 18             	shl    $0x18,%eax
+  802db1:	89 c2                	mov    %eax,%edx
+  802db3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802db6:	c1 e0 10             	shl    $0x10,%eax
+  802db9:	09 c2                	or     %eax,%edx
+  802dbb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802dbe:	c1 e0 08             	shl    $0x8,%eax
+  802dc1:	09 d0                	or     %edx,%eax
+  802dc3:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  802dc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dca:	48 c1 e8 02          	shr    $0x2,%rax
+  802dce:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  802dd1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802dd5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802dd8:	48 89 d7             	mov    %rdx,%rdi
+  802ddb:	fc                   	cld
+  802ddc:	f3 ab                	rep stos %eax,%es:(%rdi)
+  802dde:	eb 11                	jmp    802df1 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  802de0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802de4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802de7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802deb:	48 89 d7             	mov    %rdx,%rdi
+  802dee:	fc                   	cld
+  802def:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  802df1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802df5:	c9                   	leave
+  802df6:	c3                   	ret
+
+0000000000802df7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  802df7:	55                   	push   %rbp
+  802df8:	48 89 e5             	mov    %rsp,%rbp
+  802dfb:	48 83 ec 28          	sub    $0x28,%rsp
+  802dff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802dff <memmove+0x8>
+  802e06:	49 bb 49 92 00 00 00 	movabs $0x9249,%r11
+  802e0d:	00 00 00 
+  802e10:	4c 01 d8             	add    %r11,%rax
+  802e13:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802e17:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e1b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  802e1f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  802e27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e2b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  802e2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e33:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802e37:	0f 83 88 00 00 00    	jae    802ec5 <memmove+0xce>
+  802e3d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e45:	48 01 d0             	add    %rdx,%rax
+  802e48:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802e4c:	73 77                	jae    802ec5 <memmove+0xce>
+		s += n;
+  802e4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e52:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  802e56:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e5a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  802e5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e62:	83 e0 03             	and    $0x3,%eax
+  802e65:	48 85 c0             	test   %rax,%rax
+  802e68:	75 3b                	jne    802ea5 <memmove+0xae>
+  802e6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e6e:	83 e0 03             	and    $0x3,%eax
+  802e71:	48 85 c0             	test   %rax,%rax
+  802e74:	75 2f                	jne    802ea5 <memmove+0xae>
+  802e76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e7a:	83 e0 03             	and    $0x3,%eax
+  802e7d:	48 85 c0             	test   %rax,%rax
+  802e80:	75 23                	jne    802ea5 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802e82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e86:	48 83 e8 04          	sub    $0x4,%rax
+  802e8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802e8e:	48 83 ea 04          	sub    $0x4,%rdx
+  802e92:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802e96:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  802e9a:	48 89 c7             	mov    %rax,%rdi
+  802e9d:	48 89 d6             	mov    %rdx,%rsi
+  802ea0:	fd                   	std
+  802ea1:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  802ea3:	eb 1d                	jmp    802ec2 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802ea5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ea9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802ead:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802eb1:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  802eb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802eb9:	48 89 d7             	mov    %rdx,%rdi
+  802ebc:	48 89 c1             	mov    %rax,%rcx
+  802ebf:	fd                   	std
+  802ec0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  802ec2:	fc                   	cld
+  802ec3:	eb 57                	jmp    802f1c <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  802ec5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ec9:	83 e0 03             	and    $0x3,%eax
+  802ecc:	48 85 c0             	test   %rax,%rax
+  802ecf:	75 36                	jne    802f07 <memmove+0x110>
+  802ed1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ed5:	83 e0 03             	and    $0x3,%eax
+  802ed8:	48 85 c0             	test   %rax,%rax
+  802edb:	75 2a                	jne    802f07 <memmove+0x110>
+  802edd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ee1:	83 e0 03             	and    $0x3,%eax
+  802ee4:	48 85 c0             	test   %rax,%rax
+  802ee7:	75 1e                	jne    802f07 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802ee9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802eed:	48 c1 e8 02          	shr    $0x2,%rax
+  802ef1:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  802ef4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ef8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802efc:	48 89 c7             	mov    %rax,%rdi
+  802eff:	48 89 d6             	mov    %rdx,%rsi
+  802f02:	fc                   	cld
+  802f03:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  802f05:	eb 15                	jmp    802f1c <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  802f07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f0b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f0f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802f13:	48 89 c7             	mov    %rax,%rdi
+  802f16:	48 89 d6             	mov    %rdx,%rsi
+  802f19:	fc                   	cld
+  802f1a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  802f1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802f20:	c9                   	leave
+  802f21:	c3                   	ret
+
+0000000000802f22 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802f22:	55                   	push   %rbp
+  802f23:	48 89 e5             	mov    %rsp,%rbp
+  802f26:	48 83 ec 18          	sub    $0x18,%rsp
+  802f2a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f2a <memcpy+0x8>
+  802f31:	49 bb 1e 91 00 00 00 	movabs $0x911e,%r11
+  802f38:	00 00 00 
+  802f3b:	4c 01 d8             	add    %r11,%rax
+  802f3e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802f42:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802f46:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  802f4a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802f4e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  802f52:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802f56:	48 89 cf             	mov    %rcx,%rdi
+  802f59:	48 b9 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rcx
+  802f60:	ff ff ff 
+  802f63:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  802f67:	ff d0                	call   *%rax
+}
+  802f69:	c9                   	leave
+  802f6a:	c3                   	ret
+
+0000000000802f6b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802f6b:	55                   	push   %rbp
+  802f6c:	48 89 e5             	mov    %rsp,%rbp
+  802f6f:	48 83 ec 28          	sub    $0x28,%rsp
+  802f73:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f73 <memcmp+0x8>
+  802f7a:	49 bb d5 90 00 00 00 	movabs $0x90d5,%r11
+  802f81:	00 00 00 
+  802f84:	4c 01 d8             	add    %r11,%rax
+  802f87:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802f8b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802f8f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  802f93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f97:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  802f9b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f9f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  802fa3:	eb 34                	jmp    802fd9 <memcmp+0x6e>
+		if (*s1 != *s2)
+  802fa5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fa9:	0f b6 10             	movzbl (%rax),%edx
+  802fac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fb0:	0f b6 00             	movzbl (%rax),%eax
+  802fb3:	38 c2                	cmp    %al,%dl
+  802fb5:	74 18                	je     802fcf <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  802fb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fbb:	0f b6 00             	movzbl (%rax),%eax
+  802fbe:	0f b6 d0             	movzbl %al,%edx
+  802fc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fc5:	0f b6 00             	movzbl (%rax),%eax
+  802fc8:	0f b6 c0             	movzbl %al,%eax
+  802fcb:	29 c2                	sub    %eax,%edx
+  802fcd:	eb 20                	jmp    802fef <memcmp+0x84>
+		s1++, s2++;
+  802fcf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802fd4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  802fd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fdd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802fe1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802fe5:	48 85 c0             	test   %rax,%rax
+  802fe8:	75 bb                	jne    802fa5 <memcmp+0x3a>
+	}
+
+	return 0;
+  802fea:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  802fef:	89 d0                	mov    %edx,%eax
+  802ff1:	c9                   	leave
+  802ff2:	c3                   	ret
+
+0000000000802ff3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802ff3:	55                   	push   %rbp
+  802ff4:	48 89 e5             	mov    %rsp,%rbp
+  802ff7:	48 83 ec 28          	sub    $0x28,%rsp
+  802ffb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ffb <memfind+0x8>
+  803002:	49 bb 4d 90 00 00 00 	movabs $0x904d,%r11
+  803009:	00 00 00 
+  80300c:	4c 01 d8             	add    %r11,%rax
+  80300f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803013:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  803016:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  80301a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80301e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803022:	48 01 d0             	add    %rdx,%rax
+  803025:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  803029:	eb 13                	jmp    80303e <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80302b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80302f:	0f b6 00             	movzbl (%rax),%eax
+  803032:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803035:	38 d0                	cmp    %dl,%al
+  803037:	74 11                	je     80304a <memfind+0x57>
+	for (; s < ends; s++)
+  803039:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80303e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803042:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803046:	72 e3                	jb     80302b <memfind+0x38>
+  803048:	eb 01                	jmp    80304b <memfind+0x58>
+			break;
+  80304a:	90                   	nop
+	return (void *) s;
+  80304b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80304f:	c9                   	leave
+  803050:	c3                   	ret
+
+0000000000803051 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  803051:	55                   	push   %rbp
+  803052:	48 89 e5             	mov    %rsp,%rbp
+  803055:	48 83 ec 38          	sub    $0x38,%rsp
+  803059:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803059 <strtol+0x8>
+  803060:	49 bb ef 8f 00 00 00 	movabs $0x8fef,%r11
+  803067:	00 00 00 
+  80306a:	4c 01 d8             	add    %r11,%rax
+  80306d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803071:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803075:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  803078:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80307f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803086:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803087:	eb 05                	jmp    80308e <strtol+0x3d>
+		s++;
+  803089:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  80308e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803092:	0f b6 00             	movzbl (%rax),%eax
+  803095:	3c 20                	cmp    $0x20,%al
+  803097:	74 f0                	je     803089 <strtol+0x38>
+  803099:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80309d:	0f b6 00             	movzbl (%rax),%eax
+  8030a0:	3c 09                	cmp    $0x9,%al
+  8030a2:	74 e5                	je     803089 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  8030a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030a8:	0f b6 00             	movzbl (%rax),%eax
+  8030ab:	3c 2b                	cmp    $0x2b,%al
+  8030ad:	75 07                	jne    8030b6 <strtol+0x65>
+		s++;
+  8030af:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8030b4:	eb 17                	jmp    8030cd <strtol+0x7c>
+	else if (*s == '-')
+  8030b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030ba:	0f b6 00             	movzbl (%rax),%eax
+  8030bd:	3c 2d                	cmp    $0x2d,%al
+  8030bf:	75 0c                	jne    8030cd <strtol+0x7c>
+		s++, neg = 1;
+  8030c1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8030c6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8030cd:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8030d1:	74 06                	je     8030d9 <strtol+0x88>
+  8030d3:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8030d7:	75 28                	jne    803101 <strtol+0xb0>
+  8030d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030dd:	0f b6 00             	movzbl (%rax),%eax
+  8030e0:	3c 30                	cmp    $0x30,%al
+  8030e2:	75 1d                	jne    803101 <strtol+0xb0>
+  8030e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030e8:	48 83 c0 01          	add    $0x1,%rax
+  8030ec:	0f b6 00             	movzbl (%rax),%eax
+  8030ef:	3c 78                	cmp    $0x78,%al
+  8030f1:	75 0e                	jne    803101 <strtol+0xb0>
+		s += 2, base = 16;
+  8030f3:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8030f8:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8030ff:	eb 2c                	jmp    80312d <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  803101:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  803105:	75 19                	jne    803120 <strtol+0xcf>
+  803107:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80310b:	0f b6 00             	movzbl (%rax),%eax
+  80310e:	3c 30                	cmp    $0x30,%al
+  803110:	75 0e                	jne    803120 <strtol+0xcf>
+		s++, base = 8;
+  803112:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  803117:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80311e:	eb 0d                	jmp    80312d <strtol+0xdc>
+	else if (base == 0)
+  803120:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  803124:	75 07                	jne    80312d <strtol+0xdc>
+		base = 10;
+  803126:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  80312d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803131:	0f b6 00             	movzbl (%rax),%eax
+  803134:	3c 2f                	cmp    $0x2f,%al
+  803136:	7e 1d                	jle    803155 <strtol+0x104>
+  803138:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80313c:	0f b6 00             	movzbl (%rax),%eax
+  80313f:	3c 39                	cmp    $0x39,%al
+  803141:	7f 12                	jg     803155 <strtol+0x104>
+			dig = *s - '0';
+  803143:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803147:	0f b6 00             	movzbl (%rax),%eax
+  80314a:	0f be c0             	movsbl %al,%eax
+  80314d:	83 e8 30             	sub    $0x30,%eax
+  803150:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803153:	eb 4e                	jmp    8031a3 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  803155:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803159:	0f b6 00             	movzbl (%rax),%eax
+  80315c:	3c 60                	cmp    $0x60,%al
+  80315e:	7e 1d                	jle    80317d <strtol+0x12c>
+  803160:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803164:	0f b6 00             	movzbl (%rax),%eax
+  803167:	3c 7a                	cmp    $0x7a,%al
+  803169:	7f 12                	jg     80317d <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  80316b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80316f:	0f b6 00             	movzbl (%rax),%eax
+  803172:	0f be c0             	movsbl %al,%eax
+  803175:	83 e8 57             	sub    $0x57,%eax
+  803178:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80317b:	eb 26                	jmp    8031a3 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  80317d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803181:	0f b6 00             	movzbl (%rax),%eax
+  803184:	3c 40                	cmp    $0x40,%al
+  803186:	7e 47                	jle    8031cf <strtol+0x17e>
+  803188:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80318c:	0f b6 00             	movzbl (%rax),%eax
+  80318f:	3c 5a                	cmp    $0x5a,%al
+  803191:	7f 3c                	jg     8031cf <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  803193:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803197:	0f b6 00             	movzbl (%rax),%eax
+  80319a:	0f be c0             	movsbl %al,%eax
+  80319d:	83 e8 37             	sub    $0x37,%eax
+  8031a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  8031a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031a6:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8031a9:	7d 23                	jge    8031ce <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  8031ab:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8031b0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8031b3:	48 98                	cltq
+  8031b5:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8031ba:	48 89 c2             	mov    %rax,%rdx
+  8031bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031c0:	48 98                	cltq
+  8031c2:	48 01 d0             	add    %rdx,%rax
+  8031c5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  8031c9:	e9 5f ff ff ff       	jmp    80312d <strtol+0xdc>
+			break;
+  8031ce:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8031cf:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8031d4:	74 0b                	je     8031e1 <strtol+0x190>
+		*endptr = (char *) s;
+  8031d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031da:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031de:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8031e1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031e5:	74 09                	je     8031f0 <strtol+0x19f>
+  8031e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031eb:	48 f7 d8             	neg    %rax
+  8031ee:	eb 04                	jmp    8031f4 <strtol+0x1a3>
+  8031f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8031f4:	c9                   	leave
+  8031f5:	c3                   	ret
+
+00000000008031f6 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  8031f6:	55                   	push   %rbp
+  8031f7:	48 89 e5             	mov    %rsp,%rbp
+  8031fa:	53                   	push   %rbx
+  8031fb:	48 83 ec 30          	sub    $0x30,%rsp
+  8031ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031ff <strstr+0x9>
+  803206:	49 bb 49 8e 00 00 00 	movabs $0x8e49,%r11
+  80320d:	00 00 00 
+  803210:	4c 01 db             	add    %r11,%rbx
+  803213:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  803217:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  80321b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80321f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803223:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803227:	0f b6 00             	movzbl (%rax),%eax
+  80322a:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  80322d:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  803231:	75 06                	jne    803239 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  803233:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803237:	eb 73                	jmp    8032ac <strstr+0xb6>
+
+	len = strlen(str);
+  803239:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80323d:	48 89 c7             	mov    %rax,%rdi
+  803240:	48 b8 3b 69 ff ff ff 	movabs $0xffffffffffff693b,%rax
+  803247:	ff ff ff 
+  80324a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80324e:	ff d0                	call   *%rax
+  803250:	48 98                	cltq
+  803252:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  803256:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80325a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80325e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803262:	0f b6 00             	movzbl (%rax),%eax
+  803265:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  803268:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  80326c:	75 07                	jne    803275 <strstr+0x7f>
+				return (char *) 0;
+  80326e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803273:	eb 37                	jmp    8032ac <strstr+0xb6>
+		} while (sc != c);
+  803275:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  803279:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  80327c:	75 d8                	jne    803256 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  80327e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803282:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803286:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80328a:	48 89 ce             	mov    %rcx,%rsi
+  80328d:	48 89 c7             	mov    %rax,%rdi
+  803290:	48 b8 ef 6b ff ff ff 	movabs $0xffffffffffff6bef,%rax
+  803297:	ff ff ff 
+  80329a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80329e:	ff d0                	call   *%rax
+  8032a0:	85 c0                	test   %eax,%eax
+  8032a2:	75 b2                	jne    803256 <strstr+0x60>
+
+	return (char *) (in - 1);
+  8032a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032a8:	48 83 e8 01          	sub    $0x1,%rax
+}
+  8032ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032b0:	c9                   	leave
+  8032b1:	c3                   	ret
+
+00000000008032b2 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  8032b2:	55                   	push   %rbp
+  8032b3:	48 89 e5             	mov    %rsp,%rbp
+  8032b6:	41 57                	push   %r15
+  8032b8:	53                   	push   %rbx
+  8032b9:	48 83 ec 40          	sub    $0x40,%rsp
+  8032bd:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8032bd <syscall+0xb>
+  8032c4:	49 bb 8b 8d 00 00 00 	movabs $0x8d8b,%r11
+  8032cb:	00 00 00 
+  8032ce:	4d 01 da             	add    %r11,%r10
+  8032d1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8032d4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8032d7:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8032db:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8032df:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8032e3:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  8032e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8032ea:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8032ee:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8032f2:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8032f6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8032fa:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8032fe:	4c 89 c3             	mov    %r8,%rbx
+  803301:	cd 30                	int    $0x30
+  803303:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  803307:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80330b:	74 52                	je     80335f <syscall+0xad>
+  80330d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803312:	7e 4b                	jle    80335f <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  803314:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803318:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80331b:	49 89 d0             	mov    %rdx,%r8
+  80331e:	89 c1                	mov    %eax,%ecx
+  803320:	48 b8 73 df ff ff ff 	movabs $0xffffffffffffdf73,%rax
+  803327:	ff ff ff 
+  80332a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80332e:	48 89 c2             	mov    %rax,%rdx
+  803331:	be 23 00 00 00       	mov    $0x23,%esi
+  803336:	48 b8 90 df ff ff ff 	movabs $0xffffffffffffdf90,%rax
+  80333d:	ff ff ff 
+  803340:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  803344:	48 89 c7             	mov    %rax,%rdi
+  803347:	4d 89 d7             	mov    %r10,%r15
+  80334a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80334f:	49 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r9
+  803356:	ff ff ff 
+  803359:	4d 01 d1             	add    %r10,%r9
+  80335c:	41 ff d1             	call   *%r9
+
+	return ret;
+  80335f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  803363:	48 83 c4 40          	add    $0x40,%rsp
+  803367:	5b                   	pop    %rbx
+  803368:	41 5f                	pop    %r15
+  80336a:	5d                   	pop    %rbp
+  80336b:	c3                   	ret
+
+000000000080336c <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  80336c:	55                   	push   %rbp
+  80336d:	48 89 e5             	mov    %rsp,%rbp
+  803370:	41 57                	push   %r15
+  803372:	41 56                	push   %r14
+  803374:	41 55                	push   %r13
+  803376:	41 54                	push   %r12
+  803378:	53                   	push   %rbx
+  803379:	48 83 ec 48          	sub    $0x48,%rsp
+  80337d:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 80337d <syscall_words+0x11>
+  803384:	49 bb cb 8c 00 00 00 	movabs $0x8ccb,%r11
+  80338b:	00 00 00 
+  80338e:	4d 01 de             	add    %r11,%r14
+  803391:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803394:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  803397:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  80339b:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  80339f:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  8033a3:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  8033a7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8033ac:	74 09                	je     8033b7 <syscall_words+0x4b>
+  8033ae:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8033b2:	48 8b 00             	mov    (%rax),%rax
+  8033b5:	eb 05                	jmp    8033bc <syscall_words+0x50>
+  8033b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033bc:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  8033bf:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8033c4:	74 0a                	je     8033d0 <syscall_words+0x64>
+  8033c6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8033ca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8033ce:	eb 05                	jmp    8033d5 <syscall_words+0x69>
+  8033d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d5:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  8033d8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8033dd:	74 0a                	je     8033e9 <syscall_words+0x7d>
+  8033df:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8033e3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8033e7:	eb 05                	jmp    8033ee <syscall_words+0x82>
+  8033e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ee:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  8033f1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  8033f6:	74 0a                	je     803402 <syscall_words+0x96>
+  8033f8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8033fc:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803400:	eb 05                	jmp    803407 <syscall_words+0x9b>
+  803402:	b8 00 00 00 00       	mov    $0x0,%eax
+  803407:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  80340a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80340f:	74 0a                	je     80341b <syscall_words+0xaf>
+  803411:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803415:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803419:	eb 05                	jmp    803420 <syscall_words+0xb4>
+  80341b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803420:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  803423:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  803428:	74 0a                	je     803434 <syscall_words+0xc8>
+  80342a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80342e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803432:	eb 05                	jmp    803439 <syscall_words+0xcd>
+  803434:	b8 00 00 00 00       	mov    $0x0,%eax
+  803439:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  80343c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80343f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803443:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803447:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  80344b:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80344f:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  803453:	cd 30                	int    $0x30
+  803455:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  803459:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80345e:	74 50                	je     8034b0 <syscall_words+0x144>
+		words[0] = r8;
+  803460:	4c 89 c2             	mov    %r8,%rdx
+  803463:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803467:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  80346a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80346e:	48 83 c0 08          	add    $0x8,%rax
+  803472:	4c 89 ca             	mov    %r9,%rdx
+  803475:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  803478:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80347c:	48 83 c0 10          	add    $0x10,%rax
+  803480:	4c 89 d2             	mov    %r10,%rdx
+  803483:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  803486:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80348a:	48 83 c0 18          	add    $0x18,%rax
+  80348e:	4c 89 da             	mov    %r11,%rdx
+  803491:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  803494:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803498:	48 83 c0 20          	add    $0x20,%rax
+  80349c:	4c 89 e2             	mov    %r12,%rdx
+  80349f:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  8034a2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8034a6:	48 83 c0 28          	add    $0x28,%rax
+  8034aa:	4c 89 ea             	mov    %r13,%rdx
+  8034ad:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  8034b0:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8034b4:	74 52                	je     803508 <syscall_words+0x19c>
+  8034b6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8034bb:	7e 4b                	jle    803508 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8034bd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8034c1:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8034c4:	49 89 d0             	mov    %rdx,%r8
+  8034c7:	89 c1                	mov    %eax,%ecx
+  8034c9:	48 b8 73 df ff ff ff 	movabs $0xffffffffffffdf73,%rax
+  8034d0:	ff ff ff 
+  8034d3:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8034d7:	48 89 c2             	mov    %rax,%rdx
+  8034da:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8034df:	48 b8 90 df ff ff ff 	movabs $0xffffffffffffdf90,%rax
+  8034e6:	ff ff ff 
+  8034e9:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8034ed:	48 89 c7             	mov    %rax,%rdi
+  8034f0:	4d 89 f7             	mov    %r14,%r15
+  8034f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f8:	49 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r9
+  8034ff:	ff ff ff 
+  803502:	4d 01 f1             	add    %r14,%r9
+  803505:	41 ff d1             	call   *%r9
+
+	return ret;
+  803508:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80350c:	48 83 c4 48          	add    $0x48,%rsp
+  803510:	5b                   	pop    %rbx
+  803511:	41 5c                	pop    %r12
+  803513:	41 5d                	pop    %r13
+  803515:	41 5e                	pop    %r14
+  803517:	41 5f                	pop    %r15
+  803519:	5d                   	pop    %rbp
+  80351a:	c3                   	ret
+
+000000000080351b <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80351b:	55                   	push   %rbp
+  80351c:	48 89 e5             	mov    %rsp,%rbp
+  80351f:	48 83 ec 10          	sub    $0x10,%rsp
+  803523:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803523 <sys_cputs+0x8>
+  80352a:	49 bb 25 8b 00 00 00 	movabs $0x8b25,%r11
+  803531:	00 00 00 
+  803534:	4c 01 d8             	add    %r11,%rax
+  803537:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80353b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80353f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803543:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803547:	48 83 ec 08          	sub    $0x8,%rsp
+  80354b:	6a 00                	push   $0x0
+  80354d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803553:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803559:	be 00 00 00 00       	mov    $0x0,%esi
+  80355e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803563:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  80356a:	ff ff ff 
+  80356d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803571:	ff d0                	call   *%rax
+  803573:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803577:	90                   	nop
+  803578:	c9                   	leave
+  803579:	c3                   	ret
+
+000000000080357a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80357a:	55                   	push   %rbp
+  80357b:	48 89 e5             	mov    %rsp,%rbp
+  80357e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80357e <sys_cgetc+0x4>
+  803585:	49 bb ca 8a 00 00 00 	movabs $0x8aca,%r11
+  80358c:	00 00 00 
+  80358f:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  803592:	48 83 ec 08          	sub    $0x8,%rsp
+  803596:	6a 00                	push   $0x0
+  803598:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80359e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8035a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8035b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035b8:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  8035bf:	ff ff ff 
+  8035c2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8035c6:	ff d0                	call   *%rax
+  8035c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8035cc:	c9                   	leave
+  8035cd:	c3                   	ret
+
+00000000008035ce <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8035ce:	55                   	push   %rbp
+  8035cf:	48 89 e5             	mov    %rsp,%rbp
+  8035d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8035d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8035d6 <sys_env_destroy+0x8>
+  8035dd:	49 bb 72 8a 00 00 00 	movabs $0x8a72,%r11
+  8035e4:	00 00 00 
+  8035e7:	4c 01 d8             	add    %r11,%rax
+  8035ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8035ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8035f0:	48 63 d2             	movslq %edx,%rdx
+  8035f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8035f7:	6a 00                	push   $0x0
+  8035f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8035ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803605:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80360a:	be 01 00 00 00       	mov    $0x1,%esi
+  80360f:	bf 03 00 00 00       	mov    $0x3,%edi
+  803614:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  80361b:	ff ff ff 
+  80361e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803622:	ff d0                	call   *%rax
+  803624:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803628:	c9                   	leave
+  803629:	c3                   	ret
+
+000000000080362a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80362a:	55                   	push   %rbp
+  80362b:	48 89 e5             	mov    %rsp,%rbp
+  80362e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80362e <sys_getenvid+0x4>
+  803635:	49 bb 1a 8a 00 00 00 	movabs $0x8a1a,%r11
+  80363c:	00 00 00 
+  80363f:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  803642:	48 83 ec 08          	sub    $0x8,%rsp
+  803646:	6a 00                	push   $0x0
+  803648:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80364e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803654:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803659:	ba 00 00 00 00       	mov    $0x0,%edx
+  80365e:	be 00 00 00 00       	mov    $0x0,%esi
+  803663:	bf 02 00 00 00       	mov    $0x2,%edi
+  803668:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  80366f:	ff ff ff 
+  803672:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803676:	ff d0                	call   *%rax
+  803678:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80367c:	c9                   	leave
+  80367d:	c3                   	ret
+
+000000000080367e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80367e:	55                   	push   %rbp
+  80367f:	48 89 e5             	mov    %rsp,%rbp
+  803682:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803682 <sys_yield+0x4>
+  803689:	49 bb c6 89 00 00 00 	movabs $0x89c6,%r11
+  803690:	00 00 00 
+  803693:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  803696:	48 83 ec 08          	sub    $0x8,%rsp
+  80369a:	6a 00                	push   $0x0
+  80369c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8036a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8036a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8036ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8036b7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8036bc:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  8036c3:	ff ff ff 
+  8036c6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8036ca:	ff d0                	call   *%rax
+  8036cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8036d0:	90                   	nop
+  8036d1:	c9                   	leave
+  8036d2:	c3                   	ret
+
+00000000008036d3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8036d3:	55                   	push   %rbp
+  8036d4:	48 89 e5             	mov    %rsp,%rbp
+  8036d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8036db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8036db <sys_page_alloc+0x8>
+  8036e2:	49 bb 6d 89 00 00 00 	movabs $0x896d,%r11
+  8036e9:	00 00 00 
+  8036ec:	4c 01 d8             	add    %r11,%rax
+  8036ef:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8036f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8036f6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8036f9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8036fc:	48 63 f2             	movslq %edx,%rsi
+  8036ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803703:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803706:	48 63 d2             	movslq %edx,%rdx
+  803709:	48 83 ec 08          	sub    $0x8,%rsp
+  80370d:	6a 00                	push   $0x0
+  80370f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803715:	49 89 f0             	mov    %rsi,%r8
+  803718:	be 01 00 00 00       	mov    $0x1,%esi
+  80371d:	bf 04 00 00 00       	mov    $0x4,%edi
+  803722:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803729:	ff ff ff 
+  80372c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803730:	ff d0                	call   *%rax
+  803732:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803736:	c9                   	leave
+  803737:	c3                   	ret
+
+0000000000803738 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  803738:	55                   	push   %rbp
+  803739:	48 89 e5             	mov    %rsp,%rbp
+  80373c:	48 83 ec 20          	sub    $0x20,%rsp
+  803740:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803740 <sys_page_map+0x8>
+  803747:	49 bb 08 89 00 00 00 	movabs $0x8908,%r11
+  80374e:	00 00 00 
+  803751:	4c 01 d8             	add    %r11,%rax
+  803754:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803757:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80375b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80375e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803762:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  803766:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803769:	48 63 f2             	movslq %edx,%rsi
+  80376c:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  803770:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803773:	48 63 fa             	movslq %edx,%rdi
+  803776:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80377a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80377d:	48 63 d2             	movslq %edx,%rdx
+  803780:	48 83 ec 08          	sub    $0x8,%rsp
+  803784:	56                   	push   %rsi
+  803785:	4d 89 c1             	mov    %r8,%r9
+  803788:	49 89 f8             	mov    %rdi,%r8
+  80378b:	be 01 00 00 00       	mov    $0x1,%esi
+  803790:	bf 05 00 00 00       	mov    $0x5,%edi
+  803795:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  80379c:	ff ff ff 
+  80379f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8037a3:	ff d0                	call   *%rax
+  8037a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8037a9:	c9                   	leave
+  8037aa:	c3                   	ret
+
+00000000008037ab <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8037ab:	55                   	push   %rbp
+  8037ac:	48 89 e5             	mov    %rsp,%rbp
+  8037af:	48 83 ec 10          	sub    $0x10,%rsp
+  8037b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8037b3 <sys_page_unmap+0x8>
+  8037ba:	49 bb 95 88 00 00 00 	movabs $0x8895,%r11
+  8037c1:	00 00 00 
+  8037c4:	4c 01 d8             	add    %r11,%rax
+  8037c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8037ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8037ce:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8037d2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8037d5:	48 63 d2             	movslq %edx,%rdx
+  8037d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8037dc:	6a 00                	push   $0x0
+  8037de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8037e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8037ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8037ef:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037f4:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  8037fb:	ff ff ff 
+  8037fe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803802:	ff d0                	call   *%rax
+  803804:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803808:	c9                   	leave
+  803809:	c3                   	ret
+
+000000000080380a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80380a:	55                   	push   %rbp
+  80380b:	48 89 e5             	mov    %rsp,%rbp
+  80380e:	48 83 ec 10          	sub    $0x10,%rsp
+  803812:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803812 <sys_env_set_status+0x8>
+  803819:	49 bb 36 88 00 00 00 	movabs $0x8836,%r11
+  803820:	00 00 00 
+  803823:	4c 01 d8             	add    %r11,%rax
+  803826:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803829:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80382c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80382f:	48 63 ca             	movslq %edx,%rcx
+  803832:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803835:	48 63 d2             	movslq %edx,%rdx
+  803838:	48 83 ec 08          	sub    $0x8,%rsp
+  80383c:	6a 00                	push   $0x0
+  80383e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803844:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80384a:	be 01 00 00 00       	mov    $0x1,%esi
+  80384f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803854:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  80385b:	ff ff ff 
+  80385e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803862:	ff d0                	call   *%rax
+  803864:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803868:	c9                   	leave
+  803869:	c3                   	ret
+
+000000000080386a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80386a:	55                   	push   %rbp
+  80386b:	48 89 e5             	mov    %rsp,%rbp
+  80386e:	48 83 ec 10          	sub    $0x10,%rsp
+  803872:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803872 <sys_env_set_trapframe+0x8>
+  803879:	49 bb d6 87 00 00 00 	movabs $0x87d6,%r11
+  803880:	00 00 00 
+  803883:	4c 01 d8             	add    %r11,%rax
+  803886:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803889:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80388d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803891:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803894:	48 63 d2             	movslq %edx,%rdx
+  803897:	48 83 ec 08          	sub    $0x8,%rsp
+  80389b:	6a 00                	push   $0x0
+  80389d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8038a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8038a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8038ae:	bf 09 00 00 00       	mov    $0x9,%edi
+  8038b3:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  8038ba:	ff ff ff 
+  8038bd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8038c1:	ff d0                	call   *%rax
+  8038c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8038c7:	c9                   	leave
+  8038c8:	c3                   	ret
+
+00000000008038c9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8038c9:	55                   	push   %rbp
+  8038ca:	48 89 e5             	mov    %rsp,%rbp
+  8038cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8038d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8038d1 <sys_env_set_pgfault_upcall+0x8>
+  8038d8:	49 bb 77 87 00 00 00 	movabs $0x8777,%r11
+  8038df:	00 00 00 
+  8038e2:	4c 01 d8             	add    %r11,%rax
+  8038e5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8038e8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8038ec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8038f0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8038f3:	48 63 d2             	movslq %edx,%rdx
+  8038f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8038fa:	6a 00                	push   $0x0
+  8038fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803902:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803908:	be 01 00 00 00       	mov    $0x1,%esi
+  80390d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803912:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803919:	ff ff ff 
+  80391c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803920:	ff d0                	call   *%rax
+  803922:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803926:	c9                   	leave
+  803927:	c3                   	ret
+
+0000000000803928 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  803928:	55                   	push   %rbp
+  803929:	48 89 e5             	mov    %rsp,%rbp
+  80392c:	48 83 ec 20          	sub    $0x20,%rsp
+  803930:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803930 <sys_ipc_try_send+0x8>
+  803937:	49 bb 18 87 00 00 00 	movabs $0x8718,%r11
+  80393e:	00 00 00 
+  803941:	4c 01 d8             	add    %r11,%rax
+  803944:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803947:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80394b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80394f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  803952:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803955:	48 63 fa             	movslq %edx,%rdi
+  803958:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80395c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80395f:	48 63 d2             	movslq %edx,%rdx
+  803962:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803966:	48 83 ec 08          	sub    $0x8,%rsp
+  80396a:	6a 00                	push   $0x0
+  80396c:	49 89 f9             	mov    %rdi,%r9
+  80396f:	49 89 f0             	mov    %rsi,%r8
+  803972:	be 00 00 00 00       	mov    $0x0,%esi
+  803977:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80397c:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803983:	ff ff ff 
+  803986:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80398a:	ff d0                	call   *%rax
+  80398c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803990:	c9                   	leave
+  803991:	c3                   	ret
+
+0000000000803992 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  803992:	55                   	push   %rbp
+  803993:	48 89 e5             	mov    %rsp,%rbp
+  803996:	48 83 ec 20          	sub    $0x20,%rsp
+  80399a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80399a <sys_ipc_send+0x8>
+  8039a1:	49 bb ae 86 00 00 00 	movabs $0x86ae,%r11
+  8039a8:	00 00 00 
+  8039ab:	4c 01 d8             	add    %r11,%rax
+  8039ae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8039b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8039b5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8039b9:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8039bc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8039bf:	48 63 fa             	movslq %edx,%rdi
+  8039c2:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8039c6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8039c9:	48 63 d2             	movslq %edx,%rdx
+  8039cc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8039d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8039d4:	6a 00                	push   $0x0
+  8039d6:	49 89 f9             	mov    %rdi,%r9
+  8039d9:	49 89 f0             	mov    %rsi,%r8
+  8039dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8039e1:	bf 17 00 00 00       	mov    $0x17,%edi
+  8039e6:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  8039ed:	ff ff ff 
+  8039f0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8039f4:	ff d0                	call   *%rax
+  8039f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8039fa:	c9                   	leave
+  8039fb:	c3                   	ret
+
+00000000008039fc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8039fc:	55                   	push   %rbp
+  8039fd:	48 89 e5             	mov    %rsp,%rbp
+  803a00:	48 83 ec 10          	sub    $0x10,%rsp
+  803a04:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a04 <sys_ipc_recv+0x8>
+  803a0b:	49 bb 44 86 00 00 00 	movabs $0x8644,%r11
+  803a12:	00 00 00 
+  803a15:	4c 01 d8             	add    %r11,%rax
+  803a18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  803a1c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a20:	6a 00                	push   $0x0
+  803a22:	6a 00                	push   $0x0
+  803a24:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803a2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803a30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a35:	be 01 00 00 00       	mov    $0x1,%esi
+  803a3a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803a3f:	49 ba 24 73 ff ff ff 	movabs $0xffffffffffff7324,%r10
+  803a46:	ff ff ff 
+  803a49:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803a4d:	ff d0                	call   *%rax
+  803a4f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803a53:	c9                   	leave
+  803a54:	c3                   	ret
+
+0000000000803a55 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  803a55:	55                   	push   %rbp
+  803a56:	48 89 e5             	mov    %rsp,%rbp
+  803a59:	48 83 ec 30          	sub    $0x30,%rsp
+  803a5d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a5d <sys_ipc_call+0x8>
+  803a64:	49 bb eb 85 00 00 00 	movabs $0x85eb,%r11
+  803a6b:	00 00 00 
+  803a6e:	4c 01 d8             	add    %r11,%rax
+  803a71:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803a74:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803a78:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803a7c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  803a7f:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  803a83:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  803a87:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  803a8b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803a8e:	4c 63 c2             	movslq %edx,%r8
+  803a91:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  803a95:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803a98:	48 63 d2             	movslq %edx,%rdx
+  803a9b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803a9f:	ff 75 d8             	push   -0x28(%rbp)
+  803aa2:	56                   	push   %rsi
+  803aa3:	4d 89 c1             	mov    %r8,%r9
+  803aa6:	49 89 f8             	mov    %rdi,%r8
+  803aa9:	be 00 00 00 00       	mov    $0x0,%esi
+  803aae:	bf 18 00 00 00       	mov    $0x18,%edi
+  803ab3:	49 ba 24 73 ff ff ff 	movabs $0xffffffffffff7324,%r10
+  803aba:	ff ff ff 
+  803abd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803ac1:	ff d0                	call   *%rax
+  803ac3:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  803ac7:	c9                   	leave
+  803ac8:	c3                   	ret
+
+0000000000803ac9 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  803ac9:	55                   	push   %rbp
+  803aca:	48 89 e5             	mov    %rsp,%rbp
+  803acd:	48 83 ec 30          	sub    $0x30,%rsp
+  803ad1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ad1 <sys_ipc_reply_recv+0x8>
+  803ad8:	49 bb 77 85 00 00 00 	movabs $0x8577,%r11
+  803adf:	00 00 00 
+  803ae2:	4c 01 d8             	add    %r11,%rax
+  803ae5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803ae8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803aec:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803af0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  803af3:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  803af7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  803afb:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  803aff:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803b02:	4c 63 c2             	movslq %edx,%r8
+  803b05:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  803b09:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803b0c:	48 63 d2             	movslq %edx,%rdx
+  803b0f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803b13:	ff 75 d8             	push   -0x28(%rbp)
+  803b16:	56                   	push   %rsi
+  803b17:	4d 89 c1             	mov    %r8,%r9
+  803b1a:	49 89 f8             	mov    %rdi,%r8
+  803b1d:	be 00 00 00 00       	mov    $0x0,%esi
+  803b22:	bf 19 00 00 00       	mov    $0x19,%edi
+  803b27:	49 ba 24 73 ff ff ff 	movabs $0xffffffffffff7324,%r10
+  803b2e:	ff ff ff 
+  803b31:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803b35:	ff d0                	call   *%rax
+  803b37:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  803b3b:	c9                   	leave
+  803b3c:	c3                   	ret
+
+0000000000803b3d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  803b3d:	55                   	push   %rbp
+  803b3e:	48 89 e5             	mov    %rsp,%rbp
+  803b41:	48 83 ec 10          	sub    $0x10,%rsp
+  803b45:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b45 <sys_env_set_priority+0x8>
+  803b4c:	49 bb 03 85 00 00 00 	movabs $0x8503,%r11
+  803b53:	00 00 00 
+  803b56:	4c 01 d8             	add    %r11,%rax
+  803b59:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803b5c:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  803b5f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803b62:	48 63 ca             	movslq %edx,%rcx
+  803b65:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803b68:	48 63 d2             	movslq %edx,%rdx
+  803b6b:	48 83 ec 08          	sub    $0x8,%rsp
+  803b6f:	6a 00                	push   $0x0
+  803b71:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803b77:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803b7d:	be 01 00 00 00       	mov    $0x1,%esi
+  803b82:	bf 0f 00 00 00       	mov    $0xf,%edi
+  803b87:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803b8e:	ff ff ff 
+  803b91:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803b95:	ff d0                	call   *%rax
+  803b97:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803b9b:	c9                   	leave
+  803b9c:	c3                   	ret
+
+0000000000803b9d <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  803b9d:	55                   	push   %rbp
+  803b9e:	48 89 e5             	mov    %rsp,%rbp
+  803ba1:	48 83 ec 10          	sub    $0x10,%rsp
+  803ba5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ba5 <sys_env_set_affinity+0x8>
+  803bac:	49 bb a3 84 00 00 00 	movabs $0x84a3,%r11
+  803bb3:	00 00 00 
+  803bb6:	4c 01 d8             	add    %r11,%rax
+  803bb9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803bbc:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  803bbf:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  803bc2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803bc5:	48 63 d2             	movslq %edx,%rdx
+  803bc8:	48 83 ec 08          	sub    $0x8,%rsp
+  803bcc:	6a 00                	push   $0x0
+  803bce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803bd4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803bda:	be 01 00 00 00       	mov    $0x1,%esi
+  803bdf:	bf 10 00 00 00       	mov    $0x10,%edi
+  803be4:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803beb:	ff ff ff 
+  803bee:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803bf2:	ff d0                	call   *%rax
+  803bf4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803bf8:	c9                   	leave
+  803bf9:	c3                   	ret
+
+0000000000803bfa <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  803bfa:	55                   	push   %rbp
+  803bfb:	48 89 e5             	mov    %rsp,%rbp
+  803bfe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803bfe <sys_time_msec+0x4>
+  803c05:	49 bb 4a 84 00 00 00 	movabs $0x844a,%r11
+  803c0c:	00 00 00 
+  803c0f:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  803c12:	48 83 ec 08          	sub    $0x8,%rsp
+  803c16:	6a 00                	push   $0x0
+  803c18:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803c1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803c24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c29:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c2e:	be 00 00 00 00       	mov    $0x0,%esi
+  803c33:	bf 0e 00 00 00       	mov    $0xe,%edi
+  803c38:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803c3f:	ff ff ff 
+  803c42:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803c46:	ff d0                	call   *%rax
+  803c48:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803c4c:	c9                   	leave
+  803c4d:	c3                   	ret
+
+0000000000803c4e <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  803c4e:	55                   	push   %rbp
+  803c4f:	48 89 e5             	mov    %rsp,%rbp
+  803c52:	48 83 ec 10          	sub    $0x10,%rsp
+  803c56:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c56 <sys_sleep_usec+0x8>
+  803c5d:	49 bb f2 83 00 00 00 	movabs $0x83f2,%r11
+  803c64:	00 00 00 
+  803c67:	4c 01 d8             	add    %r11,%rax
+  803c6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  803c6e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803c72:	48 83 ec 08          	sub    $0x8,%rsp
+  803c76:	6a 00                	push   $0x0
+  803c78:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803c7e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803c84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c89:	be 00 00 00 00       	mov    $0x0,%esi
+  803c8e:	bf 11 00 00 00       	mov    $0x11,%edi
+  803c93:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803c9a:	ff ff ff 
+  803c9d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803ca1:	ff d0                	call   *%rax
+  803ca3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803ca7:	c9                   	leave
+  803ca8:	c3                   	ret
+
+0000000000803ca9 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  803ca9:	55                   	push   %rbp
+  803caa:	48 89 e5             	mov    %rsp,%rbp
+  803cad:	48 83 ec 10          	sub    $0x10,%rsp
+  803cb1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cb1 <sys_page_alloc_huge+0x8>
+  803cb8:	49 bb 97 83 00 00 00 	movabs $0x8397,%r11
+  803cbf:	00 00 00 
+  803cc2:	4c 01 d8             	add    %r11,%rax
+  803cc5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803cc8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803ccc:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  803ccf:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803cd2:	48 63 f2             	movslq %edx,%rsi
+  803cd5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803cd9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803cdc:	48 63 d2             	movslq %edx,%rdx
+  803cdf:	48 83 ec 08          	sub    $0x8,%rsp
+  803ce3:	6a 00                	push   $0x0
+  803ce5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803ceb:	49 89 f0             	mov    %rsi,%r8
+  803cee:	be 01 00 00 00       	mov    $0x1,%esi
+  803cf3:	bf 12 00 00 00       	mov    $0x12,%edi
+  803cf8:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803cff:	ff ff ff 
+  803d02:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803d06:	ff d0                	call   *%rax
+  803d08:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803d0c:	c9                   	leave
+  803d0d:	c3                   	ret
+
+0000000000803d0e <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  803d0e:	55                   	push   %rbp
+  803d0f:	48 89 e5             	mov    %rsp,%rbp
+  803d12:	48 83 ec 10          	sub    $0x10,%rsp
+  803d16:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d16 <sys_page_map_batch+0x8>
+  803d1d:	49 bb 32 83 00 00 00 	movabs $0x8332,%r11
+  803d24:	00 00 00 
+  803d27:	4c 01 d8             	add    %r11,%rax
+  803d2a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d2e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  803d32:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d36:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803d3a:	48 83 ec 08          	sub    $0x8,%rsp
+  803d3e:	6a 00                	push   $0x0
+  803d40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803d46:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803d4c:	be 01 00 00 00       	mov    $0x1,%esi
+  803d51:	bf 13 00 00 00       	mov    $0x13,%edi
+  803d56:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803d5d:	ff ff ff 
+  803d60:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803d64:	ff d0                	call   *%rax
+  803d66:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803d6a:	c9                   	leave
+  803d6b:	c3                   	ret
+
+0000000000803d6c <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  803d6c:	55                   	push   %rbp
+  803d6d:	48 89 e5             	mov    %rsp,%rbp
+  803d70:	48 83 ec 10          	sub    $0x10,%rsp
+  803d74:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d74 <sys_page_alloc_batch+0x8>
+  803d7b:	49 bb d4 82 00 00 00 	movabs $0x82d4,%r11
+  803d82:	00 00 00 
+  803d85:	4c 01 d8             	add    %r11,%rax
+  803d88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d8c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  803d90:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d94:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803d98:	48 83 ec 08          	sub    $0x8,%rsp
+  803d9c:	6a 00                	push   $0x0
+  803d9e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803da4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803daa:	be 01 00 00 00       	mov    $0x1,%esi
+  803daf:	bf 14 00 00 00       	mov    $0x14,%edi
+  803db4:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803dbb:	ff ff ff 
+  803dbe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803dc2:	ff d0                	call   *%rax
+  803dc4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803dc8:	c9                   	leave
+  803dc9:	c3                   	ret
+
+0000000000803dca <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  803dca:	55                   	push   %rbp
+  803dcb:	48 89 e5             	mov    %rsp,%rbp
+  803dce:	48 83 ec 10          	sub    $0x10,%rsp
+  803dd2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803dd2 <sys_page_unmap_batch+0x8>
+  803dd9:	49 bb 76 82 00 00 00 	movabs $0x8276,%r11
+  803de0:	00 00 00 
+  803de3:	4c 01 d8             	add    %r11,%rax
+  803de6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803dea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  803dee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803df2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803df6:	48 83 ec 08          	sub    $0x8,%rsp
+  803dfa:	6a 00                	push   $0x0
+  803dfc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803e02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803e08:	be 01 00 00 00       	mov    $0x1,%esi
+  803e0d:	bf 15 00 00 00       	mov    $0x15,%edi
+  803e12:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803e19:	ff ff ff 
+  803e1c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803e20:	ff d0                	call   *%rax
+  803e22:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803e26:	c9                   	leave
+  803e27:	c3                   	ret
+
+0000000000803e28 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  803e28:	55                   	push   %rbp
+  803e29:	48 89 e5             	mov    %rsp,%rbp
+  803e2c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e2c <sys_fork+0x4>
+  803e33:	49 bb 1c 82 00 00 00 	movabs $0x821c,%r11
+  803e3a:	00 00 00 
+  803e3d:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  803e40:	48 83 ec 08          	sub    $0x8,%rsp
+  803e44:	6a 00                	push   $0x0
+  803e46:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803e4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803e52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803e57:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e5c:	be 00 00 00 00       	mov    $0x0,%esi
+  803e61:	bf 16 00 00 00       	mov    $0x16,%edi
+  803e66:	49 ba 6a 72 ff ff ff 	movabs $0xffffffffffff726a,%r10
+  803e6d:	ff ff ff 
+  803e70:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803e74:	ff d0                	call   *%rax
+  803e76:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803e7a:	c9                   	leave
+  803e7b:	c3                   	ret
+
+0000000000803e7c <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803e7c:	55                   	push   %rbp
+  803e7d:	48 89 e5             	mov    %rsp,%rbp
+  803e80:	41 57                	push   %r15
+  803e82:	53                   	push   %rbx
+  803e83:	48 83 ec 40          	sub    $0x40,%rsp
+  803e87:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e87 <pgfault+0xb>
+  803e8e:	49 bb c1 81 00 00 00 	movabs $0x81c1,%r11
+  803e95:	00 00 00 
+  803e98:	4c 01 db             	add    %r11,%rbx
+  803e9b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  803e9f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803ea3:	48 8b 00             	mov    (%rax),%rax
+  803ea6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  803eaa:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803eae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803eb2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  803eb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eb9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803ebd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ec1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803ec7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  803ecb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803ece:	83 e0 02             	and    $0x2,%eax
+  803ed1:	85 c0                	test   %eax,%eax
+  803ed3:	0f 84 91 03 00 00    	je     80426a <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  803ed9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803edd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ee1:	48 89 c2             	mov    %rax,%rdx
+  803ee4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803eeb:	ff ff ff 
+  803eee:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ef2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ef6:	83 e0 01             	and    $0x1,%eax
+  803ef9:	48 85 c0             	test   %rax,%rax
+  803efc:	0f 84 a7 01 00 00    	je     8040a9 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  803f02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f06:	48 c1 e8 15          	shr    $0x15,%rax
+  803f0a:	48 89 c2             	mov    %rax,%rdx
+  803f0d:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803f14:	ff ff ff 
+  803f17:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f1b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803f1f:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  803f24:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  803f2a:	0f 85 79 01 00 00    	jne    8040a9 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  803f30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f34:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  803f38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f3c:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  803f42:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  803f46:	ba 07 00 00 00       	mov    $0x7,%edx
+  803f4b:	be 00 00 60 00       	mov    $0x600000,%esi
+  803f50:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f55:	49 89 df             	mov    %rbx,%r15
+  803f58:	48 b8 61 7c ff ff ff 	movabs $0xffffffffffff7c61,%rax
+  803f5f:	ff ff ff 
+  803f62:	48 01 d8             	add    %rbx,%rax
+  803f65:	ff d0                	call   *%rax
+  803f67:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  803f6a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  803f6e:	79 44                	jns    803fb4 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  803f70:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803f73:	89 c1                	mov    %eax,%ecx
+  803f75:	48 b8 a0 df ff ff ff 	movabs $0xffffffffffffdfa0,%rax
+  803f7c:	ff ff ff 
+  803f7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f83:	48 89 c2             	mov    %rax,%rdx
+  803f86:	be 20 00 00 00       	mov    $0x20,%esi
+  803f8b:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  803f92:	ff ff ff 
+  803f95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f99:	48 89 c7             	mov    %rax,%rdi
+  803f9c:	49 89 df             	mov    %rbx,%r15
+  803f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa4:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  803fab:	ff ff ff 
+  803fae:	49 01 d8             	add    %rbx,%r8
+  803fb1:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  803fb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fb8:	ba 00 00 20 00       	mov    $0x200000,%edx
+  803fbd:	48 89 c6             	mov    %rax,%rsi
+  803fc0:	bf 00 00 60 00       	mov    $0x600000,%edi
+  803fc5:	49 89 df             	mov    %rbx,%r15
+  803fc8:	48 b8 da 6e ff ff ff 	movabs $0xffffffffffff6eda,%rax
+  803fcf:	ff ff ff 
+  803fd2:	48 01 d8             	add    %rbx,%rax
+  803fd5:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  803fd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fdb:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  803fe1:	48 89 c1             	mov    %rax,%rcx
+  803fe4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fe9:	be 00 00 60 00       	mov    $0x600000,%esi
+  803fee:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ff3:	49 89 df             	mov    %rbx,%r15
+  803ff6:	48 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rax
+  803ffd:	ff ff ff 
+  804000:	48 01 d8             	add    %rbx,%rax
+  804003:	ff d0                	call   *%rax
+  804005:	85 c0                	test   %eax,%eax
+  804007:	74 3e                	je     804047 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  804009:	48 b8 cb df ff ff ff 	movabs $0xffffffffffffdfcb,%rax
+  804010:	ff ff ff 
+  804013:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804017:	48 89 c2             	mov    %rax,%rdx
+  80401a:	be 23 00 00 00       	mov    $0x23,%esi
+  80401f:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  804026:	ff ff ff 
+  804029:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80402d:	48 89 c7             	mov    %rax,%rdi
+  804030:	49 89 df             	mov    %rbx,%r15
+  804033:	b8 00 00 00 00       	mov    $0x0,%eax
+  804038:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  80403f:	ff ff ff 
+  804042:	48 01 d9             	add    %rbx,%rcx
+  804045:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  804047:	be 00 00 60 00       	mov    $0x600000,%esi
+  80404c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804051:	49 89 df             	mov    %rbx,%r15
+  804054:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  80405b:	ff ff ff 
+  80405e:	48 01 d8             	add    %rbx,%rax
+  804061:	ff d0                	call   *%rax
+  804063:	85 c0                	test   %eax,%eax
+  804065:	0f 84 3d 02 00 00    	je     8042a8 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  80406b:	48 b8 e0 df ff ff ff 	movabs $0xffffffffffffdfe0,%rax
+  804072:	ff ff ff 
+  804075:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804079:	48 89 c2             	mov    %rax,%rdx
+  80407c:	be 25 00 00 00       	mov    $0x25,%esi
+  804081:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  804088:	ff ff ff 
+  80408b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80408f:	48 89 c7             	mov    %rax,%rdi
+  804092:	49 89 df             	mov    %rbx,%r15
+  804095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80409a:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  8040a1:	ff ff ff 
+  8040a4:	48 01 d9             	add    %rbx,%rcx
+  8040a7:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  8040a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040ad:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040b1:	48 89 c2             	mov    %rax,%rdx
+  8040b4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8040bb:	ff ff ff 
+  8040be:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8040c2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8040c6:	25 00 08 00 00       	and    $0x800,%eax
+  8040cb:	48 85 c0             	test   %rax,%rax
+  8040ce:	0f 84 58 01 00 00    	je     80422c <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  8040d4:	ba 07 00 00 00       	mov    $0x7,%edx
+  8040d9:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8040de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040e3:	49 89 df             	mov    %rbx,%r15
+  8040e6:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  8040ed:	ff ff ff 
+  8040f0:	48 01 d8             	add    %rbx,%rax
+  8040f3:	ff d0                	call   *%rax
+  8040f5:	85 c0                	test   %eax,%eax
+  8040f7:	74 3e                	je     804137 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  8040f9:	48 b8 f7 df ff ff ff 	movabs $0xffffffffffffdff7,%rax
+  804100:	ff ff ff 
+  804103:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804107:	48 89 c2             	mov    %rax,%rdx
+  80410a:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80410f:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  804116:	ff ff ff 
+  804119:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80411d:	48 89 c7             	mov    %rax,%rdi
+  804120:	49 89 df             	mov    %rbx,%r15
+  804123:	b8 00 00 00 00       	mov    $0x0,%eax
+  804128:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  80412f:	ff ff ff 
+  804132:	48 01 d9             	add    %rbx,%rcx
+  804135:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  804137:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80413b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804140:	48 89 c6             	mov    %rax,%rsi
+  804143:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  804148:	49 89 df             	mov    %rbx,%r15
+  80414b:	48 b8 da 6e ff ff ff 	movabs $0xffffffffffff6eda,%rax
+  804152:	ff ff ff 
+  804155:	48 01 d8             	add    %rbx,%rax
+  804158:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  80415a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80415e:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  804164:	48 89 c1             	mov    %rax,%rcx
+  804167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80416c:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  804171:	bf 00 00 00 00       	mov    $0x0,%edi
+  804176:	49 89 df             	mov    %rbx,%r15
+  804179:	48 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rax
+  804180:	ff ff ff 
+  804183:	48 01 d8             	add    %rbx,%rax
+  804186:	ff d0                	call   *%rax
+  804188:	85 c0                	test   %eax,%eax
+  80418a:	74 3e                	je     8041ca <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  80418c:	48 b8 cb df ff ff ff 	movabs $0xffffffffffffdfcb,%rax
+  804193:	ff ff ff 
+  804196:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80419a:	48 89 c2             	mov    %rax,%rdx
+  80419d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041a2:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  8041a9:	ff ff ff 
+  8041ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041b0:	48 89 c7             	mov    %rax,%rdi
+  8041b3:	49 89 df             	mov    %rbx,%r15
+  8041b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041bb:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  8041c2:	ff ff ff 
+  8041c5:	48 01 d9             	add    %rbx,%rcx
+  8041c8:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  8041ca:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8041cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041d4:	49 89 df             	mov    %rbx,%r15
+  8041d7:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  8041de:	ff ff ff 
+  8041e1:	48 01 d8             	add    %rbx,%rax
+  8041e4:	ff d0                	call   *%rax
+  8041e6:	85 c0                	test   %eax,%eax
+  8041e8:	0f 84 bb 00 00 00    	je     8042a9 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  8041ee:	48 b8 e0 df ff ff ff 	movabs $0xffffffffffffdfe0,%rax
+  8041f5:	ff ff ff 
+  8041f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041fc:	48 89 c2             	mov    %rax,%rdx
+  8041ff:	be 32 00 00 00       	mov    $0x32,%esi
+  804204:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  80420b:	ff ff ff 
+  80420e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804212:	48 89 c7             	mov    %rax,%rdi
+  804215:	49 89 df             	mov    %rbx,%r15
+  804218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421d:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  804224:	ff ff ff 
+  804227:	48 01 d9             	add    %rbx,%rcx
+  80422a:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  80422c:	48 b8 10 e0 ff ff ff 	movabs $0xffffffffffffe010,%rax
+  804233:	ff ff ff 
+  804236:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80423a:	48 89 c2             	mov    %rax,%rdx
+  80423d:	be 36 00 00 00       	mov    $0x36,%esi
+  804242:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  804249:	ff ff ff 
+  80424c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804250:	48 89 c7             	mov    %rax,%rdi
+  804253:	49 89 df             	mov    %rbx,%r15
+  804256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80425b:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  804262:	ff ff ff 
+  804265:	48 01 d9             	add    %rbx,%rcx
+  804268:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  80426a:	48 b8 2f e0 ff ff ff 	movabs $0xffffffffffffe02f,%rax
+  804271:	ff ff ff 
+  804274:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804278:	48 89 c2             	mov    %rax,%rdx
+  80427b:	be 3a 00 00 00       	mov    $0x3a,%esi
+  804280:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  804287:	ff ff ff 
+  80428a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80428e:	48 89 c7             	mov    %rax,%rdi
+  804291:	49 89 df             	mov    %rbx,%r15
+  804294:	b8 00 00 00 00       	mov    $0x0,%eax
+  804299:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  8042a0:	ff ff ff 
+  8042a3:	48 01 d9             	add    %rbx,%rcx
+  8042a6:	ff d1                	call   *%rcx
+			return;
+  8042a8:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  8042a9:	48 83 c4 40          	add    $0x40,%rsp
+  8042ad:	5b                   	pop    %rbx
+  8042ae:	41 5f                	pop    %r15
+  8042b0:	5d                   	pop    %rbp
+  8042b1:	c3                   	ret
+
+00000000008042b2 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  8042b2:	55                   	push   %rbp
+  8042b3:	48 89 e5             	mov    %rsp,%rbp
+  8042b6:	41 57                	push   %r15
+  8042b8:	53                   	push   %rbx
+  8042b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8042bd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042bd <fork_flush+0xb>
+  8042c4:	49 bb 8b 7d 00 00 00 	movabs $0x7d8b,%r11
+  8042cb:	00 00 00 
+  8042ce:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  8042d1:	48 b8 d8 23 00 00 00 	movabs $0x23d8,%rax
+  8042d8:	00 00 00 
+  8042db:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8042df:	48 85 c0             	test   %rax,%rax
+  8042e2:	0f 84 81 00 00 00    	je     804369 <fork_flush+0xb7>
+  8042e8:	48 b8 d8 23 00 00 00 	movabs $0x23d8,%rax
+  8042ef:	00 00 00 
+  8042f2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8042f6:	48 89 c6             	mov    %rax,%rsi
+  8042f9:	48 b8 d8 13 00 00 00 	movabs $0x13d8,%rax
+  804300:	00 00 00 
+  804303:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804307:	48 89 c7             	mov    %rax,%rdi
+  80430a:	49 89 df             	mov    %rbx,%r15
+  80430d:	48 b8 c6 7c ff ff ff 	movabs $0xffffffffffff7cc6,%rax
+  804314:	ff ff ff 
+  804317:	48 01 d8             	add    %rbx,%rax
+  80431a:	ff d0                	call   *%rax
+  80431c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80431f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804323:	79 44                	jns    804369 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  804325:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804328:	89 c1                	mov    %eax,%ecx
+  80432a:	48 b8 48 e0 ff ff ff 	movabs $0xffffffffffffe048,%rax
+  804331:	ff ff ff 
+  804334:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804338:	48 89 c2             	mov    %rax,%rdx
+  80433b:	be 56 00 00 00       	mov    $0x56,%esi
+  804340:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  804347:	ff ff ff 
+  80434a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80434e:	48 89 c7             	mov    %rax,%rdi
+  804351:	49 89 df             	mov    %rbx,%r15
+  804354:	b8 00 00 00 00       	mov    $0x0,%eax
+  804359:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  804360:	ff ff ff 
+  804363:	49 01 d8             	add    %rbx,%r8
+  804366:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  804369:	48 b8 d8 23 00 00 00 	movabs $0x23d8,%rax
+  804370:	00 00 00 
+  804373:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  80437a:	00 
+}
+  80437b:	90                   	nop
+  80437c:	48 83 c4 10          	add    $0x10,%rsp
+  804380:	5b                   	pop    %rbx
+  804381:	41 5f                	pop    %r15
+  804383:	5d                   	pop    %rbp
+  804384:	c3                   	ret
+
+0000000000804385 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  804385:	55                   	push   %rbp
+  804386:	48 89 e5             	mov    %rsp,%rbp
+  804389:	53                   	push   %rbx
+  80438a:	48 83 ec 28          	sub    $0x28,%rsp
+  80438e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80438e <fork_map+0x9>
+  804395:	49 bb ba 7c 00 00 00 	movabs $0x7cba,%r11
+  80439c:	00 00 00 
+  80439f:	4c 01 db             	add    %r11,%rbx
+  8043a2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8043a5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8043a9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  8043ac:	48 b8 d8 23 00 00 00 	movabs $0x23d8,%rax
+  8043b3:	00 00 00 
+  8043b6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8043ba:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  8043c0:	75 10                	jne    8043d2 <fork_map+0x4d>
+		fork_flush();
+  8043c2:	48 b8 6a 82 ff ff ff 	movabs $0xffffffffffff826a,%rax
+  8043c9:	ff ff ff 
+  8043cc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043d0:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  8043d2:	48 b8 d8 23 00 00 00 	movabs $0x23d8,%rax
+  8043d9:	00 00 00 
+  8043dc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8043e0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8043e4:	48 b9 d8 23 00 00 00 	movabs $0x23d8,%rcx
+  8043eb:	00 00 00 
+  8043ee:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  8043f2:	48 c1 e0 05          	shl    $0x5,%rax
+  8043f6:	48 89 c2             	mov    %rax,%rdx
+  8043f9:	48 b8 d8 13 00 00 00 	movabs $0x13d8,%rax
+  804400:	00 00 00 
+  804403:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804407:	48 01 d0             	add    %rdx,%rax
+  80440a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  80440e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804412:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  804418:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80441c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804420:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  804424:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804428:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80442b:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  80442e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804432:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804436:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  80443a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80443e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804441:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  804444:	90                   	nop
+  804445:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804449:	c9                   	leave
+  80444a:	c3                   	ret
+
+000000000080444b <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  80444b:	55                   	push   %rbp
+  80444c:	48 89 e5             	mov    %rsp,%rbp
+  80444f:	53                   	push   %rbx
+  804450:	48 83 ec 28          	sub    $0x28,%rsp
+  804454:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804454 <duppage+0x9>
+  80445b:	49 bb f4 7b 00 00 00 	movabs $0x7bf4,%r11
+  804462:	00 00 00 
+  804465:	4c 01 db             	add    %r11,%rbx
+  804468:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80446b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  80446e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804471:	48 c1 e0 0c          	shl    $0xc,%rax
+  804475:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  804479:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804480:	ff ff ff 
+  804483:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804487:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80448a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80448e:	25 00 04 00 00       	and    $0x400,%eax
+  804493:	48 85 c0             	test   %rax,%rax
+  804496:	74 42                	je     8044da <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  804498:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80449f:	ff ff ff 
+  8044a2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8044a6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8044a9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8044ad:	25 07 0e 00 00       	and    $0xe07,%eax
+  8044b2:	89 c2                	mov    %eax,%edx
+  8044b4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8044b8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044bb:	48 89 ce             	mov    %rcx,%rsi
+  8044be:	89 c7                	mov    %eax,%edi
+  8044c0:	48 b8 3d 83 ff ff ff 	movabs $0xffffffffffff833d,%rax
+  8044c7:	ff ff ff 
+  8044ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044ce:	ff d0                	call   *%rax
+		return 0;
+  8044d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d5:	e9 ae 00 00 00       	jmp    804588 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  8044da:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8044e1:	ff ff ff 
+  8044e4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8044e8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8044eb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8044ef:	83 e0 02             	and    $0x2,%eax
+  8044f2:	48 85 c0             	test   %rax,%rax
+  8044f5:	75 1f                	jne    804516 <duppage+0xcb>
+  8044f7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8044fe:	ff ff ff 
+  804501:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804505:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804508:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80450c:	25 00 08 00 00       	and    $0x800,%eax
+  804511:	48 85 c0             	test   %rax,%rax
+  804514:	74 4c                	je     804562 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  804516:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  80451d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804520:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804524:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804527:	48 89 ce             	mov    %rcx,%rsi
+  80452a:	89 c7                	mov    %eax,%edi
+  80452c:	48 b8 3d 83 ff ff ff 	movabs $0xffffffffffff833d,%rax
+  804533:	ff ff ff 
+  804536:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80453a:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  80453c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80453f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804543:	48 89 c6             	mov    %rax,%rsi
+  804546:	bf 00 00 00 00       	mov    $0x0,%edi
+  80454b:	48 b8 3d 83 ff ff ff 	movabs $0xffffffffffff833d,%rax
+  804552:	ff ff ff 
+  804555:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804559:	ff d0                	call   *%rax
+		return 0;
+  80455b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804560:	eb 26                	jmp    804588 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  804562:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804566:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804569:	ba 05 00 00 00       	mov    $0x5,%edx
+  80456e:	48 89 ce             	mov    %rcx,%rsi
+  804571:	89 c7                	mov    %eax,%edi
+  804573:	48 b8 3d 83 ff ff ff 	movabs $0xffffffffffff833d,%rax
+  80457a:	ff ff ff 
+  80457d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804581:	ff d0                	call   *%rax
+		return 0;
+  804583:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  804588:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80458c:	c9                   	leave
+  80458d:	c3                   	ret
+
+000000000080458e <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  80458e:	55                   	push   %rbp
+  80458f:	48 89 e5             	mov    %rsp,%rbp
+  804592:	53                   	push   %rbx
+  804593:	48 83 ec 28          	sub    $0x28,%rsp
+  804597:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804597 <duphuge+0x9>
+  80459e:	49 bb b1 7a 00 00 00 	movabs $0x7ab1,%r11
+  8045a5:	00 00 00 
+  8045a8:	4c 01 db             	add    %r11,%rbx
+  8045ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8045ae:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  8045b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045b6:	48 c1 e8 15          	shr    $0x15,%rax
+  8045ba:	48 89 c2             	mov    %rax,%rdx
+  8045bd:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8045c4:	ff ff ff 
+  8045c7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8045cb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8045cf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8045d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045d7:	25 00 04 00 00       	and    $0x400,%eax
+  8045dc:	48 85 c0             	test   %rax,%rax
+  8045df:	74 0e                	je     8045ef <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8045e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045e5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8045ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8045ed:	eb 1e                	jmp    80460d <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  8045ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045f3:	25 02 08 00 00       	and    $0x802,%eax
+  8045f8:	48 85 c0             	test   %rax,%rax
+  8045fb:	74 09                	je     804606 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  8045fd:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  804604:	eb 07                	jmp    80460d <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  804606:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  80460d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804610:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804614:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804617:	48 89 ce             	mov    %rcx,%rsi
+  80461a:	89 c7                	mov    %eax,%edi
+  80461c:	48 b8 3d 83 ff ff ff 	movabs $0xffffffffffff833d,%rax
+  804623:	ff ff ff 
+  804626:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80462a:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  80462c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80462f:	25 00 08 00 00       	and    $0x800,%eax
+  804634:	85 c0                	test   %eax,%eax
+  804636:	74 1f                	je     804657 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  804638:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80463b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80463f:	48 89 c6             	mov    %rax,%rsi
+  804642:	bf 00 00 00 00       	mov    $0x0,%edi
+  804647:	48 b8 3d 83 ff ff ff 	movabs $0xffffffffffff833d,%rax
+  80464e:	ff ff ff 
+  804651:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804655:	ff d0                	call   *%rax
+	return 0;
+  804657:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80465c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804660:	c9                   	leave
+  804661:	c3                   	ret
+
+0000000000804662 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  804662:	55                   	push   %rbp
+  804663:	48 89 e5             	mov    %rsp,%rbp
+  804666:	41 57                	push   %r15
+  804668:	53                   	push   %rbx
+  804669:	48 83 ec 10          	sub    $0x10,%rsp
+  80466d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80466d <fork+0xb>
+  804674:	49 bb db 79 00 00 00 	movabs $0x79db,%r11
+  80467b:	00 00 00 
+  80467e:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  804681:	49 89 df             	mov    %rbx,%r15
+  804684:	48 b8 e0 7d ff ff ff 	movabs $0xffffffffffff7de0,%rax
+  80468b:	ff ff ff 
+  80468e:	48 01 d8             	add    %rbx,%rax
+  804691:	ff d0                	call   *%rax
+  804693:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804696:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80469a:	75 42                	jne    8046de <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80469c:	49 89 df             	mov    %rbx,%r15
+  80469f:	48 b8 e2 75 ff ff ff 	movabs $0xffffffffffff75e2,%rax
+  8046a6:	ff ff ff 
+  8046a9:	48 01 d8             	add    %rbx,%rax
+  8046ac:	ff d0                	call   *%rax
+  8046ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8046b3:	48 98                	cltq
+  8046b5:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8046bc:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8046c3:	ff ff ff 
+  8046c6:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8046ca:	48 01 c2             	add    %rax,%rdx
+  8046cd:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8046d4:	ff ff ff 
+  8046d7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8046db:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8046de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8046e1:	48 83 c4 10          	add    $0x10,%rsp
+  8046e5:	5b                   	pop    %rbx
+  8046e6:	41 5f                	pop    %r15
+  8046e8:	5d                   	pop    %rbp
+  8046e9:	c3                   	ret
+
+00000000008046ea <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8046ea:	55                   	push   %rbp
+  8046eb:	48 89 e5             	mov    %rsp,%rbp
+  8046ee:	41 57                	push   %r15
+  8046f0:	53                   	push   %rbx
+  8046f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8046f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8046f5 <ufork+0xb>
+  8046fc:	49 bb 53 79 00 00 00 	movabs $0x7953,%r11
+  804703:	00 00 00 
+  804706:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  804709:	48 b8 34 7e ff ff ff 	movabs $0xffffffffffff7e34,%rax
+  804710:	ff ff ff 
+  804713:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804717:	48 89 c7             	mov    %rax,%rdi
+  80471a:	49 89 df             	mov    %rbx,%r15
+  80471d:	48 b8 e2 ce ff ff ff 	movabs $0xffffffffffffcee2,%rax
+  804724:	ff ff ff 
+  804727:	48 01 d8             	add    %rbx,%rax
+  80472a:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80472c:	b8 07 00 00 00       	mov    $0x7,%eax
+  804731:	cd 30                	int    $0x30
+  804733:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  804736:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  804739:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  80473c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804740:	0f 84 03 02 00 00    	je     804949 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  804746:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80474d:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  80474e:	e9 28 01 00 00       	jmp    80487b <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  804753:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804757:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80475b:	48 89 c2             	mov    %rax,%rdx
+  80475e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804765:	ff ff ff 
+  804768:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80476c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804770:	83 e0 01             	and    $0x1,%eax
+  804773:	48 85 c0             	test   %rax,%rax
+  804776:	0f 84 f7 00 00 00    	je     804873 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  80477c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804780:	48 c1 e8 15          	shr    $0x15,%rax
+  804784:	48 89 c2             	mov    %rax,%rdx
+  804787:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80478e:	ff ff ff 
+  804791:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804795:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804799:	25 81 00 00 00       	and    $0x81,%eax
+  80479e:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  8047a4:	75 29                	jne    8047cf <ufork+0xe5>
+					duphuge(child_envid, addr);
+  8047a6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8047aa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8047ad:	48 89 d6             	mov    %rdx,%rsi
+  8047b0:	89 c7                	mov    %eax,%edi
+  8047b2:	48 b8 46 85 ff ff ff 	movabs $0xffffffffffff8546,%rax
+  8047b9:	ff ff ff 
+  8047bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047c0:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  8047c2:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8047c9:	00 
+  8047ca:	e9 ac 00 00 00       	jmp    80487b <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8047cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047d3:	48 c1 e8 15          	shr    $0x15,%rax
+  8047d7:	48 89 c2             	mov    %rax,%rdx
+  8047da:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8047e1:	ff ff ff 
+  8047e4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8047e8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8047ec:	83 e0 01             	and    $0x1,%eax
+  8047ef:	48 85 c0             	test   %rax,%rax
+  8047f2:	74 75                	je     804869 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  8047f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047f8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8047fc:	48 89 c2             	mov    %rax,%rdx
+  8047ff:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804806:	ff ff ff 
+  804809:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80480d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804811:	83 e0 01             	and    $0x1,%eax
+  804814:	48 85 c0             	test   %rax,%rax
+  804817:	74 46                	je     80485f <ufork+0x175>
+  804819:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80481d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804821:	48 89 c2             	mov    %rax,%rdx
+  804824:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80482b:	ff ff ff 
+  80482e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804832:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804836:	83 e0 04             	and    $0x4,%eax
+  804839:	48 85 c0             	test   %rax,%rax
+  80483c:	74 21                	je     80485f <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  80483e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804842:	48 c1 e8 0c          	shr    $0xc,%rax
+  804846:	89 c2                	mov    %eax,%edx
+  804848:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80484b:	89 d6                	mov    %edx,%esi
+  80484d:	89 c7                	mov    %eax,%edi
+  80484f:	48 b8 03 84 ff ff ff 	movabs $0xffffffffffff8403,%rax
+  804856:	ff ff ff 
+  804859:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80485d:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  80485f:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  804866:	00 
+  804867:	eb 12                	jmp    80487b <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  804869:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  804870:	00 
+  804871:	eb 08                	jmp    80487b <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  804873:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  80487a:	40 
+		for (; addr < USTACKTOP;){
+  80487b:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  804880:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  804884:	0f 83 c9 fe ff ff    	jae    804753 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  80488a:	48 b8 6a 82 ff ff ff 	movabs $0xffffffffffff826a,%rax
+  804891:	ff ff ff 
+  804894:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804898:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  80489a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80489d:	ba 07 00 00 00       	mov    $0x7,%edx
+  8048a2:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8048a7:	48 89 ce             	mov    %rcx,%rsi
+  8048aa:	89 c7                	mov    %eax,%edi
+  8048ac:	49 89 df             	mov    %rbx,%r15
+  8048af:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  8048b6:	ff ff ff 
+  8048b9:	48 01 d8             	add    %rbx,%rax
+  8048bc:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8048be:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8048c1:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8048c8:	ff ff ff 
+  8048cb:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8048cf:	48 89 d6             	mov    %rdx,%rsi
+  8048d2:	89 c7                	mov    %eax,%edi
+  8048d4:	49 89 df             	mov    %rbx,%r15
+  8048d7:	48 b8 81 78 ff ff ff 	movabs $0xffffffffffff7881,%rax
+  8048de:	ff ff ff 
+  8048e1:	48 01 d8             	add    %rbx,%rax
+  8048e4:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8048e6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8048e9:	be 02 00 00 00       	mov    $0x2,%esi
+  8048ee:	89 c7                	mov    %eax,%edi
+  8048f0:	49 89 df             	mov    %rbx,%r15
+  8048f3:	48 b8 c2 77 ff ff ff 	movabs $0xffffffffffff77c2,%rax
+  8048fa:	ff ff ff 
+  8048fd:	48 01 d8             	add    %rbx,%rax
+  804900:	ff d0                	call   *%rax
+  804902:	85 c0                	test   %eax,%eax
+  804904:	74 3e                	je     804944 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  804906:	48 b8 6f e0 ff ff ff 	movabs $0xffffffffffffe06f,%rax
+  80490d:	ff ff ff 
+  804910:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804914:	48 89 c2             	mov    %rax,%rdx
+  804917:	be 07 01 00 00       	mov    $0x107,%esi
+  80491c:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  804923:	ff ff ff 
+  804926:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80492a:	48 89 c7             	mov    %rax,%rdi
+  80492d:	49 89 df             	mov    %rbx,%r15
+  804930:	b8 00 00 00 00       	mov    $0x0,%eax
+  804935:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  80493c:	ff ff ff 
+  80493f:	48 01 d9             	add    %rbx,%rcx
+  804942:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  804944:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804947:	eb 59                	jmp    8049a2 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  804949:	49 89 df             	mov    %rbx,%r15
+  80494c:	48 b8 e2 75 ff ff ff 	movabs $0xffffffffffff75e2,%rax
+  804953:	ff ff ff 
+  804956:	48 01 d8             	add    %rbx,%rax
+  804959:	ff d0                	call   *%rax
+  80495b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804960:	48 98                	cltq
+  804962:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  804969:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  804970:	ff ff ff 
+  804973:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  804977:	48 01 c2             	add    %rax,%rdx
+  80497a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804981:	ff ff ff 
+  804984:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804988:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  80498b:	48 b8 d8 23 00 00 00 	movabs $0x23d8,%rax
+  804992:	00 00 00 
+  804995:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  80499c:	00 
+		return 0;
+  80499d:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  8049a2:	48 83 c4 10          	add    $0x10,%rsp
+  8049a6:	5b                   	pop    %rbx
+  8049a7:	41 5f                	pop    %r15
+  8049a9:	5d                   	pop    %rbp
+  8049aa:	c3                   	ret
+
+00000000008049ab <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8049ab:	55                   	push   %rbp
+  8049ac:	48 89 e5             	mov    %rsp,%rbp
+  8049af:	41 57                	push   %r15
+  8049b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8049b5:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8049b5 <sfork+0xa>
+  8049bc:	49 bb 93 76 00 00 00 	movabs $0x7693,%r11
+  8049c3:	00 00 00 
+  8049c6:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8049c9:	48 b8 8a e0 ff ff ff 	movabs $0xffffffffffffe08a,%rax
+  8049d0:	ff ff ff 
+  8049d3:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8049d7:	48 89 c2             	mov    %rax,%rdx
+  8049da:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8049df:	48 b8 c0 df ff ff ff 	movabs $0xffffffffffffdfc0,%rax
+  8049e6:	ff ff ff 
+  8049e9:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8049ed:	48 89 c7             	mov    %rax,%rdi
+  8049f0:	49 89 cf             	mov    %rcx,%r15
+  8049f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f8:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  8049ff:	ff ff ff 
+  804a02:	49 01 c8             	add    %rcx,%r8
+  804a05:	41 ff d0             	call   *%r8
+
+0000000000804a08 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  804a08:	55                   	push   %rbp
+  804a09:	48 89 e5             	mov    %rsp,%rbp
+  804a0c:	48 83 ec 18          	sub    $0x18,%rsp
+  804a10:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a10 <argstart+0x8>
+  804a17:	49 bb 38 76 00 00 00 	movabs $0x7638,%r11
+  804a1e:	00 00 00 
+  804a21:	4c 01 d8             	add    %r11,%rax
+  804a24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804a28:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804a2c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	args->argc = argc;
+  804a30:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a34:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  804a38:	48 89 0a             	mov    %rcx,(%rdx)
+	args->argv = (const char **) argv;
+  804a3b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a3f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804a43:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+	args->curarg = (*argc > 1 && argv ? "" : 0);
+  804a47:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a4b:	8b 12                	mov    (%rdx),%edx
+  804a4d:	83 fa 01             	cmp    $0x1,%edx
+  804a50:	7e 17                	jle    804a69 <argstart+0x61>
+  804a52:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  804a57:	74 10                	je     804a69 <argstart+0x61>
+  804a59:	48 ba a0 e0 ff ff ff 	movabs $0xffffffffffffe0a0,%rdx
+  804a60:	ff ff ff 
+  804a63:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804a67:	eb 05                	jmp    804a6e <argstart+0x66>
+  804a69:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a6e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a72:	48 89 42 10          	mov    %rax,0x10(%rdx)
+	args->argvalue = 0;
+  804a76:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a7a:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  804a81:	00 
+}
+  804a82:	90                   	nop
+  804a83:	c9                   	leave
+  804a84:	c3                   	ret
+
+0000000000804a85 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  804a85:	55                   	push   %rbp
+  804a86:	48 89 e5             	mov    %rsp,%rbp
+  804a89:	41 57                	push   %r15
+  804a8b:	48 83 ec 28          	sub    $0x28,%rsp
+  804a8f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a8f <argnext+0xa>
+  804a96:	49 bb b9 75 00 00 00 	movabs $0x75b9,%r11
+  804a9d:	00 00 00 
+  804aa0:	4c 01 d8             	add    %r11,%rax
+  804aa3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int arg;
+
+	args->argvalue = 0;
+  804aa7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804aab:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  804ab2:	00 
+
+	// Done processing arguments if args->curarg == 0
+	if (args->curarg == 0)
+  804ab3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804ab7:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  804abb:	48 85 d2             	test   %rdx,%rdx
+  804abe:	75 0a                	jne    804aca <argnext+0x45>
+		return -1;
+  804ac0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804ac5:	e9 28 01 00 00       	jmp    804bf2 <argnext+0x16d>
+
+	if (!*args->curarg) {
+  804aca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804ace:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  804ad2:	0f b6 12             	movzbl (%rdx),%edx
+  804ad5:	84 d2                	test   %dl,%dl
+  804ad7:	0f 85 d6 00 00 00    	jne    804bb3 <argnext+0x12e>
+		// Need to process the next argument
+		// Check for end of argument list
+		if (*args->argc == 1
+  804add:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804ae1:	48 8b 12             	mov    (%rdx),%rdx
+  804ae4:	8b 12                	mov    (%rdx),%edx
+  804ae6:	83 fa 01             	cmp    $0x1,%edx
+  804ae9:	0f 84 ee 00 00 00    	je     804bdd <argnext+0x158>
+		    || args->argv[1][0] != '-'
+  804aef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804af3:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  804af7:	48 83 c2 08          	add    $0x8,%rdx
+  804afb:	48 8b 12             	mov    (%rdx),%rdx
+  804afe:	0f b6 12             	movzbl (%rdx),%edx
+  804b01:	80 fa 2d             	cmp    $0x2d,%dl
+  804b04:	0f 85 d3 00 00 00    	jne    804bdd <argnext+0x158>
+		    || args->argv[1][1] == '\0')
+  804b0a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804b0e:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  804b12:	48 83 c2 08          	add    $0x8,%rdx
+  804b16:	48 8b 12             	mov    (%rdx),%rdx
+  804b19:	48 83 c2 01          	add    $0x1,%rdx
+  804b1d:	0f b6 12             	movzbl (%rdx),%edx
+  804b20:	84 d2                	test   %dl,%dl
+  804b22:	0f 84 b5 00 00 00    	je     804bdd <argnext+0x158>
+			goto endofargs;
+		// Shift arguments down one
+		args->curarg = args->argv[1] + 1;
+  804b28:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804b2c:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  804b30:	48 83 c2 08          	add    $0x8,%rdx
+  804b34:	48 8b 12             	mov    (%rdx),%rdx
+  804b37:	48 8d 4a 01          	lea    0x1(%rdx),%rcx
+  804b3b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804b3f:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  804b43:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804b47:	48 8b 12             	mov    (%rdx),%rdx
+  804b4a:	8b 12                	mov    (%rdx),%edx
+  804b4c:	83 ea 01             	sub    $0x1,%edx
+  804b4f:	48 63 d2             	movslq %edx,%rdx
+  804b52:	48 c1 e2 03          	shl    $0x3,%rdx
+  804b56:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804b5a:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  804b5e:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  804b62:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804b66:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  804b6a:	48 83 c1 08          	add    $0x8,%rcx
+  804b6e:	48 89 cf             	mov    %rcx,%rdi
+  804b71:	49 89 c7             	mov    %rax,%r15
+  804b74:	48 b9 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rcx
+  804b7b:	ff ff ff 
+  804b7e:	48 01 c1             	add    %rax,%rcx
+  804b81:	ff d1                	call   *%rcx
+		(*args->argc)--;
+  804b83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b87:	48 8b 00             	mov    (%rax),%rax
+  804b8a:	8b 10                	mov    (%rax),%edx
+  804b8c:	83 ea 01             	sub    $0x1,%edx
+  804b8f:	89 10                	mov    %edx,(%rax)
+		// Check for "--": end of argument list
+		if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  804b91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b95:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804b99:	0f b6 00             	movzbl (%rax),%eax
+  804b9c:	3c 2d                	cmp    $0x2d,%al
+  804b9e:	75 13                	jne    804bb3 <argnext+0x12e>
+  804ba0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ba8:	48 83 c0 01          	add    $0x1,%rax
+  804bac:	0f b6 00             	movzbl (%rax),%eax
+  804baf:	84 c0                	test   %al,%al
+  804bb1:	74 2d                	je     804be0 <argnext+0x15b>
+			goto endofargs;
+	}
+
+	arg = (unsigned char) *args->curarg;
+  804bb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804bbb:	0f b6 00             	movzbl (%rax),%eax
+  804bbe:	0f b6 c0             	movzbl %al,%eax
+  804bc1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	args->curarg++;
+  804bc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804bcc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804bd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bd4:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	return arg;
+  804bd8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bdb:	eb 15                	jmp    804bf2 <argnext+0x16d>
+			goto endofargs;
+  804bdd:	90                   	nop
+  804bde:	eb 01                	jmp    804be1 <argnext+0x15c>
+			goto endofargs;
+  804be0:	90                   	nop
+
+endofargs:
+	args->curarg = 0;
+  804be1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804be5:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  804bec:	00 
+	return -1;
+  804bed:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+  804bf2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804bf6:	c9                   	leave
+  804bf7:	c3                   	ret
+
+0000000000804bf8 <argvalue>:
+
+char *
+argvalue(struct Argstate *args)
+{
+  804bf8:	55                   	push   %rbp
+  804bf9:	48 89 e5             	mov    %rsp,%rbp
+  804bfc:	48 83 ec 10          	sub    $0x10,%rsp
+  804c00:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c00 <argvalue+0x8>
+  804c07:	49 bb 48 74 00 00 00 	movabs $0x7448,%r11
+  804c0e:	00 00 00 
+  804c11:	4c 01 d8             	add    %r11,%rax
+  804c14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return (char*) (args->argvalue ? args->argvalue : argnextvalue(args));
+  804c18:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804c1c:	48 8b 52 18          	mov    0x18(%rdx),%rdx
+  804c20:	48 85 d2             	test   %rdx,%rdx
+  804c23:	74 0a                	je     804c2f <argvalue+0x37>
+  804c25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c29:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804c2d:	eb 17                	jmp    804c46 <argvalue+0x4e>
+  804c2f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804c33:	48 89 d7             	mov    %rdx,%rdi
+  804c36:	48 ba 00 8c ff ff ff 	movabs $0xffffffffffff8c00,%rdx
+  804c3d:	ff ff ff 
+  804c40:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804c44:	ff d0                	call   *%rax
+}
+  804c46:	c9                   	leave
+  804c47:	c3                   	ret
+
+0000000000804c48 <argnextvalue>:
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  804c48:	55                   	push   %rbp
+  804c49:	48 89 e5             	mov    %rsp,%rbp
+  804c4c:	41 57                	push   %r15
+  804c4e:	48 83 ec 18          	sub    $0x18,%rsp
+  804c52:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c52 <argnextvalue+0xa>
+  804c59:	49 bb f6 73 00 00 00 	movabs $0x73f6,%r11
+  804c60:	00 00 00 
+  804c63:	4c 01 d8             	add    %r11,%rax
+  804c66:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (!args->curarg)
+  804c6a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c6e:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  804c72:	48 85 d2             	test   %rdx,%rdx
+  804c75:	75 0a                	jne    804c81 <argnextvalue+0x39>
+		return 0;
+  804c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c7c:	e9 cc 00 00 00       	jmp    804d4d <argnextvalue+0x105>
+	if (*args->curarg) {
+  804c81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c85:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+  804c89:	0f b6 12             	movzbl (%rdx),%edx
+  804c8c:	84 d2                	test   %dl,%dl
+  804c8e:	74 2b                	je     804cbb <argnextvalue+0x73>
+		args->argvalue = args->curarg;
+  804c90:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c94:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804c98:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804c9c:	48 89 4a 18          	mov    %rcx,0x18(%rdx)
+		args->curarg = "";
+  804ca0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ca4:	48 b9 a0 e0 ff ff ff 	movabs $0xffffffffffffe0a0,%rcx
+  804cab:	ff ff ff 
+  804cae:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804cb2:	48 89 42 10          	mov    %rax,0x10(%rdx)
+  804cb6:	e9 8a 00 00 00       	jmp    804d45 <argnextvalue+0xfd>
+	} else if (*args->argc > 1) {
+  804cbb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804cbf:	48 8b 12             	mov    (%rdx),%rdx
+  804cc2:	8b 12                	mov    (%rdx),%edx
+  804cc4:	83 fa 01             	cmp    $0x1,%edx
+  804cc7:	7e 64                	jle    804d2d <argnextvalue+0xe5>
+		args->argvalue = args->argv[1];
+  804cc9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ccd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  804cd1:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  804cd5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804cd9:	48 89 4a 18          	mov    %rcx,0x18(%rdx)
+		memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  804cdd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ce1:	48 8b 12             	mov    (%rdx),%rdx
+  804ce4:	8b 12                	mov    (%rdx),%edx
+  804ce6:	83 ea 01             	sub    $0x1,%edx
+  804ce9:	48 63 d2             	movslq %edx,%rdx
+  804cec:	48 c1 e2 03          	shl    $0x3,%rdx
+  804cf0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804cf4:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  804cf8:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  804cfc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804d00:	48 8b 49 08          	mov    0x8(%rcx),%rcx
+  804d04:	48 83 c1 08          	add    $0x8,%rcx
+  804d08:	48 89 cf             	mov    %rcx,%rdi
+  804d0b:	49 89 c7             	mov    %rax,%r15
+  804d0e:	48 b9 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rcx
+  804d15:	ff ff ff 
+  804d18:	48 01 c1             	add    %rax,%rcx
+  804d1b:	ff d1                	call   *%rcx
+		(*args->argc)--;
+  804d1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d21:	48 8b 00             	mov    (%rax),%rax
+  804d24:	8b 10                	mov    (%rax),%edx
+  804d26:	83 ea 01             	sub    $0x1,%edx
+  804d29:	89 10                	mov    %edx,(%rax)
+  804d2b:	eb 18                	jmp    804d45 <argnextvalue+0xfd>
+	} else {
+		args->argvalue = 0;
+  804d2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d31:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+  804d38:	00 
+		args->curarg = 0;
+  804d39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d3d:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  804d44:	00 
+	}
+	return (char*) args->argvalue;
+  804d45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d49:	48 8b 40 18          	mov    0x18(%rax),%rax
+}
+  804d4d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804d51:	c9                   	leave
+  804d52:	c3                   	ret
+
+0000000000804d53 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  804d53:	55                   	push   %rbp
+  804d54:	48 89 e5             	mov    %rsp,%rbp
+  804d57:	48 83 ec 08          	sub    $0x8,%rsp
+  804d5b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d5b <fd2num+0x8>
+  804d62:	49 bb ed 72 00 00 00 	movabs $0x72ed,%r11
+  804d69:	00 00 00 
+  804d6c:	4c 01 d8             	add    %r11,%rax
+  804d6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  804d73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d77:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  804d7e:	ff ff ff 
+  804d81:	48 01 d0             	add    %rdx,%rax
+  804d84:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  804d88:	c9                   	leave
+  804d89:	c3                   	ret
+
+0000000000804d8a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  804d8a:	55                   	push   %rbp
+  804d8b:	48 89 e5             	mov    %rsp,%rbp
+  804d8e:	48 83 ec 08          	sub    $0x8,%rsp
+  804d92:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d92 <fd2data+0x8>
+  804d99:	49 bb b6 72 00 00 00 	movabs $0x72b6,%r11
+  804da0:	00 00 00 
+  804da3:	4c 01 d8             	add    %r11,%rax
+  804da6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  804daa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804dae:	48 89 d7             	mov    %rdx,%rdi
+  804db1:	48 ba 0b 8d ff ff ff 	movabs $0xffffffffffff8d0b,%rdx
+  804db8:	ff ff ff 
+  804dbb:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804dbf:	ff d0                	call   *%rax
+  804dc1:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  804dc7:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  804dcb:	c9                   	leave
+  804dcc:	c3                   	ret
+
+0000000000804dcd <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  804dcd:	55                   	push   %rbp
+  804dce:	48 89 e5             	mov    %rsp,%rbp
+  804dd1:	48 83 ec 18          	sub    $0x18,%rsp
+  804dd5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804dd5 <fd_alloc+0x8>
+  804ddc:	49 bb 73 72 00 00 00 	movabs $0x7273,%r11
+  804de3:	00 00 00 
+  804de6:	4c 01 d8             	add    %r11,%rax
+  804de9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  804ded:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804df4:	eb 75                	jmp    804e6b <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  804df6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804df9:	48 63 d2             	movslq %edx,%rdx
+  804dfc:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  804e03:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804e07:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  804e0b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804e0f:	48 89 d1             	mov    %rdx,%rcx
+  804e12:	48 c1 e9 15          	shr    $0x15,%rcx
+  804e16:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  804e1d:	ff ff ff 
+  804e20:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  804e24:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  804e28:	83 e2 01             	and    $0x1,%edx
+  804e2b:	48 85 d2             	test   %rdx,%rdx
+  804e2e:	74 25                	je     804e55 <fd_alloc+0x88>
+  804e30:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804e34:	48 89 d1             	mov    %rdx,%rcx
+  804e37:	48 c1 e9 0c          	shr    $0xc,%rcx
+  804e3b:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  804e42:	ff ff ff 
+  804e45:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  804e49:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  804e4d:	83 e2 01             	and    $0x1,%edx
+  804e50:	48 85 d2             	test   %rdx,%rdx
+  804e53:	75 12                	jne    804e67 <fd_alloc+0x9a>
+			*fd_store = fd;
+  804e55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e59:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804e5d:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  804e60:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e65:	eb 1a                	jmp    804e81 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  804e67:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804e6b:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  804e6f:	7e 85                	jle    804df6 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  804e71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e75:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  804e7c:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  804e81:	c9                   	leave
+  804e82:	c3                   	ret
+
+0000000000804e83 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  804e83:	55                   	push   %rbp
+  804e84:	48 89 e5             	mov    %rsp,%rbp
+  804e87:	48 83 ec 20          	sub    $0x20,%rsp
+  804e8b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804e8b <fd_lookup+0x8>
+  804e92:	49 bb bd 71 00 00 00 	movabs $0x71bd,%r11
+  804e99:	00 00 00 
+  804e9c:	4c 01 d8             	add    %r11,%rax
+  804e9f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804ea2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  804ea6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804eaa:	78 06                	js     804eb2 <fd_lookup+0x2f>
+  804eac:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  804eb0:	7e 07                	jle    804eb9 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  804eb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804eb7:	eb 73                	jmp    804f2c <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  804eb9:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804ebc:	48 63 d2             	movslq %edx,%rdx
+  804ebf:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  804ec6:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804eca:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  804ece:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ed2:	48 89 d1             	mov    %rdx,%rcx
+  804ed5:	48 c1 e9 15          	shr    $0x15,%rcx
+  804ed9:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  804ee0:	ff ff ff 
+  804ee3:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  804ee7:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  804eeb:	83 e2 01             	and    $0x1,%edx
+  804eee:	48 85 d2             	test   %rdx,%rdx
+  804ef1:	74 22                	je     804f15 <fd_lookup+0x92>
+  804ef3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ef7:	48 c1 ea 0c          	shr    $0xc,%rdx
+  804efb:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  804f02:	ff ff ff 
+  804f05:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  804f09:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f0d:	83 e0 01             	and    $0x1,%eax
+  804f10:	48 85 c0             	test   %rax,%rax
+  804f13:	75 07                	jne    804f1c <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  804f15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804f1a:	eb 10                	jmp    804f2c <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  804f1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f20:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f24:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  804f27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f2c:	c9                   	leave
+  804f2d:	c3                   	ret
+
+0000000000804f2e <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  804f2e:	55                   	push   %rbp
+  804f2f:	48 89 e5             	mov    %rsp,%rbp
+  804f32:	41 57                	push   %r15
+  804f34:	53                   	push   %rbx
+  804f35:	48 83 ec 30          	sub    $0x30,%rsp
+  804f39:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f39 <fd_close+0xb>
+  804f40:	49 bb 0f 71 00 00 00 	movabs $0x710f,%r11
+  804f47:	00 00 00 
+  804f4a:	4c 01 db             	add    %r11,%rbx
+  804f4d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804f51:	89 f0                	mov    %esi,%eax
+  804f53:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  804f56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f5a:	48 89 c7             	mov    %rax,%rdi
+  804f5d:	48 b8 0b 8d ff ff ff 	movabs $0xffffffffffff8d0b,%rax
+  804f64:	ff ff ff 
+  804f67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f6b:	ff d0                	call   *%rax
+  804f6d:	89 c2                	mov    %eax,%edx
+  804f6f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804f73:	48 89 c6             	mov    %rax,%rsi
+  804f76:	89 d7                	mov    %edx,%edi
+  804f78:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  804f7f:	ff ff ff 
+  804f82:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f86:	ff d0                	call   *%rax
+  804f88:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f8b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f8f:	78 0a                	js     804f9b <fd_close+0x6d>
+	    || fd != fd2)
+  804f91:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f95:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  804f99:	74 12                	je     804fad <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  804f9b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  804f9f:	74 05                	je     804fa6 <fd_close+0x78>
+  804fa1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fa4:	eb 7a                	jmp    805020 <fd_close+0xf2>
+  804fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fab:	eb 73                	jmp    805020 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  804fad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fb1:	8b 00                	mov    (%rax),%eax
+  804fb3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804fb7:	48 89 d6             	mov    %rdx,%rsi
+  804fba:	89 c7                	mov    %eax,%edi
+  804fbc:	48 b8 e1 8f ff ff ff 	movabs $0xffffffffffff8fe1,%rax
+  804fc3:	ff ff ff 
+  804fc6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fca:	ff d0                	call   *%rax
+  804fcc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fcf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fd3:	78 2a                	js     804fff <fd_close+0xd1>
+		if (dev->dev_close)
+  804fd5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fd9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  804fdd:	48 85 c0             	test   %rax,%rax
+  804fe0:	74 16                	je     804ff8 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  804fe2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fe6:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  804fea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fee:	48 89 c7             	mov    %rax,%rdi
+  804ff1:	ff d2                	call   *%rdx
+  804ff3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ff6:	eb 07                	jmp    804fff <fd_close+0xd1>
+		else
+			r = 0;
+  804ff8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  804fff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805003:	48 89 c6             	mov    %rax,%rsi
+  805006:	bf 00 00 00 00       	mov    $0x0,%edi
+  80500b:	49 89 df             	mov    %rbx,%r15
+  80500e:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  805015:	ff ff ff 
+  805018:	48 01 d8             	add    %rbx,%rax
+  80501b:	ff d0                	call   *%rax
+	return r;
+  80501d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805020:	48 83 c4 30          	add    $0x30,%rsp
+  805024:	5b                   	pop    %rbx
+  805025:	41 5f                	pop    %r15
+  805027:	5d                   	pop    %rbp
+  805028:	c3                   	ret
+
+0000000000805029 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  805029:	55                   	push   %rbp
+  80502a:	48 89 e5             	mov    %rsp,%rbp
+  80502d:	41 57                	push   %r15
+  80502f:	48 83 ec 28          	sub    $0x28,%rsp
+  805033:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 805033 <dev_lookup+0xa>
+  80503a:	49 bb 15 70 00 00 00 	movabs $0x7015,%r11
+  805041:	00 00 00 
+  805044:	4c 01 d9             	add    %r11,%rcx
+  805047:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80504a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80504e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805055:	eb 45                	jmp    80509c <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  805057:	48 ba f8 01 00 00 00 	movabs $0x1f8,%rdx
+  80505e:	00 00 00 
+  805061:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805064:	48 98                	cltq
+  805066:	48 01 ca             	add    %rcx,%rdx
+  805069:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80506d:	8b 00                	mov    (%rax),%eax
+  80506f:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  805072:	75 24                	jne    805098 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  805074:	48 ba f8 01 00 00 00 	movabs $0x1f8,%rdx
+  80507b:	00 00 00 
+  80507e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805081:	48 98                	cltq
+  805083:	48 01 ca             	add    %rcx,%rdx
+  805086:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80508a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80508e:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  805091:	b8 00 00 00 00       	mov    $0x0,%eax
+  805096:	eb 74                	jmp    80510c <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  805098:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80509c:	48 ba f8 01 00 00 00 	movabs $0x1f8,%rdx
+  8050a3:	00 00 00 
+  8050a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050a9:	48 98                	cltq
+  8050ab:	48 01 ca             	add    %rcx,%rdx
+  8050ae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8050b2:	48 85 c0             	test   %rax,%rax
+  8050b5:	75 a0                	jne    805057 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8050b7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8050be:	ff ff ff 
+  8050c1:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8050c5:	48 8b 00             	mov    (%rax),%rax
+  8050c8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8050ce:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8050d1:	89 c6                	mov    %eax,%esi
+  8050d3:	48 b8 a8 e0 ff ff ff 	movabs $0xffffffffffffe0a8,%rax
+  8050da:	ff ff ff 
+  8050dd:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8050e1:	48 89 c7             	mov    %rax,%rdi
+  8050e4:	49 89 cf             	mov    %rcx,%r15
+  8050e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050ec:	49 b8 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%r8
+  8050f3:	ff ff ff 
+  8050f6:	49 01 c8             	add    %rcx,%r8
+  8050f9:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8050fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805100:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  805107:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80510c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805110:	c9                   	leave
+  805111:	c3                   	ret
+
+0000000000805112 <close>:
+
+int
+close(int fdnum)
+{
+  805112:	55                   	push   %rbp
+  805113:	48 89 e5             	mov    %rsp,%rbp
+  805116:	53                   	push   %rbx
+  805117:	48 83 ec 28          	sub    $0x28,%rsp
+  80511b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80511b <close+0x9>
+  805122:	49 bb 2d 6f 00 00 00 	movabs $0x6f2d,%r11
+  805129:	00 00 00 
+  80512c:	4c 01 db             	add    %r11,%rbx
+  80512f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805132:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805136:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805139:	48 89 d6             	mov    %rdx,%rsi
+  80513c:	89 c7                	mov    %eax,%edi
+  80513e:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  805145:	ff ff ff 
+  805148:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80514c:	ff d0                	call   *%rax
+  80514e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805151:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805155:	79 05                	jns    80515c <close+0x4a>
+		return r;
+  805157:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80515a:	eb 1c                	jmp    805178 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  80515c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805160:	be 01 00 00 00       	mov    $0x1,%esi
+  805165:	48 89 c7             	mov    %rax,%rdi
+  805168:	48 b8 e6 8e ff ff ff 	movabs $0xffffffffffff8ee6,%rax
+  80516f:	ff ff ff 
+  805172:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805176:	ff d0                	call   *%rax
+}
+  805178:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80517c:	c9                   	leave
+  80517d:	c3                   	ret
+
+000000000080517e <close_all>:
+
+void
+close_all(void)
+{
+  80517e:	55                   	push   %rbp
+  80517f:	48 89 e5             	mov    %rsp,%rbp
+  805182:	53                   	push   %rbx
+  805183:	48 83 ec 18          	sub    $0x18,%rsp
+  805187:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805187 <close_all+0x9>
+  80518e:	49 bb c1 6e 00 00 00 	movabs $0x6ec1,%r11
+  805195:	00 00 00 
+  805198:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80519b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8051a2:	eb 19                	jmp    8051bd <close_all+0x3f>
+		close(i);
+  8051a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051a7:	89 c7                	mov    %eax,%edi
+  8051a9:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  8051b0:	ff ff ff 
+  8051b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051b7:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8051b9:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8051bd:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8051c1:	7e e1                	jle    8051a4 <close_all+0x26>
+}
+  8051c3:	90                   	nop
+  8051c4:	90                   	nop
+  8051c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8051c9:	c9                   	leave
+  8051ca:	c3                   	ret
+
+00000000008051cb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8051cb:	55                   	push   %rbp
+  8051cc:	48 89 e5             	mov    %rsp,%rbp
+  8051cf:	41 57                	push   %r15
+  8051d1:	53                   	push   %rbx
+  8051d2:	48 83 ec 40          	sub    $0x40,%rsp
+  8051d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051d6 <dup+0xb>
+  8051dd:	49 bb 72 6e 00 00 00 	movabs $0x6e72,%r11
+  8051e4:	00 00 00 
+  8051e7:	4c 01 db             	add    %r11,%rbx
+  8051ea:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8051ed:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8051f0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8051f4:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8051f7:	48 89 d6             	mov    %rdx,%rsi
+  8051fa:	89 c7                	mov    %eax,%edi
+  8051fc:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  805203:	ff ff ff 
+  805206:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80520a:	ff d0                	call   *%rax
+  80520c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80520f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805213:	79 08                	jns    80521d <dup+0x52>
+		return r;
+  805215:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805218:	e9 a4 01 00 00       	jmp    8053c1 <dup+0x1f6>
+	close(newfdnum);
+  80521d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805220:	89 c7                	mov    %eax,%edi
+  805222:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  805229:	ff ff ff 
+  80522c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805230:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  805232:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805235:	48 98                	cltq
+  805237:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  80523d:	48 c1 e0 0c          	shl    $0xc,%rax
+  805241:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  805245:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805249:	48 89 c7             	mov    %rax,%rdi
+  80524c:	48 b8 42 8d ff ff ff 	movabs $0xffffffffffff8d42,%rax
+  805253:	ff ff ff 
+  805256:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80525a:	ff d0                	call   *%rax
+  80525c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  805260:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805264:	48 89 c7             	mov    %rax,%rdi
+  805267:	48 b8 42 8d ff ff ff 	movabs $0xffffffffffff8d42,%rax
+  80526e:	ff ff ff 
+  805271:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805275:	ff d0                	call   *%rax
+  805277:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80527b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80527f:	48 c1 e8 15          	shr    $0x15,%rax
+  805283:	48 89 c2             	mov    %rax,%rdx
+  805286:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80528d:	ff ff ff 
+  805290:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805294:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805298:	83 e0 01             	and    $0x1,%eax
+  80529b:	48 85 c0             	test   %rax,%rax
+  80529e:	74 7f                	je     80531f <dup+0x154>
+  8052a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052a4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8052a8:	48 89 c2             	mov    %rax,%rdx
+  8052ab:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8052b2:	ff ff ff 
+  8052b5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8052b9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8052bd:	83 e0 01             	and    $0x1,%eax
+  8052c0:	48 85 c0             	test   %rax,%rax
+  8052c3:	74 5a                	je     80531f <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8052c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052c9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8052cd:	48 89 c2             	mov    %rax,%rdx
+  8052d0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8052d7:	ff ff ff 
+  8052da:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8052de:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8052e2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8052e7:	89 c1                	mov    %eax,%ecx
+  8052e9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8052ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052f1:	41 89 c8             	mov    %ecx,%r8d
+  8052f4:	48 89 d1             	mov    %rdx,%rcx
+  8052f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052fc:	48 89 c6             	mov    %rax,%rsi
+  8052ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805304:	49 89 df             	mov    %rbx,%r15
+  805307:	48 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rax
+  80530e:	ff ff ff 
+  805311:	48 01 d8             	add    %rbx,%rax
+  805314:	ff d0                	call   *%rax
+  805316:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805319:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80531d:	78 5f                	js     80537e <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80531f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805323:	48 c1 e8 0c          	shr    $0xc,%rax
+  805327:	48 89 c2             	mov    %rax,%rdx
+  80532a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805331:	ff ff ff 
+  805334:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805338:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80533c:	25 07 0e 00 00       	and    $0xe07,%eax
+  805341:	89 c1                	mov    %eax,%ecx
+  805343:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805347:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80534b:	41 89 c8             	mov    %ecx,%r8d
+  80534e:	48 89 d1             	mov    %rdx,%rcx
+  805351:	ba 00 00 00 00       	mov    $0x0,%edx
+  805356:	48 89 c6             	mov    %rax,%rsi
+  805359:	bf 00 00 00 00       	mov    $0x0,%edi
+  80535e:	49 89 df             	mov    %rbx,%r15
+  805361:	48 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rax
+  805368:	ff ff ff 
+  80536b:	48 01 d8             	add    %rbx,%rax
+  80536e:	ff d0                	call   *%rax
+  805370:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805373:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805377:	78 08                	js     805381 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  805379:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80537c:	eb 43                	jmp    8053c1 <dup+0x1f6>
+			goto err;
+  80537e:	90                   	nop
+  80537f:	eb 01                	jmp    805382 <dup+0x1b7>
+		goto err;
+  805381:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  805382:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805386:	48 89 c6             	mov    %rax,%rsi
+  805389:	bf 00 00 00 00       	mov    $0x0,%edi
+  80538e:	49 89 df             	mov    %rbx,%r15
+  805391:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  805398:	ff ff ff 
+  80539b:	48 01 d8             	add    %rbx,%rax
+  80539e:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8053a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8053a4:	48 89 c6             	mov    %rax,%rsi
+  8053a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053ac:	49 89 df             	mov    %rbx,%r15
+  8053af:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  8053b6:	ff ff ff 
+  8053b9:	48 01 d8             	add    %rbx,%rax
+  8053bc:	ff d0                	call   *%rax
+	return r;
+  8053be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8053c1:	48 83 c4 40          	add    $0x40,%rsp
+  8053c5:	5b                   	pop    %rbx
+  8053c6:	41 5f                	pop    %r15
+  8053c8:	5d                   	pop    %rbp
+  8053c9:	c3                   	ret
+
+00000000008053ca <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8053ca:	55                   	push   %rbp
+  8053cb:	48 89 e5             	mov    %rsp,%rbp
+  8053ce:	41 57                	push   %r15
+  8053d0:	53                   	push   %rbx
+  8053d1:	48 83 ec 40          	sub    $0x40,%rsp
+  8053d5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053d5 <read+0xb>
+  8053dc:	49 bb 73 6c 00 00 00 	movabs $0x6c73,%r11
+  8053e3:	00 00 00 
+  8053e6:	4c 01 db             	add    %r11,%rbx
+  8053e9:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8053ec:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8053f0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8053f4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8053f8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8053fb:	48 89 d6             	mov    %rdx,%rsi
+  8053fe:	89 c7                	mov    %eax,%edi
+  805400:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  805407:	ff ff ff 
+  80540a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80540e:	ff d0                	call   *%rax
+  805410:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805413:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805417:	78 28                	js     805441 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  805419:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80541d:	8b 00                	mov    (%rax),%eax
+  80541f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805423:	48 89 d6             	mov    %rdx,%rsi
+  805426:	89 c7                	mov    %eax,%edi
+  805428:	48 b8 e1 8f ff ff ff 	movabs $0xffffffffffff8fe1,%rax
+  80542f:	ff ff ff 
+  805432:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805436:	ff d0                	call   *%rax
+  805438:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80543b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80543f:	79 08                	jns    805449 <read+0x7f>
+		return r;
+  805441:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805444:	e9 8b 00 00 00       	jmp    8054d4 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  805449:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80544d:	8b 40 08             	mov    0x8(%rax),%eax
+  805450:	83 e0 03             	and    $0x3,%eax
+  805453:	83 f8 01             	cmp    $0x1,%eax
+  805456:	75 4b                	jne    8054a3 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  805458:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80545f:	ff ff ff 
+  805462:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805466:	48 8b 00             	mov    (%rax),%rax
+  805469:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80546f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  805472:	89 c6                	mov    %eax,%esi
+  805474:	48 b8 c7 e0 ff ff ff 	movabs $0xffffffffffffe0c7,%rax
+  80547b:	ff ff ff 
+  80547e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805482:	48 89 c7             	mov    %rax,%rdi
+  805485:	49 89 df             	mov    %rbx,%r15
+  805488:	b8 00 00 00 00       	mov    $0x0,%eax
+  80548d:	48 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rcx
+  805494:	ff ff ff 
+  805497:	48 01 d9             	add    %rbx,%rcx
+  80549a:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80549c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8054a1:	eb 31                	jmp    8054d4 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8054a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054a7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8054ab:	48 85 c0             	test   %rax,%rax
+  8054ae:	75 07                	jne    8054b7 <read+0xed>
+		return -E_NOT_SUPP;
+  8054b0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8054b5:	eb 1d                	jmp    8054d4 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8054b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054bb:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8054bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054c3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8054c7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8054cb:	48 89 ce             	mov    %rcx,%rsi
+  8054ce:	48 89 c7             	mov    %rax,%rdi
+  8054d1:	41 ff d0             	call   *%r8
+}
+  8054d4:	48 83 c4 40          	add    $0x40,%rsp
+  8054d8:	5b                   	pop    %rbx
+  8054d9:	41 5f                	pop    %r15
+  8054db:	5d                   	pop    %rbp
+  8054dc:	c3                   	ret
+
+00000000008054dd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8054dd:	55                   	push   %rbp
+  8054de:	48 89 e5             	mov    %rsp,%rbp
+  8054e1:	53                   	push   %rbx
+  8054e2:	48 83 ec 38          	sub    $0x38,%rsp
+  8054e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054e6 <readn+0x9>
+  8054ed:	49 bb 62 6b 00 00 00 	movabs $0x6b62,%r11
+  8054f4:	00 00 00 
+  8054f7:	4c 01 db             	add    %r11,%rbx
+  8054fa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8054fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805501:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  805505:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80550c:	eb 4b                	jmp    805559 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80550e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805511:	48 98                	cltq
+  805513:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805517:	48 29 c2             	sub    %rax,%rdx
+  80551a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80551d:	48 63 c8             	movslq %eax,%rcx
+  805520:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805524:	48 01 c1             	add    %rax,%rcx
+  805527:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80552a:	48 89 ce             	mov    %rcx,%rsi
+  80552d:	89 c7                	mov    %eax,%edi
+  80552f:	48 b8 82 93 ff ff ff 	movabs $0xffffffffffff9382,%rax
+  805536:	ff ff ff 
+  805539:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80553d:	ff d0                	call   *%rax
+  80553f:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  805542:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  805546:	79 05                	jns    80554d <readn+0x70>
+			return m;
+  805548:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80554b:	eb 1d                	jmp    80556a <readn+0x8d>
+		if (m == 0)
+  80554d:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  805551:	74 13                	je     805566 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  805553:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805556:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805559:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80555c:	48 98                	cltq
+  80555e:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  805562:	72 aa                	jb     80550e <readn+0x31>
+  805564:	eb 01                	jmp    805567 <readn+0x8a>
+			break;
+  805566:	90                   	nop
+	}
+	return tot;
+  805567:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80556a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80556e:	c9                   	leave
+  80556f:	c3                   	ret
+
+0000000000805570 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  805570:	55                   	push   %rbp
+  805571:	48 89 e5             	mov    %rsp,%rbp
+  805574:	41 57                	push   %r15
+  805576:	53                   	push   %rbx
+  805577:	48 83 ec 40          	sub    $0x40,%rsp
+  80557b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80557b <write+0xb>
+  805582:	49 bb cd 6a 00 00 00 	movabs $0x6acd,%r11
+  805589:	00 00 00 
+  80558c:	4c 01 db             	add    %r11,%rbx
+  80558f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805592:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805596:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80559a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80559e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8055a1:	48 89 d6             	mov    %rdx,%rsi
+  8055a4:	89 c7                	mov    %eax,%edi
+  8055a6:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  8055ad:	ff ff ff 
+  8055b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055b4:	ff d0                	call   *%rax
+  8055b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055bd:	78 28                	js     8055e7 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8055bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8055c3:	8b 00                	mov    (%rax),%eax
+  8055c5:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8055c9:	48 89 d6             	mov    %rdx,%rsi
+  8055cc:	89 c7                	mov    %eax,%edi
+  8055ce:	48 b8 e1 8f ff ff ff 	movabs $0xffffffffffff8fe1,%rax
+  8055d5:	ff ff ff 
+  8055d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055dc:	ff d0                	call   *%rax
+  8055de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055e1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055e5:	79 08                	jns    8055ef <write+0x7f>
+		return r;
+  8055e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055ea:	e9 8a 00 00 00       	jmp    805679 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8055ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8055f3:	8b 40 08             	mov    0x8(%rax),%eax
+  8055f6:	83 e0 03             	and    $0x3,%eax
+  8055f9:	85 c0                	test   %eax,%eax
+  8055fb:	75 4b                	jne    805648 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8055fd:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805604:	ff ff ff 
+  805607:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80560b:	48 8b 00             	mov    (%rax),%rax
+  80560e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805614:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  805617:	89 c6                	mov    %eax,%esi
+  805619:	48 b8 e3 e0 ff ff ff 	movabs $0xffffffffffffe0e3,%rax
+  805620:	ff ff ff 
+  805623:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805627:	48 89 c7             	mov    %rax,%rdi
+  80562a:	49 89 df             	mov    %rbx,%r15
+  80562d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805632:	48 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rcx
+  805639:	ff ff ff 
+  80563c:	48 01 d9             	add    %rbx,%rcx
+  80563f:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  805641:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805646:	eb 31                	jmp    805679 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  805648:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80564c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  805650:	48 85 c0             	test   %rax,%rax
+  805653:	75 07                	jne    80565c <write+0xec>
+		return -E_NOT_SUPP;
+  805655:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80565a:	eb 1d                	jmp    805679 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  80565c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805660:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  805664:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805668:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80566c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  805670:	48 89 ce             	mov    %rcx,%rsi
+  805673:	48 89 c7             	mov    %rax,%rdi
+  805676:	41 ff d0             	call   *%r8
+}
+  805679:	48 83 c4 40          	add    $0x40,%rsp
+  80567d:	5b                   	pop    %rbx
+  80567e:	41 5f                	pop    %r15
+  805680:	5d                   	pop    %rbp
+  805681:	c3                   	ret
+
+0000000000805682 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  805682:	55                   	push   %rbp
+  805683:	48 89 e5             	mov    %rsp,%rbp
+  805686:	48 83 ec 18          	sub    $0x18,%rsp
+  80568a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80568a <seek+0x8>
+  805691:	49 bb be 69 00 00 00 	movabs $0x69be,%r11
+  805698:	00 00 00 
+  80569b:	4c 01 d8             	add    %r11,%rax
+  80569e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8056a1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8056a4:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8056a8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8056ab:	48 89 ce             	mov    %rcx,%rsi
+  8056ae:	89 d7                	mov    %edx,%edi
+  8056b0:	48 ba 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rdx
+  8056b7:	ff ff ff 
+  8056ba:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8056be:	ff d0                	call   *%rax
+  8056c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8056c3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056c7:	79 05                	jns    8056ce <seek+0x4c>
+		return r;
+  8056c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056cc:	eb 0f                	jmp    8056dd <seek+0x5b>
+	fd->fd_offset = offset;
+  8056ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056d2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8056d5:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8056d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056dd:	c9                   	leave
+  8056de:	c3                   	ret
+
+00000000008056df <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8056df:	55                   	push   %rbp
+  8056e0:	48 89 e5             	mov    %rsp,%rbp
+  8056e3:	41 57                	push   %r15
+  8056e5:	53                   	push   %rbx
+  8056e6:	48 83 ec 30          	sub    $0x30,%rsp
+  8056ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056ea <ftruncate+0xb>
+  8056f1:	49 bb 5e 69 00 00 00 	movabs $0x695e,%r11
+  8056f8:	00 00 00 
+  8056fb:	4c 01 db             	add    %r11,%rbx
+  8056fe:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805701:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  805704:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805708:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80570b:	48 89 d6             	mov    %rdx,%rsi
+  80570e:	89 c7                	mov    %eax,%edi
+  805710:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  805717:	ff ff ff 
+  80571a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80571e:	ff d0                	call   *%rax
+  805720:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805723:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805727:	78 28                	js     805751 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  805729:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80572d:	8b 00                	mov    (%rax),%eax
+  80572f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805733:	48 89 d6             	mov    %rdx,%rsi
+  805736:	89 c7                	mov    %eax,%edi
+  805738:	48 b8 e1 8f ff ff ff 	movabs $0xffffffffffff8fe1,%rax
+  80573f:	ff ff ff 
+  805742:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805746:	ff d0                	call   *%rax
+  805748:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80574b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80574f:	79 08                	jns    805759 <ftruncate+0x7a>
+		return r;
+  805751:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805754:	e9 83 00 00 00       	jmp    8057dc <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  805759:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80575d:	8b 40 08             	mov    0x8(%rax),%eax
+  805760:	83 e0 03             	and    $0x3,%eax
+  805763:	85 c0                	test   %eax,%eax
+  805765:	75 4b                	jne    8057b2 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  805767:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80576e:	ff ff ff 
+  805771:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805775:	48 8b 00             	mov    (%rax),%rax
+  805778:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80577e:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  805781:	89 c6                	mov    %eax,%esi
+  805783:	48 b8 00 e1 ff ff ff 	movabs $0xffffffffffffe100,%rax
+  80578a:	ff ff ff 
+  80578d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805791:	48 89 c7             	mov    %rax,%rdi
+  805794:	49 89 df             	mov    %rbx,%r15
+  805797:	b8 00 00 00 00       	mov    $0x0,%eax
+  80579c:	48 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rcx
+  8057a3:	ff ff ff 
+  8057a6:	48 01 d9             	add    %rbx,%rcx
+  8057a9:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8057ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8057b0:	eb 2a                	jmp    8057dc <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8057b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057b6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8057ba:	48 85 c0             	test   %rax,%rax
+  8057bd:	75 07                	jne    8057c6 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8057bf:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8057c4:	eb 16                	jmp    8057dc <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8057c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057ca:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8057ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057d2:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8057d5:	89 d6                	mov    %edx,%esi
+  8057d7:	48 89 c7             	mov    %rax,%rdi
+  8057da:	ff d1                	call   *%rcx
+}
+  8057dc:	48 83 c4 30          	add    $0x30,%rsp
+  8057e0:	5b                   	pop    %rbx
+  8057e1:	41 5f                	pop    %r15
+  8057e3:	5d                   	pop    %rbp
+  8057e4:	c3                   	ret
+
+00000000008057e5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8057e5:	55                   	push   %rbp
+  8057e6:	48 89 e5             	mov    %rsp,%rbp
+  8057e9:	53                   	push   %rbx
+  8057ea:	48 83 ec 38          	sub    $0x38,%rsp
+  8057ee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057ee <fstat+0x9>
+  8057f5:	49 bb 5a 68 00 00 00 	movabs $0x685a,%r11
+  8057fc:	00 00 00 
+  8057ff:	4c 01 db             	add    %r11,%rbx
+  805802:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805805:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  805809:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80580d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805810:	48 89 d6             	mov    %rdx,%rsi
+  805813:	89 c7                	mov    %eax,%edi
+  805815:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  80581c:	ff ff ff 
+  80581f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805823:	ff d0                	call   *%rax
+  805825:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805828:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80582c:	78 28                	js     805856 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80582e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805832:	8b 00                	mov    (%rax),%eax
+  805834:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805838:	48 89 d6             	mov    %rdx,%rsi
+  80583b:	89 c7                	mov    %eax,%edi
+  80583d:	48 b8 e1 8f ff ff ff 	movabs $0xffffffffffff8fe1,%rax
+  805844:	ff ff ff 
+  805847:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80584b:	ff d0                	call   *%rax
+  80584d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805850:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805854:	79 05                	jns    80585b <fstat+0x76>
+		return r;
+  805856:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805859:	eb 5e                	jmp    8058b9 <fstat+0xd4>
+	if (!dev->dev_stat)
+  80585b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80585f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  805863:	48 85 c0             	test   %rax,%rax
+  805866:	75 07                	jne    80586f <fstat+0x8a>
+		return -E_NOT_SUPP;
+  805868:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80586d:	eb 4a                	jmp    8058b9 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80586f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805873:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  805876:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80587a:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  805881:	00 00 00 
+	stat->st_isdir = 0;
+  805884:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805888:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80588f:	00 00 00 
+	stat->st_dev = dev;
+  805892:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805896:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80589a:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8058a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8058a5:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8058a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8058ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8058b1:	48 89 d6             	mov    %rdx,%rsi
+  8058b4:	48 89 c7             	mov    %rax,%rdi
+  8058b7:	ff d1                	call   *%rcx
+}
+  8058b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8058bd:	c9                   	leave
+  8058be:	c3                   	ret
+
+00000000008058bf <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8058bf:	55                   	push   %rbp
+  8058c0:	48 89 e5             	mov    %rsp,%rbp
+  8058c3:	41 57                	push   %r15
+  8058c5:	53                   	push   %rbx
+  8058c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8058ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058ca <stat+0xb>
+  8058d1:	49 bb 7e 67 00 00 00 	movabs $0x677e,%r11
+  8058d8:	00 00 00 
+  8058db:	4c 01 db             	add    %r11,%rbx
+  8058de:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8058e2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8058e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8058ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8058ef:	48 89 c7             	mov    %rax,%rdi
+  8058f2:	49 89 df             	mov    %rbx,%r15
+  8058f5:	48 b8 51 9b ff ff ff 	movabs $0xffffffffffff9b51,%rax
+  8058fc:	ff ff ff 
+  8058ff:	48 01 d8             	add    %rbx,%rax
+  805902:	ff d0                	call   *%rax
+  805904:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805907:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80590b:	79 05                	jns    805912 <stat+0x53>
+		return fd;
+  80590d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805910:	eb 37                	jmp    805949 <stat+0x8a>
+	r = fstat(fd, stat);
+  805912:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805916:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805919:	48 89 d6             	mov    %rdx,%rsi
+  80591c:	89 c7                	mov    %eax,%edi
+  80591e:	48 b8 9d 97 ff ff ff 	movabs $0xffffffffffff979d,%rax
+  805925:	ff ff ff 
+  805928:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80592c:	ff d0                	call   *%rax
+  80592e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  805931:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805934:	89 c7                	mov    %eax,%edi
+  805936:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  80593d:	ff ff ff 
+  805940:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805944:	ff d0                	call   *%rax
+	return r;
+  805946:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  805949:	48 83 c4 20          	add    $0x20,%rsp
+  80594d:	5b                   	pop    %rbx
+  80594e:	41 5f                	pop    %r15
+  805950:	5d                   	pop    %rbp
+  805951:	c3                   	ret
+
+0000000000805952 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  805952:	55                   	push   %rbp
+  805953:	48 89 e5             	mov    %rsp,%rbp
+  805956:	41 57                	push   %r15
+  805958:	53                   	push   %rbx
+  805959:	48 83 ec 10          	sub    $0x10,%rsp
+  80595d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80595d <fsipc+0xb>
+  805964:	49 bb eb 66 00 00 00 	movabs $0x66eb,%r11
+  80596b:	00 00 00 
+  80596e:	4c 01 db             	add    %r11,%rbx
+  805971:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805974:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  805978:	48 b8 e0 23 00 00 00 	movabs $0x23e0,%rax
+  80597f:	00 00 00 
+  805982:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805985:	85 c0                	test   %eax,%eax
+  805987:	75 24                	jne    8059ad <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  805989:	bf 01 00 00 00       	mov    $0x1,%edi
+  80598e:	49 89 df             	mov    %rbx,%r15
+  805991:	48 b8 a1 d7 ff ff ff 	movabs $0xffffffffffffd7a1,%rax
+  805998:	ff ff ff 
+  80599b:	48 01 d8             	add    %rbx,%rax
+  80599e:	ff d0                	call   *%rax
+  8059a0:	48 ba e0 23 00 00 00 	movabs $0x23e0,%rdx
+  8059a7:	00 00 00 
+  8059aa:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8059ad:	48 b8 e0 23 00 00 00 	movabs $0x23e0,%rax
+  8059b4:	00 00 00 
+  8059b7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8059ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8059be:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8059c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8059c7:	49 89 d0             	mov    %rdx,%r8
+  8059ca:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8059cf:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  8059d6:	00 00 00 
+  8059d9:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8059dd:	89 c7                	mov    %eax,%edi
+  8059df:	49 89 df             	mov    %rbx,%r15
+  8059e2:	48 b8 c0 d1 ff ff ff 	movabs $0xffffffffffffd1c0,%rax
+  8059e9:	ff ff ff 
+  8059ec:	48 01 d8             	add    %rbx,%rax
+  8059ef:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8059f1:	48 83 c4 10          	add    $0x10,%rsp
+  8059f5:	5b                   	pop    %rbx
+  8059f6:	41 5f                	pop    %r15
+  8059f8:	5d                   	pop    %rbp
+  8059f9:	c3                   	ret
+
+00000000008059fa <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8059fa:	55                   	push   %rbp
+  8059fb:	48 89 e5             	mov    %rsp,%rbp
+  8059fe:	41 57                	push   %r15
+  805a00:	53                   	push   %rbx
+  805a01:	48 83 ec 20          	sub    $0x20,%rsp
+  805a05:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a05 <fsipc_words+0xb>
+  805a0c:	49 bb 43 66 00 00 00 	movabs $0x6643,%r11
+  805a13:	00 00 00 
+  805a16:	4c 01 db             	add    %r11,%rbx
+  805a19:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a1c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805a20:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  805a24:	48 b8 e0 23 00 00 00 	movabs $0x23e0,%rax
+  805a2b:	00 00 00 
+  805a2e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805a31:	85 c0                	test   %eax,%eax
+  805a33:	75 24                	jne    805a59 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  805a35:	bf 01 00 00 00       	mov    $0x1,%edi
+  805a3a:	49 89 df             	mov    %rbx,%r15
+  805a3d:	48 b8 a1 d7 ff ff ff 	movabs $0xffffffffffffd7a1,%rax
+  805a44:	ff ff ff 
+  805a47:	48 01 d8             	add    %rbx,%rax
+  805a4a:	ff d0                	call   *%rax
+  805a4c:	48 ba e0 23 00 00 00 	movabs $0x23e0,%rdx
+  805a53:	00 00 00 
+  805a56:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  805a59:	48 b8 e0 23 00 00 00 	movabs $0x23e0,%rax
+  805a60:	00 00 00 
+  805a63:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805a66:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805a6a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a6e:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805a71:	89 c7                	mov    %eax,%edi
+  805a73:	49 89 df             	mov    %rbx,%r15
+  805a76:	48 b8 ab d2 ff ff ff 	movabs $0xffffffffffffd2ab,%rax
+  805a7d:	ff ff ff 
+  805a80:	48 01 d8             	add    %rbx,%rax
+  805a83:	ff d0                	call   *%rax
+}
+  805a85:	48 83 c4 20          	add    $0x20,%rsp
+  805a89:	5b                   	pop    %rbx
+  805a8a:	41 5f                	pop    %r15
+  805a8c:	5d                   	pop    %rbp
+  805a8d:	c3                   	ret
+
+0000000000805a8e <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  805a8e:	55                   	push   %rbp
+  805a8f:	48 89 e5             	mov    %rsp,%rbp
+  805a92:	41 57                	push   %r15
+  805a94:	53                   	push   %rbx
+  805a95:	48 83 ec 40          	sub    $0x40,%rsp
+  805a99:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a99 <fsipc_pages+0xb>
+  805aa0:	49 bb af 65 00 00 00 	movabs $0x65af,%r11
+  805aa7:	00 00 00 
+  805aaa:	4c 01 db             	add    %r11,%rbx
+  805aad:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805ab0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805ab4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  805ab8:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  805abb:	48 b8 e0 23 00 00 00 	movabs $0x23e0,%rax
+  805ac2:	00 00 00 
+  805ac5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805ac8:	85 c0                	test   %eax,%eax
+  805aca:	75 24                	jne    805af0 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  805acc:	bf 01 00 00 00       	mov    $0x1,%edi
+  805ad1:	49 89 df             	mov    %rbx,%r15
+  805ad4:	48 b8 a1 d7 ff ff ff 	movabs $0xffffffffffffd7a1,%rax
+  805adb:	ff ff ff 
+  805ade:	48 01 d8             	add    %rbx,%rax
+  805ae1:	ff d0                	call   *%rax
+  805ae3:	48 ba e0 23 00 00 00 	movabs $0x23e0,%rdx
+  805aea:	00 00 00 
+  805aed:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  805af0:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  805af5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  805af9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  805afc:	48 98                	cltq
+  805afe:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  805b02:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  805b06:	0f 95 c0             	setne  %al
+  805b09:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  805b0c:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805b13:	00 
+  805b14:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805b18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b1c:	48 01 d0             	add    %rdx,%rax
+  805b1f:	48 83 e8 01          	sub    $0x1,%rax
+  805b23:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805b27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b30:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805b34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b38:	48 29 d0             	sub    %rdx,%rax
+  805b3b:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  805b3f:	41 89 c2             	mov    %eax,%r10d
+  805b42:	48 b8 e0 23 00 00 00 	movabs $0x23e0,%rax
+  805b49:	00 00 00 
+  805b4c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b4f:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  805b53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805b57:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  805b5a:	48 83 ec 08          	sub    $0x8,%rsp
+  805b5e:	6a 40                	push   $0x40
+  805b60:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  805b65:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  805b6c:	00 
+  805b6d:	6a 05                	push   $0x5
+  805b6f:	41 89 f9             	mov    %edi,%r9d
+  805b72:	49 89 c8             	mov    %rcx,%r8
+  805b75:	44 89 d1             	mov    %r10d,%ecx
+  805b78:	89 c7                	mov    %eax,%edi
+  805b7a:	49 89 df             	mov    %rbx,%r15
+  805b7d:	48 b8 a9 d3 ff ff ff 	movabs $0xffffffffffffd3a9,%rax
+  805b84:	ff ff ff 
+  805b87:	48 01 d8             	add    %rbx,%rax
+  805b8a:	ff d0                	call   *%rax
+  805b8c:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  805b90:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805b94:	5b                   	pop    %rbx
+  805b95:	41 5f                	pop    %r15
+  805b97:	5d                   	pop    %rbp
+  805b98:	c3                   	ret
+
+0000000000805b99 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  805b99:	55                   	push   %rbp
+  805b9a:	48 89 e5             	mov    %rsp,%rbp
+  805b9d:	41 57                	push   %r15
+  805b9f:	53                   	push   %rbx
+  805ba0:	48 83 ec 20          	sub    $0x20,%rsp
+  805ba4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ba4 <open+0xb>
+  805bab:	49 bb a4 64 00 00 00 	movabs $0x64a4,%r11
+  805bb2:	00 00 00 
+  805bb5:	4c 01 db             	add    %r11,%rbx
+  805bb8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805bbc:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  805bbf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805bc3:	48 89 c7             	mov    %rax,%rdi
+  805bc6:	49 89 df             	mov    %rbx,%r15
+  805bc9:	48 b8 3b 69 ff ff ff 	movabs $0xffffffffffff693b,%rax
+  805bd0:	ff ff ff 
+  805bd3:	48 01 d8             	add    %rbx,%rax
+  805bd6:	ff d0                	call   *%rax
+  805bd8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  805bdd:	7e 0a                	jle    805be9 <open+0x50>
+		return -E_BAD_PATH;
+  805bdf:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  805be4:	e9 18 01 00 00       	jmp    805d01 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  805be9:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805bed:	48 89 c7             	mov    %rax,%rdi
+  805bf0:	49 89 df             	mov    %rbx,%r15
+  805bf3:	48 b8 85 8d ff ff ff 	movabs $0xffffffffffff8d85,%rax
+  805bfa:	ff ff ff 
+  805bfd:	48 01 d8             	add    %rbx,%rax
+  805c00:	ff d0                	call   *%rax
+  805c02:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c05:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c09:	74 08                	je     805c13 <open+0x7a>
+		return r;
+  805c0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c0e:	e9 ee 00 00 00       	jmp    805d01 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  805c13:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  805c1a:	00 00 00 
+  805c1d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805c20:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  805c27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c2b:	48 89 c6             	mov    %rax,%rsi
+  805c2e:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  805c35:	00 00 00 
+  805c38:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c3c:	48 89 c7             	mov    %rax,%rdi
+  805c3f:	49 89 df             	mov    %rbx,%r15
+  805c42:	48 b8 cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rax
+  805c49:	ff ff ff 
+  805c4c:	48 01 d8             	add    %rbx,%rax
+  805c4f:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  805c51:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c55:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  805c5a:	48 89 c6             	mov    %rax,%rsi
+  805c5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c62:	49 89 df             	mov    %rbx,%r15
+  805c65:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  805c6c:	ff ff ff 
+  805c6f:	48 01 d8             	add    %rbx,%rax
+  805c72:	ff d0                	call   *%rax
+  805c74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c77:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c7b:	74 23                	je     805ca0 <open+0x107>
+		fd_close(fd,0);
+  805c7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c81:	be 00 00 00 00       	mov    $0x0,%esi
+  805c86:	48 89 c7             	mov    %rax,%rdi
+  805c89:	49 89 df             	mov    %rbx,%r15
+  805c8c:	48 b8 e6 8e ff ff ff 	movabs $0xffffffffffff8ee6,%rax
+  805c93:	ff ff ff 
+  805c96:	48 01 d8             	add    %rbx,%rax
+  805c99:	ff d0                	call   *%rax
+		return r;
+  805c9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c9e:	eb 61                	jmp    805d01 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  805ca0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ca4:	48 89 c6             	mov    %rax,%rsi
+  805ca7:	bf 01 00 00 00       	mov    $0x1,%edi
+  805cac:	48 b8 0a 99 ff ff ff 	movabs $0xffffffffffff990a,%rax
+  805cb3:	ff ff ff 
+  805cb6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cba:	ff d0                	call   *%rax
+  805cbc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805cbf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805cc3:	74 23                	je     805ce8 <open+0x14f>
+		fd_close(fd,0);
+  805cc5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805cc9:	be 00 00 00 00       	mov    $0x0,%esi
+  805cce:	48 89 c7             	mov    %rax,%rdi
+  805cd1:	49 89 df             	mov    %rbx,%r15
+  805cd4:	48 b8 e6 8e ff ff ff 	movabs $0xffffffffffff8ee6,%rax
+  805cdb:	ff ff ff 
+  805cde:	48 01 d8             	add    %rbx,%rax
+  805ce1:	ff d0                	call   *%rax
+		return r;
+  805ce3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ce6:	eb 19                	jmp    805d01 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  805ce8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805cec:	48 89 c7             	mov    %rax,%rdi
+  805cef:	49 89 df             	mov    %rbx,%r15
+  805cf2:	48 b8 0b 8d ff ff ff 	movabs $0xffffffffffff8d0b,%rax
+  805cf9:	ff ff ff 
+  805cfc:	48 01 d8             	add    %rbx,%rax
+  805cff:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  805d01:	48 83 c4 20          	add    $0x20,%rsp
+  805d05:	5b                   	pop    %rbx
+  805d06:	41 5f                	pop    %r15
+  805d08:	5d                   	pop    %rbp
+  805d09:	c3                   	ret
+
+0000000000805d0a <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  805d0a:	55                   	push   %rbp
+  805d0b:	48 89 e5             	mov    %rsp,%rbp
+  805d0e:	48 83 ec 20          	sub    $0x20,%rsp
+  805d12:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d12 <devfile_flush+0x8>
+  805d19:	49 bb 36 63 00 00 00 	movabs $0x6336,%r11
+  805d20:	00 00 00 
+  805d23:	4c 01 d8             	add    %r11,%rax
+  805d26:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  805d2a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805d2e:	8b 52 0c             	mov    0xc(%rdx),%edx
+  805d31:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  805d34:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805d38:	ba 04 00 00 00       	mov    $0x4,%edx
+  805d3d:	48 89 ce             	mov    %rcx,%rsi
+  805d40:	bf 06 00 00 00       	mov    $0x6,%edi
+  805d45:	48 b9 b2 99 ff ff ff 	movabs $0xffffffffffff99b2,%rcx
+  805d4c:	ff ff ff 
+  805d4f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805d53:	ff d0                	call   *%rax
+}
+  805d55:	c9                   	leave
+  805d56:	c3                   	ret
+
+0000000000805d57 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  805d57:	55                   	push   %rbp
+  805d58:	48 89 e5             	mov    %rsp,%rbp
+  805d5b:	41 57                	push   %r15
+  805d5d:	53                   	push   %rbx
+  805d5e:	48 83 ec 60          	sub    $0x60,%rsp
+  805d62:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d62 <devfile_read+0xb>
+  805d69:	49 bb e6 62 00 00 00 	movabs $0x62e6,%r11
+  805d70:	00 00 00 
+  805d73:	4c 01 db             	add    %r11,%rbx
+  805d76:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805d7a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805d7e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  805d82:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805d86:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  805d8a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805d8e:	8b 50 0c             	mov    0xc(%rax),%edx
+  805d91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d95:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  805d97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d9b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  805d9f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  805da3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805da7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805dac:	ba 10 00 00 00       	mov    $0x10,%edx
+  805db1:	48 89 c6             	mov    %rax,%rsi
+  805db4:	bf 03 00 00 00       	mov    $0x3,%edi
+  805db9:	48 b8 46 9a ff ff ff 	movabs $0xffffffffffff9a46,%rax
+  805dc0:	ff ff ff 
+  805dc3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dc7:	ff d0                	call   *%rax
+  805dc9:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805dcc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805dd0:	79 05                	jns    805dd7 <devfile_read+0x80>
+		return r;
+  805dd2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805dd5:	eb 64                	jmp    805e3b <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  805dd7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805dda:	48 63 d0             	movslq %eax,%rdx
+  805ddd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805de1:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  805de6:	48 01 c1             	add    %rax,%rcx
+  805de9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805ded:	48 89 ce             	mov    %rcx,%rsi
+  805df0:	48 89 c7             	mov    %rax,%rdi
+  805df3:	49 89 df             	mov    %rbx,%r15
+  805df6:	48 b8 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rax
+  805dfd:	ff ff ff 
+  805e00:	48 01 d8             	add    %rbx,%rax
+  805e03:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  805e05:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805e0c:	ff ff ff 
+  805e0f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805e13:	48 8b 00             	mov    (%rax),%rax
+  805e16:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  805e1c:	89 c6                	mov    %eax,%esi
+  805e1e:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  805e23:	48 89 c7             	mov    %rax,%rdi
+  805e26:	49 89 df             	mov    %rbx,%r15
+  805e29:	48 b8 5b d7 ff ff ff 	movabs $0xffffffffffffd75b,%rax
+  805e30:	ff ff ff 
+  805e33:	48 01 d8             	add    %rbx,%rax
+  805e36:	ff d0                	call   *%rax
+	return r;
+  805e38:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  805e3b:	48 83 c4 60          	add    $0x60,%rsp
+  805e3f:	5b                   	pop    %rbx
+  805e40:	41 5f                	pop    %r15
+  805e42:	5d                   	pop    %rbp
+  805e43:	c3                   	ret
+
+0000000000805e44 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805e44:	55                   	push   %rbp
+  805e45:	48 89 e5             	mov    %rsp,%rbp
+  805e48:	41 57                	push   %r15
+  805e4a:	53                   	push   %rbx
+  805e4b:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  805e4f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e4f <devfile_write+0xb>
+  805e56:	49 bb f9 61 00 00 00 	movabs $0x61f9,%r11
+  805e5d:	00 00 00 
+  805e60:	4c 01 db             	add    %r11,%rbx
+  805e63:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  805e67:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  805e6b:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  805e72:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805e76:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  805e7a:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  805e81:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805e85:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  805e8c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e8f:	48 63 d0             	movslq %eax,%rdx
+  805e92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e96:	48 39 c2             	cmp    %rax,%rdx
+  805e99:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805e9d:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  805ea4:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  805eab:	00 
+  805eac:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  805eb3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805eb7:	48 01 d0             	add    %rdx,%rax
+  805eba:	48 83 e8 01          	sub    $0x1,%rax
+  805ebe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805ec2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ec6:	ba 00 00 00 00       	mov    $0x0,%edx
+  805ecb:	48 f7 75 d0          	divq   -0x30(%rbp)
+  805ecf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ed3:	48 29 d0             	sub    %rdx,%rax
+  805ed6:	48 c1 e8 0c          	shr    $0xc,%rax
+  805eda:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  805edd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805ee0:	89 c6                	mov    %eax,%esi
+  805ee2:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  805ee7:	48 89 c7             	mov    %rax,%rdi
+  805eea:	49 89 df             	mov    %rbx,%r15
+  805eed:	48 b8 15 d7 ff ff ff 	movabs $0xffffffffffffd715,%rax
+  805ef4:	ff ff ff 
+  805ef7:	48 01 d8             	add    %rbx,%rax
+  805efa:	ff d0                	call   *%rax
+  805efc:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  805eff:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  805f03:	79 08                	jns    805f0d <devfile_write+0xc9>
+		return r;
+  805f05:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  805f08:	e9 8f 00 00 00       	jmp    805f9c <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  805f0d:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  805f14:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  805f18:	48 89 c6             	mov    %rax,%rsi
+  805f1b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  805f20:	48 89 c7             	mov    %rax,%rdi
+  805f23:	49 89 df             	mov    %rbx,%r15
+  805f26:	48 b8 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rax
+  805f2d:	ff ff ff 
+  805f30:	48 01 d8             	add    %rbx,%rax
+  805f33:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  805f35:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  805f39:	8b 50 0c             	mov    0xc(%rax),%edx
+  805f3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f40:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  805f42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f46:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  805f4d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  805f51:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  805f54:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805f58:	89 d1                	mov    %edx,%ecx
+  805f5a:	ba 10 00 00 00       	mov    $0x10,%edx
+  805f5f:	48 89 c6             	mov    %rax,%rsi
+  805f62:	bf 04 00 00 00       	mov    $0x4,%edi
+  805f67:	48 b8 46 9a ff ff ff 	movabs $0xffffffffffff9a46,%rax
+  805f6e:	ff ff ff 
+  805f71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f75:	ff d0                	call   *%rax
+  805f77:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  805f7a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805f7d:	89 c6                	mov    %eax,%esi
+  805f7f:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  805f84:	48 89 c7             	mov    %rax,%rdi
+  805f87:	49 89 df             	mov    %rbx,%r15
+  805f8a:	48 b8 5b d7 ff ff ff 	movabs $0xffffffffffffd75b,%rax
+  805f91:	ff ff ff 
+  805f94:	48 01 d8             	add    %rbx,%rax
+  805f97:	ff d0                	call   *%rax
+	return r;
+  805f99:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  805f9c:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  805fa0:	5b                   	pop    %rbx
+  805fa1:	41 5f                	pop    %r15
+  805fa3:	5d                   	pop    %rbp
+  805fa4:	c3                   	ret
+
+0000000000805fa5 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  805fa5:	55                   	push   %rbp
+  805fa6:	48 89 e5             	mov    %rsp,%rbp
+  805fa9:	41 57                	push   %r15
+  805fab:	53                   	push   %rbx
+  805fac:	48 83 ec 20          	sub    $0x20,%rsp
+  805fb0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fb0 <devfile_stat+0xb>
+  805fb7:	49 bb 98 60 00 00 00 	movabs $0x6098,%r11
+  805fbe:	00 00 00 
+  805fc1:	4c 01 db             	add    %r11,%rbx
+  805fc4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805fc8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  805fcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805fd0:	8b 40 0c             	mov    0xc(%rax),%eax
+  805fd3:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  805fda:	00 00 00 
+  805fdd:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  805fe0:	be 00 00 00 00       	mov    $0x0,%esi
+  805fe5:	bf 05 00 00 00       	mov    $0x5,%edi
+  805fea:	48 b8 0a 99 ff ff ff 	movabs $0xffffffffffff990a,%rax
+  805ff1:	ff ff ff 
+  805ff4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ff8:	ff d0                	call   *%rax
+  805ffa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ffd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806001:	79 05                	jns    806008 <devfile_stat+0x63>
+		return r;
+  806003:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806006:	eb 65                	jmp    80606d <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  806008:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80600c:	48 ba b8 3f 01 00 00 	movabs $0x13fb8,%rdx
+  806013:	00 00 00 
+  806016:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80601a:	48 89 d6             	mov    %rdx,%rsi
+  80601d:	48 89 c7             	mov    %rax,%rdi
+  806020:	49 89 df             	mov    %rbx,%r15
+  806023:	48 b8 cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rax
+  80602a:	ff ff ff 
+  80602d:	48 01 d8             	add    %rbx,%rax
+  806030:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  806032:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  806039:	00 00 00 
+  80603c:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  806043:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806047:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80604d:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  806054:	00 00 00 
+  806057:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  80605e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806062:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  806068:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80606d:	48 83 c4 20          	add    $0x20,%rsp
+  806071:	5b                   	pop    %rbx
+  806072:	41 5f                	pop    %r15
+  806074:	5d                   	pop    %rbp
+  806075:	c3                   	ret
+
+0000000000806076 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  806076:	55                   	push   %rbp
+  806077:	48 89 e5             	mov    %rsp,%rbp
+  80607a:	48 83 ec 20          	sub    $0x20,%rsp
+  80607e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80607e <devfile_trunc+0x8>
+  806085:	49 bb ca 5f 00 00 00 	movabs $0x5fca,%r11
+  80608c:	00 00 00 
+  80608f:	4c 01 d8             	add    %r11,%rax
+  806092:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806096:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  806099:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80609d:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8060a0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  8060a3:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8060a6:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8060a9:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8060ad:	ba 08 00 00 00       	mov    $0x8,%edx
+  8060b2:	48 89 ce             	mov    %rcx,%rsi
+  8060b5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8060ba:	48 b9 b2 99 ff ff ff 	movabs $0xffffffffffff99b2,%rcx
+  8060c1:	ff ff ff 
+  8060c4:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8060c8:	ff d0                	call   *%rax
+}
+  8060ca:	c9                   	leave
+  8060cb:	c3                   	ret
+
+00000000008060cc <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8060cc:	55                   	push   %rbp
+  8060cd:	48 89 e5             	mov    %rsp,%rbp
+  8060d0:	41 57                	push   %r15
+  8060d2:	53                   	push   %rbx
+  8060d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8060d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060d7 <remove+0xb>
+  8060de:	49 bb 71 5f 00 00 00 	movabs $0x5f71,%r11
+  8060e5:	00 00 00 
+  8060e8:	4c 01 db             	add    %r11,%rbx
+  8060eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8060ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060f3:	48 89 c7             	mov    %rax,%rdi
+  8060f6:	49 89 df             	mov    %rbx,%r15
+  8060f9:	48 b8 3b 69 ff ff ff 	movabs $0xffffffffffff693b,%rax
+  806100:	ff ff ff 
+  806103:	48 01 d8             	add    %rbx,%rax
+  806106:	ff d0                	call   *%rax
+  806108:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80610d:	7e 07                	jle    806116 <remove+0x4a>
+		return -E_BAD_PATH;
+  80610f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  806114:	eb 44                	jmp    80615a <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  806116:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80611a:	48 89 c6             	mov    %rax,%rsi
+  80611d:	48 b8 b8 3f 01 00 00 	movabs $0x13fb8,%rax
+  806124:	00 00 00 
+  806127:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80612b:	48 89 c7             	mov    %rax,%rdi
+  80612e:	49 89 df             	mov    %rbx,%r15
+  806131:	48 b8 cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rax
+  806138:	ff ff ff 
+  80613b:	48 01 d8             	add    %rbx,%rax
+  80613e:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  806140:	be 00 00 00 00       	mov    $0x0,%esi
+  806145:	bf 07 00 00 00       	mov    $0x7,%edi
+  80614a:	48 b8 0a 99 ff ff ff 	movabs $0xffffffffffff990a,%rax
+  806151:	ff ff ff 
+  806154:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806158:	ff d0                	call   *%rax
+}
+  80615a:	48 83 c4 10          	add    $0x10,%rsp
+  80615e:	5b                   	pop    %rbx
+  80615f:	41 5f                	pop    %r15
+  806161:	5d                   	pop    %rbp
+  806162:	c3                   	ret
+
+0000000000806163 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  806163:	55                   	push   %rbp
+  806164:	48 89 e5             	mov    %rsp,%rbp
+  806167:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806167 <sync+0x4>
+  80616e:	49 bb e1 5e 00 00 00 	movabs $0x5ee1,%r11
+  806175:	00 00 00 
+  806178:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80617b:	ba 00 00 00 00       	mov    $0x0,%edx
+  806180:	be 00 00 00 00       	mov    $0x0,%esi
+  806185:	bf 08 00 00 00       	mov    $0x8,%edi
+  80618a:	48 b9 b2 99 ff ff ff 	movabs $0xffffffffffff99b2,%rcx
+  806191:	ff ff ff 
+  806194:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  806198:	ff d0                	call   *%rax
+}
+  80619a:	5d                   	pop    %rbp
+  80619b:	c3                   	ret
+
+000000000080619c <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80619c:	55                   	push   %rbp
+  80619d:	48 89 e5             	mov    %rsp,%rbp
+  8061a0:	41 57                	push   %r15
+  8061a2:	53                   	push   %rbx
+  8061a3:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8061aa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061aa <copy+0xe>
+  8061b1:	49 bb 9e 5e 00 00 00 	movabs $0x5e9e,%r11
+  8061b8:	00 00 00 
+  8061bb:	4c 01 db             	add    %r11,%rbx
+  8061be:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8061c5:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8061cc:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8061d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8061d8:	48 89 c7             	mov    %rax,%rdi
+  8061db:	48 b8 51 9b ff ff ff 	movabs $0xffffffffffff9b51,%rax
+  8061e2:	ff ff ff 
+  8061e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8061e9:	ff d0                	call   *%rax
+  8061eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8061ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061f2:	79 35                	jns    806229 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8061f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061f7:	89 c6                	mov    %eax,%esi
+  8061f9:	48 b8 26 e1 ff ff ff 	movabs $0xffffffffffffe126,%rax
+  806200:	ff ff ff 
+  806203:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806207:	48 89 c7             	mov    %rax,%rdi
+  80620a:	49 89 df             	mov    %rbx,%r15
+  80620d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806212:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  806219:	ff ff ff 
+  80621c:	48 01 da             	add    %rbx,%rdx
+  80621f:	ff d2                	call   *%rdx
+		return fd_src;
+  806221:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806224:	e9 d7 01 00 00       	jmp    806400 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  806229:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  806230:	be 01 01 00 00       	mov    $0x101,%esi
+  806235:	48 89 c7             	mov    %rax,%rdi
+  806238:	48 b8 51 9b ff ff ff 	movabs $0xffffffffffff9b51,%rax
+  80623f:	ff ff ff 
+  806242:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806246:	ff d0                	call   *%rax
+  806248:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  80624b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80624f:	0f 89 df 00 00 00    	jns    806334 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  806255:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806258:	89 c6                	mov    %eax,%esi
+  80625a:	48 b8 3c e1 ff ff ff 	movabs $0xffffffffffffe13c,%rax
+  806261:	ff ff ff 
+  806264:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806268:	48 89 c7             	mov    %rax,%rdi
+  80626b:	49 89 df             	mov    %rbx,%r15
+  80626e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806273:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  80627a:	ff ff ff 
+  80627d:	48 01 da             	add    %rbx,%rdx
+  806280:	ff d2                	call   *%rdx
+		close(fd_src);
+  806282:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806285:	89 c7                	mov    %eax,%edi
+  806287:	49 89 df             	mov    %rbx,%r15
+  80628a:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  806291:	ff ff ff 
+  806294:	48 01 d8             	add    %rbx,%rax
+  806297:	ff d0                	call   *%rax
+		return fd_dest;
+  806299:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80629c:	e9 5f 01 00 00       	jmp    806400 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  8062a1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8062a4:	48 63 d0             	movslq %eax,%rdx
+  8062a7:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8062ae:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8062b1:	48 89 ce             	mov    %rcx,%rsi
+  8062b4:	89 c7                	mov    %eax,%edi
+  8062b6:	49 89 df             	mov    %rbx,%r15
+  8062b9:	48 b8 28 95 ff ff ff 	movabs $0xffffffffffff9528,%rax
+  8062c0:	ff ff ff 
+  8062c3:	48 01 d8             	add    %rbx,%rax
+  8062c6:	ff d0                	call   *%rax
+  8062c8:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8062cb:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8062cf:	79 63                	jns    806334 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8062d1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8062d4:	89 c6                	mov    %eax,%esi
+  8062d6:	48 b8 56 e1 ff ff ff 	movabs $0xffffffffffffe156,%rax
+  8062dd:	ff ff ff 
+  8062e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8062e4:	48 89 c7             	mov    %rax,%rdi
+  8062e7:	49 89 df             	mov    %rbx,%r15
+  8062ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062ef:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  8062f6:	ff ff ff 
+  8062f9:	48 01 da             	add    %rbx,%rdx
+  8062fc:	ff d2                	call   *%rdx
+			close(fd_src);
+  8062fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806301:	89 c7                	mov    %eax,%edi
+  806303:	49 89 df             	mov    %rbx,%r15
+  806306:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  80630d:	ff ff ff 
+  806310:	48 01 d8             	add    %rbx,%rax
+  806313:	ff d0                	call   *%rax
+			close(fd_dest);
+  806315:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806318:	89 c7                	mov    %eax,%edi
+  80631a:	49 89 df             	mov    %rbx,%r15
+  80631d:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  806324:	ff ff ff 
+  806327:	48 01 d8             	add    %rbx,%rax
+  80632a:	ff d0                	call   *%rax
+			return write_size;
+  80632c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80632f:	e9 cc 00 00 00       	jmp    806400 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  806334:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80633b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80633e:	ba 00 02 00 00       	mov    $0x200,%edx
+  806343:	48 89 ce             	mov    %rcx,%rsi
+  806346:	89 c7                	mov    %eax,%edi
+  806348:	49 89 df             	mov    %rbx,%r15
+  80634b:	48 b8 82 93 ff ff ff 	movabs $0xffffffffffff9382,%rax
+  806352:	ff ff ff 
+  806355:	48 01 d8             	add    %rbx,%rax
+  806358:	ff d0                	call   *%rax
+  80635a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80635d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  806361:	0f 8f 3a ff ff ff    	jg     8062a1 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  806367:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80636b:	79 60                	jns    8063cd <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  80636d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806370:	89 c6                	mov    %eax,%esi
+  806372:	48 b8 69 e1 ff ff ff 	movabs $0xffffffffffffe169,%rax
+  806379:	ff ff ff 
+  80637c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806380:	48 89 c7             	mov    %rax,%rdi
+  806383:	49 89 df             	mov    %rbx,%r15
+  806386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80638b:	48 ba 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rdx
+  806392:	ff ff ff 
+  806395:	48 01 da             	add    %rbx,%rdx
+  806398:	ff d2                	call   *%rdx
+		close(fd_src);
+  80639a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80639d:	89 c7                	mov    %eax,%edi
+  80639f:	49 89 df             	mov    %rbx,%r15
+  8063a2:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  8063a9:	ff ff ff 
+  8063ac:	48 01 d8             	add    %rbx,%rax
+  8063af:	ff d0                	call   *%rax
+		close(fd_dest);
+  8063b1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8063b4:	89 c7                	mov    %eax,%edi
+  8063b6:	49 89 df             	mov    %rbx,%r15
+  8063b9:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  8063c0:	ff ff ff 
+  8063c3:	48 01 d8             	add    %rbx,%rax
+  8063c6:	ff d0                	call   *%rax
+		return read_size;
+  8063c8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8063cb:	eb 33                	jmp    806400 <copy+0x264>
+	}
+	close(fd_src);
+  8063cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063d0:	89 c7                	mov    %eax,%edi
+  8063d2:	49 89 df             	mov    %rbx,%r15
+  8063d5:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  8063dc:	ff ff ff 
+  8063df:	48 01 d8             	add    %rbx,%rax
+  8063e2:	ff d0                	call   *%rax
+	close(fd_dest);
+  8063e4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8063e7:	89 c7                	mov    %eax,%edi
+  8063e9:	49 89 df             	mov    %rbx,%r15
+  8063ec:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  8063f3:	ff ff ff 
+  8063f6:	48 01 d8             	add    %rbx,%rax
+  8063f9:	ff d0                	call   *%rax
+	return 0;
+  8063fb:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  806400:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  806407:	5b                   	pop    %rbx
+  806408:	41 5f                	pop    %r15
+  80640a:	5d                   	pop    %rbp
+  80640b:	c3                   	ret
+
+000000000080640c <writebuf>:
+};
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  80640c:	55                   	push   %rbp
+  80640d:	48 89 e5             	mov    %rsp,%rbp
+  806410:	41 57                	push   %r15
+  806412:	48 83 ec 28          	sub    $0x28,%rsp
+  806416:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806416 <writebuf+0xa>
+  80641d:	49 bb 32 5c 00 00 00 	movabs $0x5c32,%r11
+  806424:	00 00 00 
+  806427:	4c 01 d8             	add    %r11,%rax
+  80642a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	if (b->error > 0) {
+  80642e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806432:	8b 52 0c             	mov    0xc(%rdx),%edx
+  806435:	85 d2                	test   %edx,%edx
+  806437:	7e 68                	jle    8064a1 <writebuf+0x95>
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  806439:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80643d:	8b 52 04             	mov    0x4(%rdx),%edx
+  806440:	48 63 d2             	movslq %edx,%rdx
+  806443:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  806447:	48 8d 71 10          	lea    0x10(%rcx),%rsi
+  80644b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80644f:	8b 09                	mov    (%rcx),%ecx
+  806451:	89 cf                	mov    %ecx,%edi
+  806453:	49 89 c7             	mov    %rax,%r15
+  806456:	48 b9 28 95 ff ff ff 	movabs $0xffffffffffff9528,%rcx
+  80645d:	ff ff ff 
+  806460:	48 01 c1             	add    %rax,%rcx
+  806463:	ff d1                	call   *%rcx
+  806465:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		if (result > 0)
+  806468:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80646c:	7e 13                	jle    806481 <writebuf+0x75>
+			b->result += result;
+  80646e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806472:	8b 50 08             	mov    0x8(%rax),%edx
+  806475:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806478:	01 c2                	add    %eax,%edx
+  80647a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80647e:	89 50 08             	mov    %edx,0x8(%rax)
+		if (result != b->idx) // error, or wrote less than supplied
+  806481:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806485:	8b 40 04             	mov    0x4(%rax),%eax
+  806488:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80648b:	74 14                	je     8064a1 <writebuf+0x95>
+			b->error = (result < 0 ? result : 0);
+  80648d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806490:	ba 00 00 00 00       	mov    $0x0,%edx
+  806495:	85 c0                	test   %eax,%eax
+  806497:	0f 4e d0             	cmovle %eax,%edx
+  80649a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80649e:	89 50 0c             	mov    %edx,0xc(%rax)
+	}
+}
+  8064a1:	90                   	nop
+  8064a2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8064a6:	c9                   	leave
+  8064a7:	c3                   	ret
+
+00000000008064a8 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8064a8:	55                   	push   %rbp
+  8064a9:	48 89 e5             	mov    %rsp,%rbp
+  8064ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8064b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064b0 <putch+0x8>
+  8064b7:	49 bb 98 5b 00 00 00 	movabs $0x5b98,%r11
+  8064be:	00 00 00 
+  8064c1:	4c 01 d8             	add    %r11,%rax
+  8064c4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8064c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct printbuf *b = (struct printbuf *) thunk;
+  8064cb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8064cf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	b->buf[b->idx++] = ch;
+  8064d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8064d7:	8b 52 04             	mov    0x4(%rdx),%edx
+  8064da:	8d 72 01             	lea    0x1(%rdx),%esi
+  8064dd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8064e1:	89 71 04             	mov    %esi,0x4(%rcx)
+  8064e4:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8064e7:	89 ce                	mov    %ecx,%esi
+  8064e9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8064ed:	48 63 d2             	movslq %edx,%rdx
+  8064f0:	40 88 74 11 10       	mov    %sil,0x10(%rcx,%rdx,1)
+	if (b->idx == 256) {
+  8064f5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8064f9:	8b 52 04             	mov    0x4(%rdx),%edx
+  8064fc:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  806502:	75 22                	jne    806526 <putch+0x7e>
+		writebuf(b);
+  806504:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806508:	48 89 d7             	mov    %rdx,%rdi
+  80650b:	48 ba c4 a3 ff ff ff 	movabs $0xffffffffffffa3c4,%rdx
+  806512:	ff ff ff 
+  806515:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806519:	ff d0                	call   *%rax
+		b->idx = 0;
+  80651b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80651f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+	}
+}
+  806526:	90                   	nop
+  806527:	c9                   	leave
+  806528:	c3                   	ret
+
+0000000000806529 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  806529:	55                   	push   %rbp
+  80652a:	48 89 e5             	mov    %rsp,%rbp
+  80652d:	41 57                	push   %r15
+  80652f:	53                   	push   %rbx
+  806530:	48 81 ec 30 01 00 00 	sub    $0x130,%rsp
+  806537:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806537 <vfprintf+0xe>
+  80653e:	49 bb 11 5b 00 00 00 	movabs $0x5b11,%r11
+  806545:	00 00 00 
+  806548:	4c 01 db             	add    %r11,%rbx
+  80654b:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  806551:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  806558:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+	struct printbuf b;
+
+	b.fd = fd;
+  80655f:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  806565:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+	b.idx = 0;
+  80656b:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  806572:	00 00 00 
+	b.result = 0;
+  806575:	c7 85 e8 fe ff ff 00 	movl   $0x0,-0x118(%rbp)
+  80657c:	00 00 00 
+	b.error = 1;
+  80657f:	c7 85 ec fe ff ff 01 	movl   $0x1,-0x114(%rbp)
+  806586:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  806589:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  806590:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  806597:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80659e:	48 89 c6             	mov    %rax,%rsi
+  8065a1:	48 b8 60 a4 ff ff ff 	movabs $0xffffffffffffa460,%rax
+  8065a8:	ff ff ff 
+  8065ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8065af:	48 89 c7             	mov    %rax,%rdi
+  8065b2:	49 89 df             	mov    %rbx,%r15
+  8065b5:	48 b8 93 5e ff ff ff 	movabs $0xffffffffffff5e93,%rax
+  8065bc:	ff ff ff 
+  8065bf:	48 01 d8             	add    %rbx,%rax
+  8065c2:	ff d0                	call   *%rax
+	if (b.idx > 0)
+  8065c4:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  8065ca:	85 c0                	test   %eax,%eax
+  8065cc:	7e 1a                	jle    8065e8 <vfprintf+0xbf>
+		writebuf(&b);
+  8065ce:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8065d5:	48 89 c7             	mov    %rax,%rdi
+  8065d8:	48 b8 c4 a3 ff ff ff 	movabs $0xffffffffffffa3c4,%rax
+  8065df:	ff ff ff 
+  8065e2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8065e6:	ff d0                	call   *%rax
+
+	return (b.result ? b.result : b.error);
+  8065e8:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  8065ee:	85 c0                	test   %eax,%eax
+  8065f0:	74 08                	je     8065fa <vfprintf+0xd1>
+  8065f2:	8b 85 e8 fe ff ff    	mov    -0x118(%rbp),%eax
+  8065f8:	eb 06                	jmp    806600 <vfprintf+0xd7>
+  8065fa:	8b 85 ec fe ff ff    	mov    -0x114(%rbp),%eax
+}
+  806600:	48 81 c4 30 01 00 00 	add    $0x130,%rsp
+  806607:	5b                   	pop    %rbx
+  806608:	41 5f                	pop    %r15
+  80660a:	5d                   	pop    %rbp
+  80660b:	c3                   	ret
+
+000000000080660c <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  80660c:	55                   	push   %rbp
+  80660d:	48 89 e5             	mov    %rsp,%rbp
+  806610:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  806617:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 806617 <fprintf+0xb>
+  80661e:	49 bb 31 5a 00 00 00 	movabs $0x5a31,%r11
+  806625:	00 00 00 
+  806628:	4d 01 da             	add    %r11,%r10
+  80662b:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  806631:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  806638:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80663f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  806646:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80664d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  806654:	84 c0                	test   %al,%al
+  806656:	74 20                	je     806678 <fprintf+0x6c>
+  806658:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80665c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  806660:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  806664:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  806668:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80666c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  806670:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  806674:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  806678:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  80667f:	00 00 00 
+  806682:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  806689:	00 00 00 
+  80668c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  806690:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  806697:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80669e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(fd, fmt, ap);
+  8066a5:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8066ac:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  8066b3:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  8066b9:	48 89 ce             	mov    %rcx,%rsi
+  8066bc:	89 c7                	mov    %eax,%edi
+  8066be:	48 b8 e1 a4 ff ff ff 	movabs $0xffffffffffffa4e1,%rax
+  8066c5:	ff ff ff 
+  8066c8:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8066cc:	ff d0                	call   *%rax
+  8066ce:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  8066d4:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8066da:	c9                   	leave
+  8066db:	c3                   	ret
+
+00000000008066dc <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8066dc:	55                   	push   %rbp
+  8066dd:	48 89 e5             	mov    %rsp,%rbp
+  8066e0:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8066e7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8066e7 <printf+0xb>
+  8066ee:	49 bb 61 59 00 00 00 	movabs $0x5961,%r11
+  8066f5:	00 00 00 
+  8066f8:	4d 01 da             	add    %r11,%r10
+  8066fb:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  806702:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  806709:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  806710:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  806717:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80671e:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  806725:	84 c0                	test   %al,%al
+  806727:	74 20                	je     806749 <printf+0x6d>
+  806729:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80672d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  806731:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  806735:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  806739:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80673d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  806741:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  806745:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  806749:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  806750:	00 00 00 
+  806753:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80675a:	00 00 00 
+  80675d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  806761:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  806768:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80676f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	cnt = vfprintf(1, fmt, ap);
+  806776:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80677d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  806784:	48 89 c6             	mov    %rax,%rsi
+  806787:	bf 01 00 00 00       	mov    $0x1,%edi
+  80678c:	48 b8 e1 a4 ff ff ff 	movabs $0xffffffffffffa4e1,%rax
+  806793:	ff ff ff 
+  806796:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80679a:	ff d0                	call   *%rax
+  80679c:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(ap);
+
+	return cnt;
+  8067a2:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8067a8:	c9                   	leave
+  8067a9:	c3                   	ret
+
+00000000008067aa <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8067aa:	55                   	push   %rbp
+  8067ab:	48 89 e5             	mov    %rsp,%rbp
+  8067ae:	41 57                	push   %r15
+  8067b0:	53                   	push   %rbx
+  8067b1:	48 81 ec 00 03 00 00 	sub    $0x300,%rsp
+  8067b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067b8 <spawn+0xe>
+  8067bf:	49 bb 90 58 00 00 00 	movabs $0x5890,%r11
+  8067c6:	00 00 00 
+  8067c9:	4c 01 db             	add    %r11,%rbx
+  8067cc:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  8067d3:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  8067da:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  8067e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8067e6:	48 89 c7             	mov    %rax,%rdi
+  8067e9:	49 89 df             	mov    %rbx,%r15
+  8067ec:	48 b8 51 9b ff ff ff 	movabs $0xffffffffffff9b51,%rax
+  8067f3:	ff ff ff 
+  8067f6:	48 01 d8             	add    %rbx,%rax
+  8067f9:	ff d0                	call   *%rax
+  8067fb:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8067fe:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  806802:	79 08                	jns    80680c <spawn+0x62>
+		return r;
+  806804:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806807:	e9 9e 04 00 00       	jmp    806caa <spawn+0x500>
+	fd = r;
+  80680c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80680f:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+  806812:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+  806819:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  80681d:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+  806824:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  806827:	ba 00 02 00 00       	mov    $0x200,%edx
+  80682c:	48 89 ce             	mov    %rcx,%rsi
+  80682f:	89 c7                	mov    %eax,%edi
+  806831:	49 89 df             	mov    %rbx,%r15
+  806834:	48 b8 95 94 ff ff ff 	movabs $0xffffffffffff9495,%rax
+  80683b:	ff ff ff 
+  80683e:	48 01 d8             	add    %rbx,%rax
+  806841:	ff d0                	call   *%rax
+  806843:	3d 00 02 00 00       	cmp    $0x200,%eax
+  806848:	75 0d                	jne    806857 <spawn+0xad>
+            || elf->e_magic != ELF_MAGIC) {
+  80684a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80684e:	8b 00                	mov    (%rax),%eax
+  806850:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  806855:	74 56                	je     8068ad <spawn+0x103>
+		close(fd);
+  806857:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80685a:	89 c7                	mov    %eax,%edi
+  80685c:	49 89 df             	mov    %rbx,%r15
+  80685f:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  806866:	ff ff ff 
+  806869:	48 01 d8             	add    %rbx,%rax
+  80686c:	ff d0                	call   *%rax
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80686e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806872:	8b 00                	mov    (%rax),%eax
+  806874:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  806879:	89 c6                	mov    %eax,%esi
+  80687b:	48 b8 80 e1 ff ff ff 	movabs $0xffffffffffffe180,%rax
+  806882:	ff ff ff 
+  806885:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806889:	48 89 c7             	mov    %rax,%rdi
+  80688c:	49 89 df             	mov    %rbx,%r15
+  80688f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806894:	48 b9 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%rcx
+  80689b:	ff ff ff 
+  80689e:	48 01 d9             	add    %rbx,%rcx
+  8068a1:	ff d1                	call   *%rcx
+		return -E_NOT_EXEC;
+  8068a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8068a8:	e9 fd 03 00 00       	jmp    806caa <spawn+0x500>
+	__asm __volatile("int %2"
+  8068ad:	b8 07 00 00 00       	mov    $0x7,%eax
+  8068b2:	cd 30                	int    $0x30
+  8068b4:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	return ret;
+  8068b7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8068ba:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8068bd:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8068c1:	79 08                	jns    8068cb <spawn+0x121>
+		return r;
+  8068c3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8068c6:	e9 df 03 00 00       	jmp    806caa <spawn+0x500>
+	child = r;
+  8068cb:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8068ce:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8068d1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8068d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8068d9:	89 c1                	mov    %eax,%ecx
+  8068db:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8068e2:	ff ff ff 
+  8068e5:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  8068e9:	48 63 c1             	movslq %ecx,%rax
+  8068ec:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8068f3:	48 01 d0             	add    %rdx,%rax
+  8068f6:	48 8b 30             	mov    (%rax),%rsi
+  8068f9:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8068fd:	48 89 b5 00 fd ff ff 	mov    %rsi,-0x300(%rbp)
+  806904:	48 89 bd 08 fd ff ff 	mov    %rdi,-0x2f8(%rbp)
+  80690b:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  80690f:	48 8b 78 18          	mov    0x18(%rax),%rdi
+  806913:	48 89 b5 10 fd ff ff 	mov    %rsi,-0x2f0(%rbp)
+  80691a:	48 89 bd 18 fd ff ff 	mov    %rdi,-0x2e8(%rbp)
+  806921:	48 8b 70 20          	mov    0x20(%rax),%rsi
+  806925:	48 8b 78 28          	mov    0x28(%rax),%rdi
+  806929:	48 89 b5 20 fd ff ff 	mov    %rsi,-0x2e0(%rbp)
+  806930:	48 89 bd 28 fd ff ff 	mov    %rdi,-0x2d8(%rbp)
+  806937:	48 8b 70 30          	mov    0x30(%rax),%rsi
+  80693b:	48 8b 78 38          	mov    0x38(%rax),%rdi
+  80693f:	48 89 b5 30 fd ff ff 	mov    %rsi,-0x2d0(%rbp)
+  806946:	48 89 bd 38 fd ff ff 	mov    %rdi,-0x2c8(%rbp)
+  80694d:	48 8b 70 40          	mov    0x40(%rax),%rsi
+  806951:	48 8b 78 48          	mov    0x48(%rax),%rdi
+  806955:	48 89 b5 40 fd ff ff 	mov    %rsi,-0x2c0(%rbp)
+  80695c:	48 89 bd 48 fd ff ff 	mov    %rdi,-0x2b8(%rbp)
+  806963:	48 8b 70 50          	mov    0x50(%rax),%rsi
+  806967:	48 8b 78 58          	mov    0x58(%rax),%rdi
+  80696b:	48 89 b5 50 fd ff ff 	mov    %rsi,-0x2b0(%rbp)
+  806972:	48 89 bd 58 fd ff ff 	mov    %rdi,-0x2a8(%rbp)
+  806979:	48 8b 70 60          	mov    0x60(%rax),%rsi
+  80697d:	48 8b 78 68          	mov    0x68(%rax),%rdi
+  806981:	48 89 b5 60 fd ff ff 	mov    %rsi,-0x2a0(%rbp)
+  806988:	48 89 bd 68 fd ff ff 	mov    %rdi,-0x298(%rbp)
+  80698f:	48 8b 70 70          	mov    0x70(%rax),%rsi
+  806993:	48 8b 78 78          	mov    0x78(%rax),%rdi
+  806997:	48 89 b5 70 fd ff ff 	mov    %rsi,-0x290(%rbp)
+  80699e:	48 89 bd 78 fd ff ff 	mov    %rdi,-0x288(%rbp)
+  8069a5:	48 8b b0 80 00 00 00 	mov    0x80(%rax),%rsi
+  8069ac:	48 8b b8 88 00 00 00 	mov    0x88(%rax),%rdi
+  8069b3:	48 89 b5 80 fd ff ff 	mov    %rsi,-0x280(%rbp)
+  8069ba:	48 89 bd 88 fd ff ff 	mov    %rdi,-0x278(%rbp)
+  8069c1:	48 8b b0 90 00 00 00 	mov    0x90(%rax),%rsi
+  8069c8:	48 8b b8 98 00 00 00 	mov    0x98(%rax),%rdi
+  8069cf:	48 89 b5 90 fd ff ff 	mov    %rsi,-0x270(%rbp)
+  8069d6:	48 89 bd 98 fd ff ff 	mov    %rdi,-0x268(%rbp)
+  8069dd:	48 8b b0 a0 00 00 00 	mov    0xa0(%rax),%rsi
+  8069e4:	48 8b b8 a8 00 00 00 	mov    0xa8(%rax),%rdi
+  8069eb:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  8069f2:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  8069f9:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  806a00:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  806a07:	48 89 85 b0 fd ff ff 	mov    %rax,-0x250(%rbp)
+  806a0e:	48 89 95 b8 fd ff ff 	mov    %rdx,-0x248(%rbp)
+	child_tf.tf_rip = elf->e_entry;
+  806a15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806a19:	48 8b 40 18          	mov    0x18(%rax),%rax
+  806a1d:	48 89 85 98 fd ff ff 	mov    %rax,-0x268(%rbp)
+
+	if ((r = init_stack(child, argv, &child_tf.tf_rsp)) < 0)
+  806a24:	48 8d 85 00 fd ff ff 	lea    -0x300(%rbp),%rax
+  806a2b:	48 8d 90 b0 00 00 00 	lea    0xb0(%rax),%rdx
+  806a32:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  806a39:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  806a3c:	48 89 ce             	mov    %rcx,%rsi
+  806a3f:	89 c7                	mov    %eax,%edi
+  806a41:	48 b8 f0 ae ff ff ff 	movabs $0xffffffffffffaef0,%rax
+  806a48:	ff ff ff 
+  806a4b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806a4f:	ff d0                	call   *%rax
+  806a51:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  806a54:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  806a58:	79 08                	jns    806a62 <spawn+0x2b8>
+		return r;
+  806a5a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806a5d:	e9 48 02 00 00       	jmp    806caa <spawn+0x500>
+
+	// Set up program segments as defined in ELF header.
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  806a62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806a66:	48 8b 40 20          	mov    0x20(%rax),%rax
+  806a6a:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  806a71:	48 01 d0             	add    %rdx,%rax
+  806a74:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  806a78:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806a7f:	e9 84 00 00 00       	jmp    806b08 <spawn+0x35e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  806a84:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a88:	8b 00                	mov    (%rax),%eax
+  806a8a:	83 f8 01             	cmp    $0x1,%eax
+  806a8d:	75 6f                	jne    806afe <spawn+0x354>
+			continue;
+		perm = PTE_P | PTE_U;
+  806a8f:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  806a96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a9a:	8b 40 04             	mov    0x4(%rax),%eax
+  806a9d:	83 e0 02             	and    $0x2,%eax
+  806aa0:	85 c0                	test   %eax,%eax
+  806aa2:	74 04                	je     806aa8 <spawn+0x2fe>
+			perm |= PTE_W;
+  806aa4:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+				     fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  806aa8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806aac:	48 8b 40 08          	mov    0x8(%rax),%rax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  806ab0:	41 89 c1             	mov    %eax,%r9d
+  806ab3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ab7:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  806abb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806abf:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  806ac3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806ac7:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  806acb:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  806ace:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  806ad1:	48 83 ec 08          	sub    $0x8,%rsp
+  806ad5:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  806ad8:	57                   	push   %rdi
+  806ad9:	89 c7                	mov    %eax,%edi
+  806adb:	48 b8 02 b2 ff ff ff 	movabs $0xffffffffffffb202,%rax
+  806ae2:	ff ff ff 
+  806ae5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806ae9:	ff d0                	call   *%rax
+  806aeb:	48 83 c4 10          	add    $0x10,%rsp
+  806aef:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  806af2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  806af6:	0f 88 7c 01 00 00    	js     806c78 <spawn+0x4ce>
+  806afc:	eb 01                	jmp    806aff <spawn+0x355>
+			continue;
+  806afe:	90                   	nop
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  806aff:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806b03:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  806b08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806b0c:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  806b10:	0f b7 c0             	movzwl %ax,%eax
+  806b13:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  806b16:	0f 8c 68 ff ff ff    	jl     806a84 <spawn+0x2da>
+			goto error;
+	}
+	close(fd);
+  806b1c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  806b1f:	89 c7                	mov    %eax,%edi
+  806b21:	49 89 df             	mov    %rbx,%r15
+  806b24:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  806b2b:	ff ff ff 
+  806b2e:	48 01 d8             	add    %rbx,%rax
+  806b31:	ff d0                	call   *%rax
+	fd = -1;
+  806b33:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+	// Copy shared library state.
+	if ((r = copy_shared_pages(child)) < 0)
+  806b3a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  806b3d:	89 c7                	mov    %eax,%edi
+  806b3f:	48 b8 c9 b6 ff ff ff 	movabs $0xffffffffffffb6c9,%rax
+  806b46:	ff ff ff 
+  806b49:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b4d:	ff d0                	call   *%rax
+  806b4f:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  806b52:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  806b56:	79 44                	jns    806b9c <spawn+0x3f2>
+		panic("copy_shared_pages: %e", r);
+  806b58:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806b5b:	89 c1                	mov    %eax,%ecx
+  806b5d:	48 b8 9a e1 ff ff ff 	movabs $0xffffffffffffe19a,%rax
+  806b64:	ff ff ff 
+  806b67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b6b:	48 89 c2             	mov    %rax,%rdx
+  806b6e:	be 82 00 00 00       	mov    $0x82,%esi
+  806b73:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  806b7a:	ff ff ff 
+  806b7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806b81:	48 89 c7             	mov    %rax,%rdi
+  806b84:	49 89 df             	mov    %rbx,%r15
+  806b87:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b8c:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  806b93:	ff ff ff 
+  806b96:	49 01 d8             	add    %rbx,%r8
+  806b99:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  806b9c:	48 8d 95 00 fd ff ff 	lea    -0x300(%rbp),%rdx
+  806ba3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  806ba6:	48 89 d6             	mov    %rdx,%rsi
+  806ba9:	89 c7                	mov    %eax,%edi
+  806bab:	49 89 df             	mov    %rbx,%r15
+  806bae:	48 b8 22 78 ff ff ff 	movabs $0xffffffffffff7822,%rax
+  806bb5:	ff ff ff 
+  806bb8:	48 01 d8             	add    %rbx,%rax
+  806bbb:	ff d0                	call   *%rax
+  806bbd:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  806bc0:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  806bc4:	79 44                	jns    806c0a <spawn+0x460>
+		panic("sys_env_set_trapframe: %e", r);
+  806bc6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806bc9:	89 c1                	mov    %eax,%ecx
+  806bcb:	48 b8 bc e1 ff ff ff 	movabs $0xffffffffffffe1bc,%rax
+  806bd2:	ff ff ff 
+  806bd5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806bd9:	48 89 c2             	mov    %rax,%rdx
+  806bdc:	be 85 00 00 00       	mov    $0x85,%esi
+  806be1:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  806be8:	ff ff ff 
+  806beb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806bef:	48 89 c7             	mov    %rax,%rdi
+  806bf2:	49 89 df             	mov    %rbx,%r15
+  806bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  806bfa:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  806c01:	ff ff ff 
+  806c04:	49 01 d8             	add    %rbx,%r8
+  806c07:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  806c0a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  806c0d:	be 02 00 00 00       	mov    $0x2,%esi
+  806c12:	89 c7                	mov    %eax,%edi
+  806c14:	49 89 df             	mov    %rbx,%r15
+  806c17:	48 b8 c2 77 ff ff ff 	movabs $0xffffffffffff77c2,%rax
+  806c1e:	ff ff ff 
+  806c21:	48 01 d8             	add    %rbx,%rax
+  806c24:	ff d0                	call   *%rax
+  806c26:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  806c29:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  806c2d:	79 44                	jns    806c73 <spawn+0x4c9>
+		panic("sys_env_set_status: %e", r);
+  806c2f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806c32:	89 c1                	mov    %eax,%ecx
+  806c34:	48 b8 d6 e1 ff ff ff 	movabs $0xffffffffffffe1d6,%rax
+  806c3b:	ff ff ff 
+  806c3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806c42:	48 89 c2             	mov    %rax,%rdx
+  806c45:	be 88 00 00 00       	mov    $0x88,%esi
+  806c4a:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  806c51:	ff ff ff 
+  806c54:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806c58:	48 89 c7             	mov    %rax,%rdi
+  806c5b:	49 89 df             	mov    %rbx,%r15
+  806c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c63:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  806c6a:	ff ff ff 
+  806c6d:	49 01 d8             	add    %rbx,%r8
+  806c70:	41 ff d0             	call   *%r8
+
+	return child;
+  806c73:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  806c76:	eb 32                	jmp    806caa <spawn+0x500>
+			goto error;
+  806c78:	90                   	nop
+
+error:
+	sys_env_destroy(child);
+  806c79:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  806c7c:	89 c7                	mov    %eax,%edi
+  806c7e:	49 89 df             	mov    %rbx,%r15
+  806c81:	48 b8 86 75 ff ff ff 	movabs $0xffffffffffff7586,%rax
+  806c88:	ff ff ff 
+  806c8b:	48 01 d8             	add    %rbx,%rax
+  806c8e:	ff d0                	call   *%rax
+	close(fd);
+  806c90:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  806c93:	89 c7                	mov    %eax,%edi
+  806c95:	49 89 df             	mov    %rbx,%r15
+  806c98:	48 b8 ca 90 ff ff ff 	movabs $0xffffffffffff90ca,%rax
+  806c9f:	ff ff ff 
+  806ca2:	48 01 d8             	add    %rbx,%rax
+  806ca5:	ff d0                	call   *%rax
+	return r;
+  806ca7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  806caa:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  806cae:	5b                   	pop    %rbx
+  806caf:	41 5f                	pop    %r15
+  806cb1:	5d                   	pop    %rbp
+  806cb2:	c3                   	ret
+
+0000000000806cb3 <spawnl>:
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...)
+{
+  806cb3:	55                   	push   %rbp
+  806cb4:	48 89 e5             	mov    %rsp,%rbp
+  806cb7:	41 57                	push   %r15
+  806cb9:	41 56                	push   %r14
+  806cbb:	41 55                	push   %r13
+  806cbd:	41 54                	push   %r12
+  806cbf:	53                   	push   %rbx
+  806cc0:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  806cc7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 806cc7 <spawnl+0x14>
+  806cce:	49 bb 81 53 00 00 00 	movabs $0x5381,%r11
+  806cd5:	00 00 00 
+  806cd8:	4d 01 da             	add    %r11,%r10
+  806cdb:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  806ce2:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  806ce9:	48 89 95 30 ff ff ff 	mov    %rdx,-0xd0(%rbp)
+  806cf0:	48 89 8d 38 ff ff ff 	mov    %rcx,-0xc8(%rbp)
+  806cf7:	4c 89 85 40 ff ff ff 	mov    %r8,-0xc0(%rbp)
+  806cfe:	4c 89 8d 48 ff ff ff 	mov    %r9,-0xb8(%rbp)
+  806d05:	84 c0                	test   %al,%al
+  806d07:	74 29                	je     806d32 <spawnl+0x7f>
+  806d09:	0f 29 85 50 ff ff ff 	movaps %xmm0,-0xb0(%rbp)
+  806d10:	0f 29 8d 60 ff ff ff 	movaps %xmm1,-0xa0(%rbp)
+  806d17:	0f 29 95 70 ff ff ff 	movaps %xmm2,-0x90(%rbp)
+  806d1e:	0f 29 5d 80          	movaps %xmm3,-0x80(%rbp)
+  806d22:	0f 29 65 90          	movaps %xmm4,-0x70(%rbp)
+  806d26:	0f 29 6d a0          	movaps %xmm5,-0x60(%rbp)
+  806d2a:	0f 29 75 b0          	movaps %xmm6,-0x50(%rbp)
+  806d2e:	0f 29 7d c0          	movaps %xmm7,-0x40(%rbp)
+  806d32:	48 89 e0             	mov    %rsp,%rax
+  806d35:	48 89 c3             	mov    %rax,%rbx
+	// We calculate argc by advancing the args until we hit NULL.
+	// The contract of the function guarantees that the last
+	// argument will always be NULL, and that none of the other
+	// arguments will be NULL.
+	int argc=0;
+  806d38:	c7 85 1c ff ff ff 00 	movl   $0x0,-0xe4(%rbp)
+  806d3f:	00 00 00 
+	va_list vl;
+	va_start(vl, arg0);
+  806d42:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  806d49:	00 00 00 
+  806d4c:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  806d53:	00 00 00 
+  806d56:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  806d5a:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  806d61:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  806d68:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  806d6f:	eb 07                	jmp    806d78 <spawnl+0xc5>
+		argc++;
+  806d71:	83 85 1c ff ff ff 01 	addl   $0x1,-0xe4(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  806d78:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  806d7e:	83 f8 2f             	cmp    $0x2f,%eax
+  806d81:	77 23                	ja     806da6 <spawnl+0xf3>
+  806d83:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  806d8a:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  806d90:	89 d2                	mov    %edx,%edx
+  806d92:	48 01 d0             	add    %rdx,%rax
+  806d95:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  806d9b:	83 c2 08             	add    $0x8,%edx
+  806d9e:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  806da4:	eb 12                	jmp    806db8 <spawnl+0x105>
+  806da6:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  806dad:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  806db1:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  806db8:	48 8b 00             	mov    (%rax),%rax
+  806dbb:	48 85 c0             	test   %rax,%rax
+  806dbe:	75 b1                	jne    806d71 <spawnl+0xbe>
+	va_end(vl);
+
+	// Now that we have the size of the args, do a second pass
+	// and store the values in a VLA, which has the format of argv
+	const char *argv[argc+2];
+  806dc0:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  806dc6:	83 c0 02             	add    $0x2,%eax
+  806dc9:	48 63 d0             	movslq %eax,%rdx
+  806dcc:	48 83 ea 01          	sub    $0x1,%rdx
+  806dd0:	48 89 95 10 ff ff ff 	mov    %rdx,-0xf0(%rbp)
+  806dd7:	48 63 d0             	movslq %eax,%rdx
+  806dda:	49 89 d6             	mov    %rdx,%r14
+  806ddd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  806de3:	48 63 d0             	movslq %eax,%rdx
+  806de6:	49 89 d4             	mov    %rdx,%r12
+  806de9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  806def:	48 98                	cltq
+  806df1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  806df8:	00 
+  806df9:	b8 10 00 00 00       	mov    $0x10,%eax
+  806dfe:	48 83 e8 01          	sub    $0x1,%rax
+  806e02:	48 01 d0             	add    %rdx,%rax
+  806e05:	be 10 00 00 00       	mov    $0x10,%esi
+  806e0a:	ba 00 00 00 00       	mov    $0x0,%edx
+  806e0f:	48 f7 f6             	div    %rsi
+  806e12:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  806e16:	48 29 c4             	sub    %rax,%rsp
+  806e19:	48 89 e0             	mov    %rsp,%rax
+  806e1c:	48 83 c0 07          	add    $0x7,%rax
+  806e20:	48 c1 e8 03          	shr    $0x3,%rax
+  806e24:	48 c1 e0 03          	shl    $0x3,%rax
+  806e28:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+	argv[0] = arg0;
+  806e2f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  806e36:	48 8b 95 e0 fe ff ff 	mov    -0x120(%rbp),%rdx
+  806e3d:	48 89 10             	mov    %rdx,(%rax)
+	argv[argc+1] = NULL;
+  806e40:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  806e46:	8d 50 01             	lea    0x1(%rax),%edx
+  806e49:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  806e50:	48 63 d2             	movslq %edx,%rdx
+  806e53:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  806e5a:	00 
+
+	va_start(vl, arg0);
+  806e5b:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  806e62:	00 00 00 
+  806e65:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  806e6c:	00 00 00 
+  806e6f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  806e73:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  806e7a:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  806e81:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	unsigned i;
+	for(i=0;i<argc;i++)
+  806e88:	c7 85 18 ff ff ff 00 	movl   $0x0,-0xe8(%rbp)
+  806e8f:	00 00 00 
+  806e92:	eb 60                	jmp    806ef4 <spawnl+0x241>
+		argv[i+1] = va_arg(vl, const char *);
+  806e94:	8b 85 18 ff ff ff    	mov    -0xe8(%rbp),%eax
+  806e9a:	8d 48 01             	lea    0x1(%rax),%ecx
+  806e9d:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  806ea3:	83 f8 2f             	cmp    $0x2f,%eax
+  806ea6:	77 23                	ja     806ecb <spawnl+0x218>
+  806ea8:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  806eaf:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  806eb5:	89 d2                	mov    %edx,%edx
+  806eb7:	48 01 d0             	add    %rdx,%rax
+  806eba:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  806ec0:	83 c2 08             	add    $0x8,%edx
+  806ec3:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  806ec9:	eb 12                	jmp    806edd <spawnl+0x22a>
+  806ecb:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  806ed2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  806ed6:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  806edd:	48 8b 10             	mov    (%rax),%rdx
+  806ee0:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  806ee7:	89 c9                	mov    %ecx,%ecx
+  806ee9:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+	for(i=0;i<argc;i++)
+  806eed:	83 85 18 ff ff ff 01 	addl   $0x1,-0xe8(%rbp)
+  806ef4:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  806efa:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%rbp)
+  806f00:	72 92                	jb     806e94 <spawnl+0x1e1>
+	va_end(vl);
+	return spawn(prog, argv);
+  806f02:	48 8b 95 08 ff ff ff 	mov    -0xf8(%rbp),%rdx
+  806f09:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  806f10:	48 89 d6             	mov    %rdx,%rsi
+  806f13:	48 89 c7             	mov    %rax,%rdi
+  806f16:	48 b8 62 a7 ff ff ff 	movabs $0xffffffffffffa762,%rax
+  806f1d:	ff ff ff 
+  806f20:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  806f24:	ff d0                	call   *%rax
+  806f26:	48 89 dc             	mov    %rbx,%rsp
+}
+  806f29:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  806f2d:	5b                   	pop    %rbx
+  806f2e:	41 5c                	pop    %r12
+  806f30:	41 5d                	pop    %r13
+  806f32:	41 5e                	pop    %r14
+  806f34:	41 5f                	pop    %r15
+  806f36:	5d                   	pop    %rbp
+  806f37:	c3                   	ret
+
+0000000000806f38 <init_stack>:
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp)
+{
+  806f38:	55                   	push   %rbp
+  806f39:	48 89 e5             	mov    %rsp,%rbp
+  806f3c:	41 57                	push   %r15
+  806f3e:	53                   	push   %rbx
+  806f3f:	48 83 ec 50          	sub    $0x50,%rsp
+  806f43:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806f43 <init_stack+0xb>
+  806f4a:	49 bb 05 51 00 00 00 	movabs $0x5105,%r11
+  806f51:	00 00 00 
+  806f54:	4c 01 db             	add    %r11,%rbx
+  806f57:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  806f5a:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  806f5e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *string_store;
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+  806f62:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806f69:	00 
+	for (argc = 0; argv[argc] != 0; argc++)
+  806f6a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  806f71:	eb 39                	jmp    806fac <init_stack+0x74>
+		string_size += strlen(argv[argc]) + 1;
+  806f73:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806f76:	48 98                	cltq
+  806f78:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  806f7f:	00 
+  806f80:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806f84:	48 01 d0             	add    %rdx,%rax
+  806f87:	48 8b 00             	mov    (%rax),%rax
+  806f8a:	48 89 c7             	mov    %rax,%rdi
+  806f8d:	49 89 df             	mov    %rbx,%r15
+  806f90:	48 b8 3b 69 ff ff ff 	movabs $0xffffffffffff693b,%rax
+  806f97:	ff ff ff 
+  806f9a:	48 01 d8             	add    %rbx,%rax
+  806f9d:	ff d0                	call   *%rax
+  806f9f:	83 c0 01             	add    $0x1,%eax
+  806fa2:	48 98                	cltq
+  806fa4:	48 01 45 e8          	add    %rax,-0x18(%rbp)
+	for (argc = 0; argv[argc] != 0; argc++)
+  806fa8:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  806fac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806faf:	48 98                	cltq
+  806fb1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  806fb8:	00 
+  806fb9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806fbd:	48 01 d0             	add    %rdx,%rax
+  806fc0:	48 8b 00             	mov    (%rax),%rax
+  806fc3:	48 85 c0             	test   %rax,%rax
+  806fc6:	75 ab                	jne    806f73 <init_stack+0x3b>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  806fc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806fcc:	48 f7 d8             	neg    %rax
+  806fcf:	48 05 00 10 40 00    	add    $0x401000,%rax
+  806fd5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  806fd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806fdd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  806fe1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806fe5:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  806fe9:	48 89 c2             	mov    %rax,%rdx
+  806fec:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806fef:	83 c0 01             	add    $0x1,%eax
+  806ff2:	c1 e0 03             	shl    $0x3,%eax
+  806ff5:	48 98                	cltq
+  806ff7:	48 f7 d8             	neg    %rax
+  806ffa:	48 01 d0             	add    %rdx,%rax
+  806ffd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  807001:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807005:	48 83 e8 10          	sub    $0x10,%rax
+  807009:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  80700f:	77 0a                	ja     80701b <init_stack+0xe3>
+		return -E_NO_MEM;
+  807011:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  807016:	e9 26 02 00 00       	jmp    807241 <init_stack+0x309>
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80701b:	ba 07 00 00 00       	mov    $0x7,%edx
+  807020:	be 00 00 40 00       	mov    $0x400000,%esi
+  807025:	bf 00 00 00 00       	mov    $0x0,%edi
+  80702a:	49 89 df             	mov    %rbx,%r15
+  80702d:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  807034:	ff ff ff 
+  807037:	48 01 d8             	add    %rbx,%rax
+  80703a:	ff d0                	call   *%rax
+  80703c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80703f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  807043:	79 08                	jns    80704d <init_stack+0x115>
+		return r;
+  807045:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807048:	e9 f4 01 00 00       	jmp    807241 <init_stack+0x309>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  80704d:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+  807054:	e9 96 00 00 00       	jmp    8070ef <init_stack+0x1b7>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  807059:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  80705e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807062:	48 01 d0             	add    %rdx,%rax
+  807065:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  80706c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80706f:	48 98                	cltq
+  807071:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  807078:	00 
+  807079:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80707d:	48 01 c8             	add    %rcx,%rax
+  807080:	48 89 10             	mov    %rdx,(%rax)
+		strcpy(string_store, argv[i]);
+  807083:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  807086:	48 98                	cltq
+  807088:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80708f:	00 
+  807090:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  807094:	48 01 d0             	add    %rdx,%rax
+  807097:	48 8b 10             	mov    (%rax),%rdx
+  80709a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80709e:	48 89 d6             	mov    %rdx,%rsi
+  8070a1:	48 89 c7             	mov    %rax,%rdi
+  8070a4:	49 89 df             	mov    %rbx,%r15
+  8070a7:	48 b8 cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rax
+  8070ae:	ff ff ff 
+  8070b1:	48 01 d8             	add    %rbx,%rax
+  8070b4:	ff d0                	call   *%rax
+		string_store += strlen(argv[i]) + 1;
+  8070b6:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8070b9:	48 98                	cltq
+  8070bb:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8070c2:	00 
+  8070c3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8070c7:	48 01 d0             	add    %rdx,%rax
+  8070ca:	48 8b 00             	mov    (%rax),%rax
+  8070cd:	48 89 c7             	mov    %rax,%rdi
+  8070d0:	49 89 df             	mov    %rbx,%r15
+  8070d3:	48 b8 3b 69 ff ff ff 	movabs $0xffffffffffff693b,%rax
+  8070da:	ff ff ff 
+  8070dd:	48 01 d8             	add    %rbx,%rax
+  8070e0:	ff d0                	call   *%rax
+  8070e2:	83 c0 01             	add    $0x1,%eax
+  8070e5:	48 98                	cltq
+  8070e7:	48 01 45 d0          	add    %rax,-0x30(%rbp)
+	for (i = 0; i < argc; i++) {
+  8070eb:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+  8070ef:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8070f2:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8070f5:	0f 8c 5e ff ff ff    	jl     807059 <init_stack+0x121>
+	}
+	argv_store[argc] = 0;
+  8070fb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8070fe:	48 98                	cltq
+  807100:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  807107:	00 
+  807108:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80710c:	48 01 d0             	add    %rdx,%rax
+  80710f:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  807116:	48 81 7d d0 00 10 40 	cmpq   $0x401000,-0x30(%rbp)
+  80711d:	00 
+  80711e:	74 50                	je     807170 <init_stack+0x238>
+  807120:	48 b8 f0 e1 ff ff ff 	movabs $0xffffffffffffe1f0,%rax
+  807127:	ff ff ff 
+  80712a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80712e:	48 89 c1             	mov    %rax,%rcx
+  807131:	48 b8 16 e2 ff ff ff 	movabs $0xffffffffffffe216,%rax
+  807138:	ff ff ff 
+  80713b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80713f:	48 89 c2             	mov    %rax,%rdx
+  807142:	be f1 00 00 00       	mov    $0xf1,%esi
+  807147:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  80714e:	ff ff ff 
+  807151:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807155:	48 89 c7             	mov    %rax,%rdi
+  807158:	49 89 df             	mov    %rbx,%r15
+  80715b:	b8 00 00 00 00       	mov    $0x0,%eax
+  807160:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  807167:	ff ff ff 
+  80716a:	49 01 d8             	add    %rbx,%r8
+  80716d:	41 ff d0             	call   *%r8
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  807170:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  807175:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807179:	48 01 d0             	add    %rdx,%rax
+  80717c:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  807183:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807187:	48 83 e8 08          	sub    $0x8,%rax
+  80718b:	48 89 10             	mov    %rdx,(%rax)
+	argv_store[-2] = argc;
+  80718e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  807192:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  807196:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807199:	48 98                	cltq
+  80719b:	48 89 02             	mov    %rax,(%rdx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  80719e:	ba f0 cf 7f ef       	mov    $0xef7fcff0,%edx
+  8071a3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8071a7:	48 01 d0             	add    %rdx,%rax
+  8071aa:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  8071b0:	48 89 c2             	mov    %rax,%rdx
+  8071b3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8071b7:	48 89 10             	mov    %rdx,(%rax)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8071ba:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8071bd:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8071c3:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  8071c8:	48 89 d1             	mov    %rdx,%rcx
+  8071cb:	89 c2                	mov    %eax,%edx
+  8071cd:	be 00 00 40 00       	mov    $0x400000,%esi
+  8071d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8071d7:	49 89 df             	mov    %rbx,%r15
+  8071da:	48 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rax
+  8071e1:	ff ff ff 
+  8071e4:	48 01 d8             	add    %rbx,%rax
+  8071e7:	ff d0                	call   *%rax
+  8071e9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8071ec:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8071f0:	78 2c                	js     80721e <init_stack+0x2e6>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  8071f2:	be 00 00 40 00       	mov    $0x400000,%esi
+  8071f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8071fc:	49 89 df             	mov    %rbx,%r15
+  8071ff:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  807206:	ff ff ff 
+  807209:	48 01 d8             	add    %rbx,%rax
+  80720c:	ff d0                	call   *%rax
+  80720e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  807211:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  807215:	78 0a                	js     807221 <init_stack+0x2e9>
+		goto error;
+
+	return 0;
+  807217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80721c:	eb 23                	jmp    807241 <init_stack+0x309>
+		goto error;
+  80721e:	90                   	nop
+  80721f:	eb 01                	jmp    807222 <init_stack+0x2ea>
+		goto error;
+  807221:	90                   	nop
+
+error:
+	sys_page_unmap(0, UTEMP);
+  807222:	be 00 00 40 00       	mov    $0x400000,%esi
+  807227:	bf 00 00 00 00       	mov    $0x0,%edi
+  80722c:	49 89 df             	mov    %rbx,%r15
+  80722f:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  807236:	ff ff ff 
+  807239:	48 01 d8             	add    %rbx,%rax
+  80723c:	ff d0                	call   *%rax
+	return r;
+  80723e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+}
+  807241:	48 83 c4 50          	add    $0x50,%rsp
+  807245:	5b                   	pop    %rbx
+  807246:	41 5f                	pop    %r15
+  807248:	5d                   	pop    %rbp
+  807249:	c3                   	ret
+
+000000000080724a <map_segment>:
+#define SEG_BATCH	PAGE_BATCH_CHUNK
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+	    int fd, size_t filesz, off_t fileoffset, int perm)
+{
+  80724a:	55                   	push   %rbp
+  80724b:	48 89 e5             	mov    %rsp,%rbp
+  80724e:	41 57                	push   %r15
+  807250:	53                   	push   %rbx
+  807251:	48 81 ec 70 0c 00 00 	sub    $0xc70,%rsp
+  807258:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807258 <map_segment+0xe>
+  80725f:	49 bb f0 4d 00 00 00 	movabs $0x4df0,%r11
+  807266:	00 00 00 
+  807269:	4c 01 db             	add    %r11,%rbx
+  80726c:	89 bd ac f3 ff ff    	mov    %edi,-0xc54(%rbp)
+  807272:	48 89 b5 a0 f3 ff ff 	mov    %rsi,-0xc60(%rbp)
+  807279:	48 89 95 98 f3 ff ff 	mov    %rdx,-0xc68(%rbp)
+  807280:	89 8d a8 f3 ff ff    	mov    %ecx,-0xc58(%rbp)
+  807286:	4c 89 85 90 f3 ff ff 	mov    %r8,-0xc70(%rbp)
+  80728d:	44 89 8d 8c f3 ff ff 	mov    %r9d,-0xc74(%rbp)
+	int i, j, n, nfile, r;
+	void *tmp;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  807294:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  80729b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8072a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8072a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8072a7:	74 2d                	je     8072d6 <map_segment+0x8c>
+		va -= i;
+  8072a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8072ac:	48 98                	cltq
+  8072ae:	48 29 85 a0 f3 ff ff 	sub    %rax,-0xc60(%rbp)
+		memsz += i;
+  8072b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8072b8:	48 98                	cltq
+  8072ba:	48 01 85 98 f3 ff ff 	add    %rax,-0xc68(%rbp)
+		filesz += i;
+  8072c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8072c4:	48 98                	cltq
+  8072c6:	48 01 85 90 f3 ff ff 	add    %rax,-0xc70(%rbp)
+		fileoffset -= i;
+  8072cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8072d0:	29 85 8c f3 ff ff    	sub    %eax,-0xc74(%rbp)
+	}
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  8072d6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8072dd:	e9 db 03 00 00       	jmp    8076bd <map_segment+0x473>
+		n = MIN((memsz - i + PGSIZE - 1) / PGSIZE, SEG_BATCH);
+  8072e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8072e5:	48 98                	cltq
+  8072e7:	48 8b 95 98 f3 ff ff 	mov    -0xc68(%rbp),%rdx
+  8072ee:	48 29 c2             	sub    %rax,%rdx
+  8072f1:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  8072f8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8072fc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  807300:	c7 45 d4 20 00 00 00 	movl   $0x20,-0x2c(%rbp)
+  807307:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80730a:	48 63 d0             	movslq %eax,%rdx
+  80730d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807311:	48 39 c2             	cmp    %rax,%rdx
+  807314:	48 0f 46 c2          	cmovbe %rdx,%rax
+  807318:	89 45 d0             	mov    %eax,-0x30(%rbp)
+
+		// Allocate blank pages straight into the child, and pages
+		// for the file's contents at UTEMP in our address space.
+		nfile = 0;
+  80731b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+		for (j = 0; j < n; j++) {
+  807322:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  807329:	e9 ea 01 00 00       	jmp    807518 <map_segment+0x2ce>
+			if (i + j * PGSIZE < filesz) {
+  80732e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  807331:	c1 e0 0c             	shl    $0xc,%eax
+  807334:	89 c2                	mov    %eax,%edx
+  807336:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807339:	01 d0                	add    %edx,%eax
+  80733b:	48 98                	cltq
+  80733d:	48 3b 85 90 f3 ff ff 	cmp    -0xc70(%rbp),%rax
+  807344:	0f 83 57 01 00 00    	jae    8074a1 <map_segment+0x257>
+				tmp = UTEMP + nfile * PGSIZE;
+  80734a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80734d:	c1 e0 0c             	shl    $0xc,%eax
+  807350:	48 98                	cltq
+  807352:	48 05 00 00 40 00    	add    $0x400000,%rax
+  807358:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+				alloc[j].dstenvid = 0;
+  80735c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80735f:	48 98                	cltq
+  807361:	48 c1 e0 05          	shl    $0x5,%rax
+  807365:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807369:	48 01 e8             	add    %rbp,%rax
+  80736c:	48 2d 3c 04 00 00    	sub    $0x43c,%rax
+  807372:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				alloc[j].dstva = (uintptr_t) tmp;
+  807378:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80737c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80737f:	48 63 d2             	movslq %edx,%rdx
+  807382:	48 c1 e2 05          	shl    $0x5,%rdx
+  807386:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  80738a:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  80738e:	48 81 ea 30 04 00 00 	sub    $0x430,%rdx
+  807395:	48 89 02             	mov    %rax,(%rdx)
+				alloc[j].perm = PTE_P|PTE_U|PTE_W;
+  807398:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80739b:	48 98                	cltq
+  80739d:	48 c1 e0 05          	shl    $0x5,%rax
+  8073a1:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8073a5:	48 01 e8             	add    %rbp,%rax
+  8073a8:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  8073ae:	c7 00 07 00 00 00    	movl   $0x7,(%rax)
+				map[nfile].srcenvid = 0;
+  8073b4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8073b7:	48 98                	cltq
+  8073b9:	48 c1 e0 05          	shl    $0x5,%rax
+  8073bd:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8073c1:	48 01 e8             	add    %rbp,%rax
+  8073c4:	48 2d 40 08 00 00    	sub    $0x840,%rax
+  8073ca:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				map[nfile].srcva = (uintptr_t) tmp;
+  8073d0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8073d4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8073d7:	48 63 d2             	movslq %edx,%rdx
+  8073da:	48 c1 e2 05          	shl    $0x5,%rdx
+  8073de:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  8073e2:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  8073e6:	48 81 ea 38 08 00 00 	sub    $0x838,%rdx
+  8073ed:	48 89 02             	mov    %rax,(%rdx)
+				map[nfile].dstenvid = child;
+  8073f0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8073f3:	48 98                	cltq
+  8073f5:	48 c1 e0 05          	shl    $0x5,%rax
+  8073f9:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8073fd:	48 01 e8             	add    %rbp,%rax
+  807400:	48 8d 90 c4 f7 ff ff 	lea    -0x83c(%rax),%rdx
+  807407:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  80740d:	89 02                	mov    %eax,(%rdx)
+				map[nfile].dstva = va + i + j * PGSIZE;
+  80740f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807412:	48 63 d0             	movslq %eax,%rdx
+  807415:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  80741c:	48 01 c2             	add    %rax,%rdx
+  80741f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  807422:	c1 e0 0c             	shl    $0xc,%eax
+  807425:	48 98                	cltq
+  807427:	48 01 c2             	add    %rax,%rdx
+  80742a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80742d:	48 98                	cltq
+  80742f:	48 c1 e0 05          	shl    $0x5,%rax
+  807433:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807437:	48 01 e8             	add    %rbp,%rax
+  80743a:	48 2d 30 08 00 00    	sub    $0x830,%rax
+  807440:	48 89 10             	mov    %rdx,(%rax)
+				map[nfile].perm = perm;
+  807443:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807446:	48 98                	cltq
+  807448:	48 c1 e0 05          	shl    $0x5,%rax
+  80744c:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807450:	48 01 e8             	add    %rbp,%rax
+  807453:	48 8d 90 d8 f7 ff ff 	lea    -0x828(%rax),%rdx
+  80745a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80745d:	89 02                	mov    %eax,(%rdx)
+				unmap[nfile].dstenvid = 0;
+  80745f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807462:	48 98                	cltq
+  807464:	48 c1 e0 05          	shl    $0x5,%rax
+  807468:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80746c:	48 01 e8             	add    %rbp,%rax
+  80746f:	48 2d 3c 0c 00 00    	sub    $0xc3c,%rax
+  807475:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				unmap[nfile].dstva = (uintptr_t) tmp;
+  80747b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80747f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  807482:	48 63 d2             	movslq %edx,%rdx
+  807485:	48 c1 e2 05          	shl    $0x5,%rdx
+  807489:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  80748d:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  807491:	48 81 ea 30 0c 00 00 	sub    $0xc30,%rdx
+  807498:	48 89 02             	mov    %rax,(%rdx)
+				nfile++;
+  80749b:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  80749f:	eb 73                	jmp    807514 <map_segment+0x2ca>
+			} else {
+				// Blank (BSS) pages are only allocated
+				// once the child writes to them.
+				alloc[j].dstenvid = child;
+  8074a1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8074a4:	48 98                	cltq
+  8074a6:	48 c1 e0 05          	shl    $0x5,%rax
+  8074aa:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8074ae:	48 01 e8             	add    %rbp,%rax
+  8074b1:	48 8d 90 c4 fb ff ff 	lea    -0x43c(%rax),%rdx
+  8074b8:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  8074be:	89 02                	mov    %eax,(%rdx)
+				alloc[j].dstva = va + i + j * PGSIZE;
+  8074c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8074c3:	48 63 d0             	movslq %eax,%rdx
+  8074c6:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  8074cd:	48 01 c2             	add    %rax,%rdx
+  8074d0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8074d3:	c1 e0 0c             	shl    $0xc,%eax
+  8074d6:	48 98                	cltq
+  8074d8:	48 01 c2             	add    %rax,%rdx
+  8074db:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8074de:	48 98                	cltq
+  8074e0:	48 c1 e0 05          	shl    $0x5,%rax
+  8074e4:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8074e8:	48 01 e8             	add    %rbp,%rax
+  8074eb:	48 2d 30 04 00 00    	sub    $0x430,%rax
+  8074f1:	48 89 10             	mov    %rdx,(%rax)
+				alloc[j].perm = perm | PTE_LAZY;
+  8074f4:	8b 45 10             	mov    0x10(%rbp),%eax
+  8074f7:	80 cc 10             	or     $0x10,%ah
+  8074fa:	89 c2                	mov    %eax,%edx
+  8074fc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8074ff:	48 98                	cltq
+  807501:	48 c1 e0 05          	shl    $0x5,%rax
+  807505:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  807509:	48 01 e8             	add    %rbp,%rax
+  80750c:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  807512:	89 10                	mov    %edx,(%rax)
+		for (j = 0; j < n; j++) {
+  807514:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  807518:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80751b:	3b 45 d0             	cmp    -0x30(%rbp),%eax
+  80751e:	0f 8c 0a fe ff ff    	jl     80732e <map_segment+0xe4>
+			}
+		}
+		if ((r = sys_page_alloc_batch(alloc, n)) < 0)
+  807524:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  807527:	48 63 d0             	movslq %eax,%rdx
+  80752a:	48 8d 85 b0 fb ff ff 	lea    -0x450(%rbp),%rax
+  807531:	48 89 d6             	mov    %rdx,%rsi
+  807534:	48 89 c7             	mov    %rax,%rdi
+  807537:	49 89 df             	mov    %rbx,%r15
+  80753a:	48 b8 24 7d ff ff ff 	movabs $0xffffffffffff7d24,%rax
+  807541:	ff ff ff 
+  807544:	48 01 d8             	add    %rbx,%rax
+  807547:	ff d0                	call   *%rax
+  807549:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80754c:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  807550:	0f 88 80 01 00 00    	js     8076d6 <map_segment+0x48c>
+			goto out;
+
+		// from file
+		for (j = 0; j < nfile; j++) {
+  807556:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  80755d:	e9 af 00 00 00       	jmp    807611 <map_segment+0x3c7>
+			if ((r = seek(fd, fileoffset + i + j * PGSIZE)) < 0)
+  807562:	8b 95 8c f3 ff ff    	mov    -0xc74(%rbp),%edx
+  807568:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80756b:	01 c2                	add    %eax,%edx
+  80756d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  807570:	c1 e0 0c             	shl    $0xc,%eax
+  807573:	01 c2                	add    %eax,%edx
+  807575:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  80757b:	89 d6                	mov    %edx,%esi
+  80757d:	89 c7                	mov    %eax,%edi
+  80757f:	49 89 df             	mov    %rbx,%r15
+  807582:	48 b8 3a 96 ff ff ff 	movabs $0xffffffffffff963a,%rax
+  807589:	ff ff ff 
+  80758c:	48 01 d8             	add    %rbx,%rax
+  80758f:	ff d0                	call   *%rax
+  807591:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  807594:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  807598:	0f 88 3b 01 00 00    	js     8076d9 <map_segment+0x48f>
+				goto out;
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+				       MIN(PGSIZE, filesz - i - j * PGSIZE))) < 0)
+  80759e:	c7 45 cc 00 10 00 00 	movl   $0x1000,-0x34(%rbp)
+  8075a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8075a8:	48 98                	cltq
+  8075aa:	48 8b 95 90 f3 ff ff 	mov    -0xc70(%rbp),%rdx
+  8075b1:	48 29 c2             	sub    %rax,%rdx
+  8075b4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8075b7:	c1 e0 0c             	shl    $0xc,%eax
+  8075ba:	48 98                	cltq
+  8075bc:	48 29 c2             	sub    %rax,%rdx
+  8075bf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8075c3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8075c6:	48 63 d0             	movslq %eax,%rdx
+  8075c9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8075cd:	48 39 c2             	cmp    %rax,%rdx
+  8075d0:	48 0f 47 d0          	cmova  %rax,%rdx
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+  8075d4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8075d7:	c1 e0 0c             	shl    $0xc,%eax
+  8075da:	48 98                	cltq
+  8075dc:	48 8d 88 00 00 40 00 	lea    0x400000(%rax),%rcx
+  8075e3:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  8075e9:	48 89 ce             	mov    %rcx,%rsi
+  8075ec:	89 c7                	mov    %eax,%edi
+  8075ee:	49 89 df             	mov    %rbx,%r15
+  8075f1:	48 b8 95 94 ff ff ff 	movabs $0xffffffffffff9495,%rax
+  8075f8:	ff ff ff 
+  8075fb:	48 01 d8             	add    %rbx,%rax
+  8075fe:	ff d0                	call   *%rax
+  807600:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  807603:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  807607:	0f 88 cf 00 00 00    	js     8076dc <map_segment+0x492>
+		for (j = 0; j < nfile; j++) {
+  80760d:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  807611:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  807614:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  807617:	0f 8c 45 ff ff ff    	jl     807562 <map_segment+0x318>
+				goto out;
+		}
+		if ((r = sys_page_map_batch(map, nfile)) < 0)
+  80761d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807620:	48 63 d0             	movslq %eax,%rdx
+  807623:	48 8d 85 b0 f7 ff ff 	lea    -0x850(%rbp),%rax
+  80762a:	48 89 d6             	mov    %rdx,%rsi
+  80762d:	48 89 c7             	mov    %rax,%rdi
+  807630:	49 89 df             	mov    %rbx,%r15
+  807633:	48 b8 c6 7c ff ff ff 	movabs $0xffffffffffff7cc6,%rax
+  80763a:	ff ff ff 
+  80763d:	48 01 d8             	add    %rbx,%rax
+  807640:	ff d0                	call   *%rax
+  807642:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  807645:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  807649:	79 44                	jns    80768f <map_segment+0x445>
+			panic("spawn: sys_page_map_batch data: %e", r);
+  80764b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80764e:	89 c1                	mov    %eax,%ecx
+  807650:	48 b8 30 e2 ff ff ff 	movabs $0xffffffffffffe230,%rax
+  807657:	ff ff ff 
+  80765a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80765e:	48 89 c2             	mov    %rax,%rdx
+  807661:	be 43 01 00 00       	mov    $0x143,%esi
+  807666:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  80766d:	ff ff ff 
+  807670:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807674:	48 89 c7             	mov    %rax,%rdi
+  807677:	49 89 df             	mov    %rbx,%r15
+  80767a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80767f:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  807686:	ff ff ff 
+  807689:	49 01 d8             	add    %rbx,%r8
+  80768c:	41 ff d0             	call   *%r8
+		sys_page_unmap_batch(unmap, nfile);
+  80768f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807692:	48 63 d0             	movslq %eax,%rdx
+  807695:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  80769c:	48 89 d6             	mov    %rdx,%rsi
+  80769f:	48 89 c7             	mov    %rax,%rdi
+  8076a2:	49 89 df             	mov    %rbx,%r15
+  8076a5:	48 b8 82 7d ff ff ff 	movabs $0xffffffffffff7d82,%rax
+  8076ac:	ff ff ff 
+  8076af:	48 01 d8             	add    %rbx,%rax
+  8076b2:	ff d0                	call   *%rax
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  8076b4:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8076b7:	c1 e0 0c             	shl    $0xc,%eax
+  8076ba:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8076bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8076c0:	48 98                	cltq
+  8076c2:	48 3b 85 98 f3 ff ff 	cmp    -0xc68(%rbp),%rax
+  8076c9:	0f 82 13 fc ff ff    	jb     8072e2 <map_segment+0x98>
+	}
+	return 0;
+  8076cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8076d4:	eb 2f                	jmp    807705 <map_segment+0x4bb>
+			goto out;
+  8076d6:	90                   	nop
+  8076d7:	eb 04                	jmp    8076dd <map_segment+0x493>
+				goto out;
+  8076d9:	90                   	nop
+  8076da:	eb 01                	jmp    8076dd <map_segment+0x493>
+				goto out;
+  8076dc:	90                   	nop
+
+out:
+	sys_page_unmap_batch(unmap, nfile);
+  8076dd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8076e0:	48 63 d0             	movslq %eax,%rdx
+  8076e3:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  8076ea:	48 89 d6             	mov    %rdx,%rsi
+  8076ed:	48 89 c7             	mov    %rax,%rdi
+  8076f0:	49 89 df             	mov    %rbx,%r15
+  8076f3:	48 b8 82 7d ff ff ff 	movabs $0xffffffffffff7d82,%rax
+  8076fa:	ff ff ff 
+  8076fd:	48 01 d8             	add    %rbx,%rax
+  807700:	ff d0                	call   *%rax
+	return r;
+  807702:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  807705:	48 81 c4 70 0c 00 00 	add    $0xc70,%rsp
+  80770c:	5b                   	pop    %rbx
+  80770d:	41 5f                	pop    %r15
+  80770f:	5d                   	pop    %rbp
+  807710:	c3                   	ret
+
+0000000000807711 <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  807711:	55                   	push   %rbp
+  807712:	48 89 e5             	mov    %rsp,%rbp
+  807715:	41 57                	push   %r15
+  807717:	53                   	push   %rbx
+  807718:	48 83 ec 30          	sub    $0x30,%rsp
+  80771c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80771c <copy_shared_pages+0xb>
+  807723:	49 bb 2c 49 00 00 00 	movabs $0x492c,%r11
+  80772a:	00 00 00 
+  80772d:	4c 01 db             	add    %r11,%rbx
+  807730:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	int r;
+	uint64_t addr = 0;
+  807733:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80773a:	00 
+	for (; addr < USTACKTOP;){
+  80773b:	e9 7f 02 00 00       	jmp    8079bf <copy_shared_pages+0x2ae>
+		if (uvpde[VPDPE(addr)] & PTE_P){
+  807740:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807744:	48 c1 e8 1e          	shr    $0x1e,%rax
+  807748:	48 89 c2             	mov    %rax,%rdx
+  80774b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  807752:	ff ff ff 
+  807755:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807759:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80775d:	83 e0 01             	and    $0x1,%eax
+  807760:	48 85 c0             	test   %rax,%rax
+  807763:	0f 84 4e 02 00 00    	je     8079b7 <copy_shared_pages+0x2a6>
+			//a 2MB page is described by its PDE, not by uvpt
+			if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  807769:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80776d:	48 c1 e8 15          	shr    $0x15,%rax
+  807771:	48 89 c2             	mov    %rax,%rdx
+  807774:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80777b:	ff ff ff 
+  80777e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807782:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807786:	25 81 00 00 00       	and    $0x81,%eax
+  80778b:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  807791:	0f 85 cf 00 00 00    	jne    807866 <copy_shared_pages+0x155>
+				if (uvpd[VPD(addr)] & PTE_SHARE){
+  807797:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80779b:	48 c1 e8 15          	shr    $0x15,%rax
+  80779f:	48 89 c2             	mov    %rax,%rdx
+  8077a2:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8077a9:	ff ff ff 
+  8077ac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8077b0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8077b4:	25 00 04 00 00       	and    $0x400,%eax
+  8077b9:	48 85 c0             	test   %rax,%rax
+  8077bc:	0f 84 97 00 00 00    	je     807859 <copy_shared_pages+0x148>
+					unsigned int perm = uvpd[VPD(addr)] & (PTE_SYSCALL);
+  8077c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8077c6:	48 c1 e8 15          	shr    $0x15,%rax
+  8077ca:	48 89 c2             	mov    %rax,%rdx
+  8077cd:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8077d4:	ff ff ff 
+  8077d7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8077db:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8077df:	25 07 0e 00 00       	and    $0xe07,%eax
+  8077e4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  8077e7:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  8077ea:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8077ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8077f2:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8077f5:	41 89 f0             	mov    %esi,%r8d
+  8077f8:	48 89 c6             	mov    %rax,%rsi
+  8077fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  807800:	49 89 df             	mov    %rbx,%r15
+  807803:	48 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rax
+  80780a:	ff ff ff 
+  80780d:	48 01 d8             	add    %rbx,%rax
+  807810:	ff d0                	call   *%rax
+  807812:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  807815:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  807819:	79 3e                	jns    807859 <copy_shared_pages+0x148>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  80781b:	48 b8 58 e2 ff ff ff 	movabs $0xffffffffffffe258,%rax
+  807822:	ff ff ff 
+  807825:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807829:	48 89 c2             	mov    %rax,%rdx
+  80782c:	be 5b 01 00 00       	mov    $0x15b,%esi
+  807831:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  807838:	ff ff ff 
+  80783b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80783f:	48 89 c7             	mov    %rax,%rdi
+  807842:	49 89 df             	mov    %rbx,%r15
+  807845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80784a:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  807851:	ff ff ff 
+  807854:	48 01 d9             	add    %rbx,%rcx
+  807857:	ff d1                	call   *%rcx
+				}
+				addr += PTSIZE;
+  807859:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  807860:	00 
+  807861:	e9 59 01 00 00       	jmp    8079bf <copy_shared_pages+0x2ae>
+			}
+			else if (uvpd[VPD(addr)] & PTE_P){
+  807866:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80786a:	48 c1 e8 15          	shr    $0x15,%rax
+  80786e:	48 89 c2             	mov    %rax,%rdx
+  807871:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  807878:	ff ff ff 
+  80787b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80787f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807883:	83 e0 01             	and    $0x1,%eax
+  807886:	48 85 c0             	test   %rax,%rax
+  807889:	0f 84 1e 01 00 00    	je     8079ad <copy_shared_pages+0x29c>
+				if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_SHARE && uvpt[VPN(addr)] & PTE_U){
+  80788f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807893:	48 c1 e8 0c          	shr    $0xc,%rax
+  807897:	48 89 c2             	mov    %rax,%rdx
+  80789a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8078a1:	ff ff ff 
+  8078a4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8078a8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8078ac:	83 e0 01             	and    $0x1,%eax
+  8078af:	48 85 c0             	test   %rax,%rax
+  8078b2:	0f 84 eb 00 00 00    	je     8079a3 <copy_shared_pages+0x292>
+  8078b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8078bc:	48 c1 e8 0c          	shr    $0xc,%rax
+  8078c0:	48 89 c2             	mov    %rax,%rdx
+  8078c3:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8078ca:	ff ff ff 
+  8078cd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8078d1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8078d5:	25 00 04 00 00       	and    $0x400,%eax
+  8078da:	48 85 c0             	test   %rax,%rax
+  8078dd:	0f 84 c0 00 00 00    	je     8079a3 <copy_shared_pages+0x292>
+  8078e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8078e7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8078eb:	48 89 c2             	mov    %rax,%rdx
+  8078ee:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8078f5:	ff ff ff 
+  8078f8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8078fc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807900:	83 e0 04             	and    $0x4,%eax
+  807903:	48 85 c0             	test   %rax,%rax
+  807906:	0f 84 97 00 00 00    	je     8079a3 <copy_shared_pages+0x292>
+					unsigned int perm = uvpt[VPN(addr)] & (PTE_SYSCALL);
+  80790c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807910:	48 c1 e8 0c          	shr    $0xc,%rax
+  807914:	48 89 c2             	mov    %rax,%rdx
+  807917:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80791e:	ff ff ff 
+  807921:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  807925:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807929:	25 07 0e 00 00       	and    $0xe07,%eax
+  80792e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  807931:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  807934:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  807938:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80793c:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80793f:	41 89 f0             	mov    %esi,%r8d
+  807942:	48 89 c6             	mov    %rax,%rsi
+  807945:	bf 00 00 00 00       	mov    $0x0,%edi
+  80794a:	49 89 df             	mov    %rbx,%r15
+  80794d:	48 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rax
+  807954:	ff ff ff 
+  807957:	48 01 d8             	add    %rbx,%rax
+  80795a:	ff d0                	call   *%rax
+  80795c:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  80795f:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  807963:	79 3e                	jns    8079a3 <copy_shared_pages+0x292>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  807965:	48 b8 58 e2 ff ff ff 	movabs $0xffffffffffffe258,%rax
+  80796c:	ff ff ff 
+  80796f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807973:	48 89 c2             	mov    %rax,%rdx
+  807976:	be 64 01 00 00       	mov    $0x164,%esi
+  80797b:	48 b8 b0 e1 ff ff ff 	movabs $0xffffffffffffe1b0,%rax
+  807982:	ff ff ff 
+  807985:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807989:	48 89 c7             	mov    %rax,%rdi
+  80798c:	49 89 df             	mov    %rbx,%r15
+  80798f:	b8 00 00 00 00       	mov    $0x0,%eax
+  807994:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  80799b:	ff ff ff 
+  80799e:	48 01 d9             	add    %rbx,%rcx
+  8079a1:	ff d1                	call   *%rcx
+				}
+				addr += PGSIZE;
+  8079a3:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8079aa:	00 
+  8079ab:	eb 12                	jmp    8079bf <copy_shared_pages+0x2ae>
+			}
+			//we will discover a PDE not present is at 
+			//a multiple of PTSIZE;
+			else {
+				addr += PTSIZE;
+  8079ad:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8079b4:	00 
+  8079b5:	eb 08                	jmp    8079bf <copy_shared_pages+0x2ae>
+			}
+		}
+		//we will discover a PDPE not present is at
+		//a multiple of PTSIZE * NPDENTRIES;    
+		else {
+			addr += PTSIZE * NPDENTRIES;
+  8079b7:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  8079be:	40 
+	for (; addr < USTACKTOP;){
+  8079bf:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  8079c4:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  8079c8:	0f 83 72 fd ff ff    	jae    807740 <copy_shared_pages+0x2f>
+        	}
+        }
+
+	return 0;
+  8079ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8079d3:	48 83 c4 30          	add    $0x30,%rsp
+  8079d7:	5b                   	pop    %rbx
+  8079d8:	41 5f                	pop    %r15
+  8079da:	5d                   	pop    %rbp
+  8079db:	c3                   	ret
+
+00000000008079dc <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  8079dc:	55                   	push   %rbp
+  8079dd:	48 89 e5             	mov    %rsp,%rbp
+  8079e0:	41 57                	push   %r15
+  8079e2:	53                   	push   %rbx
+  8079e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8079e7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8079e7 <fd2sockid+0xb>
+  8079ee:	49 bb 61 46 00 00 00 	movabs $0x4661,%r11
+  8079f5:	00 00 00 
+  8079f8:	4c 01 db             	add    %r11,%rbx
+  8079fb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8079fe:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  807a02:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807a05:	48 89 d6             	mov    %rdx,%rsi
+  807a08:	89 c7                	mov    %eax,%edi
+  807a0a:	49 89 df             	mov    %rbx,%r15
+  807a0d:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  807a14:	ff ff ff 
+  807a17:	48 01 d8             	add    %rbx,%rax
+  807a1a:	ff d0                	call   *%rax
+  807a1c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807a1f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807a23:	79 05                	jns    807a2a <fd2sockid+0x4e>
+		return r;
+  807a25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807a28:	eb 25                	jmp    807a4f <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  807a2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807a2e:	8b 10                	mov    (%rax),%edx
+  807a30:	48 b8 b8 00 00 00 00 	movabs $0xb8,%rax
+  807a37:	00 00 00 
+  807a3a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807a3d:	39 c2                	cmp    %eax,%edx
+  807a3f:	74 07                	je     807a48 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  807a41:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  807a46:	eb 07                	jmp    807a4f <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  807a48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807a4c:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  807a4f:	48 83 c4 20          	add    $0x20,%rsp
+  807a53:	5b                   	pop    %rbx
+  807a54:	41 5f                	pop    %r15
+  807a56:	5d                   	pop    %rbp
+  807a57:	c3                   	ret
+
+0000000000807a58 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  807a58:	55                   	push   %rbp
+  807a59:	48 89 e5             	mov    %rsp,%rbp
+  807a5c:	41 57                	push   %r15
+  807a5e:	53                   	push   %rbx
+  807a5f:	48 83 ec 20          	sub    $0x20,%rsp
+  807a63:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807a63 <alloc_sockfd+0xb>
+  807a6a:	49 bb e5 45 00 00 00 	movabs $0x45e5,%r11
+  807a71:	00 00 00 
+  807a74:	4c 01 db             	add    %r11,%rbx
+  807a77:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  807a7a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  807a7e:	48 89 c7             	mov    %rax,%rdi
+  807a81:	49 89 df             	mov    %rbx,%r15
+  807a84:	48 b8 85 8d ff ff ff 	movabs $0xffffffffffff8d85,%rax
+  807a8b:	ff ff ff 
+  807a8e:	48 01 d8             	add    %rbx,%rax
+  807a91:	ff d0                	call   *%rax
+  807a93:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807a96:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807a9a:	78 2c                	js     807ac8 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  807a9c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807aa0:	ba 07 04 00 00       	mov    $0x407,%edx
+  807aa5:	48 89 c6             	mov    %rax,%rsi
+  807aa8:	bf 00 00 00 00       	mov    $0x0,%edi
+  807aad:	49 89 df             	mov    %rbx,%r15
+  807ab0:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  807ab7:	ff ff ff 
+  807aba:	48 01 d8             	add    %rbx,%rax
+  807abd:	ff d0                	call   *%rax
+  807abf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807ac2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807ac6:	79 1c                	jns    807ae4 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  807ac8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807acb:	89 c7                	mov    %eax,%edi
+  807acd:	49 89 df             	mov    %rbx,%r15
+  807ad0:	48 b8 04 c2 ff ff ff 	movabs $0xffffffffffffc204,%rax
+  807ad7:	ff ff ff 
+  807ada:	48 01 d8             	add    %rbx,%rax
+  807add:	ff d0                	call   *%rax
+		return r;
+  807adf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807ae2:	eb 41                	jmp    807b25 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  807ae4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807ae8:	48 ba b8 00 00 00 00 	movabs $0xb8,%rdx
+  807aef:	00 00 00 
+  807af2:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  807af5:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  807af7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807afb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  807b02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807b06:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  807b09:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  807b0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807b10:	48 89 c7             	mov    %rax,%rdi
+  807b13:	49 89 df             	mov    %rbx,%r15
+  807b16:	48 b8 0b 8d ff ff ff 	movabs $0xffffffffffff8d0b,%rax
+  807b1d:	ff ff ff 
+  807b20:	48 01 d8             	add    %rbx,%rax
+  807b23:	ff d0                	call   *%rax
+}
+  807b25:	48 83 c4 20          	add    $0x20,%rsp
+  807b29:	5b                   	pop    %rbx
+  807b2a:	41 5f                	pop    %r15
+  807b2c:	5d                   	pop    %rbp
+  807b2d:	c3                   	ret
+
+0000000000807b2e <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  807b2e:	55                   	push   %rbp
+  807b2f:	48 89 e5             	mov    %rsp,%rbp
+  807b32:	41 57                	push   %r15
+  807b34:	53                   	push   %rbx
+  807b35:	48 83 ec 30          	sub    $0x30,%rsp
+  807b39:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807b39 <accept+0xb>
+  807b40:	49 bb 0f 45 00 00 00 	movabs $0x450f,%r11
+  807b47:	00 00 00 
+  807b4a:	4c 01 db             	add    %r11,%rbx
+  807b4d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807b50:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  807b54:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  807b58:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807b5b:	89 c7                	mov    %eax,%edi
+  807b5d:	48 b8 94 b9 ff ff ff 	movabs $0xffffffffffffb994,%rax
+  807b64:	ff ff ff 
+  807b67:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807b6b:	ff d0                	call   *%rax
+  807b6d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807b70:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807b74:	79 05                	jns    807b7b <accept+0x4d>
+		return r;
+  807b76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807b79:	eb 45                	jmp    807bc0 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  807b7b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  807b7f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  807b83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807b86:	48 89 ce             	mov    %rcx,%rsi
+  807b89:	89 c7                	mov    %eax,%edi
+  807b8b:	49 89 df             	mov    %rbx,%r15
+  807b8e:	48 b8 72 c0 ff ff ff 	movabs $0xffffffffffffc072,%rax
+  807b95:	ff ff ff 
+  807b98:	48 01 d8             	add    %rbx,%rax
+  807b9b:	ff d0                	call   *%rax
+  807b9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807ba0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807ba4:	79 05                	jns    807bab <accept+0x7d>
+		return r;
+  807ba6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807ba9:	eb 15                	jmp    807bc0 <accept+0x92>
+	return alloc_sockfd(r);
+  807bab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807bae:	89 c7                	mov    %eax,%edi
+  807bb0:	48 b8 10 ba ff ff ff 	movabs $0xffffffffffffba10,%rax
+  807bb7:	ff ff ff 
+  807bba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807bbe:	ff d0                	call   *%rax
+}
+  807bc0:	48 83 c4 30          	add    $0x30,%rsp
+  807bc4:	5b                   	pop    %rbx
+  807bc5:	41 5f                	pop    %r15
+  807bc7:	5d                   	pop    %rbp
+  807bc8:	c3                   	ret
+
+0000000000807bc9 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  807bc9:	55                   	push   %rbp
+  807bca:	48 89 e5             	mov    %rsp,%rbp
+  807bcd:	41 57                	push   %r15
+  807bcf:	53                   	push   %rbx
+  807bd0:	48 83 ec 20          	sub    $0x20,%rsp
+  807bd4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807bd4 <bind+0xb>
+  807bdb:	49 bb 74 44 00 00 00 	movabs $0x4474,%r11
+  807be2:	00 00 00 
+  807be5:	4c 01 db             	add    %r11,%rbx
+  807be8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807beb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  807bef:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  807bf2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807bf5:	89 c7                	mov    %eax,%edi
+  807bf7:	48 b8 94 b9 ff ff ff 	movabs $0xffffffffffffb994,%rax
+  807bfe:	ff ff ff 
+  807c01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807c05:	ff d0                	call   *%rax
+  807c07:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807c0a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807c0e:	79 05                	jns    807c15 <bind+0x4c>
+		return r;
+  807c10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807c13:	eb 21                	jmp    807c36 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  807c15:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  807c18:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  807c1c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807c1f:	48 89 ce             	mov    %rcx,%rsi
+  807c22:	89 c7                	mov    %eax,%edi
+  807c24:	49 89 df             	mov    %rbx,%r15
+  807c27:	48 b8 1e c1 ff ff ff 	movabs $0xffffffffffffc11e,%rax
+  807c2e:	ff ff ff 
+  807c31:	48 01 d8             	add    %rbx,%rax
+  807c34:	ff d0                	call   *%rax
+}
+  807c36:	48 83 c4 20          	add    $0x20,%rsp
+  807c3a:	5b                   	pop    %rbx
+  807c3b:	41 5f                	pop    %r15
+  807c3d:	5d                   	pop    %rbp
+  807c3e:	c3                   	ret
+
+0000000000807c3f <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  807c3f:	55                   	push   %rbp
+  807c40:	48 89 e5             	mov    %rsp,%rbp
+  807c43:	41 57                	push   %r15
+  807c45:	53                   	push   %rbx
+  807c46:	48 83 ec 20          	sub    $0x20,%rsp
+  807c4a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807c4a <shutdown+0xb>
+  807c51:	49 bb fe 43 00 00 00 	movabs $0x43fe,%r11
+  807c58:	00 00 00 
+  807c5b:	4c 01 db             	add    %r11,%rbx
+  807c5e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807c61:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  807c64:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807c67:	89 c7                	mov    %eax,%edi
+  807c69:	48 b8 94 b9 ff ff ff 	movabs $0xffffffffffffb994,%rax
+  807c70:	ff ff ff 
+  807c73:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807c77:	ff d0                	call   *%rax
+  807c79:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807c7c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807c80:	79 05                	jns    807c87 <shutdown+0x48>
+		return r;
+  807c82:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807c85:	eb 1c                	jmp    807ca3 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  807c87:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  807c8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807c8d:	89 d6                	mov    %edx,%esi
+  807c8f:	89 c7                	mov    %eax,%edi
+  807c91:	49 89 df             	mov    %rbx,%r15
+  807c94:	48 b8 b3 c1 ff ff ff 	movabs $0xffffffffffffc1b3,%rax
+  807c9b:	ff ff ff 
+  807c9e:	48 01 d8             	add    %rbx,%rax
+  807ca1:	ff d0                	call   *%rax
+}
+  807ca3:	48 83 c4 20          	add    $0x20,%rsp
+  807ca7:	5b                   	pop    %rbx
+  807ca8:	41 5f                	pop    %r15
+  807caa:	5d                   	pop    %rbp
+  807cab:	c3                   	ret
+
+0000000000807cac <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  807cac:	55                   	push   %rbp
+  807cad:	48 89 e5             	mov    %rsp,%rbp
+  807cb0:	41 57                	push   %r15
+  807cb2:	53                   	push   %rbx
+  807cb3:	48 83 ec 10          	sub    $0x10,%rsp
+  807cb7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807cb7 <devsock_close+0xb>
+  807cbe:	49 bb 91 43 00 00 00 	movabs $0x4391,%r11
+  807cc5:	00 00 00 
+  807cc8:	4c 01 db             	add    %r11,%rbx
+  807ccb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  807ccf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807cd3:	48 89 c7             	mov    %rax,%rdi
+  807cd6:	49 89 df             	mov    %rbx,%r15
+  807cd9:	48 b8 30 d8 ff ff ff 	movabs $0xffffffffffffd830,%rax
+  807ce0:	ff ff ff 
+  807ce3:	48 01 d8             	add    %rbx,%rax
+  807ce6:	ff d0                	call   *%rax
+  807ce8:	83 f8 01             	cmp    $0x1,%eax
+  807ceb:	75 1d                	jne    807d0a <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  807ced:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807cf1:	8b 40 0c             	mov    0xc(%rax),%eax
+  807cf4:	89 c7                	mov    %eax,%edi
+  807cf6:	49 89 df             	mov    %rbx,%r15
+  807cf9:	48 b8 04 c2 ff ff ff 	movabs $0xffffffffffffc204,%rax
+  807d00:	ff ff ff 
+  807d03:	48 01 d8             	add    %rbx,%rax
+  807d06:	ff d0                	call   *%rax
+  807d08:	eb 05                	jmp    807d0f <devsock_close+0x63>
+	else
+		return 0;
+  807d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807d0f:	48 83 c4 10          	add    $0x10,%rsp
+  807d13:	5b                   	pop    %rbx
+  807d14:	41 5f                	pop    %r15
+  807d16:	5d                   	pop    %rbp
+  807d17:	c3                   	ret
+
+0000000000807d18 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  807d18:	55                   	push   %rbp
+  807d19:	48 89 e5             	mov    %rsp,%rbp
+  807d1c:	41 57                	push   %r15
+  807d1e:	53                   	push   %rbx
+  807d1f:	48 83 ec 20          	sub    $0x20,%rsp
+  807d23:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807d23 <connect+0xb>
+  807d2a:	49 bb 25 43 00 00 00 	movabs $0x4325,%r11
+  807d31:	00 00 00 
+  807d34:	4c 01 db             	add    %r11,%rbx
+  807d37:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807d3a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  807d3e:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  807d41:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807d44:	89 c7                	mov    %eax,%edi
+  807d46:	48 b8 94 b9 ff ff ff 	movabs $0xffffffffffffb994,%rax
+  807d4d:	ff ff ff 
+  807d50:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807d54:	ff d0                	call   *%rax
+  807d56:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807d59:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807d5d:	79 05                	jns    807d64 <connect+0x4c>
+		return r;
+  807d5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807d62:	eb 21                	jmp    807d85 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  807d64:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  807d67:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  807d6b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807d6e:	48 89 ce             	mov    %rcx,%rsi
+  807d71:	89 c7                	mov    %eax,%edi
+  807d73:	49 89 df             	mov    %rbx,%r15
+  807d76:	48 b8 4c c2 ff ff ff 	movabs $0xffffffffffffc24c,%rax
+  807d7d:	ff ff ff 
+  807d80:	48 01 d8             	add    %rbx,%rax
+  807d83:	ff d0                	call   *%rax
+}
+  807d85:	48 83 c4 20          	add    $0x20,%rsp
+  807d89:	5b                   	pop    %rbx
+  807d8a:	41 5f                	pop    %r15
+  807d8c:	5d                   	pop    %rbp
+  807d8d:	c3                   	ret
+
+0000000000807d8e <listen>:
+
+int
+listen(int s, int backlog)
+{
+  807d8e:	55                   	push   %rbp
+  807d8f:	48 89 e5             	mov    %rsp,%rbp
+  807d92:	41 57                	push   %r15
+  807d94:	53                   	push   %rbx
+  807d95:	48 83 ec 20          	sub    $0x20,%rsp
+  807d99:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807d99 <listen+0xb>
+  807da0:	49 bb af 42 00 00 00 	movabs $0x42af,%r11
+  807da7:	00 00 00 
+  807daa:	4c 01 db             	add    %r11,%rbx
+  807dad:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807db0:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  807db3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807db6:	89 c7                	mov    %eax,%edi
+  807db8:	48 b8 94 b9 ff ff ff 	movabs $0xffffffffffffb994,%rax
+  807dbf:	ff ff ff 
+  807dc2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807dc6:	ff d0                	call   *%rax
+  807dc8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807dcb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807dcf:	79 05                	jns    807dd6 <listen+0x48>
+		return r;
+  807dd1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807dd4:	eb 1c                	jmp    807df2 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  807dd6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  807dd9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807ddc:	89 d6                	mov    %edx,%esi
+  807dde:	89 c7                	mov    %eax,%edi
+  807de0:	49 89 df             	mov    %rbx,%r15
+  807de3:	48 b8 e1 c2 ff ff ff 	movabs $0xffffffffffffc2e1,%rax
+  807dea:	ff ff ff 
+  807ded:	48 01 d8             	add    %rbx,%rax
+  807df0:	ff d0                	call   *%rax
+}
+  807df2:	48 83 c4 20          	add    $0x20,%rsp
+  807df6:	5b                   	pop    %rbx
+  807df7:	41 5f                	pop    %r15
+  807df9:	5d                   	pop    %rbp
+  807dfa:	c3                   	ret
+
+0000000000807dfb <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  807dfb:	55                   	push   %rbp
+  807dfc:	48 89 e5             	mov    %rsp,%rbp
+  807dff:	41 57                	push   %r15
+  807e01:	48 83 ec 28          	sub    $0x28,%rsp
+  807e05:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807e05 <devsock_read+0xa>
+  807e0c:	49 bb 43 42 00 00 00 	movabs $0x4243,%r11
+  807e13:	00 00 00 
+  807e16:	4c 01 d8             	add    %r11,%rax
+  807e19:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807e1d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  807e21:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  807e25:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  807e29:	41 89 d0             	mov    %edx,%r8d
+  807e2c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807e30:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  807e33:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  807e37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807e3c:	44 89 c2             	mov    %r8d,%edx
+  807e3f:	49 89 c7             	mov    %rax,%r15
+  807e42:	49 b8 32 c3 ff ff ff 	movabs $0xffffffffffffc332,%r8
+  807e49:	ff ff ff 
+  807e4c:	49 01 c0             	add    %rax,%r8
+  807e4f:	41 ff d0             	call   *%r8
+}
+  807e52:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  807e56:	c9                   	leave
+  807e57:	c3                   	ret
+
+0000000000807e58 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  807e58:	55                   	push   %rbp
+  807e59:	48 89 e5             	mov    %rsp,%rbp
+  807e5c:	41 57                	push   %r15
+  807e5e:	48 83 ec 28          	sub    $0x28,%rsp
+  807e62:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807e62 <devsock_write+0xa>
+  807e69:	49 bb e6 41 00 00 00 	movabs $0x41e6,%r11
+  807e70:	00 00 00 
+  807e73:	4c 01 d8             	add    %r11,%rax
+  807e76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807e7a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  807e7e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  807e82:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  807e86:	41 89 d0             	mov    %edx,%r8d
+  807e89:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807e8d:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  807e90:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  807e94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807e99:	44 89 c2             	mov    %r8d,%edx
+  807e9c:	49 89 c7             	mov    %rax,%r15
+  807e9f:	49 b8 4f c4 ff ff ff 	movabs $0xffffffffffffc44f,%r8
+  807ea6:	ff ff ff 
+  807ea9:	49 01 c0             	add    %rax,%r8
+  807eac:	41 ff d0             	call   *%r8
+}
+  807eaf:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  807eb3:	c9                   	leave
+  807eb4:	c3                   	ret
+
+0000000000807eb5 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  807eb5:	55                   	push   %rbp
+  807eb6:	48 89 e5             	mov    %rsp,%rbp
+  807eb9:	41 57                	push   %r15
+  807ebb:	48 83 ec 18          	sub    $0x18,%rsp
+  807ebf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807ebf <devsock_stat+0xa>
+  807ec6:	49 bb 89 41 00 00 00 	movabs $0x4189,%r11
+  807ecd:	00 00 00 
+  807ed0:	4c 01 d8             	add    %r11,%rax
+  807ed3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807ed7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  807edb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  807edf:	48 b9 87 e2 ff ff ff 	movabs $0xffffffffffffe287,%rcx
+  807ee6:	ff ff ff 
+  807ee9:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  807eed:	48 89 ce             	mov    %rcx,%rsi
+  807ef0:	48 89 d7             	mov    %rdx,%rdi
+  807ef3:	49 89 c7             	mov    %rax,%r15
+  807ef6:	48 ba cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rdx
+  807efd:	ff ff ff 
+  807f00:	48 01 c2             	add    %rax,%rdx
+  807f03:	ff d2                	call   *%rdx
+	return 0;
+  807f05:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807f0a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  807f0e:	c9                   	leave
+  807f0f:	c3                   	ret
+
+0000000000807f10 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  807f10:	55                   	push   %rbp
+  807f11:	48 89 e5             	mov    %rsp,%rbp
+  807f14:	41 57                	push   %r15
+  807f16:	53                   	push   %rbx
+  807f17:	48 83 ec 20          	sub    $0x20,%rsp
+  807f1b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807f1b <socket+0xb>
+  807f22:	49 bb 2d 41 00 00 00 	movabs $0x412d,%r11
+  807f29:	00 00 00 
+  807f2c:	4c 01 db             	add    %r11,%rbx
+  807f2f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  807f32:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  807f35:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  807f38:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  807f3b:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  807f3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  807f41:	89 ce                	mov    %ecx,%esi
+  807f43:	89 c7                	mov    %eax,%edi
+  807f45:	49 89 df             	mov    %rbx,%r15
+  807f48:	48 b8 26 c6 ff ff ff 	movabs $0xffffffffffffc626,%rax
+  807f4f:	ff ff ff 
+  807f52:	48 01 d8             	add    %rbx,%rax
+  807f55:	ff d0                	call   *%rax
+  807f57:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  807f5a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  807f5e:	79 05                	jns    807f65 <socket+0x55>
+		return r;
+  807f60:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807f63:	eb 15                	jmp    807f7a <socket+0x6a>
+	return alloc_sockfd(r);
+  807f65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  807f68:	89 c7                	mov    %eax,%edi
+  807f6a:	48 b8 10 ba ff ff ff 	movabs $0xffffffffffffba10,%rax
+  807f71:	ff ff ff 
+  807f74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  807f78:	ff d0                	call   *%rax
+}
+  807f7a:	48 83 c4 20          	add    $0x20,%rsp
+  807f7e:	5b                   	pop    %rbx
+  807f7f:	41 5f                	pop    %r15
+  807f81:	5d                   	pop    %rbp
+  807f82:	c3                   	ret
+
+0000000000807f83 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  807f83:	55                   	push   %rbp
+  807f84:	48 89 e5             	mov    %rsp,%rbp
+  807f87:	41 57                	push   %r15
+  807f89:	53                   	push   %rbx
+  807f8a:	48 83 ec 10          	sub    $0x10,%rsp
+  807f8e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 807f8e <nsipc+0xb>
+  807f95:	49 bb ba 40 00 00 00 	movabs $0x40ba,%r11
+  807f9c:	00 00 00 
+  807f9f:	4c 01 db             	add    %r11,%rbx
+  807fa2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  807fa5:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  807fac:	00 00 00 
+  807faf:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807fb2:	85 c0                	test   %eax,%eax
+  807fb4:	75 24                	jne    807fda <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  807fb6:	bf 02 00 00 00       	mov    $0x2,%edi
+  807fbb:	49 89 df             	mov    %rbx,%r15
+  807fbe:	48 b8 a1 d7 ff ff ff 	movabs $0xffffffffffffd7a1,%rax
+  807fc5:	ff ff ff 
+  807fc8:	48 01 d8             	add    %rbx,%rax
+  807fcb:	ff d0                	call   *%rax
+  807fcd:	48 ba b8 2f 01 00 00 	movabs $0x12fb8,%rdx
+  807fd4:	00 00 00 
+  807fd7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  807fda:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  807fe1:	00 00 00 
+  807fe4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  807fe7:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  807fea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  807ff0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  807ff6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  807ffb:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  808002:	00 00 00 
+  808005:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  808009:	89 c7                	mov    %eax,%edi
+  80800b:	49 89 df             	mov    %rbx,%r15
+  80800e:	48 b8 c0 d1 ff ff ff 	movabs $0xffffffffffffd1c0,%rax
+  808015:	ff ff ff 
+  808018:	48 01 d8             	add    %rbx,%rax
+  80801b:	ff d0                	call   *%rax
+}
+  80801d:	48 83 c4 10          	add    $0x10,%rsp
+  808021:	5b                   	pop    %rbx
+  808022:	41 5f                	pop    %r15
+  808024:	5d                   	pop    %rbp
+  808025:	c3                   	ret
+
+0000000000808026 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  808026:	55                   	push   %rbp
+  808027:	48 89 e5             	mov    %rsp,%rbp
+  80802a:	41 57                	push   %r15
+  80802c:	53                   	push   %rbx
+  80802d:	48 83 ec 20          	sub    $0x20,%rsp
+  808031:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808031 <nsipc_words+0xb>
+  808038:	49 bb 17 40 00 00 00 	movabs $0x4017,%r11
+  80803f:	00 00 00 
+  808042:	4c 01 db             	add    %r11,%rbx
+  808045:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  808048:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80804c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  808050:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  808057:	00 00 00 
+  80805a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80805d:	85 c0                	test   %eax,%eax
+  80805f:	75 24                	jne    808085 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  808061:	bf 02 00 00 00       	mov    $0x2,%edi
+  808066:	49 89 df             	mov    %rbx,%r15
+  808069:	48 b8 a1 d7 ff ff ff 	movabs $0xffffffffffffd7a1,%rax
+  808070:	ff ff ff 
+  808073:	48 01 d8             	add    %rbx,%rax
+  808076:	ff d0                	call   *%rax
+  808078:	48 ba b8 2f 01 00 00 	movabs $0x12fb8,%rdx
+  80807f:	00 00 00 
+  808082:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  808085:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  80808c:	00 00 00 
+  80808f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  808092:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  808096:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80809a:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80809d:	89 c7                	mov    %eax,%edi
+  80809f:	49 89 df             	mov    %rbx,%r15
+  8080a2:	48 b8 ab d2 ff ff ff 	movabs $0xffffffffffffd2ab,%rax
+  8080a9:	ff ff ff 
+  8080ac:	48 01 d8             	add    %rbx,%rax
+  8080af:	ff d0                	call   *%rax
+}
+  8080b1:	48 83 c4 20          	add    $0x20,%rsp
+  8080b5:	5b                   	pop    %rbx
+  8080b6:	41 5f                	pop    %r15
+  8080b8:	5d                   	pop    %rbp
+  8080b9:	c3                   	ret
+
+00000000008080ba <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8080ba:	55                   	push   %rbp
+  8080bb:	48 89 e5             	mov    %rsp,%rbp
+  8080be:	41 57                	push   %r15
+  8080c0:	53                   	push   %rbx
+  8080c1:	48 83 ec 30          	sub    $0x30,%rsp
+  8080c5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8080c5 <nsipc_accept+0xb>
+  8080cc:	49 bb 83 3f 00 00 00 	movabs $0x3f83,%r11
+  8080d3:	00 00 00 
+  8080d6:	4c 01 db             	add    %r11,%rbx
+  8080d9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8080dc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8080e0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8080e4:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8080eb:	00 00 00 
+  8080ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8080f1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8080f4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8080f9:	48 b8 3b bf ff ff ff 	movabs $0xffffffffffffbf3b,%rax
+  808100:	ff ff ff 
+  808103:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808107:	ff d0                	call   *%rax
+  808109:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80810c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808110:	78 48                	js     80815a <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  808112:	48 b8 b8 4f 01 00 00 	movabs $0x14fb8,%rax
+  808119:	00 00 00 
+  80811c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808120:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  808124:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808128:	8b 40 10             	mov    0x10(%rax),%eax
+  80812b:	89 c2                	mov    %eax,%edx
+  80812d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  808131:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808135:	48 89 ce             	mov    %rcx,%rsi
+  808138:	48 89 c7             	mov    %rax,%rdi
+  80813b:	49 89 df             	mov    %rbx,%r15
+  80813e:	48 b8 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rax
+  808145:	ff ff ff 
+  808148:	48 01 d8             	add    %rbx,%rax
+  80814b:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80814d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808151:	8b 50 10             	mov    0x10(%rax),%edx
+  808154:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  808158:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  80815a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80815d:	48 83 c4 30          	add    $0x30,%rsp
+  808161:	5b                   	pop    %rbx
+  808162:	41 5f                	pop    %r15
+  808164:	5d                   	pop    %rbp
+  808165:	c3                   	ret
+
+0000000000808166 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  808166:	55                   	push   %rbp
+  808167:	48 89 e5             	mov    %rsp,%rbp
+  80816a:	41 57                	push   %r15
+  80816c:	53                   	push   %rbx
+  80816d:	48 83 ec 10          	sub    $0x10,%rsp
+  808171:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808171 <nsipc_bind+0xb>
+  808178:	49 bb d7 3e 00 00 00 	movabs $0x3ed7,%r11
+  80817f:	00 00 00 
+  808182:	4c 01 db             	add    %r11,%rbx
+  808185:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  808188:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80818c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  80818f:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  808196:	00 00 00 
+  808199:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80819c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80819f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8081a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8081a6:	48 89 c6             	mov    %rax,%rsi
+  8081a9:	48 b8 bc 4f 01 00 00 	movabs $0x14fbc,%rax
+  8081b0:	00 00 00 
+  8081b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8081b7:	48 89 c7             	mov    %rax,%rdi
+  8081ba:	49 89 df             	mov    %rbx,%r15
+  8081bd:	48 b8 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rax
+  8081c4:	ff ff ff 
+  8081c7:	48 01 d8             	add    %rbx,%rax
+  8081ca:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8081cc:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8081d3:	00 00 00 
+  8081d6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8081d9:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8081dd:	bf 02 00 00 00       	mov    $0x2,%edi
+  8081e2:	48 b8 3b bf ff ff ff 	movabs $0xffffffffffffbf3b,%rax
+  8081e9:	ff ff ff 
+  8081ec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8081f0:	ff d0                	call   *%rax
+}
+  8081f2:	48 83 c4 10          	add    $0x10,%rsp
+  8081f6:	5b                   	pop    %rbx
+  8081f7:	41 5f                	pop    %r15
+  8081f9:	5d                   	pop    %rbp
+  8081fa:	c3                   	ret
+
+00000000008081fb <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8081fb:	55                   	push   %rbp
+  8081fc:	48 89 e5             	mov    %rsp,%rbp
+  8081ff:	48 83 ec 20          	sub    $0x20,%rsp
+  808203:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808203 <nsipc_shutdown+0x8>
+  80820a:	49 bb 45 3e 00 00 00 	movabs $0x3e45,%r11
+  808211:	00 00 00 
+  808214:	4c 01 d8             	add    %r11,%rax
+  808217:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80821a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  80821d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  808220:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  808223:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  808226:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  808229:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80822d:	ba 08 00 00 00       	mov    $0x8,%edx
+  808232:	48 89 ce             	mov    %rcx,%rsi
+  808235:	bf 03 00 00 00       	mov    $0x3,%edi
+  80823a:	48 b9 de bf ff ff ff 	movabs $0xffffffffffffbfde,%rcx
+  808241:	ff ff ff 
+  808244:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  808248:	ff d0                	call   *%rax
+}
+  80824a:	c9                   	leave
+  80824b:	c3                   	ret
+
+000000000080824c <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80824c:	55                   	push   %rbp
+  80824d:	48 89 e5             	mov    %rsp,%rbp
+  808250:	48 83 ec 20          	sub    $0x20,%rsp
+  808254:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808254 <nsipc_close+0x8>
+  80825b:	49 bb f4 3d 00 00 00 	movabs $0x3df4,%r11
+  808262:	00 00 00 
+  808265:	4c 01 d8             	add    %r11,%rax
+  808268:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80826b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80826e:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  808271:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  808275:	ba 04 00 00 00       	mov    $0x4,%edx
+  80827a:	48 89 ce             	mov    %rcx,%rsi
+  80827d:	bf 04 00 00 00       	mov    $0x4,%edi
+  808282:	48 b9 de bf ff ff ff 	movabs $0xffffffffffffbfde,%rcx
+  808289:	ff ff ff 
+  80828c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  808290:	ff d0                	call   *%rax
+}
+  808292:	c9                   	leave
+  808293:	c3                   	ret
+
+0000000000808294 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  808294:	55                   	push   %rbp
+  808295:	48 89 e5             	mov    %rsp,%rbp
+  808298:	41 57                	push   %r15
+  80829a:	53                   	push   %rbx
+  80829b:	48 83 ec 10          	sub    $0x10,%rsp
+  80829f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80829f <nsipc_connect+0xb>
+  8082a6:	49 bb a9 3d 00 00 00 	movabs $0x3da9,%r11
+  8082ad:	00 00 00 
+  8082b0:	4c 01 db             	add    %r11,%rbx
+  8082b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8082b6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8082ba:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8082bd:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8082c4:	00 00 00 
+  8082c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8082ca:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8082cd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8082d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8082d4:	48 89 c6             	mov    %rax,%rsi
+  8082d7:	48 b8 bc 4f 01 00 00 	movabs $0x14fbc,%rax
+  8082de:	00 00 00 
+  8082e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8082e5:	48 89 c7             	mov    %rax,%rdi
+  8082e8:	49 89 df             	mov    %rbx,%r15
+  8082eb:	48 b8 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rax
+  8082f2:	ff ff ff 
+  8082f5:	48 01 d8             	add    %rbx,%rax
+  8082f8:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8082fa:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  808301:	00 00 00 
+  808304:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  808307:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  80830b:	bf 05 00 00 00       	mov    $0x5,%edi
+  808310:	48 b8 3b bf ff ff ff 	movabs $0xffffffffffffbf3b,%rax
+  808317:	ff ff ff 
+  80831a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80831e:	ff d0                	call   *%rax
+}
+  808320:	48 83 c4 10          	add    $0x10,%rsp
+  808324:	5b                   	pop    %rbx
+  808325:	41 5f                	pop    %r15
+  808327:	5d                   	pop    %rbp
+  808328:	c3                   	ret
+
+0000000000808329 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  808329:	55                   	push   %rbp
+  80832a:	48 89 e5             	mov    %rsp,%rbp
+  80832d:	48 83 ec 20          	sub    $0x20,%rsp
+  808331:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808331 <nsipc_listen+0x8>
+  808338:	49 bb 17 3d 00 00 00 	movabs $0x3d17,%r11
+  80833f:	00 00 00 
+  808342:	4c 01 d8             	add    %r11,%rax
+  808345:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  808348:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  80834b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80834e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  808351:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  808354:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  808357:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80835b:	ba 08 00 00 00       	mov    $0x8,%edx
+  808360:	48 89 ce             	mov    %rcx,%rsi
+  808363:	bf 06 00 00 00       	mov    $0x6,%edi
+  808368:	48 b9 de bf ff ff ff 	movabs $0xffffffffffffbfde,%rcx
+  80836f:	ff ff ff 
+  808372:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  808376:	ff d0                	call   *%rax
+}
+  808378:	c9                   	leave
+  808379:	c3                   	ret
+
+000000000080837a <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80837a:	55                   	push   %rbp
+  80837b:	48 89 e5             	mov    %rsp,%rbp
+  80837e:	41 57                	push   %r15
+  808380:	53                   	push   %rbx
+  808381:	48 83 ec 30          	sub    $0x30,%rsp
+  808385:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808385 <nsipc_recv+0xb>
+  80838c:	49 bb c3 3c 00 00 00 	movabs $0x3cc3,%r11
+  808393:	00 00 00 
+  808396:	4c 01 db             	add    %r11,%rbx
+  808399:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80839c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8083a0:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8083a3:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8083a6:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8083ad:	00 00 00 
+  8083b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8083b3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8083b6:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8083bd:	00 00 00 
+  8083c0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8083c3:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8083c7:	48 ba b8 4f 01 00 00 	movabs $0x14fb8,%rdx
+  8083ce:	00 00 00 
+  8083d1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8083d4:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8083d8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8083dd:	48 b8 3b bf ff ff ff 	movabs $0xffffffffffffbf3b,%rax
+  8083e4:	ff ff ff 
+  8083e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8083eb:	ff d0                	call   *%rax
+  8083ed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8083f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8083f4:	0f 88 91 00 00 00    	js     80848b <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8083fa:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  808401:	7f 08                	jg     80840b <nsipc_recv+0x91>
+  808403:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808406:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  808409:	7e 50                	jle    80845b <nsipc_recv+0xe1>
+  80840b:	48 b8 8e e2 ff ff ff 	movabs $0xffffffffffffe28e,%rax
+  808412:	ff ff ff 
+  808415:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808419:	48 89 c1             	mov    %rax,%rcx
+  80841c:	48 b8 a3 e2 ff ff ff 	movabs $0xffffffffffffe2a3,%rax
+  808423:	ff ff ff 
+  808426:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80842a:	48 89 c2             	mov    %rax,%rdx
+  80842d:	be 79 00 00 00       	mov    $0x79,%esi
+  808432:	48 b8 b8 e2 ff ff ff 	movabs $0xffffffffffffe2b8,%rax
+  808439:	ff ff ff 
+  80843c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808440:	48 89 c7             	mov    %rax,%rdi
+  808443:	49 89 df             	mov    %rbx,%r15
+  808446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80844b:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  808452:	ff ff ff 
+  808455:	49 01 d8             	add    %rbx,%r8
+  808458:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80845b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80845e:	48 63 d0             	movslq %eax,%rdx
+  808461:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808465:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  80846c:	00 00 00 
+  80846f:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  808473:	48 89 ce             	mov    %rcx,%rsi
+  808476:	48 89 c7             	mov    %rax,%rdi
+  808479:	49 89 df             	mov    %rbx,%r15
+  80847c:	48 b8 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rax
+  808483:	ff ff ff 
+  808486:	48 01 d8             	add    %rbx,%rax
+  808489:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80848b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80848e:	48 83 c4 30          	add    $0x30,%rsp
+  808492:	5b                   	pop    %rbx
+  808493:	41 5f                	pop    %r15
+  808495:	5d                   	pop    %rbp
+  808496:	c3                   	ret
+
+0000000000808497 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  808497:	55                   	push   %rbp
+  808498:	48 89 e5             	mov    %rsp,%rbp
+  80849b:	41 57                	push   %r15
+  80849d:	53                   	push   %rbx
+  80849e:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8084a5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8084a5 <nsipc_send+0xe>
+  8084ac:	49 bb a3 3b 00 00 00 	movabs $0x3ba3,%r11
+  8084b3:	00 00 00 
+  8084b6:	4c 01 db             	add    %r11,%rbx
+  8084b9:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8084bf:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8084c6:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8084cc:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8084d2:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8084d6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  8084da:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  8084e1:	00 00 00 
+  8084e4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8084e7:	85 c0                	test   %eax,%eax
+  8084e9:	75 24                	jne    80850f <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8084eb:	bf 02 00 00 00       	mov    $0x2,%edi
+  8084f0:	49 89 df             	mov    %rbx,%r15
+  8084f3:	48 b8 a1 d7 ff ff ff 	movabs $0xffffffffffffd7a1,%rax
+  8084fa:	ff ff ff 
+  8084fd:	48 01 d8             	add    %rbx,%rax
+  808500:	ff d0                	call   *%rax
+  808502:	48 ba b8 2f 01 00 00 	movabs $0x12fb8,%rdx
+  808509:	00 00 00 
+  80850c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  80850f:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  808515:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  808518:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  80851f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  808522:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  808525:	39 c2                	cmp    %eax,%edx
+  808527:	0f 4e c2             	cmovle %edx,%eax
+  80852a:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  808530:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  808536:	48 63 d0             	movslq %eax,%rdx
+  808539:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  808540:	48 89 c6             	mov    %rax,%rsi
+  808543:	48 b8 b8 2f 00 00 00 	movabs $0x2fb8,%rax
+  80854a:	00 00 00 
+  80854d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808551:	48 89 c7             	mov    %rax,%rdi
+  808554:	49 89 df             	mov    %rbx,%r15
+  808557:	48 b8 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rax
+  80855e:	ff ff ff 
+  808561:	48 01 d8             	add    %rbx,%rax
+  808564:	ff d0                	call   *%rax
+	req->req_s = s;
+  808566:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80856a:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  808570:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  808572:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808576:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80857c:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  80857f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808583:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  808589:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  80858c:	48 b8 b8 2f 00 00 00 	movabs $0x2fb8,%rax
+  808593:	00 00 00 
+  808596:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80859a:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  80859e:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8085a5:	00 
+  8085a6:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8085ac:	48 63 d0             	movslq %eax,%rdx
+  8085af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8085b3:	48 01 d0             	add    %rdx,%rax
+  8085b6:	48 83 e8 01          	sub    $0x1,%rax
+  8085ba:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8085be:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8085c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8085c7:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8085cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8085cf:	48 29 d0             	sub    %rdx,%rax
+  8085d2:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8085d8:	85 c0                	test   %eax,%eax
+  8085da:	0f 48 c2             	cmovs  %edx,%eax
+  8085dd:	c1 f8 0c             	sar    $0xc,%eax
+  8085e0:	48 98                	cltq
+  8085e2:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8085e6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8085ea:	48 85 c0             	test   %rax,%rax
+  8085ed:	0f 95 c0             	setne  %al
+  8085f0:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8085f3:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8085fa:	00 
+  8085fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8085ff:	48 83 c0 0b          	add    $0xb,%rax
+  808603:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  808607:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80860b:	ba 00 00 00 00       	mov    $0x0,%edx
+  808610:	48 f7 75 c8          	divq   -0x38(%rbp)
+  808614:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  808618:	48 29 d0             	sub    %rdx,%rax
+  80861b:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80861f:	89 c7                	mov    %eax,%edi
+  808621:	48 b8 b8 2f 01 00 00 	movabs $0x12fb8,%rax
+  808628:	00 00 00 
+  80862b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80862e:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  808632:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  808636:	48 83 ec 08          	sub    $0x8,%rsp
+  80863a:	6a 00                	push   $0x0
+  80863c:	6a 00                	push   $0x0
+  80863e:	6a 05                	push   $0x5
+  808640:	41 89 f1             	mov    %esi,%r9d
+  808643:	49 89 c8             	mov    %rcx,%r8
+  808646:	89 f9                	mov    %edi,%ecx
+  808648:	be 08 00 00 00       	mov    $0x8,%esi
+  80864d:	89 c7                	mov    %eax,%edi
+  80864f:	49 89 df             	mov    %rbx,%r15
+  808652:	48 b8 a9 d3 ff ff ff 	movabs $0xffffffffffffd3a9,%rax
+  808659:	ff ff ff 
+  80865c:	48 01 d8             	add    %rbx,%rax
+  80865f:	ff d0                	call   *%rax
+  808661:	48 83 c4 20          	add    $0x20,%rsp
+}
+  808665:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  808669:	5b                   	pop    %rbx
+  80866a:	41 5f                	pop    %r15
+  80866c:	5d                   	pop    %rbp
+  80866d:	c3                   	ret
+
+000000000080866e <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80866e:	55                   	push   %rbp
+  80866f:	48 89 e5             	mov    %rsp,%rbp
+  808672:	48 83 ec 10          	sub    $0x10,%rsp
+  808676:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 808676 <nsipc_socket+0x8>
+  80867d:	49 bb d2 39 00 00 00 	movabs $0x39d2,%r11
+  808684:	00 00 00 
+  808687:	4c 01 d8             	add    %r11,%rax
+  80868a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80868d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  808690:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  808693:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  80869a:	00 00 00 
+  80869d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8086a0:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8086a3:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  8086aa:	00 00 00 
+  8086ad:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8086b0:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8086b4:	48 b9 b8 4f 01 00 00 	movabs $0x14fb8,%rcx
+  8086bb:	00 00 00 
+  8086be:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8086c1:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8086c5:	bf 09 00 00 00       	mov    $0x9,%edi
+  8086ca:	48 ba 3b bf ff ff ff 	movabs $0xffffffffffffbf3b,%rdx
+  8086d1:	ff ff ff 
+  8086d4:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8086d8:	ff d0                	call   *%rax
+}
+  8086da:	c9                   	leave
+  8086db:	c3                   	ret
+
+00000000008086dc <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8086dc:	55                   	push   %rbp
+  8086dd:	48 89 e5             	mov    %rsp,%rbp
+  8086e0:	41 57                	push   %r15
+  8086e2:	53                   	push   %rbx
+  8086e3:	48 83 ec 30          	sub    $0x30,%rsp
+  8086e7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8086e7 <pipe+0xb>
+  8086ee:	49 bb 61 39 00 00 00 	movabs $0x3961,%r11
+  8086f5:	00 00 00 
+  8086f8:	4c 01 db             	add    %r11,%rbx
+  8086fb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8086ff:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  808703:	48 89 c7             	mov    %rax,%rdi
+  808706:	49 89 df             	mov    %rbx,%r15
+  808709:	48 b8 85 8d ff ff ff 	movabs $0xffffffffffff8d85,%rax
+  808710:	ff ff ff 
+  808713:	48 01 d8             	add    %rbx,%rax
+  808716:	ff d0                	call   *%rax
+  808718:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80871b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80871f:	0f 88 12 02 00 00    	js     808937 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  808725:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  808729:	ba 07 04 00 00       	mov    $0x407,%edx
+  80872e:	48 89 c6             	mov    %rax,%rsi
+  808731:	bf 00 00 00 00       	mov    $0x0,%edi
+  808736:	49 89 df             	mov    %rbx,%r15
+  808739:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  808740:	ff ff ff 
+  808743:	48 01 d8             	add    %rbx,%rax
+  808746:	ff d0                	call   *%rax
+  808748:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80874b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80874f:	0f 88 e2 01 00 00    	js     808937 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  808755:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  808759:	48 89 c7             	mov    %rax,%rdi
+  80875c:	49 89 df             	mov    %rbx,%r15
+  80875f:	48 b8 85 8d ff ff ff 	movabs $0xffffffffffff8d85,%rax
+  808766:	ff ff ff 
+  808769:	48 01 d8             	add    %rbx,%rax
+  80876c:	ff d0                	call   *%rax
+  80876e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808771:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808775:	0f 88 9b 01 00 00    	js     808916 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80877b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80877f:	ba 07 04 00 00       	mov    $0x407,%edx
+  808784:	48 89 c6             	mov    %rax,%rsi
+  808787:	bf 00 00 00 00       	mov    $0x0,%edi
+  80878c:	49 89 df             	mov    %rbx,%r15
+  80878f:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  808796:	ff ff ff 
+  808799:	48 01 d8             	add    %rbx,%rax
+  80879c:	ff d0                	call   *%rax
+  80879e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8087a1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8087a5:	0f 88 6b 01 00 00    	js     808916 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8087ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8087af:	48 89 c7             	mov    %rax,%rdi
+  8087b2:	49 89 df             	mov    %rbx,%r15
+  8087b5:	48 b8 42 8d ff ff ff 	movabs $0xffffffffffff8d42,%rax
+  8087bc:	ff ff ff 
+  8087bf:	48 01 d8             	add    %rbx,%rax
+  8087c2:	ff d0                	call   *%rax
+  8087c4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8087c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8087cc:	ba 07 04 00 00       	mov    $0x407,%edx
+  8087d1:	48 89 c6             	mov    %rax,%rsi
+  8087d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8087d9:	49 89 df             	mov    %rbx,%r15
+  8087dc:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  8087e3:	ff ff ff 
+  8087e6:	48 01 d8             	add    %rbx,%rax
+  8087e9:	ff d0                	call   *%rax
+  8087eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8087ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8087f2:	0f 88 fd 00 00 00    	js     8088f5 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8087f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8087fc:	48 89 c7             	mov    %rax,%rdi
+  8087ff:	49 89 df             	mov    %rbx,%r15
+  808802:	48 b8 42 8d ff ff ff 	movabs $0xffffffffffff8d42,%rax
+  808809:	ff ff ff 
+  80880c:	48 01 d8             	add    %rbx,%rax
+  80880f:	ff d0                	call   *%rax
+  808811:	48 89 c2             	mov    %rax,%rdx
+  808814:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808818:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80881e:	48 89 d1             	mov    %rdx,%rcx
+  808821:	ba 00 00 00 00       	mov    $0x0,%edx
+  808826:	48 89 c6             	mov    %rax,%rsi
+  808829:	bf 00 00 00 00       	mov    $0x0,%edi
+  80882e:	49 89 df             	mov    %rbx,%r15
+  808831:	48 b8 f0 76 ff ff ff 	movabs $0xffffffffffff76f0,%rax
+  808838:	ff ff ff 
+  80883b:	48 01 d8             	add    %rbx,%rax
+  80883e:	ff d0                	call   *%rax
+  808840:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808843:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808847:	0f 88 87 00 00 00    	js     8088d4 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  80884d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  808851:	48 ba f8 00 00 00 00 	movabs $0xf8,%rdx
+  808858:	00 00 00 
+  80885b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80885e:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  808860:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  808864:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  80886b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80886f:	48 ba f8 00 00 00 00 	movabs $0xf8,%rdx
+  808876:	00 00 00 
+  808879:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80887c:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  80887e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808882:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  808889:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80888d:	48 89 c7             	mov    %rax,%rdi
+  808890:	49 89 df             	mov    %rbx,%r15
+  808893:	48 b8 0b 8d ff ff ff 	movabs $0xffffffffffff8d0b,%rax
+  80889a:	ff ff ff 
+  80889d:	48 01 d8             	add    %rbx,%rax
+  8088a0:	ff d0                	call   *%rax
+  8088a2:	89 c2                	mov    %eax,%edx
+  8088a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8088a8:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8088aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8088ae:	48 89 c7             	mov    %rax,%rdi
+  8088b1:	49 89 df             	mov    %rbx,%r15
+  8088b4:	48 b8 0b 8d ff ff ff 	movabs $0xffffffffffff8d0b,%rax
+  8088bb:	ff ff ff 
+  8088be:	48 01 d8             	add    %rbx,%rax
+  8088c1:	ff d0                	call   *%rax
+  8088c3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8088c7:	48 83 c2 04          	add    $0x4,%rdx
+  8088cb:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  8088cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8088d2:	eb 67                	jmp    80893b <pipe+0x25f>
+		goto err3;
+  8088d4:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  8088d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8088d9:	48 89 c6             	mov    %rax,%rsi
+  8088dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8088e1:	49 89 df             	mov    %rbx,%r15
+  8088e4:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  8088eb:	ff ff ff 
+  8088ee:	48 01 d8             	add    %rbx,%rax
+  8088f1:	ff d0                	call   *%rax
+  8088f3:	eb 01                	jmp    8088f6 <pipe+0x21a>
+		goto err2;
+  8088f5:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  8088f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8088fa:	48 89 c6             	mov    %rax,%rsi
+  8088fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  808902:	49 89 df             	mov    %rbx,%r15
+  808905:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  80890c:	ff ff ff 
+  80890f:	48 01 d8             	add    %rbx,%rax
+  808912:	ff d0                	call   *%rax
+  808914:	eb 01                	jmp    808917 <pipe+0x23b>
+		goto err1;
+  808916:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  808917:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80891b:	48 89 c6             	mov    %rax,%rsi
+  80891e:	bf 00 00 00 00       	mov    $0x0,%edi
+  808923:	49 89 df             	mov    %rbx,%r15
+  808926:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  80892d:	ff ff ff 
+  808930:	48 01 d8             	add    %rbx,%rax
+  808933:	ff d0                	call   *%rax
+  808935:	eb 01                	jmp    808938 <pipe+0x25c>
+		goto err;
+  808937:	90                   	nop
+err:
+	return r;
+  808938:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80893b:	48 83 c4 30          	add    $0x30,%rsp
+  80893f:	5b                   	pop    %rbx
+  808940:	41 5f                	pop    %r15
+  808942:	5d                   	pop    %rbp
+  808943:	c3                   	ret
+
+0000000000808944 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  808944:	55                   	push   %rbp
+  808945:	48 89 e5             	mov    %rsp,%rbp
+  808948:	41 57                	push   %r15
+  80894a:	41 54                	push   %r12
+  80894c:	53                   	push   %rbx
+  80894d:	48 83 ec 28          	sub    $0x28,%rsp
+  808951:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808951 <_pipeisclosed+0xd>
+  808958:	49 bb f7 36 00 00 00 	movabs $0x36f7,%r11
+  80895f:	00 00 00 
+  808962:	4c 01 db             	add    %r11,%rbx
+  808965:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  808969:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80896d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  808974:	ff ff ff 
+  808977:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80897b:	48 8b 00             	mov    (%rax),%rax
+  80897e:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  808984:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  808987:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80898b:	48 89 c7             	mov    %rax,%rdi
+  80898e:	49 89 df             	mov    %rbx,%r15
+  808991:	48 b8 30 d8 ff ff ff 	movabs $0xffffffffffffd830,%rax
+  808998:	ff ff ff 
+  80899b:	48 01 d8             	add    %rbx,%rax
+  80899e:	ff d0                	call   *%rax
+  8089a0:	41 89 c4             	mov    %eax,%r12d
+  8089a3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8089a7:	48 89 c7             	mov    %rax,%rdi
+  8089aa:	49 89 df             	mov    %rbx,%r15
+  8089ad:	48 b8 30 d8 ff ff ff 	movabs $0xffffffffffffd830,%rax
+  8089b4:	ff ff ff 
+  8089b7:	48 01 d8             	add    %rbx,%rax
+  8089ba:	ff d0                	call   *%rax
+  8089bc:	41 39 c4             	cmp    %eax,%r12d
+  8089bf:	0f 94 c0             	sete   %al
+  8089c2:	0f b6 c0             	movzbl %al,%eax
+  8089c5:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  8089c8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8089cf:	ff ff ff 
+  8089d2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8089d6:	48 8b 00             	mov    (%rax),%rax
+  8089d9:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8089df:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  8089e2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8089e5:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8089e8:	75 05                	jne    8089ef <_pipeisclosed+0xab>
+			return ret;
+  8089ea:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8089ed:	eb 63                	jmp    808a52 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  8089ef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8089f2:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8089f5:	0f 84 72 ff ff ff    	je     80896d <_pipeisclosed+0x29>
+  8089fb:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  8089ff:	0f 85 68 ff ff ff    	jne    80896d <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  808a05:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  808a0c:	ff ff ff 
+  808a0f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  808a13:	48 8b 00             	mov    (%rax),%rax
+  808a16:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  808a1c:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  808a1f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808a22:	89 c6                	mov    %eax,%esi
+  808a24:	48 b8 c9 e2 ff ff ff 	movabs $0xffffffffffffe2c9,%rax
+  808a2b:	ff ff ff 
+  808a2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808a32:	48 89 c7             	mov    %rax,%rdi
+  808a35:	49 89 df             	mov    %rbx,%r15
+  808a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  808a3d:	49 b8 4f 5a ff ff ff 	movabs $0xffffffffffff5a4f,%r8
+  808a44:	ff ff ff 
+  808a47:	49 01 d8             	add    %rbx,%r8
+  808a4a:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  808a4d:	e9 1b ff ff ff       	jmp    80896d <_pipeisclosed+0x29>
+	}
+}
+  808a52:	48 83 c4 28          	add    $0x28,%rsp
+  808a56:	5b                   	pop    %rbx
+  808a57:	41 5c                	pop    %r12
+  808a59:	41 5f                	pop    %r15
+  808a5b:	5d                   	pop    %rbp
+  808a5c:	c3                   	ret
+
+0000000000808a5d <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  808a5d:	55                   	push   %rbp
+  808a5e:	48 89 e5             	mov    %rsp,%rbp
+  808a61:	41 57                	push   %r15
+  808a63:	53                   	push   %rbx
+  808a64:	48 83 ec 30          	sub    $0x30,%rsp
+  808a68:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808a68 <pipeisclosed+0xb>
+  808a6f:	49 bb e0 35 00 00 00 	movabs $0x35e0,%r11
+  808a76:	00 00 00 
+  808a79:	4c 01 db             	add    %r11,%rbx
+  808a7c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  808a7f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  808a83:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  808a86:	48 89 d6             	mov    %rdx,%rsi
+  808a89:	89 c7                	mov    %eax,%edi
+  808a8b:	49 89 df             	mov    %rbx,%r15
+  808a8e:	48 b8 3b 8e ff ff ff 	movabs $0xffffffffffff8e3b,%rax
+  808a95:	ff ff ff 
+  808a98:	48 01 d8             	add    %rbx,%rax
+  808a9b:	ff d0                	call   *%rax
+  808a9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  808aa0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  808aa4:	79 05                	jns    808aab <pipeisclosed+0x4e>
+		return r;
+  808aa6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808aa9:	eb 3b                	jmp    808ae6 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  808aab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  808aaf:	48 89 c7             	mov    %rax,%rdi
+  808ab2:	49 89 df             	mov    %rbx,%r15
+  808ab5:	48 b8 42 8d ff ff ff 	movabs $0xffffffffffff8d42,%rax
+  808abc:	ff ff ff 
+  808abf:	48 01 d8             	add    %rbx,%rax
+  808ac2:	ff d0                	call   *%rax
+  808ac4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  808ac8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  808acc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  808ad0:	48 89 d6             	mov    %rdx,%rsi
+  808ad3:	48 89 c7             	mov    %rax,%rdi
+  808ad6:	48 b8 fc c8 ff ff ff 	movabs $0xffffffffffffc8fc,%rax
+  808add:	ff ff ff 
+  808ae0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808ae4:	ff d0                	call   *%rax
+}
+  808ae6:	48 83 c4 30          	add    $0x30,%rsp
+  808aea:	5b                   	pop    %rbx
+  808aeb:	41 5f                	pop    %r15
+  808aed:	5d                   	pop    %rbp
+  808aee:	c3                   	ret
+
+0000000000808aef <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  808aef:	55                   	push   %rbp
+  808af0:	48 89 e5             	mov    %rsp,%rbp
+  808af3:	41 57                	push   %r15
+  808af5:	53                   	push   %rbx
+  808af6:	48 83 ec 40          	sub    $0x40,%rsp
+  808afa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808afa <devpipe_read+0xb>
+  808b01:	49 bb 4e 35 00 00 00 	movabs $0x354e,%r11
+  808b08:	00 00 00 
+  808b0b:	4c 01 db             	add    %r11,%rbx
+  808b0e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  808b12:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  808b16:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  808b1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  808b1e:	48 89 c7             	mov    %rax,%rdi
+  808b21:	49 89 df             	mov    %rbx,%r15
+  808b24:	48 b8 42 8d ff ff ff 	movabs $0xffffffffffff8d42,%rax
+  808b2b:	ff ff ff 
+  808b2e:	48 01 d8             	add    %rbx,%rax
+  808b31:	ff d0                	call   *%rax
+  808b33:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  808b37:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  808b3b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  808b3f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  808b46:	00 
+  808b47:	e9 a1 00 00 00       	jmp    808bed <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  808b4c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  808b51:	74 09                	je     808b5c <devpipe_read+0x6d>
+				return i;
+  808b53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808b57:	e9 9f 00 00 00       	jmp    808bfb <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  808b5c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  808b60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  808b64:	48 89 d6             	mov    %rdx,%rsi
+  808b67:	48 89 c7             	mov    %rax,%rdi
+  808b6a:	48 b8 fc c8 ff ff ff 	movabs $0xffffffffffffc8fc,%rax
+  808b71:	ff ff ff 
+  808b74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808b78:	ff d0                	call   *%rax
+  808b7a:	85 c0                	test   %eax,%eax
+  808b7c:	74 07                	je     808b85 <devpipe_read+0x96>
+				return 0;
+  808b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  808b83:	eb 76                	jmp    808bfb <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  808b85:	49 89 df             	mov    %rbx,%r15
+  808b88:	48 b8 36 76 ff ff ff 	movabs $0xffffffffffff7636,%rax
+  808b8f:	ff ff ff 
+  808b92:	48 01 d8             	add    %rbx,%rax
+  808b95:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  808b97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808b9b:	8b 10                	mov    (%rax),%edx
+  808b9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808ba1:	8b 40 04             	mov    0x4(%rax),%eax
+  808ba4:	39 c2                	cmp    %eax,%edx
+  808ba6:	74 a4                	je     808b4c <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  808ba8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808bac:	8b 10                	mov    (%rax),%edx
+  808bae:	89 d0                	mov    %edx,%eax
+  808bb0:	c1 f8 1f             	sar    $0x1f,%eax
+  808bb3:	c1 e8 1b             	shr    $0x1b,%eax
+  808bb6:	01 c2                	add    %eax,%edx
+  808bb8:	83 e2 1f             	and    $0x1f,%edx
+  808bbb:	29 c2                	sub    %eax,%edx
+  808bbd:	89 d6                	mov    %edx,%esi
+  808bbf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  808bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808bc7:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  808bcb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  808bcf:	48 63 c6             	movslq %esi,%rax
+  808bd2:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  808bd7:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  808bd9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808bdd:	8b 00                	mov    (%rax),%eax
+  808bdf:	8d 50 01             	lea    0x1(%rax),%edx
+  808be2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808be6:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  808be8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  808bed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808bf1:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  808bf5:	72 a0                	jb     808b97 <devpipe_read+0xa8>
+	}
+	return i;
+  808bf7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  808bfb:	48 83 c4 40          	add    $0x40,%rsp
+  808bff:	5b                   	pop    %rbx
+  808c00:	41 5f                	pop    %r15
+  808c02:	5d                   	pop    %rbp
+  808c03:	c3                   	ret
+
+0000000000808c04 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  808c04:	55                   	push   %rbp
+  808c05:	48 89 e5             	mov    %rsp,%rbp
+  808c08:	41 57                	push   %r15
+  808c0a:	53                   	push   %rbx
+  808c0b:	48 83 ec 40          	sub    $0x40,%rsp
+  808c0f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808c0f <devpipe_write+0xb>
+  808c16:	49 bb 39 34 00 00 00 	movabs $0x3439,%r11
+  808c1d:	00 00 00 
+  808c20:	4c 01 db             	add    %r11,%rbx
+  808c23:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  808c27:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  808c2b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  808c2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  808c33:	48 89 c7             	mov    %rax,%rdi
+  808c36:	49 89 df             	mov    %rbx,%r15
+  808c39:	48 b8 42 8d ff ff ff 	movabs $0xffffffffffff8d42,%rax
+  808c40:	ff ff ff 
+  808c43:	48 01 d8             	add    %rbx,%rax
+  808c46:	ff d0                	call   *%rax
+  808c48:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  808c4c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  808c50:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  808c54:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  808c5b:	00 
+  808c5c:	e9 a0 00 00 00       	jmp    808d01 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  808c61:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  808c65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  808c69:	48 89 d6             	mov    %rdx,%rsi
+  808c6c:	48 89 c7             	mov    %rax,%rdi
+  808c6f:	48 b8 fc c8 ff ff ff 	movabs $0xffffffffffffc8fc,%rax
+  808c76:	ff ff ff 
+  808c79:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808c7d:	ff d0                	call   *%rax
+  808c7f:	85 c0                	test   %eax,%eax
+  808c81:	74 0a                	je     808c8d <devpipe_write+0x89>
+				return 0;
+  808c83:	b8 00 00 00 00       	mov    $0x0,%eax
+  808c88:	e9 82 00 00 00       	jmp    808d0f <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  808c8d:	49 89 df             	mov    %rbx,%r15
+  808c90:	48 b8 36 76 ff ff ff 	movabs $0xffffffffffff7636,%rax
+  808c97:	ff ff ff 
+  808c9a:	48 01 d8             	add    %rbx,%rax
+  808c9d:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  808c9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808ca3:	8b 40 04             	mov    0x4(%rax),%eax
+  808ca6:	48 63 d0             	movslq %eax,%rdx
+  808ca9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808cad:	8b 00                	mov    (%rax),%eax
+  808caf:	48 98                	cltq
+  808cb1:	48 83 c0 20          	add    $0x20,%rax
+  808cb5:	48 39 c2             	cmp    %rax,%rdx
+  808cb8:	73 a7                	jae    808c61 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  808cba:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  808cbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808cc2:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  808cc6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808cca:	8b 50 04             	mov    0x4(%rax),%edx
+  808ccd:	89 d0                	mov    %edx,%eax
+  808ccf:	c1 f8 1f             	sar    $0x1f,%eax
+  808cd2:	c1 e8 1b             	shr    $0x1b,%eax
+  808cd5:	01 c2                	add    %eax,%edx
+  808cd7:	83 e2 1f             	and    $0x1f,%edx
+  808cda:	29 c2                	sub    %eax,%edx
+  808cdc:	89 d0                	mov    %edx,%eax
+  808cde:	0f b6 09             	movzbl (%rcx),%ecx
+  808ce1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  808ce5:	48 98                	cltq
+  808ce7:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  808ceb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808cef:	8b 40 04             	mov    0x4(%rax),%eax
+  808cf2:	8d 50 01             	lea    0x1(%rax),%edx
+  808cf5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  808cf9:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  808cfc:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  808d01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808d05:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  808d09:	72 94                	jb     808c9f <devpipe_write+0x9b>
+	}
+
+	return i;
+  808d0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  808d0f:	48 83 c4 40          	add    $0x40,%rsp
+  808d13:	5b                   	pop    %rbx
+  808d14:	41 5f                	pop    %r15
+  808d16:	5d                   	pop    %rbp
+  808d17:	c3                   	ret
+
+0000000000808d18 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  808d18:	55                   	push   %rbp
+  808d19:	48 89 e5             	mov    %rsp,%rbp
+  808d1c:	41 57                	push   %r15
+  808d1e:	53                   	push   %rbx
+  808d1f:	48 83 ec 20          	sub    $0x20,%rsp
+  808d23:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808d23 <devpipe_stat+0xb>
+  808d2a:	49 bb 25 33 00 00 00 	movabs $0x3325,%r11
+  808d31:	00 00 00 
+  808d34:	4c 01 db             	add    %r11,%rbx
+  808d37:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  808d3b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  808d3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  808d43:	48 89 c7             	mov    %rax,%rdi
+  808d46:	49 89 df             	mov    %rbx,%r15
+  808d49:	48 b8 42 8d ff ff ff 	movabs $0xffffffffffff8d42,%rax
+  808d50:	ff ff ff 
+  808d53:	48 01 d8             	add    %rbx,%rax
+  808d56:	ff d0                	call   *%rax
+  808d58:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  808d5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808d60:	48 ba dc e2 ff ff ff 	movabs $0xffffffffffffe2dc,%rdx
+  808d67:	ff ff ff 
+  808d6a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  808d6e:	48 89 d6             	mov    %rdx,%rsi
+  808d71:	48 89 c7             	mov    %rax,%rdi
+  808d74:	49 89 df             	mov    %rbx,%r15
+  808d77:	48 b8 cf 69 ff ff ff 	movabs $0xffffffffffff69cf,%rax
+  808d7e:	ff ff ff 
+  808d81:	48 01 d8             	add    %rbx,%rax
+  808d84:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  808d86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808d8a:	8b 50 04             	mov    0x4(%rax),%edx
+  808d8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808d91:	8b 00                	mov    (%rax),%eax
+  808d93:	29 c2                	sub    %eax,%edx
+  808d95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808d99:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  808d9f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808da3:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  808daa:	00 00 00 
+	stat->st_dev = &devpipe;
+  808dad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808db1:	48 ba f8 00 00 00 00 	movabs $0xf8,%rdx
+  808db8:	00 00 00 
+  808dbb:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  808dbf:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  808dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808dcb:	48 83 c4 20          	add    $0x20,%rsp
+  808dcf:	5b                   	pop    %rbx
+  808dd0:	41 5f                	pop    %r15
+  808dd2:	5d                   	pop    %rbp
+  808dd3:	c3                   	ret
+
+0000000000808dd4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  808dd4:	55                   	push   %rbp
+  808dd5:	48 89 e5             	mov    %rsp,%rbp
+  808dd8:	41 57                	push   %r15
+  808dda:	53                   	push   %rbx
+  808ddb:	48 83 ec 10          	sub    $0x10,%rsp
+  808ddf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808ddf <devpipe_close+0xb>
+  808de6:	49 bb 69 32 00 00 00 	movabs $0x3269,%r11
+  808ded:	00 00 00 
+  808df0:	4c 01 db             	add    %r11,%rbx
+  808df3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  808df7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808dfb:	48 89 c6             	mov    %rax,%rsi
+  808dfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  808e03:	49 89 df             	mov    %rbx,%r15
+  808e06:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  808e0d:	ff ff ff 
+  808e10:	48 01 d8             	add    %rbx,%rax
+  808e13:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  808e15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808e19:	48 89 c7             	mov    %rax,%rdi
+  808e1c:	49 89 df             	mov    %rbx,%r15
+  808e1f:	48 b8 42 8d ff ff ff 	movabs $0xffffffffffff8d42,%rax
+  808e26:	ff ff ff 
+  808e29:	48 01 d8             	add    %rbx,%rax
+  808e2c:	ff d0                	call   *%rax
+  808e2e:	48 89 c6             	mov    %rax,%rsi
+  808e31:	bf 00 00 00 00       	mov    $0x0,%edi
+  808e36:	49 89 df             	mov    %rbx,%r15
+  808e39:	48 b8 63 77 ff ff ff 	movabs $0xffffffffffff7763,%rax
+  808e40:	ff ff ff 
+  808e43:	48 01 d8             	add    %rbx,%rax
+  808e46:	ff d0                	call   *%rax
+}
+  808e48:	48 83 c4 10          	add    $0x10,%rsp
+  808e4c:	5b                   	pop    %rbx
+  808e4d:	41 5f                	pop    %r15
+  808e4f:	5d                   	pop    %rbp
+  808e50:	c3                   	ret
+
+0000000000808e51 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  808e51:	55                   	push   %rbp
+  808e52:	48 89 e5             	mov    %rsp,%rbp
+  808e55:	41 57                	push   %r15
+  808e57:	53                   	push   %rbx
+  808e58:	48 83 ec 20          	sub    $0x20,%rsp
+  808e5c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808e5c <wait+0xb>
+  808e63:	49 bb ec 31 00 00 00 	movabs $0x31ec,%r11
+  808e6a:	00 00 00 
+  808e6d:	4c 01 db             	add    %r11,%rbx
+  808e70:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  808e73:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  808e77:	75 50                	jne    808ec9 <wait+0x78>
+  808e79:	48 b8 e3 e2 ff ff ff 	movabs $0xffffffffffffe2e3,%rax
+  808e80:	ff ff ff 
+  808e83:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808e87:	48 89 c1             	mov    %rax,%rcx
+  808e8a:	48 b8 ee e2 ff ff ff 	movabs $0xffffffffffffe2ee,%rax
+  808e91:	ff ff ff 
+  808e94:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808e98:	48 89 c2             	mov    %rax,%rdx
+  808e9b:	be 09 00 00 00       	mov    $0x9,%esi
+  808ea0:	48 b8 03 e3 ff ff ff 	movabs $0xffffffffffffe303,%rax
+  808ea7:	ff ff ff 
+  808eaa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808eae:	48 89 c7             	mov    %rax,%rdi
+  808eb1:	49 89 df             	mov    %rbx,%r15
+  808eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  808eb9:	49 b8 78 57 ff ff ff 	movabs $0xffffffffffff5778,%r8
+  808ec0:	ff ff ff 
+  808ec3:	49 01 d8             	add    %rbx,%r8
+  808ec6:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  808ec9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  808ecc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  808ed1:	48 98                	cltq
+  808ed3:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  808eda:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  808ee1:	ff ff ff 
+  808ee4:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  808ee8:	48 01 d0             	add    %rdx,%rax
+  808eeb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  808eef:	eb 12                	jmp    808f03 <wait+0xb2>
+		sys_yield();
+  808ef1:	49 89 df             	mov    %rbx,%r15
+  808ef4:	48 b8 36 76 ff ff ff 	movabs $0xffffffffffff7636,%rax
+  808efb:	ff ff ff 
+  808efe:	48 01 d8             	add    %rbx,%rax
+  808f01:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  808f03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808f07:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  808f0d:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  808f10:	75 0e                	jne    808f20 <wait+0xcf>
+  808f12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  808f16:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  808f1c:	85 c0                	test   %eax,%eax
+  808f1e:	75 d1                	jne    808ef1 <wait+0xa0>
+}
+  808f20:	90                   	nop
+  808f21:	48 83 c4 20          	add    $0x20,%rsp
+  808f25:	5b                   	pop    %rbx
+  808f26:	41 5f                	pop    %r15
+  808f28:	5d                   	pop    %rbp
+  808f29:	c3                   	ret
+
+0000000000808f2a <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  808f2a:	55                   	push   %rbp
+  808f2b:	48 89 e5             	mov    %rsp,%rbp
+  808f2e:	41 57                	push   %r15
+  808f30:	53                   	push   %rbx
+  808f31:	48 83 ec 20          	sub    $0x20,%rsp
+  808f35:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 808f35 <set_pgfault_handler+0xb>
+  808f3c:	49 bb 13 31 00 00 00 	movabs $0x3113,%r11
+  808f43:	00 00 00 
+  808f46:	4c 01 db             	add    %r11,%rbx
+  808f49:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  808f4d:	49 89 df             	mov    %rbx,%r15
+  808f50:	48 b8 e2 75 ff ff ff 	movabs $0xffffffffffff75e2,%rax
+  808f57:	ff ff ff 
+  808f5a:	48 01 d8             	add    %rbx,%rax
+  808f5d:	ff d0                	call   *%rax
+  808f5f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  808f62:	48 b8 b8 5f 01 00 00 	movabs $0x15fb8,%rax
+  808f69:	00 00 00 
+  808f6c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  808f70:	48 85 c0             	test   %rax,%rax
+  808f73:	75 6b                	jne    808fe0 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  808f75:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808f78:	ba 07 00 00 00       	mov    $0x7,%edx
+  808f7d:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  808f82:	48 89 ce             	mov    %rcx,%rsi
+  808f85:	89 c7                	mov    %eax,%edi
+  808f87:	49 89 df             	mov    %rbx,%r15
+  808f8a:	48 b8 8b 76 ff ff ff 	movabs $0xffffffffffff768b,%rax
+  808f91:	ff ff ff 
+  808f94:	48 01 d8             	add    %rbx,%rax
+  808f97:	ff d0                	call   *%rax
+  808f99:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  808f9c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  808fa0:	74 3e                	je     808fe0 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  808fa2:	48 b8 10 e3 ff ff ff 	movabs $0xffffffffffffe310,%rax
+  808fa9:	ff ff ff 
+  808fac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808fb0:	48 89 c2             	mov    %rax,%rdx
+  808fb3:	be 23 00 00 00       	mov    $0x23,%esi
+  808fb8:	48 b8 3e e3 ff ff ff 	movabs $0xffffffffffffe33e,%rax
+  808fbf:	ff ff ff 
+  808fc2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  808fc6:	48 89 c7             	mov    %rax,%rdi
+  808fc9:	49 89 df             	mov    %rbx,%r15
+  808fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  808fd1:	48 b9 78 57 ff ff ff 	movabs $0xffffffffffff5778,%rcx
+  808fd8:	ff ff ff 
+  808fdb:	48 01 d9             	add    %rbx,%rcx
+  808fde:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  808fe0:	48 ba b8 5f 01 00 00 	movabs $0x15fb8,%rdx
+  808fe7:	00 00 00 
+  808fea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  808fee:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  808ff2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  808ff5:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  808ffc:	ff ff ff 
+  808fff:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  809003:	48 89 d6             	mov    %rdx,%rsi
+  809006:	89 c7                	mov    %eax,%edi
+  809008:	49 89 df             	mov    %rbx,%r15
+  80900b:	48 b8 81 78 ff ff ff 	movabs $0xffffffffffff7881,%rax
+  809012:	ff ff ff 
+  809015:	48 01 d8             	add    %rbx,%rax
+  809018:	ff d0                	call   *%rax
+}
+  80901a:	90                   	nop
+  80901b:	48 83 c4 20          	add    $0x20,%rsp
+  80901f:	5b                   	pop    %rbx
+  809020:	41 5f                	pop    %r15
+  809022:	5d                   	pop    %rbp
+  809023:	c3                   	ret
+
+0000000000809024 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  809024:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  809027:	48 a1 00 20 82 00 00 	movabs 0x822000,%rax
+  80902e:	00 00 00 
+call *%rax
+  809031:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  809033:	58                   	pop    %rax
+	popq %rax;
+  809034:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  809035:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  80903c:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  809040:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  809044:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  809048:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  80904c:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  809050:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  809053:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  809057:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80905b:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  809060:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  809065:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80906a:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80906f:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  809074:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  809079:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80907e:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  809083:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  809088:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80908d:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  809092:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  809097:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80909c:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8090a1:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  8090a5:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  8090a9:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  8090aa:	5c                   	pop    %rsp
+	ret;			//return
+  8090ab:	c3                   	ret
+
+00000000008090ac <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8090ac:	55                   	push   %rbp
+  8090ad:	48 89 e5             	mov    %rsp,%rbp
+  8090b0:	41 57                	push   %r15
+  8090b2:	53                   	push   %rbx
+  8090b3:	48 83 ec 30          	sub    $0x30,%rsp
+  8090b7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8090b7 <ipc_recv+0xb>
+  8090be:	49 bb 91 2f 00 00 00 	movabs $0x2f91,%r11
+  8090c5:	00 00 00 
+  8090c8:	4c 01 db             	add    %r11,%rbx
+  8090cb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8090cf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8090d3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8090d7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8090dc:	75 0e                	jne    8090ec <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8090de:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8090e5:	00 00 00 
+  8090e8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8090ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8090f0:	48 89 c7             	mov    %rax,%rdi
+  8090f3:	49 89 df             	mov    %rbx,%r15
+  8090f6:	48 b8 b4 79 ff ff ff 	movabs $0xffffffffffff79b4,%rax
+  8090fd:	ff ff ff 
+  809100:	48 01 d8             	add    %rbx,%rax
+  809103:	ff d0                	call   *%rax
+  809105:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  809108:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80910d:	74 2a                	je     809139 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  80910f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809113:	75 19                	jne    80912e <ipc_recv+0x82>
+  809115:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80911c:	ff ff ff 
+  80911f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  809123:	48 8b 00             	mov    (%rax),%rax
+  809126:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  80912c:	eb 05                	jmp    809133 <ipc_recv+0x87>
+  80912e:	b8 00 00 00 00       	mov    $0x0,%eax
+  809133:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  809137:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  809139:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80913e:	74 2a                	je     80916a <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  809140:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809144:	75 19                	jne    80915f <ipc_recv+0xb3>
+  809146:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80914d:	ff ff ff 
+  809150:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  809154:	48 8b 00             	mov    (%rax),%rax
+  809157:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80915d:	eb 05                	jmp    809164 <ipc_recv+0xb8>
+  80915f:	b8 00 00 00 00       	mov    $0x0,%eax
+  809164:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  809168:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80916a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80916e:	74 05                	je     809175 <ipc_recv+0xc9>
+		return res;
+  809170:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809173:	eb 17                	jmp    80918c <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  809175:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80917c:	ff ff ff 
+  80917f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  809183:	48 8b 00             	mov    (%rax),%rax
+  809186:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80918c:	48 83 c4 30          	add    $0x30,%rsp
+  809190:	5b                   	pop    %rbx
+  809191:	41 5f                	pop    %r15
+  809193:	5d                   	pop    %rbp
+  809194:	c3                   	ret
+
+0000000000809195 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  809195:	55                   	push   %rbp
+  809196:	48 89 e5             	mov    %rsp,%rbp
+  809199:	41 57                	push   %r15
+  80919b:	53                   	push   %rbx
+  80919c:	48 83 ec 20          	sub    $0x20,%rsp
+  8091a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8091a0 <ipc_send+0xb>
+  8091a7:	49 bb a8 2e 00 00 00 	movabs $0x2ea8,%r11
+  8091ae:	00 00 00 
+  8091b1:	4c 01 db             	add    %r11,%rbx
+  8091b4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8091b7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8091ba:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8091be:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8091c1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8091c6:	75 0e                	jne    8091d6 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8091c8:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8091cf:	00 00 00 
+  8091d2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8091d6:	90                   	nop
+  8091d7:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8091da:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8091dd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8091e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8091e4:	89 c7                	mov    %eax,%edi
+  8091e6:	49 89 df             	mov    %rbx,%r15
+  8091e9:	48 b8 4a 79 ff ff ff 	movabs $0xffffffffffff794a,%rax
+  8091f0:	ff ff ff 
+  8091f3:	48 01 d8             	add    %rbx,%rax
+  8091f6:	ff d0                	call   *%rax
+  8091f8:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8091fb:	74 da                	je     8091d7 <ipc_send+0x42>
+		;
+}
+  8091fd:	90                   	nop
+  8091fe:	90                   	nop
+  8091ff:	48 83 c4 20          	add    $0x20,%rsp
+  809203:	5b                   	pop    %rbx
+  809204:	41 5f                	pop    %r15
+  809206:	5d                   	pop    %rbp
+  809207:	c3                   	ret
+
+0000000000809208 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  809208:	55                   	push   %rbp
+  809209:	48 89 e5             	mov    %rsp,%rbp
+  80920c:	41 57                	push   %r15
+  80920e:	53                   	push   %rbx
+  80920f:	48 83 ec 40          	sub    $0x40,%rsp
+  809213:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 809213 <ipc_call+0xb>
+  80921a:	49 bb 35 2e 00 00 00 	movabs $0x2e35,%r11
+  809221:	00 00 00 
+  809224:	4c 01 db             	add    %r11,%rbx
+  809227:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80922a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80922d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  809231:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  809234:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  809238:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80923c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  809241:	75 0e                	jne    809251 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  809243:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80924a:	00 00 00 
+  80924d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  809251:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  809256:	75 0e                	jne    809266 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  809258:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80925f:	00 00 00 
+  809262:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  809266:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  809269:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80926d:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  809270:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  809274:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  809277:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80927d:	49 89 f8             	mov    %rdi,%r8
+  809280:	89 c7                	mov    %eax,%edi
+  809282:	49 89 df             	mov    %rbx,%r15
+  809285:	48 b8 0d 7a ff ff ff 	movabs $0xffffffffffff7a0d,%rax
+  80928c:	ff ff ff 
+  80928f:	48 01 d8             	add    %rbx,%rax
+  809292:	ff d0                	call   *%rax
+  809294:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  809297:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80929c:	74 2a                	je     8092c8 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80929e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8092a2:	75 19                	jne    8092bd <ipc_call+0xb5>
+  8092a4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8092ab:	ff ff ff 
+  8092ae:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8092b2:	48 8b 00             	mov    (%rax),%rax
+  8092b5:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8092bb:	eb 05                	jmp    8092c2 <ipc_call+0xba>
+  8092bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8092c2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8092c6:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8092c8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8092cc:	74 05                	je     8092d3 <ipc_call+0xcb>
+		return r;
+  8092ce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8092d1:	eb 17                	jmp    8092ea <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8092d3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8092da:	ff ff ff 
+  8092dd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8092e1:	48 8b 00             	mov    (%rax),%rax
+  8092e4:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8092ea:	48 83 c4 40          	add    $0x40,%rsp
+  8092ee:	5b                   	pop    %rbx
+  8092ef:	41 5f                	pop    %r15
+  8092f1:	5d                   	pop    %rbp
+  8092f2:	c3                   	ret
+
+00000000008092f3 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8092f3:	55                   	push   %rbp
+  8092f4:	48 89 e5             	mov    %rsp,%rbp
+  8092f7:	41 57                	push   %r15
+  8092f9:	53                   	push   %rbx
+  8092fa:	48 83 ec 70          	sub    $0x70,%rsp
+  8092fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8092fe <ipc_callw+0xb>
+  809305:	49 bb 4a 2d 00 00 00 	movabs $0x2d4a,%r11
+  80930c:	00 00 00 
+  80930f:	4c 01 db             	add    %r11,%rbx
+  809312:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  809315:	89 75 98             	mov    %esi,-0x68(%rbp)
+  809318:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  80931c:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  809320:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  809325:	76 0a                	jbe    809331 <ipc_callw+0x3e>
+		return -E_INVAL;
+  809327:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80932c:	e9 b7 00 00 00       	jmp    8093e8 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  809331:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  809335:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  809339:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80933d:	48 89 ce             	mov    %rcx,%rsi
+  809340:	48 89 c7             	mov    %rax,%rdi
+  809343:	49 89 df             	mov    %rbx,%r15
+  809346:	48 b8 af 6d ff ff ff 	movabs $0xffffffffffff6daf,%rax
+  80934d:	ff ff ff 
+  809350:	48 01 d8             	add    %rbx,%rax
+  809353:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  809355:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80935c:	00 
+  80935d:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  809361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  809365:	48 01 d0             	add    %rdx,%rax
+  809368:	48 83 e8 01          	sub    $0x1,%rax
+  80936c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  809370:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809374:	ba 00 00 00 00       	mov    $0x0,%edx
+  809379:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80937d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  809381:	48 29 d0             	sub    %rdx,%rax
+  809384:	48 c1 e8 03          	shr    $0x3,%rax
+  809388:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  80938c:	89 c1                	mov    %eax,%ecx
+  80938e:	8b 75 98             	mov    -0x68(%rbp),%esi
+  809391:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  809395:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  809398:	49 89 d1             	mov    %rdx,%r9
+  80939b:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8093a2:	00 00 00 
+  8093a5:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8093ac:	00 00 00 
+  8093af:	89 c7                	mov    %eax,%edi
+  8093b1:	49 89 df             	mov    %rbx,%r15
+  8093b4:	48 b8 0d 7a ff ff ff 	movabs $0xffffffffffff7a0d,%rax
+  8093bb:	ff ff ff 
+  8093be:	48 01 d8             	add    %rbx,%rax
+  8093c1:	ff d0                	call   *%rax
+  8093c3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8093c6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8093ca:	74 05                	je     8093d1 <ipc_callw+0xde>
+		return r;
+  8093cc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8093cf:	eb 17                	jmp    8093e8 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8093d1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8093d8:	ff ff ff 
+  8093db:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8093df:	48 8b 00             	mov    (%rax),%rax
+  8093e2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8093e8:	48 83 c4 70          	add    $0x70,%rsp
+  8093ec:	5b                   	pop    %rbx
+  8093ed:	41 5f                	pop    %r15
+  8093ef:	5d                   	pop    %rbp
+  8093f0:	c3                   	ret
+
+00000000008093f1 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8093f1:	55                   	push   %rbp
+  8093f2:	48 89 e5             	mov    %rsp,%rbp
+  8093f5:	41 57                	push   %r15
+  8093f7:	53                   	push   %rbx
+  8093f8:	48 83 ec 40          	sub    $0x40,%rsp
+  8093fc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8093fc <ipc_callv+0xb>
+  809403:	49 bb 4c 2c 00 00 00 	movabs $0x2c4c,%r11
+  80940a:	00 00 00 
+  80940d:	4c 01 db             	add    %r11,%rbx
+  809410:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  809413:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  809416:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80941a:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80941d:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  809421:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  809425:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80942c:	00 00 00 
+  80942f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  809433:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  809437:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80943b:	74 11                	je     80944e <ipc_callv+0x5d>
+		pg = (void *) segs;
+  80943d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  809441:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  809445:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  809448:	c1 e0 14             	shl    $0x14,%eax
+  80944b:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  80944e:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  809452:	74 14                	je     809468 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  809454:	8b 45 20             	mov    0x20(%rbp),%eax
+  809457:	83 e8 01             	sub    $0x1,%eax
+  80945a:	48 63 d0             	movslq %eax,%rdx
+  80945d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  809461:	48 09 d0             	or     %rdx,%rax
+  809464:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  809468:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80946b:	c1 e0 10             	shl    $0x10,%eax
+  80946e:	0b 45 10             	or     0x10(%rbp),%eax
+  809471:	89 c1                	mov    %eax,%ecx
+  809473:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  809476:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80947a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80947e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  809482:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  809485:	4d 89 c1             	mov    %r8,%r9
+  809488:	49 89 f8             	mov    %rdi,%r8
+  80948b:	89 c7                	mov    %eax,%edi
+  80948d:	49 89 df             	mov    %rbx,%r15
+  809490:	48 b8 0d 7a ff ff ff 	movabs $0xffffffffffff7a0d,%rax
+  809497:	ff ff ff 
+  80949a:	48 01 d8             	add    %rbx,%rax
+  80949d:	ff d0                	call   *%rax
+  80949f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8094a2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8094a6:	74 05                	je     8094ad <ipc_callv+0xbc>
+		return r;
+  8094a8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8094ab:	eb 17                	jmp    8094c4 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8094ad:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8094b4:	ff ff ff 
+  8094b7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8094bb:	48 8b 00             	mov    (%rax),%rax
+  8094be:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8094c4:	48 83 c4 40          	add    $0x40,%rsp
+  8094c8:	5b                   	pop    %rbx
+  8094c9:	41 5f                	pop    %r15
+  8094cb:	5d                   	pop    %rbp
+  8094cc:	c3                   	ret
+
+00000000008094cd <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8094cd:	55                   	push   %rbp
+  8094ce:	48 89 e5             	mov    %rsp,%rbp
+  8094d1:	41 57                	push   %r15
+  8094d3:	53                   	push   %rbx
+  8094d4:	48 83 ec 40          	sub    $0x40,%rsp
+  8094d8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8094d8 <ipc_reply_recv+0xb>
+  8094df:	49 bb 70 2b 00 00 00 	movabs $0x2b70,%r11
+  8094e6:	00 00 00 
+  8094e9:	4c 01 db             	add    %r11,%rbx
+  8094ec:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8094ef:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8094f2:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8094f6:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8094f9:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8094fd:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  809501:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  809506:	75 0e                	jne    809516 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  809508:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80950f:	00 00 00 
+  809512:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  809516:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80951b:	75 0e                	jne    80952b <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80951d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  809524:	00 00 00 
+  809527:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  80952b:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80952e:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  809532:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  809536:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  809539:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80953d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  809540:	4d 89 c1             	mov    %r8,%r9
+  809543:	49 89 f8             	mov    %rdi,%r8
+  809546:	89 c7                	mov    %eax,%edi
+  809548:	49 89 df             	mov    %rbx,%r15
+  80954b:	48 b8 81 7a ff ff ff 	movabs $0xffffffffffff7a81,%rax
+  809552:	ff ff ff 
+  809555:	48 01 d8             	add    %rbx,%rax
+  809558:	ff d0                	call   *%rax
+  80955a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  80955d:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  809562:	74 2a                	je     80958e <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  809564:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809568:	75 19                	jne    809583 <ipc_reply_recv+0xb6>
+  80956a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  809571:	ff ff ff 
+  809574:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  809578:	48 8b 00             	mov    (%rax),%rax
+  80957b:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  809581:	eb 05                	jmp    809588 <ipc_reply_recv+0xbb>
+  809583:	b8 00 00 00 00       	mov    $0x0,%eax
+  809588:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80958c:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  80958e:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  809593:	74 2a                	je     8095bf <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  809595:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  809599:	75 19                	jne    8095b4 <ipc_reply_recv+0xe7>
+  80959b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8095a2:	ff ff ff 
+  8095a5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8095a9:	48 8b 00             	mov    (%rax),%rax
+  8095ac:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8095b2:	eb 05                	jmp    8095b9 <ipc_reply_recv+0xec>
+  8095b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8095b9:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  8095bd:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8095bf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8095c3:	74 05                	je     8095ca <ipc_reply_recv+0xfd>
+		return r;
+  8095c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8095c8:	eb 17                	jmp    8095e1 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  8095ca:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8095d1:	ff ff ff 
+  8095d4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8095d8:	48 8b 00             	mov    (%rax),%rax
+  8095db:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8095e1:	48 83 c4 40          	add    $0x40,%rsp
+  8095e5:	5b                   	pop    %rbx
+  8095e6:	41 5f                	pop    %r15
+  8095e8:	5d                   	pop    %rbp
+  8095e9:	c3                   	ret
+
+00000000008095ea <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  8095ea:	55                   	push   %rbp
+  8095eb:	48 89 e5             	mov    %rsp,%rbp
+  8095ee:	41 57                	push   %r15
+  8095f0:	53                   	push   %rbx
+  8095f1:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  8095f8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8095f8 <ipc_window_batch+0xe>
+  8095ff:	49 bb 50 2a 00 00 00 	movabs $0x2a50,%r11
+  809606:	00 00 00 
+  809609:	4c 01 db             	add    %r11,%rbx
+  80960c:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  809612:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  809619:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  80961f:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  809625:	e9 15 01 00 00       	jmp    80973f <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  80962a:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  809630:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  809633:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  80963a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80963d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  809640:	39 c2                	cmp    %eax,%edx
+  809642:	0f 4e c2             	cmovle %edx,%eax
+  809645:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  809648:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80964f:	eb 6b                	jmp    8096bc <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  809651:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809654:	48 98                	cltq
+  809656:	48 c1 e0 05          	shl    $0x5,%rax
+  80965a:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80965e:	48 01 e8             	add    %rbp,%rax
+  809661:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  809667:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  80966d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809670:	c1 e0 0c             	shl    $0xc,%eax
+  809673:	48 63 d0             	movslq %eax,%rdx
+  809676:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  80967d:	48 01 c2             	add    %rax,%rdx
+  809680:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  809683:	48 98                	cltq
+  809685:	48 c1 e0 05          	shl    $0x5,%rax
+  809689:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  80968d:	48 01 e8             	add    %rbp,%rax
+  809690:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  809696:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  809699:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80969c:	48 98                	cltq
+  80969e:	48 c1 e0 05          	shl    $0x5,%rax
+  8096a2:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8096a6:	48 01 e8             	add    %rbp,%rax
+  8096a9:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  8096b0:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  8096b6:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  8096b8:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8096bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8096bf:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  8096c2:	7c 8d                	jl     809651 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  8096c4:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8096cb:	74 27                	je     8096f4 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  8096cd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8096d0:	48 63 d0             	movslq %eax,%rdx
+  8096d3:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  8096da:	48 89 d6             	mov    %rdx,%rsi
+  8096dd:	48 89 c7             	mov    %rax,%rdi
+  8096e0:	49 89 df             	mov    %rbx,%r15
+  8096e3:	48 b8 24 7d ff ff ff 	movabs $0xffffffffffff7d24,%rax
+  8096ea:	ff ff ff 
+  8096ed:	48 01 d8             	add    %rbx,%rax
+  8096f0:	ff d0                	call   *%rax
+  8096f2:	eb 25                	jmp    809719 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  8096f4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8096f7:	48 63 d0             	movslq %eax,%rdx
+  8096fa:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  809701:	48 89 d6             	mov    %rdx,%rsi
+  809704:	48 89 c7             	mov    %rax,%rdi
+  809707:	49 89 df             	mov    %rbx,%r15
+  80970a:	48 b8 82 7d ff ff ff 	movabs $0xffffffffffff7d82,%rax
+  809711:	ff ff ff 
+  809714:	48 01 d8             	add    %rbx,%rax
+  809717:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  809719:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  80971c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  809720:	79 05                	jns    809727 <ipc_window_batch+0x13d>
+			return r;
+  809722:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  809725:	eb 2a                	jmp    809751 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  809727:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80972a:	c1 e0 0c             	shl    $0xc,%eax
+  80972d:	48 98                	cltq
+  80972f:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  809736:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  809739:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  80973f:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  809746:	0f 8f de fe ff ff    	jg     80962a <ipc_window_batch+0x40>
+	}
+	return 0;
+  80974c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  809751:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  809758:	5b                   	pop    %rbx
+  809759:	41 5f                	pop    %r15
+  80975b:	5d                   	pop    %rbp
+  80975c:	c3                   	ret
+
+000000000080975d <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  80975d:	55                   	push   %rbp
+  80975e:	48 89 e5             	mov    %rsp,%rbp
+  809761:	48 83 ec 10          	sub    $0x10,%rsp
+  809765:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 809765 <ipc_map_window+0x8>
+  80976c:	49 bb e3 28 00 00 00 	movabs $0x28e3,%r11
+  809773:	00 00 00 
+  809776:	4c 01 d8             	add    %r11,%rax
+  809779:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80977d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  809780:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  809783:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  809787:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80978c:	bf 01 00 00 00       	mov    $0x1,%edi
+  809791:	49 b8 a2 d5 ff ff ff 	movabs $0xffffffffffffd5a2,%r8
+  809798:	ff ff ff 
+  80979b:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80979f:	ff d0                	call   *%rax
+}
+  8097a1:	c9                   	leave
+  8097a2:	c3                   	ret
+
+00000000008097a3 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  8097a3:	55                   	push   %rbp
+  8097a4:	48 89 e5             	mov    %rsp,%rbp
+  8097a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8097ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8097ab <ipc_unmap_window+0x8>
+  8097b2:	49 bb 9d 28 00 00 00 	movabs $0x289d,%r11
+  8097b9:	00 00 00 
+  8097bc:	4c 01 d8             	add    %r11,%rax
+  8097bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8097c3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  8097c6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8097c9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8097cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8097d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8097d7:	49 b8 a2 d5 ff ff ff 	movabs $0xffffffffffffd5a2,%r8
+  8097de:	ff ff ff 
+  8097e1:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8097e5:	ff d0                	call   *%rax
+}
+  8097e7:	c9                   	leave
+  8097e8:	c3                   	ret
+
+00000000008097e9 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8097e9:	55                   	push   %rbp
+  8097ea:	48 89 e5             	mov    %rsp,%rbp
+  8097ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8097f1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8097f1 <ipc_find_env+0x8>
+  8097f8:	49 bb 57 28 00 00 00 	movabs $0x2857,%r11
+  8097ff:	00 00 00 
+  809802:	4c 01 d8             	add    %r11,%rax
+  809805:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  809808:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80980f:	eb 57                	jmp    809868 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  809811:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  809818:	ff ff ff 
+  80981b:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  80981f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  809822:	48 63 d2             	movslq %edx,%rdx
+  809825:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  80982c:	48 01 ca             	add    %rcx,%rdx
+  80982f:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  809836:	8b 12                	mov    (%rdx),%edx
+  809838:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  80983b:	75 27                	jne    809864 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  80983d:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  809844:	ff ff ff 
+  809847:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80984b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80984e:	48 98                	cltq
+  809850:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  809857:	48 01 d0             	add    %rdx,%rax
+  80985a:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  809860:	8b 00                	mov    (%rax),%eax
+  809862:	eb 12                	jmp    809876 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  809864:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  809868:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80986f:	7e a0                	jle    809811 <ipc_find_env+0x28>
+	}
+	return 0;
+  809871:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  809876:	c9                   	leave
+  809877:	c3                   	ret
+
+0000000000809878 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  809878:	55                   	push   %rbp
+  809879:	48 89 e5             	mov    %rsp,%rbp
+  80987c:	48 83 ec 18          	sub    $0x18,%rsp
+  809880:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 809880 <pageref+0x8>
+  809887:	49 bb c8 27 00 00 00 	movabs $0x27c8,%r11
+  80988e:	00 00 00 
+  809891:	4c 01 d8             	add    %r11,%rax
+  809894:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  809898:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80989c:	48 89 d1             	mov    %rdx,%rcx
+  80989f:	48 c1 e9 15          	shr    $0x15,%rcx
+  8098a3:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8098aa:	ff ff ff 
+  8098ad:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8098b1:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8098b5:	83 e2 01             	and    $0x1,%edx
+  8098b8:	48 85 d2             	test   %rdx,%rdx
+  8098bb:	75 07                	jne    8098c4 <pageref+0x4c>
+		return 0;
+  8098bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8098c2:	eb 64                	jmp    809928 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  8098c4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8098c8:	48 89 d1             	mov    %rdx,%rcx
+  8098cb:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8098cf:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8098d6:	ff ff ff 
+  8098d9:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8098dd:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8098e1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8098e5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8098e9:	83 e2 01             	and    $0x1,%edx
+  8098ec:	48 85 d2             	test   %rdx,%rdx
+  8098ef:	75 07                	jne    8098f8 <pageref+0x80>
+		return 0;
+  8098f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8098f6:	eb 30                	jmp    809928 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8098f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8098fc:	48 c1 ea 0c          	shr    $0xc,%rdx
+  809900:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  809907:	ff ff ff 
+  80990a:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  80990e:	48 89 d0             	mov    %rdx,%rax
+  809911:	48 01 c0             	add    %rax,%rax
+  809914:	48 01 d0             	add    %rdx,%rax
+  809917:	48 c1 e0 03          	shl    $0x3,%rax
+  80991b:	48 01 c8             	add    %rcx,%rax
+  80991e:	48 83 c0 08          	add    $0x8,%rax
+  809922:	0f b7 00             	movzwl (%rax),%eax
+  809925:	0f b7 c0             	movzwl %ax,%eax
+}
+  809928:	c9                   	leave
+  809929:	c3                   	ret
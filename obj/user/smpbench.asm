@@ -0,0 +1,10898 @@
+
+obj/user/smpbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 33 03 00 00       	call   800374 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <worker>:
+#define NFORKS		50
+#define NROUNDS		2000
+
+static void
+worker(int id)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <worker+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	envid_t who;
+	uint32_t v;
+	int i;
+
+	for (i = 0; i < NFORKS; i++) {
+  800065:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80006c:	e9 94 00 00 00       	jmp    800105 <worker+0xc2>
+		if ((who = fork()) < 0)
+  800071:	49 89 df             	mov    %rbx,%r15
+  800074:	48 b8 22 a1 ff ff ff 	movabs $0xffffffffffffa122,%rax
+  80007b:	ff ff ff 
+  80007e:	48 01 d8             	add    %rbx,%rax
+  800081:	ff d0                	call   *%rax
+  800083:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800086:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800089:	85 c0                	test   %eax,%eax
+  80008b:	79 44                	jns    8000d1 <worker+0x8e>
+			panic("fork: %e", who);
+  80008d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800090:	89 c1                	mov    %eax,%ecx
+  800092:	48 b8 38 e0 ff ff ff 	movabs $0xffffffffffffe038,%rax
+  800099:	ff ff ff 
+  80009c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000a0:	48 89 c2             	mov    %rax,%rdx
+  8000a3:	be 14 00 00 00       	mov    $0x14,%esi
+  8000a8:	48 b8 41 e0 ff ff ff 	movabs $0xffffffffffffe041,%rax
+  8000af:	ff ff ff 
+  8000b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000b6:	48 89 c7             	mov    %rax,%rdi
+  8000b9:	49 89 df             	mov    %rbx,%r15
+  8000bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c1:	49 b8 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r8
+  8000c8:	ff ff ff 
+  8000cb:	49 01 d8             	add    %rbx,%r8
+  8000ce:	41 ff d0             	call   *%r8
+		if (who == 0)
+  8000d1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8000d4:	85 c0                	test   %eax,%eax
+  8000d6:	75 12                	jne    8000ea <worker+0xa7>
+			exit();
+  8000d8:	49 89 df             	mov    %rbx,%r15
+  8000db:	48 b8 f4 73 ff ff ff 	movabs $0xffffffffffff73f4,%rax
+  8000e2:	ff ff ff 
+  8000e5:	48 01 d8             	add    %rbx,%rax
+  8000e8:	ff d0                	call   *%rax
+		wait(who);
+  8000ea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8000ed:	89 c7                	mov    %eax,%edi
+  8000ef:	49 89 df             	mov    %rbx,%r15
+  8000f2:	48 b8 c2 d7 ff ff ff 	movabs $0xffffffffffffd7c2,%rax
+  8000f9:	ff ff ff 
+  8000fc:	48 01 d8             	add    %rbx,%rax
+  8000ff:	ff d0                	call   *%rax
+	for (i = 0; i < NFORKS; i++) {
+  800101:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  800105:	83 7d ec 31          	cmpl   $0x31,-0x14(%rbp)
+  800109:	0f 8e 62 ff ff ff    	jle    800071 <worker+0x2e>
+	}
+
+	if ((who = fork()) < 0)
+  80010f:	49 89 df             	mov    %rbx,%r15
+  800112:	48 b8 22 a1 ff ff ff 	movabs $0xffffffffffffa122,%rax
+  800119:	ff ff ff 
+  80011c:	48 01 d8             	add    %rbx,%rax
+  80011f:	ff d0                	call   *%rax
+  800121:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800124:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800127:	85 c0                	test   %eax,%eax
+  800129:	79 44                	jns    80016f <worker+0x12c>
+		panic("fork: %e", who);
+  80012b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80012e:	89 c1                	mov    %eax,%ecx
+  800130:	48 b8 38 e0 ff ff ff 	movabs $0xffffffffffffe038,%rax
+  800137:	ff ff ff 
+  80013a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80013e:	48 89 c2             	mov    %rax,%rdx
+  800141:	be 1b 00 00 00       	mov    $0x1b,%esi
+  800146:	48 b8 41 e0 ff ff ff 	movabs $0xffffffffffffe041,%rax
+  80014d:	ff ff ff 
+  800150:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800154:	48 89 c7             	mov    %rax,%rdi
+  800157:	49 89 df             	mov    %rbx,%r15
+  80015a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015f:	49 b8 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r8
+  800166:	ff ff ff 
+  800169:	49 01 d8             	add    %rbx,%r8
+  80016c:	41 ff d0             	call   *%r8
+	if (who == 0) {
+  80016f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800172:	85 c0                	test   %eax,%eax
+  800174:	75 72                	jne    8001e8 <worker+0x1a5>
+		for (i = 0; i < NROUNDS; i++) {
+  800176:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80017d:	eb 4e                	jmp    8001cd <worker+0x18a>
+			v = ipc_recv(&who, 0, 0);
+  80017f:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+  800183:	ba 00 00 00 00       	mov    $0x0,%edx
+  800188:	be 00 00 00 00       	mov    $0x0,%esi
+  80018d:	48 89 c7             	mov    %rax,%rdi
+  800190:	49 89 df             	mov    %rbx,%r15
+  800193:	48 b8 c8 a4 ff ff ff 	movabs $0xffffffffffffa4c8,%rax
+  80019a:	ff ff ff 
+  80019d:	48 01 d8             	add    %rbx,%rax
+  8001a0:	ff d0                	call   *%rax
+  8001a2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+			ipc_send(who, v, 0, 0);
+  8001a5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8001a8:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8001ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b5:	89 c7                	mov    %eax,%edi
+  8001b7:	49 89 df             	mov    %rbx,%r15
+  8001ba:	48 b8 b1 a5 ff ff ff 	movabs $0xffffffffffffa5b1,%rax
+  8001c1:	ff ff ff 
+  8001c4:	48 01 d8             	add    %rbx,%rax
+  8001c7:	ff d0                	call   *%rax
+		for (i = 0; i < NROUNDS; i++) {
+  8001c9:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8001cd:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  8001d4:	7e a9                	jle    80017f <worker+0x13c>
+		}
+		exit();
+  8001d6:	49 89 df             	mov    %rbx,%r15
+  8001d9:	48 b8 f4 73 ff ff ff 	movabs $0xffffffffffff73f4,%rax
+  8001e0:	ff ff ff 
+  8001e3:	48 01 d8             	add    %rbx,%rax
+  8001e6:	ff d0                	call   *%rax
+	}
+	for (i = 0; i < NROUNDS; i++) {
+  8001e8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8001ef:	e9 98 00 00 00       	jmp    80028c <worker+0x249>
+		ipc_send(who, i, 0, 0);
+  8001f4:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8001f7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8001fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800204:	89 c7                	mov    %eax,%edi
+  800206:	49 89 df             	mov    %rbx,%r15
+  800209:	48 b8 b1 a5 ff ff ff 	movabs $0xffffffffffffa5b1,%rax
+  800210:	ff ff ff 
+  800213:	48 01 d8             	add    %rbx,%rax
+  800216:	ff d0                	call   *%rax
+		if (ipc_recv(0, 0, 0) != i)
+  800218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80021d:	be 00 00 00 00       	mov    $0x0,%esi
+  800222:	bf 00 00 00 00       	mov    $0x0,%edi
+  800227:	49 89 df             	mov    %rbx,%r15
+  80022a:	48 b8 c8 a4 ff ff ff 	movabs $0xffffffffffffa4c8,%rax
+  800231:	ff ff ff 
+  800234:	48 01 d8             	add    %rbx,%rax
+  800237:	ff d0                	call   *%rax
+  800239:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80023c:	74 4a                	je     800288 <worker+0x245>
+			panic("worker %d: bad reply in round %d", id, i);
+  80023e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800241:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800244:	41 89 d0             	mov    %edx,%r8d
+  800247:	89 c1                	mov    %eax,%ecx
+  800249:	48 b8 58 e0 ff ff ff 	movabs $0xffffffffffffe058,%rax
+  800250:	ff ff ff 
+  800253:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800257:	48 89 c2             	mov    %rax,%rdx
+  80025a:	be 26 00 00 00       	mov    $0x26,%esi
+  80025f:	48 b8 41 e0 ff ff ff 	movabs $0xffffffffffffe041,%rax
+  800266:	ff ff ff 
+  800269:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80026d:	48 89 c7             	mov    %rax,%rdi
+  800270:	49 89 df             	mov    %rbx,%r15
+  800273:	b8 00 00 00 00       	mov    $0x0,%eax
+  800278:	49 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r9
+  80027f:	ff ff ff 
+  800282:	49 01 d9             	add    %rbx,%r9
+  800285:	41 ff d1             	call   *%r9
+	for (i = 0; i < NROUNDS; i++) {
+  800288:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80028c:	81 7d ec cf 07 00 00 	cmpl   $0x7cf,-0x14(%rbp)
+  800293:	0f 8e 5b ff ff ff    	jle    8001f4 <worker+0x1b1>
+	}
+}
+  800299:	90                   	nop
+  80029a:	90                   	nop
+  80029b:	48 83 c4 20          	add    $0x20,%rsp
+  80029f:	5b                   	pop    %rbx
+  8002a0:	41 5f                	pop    %r15
+  8002a2:	5d                   	pop    %rbp
+  8002a3:	c3                   	ret
+
+00000000008002a4 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8002a4:	55                   	push   %rbp
+  8002a5:	48 89 e5             	mov    %rsp,%rbp
+  8002a8:	41 57                	push   %r15
+  8002aa:	53                   	push   %rbx
+  8002ab:	48 83 ec 20          	sub    $0x20,%rsp
+  8002af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8002af <umain+0xb>
+  8002b6:	49 bb 91 8d 00 00 00 	movabs $0x8d91,%r11
+  8002bd:	00 00 00 
+  8002c0:	4c 01 db             	add    %r11,%rbx
+  8002c3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8002c6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	unsigned ms = bench_workers(NWORKERS, worker);
+  8002ca:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8002d1:	ff ff ff 
+  8002d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002d8:	48 89 c6             	mov    %rax,%rsi
+  8002db:	bf 04 00 00 00       	mov    $0x4,%edi
+  8002e0:	49 89 df             	mov    %rbx,%r15
+  8002e3:	48 b8 9b d8 ff ff ff 	movabs $0xffffffffffffd89b,%rax
+  8002ea:	ff ff ff 
+  8002ed:	48 01 d8             	add    %rbx,%rax
+  8002f0:	ff d0                	call   *%rax
+  8002f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	cprintf("smpbench: %d forks, %d IPC round trips in %u ms\n",
+  8002f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002f8:	89 c1                	mov    %eax,%ecx
+  8002fa:	ba 40 1f 00 00       	mov    $0x1f40,%edx
+  8002ff:	be cc 00 00 00       	mov    $0xcc,%esi
+  800304:	48 b8 80 e0 ff ff ff 	movabs $0xffffffffffffe080,%rax
+  80030b:	ff ff ff 
+  80030e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800312:	48 89 c7             	mov    %rax,%rdi
+  800315:	49 89 df             	mov    %rbx,%r15
+  800318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031d:	49 b8 15 77 ff ff ff 	movabs $0xffffffffffff7715,%r8
+  800324:	ff ff ff 
+  800327:	49 01 d8             	add    %rbx,%r8
+  80032a:	41 ff d0             	call   *%r8
+		NWORKERS * (NFORKS + 1), NWORKERS * NROUNDS, ms);
+	if (ms > 0)
+  80032d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800331:	74 37                	je     80036a <umain+0xc6>
+		cprintf("smpbench: %u round trips/s\n",
+  800333:	b8 00 12 7a 00       	mov    $0x7a1200,%eax
+  800338:	ba 00 00 00 00       	mov    $0x0,%edx
+  80033d:	f7 75 ec             	divl   -0x14(%rbp)
+  800340:	89 c6                	mov    %eax,%esi
+  800342:	48 b8 b1 e0 ff ff ff 	movabs $0xffffffffffffe0b1,%rax
+  800349:	ff ff ff 
+  80034c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800350:	48 89 c7             	mov    %rax,%rdi
+  800353:	49 89 df             	mov    %rbx,%r15
+  800356:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035b:	48 ba 15 77 ff ff ff 	movabs $0xffffffffffff7715,%rdx
+  800362:	ff ff ff 
+  800365:	48 01 da             	add    %rbx,%rdx
+  800368:	ff d2                	call   *%rdx
+			NWORKERS * NROUNDS * 1000 / ms);
+}
+  80036a:	90                   	nop
+  80036b:	48 83 c4 20          	add    $0x20,%rsp
+  80036f:	5b                   	pop    %rbx
+  800370:	41 5f                	pop    %r15
+  800372:	5d                   	pop    %rbp
+  800373:	c3                   	ret
+
+0000000000800374 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800374:	55                   	push   %rbp
+  800375:	48 89 e5             	mov    %rsp,%rbp
+  800378:	41 57                	push   %r15
+  80037a:	53                   	push   %rbx
+  80037b:	48 83 ec 20          	sub    $0x20,%rsp
+  80037f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80037f <libmain+0xb>
+  800386:	49 bb c1 8c 00 00 00 	movabs $0x8cc1,%r11
+  80038d:	00 00 00 
+  800390:	4c 01 db             	add    %r11,%rbx
+  800393:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800396:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80039a:	49 89 df             	mov    %rbx,%r15
+  80039d:	48 b8 ea 90 ff ff ff 	movabs $0xffffffffffff90ea,%rax
+  8003a4:	ff ff ff 
+  8003a7:	48 01 d8             	add    %rbx,%rax
+  8003aa:	ff d0                	call   *%rax
+  8003ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8003af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003b2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003b7:	48 98                	cltq
+  8003b9:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8003c0:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8003c7:	ff ff ff 
+  8003ca:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8003ce:	48 01 c2             	add    %rax,%rdx
+  8003d1:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8003d8:	00 00 00 
+  8003db:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003df:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8003e3:	7e 15                	jle    8003fa <libmain+0x86>
+		binaryname = argv[0];
+  8003e5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8003e9:	48 8b 00             	mov    (%rax),%rax
+  8003ec:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8003f3:	00 00 00 
+  8003f6:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8003fa:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8003fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800401:	48 89 d6             	mov    %rdx,%rsi
+  800404:	89 c7                	mov    %eax,%edi
+  800406:	49 89 df             	mov    %rbx,%r15
+  800409:	48 b8 64 72 ff ff ff 	movabs $0xffffffffffff7264,%rax
+  800410:	ff ff ff 
+  800413:	48 01 d8             	add    %rbx,%rax
+  800416:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800418:	49 89 df             	mov    %rbx,%r15
+  80041b:	48 b8 f4 73 ff ff ff 	movabs $0xffffffffffff73f4,%rax
+  800422:	ff ff ff 
+  800425:	48 01 d8             	add    %rbx,%rax
+  800428:	ff d0                	call   *%rax
+}
+  80042a:	90                   	nop
+  80042b:	48 83 c4 20          	add    $0x20,%rsp
+  80042f:	5b                   	pop    %rbx
+  800430:	41 5f                	pop    %r15
+  800432:	5d                   	pop    %rbp
+  800433:	c3                   	ret
+
+0000000000800434 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800434:	55                   	push   %rbp
+  800435:	48 89 e5             	mov    %rsp,%rbp
+  800438:	41 57                	push   %r15
+  80043a:	53                   	push   %rbx
+  80043b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80043b <exit+0x7>
+  800442:	49 bb 05 8c 00 00 00 	movabs $0x8c05,%r11
+  800449:	00 00 00 
+  80044c:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80044f:	49 89 df             	mov    %rbx,%r15
+  800452:	48 b8 bf b0 ff ff ff 	movabs $0xffffffffffffb0bf,%rax
+  800459:	ff ff ff 
+  80045c:	48 01 d8             	add    %rbx,%rax
+  80045f:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800461:	bf 00 00 00 00       	mov    $0x0,%edi
+  800466:	49 89 df             	mov    %rbx,%r15
+  800469:	48 b8 8e 90 ff ff ff 	movabs $0xffffffffffff908e,%rax
+  800470:	ff ff ff 
+  800473:	48 01 d8             	add    %rbx,%rax
+  800476:	ff d0                	call   *%rax
+}
+  800478:	90                   	nop
+  800479:	5b                   	pop    %rbx
+  80047a:	41 5f                	pop    %r15
+  80047c:	5d                   	pop    %rbp
+  80047d:	c3                   	ret
+
+000000000080047e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80047e:	55                   	push   %rbp
+  80047f:	48 89 e5             	mov    %rsp,%rbp
+  800482:	41 57                	push   %r15
+  800484:	41 54                	push   %r12
+  800486:	53                   	push   %rbx
+  800487:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80048e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80048e <_panic+0x10>
+  800495:	49 bb b2 8b 00 00 00 	movabs $0x8bb2,%r11
+  80049c:	00 00 00 
+  80049f:	4c 01 db             	add    %r11,%rbx
+  8004a2:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004a9:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8004af:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8004b6:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8004bd:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8004c4:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8004cb:	84 c0                	test   %al,%al
+  8004cd:	74 26                	je     8004f5 <_panic+0x77>
+  8004cf:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8004d6:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8004dd:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8004e1:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8004e5:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8004e9:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8004ed:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8004f1:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004f5:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8004fc:	00 00 00 
+  8004ff:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800506:	00 00 00 
+  800509:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050d:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800514:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80051b:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800522:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800529:	ff ff ff 
+  80052c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800530:	4c 8b 20             	mov    (%rax),%r12
+  800533:	49 89 df             	mov    %rbx,%r15
+  800536:	48 b8 ea 90 ff ff ff 	movabs $0xffffffffffff90ea,%rax
+  80053d:	ff ff ff 
+  800540:	48 01 d8             	add    %rbx,%rax
+  800543:	ff d0                	call   *%rax
+  800545:	89 c6                	mov    %eax,%esi
+  800547:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80054d:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800554:	41 89 d0             	mov    %edx,%r8d
+  800557:	48 89 c1             	mov    %rax,%rcx
+  80055a:	4c 89 e2             	mov    %r12,%rdx
+  80055d:	48 b8 d8 e0 ff ff ff 	movabs $0xffffffffffffe0d8,%rax
+  800564:	ff ff ff 
+  800567:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80056b:	48 89 c7             	mov    %rax,%rdi
+  80056e:	49 89 df             	mov    %rbx,%r15
+  800571:	b8 00 00 00 00       	mov    $0x0,%eax
+  800576:	49 b9 15 77 ff ff ff 	movabs $0xffffffffffff7715,%r9
+  80057d:	ff ff ff 
+  800580:	49 01 d9             	add    %rbx,%r9
+  800583:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800586:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80058d:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800594:	48 89 d6             	mov    %rdx,%rsi
+  800597:	48 89 c7             	mov    %rax,%rdi
+  80059a:	49 89 df             	mov    %rbx,%r15
+  80059d:	48 b8 35 76 ff ff ff 	movabs $0xffffffffffff7635,%rax
+  8005a4:	ff ff ff 
+  8005a7:	48 01 d8             	add    %rbx,%rax
+  8005aa:	ff d0                	call   *%rax
+	cprintf("\n");
+  8005ac:	48 b8 fb e0 ff ff ff 	movabs $0xffffffffffffe0fb,%rax
+  8005b3:	ff ff ff 
+  8005b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005ba:	48 89 c7             	mov    %rax,%rdi
+  8005bd:	49 89 df             	mov    %rbx,%r15
+  8005c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c5:	48 ba 15 77 ff ff ff 	movabs $0xffffffffffff7715,%rdx
+  8005cc:	ff ff ff 
+  8005cf:	48 01 da             	add    %rbx,%rdx
+  8005d2:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8005d4:	cc                   	int3
+  8005d5:	eb fd                	jmp    8005d4 <_panic+0x156>
+
+00000000008005d7 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8005d7:	55                   	push   %rbp
+  8005d8:	48 89 e5             	mov    %rsp,%rbp
+  8005db:	41 57                	push   %r15
+  8005dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8005e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005e1 <putch+0xa>
+  8005e8:	49 bb 5f 8a 00 00 00 	movabs $0x8a5f,%r11
+  8005ef:	00 00 00 
+  8005f2:	4c 01 d8             	add    %r11,%rax
+  8005f5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8005f8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8005fc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800600:	8b 12                	mov    (%rdx),%edx
+  800602:	8d 72 01             	lea    0x1(%rdx),%esi
+  800605:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800609:	89 31                	mov    %esi,(%rcx)
+  80060b:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80060e:	89 ce                	mov    %ecx,%esi
+  800610:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800614:	48 63 d2             	movslq %edx,%rdx
+  800617:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80061c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800620:	8b 12                	mov    (%rdx),%edx
+  800622:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800628:	75 33                	jne    80065d <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80062a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80062e:	8b 12                	mov    (%rdx),%edx
+  800630:	48 63 d2             	movslq %edx,%rdx
+  800633:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800637:	48 83 c1 08          	add    $0x8,%rcx
+  80063b:	48 89 d6             	mov    %rdx,%rsi
+  80063e:	48 89 cf             	mov    %rcx,%rdi
+  800641:	49 89 c7             	mov    %rax,%r15
+  800644:	48 ba db 8f ff ff ff 	movabs $0xffffffffffff8fdb,%rdx
+  80064b:	ff ff ff 
+  80064e:	48 01 c2             	add    %rax,%rdx
+  800651:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800653:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800657:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80065d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800661:	8b 40 04             	mov    0x4(%rax),%eax
+  800664:	8d 50 01             	lea    0x1(%rax),%edx
+  800667:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80066b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80066e:	90                   	nop
+  80066f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800673:	c9                   	leave
+  800674:	c3                   	ret
+
+0000000000800675 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800675:	55                   	push   %rbp
+  800676:	48 89 e5             	mov    %rsp,%rbp
+  800679:	41 57                	push   %r15
+  80067b:	53                   	push   %rbx
+  80067c:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800683:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800683 <vcprintf+0xe>
+  80068a:	49 bb bd 89 00 00 00 	movabs $0x89bd,%r11
+  800691:	00 00 00 
+  800694:	4c 01 db             	add    %r11,%rbx
+  800697:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80069e:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8006a5:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006ac:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8006b3:	48 8b 06             	mov    (%rsi),%rax
+  8006b6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006ba:	48 89 01             	mov    %rax,(%rcx)
+  8006bd:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006c1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006c5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8006c9:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8006d0:	00 00 00 
+    b.cnt = 0;
+  8006d3:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8006da:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8006dd:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006e4:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8006eb:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8006f2:	48 89 c6             	mov    %rax,%rsi
+  8006f5:	48 b8 97 75 ff ff ff 	movabs $0xffffffffffff7597,%rax
+  8006fc:	ff ff ff 
+  8006ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800703:	48 89 c7             	mov    %rax,%rdi
+  800706:	49 89 df             	mov    %rbx,%r15
+  800709:	48 b8 59 7b ff ff ff 	movabs $0xffffffffffff7b59,%rax
+  800710:	ff ff ff 
+  800713:	48 01 d8             	add    %rbx,%rax
+  800716:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800718:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80071e:	48 98                	cltq
+  800720:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800727:	48 83 c2 08          	add    $0x8,%rdx
+  80072b:	48 89 c6             	mov    %rax,%rsi
+  80072e:	48 89 d7             	mov    %rdx,%rdi
+  800731:	49 89 df             	mov    %rbx,%r15
+  800734:	48 b8 db 8f ff ff ff 	movabs $0xffffffffffff8fdb,%rax
+  80073b:	ff ff ff 
+  80073e:	48 01 d8             	add    %rbx,%rax
+  800741:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800743:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800749:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800750:	5b                   	pop    %rbx
+  800751:	41 5f                	pop    %r15
+  800753:	5d                   	pop    %rbp
+  800754:	c3                   	ret
+
+0000000000800755 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800755:	55                   	push   %rbp
+  800756:	48 89 e5             	mov    %rsp,%rbp
+  800759:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800760:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800760 <cprintf+0xb>
+  800767:	49 bb e0 88 00 00 00 	movabs $0x88e0,%r11
+  80076e:	00 00 00 
+  800771:	4d 01 da             	add    %r11,%r10
+  800774:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80077b:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800782:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800789:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800790:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800797:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80079e:	84 c0                	test   %al,%al
+  8007a0:	74 20                	je     8007c2 <cprintf+0x6d>
+  8007a2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8007a6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8007aa:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8007ae:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8007b2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8007b6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8007ba:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8007be:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8007c2:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8007c9:	00 00 00 
+  8007cc:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8007d3:	00 00 00 
+  8007d6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007da:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8007e1:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8007e8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8007ef:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8007f6:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8007fd:	48 8b 06             	mov    (%rsi),%rax
+  800800:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800804:	48 89 01             	mov    %rax,(%rcx)
+  800807:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80080b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80080f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800813:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80081a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800821:	48 89 d6             	mov    %rdx,%rsi
+  800824:	48 89 c7             	mov    %rax,%rdi
+  800827:	48 b8 35 76 ff ff ff 	movabs $0xffffffffffff7635,%rax
+  80082e:	ff ff ff 
+  800831:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800835:	ff d0                	call   *%rax
+  800837:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80083d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800843:	c9                   	leave
+  800844:	c3                   	ret
+
+0000000000800845 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800845:	55                   	push   %rbp
+  800846:	48 89 e5             	mov    %rsp,%rbp
+  800849:	53                   	push   %rbx
+  80084a:	48 83 ec 38          	sub    $0x38,%rsp
+  80084e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80084e <printnum+0x9>
+  800855:	49 bb f2 87 00 00 00 	movabs $0x87f2,%r11
+  80085c:	00 00 00 
+  80085f:	4c 01 db             	add    %r11,%rbx
+  800862:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800866:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80086a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80086e:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800871:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800875:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800879:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80087c:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800880:	72 58                	jb     8008da <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800882:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800885:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800888:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  80088b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80088f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800894:	48 f7 f6             	div    %rsi
+  800897:	49 89 c2             	mov    %rax,%r10
+  80089a:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80089d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8008a0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8008a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008a8:	41 89 c9             	mov    %ecx,%r9d
+  8008ab:	41 89 f8             	mov    %edi,%r8d
+  8008ae:	89 d1                	mov    %edx,%ecx
+  8008b0:	4c 89 d2             	mov    %r10,%rdx
+  8008b3:	48 89 c7             	mov    %rax,%rdi
+  8008b6:	48 b8 05 78 ff ff ff 	movabs $0xffffffffffff7805,%rax
+  8008bd:	ff ff ff 
+  8008c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008c4:	ff d0                	call   *%rax
+  8008c6:	eb 1c                	jmp    8008e4 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8008c8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008cc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8008cf:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8008d3:	48 89 d6             	mov    %rdx,%rsi
+  8008d6:	89 c7                	mov    %eax,%edi
+  8008d8:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8008da:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8008de:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8008e2:	7f e4                	jg     8008c8 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8008e4:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8008e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008f0:	48 f7 f1             	div    %rcx
+  8008f3:	48 b8 37 e2 ff ff ff 	movabs $0xffffffffffffe237,%rax
+  8008fa:	ff ff ff 
+  8008fd:	48 01 d8             	add    %rbx,%rax
+  800900:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800904:	0f be c0             	movsbl %al,%eax
+  800907:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80090b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80090f:	48 89 d6             	mov    %rdx,%rsi
+  800912:	89 c7                	mov    %eax,%edi
+  800914:	ff d1                	call   *%rcx
+}
+  800916:	90                   	nop
+  800917:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80091b:	c9                   	leave
+  80091c:	c3                   	ret
+
+000000000080091d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80091d:	55                   	push   %rbp
+  80091e:	48 89 e5             	mov    %rsp,%rbp
+  800921:	48 83 ec 20          	sub    $0x20,%rsp
+  800925:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800925 <getuint+0x8>
+  80092c:	49 bb 1b 87 00 00 00 	movabs $0x871b,%r11
+  800933:	00 00 00 
+  800936:	4c 01 d8             	add    %r11,%rax
+  800939:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80093d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800940:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800944:	7e 4f                	jle    800995 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800946:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80094a:	8b 00                	mov    (%rax),%eax
+  80094c:	83 f8 2f             	cmp    $0x2f,%eax
+  80094f:	77 24                	ja     800975 <getuint+0x58>
+  800951:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800955:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800959:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80095d:	8b 00                	mov    (%rax),%eax
+  80095f:	89 c0                	mov    %eax,%eax
+  800961:	48 01 d0             	add    %rdx,%rax
+  800964:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800968:	8b 12                	mov    (%rdx),%edx
+  80096a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80096d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800971:	89 0a                	mov    %ecx,(%rdx)
+  800973:	eb 14                	jmp    800989 <getuint+0x6c>
+  800975:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800979:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80097d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800981:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800985:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800989:	48 8b 00             	mov    (%rax),%rax
+  80098c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800990:	e9 9d 00 00 00       	jmp    800a32 <getuint+0x115>
+	else if (lflag)
+  800995:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800999:	74 4c                	je     8009e7 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  80099b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80099f:	8b 00                	mov    (%rax),%eax
+  8009a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a4:	77 24                	ja     8009ca <getuint+0xad>
+  8009a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009aa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009b2:	8b 00                	mov    (%rax),%eax
+  8009b4:	89 c0                	mov    %eax,%eax
+  8009b6:	48 01 d0             	add    %rdx,%rax
+  8009b9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009bd:	8b 12                	mov    (%rdx),%edx
+  8009bf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009c2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009c6:	89 0a                	mov    %ecx,(%rdx)
+  8009c8:	eb 14                	jmp    8009de <getuint+0xc1>
+  8009ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009d2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009da:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009de:	48 8b 00             	mov    (%rax),%rax
+  8009e1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009e5:	eb 4b                	jmp    800a32 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8009e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009eb:	8b 00                	mov    (%rax),%eax
+  8009ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f0:	77 24                	ja     800a16 <getuint+0xf9>
+  8009f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009f6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009fe:	8b 00                	mov    (%rax),%eax
+  800a00:	89 c0                	mov    %eax,%eax
+  800a02:	48 01 d0             	add    %rdx,%rax
+  800a05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a09:	8b 12                	mov    (%rdx),%edx
+  800a0b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a0e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a12:	89 0a                	mov    %ecx,(%rdx)
+  800a14:	eb 14                	jmp    800a2a <getuint+0x10d>
+  800a16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a1a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a1e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a22:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a26:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a2a:	8b 00                	mov    (%rax),%eax
+  800a2c:	89 c0                	mov    %eax,%eax
+  800a2e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a36:	c9                   	leave
+  800a37:	c3                   	ret
+
+0000000000800a38 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800a38:	55                   	push   %rbp
+  800a39:	48 89 e5             	mov    %rsp,%rbp
+  800a3c:	48 83 ec 20          	sub    $0x20,%rsp
+  800a40:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a40 <printfloat+0x8>
+  800a47:	49 bb 00 86 00 00 00 	movabs $0x8600,%r11
+  800a4e:	00 00 00 
+  800a51:	4c 01 d8             	add    %r11,%rax
+  800a54:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a58:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a5c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800a60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a64:	48 85 c0             	test   %rax,%rax
+  800a67:	79 12                	jns    800a7b <printfloat+0x43>
+		putch('-',putdat);
+  800a69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a6d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a71:	48 89 c6             	mov    %rax,%rsi
+  800a74:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a79:	ff d2                	call   *%rdx
+	
+}
+  800a7b:	90                   	nop
+  800a7c:	c9                   	leave
+  800a7d:	c3                   	ret
+
+0000000000800a7e <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800a7e:	55                   	push   %rbp
+  800a7f:	48 89 e5             	mov    %rsp,%rbp
+  800a82:	48 83 ec 20          	sub    $0x20,%rsp
+  800a86:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a86 <getint+0x8>
+  800a8d:	49 bb ba 85 00 00 00 	movabs $0x85ba,%r11
+  800a94:	00 00 00 
+  800a97:	4c 01 d8             	add    %r11,%rax
+  800a9a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a9e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800aa1:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800aa5:	7e 4f                	jle    800af6 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800aa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aab:	8b 00                	mov    (%rax),%eax
+  800aad:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab0:	77 24                	ja     800ad6 <getint+0x58>
+  800ab2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800aba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800abe:	8b 00                	mov    (%rax),%eax
+  800ac0:	89 c0                	mov    %eax,%eax
+  800ac2:	48 01 d0             	add    %rdx,%rax
+  800ac5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ac9:	8b 12                	mov    (%rdx),%edx
+  800acb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ace:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ad2:	89 0a                	mov    %ecx,(%rdx)
+  800ad4:	eb 14                	jmp    800aea <getint+0x6c>
+  800ad6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ada:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ade:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ae2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ae6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800aea:	48 8b 00             	mov    (%rax),%rax
+  800aed:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800af1:	e9 9d 00 00 00       	jmp    800b93 <getint+0x115>
+	else if (lflag)
+  800af6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800afa:	74 4c                	je     800b48 <getint+0xca>
+		x=va_arg(*ap, long);
+  800afc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b00:	8b 00                	mov    (%rax),%eax
+  800b02:	83 f8 2f             	cmp    $0x2f,%eax
+  800b05:	77 24                	ja     800b2b <getint+0xad>
+  800b07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b0b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b13:	8b 00                	mov    (%rax),%eax
+  800b15:	89 c0                	mov    %eax,%eax
+  800b17:	48 01 d0             	add    %rdx,%rax
+  800b1a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b1e:	8b 12                	mov    (%rdx),%edx
+  800b20:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b23:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b27:	89 0a                	mov    %ecx,(%rdx)
+  800b29:	eb 14                	jmp    800b3f <getint+0xc1>
+  800b2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b2f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b33:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b37:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b3b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b3f:	48 8b 00             	mov    (%rax),%rax
+  800b42:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b46:	eb 4b                	jmp    800b93 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800b48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4c:	8b 00                	mov    (%rax),%eax
+  800b4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b51:	77 24                	ja     800b77 <getint+0xf9>
+  800b53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b57:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b5f:	8b 00                	mov    (%rax),%eax
+  800b61:	89 c0                	mov    %eax,%eax
+  800b63:	48 01 d0             	add    %rdx,%rax
+  800b66:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b6a:	8b 12                	mov    (%rdx),%edx
+  800b6c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b6f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b73:	89 0a                	mov    %ecx,(%rdx)
+  800b75:	eb 14                	jmp    800b8b <getint+0x10d>
+  800b77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b7b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b7f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b83:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b87:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b8b:	8b 00                	mov    (%rax),%eax
+  800b8d:	48 98                	cltq
+  800b8f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b97:	c9                   	leave
+  800b98:	c3                   	ret
+
+0000000000800b99 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800b99:	55                   	push   %rbp
+  800b9a:	48 89 e5             	mov    %rsp,%rbp
+  800b9d:	41 57                	push   %r15
+  800b9f:	41 55                	push   %r13
+  800ba1:	41 54                	push   %r12
+  800ba3:	53                   	push   %rbx
+  800ba4:	48 83 ec 60          	sub    $0x60,%rsp
+  800ba8:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800ba8 <vprintfmt+0xf>
+  800baf:	49 bb 98 84 00 00 00 	movabs $0x8498,%r11
+  800bb6:	00 00 00 
+  800bb9:	4d 01 dc             	add    %r11,%r12
+  800bbc:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800bc0:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800bc4:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800bc8:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800bcc:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800bd3:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800bd7:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800bdb:	48 8b 06             	mov    (%rsi),%rax
+  800bde:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800be2:	48 89 01             	mov    %rax,(%rcx)
+  800be5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800be9:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800bed:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800bf1:	eb 17                	jmp    800c0a <vprintfmt+0x71>
+			if (ch == '\0')
+  800bf3:	85 db                	test   %ebx,%ebx
+  800bf5:	0f 84 97 05 00 00    	je     801192 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800bfb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800bff:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c03:	48 89 c6             	mov    %rax,%rsi
+  800c06:	89 df                	mov    %ebx,%edi
+  800c08:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c0a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c0e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c12:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c16:	0f b6 00             	movzbl (%rax),%eax
+  800c19:	0f b6 d8             	movzbl %al,%ebx
+  800c1c:	83 fb 25             	cmp    $0x25,%ebx
+  800c1f:	75 d2                	jne    800bf3 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800c21:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800c25:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800c2c:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800c33:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800c3a:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800c41:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c45:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c49:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c4d:	0f b6 00             	movzbl (%rax),%eax
+  800c50:	0f b6 d8             	movzbl %al,%ebx
+  800c53:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c56:	83 f8 55             	cmp    $0x55,%eax
+  800c59:	0f 87 00 05 00 00    	ja     80115f <vprintfmt+0x5c6>
+  800c5f:	89 c0                	mov    %eax,%eax
+  800c61:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c68:	00 
+  800c69:	48 8d 05 30 66 00 00 	lea    0x6630(%rip),%rax        # 8072a0 <.LC18+0xc>
+  800c70:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800c74:	48 8d 15 25 66 00 00 	lea    0x6625(%rip),%rdx        # 8072a0 <.LC18+0xc>
+  800c7b:	48 01 d0             	add    %rdx,%rax
+  800c7e:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800c80:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800c84:	eb bb                	jmp    800c41 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800c86:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800c8a:	eb b5                	jmp    800c41 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800c8c:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c93:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800c96:	89 d0                	mov    %edx,%eax
+  800c98:	c1 e0 02             	shl    $0x2,%eax
+  800c9b:	01 d0                	add    %edx,%eax
+  800c9d:	01 c0                	add    %eax,%eax
+  800c9f:	01 d8                	add    %ebx,%eax
+  800ca1:	83 e8 30             	sub    $0x30,%eax
+  800ca4:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800ca7:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800cab:	0f b6 00             	movzbl (%rax),%eax
+  800cae:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800cb1:	83 fb 2f             	cmp    $0x2f,%ebx
+  800cb4:	7e 60                	jle    800d16 <vprintfmt+0x17d>
+  800cb6:	83 fb 39             	cmp    $0x39,%ebx
+  800cb9:	7f 5b                	jg     800d16 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800cbb:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800cc0:	eb d1                	jmp    800c93 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800cc2:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800cc5:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc8:	77 17                	ja     800ce1 <vprintfmt+0x148>
+  800cca:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800cce:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cd1:	89 d2                	mov    %edx,%edx
+  800cd3:	48 01 d0             	add    %rdx,%rax
+  800cd6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cd9:	83 c2 08             	add    $0x8,%edx
+  800cdc:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cdf:	eb 0c                	jmp    800ced <vprintfmt+0x154>
+  800ce1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ce5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ce9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ced:	8b 00                	mov    (%rax),%eax
+  800cef:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800cf2:	eb 23                	jmp    800d17 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800cf4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800cf8:	0f 89 43 ff ff ff    	jns    800c41 <vprintfmt+0xa8>
+				width = 0;
+  800cfe:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800d05:	e9 37 ff ff ff       	jmp    800c41 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800d0a:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800d11:	e9 2b ff ff ff       	jmp    800c41 <vprintfmt+0xa8>
+			goto process_precision;
+  800d16:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800d17:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d1b:	0f 89 20 ff ff ff    	jns    800c41 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800d21:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d24:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800d27:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800d2e:	e9 0e ff ff ff       	jmp    800c41 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800d33:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800d37:	e9 05 ff ff ff       	jmp    800c41 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800d3c:	83 fb 39             	cmp    $0x39,%ebx
+  800d3f:	7f 0b                	jg     800d4c <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800d41:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800d44:	c1 e0 08             	shl    $0x8,%eax
+  800d47:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d4a:	eb 21                	jmp    800d6d <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800d4c:	83 fb 60             	cmp    $0x60,%ebx
+  800d4f:	7e 10                	jle    800d61 <vprintfmt+0x1c8>
+  800d51:	83 fb 66             	cmp    $0x66,%ebx
+  800d54:	7f 0b                	jg     800d61 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800d56:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800d59:	c1 e0 08             	shl    $0x8,%eax
+  800d5c:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d5f:	eb 0c                	jmp    800d6d <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800d61:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800d68:	e9 04 01 00 00       	jmp    800e71 <vprintfmt+0x2d8>
+  800d6d:	e9 ff 00 00 00       	jmp    800e71 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800d72:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d75:	83 f8 2f             	cmp    $0x2f,%eax
+  800d78:	77 17                	ja     800d91 <vprintfmt+0x1f8>
+  800d7a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d7e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d81:	89 d2                	mov    %edx,%edx
+  800d83:	48 01 d0             	add    %rdx,%rax
+  800d86:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d89:	83 c2 08             	add    $0x8,%edx
+  800d8c:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d8f:	eb 0c                	jmp    800d9d <vprintfmt+0x204>
+  800d91:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d95:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d99:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d9d:	8b 00                	mov    (%rax),%eax
+  800d9f:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800da3:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800da7:	48 89 d6             	mov    %rdx,%rsi
+  800daa:	89 c7                	mov    %eax,%edi
+  800dac:	ff d1                	call   *%rcx
+			break;
+  800dae:	e9 da 03 00 00       	jmp    80118d <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800db3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800db6:	83 f8 2f             	cmp    $0x2f,%eax
+  800db9:	77 17                	ja     800dd2 <vprintfmt+0x239>
+  800dbb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dbf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dc2:	89 d2                	mov    %edx,%edx
+  800dc4:	48 01 d0             	add    %rdx,%rax
+  800dc7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dca:	83 c2 08             	add    $0x8,%edx
+  800dcd:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800dd0:	eb 0c                	jmp    800dde <vprintfmt+0x245>
+  800dd2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dd6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dda:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800dde:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800de0:	85 db                	test   %ebx,%ebx
+  800de2:	79 02                	jns    800de6 <vprintfmt+0x24d>
+				err = -err;
+  800de4:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800de6:	83 fb 15             	cmp    $0x15,%ebx
+  800de9:	7f 19                	jg     800e04 <vprintfmt+0x26b>
+  800deb:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800df2:	00 00 00 
+  800df5:	48 63 c3             	movslq %ebx,%rax
+  800df8:	4c 01 e2             	add    %r12,%rdx
+  800dfb:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800dff:	4d 85 ed             	test   %r13,%r13
+  800e02:	75 36                	jne    800e3a <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800e04:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e08:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e0c:	89 d9                	mov    %ebx,%ecx
+  800e0e:	48 ba 48 e2 ff ff ff 	movabs $0xffffffffffffe248,%rdx
+  800e15:	ff ff ff 
+  800e18:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e1c:	48 89 c7             	mov    %rax,%rdi
+  800e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e24:	49 b8 60 81 ff ff ff 	movabs $0xffffffffffff8160,%r8
+  800e2b:	ff ff ff 
+  800e2e:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e32:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800e35:	e9 53 03 00 00       	jmp    80118d <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800e3a:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e3e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e42:	4c 89 e9             	mov    %r13,%rcx
+  800e45:	48 ba 51 e2 ff ff ff 	movabs $0xffffffffffffe251,%rdx
+  800e4c:	ff ff ff 
+  800e4f:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e53:	48 89 c7             	mov    %rax,%rdi
+  800e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5b:	49 b8 60 81 ff ff ff 	movabs $0xffffffffffff8160,%r8
+  800e62:	ff ff ff 
+  800e65:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e69:	41 ff d0             	call   *%r8
+			break;
+  800e6c:	e9 1c 03 00 00       	jmp    80118d <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800e71:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e74:	83 f8 2f             	cmp    $0x2f,%eax
+  800e77:	77 17                	ja     800e90 <vprintfmt+0x2f7>
+  800e79:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e7d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e80:	89 d2                	mov    %edx,%edx
+  800e82:	48 01 d0             	add    %rdx,%rax
+  800e85:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e88:	83 c2 08             	add    $0x8,%edx
+  800e8b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e8e:	eb 0c                	jmp    800e9c <vprintfmt+0x303>
+  800e90:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e94:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e98:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e9c:	4c 8b 28             	mov    (%rax),%r13
+  800e9f:	4d 85 ed             	test   %r13,%r13
+  800ea2:	75 0e                	jne    800eb2 <vprintfmt+0x319>
+				p = "(null)";
+  800ea4:	48 b8 54 e2 ff ff ff 	movabs $0xffffffffffffe254,%rax
+  800eab:	ff ff ff 
+  800eae:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800eb2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800eb6:	0f 8e 84 00 00 00    	jle    800f40 <vprintfmt+0x3a7>
+  800ebc:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800ec0:	74 7e                	je     800f40 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ec2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ec5:	48 98                	cltq
+  800ec7:	48 89 c6             	mov    %rax,%rsi
+  800eca:	4c 89 ef             	mov    %r13,%rdi
+  800ecd:	4d 89 e7             	mov    %r12,%r15
+  800ed0:	48 b8 85 84 ff ff ff 	movabs $0xffffffffffff8485,%rax
+  800ed7:	ff ff ff 
+  800eda:	4c 01 e0             	add    %r12,%rax
+  800edd:	ff d0                	call   *%rax
+  800edf:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800ee2:	eb 17                	jmp    800efb <vprintfmt+0x362>
+					putch(padc, putdat);
+  800ee4:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800ee8:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800eec:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800ef0:	48 89 d6             	mov    %rdx,%rsi
+  800ef3:	89 c7                	mov    %eax,%edi
+  800ef5:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ef7:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800efb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800eff:	7f e3                	jg     800ee4 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f01:	eb 3d                	jmp    800f40 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800f03:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800f07:	74 1e                	je     800f27 <vprintfmt+0x38e>
+  800f09:	83 fb 1f             	cmp    $0x1f,%ebx
+  800f0c:	7e 05                	jle    800f13 <vprintfmt+0x37a>
+  800f0e:	83 fb 7e             	cmp    $0x7e,%ebx
+  800f11:	7e 14                	jle    800f27 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800f13:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f17:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f1b:	48 89 c6             	mov    %rax,%rsi
+  800f1e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800f23:	ff d2                	call   *%rdx
+  800f25:	eb 15                	jmp    800f3c <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800f27:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800f2a:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800f2d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f31:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f35:	48 89 c6             	mov    %rax,%rsi
+  800f38:	89 cf                	mov    %ecx,%edi
+  800f3a:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f3c:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f40:	4c 89 e8             	mov    %r13,%rax
+  800f43:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800f47:	0f b6 00             	movzbl (%rax),%eax
+  800f4a:	0f be d8             	movsbl %al,%ebx
+  800f4d:	85 db                	test   %ebx,%ebx
+  800f4f:	74 28                	je     800f79 <vprintfmt+0x3e0>
+  800f51:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f55:	78 ac                	js     800f03 <vprintfmt+0x36a>
+  800f57:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800f5b:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f5f:	79 a2                	jns    800f03 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800f61:	eb 16                	jmp    800f79 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800f63:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f67:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f6b:	48 89 c6             	mov    %rax,%rsi
+  800f6e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f73:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800f75:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f79:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f7d:	7f e4                	jg     800f63 <vprintfmt+0x3ca>
+			break;
+  800f7f:	e9 09 02 00 00       	jmp    80118d <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800f84:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f88:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f8c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f90:	0f b6 00             	movzbl (%rax),%eax
+  800f93:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800f96:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800f97:	83 fb 2f             	cmp    $0x2f,%ebx
+  800f9a:	0f 8e ac fd ff ff    	jle    800d4c <vprintfmt+0x1b3>
+  800fa0:	e9 97 fd ff ff       	jmp    800d3c <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800fa5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fa9:	be 03 00 00 00       	mov    $0x3,%esi
+  800fae:	48 89 c7             	mov    %rax,%rdi
+  800fb1:	48 b8 3e 7a ff ff ff 	movabs $0xffffffffffff7a3e,%rax
+  800fb8:	ff ff ff 
+  800fbb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fbf:	ff d0                	call   *%rax
+  800fc1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800fc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fc9:	48 85 c0             	test   %rax,%rax
+  800fcc:	79 1d                	jns    800feb <vprintfmt+0x452>
+				putch('-', putdat);
+  800fce:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fd2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fd6:	48 89 c6             	mov    %rax,%rsi
+  800fd9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800fde:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800fe0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fe4:	48 f7 d8             	neg    %rax
+  800fe7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800feb:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800ff2:	e9 de 00 00 00       	jmp    8010d5 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800ff7:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ffb:	be 03 00 00 00       	mov    $0x3,%esi
+  801000:	48 89 c7             	mov    %rax,%rdi
+  801003:	48 b8 dd 78 ff ff ff 	movabs $0xffffffffffff78dd,%rax
+  80100a:	ff ff ff 
+  80100d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801011:	ff d0                	call   *%rax
+  801013:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801017:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80101e:	e9 b2 00 00 00       	jmp    8010d5 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801023:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801027:	be 03 00 00 00       	mov    $0x3,%esi
+  80102c:	48 89 c7             	mov    %rax,%rdi
+  80102f:	48 b8 dd 78 ff ff ff 	movabs $0xffffffffffff78dd,%rax
+  801036:	ff ff ff 
+  801039:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80103d:	ff d0                	call   *%rax
+  80103f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801043:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  80104a:	e9 86 00 00 00       	jmp    8010d5 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80104f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801053:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801057:	48 89 c6             	mov    %rax,%rsi
+  80105a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80105f:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801061:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801065:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801069:	48 89 c6             	mov    %rax,%rsi
+  80106c:	bf 78 00 00 00       	mov    $0x78,%edi
+  801071:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801073:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	77 17                	ja     801092 <vprintfmt+0x4f9>
+  80107b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80107f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801082:	89 d2                	mov    %edx,%edx
+  801084:	48 01 d0             	add    %rdx,%rax
+  801087:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80108a:	83 c2 08             	add    $0x8,%edx
+  80108d:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801090:	eb 0c                	jmp    80109e <vprintfmt+0x505>
+  801092:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801096:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80109a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80109e:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8010a1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010a5:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8010ac:	eb 27                	jmp    8010d5 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8010ae:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010b2:	be 03 00 00 00       	mov    $0x3,%esi
+  8010b7:	48 89 c7             	mov    %rax,%rdi
+  8010ba:	48 b8 dd 78 ff ff ff 	movabs $0xffffffffffff78dd,%rax
+  8010c1:	ff ff ff 
+  8010c4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010c8:	ff d0                	call   *%rax
+  8010ca:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010ce:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8010d5:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8010da:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8010dd:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8010e0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010e4:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8010e8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010ec:	45 89 c1             	mov    %r8d,%r9d
+  8010ef:	41 89 f8             	mov    %edi,%r8d
+  8010f2:	48 89 c7             	mov    %rax,%rdi
+  8010f5:	48 b8 05 78 ff ff ff 	movabs $0xffffffffffff7805,%rax
+  8010fc:	ff ff ff 
+  8010ff:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801103:	ff d0                	call   *%rax
+			break;
+  801105:	e9 83 00 00 00       	jmp    80118d <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  80110a:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80110e:	be 03 00 00 00       	mov    $0x3,%esi
+  801113:	48 89 c7             	mov    %rax,%rdi
+  801116:	48 b8 dd 78 ff ff ff 	movabs $0xffffffffffff78dd,%rax
+  80111d:	ff ff ff 
+  801120:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801124:	ff d0                	call   *%rax
+  801126:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  80112a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80112e:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801132:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801136:	48 89 ce             	mov    %rcx,%rsi
+  801139:	48 89 c7             	mov    %rax,%rdi
+  80113c:	48 b8 f8 79 ff ff ff 	movabs $0xffffffffffff79f8,%rax
+  801143:	ff ff ff 
+  801146:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80114a:	ff d0                	call   *%rax
+	
+			break;
+  80114c:	eb 3f                	jmp    80118d <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80114e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801152:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801156:	48 89 c6             	mov    %rax,%rsi
+  801159:	89 df                	mov    %ebx,%edi
+  80115b:	ff d2                	call   *%rdx
+			break;
+  80115d:	eb 2e                	jmp    80118d <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80115f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801163:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801167:	48 89 c6             	mov    %rax,%rsi
+  80116a:	bf 25 00 00 00       	mov    $0x25,%edi
+  80116f:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801171:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801176:	eb 05                	jmp    80117d <vprintfmt+0x5e4>
+  801178:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80117d:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801181:	48 83 e8 01          	sub    $0x1,%rax
+  801185:	0f b6 00             	movzbl (%rax),%eax
+  801188:	3c 25                	cmp    $0x25,%al
+  80118a:	75 ec                	jne    801178 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  80118c:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80118d:	e9 78 fa ff ff       	jmp    800c0a <vprintfmt+0x71>
+				return;
+  801192:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801193:	48 83 c4 60          	add    $0x60,%rsp
+  801197:	5b                   	pop    %rbx
+  801198:	41 5c                	pop    %r12
+  80119a:	41 5d                	pop    %r13
+  80119c:	41 5f                	pop    %r15
+  80119e:	5d                   	pop    %rbp
+  80119f:	c3                   	ret
+
+00000000008011a0 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8011a0:	55                   	push   %rbp
+  8011a1:	48 89 e5             	mov    %rsp,%rbp
+  8011a4:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8011ab:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8011ab <printfmt+0xb>
+  8011b2:	49 bb 95 7e 00 00 00 	movabs $0x7e95,%r11
+  8011b9:	00 00 00 
+  8011bc:	4d 01 da             	add    %r11,%r10
+  8011bf:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8011c6:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8011cd:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8011d4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8011db:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8011e2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8011e9:	84 c0                	test   %al,%al
+  8011eb:	74 20                	je     80120d <printfmt+0x6d>
+  8011ed:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8011f1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8011f5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8011f9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8011fd:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801201:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801205:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801209:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80120d:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801214:	00 00 00 
+  801217:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80121e:	00 00 00 
+  801221:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801225:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80122c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801233:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80123a:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801241:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801248:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80124f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801256:	48 89 c7             	mov    %rax,%rdi
+  801259:	48 b8 59 7b ff ff ff 	movabs $0xffffffffffff7b59,%rax
+  801260:	ff ff ff 
+  801263:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801267:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801269:	90                   	nop
+  80126a:	c9                   	leave
+  80126b:	c3                   	ret
+
+000000000080126c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80126c:	55                   	push   %rbp
+  80126d:	48 89 e5             	mov    %rsp,%rbp
+  801270:	48 83 ec 10          	sub    $0x10,%rsp
+  801274:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801274 <sprintputch+0x8>
+  80127b:	49 bb cc 7d 00 00 00 	movabs $0x7dcc,%r11
+  801282:	00 00 00 
+  801285:	4c 01 d8             	add    %r11,%rax
+  801288:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80128b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80128f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801293:	8b 40 10             	mov    0x10(%rax),%eax
+  801296:	8d 50 01             	lea    0x1(%rax),%edx
+  801299:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80129d:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8012a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012a4:	48 8b 10             	mov    (%rax),%rdx
+  8012a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012af:	48 39 c2             	cmp    %rax,%rdx
+  8012b2:	73 17                	jae    8012cb <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8012b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012b8:	48 8b 00             	mov    (%rax),%rax
+  8012bb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012bf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012c3:	48 89 0a             	mov    %rcx,(%rdx)
+  8012c6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8012c9:	88 10                	mov    %dl,(%rax)
+}
+  8012cb:	90                   	nop
+  8012cc:	c9                   	leave
+  8012cd:	c3                   	ret
+
+00000000008012ce <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8012ce:	55                   	push   %rbp
+  8012cf:	48 89 e5             	mov    %rsp,%rbp
+  8012d2:	53                   	push   %rbx
+  8012d3:	48 83 ec 58          	sub    $0x58,%rsp
+  8012d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012d7 <vsnprintf+0x9>
+  8012de:	49 bb 69 7d 00 00 00 	movabs $0x7d69,%r11
+  8012e5:	00 00 00 
+  8012e8:	4c 01 d8             	add    %r11,%rax
+  8012eb:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8012ef:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8012f2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8012f6:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8012fa:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8012fe:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801302:	48 8b 0e             	mov    (%rsi),%rcx
+  801305:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801309:	48 89 0a             	mov    %rcx,(%rdx)
+  80130c:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801310:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801314:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801318:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80131c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801320:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801323:	48 63 d2             	movslq %edx,%rdx
+  801326:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80132a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80132e:	48 01 ca             	add    %rcx,%rdx
+  801331:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801335:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80133c:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801341:	74 06                	je     801349 <vsnprintf+0x7b>
+  801343:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801347:	7f 07                	jg     801350 <vsnprintf+0x82>
+		return -E_INVAL;
+  801349:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80134e:	eb 34                	jmp    801384 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801350:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801354:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801358:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80135c:	48 bf 2c 82 ff ff ff 	movabs $0xffffffffffff822c,%rdi
+  801363:	ff ff ff 
+  801366:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  80136a:	49 b8 59 7b ff ff ff 	movabs $0xffffffffffff7b59,%r8
+  801371:	ff ff ff 
+  801374:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801378:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  80137a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80137e:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801381:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801384:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801388:	c9                   	leave
+  801389:	c3                   	ret
+
+000000000080138a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80138a:	55                   	push   %rbp
+  80138b:	48 89 e5             	mov    %rsp,%rbp
+  80138e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801395:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801395 <snprintf+0xb>
+  80139c:	49 bb ab 7c 00 00 00 	movabs $0x7cab,%r11
+  8013a3:	00 00 00 
+  8013a6:	4d 01 da             	add    %r11,%r10
+  8013a9:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8013b0:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8013b6:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8013bd:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8013c4:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8013cb:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8013d2:	84 c0                	test   %al,%al
+  8013d4:	74 20                	je     8013f6 <snprintf+0x6c>
+  8013d6:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8013da:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8013de:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8013e2:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8013e6:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8013ea:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8013ee:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8013f2:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8013f6:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8013fd:	00 00 00 
+  801400:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801407:	00 00 00 
+  80140a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80140e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801415:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80141c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801423:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80142a:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801431:	48 8b 06             	mov    (%rsi),%rax
+  801434:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801438:	48 89 01             	mov    %rax,(%rcx)
+  80143b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80143f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801443:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801447:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80144e:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801455:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80145b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801462:	48 89 c7             	mov    %rax,%rdi
+  801465:	48 b8 8e 82 ff ff ff 	movabs $0xffffffffffff828e,%rax
+  80146c:	ff ff ff 
+  80146f:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801473:	ff d0                	call   *%rax
+  801475:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  80147b:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801481:	c9                   	leave
+  801482:	c3                   	ret
+
+0000000000801483 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801483:	55                   	push   %rbp
+  801484:	48 89 e5             	mov    %rsp,%rbp
+  801487:	48 83 ec 18          	sub    $0x18,%rsp
+  80148b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80148b <strlen+0x8>
+  801492:	49 bb b5 7b 00 00 00 	movabs $0x7bb5,%r11
+  801499:	00 00 00 
+  80149c:	4c 01 d8             	add    %r11,%rax
+  80149f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8014a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014aa:	eb 09                	jmp    8014b5 <strlen+0x32>
+		n++;
+  8014ac:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8014b0:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b9:	0f b6 00             	movzbl (%rax),%eax
+  8014bc:	84 c0                	test   %al,%al
+  8014be:	75 ec                	jne    8014ac <strlen+0x29>
+	return n;
+  8014c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8014c3:	c9                   	leave
+  8014c4:	c3                   	ret
+
+00000000008014c5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+  8014c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8014cd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014cd <strnlen+0x8>
+  8014d4:	49 bb 73 7b 00 00 00 	movabs $0x7b73,%r11
+  8014db:	00 00 00 
+  8014de:	4c 01 d8             	add    %r11,%rax
+  8014e1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014e5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014e9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014f0:	eb 0e                	jmp    801500 <strnlen+0x3b>
+		n++;
+  8014f2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014f6:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014fb:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801500:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801505:	74 0b                	je     801512 <strnlen+0x4d>
+  801507:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80150b:	0f b6 00             	movzbl (%rax),%eax
+  80150e:	84 c0                	test   %al,%al
+  801510:	75 e0                	jne    8014f2 <strnlen+0x2d>
+	return n;
+  801512:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801515:	c9                   	leave
+  801516:	c3                   	ret
+
+0000000000801517 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801517:	55                   	push   %rbp
+  801518:	48 89 e5             	mov    %rsp,%rbp
+  80151b:	48 83 ec 20          	sub    $0x20,%rsp
+  80151f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80151f <strcpy+0x8>
+  801526:	49 bb 21 7b 00 00 00 	movabs $0x7b21,%r11
+  80152d:	00 00 00 
+  801530:	4c 01 d8             	add    %r11,%rax
+  801533:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801537:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80153b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80153f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801543:	90                   	nop
+  801544:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801548:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80154c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801550:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801554:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801558:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80155c:	0f b6 12             	movzbl (%rdx),%edx
+  80155f:	88 10                	mov    %dl,(%rax)
+  801561:	0f b6 00             	movzbl (%rax),%eax
+  801564:	84 c0                	test   %al,%al
+  801566:	75 dc                	jne    801544 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801568:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80156c:	c9                   	leave
+  80156d:	c3                   	ret
+
+000000000080156e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80156e:	55                   	push   %rbp
+  80156f:	48 89 e5             	mov    %rsp,%rbp
+  801572:	53                   	push   %rbx
+  801573:	48 83 ec 20          	sub    $0x20,%rsp
+  801577:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801577 <strcat+0x9>
+  80157e:	49 bb c9 7a 00 00 00 	movabs $0x7ac9,%r11
+  801585:	00 00 00 
+  801588:	4c 01 db             	add    %r11,%rbx
+  80158b:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80158f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801593:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801597:	48 89 c7             	mov    %rax,%rdi
+  80159a:	48 b8 43 84 ff ff ff 	movabs $0xffffffffffff8443,%rax
+  8015a1:	ff ff ff 
+  8015a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015a8:	ff d0                	call   *%rax
+  8015aa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8015ad:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015b0:	48 63 d0             	movslq %eax,%rdx
+  8015b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b7:	48 01 c2             	add    %rax,%rdx
+  8015ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015be:	48 89 c6             	mov    %rax,%rsi
+  8015c1:	48 89 d7             	mov    %rdx,%rdi
+  8015c4:	48 b8 d7 84 ff ff ff 	movabs $0xffffffffffff84d7,%rax
+  8015cb:	ff ff ff 
+  8015ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015d2:	ff d0                	call   *%rax
+	return dst;
+  8015d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8015d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015dc:	c9                   	leave
+  8015dd:	c3                   	ret
+
+00000000008015de <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8015de:	55                   	push   %rbp
+  8015df:	48 89 e5             	mov    %rsp,%rbp
+  8015e2:	48 83 ec 28          	sub    $0x28,%rsp
+  8015e6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015e6 <strncpy+0x8>
+  8015ed:	49 bb 5a 7a 00 00 00 	movabs $0x7a5a,%r11
+  8015f4:	00 00 00 
+  8015f7:	4c 01 d8             	add    %r11,%rax
+  8015fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801602:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801606:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80160a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80160e:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801615:	00 
+  801616:	eb 2a                	jmp    801642 <strncpy+0x64>
+		*dst++ = *src;
+  801618:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80161c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801620:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801624:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801628:	0f b6 12             	movzbl (%rdx),%edx
+  80162b:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80162d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801631:	0f b6 00             	movzbl (%rax),%eax
+  801634:	84 c0                	test   %al,%al
+  801636:	74 05                	je     80163d <strncpy+0x5f>
+			src++;
+  801638:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80163d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801642:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801646:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80164a:	72 cc                	jb     801618 <strncpy+0x3a>
+	}
+	return ret;
+  80164c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801650:	c9                   	leave
+  801651:	c3                   	ret
+
+0000000000801652 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801652:	55                   	push   %rbp
+  801653:	48 89 e5             	mov    %rsp,%rbp
+  801656:	48 83 ec 28          	sub    $0x28,%rsp
+  80165a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80165a <strlcpy+0x8>
+  801661:	49 bb e6 79 00 00 00 	movabs $0x79e6,%r11
+  801668:	00 00 00 
+  80166b:	4c 01 d8             	add    %r11,%rax
+  80166e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801672:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801676:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80167a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80167e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801682:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801687:	74 3d                	je     8016c6 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801689:	eb 1d                	jmp    8016a8 <strlcpy+0x56>
+			*dst++ = *src++;
+  80168b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80168f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801693:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801697:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80169b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80169f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016a3:	0f b6 12             	movzbl (%rdx),%edx
+  8016a6:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8016a8:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016ad:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016b2:	74 0b                	je     8016bf <strlcpy+0x6d>
+  8016b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016b8:	0f b6 00             	movzbl (%rax),%eax
+  8016bb:	84 c0                	test   %al,%al
+  8016bd:	75 cc                	jne    80168b <strlcpy+0x39>
+		*dst = '\0';
+  8016bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c3:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8016c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016ca:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8016ce:	c9                   	leave
+  8016cf:	c3                   	ret
+
+00000000008016d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8016d8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016d8 <strcmp+0x8>
+  8016df:	49 bb 68 79 00 00 00 	movabs $0x7968,%r11
+  8016e6:	00 00 00 
+  8016e9:	4c 01 d8             	add    %r11,%rax
+  8016ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8016f4:	eb 0a                	jmp    801700 <strcmp+0x30>
+		p++, q++;
+  8016f6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016fb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801700:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801704:	0f b6 00             	movzbl (%rax),%eax
+  801707:	84 c0                	test   %al,%al
+  801709:	74 12                	je     80171d <strcmp+0x4d>
+  80170b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80170f:	0f b6 10             	movzbl (%rax),%edx
+  801712:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801716:	0f b6 00             	movzbl (%rax),%eax
+  801719:	38 c2                	cmp    %al,%dl
+  80171b:	74 d9                	je     8016f6 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80171d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801721:	0f b6 00             	movzbl (%rax),%eax
+  801724:	0f b6 d0             	movzbl %al,%edx
+  801727:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80172b:	0f b6 00             	movzbl (%rax),%eax
+  80172e:	0f b6 c0             	movzbl %al,%eax
+  801731:	29 c2                	sub    %eax,%edx
+  801733:	89 d0                	mov    %edx,%eax
+}
+  801735:	c9                   	leave
+  801736:	c3                   	ret
+
+0000000000801737 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801737:	55                   	push   %rbp
+  801738:	48 89 e5             	mov    %rsp,%rbp
+  80173b:	48 83 ec 18          	sub    $0x18,%rsp
+  80173f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80173f <strncmp+0x8>
+  801746:	49 bb 01 79 00 00 00 	movabs $0x7901,%r11
+  80174d:	00 00 00 
+  801750:	4c 01 d8             	add    %r11,%rax
+  801753:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801757:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80175b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80175f:	eb 0f                	jmp    801770 <strncmp+0x39>
+		n--, p++, q++;
+  801761:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801766:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80176b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801770:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801775:	74 1d                	je     801794 <strncmp+0x5d>
+  801777:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80177b:	0f b6 00             	movzbl (%rax),%eax
+  80177e:	84 c0                	test   %al,%al
+  801780:	74 12                	je     801794 <strncmp+0x5d>
+  801782:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801786:	0f b6 10             	movzbl (%rax),%edx
+  801789:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178d:	0f b6 00             	movzbl (%rax),%eax
+  801790:	38 c2                	cmp    %al,%dl
+  801792:	74 cd                	je     801761 <strncmp+0x2a>
+	if (n == 0)
+  801794:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801799:	75 07                	jne    8017a2 <strncmp+0x6b>
+		return 0;
+  80179b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a0:	eb 16                	jmp    8017b8 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8017a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017a6:	0f b6 00             	movzbl (%rax),%eax
+  8017a9:	0f b6 d0             	movzbl %al,%edx
+  8017ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017b0:	0f b6 00             	movzbl (%rax),%eax
+  8017b3:	0f b6 c0             	movzbl %al,%eax
+  8017b6:	29 c2                	sub    %eax,%edx
+}
+  8017b8:	89 d0                	mov    %edx,%eax
+  8017ba:	c9                   	leave
+  8017bb:	c3                   	ret
+
+00000000008017bc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8017bc:	55                   	push   %rbp
+  8017bd:	48 89 e5             	mov    %rsp,%rbp
+  8017c0:	48 83 ec 10          	sub    $0x10,%rsp
+  8017c4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017c4 <strchr+0x8>
+  8017cb:	49 bb 7c 78 00 00 00 	movabs $0x787c,%r11
+  8017d2:	00 00 00 
+  8017d5:	4c 01 d8             	add    %r11,%rax
+  8017d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017dc:	89 f0                	mov    %esi,%eax
+  8017de:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8017e1:	eb 17                	jmp    8017fa <strchr+0x3e>
+		if (*s == c)
+  8017e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017e7:	0f b6 00             	movzbl (%rax),%eax
+  8017ea:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8017ed:	75 06                	jne    8017f5 <strchr+0x39>
+			return (char *) s;
+  8017ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f3:	eb 15                	jmp    80180a <strchr+0x4e>
+	for (; *s; s++)
+  8017f5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017fe:	0f b6 00             	movzbl (%rax),%eax
+  801801:	84 c0                	test   %al,%al
+  801803:	75 de                	jne    8017e3 <strchr+0x27>
+	return 0;
+  801805:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80180a:	c9                   	leave
+  80180b:	c3                   	ret
+
+000000000080180c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80180c:	55                   	push   %rbp
+  80180d:	48 89 e5             	mov    %rsp,%rbp
+  801810:	48 83 ec 10          	sub    $0x10,%rsp
+  801814:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801814 <strfind+0x8>
+  80181b:	49 bb 2c 78 00 00 00 	movabs $0x782c,%r11
+  801822:	00 00 00 
+  801825:	4c 01 d8             	add    %r11,%rax
+  801828:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80182c:	89 f0                	mov    %esi,%eax
+  80182e:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801831:	eb 11                	jmp    801844 <strfind+0x38>
+		if (*s == c)
+  801833:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801837:	0f b6 00             	movzbl (%rax),%eax
+  80183a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80183d:	74 12                	je     801851 <strfind+0x45>
+	for (; *s; s++)
+  80183f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801844:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801848:	0f b6 00             	movzbl (%rax),%eax
+  80184b:	84 c0                	test   %al,%al
+  80184d:	75 e4                	jne    801833 <strfind+0x27>
+  80184f:	eb 01                	jmp    801852 <strfind+0x46>
+			break;
+  801851:	90                   	nop
+	return (char *) s;
+  801852:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801856:	c9                   	leave
+  801857:	c3                   	ret
+
+0000000000801858 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801858:	55                   	push   %rbp
+  801859:	48 89 e5             	mov    %rsp,%rbp
+  80185c:	48 83 ec 18          	sub    $0x18,%rsp
+  801860:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801860 <memset+0x8>
+  801867:	49 bb e0 77 00 00 00 	movabs $0x77e0,%r11
+  80186e:	00 00 00 
+  801871:	4c 01 d8             	add    %r11,%rax
+  801874:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801878:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80187b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80187f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801884:	75 06                	jne    80188c <memset+0x34>
+		return v;
+  801886:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80188a:	eb 69                	jmp    8018f5 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  80188c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801890:	83 e0 03             	and    $0x3,%eax
+  801893:	48 85 c0             	test   %rax,%rax
+  801896:	75 48                	jne    8018e0 <memset+0x88>
+  801898:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80189c:	83 e0 03             	and    $0x3,%eax
+  80189f:	48 85 c0             	test   %rax,%rax
+  8018a2:	75 3c                	jne    8018e0 <memset+0x88>
+		c &= 0xFF;
+  8018a4:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8018ab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ae:	c1 e0 18             	shl    $0x18,%eax
+  8018b1:	89 c2                	mov    %eax,%edx
+  8018b3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018b6:	c1 e0 10             	shl    $0x10,%eax
+  8018b9:	09 c2                	or     %eax,%edx
+  8018bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018be:	c1 e0 08             	shl    $0x8,%eax
+  8018c1:	09 d0                	or     %edx,%eax
+  8018c3:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8018c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018ca:	48 c1 e8 02          	shr    $0x2,%rax
+  8018ce:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8018d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018d5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d8:	48 89 d7             	mov    %rdx,%rdi
+  8018db:	fc                   	cld
+  8018dc:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8018de:	eb 11                	jmp    8018f1 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8018e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018e7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8018eb:	48 89 d7             	mov    %rdx,%rdi
+  8018ee:	fc                   	cld
+  8018ef:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8018f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018f5:	c9                   	leave
+  8018f6:	c3                   	ret
+
+00000000008018f7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8018f7:	55                   	push   %rbp
+  8018f8:	48 89 e5             	mov    %rsp,%rbp
+  8018fb:	48 83 ec 28          	sub    $0x28,%rsp
+  8018ff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018ff <memmove+0x8>
+  801906:	49 bb 41 77 00 00 00 	movabs $0x7741,%r11
+  80190d:	00 00 00 
+  801910:	4c 01 d8             	add    %r11,%rax
+  801913:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801917:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80191b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80191f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801923:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801927:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80192b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80192f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801933:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801937:	0f 83 88 00 00 00    	jae    8019c5 <memmove+0xce>
+  80193d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801941:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801945:	48 01 d0             	add    %rdx,%rax
+  801948:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  80194c:	73 77                	jae    8019c5 <memmove+0xce>
+		s += n;
+  80194e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801952:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801956:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80195a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80195e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801962:	83 e0 03             	and    $0x3,%eax
+  801965:	48 85 c0             	test   %rax,%rax
+  801968:	75 3b                	jne    8019a5 <memmove+0xae>
+  80196a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80196e:	83 e0 03             	and    $0x3,%eax
+  801971:	48 85 c0             	test   %rax,%rax
+  801974:	75 2f                	jne    8019a5 <memmove+0xae>
+  801976:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80197a:	83 e0 03             	and    $0x3,%eax
+  80197d:	48 85 c0             	test   %rax,%rax
+  801980:	75 23                	jne    8019a5 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801982:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801986:	48 83 e8 04          	sub    $0x4,%rax
+  80198a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80198e:	48 83 ea 04          	sub    $0x4,%rdx
+  801992:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801996:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80199a:	48 89 c7             	mov    %rax,%rdi
+  80199d:	48 89 d6             	mov    %rdx,%rsi
+  8019a0:	fd                   	std
+  8019a1:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8019a3:	eb 1d                	jmp    8019c2 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8019a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019b1:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8019b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b9:	48 89 d7             	mov    %rdx,%rdi
+  8019bc:	48 89 c1             	mov    %rax,%rcx
+  8019bf:	fd                   	std
+  8019c0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8019c2:	fc                   	cld
+  8019c3:	eb 57                	jmp    801a1c <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8019c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019c9:	83 e0 03             	and    $0x3,%eax
+  8019cc:	48 85 c0             	test   %rax,%rax
+  8019cf:	75 36                	jne    801a07 <memmove+0x110>
+  8019d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d5:	83 e0 03             	and    $0x3,%eax
+  8019d8:	48 85 c0             	test   %rax,%rax
+  8019db:	75 2a                	jne    801a07 <memmove+0x110>
+  8019dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e1:	83 e0 03             	and    $0x3,%eax
+  8019e4:	48 85 c0             	test   %rax,%rax
+  8019e7:	75 1e                	jne    801a07 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8019e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ed:	48 c1 e8 02          	shr    $0x2,%rax
+  8019f1:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8019f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019fc:	48 89 c7             	mov    %rax,%rdi
+  8019ff:	48 89 d6             	mov    %rdx,%rsi
+  801a02:	fc                   	cld
+  801a03:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a05:	eb 15                	jmp    801a1c <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801a07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a0b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a0f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a13:	48 89 c7             	mov    %rax,%rdi
+  801a16:	48 89 d6             	mov    %rdx,%rsi
+  801a19:	fc                   	cld
+  801a1a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801a1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a20:	c9                   	leave
+  801a21:	c3                   	ret
+
+0000000000801a22 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801a22:	55                   	push   %rbp
+  801a23:	48 89 e5             	mov    %rsp,%rbp
+  801a26:	48 83 ec 18          	sub    $0x18,%rsp
+  801a2a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a2a <memcpy+0x8>
+  801a31:	49 bb 16 76 00 00 00 	movabs $0x7616,%r11
+  801a38:	00 00 00 
+  801a3b:	4c 01 d8             	add    %r11,%rax
+  801a3e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a42:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a46:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801a4a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a4e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801a52:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a56:	48 89 cf             	mov    %rcx,%rdi
+  801a59:	48 b9 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rcx
+  801a60:	ff ff ff 
+  801a63:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801a67:	ff d0                	call   *%rax
+}
+  801a69:	c9                   	leave
+  801a6a:	c3                   	ret
+
+0000000000801a6b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+  801a6f:	48 83 ec 28          	sub    $0x28,%rsp
+  801a73:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a73 <memcmp+0x8>
+  801a7a:	49 bb cd 75 00 00 00 	movabs $0x75cd,%r11
+  801a81:	00 00 00 
+  801a84:	4c 01 d8             	add    %r11,%rax
+  801a87:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a8b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a8f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801a93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a97:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801a9b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a9f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801aa3:	eb 34                	jmp    801ad9 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801aa5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aa9:	0f b6 10             	movzbl (%rax),%edx
+  801aac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ab0:	0f b6 00             	movzbl (%rax),%eax
+  801ab3:	38 c2                	cmp    %al,%dl
+  801ab5:	74 18                	je     801acf <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801ab7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801abb:	0f b6 00             	movzbl (%rax),%eax
+  801abe:	0f b6 d0             	movzbl %al,%edx
+  801ac1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ac5:	0f b6 00             	movzbl (%rax),%eax
+  801ac8:	0f b6 c0             	movzbl %al,%eax
+  801acb:	29 c2                	sub    %eax,%edx
+  801acd:	eb 20                	jmp    801aef <memcmp+0x84>
+		s1++, s2++;
+  801acf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ad4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801ad9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801add:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ae1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801ae5:	48 85 c0             	test   %rax,%rax
+  801ae8:	75 bb                	jne    801aa5 <memcmp+0x3a>
+	}
+
+	return 0;
+  801aea:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801aef:	89 d0                	mov    %edx,%eax
+  801af1:	c9                   	leave
+  801af2:	c3                   	ret
+
+0000000000801af3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801af3:	55                   	push   %rbp
+  801af4:	48 89 e5             	mov    %rsp,%rbp
+  801af7:	48 83 ec 28          	sub    $0x28,%rsp
+  801afb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801afb <memfind+0x8>
+  801b02:	49 bb 45 75 00 00 00 	movabs $0x7545,%r11
+  801b09:	00 00 00 
+  801b0c:	4c 01 d8             	add    %r11,%rax
+  801b0f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b13:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801b16:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801b1a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b22:	48 01 d0             	add    %rdx,%rax
+  801b25:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801b29:	eb 13                	jmp    801b3e <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801b2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b2f:	0f b6 00             	movzbl (%rax),%eax
+  801b32:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801b35:	38 d0                	cmp    %dl,%al
+  801b37:	74 11                	je     801b4a <memfind+0x57>
+	for (; s < ends; s++)
+  801b39:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801b3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b42:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b46:	72 e3                	jb     801b2b <memfind+0x38>
+  801b48:	eb 01                	jmp    801b4b <memfind+0x58>
+			break;
+  801b4a:	90                   	nop
+	return (void *) s;
+  801b4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b4f:	c9                   	leave
+  801b50:	c3                   	ret
+
+0000000000801b51 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801b51:	55                   	push   %rbp
+  801b52:	48 89 e5             	mov    %rsp,%rbp
+  801b55:	48 83 ec 38          	sub    $0x38,%rsp
+  801b59:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b59 <strtol+0x8>
+  801b60:	49 bb e7 74 00 00 00 	movabs $0x74e7,%r11
+  801b67:	00 00 00 
+  801b6a:	4c 01 d8             	add    %r11,%rax
+  801b6d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b71:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b75:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801b78:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b7f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b86:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801b87:	eb 05                	jmp    801b8e <strtol+0x3d>
+		s++;
+  801b89:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801b8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b92:	0f b6 00             	movzbl (%rax),%eax
+  801b95:	3c 20                	cmp    $0x20,%al
+  801b97:	74 f0                	je     801b89 <strtol+0x38>
+  801b99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b9d:	0f b6 00             	movzbl (%rax),%eax
+  801ba0:	3c 09                	cmp    $0x9,%al
+  801ba2:	74 e5                	je     801b89 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801ba4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ba8:	0f b6 00             	movzbl (%rax),%eax
+  801bab:	3c 2b                	cmp    $0x2b,%al
+  801bad:	75 07                	jne    801bb6 <strtol+0x65>
+		s++;
+  801baf:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bb4:	eb 17                	jmp    801bcd <strtol+0x7c>
+	else if (*s == '-')
+  801bb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bba:	0f b6 00             	movzbl (%rax),%eax
+  801bbd:	3c 2d                	cmp    $0x2d,%al
+  801bbf:	75 0c                	jne    801bcd <strtol+0x7c>
+		s++, neg = 1;
+  801bc1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bc6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801bcd:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bd1:	74 06                	je     801bd9 <strtol+0x88>
+  801bd3:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bd7:	75 28                	jne    801c01 <strtol+0xb0>
+  801bd9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bdd:	0f b6 00             	movzbl (%rax),%eax
+  801be0:	3c 30                	cmp    $0x30,%al
+  801be2:	75 1d                	jne    801c01 <strtol+0xb0>
+  801be4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be8:	48 83 c0 01          	add    $0x1,%rax
+  801bec:	0f b6 00             	movzbl (%rax),%eax
+  801bef:	3c 78                	cmp    $0x78,%al
+  801bf1:	75 0e                	jne    801c01 <strtol+0xb0>
+		s += 2, base = 16;
+  801bf3:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801bf8:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801bff:	eb 2c                	jmp    801c2d <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801c01:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c05:	75 19                	jne    801c20 <strtol+0xcf>
+  801c07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c0b:	0f b6 00             	movzbl (%rax),%eax
+  801c0e:	3c 30                	cmp    $0x30,%al
+  801c10:	75 0e                	jne    801c20 <strtol+0xcf>
+		s++, base = 8;
+  801c12:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c17:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c1e:	eb 0d                	jmp    801c2d <strtol+0xdc>
+	else if (base == 0)
+  801c20:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c24:	75 07                	jne    801c2d <strtol+0xdc>
+		base = 10;
+  801c26:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801c2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c31:	0f b6 00             	movzbl (%rax),%eax
+  801c34:	3c 2f                	cmp    $0x2f,%al
+  801c36:	7e 1d                	jle    801c55 <strtol+0x104>
+  801c38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c3c:	0f b6 00             	movzbl (%rax),%eax
+  801c3f:	3c 39                	cmp    $0x39,%al
+  801c41:	7f 12                	jg     801c55 <strtol+0x104>
+			dig = *s - '0';
+  801c43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c47:	0f b6 00             	movzbl (%rax),%eax
+  801c4a:	0f be c0             	movsbl %al,%eax
+  801c4d:	83 e8 30             	sub    $0x30,%eax
+  801c50:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c53:	eb 4e                	jmp    801ca3 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801c55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c59:	0f b6 00             	movzbl (%rax),%eax
+  801c5c:	3c 60                	cmp    $0x60,%al
+  801c5e:	7e 1d                	jle    801c7d <strtol+0x12c>
+  801c60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c64:	0f b6 00             	movzbl (%rax),%eax
+  801c67:	3c 7a                	cmp    $0x7a,%al
+  801c69:	7f 12                	jg     801c7d <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801c6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c6f:	0f b6 00             	movzbl (%rax),%eax
+  801c72:	0f be c0             	movsbl %al,%eax
+  801c75:	83 e8 57             	sub    $0x57,%eax
+  801c78:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c7b:	eb 26                	jmp    801ca3 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c81:	0f b6 00             	movzbl (%rax),%eax
+  801c84:	3c 40                	cmp    $0x40,%al
+  801c86:	7e 47                	jle    801ccf <strtol+0x17e>
+  801c88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8c:	0f b6 00             	movzbl (%rax),%eax
+  801c8f:	3c 5a                	cmp    $0x5a,%al
+  801c91:	7f 3c                	jg     801ccf <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801c93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c97:	0f b6 00             	movzbl (%rax),%eax
+  801c9a:	0f be c0             	movsbl %al,%eax
+  801c9d:	83 e8 37             	sub    $0x37,%eax
+  801ca0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801ca3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ca6:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ca9:	7d 23                	jge    801cce <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801cab:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cb0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801cb3:	48 98                	cltq
+  801cb5:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cba:	48 89 c2             	mov    %rax,%rdx
+  801cbd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cc0:	48 98                	cltq
+  801cc2:	48 01 d0             	add    %rdx,%rax
+  801cc5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801cc9:	e9 5f ff ff ff       	jmp    801c2d <strtol+0xdc>
+			break;
+  801cce:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ccf:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cd4:	74 0b                	je     801ce1 <strtol+0x190>
+		*endptr = (char *) s;
+  801cd6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cda:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cde:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801ce1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ce5:	74 09                	je     801cf0 <strtol+0x19f>
+  801ce7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ceb:	48 f7 d8             	neg    %rax
+  801cee:	eb 04                	jmp    801cf4 <strtol+0x1a3>
+  801cf0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801cf4:	c9                   	leave
+  801cf5:	c3                   	ret
+
+0000000000801cf6 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801cf6:	55                   	push   %rbp
+  801cf7:	48 89 e5             	mov    %rsp,%rbp
+  801cfa:	53                   	push   %rbx
+  801cfb:	48 83 ec 30          	sub    $0x30,%rsp
+  801cff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801cff <strstr+0x9>
+  801d06:	49 bb 41 73 00 00 00 	movabs $0x7341,%r11
+  801d0d:	00 00 00 
+  801d10:	4c 01 db             	add    %r11,%rbx
+  801d13:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801d17:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801d1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d1f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d23:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d27:	0f b6 00             	movzbl (%rax),%eax
+  801d2a:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801d2d:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801d31:	75 06                	jne    801d39 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801d33:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d37:	eb 73                	jmp    801dac <strstr+0xb6>
+
+	len = strlen(str);
+  801d39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d3d:	48 89 c7             	mov    %rax,%rdi
+  801d40:	48 b8 43 84 ff ff ff 	movabs $0xffffffffffff8443,%rax
+  801d47:	ff ff ff 
+  801d4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d4e:	ff d0                	call   *%rax
+  801d50:	48 98                	cltq
+  801d52:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801d56:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d5a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d5e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d62:	0f b6 00             	movzbl (%rax),%eax
+  801d65:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801d68:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801d6c:	75 07                	jne    801d75 <strstr+0x7f>
+				return (char *) 0;
+  801d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d73:	eb 37                	jmp    801dac <strstr+0xb6>
+		} while (sc != c);
+  801d75:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801d79:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801d7c:	75 d8                	jne    801d56 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801d7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d82:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d86:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d8a:	48 89 ce             	mov    %rcx,%rsi
+  801d8d:	48 89 c7             	mov    %rax,%rdi
+  801d90:	48 b8 f7 86 ff ff ff 	movabs $0xffffffffffff86f7,%rax
+  801d97:	ff ff ff 
+  801d9a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d9e:	ff d0                	call   *%rax
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	75 b2                	jne    801d56 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801da4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da8:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801dac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801db0:	c9                   	leave
+  801db1:	c3                   	ret
+
+0000000000801db2 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801db2:	55                   	push   %rbp
+  801db3:	48 89 e5             	mov    %rsp,%rbp
+  801db6:	41 57                	push   %r15
+  801db8:	53                   	push   %rbx
+  801db9:	48 83 ec 40          	sub    $0x40,%rsp
+  801dbd:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801dbd <syscall+0xb>
+  801dc4:	49 bb 83 72 00 00 00 	movabs $0x7283,%r11
+  801dcb:	00 00 00 
+  801dce:	4d 01 da             	add    %r11,%r10
+  801dd1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801dd4:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801dd7:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ddb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801ddf:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801de3:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801de7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801dea:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801dee:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801df2:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801df6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801dfa:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801dfe:	4c 89 c3             	mov    %r8,%rbx
+  801e01:	cd 30                	int    $0x30
+  801e03:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801e07:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801e0b:	74 52                	je     801e5f <syscall+0xad>
+  801e0d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e12:	7e 4b                	jle    801e5f <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e14:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e1b:	49 89 d0             	mov    %rdx,%r8
+  801e1e:	89 c1                	mov    %eax,%ecx
+  801e20:	48 b8 10 e5 ff ff ff 	movabs $0xffffffffffffe510,%rax
+  801e27:	ff ff ff 
+  801e2a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e2e:	48 89 c2             	mov    %rax,%rdx
+  801e31:	be 23 00 00 00       	mov    $0x23,%esi
+  801e36:	48 b8 2d e5 ff ff ff 	movabs $0xffffffffffffe52d,%rax
+  801e3d:	ff ff ff 
+  801e40:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e44:	48 89 c7             	mov    %rax,%rdi
+  801e47:	4d 89 d7             	mov    %r10,%r15
+  801e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4f:	49 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r9
+  801e56:	ff ff ff 
+  801e59:	4d 01 d1             	add    %r10,%r9
+  801e5c:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e63:	48 83 c4 40          	add    $0x40,%rsp
+  801e67:	5b                   	pop    %rbx
+  801e68:	41 5f                	pop    %r15
+  801e6a:	5d                   	pop    %rbp
+  801e6b:	c3                   	ret
+
+0000000000801e6c <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801e6c:	55                   	push   %rbp
+  801e6d:	48 89 e5             	mov    %rsp,%rbp
+  801e70:	41 57                	push   %r15
+  801e72:	41 56                	push   %r14
+  801e74:	41 55                	push   %r13
+  801e76:	41 54                	push   %r12
+  801e78:	53                   	push   %rbx
+  801e79:	48 83 ec 48          	sub    $0x48,%rsp
+  801e7d:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801e7d <syscall_words+0x11>
+  801e84:	49 bb c3 71 00 00 00 	movabs $0x71c3,%r11
+  801e8b:	00 00 00 
+  801e8e:	4d 01 de             	add    %r11,%r14
+  801e91:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801e94:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801e97:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801e9b:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801e9f:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801ea3:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801ea7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801eac:	74 09                	je     801eb7 <syscall_words+0x4b>
+  801eae:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801eb2:	48 8b 00             	mov    (%rax),%rax
+  801eb5:	eb 05                	jmp    801ebc <syscall_words+0x50>
+  801eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebc:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801ebf:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ec4:	74 0a                	je     801ed0 <syscall_words+0x64>
+  801ec6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801eca:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ece:	eb 05                	jmp    801ed5 <syscall_words+0x69>
+  801ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed5:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801ed8:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801edd:	74 0a                	je     801ee9 <syscall_words+0x7d>
+  801edf:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ee3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ee7:	eb 05                	jmp    801eee <syscall_words+0x82>
+  801ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eee:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801ef1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ef6:	74 0a                	je     801f02 <syscall_words+0x96>
+  801ef8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801efc:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f00:	eb 05                	jmp    801f07 <syscall_words+0x9b>
+  801f02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f07:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801f0a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f0f:	74 0a                	je     801f1b <syscall_words+0xaf>
+  801f11:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f15:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f19:	eb 05                	jmp    801f20 <syscall_words+0xb4>
+  801f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f20:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801f23:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f28:	74 0a                	je     801f34 <syscall_words+0xc8>
+  801f2a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f2e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801f32:	eb 05                	jmp    801f39 <syscall_words+0xcd>
+  801f34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f39:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801f3c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f3f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801f43:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f47:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801f4b:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801f4f:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f53:	cd 30                	int    $0x30
+  801f55:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801f59:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f5e:	74 50                	je     801fb0 <syscall_words+0x144>
+		words[0] = r8;
+  801f60:	4c 89 c2             	mov    %r8,%rdx
+  801f63:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f67:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801f6a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f6e:	48 83 c0 08          	add    $0x8,%rax
+  801f72:	4c 89 ca             	mov    %r9,%rdx
+  801f75:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801f78:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f7c:	48 83 c0 10          	add    $0x10,%rax
+  801f80:	4c 89 d2             	mov    %r10,%rdx
+  801f83:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801f86:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f8a:	48 83 c0 18          	add    $0x18,%rax
+  801f8e:	4c 89 da             	mov    %r11,%rdx
+  801f91:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801f94:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f98:	48 83 c0 20          	add    $0x20,%rax
+  801f9c:	4c 89 e2             	mov    %r12,%rdx
+  801f9f:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801fa2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fa6:	48 83 c0 28          	add    $0x28,%rax
+  801faa:	4c 89 ea             	mov    %r13,%rdx
+  801fad:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801fb0:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801fb4:	74 52                	je     802008 <syscall_words+0x19c>
+  801fb6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801fbb:	7e 4b                	jle    802008 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fbd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801fc1:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801fc4:	49 89 d0             	mov    %rdx,%r8
+  801fc7:	89 c1                	mov    %eax,%ecx
+  801fc9:	48 b8 10 e5 ff ff ff 	movabs $0xffffffffffffe510,%rax
+  801fd0:	ff ff ff 
+  801fd3:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801fd7:	48 89 c2             	mov    %rax,%rdx
+  801fda:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801fdf:	48 b8 2d e5 ff ff ff 	movabs $0xffffffffffffe52d,%rax
+  801fe6:	ff ff ff 
+  801fe9:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801fed:	48 89 c7             	mov    %rax,%rdi
+  801ff0:	4d 89 f7             	mov    %r14,%r15
+  801ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff8:	49 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r9
+  801fff:	ff ff ff 
+  802002:	4d 01 f1             	add    %r14,%r9
+  802005:	41 ff d1             	call   *%r9
+
+	return ret;
+  802008:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80200c:	48 83 c4 48          	add    $0x48,%rsp
+  802010:	5b                   	pop    %rbx
+  802011:	41 5c                	pop    %r12
+  802013:	41 5d                	pop    %r13
+  802015:	41 5e                	pop    %r14
+  802017:	41 5f                	pop    %r15
+  802019:	5d                   	pop    %rbp
+  80201a:	c3                   	ret
+
+000000000080201b <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80201b:	55                   	push   %rbp
+  80201c:	48 89 e5             	mov    %rsp,%rbp
+  80201f:	48 83 ec 10          	sub    $0x10,%rsp
+  802023:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802023 <sys_cputs+0x8>
+  80202a:	49 bb 1d 70 00 00 00 	movabs $0x701d,%r11
+  802031:	00 00 00 
+  802034:	4c 01 d8             	add    %r11,%rax
+  802037:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80203b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80203f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802043:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802047:	48 83 ec 08          	sub    $0x8,%rsp
+  80204b:	6a 00                	push   $0x0
+  80204d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802053:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802059:	be 00 00 00 00       	mov    $0x0,%esi
+  80205e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802063:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80206a:	ff ff ff 
+  80206d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802071:	ff d0                	call   *%rax
+  802073:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802077:	90                   	nop
+  802078:	c9                   	leave
+  802079:	c3                   	ret
+
+000000000080207a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80207a:	55                   	push   %rbp
+  80207b:	48 89 e5             	mov    %rsp,%rbp
+  80207e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80207e <sys_cgetc+0x4>
+  802085:	49 bb c2 6f 00 00 00 	movabs $0x6fc2,%r11
+  80208c:	00 00 00 
+  80208f:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802092:	48 83 ec 08          	sub    $0x8,%rsp
+  802096:	6a 00                	push   $0x0
+  802098:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80209e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020b8:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  8020bf:	ff ff ff 
+  8020c2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020c6:	ff d0                	call   *%rax
+  8020c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+
+00000000008020ce <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+  8020d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8020d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020d6 <sys_env_destroy+0x8>
+  8020dd:	49 bb 6a 6f 00 00 00 	movabs $0x6f6a,%r11
+  8020e4:	00 00 00 
+  8020e7:	4c 01 d8             	add    %r11,%rax
+  8020ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8020ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020f0:	48 63 d2             	movslq %edx,%rdx
+  8020f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f7:	6a 00                	push   $0x0
+  8020f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802105:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80210a:	be 01 00 00 00       	mov    $0x1,%esi
+  80210f:	bf 03 00 00 00       	mov    $0x3,%edi
+  802114:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80211b:	ff ff ff 
+  80211e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802122:	ff d0                	call   *%rax
+  802124:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802128:	c9                   	leave
+  802129:	c3                   	ret
+
+000000000080212a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80212a:	55                   	push   %rbp
+  80212b:	48 89 e5             	mov    %rsp,%rbp
+  80212e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80212e <sys_getenvid+0x4>
+  802135:	49 bb 12 6f 00 00 00 	movabs $0x6f12,%r11
+  80213c:	00 00 00 
+  80213f:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802142:	48 83 ec 08          	sub    $0x8,%rsp
+  802146:	6a 00                	push   $0x0
+  802148:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80214e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802154:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802159:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215e:	be 00 00 00 00       	mov    $0x0,%esi
+  802163:	bf 02 00 00 00       	mov    $0x2,%edi
+  802168:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80216f:	ff ff ff 
+  802172:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802176:	ff d0                	call   *%rax
+  802178:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80217c:	c9                   	leave
+  80217d:	c3                   	ret
+
+000000000080217e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80217e:	55                   	push   %rbp
+  80217f:	48 89 e5             	mov    %rsp,%rbp
+  802182:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802182 <sys_yield+0x4>
+  802189:	49 bb be 6e 00 00 00 	movabs $0x6ebe,%r11
+  802190:	00 00 00 
+  802193:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802196:	48 83 ec 08          	sub    $0x8,%rsp
+  80219a:	6a 00                	push   $0x0
+  80219c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021bc:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  8021c3:	ff ff ff 
+  8021c6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021ca:	ff d0                	call   *%rax
+  8021cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021d0:	90                   	nop
+  8021d1:	c9                   	leave
+  8021d2:	c3                   	ret
+
+00000000008021d3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8021d3:	55                   	push   %rbp
+  8021d4:	48 89 e5             	mov    %rsp,%rbp
+  8021d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8021db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021db <sys_page_alloc+0x8>
+  8021e2:	49 bb 65 6e 00 00 00 	movabs $0x6e65,%r11
+  8021e9:	00 00 00 
+  8021ec:	4c 01 d8             	add    %r11,%rax
+  8021ef:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021f6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8021f9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021fc:	48 63 f2             	movslq %edx,%rsi
+  8021ff:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802203:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802206:	48 63 d2             	movslq %edx,%rdx
+  802209:	48 83 ec 08          	sub    $0x8,%rsp
+  80220d:	6a 00                	push   $0x0
+  80220f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802215:	49 89 f0             	mov    %rsi,%r8
+  802218:	be 01 00 00 00       	mov    $0x1,%esi
+  80221d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802222:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  802229:	ff ff ff 
+  80222c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802230:	ff d0                	call   *%rax
+  802232:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802236:	c9                   	leave
+  802237:	c3                   	ret
+
+0000000000802238 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802238:	55                   	push   %rbp
+  802239:	48 89 e5             	mov    %rsp,%rbp
+  80223c:	48 83 ec 20          	sub    $0x20,%rsp
+  802240:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802240 <sys_page_map+0x8>
+  802247:	49 bb 00 6e 00 00 00 	movabs $0x6e00,%r11
+  80224e:	00 00 00 
+  802251:	4c 01 d8             	add    %r11,%rax
+  802254:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802257:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80225b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80225e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802262:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802266:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802269:	48 63 f2             	movslq %edx,%rsi
+  80226c:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802270:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802273:	48 63 fa             	movslq %edx,%rdi
+  802276:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80227a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80227d:	48 63 d2             	movslq %edx,%rdx
+  802280:	48 83 ec 08          	sub    $0x8,%rsp
+  802284:	56                   	push   %rsi
+  802285:	4d 89 c1             	mov    %r8,%r9
+  802288:	49 89 f8             	mov    %rdi,%r8
+  80228b:	be 01 00 00 00       	mov    $0x1,%esi
+  802290:	bf 05 00 00 00       	mov    $0x5,%edi
+  802295:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80229c:	ff ff ff 
+  80229f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022a3:	ff d0                	call   *%rax
+  8022a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a9:	c9                   	leave
+  8022aa:	c3                   	ret
+
+00000000008022ab <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8022ab:	55                   	push   %rbp
+  8022ac:	48 89 e5             	mov    %rsp,%rbp
+  8022af:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022b3 <sys_page_unmap+0x8>
+  8022ba:	49 bb 8d 6d 00 00 00 	movabs $0x6d8d,%r11
+  8022c1:	00 00 00 
+  8022c4:	4c 01 d8             	add    %r11,%rax
+  8022c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8022ce:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022d2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022d5:	48 63 d2             	movslq %edx,%rdx
+  8022d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8022dc:	6a 00                	push   $0x0
+  8022de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ef:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022f4:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  8022fb:	ff ff ff 
+  8022fe:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802302:	ff d0                	call   *%rax
+  802304:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802308:	c9                   	leave
+  802309:	c3                   	ret
+
+000000000080230a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80230a:	55                   	push   %rbp
+  80230b:	48 89 e5             	mov    %rsp,%rbp
+  80230e:	48 83 ec 10          	sub    $0x10,%rsp
+  802312:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802312 <sys_env_set_status+0x8>
+  802319:	49 bb 2e 6d 00 00 00 	movabs $0x6d2e,%r11
+  802320:	00 00 00 
+  802323:	4c 01 d8             	add    %r11,%rax
+  802326:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802329:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80232c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80232f:	48 63 ca             	movslq %edx,%rcx
+  802332:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802335:	48 63 d2             	movslq %edx,%rdx
+  802338:	48 83 ec 08          	sub    $0x8,%rsp
+  80233c:	6a 00                	push   $0x0
+  80233e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802344:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80234a:	be 01 00 00 00       	mov    $0x1,%esi
+  80234f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802354:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80235b:	ff ff ff 
+  80235e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802362:	ff d0                	call   *%rax
+  802364:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802368:	c9                   	leave
+  802369:	c3                   	ret
+
+000000000080236a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80236a:	55                   	push   %rbp
+  80236b:	48 89 e5             	mov    %rsp,%rbp
+  80236e:	48 83 ec 10          	sub    $0x10,%rsp
+  802372:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802372 <sys_env_set_trapframe+0x8>
+  802379:	49 bb ce 6c 00 00 00 	movabs $0x6cce,%r11
+  802380:	00 00 00 
+  802383:	4c 01 d8             	add    %r11,%rax
+  802386:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802389:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80238d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802391:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802394:	48 63 d2             	movslq %edx,%rdx
+  802397:	48 83 ec 08          	sub    $0x8,%rsp
+  80239b:	6a 00                	push   $0x0
+  80239d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ae:	bf 09 00 00 00       	mov    $0x9,%edi
+  8023b3:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  8023ba:	ff ff ff 
+  8023bd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023c1:	ff d0                	call   *%rax
+  8023c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023c7:	c9                   	leave
+  8023c8:	c3                   	ret
+
+00000000008023c9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8023c9:	55                   	push   %rbp
+  8023ca:	48 89 e5             	mov    %rsp,%rbp
+  8023cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8023d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023d1 <sys_env_set_pgfault_upcall+0x8>
+  8023d8:	49 bb 6f 6c 00 00 00 	movabs $0x6c6f,%r11
+  8023df:	00 00 00 
+  8023e2:	4c 01 d8             	add    %r11,%rax
+  8023e5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023e8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8023ec:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023f0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023f3:	48 63 d2             	movslq %edx,%rdx
+  8023f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8023fa:	6a 00                	push   $0x0
+  8023fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802402:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802408:	be 01 00 00 00       	mov    $0x1,%esi
+  80240d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802412:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  802419:	ff ff ff 
+  80241c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802420:	ff d0                	call   *%rax
+  802422:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802426:	c9                   	leave
+  802427:	c3                   	ret
+
+0000000000802428 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802428:	55                   	push   %rbp
+  802429:	48 89 e5             	mov    %rsp,%rbp
+  80242c:	48 83 ec 20          	sub    $0x20,%rsp
+  802430:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802430 <sys_ipc_try_send+0x8>
+  802437:	49 bb 10 6c 00 00 00 	movabs $0x6c10,%r11
+  80243e:	00 00 00 
+  802441:	4c 01 d8             	add    %r11,%rax
+  802444:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802447:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80244b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80244f:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802452:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802455:	48 63 fa             	movslq %edx,%rdi
+  802458:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80245c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80245f:	48 63 d2             	movslq %edx,%rdx
+  802462:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802466:	48 83 ec 08          	sub    $0x8,%rsp
+  80246a:	6a 00                	push   $0x0
+  80246c:	49 89 f9             	mov    %rdi,%r9
+  80246f:	49 89 f0             	mov    %rsi,%r8
+  802472:	be 00 00 00 00       	mov    $0x0,%esi
+  802477:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80247c:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  802483:	ff ff ff 
+  802486:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80248a:	ff d0                	call   *%rax
+  80248c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802490:	c9                   	leave
+  802491:	c3                   	ret
+
+0000000000802492 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802492:	55                   	push   %rbp
+  802493:	48 89 e5             	mov    %rsp,%rbp
+  802496:	48 83 ec 20          	sub    $0x20,%rsp
+  80249a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80249a <sys_ipc_send+0x8>
+  8024a1:	49 bb a6 6b 00 00 00 	movabs $0x6ba6,%r11
+  8024a8:	00 00 00 
+  8024ab:	4c 01 d8             	add    %r11,%rax
+  8024ae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024b5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024b9:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8024bc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024bf:	48 63 fa             	movslq %edx,%rdi
+  8024c2:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024c6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024c9:	48 63 d2             	movslq %edx,%rdx
+  8024cc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d4:	6a 00                	push   $0x0
+  8024d6:	49 89 f9             	mov    %rdi,%r9
+  8024d9:	49 89 f0             	mov    %rsi,%r8
+  8024dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e1:	bf 17 00 00 00       	mov    $0x17,%edi
+  8024e6:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  8024ed:	ff ff ff 
+  8024f0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024f4:	ff d0                	call   *%rax
+  8024f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024fa:	c9                   	leave
+  8024fb:	c3                   	ret
+
+00000000008024fc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8024fc:	55                   	push   %rbp
+  8024fd:	48 89 e5             	mov    %rsp,%rbp
+  802500:	48 83 ec 10          	sub    $0x10,%rsp
+  802504:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802504 <sys_ipc_recv+0x8>
+  80250b:	49 bb 3c 6b 00 00 00 	movabs $0x6b3c,%r11
+  802512:	00 00 00 
+  802515:	4c 01 d8             	add    %r11,%rax
+  802518:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80251c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802520:	6a 00                	push   $0x0
+  802522:	6a 00                	push   $0x0
+  802524:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80252a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802530:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802535:	be 01 00 00 00       	mov    $0x1,%esi
+  80253a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80253f:	49 ba 2c 8e ff ff ff 	movabs $0xffffffffffff8e2c,%r10
+  802546:	ff ff ff 
+  802549:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80254d:	ff d0                	call   *%rax
+  80254f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802553:	c9                   	leave
+  802554:	c3                   	ret
+
+0000000000802555 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802555:	55                   	push   %rbp
+  802556:	48 89 e5             	mov    %rsp,%rbp
+  802559:	48 83 ec 30          	sub    $0x30,%rsp
+  80255d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80255d <sys_ipc_call+0x8>
+  802564:	49 bb e3 6a 00 00 00 	movabs $0x6ae3,%r11
+  80256b:	00 00 00 
+  80256e:	4c 01 d8             	add    %r11,%rax
+  802571:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802574:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802578:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80257c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80257f:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802583:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802587:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80258b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80258e:	4c 63 c2             	movslq %edx,%r8
+  802591:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802595:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802598:	48 63 d2             	movslq %edx,%rdx
+  80259b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80259f:	ff 75 d8             	push   -0x28(%rbp)
+  8025a2:	56                   	push   %rsi
+  8025a3:	4d 89 c1             	mov    %r8,%r9
+  8025a6:	49 89 f8             	mov    %rdi,%r8
+  8025a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ae:	bf 18 00 00 00       	mov    $0x18,%edi
+  8025b3:	49 ba 2c 8e ff ff ff 	movabs $0xffffffffffff8e2c,%r10
+  8025ba:	ff ff ff 
+  8025bd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025c1:	ff d0                	call   *%rax
+  8025c3:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8025c7:	c9                   	leave
+  8025c8:	c3                   	ret
+
+00000000008025c9 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8025c9:	55                   	push   %rbp
+  8025ca:	48 89 e5             	mov    %rsp,%rbp
+  8025cd:	48 83 ec 30          	sub    $0x30,%rsp
+  8025d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025d1 <sys_ipc_reply_recv+0x8>
+  8025d8:	49 bb 6f 6a 00 00 00 	movabs $0x6a6f,%r11
+  8025df:	00 00 00 
+  8025e2:	4c 01 d8             	add    %r11,%rax
+  8025e5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025e8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025ec:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025f0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8025f3:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8025f7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8025fb:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8025ff:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802602:	4c 63 c2             	movslq %edx,%r8
+  802605:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802609:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80260c:	48 63 d2             	movslq %edx,%rdx
+  80260f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802613:	ff 75 d8             	push   -0x28(%rbp)
+  802616:	56                   	push   %rsi
+  802617:	4d 89 c1             	mov    %r8,%r9
+  80261a:	49 89 f8             	mov    %rdi,%r8
+  80261d:	be 00 00 00 00       	mov    $0x0,%esi
+  802622:	bf 19 00 00 00       	mov    $0x19,%edi
+  802627:	49 ba 2c 8e ff ff ff 	movabs $0xffffffffffff8e2c,%r10
+  80262e:	ff ff ff 
+  802631:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802635:	ff d0                	call   *%rax
+  802637:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80263b:	c9                   	leave
+  80263c:	c3                   	ret
+
+000000000080263d <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80263d:	55                   	push   %rbp
+  80263e:	48 89 e5             	mov    %rsp,%rbp
+  802641:	48 83 ec 10          	sub    $0x10,%rsp
+  802645:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802645 <sys_env_set_priority+0x8>
+  80264c:	49 bb fb 69 00 00 00 	movabs $0x69fb,%r11
+  802653:	00 00 00 
+  802656:	4c 01 d8             	add    %r11,%rax
+  802659:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80265c:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80265f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802662:	48 63 ca             	movslq %edx,%rcx
+  802665:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802668:	48 63 d2             	movslq %edx,%rdx
+  80266b:	48 83 ec 08          	sub    $0x8,%rsp
+  80266f:	6a 00                	push   $0x0
+  802671:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802677:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80267d:	be 01 00 00 00       	mov    $0x1,%esi
+  802682:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802687:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80268e:	ff ff ff 
+  802691:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802695:	ff d0                	call   *%rax
+  802697:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80269b:	c9                   	leave
+  80269c:	c3                   	ret
+
+000000000080269d <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80269d:	55                   	push   %rbp
+  80269e:	48 89 e5             	mov    %rsp,%rbp
+  8026a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026a5 <sys_env_set_affinity+0x8>
+  8026ac:	49 bb 9b 69 00 00 00 	movabs $0x699b,%r11
+  8026b3:	00 00 00 
+  8026b6:	4c 01 d8             	add    %r11,%rax
+  8026b9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026bc:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8026bf:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8026c2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026c5:	48 63 d2             	movslq %edx,%rdx
+  8026c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8026cc:	6a 00                	push   $0x0
+  8026ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026da:	be 01 00 00 00       	mov    $0x1,%esi
+  8026df:	bf 10 00 00 00       	mov    $0x10,%edi
+  8026e4:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  8026eb:	ff ff ff 
+  8026ee:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026f2:	ff d0                	call   *%rax
+  8026f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f8:	c9                   	leave
+  8026f9:	c3                   	ret
+
+00000000008026fa <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8026fa:	55                   	push   %rbp
+  8026fb:	48 89 e5             	mov    %rsp,%rbp
+  8026fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026fe <sys_time_msec+0x4>
+  802705:	49 bb 42 69 00 00 00 	movabs $0x6942,%r11
+  80270c:	00 00 00 
+  80270f:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802712:	48 83 ec 08          	sub    $0x8,%rsp
+  802716:	6a 00                	push   $0x0
+  802718:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80271e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802724:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802729:	ba 00 00 00 00       	mov    $0x0,%edx
+  80272e:	be 00 00 00 00       	mov    $0x0,%esi
+  802733:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802738:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80273f:	ff ff ff 
+  802742:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802746:	ff d0                	call   *%rax
+  802748:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+000000000080274e <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80274e:	55                   	push   %rbp
+  80274f:	48 89 e5             	mov    %rsp,%rbp
+  802752:	48 83 ec 10          	sub    $0x10,%rsp
+  802756:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802756 <sys_sleep_usec+0x8>
+  80275d:	49 bb ea 68 00 00 00 	movabs $0x68ea,%r11
+  802764:	00 00 00 
+  802767:	4c 01 d8             	add    %r11,%rax
+  80276a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80276e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802772:	48 83 ec 08          	sub    $0x8,%rsp
+  802776:	6a 00                	push   $0x0
+  802778:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80277e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802784:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802789:	be 00 00 00 00       	mov    $0x0,%esi
+  80278e:	bf 11 00 00 00       	mov    $0x11,%edi
+  802793:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80279a:	ff ff ff 
+  80279d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027a1:	ff d0                	call   *%rax
+  8027a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027a7:	c9                   	leave
+  8027a8:	c3                   	ret
+
+00000000008027a9 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8027a9:	55                   	push   %rbp
+  8027aa:	48 89 e5             	mov    %rsp,%rbp
+  8027ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8027b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027b1 <sys_page_alloc_huge+0x8>
+  8027b8:	49 bb 8f 68 00 00 00 	movabs $0x688f,%r11
+  8027bf:	00 00 00 
+  8027c2:	4c 01 d8             	add    %r11,%rax
+  8027c5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027cc:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8027cf:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027d2:	48 63 f2             	movslq %edx,%rsi
+  8027d5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027d9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027dc:	48 63 d2             	movslq %edx,%rdx
+  8027df:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e3:	6a 00                	push   $0x0
+  8027e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027eb:	49 89 f0             	mov    %rsi,%r8
+  8027ee:	be 01 00 00 00       	mov    $0x1,%esi
+  8027f3:	bf 12 00 00 00       	mov    $0x12,%edi
+  8027f8:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  8027ff:	ff ff ff 
+  802802:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802806:	ff d0                	call   *%rax
+  802808:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80280c:	c9                   	leave
+  80280d:	c3                   	ret
+
+000000000080280e <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80280e:	55                   	push   %rbp
+  80280f:	48 89 e5             	mov    %rsp,%rbp
+  802812:	48 83 ec 10          	sub    $0x10,%rsp
+  802816:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802816 <sys_page_map_batch+0x8>
+  80281d:	49 bb 2a 68 00 00 00 	movabs $0x682a,%r11
+  802824:	00 00 00 
+  802827:	4c 01 d8             	add    %r11,%rax
+  80282a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80282e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802832:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802836:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80283a:	48 83 ec 08          	sub    $0x8,%rsp
+  80283e:	6a 00                	push   $0x0
+  802840:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802846:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80284c:	be 01 00 00 00       	mov    $0x1,%esi
+  802851:	bf 13 00 00 00       	mov    $0x13,%edi
+  802856:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80285d:	ff ff ff 
+  802860:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802864:	ff d0                	call   *%rax
+  802866:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80286a:	c9                   	leave
+  80286b:	c3                   	ret
+
+000000000080286c <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80286c:	55                   	push   %rbp
+  80286d:	48 89 e5             	mov    %rsp,%rbp
+  802870:	48 83 ec 10          	sub    $0x10,%rsp
+  802874:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802874 <sys_page_alloc_batch+0x8>
+  80287b:	49 bb cc 67 00 00 00 	movabs $0x67cc,%r11
+  802882:	00 00 00 
+  802885:	4c 01 d8             	add    %r11,%rax
+  802888:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80288c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802890:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802894:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802898:	48 83 ec 08          	sub    $0x8,%rsp
+  80289c:	6a 00                	push   $0x0
+  80289e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8028af:	bf 14 00 00 00       	mov    $0x14,%edi
+  8028b4:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  8028bb:	ff ff ff 
+  8028be:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028c2:	ff d0                	call   *%rax
+  8028c4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028c8:	c9                   	leave
+  8028c9:	c3                   	ret
+
+00000000008028ca <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8028ca:	55                   	push   %rbp
+  8028cb:	48 89 e5             	mov    %rsp,%rbp
+  8028ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8028d2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028d2 <sys_page_unmap_batch+0x8>
+  8028d9:	49 bb 6e 67 00 00 00 	movabs $0x676e,%r11
+  8028e0:	00 00 00 
+  8028e3:	4c 01 d8             	add    %r11,%rax
+  8028e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8028ee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028f2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8028fa:	6a 00                	push   $0x0
+  8028fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802902:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802908:	be 01 00 00 00       	mov    $0x1,%esi
+  80290d:	bf 15 00 00 00       	mov    $0x15,%edi
+  802912:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  802919:	ff ff ff 
+  80291c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802920:	ff d0                	call   *%rax
+  802922:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802926:	c9                   	leave
+  802927:	c3                   	ret
+
+0000000000802928 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802928:	55                   	push   %rbp
+  802929:	48 89 e5             	mov    %rsp,%rbp
+  80292c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80292c <sys_fork+0x4>
+  802933:	49 bb 14 67 00 00 00 	movabs $0x6714,%r11
+  80293a:	00 00 00 
+  80293d:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802940:	48 83 ec 08          	sub    $0x8,%rsp
+  802944:	6a 00                	push   $0x0
+  802946:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80294c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802952:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802957:	ba 00 00 00 00       	mov    $0x0,%edx
+  80295c:	be 00 00 00 00       	mov    $0x0,%esi
+  802961:	bf 16 00 00 00       	mov    $0x16,%edi
+  802966:	49 ba 72 8d ff ff ff 	movabs $0xffffffffffff8d72,%r10
+  80296d:	ff ff ff 
+  802970:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802974:	ff d0                	call   *%rax
+  802976:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80297a:	c9                   	leave
+  80297b:	c3                   	ret
+
+000000000080297c <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80297c:	55                   	push   %rbp
+  80297d:	48 89 e5             	mov    %rsp,%rbp
+  802980:	41 57                	push   %r15
+  802982:	53                   	push   %rbx
+  802983:	48 83 ec 40          	sub    $0x40,%rsp
+  802987:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802987 <pgfault+0xb>
+  80298e:	49 bb b9 66 00 00 00 	movabs $0x66b9,%r11
+  802995:	00 00 00 
+  802998:	4c 01 db             	add    %r11,%rbx
+  80299b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  80299f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029a3:	48 8b 00             	mov    (%rax),%rax
+  8029a6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  8029aa:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029ae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029b2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  8029b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029b9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8029bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029c1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029c7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  8029cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8029ce:	83 e0 02             	and    $0x2,%eax
+  8029d1:	85 c0                	test   %eax,%eax
+  8029d3:	0f 84 91 03 00 00    	je     802d6a <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8029d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029dd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029e1:	48 89 c2             	mov    %rax,%rdx
+  8029e4:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8029eb:	ff ff ff 
+  8029ee:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8029f2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029f6:	83 e0 01             	and    $0x1,%eax
+  8029f9:	48 85 c0             	test   %rax,%rax
+  8029fc:	0f 84 a7 01 00 00    	je     802ba9 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802a02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a06:	48 c1 e8 15          	shr    $0x15,%rax
+  802a0a:	48 89 c2             	mov    %rax,%rdx
+  802a0d:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802a14:	ff ff ff 
+  802a17:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a1b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a1f:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802a24:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802a2a:	0f 85 79 01 00 00    	jne    802ba9 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802a30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a34:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802a38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a3c:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802a42:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802a46:	ba 07 00 00 00       	mov    $0x7,%edx
+  802a4b:	be 00 00 60 00       	mov    $0x600000,%esi
+  802a50:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a55:	49 89 df             	mov    %rbx,%r15
+  802a58:	48 b8 69 97 ff ff ff 	movabs $0xffffffffffff9769,%rax
+  802a5f:	ff ff ff 
+  802a62:	48 01 d8             	add    %rbx,%rax
+  802a65:	ff d0                	call   *%rax
+  802a67:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802a6a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802a6e:	79 44                	jns    802ab4 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802a70:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802a73:	89 c1                	mov    %eax,%ecx
+  802a75:	48 b8 40 e5 ff ff ff 	movabs $0xffffffffffffe540,%rax
+  802a7c:	ff ff ff 
+  802a7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a83:	48 89 c2             	mov    %rax,%rdx
+  802a86:	be 20 00 00 00       	mov    $0x20,%esi
+  802a8b:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802a92:	ff ff ff 
+  802a95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a99:	48 89 c7             	mov    %rax,%rdi
+  802a9c:	49 89 df             	mov    %rbx,%r15
+  802a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa4:	49 b8 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r8
+  802aab:	ff ff ff 
+  802aae:	49 01 d8             	add    %rbx,%r8
+  802ab1:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802ab4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ab8:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802abd:	48 89 c6             	mov    %rax,%rsi
+  802ac0:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802ac5:	49 89 df             	mov    %rbx,%r15
+  802ac8:	48 b8 e2 89 ff ff ff 	movabs $0xffffffffffff89e2,%rax
+  802acf:	ff ff ff 
+  802ad2:	48 01 d8             	add    %rbx,%rax
+  802ad5:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802ad7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802adb:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802ae1:	48 89 c1             	mov    %rax,%rcx
+  802ae4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae9:	be 00 00 60 00       	mov    $0x600000,%esi
+  802aee:	bf 00 00 00 00       	mov    $0x0,%edi
+  802af3:	49 89 df             	mov    %rbx,%r15
+  802af6:	48 b8 f8 91 ff ff ff 	movabs $0xffffffffffff91f8,%rax
+  802afd:	ff ff ff 
+  802b00:	48 01 d8             	add    %rbx,%rax
+  802b03:	ff d0                	call   *%rax
+  802b05:	85 c0                	test   %eax,%eax
+  802b07:	74 3e                	je     802b47 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802b09:	48 b8 6b e5 ff ff ff 	movabs $0xffffffffffffe56b,%rax
+  802b10:	ff ff ff 
+  802b13:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b17:	48 89 c2             	mov    %rax,%rdx
+  802b1a:	be 23 00 00 00       	mov    $0x23,%esi
+  802b1f:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802b26:	ff ff ff 
+  802b29:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b2d:	48 89 c7             	mov    %rax,%rdi
+  802b30:	49 89 df             	mov    %rbx,%r15
+  802b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b38:	48 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%rcx
+  802b3f:	ff ff ff 
+  802b42:	48 01 d9             	add    %rbx,%rcx
+  802b45:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802b47:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b51:	49 89 df             	mov    %rbx,%r15
+  802b54:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  802b5b:	ff ff ff 
+  802b5e:	48 01 d8             	add    %rbx,%rax
+  802b61:	ff d0                	call   *%rax
+  802b63:	85 c0                	test   %eax,%eax
+  802b65:	0f 84 3d 02 00 00    	je     802da8 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802b6b:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802b72:	ff ff ff 
+  802b75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b79:	48 89 c2             	mov    %rax,%rdx
+  802b7c:	be 25 00 00 00       	mov    $0x25,%esi
+  802b81:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802b88:	ff ff ff 
+  802b8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b8f:	48 89 c7             	mov    %rax,%rdi
+  802b92:	49 89 df             	mov    %rbx,%r15
+  802b95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9a:	48 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%rcx
+  802ba1:	ff ff ff 
+  802ba4:	48 01 d9             	add    %rbx,%rcx
+  802ba7:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802ba9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bad:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bb1:	48 89 c2             	mov    %rax,%rdx
+  802bb4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802bbb:	ff ff ff 
+  802bbe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bc2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bc6:	25 00 08 00 00       	and    $0x800,%eax
+  802bcb:	48 85 c0             	test   %rax,%rax
+  802bce:	0f 84 58 01 00 00    	je     802d2c <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802bd4:	ba 07 00 00 00       	mov    $0x7,%edx
+  802bd9:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802bde:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be3:	49 89 df             	mov    %rbx,%r15
+  802be6:	48 b8 93 91 ff ff ff 	movabs $0xffffffffffff9193,%rax
+  802bed:	ff ff ff 
+  802bf0:	48 01 d8             	add    %rbx,%rax
+  802bf3:	ff d0                	call   *%rax
+  802bf5:	85 c0                	test   %eax,%eax
+  802bf7:	74 3e                	je     802c37 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802bf9:	48 b8 97 e5 ff ff ff 	movabs $0xffffffffffffe597,%rax
+  802c00:	ff ff ff 
+  802c03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c07:	48 89 c2             	mov    %rax,%rdx
+  802c0a:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802c0f:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802c16:	ff ff ff 
+  802c19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c1d:	48 89 c7             	mov    %rax,%rdi
+  802c20:	49 89 df             	mov    %rbx,%r15
+  802c23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c28:	48 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%rcx
+  802c2f:	ff ff ff 
+  802c32:	48 01 d9             	add    %rbx,%rcx
+  802c35:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802c37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c40:	48 89 c6             	mov    %rax,%rsi
+  802c43:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802c48:	49 89 df             	mov    %rbx,%r15
+  802c4b:	48 b8 e2 89 ff ff ff 	movabs $0xffffffffffff89e2,%rax
+  802c52:	ff ff ff 
+  802c55:	48 01 d8             	add    %rbx,%rax
+  802c58:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802c5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c5e:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c64:	48 89 c1             	mov    %rax,%rcx
+  802c67:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c6c:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802c71:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c76:	49 89 df             	mov    %rbx,%r15
+  802c79:	48 b8 f8 91 ff ff ff 	movabs $0xffffffffffff91f8,%rax
+  802c80:	ff ff ff 
+  802c83:	48 01 d8             	add    %rbx,%rax
+  802c86:	ff d0                	call   *%rax
+  802c88:	85 c0                	test   %eax,%eax
+  802c8a:	74 3e                	je     802cca <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802c8c:	48 b8 6b e5 ff ff ff 	movabs $0xffffffffffffe56b,%rax
+  802c93:	ff ff ff 
+  802c96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c9a:	48 89 c2             	mov    %rax,%rdx
+  802c9d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802ca2:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802ca9:	ff ff ff 
+  802cac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cb0:	48 89 c7             	mov    %rax,%rdi
+  802cb3:	49 89 df             	mov    %rbx,%r15
+  802cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbb:	48 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%rcx
+  802cc2:	ff ff ff 
+  802cc5:	48 01 d9             	add    %rbx,%rcx
+  802cc8:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802cca:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802ccf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd4:	49 89 df             	mov    %rbx,%r15
+  802cd7:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  802cde:	ff ff ff 
+  802ce1:	48 01 d8             	add    %rbx,%rax
+  802ce4:	ff d0                	call   *%rax
+  802ce6:	85 c0                	test   %eax,%eax
+  802ce8:	0f 84 bb 00 00 00    	je     802da9 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802cee:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802cf5:	ff ff ff 
+  802cf8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cfc:	48 89 c2             	mov    %rax,%rdx
+  802cff:	be 32 00 00 00       	mov    $0x32,%esi
+  802d04:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802d0b:	ff ff ff 
+  802d0e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d12:	48 89 c7             	mov    %rax,%rdi
+  802d15:	49 89 df             	mov    %rbx,%r15
+  802d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1d:	48 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%rcx
+  802d24:	ff ff ff 
+  802d27:	48 01 d9             	add    %rbx,%rcx
+  802d2a:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802d2c:	48 b8 b0 e5 ff ff ff 	movabs $0xffffffffffffe5b0,%rax
+  802d33:	ff ff ff 
+  802d36:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d3a:	48 89 c2             	mov    %rax,%rdx
+  802d3d:	be 36 00 00 00       	mov    $0x36,%esi
+  802d42:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802d49:	ff ff ff 
+  802d4c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d50:	48 89 c7             	mov    %rax,%rdi
+  802d53:	49 89 df             	mov    %rbx,%r15
+  802d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5b:	48 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%rcx
+  802d62:	ff ff ff 
+  802d65:	48 01 d9             	add    %rbx,%rcx
+  802d68:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802d6a:	48 b8 cf e5 ff ff ff 	movabs $0xffffffffffffe5cf,%rax
+  802d71:	ff ff ff 
+  802d74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d78:	48 89 c2             	mov    %rax,%rdx
+  802d7b:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802d80:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802d87:	ff ff ff 
+  802d8a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d8e:	48 89 c7             	mov    %rax,%rdi
+  802d91:	49 89 df             	mov    %rbx,%r15
+  802d94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d99:	48 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%rcx
+  802da0:	ff ff ff 
+  802da3:	48 01 d9             	add    %rbx,%rcx
+  802da6:	ff d1                	call   *%rcx
+			return;
+  802da8:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802da9:	48 83 c4 40          	add    $0x40,%rsp
+  802dad:	5b                   	pop    %rbx
+  802dae:	41 5f                	pop    %r15
+  802db0:	5d                   	pop    %rbp
+  802db1:	c3                   	ret
+
+0000000000802db2 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802db2:	55                   	push   %rbp
+  802db3:	48 89 e5             	mov    %rsp,%rbp
+  802db6:	41 57                	push   %r15
+  802db8:	53                   	push   %rbx
+  802db9:	48 83 ec 10          	sub    $0x10,%rsp
+  802dbd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dbd <fork_flush+0xb>
+  802dc4:	49 bb 83 62 00 00 00 	movabs $0x6283,%r11
+  802dcb:	00 00 00 
+  802dce:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802dd1:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802dd8:	00 00 00 
+  802ddb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ddf:	48 85 c0             	test   %rax,%rax
+  802de2:	0f 84 81 00 00 00    	je     802e69 <fork_flush+0xb7>
+  802de8:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802def:	00 00 00 
+  802df2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802df6:	48 89 c6             	mov    %rax,%rsi
+  802df9:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802e00:	00 00 00 
+  802e03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e07:	48 89 c7             	mov    %rax,%rdi
+  802e0a:	49 89 df             	mov    %rbx,%r15
+  802e0d:	48 b8 ce 97 ff ff ff 	movabs $0xffffffffffff97ce,%rax
+  802e14:	ff ff ff 
+  802e17:	48 01 d8             	add    %rbx,%rax
+  802e1a:	ff d0                	call   *%rax
+  802e1c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e1f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e23:	79 44                	jns    802e69 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802e25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e28:	89 c1                	mov    %eax,%ecx
+  802e2a:	48 b8 e8 e5 ff ff ff 	movabs $0xffffffffffffe5e8,%rax
+  802e31:	ff ff ff 
+  802e34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e38:	48 89 c2             	mov    %rax,%rdx
+  802e3b:	be 56 00 00 00       	mov    $0x56,%esi
+  802e40:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802e47:	ff ff ff 
+  802e4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e4e:	48 89 c7             	mov    %rax,%rdi
+  802e51:	49 89 df             	mov    %rbx,%r15
+  802e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e59:	49 b8 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r8
+  802e60:	ff ff ff 
+  802e63:	49 01 d8             	add    %rbx,%r8
+  802e66:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802e69:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802e70:	00 00 00 
+  802e73:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802e7a:	00 
+}
+  802e7b:	90                   	nop
+  802e7c:	48 83 c4 10          	add    $0x10,%rsp
+  802e80:	5b                   	pop    %rbx
+  802e81:	41 5f                	pop    %r15
+  802e83:	5d                   	pop    %rbp
+  802e84:	c3                   	ret
+
+0000000000802e85 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+  802e89:	53                   	push   %rbx
+  802e8a:	48 83 ec 28          	sub    $0x28,%rsp
+  802e8e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e8e <fork_map+0x9>
+  802e95:	49 bb b2 61 00 00 00 	movabs $0x61b2,%r11
+  802e9c:	00 00 00 
+  802e9f:	4c 01 db             	add    %r11,%rbx
+  802ea2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ea5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ea9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802eac:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802eb3:	00 00 00 
+  802eb6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802eba:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802ec0:	75 10                	jne    802ed2 <fork_map+0x4d>
+		fork_flush();
+  802ec2:	48 b8 72 9d ff ff ff 	movabs $0xffffffffffff9d72,%rax
+  802ec9:	ff ff ff 
+  802ecc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ed0:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802ed2:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ed9:	00 00 00 
+  802edc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ee0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802ee4:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802eeb:	00 00 00 
+  802eee:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802ef2:	48 c1 e0 05          	shl    $0x5,%rax
+  802ef6:	48 89 c2             	mov    %rax,%rdx
+  802ef9:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802f00:	00 00 00 
+  802f03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f07:	48 01 d0             	add    %rdx,%rax
+  802f0a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802f0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f12:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802f18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f1c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f20:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802f24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f28:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f2b:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802f2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f32:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f36:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802f3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f3e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802f41:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802f44:	90                   	nop
+  802f45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f49:	c9                   	leave
+  802f4a:	c3                   	ret
+
+0000000000802f4b <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802f4b:	55                   	push   %rbp
+  802f4c:	48 89 e5             	mov    %rsp,%rbp
+  802f4f:	53                   	push   %rbx
+  802f50:	48 83 ec 28          	sub    $0x28,%rsp
+  802f54:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f54 <duppage+0x9>
+  802f5b:	49 bb ec 60 00 00 00 	movabs $0x60ec,%r11
+  802f62:	00 00 00 
+  802f65:	4c 01 db             	add    %r11,%rbx
+  802f68:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f6b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802f6e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802f71:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f75:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802f79:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802f80:	ff ff ff 
+  802f83:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f87:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802f8a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f8e:	25 00 04 00 00       	and    $0x400,%eax
+  802f93:	48 85 c0             	test   %rax,%rax
+  802f96:	74 42                	je     802fda <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802f98:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802f9f:	ff ff ff 
+  802fa2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fa6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fa9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fad:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fb2:	89 c2                	mov    %eax,%edx
+  802fb4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802fb8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fbb:	48 89 ce             	mov    %rcx,%rsi
+  802fbe:	89 c7                	mov    %eax,%edi
+  802fc0:	48 b8 45 9e ff ff ff 	movabs $0xffffffffffff9e45,%rax
+  802fc7:	ff ff ff 
+  802fca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fce:	ff d0                	call   *%rax
+		return 0;
+  802fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd5:	e9 ae 00 00 00       	jmp    803088 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802fda:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802fe1:	ff ff ff 
+  802fe4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fe8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802feb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fef:	83 e0 02             	and    $0x2,%eax
+  802ff2:	48 85 c0             	test   %rax,%rax
+  802ff5:	75 1f                	jne    803016 <duppage+0xcb>
+  802ff7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ffe:	ff ff ff 
+  803001:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803005:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803008:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80300c:	25 00 08 00 00       	and    $0x800,%eax
+  803011:	48 85 c0             	test   %rax,%rax
+  803014:	74 4c                	je     803062 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  803016:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  80301d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803020:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803024:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803027:	48 89 ce             	mov    %rcx,%rsi
+  80302a:	89 c7                	mov    %eax,%edi
+  80302c:	48 b8 45 9e ff ff ff 	movabs $0xffffffffffff9e45,%rax
+  803033:	ff ff ff 
+  803036:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80303a:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  80303c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80303f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803043:	48 89 c6             	mov    %rax,%rsi
+  803046:	bf 00 00 00 00       	mov    $0x0,%edi
+  80304b:	48 b8 45 9e ff ff ff 	movabs $0xffffffffffff9e45,%rax
+  803052:	ff ff ff 
+  803055:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803059:	ff d0                	call   *%rax
+		return 0;
+  80305b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803060:	eb 26                	jmp    803088 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  803062:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803066:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803069:	ba 05 00 00 00       	mov    $0x5,%edx
+  80306e:	48 89 ce             	mov    %rcx,%rsi
+  803071:	89 c7                	mov    %eax,%edi
+  803073:	48 b8 45 9e ff ff ff 	movabs $0xffffffffffff9e45,%rax
+  80307a:	ff ff ff 
+  80307d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803081:	ff d0                	call   *%rax
+		return 0;
+  803083:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803088:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80308c:	c9                   	leave
+  80308d:	c3                   	ret
+
+000000000080308e <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  80308e:	55                   	push   %rbp
+  80308f:	48 89 e5             	mov    %rsp,%rbp
+  803092:	53                   	push   %rbx
+  803093:	48 83 ec 28          	sub    $0x28,%rsp
+  803097:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803097 <duphuge+0x9>
+  80309e:	49 bb a9 5f 00 00 00 	movabs $0x5fa9,%r11
+  8030a5:	00 00 00 
+  8030a8:	4c 01 db             	add    %r11,%rbx
+  8030ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030ae:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  8030b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030b6:	48 c1 e8 15          	shr    $0x15,%rax
+  8030ba:	48 89 c2             	mov    %rax,%rdx
+  8030bd:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8030c4:	ff ff ff 
+  8030c7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030cb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030cf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8030d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030d7:	25 00 04 00 00       	and    $0x400,%eax
+  8030dc:	48 85 c0             	test   %rax,%rax
+  8030df:	74 0e                	je     8030ef <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8030e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030e5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030ed:	eb 1e                	jmp    80310d <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  8030ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030f3:	25 02 08 00 00       	and    $0x802,%eax
+  8030f8:	48 85 c0             	test   %rax,%rax
+  8030fb:	74 09                	je     803106 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  8030fd:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  803104:	eb 07                	jmp    80310d <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  803106:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  80310d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803110:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803114:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803117:	48 89 ce             	mov    %rcx,%rsi
+  80311a:	89 c7                	mov    %eax,%edi
+  80311c:	48 b8 45 9e ff ff ff 	movabs $0xffffffffffff9e45,%rax
+  803123:	ff ff ff 
+  803126:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80312a:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  80312c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80312f:	25 00 08 00 00       	and    $0x800,%eax
+  803134:	85 c0                	test   %eax,%eax
+  803136:	74 1f                	je     803157 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  803138:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80313b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80313f:	48 89 c6             	mov    %rax,%rsi
+  803142:	bf 00 00 00 00       	mov    $0x0,%edi
+  803147:	48 b8 45 9e ff ff ff 	movabs $0xffffffffffff9e45,%rax
+  80314e:	ff ff ff 
+  803151:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803155:	ff d0                	call   *%rax
+	return 0;
+  803157:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80315c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803160:	c9                   	leave
+  803161:	c3                   	ret
+
+0000000000803162 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  803162:	55                   	push   %rbp
+  803163:	48 89 e5             	mov    %rsp,%rbp
+  803166:	41 57                	push   %r15
+  803168:	53                   	push   %rbx
+  803169:	48 83 ec 10          	sub    $0x10,%rsp
+  80316d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80316d <fork+0xb>
+  803174:	49 bb d3 5e 00 00 00 	movabs $0x5ed3,%r11
+  80317b:	00 00 00 
+  80317e:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  803181:	49 89 df             	mov    %rbx,%r15
+  803184:	48 b8 e8 98 ff ff ff 	movabs $0xffffffffffff98e8,%rax
+  80318b:	ff ff ff 
+  80318e:	48 01 d8             	add    %rbx,%rax
+  803191:	ff d0                	call   *%rax
+  803193:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803196:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80319a:	75 42                	jne    8031de <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80319c:	49 89 df             	mov    %rbx,%r15
+  80319f:	48 b8 ea 90 ff ff ff 	movabs $0xffffffffffff90ea,%rax
+  8031a6:	ff ff ff 
+  8031a9:	48 01 d8             	add    %rbx,%rax
+  8031ac:	ff d0                	call   *%rax
+  8031ae:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031b3:	48 98                	cltq
+  8031b5:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8031bc:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8031c3:	ff ff ff 
+  8031c6:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8031ca:	48 01 c2             	add    %rax,%rdx
+  8031cd:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8031d4:	ff ff ff 
+  8031d7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031db:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8031de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8031e1:	48 83 c4 10          	add    $0x10,%rsp
+  8031e5:	5b                   	pop    %rbx
+  8031e6:	41 5f                	pop    %r15
+  8031e8:	5d                   	pop    %rbp
+  8031e9:	c3                   	ret
+
+00000000008031ea <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8031ea:	55                   	push   %rbp
+  8031eb:	48 89 e5             	mov    %rsp,%rbp
+  8031ee:	41 57                	push   %r15
+  8031f0:	53                   	push   %rbx
+  8031f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8031f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031f5 <ufork+0xb>
+  8031fc:	49 bb 4b 5e 00 00 00 	movabs $0x5e4b,%r11
+  803203:	00 00 00 
+  803206:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  803209:	48 b8 3c 99 ff ff ff 	movabs $0xffffffffffff993c,%rax
+  803210:	ff ff ff 
+  803213:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803217:	48 89 c7             	mov    %rax,%rdi
+  80321a:	49 89 df             	mov    %rbx,%r15
+  80321d:	48 b8 03 de ff ff ff 	movabs $0xffffffffffffde03,%rax
+  803224:	ff ff ff 
+  803227:	48 01 d8             	add    %rbx,%rax
+  80322a:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80322c:	b8 07 00 00 00       	mov    $0x7,%eax
+  803231:	cd 30                	int    $0x30
+  803233:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  803236:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  803239:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  80323c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803240:	0f 84 03 02 00 00    	je     803449 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  803246:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80324d:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  80324e:	e9 28 01 00 00       	jmp    80337b <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  803253:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803257:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80325b:	48 89 c2             	mov    %rax,%rdx
+  80325e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803265:	ff ff ff 
+  803268:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80326c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803270:	83 e0 01             	and    $0x1,%eax
+  803273:	48 85 c0             	test   %rax,%rax
+  803276:	0f 84 f7 00 00 00    	je     803373 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  80327c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803280:	48 c1 e8 15          	shr    $0x15,%rax
+  803284:	48 89 c2             	mov    %rax,%rdx
+  803287:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80328e:	ff ff ff 
+  803291:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803295:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803299:	25 81 00 00 00       	and    $0x81,%eax
+  80329e:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  8032a4:	75 29                	jne    8032cf <ufork+0xe5>
+					duphuge(child_envid, addr);
+  8032a6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8032aa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032ad:	48 89 d6             	mov    %rdx,%rsi
+  8032b0:	89 c7                	mov    %eax,%edi
+  8032b2:	48 b8 4e a0 ff ff ff 	movabs $0xffffffffffffa04e,%rax
+  8032b9:	ff ff ff 
+  8032bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032c0:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  8032c2:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8032c9:	00 
+  8032ca:	e9 ac 00 00 00       	jmp    80337b <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8032cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032d3:	48 c1 e8 15          	shr    $0x15,%rax
+  8032d7:	48 89 c2             	mov    %rax,%rdx
+  8032da:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8032e1:	ff ff ff 
+  8032e4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032e8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032ec:	83 e0 01             	and    $0x1,%eax
+  8032ef:	48 85 c0             	test   %rax,%rax
+  8032f2:	74 75                	je     803369 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  8032f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032f8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8032fc:	48 89 c2             	mov    %rax,%rdx
+  8032ff:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803306:	ff ff ff 
+  803309:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80330d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803311:	83 e0 01             	and    $0x1,%eax
+  803314:	48 85 c0             	test   %rax,%rax
+  803317:	74 46                	je     80335f <ufork+0x175>
+  803319:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80331d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803321:	48 89 c2             	mov    %rax,%rdx
+  803324:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80332b:	ff ff ff 
+  80332e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803332:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803336:	83 e0 04             	and    $0x4,%eax
+  803339:	48 85 c0             	test   %rax,%rax
+  80333c:	74 21                	je     80335f <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  80333e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803342:	48 c1 e8 0c          	shr    $0xc,%rax
+  803346:	89 c2                	mov    %eax,%edx
+  803348:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80334b:	89 d6                	mov    %edx,%esi
+  80334d:	89 c7                	mov    %eax,%edi
+  80334f:	48 b8 0b 9f ff ff ff 	movabs $0xffffffffffff9f0b,%rax
+  803356:	ff ff ff 
+  803359:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80335d:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  80335f:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803366:	00 
+  803367:	eb 12                	jmp    80337b <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803369:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803370:	00 
+  803371:	eb 08                	jmp    80337b <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  803373:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  80337a:	40 
+		for (; addr < USTACKTOP;){
+  80337b:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803380:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  803384:	0f 83 c9 fe ff ff    	jae    803253 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  80338a:	48 b8 72 9d ff ff ff 	movabs $0xffffffffffff9d72,%rax
+  803391:	ff ff ff 
+  803394:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803398:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  80339a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80339d:	ba 07 00 00 00       	mov    $0x7,%edx
+  8033a2:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8033a7:	48 89 ce             	mov    %rcx,%rsi
+  8033aa:	89 c7                	mov    %eax,%edi
+  8033ac:	49 89 df             	mov    %rbx,%r15
+  8033af:	48 b8 93 91 ff ff ff 	movabs $0xffffffffffff9193,%rax
+  8033b6:	ff ff ff 
+  8033b9:	48 01 d8             	add    %rbx,%rax
+  8033bc:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8033be:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033c1:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8033c8:	ff ff ff 
+  8033cb:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8033cf:	48 89 d6             	mov    %rdx,%rsi
+  8033d2:	89 c7                	mov    %eax,%edi
+  8033d4:	49 89 df             	mov    %rbx,%r15
+  8033d7:	48 b8 89 93 ff ff ff 	movabs $0xffffffffffff9389,%rax
+  8033de:	ff ff ff 
+  8033e1:	48 01 d8             	add    %rbx,%rax
+  8033e4:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8033e6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033e9:	be 02 00 00 00       	mov    $0x2,%esi
+  8033ee:	89 c7                	mov    %eax,%edi
+  8033f0:	49 89 df             	mov    %rbx,%r15
+  8033f3:	48 b8 ca 92 ff ff ff 	movabs $0xffffffffffff92ca,%rax
+  8033fa:	ff ff ff 
+  8033fd:	48 01 d8             	add    %rbx,%rax
+  803400:	ff d0                	call   *%rax
+  803402:	85 c0                	test   %eax,%eax
+  803404:	74 3e                	je     803444 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803406:	48 b8 0f e6 ff ff ff 	movabs $0xffffffffffffe60f,%rax
+  80340d:	ff ff ff 
+  803410:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803414:	48 89 c2             	mov    %rax,%rdx
+  803417:	be 07 01 00 00       	mov    $0x107,%esi
+  80341c:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  803423:	ff ff ff 
+  803426:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80342a:	48 89 c7             	mov    %rax,%rdi
+  80342d:	49 89 df             	mov    %rbx,%r15
+  803430:	b8 00 00 00 00       	mov    $0x0,%eax
+  803435:	48 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%rcx
+  80343c:	ff ff ff 
+  80343f:	48 01 d9             	add    %rbx,%rcx
+  803442:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803444:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803447:	eb 59                	jmp    8034a2 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803449:	49 89 df             	mov    %rbx,%r15
+  80344c:	48 b8 ea 90 ff ff ff 	movabs $0xffffffffffff90ea,%rax
+  803453:	ff ff ff 
+  803456:	48 01 d8             	add    %rbx,%rax
+  803459:	ff d0                	call   *%rax
+  80345b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803460:	48 98                	cltq
+  803462:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803469:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803470:	ff ff ff 
+  803473:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803477:	48 01 c2             	add    %rax,%rdx
+  80347a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803481:	ff ff ff 
+  803484:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803488:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  80348b:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803492:	00 00 00 
+  803495:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  80349c:	00 
+		return 0;
+  80349d:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  8034a2:	48 83 c4 10          	add    $0x10,%rsp
+  8034a6:	5b                   	pop    %rbx
+  8034a7:	41 5f                	pop    %r15
+  8034a9:	5d                   	pop    %rbp
+  8034aa:	c3                   	ret
+
+00000000008034ab <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8034ab:	55                   	push   %rbp
+  8034ac:	48 89 e5             	mov    %rsp,%rbp
+  8034af:	41 57                	push   %r15
+  8034b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8034b5:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8034b5 <sfork+0xa>
+  8034bc:	49 bb 8b 5b 00 00 00 	movabs $0x5b8b,%r11
+  8034c3:	00 00 00 
+  8034c6:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8034c9:	48 b8 2a e6 ff ff ff 	movabs $0xffffffffffffe62a,%rax
+  8034d0:	ff ff ff 
+  8034d3:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8034d7:	48 89 c2             	mov    %rax,%rdx
+  8034da:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8034df:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  8034e6:	ff ff ff 
+  8034e9:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8034ed:	48 89 c7             	mov    %rax,%rdi
+  8034f0:	49 89 cf             	mov    %rcx,%r15
+  8034f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f8:	49 b8 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r8
+  8034ff:	ff ff ff 
+  803502:	49 01 c8             	add    %rcx,%r8
+  803505:	41 ff d0             	call   *%r8
+
+0000000000803508 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803508:	55                   	push   %rbp
+  803509:	48 89 e5             	mov    %rsp,%rbp
+  80350c:	41 57                	push   %r15
+  80350e:	53                   	push   %rbx
+  80350f:	48 83 ec 30          	sub    $0x30,%rsp
+  803513:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803513 <ipc_recv+0xb>
+  80351a:	49 bb 2d 5b 00 00 00 	movabs $0x5b2d,%r11
+  803521:	00 00 00 
+  803524:	4c 01 db             	add    %r11,%rbx
+  803527:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80352b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80352f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  803533:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803538:	75 0e                	jne    803548 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  80353a:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803541:	00 00 00 
+  803544:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  803548:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80354c:	48 89 c7             	mov    %rax,%rdi
+  80354f:	49 89 df             	mov    %rbx,%r15
+  803552:	48 b8 bc 94 ff ff ff 	movabs $0xffffffffffff94bc,%rax
+  803559:	ff ff ff 
+  80355c:	48 01 d8             	add    %rbx,%rax
+  80355f:	ff d0                	call   *%rax
+  803561:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  803564:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803569:	74 2a                	je     803595 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  80356b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80356f:	75 19                	jne    80358a <ipc_recv+0x82>
+  803571:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803578:	ff ff ff 
+  80357b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80357f:	48 8b 00             	mov    (%rax),%rax
+  803582:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803588:	eb 05                	jmp    80358f <ipc_recv+0x87>
+  80358a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803593:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  803595:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80359a:	74 2a                	je     8035c6 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  80359c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035a0:	75 19                	jne    8035bb <ipc_recv+0xb3>
+  8035a2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8035a9:	ff ff ff 
+  8035ac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035b0:	48 8b 00             	mov    (%rax),%rax
+  8035b3:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8035b9:	eb 05                	jmp    8035c0 <ipc_recv+0xb8>
+  8035bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8035c4:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  8035c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035ca:	74 05                	je     8035d1 <ipc_recv+0xc9>
+		return res;
+  8035cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035cf:	eb 17                	jmp    8035e8 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  8035d1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8035d8:	ff ff ff 
+  8035db:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8035df:	48 8b 00             	mov    (%rax),%rax
+  8035e2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8035e8:	48 83 c4 30          	add    $0x30,%rsp
+  8035ec:	5b                   	pop    %rbx
+  8035ed:	41 5f                	pop    %r15
+  8035ef:	5d                   	pop    %rbp
+  8035f0:	c3                   	ret
+
+00000000008035f1 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8035f1:	55                   	push   %rbp
+  8035f2:	48 89 e5             	mov    %rsp,%rbp
+  8035f5:	41 57                	push   %r15
+  8035f7:	53                   	push   %rbx
+  8035f8:	48 83 ec 20          	sub    $0x20,%rsp
+  8035fc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035fc <ipc_send+0xb>
+  803603:	49 bb 44 5a 00 00 00 	movabs $0x5a44,%r11
+  80360a:	00 00 00 
+  80360d:	4c 01 db             	add    %r11,%rbx
+  803610:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803613:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  803616:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80361a:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  80361d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803622:	75 0e                	jne    803632 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  803624:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80362b:	00 00 00 
+  80362e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  803632:	90                   	nop
+  803633:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  803636:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803639:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80363d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803640:	89 c7                	mov    %eax,%edi
+  803642:	49 89 df             	mov    %rbx,%r15
+  803645:	48 b8 52 94 ff ff ff 	movabs $0xffffffffffff9452,%rax
+  80364c:	ff ff ff 
+  80364f:	48 01 d8             	add    %rbx,%rax
+  803652:	ff d0                	call   *%rax
+  803654:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  803657:	74 da                	je     803633 <ipc_send+0x42>
+		;
+}
+  803659:	90                   	nop
+  80365a:	90                   	nop
+  80365b:	48 83 c4 20          	add    $0x20,%rsp
+  80365f:	5b                   	pop    %rbx
+  803660:	41 5f                	pop    %r15
+  803662:	5d                   	pop    %rbp
+  803663:	c3                   	ret
+
+0000000000803664 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  803664:	55                   	push   %rbp
+  803665:	48 89 e5             	mov    %rsp,%rbp
+  803668:	41 57                	push   %r15
+  80366a:	53                   	push   %rbx
+  80366b:	48 83 ec 40          	sub    $0x40,%rsp
+  80366f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80366f <ipc_call+0xb>
+  803676:	49 bb d1 59 00 00 00 	movabs $0x59d1,%r11
+  80367d:	00 00 00 
+  803680:	4c 01 db             	add    %r11,%rbx
+  803683:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803686:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803689:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80368d:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803690:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803694:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803698:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80369d:	75 0e                	jne    8036ad <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  80369f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8036a6:	00 00 00 
+  8036a9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8036ad:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8036b2:	75 0e                	jne    8036c2 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8036b4:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8036bb:	00 00 00 
+  8036be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8036c2:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8036c5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8036c9:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8036cc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8036d0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8036d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8036d9:	49 89 f8             	mov    %rdi,%r8
+  8036dc:	89 c7                	mov    %eax,%edi
+  8036de:	49 89 df             	mov    %rbx,%r15
+  8036e1:	48 b8 15 95 ff ff ff 	movabs $0xffffffffffff9515,%rax
+  8036e8:	ff ff ff 
+  8036eb:	48 01 d8             	add    %rbx,%rax
+  8036ee:	ff d0                	call   *%rax
+  8036f0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8036f3:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8036f8:	74 2a                	je     803724 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8036fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036fe:	75 19                	jne    803719 <ipc_call+0xb5>
+  803700:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803707:	ff ff ff 
+  80370a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80370e:	48 8b 00             	mov    (%rax),%rax
+  803711:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803717:	eb 05                	jmp    80371e <ipc_call+0xba>
+  803719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80371e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803722:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803724:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803728:	74 05                	je     80372f <ipc_call+0xcb>
+		return r;
+  80372a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80372d:	eb 17                	jmp    803746 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  80372f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803736:	ff ff ff 
+  803739:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80373d:	48 8b 00             	mov    (%rax),%rax
+  803740:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803746:	48 83 c4 40          	add    $0x40,%rsp
+  80374a:	5b                   	pop    %rbx
+  80374b:	41 5f                	pop    %r15
+  80374d:	5d                   	pop    %rbp
+  80374e:	c3                   	ret
+
+000000000080374f <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  80374f:	55                   	push   %rbp
+  803750:	48 89 e5             	mov    %rsp,%rbp
+  803753:	41 57                	push   %r15
+  803755:	53                   	push   %rbx
+  803756:	48 83 ec 70          	sub    $0x70,%rsp
+  80375a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80375a <ipc_callw+0xb>
+  803761:	49 bb e6 58 00 00 00 	movabs $0x58e6,%r11
+  803768:	00 00 00 
+  80376b:	4c 01 db             	add    %r11,%rbx
+  80376e:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  803771:	89 75 98             	mov    %esi,-0x68(%rbp)
+  803774:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  803778:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  80377c:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  803781:	76 0a                	jbe    80378d <ipc_callw+0x3e>
+		return -E_INVAL;
+  803783:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803788:	e9 b7 00 00 00       	jmp    803844 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  80378d:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803791:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  803795:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803799:	48 89 ce             	mov    %rcx,%rsi
+  80379c:	48 89 c7             	mov    %rax,%rdi
+  80379f:	49 89 df             	mov    %rbx,%r15
+  8037a2:	48 b8 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rax
+  8037a9:	ff ff ff 
+  8037ac:	48 01 d8             	add    %rbx,%rax
+  8037af:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  8037b1:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8037b8:	00 
+  8037b9:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8037bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037c1:	48 01 d0             	add    %rdx,%rax
+  8037c4:	48 83 e8 01          	sub    $0x1,%rax
+  8037c8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8037cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037d5:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8037d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037dd:	48 29 d0             	sub    %rdx,%rax
+  8037e0:	48 c1 e8 03          	shr    $0x3,%rax
+  8037e4:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  8037e8:	89 c1                	mov    %eax,%ecx
+  8037ea:	8b 75 98             	mov    -0x68(%rbp),%esi
+  8037ed:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  8037f1:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8037f4:	49 89 d1             	mov    %rdx,%r9
+  8037f7:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8037fe:	00 00 00 
+  803801:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  803808:	00 00 00 
+  80380b:	89 c7                	mov    %eax,%edi
+  80380d:	49 89 df             	mov    %rbx,%r15
+  803810:	48 b8 15 95 ff ff ff 	movabs $0xffffffffffff9515,%rax
+  803817:	ff ff ff 
+  80381a:	48 01 d8             	add    %rbx,%rax
+  80381d:	ff d0                	call   *%rax
+  80381f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  803822:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803826:	74 05                	je     80382d <ipc_callw+0xde>
+		return r;
+  803828:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80382b:	eb 17                	jmp    803844 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  80382d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803834:	ff ff ff 
+  803837:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80383b:	48 8b 00             	mov    (%rax),%rax
+  80383e:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803844:	48 83 c4 70          	add    $0x70,%rsp
+  803848:	5b                   	pop    %rbx
+  803849:	41 5f                	pop    %r15
+  80384b:	5d                   	pop    %rbp
+  80384c:	c3                   	ret
+
+000000000080384d <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  80384d:	55                   	push   %rbp
+  80384e:	48 89 e5             	mov    %rsp,%rbp
+  803851:	41 57                	push   %r15
+  803853:	53                   	push   %rbx
+  803854:	48 83 ec 40          	sub    $0x40,%rsp
+  803858:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803858 <ipc_callv+0xb>
+  80385f:	49 bb e8 57 00 00 00 	movabs $0x57e8,%r11
+  803866:	00 00 00 
+  803869:	4c 01 db             	add    %r11,%rbx
+  80386c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80386f:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  803872:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803876:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803879:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  80387d:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  803881:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803888:	00 00 00 
+  80388b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  80388f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  803893:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  803897:	74 11                	je     8038aa <ipc_callv+0x5d>
+		pg = (void *) segs;
+  803899:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80389d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  8038a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8038a4:	c1 e0 14             	shl    $0x14,%eax
+  8038a7:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  8038aa:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  8038ae:	74 14                	je     8038c4 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  8038b0:	8b 45 20             	mov    0x20(%rbp),%eax
+  8038b3:	83 e8 01             	sub    $0x1,%eax
+  8038b6:	48 63 d0             	movslq %eax,%rdx
+  8038b9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8038bd:	48 09 d0             	or     %rdx,%rax
+  8038c0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  8038c4:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8038c7:	c1 e0 10             	shl    $0x10,%eax
+  8038ca:	0b 45 10             	or     0x10(%rbp),%eax
+  8038cd:	89 c1                	mov    %eax,%ecx
+  8038cf:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  8038d2:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8038d6:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8038da:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8038de:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8038e1:	4d 89 c1             	mov    %r8,%r9
+  8038e4:	49 89 f8             	mov    %rdi,%r8
+  8038e7:	89 c7                	mov    %eax,%edi
+  8038e9:	49 89 df             	mov    %rbx,%r15
+  8038ec:	48 b8 15 95 ff ff ff 	movabs $0xffffffffffff9515,%rax
+  8038f3:	ff ff ff 
+  8038f6:	48 01 d8             	add    %rbx,%rax
+  8038f9:	ff d0                	call   *%rax
+  8038fb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8038fe:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803902:	74 05                	je     803909 <ipc_callv+0xbc>
+		return r;
+  803904:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803907:	eb 17                	jmp    803920 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  803909:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803910:	ff ff ff 
+  803913:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803917:	48 8b 00             	mov    (%rax),%rax
+  80391a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803920:	48 83 c4 40          	add    $0x40,%rsp
+  803924:	5b                   	pop    %rbx
+  803925:	41 5f                	pop    %r15
+  803927:	5d                   	pop    %rbp
+  803928:	c3                   	ret
+
+0000000000803929 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  803929:	55                   	push   %rbp
+  80392a:	48 89 e5             	mov    %rsp,%rbp
+  80392d:	41 57                	push   %r15
+  80392f:	53                   	push   %rbx
+  803930:	48 83 ec 40          	sub    $0x40,%rsp
+  803934:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803934 <ipc_reply_recv+0xb>
+  80393b:	49 bb 0c 57 00 00 00 	movabs $0x570c,%r11
+  803942:	00 00 00 
+  803945:	4c 01 db             	add    %r11,%rbx
+  803948:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80394b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80394e:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803952:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803955:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803959:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80395d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803962:	75 0e                	jne    803972 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  803964:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80396b:	00 00 00 
+  80396e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803972:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803977:	75 0e                	jne    803987 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803979:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803980:	00 00 00 
+  803983:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803987:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80398a:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  80398e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803992:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803995:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803999:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80399c:	4d 89 c1             	mov    %r8,%r9
+  80399f:	49 89 f8             	mov    %rdi,%r8
+  8039a2:	89 c7                	mov    %eax,%edi
+  8039a4:	49 89 df             	mov    %rbx,%r15
+  8039a7:	48 b8 89 95 ff ff ff 	movabs $0xffffffffffff9589,%rax
+  8039ae:	ff ff ff 
+  8039b1:	48 01 d8             	add    %rbx,%rax
+  8039b4:	ff d0                	call   *%rax
+  8039b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  8039b9:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8039be:	74 2a                	je     8039ea <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8039c0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039c4:	75 19                	jne    8039df <ipc_reply_recv+0xb6>
+  8039c6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8039cd:	ff ff ff 
+  8039d0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039d4:	48 8b 00             	mov    (%rax),%rax
+  8039d7:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8039dd:	eb 05                	jmp    8039e4 <ipc_reply_recv+0xbb>
+  8039df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039e8:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  8039ea:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  8039ef:	74 2a                	je     803a1b <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8039f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039f5:	75 19                	jne    803a10 <ipc_reply_recv+0xe7>
+  8039f7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8039fe:	ff ff ff 
+  803a01:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a05:	48 8b 00             	mov    (%rax),%rax
+  803a08:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803a0e:	eb 05                	jmp    803a15 <ipc_reply_recv+0xec>
+  803a10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a15:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  803a19:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803a1b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a1f:	74 05                	je     803a26 <ipc_reply_recv+0xfd>
+		return r;
+  803a21:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a24:	eb 17                	jmp    803a3d <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  803a26:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803a2d:	ff ff ff 
+  803a30:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a34:	48 8b 00             	mov    (%rax),%rax
+  803a37:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803a3d:	48 83 c4 40          	add    $0x40,%rsp
+  803a41:	5b                   	pop    %rbx
+  803a42:	41 5f                	pop    %r15
+  803a44:	5d                   	pop    %rbp
+  803a45:	c3                   	ret
+
+0000000000803a46 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  803a46:	55                   	push   %rbp
+  803a47:	48 89 e5             	mov    %rsp,%rbp
+  803a4a:	41 57                	push   %r15
+  803a4c:	53                   	push   %rbx
+  803a4d:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  803a54:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a54 <ipc_window_batch+0xe>
+  803a5b:	49 bb ec 55 00 00 00 	movabs $0x55ec,%r11
+  803a62:	00 00 00 
+  803a65:	4c 01 db             	add    %r11,%rbx
+  803a68:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  803a6e:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  803a75:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803a7b:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  803a81:	e9 15 01 00 00       	jmp    803b9b <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803a86:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803a8c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803a8f:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803a96:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803a99:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803a9c:	39 c2                	cmp    %eax,%edx
+  803a9e:	0f 4e c2             	cmovle %edx,%eax
+  803aa1:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  803aa4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803aab:	eb 6b                	jmp    803b18 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803aad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ab0:	48 98                	cltq
+  803ab2:	48 c1 e0 05          	shl    $0x5,%rax
+  803ab6:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803aba:	48 01 e8             	add    %rbp,%rax
+  803abd:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  803ac3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803ac9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803acc:	c1 e0 0c             	shl    $0xc,%eax
+  803acf:	48 63 d0             	movslq %eax,%rdx
+  803ad2:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803ad9:	48 01 c2             	add    %rax,%rdx
+  803adc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803adf:	48 98                	cltq
+  803ae1:	48 c1 e0 05          	shl    $0x5,%rax
+  803ae5:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803ae9:	48 01 e8             	add    %rbp,%rax
+  803aec:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  803af2:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  803af5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803af8:	48 98                	cltq
+  803afa:	48 c1 e0 05          	shl    $0x5,%rax
+  803afe:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803b02:	48 01 e8             	add    %rbp,%rax
+  803b05:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  803b0c:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  803b12:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  803b14:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803b18:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b1b:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  803b1e:	7c 8d                	jl     803aad <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  803b20:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  803b27:	74 27                	je     803b50 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803b29:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803b2c:	48 63 d0             	movslq %eax,%rdx
+  803b2f:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803b36:	48 89 d6             	mov    %rdx,%rsi
+  803b39:	48 89 c7             	mov    %rax,%rdi
+  803b3c:	49 89 df             	mov    %rbx,%r15
+  803b3f:	48 b8 2c 98 ff ff ff 	movabs $0xffffffffffff982c,%rax
+  803b46:	ff ff ff 
+  803b49:	48 01 d8             	add    %rbx,%rax
+  803b4c:	ff d0                	call   *%rax
+  803b4e:	eb 25                	jmp    803b75 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  803b50:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803b53:	48 63 d0             	movslq %eax,%rdx
+  803b56:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803b5d:	48 89 d6             	mov    %rdx,%rsi
+  803b60:	48 89 c7             	mov    %rax,%rdi
+  803b63:	49 89 df             	mov    %rbx,%r15
+  803b66:	48 b8 8a 98 ff ff ff 	movabs $0xffffffffffff988a,%rax
+  803b6d:	ff ff ff 
+  803b70:	48 01 d8             	add    %rbx,%rax
+  803b73:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803b75:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803b78:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803b7c:	79 05                	jns    803b83 <ipc_window_batch+0x13d>
+			return r;
+  803b7e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b81:	eb 2a                	jmp    803bad <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  803b83:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803b86:	c1 e0 0c             	shl    $0xc,%eax
+  803b89:	48 98                	cltq
+  803b8b:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  803b92:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803b95:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803b9b:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  803ba2:	0f 8f de fe ff ff    	jg     803a86 <ipc_window_batch+0x40>
+	}
+	return 0;
+  803ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bad:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  803bb4:	5b                   	pop    %rbx
+  803bb5:	41 5f                	pop    %r15
+  803bb7:	5d                   	pop    %rbp
+  803bb8:	c3                   	ret
+
+0000000000803bb9 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803bb9:	55                   	push   %rbp
+  803bba:	48 89 e5             	mov    %rsp,%rbp
+  803bbd:	48 83 ec 10          	sub    $0x10,%rsp
+  803bc1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803bc1 <ipc_map_window+0x8>
+  803bc8:	49 bb 7f 54 00 00 00 	movabs $0x547f,%r11
+  803bcf:	00 00 00 
+  803bd2:	4c 01 d8             	add    %r11,%rax
+  803bd5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803bd9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803bdc:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803bdf:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803be3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803be8:	bf 01 00 00 00       	mov    $0x1,%edi
+  803bed:	49 b8 06 aa ff ff ff 	movabs $0xffffffffffffaa06,%r8
+  803bf4:	ff ff ff 
+  803bf7:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803bfb:	ff d0                	call   *%rax
+}
+  803bfd:	c9                   	leave
+  803bfe:	c3                   	ret
+
+0000000000803bff <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803bff:	55                   	push   %rbp
+  803c00:	48 89 e5             	mov    %rsp,%rbp
+  803c03:	48 83 ec 10          	sub    $0x10,%rsp
+  803c07:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c07 <ipc_unmap_window+0x8>
+  803c0e:	49 bb 39 54 00 00 00 	movabs $0x5439,%r11
+  803c15:	00 00 00 
+  803c18:	4c 01 d8             	add    %r11,%rax
+  803c1b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803c1f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  803c22:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c25:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803c29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803c2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c33:	49 b8 06 aa ff ff ff 	movabs $0xffffffffffffaa06,%r8
+  803c3a:	ff ff ff 
+  803c3d:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803c41:	ff d0                	call   *%rax
+}
+  803c43:	c9                   	leave
+  803c44:	c3                   	ret
+
+0000000000803c45 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803c45:	55                   	push   %rbp
+  803c46:	48 89 e5             	mov    %rsp,%rbp
+  803c49:	48 83 ec 18          	sub    $0x18,%rsp
+  803c4d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c4d <ipc_find_env+0x8>
+  803c54:	49 bb f3 53 00 00 00 	movabs $0x53f3,%r11
+  803c5b:	00 00 00 
+  803c5e:	4c 01 d8             	add    %r11,%rax
+  803c61:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803c64:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803c6b:	eb 57                	jmp    803cc4 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803c6d:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803c74:	ff ff ff 
+  803c77:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803c7b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803c7e:	48 63 d2             	movslq %edx,%rdx
+  803c81:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803c88:	48 01 ca             	add    %rcx,%rdx
+  803c8b:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803c92:	8b 12                	mov    (%rdx),%edx
+  803c94:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803c97:	75 27                	jne    803cc0 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803c99:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803ca0:	ff ff ff 
+  803ca3:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803ca7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803caa:	48 98                	cltq
+  803cac:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803cb3:	48 01 d0             	add    %rdx,%rax
+  803cb6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803cbc:	8b 00                	mov    (%rax),%eax
+  803cbe:	eb 12                	jmp    803cd2 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803cc0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803cc4:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803ccb:	7e a0                	jle    803c6d <ipc_find_env+0x28>
+	}
+	return 0;
+  803ccd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cd2:	c9                   	leave
+  803cd3:	c3                   	ret
+
+0000000000803cd4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803cd4:	55                   	push   %rbp
+  803cd5:	48 89 e5             	mov    %rsp,%rbp
+  803cd8:	48 83 ec 08          	sub    $0x8,%rsp
+  803cdc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cdc <fd2num+0x8>
+  803ce3:	49 bb 64 53 00 00 00 	movabs $0x5364,%r11
+  803cea:	00 00 00 
+  803ced:	4c 01 d8             	add    %r11,%rax
+  803cf0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803cf4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cf8:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803cff:	ff ff ff 
+  803d02:	48 01 d0             	add    %rdx,%rax
+  803d05:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803d09:	c9                   	leave
+  803d0a:	c3                   	ret
+
+0000000000803d0b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803d0b:	55                   	push   %rbp
+  803d0c:	48 89 e5             	mov    %rsp,%rbp
+  803d0f:	48 83 ec 08          	sub    $0x8,%rsp
+  803d13:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d13 <fd2data+0x8>
+  803d1a:	49 bb 2d 53 00 00 00 	movabs $0x532d,%r11
+  803d21:	00 00 00 
+  803d24:	4c 01 d8             	add    %r11,%rax
+  803d27:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803d2b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d2f:	48 89 d7             	mov    %rdx,%rdi
+  803d32:	48 ba 94 ac ff ff ff 	movabs $0xffffffffffffac94,%rdx
+  803d39:	ff ff ff 
+  803d3c:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803d40:	ff d0                	call   *%rax
+  803d42:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803d48:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803d4c:	c9                   	leave
+  803d4d:	c3                   	ret
+
+0000000000803d4e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803d4e:	55                   	push   %rbp
+  803d4f:	48 89 e5             	mov    %rsp,%rbp
+  803d52:	48 83 ec 18          	sub    $0x18,%rsp
+  803d56:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d56 <fd_alloc+0x8>
+  803d5d:	49 bb ea 52 00 00 00 	movabs $0x52ea,%r11
+  803d64:	00 00 00 
+  803d67:	4c 01 d8             	add    %r11,%rax
+  803d6a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803d6e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803d75:	eb 75                	jmp    803dec <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803d77:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803d7a:	48 63 d2             	movslq %edx,%rdx
+  803d7d:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803d84:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803d88:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803d8c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d90:	48 89 d1             	mov    %rdx,%rcx
+  803d93:	48 c1 e9 15          	shr    $0x15,%rcx
+  803d97:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803d9e:	ff ff ff 
+  803da1:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803da5:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803da9:	83 e2 01             	and    $0x1,%edx
+  803dac:	48 85 d2             	test   %rdx,%rdx
+  803daf:	74 25                	je     803dd6 <fd_alloc+0x88>
+  803db1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803db5:	48 89 d1             	mov    %rdx,%rcx
+  803db8:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803dbc:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803dc3:	ff ff ff 
+  803dc6:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803dca:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803dce:	83 e2 01             	and    $0x1,%edx
+  803dd1:	48 85 d2             	test   %rdx,%rdx
+  803dd4:	75 12                	jne    803de8 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803dd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dda:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803dde:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de6:	eb 1a                	jmp    803e02 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803de8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803dec:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803df0:	7e 85                	jle    803d77 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803df2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803df6:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803dfd:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803e02:	c9                   	leave
+  803e03:	c3                   	ret
+
+0000000000803e04 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803e04:	55                   	push   %rbp
+  803e05:	48 89 e5             	mov    %rsp,%rbp
+  803e08:	48 83 ec 20          	sub    $0x20,%rsp
+  803e0c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e0c <fd_lookup+0x8>
+  803e13:	49 bb 34 52 00 00 00 	movabs $0x5234,%r11
+  803e1a:	00 00 00 
+  803e1d:	4c 01 d8             	add    %r11,%rax
+  803e20:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e23:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803e27:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e2b:	78 06                	js     803e33 <fd_lookup+0x2f>
+  803e2d:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803e31:	7e 07                	jle    803e3a <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803e33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e38:	eb 73                	jmp    803ead <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803e3a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803e3d:	48 63 d2             	movslq %edx,%rdx
+  803e40:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803e47:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803e4b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803e4f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e53:	48 89 d1             	mov    %rdx,%rcx
+  803e56:	48 c1 e9 15          	shr    $0x15,%rcx
+  803e5a:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803e61:	ff ff ff 
+  803e64:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803e68:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803e6c:	83 e2 01             	and    $0x1,%edx
+  803e6f:	48 85 d2             	test   %rdx,%rdx
+  803e72:	74 22                	je     803e96 <fd_lookup+0x92>
+  803e74:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e78:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803e7c:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803e83:	ff ff ff 
+  803e86:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803e8a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803e8e:	83 e0 01             	and    $0x1,%eax
+  803e91:	48 85 c0             	test   %rax,%rax
+  803e94:	75 07                	jne    803e9d <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803e96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e9b:	eb 10                	jmp    803ead <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803e9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ea1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ea5:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ead:	c9                   	leave
+  803eae:	c3                   	ret
+
+0000000000803eaf <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803eaf:	55                   	push   %rbp
+  803eb0:	48 89 e5             	mov    %rsp,%rbp
+  803eb3:	41 57                	push   %r15
+  803eb5:	53                   	push   %rbx
+  803eb6:	48 83 ec 30          	sub    $0x30,%rsp
+  803eba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803eba <fd_close+0xb>
+  803ec1:	49 bb 86 51 00 00 00 	movabs $0x5186,%r11
+  803ec8:	00 00 00 
+  803ecb:	4c 01 db             	add    %r11,%rbx
+  803ece:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803ed2:	89 f0                	mov    %esi,%eax
+  803ed4:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803ed7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803edb:	48 89 c7             	mov    %rax,%rdi
+  803ede:	48 b8 94 ac ff ff ff 	movabs $0xffffffffffffac94,%rax
+  803ee5:	ff ff ff 
+  803ee8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eec:	ff d0                	call   *%rax
+  803eee:	89 c2                	mov    %eax,%edx
+  803ef0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803ef4:	48 89 c6             	mov    %rax,%rsi
+  803ef7:	89 d7                	mov    %edx,%edi
+  803ef9:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  803f00:	ff ff ff 
+  803f03:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f07:	ff d0                	call   *%rax
+  803f09:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f0c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f10:	78 0a                	js     803f1c <fd_close+0x6d>
+	    || fd != fd2)
+  803f12:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f16:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803f1a:	74 12                	je     803f2e <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803f1c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803f20:	74 05                	je     803f27 <fd_close+0x78>
+  803f22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f25:	eb 7a                	jmp    803fa1 <fd_close+0xf2>
+  803f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2c:	eb 73                	jmp    803fa1 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803f2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f32:	8b 00                	mov    (%rax),%eax
+  803f34:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803f38:	48 89 d6             	mov    %rdx,%rsi
+  803f3b:	89 c7                	mov    %eax,%edi
+  803f3d:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  803f44:	ff ff ff 
+  803f47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f4b:	ff d0                	call   *%rax
+  803f4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f50:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f54:	78 2a                	js     803f80 <fd_close+0xd1>
+		if (dev->dev_close)
+  803f56:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f5a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803f5e:	48 85 c0             	test   %rax,%rax
+  803f61:	74 16                	je     803f79 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803f63:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f67:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803f6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f6f:	48 89 c7             	mov    %rax,%rdi
+  803f72:	ff d2                	call   *%rdx
+  803f74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f77:	eb 07                	jmp    803f80 <fd_close+0xd1>
+		else
+			r = 0;
+  803f79:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  803f80:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f84:	48 89 c6             	mov    %rax,%rsi
+  803f87:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f8c:	49 89 df             	mov    %rbx,%r15
+  803f8f:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  803f96:	ff ff ff 
+  803f99:	48 01 d8             	add    %rbx,%rax
+  803f9c:	ff d0                	call   *%rax
+	return r;
+  803f9e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803fa1:	48 83 c4 30          	add    $0x30,%rsp
+  803fa5:	5b                   	pop    %rbx
+  803fa6:	41 5f                	pop    %r15
+  803fa8:	5d                   	pop    %rbp
+  803fa9:	c3                   	ret
+
+0000000000803faa <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  803faa:	55                   	push   %rbp
+  803fab:	48 89 e5             	mov    %rsp,%rbp
+  803fae:	41 57                	push   %r15
+  803fb0:	48 83 ec 28          	sub    $0x28,%rsp
+  803fb4:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803fb4 <dev_lookup+0xa>
+  803fbb:	49 bb 8c 50 00 00 00 	movabs $0x508c,%r11
+  803fc2:	00 00 00 
+  803fc5:	4c 01 d9             	add    %r11,%rcx
+  803fc8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803fcb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803fcf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803fd6:	eb 45                	jmp    80401d <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803fd8:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803fdf:	00 00 00 
+  803fe2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fe5:	48 98                	cltq
+  803fe7:	48 01 ca             	add    %rcx,%rdx
+  803fea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803fee:	8b 00                	mov    (%rax),%eax
+  803ff0:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803ff3:	75 24                	jne    804019 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803ff5:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803ffc:	00 00 00 
+  803fff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804002:	48 98                	cltq
+  804004:	48 01 ca             	add    %rcx,%rdx
+  804007:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80400b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80400f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  804012:	b8 00 00 00 00       	mov    $0x0,%eax
+  804017:	eb 74                	jmp    80408d <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  804019:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80401d:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  804024:	00 00 00 
+  804027:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80402a:	48 98                	cltq
+  80402c:	48 01 ca             	add    %rcx,%rdx
+  80402f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804033:	48 85 c0             	test   %rax,%rax
+  804036:	75 a0                	jne    803fd8 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  804038:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80403f:	ff ff ff 
+  804042:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  804046:	48 8b 00             	mov    (%rax),%rax
+  804049:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80404f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804052:	89 c6                	mov    %eax,%esi
+  804054:	48 b8 40 e6 ff ff ff 	movabs $0xffffffffffffe640,%rax
+  80405b:	ff ff ff 
+  80405e:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  804062:	48 89 c7             	mov    %rax,%rdi
+  804065:	49 89 cf             	mov    %rcx,%r15
+  804068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80406d:	49 b8 15 77 ff ff ff 	movabs $0xffffffffffff7715,%r8
+  804074:	ff ff ff 
+  804077:	49 01 c8             	add    %rcx,%r8
+  80407a:	41 ff d0             	call   *%r8
+	*dev = 0;
+  80407d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804081:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  804088:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80408d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804091:	c9                   	leave
+  804092:	c3                   	ret
+
+0000000000804093 <close>:
+
+int
+close(int fdnum)
+{
+  804093:	55                   	push   %rbp
+  804094:	48 89 e5             	mov    %rsp,%rbp
+  804097:	53                   	push   %rbx
+  804098:	48 83 ec 28          	sub    $0x28,%rsp
+  80409c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80409c <close+0x9>
+  8040a3:	49 bb a4 4f 00 00 00 	movabs $0x4fa4,%r11
+  8040aa:	00 00 00 
+  8040ad:	4c 01 db             	add    %r11,%rbx
+  8040b0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8040b3:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8040b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040ba:	48 89 d6             	mov    %rdx,%rsi
+  8040bd:	89 c7                	mov    %eax,%edi
+  8040bf:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  8040c6:	ff ff ff 
+  8040c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040cd:	ff d0                	call   *%rax
+  8040cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040d6:	79 05                	jns    8040dd <close+0x4a>
+		return r;
+  8040d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040db:	eb 1c                	jmp    8040f9 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  8040dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040e1:	be 01 00 00 00       	mov    $0x1,%esi
+  8040e6:	48 89 c7             	mov    %rax,%rdi
+  8040e9:	48 b8 6f ae ff ff ff 	movabs $0xffffffffffffae6f,%rax
+  8040f0:	ff ff ff 
+  8040f3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040f7:	ff d0                	call   *%rax
+}
+  8040f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040fd:	c9                   	leave
+  8040fe:	c3                   	ret
+
+00000000008040ff <close_all>:
+
+void
+close_all(void)
+{
+  8040ff:	55                   	push   %rbp
+  804100:	48 89 e5             	mov    %rsp,%rbp
+  804103:	53                   	push   %rbx
+  804104:	48 83 ec 18          	sub    $0x18,%rsp
+  804108:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804108 <close_all+0x9>
+  80410f:	49 bb 38 4f 00 00 00 	movabs $0x4f38,%r11
+  804116:	00 00 00 
+  804119:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80411c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804123:	eb 19                	jmp    80413e <close_all+0x3f>
+		close(i);
+  804125:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804128:	89 c7                	mov    %eax,%edi
+  80412a:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  804131:	ff ff ff 
+  804134:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804138:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  80413a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80413e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  804142:	7e e1                	jle    804125 <close_all+0x26>
+}
+  804144:	90                   	nop
+  804145:	90                   	nop
+  804146:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80414a:	c9                   	leave
+  80414b:	c3                   	ret
+
+000000000080414c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80414c:	55                   	push   %rbp
+  80414d:	48 89 e5             	mov    %rsp,%rbp
+  804150:	41 57                	push   %r15
+  804152:	53                   	push   %rbx
+  804153:	48 83 ec 40          	sub    $0x40,%rsp
+  804157:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804157 <dup+0xb>
+  80415e:	49 bb e9 4e 00 00 00 	movabs $0x4ee9,%r11
+  804165:	00 00 00 
+  804168:	4c 01 db             	add    %r11,%rbx
+  80416b:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80416e:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  804171:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  804175:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804178:	48 89 d6             	mov    %rdx,%rsi
+  80417b:	89 c7                	mov    %eax,%edi
+  80417d:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  804184:	ff ff ff 
+  804187:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80418b:	ff d0                	call   *%rax
+  80418d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804190:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804194:	79 08                	jns    80419e <dup+0x52>
+		return r;
+  804196:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804199:	e9 a4 01 00 00       	jmp    804342 <dup+0x1f6>
+	close(newfdnum);
+  80419e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8041a1:	89 c7                	mov    %eax,%edi
+  8041a3:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  8041aa:	ff ff ff 
+  8041ad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041b1:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8041b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8041b6:	48 98                	cltq
+  8041b8:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8041be:	48 c1 e0 0c          	shl    $0xc,%rax
+  8041c2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  8041c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041ca:	48 89 c7             	mov    %rax,%rdi
+  8041cd:	48 b8 cb ac ff ff ff 	movabs $0xffffffffffffaccb,%rax
+  8041d4:	ff ff ff 
+  8041d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041db:	ff d0                	call   *%rax
+  8041dd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  8041e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041e5:	48 89 c7             	mov    %rax,%rdi
+  8041e8:	48 b8 cb ac ff ff ff 	movabs $0xffffffffffffaccb,%rax
+  8041ef:	ff ff ff 
+  8041f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041f6:	ff d0                	call   *%rax
+  8041f8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8041fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804200:	48 c1 e8 15          	shr    $0x15,%rax
+  804204:	48 89 c2             	mov    %rax,%rdx
+  804207:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80420e:	ff ff ff 
+  804211:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804215:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804219:	83 e0 01             	and    $0x1,%eax
+  80421c:	48 85 c0             	test   %rax,%rax
+  80421f:	74 7f                	je     8042a0 <dup+0x154>
+  804221:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804225:	48 c1 e8 0c          	shr    $0xc,%rax
+  804229:	48 89 c2             	mov    %rax,%rdx
+  80422c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804233:	ff ff ff 
+  804236:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80423a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80423e:	83 e0 01             	and    $0x1,%eax
+  804241:	48 85 c0             	test   %rax,%rax
+  804244:	74 5a                	je     8042a0 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  804246:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80424a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80424e:	48 89 c2             	mov    %rax,%rdx
+  804251:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804258:	ff ff ff 
+  80425b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80425f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804263:	25 07 0e 00 00       	and    $0xe07,%eax
+  804268:	89 c1                	mov    %eax,%ecx
+  80426a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80426e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804272:	41 89 c8             	mov    %ecx,%r8d
+  804275:	48 89 d1             	mov    %rdx,%rcx
+  804278:	ba 00 00 00 00       	mov    $0x0,%edx
+  80427d:	48 89 c6             	mov    %rax,%rsi
+  804280:	bf 00 00 00 00       	mov    $0x0,%edi
+  804285:	49 89 df             	mov    %rbx,%r15
+  804288:	48 b8 f8 91 ff ff ff 	movabs $0xffffffffffff91f8,%rax
+  80428f:	ff ff ff 
+  804292:	48 01 d8             	add    %rbx,%rax
+  804295:	ff d0                	call   *%rax
+  804297:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80429a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80429e:	78 5f                	js     8042ff <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8042a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042a4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8042a8:	48 89 c2             	mov    %rax,%rdx
+  8042ab:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8042b2:	ff ff ff 
+  8042b5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8042b9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8042bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8042c2:	89 c1                	mov    %eax,%ecx
+  8042c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042c8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8042cc:	41 89 c8             	mov    %ecx,%r8d
+  8042cf:	48 89 d1             	mov    %rdx,%rcx
+  8042d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042d7:	48 89 c6             	mov    %rax,%rsi
+  8042da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042df:	49 89 df             	mov    %rbx,%r15
+  8042e2:	48 b8 f8 91 ff ff ff 	movabs $0xffffffffffff91f8,%rax
+  8042e9:	ff ff ff 
+  8042ec:	48 01 d8             	add    %rbx,%rax
+  8042ef:	ff d0                	call   *%rax
+  8042f1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042f4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042f8:	78 08                	js     804302 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  8042fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8042fd:	eb 43                	jmp    804342 <dup+0x1f6>
+			goto err;
+  8042ff:	90                   	nop
+  804300:	eb 01                	jmp    804303 <dup+0x1b7>
+		goto err;
+  804302:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  804303:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804307:	48 89 c6             	mov    %rax,%rsi
+  80430a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80430f:	49 89 df             	mov    %rbx,%r15
+  804312:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  804319:	ff ff ff 
+  80431c:	48 01 d8             	add    %rbx,%rax
+  80431f:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  804321:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804325:	48 89 c6             	mov    %rax,%rsi
+  804328:	bf 00 00 00 00       	mov    $0x0,%edi
+  80432d:	49 89 df             	mov    %rbx,%r15
+  804330:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  804337:	ff ff ff 
+  80433a:	48 01 d8             	add    %rbx,%rax
+  80433d:	ff d0                	call   *%rax
+	return r;
+  80433f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804342:	48 83 c4 40          	add    $0x40,%rsp
+  804346:	5b                   	pop    %rbx
+  804347:	41 5f                	pop    %r15
+  804349:	5d                   	pop    %rbp
+  80434a:	c3                   	ret
+
+000000000080434b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80434b:	55                   	push   %rbp
+  80434c:	48 89 e5             	mov    %rsp,%rbp
+  80434f:	41 57                	push   %r15
+  804351:	53                   	push   %rbx
+  804352:	48 83 ec 40          	sub    $0x40,%rsp
+  804356:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804356 <read+0xb>
+  80435d:	49 bb ea 4c 00 00 00 	movabs $0x4cea,%r11
+  804364:	00 00 00 
+  804367:	4c 01 db             	add    %r11,%rbx
+  80436a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80436d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804371:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804375:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804379:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80437c:	48 89 d6             	mov    %rdx,%rsi
+  80437f:	89 c7                	mov    %eax,%edi
+  804381:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  804388:	ff ff ff 
+  80438b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80438f:	ff d0                	call   *%rax
+  804391:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804394:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804398:	78 28                	js     8043c2 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80439a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80439e:	8b 00                	mov    (%rax),%eax
+  8043a0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8043a4:	48 89 d6             	mov    %rdx,%rsi
+  8043a7:	89 c7                	mov    %eax,%edi
+  8043a9:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  8043b0:	ff ff ff 
+  8043b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043b7:	ff d0                	call   *%rax
+  8043b9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043c0:	79 08                	jns    8043ca <read+0x7f>
+		return r;
+  8043c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043c5:	e9 8b 00 00 00       	jmp    804455 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8043ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043ce:	8b 40 08             	mov    0x8(%rax),%eax
+  8043d1:	83 e0 03             	and    $0x3,%eax
+  8043d4:	83 f8 01             	cmp    $0x1,%eax
+  8043d7:	75 4b                	jne    804424 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8043d9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8043e0:	ff ff ff 
+  8043e3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8043e7:	48 8b 00             	mov    (%rax),%rax
+  8043ea:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8043f0:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8043f3:	89 c6                	mov    %eax,%esi
+  8043f5:	48 b8 5f e6 ff ff ff 	movabs $0xffffffffffffe65f,%rax
+  8043fc:	ff ff ff 
+  8043ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804403:	48 89 c7             	mov    %rax,%rdi
+  804406:	49 89 df             	mov    %rbx,%r15
+  804409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80440e:	48 b9 15 77 ff ff ff 	movabs $0xffffffffffff7715,%rcx
+  804415:	ff ff ff 
+  804418:	48 01 d9             	add    %rbx,%rcx
+  80441b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80441d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804422:	eb 31                	jmp    804455 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  804424:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804428:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80442c:	48 85 c0             	test   %rax,%rax
+  80442f:	75 07                	jne    804438 <read+0xed>
+		return -E_NOT_SUPP;
+  804431:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804436:	eb 1d                	jmp    804455 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  804438:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80443c:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  804440:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804444:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804448:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80444c:	48 89 ce             	mov    %rcx,%rsi
+  80444f:	48 89 c7             	mov    %rax,%rdi
+  804452:	41 ff d0             	call   *%r8
+}
+  804455:	48 83 c4 40          	add    $0x40,%rsp
+  804459:	5b                   	pop    %rbx
+  80445a:	41 5f                	pop    %r15
+  80445c:	5d                   	pop    %rbp
+  80445d:	c3                   	ret
+
+000000000080445e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80445e:	55                   	push   %rbp
+  80445f:	48 89 e5             	mov    %rsp,%rbp
+  804462:	53                   	push   %rbx
+  804463:	48 83 ec 38          	sub    $0x38,%rsp
+  804467:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804467 <readn+0x9>
+  80446e:	49 bb d9 4b 00 00 00 	movabs $0x4bd9,%r11
+  804475:	00 00 00 
+  804478:	4c 01 db             	add    %r11,%rbx
+  80447b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80447e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804482:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  804486:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80448d:	eb 4b                	jmp    8044da <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80448f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804492:	48 98                	cltq
+  804494:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804498:	48 29 c2             	sub    %rax,%rdx
+  80449b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80449e:	48 63 c8             	movslq %eax,%rcx
+  8044a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044a5:	48 01 c1             	add    %rax,%rcx
+  8044a8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044ab:	48 89 ce             	mov    %rcx,%rsi
+  8044ae:	89 c7                	mov    %eax,%edi
+  8044b0:	48 b8 0b b3 ff ff ff 	movabs $0xffffffffffffb30b,%rax
+  8044b7:	ff ff ff 
+  8044ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044be:	ff d0                	call   *%rax
+  8044c0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  8044c3:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8044c7:	79 05                	jns    8044ce <readn+0x70>
+			return m;
+  8044c9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8044cc:	eb 1d                	jmp    8044eb <readn+0x8d>
+		if (m == 0)
+  8044ce:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8044d2:	74 13                	je     8044e7 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  8044d4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8044d7:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8044da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044dd:	48 98                	cltq
+  8044df:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  8044e3:	72 aa                	jb     80448f <readn+0x31>
+  8044e5:	eb 01                	jmp    8044e8 <readn+0x8a>
+			break;
+  8044e7:	90                   	nop
+	}
+	return tot;
+  8044e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8044eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8044ef:	c9                   	leave
+  8044f0:	c3                   	ret
+
+00000000008044f1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8044f1:	55                   	push   %rbp
+  8044f2:	48 89 e5             	mov    %rsp,%rbp
+  8044f5:	41 57                	push   %r15
+  8044f7:	53                   	push   %rbx
+  8044f8:	48 83 ec 40          	sub    $0x40,%rsp
+  8044fc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044fc <write+0xb>
+  804503:	49 bb 44 4b 00 00 00 	movabs $0x4b44,%r11
+  80450a:	00 00 00 
+  80450d:	4c 01 db             	add    %r11,%rbx
+  804510:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804513:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804517:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80451b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80451f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804522:	48 89 d6             	mov    %rdx,%rsi
+  804525:	89 c7                	mov    %eax,%edi
+  804527:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  80452e:	ff ff ff 
+  804531:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804535:	ff d0                	call   *%rax
+  804537:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80453a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80453e:	78 28                	js     804568 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804540:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804544:	8b 00                	mov    (%rax),%eax
+  804546:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80454a:	48 89 d6             	mov    %rdx,%rsi
+  80454d:	89 c7                	mov    %eax,%edi
+  80454f:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  804556:	ff ff ff 
+  804559:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80455d:	ff d0                	call   *%rax
+  80455f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804562:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804566:	79 08                	jns    804570 <write+0x7f>
+		return r;
+  804568:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80456b:	e9 8a 00 00 00       	jmp    8045fa <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804570:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804574:	8b 40 08             	mov    0x8(%rax),%eax
+  804577:	83 e0 03             	and    $0x3,%eax
+  80457a:	85 c0                	test   %eax,%eax
+  80457c:	75 4b                	jne    8045c9 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80457e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804585:	ff ff ff 
+  804588:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80458c:	48 8b 00             	mov    (%rax),%rax
+  80458f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804595:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804598:	89 c6                	mov    %eax,%esi
+  80459a:	48 b8 7b e6 ff ff ff 	movabs $0xffffffffffffe67b,%rax
+  8045a1:	ff ff ff 
+  8045a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045a8:	48 89 c7             	mov    %rax,%rdi
+  8045ab:	49 89 df             	mov    %rbx,%r15
+  8045ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b3:	48 b9 15 77 ff ff ff 	movabs $0xffffffffffff7715,%rcx
+  8045ba:	ff ff ff 
+  8045bd:	48 01 d9             	add    %rbx,%rcx
+  8045c0:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8045c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8045c7:	eb 31                	jmp    8045fa <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8045c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045cd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8045d1:	48 85 c0             	test   %rax,%rax
+  8045d4:	75 07                	jne    8045dd <write+0xec>
+		return -E_NOT_SUPP;
+  8045d6:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8045db:	eb 1d                	jmp    8045fa <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  8045dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045e1:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8045e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045e9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8045ed:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8045f1:	48 89 ce             	mov    %rcx,%rsi
+  8045f4:	48 89 c7             	mov    %rax,%rdi
+  8045f7:	41 ff d0             	call   *%r8
+}
+  8045fa:	48 83 c4 40          	add    $0x40,%rsp
+  8045fe:	5b                   	pop    %rbx
+  8045ff:	41 5f                	pop    %r15
+  804601:	5d                   	pop    %rbp
+  804602:	c3                   	ret
+
+0000000000804603 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  804603:	55                   	push   %rbp
+  804604:	48 89 e5             	mov    %rsp,%rbp
+  804607:	48 83 ec 18          	sub    $0x18,%rsp
+  80460b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80460b <seek+0x8>
+  804612:	49 bb 35 4a 00 00 00 	movabs $0x4a35,%r11
+  804619:	00 00 00 
+  80461c:	4c 01 d8             	add    %r11,%rax
+  80461f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804622:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804625:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  804629:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80462c:	48 89 ce             	mov    %rcx,%rsi
+  80462f:	89 d7                	mov    %edx,%edi
+  804631:	48 ba c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rdx
+  804638:	ff ff ff 
+  80463b:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80463f:	ff d0                	call   *%rax
+  804641:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804644:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804648:	79 05                	jns    80464f <seek+0x4c>
+		return r;
+  80464a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80464d:	eb 0f                	jmp    80465e <seek+0x5b>
+	fd->fd_offset = offset;
+  80464f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804653:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804656:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  804659:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80465e:	c9                   	leave
+  80465f:	c3                   	ret
+
+0000000000804660 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  804660:	55                   	push   %rbp
+  804661:	48 89 e5             	mov    %rsp,%rbp
+  804664:	41 57                	push   %r15
+  804666:	53                   	push   %rbx
+  804667:	48 83 ec 30          	sub    $0x30,%rsp
+  80466b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80466b <ftruncate+0xb>
+  804672:	49 bb d5 49 00 00 00 	movabs $0x49d5,%r11
+  804679:	00 00 00 
+  80467c:	4c 01 db             	add    %r11,%rbx
+  80467f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804682:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804685:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804689:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80468c:	48 89 d6             	mov    %rdx,%rsi
+  80468f:	89 c7                	mov    %eax,%edi
+  804691:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  804698:	ff ff ff 
+  80469b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80469f:	ff d0                	call   *%rax
+  8046a1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046a4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046a8:	78 28                	js     8046d2 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8046aa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046ae:	8b 00                	mov    (%rax),%eax
+  8046b0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8046b4:	48 89 d6             	mov    %rdx,%rsi
+  8046b7:	89 c7                	mov    %eax,%edi
+  8046b9:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  8046c0:	ff ff ff 
+  8046c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046c7:	ff d0                	call   *%rax
+  8046c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046d0:	79 08                	jns    8046da <ftruncate+0x7a>
+		return r;
+  8046d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046d5:	e9 83 00 00 00       	jmp    80475d <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8046da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046de:	8b 40 08             	mov    0x8(%rax),%eax
+  8046e1:	83 e0 03             	and    $0x3,%eax
+  8046e4:	85 c0                	test   %eax,%eax
+  8046e6:	75 4b                	jne    804733 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8046e8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8046ef:	ff ff ff 
+  8046f2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8046f6:	48 8b 00             	mov    (%rax),%rax
+  8046f9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8046ff:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804702:	89 c6                	mov    %eax,%esi
+  804704:	48 b8 98 e6 ff ff ff 	movabs $0xffffffffffffe698,%rax
+  80470b:	ff ff ff 
+  80470e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804712:	48 89 c7             	mov    %rax,%rdi
+  804715:	49 89 df             	mov    %rbx,%r15
+  804718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80471d:	48 b9 15 77 ff ff ff 	movabs $0xffffffffffff7715,%rcx
+  804724:	ff ff ff 
+  804727:	48 01 d9             	add    %rbx,%rcx
+  80472a:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80472c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804731:	eb 2a                	jmp    80475d <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  804733:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804737:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80473b:	48 85 c0             	test   %rax,%rax
+  80473e:	75 07                	jne    804747 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  804740:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804745:	eb 16                	jmp    80475d <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  804747:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80474b:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80474f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804753:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804756:	89 d6                	mov    %edx,%esi
+  804758:	48 89 c7             	mov    %rax,%rdi
+  80475b:	ff d1                	call   *%rcx
+}
+  80475d:	48 83 c4 30          	add    $0x30,%rsp
+  804761:	5b                   	pop    %rbx
+  804762:	41 5f                	pop    %r15
+  804764:	5d                   	pop    %rbp
+  804765:	c3                   	ret
+
+0000000000804766 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804766:	55                   	push   %rbp
+  804767:	48 89 e5             	mov    %rsp,%rbp
+  80476a:	53                   	push   %rbx
+  80476b:	48 83 ec 38          	sub    $0x38,%rsp
+  80476f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80476f <fstat+0x9>
+  804776:	49 bb d1 48 00 00 00 	movabs $0x48d1,%r11
+  80477d:	00 00 00 
+  804780:	4c 01 db             	add    %r11,%rbx
+  804783:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804786:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80478a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80478e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804791:	48 89 d6             	mov    %rdx,%rsi
+  804794:	89 c7                	mov    %eax,%edi
+  804796:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  80479d:	ff ff ff 
+  8047a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047a4:	ff d0                	call   *%rax
+  8047a6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047ad:	78 28                	js     8047d7 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8047af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047b3:	8b 00                	mov    (%rax),%eax
+  8047b5:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8047b9:	48 89 d6             	mov    %rdx,%rsi
+  8047bc:	89 c7                	mov    %eax,%edi
+  8047be:	48 b8 6a af ff ff ff 	movabs $0xffffffffffffaf6a,%rax
+  8047c5:	ff ff ff 
+  8047c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047cc:	ff d0                	call   *%rax
+  8047ce:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047d1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047d5:	79 05                	jns    8047dc <fstat+0x76>
+		return r;
+  8047d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047da:	eb 5e                	jmp    80483a <fstat+0xd4>
+	if (!dev->dev_stat)
+  8047dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047e0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8047e4:	48 85 c0             	test   %rax,%rax
+  8047e7:	75 07                	jne    8047f0 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8047e9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8047ee:	eb 4a                	jmp    80483a <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8047f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047f4:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8047f7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047fb:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804802:	00 00 00 
+	stat->st_isdir = 0;
+  804805:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804809:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804810:	00 00 00 
+	stat->st_dev = dev;
+  804813:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804817:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80481b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804822:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804826:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80482a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80482e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804832:	48 89 d6             	mov    %rdx,%rsi
+  804835:	48 89 c7             	mov    %rax,%rdi
+  804838:	ff d1                	call   *%rcx
+}
+  80483a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80483e:	c9                   	leave
+  80483f:	c3                   	ret
+
+0000000000804840 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804840:	55                   	push   %rbp
+  804841:	48 89 e5             	mov    %rsp,%rbp
+  804844:	41 57                	push   %r15
+  804846:	53                   	push   %rbx
+  804847:	48 83 ec 20          	sub    $0x20,%rsp
+  80484b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80484b <stat+0xb>
+  804852:	49 bb f5 47 00 00 00 	movabs $0x47f5,%r11
+  804859:	00 00 00 
+  80485c:	4c 01 db             	add    %r11,%rbx
+  80485f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804863:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804867:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80486b:	be 00 00 00 00       	mov    $0x0,%esi
+  804870:	48 89 c7             	mov    %rax,%rdi
+  804873:	49 89 df             	mov    %rbx,%r15
+  804876:	48 b8 da ba ff ff ff 	movabs $0xffffffffffffbada,%rax
+  80487d:	ff ff ff 
+  804880:	48 01 d8             	add    %rbx,%rax
+  804883:	ff d0                	call   *%rax
+  804885:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804888:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80488c:	79 05                	jns    804893 <stat+0x53>
+		return fd;
+  80488e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804891:	eb 37                	jmp    8048ca <stat+0x8a>
+	r = fstat(fd, stat);
+  804893:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804897:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80489a:	48 89 d6             	mov    %rdx,%rsi
+  80489d:	89 c7                	mov    %eax,%edi
+  80489f:	48 b8 26 b7 ff ff ff 	movabs $0xffffffffffffb726,%rax
+  8048a6:	ff ff ff 
+  8048a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048ad:	ff d0                	call   *%rax
+  8048af:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8048b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048b5:	89 c7                	mov    %eax,%edi
+  8048b7:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  8048be:	ff ff ff 
+  8048c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048c5:	ff d0                	call   *%rax
+	return r;
+  8048c7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8048ca:	48 83 c4 20          	add    $0x20,%rsp
+  8048ce:	5b                   	pop    %rbx
+  8048cf:	41 5f                	pop    %r15
+  8048d1:	5d                   	pop    %rbp
+  8048d2:	c3                   	ret
+
+00000000008048d3 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8048d3:	55                   	push   %rbp
+  8048d4:	48 89 e5             	mov    %rsp,%rbp
+  8048d7:	41 57                	push   %r15
+  8048d9:	53                   	push   %rbx
+  8048da:	48 83 ec 10          	sub    $0x10,%rsp
+  8048de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048de <fsipc+0xb>
+  8048e5:	49 bb 62 47 00 00 00 	movabs $0x4762,%r11
+  8048ec:	00 00 00 
+  8048ef:	4c 01 db             	add    %r11,%rbx
+  8048f2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8048f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8048f9:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804900:	00 00 00 
+  804903:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804906:	85 c0                	test   %eax,%eax
+  804908:	75 24                	jne    80492e <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80490a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80490f:	49 89 df             	mov    %rbx,%r15
+  804912:	48 b8 05 ac ff ff ff 	movabs $0xffffffffffffac05,%rax
+  804919:	ff ff ff 
+  80491c:	48 01 d8             	add    %rbx,%rax
+  80491f:	ff d0                	call   *%rax
+  804921:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804928:	00 00 00 
+  80492b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  80492e:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804935:	00 00 00 
+  804938:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80493b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80493f:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804942:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804948:	49 89 d0             	mov    %rdx,%r8
+  80494b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804950:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804957:	00 00 00 
+  80495a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80495e:	89 c7                	mov    %eax,%edi
+  804960:	49 89 df             	mov    %rbx,%r15
+  804963:	48 b8 24 a6 ff ff ff 	movabs $0xffffffffffffa624,%rax
+  80496a:	ff ff ff 
+  80496d:	48 01 d8             	add    %rbx,%rax
+  804970:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804972:	48 83 c4 10          	add    $0x10,%rsp
+  804976:	5b                   	pop    %rbx
+  804977:	41 5f                	pop    %r15
+  804979:	5d                   	pop    %rbp
+  80497a:	c3                   	ret
+
+000000000080497b <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  80497b:	55                   	push   %rbp
+  80497c:	48 89 e5             	mov    %rsp,%rbp
+  80497f:	41 57                	push   %r15
+  804981:	53                   	push   %rbx
+  804982:	48 83 ec 20          	sub    $0x20,%rsp
+  804986:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804986 <fsipc_words+0xb>
+  80498d:	49 bb ba 46 00 00 00 	movabs $0x46ba,%r11
+  804994:	00 00 00 
+  804997:	4c 01 db             	add    %r11,%rbx
+  80499a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80499d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8049a1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8049a5:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8049ac:	00 00 00 
+  8049af:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049b2:	85 c0                	test   %eax,%eax
+  8049b4:	75 24                	jne    8049da <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8049b6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8049bb:	49 89 df             	mov    %rbx,%r15
+  8049be:	48 b8 05 ac ff ff ff 	movabs $0xffffffffffffac05,%rax
+  8049c5:	ff ff ff 
+  8049c8:	48 01 d8             	add    %rbx,%rax
+  8049cb:	ff d0                	call   *%rax
+  8049cd:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8049d4:	00 00 00 
+  8049d7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8049da:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8049e1:	00 00 00 
+  8049e4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049e7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8049eb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8049ef:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8049f2:	89 c7                	mov    %eax,%edi
+  8049f4:	49 89 df             	mov    %rbx,%r15
+  8049f7:	48 b8 0f a7 ff ff ff 	movabs $0xffffffffffffa70f,%rax
+  8049fe:	ff ff ff 
+  804a01:	48 01 d8             	add    %rbx,%rax
+  804a04:	ff d0                	call   *%rax
+}
+  804a06:	48 83 c4 20          	add    $0x20,%rsp
+  804a0a:	5b                   	pop    %rbx
+  804a0b:	41 5f                	pop    %r15
+  804a0d:	5d                   	pop    %rbp
+  804a0e:	c3                   	ret
+
+0000000000804a0f <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804a0f:	55                   	push   %rbp
+  804a10:	48 89 e5             	mov    %rsp,%rbp
+  804a13:	41 57                	push   %r15
+  804a15:	53                   	push   %rbx
+  804a16:	48 83 ec 40          	sub    $0x40,%rsp
+  804a1a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a1a <fsipc_pages+0xb>
+  804a21:	49 bb 26 46 00 00 00 	movabs $0x4626,%r11
+  804a28:	00 00 00 
+  804a2b:	4c 01 db             	add    %r11,%rbx
+  804a2e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804a31:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804a35:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804a39:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804a3c:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804a43:	00 00 00 
+  804a46:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a49:	85 c0                	test   %eax,%eax
+  804a4b:	75 24                	jne    804a71 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804a4d:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a52:	49 89 df             	mov    %rbx,%r15
+  804a55:	48 b8 05 ac ff ff ff 	movabs $0xffffffffffffac05,%rax
+  804a5c:	ff ff ff 
+  804a5f:	48 01 d8             	add    %rbx,%rax
+  804a62:	ff d0                	call   *%rax
+  804a64:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804a6b:	00 00 00 
+  804a6e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804a71:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804a76:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804a7a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804a7d:	48 98                	cltq
+  804a7f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804a83:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804a87:	0f 95 c0             	setne  %al
+  804a8a:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804a8d:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804a94:	00 
+  804a95:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a9d:	48 01 d0             	add    %rdx,%rax
+  804aa0:	48 83 e8 01          	sub    $0x1,%rax
+  804aa4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804aa8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804aac:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ab1:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804ab5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ab9:	48 29 d0             	sub    %rdx,%rax
+  804abc:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804ac0:	41 89 c2             	mov    %eax,%r10d
+  804ac3:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804aca:	00 00 00 
+  804acd:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ad0:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804ad4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804ad8:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804adb:	48 83 ec 08          	sub    $0x8,%rsp
+  804adf:	6a 40                	push   $0x40
+  804ae1:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804ae6:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804aed:	00 
+  804aee:	6a 05                	push   $0x5
+  804af0:	41 89 f9             	mov    %edi,%r9d
+  804af3:	49 89 c8             	mov    %rcx,%r8
+  804af6:	44 89 d1             	mov    %r10d,%ecx
+  804af9:	89 c7                	mov    %eax,%edi
+  804afb:	49 89 df             	mov    %rbx,%r15
+  804afe:	48 b8 0d a8 ff ff ff 	movabs $0xffffffffffffa80d,%rax
+  804b05:	ff ff ff 
+  804b08:	48 01 d8             	add    %rbx,%rax
+  804b0b:	ff d0                	call   *%rax
+  804b0d:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804b11:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804b15:	5b                   	pop    %rbx
+  804b16:	41 5f                	pop    %r15
+  804b18:	5d                   	pop    %rbp
+  804b19:	c3                   	ret
+
+0000000000804b1a <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804b1a:	55                   	push   %rbp
+  804b1b:	48 89 e5             	mov    %rsp,%rbp
+  804b1e:	41 57                	push   %r15
+  804b20:	53                   	push   %rbx
+  804b21:	48 83 ec 20          	sub    $0x20,%rsp
+  804b25:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b25 <open+0xb>
+  804b2c:	49 bb 1b 45 00 00 00 	movabs $0x451b,%r11
+  804b33:	00 00 00 
+  804b36:	4c 01 db             	add    %r11,%rbx
+  804b39:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b3d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804b40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b44:	48 89 c7             	mov    %rax,%rdi
+  804b47:	49 89 df             	mov    %rbx,%r15
+  804b4a:	48 b8 43 84 ff ff ff 	movabs $0xffffffffffff8443,%rax
+  804b51:	ff ff ff 
+  804b54:	48 01 d8             	add    %rbx,%rax
+  804b57:	ff d0                	call   *%rax
+  804b59:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804b5e:	7e 0a                	jle    804b6a <open+0x50>
+		return -E_BAD_PATH;
+  804b60:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804b65:	e9 18 01 00 00       	jmp    804c82 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804b6a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804b6e:	48 89 c7             	mov    %rax,%rdi
+  804b71:	49 89 df             	mov    %rbx,%r15
+  804b74:	48 b8 0e ad ff ff ff 	movabs $0xffffffffffffad0e,%rax
+  804b7b:	ff ff ff 
+  804b7e:	48 01 d8             	add    %rbx,%rax
+  804b81:	ff d0                	call   *%rax
+  804b83:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b86:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b8a:	74 08                	je     804b94 <open+0x7a>
+		return r;
+  804b8c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b8f:	e9 ee 00 00 00       	jmp    804c82 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804b94:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804b9b:	00 00 00 
+  804b9e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804ba1:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804ba8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bac:	48 89 c6             	mov    %rax,%rsi
+  804baf:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804bb6:	00 00 00 
+  804bb9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804bbd:	48 89 c7             	mov    %rax,%rdi
+  804bc0:	49 89 df             	mov    %rbx,%r15
+  804bc3:	48 b8 d7 84 ff ff ff 	movabs $0xffffffffffff84d7,%rax
+  804bca:	ff ff ff 
+  804bcd:	48 01 d8             	add    %rbx,%rax
+  804bd0:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804bd2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bd6:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804bdb:	48 89 c6             	mov    %rax,%rsi
+  804bde:	bf 00 00 00 00       	mov    $0x0,%edi
+  804be3:	49 89 df             	mov    %rbx,%r15
+  804be6:	48 b8 93 91 ff ff ff 	movabs $0xffffffffffff9193,%rax
+  804bed:	ff ff ff 
+  804bf0:	48 01 d8             	add    %rbx,%rax
+  804bf3:	ff d0                	call   *%rax
+  804bf5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bf8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804bfc:	74 23                	je     804c21 <open+0x107>
+		fd_close(fd,0);
+  804bfe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c02:	be 00 00 00 00       	mov    $0x0,%esi
+  804c07:	48 89 c7             	mov    %rax,%rdi
+  804c0a:	49 89 df             	mov    %rbx,%r15
+  804c0d:	48 b8 6f ae ff ff ff 	movabs $0xffffffffffffae6f,%rax
+  804c14:	ff ff ff 
+  804c17:	48 01 d8             	add    %rbx,%rax
+  804c1a:	ff d0                	call   *%rax
+		return r;
+  804c1c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c1f:	eb 61                	jmp    804c82 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804c21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c25:	48 89 c6             	mov    %rax,%rsi
+  804c28:	bf 01 00 00 00       	mov    $0x1,%edi
+  804c2d:	48 b8 93 b8 ff ff ff 	movabs $0xffffffffffffb893,%rax
+  804c34:	ff ff ff 
+  804c37:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c3b:	ff d0                	call   *%rax
+  804c3d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c40:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c44:	74 23                	je     804c69 <open+0x14f>
+		fd_close(fd,0);
+  804c46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c4a:	be 00 00 00 00       	mov    $0x0,%esi
+  804c4f:	48 89 c7             	mov    %rax,%rdi
+  804c52:	49 89 df             	mov    %rbx,%r15
+  804c55:	48 b8 6f ae ff ff ff 	movabs $0xffffffffffffae6f,%rax
+  804c5c:	ff ff ff 
+  804c5f:	48 01 d8             	add    %rbx,%rax
+  804c62:	ff d0                	call   *%rax
+		return r;
+  804c64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c67:	eb 19                	jmp    804c82 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804c69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c6d:	48 89 c7             	mov    %rax,%rdi
+  804c70:	49 89 df             	mov    %rbx,%r15
+  804c73:	48 b8 94 ac ff ff ff 	movabs $0xffffffffffffac94,%rax
+  804c7a:	ff ff ff 
+  804c7d:	48 01 d8             	add    %rbx,%rax
+  804c80:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804c82:	48 83 c4 20          	add    $0x20,%rsp
+  804c86:	5b                   	pop    %rbx
+  804c87:	41 5f                	pop    %r15
+  804c89:	5d                   	pop    %rbp
+  804c8a:	c3                   	ret
+
+0000000000804c8b <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804c8b:	55                   	push   %rbp
+  804c8c:	48 89 e5             	mov    %rsp,%rbp
+  804c8f:	48 83 ec 20          	sub    $0x20,%rsp
+  804c93:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804c93 <devfile_flush+0x8>
+  804c9a:	49 bb ad 43 00 00 00 	movabs $0x43ad,%r11
+  804ca1:	00 00 00 
+  804ca4:	4c 01 d8             	add    %r11,%rax
+  804ca7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804cab:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804caf:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804cb2:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804cb5:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804cb9:	ba 04 00 00 00       	mov    $0x4,%edx
+  804cbe:	48 89 ce             	mov    %rcx,%rsi
+  804cc1:	bf 06 00 00 00       	mov    $0x6,%edi
+  804cc6:	48 b9 3b b9 ff ff ff 	movabs $0xffffffffffffb93b,%rcx
+  804ccd:	ff ff ff 
+  804cd0:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804cd4:	ff d0                	call   *%rax
+}
+  804cd6:	c9                   	leave
+  804cd7:	c3                   	ret
+
+0000000000804cd8 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804cd8:	55                   	push   %rbp
+  804cd9:	48 89 e5             	mov    %rsp,%rbp
+  804cdc:	41 57                	push   %r15
+  804cde:	53                   	push   %rbx
+  804cdf:	48 83 ec 60          	sub    $0x60,%rsp
+  804ce3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ce3 <devfile_read+0xb>
+  804cea:	49 bb 5d 43 00 00 00 	movabs $0x435d,%r11
+  804cf1:	00 00 00 
+  804cf4:	4c 01 db             	add    %r11,%rbx
+  804cf7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804cfb:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804cff:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804d03:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804d07:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804d0b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d0f:	8b 50 0c             	mov    0xc(%rax),%edx
+  804d12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d16:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804d18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d1c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804d20:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804d24:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804d28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d2d:	ba 10 00 00 00       	mov    $0x10,%edx
+  804d32:	48 89 c6             	mov    %rax,%rsi
+  804d35:	bf 03 00 00 00       	mov    $0x3,%edi
+  804d3a:	48 b8 cf b9 ff ff ff 	movabs $0xffffffffffffb9cf,%rax
+  804d41:	ff ff ff 
+  804d44:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d48:	ff d0                	call   *%rax
+  804d4a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804d4d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804d51:	79 05                	jns    804d58 <devfile_read+0x80>
+		return r;
+  804d53:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d56:	eb 64                	jmp    804dbc <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804d58:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d5b:	48 63 d0             	movslq %eax,%rdx
+  804d5e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804d62:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804d67:	48 01 c1             	add    %rax,%rcx
+  804d6a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804d6e:	48 89 ce             	mov    %rcx,%rsi
+  804d71:	48 89 c7             	mov    %rax,%rdi
+  804d74:	49 89 df             	mov    %rbx,%r15
+  804d77:	48 b8 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rax
+  804d7e:	ff ff ff 
+  804d81:	48 01 d8             	add    %rbx,%rax
+  804d84:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804d86:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804d8d:	ff ff ff 
+  804d90:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804d94:	48 8b 00             	mov    (%rax),%rax
+  804d97:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804d9d:	89 c6                	mov    %eax,%esi
+  804d9f:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804da4:	48 89 c7             	mov    %rax,%rdi
+  804da7:	49 89 df             	mov    %rbx,%r15
+  804daa:	48 b8 bf ab ff ff ff 	movabs $0xffffffffffffabbf,%rax
+  804db1:	ff ff ff 
+  804db4:	48 01 d8             	add    %rbx,%rax
+  804db7:	ff d0                	call   *%rax
+	return r;
+  804db9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804dbc:	48 83 c4 60          	add    $0x60,%rsp
+  804dc0:	5b                   	pop    %rbx
+  804dc1:	41 5f                	pop    %r15
+  804dc3:	5d                   	pop    %rbp
+  804dc4:	c3                   	ret
+
+0000000000804dc5 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804dc5:	55                   	push   %rbp
+  804dc6:	48 89 e5             	mov    %rsp,%rbp
+  804dc9:	41 57                	push   %r15
+  804dcb:	53                   	push   %rbx
+  804dcc:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804dd0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804dd0 <devfile_write+0xb>
+  804dd7:	49 bb 70 42 00 00 00 	movabs $0x4270,%r11
+  804dde:	00 00 00 
+  804de1:	4c 01 db             	add    %r11,%rbx
+  804de4:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804de8:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804dec:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804df3:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804df7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804dfb:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804e02:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804e06:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804e0d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e10:	48 63 d0             	movslq %eax,%rdx
+  804e13:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e17:	48 39 c2             	cmp    %rax,%rdx
+  804e1a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e1e:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804e25:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804e2c:	00 
+  804e2d:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804e34:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e38:	48 01 d0             	add    %rdx,%rax
+  804e3b:	48 83 e8 01          	sub    $0x1,%rax
+  804e3f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804e43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e47:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e4c:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804e50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e54:	48 29 d0             	sub    %rdx,%rax
+  804e57:	48 c1 e8 0c          	shr    $0xc,%rax
+  804e5b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804e5e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804e61:	89 c6                	mov    %eax,%esi
+  804e63:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804e68:	48 89 c7             	mov    %rax,%rdi
+  804e6b:	49 89 df             	mov    %rbx,%r15
+  804e6e:	48 b8 79 ab ff ff ff 	movabs $0xffffffffffffab79,%rax
+  804e75:	ff ff ff 
+  804e78:	48 01 d8             	add    %rbx,%rax
+  804e7b:	ff d0                	call   *%rax
+  804e7d:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804e80:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804e84:	79 08                	jns    804e8e <devfile_write+0xc9>
+		return r;
+  804e86:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804e89:	e9 8f 00 00 00       	jmp    804f1d <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804e8e:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804e95:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804e99:	48 89 c6             	mov    %rax,%rsi
+  804e9c:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804ea1:	48 89 c7             	mov    %rax,%rdi
+  804ea4:	49 89 df             	mov    %rbx,%r15
+  804ea7:	48 b8 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rax
+  804eae:	ff ff ff 
+  804eb1:	48 01 d8             	add    %rbx,%rax
+  804eb4:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804eb6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804eba:	8b 50 0c             	mov    0xc(%rax),%edx
+  804ebd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec1:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804ec3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec7:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804ece:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804ed2:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804ed5:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804ed9:	89 d1                	mov    %edx,%ecx
+  804edb:	ba 10 00 00 00       	mov    $0x10,%edx
+  804ee0:	48 89 c6             	mov    %rax,%rsi
+  804ee3:	bf 04 00 00 00       	mov    $0x4,%edi
+  804ee8:	48 b8 cf b9 ff ff ff 	movabs $0xffffffffffffb9cf,%rax
+  804eef:	ff ff ff 
+  804ef2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ef6:	ff d0                	call   *%rax
+  804ef8:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804efb:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804efe:	89 c6                	mov    %eax,%esi
+  804f00:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804f05:	48 89 c7             	mov    %rax,%rdi
+  804f08:	49 89 df             	mov    %rbx,%r15
+  804f0b:	48 b8 bf ab ff ff ff 	movabs $0xffffffffffffabbf,%rax
+  804f12:	ff ff ff 
+  804f15:	48 01 d8             	add    %rbx,%rax
+  804f18:	ff d0                	call   *%rax
+	return r;
+  804f1a:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804f1d:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804f21:	5b                   	pop    %rbx
+  804f22:	41 5f                	pop    %r15
+  804f24:	5d                   	pop    %rbp
+  804f25:	c3                   	ret
+
+0000000000804f26 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804f26:	55                   	push   %rbp
+  804f27:	48 89 e5             	mov    %rsp,%rbp
+  804f2a:	41 57                	push   %r15
+  804f2c:	53                   	push   %rbx
+  804f2d:	48 83 ec 20          	sub    $0x20,%rsp
+  804f31:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f31 <devfile_stat+0xb>
+  804f38:	49 bb 0f 41 00 00 00 	movabs $0x410f,%r11
+  804f3f:	00 00 00 
+  804f42:	4c 01 db             	add    %r11,%rbx
+  804f45:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804f49:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804f4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f51:	8b 40 0c             	mov    0xc(%rax),%eax
+  804f54:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804f5b:	00 00 00 
+  804f5e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804f61:	be 00 00 00 00       	mov    $0x0,%esi
+  804f66:	bf 05 00 00 00       	mov    $0x5,%edi
+  804f6b:	48 b8 93 b8 ff ff ff 	movabs $0xffffffffffffb893,%rax
+  804f72:	ff ff ff 
+  804f75:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f79:	ff d0                	call   *%rax
+  804f7b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f7e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f82:	79 05                	jns    804f89 <devfile_stat+0x63>
+		return r;
+  804f84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f87:	eb 65                	jmp    804fee <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804f89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f8d:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804f94:	00 00 00 
+  804f97:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804f9b:	48 89 d6             	mov    %rdx,%rsi
+  804f9e:	48 89 c7             	mov    %rax,%rdi
+  804fa1:	49 89 df             	mov    %rbx,%r15
+  804fa4:	48 b8 d7 84 ff ff ff 	movabs $0xffffffffffff84d7,%rax
+  804fab:	ff ff ff 
+  804fae:	48 01 d8             	add    %rbx,%rax
+  804fb1:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  804fb3:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804fba:	00 00 00 
+  804fbd:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804fc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fc8:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804fce:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804fd5:	00 00 00 
+  804fd8:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804fdf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fe3:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804fee:	48 83 c4 20          	add    $0x20,%rsp
+  804ff2:	5b                   	pop    %rbx
+  804ff3:	41 5f                	pop    %r15
+  804ff5:	5d                   	pop    %rbp
+  804ff6:	c3                   	ret
+
+0000000000804ff7 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804ff7:	55                   	push   %rbp
+  804ff8:	48 89 e5             	mov    %rsp,%rbp
+  804ffb:	48 83 ec 20          	sub    $0x20,%rsp
+  804fff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804fff <devfile_trunc+0x8>
+  805006:	49 bb 41 40 00 00 00 	movabs $0x4041,%r11
+  80500d:	00 00 00 
+  805010:	4c 01 d8             	add    %r11,%rax
+  805013:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805017:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80501a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80501e:	8b 52 0c             	mov    0xc(%rdx),%edx
+  805021:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  805024:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805027:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80502a:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80502e:	ba 08 00 00 00       	mov    $0x8,%edx
+  805033:	48 89 ce             	mov    %rcx,%rsi
+  805036:	bf 02 00 00 00       	mov    $0x2,%edi
+  80503b:	48 b9 3b b9 ff ff ff 	movabs $0xffffffffffffb93b,%rcx
+  805042:	ff ff ff 
+  805045:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805049:	ff d0                	call   *%rax
+}
+  80504b:	c9                   	leave
+  80504c:	c3                   	ret
+
+000000000080504d <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80504d:	55                   	push   %rbp
+  80504e:	48 89 e5             	mov    %rsp,%rbp
+  805051:	41 57                	push   %r15
+  805053:	53                   	push   %rbx
+  805054:	48 83 ec 10          	sub    $0x10,%rsp
+  805058:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805058 <remove+0xb>
+  80505f:	49 bb e8 3f 00 00 00 	movabs $0x3fe8,%r11
+  805066:	00 00 00 
+  805069:	4c 01 db             	add    %r11,%rbx
+  80506c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  805070:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805074:	48 89 c7             	mov    %rax,%rdi
+  805077:	49 89 df             	mov    %rbx,%r15
+  80507a:	48 b8 43 84 ff ff ff 	movabs $0xffffffffffff8443,%rax
+  805081:	ff ff ff 
+  805084:	48 01 d8             	add    %rbx,%rax
+  805087:	ff d0                	call   *%rax
+  805089:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80508e:	7e 07                	jle    805097 <remove+0x4a>
+		return -E_BAD_PATH;
+  805090:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  805095:	eb 44                	jmp    8050db <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  805097:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80509b:	48 89 c6             	mov    %rax,%rsi
+  80509e:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8050a5:	00 00 00 
+  8050a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050ac:	48 89 c7             	mov    %rax,%rdi
+  8050af:	49 89 df             	mov    %rbx,%r15
+  8050b2:	48 b8 d7 84 ff ff ff 	movabs $0xffffffffffff84d7,%rax
+  8050b9:	ff ff ff 
+  8050bc:	48 01 d8             	add    %rbx,%rax
+  8050bf:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8050c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8050c6:	bf 07 00 00 00       	mov    $0x7,%edi
+  8050cb:	48 b8 93 b8 ff ff ff 	movabs $0xffffffffffffb893,%rax
+  8050d2:	ff ff ff 
+  8050d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050d9:	ff d0                	call   *%rax
+}
+  8050db:	48 83 c4 10          	add    $0x10,%rsp
+  8050df:	5b                   	pop    %rbx
+  8050e0:	41 5f                	pop    %r15
+  8050e2:	5d                   	pop    %rbp
+  8050e3:	c3                   	ret
+
+00000000008050e4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8050e4:	55                   	push   %rbp
+  8050e5:	48 89 e5             	mov    %rsp,%rbp
+  8050e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050e8 <sync+0x4>
+  8050ef:	49 bb 58 3f 00 00 00 	movabs $0x3f58,%r11
+  8050f6:	00 00 00 
+  8050f9:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  8050fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  805101:	be 00 00 00 00       	mov    $0x0,%esi
+  805106:	bf 08 00 00 00       	mov    $0x8,%edi
+  80510b:	48 b9 3b b9 ff ff ff 	movabs $0xffffffffffffb93b,%rcx
+  805112:	ff ff ff 
+  805115:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805119:	ff d0                	call   *%rax
+}
+  80511b:	5d                   	pop    %rbp
+  80511c:	c3                   	ret
+
+000000000080511d <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80511d:	55                   	push   %rbp
+  80511e:	48 89 e5             	mov    %rsp,%rbp
+  805121:	41 57                	push   %r15
+  805123:	53                   	push   %rbx
+  805124:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80512b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80512b <copy+0xe>
+  805132:	49 bb 15 3f 00 00 00 	movabs $0x3f15,%r11
+  805139:	00 00 00 
+  80513c:	4c 01 db             	add    %r11,%rbx
+  80513f:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  805146:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  80514d:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  805154:	be 00 00 00 00       	mov    $0x0,%esi
+  805159:	48 89 c7             	mov    %rax,%rdi
+  80515c:	48 b8 da ba ff ff ff 	movabs $0xffffffffffffbada,%rax
+  805163:	ff ff ff 
+  805166:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80516a:	ff d0                	call   *%rax
+  80516c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  80516f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805173:	79 35                	jns    8051aa <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  805175:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805178:	89 c6                	mov    %eax,%esi
+  80517a:	48 b8 be e6 ff ff ff 	movabs $0xffffffffffffe6be,%rax
+  805181:	ff ff ff 
+  805184:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805188:	48 89 c7             	mov    %rax,%rdi
+  80518b:	49 89 df             	mov    %rbx,%r15
+  80518e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805193:	48 ba 15 77 ff ff ff 	movabs $0xffffffffffff7715,%rdx
+  80519a:	ff ff ff 
+  80519d:	48 01 da             	add    %rbx,%rdx
+  8051a0:	ff d2                	call   *%rdx
+		return fd_src;
+  8051a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051a5:	e9 d7 01 00 00       	jmp    805381 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8051aa:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8051b1:	be 01 01 00 00       	mov    $0x101,%esi
+  8051b6:	48 89 c7             	mov    %rax,%rdi
+  8051b9:	48 b8 da ba ff ff ff 	movabs $0xffffffffffffbada,%rax
+  8051c0:	ff ff ff 
+  8051c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051c7:	ff d0                	call   *%rax
+  8051c9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  8051cc:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8051d0:	0f 89 df 00 00 00    	jns    8052b5 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  8051d6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8051d9:	89 c6                	mov    %eax,%esi
+  8051db:	48 b8 d4 e6 ff ff ff 	movabs $0xffffffffffffe6d4,%rax
+  8051e2:	ff ff ff 
+  8051e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051e9:	48 89 c7             	mov    %rax,%rdi
+  8051ec:	49 89 df             	mov    %rbx,%r15
+  8051ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f4:	48 ba 15 77 ff ff ff 	movabs $0xffffffffffff7715,%rdx
+  8051fb:	ff ff ff 
+  8051fe:	48 01 da             	add    %rbx,%rdx
+  805201:	ff d2                	call   *%rdx
+		close(fd_src);
+  805203:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805206:	89 c7                	mov    %eax,%edi
+  805208:	49 89 df             	mov    %rbx,%r15
+  80520b:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  805212:	ff ff ff 
+  805215:	48 01 d8             	add    %rbx,%rax
+  805218:	ff d0                	call   *%rax
+		return fd_dest;
+  80521a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80521d:	e9 5f 01 00 00       	jmp    805381 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  805222:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805225:	48 63 d0             	movslq %eax,%rdx
+  805228:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80522f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805232:	48 89 ce             	mov    %rcx,%rsi
+  805235:	89 c7                	mov    %eax,%edi
+  805237:	49 89 df             	mov    %rbx,%r15
+  80523a:	48 b8 b1 b4 ff ff ff 	movabs $0xffffffffffffb4b1,%rax
+  805241:	ff ff ff 
+  805244:	48 01 d8             	add    %rbx,%rax
+  805247:	ff d0                	call   *%rax
+  805249:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  80524c:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805250:	79 63                	jns    8052b5 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  805252:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805255:	89 c6                	mov    %eax,%esi
+  805257:	48 b8 ee e6 ff ff ff 	movabs $0xffffffffffffe6ee,%rax
+  80525e:	ff ff ff 
+  805261:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805265:	48 89 c7             	mov    %rax,%rdi
+  805268:	49 89 df             	mov    %rbx,%r15
+  80526b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805270:	48 ba 15 77 ff ff ff 	movabs $0xffffffffffff7715,%rdx
+  805277:	ff ff ff 
+  80527a:	48 01 da             	add    %rbx,%rdx
+  80527d:	ff d2                	call   *%rdx
+			close(fd_src);
+  80527f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805282:	89 c7                	mov    %eax,%edi
+  805284:	49 89 df             	mov    %rbx,%r15
+  805287:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  80528e:	ff ff ff 
+  805291:	48 01 d8             	add    %rbx,%rax
+  805294:	ff d0                	call   *%rax
+			close(fd_dest);
+  805296:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805299:	89 c7                	mov    %eax,%edi
+  80529b:	49 89 df             	mov    %rbx,%r15
+  80529e:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  8052a5:	ff ff ff 
+  8052a8:	48 01 d8             	add    %rbx,%rax
+  8052ab:	ff d0                	call   *%rax
+			return write_size;
+  8052ad:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8052b0:	e9 cc 00 00 00       	jmp    805381 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  8052b5:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8052bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052bf:	ba 00 02 00 00       	mov    $0x200,%edx
+  8052c4:	48 89 ce             	mov    %rcx,%rsi
+  8052c7:	89 c7                	mov    %eax,%edi
+  8052c9:	49 89 df             	mov    %rbx,%r15
+  8052cc:	48 b8 0b b3 ff ff ff 	movabs $0xffffffffffffb30b,%rax
+  8052d3:	ff ff ff 
+  8052d6:	48 01 d8             	add    %rbx,%rax
+  8052d9:	ff d0                	call   *%rax
+  8052db:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8052de:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8052e2:	0f 8f 3a ff ff ff    	jg     805222 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  8052e8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8052ec:	79 60                	jns    80534e <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  8052ee:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8052f1:	89 c6                	mov    %eax,%esi
+  8052f3:	48 b8 01 e7 ff ff ff 	movabs $0xffffffffffffe701,%rax
+  8052fa:	ff ff ff 
+  8052fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805301:	48 89 c7             	mov    %rax,%rdi
+  805304:	49 89 df             	mov    %rbx,%r15
+  805307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80530c:	48 ba 15 77 ff ff ff 	movabs $0xffffffffffff7715,%rdx
+  805313:	ff ff ff 
+  805316:	48 01 da             	add    %rbx,%rdx
+  805319:	ff d2                	call   *%rdx
+		close(fd_src);
+  80531b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80531e:	89 c7                	mov    %eax,%edi
+  805320:	49 89 df             	mov    %rbx,%r15
+  805323:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  80532a:	ff ff ff 
+  80532d:	48 01 d8             	add    %rbx,%rax
+  805330:	ff d0                	call   *%rax
+		close(fd_dest);
+  805332:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805335:	89 c7                	mov    %eax,%edi
+  805337:	49 89 df             	mov    %rbx,%r15
+  80533a:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  805341:	ff ff ff 
+  805344:	48 01 d8             	add    %rbx,%rax
+  805347:	ff d0                	call   *%rax
+		return read_size;
+  805349:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80534c:	eb 33                	jmp    805381 <copy+0x264>
+	}
+	close(fd_src);
+  80534e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805351:	89 c7                	mov    %eax,%edi
+  805353:	49 89 df             	mov    %rbx,%r15
+  805356:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  80535d:	ff ff ff 
+  805360:	48 01 d8             	add    %rbx,%rax
+  805363:	ff d0                	call   *%rax
+	close(fd_dest);
+  805365:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805368:	89 c7                	mov    %eax,%edi
+  80536a:	49 89 df             	mov    %rbx,%r15
+  80536d:	48 b8 53 b0 ff ff ff 	movabs $0xffffffffffffb053,%rax
+  805374:	ff ff ff 
+  805377:	48 01 d8             	add    %rbx,%rax
+  80537a:	ff d0                	call   *%rax
+	return 0;
+  80537c:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  805381:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  805388:	5b                   	pop    %rbx
+  805389:	41 5f                	pop    %r15
+  80538b:	5d                   	pop    %rbp
+  80538c:	c3                   	ret
+
+000000000080538d <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  80538d:	55                   	push   %rbp
+  80538e:	48 89 e5             	mov    %rsp,%rbp
+  805391:	41 57                	push   %r15
+  805393:	53                   	push   %rbx
+  805394:	48 83 ec 20          	sub    $0x20,%rsp
+  805398:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805398 <fd2sockid+0xb>
+  80539f:	49 bb a8 3c 00 00 00 	movabs $0x3ca8,%r11
+  8053a6:	00 00 00 
+  8053a9:	4c 01 db             	add    %r11,%rbx
+  8053ac:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8053af:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8053b3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8053b6:	48 89 d6             	mov    %rdx,%rsi
+  8053b9:	89 c7                	mov    %eax,%edi
+  8053bb:	49 89 df             	mov    %rbx,%r15
+  8053be:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  8053c5:	ff ff ff 
+  8053c8:	48 01 d8             	add    %rbx,%rax
+  8053cb:	ff d0                	call   *%rax
+  8053cd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053d4:	79 05                	jns    8053db <fd2sockid+0x4e>
+		return r;
+  8053d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053d9:	eb 25                	jmp    805400 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8053db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053df:	8b 10                	mov    (%rax),%edx
+  8053e1:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  8053e8:	00 00 00 
+  8053eb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8053ee:	39 c2                	cmp    %eax,%edx
+  8053f0:	74 07                	je     8053f9 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8053f2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8053f7:	eb 07                	jmp    805400 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8053f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053fd:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  805400:	48 83 c4 20          	add    $0x20,%rsp
+  805404:	5b                   	pop    %rbx
+  805405:	41 5f                	pop    %r15
+  805407:	5d                   	pop    %rbp
+  805408:	c3                   	ret
+
+0000000000805409 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  805409:	55                   	push   %rbp
+  80540a:	48 89 e5             	mov    %rsp,%rbp
+  80540d:	41 57                	push   %r15
+  80540f:	53                   	push   %rbx
+  805410:	48 83 ec 20          	sub    $0x20,%rsp
+  805414:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805414 <alloc_sockfd+0xb>
+  80541b:	49 bb 2c 3c 00 00 00 	movabs $0x3c2c,%r11
+  805422:	00 00 00 
+  805425:	4c 01 db             	add    %r11,%rbx
+  805428:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  80542b:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80542f:	48 89 c7             	mov    %rax,%rdi
+  805432:	49 89 df             	mov    %rbx,%r15
+  805435:	48 b8 0e ad ff ff ff 	movabs $0xffffffffffffad0e,%rax
+  80543c:	ff ff ff 
+  80543f:	48 01 d8             	add    %rbx,%rax
+  805442:	ff d0                	call   *%rax
+  805444:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805447:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80544b:	78 2c                	js     805479 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80544d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805451:	ba 07 04 00 00       	mov    $0x407,%edx
+  805456:	48 89 c6             	mov    %rax,%rsi
+  805459:	bf 00 00 00 00       	mov    $0x0,%edi
+  80545e:	49 89 df             	mov    %rbx,%r15
+  805461:	48 b8 93 91 ff ff ff 	movabs $0xffffffffffff9193,%rax
+  805468:	ff ff ff 
+  80546b:	48 01 d8             	add    %rbx,%rax
+  80546e:	ff d0                	call   *%rax
+  805470:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805473:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805477:	79 1c                	jns    805495 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805479:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80547c:	89 c7                	mov    %eax,%edi
+  80547e:	49 89 df             	mov    %rbx,%r15
+  805481:	48 b8 bd cb ff ff ff 	movabs $0xffffffffffffcbbd,%rax
+  805488:	ff ff ff 
+  80548b:	48 01 d8             	add    %rbx,%rax
+  80548e:	ff d0                	call   *%rax
+		return r;
+  805490:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805493:	eb 41                	jmp    8054d6 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  805495:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805499:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  8054a0:	00 00 00 
+  8054a3:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8054a6:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8054a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054ac:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  8054b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054b7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8054ba:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8054bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054c1:	48 89 c7             	mov    %rax,%rdi
+  8054c4:	49 89 df             	mov    %rbx,%r15
+  8054c7:	48 b8 94 ac ff ff ff 	movabs $0xffffffffffffac94,%rax
+  8054ce:	ff ff ff 
+  8054d1:	48 01 d8             	add    %rbx,%rax
+  8054d4:	ff d0                	call   *%rax
+}
+  8054d6:	48 83 c4 20          	add    $0x20,%rsp
+  8054da:	5b                   	pop    %rbx
+  8054db:	41 5f                	pop    %r15
+  8054dd:	5d                   	pop    %rbp
+  8054de:	c3                   	ret
+
+00000000008054df <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8054df:	55                   	push   %rbp
+  8054e0:	48 89 e5             	mov    %rsp,%rbp
+  8054e3:	41 57                	push   %r15
+  8054e5:	53                   	push   %rbx
+  8054e6:	48 83 ec 30          	sub    $0x30,%rsp
+  8054ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054ea <accept+0xb>
+  8054f1:	49 bb 56 3b 00 00 00 	movabs $0x3b56,%r11
+  8054f8:	00 00 00 
+  8054fb:	4c 01 db             	add    %r11,%rbx
+  8054fe:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805501:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805505:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805509:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80550c:	89 c7                	mov    %eax,%edi
+  80550e:	48 b8 4d c3 ff ff ff 	movabs $0xffffffffffffc34d,%rax
+  805515:	ff ff ff 
+  805518:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80551c:	ff d0                	call   *%rax
+  80551e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805521:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805525:	79 05                	jns    80552c <accept+0x4d>
+		return r;
+  805527:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80552a:	eb 45                	jmp    805571 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80552c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805530:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805534:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805537:	48 89 ce             	mov    %rcx,%rsi
+  80553a:	89 c7                	mov    %eax,%edi
+  80553c:	49 89 df             	mov    %rbx,%r15
+  80553f:	48 b8 2b ca ff ff ff 	movabs $0xffffffffffffca2b,%rax
+  805546:	ff ff ff 
+  805549:	48 01 d8             	add    %rbx,%rax
+  80554c:	ff d0                	call   *%rax
+  80554e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805551:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805555:	79 05                	jns    80555c <accept+0x7d>
+		return r;
+  805557:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80555a:	eb 15                	jmp    805571 <accept+0x92>
+	return alloc_sockfd(r);
+  80555c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80555f:	89 c7                	mov    %eax,%edi
+  805561:	48 b8 c9 c3 ff ff ff 	movabs $0xffffffffffffc3c9,%rax
+  805568:	ff ff ff 
+  80556b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80556f:	ff d0                	call   *%rax
+}
+  805571:	48 83 c4 30          	add    $0x30,%rsp
+  805575:	5b                   	pop    %rbx
+  805576:	41 5f                	pop    %r15
+  805578:	5d                   	pop    %rbp
+  805579:	c3                   	ret
+
+000000000080557a <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80557a:	55                   	push   %rbp
+  80557b:	48 89 e5             	mov    %rsp,%rbp
+  80557e:	41 57                	push   %r15
+  805580:	53                   	push   %rbx
+  805581:	48 83 ec 20          	sub    $0x20,%rsp
+  805585:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805585 <bind+0xb>
+  80558c:	49 bb bb 3a 00 00 00 	movabs $0x3abb,%r11
+  805593:	00 00 00 
+  805596:	4c 01 db             	add    %r11,%rbx
+  805599:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80559c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8055a0:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8055a3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8055a6:	89 c7                	mov    %eax,%edi
+  8055a8:	48 b8 4d c3 ff ff ff 	movabs $0xffffffffffffc34d,%rax
+  8055af:	ff ff ff 
+  8055b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055b6:	ff d0                	call   *%rax
+  8055b8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055bf:	79 05                	jns    8055c6 <bind+0x4c>
+		return r;
+  8055c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055c4:	eb 21                	jmp    8055e7 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  8055c6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8055c9:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8055cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055d0:	48 89 ce             	mov    %rcx,%rsi
+  8055d3:	89 c7                	mov    %eax,%edi
+  8055d5:	49 89 df             	mov    %rbx,%r15
+  8055d8:	48 b8 d7 ca ff ff ff 	movabs $0xffffffffffffcad7,%rax
+  8055df:	ff ff ff 
+  8055e2:	48 01 d8             	add    %rbx,%rax
+  8055e5:	ff d0                	call   *%rax
+}
+  8055e7:	48 83 c4 20          	add    $0x20,%rsp
+  8055eb:	5b                   	pop    %rbx
+  8055ec:	41 5f                	pop    %r15
+  8055ee:	5d                   	pop    %rbp
+  8055ef:	c3                   	ret
+
+00000000008055f0 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8055f0:	55                   	push   %rbp
+  8055f1:	48 89 e5             	mov    %rsp,%rbp
+  8055f4:	41 57                	push   %r15
+  8055f6:	53                   	push   %rbx
+  8055f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8055fb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055fb <shutdown+0xb>
+  805602:	49 bb 45 3a 00 00 00 	movabs $0x3a45,%r11
+  805609:	00 00 00 
+  80560c:	4c 01 db             	add    %r11,%rbx
+  80560f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805612:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805615:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805618:	89 c7                	mov    %eax,%edi
+  80561a:	48 b8 4d c3 ff ff ff 	movabs $0xffffffffffffc34d,%rax
+  805621:	ff ff ff 
+  805624:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805628:	ff d0                	call   *%rax
+  80562a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80562d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805631:	79 05                	jns    805638 <shutdown+0x48>
+		return r;
+  805633:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805636:	eb 1c                	jmp    805654 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  805638:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80563b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80563e:	89 d6                	mov    %edx,%esi
+  805640:	89 c7                	mov    %eax,%edi
+  805642:	49 89 df             	mov    %rbx,%r15
+  805645:	48 b8 6c cb ff ff ff 	movabs $0xffffffffffffcb6c,%rax
+  80564c:	ff ff ff 
+  80564f:	48 01 d8             	add    %rbx,%rax
+  805652:	ff d0                	call   *%rax
+}
+  805654:	48 83 c4 20          	add    $0x20,%rsp
+  805658:	5b                   	pop    %rbx
+  805659:	41 5f                	pop    %r15
+  80565b:	5d                   	pop    %rbp
+  80565c:	c3                   	ret
+
+000000000080565d <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  80565d:	55                   	push   %rbp
+  80565e:	48 89 e5             	mov    %rsp,%rbp
+  805661:	41 57                	push   %r15
+  805663:	53                   	push   %rbx
+  805664:	48 83 ec 10          	sub    $0x10,%rsp
+  805668:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805668 <devsock_close+0xb>
+  80566f:	49 bb d8 39 00 00 00 	movabs $0x39d8,%r11
+  805676:	00 00 00 
+  805679:	4c 01 db             	add    %r11,%rbx
+  80567c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805680:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805684:	48 89 c7             	mov    %rax,%rdi
+  805687:	49 89 df             	mov    %rbx,%r15
+  80568a:	48 b8 85 df ff ff ff 	movabs $0xffffffffffffdf85,%rax
+  805691:	ff ff ff 
+  805694:	48 01 d8             	add    %rbx,%rax
+  805697:	ff d0                	call   *%rax
+  805699:	83 f8 01             	cmp    $0x1,%eax
+  80569c:	75 1d                	jne    8056bb <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  80569e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056a2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8056a5:	89 c7                	mov    %eax,%edi
+  8056a7:	49 89 df             	mov    %rbx,%r15
+  8056aa:	48 b8 bd cb ff ff ff 	movabs $0xffffffffffffcbbd,%rax
+  8056b1:	ff ff ff 
+  8056b4:	48 01 d8             	add    %rbx,%rax
+  8056b7:	ff d0                	call   *%rax
+  8056b9:	eb 05                	jmp    8056c0 <devsock_close+0x63>
+	else
+		return 0;
+  8056bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056c0:	48 83 c4 10          	add    $0x10,%rsp
+  8056c4:	5b                   	pop    %rbx
+  8056c5:	41 5f                	pop    %r15
+  8056c7:	5d                   	pop    %rbp
+  8056c8:	c3                   	ret
+
+00000000008056c9 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8056c9:	55                   	push   %rbp
+  8056ca:	48 89 e5             	mov    %rsp,%rbp
+  8056cd:	41 57                	push   %r15
+  8056cf:	53                   	push   %rbx
+  8056d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8056d4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056d4 <connect+0xb>
+  8056db:	49 bb 6c 39 00 00 00 	movabs $0x396c,%r11
+  8056e2:	00 00 00 
+  8056e5:	4c 01 db             	add    %r11,%rbx
+  8056e8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8056eb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8056ef:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8056f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8056f5:	89 c7                	mov    %eax,%edi
+  8056f7:	48 b8 4d c3 ff ff ff 	movabs $0xffffffffffffc34d,%rax
+  8056fe:	ff ff ff 
+  805701:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805705:	ff d0                	call   *%rax
+  805707:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80570a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80570e:	79 05                	jns    805715 <connect+0x4c>
+		return r;
+  805710:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805713:	eb 21                	jmp    805736 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  805715:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805718:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80571c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80571f:	48 89 ce             	mov    %rcx,%rsi
+  805722:	89 c7                	mov    %eax,%edi
+  805724:	49 89 df             	mov    %rbx,%r15
+  805727:	48 b8 05 cc ff ff ff 	movabs $0xffffffffffffcc05,%rax
+  80572e:	ff ff ff 
+  805731:	48 01 d8             	add    %rbx,%rax
+  805734:	ff d0                	call   *%rax
+}
+  805736:	48 83 c4 20          	add    $0x20,%rsp
+  80573a:	5b                   	pop    %rbx
+  80573b:	41 5f                	pop    %r15
+  80573d:	5d                   	pop    %rbp
+  80573e:	c3                   	ret
+
+000000000080573f <listen>:
+
+int
+listen(int s, int backlog)
+{
+  80573f:	55                   	push   %rbp
+  805740:	48 89 e5             	mov    %rsp,%rbp
+  805743:	41 57                	push   %r15
+  805745:	53                   	push   %rbx
+  805746:	48 83 ec 20          	sub    $0x20,%rsp
+  80574a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80574a <listen+0xb>
+  805751:	49 bb f6 38 00 00 00 	movabs $0x38f6,%r11
+  805758:	00 00 00 
+  80575b:	4c 01 db             	add    %r11,%rbx
+  80575e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805761:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805764:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805767:	89 c7                	mov    %eax,%edi
+  805769:	48 b8 4d c3 ff ff ff 	movabs $0xffffffffffffc34d,%rax
+  805770:	ff ff ff 
+  805773:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805777:	ff d0                	call   *%rax
+  805779:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80577c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805780:	79 05                	jns    805787 <listen+0x48>
+		return r;
+  805782:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805785:	eb 1c                	jmp    8057a3 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  805787:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80578a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80578d:	89 d6                	mov    %edx,%esi
+  80578f:	89 c7                	mov    %eax,%edi
+  805791:	49 89 df             	mov    %rbx,%r15
+  805794:	48 b8 9a cc ff ff ff 	movabs $0xffffffffffffcc9a,%rax
+  80579b:	ff ff ff 
+  80579e:	48 01 d8             	add    %rbx,%rax
+  8057a1:	ff d0                	call   *%rax
+}
+  8057a3:	48 83 c4 20          	add    $0x20,%rsp
+  8057a7:	5b                   	pop    %rbx
+  8057a8:	41 5f                	pop    %r15
+  8057aa:	5d                   	pop    %rbp
+  8057ab:	c3                   	ret
+
+00000000008057ac <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8057ac:	55                   	push   %rbp
+  8057ad:	48 89 e5             	mov    %rsp,%rbp
+  8057b0:	41 57                	push   %r15
+  8057b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8057b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8057b6 <devsock_read+0xa>
+  8057bd:	49 bb 8a 38 00 00 00 	movabs $0x388a,%r11
+  8057c4:	00 00 00 
+  8057c7:	4c 01 d8             	add    %r11,%rax
+  8057ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8057ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8057d2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8057d6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8057da:	41 89 d0             	mov    %edx,%r8d
+  8057dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8057e1:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8057e4:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8057e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8057ed:	44 89 c2             	mov    %r8d,%edx
+  8057f0:	49 89 c7             	mov    %rax,%r15
+  8057f3:	49 b8 eb cc ff ff ff 	movabs $0xffffffffffffcceb,%r8
+  8057fa:	ff ff ff 
+  8057fd:	49 01 c0             	add    %rax,%r8
+  805800:	41 ff d0             	call   *%r8
+}
+  805803:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805807:	c9                   	leave
+  805808:	c3                   	ret
+
+0000000000805809 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805809:	55                   	push   %rbp
+  80580a:	48 89 e5             	mov    %rsp,%rbp
+  80580d:	41 57                	push   %r15
+  80580f:	48 83 ec 28          	sub    $0x28,%rsp
+  805813:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805813 <devsock_write+0xa>
+  80581a:	49 bb 2d 38 00 00 00 	movabs $0x382d,%r11
+  805821:	00 00 00 
+  805824:	4c 01 d8             	add    %r11,%rax
+  805827:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80582b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80582f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805833:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805837:	41 89 d0             	mov    %edx,%r8d
+  80583a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80583e:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805841:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805845:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80584a:	44 89 c2             	mov    %r8d,%edx
+  80584d:	49 89 c7             	mov    %rax,%r15
+  805850:	49 b8 08 ce ff ff ff 	movabs $0xffffffffffffce08,%r8
+  805857:	ff ff ff 
+  80585a:	49 01 c0             	add    %rax,%r8
+  80585d:	41 ff d0             	call   *%r8
+}
+  805860:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805864:	c9                   	leave
+  805865:	c3                   	ret
+
+0000000000805866 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805866:	55                   	push   %rbp
+  805867:	48 89 e5             	mov    %rsp,%rbp
+  80586a:	41 57                	push   %r15
+  80586c:	48 83 ec 18          	sub    $0x18,%rsp
+  805870:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805870 <devsock_stat+0xa>
+  805877:	49 bb d0 37 00 00 00 	movabs $0x37d0,%r11
+  80587e:	00 00 00 
+  805881:	4c 01 d8             	add    %r11,%rax
+  805884:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805888:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  80588c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805890:	48 b9 1c e7 ff ff ff 	movabs $0xffffffffffffe71c,%rcx
+  805897:	ff ff ff 
+  80589a:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80589e:	48 89 ce             	mov    %rcx,%rsi
+  8058a1:	48 89 d7             	mov    %rdx,%rdi
+  8058a4:	49 89 c7             	mov    %rax,%r15
+  8058a7:	48 ba d7 84 ff ff ff 	movabs $0xffffffffffff84d7,%rdx
+  8058ae:	ff ff ff 
+  8058b1:	48 01 c2             	add    %rax,%rdx
+  8058b4:	ff d2                	call   *%rdx
+	return 0;
+  8058b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058bb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8058bf:	c9                   	leave
+  8058c0:	c3                   	ret
+
+00000000008058c1 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8058c1:	55                   	push   %rbp
+  8058c2:	48 89 e5             	mov    %rsp,%rbp
+  8058c5:	41 57                	push   %r15
+  8058c7:	53                   	push   %rbx
+  8058c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8058cc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058cc <socket+0xb>
+  8058d3:	49 bb 74 37 00 00 00 	movabs $0x3774,%r11
+  8058da:	00 00 00 
+  8058dd:	4c 01 db             	add    %r11,%rbx
+  8058e0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8058e3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8058e6:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8058e9:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8058ec:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8058ef:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058f2:	89 ce                	mov    %ecx,%esi
+  8058f4:	89 c7                	mov    %eax,%edi
+  8058f6:	49 89 df             	mov    %rbx,%r15
+  8058f9:	48 b8 df cf ff ff ff 	movabs $0xffffffffffffcfdf,%rax
+  805900:	ff ff ff 
+  805903:	48 01 d8             	add    %rbx,%rax
+  805906:	ff d0                	call   *%rax
+  805908:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80590b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80590f:	79 05                	jns    805916 <socket+0x55>
+		return r;
+  805911:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805914:	eb 15                	jmp    80592b <socket+0x6a>
+	return alloc_sockfd(r);
+  805916:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805919:	89 c7                	mov    %eax,%edi
+  80591b:	48 b8 c9 c3 ff ff ff 	movabs $0xffffffffffffc3c9,%rax
+  805922:	ff ff ff 
+  805925:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805929:	ff d0                	call   *%rax
+}
+  80592b:	48 83 c4 20          	add    $0x20,%rsp
+  80592f:	5b                   	pop    %rbx
+  805930:	41 5f                	pop    %r15
+  805932:	5d                   	pop    %rbp
+  805933:	c3                   	ret
+
+0000000000805934 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805934:	55                   	push   %rbp
+  805935:	48 89 e5             	mov    %rsp,%rbp
+  805938:	41 57                	push   %r15
+  80593a:	53                   	push   %rbx
+  80593b:	48 83 ec 10          	sub    $0x10,%rsp
+  80593f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80593f <nsipc+0xb>
+  805946:	49 bb 01 37 00 00 00 	movabs $0x3701,%r11
+  80594d:	00 00 00 
+  805950:	4c 01 db             	add    %r11,%rbx
+  805953:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805956:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80595d:	00 00 00 
+  805960:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805963:	85 c0                	test   %eax,%eax
+  805965:	75 24                	jne    80598b <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805967:	bf 02 00 00 00       	mov    $0x2,%edi
+  80596c:	49 89 df             	mov    %rbx,%r15
+  80596f:	48 b8 05 ac ff ff ff 	movabs $0xffffffffffffac05,%rax
+  805976:	ff ff ff 
+  805979:	48 01 d8             	add    %rbx,%rax
+  80597c:	ff d0                	call   *%rax
+  80597e:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805985:	00 00 00 
+  805988:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  80598b:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805992:	00 00 00 
+  805995:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805998:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80599b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8059a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8059a7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8059ac:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8059b3:	00 00 00 
+  8059b6:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8059ba:	89 c7                	mov    %eax,%edi
+  8059bc:	49 89 df             	mov    %rbx,%r15
+  8059bf:	48 b8 24 a6 ff ff ff 	movabs $0xffffffffffffa624,%rax
+  8059c6:	ff ff ff 
+  8059c9:	48 01 d8             	add    %rbx,%rax
+  8059cc:	ff d0                	call   *%rax
+}
+  8059ce:	48 83 c4 10          	add    $0x10,%rsp
+  8059d2:	5b                   	pop    %rbx
+  8059d3:	41 5f                	pop    %r15
+  8059d5:	5d                   	pop    %rbp
+  8059d6:	c3                   	ret
+
+00000000008059d7 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8059d7:	55                   	push   %rbp
+  8059d8:	48 89 e5             	mov    %rsp,%rbp
+  8059db:	41 57                	push   %r15
+  8059dd:	53                   	push   %rbx
+  8059de:	48 83 ec 20          	sub    $0x20,%rsp
+  8059e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059e2 <nsipc_words+0xb>
+  8059e9:	49 bb 5e 36 00 00 00 	movabs $0x365e,%r11
+  8059f0:	00 00 00 
+  8059f3:	4c 01 db             	add    %r11,%rbx
+  8059f6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8059f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8059fd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805a01:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805a08:	00 00 00 
+  805a0b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805a0e:	85 c0                	test   %eax,%eax
+  805a10:	75 24                	jne    805a36 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805a12:	bf 02 00 00 00       	mov    $0x2,%edi
+  805a17:	49 89 df             	mov    %rbx,%r15
+  805a1a:	48 b8 05 ac ff ff ff 	movabs $0xffffffffffffac05,%rax
+  805a21:	ff ff ff 
+  805a24:	48 01 d8             	add    %rbx,%rax
+  805a27:	ff d0                	call   *%rax
+  805a29:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805a30:	00 00 00 
+  805a33:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805a36:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805a3d:	00 00 00 
+  805a40:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805a43:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805a47:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a4b:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805a4e:	89 c7                	mov    %eax,%edi
+  805a50:	49 89 df             	mov    %rbx,%r15
+  805a53:	48 b8 0f a7 ff ff ff 	movabs $0xffffffffffffa70f,%rax
+  805a5a:	ff ff ff 
+  805a5d:	48 01 d8             	add    %rbx,%rax
+  805a60:	ff d0                	call   *%rax
+}
+  805a62:	48 83 c4 20          	add    $0x20,%rsp
+  805a66:	5b                   	pop    %rbx
+  805a67:	41 5f                	pop    %r15
+  805a69:	5d                   	pop    %rbp
+  805a6a:	c3                   	ret
+
+0000000000805a6b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805a6b:	55                   	push   %rbp
+  805a6c:	48 89 e5             	mov    %rsp,%rbp
+  805a6f:	41 57                	push   %r15
+  805a71:	53                   	push   %rbx
+  805a72:	48 83 ec 30          	sub    $0x30,%rsp
+  805a76:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a76 <nsipc_accept+0xb>
+  805a7d:	49 bb ca 35 00 00 00 	movabs $0x35ca,%r11
+  805a84:	00 00 00 
+  805a87:	4c 01 db             	add    %r11,%rbx
+  805a8a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805a8d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805a91:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805a95:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805a9c:	00 00 00 
+  805a9f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805aa2:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805aa5:	bf 01 00 00 00       	mov    $0x1,%edi
+  805aaa:	48 b8 f4 c8 ff ff ff 	movabs $0xffffffffffffc8f4,%rax
+  805ab1:	ff ff ff 
+  805ab4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ab8:	ff d0                	call   *%rax
+  805aba:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805abd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ac1:	78 48                	js     805b0b <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805ac3:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805aca:	00 00 00 
+  805acd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ad1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805ad5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ad9:	8b 40 10             	mov    0x10(%rax),%eax
+  805adc:	89 c2                	mov    %eax,%edx
+  805ade:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805ae2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ae6:	48 89 ce             	mov    %rcx,%rsi
+  805ae9:	48 89 c7             	mov    %rax,%rdi
+  805aec:	49 89 df             	mov    %rbx,%r15
+  805aef:	48 b8 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rax
+  805af6:	ff ff ff 
+  805af9:	48 01 d8             	add    %rbx,%rax
+  805afc:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805afe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b02:	8b 50 10             	mov    0x10(%rax),%edx
+  805b05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b09:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805b0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805b0e:	48 83 c4 30          	add    $0x30,%rsp
+  805b12:	5b                   	pop    %rbx
+  805b13:	41 5f                	pop    %r15
+  805b15:	5d                   	pop    %rbp
+  805b16:	c3                   	ret
+
+0000000000805b17 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805b17:	55                   	push   %rbp
+  805b18:	48 89 e5             	mov    %rsp,%rbp
+  805b1b:	41 57                	push   %r15
+  805b1d:	53                   	push   %rbx
+  805b1e:	48 83 ec 10          	sub    $0x10,%rsp
+  805b22:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b22 <nsipc_bind+0xb>
+  805b29:	49 bb 1e 35 00 00 00 	movabs $0x351e,%r11
+  805b30:	00 00 00 
+  805b33:	4c 01 db             	add    %r11,%rbx
+  805b36:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805b39:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805b3d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805b40:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b47:	00 00 00 
+  805b4a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b4d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805b50:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b57:	48 89 c6             	mov    %rax,%rsi
+  805b5a:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805b61:	00 00 00 
+  805b64:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b68:	48 89 c7             	mov    %rax,%rdi
+  805b6b:	49 89 df             	mov    %rbx,%r15
+  805b6e:	48 b8 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rax
+  805b75:	ff ff ff 
+  805b78:	48 01 d8             	add    %rbx,%rax
+  805b7b:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805b7d:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b84:	00 00 00 
+  805b87:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805b8a:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805b8e:	bf 02 00 00 00       	mov    $0x2,%edi
+  805b93:	48 b8 f4 c8 ff ff ff 	movabs $0xffffffffffffc8f4,%rax
+  805b9a:	ff ff ff 
+  805b9d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ba1:	ff d0                	call   *%rax
+}
+  805ba3:	48 83 c4 10          	add    $0x10,%rsp
+  805ba7:	5b                   	pop    %rbx
+  805ba8:	41 5f                	pop    %r15
+  805baa:	5d                   	pop    %rbp
+  805bab:	c3                   	ret
+
+0000000000805bac <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805bac:	55                   	push   %rbp
+  805bad:	48 89 e5             	mov    %rsp,%rbp
+  805bb0:	48 83 ec 20          	sub    $0x20,%rsp
+  805bb4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805bb4 <nsipc_shutdown+0x8>
+  805bbb:	49 bb 8c 34 00 00 00 	movabs $0x348c,%r11
+  805bc2:	00 00 00 
+  805bc5:	4c 01 d8             	add    %r11,%rax
+  805bc8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805bcb:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805bce:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805bd1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805bd4:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805bd7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805bda:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805bde:	ba 08 00 00 00       	mov    $0x8,%edx
+  805be3:	48 89 ce             	mov    %rcx,%rsi
+  805be6:	bf 03 00 00 00       	mov    $0x3,%edi
+  805beb:	48 b9 97 c9 ff ff ff 	movabs $0xffffffffffffc997,%rcx
+  805bf2:	ff ff ff 
+  805bf5:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805bf9:	ff d0                	call   *%rax
+}
+  805bfb:	c9                   	leave
+  805bfc:	c3                   	ret
+
+0000000000805bfd <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805bfd:	55                   	push   %rbp
+  805bfe:	48 89 e5             	mov    %rsp,%rbp
+  805c01:	48 83 ec 20          	sub    $0x20,%rsp
+  805c05:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805c05 <nsipc_close+0x8>
+  805c0c:	49 bb 3b 34 00 00 00 	movabs $0x343b,%r11
+  805c13:	00 00 00 
+  805c16:	4c 01 d8             	add    %r11,%rax
+  805c19:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805c1c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805c1f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805c22:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805c26:	ba 04 00 00 00       	mov    $0x4,%edx
+  805c2b:	48 89 ce             	mov    %rcx,%rsi
+  805c2e:	bf 04 00 00 00       	mov    $0x4,%edi
+  805c33:	48 b9 97 c9 ff ff ff 	movabs $0xffffffffffffc997,%rcx
+  805c3a:	ff ff ff 
+  805c3d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805c41:	ff d0                	call   *%rax
+}
+  805c43:	c9                   	leave
+  805c44:	c3                   	ret
+
+0000000000805c45 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805c45:	55                   	push   %rbp
+  805c46:	48 89 e5             	mov    %rsp,%rbp
+  805c49:	41 57                	push   %r15
+  805c4b:	53                   	push   %rbx
+  805c4c:	48 83 ec 10          	sub    $0x10,%rsp
+  805c50:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c50 <nsipc_connect+0xb>
+  805c57:	49 bb f0 33 00 00 00 	movabs $0x33f0,%r11
+  805c5e:	00 00 00 
+  805c61:	4c 01 db             	add    %r11,%rbx
+  805c64:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c67:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805c6b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805c6e:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c75:	00 00 00 
+  805c78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c7b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805c7e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805c81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c85:	48 89 c6             	mov    %rax,%rsi
+  805c88:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805c8f:	00 00 00 
+  805c92:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c96:	48 89 c7             	mov    %rax,%rdi
+  805c99:	49 89 df             	mov    %rbx,%r15
+  805c9c:	48 b8 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rax
+  805ca3:	ff ff ff 
+  805ca6:	48 01 d8             	add    %rbx,%rax
+  805ca9:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805cab:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805cb2:	00 00 00 
+  805cb5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805cb8:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805cbc:	bf 05 00 00 00       	mov    $0x5,%edi
+  805cc1:	48 b8 f4 c8 ff ff ff 	movabs $0xffffffffffffc8f4,%rax
+  805cc8:	ff ff ff 
+  805ccb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ccf:	ff d0                	call   *%rax
+}
+  805cd1:	48 83 c4 10          	add    $0x10,%rsp
+  805cd5:	5b                   	pop    %rbx
+  805cd6:	41 5f                	pop    %r15
+  805cd8:	5d                   	pop    %rbp
+  805cd9:	c3                   	ret
+
+0000000000805cda <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805cda:	55                   	push   %rbp
+  805cdb:	48 89 e5             	mov    %rsp,%rbp
+  805cde:	48 83 ec 20          	sub    $0x20,%rsp
+  805ce2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ce2 <nsipc_listen+0x8>
+  805ce9:	49 bb 5e 33 00 00 00 	movabs $0x335e,%r11
+  805cf0:	00 00 00 
+  805cf3:	4c 01 d8             	add    %r11,%rax
+  805cf6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805cf9:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805cfc:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805cff:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805d02:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d05:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805d08:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805d0c:	ba 08 00 00 00       	mov    $0x8,%edx
+  805d11:	48 89 ce             	mov    %rcx,%rsi
+  805d14:	bf 06 00 00 00       	mov    $0x6,%edi
+  805d19:	48 b9 97 c9 ff ff ff 	movabs $0xffffffffffffc997,%rcx
+  805d20:	ff ff ff 
+  805d23:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805d27:	ff d0                	call   *%rax
+}
+  805d29:	c9                   	leave
+  805d2a:	c3                   	ret
+
+0000000000805d2b <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805d2b:	55                   	push   %rbp
+  805d2c:	48 89 e5             	mov    %rsp,%rbp
+  805d2f:	41 57                	push   %r15
+  805d31:	53                   	push   %rbx
+  805d32:	48 83 ec 30          	sub    $0x30,%rsp
+  805d36:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d36 <nsipc_recv+0xb>
+  805d3d:	49 bb 0a 33 00 00 00 	movabs $0x330a,%r11
+  805d44:	00 00 00 
+  805d47:	4c 01 db             	add    %r11,%rbx
+  805d4a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805d4d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805d51:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805d54:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805d57:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805d5e:	00 00 00 
+  805d61:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d64:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805d67:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805d6e:	00 00 00 
+  805d71:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805d74:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805d78:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805d7f:	00 00 00 
+  805d82:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805d85:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805d89:	bf 07 00 00 00       	mov    $0x7,%edi
+  805d8e:	48 b8 f4 c8 ff ff ff 	movabs $0xffffffffffffc8f4,%rax
+  805d95:	ff ff ff 
+  805d98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d9c:	ff d0                	call   *%rax
+  805d9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805da1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805da5:	0f 88 91 00 00 00    	js     805e3c <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805dab:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805db2:	7f 08                	jg     805dbc <nsipc_recv+0x91>
+  805db4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805db7:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805dba:	7e 50                	jle    805e0c <nsipc_recv+0xe1>
+  805dbc:	48 b8 23 e7 ff ff ff 	movabs $0xffffffffffffe723,%rax
+  805dc3:	ff ff ff 
+  805dc6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dca:	48 89 c1             	mov    %rax,%rcx
+  805dcd:	48 b8 38 e7 ff ff ff 	movabs $0xffffffffffffe738,%rax
+  805dd4:	ff ff ff 
+  805dd7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ddb:	48 89 c2             	mov    %rax,%rdx
+  805dde:	be 79 00 00 00       	mov    $0x79,%esi
+  805de3:	48 b8 4d e7 ff ff ff 	movabs $0xffffffffffffe74d,%rax
+  805dea:	ff ff ff 
+  805ded:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805df1:	48 89 c7             	mov    %rax,%rdi
+  805df4:	49 89 df             	mov    %rbx,%r15
+  805df7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805dfc:	49 b8 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r8
+  805e03:	ff ff ff 
+  805e06:	49 01 d8             	add    %rbx,%r8
+  805e09:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805e0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e0f:	48 63 d0             	movslq %eax,%rdx
+  805e12:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e16:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805e1d:	00 00 00 
+  805e20:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805e24:	48 89 ce             	mov    %rcx,%rsi
+  805e27:	48 89 c7             	mov    %rax,%rdi
+  805e2a:	49 89 df             	mov    %rbx,%r15
+  805e2d:	48 b8 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rax
+  805e34:	ff ff ff 
+  805e37:	48 01 d8             	add    %rbx,%rax
+  805e3a:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805e3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805e3f:	48 83 c4 30          	add    $0x30,%rsp
+  805e43:	5b                   	pop    %rbx
+  805e44:	41 5f                	pop    %r15
+  805e46:	5d                   	pop    %rbp
+  805e47:	c3                   	ret
+
+0000000000805e48 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805e48:	55                   	push   %rbp
+  805e49:	48 89 e5             	mov    %rsp,%rbp
+  805e4c:	41 57                	push   %r15
+  805e4e:	53                   	push   %rbx
+  805e4f:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805e56:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e56 <nsipc_send+0xe>
+  805e5d:	49 bb ea 31 00 00 00 	movabs $0x31ea,%r11
+  805e64:	00 00 00 
+  805e67:	4c 01 db             	add    %r11,%rbx
+  805e6a:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805e70:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805e77:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805e7d:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805e83:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805e87:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805e8b:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805e92:	00 00 00 
+  805e95:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805e98:	85 c0                	test   %eax,%eax
+  805e9a:	75 24                	jne    805ec0 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805e9c:	bf 02 00 00 00       	mov    $0x2,%edi
+  805ea1:	49 89 df             	mov    %rbx,%r15
+  805ea4:	48 b8 05 ac ff ff ff 	movabs $0xffffffffffffac05,%rax
+  805eab:	ff ff ff 
+  805eae:	48 01 d8             	add    %rbx,%rax
+  805eb1:	ff d0                	call   *%rax
+  805eb3:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805eba:	00 00 00 
+  805ebd:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805ec0:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805ec6:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805ec9:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805ed0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805ed3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805ed6:	39 c2                	cmp    %eax,%edx
+  805ed8:	0f 4e c2             	cmovle %edx,%eax
+  805edb:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805ee1:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805ee7:	48 63 d0             	movslq %eax,%rdx
+  805eea:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805ef1:	48 89 c6             	mov    %rax,%rsi
+  805ef4:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805efb:	00 00 00 
+  805efe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f02:	48 89 c7             	mov    %rax,%rdi
+  805f05:	49 89 df             	mov    %rbx,%r15
+  805f08:	48 b8 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rax
+  805f0f:	ff ff ff 
+  805f12:	48 01 d8             	add    %rbx,%rax
+  805f15:	ff d0                	call   *%rax
+	req->req_s = s;
+  805f17:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f1b:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805f21:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805f23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f27:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805f2d:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805f30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f34:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805f3a:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805f3d:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805f44:	00 00 00 
+  805f47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f4b:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805f4f:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805f56:	00 
+  805f57:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805f5d:	48 63 d0             	movslq %eax,%rdx
+  805f60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f64:	48 01 d0             	add    %rdx,%rax
+  805f67:	48 83 e8 01          	sub    $0x1,%rax
+  805f6b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805f6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f73:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f78:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805f7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f80:	48 29 d0             	sub    %rdx,%rax
+  805f83:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805f89:	85 c0                	test   %eax,%eax
+  805f8b:	0f 48 c2             	cmovs  %edx,%eax
+  805f8e:	c1 f8 0c             	sar    $0xc,%eax
+  805f91:	48 98                	cltq
+  805f93:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805f97:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805f9b:	48 85 c0             	test   %rax,%rax
+  805f9e:	0f 95 c0             	setne  %al
+  805fa1:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805fa4:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  805fab:	00 
+  805fac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805fb0:	48 83 c0 0b          	add    $0xb,%rax
+  805fb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805fb8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  805fc1:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805fc5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805fc9:	48 29 d0             	sub    %rdx,%rax
+  805fcc:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805fd0:	89 c7                	mov    %eax,%edi
+  805fd2:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805fd9:	00 00 00 
+  805fdc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805fdf:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805fe3:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805fe7:	48 83 ec 08          	sub    $0x8,%rsp
+  805feb:	6a 00                	push   $0x0
+  805fed:	6a 00                	push   $0x0
+  805fef:	6a 05                	push   $0x5
+  805ff1:	41 89 f1             	mov    %esi,%r9d
+  805ff4:	49 89 c8             	mov    %rcx,%r8
+  805ff7:	89 f9                	mov    %edi,%ecx
+  805ff9:	be 08 00 00 00       	mov    $0x8,%esi
+  805ffe:	89 c7                	mov    %eax,%edi
+  806000:	49 89 df             	mov    %rbx,%r15
+  806003:	48 b8 0d a8 ff ff ff 	movabs $0xffffffffffffa80d,%rax
+  80600a:	ff ff ff 
+  80600d:	48 01 d8             	add    %rbx,%rax
+  806010:	ff d0                	call   *%rax
+  806012:	48 83 c4 20          	add    $0x20,%rsp
+}
+  806016:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80601a:	5b                   	pop    %rbx
+  80601b:	41 5f                	pop    %r15
+  80601d:	5d                   	pop    %rbp
+  80601e:	c3                   	ret
+
+000000000080601f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80601f:	55                   	push   %rbp
+  806020:	48 89 e5             	mov    %rsp,%rbp
+  806023:	48 83 ec 10          	sub    $0x10,%rsp
+  806027:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806027 <nsipc_socket+0x8>
+  80602e:	49 bb 19 30 00 00 00 	movabs $0x3019,%r11
+  806035:	00 00 00 
+  806038:	4c 01 d8             	add    %r11,%rax
+  80603b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80603e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  806041:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  806044:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80604b:	00 00 00 
+  80604e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806051:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  806054:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80605b:	00 00 00 
+  80605e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  806061:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  806065:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80606c:	00 00 00 
+  80606f:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806072:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  806076:	bf 09 00 00 00       	mov    $0x9,%edi
+  80607b:	48 ba f4 c8 ff ff ff 	movabs $0xffffffffffffc8f4,%rdx
+  806082:	ff ff ff 
+  806085:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806089:	ff d0                	call   *%rax
+}
+  80608b:	c9                   	leave
+  80608c:	c3                   	ret
+
+000000000080608d <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  80608d:	55                   	push   %rbp
+  80608e:	48 89 e5             	mov    %rsp,%rbp
+  806091:	41 57                	push   %r15
+  806093:	53                   	push   %rbx
+  806094:	48 83 ec 30          	sub    $0x30,%rsp
+  806098:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806098 <pipe+0xb>
+  80609f:	49 bb a8 2f 00 00 00 	movabs $0x2fa8,%r11
+  8060a6:	00 00 00 
+  8060a9:	4c 01 db             	add    %r11,%rbx
+  8060ac:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8060b0:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8060b4:	48 89 c7             	mov    %rax,%rdi
+  8060b7:	49 89 df             	mov    %rbx,%r15
+  8060ba:	48 b8 0e ad ff ff ff 	movabs $0xffffffffffffad0e,%rax
+  8060c1:	ff ff ff 
+  8060c4:	48 01 d8             	add    %rbx,%rax
+  8060c7:	ff d0                	call   *%rax
+  8060c9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8060cc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060d0:	0f 88 12 02 00 00    	js     8062e8 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8060d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060da:	ba 07 04 00 00       	mov    $0x407,%edx
+  8060df:	48 89 c6             	mov    %rax,%rsi
+  8060e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060e7:	49 89 df             	mov    %rbx,%r15
+  8060ea:	48 b8 93 91 ff ff ff 	movabs $0xffffffffffff9193,%rax
+  8060f1:	ff ff ff 
+  8060f4:	48 01 d8             	add    %rbx,%rax
+  8060f7:	ff d0                	call   *%rax
+  8060f9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8060fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806100:	0f 88 e2 01 00 00    	js     8062e8 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  806106:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80610a:	48 89 c7             	mov    %rax,%rdi
+  80610d:	49 89 df             	mov    %rbx,%r15
+  806110:	48 b8 0e ad ff ff ff 	movabs $0xffffffffffffad0e,%rax
+  806117:	ff ff ff 
+  80611a:	48 01 d8             	add    %rbx,%rax
+  80611d:	ff d0                	call   *%rax
+  80611f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806122:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806126:	0f 88 9b 01 00 00    	js     8062c7 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80612c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806130:	ba 07 04 00 00       	mov    $0x407,%edx
+  806135:	48 89 c6             	mov    %rax,%rsi
+  806138:	bf 00 00 00 00       	mov    $0x0,%edi
+  80613d:	49 89 df             	mov    %rbx,%r15
+  806140:	48 b8 93 91 ff ff ff 	movabs $0xffffffffffff9193,%rax
+  806147:	ff ff ff 
+  80614a:	48 01 d8             	add    %rbx,%rax
+  80614d:	ff d0                	call   *%rax
+  80614f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806152:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806156:	0f 88 6b 01 00 00    	js     8062c7 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  80615c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806160:	48 89 c7             	mov    %rax,%rdi
+  806163:	49 89 df             	mov    %rbx,%r15
+  806166:	48 b8 cb ac ff ff ff 	movabs $0xffffffffffffaccb,%rax
+  80616d:	ff ff ff 
+  806170:	48 01 d8             	add    %rbx,%rax
+  806173:	ff d0                	call   *%rax
+  806175:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806179:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80617d:	ba 07 04 00 00       	mov    $0x407,%edx
+  806182:	48 89 c6             	mov    %rax,%rsi
+  806185:	bf 00 00 00 00       	mov    $0x0,%edi
+  80618a:	49 89 df             	mov    %rbx,%r15
+  80618d:	48 b8 93 91 ff ff ff 	movabs $0xffffffffffff9193,%rax
+  806194:	ff ff ff 
+  806197:	48 01 d8             	add    %rbx,%rax
+  80619a:	ff d0                	call   *%rax
+  80619c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80619f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061a3:	0f 88 fd 00 00 00    	js     8062a6 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8061a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8061ad:	48 89 c7             	mov    %rax,%rdi
+  8061b0:	49 89 df             	mov    %rbx,%r15
+  8061b3:	48 b8 cb ac ff ff ff 	movabs $0xffffffffffffaccb,%rax
+  8061ba:	ff ff ff 
+  8061bd:	48 01 d8             	add    %rbx,%rax
+  8061c0:	ff d0                	call   *%rax
+  8061c2:	48 89 c2             	mov    %rax,%rdx
+  8061c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061c9:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8061cf:	48 89 d1             	mov    %rdx,%rcx
+  8061d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8061d7:	48 89 c6             	mov    %rax,%rsi
+  8061da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061df:	49 89 df             	mov    %rbx,%r15
+  8061e2:	48 b8 f8 91 ff ff ff 	movabs $0xffffffffffff91f8,%rax
+  8061e9:	ff ff ff 
+  8061ec:	48 01 d8             	add    %rbx,%rax
+  8061ef:	ff d0                	call   *%rax
+  8061f1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061f4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061f8:	0f 88 87 00 00 00    	js     806285 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8061fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806202:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806209:	00 00 00 
+  80620c:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80620f:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  806211:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806215:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  80621c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806220:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806227:	00 00 00 
+  80622a:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80622d:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  80622f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806233:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  80623a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80623e:	48 89 c7             	mov    %rax,%rdi
+  806241:	49 89 df             	mov    %rbx,%r15
+  806244:	48 b8 94 ac ff ff ff 	movabs $0xffffffffffffac94,%rax
+  80624b:	ff ff ff 
+  80624e:	48 01 d8             	add    %rbx,%rax
+  806251:	ff d0                	call   *%rax
+  806253:	89 c2                	mov    %eax,%edx
+  806255:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806259:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  80625b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80625f:	48 89 c7             	mov    %rax,%rdi
+  806262:	49 89 df             	mov    %rbx,%r15
+  806265:	48 b8 94 ac ff ff ff 	movabs $0xffffffffffffac94,%rax
+  80626c:	ff ff ff 
+  80626f:	48 01 d8             	add    %rbx,%rax
+  806272:	ff d0                	call   *%rax
+  806274:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806278:	48 83 c2 04          	add    $0x4,%rdx
+  80627c:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  80627e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806283:	eb 67                	jmp    8062ec <pipe+0x25f>
+		goto err3;
+  806285:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  806286:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80628a:	48 89 c6             	mov    %rax,%rsi
+  80628d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806292:	49 89 df             	mov    %rbx,%r15
+  806295:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  80629c:	ff ff ff 
+  80629f:	48 01 d8             	add    %rbx,%rax
+  8062a2:	ff d0                	call   *%rax
+  8062a4:	eb 01                	jmp    8062a7 <pipe+0x21a>
+		goto err2;
+  8062a6:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  8062a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062ab:	48 89 c6             	mov    %rax,%rsi
+  8062ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8062b3:	49 89 df             	mov    %rbx,%r15
+  8062b6:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  8062bd:	ff ff ff 
+  8062c0:	48 01 d8             	add    %rbx,%rax
+  8062c3:	ff d0                	call   *%rax
+  8062c5:	eb 01                	jmp    8062c8 <pipe+0x23b>
+		goto err1;
+  8062c7:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8062c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062cc:	48 89 c6             	mov    %rax,%rsi
+  8062cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8062d4:	49 89 df             	mov    %rbx,%r15
+  8062d7:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  8062de:	ff ff ff 
+  8062e1:	48 01 d8             	add    %rbx,%rax
+  8062e4:	ff d0                	call   *%rax
+  8062e6:	eb 01                	jmp    8062e9 <pipe+0x25c>
+		goto err;
+  8062e8:	90                   	nop
+err:
+	return r;
+  8062e9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8062ec:	48 83 c4 30          	add    $0x30,%rsp
+  8062f0:	5b                   	pop    %rbx
+  8062f1:	41 5f                	pop    %r15
+  8062f3:	5d                   	pop    %rbp
+  8062f4:	c3                   	ret
+
+00000000008062f5 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8062f5:	55                   	push   %rbp
+  8062f6:	48 89 e5             	mov    %rsp,%rbp
+  8062f9:	41 57                	push   %r15
+  8062fb:	41 54                	push   %r12
+  8062fd:	53                   	push   %rbx
+  8062fe:	48 83 ec 28          	sub    $0x28,%rsp
+  806302:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806302 <_pipeisclosed+0xd>
+  806309:	49 bb 3e 2d 00 00 00 	movabs $0x2d3e,%r11
+  806310:	00 00 00 
+  806313:	4c 01 db             	add    %r11,%rbx
+  806316:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80631a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80631e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806325:	ff ff ff 
+  806328:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80632c:	48 8b 00             	mov    (%rax),%rax
+  80632f:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806335:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  806338:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80633c:	48 89 c7             	mov    %rax,%rdi
+  80633f:	49 89 df             	mov    %rbx,%r15
+  806342:	48 b8 85 df ff ff ff 	movabs $0xffffffffffffdf85,%rax
+  806349:	ff ff ff 
+  80634c:	48 01 d8             	add    %rbx,%rax
+  80634f:	ff d0                	call   *%rax
+  806351:	41 89 c4             	mov    %eax,%r12d
+  806354:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806358:	48 89 c7             	mov    %rax,%rdi
+  80635b:	49 89 df             	mov    %rbx,%r15
+  80635e:	48 b8 85 df ff ff ff 	movabs $0xffffffffffffdf85,%rax
+  806365:	ff ff ff 
+  806368:	48 01 d8             	add    %rbx,%rax
+  80636b:	ff d0                	call   *%rax
+  80636d:	41 39 c4             	cmp    %eax,%r12d
+  806370:	0f 94 c0             	sete   %al
+  806373:	0f b6 c0             	movzbl %al,%eax
+  806376:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806379:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806380:	ff ff ff 
+  806383:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806387:	48 8b 00             	mov    (%rax),%rax
+  80638a:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806390:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  806393:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806396:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806399:	75 05                	jne    8063a0 <_pipeisclosed+0xab>
+			return ret;
+  80639b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80639e:	eb 63                	jmp    806403 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  8063a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8063a3:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8063a6:	0f 84 72 ff ff ff    	je     80631e <_pipeisclosed+0x29>
+  8063ac:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  8063b0:	0f 85 68 ff ff ff    	jne    80631e <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8063b6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8063bd:	ff ff ff 
+  8063c0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8063c4:	48 8b 00             	mov    (%rax),%rax
+  8063c7:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8063cd:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8063d0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8063d3:	89 c6                	mov    %eax,%esi
+  8063d5:	48 b8 5e e7 ff ff ff 	movabs $0xffffffffffffe75e,%rax
+  8063dc:	ff ff ff 
+  8063df:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8063e3:	48 89 c7             	mov    %rax,%rdi
+  8063e6:	49 89 df             	mov    %rbx,%r15
+  8063e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063ee:	49 b8 15 77 ff ff ff 	movabs $0xffffffffffff7715,%r8
+  8063f5:	ff ff ff 
+  8063f8:	49 01 d8             	add    %rbx,%r8
+  8063fb:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8063fe:	e9 1b ff ff ff       	jmp    80631e <_pipeisclosed+0x29>
+	}
+}
+  806403:	48 83 c4 28          	add    $0x28,%rsp
+  806407:	5b                   	pop    %rbx
+  806408:	41 5c                	pop    %r12
+  80640a:	41 5f                	pop    %r15
+  80640c:	5d                   	pop    %rbp
+  80640d:	c3                   	ret
+
+000000000080640e <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  80640e:	55                   	push   %rbp
+  80640f:	48 89 e5             	mov    %rsp,%rbp
+  806412:	41 57                	push   %r15
+  806414:	53                   	push   %rbx
+  806415:	48 83 ec 30          	sub    $0x30,%rsp
+  806419:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806419 <pipeisclosed+0xb>
+  806420:	49 bb 27 2c 00 00 00 	movabs $0x2c27,%r11
+  806427:	00 00 00 
+  80642a:	4c 01 db             	add    %r11,%rbx
+  80642d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806430:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  806434:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806437:	48 89 d6             	mov    %rdx,%rsi
+  80643a:	89 c7                	mov    %eax,%edi
+  80643c:	49 89 df             	mov    %rbx,%r15
+  80643f:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  806446:	ff ff ff 
+  806449:	48 01 d8             	add    %rbx,%rax
+  80644c:	ff d0                	call   *%rax
+  80644e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806451:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806455:	79 05                	jns    80645c <pipeisclosed+0x4e>
+		return r;
+  806457:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80645a:	eb 3b                	jmp    806497 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  80645c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806460:	48 89 c7             	mov    %rax,%rdi
+  806463:	49 89 df             	mov    %rbx,%r15
+  806466:	48 b8 cb ac ff ff ff 	movabs $0xffffffffffffaccb,%rax
+  80646d:	ff ff ff 
+  806470:	48 01 d8             	add    %rbx,%rax
+  806473:	ff d0                	call   *%rax
+  806475:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806479:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80647d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806481:	48 89 d6             	mov    %rdx,%rsi
+  806484:	48 89 c7             	mov    %rax,%rdi
+  806487:	48 b8 b5 d2 ff ff ff 	movabs $0xffffffffffffd2b5,%rax
+  80648e:	ff ff ff 
+  806491:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806495:	ff d0                	call   *%rax
+}
+  806497:	48 83 c4 30          	add    $0x30,%rsp
+  80649b:	5b                   	pop    %rbx
+  80649c:	41 5f                	pop    %r15
+  80649e:	5d                   	pop    %rbp
+  80649f:	c3                   	ret
+
+00000000008064a0 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8064a0:	55                   	push   %rbp
+  8064a1:	48 89 e5             	mov    %rsp,%rbp
+  8064a4:	41 57                	push   %r15
+  8064a6:	53                   	push   %rbx
+  8064a7:	48 83 ec 40          	sub    $0x40,%rsp
+  8064ab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064ab <devpipe_read+0xb>
+  8064b2:	49 bb 95 2b 00 00 00 	movabs $0x2b95,%r11
+  8064b9:	00 00 00 
+  8064bc:	4c 01 db             	add    %r11,%rbx
+  8064bf:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8064c3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8064c7:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8064cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8064cf:	48 89 c7             	mov    %rax,%rdi
+  8064d2:	49 89 df             	mov    %rbx,%r15
+  8064d5:	48 b8 cb ac ff ff ff 	movabs $0xffffffffffffaccb,%rax
+  8064dc:	ff ff ff 
+  8064df:	48 01 d8             	add    %rbx,%rax
+  8064e2:	ff d0                	call   *%rax
+  8064e4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8064e8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8064ec:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8064f0:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8064f7:	00 
+  8064f8:	e9 a1 00 00 00       	jmp    80659e <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8064fd:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806502:	74 09                	je     80650d <devpipe_read+0x6d>
+				return i;
+  806504:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806508:	e9 9f 00 00 00       	jmp    8065ac <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  80650d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806511:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806515:	48 89 d6             	mov    %rdx,%rsi
+  806518:	48 89 c7             	mov    %rax,%rdi
+  80651b:	48 b8 b5 d2 ff ff ff 	movabs $0xffffffffffffd2b5,%rax
+  806522:	ff ff ff 
+  806525:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806529:	ff d0                	call   *%rax
+  80652b:	85 c0                	test   %eax,%eax
+  80652d:	74 07                	je     806536 <devpipe_read+0x96>
+				return 0;
+  80652f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806534:	eb 76                	jmp    8065ac <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  806536:	49 89 df             	mov    %rbx,%r15
+  806539:	48 b8 3e 91 ff ff ff 	movabs $0xffffffffffff913e,%rax
+  806540:	ff ff ff 
+  806543:	48 01 d8             	add    %rbx,%rax
+  806546:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  806548:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80654c:	8b 10                	mov    (%rax),%edx
+  80654e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806552:	8b 40 04             	mov    0x4(%rax),%eax
+  806555:	39 c2                	cmp    %eax,%edx
+  806557:	74 a4                	je     8064fd <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  806559:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80655d:	8b 10                	mov    (%rax),%edx
+  80655f:	89 d0                	mov    %edx,%eax
+  806561:	c1 f8 1f             	sar    $0x1f,%eax
+  806564:	c1 e8 1b             	shr    $0x1b,%eax
+  806567:	01 c2                	add    %eax,%edx
+  806569:	83 e2 1f             	and    $0x1f,%edx
+  80656c:	29 c2                	sub    %eax,%edx
+  80656e:	89 d6                	mov    %edx,%esi
+  806570:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806574:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806578:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80657c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806580:	48 63 c6             	movslq %esi,%rax
+  806583:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806588:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  80658a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80658e:	8b 00                	mov    (%rax),%eax
+  806590:	8d 50 01             	lea    0x1(%rax),%edx
+  806593:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806597:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806599:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80659e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065a2:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8065a6:	72 a0                	jb     806548 <devpipe_read+0xa8>
+	}
+	return i;
+  8065a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8065ac:	48 83 c4 40          	add    $0x40,%rsp
+  8065b0:	5b                   	pop    %rbx
+  8065b1:	41 5f                	pop    %r15
+  8065b3:	5d                   	pop    %rbp
+  8065b4:	c3                   	ret
+
+00000000008065b5 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8065b5:	55                   	push   %rbp
+  8065b6:	48 89 e5             	mov    %rsp,%rbp
+  8065b9:	41 57                	push   %r15
+  8065bb:	53                   	push   %rbx
+  8065bc:	48 83 ec 40          	sub    $0x40,%rsp
+  8065c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065c0 <devpipe_write+0xb>
+  8065c7:	49 bb 80 2a 00 00 00 	movabs $0x2a80,%r11
+  8065ce:	00 00 00 
+  8065d1:	4c 01 db             	add    %r11,%rbx
+  8065d4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8065d8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8065dc:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8065e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8065e4:	48 89 c7             	mov    %rax,%rdi
+  8065e7:	49 89 df             	mov    %rbx,%r15
+  8065ea:	48 b8 cb ac ff ff ff 	movabs $0xffffffffffffaccb,%rax
+  8065f1:	ff ff ff 
+  8065f4:	48 01 d8             	add    %rbx,%rax
+  8065f7:	ff d0                	call   *%rax
+  8065f9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8065fd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806601:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806605:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80660c:	00 
+  80660d:	e9 a0 00 00 00       	jmp    8066b2 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  806612:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806616:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80661a:	48 89 d6             	mov    %rdx,%rsi
+  80661d:	48 89 c7             	mov    %rax,%rdi
+  806620:	48 b8 b5 d2 ff ff ff 	movabs $0xffffffffffffd2b5,%rax
+  806627:	ff ff ff 
+  80662a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80662e:	ff d0                	call   *%rax
+  806630:	85 c0                	test   %eax,%eax
+  806632:	74 0a                	je     80663e <devpipe_write+0x89>
+				return 0;
+  806634:	b8 00 00 00 00       	mov    $0x0,%eax
+  806639:	e9 82 00 00 00       	jmp    8066c0 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  80663e:	49 89 df             	mov    %rbx,%r15
+  806641:	48 b8 3e 91 ff ff ff 	movabs $0xffffffffffff913e,%rax
+  806648:	ff ff ff 
+  80664b:	48 01 d8             	add    %rbx,%rax
+  80664e:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  806650:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806654:	8b 40 04             	mov    0x4(%rax),%eax
+  806657:	48 63 d0             	movslq %eax,%rdx
+  80665a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80665e:	8b 00                	mov    (%rax),%eax
+  806660:	48 98                	cltq
+  806662:	48 83 c0 20          	add    $0x20,%rax
+  806666:	48 39 c2             	cmp    %rax,%rdx
+  806669:	73 a7                	jae    806612 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80666b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80666f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806673:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806677:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80667b:	8b 50 04             	mov    0x4(%rax),%edx
+  80667e:	89 d0                	mov    %edx,%eax
+  806680:	c1 f8 1f             	sar    $0x1f,%eax
+  806683:	c1 e8 1b             	shr    $0x1b,%eax
+  806686:	01 c2                	add    %eax,%edx
+  806688:	83 e2 1f             	and    $0x1f,%edx
+  80668b:	29 c2                	sub    %eax,%edx
+  80668d:	89 d0                	mov    %edx,%eax
+  80668f:	0f b6 09             	movzbl (%rcx),%ecx
+  806692:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806696:	48 98                	cltq
+  806698:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  80669c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066a0:	8b 40 04             	mov    0x4(%rax),%eax
+  8066a3:	8d 50 01             	lea    0x1(%rax),%edx
+  8066a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066aa:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8066ad:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8066b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066b6:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8066ba:	72 94                	jb     806650 <devpipe_write+0x9b>
+	}
+
+	return i;
+  8066bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8066c0:	48 83 c4 40          	add    $0x40,%rsp
+  8066c4:	5b                   	pop    %rbx
+  8066c5:	41 5f                	pop    %r15
+  8066c7:	5d                   	pop    %rbp
+  8066c8:	c3                   	ret
+
+00000000008066c9 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8066c9:	55                   	push   %rbp
+  8066ca:	48 89 e5             	mov    %rsp,%rbp
+  8066cd:	41 57                	push   %r15
+  8066cf:	53                   	push   %rbx
+  8066d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8066d4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8066d4 <devpipe_stat+0xb>
+  8066db:	49 bb 6c 29 00 00 00 	movabs $0x296c,%r11
+  8066e2:	00 00 00 
+  8066e5:	4c 01 db             	add    %r11,%rbx
+  8066e8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8066ec:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8066f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8066f4:	48 89 c7             	mov    %rax,%rdi
+  8066f7:	49 89 df             	mov    %rbx,%r15
+  8066fa:	48 b8 cb ac ff ff ff 	movabs $0xffffffffffffaccb,%rax
+  806701:	ff ff ff 
+  806704:	48 01 d8             	add    %rbx,%rax
+  806707:	ff d0                	call   *%rax
+  806709:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  80670d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806711:	48 ba 71 e7 ff ff ff 	movabs $0xffffffffffffe771,%rdx
+  806718:	ff ff ff 
+  80671b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80671f:	48 89 d6             	mov    %rdx,%rsi
+  806722:	48 89 c7             	mov    %rax,%rdi
+  806725:	49 89 df             	mov    %rbx,%r15
+  806728:	48 b8 d7 84 ff ff ff 	movabs $0xffffffffffff84d7,%rax
+  80672f:	ff ff ff 
+  806732:	48 01 d8             	add    %rbx,%rax
+  806735:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  806737:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80673b:	8b 50 04             	mov    0x4(%rax),%edx
+  80673e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806742:	8b 00                	mov    (%rax),%eax
+  806744:	29 c2                	sub    %eax,%edx
+  806746:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80674a:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  806750:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806754:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80675b:	00 00 00 
+	stat->st_dev = &devpipe;
+  80675e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806762:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806769:	00 00 00 
+  80676c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806770:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  806777:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80677c:	48 83 c4 20          	add    $0x20,%rsp
+  806780:	5b                   	pop    %rbx
+  806781:	41 5f                	pop    %r15
+  806783:	5d                   	pop    %rbp
+  806784:	c3                   	ret
+
+0000000000806785 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  806785:	55                   	push   %rbp
+  806786:	48 89 e5             	mov    %rsp,%rbp
+  806789:	41 57                	push   %r15
+  80678b:	53                   	push   %rbx
+  80678c:	48 83 ec 10          	sub    $0x10,%rsp
+  806790:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806790 <devpipe_close+0xb>
+  806797:	49 bb b0 28 00 00 00 	movabs $0x28b0,%r11
+  80679e:	00 00 00 
+  8067a1:	4c 01 db             	add    %r11,%rbx
+  8067a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8067a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8067ac:	48 89 c6             	mov    %rax,%rsi
+  8067af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8067b4:	49 89 df             	mov    %rbx,%r15
+  8067b7:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  8067be:	ff ff ff 
+  8067c1:	48 01 d8             	add    %rbx,%rax
+  8067c4:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8067c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8067ca:	48 89 c7             	mov    %rax,%rdi
+  8067cd:	49 89 df             	mov    %rbx,%r15
+  8067d0:	48 b8 cb ac ff ff ff 	movabs $0xffffffffffffaccb,%rax
+  8067d7:	ff ff ff 
+  8067da:	48 01 d8             	add    %rbx,%rax
+  8067dd:	ff d0                	call   *%rax
+  8067df:	48 89 c6             	mov    %rax,%rsi
+  8067e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8067e7:	49 89 df             	mov    %rbx,%r15
+  8067ea:	48 b8 6b 92 ff ff ff 	movabs $0xffffffffffff926b,%rax
+  8067f1:	ff ff ff 
+  8067f4:	48 01 d8             	add    %rbx,%rax
+  8067f7:	ff d0                	call   *%rax
+}
+  8067f9:	48 83 c4 10          	add    $0x10,%rsp
+  8067fd:	5b                   	pop    %rbx
+  8067fe:	41 5f                	pop    %r15
+  806800:	5d                   	pop    %rbp
+  806801:	c3                   	ret
+
+0000000000806802 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  806802:	55                   	push   %rbp
+  806803:	48 89 e5             	mov    %rsp,%rbp
+  806806:	41 57                	push   %r15
+  806808:	53                   	push   %rbx
+  806809:	48 83 ec 20          	sub    $0x20,%rsp
+  80680d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80680d <wait+0xb>
+  806814:	49 bb 33 28 00 00 00 	movabs $0x2833,%r11
+  80681b:	00 00 00 
+  80681e:	4c 01 db             	add    %r11,%rbx
+  806821:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  806824:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806828:	75 50                	jne    80687a <wait+0x78>
+  80682a:	48 b8 78 e7 ff ff ff 	movabs $0xffffffffffffe778,%rax
+  806831:	ff ff ff 
+  806834:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806838:	48 89 c1             	mov    %rax,%rcx
+  80683b:	48 b8 83 e7 ff ff ff 	movabs $0xffffffffffffe783,%rax
+  806842:	ff ff ff 
+  806845:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806849:	48 89 c2             	mov    %rax,%rdx
+  80684c:	be 09 00 00 00       	mov    $0x9,%esi
+  806851:	48 b8 98 e7 ff ff ff 	movabs $0xffffffffffffe798,%rax
+  806858:	ff ff ff 
+  80685b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80685f:	48 89 c7             	mov    %rax,%rdi
+  806862:	49 89 df             	mov    %rbx,%r15
+  806865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80686a:	49 b8 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r8
+  806871:	ff ff ff 
+  806874:	49 01 d8             	add    %rbx,%r8
+  806877:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  80687a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80687d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806882:	48 98                	cltq
+  806884:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80688b:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806892:	ff ff ff 
+  806895:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806899:	48 01 d0             	add    %rdx,%rax
+  80689c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8068a0:	eb 12                	jmp    8068b4 <wait+0xb2>
+		sys_yield();
+  8068a2:	49 89 df             	mov    %rbx,%r15
+  8068a5:	48 b8 3e 91 ff ff ff 	movabs $0xffffffffffff913e,%rax
+  8068ac:	ff ff ff 
+  8068af:	48 01 d8             	add    %rbx,%rax
+  8068b2:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8068b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8068b8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8068be:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8068c1:	75 0e                	jne    8068d1 <wait+0xcf>
+  8068c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8068c7:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8068cd:	85 c0                	test   %eax,%eax
+  8068cf:	75 d1                	jne    8068a2 <wait+0xa0>
+}
+  8068d1:	90                   	nop
+  8068d2:	48 83 c4 20          	add    $0x20,%rsp
+  8068d6:	5b                   	pop    %rbx
+  8068d7:	41 5f                	pop    %r15
+  8068d9:	5d                   	pop    %rbp
+  8068da:	c3                   	ret
+
+00000000008068db <bench_workers>:
+
+// Runs fn(id) in 'n' forked workers, worker id pinned to CPU id where
+// there is one, and returns the milliseconds until all have finished.
+unsigned
+bench_workers(int n, void (*fn)(int id))
+{
+  8068db:	55                   	push   %rbp
+  8068dc:	48 89 e5             	mov    %rsp,%rbp
+  8068df:	41 57                	push   %r15
+  8068e1:	53                   	push   %rbx
+  8068e2:	48 83 ec 20          	sub    $0x20,%rsp
+  8068e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068e6 <bench_workers+0xb>
+  8068ed:	49 bb 5a 27 00 00 00 	movabs $0x275a,%r11
+  8068f4:	00 00 00 
+  8068f7:	4c 01 db             	add    %r11,%rbx
+  8068fa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8068fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	envid_t parent = sys_getenvid();
+  806901:	49 89 df             	mov    %rbx,%r15
+  806904:	48 b8 ea 90 ff ff ff 	movabs $0xffffffffffff90ea,%rax
+  80690b:	ff ff ff 
+  80690e:	48 01 d8             	add    %rbx,%rax
+  806911:	ff d0                	call   *%rax
+  806913:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	unsigned start;
+	int i, r;
+
+	start = sys_time_msec();
+  806916:	49 89 df             	mov    %rbx,%r15
+  806919:	48 b8 ba 96 ff ff ff 	movabs $0xffffffffffff96ba,%rax
+  806920:	ff ff ff 
+  806923:	48 01 d8             	add    %rbx,%rax
+  806926:	ff d0                	call   *%rax
+  806928:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	for (i = 0; i < n; i++) {
+  80692b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806932:	e9 d1 00 00 00       	jmp    806a08 <bench_workers+0x12d>
+		if ((r = fork()) < 0)
+  806937:	49 89 df             	mov    %rbx,%r15
+  80693a:	48 b8 22 a1 ff ff ff 	movabs $0xffffffffffffa122,%rax
+  806941:	ff ff ff 
+  806944:	48 01 d8             	add    %rbx,%rax
+  806947:	ff d0                	call   *%rax
+  806949:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  80694c:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  806950:	79 44                	jns    806996 <bench_workers+0xbb>
+			panic("fork: %e", r);
+  806952:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806955:	89 c1                	mov    %eax,%ecx
+  806957:	48 b8 a3 e7 ff ff ff 	movabs $0xffffffffffffe7a3,%rax
+  80695e:	ff ff ff 
+  806961:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806965:	48 89 c2             	mov    %rax,%rdx
+  806968:	be 0f 00 00 00       	mov    $0xf,%esi
+  80696d:	48 b8 ac e7 ff ff ff 	movabs $0xffffffffffffe7ac,%rax
+  806974:	ff ff ff 
+  806977:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80697b:	48 89 c7             	mov    %rax,%rdi
+  80697e:	49 89 df             	mov    %rbx,%r15
+  806981:	b8 00 00 00 00       	mov    $0x0,%eax
+  806986:	49 b8 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%r8
+  80698d:	ff ff ff 
+  806990:	49 01 d8             	add    %rbx,%r8
+  806993:	41 ff d0             	call   *%r8
+		if (r == 0) {
+  806996:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80699a:	75 68                	jne    806a04 <bench_workers+0x129>
+			// Fails harmlessly on machines with fewer CPUs.
+			sys_env_set_affinity(0, 1 << i);
+  80699c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80699f:	ba 01 00 00 00       	mov    $0x1,%edx
+  8069a4:	89 c1                	mov    %eax,%ecx
+  8069a6:	d3 e2                	shl    %cl,%edx
+  8069a8:	89 d0                	mov    %edx,%eax
+  8069aa:	89 c6                	mov    %eax,%esi
+  8069ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8069b1:	49 89 df             	mov    %rbx,%r15
+  8069b4:	48 b8 5d 96 ff ff ff 	movabs $0xffffffffffff965d,%rax
+  8069bb:	ff ff ff 
+  8069be:	48 01 d8             	add    %rbx,%rax
+  8069c1:	ff d0                	call   *%rax
+			fn(i);
+  8069c3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069c6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8069ca:	89 c7                	mov    %eax,%edi
+  8069cc:	ff d2                	call   *%rdx
+			ipc_send(parent, i, 0, 0);
+  8069ce:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8069d1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8069d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8069d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8069de:	89 c7                	mov    %eax,%edi
+  8069e0:	49 89 df             	mov    %rbx,%r15
+  8069e3:	48 b8 b1 a5 ff ff ff 	movabs $0xffffffffffffa5b1,%rax
+  8069ea:	ff ff ff 
+  8069ed:	48 01 d8             	add    %rbx,%rax
+  8069f0:	ff d0                	call   *%rax
+			exit();
+  8069f2:	49 89 df             	mov    %rbx,%r15
+  8069f5:	48 b8 f4 73 ff ff ff 	movabs $0xffffffffffff73f4,%rax
+  8069fc:	ff ff ff 
+  8069ff:	48 01 d8             	add    %rbx,%rax
+  806a02:	ff d0                	call   *%rax
+	for (i = 0; i < n; i++) {
+  806a04:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806a08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a0b:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  806a0e:	0f 8c 23 ff ff ff    	jl     806937 <bench_workers+0x5c>
+		}
+	}
+	for (i = 0; i < n; i++)
+  806a14:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806a1b:	eb 25                	jmp    806a42 <bench_workers+0x167>
+		ipc_recv(0, 0, 0);
+  806a1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  806a22:	be 00 00 00 00       	mov    $0x0,%esi
+  806a27:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a2c:	49 89 df             	mov    %rbx,%r15
+  806a2f:	48 b8 c8 a4 ff ff ff 	movabs $0xffffffffffffa4c8,%rax
+  806a36:	ff ff ff 
+  806a39:	48 01 d8             	add    %rbx,%rax
+  806a3c:	ff d0                	call   *%rax
+	for (i = 0; i < n; i++)
+  806a3e:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806a42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a45:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  806a48:	7c d3                	jl     806a1d <bench_workers+0x142>
+	return sys_time_msec() - start;
+  806a4a:	49 89 df             	mov    %rbx,%r15
+  806a4d:	48 b8 ba 96 ff ff ff 	movabs $0xffffffffffff96ba,%rax
+  806a54:	ff ff ff 
+  806a57:	48 01 d8             	add    %rbx,%rax
+  806a5a:	ff d0                	call   *%rax
+  806a5c:	2b 45 e4             	sub    -0x1c(%rbp),%eax
+}
+  806a5f:	48 83 c4 20          	add    $0x20,%rsp
+  806a63:	5b                   	pop    %rbx
+  806a64:	41 5f                	pop    %r15
+  806a66:	5d                   	pop    %rbp
+  806a67:	c3                   	ret
+
+0000000000806a68 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  806a68:	55                   	push   %rbp
+  806a69:	48 89 e5             	mov    %rsp,%rbp
+  806a6c:	41 57                	push   %r15
+  806a6e:	48 83 ec 28          	sub    $0x28,%rsp
+  806a72:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806a72 <cputchar+0xa>
+  806a79:	49 bb ce 25 00 00 00 	movabs $0x25ce,%r11
+  806a80:	00 00 00 
+  806a83:	4c 01 d8             	add    %r11,%rax
+  806a86:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806a89:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806a8c:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806a8f:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806a93:	be 01 00 00 00       	mov    $0x1,%esi
+  806a98:	48 89 d7             	mov    %rdx,%rdi
+  806a9b:	49 89 c7             	mov    %rax,%r15
+  806a9e:	48 ba db 8f ff ff ff 	movabs $0xffffffffffff8fdb,%rdx
+  806aa5:	ff ff ff 
+  806aa8:	48 01 c2             	add    %rax,%rdx
+  806aab:	ff d2                	call   *%rdx
+}
+  806aad:	90                   	nop
+  806aae:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806ab2:	c9                   	leave
+  806ab3:	c3                   	ret
+
+0000000000806ab4 <getchar>:
+
+int
+getchar(void)
+{
+  806ab4:	55                   	push   %rbp
+  806ab5:	48 89 e5             	mov    %rsp,%rbp
+  806ab8:	41 57                	push   %r15
+  806aba:	48 83 ec 18          	sub    $0x18,%rsp
+  806abe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806abe <getchar+0xa>
+  806ac5:	49 bb 82 25 00 00 00 	movabs $0x2582,%r11
+  806acc:	00 00 00 
+  806acf:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806ad2:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806ad6:	ba 01 00 00 00       	mov    $0x1,%edx
+  806adb:	48 89 ce             	mov    %rcx,%rsi
+  806ade:	bf 00 00 00 00       	mov    $0x0,%edi
+  806ae3:	49 89 c7             	mov    %rax,%r15
+  806ae6:	48 b9 0b b3 ff ff ff 	movabs $0xffffffffffffb30b,%rcx
+  806aed:	ff ff ff 
+  806af0:	48 01 c1             	add    %rax,%rcx
+  806af3:	ff d1                	call   *%rcx
+  806af5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806af8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806afc:	79 05                	jns    806b03 <getchar+0x4f>
+		return r;
+  806afe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b01:	eb 14                	jmp    806b17 <getchar+0x63>
+	if (r < 1)
+  806b03:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b07:	7f 07                	jg     806b10 <getchar+0x5c>
+		return -E_EOF;
+  806b09:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806b0e:	eb 07                	jmp    806b17 <getchar+0x63>
+	return c;
+  806b10:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806b14:	0f b6 c0             	movzbl %al,%eax
+}
+  806b17:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806b1b:	c9                   	leave
+  806b1c:	c3                   	ret
+
+0000000000806b1d <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806b1d:	55                   	push   %rbp
+  806b1e:	48 89 e5             	mov    %rsp,%rbp
+  806b21:	41 57                	push   %r15
+  806b23:	53                   	push   %rbx
+  806b24:	48 83 ec 20          	sub    $0x20,%rsp
+  806b28:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b28 <iscons+0xb>
+  806b2f:	49 bb 18 25 00 00 00 	movabs $0x2518,%r11
+  806b36:	00 00 00 
+  806b39:	4c 01 db             	add    %r11,%rbx
+  806b3c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806b3f:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806b43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b46:	48 89 d6             	mov    %rdx,%rsi
+  806b49:	89 c7                	mov    %eax,%edi
+  806b4b:	49 89 df             	mov    %rbx,%r15
+  806b4e:	48 b8 c4 ad ff ff ff 	movabs $0xffffffffffffadc4,%rax
+  806b55:	ff ff ff 
+  806b58:	48 01 d8             	add    %rbx,%rax
+  806b5b:	ff d0                	call   *%rax
+  806b5d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b60:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b64:	79 05                	jns    806b6b <iscons+0x4e>
+		return r;
+  806b66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b69:	eb 1b                	jmp    806b86 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  806b6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b6f:	8b 10                	mov    (%rax),%edx
+  806b71:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  806b78:	00 00 00 
+  806b7b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806b7e:	39 c2                	cmp    %eax,%edx
+  806b80:	0f 94 c0             	sete   %al
+  806b83:	0f b6 c0             	movzbl %al,%eax
+}
+  806b86:	48 83 c4 20          	add    $0x20,%rsp
+  806b8a:	5b                   	pop    %rbx
+  806b8b:	41 5f                	pop    %r15
+  806b8d:	5d                   	pop    %rbp
+  806b8e:	c3                   	ret
+
+0000000000806b8f <opencons>:
+
+int
+opencons(void)
+{
+  806b8f:	55                   	push   %rbp
+  806b90:	48 89 e5             	mov    %rsp,%rbp
+  806b93:	41 57                	push   %r15
+  806b95:	53                   	push   %rbx
+  806b96:	48 83 ec 10          	sub    $0x10,%rsp
+  806b9a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b9a <opencons+0xb>
+  806ba1:	49 bb a6 24 00 00 00 	movabs $0x24a6,%r11
+  806ba8:	00 00 00 
+  806bab:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806bae:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806bb2:	48 89 c7             	mov    %rax,%rdi
+  806bb5:	49 89 df             	mov    %rbx,%r15
+  806bb8:	48 b8 0e ad ff ff ff 	movabs $0xffffffffffffad0e,%rax
+  806bbf:	ff ff ff 
+  806bc2:	48 01 d8             	add    %rbx,%rax
+  806bc5:	ff d0                	call   *%rax
+  806bc7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806bca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806bce:	79 05                	jns    806bd5 <opencons+0x46>
+		return r;
+  806bd0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bd3:	eb 68                	jmp    806c3d <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806bd5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806bd9:	ba 07 04 00 00       	mov    $0x407,%edx
+  806bde:	48 89 c6             	mov    %rax,%rsi
+  806be1:	bf 00 00 00 00       	mov    $0x0,%edi
+  806be6:	49 89 df             	mov    %rbx,%r15
+  806be9:	48 b8 93 91 ff ff ff 	movabs $0xffffffffffff9193,%rax
+  806bf0:	ff ff ff 
+  806bf3:	48 01 d8             	add    %rbx,%rax
+  806bf6:	ff d0                	call   *%rax
+  806bf8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806bfb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806bff:	79 05                	jns    806c06 <opencons+0x77>
+		return r;
+  806c01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c04:	eb 37                	jmp    806c3d <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806c06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c0a:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806c11:	00 00 00 
+  806c14:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806c17:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806c19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c1d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806c24:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806c28:	48 89 c7             	mov    %rax,%rdi
+  806c2b:	49 89 df             	mov    %rbx,%r15
+  806c2e:	48 b8 94 ac ff ff ff 	movabs $0xffffffffffffac94,%rax
+  806c35:	ff ff ff 
+  806c38:	48 01 d8             	add    %rbx,%rax
+  806c3b:	ff d0                	call   *%rax
+}
+  806c3d:	48 83 c4 10          	add    $0x10,%rsp
+  806c41:	5b                   	pop    %rbx
+  806c42:	41 5f                	pop    %r15
+  806c44:	5d                   	pop    %rbp
+  806c45:	c3                   	ret
+
+0000000000806c46 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806c46:	55                   	push   %rbp
+  806c47:	48 89 e5             	mov    %rsp,%rbp
+  806c4a:	41 57                	push   %r15
+  806c4c:	53                   	push   %rbx
+  806c4d:	48 83 ec 30          	sub    $0x30,%rsp
+  806c51:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c51 <devcons_read+0xb>
+  806c58:	49 bb ef 23 00 00 00 	movabs $0x23ef,%r11
+  806c5f:	00 00 00 
+  806c62:	4c 01 db             	add    %r11,%rbx
+  806c65:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806c69:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806c6d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806c71:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806c76:	75 19                	jne    806c91 <devcons_read+0x4b>
+		return 0;
+  806c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c7d:	eb 55                	jmp    806cd4 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806c7f:	49 89 df             	mov    %rbx,%r15
+  806c82:	48 b8 3e 91 ff ff ff 	movabs $0xffffffffffff913e,%rax
+  806c89:	ff ff ff 
+  806c8c:	48 01 d8             	add    %rbx,%rax
+  806c8f:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806c91:	49 89 df             	mov    %rbx,%r15
+  806c94:	48 b8 3a 90 ff ff ff 	movabs $0xffffffffffff903a,%rax
+  806c9b:	ff ff ff 
+  806c9e:	48 01 d8             	add    %rbx,%rax
+  806ca1:	ff d0                	call   *%rax
+  806ca3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806ca6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806caa:	74 d3                	je     806c7f <devcons_read+0x39>
+	if (c < 0)
+  806cac:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806cb0:	79 05                	jns    806cb7 <devcons_read+0x71>
+		return c;
+  806cb2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806cb5:	eb 1d                	jmp    806cd4 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806cb7:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806cbb:	75 07                	jne    806cc4 <devcons_read+0x7e>
+		return 0;
+  806cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cc2:	eb 10                	jmp    806cd4 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806cc4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806cc7:	89 c2                	mov    %eax,%edx
+  806cc9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806ccd:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806ccf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806cd4:	48 83 c4 30          	add    $0x30,%rsp
+  806cd8:	5b                   	pop    %rbx
+  806cd9:	41 5f                	pop    %r15
+  806cdb:	5d                   	pop    %rbp
+  806cdc:	c3                   	ret
+
+0000000000806cdd <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806cdd:	55                   	push   %rbp
+  806cde:	48 89 e5             	mov    %rsp,%rbp
+  806ce1:	41 57                	push   %r15
+  806ce3:	53                   	push   %rbx
+  806ce4:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806ceb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ceb <devcons_write+0xe>
+  806cf2:	49 bb 55 23 00 00 00 	movabs $0x2355,%r11
+  806cf9:	00 00 00 
+  806cfc:	4c 01 db             	add    %r11,%rbx
+  806cff:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806d06:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806d0d:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806d14:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806d1b:	e9 80 00 00 00       	jmp    806da0 <devcons_write+0xc3>
+		m = n - tot;
+  806d20:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806d27:	89 c2                	mov    %eax,%edx
+  806d29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d2c:	29 c2                	sub    %eax,%edx
+  806d2e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806d31:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806d34:	83 f8 7f             	cmp    $0x7f,%eax
+  806d37:	76 07                	jbe    806d40 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806d39:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806d40:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806d43:	48 63 d0             	movslq %eax,%rdx
+  806d46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d49:	48 63 c8             	movslq %eax,%rcx
+  806d4c:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806d53:	48 01 c1             	add    %rax,%rcx
+  806d56:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806d5d:	48 89 ce             	mov    %rcx,%rsi
+  806d60:	48 89 c7             	mov    %rax,%rdi
+  806d63:	49 89 df             	mov    %rbx,%r15
+  806d66:	48 b8 b7 88 ff ff ff 	movabs $0xffffffffffff88b7,%rax
+  806d6d:	ff ff ff 
+  806d70:	48 01 d8             	add    %rbx,%rax
+  806d73:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806d75:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806d78:	48 63 d0             	movslq %eax,%rdx
+  806d7b:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806d82:	48 89 d6             	mov    %rdx,%rsi
+  806d85:	48 89 c7             	mov    %rax,%rdi
+  806d88:	49 89 df             	mov    %rbx,%r15
+  806d8b:	48 b8 db 8f ff ff ff 	movabs $0xffffffffffff8fdb,%rax
+  806d92:	ff ff ff 
+  806d95:	48 01 d8             	add    %rbx,%rax
+  806d98:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806d9a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806d9d:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806da0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806da3:	48 98                	cltq
+  806da5:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806dac:	0f 82 6e ff ff ff    	jb     806d20 <devcons_write+0x43>
+	}
+	return tot;
+  806db2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806db5:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806dbc:	5b                   	pop    %rbx
+  806dbd:	41 5f                	pop    %r15
+  806dbf:	5d                   	pop    %rbp
+  806dc0:	c3                   	ret
+
+0000000000806dc1 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806dc1:	55                   	push   %rbp
+  806dc2:	48 89 e5             	mov    %rsp,%rbp
+  806dc5:	48 83 ec 08          	sub    $0x8,%rsp
+  806dc9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806dc9 <devcons_close+0x8>
+  806dd0:	49 bb 77 22 00 00 00 	movabs $0x2277,%r11
+  806dd7:	00 00 00 
+  806dda:	4c 01 d8             	add    %r11,%rax
+  806ddd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806de1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806de6:	c9                   	leave
+  806de7:	c3                   	ret
+
+0000000000806de8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806de8:	55                   	push   %rbp
+  806de9:	48 89 e5             	mov    %rsp,%rbp
+  806dec:	41 57                	push   %r15
+  806dee:	48 83 ec 18          	sub    $0x18,%rsp
+  806df2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806df2 <devcons_stat+0xa>
+  806df9:	49 bb 4e 22 00 00 00 	movabs $0x224e,%r11
+  806e00:	00 00 00 
+  806e03:	4c 01 d8             	add    %r11,%rax
+  806e06:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806e0a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806e0e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806e12:	48 b9 bd e7 ff ff ff 	movabs $0xffffffffffffe7bd,%rcx
+  806e19:	ff ff ff 
+  806e1c:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806e20:	48 89 ce             	mov    %rcx,%rsi
+  806e23:	48 89 d7             	mov    %rdx,%rdi
+  806e26:	49 89 c7             	mov    %rax,%r15
+  806e29:	48 ba d7 84 ff ff ff 	movabs $0xffffffffffff84d7,%rdx
+  806e30:	ff ff ff 
+  806e33:	48 01 c2             	add    %rax,%rdx
+  806e36:	ff d2                	call   *%rdx
+	return 0;
+  806e38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806e3d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806e41:	c9                   	leave
+  806e42:	c3                   	ret
+
+0000000000806e43 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806e43:	55                   	push   %rbp
+  806e44:	48 89 e5             	mov    %rsp,%rbp
+  806e47:	41 57                	push   %r15
+  806e49:	53                   	push   %rbx
+  806e4a:	48 83 ec 20          	sub    $0x20,%rsp
+  806e4e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806e4e <set_pgfault_handler+0xb>
+  806e55:	49 bb f2 21 00 00 00 	movabs $0x21f2,%r11
+  806e5c:	00 00 00 
+  806e5f:	4c 01 db             	add    %r11,%rbx
+  806e62:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806e66:	49 89 df             	mov    %rbx,%r15
+  806e69:	48 b8 ea 90 ff ff ff 	movabs $0xffffffffffff90ea,%rax
+  806e70:	ff ff ff 
+  806e73:	48 01 d8             	add    %rbx,%rax
+  806e76:	ff d0                	call   *%rax
+  806e78:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806e7b:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806e82:	00 00 00 
+  806e85:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806e89:	48 85 c0             	test   %rax,%rax
+  806e8c:	75 6b                	jne    806ef9 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806e8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e91:	ba 07 00 00 00       	mov    $0x7,%edx
+  806e96:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806e9b:	48 89 ce             	mov    %rcx,%rsi
+  806e9e:	89 c7                	mov    %eax,%edi
+  806ea0:	49 89 df             	mov    %rbx,%r15
+  806ea3:	48 b8 93 91 ff ff ff 	movabs $0xffffffffffff9193,%rax
+  806eaa:	ff ff ff 
+  806ead:	48 01 d8             	add    %rbx,%rax
+  806eb0:	ff d0                	call   *%rax
+  806eb2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806eb5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806eb9:	74 3e                	je     806ef9 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806ebb:	48 b8 c8 e7 ff ff ff 	movabs $0xffffffffffffe7c8,%rax
+  806ec2:	ff ff ff 
+  806ec5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806ec9:	48 89 c2             	mov    %rax,%rdx
+  806ecc:	be 23 00 00 00       	mov    $0x23,%esi
+  806ed1:	48 b8 f6 e7 ff ff ff 	movabs $0xffffffffffffe7f6,%rax
+  806ed8:	ff ff ff 
+  806edb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806edf:	48 89 c7             	mov    %rax,%rdi
+  806ee2:	49 89 df             	mov    %rbx,%r15
+  806ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  806eea:	48 b9 3e 74 ff ff ff 	movabs $0xffffffffffff743e,%rcx
+  806ef1:	ff ff ff 
+  806ef4:	48 01 d9             	add    %rbx,%rcx
+  806ef7:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806ef9:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806f00:	00 00 00 
+  806f03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806f07:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806f0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806f0e:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806f15:	ff ff ff 
+  806f18:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806f1c:	48 89 d6             	mov    %rdx,%rsi
+  806f1f:	89 c7                	mov    %eax,%edi
+  806f21:	49 89 df             	mov    %rbx,%r15
+  806f24:	48 b8 89 93 ff ff ff 	movabs $0xffffffffffff9389,%rax
+  806f2b:	ff ff ff 
+  806f2e:	48 01 d8             	add    %rbx,%rax
+  806f31:	ff d0                	call   *%rax
+}
+  806f33:	90                   	nop
+  806f34:	48 83 c4 20          	add    $0x20,%rsp
+  806f38:	5b                   	pop    %rbx
+  806f39:	41 5f                	pop    %r15
+  806f3b:	5d                   	pop    %rbp
+  806f3c:	c3                   	ret
+
+0000000000806f3d <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806f3d:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806f40:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806f47:	00 00 00 
+call *%rax
+  806f4a:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806f4c:	58                   	pop    %rax
+	popq %rax;
+  806f4d:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806f4e:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806f55:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806f59:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806f5d:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806f61:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806f65:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806f69:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806f6c:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806f70:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806f74:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806f79:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806f7e:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806f83:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806f88:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806f8d:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806f92:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806f97:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806f9c:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806fa1:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806fa6:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806fab:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806fb0:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806fb5:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806fba:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806fbe:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806fc2:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806fc3:	5c                   	pop    %rsp
+	ret;			//return
+  806fc4:	c3                   	ret
+
+0000000000806fc5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806fc5:	55                   	push   %rbp
+  806fc6:	48 89 e5             	mov    %rsp,%rbp
+  806fc9:	48 83 ec 18          	sub    $0x18,%rsp
+  806fcd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806fcd <pageref+0x8>
+  806fd4:	49 bb 73 20 00 00 00 	movabs $0x2073,%r11
+  806fdb:	00 00 00 
+  806fde:	4c 01 d8             	add    %r11,%rax
+  806fe1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806fe5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806fe9:	48 89 d1             	mov    %rdx,%rcx
+  806fec:	48 c1 e9 15          	shr    $0x15,%rcx
+  806ff0:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806ff7:	ff ff ff 
+  806ffa:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806ffe:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  807002:	83 e2 01             	and    $0x1,%edx
+  807005:	48 85 d2             	test   %rdx,%rdx
+  807008:	75 07                	jne    807011 <pageref+0x4c>
+		return 0;
+  80700a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80700f:	eb 64                	jmp    807075 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  807011:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807015:	48 89 d1             	mov    %rdx,%rcx
+  807018:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80701c:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  807023:	ff ff ff 
+  807026:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80702a:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80702e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  807032:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  807036:	83 e2 01             	and    $0x1,%edx
+  807039:	48 85 d2             	test   %rdx,%rdx
+  80703c:	75 07                	jne    807045 <pageref+0x80>
+		return 0;
+  80703e:	b8 00 00 00 00       	mov    $0x0,%eax
+  807043:	eb 30                	jmp    807075 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  807045:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  807049:	48 c1 ea 0c          	shr    $0xc,%rdx
+  80704d:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  807054:	ff ff ff 
+  807057:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  80705b:	48 89 d0             	mov    %rdx,%rax
+  80705e:	48 01 c0             	add    %rax,%rax
+  807061:	48 01 d0             	add    %rdx,%rax
+  807064:	48 c1 e0 03          	shl    $0x3,%rax
+  807068:	48 01 c8             	add    %rcx,%rax
+  80706b:	48 83 c0 08          	add    $0x8,%rax
+  80706f:	0f b7 00             	movzwl (%rax),%eax
+  807072:	0f b7 c0             	movzwl %ax,%eax
+}
+  807075:	c9                   	leave
+  807076:	c3                   	ret
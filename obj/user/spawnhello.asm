@@ -0,0 +1,10794 @@
+
+obj/user/spawnhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 fe 00 00 00       	call   80013f <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb ea 8f 00 00 00 	movabs $0x8fea,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+	cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800069:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800070:	ff ff ff 
+  800073:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800077:	48 8b 00             	mov    (%rax),%rax
+  80007a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800080:	89 c6                	mov    %eax,%esi
+  800082:	48 b8 c8 e0 ff ff ff 	movabs $0xffffffffffffe0c8,%rax
+  800089:	ff ff ff 
+  80008c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800090:	48 89 c7             	mov    %rax,%rdi
+  800093:	49 89 df             	mov    %rbx,%r15
+  800096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009b:	48 ba e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rdx
+  8000a2:	ff ff ff 
+  8000a5:	48 01 da             	add    %rbx,%rdx
+  8000a8:	ff d2                	call   *%rdx
+	if ((r = spawnl("/bin/hello", "hello", 0)) < 0)
+  8000aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000af:	48 b8 e6 e0 ff ff ff 	movabs $0xffffffffffffe0e6,%rax
+  8000b6:	ff ff ff 
+  8000b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000bd:	48 89 c6             	mov    %rax,%rsi
+  8000c0:	48 b8 ec e0 ff ff ff 	movabs $0xffffffffffffe0ec,%rax
+  8000c7:	ff ff ff 
+  8000ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000ce:	48 89 c7             	mov    %rax,%rdi
+  8000d1:	49 89 df             	mov    %rbx,%r15
+  8000d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d9:	48 b9 d1 b2 ff ff ff 	movabs $0xffffffffffffb2d1,%rcx
+  8000e0:	ff ff ff 
+  8000e3:	48 01 d9             	add    %rbx,%rcx
+  8000e6:	ff d1                	call   *%rcx
+  8000e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8000eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000ef:	79 44                	jns    800135 <umain+0xf2>
+		panic("spawn(hello) failed: %e", r);
+  8000f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000f4:	89 c1                	mov    %eax,%ecx
+  8000f6:	48 b8 f7 e0 ff ff ff 	movabs $0xffffffffffffe0f7,%rax
+  8000fd:	ff ff ff 
+  800100:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800104:	48 89 c2             	mov    %rax,%rdx
+  800107:	be 09 00 00 00       	mov    $0x9,%esi
+  80010c:	48 b8 0f e1 ff ff ff 	movabs $0xffffffffffffe10f,%rax
+  800113:	ff ff ff 
+  800116:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80011a:	48 89 c7             	mov    %rax,%rdi
+  80011d:	49 89 df             	mov    %rbx,%r15
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+  800125:	49 b8 11 72 ff ff ff 	movabs $0xffffffffffff7211,%r8
+  80012c:	ff ff ff 
+  80012f:	49 01 d8             	add    %rbx,%r8
+  800132:	41 ff d0             	call   *%r8
+}
+  800135:	90                   	nop
+  800136:	48 83 c4 20          	add    $0x20,%rsp
+  80013a:	5b                   	pop    %rbx
+  80013b:	41 5f                	pop    %r15
+  80013d:	5d                   	pop    %rbp
+  80013e:	c3                   	ret
+
+000000000080013f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80013f:	55                   	push   %rbp
+  800140:	48 89 e5             	mov    %rsp,%rbp
+  800143:	41 57                	push   %r15
+  800145:	53                   	push   %rbx
+  800146:	48 83 ec 20          	sub    $0x20,%rsp
+  80014a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80014a <libmain+0xb>
+  800151:	49 bb ee 8e 00 00 00 	movabs $0x8eee,%r11
+  800158:	00 00 00 
+  80015b:	4c 01 db             	add    %r11,%rbx
+  80015e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800161:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800165:	49 89 df             	mov    %rbx,%r15
+  800168:	48 b8 bd 8e ff ff ff 	movabs $0xffffffffffff8ebd,%rax
+  80016f:	ff ff ff 
+  800172:	48 01 d8             	add    %rbx,%rax
+  800175:	ff d0                	call   *%rax
+  800177:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  80017a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80017d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800182:	48 98                	cltq
+  800184:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80018b:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  800192:	ff ff ff 
+  800195:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800199:	48 01 c2             	add    %rax,%rdx
+  80019c:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  8001a3:	00 00 00 
+  8001a6:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001aa:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8001ae:	7e 15                	jle    8001c5 <libmain+0x86>
+		binaryname = argv[0];
+  8001b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8001b4:	48 8b 00             	mov    (%rax),%rax
+  8001b7:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  8001be:	00 00 00 
+  8001c1:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8001c5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8001c9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8001cc:	48 89 d6             	mov    %rdx,%rsi
+  8001cf:	89 c7                	mov    %eax,%edi
+  8001d1:	49 89 df             	mov    %rbx,%r15
+  8001d4:	48 b8 0b 70 ff ff ff 	movabs $0xffffffffffff700b,%rax
+  8001db:	ff ff ff 
+  8001de:	48 01 d8             	add    %rbx,%rax
+  8001e1:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8001e3:	49 89 df             	mov    %rbx,%r15
+  8001e6:	48 b8 c7 71 ff ff ff 	movabs $0xffffffffffff71c7,%rax
+  8001ed:	ff ff ff 
+  8001f0:	48 01 d8             	add    %rbx,%rax
+  8001f3:	ff d0                	call   *%rax
+}
+  8001f5:	90                   	nop
+  8001f6:	48 83 c4 20          	add    $0x20,%rsp
+  8001fa:	5b                   	pop    %rbx
+  8001fb:	41 5f                	pop    %r15
+  8001fd:	5d                   	pop    %rbp
+  8001fe:	c3                   	ret
+
+00000000008001ff <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001ff:	55                   	push   %rbp
+  800200:	48 89 e5             	mov    %rsp,%rbp
+  800203:	41 57                	push   %r15
+  800205:	53                   	push   %rbx
+  800206:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800206 <exit+0x7>
+  80020d:	49 bb 32 8e 00 00 00 	movabs $0x8e32,%r11
+  800214:	00 00 00 
+  800217:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80021a:	49 89 df             	mov    %rbx,%r15
+  80021d:	48 b8 3a 9b ff ff ff 	movabs $0xffffffffffff9b3a,%rax
+  800224:	ff ff ff 
+  800227:	48 01 d8             	add    %rbx,%rax
+  80022a:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80022c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800231:	49 89 df             	mov    %rbx,%r15
+  800234:	48 b8 61 8e ff ff ff 	movabs $0xffffffffffff8e61,%rax
+  80023b:	ff ff ff 
+  80023e:	48 01 d8             	add    %rbx,%rax
+  800241:	ff d0                	call   *%rax
+}
+  800243:	90                   	nop
+  800244:	5b                   	pop    %rbx
+  800245:	41 5f                	pop    %r15
+  800247:	5d                   	pop    %rbp
+  800248:	c3                   	ret
+
+0000000000800249 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800249:	55                   	push   %rbp
+  80024a:	48 89 e5             	mov    %rsp,%rbp
+  80024d:	41 57                	push   %r15
+  80024f:	41 54                	push   %r12
+  800251:	53                   	push   %rbx
+  800252:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800259:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800259 <_panic+0x10>
+  800260:	49 bb df 8d 00 00 00 	movabs $0x8ddf,%r11
+  800267:	00 00 00 
+  80026a:	4c 01 db             	add    %r11,%rbx
+  80026d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800274:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80027a:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  800281:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800288:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80028f:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800296:	84 c0                	test   %al,%al
+  800298:	74 26                	je     8002c0 <_panic+0x77>
+  80029a:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8002a1:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8002a8:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8002ac:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8002b0:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8002b4:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8002b8:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8002bc:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002c0:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8002c7:	00 00 00 
+  8002ca:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8002d1:	00 00 00 
+  8002d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002d8:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8002df:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8002e6:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002ed:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  8002f4:	ff ff ff 
+  8002f7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002fb:	4c 8b 20             	mov    (%rax),%r12
+  8002fe:	49 89 df             	mov    %rbx,%r15
+  800301:	48 b8 bd 8e ff ff ff 	movabs $0xffffffffffff8ebd,%rax
+  800308:	ff ff ff 
+  80030b:	48 01 d8             	add    %rbx,%rax
+  80030e:	ff d0                	call   *%rax
+  800310:	89 c6                	mov    %eax,%esi
+  800312:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800318:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80031f:	41 89 d0             	mov    %edx,%r8d
+  800322:	48 89 c1             	mov    %rax,%rcx
+  800325:	4c 89 e2             	mov    %r12,%rdx
+  800328:	48 b8 30 e1 ff ff ff 	movabs $0xffffffffffffe130,%rax
+  80032f:	ff ff ff 
+  800332:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800336:	48 89 c7             	mov    %rax,%rdi
+  800339:	49 89 df             	mov    %rbx,%r15
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 b9 e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%r9
+  800348:	ff ff ff 
+  80034b:	49 01 d9             	add    %rbx,%r9
+  80034e:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800351:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800358:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80035f:	48 89 d6             	mov    %rdx,%rsi
+  800362:	48 89 c7             	mov    %rax,%rdi
+  800365:	49 89 df             	mov    %rbx,%r15
+  800368:	48 b8 08 74 ff ff ff 	movabs $0xffffffffffff7408,%rax
+  80036f:	ff ff ff 
+  800372:	48 01 d8             	add    %rbx,%rax
+  800375:	ff d0                	call   *%rax
+	cprintf("\n");
+  800377:	48 b8 53 e1 ff ff ff 	movabs $0xffffffffffffe153,%rax
+  80037e:	ff ff ff 
+  800381:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800385:	48 89 c7             	mov    %rax,%rdi
+  800388:	49 89 df             	mov    %rbx,%r15
+  80038b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800390:	48 ba e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rdx
+  800397:	ff ff ff 
+  80039a:	48 01 da             	add    %rbx,%rdx
+  80039d:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80039f:	cc                   	int3
+  8003a0:	eb fd                	jmp    80039f <_panic+0x156>
+
+00000000008003a2 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8003a2:	55                   	push   %rbp
+  8003a3:	48 89 e5             	mov    %rsp,%rbp
+  8003a6:	41 57                	push   %r15
+  8003a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8003ac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8003ac <putch+0xa>
+  8003b3:	49 bb 8c 8c 00 00 00 	movabs $0x8c8c,%r11
+  8003ba:	00 00 00 
+  8003bd:	4c 01 d8             	add    %r11,%rax
+  8003c0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8003c7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003cb:	8b 12                	mov    (%rdx),%edx
+  8003cd:	8d 72 01             	lea    0x1(%rdx),%esi
+  8003d0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8003d4:	89 31                	mov    %esi,(%rcx)
+  8003d6:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8003d9:	89 ce                	mov    %ecx,%esi
+  8003db:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8003df:	48 63 d2             	movslq %edx,%rdx
+  8003e2:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8003e7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003eb:	8b 12                	mov    (%rdx),%edx
+  8003ed:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003f3:	75 33                	jne    800428 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8003f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003f9:	8b 12                	mov    (%rdx),%edx
+  8003fb:	48 63 d2             	movslq %edx,%rdx
+  8003fe:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800402:	48 83 c1 08          	add    $0x8,%rcx
+  800406:	48 89 d6             	mov    %rdx,%rsi
+  800409:	48 89 cf             	mov    %rcx,%rdi
+  80040c:	49 89 c7             	mov    %rax,%r15
+  80040f:	48 ba ae 8d ff ff ff 	movabs $0xffffffffffff8dae,%rdx
+  800416:	ff ff ff 
+  800419:	48 01 c2             	add    %rax,%rdx
+  80041c:	ff d2                	call   *%rdx
+        b->idx = 0;
+  80041e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800422:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800428:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80042c:	8b 40 04             	mov    0x4(%rax),%eax
+  80042f:	8d 50 01             	lea    0x1(%rax),%edx
+  800432:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800436:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800439:	90                   	nop
+  80043a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80043e:	c9                   	leave
+  80043f:	c3                   	ret
+
+0000000000800440 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800440:	55                   	push   %rbp
+  800441:	48 89 e5             	mov    %rsp,%rbp
+  800444:	41 57                	push   %r15
+  800446:	53                   	push   %rbx
+  800447:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80044e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80044e <vcprintf+0xe>
+  800455:	49 bb ea 8b 00 00 00 	movabs $0x8bea,%r11
+  80045c:	00 00 00 
+  80045f:	4c 01 db             	add    %r11,%rbx
+  800462:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800469:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800470:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800477:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80047e:	48 8b 06             	mov    (%rsi),%rax
+  800481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800485:	48 89 01             	mov    %rax,(%rcx)
+  800488:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80048c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800490:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800494:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  80049b:	00 00 00 
+    b.cnt = 0;
+  80049e:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8004a5:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8004a8:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8004af:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8004b6:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8004bd:	48 89 c6             	mov    %rax,%rsi
+  8004c0:	48 b8 6a 73 ff ff ff 	movabs $0xffffffffffff736a,%rax
+  8004c7:	ff ff ff 
+  8004ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004ce:	48 89 c7             	mov    %rax,%rdi
+  8004d1:	49 89 df             	mov    %rbx,%r15
+  8004d4:	48 b8 2c 79 ff ff ff 	movabs $0xffffffffffff792c,%rax
+  8004db:	ff ff ff 
+  8004de:	48 01 d8             	add    %rbx,%rax
+  8004e1:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8004e3:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8004e9:	48 98                	cltq
+  8004eb:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8004f2:	48 83 c2 08          	add    $0x8,%rdx
+  8004f6:	48 89 c6             	mov    %rax,%rsi
+  8004f9:	48 89 d7             	mov    %rdx,%rdi
+  8004fc:	49 89 df             	mov    %rbx,%r15
+  8004ff:	48 b8 ae 8d ff ff ff 	movabs $0xffffffffffff8dae,%rax
+  800506:	ff ff ff 
+  800509:	48 01 d8             	add    %rbx,%rax
+  80050c:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  80050e:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800514:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80051b:	5b                   	pop    %rbx
+  80051c:	41 5f                	pop    %r15
+  80051e:	5d                   	pop    %rbp
+  80051f:	c3                   	ret
+
+0000000000800520 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800520:	55                   	push   %rbp
+  800521:	48 89 e5             	mov    %rsp,%rbp
+  800524:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80052b:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80052b <cprintf+0xb>
+  800532:	49 bb 0d 8b 00 00 00 	movabs $0x8b0d,%r11
+  800539:	00 00 00 
+  80053c:	4d 01 da             	add    %r11,%r10
+  80053f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800546:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80054d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800554:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80055b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800562:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800569:	84 c0                	test   %al,%al
+  80056b:	74 20                	je     80058d <cprintf+0x6d>
+  80056d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800571:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800575:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800579:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80057d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800581:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800585:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800589:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80058d:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800594:	00 00 00 
+  800597:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80059e:	00 00 00 
+  8005a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8005ac:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8005b3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8005ba:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8005c1:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8005c8:	48 8b 06             	mov    (%rsi),%rax
+  8005cb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8005cf:	48 89 01             	mov    %rax,(%rcx)
+  8005d2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8005d6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8005da:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8005de:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8005e5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8005ec:	48 89 d6             	mov    %rdx,%rsi
+  8005ef:	48 89 c7             	mov    %rax,%rdi
+  8005f2:	48 b8 08 74 ff ff ff 	movabs $0xffffffffffff7408,%rax
+  8005f9:	ff ff ff 
+  8005fc:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800600:	ff d0                	call   *%rax
+  800602:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800608:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80060e:	c9                   	leave
+  80060f:	c3                   	ret
+
+0000000000800610 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800610:	55                   	push   %rbp
+  800611:	48 89 e5             	mov    %rsp,%rbp
+  800614:	53                   	push   %rbx
+  800615:	48 83 ec 38          	sub    $0x38,%rsp
+  800619:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800619 <printnum+0x9>
+  800620:	49 bb 1f 8a 00 00 00 	movabs $0x8a1f,%r11
+  800627:	00 00 00 
+  80062a:	4c 01 db             	add    %r11,%rbx
+  80062d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800631:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800635:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800639:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80063c:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800640:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800644:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800647:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80064b:	72 58                	jb     8006a5 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80064d:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800650:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800653:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800656:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80065a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80065f:	48 f7 f6             	div    %rsi
+  800662:	49 89 c2             	mov    %rax,%r10
+  800665:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800668:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80066b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80066f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800673:	41 89 c9             	mov    %ecx,%r9d
+  800676:	41 89 f8             	mov    %edi,%r8d
+  800679:	89 d1                	mov    %edx,%ecx
+  80067b:	4c 89 d2             	mov    %r10,%rdx
+  80067e:	48 89 c7             	mov    %rax,%rdi
+  800681:	48 b8 d8 75 ff ff ff 	movabs $0xffffffffffff75d8,%rax
+  800688:	ff ff ff 
+  80068b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80068f:	ff d0                	call   *%rax
+  800691:	eb 1c                	jmp    8006af <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800693:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800697:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80069a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80069e:	48 89 d6             	mov    %rdx,%rsi
+  8006a1:	89 c7                	mov    %eax,%edi
+  8006a3:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8006a5:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8006a9:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8006ad:	7f e4                	jg     800693 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8006af:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8006b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8006b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006bb:	48 f7 f1             	div    %rcx
+  8006be:	48 b8 8f e2 ff ff ff 	movabs $0xffffffffffffe28f,%rax
+  8006c5:	ff ff ff 
+  8006c8:	48 01 d8             	add    %rbx,%rax
+  8006cb:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8006cf:	0f be c0             	movsbl %al,%eax
+  8006d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006d6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8006da:	48 89 d6             	mov    %rdx,%rsi
+  8006dd:	89 c7                	mov    %eax,%edi
+  8006df:	ff d1                	call   *%rcx
+}
+  8006e1:	90                   	nop
+  8006e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006e6:	c9                   	leave
+  8006e7:	c3                   	ret
+
+00000000008006e8 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8006e8:	55                   	push   %rbp
+  8006e9:	48 89 e5             	mov    %rsp,%rbp
+  8006ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8006f0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006f0 <getuint+0x8>
+  8006f7:	49 bb 48 89 00 00 00 	movabs $0x8948,%r11
+  8006fe:	00 00 00 
+  800701:	4c 01 d8             	add    %r11,%rax
+  800704:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800708:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80070b:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80070f:	7e 4f                	jle    800760 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800711:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800715:	8b 00                	mov    (%rax),%eax
+  800717:	83 f8 2f             	cmp    $0x2f,%eax
+  80071a:	77 24                	ja     800740 <getuint+0x58>
+  80071c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800720:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800724:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800728:	8b 00                	mov    (%rax),%eax
+  80072a:	89 c0                	mov    %eax,%eax
+  80072c:	48 01 d0             	add    %rdx,%rax
+  80072f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800733:	8b 12                	mov    (%rdx),%edx
+  800735:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800738:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80073c:	89 0a                	mov    %ecx,(%rdx)
+  80073e:	eb 14                	jmp    800754 <getuint+0x6c>
+  800740:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800744:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800748:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80074c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800750:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800754:	48 8b 00             	mov    (%rax),%rax
+  800757:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80075b:	e9 9d 00 00 00       	jmp    8007fd <getuint+0x115>
+	else if (lflag)
+  800760:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800764:	74 4c                	je     8007b2 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800766:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80076a:	8b 00                	mov    (%rax),%eax
+  80076c:	83 f8 2f             	cmp    $0x2f,%eax
+  80076f:	77 24                	ja     800795 <getuint+0xad>
+  800771:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800775:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800779:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80077d:	8b 00                	mov    (%rax),%eax
+  80077f:	89 c0                	mov    %eax,%eax
+  800781:	48 01 d0             	add    %rdx,%rax
+  800784:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800788:	8b 12                	mov    (%rdx),%edx
+  80078a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80078d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800791:	89 0a                	mov    %ecx,(%rdx)
+  800793:	eb 14                	jmp    8007a9 <getuint+0xc1>
+  800795:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800799:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80079d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007a1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007a5:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007a9:	48 8b 00             	mov    (%rax),%rax
+  8007ac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007b0:	eb 4b                	jmp    8007fd <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8007b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007b6:	8b 00                	mov    (%rax),%eax
+  8007b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bb:	77 24                	ja     8007e1 <getuint+0xf9>
+  8007bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c9:	8b 00                	mov    (%rax),%eax
+  8007cb:	89 c0                	mov    %eax,%eax
+  8007cd:	48 01 d0             	add    %rdx,%rax
+  8007d0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007d4:	8b 12                	mov    (%rdx),%edx
+  8007d6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007d9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007dd:	89 0a                	mov    %ecx,(%rdx)
+  8007df:	eb 14                	jmp    8007f5 <getuint+0x10d>
+  8007e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007e9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007ed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007f1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007f5:	8b 00                	mov    (%rax),%eax
+  8007f7:	89 c0                	mov    %eax,%eax
+  8007f9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8007fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800801:	c9                   	leave
+  800802:	c3                   	ret
+
+0000000000800803 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800803:	55                   	push   %rbp
+  800804:	48 89 e5             	mov    %rsp,%rbp
+  800807:	48 83 ec 20          	sub    $0x20,%rsp
+  80080b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80080b <printfloat+0x8>
+  800812:	49 bb 2d 88 00 00 00 	movabs $0x882d,%r11
+  800819:	00 00 00 
+  80081c:	4c 01 d8             	add    %r11,%rax
+  80081f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800823:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800827:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80082b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80082f:	48 85 c0             	test   %rax,%rax
+  800832:	79 12                	jns    800846 <printfloat+0x43>
+		putch('-',putdat);
+  800834:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800838:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80083c:	48 89 c6             	mov    %rax,%rsi
+  80083f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800844:	ff d2                	call   *%rdx
+	
+}
+  800846:	90                   	nop
+  800847:	c9                   	leave
+  800848:	c3                   	ret
+
+0000000000800849 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800849:	55                   	push   %rbp
+  80084a:	48 89 e5             	mov    %rsp,%rbp
+  80084d:	48 83 ec 20          	sub    $0x20,%rsp
+  800851:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800851 <getint+0x8>
+  800858:	49 bb e7 87 00 00 00 	movabs $0x87e7,%r11
+  80085f:	00 00 00 
+  800862:	4c 01 d8             	add    %r11,%rax
+  800865:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800869:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  80086c:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800870:	7e 4f                	jle    8008c1 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800872:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800876:	8b 00                	mov    (%rax),%eax
+  800878:	83 f8 2f             	cmp    $0x2f,%eax
+  80087b:	77 24                	ja     8008a1 <getint+0x58>
+  80087d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800881:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800885:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800889:	8b 00                	mov    (%rax),%eax
+  80088b:	89 c0                	mov    %eax,%eax
+  80088d:	48 01 d0             	add    %rdx,%rax
+  800890:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800894:	8b 12                	mov    (%rdx),%edx
+  800896:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800899:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80089d:	89 0a                	mov    %ecx,(%rdx)
+  80089f:	eb 14                	jmp    8008b5 <getint+0x6c>
+  8008a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008a5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008a9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008ad:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008b1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008b5:	48 8b 00             	mov    (%rax),%rax
+  8008b8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8008bc:	e9 9d 00 00 00       	jmp    80095e <getint+0x115>
+	else if (lflag)
+  8008c1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8008c5:	74 4c                	je     800913 <getint+0xca>
+		x=va_arg(*ap, long);
+  8008c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008cb:	8b 00                	mov    (%rax),%eax
+  8008cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d0:	77 24                	ja     8008f6 <getint+0xad>
+  8008d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008d6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008de:	8b 00                	mov    (%rax),%eax
+  8008e0:	89 c0                	mov    %eax,%eax
+  8008e2:	48 01 d0             	add    %rdx,%rax
+  8008e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008e9:	8b 12                	mov    (%rdx),%edx
+  8008eb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008ee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8008f2:	89 0a                	mov    %ecx,(%rdx)
+  8008f4:	eb 14                	jmp    80090a <getint+0xc1>
+  8008f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008fa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008fe:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800902:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800906:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80090a:	48 8b 00             	mov    (%rax),%rax
+  80090d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800911:	eb 4b                	jmp    80095e <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800913:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800917:	8b 00                	mov    (%rax),%eax
+  800919:	83 f8 2f             	cmp    $0x2f,%eax
+  80091c:	77 24                	ja     800942 <getint+0xf9>
+  80091e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800922:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800926:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80092a:	8b 00                	mov    (%rax),%eax
+  80092c:	89 c0                	mov    %eax,%eax
+  80092e:	48 01 d0             	add    %rdx,%rax
+  800931:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800935:	8b 12                	mov    (%rdx),%edx
+  800937:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80093a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80093e:	89 0a                	mov    %ecx,(%rdx)
+  800940:	eb 14                	jmp    800956 <getint+0x10d>
+  800942:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800946:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80094a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80094e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800952:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800956:	8b 00                	mov    (%rax),%eax
+  800958:	48 98                	cltq
+  80095a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80095e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800962:	c9                   	leave
+  800963:	c3                   	ret
+
+0000000000800964 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800964:	55                   	push   %rbp
+  800965:	48 89 e5             	mov    %rsp,%rbp
+  800968:	41 57                	push   %r15
+  80096a:	41 55                	push   %r13
+  80096c:	41 54                	push   %r12
+  80096e:	53                   	push   %rbx
+  80096f:	48 83 ec 60          	sub    $0x60,%rsp
+  800973:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800973 <vprintfmt+0xf>
+  80097a:	49 bb c5 86 00 00 00 	movabs $0x86c5,%r11
+  800981:	00 00 00 
+  800984:	4d 01 dc             	add    %r11,%r12
+  800987:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  80098b:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  80098f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800993:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800997:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  80099e:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  8009a2:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  8009a6:	48 8b 06             	mov    (%rsi),%rax
+  8009a9:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8009ad:	48 89 01             	mov    %rax,(%rcx)
+  8009b0:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8009b4:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8009b8:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8009bc:	eb 17                	jmp    8009d5 <vprintfmt+0x71>
+			if (ch == '\0')
+  8009be:	85 db                	test   %ebx,%ebx
+  8009c0:	0f 84 97 05 00 00    	je     800f5d <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  8009c6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8009ca:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8009ce:	48 89 c6             	mov    %rax,%rsi
+  8009d1:	89 df                	mov    %ebx,%edi
+  8009d3:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8009d5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8009d9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009dd:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8009e1:	0f b6 00             	movzbl (%rax),%eax
+  8009e4:	0f b6 d8             	movzbl %al,%ebx
+  8009e7:	83 fb 25             	cmp    $0x25,%ebx
+  8009ea:	75 d2                	jne    8009be <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  8009ec:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  8009f0:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  8009f7:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  8009fe:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800a05:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800a0c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800a10:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a14:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800a18:	0f b6 00             	movzbl (%rax),%eax
+  800a1b:	0f b6 d8             	movzbl %al,%ebx
+  800a1e:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800a21:	83 f8 55             	cmp    $0x55,%eax
+  800a24:	0f 87 00 05 00 00    	ja     800f2a <vprintfmt+0x5c6>
+  800a2a:	89 c0                	mov    %eax,%eax
+  800a2c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800a33:	00 
+  800a34:	48 8d 05 b5 68 00 00 	lea    0x68b5(%rip),%rax        # 8072f0 <.LC18+0xc>
+  800a3b:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800a3f:	48 8d 15 aa 68 00 00 	lea    0x68aa(%rip),%rdx        # 8072f0 <.LC18+0xc>
+  800a46:	48 01 d0             	add    %rdx,%rax
+  800a49:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800a4b:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800a4f:	eb bb                	jmp    800a0c <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800a51:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800a55:	eb b5                	jmp    800a0c <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800a57:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800a5e:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800a61:	89 d0                	mov    %edx,%eax
+  800a63:	c1 e0 02             	shl    $0x2,%eax
+  800a66:	01 d0                	add    %edx,%eax
+  800a68:	01 c0                	add    %eax,%eax
+  800a6a:	01 d8                	add    %ebx,%eax
+  800a6c:	83 e8 30             	sub    $0x30,%eax
+  800a6f:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800a72:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800a76:	0f b6 00             	movzbl (%rax),%eax
+  800a79:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800a7c:	83 fb 2f             	cmp    $0x2f,%ebx
+  800a7f:	7e 60                	jle    800ae1 <vprintfmt+0x17d>
+  800a81:	83 fb 39             	cmp    $0x39,%ebx
+  800a84:	7f 5b                	jg     800ae1 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800a86:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800a8b:	eb d1                	jmp    800a5e <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800a8d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a90:	83 f8 2f             	cmp    $0x2f,%eax
+  800a93:	77 17                	ja     800aac <vprintfmt+0x148>
+  800a95:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a99:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a9c:	89 d2                	mov    %edx,%edx
+  800a9e:	48 01 d0             	add    %rdx,%rax
+  800aa1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800aa4:	83 c2 08             	add    $0x8,%edx
+  800aa7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800aaa:	eb 0c                	jmp    800ab8 <vprintfmt+0x154>
+  800aac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ab0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ab4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ab8:	8b 00                	mov    (%rax),%eax
+  800aba:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800abd:	eb 23                	jmp    800ae2 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800abf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ac3:	0f 89 43 ff ff ff    	jns    800a0c <vprintfmt+0xa8>
+				width = 0;
+  800ac9:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800ad0:	e9 37 ff ff ff       	jmp    800a0c <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800ad5:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800adc:	e9 2b ff ff ff       	jmp    800a0c <vprintfmt+0xa8>
+			goto process_precision;
+  800ae1:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800ae2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ae6:	0f 89 20 ff ff ff    	jns    800a0c <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800aec:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800aef:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800af2:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800af9:	e9 0e ff ff ff       	jmp    800a0c <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800afe:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800b02:	e9 05 ff ff ff       	jmp    800a0c <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800b07:	83 fb 39             	cmp    $0x39,%ebx
+  800b0a:	7f 0b                	jg     800b17 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800b0c:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800b0f:	c1 e0 08             	shl    $0x8,%eax
+  800b12:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800b15:	eb 21                	jmp    800b38 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800b17:	83 fb 60             	cmp    $0x60,%ebx
+  800b1a:	7e 10                	jle    800b2c <vprintfmt+0x1c8>
+  800b1c:	83 fb 66             	cmp    $0x66,%ebx
+  800b1f:	7f 0b                	jg     800b2c <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800b21:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800b24:	c1 e0 08             	shl    $0x8,%eax
+  800b27:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800b2a:	eb 0c                	jmp    800b38 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800b2c:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800b33:	e9 04 01 00 00       	jmp    800c3c <vprintfmt+0x2d8>
+  800b38:	e9 ff 00 00 00       	jmp    800c3c <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800b3d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b40:	83 f8 2f             	cmp    $0x2f,%eax
+  800b43:	77 17                	ja     800b5c <vprintfmt+0x1f8>
+  800b45:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b49:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b4c:	89 d2                	mov    %edx,%edx
+  800b4e:	48 01 d0             	add    %rdx,%rax
+  800b51:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b54:	83 c2 08             	add    $0x8,%edx
+  800b57:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b5a:	eb 0c                	jmp    800b68 <vprintfmt+0x204>
+  800b5c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b60:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b64:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b68:	8b 00                	mov    (%rax),%eax
+  800b6a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800b6e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800b72:	48 89 d6             	mov    %rdx,%rsi
+  800b75:	89 c7                	mov    %eax,%edi
+  800b77:	ff d1                	call   *%rcx
+			break;
+  800b79:	e9 da 03 00 00       	jmp    800f58 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800b7e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b81:	83 f8 2f             	cmp    $0x2f,%eax
+  800b84:	77 17                	ja     800b9d <vprintfmt+0x239>
+  800b86:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b8a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b8d:	89 d2                	mov    %edx,%edx
+  800b8f:	48 01 d0             	add    %rdx,%rax
+  800b92:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b95:	83 c2 08             	add    $0x8,%edx
+  800b98:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b9b:	eb 0c                	jmp    800ba9 <vprintfmt+0x245>
+  800b9d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ba1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ba5:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ba9:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800bab:	85 db                	test   %ebx,%ebx
+  800bad:	79 02                	jns    800bb1 <vprintfmt+0x24d>
+				err = -err;
+  800baf:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800bb1:	83 fb 15             	cmp    $0x15,%ebx
+  800bb4:	7f 19                	jg     800bcf <vprintfmt+0x26b>
+  800bb6:	48 ba 48 01 00 00 00 	movabs $0x148,%rdx
+  800bbd:	00 00 00 
+  800bc0:	48 63 c3             	movslq %ebx,%rax
+  800bc3:	4c 01 e2             	add    %r12,%rdx
+  800bc6:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800bca:	4d 85 ed             	test   %r13,%r13
+  800bcd:	75 36                	jne    800c05 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800bcf:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800bd3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bd7:	89 d9                	mov    %ebx,%ecx
+  800bd9:	48 ba a0 e2 ff ff ff 	movabs $0xffffffffffffe2a0,%rdx
+  800be0:	ff ff ff 
+  800be3:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800be7:	48 89 c7             	mov    %rax,%rdi
+  800bea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bef:	49 b8 33 7f ff ff ff 	movabs $0xffffffffffff7f33,%r8
+  800bf6:	ff ff ff 
+  800bf9:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800bfd:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800c00:	e9 53 03 00 00       	jmp    800f58 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800c05:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800c09:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c0d:	4c 89 e9             	mov    %r13,%rcx
+  800c10:	48 ba a9 e2 ff ff ff 	movabs $0xffffffffffffe2a9,%rdx
+  800c17:	ff ff ff 
+  800c1a:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800c1e:	48 89 c7             	mov    %rax,%rdi
+  800c21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c26:	49 b8 33 7f ff ff ff 	movabs $0xffffffffffff7f33,%r8
+  800c2d:	ff ff ff 
+  800c30:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800c34:	41 ff d0             	call   *%r8
+			break;
+  800c37:	e9 1c 03 00 00       	jmp    800f58 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800c3c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c42:	77 17                	ja     800c5b <vprintfmt+0x2f7>
+  800c44:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c48:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c4b:	89 d2                	mov    %edx,%edx
+  800c4d:	48 01 d0             	add    %rdx,%rax
+  800c50:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c53:	83 c2 08             	add    $0x8,%edx
+  800c56:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c59:	eb 0c                	jmp    800c67 <vprintfmt+0x303>
+  800c5b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c5f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c63:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c67:	4c 8b 28             	mov    (%rax),%r13
+  800c6a:	4d 85 ed             	test   %r13,%r13
+  800c6d:	75 0e                	jne    800c7d <vprintfmt+0x319>
+				p = "(null)";
+  800c6f:	48 b8 ac e2 ff ff ff 	movabs $0xffffffffffffe2ac,%rax
+  800c76:	ff ff ff 
+  800c79:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800c7d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c81:	0f 8e 84 00 00 00    	jle    800d0b <vprintfmt+0x3a7>
+  800c87:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800c8b:	74 7e                	je     800d0b <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c8d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800c90:	48 98                	cltq
+  800c92:	48 89 c6             	mov    %rax,%rsi
+  800c95:	4c 89 ef             	mov    %r13,%rdi
+  800c98:	4d 89 e7             	mov    %r12,%r15
+  800c9b:	48 b8 58 82 ff ff ff 	movabs $0xffffffffffff8258,%rax
+  800ca2:	ff ff ff 
+  800ca5:	4c 01 e0             	add    %r12,%rax
+  800ca8:	ff d0                	call   *%rax
+  800caa:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800cad:	eb 17                	jmp    800cc6 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800caf:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800cb3:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800cb7:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800cbb:	48 89 d6             	mov    %rdx,%rsi
+  800cbe:	89 c7                	mov    %eax,%edi
+  800cc0:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800cc2:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800cc6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800cca:	7f e3                	jg     800caf <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ccc:	eb 3d                	jmp    800d0b <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800cce:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800cd2:	74 1e                	je     800cf2 <vprintfmt+0x38e>
+  800cd4:	83 fb 1f             	cmp    $0x1f,%ebx
+  800cd7:	7e 05                	jle    800cde <vprintfmt+0x37a>
+  800cd9:	83 fb 7e             	cmp    $0x7e,%ebx
+  800cdc:	7e 14                	jle    800cf2 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800cde:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ce2:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ce6:	48 89 c6             	mov    %rax,%rsi
+  800ce9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800cee:	ff d2                	call   *%rdx
+  800cf0:	eb 15                	jmp    800d07 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800cf2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800cf5:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800cf8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cfc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d00:	48 89 c6             	mov    %rax,%rsi
+  800d03:	89 cf                	mov    %ecx,%edi
+  800d05:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d07:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800d0b:	4c 89 e8             	mov    %r13,%rax
+  800d0e:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800d12:	0f b6 00             	movzbl (%rax),%eax
+  800d15:	0f be d8             	movsbl %al,%ebx
+  800d18:	85 db                	test   %ebx,%ebx
+  800d1a:	74 28                	je     800d44 <vprintfmt+0x3e0>
+  800d1c:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800d20:	78 ac                	js     800cce <vprintfmt+0x36a>
+  800d22:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800d26:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800d2a:	79 a2                	jns    800cce <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800d2c:	eb 16                	jmp    800d44 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800d2e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d32:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d36:	48 89 c6             	mov    %rax,%rsi
+  800d39:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d3e:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800d40:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800d44:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d48:	7f e4                	jg     800d2e <vprintfmt+0x3ca>
+			break;
+  800d4a:	e9 09 02 00 00       	jmp    800f58 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800d4f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d53:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d57:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d5b:	0f b6 00             	movzbl (%rax),%eax
+  800d5e:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800d61:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800d62:	83 fb 2f             	cmp    $0x2f,%ebx
+  800d65:	0f 8e ac fd ff ff    	jle    800b17 <vprintfmt+0x1b3>
+  800d6b:	e9 97 fd ff ff       	jmp    800b07 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800d70:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d74:	be 03 00 00 00       	mov    $0x3,%esi
+  800d79:	48 89 c7             	mov    %rax,%rdi
+  800d7c:	48 b8 11 78 ff ff ff 	movabs $0xffffffffffff7811,%rax
+  800d83:	ff ff ff 
+  800d86:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d8a:	ff d0                	call   *%rax
+  800d8c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800d90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d94:	48 85 c0             	test   %rax,%rax
+  800d97:	79 1d                	jns    800db6 <vprintfmt+0x452>
+				putch('-', putdat);
+  800d99:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d9d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800da1:	48 89 c6             	mov    %rax,%rsi
+  800da4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800da9:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800dab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800daf:	48 f7 d8             	neg    %rax
+  800db2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800db6:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800dbd:	e9 de 00 00 00       	jmp    800ea0 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800dc2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800dc6:	be 03 00 00 00       	mov    $0x3,%esi
+  800dcb:	48 89 c7             	mov    %rax,%rdi
+  800dce:	48 b8 b0 76 ff ff ff 	movabs $0xffffffffffff76b0,%rax
+  800dd5:	ff ff ff 
+  800dd8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ddc:	ff d0                	call   *%rax
+  800dde:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800de2:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800de9:	e9 b2 00 00 00       	jmp    800ea0 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800dee:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800df2:	be 03 00 00 00       	mov    $0x3,%esi
+  800df7:	48 89 c7             	mov    %rax,%rdi
+  800dfa:	48 b8 b0 76 ff ff ff 	movabs $0xffffffffffff76b0,%rax
+  800e01:	ff ff ff 
+  800e04:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e08:	ff d0                	call   *%rax
+  800e0a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800e0e:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800e15:	e9 86 00 00 00       	jmp    800ea0 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800e1a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e1e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e22:	48 89 c6             	mov    %rax,%rsi
+  800e25:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e2a:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800e2c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e30:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e34:	48 89 c6             	mov    %rax,%rsi
+  800e37:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e3c:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800e3e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e41:	83 f8 2f             	cmp    $0x2f,%eax
+  800e44:	77 17                	ja     800e5d <vprintfmt+0x4f9>
+  800e46:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e4a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e4d:	89 d2                	mov    %edx,%edx
+  800e4f:	48 01 d0             	add    %rdx,%rax
+  800e52:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e55:	83 c2 08             	add    $0x8,%edx
+  800e58:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e5b:	eb 0c                	jmp    800e69 <vprintfmt+0x505>
+  800e5d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e61:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e65:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e69:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800e6c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800e70:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800e77:	eb 27                	jmp    800ea0 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800e79:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e7d:	be 03 00 00 00       	mov    $0x3,%esi
+  800e82:	48 89 c7             	mov    %rax,%rdi
+  800e85:	48 b8 b0 76 ff ff ff 	movabs $0xffffffffffff76b0,%rax
+  800e8c:	ff ff ff 
+  800e8f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e93:	ff d0                	call   *%rax
+  800e95:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800e99:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800ea0:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800ea5:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800ea8:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800eab:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800eaf:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800eb3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800eb7:	45 89 c1             	mov    %r8d,%r9d
+  800eba:	41 89 f8             	mov    %edi,%r8d
+  800ebd:	48 89 c7             	mov    %rax,%rdi
+  800ec0:	48 b8 d8 75 ff ff ff 	movabs $0xffffffffffff75d8,%rax
+  800ec7:	ff ff ff 
+  800eca:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ece:	ff d0                	call   *%rax
+			break;
+  800ed0:	e9 83 00 00 00       	jmp    800f58 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800ed5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ed9:	be 03 00 00 00       	mov    $0x3,%esi
+  800ede:	48 89 c7             	mov    %rax,%rdi
+  800ee1:	48 b8 b0 76 ff ff ff 	movabs $0xffffffffffff76b0,%rax
+  800ee8:	ff ff ff 
+  800eeb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800eef:	ff d0                	call   *%rax
+  800ef1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800ef5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800ef9:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800efd:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f01:	48 89 ce             	mov    %rcx,%rsi
+  800f04:	48 89 c7             	mov    %rax,%rdi
+  800f07:	48 b8 cb 77 ff ff ff 	movabs $0xffffffffffff77cb,%rax
+  800f0e:	ff ff ff 
+  800f11:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f15:	ff d0                	call   *%rax
+	
+			break;
+  800f17:	eb 3f                	jmp    800f58 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800f19:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f1d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f21:	48 89 c6             	mov    %rax,%rsi
+  800f24:	89 df                	mov    %ebx,%edi
+  800f26:	ff d2                	call   *%rdx
+			break;
+  800f28:	eb 2e                	jmp    800f58 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800f2a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f2e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f32:	48 89 c6             	mov    %rax,%rsi
+  800f35:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f3a:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800f3c:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800f41:	eb 05                	jmp    800f48 <vprintfmt+0x5e4>
+  800f43:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800f48:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f4c:	48 83 e8 01          	sub    $0x1,%rax
+  800f50:	0f b6 00             	movzbl (%rax),%eax
+  800f53:	3c 25                	cmp    $0x25,%al
+  800f55:	75 ec                	jne    800f43 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800f57:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f58:	e9 78 fa ff ff       	jmp    8009d5 <vprintfmt+0x71>
+				return;
+  800f5d:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800f5e:	48 83 c4 60          	add    $0x60,%rsp
+  800f62:	5b                   	pop    %rbx
+  800f63:	41 5c                	pop    %r12
+  800f65:	41 5d                	pop    %r13
+  800f67:	41 5f                	pop    %r15
+  800f69:	5d                   	pop    %rbp
+  800f6a:	c3                   	ret
+
+0000000000800f6b <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  800f6b:	55                   	push   %rbp
+  800f6c:	48 89 e5             	mov    %rsp,%rbp
+  800f6f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f76:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800f76 <printfmt+0xb>
+  800f7d:	49 bb c2 80 00 00 00 	movabs $0x80c2,%r11
+  800f84:	00 00 00 
+  800f87:	4d 01 da             	add    %r11,%r10
+  800f8a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f91:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f98:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f9f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800fa6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800fad:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800fb4:	84 c0                	test   %al,%al
+  800fb6:	74 20                	je     800fd8 <printfmt+0x6d>
+  800fb8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800fbc:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800fc0:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800fc4:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800fc8:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800fcc:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800fd0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800fd4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800fd8:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800fdf:	00 00 00 
+  800fe2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800fe9:	00 00 00 
+  800fec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ff0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800ff7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ffe:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801005:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80100c:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801013:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80101a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801021:	48 89 c7             	mov    %rax,%rdi
+  801024:	48 b8 2c 79 ff ff ff 	movabs $0xffffffffffff792c,%rax
+  80102b:	ff ff ff 
+  80102e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801032:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801034:	90                   	nop
+  801035:	c9                   	leave
+  801036:	c3                   	ret
+
+0000000000801037 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801037:	55                   	push   %rbp
+  801038:	48 89 e5             	mov    %rsp,%rbp
+  80103b:	48 83 ec 10          	sub    $0x10,%rsp
+  80103f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80103f <sprintputch+0x8>
+  801046:	49 bb f9 7f 00 00 00 	movabs $0x7ff9,%r11
+  80104d:	00 00 00 
+  801050:	4c 01 d8             	add    %r11,%rax
+  801053:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801056:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80105a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80105e:	8b 40 10             	mov    0x10(%rax),%eax
+  801061:	8d 50 01             	lea    0x1(%rax),%edx
+  801064:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801068:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80106b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80106f:	48 8b 10             	mov    (%rax),%rdx
+  801072:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801076:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80107a:	48 39 c2             	cmp    %rax,%rdx
+  80107d:	73 17                	jae    801096 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80107f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801083:	48 8b 00             	mov    (%rax),%rax
+  801086:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80108a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80108e:	48 89 0a             	mov    %rcx,(%rdx)
+  801091:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801094:	88 10                	mov    %dl,(%rax)
+}
+  801096:	90                   	nop
+  801097:	c9                   	leave
+  801098:	c3                   	ret
+
+0000000000801099 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801099:	55                   	push   %rbp
+  80109a:	48 89 e5             	mov    %rsp,%rbp
+  80109d:	53                   	push   %rbx
+  80109e:	48 83 ec 58          	sub    $0x58,%rsp
+  8010a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8010a2 <vsnprintf+0x9>
+  8010a9:	49 bb 96 7f 00 00 00 	movabs $0x7f96,%r11
+  8010b0:	00 00 00 
+  8010b3:	4c 01 d8             	add    %r11,%rax
+  8010b6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8010ba:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8010bd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8010c1:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8010c5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8010c9:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8010cd:	48 8b 0e             	mov    (%rsi),%rcx
+  8010d0:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8010d4:	48 89 0a             	mov    %rcx,(%rdx)
+  8010d7:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8010db:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8010df:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8010e3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8010e7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8010eb:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8010ee:	48 63 d2             	movslq %edx,%rdx
+  8010f1:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8010f5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8010f9:	48 01 ca             	add    %rcx,%rdx
+  8010fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801100:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801107:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80110c:	74 06                	je     801114 <vsnprintf+0x7b>
+  80110e:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801112:	7f 07                	jg     80111b <vsnprintf+0x82>
+		return -E_INVAL;
+  801114:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801119:	eb 34                	jmp    80114f <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80111b:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  80111f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801123:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801127:	48 bf ff 7f ff ff ff 	movabs $0xffffffffffff7fff,%rdi
+  80112e:	ff ff ff 
+  801131:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801135:	49 b8 2c 79 ff ff ff 	movabs $0xffffffffffff792c,%r8
+  80113c:	ff ff ff 
+  80113f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801143:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801145:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801149:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80114c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80114f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801153:	c9                   	leave
+  801154:	c3                   	ret
+
+0000000000801155 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801155:	55                   	push   %rbp
+  801156:	48 89 e5             	mov    %rsp,%rbp
+  801159:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801160:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801160 <snprintf+0xb>
+  801167:	49 bb d8 7e 00 00 00 	movabs $0x7ed8,%r11
+  80116e:	00 00 00 
+  801171:	4d 01 da             	add    %r11,%r10
+  801174:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80117b:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801181:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801188:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80118f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801196:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80119d:	84 c0                	test   %al,%al
+  80119f:	74 20                	je     8011c1 <snprintf+0x6c>
+  8011a1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8011a5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8011a9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8011ad:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8011b1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8011b5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8011b9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8011bd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8011c1:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8011c8:	00 00 00 
+  8011cb:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8011d2:	00 00 00 
+  8011d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011d9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8011e0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8011e7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8011ee:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8011f5:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8011fc:	48 8b 06             	mov    (%rsi),%rax
+  8011ff:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801203:	48 89 01             	mov    %rax,(%rcx)
+  801206:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80120a:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80120e:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801212:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801219:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801220:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801226:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80122d:	48 89 c7             	mov    %rax,%rdi
+  801230:	48 b8 61 80 ff ff ff 	movabs $0xffffffffffff8061,%rax
+  801237:	ff ff ff 
+  80123a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80123e:	ff d0                	call   *%rax
+  801240:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801246:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80124c:	c9                   	leave
+  80124d:	c3                   	ret
+
+000000000080124e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80124e:	55                   	push   %rbp
+  80124f:	48 89 e5             	mov    %rsp,%rbp
+  801252:	48 83 ec 18          	sub    $0x18,%rsp
+  801256:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801256 <strlen+0x8>
+  80125d:	49 bb e2 7d 00 00 00 	movabs $0x7de2,%r11
+  801264:	00 00 00 
+  801267:	4c 01 d8             	add    %r11,%rax
+  80126a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80126e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801275:	eb 09                	jmp    801280 <strlen+0x32>
+		n++;
+  801277:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  80127b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801280:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801284:	0f b6 00             	movzbl (%rax),%eax
+  801287:	84 c0                	test   %al,%al
+  801289:	75 ec                	jne    801277 <strlen+0x29>
+	return n;
+  80128b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80128e:	c9                   	leave
+  80128f:	c3                   	ret
+
+0000000000801290 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801290:	55                   	push   %rbp
+  801291:	48 89 e5             	mov    %rsp,%rbp
+  801294:	48 83 ec 20          	sub    $0x20,%rsp
+  801298:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801298 <strnlen+0x8>
+  80129f:	49 bb a0 7d 00 00 00 	movabs $0x7da0,%r11
+  8012a6:	00 00 00 
+  8012a9:	4c 01 d8             	add    %r11,%rax
+  8012ac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012b0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8012b4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8012bb:	eb 0e                	jmp    8012cb <strnlen+0x3b>
+		n++;
+  8012bd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8012c1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8012c6:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8012cb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8012d0:	74 0b                	je     8012dd <strnlen+0x4d>
+  8012d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012d6:	0f b6 00             	movzbl (%rax),%eax
+  8012d9:	84 c0                	test   %al,%al
+  8012db:	75 e0                	jne    8012bd <strnlen+0x2d>
+	return n;
+  8012dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8012e0:	c9                   	leave
+  8012e1:	c3                   	ret
+
+00000000008012e2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+  8012e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8012ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012ea <strcpy+0x8>
+  8012f1:	49 bb 4e 7d 00 00 00 	movabs $0x7d4e,%r11
+  8012f8:	00 00 00 
+  8012fb:	4c 01 d8             	add    %r11,%rax
+  8012fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801302:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801306:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80130a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80130e:	90                   	nop
+  80130f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801313:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801317:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80131b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80131f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801323:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801327:	0f b6 12             	movzbl (%rdx),%edx
+  80132a:	88 10                	mov    %dl,(%rax)
+  80132c:	0f b6 00             	movzbl (%rax),%eax
+  80132f:	84 c0                	test   %al,%al
+  801331:	75 dc                	jne    80130f <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801333:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801337:	c9                   	leave
+  801338:	c3                   	ret
+
+0000000000801339 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801339:	55                   	push   %rbp
+  80133a:	48 89 e5             	mov    %rsp,%rbp
+  80133d:	53                   	push   %rbx
+  80133e:	48 83 ec 20          	sub    $0x20,%rsp
+  801342:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801342 <strcat+0x9>
+  801349:	49 bb f6 7c 00 00 00 	movabs $0x7cf6,%r11
+  801350:	00 00 00 
+  801353:	4c 01 db             	add    %r11,%rbx
+  801356:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80135a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80135e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801362:	48 89 c7             	mov    %rax,%rdi
+  801365:	48 b8 16 82 ff ff ff 	movabs $0xffffffffffff8216,%rax
+  80136c:	ff ff ff 
+  80136f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801373:	ff d0                	call   *%rax
+  801375:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801378:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80137b:	48 63 d0             	movslq %eax,%rdx
+  80137e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801382:	48 01 c2             	add    %rax,%rdx
+  801385:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801389:	48 89 c6             	mov    %rax,%rsi
+  80138c:	48 89 d7             	mov    %rdx,%rdi
+  80138f:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  801396:	ff ff ff 
+  801399:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80139d:	ff d0                	call   *%rax
+	return dst;
+  80139f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8013a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a7:	c9                   	leave
+  8013a8:	c3                   	ret
+
+00000000008013a9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8013a9:	55                   	push   %rbp
+  8013aa:	48 89 e5             	mov    %rsp,%rbp
+  8013ad:	48 83 ec 28          	sub    $0x28,%rsp
+  8013b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013b1 <strncpy+0x8>
+  8013b8:	49 bb 87 7c 00 00 00 	movabs $0x7c87,%r11
+  8013bf:	00 00 00 
+  8013c2:	4c 01 d8             	add    %r11,%rax
+  8013c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013c9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013cd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8013d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013d5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8013d9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8013e0:	00 
+  8013e1:	eb 2a                	jmp    80140d <strncpy+0x64>
+		*dst++ = *src;
+  8013e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013e7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8013eb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8013ef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013f3:	0f b6 12             	movzbl (%rdx),%edx
+  8013f6:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8013f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013fc:	0f b6 00             	movzbl (%rax),%eax
+  8013ff:	84 c0                	test   %al,%al
+  801401:	74 05                	je     801408 <strncpy+0x5f>
+			src++;
+  801403:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801408:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80140d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801411:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801415:	72 cc                	jb     8013e3 <strncpy+0x3a>
+	}
+	return ret;
+  801417:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80141b:	c9                   	leave
+  80141c:	c3                   	ret
+
+000000000080141d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80141d:	55                   	push   %rbp
+  80141e:	48 89 e5             	mov    %rsp,%rbp
+  801421:	48 83 ec 28          	sub    $0x28,%rsp
+  801425:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801425 <strlcpy+0x8>
+  80142c:	49 bb 13 7c 00 00 00 	movabs $0x7c13,%r11
+  801433:	00 00 00 
+  801436:	4c 01 d8             	add    %r11,%rax
+  801439:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80143d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801441:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801445:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801449:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80144d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801452:	74 3d                	je     801491 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801454:	eb 1d                	jmp    801473 <strlcpy+0x56>
+			*dst++ = *src++;
+  801456:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80145a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80145e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801462:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801466:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80146a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80146e:	0f b6 12             	movzbl (%rdx),%edx
+  801471:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801473:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801478:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80147d:	74 0b                	je     80148a <strlcpy+0x6d>
+  80147f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801483:	0f b6 00             	movzbl (%rax),%eax
+  801486:	84 c0                	test   %al,%al
+  801488:	75 cc                	jne    801456 <strlcpy+0x39>
+		*dst = '\0';
+  80148a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80148e:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801491:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801495:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801499:	c9                   	leave
+  80149a:	c3                   	ret
+
+000000000080149b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 10          	sub    $0x10,%rsp
+  8014a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014a3 <strcmp+0x8>
+  8014aa:	49 bb 95 7b 00 00 00 	movabs $0x7b95,%r11
+  8014b1:	00 00 00 
+  8014b4:	4c 01 d8             	add    %r11,%rax
+  8014b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8014bf:	eb 0a                	jmp    8014cb <strcmp+0x30>
+		p++, q++;
+  8014c1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014c6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8014cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014cf:	0f b6 00             	movzbl (%rax),%eax
+  8014d2:	84 c0                	test   %al,%al
+  8014d4:	74 12                	je     8014e8 <strcmp+0x4d>
+  8014d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014da:	0f b6 10             	movzbl (%rax),%edx
+  8014dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014e1:	0f b6 00             	movzbl (%rax),%eax
+  8014e4:	38 c2                	cmp    %al,%dl
+  8014e6:	74 d9                	je     8014c1 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8014e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014ec:	0f b6 00             	movzbl (%rax),%eax
+  8014ef:	0f b6 d0             	movzbl %al,%edx
+  8014f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014f6:	0f b6 00             	movzbl (%rax),%eax
+  8014f9:	0f b6 c0             	movzbl %al,%eax
+  8014fc:	29 c2                	sub    %eax,%edx
+  8014fe:	89 d0                	mov    %edx,%eax
+}
+  801500:	c9                   	leave
+  801501:	c3                   	ret
+
+0000000000801502 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801502:	55                   	push   %rbp
+  801503:	48 89 e5             	mov    %rsp,%rbp
+  801506:	48 83 ec 18          	sub    $0x18,%rsp
+  80150a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80150a <strncmp+0x8>
+  801511:	49 bb 2e 7b 00 00 00 	movabs $0x7b2e,%r11
+  801518:	00 00 00 
+  80151b:	4c 01 d8             	add    %r11,%rax
+  80151e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801522:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801526:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80152a:	eb 0f                	jmp    80153b <strncmp+0x39>
+		n--, p++, q++;
+  80152c:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801531:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801536:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80153b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801540:	74 1d                	je     80155f <strncmp+0x5d>
+  801542:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801546:	0f b6 00             	movzbl (%rax),%eax
+  801549:	84 c0                	test   %al,%al
+  80154b:	74 12                	je     80155f <strncmp+0x5d>
+  80154d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801551:	0f b6 10             	movzbl (%rax),%edx
+  801554:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801558:	0f b6 00             	movzbl (%rax),%eax
+  80155b:	38 c2                	cmp    %al,%dl
+  80155d:	74 cd                	je     80152c <strncmp+0x2a>
+	if (n == 0)
+  80155f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801564:	75 07                	jne    80156d <strncmp+0x6b>
+		return 0;
+  801566:	ba 00 00 00 00       	mov    $0x0,%edx
+  80156b:	eb 16                	jmp    801583 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80156d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801571:	0f b6 00             	movzbl (%rax),%eax
+  801574:	0f b6 d0             	movzbl %al,%edx
+  801577:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80157b:	0f b6 00             	movzbl (%rax),%eax
+  80157e:	0f b6 c0             	movzbl %al,%eax
+  801581:	29 c2                	sub    %eax,%edx
+}
+  801583:	89 d0                	mov    %edx,%eax
+  801585:	c9                   	leave
+  801586:	c3                   	ret
+
+0000000000801587 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801587:	55                   	push   %rbp
+  801588:	48 89 e5             	mov    %rsp,%rbp
+  80158b:	48 83 ec 10          	sub    $0x10,%rsp
+  80158f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80158f <strchr+0x8>
+  801596:	49 bb a9 7a 00 00 00 	movabs $0x7aa9,%r11
+  80159d:	00 00 00 
+  8015a0:	4c 01 d8             	add    %r11,%rax
+  8015a3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015a7:	89 f0                	mov    %esi,%eax
+  8015a9:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8015ac:	eb 17                	jmp    8015c5 <strchr+0x3e>
+		if (*s == c)
+  8015ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015b2:	0f b6 00             	movzbl (%rax),%eax
+  8015b5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8015b8:	75 06                	jne    8015c0 <strchr+0x39>
+			return (char *) s;
+  8015ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015be:	eb 15                	jmp    8015d5 <strchr+0x4e>
+	for (; *s; s++)
+  8015c0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015c9:	0f b6 00             	movzbl (%rax),%eax
+  8015cc:	84 c0                	test   %al,%al
+  8015ce:	75 de                	jne    8015ae <strchr+0x27>
+	return 0;
+  8015d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d5:	c9                   	leave
+  8015d6:	c3                   	ret
+
+00000000008015d7 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8015d7:	55                   	push   %rbp
+  8015d8:	48 89 e5             	mov    %rsp,%rbp
+  8015db:	48 83 ec 10          	sub    $0x10,%rsp
+  8015df:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015df <strfind+0x8>
+  8015e6:	49 bb 59 7a 00 00 00 	movabs $0x7a59,%r11
+  8015ed:	00 00 00 
+  8015f0:	4c 01 d8             	add    %r11,%rax
+  8015f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015f7:	89 f0                	mov    %esi,%eax
+  8015f9:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8015fc:	eb 11                	jmp    80160f <strfind+0x38>
+		if (*s == c)
+  8015fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801602:	0f b6 00             	movzbl (%rax),%eax
+  801605:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801608:	74 12                	je     80161c <strfind+0x45>
+	for (; *s; s++)
+  80160a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80160f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801613:	0f b6 00             	movzbl (%rax),%eax
+  801616:	84 c0                	test   %al,%al
+  801618:	75 e4                	jne    8015fe <strfind+0x27>
+  80161a:	eb 01                	jmp    80161d <strfind+0x46>
+			break;
+  80161c:	90                   	nop
+	return (char *) s;
+  80161d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801621:	c9                   	leave
+  801622:	c3                   	ret
+
+0000000000801623 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801623:	55                   	push   %rbp
+  801624:	48 89 e5             	mov    %rsp,%rbp
+  801627:	48 83 ec 18          	sub    $0x18,%rsp
+  80162b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80162b <memset+0x8>
+  801632:	49 bb 0d 7a 00 00 00 	movabs $0x7a0d,%r11
+  801639:	00 00 00 
+  80163c:	4c 01 d8             	add    %r11,%rax
+  80163f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801643:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801646:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80164a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80164f:	75 06                	jne    801657 <memset+0x34>
+		return v;
+  801651:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801655:	eb 69                	jmp    8016c0 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801657:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80165b:	83 e0 03             	and    $0x3,%eax
+  80165e:	48 85 c0             	test   %rax,%rax
+  801661:	75 48                	jne    8016ab <memset+0x88>
+  801663:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801667:	83 e0 03             	and    $0x3,%eax
+  80166a:	48 85 c0             	test   %rax,%rax
+  80166d:	75 3c                	jne    8016ab <memset+0x88>
+		c &= 0xFF;
+  80166f:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801676:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801679:	c1 e0 18             	shl    $0x18,%eax
+  80167c:	89 c2                	mov    %eax,%edx
+  80167e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801681:	c1 e0 10             	shl    $0x10,%eax
+  801684:	09 c2                	or     %eax,%edx
+  801686:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801689:	c1 e0 08             	shl    $0x8,%eax
+  80168c:	09 d0                	or     %edx,%eax
+  80168e:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801691:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801695:	48 c1 e8 02          	shr    $0x2,%rax
+  801699:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  80169c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016a0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016a3:	48 89 d7             	mov    %rdx,%rdi
+  8016a6:	fc                   	cld
+  8016a7:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8016a9:	eb 11                	jmp    8016bc <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8016ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8016af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016b2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8016b6:	48 89 d7             	mov    %rdx,%rdi
+  8016b9:	fc                   	cld
+  8016ba:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8016bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016c0:	c9                   	leave
+  8016c1:	c3                   	ret
+
+00000000008016c2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8016c2:	55                   	push   %rbp
+  8016c3:	48 89 e5             	mov    %rsp,%rbp
+  8016c6:	48 83 ec 28          	sub    $0x28,%rsp
+  8016ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016ca <memmove+0x8>
+  8016d1:	49 bb 6e 79 00 00 00 	movabs $0x796e,%r11
+  8016d8:	00 00 00 
+  8016db:	4c 01 d8             	add    %r11,%rax
+  8016de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016e6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8016ea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8016f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016f6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8016fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016fe:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801702:	0f 83 88 00 00 00    	jae    801790 <memmove+0xce>
+  801708:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80170c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801710:	48 01 d0             	add    %rdx,%rax
+  801713:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801717:	73 77                	jae    801790 <memmove+0xce>
+		s += n;
+  801719:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80171d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801721:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801725:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80172d:	83 e0 03             	and    $0x3,%eax
+  801730:	48 85 c0             	test   %rax,%rax
+  801733:	75 3b                	jne    801770 <memmove+0xae>
+  801735:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801739:	83 e0 03             	and    $0x3,%eax
+  80173c:	48 85 c0             	test   %rax,%rax
+  80173f:	75 2f                	jne    801770 <memmove+0xae>
+  801741:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801745:	83 e0 03             	and    $0x3,%eax
+  801748:	48 85 c0             	test   %rax,%rax
+  80174b:	75 23                	jne    801770 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80174d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801751:	48 83 e8 04          	sub    $0x4,%rax
+  801755:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801759:	48 83 ea 04          	sub    $0x4,%rdx
+  80175d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801761:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801765:	48 89 c7             	mov    %rax,%rdi
+  801768:	48 89 d6             	mov    %rdx,%rsi
+  80176b:	fd                   	std
+  80176c:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80176e:	eb 1d                	jmp    80178d <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801770:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801774:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801778:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80177c:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801780:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801784:	48 89 d7             	mov    %rdx,%rdi
+  801787:	48 89 c1             	mov    %rax,%rcx
+  80178a:	fd                   	std
+  80178b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  80178d:	fc                   	cld
+  80178e:	eb 57                	jmp    8017e7 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801794:	83 e0 03             	and    $0x3,%eax
+  801797:	48 85 c0             	test   %rax,%rax
+  80179a:	75 36                	jne    8017d2 <memmove+0x110>
+  80179c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017a0:	83 e0 03             	and    $0x3,%eax
+  8017a3:	48 85 c0             	test   %rax,%rax
+  8017a6:	75 2a                	jne    8017d2 <memmove+0x110>
+  8017a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ac:	83 e0 03             	and    $0x3,%eax
+  8017af:	48 85 c0             	test   %rax,%rax
+  8017b2:	75 1e                	jne    8017d2 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8017b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017b8:	48 c1 e8 02          	shr    $0x2,%rax
+  8017bc:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8017bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017c7:	48 89 c7             	mov    %rax,%rdi
+  8017ca:	48 89 d6             	mov    %rdx,%rsi
+  8017cd:	fc                   	cld
+  8017ce:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8017d0:	eb 15                	jmp    8017e7 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8017d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017da:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8017de:	48 89 c7             	mov    %rax,%rdi
+  8017e1:	48 89 d6             	mov    %rdx,%rsi
+  8017e4:	fc                   	cld
+  8017e5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  8017e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8017eb:	c9                   	leave
+  8017ec:	c3                   	ret
+
+00000000008017ed <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8017ed:	55                   	push   %rbp
+  8017ee:	48 89 e5             	mov    %rsp,%rbp
+  8017f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8017f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017f5 <memcpy+0x8>
+  8017fc:	49 bb 43 78 00 00 00 	movabs $0x7843,%r11
+  801803:	00 00 00 
+  801806:	4c 01 d8             	add    %r11,%rax
+  801809:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80180d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801811:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801815:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801819:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80181d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801821:	48 89 cf             	mov    %rcx,%rdi
+  801824:	48 b9 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rcx
+  80182b:	ff ff ff 
+  80182e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801832:	ff d0                	call   *%rax
+}
+  801834:	c9                   	leave
+  801835:	c3                   	ret
+
+0000000000801836 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801836:	55                   	push   %rbp
+  801837:	48 89 e5             	mov    %rsp,%rbp
+  80183a:	48 83 ec 28          	sub    $0x28,%rsp
+  80183e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80183e <memcmp+0x8>
+  801845:	49 bb fa 77 00 00 00 	movabs $0x77fa,%r11
+  80184c:	00 00 00 
+  80184f:	4c 01 d8             	add    %r11,%rax
+  801852:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801856:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80185a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80185e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801862:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801866:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80186a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  80186e:	eb 34                	jmp    8018a4 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801870:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801874:	0f b6 10             	movzbl (%rax),%edx
+  801877:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80187b:	0f b6 00             	movzbl (%rax),%eax
+  80187e:	38 c2                	cmp    %al,%dl
+  801880:	74 18                	je     80189a <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801882:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801886:	0f b6 00             	movzbl (%rax),%eax
+  801889:	0f b6 d0             	movzbl %al,%edx
+  80188c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801890:	0f b6 00             	movzbl (%rax),%eax
+  801893:	0f b6 c0             	movzbl %al,%eax
+  801896:	29 c2                	sub    %eax,%edx
+  801898:	eb 20                	jmp    8018ba <memcmp+0x84>
+		s1++, s2++;
+  80189a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80189f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8018a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018ac:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8018b0:	48 85 c0             	test   %rax,%rax
+  8018b3:	75 bb                	jne    801870 <memcmp+0x3a>
+	}
+
+	return 0;
+  8018b5:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8018ba:	89 d0                	mov    %edx,%eax
+  8018bc:	c9                   	leave
+  8018bd:	c3                   	ret
+
+00000000008018be <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8018be:	55                   	push   %rbp
+  8018bf:	48 89 e5             	mov    %rsp,%rbp
+  8018c2:	48 83 ec 28          	sub    $0x28,%rsp
+  8018c6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018c6 <memfind+0x8>
+  8018cd:	49 bb 72 77 00 00 00 	movabs $0x7772,%r11
+  8018d4:	00 00 00 
+  8018d7:	4c 01 d8             	add    %r11,%rax
+  8018da:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018de:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8018e1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8018e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018ed:	48 01 d0             	add    %rdx,%rax
+  8018f0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  8018f4:	eb 13                	jmp    801909 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8018f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018fa:	0f b6 00             	movzbl (%rax),%eax
+  8018fd:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801900:	38 d0                	cmp    %dl,%al
+  801902:	74 11                	je     801915 <memfind+0x57>
+	for (; s < ends; s++)
+  801904:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801909:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80190d:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801911:	72 e3                	jb     8018f6 <memfind+0x38>
+  801913:	eb 01                	jmp    801916 <memfind+0x58>
+			break;
+  801915:	90                   	nop
+	return (void *) s;
+  801916:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80191a:	c9                   	leave
+  80191b:	c3                   	ret
+
+000000000080191c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80191c:	55                   	push   %rbp
+  80191d:	48 89 e5             	mov    %rsp,%rbp
+  801920:	48 83 ec 38          	sub    $0x38,%rsp
+  801924:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801924 <strtol+0x8>
+  80192b:	49 bb 14 77 00 00 00 	movabs $0x7714,%r11
+  801932:	00 00 00 
+  801935:	4c 01 d8             	add    %r11,%rax
+  801938:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80193c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801940:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801943:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  80194a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801951:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801952:	eb 05                	jmp    801959 <strtol+0x3d>
+		s++;
+  801954:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801959:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80195d:	0f b6 00             	movzbl (%rax),%eax
+  801960:	3c 20                	cmp    $0x20,%al
+  801962:	74 f0                	je     801954 <strtol+0x38>
+  801964:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801968:	0f b6 00             	movzbl (%rax),%eax
+  80196b:	3c 09                	cmp    $0x9,%al
+  80196d:	74 e5                	je     801954 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  80196f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801973:	0f b6 00             	movzbl (%rax),%eax
+  801976:	3c 2b                	cmp    $0x2b,%al
+  801978:	75 07                	jne    801981 <strtol+0x65>
+		s++;
+  80197a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80197f:	eb 17                	jmp    801998 <strtol+0x7c>
+	else if (*s == '-')
+  801981:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801985:	0f b6 00             	movzbl (%rax),%eax
+  801988:	3c 2d                	cmp    $0x2d,%al
+  80198a:	75 0c                	jne    801998 <strtol+0x7c>
+		s++, neg = 1;
+  80198c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801991:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801998:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80199c:	74 06                	je     8019a4 <strtol+0x88>
+  80199e:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8019a2:	75 28                	jne    8019cc <strtol+0xb0>
+  8019a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019a8:	0f b6 00             	movzbl (%rax),%eax
+  8019ab:	3c 30                	cmp    $0x30,%al
+  8019ad:	75 1d                	jne    8019cc <strtol+0xb0>
+  8019af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b3:	48 83 c0 01          	add    $0x1,%rax
+  8019b7:	0f b6 00             	movzbl (%rax),%eax
+  8019ba:	3c 78                	cmp    $0x78,%al
+  8019bc:	75 0e                	jne    8019cc <strtol+0xb0>
+		s += 2, base = 16;
+  8019be:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8019c3:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8019ca:	eb 2c                	jmp    8019f8 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  8019cc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019d0:	75 19                	jne    8019eb <strtol+0xcf>
+  8019d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d6:	0f b6 00             	movzbl (%rax),%eax
+  8019d9:	3c 30                	cmp    $0x30,%al
+  8019db:	75 0e                	jne    8019eb <strtol+0xcf>
+		s++, base = 8;
+  8019dd:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019e2:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8019e9:	eb 0d                	jmp    8019f8 <strtol+0xdc>
+	else if (base == 0)
+  8019eb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019ef:	75 07                	jne    8019f8 <strtol+0xdc>
+		base = 10;
+  8019f1:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  8019f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019fc:	0f b6 00             	movzbl (%rax),%eax
+  8019ff:	3c 2f                	cmp    $0x2f,%al
+  801a01:	7e 1d                	jle    801a20 <strtol+0x104>
+  801a03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a07:	0f b6 00             	movzbl (%rax),%eax
+  801a0a:	3c 39                	cmp    $0x39,%al
+  801a0c:	7f 12                	jg     801a20 <strtol+0x104>
+			dig = *s - '0';
+  801a0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a12:	0f b6 00             	movzbl (%rax),%eax
+  801a15:	0f be c0             	movsbl %al,%eax
+  801a18:	83 e8 30             	sub    $0x30,%eax
+  801a1b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a1e:	eb 4e                	jmp    801a6e <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801a20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a24:	0f b6 00             	movzbl (%rax),%eax
+  801a27:	3c 60                	cmp    $0x60,%al
+  801a29:	7e 1d                	jle    801a48 <strtol+0x12c>
+  801a2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a2f:	0f b6 00             	movzbl (%rax),%eax
+  801a32:	3c 7a                	cmp    $0x7a,%al
+  801a34:	7f 12                	jg     801a48 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801a36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a3a:	0f b6 00             	movzbl (%rax),%eax
+  801a3d:	0f be c0             	movsbl %al,%eax
+  801a40:	83 e8 57             	sub    $0x57,%eax
+  801a43:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801a46:	eb 26                	jmp    801a6e <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801a48:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a4c:	0f b6 00             	movzbl (%rax),%eax
+  801a4f:	3c 40                	cmp    $0x40,%al
+  801a51:	7e 47                	jle    801a9a <strtol+0x17e>
+  801a53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a57:	0f b6 00             	movzbl (%rax),%eax
+  801a5a:	3c 5a                	cmp    $0x5a,%al
+  801a5c:	7f 3c                	jg     801a9a <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801a5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a62:	0f b6 00             	movzbl (%rax),%eax
+  801a65:	0f be c0             	movsbl %al,%eax
+  801a68:	83 e8 37             	sub    $0x37,%eax
+  801a6b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801a6e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a71:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801a74:	7d 23                	jge    801a99 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801a76:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a7b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801a7e:	48 98                	cltq
+  801a80:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801a85:	48 89 c2             	mov    %rax,%rdx
+  801a88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a8b:	48 98                	cltq
+  801a8d:	48 01 d0             	add    %rdx,%rax
+  801a90:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801a94:	e9 5f ff ff ff       	jmp    8019f8 <strtol+0xdc>
+			break;
+  801a99:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801a9a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801a9f:	74 0b                	je     801aac <strtol+0x190>
+		*endptr = (char *) s;
+  801aa1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aa5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801aa9:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801aac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ab0:	74 09                	je     801abb <strtol+0x19f>
+  801ab2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ab6:	48 f7 d8             	neg    %rax
+  801ab9:	eb 04                	jmp    801abf <strtol+0x1a3>
+  801abb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801abf:	c9                   	leave
+  801ac0:	c3                   	ret
+
+0000000000801ac1 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801ac1:	55                   	push   %rbp
+  801ac2:	48 89 e5             	mov    %rsp,%rbp
+  801ac5:	53                   	push   %rbx
+  801ac6:	48 83 ec 30          	sub    $0x30,%rsp
+  801aca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801aca <strstr+0x9>
+  801ad1:	49 bb 6e 75 00 00 00 	movabs $0x756e,%r11
+  801ad8:	00 00 00 
+  801adb:	4c 01 db             	add    %r11,%rbx
+  801ade:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801ae2:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801ae6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aea:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801aee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801af2:	0f b6 00             	movzbl (%rax),%eax
+  801af5:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801af8:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801afc:	75 06                	jne    801b04 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801afe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b02:	eb 73                	jmp    801b77 <strstr+0xb6>
+
+	len = strlen(str);
+  801b04:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b08:	48 89 c7             	mov    %rax,%rdi
+  801b0b:	48 b8 16 82 ff ff ff 	movabs $0xffffffffffff8216,%rax
+  801b12:	ff ff ff 
+  801b15:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801b19:	ff d0                	call   *%rax
+  801b1b:	48 98                	cltq
+  801b1d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801b21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b25:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b29:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b2d:	0f b6 00             	movzbl (%rax),%eax
+  801b30:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801b33:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801b37:	75 07                	jne    801b40 <strstr+0x7f>
+				return (char *) 0;
+  801b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3e:	eb 37                	jmp    801b77 <strstr+0xb6>
+		} while (sc != c);
+  801b40:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801b44:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801b47:	75 d8                	jne    801b21 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801b49:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b4d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801b51:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b55:	48 89 ce             	mov    %rcx,%rsi
+  801b58:	48 89 c7             	mov    %rax,%rdi
+  801b5b:	48 b8 ca 84 ff ff ff 	movabs $0xffffffffffff84ca,%rax
+  801b62:	ff ff ff 
+  801b65:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801b69:	ff d0                	call   *%rax
+  801b6b:	85 c0                	test   %eax,%eax
+  801b6d:	75 b2                	jne    801b21 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801b6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b73:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801b77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b7b:	c9                   	leave
+  801b7c:	c3                   	ret
+
+0000000000801b7d <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801b7d:	55                   	push   %rbp
+  801b7e:	48 89 e5             	mov    %rsp,%rbp
+  801b81:	41 57                	push   %r15
+  801b83:	53                   	push   %rbx
+  801b84:	48 83 ec 40          	sub    $0x40,%rsp
+  801b88:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801b88 <syscall+0xb>
+  801b8f:	49 bb b0 74 00 00 00 	movabs $0x74b0,%r11
+  801b96:	00 00 00 
+  801b99:	4d 01 da             	add    %r11,%r10
+  801b9c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801b9f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801ba2:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ba6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801baa:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801bae:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801bb2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801bb5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801bb9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801bbd:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801bc1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801bc5:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801bc9:	4c 89 c3             	mov    %r8,%rbx
+  801bcc:	cd 30                	int    $0x30
+  801bce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801bd2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801bd6:	74 52                	je     801c2a <syscall+0xad>
+  801bd8:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801bdd:	7e 4b                	jle    801c2a <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801bdf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801be3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801be6:	49 89 d0             	mov    %rdx,%r8
+  801be9:	89 c1                	mov    %eax,%ecx
+  801beb:	48 b8 68 e5 ff ff ff 	movabs $0xffffffffffffe568,%rax
+  801bf2:	ff ff ff 
+  801bf5:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801bf9:	48 89 c2             	mov    %rax,%rdx
+  801bfc:	be 23 00 00 00       	mov    $0x23,%esi
+  801c01:	48 b8 85 e5 ff ff ff 	movabs $0xffffffffffffe585,%rax
+  801c08:	ff ff ff 
+  801c0b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801c0f:	48 89 c7             	mov    %rax,%rdi
+  801c12:	4d 89 d7             	mov    %r10,%r15
+  801c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1a:	49 b9 11 72 ff ff ff 	movabs $0xffffffffffff7211,%r9
+  801c21:	ff ff ff 
+  801c24:	4d 01 d1             	add    %r10,%r9
+  801c27:	41 ff d1             	call   *%r9
+
+	return ret;
+  801c2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c2e:	48 83 c4 40          	add    $0x40,%rsp
+  801c32:	5b                   	pop    %rbx
+  801c33:	41 5f                	pop    %r15
+  801c35:	5d                   	pop    %rbp
+  801c36:	c3                   	ret
+
+0000000000801c37 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801c37:	55                   	push   %rbp
+  801c38:	48 89 e5             	mov    %rsp,%rbp
+  801c3b:	41 57                	push   %r15
+  801c3d:	41 56                	push   %r14
+  801c3f:	41 55                	push   %r13
+  801c41:	41 54                	push   %r12
+  801c43:	53                   	push   %rbx
+  801c44:	48 83 ec 48          	sub    $0x48,%rsp
+  801c48:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801c48 <syscall_words+0x11>
+  801c4f:	49 bb f0 73 00 00 00 	movabs $0x73f0,%r11
+  801c56:	00 00 00 
+  801c59:	4d 01 de             	add    %r11,%r14
+  801c5c:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801c5f:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801c62:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801c66:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801c6a:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801c6e:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801c72:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c77:	74 09                	je     801c82 <syscall_words+0x4b>
+  801c79:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c7d:	48 8b 00             	mov    (%rax),%rax
+  801c80:	eb 05                	jmp    801c87 <syscall_words+0x50>
+  801c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c87:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801c8a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c8f:	74 0a                	je     801c9b <syscall_words+0x64>
+  801c91:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c95:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801c99:	eb 05                	jmp    801ca0 <syscall_words+0x69>
+  801c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca0:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801ca3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ca8:	74 0a                	je     801cb4 <syscall_words+0x7d>
+  801caa:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cae:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801cb2:	eb 05                	jmp    801cb9 <syscall_words+0x82>
+  801cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb9:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801cbc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801cc1:	74 0a                	je     801ccd <syscall_words+0x96>
+  801cc3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cc7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ccb:	eb 05                	jmp    801cd2 <syscall_words+0x9b>
+  801ccd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd2:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801cd5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801cda:	74 0a                	je     801ce6 <syscall_words+0xaf>
+  801cdc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ce0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ce4:	eb 05                	jmp    801ceb <syscall_words+0xb4>
+  801ce6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ceb:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801cee:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801cf3:	74 0a                	je     801cff <syscall_words+0xc8>
+  801cf5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cf9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801cfd:	eb 05                	jmp    801d04 <syscall_words+0xcd>
+  801cff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d04:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801d07:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801d0a:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801d0e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801d12:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801d16:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801d1a:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801d1e:	cd 30                	int    $0x30
+  801d20:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801d24:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d29:	74 50                	je     801d7b <syscall_words+0x144>
+		words[0] = r8;
+  801d2b:	4c 89 c2             	mov    %r8,%rdx
+  801d2e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d32:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801d35:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d39:	48 83 c0 08          	add    $0x8,%rax
+  801d3d:	4c 89 ca             	mov    %r9,%rdx
+  801d40:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801d43:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d47:	48 83 c0 10          	add    $0x10,%rax
+  801d4b:	4c 89 d2             	mov    %r10,%rdx
+  801d4e:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801d51:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d55:	48 83 c0 18          	add    $0x18,%rax
+  801d59:	4c 89 da             	mov    %r11,%rdx
+  801d5c:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801d5f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d63:	48 83 c0 20          	add    $0x20,%rax
+  801d67:	4c 89 e2             	mov    %r12,%rdx
+  801d6a:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801d6d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d71:	48 83 c0 28          	add    $0x28,%rax
+  801d75:	4c 89 ea             	mov    %r13,%rdx
+  801d78:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801d7b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801d7f:	74 52                	je     801dd3 <syscall_words+0x19c>
+  801d81:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801d86:	7e 4b                	jle    801dd3 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801d88:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d8c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801d8f:	49 89 d0             	mov    %rdx,%r8
+  801d92:	89 c1                	mov    %eax,%ecx
+  801d94:	48 b8 68 e5 ff ff ff 	movabs $0xffffffffffffe568,%rax
+  801d9b:	ff ff ff 
+  801d9e:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801da2:	48 89 c2             	mov    %rax,%rdx
+  801da5:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801daa:	48 b8 85 e5 ff ff ff 	movabs $0xffffffffffffe585,%rax
+  801db1:	ff ff ff 
+  801db4:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801db8:	48 89 c7             	mov    %rax,%rdi
+  801dbb:	4d 89 f7             	mov    %r14,%r15
+  801dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc3:	49 b9 11 72 ff ff ff 	movabs $0xffffffffffff7211,%r9
+  801dca:	ff ff ff 
+  801dcd:	4d 01 f1             	add    %r14,%r9
+  801dd0:	41 ff d1             	call   *%r9
+
+	return ret;
+  801dd3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801dd7:	48 83 c4 48          	add    $0x48,%rsp
+  801ddb:	5b                   	pop    %rbx
+  801ddc:	41 5c                	pop    %r12
+  801dde:	41 5d                	pop    %r13
+  801de0:	41 5e                	pop    %r14
+  801de2:	41 5f                	pop    %r15
+  801de4:	5d                   	pop    %rbp
+  801de5:	c3                   	ret
+
+0000000000801de6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801de6:	55                   	push   %rbp
+  801de7:	48 89 e5             	mov    %rsp,%rbp
+  801dea:	48 83 ec 10          	sub    $0x10,%rsp
+  801dee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801dee <sys_cputs+0x8>
+  801df5:	49 bb 4a 72 00 00 00 	movabs $0x724a,%r11
+  801dfc:	00 00 00 
+  801dff:	4c 01 d8             	add    %r11,%rax
+  801e02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e06:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801e0a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e0e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e12:	48 83 ec 08          	sub    $0x8,%rsp
+  801e16:	6a 00                	push   $0x0
+  801e18:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e1e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e24:	be 00 00 00 00       	mov    $0x0,%esi
+  801e29:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e2e:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  801e35:	ff ff ff 
+  801e38:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e3c:	ff d0                	call   *%rax
+  801e3e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e42:	90                   	nop
+  801e43:	c9                   	leave
+  801e44:	c3                   	ret
+
+0000000000801e45 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801e45:	55                   	push   %rbp
+  801e46:	48 89 e5             	mov    %rsp,%rbp
+  801e49:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e49 <sys_cgetc+0x4>
+  801e50:	49 bb ef 71 00 00 00 	movabs $0x71ef,%r11
+  801e57:	00 00 00 
+  801e5a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801e5d:	48 83 ec 08          	sub    $0x8,%rsp
+  801e61:	6a 00                	push   $0x0
+  801e63:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e79:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e83:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  801e8a:	ff ff ff 
+  801e8d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e91:	ff d0                	call   *%rax
+  801e93:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e97:	c9                   	leave
+  801e98:	c3                   	ret
+
+0000000000801e99 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+  801e9d:	48 83 ec 10          	sub    $0x10,%rsp
+  801ea1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ea1 <sys_env_destroy+0x8>
+  801ea8:	49 bb 97 71 00 00 00 	movabs $0x7197,%r11
+  801eaf:	00 00 00 
+  801eb2:	4c 01 d8             	add    %r11,%rax
+  801eb5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801eb8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801ebb:	48 63 d2             	movslq %edx,%rdx
+  801ebe:	48 83 ec 08          	sub    $0x8,%rsp
+  801ec2:	6a 00                	push   $0x0
+  801ec4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801eca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ed0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ed5:	be 01 00 00 00       	mov    $0x1,%esi
+  801eda:	bf 03 00 00 00       	mov    $0x3,%edi
+  801edf:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  801ee6:	ff ff ff 
+  801ee9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801eed:	ff d0                	call   *%rax
+  801eef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ef3:	c9                   	leave
+  801ef4:	c3                   	ret
+
+0000000000801ef5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801ef5:	55                   	push   %rbp
+  801ef6:	48 89 e5             	mov    %rsp,%rbp
+  801ef9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ef9 <sys_getenvid+0x4>
+  801f00:	49 bb 3f 71 00 00 00 	movabs $0x713f,%r11
+  801f07:	00 00 00 
+  801f0a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801f0d:	48 83 ec 08          	sub    $0x8,%rsp
+  801f11:	6a 00                	push   $0x0
+  801f13:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f19:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f29:	be 00 00 00 00       	mov    $0x0,%esi
+  801f2e:	bf 02 00 00 00       	mov    $0x2,%edi
+  801f33:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  801f3a:	ff ff ff 
+  801f3d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f41:	ff d0                	call   *%rax
+  801f43:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f47:	c9                   	leave
+  801f48:	c3                   	ret
+
+0000000000801f49 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801f49:	55                   	push   %rbp
+  801f4a:	48 89 e5             	mov    %rsp,%rbp
+  801f4d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f4d <sys_yield+0x4>
+  801f54:	49 bb eb 70 00 00 00 	movabs $0x70eb,%r11
+  801f5b:	00 00 00 
+  801f5e:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801f61:	48 83 ec 08          	sub    $0x8,%rsp
+  801f65:	6a 00                	push   $0x0
+  801f67:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f82:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801f87:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  801f8e:	ff ff ff 
+  801f91:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f95:	ff d0                	call   *%rax
+  801f97:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f9b:	90                   	nop
+  801f9c:	c9                   	leave
+  801f9d:	c3                   	ret
+
+0000000000801f9e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801f9e:	55                   	push   %rbp
+  801f9f:	48 89 e5             	mov    %rsp,%rbp
+  801fa2:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fa6 <sys_page_alloc+0x8>
+  801fad:	49 bb 92 70 00 00 00 	movabs $0x7092,%r11
+  801fb4:	00 00 00 
+  801fb7:	4c 01 d8             	add    %r11,%rax
+  801fba:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fbd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801fc1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801fc4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801fc7:	48 63 f2             	movslq %edx,%rsi
+  801fca:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fce:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fd1:	48 63 d2             	movslq %edx,%rdx
+  801fd4:	48 83 ec 08          	sub    $0x8,%rsp
+  801fd8:	6a 00                	push   $0x0
+  801fda:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fe0:	49 89 f0             	mov    %rsi,%r8
+  801fe3:	be 01 00 00 00       	mov    $0x1,%esi
+  801fe8:	bf 04 00 00 00       	mov    $0x4,%edi
+  801fed:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  801ff4:	ff ff ff 
+  801ff7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ffb:	ff d0                	call   *%rax
+  801ffd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802001:	c9                   	leave
+  802002:	c3                   	ret
+
+0000000000802003 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802003:	55                   	push   %rbp
+  802004:	48 89 e5             	mov    %rsp,%rbp
+  802007:	48 83 ec 20          	sub    $0x20,%rsp
+  80200b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80200b <sys_page_map+0x8>
+  802012:	49 bb 2d 70 00 00 00 	movabs $0x702d,%r11
+  802019:	00 00 00 
+  80201c:	4c 01 d8             	add    %r11,%rax
+  80201f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802022:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802026:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802029:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80202d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802031:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802034:	48 63 f2             	movslq %edx,%rsi
+  802037:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80203b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80203e:	48 63 fa             	movslq %edx,%rdi
+  802041:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802045:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802048:	48 63 d2             	movslq %edx,%rdx
+  80204b:	48 83 ec 08          	sub    $0x8,%rsp
+  80204f:	56                   	push   %rsi
+  802050:	4d 89 c1             	mov    %r8,%r9
+  802053:	49 89 f8             	mov    %rdi,%r8
+  802056:	be 01 00 00 00       	mov    $0x1,%esi
+  80205b:	bf 05 00 00 00       	mov    $0x5,%edi
+  802060:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  802067:	ff ff ff 
+  80206a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80206e:	ff d0                	call   *%rax
+  802070:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802074:	c9                   	leave
+  802075:	c3                   	ret
+
+0000000000802076 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802076:	55                   	push   %rbp
+  802077:	48 89 e5             	mov    %rsp,%rbp
+  80207a:	48 83 ec 10          	sub    $0x10,%rsp
+  80207e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80207e <sys_page_unmap+0x8>
+  802085:	49 bb ba 6f 00 00 00 	movabs $0x6fba,%r11
+  80208c:	00 00 00 
+  80208f:	4c 01 d8             	add    %r11,%rax
+  802092:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802095:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802099:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80209d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020a0:	48 63 d2             	movslq %edx,%rdx
+  8020a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a7:	6a 00                	push   $0x0
+  8020a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8020ba:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020bf:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  8020c6:	ff ff ff 
+  8020c9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020cd:	ff d0                	call   *%rax
+  8020cf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020d3:	c9                   	leave
+  8020d4:	c3                   	ret
+
+00000000008020d5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8020d5:	55                   	push   %rbp
+  8020d6:	48 89 e5             	mov    %rsp,%rbp
+  8020d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8020dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020dd <sys_env_set_status+0x8>
+  8020e4:	49 bb 5b 6f 00 00 00 	movabs $0x6f5b,%r11
+  8020eb:	00 00 00 
+  8020ee:	4c 01 d8             	add    %r11,%rax
+  8020f1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020f4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8020f7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020fa:	48 63 ca             	movslq %edx,%rcx
+  8020fd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802100:	48 63 d2             	movslq %edx,%rdx
+  802103:	48 83 ec 08          	sub    $0x8,%rsp
+  802107:	6a 00                	push   $0x0
+  802109:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80210f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802115:	be 01 00 00 00       	mov    $0x1,%esi
+  80211a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80211f:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  802126:	ff ff ff 
+  802129:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80212d:	ff d0                	call   *%rax
+  80212f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802133:	c9                   	leave
+  802134:	c3                   	ret
+
+0000000000802135 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802135:	55                   	push   %rbp
+  802136:	48 89 e5             	mov    %rsp,%rbp
+  802139:	48 83 ec 10          	sub    $0x10,%rsp
+  80213d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80213d <sys_env_set_trapframe+0x8>
+  802144:	49 bb fb 6e 00 00 00 	movabs $0x6efb,%r11
+  80214b:	00 00 00 
+  80214e:	4c 01 d8             	add    %r11,%rax
+  802151:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802154:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802158:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80215c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80215f:	48 63 d2             	movslq %edx,%rdx
+  802162:	48 83 ec 08          	sub    $0x8,%rsp
+  802166:	6a 00                	push   $0x0
+  802168:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80216e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802174:	be 01 00 00 00       	mov    $0x1,%esi
+  802179:	bf 09 00 00 00       	mov    $0x9,%edi
+  80217e:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  802185:	ff ff ff 
+  802188:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80218c:	ff d0                	call   *%rax
+  80218e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802192:	c9                   	leave
+  802193:	c3                   	ret
+
+0000000000802194 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802194:	55                   	push   %rbp
+  802195:	48 89 e5             	mov    %rsp,%rbp
+  802198:	48 83 ec 10          	sub    $0x10,%rsp
+  80219c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80219c <sys_env_set_pgfault_upcall+0x8>
+  8021a3:	49 bb 9c 6e 00 00 00 	movabs $0x6e9c,%r11
+  8021aa:	00 00 00 
+  8021ad:	4c 01 d8             	add    %r11,%rax
+  8021b0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021b3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8021b7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021bb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021be:	48 63 d2             	movslq %edx,%rdx
+  8021c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c5:	6a 00                	push   $0x0
+  8021c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8021d8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8021dd:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  8021e4:	ff ff ff 
+  8021e7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021eb:	ff d0                	call   *%rax
+  8021ed:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021f1:	c9                   	leave
+  8021f2:	c3                   	ret
+
+00000000008021f3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8021f3:	55                   	push   %rbp
+  8021f4:	48 89 e5             	mov    %rsp,%rbp
+  8021f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8021fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021fb <sys_ipc_try_send+0x8>
+  802202:	49 bb 3d 6e 00 00 00 	movabs $0x6e3d,%r11
+  802209:	00 00 00 
+  80220c:	4c 01 d8             	add    %r11,%rax
+  80220f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802212:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802216:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80221a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80221d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802220:	48 63 fa             	movslq %edx,%rdi
+  802223:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802227:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80222a:	48 63 d2             	movslq %edx,%rdx
+  80222d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802231:	48 83 ec 08          	sub    $0x8,%rsp
+  802235:	6a 00                	push   $0x0
+  802237:	49 89 f9             	mov    %rdi,%r9
+  80223a:	49 89 f0             	mov    %rsi,%r8
+  80223d:	be 00 00 00 00       	mov    $0x0,%esi
+  802242:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802247:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  80224e:	ff ff ff 
+  802251:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802255:	ff d0                	call   *%rax
+  802257:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80225b:	c9                   	leave
+  80225c:	c3                   	ret
+
+000000000080225d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80225d:	55                   	push   %rbp
+  80225e:	48 89 e5             	mov    %rsp,%rbp
+  802261:	48 83 ec 20          	sub    $0x20,%rsp
+  802265:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802265 <sys_ipc_send+0x8>
+  80226c:	49 bb d3 6d 00 00 00 	movabs $0x6dd3,%r11
+  802273:	00 00 00 
+  802276:	4c 01 d8             	add    %r11,%rax
+  802279:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80227c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802280:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802284:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802287:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80228a:	48 63 fa             	movslq %edx,%rdi
+  80228d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802291:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802294:	48 63 d2             	movslq %edx,%rdx
+  802297:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80229b:	48 83 ec 08          	sub    $0x8,%rsp
+  80229f:	6a 00                	push   $0x0
+  8022a1:	49 89 f9             	mov    %rdi,%r9
+  8022a4:	49 89 f0             	mov    %rsi,%r8
+  8022a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ac:	bf 17 00 00 00       	mov    $0x17,%edi
+  8022b1:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  8022b8:	ff ff ff 
+  8022bb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022bf:	ff d0                	call   *%rax
+  8022c1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c5:	c9                   	leave
+  8022c6:	c3                   	ret
+
+00000000008022c7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8022c7:	55                   	push   %rbp
+  8022c8:	48 89 e5             	mov    %rsp,%rbp
+  8022cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8022cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022cf <sys_ipc_recv+0x8>
+  8022d6:	49 bb 69 6d 00 00 00 	movabs $0x6d69,%r11
+  8022dd:	00 00 00 
+  8022e0:	4c 01 d8             	add    %r11,%rax
+  8022e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8022e7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8022eb:	6a 00                	push   $0x0
+  8022ed:	6a 00                	push   $0x0
+  8022ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802300:	be 01 00 00 00       	mov    $0x1,%esi
+  802305:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80230a:	49 ba ff 8b ff ff ff 	movabs $0xffffffffffff8bff,%r10
+  802311:	ff ff ff 
+  802314:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802318:	ff d0                	call   *%rax
+  80231a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80231e:	c9                   	leave
+  80231f:	c3                   	ret
+
+0000000000802320 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802320:	55                   	push   %rbp
+  802321:	48 89 e5             	mov    %rsp,%rbp
+  802324:	48 83 ec 30          	sub    $0x30,%rsp
+  802328:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802328 <sys_ipc_call+0x8>
+  80232f:	49 bb 10 6d 00 00 00 	movabs $0x6d10,%r11
+  802336:	00 00 00 
+  802339:	4c 01 d8             	add    %r11,%rax
+  80233c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80233f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802343:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802347:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80234a:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80234e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802352:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802356:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802359:	4c 63 c2             	movslq %edx,%r8
+  80235c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802360:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802363:	48 63 d2             	movslq %edx,%rdx
+  802366:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80236a:	ff 75 d8             	push   -0x28(%rbp)
+  80236d:	56                   	push   %rsi
+  80236e:	4d 89 c1             	mov    %r8,%r9
+  802371:	49 89 f8             	mov    %rdi,%r8
+  802374:	be 00 00 00 00       	mov    $0x0,%esi
+  802379:	bf 18 00 00 00       	mov    $0x18,%edi
+  80237e:	49 ba ff 8b ff ff ff 	movabs $0xffffffffffff8bff,%r10
+  802385:	ff ff ff 
+  802388:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80238c:	ff d0                	call   *%rax
+  80238e:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802392:	c9                   	leave
+  802393:	c3                   	ret
+
+0000000000802394 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802394:	55                   	push   %rbp
+  802395:	48 89 e5             	mov    %rsp,%rbp
+  802398:	48 83 ec 30          	sub    $0x30,%rsp
+  80239c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80239c <sys_ipc_reply_recv+0x8>
+  8023a3:	49 bb 9c 6c 00 00 00 	movabs $0x6c9c,%r11
+  8023aa:	00 00 00 
+  8023ad:	4c 01 d8             	add    %r11,%rax
+  8023b0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023b3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023b7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023bb:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8023be:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8023c2:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8023c6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8023ca:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023cd:	4c 63 c2             	movslq %edx,%r8
+  8023d0:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8023d4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023d7:	48 63 d2             	movslq %edx,%rdx
+  8023da:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023de:	ff 75 d8             	push   -0x28(%rbp)
+  8023e1:	56                   	push   %rsi
+  8023e2:	4d 89 c1             	mov    %r8,%r9
+  8023e5:	49 89 f8             	mov    %rdi,%r8
+  8023e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ed:	bf 19 00 00 00       	mov    $0x19,%edi
+  8023f2:	49 ba ff 8b ff ff ff 	movabs $0xffffffffffff8bff,%r10
+  8023f9:	ff ff ff 
+  8023fc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802400:	ff d0                	call   *%rax
+  802402:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802406:	c9                   	leave
+  802407:	c3                   	ret
+
+0000000000802408 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802408:	55                   	push   %rbp
+  802409:	48 89 e5             	mov    %rsp,%rbp
+  80240c:	48 83 ec 10          	sub    $0x10,%rsp
+  802410:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802410 <sys_env_set_priority+0x8>
+  802417:	49 bb 28 6c 00 00 00 	movabs $0x6c28,%r11
+  80241e:	00 00 00 
+  802421:	4c 01 d8             	add    %r11,%rax
+  802424:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802427:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80242a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80242d:	48 63 ca             	movslq %edx,%rcx
+  802430:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802433:	48 63 d2             	movslq %edx,%rdx
+  802436:	48 83 ec 08          	sub    $0x8,%rsp
+  80243a:	6a 00                	push   $0x0
+  80243c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802442:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802448:	be 01 00 00 00       	mov    $0x1,%esi
+  80244d:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802452:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  802459:	ff ff ff 
+  80245c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802460:	ff d0                	call   *%rax
+  802462:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802466:	c9                   	leave
+  802467:	c3                   	ret
+
+0000000000802468 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802468:	55                   	push   %rbp
+  802469:	48 89 e5             	mov    %rsp,%rbp
+  80246c:	48 83 ec 10          	sub    $0x10,%rsp
+  802470:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802470 <sys_env_set_affinity+0x8>
+  802477:	49 bb c8 6b 00 00 00 	movabs $0x6bc8,%r11
+  80247e:	00 00 00 
+  802481:	4c 01 d8             	add    %r11,%rax
+  802484:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802487:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  80248a:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  80248d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802490:	48 63 d2             	movslq %edx,%rdx
+  802493:	48 83 ec 08          	sub    $0x8,%rsp
+  802497:	6a 00                	push   $0x0
+  802499:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80249f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8024aa:	bf 10 00 00 00       	mov    $0x10,%edi
+  8024af:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  8024b6:	ff ff ff 
+  8024b9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024bd:	ff d0                	call   *%rax
+  8024bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024c3:	c9                   	leave
+  8024c4:	c3                   	ret
+
+00000000008024c5 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8024c5:	55                   	push   %rbp
+  8024c6:	48 89 e5             	mov    %rsp,%rbp
+  8024c9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024c9 <sys_time_msec+0x4>
+  8024d0:	49 bb 6f 6b 00 00 00 	movabs $0x6b6f,%r11
+  8024d7:	00 00 00 
+  8024da:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8024dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8024e1:	6a 00                	push   $0x0
+  8024e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024fe:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802503:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  80250a:	ff ff ff 
+  80250d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802511:	ff d0                	call   *%rax
+  802513:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802517:	c9                   	leave
+  802518:	c3                   	ret
+
+0000000000802519 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802519:	55                   	push   %rbp
+  80251a:	48 89 e5             	mov    %rsp,%rbp
+  80251d:	48 83 ec 10          	sub    $0x10,%rsp
+  802521:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802521 <sys_sleep_usec+0x8>
+  802528:	49 bb 17 6b 00 00 00 	movabs $0x6b17,%r11
+  80252f:	00 00 00 
+  802532:	4c 01 d8             	add    %r11,%rax
+  802535:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802539:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80253d:	48 83 ec 08          	sub    $0x8,%rsp
+  802541:	6a 00                	push   $0x0
+  802543:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802549:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80254f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802554:	be 00 00 00 00       	mov    $0x0,%esi
+  802559:	bf 11 00 00 00       	mov    $0x11,%edi
+  80255e:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  802565:	ff ff ff 
+  802568:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80256c:	ff d0                	call   *%rax
+  80256e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802572:	c9                   	leave
+  802573:	c3                   	ret
+
+0000000000802574 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802574:	55                   	push   %rbp
+  802575:	48 89 e5             	mov    %rsp,%rbp
+  802578:	48 83 ec 10          	sub    $0x10,%rsp
+  80257c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80257c <sys_page_alloc_huge+0x8>
+  802583:	49 bb bc 6a 00 00 00 	movabs $0x6abc,%r11
+  80258a:	00 00 00 
+  80258d:	4c 01 d8             	add    %r11,%rax
+  802590:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802593:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802597:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  80259a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80259d:	48 63 f2             	movslq %edx,%rsi
+  8025a0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025a4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025a7:	48 63 d2             	movslq %edx,%rdx
+  8025aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8025ae:	6a 00                	push   $0x0
+  8025b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025b6:	49 89 f0             	mov    %rsi,%r8
+  8025b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8025be:	bf 12 00 00 00       	mov    $0x12,%edi
+  8025c3:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  8025ca:	ff ff ff 
+  8025cd:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025d1:	ff d0                	call   *%rax
+  8025d3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025d7:	c9                   	leave
+  8025d8:	c3                   	ret
+
+00000000008025d9 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8025d9:	55                   	push   %rbp
+  8025da:	48 89 e5             	mov    %rsp,%rbp
+  8025dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8025e1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025e1 <sys_page_map_batch+0x8>
+  8025e8:	49 bb 57 6a 00 00 00 	movabs $0x6a57,%r11
+  8025ef:	00 00 00 
+  8025f2:	4c 01 d8             	add    %r11,%rax
+  8025f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025f9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8025fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802601:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802605:	48 83 ec 08          	sub    $0x8,%rsp
+  802609:	6a 00                	push   $0x0
+  80260b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802611:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802617:	be 01 00 00 00       	mov    $0x1,%esi
+  80261c:	bf 13 00 00 00       	mov    $0x13,%edi
+  802621:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  802628:	ff ff ff 
+  80262b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80262f:	ff d0                	call   *%rax
+  802631:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802635:	c9                   	leave
+  802636:	c3                   	ret
+
+0000000000802637 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802637:	55                   	push   %rbp
+  802638:	48 89 e5             	mov    %rsp,%rbp
+  80263b:	48 83 ec 10          	sub    $0x10,%rsp
+  80263f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80263f <sys_page_alloc_batch+0x8>
+  802646:	49 bb f9 69 00 00 00 	movabs $0x69f9,%r11
+  80264d:	00 00 00 
+  802650:	4c 01 d8             	add    %r11,%rax
+  802653:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802657:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80265b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80265f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802663:	48 83 ec 08          	sub    $0x8,%rsp
+  802667:	6a 00                	push   $0x0
+  802669:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80266f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802675:	be 01 00 00 00       	mov    $0x1,%esi
+  80267a:	bf 14 00 00 00       	mov    $0x14,%edi
+  80267f:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  802686:	ff ff ff 
+  802689:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80268d:	ff d0                	call   *%rax
+  80268f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802693:	c9                   	leave
+  802694:	c3                   	ret
+
+0000000000802695 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802695:	55                   	push   %rbp
+  802696:	48 89 e5             	mov    %rsp,%rbp
+  802699:	48 83 ec 10          	sub    $0x10,%rsp
+  80269d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80269d <sys_page_unmap_batch+0x8>
+  8026a4:	49 bb 9b 69 00 00 00 	movabs $0x699b,%r11
+  8026ab:	00 00 00 
+  8026ae:	4c 01 d8             	add    %r11,%rax
+  8026b1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8026b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026bd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8026c5:	6a 00                	push   $0x0
+  8026c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8026d8:	bf 15 00 00 00       	mov    $0x15,%edi
+  8026dd:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  8026e4:	ff ff ff 
+  8026e7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026eb:	ff d0                	call   *%rax
+  8026ed:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f1:	c9                   	leave
+  8026f2:	c3                   	ret
+
+00000000008026f3 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8026f3:	55                   	push   %rbp
+  8026f4:	48 89 e5             	mov    %rsp,%rbp
+  8026f7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026f7 <sys_fork+0x4>
+  8026fe:	49 bb 41 69 00 00 00 	movabs $0x6941,%r11
+  802705:	00 00 00 
+  802708:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80270b:	48 83 ec 08          	sub    $0x8,%rsp
+  80270f:	6a 00                	push   $0x0
+  802711:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802717:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80271d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802722:	ba 00 00 00 00       	mov    $0x0,%edx
+  802727:	be 00 00 00 00       	mov    $0x0,%esi
+  80272c:	bf 16 00 00 00       	mov    $0x16,%edi
+  802731:	49 ba 45 8b ff ff ff 	movabs $0xffffffffffff8b45,%r10
+  802738:	ff ff ff 
+  80273b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80273f:	ff d0                	call   *%rax
+  802741:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802745:	c9                   	leave
+  802746:	c3                   	ret
+
+0000000000802747 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  802747:	55                   	push   %rbp
+  802748:	48 89 e5             	mov    %rsp,%rbp
+  80274b:	48 83 ec 08          	sub    $0x8,%rsp
+  80274f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80274f <fd2num+0x8>
+  802756:	49 bb e9 68 00 00 00 	movabs $0x68e9,%r11
+  80275d:	00 00 00 
+  802760:	4c 01 d8             	add    %r11,%rax
+  802763:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  802767:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80276b:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802772:	ff ff ff 
+  802775:	48 01 d0             	add    %rdx,%rax
+  802778:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80277c:	c9                   	leave
+  80277d:	c3                   	ret
+
+000000000080277e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80277e:	55                   	push   %rbp
+  80277f:	48 89 e5             	mov    %rsp,%rbp
+  802782:	48 83 ec 08          	sub    $0x8,%rsp
+  802786:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802786 <fd2data+0x8>
+  80278d:	49 bb b2 68 00 00 00 	movabs $0x68b2,%r11
+  802794:	00 00 00 
+  802797:	4c 01 d8             	add    %r11,%rax
+  80279a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80279e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8027a2:	48 89 d7             	mov    %rdx,%rdi
+  8027a5:	48 ba 0f 97 ff ff ff 	movabs $0xffffffffffff970f,%rdx
+  8027ac:	ff ff ff 
+  8027af:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8027b3:	ff d0                	call   *%rax
+  8027b5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8027bb:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8027bf:	c9                   	leave
+  8027c0:	c3                   	ret
+
+00000000008027c1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8027c1:	55                   	push   %rbp
+  8027c2:	48 89 e5             	mov    %rsp,%rbp
+  8027c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8027c9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027c9 <fd_alloc+0x8>
+  8027d0:	49 bb 6f 68 00 00 00 	movabs $0x686f,%r11
+  8027d7:	00 00 00 
+  8027da:	4c 01 d8             	add    %r11,%rax
+  8027dd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8027e1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8027e8:	eb 75                	jmp    80285f <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8027ea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027ed:	48 63 d2             	movslq %edx,%rdx
+  8027f0:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8027f7:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8027fb:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8027ff:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802803:	48 89 d1             	mov    %rdx,%rcx
+  802806:	48 c1 e9 15          	shr    $0x15,%rcx
+  80280a:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  802811:	ff ff ff 
+  802814:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802818:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80281c:	83 e2 01             	and    $0x1,%edx
+  80281f:	48 85 d2             	test   %rdx,%rdx
+  802822:	74 25                	je     802849 <fd_alloc+0x88>
+  802824:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802828:	48 89 d1             	mov    %rdx,%rcx
+  80282b:	48 c1 e9 0c          	shr    $0xc,%rcx
+  80282f:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  802836:	ff ff ff 
+  802839:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80283d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802841:	83 e2 01             	and    $0x1,%edx
+  802844:	48 85 d2             	test   %rdx,%rdx
+  802847:	75 12                	jne    80285b <fd_alloc+0x9a>
+			*fd_store = fd;
+  802849:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80284d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802851:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802854:	b8 00 00 00 00       	mov    $0x0,%eax
+  802859:	eb 1a                	jmp    802875 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  80285b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80285f:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802863:	7e 85                	jle    8027ea <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  802865:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802869:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802870:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  802875:	c9                   	leave
+  802876:	c3                   	ret
+
+0000000000802877 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  802877:	55                   	push   %rbp
+  802878:	48 89 e5             	mov    %rsp,%rbp
+  80287b:	48 83 ec 20          	sub    $0x20,%rsp
+  80287f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80287f <fd_lookup+0x8>
+  802886:	49 bb b9 67 00 00 00 	movabs $0x67b9,%r11
+  80288d:	00 00 00 
+  802890:	4c 01 d8             	add    %r11,%rax
+  802893:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802896:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80289a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80289e:	78 06                	js     8028a6 <fd_lookup+0x2f>
+  8028a0:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8028a4:	7e 07                	jle    8028ad <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8028a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028ab:	eb 73                	jmp    802920 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  8028ad:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8028b0:	48 63 d2             	movslq %edx,%rdx
+  8028b3:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8028ba:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8028be:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8028c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028c6:	48 89 d1             	mov    %rdx,%rcx
+  8028c9:	48 c1 e9 15          	shr    $0x15,%rcx
+  8028cd:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8028d4:	ff ff ff 
+  8028d7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8028db:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8028df:	83 e2 01             	and    $0x1,%edx
+  8028e2:	48 85 d2             	test   %rdx,%rdx
+  8028e5:	74 22                	je     802909 <fd_lookup+0x92>
+  8028e7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028eb:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8028ef:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  8028f6:	ff ff ff 
+  8028f9:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8028fd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802901:	83 e0 01             	and    $0x1,%eax
+  802904:	48 85 c0             	test   %rax,%rax
+  802907:	75 07                	jne    802910 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  802909:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80290e:	eb 10                	jmp    802920 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  802910:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802914:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802918:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  80291b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802920:	c9                   	leave
+  802921:	c3                   	ret
+
+0000000000802922 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  802922:	55                   	push   %rbp
+  802923:	48 89 e5             	mov    %rsp,%rbp
+  802926:	41 57                	push   %r15
+  802928:	53                   	push   %rbx
+  802929:	48 83 ec 30          	sub    $0x30,%rsp
+  80292d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80292d <fd_close+0xb>
+  802934:	49 bb 0b 67 00 00 00 	movabs $0x670b,%r11
+  80293b:	00 00 00 
+  80293e:	4c 01 db             	add    %r11,%rbx
+  802941:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802945:	89 f0                	mov    %esi,%eax
+  802947:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80294a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80294e:	48 89 c7             	mov    %rax,%rdi
+  802951:	48 b8 0f 97 ff ff ff 	movabs $0xffffffffffff970f,%rax
+  802958:	ff ff ff 
+  80295b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80295f:	ff d0                	call   *%rax
+  802961:	89 c2                	mov    %eax,%edx
+  802963:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  802967:	48 89 c6             	mov    %rax,%rsi
+  80296a:	89 d7                	mov    %edx,%edi
+  80296c:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  802973:	ff ff ff 
+  802976:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80297a:	ff d0                	call   *%rax
+  80297c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80297f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802983:	78 0a                	js     80298f <fd_close+0x6d>
+	    || fd != fd2)
+  802985:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802989:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80298d:	74 12                	je     8029a1 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80298f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802993:	74 05                	je     80299a <fd_close+0x78>
+  802995:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802998:	eb 7a                	jmp    802a14 <fd_close+0xf2>
+  80299a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299f:	eb 73                	jmp    802a14 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8029a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029a5:	8b 00                	mov    (%rax),%eax
+  8029a7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8029ab:	48 89 d6             	mov    %rdx,%rsi
+  8029ae:	89 c7                	mov    %eax,%edi
+  8029b0:	48 b8 e5 99 ff ff ff 	movabs $0xffffffffffff99e5,%rax
+  8029b7:	ff ff ff 
+  8029ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029be:	ff d0                	call   *%rax
+  8029c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8029c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8029c7:	78 2a                	js     8029f3 <fd_close+0xd1>
+		if (dev->dev_close)
+  8029c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029cd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8029d1:	48 85 c0             	test   %rax,%rax
+  8029d4:	74 16                	je     8029ec <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8029d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029da:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8029de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029e2:	48 89 c7             	mov    %rax,%rdi
+  8029e5:	ff d2                	call   *%rdx
+  8029e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8029ea:	eb 07                	jmp    8029f3 <fd_close+0xd1>
+		else
+			r = 0;
+  8029ec:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8029f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029f7:	48 89 c6             	mov    %rax,%rsi
+  8029fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029ff:	49 89 df             	mov    %rbx,%r15
+  802a02:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  802a09:	ff ff ff 
+  802a0c:	48 01 d8             	add    %rbx,%rax
+  802a0f:	ff d0                	call   *%rax
+	return r;
+  802a11:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802a14:	48 83 c4 30          	add    $0x30,%rsp
+  802a18:	5b                   	pop    %rbx
+  802a19:	41 5f                	pop    %r15
+  802a1b:	5d                   	pop    %rbp
+  802a1c:	c3                   	ret
+
+0000000000802a1d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802a1d:	55                   	push   %rbp
+  802a1e:	48 89 e5             	mov    %rsp,%rbp
+  802a21:	41 57                	push   %r15
+  802a23:	48 83 ec 28          	sub    $0x28,%rsp
+  802a27:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802a27 <dev_lookup+0xa>
+  802a2e:	49 bb 11 66 00 00 00 	movabs $0x6611,%r11
+  802a35:	00 00 00 
+  802a38:	4c 01 d9             	add    %r11,%rcx
+  802a3b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802a3e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802a42:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802a49:	eb 45                	jmp    802a90 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802a4b:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802a52:	00 00 00 
+  802a55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a58:	48 98                	cltq
+  802a5a:	48 01 ca             	add    %rcx,%rdx
+  802a5d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a61:	8b 00                	mov    (%rax),%eax
+  802a63:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802a66:	75 24                	jne    802a8c <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802a68:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802a6f:	00 00 00 
+  802a72:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a75:	48 98                	cltq
+  802a77:	48 01 ca             	add    %rcx,%rdx
+  802a7a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a82:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8a:	eb 74                	jmp    802b00 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802a8c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802a90:	48 ba 08 02 00 00 00 	movabs $0x208,%rdx
+  802a97:	00 00 00 
+  802a9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a9d:	48 98                	cltq
+  802a9f:	48 01 ca             	add    %rcx,%rdx
+  802aa2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802aa6:	48 85 c0             	test   %rax,%rax
+  802aa9:	75 a0                	jne    802a4b <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802aab:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802ab2:	ff ff ff 
+  802ab5:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802ab9:	48 8b 00             	mov    (%rax),%rax
+  802abc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802ac2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ac5:	89 c6                	mov    %eax,%esi
+  802ac7:	48 b8 98 e5 ff ff ff 	movabs $0xffffffffffffe598,%rax
+  802ace:	ff ff ff 
+  802ad1:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802ad5:	48 89 c7             	mov    %rax,%rdi
+  802ad8:	49 89 cf             	mov    %rcx,%r15
+  802adb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae0:	49 b8 e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%r8
+  802ae7:	ff ff ff 
+  802aea:	49 01 c8             	add    %rcx,%r8
+  802aed:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802af0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802af4:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802afb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b00:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802b04:	c9                   	leave
+  802b05:	c3                   	ret
+
+0000000000802b06 <close>:
+
+int
+close(int fdnum)
+{
+  802b06:	55                   	push   %rbp
+  802b07:	48 89 e5             	mov    %rsp,%rbp
+  802b0a:	53                   	push   %rbx
+  802b0b:	48 83 ec 28          	sub    $0x28,%rsp
+  802b0f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b0f <close+0x9>
+  802b16:	49 bb 29 65 00 00 00 	movabs $0x6529,%r11
+  802b1d:	00 00 00 
+  802b20:	4c 01 db             	add    %r11,%rbx
+  802b23:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b26:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802b2a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802b2d:	48 89 d6             	mov    %rdx,%rsi
+  802b30:	89 c7                	mov    %eax,%edi
+  802b32:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  802b39:	ff ff ff 
+  802b3c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b40:	ff d0                	call   *%rax
+  802b42:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b45:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b49:	79 05                	jns    802b50 <close+0x4a>
+		return r;
+  802b4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b4e:	eb 1c                	jmp    802b6c <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802b50:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b54:	be 01 00 00 00       	mov    $0x1,%esi
+  802b59:	48 89 c7             	mov    %rax,%rdi
+  802b5c:	48 b8 ea 98 ff ff ff 	movabs $0xffffffffffff98ea,%rax
+  802b63:	ff ff ff 
+  802b66:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b6a:	ff d0                	call   *%rax
+}
+  802b6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b70:	c9                   	leave
+  802b71:	c3                   	ret
+
+0000000000802b72 <close_all>:
+
+void
+close_all(void)
+{
+  802b72:	55                   	push   %rbp
+  802b73:	48 89 e5             	mov    %rsp,%rbp
+  802b76:	53                   	push   %rbx
+  802b77:	48 83 ec 18          	sub    $0x18,%rsp
+  802b7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b7b <close_all+0x9>
+  802b82:	49 bb bd 64 00 00 00 	movabs $0x64bd,%r11
+  802b89:	00 00 00 
+  802b8c:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802b8f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802b96:	eb 19                	jmp    802bb1 <close_all+0x3f>
+		close(i);
+  802b98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b9b:	89 c7                	mov    %eax,%edi
+  802b9d:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  802ba4:	ff ff ff 
+  802ba7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bab:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802bad:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802bb1:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802bb5:	7e e1                	jle    802b98 <close_all+0x26>
+}
+  802bb7:	90                   	nop
+  802bb8:	90                   	nop
+  802bb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bbd:	c9                   	leave
+  802bbe:	c3                   	ret
+
+0000000000802bbf <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802bbf:	55                   	push   %rbp
+  802bc0:	48 89 e5             	mov    %rsp,%rbp
+  802bc3:	41 57                	push   %r15
+  802bc5:	53                   	push   %rbx
+  802bc6:	48 83 ec 40          	sub    $0x40,%rsp
+  802bca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802bca <dup+0xb>
+  802bd1:	49 bb 6e 64 00 00 00 	movabs $0x646e,%r11
+  802bd8:	00 00 00 
+  802bdb:	4c 01 db             	add    %r11,%rbx
+  802bde:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802be1:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802be4:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802be8:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802beb:	48 89 d6             	mov    %rdx,%rsi
+  802bee:	89 c7                	mov    %eax,%edi
+  802bf0:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  802bf7:	ff ff ff 
+  802bfa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bfe:	ff d0                	call   *%rax
+  802c00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c03:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c07:	79 08                	jns    802c11 <dup+0x52>
+		return r;
+  802c09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c0c:	e9 a4 01 00 00       	jmp    802db5 <dup+0x1f6>
+	close(newfdnum);
+  802c11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c14:	89 c7                	mov    %eax,%edi
+  802c16:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  802c1d:	ff ff ff 
+  802c20:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c24:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802c26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802c29:	48 98                	cltq
+  802c2b:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802c31:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c35:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802c39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c3d:	48 89 c7             	mov    %rax,%rdi
+  802c40:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  802c47:	ff ff ff 
+  802c4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c4e:	ff d0                	call   *%rax
+  802c50:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802c54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c58:	48 89 c7             	mov    %rax,%rdi
+  802c5b:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  802c62:	ff ff ff 
+  802c65:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c69:	ff d0                	call   *%rax
+  802c6b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802c6f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c73:	48 c1 e8 15          	shr    $0x15,%rax
+  802c77:	48 89 c2             	mov    %rax,%rdx
+  802c7a:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802c81:	ff ff ff 
+  802c84:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c88:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c8c:	83 e0 01             	and    $0x1,%eax
+  802c8f:	48 85 c0             	test   %rax,%rax
+  802c92:	74 7f                	je     802d13 <dup+0x154>
+  802c94:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c98:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c9c:	48 89 c2             	mov    %rax,%rdx
+  802c9f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ca6:	ff ff ff 
+  802ca9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cad:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cb1:	83 e0 01             	and    $0x1,%eax
+  802cb4:	48 85 c0             	test   %rax,%rax
+  802cb7:	74 5a                	je     802d13 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802cb9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cbd:	48 c1 e8 0c          	shr    $0xc,%rax
+  802cc1:	48 89 c2             	mov    %rax,%rdx
+  802cc4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ccb:	ff ff ff 
+  802cce:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cd2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cd6:	25 07 0e 00 00       	and    $0xe07,%eax
+  802cdb:	89 c1                	mov    %eax,%ecx
+  802cdd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ce1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ce5:	41 89 c8             	mov    %ecx,%r8d
+  802ce8:	48 89 d1             	mov    %rdx,%rcx
+  802ceb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cf0:	48 89 c6             	mov    %rax,%rsi
+  802cf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf8:	49 89 df             	mov    %rbx,%r15
+  802cfb:	48 b8 cb 8f ff ff ff 	movabs $0xffffffffffff8fcb,%rax
+  802d02:	ff ff ff 
+  802d05:	48 01 d8             	add    %rbx,%rax
+  802d08:	ff d0                	call   *%rax
+  802d0a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d0d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d11:	78 5f                	js     802d72 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802d13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d17:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d1b:	48 89 c2             	mov    %rax,%rdx
+  802d1e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d25:	ff ff ff 
+  802d28:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d2c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d30:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d35:	89 c1                	mov    %eax,%ecx
+  802d37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d3b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d3f:	41 89 c8             	mov    %ecx,%r8d
+  802d42:	48 89 d1             	mov    %rdx,%rcx
+  802d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d4a:	48 89 c6             	mov    %rax,%rsi
+  802d4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d52:	49 89 df             	mov    %rbx,%r15
+  802d55:	48 b8 cb 8f ff ff ff 	movabs $0xffffffffffff8fcb,%rax
+  802d5c:	ff ff ff 
+  802d5f:	48 01 d8             	add    %rbx,%rax
+  802d62:	ff d0                	call   *%rax
+  802d64:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802d67:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802d6b:	78 08                	js     802d75 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802d6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802d70:	eb 43                	jmp    802db5 <dup+0x1f6>
+			goto err;
+  802d72:	90                   	nop
+  802d73:	eb 01                	jmp    802d76 <dup+0x1b7>
+		goto err;
+  802d75:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802d76:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d7a:	48 89 c6             	mov    %rax,%rsi
+  802d7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d82:	49 89 df             	mov    %rbx,%r15
+  802d85:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  802d8c:	ff ff ff 
+  802d8f:	48 01 d8             	add    %rbx,%rax
+  802d92:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802d94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d98:	48 89 c6             	mov    %rax,%rsi
+  802d9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da0:	49 89 df             	mov    %rbx,%r15
+  802da3:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  802daa:	ff ff ff 
+  802dad:	48 01 d8             	add    %rbx,%rax
+  802db0:	ff d0                	call   *%rax
+	return r;
+  802db2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802db5:	48 83 c4 40          	add    $0x40,%rsp
+  802db9:	5b                   	pop    %rbx
+  802dba:	41 5f                	pop    %r15
+  802dbc:	5d                   	pop    %rbp
+  802dbd:	c3                   	ret
+
+0000000000802dbe <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802dbe:	55                   	push   %rbp
+  802dbf:	48 89 e5             	mov    %rsp,%rbp
+  802dc2:	41 57                	push   %r15
+  802dc4:	53                   	push   %rbx
+  802dc5:	48 83 ec 40          	sub    $0x40,%rsp
+  802dc9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dc9 <read+0xb>
+  802dd0:	49 bb 6f 62 00 00 00 	movabs $0x626f,%r11
+  802dd7:	00 00 00 
+  802dda:	4c 01 db             	add    %r11,%rbx
+  802ddd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802de0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802de4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802de8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802dec:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802def:	48 89 d6             	mov    %rdx,%rsi
+  802df2:	89 c7                	mov    %eax,%edi
+  802df4:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  802dfb:	ff ff ff 
+  802dfe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e02:	ff d0                	call   *%rax
+  802e04:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e07:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e0b:	78 28                	js     802e35 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e11:	8b 00                	mov    (%rax),%eax
+  802e13:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802e17:	48 89 d6             	mov    %rdx,%rsi
+  802e1a:	89 c7                	mov    %eax,%edi
+  802e1c:	48 b8 e5 99 ff ff ff 	movabs $0xffffffffffff99e5,%rax
+  802e23:	ff ff ff 
+  802e26:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e2a:	ff d0                	call   *%rax
+  802e2c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e2f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e33:	79 08                	jns    802e3d <read+0x7f>
+		return r;
+  802e35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e38:	e9 8b 00 00 00       	jmp    802ec8 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802e3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e41:	8b 40 08             	mov    0x8(%rax),%eax
+  802e44:	83 e0 03             	and    $0x3,%eax
+  802e47:	83 f8 01             	cmp    $0x1,%eax
+  802e4a:	75 4b                	jne    802e97 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802e4c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802e53:	ff ff ff 
+  802e56:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e5a:	48 8b 00             	mov    (%rax),%rax
+  802e5d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802e63:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802e66:	89 c6                	mov    %eax,%esi
+  802e68:	48 b8 b7 e5 ff ff ff 	movabs $0xffffffffffffe5b7,%rax
+  802e6f:	ff ff ff 
+  802e72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e76:	48 89 c7             	mov    %rax,%rdi
+  802e79:	49 89 df             	mov    %rbx,%r15
+  802e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e81:	48 b9 e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rcx
+  802e88:	ff ff ff 
+  802e8b:	48 01 d9             	add    %rbx,%rcx
+  802e8e:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802e90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e95:	eb 31                	jmp    802ec8 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  802e97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e9b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802e9f:	48 85 c0             	test   %rax,%rax
+  802ea2:	75 07                	jne    802eab <read+0xed>
+		return -E_NOT_SUPP;
+  802ea4:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802ea9:	eb 1d                	jmp    802ec8 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  802eab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802eaf:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802eb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802eb7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802ebb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802ebf:	48 89 ce             	mov    %rcx,%rsi
+  802ec2:	48 89 c7             	mov    %rax,%rdi
+  802ec5:	41 ff d0             	call   *%r8
+}
+  802ec8:	48 83 c4 40          	add    $0x40,%rsp
+  802ecc:	5b                   	pop    %rbx
+  802ecd:	41 5f                	pop    %r15
+  802ecf:	5d                   	pop    %rbp
+  802ed0:	c3                   	ret
+
+0000000000802ed1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802ed1:	55                   	push   %rbp
+  802ed2:	48 89 e5             	mov    %rsp,%rbp
+  802ed5:	53                   	push   %rbx
+  802ed6:	48 83 ec 38          	sub    $0x38,%rsp
+  802eda:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802eda <readn+0x9>
+  802ee1:	49 bb 5e 61 00 00 00 	movabs $0x615e,%r11
+  802ee8:	00 00 00 
+  802eeb:	4c 01 db             	add    %r11,%rbx
+  802eee:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ef1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ef5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802ef9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802f00:	eb 4b                	jmp    802f4d <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802f02:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f05:	48 98                	cltq
+  802f07:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802f0b:	48 29 c2             	sub    %rax,%rdx
+  802f0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f11:	48 63 c8             	movslq %eax,%rcx
+  802f14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f18:	48 01 c1             	add    %rax,%rcx
+  802f1b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802f1e:	48 89 ce             	mov    %rcx,%rsi
+  802f21:	89 c7                	mov    %eax,%edi
+  802f23:	48 b8 86 9d ff ff ff 	movabs $0xffffffffffff9d86,%rax
+  802f2a:	ff ff ff 
+  802f2d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f31:	ff d0                	call   *%rax
+  802f33:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  802f36:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802f3a:	79 05                	jns    802f41 <readn+0x70>
+			return m;
+  802f3c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802f3f:	eb 1d                	jmp    802f5e <readn+0x8d>
+		if (m == 0)
+  802f41:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802f45:	74 13                	je     802f5a <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  802f47:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802f4a:	01 45 ec             	add    %eax,-0x14(%rbp)
+  802f4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f50:	48 98                	cltq
+  802f52:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  802f56:	72 aa                	jb     802f02 <readn+0x31>
+  802f58:	eb 01                	jmp    802f5b <readn+0x8a>
+			break;
+  802f5a:	90                   	nop
+	}
+	return tot;
+  802f5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802f5e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f62:	c9                   	leave
+  802f63:	c3                   	ret
+
+0000000000802f64 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802f64:	55                   	push   %rbp
+  802f65:	48 89 e5             	mov    %rsp,%rbp
+  802f68:	41 57                	push   %r15
+  802f6a:	53                   	push   %rbx
+  802f6b:	48 83 ec 40          	sub    $0x40,%rsp
+  802f6f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f6f <write+0xb>
+  802f76:	49 bb c9 60 00 00 00 	movabs $0x60c9,%r11
+  802f7d:	00 00 00 
+  802f80:	4c 01 db             	add    %r11,%rbx
+  802f83:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802f86:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802f8a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802f8e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802f92:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802f95:	48 89 d6             	mov    %rdx,%rsi
+  802f98:	89 c7                	mov    %eax,%edi
+  802f9a:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  802fa1:	ff ff ff 
+  802fa4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fa8:	ff d0                	call   *%rax
+  802faa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fb1:	78 28                	js     802fdb <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802fb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fb7:	8b 00                	mov    (%rax),%eax
+  802fb9:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802fbd:	48 89 d6             	mov    %rdx,%rsi
+  802fc0:	89 c7                	mov    %eax,%edi
+  802fc2:	48 b8 e5 99 ff ff ff 	movabs $0xffffffffffff99e5,%rax
+  802fc9:	ff ff ff 
+  802fcc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fd0:	ff d0                	call   *%rax
+  802fd2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fd5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fd9:	79 08                	jns    802fe3 <write+0x7f>
+		return r;
+  802fdb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fde:	e9 8a 00 00 00       	jmp    80306d <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802fe3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802fe7:	8b 40 08             	mov    0x8(%rax),%eax
+  802fea:	83 e0 03             	and    $0x3,%eax
+  802fed:	85 c0                	test   %eax,%eax
+  802fef:	75 4b                	jne    80303c <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802ff1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802ff8:	ff ff ff 
+  802ffb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fff:	48 8b 00             	mov    (%rax),%rax
+  803002:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803008:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80300b:	89 c6                	mov    %eax,%esi
+  80300d:	48 b8 d3 e5 ff ff ff 	movabs $0xffffffffffffe5d3,%rax
+  803014:	ff ff ff 
+  803017:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80301b:	48 89 c7             	mov    %rax,%rdi
+  80301e:	49 89 df             	mov    %rbx,%r15
+  803021:	b8 00 00 00 00       	mov    $0x0,%eax
+  803026:	48 b9 e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rcx
+  80302d:	ff ff ff 
+  803030:	48 01 d9             	add    %rbx,%rcx
+  803033:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803035:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80303a:	eb 31                	jmp    80306d <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80303c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803040:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803044:	48 85 c0             	test   %rax,%rax
+  803047:	75 07                	jne    803050 <write+0xec>
+		return -E_NOT_SUPP;
+  803049:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80304e:	eb 1d                	jmp    80306d <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803050:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803054:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803058:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80305c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803060:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803064:	48 89 ce             	mov    %rcx,%rsi
+  803067:	48 89 c7             	mov    %rax,%rdi
+  80306a:	41 ff d0             	call   *%r8
+}
+  80306d:	48 83 c4 40          	add    $0x40,%rsp
+  803071:	5b                   	pop    %rbx
+  803072:	41 5f                	pop    %r15
+  803074:	5d                   	pop    %rbp
+  803075:	c3                   	ret
+
+0000000000803076 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803076:	55                   	push   %rbp
+  803077:	48 89 e5             	mov    %rsp,%rbp
+  80307a:	48 83 ec 18          	sub    $0x18,%rsp
+  80307e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80307e <seek+0x8>
+  803085:	49 bb ba 5f 00 00 00 	movabs $0x5fba,%r11
+  80308c:	00 00 00 
+  80308f:	4c 01 d8             	add    %r11,%rax
+  803092:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803095:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803098:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  80309c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80309f:	48 89 ce             	mov    %rcx,%rsi
+  8030a2:	89 d7                	mov    %edx,%edi
+  8030a4:	48 ba 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rdx
+  8030ab:	ff ff ff 
+  8030ae:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8030b2:	ff d0                	call   *%rax
+  8030b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030b7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030bb:	79 05                	jns    8030c2 <seek+0x4c>
+		return r;
+  8030bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030c0:	eb 0f                	jmp    8030d1 <seek+0x5b>
+	fd->fd_offset = offset;
+  8030c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030c6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8030c9:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8030cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030d1:	c9                   	leave
+  8030d2:	c3                   	ret
+
+00000000008030d3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8030d3:	55                   	push   %rbp
+  8030d4:	48 89 e5             	mov    %rsp,%rbp
+  8030d7:	41 57                	push   %r15
+  8030d9:	53                   	push   %rbx
+  8030da:	48 83 ec 30          	sub    $0x30,%rsp
+  8030de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030de <ftruncate+0xb>
+  8030e5:	49 bb 5a 5f 00 00 00 	movabs $0x5f5a,%r11
+  8030ec:	00 00 00 
+  8030ef:	4c 01 db             	add    %r11,%rbx
+  8030f2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8030f5:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8030f8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8030fc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8030ff:	48 89 d6             	mov    %rdx,%rsi
+  803102:	89 c7                	mov    %eax,%edi
+  803104:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  80310b:	ff ff ff 
+  80310e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803112:	ff d0                	call   *%rax
+  803114:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803117:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80311b:	78 28                	js     803145 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80311d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803121:	8b 00                	mov    (%rax),%eax
+  803123:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803127:	48 89 d6             	mov    %rdx,%rsi
+  80312a:	89 c7                	mov    %eax,%edi
+  80312c:	48 b8 e5 99 ff ff ff 	movabs $0xffffffffffff99e5,%rax
+  803133:	ff ff ff 
+  803136:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80313a:	ff d0                	call   *%rax
+  80313c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80313f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803143:	79 08                	jns    80314d <ftruncate+0x7a>
+		return r;
+  803145:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803148:	e9 83 00 00 00       	jmp    8031d0 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80314d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803151:	8b 40 08             	mov    0x8(%rax),%eax
+  803154:	83 e0 03             	and    $0x3,%eax
+  803157:	85 c0                	test   %eax,%eax
+  803159:	75 4b                	jne    8031a6 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  80315b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803162:	ff ff ff 
+  803165:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803169:	48 8b 00             	mov    (%rax),%rax
+  80316c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803172:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803175:	89 c6                	mov    %eax,%esi
+  803177:	48 b8 f0 e5 ff ff ff 	movabs $0xffffffffffffe5f0,%rax
+  80317e:	ff ff ff 
+  803181:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803185:	48 89 c7             	mov    %rax,%rdi
+  803188:	49 89 df             	mov    %rbx,%r15
+  80318b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803190:	48 b9 e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rcx
+  803197:	ff ff ff 
+  80319a:	48 01 d9             	add    %rbx,%rcx
+  80319d:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80319f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031a4:	eb 2a                	jmp    8031d0 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8031a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031aa:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8031ae:	48 85 c0             	test   %rax,%rax
+  8031b1:	75 07                	jne    8031ba <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8031b3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8031b8:	eb 16                	jmp    8031d0 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8031ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031be:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8031c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031c6:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8031c9:	89 d6                	mov    %edx,%esi
+  8031cb:	48 89 c7             	mov    %rax,%rdi
+  8031ce:	ff d1                	call   *%rcx
+}
+  8031d0:	48 83 c4 30          	add    $0x30,%rsp
+  8031d4:	5b                   	pop    %rbx
+  8031d5:	41 5f                	pop    %r15
+  8031d7:	5d                   	pop    %rbp
+  8031d8:	c3                   	ret
+
+00000000008031d9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8031d9:	55                   	push   %rbp
+  8031da:	48 89 e5             	mov    %rsp,%rbp
+  8031dd:	53                   	push   %rbx
+  8031de:	48 83 ec 38          	sub    $0x38,%rsp
+  8031e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031e2 <fstat+0x9>
+  8031e9:	49 bb 56 5e 00 00 00 	movabs $0x5e56,%r11
+  8031f0:	00 00 00 
+  8031f3:	4c 01 db             	add    %r11,%rbx
+  8031f6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8031f9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8031fd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803201:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803204:	48 89 d6             	mov    %rdx,%rsi
+  803207:	89 c7                	mov    %eax,%edi
+  803209:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  803210:	ff ff ff 
+  803213:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803217:	ff d0                	call   *%rax
+  803219:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80321c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803220:	78 28                	js     80324a <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803222:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803226:	8b 00                	mov    (%rax),%eax
+  803228:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80322c:	48 89 d6             	mov    %rdx,%rsi
+  80322f:	89 c7                	mov    %eax,%edi
+  803231:	48 b8 e5 99 ff ff ff 	movabs $0xffffffffffff99e5,%rax
+  803238:	ff ff ff 
+  80323b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80323f:	ff d0                	call   *%rax
+  803241:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803244:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803248:	79 05                	jns    80324f <fstat+0x76>
+		return r;
+  80324a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80324d:	eb 5e                	jmp    8032ad <fstat+0xd4>
+	if (!dev->dev_stat)
+  80324f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803253:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803257:	48 85 c0             	test   %rax,%rax
+  80325a:	75 07                	jne    803263 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80325c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803261:	eb 4a                	jmp    8032ad <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803263:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803267:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80326a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80326e:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803275:	00 00 00 
+	stat->st_isdir = 0;
+  803278:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80327c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803283:	00 00 00 
+	stat->st_dev = dev;
+  803286:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80328a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80328e:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  803295:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803299:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80329d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8032a5:	48 89 d6             	mov    %rdx,%rsi
+  8032a8:	48 89 c7             	mov    %rax,%rdi
+  8032ab:	ff d1                	call   *%rcx
+}
+  8032ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032b1:	c9                   	leave
+  8032b2:	c3                   	ret
+
+00000000008032b3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8032b3:	55                   	push   %rbp
+  8032b4:	48 89 e5             	mov    %rsp,%rbp
+  8032b7:	41 57                	push   %r15
+  8032b9:	53                   	push   %rbx
+  8032ba:	48 83 ec 20          	sub    $0x20,%rsp
+  8032be:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032be <stat+0xb>
+  8032c5:	49 bb 7a 5d 00 00 00 	movabs $0x5d7a,%r11
+  8032cc:	00 00 00 
+  8032cf:	4c 01 db             	add    %r11,%rbx
+  8032d2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8032d6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8032da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032de:	be 00 00 00 00       	mov    $0x0,%esi
+  8032e3:	48 89 c7             	mov    %rax,%rdi
+  8032e6:	49 89 df             	mov    %rbx,%r15
+  8032e9:	48 b8 55 a5 ff ff ff 	movabs $0xffffffffffffa555,%rax
+  8032f0:	ff ff ff 
+  8032f3:	48 01 d8             	add    %rbx,%rax
+  8032f6:	ff d0                	call   *%rax
+  8032f8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032fb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032ff:	79 05                	jns    803306 <stat+0x53>
+		return fd;
+  803301:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803304:	eb 37                	jmp    80333d <stat+0x8a>
+	r = fstat(fd, stat);
+  803306:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80330a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80330d:	48 89 d6             	mov    %rdx,%rsi
+  803310:	89 c7                	mov    %eax,%edi
+  803312:	48 b8 a1 a1 ff ff ff 	movabs $0xffffffffffffa1a1,%rax
+  803319:	ff ff ff 
+  80331c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803320:	ff d0                	call   *%rax
+  803322:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803325:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803328:	89 c7                	mov    %eax,%edi
+  80332a:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  803331:	ff ff ff 
+  803334:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803338:	ff d0                	call   *%rax
+	return r;
+  80333a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  80333d:	48 83 c4 20          	add    $0x20,%rsp
+  803341:	5b                   	pop    %rbx
+  803342:	41 5f                	pop    %r15
+  803344:	5d                   	pop    %rbp
+  803345:	c3                   	ret
+
+0000000000803346 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803346:	55                   	push   %rbp
+  803347:	48 89 e5             	mov    %rsp,%rbp
+  80334a:	41 57                	push   %r15
+  80334c:	53                   	push   %rbx
+  80334d:	48 83 ec 10          	sub    $0x10,%rsp
+  803351:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803351 <fsipc+0xb>
+  803358:	49 bb e7 5c 00 00 00 	movabs $0x5ce7,%r11
+  80335f:	00 00 00 
+  803362:	4c 01 db             	add    %r11,%rbx
+  803365:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803368:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80336c:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803373:	00 00 00 
+  803376:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803379:	85 c0                	test   %eax,%eax
+  80337b:	75 24                	jne    8033a1 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80337d:	bf 01 00 00 00       	mov    $0x1,%edi
+  803382:	49 89 df             	mov    %rbx,%r15
+  803385:	48 b8 87 df ff ff ff 	movabs $0xffffffffffffdf87,%rax
+  80338c:	ff ff ff 
+  80338f:	48 01 d8             	add    %rbx,%rax
+  803392:	ff d0                	call   *%rax
+  803394:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  80339b:	00 00 00 
+  80339e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8033a1:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8033a8:	00 00 00 
+  8033ab:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8033ae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033b2:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8033b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8033bb:	49 89 d0             	mov    %rdx,%r8
+  8033be:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8033c3:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  8033ca:	00 00 00 
+  8033cd:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8033d1:	89 c7                	mov    %eax,%edi
+  8033d3:	49 89 df             	mov    %rbx,%r15
+  8033d6:	48 b8 a6 d9 ff ff ff 	movabs $0xffffffffffffd9a6,%rax
+  8033dd:	ff ff ff 
+  8033e0:	48 01 d8             	add    %rbx,%rax
+  8033e3:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8033e5:	48 83 c4 10          	add    $0x10,%rsp
+  8033e9:	5b                   	pop    %rbx
+  8033ea:	41 5f                	pop    %r15
+  8033ec:	5d                   	pop    %rbp
+  8033ed:	c3                   	ret
+
+00000000008033ee <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8033ee:	55                   	push   %rbp
+  8033ef:	48 89 e5             	mov    %rsp,%rbp
+  8033f2:	41 57                	push   %r15
+  8033f4:	53                   	push   %rbx
+  8033f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8033f9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033f9 <fsipc_words+0xb>
+  803400:	49 bb 3f 5c 00 00 00 	movabs $0x5c3f,%r11
+  803407:	00 00 00 
+  80340a:	4c 01 db             	add    %r11,%rbx
+  80340d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803410:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803414:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803418:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80341f:	00 00 00 
+  803422:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803425:	85 c0                	test   %eax,%eax
+  803427:	75 24                	jne    80344d <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803429:	bf 01 00 00 00       	mov    $0x1,%edi
+  80342e:	49 89 df             	mov    %rbx,%r15
+  803431:	48 b8 87 df ff ff ff 	movabs $0xffffffffffffdf87,%rax
+  803438:	ff ff ff 
+  80343b:	48 01 d8             	add    %rbx,%rax
+  80343e:	ff d0                	call   *%rax
+  803440:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  803447:	00 00 00 
+  80344a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  80344d:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  803454:	00 00 00 
+  803457:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80345a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80345e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803462:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803465:	89 c7                	mov    %eax,%edi
+  803467:	49 89 df             	mov    %rbx,%r15
+  80346a:	48 b8 91 da ff ff ff 	movabs $0xffffffffffffda91,%rax
+  803471:	ff ff ff 
+  803474:	48 01 d8             	add    %rbx,%rax
+  803477:	ff d0                	call   *%rax
+}
+  803479:	48 83 c4 20          	add    $0x20,%rsp
+  80347d:	5b                   	pop    %rbx
+  80347e:	41 5f                	pop    %r15
+  803480:	5d                   	pop    %rbp
+  803481:	c3                   	ret
+
+0000000000803482 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803482:	55                   	push   %rbp
+  803483:	48 89 e5             	mov    %rsp,%rbp
+  803486:	41 57                	push   %r15
+  803488:	53                   	push   %rbx
+  803489:	48 83 ec 40          	sub    $0x40,%rsp
+  80348d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80348d <fsipc_pages+0xb>
+  803494:	49 bb ab 5b 00 00 00 	movabs $0x5bab,%r11
+  80349b:	00 00 00 
+  80349e:	4c 01 db             	add    %r11,%rbx
+  8034a1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8034a4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8034a8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  8034ac:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  8034af:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  8034b6:	00 00 00 
+  8034b9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8034bc:	85 c0                	test   %eax,%eax
+  8034be:	75 24                	jne    8034e4 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034c0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034c5:	49 89 df             	mov    %rbx,%r15
+  8034c8:	48 b8 87 df ff ff ff 	movabs $0xffffffffffffdf87,%rax
+  8034cf:	ff ff ff 
+  8034d2:	48 01 d8             	add    %rbx,%rax
+  8034d5:	ff d0                	call   *%rax
+  8034d7:	48 ba c8 0f 00 00 00 	movabs $0xfc8,%rdx
+  8034de:	00 00 00 
+  8034e1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8034e4:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8034e9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8034ed:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8034f0:	48 98                	cltq
+  8034f2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8034f6:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8034fa:	0f 95 c0             	setne  %al
+  8034fd:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803500:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803507:	00 
+  803508:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80350c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803510:	48 01 d0             	add    %rdx,%rax
+  803513:	48 83 e8 01          	sub    $0x1,%rax
+  803517:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80351b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80351f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803524:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803528:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80352c:	48 29 d0             	sub    %rdx,%rax
+  80352f:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803533:	41 89 c2             	mov    %eax,%r10d
+  803536:	48 b8 c8 0f 00 00 00 	movabs $0xfc8,%rax
+  80353d:	00 00 00 
+  803540:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803543:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  803547:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80354b:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80354e:	48 83 ec 08          	sub    $0x8,%rsp
+  803552:	6a 40                	push   $0x40
+  803554:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  803559:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  803560:	00 
+  803561:	6a 05                	push   $0x5
+  803563:	41 89 f9             	mov    %edi,%r9d
+  803566:	49 89 c8             	mov    %rcx,%r8
+  803569:	44 89 d1             	mov    %r10d,%ecx
+  80356c:	89 c7                	mov    %eax,%edi
+  80356e:	49 89 df             	mov    %rbx,%r15
+  803571:	48 b8 8f db ff ff ff 	movabs $0xffffffffffffdb8f,%rax
+  803578:	ff ff ff 
+  80357b:	48 01 d8             	add    %rbx,%rax
+  80357e:	ff d0                	call   *%rax
+  803580:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  803584:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803588:	5b                   	pop    %rbx
+  803589:	41 5f                	pop    %r15
+  80358b:	5d                   	pop    %rbp
+  80358c:	c3                   	ret
+
+000000000080358d <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  80358d:	55                   	push   %rbp
+  80358e:	48 89 e5             	mov    %rsp,%rbp
+  803591:	41 57                	push   %r15
+  803593:	53                   	push   %rbx
+  803594:	48 83 ec 20          	sub    $0x20,%rsp
+  803598:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803598 <open+0xb>
+  80359f:	49 bb a0 5a 00 00 00 	movabs $0x5aa0,%r11
+  8035a6:	00 00 00 
+  8035a9:	4c 01 db             	add    %r11,%rbx
+  8035ac:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8035b0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  8035b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035b7:	48 89 c7             	mov    %rax,%rdi
+  8035ba:	49 89 df             	mov    %rbx,%r15
+  8035bd:	48 b8 16 82 ff ff ff 	movabs $0xffffffffffff8216,%rax
+  8035c4:	ff ff ff 
+  8035c7:	48 01 d8             	add    %rbx,%rax
+  8035ca:	ff d0                	call   *%rax
+  8035cc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8035d1:	7e 0a                	jle    8035dd <open+0x50>
+		return -E_BAD_PATH;
+  8035d3:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8035d8:	e9 18 01 00 00       	jmp    8036f5 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8035dd:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8035e1:	48 89 c7             	mov    %rax,%rdi
+  8035e4:	49 89 df             	mov    %rbx,%r15
+  8035e7:	48 b8 89 97 ff ff ff 	movabs $0xffffffffffff9789,%rax
+  8035ee:	ff ff ff 
+  8035f1:	48 01 d8             	add    %rbx,%rax
+  8035f4:	ff d0                	call   *%rax
+  8035f6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8035f9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035fd:	74 08                	je     803607 <open+0x7a>
+		return r;
+  8035ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803602:	e9 ee 00 00 00       	jmp    8036f5 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  803607:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  80360e:	00 00 00 
+  803611:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803614:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  80361b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80361f:	48 89 c6             	mov    %rax,%rsi
+  803622:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803629:	00 00 00 
+  80362c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803630:	48 89 c7             	mov    %rax,%rdi
+  803633:	49 89 df             	mov    %rbx,%r15
+  803636:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  80363d:	ff ff ff 
+  803640:	48 01 d8             	add    %rbx,%rax
+  803643:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  803645:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803649:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  80364e:	48 89 c6             	mov    %rax,%rsi
+  803651:	bf 00 00 00 00       	mov    $0x0,%edi
+  803656:	49 89 df             	mov    %rbx,%r15
+  803659:	48 b8 66 8f ff ff ff 	movabs $0xffffffffffff8f66,%rax
+  803660:	ff ff ff 
+  803663:	48 01 d8             	add    %rbx,%rax
+  803666:	ff d0                	call   *%rax
+  803668:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80366b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80366f:	74 23                	je     803694 <open+0x107>
+		fd_close(fd,0);
+  803671:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803675:	be 00 00 00 00       	mov    $0x0,%esi
+  80367a:	48 89 c7             	mov    %rax,%rdi
+  80367d:	49 89 df             	mov    %rbx,%r15
+  803680:	48 b8 ea 98 ff ff ff 	movabs $0xffffffffffff98ea,%rax
+  803687:	ff ff ff 
+  80368a:	48 01 d8             	add    %rbx,%rax
+  80368d:	ff d0                	call   *%rax
+		return r;
+  80368f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803692:	eb 61                	jmp    8036f5 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  803694:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803698:	48 89 c6             	mov    %rax,%rsi
+  80369b:	bf 01 00 00 00       	mov    $0x1,%edi
+  8036a0:	48 b8 0e a3 ff ff ff 	movabs $0xffffffffffffa30e,%rax
+  8036a7:	ff ff ff 
+  8036aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036ae:	ff d0                	call   *%rax
+  8036b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8036b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036b7:	74 23                	je     8036dc <open+0x14f>
+		fd_close(fd,0);
+  8036b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8036c2:	48 89 c7             	mov    %rax,%rdi
+  8036c5:	49 89 df             	mov    %rbx,%r15
+  8036c8:	48 b8 ea 98 ff ff ff 	movabs $0xffffffffffff98ea,%rax
+  8036cf:	ff ff ff 
+  8036d2:	48 01 d8             	add    %rbx,%rax
+  8036d5:	ff d0                	call   *%rax
+		return r;
+  8036d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036da:	eb 19                	jmp    8036f5 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8036dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036e0:	48 89 c7             	mov    %rax,%rdi
+  8036e3:	49 89 df             	mov    %rbx,%r15
+  8036e6:	48 b8 0f 97 ff ff ff 	movabs $0xffffffffffff970f,%rax
+  8036ed:	ff ff ff 
+  8036f0:	48 01 d8             	add    %rbx,%rax
+  8036f3:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8036f5:	48 83 c4 20          	add    $0x20,%rsp
+  8036f9:	5b                   	pop    %rbx
+  8036fa:	41 5f                	pop    %r15
+  8036fc:	5d                   	pop    %rbp
+  8036fd:	c3                   	ret
+
+00000000008036fe <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8036fe:	55                   	push   %rbp
+  8036ff:	48 89 e5             	mov    %rsp,%rbp
+  803702:	48 83 ec 20          	sub    $0x20,%rsp
+  803706:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803706 <devfile_flush+0x8>
+  80370d:	49 bb 32 59 00 00 00 	movabs $0x5932,%r11
+  803714:	00 00 00 
+  803717:	4c 01 d8             	add    %r11,%rax
+  80371a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  80371e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803722:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803725:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  803728:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  80372c:	ba 04 00 00 00       	mov    $0x4,%edx
+  803731:	48 89 ce             	mov    %rcx,%rsi
+  803734:	bf 06 00 00 00       	mov    $0x6,%edi
+  803739:	48 b9 b6 a3 ff ff ff 	movabs $0xffffffffffffa3b6,%rcx
+  803740:	ff ff ff 
+  803743:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803747:	ff d0                	call   *%rax
+}
+  803749:	c9                   	leave
+  80374a:	c3                   	ret
+
+000000000080374b <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  80374b:	55                   	push   %rbp
+  80374c:	48 89 e5             	mov    %rsp,%rbp
+  80374f:	41 57                	push   %r15
+  803751:	53                   	push   %rbx
+  803752:	48 83 ec 60          	sub    $0x60,%rsp
+  803756:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803756 <devfile_read+0xb>
+  80375d:	49 bb e2 58 00 00 00 	movabs $0x58e2,%r11
+  803764:	00 00 00 
+  803767:	4c 01 db             	add    %r11,%rbx
+  80376a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80376e:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803772:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  803776:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80377a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  80377e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803782:	8b 50 0c             	mov    0xc(%rax),%edx
+  803785:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803789:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80378b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80378f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  803793:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  803797:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80379b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8037a0:	ba 10 00 00 00       	mov    $0x10,%edx
+  8037a5:	48 89 c6             	mov    %rax,%rsi
+  8037a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037ad:	48 b8 4a a4 ff ff ff 	movabs $0xffffffffffffa44a,%rax
+  8037b4:	ff ff ff 
+  8037b7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8037bb:	ff d0                	call   *%rax
+  8037bd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8037c0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8037c4:	79 05                	jns    8037cb <devfile_read+0x80>
+		return r;
+  8037c6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8037c9:	eb 64                	jmp    80382f <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8037cb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8037ce:	48 63 d0             	movslq %eax,%rdx
+  8037d1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037d5:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8037da:	48 01 c1             	add    %rax,%rcx
+  8037dd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8037e1:	48 89 ce             	mov    %rcx,%rsi
+  8037e4:	48 89 c7             	mov    %rax,%rdi
+  8037e7:	49 89 df             	mov    %rbx,%r15
+  8037ea:	48 b8 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rax
+  8037f1:	ff ff ff 
+  8037f4:	48 01 d8             	add    %rbx,%rax
+  8037f7:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8037f9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803800:	ff ff ff 
+  803803:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803807:	48 8b 00             	mov    (%rax),%rax
+  80380a:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  803810:	89 c6                	mov    %eax,%esi
+  803812:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  803817:	48 89 c7             	mov    %rax,%rdi
+  80381a:	49 89 df             	mov    %rbx,%r15
+  80381d:	48 b8 41 df ff ff ff 	movabs $0xffffffffffffdf41,%rax
+  803824:	ff ff ff 
+  803827:	48 01 d8             	add    %rbx,%rax
+  80382a:	ff d0                	call   *%rax
+	return r;
+  80382c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  80382f:	48 83 c4 60          	add    $0x60,%rsp
+  803833:	5b                   	pop    %rbx
+  803834:	41 5f                	pop    %r15
+  803836:	5d                   	pop    %rbp
+  803837:	c3                   	ret
+
+0000000000803838 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  803838:	55                   	push   %rbp
+  803839:	48 89 e5             	mov    %rsp,%rbp
+  80383c:	41 57                	push   %r15
+  80383e:	53                   	push   %rbx
+  80383f:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  803843:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803843 <devfile_write+0xb>
+  80384a:	49 bb f5 57 00 00 00 	movabs $0x57f5,%r11
+  803851:	00 00 00 
+  803854:	4c 01 db             	add    %r11,%rbx
+  803857:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80385b:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  80385f:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  803866:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80386a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  80386e:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  803875:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803879:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803880:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803883:	48 63 d0             	movslq %eax,%rdx
+  803886:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80388a:	48 39 c2             	cmp    %rax,%rdx
+  80388d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803891:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  803898:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80389f:	00 
+  8038a0:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8038a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038ab:	48 01 d0             	add    %rdx,%rax
+  8038ae:	48 83 e8 01          	sub    $0x1,%rax
+  8038b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8038b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038bf:	48 f7 75 d0          	divq   -0x30(%rbp)
+  8038c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038c7:	48 29 d0             	sub    %rdx,%rax
+  8038ca:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038ce:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8038d1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8038d4:	89 c6                	mov    %eax,%esi
+  8038d6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8038db:	48 89 c7             	mov    %rax,%rdi
+  8038de:	49 89 df             	mov    %rbx,%r15
+  8038e1:	48 b8 fb de ff ff ff 	movabs $0xffffffffffffdefb,%rax
+  8038e8:	ff ff ff 
+  8038eb:	48 01 d8             	add    %rbx,%rax
+  8038ee:	ff d0                	call   *%rax
+  8038f0:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8038f3:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8038f7:	79 08                	jns    803901 <devfile_write+0xc9>
+		return r;
+  8038f9:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8038fc:	e9 8f 00 00 00       	jmp    803990 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803901:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803908:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  80390c:	48 89 c6             	mov    %rax,%rsi
+  80390f:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803914:	48 89 c7             	mov    %rax,%rdi
+  803917:	49 89 df             	mov    %rbx,%r15
+  80391a:	48 b8 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rax
+  803921:	ff ff ff 
+  803924:	48 01 d8             	add    %rbx,%rax
+  803927:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  803929:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80392d:	8b 50 0c             	mov    0xc(%rax),%edx
+  803930:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803934:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803936:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80393a:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  803941:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  803945:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  803948:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80394c:	89 d1                	mov    %edx,%ecx
+  80394e:	ba 10 00 00 00       	mov    $0x10,%edx
+  803953:	48 89 c6             	mov    %rax,%rsi
+  803956:	bf 04 00 00 00       	mov    $0x4,%edi
+  80395b:	48 b8 4a a4 ff ff ff 	movabs $0xffffffffffffa44a,%rax
+  803962:	ff ff ff 
+  803965:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803969:	ff d0                	call   *%rax
+  80396b:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80396e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803971:	89 c6                	mov    %eax,%esi
+  803973:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803978:	48 89 c7             	mov    %rax,%rdi
+  80397b:	49 89 df             	mov    %rbx,%r15
+  80397e:	48 b8 41 df ff ff ff 	movabs $0xffffffffffffdf41,%rax
+  803985:	ff ff ff 
+  803988:	48 01 d8             	add    %rbx,%rax
+  80398b:	ff d0                	call   *%rax
+	return r;
+  80398d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803990:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803994:	5b                   	pop    %rbx
+  803995:	41 5f                	pop    %r15
+  803997:	5d                   	pop    %rbp
+  803998:	c3                   	ret
+
+0000000000803999 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803999:	55                   	push   %rbp
+  80399a:	48 89 e5             	mov    %rsp,%rbp
+  80399d:	41 57                	push   %r15
+  80399f:	53                   	push   %rbx
+  8039a0:	48 83 ec 20          	sub    $0x20,%rsp
+  8039a4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039a4 <devfile_stat+0xb>
+  8039ab:	49 bb 94 56 00 00 00 	movabs $0x5694,%r11
+  8039b2:	00 00 00 
+  8039b5:	4c 01 db             	add    %r11,%rbx
+  8039b8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8039bc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8039c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8039c4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8039c7:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  8039ce:	00 00 00 
+  8039d1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8039d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8039d9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8039de:	48 b8 0e a3 ff ff ff 	movabs $0xffffffffffffa30e,%rax
+  8039e5:	ff ff ff 
+  8039e8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039ec:	ff d0                	call   *%rax
+  8039ee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039f5:	79 05                	jns    8039fc <devfile_stat+0x63>
+		return r;
+  8039f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039fa:	eb 65                	jmp    803a61 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a00:	48 ba c8 2f 01 00 00 	movabs $0x12fc8,%rdx
+  803a07:	00 00 00 
+  803a0a:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803a0e:	48 89 d6             	mov    %rdx,%rsi
+  803a11:	48 89 c7             	mov    %rax,%rdi
+  803a14:	49 89 df             	mov    %rbx,%r15
+  803a17:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  803a1e:	ff ff ff 
+  803a21:	48 01 d8             	add    %rbx,%rax
+  803a24:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803a26:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803a2d:	00 00 00 
+  803a30:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803a37:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a3b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803a41:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803a48:	00 00 00 
+  803a4b:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803a52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a56:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a61:	48 83 c4 20          	add    $0x20,%rsp
+  803a65:	5b                   	pop    %rbx
+  803a66:	41 5f                	pop    %r15
+  803a68:	5d                   	pop    %rbp
+  803a69:	c3                   	ret
+
+0000000000803a6a <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803a6a:	55                   	push   %rbp
+  803a6b:	48 89 e5             	mov    %rsp,%rbp
+  803a6e:	48 83 ec 20          	sub    $0x20,%rsp
+  803a72:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803a72 <devfile_trunc+0x8>
+  803a79:	49 bb c6 55 00 00 00 	movabs $0x55c6,%r11
+  803a80:	00 00 00 
+  803a83:	4c 01 d8             	add    %r11,%rax
+  803a86:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a8a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803a8d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a91:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803a94:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803a97:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803a9a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803a9d:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803aa1:	ba 08 00 00 00       	mov    $0x8,%edx
+  803aa6:	48 89 ce             	mov    %rcx,%rsi
+  803aa9:	bf 02 00 00 00       	mov    $0x2,%edi
+  803aae:	48 b9 b6 a3 ff ff ff 	movabs $0xffffffffffffa3b6,%rcx
+  803ab5:	ff ff ff 
+  803ab8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803abc:	ff d0                	call   *%rax
+}
+  803abe:	c9                   	leave
+  803abf:	c3                   	ret
+
+0000000000803ac0 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803ac0:	55                   	push   %rbp
+  803ac1:	48 89 e5             	mov    %rsp,%rbp
+  803ac4:	41 57                	push   %r15
+  803ac6:	53                   	push   %rbx
+  803ac7:	48 83 ec 10          	sub    $0x10,%rsp
+  803acb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803acb <remove+0xb>
+  803ad2:	49 bb 6d 55 00 00 00 	movabs $0x556d,%r11
+  803ad9:	00 00 00 
+  803adc:	4c 01 db             	add    %r11,%rbx
+  803adf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803ae3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ae7:	48 89 c7             	mov    %rax,%rdi
+  803aea:	49 89 df             	mov    %rbx,%r15
+  803aed:	48 b8 16 82 ff ff ff 	movabs $0xffffffffffff8216,%rax
+  803af4:	ff ff ff 
+  803af7:	48 01 d8             	add    %rbx,%rax
+  803afa:	ff d0                	call   *%rax
+  803afc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803b01:	7e 07                	jle    803b0a <remove+0x4a>
+		return -E_BAD_PATH;
+  803b03:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803b08:	eb 44                	jmp    803b4e <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803b0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b0e:	48 89 c6             	mov    %rax,%rsi
+  803b11:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  803b18:	00 00 00 
+  803b1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b1f:	48 89 c7             	mov    %rax,%rdi
+  803b22:	49 89 df             	mov    %rbx,%r15
+  803b25:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  803b2c:	ff ff ff 
+  803b2f:	48 01 d8             	add    %rbx,%rax
+  803b32:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803b34:	be 00 00 00 00       	mov    $0x0,%esi
+  803b39:	bf 07 00 00 00       	mov    $0x7,%edi
+  803b3e:	48 b8 0e a3 ff ff ff 	movabs $0xffffffffffffa30e,%rax
+  803b45:	ff ff ff 
+  803b48:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b4c:	ff d0                	call   *%rax
+}
+  803b4e:	48 83 c4 10          	add    $0x10,%rsp
+  803b52:	5b                   	pop    %rbx
+  803b53:	41 5f                	pop    %r15
+  803b55:	5d                   	pop    %rbp
+  803b56:	c3                   	ret
+
+0000000000803b57 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803b57:	55                   	push   %rbp
+  803b58:	48 89 e5             	mov    %rsp,%rbp
+  803b5b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b5b <sync+0x4>
+  803b62:	49 bb dd 54 00 00 00 	movabs $0x54dd,%r11
+  803b69:	00 00 00 
+  803b6c:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803b6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b74:	be 00 00 00 00       	mov    $0x0,%esi
+  803b79:	bf 08 00 00 00       	mov    $0x8,%edi
+  803b7e:	48 b9 b6 a3 ff ff ff 	movabs $0xffffffffffffa3b6,%rcx
+  803b85:	ff ff ff 
+  803b88:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803b8c:	ff d0                	call   *%rax
+}
+  803b8e:	5d                   	pop    %rbp
+  803b8f:	c3                   	ret
+
+0000000000803b90 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803b90:	55                   	push   %rbp
+  803b91:	48 89 e5             	mov    %rsp,%rbp
+  803b94:	41 57                	push   %r15
+  803b96:	53                   	push   %rbx
+  803b97:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803b9e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b9e <copy+0xe>
+  803ba5:	49 bb 9a 54 00 00 00 	movabs $0x549a,%r11
+  803bac:	00 00 00 
+  803baf:	4c 01 db             	add    %r11,%rbx
+  803bb2:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803bb9:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803bc0:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803bc7:	be 00 00 00 00       	mov    $0x0,%esi
+  803bcc:	48 89 c7             	mov    %rax,%rdi
+  803bcf:	48 b8 55 a5 ff ff ff 	movabs $0xffffffffffffa555,%rax
+  803bd6:	ff ff ff 
+  803bd9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bdd:	ff d0                	call   *%rax
+  803bdf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803be2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803be6:	79 35                	jns    803c1d <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803be8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803beb:	89 c6                	mov    %eax,%esi
+  803bed:	48 b8 16 e6 ff ff ff 	movabs $0xffffffffffffe616,%rax
+  803bf4:	ff ff ff 
+  803bf7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bfb:	48 89 c7             	mov    %rax,%rdi
+  803bfe:	49 89 df             	mov    %rbx,%r15
+  803c01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c06:	48 ba e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rdx
+  803c0d:	ff ff ff 
+  803c10:	48 01 da             	add    %rbx,%rdx
+  803c13:	ff d2                	call   *%rdx
+		return fd_src;
+  803c15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c18:	e9 d7 01 00 00       	jmp    803df4 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803c1d:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803c24:	be 01 01 00 00       	mov    $0x101,%esi
+  803c29:	48 89 c7             	mov    %rax,%rdi
+  803c2c:	48 b8 55 a5 ff ff ff 	movabs $0xffffffffffffa555,%rax
+  803c33:	ff ff ff 
+  803c36:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c3a:	ff d0                	call   *%rax
+  803c3c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803c3f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803c43:	0f 89 df 00 00 00    	jns    803d28 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803c49:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803c4c:	89 c6                	mov    %eax,%esi
+  803c4e:	48 b8 2c e6 ff ff ff 	movabs $0xffffffffffffe62c,%rax
+  803c55:	ff ff ff 
+  803c58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c5c:	48 89 c7             	mov    %rax,%rdi
+  803c5f:	49 89 df             	mov    %rbx,%r15
+  803c62:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c67:	48 ba e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rdx
+  803c6e:	ff ff ff 
+  803c71:	48 01 da             	add    %rbx,%rdx
+  803c74:	ff d2                	call   *%rdx
+		close(fd_src);
+  803c76:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c79:	89 c7                	mov    %eax,%edi
+  803c7b:	49 89 df             	mov    %rbx,%r15
+  803c7e:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  803c85:	ff ff ff 
+  803c88:	48 01 d8             	add    %rbx,%rax
+  803c8b:	ff d0                	call   *%rax
+		return fd_dest;
+  803c8d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803c90:	e9 5f 01 00 00       	jmp    803df4 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803c95:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803c98:	48 63 d0             	movslq %eax,%rdx
+  803c9b:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803ca2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ca5:	48 89 ce             	mov    %rcx,%rsi
+  803ca8:	89 c7                	mov    %eax,%edi
+  803caa:	49 89 df             	mov    %rbx,%r15
+  803cad:	48 b8 2c 9f ff ff ff 	movabs $0xffffffffffff9f2c,%rax
+  803cb4:	ff ff ff 
+  803cb7:	48 01 d8             	add    %rbx,%rax
+  803cba:	ff d0                	call   *%rax
+  803cbc:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803cbf:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803cc3:	79 63                	jns    803d28 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803cc5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803cc8:	89 c6                	mov    %eax,%esi
+  803cca:	48 b8 46 e6 ff ff ff 	movabs $0xffffffffffffe646,%rax
+  803cd1:	ff ff ff 
+  803cd4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cd8:	48 89 c7             	mov    %rax,%rdi
+  803cdb:	49 89 df             	mov    %rbx,%r15
+  803cde:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce3:	48 ba e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rdx
+  803cea:	ff ff ff 
+  803ced:	48 01 da             	add    %rbx,%rdx
+  803cf0:	ff d2                	call   *%rdx
+			close(fd_src);
+  803cf2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cf5:	89 c7                	mov    %eax,%edi
+  803cf7:	49 89 df             	mov    %rbx,%r15
+  803cfa:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  803d01:	ff ff ff 
+  803d04:	48 01 d8             	add    %rbx,%rax
+  803d07:	ff d0                	call   *%rax
+			close(fd_dest);
+  803d09:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d0c:	89 c7                	mov    %eax,%edi
+  803d0e:	49 89 df             	mov    %rbx,%r15
+  803d11:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  803d18:	ff ff ff 
+  803d1b:	48 01 d8             	add    %rbx,%rax
+  803d1e:	ff d0                	call   *%rax
+			return write_size;
+  803d20:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803d23:	e9 cc 00 00 00       	jmp    803df4 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803d28:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803d2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d32:	ba 00 02 00 00       	mov    $0x200,%edx
+  803d37:	48 89 ce             	mov    %rcx,%rsi
+  803d3a:	89 c7                	mov    %eax,%edi
+  803d3c:	49 89 df             	mov    %rbx,%r15
+  803d3f:	48 b8 86 9d ff ff ff 	movabs $0xffffffffffff9d86,%rax
+  803d46:	ff ff ff 
+  803d49:	48 01 d8             	add    %rbx,%rax
+  803d4c:	ff d0                	call   *%rax
+  803d4e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803d51:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803d55:	0f 8f 3a ff ff ff    	jg     803c95 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803d5b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803d5f:	79 60                	jns    803dc1 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803d61:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803d64:	89 c6                	mov    %eax,%esi
+  803d66:	48 b8 59 e6 ff ff ff 	movabs $0xffffffffffffe659,%rax
+  803d6d:	ff ff ff 
+  803d70:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d74:	48 89 c7             	mov    %rax,%rdi
+  803d77:	49 89 df             	mov    %rbx,%r15
+  803d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d7f:	48 ba e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rdx
+  803d86:	ff ff ff 
+  803d89:	48 01 da             	add    %rbx,%rdx
+  803d8c:	ff d2                	call   *%rdx
+		close(fd_src);
+  803d8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d91:	89 c7                	mov    %eax,%edi
+  803d93:	49 89 df             	mov    %rbx,%r15
+  803d96:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  803d9d:	ff ff ff 
+  803da0:	48 01 d8             	add    %rbx,%rax
+  803da3:	ff d0                	call   *%rax
+		close(fd_dest);
+  803da5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803da8:	89 c7                	mov    %eax,%edi
+  803daa:	49 89 df             	mov    %rbx,%r15
+  803dad:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  803db4:	ff ff ff 
+  803db7:	48 01 d8             	add    %rbx,%rax
+  803dba:	ff d0                	call   *%rax
+		return read_size;
+  803dbc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803dbf:	eb 33                	jmp    803df4 <copy+0x264>
+	}
+	close(fd_src);
+  803dc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dc4:	89 c7                	mov    %eax,%edi
+  803dc6:	49 89 df             	mov    %rbx,%r15
+  803dc9:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  803dd0:	ff ff ff 
+  803dd3:	48 01 d8             	add    %rbx,%rax
+  803dd6:	ff d0                	call   *%rax
+	close(fd_dest);
+  803dd8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ddb:	89 c7                	mov    %eax,%edi
+  803ddd:	49 89 df             	mov    %rbx,%r15
+  803de0:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  803de7:	ff ff ff 
+  803dea:	48 01 d8             	add    %rbx,%rax
+  803ded:	ff d0                	call   *%rax
+	return 0;
+  803def:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803df4:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803dfb:	5b                   	pop    %rbx
+  803dfc:	41 5f                	pop    %r15
+  803dfe:	5d                   	pop    %rbp
+  803dff:	c3                   	ret
+
+0000000000803e00 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  803e00:	55                   	push   %rbp
+  803e01:	48 89 e5             	mov    %rsp,%rbp
+  803e04:	41 57                	push   %r15
+  803e06:	53                   	push   %rbx
+  803e07:	48 81 ec 00 03 00 00 	sub    $0x300,%rsp
+  803e0e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e0e <spawn+0xe>
+  803e15:	49 bb 2a 52 00 00 00 	movabs $0x522a,%r11
+  803e1c:	00 00 00 
+  803e1f:	4c 01 db             	add    %r11,%rbx
+  803e22:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  803e29:	48 89 b5 f0 fc ff ff 	mov    %rsi,-0x310(%rbp)
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  803e30:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803e37:	be 00 00 00 00       	mov    $0x0,%esi
+  803e3c:	48 89 c7             	mov    %rax,%rdi
+  803e3f:	49 89 df             	mov    %rbx,%r15
+  803e42:	48 b8 55 a5 ff ff ff 	movabs $0xffffffffffffa555,%rax
+  803e49:	ff ff ff 
+  803e4c:	48 01 d8             	add    %rbx,%rax
+  803e4f:	ff d0                	call   *%rax
+  803e51:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803e54:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803e58:	79 08                	jns    803e62 <spawn+0x62>
+		return r;
+  803e5a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803e5d:	e9 9e 04 00 00       	jmp    804300 <spawn+0x500>
+	fd = r;
+  803e62:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803e65:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+  803e68:	48 8d 85 c0 fd ff ff 	lea    -0x240(%rbp),%rax
+  803e6f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  803e73:	48 8d 8d c0 fd ff ff 	lea    -0x240(%rbp),%rcx
+  803e7a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803e7d:	ba 00 02 00 00       	mov    $0x200,%edx
+  803e82:	48 89 ce             	mov    %rcx,%rsi
+  803e85:	89 c7                	mov    %eax,%edi
+  803e87:	49 89 df             	mov    %rbx,%r15
+  803e8a:	48 b8 99 9e ff ff ff 	movabs $0xffffffffffff9e99,%rax
+  803e91:	ff ff ff 
+  803e94:	48 01 d8             	add    %rbx,%rax
+  803e97:	ff d0                	call   *%rax
+  803e99:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803e9e:	75 0d                	jne    803ead <spawn+0xad>
+            || elf->e_magic != ELF_MAGIC) {
+  803ea0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ea4:	8b 00                	mov    (%rax),%eax
+  803ea6:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  803eab:	74 56                	je     803f03 <spawn+0x103>
+		close(fd);
+  803ead:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803eb0:	89 c7                	mov    %eax,%edi
+  803eb2:	49 89 df             	mov    %rbx,%r15
+  803eb5:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  803ebc:	ff ff ff 
+  803ebf:	48 01 d8             	add    %rbx,%rax
+  803ec2:	ff d0                	call   *%rax
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803ec4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ec8:	8b 00                	mov    (%rax),%eax
+  803eca:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803ecf:	89 c6                	mov    %eax,%esi
+  803ed1:	48 b8 70 e6 ff ff ff 	movabs $0xffffffffffffe670,%rax
+  803ed8:	ff ff ff 
+  803edb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803edf:	48 89 c7             	mov    %rax,%rdi
+  803ee2:	49 89 df             	mov    %rbx,%r15
+  803ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eea:	48 b9 e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%rcx
+  803ef1:	ff ff ff 
+  803ef4:	48 01 d9             	add    %rbx,%rcx
+  803ef7:	ff d1                	call   *%rcx
+		return -E_NOT_EXEC;
+  803ef9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803efe:	e9 fd 03 00 00       	jmp    804300 <spawn+0x500>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  803f03:	b8 07 00 00 00       	mov    $0x7,%eax
+  803f08:	cd 30                	int    $0x30
+  803f0a:	89 45 c0             	mov    %eax,-0x40(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  803f0d:	8b 45 c0             	mov    -0x40(%rbp),%eax
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  803f10:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803f13:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  803f17:	79 08                	jns    803f21 <spawn+0x121>
+		return r;
+  803f19:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803f1c:	e9 df 03 00 00       	jmp    804300 <spawn+0x500>
+	child = r;
+  803f21:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803f24:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  803f27:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803f2a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f2f:	89 c1                	mov    %eax,%ecx
+  803f31:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  803f38:	ff ff ff 
+  803f3b:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  803f3f:	48 63 c1             	movslq %ecx,%rax
+  803f42:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803f49:	48 01 d0             	add    %rdx,%rax
+  803f4c:	48 8b 30             	mov    (%rax),%rsi
+  803f4f:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  803f53:	48 89 b5 00 fd ff ff 	mov    %rsi,-0x300(%rbp)
+  803f5a:	48 89 bd 08 fd ff ff 	mov    %rdi,-0x2f8(%rbp)
+  803f61:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  803f65:	48 8b 78 18          	mov    0x18(%rax),%rdi
+  803f69:	48 89 b5 10 fd ff ff 	mov    %rsi,-0x2f0(%rbp)
+  803f70:	48 89 bd 18 fd ff ff 	mov    %rdi,-0x2e8(%rbp)
+  803f77:	48 8b 70 20          	mov    0x20(%rax),%rsi
+  803f7b:	48 8b 78 28          	mov    0x28(%rax),%rdi
+  803f7f:	48 89 b5 20 fd ff ff 	mov    %rsi,-0x2e0(%rbp)
+  803f86:	48 89 bd 28 fd ff ff 	mov    %rdi,-0x2d8(%rbp)
+  803f8d:	48 8b 70 30          	mov    0x30(%rax),%rsi
+  803f91:	48 8b 78 38          	mov    0x38(%rax),%rdi
+  803f95:	48 89 b5 30 fd ff ff 	mov    %rsi,-0x2d0(%rbp)
+  803f9c:	48 89 bd 38 fd ff ff 	mov    %rdi,-0x2c8(%rbp)
+  803fa3:	48 8b 70 40          	mov    0x40(%rax),%rsi
+  803fa7:	48 8b 78 48          	mov    0x48(%rax),%rdi
+  803fab:	48 89 b5 40 fd ff ff 	mov    %rsi,-0x2c0(%rbp)
+  803fb2:	48 89 bd 48 fd ff ff 	mov    %rdi,-0x2b8(%rbp)
+  803fb9:	48 8b 70 50          	mov    0x50(%rax),%rsi
+  803fbd:	48 8b 78 58          	mov    0x58(%rax),%rdi
+  803fc1:	48 89 b5 50 fd ff ff 	mov    %rsi,-0x2b0(%rbp)
+  803fc8:	48 89 bd 58 fd ff ff 	mov    %rdi,-0x2a8(%rbp)
+  803fcf:	48 8b 70 60          	mov    0x60(%rax),%rsi
+  803fd3:	48 8b 78 68          	mov    0x68(%rax),%rdi
+  803fd7:	48 89 b5 60 fd ff ff 	mov    %rsi,-0x2a0(%rbp)
+  803fde:	48 89 bd 68 fd ff ff 	mov    %rdi,-0x298(%rbp)
+  803fe5:	48 8b 70 70          	mov    0x70(%rax),%rsi
+  803fe9:	48 8b 78 78          	mov    0x78(%rax),%rdi
+  803fed:	48 89 b5 70 fd ff ff 	mov    %rsi,-0x290(%rbp)
+  803ff4:	48 89 bd 78 fd ff ff 	mov    %rdi,-0x288(%rbp)
+  803ffb:	48 8b b0 80 00 00 00 	mov    0x80(%rax),%rsi
+  804002:	48 8b b8 88 00 00 00 	mov    0x88(%rax),%rdi
+  804009:	48 89 b5 80 fd ff ff 	mov    %rsi,-0x280(%rbp)
+  804010:	48 89 bd 88 fd ff ff 	mov    %rdi,-0x278(%rbp)
+  804017:	48 8b b0 90 00 00 00 	mov    0x90(%rax),%rsi
+  80401e:	48 8b b8 98 00 00 00 	mov    0x98(%rax),%rdi
+  804025:	48 89 b5 90 fd ff ff 	mov    %rsi,-0x270(%rbp)
+  80402c:	48 89 bd 98 fd ff ff 	mov    %rdi,-0x268(%rbp)
+  804033:	48 8b b0 a0 00 00 00 	mov    0xa0(%rax),%rsi
+  80403a:	48 8b b8 a8 00 00 00 	mov    0xa8(%rax),%rdi
+  804041:	48 89 b5 a0 fd ff ff 	mov    %rsi,-0x260(%rbp)
+  804048:	48 89 bd a8 fd ff ff 	mov    %rdi,-0x258(%rbp)
+  80404f:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  804056:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  80405d:	48 89 85 b0 fd ff ff 	mov    %rax,-0x250(%rbp)
+  804064:	48 89 95 b8 fd ff ff 	mov    %rdx,-0x248(%rbp)
+	child_tf.tf_rip = elf->e_entry;
+  80406b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80406f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804073:	48 89 85 98 fd ff ff 	mov    %rax,-0x268(%rbp)
+
+	if ((r = init_stack(child, argv, &child_tf.tf_rsp)) < 0)
+  80407a:	48 8d 85 00 fd ff ff 	lea    -0x300(%rbp),%rax
+  804081:	48 8d 90 b0 00 00 00 	lea    0xb0(%rax),%rdx
+  804088:	48 8b 8d f0 fc ff ff 	mov    -0x310(%rbp),%rcx
+  80408f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804092:	48 89 ce             	mov    %rcx,%rsi
+  804095:	89 c7                	mov    %eax,%edi
+  804097:	48 b8 56 b5 ff ff ff 	movabs $0xffffffffffffb556,%rax
+  80409e:	ff ff ff 
+  8040a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040a5:	ff d0                	call   *%rax
+  8040a7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8040aa:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8040ae:	79 08                	jns    8040b8 <spawn+0x2b8>
+		return r;
+  8040b0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8040b3:	e9 48 02 00 00       	jmp    804300 <spawn+0x500>
+
+	// Set up program segments as defined in ELF header.
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  8040b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040bc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8040c0:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8040c7:	48 01 d0             	add    %rdx,%rax
+  8040ca:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8040ce:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8040d5:	e9 84 00 00 00       	jmp    80415e <spawn+0x35e>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8040da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040de:	8b 00                	mov    (%rax),%eax
+  8040e0:	83 f8 01             	cmp    $0x1,%eax
+  8040e3:	75 6f                	jne    804154 <spawn+0x354>
+			continue;
+		perm = PTE_P | PTE_U;
+  8040e5:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8040ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040f0:	8b 40 04             	mov    0x4(%rax),%eax
+  8040f3:	83 e0 02             	and    $0x2,%eax
+  8040f6:	85 c0                	test   %eax,%eax
+  8040f8:	74 04                	je     8040fe <spawn+0x2fe>
+			perm |= PTE_W;
+  8040fa:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+				     fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  8040fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804102:	48 8b 40 08          	mov    0x8(%rax),%rax
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  804106:	41 89 c1             	mov    %eax,%r9d
+  804109:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80410d:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  804111:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804115:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  804119:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80411d:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  804121:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  804124:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804127:	48 83 ec 08          	sub    $0x8,%rsp
+  80412b:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80412e:	57                   	push   %rdi
+  80412f:	89 c7                	mov    %eax,%edi
+  804131:	48 b8 68 b8 ff ff ff 	movabs $0xffffffffffffb868,%rax
+  804138:	ff ff ff 
+  80413b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80413f:	ff d0                	call   *%rax
+  804141:	48 83 c4 10          	add    $0x10,%rsp
+  804145:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804148:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80414c:	0f 88 7c 01 00 00    	js     8042ce <spawn+0x4ce>
+  804152:	eb 01                	jmp    804155 <spawn+0x355>
+			continue;
+  804154:	90                   	nop
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  804155:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804159:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  80415e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804162:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  804166:	0f b7 c0             	movzwl %ax,%eax
+  804169:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80416c:	0f 8c 68 ff ff ff    	jl     8040da <spawn+0x2da>
+			goto error;
+	}
+	close(fd);
+  804172:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804175:	89 c7                	mov    %eax,%edi
+  804177:	49 89 df             	mov    %rbx,%r15
+  80417a:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  804181:	ff ff ff 
+  804184:	48 01 d8             	add    %rbx,%rax
+  804187:	ff d0                	call   *%rax
+	fd = -1;
+  804189:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+	// Copy shared library state.
+	if ((r = copy_shared_pages(child)) < 0)
+  804190:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804193:	89 c7                	mov    %eax,%edi
+  804195:	48 b8 2f bd ff ff ff 	movabs $0xffffffffffffbd2f,%rax
+  80419c:	ff ff ff 
+  80419f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041a3:	ff d0                	call   *%rax
+  8041a5:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8041a8:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8041ac:	79 44                	jns    8041f2 <spawn+0x3f2>
+		panic("copy_shared_pages: %e", r);
+  8041ae:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8041b1:	89 c1                	mov    %eax,%ecx
+  8041b3:	48 b8 8a e6 ff ff ff 	movabs $0xffffffffffffe68a,%rax
+  8041ba:	ff ff ff 
+  8041bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041c1:	48 89 c2             	mov    %rax,%rdx
+  8041c4:	be 82 00 00 00       	mov    $0x82,%esi
+  8041c9:	48 b8 a0 e6 ff ff ff 	movabs $0xffffffffffffe6a0,%rax
+  8041d0:	ff ff ff 
+  8041d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041d7:	48 89 c7             	mov    %rax,%rdi
+  8041da:	49 89 df             	mov    %rbx,%r15
+  8041dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e2:	49 b8 11 72 ff ff ff 	movabs $0xffffffffffff7211,%r8
+  8041e9:	ff ff ff 
+  8041ec:	49 01 d8             	add    %rbx,%r8
+  8041ef:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8041f2:	48 8d 95 00 fd ff ff 	lea    -0x300(%rbp),%rdx
+  8041f9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8041fc:	48 89 d6             	mov    %rdx,%rsi
+  8041ff:	89 c7                	mov    %eax,%edi
+  804201:	49 89 df             	mov    %rbx,%r15
+  804204:	48 b8 fd 90 ff ff ff 	movabs $0xffffffffffff90fd,%rax
+  80420b:	ff ff ff 
+  80420e:	48 01 d8             	add    %rbx,%rax
+  804211:	ff d0                	call   *%rax
+  804213:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804216:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80421a:	79 44                	jns    804260 <spawn+0x460>
+		panic("sys_env_set_trapframe: %e", r);
+  80421c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80421f:	89 c1                	mov    %eax,%ecx
+  804221:	48 b8 ac e6 ff ff ff 	movabs $0xffffffffffffe6ac,%rax
+  804228:	ff ff ff 
+  80422b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80422f:	48 89 c2             	mov    %rax,%rdx
+  804232:	be 85 00 00 00       	mov    $0x85,%esi
+  804237:	48 b8 a0 e6 ff ff ff 	movabs $0xffffffffffffe6a0,%rax
+  80423e:	ff ff ff 
+  804241:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804245:	48 89 c7             	mov    %rax,%rdi
+  804248:	49 89 df             	mov    %rbx,%r15
+  80424b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804250:	49 b8 11 72 ff ff ff 	movabs $0xffffffffffff7211,%r8
+  804257:	ff ff ff 
+  80425a:	49 01 d8             	add    %rbx,%r8
+  80425d:	41 ff d0             	call   *%r8
+
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  804260:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804263:	be 02 00 00 00       	mov    $0x2,%esi
+  804268:	89 c7                	mov    %eax,%edi
+  80426a:	49 89 df             	mov    %rbx,%r15
+  80426d:	48 b8 9d 90 ff ff ff 	movabs $0xffffffffffff909d,%rax
+  804274:	ff ff ff 
+  804277:	48 01 d8             	add    %rbx,%rax
+  80427a:	ff d0                	call   *%rax
+  80427c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80427f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804283:	79 44                	jns    8042c9 <spawn+0x4c9>
+		panic("sys_env_set_status: %e", r);
+  804285:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804288:	89 c1                	mov    %eax,%ecx
+  80428a:	48 b8 c6 e6 ff ff ff 	movabs $0xffffffffffffe6c6,%rax
+  804291:	ff ff ff 
+  804294:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804298:	48 89 c2             	mov    %rax,%rdx
+  80429b:	be 88 00 00 00       	mov    $0x88,%esi
+  8042a0:	48 b8 a0 e6 ff ff ff 	movabs $0xffffffffffffe6a0,%rax
+  8042a7:	ff ff ff 
+  8042aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042ae:	48 89 c7             	mov    %rax,%rdi
+  8042b1:	49 89 df             	mov    %rbx,%r15
+  8042b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b9:	49 b8 11 72 ff ff ff 	movabs $0xffffffffffff7211,%r8
+  8042c0:	ff ff ff 
+  8042c3:	49 01 d8             	add    %rbx,%r8
+  8042c6:	41 ff d0             	call   *%r8
+
+	return child;
+  8042c9:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8042cc:	eb 32                	jmp    804300 <spawn+0x500>
+			goto error;
+  8042ce:	90                   	nop
+
+error:
+	sys_env_destroy(child);
+  8042cf:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8042d2:	89 c7                	mov    %eax,%edi
+  8042d4:	49 89 df             	mov    %rbx,%r15
+  8042d7:	48 b8 61 8e ff ff ff 	movabs $0xffffffffffff8e61,%rax
+  8042de:	ff ff ff 
+  8042e1:	48 01 d8             	add    %rbx,%rax
+  8042e4:	ff d0                	call   *%rax
+	close(fd);
+  8042e6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8042e9:	89 c7                	mov    %eax,%edi
+  8042eb:	49 89 df             	mov    %rbx,%r15
+  8042ee:	48 b8 ce 9a ff ff ff 	movabs $0xffffffffffff9ace,%rax
+  8042f5:	ff ff ff 
+  8042f8:	48 01 d8             	add    %rbx,%rax
+  8042fb:	ff d0                	call   *%rax
+	return r;
+  8042fd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  804300:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804304:	5b                   	pop    %rbx
+  804305:	41 5f                	pop    %r15
+  804307:	5d                   	pop    %rbp
+  804308:	c3                   	ret
+
+0000000000804309 <spawnl>:
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...)
+{
+  804309:	55                   	push   %rbp
+  80430a:	48 89 e5             	mov    %rsp,%rbp
+  80430d:	41 57                	push   %r15
+  80430f:	41 56                	push   %r14
+  804311:	41 55                	push   %r13
+  804313:	41 54                	push   %r12
+  804315:	53                   	push   %rbx
+  804316:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80431d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80431d <spawnl+0x14>
+  804324:	49 bb 1b 4d 00 00 00 	movabs $0x4d1b,%r11
+  80432b:	00 00 00 
+  80432e:	4d 01 da             	add    %r11,%r10
+  804331:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  804338:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  80433f:	48 89 95 30 ff ff ff 	mov    %rdx,-0xd0(%rbp)
+  804346:	48 89 8d 38 ff ff ff 	mov    %rcx,-0xc8(%rbp)
+  80434d:	4c 89 85 40 ff ff ff 	mov    %r8,-0xc0(%rbp)
+  804354:	4c 89 8d 48 ff ff ff 	mov    %r9,-0xb8(%rbp)
+  80435b:	84 c0                	test   %al,%al
+  80435d:	74 29                	je     804388 <spawnl+0x7f>
+  80435f:	0f 29 85 50 ff ff ff 	movaps %xmm0,-0xb0(%rbp)
+  804366:	0f 29 8d 60 ff ff ff 	movaps %xmm1,-0xa0(%rbp)
+  80436d:	0f 29 95 70 ff ff ff 	movaps %xmm2,-0x90(%rbp)
+  804374:	0f 29 5d 80          	movaps %xmm3,-0x80(%rbp)
+  804378:	0f 29 65 90          	movaps %xmm4,-0x70(%rbp)
+  80437c:	0f 29 6d a0          	movaps %xmm5,-0x60(%rbp)
+  804380:	0f 29 75 b0          	movaps %xmm6,-0x50(%rbp)
+  804384:	0f 29 7d c0          	movaps %xmm7,-0x40(%rbp)
+  804388:	48 89 e0             	mov    %rsp,%rax
+  80438b:	48 89 c3             	mov    %rax,%rbx
+	// We calculate argc by advancing the args until we hit NULL.
+	// The contract of the function guarantees that the last
+	// argument will always be NULL, and that none of the other
+	// arguments will be NULL.
+	int argc=0;
+  80438e:	c7 85 1c ff ff ff 00 	movl   $0x0,-0xe4(%rbp)
+  804395:	00 00 00 
+	va_list vl;
+	va_start(vl, arg0);
+  804398:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  80439f:	00 00 00 
+  8043a2:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  8043a9:	00 00 00 
+  8043ac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8043b0:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  8043b7:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  8043be:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  8043c5:	eb 07                	jmp    8043ce <spawnl+0xc5>
+		argc++;
+  8043c7:	83 85 1c ff ff ff 01 	addl   $0x1,-0xe4(%rbp)
+	while(va_arg(vl, void *) != NULL)
+  8043ce:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8043d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8043d7:	77 23                	ja     8043fc <spawnl+0xf3>
+  8043d9:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  8043e0:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  8043e6:	89 d2                	mov    %edx,%edx
+  8043e8:	48 01 d0             	add    %rdx,%rax
+  8043eb:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  8043f1:	83 c2 08             	add    $0x8,%edx
+  8043f4:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  8043fa:	eb 12                	jmp    80440e <spawnl+0x105>
+  8043fc:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  804403:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804407:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80440e:	48 8b 00             	mov    (%rax),%rax
+  804411:	48 85 c0             	test   %rax,%rax
+  804414:	75 b1                	jne    8043c7 <spawnl+0xbe>
+	va_end(vl);
+
+	// Now that we have the size of the args, do a second pass
+	// and store the values in a VLA, which has the format of argv
+	const char *argv[argc+2];
+  804416:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  80441c:	83 c0 02             	add    $0x2,%eax
+  80441f:	48 63 d0             	movslq %eax,%rdx
+  804422:	48 83 ea 01          	sub    $0x1,%rdx
+  804426:	48 89 95 10 ff ff ff 	mov    %rdx,-0xf0(%rbp)
+  80442d:	48 63 d0             	movslq %eax,%rdx
+  804430:	49 89 d6             	mov    %rdx,%r14
+  804433:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  804439:	48 63 d0             	movslq %eax,%rdx
+  80443c:	49 89 d4             	mov    %rdx,%r12
+  80443f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804445:	48 98                	cltq
+  804447:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80444e:	00 
+  80444f:	b8 10 00 00 00       	mov    $0x10,%eax
+  804454:	48 83 e8 01          	sub    $0x1,%rax
+  804458:	48 01 d0             	add    %rdx,%rax
+  80445b:	be 10 00 00 00       	mov    $0x10,%esi
+  804460:	ba 00 00 00 00       	mov    $0x0,%edx
+  804465:	48 f7 f6             	div    %rsi
+  804468:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  80446c:	48 29 c4             	sub    %rax,%rsp
+  80446f:	48 89 e0             	mov    %rsp,%rax
+  804472:	48 83 c0 07          	add    $0x7,%rax
+  804476:	48 c1 e8 03          	shr    $0x3,%rax
+  80447a:	48 c1 e0 03          	shl    $0x3,%rax
+  80447e:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+	argv[0] = arg0;
+  804485:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80448c:	48 8b 95 e0 fe ff ff 	mov    -0x120(%rbp),%rdx
+  804493:	48 89 10             	mov    %rdx,(%rax)
+	argv[argc+1] = NULL;
+  804496:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  80449c:	8d 50 01             	lea    0x1(%rax),%edx
+  80449f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8044a6:	48 63 d2             	movslq %edx,%rdx
+  8044a9:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  8044b0:	00 
+
+	va_start(vl, arg0);
+  8044b1:	c7 85 f0 fe ff ff 10 	movl   $0x10,-0x110(%rbp)
+  8044b8:	00 00 00 
+  8044bb:	c7 85 f4 fe ff ff 30 	movl   $0x30,-0x10c(%rbp)
+  8044c2:	00 00 00 
+  8044c5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044c9:	48 89 85 f8 fe ff ff 	mov    %rax,-0x108(%rbp)
+  8044d0:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  8044d7:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+	unsigned i;
+	for(i=0;i<argc;i++)
+  8044de:	c7 85 18 ff ff ff 00 	movl   $0x0,-0xe8(%rbp)
+  8044e5:	00 00 00 
+  8044e8:	eb 60                	jmp    80454a <spawnl+0x241>
+		argv[i+1] = va_arg(vl, const char *);
+  8044ea:	8b 85 18 ff ff ff    	mov    -0xe8(%rbp),%eax
+  8044f0:	8d 48 01             	lea    0x1(%rax),%ecx
+  8044f3:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8044f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8044fc:	77 23                	ja     804521 <spawnl+0x218>
+  8044fe:	48 8b 85 00 ff ff ff 	mov    -0x100(%rbp),%rax
+  804505:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  80450b:	89 d2                	mov    %edx,%edx
+  80450d:	48 01 d0             	add    %rdx,%rax
+  804510:	8b 95 f0 fe ff ff    	mov    -0x110(%rbp),%edx
+  804516:	83 c2 08             	add    $0x8,%edx
+  804519:	89 95 f0 fe ff ff    	mov    %edx,-0x110(%rbp)
+  80451f:	eb 12                	jmp    804533 <spawnl+0x22a>
+  804521:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  804528:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80452c:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  804533:	48 8b 10             	mov    (%rax),%rdx
+  804536:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80453d:	89 c9                	mov    %ecx,%ecx
+  80453f:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+	for(i=0;i<argc;i++)
+  804543:	83 85 18 ff ff ff 01 	addl   $0x1,-0xe8(%rbp)
+  80454a:	8b 85 1c ff ff ff    	mov    -0xe4(%rbp),%eax
+  804550:	39 85 18 ff ff ff    	cmp    %eax,-0xe8(%rbp)
+  804556:	72 92                	jb     8044ea <spawnl+0x1e1>
+	va_end(vl);
+	return spawn(prog, argv);
+  804558:	48 8b 95 08 ff ff ff 	mov    -0xf8(%rbp),%rdx
+  80455f:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  804566:	48 89 d6             	mov    %rdx,%rsi
+  804569:	48 89 c7             	mov    %rax,%rdi
+  80456c:	48 b8 c8 ad ff ff ff 	movabs $0xffffffffffffadc8,%rax
+  804573:	ff ff ff 
+  804576:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80457a:	ff d0                	call   *%rax
+  80457c:	48 89 dc             	mov    %rbx,%rsp
+}
+  80457f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804583:	5b                   	pop    %rbx
+  804584:	41 5c                	pop    %r12
+  804586:	41 5d                	pop    %r13
+  804588:	41 5e                	pop    %r14
+  80458a:	41 5f                	pop    %r15
+  80458c:	5d                   	pop    %rbp
+  80458d:	c3                   	ret
+
+000000000080458e <init_stack>:
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp)
+{
+  80458e:	55                   	push   %rbp
+  80458f:	48 89 e5             	mov    %rsp,%rbp
+  804592:	41 57                	push   %r15
+  804594:	53                   	push   %rbx
+  804595:	48 83 ec 50          	sub    $0x50,%rsp
+  804599:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804599 <init_stack+0xb>
+  8045a0:	49 bb 9f 4a 00 00 00 	movabs $0x4a9f,%r11
+  8045a7:	00 00 00 
+  8045aa:	4c 01 db             	add    %r11,%rbx
+  8045ad:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8045b0:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  8045b4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+	char *string_store;
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+  8045b8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8045bf:	00 
+	for (argc = 0; argv[argc] != 0; argc++)
+  8045c0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  8045c7:	eb 39                	jmp    804602 <init_stack+0x74>
+		string_size += strlen(argv[argc]) + 1;
+  8045c9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045cc:	48 98                	cltq
+  8045ce:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8045d5:	00 
+  8045d6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8045da:	48 01 d0             	add    %rdx,%rax
+  8045dd:	48 8b 00             	mov    (%rax),%rax
+  8045e0:	48 89 c7             	mov    %rax,%rdi
+  8045e3:	49 89 df             	mov    %rbx,%r15
+  8045e6:	48 b8 16 82 ff ff ff 	movabs $0xffffffffffff8216,%rax
+  8045ed:	ff ff ff 
+  8045f0:	48 01 d8             	add    %rbx,%rax
+  8045f3:	ff d0                	call   *%rax
+  8045f5:	83 c0 01             	add    $0x1,%eax
+  8045f8:	48 98                	cltq
+  8045fa:	48 01 45 e8          	add    %rax,-0x18(%rbp)
+	for (argc = 0; argv[argc] != 0; argc++)
+  8045fe:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  804602:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804605:	48 98                	cltq
+  804607:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80460e:	00 
+  80460f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804613:	48 01 d0             	add    %rdx,%rax
+  804616:	48 8b 00             	mov    (%rax),%rax
+  804619:	48 85 c0             	test   %rax,%rax
+  80461c:	75 ab                	jne    8045c9 <init_stack+0x3b>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  80461e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804622:	48 f7 d8             	neg    %rax
+  804625:	48 05 00 10 40 00    	add    $0x401000,%rax
+  80462b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  80462f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804633:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804637:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80463b:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  80463f:	48 89 c2             	mov    %rax,%rdx
+  804642:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804645:	83 c0 01             	add    $0x1,%eax
+  804648:	c1 e0 03             	shl    $0x3,%eax
+  80464b:	48 98                	cltq
+  80464d:	48 f7 d8             	neg    %rax
+  804650:	48 01 d0             	add    %rdx,%rax
+  804653:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  804657:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80465b:	48 83 e8 10          	sub    $0x10,%rax
+  80465f:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  804665:	77 0a                	ja     804671 <init_stack+0xe3>
+		return -E_NO_MEM;
+  804667:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80466c:	e9 26 02 00 00       	jmp    804897 <init_stack+0x309>
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  804671:	ba 07 00 00 00       	mov    $0x7,%edx
+  804676:	be 00 00 40 00       	mov    $0x400000,%esi
+  80467b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804680:	49 89 df             	mov    %rbx,%r15
+  804683:	48 b8 66 8f ff ff ff 	movabs $0xffffffffffff8f66,%rax
+  80468a:	ff ff ff 
+  80468d:	48 01 d8             	add    %rbx,%rax
+  804690:	ff d0                	call   *%rax
+  804692:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804695:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804699:	79 08                	jns    8046a3 <init_stack+0x115>
+		return r;
+  80469b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80469e:	e9 f4 01 00 00       	jmp    804897 <init_stack+0x309>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8046a3:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+  8046aa:	e9 96 00 00 00       	jmp    804745 <init_stack+0x1b7>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8046af:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  8046b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046b8:	48 01 d0             	add    %rdx,%rax
+  8046bb:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  8046c2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8046c5:	48 98                	cltq
+  8046c7:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  8046ce:	00 
+  8046cf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046d3:	48 01 c8             	add    %rcx,%rax
+  8046d6:	48 89 10             	mov    %rdx,(%rax)
+		strcpy(string_store, argv[i]);
+  8046d9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8046dc:	48 98                	cltq
+  8046de:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8046e5:	00 
+  8046e6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8046ea:	48 01 d0             	add    %rdx,%rax
+  8046ed:	48 8b 10             	mov    (%rax),%rdx
+  8046f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046f4:	48 89 d6             	mov    %rdx,%rsi
+  8046f7:	48 89 c7             	mov    %rax,%rdi
+  8046fa:	49 89 df             	mov    %rbx,%r15
+  8046fd:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  804704:	ff ff ff 
+  804707:	48 01 d8             	add    %rbx,%rax
+  80470a:	ff d0                	call   *%rax
+		string_store += strlen(argv[i]) + 1;
+  80470c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80470f:	48 98                	cltq
+  804711:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804718:	00 
+  804719:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80471d:	48 01 d0             	add    %rdx,%rax
+  804720:	48 8b 00             	mov    (%rax),%rax
+  804723:	48 89 c7             	mov    %rax,%rdi
+  804726:	49 89 df             	mov    %rbx,%r15
+  804729:	48 b8 16 82 ff ff ff 	movabs $0xffffffffffff8216,%rax
+  804730:	ff ff ff 
+  804733:	48 01 d8             	add    %rbx,%rax
+  804736:	ff d0                	call   *%rax
+  804738:	83 c0 01             	add    $0x1,%eax
+  80473b:	48 98                	cltq
+  80473d:	48 01 45 d0          	add    %rax,-0x30(%rbp)
+	for (i = 0; i < argc; i++) {
+  804741:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+  804745:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804748:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80474b:	0f 8c 5e ff ff ff    	jl     8046af <init_stack+0x121>
+	}
+	argv_store[argc] = 0;
+  804751:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804754:	48 98                	cltq
+  804756:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80475d:	00 
+  80475e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804762:	48 01 d0             	add    %rdx,%rax
+  804765:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80476c:	48 81 7d d0 00 10 40 	cmpq   $0x401000,-0x30(%rbp)
+  804773:	00 
+  804774:	74 50                	je     8047c6 <init_stack+0x238>
+  804776:	48 b8 e0 e6 ff ff ff 	movabs $0xffffffffffffe6e0,%rax
+  80477d:	ff ff ff 
+  804780:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804784:	48 89 c1             	mov    %rax,%rcx
+  804787:	48 b8 06 e7 ff ff ff 	movabs $0xffffffffffffe706,%rax
+  80478e:	ff ff ff 
+  804791:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804795:	48 89 c2             	mov    %rax,%rdx
+  804798:	be f1 00 00 00       	mov    $0xf1,%esi
+  80479d:	48 b8 a0 e6 ff ff ff 	movabs $0xffffffffffffe6a0,%rax
+  8047a4:	ff ff ff 
+  8047a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047ab:	48 89 c7             	mov    %rax,%rdi
+  8047ae:	49 89 df             	mov    %rbx,%r15
+  8047b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b6:	49 b8 11 72 ff ff ff 	movabs $0xffffffffffff7211,%r8
+  8047bd:	ff ff ff 
+  8047c0:	49 01 d8             	add    %rbx,%r8
+  8047c3:	41 ff d0             	call   *%r8
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8047c6:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  8047cb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047cf:	48 01 d0             	add    %rdx,%rax
+  8047d2:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  8047d9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047dd:	48 83 e8 08          	sub    $0x8,%rax
+  8047e1:	48 89 10             	mov    %rdx,(%rax)
+	argv_store[-2] = argc;
+  8047e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047e8:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  8047ec:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8047ef:	48 98                	cltq
+  8047f1:	48 89 02             	mov    %rax,(%rdx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8047f4:	ba f0 cf 7f ef       	mov    $0xef7fcff0,%edx
+  8047f9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047fd:	48 01 d0             	add    %rdx,%rax
+  804800:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  804806:	48 89 c2             	mov    %rax,%rdx
+  804809:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80480d:	48 89 10             	mov    %rdx,(%rax)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  804810:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804813:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  804819:	ba 00 d0 7f ef       	mov    $0xef7fd000,%edx
+  80481e:	48 89 d1             	mov    %rdx,%rcx
+  804821:	89 c2                	mov    %eax,%edx
+  804823:	be 00 00 40 00       	mov    $0x400000,%esi
+  804828:	bf 00 00 00 00       	mov    $0x0,%edi
+  80482d:	49 89 df             	mov    %rbx,%r15
+  804830:	48 b8 cb 8f ff ff ff 	movabs $0xffffffffffff8fcb,%rax
+  804837:	ff ff ff 
+  80483a:	48 01 d8             	add    %rbx,%rax
+  80483d:	ff d0                	call   *%rax
+  80483f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804842:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804846:	78 2c                	js     804874 <init_stack+0x2e6>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  804848:	be 00 00 40 00       	mov    $0x400000,%esi
+  80484d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804852:	49 89 df             	mov    %rbx,%r15
+  804855:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  80485c:	ff ff ff 
+  80485f:	48 01 d8             	add    %rbx,%rax
+  804862:	ff d0                	call   *%rax
+  804864:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804867:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80486b:	78 0a                	js     804877 <init_stack+0x2e9>
+		goto error;
+
+	return 0;
+  80486d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804872:	eb 23                	jmp    804897 <init_stack+0x309>
+		goto error;
+  804874:	90                   	nop
+  804875:	eb 01                	jmp    804878 <init_stack+0x2ea>
+		goto error;
+  804877:	90                   	nop
+
+error:
+	sys_page_unmap(0, UTEMP);
+  804878:	be 00 00 40 00       	mov    $0x400000,%esi
+  80487d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804882:	49 89 df             	mov    %rbx,%r15
+  804885:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  80488c:	ff ff ff 
+  80488f:	48 01 d8             	add    %rbx,%rax
+  804892:	ff d0                	call   *%rax
+	return r;
+  804894:	8b 45 dc             	mov    -0x24(%rbp),%eax
+}
+  804897:	48 83 c4 50          	add    $0x50,%rsp
+  80489b:	5b                   	pop    %rbx
+  80489c:	41 5f                	pop    %r15
+  80489e:	5d                   	pop    %rbp
+  80489f:	c3                   	ret
+
+00000000008048a0 <map_segment>:
+#define SEG_BATCH	PAGE_BATCH_CHUNK
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+	    int fd, size_t filesz, off_t fileoffset, int perm)
+{
+  8048a0:	55                   	push   %rbp
+  8048a1:	48 89 e5             	mov    %rsp,%rbp
+  8048a4:	41 57                	push   %r15
+  8048a6:	53                   	push   %rbx
+  8048a7:	48 81 ec 70 0c 00 00 	sub    $0xc70,%rsp
+  8048ae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048ae <map_segment+0xe>
+  8048b5:	49 bb 8a 47 00 00 00 	movabs $0x478a,%r11
+  8048bc:	00 00 00 
+  8048bf:	4c 01 db             	add    %r11,%rbx
+  8048c2:	89 bd ac f3 ff ff    	mov    %edi,-0xc54(%rbp)
+  8048c8:	48 89 b5 a0 f3 ff ff 	mov    %rsi,-0xc60(%rbp)
+  8048cf:	48 89 95 98 f3 ff ff 	mov    %rdx,-0xc68(%rbp)
+  8048d6:	89 8d a8 f3 ff ff    	mov    %ecx,-0xc58(%rbp)
+  8048dc:	4c 89 85 90 f3 ff ff 	mov    %r8,-0xc70(%rbp)
+  8048e3:	44 89 8d 8c f3 ff ff 	mov    %r9d,-0xc74(%rbp)
+	int i, j, n, nfile, r;
+	void *tmp;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  8048ea:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  8048f1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8048f6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048f9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048fd:	74 2d                	je     80492c <map_segment+0x8c>
+		va -= i;
+  8048ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804902:	48 98                	cltq
+  804904:	48 29 85 a0 f3 ff ff 	sub    %rax,-0xc60(%rbp)
+		memsz += i;
+  80490b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80490e:	48 98                	cltq
+  804910:	48 01 85 98 f3 ff ff 	add    %rax,-0xc68(%rbp)
+		filesz += i;
+  804917:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80491a:	48 98                	cltq
+  80491c:	48 01 85 90 f3 ff ff 	add    %rax,-0xc70(%rbp)
+		fileoffset -= i;
+  804923:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804926:	29 85 8c f3 ff ff    	sub    %eax,-0xc74(%rbp)
+	}
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  80492c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804933:	e9 db 03 00 00       	jmp    804d13 <map_segment+0x473>
+		n = MIN((memsz - i + PGSIZE - 1) / PGSIZE, SEG_BATCH);
+  804938:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80493b:	48 98                	cltq
+  80493d:	48 8b 95 98 f3 ff ff 	mov    -0xc68(%rbp),%rdx
+  804944:	48 29 c2             	sub    %rax,%rdx
+  804947:	48 8d 82 ff 0f 00 00 	lea    0xfff(%rdx),%rax
+  80494e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804952:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804956:	c7 45 d4 20 00 00 00 	movl   $0x20,-0x2c(%rbp)
+  80495d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804960:	48 63 d0             	movslq %eax,%rdx
+  804963:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804967:	48 39 c2             	cmp    %rax,%rdx
+  80496a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80496e:	89 45 d0             	mov    %eax,-0x30(%rbp)
+
+		// Allocate blank pages straight into the child, and pages
+		// for the file's contents at UTEMP in our address space.
+		nfile = 0;
+  804971:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+		for (j = 0; j < n; j++) {
+  804978:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  80497f:	e9 ea 01 00 00       	jmp    804b6e <map_segment+0x2ce>
+			if (i + j * PGSIZE < filesz) {
+  804984:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804987:	c1 e0 0c             	shl    $0xc,%eax
+  80498a:	89 c2                	mov    %eax,%edx
+  80498c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80498f:	01 d0                	add    %edx,%eax
+  804991:	48 98                	cltq
+  804993:	48 3b 85 90 f3 ff ff 	cmp    -0xc70(%rbp),%rax
+  80499a:	0f 83 57 01 00 00    	jae    804af7 <map_segment+0x257>
+				tmp = UTEMP + nfile * PGSIZE;
+  8049a0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8049a3:	c1 e0 0c             	shl    $0xc,%eax
+  8049a6:	48 98                	cltq
+  8049a8:	48 05 00 00 40 00    	add    $0x400000,%rax
+  8049ae:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+				alloc[j].dstenvid = 0;
+  8049b2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8049b5:	48 98                	cltq
+  8049b7:	48 c1 e0 05          	shl    $0x5,%rax
+  8049bb:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8049bf:	48 01 e8             	add    %rbp,%rax
+  8049c2:	48 2d 3c 04 00 00    	sub    $0x43c,%rax
+  8049c8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				alloc[j].dstva = (uintptr_t) tmp;
+  8049ce:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049d2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8049d5:	48 63 d2             	movslq %edx,%rdx
+  8049d8:	48 c1 e2 05          	shl    $0x5,%rdx
+  8049dc:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  8049e0:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  8049e4:	48 81 ea 30 04 00 00 	sub    $0x430,%rdx
+  8049eb:	48 89 02             	mov    %rax,(%rdx)
+				alloc[j].perm = PTE_P|PTE_U|PTE_W;
+  8049ee:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8049f1:	48 98                	cltq
+  8049f3:	48 c1 e0 05          	shl    $0x5,%rax
+  8049f7:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8049fb:	48 01 e8             	add    %rbp,%rax
+  8049fe:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  804a04:	c7 00 07 00 00 00    	movl   $0x7,(%rax)
+				map[nfile].srcenvid = 0;
+  804a0a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a0d:	48 98                	cltq
+  804a0f:	48 c1 e0 05          	shl    $0x5,%rax
+  804a13:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804a17:	48 01 e8             	add    %rbp,%rax
+  804a1a:	48 2d 40 08 00 00    	sub    $0x840,%rax
+  804a20:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				map[nfile].srcva = (uintptr_t) tmp;
+  804a26:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a2a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804a2d:	48 63 d2             	movslq %edx,%rdx
+  804a30:	48 c1 e2 05          	shl    $0x5,%rdx
+  804a34:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  804a38:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  804a3c:	48 81 ea 38 08 00 00 	sub    $0x838,%rdx
+  804a43:	48 89 02             	mov    %rax,(%rdx)
+				map[nfile].dstenvid = child;
+  804a46:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a49:	48 98                	cltq
+  804a4b:	48 c1 e0 05          	shl    $0x5,%rax
+  804a4f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804a53:	48 01 e8             	add    %rbp,%rax
+  804a56:	48 8d 90 c4 f7 ff ff 	lea    -0x83c(%rax),%rdx
+  804a5d:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  804a63:	89 02                	mov    %eax,(%rdx)
+				map[nfile].dstva = va + i + j * PGSIZE;
+  804a65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a68:	48 63 d0             	movslq %eax,%rdx
+  804a6b:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  804a72:	48 01 c2             	add    %rax,%rdx
+  804a75:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a78:	c1 e0 0c             	shl    $0xc,%eax
+  804a7b:	48 98                	cltq
+  804a7d:	48 01 c2             	add    %rax,%rdx
+  804a80:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a83:	48 98                	cltq
+  804a85:	48 c1 e0 05          	shl    $0x5,%rax
+  804a89:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804a8d:	48 01 e8             	add    %rbp,%rax
+  804a90:	48 2d 30 08 00 00    	sub    $0x830,%rax
+  804a96:	48 89 10             	mov    %rdx,(%rax)
+				map[nfile].perm = perm;
+  804a99:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a9c:	48 98                	cltq
+  804a9e:	48 c1 e0 05          	shl    $0x5,%rax
+  804aa2:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804aa6:	48 01 e8             	add    %rbp,%rax
+  804aa9:	48 8d 90 d8 f7 ff ff 	lea    -0x828(%rax),%rdx
+  804ab0:	8b 45 10             	mov    0x10(%rbp),%eax
+  804ab3:	89 02                	mov    %eax,(%rdx)
+				unmap[nfile].dstenvid = 0;
+  804ab5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ab8:	48 98                	cltq
+  804aba:	48 c1 e0 05          	shl    $0x5,%rax
+  804abe:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804ac2:	48 01 e8             	add    %rbp,%rax
+  804ac5:	48 2d 3c 0c 00 00    	sub    $0xc3c,%rax
+  804acb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+				unmap[nfile].dstva = (uintptr_t) tmp;
+  804ad1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804ad5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804ad8:	48 63 d2             	movslq %edx,%rdx
+  804adb:	48 c1 e2 05          	shl    $0x5,%rdx
+  804adf:	48 8d 4a f0          	lea    -0x10(%rdx),%rcx
+  804ae3:	48 8d 14 29          	lea    (%rcx,%rbp,1),%rdx
+  804ae7:	48 81 ea 30 0c 00 00 	sub    $0xc30,%rdx
+  804aee:	48 89 02             	mov    %rax,(%rdx)
+				nfile++;
+  804af1:	83 45 e4 01          	addl   $0x1,-0x1c(%rbp)
+  804af5:	eb 73                	jmp    804b6a <map_segment+0x2ca>
+			} else {
+				// Blank (BSS) pages are only allocated
+				// once the child writes to them.
+				alloc[j].dstenvid = child;
+  804af7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804afa:	48 98                	cltq
+  804afc:	48 c1 e0 05          	shl    $0x5,%rax
+  804b00:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804b04:	48 01 e8             	add    %rbp,%rax
+  804b07:	48 8d 90 c4 fb ff ff 	lea    -0x43c(%rax),%rdx
+  804b0e:	8b 85 ac f3 ff ff    	mov    -0xc54(%rbp),%eax
+  804b14:	89 02                	mov    %eax,(%rdx)
+				alloc[j].dstva = va + i + j * PGSIZE;
+  804b16:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b19:	48 63 d0             	movslq %eax,%rdx
+  804b1c:	48 8b 85 a0 f3 ff ff 	mov    -0xc60(%rbp),%rax
+  804b23:	48 01 c2             	add    %rax,%rdx
+  804b26:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b29:	c1 e0 0c             	shl    $0xc,%eax
+  804b2c:	48 98                	cltq
+  804b2e:	48 01 c2             	add    %rax,%rdx
+  804b31:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b34:	48 98                	cltq
+  804b36:	48 c1 e0 05          	shl    $0x5,%rax
+  804b3a:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804b3e:	48 01 e8             	add    %rbp,%rax
+  804b41:	48 2d 30 04 00 00    	sub    $0x430,%rax
+  804b47:	48 89 10             	mov    %rdx,(%rax)
+				alloc[j].perm = perm | PTE_LAZY;
+  804b4a:	8b 45 10             	mov    0x10(%rbp),%eax
+  804b4d:	80 cc 10             	or     $0x10,%ah
+  804b50:	89 c2                	mov    %eax,%edx
+  804b52:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b55:	48 98                	cltq
+  804b57:	48 c1 e0 05          	shl    $0x5,%rax
+  804b5b:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  804b5f:	48 01 e8             	add    %rbp,%rax
+  804b62:	48 2d 28 04 00 00    	sub    $0x428,%rax
+  804b68:	89 10                	mov    %edx,(%rax)
+		for (j = 0; j < n; j++) {
+  804b6a:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  804b6e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b71:	3b 45 d0             	cmp    -0x30(%rbp),%eax
+  804b74:	0f 8c 0a fe ff ff    	jl     804984 <map_segment+0xe4>
+			}
+		}
+		if ((r = sys_page_alloc_batch(alloc, n)) < 0)
+  804b7a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  804b7d:	48 63 d0             	movslq %eax,%rdx
+  804b80:	48 8d 85 b0 fb ff ff 	lea    -0x450(%rbp),%rax
+  804b87:	48 89 d6             	mov    %rdx,%rsi
+  804b8a:	48 89 c7             	mov    %rax,%rdi
+  804b8d:	49 89 df             	mov    %rbx,%r15
+  804b90:	48 b8 ff 95 ff ff ff 	movabs $0xffffffffffff95ff,%rax
+  804b97:	ff ff ff 
+  804b9a:	48 01 d8             	add    %rbx,%rax
+  804b9d:	ff d0                	call   *%rax
+  804b9f:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  804ba2:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804ba6:	0f 88 80 01 00 00    	js     804d2c <map_segment+0x48c>
+			goto out;
+
+		// from file
+		for (j = 0; j < nfile; j++) {
+  804bac:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  804bb3:	e9 af 00 00 00       	jmp    804c67 <map_segment+0x3c7>
+			if ((r = seek(fd, fileoffset + i + j * PGSIZE)) < 0)
+  804bb8:	8b 95 8c f3 ff ff    	mov    -0xc74(%rbp),%edx
+  804bbe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bc1:	01 c2                	add    %eax,%edx
+  804bc3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bc6:	c1 e0 0c             	shl    $0xc,%eax
+  804bc9:	01 c2                	add    %eax,%edx
+  804bcb:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  804bd1:	89 d6                	mov    %edx,%esi
+  804bd3:	89 c7                	mov    %eax,%edi
+  804bd5:	49 89 df             	mov    %rbx,%r15
+  804bd8:	48 b8 3e a0 ff ff ff 	movabs $0xffffffffffffa03e,%rax
+  804bdf:	ff ff ff 
+  804be2:	48 01 d8             	add    %rbx,%rax
+  804be5:	ff d0                	call   *%rax
+  804be7:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  804bea:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804bee:	0f 88 3b 01 00 00    	js     804d2f <map_segment+0x48f>
+				goto out;
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+				       MIN(PGSIZE, filesz - i - j * PGSIZE))) < 0)
+  804bf4:	c7 45 cc 00 10 00 00 	movl   $0x1000,-0x34(%rbp)
+  804bfb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bfe:	48 98                	cltq
+  804c00:	48 8b 95 90 f3 ff ff 	mov    -0xc70(%rbp),%rdx
+  804c07:	48 29 c2             	sub    %rax,%rdx
+  804c0a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c0d:	c1 e0 0c             	shl    $0xc,%eax
+  804c10:	48 98                	cltq
+  804c12:	48 29 c2             	sub    %rax,%rdx
+  804c15:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804c19:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804c1c:	48 63 d0             	movslq %eax,%rdx
+  804c1f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c23:	48 39 c2             	cmp    %rax,%rdx
+  804c26:	48 0f 47 d0          	cmova  %rax,%rdx
+			if ((r = readn(fd, UTEMP + j * PGSIZE,
+  804c2a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c2d:	c1 e0 0c             	shl    $0xc,%eax
+  804c30:	48 98                	cltq
+  804c32:	48 8d 88 00 00 40 00 	lea    0x400000(%rax),%rcx
+  804c39:	8b 85 a8 f3 ff ff    	mov    -0xc58(%rbp),%eax
+  804c3f:	48 89 ce             	mov    %rcx,%rsi
+  804c42:	89 c7                	mov    %eax,%edi
+  804c44:	49 89 df             	mov    %rbx,%r15
+  804c47:	48 b8 99 9e ff ff ff 	movabs $0xffffffffffff9e99,%rax
+  804c4e:	ff ff ff 
+  804c51:	48 01 d8             	add    %rbx,%rax
+  804c54:	ff d0                	call   *%rax
+  804c56:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  804c59:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804c5d:	0f 88 cf 00 00 00    	js     804d32 <map_segment+0x492>
+		for (j = 0; j < nfile; j++) {
+  804c63:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  804c67:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c6a:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804c6d:	0f 8c 45 ff ff ff    	jl     804bb8 <map_segment+0x318>
+				goto out;
+		}
+		if ((r = sys_page_map_batch(map, nfile)) < 0)
+  804c73:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c76:	48 63 d0             	movslq %eax,%rdx
+  804c79:	48 8d 85 b0 f7 ff ff 	lea    -0x850(%rbp),%rax
+  804c80:	48 89 d6             	mov    %rdx,%rsi
+  804c83:	48 89 c7             	mov    %rax,%rdi
+  804c86:	49 89 df             	mov    %rbx,%r15
+  804c89:	48 b8 a1 95 ff ff ff 	movabs $0xffffffffffff95a1,%rax
+  804c90:	ff ff ff 
+  804c93:	48 01 d8             	add    %rbx,%rax
+  804c96:	ff d0                	call   *%rax
+  804c98:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  804c9b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804c9f:	79 44                	jns    804ce5 <map_segment+0x445>
+			panic("spawn: sys_page_map_batch data: %e", r);
+  804ca1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804ca4:	89 c1                	mov    %eax,%ecx
+  804ca6:	48 b8 20 e7 ff ff ff 	movabs $0xffffffffffffe720,%rax
+  804cad:	ff ff ff 
+  804cb0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cb4:	48 89 c2             	mov    %rax,%rdx
+  804cb7:	be 43 01 00 00       	mov    $0x143,%esi
+  804cbc:	48 b8 a0 e6 ff ff ff 	movabs $0xffffffffffffe6a0,%rax
+  804cc3:	ff ff ff 
+  804cc6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cca:	48 89 c7             	mov    %rax,%rdi
+  804ccd:	49 89 df             	mov    %rbx,%r15
+  804cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd5:	49 b8 11 72 ff ff ff 	movabs $0xffffffffffff7211,%r8
+  804cdc:	ff ff ff 
+  804cdf:	49 01 d8             	add    %rbx,%r8
+  804ce2:	41 ff d0             	call   *%r8
+		sys_page_unmap_batch(unmap, nfile);
+  804ce5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ce8:	48 63 d0             	movslq %eax,%rdx
+  804ceb:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  804cf2:	48 89 d6             	mov    %rdx,%rsi
+  804cf5:	48 89 c7             	mov    %rax,%rdi
+  804cf8:	49 89 df             	mov    %rbx,%r15
+  804cfb:	48 b8 5d 96 ff ff ff 	movabs $0xffffffffffff965d,%rax
+  804d02:	ff ff ff 
+  804d05:	48 01 d8             	add    %rbx,%rax
+  804d08:	ff d0                	call   *%rax
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  804d0a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  804d0d:	c1 e0 0c             	shl    $0xc,%eax
+  804d10:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804d13:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d16:	48 98                	cltq
+  804d18:	48 3b 85 98 f3 ff ff 	cmp    -0xc68(%rbp),%rax
+  804d1f:	0f 82 13 fc ff ff    	jb     804938 <map_segment+0x98>
+	}
+	return 0;
+  804d25:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d2a:	eb 2f                	jmp    804d5b <map_segment+0x4bb>
+			goto out;
+  804d2c:	90                   	nop
+  804d2d:	eb 04                	jmp    804d33 <map_segment+0x493>
+				goto out;
+  804d2f:	90                   	nop
+  804d30:	eb 01                	jmp    804d33 <map_segment+0x493>
+				goto out;
+  804d32:	90                   	nop
+
+out:
+	sys_page_unmap_batch(unmap, nfile);
+  804d33:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804d36:	48 63 d0             	movslq %eax,%rdx
+  804d39:	48 8d 85 b0 f3 ff ff 	lea    -0xc50(%rbp),%rax
+  804d40:	48 89 d6             	mov    %rdx,%rsi
+  804d43:	48 89 c7             	mov    %rax,%rdi
+  804d46:	49 89 df             	mov    %rbx,%r15
+  804d49:	48 b8 5d 96 ff ff ff 	movabs $0xffffffffffff965d,%rax
+  804d50:	ff ff ff 
+  804d53:	48 01 d8             	add    %rbx,%rax
+  804d56:	ff d0                	call   *%rax
+	return r;
+  804d58:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+  804d5b:	48 81 c4 70 0c 00 00 	add    $0xc70,%rsp
+  804d62:	5b                   	pop    %rbx
+  804d63:	41 5f                	pop    %r15
+  804d65:	5d                   	pop    %rbp
+  804d66:	c3                   	ret
+
+0000000000804d67 <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  804d67:	55                   	push   %rbp
+  804d68:	48 89 e5             	mov    %rsp,%rbp
+  804d6b:	41 57                	push   %r15
+  804d6d:	53                   	push   %rbx
+  804d6e:	48 83 ec 30          	sub    $0x30,%rsp
+  804d72:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d72 <copy_shared_pages+0xb>
+  804d79:	49 bb c6 42 00 00 00 	movabs $0x42c6,%r11
+  804d80:	00 00 00 
+  804d83:	4c 01 db             	add    %r11,%rbx
+  804d86:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	int r;
+	uint64_t addr = 0;
+  804d89:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804d90:	00 
+	for (; addr < USTACKTOP;){
+  804d91:	e9 7f 02 00 00       	jmp    805015 <copy_shared_pages+0x2ae>
+		if (uvpde[VPDPE(addr)] & PTE_P){
+  804d96:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d9a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804d9e:	48 89 c2             	mov    %rax,%rdx
+  804da1:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804da8:	ff ff ff 
+  804dab:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804daf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804db3:	83 e0 01             	and    $0x1,%eax
+  804db6:	48 85 c0             	test   %rax,%rax
+  804db9:	0f 84 4e 02 00 00    	je     80500d <copy_shared_pages+0x2a6>
+			//a 2MB page is described by its PDE, not by uvpt
+			if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  804dbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804dc3:	48 c1 e8 15          	shr    $0x15,%rax
+  804dc7:	48 89 c2             	mov    %rax,%rdx
+  804dca:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  804dd1:	ff ff ff 
+  804dd4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804dd8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804ddc:	25 81 00 00 00       	and    $0x81,%eax
+  804de1:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  804de7:	0f 85 cf 00 00 00    	jne    804ebc <copy_shared_pages+0x155>
+				if (uvpd[VPD(addr)] & PTE_SHARE){
+  804ded:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804df1:	48 c1 e8 15          	shr    $0x15,%rax
+  804df5:	48 89 c2             	mov    %rax,%rdx
+  804df8:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  804dff:	ff ff ff 
+  804e02:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804e06:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804e0a:	25 00 04 00 00       	and    $0x400,%eax
+  804e0f:	48 85 c0             	test   %rax,%rax
+  804e12:	0f 84 97 00 00 00    	je     804eaf <copy_shared_pages+0x148>
+					unsigned int perm = uvpd[VPD(addr)] & (PTE_SYSCALL);
+  804e18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e1c:	48 c1 e8 15          	shr    $0x15,%rax
+  804e20:	48 89 c2             	mov    %rax,%rdx
+  804e23:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  804e2a:	ff ff ff 
+  804e2d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804e31:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804e35:	25 07 0e 00 00       	and    $0xe07,%eax
+  804e3a:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  804e3d:	8b 75 dc             	mov    -0x24(%rbp),%esi
+  804e40:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804e44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e48:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804e4b:	41 89 f0             	mov    %esi,%r8d
+  804e4e:	48 89 c6             	mov    %rax,%rsi
+  804e51:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e56:	49 89 df             	mov    %rbx,%r15
+  804e59:	48 b8 cb 8f ff ff ff 	movabs $0xffffffffffff8fcb,%rax
+  804e60:	ff ff ff 
+  804e63:	48 01 d8             	add    %rbx,%rax
+  804e66:	ff d0                	call   *%rax
+  804e68:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  804e6b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804e6f:	79 3e                	jns    804eaf <copy_shared_pages+0x148>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  804e71:	48 b8 48 e7 ff ff ff 	movabs $0xffffffffffffe748,%rax
+  804e78:	ff ff ff 
+  804e7b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e7f:	48 89 c2             	mov    %rax,%rdx
+  804e82:	be 5b 01 00 00       	mov    $0x15b,%esi
+  804e87:	48 b8 a0 e6 ff ff ff 	movabs $0xffffffffffffe6a0,%rax
+  804e8e:	ff ff ff 
+  804e91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e95:	48 89 c7             	mov    %rax,%rdi
+  804e98:	49 89 df             	mov    %rbx,%r15
+  804e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ea0:	48 b9 11 72 ff ff ff 	movabs $0xffffffffffff7211,%rcx
+  804ea7:	ff ff ff 
+  804eaa:	48 01 d9             	add    %rbx,%rcx
+  804ead:	ff d1                	call   *%rcx
+				}
+				addr += PTSIZE;
+  804eaf:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  804eb6:	00 
+  804eb7:	e9 59 01 00 00       	jmp    805015 <copy_shared_pages+0x2ae>
+			}
+			else if (uvpd[VPD(addr)] & PTE_P){
+  804ebc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec0:	48 c1 e8 15          	shr    $0x15,%rax
+  804ec4:	48 89 c2             	mov    %rax,%rdx
+  804ec7:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  804ece:	ff ff ff 
+  804ed1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804ed5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804ed9:	83 e0 01             	and    $0x1,%eax
+  804edc:	48 85 c0             	test   %rax,%rax
+  804edf:	0f 84 1e 01 00 00    	je     805003 <copy_shared_pages+0x29c>
+				if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_SHARE && uvpt[VPN(addr)] & PTE_U){
+  804ee5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee9:	48 c1 e8 0c          	shr    $0xc,%rax
+  804eed:	48 89 c2             	mov    %rax,%rdx
+  804ef0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804ef7:	ff ff ff 
+  804efa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804efe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f02:	83 e0 01             	and    $0x1,%eax
+  804f05:	48 85 c0             	test   %rax,%rax
+  804f08:	0f 84 eb 00 00 00    	je     804ff9 <copy_shared_pages+0x292>
+  804f0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f12:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f16:	48 89 c2             	mov    %rax,%rdx
+  804f19:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804f20:	ff ff ff 
+  804f23:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f27:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f2b:	25 00 04 00 00       	and    $0x400,%eax
+  804f30:	48 85 c0             	test   %rax,%rax
+  804f33:	0f 84 c0 00 00 00    	je     804ff9 <copy_shared_pages+0x292>
+  804f39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f3d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f41:	48 89 c2             	mov    %rax,%rdx
+  804f44:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804f4b:	ff ff ff 
+  804f4e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f52:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f56:	83 e0 04             	and    $0x4,%eax
+  804f59:	48 85 c0             	test   %rax,%rax
+  804f5c:	0f 84 97 00 00 00    	je     804ff9 <copy_shared_pages+0x292>
+					unsigned int perm = uvpt[VPN(addr)] & (PTE_SYSCALL);
+  804f62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f66:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f6a:	48 89 c2             	mov    %rax,%rdx
+  804f6d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804f74:	ff ff ff 
+  804f77:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804f7b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804f7f:	25 07 0e 00 00       	and    $0xe07,%eax
+  804f84:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+					r = sys_page_map(0,(void*)addr,child,(void*)addr,perm);
+  804f87:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  804f8a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804f8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f92:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804f95:	41 89 f0             	mov    %esi,%r8d
+  804f98:	48 89 c6             	mov    %rax,%rsi
+  804f9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fa0:	49 89 df             	mov    %rbx,%r15
+  804fa3:	48 b8 cb 8f ff ff ff 	movabs $0xffffffffffff8fcb,%rax
+  804faa:	ff ff ff 
+  804fad:	48 01 d8             	add    %rbx,%rax
+  804fb0:	ff d0                	call   *%rax
+  804fb2:	89 45 e0             	mov    %eax,-0x20(%rbp)
+					if (r < 0)
+  804fb5:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804fb9:	79 3e                	jns    804ff9 <copy_shared_pages+0x292>
+						panic("sys_page_map in copy_shared_pages failed\n");
+  804fbb:	48 b8 48 e7 ff ff ff 	movabs $0xffffffffffffe748,%rax
+  804fc2:	ff ff ff 
+  804fc5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fc9:	48 89 c2             	mov    %rax,%rdx
+  804fcc:	be 64 01 00 00       	mov    $0x164,%esi
+  804fd1:	48 b8 a0 e6 ff ff ff 	movabs $0xffffffffffffe6a0,%rax
+  804fd8:	ff ff ff 
+  804fdb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fdf:	48 89 c7             	mov    %rax,%rdi
+  804fe2:	49 89 df             	mov    %rbx,%r15
+  804fe5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fea:	48 b9 11 72 ff ff ff 	movabs $0xffffffffffff7211,%rcx
+  804ff1:	ff ff ff 
+  804ff4:	48 01 d9             	add    %rbx,%rcx
+  804ff7:	ff d1                	call   *%rcx
+				}
+				addr += PGSIZE;
+  804ff9:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  805000:	00 
+  805001:	eb 12                	jmp    805015 <copy_shared_pages+0x2ae>
+			}
+			//we will discover a PDE not present is at 
+			//a multiple of PTSIZE;
+			else {
+				addr += PTSIZE;
+  805003:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80500a:	00 
+  80500b:	eb 08                	jmp    805015 <copy_shared_pages+0x2ae>
+			}
+		}
+		//we will discover a PDPE not present is at
+		//a multiple of PTSIZE * NPDENTRIES;    
+		else {
+			addr += PTSIZE * NPDENTRIES;
+  80500d:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  805014:	40 
+	for (; addr < USTACKTOP;){
+  805015:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80501a:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80501e:	0f 83 72 fd ff ff    	jae    804d96 <copy_shared_pages+0x2f>
+        	}
+        }
+
+	return 0;
+  805024:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805029:	48 83 c4 30          	add    $0x30,%rsp
+  80502d:	5b                   	pop    %rbx
+  80502e:	41 5f                	pop    %r15
+  805030:	5d                   	pop    %rbp
+  805031:	c3                   	ret
+
+0000000000805032 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805032:	55                   	push   %rbp
+  805033:	48 89 e5             	mov    %rsp,%rbp
+  805036:	41 57                	push   %r15
+  805038:	53                   	push   %rbx
+  805039:	48 83 ec 20          	sub    $0x20,%rsp
+  80503d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80503d <fd2sockid+0xb>
+  805044:	49 bb fb 3f 00 00 00 	movabs $0x3ffb,%r11
+  80504b:	00 00 00 
+  80504e:	4c 01 db             	add    %r11,%rbx
+  805051:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805054:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805058:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80505b:	48 89 d6             	mov    %rdx,%rsi
+  80505e:	89 c7                	mov    %eax,%edi
+  805060:	49 89 df             	mov    %rbx,%r15
+  805063:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  80506a:	ff ff ff 
+  80506d:	48 01 d8             	add    %rbx,%rax
+  805070:	ff d0                	call   *%rax
+  805072:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805075:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805079:	79 05                	jns    805080 <fd2sockid+0x4e>
+		return r;
+  80507b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80507e:	eb 25                	jmp    8050a5 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805080:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805084:	8b 10                	mov    (%rax),%edx
+  805086:	48 b8 88 00 00 00 00 	movabs $0x88,%rax
+  80508d:	00 00 00 
+  805090:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805093:	39 c2                	cmp    %eax,%edx
+  805095:	74 07                	je     80509e <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  805097:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80509c:	eb 07                	jmp    8050a5 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  80509e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050a2:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8050a5:	48 83 c4 20          	add    $0x20,%rsp
+  8050a9:	5b                   	pop    %rbx
+  8050aa:	41 5f                	pop    %r15
+  8050ac:	5d                   	pop    %rbp
+  8050ad:	c3                   	ret
+
+00000000008050ae <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8050ae:	55                   	push   %rbp
+  8050af:	48 89 e5             	mov    %rsp,%rbp
+  8050b2:	41 57                	push   %r15
+  8050b4:	53                   	push   %rbx
+  8050b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8050b9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050b9 <alloc_sockfd+0xb>
+  8050c0:	49 bb 7f 3f 00 00 00 	movabs $0x3f7f,%r11
+  8050c7:	00 00 00 
+  8050ca:	4c 01 db             	add    %r11,%rbx
+  8050cd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8050d0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8050d4:	48 89 c7             	mov    %rax,%rdi
+  8050d7:	49 89 df             	mov    %rbx,%r15
+  8050da:	48 b8 89 97 ff ff ff 	movabs $0xffffffffffff9789,%rax
+  8050e1:	ff ff ff 
+  8050e4:	48 01 d8             	add    %rbx,%rax
+  8050e7:	ff d0                	call   *%rax
+  8050e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050f0:	78 2c                	js     80511e <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8050f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050f6:	ba 07 04 00 00       	mov    $0x407,%edx
+  8050fb:	48 89 c6             	mov    %rax,%rsi
+  8050fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  805103:	49 89 df             	mov    %rbx,%r15
+  805106:	48 b8 66 8f ff ff ff 	movabs $0xffffffffffff8f66,%rax
+  80510d:	ff ff ff 
+  805110:	48 01 d8             	add    %rbx,%rax
+  805113:	ff d0                	call   *%rax
+  805115:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805118:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80511c:	79 1c                	jns    80513a <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  80511e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805121:	89 c7                	mov    %eax,%edi
+  805123:	49 89 df             	mov    %rbx,%r15
+  805126:	48 b8 6a c8 ff ff ff 	movabs $0xffffffffffffc86a,%rax
+  80512d:	ff ff ff 
+  805130:	48 01 d8             	add    %rbx,%rax
+  805133:	ff d0                	call   *%rax
+		return r;
+  805135:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805138:	eb 41                	jmp    80517b <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80513a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80513e:	48 ba 88 00 00 00 00 	movabs $0x88,%rdx
+  805145:	00 00 00 
+  805148:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80514b:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  80514d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805151:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  805158:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80515c:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80515f:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805162:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805166:	48 89 c7             	mov    %rax,%rdi
+  805169:	49 89 df             	mov    %rbx,%r15
+  80516c:	48 b8 0f 97 ff ff ff 	movabs $0xffffffffffff970f,%rax
+  805173:	ff ff ff 
+  805176:	48 01 d8             	add    %rbx,%rax
+  805179:	ff d0                	call   *%rax
+}
+  80517b:	48 83 c4 20          	add    $0x20,%rsp
+  80517f:	5b                   	pop    %rbx
+  805180:	41 5f                	pop    %r15
+  805182:	5d                   	pop    %rbp
+  805183:	c3                   	ret
+
+0000000000805184 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805184:	55                   	push   %rbp
+  805185:	48 89 e5             	mov    %rsp,%rbp
+  805188:	41 57                	push   %r15
+  80518a:	53                   	push   %rbx
+  80518b:	48 83 ec 30          	sub    $0x30,%rsp
+  80518f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80518f <accept+0xb>
+  805196:	49 bb a9 3e 00 00 00 	movabs $0x3ea9,%r11
+  80519d:	00 00 00 
+  8051a0:	4c 01 db             	add    %r11,%rbx
+  8051a3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8051a6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8051aa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8051ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8051b1:	89 c7                	mov    %eax,%edi
+  8051b3:	48 b8 fa bf ff ff ff 	movabs $0xffffffffffffbffa,%rax
+  8051ba:	ff ff ff 
+  8051bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051c1:	ff d0                	call   *%rax
+  8051c3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051ca:	79 05                	jns    8051d1 <accept+0x4d>
+		return r;
+  8051cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051cf:	eb 45                	jmp    805216 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8051d1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8051d5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8051d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051dc:	48 89 ce             	mov    %rcx,%rsi
+  8051df:	89 c7                	mov    %eax,%edi
+  8051e1:	49 89 df             	mov    %rbx,%r15
+  8051e4:	48 b8 d8 c6 ff ff ff 	movabs $0xffffffffffffc6d8,%rax
+  8051eb:	ff ff ff 
+  8051ee:	48 01 d8             	add    %rbx,%rax
+  8051f1:	ff d0                	call   *%rax
+  8051f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8051f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8051fa:	79 05                	jns    805201 <accept+0x7d>
+		return r;
+  8051fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051ff:	eb 15                	jmp    805216 <accept+0x92>
+	return alloc_sockfd(r);
+  805201:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805204:	89 c7                	mov    %eax,%edi
+  805206:	48 b8 76 c0 ff ff ff 	movabs $0xffffffffffffc076,%rax
+  80520d:	ff ff ff 
+  805210:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805214:	ff d0                	call   *%rax
+}
+  805216:	48 83 c4 30          	add    $0x30,%rsp
+  80521a:	5b                   	pop    %rbx
+  80521b:	41 5f                	pop    %r15
+  80521d:	5d                   	pop    %rbp
+  80521e:	c3                   	ret
+
+000000000080521f <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80521f:	55                   	push   %rbp
+  805220:	48 89 e5             	mov    %rsp,%rbp
+  805223:	41 57                	push   %r15
+  805225:	53                   	push   %rbx
+  805226:	48 83 ec 20          	sub    $0x20,%rsp
+  80522a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80522a <bind+0xb>
+  805231:	49 bb 0e 3e 00 00 00 	movabs $0x3e0e,%r11
+  805238:	00 00 00 
+  80523b:	4c 01 db             	add    %r11,%rbx
+  80523e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805241:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805245:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805248:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80524b:	89 c7                	mov    %eax,%edi
+  80524d:	48 b8 fa bf ff ff ff 	movabs $0xffffffffffffbffa,%rax
+  805254:	ff ff ff 
+  805257:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80525b:	ff d0                	call   *%rax
+  80525d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805260:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805264:	79 05                	jns    80526b <bind+0x4c>
+		return r;
+  805266:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805269:	eb 21                	jmp    80528c <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80526b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80526e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805272:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805275:	48 89 ce             	mov    %rcx,%rsi
+  805278:	89 c7                	mov    %eax,%edi
+  80527a:	49 89 df             	mov    %rbx,%r15
+  80527d:	48 b8 84 c7 ff ff ff 	movabs $0xffffffffffffc784,%rax
+  805284:	ff ff ff 
+  805287:	48 01 d8             	add    %rbx,%rax
+  80528a:	ff d0                	call   *%rax
+}
+  80528c:	48 83 c4 20          	add    $0x20,%rsp
+  805290:	5b                   	pop    %rbx
+  805291:	41 5f                	pop    %r15
+  805293:	5d                   	pop    %rbp
+  805294:	c3                   	ret
+
+0000000000805295 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  805295:	55                   	push   %rbp
+  805296:	48 89 e5             	mov    %rsp,%rbp
+  805299:	41 57                	push   %r15
+  80529b:	53                   	push   %rbx
+  80529c:	48 83 ec 20          	sub    $0x20,%rsp
+  8052a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052a0 <shutdown+0xb>
+  8052a7:	49 bb 98 3d 00 00 00 	movabs $0x3d98,%r11
+  8052ae:	00 00 00 
+  8052b1:	4c 01 db             	add    %r11,%rbx
+  8052b4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8052b7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8052ba:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052bd:	89 c7                	mov    %eax,%edi
+  8052bf:	48 b8 fa bf ff ff ff 	movabs $0xffffffffffffbffa,%rax
+  8052c6:	ff ff ff 
+  8052c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052cd:	ff d0                	call   *%rax
+  8052cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052d6:	79 05                	jns    8052dd <shutdown+0x48>
+		return r;
+  8052d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052db:	eb 1c                	jmp    8052f9 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8052dd:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8052e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052e3:	89 d6                	mov    %edx,%esi
+  8052e5:	89 c7                	mov    %eax,%edi
+  8052e7:	49 89 df             	mov    %rbx,%r15
+  8052ea:	48 b8 19 c8 ff ff ff 	movabs $0xffffffffffffc819,%rax
+  8052f1:	ff ff ff 
+  8052f4:	48 01 d8             	add    %rbx,%rax
+  8052f7:	ff d0                	call   *%rax
+}
+  8052f9:	48 83 c4 20          	add    $0x20,%rsp
+  8052fd:	5b                   	pop    %rbx
+  8052fe:	41 5f                	pop    %r15
+  805300:	5d                   	pop    %rbp
+  805301:	c3                   	ret
+
+0000000000805302 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805302:	55                   	push   %rbp
+  805303:	48 89 e5             	mov    %rsp,%rbp
+  805306:	41 57                	push   %r15
+  805308:	53                   	push   %rbx
+  805309:	48 83 ec 10          	sub    $0x10,%rsp
+  80530d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80530d <devsock_close+0xb>
+  805314:	49 bb 2b 3d 00 00 00 	movabs $0x3d2b,%r11
+  80531b:	00 00 00 
+  80531e:	4c 01 db             	add    %r11,%rbx
+  805321:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805325:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805329:	48 89 c7             	mov    %rax,%rdi
+  80532c:	49 89 df             	mov    %rbx,%r15
+  80532f:	48 b8 16 e0 ff ff ff 	movabs $0xffffffffffffe016,%rax
+  805336:	ff ff ff 
+  805339:	48 01 d8             	add    %rbx,%rax
+  80533c:	ff d0                	call   *%rax
+  80533e:	83 f8 01             	cmp    $0x1,%eax
+  805341:	75 1d                	jne    805360 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805343:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805347:	8b 40 0c             	mov    0xc(%rax),%eax
+  80534a:	89 c7                	mov    %eax,%edi
+  80534c:	49 89 df             	mov    %rbx,%r15
+  80534f:	48 b8 6a c8 ff ff ff 	movabs $0xffffffffffffc86a,%rax
+  805356:	ff ff ff 
+  805359:	48 01 d8             	add    %rbx,%rax
+  80535c:	ff d0                	call   *%rax
+  80535e:	eb 05                	jmp    805365 <devsock_close+0x63>
+	else
+		return 0;
+  805360:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805365:	48 83 c4 10          	add    $0x10,%rsp
+  805369:	5b                   	pop    %rbx
+  80536a:	41 5f                	pop    %r15
+  80536c:	5d                   	pop    %rbp
+  80536d:	c3                   	ret
+
+000000000080536e <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80536e:	55                   	push   %rbp
+  80536f:	48 89 e5             	mov    %rsp,%rbp
+  805372:	41 57                	push   %r15
+  805374:	53                   	push   %rbx
+  805375:	48 83 ec 20          	sub    $0x20,%rsp
+  805379:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805379 <connect+0xb>
+  805380:	49 bb bf 3c 00 00 00 	movabs $0x3cbf,%r11
+  805387:	00 00 00 
+  80538a:	4c 01 db             	add    %r11,%rbx
+  80538d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805390:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805394:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805397:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80539a:	89 c7                	mov    %eax,%edi
+  80539c:	48 b8 fa bf ff ff ff 	movabs $0xffffffffffffbffa,%rax
+  8053a3:	ff ff ff 
+  8053a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053aa:	ff d0                	call   *%rax
+  8053ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053b3:	79 05                	jns    8053ba <connect+0x4c>
+		return r;
+  8053b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b8:	eb 21                	jmp    8053db <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8053ba:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8053bd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8053c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053c4:	48 89 ce             	mov    %rcx,%rsi
+  8053c7:	89 c7                	mov    %eax,%edi
+  8053c9:	49 89 df             	mov    %rbx,%r15
+  8053cc:	48 b8 b2 c8 ff ff ff 	movabs $0xffffffffffffc8b2,%rax
+  8053d3:	ff ff ff 
+  8053d6:	48 01 d8             	add    %rbx,%rax
+  8053d9:	ff d0                	call   *%rax
+}
+  8053db:	48 83 c4 20          	add    $0x20,%rsp
+  8053df:	5b                   	pop    %rbx
+  8053e0:	41 5f                	pop    %r15
+  8053e2:	5d                   	pop    %rbp
+  8053e3:	c3                   	ret
+
+00000000008053e4 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8053e4:	55                   	push   %rbp
+  8053e5:	48 89 e5             	mov    %rsp,%rbp
+  8053e8:	41 57                	push   %r15
+  8053ea:	53                   	push   %rbx
+  8053eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8053ef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053ef <listen+0xb>
+  8053f6:	49 bb 49 3c 00 00 00 	movabs $0x3c49,%r11
+  8053fd:	00 00 00 
+  805400:	4c 01 db             	add    %r11,%rbx
+  805403:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805406:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805409:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80540c:	89 c7                	mov    %eax,%edi
+  80540e:	48 b8 fa bf ff ff ff 	movabs $0xffffffffffffbffa,%rax
+  805415:	ff ff ff 
+  805418:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80541c:	ff d0                	call   *%rax
+  80541e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805421:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805425:	79 05                	jns    80542c <listen+0x48>
+		return r;
+  805427:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80542a:	eb 1c                	jmp    805448 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80542c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80542f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805432:	89 d6                	mov    %edx,%esi
+  805434:	89 c7                	mov    %eax,%edi
+  805436:	49 89 df             	mov    %rbx,%r15
+  805439:	48 b8 47 c9 ff ff ff 	movabs $0xffffffffffffc947,%rax
+  805440:	ff ff ff 
+  805443:	48 01 d8             	add    %rbx,%rax
+  805446:	ff d0                	call   *%rax
+}
+  805448:	48 83 c4 20          	add    $0x20,%rsp
+  80544c:	5b                   	pop    %rbx
+  80544d:	41 5f                	pop    %r15
+  80544f:	5d                   	pop    %rbp
+  805450:	c3                   	ret
+
+0000000000805451 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805451:	55                   	push   %rbp
+  805452:	48 89 e5             	mov    %rsp,%rbp
+  805455:	41 57                	push   %r15
+  805457:	48 83 ec 28          	sub    $0x28,%rsp
+  80545b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80545b <devsock_read+0xa>
+  805462:	49 bb dd 3b 00 00 00 	movabs $0x3bdd,%r11
+  805469:	00 00 00 
+  80546c:	4c 01 d8             	add    %r11,%rax
+  80546f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805473:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805477:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80547b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80547f:	41 89 d0             	mov    %edx,%r8d
+  805482:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805486:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805489:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80548d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805492:	44 89 c2             	mov    %r8d,%edx
+  805495:	49 89 c7             	mov    %rax,%r15
+  805498:	49 b8 98 c9 ff ff ff 	movabs $0xffffffffffffc998,%r8
+  80549f:	ff ff ff 
+  8054a2:	49 01 c0             	add    %rax,%r8
+  8054a5:	41 ff d0             	call   *%r8
+}
+  8054a8:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8054ac:	c9                   	leave
+  8054ad:	c3                   	ret
+
+00000000008054ae <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8054ae:	55                   	push   %rbp
+  8054af:	48 89 e5             	mov    %rsp,%rbp
+  8054b2:	41 57                	push   %r15
+  8054b4:	48 83 ec 28          	sub    $0x28,%rsp
+  8054b8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054b8 <devsock_write+0xa>
+  8054bf:	49 bb 80 3b 00 00 00 	movabs $0x3b80,%r11
+  8054c6:	00 00 00 
+  8054c9:	4c 01 d8             	add    %r11,%rax
+  8054cc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8054d0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8054d4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8054d8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8054dc:	41 89 d0             	mov    %edx,%r8d
+  8054df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8054e3:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8054e6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8054ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8054ef:	44 89 c2             	mov    %r8d,%edx
+  8054f2:	49 89 c7             	mov    %rax,%r15
+  8054f5:	49 b8 b5 ca ff ff ff 	movabs $0xffffffffffffcab5,%r8
+  8054fc:	ff ff ff 
+  8054ff:	49 01 c0             	add    %rax,%r8
+  805502:	41 ff d0             	call   *%r8
+}
+  805505:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805509:	c9                   	leave
+  80550a:	c3                   	ret
+
+000000000080550b <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80550b:	55                   	push   %rbp
+  80550c:	48 89 e5             	mov    %rsp,%rbp
+  80550f:	41 57                	push   %r15
+  805511:	48 83 ec 18          	sub    $0x18,%rsp
+  805515:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805515 <devsock_stat+0xa>
+  80551c:	49 bb 23 3b 00 00 00 	movabs $0x3b23,%r11
+  805523:	00 00 00 
+  805526:	4c 01 d8             	add    %r11,%rax
+  805529:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80552d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805531:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805535:	48 b9 77 e7 ff ff ff 	movabs $0xffffffffffffe777,%rcx
+  80553c:	ff ff ff 
+  80553f:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805543:	48 89 ce             	mov    %rcx,%rsi
+  805546:	48 89 d7             	mov    %rdx,%rdi
+  805549:	49 89 c7             	mov    %rax,%r15
+  80554c:	48 ba aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rdx
+  805553:	ff ff ff 
+  805556:	48 01 c2             	add    %rax,%rdx
+  805559:	ff d2                	call   *%rdx
+	return 0;
+  80555b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805560:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805564:	c9                   	leave
+  805565:	c3                   	ret
+
+0000000000805566 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  805566:	55                   	push   %rbp
+  805567:	48 89 e5             	mov    %rsp,%rbp
+  80556a:	41 57                	push   %r15
+  80556c:	53                   	push   %rbx
+  80556d:	48 83 ec 20          	sub    $0x20,%rsp
+  805571:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805571 <socket+0xb>
+  805578:	49 bb c7 3a 00 00 00 	movabs $0x3ac7,%r11
+  80557f:	00 00 00 
+  805582:	4c 01 db             	add    %r11,%rbx
+  805585:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805588:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80558b:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80558e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805591:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805594:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805597:	89 ce                	mov    %ecx,%esi
+  805599:	89 c7                	mov    %eax,%edi
+  80559b:	49 89 df             	mov    %rbx,%r15
+  80559e:	48 b8 8c cc ff ff ff 	movabs $0xffffffffffffcc8c,%rax
+  8055a5:	ff ff ff 
+  8055a8:	48 01 d8             	add    %rbx,%rax
+  8055ab:	ff d0                	call   *%rax
+  8055ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055b4:	79 05                	jns    8055bb <socket+0x55>
+		return r;
+  8055b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055b9:	eb 15                	jmp    8055d0 <socket+0x6a>
+	return alloc_sockfd(r);
+  8055bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055be:	89 c7                	mov    %eax,%edi
+  8055c0:	48 b8 76 c0 ff ff ff 	movabs $0xffffffffffffc076,%rax
+  8055c7:	ff ff ff 
+  8055ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055ce:	ff d0                	call   *%rax
+}
+  8055d0:	48 83 c4 20          	add    $0x20,%rsp
+  8055d4:	5b                   	pop    %rbx
+  8055d5:	41 5f                	pop    %r15
+  8055d7:	5d                   	pop    %rbp
+  8055d8:	c3                   	ret
+
+00000000008055d9 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8055d9:	55                   	push   %rbp
+  8055da:	48 89 e5             	mov    %rsp,%rbp
+  8055dd:	41 57                	push   %r15
+  8055df:	53                   	push   %rbx
+  8055e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8055e4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055e4 <nsipc+0xb>
+  8055eb:	49 bb 54 3a 00 00 00 	movabs $0x3a54,%r11
+  8055f2:	00 00 00 
+  8055f5:	4c 01 db             	add    %r11,%rbx
+  8055f8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8055fb:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  805602:	00 00 00 
+  805605:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805608:	85 c0                	test   %eax,%eax
+  80560a:	75 24                	jne    805630 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80560c:	bf 02 00 00 00       	mov    $0x2,%edi
+  805611:	49 89 df             	mov    %rbx,%r15
+  805614:	48 b8 87 df ff ff ff 	movabs $0xffffffffffffdf87,%rax
+  80561b:	ff ff ff 
+  80561e:	48 01 d8             	add    %rbx,%rax
+  805621:	ff d0                	call   *%rax
+  805623:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  80562a:	00 00 00 
+  80562d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805630:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  805637:	00 00 00 
+  80563a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80563d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805640:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805646:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80564c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805651:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805658:	00 00 00 
+  80565b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80565f:	89 c7                	mov    %eax,%edi
+  805661:	49 89 df             	mov    %rbx,%r15
+  805664:	48 b8 a6 d9 ff ff ff 	movabs $0xffffffffffffd9a6,%rax
+  80566b:	ff ff ff 
+  80566e:	48 01 d8             	add    %rbx,%rax
+  805671:	ff d0                	call   *%rax
+}
+  805673:	48 83 c4 10          	add    $0x10,%rsp
+  805677:	5b                   	pop    %rbx
+  805678:	41 5f                	pop    %r15
+  80567a:	5d                   	pop    %rbp
+  80567b:	c3                   	ret
+
+000000000080567c <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  80567c:	55                   	push   %rbp
+  80567d:	48 89 e5             	mov    %rsp,%rbp
+  805680:	41 57                	push   %r15
+  805682:	53                   	push   %rbx
+  805683:	48 83 ec 20          	sub    $0x20,%rsp
+  805687:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805687 <nsipc_words+0xb>
+  80568e:	49 bb b1 39 00 00 00 	movabs $0x39b1,%r11
+  805695:	00 00 00 
+  805698:	4c 01 db             	add    %r11,%rbx
+  80569b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80569e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8056a2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  8056a6:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8056ad:	00 00 00 
+  8056b0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056b3:	85 c0                	test   %eax,%eax
+  8056b5:	75 24                	jne    8056db <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8056b7:	bf 02 00 00 00       	mov    $0x2,%edi
+  8056bc:	49 89 df             	mov    %rbx,%r15
+  8056bf:	48 b8 87 df ff ff ff 	movabs $0xffffffffffffdf87,%rax
+  8056c6:	ff ff ff 
+  8056c9:	48 01 d8             	add    %rbx,%rax
+  8056cc:	ff d0                	call   *%rax
+  8056ce:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  8056d5:	00 00 00 
+  8056d8:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  8056db:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8056e2:	00 00 00 
+  8056e5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056e8:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8056ec:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8056f0:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8056f3:	89 c7                	mov    %eax,%edi
+  8056f5:	49 89 df             	mov    %rbx,%r15
+  8056f8:	48 b8 91 da ff ff ff 	movabs $0xffffffffffffda91,%rax
+  8056ff:	ff ff ff 
+  805702:	48 01 d8             	add    %rbx,%rax
+  805705:	ff d0                	call   *%rax
+}
+  805707:	48 83 c4 20          	add    $0x20,%rsp
+  80570b:	5b                   	pop    %rbx
+  80570c:	41 5f                	pop    %r15
+  80570e:	5d                   	pop    %rbp
+  80570f:	c3                   	ret
+
+0000000000805710 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805710:	55                   	push   %rbp
+  805711:	48 89 e5             	mov    %rsp,%rbp
+  805714:	41 57                	push   %r15
+  805716:	53                   	push   %rbx
+  805717:	48 83 ec 30          	sub    $0x30,%rsp
+  80571b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80571b <nsipc_accept+0xb>
+  805722:	49 bb 1d 39 00 00 00 	movabs $0x391d,%r11
+  805729:	00 00 00 
+  80572c:	4c 01 db             	add    %r11,%rbx
+  80572f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805732:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805736:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80573a:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805741:	00 00 00 
+  805744:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805747:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80574a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80574f:	48 b8 a1 c5 ff ff ff 	movabs $0xffffffffffffc5a1,%rax
+  805756:	ff ff ff 
+  805759:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80575d:	ff d0                	call   *%rax
+  80575f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805762:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805766:	78 48                	js     8057b0 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805768:	48 b8 c8 3f 01 00 00 	movabs $0x13fc8,%rax
+  80576f:	00 00 00 
+  805772:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805776:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80577a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80577e:	8b 40 10             	mov    0x10(%rax),%eax
+  805781:	89 c2                	mov    %eax,%edx
+  805783:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805787:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80578b:	48 89 ce             	mov    %rcx,%rsi
+  80578e:	48 89 c7             	mov    %rax,%rdi
+  805791:	49 89 df             	mov    %rbx,%r15
+  805794:	48 b8 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rax
+  80579b:	ff ff ff 
+  80579e:	48 01 d8             	add    %rbx,%rax
+  8057a1:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  8057a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057a7:	8b 50 10             	mov    0x10(%rax),%edx
+  8057aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8057ae:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  8057b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8057b3:	48 83 c4 30          	add    $0x30,%rsp
+  8057b7:	5b                   	pop    %rbx
+  8057b8:	41 5f                	pop    %r15
+  8057ba:	5d                   	pop    %rbp
+  8057bb:	c3                   	ret
+
+00000000008057bc <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8057bc:	55                   	push   %rbp
+  8057bd:	48 89 e5             	mov    %rsp,%rbp
+  8057c0:	41 57                	push   %r15
+  8057c2:	53                   	push   %rbx
+  8057c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8057c7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057c7 <nsipc_bind+0xb>
+  8057ce:	49 bb 71 38 00 00 00 	movabs $0x3871,%r11
+  8057d5:	00 00 00 
+  8057d8:	4c 01 db             	add    %r11,%rbx
+  8057db:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8057de:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8057e2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  8057e5:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  8057ec:	00 00 00 
+  8057ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057f2:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8057f5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8057f8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057fc:	48 89 c6             	mov    %rax,%rsi
+  8057ff:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  805806:	00 00 00 
+  805809:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80580d:	48 89 c7             	mov    %rax,%rdi
+  805810:	49 89 df             	mov    %rbx,%r15
+  805813:	48 b8 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rax
+  80581a:	ff ff ff 
+  80581d:	48 01 d8             	add    %rbx,%rax
+  805820:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805822:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805829:	00 00 00 
+  80582c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80582f:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805833:	bf 02 00 00 00       	mov    $0x2,%edi
+  805838:	48 b8 a1 c5 ff ff ff 	movabs $0xffffffffffffc5a1,%rax
+  80583f:	ff ff ff 
+  805842:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805846:	ff d0                	call   *%rax
+}
+  805848:	48 83 c4 10          	add    $0x10,%rsp
+  80584c:	5b                   	pop    %rbx
+  80584d:	41 5f                	pop    %r15
+  80584f:	5d                   	pop    %rbp
+  805850:	c3                   	ret
+
+0000000000805851 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805851:	55                   	push   %rbp
+  805852:	48 89 e5             	mov    %rsp,%rbp
+  805855:	48 83 ec 20          	sub    $0x20,%rsp
+  805859:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805859 <nsipc_shutdown+0x8>
+  805860:	49 bb df 37 00 00 00 	movabs $0x37df,%r11
+  805867:	00 00 00 
+  80586a:	4c 01 d8             	add    %r11,%rax
+  80586d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805870:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805873:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805876:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805879:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80587c:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80587f:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805883:	ba 08 00 00 00       	mov    $0x8,%edx
+  805888:	48 89 ce             	mov    %rcx,%rsi
+  80588b:	bf 03 00 00 00       	mov    $0x3,%edi
+  805890:	48 b9 44 c6 ff ff ff 	movabs $0xffffffffffffc644,%rcx
+  805897:	ff ff ff 
+  80589a:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80589e:	ff d0                	call   *%rax
+}
+  8058a0:	c9                   	leave
+  8058a1:	c3                   	ret
+
+00000000008058a2 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8058a2:	55                   	push   %rbp
+  8058a3:	48 89 e5             	mov    %rsp,%rbp
+  8058a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8058aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8058aa <nsipc_close+0x8>
+  8058b1:	49 bb 8e 37 00 00 00 	movabs $0x378e,%r11
+  8058b8:	00 00 00 
+  8058bb:	4c 01 d8             	add    %r11,%rax
+  8058be:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  8058c1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8058c4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  8058c7:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8058cb:	ba 04 00 00 00       	mov    $0x4,%edx
+  8058d0:	48 89 ce             	mov    %rcx,%rsi
+  8058d3:	bf 04 00 00 00       	mov    $0x4,%edi
+  8058d8:	48 b9 44 c6 ff ff ff 	movabs $0xffffffffffffc644,%rcx
+  8058df:	ff ff ff 
+  8058e2:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8058e6:	ff d0                	call   *%rax
+}
+  8058e8:	c9                   	leave
+  8058e9:	c3                   	ret
+
+00000000008058ea <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8058ea:	55                   	push   %rbp
+  8058eb:	48 89 e5             	mov    %rsp,%rbp
+  8058ee:	41 57                	push   %r15
+  8058f0:	53                   	push   %rbx
+  8058f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8058f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058f5 <nsipc_connect+0xb>
+  8058fc:	49 bb 43 37 00 00 00 	movabs $0x3743,%r11
+  805903:	00 00 00 
+  805906:	4c 01 db             	add    %r11,%rbx
+  805909:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80590c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805910:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805913:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  80591a:	00 00 00 
+  80591d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805920:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805923:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805926:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80592a:	48 89 c6             	mov    %rax,%rsi
+  80592d:	48 b8 cc 3f 01 00 00 	movabs $0x13fcc,%rax
+  805934:	00 00 00 
+  805937:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80593b:	48 89 c7             	mov    %rax,%rdi
+  80593e:	49 89 df             	mov    %rbx,%r15
+  805941:	48 b8 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rax
+  805948:	ff ff ff 
+  80594b:	48 01 d8             	add    %rbx,%rax
+  80594e:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805950:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805957:	00 00 00 
+  80595a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80595d:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805961:	bf 05 00 00 00       	mov    $0x5,%edi
+  805966:	48 b8 a1 c5 ff ff ff 	movabs $0xffffffffffffc5a1,%rax
+  80596d:	ff ff ff 
+  805970:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805974:	ff d0                	call   *%rax
+}
+  805976:	48 83 c4 10          	add    $0x10,%rsp
+  80597a:	5b                   	pop    %rbx
+  80597b:	41 5f                	pop    %r15
+  80597d:	5d                   	pop    %rbp
+  80597e:	c3                   	ret
+
+000000000080597f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80597f:	55                   	push   %rbp
+  805980:	48 89 e5             	mov    %rsp,%rbp
+  805983:	48 83 ec 20          	sub    $0x20,%rsp
+  805987:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805987 <nsipc_listen+0x8>
+  80598e:	49 bb b1 36 00 00 00 	movabs $0x36b1,%r11
+  805995:	00 00 00 
+  805998:	4c 01 d8             	add    %r11,%rax
+  80599b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80599e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  8059a1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8059a4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  8059a7:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8059aa:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  8059ad:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8059b1:	ba 08 00 00 00       	mov    $0x8,%edx
+  8059b6:	48 89 ce             	mov    %rcx,%rsi
+  8059b9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8059be:	48 b9 44 c6 ff ff ff 	movabs $0xffffffffffffc644,%rcx
+  8059c5:	ff ff ff 
+  8059c8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8059cc:	ff d0                	call   *%rax
+}
+  8059ce:	c9                   	leave
+  8059cf:	c3                   	ret
+
+00000000008059d0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8059d0:	55                   	push   %rbp
+  8059d1:	48 89 e5             	mov    %rsp,%rbp
+  8059d4:	41 57                	push   %r15
+  8059d6:	53                   	push   %rbx
+  8059d7:	48 83 ec 30          	sub    $0x30,%rsp
+  8059db:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059db <nsipc_recv+0xb>
+  8059e2:	49 bb 5d 36 00 00 00 	movabs $0x365d,%r11
+  8059e9:	00 00 00 
+  8059ec:	4c 01 db             	add    %r11,%rbx
+  8059ef:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8059f2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8059f6:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8059f9:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8059fc:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805a03:	00 00 00 
+  805a06:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a09:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805a0c:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805a13:	00 00 00 
+  805a16:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805a19:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805a1d:	48 ba c8 3f 01 00 00 	movabs $0x13fc8,%rdx
+  805a24:	00 00 00 
+  805a27:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805a2a:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805a2e:	bf 07 00 00 00       	mov    $0x7,%edi
+  805a33:	48 b8 a1 c5 ff ff ff 	movabs $0xffffffffffffc5a1,%rax
+  805a3a:	ff ff ff 
+  805a3d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a41:	ff d0                	call   *%rax
+  805a43:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a46:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a4a:	0f 88 91 00 00 00    	js     805ae1 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805a50:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805a57:	7f 08                	jg     805a61 <nsipc_recv+0x91>
+  805a59:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a5c:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805a5f:	7e 50                	jle    805ab1 <nsipc_recv+0xe1>
+  805a61:	48 b8 7e e7 ff ff ff 	movabs $0xffffffffffffe77e,%rax
+  805a68:	ff ff ff 
+  805a6b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a6f:	48 89 c1             	mov    %rax,%rcx
+  805a72:	48 b8 93 e7 ff ff ff 	movabs $0xffffffffffffe793,%rax
+  805a79:	ff ff ff 
+  805a7c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a80:	48 89 c2             	mov    %rax,%rdx
+  805a83:	be 79 00 00 00       	mov    $0x79,%esi
+  805a88:	48 b8 a8 e7 ff ff ff 	movabs $0xffffffffffffe7a8,%rax
+  805a8f:	ff ff ff 
+  805a92:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a96:	48 89 c7             	mov    %rax,%rdi
+  805a99:	49 89 df             	mov    %rbx,%r15
+  805a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aa1:	49 b8 11 72 ff ff ff 	movabs $0xffffffffffff7211,%r8
+  805aa8:	ff ff ff 
+  805aab:	49 01 d8             	add    %rbx,%r8
+  805aae:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805ab1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ab4:	48 63 d0             	movslq %eax,%rdx
+  805ab7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805abb:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  805ac2:	00 00 00 
+  805ac5:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805ac9:	48 89 ce             	mov    %rcx,%rsi
+  805acc:	48 89 c7             	mov    %rax,%rdi
+  805acf:	49 89 df             	mov    %rbx,%r15
+  805ad2:	48 b8 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rax
+  805ad9:	ff ff ff 
+  805adc:	48 01 d8             	add    %rbx,%rax
+  805adf:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805ae1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805ae4:	48 83 c4 30          	add    $0x30,%rsp
+  805ae8:	5b                   	pop    %rbx
+  805ae9:	41 5f                	pop    %r15
+  805aeb:	5d                   	pop    %rbp
+  805aec:	c3                   	ret
+
+0000000000805aed <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805aed:	55                   	push   %rbp
+  805aee:	48 89 e5             	mov    %rsp,%rbp
+  805af1:	41 57                	push   %r15
+  805af3:	53                   	push   %rbx
+  805af4:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805afb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805afb <nsipc_send+0xe>
+  805b02:	49 bb 3d 35 00 00 00 	movabs $0x353d,%r11
+  805b09:	00 00 00 
+  805b0c:	4c 01 db             	add    %r11,%rbx
+  805b0f:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805b15:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805b1c:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805b22:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805b28:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805b2c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805b30:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  805b37:	00 00 00 
+  805b3a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b3d:	85 c0                	test   %eax,%eax
+  805b3f:	75 24                	jne    805b65 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805b41:	bf 02 00 00 00       	mov    $0x2,%edi
+  805b46:	49 89 df             	mov    %rbx,%r15
+  805b49:	48 b8 87 df ff ff ff 	movabs $0xffffffffffffdf87,%rax
+  805b50:	ff ff ff 
+  805b53:	48 01 d8             	add    %rbx,%rax
+  805b56:	ff d0                	call   *%rax
+  805b58:	48 ba c8 1f 01 00 00 	movabs $0x11fc8,%rdx
+  805b5f:	00 00 00 
+  805b62:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805b65:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805b6b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805b6e:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805b75:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805b78:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805b7b:	39 c2                	cmp    %eax,%edx
+  805b7d:	0f 4e c2             	cmovle %edx,%eax
+  805b80:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805b86:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805b8c:	48 63 d0             	movslq %eax,%rdx
+  805b8f:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805b96:	48 89 c6             	mov    %rax,%rsi
+  805b99:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  805ba0:	00 00 00 
+  805ba3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ba7:	48 89 c7             	mov    %rax,%rdi
+  805baa:	49 89 df             	mov    %rbx,%r15
+  805bad:	48 b8 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rax
+  805bb4:	ff ff ff 
+  805bb7:	48 01 d8             	add    %rbx,%rax
+  805bba:	ff d0                	call   *%rax
+	req->req_s = s;
+  805bbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bc0:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805bc6:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805bc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bcc:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805bd2:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805bd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bd9:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805bdf:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805be2:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  805be9:	00 00 00 
+  805bec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805bf0:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805bf4:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805bfb:	00 
+  805bfc:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805c02:	48 63 d0             	movslq %eax,%rdx
+  805c05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c09:	48 01 d0             	add    %rdx,%rax
+  805c0c:	48 83 e8 01          	sub    $0x1,%rax
+  805c10:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805c14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c18:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c1d:	48 f7 75 d8          	divq   -0x28(%rbp)
+  805c21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c25:	48 29 d0             	sub    %rdx,%rax
+  805c28:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  805c2e:	85 c0                	test   %eax,%eax
+  805c30:	0f 48 c2             	cmovs  %edx,%eax
+  805c33:	c1 f8 0c             	sar    $0xc,%eax
+  805c36:	48 98                	cltq
+  805c38:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  805c3c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805c40:	48 85 c0             	test   %rax,%rax
+  805c43:	0f 95 c0             	setne  %al
+  805c46:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  805c49:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  805c50:	00 
+  805c51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c55:	48 83 c0 0b          	add    $0xb,%rax
+  805c59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805c5d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805c61:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c66:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805c6a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805c6e:	48 29 d0             	sub    %rdx,%rax
+  805c71:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805c75:	89 c7                	mov    %eax,%edi
+  805c77:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  805c7e:	00 00 00 
+  805c81:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805c84:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805c88:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805c8c:	48 83 ec 08          	sub    $0x8,%rsp
+  805c90:	6a 00                	push   $0x0
+  805c92:	6a 00                	push   $0x0
+  805c94:	6a 05                	push   $0x5
+  805c96:	41 89 f1             	mov    %esi,%r9d
+  805c99:	49 89 c8             	mov    %rcx,%r8
+  805c9c:	89 f9                	mov    %edi,%ecx
+  805c9e:	be 08 00 00 00       	mov    $0x8,%esi
+  805ca3:	89 c7                	mov    %eax,%edi
+  805ca5:	49 89 df             	mov    %rbx,%r15
+  805ca8:	48 b8 8f db ff ff ff 	movabs $0xffffffffffffdb8f,%rax
+  805caf:	ff ff ff 
+  805cb2:	48 01 d8             	add    %rbx,%rax
+  805cb5:	ff d0                	call   *%rax
+  805cb7:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805cbb:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805cbf:	5b                   	pop    %rbx
+  805cc0:	41 5f                	pop    %r15
+  805cc2:	5d                   	pop    %rbp
+  805cc3:	c3                   	ret
+
+0000000000805cc4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805cc4:	55                   	push   %rbp
+  805cc5:	48 89 e5             	mov    %rsp,%rbp
+  805cc8:	48 83 ec 10          	sub    $0x10,%rsp
+  805ccc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ccc <nsipc_socket+0x8>
+  805cd3:	49 bb 6c 33 00 00 00 	movabs $0x336c,%r11
+  805cda:	00 00 00 
+  805cdd:	4c 01 d8             	add    %r11,%rax
+  805ce0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805ce3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805ce6:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805ce9:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  805cf0:	00 00 00 
+  805cf3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805cf6:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805cf9:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  805d00:	00 00 00 
+  805d03:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805d06:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805d0a:	48 b9 c8 3f 01 00 00 	movabs $0x13fc8,%rcx
+  805d11:	00 00 00 
+  805d14:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805d17:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  805d1b:	bf 09 00 00 00       	mov    $0x9,%edi
+  805d20:	48 ba a1 c5 ff ff ff 	movabs $0xffffffffffffc5a1,%rdx
+  805d27:	ff ff ff 
+  805d2a:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  805d2e:	ff d0                	call   *%rax
+}
+  805d30:	c9                   	leave
+  805d31:	c3                   	ret
+
+0000000000805d32 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  805d32:	55                   	push   %rbp
+  805d33:	48 89 e5             	mov    %rsp,%rbp
+  805d36:	41 57                	push   %r15
+  805d38:	53                   	push   %rbx
+  805d39:	48 83 ec 30          	sub    $0x30,%rsp
+  805d3d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d3d <pipe+0xb>
+  805d44:	49 bb fb 32 00 00 00 	movabs $0x32fb,%r11
+  805d4b:	00 00 00 
+  805d4e:	4c 01 db             	add    %r11,%rbx
+  805d51:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  805d55:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805d59:	48 89 c7             	mov    %rax,%rdi
+  805d5c:	49 89 df             	mov    %rbx,%r15
+  805d5f:	48 b8 89 97 ff ff ff 	movabs $0xffffffffffff9789,%rax
+  805d66:	ff ff ff 
+  805d69:	48 01 d8             	add    %rbx,%rax
+  805d6c:	ff d0                	call   *%rax
+  805d6e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d71:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d75:	0f 88 12 02 00 00    	js     805f8d <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805d7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d7f:	ba 07 04 00 00       	mov    $0x407,%edx
+  805d84:	48 89 c6             	mov    %rax,%rsi
+  805d87:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d8c:	49 89 df             	mov    %rbx,%r15
+  805d8f:	48 b8 66 8f ff ff ff 	movabs $0xffffffffffff8f66,%rax
+  805d96:	ff ff ff 
+  805d99:	48 01 d8             	add    %rbx,%rax
+  805d9c:	ff d0                	call   *%rax
+  805d9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805da1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805da5:	0f 88 e2 01 00 00    	js     805f8d <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805dab:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805daf:	48 89 c7             	mov    %rax,%rdi
+  805db2:	49 89 df             	mov    %rbx,%r15
+  805db5:	48 b8 89 97 ff ff ff 	movabs $0xffffffffffff9789,%rax
+  805dbc:	ff ff ff 
+  805dbf:	48 01 d8             	add    %rbx,%rax
+  805dc2:	ff d0                	call   *%rax
+  805dc4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805dc7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805dcb:	0f 88 9b 01 00 00    	js     805f6c <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805dd1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805dd5:	ba 07 04 00 00       	mov    $0x407,%edx
+  805dda:	48 89 c6             	mov    %rax,%rsi
+  805ddd:	bf 00 00 00 00       	mov    $0x0,%edi
+  805de2:	49 89 df             	mov    %rbx,%r15
+  805de5:	48 b8 66 8f ff ff ff 	movabs $0xffffffffffff8f66,%rax
+  805dec:	ff ff ff 
+  805def:	48 01 d8             	add    %rbx,%rax
+  805df2:	ff d0                	call   *%rax
+  805df4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805df7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805dfb:	0f 88 6b 01 00 00    	js     805f6c <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805e01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e05:	48 89 c7             	mov    %rax,%rdi
+  805e08:	49 89 df             	mov    %rbx,%r15
+  805e0b:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  805e12:	ff ff ff 
+  805e15:	48 01 d8             	add    %rbx,%rax
+  805e18:	ff d0                	call   *%rax
+  805e1a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805e1e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e22:	ba 07 04 00 00       	mov    $0x407,%edx
+  805e27:	48 89 c6             	mov    %rax,%rsi
+  805e2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e2f:	49 89 df             	mov    %rbx,%r15
+  805e32:	48 b8 66 8f ff ff ff 	movabs $0xffffffffffff8f66,%rax
+  805e39:	ff ff ff 
+  805e3c:	48 01 d8             	add    %rbx,%rax
+  805e3f:	ff d0                	call   *%rax
+  805e41:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e44:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e48:	0f 88 fd 00 00 00    	js     805f4b <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805e4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e52:	48 89 c7             	mov    %rax,%rdi
+  805e55:	49 89 df             	mov    %rbx,%r15
+  805e58:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  805e5f:	ff ff ff 
+  805e62:	48 01 d8             	add    %rbx,%rax
+  805e65:	ff d0                	call   *%rax
+  805e67:	48 89 c2             	mov    %rax,%rdx
+  805e6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e6e:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805e74:	48 89 d1             	mov    %rdx,%rcx
+  805e77:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e7c:	48 89 c6             	mov    %rax,%rsi
+  805e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e84:	49 89 df             	mov    %rbx,%r15
+  805e87:	48 b8 cb 8f ff ff ff 	movabs $0xffffffffffff8fcb,%rax
+  805e8e:	ff ff ff 
+  805e91:	48 01 d8             	add    %rbx,%rax
+  805e94:	ff d0                	call   *%rax
+  805e96:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e99:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e9d:	0f 88 87 00 00 00    	js     805f2a <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805ea3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ea7:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  805eae:	00 00 00 
+  805eb1:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805eb4:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805eb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805eba:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805ec1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ec5:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  805ecc:	00 00 00 
+  805ecf:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805ed2:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805ed4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ed8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805edf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ee3:	48 89 c7             	mov    %rax,%rdi
+  805ee6:	49 89 df             	mov    %rbx,%r15
+  805ee9:	48 b8 0f 97 ff ff ff 	movabs $0xffffffffffff970f,%rax
+  805ef0:	ff ff ff 
+  805ef3:	48 01 d8             	add    %rbx,%rax
+  805ef6:	ff d0                	call   *%rax
+  805ef8:	89 c2                	mov    %eax,%edx
+  805efa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805efe:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805f00:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f04:	48 89 c7             	mov    %rax,%rdi
+  805f07:	49 89 df             	mov    %rbx,%r15
+  805f0a:	48 b8 0f 97 ff ff ff 	movabs $0xffffffffffff970f,%rax
+  805f11:	ff ff ff 
+  805f14:	48 01 d8             	add    %rbx,%rax
+  805f17:	ff d0                	call   *%rax
+  805f19:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805f1d:	48 83 c2 04          	add    $0x4,%rdx
+  805f21:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805f23:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f28:	eb 67                	jmp    805f91 <pipe+0x25f>
+		goto err3;
+  805f2a:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805f2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f2f:	48 89 c6             	mov    %rax,%rsi
+  805f32:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f37:	49 89 df             	mov    %rbx,%r15
+  805f3a:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  805f41:	ff ff ff 
+  805f44:	48 01 d8             	add    %rbx,%rax
+  805f47:	ff d0                	call   *%rax
+  805f49:	eb 01                	jmp    805f4c <pipe+0x21a>
+		goto err2;
+  805f4b:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805f4c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f50:	48 89 c6             	mov    %rax,%rsi
+  805f53:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f58:	49 89 df             	mov    %rbx,%r15
+  805f5b:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  805f62:	ff ff ff 
+  805f65:	48 01 d8             	add    %rbx,%rax
+  805f68:	ff d0                	call   *%rax
+  805f6a:	eb 01                	jmp    805f6d <pipe+0x23b>
+		goto err1;
+  805f6c:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805f6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f71:	48 89 c6             	mov    %rax,%rsi
+  805f74:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f79:	49 89 df             	mov    %rbx,%r15
+  805f7c:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  805f83:	ff ff ff 
+  805f86:	48 01 d8             	add    %rbx,%rax
+  805f89:	ff d0                	call   *%rax
+  805f8b:	eb 01                	jmp    805f8e <pipe+0x25c>
+		goto err;
+  805f8d:	90                   	nop
+err:
+	return r;
+  805f8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805f91:	48 83 c4 30          	add    $0x30,%rsp
+  805f95:	5b                   	pop    %rbx
+  805f96:	41 5f                	pop    %r15
+  805f98:	5d                   	pop    %rbp
+  805f99:	c3                   	ret
+
+0000000000805f9a <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805f9a:	55                   	push   %rbp
+  805f9b:	48 89 e5             	mov    %rsp,%rbp
+  805f9e:	41 57                	push   %r15
+  805fa0:	41 54                	push   %r12
+  805fa2:	53                   	push   %rbx
+  805fa3:	48 83 ec 28          	sub    $0x28,%rsp
+  805fa7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fa7 <_pipeisclosed+0xd>
+  805fae:	49 bb 91 30 00 00 00 	movabs $0x3091,%r11
+  805fb5:	00 00 00 
+  805fb8:	4c 01 db             	add    %r11,%rbx
+  805fbb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805fbf:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805fc3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805fca:	ff ff ff 
+  805fcd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805fd1:	48 8b 00             	mov    (%rax),%rax
+  805fd4:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805fda:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805fdd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805fe1:	48 89 c7             	mov    %rax,%rdi
+  805fe4:	49 89 df             	mov    %rbx,%r15
+  805fe7:	48 b8 16 e0 ff ff ff 	movabs $0xffffffffffffe016,%rax
+  805fee:	ff ff ff 
+  805ff1:	48 01 d8             	add    %rbx,%rax
+  805ff4:	ff d0                	call   *%rax
+  805ff6:	41 89 c4             	mov    %eax,%r12d
+  805ff9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805ffd:	48 89 c7             	mov    %rax,%rdi
+  806000:	49 89 df             	mov    %rbx,%r15
+  806003:	48 b8 16 e0 ff ff ff 	movabs $0xffffffffffffe016,%rax
+  80600a:	ff ff ff 
+  80600d:	48 01 d8             	add    %rbx,%rax
+  806010:	ff d0                	call   *%rax
+  806012:	41 39 c4             	cmp    %eax,%r12d
+  806015:	0f 94 c0             	sete   %al
+  806018:	0f b6 c0             	movzbl %al,%eax
+  80601b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  80601e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806025:	ff ff ff 
+  806028:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80602c:	48 8b 00             	mov    (%rax),%rax
+  80602f:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806035:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  806038:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80603b:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80603e:	75 05                	jne    806045 <_pipeisclosed+0xab>
+			return ret;
+  806040:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806043:	eb 63                	jmp    8060a8 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  806045:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806048:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80604b:	0f 84 72 ff ff ff    	je     805fc3 <_pipeisclosed+0x29>
+  806051:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  806055:	0f 85 68 ff ff ff    	jne    805fc3 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80605b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806062:	ff ff ff 
+  806065:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806069:	48 8b 00             	mov    (%rax),%rax
+  80606c:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806072:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  806075:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806078:	89 c6                	mov    %eax,%esi
+  80607a:	48 b8 b9 e7 ff ff ff 	movabs $0xffffffffffffe7b9,%rax
+  806081:	ff ff ff 
+  806084:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806088:	48 89 c7             	mov    %rax,%rdi
+  80608b:	49 89 df             	mov    %rbx,%r15
+  80608e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806093:	49 b8 e8 74 ff ff ff 	movabs $0xffffffffffff74e8,%r8
+  80609a:	ff ff ff 
+  80609d:	49 01 d8             	add    %rbx,%r8
+  8060a0:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8060a3:	e9 1b ff ff ff       	jmp    805fc3 <_pipeisclosed+0x29>
+	}
+}
+  8060a8:	48 83 c4 28          	add    $0x28,%rsp
+  8060ac:	5b                   	pop    %rbx
+  8060ad:	41 5c                	pop    %r12
+  8060af:	41 5f                	pop    %r15
+  8060b1:	5d                   	pop    %rbp
+  8060b2:	c3                   	ret
+
+00000000008060b3 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8060b3:	55                   	push   %rbp
+  8060b4:	48 89 e5             	mov    %rsp,%rbp
+  8060b7:	41 57                	push   %r15
+  8060b9:	53                   	push   %rbx
+  8060ba:	48 83 ec 30          	sub    $0x30,%rsp
+  8060be:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060be <pipeisclosed+0xb>
+  8060c5:	49 bb 7a 2f 00 00 00 	movabs $0x2f7a,%r11
+  8060cc:	00 00 00 
+  8060cf:	4c 01 db             	add    %r11,%rbx
+  8060d2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8060d5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8060d9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8060dc:	48 89 d6             	mov    %rdx,%rsi
+  8060df:	89 c7                	mov    %eax,%edi
+  8060e1:	49 89 df             	mov    %rbx,%r15
+  8060e4:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  8060eb:	ff ff ff 
+  8060ee:	48 01 d8             	add    %rbx,%rax
+  8060f1:	ff d0                	call   *%rax
+  8060f3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8060f6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060fa:	79 05                	jns    806101 <pipeisclosed+0x4e>
+		return r;
+  8060fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060ff:	eb 3b                	jmp    80613c <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  806101:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806105:	48 89 c7             	mov    %rax,%rdi
+  806108:	49 89 df             	mov    %rbx,%r15
+  80610b:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  806112:	ff ff ff 
+  806115:	48 01 d8             	add    %rbx,%rax
+  806118:	ff d0                	call   *%rax
+  80611a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  80611e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806122:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806126:	48 89 d6             	mov    %rdx,%rsi
+  806129:	48 89 c7             	mov    %rax,%rdi
+  80612c:	48 b8 62 cf ff ff ff 	movabs $0xffffffffffffcf62,%rax
+  806133:	ff ff ff 
+  806136:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80613a:	ff d0                	call   *%rax
+}
+  80613c:	48 83 c4 30          	add    $0x30,%rsp
+  806140:	5b                   	pop    %rbx
+  806141:	41 5f                	pop    %r15
+  806143:	5d                   	pop    %rbp
+  806144:	c3                   	ret
+
+0000000000806145 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806145:	55                   	push   %rbp
+  806146:	48 89 e5             	mov    %rsp,%rbp
+  806149:	41 57                	push   %r15
+  80614b:	53                   	push   %rbx
+  80614c:	48 83 ec 40          	sub    $0x40,%rsp
+  806150:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806150 <devpipe_read+0xb>
+  806157:	49 bb e8 2e 00 00 00 	movabs $0x2ee8,%r11
+  80615e:	00 00 00 
+  806161:	4c 01 db             	add    %r11,%rbx
+  806164:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806168:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80616c:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806170:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806174:	48 89 c7             	mov    %rax,%rdi
+  806177:	49 89 df             	mov    %rbx,%r15
+  80617a:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  806181:	ff ff ff 
+  806184:	48 01 d8             	add    %rbx,%rax
+  806187:	ff d0                	call   *%rax
+  806189:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  80618d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806191:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806195:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80619c:	00 
+  80619d:	e9 a1 00 00 00       	jmp    806243 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8061a2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8061a7:	74 09                	je     8061b2 <devpipe_read+0x6d>
+				return i;
+  8061a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061ad:	e9 9f 00 00 00       	jmp    806251 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8061b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8061b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8061ba:	48 89 d6             	mov    %rdx,%rsi
+  8061bd:	48 89 c7             	mov    %rax,%rdi
+  8061c0:	48 b8 62 cf ff ff ff 	movabs $0xffffffffffffcf62,%rax
+  8061c7:	ff ff ff 
+  8061ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8061ce:	ff d0                	call   *%rax
+  8061d0:	85 c0                	test   %eax,%eax
+  8061d2:	74 07                	je     8061db <devpipe_read+0x96>
+				return 0;
+  8061d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061d9:	eb 76                	jmp    806251 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8061db:	49 89 df             	mov    %rbx,%r15
+  8061de:	48 b8 11 8f ff ff ff 	movabs $0xffffffffffff8f11,%rax
+  8061e5:	ff ff ff 
+  8061e8:	48 01 d8             	add    %rbx,%rax
+  8061eb:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8061ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061f1:	8b 10                	mov    (%rax),%edx
+  8061f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061f7:	8b 40 04             	mov    0x4(%rax),%eax
+  8061fa:	39 c2                	cmp    %eax,%edx
+  8061fc:	74 a4                	je     8061a2 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8061fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806202:	8b 10                	mov    (%rax),%edx
+  806204:	89 d0                	mov    %edx,%eax
+  806206:	c1 f8 1f             	sar    $0x1f,%eax
+  806209:	c1 e8 1b             	shr    $0x1b,%eax
+  80620c:	01 c2                	add    %eax,%edx
+  80620e:	83 e2 1f             	and    $0x1f,%edx
+  806211:	29 c2                	sub    %eax,%edx
+  806213:	89 d6                	mov    %edx,%esi
+  806215:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806219:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80621d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806221:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806225:	48 63 c6             	movslq %esi,%rax
+  806228:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  80622d:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  80622f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806233:	8b 00                	mov    (%rax),%eax
+  806235:	8d 50 01             	lea    0x1(%rax),%edx
+  806238:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80623c:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  80623e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806243:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806247:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80624b:	72 a0                	jb     8061ed <devpipe_read+0xa8>
+	}
+	return i;
+  80624d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806251:	48 83 c4 40          	add    $0x40,%rsp
+  806255:	5b                   	pop    %rbx
+  806256:	41 5f                	pop    %r15
+  806258:	5d                   	pop    %rbp
+  806259:	c3                   	ret
+
+000000000080625a <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80625a:	55                   	push   %rbp
+  80625b:	48 89 e5             	mov    %rsp,%rbp
+  80625e:	41 57                	push   %r15
+  806260:	53                   	push   %rbx
+  806261:	48 83 ec 40          	sub    $0x40,%rsp
+  806265:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806265 <devpipe_write+0xb>
+  80626c:	49 bb d3 2d 00 00 00 	movabs $0x2dd3,%r11
+  806273:	00 00 00 
+  806276:	4c 01 db             	add    %r11,%rbx
+  806279:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80627d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806281:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  806285:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806289:	48 89 c7             	mov    %rax,%rdi
+  80628c:	49 89 df             	mov    %rbx,%r15
+  80628f:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  806296:	ff ff ff 
+  806299:	48 01 d8             	add    %rbx,%rax
+  80629c:	ff d0                	call   *%rax
+  80629e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8062a2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8062a6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8062aa:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8062b1:	00 
+  8062b2:	e9 a0 00 00 00       	jmp    806357 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8062b7:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8062bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8062bf:	48 89 d6             	mov    %rdx,%rsi
+  8062c2:	48 89 c7             	mov    %rax,%rdi
+  8062c5:	48 b8 62 cf ff ff ff 	movabs $0xffffffffffffcf62,%rax
+  8062cc:	ff ff ff 
+  8062cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8062d3:	ff d0                	call   *%rax
+  8062d5:	85 c0                	test   %eax,%eax
+  8062d7:	74 0a                	je     8062e3 <devpipe_write+0x89>
+				return 0;
+  8062d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062de:	e9 82 00 00 00       	jmp    806365 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8062e3:	49 89 df             	mov    %rbx,%r15
+  8062e6:	48 b8 11 8f ff ff ff 	movabs $0xffffffffffff8f11,%rax
+  8062ed:	ff ff ff 
+  8062f0:	48 01 d8             	add    %rbx,%rax
+  8062f3:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8062f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062f9:	8b 40 04             	mov    0x4(%rax),%eax
+  8062fc:	48 63 d0             	movslq %eax,%rdx
+  8062ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806303:	8b 00                	mov    (%rax),%eax
+  806305:	48 98                	cltq
+  806307:	48 83 c0 20          	add    $0x20,%rax
+  80630b:	48 39 c2             	cmp    %rax,%rdx
+  80630e:	73 a7                	jae    8062b7 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806310:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806314:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806318:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80631c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806320:	8b 50 04             	mov    0x4(%rax),%edx
+  806323:	89 d0                	mov    %edx,%eax
+  806325:	c1 f8 1f             	sar    $0x1f,%eax
+  806328:	c1 e8 1b             	shr    $0x1b,%eax
+  80632b:	01 c2                	add    %eax,%edx
+  80632d:	83 e2 1f             	and    $0x1f,%edx
+  806330:	29 c2                	sub    %eax,%edx
+  806332:	89 d0                	mov    %edx,%eax
+  806334:	0f b6 09             	movzbl (%rcx),%ecx
+  806337:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80633b:	48 98                	cltq
+  80633d:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806341:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806345:	8b 40 04             	mov    0x4(%rax),%eax
+  806348:	8d 50 01             	lea    0x1(%rax),%edx
+  80634b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80634f:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806352:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806357:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80635b:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80635f:	72 94                	jb     8062f5 <devpipe_write+0x9b>
+	}
+
+	return i;
+  806361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806365:	48 83 c4 40          	add    $0x40,%rsp
+  806369:	5b                   	pop    %rbx
+  80636a:	41 5f                	pop    %r15
+  80636c:	5d                   	pop    %rbp
+  80636d:	c3                   	ret
+
+000000000080636e <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80636e:	55                   	push   %rbp
+  80636f:	48 89 e5             	mov    %rsp,%rbp
+  806372:	41 57                	push   %r15
+  806374:	53                   	push   %rbx
+  806375:	48 83 ec 20          	sub    $0x20,%rsp
+  806379:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806379 <devpipe_stat+0xb>
+  806380:	49 bb bf 2c 00 00 00 	movabs $0x2cbf,%r11
+  806387:	00 00 00 
+  80638a:	4c 01 db             	add    %r11,%rbx
+  80638d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806391:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  806395:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806399:	48 89 c7             	mov    %rax,%rdi
+  80639c:	49 89 df             	mov    %rbx,%r15
+  80639f:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  8063a6:	ff ff ff 
+  8063a9:	48 01 d8             	add    %rbx,%rax
+  8063ac:	ff d0                	call   *%rax
+  8063ae:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8063b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063b6:	48 ba cc e7 ff ff ff 	movabs $0xffffffffffffe7cc,%rdx
+  8063bd:	ff ff ff 
+  8063c0:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8063c4:	48 89 d6             	mov    %rdx,%rsi
+  8063c7:	48 89 c7             	mov    %rax,%rdi
+  8063ca:	49 89 df             	mov    %rbx,%r15
+  8063cd:	48 b8 aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rax
+  8063d4:	ff ff ff 
+  8063d7:	48 01 d8             	add    %rbx,%rax
+  8063da:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8063dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063e0:	8b 50 04             	mov    0x4(%rax),%edx
+  8063e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063e7:	8b 00                	mov    (%rax),%eax
+  8063e9:	29 c2                	sub    %eax,%edx
+  8063eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063ef:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8063f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063f9:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806400:	00 00 00 
+	stat->st_dev = &devpipe;
+  806403:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806407:	48 ba c8 00 00 00 00 	movabs $0xc8,%rdx
+  80640e:	00 00 00 
+  806411:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806415:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80641c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806421:	48 83 c4 20          	add    $0x20,%rsp
+  806425:	5b                   	pop    %rbx
+  806426:	41 5f                	pop    %r15
+  806428:	5d                   	pop    %rbp
+  806429:	c3                   	ret
+
+000000000080642a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80642a:	55                   	push   %rbp
+  80642b:	48 89 e5             	mov    %rsp,%rbp
+  80642e:	41 57                	push   %r15
+  806430:	53                   	push   %rbx
+  806431:	48 83 ec 10          	sub    $0x10,%rsp
+  806435:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806435 <devpipe_close+0xb>
+  80643c:	49 bb 03 2c 00 00 00 	movabs $0x2c03,%r11
+  806443:	00 00 00 
+  806446:	4c 01 db             	add    %r11,%rbx
+  806449:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  80644d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806451:	48 89 c6             	mov    %rax,%rsi
+  806454:	bf 00 00 00 00       	mov    $0x0,%edi
+  806459:	49 89 df             	mov    %rbx,%r15
+  80645c:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  806463:	ff ff ff 
+  806466:	48 01 d8             	add    %rbx,%rax
+  806469:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80646b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80646f:	48 89 c7             	mov    %rax,%rdi
+  806472:	49 89 df             	mov    %rbx,%r15
+  806475:	48 b8 46 97 ff ff ff 	movabs $0xffffffffffff9746,%rax
+  80647c:	ff ff ff 
+  80647f:	48 01 d8             	add    %rbx,%rax
+  806482:	ff d0                	call   *%rax
+  806484:	48 89 c6             	mov    %rax,%rsi
+  806487:	bf 00 00 00 00       	mov    $0x0,%edi
+  80648c:	49 89 df             	mov    %rbx,%r15
+  80648f:	48 b8 3e 90 ff ff ff 	movabs $0xffffffffffff903e,%rax
+  806496:	ff ff ff 
+  806499:	48 01 d8             	add    %rbx,%rax
+  80649c:	ff d0                	call   *%rax
+}
+  80649e:	48 83 c4 10          	add    $0x10,%rsp
+  8064a2:	5b                   	pop    %rbx
+  8064a3:	41 5f                	pop    %r15
+  8064a5:	5d                   	pop    %rbp
+  8064a6:	c3                   	ret
+
+00000000008064a7 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8064a7:	55                   	push   %rbp
+  8064a8:	48 89 e5             	mov    %rsp,%rbp
+  8064ab:	41 57                	push   %r15
+  8064ad:	48 83 ec 28          	sub    $0x28,%rsp
+  8064b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064b1 <cputchar+0xa>
+  8064b8:	49 bb 87 2b 00 00 00 	movabs $0x2b87,%r11
+  8064bf:	00 00 00 
+  8064c2:	4c 01 d8             	add    %r11,%rax
+  8064c5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8064c8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8064cb:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8064ce:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8064d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8064d7:	48 89 d7             	mov    %rdx,%rdi
+  8064da:	49 89 c7             	mov    %rax,%r15
+  8064dd:	48 ba ae 8d ff ff ff 	movabs $0xffffffffffff8dae,%rdx
+  8064e4:	ff ff ff 
+  8064e7:	48 01 c2             	add    %rax,%rdx
+  8064ea:	ff d2                	call   *%rdx
+}
+  8064ec:	90                   	nop
+  8064ed:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8064f1:	c9                   	leave
+  8064f2:	c3                   	ret
+
+00000000008064f3 <getchar>:
+
+int
+getchar(void)
+{
+  8064f3:	55                   	push   %rbp
+  8064f4:	48 89 e5             	mov    %rsp,%rbp
+  8064f7:	41 57                	push   %r15
+  8064f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8064fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064fd <getchar+0xa>
+  806504:	49 bb 3b 2b 00 00 00 	movabs $0x2b3b,%r11
+  80650b:	00 00 00 
+  80650e:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806511:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806515:	ba 01 00 00 00       	mov    $0x1,%edx
+  80651a:	48 89 ce             	mov    %rcx,%rsi
+  80651d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806522:	49 89 c7             	mov    %rax,%r15
+  806525:	48 b9 86 9d ff ff ff 	movabs $0xffffffffffff9d86,%rcx
+  80652c:	ff ff ff 
+  80652f:	48 01 c1             	add    %rax,%rcx
+  806532:	ff d1                	call   *%rcx
+  806534:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  806537:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80653b:	79 05                	jns    806542 <getchar+0x4f>
+		return r;
+  80653d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806540:	eb 14                	jmp    806556 <getchar+0x63>
+	if (r < 1)
+  806542:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806546:	7f 07                	jg     80654f <getchar+0x5c>
+		return -E_EOF;
+  806548:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  80654d:	eb 07                	jmp    806556 <getchar+0x63>
+	return c;
+  80654f:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806553:	0f b6 c0             	movzbl %al,%eax
+}
+  806556:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80655a:	c9                   	leave
+  80655b:	c3                   	ret
+
+000000000080655c <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80655c:	55                   	push   %rbp
+  80655d:	48 89 e5             	mov    %rsp,%rbp
+  806560:	41 57                	push   %r15
+  806562:	53                   	push   %rbx
+  806563:	48 83 ec 20          	sub    $0x20,%rsp
+  806567:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806567 <iscons+0xb>
+  80656e:	49 bb d1 2a 00 00 00 	movabs $0x2ad1,%r11
+  806575:	00 00 00 
+  806578:	4c 01 db             	add    %r11,%rbx
+  80657b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80657e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806582:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806585:	48 89 d6             	mov    %rdx,%rsi
+  806588:	89 c7                	mov    %eax,%edi
+  80658a:	49 89 df             	mov    %rbx,%r15
+  80658d:	48 b8 3f 98 ff ff ff 	movabs $0xffffffffffff983f,%rax
+  806594:	ff ff ff 
+  806597:	48 01 d8             	add    %rbx,%rax
+  80659a:	ff d0                	call   *%rax
+  80659c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80659f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065a3:	79 05                	jns    8065aa <iscons+0x4e>
+		return r;
+  8065a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065a8:	eb 1b                	jmp    8065c5 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8065aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8065ae:	8b 10                	mov    (%rax),%edx
+  8065b0:	48 b8 08 01 00 00 00 	movabs $0x108,%rax
+  8065b7:	00 00 00 
+  8065ba:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8065bd:	39 c2                	cmp    %eax,%edx
+  8065bf:	0f 94 c0             	sete   %al
+  8065c2:	0f b6 c0             	movzbl %al,%eax
+}
+  8065c5:	48 83 c4 20          	add    $0x20,%rsp
+  8065c9:	5b                   	pop    %rbx
+  8065ca:	41 5f                	pop    %r15
+  8065cc:	5d                   	pop    %rbp
+  8065cd:	c3                   	ret
+
+00000000008065ce <opencons>:
+
+int
+opencons(void)
+{
+  8065ce:	55                   	push   %rbp
+  8065cf:	48 89 e5             	mov    %rsp,%rbp
+  8065d2:	41 57                	push   %r15
+  8065d4:	53                   	push   %rbx
+  8065d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8065d9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065d9 <opencons+0xb>
+  8065e0:	49 bb 5f 2a 00 00 00 	movabs $0x2a5f,%r11
+  8065e7:	00 00 00 
+  8065ea:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8065ed:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8065f1:	48 89 c7             	mov    %rax,%rdi
+  8065f4:	49 89 df             	mov    %rbx,%r15
+  8065f7:	48 b8 89 97 ff ff ff 	movabs $0xffffffffffff9789,%rax
+  8065fe:	ff ff ff 
+  806601:	48 01 d8             	add    %rbx,%rax
+  806604:	ff d0                	call   *%rax
+  806606:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806609:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80660d:	79 05                	jns    806614 <opencons+0x46>
+		return r;
+  80660f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806612:	eb 68                	jmp    80667c <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806614:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806618:	ba 07 04 00 00       	mov    $0x407,%edx
+  80661d:	48 89 c6             	mov    %rax,%rsi
+  806620:	bf 00 00 00 00       	mov    $0x0,%edi
+  806625:	49 89 df             	mov    %rbx,%r15
+  806628:	48 b8 66 8f ff ff ff 	movabs $0xffffffffffff8f66,%rax
+  80662f:	ff ff ff 
+  806632:	48 01 d8             	add    %rbx,%rax
+  806635:	ff d0                	call   *%rax
+  806637:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80663a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80663e:	79 05                	jns    806645 <opencons+0x77>
+		return r;
+  806640:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806643:	eb 37                	jmp    80667c <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806645:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806649:	48 ba 08 01 00 00 00 	movabs $0x108,%rdx
+  806650:	00 00 00 
+  806653:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806656:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806658:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80665c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806663:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806667:	48 89 c7             	mov    %rax,%rdi
+  80666a:	49 89 df             	mov    %rbx,%r15
+  80666d:	48 b8 0f 97 ff ff ff 	movabs $0xffffffffffff970f,%rax
+  806674:	ff ff ff 
+  806677:	48 01 d8             	add    %rbx,%rax
+  80667a:	ff d0                	call   *%rax
+}
+  80667c:	48 83 c4 10          	add    $0x10,%rsp
+  806680:	5b                   	pop    %rbx
+  806681:	41 5f                	pop    %r15
+  806683:	5d                   	pop    %rbp
+  806684:	c3                   	ret
+
+0000000000806685 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806685:	55                   	push   %rbp
+  806686:	48 89 e5             	mov    %rsp,%rbp
+  806689:	41 57                	push   %r15
+  80668b:	53                   	push   %rbx
+  80668c:	48 83 ec 30          	sub    $0x30,%rsp
+  806690:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806690 <devcons_read+0xb>
+  806697:	49 bb a8 29 00 00 00 	movabs $0x29a8,%r11
+  80669e:	00 00 00 
+  8066a1:	4c 01 db             	add    %r11,%rbx
+  8066a4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8066a8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8066ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  8066b0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8066b5:	75 19                	jne    8066d0 <devcons_read+0x4b>
+		return 0;
+  8066b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8066bc:	eb 55                	jmp    806713 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  8066be:	49 89 df             	mov    %rbx,%r15
+  8066c1:	48 b8 11 8f ff ff ff 	movabs $0xffffffffffff8f11,%rax
+  8066c8:	ff ff ff 
+  8066cb:	48 01 d8             	add    %rbx,%rax
+  8066ce:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  8066d0:	49 89 df             	mov    %rbx,%r15
+  8066d3:	48 b8 0d 8e ff ff ff 	movabs $0xffffffffffff8e0d,%rax
+  8066da:	ff ff ff 
+  8066dd:	48 01 d8             	add    %rbx,%rax
+  8066e0:	ff d0                	call   *%rax
+  8066e2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8066e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066e9:	74 d3                	je     8066be <devcons_read+0x39>
+	if (c < 0)
+  8066eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066ef:	79 05                	jns    8066f6 <devcons_read+0x71>
+		return c;
+  8066f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066f4:	eb 1d                	jmp    806713 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  8066f6:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  8066fa:	75 07                	jne    806703 <devcons_read+0x7e>
+		return 0;
+  8066fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  806701:	eb 10                	jmp    806713 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806703:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806706:	89 c2                	mov    %eax,%edx
+  806708:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80670c:	88 10                	mov    %dl,(%rax)
+	return 1;
+  80670e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806713:	48 83 c4 30          	add    $0x30,%rsp
+  806717:	5b                   	pop    %rbx
+  806718:	41 5f                	pop    %r15
+  80671a:	5d                   	pop    %rbp
+  80671b:	c3                   	ret
+
+000000000080671c <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80671c:	55                   	push   %rbp
+  80671d:	48 89 e5             	mov    %rsp,%rbp
+  806720:	41 57                	push   %r15
+  806722:	53                   	push   %rbx
+  806723:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80672a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80672a <devcons_write+0xe>
+  806731:	49 bb 0e 29 00 00 00 	movabs $0x290e,%r11
+  806738:	00 00 00 
+  80673b:	4c 01 db             	add    %r11,%rbx
+  80673e:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806745:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  80674c:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806753:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80675a:	e9 80 00 00 00       	jmp    8067df <devcons_write+0xc3>
+		m = n - tot;
+  80675f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806766:	89 c2                	mov    %eax,%edx
+  806768:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80676b:	29 c2                	sub    %eax,%edx
+  80676d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806770:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806773:	83 f8 7f             	cmp    $0x7f,%eax
+  806776:	76 07                	jbe    80677f <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806778:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80677f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806782:	48 63 d0             	movslq %eax,%rdx
+  806785:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806788:	48 63 c8             	movslq %eax,%rcx
+  80678b:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806792:	48 01 c1             	add    %rax,%rcx
+  806795:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80679c:	48 89 ce             	mov    %rcx,%rsi
+  80679f:	48 89 c7             	mov    %rax,%rdi
+  8067a2:	49 89 df             	mov    %rbx,%r15
+  8067a5:	48 b8 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rax
+  8067ac:	ff ff ff 
+  8067af:	48 01 d8             	add    %rbx,%rax
+  8067b2:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  8067b4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8067b7:	48 63 d0             	movslq %eax,%rdx
+  8067ba:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  8067c1:	48 89 d6             	mov    %rdx,%rsi
+  8067c4:	48 89 c7             	mov    %rax,%rdi
+  8067c7:	49 89 df             	mov    %rbx,%r15
+  8067ca:	48 b8 ae 8d ff ff ff 	movabs $0xffffffffffff8dae,%rax
+  8067d1:	ff ff ff 
+  8067d4:	48 01 d8             	add    %rbx,%rax
+  8067d7:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  8067d9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8067dc:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8067df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067e2:	48 98                	cltq
+  8067e4:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  8067eb:	0f 82 6e ff ff ff    	jb     80675f <devcons_write+0x43>
+	}
+	return tot;
+  8067f1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8067f4:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  8067fb:	5b                   	pop    %rbx
+  8067fc:	41 5f                	pop    %r15
+  8067fe:	5d                   	pop    %rbp
+  8067ff:	c3                   	ret
+
+0000000000806800 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806800:	55                   	push   %rbp
+  806801:	48 89 e5             	mov    %rsp,%rbp
+  806804:	48 83 ec 08          	sub    $0x8,%rsp
+  806808:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806808 <devcons_close+0x8>
+  80680f:	49 bb 30 28 00 00 00 	movabs $0x2830,%r11
+  806816:	00 00 00 
+  806819:	4c 01 d8             	add    %r11,%rax
+  80681c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806820:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806825:	c9                   	leave
+  806826:	c3                   	ret
+
+0000000000806827 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806827:	55                   	push   %rbp
+  806828:	48 89 e5             	mov    %rsp,%rbp
+  80682b:	41 57                	push   %r15
+  80682d:	48 83 ec 18          	sub    $0x18,%rsp
+  806831:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806831 <devcons_stat+0xa>
+  806838:	49 bb 07 28 00 00 00 	movabs $0x2807,%r11
+  80683f:	00 00 00 
+  806842:	4c 01 d8             	add    %r11,%rax
+  806845:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806849:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  80684d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806851:	48 b9 d8 e7 ff ff ff 	movabs $0xffffffffffffe7d8,%rcx
+  806858:	ff ff ff 
+  80685b:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  80685f:	48 89 ce             	mov    %rcx,%rsi
+  806862:	48 89 d7             	mov    %rdx,%rdi
+  806865:	49 89 c7             	mov    %rax,%r15
+  806868:	48 ba aa 82 ff ff ff 	movabs $0xffffffffffff82aa,%rdx
+  80686f:	ff ff ff 
+  806872:	48 01 c2             	add    %rax,%rdx
+  806875:	ff d2                	call   *%rdx
+	return 0;
+  806877:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80687c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806880:	c9                   	leave
+  806881:	c3                   	ret
+
+0000000000806882 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806882:	55                   	push   %rbp
+  806883:	48 89 e5             	mov    %rsp,%rbp
+  806886:	41 57                	push   %r15
+  806888:	53                   	push   %rbx
+  806889:	48 83 ec 30          	sub    $0x30,%rsp
+  80688d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80688d <ipc_recv+0xb>
+  806894:	49 bb ab 27 00 00 00 	movabs $0x27ab,%r11
+  80689b:	00 00 00 
+  80689e:	4c 01 db             	add    %r11,%rbx
+  8068a1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8068a5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8068a9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8068ad:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8068b2:	75 0e                	jne    8068c2 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8068b4:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8068bb:	00 00 00 
+  8068be:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8068c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068c6:	48 89 c7             	mov    %rax,%rdi
+  8068c9:	49 89 df             	mov    %rbx,%r15
+  8068cc:	48 b8 8f 92 ff ff ff 	movabs $0xffffffffffff928f,%rax
+  8068d3:	ff ff ff 
+  8068d6:	48 01 d8             	add    %rbx,%rax
+  8068d9:	ff d0                	call   *%rax
+  8068db:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8068de:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8068e3:	74 2a                	je     80690f <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8068e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068e9:	75 19                	jne    806904 <ipc_recv+0x82>
+  8068eb:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068f2:	ff ff ff 
+  8068f5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068f9:	48 8b 00             	mov    (%rax),%rax
+  8068fc:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806902:	eb 05                	jmp    806909 <ipc_recv+0x87>
+  806904:	b8 00 00 00 00       	mov    $0x0,%eax
+  806909:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80690d:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80690f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806914:	74 2a                	je     806940 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  806916:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80691a:	75 19                	jne    806935 <ipc_recv+0xb3>
+  80691c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806923:	ff ff ff 
+  806926:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80692a:	48 8b 00             	mov    (%rax),%rax
+  80692d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806933:	eb 05                	jmp    80693a <ipc_recv+0xb8>
+  806935:	b8 00 00 00 00       	mov    $0x0,%eax
+  80693a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80693e:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806940:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806944:	74 05                	je     80694b <ipc_recv+0xc9>
+		return res;
+  806946:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806949:	eb 17                	jmp    806962 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  80694b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806952:	ff ff ff 
+  806955:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806959:	48 8b 00             	mov    (%rax),%rax
+  80695c:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806962:	48 83 c4 30          	add    $0x30,%rsp
+  806966:	5b                   	pop    %rbx
+  806967:	41 5f                	pop    %r15
+  806969:	5d                   	pop    %rbp
+  80696a:	c3                   	ret
+
+000000000080696b <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80696b:	55                   	push   %rbp
+  80696c:	48 89 e5             	mov    %rsp,%rbp
+  80696f:	41 57                	push   %r15
+  806971:	53                   	push   %rbx
+  806972:	48 83 ec 20          	sub    $0x20,%rsp
+  806976:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806976 <ipc_send+0xb>
+  80697d:	49 bb c2 26 00 00 00 	movabs $0x26c2,%r11
+  806984:	00 00 00 
+  806987:	4c 01 db             	add    %r11,%rbx
+  80698a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80698d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806990:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806994:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  806997:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80699c:	75 0e                	jne    8069ac <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  80699e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8069a5:	00 00 00 
+  8069a8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8069ac:	90                   	nop
+  8069ad:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8069b0:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8069b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8069b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069ba:	89 c7                	mov    %eax,%edi
+  8069bc:	49 89 df             	mov    %rbx,%r15
+  8069bf:	48 b8 25 92 ff ff ff 	movabs $0xffffffffffff9225,%rax
+  8069c6:	ff ff ff 
+  8069c9:	48 01 d8             	add    %rbx,%rax
+  8069cc:	ff d0                	call   *%rax
+  8069ce:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8069d1:	74 da                	je     8069ad <ipc_send+0x42>
+		;
+}
+  8069d3:	90                   	nop
+  8069d4:	90                   	nop
+  8069d5:	48 83 c4 20          	add    $0x20,%rsp
+  8069d9:	5b                   	pop    %rbx
+  8069da:	41 5f                	pop    %r15
+  8069dc:	5d                   	pop    %rbp
+  8069dd:	c3                   	ret
+
+00000000008069de <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8069de:	55                   	push   %rbp
+  8069df:	48 89 e5             	mov    %rsp,%rbp
+  8069e2:	41 57                	push   %r15
+  8069e4:	53                   	push   %rbx
+  8069e5:	48 83 ec 40          	sub    $0x40,%rsp
+  8069e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069e9 <ipc_call+0xb>
+  8069f0:	49 bb 4f 26 00 00 00 	movabs $0x264f,%r11
+  8069f7:	00 00 00 
+  8069fa:	4c 01 db             	add    %r11,%rbx
+  8069fd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806a00:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806a03:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806a07:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806a0a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806a0e:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806a12:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806a17:	75 0e                	jne    806a27 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806a19:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806a20:	00 00 00 
+  806a23:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806a27:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806a2c:	75 0e                	jne    806a3c <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806a2e:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806a35:	00 00 00 
+  806a38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806a3c:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806a3f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806a43:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806a46:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806a4a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a4d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806a53:	49 89 f8             	mov    %rdi,%r8
+  806a56:	89 c7                	mov    %eax,%edi
+  806a58:	49 89 df             	mov    %rbx,%r15
+  806a5b:	48 b8 e8 92 ff ff ff 	movabs $0xffffffffffff92e8,%rax
+  806a62:	ff ff ff 
+  806a65:	48 01 d8             	add    %rbx,%rax
+  806a68:	ff d0                	call   *%rax
+  806a6a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806a6d:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806a72:	74 2a                	je     806a9e <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806a74:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a78:	75 19                	jne    806a93 <ipc_call+0xb5>
+  806a7a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a81:	ff ff ff 
+  806a84:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a88:	48 8b 00             	mov    (%rax),%rax
+  806a8b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806a91:	eb 05                	jmp    806a98 <ipc_call+0xba>
+  806a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a98:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806a9c:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806a9e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806aa2:	74 05                	je     806aa9 <ipc_call+0xcb>
+		return r;
+  806aa4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806aa7:	eb 17                	jmp    806ac0 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806aa9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806ab0:	ff ff ff 
+  806ab3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806ab7:	48 8b 00             	mov    (%rax),%rax
+  806aba:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806ac0:	48 83 c4 40          	add    $0x40,%rsp
+  806ac4:	5b                   	pop    %rbx
+  806ac5:	41 5f                	pop    %r15
+  806ac7:	5d                   	pop    %rbp
+  806ac8:	c3                   	ret
+
+0000000000806ac9 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  806ac9:	55                   	push   %rbp
+  806aca:	48 89 e5             	mov    %rsp,%rbp
+  806acd:	41 57                	push   %r15
+  806acf:	53                   	push   %rbx
+  806ad0:	48 83 ec 70          	sub    $0x70,%rsp
+  806ad4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ad4 <ipc_callw+0xb>
+  806adb:	49 bb 64 25 00 00 00 	movabs $0x2564,%r11
+  806ae2:	00 00 00 
+  806ae5:	4c 01 db             	add    %r11,%rbx
+  806ae8:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  806aeb:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806aee:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806af2:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806af6:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806afb:	76 0a                	jbe    806b07 <ipc_callw+0x3e>
+		return -E_INVAL;
+  806afd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806b02:	e9 b7 00 00 00       	jmp    806bbe <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806b07:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806b0b:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806b0f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806b13:	48 89 ce             	mov    %rcx,%rsi
+  806b16:	48 89 c7             	mov    %rax,%rdi
+  806b19:	49 89 df             	mov    %rbx,%r15
+  806b1c:	48 b8 8a 86 ff ff ff 	movabs $0xffffffffffff868a,%rax
+  806b23:	ff ff ff 
+  806b26:	48 01 d8             	add    %rbx,%rax
+  806b29:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806b2b:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806b32:	00 
+  806b33:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806b37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806b3b:	48 01 d0             	add    %rdx,%rax
+  806b3e:	48 83 e8 01          	sub    $0x1,%rax
+  806b42:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806b46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  806b4f:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806b53:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b57:	48 29 d0             	sub    %rdx,%rax
+  806b5a:	48 c1 e8 03          	shr    $0x3,%rax
+  806b5e:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806b62:	89 c1                	mov    %eax,%ecx
+  806b64:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806b67:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806b6b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806b6e:	49 89 d1             	mov    %rdx,%r9
+  806b71:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806b78:	00 00 00 
+  806b7b:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806b82:	00 00 00 
+  806b85:	89 c7                	mov    %eax,%edi
+  806b87:	49 89 df             	mov    %rbx,%r15
+  806b8a:	48 b8 e8 92 ff ff ff 	movabs $0xffffffffffff92e8,%rax
+  806b91:	ff ff ff 
+  806b94:	48 01 d8             	add    %rbx,%rax
+  806b97:	ff d0                	call   *%rax
+  806b99:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806b9c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806ba0:	74 05                	je     806ba7 <ipc_callw+0xde>
+		return r;
+  806ba2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806ba5:	eb 17                	jmp    806bbe <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806ba7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806bae:	ff ff ff 
+  806bb1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806bb5:	48 8b 00             	mov    (%rax),%rax
+  806bb8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806bbe:	48 83 c4 70          	add    $0x70,%rsp
+  806bc2:	5b                   	pop    %rbx
+  806bc3:	41 5f                	pop    %r15
+  806bc5:	5d                   	pop    %rbp
+  806bc6:	c3                   	ret
+
+0000000000806bc7 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806bc7:	55                   	push   %rbp
+  806bc8:	48 89 e5             	mov    %rsp,%rbp
+  806bcb:	41 57                	push   %r15
+  806bcd:	53                   	push   %rbx
+  806bce:	48 83 ec 40          	sub    $0x40,%rsp
+  806bd2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806bd2 <ipc_callv+0xb>
+  806bd9:	49 bb 66 24 00 00 00 	movabs $0x2466,%r11
+  806be0:	00 00 00 
+  806be3:	4c 01 db             	add    %r11,%rbx
+  806be6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806be9:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806bec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806bf0:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806bf3:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806bf7:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806bfb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806c02:	00 00 00 
+  806c05:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806c09:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806c0d:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806c11:	74 11                	je     806c24 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806c13:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806c17:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806c1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806c1e:	c1 e0 14             	shl    $0x14,%eax
+  806c21:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806c24:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806c28:	74 14                	je     806c3e <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806c2a:	8b 45 20             	mov    0x20(%rbp),%eax
+  806c2d:	83 e8 01             	sub    $0x1,%eax
+  806c30:	48 63 d0             	movslq %eax,%rdx
+  806c33:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806c37:	48 09 d0             	or     %rdx,%rax
+  806c3a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806c3e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806c41:	c1 e0 10             	shl    $0x10,%eax
+  806c44:	0b 45 10             	or     0x10(%rbp),%eax
+  806c47:	89 c1                	mov    %eax,%ecx
+  806c49:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806c4c:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806c50:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806c54:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c58:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806c5b:	4d 89 c1             	mov    %r8,%r9
+  806c5e:	49 89 f8             	mov    %rdi,%r8
+  806c61:	89 c7                	mov    %eax,%edi
+  806c63:	49 89 df             	mov    %rbx,%r15
+  806c66:	48 b8 e8 92 ff ff ff 	movabs $0xffffffffffff92e8,%rax
+  806c6d:	ff ff ff 
+  806c70:	48 01 d8             	add    %rbx,%rax
+  806c73:	ff d0                	call   *%rax
+  806c75:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806c78:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806c7c:	74 05                	je     806c83 <ipc_callv+0xbc>
+		return r;
+  806c7e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806c81:	eb 17                	jmp    806c9a <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806c83:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c8a:	ff ff ff 
+  806c8d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c91:	48 8b 00             	mov    (%rax),%rax
+  806c94:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806c9a:	48 83 c4 40          	add    $0x40,%rsp
+  806c9e:	5b                   	pop    %rbx
+  806c9f:	41 5f                	pop    %r15
+  806ca1:	5d                   	pop    %rbp
+  806ca2:	c3                   	ret
+
+0000000000806ca3 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806ca3:	55                   	push   %rbp
+  806ca4:	48 89 e5             	mov    %rsp,%rbp
+  806ca7:	41 57                	push   %r15
+  806ca9:	53                   	push   %rbx
+  806caa:	48 83 ec 40          	sub    $0x40,%rsp
+  806cae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806cae <ipc_reply_recv+0xb>
+  806cb5:	49 bb 8a 23 00 00 00 	movabs $0x238a,%r11
+  806cbc:	00 00 00 
+  806cbf:	4c 01 db             	add    %r11,%rbx
+  806cc2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806cc5:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806cc8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806ccc:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806ccf:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806cd3:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806cd7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806cdc:	75 0e                	jne    806cec <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806cde:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806ce5:	00 00 00 
+  806ce8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806cec:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806cf1:	75 0e                	jne    806d01 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806cf3:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806cfa:	00 00 00 
+  806cfd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806d01:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806d04:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806d08:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806d0c:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806d0f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806d13:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806d16:	4d 89 c1             	mov    %r8,%r9
+  806d19:	49 89 f8             	mov    %rdi,%r8
+  806d1c:	89 c7                	mov    %eax,%edi
+  806d1e:	49 89 df             	mov    %rbx,%r15
+  806d21:	48 b8 5c 93 ff ff ff 	movabs $0xffffffffffff935c,%rax
+  806d28:	ff ff ff 
+  806d2b:	48 01 d8             	add    %rbx,%rax
+  806d2e:	ff d0                	call   *%rax
+  806d30:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806d33:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806d38:	74 2a                	je     806d64 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806d3a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806d3e:	75 19                	jne    806d59 <ipc_reply_recv+0xb6>
+  806d40:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806d47:	ff ff ff 
+  806d4a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d4e:	48 8b 00             	mov    (%rax),%rax
+  806d51:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806d57:	eb 05                	jmp    806d5e <ipc_reply_recv+0xbb>
+  806d59:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806d62:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806d64:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806d69:	74 2a                	je     806d95 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806d6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806d6f:	75 19                	jne    806d8a <ipc_reply_recv+0xe7>
+  806d71:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806d78:	ff ff ff 
+  806d7b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d7f:	48 8b 00             	mov    (%rax),%rax
+  806d82:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806d88:	eb 05                	jmp    806d8f <ipc_reply_recv+0xec>
+  806d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d8f:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806d93:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806d95:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806d99:	74 05                	je     806da0 <ipc_reply_recv+0xfd>
+		return r;
+  806d9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d9e:	eb 17                	jmp    806db7 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806da0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806da7:	ff ff ff 
+  806daa:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806dae:	48 8b 00             	mov    (%rax),%rax
+  806db1:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806db7:	48 83 c4 40          	add    $0x40,%rsp
+  806dbb:	5b                   	pop    %rbx
+  806dbc:	41 5f                	pop    %r15
+  806dbe:	5d                   	pop    %rbp
+  806dbf:	c3                   	ret
+
+0000000000806dc0 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806dc0:	55                   	push   %rbp
+  806dc1:	48 89 e5             	mov    %rsp,%rbp
+  806dc4:	41 57                	push   %r15
+  806dc6:	53                   	push   %rbx
+  806dc7:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806dce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806dce <ipc_window_batch+0xe>
+  806dd5:	49 bb 6a 22 00 00 00 	movabs $0x226a,%r11
+  806ddc:	00 00 00 
+  806ddf:	4c 01 db             	add    %r11,%rbx
+  806de2:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806de8:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806def:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806df5:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806dfb:	e9 15 01 00 00       	jmp    806f15 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806e00:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806e06:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806e09:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806e10:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806e13:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806e16:	39 c2                	cmp    %eax,%edx
+  806e18:	0f 4e c2             	cmovle %edx,%eax
+  806e1b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806e1e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806e25:	eb 6b                	jmp    806e92 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806e27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e2a:	48 98                	cltq
+  806e2c:	48 c1 e0 05          	shl    $0x5,%rax
+  806e30:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806e34:	48 01 e8             	add    %rbp,%rax
+  806e37:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806e3d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806e43:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e46:	c1 e0 0c             	shl    $0xc,%eax
+  806e49:	48 63 d0             	movslq %eax,%rdx
+  806e4c:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806e53:	48 01 c2             	add    %rax,%rdx
+  806e56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e59:	48 98                	cltq
+  806e5b:	48 c1 e0 05          	shl    $0x5,%rax
+  806e5f:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806e63:	48 01 e8             	add    %rbp,%rax
+  806e66:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806e6c:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806e6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e72:	48 98                	cltq
+  806e74:	48 c1 e0 05          	shl    $0x5,%rax
+  806e78:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806e7c:	48 01 e8             	add    %rbp,%rax
+  806e7f:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806e86:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806e8c:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806e8e:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806e92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806e95:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806e98:	7c 8d                	jl     806e27 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806e9a:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806ea1:	74 27                	je     806eca <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806ea3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806ea6:	48 63 d0             	movslq %eax,%rdx
+  806ea9:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806eb0:	48 89 d6             	mov    %rdx,%rsi
+  806eb3:	48 89 c7             	mov    %rax,%rdi
+  806eb6:	49 89 df             	mov    %rbx,%r15
+  806eb9:	48 b8 ff 95 ff ff ff 	movabs $0xffffffffffff95ff,%rax
+  806ec0:	ff ff ff 
+  806ec3:	48 01 d8             	add    %rbx,%rax
+  806ec6:	ff d0                	call   *%rax
+  806ec8:	eb 25                	jmp    806eef <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806eca:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806ecd:	48 63 d0             	movslq %eax,%rdx
+  806ed0:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806ed7:	48 89 d6             	mov    %rdx,%rsi
+  806eda:	48 89 c7             	mov    %rax,%rdi
+  806edd:	49 89 df             	mov    %rbx,%r15
+  806ee0:	48 b8 5d 96 ff ff ff 	movabs $0xffffffffffff965d,%rax
+  806ee7:	ff ff ff 
+  806eea:	48 01 d8             	add    %rbx,%rax
+  806eed:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806eef:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806ef2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806ef6:	79 05                	jns    806efd <ipc_window_batch+0x13d>
+			return r;
+  806ef8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806efb:	eb 2a                	jmp    806f27 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806efd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806f00:	c1 e0 0c             	shl    $0xc,%eax
+  806f03:	48 98                	cltq
+  806f05:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806f0c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806f0f:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806f15:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806f1c:	0f 8f de fe ff ff    	jg     806e00 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806f22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806f27:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806f2e:	5b                   	pop    %rbx
+  806f2f:	41 5f                	pop    %r15
+  806f31:	5d                   	pop    %rbp
+  806f32:	c3                   	ret
+
+0000000000806f33 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806f33:	55                   	push   %rbp
+  806f34:	48 89 e5             	mov    %rsp,%rbp
+  806f37:	48 83 ec 10          	sub    $0x10,%rsp
+  806f3b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806f3b <ipc_map_window+0x8>
+  806f42:	49 bb fd 20 00 00 00 	movabs $0x20fd,%r11
+  806f49:	00 00 00 
+  806f4c:	4c 01 d8             	add    %r11,%rax
+  806f4f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806f53:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806f56:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806f59:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806f5d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806f62:	bf 01 00 00 00       	mov    $0x1,%edi
+  806f67:	49 b8 88 dd ff ff ff 	movabs $0xffffffffffffdd88,%r8
+  806f6e:	ff ff ff 
+  806f71:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806f75:	ff d0                	call   *%rax
+}
+  806f77:	c9                   	leave
+  806f78:	c3                   	ret
+
+0000000000806f79 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806f79:	55                   	push   %rbp
+  806f7a:	48 89 e5             	mov    %rsp,%rbp
+  806f7d:	48 83 ec 10          	sub    $0x10,%rsp
+  806f81:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806f81 <ipc_unmap_window+0x8>
+  806f88:	49 bb b7 20 00 00 00 	movabs $0x20b7,%r11
+  806f8f:	00 00 00 
+  806f92:	4c 01 d8             	add    %r11,%rax
+  806f95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806f99:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806f9c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806f9f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806fa3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806fa8:	bf 00 00 00 00       	mov    $0x0,%edi
+  806fad:	49 b8 88 dd ff ff ff 	movabs $0xffffffffffffdd88,%r8
+  806fb4:	ff ff ff 
+  806fb7:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806fbb:	ff d0                	call   *%rax
+}
+  806fbd:	c9                   	leave
+  806fbe:	c3                   	ret
+
+0000000000806fbf <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806fbf:	55                   	push   %rbp
+  806fc0:	48 89 e5             	mov    %rsp,%rbp
+  806fc3:	48 83 ec 18          	sub    $0x18,%rsp
+  806fc7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806fc7 <ipc_find_env+0x8>
+  806fce:	49 bb 71 20 00 00 00 	movabs $0x2071,%r11
+  806fd5:	00 00 00 
+  806fd8:	4c 01 d8             	add    %r11,%rax
+  806fdb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806fde:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806fe5:	eb 57                	jmp    80703e <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806fe7:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806fee:	ff ff ff 
+  806ff1:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806ff5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806ff8:	48 63 d2             	movslq %edx,%rdx
+  806ffb:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  807002:	48 01 ca             	add    %rcx,%rdx
+  807005:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  80700c:	8b 12                	mov    (%rdx),%edx
+  80700e:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  807011:	75 27                	jne    80703a <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  807013:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80701a:	ff ff ff 
+  80701d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807021:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  807024:	48 98                	cltq
+  807026:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80702d:	48 01 d0             	add    %rdx,%rax
+  807030:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  807036:	8b 00                	mov    (%rax),%eax
+  807038:	eb 12                	jmp    80704c <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  80703a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80703e:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  807045:	7e a0                	jle    806fe7 <ipc_find_env+0x28>
+	}
+	return 0;
+  807047:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80704c:	c9                   	leave
+  80704d:	c3                   	ret
+
+000000000080704e <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80704e:	55                   	push   %rbp
+  80704f:	48 89 e5             	mov    %rsp,%rbp
+  807052:	48 83 ec 18          	sub    $0x18,%rsp
+  807056:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 807056 <pageref+0x8>
+  80705d:	49 bb e2 1f 00 00 00 	movabs $0x1fe2,%r11
+  807064:	00 00 00 
+  807067:	4c 01 d8             	add    %r11,%rax
+  80706a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80706e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807072:	48 89 d1             	mov    %rdx,%rcx
+  807075:	48 c1 e9 15          	shr    $0x15,%rcx
+  807079:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  807080:	ff ff ff 
+  807083:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  807087:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80708b:	83 e2 01             	and    $0x1,%edx
+  80708e:	48 85 d2             	test   %rdx,%rdx
+  807091:	75 07                	jne    80709a <pageref+0x4c>
+		return 0;
+  807093:	b8 00 00 00 00       	mov    $0x0,%eax
+  807098:	eb 64                	jmp    8070fe <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  80709a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80709e:	48 89 d1             	mov    %rdx,%rcx
+  8070a1:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8070a5:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8070ac:	ff ff ff 
+  8070af:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8070b3:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8070b7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  8070bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8070bf:	83 e2 01             	and    $0x1,%edx
+  8070c2:	48 85 d2             	test   %rdx,%rdx
+  8070c5:	75 07                	jne    8070ce <pageref+0x80>
+		return 0;
+  8070c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8070cc:	eb 30                	jmp    8070fe <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  8070ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8070d2:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8070d6:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  8070dd:	ff ff ff 
+  8070e0:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8070e4:	48 89 d0             	mov    %rdx,%rax
+  8070e7:	48 01 c0             	add    %rax,%rax
+  8070ea:	48 01 d0             	add    %rdx,%rax
+  8070ed:	48 c1 e0 03          	shl    $0x3,%rax
+  8070f1:	48 01 c8             	add    %rcx,%rax
+  8070f4:	48 83 c0 08          	add    $0x8,%rax
+  8070f8:	0f b7 00             	movzwl (%rax),%eax
+  8070fb:	0f b7 c0             	movzwl %ax,%eax
+}
+  8070fe:	c9                   	leave
+  8070ff:	c3                   	ret
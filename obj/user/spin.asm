@@ -0,0 +1,10547 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 96 01 00 00       	call   8001d7 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  800069:	48 b8 38 dc ff ff ff 	movabs $0xffffffffffffdc38,%rax
+  800070:	ff ff ff 
+  800073:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800077:	48 89 c7             	mov    %rax,%rdi
+  80007a:	49 89 df             	mov    %rbx,%r15
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	48 ba 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rdx
+  800089:	ff ff ff 
+  80008c:	48 01 da             	add    %rbx,%rdx
+  80008f:	ff d2                	call   *%rdx
+	if ((env = fork()) == 0) {
+  800091:	49 89 df             	mov    %rbx,%r15
+  800094:	48 b8 2c 9e ff ff ff 	movabs $0xffffffffffff9e2c,%rax
+  80009b:	ff ff ff 
+  80009e:	48 01 d8             	add    %rbx,%rax
+  8000a1:	ff d0                	call   *%rax
+  8000a3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8000a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8000aa:	75 2a                	jne    8000d6 <umain+0x93>
+		cprintf("I am the child.  Spinning...\n");
+  8000ac:	48 b8 60 dc ff ff ff 	movabs $0xffffffffffffdc60,%rax
+  8000b3:	ff ff ff 
+  8000b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000ba:	48 89 c7             	mov    %rax,%rdi
+  8000bd:	49 89 df             	mov    %rbx,%r15
+  8000c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c5:	48 ba 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rdx
+  8000cc:	ff ff ff 
+  8000cf:	48 01 da             	add    %rbx,%rdx
+  8000d2:	ff d2                	call   *%rdx
+		while (1)
+  8000d4:	eb fe                	jmp    8000d4 <umain+0x91>
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  8000d6:	48 b8 80 dc ff ff ff 	movabs $0xffffffffffffdc80,%rax
+  8000dd:	ff ff ff 
+  8000e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000e4:	48 89 c7             	mov    %rax,%rdi
+  8000e7:	49 89 df             	mov    %rbx,%r15
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	48 ba 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rdx
+  8000f6:	ff ff ff 
+  8000f9:	48 01 da             	add    %rbx,%rdx
+  8000fc:	ff d2                	call   *%rdx
+	sys_yield();
+  8000fe:	49 89 df             	mov    %rbx,%r15
+  800101:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  800108:	ff ff ff 
+  80010b:	48 01 d8             	add    %rbx,%rax
+  80010e:	ff d0                	call   *%rax
+	sys_yield();
+  800110:	49 89 df             	mov    %rbx,%r15
+  800113:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  80011a:	ff ff ff 
+  80011d:	48 01 d8             	add    %rbx,%rax
+  800120:	ff d0                	call   *%rax
+	sys_yield();
+  800122:	49 89 df             	mov    %rbx,%r15
+  800125:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  80012c:	ff ff ff 
+  80012f:	48 01 d8             	add    %rbx,%rax
+  800132:	ff d0                	call   *%rax
+	sys_yield();
+  800134:	49 89 df             	mov    %rbx,%r15
+  800137:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  80013e:	ff ff ff 
+  800141:	48 01 d8             	add    %rbx,%rax
+  800144:	ff d0                	call   *%rax
+	sys_yield();
+  800146:	49 89 df             	mov    %rbx,%r15
+  800149:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  800150:	ff ff ff 
+  800153:	48 01 d8             	add    %rbx,%rax
+  800156:	ff d0                	call   *%rax
+	sys_yield();
+  800158:	49 89 df             	mov    %rbx,%r15
+  80015b:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  800162:	ff ff ff 
+  800165:	48 01 d8             	add    %rbx,%rax
+  800168:	ff d0                	call   *%rax
+	sys_yield();
+  80016a:	49 89 df             	mov    %rbx,%r15
+  80016d:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  800174:	ff ff ff 
+  800177:	48 01 d8             	add    %rbx,%rax
+  80017a:	ff d0                	call   *%rax
+	sys_yield();
+  80017c:	49 89 df             	mov    %rbx,%r15
+  80017f:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  800186:	ff ff ff 
+  800189:	48 01 d8             	add    %rbx,%rax
+  80018c:	ff d0                	call   *%rax
+
+	cprintf("I am the parent.  Killing the child...\n");
+  80018e:	48 b8 a8 dc ff ff ff 	movabs $0xffffffffffffdca8,%rax
+  800195:	ff ff ff 
+  800198:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80019c:	48 89 c7             	mov    %rax,%rdi
+  80019f:	49 89 df             	mov    %rbx,%r15
+  8001a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a7:	48 ba 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rdx
+  8001ae:	ff ff ff 
+  8001b1:	48 01 da             	add    %rbx,%rdx
+  8001b4:	ff d2                	call   *%rdx
+	sys_env_destroy(env);
+  8001b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001b9:	89 c7                	mov    %eax,%edi
+  8001bb:	49 89 df             	mov    %rbx,%r15
+  8001be:	48 b8 98 8d ff ff ff 	movabs $0xffffffffffff8d98,%rax
+  8001c5:	ff ff ff 
+  8001c8:	48 01 d8             	add    %rbx,%rax
+  8001cb:	ff d0                	call   *%rax
+}
+  8001cd:	90                   	nop
+  8001ce:	48 83 c4 20          	add    $0x20,%rsp
+  8001d2:	5b                   	pop    %rbx
+  8001d3:	41 5f                	pop    %r15
+  8001d5:	5d                   	pop    %rbp
+  8001d6:	c3                   	ret
+
+00000000008001d7 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001d7:	55                   	push   %rbp
+  8001d8:	48 89 e5             	mov    %rsp,%rbp
+  8001db:	41 57                	push   %r15
+  8001dd:	53                   	push   %rbx
+  8001de:	48 83 ec 20          	sub    $0x20,%rsp
+  8001e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8001e2 <libmain+0xb>
+  8001e9:	49 bb 5e 8e 00 00 00 	movabs $0x8e5e,%r11
+  8001f0:	00 00 00 
+  8001f3:	4c 01 db             	add    %r11,%rbx
+  8001f6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8001f9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8001fd:	49 89 df             	mov    %rbx,%r15
+  800200:	48 b8 f4 8d ff ff ff 	movabs $0xffffffffffff8df4,%rax
+  800207:	ff ff ff 
+  80020a:	48 01 d8             	add    %rbx,%rax
+  80020d:	ff d0                	call   *%rax
+  80020f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800212:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800215:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80021a:	48 98                	cltq
+  80021c:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800223:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80022a:	ff ff ff 
+  80022d:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800231:	48 01 c2             	add    %rax,%rdx
+  800234:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  80023b:	00 00 00 
+  80023e:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800242:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800246:	7e 15                	jle    80025d <libmain+0x86>
+		binaryname = argv[0];
+  800248:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80024c:	48 8b 00             	mov    (%rax),%rax
+  80024f:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  800256:	00 00 00 
+  800259:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  80025d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800261:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800264:	48 89 d6             	mov    %rdx,%rsi
+  800267:	89 c7                	mov    %eax,%edi
+  800269:	49 89 df             	mov    %rbx,%r15
+  80026c:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800273:	ff ff ff 
+  800276:	48 01 d8             	add    %rbx,%rax
+  800279:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  80027b:	49 89 df             	mov    %rbx,%r15
+  80027e:	48 b8 57 72 ff ff ff 	movabs $0xffffffffffff7257,%rax
+  800285:	ff ff ff 
+  800288:	48 01 d8             	add    %rbx,%rax
+  80028b:	ff d0                	call   *%rax
+}
+  80028d:	90                   	nop
+  80028e:	48 83 c4 20          	add    $0x20,%rsp
+  800292:	5b                   	pop    %rbx
+  800293:	41 5f                	pop    %r15
+  800295:	5d                   	pop    %rbp
+  800296:	c3                   	ret
+
+0000000000800297 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800297:	55                   	push   %rbp
+  800298:	48 89 e5             	mov    %rsp,%rbp
+  80029b:	41 57                	push   %r15
+  80029d:	53                   	push   %rbx
+  80029e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80029e <exit+0x7>
+  8002a5:	49 bb a2 8d 00 00 00 	movabs $0x8da2,%r11
+  8002ac:	00 00 00 
+  8002af:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8002b2:	49 89 df             	mov    %rbx,%r15
+  8002b5:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  8002bc:	ff ff ff 
+  8002bf:	48 01 d8             	add    %rbx,%rax
+  8002c2:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8002c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002c9:	49 89 df             	mov    %rbx,%r15
+  8002cc:	48 b8 98 8d ff ff ff 	movabs $0xffffffffffff8d98,%rax
+  8002d3:	ff ff ff 
+  8002d6:	48 01 d8             	add    %rbx,%rax
+  8002d9:	ff d0                	call   *%rax
+}
+  8002db:	90                   	nop
+  8002dc:	5b                   	pop    %rbx
+  8002dd:	41 5f                	pop    %r15
+  8002df:	5d                   	pop    %rbp
+  8002e0:	c3                   	ret
+
+00000000008002e1 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8002e1:	55                   	push   %rbp
+  8002e2:	48 89 e5             	mov    %rsp,%rbp
+  8002e5:	41 57                	push   %r15
+  8002e7:	48 83 ec 18          	sub    $0x18,%rsp
+  8002eb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8002eb <putch+0xa>
+  8002f2:	49 bb 55 8d 00 00 00 	movabs $0x8d55,%r11
+  8002f9:	00 00 00 
+  8002fc:	4c 01 d8             	add    %r11,%rax
+  8002ff:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800302:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800306:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80030a:	8b 12                	mov    (%rdx),%edx
+  80030c:	8d 72 01             	lea    0x1(%rdx),%esi
+  80030f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800313:	89 31                	mov    %esi,(%rcx)
+  800315:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800318:	89 ce                	mov    %ecx,%esi
+  80031a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80031e:	48 63 d2             	movslq %edx,%rdx
+  800321:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800326:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80032a:	8b 12                	mov    (%rdx),%edx
+  80032c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800332:	75 33                	jne    800367 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800334:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800338:	8b 12                	mov    (%rdx),%edx
+  80033a:	48 63 d2             	movslq %edx,%rdx
+  80033d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800341:	48 83 c1 08          	add    $0x8,%rcx
+  800345:	48 89 d6             	mov    %rdx,%rsi
+  800348:	48 89 cf             	mov    %rcx,%rdi
+  80034b:	49 89 c7             	mov    %rax,%r15
+  80034e:	48 ba e5 8c ff ff ff 	movabs $0xffffffffffff8ce5,%rdx
+  800355:	ff ff ff 
+  800358:	48 01 c2             	add    %rax,%rdx
+  80035b:	ff d2                	call   *%rdx
+        b->idx = 0;
+  80035d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800361:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800367:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80036b:	8b 40 04             	mov    0x4(%rax),%eax
+  80036e:	8d 50 01             	lea    0x1(%rax),%edx
+  800371:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800375:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800378:	90                   	nop
+  800379:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80037d:	c9                   	leave
+  80037e:	c3                   	ret
+
+000000000080037f <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80037f:	55                   	push   %rbp
+  800380:	48 89 e5             	mov    %rsp,%rbp
+  800383:	41 57                	push   %r15
+  800385:	53                   	push   %rbx
+  800386:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80038d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80038d <vcprintf+0xe>
+  800394:	49 bb b3 8c 00 00 00 	movabs $0x8cb3,%r11
+  80039b:	00 00 00 
+  80039e:	4c 01 db             	add    %r11,%rbx
+  8003a1:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8003a8:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8003af:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8003b6:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8003bd:	48 8b 06             	mov    (%rsi),%rax
+  8003c0:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8003c4:	48 89 01             	mov    %rax,(%rcx)
+  8003c7:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8003cb:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8003cf:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8003d3:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8003da:	00 00 00 
+    b.cnt = 0;
+  8003dd:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8003e4:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8003e7:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8003ee:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8003f5:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8003fc:	48 89 c6             	mov    %rax,%rsi
+  8003ff:	48 b8 a1 72 ff ff ff 	movabs $0xffffffffffff72a1,%rax
+  800406:	ff ff ff 
+  800409:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80040d:	48 89 c7             	mov    %rax,%rdi
+  800410:	49 89 df             	mov    %rbx,%r15
+  800413:	48 b8 63 78 ff ff ff 	movabs $0xffffffffffff7863,%rax
+  80041a:	ff ff ff 
+  80041d:	48 01 d8             	add    %rbx,%rax
+  800420:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800422:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800428:	48 98                	cltq
+  80042a:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800431:	48 83 c2 08          	add    $0x8,%rdx
+  800435:	48 89 c6             	mov    %rax,%rsi
+  800438:	48 89 d7             	mov    %rdx,%rdi
+  80043b:	49 89 df             	mov    %rbx,%r15
+  80043e:	48 b8 e5 8c ff ff ff 	movabs $0xffffffffffff8ce5,%rax
+  800445:	ff ff ff 
+  800448:	48 01 d8             	add    %rbx,%rax
+  80044b:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  80044d:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800453:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80045a:	5b                   	pop    %rbx
+  80045b:	41 5f                	pop    %r15
+  80045d:	5d                   	pop    %rbp
+  80045e:	c3                   	ret
+
+000000000080045f <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  80045f:	55                   	push   %rbp
+  800460:	48 89 e5             	mov    %rsp,%rbp
+  800463:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80046a:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80046a <cprintf+0xb>
+  800471:	49 bb d6 8b 00 00 00 	movabs $0x8bd6,%r11
+  800478:	00 00 00 
+  80047b:	4d 01 da             	add    %r11,%r10
+  80047e:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800485:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80048c:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800493:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80049a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8004a1:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8004a8:	84 c0                	test   %al,%al
+  8004aa:	74 20                	je     8004cc <cprintf+0x6d>
+  8004ac:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8004b0:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8004b4:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8004b8:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8004bc:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8004c0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8004c4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8004c8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8004cc:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8004d3:	00 00 00 
+  8004d6:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8004dd:	00 00 00 
+  8004e0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004e4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8004eb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8004f2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8004f9:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800500:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800507:	48 8b 06             	mov    (%rsi),%rax
+  80050a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80050e:	48 89 01             	mov    %rax,(%rcx)
+  800511:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800515:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800519:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80051d:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800524:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80052b:	48 89 d6             	mov    %rdx,%rsi
+  80052e:	48 89 c7             	mov    %rax,%rdi
+  800531:	48 b8 3f 73 ff ff ff 	movabs $0xffffffffffff733f,%rax
+  800538:	ff ff ff 
+  80053b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80053f:	ff d0                	call   *%rax
+  800541:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800547:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80054d:	c9                   	leave
+  80054e:	c3                   	ret
+
+000000000080054f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80054f:	55                   	push   %rbp
+  800550:	48 89 e5             	mov    %rsp,%rbp
+  800553:	53                   	push   %rbx
+  800554:	48 83 ec 38          	sub    $0x38,%rsp
+  800558:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800558 <printnum+0x9>
+  80055f:	49 bb e8 8a 00 00 00 	movabs $0x8ae8,%r11
+  800566:	00 00 00 
+  800569:	4c 01 db             	add    %r11,%rbx
+  80056c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800570:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800574:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800578:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80057b:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  80057f:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800583:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800586:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80058a:	72 58                	jb     8005e4 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80058c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80058f:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800592:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800595:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800599:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059e:	48 f7 f6             	div    %rsi
+  8005a1:	49 89 c2             	mov    %rax,%r10
+  8005a4:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8005a7:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8005aa:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8005ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8005b2:	41 89 c9             	mov    %ecx,%r9d
+  8005b5:	41 89 f8             	mov    %edi,%r8d
+  8005b8:	89 d1                	mov    %edx,%ecx
+  8005ba:	4c 89 d2             	mov    %r10,%rdx
+  8005bd:	48 89 c7             	mov    %rax,%rdi
+  8005c0:	48 b8 0f 75 ff ff ff 	movabs $0xffffffffffff750f,%rax
+  8005c7:	ff ff ff 
+  8005ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005ce:	ff d0                	call   *%rax
+  8005d0:	eb 1c                	jmp    8005ee <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8005d2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005d6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8005d9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8005dd:	48 89 d6             	mov    %rdx,%rsi
+  8005e0:	89 c7                	mov    %eax,%edi
+  8005e2:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8005e4:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8005e8:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8005ec:	7f e4                	jg     8005d2 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8005ee:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8005f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8005f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005fa:	48 f7 f1             	div    %rcx
+  8005fd:	48 b8 17 de ff ff ff 	movabs $0xffffffffffffde17,%rax
+  800604:	ff ff ff 
+  800607:	48 01 d8             	add    %rbx,%rax
+  80060a:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80060e:	0f be c0             	movsbl %al,%eax
+  800611:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800615:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800619:	48 89 d6             	mov    %rdx,%rsi
+  80061c:	89 c7                	mov    %eax,%edi
+  80061e:	ff d1                	call   *%rcx
+}
+  800620:	90                   	nop
+  800621:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800625:	c9                   	leave
+  800626:	c3                   	ret
+
+0000000000800627 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800627:	55                   	push   %rbp
+  800628:	48 89 e5             	mov    %rsp,%rbp
+  80062b:	48 83 ec 20          	sub    $0x20,%rsp
+  80062f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80062f <getuint+0x8>
+  800636:	49 bb 11 8a 00 00 00 	movabs $0x8a11,%r11
+  80063d:	00 00 00 
+  800640:	4c 01 d8             	add    %r11,%rax
+  800643:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800647:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80064a:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80064e:	7e 4f                	jle    80069f <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800650:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800654:	8b 00                	mov    (%rax),%eax
+  800656:	83 f8 2f             	cmp    $0x2f,%eax
+  800659:	77 24                	ja     80067f <getuint+0x58>
+  80065b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80065f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800663:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800667:	8b 00                	mov    (%rax),%eax
+  800669:	89 c0                	mov    %eax,%eax
+  80066b:	48 01 d0             	add    %rdx,%rax
+  80066e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800672:	8b 12                	mov    (%rdx),%edx
+  800674:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800677:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80067b:	89 0a                	mov    %ecx,(%rdx)
+  80067d:	eb 14                	jmp    800693 <getuint+0x6c>
+  80067f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800683:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800687:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80068b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80068f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800693:	48 8b 00             	mov    (%rax),%rax
+  800696:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80069a:	e9 9d 00 00 00       	jmp    80073c <getuint+0x115>
+	else if (lflag)
+  80069f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8006a3:	74 4c                	je     8006f1 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8006a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006a9:	8b 00                	mov    (%rax),%eax
+  8006ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ae:	77 24                	ja     8006d4 <getuint+0xad>
+  8006b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006b4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8006b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006bc:	8b 00                	mov    (%rax),%eax
+  8006be:	89 c0                	mov    %eax,%eax
+  8006c0:	48 01 d0             	add    %rdx,%rax
+  8006c3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006c7:	8b 12                	mov    (%rdx),%edx
+  8006c9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8006cc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006d0:	89 0a                	mov    %ecx,(%rdx)
+  8006d2:	eb 14                	jmp    8006e8 <getuint+0xc1>
+  8006d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006d8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8006dc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8006e0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8006e4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8006e8:	48 8b 00             	mov    (%rax),%rax
+  8006eb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8006ef:	eb 4b                	jmp    80073c <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8006f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006f5:	8b 00                	mov    (%rax),%eax
+  8006f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006fa:	77 24                	ja     800720 <getuint+0xf9>
+  8006fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800700:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800704:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800708:	8b 00                	mov    (%rax),%eax
+  80070a:	89 c0                	mov    %eax,%eax
+  80070c:	48 01 d0             	add    %rdx,%rax
+  80070f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800713:	8b 12                	mov    (%rdx),%edx
+  800715:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800718:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80071c:	89 0a                	mov    %ecx,(%rdx)
+  80071e:	eb 14                	jmp    800734 <getuint+0x10d>
+  800720:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800724:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800728:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80072c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800730:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800734:	8b 00                	mov    (%rax),%eax
+  800736:	89 c0                	mov    %eax,%eax
+  800738:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80073c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800740:	c9                   	leave
+  800741:	c3                   	ret
+
+0000000000800742 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800742:	55                   	push   %rbp
+  800743:	48 89 e5             	mov    %rsp,%rbp
+  800746:	48 83 ec 20          	sub    $0x20,%rsp
+  80074a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80074a <printfloat+0x8>
+  800751:	49 bb f6 88 00 00 00 	movabs $0x88f6,%r11
+  800758:	00 00 00 
+  80075b:	4c 01 d8             	add    %r11,%rax
+  80075e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800762:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800766:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  80076a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80076e:	48 85 c0             	test   %rax,%rax
+  800771:	79 12                	jns    800785 <printfloat+0x43>
+		putch('-',putdat);
+  800773:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800777:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80077b:	48 89 c6             	mov    %rax,%rsi
+  80077e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800783:	ff d2                	call   *%rdx
+	
+}
+  800785:	90                   	nop
+  800786:	c9                   	leave
+  800787:	c3                   	ret
+
+0000000000800788 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800788:	55                   	push   %rbp
+  800789:	48 89 e5             	mov    %rsp,%rbp
+  80078c:	48 83 ec 20          	sub    $0x20,%rsp
+  800790:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800790 <getint+0x8>
+  800797:	49 bb b0 88 00 00 00 	movabs $0x88b0,%r11
+  80079e:	00 00 00 
+  8007a1:	4c 01 d8             	add    %r11,%rax
+  8007a4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8007a8:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  8007ab:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8007af:	7e 4f                	jle    800800 <getint+0x78>
+		x=va_arg(*ap, long long);
+  8007b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007b5:	8b 00                	mov    (%rax),%eax
+  8007b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ba:	77 24                	ja     8007e0 <getint+0x58>
+  8007bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c8:	8b 00                	mov    (%rax),%eax
+  8007ca:	89 c0                	mov    %eax,%eax
+  8007cc:	48 01 d0             	add    %rdx,%rax
+  8007cf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007d3:	8b 12                	mov    (%rdx),%edx
+  8007d5:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007d8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007dc:	89 0a                	mov    %ecx,(%rdx)
+  8007de:	eb 14                	jmp    8007f4 <getint+0x6c>
+  8007e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007e4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007e8:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007ec:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007f0:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007f4:	48 8b 00             	mov    (%rax),%rax
+  8007f7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007fb:	e9 9d 00 00 00       	jmp    80089d <getint+0x115>
+	else if (lflag)
+  800800:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800804:	74 4c                	je     800852 <getint+0xca>
+		x=va_arg(*ap, long);
+  800806:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80080a:	8b 00                	mov    (%rax),%eax
+  80080c:	83 f8 2f             	cmp    $0x2f,%eax
+  80080f:	77 24                	ja     800835 <getint+0xad>
+  800811:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800815:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800819:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80081d:	8b 00                	mov    (%rax),%eax
+  80081f:	89 c0                	mov    %eax,%eax
+  800821:	48 01 d0             	add    %rdx,%rax
+  800824:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800828:	8b 12                	mov    (%rdx),%edx
+  80082a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80082d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800831:	89 0a                	mov    %ecx,(%rdx)
+  800833:	eb 14                	jmp    800849 <getint+0xc1>
+  800835:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800839:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80083d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800841:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800845:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800849:	48 8b 00             	mov    (%rax),%rax
+  80084c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800850:	eb 4b                	jmp    80089d <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800852:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800856:	8b 00                	mov    (%rax),%eax
+  800858:	83 f8 2f             	cmp    $0x2f,%eax
+  80085b:	77 24                	ja     800881 <getint+0xf9>
+  80085d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800861:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800865:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800869:	8b 00                	mov    (%rax),%eax
+  80086b:	89 c0                	mov    %eax,%eax
+  80086d:	48 01 d0             	add    %rdx,%rax
+  800870:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800874:	8b 12                	mov    (%rdx),%edx
+  800876:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800879:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80087d:	89 0a                	mov    %ecx,(%rdx)
+  80087f:	eb 14                	jmp    800895 <getint+0x10d>
+  800881:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800885:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800889:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80088d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800891:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800895:	8b 00                	mov    (%rax),%eax
+  800897:	48 98                	cltq
+  800899:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  80089d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8008a1:	c9                   	leave
+  8008a2:	c3                   	ret
+
+00000000008008a3 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  8008a3:	55                   	push   %rbp
+  8008a4:	48 89 e5             	mov    %rsp,%rbp
+  8008a7:	41 57                	push   %r15
+  8008a9:	41 55                	push   %r13
+  8008ab:	41 54                	push   %r12
+  8008ad:	53                   	push   %rbx
+  8008ae:	48 83 ec 60          	sub    $0x60,%rsp
+  8008b2:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 8008b2 <vprintfmt+0xf>
+  8008b9:	49 bb 8e 87 00 00 00 	movabs $0x878e,%r11
+  8008c0:	00 00 00 
+  8008c3:	4d 01 dc             	add    %r11,%r12
+  8008c6:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  8008ca:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  8008ce:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8008d2:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  8008d6:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  8008dd:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  8008e1:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  8008e5:	48 8b 06             	mov    (%rsi),%rax
+  8008e8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8008ec:	48 89 01             	mov    %rax,(%rcx)
+  8008ef:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8008f3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8008f7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8008fb:	eb 17                	jmp    800914 <vprintfmt+0x71>
+			if (ch == '\0')
+  8008fd:	85 db                	test   %ebx,%ebx
+  8008ff:	0f 84 97 05 00 00    	je     800e9c <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800905:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800909:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80090d:	48 89 c6             	mov    %rax,%rsi
+  800910:	89 df                	mov    %ebx,%edi
+  800912:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800914:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800918:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80091c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800920:	0f b6 00             	movzbl (%rax),%eax
+  800923:	0f b6 d8             	movzbl %al,%ebx
+  800926:	83 fb 25             	cmp    $0x25,%ebx
+  800929:	75 d2                	jne    8008fd <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  80092b:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  80092f:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800936:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  80093d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800944:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  80094b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80094f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800953:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800957:	0f b6 00             	movzbl (%rax),%eax
+  80095a:	0f b6 d8             	movzbl %al,%ebx
+  80095d:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800960:	83 f8 55             	cmp    $0x55,%eax
+  800963:	0f 87 00 05 00 00    	ja     800e69 <vprintfmt+0x5c6>
+  800969:	89 c0                	mov    %eax,%eax
+  80096b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800972:	00 
+  800973:	48 8d 05 06 65 00 00 	lea    0x6506(%rip),%rax        # 806e80 <.LC18+0xc>
+  80097a:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  80097e:	48 8d 15 fb 64 00 00 	lea    0x64fb(%rip),%rdx        # 806e80 <.LC18+0xc>
+  800985:	48 01 d0             	add    %rdx,%rax
+  800988:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  80098a:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  80098e:	eb bb                	jmp    80094b <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800990:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800994:	eb b5                	jmp    80094b <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800996:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  80099d:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8009a0:	89 d0                	mov    %edx,%eax
+  8009a2:	c1 e0 02             	shl    $0x2,%eax
+  8009a5:	01 d0                	add    %edx,%eax
+  8009a7:	01 c0                	add    %eax,%eax
+  8009a9:	01 d8                	add    %ebx,%eax
+  8009ab:	83 e8 30             	sub    $0x30,%eax
+  8009ae:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  8009b1:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8009b5:	0f b6 00             	movzbl (%rax),%eax
+  8009b8:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  8009bb:	83 fb 2f             	cmp    $0x2f,%ebx
+  8009be:	7e 60                	jle    800a20 <vprintfmt+0x17d>
+  8009c0:	83 fb 39             	cmp    $0x39,%ebx
+  8009c3:	7f 5b                	jg     800a20 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  8009c5:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  8009ca:	eb d1                	jmp    80099d <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8009cc:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8009cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d2:	77 17                	ja     8009eb <vprintfmt+0x148>
+  8009d4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8009d8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8009db:	89 d2                	mov    %edx,%edx
+  8009dd:	48 01 d0             	add    %rdx,%rax
+  8009e0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8009e3:	83 c2 08             	add    $0x8,%edx
+  8009e6:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8009e9:	eb 0c                	jmp    8009f7 <vprintfmt+0x154>
+  8009eb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8009ef:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8009f3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8009f7:	8b 00                	mov    (%rax),%eax
+  8009f9:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  8009fc:	eb 23                	jmp    800a21 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  8009fe:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a02:	0f 89 43 ff ff ff    	jns    80094b <vprintfmt+0xa8>
+				width = 0;
+  800a08:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800a0f:	e9 37 ff ff ff       	jmp    80094b <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800a14:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800a1b:	e9 2b ff ff ff       	jmp    80094b <vprintfmt+0xa8>
+			goto process_precision;
+  800a20:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800a21:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800a25:	0f 89 20 ff ff ff    	jns    80094b <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800a2b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800a2e:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800a31:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800a38:	e9 0e ff ff ff       	jmp    80094b <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800a3d:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800a41:	e9 05 ff ff ff       	jmp    80094b <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800a46:	83 fb 39             	cmp    $0x39,%ebx
+  800a49:	7f 0b                	jg     800a56 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800a4b:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800a4e:	c1 e0 08             	shl    $0x8,%eax
+  800a51:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800a54:	eb 21                	jmp    800a77 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800a56:	83 fb 60             	cmp    $0x60,%ebx
+  800a59:	7e 10                	jle    800a6b <vprintfmt+0x1c8>
+  800a5b:	83 fb 66             	cmp    $0x66,%ebx
+  800a5e:	7f 0b                	jg     800a6b <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800a60:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800a63:	c1 e0 08             	shl    $0x8,%eax
+  800a66:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800a69:	eb 0c                	jmp    800a77 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800a6b:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800a72:	e9 04 01 00 00       	jmp    800b7b <vprintfmt+0x2d8>
+  800a77:	e9 ff 00 00 00       	jmp    800b7b <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800a7c:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800a7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a82:	77 17                	ja     800a9b <vprintfmt+0x1f8>
+  800a84:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800a88:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a8b:	89 d2                	mov    %edx,%edx
+  800a8d:	48 01 d0             	add    %rdx,%rax
+  800a90:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800a93:	83 c2 08             	add    $0x8,%edx
+  800a96:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800a99:	eb 0c                	jmp    800aa7 <vprintfmt+0x204>
+  800a9b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800a9f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800aa3:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800aa7:	8b 00                	mov    (%rax),%eax
+  800aa9:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800aad:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800ab1:	48 89 d6             	mov    %rdx,%rsi
+  800ab4:	89 c7                	mov    %eax,%edi
+  800ab6:	ff d1                	call   *%rcx
+			break;
+  800ab8:	e9 da 03 00 00       	jmp    800e97 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800abd:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ac0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac3:	77 17                	ja     800adc <vprintfmt+0x239>
+  800ac5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ac9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800acc:	89 d2                	mov    %edx,%edx
+  800ace:	48 01 d0             	add    %rdx,%rax
+  800ad1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ad4:	83 c2 08             	add    $0x8,%edx
+  800ad7:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ada:	eb 0c                	jmp    800ae8 <vprintfmt+0x245>
+  800adc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ae0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ae4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ae8:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800aea:	85 db                	test   %ebx,%ebx
+  800aec:	79 02                	jns    800af0 <vprintfmt+0x24d>
+				err = -err;
+  800aee:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800af0:	83 fb 15             	cmp    $0x15,%ebx
+  800af3:	7f 19                	jg     800b0e <vprintfmt+0x26b>
+  800af5:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800afc:	00 00 00 
+  800aff:	48 63 c3             	movslq %ebx,%rax
+  800b02:	4c 01 e2             	add    %r12,%rdx
+  800b05:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800b09:	4d 85 ed             	test   %r13,%r13
+  800b0c:	75 36                	jne    800b44 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800b0e:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b12:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b16:	89 d9                	mov    %ebx,%ecx
+  800b18:	48 ba 28 de ff ff ff 	movabs $0xffffffffffffde28,%rdx
+  800b1f:	ff ff ff 
+  800b22:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800b26:	48 89 c7             	mov    %rax,%rdi
+  800b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2e:	49 b8 6a 7e ff ff ff 	movabs $0xffffffffffff7e6a,%r8
+  800b35:	ff ff ff 
+  800b38:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800b3c:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800b3f:	e9 53 03 00 00       	jmp    800e97 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800b44:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b48:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b4c:	4c 89 e9             	mov    %r13,%rcx
+  800b4f:	48 ba 31 de ff ff ff 	movabs $0xffffffffffffde31,%rdx
+  800b56:	ff ff ff 
+  800b59:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800b5d:	48 89 c7             	mov    %rax,%rdi
+  800b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b65:	49 b8 6a 7e ff ff ff 	movabs $0xffffffffffff7e6a,%r8
+  800b6c:	ff ff ff 
+  800b6f:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800b73:	41 ff d0             	call   *%r8
+			break;
+  800b76:	e9 1c 03 00 00       	jmp    800e97 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800b7b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b81:	77 17                	ja     800b9a <vprintfmt+0x2f7>
+  800b83:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b87:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b8a:	89 d2                	mov    %edx,%edx
+  800b8c:	48 01 d0             	add    %rdx,%rax
+  800b8f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b92:	83 c2 08             	add    $0x8,%edx
+  800b95:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b98:	eb 0c                	jmp    800ba6 <vprintfmt+0x303>
+  800b9a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b9e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ba2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ba6:	4c 8b 28             	mov    (%rax),%r13
+  800ba9:	4d 85 ed             	test   %r13,%r13
+  800bac:	75 0e                	jne    800bbc <vprintfmt+0x319>
+				p = "(null)";
+  800bae:	48 b8 34 de ff ff ff 	movabs $0xffffffffffffde34,%rax
+  800bb5:	ff ff ff 
+  800bb8:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800bbc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800bc0:	0f 8e 84 00 00 00    	jle    800c4a <vprintfmt+0x3a7>
+  800bc6:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800bca:	74 7e                	je     800c4a <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800bcc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800bcf:	48 98                	cltq
+  800bd1:	48 89 c6             	mov    %rax,%rsi
+  800bd4:	4c 89 ef             	mov    %r13,%rdi
+  800bd7:	4d 89 e7             	mov    %r12,%r15
+  800bda:	48 b8 8f 81 ff ff ff 	movabs $0xffffffffffff818f,%rax
+  800be1:	ff ff ff 
+  800be4:	4c 01 e0             	add    %r12,%rax
+  800be7:	ff d0                	call   *%rax
+  800be9:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800bec:	eb 17                	jmp    800c05 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800bee:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800bf2:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800bf6:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800bfa:	48 89 d6             	mov    %rdx,%rsi
+  800bfd:	89 c7                	mov    %eax,%edi
+  800bff:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800c01:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800c05:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c09:	7f e3                	jg     800bee <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c0b:	eb 3d                	jmp    800c4a <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800c0d:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800c11:	74 1e                	je     800c31 <vprintfmt+0x38e>
+  800c13:	83 fb 1f             	cmp    $0x1f,%ebx
+  800c16:	7e 05                	jle    800c1d <vprintfmt+0x37a>
+  800c18:	83 fb 7e             	cmp    $0x7e,%ebx
+  800c1b:	7e 14                	jle    800c31 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800c1d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c21:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c25:	48 89 c6             	mov    %rax,%rsi
+  800c28:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c2d:	ff d2                	call   *%rdx
+  800c2f:	eb 15                	jmp    800c46 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800c31:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800c34:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800c37:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c3b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c3f:	48 89 c6             	mov    %rax,%rsi
+  800c42:	89 cf                	mov    %ecx,%edi
+  800c44:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c46:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800c4a:	4c 89 e8             	mov    %r13,%rax
+  800c4d:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800c51:	0f b6 00             	movzbl (%rax),%eax
+  800c54:	0f be d8             	movsbl %al,%ebx
+  800c57:	85 db                	test   %ebx,%ebx
+  800c59:	74 28                	je     800c83 <vprintfmt+0x3e0>
+  800c5b:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800c5f:	78 ac                	js     800c0d <vprintfmt+0x36a>
+  800c61:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800c65:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800c69:	79 a2                	jns    800c0d <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800c6b:	eb 16                	jmp    800c83 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800c6d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c71:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c75:	48 89 c6             	mov    %rax,%rsi
+  800c78:	bf 20 00 00 00       	mov    $0x20,%edi
+  800c7d:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800c7f:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800c83:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800c87:	7f e4                	jg     800c6d <vprintfmt+0x3ca>
+			break;
+  800c89:	e9 09 02 00 00       	jmp    800e97 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800c8e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c92:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c96:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c9a:	0f b6 00             	movzbl (%rax),%eax
+  800c9d:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800ca0:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800ca1:	83 fb 2f             	cmp    $0x2f,%ebx
+  800ca4:	0f 8e ac fd ff ff    	jle    800a56 <vprintfmt+0x1b3>
+  800caa:	e9 97 fd ff ff       	jmp    800a46 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800caf:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800cb3:	be 03 00 00 00       	mov    $0x3,%esi
+  800cb8:	48 89 c7             	mov    %rax,%rdi
+  800cbb:	48 b8 48 77 ff ff ff 	movabs $0xffffffffffff7748,%rax
+  800cc2:	ff ff ff 
+  800cc5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800cc9:	ff d0                	call   *%rax
+  800ccb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800ccf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cd3:	48 85 c0             	test   %rax,%rax
+  800cd6:	79 1d                	jns    800cf5 <vprintfmt+0x452>
+				putch('-', putdat);
+  800cd8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cdc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ce0:	48 89 c6             	mov    %rax,%rsi
+  800ce3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ce8:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800cea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800cee:	48 f7 d8             	neg    %rax
+  800cf1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800cf5:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800cfc:	e9 de 00 00 00       	jmp    800ddf <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800d01:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d05:	be 03 00 00 00       	mov    $0x3,%esi
+  800d0a:	48 89 c7             	mov    %rax,%rdi
+  800d0d:	48 b8 e7 75 ff ff ff 	movabs $0xffffffffffff75e7,%rax
+  800d14:	ff ff ff 
+  800d17:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d1b:	ff d0                	call   *%rax
+  800d1d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800d21:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800d28:	e9 b2 00 00 00       	jmp    800ddf <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800d2d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800d31:	be 03 00 00 00       	mov    $0x3,%esi
+  800d36:	48 89 c7             	mov    %rax,%rdi
+  800d39:	48 b8 e7 75 ff ff ff 	movabs $0xffffffffffff75e7,%rax
+  800d40:	ff ff ff 
+  800d43:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800d47:	ff d0                	call   *%rax
+  800d49:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800d4d:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800d54:	e9 86 00 00 00       	jmp    800ddf <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800d59:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d5d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d61:	48 89 c6             	mov    %rax,%rsi
+  800d64:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d69:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800d6b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d6f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d73:	48 89 c6             	mov    %rax,%rsi
+  800d76:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d7b:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800d7d:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d80:	83 f8 2f             	cmp    $0x2f,%eax
+  800d83:	77 17                	ja     800d9c <vprintfmt+0x4f9>
+  800d85:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d89:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d8c:	89 d2                	mov    %edx,%edx
+  800d8e:	48 01 d0             	add    %rdx,%rax
+  800d91:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d94:	83 c2 08             	add    $0x8,%edx
+  800d97:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d9a:	eb 0c                	jmp    800da8 <vprintfmt+0x505>
+  800d9c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800da0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800da4:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800da8:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800dab:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800daf:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800db6:	eb 27                	jmp    800ddf <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800db8:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800dbc:	be 03 00 00 00       	mov    $0x3,%esi
+  800dc1:	48 89 c7             	mov    %rax,%rdi
+  800dc4:	48 b8 e7 75 ff ff ff 	movabs $0xffffffffffff75e7,%rax
+  800dcb:	ff ff ff 
+  800dce:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800dd2:	ff d0                	call   *%rax
+  800dd4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800dd8:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800ddf:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800de4:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800de7:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800dea:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800dee:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800df2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800df6:	45 89 c1             	mov    %r8d,%r9d
+  800df9:	41 89 f8             	mov    %edi,%r8d
+  800dfc:	48 89 c7             	mov    %rax,%rdi
+  800dff:	48 b8 0f 75 ff ff ff 	movabs $0xffffffffffff750f,%rax
+  800e06:	ff ff ff 
+  800e09:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e0d:	ff d0                	call   *%rax
+			break;
+  800e0f:	e9 83 00 00 00       	jmp    800e97 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800e14:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e18:	be 03 00 00 00       	mov    $0x3,%esi
+  800e1d:	48 89 c7             	mov    %rax,%rdi
+  800e20:	48 b8 e7 75 ff ff ff 	movabs $0xffffffffffff75e7,%rax
+  800e27:	ff ff ff 
+  800e2a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e2e:	ff d0                	call   *%rax
+  800e30:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800e34:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800e38:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800e3c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e40:	48 89 ce             	mov    %rcx,%rsi
+  800e43:	48 89 c7             	mov    %rax,%rdi
+  800e46:	48 b8 02 77 ff ff ff 	movabs $0xffffffffffff7702,%rax
+  800e4d:	ff ff ff 
+  800e50:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e54:	ff d0                	call   *%rax
+	
+			break;
+  800e56:	eb 3f                	jmp    800e97 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800e58:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e5c:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e60:	48 89 c6             	mov    %rax,%rsi
+  800e63:	89 df                	mov    %ebx,%edi
+  800e65:	ff d2                	call   *%rdx
+			break;
+  800e67:	eb 2e                	jmp    800e97 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800e69:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e6d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e71:	48 89 c6             	mov    %rax,%rsi
+  800e74:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e79:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800e7b:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800e80:	eb 05                	jmp    800e87 <vprintfmt+0x5e4>
+  800e82:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800e87:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800e8b:	48 83 e8 01          	sub    $0x1,%rax
+  800e8f:	0f b6 00             	movzbl (%rax),%eax
+  800e92:	3c 25                	cmp    $0x25,%al
+  800e94:	75 ec                	jne    800e82 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800e96:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800e97:	e9 78 fa ff ff       	jmp    800914 <vprintfmt+0x71>
+				return;
+  800e9c:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800e9d:	48 83 c4 60          	add    $0x60,%rsp
+  800ea1:	5b                   	pop    %rbx
+  800ea2:	41 5c                	pop    %r12
+  800ea4:	41 5d                	pop    %r13
+  800ea6:	41 5f                	pop    %r15
+  800ea8:	5d                   	pop    %rbp
+  800ea9:	c3                   	ret
+
+0000000000800eaa <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  800eaa:	55                   	push   %rbp
+  800eab:	48 89 e5             	mov    %rsp,%rbp
+  800eae:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800eb5:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800eb5 <printfmt+0xb>
+  800ebc:	49 bb 8b 81 00 00 00 	movabs $0x818b,%r11
+  800ec3:	00 00 00 
+  800ec6:	4d 01 da             	add    %r11,%r10
+  800ec9:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800ed0:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800ed7:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800ede:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ee5:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800eec:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ef3:	84 c0                	test   %al,%al
+  800ef5:	74 20                	je     800f17 <printfmt+0x6d>
+  800ef7:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800efb:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800eff:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f03:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f07:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f0b:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f0f:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f13:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  800f17:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f1e:	00 00 00 
+  800f21:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f28:	00 00 00 
+  800f2b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f2f:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f36:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f3d:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  800f44:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f4b:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800f52:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800f59:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f60:	48 89 c7             	mov    %rax,%rdi
+  800f63:	48 b8 63 78 ff ff ff 	movabs $0xffffffffffff7863,%rax
+  800f6a:	ff ff ff 
+  800f6d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800f71:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  800f73:	90                   	nop
+  800f74:	c9                   	leave
+  800f75:	c3                   	ret
+
+0000000000800f76 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800f76:	55                   	push   %rbp
+  800f77:	48 89 e5             	mov    %rsp,%rbp
+  800f7a:	48 83 ec 10          	sub    $0x10,%rsp
+  800f7e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800f7e <sprintputch+0x8>
+  800f85:	49 bb c2 80 00 00 00 	movabs $0x80c2,%r11
+  800f8c:	00 00 00 
+  800f8f:	4c 01 d8             	add    %r11,%rax
+  800f92:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f95:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  800f99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f9d:	8b 40 10             	mov    0x10(%rax),%eax
+  800fa0:	8d 50 01             	lea    0x1(%rax),%edx
+  800fa3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fa7:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  800faa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fae:	48 8b 10             	mov    (%rax),%rdx
+  800fb1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fb5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800fb9:	48 39 c2             	cmp    %rax,%rdx
+  800fbc:	73 17                	jae    800fd5 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  800fbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fc2:	48 8b 00             	mov    (%rax),%rax
+  800fc5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800fc9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800fcd:	48 89 0a             	mov    %rcx,(%rdx)
+  800fd0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800fd3:	88 10                	mov    %dl,(%rax)
+}
+  800fd5:	90                   	nop
+  800fd6:	c9                   	leave
+  800fd7:	c3                   	ret
+
+0000000000800fd8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800fd8:	55                   	push   %rbp
+  800fd9:	48 89 e5             	mov    %rsp,%rbp
+  800fdc:	53                   	push   %rbx
+  800fdd:	48 83 ec 58          	sub    $0x58,%rsp
+  800fe1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800fe1 <vsnprintf+0x9>
+  800fe8:	49 bb 5f 80 00 00 00 	movabs $0x805f,%r11
+  800fef:	00 00 00 
+  800ff2:	4c 01 d8             	add    %r11,%rax
+  800ff5:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  800ff9:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  800ffc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801000:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801004:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801008:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80100c:	48 8b 0e             	mov    (%rsi),%rcx
+  80100f:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801013:	48 89 0a             	mov    %rcx,(%rdx)
+  801016:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80101a:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  80101e:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801022:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801026:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80102a:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80102d:	48 63 d2             	movslq %edx,%rdx
+  801030:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801034:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801038:	48 01 ca             	add    %rcx,%rdx
+  80103b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80103f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801046:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80104b:	74 06                	je     801053 <vsnprintf+0x7b>
+  80104d:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801051:	7f 07                	jg     80105a <vsnprintf+0x82>
+		return -E_INVAL;
+  801053:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801058:	eb 34                	jmp    80108e <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80105a:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  80105e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801062:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801066:	48 bf 36 7f ff ff ff 	movabs $0xffffffffffff7f36,%rdi
+  80106d:	ff ff ff 
+  801070:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801074:	49 b8 63 78 ff ff ff 	movabs $0xffffffffffff7863,%r8
+  80107b:	ff ff ff 
+  80107e:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801082:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801084:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801088:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80108b:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80108e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801092:	c9                   	leave
+  801093:	c3                   	ret
+
+0000000000801094 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801094:	55                   	push   %rbp
+  801095:	48 89 e5             	mov    %rsp,%rbp
+  801098:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80109f:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80109f <snprintf+0xb>
+  8010a6:	49 bb a1 7f 00 00 00 	movabs $0x7fa1,%r11
+  8010ad:	00 00 00 
+  8010b0:	4d 01 da             	add    %r11,%r10
+  8010b3:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8010ba:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8010c0:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8010c7:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010ce:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010d5:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010dc:	84 c0                	test   %al,%al
+  8010de:	74 20                	je     801100 <snprintf+0x6c>
+  8010e0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010e4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010e8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010ec:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010f0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010f4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010f8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010fc:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801100:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801107:	00 00 00 
+  80110a:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801111:	00 00 00 
+  801114:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801118:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80111f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801126:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80112d:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801134:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80113b:	48 8b 06             	mov    (%rsi),%rax
+  80113e:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801142:	48 89 01             	mov    %rax,(%rcx)
+  801145:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801149:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80114d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801151:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801158:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80115f:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801165:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80116c:	48 89 c7             	mov    %rax,%rdi
+  80116f:	48 b8 98 7f ff ff ff 	movabs $0xffffffffffff7f98,%rax
+  801176:	ff ff ff 
+  801179:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80117d:	ff d0                	call   *%rax
+  80117f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801185:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80118b:	c9                   	leave
+  80118c:	c3                   	ret
+
+000000000080118d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80118d:	55                   	push   %rbp
+  80118e:	48 89 e5             	mov    %rsp,%rbp
+  801191:	48 83 ec 18          	sub    $0x18,%rsp
+  801195:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801195 <strlen+0x8>
+  80119c:	49 bb ab 7e 00 00 00 	movabs $0x7eab,%r11
+  8011a3:	00 00 00 
+  8011a6:	4c 01 d8             	add    %r11,%rax
+  8011a9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8011ad:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8011b4:	eb 09                	jmp    8011bf <strlen+0x32>
+		n++;
+  8011b6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8011ba:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8011bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011c3:	0f b6 00             	movzbl (%rax),%eax
+  8011c6:	84 c0                	test   %al,%al
+  8011c8:	75 ec                	jne    8011b6 <strlen+0x29>
+	return n;
+  8011ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8011cd:	c9                   	leave
+  8011ce:	c3                   	ret
+
+00000000008011cf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8011cf:	55                   	push   %rbp
+  8011d0:	48 89 e5             	mov    %rsp,%rbp
+  8011d3:	48 83 ec 20          	sub    $0x20,%rsp
+  8011d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8011d7 <strnlen+0x8>
+  8011de:	49 bb 69 7e 00 00 00 	movabs $0x7e69,%r11
+  8011e5:	00 00 00 
+  8011e8:	4c 01 d8             	add    %r11,%rax
+  8011eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011ef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011f3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8011fa:	eb 0e                	jmp    80120a <strnlen+0x3b>
+		n++;
+  8011fc:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801200:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801205:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80120a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80120f:	74 0b                	je     80121c <strnlen+0x4d>
+  801211:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801215:	0f b6 00             	movzbl (%rax),%eax
+  801218:	84 c0                	test   %al,%al
+  80121a:	75 e0                	jne    8011fc <strnlen+0x2d>
+	return n;
+  80121c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80121f:	c9                   	leave
+  801220:	c3                   	ret
+
+0000000000801221 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801221:	55                   	push   %rbp
+  801222:	48 89 e5             	mov    %rsp,%rbp
+  801225:	48 83 ec 20          	sub    $0x20,%rsp
+  801229:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801229 <strcpy+0x8>
+  801230:	49 bb 17 7e 00 00 00 	movabs $0x7e17,%r11
+  801237:	00 00 00 
+  80123a:	4c 01 d8             	add    %r11,%rax
+  80123d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801241:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801245:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801249:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80124d:	90                   	nop
+  80124e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801252:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801256:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80125a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80125e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801262:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801266:	0f b6 12             	movzbl (%rdx),%edx
+  801269:	88 10                	mov    %dl,(%rax)
+  80126b:	0f b6 00             	movzbl (%rax),%eax
+  80126e:	84 c0                	test   %al,%al
+  801270:	75 dc                	jne    80124e <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801272:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801276:	c9                   	leave
+  801277:	c3                   	ret
+
+0000000000801278 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801278:	55                   	push   %rbp
+  801279:	48 89 e5             	mov    %rsp,%rbp
+  80127c:	53                   	push   %rbx
+  80127d:	48 83 ec 20          	sub    $0x20,%rsp
+  801281:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801281 <strcat+0x9>
+  801288:	49 bb bf 7d 00 00 00 	movabs $0x7dbf,%r11
+  80128f:	00 00 00 
+  801292:	4c 01 db             	add    %r11,%rbx
+  801295:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801299:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80129d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012a1:	48 89 c7             	mov    %rax,%rdi
+  8012a4:	48 b8 4d 81 ff ff ff 	movabs $0xffffffffffff814d,%rax
+  8012ab:	ff ff ff 
+  8012ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8012b2:	ff d0                	call   *%rax
+  8012b4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8012b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8012ba:	48 63 d0             	movslq %eax,%rdx
+  8012bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8012c1:	48 01 c2             	add    %rax,%rdx
+  8012c4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012c8:	48 89 c6             	mov    %rax,%rsi
+  8012cb:	48 89 d7             	mov    %rdx,%rdi
+  8012ce:	48 b8 e1 81 ff ff ff 	movabs $0xffffffffffff81e1,%rax
+  8012d5:	ff ff ff 
+  8012d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8012dc:	ff d0                	call   *%rax
+	return dst;
+  8012de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8012e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8012e6:	c9                   	leave
+  8012e7:	c3                   	ret
+
+00000000008012e8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8012e8:	55                   	push   %rbp
+  8012e9:	48 89 e5             	mov    %rsp,%rbp
+  8012ec:	48 83 ec 28          	sub    $0x28,%rsp
+  8012f0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012f0 <strncpy+0x8>
+  8012f7:	49 bb 50 7d 00 00 00 	movabs $0x7d50,%r11
+  8012fe:	00 00 00 
+  801301:	4c 01 d8             	add    %r11,%rax
+  801304:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801308:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80130c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801310:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801314:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801318:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80131f:	00 
+  801320:	eb 2a                	jmp    80134c <strncpy+0x64>
+		*dst++ = *src;
+  801322:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801326:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80132a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80132e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801332:	0f b6 12             	movzbl (%rdx),%edx
+  801335:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801337:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80133b:	0f b6 00             	movzbl (%rax),%eax
+  80133e:	84 c0                	test   %al,%al
+  801340:	74 05                	je     801347 <strncpy+0x5f>
+			src++;
+  801342:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801347:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80134c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801350:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801354:	72 cc                	jb     801322 <strncpy+0x3a>
+	}
+	return ret;
+  801356:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80135a:	c9                   	leave
+  80135b:	c3                   	ret
+
+000000000080135c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80135c:	55                   	push   %rbp
+  80135d:	48 89 e5             	mov    %rsp,%rbp
+  801360:	48 83 ec 28          	sub    $0x28,%rsp
+  801364:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801364 <strlcpy+0x8>
+  80136b:	49 bb dc 7c 00 00 00 	movabs $0x7cdc,%r11
+  801372:	00 00 00 
+  801375:	4c 01 d8             	add    %r11,%rax
+  801378:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80137c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801380:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801384:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801388:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80138c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801391:	74 3d                	je     8013d0 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801393:	eb 1d                	jmp    8013b2 <strlcpy+0x56>
+			*dst++ = *src++;
+  801395:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801399:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80139d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013a5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013a9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013ad:	0f b6 12             	movzbl (%rdx),%edx
+  8013b0:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8013b2:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8013b7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013bc:	74 0b                	je     8013c9 <strlcpy+0x6d>
+  8013be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013c2:	0f b6 00             	movzbl (%rax),%eax
+  8013c5:	84 c0                	test   %al,%al
+  8013c7:	75 cc                	jne    801395 <strlcpy+0x39>
+		*dst = '\0';
+  8013c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013cd:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8013d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013d4:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8013d8:	c9                   	leave
+  8013d9:	c3                   	ret
+
+00000000008013da <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8013da:	55                   	push   %rbp
+  8013db:	48 89 e5             	mov    %rsp,%rbp
+  8013de:	48 83 ec 10          	sub    $0x10,%rsp
+  8013e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013e2 <strcmp+0x8>
+  8013e9:	49 bb 5e 7c 00 00 00 	movabs $0x7c5e,%r11
+  8013f0:	00 00 00 
+  8013f3:	4c 01 d8             	add    %r11,%rax
+  8013f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8013fa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8013fe:	eb 0a                	jmp    80140a <strcmp+0x30>
+		p++, q++;
+  801400:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801405:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  80140a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80140e:	0f b6 00             	movzbl (%rax),%eax
+  801411:	84 c0                	test   %al,%al
+  801413:	74 12                	je     801427 <strcmp+0x4d>
+  801415:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801419:	0f b6 10             	movzbl (%rax),%edx
+  80141c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801420:	0f b6 00             	movzbl (%rax),%eax
+  801423:	38 c2                	cmp    %al,%dl
+  801425:	74 d9                	je     801400 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801427:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80142b:	0f b6 00             	movzbl (%rax),%eax
+  80142e:	0f b6 d0             	movzbl %al,%edx
+  801431:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801435:	0f b6 00             	movzbl (%rax),%eax
+  801438:	0f b6 c0             	movzbl %al,%eax
+  80143b:	29 c2                	sub    %eax,%edx
+  80143d:	89 d0                	mov    %edx,%eax
+}
+  80143f:	c9                   	leave
+  801440:	c3                   	ret
+
+0000000000801441 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801441:	55                   	push   %rbp
+  801442:	48 89 e5             	mov    %rsp,%rbp
+  801445:	48 83 ec 18          	sub    $0x18,%rsp
+  801449:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801449 <strncmp+0x8>
+  801450:	49 bb f7 7b 00 00 00 	movabs $0x7bf7,%r11
+  801457:	00 00 00 
+  80145a:	4c 01 d8             	add    %r11,%rax
+  80145d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801461:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801465:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801469:	eb 0f                	jmp    80147a <strncmp+0x39>
+		n--, p++, q++;
+  80146b:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801470:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801475:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80147a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80147f:	74 1d                	je     80149e <strncmp+0x5d>
+  801481:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801485:	0f b6 00             	movzbl (%rax),%eax
+  801488:	84 c0                	test   %al,%al
+  80148a:	74 12                	je     80149e <strncmp+0x5d>
+  80148c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801490:	0f b6 10             	movzbl (%rax),%edx
+  801493:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801497:	0f b6 00             	movzbl (%rax),%eax
+  80149a:	38 c2                	cmp    %al,%dl
+  80149c:	74 cd                	je     80146b <strncmp+0x2a>
+	if (n == 0)
+  80149e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8014a3:	75 07                	jne    8014ac <strncmp+0x6b>
+		return 0;
+  8014a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014aa:	eb 16                	jmp    8014c2 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8014ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014b0:	0f b6 00             	movzbl (%rax),%eax
+  8014b3:	0f b6 d0             	movzbl %al,%edx
+  8014b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ba:	0f b6 00             	movzbl (%rax),%eax
+  8014bd:	0f b6 c0             	movzbl %al,%eax
+  8014c0:	29 c2                	sub    %eax,%edx
+}
+  8014c2:	89 d0                	mov    %edx,%eax
+  8014c4:	c9                   	leave
+  8014c5:	c3                   	ret
+
+00000000008014c6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8014c6:	55                   	push   %rbp
+  8014c7:	48 89 e5             	mov    %rsp,%rbp
+  8014ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8014ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014ce <strchr+0x8>
+  8014d5:	49 bb 72 7b 00 00 00 	movabs $0x7b72,%r11
+  8014dc:	00 00 00 
+  8014df:	4c 01 d8             	add    %r11,%rax
+  8014e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8014e6:	89 f0                	mov    %esi,%eax
+  8014e8:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8014eb:	eb 17                	jmp    801504 <strchr+0x3e>
+		if (*s == c)
+  8014ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014f1:	0f b6 00             	movzbl (%rax),%eax
+  8014f4:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8014f7:	75 06                	jne    8014ff <strchr+0x39>
+			return (char *) s;
+  8014f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014fd:	eb 15                	jmp    801514 <strchr+0x4e>
+	for (; *s; s++)
+  8014ff:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801504:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801508:	0f b6 00             	movzbl (%rax),%eax
+  80150b:	84 c0                	test   %al,%al
+  80150d:	75 de                	jne    8014ed <strchr+0x27>
+	return 0;
+  80150f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801514:	c9                   	leave
+  801515:	c3                   	ret
+
+0000000000801516 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801516:	55                   	push   %rbp
+  801517:	48 89 e5             	mov    %rsp,%rbp
+  80151a:	48 83 ec 10          	sub    $0x10,%rsp
+  80151e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80151e <strfind+0x8>
+  801525:	49 bb 22 7b 00 00 00 	movabs $0x7b22,%r11
+  80152c:	00 00 00 
+  80152f:	4c 01 d8             	add    %r11,%rax
+  801532:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801536:	89 f0                	mov    %esi,%eax
+  801538:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80153b:	eb 11                	jmp    80154e <strfind+0x38>
+		if (*s == c)
+  80153d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801541:	0f b6 00             	movzbl (%rax),%eax
+  801544:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801547:	74 12                	je     80155b <strfind+0x45>
+	for (; *s; s++)
+  801549:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80154e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801552:	0f b6 00             	movzbl (%rax),%eax
+  801555:	84 c0                	test   %al,%al
+  801557:	75 e4                	jne    80153d <strfind+0x27>
+  801559:	eb 01                	jmp    80155c <strfind+0x46>
+			break;
+  80155b:	90                   	nop
+	return (char *) s;
+  80155c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801560:	c9                   	leave
+  801561:	c3                   	ret
+
+0000000000801562 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801562:	55                   	push   %rbp
+  801563:	48 89 e5             	mov    %rsp,%rbp
+  801566:	48 83 ec 18          	sub    $0x18,%rsp
+  80156a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80156a <memset+0x8>
+  801571:	49 bb d6 7a 00 00 00 	movabs $0x7ad6,%r11
+  801578:	00 00 00 
+  80157b:	4c 01 d8             	add    %r11,%rax
+  80157e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801582:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801585:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801589:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80158e:	75 06                	jne    801596 <memset+0x34>
+		return v;
+  801590:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801594:	eb 69                	jmp    8015ff <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801596:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80159a:	83 e0 03             	and    $0x3,%eax
+  80159d:	48 85 c0             	test   %rax,%rax
+  8015a0:	75 48                	jne    8015ea <memset+0x88>
+  8015a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015a6:	83 e0 03             	and    $0x3,%eax
+  8015a9:	48 85 c0             	test   %rax,%rax
+  8015ac:	75 3c                	jne    8015ea <memset+0x88>
+		c &= 0xFF;
+  8015ae:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8015b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015b8:	c1 e0 18             	shl    $0x18,%eax
+  8015bb:	89 c2                	mov    %eax,%edx
+  8015bd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015c0:	c1 e0 10             	shl    $0x10,%eax
+  8015c3:	09 c2                	or     %eax,%edx
+  8015c5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015c8:	c1 e0 08             	shl    $0x8,%eax
+  8015cb:	09 d0                	or     %edx,%eax
+  8015cd:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8015d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015d4:	48 c1 e8 02          	shr    $0x2,%rax
+  8015d8:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8015db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015df:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015e2:	48 89 d7             	mov    %rdx,%rdi
+  8015e5:	fc                   	cld
+  8015e6:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8015e8:	eb 11                	jmp    8015fb <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8015ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8015ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015f1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015f5:	48 89 d7             	mov    %rdx,%rdi
+  8015f8:	fc                   	cld
+  8015f9:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8015fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8015ff:	c9                   	leave
+  801600:	c3                   	ret
+
+0000000000801601 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801601:	55                   	push   %rbp
+  801602:	48 89 e5             	mov    %rsp,%rbp
+  801605:	48 83 ec 28          	sub    $0x28,%rsp
+  801609:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801609 <memmove+0x8>
+  801610:	49 bb 37 7a 00 00 00 	movabs $0x7a37,%r11
+  801617:	00 00 00 
+  80161a:	4c 01 d8             	add    %r11,%rax
+  80161d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801621:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801625:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801629:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80162d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801631:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801635:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801639:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80163d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801641:	0f 83 88 00 00 00    	jae    8016cf <memmove+0xce>
+  801647:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80164b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80164f:	48 01 d0             	add    %rdx,%rax
+  801652:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801656:	73 77                	jae    8016cf <memmove+0xce>
+		s += n;
+  801658:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80165c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801660:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801664:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801668:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80166c:	83 e0 03             	and    $0x3,%eax
+  80166f:	48 85 c0             	test   %rax,%rax
+  801672:	75 3b                	jne    8016af <memmove+0xae>
+  801674:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801678:	83 e0 03             	and    $0x3,%eax
+  80167b:	48 85 c0             	test   %rax,%rax
+  80167e:	75 2f                	jne    8016af <memmove+0xae>
+  801680:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801684:	83 e0 03             	and    $0x3,%eax
+  801687:	48 85 c0             	test   %rax,%rax
+  80168a:	75 23                	jne    8016af <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80168c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801690:	48 83 e8 04          	sub    $0x4,%rax
+  801694:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801698:	48 83 ea 04          	sub    $0x4,%rdx
+  80169c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8016a0:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8016a4:	48 89 c7             	mov    %rax,%rdi
+  8016a7:	48 89 d6             	mov    %rdx,%rsi
+  8016aa:	fd                   	std
+  8016ab:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8016ad:	eb 1d                	jmp    8016cc <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8016af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016b3:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8016b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016bb:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8016bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016c3:	48 89 d7             	mov    %rdx,%rdi
+  8016c6:	48 89 c1             	mov    %rax,%rcx
+  8016c9:	fd                   	std
+  8016ca:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8016cc:	fc                   	cld
+  8016cd:	eb 57                	jmp    801726 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8016cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016d3:	83 e0 03             	and    $0x3,%eax
+  8016d6:	48 85 c0             	test   %rax,%rax
+  8016d9:	75 36                	jne    801711 <memmove+0x110>
+  8016db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016df:	83 e0 03             	and    $0x3,%eax
+  8016e2:	48 85 c0             	test   %rax,%rax
+  8016e5:	75 2a                	jne    801711 <memmove+0x110>
+  8016e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016eb:	83 e0 03             	and    $0x3,%eax
+  8016ee:	48 85 c0             	test   %rax,%rax
+  8016f1:	75 1e                	jne    801711 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8016f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016f7:	48 c1 e8 02          	shr    $0x2,%rax
+  8016fb:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8016fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801702:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801706:	48 89 c7             	mov    %rax,%rdi
+  801709:	48 89 d6             	mov    %rdx,%rsi
+  80170c:	fc                   	cld
+  80170d:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  80170f:	eb 15                	jmp    801726 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801711:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801715:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801719:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80171d:	48 89 c7             	mov    %rax,%rdi
+  801720:	48 89 d6             	mov    %rdx,%rsi
+  801723:	fc                   	cld
+  801724:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801726:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80172a:	c9                   	leave
+  80172b:	c3                   	ret
+
+000000000080172c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80172c:	55                   	push   %rbp
+  80172d:	48 89 e5             	mov    %rsp,%rbp
+  801730:	48 83 ec 18          	sub    $0x18,%rsp
+  801734:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801734 <memcpy+0x8>
+  80173b:	49 bb 0c 79 00 00 00 	movabs $0x790c,%r11
+  801742:	00 00 00 
+  801745:	4c 01 d8             	add    %r11,%rax
+  801748:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80174c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801750:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801754:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801758:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80175c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801760:	48 89 cf             	mov    %rcx,%rdi
+  801763:	48 b9 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rcx
+  80176a:	ff ff ff 
+  80176d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801771:	ff d0                	call   *%rax
+}
+  801773:	c9                   	leave
+  801774:	c3                   	ret
+
+0000000000801775 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801775:	55                   	push   %rbp
+  801776:	48 89 e5             	mov    %rsp,%rbp
+  801779:	48 83 ec 28          	sub    $0x28,%rsp
+  80177d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80177d <memcmp+0x8>
+  801784:	49 bb c3 78 00 00 00 	movabs $0x78c3,%r11
+  80178b:	00 00 00 
+  80178e:	4c 01 d8             	add    %r11,%rax
+  801791:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801795:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801799:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  80179d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  8017a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  8017ad:	eb 34                	jmp    8017e3 <memcmp+0x6e>
+		if (*s1 != *s2)
+  8017af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b3:	0f b6 10             	movzbl (%rax),%edx
+  8017b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ba:	0f b6 00             	movzbl (%rax),%eax
+  8017bd:	38 c2                	cmp    %al,%dl
+  8017bf:	74 18                	je     8017d9 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  8017c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c5:	0f b6 00             	movzbl (%rax),%eax
+  8017c8:	0f b6 d0             	movzbl %al,%edx
+  8017cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017cf:	0f b6 00             	movzbl (%rax),%eax
+  8017d2:	0f b6 c0             	movzbl %al,%eax
+  8017d5:	29 c2                	sub    %eax,%edx
+  8017d7:	eb 20                	jmp    8017f9 <memcmp+0x84>
+		s1++, s2++;
+  8017d9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017de:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8017e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017e7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017eb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8017ef:	48 85 c0             	test   %rax,%rax
+  8017f2:	75 bb                	jne    8017af <memcmp+0x3a>
+	}
+
+	return 0;
+  8017f4:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8017f9:	89 d0                	mov    %edx,%eax
+  8017fb:	c9                   	leave
+  8017fc:	c3                   	ret
+
+00000000008017fd <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8017fd:	55                   	push   %rbp
+  8017fe:	48 89 e5             	mov    %rsp,%rbp
+  801801:	48 83 ec 28          	sub    $0x28,%rsp
+  801805:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801805 <memfind+0x8>
+  80180c:	49 bb 3b 78 00 00 00 	movabs $0x783b,%r11
+  801813:	00 00 00 
+  801816:	4c 01 d8             	add    %r11,%rax
+  801819:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80181d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801820:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801824:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801828:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80182c:	48 01 d0             	add    %rdx,%rax
+  80182f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801833:	eb 13                	jmp    801848 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801835:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801839:	0f b6 00             	movzbl (%rax),%eax
+  80183c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80183f:	38 d0                	cmp    %dl,%al
+  801841:	74 11                	je     801854 <memfind+0x57>
+	for (; s < ends; s++)
+  801843:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801848:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80184c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801850:	72 e3                	jb     801835 <memfind+0x38>
+  801852:	eb 01                	jmp    801855 <memfind+0x58>
+			break;
+  801854:	90                   	nop
+	return (void *) s;
+  801855:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801859:	c9                   	leave
+  80185a:	c3                   	ret
+
+000000000080185b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80185b:	55                   	push   %rbp
+  80185c:	48 89 e5             	mov    %rsp,%rbp
+  80185f:	48 83 ec 38          	sub    $0x38,%rsp
+  801863:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801863 <strtol+0x8>
+  80186a:	49 bb dd 77 00 00 00 	movabs $0x77dd,%r11
+  801871:	00 00 00 
+  801874:	4c 01 d8             	add    %r11,%rax
+  801877:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80187b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80187f:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801882:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801889:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801890:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801891:	eb 05                	jmp    801898 <strtol+0x3d>
+		s++;
+  801893:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801898:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80189c:	0f b6 00             	movzbl (%rax),%eax
+  80189f:	3c 20                	cmp    $0x20,%al
+  8018a1:	74 f0                	je     801893 <strtol+0x38>
+  8018a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018a7:	0f b6 00             	movzbl (%rax),%eax
+  8018aa:	3c 09                	cmp    $0x9,%al
+  8018ac:	74 e5                	je     801893 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  8018ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018b2:	0f b6 00             	movzbl (%rax),%eax
+  8018b5:	3c 2b                	cmp    $0x2b,%al
+  8018b7:	75 07                	jne    8018c0 <strtol+0x65>
+		s++;
+  8018b9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018be:	eb 17                	jmp    8018d7 <strtol+0x7c>
+	else if (*s == '-')
+  8018c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018c4:	0f b6 00             	movzbl (%rax),%eax
+  8018c7:	3c 2d                	cmp    $0x2d,%al
+  8018c9:	75 0c                	jne    8018d7 <strtol+0x7c>
+		s++, neg = 1;
+  8018cb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8018d0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8018d7:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8018db:	74 06                	je     8018e3 <strtol+0x88>
+  8018dd:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8018e1:	75 28                	jne    80190b <strtol+0xb0>
+  8018e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018e7:	0f b6 00             	movzbl (%rax),%eax
+  8018ea:	3c 30                	cmp    $0x30,%al
+  8018ec:	75 1d                	jne    80190b <strtol+0xb0>
+  8018ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018f2:	48 83 c0 01          	add    $0x1,%rax
+  8018f6:	0f b6 00             	movzbl (%rax),%eax
+  8018f9:	3c 78                	cmp    $0x78,%al
+  8018fb:	75 0e                	jne    80190b <strtol+0xb0>
+		s += 2, base = 16;
+  8018fd:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801902:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801909:	eb 2c                	jmp    801937 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  80190b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80190f:	75 19                	jne    80192a <strtol+0xcf>
+  801911:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801915:	0f b6 00             	movzbl (%rax),%eax
+  801918:	3c 30                	cmp    $0x30,%al
+  80191a:	75 0e                	jne    80192a <strtol+0xcf>
+		s++, base = 8;
+  80191c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801921:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801928:	eb 0d                	jmp    801937 <strtol+0xdc>
+	else if (base == 0)
+  80192a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80192e:	75 07                	jne    801937 <strtol+0xdc>
+		base = 10;
+  801930:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801937:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80193b:	0f b6 00             	movzbl (%rax),%eax
+  80193e:	3c 2f                	cmp    $0x2f,%al
+  801940:	7e 1d                	jle    80195f <strtol+0x104>
+  801942:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801946:	0f b6 00             	movzbl (%rax),%eax
+  801949:	3c 39                	cmp    $0x39,%al
+  80194b:	7f 12                	jg     80195f <strtol+0x104>
+			dig = *s - '0';
+  80194d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801951:	0f b6 00             	movzbl (%rax),%eax
+  801954:	0f be c0             	movsbl %al,%eax
+  801957:	83 e8 30             	sub    $0x30,%eax
+  80195a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80195d:	eb 4e                	jmp    8019ad <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  80195f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801963:	0f b6 00             	movzbl (%rax),%eax
+  801966:	3c 60                	cmp    $0x60,%al
+  801968:	7e 1d                	jle    801987 <strtol+0x12c>
+  80196a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80196e:	0f b6 00             	movzbl (%rax),%eax
+  801971:	3c 7a                	cmp    $0x7a,%al
+  801973:	7f 12                	jg     801987 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801975:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801979:	0f b6 00             	movzbl (%rax),%eax
+  80197c:	0f be c0             	movsbl %al,%eax
+  80197f:	83 e8 57             	sub    $0x57,%eax
+  801982:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801985:	eb 26                	jmp    8019ad <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801987:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80198b:	0f b6 00             	movzbl (%rax),%eax
+  80198e:	3c 40                	cmp    $0x40,%al
+  801990:	7e 47                	jle    8019d9 <strtol+0x17e>
+  801992:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801996:	0f b6 00             	movzbl (%rax),%eax
+  801999:	3c 5a                	cmp    $0x5a,%al
+  80199b:	7f 3c                	jg     8019d9 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  80199d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019a1:	0f b6 00             	movzbl (%rax),%eax
+  8019a4:	0f be c0             	movsbl %al,%eax
+  8019a7:	83 e8 37             	sub    $0x37,%eax
+  8019aa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  8019ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019b0:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8019b3:	7d 23                	jge    8019d8 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  8019b5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8019ba:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8019bd:	48 98                	cltq
+  8019bf:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8019c4:	48 89 c2             	mov    %rax,%rdx
+  8019c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019ca:	48 98                	cltq
+  8019cc:	48 01 d0             	add    %rdx,%rax
+  8019cf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  8019d3:	e9 5f ff ff ff       	jmp    801937 <strtol+0xdc>
+			break;
+  8019d8:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8019d9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8019de:	74 0b                	je     8019eb <strtol+0x190>
+		*endptr = (char *) s;
+  8019e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019e4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8019e8:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8019eb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019ef:	74 09                	je     8019fa <strtol+0x19f>
+  8019f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019f5:	48 f7 d8             	neg    %rax
+  8019f8:	eb 04                	jmp    8019fe <strtol+0x1a3>
+  8019fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8019fe:	c9                   	leave
+  8019ff:	c3                   	ret
+
+0000000000801a00 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801a00:	55                   	push   %rbp
+  801a01:	48 89 e5             	mov    %rsp,%rbp
+  801a04:	53                   	push   %rbx
+  801a05:	48 83 ec 30          	sub    $0x30,%rsp
+  801a09:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801a09 <strstr+0x9>
+  801a10:	49 bb 37 76 00 00 00 	movabs $0x7637,%r11
+  801a17:	00 00 00 
+  801a1a:	4c 01 db             	add    %r11,%rbx
+  801a1d:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801a21:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801a25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a29:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a2d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a31:	0f b6 00             	movzbl (%rax),%eax
+  801a34:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801a37:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801a3b:	75 06                	jne    801a43 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801a3d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a41:	eb 73                	jmp    801ab6 <strstr+0xb6>
+
+	len = strlen(str);
+  801a43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a47:	48 89 c7             	mov    %rax,%rdi
+  801a4a:	48 b8 4d 81 ff ff ff 	movabs $0xffffffffffff814d,%rax
+  801a51:	ff ff ff 
+  801a54:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801a58:	ff d0                	call   *%rax
+  801a5a:	48 98                	cltq
+  801a5c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801a60:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a64:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a68:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801a6c:	0f b6 00             	movzbl (%rax),%eax
+  801a6f:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801a72:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801a76:	75 07                	jne    801a7f <strstr+0x7f>
+				return (char *) 0;
+  801a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7d:	eb 37                	jmp    801ab6 <strstr+0xb6>
+		} while (sc != c);
+  801a7f:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801a83:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801a86:	75 d8                	jne    801a60 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801a88:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a8c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801a90:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a94:	48 89 ce             	mov    %rcx,%rsi
+  801a97:	48 89 c7             	mov    %rax,%rdi
+  801a9a:	48 b8 01 84 ff ff ff 	movabs $0xffffffffffff8401,%rax
+  801aa1:	ff ff ff 
+  801aa4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801aa8:	ff d0                	call   *%rax
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	75 b2                	jne    801a60 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801aae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ab2:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801ab6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801aba:	c9                   	leave
+  801abb:	c3                   	ret
+
+0000000000801abc <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801abc:	55                   	push   %rbp
+  801abd:	48 89 e5             	mov    %rsp,%rbp
+  801ac0:	41 57                	push   %r15
+  801ac2:	53                   	push   %rbx
+  801ac3:	48 83 ec 40          	sub    $0x40,%rsp
+  801ac7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801ac7 <syscall+0xb>
+  801ace:	49 bb 79 75 00 00 00 	movabs $0x7579,%r11
+  801ad5:	00 00 00 
+  801ad8:	4d 01 da             	add    %r11,%r10
+  801adb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801ade:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801ae1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ae5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801ae9:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801aed:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801af1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801af4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801af8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801afc:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801b00:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801b04:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801b08:	4c 89 c3             	mov    %r8,%rbx
+  801b0b:	cd 30                	int    $0x30
+  801b0d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801b11:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801b15:	74 52                	je     801b69 <syscall+0xad>
+  801b17:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b1c:	7e 4b                	jle    801b69 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801b1e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b22:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b25:	49 89 d0             	mov    %rdx,%r8
+  801b28:	89 c1                	mov    %eax,%ecx
+  801b2a:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  801b31:	ff ff ff 
+  801b34:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801b38:	48 89 c2             	mov    %rax,%rdx
+  801b3b:	be 23 00 00 00       	mov    $0x23,%esi
+  801b40:	48 b8 0d e1 ff ff ff 	movabs $0xffffffffffffe10d,%rax
+  801b47:	ff ff ff 
+  801b4a:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801b4e:	48 89 c7             	mov    %rax,%rdi
+  801b51:	4d 89 d7             	mov    %r10,%r15
+  801b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b59:	49 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%r9
+  801b60:	ff ff ff 
+  801b63:	4d 01 d1             	add    %r10,%r9
+  801b66:	41 ff d1             	call   *%r9
+
+	return ret;
+  801b69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b6d:	48 83 c4 40          	add    $0x40,%rsp
+  801b71:	5b                   	pop    %rbx
+  801b72:	41 5f                	pop    %r15
+  801b74:	5d                   	pop    %rbp
+  801b75:	c3                   	ret
+
+0000000000801b76 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801b76:	55                   	push   %rbp
+  801b77:	48 89 e5             	mov    %rsp,%rbp
+  801b7a:	41 57                	push   %r15
+  801b7c:	41 56                	push   %r14
+  801b7e:	41 55                	push   %r13
+  801b80:	41 54                	push   %r12
+  801b82:	53                   	push   %rbx
+  801b83:	48 83 ec 48          	sub    $0x48,%rsp
+  801b87:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801b87 <syscall_words+0x11>
+  801b8e:	49 bb b9 74 00 00 00 	movabs $0x74b9,%r11
+  801b95:	00 00 00 
+  801b98:	4d 01 de             	add    %r11,%r14
+  801b9b:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801b9e:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801ba1:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801ba5:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801ba9:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801bad:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801bb1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801bb6:	74 09                	je     801bc1 <syscall_words+0x4b>
+  801bb8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bbc:	48 8b 00             	mov    (%rax),%rax
+  801bbf:	eb 05                	jmp    801bc6 <syscall_words+0x50>
+  801bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc6:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801bc9:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801bce:	74 0a                	je     801bda <syscall_words+0x64>
+  801bd0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bd4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801bd8:	eb 05                	jmp    801bdf <syscall_words+0x69>
+  801bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bdf:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801be2:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801be7:	74 0a                	je     801bf3 <syscall_words+0x7d>
+  801be9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801bed:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801bf1:	eb 05                	jmp    801bf8 <syscall_words+0x82>
+  801bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf8:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801bfb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c00:	74 0a                	je     801c0c <syscall_words+0x96>
+  801c02:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c06:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c0a:	eb 05                	jmp    801c11 <syscall_words+0x9b>
+  801c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c11:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801c14:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c19:	74 0a                	je     801c25 <syscall_words+0xaf>
+  801c1b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c1f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c23:	eb 05                	jmp    801c2a <syscall_words+0xb4>
+  801c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2a:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801c2d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c32:	74 0a                	je     801c3e <syscall_words+0xc8>
+  801c34:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c38:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801c3c:	eb 05                	jmp    801c43 <syscall_words+0xcd>
+  801c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c43:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801c46:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801c49:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801c4d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801c51:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801c55:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801c59:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801c5d:	cd 30                	int    $0x30
+  801c5f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801c63:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801c68:	74 50                	je     801cba <syscall_words+0x144>
+		words[0] = r8;
+  801c6a:	4c 89 c2             	mov    %r8,%rdx
+  801c6d:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c71:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801c74:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c78:	48 83 c0 08          	add    $0x8,%rax
+  801c7c:	4c 89 ca             	mov    %r9,%rdx
+  801c7f:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801c82:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c86:	48 83 c0 10          	add    $0x10,%rax
+  801c8a:	4c 89 d2             	mov    %r10,%rdx
+  801c8d:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801c90:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801c94:	48 83 c0 18          	add    $0x18,%rax
+  801c98:	4c 89 da             	mov    %r11,%rdx
+  801c9b:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801c9e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ca2:	48 83 c0 20          	add    $0x20,%rax
+  801ca6:	4c 89 e2             	mov    %r12,%rdx
+  801ca9:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801cac:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801cb0:	48 83 c0 28          	add    $0x28,%rax
+  801cb4:	4c 89 ea             	mov    %r13,%rdx
+  801cb7:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801cba:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801cbe:	74 52                	je     801d12 <syscall_words+0x19c>
+  801cc0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801cc5:	7e 4b                	jle    801d12 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801cc7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ccb:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801cce:	49 89 d0             	mov    %rdx,%r8
+  801cd1:	89 c1                	mov    %eax,%ecx
+  801cd3:	48 b8 f0 e0 ff ff ff 	movabs $0xffffffffffffe0f0,%rax
+  801cda:	ff ff ff 
+  801cdd:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801ce1:	48 89 c2             	mov    %rax,%rdx
+  801ce4:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801ce9:	48 b8 0d e1 ff ff ff 	movabs $0xffffffffffffe10d,%rax
+  801cf0:	ff ff ff 
+  801cf3:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801cf7:	48 89 c7             	mov    %rax,%rdi
+  801cfa:	4d 89 f7             	mov    %r14,%r15
+  801cfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d02:	49 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%r9
+  801d09:	ff ff ff 
+  801d0c:	4d 01 f1             	add    %r14,%r9
+  801d0f:	41 ff d1             	call   *%r9
+
+	return ret;
+  801d12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801d16:	48 83 c4 48          	add    $0x48,%rsp
+  801d1a:	5b                   	pop    %rbx
+  801d1b:	41 5c                	pop    %r12
+  801d1d:	41 5d                	pop    %r13
+  801d1f:	41 5e                	pop    %r14
+  801d21:	41 5f                	pop    %r15
+  801d23:	5d                   	pop    %rbp
+  801d24:	c3                   	ret
+
+0000000000801d25 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801d25:	55                   	push   %rbp
+  801d26:	48 89 e5             	mov    %rsp,%rbp
+  801d29:	48 83 ec 10          	sub    $0x10,%rsp
+  801d2d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d2d <sys_cputs+0x8>
+  801d34:	49 bb 13 73 00 00 00 	movabs $0x7313,%r11
+  801d3b:	00 00 00 
+  801d3e:	4c 01 d8             	add    %r11,%rax
+  801d41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801d49:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d4d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d51:	48 83 ec 08          	sub    $0x8,%rsp
+  801d55:	6a 00                	push   $0x0
+  801d57:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d63:	be 00 00 00 00       	mov    $0x0,%esi
+  801d68:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6d:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  801d74:	ff ff ff 
+  801d77:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801d7b:	ff d0                	call   *%rax
+  801d7d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801d81:	90                   	nop
+  801d82:	c9                   	leave
+  801d83:	c3                   	ret
+
+0000000000801d84 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801d84:	55                   	push   %rbp
+  801d85:	48 89 e5             	mov    %rsp,%rbp
+  801d88:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801d88 <sys_cgetc+0x4>
+  801d8f:	49 bb b8 72 00 00 00 	movabs $0x72b8,%r11
+  801d96:	00 00 00 
+  801d99:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801d9c:	48 83 ec 08          	sub    $0x8,%rsp
+  801da0:	6a 00                	push   $0x0
+  801da2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801da8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801db3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db8:	be 00 00 00 00       	mov    $0x0,%esi
+  801dbd:	bf 01 00 00 00       	mov    $0x1,%edi
+  801dc2:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  801dc9:	ff ff ff 
+  801dcc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801dd0:	ff d0                	call   *%rax
+  801dd2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801dd6:	c9                   	leave
+  801dd7:	c3                   	ret
+
+0000000000801dd8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801dd8:	55                   	push   %rbp
+  801dd9:	48 89 e5             	mov    %rsp,%rbp
+  801ddc:	48 83 ec 10          	sub    $0x10,%rsp
+  801de0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801de0 <sys_env_destroy+0x8>
+  801de7:	49 bb 60 72 00 00 00 	movabs $0x7260,%r11
+  801dee:	00 00 00 
+  801df1:	4c 01 d8             	add    %r11,%rax
+  801df4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801df7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801dfa:	48 63 d2             	movslq %edx,%rdx
+  801dfd:	48 83 ec 08          	sub    $0x8,%rsp
+  801e01:	6a 00                	push   $0x0
+  801e03:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e09:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e14:	be 01 00 00 00       	mov    $0x1,%esi
+  801e19:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e1e:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  801e25:	ff ff ff 
+  801e28:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e2c:	ff d0                	call   *%rax
+  801e2e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e32:	c9                   	leave
+  801e33:	c3                   	ret
+
+0000000000801e34 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801e34:	55                   	push   %rbp
+  801e35:	48 89 e5             	mov    %rsp,%rbp
+  801e38:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e38 <sys_getenvid+0x4>
+  801e3f:	49 bb 08 72 00 00 00 	movabs $0x7208,%r11
+  801e46:	00 00 00 
+  801e49:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801e4c:	48 83 ec 08          	sub    $0x8,%rsp
+  801e50:	6a 00                	push   $0x0
+  801e52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e68:	be 00 00 00 00       	mov    $0x0,%esi
+  801e6d:	bf 02 00 00 00       	mov    $0x2,%edi
+  801e72:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  801e79:	ff ff ff 
+  801e7c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801e80:	ff d0                	call   *%rax
+  801e82:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801e86:	c9                   	leave
+  801e87:	c3                   	ret
+
+0000000000801e88 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801e88:	55                   	push   %rbp
+  801e89:	48 89 e5             	mov    %rsp,%rbp
+  801e8c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e8c <sys_yield+0x4>
+  801e93:	49 bb b4 71 00 00 00 	movabs $0x71b4,%r11
+  801e9a:	00 00 00 
+  801e9d:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801ea0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ea4:	6a 00                	push   $0x0
+  801ea6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801eac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ebc:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  801ec6:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  801ecd:	ff ff ff 
+  801ed0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ed4:	ff d0                	call   *%rax
+  801ed6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eda:	90                   	nop
+  801edb:	c9                   	leave
+  801edc:	c3                   	ret
+
+0000000000801edd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801edd:	55                   	push   %rbp
+  801ede:	48 89 e5             	mov    %rsp,%rbp
+  801ee1:	48 83 ec 10          	sub    $0x10,%rsp
+  801ee5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ee5 <sys_page_alloc+0x8>
+  801eec:	49 bb 5b 71 00 00 00 	movabs $0x715b,%r11
+  801ef3:	00 00 00 
+  801ef6:	4c 01 d8             	add    %r11,%rax
+  801ef9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801efc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f00:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  801f03:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801f06:	48 63 f2             	movslq %edx,%rsi
+  801f09:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f0d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f10:	48 63 d2             	movslq %edx,%rdx
+  801f13:	48 83 ec 08          	sub    $0x8,%rsp
+  801f17:	6a 00                	push   $0x0
+  801f19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f1f:	49 89 f0             	mov    %rsi,%r8
+  801f22:	be 01 00 00 00       	mov    $0x1,%esi
+  801f27:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f2c:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  801f33:	ff ff ff 
+  801f36:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f3a:	ff d0                	call   *%rax
+  801f3c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f40:	c9                   	leave
+  801f41:	c3                   	ret
+
+0000000000801f42 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801f42:	55                   	push   %rbp
+  801f43:	48 89 e5             	mov    %rsp,%rbp
+  801f46:	48 83 ec 20          	sub    $0x20,%rsp
+  801f4a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f4a <sys_page_map+0x8>
+  801f51:	49 bb f6 70 00 00 00 	movabs $0x70f6,%r11
+  801f58:	00 00 00 
+  801f5b:	4c 01 d8             	add    %r11,%rax
+  801f5e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f61:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f65:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  801f68:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f6c:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  801f70:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801f73:	48 63 f2             	movslq %edx,%rsi
+  801f76:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  801f7a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801f7d:	48 63 fa             	movslq %edx,%rdi
+  801f80:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f84:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f87:	48 63 d2             	movslq %edx,%rdx
+  801f8a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f8e:	56                   	push   %rsi
+  801f8f:	4d 89 c1             	mov    %r8,%r9
+  801f92:	49 89 f8             	mov    %rdi,%r8
+  801f95:	be 01 00 00 00       	mov    $0x1,%esi
+  801f9a:	bf 05 00 00 00       	mov    $0x5,%edi
+  801f9f:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  801fa6:	ff ff ff 
+  801fa9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fad:	ff d0                	call   *%rax
+  801faf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fb3:	c9                   	leave
+  801fb4:	c3                   	ret
+
+0000000000801fb5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801fb5:	55                   	push   %rbp
+  801fb6:	48 89 e5             	mov    %rsp,%rbp
+  801fb9:	48 83 ec 10          	sub    $0x10,%rsp
+  801fbd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fbd <sys_page_unmap+0x8>
+  801fc4:	49 bb 83 70 00 00 00 	movabs $0x7083,%r11
+  801fcb:	00 00 00 
+  801fce:	4c 01 d8             	add    %r11,%rax
+  801fd1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801fd4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  801fd8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fdc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fdf:	48 63 d2             	movslq %edx,%rdx
+  801fe2:	48 83 ec 08          	sub    $0x8,%rsp
+  801fe6:	6a 00                	push   $0x0
+  801fe8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ff4:	be 01 00 00 00       	mov    $0x1,%esi
+  801ff9:	bf 06 00 00 00       	mov    $0x6,%edi
+  801ffe:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  802005:	ff ff ff 
+  802008:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80200c:	ff d0                	call   *%rax
+  80200e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802012:	c9                   	leave
+  802013:	c3                   	ret
+
+0000000000802014 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802014:	55                   	push   %rbp
+  802015:	48 89 e5             	mov    %rsp,%rbp
+  802018:	48 83 ec 10          	sub    $0x10,%rsp
+  80201c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80201c <sys_env_set_status+0x8>
+  802023:	49 bb 24 70 00 00 00 	movabs $0x7024,%r11
+  80202a:	00 00 00 
+  80202d:	4c 01 d8             	add    %r11,%rax
+  802030:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802033:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802036:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802039:	48 63 ca             	movslq %edx,%rcx
+  80203c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80203f:	48 63 d2             	movslq %edx,%rdx
+  802042:	48 83 ec 08          	sub    $0x8,%rsp
+  802046:	6a 00                	push   $0x0
+  802048:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80204e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802054:	be 01 00 00 00       	mov    $0x1,%esi
+  802059:	bf 08 00 00 00       	mov    $0x8,%edi
+  80205e:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  802065:	ff ff ff 
+  802068:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80206c:	ff d0                	call   *%rax
+  80206e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802072:	c9                   	leave
+  802073:	c3                   	ret
+
+0000000000802074 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802074:	55                   	push   %rbp
+  802075:	48 89 e5             	mov    %rsp,%rbp
+  802078:	48 83 ec 10          	sub    $0x10,%rsp
+  80207c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80207c <sys_env_set_trapframe+0x8>
+  802083:	49 bb c4 6f 00 00 00 	movabs $0x6fc4,%r11
+  80208a:	00 00 00 
+  80208d:	4c 01 d8             	add    %r11,%rax
+  802090:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802093:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802097:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80209b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80209e:	48 63 d2             	movslq %edx,%rdx
+  8020a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a5:	6a 00                	push   $0x0
+  8020a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8020b8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8020bd:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  8020c4:	ff ff ff 
+  8020c7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020cb:	ff d0                	call   *%rax
+  8020cd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020d1:	c9                   	leave
+  8020d2:	c3                   	ret
+
+00000000008020d3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8020d3:	55                   	push   %rbp
+  8020d4:	48 89 e5             	mov    %rsp,%rbp
+  8020d7:	48 83 ec 10          	sub    $0x10,%rsp
+  8020db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020db <sys_env_set_pgfault_upcall+0x8>
+  8020e2:	49 bb 65 6f 00 00 00 	movabs $0x6f65,%r11
+  8020e9:	00 00 00 
+  8020ec:	4c 01 d8             	add    %r11,%rax
+  8020ef:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8020f6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020fa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020fd:	48 63 d2             	movslq %edx,%rdx
+  802100:	48 83 ec 08          	sub    $0x8,%rsp
+  802104:	6a 00                	push   $0x0
+  802106:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80210c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802112:	be 01 00 00 00       	mov    $0x1,%esi
+  802117:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80211c:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  802123:	ff ff ff 
+  802126:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80212a:	ff d0                	call   *%rax
+  80212c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802130:	c9                   	leave
+  802131:	c3                   	ret
+
+0000000000802132 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802132:	55                   	push   %rbp
+  802133:	48 89 e5             	mov    %rsp,%rbp
+  802136:	48 83 ec 20          	sub    $0x20,%rsp
+  80213a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80213a <sys_ipc_try_send+0x8>
+  802141:	49 bb 06 6f 00 00 00 	movabs $0x6f06,%r11
+  802148:	00 00 00 
+  80214b:	4c 01 d8             	add    %r11,%rax
+  80214e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802151:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802155:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802159:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80215c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80215f:	48 63 fa             	movslq %edx,%rdi
+  802162:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802166:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802169:	48 63 d2             	movslq %edx,%rdx
+  80216c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802170:	48 83 ec 08          	sub    $0x8,%rsp
+  802174:	6a 00                	push   $0x0
+  802176:	49 89 f9             	mov    %rdi,%r9
+  802179:	49 89 f0             	mov    %rsi,%r8
+  80217c:	be 00 00 00 00       	mov    $0x0,%esi
+  802181:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802186:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  80218d:	ff ff ff 
+  802190:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802194:	ff d0                	call   *%rax
+  802196:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80219a:	c9                   	leave
+  80219b:	c3                   	ret
+
+000000000080219c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80219c:	55                   	push   %rbp
+  80219d:	48 89 e5             	mov    %rsp,%rbp
+  8021a0:	48 83 ec 20          	sub    $0x20,%rsp
+  8021a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021a4 <sys_ipc_send+0x8>
+  8021ab:	49 bb 9c 6e 00 00 00 	movabs $0x6e9c,%r11
+  8021b2:	00 00 00 
+  8021b5:	4c 01 d8             	add    %r11,%rax
+  8021b8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021bf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8021c3:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8021c6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021c9:	48 63 fa             	movslq %edx,%rdi
+  8021cc:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8021d0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021d3:	48 63 d2             	movslq %edx,%rdx
+  8021d6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021da:	48 83 ec 08          	sub    $0x8,%rsp
+  8021de:	6a 00                	push   $0x0
+  8021e0:	49 89 f9             	mov    %rdi,%r9
+  8021e3:	49 89 f0             	mov    %rsi,%r8
+  8021e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021eb:	bf 17 00 00 00       	mov    $0x17,%edi
+  8021f0:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  8021f7:	ff ff ff 
+  8021fa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021fe:	ff d0                	call   *%rax
+  802200:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802204:	c9                   	leave
+  802205:	c3                   	ret
+
+0000000000802206 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802206:	55                   	push   %rbp
+  802207:	48 89 e5             	mov    %rsp,%rbp
+  80220a:	48 83 ec 10          	sub    $0x10,%rsp
+  80220e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80220e <sys_ipc_recv+0x8>
+  802215:	49 bb 32 6e 00 00 00 	movabs $0x6e32,%r11
+  80221c:	00 00 00 
+  80221f:	4c 01 d8             	add    %r11,%rax
+  802222:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802226:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80222a:	6a 00                	push   $0x0
+  80222c:	6a 00                	push   $0x0
+  80222e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80223a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80223f:	be 01 00 00 00       	mov    $0x1,%esi
+  802244:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802249:	49 ba 36 8b ff ff ff 	movabs $0xffffffffffff8b36,%r10
+  802250:	ff ff ff 
+  802253:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802257:	ff d0                	call   *%rax
+  802259:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80225d:	c9                   	leave
+  80225e:	c3                   	ret
+
+000000000080225f <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  80225f:	55                   	push   %rbp
+  802260:	48 89 e5             	mov    %rsp,%rbp
+  802263:	48 83 ec 30          	sub    $0x30,%rsp
+  802267:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802267 <sys_ipc_call+0x8>
+  80226e:	49 bb d9 6d 00 00 00 	movabs $0x6dd9,%r11
+  802275:	00 00 00 
+  802278:	4c 01 d8             	add    %r11,%rax
+  80227b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80227e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802282:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802286:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802289:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80228d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802291:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802295:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802298:	4c 63 c2             	movslq %edx,%r8
+  80229b:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80229f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022a2:	48 63 d2             	movslq %edx,%rdx
+  8022a5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022a9:	ff 75 d8             	push   -0x28(%rbp)
+  8022ac:	56                   	push   %rsi
+  8022ad:	4d 89 c1             	mov    %r8,%r9
+  8022b0:	49 89 f8             	mov    %rdi,%r8
+  8022b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b8:	bf 18 00 00 00       	mov    $0x18,%edi
+  8022bd:	49 ba 36 8b ff ff ff 	movabs $0xffffffffffff8b36,%r10
+  8022c4:	ff ff ff 
+  8022c7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022cb:	ff d0                	call   *%rax
+  8022cd:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8022d1:	c9                   	leave
+  8022d2:	c3                   	ret
+
+00000000008022d3 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8022d3:	55                   	push   %rbp
+  8022d4:	48 89 e5             	mov    %rsp,%rbp
+  8022d7:	48 83 ec 30          	sub    $0x30,%rsp
+  8022db:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022db <sys_ipc_reply_recv+0x8>
+  8022e2:	49 bb 65 6d 00 00 00 	movabs $0x6d65,%r11
+  8022e9:	00 00 00 
+  8022ec:	4c 01 d8             	add    %r11,%rax
+  8022ef:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022f2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022f6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8022fa:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8022fd:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802301:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802305:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802309:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80230c:	4c 63 c2             	movslq %edx,%r8
+  80230f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802313:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802316:	48 63 d2             	movslq %edx,%rdx
+  802319:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80231d:	ff 75 d8             	push   -0x28(%rbp)
+  802320:	56                   	push   %rsi
+  802321:	4d 89 c1             	mov    %r8,%r9
+  802324:	49 89 f8             	mov    %rdi,%r8
+  802327:	be 00 00 00 00       	mov    $0x0,%esi
+  80232c:	bf 19 00 00 00       	mov    $0x19,%edi
+  802331:	49 ba 36 8b ff ff ff 	movabs $0xffffffffffff8b36,%r10
+  802338:	ff ff ff 
+  80233b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80233f:	ff d0                	call   *%rax
+  802341:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802345:	c9                   	leave
+  802346:	c3                   	ret
+
+0000000000802347 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802347:	55                   	push   %rbp
+  802348:	48 89 e5             	mov    %rsp,%rbp
+  80234b:	48 83 ec 10          	sub    $0x10,%rsp
+  80234f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80234f <sys_env_set_priority+0x8>
+  802356:	49 bb f1 6c 00 00 00 	movabs $0x6cf1,%r11
+  80235d:	00 00 00 
+  802360:	4c 01 d8             	add    %r11,%rax
+  802363:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802366:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802369:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80236c:	48 63 ca             	movslq %edx,%rcx
+  80236f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802372:	48 63 d2             	movslq %edx,%rdx
+  802375:	48 83 ec 08          	sub    $0x8,%rsp
+  802379:	6a 00                	push   $0x0
+  80237b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802381:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802387:	be 01 00 00 00       	mov    $0x1,%esi
+  80238c:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802391:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  802398:	ff ff ff 
+  80239b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80239f:	ff d0                	call   *%rax
+  8023a1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a5:	c9                   	leave
+  8023a6:	c3                   	ret
+
+00000000008023a7 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8023a7:	55                   	push   %rbp
+  8023a8:	48 89 e5             	mov    %rsp,%rbp
+  8023ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8023af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023af <sys_env_set_affinity+0x8>
+  8023b6:	49 bb 91 6c 00 00 00 	movabs $0x6c91,%r11
+  8023bd:	00 00 00 
+  8023c0:	4c 01 d8             	add    %r11,%rax
+  8023c3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023c6:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8023c9:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8023cc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023cf:	48 63 d2             	movslq %edx,%rdx
+  8023d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d6:	6a 00                	push   $0x0
+  8023d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8023e9:	bf 10 00 00 00       	mov    $0x10,%edi
+  8023ee:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  8023f5:	ff ff ff 
+  8023f8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023fc:	ff d0                	call   *%rax
+  8023fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802402:	c9                   	leave
+  802403:	c3                   	ret
+
+0000000000802404 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802404:	55                   	push   %rbp
+  802405:	48 89 e5             	mov    %rsp,%rbp
+  802408:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802408 <sys_time_msec+0x4>
+  80240f:	49 bb 38 6c 00 00 00 	movabs $0x6c38,%r11
+  802416:	00 00 00 
+  802419:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80241c:	48 83 ec 08          	sub    $0x8,%rsp
+  802420:	6a 00                	push   $0x0
+  802422:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802428:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80242e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802433:	ba 00 00 00 00       	mov    $0x0,%edx
+  802438:	be 00 00 00 00       	mov    $0x0,%esi
+  80243d:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802442:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  802449:	ff ff ff 
+  80244c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802450:	ff d0                	call   *%rax
+  802452:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802456:	c9                   	leave
+  802457:	c3                   	ret
+
+0000000000802458 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802458:	55                   	push   %rbp
+  802459:	48 89 e5             	mov    %rsp,%rbp
+  80245c:	48 83 ec 10          	sub    $0x10,%rsp
+  802460:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802460 <sys_sleep_usec+0x8>
+  802467:	49 bb e0 6b 00 00 00 	movabs $0x6be0,%r11
+  80246e:	00 00 00 
+  802471:	4c 01 d8             	add    %r11,%rax
+  802474:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802478:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80247c:	48 83 ec 08          	sub    $0x8,%rsp
+  802480:	6a 00                	push   $0x0
+  802482:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802488:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80248e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802493:	be 00 00 00 00       	mov    $0x0,%esi
+  802498:	bf 11 00 00 00       	mov    $0x11,%edi
+  80249d:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  8024a4:	ff ff ff 
+  8024a7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024ab:	ff d0                	call   *%rax
+  8024ad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024b1:	c9                   	leave
+  8024b2:	c3                   	ret
+
+00000000008024b3 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8024b3:	55                   	push   %rbp
+  8024b4:	48 89 e5             	mov    %rsp,%rbp
+  8024b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8024bb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024bb <sys_page_alloc_huge+0x8>
+  8024c2:	49 bb 85 6b 00 00 00 	movabs $0x6b85,%r11
+  8024c9:	00 00 00 
+  8024cc:	4c 01 d8             	add    %r11,%rax
+  8024cf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024d6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8024d9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024dc:	48 63 f2             	movslq %edx,%rsi
+  8024df:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024e3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024e6:	48 63 d2             	movslq %edx,%rdx
+  8024e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ed:	6a 00                	push   $0x0
+  8024ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024f5:	49 89 f0             	mov    %rsi,%r8
+  8024f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8024fd:	bf 12 00 00 00       	mov    $0x12,%edi
+  802502:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  802509:	ff ff ff 
+  80250c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802510:	ff d0                	call   *%rax
+  802512:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802516:	c9                   	leave
+  802517:	c3                   	ret
+
+0000000000802518 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802518:	55                   	push   %rbp
+  802519:	48 89 e5             	mov    %rsp,%rbp
+  80251c:	48 83 ec 10          	sub    $0x10,%rsp
+  802520:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802520 <sys_page_map_batch+0x8>
+  802527:	49 bb 20 6b 00 00 00 	movabs $0x6b20,%r11
+  80252e:	00 00 00 
+  802531:	4c 01 d8             	add    %r11,%rax
+  802534:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802538:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80253c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802540:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802544:	48 83 ec 08          	sub    $0x8,%rsp
+  802548:	6a 00                	push   $0x0
+  80254a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802550:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802556:	be 01 00 00 00       	mov    $0x1,%esi
+  80255b:	bf 13 00 00 00       	mov    $0x13,%edi
+  802560:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  802567:	ff ff ff 
+  80256a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80256e:	ff d0                	call   *%rax
+  802570:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802574:	c9                   	leave
+  802575:	c3                   	ret
+
+0000000000802576 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802576:	55                   	push   %rbp
+  802577:	48 89 e5             	mov    %rsp,%rbp
+  80257a:	48 83 ec 10          	sub    $0x10,%rsp
+  80257e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80257e <sys_page_alloc_batch+0x8>
+  802585:	49 bb c2 6a 00 00 00 	movabs $0x6ac2,%r11
+  80258c:	00 00 00 
+  80258f:	4c 01 d8             	add    %r11,%rax
+  802592:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802596:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80259a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80259e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8025a6:	6a 00                	push   $0x0
+  8025a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025b4:	be 01 00 00 00       	mov    $0x1,%esi
+  8025b9:	bf 14 00 00 00       	mov    $0x14,%edi
+  8025be:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  8025c5:	ff ff ff 
+  8025c8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025cc:	ff d0                	call   *%rax
+  8025ce:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025d2:	c9                   	leave
+  8025d3:	c3                   	ret
+
+00000000008025d4 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8025d4:	55                   	push   %rbp
+  8025d5:	48 89 e5             	mov    %rsp,%rbp
+  8025d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8025dc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025dc <sys_page_unmap_batch+0x8>
+  8025e3:	49 bb 64 6a 00 00 00 	movabs $0x6a64,%r11
+  8025ea:	00 00 00 
+  8025ed:	4c 01 d8             	add    %r11,%rax
+  8025f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8025f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025fc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802600:	48 83 ec 08          	sub    $0x8,%rsp
+  802604:	6a 00                	push   $0x0
+  802606:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80260c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802612:	be 01 00 00 00       	mov    $0x1,%esi
+  802617:	bf 15 00 00 00       	mov    $0x15,%edi
+  80261c:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  802623:	ff ff ff 
+  802626:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80262a:	ff d0                	call   *%rax
+  80262c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802630:	c9                   	leave
+  802631:	c3                   	ret
+
+0000000000802632 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802632:	55                   	push   %rbp
+  802633:	48 89 e5             	mov    %rsp,%rbp
+  802636:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802636 <sys_fork+0x4>
+  80263d:	49 bb 0a 6a 00 00 00 	movabs $0x6a0a,%r11
+  802644:	00 00 00 
+  802647:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80264a:	48 83 ec 08          	sub    $0x8,%rsp
+  80264e:	6a 00                	push   $0x0
+  802650:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802656:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80265c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802661:	ba 00 00 00 00       	mov    $0x0,%edx
+  802666:	be 00 00 00 00       	mov    $0x0,%esi
+  80266b:	bf 16 00 00 00       	mov    $0x16,%edi
+  802670:	49 ba 7c 8a ff ff ff 	movabs $0xffffffffffff8a7c,%r10
+  802677:	ff ff ff 
+  80267a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80267e:	ff d0                	call   *%rax
+  802680:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802684:	c9                   	leave
+  802685:	c3                   	ret
+
+0000000000802686 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802686:	55                   	push   %rbp
+  802687:	48 89 e5             	mov    %rsp,%rbp
+  80268a:	41 57                	push   %r15
+  80268c:	53                   	push   %rbx
+  80268d:	48 83 ec 40          	sub    $0x40,%rsp
+  802691:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802691 <pgfault+0xb>
+  802698:	49 bb af 69 00 00 00 	movabs $0x69af,%r11
+  80269f:	00 00 00 
+  8026a2:	4c 01 db             	add    %r11,%rbx
+  8026a5:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  8026a9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8026ad:	48 8b 00             	mov    (%rax),%rax
+  8026b0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  8026b4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8026b8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8026bc:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  8026bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026c3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8026c7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026cb:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8026d1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  8026d5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8026d8:	83 e0 02             	and    $0x2,%eax
+  8026db:	85 c0                	test   %eax,%eax
+  8026dd:	0f 84 91 03 00 00    	je     802a74 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8026e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026e7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8026eb:	48 89 c2             	mov    %rax,%rdx
+  8026ee:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8026f5:	ff ff ff 
+  8026f8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8026fc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802700:	83 e0 01             	and    $0x1,%eax
+  802703:	48 85 c0             	test   %rax,%rax
+  802706:	0f 84 a7 01 00 00    	je     8028b3 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  80270c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802710:	48 c1 e8 15          	shr    $0x15,%rax
+  802714:	48 89 c2             	mov    %rax,%rdx
+  802717:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80271e:	ff ff ff 
+  802721:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802725:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802729:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  80272e:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802734:	0f 85 79 01 00 00    	jne    8028b3 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  80273a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80273e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802742:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802746:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  80274c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802750:	ba 07 00 00 00       	mov    $0x7,%edx
+  802755:	be 00 00 60 00       	mov    $0x600000,%esi
+  80275a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80275f:	49 89 df             	mov    %rbx,%r15
+  802762:	48 b8 73 94 ff ff ff 	movabs $0xffffffffffff9473,%rax
+  802769:	ff ff ff 
+  80276c:	48 01 d8             	add    %rbx,%rax
+  80276f:	ff d0                	call   *%rax
+  802771:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802774:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802778:	79 44                	jns    8027be <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  80277a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80277d:	89 c1                	mov    %eax,%ecx
+  80277f:	48 b8 20 e1 ff ff ff 	movabs $0xffffffffffffe120,%rax
+  802786:	ff ff ff 
+  802789:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80278d:	48 89 c2             	mov    %rax,%rdx
+  802790:	be 20 00 00 00       	mov    $0x20,%esi
+  802795:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  80279c:	ff ff ff 
+  80279f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8027a3:	48 89 c7             	mov    %rax,%rdi
+  8027a6:	49 89 df             	mov    %rbx,%r15
+  8027a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ae:	49 b8 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%r8
+  8027b5:	ff ff ff 
+  8027b8:	49 01 d8             	add    %rbx,%r8
+  8027bb:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  8027be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027c2:	ba 00 00 20 00       	mov    $0x200000,%edx
+  8027c7:	48 89 c6             	mov    %rax,%rsi
+  8027ca:	bf 00 00 60 00       	mov    $0x600000,%edi
+  8027cf:	49 89 df             	mov    %rbx,%r15
+  8027d2:	48 b8 ec 86 ff ff ff 	movabs $0xffffffffffff86ec,%rax
+  8027d9:	ff ff ff 
+  8027dc:	48 01 d8             	add    %rbx,%rax
+  8027df:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  8027e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8027e5:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8027eb:	48 89 c1             	mov    %rax,%rcx
+  8027ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f3:	be 00 00 60 00       	mov    $0x600000,%esi
+  8027f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027fd:	49 89 df             	mov    %rbx,%r15
+  802800:	48 b8 02 8f ff ff ff 	movabs $0xffffffffffff8f02,%rax
+  802807:	ff ff ff 
+  80280a:	48 01 d8             	add    %rbx,%rax
+  80280d:	ff d0                	call   *%rax
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	74 3e                	je     802851 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802813:	48 b8 4b e1 ff ff ff 	movabs $0xffffffffffffe14b,%rax
+  80281a:	ff ff ff 
+  80281d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802821:	48 89 c2             	mov    %rax,%rdx
+  802824:	be 23 00 00 00       	mov    $0x23,%esi
+  802829:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  802830:	ff ff ff 
+  802833:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802837:	48 89 c7             	mov    %rax,%rdi
+  80283a:	49 89 df             	mov    %rbx,%r15
+  80283d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802842:	48 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%rcx
+  802849:	ff ff ff 
+  80284c:	48 01 d9             	add    %rbx,%rcx
+  80284f:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802851:	be 00 00 60 00       	mov    $0x600000,%esi
+  802856:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285b:	49 89 df             	mov    %rbx,%r15
+  80285e:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  802865:	ff ff ff 
+  802868:	48 01 d8             	add    %rbx,%rax
+  80286b:	ff d0                	call   *%rax
+  80286d:	85 c0                	test   %eax,%eax
+  80286f:	0f 84 3d 02 00 00    	je     802ab2 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802875:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  80287c:	ff ff ff 
+  80287f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802883:	48 89 c2             	mov    %rax,%rdx
+  802886:	be 25 00 00 00       	mov    $0x25,%esi
+  80288b:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  802892:	ff ff ff 
+  802895:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802899:	48 89 c7             	mov    %rax,%rdi
+  80289c:	49 89 df             	mov    %rbx,%r15
+  80289f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a4:	48 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%rcx
+  8028ab:	ff ff ff 
+  8028ae:	48 01 d9             	add    %rbx,%rcx
+  8028b1:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  8028b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028b7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8028bb:	48 89 c2             	mov    %rax,%rdx
+  8028be:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8028c5:	ff ff ff 
+  8028c8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8028cc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028d0:	25 00 08 00 00       	and    $0x800,%eax
+  8028d5:	48 85 c0             	test   %rax,%rax
+  8028d8:	0f 84 58 01 00 00    	je     802a36 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  8028de:	ba 07 00 00 00       	mov    $0x7,%edx
+  8028e3:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8028e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ed:	49 89 df             	mov    %rbx,%r15
+  8028f0:	48 b8 9d 8e ff ff ff 	movabs $0xffffffffffff8e9d,%rax
+  8028f7:	ff ff ff 
+  8028fa:	48 01 d8             	add    %rbx,%rax
+  8028fd:	ff d0                	call   *%rax
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	74 3e                	je     802941 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802903:	48 b8 77 e1 ff ff ff 	movabs $0xffffffffffffe177,%rax
+  80290a:	ff ff ff 
+  80290d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802911:	48 89 c2             	mov    %rax,%rdx
+  802914:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802919:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  802920:	ff ff ff 
+  802923:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802927:	48 89 c7             	mov    %rax,%rdi
+  80292a:	49 89 df             	mov    %rbx,%r15
+  80292d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802932:	48 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%rcx
+  802939:	ff ff ff 
+  80293c:	48 01 d9             	add    %rbx,%rcx
+  80293f:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802941:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802945:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80294a:	48 89 c6             	mov    %rax,%rsi
+  80294d:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802952:	49 89 df             	mov    %rbx,%r15
+  802955:	48 b8 ec 86 ff ff ff 	movabs $0xffffffffffff86ec,%rax
+  80295c:	ff ff ff 
+  80295f:	48 01 d8             	add    %rbx,%rax
+  802962:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802964:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802968:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80296e:	48 89 c1             	mov    %rax,%rcx
+  802971:	ba 00 00 00 00       	mov    $0x0,%edx
+  802976:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  80297b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802980:	49 89 df             	mov    %rbx,%r15
+  802983:	48 b8 02 8f ff ff ff 	movabs $0xffffffffffff8f02,%rax
+  80298a:	ff ff ff 
+  80298d:	48 01 d8             	add    %rbx,%rax
+  802990:	ff d0                	call   *%rax
+  802992:	85 c0                	test   %eax,%eax
+  802994:	74 3e                	je     8029d4 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802996:	48 b8 4b e1 ff ff ff 	movabs $0xffffffffffffe14b,%rax
+  80299d:	ff ff ff 
+  8029a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029a4:	48 89 c2             	mov    %rax,%rdx
+  8029a7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8029ac:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  8029b3:	ff ff ff 
+  8029b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029ba:	48 89 c7             	mov    %rax,%rdi
+  8029bd:	49 89 df             	mov    %rbx,%r15
+  8029c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c5:	48 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%rcx
+  8029cc:	ff ff ff 
+  8029cf:	48 01 d9             	add    %rbx,%rcx
+  8029d2:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  8029d4:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  8029d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029de:	49 89 df             	mov    %rbx,%r15
+  8029e1:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  8029e8:	ff ff ff 
+  8029eb:	48 01 d8             	add    %rbx,%rax
+  8029ee:	ff d0                	call   *%rax
+  8029f0:	85 c0                	test   %eax,%eax
+  8029f2:	0f 84 bb 00 00 00    	je     802ab3 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  8029f8:	48 b8 60 e1 ff ff ff 	movabs $0xffffffffffffe160,%rax
+  8029ff:	ff ff ff 
+  802a02:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a06:	48 89 c2             	mov    %rax,%rdx
+  802a09:	be 32 00 00 00       	mov    $0x32,%esi
+  802a0e:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  802a15:	ff ff ff 
+  802a18:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a1c:	48 89 c7             	mov    %rax,%rdi
+  802a1f:	49 89 df             	mov    %rbx,%r15
+  802a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a27:	48 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%rcx
+  802a2e:	ff ff ff 
+  802a31:	48 01 d9             	add    %rbx,%rcx
+  802a34:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802a36:	48 b8 90 e1 ff ff ff 	movabs $0xffffffffffffe190,%rax
+  802a3d:	ff ff ff 
+  802a40:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a44:	48 89 c2             	mov    %rax,%rdx
+  802a47:	be 36 00 00 00       	mov    $0x36,%esi
+  802a4c:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  802a53:	ff ff ff 
+  802a56:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a5a:	48 89 c7             	mov    %rax,%rdi
+  802a5d:	49 89 df             	mov    %rbx,%r15
+  802a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a65:	48 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%rcx
+  802a6c:	ff ff ff 
+  802a6f:	48 01 d9             	add    %rbx,%rcx
+  802a72:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802a74:	48 b8 af e1 ff ff ff 	movabs $0xffffffffffffe1af,%rax
+  802a7b:	ff ff ff 
+  802a7e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a82:	48 89 c2             	mov    %rax,%rdx
+  802a85:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802a8a:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  802a91:	ff ff ff 
+  802a94:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a98:	48 89 c7             	mov    %rax,%rdi
+  802a9b:	49 89 df             	mov    %rbx,%r15
+  802a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa3:	48 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%rcx
+  802aaa:	ff ff ff 
+  802aad:	48 01 d9             	add    %rbx,%rcx
+  802ab0:	ff d1                	call   *%rcx
+			return;
+  802ab2:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802ab3:	48 83 c4 40          	add    $0x40,%rsp
+  802ab7:	5b                   	pop    %rbx
+  802ab8:	41 5f                	pop    %r15
+  802aba:	5d                   	pop    %rbp
+  802abb:	c3                   	ret
+
+0000000000802abc <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802abc:	55                   	push   %rbp
+  802abd:	48 89 e5             	mov    %rsp,%rbp
+  802ac0:	41 57                	push   %r15
+  802ac2:	53                   	push   %rbx
+  802ac3:	48 83 ec 10          	sub    $0x10,%rsp
+  802ac7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ac7 <fork_flush+0xb>
+  802ace:	49 bb 79 65 00 00 00 	movabs $0x6579,%r11
+  802ad5:	00 00 00 
+  802ad8:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802adb:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ae2:	00 00 00 
+  802ae5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ae9:	48 85 c0             	test   %rax,%rax
+  802aec:	0f 84 81 00 00 00    	je     802b73 <fork_flush+0xb7>
+  802af2:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802af9:	00 00 00 
+  802afc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b00:	48 89 c6             	mov    %rax,%rsi
+  802b03:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802b0a:	00 00 00 
+  802b0d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b11:	48 89 c7             	mov    %rax,%rdi
+  802b14:	49 89 df             	mov    %rbx,%r15
+  802b17:	48 b8 d8 94 ff ff ff 	movabs $0xffffffffffff94d8,%rax
+  802b1e:	ff ff ff 
+  802b21:	48 01 d8             	add    %rbx,%rax
+  802b24:	ff d0                	call   *%rax
+  802b26:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802b2d:	79 44                	jns    802b73 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802b2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b32:	89 c1                	mov    %eax,%ecx
+  802b34:	48 b8 c8 e1 ff ff ff 	movabs $0xffffffffffffe1c8,%rax
+  802b3b:	ff ff ff 
+  802b3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b42:	48 89 c2             	mov    %rax,%rdx
+  802b45:	be 56 00 00 00       	mov    $0x56,%esi
+  802b4a:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  802b51:	ff ff ff 
+  802b54:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b58:	48 89 c7             	mov    %rax,%rdi
+  802b5b:	49 89 df             	mov    %rbx,%r15
+  802b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b63:	49 b8 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%r8
+  802b6a:	ff ff ff 
+  802b6d:	49 01 d8             	add    %rbx,%r8
+  802b70:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802b73:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802b7a:	00 00 00 
+  802b7d:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802b84:	00 
+}
+  802b85:	90                   	nop
+  802b86:	48 83 c4 10          	add    $0x10,%rsp
+  802b8a:	5b                   	pop    %rbx
+  802b8b:	41 5f                	pop    %r15
+  802b8d:	5d                   	pop    %rbp
+  802b8e:	c3                   	ret
+
+0000000000802b8f <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802b8f:	55                   	push   %rbp
+  802b90:	48 89 e5             	mov    %rsp,%rbp
+  802b93:	53                   	push   %rbx
+  802b94:	48 83 ec 28          	sub    $0x28,%rsp
+  802b98:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802b98 <fork_map+0x9>
+  802b9f:	49 bb a8 64 00 00 00 	movabs $0x64a8,%r11
+  802ba6:	00 00 00 
+  802ba9:	4c 01 db             	add    %r11,%rbx
+  802bac:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802baf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802bb3:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802bb6:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802bbd:	00 00 00 
+  802bc0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bc4:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802bca:	75 10                	jne    802bdc <fork_map+0x4d>
+		fork_flush();
+  802bcc:	48 b8 7c 9a ff ff ff 	movabs $0xffffffffffff9a7c,%rax
+  802bd3:	ff ff ff 
+  802bd6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bda:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802bdc:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802be3:	00 00 00 
+  802be6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bea:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802bee:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802bf5:	00 00 00 
+  802bf8:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802bfc:	48 c1 e0 05          	shl    $0x5,%rax
+  802c00:	48 89 c2             	mov    %rax,%rdx
+  802c03:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802c0a:	00 00 00 
+  802c0d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c11:	48 01 d0             	add    %rdx,%rax
+  802c14:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802c18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c1c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802c22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c26:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c2a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802c2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c32:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802c35:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802c38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c3c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c40:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802c44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c48:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802c4b:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802c4e:	90                   	nop
+  802c4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c53:	c9                   	leave
+  802c54:	c3                   	ret
+
+0000000000802c55 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802c55:	55                   	push   %rbp
+  802c56:	48 89 e5             	mov    %rsp,%rbp
+  802c59:	53                   	push   %rbx
+  802c5a:	48 83 ec 28          	sub    $0x28,%rsp
+  802c5e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c5e <duppage+0x9>
+  802c65:	49 bb e2 63 00 00 00 	movabs $0x63e2,%r11
+  802c6c:	00 00 00 
+  802c6f:	4c 01 db             	add    %r11,%rbx
+  802c72:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c75:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802c78:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802c7b:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c7f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802c83:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802c8a:	ff ff ff 
+  802c8d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c91:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802c94:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c98:	25 00 04 00 00       	and    $0x400,%eax
+  802c9d:	48 85 c0             	test   %rax,%rax
+  802ca0:	74 42                	je     802ce4 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802ca2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ca9:	ff ff ff 
+  802cac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cb0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802cb3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cb7:	25 07 0e 00 00       	and    $0xe07,%eax
+  802cbc:	89 c2                	mov    %eax,%edx
+  802cbe:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802cc2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802cc5:	48 89 ce             	mov    %rcx,%rsi
+  802cc8:	89 c7                	mov    %eax,%edi
+  802cca:	48 b8 4f 9b ff ff ff 	movabs $0xffffffffffff9b4f,%rax
+  802cd1:	ff ff ff 
+  802cd4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cd8:	ff d0                	call   *%rax
+		return 0;
+  802cda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cdf:	e9 ae 00 00 00       	jmp    802d92 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802ce4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ceb:	ff ff ff 
+  802cee:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cf2:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802cf5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cf9:	83 e0 02             	and    $0x2,%eax
+  802cfc:	48 85 c0             	test   %rax,%rax
+  802cff:	75 1f                	jne    802d20 <duppage+0xcb>
+  802d01:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802d08:	ff ff ff 
+  802d0b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d0f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802d12:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d16:	25 00 08 00 00       	and    $0x800,%eax
+  802d1b:	48 85 c0             	test   %rax,%rax
+  802d1e:	74 4c                	je     802d6c <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  802d20:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  802d27:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802d2a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d2e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d31:	48 89 ce             	mov    %rcx,%rsi
+  802d34:	89 c7                	mov    %eax,%edi
+  802d36:	48 b8 4f 9b ff ff ff 	movabs $0xffffffffffff9b4f,%rax
+  802d3d:	ff ff ff 
+  802d40:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d44:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  802d46:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802d49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d4d:	48 89 c6             	mov    %rax,%rsi
+  802d50:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d55:	48 b8 4f 9b ff ff ff 	movabs $0xffffffffffff9b4f,%rax
+  802d5c:	ff ff ff 
+  802d5f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d63:	ff d0                	call   *%rax
+		return 0;
+  802d65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d6a:	eb 26                	jmp    802d92 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  802d6c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d70:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d73:	ba 05 00 00 00       	mov    $0x5,%edx
+  802d78:	48 89 ce             	mov    %rcx,%rsi
+  802d7b:	89 c7                	mov    %eax,%edi
+  802d7d:	48 b8 4f 9b ff ff ff 	movabs $0xffffffffffff9b4f,%rax
+  802d84:	ff ff ff 
+  802d87:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d8b:	ff d0                	call   *%rax
+		return 0;
+  802d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  802d92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d96:	c9                   	leave
+  802d97:	c3                   	ret
+
+0000000000802d98 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  802d98:	55                   	push   %rbp
+  802d99:	48 89 e5             	mov    %rsp,%rbp
+  802d9c:	53                   	push   %rbx
+  802d9d:	48 83 ec 28          	sub    $0x28,%rsp
+  802da1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802da1 <duphuge+0x9>
+  802da8:	49 bb 9f 62 00 00 00 	movabs $0x629f,%r11
+  802daf:	00 00 00 
+  802db2:	4c 01 db             	add    %r11,%rbx
+  802db5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802db8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  802dbc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802dc0:	48 c1 e8 15          	shr    $0x15,%rax
+  802dc4:	48 89 c2             	mov    %rax,%rdx
+  802dc7:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802dce:	ff ff ff 
+  802dd1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802dd5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802dd9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  802ddd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802de1:	25 00 04 00 00       	and    $0x400,%eax
+  802de6:	48 85 c0             	test   %rax,%rax
+  802de9:	74 0e                	je     802df9 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  802deb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802def:	25 07 0e 00 00       	and    $0xe07,%eax
+  802df4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802df7:	eb 1e                	jmp    802e17 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  802df9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802dfd:	25 02 08 00 00       	and    $0x802,%eax
+  802e02:	48 85 c0             	test   %rax,%rax
+  802e05:	74 09                	je     802e10 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  802e07:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  802e0e:	eb 07                	jmp    802e17 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  802e10:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  802e17:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e1a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802e1e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e21:	48 89 ce             	mov    %rcx,%rsi
+  802e24:	89 c7                	mov    %eax,%edi
+  802e26:	48 b8 4f 9b ff ff ff 	movabs $0xffffffffffff9b4f,%rax
+  802e2d:	ff ff ff 
+  802e30:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e34:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  802e36:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e39:	25 00 08 00 00       	and    $0x800,%eax
+  802e3e:	85 c0                	test   %eax,%eax
+  802e40:	74 1f                	je     802e61 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  802e42:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e45:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e49:	48 89 c6             	mov    %rax,%rsi
+  802e4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e51:	48 b8 4f 9b ff ff ff 	movabs $0xffffffffffff9b4f,%rax
+  802e58:	ff ff ff 
+  802e5b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e5f:	ff d0                	call   *%rax
+	return 0;
+  802e61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e6a:	c9                   	leave
+  802e6b:	c3                   	ret
+
+0000000000802e6c <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  802e6c:	55                   	push   %rbp
+  802e6d:	48 89 e5             	mov    %rsp,%rbp
+  802e70:	41 57                	push   %r15
+  802e72:	53                   	push   %rbx
+  802e73:	48 83 ec 10          	sub    $0x10,%rsp
+  802e77:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e77 <fork+0xb>
+  802e7e:	49 bb c9 61 00 00 00 	movabs $0x61c9,%r11
+  802e85:	00 00 00 
+  802e88:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  802e8b:	49 89 df             	mov    %rbx,%r15
+  802e8e:	48 b8 f2 95 ff ff ff 	movabs $0xffffffffffff95f2,%rax
+  802e95:	ff ff ff 
+  802e98:	48 01 d8             	add    %rbx,%rax
+  802e9b:	ff d0                	call   *%rax
+  802e9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ea0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ea4:	75 42                	jne    802ee8 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  802ea6:	49 89 df             	mov    %rbx,%r15
+  802ea9:	48 b8 f4 8d ff ff ff 	movabs $0xffffffffffff8df4,%rax
+  802eb0:	ff ff ff 
+  802eb3:	48 01 d8             	add    %rbx,%rax
+  802eb6:	ff d0                	call   *%rax
+  802eb8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ebd:	48 98                	cltq
+  802ebf:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  802ec6:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  802ecd:	ff ff ff 
+  802ed0:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  802ed4:	48 01 c2             	add    %rax,%rdx
+  802ed7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  802ede:	ff ff ff 
+  802ee1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ee5:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  802ee8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802eeb:	48 83 c4 10          	add    $0x10,%rsp
+  802eef:	5b                   	pop    %rbx
+  802ef0:	41 5f                	pop    %r15
+  802ef2:	5d                   	pop    %rbp
+  802ef3:	c3                   	ret
+
+0000000000802ef4 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  802ef4:	55                   	push   %rbp
+  802ef5:	48 89 e5             	mov    %rsp,%rbp
+  802ef8:	41 57                	push   %r15
+  802efa:	53                   	push   %rbx
+  802efb:	48 83 ec 10          	sub    $0x10,%rsp
+  802eff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802eff <ufork+0xb>
+  802f06:	49 bb 41 61 00 00 00 	movabs $0x6141,%r11
+  802f0d:	00 00 00 
+  802f10:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  802f13:	48 b8 46 96 ff ff ff 	movabs $0xffffffffffff9646,%rax
+  802f1a:	ff ff ff 
+  802f1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f21:	48 89 c7             	mov    %rax,%rdi
+  802f24:	49 89 df             	mov    %rbx,%r15
+  802f27:	48 b8 34 d2 ff ff ff 	movabs $0xffffffffffffd234,%rax
+  802f2e:	ff ff ff 
+  802f31:	48 01 d8             	add    %rbx,%rax
+  802f34:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  802f36:	b8 07 00 00 00       	mov    $0x7,%eax
+  802f3b:	cd 30                	int    $0x30
+  802f3d:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  802f40:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  802f43:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  802f46:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802f4a:	0f 84 03 02 00 00    	je     803153 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  802f50:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  802f57:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  802f58:	e9 28 01 00 00       	jmp    803085 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  802f5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f61:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f65:	48 89 c2             	mov    %rax,%rdx
+  802f68:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802f6f:	ff ff ff 
+  802f72:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f76:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f7a:	83 e0 01             	and    $0x1,%eax
+  802f7d:	48 85 c0             	test   %rax,%rax
+  802f80:	0f 84 f7 00 00 00    	je     80307d <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  802f86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f8a:	48 c1 e8 15          	shr    $0x15,%rax
+  802f8e:	48 89 c2             	mov    %rax,%rdx
+  802f91:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802f98:	ff ff ff 
+  802f9b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f9f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fa3:	25 81 00 00 00       	and    $0x81,%eax
+  802fa8:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  802fae:	75 29                	jne    802fd9 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  802fb0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802fb4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802fb7:	48 89 d6             	mov    %rdx,%rsi
+  802fba:	89 c7                	mov    %eax,%edi
+  802fbc:	48 b8 58 9d ff ff ff 	movabs $0xffffffffffff9d58,%rax
+  802fc3:	ff ff ff 
+  802fc6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fca:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  802fcc:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  802fd3:	00 
+  802fd4:	e9 ac 00 00 00       	jmp    803085 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  802fd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fdd:	48 c1 e8 15          	shr    $0x15,%rax
+  802fe1:	48 89 c2             	mov    %rax,%rdx
+  802fe4:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802feb:	ff ff ff 
+  802fee:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ff2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ff6:	83 e0 01             	and    $0x1,%eax
+  802ff9:	48 85 c0             	test   %rax,%rax
+  802ffc:	74 75                	je     803073 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  802ffe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803002:	48 c1 e8 0c          	shr    $0xc,%rax
+  803006:	48 89 c2             	mov    %rax,%rdx
+  803009:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803010:	ff ff ff 
+  803013:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803017:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80301b:	83 e0 01             	and    $0x1,%eax
+  80301e:	48 85 c0             	test   %rax,%rax
+  803021:	74 46                	je     803069 <ufork+0x175>
+  803023:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803027:	48 c1 e8 0c          	shr    $0xc,%rax
+  80302b:	48 89 c2             	mov    %rax,%rdx
+  80302e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803035:	ff ff ff 
+  803038:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80303c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803040:	83 e0 04             	and    $0x4,%eax
+  803043:	48 85 c0             	test   %rax,%rax
+  803046:	74 21                	je     803069 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  803048:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80304c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803050:	89 c2                	mov    %eax,%edx
+  803052:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803055:	89 d6                	mov    %edx,%esi
+  803057:	89 c7                	mov    %eax,%edi
+  803059:	48 b8 15 9c ff ff ff 	movabs $0xffffffffffff9c15,%rax
+  803060:	ff ff ff 
+  803063:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803067:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  803069:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803070:	00 
+  803071:	eb 12                	jmp    803085 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803073:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80307a:	00 
+  80307b:	eb 08                	jmp    803085 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  80307d:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803084:	40 
+		for (; addr < USTACKTOP;){
+  803085:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80308a:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80308e:	0f 83 c9 fe ff ff    	jae    802f5d <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803094:	48 b8 7c 9a ff ff ff 	movabs $0xffffffffffff9a7c,%rax
+  80309b:	ff ff ff 
+  80309e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030a2:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  8030a4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8030a7:	ba 07 00 00 00       	mov    $0x7,%edx
+  8030ac:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8030b1:	48 89 ce             	mov    %rcx,%rsi
+  8030b4:	89 c7                	mov    %eax,%edi
+  8030b6:	49 89 df             	mov    %rbx,%r15
+  8030b9:	48 b8 9d 8e ff ff ff 	movabs $0xffffffffffff8e9d,%rax
+  8030c0:	ff ff ff 
+  8030c3:	48 01 d8             	add    %rbx,%rax
+  8030c6:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8030c8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8030cb:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8030d2:	ff ff ff 
+  8030d5:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8030d9:	48 89 d6             	mov    %rdx,%rsi
+  8030dc:	89 c7                	mov    %eax,%edi
+  8030de:	49 89 df             	mov    %rbx,%r15
+  8030e1:	48 b8 93 90 ff ff ff 	movabs $0xffffffffffff9093,%rax
+  8030e8:	ff ff ff 
+  8030eb:	48 01 d8             	add    %rbx,%rax
+  8030ee:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8030f0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8030f3:	be 02 00 00 00       	mov    $0x2,%esi
+  8030f8:	89 c7                	mov    %eax,%edi
+  8030fa:	49 89 df             	mov    %rbx,%r15
+  8030fd:	48 b8 d4 8f ff ff ff 	movabs $0xffffffffffff8fd4,%rax
+  803104:	ff ff ff 
+  803107:	48 01 d8             	add    %rbx,%rax
+  80310a:	ff d0                	call   *%rax
+  80310c:	85 c0                	test   %eax,%eax
+  80310e:	74 3e                	je     80314e <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803110:	48 b8 ef e1 ff ff ff 	movabs $0xffffffffffffe1ef,%rax
+  803117:	ff ff ff 
+  80311a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80311e:	48 89 c2             	mov    %rax,%rdx
+  803121:	be 07 01 00 00       	mov    $0x107,%esi
+  803126:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  80312d:	ff ff ff 
+  803130:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803134:	48 89 c7             	mov    %rax,%rdi
+  803137:	49 89 df             	mov    %rbx,%r15
+  80313a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313f:	48 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%rcx
+  803146:	ff ff ff 
+  803149:	48 01 d9             	add    %rbx,%rcx
+  80314c:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  80314e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803151:	eb 59                	jmp    8031ac <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803153:	49 89 df             	mov    %rbx,%r15
+  803156:	48 b8 f4 8d ff ff ff 	movabs $0xffffffffffff8df4,%rax
+  80315d:	ff ff ff 
+  803160:	48 01 d8             	add    %rbx,%rax
+  803163:	ff d0                	call   *%rax
+  803165:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80316a:	48 98                	cltq
+  80316c:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803173:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80317a:	ff ff ff 
+  80317d:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803181:	48 01 c2             	add    %rax,%rdx
+  803184:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80318b:	ff ff ff 
+  80318e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803192:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803195:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80319c:	00 00 00 
+  80319f:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  8031a6:	00 
+		return 0;
+  8031a7:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  8031ac:	48 83 c4 10          	add    $0x10,%rsp
+  8031b0:	5b                   	pop    %rbx
+  8031b1:	41 5f                	pop    %r15
+  8031b3:	5d                   	pop    %rbp
+  8031b4:	c3                   	ret
+
+00000000008031b5 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8031b5:	55                   	push   %rbp
+  8031b6:	48 89 e5             	mov    %rsp,%rbp
+  8031b9:	41 57                	push   %r15
+  8031bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8031bf:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8031bf <sfork+0xa>
+  8031c6:	49 bb 81 5e 00 00 00 	movabs $0x5e81,%r11
+  8031cd:	00 00 00 
+  8031d0:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8031d3:	48 b8 0a e2 ff ff ff 	movabs $0xffffffffffffe20a,%rax
+  8031da:	ff ff ff 
+  8031dd:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8031e1:	48 89 c2             	mov    %rax,%rdx
+  8031e4:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8031e9:	48 b8 40 e1 ff ff ff 	movabs $0xffffffffffffe140,%rax
+  8031f0:	ff ff ff 
+  8031f3:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8031f7:	48 89 c7             	mov    %rax,%rdi
+  8031fa:	49 89 cf             	mov    %rcx,%r15
+  8031fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803202:	49 b8 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%r8
+  803209:	ff ff ff 
+  80320c:	49 01 c8             	add    %rcx,%r8
+  80320f:	41 ff d0             	call   *%r8
+
+0000000000803212 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803212:	55                   	push   %rbp
+  803213:	48 89 e5             	mov    %rsp,%rbp
+  803216:	48 83 ec 08          	sub    $0x8,%rsp
+  80321a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80321a <fd2num+0x8>
+  803221:	49 bb 26 5e 00 00 00 	movabs $0x5e26,%r11
+  803228:	00 00 00 
+  80322b:	4c 01 d8             	add    %r11,%rax
+  80322e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803232:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803236:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80323d:	ff ff ff 
+  803240:	48 01 d0             	add    %rdx,%rax
+  803243:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803247:	c9                   	leave
+  803248:	c3                   	ret
+
+0000000000803249 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803249:	55                   	push   %rbp
+  80324a:	48 89 e5             	mov    %rsp,%rbp
+  80324d:	48 83 ec 08          	sub    $0x8,%rsp
+  803251:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803251 <fd2data+0x8>
+  803258:	49 bb ef 5d 00 00 00 	movabs $0x5def,%r11
+  80325f:	00 00 00 
+  803262:	4c 01 d8             	add    %r11,%rax
+  803265:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803269:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80326d:	48 89 d7             	mov    %rdx,%rdi
+  803270:	48 ba d2 a1 ff ff ff 	movabs $0xffffffffffffa1d2,%rdx
+  803277:	ff ff ff 
+  80327a:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80327e:	ff d0                	call   *%rax
+  803280:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803286:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80328a:	c9                   	leave
+  80328b:	c3                   	ret
+
+000000000080328c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80328c:	55                   	push   %rbp
+  80328d:	48 89 e5             	mov    %rsp,%rbp
+  803290:	48 83 ec 18          	sub    $0x18,%rsp
+  803294:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803294 <fd_alloc+0x8>
+  80329b:	49 bb ac 5d 00 00 00 	movabs $0x5dac,%r11
+  8032a2:	00 00 00 
+  8032a5:	4c 01 d8             	add    %r11,%rax
+  8032a8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8032ac:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8032b3:	eb 75                	jmp    80332a <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8032b5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8032b8:	48 63 d2             	movslq %edx,%rdx
+  8032bb:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8032c2:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8032c6:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8032ca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032ce:	48 89 d1             	mov    %rdx,%rcx
+  8032d1:	48 c1 e9 15          	shr    $0x15,%rcx
+  8032d5:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8032dc:	ff ff ff 
+  8032df:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8032e3:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8032e7:	83 e2 01             	and    $0x1,%edx
+  8032ea:	48 85 d2             	test   %rdx,%rdx
+  8032ed:	74 25                	je     803314 <fd_alloc+0x88>
+  8032ef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032f3:	48 89 d1             	mov    %rdx,%rcx
+  8032f6:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8032fa:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803301:	ff ff ff 
+  803304:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803308:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80330c:	83 e2 01             	and    $0x1,%edx
+  80330f:	48 85 d2             	test   %rdx,%rdx
+  803312:	75 12                	jne    803326 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803314:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803318:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80331c:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80331f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803324:	eb 1a                	jmp    803340 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803326:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80332a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80332e:	7e 85                	jle    8032b5 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803330:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803334:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  80333b:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803340:	c9                   	leave
+  803341:	c3                   	ret
+
+0000000000803342 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803342:	55                   	push   %rbp
+  803343:	48 89 e5             	mov    %rsp,%rbp
+  803346:	48 83 ec 20          	sub    $0x20,%rsp
+  80334a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80334a <fd_lookup+0x8>
+  803351:	49 bb f6 5c 00 00 00 	movabs $0x5cf6,%r11
+  803358:	00 00 00 
+  80335b:	4c 01 d8             	add    %r11,%rax
+  80335e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803361:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803365:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803369:	78 06                	js     803371 <fd_lookup+0x2f>
+  80336b:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80336f:	7e 07                	jle    803378 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803371:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803376:	eb 73                	jmp    8033eb <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803378:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80337b:	48 63 d2             	movslq %edx,%rdx
+  80337e:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803385:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803389:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80338d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803391:	48 89 d1             	mov    %rdx,%rcx
+  803394:	48 c1 e9 15          	shr    $0x15,%rcx
+  803398:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80339f:	ff ff ff 
+  8033a2:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8033a6:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8033aa:	83 e2 01             	and    $0x1,%edx
+  8033ad:	48 85 d2             	test   %rdx,%rdx
+  8033b0:	74 22                	je     8033d4 <fd_lookup+0x92>
+  8033b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b6:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8033ba:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  8033c1:	ff ff ff 
+  8033c4:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8033c8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033cc:	83 e0 01             	and    $0x1,%eax
+  8033cf:	48 85 c0             	test   %rax,%rax
+  8033d2:	75 07                	jne    8033db <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8033d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033d9:	eb 10                	jmp    8033eb <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8033db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033df:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033e3:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8033e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033eb:	c9                   	leave
+  8033ec:	c3                   	ret
+
+00000000008033ed <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8033ed:	55                   	push   %rbp
+  8033ee:	48 89 e5             	mov    %rsp,%rbp
+  8033f1:	41 57                	push   %r15
+  8033f3:	53                   	push   %rbx
+  8033f4:	48 83 ec 30          	sub    $0x30,%rsp
+  8033f8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033f8 <fd_close+0xb>
+  8033ff:	49 bb 48 5c 00 00 00 	movabs $0x5c48,%r11
+  803406:	00 00 00 
+  803409:	4c 01 db             	add    %r11,%rbx
+  80340c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803410:	89 f0                	mov    %esi,%eax
+  803412:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803415:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803419:	48 89 c7             	mov    %rax,%rdi
+  80341c:	48 b8 d2 a1 ff ff ff 	movabs $0xffffffffffffa1d2,%rax
+  803423:	ff ff ff 
+  803426:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80342a:	ff d0                	call   *%rax
+  80342c:	89 c2                	mov    %eax,%edx
+  80342e:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803432:	48 89 c6             	mov    %rax,%rsi
+  803435:	89 d7                	mov    %edx,%edi
+  803437:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  80343e:	ff ff ff 
+  803441:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803445:	ff d0                	call   *%rax
+  803447:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80344a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80344e:	78 0a                	js     80345a <fd_close+0x6d>
+	    || fd != fd2)
+  803450:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803454:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803458:	74 12                	je     80346c <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80345a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80345e:	74 05                	je     803465 <fd_close+0x78>
+  803460:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803463:	eb 7a                	jmp    8034df <fd_close+0xf2>
+  803465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346a:	eb 73                	jmp    8034df <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80346c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803470:	8b 00                	mov    (%rax),%eax
+  803472:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803476:	48 89 d6             	mov    %rdx,%rsi
+  803479:	89 c7                	mov    %eax,%edi
+  80347b:	48 b8 a8 a4 ff ff ff 	movabs $0xffffffffffffa4a8,%rax
+  803482:	ff ff ff 
+  803485:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803489:	ff d0                	call   *%rax
+  80348b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80348e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803492:	78 2a                	js     8034be <fd_close+0xd1>
+		if (dev->dev_close)
+  803494:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803498:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80349c:	48 85 c0             	test   %rax,%rax
+  80349f:	74 16                	je     8034b7 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8034a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034a5:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034ad:	48 89 c7             	mov    %rax,%rdi
+  8034b0:	ff d2                	call   *%rdx
+  8034b2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034b5:	eb 07                	jmp    8034be <fd_close+0xd1>
+		else
+			r = 0;
+  8034b7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8034be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034c2:	48 89 c6             	mov    %rax,%rsi
+  8034c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034ca:	49 89 df             	mov    %rbx,%r15
+  8034cd:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  8034d4:	ff ff ff 
+  8034d7:	48 01 d8             	add    %rbx,%rax
+  8034da:	ff d0                	call   *%rax
+	return r;
+  8034dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8034df:	48 83 c4 30          	add    $0x30,%rsp
+  8034e3:	5b                   	pop    %rbx
+  8034e4:	41 5f                	pop    %r15
+  8034e6:	5d                   	pop    %rbp
+  8034e7:	c3                   	ret
+
+00000000008034e8 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8034e8:	55                   	push   %rbp
+  8034e9:	48 89 e5             	mov    %rsp,%rbp
+  8034ec:	41 57                	push   %r15
+  8034ee:	48 83 ec 28          	sub    $0x28,%rsp
+  8034f2:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8034f2 <dev_lookup+0xa>
+  8034f9:	49 bb 4e 5b 00 00 00 	movabs $0x5b4e,%r11
+  803500:	00 00 00 
+  803503:	4c 01 d9             	add    %r11,%rcx
+  803506:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803509:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80350d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803514:	eb 45                	jmp    80355b <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803516:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80351d:	00 00 00 
+  803520:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803523:	48 98                	cltq
+  803525:	48 01 ca             	add    %rcx,%rdx
+  803528:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80352c:	8b 00                	mov    (%rax),%eax
+  80352e:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803531:	75 24                	jne    803557 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803533:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80353a:	00 00 00 
+  80353d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803540:	48 98                	cltq
+  803542:	48 01 ca             	add    %rcx,%rdx
+  803545:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803549:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80354d:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803550:	b8 00 00 00 00       	mov    $0x0,%eax
+  803555:	eb 74                	jmp    8035cb <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803557:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80355b:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803562:	00 00 00 
+  803565:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803568:	48 98                	cltq
+  80356a:	48 01 ca             	add    %rcx,%rdx
+  80356d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803571:	48 85 c0             	test   %rax,%rax
+  803574:	75 a0                	jne    803516 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803576:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80357d:	ff ff ff 
+  803580:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803584:	48 8b 00             	mov    (%rax),%rax
+  803587:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80358d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803590:	89 c6                	mov    %eax,%esi
+  803592:	48 b8 20 e2 ff ff ff 	movabs $0xffffffffffffe220,%rax
+  803599:	ff ff ff 
+  80359c:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8035a0:	48 89 c7             	mov    %rax,%rdi
+  8035a3:	49 89 cf             	mov    %rcx,%r15
+  8035a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ab:	49 b8 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%r8
+  8035b2:	ff ff ff 
+  8035b5:	49 01 c8             	add    %rcx,%r8
+  8035b8:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8035bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035bf:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8035c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8035cb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8035cf:	c9                   	leave
+  8035d0:	c3                   	ret
+
+00000000008035d1 <close>:
+
+int
+close(int fdnum)
+{
+  8035d1:	55                   	push   %rbp
+  8035d2:	48 89 e5             	mov    %rsp,%rbp
+  8035d5:	53                   	push   %rbx
+  8035d6:	48 83 ec 28          	sub    $0x28,%rsp
+  8035da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035da <close+0x9>
+  8035e1:	49 bb 66 5a 00 00 00 	movabs $0x5a66,%r11
+  8035e8:	00 00 00 
+  8035eb:	4c 01 db             	add    %r11,%rbx
+  8035ee:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035f1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8035f5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8035f8:	48 89 d6             	mov    %rdx,%rsi
+  8035fb:	89 c7                	mov    %eax,%edi
+  8035fd:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  803604:	ff ff ff 
+  803607:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80360b:	ff d0                	call   *%rax
+  80360d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803610:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803614:	79 05                	jns    80361b <close+0x4a>
+		return r;
+  803616:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803619:	eb 1c                	jmp    803637 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  80361b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80361f:	be 01 00 00 00       	mov    $0x1,%esi
+  803624:	48 89 c7             	mov    %rax,%rdi
+  803627:	48 b8 ad a3 ff ff ff 	movabs $0xffffffffffffa3ad,%rax
+  80362e:	ff ff ff 
+  803631:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803635:	ff d0                	call   *%rax
+}
+  803637:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80363b:	c9                   	leave
+  80363c:	c3                   	ret
+
+000000000080363d <close_all>:
+
+void
+close_all(void)
+{
+  80363d:	55                   	push   %rbp
+  80363e:	48 89 e5             	mov    %rsp,%rbp
+  803641:	53                   	push   %rbx
+  803642:	48 83 ec 18          	sub    $0x18,%rsp
+  803646:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803646 <close_all+0x9>
+  80364d:	49 bb fa 59 00 00 00 	movabs $0x59fa,%r11
+  803654:	00 00 00 
+  803657:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80365a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803661:	eb 19                	jmp    80367c <close_all+0x3f>
+		close(i);
+  803663:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803666:	89 c7                	mov    %eax,%edi
+  803668:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  80366f:	ff ff ff 
+  803672:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803676:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803678:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80367c:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803680:	7e e1                	jle    803663 <close_all+0x26>
+}
+  803682:	90                   	nop
+  803683:	90                   	nop
+  803684:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803688:	c9                   	leave
+  803689:	c3                   	ret
+
+000000000080368a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80368a:	55                   	push   %rbp
+  80368b:	48 89 e5             	mov    %rsp,%rbp
+  80368e:	41 57                	push   %r15
+  803690:	53                   	push   %rbx
+  803691:	48 83 ec 40          	sub    $0x40,%rsp
+  803695:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803695 <dup+0xb>
+  80369c:	49 bb ab 59 00 00 00 	movabs $0x59ab,%r11
+  8036a3:	00 00 00 
+  8036a6:	4c 01 db             	add    %r11,%rbx
+  8036a9:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8036ac:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8036af:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8036b3:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8036b6:	48 89 d6             	mov    %rdx,%rsi
+  8036b9:	89 c7                	mov    %eax,%edi
+  8036bb:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  8036c2:	ff ff ff 
+  8036c5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036c9:	ff d0                	call   *%rax
+  8036cb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8036ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036d2:	79 08                	jns    8036dc <dup+0x52>
+		return r;
+  8036d4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036d7:	e9 a4 01 00 00       	jmp    803880 <dup+0x1f6>
+	close(newfdnum);
+  8036dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036df:	89 c7                	mov    %eax,%edi
+  8036e1:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  8036e8:	ff ff ff 
+  8036eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036ef:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8036f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036f4:	48 98                	cltq
+  8036f6:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8036fc:	48 c1 e0 0c          	shl    $0xc,%rax
+  803700:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803704:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803708:	48 89 c7             	mov    %rax,%rdi
+  80370b:	48 b8 09 a2 ff ff ff 	movabs $0xffffffffffffa209,%rax
+  803712:	ff ff ff 
+  803715:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803719:	ff d0                	call   *%rax
+  80371b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  80371f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803723:	48 89 c7             	mov    %rax,%rdi
+  803726:	48 b8 09 a2 ff ff ff 	movabs $0xffffffffffffa209,%rax
+  80372d:	ff ff ff 
+  803730:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803734:	ff d0                	call   *%rax
+  803736:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80373a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80373e:	48 c1 e8 15          	shr    $0x15,%rax
+  803742:	48 89 c2             	mov    %rax,%rdx
+  803745:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80374c:	ff ff ff 
+  80374f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803753:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803757:	83 e0 01             	and    $0x1,%eax
+  80375a:	48 85 c0             	test   %rax,%rax
+  80375d:	74 7f                	je     8037de <dup+0x154>
+  80375f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803763:	48 c1 e8 0c          	shr    $0xc,%rax
+  803767:	48 89 c2             	mov    %rax,%rdx
+  80376a:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803771:	ff ff ff 
+  803774:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803778:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80377c:	83 e0 01             	and    $0x1,%eax
+  80377f:	48 85 c0             	test   %rax,%rax
+  803782:	74 5a                	je     8037de <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803784:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803788:	48 c1 e8 0c          	shr    $0xc,%rax
+  80378c:	48 89 c2             	mov    %rax,%rdx
+  80378f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803796:	ff ff ff 
+  803799:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80379d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037a1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8037a6:	89 c1                	mov    %eax,%ecx
+  8037a8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8037ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037b0:	41 89 c8             	mov    %ecx,%r8d
+  8037b3:	48 89 d1             	mov    %rdx,%rcx
+  8037b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037bb:	48 89 c6             	mov    %rax,%rsi
+  8037be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037c3:	49 89 df             	mov    %rbx,%r15
+  8037c6:	48 b8 02 8f ff ff ff 	movabs $0xffffffffffff8f02,%rax
+  8037cd:	ff ff ff 
+  8037d0:	48 01 d8             	add    %rbx,%rax
+  8037d3:	ff d0                	call   *%rax
+  8037d5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037dc:	78 5f                	js     80383d <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8037de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037e2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037e6:	48 89 c2             	mov    %rax,%rdx
+  8037e9:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8037f0:	ff ff ff 
+  8037f3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037f7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037fb:	25 07 0e 00 00       	and    $0xe07,%eax
+  803800:	89 c1                	mov    %eax,%ecx
+  803802:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803806:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80380a:	41 89 c8             	mov    %ecx,%r8d
+  80380d:	48 89 d1             	mov    %rdx,%rcx
+  803810:	ba 00 00 00 00       	mov    $0x0,%edx
+  803815:	48 89 c6             	mov    %rax,%rsi
+  803818:	bf 00 00 00 00       	mov    $0x0,%edi
+  80381d:	49 89 df             	mov    %rbx,%r15
+  803820:	48 b8 02 8f ff ff ff 	movabs $0xffffffffffff8f02,%rax
+  803827:	ff ff ff 
+  80382a:	48 01 d8             	add    %rbx,%rax
+  80382d:	ff d0                	call   *%rax
+  80382f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803832:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803836:	78 08                	js     803840 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803838:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80383b:	eb 43                	jmp    803880 <dup+0x1f6>
+			goto err;
+  80383d:	90                   	nop
+  80383e:	eb 01                	jmp    803841 <dup+0x1b7>
+		goto err;
+  803840:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803841:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803845:	48 89 c6             	mov    %rax,%rsi
+  803848:	bf 00 00 00 00       	mov    $0x0,%edi
+  80384d:	49 89 df             	mov    %rbx,%r15
+  803850:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  803857:	ff ff ff 
+  80385a:	48 01 d8             	add    %rbx,%rax
+  80385d:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  80385f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803863:	48 89 c6             	mov    %rax,%rsi
+  803866:	bf 00 00 00 00       	mov    $0x0,%edi
+  80386b:	49 89 df             	mov    %rbx,%r15
+  80386e:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  803875:	ff ff ff 
+  803878:	48 01 d8             	add    %rbx,%rax
+  80387b:	ff d0                	call   *%rax
+	return r;
+  80387d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803880:	48 83 c4 40          	add    $0x40,%rsp
+  803884:	5b                   	pop    %rbx
+  803885:	41 5f                	pop    %r15
+  803887:	5d                   	pop    %rbp
+  803888:	c3                   	ret
+
+0000000000803889 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803889:	55                   	push   %rbp
+  80388a:	48 89 e5             	mov    %rsp,%rbp
+  80388d:	41 57                	push   %r15
+  80388f:	53                   	push   %rbx
+  803890:	48 83 ec 40          	sub    $0x40,%rsp
+  803894:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803894 <read+0xb>
+  80389b:	49 bb ac 57 00 00 00 	movabs $0x57ac,%r11
+  8038a2:	00 00 00 
+  8038a5:	4c 01 db             	add    %r11,%rbx
+  8038a8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8038ab:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8038af:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8038b3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8038b7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8038ba:	48 89 d6             	mov    %rdx,%rsi
+  8038bd:	89 c7                	mov    %eax,%edi
+  8038bf:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  8038c6:	ff ff ff 
+  8038c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038cd:	ff d0                	call   *%rax
+  8038cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038d6:	78 28                	js     803900 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8038d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8038dc:	8b 00                	mov    (%rax),%eax
+  8038de:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8038e2:	48 89 d6             	mov    %rdx,%rsi
+  8038e5:	89 c7                	mov    %eax,%edi
+  8038e7:	48 b8 a8 a4 ff ff ff 	movabs $0xffffffffffffa4a8,%rax
+  8038ee:	ff ff ff 
+  8038f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038f5:	ff d0                	call   *%rax
+  8038f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8038fe:	79 08                	jns    803908 <read+0x7f>
+		return r;
+  803900:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803903:	e9 8b 00 00 00       	jmp    803993 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803908:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80390c:	8b 40 08             	mov    0x8(%rax),%eax
+  80390f:	83 e0 03             	and    $0x3,%eax
+  803912:	83 f8 01             	cmp    $0x1,%eax
+  803915:	75 4b                	jne    803962 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803917:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80391e:	ff ff ff 
+  803921:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803925:	48 8b 00             	mov    (%rax),%rax
+  803928:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80392e:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803931:	89 c6                	mov    %eax,%esi
+  803933:	48 b8 3f e2 ff ff ff 	movabs $0xffffffffffffe23f,%rax
+  80393a:	ff ff ff 
+  80393d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803941:	48 89 c7             	mov    %rax,%rdi
+  803944:	49 89 df             	mov    %rbx,%r15
+  803947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394c:	48 b9 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rcx
+  803953:	ff ff ff 
+  803956:	48 01 d9             	add    %rbx,%rcx
+  803959:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80395b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803960:	eb 31                	jmp    803993 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803962:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803966:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80396a:	48 85 c0             	test   %rax,%rax
+  80396d:	75 07                	jne    803976 <read+0xed>
+		return -E_NOT_SUPP;
+  80396f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803974:	eb 1d                	jmp    803993 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803976:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80397a:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80397e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803982:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803986:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80398a:	48 89 ce             	mov    %rcx,%rsi
+  80398d:	48 89 c7             	mov    %rax,%rdi
+  803990:	41 ff d0             	call   *%r8
+}
+  803993:	48 83 c4 40          	add    $0x40,%rsp
+  803997:	5b                   	pop    %rbx
+  803998:	41 5f                	pop    %r15
+  80399a:	5d                   	pop    %rbp
+  80399b:	c3                   	ret
+
+000000000080399c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80399c:	55                   	push   %rbp
+  80399d:	48 89 e5             	mov    %rsp,%rbp
+  8039a0:	53                   	push   %rbx
+  8039a1:	48 83 ec 38          	sub    $0x38,%rsp
+  8039a5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039a5 <readn+0x9>
+  8039ac:	49 bb 9b 56 00 00 00 	movabs $0x569b,%r11
+  8039b3:	00 00 00 
+  8039b6:	4c 01 db             	add    %r11,%rbx
+  8039b9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039bc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8039c0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8039c4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8039cb:	eb 4b                	jmp    803a18 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8039cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039d0:	48 98                	cltq
+  8039d2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8039d6:	48 29 c2             	sub    %rax,%rdx
+  8039d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039dc:	48 63 c8             	movslq %eax,%rcx
+  8039df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039e3:	48 01 c1             	add    %rax,%rcx
+  8039e6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039e9:	48 89 ce             	mov    %rcx,%rsi
+  8039ec:	89 c7                	mov    %eax,%edi
+  8039ee:	48 b8 49 a8 ff ff ff 	movabs $0xffffffffffffa849,%rax
+  8039f5:	ff ff ff 
+  8039f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039fc:	ff d0                	call   *%rax
+  8039fe:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803a01:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803a05:	79 05                	jns    803a0c <readn+0x70>
+			return m;
+  803a07:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803a0a:	eb 1d                	jmp    803a29 <readn+0x8d>
+		if (m == 0)
+  803a0c:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803a10:	74 13                	je     803a25 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803a12:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803a15:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803a18:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a1b:	48 98                	cltq
+  803a1d:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803a21:	72 aa                	jb     8039cd <readn+0x31>
+  803a23:	eb 01                	jmp    803a26 <readn+0x8a>
+			break;
+  803a25:	90                   	nop
+	}
+	return tot;
+  803a26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803a29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a2d:	c9                   	leave
+  803a2e:	c3                   	ret
+
+0000000000803a2f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803a2f:	55                   	push   %rbp
+  803a30:	48 89 e5             	mov    %rsp,%rbp
+  803a33:	41 57                	push   %r15
+  803a35:	53                   	push   %rbx
+  803a36:	48 83 ec 40          	sub    $0x40,%rsp
+  803a3a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a3a <write+0xb>
+  803a41:	49 bb 06 56 00 00 00 	movabs $0x5606,%r11
+  803a48:	00 00 00 
+  803a4b:	4c 01 db             	add    %r11,%rbx
+  803a4e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803a51:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803a55:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803a59:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803a5d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803a60:	48 89 d6             	mov    %rdx,%rsi
+  803a63:	89 c7                	mov    %eax,%edi
+  803a65:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  803a6c:	ff ff ff 
+  803a6f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a73:	ff d0                	call   *%rax
+  803a75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a78:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a7c:	78 28                	js     803aa6 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803a7e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a82:	8b 00                	mov    (%rax),%eax
+  803a84:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803a88:	48 89 d6             	mov    %rdx,%rsi
+  803a8b:	89 c7                	mov    %eax,%edi
+  803a8d:	48 b8 a8 a4 ff ff ff 	movabs $0xffffffffffffa4a8,%rax
+  803a94:	ff ff ff 
+  803a97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a9b:	ff d0                	call   *%rax
+  803a9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803aa0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803aa4:	79 08                	jns    803aae <write+0x7f>
+		return r;
+  803aa6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803aa9:	e9 8a 00 00 00       	jmp    803b38 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803aae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ab2:	8b 40 08             	mov    0x8(%rax),%eax
+  803ab5:	83 e0 03             	and    $0x3,%eax
+  803ab8:	85 c0                	test   %eax,%eax
+  803aba:	75 4b                	jne    803b07 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803abc:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803ac3:	ff ff ff 
+  803ac6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803aca:	48 8b 00             	mov    (%rax),%rax
+  803acd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ad3:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803ad6:	89 c6                	mov    %eax,%esi
+  803ad8:	48 b8 5b e2 ff ff ff 	movabs $0xffffffffffffe25b,%rax
+  803adf:	ff ff ff 
+  803ae2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ae6:	48 89 c7             	mov    %rax,%rdi
+  803ae9:	49 89 df             	mov    %rbx,%r15
+  803aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af1:	48 b9 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rcx
+  803af8:	ff ff ff 
+  803afb:	48 01 d9             	add    %rbx,%rcx
+  803afe:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803b00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b05:	eb 31                	jmp    803b38 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803b07:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b0b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803b0f:	48 85 c0             	test   %rax,%rax
+  803b12:	75 07                	jne    803b1b <write+0xec>
+		return -E_NOT_SUPP;
+  803b14:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803b19:	eb 1d                	jmp    803b38 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803b1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b1f:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803b23:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b27:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803b2b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803b2f:	48 89 ce             	mov    %rcx,%rsi
+  803b32:	48 89 c7             	mov    %rax,%rdi
+  803b35:	41 ff d0             	call   *%r8
+}
+  803b38:	48 83 c4 40          	add    $0x40,%rsp
+  803b3c:	5b                   	pop    %rbx
+  803b3d:	41 5f                	pop    %r15
+  803b3f:	5d                   	pop    %rbp
+  803b40:	c3                   	ret
+
+0000000000803b41 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803b41:	55                   	push   %rbp
+  803b42:	48 89 e5             	mov    %rsp,%rbp
+  803b45:	48 83 ec 18          	sub    $0x18,%rsp
+  803b49:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b49 <seek+0x8>
+  803b50:	49 bb f7 54 00 00 00 	movabs $0x54f7,%r11
+  803b57:	00 00 00 
+  803b5a:	4c 01 d8             	add    %r11,%rax
+  803b5d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b60:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b63:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803b67:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803b6a:	48 89 ce             	mov    %rcx,%rsi
+  803b6d:	89 d7                	mov    %edx,%edi
+  803b6f:	48 ba 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rdx
+  803b76:	ff ff ff 
+  803b79:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803b7d:	ff d0                	call   *%rax
+  803b7f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b82:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b86:	79 05                	jns    803b8d <seek+0x4c>
+		return r;
+  803b88:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b8b:	eb 0f                	jmp    803b9c <seek+0x5b>
+	fd->fd_offset = offset;
+  803b8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b91:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803b94:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803b97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b9c:	c9                   	leave
+  803b9d:	c3                   	ret
+
+0000000000803b9e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803b9e:	55                   	push   %rbp
+  803b9f:	48 89 e5             	mov    %rsp,%rbp
+  803ba2:	41 57                	push   %r15
+  803ba4:	53                   	push   %rbx
+  803ba5:	48 83 ec 30          	sub    $0x30,%rsp
+  803ba9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ba9 <ftruncate+0xb>
+  803bb0:	49 bb 97 54 00 00 00 	movabs $0x5497,%r11
+  803bb7:	00 00 00 
+  803bba:	4c 01 db             	add    %r11,%rbx
+  803bbd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803bc0:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803bc3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803bc7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803bca:	48 89 d6             	mov    %rdx,%rsi
+  803bcd:	89 c7                	mov    %eax,%edi
+  803bcf:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  803bd6:	ff ff ff 
+  803bd9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bdd:	ff d0                	call   *%rax
+  803bdf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803be2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803be6:	78 28                	js     803c10 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803be8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bec:	8b 00                	mov    (%rax),%eax
+  803bee:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803bf2:	48 89 d6             	mov    %rdx,%rsi
+  803bf5:	89 c7                	mov    %eax,%edi
+  803bf7:	48 b8 a8 a4 ff ff ff 	movabs $0xffffffffffffa4a8,%rax
+  803bfe:	ff ff ff 
+  803c01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c05:	ff d0                	call   *%rax
+  803c07:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c0a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c0e:	79 08                	jns    803c18 <ftruncate+0x7a>
+		return r;
+  803c10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c13:	e9 83 00 00 00       	jmp    803c9b <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803c18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c1c:	8b 40 08             	mov    0x8(%rax),%eax
+  803c1f:	83 e0 03             	and    $0x3,%eax
+  803c22:	85 c0                	test   %eax,%eax
+  803c24:	75 4b                	jne    803c71 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803c26:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803c2d:	ff ff ff 
+  803c30:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c34:	48 8b 00             	mov    (%rax),%rax
+  803c37:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803c3d:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803c40:	89 c6                	mov    %eax,%esi
+  803c42:	48 b8 78 e2 ff ff ff 	movabs $0xffffffffffffe278,%rax
+  803c49:	ff ff ff 
+  803c4c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c50:	48 89 c7             	mov    %rax,%rdi
+  803c53:	49 89 df             	mov    %rbx,%r15
+  803c56:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c5b:	48 b9 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rcx
+  803c62:	ff ff ff 
+  803c65:	48 01 d9             	add    %rbx,%rcx
+  803c68:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803c6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c6f:	eb 2a                	jmp    803c9b <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803c71:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c75:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803c79:	48 85 c0             	test   %rax,%rax
+  803c7c:	75 07                	jne    803c85 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803c7e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c83:	eb 16                	jmp    803c9b <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803c85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c89:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803c8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c91:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803c94:	89 d6                	mov    %edx,%esi
+  803c96:	48 89 c7             	mov    %rax,%rdi
+  803c99:	ff d1                	call   *%rcx
+}
+  803c9b:	48 83 c4 30          	add    $0x30,%rsp
+  803c9f:	5b                   	pop    %rbx
+  803ca0:	41 5f                	pop    %r15
+  803ca2:	5d                   	pop    %rbp
+  803ca3:	c3                   	ret
+
+0000000000803ca4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803ca4:	55                   	push   %rbp
+  803ca5:	48 89 e5             	mov    %rsp,%rbp
+  803ca8:	53                   	push   %rbx
+  803ca9:	48 83 ec 38          	sub    $0x38,%rsp
+  803cad:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cad <fstat+0x9>
+  803cb4:	49 bb 93 53 00 00 00 	movabs $0x5393,%r11
+  803cbb:	00 00 00 
+  803cbe:	4c 01 db             	add    %r11,%rbx
+  803cc1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803cc4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803cc8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803ccc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803ccf:	48 89 d6             	mov    %rdx,%rsi
+  803cd2:	89 c7                	mov    %eax,%edi
+  803cd4:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  803cdb:	ff ff ff 
+  803cde:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ce2:	ff d0                	call   *%rax
+  803ce4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ce7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ceb:	78 28                	js     803d15 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ced:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cf1:	8b 00                	mov    (%rax),%eax
+  803cf3:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803cf7:	48 89 d6             	mov    %rdx,%rsi
+  803cfa:	89 c7                	mov    %eax,%edi
+  803cfc:	48 b8 a8 a4 ff ff ff 	movabs $0xffffffffffffa4a8,%rax
+  803d03:	ff ff ff 
+  803d06:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d0a:	ff d0                	call   *%rax
+  803d0c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d0f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d13:	79 05                	jns    803d1a <fstat+0x76>
+		return r;
+  803d15:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d18:	eb 5e                	jmp    803d78 <fstat+0xd4>
+	if (!dev->dev_stat)
+  803d1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d1e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803d22:	48 85 c0             	test   %rax,%rax
+  803d25:	75 07                	jne    803d2e <fstat+0x8a>
+		return -E_NOT_SUPP;
+  803d27:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803d2c:	eb 4a                	jmp    803d78 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  803d2e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d32:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803d35:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d39:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803d40:	00 00 00 
+	stat->st_isdir = 0;
+  803d43:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d47:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803d4e:	00 00 00 
+	stat->st_dev = dev;
+  803d51:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d55:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d59:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  803d60:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d64:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803d68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d70:	48 89 d6             	mov    %rdx,%rsi
+  803d73:	48 89 c7             	mov    %rax,%rdi
+  803d76:	ff d1                	call   *%rcx
+}
+  803d78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d7c:	c9                   	leave
+  803d7d:	c3                   	ret
+
+0000000000803d7e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  803d7e:	55                   	push   %rbp
+  803d7f:	48 89 e5             	mov    %rsp,%rbp
+  803d82:	41 57                	push   %r15
+  803d84:	53                   	push   %rbx
+  803d85:	48 83 ec 20          	sub    $0x20,%rsp
+  803d89:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d89 <stat+0xb>
+  803d90:	49 bb b7 52 00 00 00 	movabs $0x52b7,%r11
+  803d97:	00 00 00 
+  803d9a:	4c 01 db             	add    %r11,%rbx
+  803d9d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803da1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803da5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803da9:	be 00 00 00 00       	mov    $0x0,%esi
+  803dae:	48 89 c7             	mov    %rax,%rdi
+  803db1:	49 89 df             	mov    %rbx,%r15
+  803db4:	48 b8 18 b0 ff ff ff 	movabs $0xffffffffffffb018,%rax
+  803dbb:	ff ff ff 
+  803dbe:	48 01 d8             	add    %rbx,%rax
+  803dc1:	ff d0                	call   *%rax
+  803dc3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803dc6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803dca:	79 05                	jns    803dd1 <stat+0x53>
+		return fd;
+  803dcc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dcf:	eb 37                	jmp    803e08 <stat+0x8a>
+	r = fstat(fd, stat);
+  803dd1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803dd5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dd8:	48 89 d6             	mov    %rdx,%rsi
+  803ddb:	89 c7                	mov    %eax,%edi
+  803ddd:	48 b8 64 ac ff ff ff 	movabs $0xffffffffffffac64,%rax
+  803de4:	ff ff ff 
+  803de7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803deb:	ff d0                	call   *%rax
+  803ded:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  803df0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803df3:	89 c7                	mov    %eax,%edi
+  803df5:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  803dfc:	ff ff ff 
+  803dff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e03:	ff d0                	call   *%rax
+	return r;
+  803e05:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  803e08:	48 83 c4 20          	add    $0x20,%rsp
+  803e0c:	5b                   	pop    %rbx
+  803e0d:	41 5f                	pop    %r15
+  803e0f:	5d                   	pop    %rbp
+  803e10:	c3                   	ret
+
+0000000000803e11 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  803e11:	55                   	push   %rbp
+  803e12:	48 89 e5             	mov    %rsp,%rbp
+  803e15:	41 57                	push   %r15
+  803e17:	53                   	push   %rbx
+  803e18:	48 83 ec 10          	sub    $0x10,%rsp
+  803e1c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e1c <fsipc+0xb>
+  803e23:	49 bb 24 52 00 00 00 	movabs $0x5224,%r11
+  803e2a:	00 00 00 
+  803e2d:	4c 01 db             	add    %r11,%rbx
+  803e30:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e33:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803e37:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803e3e:	00 00 00 
+  803e41:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803e44:	85 c0                	test   %eax,%eax
+  803e46:	75 24                	jne    803e6c <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803e48:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e4d:	49 89 df             	mov    %rbx,%r15
+  803e50:	48 b8 f3 da ff ff ff 	movabs $0xffffffffffffdaf3,%rax
+  803e57:	ff ff ff 
+  803e5a:	48 01 d8             	add    %rbx,%rax
+  803e5d:	ff d0                	call   *%rax
+  803e5f:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  803e66:	00 00 00 
+  803e69:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803e6c:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803e73:	00 00 00 
+  803e76:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803e79:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e7d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803e80:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803e86:	49 89 d0             	mov    %rdx,%r8
+  803e89:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803e8e:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  803e95:	00 00 00 
+  803e98:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803e9c:	89 c7                	mov    %eax,%edi
+  803e9e:	49 89 df             	mov    %rbx,%r15
+  803ea1:	48 b8 12 d5 ff ff ff 	movabs $0xffffffffffffd512,%rax
+  803ea8:	ff ff ff 
+  803eab:	48 01 d8             	add    %rbx,%rax
+  803eae:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  803eb0:	48 83 c4 10          	add    $0x10,%rsp
+  803eb4:	5b                   	pop    %rbx
+  803eb5:	41 5f                	pop    %r15
+  803eb7:	5d                   	pop    %rbp
+  803eb8:	c3                   	ret
+
+0000000000803eb9 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803eb9:	55                   	push   %rbp
+  803eba:	48 89 e5             	mov    %rsp,%rbp
+  803ebd:	41 57                	push   %r15
+  803ebf:	53                   	push   %rbx
+  803ec0:	48 83 ec 20          	sub    $0x20,%rsp
+  803ec4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ec4 <fsipc_words+0xb>
+  803ecb:	49 bb 7c 51 00 00 00 	movabs $0x517c,%r11
+  803ed2:	00 00 00 
+  803ed5:	4c 01 db             	add    %r11,%rbx
+  803ed8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803edb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803edf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  803ee3:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803eea:	00 00 00 
+  803eed:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803ef0:	85 c0                	test   %eax,%eax
+  803ef2:	75 24                	jne    803f18 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803ef4:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ef9:	49 89 df             	mov    %rbx,%r15
+  803efc:	48 b8 f3 da ff ff ff 	movabs $0xffffffffffffdaf3,%rax
+  803f03:	ff ff ff 
+  803f06:	48 01 d8             	add    %rbx,%rax
+  803f09:	ff d0                	call   *%rax
+  803f0b:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  803f12:	00 00 00 
+  803f15:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  803f18:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803f1f:	00 00 00 
+  803f22:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803f25:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803f29:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803f2d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  803f30:	89 c7                	mov    %eax,%edi
+  803f32:	49 89 df             	mov    %rbx,%r15
+  803f35:	48 b8 fd d5 ff ff ff 	movabs $0xffffffffffffd5fd,%rax
+  803f3c:	ff ff ff 
+  803f3f:	48 01 d8             	add    %rbx,%rax
+  803f42:	ff d0                	call   *%rax
+}
+  803f44:	48 83 c4 20          	add    $0x20,%rsp
+  803f48:	5b                   	pop    %rbx
+  803f49:	41 5f                	pop    %r15
+  803f4b:	5d                   	pop    %rbp
+  803f4c:	c3                   	ret
+
+0000000000803f4d <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803f4d:	55                   	push   %rbp
+  803f4e:	48 89 e5             	mov    %rsp,%rbp
+  803f51:	41 57                	push   %r15
+  803f53:	53                   	push   %rbx
+  803f54:	48 83 ec 40          	sub    $0x40,%rsp
+  803f58:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f58 <fsipc_pages+0xb>
+  803f5f:	49 bb e8 50 00 00 00 	movabs $0x50e8,%r11
+  803f66:	00 00 00 
+  803f69:	4c 01 db             	add    %r11,%rbx
+  803f6c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803f6f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803f73:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803f77:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803f7a:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  803f81:	00 00 00 
+  803f84:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803f87:	85 c0                	test   %eax,%eax
+  803f89:	75 24                	jne    803faf <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803f8b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f90:	49 89 df             	mov    %rbx,%r15
+  803f93:	48 b8 f3 da ff ff ff 	movabs $0xffffffffffffdaf3,%rax
+  803f9a:	ff ff ff 
+  803f9d:	48 01 d8             	add    %rbx,%rax
+  803fa0:	ff d0                	call   *%rax
+  803fa2:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  803fa9:	00 00 00 
+  803fac:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  803faf:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803fb4:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803fb8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803fbb:	48 98                	cltq
+  803fbd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  803fc1:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803fc5:	0f 95 c0             	setne  %al
+  803fc8:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803fcb:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803fd2:	00 
+  803fd3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803fd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fdb:	48 01 d0             	add    %rdx,%rax
+  803fde:	48 83 e8 01          	sub    $0x1,%rax
+  803fe2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803fe6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fea:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fef:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803ff3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ff7:	48 29 d0             	sub    %rdx,%rax
+  803ffa:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  803ffe:	41 89 c2             	mov    %eax,%r10d
+  804001:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804008:	00 00 00 
+  80400b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80400e:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804012:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804016:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804019:	48 83 ec 08          	sub    $0x8,%rsp
+  80401d:	6a 40                	push   $0x40
+  80401f:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804024:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  80402b:	00 
+  80402c:	6a 05                	push   $0x5
+  80402e:	41 89 f9             	mov    %edi,%r9d
+  804031:	49 89 c8             	mov    %rcx,%r8
+  804034:	44 89 d1             	mov    %r10d,%ecx
+  804037:	89 c7                	mov    %eax,%edi
+  804039:	49 89 df             	mov    %rbx,%r15
+  80403c:	48 b8 fb d6 ff ff ff 	movabs $0xffffffffffffd6fb,%rax
+  804043:	ff ff ff 
+  804046:	48 01 d8             	add    %rbx,%rax
+  804049:	ff d0                	call   *%rax
+  80404b:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80404f:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804053:	5b                   	pop    %rbx
+  804054:	41 5f                	pop    %r15
+  804056:	5d                   	pop    %rbp
+  804057:	c3                   	ret
+
+0000000000804058 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804058:	55                   	push   %rbp
+  804059:	48 89 e5             	mov    %rsp,%rbp
+  80405c:	41 57                	push   %r15
+  80405e:	53                   	push   %rbx
+  80405f:	48 83 ec 20          	sub    $0x20,%rsp
+  804063:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804063 <open+0xb>
+  80406a:	49 bb dd 4f 00 00 00 	movabs $0x4fdd,%r11
+  804071:	00 00 00 
+  804074:	4c 01 db             	add    %r11,%rbx
+  804077:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80407b:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  80407e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804082:	48 89 c7             	mov    %rax,%rdi
+  804085:	49 89 df             	mov    %rbx,%r15
+  804088:	48 b8 4d 81 ff ff ff 	movabs $0xffffffffffff814d,%rax
+  80408f:	ff ff ff 
+  804092:	48 01 d8             	add    %rbx,%rax
+  804095:	ff d0                	call   *%rax
+  804097:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80409c:	7e 0a                	jle    8040a8 <open+0x50>
+		return -E_BAD_PATH;
+  80409e:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8040a3:	e9 18 01 00 00       	jmp    8041c0 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8040a8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8040ac:	48 89 c7             	mov    %rax,%rdi
+  8040af:	49 89 df             	mov    %rbx,%r15
+  8040b2:	48 b8 4c a2 ff ff ff 	movabs $0xffffffffffffa24c,%rax
+  8040b9:	ff ff ff 
+  8040bc:	48 01 d8             	add    %rbx,%rax
+  8040bf:	ff d0                	call   *%rax
+  8040c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040c8:	74 08                	je     8040d2 <open+0x7a>
+		return r;
+  8040ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040cd:	e9 ee 00 00 00       	jmp    8041c0 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8040d2:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8040d9:	00 00 00 
+  8040dc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8040df:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8040e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040ea:	48 89 c6             	mov    %rax,%rsi
+  8040ed:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8040f4:	00 00 00 
+  8040f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040fb:	48 89 c7             	mov    %rax,%rdi
+  8040fe:	49 89 df             	mov    %rbx,%r15
+  804101:	48 b8 e1 81 ff ff ff 	movabs $0xffffffffffff81e1,%rax
+  804108:	ff ff ff 
+  80410b:	48 01 d8             	add    %rbx,%rax
+  80410e:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804110:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804114:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804119:	48 89 c6             	mov    %rax,%rsi
+  80411c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804121:	49 89 df             	mov    %rbx,%r15
+  804124:	48 b8 9d 8e ff ff ff 	movabs $0xffffffffffff8e9d,%rax
+  80412b:	ff ff ff 
+  80412e:	48 01 d8             	add    %rbx,%rax
+  804131:	ff d0                	call   *%rax
+  804133:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804136:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80413a:	74 23                	je     80415f <open+0x107>
+		fd_close(fd,0);
+  80413c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804140:	be 00 00 00 00       	mov    $0x0,%esi
+  804145:	48 89 c7             	mov    %rax,%rdi
+  804148:	49 89 df             	mov    %rbx,%r15
+  80414b:	48 b8 ad a3 ff ff ff 	movabs $0xffffffffffffa3ad,%rax
+  804152:	ff ff ff 
+  804155:	48 01 d8             	add    %rbx,%rax
+  804158:	ff d0                	call   *%rax
+		return r;
+  80415a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80415d:	eb 61                	jmp    8041c0 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80415f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804163:	48 89 c6             	mov    %rax,%rsi
+  804166:	bf 01 00 00 00       	mov    $0x1,%edi
+  80416b:	48 b8 d1 ad ff ff ff 	movabs $0xffffffffffffadd1,%rax
+  804172:	ff ff ff 
+  804175:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804179:	ff d0                	call   *%rax
+  80417b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80417e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804182:	74 23                	je     8041a7 <open+0x14f>
+		fd_close(fd,0);
+  804184:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804188:	be 00 00 00 00       	mov    $0x0,%esi
+  80418d:	48 89 c7             	mov    %rax,%rdi
+  804190:	49 89 df             	mov    %rbx,%r15
+  804193:	48 b8 ad a3 ff ff ff 	movabs $0xffffffffffffa3ad,%rax
+  80419a:	ff ff ff 
+  80419d:	48 01 d8             	add    %rbx,%rax
+  8041a0:	ff d0                	call   *%rax
+		return r;
+  8041a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041a5:	eb 19                	jmp    8041c0 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8041a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041ab:	48 89 c7             	mov    %rax,%rdi
+  8041ae:	49 89 df             	mov    %rbx,%r15
+  8041b1:	48 b8 d2 a1 ff ff ff 	movabs $0xffffffffffffa1d2,%rax
+  8041b8:	ff ff ff 
+  8041bb:	48 01 d8             	add    %rbx,%rax
+  8041be:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8041c0:	48 83 c4 20          	add    $0x20,%rsp
+  8041c4:	5b                   	pop    %rbx
+  8041c5:	41 5f                	pop    %r15
+  8041c7:	5d                   	pop    %rbp
+  8041c8:	c3                   	ret
+
+00000000008041c9 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8041c9:	55                   	push   %rbp
+  8041ca:	48 89 e5             	mov    %rsp,%rbp
+  8041cd:	48 83 ec 20          	sub    $0x20,%rsp
+  8041d1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8041d1 <devfile_flush+0x8>
+  8041d8:	49 bb 6f 4e 00 00 00 	movabs $0x4e6f,%r11
+  8041df:	00 00 00 
+  8041e2:	4c 01 d8             	add    %r11,%rax
+  8041e5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8041e9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8041ed:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8041f0:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8041f3:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8041f7:	ba 04 00 00 00       	mov    $0x4,%edx
+  8041fc:	48 89 ce             	mov    %rcx,%rsi
+  8041ff:	bf 06 00 00 00       	mov    $0x6,%edi
+  804204:	48 b9 79 ae ff ff ff 	movabs $0xffffffffffffae79,%rcx
+  80420b:	ff ff ff 
+  80420e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804212:	ff d0                	call   *%rax
+}
+  804214:	c9                   	leave
+  804215:	c3                   	ret
+
+0000000000804216 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804216:	55                   	push   %rbp
+  804217:	48 89 e5             	mov    %rsp,%rbp
+  80421a:	41 57                	push   %r15
+  80421c:	53                   	push   %rbx
+  80421d:	48 83 ec 60          	sub    $0x60,%rsp
+  804221:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804221 <devfile_read+0xb>
+  804228:	49 bb 1f 4e 00 00 00 	movabs $0x4e1f,%r11
+  80422f:	00 00 00 
+  804232:	4c 01 db             	add    %r11,%rbx
+  804235:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804239:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80423d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804241:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804245:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804249:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80424d:	8b 50 0c             	mov    0xc(%rax),%edx
+  804250:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804254:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804256:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80425a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80425e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804262:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804266:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80426b:	ba 10 00 00 00       	mov    $0x10,%edx
+  804270:	48 89 c6             	mov    %rax,%rsi
+  804273:	bf 03 00 00 00       	mov    $0x3,%edi
+  804278:	48 b8 0d af ff ff ff 	movabs $0xffffffffffffaf0d,%rax
+  80427f:	ff ff ff 
+  804282:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804286:	ff d0                	call   *%rax
+  804288:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80428b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80428f:	79 05                	jns    804296 <devfile_read+0x80>
+		return r;
+  804291:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804294:	eb 64                	jmp    8042fa <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804296:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804299:	48 63 d0             	movslq %eax,%rdx
+  80429c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8042a0:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8042a5:	48 01 c1             	add    %rax,%rcx
+  8042a8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8042ac:	48 89 ce             	mov    %rcx,%rsi
+  8042af:	48 89 c7             	mov    %rax,%rdi
+  8042b2:	49 89 df             	mov    %rbx,%r15
+  8042b5:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  8042bc:	ff ff ff 
+  8042bf:	48 01 d8             	add    %rbx,%rax
+  8042c2:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8042c4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8042cb:	ff ff ff 
+  8042ce:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8042d2:	48 8b 00             	mov    (%rax),%rax
+  8042d5:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8042db:	89 c6                	mov    %eax,%esi
+  8042dd:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8042e2:	48 89 c7             	mov    %rax,%rdi
+  8042e5:	49 89 df             	mov    %rbx,%r15
+  8042e8:	48 b8 ad da ff ff ff 	movabs $0xffffffffffffdaad,%rax
+  8042ef:	ff ff ff 
+  8042f2:	48 01 d8             	add    %rbx,%rax
+  8042f5:	ff d0                	call   *%rax
+	return r;
+  8042f7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8042fa:	48 83 c4 60          	add    $0x60,%rsp
+  8042fe:	5b                   	pop    %rbx
+  8042ff:	41 5f                	pop    %r15
+  804301:	5d                   	pop    %rbp
+  804302:	c3                   	ret
+
+0000000000804303 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804303:	55                   	push   %rbp
+  804304:	48 89 e5             	mov    %rsp,%rbp
+  804307:	41 57                	push   %r15
+  804309:	53                   	push   %rbx
+  80430a:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  80430e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80430e <devfile_write+0xb>
+  804315:	49 bb 32 4d 00 00 00 	movabs $0x4d32,%r11
+  80431c:	00 00 00 
+  80431f:	4c 01 db             	add    %r11,%rbx
+  804322:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804326:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  80432a:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804331:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804335:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804339:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804340:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804344:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  80434b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80434e:	48 63 d0             	movslq %eax,%rdx
+  804351:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804355:	48 39 c2             	cmp    %rax,%rdx
+  804358:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80435c:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804363:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80436a:	00 
+  80436b:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804372:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804376:	48 01 d0             	add    %rdx,%rax
+  804379:	48 83 e8 01          	sub    $0x1,%rax
+  80437d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804381:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804385:	ba 00 00 00 00       	mov    $0x0,%edx
+  80438a:	48 f7 75 d0          	divq   -0x30(%rbp)
+  80438e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804392:	48 29 d0             	sub    %rdx,%rax
+  804395:	48 c1 e8 0c          	shr    $0xc,%rax
+  804399:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  80439c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80439f:	89 c6                	mov    %eax,%esi
+  8043a1:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8043a6:	48 89 c7             	mov    %rax,%rdi
+  8043a9:	49 89 df             	mov    %rbx,%r15
+  8043ac:	48 b8 67 da ff ff ff 	movabs $0xffffffffffffda67,%rax
+  8043b3:	ff ff ff 
+  8043b6:	48 01 d8             	add    %rbx,%rax
+  8043b9:	ff d0                	call   *%rax
+  8043bb:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8043be:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8043c2:	79 08                	jns    8043cc <devfile_write+0xc9>
+		return r;
+  8043c4:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8043c7:	e9 8f 00 00 00       	jmp    80445b <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8043cc:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8043d3:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8043d7:	48 89 c6             	mov    %rax,%rsi
+  8043da:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8043df:	48 89 c7             	mov    %rax,%rdi
+  8043e2:	49 89 df             	mov    %rbx,%r15
+  8043e5:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  8043ec:	ff ff ff 
+  8043ef:	48 01 d8             	add    %rbx,%rax
+  8043f2:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8043f4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8043f8:	8b 50 0c             	mov    0xc(%rax),%edx
+  8043fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043ff:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804401:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804405:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80440c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804410:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804413:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804417:	89 d1                	mov    %edx,%ecx
+  804419:	ba 10 00 00 00       	mov    $0x10,%edx
+  80441e:	48 89 c6             	mov    %rax,%rsi
+  804421:	bf 04 00 00 00       	mov    $0x4,%edi
+  804426:	48 b8 0d af ff ff ff 	movabs $0xffffffffffffaf0d,%rax
+  80442d:	ff ff ff 
+  804430:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804434:	ff d0                	call   *%rax
+  804436:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804439:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80443c:	89 c6                	mov    %eax,%esi
+  80443e:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804443:	48 89 c7             	mov    %rax,%rdi
+  804446:	49 89 df             	mov    %rbx,%r15
+  804449:	48 b8 ad da ff ff ff 	movabs $0xffffffffffffdaad,%rax
+  804450:	ff ff ff 
+  804453:	48 01 d8             	add    %rbx,%rax
+  804456:	ff d0                	call   *%rax
+	return r;
+  804458:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80445b:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  80445f:	5b                   	pop    %rbx
+  804460:	41 5f                	pop    %r15
+  804462:	5d                   	pop    %rbp
+  804463:	c3                   	ret
+
+0000000000804464 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804464:	55                   	push   %rbp
+  804465:	48 89 e5             	mov    %rsp,%rbp
+  804468:	41 57                	push   %r15
+  80446a:	53                   	push   %rbx
+  80446b:	48 83 ec 20          	sub    $0x20,%rsp
+  80446f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80446f <devfile_stat+0xb>
+  804476:	49 bb d1 4b 00 00 00 	movabs $0x4bd1,%r11
+  80447d:	00 00 00 
+  804480:	4c 01 db             	add    %r11,%rbx
+  804483:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804487:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80448b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80448f:	8b 40 0c             	mov    0xc(%rax),%eax
+  804492:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804499:	00 00 00 
+  80449c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80449f:	be 00 00 00 00       	mov    $0x0,%esi
+  8044a4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8044a9:	48 b8 d1 ad ff ff ff 	movabs $0xffffffffffffadd1,%rax
+  8044b0:	ff ff ff 
+  8044b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044b7:	ff d0                	call   *%rax
+  8044b9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044c0:	79 05                	jns    8044c7 <devfile_stat+0x63>
+		return r;
+  8044c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044c5:	eb 65                	jmp    80452c <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8044c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044cb:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8044d2:	00 00 00 
+  8044d5:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8044d9:	48 89 d6             	mov    %rdx,%rsi
+  8044dc:	48 89 c7             	mov    %rax,%rdi
+  8044df:	49 89 df             	mov    %rbx,%r15
+  8044e2:	48 b8 e1 81 ff ff ff 	movabs $0xffffffffffff81e1,%rax
+  8044e9:	ff ff ff 
+  8044ec:	48 01 d8             	add    %rbx,%rax
+  8044ef:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8044f1:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8044f8:	00 00 00 
+  8044fb:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804502:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804506:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80450c:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804513:	00 00 00 
+  804516:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  80451d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804521:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804527:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80452c:	48 83 c4 20          	add    $0x20,%rsp
+  804530:	5b                   	pop    %rbx
+  804531:	41 5f                	pop    %r15
+  804533:	5d                   	pop    %rbp
+  804534:	c3                   	ret
+
+0000000000804535 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804535:	55                   	push   %rbp
+  804536:	48 89 e5             	mov    %rsp,%rbp
+  804539:	48 83 ec 20          	sub    $0x20,%rsp
+  80453d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80453d <devfile_trunc+0x8>
+  804544:	49 bb 03 4b 00 00 00 	movabs $0x4b03,%r11
+  80454b:	00 00 00 
+  80454e:	4c 01 d8             	add    %r11,%rax
+  804551:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804555:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804558:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80455c:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80455f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804562:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804565:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804568:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80456c:	ba 08 00 00 00       	mov    $0x8,%edx
+  804571:	48 89 ce             	mov    %rcx,%rsi
+  804574:	bf 02 00 00 00       	mov    $0x2,%edi
+  804579:	48 b9 79 ae ff ff ff 	movabs $0xffffffffffffae79,%rcx
+  804580:	ff ff ff 
+  804583:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804587:	ff d0                	call   *%rax
+}
+  804589:	c9                   	leave
+  80458a:	c3                   	ret
+
+000000000080458b <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80458b:	55                   	push   %rbp
+  80458c:	48 89 e5             	mov    %rsp,%rbp
+  80458f:	41 57                	push   %r15
+  804591:	53                   	push   %rbx
+  804592:	48 83 ec 10          	sub    $0x10,%rsp
+  804596:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804596 <remove+0xb>
+  80459d:	49 bb aa 4a 00 00 00 	movabs $0x4aaa,%r11
+  8045a4:	00 00 00 
+  8045a7:	4c 01 db             	add    %r11,%rbx
+  8045aa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8045ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045b2:	48 89 c7             	mov    %rax,%rdi
+  8045b5:	49 89 df             	mov    %rbx,%r15
+  8045b8:	48 b8 4d 81 ff ff ff 	movabs $0xffffffffffff814d,%rax
+  8045bf:	ff ff ff 
+  8045c2:	48 01 d8             	add    %rbx,%rax
+  8045c5:	ff d0                	call   *%rax
+  8045c7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8045cc:	7e 07                	jle    8045d5 <remove+0x4a>
+		return -E_BAD_PATH;
+  8045ce:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8045d3:	eb 44                	jmp    804619 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8045d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045d9:	48 89 c6             	mov    %rax,%rsi
+  8045dc:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8045e3:	00 00 00 
+  8045e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045ea:	48 89 c7             	mov    %rax,%rdi
+  8045ed:	49 89 df             	mov    %rbx,%r15
+  8045f0:	48 b8 e1 81 ff ff ff 	movabs $0xffffffffffff81e1,%rax
+  8045f7:	ff ff ff 
+  8045fa:	48 01 d8             	add    %rbx,%rax
+  8045fd:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8045ff:	be 00 00 00 00       	mov    $0x0,%esi
+  804604:	bf 07 00 00 00       	mov    $0x7,%edi
+  804609:	48 b8 d1 ad ff ff ff 	movabs $0xffffffffffffadd1,%rax
+  804610:	ff ff ff 
+  804613:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804617:	ff d0                	call   *%rax
+}
+  804619:	48 83 c4 10          	add    $0x10,%rsp
+  80461d:	5b                   	pop    %rbx
+  80461e:	41 5f                	pop    %r15
+  804620:	5d                   	pop    %rbp
+  804621:	c3                   	ret
+
+0000000000804622 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804622:	55                   	push   %rbp
+  804623:	48 89 e5             	mov    %rsp,%rbp
+  804626:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804626 <sync+0x4>
+  80462d:	49 bb 1a 4a 00 00 00 	movabs $0x4a1a,%r11
+  804634:	00 00 00 
+  804637:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80463a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80463f:	be 00 00 00 00       	mov    $0x0,%esi
+  804644:	bf 08 00 00 00       	mov    $0x8,%edi
+  804649:	48 b9 79 ae ff ff ff 	movabs $0xffffffffffffae79,%rcx
+  804650:	ff ff ff 
+  804653:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804657:	ff d0                	call   *%rax
+}
+  804659:	5d                   	pop    %rbp
+  80465a:	c3                   	ret
+
+000000000080465b <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80465b:	55                   	push   %rbp
+  80465c:	48 89 e5             	mov    %rsp,%rbp
+  80465f:	41 57                	push   %r15
+  804661:	53                   	push   %rbx
+  804662:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804669:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804669 <copy+0xe>
+  804670:	49 bb d7 49 00 00 00 	movabs $0x49d7,%r11
+  804677:	00 00 00 
+  80467a:	4c 01 db             	add    %r11,%rbx
+  80467d:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804684:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  80468b:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804692:	be 00 00 00 00       	mov    $0x0,%esi
+  804697:	48 89 c7             	mov    %rax,%rdi
+  80469a:	48 b8 18 b0 ff ff ff 	movabs $0xffffffffffffb018,%rax
+  8046a1:	ff ff ff 
+  8046a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046a8:	ff d0                	call   *%rax
+  8046aa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8046ad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046b1:	79 35                	jns    8046e8 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8046b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046b6:	89 c6                	mov    %eax,%esi
+  8046b8:	48 b8 9e e2 ff ff ff 	movabs $0xffffffffffffe29e,%rax
+  8046bf:	ff ff ff 
+  8046c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046c6:	48 89 c7             	mov    %rax,%rdi
+  8046c9:	49 89 df             	mov    %rbx,%r15
+  8046cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d1:	48 ba 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rdx
+  8046d8:	ff ff ff 
+  8046db:	48 01 da             	add    %rbx,%rdx
+  8046de:	ff d2                	call   *%rdx
+		return fd_src;
+  8046e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046e3:	e9 d7 01 00 00       	jmp    8048bf <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8046e8:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8046ef:	be 01 01 00 00       	mov    $0x101,%esi
+  8046f4:	48 89 c7             	mov    %rax,%rdi
+  8046f7:	48 b8 18 b0 ff ff ff 	movabs $0xffffffffffffb018,%rax
+  8046fe:	ff ff ff 
+  804701:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804705:	ff d0                	call   *%rax
+  804707:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  80470a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80470e:	0f 89 df 00 00 00    	jns    8047f3 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804714:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804717:	89 c6                	mov    %eax,%esi
+  804719:	48 b8 b4 e2 ff ff ff 	movabs $0xffffffffffffe2b4,%rax
+  804720:	ff ff ff 
+  804723:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804727:	48 89 c7             	mov    %rax,%rdi
+  80472a:	49 89 df             	mov    %rbx,%r15
+  80472d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804732:	48 ba 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rdx
+  804739:	ff ff ff 
+  80473c:	48 01 da             	add    %rbx,%rdx
+  80473f:	ff d2                	call   *%rdx
+		close(fd_src);
+  804741:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804744:	89 c7                	mov    %eax,%edi
+  804746:	49 89 df             	mov    %rbx,%r15
+  804749:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  804750:	ff ff ff 
+  804753:	48 01 d8             	add    %rbx,%rax
+  804756:	ff d0                	call   *%rax
+		return fd_dest;
+  804758:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80475b:	e9 5f 01 00 00       	jmp    8048bf <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804760:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804763:	48 63 d0             	movslq %eax,%rdx
+  804766:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  80476d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804770:	48 89 ce             	mov    %rcx,%rsi
+  804773:	89 c7                	mov    %eax,%edi
+  804775:	49 89 df             	mov    %rbx,%r15
+  804778:	48 b8 ef a9 ff ff ff 	movabs $0xffffffffffffa9ef,%rax
+  80477f:	ff ff ff 
+  804782:	48 01 d8             	add    %rbx,%rax
+  804785:	ff d0                	call   *%rax
+  804787:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  80478a:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80478e:	79 63                	jns    8047f3 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804790:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804793:	89 c6                	mov    %eax,%esi
+  804795:	48 b8 ce e2 ff ff ff 	movabs $0xffffffffffffe2ce,%rax
+  80479c:	ff ff ff 
+  80479f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047a3:	48 89 c7             	mov    %rax,%rdi
+  8047a6:	49 89 df             	mov    %rbx,%r15
+  8047a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047ae:	48 ba 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rdx
+  8047b5:	ff ff ff 
+  8047b8:	48 01 da             	add    %rbx,%rdx
+  8047bb:	ff d2                	call   *%rdx
+			close(fd_src);
+  8047bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047c0:	89 c7                	mov    %eax,%edi
+  8047c2:	49 89 df             	mov    %rbx,%r15
+  8047c5:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  8047cc:	ff ff ff 
+  8047cf:	48 01 d8             	add    %rbx,%rax
+  8047d2:	ff d0                	call   *%rax
+			close(fd_dest);
+  8047d4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8047d7:	89 c7                	mov    %eax,%edi
+  8047d9:	49 89 df             	mov    %rbx,%r15
+  8047dc:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  8047e3:	ff ff ff 
+  8047e6:	48 01 d8             	add    %rbx,%rax
+  8047e9:	ff d0                	call   *%rax
+			return write_size;
+  8047eb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8047ee:	e9 cc 00 00 00       	jmp    8048bf <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  8047f3:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8047fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047fd:	ba 00 02 00 00       	mov    $0x200,%edx
+  804802:	48 89 ce             	mov    %rcx,%rsi
+  804805:	89 c7                	mov    %eax,%edi
+  804807:	49 89 df             	mov    %rbx,%r15
+  80480a:	48 b8 49 a8 ff ff ff 	movabs $0xffffffffffffa849,%rax
+  804811:	ff ff ff 
+  804814:	48 01 d8             	add    %rbx,%rax
+  804817:	ff d0                	call   *%rax
+  804819:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80481c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804820:	0f 8f 3a ff ff ff    	jg     804760 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804826:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80482a:	79 60                	jns    80488c <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  80482c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80482f:	89 c6                	mov    %eax,%esi
+  804831:	48 b8 e1 e2 ff ff ff 	movabs $0xffffffffffffe2e1,%rax
+  804838:	ff ff ff 
+  80483b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80483f:	48 89 c7             	mov    %rax,%rdi
+  804842:	49 89 df             	mov    %rbx,%r15
+  804845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80484a:	48 ba 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rdx
+  804851:	ff ff ff 
+  804854:	48 01 da             	add    %rbx,%rdx
+  804857:	ff d2                	call   *%rdx
+		close(fd_src);
+  804859:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80485c:	89 c7                	mov    %eax,%edi
+  80485e:	49 89 df             	mov    %rbx,%r15
+  804861:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  804868:	ff ff ff 
+  80486b:	48 01 d8             	add    %rbx,%rax
+  80486e:	ff d0                	call   *%rax
+		close(fd_dest);
+  804870:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804873:	89 c7                	mov    %eax,%edi
+  804875:	49 89 df             	mov    %rbx,%r15
+  804878:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  80487f:	ff ff ff 
+  804882:	48 01 d8             	add    %rbx,%rax
+  804885:	ff d0                	call   *%rax
+		return read_size;
+  804887:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80488a:	eb 33                	jmp    8048bf <copy+0x264>
+	}
+	close(fd_src);
+  80488c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80488f:	89 c7                	mov    %eax,%edi
+  804891:	49 89 df             	mov    %rbx,%r15
+  804894:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  80489b:	ff ff ff 
+  80489e:	48 01 d8             	add    %rbx,%rax
+  8048a1:	ff d0                	call   *%rax
+	close(fd_dest);
+  8048a3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8048a6:	89 c7                	mov    %eax,%edi
+  8048a8:	49 89 df             	mov    %rbx,%r15
+  8048ab:	48 b8 91 a5 ff ff ff 	movabs $0xffffffffffffa591,%rax
+  8048b2:	ff ff ff 
+  8048b5:	48 01 d8             	add    %rbx,%rax
+  8048b8:	ff d0                	call   *%rax
+	return 0;
+  8048ba:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8048bf:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8048c6:	5b                   	pop    %rbx
+  8048c7:	41 5f                	pop    %r15
+  8048c9:	5d                   	pop    %rbp
+  8048ca:	c3                   	ret
+
+00000000008048cb <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  8048cb:	55                   	push   %rbp
+  8048cc:	48 89 e5             	mov    %rsp,%rbp
+  8048cf:	41 57                	push   %r15
+  8048d1:	53                   	push   %rbx
+  8048d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8048d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048d6 <fd2sockid+0xb>
+  8048dd:	49 bb 6a 47 00 00 00 	movabs $0x476a,%r11
+  8048e4:	00 00 00 
+  8048e7:	4c 01 db             	add    %r11,%rbx
+  8048ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8048ed:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8048f1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048f4:	48 89 d6             	mov    %rdx,%rsi
+  8048f7:	89 c7                	mov    %eax,%edi
+  8048f9:	49 89 df             	mov    %rbx,%r15
+  8048fc:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  804903:	ff ff ff 
+  804906:	48 01 d8             	add    %rbx,%rax
+  804909:	ff d0                	call   *%rax
+  80490b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80490e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804912:	79 05                	jns    804919 <fd2sockid+0x4e>
+		return r;
+  804914:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804917:	eb 25                	jmp    80493e <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804919:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80491d:	8b 10                	mov    (%rax),%edx
+  80491f:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  804926:	00 00 00 
+  804929:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80492c:	39 c2                	cmp    %eax,%edx
+  80492e:	74 07                	je     804937 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804930:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804935:	eb 07                	jmp    80493e <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804937:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80493b:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  80493e:	48 83 c4 20          	add    $0x20,%rsp
+  804942:	5b                   	pop    %rbx
+  804943:	41 5f                	pop    %r15
+  804945:	5d                   	pop    %rbp
+  804946:	c3                   	ret
+
+0000000000804947 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804947:	55                   	push   %rbp
+  804948:	48 89 e5             	mov    %rsp,%rbp
+  80494b:	41 57                	push   %r15
+  80494d:	53                   	push   %rbx
+  80494e:	48 83 ec 20          	sub    $0x20,%rsp
+  804952:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804952 <alloc_sockfd+0xb>
+  804959:	49 bb ee 46 00 00 00 	movabs $0x46ee,%r11
+  804960:	00 00 00 
+  804963:	4c 01 db             	add    %r11,%rbx
+  804966:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804969:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80496d:	48 89 c7             	mov    %rax,%rdi
+  804970:	49 89 df             	mov    %rbx,%r15
+  804973:	48 b8 4c a2 ff ff ff 	movabs $0xffffffffffffa24c,%rax
+  80497a:	ff ff ff 
+  80497d:	48 01 d8             	add    %rbx,%rax
+  804980:	ff d0                	call   *%rax
+  804982:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804985:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804989:	78 2c                	js     8049b7 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80498b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80498f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804994:	48 89 c6             	mov    %rax,%rsi
+  804997:	bf 00 00 00 00       	mov    $0x0,%edi
+  80499c:	49 89 df             	mov    %rbx,%r15
+  80499f:	48 b8 9d 8e ff ff ff 	movabs $0xffffffffffff8e9d,%rax
+  8049a6:	ff ff ff 
+  8049a9:	48 01 d8             	add    %rbx,%rax
+  8049ac:	ff d0                	call   *%rax
+  8049ae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049b1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049b5:	79 1c                	jns    8049d3 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8049b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8049ba:	89 c7                	mov    %eax,%edi
+  8049bc:	49 89 df             	mov    %rbx,%r15
+  8049bf:	48 b8 fb c0 ff ff ff 	movabs $0xffffffffffffc0fb,%rax
+  8049c6:	ff ff ff 
+  8049c9:	48 01 d8             	add    %rbx,%rax
+  8049cc:	ff d0                	call   *%rax
+		return r;
+  8049ce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049d1:	eb 41                	jmp    804a14 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  8049d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049d7:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  8049de:	00 00 00 
+  8049e1:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8049e4:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8049e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049ea:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  8049f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049f5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8049f8:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8049fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049ff:	48 89 c7             	mov    %rax,%rdi
+  804a02:	49 89 df             	mov    %rbx,%r15
+  804a05:	48 b8 d2 a1 ff ff ff 	movabs $0xffffffffffffa1d2,%rax
+  804a0c:	ff ff ff 
+  804a0f:	48 01 d8             	add    %rbx,%rax
+  804a12:	ff d0                	call   *%rax
+}
+  804a14:	48 83 c4 20          	add    $0x20,%rsp
+  804a18:	5b                   	pop    %rbx
+  804a19:	41 5f                	pop    %r15
+  804a1b:	5d                   	pop    %rbp
+  804a1c:	c3                   	ret
+
+0000000000804a1d <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804a1d:	55                   	push   %rbp
+  804a1e:	48 89 e5             	mov    %rsp,%rbp
+  804a21:	41 57                	push   %r15
+  804a23:	53                   	push   %rbx
+  804a24:	48 83 ec 30          	sub    $0x30,%rsp
+  804a28:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a28 <accept+0xb>
+  804a2f:	49 bb 18 46 00 00 00 	movabs $0x4618,%r11
+  804a36:	00 00 00 
+  804a39:	4c 01 db             	add    %r11,%rbx
+  804a3c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804a3f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804a43:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804a47:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804a4a:	89 c7                	mov    %eax,%edi
+  804a4c:	48 b8 8b b8 ff ff ff 	movabs $0xffffffffffffb88b,%rax
+  804a53:	ff ff ff 
+  804a56:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a5a:	ff d0                	call   *%rax
+  804a5c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a5f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a63:	79 05                	jns    804a6a <accept+0x4d>
+		return r;
+  804a65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a68:	eb 45                	jmp    804aaf <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804a6a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a6e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804a72:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a75:	48 89 ce             	mov    %rcx,%rsi
+  804a78:	89 c7                	mov    %eax,%edi
+  804a7a:	49 89 df             	mov    %rbx,%r15
+  804a7d:	48 b8 69 bf ff ff ff 	movabs $0xffffffffffffbf69,%rax
+  804a84:	ff ff ff 
+  804a87:	48 01 d8             	add    %rbx,%rax
+  804a8a:	ff d0                	call   *%rax
+  804a8c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804a8f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804a93:	79 05                	jns    804a9a <accept+0x7d>
+		return r;
+  804a95:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a98:	eb 15                	jmp    804aaf <accept+0x92>
+	return alloc_sockfd(r);
+  804a9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a9d:	89 c7                	mov    %eax,%edi
+  804a9f:	48 b8 07 b9 ff ff ff 	movabs $0xffffffffffffb907,%rax
+  804aa6:	ff ff ff 
+  804aa9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804aad:	ff d0                	call   *%rax
+}
+  804aaf:	48 83 c4 30          	add    $0x30,%rsp
+  804ab3:	5b                   	pop    %rbx
+  804ab4:	41 5f                	pop    %r15
+  804ab6:	5d                   	pop    %rbp
+  804ab7:	c3                   	ret
+
+0000000000804ab8 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804ab8:	55                   	push   %rbp
+  804ab9:	48 89 e5             	mov    %rsp,%rbp
+  804abc:	41 57                	push   %r15
+  804abe:	53                   	push   %rbx
+  804abf:	48 83 ec 20          	sub    $0x20,%rsp
+  804ac3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ac3 <bind+0xb>
+  804aca:	49 bb 7d 45 00 00 00 	movabs $0x457d,%r11
+  804ad1:	00 00 00 
+  804ad4:	4c 01 db             	add    %r11,%rbx
+  804ad7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804ada:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804ade:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804ae1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ae4:	89 c7                	mov    %eax,%edi
+  804ae6:	48 b8 8b b8 ff ff ff 	movabs $0xffffffffffffb88b,%rax
+  804aed:	ff ff ff 
+  804af0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804af4:	ff d0                	call   *%rax
+  804af6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804af9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804afd:	79 05                	jns    804b04 <bind+0x4c>
+		return r;
+  804aff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b02:	eb 21                	jmp    804b25 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804b04:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804b07:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804b0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b0e:	48 89 ce             	mov    %rcx,%rsi
+  804b11:	89 c7                	mov    %eax,%edi
+  804b13:	49 89 df             	mov    %rbx,%r15
+  804b16:	48 b8 15 c0 ff ff ff 	movabs $0xffffffffffffc015,%rax
+  804b1d:	ff ff ff 
+  804b20:	48 01 d8             	add    %rbx,%rax
+  804b23:	ff d0                	call   *%rax
+}
+  804b25:	48 83 c4 20          	add    $0x20,%rsp
+  804b29:	5b                   	pop    %rbx
+  804b2a:	41 5f                	pop    %r15
+  804b2c:	5d                   	pop    %rbp
+  804b2d:	c3                   	ret
+
+0000000000804b2e <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804b2e:	55                   	push   %rbp
+  804b2f:	48 89 e5             	mov    %rsp,%rbp
+  804b32:	41 57                	push   %r15
+  804b34:	53                   	push   %rbx
+  804b35:	48 83 ec 20          	sub    $0x20,%rsp
+  804b39:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b39 <shutdown+0xb>
+  804b40:	49 bb 07 45 00 00 00 	movabs $0x4507,%r11
+  804b47:	00 00 00 
+  804b4a:	4c 01 db             	add    %r11,%rbx
+  804b4d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804b50:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804b53:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b56:	89 c7                	mov    %eax,%edi
+  804b58:	48 b8 8b b8 ff ff ff 	movabs $0xffffffffffffb88b,%rax
+  804b5f:	ff ff ff 
+  804b62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b66:	ff d0                	call   *%rax
+  804b68:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b6f:	79 05                	jns    804b76 <shutdown+0x48>
+		return r;
+  804b71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b74:	eb 1c                	jmp    804b92 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804b76:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804b79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b7c:	89 d6                	mov    %edx,%esi
+  804b7e:	89 c7                	mov    %eax,%edi
+  804b80:	49 89 df             	mov    %rbx,%r15
+  804b83:	48 b8 aa c0 ff ff ff 	movabs $0xffffffffffffc0aa,%rax
+  804b8a:	ff ff ff 
+  804b8d:	48 01 d8             	add    %rbx,%rax
+  804b90:	ff d0                	call   *%rax
+}
+  804b92:	48 83 c4 20          	add    $0x20,%rsp
+  804b96:	5b                   	pop    %rbx
+  804b97:	41 5f                	pop    %r15
+  804b99:	5d                   	pop    %rbp
+  804b9a:	c3                   	ret
+
+0000000000804b9b <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804b9b:	55                   	push   %rbp
+  804b9c:	48 89 e5             	mov    %rsp,%rbp
+  804b9f:	41 57                	push   %r15
+  804ba1:	53                   	push   %rbx
+  804ba2:	48 83 ec 10          	sub    $0x10,%rsp
+  804ba6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ba6 <devsock_close+0xb>
+  804bad:	49 bb 9a 44 00 00 00 	movabs $0x449a,%r11
+  804bb4:	00 00 00 
+  804bb7:	4c 01 db             	add    %r11,%rbx
+  804bba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804bbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bc2:	48 89 c7             	mov    %rax,%rdi
+  804bc5:	49 89 df             	mov    %rbx,%r15
+  804bc8:	48 b8 82 db ff ff ff 	movabs $0xffffffffffffdb82,%rax
+  804bcf:	ff ff ff 
+  804bd2:	48 01 d8             	add    %rbx,%rax
+  804bd5:	ff d0                	call   *%rax
+  804bd7:	83 f8 01             	cmp    $0x1,%eax
+  804bda:	75 1d                	jne    804bf9 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804bdc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804be0:	8b 40 0c             	mov    0xc(%rax),%eax
+  804be3:	89 c7                	mov    %eax,%edi
+  804be5:	49 89 df             	mov    %rbx,%r15
+  804be8:	48 b8 fb c0 ff ff ff 	movabs $0xffffffffffffc0fb,%rax
+  804bef:	ff ff ff 
+  804bf2:	48 01 d8             	add    %rbx,%rax
+  804bf5:	ff d0                	call   *%rax
+  804bf7:	eb 05                	jmp    804bfe <devsock_close+0x63>
+	else
+		return 0;
+  804bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804bfe:	48 83 c4 10          	add    $0x10,%rsp
+  804c02:	5b                   	pop    %rbx
+  804c03:	41 5f                	pop    %r15
+  804c05:	5d                   	pop    %rbp
+  804c06:	c3                   	ret
+
+0000000000804c07 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804c07:	55                   	push   %rbp
+  804c08:	48 89 e5             	mov    %rsp,%rbp
+  804c0b:	41 57                	push   %r15
+  804c0d:	53                   	push   %rbx
+  804c0e:	48 83 ec 20          	sub    $0x20,%rsp
+  804c12:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c12 <connect+0xb>
+  804c19:	49 bb 2e 44 00 00 00 	movabs $0x442e,%r11
+  804c20:	00 00 00 
+  804c23:	4c 01 db             	add    %r11,%rbx
+  804c26:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804c29:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804c2d:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804c30:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c33:	89 c7                	mov    %eax,%edi
+  804c35:	48 b8 8b b8 ff ff ff 	movabs $0xffffffffffffb88b,%rax
+  804c3c:	ff ff ff 
+  804c3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c43:	ff d0                	call   *%rax
+  804c45:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c48:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c4c:	79 05                	jns    804c53 <connect+0x4c>
+		return r;
+  804c4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c51:	eb 21                	jmp    804c74 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804c53:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804c56:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804c5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c5d:	48 89 ce             	mov    %rcx,%rsi
+  804c60:	89 c7                	mov    %eax,%edi
+  804c62:	49 89 df             	mov    %rbx,%r15
+  804c65:	48 b8 43 c1 ff ff ff 	movabs $0xffffffffffffc143,%rax
+  804c6c:	ff ff ff 
+  804c6f:	48 01 d8             	add    %rbx,%rax
+  804c72:	ff d0                	call   *%rax
+}
+  804c74:	48 83 c4 20          	add    $0x20,%rsp
+  804c78:	5b                   	pop    %rbx
+  804c79:	41 5f                	pop    %r15
+  804c7b:	5d                   	pop    %rbp
+  804c7c:	c3                   	ret
+
+0000000000804c7d <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804c7d:	55                   	push   %rbp
+  804c7e:	48 89 e5             	mov    %rsp,%rbp
+  804c81:	41 57                	push   %r15
+  804c83:	53                   	push   %rbx
+  804c84:	48 83 ec 20          	sub    $0x20,%rsp
+  804c88:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c88 <listen+0xb>
+  804c8f:	49 bb b8 43 00 00 00 	movabs $0x43b8,%r11
+  804c96:	00 00 00 
+  804c99:	4c 01 db             	add    %r11,%rbx
+  804c9c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804c9f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804ca2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ca5:	89 c7                	mov    %eax,%edi
+  804ca7:	48 b8 8b b8 ff ff ff 	movabs $0xffffffffffffb88b,%rax
+  804cae:	ff ff ff 
+  804cb1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cb5:	ff d0                	call   *%rax
+  804cb7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cbe:	79 05                	jns    804cc5 <listen+0x48>
+		return r;
+  804cc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cc3:	eb 1c                	jmp    804ce1 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804cc5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804cc8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ccb:	89 d6                	mov    %edx,%esi
+  804ccd:	89 c7                	mov    %eax,%edi
+  804ccf:	49 89 df             	mov    %rbx,%r15
+  804cd2:	48 b8 d8 c1 ff ff ff 	movabs $0xffffffffffffc1d8,%rax
+  804cd9:	ff ff ff 
+  804cdc:	48 01 d8             	add    %rbx,%rax
+  804cdf:	ff d0                	call   *%rax
+}
+  804ce1:	48 83 c4 20          	add    $0x20,%rsp
+  804ce5:	5b                   	pop    %rbx
+  804ce6:	41 5f                	pop    %r15
+  804ce8:	5d                   	pop    %rbp
+  804ce9:	c3                   	ret
+
+0000000000804cea <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804cea:	55                   	push   %rbp
+  804ceb:	48 89 e5             	mov    %rsp,%rbp
+  804cee:	41 57                	push   %r15
+  804cf0:	48 83 ec 28          	sub    $0x28,%rsp
+  804cf4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804cf4 <devsock_read+0xa>
+  804cfb:	49 bb 4c 43 00 00 00 	movabs $0x434c,%r11
+  804d02:	00 00 00 
+  804d05:	4c 01 d8             	add    %r11,%rax
+  804d08:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d0c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804d10:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  804d14:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804d18:	41 89 d0             	mov    %edx,%r8d
+  804d1b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d1f:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804d22:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804d26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d2b:	44 89 c2             	mov    %r8d,%edx
+  804d2e:	49 89 c7             	mov    %rax,%r15
+  804d31:	49 b8 29 c2 ff ff ff 	movabs $0xffffffffffffc229,%r8
+  804d38:	ff ff ff 
+  804d3b:	49 01 c0             	add    %rax,%r8
+  804d3e:	41 ff d0             	call   *%r8
+}
+  804d41:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804d45:	c9                   	leave
+  804d46:	c3                   	ret
+
+0000000000804d47 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804d47:	55                   	push   %rbp
+  804d48:	48 89 e5             	mov    %rsp,%rbp
+  804d4b:	41 57                	push   %r15
+  804d4d:	48 83 ec 28          	sub    $0x28,%rsp
+  804d51:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d51 <devsock_write+0xa>
+  804d58:	49 bb ef 42 00 00 00 	movabs $0x42ef,%r11
+  804d5f:	00 00 00 
+  804d62:	4c 01 d8             	add    %r11,%rax
+  804d65:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d69:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804d6d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  804d71:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804d75:	41 89 d0             	mov    %edx,%r8d
+  804d78:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d7c:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  804d7f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  804d83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804d88:	44 89 c2             	mov    %r8d,%edx
+  804d8b:	49 89 c7             	mov    %rax,%r15
+  804d8e:	49 b8 46 c3 ff ff ff 	movabs $0xffffffffffffc346,%r8
+  804d95:	ff ff ff 
+  804d98:	49 01 c0             	add    %rax,%r8
+  804d9b:	41 ff d0             	call   *%r8
+}
+  804d9e:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804da2:	c9                   	leave
+  804da3:	c3                   	ret
+
+0000000000804da4 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  804da4:	55                   	push   %rbp
+  804da5:	48 89 e5             	mov    %rsp,%rbp
+  804da8:	41 57                	push   %r15
+  804daa:	48 83 ec 18          	sub    $0x18,%rsp
+  804dae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804dae <devsock_stat+0xa>
+  804db5:	49 bb 92 42 00 00 00 	movabs $0x4292,%r11
+  804dbc:	00 00 00 
+  804dbf:	4c 01 d8             	add    %r11,%rax
+  804dc2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804dc6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804dca:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804dce:	48 b9 fc e2 ff ff ff 	movabs $0xffffffffffffe2fc,%rcx
+  804dd5:	ff ff ff 
+  804dd8:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  804ddc:	48 89 ce             	mov    %rcx,%rsi
+  804ddf:	48 89 d7             	mov    %rdx,%rdi
+  804de2:	49 89 c7             	mov    %rax,%r15
+  804de5:	48 ba e1 81 ff ff ff 	movabs $0xffffffffffff81e1,%rdx
+  804dec:	ff ff ff 
+  804def:	48 01 c2             	add    %rax,%rdx
+  804df2:	ff d2                	call   *%rdx
+	return 0;
+  804df4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804df9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804dfd:	c9                   	leave
+  804dfe:	c3                   	ret
+
+0000000000804dff <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  804dff:	55                   	push   %rbp
+  804e00:	48 89 e5             	mov    %rsp,%rbp
+  804e03:	41 57                	push   %r15
+  804e05:	53                   	push   %rbx
+  804e06:	48 83 ec 20          	sub    $0x20,%rsp
+  804e0a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e0a <socket+0xb>
+  804e11:	49 bb 36 42 00 00 00 	movabs $0x4236,%r11
+  804e18:	00 00 00 
+  804e1b:	4c 01 db             	add    %r11,%rbx
+  804e1e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e21:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  804e24:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  804e27:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804e2a:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804e2d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e30:	89 ce                	mov    %ecx,%esi
+  804e32:	89 c7                	mov    %eax,%edi
+  804e34:	49 89 df             	mov    %rbx,%r15
+  804e37:	48 b8 1d c5 ff ff ff 	movabs $0xffffffffffffc51d,%rax
+  804e3e:	ff ff ff 
+  804e41:	48 01 d8             	add    %rbx,%rax
+  804e44:	ff d0                	call   *%rax
+  804e46:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e49:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e4d:	79 05                	jns    804e54 <socket+0x55>
+		return r;
+  804e4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e52:	eb 15                	jmp    804e69 <socket+0x6a>
+	return alloc_sockfd(r);
+  804e54:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e57:	89 c7                	mov    %eax,%edi
+  804e59:	48 b8 07 b9 ff ff ff 	movabs $0xffffffffffffb907,%rax
+  804e60:	ff ff ff 
+  804e63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e67:	ff d0                	call   *%rax
+}
+  804e69:	48 83 c4 20          	add    $0x20,%rsp
+  804e6d:	5b                   	pop    %rbx
+  804e6e:	41 5f                	pop    %r15
+  804e70:	5d                   	pop    %rbp
+  804e71:	c3                   	ret
+
+0000000000804e72 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  804e72:	55                   	push   %rbp
+  804e73:	48 89 e5             	mov    %rsp,%rbp
+  804e76:	41 57                	push   %r15
+  804e78:	53                   	push   %rbx
+  804e79:	48 83 ec 10          	sub    $0x10,%rsp
+  804e7d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e7d <nsipc+0xb>
+  804e84:	49 bb c3 41 00 00 00 	movabs $0x41c3,%r11
+  804e8b:	00 00 00 
+  804e8e:	4c 01 db             	add    %r11,%rbx
+  804e91:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  804e94:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804e9b:	00 00 00 
+  804e9e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ea1:	85 c0                	test   %eax,%eax
+  804ea3:	75 24                	jne    804ec9 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804ea5:	bf 02 00 00 00       	mov    $0x2,%edi
+  804eaa:	49 89 df             	mov    %rbx,%r15
+  804ead:	48 b8 f3 da ff ff ff 	movabs $0xffffffffffffdaf3,%rax
+  804eb4:	ff ff ff 
+  804eb7:	48 01 d8             	add    %rbx,%rax
+  804eba:	ff d0                	call   *%rax
+  804ebc:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  804ec3:	00 00 00 
+  804ec6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804ec9:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804ed0:	00 00 00 
+  804ed3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ed6:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804ed9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804edf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804ee5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804eea:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804ef1:	00 00 00 
+  804ef4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804ef8:	89 c7                	mov    %eax,%edi
+  804efa:	49 89 df             	mov    %rbx,%r15
+  804efd:	48 b8 12 d5 ff ff ff 	movabs $0xffffffffffffd512,%rax
+  804f04:	ff ff ff 
+  804f07:	48 01 d8             	add    %rbx,%rax
+  804f0a:	ff d0                	call   *%rax
+}
+  804f0c:	48 83 c4 10          	add    $0x10,%rsp
+  804f10:	5b                   	pop    %rbx
+  804f11:	41 5f                	pop    %r15
+  804f13:	5d                   	pop    %rbp
+  804f14:	c3                   	ret
+
+0000000000804f15 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  804f15:	55                   	push   %rbp
+  804f16:	48 89 e5             	mov    %rsp,%rbp
+  804f19:	41 57                	push   %r15
+  804f1b:	53                   	push   %rbx
+  804f1c:	48 83 ec 20          	sub    $0x20,%rsp
+  804f20:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f20 <nsipc_words+0xb>
+  804f27:	49 bb 20 41 00 00 00 	movabs $0x4120,%r11
+  804f2e:	00 00 00 
+  804f31:	4c 01 db             	add    %r11,%rbx
+  804f34:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804f37:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804f3b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  804f3f:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804f46:	00 00 00 
+  804f49:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f4c:	85 c0                	test   %eax,%eax
+  804f4e:	75 24                	jne    804f74 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804f50:	bf 02 00 00 00       	mov    $0x2,%edi
+  804f55:	49 89 df             	mov    %rbx,%r15
+  804f58:	48 b8 f3 da ff ff ff 	movabs $0xffffffffffffdaf3,%rax
+  804f5f:	ff ff ff 
+  804f62:	48 01 d8             	add    %rbx,%rax
+  804f65:	ff d0                	call   *%rax
+  804f67:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  804f6e:	00 00 00 
+  804f71:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804f74:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804f7b:	00 00 00 
+  804f7e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804f81:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804f85:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f89:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804f8c:	89 c7                	mov    %eax,%edi
+  804f8e:	49 89 df             	mov    %rbx,%r15
+  804f91:	48 b8 fd d5 ff ff ff 	movabs $0xffffffffffffd5fd,%rax
+  804f98:	ff ff ff 
+  804f9b:	48 01 d8             	add    %rbx,%rax
+  804f9e:	ff d0                	call   *%rax
+}
+  804fa0:	48 83 c4 20          	add    $0x20,%rsp
+  804fa4:	5b                   	pop    %rbx
+  804fa5:	41 5f                	pop    %r15
+  804fa7:	5d                   	pop    %rbp
+  804fa8:	c3                   	ret
+
+0000000000804fa9 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804fa9:	55                   	push   %rbp
+  804faa:	48 89 e5             	mov    %rsp,%rbp
+  804fad:	41 57                	push   %r15
+  804faf:	53                   	push   %rbx
+  804fb0:	48 83 ec 30          	sub    $0x30,%rsp
+  804fb4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fb4 <nsipc_accept+0xb>
+  804fbb:	49 bb 8c 40 00 00 00 	movabs $0x408c,%r11
+  804fc2:	00 00 00 
+  804fc5:	4c 01 db             	add    %r11,%rbx
+  804fc8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804fcb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804fcf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  804fd3:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  804fda:	00 00 00 
+  804fdd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fe0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  804fe3:	bf 01 00 00 00       	mov    $0x1,%edi
+  804fe8:	48 b8 32 be ff ff ff 	movabs $0xffffffffffffbe32,%rax
+  804fef:	ff ff ff 
+  804ff2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ff6:	ff d0                	call   *%rax
+  804ff8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ffb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fff:	78 48                	js     805049 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805001:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805008:	00 00 00 
+  80500b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80500f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805013:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805017:	8b 40 10             	mov    0x10(%rax),%eax
+  80501a:	89 c2                	mov    %eax,%edx
+  80501c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805020:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805024:	48 89 ce             	mov    %rcx,%rsi
+  805027:	48 89 c7             	mov    %rax,%rdi
+  80502a:	49 89 df             	mov    %rbx,%r15
+  80502d:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  805034:	ff ff ff 
+  805037:	48 01 d8             	add    %rbx,%rax
+  80503a:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80503c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805040:	8b 50 10             	mov    0x10(%rax),%edx
+  805043:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805047:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805049:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80504c:	48 83 c4 30          	add    $0x30,%rsp
+  805050:	5b                   	pop    %rbx
+  805051:	41 5f                	pop    %r15
+  805053:	5d                   	pop    %rbp
+  805054:	c3                   	ret
+
+0000000000805055 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805055:	55                   	push   %rbp
+  805056:	48 89 e5             	mov    %rsp,%rbp
+  805059:	41 57                	push   %r15
+  80505b:	53                   	push   %rbx
+  80505c:	48 83 ec 10          	sub    $0x10,%rsp
+  805060:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805060 <nsipc_bind+0xb>
+  805067:	49 bb e0 3f 00 00 00 	movabs $0x3fe0,%r11
+  80506e:	00 00 00 
+  805071:	4c 01 db             	add    %r11,%rbx
+  805074:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805077:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80507b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  80507e:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805085:	00 00 00 
+  805088:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80508b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80508e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805091:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805095:	48 89 c6             	mov    %rax,%rsi
+  805098:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  80509f:	00 00 00 
+  8050a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050a6:	48 89 c7             	mov    %rax,%rdi
+  8050a9:	49 89 df             	mov    %rbx,%r15
+  8050ac:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  8050b3:	ff ff ff 
+  8050b6:	48 01 d8             	add    %rbx,%rax
+  8050b9:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8050bb:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8050c2:	00 00 00 
+  8050c5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8050c8:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8050cc:	bf 02 00 00 00       	mov    $0x2,%edi
+  8050d1:	48 b8 32 be ff ff ff 	movabs $0xffffffffffffbe32,%rax
+  8050d8:	ff ff ff 
+  8050db:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050df:	ff d0                	call   *%rax
+}
+  8050e1:	48 83 c4 10          	add    $0x10,%rsp
+  8050e5:	5b                   	pop    %rbx
+  8050e6:	41 5f                	pop    %r15
+  8050e8:	5d                   	pop    %rbp
+  8050e9:	c3                   	ret
+
+00000000008050ea <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8050ea:	55                   	push   %rbp
+  8050eb:	48 89 e5             	mov    %rsp,%rbp
+  8050ee:	48 83 ec 20          	sub    $0x20,%rsp
+  8050f2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050f2 <nsipc_shutdown+0x8>
+  8050f9:	49 bb 4e 3f 00 00 00 	movabs $0x3f4e,%r11
+  805100:	00 00 00 
+  805103:	4c 01 d8             	add    %r11,%rax
+  805106:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805109:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  80510c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80510f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805112:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805115:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805118:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80511c:	ba 08 00 00 00       	mov    $0x8,%edx
+  805121:	48 89 ce             	mov    %rcx,%rsi
+  805124:	bf 03 00 00 00       	mov    $0x3,%edi
+  805129:	48 b9 d5 be ff ff ff 	movabs $0xffffffffffffbed5,%rcx
+  805130:	ff ff ff 
+  805133:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805137:	ff d0                	call   *%rax
+}
+  805139:	c9                   	leave
+  80513a:	c3                   	ret
+
+000000000080513b <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80513b:	55                   	push   %rbp
+  80513c:	48 89 e5             	mov    %rsp,%rbp
+  80513f:	48 83 ec 20          	sub    $0x20,%rsp
+  805143:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805143 <nsipc_close+0x8>
+  80514a:	49 bb fd 3e 00 00 00 	movabs $0x3efd,%r11
+  805151:	00 00 00 
+  805154:	4c 01 d8             	add    %r11,%rax
+  805157:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80515a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80515d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805160:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805164:	ba 04 00 00 00       	mov    $0x4,%edx
+  805169:	48 89 ce             	mov    %rcx,%rsi
+  80516c:	bf 04 00 00 00       	mov    $0x4,%edi
+  805171:	48 b9 d5 be ff ff ff 	movabs $0xffffffffffffbed5,%rcx
+  805178:	ff ff ff 
+  80517b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80517f:	ff d0                	call   *%rax
+}
+  805181:	c9                   	leave
+  805182:	c3                   	ret
+
+0000000000805183 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805183:	55                   	push   %rbp
+  805184:	48 89 e5             	mov    %rsp,%rbp
+  805187:	41 57                	push   %r15
+  805189:	53                   	push   %rbx
+  80518a:	48 83 ec 10          	sub    $0x10,%rsp
+  80518e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80518e <nsipc_connect+0xb>
+  805195:	49 bb b2 3e 00 00 00 	movabs $0x3eb2,%r11
+  80519c:	00 00 00 
+  80519f:	4c 01 db             	add    %r11,%rbx
+  8051a2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8051a5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8051a9:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8051ac:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8051b3:	00 00 00 
+  8051b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8051b9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8051bc:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8051bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051c3:	48 89 c6             	mov    %rax,%rsi
+  8051c6:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  8051cd:	00 00 00 
+  8051d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051d4:	48 89 c7             	mov    %rax,%rdi
+  8051d7:	49 89 df             	mov    %rbx,%r15
+  8051da:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  8051e1:	ff ff ff 
+  8051e4:	48 01 d8             	add    %rbx,%rax
+  8051e7:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8051e9:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8051f0:	00 00 00 
+  8051f3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8051f6:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8051fa:	bf 05 00 00 00       	mov    $0x5,%edi
+  8051ff:	48 b8 32 be ff ff ff 	movabs $0xffffffffffffbe32,%rax
+  805206:	ff ff ff 
+  805209:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80520d:	ff d0                	call   *%rax
+}
+  80520f:	48 83 c4 10          	add    $0x10,%rsp
+  805213:	5b                   	pop    %rbx
+  805214:	41 5f                	pop    %r15
+  805216:	5d                   	pop    %rbp
+  805217:	c3                   	ret
+
+0000000000805218 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805218:	55                   	push   %rbp
+  805219:	48 89 e5             	mov    %rsp,%rbp
+  80521c:	48 83 ec 20          	sub    $0x20,%rsp
+  805220:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805220 <nsipc_listen+0x8>
+  805227:	49 bb 20 3e 00 00 00 	movabs $0x3e20,%r11
+  80522e:	00 00 00 
+  805231:	4c 01 d8             	add    %r11,%rax
+  805234:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805237:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  80523a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80523d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805240:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805243:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805246:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80524a:	ba 08 00 00 00       	mov    $0x8,%edx
+  80524f:	48 89 ce             	mov    %rcx,%rsi
+  805252:	bf 06 00 00 00       	mov    $0x6,%edi
+  805257:	48 b9 d5 be ff ff ff 	movabs $0xffffffffffffbed5,%rcx
+  80525e:	ff ff ff 
+  805261:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805265:	ff d0                	call   *%rax
+}
+  805267:	c9                   	leave
+  805268:	c3                   	ret
+
+0000000000805269 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805269:	55                   	push   %rbp
+  80526a:	48 89 e5             	mov    %rsp,%rbp
+  80526d:	41 57                	push   %r15
+  80526f:	53                   	push   %rbx
+  805270:	48 83 ec 30          	sub    $0x30,%rsp
+  805274:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805274 <nsipc_recv+0xb>
+  80527b:	49 bb cc 3d 00 00 00 	movabs $0x3dcc,%r11
+  805282:	00 00 00 
+  805285:	4c 01 db             	add    %r11,%rbx
+  805288:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80528b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80528f:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805292:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805295:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80529c:	00 00 00 
+  80529f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052a2:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8052a5:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8052ac:	00 00 00 
+  8052af:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8052b2:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8052b6:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8052bd:	00 00 00 
+  8052c0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8052c3:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8052c7:	bf 07 00 00 00       	mov    $0x7,%edi
+  8052cc:	48 b8 32 be ff ff ff 	movabs $0xffffffffffffbe32,%rax
+  8052d3:	ff ff ff 
+  8052d6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052da:	ff d0                	call   *%rax
+  8052dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052e3:	0f 88 91 00 00 00    	js     80537a <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8052e9:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8052f0:	7f 08                	jg     8052fa <nsipc_recv+0x91>
+  8052f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052f5:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8052f8:	7e 50                	jle    80534a <nsipc_recv+0xe1>
+  8052fa:	48 b8 03 e3 ff ff ff 	movabs $0xffffffffffffe303,%rax
+  805301:	ff ff ff 
+  805304:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805308:	48 89 c1             	mov    %rax,%rcx
+  80530b:	48 b8 18 e3 ff ff ff 	movabs $0xffffffffffffe318,%rax
+  805312:	ff ff ff 
+  805315:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805319:	48 89 c2             	mov    %rax,%rdx
+  80531c:	be 79 00 00 00       	mov    $0x79,%esi
+  805321:	48 b8 2d e3 ff ff ff 	movabs $0xffffffffffffe32d,%rax
+  805328:	ff ff ff 
+  80532b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80532f:	48 89 c7             	mov    %rax,%rdi
+  805332:	49 89 df             	mov    %rbx,%r15
+  805335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80533a:	49 b8 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%r8
+  805341:	ff ff ff 
+  805344:	49 01 d8             	add    %rbx,%r8
+  805347:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80534a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80534d:	48 63 d0             	movslq %eax,%rdx
+  805350:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805354:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80535b:	00 00 00 
+  80535e:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805362:	48 89 ce             	mov    %rcx,%rsi
+  805365:	48 89 c7             	mov    %rax,%rdi
+  805368:	49 89 df             	mov    %rbx,%r15
+  80536b:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  805372:	ff ff ff 
+  805375:	48 01 d8             	add    %rbx,%rax
+  805378:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80537a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80537d:	48 83 c4 30          	add    $0x30,%rsp
+  805381:	5b                   	pop    %rbx
+  805382:	41 5f                	pop    %r15
+  805384:	5d                   	pop    %rbp
+  805385:	c3                   	ret
+
+0000000000805386 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805386:	55                   	push   %rbp
+  805387:	48 89 e5             	mov    %rsp,%rbp
+  80538a:	41 57                	push   %r15
+  80538c:	53                   	push   %rbx
+  80538d:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805394:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805394 <nsipc_send+0xe>
+  80539b:	49 bb ac 3c 00 00 00 	movabs $0x3cac,%r11
+  8053a2:	00 00 00 
+  8053a5:	4c 01 db             	add    %r11,%rbx
+  8053a8:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8053ae:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8053b5:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8053bb:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8053c1:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8053c5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  8053c9:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8053d0:	00 00 00 
+  8053d3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8053d6:	85 c0                	test   %eax,%eax
+  8053d8:	75 24                	jne    8053fe <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8053da:	bf 02 00 00 00       	mov    $0x2,%edi
+  8053df:	49 89 df             	mov    %rbx,%r15
+  8053e2:	48 b8 f3 da ff ff ff 	movabs $0xffffffffffffdaf3,%rax
+  8053e9:	ff ff ff 
+  8053ec:	48 01 d8             	add    %rbx,%rax
+  8053ef:	ff d0                	call   *%rax
+  8053f1:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8053f8:	00 00 00 
+  8053fb:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8053fe:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805404:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805407:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  80540e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805411:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805414:	39 c2                	cmp    %eax,%edx
+  805416:	0f 4e c2             	cmovle %edx,%eax
+  805419:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  80541f:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805425:	48 63 d0             	movslq %eax,%rdx
+  805428:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  80542f:	48 89 c6             	mov    %rax,%rsi
+  805432:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805439:	00 00 00 
+  80543c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805440:	48 89 c7             	mov    %rax,%rdi
+  805443:	49 89 df             	mov    %rbx,%r15
+  805446:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  80544d:	ff ff ff 
+  805450:	48 01 d8             	add    %rbx,%rax
+  805453:	ff d0                	call   *%rax
+	req->req_s = s;
+  805455:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805459:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80545f:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805461:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805465:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80546b:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  80546e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805472:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805478:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  80547b:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805482:	00 00 00 
+  805485:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805489:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  80548d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805494:	00 
+  805495:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80549b:	48 63 d0             	movslq %eax,%rdx
+  80549e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054a2:	48 01 d0             	add    %rdx,%rax
+  8054a5:	48 83 e8 01          	sub    $0x1,%rax
+  8054a9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8054ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054b6:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8054ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8054be:	48 29 d0             	sub    %rdx,%rax
+  8054c1:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8054c7:	85 c0                	test   %eax,%eax
+  8054c9:	0f 48 c2             	cmovs  %edx,%eax
+  8054cc:	c1 f8 0c             	sar    $0xc,%eax
+  8054cf:	48 98                	cltq
+  8054d1:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8054d5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8054d9:	48 85 c0             	test   %rax,%rax
+  8054dc:	0f 95 c0             	setne  %al
+  8054df:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8054e2:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8054e9:	00 
+  8054ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8054ee:	48 83 c0 0b          	add    $0xb,%rax
+  8054f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8054f6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8054fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054ff:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805503:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805507:	48 29 d0             	sub    %rdx,%rax
+  80550a:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80550e:	89 c7                	mov    %eax,%edi
+  805510:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805517:	00 00 00 
+  80551a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80551d:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805521:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805525:	48 83 ec 08          	sub    $0x8,%rsp
+  805529:	6a 00                	push   $0x0
+  80552b:	6a 00                	push   $0x0
+  80552d:	6a 05                	push   $0x5
+  80552f:	41 89 f1             	mov    %esi,%r9d
+  805532:	49 89 c8             	mov    %rcx,%r8
+  805535:	89 f9                	mov    %edi,%ecx
+  805537:	be 08 00 00 00       	mov    $0x8,%esi
+  80553c:	89 c7                	mov    %eax,%edi
+  80553e:	49 89 df             	mov    %rbx,%r15
+  805541:	48 b8 fb d6 ff ff ff 	movabs $0xffffffffffffd6fb,%rax
+  805548:	ff ff ff 
+  80554b:	48 01 d8             	add    %rbx,%rax
+  80554e:	ff d0                	call   *%rax
+  805550:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805554:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805558:	5b                   	pop    %rbx
+  805559:	41 5f                	pop    %r15
+  80555b:	5d                   	pop    %rbp
+  80555c:	c3                   	ret
+
+000000000080555d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80555d:	55                   	push   %rbp
+  80555e:	48 89 e5             	mov    %rsp,%rbp
+  805561:	48 83 ec 10          	sub    $0x10,%rsp
+  805565:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805565 <nsipc_socket+0x8>
+  80556c:	49 bb db 3a 00 00 00 	movabs $0x3adb,%r11
+  805573:	00 00 00 
+  805576:	4c 01 d8             	add    %r11,%rax
+  805579:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80557c:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  80557f:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805582:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805589:	00 00 00 
+  80558c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80558f:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805592:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805599:	00 00 00 
+  80559c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80559f:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8055a3:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8055aa:	00 00 00 
+  8055ad:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8055b0:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8055b4:	bf 09 00 00 00       	mov    $0x9,%edi
+  8055b9:	48 ba 32 be ff ff ff 	movabs $0xffffffffffffbe32,%rdx
+  8055c0:	ff ff ff 
+  8055c3:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8055c7:	ff d0                	call   *%rax
+}
+  8055c9:	c9                   	leave
+  8055ca:	c3                   	ret
+
+00000000008055cb <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8055cb:	55                   	push   %rbp
+  8055cc:	48 89 e5             	mov    %rsp,%rbp
+  8055cf:	41 57                	push   %r15
+  8055d1:	53                   	push   %rbx
+  8055d2:	48 83 ec 30          	sub    $0x30,%rsp
+  8055d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055d6 <pipe+0xb>
+  8055dd:	49 bb 6a 3a 00 00 00 	movabs $0x3a6a,%r11
+  8055e4:	00 00 00 
+  8055e7:	4c 01 db             	add    %r11,%rbx
+  8055ea:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8055ee:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8055f2:	48 89 c7             	mov    %rax,%rdi
+  8055f5:	49 89 df             	mov    %rbx,%r15
+  8055f8:	48 b8 4c a2 ff ff ff 	movabs $0xffffffffffffa24c,%rax
+  8055ff:	ff ff ff 
+  805602:	48 01 d8             	add    %rbx,%rax
+  805605:	ff d0                	call   *%rax
+  805607:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80560a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80560e:	0f 88 12 02 00 00    	js     805826 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805614:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805618:	ba 07 04 00 00       	mov    $0x407,%edx
+  80561d:	48 89 c6             	mov    %rax,%rsi
+  805620:	bf 00 00 00 00       	mov    $0x0,%edi
+  805625:	49 89 df             	mov    %rbx,%r15
+  805628:	48 b8 9d 8e ff ff ff 	movabs $0xffffffffffff8e9d,%rax
+  80562f:	ff ff ff 
+  805632:	48 01 d8             	add    %rbx,%rax
+  805635:	ff d0                	call   *%rax
+  805637:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80563a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80563e:	0f 88 e2 01 00 00    	js     805826 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805644:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805648:	48 89 c7             	mov    %rax,%rdi
+  80564b:	49 89 df             	mov    %rbx,%r15
+  80564e:	48 b8 4c a2 ff ff ff 	movabs $0xffffffffffffa24c,%rax
+  805655:	ff ff ff 
+  805658:	48 01 d8             	add    %rbx,%rax
+  80565b:	ff d0                	call   *%rax
+  80565d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805660:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805664:	0f 88 9b 01 00 00    	js     805805 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80566a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80566e:	ba 07 04 00 00       	mov    $0x407,%edx
+  805673:	48 89 c6             	mov    %rax,%rsi
+  805676:	bf 00 00 00 00       	mov    $0x0,%edi
+  80567b:	49 89 df             	mov    %rbx,%r15
+  80567e:	48 b8 9d 8e ff ff ff 	movabs $0xffffffffffff8e9d,%rax
+  805685:	ff ff ff 
+  805688:	48 01 d8             	add    %rbx,%rax
+  80568b:	ff d0                	call   *%rax
+  80568d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805690:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805694:	0f 88 6b 01 00 00    	js     805805 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  80569a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80569e:	48 89 c7             	mov    %rax,%rdi
+  8056a1:	49 89 df             	mov    %rbx,%r15
+  8056a4:	48 b8 09 a2 ff ff ff 	movabs $0xffffffffffffa209,%rax
+  8056ab:	ff ff ff 
+  8056ae:	48 01 d8             	add    %rbx,%rax
+  8056b1:	ff d0                	call   *%rax
+  8056b3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8056b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8056bb:	ba 07 04 00 00       	mov    $0x407,%edx
+  8056c0:	48 89 c6             	mov    %rax,%rsi
+  8056c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056c8:	49 89 df             	mov    %rbx,%r15
+  8056cb:	48 b8 9d 8e ff ff ff 	movabs $0xffffffffffff8e9d,%rax
+  8056d2:	ff ff ff 
+  8056d5:	48 01 d8             	add    %rbx,%rax
+  8056d8:	ff d0                	call   *%rax
+  8056da:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056dd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056e1:	0f 88 fd 00 00 00    	js     8057e4 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8056e7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056eb:	48 89 c7             	mov    %rax,%rdi
+  8056ee:	49 89 df             	mov    %rbx,%r15
+  8056f1:	48 b8 09 a2 ff ff ff 	movabs $0xffffffffffffa209,%rax
+  8056f8:	ff ff ff 
+  8056fb:	48 01 d8             	add    %rbx,%rax
+  8056fe:	ff d0                	call   *%rax
+  805700:	48 89 c2             	mov    %rax,%rdx
+  805703:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805707:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80570d:	48 89 d1             	mov    %rdx,%rcx
+  805710:	ba 00 00 00 00       	mov    $0x0,%edx
+  805715:	48 89 c6             	mov    %rax,%rsi
+  805718:	bf 00 00 00 00       	mov    $0x0,%edi
+  80571d:	49 89 df             	mov    %rbx,%r15
+  805720:	48 b8 02 8f ff ff ff 	movabs $0xffffffffffff8f02,%rax
+  805727:	ff ff ff 
+  80572a:	48 01 d8             	add    %rbx,%rax
+  80572d:	ff d0                	call   *%rax
+  80572f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805732:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805736:	0f 88 87 00 00 00    	js     8057c3 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  80573c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805740:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805747:	00 00 00 
+  80574a:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80574d:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  80574f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805753:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  80575a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80575e:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805765:	00 00 00 
+  805768:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80576b:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  80576d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805771:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805778:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80577c:	48 89 c7             	mov    %rax,%rdi
+  80577f:	49 89 df             	mov    %rbx,%r15
+  805782:	48 b8 d2 a1 ff ff ff 	movabs $0xffffffffffffa1d2,%rax
+  805789:	ff ff ff 
+  80578c:	48 01 d8             	add    %rbx,%rax
+  80578f:	ff d0                	call   *%rax
+  805791:	89 c2                	mov    %eax,%edx
+  805793:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805797:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805799:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80579d:	48 89 c7             	mov    %rax,%rdi
+  8057a0:	49 89 df             	mov    %rbx,%r15
+  8057a3:	48 b8 d2 a1 ff ff ff 	movabs $0xffffffffffffa1d2,%rax
+  8057aa:	ff ff ff 
+  8057ad:	48 01 d8             	add    %rbx,%rax
+  8057b0:	ff d0                	call   *%rax
+  8057b2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8057b6:	48 83 c2 04          	add    $0x4,%rdx
+  8057ba:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  8057bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057c1:	eb 67                	jmp    80582a <pipe+0x25f>
+		goto err3;
+  8057c3:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  8057c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8057c8:	48 89 c6             	mov    %rax,%rsi
+  8057cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057d0:	49 89 df             	mov    %rbx,%r15
+  8057d3:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  8057da:	ff ff ff 
+  8057dd:	48 01 d8             	add    %rbx,%rax
+  8057e0:	ff d0                	call   *%rax
+  8057e2:	eb 01                	jmp    8057e5 <pipe+0x21a>
+		goto err2;
+  8057e4:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  8057e5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057e9:	48 89 c6             	mov    %rax,%rsi
+  8057ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057f1:	49 89 df             	mov    %rbx,%r15
+  8057f4:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  8057fb:	ff ff ff 
+  8057fe:	48 01 d8             	add    %rbx,%rax
+  805801:	ff d0                	call   *%rax
+  805803:	eb 01                	jmp    805806 <pipe+0x23b>
+		goto err1;
+  805805:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805806:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80580a:	48 89 c6             	mov    %rax,%rsi
+  80580d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805812:	49 89 df             	mov    %rbx,%r15
+  805815:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  80581c:	ff ff ff 
+  80581f:	48 01 d8             	add    %rbx,%rax
+  805822:	ff d0                	call   *%rax
+  805824:	eb 01                	jmp    805827 <pipe+0x25c>
+		goto err;
+  805826:	90                   	nop
+err:
+	return r;
+  805827:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80582a:	48 83 c4 30          	add    $0x30,%rsp
+  80582e:	5b                   	pop    %rbx
+  80582f:	41 5f                	pop    %r15
+  805831:	5d                   	pop    %rbp
+  805832:	c3                   	ret
+
+0000000000805833 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805833:	55                   	push   %rbp
+  805834:	48 89 e5             	mov    %rsp,%rbp
+  805837:	41 57                	push   %r15
+  805839:	41 54                	push   %r12
+  80583b:	53                   	push   %rbx
+  80583c:	48 83 ec 28          	sub    $0x28,%rsp
+  805840:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805840 <_pipeisclosed+0xd>
+  805847:	49 bb 00 38 00 00 00 	movabs $0x3800,%r11
+  80584e:	00 00 00 
+  805851:	4c 01 db             	add    %r11,%rbx
+  805854:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805858:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80585c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805863:	ff ff ff 
+  805866:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80586a:	48 8b 00             	mov    (%rax),%rax
+  80586d:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805873:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805876:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80587a:	48 89 c7             	mov    %rax,%rdi
+  80587d:	49 89 df             	mov    %rbx,%r15
+  805880:	48 b8 82 db ff ff ff 	movabs $0xffffffffffffdb82,%rax
+  805887:	ff ff ff 
+  80588a:	48 01 d8             	add    %rbx,%rax
+  80588d:	ff d0                	call   *%rax
+  80588f:	41 89 c4             	mov    %eax,%r12d
+  805892:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805896:	48 89 c7             	mov    %rax,%rdi
+  805899:	49 89 df             	mov    %rbx,%r15
+  80589c:	48 b8 82 db ff ff ff 	movabs $0xffffffffffffdb82,%rax
+  8058a3:	ff ff ff 
+  8058a6:	48 01 d8             	add    %rbx,%rax
+  8058a9:	ff d0                	call   *%rax
+  8058ab:	41 39 c4             	cmp    %eax,%r12d
+  8058ae:	0f 94 c0             	sete   %al
+  8058b1:	0f b6 c0             	movzbl %al,%eax
+  8058b4:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  8058b7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8058be:	ff ff ff 
+  8058c1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058c5:	48 8b 00             	mov    (%rax),%rax
+  8058c8:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8058ce:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  8058d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058d4:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8058d7:	75 05                	jne    8058de <_pipeisclosed+0xab>
+			return ret;
+  8058d9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8058dc:	eb 63                	jmp    805941 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  8058de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058e1:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8058e4:	0f 84 72 ff ff ff    	je     80585c <_pipeisclosed+0x29>
+  8058ea:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  8058ee:	0f 85 68 ff ff ff    	jne    80585c <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8058f4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8058fb:	ff ff ff 
+  8058fe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805902:	48 8b 00             	mov    (%rax),%rax
+  805905:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  80590b:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80590e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805911:	89 c6                	mov    %eax,%esi
+  805913:	48 b8 3e e3 ff ff ff 	movabs $0xffffffffffffe33e,%rax
+  80591a:	ff ff ff 
+  80591d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805921:	48 89 c7             	mov    %rax,%rdi
+  805924:	49 89 df             	mov    %rbx,%r15
+  805927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80592c:	49 b8 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%r8
+  805933:	ff ff ff 
+  805936:	49 01 d8             	add    %rbx,%r8
+  805939:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  80593c:	e9 1b ff ff ff       	jmp    80585c <_pipeisclosed+0x29>
+	}
+}
+  805941:	48 83 c4 28          	add    $0x28,%rsp
+  805945:	5b                   	pop    %rbx
+  805946:	41 5c                	pop    %r12
+  805948:	41 5f                	pop    %r15
+  80594a:	5d                   	pop    %rbp
+  80594b:	c3                   	ret
+
+000000000080594c <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  80594c:	55                   	push   %rbp
+  80594d:	48 89 e5             	mov    %rsp,%rbp
+  805950:	41 57                	push   %r15
+  805952:	53                   	push   %rbx
+  805953:	48 83 ec 30          	sub    $0x30,%rsp
+  805957:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805957 <pipeisclosed+0xb>
+  80595e:	49 bb e9 36 00 00 00 	movabs $0x36e9,%r11
+  805965:	00 00 00 
+  805968:	4c 01 db             	add    %r11,%rbx
+  80596b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80596e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805972:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805975:	48 89 d6             	mov    %rdx,%rsi
+  805978:	89 c7                	mov    %eax,%edi
+  80597a:	49 89 df             	mov    %rbx,%r15
+  80597d:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  805984:	ff ff ff 
+  805987:	48 01 d8             	add    %rbx,%rax
+  80598a:	ff d0                	call   *%rax
+  80598c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80598f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805993:	79 05                	jns    80599a <pipeisclosed+0x4e>
+		return r;
+  805995:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805998:	eb 3b                	jmp    8059d5 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  80599a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80599e:	48 89 c7             	mov    %rax,%rdi
+  8059a1:	49 89 df             	mov    %rbx,%r15
+  8059a4:	48 b8 09 a2 ff ff ff 	movabs $0xffffffffffffa209,%rax
+  8059ab:	ff ff ff 
+  8059ae:	48 01 d8             	add    %rbx,%rax
+  8059b1:	ff d0                	call   *%rax
+  8059b3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  8059b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059bb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8059bf:	48 89 d6             	mov    %rdx,%rsi
+  8059c2:	48 89 c7             	mov    %rax,%rdi
+  8059c5:	48 b8 f3 c7 ff ff ff 	movabs $0xffffffffffffc7f3,%rax
+  8059cc:	ff ff ff 
+  8059cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8059d3:	ff d0                	call   *%rax
+}
+  8059d5:	48 83 c4 30          	add    $0x30,%rsp
+  8059d9:	5b                   	pop    %rbx
+  8059da:	41 5f                	pop    %r15
+  8059dc:	5d                   	pop    %rbp
+  8059dd:	c3                   	ret
+
+00000000008059de <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8059de:	55                   	push   %rbp
+  8059df:	48 89 e5             	mov    %rsp,%rbp
+  8059e2:	41 57                	push   %r15
+  8059e4:	53                   	push   %rbx
+  8059e5:	48 83 ec 40          	sub    $0x40,%rsp
+  8059e9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059e9 <devpipe_read+0xb>
+  8059f0:	49 bb 57 36 00 00 00 	movabs $0x3657,%r11
+  8059f7:	00 00 00 
+  8059fa:	4c 01 db             	add    %r11,%rbx
+  8059fd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805a01:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805a05:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805a09:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a0d:	48 89 c7             	mov    %rax,%rdi
+  805a10:	49 89 df             	mov    %rbx,%r15
+  805a13:	48 b8 09 a2 ff ff ff 	movabs $0xffffffffffffa209,%rax
+  805a1a:	ff ff ff 
+  805a1d:	48 01 d8             	add    %rbx,%rax
+  805a20:	ff d0                	call   *%rax
+  805a22:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805a26:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805a2a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805a2e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805a35:	00 
+  805a36:	e9 a1 00 00 00       	jmp    805adc <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805a3b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805a40:	74 09                	je     805a4b <devpipe_read+0x6d>
+				return i;
+  805a42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a46:	e9 9f 00 00 00       	jmp    805aea <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805a4b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a53:	48 89 d6             	mov    %rdx,%rsi
+  805a56:	48 89 c7             	mov    %rax,%rdi
+  805a59:	48 b8 f3 c7 ff ff ff 	movabs $0xffffffffffffc7f3,%rax
+  805a60:	ff ff ff 
+  805a63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a67:	ff d0                	call   *%rax
+  805a69:	85 c0                	test   %eax,%eax
+  805a6b:	74 07                	je     805a74 <devpipe_read+0x96>
+				return 0;
+  805a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a72:	eb 76                	jmp    805aea <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805a74:	49 89 df             	mov    %rbx,%r15
+  805a77:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  805a7e:	ff ff ff 
+  805a81:	48 01 d8             	add    %rbx,%rax
+  805a84:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805a86:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a8a:	8b 10                	mov    (%rax),%edx
+  805a8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a90:	8b 40 04             	mov    0x4(%rax),%eax
+  805a93:	39 c2                	cmp    %eax,%edx
+  805a95:	74 a4                	je     805a3b <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805a97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a9b:	8b 10                	mov    (%rax),%edx
+  805a9d:	89 d0                	mov    %edx,%eax
+  805a9f:	c1 f8 1f             	sar    $0x1f,%eax
+  805aa2:	c1 e8 1b             	shr    $0x1b,%eax
+  805aa5:	01 c2                	add    %eax,%edx
+  805aa7:	83 e2 1f             	and    $0x1f,%edx
+  805aaa:	29 c2                	sub    %eax,%edx
+  805aac:	89 d6                	mov    %edx,%esi
+  805aae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805ab2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ab6:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805aba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805abe:	48 63 c6             	movslq %esi,%rax
+  805ac1:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805ac6:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805ac8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805acc:	8b 00                	mov    (%rax),%eax
+  805ace:	8d 50 01             	lea    0x1(%rax),%edx
+  805ad1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ad5:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805ad7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805adc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ae0:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805ae4:	72 a0                	jb     805a86 <devpipe_read+0xa8>
+	}
+	return i;
+  805ae6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805aea:	48 83 c4 40          	add    $0x40,%rsp
+  805aee:	5b                   	pop    %rbx
+  805aef:	41 5f                	pop    %r15
+  805af1:	5d                   	pop    %rbp
+  805af2:	c3                   	ret
+
+0000000000805af3 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805af3:	55                   	push   %rbp
+  805af4:	48 89 e5             	mov    %rsp,%rbp
+  805af7:	41 57                	push   %r15
+  805af9:	53                   	push   %rbx
+  805afa:	48 83 ec 40          	sub    $0x40,%rsp
+  805afe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805afe <devpipe_write+0xb>
+  805b05:	49 bb 42 35 00 00 00 	movabs $0x3542,%r11
+  805b0c:	00 00 00 
+  805b0f:	4c 01 db             	add    %r11,%rbx
+  805b12:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805b16:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805b1a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805b1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b22:	48 89 c7             	mov    %rax,%rdi
+  805b25:	49 89 df             	mov    %rbx,%r15
+  805b28:	48 b8 09 a2 ff ff ff 	movabs $0xffffffffffffa209,%rax
+  805b2f:	ff ff ff 
+  805b32:	48 01 d8             	add    %rbx,%rax
+  805b35:	ff d0                	call   *%rax
+  805b37:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805b3b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805b3f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805b43:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805b4a:	00 
+  805b4b:	e9 a0 00 00 00       	jmp    805bf0 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805b50:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805b54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b58:	48 89 d6             	mov    %rdx,%rsi
+  805b5b:	48 89 c7             	mov    %rax,%rdi
+  805b5e:	48 b8 f3 c7 ff ff ff 	movabs $0xffffffffffffc7f3,%rax
+  805b65:	ff ff ff 
+  805b68:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b6c:	ff d0                	call   *%rax
+  805b6e:	85 c0                	test   %eax,%eax
+  805b70:	74 0a                	je     805b7c <devpipe_write+0x89>
+				return 0;
+  805b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b77:	e9 82 00 00 00       	jmp    805bfe <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805b7c:	49 89 df             	mov    %rbx,%r15
+  805b7f:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  805b86:	ff ff ff 
+  805b89:	48 01 d8             	add    %rbx,%rax
+  805b8c:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805b8e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b92:	8b 40 04             	mov    0x4(%rax),%eax
+  805b95:	48 63 d0             	movslq %eax,%rdx
+  805b98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b9c:	8b 00                	mov    (%rax),%eax
+  805b9e:	48 98                	cltq
+  805ba0:	48 83 c0 20          	add    $0x20,%rax
+  805ba4:	48 39 c2             	cmp    %rax,%rdx
+  805ba7:	73 a7                	jae    805b50 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805ba9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805bad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bb1:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805bb5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bb9:	8b 50 04             	mov    0x4(%rax),%edx
+  805bbc:	89 d0                	mov    %edx,%eax
+  805bbe:	c1 f8 1f             	sar    $0x1f,%eax
+  805bc1:	c1 e8 1b             	shr    $0x1b,%eax
+  805bc4:	01 c2                	add    %eax,%edx
+  805bc6:	83 e2 1f             	and    $0x1f,%edx
+  805bc9:	29 c2                	sub    %eax,%edx
+  805bcb:	89 d0                	mov    %edx,%eax
+  805bcd:	0f b6 09             	movzbl (%rcx),%ecx
+  805bd0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805bd4:	48 98                	cltq
+  805bd6:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805bda:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bde:	8b 40 04             	mov    0x4(%rax),%eax
+  805be1:	8d 50 01             	lea    0x1(%rax),%edx
+  805be4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805be8:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805beb:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805bf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bf4:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805bf8:	72 94                	jb     805b8e <devpipe_write+0x9b>
+	}
+
+	return i;
+  805bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805bfe:	48 83 c4 40          	add    $0x40,%rsp
+  805c02:	5b                   	pop    %rbx
+  805c03:	41 5f                	pop    %r15
+  805c05:	5d                   	pop    %rbp
+  805c06:	c3                   	ret
+
+0000000000805c07 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805c07:	55                   	push   %rbp
+  805c08:	48 89 e5             	mov    %rsp,%rbp
+  805c0b:	41 57                	push   %r15
+  805c0d:	53                   	push   %rbx
+  805c0e:	48 83 ec 20          	sub    $0x20,%rsp
+  805c12:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c12 <devpipe_stat+0xb>
+  805c19:	49 bb 2e 34 00 00 00 	movabs $0x342e,%r11
+  805c20:	00 00 00 
+  805c23:	4c 01 db             	add    %r11,%rbx
+  805c26:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805c2a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805c2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c32:	48 89 c7             	mov    %rax,%rdi
+  805c35:	49 89 df             	mov    %rbx,%r15
+  805c38:	48 b8 09 a2 ff ff ff 	movabs $0xffffffffffffa209,%rax
+  805c3f:	ff ff ff 
+  805c42:	48 01 d8             	add    %rbx,%rax
+  805c45:	ff d0                	call   *%rax
+  805c47:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805c4b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c4f:	48 ba 51 e3 ff ff ff 	movabs $0xffffffffffffe351,%rdx
+  805c56:	ff ff ff 
+  805c59:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805c5d:	48 89 d6             	mov    %rdx,%rsi
+  805c60:	48 89 c7             	mov    %rax,%rdi
+  805c63:	49 89 df             	mov    %rbx,%r15
+  805c66:	48 b8 e1 81 ff ff ff 	movabs $0xffffffffffff81e1,%rax
+  805c6d:	ff ff ff 
+  805c70:	48 01 d8             	add    %rbx,%rax
+  805c73:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805c75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c79:	8b 50 04             	mov    0x4(%rax),%edx
+  805c7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c80:	8b 00                	mov    (%rax),%eax
+  805c82:	29 c2                	sub    %eax,%edx
+  805c84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c88:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805c8e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c92:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805c99:	00 00 00 
+	stat->st_dev = &devpipe;
+  805c9c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ca0:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805ca7:	00 00 00 
+  805caa:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805cae:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805cba:	48 83 c4 20          	add    $0x20,%rsp
+  805cbe:	5b                   	pop    %rbx
+  805cbf:	41 5f                	pop    %r15
+  805cc1:	5d                   	pop    %rbp
+  805cc2:	c3                   	ret
+
+0000000000805cc3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805cc3:	55                   	push   %rbp
+  805cc4:	48 89 e5             	mov    %rsp,%rbp
+  805cc7:	41 57                	push   %r15
+  805cc9:	53                   	push   %rbx
+  805cca:	48 83 ec 10          	sub    $0x10,%rsp
+  805cce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cce <devpipe_close+0xb>
+  805cd5:	49 bb 72 33 00 00 00 	movabs $0x3372,%r11
+  805cdc:	00 00 00 
+  805cdf:	4c 01 db             	add    %r11,%rbx
+  805ce2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805ce6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cea:	48 89 c6             	mov    %rax,%rsi
+  805ced:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cf2:	49 89 df             	mov    %rbx,%r15
+  805cf5:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  805cfc:	ff ff ff 
+  805cff:	48 01 d8             	add    %rbx,%rax
+  805d02:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805d04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d08:	48 89 c7             	mov    %rax,%rdi
+  805d0b:	49 89 df             	mov    %rbx,%r15
+  805d0e:	48 b8 09 a2 ff ff ff 	movabs $0xffffffffffffa209,%rax
+  805d15:	ff ff ff 
+  805d18:	48 01 d8             	add    %rbx,%rax
+  805d1b:	ff d0                	call   *%rax
+  805d1d:	48 89 c6             	mov    %rax,%rsi
+  805d20:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d25:	49 89 df             	mov    %rbx,%r15
+  805d28:	48 b8 75 8f ff ff ff 	movabs $0xffffffffffff8f75,%rax
+  805d2f:	ff ff ff 
+  805d32:	48 01 d8             	add    %rbx,%rax
+  805d35:	ff d0                	call   *%rax
+}
+  805d37:	48 83 c4 10          	add    $0x10,%rsp
+  805d3b:	5b                   	pop    %rbx
+  805d3c:	41 5f                	pop    %r15
+  805d3e:	5d                   	pop    %rbp
+  805d3f:	c3                   	ret
+
+0000000000805d40 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  805d40:	55                   	push   %rbp
+  805d41:	48 89 e5             	mov    %rsp,%rbp
+  805d44:	41 57                	push   %r15
+  805d46:	48 83 ec 28          	sub    $0x28,%rsp
+  805d4a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d4a <cputchar+0xa>
+  805d51:	49 bb f6 32 00 00 00 	movabs $0x32f6,%r11
+  805d58:	00 00 00 
+  805d5b:	4c 01 d8             	add    %r11,%rax
+  805d5e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  805d61:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805d64:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  805d67:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  805d6b:	be 01 00 00 00       	mov    $0x1,%esi
+  805d70:	48 89 d7             	mov    %rdx,%rdi
+  805d73:	49 89 c7             	mov    %rax,%r15
+  805d76:	48 ba e5 8c ff ff ff 	movabs $0xffffffffffff8ce5,%rdx
+  805d7d:	ff ff ff 
+  805d80:	48 01 c2             	add    %rax,%rdx
+  805d83:	ff d2                	call   *%rdx
+}
+  805d85:	90                   	nop
+  805d86:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805d8a:	c9                   	leave
+  805d8b:	c3                   	ret
+
+0000000000805d8c <getchar>:
+
+int
+getchar(void)
+{
+  805d8c:	55                   	push   %rbp
+  805d8d:	48 89 e5             	mov    %rsp,%rbp
+  805d90:	41 57                	push   %r15
+  805d92:	48 83 ec 18          	sub    $0x18,%rsp
+  805d96:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d96 <getchar+0xa>
+  805d9d:	49 bb aa 32 00 00 00 	movabs $0x32aa,%r11
+  805da4:	00 00 00 
+  805da7:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805daa:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  805dae:	ba 01 00 00 00       	mov    $0x1,%edx
+  805db3:	48 89 ce             	mov    %rcx,%rsi
+  805db6:	bf 00 00 00 00       	mov    $0x0,%edi
+  805dbb:	49 89 c7             	mov    %rax,%r15
+  805dbe:	48 b9 49 a8 ff ff ff 	movabs $0xffffffffffffa849,%rcx
+  805dc5:	ff ff ff 
+  805dc8:	48 01 c1             	add    %rax,%rcx
+  805dcb:	ff d1                	call   *%rcx
+  805dcd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  805dd0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805dd4:	79 05                	jns    805ddb <getchar+0x4f>
+		return r;
+  805dd6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dd9:	eb 14                	jmp    805def <getchar+0x63>
+	if (r < 1)
+  805ddb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ddf:	7f 07                	jg     805de8 <getchar+0x5c>
+		return -E_EOF;
+  805de1:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  805de6:	eb 07                	jmp    805def <getchar+0x63>
+	return c;
+  805de8:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  805dec:	0f b6 c0             	movzbl %al,%eax
+}
+  805def:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805df3:	c9                   	leave
+  805df4:	c3                   	ret
+
+0000000000805df5 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  805df5:	55                   	push   %rbp
+  805df6:	48 89 e5             	mov    %rsp,%rbp
+  805df9:	41 57                	push   %r15
+  805dfb:	53                   	push   %rbx
+  805dfc:	48 83 ec 20          	sub    $0x20,%rsp
+  805e00:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e00 <iscons+0xb>
+  805e07:	49 bb 40 32 00 00 00 	movabs $0x3240,%r11
+  805e0e:	00 00 00 
+  805e11:	4c 01 db             	add    %r11,%rbx
+  805e14:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805e17:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  805e1b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e1e:	48 89 d6             	mov    %rdx,%rsi
+  805e21:	89 c7                	mov    %eax,%edi
+  805e23:	49 89 df             	mov    %rbx,%r15
+  805e26:	48 b8 02 a3 ff ff ff 	movabs $0xffffffffffffa302,%rax
+  805e2d:	ff ff ff 
+  805e30:	48 01 d8             	add    %rbx,%rax
+  805e33:	ff d0                	call   *%rax
+  805e35:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e38:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e3c:	79 05                	jns    805e43 <iscons+0x4e>
+		return r;
+  805e3e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e41:	eb 1b                	jmp    805e5e <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  805e43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e47:	8b 10                	mov    (%rax),%edx
+  805e49:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  805e50:	00 00 00 
+  805e53:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805e56:	39 c2                	cmp    %eax,%edx
+  805e58:	0f 94 c0             	sete   %al
+  805e5b:	0f b6 c0             	movzbl %al,%eax
+}
+  805e5e:	48 83 c4 20          	add    $0x20,%rsp
+  805e62:	5b                   	pop    %rbx
+  805e63:	41 5f                	pop    %r15
+  805e65:	5d                   	pop    %rbp
+  805e66:	c3                   	ret
+
+0000000000805e67 <opencons>:
+
+int
+opencons(void)
+{
+  805e67:	55                   	push   %rbp
+  805e68:	48 89 e5             	mov    %rsp,%rbp
+  805e6b:	41 57                	push   %r15
+  805e6d:	53                   	push   %rbx
+  805e6e:	48 83 ec 10          	sub    $0x10,%rsp
+  805e72:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e72 <opencons+0xb>
+  805e79:	49 bb ce 31 00 00 00 	movabs $0x31ce,%r11
+  805e80:	00 00 00 
+  805e83:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805e86:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805e8a:	48 89 c7             	mov    %rax,%rdi
+  805e8d:	49 89 df             	mov    %rbx,%r15
+  805e90:	48 b8 4c a2 ff ff ff 	movabs $0xffffffffffffa24c,%rax
+  805e97:	ff ff ff 
+  805e9a:	48 01 d8             	add    %rbx,%rax
+  805e9d:	ff d0                	call   *%rax
+  805e9f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ea2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ea6:	79 05                	jns    805ead <opencons+0x46>
+		return r;
+  805ea8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805eab:	eb 68                	jmp    805f15 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805ead:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805eb1:	ba 07 04 00 00       	mov    $0x407,%edx
+  805eb6:	48 89 c6             	mov    %rax,%rsi
+  805eb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ebe:	49 89 df             	mov    %rbx,%r15
+  805ec1:	48 b8 9d 8e ff ff ff 	movabs $0xffffffffffff8e9d,%rax
+  805ec8:	ff ff ff 
+  805ecb:	48 01 d8             	add    %rbx,%rax
+  805ece:	ff d0                	call   *%rax
+  805ed0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ed3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ed7:	79 05                	jns    805ede <opencons+0x77>
+		return r;
+  805ed9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805edc:	eb 37                	jmp    805f15 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  805ede:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ee2:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  805ee9:	00 00 00 
+  805eec:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805eef:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  805ef1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ef5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  805efc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f00:	48 89 c7             	mov    %rax,%rdi
+  805f03:	49 89 df             	mov    %rbx,%r15
+  805f06:	48 b8 d2 a1 ff ff ff 	movabs $0xffffffffffffa1d2,%rax
+  805f0d:	ff ff ff 
+  805f10:	48 01 d8             	add    %rbx,%rax
+  805f13:	ff d0                	call   *%rax
+}
+  805f15:	48 83 c4 10          	add    $0x10,%rsp
+  805f19:	5b                   	pop    %rbx
+  805f1a:	41 5f                	pop    %r15
+  805f1c:	5d                   	pop    %rbp
+  805f1d:	c3                   	ret
+
+0000000000805f1e <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805f1e:	55                   	push   %rbp
+  805f1f:	48 89 e5             	mov    %rsp,%rbp
+  805f22:	41 57                	push   %r15
+  805f24:	53                   	push   %rbx
+  805f25:	48 83 ec 30          	sub    $0x30,%rsp
+  805f29:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f29 <devcons_read+0xb>
+  805f30:	49 bb 17 31 00 00 00 	movabs $0x3117,%r11
+  805f37:	00 00 00 
+  805f3a:	4c 01 db             	add    %r11,%rbx
+  805f3d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805f41:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805f45:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  805f49:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805f4e:	75 19                	jne    805f69 <devcons_read+0x4b>
+		return 0;
+  805f50:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f55:	eb 55                	jmp    805fac <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  805f57:	49 89 df             	mov    %rbx,%r15
+  805f5a:	48 b8 48 8e ff ff ff 	movabs $0xffffffffffff8e48,%rax
+  805f61:	ff ff ff 
+  805f64:	48 01 d8             	add    %rbx,%rax
+  805f67:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  805f69:	49 89 df             	mov    %rbx,%r15
+  805f6c:	48 b8 44 8d ff ff ff 	movabs $0xffffffffffff8d44,%rax
+  805f73:	ff ff ff 
+  805f76:	48 01 d8             	add    %rbx,%rax
+  805f79:	ff d0                	call   *%rax
+  805f7b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805f7e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f82:	74 d3                	je     805f57 <devcons_read+0x39>
+	if (c < 0)
+  805f84:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805f88:	79 05                	jns    805f8f <devcons_read+0x71>
+		return c;
+  805f8a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f8d:	eb 1d                	jmp    805fac <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  805f8f:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  805f93:	75 07                	jne    805f9c <devcons_read+0x7e>
+		return 0;
+  805f95:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f9a:	eb 10                	jmp    805fac <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805f9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f9f:	89 c2                	mov    %eax,%edx
+  805fa1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fa5:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805fa7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805fac:	48 83 c4 30          	add    $0x30,%rsp
+  805fb0:	5b                   	pop    %rbx
+  805fb1:	41 5f                	pop    %r15
+  805fb3:	5d                   	pop    %rbp
+  805fb4:	c3                   	ret
+
+0000000000805fb5 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805fb5:	55                   	push   %rbp
+  805fb6:	48 89 e5             	mov    %rsp,%rbp
+  805fb9:	41 57                	push   %r15
+  805fbb:	53                   	push   %rbx
+  805fbc:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805fc3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fc3 <devcons_write+0xe>
+  805fca:	49 bb 7d 30 00 00 00 	movabs $0x307d,%r11
+  805fd1:	00 00 00 
+  805fd4:	4c 01 db             	add    %r11,%rbx
+  805fd7:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  805fde:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  805fe5:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  805fec:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805ff3:	e9 80 00 00 00       	jmp    806078 <devcons_write+0xc3>
+		m = n - tot;
+  805ff8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805fff:	89 c2                	mov    %eax,%edx
+  806001:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806004:	29 c2                	sub    %eax,%edx
+  806006:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806009:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80600c:	83 f8 7f             	cmp    $0x7f,%eax
+  80600f:	76 07                	jbe    806018 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806011:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806018:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80601b:	48 63 d0             	movslq %eax,%rdx
+  80601e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806021:	48 63 c8             	movslq %eax,%rcx
+  806024:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80602b:	48 01 c1             	add    %rax,%rcx
+  80602e:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806035:	48 89 ce             	mov    %rcx,%rsi
+  806038:	48 89 c7             	mov    %rax,%rdi
+  80603b:	49 89 df             	mov    %rbx,%r15
+  80603e:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  806045:	ff ff ff 
+  806048:	48 01 d8             	add    %rbx,%rax
+  80604b:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  80604d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806050:	48 63 d0             	movslq %eax,%rdx
+  806053:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80605a:	48 89 d6             	mov    %rdx,%rsi
+  80605d:	48 89 c7             	mov    %rax,%rdi
+  806060:	49 89 df             	mov    %rbx,%r15
+  806063:	48 b8 e5 8c ff ff ff 	movabs $0xffffffffffff8ce5,%rax
+  80606a:	ff ff ff 
+  80606d:	48 01 d8             	add    %rbx,%rax
+  806070:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806072:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806075:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806078:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80607b:	48 98                	cltq
+  80607d:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806084:	0f 82 6e ff ff ff    	jb     805ff8 <devcons_write+0x43>
+	}
+	return tot;
+  80608a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80608d:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806094:	5b                   	pop    %rbx
+  806095:	41 5f                	pop    %r15
+  806097:	5d                   	pop    %rbp
+  806098:	c3                   	ret
+
+0000000000806099 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806099:	55                   	push   %rbp
+  80609a:	48 89 e5             	mov    %rsp,%rbp
+  80609d:	48 83 ec 08          	sub    $0x8,%rsp
+  8060a1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060a1 <devcons_close+0x8>
+  8060a8:	49 bb 9f 2f 00 00 00 	movabs $0x2f9f,%r11
+  8060af:	00 00 00 
+  8060b2:	4c 01 d8             	add    %r11,%rax
+  8060b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8060b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8060be:	c9                   	leave
+  8060bf:	c3                   	ret
+
+00000000008060c0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8060c0:	55                   	push   %rbp
+  8060c1:	48 89 e5             	mov    %rsp,%rbp
+  8060c4:	41 57                	push   %r15
+  8060c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8060ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060ca <devcons_stat+0xa>
+  8060d1:	49 bb 76 2f 00 00 00 	movabs $0x2f76,%r11
+  8060d8:	00 00 00 
+  8060db:	4c 01 d8             	add    %r11,%rax
+  8060de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8060e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8060e6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8060ea:	48 b9 5d e3 ff ff ff 	movabs $0xffffffffffffe35d,%rcx
+  8060f1:	ff ff ff 
+  8060f4:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8060f8:	48 89 ce             	mov    %rcx,%rsi
+  8060fb:	48 89 d7             	mov    %rdx,%rdi
+  8060fe:	49 89 c7             	mov    %rax,%r15
+  806101:	48 ba e1 81 ff ff ff 	movabs $0xffffffffffff81e1,%rdx
+  806108:	ff ff ff 
+  80610b:	48 01 c2             	add    %rax,%rdx
+  80610e:	ff d2                	call   *%rdx
+	return 0;
+  806110:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806115:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806119:	c9                   	leave
+  80611a:	c3                   	ret
+
+000000000080611b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80611b:	55                   	push   %rbp
+  80611c:	48 89 e5             	mov    %rsp,%rbp
+  80611f:	41 57                	push   %r15
+  806121:	41 54                	push   %r12
+  806123:	53                   	push   %rbx
+  806124:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80612b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80612b <_panic+0x10>
+  806132:	49 bb 15 2f 00 00 00 	movabs $0x2f15,%r11
+  806139:	00 00 00 
+  80613c:	4c 01 db             	add    %r11,%rbx
+  80613f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  806146:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80614c:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  806153:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80615a:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  806161:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  806168:	84 c0                	test   %al,%al
+  80616a:	74 26                	je     806192 <_panic+0x77>
+  80616c:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  806173:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80617a:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80617e:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  806182:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  806186:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80618a:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80618e:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  806192:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  806199:	00 00 00 
+  80619c:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8061a3:	00 00 00 
+  8061a6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8061aa:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8061b1:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8061b8:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8061bf:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8061c6:	ff ff ff 
+  8061c9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8061cd:	4c 8b 20             	mov    (%rax),%r12
+  8061d0:	49 89 df             	mov    %rbx,%r15
+  8061d3:	48 b8 f4 8d ff ff ff 	movabs $0xffffffffffff8df4,%rax
+  8061da:	ff ff ff 
+  8061dd:	48 01 d8             	add    %rbx,%rax
+  8061e0:	ff d0                	call   *%rax
+  8061e2:	89 c6                	mov    %eax,%esi
+  8061e4:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8061ea:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8061f1:	41 89 d0             	mov    %edx,%r8d
+  8061f4:	48 89 c1             	mov    %rax,%rcx
+  8061f7:	4c 89 e2             	mov    %r12,%rdx
+  8061fa:	48 b8 68 e3 ff ff ff 	movabs $0xffffffffffffe368,%rax
+  806201:	ff ff ff 
+  806204:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806208:	48 89 c7             	mov    %rax,%rdi
+  80620b:	49 89 df             	mov    %rbx,%r15
+  80620e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806213:	49 b9 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%r9
+  80621a:	ff ff ff 
+  80621d:	49 01 d9             	add    %rbx,%r9
+  806220:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  806223:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80622a:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  806231:	48 89 d6             	mov    %rdx,%rsi
+  806234:	48 89 c7             	mov    %rax,%rdi
+  806237:	49 89 df             	mov    %rbx,%r15
+  80623a:	48 b8 3f 73 ff ff ff 	movabs $0xffffffffffff733f,%rax
+  806241:	ff ff ff 
+  806244:	48 01 d8             	add    %rbx,%rax
+  806247:	ff d0                	call   *%rax
+	cprintf("\n");
+  806249:	48 b8 8b e3 ff ff ff 	movabs $0xffffffffffffe38b,%rax
+  806250:	ff ff ff 
+  806253:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806257:	48 89 c7             	mov    %rax,%rdi
+  80625a:	49 89 df             	mov    %rbx,%r15
+  80625d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806262:	48 ba 1f 74 ff ff ff 	movabs $0xffffffffffff741f,%rdx
+  806269:	ff ff ff 
+  80626c:	48 01 da             	add    %rbx,%rdx
+  80626f:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  806271:	cc                   	int3
+  806272:	eb fd                	jmp    806271 <_panic+0x156>
+
+0000000000806274 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806274:	55                   	push   %rbp
+  806275:	48 89 e5             	mov    %rsp,%rbp
+  806278:	41 57                	push   %r15
+  80627a:	53                   	push   %rbx
+  80627b:	48 83 ec 20          	sub    $0x20,%rsp
+  80627f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80627f <set_pgfault_handler+0xb>
+  806286:	49 bb c1 2d 00 00 00 	movabs $0x2dc1,%r11
+  80628d:	00 00 00 
+  806290:	4c 01 db             	add    %r11,%rbx
+  806293:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806297:	49 89 df             	mov    %rbx,%r15
+  80629a:	48 b8 f4 8d ff ff ff 	movabs $0xffffffffffff8df4,%rax
+  8062a1:	ff ff ff 
+  8062a4:	48 01 d8             	add    %rbx,%rax
+  8062a7:	ff d0                	call   *%rax
+  8062a9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  8062ac:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  8062b3:	00 00 00 
+  8062b6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8062ba:	48 85 c0             	test   %rax,%rax
+  8062bd:	75 6b                	jne    80632a <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  8062bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062c2:	ba 07 00 00 00       	mov    $0x7,%edx
+  8062c7:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8062cc:	48 89 ce             	mov    %rcx,%rsi
+  8062cf:	89 c7                	mov    %eax,%edi
+  8062d1:	49 89 df             	mov    %rbx,%r15
+  8062d4:	48 b8 9d 8e ff ff ff 	movabs $0xffffffffffff8e9d,%rax
+  8062db:	ff ff ff 
+  8062de:	48 01 d8             	add    %rbx,%rax
+  8062e1:	ff d0                	call   *%rax
+  8062e3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  8062e6:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8062ea:	74 3e                	je     80632a <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  8062ec:	48 b8 90 e3 ff ff ff 	movabs $0xffffffffffffe390,%rax
+  8062f3:	ff ff ff 
+  8062f6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8062fa:	48 89 c2             	mov    %rax,%rdx
+  8062fd:	be 23 00 00 00       	mov    $0x23,%esi
+  806302:	48 b8 be e3 ff ff ff 	movabs $0xffffffffffffe3be,%rax
+  806309:	ff ff ff 
+  80630c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806310:	48 89 c7             	mov    %rax,%rdi
+  806313:	49 89 df             	mov    %rbx,%r15
+  806316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80631b:	48 b9 db d0 ff ff ff 	movabs $0xffffffffffffd0db,%rcx
+  806322:	ff ff ff 
+  806325:	48 01 d9             	add    %rbx,%rcx
+  806328:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80632a:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806331:	00 00 00 
+  806334:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806338:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  80633c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80633f:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806346:	ff ff ff 
+  806349:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80634d:	48 89 d6             	mov    %rdx,%rsi
+  806350:	89 c7                	mov    %eax,%edi
+  806352:	49 89 df             	mov    %rbx,%r15
+  806355:	48 b8 93 90 ff ff ff 	movabs $0xffffffffffff9093,%rax
+  80635c:	ff ff ff 
+  80635f:	48 01 d8             	add    %rbx,%rax
+  806362:	ff d0                	call   *%rax
+}
+  806364:	90                   	nop
+  806365:	48 83 c4 20          	add    $0x20,%rsp
+  806369:	5b                   	pop    %rbx
+  80636a:	41 5f                	pop    %r15
+  80636c:	5d                   	pop    %rbp
+  80636d:	c3                   	ret
+
+000000000080636e <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  80636e:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806371:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806378:	00 00 00 
+call *%rax
+  80637b:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  80637d:	58                   	pop    %rax
+	popq %rax;
+  80637e:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  80637f:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806386:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  80638a:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  80638e:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806392:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806396:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  80639a:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  80639d:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  8063a1:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8063a5:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8063aa:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8063af:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8063b4:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8063b9:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8063be:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8063c3:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8063c8:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8063cd:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8063d2:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8063d7:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8063dc:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8063e1:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8063e6:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8063eb:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  8063ef:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  8063f3:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  8063f4:	5c                   	pop    %rsp
+	ret;			//return
+  8063f5:	c3                   	ret
+
+00000000008063f6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8063f6:	55                   	push   %rbp
+  8063f7:	48 89 e5             	mov    %rsp,%rbp
+  8063fa:	41 57                	push   %r15
+  8063fc:	53                   	push   %rbx
+  8063fd:	48 83 ec 30          	sub    $0x30,%rsp
+  806401:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806401 <ipc_recv+0xb>
+  806408:	49 bb 3f 2c 00 00 00 	movabs $0x2c3f,%r11
+  80640f:	00 00 00 
+  806412:	4c 01 db             	add    %r11,%rbx
+  806415:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806419:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80641d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  806421:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806426:	75 0e                	jne    806436 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  806428:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80642f:	00 00 00 
+  806432:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  806436:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80643a:	48 89 c7             	mov    %rax,%rdi
+  80643d:	49 89 df             	mov    %rbx,%r15
+  806440:	48 b8 c6 91 ff ff ff 	movabs $0xffffffffffff91c6,%rax
+  806447:	ff ff ff 
+  80644a:	48 01 d8             	add    %rbx,%rax
+  80644d:	ff d0                	call   *%rax
+  80644f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  806452:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806457:	74 2a                	je     806483 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  806459:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80645d:	75 19                	jne    806478 <ipc_recv+0x82>
+  80645f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806466:	ff ff ff 
+  806469:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80646d:	48 8b 00             	mov    (%rax),%rax
+  806470:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806476:	eb 05                	jmp    80647d <ipc_recv+0x87>
+  806478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80647d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806481:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806483:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806488:	74 2a                	je     8064b4 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  80648a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80648e:	75 19                	jne    8064a9 <ipc_recv+0xb3>
+  806490:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806497:	ff ff ff 
+  80649a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80649e:	48 8b 00             	mov    (%rax),%rax
+  8064a1:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8064a7:	eb 05                	jmp    8064ae <ipc_recv+0xb8>
+  8064a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064ae:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8064b2:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  8064b4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8064b8:	74 05                	je     8064bf <ipc_recv+0xc9>
+		return res;
+  8064ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064bd:	eb 17                	jmp    8064d6 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  8064bf:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8064c6:	ff ff ff 
+  8064c9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064cd:	48 8b 00             	mov    (%rax),%rax
+  8064d0:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8064d6:	48 83 c4 30          	add    $0x30,%rsp
+  8064da:	5b                   	pop    %rbx
+  8064db:	41 5f                	pop    %r15
+  8064dd:	5d                   	pop    %rbp
+  8064de:	c3                   	ret
+
+00000000008064df <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8064df:	55                   	push   %rbp
+  8064e0:	48 89 e5             	mov    %rsp,%rbp
+  8064e3:	41 57                	push   %r15
+  8064e5:	53                   	push   %rbx
+  8064e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8064ea:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064ea <ipc_send+0xb>
+  8064f1:	49 bb 56 2b 00 00 00 	movabs $0x2b56,%r11
+  8064f8:	00 00 00 
+  8064fb:	4c 01 db             	add    %r11,%rbx
+  8064fe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806501:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806504:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806508:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  80650b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806510:	75 0e                	jne    806520 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806512:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806519:	00 00 00 
+  80651c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  806520:	90                   	nop
+  806521:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806524:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806527:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80652b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80652e:	89 c7                	mov    %eax,%edi
+  806530:	49 89 df             	mov    %rbx,%r15
+  806533:	48 b8 5c 91 ff ff ff 	movabs $0xffffffffffff915c,%rax
+  80653a:	ff ff ff 
+  80653d:	48 01 d8             	add    %rbx,%rax
+  806540:	ff d0                	call   *%rax
+  806542:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  806545:	74 da                	je     806521 <ipc_send+0x42>
+		;
+}
+  806547:	90                   	nop
+  806548:	90                   	nop
+  806549:	48 83 c4 20          	add    $0x20,%rsp
+  80654d:	5b                   	pop    %rbx
+  80654e:	41 5f                	pop    %r15
+  806550:	5d                   	pop    %rbp
+  806551:	c3                   	ret
+
+0000000000806552 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  806552:	55                   	push   %rbp
+  806553:	48 89 e5             	mov    %rsp,%rbp
+  806556:	41 57                	push   %r15
+  806558:	53                   	push   %rbx
+  806559:	48 83 ec 40          	sub    $0x40,%rsp
+  80655d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80655d <ipc_call+0xb>
+  806564:	49 bb e3 2a 00 00 00 	movabs $0x2ae3,%r11
+  80656b:	00 00 00 
+  80656e:	4c 01 db             	add    %r11,%rbx
+  806571:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806574:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806577:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80657b:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80657e:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806582:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806586:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80658b:	75 0e                	jne    80659b <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  80658d:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806594:	00 00 00 
+  806597:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80659b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8065a0:	75 0e                	jne    8065b0 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8065a2:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8065a9:	00 00 00 
+  8065ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8065b0:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8065b3:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8065b7:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8065ba:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8065be:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8065c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8065c7:	49 89 f8             	mov    %rdi,%r8
+  8065ca:	89 c7                	mov    %eax,%edi
+  8065cc:	49 89 df             	mov    %rbx,%r15
+  8065cf:	48 b8 1f 92 ff ff ff 	movabs $0xffffffffffff921f,%rax
+  8065d6:	ff ff ff 
+  8065d9:	48 01 d8             	add    %rbx,%rax
+  8065dc:	ff d0                	call   *%rax
+  8065de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8065e1:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8065e6:	74 2a                	je     806612 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8065e8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065ec:	75 19                	jne    806607 <ipc_call+0xb5>
+  8065ee:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8065f5:	ff ff ff 
+  8065f8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8065fc:	48 8b 00             	mov    (%rax),%rax
+  8065ff:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806605:	eb 05                	jmp    80660c <ipc_call+0xba>
+  806607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80660c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806610:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806612:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806616:	74 05                	je     80661d <ipc_call+0xcb>
+		return r;
+  806618:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80661b:	eb 17                	jmp    806634 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  80661d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806624:	ff ff ff 
+  806627:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80662b:	48 8b 00             	mov    (%rax),%rax
+  80662e:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806634:	48 83 c4 40          	add    $0x40,%rsp
+  806638:	5b                   	pop    %rbx
+  806639:	41 5f                	pop    %r15
+  80663b:	5d                   	pop    %rbp
+  80663c:	c3                   	ret
+
+000000000080663d <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  80663d:	55                   	push   %rbp
+  80663e:	48 89 e5             	mov    %rsp,%rbp
+  806641:	41 57                	push   %r15
+  806643:	53                   	push   %rbx
+  806644:	48 83 ec 70          	sub    $0x70,%rsp
+  806648:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806648 <ipc_callw+0xb>
+  80664f:	49 bb f8 29 00 00 00 	movabs $0x29f8,%r11
+  806656:	00 00 00 
+  806659:	4c 01 db             	add    %r11,%rbx
+  80665c:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  80665f:	89 75 98             	mov    %esi,-0x68(%rbp)
+  806662:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806666:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  80666a:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  80666f:	76 0a                	jbe    80667b <ipc_callw+0x3e>
+		return -E_INVAL;
+  806671:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806676:	e9 b7 00 00 00       	jmp    806732 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  80667b:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80667f:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806683:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806687:	48 89 ce             	mov    %rcx,%rsi
+  80668a:	48 89 c7             	mov    %rax,%rdi
+  80668d:	49 89 df             	mov    %rbx,%r15
+  806690:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  806697:	ff ff ff 
+  80669a:	48 01 d8             	add    %rbx,%rax
+  80669d:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  80669f:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8066a6:	00 
+  8066a7:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8066ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066af:	48 01 d0             	add    %rdx,%rax
+  8066b2:	48 83 e8 01          	sub    $0x1,%rax
+  8066b6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8066ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8066c3:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8066c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066cb:	48 29 d0             	sub    %rdx,%rax
+  8066ce:	48 c1 e8 03          	shr    $0x3,%rax
+  8066d2:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  8066d6:	89 c1                	mov    %eax,%ecx
+  8066d8:	8b 75 98             	mov    -0x68(%rbp),%esi
+  8066db:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  8066df:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8066e2:	49 89 d1             	mov    %rdx,%r9
+  8066e5:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8066ec:	00 00 00 
+  8066ef:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8066f6:	00 00 00 
+  8066f9:	89 c7                	mov    %eax,%edi
+  8066fb:	49 89 df             	mov    %rbx,%r15
+  8066fe:	48 b8 1f 92 ff ff ff 	movabs $0xffffffffffff921f,%rax
+  806705:	ff ff ff 
+  806708:	48 01 d8             	add    %rbx,%rax
+  80670b:	ff d0                	call   *%rax
+  80670d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806710:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806714:	74 05                	je     80671b <ipc_callw+0xde>
+		return r;
+  806716:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806719:	eb 17                	jmp    806732 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  80671b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806722:	ff ff ff 
+  806725:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806729:	48 8b 00             	mov    (%rax),%rax
+  80672c:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806732:	48 83 c4 70          	add    $0x70,%rsp
+  806736:	5b                   	pop    %rbx
+  806737:	41 5f                	pop    %r15
+  806739:	5d                   	pop    %rbp
+  80673a:	c3                   	ret
+
+000000000080673b <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  80673b:	55                   	push   %rbp
+  80673c:	48 89 e5             	mov    %rsp,%rbp
+  80673f:	41 57                	push   %r15
+  806741:	53                   	push   %rbx
+  806742:	48 83 ec 40          	sub    $0x40,%rsp
+  806746:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806746 <ipc_callv+0xb>
+  80674d:	49 bb fa 28 00 00 00 	movabs $0x28fa,%r11
+  806754:	00 00 00 
+  806757:	4c 01 db             	add    %r11,%rbx
+  80675a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80675d:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806760:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806764:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806767:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  80676b:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  80676f:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806776:	00 00 00 
+  806779:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  80677d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806781:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806785:	74 11                	je     806798 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806787:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80678b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  80678f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806792:	c1 e0 14             	shl    $0x14,%eax
+  806795:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806798:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  80679c:	74 14                	je     8067b2 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  80679e:	8b 45 20             	mov    0x20(%rbp),%eax
+  8067a1:	83 e8 01             	sub    $0x1,%eax
+  8067a4:	48 63 d0             	movslq %eax,%rdx
+  8067a7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8067ab:	48 09 d0             	or     %rdx,%rax
+  8067ae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  8067b2:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8067b5:	c1 e0 10             	shl    $0x10,%eax
+  8067b8:	0b 45 10             	or     0x10(%rbp),%eax
+  8067bb:	89 c1                	mov    %eax,%ecx
+  8067bd:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  8067c0:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8067c4:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8067c8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8067cc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8067cf:	4d 89 c1             	mov    %r8,%r9
+  8067d2:	49 89 f8             	mov    %rdi,%r8
+  8067d5:	89 c7                	mov    %eax,%edi
+  8067d7:	49 89 df             	mov    %rbx,%r15
+  8067da:	48 b8 1f 92 ff ff ff 	movabs $0xffffffffffff921f,%rax
+  8067e1:	ff ff ff 
+  8067e4:	48 01 d8             	add    %rbx,%rax
+  8067e7:	ff d0                	call   *%rax
+  8067e9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8067ec:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8067f0:	74 05                	je     8067f7 <ipc_callv+0xbc>
+		return r;
+  8067f2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8067f5:	eb 17                	jmp    80680e <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8067f7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8067fe:	ff ff ff 
+  806801:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806805:	48 8b 00             	mov    (%rax),%rax
+  806808:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80680e:	48 83 c4 40          	add    $0x40,%rsp
+  806812:	5b                   	pop    %rbx
+  806813:	41 5f                	pop    %r15
+  806815:	5d                   	pop    %rbp
+  806816:	c3                   	ret
+
+0000000000806817 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806817:	55                   	push   %rbp
+  806818:	48 89 e5             	mov    %rsp,%rbp
+  80681b:	41 57                	push   %r15
+  80681d:	53                   	push   %rbx
+  80681e:	48 83 ec 40          	sub    $0x40,%rsp
+  806822:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806822 <ipc_reply_recv+0xb>
+  806829:	49 bb 1e 28 00 00 00 	movabs $0x281e,%r11
+  806830:	00 00 00 
+  806833:	4c 01 db             	add    %r11,%rbx
+  806836:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806839:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80683c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806840:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806843:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806847:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  80684b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806850:	75 0e                	jne    806860 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806852:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806859:	00 00 00 
+  80685c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806860:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806865:	75 0e                	jne    806875 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806867:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80686e:	00 00 00 
+  806871:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806875:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806878:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  80687c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806880:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806883:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806887:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80688a:	4d 89 c1             	mov    %r8,%r9
+  80688d:	49 89 f8             	mov    %rdi,%r8
+  806890:	89 c7                	mov    %eax,%edi
+  806892:	49 89 df             	mov    %rbx,%r15
+  806895:	48 b8 93 92 ff ff ff 	movabs $0xffffffffffff9293,%rax
+  80689c:	ff ff ff 
+  80689f:	48 01 d8             	add    %rbx,%rax
+  8068a2:	ff d0                	call   *%rax
+  8068a4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  8068a7:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8068ac:	74 2a                	je     8068d8 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8068ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068b2:	75 19                	jne    8068cd <ipc_reply_recv+0xb6>
+  8068b4:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068bb:	ff ff ff 
+  8068be:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068c2:	48 8b 00             	mov    (%rax),%rax
+  8068c5:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8068cb:	eb 05                	jmp    8068d2 <ipc_reply_recv+0xbb>
+  8068cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8068d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8068d6:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  8068d8:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  8068dd:	74 2a                	je     806909 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8068df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068e3:	75 19                	jne    8068fe <ipc_reply_recv+0xe7>
+  8068e5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068ec:	ff ff ff 
+  8068ef:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068f3:	48 8b 00             	mov    (%rax),%rax
+  8068f6:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8068fc:	eb 05                	jmp    806903 <ipc_reply_recv+0xec>
+  8068fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  806903:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806907:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806909:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80690d:	74 05                	je     806914 <ipc_reply_recv+0xfd>
+		return r;
+  80690f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806912:	eb 17                	jmp    80692b <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806914:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80691b:	ff ff ff 
+  80691e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806922:	48 8b 00             	mov    (%rax),%rax
+  806925:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80692b:	48 83 c4 40          	add    $0x40,%rsp
+  80692f:	5b                   	pop    %rbx
+  806930:	41 5f                	pop    %r15
+  806932:	5d                   	pop    %rbp
+  806933:	c3                   	ret
+
+0000000000806934 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806934:	55                   	push   %rbp
+  806935:	48 89 e5             	mov    %rsp,%rbp
+  806938:	41 57                	push   %r15
+  80693a:	53                   	push   %rbx
+  80693b:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806942:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806942 <ipc_window_batch+0xe>
+  806949:	49 bb fe 26 00 00 00 	movabs $0x26fe,%r11
+  806950:	00 00 00 
+  806953:	4c 01 db             	add    %r11,%rbx
+  806956:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  80695c:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806963:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806969:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  80696f:	e9 15 01 00 00       	jmp    806a89 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806974:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  80697a:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80697d:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806984:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806987:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80698a:	39 c2                	cmp    %eax,%edx
+  80698c:	0f 4e c2             	cmovle %edx,%eax
+  80698f:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806992:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806999:	eb 6b                	jmp    806a06 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  80699b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80699e:	48 98                	cltq
+  8069a0:	48 c1 e0 05          	shl    $0x5,%rax
+  8069a4:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8069a8:	48 01 e8             	add    %rbp,%rax
+  8069ab:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  8069b1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  8069b7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069ba:	c1 e0 0c             	shl    $0xc,%eax
+  8069bd:	48 63 d0             	movslq %eax,%rdx
+  8069c0:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  8069c7:	48 01 c2             	add    %rax,%rdx
+  8069ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069cd:	48 98                	cltq
+  8069cf:	48 c1 e0 05          	shl    $0x5,%rax
+  8069d3:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8069d7:	48 01 e8             	add    %rbp,%rax
+  8069da:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  8069e0:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  8069e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069e6:	48 98                	cltq
+  8069e8:	48 c1 e0 05          	shl    $0x5,%rax
+  8069ec:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  8069f0:	48 01 e8             	add    %rbp,%rax
+  8069f3:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  8069fa:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806a00:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806a02:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806a06:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a09:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806a0c:	7c 8d                	jl     80699b <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806a0e:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806a15:	74 27                	je     806a3e <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806a17:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806a1a:	48 63 d0             	movslq %eax,%rdx
+  806a1d:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806a24:	48 89 d6             	mov    %rdx,%rsi
+  806a27:	48 89 c7             	mov    %rax,%rdi
+  806a2a:	49 89 df             	mov    %rbx,%r15
+  806a2d:	48 b8 36 95 ff ff ff 	movabs $0xffffffffffff9536,%rax
+  806a34:	ff ff ff 
+  806a37:	48 01 d8             	add    %rbx,%rax
+  806a3a:	ff d0                	call   *%rax
+  806a3c:	eb 25                	jmp    806a63 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806a3e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806a41:	48 63 d0             	movslq %eax,%rdx
+  806a44:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806a4b:	48 89 d6             	mov    %rdx,%rsi
+  806a4e:	48 89 c7             	mov    %rax,%rdi
+  806a51:	49 89 df             	mov    %rbx,%r15
+  806a54:	48 b8 94 95 ff ff ff 	movabs $0xffffffffffff9594,%rax
+  806a5b:	ff ff ff 
+  806a5e:	48 01 d8             	add    %rbx,%rax
+  806a61:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806a63:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806a66:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806a6a:	79 05                	jns    806a71 <ipc_window_batch+0x13d>
+			return r;
+  806a6c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a6f:	eb 2a                	jmp    806a9b <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806a71:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806a74:	c1 e0 0c             	shl    $0xc,%eax
+  806a77:	48 98                	cltq
+  806a79:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806a80:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806a83:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806a89:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806a90:	0f 8f de fe ff ff    	jg     806974 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806a96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a9b:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806aa2:	5b                   	pop    %rbx
+  806aa3:	41 5f                	pop    %r15
+  806aa5:	5d                   	pop    %rbp
+  806aa6:	c3                   	ret
+
+0000000000806aa7 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806aa7:	55                   	push   %rbp
+  806aa8:	48 89 e5             	mov    %rsp,%rbp
+  806aab:	48 83 ec 10          	sub    $0x10,%rsp
+  806aaf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806aaf <ipc_map_window+0x8>
+  806ab6:	49 bb 91 25 00 00 00 	movabs $0x2591,%r11
+  806abd:	00 00 00 
+  806ac0:	4c 01 d8             	add    %r11,%rax
+  806ac3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806ac7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806aca:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806acd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806ad1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806ad6:	bf 01 00 00 00       	mov    $0x1,%edi
+  806adb:	49 b8 f4 d8 ff ff ff 	movabs $0xffffffffffffd8f4,%r8
+  806ae2:	ff ff ff 
+  806ae5:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806ae9:	ff d0                	call   *%rax
+}
+  806aeb:	c9                   	leave
+  806aec:	c3                   	ret
+
+0000000000806aed <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806aed:	55                   	push   %rbp
+  806aee:	48 89 e5             	mov    %rsp,%rbp
+  806af1:	48 83 ec 10          	sub    $0x10,%rsp
+  806af5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806af5 <ipc_unmap_window+0x8>
+  806afc:	49 bb 4b 25 00 00 00 	movabs $0x254b,%r11
+  806b03:	00 00 00 
+  806b06:	4c 01 d8             	add    %r11,%rax
+  806b09:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806b0d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806b10:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806b13:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806b17:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806b1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  806b21:	49 b8 f4 d8 ff ff ff 	movabs $0xffffffffffffd8f4,%r8
+  806b28:	ff ff ff 
+  806b2b:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806b2f:	ff d0                	call   *%rax
+}
+  806b31:	c9                   	leave
+  806b32:	c3                   	ret
+
+0000000000806b33 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806b33:	55                   	push   %rbp
+  806b34:	48 89 e5             	mov    %rsp,%rbp
+  806b37:	48 83 ec 18          	sub    $0x18,%rsp
+  806b3b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806b3b <ipc_find_env+0x8>
+  806b42:	49 bb 05 25 00 00 00 	movabs $0x2505,%r11
+  806b49:	00 00 00 
+  806b4c:	4c 01 d8             	add    %r11,%rax
+  806b4f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806b52:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806b59:	eb 57                	jmp    806bb2 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806b5b:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806b62:	ff ff ff 
+  806b65:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806b69:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806b6c:	48 63 d2             	movslq %edx,%rdx
+  806b6f:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806b76:	48 01 ca             	add    %rcx,%rdx
+  806b79:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806b80:	8b 12                	mov    (%rdx),%edx
+  806b82:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806b85:	75 27                	jne    806bae <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806b87:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806b8e:	ff ff ff 
+  806b91:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806b95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806b98:	48 98                	cltq
+  806b9a:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806ba1:	48 01 d0             	add    %rdx,%rax
+  806ba4:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806baa:	8b 00                	mov    (%rax),%eax
+  806bac:	eb 12                	jmp    806bc0 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806bae:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806bb2:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806bb9:	7e a0                	jle    806b5b <ipc_find_env+0x28>
+	}
+	return 0;
+  806bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806bc0:	c9                   	leave
+  806bc1:	c3                   	ret
+
+0000000000806bc2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806bc2:	55                   	push   %rbp
+  806bc3:	48 89 e5             	mov    %rsp,%rbp
+  806bc6:	48 83 ec 18          	sub    $0x18,%rsp
+  806bca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806bca <pageref+0x8>
+  806bd1:	49 bb 76 24 00 00 00 	movabs $0x2476,%r11
+  806bd8:	00 00 00 
+  806bdb:	4c 01 d8             	add    %r11,%rax
+  806bde:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806be2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806be6:	48 89 d1             	mov    %rdx,%rcx
+  806be9:	48 c1 e9 15          	shr    $0x15,%rcx
+  806bed:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806bf4:	ff ff ff 
+  806bf7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806bfb:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806bff:	83 e2 01             	and    $0x1,%edx
+  806c02:	48 85 d2             	test   %rdx,%rdx
+  806c05:	75 07                	jne    806c0e <pageref+0x4c>
+		return 0;
+  806c07:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c0c:	eb 64                	jmp    806c72 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806c0e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806c12:	48 89 d1             	mov    %rdx,%rcx
+  806c15:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806c19:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806c20:	ff ff ff 
+  806c23:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806c27:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806c2b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806c2f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806c33:	83 e2 01             	and    $0x1,%edx
+  806c36:	48 85 d2             	test   %rdx,%rdx
+  806c39:	75 07                	jne    806c42 <pageref+0x80>
+		return 0;
+  806c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c40:	eb 30                	jmp    806c72 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806c42:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806c46:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806c4a:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806c51:	ff ff ff 
+  806c54:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806c58:	48 89 d0             	mov    %rdx,%rax
+  806c5b:	48 01 c0             	add    %rax,%rax
+  806c5e:	48 01 d0             	add    %rdx,%rax
+  806c61:	48 c1 e0 03          	shl    $0x3,%rax
+  806c65:	48 01 c8             	add    %rcx,%rax
+  806c68:	48 83 c0 08          	add    $0x8,%rax
+  806c6c:	0f b7 00             	movzwl (%rax),%eax
+  806c6f:	0f b7 c0             	movzwl %ax,%eax
+}
+  806c72:	c9                   	leave
+  806c73:	c3                   	ret
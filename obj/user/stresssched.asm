@@ -0,0 +1,10671 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 30 03 00 00       	call   800371 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  800069:	49 89 df             	mov    %rbx,%r15
+  80006c:	48 b8 e7 90 ff ff ff 	movabs $0xffffffffffff90e7,%rax
+  800073:	ff ff ff 
+  800076:	48 01 d8             	add    %rbx,%rax
+  800079:	ff d0                	call   *%rax
+  80007b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+
+	// Fork a CPU-bound env that never yields.  The scheduler should
+	// demote it, while the envs below, which yield all the time, keep
+	// their priority and stay responsive.
+	if (fork() == 0) {
+  80007e:	49 89 df             	mov    %rbx,%r15
+  800081:	48 b8 1f a1 ff ff ff 	movabs $0xffffffffffffa11f,%rax
+  800088:	ff ff ff 
+  80008b:	48 01 d8             	add    %rbx,%rax
+  80008e:	ff d0                	call   *%rax
+  800090:	85 c0                	test   %eax,%eax
+  800092:	0f 85 90 00 00 00    	jne    800128 <umain+0xe5>
+		for (i = 0; i < 10000000; i++)
+  800098:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80009f:	eb 21                	jmp    8000c2 <umain+0x7f>
+			counter++;
+  8000a1:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  8000a8:	00 00 00 
+  8000ab:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8000ae:	8d 50 01             	lea    0x1(%rax),%edx
+  8000b1:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  8000b8:	00 00 00 
+  8000bb:	89 14 03             	mov    %edx,(%rbx,%rax,1)
+		for (i = 0; i < 10000000; i++)
+  8000be:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8000c2:	81 7d ec 7f 96 98 00 	cmpl   $0x98967f,-0x14(%rbp)
+  8000c9:	7e d6                	jle    8000a1 <umain+0x5e>
+		cprintf("[%08x] stresssched hog done at prio %d\n",
+			thisenv->env_id, thisenv->env_prio);
+  8000cb:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8000d2:	ff ff ff 
+  8000d5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8000d9:	48 8b 00             	mov    (%rax),%rax
+  8000dc:	8b 90 ec 00 00 00    	mov    0xec(%rax),%edx
+  8000e2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8000e9:	ff ff ff 
+  8000ec:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8000f0:	48 8b 00             	mov    (%rax),%rax
+  8000f3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] stresssched hog done at prio %d\n",
+  8000f9:	89 c6                	mov    %eax,%esi
+  8000fb:	48 b8 d0 dd ff ff ff 	movabs $0xffffffffffffddd0,%rax
+  800102:	ff ff ff 
+  800105:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800109:	48 89 c7             	mov    %rax,%rdi
+  80010c:	49 89 df             	mov    %rbx,%r15
+  80010f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800114:	48 b9 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rcx
+  80011b:	ff ff ff 
+  80011e:	48 01 d9             	add    %rbx,%rcx
+  800121:	ff d1                	call   *%rcx
+		return;
+  800123:	e9 40 02 00 00       	jmp    800368 <umain+0x325>
+	}
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  800128:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80012f:	eb 1a                	jmp    80014b <umain+0x108>
+		if (fork() == 0)
+  800131:	49 89 df             	mov    %rbx,%r15
+  800134:	48 b8 1f a1 ff ff ff 	movabs $0xffffffffffffa11f,%rax
+  80013b:	ff ff ff 
+  80013e:	48 01 d8             	add    %rbx,%rax
+  800141:	ff d0                	call   *%rax
+  800143:	85 c0                	test   %eax,%eax
+  800145:	74 0c                	je     800153 <umain+0x110>
+	for (i = 0; i < 20; i++)
+  800147:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80014b:	83 7d ec 13          	cmpl   $0x13,-0x14(%rbp)
+  80014f:	7e e0                	jle    800131 <umain+0xee>
+  800151:	eb 01                	jmp    800154 <umain+0x111>
+			break;
+  800153:	90                   	nop
+	if (i == 20) {
+  800154:	83 7d ec 14          	cmpl   $0x14,-0x14(%rbp)
+  800158:	75 17                	jne    800171 <umain+0x12e>
+		sys_yield();
+  80015a:	49 89 df             	mov    %rbx,%r15
+  80015d:	48 b8 3b 91 ff ff ff 	movabs $0xffffffffffff913b,%rax
+  800164:	ff ff ff 
+  800167:	48 01 d8             	add    %rbx,%rax
+  80016a:	ff d0                	call   *%rax
+		return;
+  80016c:	e9 f7 01 00 00       	jmp    800368 <umain+0x325>
+	}
+	
+	cprintf("[%08x] stresssched_initial on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  800171:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800178:	ff ff ff 
+  80017b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80017f:	48 8b 00             	mov    (%rax),%rax
+  800182:	8b 90 dc 00 00 00    	mov    0xdc(%rax),%edx
+  800188:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80018f:	ff ff ff 
+  800192:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800196:	48 8b 00             	mov    (%rax),%rax
+  800199:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80019f:	89 c6                	mov    %eax,%esi
+  8001a1:	48 b8 f8 dd ff ff ff 	movabs $0xffffffffffffddf8,%rax
+  8001a8:	ff ff ff 
+  8001ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001af:	48 89 c7             	mov    %rax,%rdi
+  8001b2:	49 89 df             	mov    %rbx,%r15
+  8001b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ba:	48 b9 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rcx
+  8001c1:	ff ff ff 
+  8001c4:	48 01 d9             	add    %rbx,%rcx
+  8001c7:	ff d1                	call   *%rcx
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  8001c9:	eb 02                	jmp    8001cd <umain+0x18a>
+		asm volatile("pause");
+  8001cb:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  8001cd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8001d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001d5:	89 c1                	mov    %eax,%ecx
+  8001d7:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8001de:	ff ff ff 
+  8001e1:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  8001e5:	48 63 c1             	movslq %ecx,%rax
+  8001e8:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8001ef:	48 01 d0             	add    %rdx,%rax
+  8001f2:	48 05 d4 00 00 00    	add    $0xd4,%rax
+  8001f8:	8b 00                	mov    (%rax),%eax
+  8001fa:	85 c0                	test   %eax,%eax
+  8001fc:	75 cd                	jne    8001cb <umain+0x188>
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+  8001fe:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800205:	eb 49                	jmp    800250 <umain+0x20d>
+		sys_yield();
+  800207:	49 89 df             	mov    %rbx,%r15
+  80020a:	48 b8 3b 91 ff ff ff 	movabs $0xffffffffffff913b,%rax
+  800211:	ff ff ff 
+  800214:	48 01 d8             	add    %rbx,%rax
+  800217:	ff d0                	call   *%rax
+		for (j = 0; j < 10000; j++)
+  800219:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+  800220:	eb 21                	jmp    800243 <umain+0x200>
+			counter++;
+  800222:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  800229:	00 00 00 
+  80022c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80022f:	8d 50 01             	lea    0x1(%rax),%edx
+  800232:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  800239:	00 00 00 
+  80023c:	89 14 03             	mov    %edx,(%rbx,%rax,1)
+		for (j = 0; j < 10000; j++)
+  80023f:	83 45 e8 01          	addl   $0x1,-0x18(%rbp)
+  800243:	81 7d e8 0f 27 00 00 	cmpl   $0x270f,-0x18(%rbp)
+  80024a:	7e d6                	jle    800222 <umain+0x1df>
+	for (i = 0; i < 10; i++) {
+  80024c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  800250:	83 7d ec 09          	cmpl   $0x9,-0x14(%rbp)
+  800254:	7e b1                	jle    800207 <umain+0x1c4>
+	}
+
+	if (counter != 10*10000)
+  800256:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  80025d:	00 00 00 
+  800260:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800263:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  800268:	74 4e                	je     8002b8 <umain+0x275>
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  80026a:	48 b8 c4 2f 01 00 00 	movabs $0x12fc4,%rax
+  800271:	00 00 00 
+  800274:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  800277:	89 c1                	mov    %eax,%ecx
+  800279:	48 b8 20 de ff ff ff 	movabs $0xffffffffffffde20,%rax
+  800280:	ff ff ff 
+  800283:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800287:	48 89 c2             	mov    %rax,%rdx
+  80028a:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80028f:	48 b8 48 de ff ff ff 	movabs $0xffffffffffffde48,%rax
+  800296:	ff ff ff 
+  800299:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80029d:	48 89 c7             	mov    %rax,%rdi
+  8002a0:	49 89 df             	mov    %rbx,%r15
+  8002a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a8:	49 b8 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%r8
+  8002af:	ff ff ff 
+  8002b2:	49 01 d8             	add    %rbx,%r8
+  8002b5:	41 ff d0             	call   *%r8
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8002b8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8002bf:	ff ff ff 
+  8002c2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002c6:	48 8b 00             	mov    (%rax),%rax
+  8002c9:	8b 90 dc 00 00 00    	mov    0xdc(%rax),%edx
+  8002cf:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8002d6:	ff ff ff 
+  8002d9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8002dd:	48 8b 00             	mov    (%rax),%rax
+  8002e0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8002e6:	89 c6                	mov    %eax,%esi
+  8002e8:	48 b8 5b de ff ff ff 	movabs $0xffffffffffffde5b,%rax
+  8002ef:	ff ff ff 
+  8002f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002f6:	48 89 c7             	mov    %rax,%rdi
+  8002f9:	49 89 df             	mov    %rbx,%r15
+  8002fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800301:	48 b9 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rcx
+  800308:	ff ff ff 
+  80030b:	48 01 d9             	add    %rbx,%rcx
+  80030e:	ff d1                	call   *%rcx
+	cprintf("[%08x] stresssched at prio %d\n", thisenv->env_id, thisenv->env_prio);
+  800310:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800317:	ff ff ff 
+  80031a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80031e:	48 8b 00             	mov    (%rax),%rax
+  800321:	8b 90 ec 00 00 00    	mov    0xec(%rax),%edx
+  800327:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80032e:	ff ff ff 
+  800331:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800335:	48 8b 00             	mov    (%rax),%rax
+  800338:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80033e:	89 c6                	mov    %eax,%esi
+  800340:	48 b8 80 de ff ff ff 	movabs $0xffffffffffffde80,%rax
+  800347:	ff ff ff 
+  80034a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80034e:	48 89 c7             	mov    %rax,%rdi
+  800351:	49 89 df             	mov    %rbx,%r15
+  800354:	b8 00 00 00 00       	mov    $0x0,%eax
+  800359:	48 b9 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rcx
+  800360:	ff ff ff 
+  800363:	48 01 d9             	add    %rbx,%rcx
+  800366:	ff d1                	call   *%rcx
+
+}
+  800368:	48 83 c4 20          	add    $0x20,%rsp
+  80036c:	5b                   	pop    %rbx
+  80036d:	41 5f                	pop    %r15
+  80036f:	5d                   	pop    %rbp
+  800370:	c3                   	ret
+
+0000000000800371 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800371:	55                   	push   %rbp
+  800372:	48 89 e5             	mov    %rsp,%rbp
+  800375:	41 57                	push   %r15
+  800377:	53                   	push   %rbx
+  800378:	48 83 ec 20          	sub    $0x20,%rsp
+  80037c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80037c <libmain+0xb>
+  800383:	49 bb c4 8c 00 00 00 	movabs $0x8cc4,%r11
+  80038a:	00 00 00 
+  80038d:	4c 01 db             	add    %r11,%rbx
+  800390:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800393:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800397:	49 89 df             	mov    %rbx,%r15
+  80039a:	48 b8 e7 90 ff ff ff 	movabs $0xffffffffffff90e7,%rax
+  8003a1:	ff ff ff 
+  8003a4:	48 01 d8             	add    %rbx,%rax
+  8003a7:	ff d0                	call   *%rax
+  8003a9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8003ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003af:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003b4:	48 98                	cltq
+  8003b6:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8003bd:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8003c4:	ff ff ff 
+  8003c7:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8003cb:	48 01 c2             	add    %rax,%rdx
+  8003ce:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8003d5:	00 00 00 
+  8003d8:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003dc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8003e0:	7e 15                	jle    8003f7 <libmain+0x86>
+		binaryname = argv[0];
+  8003e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8003e6:	48 8b 00             	mov    (%rax),%rax
+  8003e9:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8003f0:	00 00 00 
+  8003f3:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8003f7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8003fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8003fe:	48 89 d6             	mov    %rdx,%rsi
+  800401:	89 c7                	mov    %eax,%edi
+  800403:	49 89 df             	mov    %rbx,%r15
+  800406:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  80040d:	ff ff ff 
+  800410:	48 01 d8             	add    %rbx,%rax
+  800413:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800415:	49 89 df             	mov    %rbx,%r15
+  800418:	48 b8 f1 73 ff ff ff 	movabs $0xffffffffffff73f1,%rax
+  80041f:	ff ff ff 
+  800422:	48 01 d8             	add    %rbx,%rax
+  800425:	ff d0                	call   *%rax
+}
+  800427:	90                   	nop
+  800428:	48 83 c4 20          	add    $0x20,%rsp
+  80042c:	5b                   	pop    %rbx
+  80042d:	41 5f                	pop    %r15
+  80042f:	5d                   	pop    %rbp
+  800430:	c3                   	ret
+
+0000000000800431 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800431:	55                   	push   %rbp
+  800432:	48 89 e5             	mov    %rsp,%rbp
+  800435:	41 57                	push   %r15
+  800437:	53                   	push   %rbx
+  800438:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800438 <exit+0x7>
+  80043f:	49 bb 08 8c 00 00 00 	movabs $0x8c08,%r11
+  800446:	00 00 00 
+  800449:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80044c:	49 89 df             	mov    %rbx,%r15
+  80044f:	48 b8 f0 a8 ff ff ff 	movabs $0xffffffffffffa8f0,%rax
+  800456:	ff ff ff 
+  800459:	48 01 d8             	add    %rbx,%rax
+  80045c:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80045e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800463:	49 89 df             	mov    %rbx,%r15
+  800466:	48 b8 8b 90 ff ff ff 	movabs $0xffffffffffff908b,%rax
+  80046d:	ff ff ff 
+  800470:	48 01 d8             	add    %rbx,%rax
+  800473:	ff d0                	call   *%rax
+}
+  800475:	90                   	nop
+  800476:	5b                   	pop    %rbx
+  800477:	41 5f                	pop    %r15
+  800479:	5d                   	pop    %rbp
+  80047a:	c3                   	ret
+
+000000000080047b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80047b:	55                   	push   %rbp
+  80047c:	48 89 e5             	mov    %rsp,%rbp
+  80047f:	41 57                	push   %r15
+  800481:	41 54                	push   %r12
+  800483:	53                   	push   %rbx
+  800484:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80048b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80048b <_panic+0x10>
+  800492:	49 bb b5 8b 00 00 00 	movabs $0x8bb5,%r11
+  800499:	00 00 00 
+  80049c:	4c 01 db             	add    %r11,%rbx
+  80049f:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004a6:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8004ac:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8004b3:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8004ba:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8004c1:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8004c8:	84 c0                	test   %al,%al
+  8004ca:	74 26                	je     8004f2 <_panic+0x77>
+  8004cc:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8004d3:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8004da:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8004de:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8004e2:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8004e6:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8004ea:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8004ee:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004f2:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8004f9:	00 00 00 
+  8004fc:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800503:	00 00 00 
+  800506:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050a:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800511:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800518:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80051f:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800526:	ff ff ff 
+  800529:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80052d:	4c 8b 20             	mov    (%rax),%r12
+  800530:	49 89 df             	mov    %rbx,%r15
+  800533:	48 b8 e7 90 ff ff ff 	movabs $0xffffffffffff90e7,%rax
+  80053a:	ff ff ff 
+  80053d:	48 01 d8             	add    %rbx,%rax
+  800540:	ff d0                	call   *%rax
+  800542:	89 c6                	mov    %eax,%esi
+  800544:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80054a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800551:	41 89 d0             	mov    %edx,%r8d
+  800554:	48 89 c1             	mov    %rax,%rcx
+  800557:	4c 89 e2             	mov    %r12,%rdx
+  80055a:	48 b8 b0 de ff ff ff 	movabs $0xffffffffffffdeb0,%rax
+  800561:	ff ff ff 
+  800564:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800568:	48 89 c7             	mov    %rax,%rdi
+  80056b:	49 89 df             	mov    %rbx,%r15
+  80056e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800573:	49 b9 12 77 ff ff ff 	movabs $0xffffffffffff7712,%r9
+  80057a:	ff ff ff 
+  80057d:	49 01 d9             	add    %rbx,%r9
+  800580:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800583:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80058a:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800591:	48 89 d6             	mov    %rdx,%rsi
+  800594:	48 89 c7             	mov    %rax,%rdi
+  800597:	49 89 df             	mov    %rbx,%r15
+  80059a:	48 b8 32 76 ff ff ff 	movabs $0xffffffffffff7632,%rax
+  8005a1:	ff ff ff 
+  8005a4:	48 01 d8             	add    %rbx,%rax
+  8005a7:	ff d0                	call   *%rax
+	cprintf("\n");
+  8005a9:	48 b8 d3 de ff ff ff 	movabs $0xffffffffffffded3,%rax
+  8005b0:	ff ff ff 
+  8005b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005b7:	48 89 c7             	mov    %rax,%rdi
+  8005ba:	49 89 df             	mov    %rbx,%r15
+  8005bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c2:	48 ba 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rdx
+  8005c9:	ff ff ff 
+  8005cc:	48 01 da             	add    %rbx,%rdx
+  8005cf:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8005d1:	cc                   	int3
+  8005d2:	eb fd                	jmp    8005d1 <_panic+0x156>
+
+00000000008005d4 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8005d4:	55                   	push   %rbp
+  8005d5:	48 89 e5             	mov    %rsp,%rbp
+  8005d8:	41 57                	push   %r15
+  8005da:	48 83 ec 18          	sub    $0x18,%rsp
+  8005de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005de <putch+0xa>
+  8005e5:	49 bb 62 8a 00 00 00 	movabs $0x8a62,%r11
+  8005ec:	00 00 00 
+  8005ef:	4c 01 d8             	add    %r11,%rax
+  8005f2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8005f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8005f9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8005fd:	8b 12                	mov    (%rdx),%edx
+  8005ff:	8d 72 01             	lea    0x1(%rdx),%esi
+  800602:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800606:	89 31                	mov    %esi,(%rcx)
+  800608:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80060b:	89 ce                	mov    %ecx,%esi
+  80060d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800611:	48 63 d2             	movslq %edx,%rdx
+  800614:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800619:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80061d:	8b 12                	mov    (%rdx),%edx
+  80061f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800625:	75 33                	jne    80065a <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800627:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80062b:	8b 12                	mov    (%rdx),%edx
+  80062d:	48 63 d2             	movslq %edx,%rdx
+  800630:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800634:	48 83 c1 08          	add    $0x8,%rcx
+  800638:	48 89 d6             	mov    %rdx,%rsi
+  80063b:	48 89 cf             	mov    %rcx,%rdi
+  80063e:	49 89 c7             	mov    %rax,%r15
+  800641:	48 ba d8 8f ff ff ff 	movabs $0xffffffffffff8fd8,%rdx
+  800648:	ff ff ff 
+  80064b:	48 01 c2             	add    %rax,%rdx
+  80064e:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800650:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800654:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80065a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80065e:	8b 40 04             	mov    0x4(%rax),%eax
+  800661:	8d 50 01             	lea    0x1(%rax),%edx
+  800664:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800668:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80066b:	90                   	nop
+  80066c:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800670:	c9                   	leave
+  800671:	c3                   	ret
+
+0000000000800672 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800672:	55                   	push   %rbp
+  800673:	48 89 e5             	mov    %rsp,%rbp
+  800676:	41 57                	push   %r15
+  800678:	53                   	push   %rbx
+  800679:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800680:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800680 <vcprintf+0xe>
+  800687:	49 bb c0 89 00 00 00 	movabs $0x89c0,%r11
+  80068e:	00 00 00 
+  800691:	4c 01 db             	add    %r11,%rbx
+  800694:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80069b:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8006a2:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006a9:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8006b0:	48 8b 06             	mov    (%rsi),%rax
+  8006b3:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006b7:	48 89 01             	mov    %rax,(%rcx)
+  8006ba:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006be:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006c2:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8006c6:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8006cd:	00 00 00 
+    b.cnt = 0;
+  8006d0:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8006d7:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8006da:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006e1:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8006e8:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8006ef:	48 89 c6             	mov    %rax,%rsi
+  8006f2:	48 b8 94 75 ff ff ff 	movabs $0xffffffffffff7594,%rax
+  8006f9:	ff ff ff 
+  8006fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800700:	48 89 c7             	mov    %rax,%rdi
+  800703:	49 89 df             	mov    %rbx,%r15
+  800706:	48 b8 56 7b ff ff ff 	movabs $0xffffffffffff7b56,%rax
+  80070d:	ff ff ff 
+  800710:	48 01 d8             	add    %rbx,%rax
+  800713:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800715:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80071b:	48 98                	cltq
+  80071d:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800724:	48 83 c2 08          	add    $0x8,%rdx
+  800728:	48 89 c6             	mov    %rax,%rsi
+  80072b:	48 89 d7             	mov    %rdx,%rdi
+  80072e:	49 89 df             	mov    %rbx,%r15
+  800731:	48 b8 d8 8f ff ff ff 	movabs $0xffffffffffff8fd8,%rax
+  800738:	ff ff ff 
+  80073b:	48 01 d8             	add    %rbx,%rax
+  80073e:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800740:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800746:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80074d:	5b                   	pop    %rbx
+  80074e:	41 5f                	pop    %r15
+  800750:	5d                   	pop    %rbp
+  800751:	c3                   	ret
+
+0000000000800752 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800752:	55                   	push   %rbp
+  800753:	48 89 e5             	mov    %rsp,%rbp
+  800756:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80075d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80075d <cprintf+0xb>
+  800764:	49 bb e3 88 00 00 00 	movabs $0x88e3,%r11
+  80076b:	00 00 00 
+  80076e:	4d 01 da             	add    %r11,%r10
+  800771:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800778:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80077f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800786:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80078d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800794:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80079b:	84 c0                	test   %al,%al
+  80079d:	74 20                	je     8007bf <cprintf+0x6d>
+  80079f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8007a3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8007a7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8007ab:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8007af:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8007b3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8007b7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8007bb:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8007bf:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8007c6:	00 00 00 
+  8007c9:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8007d0:	00 00 00 
+  8007d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007d7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8007de:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8007e5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8007ec:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8007f3:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8007fa:	48 8b 06             	mov    (%rsi),%rax
+  8007fd:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800801:	48 89 01             	mov    %rax,(%rcx)
+  800804:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800808:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80080c:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800810:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800817:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80081e:	48 89 d6             	mov    %rdx,%rsi
+  800821:	48 89 c7             	mov    %rax,%rdi
+  800824:	48 b8 32 76 ff ff ff 	movabs $0xffffffffffff7632,%rax
+  80082b:	ff ff ff 
+  80082e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800832:	ff d0                	call   *%rax
+  800834:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80083a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800840:	c9                   	leave
+  800841:	c3                   	ret
+
+0000000000800842 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800842:	55                   	push   %rbp
+  800843:	48 89 e5             	mov    %rsp,%rbp
+  800846:	53                   	push   %rbx
+  800847:	48 83 ec 38          	sub    $0x38,%rsp
+  80084b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80084b <printnum+0x9>
+  800852:	49 bb f5 87 00 00 00 	movabs $0x87f5,%r11
+  800859:	00 00 00 
+  80085c:	4c 01 db             	add    %r11,%rbx
+  80085f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800863:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800867:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80086b:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80086e:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800872:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800876:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800879:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80087d:	72 58                	jb     8008d7 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80087f:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800882:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800885:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800888:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80088c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800891:	48 f7 f6             	div    %rsi
+  800894:	49 89 c2             	mov    %rax,%r10
+  800897:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80089a:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80089d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8008a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008a5:	41 89 c9             	mov    %ecx,%r9d
+  8008a8:	41 89 f8             	mov    %edi,%r8d
+  8008ab:	89 d1                	mov    %edx,%ecx
+  8008ad:	4c 89 d2             	mov    %r10,%rdx
+  8008b0:	48 89 c7             	mov    %rax,%rdi
+  8008b3:	48 b8 02 78 ff ff ff 	movabs $0xffffffffffff7802,%rax
+  8008ba:	ff ff ff 
+  8008bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008c1:	ff d0                	call   *%rax
+  8008c3:	eb 1c                	jmp    8008e1 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8008c5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008c9:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8008cc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8008d0:	48 89 d6             	mov    %rdx,%rsi
+  8008d3:	89 c7                	mov    %eax,%edi
+  8008d5:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8008d7:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8008db:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8008df:	7f e4                	jg     8008c5 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8008e1:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8008e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008ed:	48 f7 f1             	div    %rcx
+  8008f0:	48 b8 0f e0 ff ff ff 	movabs $0xffffffffffffe00f,%rax
+  8008f7:	ff ff ff 
+  8008fa:	48 01 d8             	add    %rbx,%rax
+  8008fd:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800901:	0f be c0             	movsbl %al,%eax
+  800904:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800908:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80090c:	48 89 d6             	mov    %rdx,%rsi
+  80090f:	89 c7                	mov    %eax,%edi
+  800911:	ff d1                	call   *%rcx
+}
+  800913:	90                   	nop
+  800914:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800918:	c9                   	leave
+  800919:	c3                   	ret
+
+000000000080091a <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80091a:	55                   	push   %rbp
+  80091b:	48 89 e5             	mov    %rsp,%rbp
+  80091e:	48 83 ec 20          	sub    $0x20,%rsp
+  800922:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800922 <getuint+0x8>
+  800929:	49 bb 1e 87 00 00 00 	movabs $0x871e,%r11
+  800930:	00 00 00 
+  800933:	4c 01 d8             	add    %r11,%rax
+  800936:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80093a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  80093d:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800941:	7e 4f                	jle    800992 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800943:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800947:	8b 00                	mov    (%rax),%eax
+  800949:	83 f8 2f             	cmp    $0x2f,%eax
+  80094c:	77 24                	ja     800972 <getuint+0x58>
+  80094e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800952:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800956:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80095a:	8b 00                	mov    (%rax),%eax
+  80095c:	89 c0                	mov    %eax,%eax
+  80095e:	48 01 d0             	add    %rdx,%rax
+  800961:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800965:	8b 12                	mov    (%rdx),%edx
+  800967:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80096a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80096e:	89 0a                	mov    %ecx,(%rdx)
+  800970:	eb 14                	jmp    800986 <getuint+0x6c>
+  800972:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800976:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80097a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80097e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800982:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800986:	48 8b 00             	mov    (%rax),%rax
+  800989:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80098d:	e9 9d 00 00 00       	jmp    800a2f <getuint+0x115>
+	else if (lflag)
+  800992:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800996:	74 4c                	je     8009e4 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800998:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80099c:	8b 00                	mov    (%rax),%eax
+  80099e:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a1:	77 24                	ja     8009c7 <getuint+0xad>
+  8009a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009af:	8b 00                	mov    (%rax),%eax
+  8009b1:	89 c0                	mov    %eax,%eax
+  8009b3:	48 01 d0             	add    %rdx,%rax
+  8009b6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009ba:	8b 12                	mov    (%rdx),%edx
+  8009bc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009bf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009c3:	89 0a                	mov    %ecx,(%rdx)
+  8009c5:	eb 14                	jmp    8009db <getuint+0xc1>
+  8009c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009cb:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009cf:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009d3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009d7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009db:	48 8b 00             	mov    (%rax),%rax
+  8009de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009e2:	eb 4b                	jmp    800a2f <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8009e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e8:	8b 00                	mov    (%rax),%eax
+  8009ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ed:	77 24                	ja     800a13 <getuint+0xf9>
+  8009ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009f3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009fb:	8b 00                	mov    (%rax),%eax
+  8009fd:	89 c0                	mov    %eax,%eax
+  8009ff:	48 01 d0             	add    %rdx,%rax
+  800a02:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a06:	8b 12                	mov    (%rdx),%edx
+  800a08:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a0b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a0f:	89 0a                	mov    %ecx,(%rdx)
+  800a11:	eb 14                	jmp    800a27 <getuint+0x10d>
+  800a13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a17:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a1b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a1f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a23:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a27:	8b 00                	mov    (%rax),%eax
+  800a29:	89 c0                	mov    %eax,%eax
+  800a2b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a33:	c9                   	leave
+  800a34:	c3                   	ret
+
+0000000000800a35 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800a35:	55                   	push   %rbp
+  800a36:	48 89 e5             	mov    %rsp,%rbp
+  800a39:	48 83 ec 20          	sub    $0x20,%rsp
+  800a3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a3d <printfloat+0x8>
+  800a44:	49 bb 03 86 00 00 00 	movabs $0x8603,%r11
+  800a4b:	00 00 00 
+  800a4e:	4c 01 d8             	add    %r11,%rax
+  800a51:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a55:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a59:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800a5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a61:	48 85 c0             	test   %rax,%rax
+  800a64:	79 12                	jns    800a78 <printfloat+0x43>
+		putch('-',putdat);
+  800a66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a6a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a6e:	48 89 c6             	mov    %rax,%rsi
+  800a71:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a76:	ff d2                	call   *%rdx
+	
+}
+  800a78:	90                   	nop
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+
+0000000000800a7b <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800a7b:	55                   	push   %rbp
+  800a7c:	48 89 e5             	mov    %rsp,%rbp
+  800a7f:	48 83 ec 20          	sub    $0x20,%rsp
+  800a83:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a83 <getint+0x8>
+  800a8a:	49 bb bd 85 00 00 00 	movabs $0x85bd,%r11
+  800a91:	00 00 00 
+  800a94:	4c 01 d8             	add    %r11,%rax
+  800a97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a9b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800a9e:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800aa2:	7e 4f                	jle    800af3 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800aa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa8:	8b 00                	mov    (%rax),%eax
+  800aaa:	83 f8 2f             	cmp    $0x2f,%eax
+  800aad:	77 24                	ja     800ad3 <getint+0x58>
+  800aaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ab7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800abb:	8b 00                	mov    (%rax),%eax
+  800abd:	89 c0                	mov    %eax,%eax
+  800abf:	48 01 d0             	add    %rdx,%rax
+  800ac2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ac6:	8b 12                	mov    (%rdx),%edx
+  800ac8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800acb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800acf:	89 0a                	mov    %ecx,(%rdx)
+  800ad1:	eb 14                	jmp    800ae7 <getint+0x6c>
+  800ad3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800adb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800adf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ae3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ae7:	48 8b 00             	mov    (%rax),%rax
+  800aea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800aee:	e9 9d 00 00 00       	jmp    800b90 <getint+0x115>
+	else if (lflag)
+  800af3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800af7:	74 4c                	je     800b45 <getint+0xca>
+		x=va_arg(*ap, long);
+  800af9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afd:	8b 00                	mov    (%rax),%eax
+  800aff:	83 f8 2f             	cmp    $0x2f,%eax
+  800b02:	77 24                	ja     800b28 <getint+0xad>
+  800b04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b08:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b10:	8b 00                	mov    (%rax),%eax
+  800b12:	89 c0                	mov    %eax,%eax
+  800b14:	48 01 d0             	add    %rdx,%rax
+  800b17:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b1b:	8b 12                	mov    (%rdx),%edx
+  800b1d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b24:	89 0a                	mov    %ecx,(%rdx)
+  800b26:	eb 14                	jmp    800b3c <getint+0xc1>
+  800b28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b2c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b30:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b34:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b38:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b3c:	48 8b 00             	mov    (%rax),%rax
+  800b3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b43:	eb 4b                	jmp    800b90 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800b45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b49:	8b 00                	mov    (%rax),%eax
+  800b4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4e:	77 24                	ja     800b74 <getint+0xf9>
+  800b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b54:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b5c:	8b 00                	mov    (%rax),%eax
+  800b5e:	89 c0                	mov    %eax,%eax
+  800b60:	48 01 d0             	add    %rdx,%rax
+  800b63:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b67:	8b 12                	mov    (%rdx),%edx
+  800b69:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b6c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b70:	89 0a                	mov    %ecx,(%rdx)
+  800b72:	eb 14                	jmp    800b88 <getint+0x10d>
+  800b74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b78:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b7c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b80:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b84:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b88:	8b 00                	mov    (%rax),%eax
+  800b8a:	48 98                	cltq
+  800b8c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b94:	c9                   	leave
+  800b95:	c3                   	ret
+
+0000000000800b96 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800b96:	55                   	push   %rbp
+  800b97:	48 89 e5             	mov    %rsp,%rbp
+  800b9a:	41 57                	push   %r15
+  800b9c:	41 55                	push   %r13
+  800b9e:	41 54                	push   %r12
+  800ba0:	53                   	push   %rbx
+  800ba1:	48 83 ec 60          	sub    $0x60,%rsp
+  800ba5:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800ba5 <vprintfmt+0xf>
+  800bac:	49 bb 9b 84 00 00 00 	movabs $0x849b,%r11
+  800bb3:	00 00 00 
+  800bb6:	4d 01 dc             	add    %r11,%r12
+  800bb9:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800bbd:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800bc1:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800bc5:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800bc9:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800bd0:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800bd4:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800bd8:	48 8b 06             	mov    (%rsi),%rax
+  800bdb:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800bdf:	48 89 01             	mov    %rax,(%rcx)
+  800be2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800be6:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800bea:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800bee:	eb 17                	jmp    800c07 <vprintfmt+0x71>
+			if (ch == '\0')
+  800bf0:	85 db                	test   %ebx,%ebx
+  800bf2:	0f 84 97 05 00 00    	je     80118f <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800bf8:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800bfc:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c00:	48 89 c6             	mov    %rax,%rsi
+  800c03:	89 df                	mov    %ebx,%edi
+  800c05:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c07:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c0b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c0f:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c13:	0f b6 00             	movzbl (%rax),%eax
+  800c16:	0f b6 d8             	movzbl %al,%ebx
+  800c19:	83 fb 25             	cmp    $0x25,%ebx
+  800c1c:	75 d2                	jne    800bf0 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800c1e:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800c22:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800c29:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800c30:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800c37:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800c3e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c42:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c46:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c4a:	0f b6 00             	movzbl (%rax),%eax
+  800c4d:	0f b6 d8             	movzbl %al,%ebx
+  800c50:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c53:	83 f8 55             	cmp    $0x55,%eax
+  800c56:	0f 87 00 05 00 00    	ja     80115c <vprintfmt+0x5c6>
+  800c5c:	89 c0                	mov    %eax,%eax
+  800c5e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c65:	00 
+  800c66:	48 8d 05 0b 64 00 00 	lea    0x640b(%rip),%rax        # 807078 <.LC18+0xc>
+  800c6d:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800c71:	48 8d 15 00 64 00 00 	lea    0x6400(%rip),%rdx        # 807078 <.LC18+0xc>
+  800c78:	48 01 d0             	add    %rdx,%rax
+  800c7b:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800c7d:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800c81:	eb bb                	jmp    800c3e <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800c83:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800c87:	eb b5                	jmp    800c3e <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800c89:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800c90:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800c93:	89 d0                	mov    %edx,%eax
+  800c95:	c1 e0 02             	shl    $0x2,%eax
+  800c98:	01 d0                	add    %edx,%eax
+  800c9a:	01 c0                	add    %eax,%eax
+  800c9c:	01 d8                	add    %ebx,%eax
+  800c9e:	83 e8 30             	sub    $0x30,%eax
+  800ca1:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800ca4:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ca8:	0f b6 00             	movzbl (%rax),%eax
+  800cab:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800cae:	83 fb 2f             	cmp    $0x2f,%ebx
+  800cb1:	7e 60                	jle    800d13 <vprintfmt+0x17d>
+  800cb3:	83 fb 39             	cmp    $0x39,%ebx
+  800cb6:	7f 5b                	jg     800d13 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800cb8:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800cbd:	eb d1                	jmp    800c90 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800cbf:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800cc2:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc5:	77 17                	ja     800cde <vprintfmt+0x148>
+  800cc7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ccb:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cce:	89 d2                	mov    %edx,%edx
+  800cd0:	48 01 d0             	add    %rdx,%rax
+  800cd3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cd6:	83 c2 08             	add    $0x8,%edx
+  800cd9:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cdc:	eb 0c                	jmp    800cea <vprintfmt+0x154>
+  800cde:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ce2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ce6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800cea:	8b 00                	mov    (%rax),%eax
+  800cec:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800cef:	eb 23                	jmp    800d14 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800cf1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800cf5:	0f 89 43 ff ff ff    	jns    800c3e <vprintfmt+0xa8>
+				width = 0;
+  800cfb:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800d02:	e9 37 ff ff ff       	jmp    800c3e <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800d07:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800d0e:	e9 2b ff ff ff       	jmp    800c3e <vprintfmt+0xa8>
+			goto process_precision;
+  800d13:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800d14:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d18:	0f 89 20 ff ff ff    	jns    800c3e <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800d1e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d21:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800d24:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800d2b:	e9 0e ff ff ff       	jmp    800c3e <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800d30:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800d34:	e9 05 ff ff ff       	jmp    800c3e <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800d39:	83 fb 39             	cmp    $0x39,%ebx
+  800d3c:	7f 0b                	jg     800d49 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800d3e:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800d41:	c1 e0 08             	shl    $0x8,%eax
+  800d44:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d47:	eb 21                	jmp    800d6a <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800d49:	83 fb 60             	cmp    $0x60,%ebx
+  800d4c:	7e 10                	jle    800d5e <vprintfmt+0x1c8>
+  800d4e:	83 fb 66             	cmp    $0x66,%ebx
+  800d51:	7f 0b                	jg     800d5e <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800d53:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800d56:	c1 e0 08             	shl    $0x8,%eax
+  800d59:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d5c:	eb 0c                	jmp    800d6a <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800d5e:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800d65:	e9 04 01 00 00       	jmp    800e6e <vprintfmt+0x2d8>
+  800d6a:	e9 ff 00 00 00       	jmp    800e6e <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800d6f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d72:	83 f8 2f             	cmp    $0x2f,%eax
+  800d75:	77 17                	ja     800d8e <vprintfmt+0x1f8>
+  800d77:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d7b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d7e:	89 d2                	mov    %edx,%edx
+  800d80:	48 01 d0             	add    %rdx,%rax
+  800d83:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d86:	83 c2 08             	add    $0x8,%edx
+  800d89:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d8c:	eb 0c                	jmp    800d9a <vprintfmt+0x204>
+  800d8e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d92:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d96:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d9a:	8b 00                	mov    (%rax),%eax
+  800d9c:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800da0:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800da4:	48 89 d6             	mov    %rdx,%rsi
+  800da7:	89 c7                	mov    %eax,%edi
+  800da9:	ff d1                	call   *%rcx
+			break;
+  800dab:	e9 da 03 00 00       	jmp    80118a <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800db0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800db3:	83 f8 2f             	cmp    $0x2f,%eax
+  800db6:	77 17                	ja     800dcf <vprintfmt+0x239>
+  800db8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dbc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dbf:	89 d2                	mov    %edx,%edx
+  800dc1:	48 01 d0             	add    %rdx,%rax
+  800dc4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dc7:	83 c2 08             	add    $0x8,%edx
+  800dca:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800dcd:	eb 0c                	jmp    800ddb <vprintfmt+0x245>
+  800dcf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dd3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dd7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ddb:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800ddd:	85 db                	test   %ebx,%ebx
+  800ddf:	79 02                	jns    800de3 <vprintfmt+0x24d>
+				err = -err;
+  800de1:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800de3:	83 fb 15             	cmp    $0x15,%ebx
+  800de6:	7f 19                	jg     800e01 <vprintfmt+0x26b>
+  800de8:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800def:	00 00 00 
+  800df2:	48 63 c3             	movslq %ebx,%rax
+  800df5:	4c 01 e2             	add    %r12,%rdx
+  800df8:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800dfc:	4d 85 ed             	test   %r13,%r13
+  800dff:	75 36                	jne    800e37 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800e01:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e05:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e09:	89 d9                	mov    %ebx,%ecx
+  800e0b:	48 ba 20 e0 ff ff ff 	movabs $0xffffffffffffe020,%rdx
+  800e12:	ff ff ff 
+  800e15:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e19:	48 89 c7             	mov    %rax,%rdi
+  800e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e21:	49 b8 5d 81 ff ff ff 	movabs $0xffffffffffff815d,%r8
+  800e28:	ff ff ff 
+  800e2b:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e2f:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800e32:	e9 53 03 00 00       	jmp    80118a <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800e37:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e3b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e3f:	4c 89 e9             	mov    %r13,%rcx
+  800e42:	48 ba 29 e0 ff ff ff 	movabs $0xffffffffffffe029,%rdx
+  800e49:	ff ff ff 
+  800e4c:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e50:	48 89 c7             	mov    %rax,%rdi
+  800e53:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e58:	49 b8 5d 81 ff ff ff 	movabs $0xffffffffffff815d,%r8
+  800e5f:	ff ff ff 
+  800e62:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e66:	41 ff d0             	call   *%r8
+			break;
+  800e69:	e9 1c 03 00 00       	jmp    80118a <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800e6e:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e71:	83 f8 2f             	cmp    $0x2f,%eax
+  800e74:	77 17                	ja     800e8d <vprintfmt+0x2f7>
+  800e76:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e7a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e7d:	89 d2                	mov    %edx,%edx
+  800e7f:	48 01 d0             	add    %rdx,%rax
+  800e82:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e85:	83 c2 08             	add    $0x8,%edx
+  800e88:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e8b:	eb 0c                	jmp    800e99 <vprintfmt+0x303>
+  800e8d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e91:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e95:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e99:	4c 8b 28             	mov    (%rax),%r13
+  800e9c:	4d 85 ed             	test   %r13,%r13
+  800e9f:	75 0e                	jne    800eaf <vprintfmt+0x319>
+				p = "(null)";
+  800ea1:	48 b8 2c e0 ff ff ff 	movabs $0xffffffffffffe02c,%rax
+  800ea8:	ff ff ff 
+  800eab:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800eaf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800eb3:	0f 8e 84 00 00 00    	jle    800f3d <vprintfmt+0x3a7>
+  800eb9:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800ebd:	74 7e                	je     800f3d <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ebf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800ec2:	48 98                	cltq
+  800ec4:	48 89 c6             	mov    %rax,%rsi
+  800ec7:	4c 89 ef             	mov    %r13,%rdi
+  800eca:	4d 89 e7             	mov    %r12,%r15
+  800ecd:	48 b8 82 84 ff ff ff 	movabs $0xffffffffffff8482,%rax
+  800ed4:	ff ff ff 
+  800ed7:	4c 01 e0             	add    %r12,%rax
+  800eda:	ff d0                	call   *%rax
+  800edc:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800edf:	eb 17                	jmp    800ef8 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800ee1:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800ee5:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800ee9:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800eed:	48 89 d6             	mov    %rdx,%rsi
+  800ef0:	89 c7                	mov    %eax,%edi
+  800ef2:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ef4:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ef8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800efc:	7f e3                	jg     800ee1 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800efe:	eb 3d                	jmp    800f3d <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800f00:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800f04:	74 1e                	je     800f24 <vprintfmt+0x38e>
+  800f06:	83 fb 1f             	cmp    $0x1f,%ebx
+  800f09:	7e 05                	jle    800f10 <vprintfmt+0x37a>
+  800f0b:	83 fb 7e             	cmp    $0x7e,%ebx
+  800f0e:	7e 14                	jle    800f24 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800f10:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f14:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f18:	48 89 c6             	mov    %rax,%rsi
+  800f1b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800f20:	ff d2                	call   *%rdx
+  800f22:	eb 15                	jmp    800f39 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800f24:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800f27:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800f2a:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f2e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f32:	48 89 c6             	mov    %rax,%rsi
+  800f35:	89 cf                	mov    %ecx,%edi
+  800f37:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f39:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f3d:	4c 89 e8             	mov    %r13,%rax
+  800f40:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800f44:	0f b6 00             	movzbl (%rax),%eax
+  800f47:	0f be d8             	movsbl %al,%ebx
+  800f4a:	85 db                	test   %ebx,%ebx
+  800f4c:	74 28                	je     800f76 <vprintfmt+0x3e0>
+  800f4e:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f52:	78 ac                	js     800f00 <vprintfmt+0x36a>
+  800f54:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800f58:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f5c:	79 a2                	jns    800f00 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800f5e:	eb 16                	jmp    800f76 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800f60:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f64:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f68:	48 89 c6             	mov    %rax,%rsi
+  800f6b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f70:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800f72:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f76:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f7a:	7f e4                	jg     800f60 <vprintfmt+0x3ca>
+			break;
+  800f7c:	e9 09 02 00 00       	jmp    80118a <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800f81:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800f85:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800f89:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800f8d:	0f b6 00             	movzbl (%rax),%eax
+  800f90:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800f93:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800f94:	83 fb 2f             	cmp    $0x2f,%ebx
+  800f97:	0f 8e ac fd ff ff    	jle    800d49 <vprintfmt+0x1b3>
+  800f9d:	e9 97 fd ff ff       	jmp    800d39 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800fa2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fa6:	be 03 00 00 00       	mov    $0x3,%esi
+  800fab:	48 89 c7             	mov    %rax,%rdi
+  800fae:	48 b8 3b 7a ff ff ff 	movabs $0xffffffffffff7a3b,%rax
+  800fb5:	ff ff ff 
+  800fb8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fbc:	ff d0                	call   *%rax
+  800fbe:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800fc2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fc6:	48 85 c0             	test   %rax,%rax
+  800fc9:	79 1d                	jns    800fe8 <vprintfmt+0x452>
+				putch('-', putdat);
+  800fcb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fcf:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fd3:	48 89 c6             	mov    %rax,%rsi
+  800fd6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800fdb:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800fdd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fe1:	48 f7 d8             	neg    %rax
+  800fe4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800fe8:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800fef:	e9 de 00 00 00       	jmp    8010d2 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800ff4:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800ff8:	be 03 00 00 00       	mov    $0x3,%esi
+  800ffd:	48 89 c7             	mov    %rax,%rdi
+  801000:	48 b8 da 78 ff ff ff 	movabs $0xffffffffffff78da,%rax
+  801007:	ff ff ff 
+  80100a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80100e:	ff d0                	call   *%rax
+  801010:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801014:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80101b:	e9 b2 00 00 00       	jmp    8010d2 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801020:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801024:	be 03 00 00 00       	mov    $0x3,%esi
+  801029:	48 89 c7             	mov    %rax,%rdi
+  80102c:	48 b8 da 78 ff ff ff 	movabs $0xffffffffffff78da,%rax
+  801033:	ff ff ff 
+  801036:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80103a:	ff d0                	call   *%rax
+  80103c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801040:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801047:	e9 86 00 00 00       	jmp    8010d2 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80104c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801050:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801054:	48 89 c6             	mov    %rax,%rsi
+  801057:	bf 30 00 00 00       	mov    $0x30,%edi
+  80105c:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80105e:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801062:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801066:	48 89 c6             	mov    %rax,%rsi
+  801069:	bf 78 00 00 00       	mov    $0x78,%edi
+  80106e:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801070:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801073:	83 f8 2f             	cmp    $0x2f,%eax
+  801076:	77 17                	ja     80108f <vprintfmt+0x4f9>
+  801078:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80107c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80107f:	89 d2                	mov    %edx,%edx
+  801081:	48 01 d0             	add    %rdx,%rax
+  801084:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801087:	83 c2 08             	add    $0x8,%edx
+  80108a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80108d:	eb 0c                	jmp    80109b <vprintfmt+0x505>
+  80108f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801093:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801097:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80109b:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80109e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010a2:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8010a9:	eb 27                	jmp    8010d2 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8010ab:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010af:	be 03 00 00 00       	mov    $0x3,%esi
+  8010b4:	48 89 c7             	mov    %rax,%rdi
+  8010b7:	48 b8 da 78 ff ff ff 	movabs $0xffffffffffff78da,%rax
+  8010be:	ff ff ff 
+  8010c1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010c5:	ff d0                	call   *%rax
+  8010c7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010cb:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8010d2:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8010d7:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8010da:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8010dd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010e1:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8010e5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010e9:	45 89 c1             	mov    %r8d,%r9d
+  8010ec:	41 89 f8             	mov    %edi,%r8d
+  8010ef:	48 89 c7             	mov    %rax,%rdi
+  8010f2:	48 b8 02 78 ff ff ff 	movabs $0xffffffffffff7802,%rax
+  8010f9:	ff ff ff 
+  8010fc:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801100:	ff d0                	call   *%rax
+			break;
+  801102:	e9 83 00 00 00       	jmp    80118a <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801107:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80110b:	be 03 00 00 00       	mov    $0x3,%esi
+  801110:	48 89 c7             	mov    %rax,%rdi
+  801113:	48 b8 da 78 ff ff ff 	movabs $0xffffffffffff78da,%rax
+  80111a:	ff ff ff 
+  80111d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801121:	ff d0                	call   *%rax
+  801123:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801127:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80112b:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80112f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801133:	48 89 ce             	mov    %rcx,%rsi
+  801136:	48 89 c7             	mov    %rax,%rdi
+  801139:	48 b8 f5 79 ff ff ff 	movabs $0xffffffffffff79f5,%rax
+  801140:	ff ff ff 
+  801143:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801147:	ff d0                	call   *%rax
+	
+			break;
+  801149:	eb 3f                	jmp    80118a <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80114b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80114f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801153:	48 89 c6             	mov    %rax,%rsi
+  801156:	89 df                	mov    %ebx,%edi
+  801158:	ff d2                	call   *%rdx
+			break;
+  80115a:	eb 2e                	jmp    80118a <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80115c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801160:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801164:	48 89 c6             	mov    %rax,%rsi
+  801167:	bf 25 00 00 00       	mov    $0x25,%edi
+  80116c:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80116e:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801173:	eb 05                	jmp    80117a <vprintfmt+0x5e4>
+  801175:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80117a:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80117e:	48 83 e8 01          	sub    $0x1,%rax
+  801182:	0f b6 00             	movzbl (%rax),%eax
+  801185:	3c 25                	cmp    $0x25,%al
+  801187:	75 ec                	jne    801175 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801189:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80118a:	e9 78 fa ff ff       	jmp    800c07 <vprintfmt+0x71>
+				return;
+  80118f:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801190:	48 83 c4 60          	add    $0x60,%rsp
+  801194:	5b                   	pop    %rbx
+  801195:	41 5c                	pop    %r12
+  801197:	41 5d                	pop    %r13
+  801199:	41 5f                	pop    %r15
+  80119b:	5d                   	pop    %rbp
+  80119c:	c3                   	ret
+
+000000000080119d <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80119d:	55                   	push   %rbp
+  80119e:	48 89 e5             	mov    %rsp,%rbp
+  8011a1:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8011a8:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8011a8 <printfmt+0xb>
+  8011af:	49 bb 98 7e 00 00 00 	movabs $0x7e98,%r11
+  8011b6:	00 00 00 
+  8011b9:	4d 01 da             	add    %r11,%r10
+  8011bc:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8011c3:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8011ca:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8011d1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8011d8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8011df:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8011e6:	84 c0                	test   %al,%al
+  8011e8:	74 20                	je     80120a <printfmt+0x6d>
+  8011ea:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8011ee:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8011f2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8011f6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8011fa:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8011fe:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801202:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801206:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80120a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801211:	00 00 00 
+  801214:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80121b:	00 00 00 
+  80121e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801222:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801229:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801230:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801237:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80123e:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801245:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80124c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801253:	48 89 c7             	mov    %rax,%rdi
+  801256:	48 b8 56 7b ff ff ff 	movabs $0xffffffffffff7b56,%rax
+  80125d:	ff ff ff 
+  801260:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801264:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801266:	90                   	nop
+  801267:	c9                   	leave
+  801268:	c3                   	ret
+
+0000000000801269 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801269:	55                   	push   %rbp
+  80126a:	48 89 e5             	mov    %rsp,%rbp
+  80126d:	48 83 ec 10          	sub    $0x10,%rsp
+  801271:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801271 <sprintputch+0x8>
+  801278:	49 bb cf 7d 00 00 00 	movabs $0x7dcf,%r11
+  80127f:	00 00 00 
+  801282:	4c 01 d8             	add    %r11,%rax
+  801285:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801288:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80128c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801290:	8b 40 10             	mov    0x10(%rax),%eax
+  801293:	8d 50 01             	lea    0x1(%rax),%edx
+  801296:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80129a:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80129d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012a1:	48 8b 10             	mov    (%rax),%rdx
+  8012a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012a8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012ac:	48 39 c2             	cmp    %rax,%rdx
+  8012af:	73 17                	jae    8012c8 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8012b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012b5:	48 8b 00             	mov    (%rax),%rax
+  8012b8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012c0:	48 89 0a             	mov    %rcx,(%rdx)
+  8012c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8012c6:	88 10                	mov    %dl,(%rax)
+}
+  8012c8:	90                   	nop
+  8012c9:	c9                   	leave
+  8012ca:	c3                   	ret
+
+00000000008012cb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8012cb:	55                   	push   %rbp
+  8012cc:	48 89 e5             	mov    %rsp,%rbp
+  8012cf:	53                   	push   %rbx
+  8012d0:	48 83 ec 58          	sub    $0x58,%rsp
+  8012d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012d4 <vsnprintf+0x9>
+  8012db:	49 bb 6c 7d 00 00 00 	movabs $0x7d6c,%r11
+  8012e2:	00 00 00 
+  8012e5:	4c 01 d8             	add    %r11,%rax
+  8012e8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8012ec:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8012ef:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8012f3:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8012f7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8012fb:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8012ff:	48 8b 0e             	mov    (%rsi),%rcx
+  801302:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801306:	48 89 0a             	mov    %rcx,(%rdx)
+  801309:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80130d:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801311:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801315:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801319:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80131d:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801320:	48 63 d2             	movslq %edx,%rdx
+  801323:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801327:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80132b:	48 01 ca             	add    %rcx,%rdx
+  80132e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801332:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801339:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80133e:	74 06                	je     801346 <vsnprintf+0x7b>
+  801340:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801344:	7f 07                	jg     80134d <vsnprintf+0x82>
+		return -E_INVAL;
+  801346:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80134b:	eb 34                	jmp    801381 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80134d:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801351:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801355:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801359:	48 bf 29 82 ff ff ff 	movabs $0xffffffffffff8229,%rdi
+  801360:	ff ff ff 
+  801363:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801367:	49 b8 56 7b ff ff ff 	movabs $0xffffffffffff7b56,%r8
+  80136e:	ff ff ff 
+  801371:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801375:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801377:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80137b:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80137e:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801381:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801385:	c9                   	leave
+  801386:	c3                   	ret
+
+0000000000801387 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801387:	55                   	push   %rbp
+  801388:	48 89 e5             	mov    %rsp,%rbp
+  80138b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801392:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801392 <snprintf+0xb>
+  801399:	49 bb ae 7c 00 00 00 	movabs $0x7cae,%r11
+  8013a0:	00 00 00 
+  8013a3:	4d 01 da             	add    %r11,%r10
+  8013a6:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8013ad:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8013b3:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8013ba:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8013c1:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8013c8:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8013cf:	84 c0                	test   %al,%al
+  8013d1:	74 20                	je     8013f3 <snprintf+0x6c>
+  8013d3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8013d7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8013db:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8013df:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8013e3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8013e7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8013eb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8013ef:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8013f3:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8013fa:	00 00 00 
+  8013fd:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801404:	00 00 00 
+  801407:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80140b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801412:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801419:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801420:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801427:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80142e:	48 8b 06             	mov    (%rsi),%rax
+  801431:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801435:	48 89 01             	mov    %rax,(%rcx)
+  801438:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80143c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801440:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801444:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80144b:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801452:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801458:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80145f:	48 89 c7             	mov    %rax,%rdi
+  801462:	48 b8 8b 82 ff ff ff 	movabs $0xffffffffffff828b,%rax
+  801469:	ff ff ff 
+  80146c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801470:	ff d0                	call   *%rax
+  801472:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801478:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80147e:	c9                   	leave
+  80147f:	c3                   	ret
+
+0000000000801480 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801480:	55                   	push   %rbp
+  801481:	48 89 e5             	mov    %rsp,%rbp
+  801484:	48 83 ec 18          	sub    $0x18,%rsp
+  801488:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801488 <strlen+0x8>
+  80148f:	49 bb b8 7b 00 00 00 	movabs $0x7bb8,%r11
+  801496:	00 00 00 
+  801499:	4c 01 d8             	add    %r11,%rax
+  80149c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8014a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014a7:	eb 09                	jmp    8014b2 <strlen+0x32>
+		n++;
+  8014a9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8014ad:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014b6:	0f b6 00             	movzbl (%rax),%eax
+  8014b9:	84 c0                	test   %al,%al
+  8014bb:	75 ec                	jne    8014a9 <strlen+0x29>
+	return n;
+  8014bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8014c0:	c9                   	leave
+  8014c1:	c3                   	ret
+
+00000000008014c2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8014c2:	55                   	push   %rbp
+  8014c3:	48 89 e5             	mov    %rsp,%rbp
+  8014c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8014ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014ca <strnlen+0x8>
+  8014d1:	49 bb 76 7b 00 00 00 	movabs $0x7b76,%r11
+  8014d8:	00 00 00 
+  8014db:	4c 01 d8             	add    %r11,%rax
+  8014de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014e6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014ed:	eb 0e                	jmp    8014fd <strnlen+0x3b>
+		n++;
+  8014ef:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8014f3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014f8:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8014fd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801502:	74 0b                	je     80150f <strnlen+0x4d>
+  801504:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801508:	0f b6 00             	movzbl (%rax),%eax
+  80150b:	84 c0                	test   %al,%al
+  80150d:	75 e0                	jne    8014ef <strnlen+0x2d>
+	return n;
+  80150f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801512:	c9                   	leave
+  801513:	c3                   	ret
+
+0000000000801514 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801514:	55                   	push   %rbp
+  801515:	48 89 e5             	mov    %rsp,%rbp
+  801518:	48 83 ec 20          	sub    $0x20,%rsp
+  80151c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80151c <strcpy+0x8>
+  801523:	49 bb 24 7b 00 00 00 	movabs $0x7b24,%r11
+  80152a:	00 00 00 
+  80152d:	4c 01 d8             	add    %r11,%rax
+  801530:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801534:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801538:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80153c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801540:	90                   	nop
+  801541:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801545:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801549:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80154d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801551:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801555:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801559:	0f b6 12             	movzbl (%rdx),%edx
+  80155c:	88 10                	mov    %dl,(%rax)
+  80155e:	0f b6 00             	movzbl (%rax),%eax
+  801561:	84 c0                	test   %al,%al
+  801563:	75 dc                	jne    801541 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801565:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801569:	c9                   	leave
+  80156a:	c3                   	ret
+
+000000000080156b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80156b:	55                   	push   %rbp
+  80156c:	48 89 e5             	mov    %rsp,%rbp
+  80156f:	53                   	push   %rbx
+  801570:	48 83 ec 20          	sub    $0x20,%rsp
+  801574:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801574 <strcat+0x9>
+  80157b:	49 bb cc 7a 00 00 00 	movabs $0x7acc,%r11
+  801582:	00 00 00 
+  801585:	4c 01 db             	add    %r11,%rbx
+  801588:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80158c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801590:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801594:	48 89 c7             	mov    %rax,%rdi
+  801597:	48 b8 40 84 ff ff ff 	movabs $0xffffffffffff8440,%rax
+  80159e:	ff ff ff 
+  8015a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015a5:	ff d0                	call   *%rax
+  8015a7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8015aa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015ad:	48 63 d0             	movslq %eax,%rdx
+  8015b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015b4:	48 01 c2             	add    %rax,%rdx
+  8015b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015bb:	48 89 c6             	mov    %rax,%rsi
+  8015be:	48 89 d7             	mov    %rdx,%rdi
+  8015c1:	48 b8 d4 84 ff ff ff 	movabs $0xffffffffffff84d4,%rax
+  8015c8:	ff ff ff 
+  8015cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015cf:	ff d0                	call   *%rax
+	return dst;
+  8015d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8015d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015d9:	c9                   	leave
+  8015da:	c3                   	ret
+
+00000000008015db <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8015db:	55                   	push   %rbp
+  8015dc:	48 89 e5             	mov    %rsp,%rbp
+  8015df:	48 83 ec 28          	sub    $0x28,%rsp
+  8015e3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015e3 <strncpy+0x8>
+  8015ea:	49 bb 5d 7a 00 00 00 	movabs $0x7a5d,%r11
+  8015f1:	00 00 00 
+  8015f4:	4c 01 d8             	add    %r11,%rax
+  8015f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015ff:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801603:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801607:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80160b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801612:	00 
+  801613:	eb 2a                	jmp    80163f <strncpy+0x64>
+		*dst++ = *src;
+  801615:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801619:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80161d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801621:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801625:	0f b6 12             	movzbl (%rdx),%edx
+  801628:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80162a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80162e:	0f b6 00             	movzbl (%rax),%eax
+  801631:	84 c0                	test   %al,%al
+  801633:	74 05                	je     80163a <strncpy+0x5f>
+			src++;
+  801635:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80163a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80163f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801643:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801647:	72 cc                	jb     801615 <strncpy+0x3a>
+	}
+	return ret;
+  801649:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80164d:	c9                   	leave
+  80164e:	c3                   	ret
+
+000000000080164f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80164f:	55                   	push   %rbp
+  801650:	48 89 e5             	mov    %rsp,%rbp
+  801653:	48 83 ec 28          	sub    $0x28,%rsp
+  801657:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801657 <strlcpy+0x8>
+  80165e:	49 bb e9 79 00 00 00 	movabs $0x79e9,%r11
+  801665:	00 00 00 
+  801668:	4c 01 d8             	add    %r11,%rax
+  80166b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80166f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801673:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801677:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80167b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80167f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801684:	74 3d                	je     8016c3 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801686:	eb 1d                	jmp    8016a5 <strlcpy+0x56>
+			*dst++ = *src++;
+  801688:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80168c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801690:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801694:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801698:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80169c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016a0:	0f b6 12             	movzbl (%rdx),%edx
+  8016a3:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8016a5:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016aa:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016af:	74 0b                	je     8016bc <strlcpy+0x6d>
+  8016b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016b5:	0f b6 00             	movzbl (%rax),%eax
+  8016b8:	84 c0                	test   %al,%al
+  8016ba:	75 cc                	jne    801688 <strlcpy+0x39>
+		*dst = '\0';
+  8016bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c0:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8016c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c7:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8016cb:	c9                   	leave
+  8016cc:	c3                   	ret
+
+00000000008016cd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8016cd:	55                   	push   %rbp
+  8016ce:	48 89 e5             	mov    %rsp,%rbp
+  8016d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8016d5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016d5 <strcmp+0x8>
+  8016dc:	49 bb 6b 79 00 00 00 	movabs $0x796b,%r11
+  8016e3:	00 00 00 
+  8016e6:	4c 01 d8             	add    %r11,%rax
+  8016e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016ed:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8016f1:	eb 0a                	jmp    8016fd <strcmp+0x30>
+		p++, q++;
+  8016f3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016f8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8016fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801701:	0f b6 00             	movzbl (%rax),%eax
+  801704:	84 c0                	test   %al,%al
+  801706:	74 12                	je     80171a <strcmp+0x4d>
+  801708:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80170c:	0f b6 10             	movzbl (%rax),%edx
+  80170f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801713:	0f b6 00             	movzbl (%rax),%eax
+  801716:	38 c2                	cmp    %al,%dl
+  801718:	74 d9                	je     8016f3 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80171a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80171e:	0f b6 00             	movzbl (%rax),%eax
+  801721:	0f b6 d0             	movzbl %al,%edx
+  801724:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801728:	0f b6 00             	movzbl (%rax),%eax
+  80172b:	0f b6 c0             	movzbl %al,%eax
+  80172e:	29 c2                	sub    %eax,%edx
+  801730:	89 d0                	mov    %edx,%eax
+}
+  801732:	c9                   	leave
+  801733:	c3                   	ret
+
+0000000000801734 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801734:	55                   	push   %rbp
+  801735:	48 89 e5             	mov    %rsp,%rbp
+  801738:	48 83 ec 18          	sub    $0x18,%rsp
+  80173c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80173c <strncmp+0x8>
+  801743:	49 bb 04 79 00 00 00 	movabs $0x7904,%r11
+  80174a:	00 00 00 
+  80174d:	4c 01 d8             	add    %r11,%rax
+  801750:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801754:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801758:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80175c:	eb 0f                	jmp    80176d <strncmp+0x39>
+		n--, p++, q++;
+  80175e:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801763:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801768:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80176d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801772:	74 1d                	je     801791 <strncmp+0x5d>
+  801774:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801778:	0f b6 00             	movzbl (%rax),%eax
+  80177b:	84 c0                	test   %al,%al
+  80177d:	74 12                	je     801791 <strncmp+0x5d>
+  80177f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801783:	0f b6 10             	movzbl (%rax),%edx
+  801786:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80178a:	0f b6 00             	movzbl (%rax),%eax
+  80178d:	38 c2                	cmp    %al,%dl
+  80178f:	74 cd                	je     80175e <strncmp+0x2a>
+	if (n == 0)
+  801791:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801796:	75 07                	jne    80179f <strncmp+0x6b>
+		return 0;
+  801798:	ba 00 00 00 00       	mov    $0x0,%edx
+  80179d:	eb 16                	jmp    8017b5 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80179f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017a3:	0f b6 00             	movzbl (%rax),%eax
+  8017a6:	0f b6 d0             	movzbl %al,%edx
+  8017a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ad:	0f b6 00             	movzbl (%rax),%eax
+  8017b0:	0f b6 c0             	movzbl %al,%eax
+  8017b3:	29 c2                	sub    %eax,%edx
+}
+  8017b5:	89 d0                	mov    %edx,%eax
+  8017b7:	c9                   	leave
+  8017b8:	c3                   	ret
+
+00000000008017b9 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8017b9:	55                   	push   %rbp
+  8017ba:	48 89 e5             	mov    %rsp,%rbp
+  8017bd:	48 83 ec 10          	sub    $0x10,%rsp
+  8017c1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017c1 <strchr+0x8>
+  8017c8:	49 bb 7f 78 00 00 00 	movabs $0x787f,%r11
+  8017cf:	00 00 00 
+  8017d2:	4c 01 d8             	add    %r11,%rax
+  8017d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017d9:	89 f0                	mov    %esi,%eax
+  8017db:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8017de:	eb 17                	jmp    8017f7 <strchr+0x3e>
+		if (*s == c)
+  8017e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017e4:	0f b6 00             	movzbl (%rax),%eax
+  8017e7:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8017ea:	75 06                	jne    8017f2 <strchr+0x39>
+			return (char *) s;
+  8017ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f0:	eb 15                	jmp    801807 <strchr+0x4e>
+	for (; *s; s++)
+  8017f2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017fb:	0f b6 00             	movzbl (%rax),%eax
+  8017fe:	84 c0                	test   %al,%al
+  801800:	75 de                	jne    8017e0 <strchr+0x27>
+	return 0;
+  801802:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801807:	c9                   	leave
+  801808:	c3                   	ret
+
+0000000000801809 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801809:	55                   	push   %rbp
+  80180a:	48 89 e5             	mov    %rsp,%rbp
+  80180d:	48 83 ec 10          	sub    $0x10,%rsp
+  801811:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801811 <strfind+0x8>
+  801818:	49 bb 2f 78 00 00 00 	movabs $0x782f,%r11
+  80181f:	00 00 00 
+  801822:	4c 01 d8             	add    %r11,%rax
+  801825:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801829:	89 f0                	mov    %esi,%eax
+  80182b:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80182e:	eb 11                	jmp    801841 <strfind+0x38>
+		if (*s == c)
+  801830:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801834:	0f b6 00             	movzbl (%rax),%eax
+  801837:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80183a:	74 12                	je     80184e <strfind+0x45>
+	for (; *s; s++)
+  80183c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801841:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801845:	0f b6 00             	movzbl (%rax),%eax
+  801848:	84 c0                	test   %al,%al
+  80184a:	75 e4                	jne    801830 <strfind+0x27>
+  80184c:	eb 01                	jmp    80184f <strfind+0x46>
+			break;
+  80184e:	90                   	nop
+	return (char *) s;
+  80184f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801853:	c9                   	leave
+  801854:	c3                   	ret
+
+0000000000801855 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801855:	55                   	push   %rbp
+  801856:	48 89 e5             	mov    %rsp,%rbp
+  801859:	48 83 ec 18          	sub    $0x18,%rsp
+  80185d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80185d <memset+0x8>
+  801864:	49 bb e3 77 00 00 00 	movabs $0x77e3,%r11
+  80186b:	00 00 00 
+  80186e:	4c 01 d8             	add    %r11,%rax
+  801871:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801875:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801878:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80187c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801881:	75 06                	jne    801889 <memset+0x34>
+		return v;
+  801883:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801887:	eb 69                	jmp    8018f2 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801889:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80188d:	83 e0 03             	and    $0x3,%eax
+  801890:	48 85 c0             	test   %rax,%rax
+  801893:	75 48                	jne    8018dd <memset+0x88>
+  801895:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801899:	83 e0 03             	and    $0x3,%eax
+  80189c:	48 85 c0             	test   %rax,%rax
+  80189f:	75 3c                	jne    8018dd <memset+0x88>
+		c &= 0xFF;
+  8018a1:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8018a8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ab:	c1 e0 18             	shl    $0x18,%eax
+  8018ae:	89 c2                	mov    %eax,%edx
+  8018b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018b3:	c1 e0 10             	shl    $0x10,%eax
+  8018b6:	09 c2                	or     %eax,%edx
+  8018b8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018bb:	c1 e0 08             	shl    $0x8,%eax
+  8018be:	09 d0                	or     %edx,%eax
+  8018c0:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8018c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018c7:	48 c1 e8 02          	shr    $0x2,%rax
+  8018cb:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8018ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018d2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d5:	48 89 d7             	mov    %rdx,%rdi
+  8018d8:	fc                   	cld
+  8018d9:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8018db:	eb 11                	jmp    8018ee <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8018dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018e1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018e4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8018e8:	48 89 d7             	mov    %rdx,%rdi
+  8018eb:	fc                   	cld
+  8018ec:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8018ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018f2:	c9                   	leave
+  8018f3:	c3                   	ret
+
+00000000008018f4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8018f4:	55                   	push   %rbp
+  8018f5:	48 89 e5             	mov    %rsp,%rbp
+  8018f8:	48 83 ec 28          	sub    $0x28,%rsp
+  8018fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018fc <memmove+0x8>
+  801903:	49 bb 44 77 00 00 00 	movabs $0x7744,%r11
+  80190a:	00 00 00 
+  80190d:	4c 01 d8             	add    %r11,%rax
+  801910:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801914:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801918:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  80191c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801920:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801924:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801928:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  80192c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801930:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801934:	0f 83 88 00 00 00    	jae    8019c2 <memmove+0xce>
+  80193a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80193e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801942:	48 01 d0             	add    %rdx,%rax
+  801945:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801949:	73 77                	jae    8019c2 <memmove+0xce>
+		s += n;
+  80194b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80194f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801953:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801957:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  80195b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80195f:	83 e0 03             	and    $0x3,%eax
+  801962:	48 85 c0             	test   %rax,%rax
+  801965:	75 3b                	jne    8019a2 <memmove+0xae>
+  801967:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80196b:	83 e0 03             	and    $0x3,%eax
+  80196e:	48 85 c0             	test   %rax,%rax
+  801971:	75 2f                	jne    8019a2 <memmove+0xae>
+  801973:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801977:	83 e0 03             	and    $0x3,%eax
+  80197a:	48 85 c0             	test   %rax,%rax
+  80197d:	75 23                	jne    8019a2 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80197f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801983:	48 83 e8 04          	sub    $0x4,%rax
+  801987:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80198b:	48 83 ea 04          	sub    $0x4,%rdx
+  80198f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801993:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801997:	48 89 c7             	mov    %rax,%rdi
+  80199a:	48 89 d6             	mov    %rdx,%rsi
+  80199d:	fd                   	std
+  80199e:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8019a0:	eb 1d                	jmp    8019bf <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8019a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019ae:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8019b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b6:	48 89 d7             	mov    %rdx,%rdi
+  8019b9:	48 89 c1             	mov    %rax,%rcx
+  8019bc:	fd                   	std
+  8019bd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8019bf:	fc                   	cld
+  8019c0:	eb 57                	jmp    801a19 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8019c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019c6:	83 e0 03             	and    $0x3,%eax
+  8019c9:	48 85 c0             	test   %rax,%rax
+  8019cc:	75 36                	jne    801a04 <memmove+0x110>
+  8019ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d2:	83 e0 03             	and    $0x3,%eax
+  8019d5:	48 85 c0             	test   %rax,%rax
+  8019d8:	75 2a                	jne    801a04 <memmove+0x110>
+  8019da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019de:	83 e0 03             	and    $0x3,%eax
+  8019e1:	48 85 c0             	test   %rax,%rax
+  8019e4:	75 1e                	jne    801a04 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8019e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ea:	48 c1 e8 02          	shr    $0x2,%rax
+  8019ee:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8019f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019f5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019f9:	48 89 c7             	mov    %rax,%rdi
+  8019fc:	48 89 d6             	mov    %rdx,%rsi
+  8019ff:	fc                   	cld
+  801a00:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a02:	eb 15                	jmp    801a19 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801a04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a08:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a0c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a10:	48 89 c7             	mov    %rax,%rdi
+  801a13:	48 89 d6             	mov    %rdx,%rsi
+  801a16:	fc                   	cld
+  801a17:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801a19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a1d:	c9                   	leave
+  801a1e:	c3                   	ret
+
+0000000000801a1f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801a1f:	55                   	push   %rbp
+  801a20:	48 89 e5             	mov    %rsp,%rbp
+  801a23:	48 83 ec 18          	sub    $0x18,%rsp
+  801a27:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a27 <memcpy+0x8>
+  801a2e:	49 bb 19 76 00 00 00 	movabs $0x7619,%r11
+  801a35:	00 00 00 
+  801a38:	4c 01 d8             	add    %r11,%rax
+  801a3b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a3f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a43:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801a47:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a4b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801a4f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a53:	48 89 cf             	mov    %rcx,%rdi
+  801a56:	48 b9 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rcx
+  801a5d:	ff ff ff 
+  801a60:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801a64:	ff d0                	call   *%rax
+}
+  801a66:	c9                   	leave
+  801a67:	c3                   	ret
+
+0000000000801a68 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801a68:	55                   	push   %rbp
+  801a69:	48 89 e5             	mov    %rsp,%rbp
+  801a6c:	48 83 ec 28          	sub    $0x28,%rsp
+  801a70:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a70 <memcmp+0x8>
+  801a77:	49 bb d0 75 00 00 00 	movabs $0x75d0,%r11
+  801a7e:	00 00 00 
+  801a81:	4c 01 d8             	add    %r11,%rax
+  801a84:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a88:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a8c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801a90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801a98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801aa0:	eb 34                	jmp    801ad6 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801aa2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aa6:	0f b6 10             	movzbl (%rax),%edx
+  801aa9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aad:	0f b6 00             	movzbl (%rax),%eax
+  801ab0:	38 c2                	cmp    %al,%dl
+  801ab2:	74 18                	je     801acc <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801ab4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ab8:	0f b6 00             	movzbl (%rax),%eax
+  801abb:	0f b6 d0             	movzbl %al,%edx
+  801abe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ac2:	0f b6 00             	movzbl (%rax),%eax
+  801ac5:	0f b6 c0             	movzbl %al,%eax
+  801ac8:	29 c2                	sub    %eax,%edx
+  801aca:	eb 20                	jmp    801aec <memcmp+0x84>
+		s1++, s2++;
+  801acc:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ad1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801ad6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ada:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ade:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801ae2:	48 85 c0             	test   %rax,%rax
+  801ae5:	75 bb                	jne    801aa2 <memcmp+0x3a>
+	}
+
+	return 0;
+  801ae7:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801aec:	89 d0                	mov    %edx,%eax
+  801aee:	c9                   	leave
+  801aef:	c3                   	ret
+
+0000000000801af0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801af0:	55                   	push   %rbp
+  801af1:	48 89 e5             	mov    %rsp,%rbp
+  801af4:	48 83 ec 28          	sub    $0x28,%rsp
+  801af8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801af8 <memfind+0x8>
+  801aff:	49 bb 48 75 00 00 00 	movabs $0x7548,%r11
+  801b06:	00 00 00 
+  801b09:	4c 01 d8             	add    %r11,%rax
+  801b0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b10:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801b13:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801b17:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b1f:	48 01 d0             	add    %rdx,%rax
+  801b22:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801b26:	eb 13                	jmp    801b3b <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801b28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b2c:	0f b6 00             	movzbl (%rax),%eax
+  801b2f:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801b32:	38 d0                	cmp    %dl,%al
+  801b34:	74 11                	je     801b47 <memfind+0x57>
+	for (; s < ends; s++)
+  801b36:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801b3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b3f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b43:	72 e3                	jb     801b28 <memfind+0x38>
+  801b45:	eb 01                	jmp    801b48 <memfind+0x58>
+			break;
+  801b47:	90                   	nop
+	return (void *) s;
+  801b48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b4c:	c9                   	leave
+  801b4d:	c3                   	ret
+
+0000000000801b4e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801b4e:	55                   	push   %rbp
+  801b4f:	48 89 e5             	mov    %rsp,%rbp
+  801b52:	48 83 ec 38          	sub    $0x38,%rsp
+  801b56:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b56 <strtol+0x8>
+  801b5d:	49 bb ea 74 00 00 00 	movabs $0x74ea,%r11
+  801b64:	00 00 00 
+  801b67:	4c 01 d8             	add    %r11,%rax
+  801b6a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b6e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b72:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801b75:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b7c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b83:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801b84:	eb 05                	jmp    801b8b <strtol+0x3d>
+		s++;
+  801b86:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801b8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b8f:	0f b6 00             	movzbl (%rax),%eax
+  801b92:	3c 20                	cmp    $0x20,%al
+  801b94:	74 f0                	je     801b86 <strtol+0x38>
+  801b96:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b9a:	0f b6 00             	movzbl (%rax),%eax
+  801b9d:	3c 09                	cmp    $0x9,%al
+  801b9f:	74 e5                	je     801b86 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801ba1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ba5:	0f b6 00             	movzbl (%rax),%eax
+  801ba8:	3c 2b                	cmp    $0x2b,%al
+  801baa:	75 07                	jne    801bb3 <strtol+0x65>
+		s++;
+  801bac:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bb1:	eb 17                	jmp    801bca <strtol+0x7c>
+	else if (*s == '-')
+  801bb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb7:	0f b6 00             	movzbl (%rax),%eax
+  801bba:	3c 2d                	cmp    $0x2d,%al
+  801bbc:	75 0c                	jne    801bca <strtol+0x7c>
+		s++, neg = 1;
+  801bbe:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bc3:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801bca:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801bce:	74 06                	je     801bd6 <strtol+0x88>
+  801bd0:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bd4:	75 28                	jne    801bfe <strtol+0xb0>
+  801bd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bda:	0f b6 00             	movzbl (%rax),%eax
+  801bdd:	3c 30                	cmp    $0x30,%al
+  801bdf:	75 1d                	jne    801bfe <strtol+0xb0>
+  801be1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801be5:	48 83 c0 01          	add    $0x1,%rax
+  801be9:	0f b6 00             	movzbl (%rax),%eax
+  801bec:	3c 78                	cmp    $0x78,%al
+  801bee:	75 0e                	jne    801bfe <strtol+0xb0>
+		s += 2, base = 16;
+  801bf0:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801bf5:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801bfc:	eb 2c                	jmp    801c2a <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801bfe:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c02:	75 19                	jne    801c1d <strtol+0xcf>
+  801c04:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c08:	0f b6 00             	movzbl (%rax),%eax
+  801c0b:	3c 30                	cmp    $0x30,%al
+  801c0d:	75 0e                	jne    801c1d <strtol+0xcf>
+		s++, base = 8;
+  801c0f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c14:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c1b:	eb 0d                	jmp    801c2a <strtol+0xdc>
+	else if (base == 0)
+  801c1d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c21:	75 07                	jne    801c2a <strtol+0xdc>
+		base = 10;
+  801c23:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801c2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2e:	0f b6 00             	movzbl (%rax),%eax
+  801c31:	3c 2f                	cmp    $0x2f,%al
+  801c33:	7e 1d                	jle    801c52 <strtol+0x104>
+  801c35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c39:	0f b6 00             	movzbl (%rax),%eax
+  801c3c:	3c 39                	cmp    $0x39,%al
+  801c3e:	7f 12                	jg     801c52 <strtol+0x104>
+			dig = *s - '0';
+  801c40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c44:	0f b6 00             	movzbl (%rax),%eax
+  801c47:	0f be c0             	movsbl %al,%eax
+  801c4a:	83 e8 30             	sub    $0x30,%eax
+  801c4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c50:	eb 4e                	jmp    801ca0 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801c52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c56:	0f b6 00             	movzbl (%rax),%eax
+  801c59:	3c 60                	cmp    $0x60,%al
+  801c5b:	7e 1d                	jle    801c7a <strtol+0x12c>
+  801c5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c61:	0f b6 00             	movzbl (%rax),%eax
+  801c64:	3c 7a                	cmp    $0x7a,%al
+  801c66:	7f 12                	jg     801c7a <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801c68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c6c:	0f b6 00             	movzbl (%rax),%eax
+  801c6f:	0f be c0             	movsbl %al,%eax
+  801c72:	83 e8 57             	sub    $0x57,%eax
+  801c75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c78:	eb 26                	jmp    801ca0 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c7a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c7e:	0f b6 00             	movzbl (%rax),%eax
+  801c81:	3c 40                	cmp    $0x40,%al
+  801c83:	7e 47                	jle    801ccc <strtol+0x17e>
+  801c85:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c89:	0f b6 00             	movzbl (%rax),%eax
+  801c8c:	3c 5a                	cmp    $0x5a,%al
+  801c8e:	7f 3c                	jg     801ccc <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801c90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c94:	0f b6 00             	movzbl (%rax),%eax
+  801c97:	0f be c0             	movsbl %al,%eax
+  801c9a:	83 e8 37             	sub    $0x37,%eax
+  801c9d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801ca0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ca3:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801ca6:	7d 23                	jge    801ccb <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801ca8:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cad:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801cb0:	48 98                	cltq
+  801cb2:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cb7:	48 89 c2             	mov    %rax,%rdx
+  801cba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cbd:	48 98                	cltq
+  801cbf:	48 01 d0             	add    %rdx,%rax
+  801cc2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801cc6:	e9 5f ff ff ff       	jmp    801c2a <strtol+0xdc>
+			break;
+  801ccb:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ccc:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cd1:	74 0b                	je     801cde <strtol+0x190>
+		*endptr = (char *) s;
+  801cd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cd7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cdb:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801cde:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ce2:	74 09                	je     801ced <strtol+0x19f>
+  801ce4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce8:	48 f7 d8             	neg    %rax
+  801ceb:	eb 04                	jmp    801cf1 <strtol+0x1a3>
+  801ced:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801cf1:	c9                   	leave
+  801cf2:	c3                   	ret
+
+0000000000801cf3 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801cf3:	55                   	push   %rbp
+  801cf4:	48 89 e5             	mov    %rsp,%rbp
+  801cf7:	53                   	push   %rbx
+  801cf8:	48 83 ec 30          	sub    $0x30,%rsp
+  801cfc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801cfc <strstr+0x9>
+  801d03:	49 bb 44 73 00 00 00 	movabs $0x7344,%r11
+  801d0a:	00 00 00 
+  801d0d:	4c 01 db             	add    %r11,%rbx
+  801d10:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801d14:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801d18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d1c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d20:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d24:	0f b6 00             	movzbl (%rax),%eax
+  801d27:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801d2a:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801d2e:	75 06                	jne    801d36 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801d30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d34:	eb 73                	jmp    801da9 <strstr+0xb6>
+
+	len = strlen(str);
+  801d36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d3a:	48 89 c7             	mov    %rax,%rdi
+  801d3d:	48 b8 40 84 ff ff ff 	movabs $0xffffffffffff8440,%rax
+  801d44:	ff ff ff 
+  801d47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d4b:	ff d0                	call   *%rax
+  801d4d:	48 98                	cltq
+  801d4f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801d53:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d57:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d5b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d5f:	0f b6 00             	movzbl (%rax),%eax
+  801d62:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801d65:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801d69:	75 07                	jne    801d72 <strstr+0x7f>
+				return (char *) 0;
+  801d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d70:	eb 37                	jmp    801da9 <strstr+0xb6>
+		} while (sc != c);
+  801d72:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801d76:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801d79:	75 d8                	jne    801d53 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801d7b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d7f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d83:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d87:	48 89 ce             	mov    %rcx,%rsi
+  801d8a:	48 89 c7             	mov    %rax,%rdi
+  801d8d:	48 b8 f4 86 ff ff ff 	movabs $0xffffffffffff86f4,%rax
+  801d94:	ff ff ff 
+  801d97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d9b:	ff d0                	call   *%rax
+  801d9d:	85 c0                	test   %eax,%eax
+  801d9f:	75 b2                	jne    801d53 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801da1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da5:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801da9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dad:	c9                   	leave
+  801dae:	c3                   	ret
+
+0000000000801daf <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801daf:	55                   	push   %rbp
+  801db0:	48 89 e5             	mov    %rsp,%rbp
+  801db3:	41 57                	push   %r15
+  801db5:	53                   	push   %rbx
+  801db6:	48 83 ec 40          	sub    $0x40,%rsp
+  801dba:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801dba <syscall+0xb>
+  801dc1:	49 bb 86 72 00 00 00 	movabs $0x7286,%r11
+  801dc8:	00 00 00 
+  801dcb:	4d 01 da             	add    %r11,%r10
+  801dce:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801dd1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801dd4:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801dd8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801ddc:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801de0:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801de4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801de7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801deb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801def:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801df3:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801df7:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801dfb:	4c 89 c3             	mov    %r8,%rbx
+  801dfe:	cd 30                	int    $0x30
+  801e00:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801e04:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801e08:	74 52                	je     801e5c <syscall+0xad>
+  801e0a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e0f:	7e 4b                	jle    801e5c <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e11:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e18:	49 89 d0             	mov    %rdx,%r8
+  801e1b:	89 c1                	mov    %eax,%ecx
+  801e1d:	48 b8 e8 e2 ff ff ff 	movabs $0xffffffffffffe2e8,%rax
+  801e24:	ff ff ff 
+  801e27:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e2b:	48 89 c2             	mov    %rax,%rdx
+  801e2e:	be 23 00 00 00       	mov    $0x23,%esi
+  801e33:	48 b8 05 e3 ff ff ff 	movabs $0xffffffffffffe305,%rax
+  801e3a:	ff ff ff 
+  801e3d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e41:	48 89 c7             	mov    %rax,%rdi
+  801e44:	4d 89 d7             	mov    %r10,%r15
+  801e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4c:	49 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%r9
+  801e53:	ff ff ff 
+  801e56:	4d 01 d1             	add    %r10,%r9
+  801e59:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e60:	48 83 c4 40          	add    $0x40,%rsp
+  801e64:	5b                   	pop    %rbx
+  801e65:	41 5f                	pop    %r15
+  801e67:	5d                   	pop    %rbp
+  801e68:	c3                   	ret
+
+0000000000801e69 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801e69:	55                   	push   %rbp
+  801e6a:	48 89 e5             	mov    %rsp,%rbp
+  801e6d:	41 57                	push   %r15
+  801e6f:	41 56                	push   %r14
+  801e71:	41 55                	push   %r13
+  801e73:	41 54                	push   %r12
+  801e75:	53                   	push   %rbx
+  801e76:	48 83 ec 48          	sub    $0x48,%rsp
+  801e7a:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801e7a <syscall_words+0x11>
+  801e81:	49 bb c6 71 00 00 00 	movabs $0x71c6,%r11
+  801e88:	00 00 00 
+  801e8b:	4d 01 de             	add    %r11,%r14
+  801e8e:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801e91:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801e94:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801e98:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801e9c:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801ea0:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801ea4:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ea9:	74 09                	je     801eb4 <syscall_words+0x4b>
+  801eab:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801eaf:	48 8b 00             	mov    (%rax),%rax
+  801eb2:	eb 05                	jmp    801eb9 <syscall_words+0x50>
+  801eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb9:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801ebc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ec1:	74 0a                	je     801ecd <syscall_words+0x64>
+  801ec3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ec7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ecb:	eb 05                	jmp    801ed2 <syscall_words+0x69>
+  801ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed2:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801ed5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801eda:	74 0a                	je     801ee6 <syscall_words+0x7d>
+  801edc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ee0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ee4:	eb 05                	jmp    801eeb <syscall_words+0x82>
+  801ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eeb:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801eee:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ef3:	74 0a                	je     801eff <syscall_words+0x96>
+  801ef5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ef9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801efd:	eb 05                	jmp    801f04 <syscall_words+0x9b>
+  801eff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f04:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801f07:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f0c:	74 0a                	je     801f18 <syscall_words+0xaf>
+  801f0e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f12:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f16:	eb 05                	jmp    801f1d <syscall_words+0xb4>
+  801f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1d:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801f20:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f25:	74 0a                	je     801f31 <syscall_words+0xc8>
+  801f27:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f2b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801f2f:	eb 05                	jmp    801f36 <syscall_words+0xcd>
+  801f31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f36:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801f39:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f3c:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801f40:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f44:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801f48:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801f4c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f50:	cd 30                	int    $0x30
+  801f52:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801f56:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f5b:	74 50                	je     801fad <syscall_words+0x144>
+		words[0] = r8;
+  801f5d:	4c 89 c2             	mov    %r8,%rdx
+  801f60:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f64:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801f67:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f6b:	48 83 c0 08          	add    $0x8,%rax
+  801f6f:	4c 89 ca             	mov    %r9,%rdx
+  801f72:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801f75:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f79:	48 83 c0 10          	add    $0x10,%rax
+  801f7d:	4c 89 d2             	mov    %r10,%rdx
+  801f80:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801f83:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f87:	48 83 c0 18          	add    $0x18,%rax
+  801f8b:	4c 89 da             	mov    %r11,%rdx
+  801f8e:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801f91:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f95:	48 83 c0 20          	add    $0x20,%rax
+  801f99:	4c 89 e2             	mov    %r12,%rdx
+  801f9c:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801f9f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fa3:	48 83 c0 28          	add    $0x28,%rax
+  801fa7:	4c 89 ea             	mov    %r13,%rdx
+  801faa:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801fad:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801fb1:	74 52                	je     802005 <syscall_words+0x19c>
+  801fb3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801fb8:	7e 4b                	jle    802005 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fba:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801fbe:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801fc1:	49 89 d0             	mov    %rdx,%r8
+  801fc4:	89 c1                	mov    %eax,%ecx
+  801fc6:	48 b8 e8 e2 ff ff ff 	movabs $0xffffffffffffe2e8,%rax
+  801fcd:	ff ff ff 
+  801fd0:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801fd4:	48 89 c2             	mov    %rax,%rdx
+  801fd7:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801fdc:	48 b8 05 e3 ff ff ff 	movabs $0xffffffffffffe305,%rax
+  801fe3:	ff ff ff 
+  801fe6:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801fea:	48 89 c7             	mov    %rax,%rdi
+  801fed:	4d 89 f7             	mov    %r14,%r15
+  801ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff5:	49 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%r9
+  801ffc:	ff ff ff 
+  801fff:	4d 01 f1             	add    %r14,%r9
+  802002:	41 ff d1             	call   *%r9
+
+	return ret;
+  802005:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802009:	48 83 c4 48          	add    $0x48,%rsp
+  80200d:	5b                   	pop    %rbx
+  80200e:	41 5c                	pop    %r12
+  802010:	41 5d                	pop    %r13
+  802012:	41 5e                	pop    %r14
+  802014:	41 5f                	pop    %r15
+  802016:	5d                   	pop    %rbp
+  802017:	c3                   	ret
+
+0000000000802018 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802018:	55                   	push   %rbp
+  802019:	48 89 e5             	mov    %rsp,%rbp
+  80201c:	48 83 ec 10          	sub    $0x10,%rsp
+  802020:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802020 <sys_cputs+0x8>
+  802027:	49 bb 20 70 00 00 00 	movabs $0x7020,%r11
+  80202e:	00 00 00 
+  802031:	4c 01 d8             	add    %r11,%rax
+  802034:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802038:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80203c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802040:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802044:	48 83 ec 08          	sub    $0x8,%rsp
+  802048:	6a 00                	push   $0x0
+  80204a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802050:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802056:	be 00 00 00 00       	mov    $0x0,%esi
+  80205b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802060:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  802067:	ff ff ff 
+  80206a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80206e:	ff d0                	call   *%rax
+  802070:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802074:	90                   	nop
+  802075:	c9                   	leave
+  802076:	c3                   	ret
+
+0000000000802077 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802077:	55                   	push   %rbp
+  802078:	48 89 e5             	mov    %rsp,%rbp
+  80207b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80207b <sys_cgetc+0x4>
+  802082:	49 bb c5 6f 00 00 00 	movabs $0x6fc5,%r11
+  802089:	00 00 00 
+  80208c:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80208f:	48 83 ec 08          	sub    $0x8,%rsp
+  802093:	6a 00                	push   $0x0
+  802095:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80209b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020b5:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  8020bc:	ff ff ff 
+  8020bf:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020c3:	ff d0                	call   *%rax
+  8020c5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020c9:	c9                   	leave
+  8020ca:	c3                   	ret
+
+00000000008020cb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8020cb:	55                   	push   %rbp
+  8020cc:	48 89 e5             	mov    %rsp,%rbp
+  8020cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8020d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020d3 <sys_env_destroy+0x8>
+  8020da:	49 bb 6d 6f 00 00 00 	movabs $0x6f6d,%r11
+  8020e1:	00 00 00 
+  8020e4:	4c 01 d8             	add    %r11,%rax
+  8020e7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8020ea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020ed:	48 63 d2             	movslq %edx,%rdx
+  8020f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8020f4:	6a 00                	push   $0x0
+  8020f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802102:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802107:	be 01 00 00 00       	mov    $0x1,%esi
+  80210c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802111:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  802118:	ff ff ff 
+  80211b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80211f:	ff d0                	call   *%rax
+  802121:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802125:	c9                   	leave
+  802126:	c3                   	ret
+
+0000000000802127 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802127:	55                   	push   %rbp
+  802128:	48 89 e5             	mov    %rsp,%rbp
+  80212b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80212b <sys_getenvid+0x4>
+  802132:	49 bb 15 6f 00 00 00 	movabs $0x6f15,%r11
+  802139:	00 00 00 
+  80213c:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80213f:	48 83 ec 08          	sub    $0x8,%rsp
+  802143:	6a 00                	push   $0x0
+  802145:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80214b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802151:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802156:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215b:	be 00 00 00 00       	mov    $0x0,%esi
+  802160:	bf 02 00 00 00       	mov    $0x2,%edi
+  802165:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  80216c:	ff ff ff 
+  80216f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802173:	ff d0                	call   *%rax
+  802175:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802179:	c9                   	leave
+  80217a:	c3                   	ret
+
+000000000080217b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80217b:	55                   	push   %rbp
+  80217c:	48 89 e5             	mov    %rsp,%rbp
+  80217f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80217f <sys_yield+0x4>
+  802186:	49 bb c1 6e 00 00 00 	movabs $0x6ec1,%r11
+  80218d:	00 00 00 
+  802190:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802193:	48 83 ec 08          	sub    $0x8,%rsp
+  802197:	6a 00                	push   $0x0
+  802199:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80219f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021af:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b4:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021b9:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  8021c0:	ff ff ff 
+  8021c3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021c7:	ff d0                	call   *%rax
+  8021c9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021cd:	90                   	nop
+  8021ce:	c9                   	leave
+  8021cf:	c3                   	ret
+
+00000000008021d0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8021d0:	55                   	push   %rbp
+  8021d1:	48 89 e5             	mov    %rsp,%rbp
+  8021d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021d8 <sys_page_alloc+0x8>
+  8021df:	49 bb 68 6e 00 00 00 	movabs $0x6e68,%r11
+  8021e6:	00 00 00 
+  8021e9:	4c 01 d8             	add    %r11,%rax
+  8021ec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8021f3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8021f6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8021f9:	48 63 f2             	movslq %edx,%rsi
+  8021fc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802200:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802203:	48 63 d2             	movslq %edx,%rdx
+  802206:	48 83 ec 08          	sub    $0x8,%rsp
+  80220a:	6a 00                	push   $0x0
+  80220c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802212:	49 89 f0             	mov    %rsi,%r8
+  802215:	be 01 00 00 00       	mov    $0x1,%esi
+  80221a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80221f:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  802226:	ff ff ff 
+  802229:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80222d:	ff d0                	call   *%rax
+  80222f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802233:	c9                   	leave
+  802234:	c3                   	ret
+
+0000000000802235 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802235:	55                   	push   %rbp
+  802236:	48 89 e5             	mov    %rsp,%rbp
+  802239:	48 83 ec 20          	sub    $0x20,%rsp
+  80223d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80223d <sys_page_map+0x8>
+  802244:	49 bb 03 6e 00 00 00 	movabs $0x6e03,%r11
+  80224b:	00 00 00 
+  80224e:	4c 01 d8             	add    %r11,%rax
+  802251:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802254:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802258:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80225b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80225f:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802263:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802266:	48 63 f2             	movslq %edx,%rsi
+  802269:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80226d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802270:	48 63 fa             	movslq %edx,%rdi
+  802273:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802277:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80227a:	48 63 d2             	movslq %edx,%rdx
+  80227d:	48 83 ec 08          	sub    $0x8,%rsp
+  802281:	56                   	push   %rsi
+  802282:	4d 89 c1             	mov    %r8,%r9
+  802285:	49 89 f8             	mov    %rdi,%r8
+  802288:	be 01 00 00 00       	mov    $0x1,%esi
+  80228d:	bf 05 00 00 00       	mov    $0x5,%edi
+  802292:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  802299:	ff ff ff 
+  80229c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022a0:	ff d0                	call   *%rax
+  8022a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022a6:	c9                   	leave
+  8022a7:	c3                   	ret
+
+00000000008022a8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8022a8:	55                   	push   %rbp
+  8022a9:	48 89 e5             	mov    %rsp,%rbp
+  8022ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022b0 <sys_page_unmap+0x8>
+  8022b7:	49 bb 90 6d 00 00 00 	movabs $0x6d90,%r11
+  8022be:	00 00 00 
+  8022c1:	4c 01 d8             	add    %r11,%rax
+  8022c4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8022cb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022cf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022d2:	48 63 d2             	movslq %edx,%rdx
+  8022d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8022d9:	6a 00                	push   $0x0
+  8022db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ec:	bf 06 00 00 00       	mov    $0x6,%edi
+  8022f1:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  8022f8:	ff ff ff 
+  8022fb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022ff:	ff d0                	call   *%rax
+  802301:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802305:	c9                   	leave
+  802306:	c3                   	ret
+
+0000000000802307 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802307:	55                   	push   %rbp
+  802308:	48 89 e5             	mov    %rsp,%rbp
+  80230b:	48 83 ec 10          	sub    $0x10,%rsp
+  80230f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80230f <sys_env_set_status+0x8>
+  802316:	49 bb 31 6d 00 00 00 	movabs $0x6d31,%r11
+  80231d:	00 00 00 
+  802320:	4c 01 d8             	add    %r11,%rax
+  802323:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802326:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802329:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80232c:	48 63 ca             	movslq %edx,%rcx
+  80232f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802332:	48 63 d2             	movslq %edx,%rdx
+  802335:	48 83 ec 08          	sub    $0x8,%rsp
+  802339:	6a 00                	push   $0x0
+  80233b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802341:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802347:	be 01 00 00 00       	mov    $0x1,%esi
+  80234c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802351:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  802358:	ff ff ff 
+  80235b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80235f:	ff d0                	call   *%rax
+  802361:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802365:	c9                   	leave
+  802366:	c3                   	ret
+
+0000000000802367 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802367:	55                   	push   %rbp
+  802368:	48 89 e5             	mov    %rsp,%rbp
+  80236b:	48 83 ec 10          	sub    $0x10,%rsp
+  80236f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80236f <sys_env_set_trapframe+0x8>
+  802376:	49 bb d1 6c 00 00 00 	movabs $0x6cd1,%r11
+  80237d:	00 00 00 
+  802380:	4c 01 d8             	add    %r11,%rax
+  802383:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802386:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80238a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80238e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802391:	48 63 d2             	movslq %edx,%rdx
+  802394:	48 83 ec 08          	sub    $0x8,%rsp
+  802398:	6a 00                	push   $0x0
+  80239a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ab:	bf 09 00 00 00       	mov    $0x9,%edi
+  8023b0:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  8023b7:	ff ff ff 
+  8023ba:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023be:	ff d0                	call   *%rax
+  8023c0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023c4:	c9                   	leave
+  8023c5:	c3                   	ret
+
+00000000008023c6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8023c6:	55                   	push   %rbp
+  8023c7:	48 89 e5             	mov    %rsp,%rbp
+  8023ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8023ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023ce <sys_env_set_pgfault_upcall+0x8>
+  8023d5:	49 bb 72 6c 00 00 00 	movabs $0x6c72,%r11
+  8023dc:	00 00 00 
+  8023df:	4c 01 d8             	add    %r11,%rax
+  8023e2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023e5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8023e9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023f0:	48 63 d2             	movslq %edx,%rdx
+  8023f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023f7:	6a 00                	push   $0x0
+  8023f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802405:	be 01 00 00 00       	mov    $0x1,%esi
+  80240a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80240f:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  802416:	ff ff ff 
+  802419:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80241d:	ff d0                	call   *%rax
+  80241f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802423:	c9                   	leave
+  802424:	c3                   	ret
+
+0000000000802425 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802425:	55                   	push   %rbp
+  802426:	48 89 e5             	mov    %rsp,%rbp
+  802429:	48 83 ec 20          	sub    $0x20,%rsp
+  80242d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80242d <sys_ipc_try_send+0x8>
+  802434:	49 bb 13 6c 00 00 00 	movabs $0x6c13,%r11
+  80243b:	00 00 00 
+  80243e:	4c 01 d8             	add    %r11,%rax
+  802441:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802444:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802448:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80244c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80244f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802452:	48 63 fa             	movslq %edx,%rdi
+  802455:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802459:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80245c:	48 63 d2             	movslq %edx,%rdx
+  80245f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802463:	48 83 ec 08          	sub    $0x8,%rsp
+  802467:	6a 00                	push   $0x0
+  802469:	49 89 f9             	mov    %rdi,%r9
+  80246c:	49 89 f0             	mov    %rsi,%r8
+  80246f:	be 00 00 00 00       	mov    $0x0,%esi
+  802474:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802479:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  802480:	ff ff ff 
+  802483:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802487:	ff d0                	call   *%rax
+  802489:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80248d:	c9                   	leave
+  80248e:	c3                   	ret
+
+000000000080248f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80248f:	55                   	push   %rbp
+  802490:	48 89 e5             	mov    %rsp,%rbp
+  802493:	48 83 ec 20          	sub    $0x20,%rsp
+  802497:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802497 <sys_ipc_send+0x8>
+  80249e:	49 bb a9 6b 00 00 00 	movabs $0x6ba9,%r11
+  8024a5:	00 00 00 
+  8024a8:	4c 01 d8             	add    %r11,%rax
+  8024ab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024b2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024b6:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8024b9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024bc:	48 63 fa             	movslq %edx,%rdi
+  8024bf:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024c6:	48 63 d2             	movslq %edx,%rdx
+  8024c9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d1:	6a 00                	push   $0x0
+  8024d3:	49 89 f9             	mov    %rdi,%r9
+  8024d6:	49 89 f0             	mov    %rsi,%r8
+  8024d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8024de:	bf 17 00 00 00       	mov    $0x17,%edi
+  8024e3:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  8024ea:	ff ff ff 
+  8024ed:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024f1:	ff d0                	call   *%rax
+  8024f3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024f7:	c9                   	leave
+  8024f8:	c3                   	ret
+
+00000000008024f9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8024f9:	55                   	push   %rbp
+  8024fa:	48 89 e5             	mov    %rsp,%rbp
+  8024fd:	48 83 ec 10          	sub    $0x10,%rsp
+  802501:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802501 <sys_ipc_recv+0x8>
+  802508:	49 bb 3f 6b 00 00 00 	movabs $0x6b3f,%r11
+  80250f:	00 00 00 
+  802512:	4c 01 d8             	add    %r11,%rax
+  802515:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802519:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80251d:	6a 00                	push   $0x0
+  80251f:	6a 00                	push   $0x0
+  802521:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802527:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80252d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802532:	be 01 00 00 00       	mov    $0x1,%esi
+  802537:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80253c:	49 ba 29 8e ff ff ff 	movabs $0xffffffffffff8e29,%r10
+  802543:	ff ff ff 
+  802546:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80254a:	ff d0                	call   *%rax
+  80254c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802550:	c9                   	leave
+  802551:	c3                   	ret
+
+0000000000802552 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802552:	55                   	push   %rbp
+  802553:	48 89 e5             	mov    %rsp,%rbp
+  802556:	48 83 ec 30          	sub    $0x30,%rsp
+  80255a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80255a <sys_ipc_call+0x8>
+  802561:	49 bb e6 6a 00 00 00 	movabs $0x6ae6,%r11
+  802568:	00 00 00 
+  80256b:	4c 01 d8             	add    %r11,%rax
+  80256e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802571:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802575:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802579:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80257c:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802580:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802584:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802588:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80258b:	4c 63 c2             	movslq %edx,%r8
+  80258e:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802592:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802595:	48 63 d2             	movslq %edx,%rdx
+  802598:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80259c:	ff 75 d8             	push   -0x28(%rbp)
+  80259f:	56                   	push   %rsi
+  8025a0:	4d 89 c1             	mov    %r8,%r9
+  8025a3:	49 89 f8             	mov    %rdi,%r8
+  8025a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ab:	bf 18 00 00 00       	mov    $0x18,%edi
+  8025b0:	49 ba 29 8e ff ff ff 	movabs $0xffffffffffff8e29,%r10
+  8025b7:	ff ff ff 
+  8025ba:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025be:	ff d0                	call   *%rax
+  8025c0:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8025c4:	c9                   	leave
+  8025c5:	c3                   	ret
+
+00000000008025c6 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8025c6:	55                   	push   %rbp
+  8025c7:	48 89 e5             	mov    %rsp,%rbp
+  8025ca:	48 83 ec 30          	sub    $0x30,%rsp
+  8025ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025ce <sys_ipc_reply_recv+0x8>
+  8025d5:	49 bb 72 6a 00 00 00 	movabs $0x6a72,%r11
+  8025dc:	00 00 00 
+  8025df:	4c 01 d8             	add    %r11,%rax
+  8025e2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025e5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025e9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025ed:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8025f0:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8025f4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8025f8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8025fc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025ff:	4c 63 c2             	movslq %edx,%r8
+  802602:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802606:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802609:	48 63 d2             	movslq %edx,%rdx
+  80260c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802610:	ff 75 d8             	push   -0x28(%rbp)
+  802613:	56                   	push   %rsi
+  802614:	4d 89 c1             	mov    %r8,%r9
+  802617:	49 89 f8             	mov    %rdi,%r8
+  80261a:	be 00 00 00 00       	mov    $0x0,%esi
+  80261f:	bf 19 00 00 00       	mov    $0x19,%edi
+  802624:	49 ba 29 8e ff ff ff 	movabs $0xffffffffffff8e29,%r10
+  80262b:	ff ff ff 
+  80262e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802632:	ff d0                	call   *%rax
+  802634:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802638:	c9                   	leave
+  802639:	c3                   	ret
+
+000000000080263a <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80263a:	55                   	push   %rbp
+  80263b:	48 89 e5             	mov    %rsp,%rbp
+  80263e:	48 83 ec 10          	sub    $0x10,%rsp
+  802642:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802642 <sys_env_set_priority+0x8>
+  802649:	49 bb fe 69 00 00 00 	movabs $0x69fe,%r11
+  802650:	00 00 00 
+  802653:	4c 01 d8             	add    %r11,%rax
+  802656:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802659:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80265c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80265f:	48 63 ca             	movslq %edx,%rcx
+  802662:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802665:	48 63 d2             	movslq %edx,%rdx
+  802668:	48 83 ec 08          	sub    $0x8,%rsp
+  80266c:	6a 00                	push   $0x0
+  80266e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802674:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80267a:	be 01 00 00 00       	mov    $0x1,%esi
+  80267f:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802684:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  80268b:	ff ff ff 
+  80268e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802692:	ff d0                	call   *%rax
+  802694:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802698:	c9                   	leave
+  802699:	c3                   	ret
+
+000000000080269a <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80269a:	55                   	push   %rbp
+  80269b:	48 89 e5             	mov    %rsp,%rbp
+  80269e:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026a2 <sys_env_set_affinity+0x8>
+  8026a9:	49 bb 9e 69 00 00 00 	movabs $0x699e,%r11
+  8026b0:	00 00 00 
+  8026b3:	4c 01 d8             	add    %r11,%rax
+  8026b6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026b9:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8026bc:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8026bf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026c2:	48 63 d2             	movslq %edx,%rdx
+  8026c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8026c9:	6a 00                	push   $0x0
+  8026cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8026dc:	bf 10 00 00 00       	mov    $0x10,%edi
+  8026e1:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  8026e8:	ff ff ff 
+  8026eb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026ef:	ff d0                	call   *%rax
+  8026f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f5:	c9                   	leave
+  8026f6:	c3                   	ret
+
+00000000008026f7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8026f7:	55                   	push   %rbp
+  8026f8:	48 89 e5             	mov    %rsp,%rbp
+  8026fb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026fb <sys_time_msec+0x4>
+  802702:	49 bb 45 69 00 00 00 	movabs $0x6945,%r11
+  802709:	00 00 00 
+  80270c:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80270f:	48 83 ec 08          	sub    $0x8,%rsp
+  802713:	6a 00                	push   $0x0
+  802715:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80271b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802721:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802726:	ba 00 00 00 00       	mov    $0x0,%edx
+  80272b:	be 00 00 00 00       	mov    $0x0,%esi
+  802730:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802735:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  80273c:	ff ff ff 
+  80273f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802743:	ff d0                	call   *%rax
+  802745:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802749:	c9                   	leave
+  80274a:	c3                   	ret
+
+000000000080274b <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80274b:	55                   	push   %rbp
+  80274c:	48 89 e5             	mov    %rsp,%rbp
+  80274f:	48 83 ec 10          	sub    $0x10,%rsp
+  802753:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802753 <sys_sleep_usec+0x8>
+  80275a:	49 bb ed 68 00 00 00 	movabs $0x68ed,%r11
+  802761:	00 00 00 
+  802764:	4c 01 d8             	add    %r11,%rax
+  802767:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80276b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80276f:	48 83 ec 08          	sub    $0x8,%rsp
+  802773:	6a 00                	push   $0x0
+  802775:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80277b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802781:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802786:	be 00 00 00 00       	mov    $0x0,%esi
+  80278b:	bf 11 00 00 00       	mov    $0x11,%edi
+  802790:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  802797:	ff ff ff 
+  80279a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80279e:	ff d0                	call   *%rax
+  8027a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027a4:	c9                   	leave
+  8027a5:	c3                   	ret
+
+00000000008027a6 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8027a6:	55                   	push   %rbp
+  8027a7:	48 89 e5             	mov    %rsp,%rbp
+  8027aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8027ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027ae <sys_page_alloc_huge+0x8>
+  8027b5:	49 bb 92 68 00 00 00 	movabs $0x6892,%r11
+  8027bc:	00 00 00 
+  8027bf:	4c 01 d8             	add    %r11,%rax
+  8027c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027c9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8027cc:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027cf:	48 63 f2             	movslq %edx,%rsi
+  8027d2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027d6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027d9:	48 63 d2             	movslq %edx,%rdx
+  8027dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e0:	6a 00                	push   $0x0
+  8027e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027e8:	49 89 f0             	mov    %rsi,%r8
+  8027eb:	be 01 00 00 00       	mov    $0x1,%esi
+  8027f0:	bf 12 00 00 00       	mov    $0x12,%edi
+  8027f5:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  8027fc:	ff ff ff 
+  8027ff:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802803:	ff d0                	call   *%rax
+  802805:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802809:	c9                   	leave
+  80280a:	c3                   	ret
+
+000000000080280b <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80280b:	55                   	push   %rbp
+  80280c:	48 89 e5             	mov    %rsp,%rbp
+  80280f:	48 83 ec 10          	sub    $0x10,%rsp
+  802813:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802813 <sys_page_map_batch+0x8>
+  80281a:	49 bb 2d 68 00 00 00 	movabs $0x682d,%r11
+  802821:	00 00 00 
+  802824:	4c 01 d8             	add    %r11,%rax
+  802827:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80282b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80282f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802833:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802837:	48 83 ec 08          	sub    $0x8,%rsp
+  80283b:	6a 00                	push   $0x0
+  80283d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802843:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802849:	be 01 00 00 00       	mov    $0x1,%esi
+  80284e:	bf 13 00 00 00       	mov    $0x13,%edi
+  802853:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  80285a:	ff ff ff 
+  80285d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802861:	ff d0                	call   *%rax
+  802863:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802867:	c9                   	leave
+  802868:	c3                   	ret
+
+0000000000802869 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802869:	55                   	push   %rbp
+  80286a:	48 89 e5             	mov    %rsp,%rbp
+  80286d:	48 83 ec 10          	sub    $0x10,%rsp
+  802871:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802871 <sys_page_alloc_batch+0x8>
+  802878:	49 bb cf 67 00 00 00 	movabs $0x67cf,%r11
+  80287f:	00 00 00 
+  802882:	4c 01 d8             	add    %r11,%rax
+  802885:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802889:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80288d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802891:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802895:	48 83 ec 08          	sub    $0x8,%rsp
+  802899:	6a 00                	push   $0x0
+  80289b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8028ac:	bf 14 00 00 00       	mov    $0x14,%edi
+  8028b1:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  8028b8:	ff ff ff 
+  8028bb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028bf:	ff d0                	call   *%rax
+  8028c1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028c5:	c9                   	leave
+  8028c6:	c3                   	ret
+
+00000000008028c7 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8028c7:	55                   	push   %rbp
+  8028c8:	48 89 e5             	mov    %rsp,%rbp
+  8028cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8028cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028cf <sys_page_unmap_batch+0x8>
+  8028d6:	49 bb 71 67 00 00 00 	movabs $0x6771,%r11
+  8028dd:	00 00 00 
+  8028e0:	4c 01 d8             	add    %r11,%rax
+  8028e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8028eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028ef:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f7:	6a 00                	push   $0x0
+  8028f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802905:	be 01 00 00 00       	mov    $0x1,%esi
+  80290a:	bf 15 00 00 00       	mov    $0x15,%edi
+  80290f:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  802916:	ff ff ff 
+  802919:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80291d:	ff d0                	call   *%rax
+  80291f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+
+0000000000802925 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802925:	55                   	push   %rbp
+  802926:	48 89 e5             	mov    %rsp,%rbp
+  802929:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802929 <sys_fork+0x4>
+  802930:	49 bb 17 67 00 00 00 	movabs $0x6717,%r11
+  802937:	00 00 00 
+  80293a:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  80293d:	48 83 ec 08          	sub    $0x8,%rsp
+  802941:	6a 00                	push   $0x0
+  802943:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802949:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80294f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802954:	ba 00 00 00 00       	mov    $0x0,%edx
+  802959:	be 00 00 00 00       	mov    $0x0,%esi
+  80295e:	bf 16 00 00 00       	mov    $0x16,%edi
+  802963:	49 ba 6f 8d ff ff ff 	movabs $0xffffffffffff8d6f,%r10
+  80296a:	ff ff ff 
+  80296d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802971:	ff d0                	call   *%rax
+  802973:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802977:	c9                   	leave
+  802978:	c3                   	ret
+
+0000000000802979 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802979:	55                   	push   %rbp
+  80297a:	48 89 e5             	mov    %rsp,%rbp
+  80297d:	41 57                	push   %r15
+  80297f:	53                   	push   %rbx
+  802980:	48 83 ec 40          	sub    $0x40,%rsp
+  802984:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802984 <pgfault+0xb>
+  80298b:	49 bb bc 66 00 00 00 	movabs $0x66bc,%r11
+  802992:	00 00 00 
+  802995:	4c 01 db             	add    %r11,%rbx
+  802998:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  80299c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029a0:	48 8b 00             	mov    (%rax),%rax
+  8029a3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  8029a7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029ab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029af:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  8029b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029b6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8029ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029be:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029c4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  8029c8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8029cb:	83 e0 02             	and    $0x2,%eax
+  8029ce:	85 c0                	test   %eax,%eax
+  8029d0:	0f 84 91 03 00 00    	je     802d67 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8029d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029da:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029de:	48 89 c2             	mov    %rax,%rdx
+  8029e1:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8029e8:	ff ff ff 
+  8029eb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8029ef:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8029f3:	83 e0 01             	and    $0x1,%eax
+  8029f6:	48 85 c0             	test   %rax,%rax
+  8029f9:	0f 84 a7 01 00 00    	je     802ba6 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  8029ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a03:	48 c1 e8 15          	shr    $0x15,%rax
+  802a07:	48 89 c2             	mov    %rax,%rdx
+  802a0a:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802a11:	ff ff ff 
+  802a14:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a18:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a1c:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802a21:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802a27:	0f 85 79 01 00 00    	jne    802ba6 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802a2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a31:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802a35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a39:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802a3f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802a43:	ba 07 00 00 00       	mov    $0x7,%edx
+  802a48:	be 00 00 60 00       	mov    $0x600000,%esi
+  802a4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a52:	49 89 df             	mov    %rbx,%r15
+  802a55:	48 b8 66 97 ff ff ff 	movabs $0xffffffffffff9766,%rax
+  802a5c:	ff ff ff 
+  802a5f:	48 01 d8             	add    %rbx,%rax
+  802a62:	ff d0                	call   *%rax
+  802a64:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802a67:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802a6b:	79 44                	jns    802ab1 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802a6d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802a70:	89 c1                	mov    %eax,%ecx
+  802a72:	48 b8 18 e3 ff ff ff 	movabs $0xffffffffffffe318,%rax
+  802a79:	ff ff ff 
+  802a7c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a80:	48 89 c2             	mov    %rax,%rdx
+  802a83:	be 20 00 00 00       	mov    $0x20,%esi
+  802a88:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  802a8f:	ff ff ff 
+  802a92:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a96:	48 89 c7             	mov    %rax,%rdi
+  802a99:	49 89 df             	mov    %rbx,%r15
+  802a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa1:	49 b8 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%r8
+  802aa8:	ff ff ff 
+  802aab:	49 01 d8             	add    %rbx,%r8
+  802aae:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802ab1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ab5:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802aba:	48 89 c6             	mov    %rax,%rsi
+  802abd:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802ac2:	49 89 df             	mov    %rbx,%r15
+  802ac5:	48 b8 df 89 ff ff ff 	movabs $0xffffffffffff89df,%rax
+  802acc:	ff ff ff 
+  802acf:	48 01 d8             	add    %rbx,%rax
+  802ad2:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802ad4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ad8:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802ade:	48 89 c1             	mov    %rax,%rcx
+  802ae1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae6:	be 00 00 60 00       	mov    $0x600000,%esi
+  802aeb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802af0:	49 89 df             	mov    %rbx,%r15
+  802af3:	48 b8 f5 91 ff ff ff 	movabs $0xffffffffffff91f5,%rax
+  802afa:	ff ff ff 
+  802afd:	48 01 d8             	add    %rbx,%rax
+  802b00:	ff d0                	call   *%rax
+  802b02:	85 c0                	test   %eax,%eax
+  802b04:	74 3e                	je     802b44 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802b06:	48 b8 43 e3 ff ff ff 	movabs $0xffffffffffffe343,%rax
+  802b0d:	ff ff ff 
+  802b10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b14:	48 89 c2             	mov    %rax,%rdx
+  802b17:	be 23 00 00 00       	mov    $0x23,%esi
+  802b1c:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  802b23:	ff ff ff 
+  802b26:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b2a:	48 89 c7             	mov    %rax,%rdi
+  802b2d:	49 89 df             	mov    %rbx,%r15
+  802b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b35:	48 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%rcx
+  802b3c:	ff ff ff 
+  802b3f:	48 01 d9             	add    %rbx,%rcx
+  802b42:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802b44:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b49:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b4e:	49 89 df             	mov    %rbx,%r15
+  802b51:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  802b58:	ff ff ff 
+  802b5b:	48 01 d8             	add    %rbx,%rax
+  802b5e:	ff d0                	call   *%rax
+  802b60:	85 c0                	test   %eax,%eax
+  802b62:	0f 84 3d 02 00 00    	je     802da5 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802b68:	48 b8 58 e3 ff ff ff 	movabs $0xffffffffffffe358,%rax
+  802b6f:	ff ff ff 
+  802b72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b76:	48 89 c2             	mov    %rax,%rdx
+  802b79:	be 25 00 00 00       	mov    $0x25,%esi
+  802b7e:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  802b85:	ff ff ff 
+  802b88:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b8c:	48 89 c7             	mov    %rax,%rdi
+  802b8f:	49 89 df             	mov    %rbx,%r15
+  802b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b97:	48 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%rcx
+  802b9e:	ff ff ff 
+  802ba1:	48 01 d9             	add    %rbx,%rcx
+  802ba4:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802ba6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802baa:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bae:	48 89 c2             	mov    %rax,%rdx
+  802bb1:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802bb8:	ff ff ff 
+  802bbb:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bbf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bc3:	25 00 08 00 00       	and    $0x800,%eax
+  802bc8:	48 85 c0             	test   %rax,%rax
+  802bcb:	0f 84 58 01 00 00    	je     802d29 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802bd1:	ba 07 00 00 00       	mov    $0x7,%edx
+  802bd6:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802bdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be0:	49 89 df             	mov    %rbx,%r15
+  802be3:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  802bea:	ff ff ff 
+  802bed:	48 01 d8             	add    %rbx,%rax
+  802bf0:	ff d0                	call   *%rax
+  802bf2:	85 c0                	test   %eax,%eax
+  802bf4:	74 3e                	je     802c34 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802bf6:	48 b8 6f e3 ff ff ff 	movabs $0xffffffffffffe36f,%rax
+  802bfd:	ff ff ff 
+  802c00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c04:	48 89 c2             	mov    %rax,%rdx
+  802c07:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802c0c:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  802c13:	ff ff ff 
+  802c16:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c1a:	48 89 c7             	mov    %rax,%rdi
+  802c1d:	49 89 df             	mov    %rbx,%r15
+  802c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c25:	48 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%rcx
+  802c2c:	ff ff ff 
+  802c2f:	48 01 d9             	add    %rbx,%rcx
+  802c32:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802c34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c38:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c3d:	48 89 c6             	mov    %rax,%rsi
+  802c40:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802c45:	49 89 df             	mov    %rbx,%r15
+  802c48:	48 b8 df 89 ff ff ff 	movabs $0xffffffffffff89df,%rax
+  802c4f:	ff ff ff 
+  802c52:	48 01 d8             	add    %rbx,%rax
+  802c55:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802c57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c5b:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c61:	48 89 c1             	mov    %rax,%rcx
+  802c64:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c69:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802c6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c73:	49 89 df             	mov    %rbx,%r15
+  802c76:	48 b8 f5 91 ff ff ff 	movabs $0xffffffffffff91f5,%rax
+  802c7d:	ff ff ff 
+  802c80:	48 01 d8             	add    %rbx,%rax
+  802c83:	ff d0                	call   *%rax
+  802c85:	85 c0                	test   %eax,%eax
+  802c87:	74 3e                	je     802cc7 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802c89:	48 b8 43 e3 ff ff ff 	movabs $0xffffffffffffe343,%rax
+  802c90:	ff ff ff 
+  802c93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c97:	48 89 c2             	mov    %rax,%rdx
+  802c9a:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802c9f:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  802ca6:	ff ff ff 
+  802ca9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cad:	48 89 c7             	mov    %rax,%rdi
+  802cb0:	49 89 df             	mov    %rbx,%r15
+  802cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb8:	48 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%rcx
+  802cbf:	ff ff ff 
+  802cc2:	48 01 d9             	add    %rbx,%rcx
+  802cc5:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802cc7:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802ccc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd1:	49 89 df             	mov    %rbx,%r15
+  802cd4:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  802cdb:	ff ff ff 
+  802cde:	48 01 d8             	add    %rbx,%rax
+  802ce1:	ff d0                	call   *%rax
+  802ce3:	85 c0                	test   %eax,%eax
+  802ce5:	0f 84 bb 00 00 00    	je     802da6 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802ceb:	48 b8 58 e3 ff ff ff 	movabs $0xffffffffffffe358,%rax
+  802cf2:	ff ff ff 
+  802cf5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cf9:	48 89 c2             	mov    %rax,%rdx
+  802cfc:	be 32 00 00 00       	mov    $0x32,%esi
+  802d01:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  802d08:	ff ff ff 
+  802d0b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d0f:	48 89 c7             	mov    %rax,%rdi
+  802d12:	49 89 df             	mov    %rbx,%r15
+  802d15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1a:	48 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%rcx
+  802d21:	ff ff ff 
+  802d24:	48 01 d9             	add    %rbx,%rcx
+  802d27:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802d29:	48 b8 88 e3 ff ff ff 	movabs $0xffffffffffffe388,%rax
+  802d30:	ff ff ff 
+  802d33:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d37:	48 89 c2             	mov    %rax,%rdx
+  802d3a:	be 36 00 00 00       	mov    $0x36,%esi
+  802d3f:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  802d46:	ff ff ff 
+  802d49:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d4d:	48 89 c7             	mov    %rax,%rdi
+  802d50:	49 89 df             	mov    %rbx,%r15
+  802d53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d58:	48 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%rcx
+  802d5f:	ff ff ff 
+  802d62:	48 01 d9             	add    %rbx,%rcx
+  802d65:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802d67:	48 b8 a7 e3 ff ff ff 	movabs $0xffffffffffffe3a7,%rax
+  802d6e:	ff ff ff 
+  802d71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d75:	48 89 c2             	mov    %rax,%rdx
+  802d78:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802d7d:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  802d84:	ff ff ff 
+  802d87:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d8b:	48 89 c7             	mov    %rax,%rdi
+  802d8e:	49 89 df             	mov    %rbx,%r15
+  802d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d96:	48 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%rcx
+  802d9d:	ff ff ff 
+  802da0:	48 01 d9             	add    %rbx,%rcx
+  802da3:	ff d1                	call   *%rcx
+			return;
+  802da5:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802da6:	48 83 c4 40          	add    $0x40,%rsp
+  802daa:	5b                   	pop    %rbx
+  802dab:	41 5f                	pop    %r15
+  802dad:	5d                   	pop    %rbp
+  802dae:	c3                   	ret
+
+0000000000802daf <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802daf:	55                   	push   %rbp
+  802db0:	48 89 e5             	mov    %rsp,%rbp
+  802db3:	41 57                	push   %r15
+  802db5:	53                   	push   %rbx
+  802db6:	48 83 ec 10          	sub    $0x10,%rsp
+  802dba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dba <fork_flush+0xb>
+  802dc1:	49 bb 86 62 00 00 00 	movabs $0x6286,%r11
+  802dc8:	00 00 00 
+  802dcb:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802dce:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802dd5:	00 00 00 
+  802dd8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ddc:	48 85 c0             	test   %rax,%rax
+  802ddf:	0f 84 81 00 00 00    	je     802e66 <fork_flush+0xb7>
+  802de5:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802dec:	00 00 00 
+  802def:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802df3:	48 89 c6             	mov    %rax,%rsi
+  802df6:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802dfd:	00 00 00 
+  802e00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e04:	48 89 c7             	mov    %rax,%rdi
+  802e07:	49 89 df             	mov    %rbx,%r15
+  802e0a:	48 b8 cb 97 ff ff ff 	movabs $0xffffffffffff97cb,%rax
+  802e11:	ff ff ff 
+  802e14:	48 01 d8             	add    %rbx,%rax
+  802e17:	ff d0                	call   *%rax
+  802e19:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e1c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e20:	79 44                	jns    802e66 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802e22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e25:	89 c1                	mov    %eax,%ecx
+  802e27:	48 b8 c0 e3 ff ff ff 	movabs $0xffffffffffffe3c0,%rax
+  802e2e:	ff ff ff 
+  802e31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e35:	48 89 c2             	mov    %rax,%rdx
+  802e38:	be 56 00 00 00       	mov    $0x56,%esi
+  802e3d:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  802e44:	ff ff ff 
+  802e47:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e4b:	48 89 c7             	mov    %rax,%rdi
+  802e4e:	49 89 df             	mov    %rbx,%r15
+  802e51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e56:	49 b8 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%r8
+  802e5d:	ff ff ff 
+  802e60:	49 01 d8             	add    %rbx,%r8
+  802e63:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802e66:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802e6d:	00 00 00 
+  802e70:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802e77:	00 
+}
+  802e78:	90                   	nop
+  802e79:	48 83 c4 10          	add    $0x10,%rsp
+  802e7d:	5b                   	pop    %rbx
+  802e7e:	41 5f                	pop    %r15
+  802e80:	5d                   	pop    %rbp
+  802e81:	c3                   	ret
+
+0000000000802e82 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802e82:	55                   	push   %rbp
+  802e83:	48 89 e5             	mov    %rsp,%rbp
+  802e86:	53                   	push   %rbx
+  802e87:	48 83 ec 28          	sub    $0x28,%rsp
+  802e8b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e8b <fork_map+0x9>
+  802e92:	49 bb b5 61 00 00 00 	movabs $0x61b5,%r11
+  802e99:	00 00 00 
+  802e9c:	4c 01 db             	add    %r11,%rbx
+  802e9f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ea2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ea6:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802ea9:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802eb0:	00 00 00 
+  802eb3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802eb7:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802ebd:	75 10                	jne    802ecf <fork_map+0x4d>
+		fork_flush();
+  802ebf:	48 b8 6f 9d ff ff ff 	movabs $0xffffffffffff9d6f,%rax
+  802ec6:	ff ff ff 
+  802ec9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ecd:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802ecf:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ed6:	00 00 00 
+  802ed9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802edd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802ee1:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802ee8:	00 00 00 
+  802eeb:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802eef:	48 c1 e0 05          	shl    $0x5,%rax
+  802ef3:	48 89 c2             	mov    %rax,%rdx
+  802ef6:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802efd:	00 00 00 
+  802f00:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f04:	48 01 d0             	add    %rdx,%rax
+  802f07:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802f0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f0f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802f15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f19:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f1d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802f21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f25:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f28:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802f2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f2f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f33:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802f37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f3b:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802f3e:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802f41:	90                   	nop
+  802f42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f46:	c9                   	leave
+  802f47:	c3                   	ret
+
+0000000000802f48 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802f48:	55                   	push   %rbp
+  802f49:	48 89 e5             	mov    %rsp,%rbp
+  802f4c:	53                   	push   %rbx
+  802f4d:	48 83 ec 28          	sub    $0x28,%rsp
+  802f51:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f51 <duppage+0x9>
+  802f58:	49 bb ef 60 00 00 00 	movabs $0x60ef,%r11
+  802f5f:	00 00 00 
+  802f62:	4c 01 db             	add    %r11,%rbx
+  802f65:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f68:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802f6b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802f6e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802f76:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802f7d:	ff ff ff 
+  802f80:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f84:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802f87:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f8b:	25 00 04 00 00       	and    $0x400,%eax
+  802f90:	48 85 c0             	test   %rax,%rax
+  802f93:	74 42                	je     802fd7 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802f95:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802f9c:	ff ff ff 
+  802f9f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fa3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fa6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802faa:	25 07 0e 00 00       	and    $0xe07,%eax
+  802faf:	89 c2                	mov    %eax,%edx
+  802fb1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802fb5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fb8:	48 89 ce             	mov    %rcx,%rsi
+  802fbb:	89 c7                	mov    %eax,%edi
+  802fbd:	48 b8 42 9e ff ff ff 	movabs $0xffffffffffff9e42,%rax
+  802fc4:	ff ff ff 
+  802fc7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fcb:	ff d0                	call   *%rax
+		return 0;
+  802fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd2:	e9 ae 00 00 00       	jmp    803085 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802fd7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802fde:	ff ff ff 
+  802fe1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fe5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fe8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fec:	83 e0 02             	and    $0x2,%eax
+  802fef:	48 85 c0             	test   %rax,%rax
+  802ff2:	75 1f                	jne    803013 <duppage+0xcb>
+  802ff4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ffb:	ff ff ff 
+  802ffe:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803002:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803005:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803009:	25 00 08 00 00       	and    $0x800,%eax
+  80300e:	48 85 c0             	test   %rax,%rax
+  803011:	74 4c                	je     80305f <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  803013:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  80301a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80301d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803021:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803024:	48 89 ce             	mov    %rcx,%rsi
+  803027:	89 c7                	mov    %eax,%edi
+  803029:	48 b8 42 9e ff ff ff 	movabs $0xffffffffffff9e42,%rax
+  803030:	ff ff ff 
+  803033:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803037:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  803039:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80303c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803040:	48 89 c6             	mov    %rax,%rsi
+  803043:	bf 00 00 00 00       	mov    $0x0,%edi
+  803048:	48 b8 42 9e ff ff ff 	movabs $0xffffffffffff9e42,%rax
+  80304f:	ff ff ff 
+  803052:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803056:	ff d0                	call   *%rax
+		return 0;
+  803058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305d:	eb 26                	jmp    803085 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  80305f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803063:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803066:	ba 05 00 00 00       	mov    $0x5,%edx
+  80306b:	48 89 ce             	mov    %rcx,%rsi
+  80306e:	89 c7                	mov    %eax,%edi
+  803070:	48 b8 42 9e ff ff ff 	movabs $0xffffffffffff9e42,%rax
+  803077:	ff ff ff 
+  80307a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80307e:	ff d0                	call   *%rax
+		return 0;
+  803080:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803085:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803089:	c9                   	leave
+  80308a:	c3                   	ret
+
+000000000080308b <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  80308b:	55                   	push   %rbp
+  80308c:	48 89 e5             	mov    %rsp,%rbp
+  80308f:	53                   	push   %rbx
+  803090:	48 83 ec 28          	sub    $0x28,%rsp
+  803094:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803094 <duphuge+0x9>
+  80309b:	49 bb ac 5f 00 00 00 	movabs $0x5fac,%r11
+  8030a2:	00 00 00 
+  8030a5:	4c 01 db             	add    %r11,%rbx
+  8030a8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030ab:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  8030af:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030b3:	48 c1 e8 15          	shr    $0x15,%rax
+  8030b7:	48 89 c2             	mov    %rax,%rdx
+  8030ba:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8030c1:	ff ff ff 
+  8030c4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030c8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030cc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8030d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030d4:	25 00 04 00 00       	and    $0x400,%eax
+  8030d9:	48 85 c0             	test   %rax,%rax
+  8030dc:	74 0e                	je     8030ec <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8030de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030e2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8030ea:	eb 1e                	jmp    80310a <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  8030ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030f0:	25 02 08 00 00       	and    $0x802,%eax
+  8030f5:	48 85 c0             	test   %rax,%rax
+  8030f8:	74 09                	je     803103 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  8030fa:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  803101:	eb 07                	jmp    80310a <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  803103:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  80310a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80310d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803111:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803114:	48 89 ce             	mov    %rcx,%rsi
+  803117:	89 c7                	mov    %eax,%edi
+  803119:	48 b8 42 9e ff ff ff 	movabs $0xffffffffffff9e42,%rax
+  803120:	ff ff ff 
+  803123:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803127:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  803129:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80312c:	25 00 08 00 00       	and    $0x800,%eax
+  803131:	85 c0                	test   %eax,%eax
+  803133:	74 1f                	je     803154 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  803135:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803138:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80313c:	48 89 c6             	mov    %rax,%rsi
+  80313f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803144:	48 b8 42 9e ff ff ff 	movabs $0xffffffffffff9e42,%rax
+  80314b:	ff ff ff 
+  80314e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803152:	ff d0                	call   *%rax
+	return 0;
+  803154:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803159:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80315d:	c9                   	leave
+  80315e:	c3                   	ret
+
+000000000080315f <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  80315f:	55                   	push   %rbp
+  803160:	48 89 e5             	mov    %rsp,%rbp
+  803163:	41 57                	push   %r15
+  803165:	53                   	push   %rbx
+  803166:	48 83 ec 10          	sub    $0x10,%rsp
+  80316a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80316a <fork+0xb>
+  803171:	49 bb d6 5e 00 00 00 	movabs $0x5ed6,%r11
+  803178:	00 00 00 
+  80317b:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  80317e:	49 89 df             	mov    %rbx,%r15
+  803181:	48 b8 e5 98 ff ff ff 	movabs $0xffffffffffff98e5,%rax
+  803188:	ff ff ff 
+  80318b:	48 01 d8             	add    %rbx,%rax
+  80318e:	ff d0                	call   *%rax
+  803190:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803193:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803197:	75 42                	jne    8031db <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803199:	49 89 df             	mov    %rbx,%r15
+  80319c:	48 b8 e7 90 ff ff ff 	movabs $0xffffffffffff90e7,%rax
+  8031a3:	ff ff ff 
+  8031a6:	48 01 d8             	add    %rbx,%rax
+  8031a9:	ff d0                	call   *%rax
+  8031ab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031b0:	48 98                	cltq
+  8031b2:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8031b9:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8031c0:	ff ff ff 
+  8031c3:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8031c7:	48 01 c2             	add    %rax,%rdx
+  8031ca:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8031d1:	ff ff ff 
+  8031d4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031d8:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8031db:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8031de:	48 83 c4 10          	add    $0x10,%rsp
+  8031e2:	5b                   	pop    %rbx
+  8031e3:	41 5f                	pop    %r15
+  8031e5:	5d                   	pop    %rbp
+  8031e6:	c3                   	ret
+
+00000000008031e7 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8031e7:	55                   	push   %rbp
+  8031e8:	48 89 e5             	mov    %rsp,%rbp
+  8031eb:	41 57                	push   %r15
+  8031ed:	53                   	push   %rbx
+  8031ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8031f2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8031f2 <ufork+0xb>
+  8031f9:	49 bb 4e 5e 00 00 00 	movabs $0x5e4e,%r11
+  803200:	00 00 00 
+  803203:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  803206:	48 b8 39 99 ff ff ff 	movabs $0xffffffffffff9939,%rax
+  80320d:	ff ff ff 
+  803210:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803214:	48 89 c7             	mov    %rax,%rdi
+  803217:	49 89 df             	mov    %rbx,%r15
+  80321a:	48 b8 ce d3 ff ff ff 	movabs $0xffffffffffffd3ce,%rax
+  803221:	ff ff ff 
+  803224:	48 01 d8             	add    %rbx,%rax
+  803227:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  803229:	b8 07 00 00 00       	mov    $0x7,%eax
+  80322e:	cd 30                	int    $0x30
+  803230:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  803233:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  803236:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  803239:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80323d:	0f 84 03 02 00 00    	je     803446 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  803243:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80324a:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  80324b:	e9 28 01 00 00       	jmp    803378 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  803250:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803254:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803258:	48 89 c2             	mov    %rax,%rdx
+  80325b:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803262:	ff ff ff 
+  803265:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803269:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80326d:	83 e0 01             	and    $0x1,%eax
+  803270:	48 85 c0             	test   %rax,%rax
+  803273:	0f 84 f7 00 00 00    	je     803370 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803279:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80327d:	48 c1 e8 15          	shr    $0x15,%rax
+  803281:	48 89 c2             	mov    %rax,%rdx
+  803284:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80328b:	ff ff ff 
+  80328e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803292:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803296:	25 81 00 00 00       	and    $0x81,%eax
+  80329b:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  8032a1:	75 29                	jne    8032cc <ufork+0xe5>
+					duphuge(child_envid, addr);
+  8032a3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8032a7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032aa:	48 89 d6             	mov    %rdx,%rsi
+  8032ad:	89 c7                	mov    %eax,%edi
+  8032af:	48 b8 4b a0 ff ff ff 	movabs $0xffffffffffffa04b,%rax
+  8032b6:	ff ff ff 
+  8032b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032bd:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  8032bf:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8032c6:	00 
+  8032c7:	e9 ac 00 00 00       	jmp    803378 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8032cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032d0:	48 c1 e8 15          	shr    $0x15,%rax
+  8032d4:	48 89 c2             	mov    %rax,%rdx
+  8032d7:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8032de:	ff ff ff 
+  8032e1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032e5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032e9:	83 e0 01             	and    $0x1,%eax
+  8032ec:	48 85 c0             	test   %rax,%rax
+  8032ef:	74 75                	je     803366 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  8032f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032f5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8032f9:	48 89 c2             	mov    %rax,%rdx
+  8032fc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803303:	ff ff ff 
+  803306:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80330a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80330e:	83 e0 01             	and    $0x1,%eax
+  803311:	48 85 c0             	test   %rax,%rax
+  803314:	74 46                	je     80335c <ufork+0x175>
+  803316:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80331a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80331e:	48 89 c2             	mov    %rax,%rdx
+  803321:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803328:	ff ff ff 
+  80332b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80332f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803333:	83 e0 04             	and    $0x4,%eax
+  803336:	48 85 c0             	test   %rax,%rax
+  803339:	74 21                	je     80335c <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  80333b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80333f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803343:	89 c2                	mov    %eax,%edx
+  803345:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803348:	89 d6                	mov    %edx,%esi
+  80334a:	89 c7                	mov    %eax,%edi
+  80334c:	48 b8 08 9f ff ff ff 	movabs $0xffffffffffff9f08,%rax
+  803353:	ff ff ff 
+  803356:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80335a:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  80335c:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803363:	00 
+  803364:	eb 12                	jmp    803378 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803366:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80336d:	00 
+  80336e:	eb 08                	jmp    803378 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  803370:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803377:	40 
+		for (; addr < USTACKTOP;){
+  803378:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80337d:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  803381:	0f 83 c9 fe ff ff    	jae    803250 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803387:	48 b8 6f 9d ff ff ff 	movabs $0xffffffffffff9d6f,%rax
+  80338e:	ff ff ff 
+  803391:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803395:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803397:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80339a:	ba 07 00 00 00       	mov    $0x7,%edx
+  80339f:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8033a4:	48 89 ce             	mov    %rcx,%rsi
+  8033a7:	89 c7                	mov    %eax,%edi
+  8033a9:	49 89 df             	mov    %rbx,%r15
+  8033ac:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  8033b3:	ff ff ff 
+  8033b6:	48 01 d8             	add    %rbx,%rax
+  8033b9:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8033bb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033be:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8033c5:	ff ff ff 
+  8033c8:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8033cc:	48 89 d6             	mov    %rdx,%rsi
+  8033cf:	89 c7                	mov    %eax,%edi
+  8033d1:	49 89 df             	mov    %rbx,%r15
+  8033d4:	48 b8 86 93 ff ff ff 	movabs $0xffffffffffff9386,%rax
+  8033db:	ff ff ff 
+  8033de:	48 01 d8             	add    %rbx,%rax
+  8033e1:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8033e3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033e6:	be 02 00 00 00       	mov    $0x2,%esi
+  8033eb:	89 c7                	mov    %eax,%edi
+  8033ed:	49 89 df             	mov    %rbx,%r15
+  8033f0:	48 b8 c7 92 ff ff ff 	movabs $0xffffffffffff92c7,%rax
+  8033f7:	ff ff ff 
+  8033fa:	48 01 d8             	add    %rbx,%rax
+  8033fd:	ff d0                	call   *%rax
+  8033ff:	85 c0                	test   %eax,%eax
+  803401:	74 3e                	je     803441 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803403:	48 b8 e7 e3 ff ff ff 	movabs $0xffffffffffffe3e7,%rax
+  80340a:	ff ff ff 
+  80340d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803411:	48 89 c2             	mov    %rax,%rdx
+  803414:	be 07 01 00 00       	mov    $0x107,%esi
+  803419:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  803420:	ff ff ff 
+  803423:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803427:	48 89 c7             	mov    %rax,%rdi
+  80342a:	49 89 df             	mov    %rbx,%r15
+  80342d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803432:	48 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%rcx
+  803439:	ff ff ff 
+  80343c:	48 01 d9             	add    %rbx,%rcx
+  80343f:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803441:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803444:	eb 59                	jmp    80349f <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803446:	49 89 df             	mov    %rbx,%r15
+  803449:	48 b8 e7 90 ff ff ff 	movabs $0xffffffffffff90e7,%rax
+  803450:	ff ff ff 
+  803453:	48 01 d8             	add    %rbx,%rax
+  803456:	ff d0                	call   *%rax
+  803458:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80345d:	48 98                	cltq
+  80345f:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803466:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80346d:	ff ff ff 
+  803470:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803474:	48 01 c2             	add    %rax,%rdx
+  803477:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80347e:	ff ff ff 
+  803481:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803485:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803488:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80348f:	00 00 00 
+  803492:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803499:	00 
+		return 0;
+  80349a:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  80349f:	48 83 c4 10          	add    $0x10,%rsp
+  8034a3:	5b                   	pop    %rbx
+  8034a4:	41 5f                	pop    %r15
+  8034a6:	5d                   	pop    %rbp
+  8034a7:	c3                   	ret
+
+00000000008034a8 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8034a8:	55                   	push   %rbp
+  8034a9:	48 89 e5             	mov    %rsp,%rbp
+  8034ac:	41 57                	push   %r15
+  8034ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8034b2:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8034b2 <sfork+0xa>
+  8034b9:	49 bb 8e 5b 00 00 00 	movabs $0x5b8e,%r11
+  8034c0:	00 00 00 
+  8034c3:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8034c6:	48 b8 02 e4 ff ff ff 	movabs $0xffffffffffffe402,%rax
+  8034cd:	ff ff ff 
+  8034d0:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8034d4:	48 89 c2             	mov    %rax,%rdx
+  8034d7:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8034dc:	48 b8 38 e3 ff ff ff 	movabs $0xffffffffffffe338,%rax
+  8034e3:	ff ff ff 
+  8034e6:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8034ea:	48 89 c7             	mov    %rax,%rdi
+  8034ed:	49 89 cf             	mov    %rcx,%r15
+  8034f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f5:	49 b8 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%r8
+  8034fc:	ff ff ff 
+  8034ff:	49 01 c8             	add    %rcx,%r8
+  803502:	41 ff d0             	call   *%r8
+
+0000000000803505 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803505:	55                   	push   %rbp
+  803506:	48 89 e5             	mov    %rsp,%rbp
+  803509:	48 83 ec 08          	sub    $0x8,%rsp
+  80350d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80350d <fd2num+0x8>
+  803514:	49 bb 33 5b 00 00 00 	movabs $0x5b33,%r11
+  80351b:	00 00 00 
+  80351e:	4c 01 d8             	add    %r11,%rax
+  803521:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803525:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803529:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803530:	ff ff ff 
+  803533:	48 01 d0             	add    %rdx,%rax
+  803536:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80353a:	c9                   	leave
+  80353b:	c3                   	ret
+
+000000000080353c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80353c:	55                   	push   %rbp
+  80353d:	48 89 e5             	mov    %rsp,%rbp
+  803540:	48 83 ec 08          	sub    $0x8,%rsp
+  803544:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803544 <fd2data+0x8>
+  80354b:	49 bb fc 5a 00 00 00 	movabs $0x5afc,%r11
+  803552:	00 00 00 
+  803555:	4c 01 d8             	add    %r11,%rax
+  803558:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80355c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803560:	48 89 d7             	mov    %rdx,%rdi
+  803563:	48 ba c5 a4 ff ff ff 	movabs $0xffffffffffffa4c5,%rdx
+  80356a:	ff ff ff 
+  80356d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803571:	ff d0                	call   *%rax
+  803573:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803579:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80357d:	c9                   	leave
+  80357e:	c3                   	ret
+
+000000000080357f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	48 83 ec 18          	sub    $0x18,%rsp
+  803587:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803587 <fd_alloc+0x8>
+  80358e:	49 bb b9 5a 00 00 00 	movabs $0x5ab9,%r11
+  803595:	00 00 00 
+  803598:	4c 01 d8             	add    %r11,%rax
+  80359b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80359f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035a6:	eb 75                	jmp    80361d <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8035a8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8035ab:	48 63 d2             	movslq %edx,%rdx
+  8035ae:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8035b5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8035b9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8035bd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8035c1:	48 89 d1             	mov    %rdx,%rcx
+  8035c4:	48 c1 e9 15          	shr    $0x15,%rcx
+  8035c8:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8035cf:	ff ff ff 
+  8035d2:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8035d6:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8035da:	83 e2 01             	and    $0x1,%edx
+  8035dd:	48 85 d2             	test   %rdx,%rdx
+  8035e0:	74 25                	je     803607 <fd_alloc+0x88>
+  8035e2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8035e6:	48 89 d1             	mov    %rdx,%rcx
+  8035e9:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8035ed:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8035f4:	ff ff ff 
+  8035f7:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8035fb:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8035ff:	83 e2 01             	and    $0x1,%edx
+  803602:	48 85 d2             	test   %rdx,%rdx
+  803605:	75 12                	jne    803619 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803607:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80360b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80360f:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803612:	b8 00 00 00 00       	mov    $0x0,%eax
+  803617:	eb 1a                	jmp    803633 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803619:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80361d:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803621:	7e 85                	jle    8035a8 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803623:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803627:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  80362e:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803633:	c9                   	leave
+  803634:	c3                   	ret
+
+0000000000803635 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803635:	55                   	push   %rbp
+  803636:	48 89 e5             	mov    %rsp,%rbp
+  803639:	48 83 ec 20          	sub    $0x20,%rsp
+  80363d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80363d <fd_lookup+0x8>
+  803644:	49 bb 03 5a 00 00 00 	movabs $0x5a03,%r11
+  80364b:	00 00 00 
+  80364e:	4c 01 d8             	add    %r11,%rax
+  803651:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803654:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803658:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80365c:	78 06                	js     803664 <fd_lookup+0x2f>
+  80365e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803662:	7e 07                	jle    80366b <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803664:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803669:	eb 73                	jmp    8036de <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  80366b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80366e:	48 63 d2             	movslq %edx,%rdx
+  803671:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803678:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80367c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803680:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803684:	48 89 d1             	mov    %rdx,%rcx
+  803687:	48 c1 e9 15          	shr    $0x15,%rcx
+  80368b:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803692:	ff ff ff 
+  803695:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803699:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80369d:	83 e2 01             	and    $0x1,%edx
+  8036a0:	48 85 d2             	test   %rdx,%rdx
+  8036a3:	74 22                	je     8036c7 <fd_lookup+0x92>
+  8036a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036a9:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8036ad:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  8036b4:	ff ff ff 
+  8036b7:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8036bb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036bf:	83 e0 01             	and    $0x1,%eax
+  8036c2:	48 85 c0             	test   %rax,%rax
+  8036c5:	75 07                	jne    8036ce <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8036c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036cc:	eb 10                	jmp    8036de <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8036ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036d6:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8036d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036de:	c9                   	leave
+  8036df:	c3                   	ret
+
+00000000008036e0 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8036e0:	55                   	push   %rbp
+  8036e1:	48 89 e5             	mov    %rsp,%rbp
+  8036e4:	41 57                	push   %r15
+  8036e6:	53                   	push   %rbx
+  8036e7:	48 83 ec 30          	sub    $0x30,%rsp
+  8036eb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036eb <fd_close+0xb>
+  8036f2:	49 bb 55 59 00 00 00 	movabs $0x5955,%r11
+  8036f9:	00 00 00 
+  8036fc:	4c 01 db             	add    %r11,%rbx
+  8036ff:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803703:	89 f0                	mov    %esi,%eax
+  803705:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803708:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80370c:	48 89 c7             	mov    %rax,%rdi
+  80370f:	48 b8 c5 a4 ff ff ff 	movabs $0xffffffffffffa4c5,%rax
+  803716:	ff ff ff 
+  803719:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80371d:	ff d0                	call   *%rax
+  80371f:	89 c2                	mov    %eax,%edx
+  803721:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803725:	48 89 c6             	mov    %rax,%rsi
+  803728:	89 d7                	mov    %edx,%edi
+  80372a:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  803731:	ff ff ff 
+  803734:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803738:	ff d0                	call   *%rax
+  80373a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80373d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803741:	78 0a                	js     80374d <fd_close+0x6d>
+	    || fd != fd2)
+  803743:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803747:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80374b:	74 12                	je     80375f <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80374d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803751:	74 05                	je     803758 <fd_close+0x78>
+  803753:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803756:	eb 7a                	jmp    8037d2 <fd_close+0xf2>
+  803758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375d:	eb 73                	jmp    8037d2 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80375f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803763:	8b 00                	mov    (%rax),%eax
+  803765:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803769:	48 89 d6             	mov    %rdx,%rsi
+  80376c:	89 c7                	mov    %eax,%edi
+  80376e:	48 b8 9b a7 ff ff ff 	movabs $0xffffffffffffa79b,%rax
+  803775:	ff ff ff 
+  803778:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80377c:	ff d0                	call   *%rax
+  80377e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803781:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803785:	78 2a                	js     8037b1 <fd_close+0xd1>
+		if (dev->dev_close)
+  803787:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80378b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80378f:	48 85 c0             	test   %rax,%rax
+  803792:	74 16                	je     8037aa <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803794:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803798:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80379c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037a0:	48 89 c7             	mov    %rax,%rdi
+  8037a3:	ff d2                	call   *%rdx
+  8037a5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037a8:	eb 07                	jmp    8037b1 <fd_close+0xd1>
+		else
+			r = 0;
+  8037aa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8037b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037b5:	48 89 c6             	mov    %rax,%rsi
+  8037b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037bd:	49 89 df             	mov    %rbx,%r15
+  8037c0:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  8037c7:	ff ff ff 
+  8037ca:	48 01 d8             	add    %rbx,%rax
+  8037cd:	ff d0                	call   *%rax
+	return r;
+  8037cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8037d2:	48 83 c4 30          	add    $0x30,%rsp
+  8037d6:	5b                   	pop    %rbx
+  8037d7:	41 5f                	pop    %r15
+  8037d9:	5d                   	pop    %rbp
+  8037da:	c3                   	ret
+
+00000000008037db <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8037db:	55                   	push   %rbp
+  8037dc:	48 89 e5             	mov    %rsp,%rbp
+  8037df:	41 57                	push   %r15
+  8037e1:	48 83 ec 28          	sub    $0x28,%rsp
+  8037e5:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8037e5 <dev_lookup+0xa>
+  8037ec:	49 bb 5b 58 00 00 00 	movabs $0x585b,%r11
+  8037f3:	00 00 00 
+  8037f6:	4c 01 d9             	add    %r11,%rcx
+  8037f9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8037fc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803800:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803807:	eb 45                	jmp    80384e <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803809:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803810:	00 00 00 
+  803813:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803816:	48 98                	cltq
+  803818:	48 01 ca             	add    %rcx,%rdx
+  80381b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80381f:	8b 00                	mov    (%rax),%eax
+  803821:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803824:	75 24                	jne    80384a <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803826:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80382d:	00 00 00 
+  803830:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803833:	48 98                	cltq
+  803835:	48 01 ca             	add    %rcx,%rdx
+  803838:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80383c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803840:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803843:	b8 00 00 00 00       	mov    $0x0,%eax
+  803848:	eb 74                	jmp    8038be <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  80384a:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80384e:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803855:	00 00 00 
+  803858:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80385b:	48 98                	cltq
+  80385d:	48 01 ca             	add    %rcx,%rdx
+  803860:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803864:	48 85 c0             	test   %rax,%rax
+  803867:	75 a0                	jne    803809 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803869:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803870:	ff ff ff 
+  803873:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803877:	48 8b 00             	mov    (%rax),%rax
+  80387a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803880:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803883:	89 c6                	mov    %eax,%esi
+  803885:	48 b8 18 e4 ff ff ff 	movabs $0xffffffffffffe418,%rax
+  80388c:	ff ff ff 
+  80388f:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803893:	48 89 c7             	mov    %rax,%rdi
+  803896:	49 89 cf             	mov    %rcx,%r15
+  803899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80389e:	49 b8 12 77 ff ff ff 	movabs $0xffffffffffff7712,%r8
+  8038a5:	ff ff ff 
+  8038a8:	49 01 c8             	add    %rcx,%r8
+  8038ab:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8038ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038b2:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8038b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8038be:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8038c2:	c9                   	leave
+  8038c3:	c3                   	ret
+
+00000000008038c4 <close>:
+
+int
+close(int fdnum)
+{
+  8038c4:	55                   	push   %rbp
+  8038c5:	48 89 e5             	mov    %rsp,%rbp
+  8038c8:	53                   	push   %rbx
+  8038c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8038cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038cd <close+0x9>
+  8038d4:	49 bb 73 57 00 00 00 	movabs $0x5773,%r11
+  8038db:	00 00 00 
+  8038de:	4c 01 db             	add    %r11,%rbx
+  8038e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8038e4:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8038e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038eb:	48 89 d6             	mov    %rdx,%rsi
+  8038ee:	89 c7                	mov    %eax,%edi
+  8038f0:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  8038f7:	ff ff ff 
+  8038fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8038fe:	ff d0                	call   *%rax
+  803900:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803903:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803907:	79 05                	jns    80390e <close+0x4a>
+		return r;
+  803909:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80390c:	eb 1c                	jmp    80392a <close+0x66>
+	else
+		return fd_close(fd, 1);
+  80390e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803912:	be 01 00 00 00       	mov    $0x1,%esi
+  803917:	48 89 c7             	mov    %rax,%rdi
+  80391a:	48 b8 a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rax
+  803921:	ff ff ff 
+  803924:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803928:	ff d0                	call   *%rax
+}
+  80392a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80392e:	c9                   	leave
+  80392f:	c3                   	ret
+
+0000000000803930 <close_all>:
+
+void
+close_all(void)
+{
+  803930:	55                   	push   %rbp
+  803931:	48 89 e5             	mov    %rsp,%rbp
+  803934:	53                   	push   %rbx
+  803935:	48 83 ec 18          	sub    $0x18,%rsp
+  803939:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803939 <close_all+0x9>
+  803940:	49 bb 07 57 00 00 00 	movabs $0x5707,%r11
+  803947:	00 00 00 
+  80394a:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80394d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803954:	eb 19                	jmp    80396f <close_all+0x3f>
+		close(i);
+  803956:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803959:	89 c7                	mov    %eax,%edi
+  80395b:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  803962:	ff ff ff 
+  803965:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803969:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  80396b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80396f:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803973:	7e e1                	jle    803956 <close_all+0x26>
+}
+  803975:	90                   	nop
+  803976:	90                   	nop
+  803977:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80397b:	c9                   	leave
+  80397c:	c3                   	ret
+
+000000000080397d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80397d:	55                   	push   %rbp
+  80397e:	48 89 e5             	mov    %rsp,%rbp
+  803981:	41 57                	push   %r15
+  803983:	53                   	push   %rbx
+  803984:	48 83 ec 40          	sub    $0x40,%rsp
+  803988:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803988 <dup+0xb>
+  80398f:	49 bb b8 56 00 00 00 	movabs $0x56b8,%r11
+  803996:	00 00 00 
+  803999:	4c 01 db             	add    %r11,%rbx
+  80399c:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80399f:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8039a2:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8039a6:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8039a9:	48 89 d6             	mov    %rdx,%rsi
+  8039ac:	89 c7                	mov    %eax,%edi
+  8039ae:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  8039b5:	ff ff ff 
+  8039b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039bc:	ff d0                	call   *%rax
+  8039be:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039c5:	79 08                	jns    8039cf <dup+0x52>
+		return r;
+  8039c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039ca:	e9 a4 01 00 00       	jmp    803b73 <dup+0x1f6>
+	close(newfdnum);
+  8039cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039d2:	89 c7                	mov    %eax,%edi
+  8039d4:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  8039db:	ff ff ff 
+  8039de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039e2:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8039e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039e7:	48 98                	cltq
+  8039e9:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8039ef:	48 c1 e0 0c          	shl    $0xc,%rax
+  8039f3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  8039f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039fb:	48 89 c7             	mov    %rax,%rdi
+  8039fe:	48 b8 fc a4 ff ff ff 	movabs $0xffffffffffffa4fc,%rax
+  803a05:	ff ff ff 
+  803a08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a0c:	ff d0                	call   *%rax
+  803a0e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803a12:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a16:	48 89 c7             	mov    %rax,%rdi
+  803a19:	48 b8 fc a4 ff ff ff 	movabs $0xffffffffffffa4fc,%rax
+  803a20:	ff ff ff 
+  803a23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a27:	ff d0                	call   *%rax
+  803a29:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803a2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a31:	48 c1 e8 15          	shr    $0x15,%rax
+  803a35:	48 89 c2             	mov    %rax,%rdx
+  803a38:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803a3f:	ff ff ff 
+  803a42:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a46:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a4a:	83 e0 01             	and    $0x1,%eax
+  803a4d:	48 85 c0             	test   %rax,%rax
+  803a50:	74 7f                	je     803ad1 <dup+0x154>
+  803a52:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a56:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a5a:	48 89 c2             	mov    %rax,%rdx
+  803a5d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803a64:	ff ff ff 
+  803a67:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a6b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a6f:	83 e0 01             	and    $0x1,%eax
+  803a72:	48 85 c0             	test   %rax,%rax
+  803a75:	74 5a                	je     803ad1 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803a77:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a7b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a7f:	48 89 c2             	mov    %rax,%rdx
+  803a82:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803a89:	ff ff ff 
+  803a8c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a90:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a94:	25 07 0e 00 00       	and    $0xe07,%eax
+  803a99:	89 c1                	mov    %eax,%ecx
+  803a9b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803aa3:	41 89 c8             	mov    %ecx,%r8d
+  803aa6:	48 89 d1             	mov    %rdx,%rcx
+  803aa9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803aae:	48 89 c6             	mov    %rax,%rsi
+  803ab1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ab6:	49 89 df             	mov    %rbx,%r15
+  803ab9:	48 b8 f5 91 ff ff ff 	movabs $0xffffffffffff91f5,%rax
+  803ac0:	ff ff ff 
+  803ac3:	48 01 d8             	add    %rbx,%rax
+  803ac6:	ff d0                	call   *%rax
+  803ac8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803acb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803acf:	78 5f                	js     803b30 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803ad1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ad5:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ad9:	48 89 c2             	mov    %rax,%rdx
+  803adc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803ae3:	ff ff ff 
+  803ae6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803aea:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803aee:	25 07 0e 00 00       	and    $0xe07,%eax
+  803af3:	89 c1                	mov    %eax,%ecx
+  803af5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803af9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803afd:	41 89 c8             	mov    %ecx,%r8d
+  803b00:	48 89 d1             	mov    %rdx,%rcx
+  803b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b08:	48 89 c6             	mov    %rax,%rsi
+  803b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b10:	49 89 df             	mov    %rbx,%r15
+  803b13:	48 b8 f5 91 ff ff ff 	movabs $0xffffffffffff91f5,%rax
+  803b1a:	ff ff ff 
+  803b1d:	48 01 d8             	add    %rbx,%rax
+  803b20:	ff d0                	call   *%rax
+  803b22:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b25:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b29:	78 08                	js     803b33 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803b2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b2e:	eb 43                	jmp    803b73 <dup+0x1f6>
+			goto err;
+  803b30:	90                   	nop
+  803b31:	eb 01                	jmp    803b34 <dup+0x1b7>
+		goto err;
+  803b33:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803b34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b38:	48 89 c6             	mov    %rax,%rsi
+  803b3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b40:	49 89 df             	mov    %rbx,%r15
+  803b43:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  803b4a:	ff ff ff 
+  803b4d:	48 01 d8             	add    %rbx,%rax
+  803b50:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803b52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b56:	48 89 c6             	mov    %rax,%rsi
+  803b59:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b5e:	49 89 df             	mov    %rbx,%r15
+  803b61:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  803b68:	ff ff ff 
+  803b6b:	48 01 d8             	add    %rbx,%rax
+  803b6e:	ff d0                	call   *%rax
+	return r;
+  803b70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803b73:	48 83 c4 40          	add    $0x40,%rsp
+  803b77:	5b                   	pop    %rbx
+  803b78:	41 5f                	pop    %r15
+  803b7a:	5d                   	pop    %rbp
+  803b7b:	c3                   	ret
+
+0000000000803b7c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803b7c:	55                   	push   %rbp
+  803b7d:	48 89 e5             	mov    %rsp,%rbp
+  803b80:	41 57                	push   %r15
+  803b82:	53                   	push   %rbx
+  803b83:	48 83 ec 40          	sub    $0x40,%rsp
+  803b87:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b87 <read+0xb>
+  803b8e:	49 bb b9 54 00 00 00 	movabs $0x54b9,%r11
+  803b95:	00 00 00 
+  803b98:	4c 01 db             	add    %r11,%rbx
+  803b9b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803b9e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ba2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803ba6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803baa:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803bad:	48 89 d6             	mov    %rdx,%rsi
+  803bb0:	89 c7                	mov    %eax,%edi
+  803bb2:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  803bb9:	ff ff ff 
+  803bbc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bc0:	ff d0                	call   *%rax
+  803bc2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bc5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bc9:	78 28                	js     803bf3 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803bcb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bcf:	8b 00                	mov    (%rax),%eax
+  803bd1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803bd5:	48 89 d6             	mov    %rdx,%rsi
+  803bd8:	89 c7                	mov    %eax,%edi
+  803bda:	48 b8 9b a7 ff ff ff 	movabs $0xffffffffffffa79b,%rax
+  803be1:	ff ff ff 
+  803be4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803be8:	ff d0                	call   *%rax
+  803bea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bf1:	79 08                	jns    803bfb <read+0x7f>
+		return r;
+  803bf3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bf6:	e9 8b 00 00 00       	jmp    803c86 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803bfb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bff:	8b 40 08             	mov    0x8(%rax),%eax
+  803c02:	83 e0 03             	and    $0x3,%eax
+  803c05:	83 f8 01             	cmp    $0x1,%eax
+  803c08:	75 4b                	jne    803c55 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803c0a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803c11:	ff ff ff 
+  803c14:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c18:	48 8b 00             	mov    (%rax),%rax
+  803c1b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803c21:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803c24:	89 c6                	mov    %eax,%esi
+  803c26:	48 b8 37 e4 ff ff ff 	movabs $0xffffffffffffe437,%rax
+  803c2d:	ff ff ff 
+  803c30:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c34:	48 89 c7             	mov    %rax,%rdi
+  803c37:	49 89 df             	mov    %rbx,%r15
+  803c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c3f:	48 b9 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rcx
+  803c46:	ff ff ff 
+  803c49:	48 01 d9             	add    %rbx,%rcx
+  803c4c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803c4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c53:	eb 31                	jmp    803c86 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803c55:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c59:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803c5d:	48 85 c0             	test   %rax,%rax
+  803c60:	75 07                	jne    803c69 <read+0xed>
+		return -E_NOT_SUPP;
+  803c62:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c67:	eb 1d                	jmp    803c86 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803c69:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c6d:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803c71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c75:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803c79:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c7d:	48 89 ce             	mov    %rcx,%rsi
+  803c80:	48 89 c7             	mov    %rax,%rdi
+  803c83:	41 ff d0             	call   *%r8
+}
+  803c86:	48 83 c4 40          	add    $0x40,%rsp
+  803c8a:	5b                   	pop    %rbx
+  803c8b:	41 5f                	pop    %r15
+  803c8d:	5d                   	pop    %rbp
+  803c8e:	c3                   	ret
+
+0000000000803c8f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803c8f:	55                   	push   %rbp
+  803c90:	48 89 e5             	mov    %rsp,%rbp
+  803c93:	53                   	push   %rbx
+  803c94:	48 83 ec 38          	sub    $0x38,%rsp
+  803c98:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c98 <readn+0x9>
+  803c9f:	49 bb a8 53 00 00 00 	movabs $0x53a8,%r11
+  803ca6:	00 00 00 
+  803ca9:	4c 01 db             	add    %r11,%rbx
+  803cac:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803caf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803cb3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803cb7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803cbe:	eb 4b                	jmp    803d0b <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803cc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cc3:	48 98                	cltq
+  803cc5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803cc9:	48 29 c2             	sub    %rax,%rdx
+  803ccc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ccf:	48 63 c8             	movslq %eax,%rcx
+  803cd2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cd6:	48 01 c1             	add    %rax,%rcx
+  803cd9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cdc:	48 89 ce             	mov    %rcx,%rsi
+  803cdf:	89 c7                	mov    %eax,%edi
+  803ce1:	48 b8 3c ab ff ff ff 	movabs $0xffffffffffffab3c,%rax
+  803ce8:	ff ff ff 
+  803ceb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cef:	ff d0                	call   *%rax
+  803cf1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803cf4:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803cf8:	79 05                	jns    803cff <readn+0x70>
+			return m;
+  803cfa:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803cfd:	eb 1d                	jmp    803d1c <readn+0x8d>
+		if (m == 0)
+  803cff:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803d03:	74 13                	je     803d18 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803d05:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d08:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803d0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d0e:	48 98                	cltq
+  803d10:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803d14:	72 aa                	jb     803cc0 <readn+0x31>
+  803d16:	eb 01                	jmp    803d19 <readn+0x8a>
+			break;
+  803d18:	90                   	nop
+	}
+	return tot;
+  803d19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803d1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d20:	c9                   	leave
+  803d21:	c3                   	ret
+
+0000000000803d22 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803d22:	55                   	push   %rbp
+  803d23:	48 89 e5             	mov    %rsp,%rbp
+  803d26:	41 57                	push   %r15
+  803d28:	53                   	push   %rbx
+  803d29:	48 83 ec 40          	sub    $0x40,%rsp
+  803d2d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d2d <write+0xb>
+  803d34:	49 bb 13 53 00 00 00 	movabs $0x5313,%r11
+  803d3b:	00 00 00 
+  803d3e:	4c 01 db             	add    %r11,%rbx
+  803d41:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803d44:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d48:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803d4c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803d50:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803d53:	48 89 d6             	mov    %rdx,%rsi
+  803d56:	89 c7                	mov    %eax,%edi
+  803d58:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  803d5f:	ff ff ff 
+  803d62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d66:	ff d0                	call   *%rax
+  803d68:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d6b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d6f:	78 28                	js     803d99 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d75:	8b 00                	mov    (%rax),%eax
+  803d77:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803d7b:	48 89 d6             	mov    %rdx,%rsi
+  803d7e:	89 c7                	mov    %eax,%edi
+  803d80:	48 b8 9b a7 ff ff ff 	movabs $0xffffffffffffa79b,%rax
+  803d87:	ff ff ff 
+  803d8a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d8e:	ff d0                	call   *%rax
+  803d90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d93:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d97:	79 08                	jns    803da1 <write+0x7f>
+		return r;
+  803d99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d9c:	e9 8a 00 00 00       	jmp    803e2b <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803da1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803da5:	8b 40 08             	mov    0x8(%rax),%eax
+  803da8:	83 e0 03             	and    $0x3,%eax
+  803dab:	85 c0                	test   %eax,%eax
+  803dad:	75 4b                	jne    803dfa <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803daf:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803db6:	ff ff ff 
+  803db9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803dbd:	48 8b 00             	mov    (%rax),%rax
+  803dc0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803dc6:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803dc9:	89 c6                	mov    %eax,%esi
+  803dcb:	48 b8 53 e4 ff ff ff 	movabs $0xffffffffffffe453,%rax
+  803dd2:	ff ff ff 
+  803dd5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803dd9:	48 89 c7             	mov    %rax,%rdi
+  803ddc:	49 89 df             	mov    %rbx,%r15
+  803ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de4:	48 b9 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rcx
+  803deb:	ff ff ff 
+  803dee:	48 01 d9             	add    %rbx,%rcx
+  803df1:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803df3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803df8:	eb 31                	jmp    803e2b <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803dfa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dfe:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803e02:	48 85 c0             	test   %rax,%rax
+  803e05:	75 07                	jne    803e0e <write+0xec>
+		return -E_NOT_SUPP;
+  803e07:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803e0c:	eb 1d                	jmp    803e2b <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803e0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e12:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803e16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e1a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e1e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e22:	48 89 ce             	mov    %rcx,%rsi
+  803e25:	48 89 c7             	mov    %rax,%rdi
+  803e28:	41 ff d0             	call   *%r8
+}
+  803e2b:	48 83 c4 40          	add    $0x40,%rsp
+  803e2f:	5b                   	pop    %rbx
+  803e30:	41 5f                	pop    %r15
+  803e32:	5d                   	pop    %rbp
+  803e33:	c3                   	ret
+
+0000000000803e34 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803e34:	55                   	push   %rbp
+  803e35:	48 89 e5             	mov    %rsp,%rbp
+  803e38:	48 83 ec 18          	sub    $0x18,%rsp
+  803e3c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e3c <seek+0x8>
+  803e43:	49 bb 04 52 00 00 00 	movabs $0x5204,%r11
+  803e4a:	00 00 00 
+  803e4d:	4c 01 d8             	add    %r11,%rax
+  803e50:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e53:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e56:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803e5a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803e5d:	48 89 ce             	mov    %rcx,%rsi
+  803e60:	89 d7                	mov    %edx,%edi
+  803e62:	48 ba f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rdx
+  803e69:	ff ff ff 
+  803e6c:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803e70:	ff d0                	call   *%rax
+  803e72:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e75:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e79:	79 05                	jns    803e80 <seek+0x4c>
+		return r;
+  803e7b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e7e:	eb 0f                	jmp    803e8f <seek+0x5b>
+	fd->fd_offset = offset;
+  803e80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e84:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803e87:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e8f:	c9                   	leave
+  803e90:	c3                   	ret
+
+0000000000803e91 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803e91:	55                   	push   %rbp
+  803e92:	48 89 e5             	mov    %rsp,%rbp
+  803e95:	41 57                	push   %r15
+  803e97:	53                   	push   %rbx
+  803e98:	48 83 ec 30          	sub    $0x30,%rsp
+  803e9c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e9c <ftruncate+0xb>
+  803ea3:	49 bb a4 51 00 00 00 	movabs $0x51a4,%r11
+  803eaa:	00 00 00 
+  803ead:	4c 01 db             	add    %r11,%rbx
+  803eb0:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803eb3:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803eb6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803eba:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803ebd:	48 89 d6             	mov    %rdx,%rsi
+  803ec0:	89 c7                	mov    %eax,%edi
+  803ec2:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  803ec9:	ff ff ff 
+  803ecc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ed0:	ff d0                	call   *%rax
+  803ed2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ed5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ed9:	78 28                	js     803f03 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803edb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803edf:	8b 00                	mov    (%rax),%eax
+  803ee1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803ee5:	48 89 d6             	mov    %rdx,%rsi
+  803ee8:	89 c7                	mov    %eax,%edi
+  803eea:	48 b8 9b a7 ff ff ff 	movabs $0xffffffffffffa79b,%rax
+  803ef1:	ff ff ff 
+  803ef4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ef8:	ff d0                	call   *%rax
+  803efa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803efd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f01:	79 08                	jns    803f0b <ftruncate+0x7a>
+		return r;
+  803f03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f06:	e9 83 00 00 00       	jmp    803f8e <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803f0b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f0f:	8b 40 08             	mov    0x8(%rax),%eax
+  803f12:	83 e0 03             	and    $0x3,%eax
+  803f15:	85 c0                	test   %eax,%eax
+  803f17:	75 4b                	jne    803f64 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803f19:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803f20:	ff ff ff 
+  803f23:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f27:	48 8b 00             	mov    (%rax),%rax
+  803f2a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803f30:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803f33:	89 c6                	mov    %eax,%esi
+  803f35:	48 b8 70 e4 ff ff ff 	movabs $0xffffffffffffe470,%rax
+  803f3c:	ff ff ff 
+  803f3f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f43:	48 89 c7             	mov    %rax,%rdi
+  803f46:	49 89 df             	mov    %rbx,%r15
+  803f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4e:	48 b9 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rcx
+  803f55:	ff ff ff 
+  803f58:	48 01 d9             	add    %rbx,%rcx
+  803f5b:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803f5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f62:	eb 2a                	jmp    803f8e <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803f64:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f68:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803f6c:	48 85 c0             	test   %rax,%rax
+  803f6f:	75 07                	jne    803f78 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803f71:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f76:	eb 16                	jmp    803f8e <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803f78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f7c:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803f80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f84:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803f87:	89 d6                	mov    %edx,%esi
+  803f89:	48 89 c7             	mov    %rax,%rdi
+  803f8c:	ff d1                	call   *%rcx
+}
+  803f8e:	48 83 c4 30          	add    $0x30,%rsp
+  803f92:	5b                   	pop    %rbx
+  803f93:	41 5f                	pop    %r15
+  803f95:	5d                   	pop    %rbp
+  803f96:	c3                   	ret
+
+0000000000803f97 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803f97:	55                   	push   %rbp
+  803f98:	48 89 e5             	mov    %rsp,%rbp
+  803f9b:	53                   	push   %rbx
+  803f9c:	48 83 ec 38          	sub    $0x38,%rsp
+  803fa0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fa0 <fstat+0x9>
+  803fa7:	49 bb a0 50 00 00 00 	movabs $0x50a0,%r11
+  803fae:	00 00 00 
+  803fb1:	4c 01 db             	add    %r11,%rbx
+  803fb4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803fb7:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803fbb:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803fbf:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803fc2:	48 89 d6             	mov    %rdx,%rsi
+  803fc5:	89 c7                	mov    %eax,%edi
+  803fc7:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  803fce:	ff ff ff 
+  803fd1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fd5:	ff d0                	call   *%rax
+  803fd7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fda:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fde:	78 28                	js     804008 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803fe0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fe4:	8b 00                	mov    (%rax),%eax
+  803fe6:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803fea:	48 89 d6             	mov    %rdx,%rsi
+  803fed:	89 c7                	mov    %eax,%edi
+  803fef:	48 b8 9b a7 ff ff ff 	movabs $0xffffffffffffa79b,%rax
+  803ff6:	ff ff ff 
+  803ff9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ffd:	ff d0                	call   *%rax
+  803fff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804002:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804006:	79 05                	jns    80400d <fstat+0x76>
+		return r;
+  804008:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80400b:	eb 5e                	jmp    80406b <fstat+0xd4>
+	if (!dev->dev_stat)
+  80400d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804011:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804015:	48 85 c0             	test   %rax,%rax
+  804018:	75 07                	jne    804021 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80401a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80401f:	eb 4a                	jmp    80406b <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804021:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804025:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804028:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80402c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804033:	00 00 00 
+	stat->st_isdir = 0;
+  804036:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80403a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804041:	00 00 00 
+	stat->st_dev = dev;
+  804044:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804048:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80404c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804053:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804057:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80405b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80405f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804063:	48 89 d6             	mov    %rdx,%rsi
+  804066:	48 89 c7             	mov    %rax,%rdi
+  804069:	ff d1                	call   *%rcx
+}
+  80406b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80406f:	c9                   	leave
+  804070:	c3                   	ret
+
+0000000000804071 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804071:	55                   	push   %rbp
+  804072:	48 89 e5             	mov    %rsp,%rbp
+  804075:	41 57                	push   %r15
+  804077:	53                   	push   %rbx
+  804078:	48 83 ec 20          	sub    $0x20,%rsp
+  80407c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80407c <stat+0xb>
+  804083:	49 bb c4 4f 00 00 00 	movabs $0x4fc4,%r11
+  80408a:	00 00 00 
+  80408d:	4c 01 db             	add    %r11,%rbx
+  804090:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804094:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804098:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80409c:	be 00 00 00 00       	mov    $0x0,%esi
+  8040a1:	48 89 c7             	mov    %rax,%rdi
+  8040a4:	49 89 df             	mov    %rbx,%r15
+  8040a7:	48 b8 0b b3 ff ff ff 	movabs $0xffffffffffffb30b,%rax
+  8040ae:	ff ff ff 
+  8040b1:	48 01 d8             	add    %rbx,%rax
+  8040b4:	ff d0                	call   *%rax
+  8040b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040bd:	79 05                	jns    8040c4 <stat+0x53>
+		return fd;
+  8040bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040c2:	eb 37                	jmp    8040fb <stat+0x8a>
+	r = fstat(fd, stat);
+  8040c4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040cb:	48 89 d6             	mov    %rdx,%rsi
+  8040ce:	89 c7                	mov    %eax,%edi
+  8040d0:	48 b8 57 af ff ff ff 	movabs $0xffffffffffffaf57,%rax
+  8040d7:	ff ff ff 
+  8040da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040de:	ff d0                	call   *%rax
+  8040e0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8040e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040e6:	89 c7                	mov    %eax,%edi
+  8040e8:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  8040ef:	ff ff ff 
+  8040f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040f6:	ff d0                	call   *%rax
+	return r;
+  8040f8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8040fb:	48 83 c4 20          	add    $0x20,%rsp
+  8040ff:	5b                   	pop    %rbx
+  804100:	41 5f                	pop    %r15
+  804102:	5d                   	pop    %rbp
+  804103:	c3                   	ret
+
+0000000000804104 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  804104:	55                   	push   %rbp
+  804105:	48 89 e5             	mov    %rsp,%rbp
+  804108:	41 57                	push   %r15
+  80410a:	53                   	push   %rbx
+  80410b:	48 83 ec 10          	sub    $0x10,%rsp
+  80410f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80410f <fsipc+0xb>
+  804116:	49 bb 31 4f 00 00 00 	movabs $0x4f31,%r11
+  80411d:	00 00 00 
+  804120:	4c 01 db             	add    %r11,%rbx
+  804123:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804126:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80412a:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804131:	00 00 00 
+  804134:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804137:	85 c0                	test   %eax,%eax
+  804139:	75 24                	jne    80415f <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80413b:	bf 01 00 00 00       	mov    $0x1,%edi
+  804140:	49 89 df             	mov    %rbx,%r15
+  804143:	48 b8 8d dc ff ff ff 	movabs $0xffffffffffffdc8d,%rax
+  80414a:	ff ff ff 
+  80414d:	48 01 d8             	add    %rbx,%rax
+  804150:	ff d0                	call   *%rax
+  804152:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804159:	00 00 00 
+  80415c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  80415f:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804166:	00 00 00 
+  804169:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80416c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804170:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804173:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804179:	49 89 d0             	mov    %rdx,%r8
+  80417c:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804181:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804188:	00 00 00 
+  80418b:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80418f:	89 c7                	mov    %eax,%edi
+  804191:	49 89 df             	mov    %rbx,%r15
+  804194:	48 b8 ac d6 ff ff ff 	movabs $0xffffffffffffd6ac,%rax
+  80419b:	ff ff ff 
+  80419e:	48 01 d8             	add    %rbx,%rax
+  8041a1:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8041a3:	48 83 c4 10          	add    $0x10,%rsp
+  8041a7:	5b                   	pop    %rbx
+  8041a8:	41 5f                	pop    %r15
+  8041aa:	5d                   	pop    %rbp
+  8041ab:	c3                   	ret
+
+00000000008041ac <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8041ac:	55                   	push   %rbp
+  8041ad:	48 89 e5             	mov    %rsp,%rbp
+  8041b0:	41 57                	push   %r15
+  8041b2:	53                   	push   %rbx
+  8041b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8041b7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041b7 <fsipc_words+0xb>
+  8041be:	49 bb 89 4e 00 00 00 	movabs $0x4e89,%r11
+  8041c5:	00 00 00 
+  8041c8:	4c 01 db             	add    %r11,%rbx
+  8041cb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8041ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041d2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8041d6:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8041dd:	00 00 00 
+  8041e0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8041e3:	85 c0                	test   %eax,%eax
+  8041e5:	75 24                	jne    80420b <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8041e7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041ec:	49 89 df             	mov    %rbx,%r15
+  8041ef:	48 b8 8d dc ff ff ff 	movabs $0xffffffffffffdc8d,%rax
+  8041f6:	ff ff ff 
+  8041f9:	48 01 d8             	add    %rbx,%rax
+  8041fc:	ff d0                	call   *%rax
+  8041fe:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804205:	00 00 00 
+  804208:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  80420b:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804212:	00 00 00 
+  804215:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804218:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80421c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804220:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804223:	89 c7                	mov    %eax,%edi
+  804225:	49 89 df             	mov    %rbx,%r15
+  804228:	48 b8 97 d7 ff ff ff 	movabs $0xffffffffffffd797,%rax
+  80422f:	ff ff ff 
+  804232:	48 01 d8             	add    %rbx,%rax
+  804235:	ff d0                	call   *%rax
+}
+  804237:	48 83 c4 20          	add    $0x20,%rsp
+  80423b:	5b                   	pop    %rbx
+  80423c:	41 5f                	pop    %r15
+  80423e:	5d                   	pop    %rbp
+  80423f:	c3                   	ret
+
+0000000000804240 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804240:	55                   	push   %rbp
+  804241:	48 89 e5             	mov    %rsp,%rbp
+  804244:	41 57                	push   %r15
+  804246:	53                   	push   %rbx
+  804247:	48 83 ec 40          	sub    $0x40,%rsp
+  80424b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80424b <fsipc_pages+0xb>
+  804252:	49 bb f5 4d 00 00 00 	movabs $0x4df5,%r11
+  804259:	00 00 00 
+  80425c:	4c 01 db             	add    %r11,%rbx
+  80425f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804262:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804266:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  80426a:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  80426d:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804274:	00 00 00 
+  804277:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80427a:	85 c0                	test   %eax,%eax
+  80427c:	75 24                	jne    8042a2 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80427e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804283:	49 89 df             	mov    %rbx,%r15
+  804286:	48 b8 8d dc ff ff ff 	movabs $0xffffffffffffdc8d,%rax
+  80428d:	ff ff ff 
+  804290:	48 01 d8             	add    %rbx,%rax
+  804293:	ff d0                	call   *%rax
+  804295:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80429c:	00 00 00 
+  80429f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8042a2:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8042a7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8042ab:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8042ae:	48 98                	cltq
+  8042b0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8042b4:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8042b8:	0f 95 c0             	setne  %al
+  8042bb:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  8042be:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8042c5:	00 
+  8042c6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8042ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042ce:	48 01 d0             	add    %rdx,%rax
+  8042d1:	48 83 e8 01          	sub    $0x1,%rax
+  8042d5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8042d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042e2:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8042e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042ea:	48 29 d0             	sub    %rdx,%rax
+  8042ed:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8042f1:	41 89 c2             	mov    %eax,%r10d
+  8042f4:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8042fb:	00 00 00 
+  8042fe:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804301:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804305:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804309:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80430c:	48 83 ec 08          	sub    $0x8,%rsp
+  804310:	6a 40                	push   $0x40
+  804312:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804317:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  80431e:	00 
+  80431f:	6a 05                	push   $0x5
+  804321:	41 89 f9             	mov    %edi,%r9d
+  804324:	49 89 c8             	mov    %rcx,%r8
+  804327:	44 89 d1             	mov    %r10d,%ecx
+  80432a:	89 c7                	mov    %eax,%edi
+  80432c:	49 89 df             	mov    %rbx,%r15
+  80432f:	48 b8 95 d8 ff ff ff 	movabs $0xffffffffffffd895,%rax
+  804336:	ff ff ff 
+  804339:	48 01 d8             	add    %rbx,%rax
+  80433c:	ff d0                	call   *%rax
+  80433e:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804342:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804346:	5b                   	pop    %rbx
+  804347:	41 5f                	pop    %r15
+  804349:	5d                   	pop    %rbp
+  80434a:	c3                   	ret
+
+000000000080434b <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  80434b:	55                   	push   %rbp
+  80434c:	48 89 e5             	mov    %rsp,%rbp
+  80434f:	41 57                	push   %r15
+  804351:	53                   	push   %rbx
+  804352:	48 83 ec 20          	sub    $0x20,%rsp
+  804356:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804356 <open+0xb>
+  80435d:	49 bb ea 4c 00 00 00 	movabs $0x4cea,%r11
+  804364:	00 00 00 
+  804367:	4c 01 db             	add    %r11,%rbx
+  80436a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80436e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804371:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804375:	48 89 c7             	mov    %rax,%rdi
+  804378:	49 89 df             	mov    %rbx,%r15
+  80437b:	48 b8 40 84 ff ff ff 	movabs $0xffffffffffff8440,%rax
+  804382:	ff ff ff 
+  804385:	48 01 d8             	add    %rbx,%rax
+  804388:	ff d0                	call   *%rax
+  80438a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80438f:	7e 0a                	jle    80439b <open+0x50>
+		return -E_BAD_PATH;
+  804391:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804396:	e9 18 01 00 00       	jmp    8044b3 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  80439b:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80439f:	48 89 c7             	mov    %rax,%rdi
+  8043a2:	49 89 df             	mov    %rbx,%r15
+  8043a5:	48 b8 3f a5 ff ff ff 	movabs $0xffffffffffffa53f,%rax
+  8043ac:	ff ff ff 
+  8043af:	48 01 d8             	add    %rbx,%rax
+  8043b2:	ff d0                	call   *%rax
+  8043b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043bb:	74 08                	je     8043c5 <open+0x7a>
+		return r;
+  8043bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043c0:	e9 ee 00 00 00       	jmp    8044b3 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8043c5:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8043cc:	00 00 00 
+  8043cf:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8043d2:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8043d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043dd:	48 89 c6             	mov    %rax,%rsi
+  8043e0:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8043e7:	00 00 00 
+  8043ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8043ee:	48 89 c7             	mov    %rax,%rdi
+  8043f1:	49 89 df             	mov    %rbx,%r15
+  8043f4:	48 b8 d4 84 ff ff ff 	movabs $0xffffffffffff84d4,%rax
+  8043fb:	ff ff ff 
+  8043fe:	48 01 d8             	add    %rbx,%rax
+  804401:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804403:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804407:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  80440c:	48 89 c6             	mov    %rax,%rsi
+  80440f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804414:	49 89 df             	mov    %rbx,%r15
+  804417:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  80441e:	ff ff ff 
+  804421:	48 01 d8             	add    %rbx,%rax
+  804424:	ff d0                	call   *%rax
+  804426:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804429:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80442d:	74 23                	je     804452 <open+0x107>
+		fd_close(fd,0);
+  80442f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804433:	be 00 00 00 00       	mov    $0x0,%esi
+  804438:	48 89 c7             	mov    %rax,%rdi
+  80443b:	49 89 df             	mov    %rbx,%r15
+  80443e:	48 b8 a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rax
+  804445:	ff ff ff 
+  804448:	48 01 d8             	add    %rbx,%rax
+  80444b:	ff d0                	call   *%rax
+		return r;
+  80444d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804450:	eb 61                	jmp    8044b3 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804452:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804456:	48 89 c6             	mov    %rax,%rsi
+  804459:	bf 01 00 00 00       	mov    $0x1,%edi
+  80445e:	48 b8 c4 b0 ff ff ff 	movabs $0xffffffffffffb0c4,%rax
+  804465:	ff ff ff 
+  804468:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80446c:	ff d0                	call   *%rax
+  80446e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804471:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804475:	74 23                	je     80449a <open+0x14f>
+		fd_close(fd,0);
+  804477:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80447b:	be 00 00 00 00       	mov    $0x0,%esi
+  804480:	48 89 c7             	mov    %rax,%rdi
+  804483:	49 89 df             	mov    %rbx,%r15
+  804486:	48 b8 a0 a6 ff ff ff 	movabs $0xffffffffffffa6a0,%rax
+  80448d:	ff ff ff 
+  804490:	48 01 d8             	add    %rbx,%rax
+  804493:	ff d0                	call   *%rax
+		return r;
+  804495:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804498:	eb 19                	jmp    8044b3 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  80449a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80449e:	48 89 c7             	mov    %rax,%rdi
+  8044a1:	49 89 df             	mov    %rbx,%r15
+  8044a4:	48 b8 c5 a4 ff ff ff 	movabs $0xffffffffffffa4c5,%rax
+  8044ab:	ff ff ff 
+  8044ae:	48 01 d8             	add    %rbx,%rax
+  8044b1:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8044b3:	48 83 c4 20          	add    $0x20,%rsp
+  8044b7:	5b                   	pop    %rbx
+  8044b8:	41 5f                	pop    %r15
+  8044ba:	5d                   	pop    %rbp
+  8044bb:	c3                   	ret
+
+00000000008044bc <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8044bc:	55                   	push   %rbp
+  8044bd:	48 89 e5             	mov    %rsp,%rbp
+  8044c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8044c4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044c4 <devfile_flush+0x8>
+  8044cb:	49 bb 7c 4b 00 00 00 	movabs $0x4b7c,%r11
+  8044d2:	00 00 00 
+  8044d5:	4c 01 d8             	add    %r11,%rax
+  8044d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8044dc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8044e0:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8044e3:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8044e6:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8044ea:	ba 04 00 00 00       	mov    $0x4,%edx
+  8044ef:	48 89 ce             	mov    %rcx,%rsi
+  8044f2:	bf 06 00 00 00       	mov    $0x6,%edi
+  8044f7:	48 b9 6c b1 ff ff ff 	movabs $0xffffffffffffb16c,%rcx
+  8044fe:	ff ff ff 
+  804501:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804505:	ff d0                	call   *%rax
+}
+  804507:	c9                   	leave
+  804508:	c3                   	ret
+
+0000000000804509 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804509:	55                   	push   %rbp
+  80450a:	48 89 e5             	mov    %rsp,%rbp
+  80450d:	41 57                	push   %r15
+  80450f:	53                   	push   %rbx
+  804510:	48 83 ec 60          	sub    $0x60,%rsp
+  804514:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804514 <devfile_read+0xb>
+  80451b:	49 bb 2c 4b 00 00 00 	movabs $0x4b2c,%r11
+  804522:	00 00 00 
+  804525:	4c 01 db             	add    %r11,%rbx
+  804528:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80452c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804530:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804534:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804538:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  80453c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804540:	8b 50 0c             	mov    0xc(%rax),%edx
+  804543:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804547:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804549:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80454d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804551:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804555:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804559:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80455e:	ba 10 00 00 00       	mov    $0x10,%edx
+  804563:	48 89 c6             	mov    %rax,%rsi
+  804566:	bf 03 00 00 00       	mov    $0x3,%edi
+  80456b:	48 b8 00 b2 ff ff ff 	movabs $0xffffffffffffb200,%rax
+  804572:	ff ff ff 
+  804575:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804579:	ff d0                	call   *%rax
+  80457b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80457e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804582:	79 05                	jns    804589 <devfile_read+0x80>
+		return r;
+  804584:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804587:	eb 64                	jmp    8045ed <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804589:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80458c:	48 63 d0             	movslq %eax,%rdx
+  80458f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804593:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804598:	48 01 c1             	add    %rax,%rcx
+  80459b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80459f:	48 89 ce             	mov    %rcx,%rsi
+  8045a2:	48 89 c7             	mov    %rax,%rdi
+  8045a5:	49 89 df             	mov    %rbx,%r15
+  8045a8:	48 b8 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rax
+  8045af:	ff ff ff 
+  8045b2:	48 01 d8             	add    %rbx,%rax
+  8045b5:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8045b7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8045be:	ff ff ff 
+  8045c1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8045c5:	48 8b 00             	mov    (%rax),%rax
+  8045c8:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8045ce:	89 c6                	mov    %eax,%esi
+  8045d0:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8045d5:	48 89 c7             	mov    %rax,%rdi
+  8045d8:	49 89 df             	mov    %rbx,%r15
+  8045db:	48 b8 47 dc ff ff ff 	movabs $0xffffffffffffdc47,%rax
+  8045e2:	ff ff ff 
+  8045e5:	48 01 d8             	add    %rbx,%rax
+  8045e8:	ff d0                	call   *%rax
+	return r;
+  8045ea:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8045ed:	48 83 c4 60          	add    $0x60,%rsp
+  8045f1:	5b                   	pop    %rbx
+  8045f2:	41 5f                	pop    %r15
+  8045f4:	5d                   	pop    %rbp
+  8045f5:	c3                   	ret
+
+00000000008045f6 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8045f6:	55                   	push   %rbp
+  8045f7:	48 89 e5             	mov    %rsp,%rbp
+  8045fa:	41 57                	push   %r15
+  8045fc:	53                   	push   %rbx
+  8045fd:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804601:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804601 <devfile_write+0xb>
+  804608:	49 bb 3f 4a 00 00 00 	movabs $0x4a3f,%r11
+  80460f:	00 00 00 
+  804612:	4c 01 db             	add    %r11,%rbx
+  804615:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804619:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  80461d:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804624:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804628:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  80462c:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804633:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804637:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  80463e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804641:	48 63 d0             	movslq %eax,%rdx
+  804644:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804648:	48 39 c2             	cmp    %rax,%rdx
+  80464b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80464f:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804656:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80465d:	00 
+  80465e:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804665:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804669:	48 01 d0             	add    %rdx,%rax
+  80466c:	48 83 e8 01          	sub    $0x1,%rax
+  804670:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804674:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804678:	ba 00 00 00 00       	mov    $0x0,%edx
+  80467d:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804681:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804685:	48 29 d0             	sub    %rdx,%rax
+  804688:	48 c1 e8 0c          	shr    $0xc,%rax
+  80468c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  80468f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804692:	89 c6                	mov    %eax,%esi
+  804694:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804699:	48 89 c7             	mov    %rax,%rdi
+  80469c:	49 89 df             	mov    %rbx,%r15
+  80469f:	48 b8 01 dc ff ff ff 	movabs $0xffffffffffffdc01,%rax
+  8046a6:	ff ff ff 
+  8046a9:	48 01 d8             	add    %rbx,%rax
+  8046ac:	ff d0                	call   *%rax
+  8046ae:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8046b1:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8046b5:	79 08                	jns    8046bf <devfile_write+0xc9>
+		return r;
+  8046b7:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8046ba:	e9 8f 00 00 00       	jmp    80474e <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8046bf:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8046c6:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8046ca:	48 89 c6             	mov    %rax,%rsi
+  8046cd:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8046d2:	48 89 c7             	mov    %rax,%rdi
+  8046d5:	49 89 df             	mov    %rbx,%r15
+  8046d8:	48 b8 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rax
+  8046df:	ff ff ff 
+  8046e2:	48 01 d8             	add    %rbx,%rax
+  8046e5:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8046e7:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8046eb:	8b 50 0c             	mov    0xc(%rax),%edx
+  8046ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f2:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8046f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f8:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8046ff:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804703:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804706:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80470a:	89 d1                	mov    %edx,%ecx
+  80470c:	ba 10 00 00 00       	mov    $0x10,%edx
+  804711:	48 89 c6             	mov    %rax,%rsi
+  804714:	bf 04 00 00 00       	mov    $0x4,%edi
+  804719:	48 b8 00 b2 ff ff ff 	movabs $0xffffffffffffb200,%rax
+  804720:	ff ff ff 
+  804723:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804727:	ff d0                	call   *%rax
+  804729:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80472c:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80472f:	89 c6                	mov    %eax,%esi
+  804731:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804736:	48 89 c7             	mov    %rax,%rdi
+  804739:	49 89 df             	mov    %rbx,%r15
+  80473c:	48 b8 47 dc ff ff ff 	movabs $0xffffffffffffdc47,%rax
+  804743:	ff ff ff 
+  804746:	48 01 d8             	add    %rbx,%rax
+  804749:	ff d0                	call   *%rax
+	return r;
+  80474b:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80474e:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804752:	5b                   	pop    %rbx
+  804753:	41 5f                	pop    %r15
+  804755:	5d                   	pop    %rbp
+  804756:	c3                   	ret
+
+0000000000804757 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804757:	55                   	push   %rbp
+  804758:	48 89 e5             	mov    %rsp,%rbp
+  80475b:	41 57                	push   %r15
+  80475d:	53                   	push   %rbx
+  80475e:	48 83 ec 20          	sub    $0x20,%rsp
+  804762:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804762 <devfile_stat+0xb>
+  804769:	49 bb de 48 00 00 00 	movabs $0x48de,%r11
+  804770:	00 00 00 
+  804773:	4c 01 db             	add    %r11,%rbx
+  804776:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80477a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80477e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804782:	8b 40 0c             	mov    0xc(%rax),%eax
+  804785:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80478c:	00 00 00 
+  80478f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804792:	be 00 00 00 00       	mov    $0x0,%esi
+  804797:	bf 05 00 00 00       	mov    $0x5,%edi
+  80479c:	48 b8 c4 b0 ff ff ff 	movabs $0xffffffffffffb0c4,%rax
+  8047a3:	ff ff ff 
+  8047a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047aa:	ff d0                	call   *%rax
+  8047ac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047af:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047b3:	79 05                	jns    8047ba <devfile_stat+0x63>
+		return r;
+  8047b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047b8:	eb 65                	jmp    80481f <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8047ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047be:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8047c5:	00 00 00 
+  8047c8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8047cc:	48 89 d6             	mov    %rdx,%rsi
+  8047cf:	48 89 c7             	mov    %rax,%rdi
+  8047d2:	49 89 df             	mov    %rbx,%r15
+  8047d5:	48 b8 d4 84 ff ff ff 	movabs $0xffffffffffff84d4,%rax
+  8047dc:	ff ff ff 
+  8047df:	48 01 d8             	add    %rbx,%rax
+  8047e2:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8047e4:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8047eb:	00 00 00 
+  8047ee:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8047f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047f9:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8047ff:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804806:	00 00 00 
+  804809:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804810:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804814:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  80481a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80481f:	48 83 c4 20          	add    $0x20,%rsp
+  804823:	5b                   	pop    %rbx
+  804824:	41 5f                	pop    %r15
+  804826:	5d                   	pop    %rbp
+  804827:	c3                   	ret
+
+0000000000804828 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804828:	55                   	push   %rbp
+  804829:	48 89 e5             	mov    %rsp,%rbp
+  80482c:	48 83 ec 20          	sub    $0x20,%rsp
+  804830:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804830 <devfile_trunc+0x8>
+  804837:	49 bb 10 48 00 00 00 	movabs $0x4810,%r11
+  80483e:	00 00 00 
+  804841:	4c 01 d8             	add    %r11,%rax
+  804844:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804848:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80484b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80484f:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804852:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804855:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804858:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80485b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80485f:	ba 08 00 00 00       	mov    $0x8,%edx
+  804864:	48 89 ce             	mov    %rcx,%rsi
+  804867:	bf 02 00 00 00       	mov    $0x2,%edi
+  80486c:	48 b9 6c b1 ff ff ff 	movabs $0xffffffffffffb16c,%rcx
+  804873:	ff ff ff 
+  804876:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80487a:	ff d0                	call   *%rax
+}
+  80487c:	c9                   	leave
+  80487d:	c3                   	ret
+
+000000000080487e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80487e:	55                   	push   %rbp
+  80487f:	48 89 e5             	mov    %rsp,%rbp
+  804882:	41 57                	push   %r15
+  804884:	53                   	push   %rbx
+  804885:	48 83 ec 10          	sub    $0x10,%rsp
+  804889:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804889 <remove+0xb>
+  804890:	49 bb b7 47 00 00 00 	movabs $0x47b7,%r11
+  804897:	00 00 00 
+  80489a:	4c 01 db             	add    %r11,%rbx
+  80489d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8048a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048a5:	48 89 c7             	mov    %rax,%rdi
+  8048a8:	49 89 df             	mov    %rbx,%r15
+  8048ab:	48 b8 40 84 ff ff ff 	movabs $0xffffffffffff8440,%rax
+  8048b2:	ff ff ff 
+  8048b5:	48 01 d8             	add    %rbx,%rax
+  8048b8:	ff d0                	call   *%rax
+  8048ba:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8048bf:	7e 07                	jle    8048c8 <remove+0x4a>
+		return -E_BAD_PATH;
+  8048c1:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8048c6:	eb 44                	jmp    80490c <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8048c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048cc:	48 89 c6             	mov    %rax,%rsi
+  8048cf:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8048d6:	00 00 00 
+  8048d9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048dd:	48 89 c7             	mov    %rax,%rdi
+  8048e0:	49 89 df             	mov    %rbx,%r15
+  8048e3:	48 b8 d4 84 ff ff ff 	movabs $0xffffffffffff84d4,%rax
+  8048ea:	ff ff ff 
+  8048ed:	48 01 d8             	add    %rbx,%rax
+  8048f0:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8048f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8048f7:	bf 07 00 00 00       	mov    $0x7,%edi
+  8048fc:	48 b8 c4 b0 ff ff ff 	movabs $0xffffffffffffb0c4,%rax
+  804903:	ff ff ff 
+  804906:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80490a:	ff d0                	call   *%rax
+}
+  80490c:	48 83 c4 10          	add    $0x10,%rsp
+  804910:	5b                   	pop    %rbx
+  804911:	41 5f                	pop    %r15
+  804913:	5d                   	pop    %rbp
+  804914:	c3                   	ret
+
+0000000000804915 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804915:	55                   	push   %rbp
+  804916:	48 89 e5             	mov    %rsp,%rbp
+  804919:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804919 <sync+0x4>
+  804920:	49 bb 27 47 00 00 00 	movabs $0x4727,%r11
+  804927:	00 00 00 
+  80492a:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  80492d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804932:	be 00 00 00 00       	mov    $0x0,%esi
+  804937:	bf 08 00 00 00       	mov    $0x8,%edi
+  80493c:	48 b9 6c b1 ff ff ff 	movabs $0xffffffffffffb16c,%rcx
+  804943:	ff ff ff 
+  804946:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80494a:	ff d0                	call   *%rax
+}
+  80494c:	5d                   	pop    %rbp
+  80494d:	c3                   	ret
+
+000000000080494e <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  80494e:	55                   	push   %rbp
+  80494f:	48 89 e5             	mov    %rsp,%rbp
+  804952:	41 57                	push   %r15
+  804954:	53                   	push   %rbx
+  804955:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  80495c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80495c <copy+0xe>
+  804963:	49 bb e4 46 00 00 00 	movabs $0x46e4,%r11
+  80496a:	00 00 00 
+  80496d:	4c 01 db             	add    %r11,%rbx
+  804970:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804977:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  80497e:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804985:	be 00 00 00 00       	mov    $0x0,%esi
+  80498a:	48 89 c7             	mov    %rax,%rdi
+  80498d:	48 b8 0b b3 ff ff ff 	movabs $0xffffffffffffb30b,%rax
+  804994:	ff ff ff 
+  804997:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80499b:	ff d0                	call   *%rax
+  80499d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8049a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049a4:	79 35                	jns    8049db <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8049a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049a9:	89 c6                	mov    %eax,%esi
+  8049ab:	48 b8 96 e4 ff ff ff 	movabs $0xffffffffffffe496,%rax
+  8049b2:	ff ff ff 
+  8049b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049b9:	48 89 c7             	mov    %rax,%rdi
+  8049bc:	49 89 df             	mov    %rbx,%r15
+  8049bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049c4:	48 ba 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rdx
+  8049cb:	ff ff ff 
+  8049ce:	48 01 da             	add    %rbx,%rdx
+  8049d1:	ff d2                	call   *%rdx
+		return fd_src;
+  8049d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049d6:	e9 d7 01 00 00       	jmp    804bb2 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8049db:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8049e2:	be 01 01 00 00       	mov    $0x101,%esi
+  8049e7:	48 89 c7             	mov    %rax,%rdi
+  8049ea:	48 b8 0b b3 ff ff ff 	movabs $0xffffffffffffb30b,%rax
+  8049f1:	ff ff ff 
+  8049f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049f8:	ff d0                	call   *%rax
+  8049fa:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  8049fd:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804a01:	0f 89 df 00 00 00    	jns    804ae6 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804a07:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a0a:	89 c6                	mov    %eax,%esi
+  804a0c:	48 b8 ac e4 ff ff ff 	movabs $0xffffffffffffe4ac,%rax
+  804a13:	ff ff ff 
+  804a16:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a1a:	48 89 c7             	mov    %rax,%rdi
+  804a1d:	49 89 df             	mov    %rbx,%r15
+  804a20:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a25:	48 ba 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rdx
+  804a2c:	ff ff ff 
+  804a2f:	48 01 da             	add    %rbx,%rdx
+  804a32:	ff d2                	call   *%rdx
+		close(fd_src);
+  804a34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a37:	89 c7                	mov    %eax,%edi
+  804a39:	49 89 df             	mov    %rbx,%r15
+  804a3c:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  804a43:	ff ff ff 
+  804a46:	48 01 d8             	add    %rbx,%rax
+  804a49:	ff d0                	call   *%rax
+		return fd_dest;
+  804a4b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a4e:	e9 5f 01 00 00       	jmp    804bb2 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804a53:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a56:	48 63 d0             	movslq %eax,%rdx
+  804a59:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804a60:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a63:	48 89 ce             	mov    %rcx,%rsi
+  804a66:	89 c7                	mov    %eax,%edi
+  804a68:	49 89 df             	mov    %rbx,%r15
+  804a6b:	48 b8 e2 ac ff ff ff 	movabs $0xfffffffffffface2,%rax
+  804a72:	ff ff ff 
+  804a75:	48 01 d8             	add    %rbx,%rax
+  804a78:	ff d0                	call   *%rax
+  804a7a:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804a7d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804a81:	79 63                	jns    804ae6 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804a83:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804a86:	89 c6                	mov    %eax,%esi
+  804a88:	48 b8 c6 e4 ff ff ff 	movabs $0xffffffffffffe4c6,%rax
+  804a8f:	ff ff ff 
+  804a92:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a96:	48 89 c7             	mov    %rax,%rdi
+  804a99:	49 89 df             	mov    %rbx,%r15
+  804a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aa1:	48 ba 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rdx
+  804aa8:	ff ff ff 
+  804aab:	48 01 da             	add    %rbx,%rdx
+  804aae:	ff d2                	call   *%rdx
+			close(fd_src);
+  804ab0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ab3:	89 c7                	mov    %eax,%edi
+  804ab5:	49 89 df             	mov    %rbx,%r15
+  804ab8:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  804abf:	ff ff ff 
+  804ac2:	48 01 d8             	add    %rbx,%rax
+  804ac5:	ff d0                	call   *%rax
+			close(fd_dest);
+  804ac7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804aca:	89 c7                	mov    %eax,%edi
+  804acc:	49 89 df             	mov    %rbx,%r15
+  804acf:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  804ad6:	ff ff ff 
+  804ad9:	48 01 d8             	add    %rbx,%rax
+  804adc:	ff d0                	call   *%rax
+			return write_size;
+  804ade:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804ae1:	e9 cc 00 00 00       	jmp    804bb2 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804ae6:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804aed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804af0:	ba 00 02 00 00       	mov    $0x200,%edx
+  804af5:	48 89 ce             	mov    %rcx,%rsi
+  804af8:	89 c7                	mov    %eax,%edi
+  804afa:	49 89 df             	mov    %rbx,%r15
+  804afd:	48 b8 3c ab ff ff ff 	movabs $0xffffffffffffab3c,%rax
+  804b04:	ff ff ff 
+  804b07:	48 01 d8             	add    %rbx,%rax
+  804b0a:	ff d0                	call   *%rax
+  804b0c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804b0f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804b13:	0f 8f 3a ff ff ff    	jg     804a53 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804b19:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804b1d:	79 60                	jns    804b7f <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804b1f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b22:	89 c6                	mov    %eax,%esi
+  804b24:	48 b8 d9 e4 ff ff ff 	movabs $0xffffffffffffe4d9,%rax
+  804b2b:	ff ff ff 
+  804b2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b32:	48 89 c7             	mov    %rax,%rdi
+  804b35:	49 89 df             	mov    %rbx,%r15
+  804b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b3d:	48 ba 12 77 ff ff ff 	movabs $0xffffffffffff7712,%rdx
+  804b44:	ff ff ff 
+  804b47:	48 01 da             	add    %rbx,%rdx
+  804b4a:	ff d2                	call   *%rdx
+		close(fd_src);
+  804b4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b4f:	89 c7                	mov    %eax,%edi
+  804b51:	49 89 df             	mov    %rbx,%r15
+  804b54:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  804b5b:	ff ff ff 
+  804b5e:	48 01 d8             	add    %rbx,%rax
+  804b61:	ff d0                	call   *%rax
+		close(fd_dest);
+  804b63:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b66:	89 c7                	mov    %eax,%edi
+  804b68:	49 89 df             	mov    %rbx,%r15
+  804b6b:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  804b72:	ff ff ff 
+  804b75:	48 01 d8             	add    %rbx,%rax
+  804b78:	ff d0                	call   *%rax
+		return read_size;
+  804b7a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b7d:	eb 33                	jmp    804bb2 <copy+0x264>
+	}
+	close(fd_src);
+  804b7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b82:	89 c7                	mov    %eax,%edi
+  804b84:	49 89 df             	mov    %rbx,%r15
+  804b87:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  804b8e:	ff ff ff 
+  804b91:	48 01 d8             	add    %rbx,%rax
+  804b94:	ff d0                	call   *%rax
+	close(fd_dest);
+  804b96:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b99:	89 c7                	mov    %eax,%edi
+  804b9b:	49 89 df             	mov    %rbx,%r15
+  804b9e:	48 b8 84 a8 ff ff ff 	movabs $0xffffffffffffa884,%rax
+  804ba5:	ff ff ff 
+  804ba8:	48 01 d8             	add    %rbx,%rax
+  804bab:	ff d0                	call   *%rax
+	return 0;
+  804bad:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804bb2:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804bb9:	5b                   	pop    %rbx
+  804bba:	41 5f                	pop    %r15
+  804bbc:	5d                   	pop    %rbp
+  804bbd:	c3                   	ret
+
+0000000000804bbe <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804bbe:	55                   	push   %rbp
+  804bbf:	48 89 e5             	mov    %rsp,%rbp
+  804bc2:	41 57                	push   %r15
+  804bc4:	53                   	push   %rbx
+  804bc5:	48 83 ec 20          	sub    $0x20,%rsp
+  804bc9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804bc9 <fd2sockid+0xb>
+  804bd0:	49 bb 77 44 00 00 00 	movabs $0x4477,%r11
+  804bd7:	00 00 00 
+  804bda:	4c 01 db             	add    %r11,%rbx
+  804bdd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804be0:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804be4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804be7:	48 89 d6             	mov    %rdx,%rsi
+  804bea:	89 c7                	mov    %eax,%edi
+  804bec:	49 89 df             	mov    %rbx,%r15
+  804bef:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  804bf6:	ff ff ff 
+  804bf9:	48 01 d8             	add    %rbx,%rax
+  804bfc:	ff d0                	call   *%rax
+  804bfe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c01:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c05:	79 05                	jns    804c0c <fd2sockid+0x4e>
+		return r;
+  804c07:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c0a:	eb 25                	jmp    804c31 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804c0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c10:	8b 10                	mov    (%rax),%edx
+  804c12:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  804c19:	00 00 00 
+  804c1c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c1f:	39 c2                	cmp    %eax,%edx
+  804c21:	74 07                	je     804c2a <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804c23:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804c28:	eb 07                	jmp    804c31 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804c2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c2e:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804c31:	48 83 c4 20          	add    $0x20,%rsp
+  804c35:	5b                   	pop    %rbx
+  804c36:	41 5f                	pop    %r15
+  804c38:	5d                   	pop    %rbp
+  804c39:	c3                   	ret
+
+0000000000804c3a <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804c3a:	55                   	push   %rbp
+  804c3b:	48 89 e5             	mov    %rsp,%rbp
+  804c3e:	41 57                	push   %r15
+  804c40:	53                   	push   %rbx
+  804c41:	48 83 ec 20          	sub    $0x20,%rsp
+  804c45:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c45 <alloc_sockfd+0xb>
+  804c4c:	49 bb fb 43 00 00 00 	movabs $0x43fb,%r11
+  804c53:	00 00 00 
+  804c56:	4c 01 db             	add    %r11,%rbx
+  804c59:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804c5c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804c60:	48 89 c7             	mov    %rax,%rdi
+  804c63:	49 89 df             	mov    %rbx,%r15
+  804c66:	48 b8 3f a5 ff ff ff 	movabs $0xffffffffffffa53f,%rax
+  804c6d:	ff ff ff 
+  804c70:	48 01 d8             	add    %rbx,%rax
+  804c73:	ff d0                	call   *%rax
+  804c75:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c78:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c7c:	78 2c                	js     804caa <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804c7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c82:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c87:	48 89 c6             	mov    %rax,%rsi
+  804c8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c8f:	49 89 df             	mov    %rbx,%r15
+  804c92:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  804c99:	ff ff ff 
+  804c9c:	48 01 d8             	add    %rbx,%rax
+  804c9f:	ff d0                	call   *%rax
+  804ca1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ca4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ca8:	79 1c                	jns    804cc6 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804caa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804cad:	89 c7                	mov    %eax,%edi
+  804caf:	49 89 df             	mov    %rbx,%r15
+  804cb2:	48 b8 ee c3 ff ff ff 	movabs $0xffffffffffffc3ee,%rax
+  804cb9:	ff ff ff 
+  804cbc:	48 01 d8             	add    %rbx,%rax
+  804cbf:	ff d0                	call   *%rax
+		return r;
+  804cc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cc4:	eb 41                	jmp    804d07 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804cc6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cca:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  804cd1:	00 00 00 
+  804cd4:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804cd7:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804cd9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cdd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804ce4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ce8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804ceb:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804cee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cf2:	48 89 c7             	mov    %rax,%rdi
+  804cf5:	49 89 df             	mov    %rbx,%r15
+  804cf8:	48 b8 c5 a4 ff ff ff 	movabs $0xffffffffffffa4c5,%rax
+  804cff:	ff ff ff 
+  804d02:	48 01 d8             	add    %rbx,%rax
+  804d05:	ff d0                	call   *%rax
+}
+  804d07:	48 83 c4 20          	add    $0x20,%rsp
+  804d0b:	5b                   	pop    %rbx
+  804d0c:	41 5f                	pop    %r15
+  804d0e:	5d                   	pop    %rbp
+  804d0f:	c3                   	ret
+
+0000000000804d10 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804d10:	55                   	push   %rbp
+  804d11:	48 89 e5             	mov    %rsp,%rbp
+  804d14:	41 57                	push   %r15
+  804d16:	53                   	push   %rbx
+  804d17:	48 83 ec 30          	sub    $0x30,%rsp
+  804d1b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d1b <accept+0xb>
+  804d22:	49 bb 25 43 00 00 00 	movabs $0x4325,%r11
+  804d29:	00 00 00 
+  804d2c:	4c 01 db             	add    %r11,%rbx
+  804d2f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804d32:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804d36:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804d3a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804d3d:	89 c7                	mov    %eax,%edi
+  804d3f:	48 b8 7e bb ff ff ff 	movabs $0xffffffffffffbb7e,%rax
+  804d46:	ff ff ff 
+  804d49:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d4d:	ff d0                	call   *%rax
+  804d4f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d52:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d56:	79 05                	jns    804d5d <accept+0x4d>
+		return r;
+  804d58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d5b:	eb 45                	jmp    804da2 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804d5d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d61:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804d65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d68:	48 89 ce             	mov    %rcx,%rsi
+  804d6b:	89 c7                	mov    %eax,%edi
+  804d6d:	49 89 df             	mov    %rbx,%r15
+  804d70:	48 b8 5c c2 ff ff ff 	movabs $0xffffffffffffc25c,%rax
+  804d77:	ff ff ff 
+  804d7a:	48 01 d8             	add    %rbx,%rax
+  804d7d:	ff d0                	call   *%rax
+  804d7f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d82:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d86:	79 05                	jns    804d8d <accept+0x7d>
+		return r;
+  804d88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d8b:	eb 15                	jmp    804da2 <accept+0x92>
+	return alloc_sockfd(r);
+  804d8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d90:	89 c7                	mov    %eax,%edi
+  804d92:	48 b8 fa bb ff ff ff 	movabs $0xffffffffffffbbfa,%rax
+  804d99:	ff ff ff 
+  804d9c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804da0:	ff d0                	call   *%rax
+}
+  804da2:	48 83 c4 30          	add    $0x30,%rsp
+  804da6:	5b                   	pop    %rbx
+  804da7:	41 5f                	pop    %r15
+  804da9:	5d                   	pop    %rbp
+  804daa:	c3                   	ret
+
+0000000000804dab <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804dab:	55                   	push   %rbp
+  804dac:	48 89 e5             	mov    %rsp,%rbp
+  804daf:	41 57                	push   %r15
+  804db1:	53                   	push   %rbx
+  804db2:	48 83 ec 20          	sub    $0x20,%rsp
+  804db6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804db6 <bind+0xb>
+  804dbd:	49 bb 8a 42 00 00 00 	movabs $0x428a,%r11
+  804dc4:	00 00 00 
+  804dc7:	4c 01 db             	add    %r11,%rbx
+  804dca:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804dcd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804dd1:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804dd4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804dd7:	89 c7                	mov    %eax,%edi
+  804dd9:	48 b8 7e bb ff ff ff 	movabs $0xffffffffffffbb7e,%rax
+  804de0:	ff ff ff 
+  804de3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804de7:	ff d0                	call   *%rax
+  804de9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804dec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804df0:	79 05                	jns    804df7 <bind+0x4c>
+		return r;
+  804df2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804df5:	eb 21                	jmp    804e18 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804df7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804dfa:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804dfe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e01:	48 89 ce             	mov    %rcx,%rsi
+  804e04:	89 c7                	mov    %eax,%edi
+  804e06:	49 89 df             	mov    %rbx,%r15
+  804e09:	48 b8 08 c3 ff ff ff 	movabs $0xffffffffffffc308,%rax
+  804e10:	ff ff ff 
+  804e13:	48 01 d8             	add    %rbx,%rax
+  804e16:	ff d0                	call   *%rax
+}
+  804e18:	48 83 c4 20          	add    $0x20,%rsp
+  804e1c:	5b                   	pop    %rbx
+  804e1d:	41 5f                	pop    %r15
+  804e1f:	5d                   	pop    %rbp
+  804e20:	c3                   	ret
+
+0000000000804e21 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804e21:	55                   	push   %rbp
+  804e22:	48 89 e5             	mov    %rsp,%rbp
+  804e25:	41 57                	push   %r15
+  804e27:	53                   	push   %rbx
+  804e28:	48 83 ec 20          	sub    $0x20,%rsp
+  804e2c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e2c <shutdown+0xb>
+  804e33:	49 bb 14 42 00 00 00 	movabs $0x4214,%r11
+  804e3a:	00 00 00 
+  804e3d:	4c 01 db             	add    %r11,%rbx
+  804e40:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e43:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804e46:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e49:	89 c7                	mov    %eax,%edi
+  804e4b:	48 b8 7e bb ff ff ff 	movabs $0xffffffffffffbb7e,%rax
+  804e52:	ff ff ff 
+  804e55:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e59:	ff d0                	call   *%rax
+  804e5b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e5e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e62:	79 05                	jns    804e69 <shutdown+0x48>
+		return r;
+  804e64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e67:	eb 1c                	jmp    804e85 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804e69:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804e6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e6f:	89 d6                	mov    %edx,%esi
+  804e71:	89 c7                	mov    %eax,%edi
+  804e73:	49 89 df             	mov    %rbx,%r15
+  804e76:	48 b8 9d c3 ff ff ff 	movabs $0xffffffffffffc39d,%rax
+  804e7d:	ff ff ff 
+  804e80:	48 01 d8             	add    %rbx,%rax
+  804e83:	ff d0                	call   *%rax
+}
+  804e85:	48 83 c4 20          	add    $0x20,%rsp
+  804e89:	5b                   	pop    %rbx
+  804e8a:	41 5f                	pop    %r15
+  804e8c:	5d                   	pop    %rbp
+  804e8d:	c3                   	ret
+
+0000000000804e8e <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804e8e:	55                   	push   %rbp
+  804e8f:	48 89 e5             	mov    %rsp,%rbp
+  804e92:	41 57                	push   %r15
+  804e94:	53                   	push   %rbx
+  804e95:	48 83 ec 10          	sub    $0x10,%rsp
+  804e99:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e99 <devsock_close+0xb>
+  804ea0:	49 bb a7 41 00 00 00 	movabs $0x41a7,%r11
+  804ea7:	00 00 00 
+  804eaa:	4c 01 db             	add    %r11,%rbx
+  804ead:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804eb1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eb5:	48 89 c7             	mov    %rax,%rdi
+  804eb8:	49 89 df             	mov    %rbx,%r15
+  804ebb:	48 b8 1c dd ff ff ff 	movabs $0xffffffffffffdd1c,%rax
+  804ec2:	ff ff ff 
+  804ec5:	48 01 d8             	add    %rbx,%rax
+  804ec8:	ff d0                	call   *%rax
+  804eca:	83 f8 01             	cmp    $0x1,%eax
+  804ecd:	75 1d                	jne    804eec <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804ecf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed3:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ed6:	89 c7                	mov    %eax,%edi
+  804ed8:	49 89 df             	mov    %rbx,%r15
+  804edb:	48 b8 ee c3 ff ff ff 	movabs $0xffffffffffffc3ee,%rax
+  804ee2:	ff ff ff 
+  804ee5:	48 01 d8             	add    %rbx,%rax
+  804ee8:	ff d0                	call   *%rax
+  804eea:	eb 05                	jmp    804ef1 <devsock_close+0x63>
+	else
+		return 0;
+  804eec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ef1:	48 83 c4 10          	add    $0x10,%rsp
+  804ef5:	5b                   	pop    %rbx
+  804ef6:	41 5f                	pop    %r15
+  804ef8:	5d                   	pop    %rbp
+  804ef9:	c3                   	ret
+
+0000000000804efa <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804efa:	55                   	push   %rbp
+  804efb:	48 89 e5             	mov    %rsp,%rbp
+  804efe:	41 57                	push   %r15
+  804f00:	53                   	push   %rbx
+  804f01:	48 83 ec 20          	sub    $0x20,%rsp
+  804f05:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f05 <connect+0xb>
+  804f0c:	49 bb 3b 41 00 00 00 	movabs $0x413b,%r11
+  804f13:	00 00 00 
+  804f16:	4c 01 db             	add    %r11,%rbx
+  804f19:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f1c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804f20:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804f23:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f26:	89 c7                	mov    %eax,%edi
+  804f28:	48 b8 7e bb ff ff ff 	movabs $0xffffffffffffbb7e,%rax
+  804f2f:	ff ff ff 
+  804f32:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f36:	ff d0                	call   *%rax
+  804f38:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f3b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f3f:	79 05                	jns    804f46 <connect+0x4c>
+		return r;
+  804f41:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f44:	eb 21                	jmp    804f67 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804f46:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804f49:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804f4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f50:	48 89 ce             	mov    %rcx,%rsi
+  804f53:	89 c7                	mov    %eax,%edi
+  804f55:	49 89 df             	mov    %rbx,%r15
+  804f58:	48 b8 36 c4 ff ff ff 	movabs $0xffffffffffffc436,%rax
+  804f5f:	ff ff ff 
+  804f62:	48 01 d8             	add    %rbx,%rax
+  804f65:	ff d0                	call   *%rax
+}
+  804f67:	48 83 c4 20          	add    $0x20,%rsp
+  804f6b:	5b                   	pop    %rbx
+  804f6c:	41 5f                	pop    %r15
+  804f6e:	5d                   	pop    %rbp
+  804f6f:	c3                   	ret
+
+0000000000804f70 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804f70:	55                   	push   %rbp
+  804f71:	48 89 e5             	mov    %rsp,%rbp
+  804f74:	41 57                	push   %r15
+  804f76:	53                   	push   %rbx
+  804f77:	48 83 ec 20          	sub    $0x20,%rsp
+  804f7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f7b <listen+0xb>
+  804f82:	49 bb c5 40 00 00 00 	movabs $0x40c5,%r11
+  804f89:	00 00 00 
+  804f8c:	4c 01 db             	add    %r11,%rbx
+  804f8f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f92:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804f95:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f98:	89 c7                	mov    %eax,%edi
+  804f9a:	48 b8 7e bb ff ff ff 	movabs $0xffffffffffffbb7e,%rax
+  804fa1:	ff ff ff 
+  804fa4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fa8:	ff d0                	call   *%rax
+  804faa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fad:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fb1:	79 05                	jns    804fb8 <listen+0x48>
+		return r;
+  804fb3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fb6:	eb 1c                	jmp    804fd4 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804fb8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804fbb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fbe:	89 d6                	mov    %edx,%esi
+  804fc0:	89 c7                	mov    %eax,%edi
+  804fc2:	49 89 df             	mov    %rbx,%r15
+  804fc5:	48 b8 cb c4 ff ff ff 	movabs $0xffffffffffffc4cb,%rax
+  804fcc:	ff ff ff 
+  804fcf:	48 01 d8             	add    %rbx,%rax
+  804fd2:	ff d0                	call   *%rax
+}
+  804fd4:	48 83 c4 20          	add    $0x20,%rsp
+  804fd8:	5b                   	pop    %rbx
+  804fd9:	41 5f                	pop    %r15
+  804fdb:	5d                   	pop    %rbp
+  804fdc:	c3                   	ret
+
+0000000000804fdd <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804fdd:	55                   	push   %rbp
+  804fde:	48 89 e5             	mov    %rsp,%rbp
+  804fe1:	41 57                	push   %r15
+  804fe3:	48 83 ec 28          	sub    $0x28,%rsp
+  804fe7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804fe7 <devsock_read+0xa>
+  804fee:	49 bb 59 40 00 00 00 	movabs $0x4059,%r11
+  804ff5:	00 00 00 
+  804ff8:	4c 01 d8             	add    %r11,%rax
+  804ffb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804fff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805003:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805007:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80500b:	41 89 d0             	mov    %edx,%r8d
+  80500e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805012:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805015:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805019:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80501e:	44 89 c2             	mov    %r8d,%edx
+  805021:	49 89 c7             	mov    %rax,%r15
+  805024:	49 b8 1c c5 ff ff ff 	movabs $0xffffffffffffc51c,%r8
+  80502b:	ff ff ff 
+  80502e:	49 01 c0             	add    %rax,%r8
+  805031:	41 ff d0             	call   *%r8
+}
+  805034:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805038:	c9                   	leave
+  805039:	c3                   	ret
+
+000000000080503a <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80503a:	55                   	push   %rbp
+  80503b:	48 89 e5             	mov    %rsp,%rbp
+  80503e:	41 57                	push   %r15
+  805040:	48 83 ec 28          	sub    $0x28,%rsp
+  805044:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805044 <devsock_write+0xa>
+  80504b:	49 bb fc 3f 00 00 00 	movabs $0x3ffc,%r11
+  805052:	00 00 00 
+  805055:	4c 01 d8             	add    %r11,%rax
+  805058:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80505c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805060:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805064:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805068:	41 89 d0             	mov    %edx,%r8d
+  80506b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80506f:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805072:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805076:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80507b:	44 89 c2             	mov    %r8d,%edx
+  80507e:	49 89 c7             	mov    %rax,%r15
+  805081:	49 b8 39 c6 ff ff ff 	movabs $0xffffffffffffc639,%r8
+  805088:	ff ff ff 
+  80508b:	49 01 c0             	add    %rax,%r8
+  80508e:	41 ff d0             	call   *%r8
+}
+  805091:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805095:	c9                   	leave
+  805096:	c3                   	ret
+
+0000000000805097 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805097:	55                   	push   %rbp
+  805098:	48 89 e5             	mov    %rsp,%rbp
+  80509b:	41 57                	push   %r15
+  80509d:	48 83 ec 18          	sub    $0x18,%rsp
+  8050a1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050a1 <devsock_stat+0xa>
+  8050a8:	49 bb 9f 3f 00 00 00 	movabs $0x3f9f,%r11
+  8050af:	00 00 00 
+  8050b2:	4c 01 d8             	add    %r11,%rax
+  8050b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8050b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8050bd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8050c1:	48 b9 f4 e4 ff ff ff 	movabs $0xffffffffffffe4f4,%rcx
+  8050c8:	ff ff ff 
+  8050cb:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8050cf:	48 89 ce             	mov    %rcx,%rsi
+  8050d2:	48 89 d7             	mov    %rdx,%rdi
+  8050d5:	49 89 c7             	mov    %rax,%r15
+  8050d8:	48 ba d4 84 ff ff ff 	movabs $0xffffffffffff84d4,%rdx
+  8050df:	ff ff ff 
+  8050e2:	48 01 c2             	add    %rax,%rdx
+  8050e5:	ff d2                	call   *%rdx
+	return 0;
+  8050e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050ec:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8050f0:	c9                   	leave
+  8050f1:	c3                   	ret
+
+00000000008050f2 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8050f2:	55                   	push   %rbp
+  8050f3:	48 89 e5             	mov    %rsp,%rbp
+  8050f6:	41 57                	push   %r15
+  8050f8:	53                   	push   %rbx
+  8050f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8050fd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050fd <socket+0xb>
+  805104:	49 bb 43 3f 00 00 00 	movabs $0x3f43,%r11
+  80510b:	00 00 00 
+  80510e:	4c 01 db             	add    %r11,%rbx
+  805111:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805114:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805117:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80511a:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80511d:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805120:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805123:	89 ce                	mov    %ecx,%esi
+  805125:	89 c7                	mov    %eax,%edi
+  805127:	49 89 df             	mov    %rbx,%r15
+  80512a:	48 b8 10 c8 ff ff ff 	movabs $0xffffffffffffc810,%rax
+  805131:	ff ff ff 
+  805134:	48 01 d8             	add    %rbx,%rax
+  805137:	ff d0                	call   *%rax
+  805139:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80513c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805140:	79 05                	jns    805147 <socket+0x55>
+		return r;
+  805142:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805145:	eb 15                	jmp    80515c <socket+0x6a>
+	return alloc_sockfd(r);
+  805147:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80514a:	89 c7                	mov    %eax,%edi
+  80514c:	48 b8 fa bb ff ff ff 	movabs $0xffffffffffffbbfa,%rax
+  805153:	ff ff ff 
+  805156:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80515a:	ff d0                	call   *%rax
+}
+  80515c:	48 83 c4 20          	add    $0x20,%rsp
+  805160:	5b                   	pop    %rbx
+  805161:	41 5f                	pop    %r15
+  805163:	5d                   	pop    %rbp
+  805164:	c3                   	ret
+
+0000000000805165 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805165:	55                   	push   %rbp
+  805166:	48 89 e5             	mov    %rsp,%rbp
+  805169:	41 57                	push   %r15
+  80516b:	53                   	push   %rbx
+  80516c:	48 83 ec 10          	sub    $0x10,%rsp
+  805170:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805170 <nsipc+0xb>
+  805177:	49 bb d0 3e 00 00 00 	movabs $0x3ed0,%r11
+  80517e:	00 00 00 
+  805181:	4c 01 db             	add    %r11,%rbx
+  805184:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805187:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80518e:	00 00 00 
+  805191:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805194:	85 c0                	test   %eax,%eax
+  805196:	75 24                	jne    8051bc <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805198:	bf 02 00 00 00       	mov    $0x2,%edi
+  80519d:	49 89 df             	mov    %rbx,%r15
+  8051a0:	48 b8 8d dc ff ff ff 	movabs $0xffffffffffffdc8d,%rax
+  8051a7:	ff ff ff 
+  8051aa:	48 01 d8             	add    %rbx,%rax
+  8051ad:	ff d0                	call   *%rax
+  8051af:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8051b6:	00 00 00 
+  8051b9:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  8051bc:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8051c3:	00 00 00 
+  8051c6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8051c9:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8051cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8051d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8051d8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8051dd:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8051e4:	00 00 00 
+  8051e7:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8051eb:	89 c7                	mov    %eax,%edi
+  8051ed:	49 89 df             	mov    %rbx,%r15
+  8051f0:	48 b8 ac d6 ff ff ff 	movabs $0xffffffffffffd6ac,%rax
+  8051f7:	ff ff ff 
+  8051fa:	48 01 d8             	add    %rbx,%rax
+  8051fd:	ff d0                	call   *%rax
+}
+  8051ff:	48 83 c4 10          	add    $0x10,%rsp
+  805203:	5b                   	pop    %rbx
+  805204:	41 5f                	pop    %r15
+  805206:	5d                   	pop    %rbp
+  805207:	c3                   	ret
+
+0000000000805208 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805208:	55                   	push   %rbp
+  805209:	48 89 e5             	mov    %rsp,%rbp
+  80520c:	41 57                	push   %r15
+  80520e:	53                   	push   %rbx
+  80520f:	48 83 ec 20          	sub    $0x20,%rsp
+  805213:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805213 <nsipc_words+0xb>
+  80521a:	49 bb 2d 3e 00 00 00 	movabs $0x3e2d,%r11
+  805221:	00 00 00 
+  805224:	4c 01 db             	add    %r11,%rbx
+  805227:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80522a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80522e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805232:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805239:	00 00 00 
+  80523c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80523f:	85 c0                	test   %eax,%eax
+  805241:	75 24                	jne    805267 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805243:	bf 02 00 00 00       	mov    $0x2,%edi
+  805248:	49 89 df             	mov    %rbx,%r15
+  80524b:	48 b8 8d dc ff ff ff 	movabs $0xffffffffffffdc8d,%rax
+  805252:	ff ff ff 
+  805255:	48 01 d8             	add    %rbx,%rax
+  805258:	ff d0                	call   *%rax
+  80525a:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805261:	00 00 00 
+  805264:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805267:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80526e:	00 00 00 
+  805271:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805274:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805278:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80527c:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80527f:	89 c7                	mov    %eax,%edi
+  805281:	49 89 df             	mov    %rbx,%r15
+  805284:	48 b8 97 d7 ff ff ff 	movabs $0xffffffffffffd797,%rax
+  80528b:	ff ff ff 
+  80528e:	48 01 d8             	add    %rbx,%rax
+  805291:	ff d0                	call   *%rax
+}
+  805293:	48 83 c4 20          	add    $0x20,%rsp
+  805297:	5b                   	pop    %rbx
+  805298:	41 5f                	pop    %r15
+  80529a:	5d                   	pop    %rbp
+  80529b:	c3                   	ret
+
+000000000080529c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80529c:	55                   	push   %rbp
+  80529d:	48 89 e5             	mov    %rsp,%rbp
+  8052a0:	41 57                	push   %r15
+  8052a2:	53                   	push   %rbx
+  8052a3:	48 83 ec 30          	sub    $0x30,%rsp
+  8052a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052a7 <nsipc_accept+0xb>
+  8052ae:	49 bb 99 3d 00 00 00 	movabs $0x3d99,%r11
+  8052b5:	00 00 00 
+  8052b8:	4c 01 db             	add    %r11,%rbx
+  8052bb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8052be:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8052c2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8052c6:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8052cd:	00 00 00 
+  8052d0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052d3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8052d6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8052db:	48 b8 25 c1 ff ff ff 	movabs $0xffffffffffffc125,%rax
+  8052e2:	ff ff ff 
+  8052e5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052e9:	ff d0                	call   *%rax
+  8052eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052f2:	78 48                	js     80533c <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8052f4:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  8052fb:	00 00 00 
+  8052fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805302:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805306:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80530a:	8b 40 10             	mov    0x10(%rax),%eax
+  80530d:	89 c2                	mov    %eax,%edx
+  80530f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805313:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805317:	48 89 ce             	mov    %rcx,%rsi
+  80531a:	48 89 c7             	mov    %rax,%rdi
+  80531d:	49 89 df             	mov    %rbx,%r15
+  805320:	48 b8 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rax
+  805327:	ff ff ff 
+  80532a:	48 01 d8             	add    %rbx,%rax
+  80532d:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80532f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805333:	8b 50 10             	mov    0x10(%rax),%edx
+  805336:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80533a:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  80533c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80533f:	48 83 c4 30          	add    $0x30,%rsp
+  805343:	5b                   	pop    %rbx
+  805344:	41 5f                	pop    %r15
+  805346:	5d                   	pop    %rbp
+  805347:	c3                   	ret
+
+0000000000805348 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805348:	55                   	push   %rbp
+  805349:	48 89 e5             	mov    %rsp,%rbp
+  80534c:	41 57                	push   %r15
+  80534e:	53                   	push   %rbx
+  80534f:	48 83 ec 10          	sub    $0x10,%rsp
+  805353:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805353 <nsipc_bind+0xb>
+  80535a:	49 bb ed 3c 00 00 00 	movabs $0x3ced,%r11
+  805361:	00 00 00 
+  805364:	4c 01 db             	add    %r11,%rbx
+  805367:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80536a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80536e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805371:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805378:	00 00 00 
+  80537b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80537e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805381:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805384:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805388:	48 89 c6             	mov    %rax,%rsi
+  80538b:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805392:	00 00 00 
+  805395:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805399:	48 89 c7             	mov    %rax,%rdi
+  80539c:	49 89 df             	mov    %rbx,%r15
+  80539f:	48 b8 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rax
+  8053a6:	ff ff ff 
+  8053a9:	48 01 d8             	add    %rbx,%rax
+  8053ac:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8053ae:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8053b5:	00 00 00 
+  8053b8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053bb:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8053bf:	bf 02 00 00 00       	mov    $0x2,%edi
+  8053c4:	48 b8 25 c1 ff ff ff 	movabs $0xffffffffffffc125,%rax
+  8053cb:	ff ff ff 
+  8053ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053d2:	ff d0                	call   *%rax
+}
+  8053d4:	48 83 c4 10          	add    $0x10,%rsp
+  8053d8:	5b                   	pop    %rbx
+  8053d9:	41 5f                	pop    %r15
+  8053db:	5d                   	pop    %rbp
+  8053dc:	c3                   	ret
+
+00000000008053dd <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8053dd:	55                   	push   %rbp
+  8053de:	48 89 e5             	mov    %rsp,%rbp
+  8053e1:	48 83 ec 20          	sub    $0x20,%rsp
+  8053e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8053e5 <nsipc_shutdown+0x8>
+  8053ec:	49 bb 5b 3c 00 00 00 	movabs $0x3c5b,%r11
+  8053f3:	00 00 00 
+  8053f6:	4c 01 d8             	add    %r11,%rax
+  8053f9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8053fc:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8053ff:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805402:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805405:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805408:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80540b:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80540f:	ba 08 00 00 00       	mov    $0x8,%edx
+  805414:	48 89 ce             	mov    %rcx,%rsi
+  805417:	bf 03 00 00 00       	mov    $0x3,%edi
+  80541c:	48 b9 c8 c1 ff ff ff 	movabs $0xffffffffffffc1c8,%rcx
+  805423:	ff ff ff 
+  805426:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80542a:	ff d0                	call   *%rax
+}
+  80542c:	c9                   	leave
+  80542d:	c3                   	ret
+
+000000000080542e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80542e:	55                   	push   %rbp
+  80542f:	48 89 e5             	mov    %rsp,%rbp
+  805432:	48 83 ec 20          	sub    $0x20,%rsp
+  805436:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805436 <nsipc_close+0x8>
+  80543d:	49 bb 0a 3c 00 00 00 	movabs $0x3c0a,%r11
+  805444:	00 00 00 
+  805447:	4c 01 d8             	add    %r11,%rax
+  80544a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80544d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805450:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805453:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805457:	ba 04 00 00 00       	mov    $0x4,%edx
+  80545c:	48 89 ce             	mov    %rcx,%rsi
+  80545f:	bf 04 00 00 00       	mov    $0x4,%edi
+  805464:	48 b9 c8 c1 ff ff ff 	movabs $0xffffffffffffc1c8,%rcx
+  80546b:	ff ff ff 
+  80546e:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805472:	ff d0                	call   *%rax
+}
+  805474:	c9                   	leave
+  805475:	c3                   	ret
+
+0000000000805476 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805476:	55                   	push   %rbp
+  805477:	48 89 e5             	mov    %rsp,%rbp
+  80547a:	41 57                	push   %r15
+  80547c:	53                   	push   %rbx
+  80547d:	48 83 ec 10          	sub    $0x10,%rsp
+  805481:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805481 <nsipc_connect+0xb>
+  805488:	49 bb bf 3b 00 00 00 	movabs $0x3bbf,%r11
+  80548f:	00 00 00 
+  805492:	4c 01 db             	add    %r11,%rbx
+  805495:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805498:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80549c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  80549f:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8054a6:	00 00 00 
+  8054a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054ac:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8054af:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8054b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054b6:	48 89 c6             	mov    %rax,%rsi
+  8054b9:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  8054c0:	00 00 00 
+  8054c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054c7:	48 89 c7             	mov    %rax,%rdi
+  8054ca:	49 89 df             	mov    %rbx,%r15
+  8054cd:	48 b8 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rax
+  8054d4:	ff ff ff 
+  8054d7:	48 01 d8             	add    %rbx,%rax
+  8054da:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8054dc:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8054e3:	00 00 00 
+  8054e6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8054e9:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8054ed:	bf 05 00 00 00       	mov    $0x5,%edi
+  8054f2:	48 b8 25 c1 ff ff ff 	movabs $0xffffffffffffc125,%rax
+  8054f9:	ff ff ff 
+  8054fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805500:	ff d0                	call   *%rax
+}
+  805502:	48 83 c4 10          	add    $0x10,%rsp
+  805506:	5b                   	pop    %rbx
+  805507:	41 5f                	pop    %r15
+  805509:	5d                   	pop    %rbp
+  80550a:	c3                   	ret
+
+000000000080550b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80550b:	55                   	push   %rbp
+  80550c:	48 89 e5             	mov    %rsp,%rbp
+  80550f:	48 83 ec 20          	sub    $0x20,%rsp
+  805513:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805513 <nsipc_listen+0x8>
+  80551a:	49 bb 2d 3b 00 00 00 	movabs $0x3b2d,%r11
+  805521:	00 00 00 
+  805524:	4c 01 d8             	add    %r11,%rax
+  805527:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80552a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  80552d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805530:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805533:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805536:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805539:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80553d:	ba 08 00 00 00       	mov    $0x8,%edx
+  805542:	48 89 ce             	mov    %rcx,%rsi
+  805545:	bf 06 00 00 00       	mov    $0x6,%edi
+  80554a:	48 b9 c8 c1 ff ff ff 	movabs $0xffffffffffffc1c8,%rcx
+  805551:	ff ff ff 
+  805554:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805558:	ff d0                	call   *%rax
+}
+  80555a:	c9                   	leave
+  80555b:	c3                   	ret
+
+000000000080555c <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80555c:	55                   	push   %rbp
+  80555d:	48 89 e5             	mov    %rsp,%rbp
+  805560:	41 57                	push   %r15
+  805562:	53                   	push   %rbx
+  805563:	48 83 ec 30          	sub    $0x30,%rsp
+  805567:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805567 <nsipc_recv+0xb>
+  80556e:	49 bb d9 3a 00 00 00 	movabs $0x3ad9,%r11
+  805575:	00 00 00 
+  805578:	4c 01 db             	add    %r11,%rbx
+  80557b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80557e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805582:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805585:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805588:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80558f:	00 00 00 
+  805592:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805595:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805598:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  80559f:	00 00 00 
+  8055a2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8055a5:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8055a9:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8055b0:	00 00 00 
+  8055b3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8055b6:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8055ba:	bf 07 00 00 00       	mov    $0x7,%edi
+  8055bf:	48 b8 25 c1 ff ff ff 	movabs $0xffffffffffffc125,%rax
+  8055c6:	ff ff ff 
+  8055c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055cd:	ff d0                	call   *%rax
+  8055cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055d6:	0f 88 91 00 00 00    	js     80566d <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8055dc:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8055e3:	7f 08                	jg     8055ed <nsipc_recv+0x91>
+  8055e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055e8:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8055eb:	7e 50                	jle    80563d <nsipc_recv+0xe1>
+  8055ed:	48 b8 fb e4 ff ff ff 	movabs $0xffffffffffffe4fb,%rax
+  8055f4:	ff ff ff 
+  8055f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055fb:	48 89 c1             	mov    %rax,%rcx
+  8055fe:	48 b8 10 e5 ff ff ff 	movabs $0xffffffffffffe510,%rax
+  805605:	ff ff ff 
+  805608:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80560c:	48 89 c2             	mov    %rax,%rdx
+  80560f:	be 79 00 00 00       	mov    $0x79,%esi
+  805614:	48 b8 25 e5 ff ff ff 	movabs $0xffffffffffffe525,%rax
+  80561b:	ff ff ff 
+  80561e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805622:	48 89 c7             	mov    %rax,%rdi
+  805625:	49 89 df             	mov    %rbx,%r15
+  805628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80562d:	49 b8 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%r8
+  805634:	ff ff ff 
+  805637:	49 01 d8             	add    %rbx,%r8
+  80563a:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80563d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805640:	48 63 d0             	movslq %eax,%rdx
+  805643:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805647:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80564e:	00 00 00 
+  805651:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805655:	48 89 ce             	mov    %rcx,%rsi
+  805658:	48 89 c7             	mov    %rax,%rdi
+  80565b:	49 89 df             	mov    %rbx,%r15
+  80565e:	48 b8 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rax
+  805665:	ff ff ff 
+  805668:	48 01 d8             	add    %rbx,%rax
+  80566b:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80566d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805670:	48 83 c4 30          	add    $0x30,%rsp
+  805674:	5b                   	pop    %rbx
+  805675:	41 5f                	pop    %r15
+  805677:	5d                   	pop    %rbp
+  805678:	c3                   	ret
+
+0000000000805679 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805679:	55                   	push   %rbp
+  80567a:	48 89 e5             	mov    %rsp,%rbp
+  80567d:	41 57                	push   %r15
+  80567f:	53                   	push   %rbx
+  805680:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805687:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805687 <nsipc_send+0xe>
+  80568e:	49 bb b9 39 00 00 00 	movabs $0x39b9,%r11
+  805695:	00 00 00 
+  805698:	4c 01 db             	add    %r11,%rbx
+  80569b:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8056a1:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8056a8:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8056ae:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8056b4:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8056b8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  8056bc:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8056c3:	00 00 00 
+  8056c6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056c9:	85 c0                	test   %eax,%eax
+  8056cb:	75 24                	jne    8056f1 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8056cd:	bf 02 00 00 00       	mov    $0x2,%edi
+  8056d2:	49 89 df             	mov    %rbx,%r15
+  8056d5:	48 b8 8d dc ff ff ff 	movabs $0xffffffffffffdc8d,%rax
+  8056dc:	ff ff ff 
+  8056df:	48 01 d8             	add    %rbx,%rax
+  8056e2:	ff d0                	call   *%rax
+  8056e4:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8056eb:	00 00 00 
+  8056ee:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8056f1:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8056f7:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8056fa:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805701:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805704:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805707:	39 c2                	cmp    %eax,%edx
+  805709:	0f 4e c2             	cmovle %edx,%eax
+  80570c:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805712:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805718:	48 63 d0             	movslq %eax,%rdx
+  80571b:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805722:	48 89 c6             	mov    %rax,%rsi
+  805725:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  80572c:	00 00 00 
+  80572f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805733:	48 89 c7             	mov    %rax,%rdi
+  805736:	49 89 df             	mov    %rbx,%r15
+  805739:	48 b8 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rax
+  805740:	ff ff ff 
+  805743:	48 01 d8             	add    %rbx,%rax
+  805746:	ff d0                	call   *%rax
+	req->req_s = s;
+  805748:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80574c:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805752:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805754:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805758:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80575e:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805761:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805765:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80576b:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  80576e:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805775:	00 00 00 
+  805778:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80577c:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805780:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805787:	00 
+  805788:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80578e:	48 63 d0             	movslq %eax,%rdx
+  805791:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805795:	48 01 d0             	add    %rdx,%rax
+  805798:	48 83 e8 01          	sub    $0x1,%rax
+  80579c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8057a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057a9:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8057ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057b1:	48 29 d0             	sub    %rdx,%rax
+  8057b4:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8057ba:	85 c0                	test   %eax,%eax
+  8057bc:	0f 48 c2             	cmovs  %edx,%eax
+  8057bf:	c1 f8 0c             	sar    $0xc,%eax
+  8057c2:	48 98                	cltq
+  8057c4:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8057c8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8057cc:	48 85 c0             	test   %rax,%rax
+  8057cf:	0f 95 c0             	setne  %al
+  8057d2:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8057d5:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8057dc:	00 
+  8057dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8057e1:	48 83 c0 0b          	add    $0xb,%rax
+  8057e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8057e9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8057ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057f2:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8057f6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8057fa:	48 29 d0             	sub    %rdx,%rax
+  8057fd:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805801:	89 c7                	mov    %eax,%edi
+  805803:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80580a:	00 00 00 
+  80580d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805810:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805814:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805818:	48 83 ec 08          	sub    $0x8,%rsp
+  80581c:	6a 00                	push   $0x0
+  80581e:	6a 00                	push   $0x0
+  805820:	6a 05                	push   $0x5
+  805822:	41 89 f1             	mov    %esi,%r9d
+  805825:	49 89 c8             	mov    %rcx,%r8
+  805828:	89 f9                	mov    %edi,%ecx
+  80582a:	be 08 00 00 00       	mov    $0x8,%esi
+  80582f:	89 c7                	mov    %eax,%edi
+  805831:	49 89 df             	mov    %rbx,%r15
+  805834:	48 b8 95 d8 ff ff ff 	movabs $0xffffffffffffd895,%rax
+  80583b:	ff ff ff 
+  80583e:	48 01 d8             	add    %rbx,%rax
+  805841:	ff d0                	call   *%rax
+  805843:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805847:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80584b:	5b                   	pop    %rbx
+  80584c:	41 5f                	pop    %r15
+  80584e:	5d                   	pop    %rbp
+  80584f:	c3                   	ret
+
+0000000000805850 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805850:	55                   	push   %rbp
+  805851:	48 89 e5             	mov    %rsp,%rbp
+  805854:	48 83 ec 10          	sub    $0x10,%rsp
+  805858:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805858 <nsipc_socket+0x8>
+  80585f:	49 bb e8 37 00 00 00 	movabs $0x37e8,%r11
+  805866:	00 00 00 
+  805869:	4c 01 d8             	add    %r11,%rax
+  80586c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80586f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805872:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805875:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80587c:	00 00 00 
+  80587f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805882:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805885:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80588c:	00 00 00 
+  80588f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805892:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805896:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80589d:	00 00 00 
+  8058a0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8058a3:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8058a7:	bf 09 00 00 00       	mov    $0x9,%edi
+  8058ac:	48 ba 25 c1 ff ff ff 	movabs $0xffffffffffffc125,%rdx
+  8058b3:	ff ff ff 
+  8058b6:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8058ba:	ff d0                	call   *%rax
+}
+  8058bc:	c9                   	leave
+  8058bd:	c3                   	ret
+
+00000000008058be <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8058be:	55                   	push   %rbp
+  8058bf:	48 89 e5             	mov    %rsp,%rbp
+  8058c2:	41 57                	push   %r15
+  8058c4:	53                   	push   %rbx
+  8058c5:	48 83 ec 30          	sub    $0x30,%rsp
+  8058c9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058c9 <pipe+0xb>
+  8058d0:	49 bb 77 37 00 00 00 	movabs $0x3777,%r11
+  8058d7:	00 00 00 
+  8058da:	4c 01 db             	add    %r11,%rbx
+  8058dd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8058e1:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8058e5:	48 89 c7             	mov    %rax,%rdi
+  8058e8:	49 89 df             	mov    %rbx,%r15
+  8058eb:	48 b8 3f a5 ff ff ff 	movabs $0xffffffffffffa53f,%rax
+  8058f2:	ff ff ff 
+  8058f5:	48 01 d8             	add    %rbx,%rax
+  8058f8:	ff d0                	call   *%rax
+  8058fa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805901:	0f 88 12 02 00 00    	js     805b19 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805907:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80590b:	ba 07 04 00 00       	mov    $0x407,%edx
+  805910:	48 89 c6             	mov    %rax,%rsi
+  805913:	bf 00 00 00 00       	mov    $0x0,%edi
+  805918:	49 89 df             	mov    %rbx,%r15
+  80591b:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  805922:	ff ff ff 
+  805925:	48 01 d8             	add    %rbx,%rax
+  805928:	ff d0                	call   *%rax
+  80592a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80592d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805931:	0f 88 e2 01 00 00    	js     805b19 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805937:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80593b:	48 89 c7             	mov    %rax,%rdi
+  80593e:	49 89 df             	mov    %rbx,%r15
+  805941:	48 b8 3f a5 ff ff ff 	movabs $0xffffffffffffa53f,%rax
+  805948:	ff ff ff 
+  80594b:	48 01 d8             	add    %rbx,%rax
+  80594e:	ff d0                	call   *%rax
+  805950:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805953:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805957:	0f 88 9b 01 00 00    	js     805af8 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80595d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805961:	ba 07 04 00 00       	mov    $0x407,%edx
+  805966:	48 89 c6             	mov    %rax,%rsi
+  805969:	bf 00 00 00 00       	mov    $0x0,%edi
+  80596e:	49 89 df             	mov    %rbx,%r15
+  805971:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  805978:	ff ff ff 
+  80597b:	48 01 d8             	add    %rbx,%rax
+  80597e:	ff d0                	call   *%rax
+  805980:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805983:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805987:	0f 88 6b 01 00 00    	js     805af8 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  80598d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805991:	48 89 c7             	mov    %rax,%rdi
+  805994:	49 89 df             	mov    %rbx,%r15
+  805997:	48 b8 fc a4 ff ff ff 	movabs $0xffffffffffffa4fc,%rax
+  80599e:	ff ff ff 
+  8059a1:	48 01 d8             	add    %rbx,%rax
+  8059a4:	ff d0                	call   *%rax
+  8059a6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8059aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059ae:	ba 07 04 00 00       	mov    $0x407,%edx
+  8059b3:	48 89 c6             	mov    %rax,%rsi
+  8059b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059bb:	49 89 df             	mov    %rbx,%r15
+  8059be:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  8059c5:	ff ff ff 
+  8059c8:	48 01 d8             	add    %rbx,%rax
+  8059cb:	ff d0                	call   *%rax
+  8059cd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059d4:	0f 88 fd 00 00 00    	js     805ad7 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8059da:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059de:	48 89 c7             	mov    %rax,%rdi
+  8059e1:	49 89 df             	mov    %rbx,%r15
+  8059e4:	48 b8 fc a4 ff ff ff 	movabs $0xffffffffffffa4fc,%rax
+  8059eb:	ff ff ff 
+  8059ee:	48 01 d8             	add    %rbx,%rax
+  8059f1:	ff d0                	call   *%rax
+  8059f3:	48 89 c2             	mov    %rax,%rdx
+  8059f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059fa:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805a00:	48 89 d1             	mov    %rdx,%rcx
+  805a03:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a08:	48 89 c6             	mov    %rax,%rsi
+  805a0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a10:	49 89 df             	mov    %rbx,%r15
+  805a13:	48 b8 f5 91 ff ff ff 	movabs $0xffffffffffff91f5,%rax
+  805a1a:	ff ff ff 
+  805a1d:	48 01 d8             	add    %rbx,%rax
+  805a20:	ff d0                	call   *%rax
+  805a22:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a25:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a29:	0f 88 87 00 00 00    	js     805ab6 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805a2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a33:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805a3a:	00 00 00 
+  805a3d:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805a40:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805a42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a46:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805a4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a51:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805a58:	00 00 00 
+  805a5b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805a5e:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805a60:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a64:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805a6b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a6f:	48 89 c7             	mov    %rax,%rdi
+  805a72:	49 89 df             	mov    %rbx,%r15
+  805a75:	48 b8 c5 a4 ff ff ff 	movabs $0xffffffffffffa4c5,%rax
+  805a7c:	ff ff ff 
+  805a7f:	48 01 d8             	add    %rbx,%rax
+  805a82:	ff d0                	call   *%rax
+  805a84:	89 c2                	mov    %eax,%edx
+  805a86:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805a8a:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805a8c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a90:	48 89 c7             	mov    %rax,%rdi
+  805a93:	49 89 df             	mov    %rbx,%r15
+  805a96:	48 b8 c5 a4 ff ff ff 	movabs $0xffffffffffffa4c5,%rax
+  805a9d:	ff ff ff 
+  805aa0:	48 01 d8             	add    %rbx,%rax
+  805aa3:	ff d0                	call   *%rax
+  805aa5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805aa9:	48 83 c2 04          	add    $0x4,%rdx
+  805aad:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805aaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ab4:	eb 67                	jmp    805b1d <pipe+0x25f>
+		goto err3;
+  805ab6:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805ab7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805abb:	48 89 c6             	mov    %rax,%rsi
+  805abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ac3:	49 89 df             	mov    %rbx,%r15
+  805ac6:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  805acd:	ff ff ff 
+  805ad0:	48 01 d8             	add    %rbx,%rax
+  805ad3:	ff d0                	call   *%rax
+  805ad5:	eb 01                	jmp    805ad8 <pipe+0x21a>
+		goto err2;
+  805ad7:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805ad8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805adc:	48 89 c6             	mov    %rax,%rsi
+  805adf:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ae4:	49 89 df             	mov    %rbx,%r15
+  805ae7:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  805aee:	ff ff ff 
+  805af1:	48 01 d8             	add    %rbx,%rax
+  805af4:	ff d0                	call   *%rax
+  805af6:	eb 01                	jmp    805af9 <pipe+0x23b>
+		goto err1;
+  805af8:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805af9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805afd:	48 89 c6             	mov    %rax,%rsi
+  805b00:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b05:	49 89 df             	mov    %rbx,%r15
+  805b08:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  805b0f:	ff ff ff 
+  805b12:	48 01 d8             	add    %rbx,%rax
+  805b15:	ff d0                	call   *%rax
+  805b17:	eb 01                	jmp    805b1a <pipe+0x25c>
+		goto err;
+  805b19:	90                   	nop
+err:
+	return r;
+  805b1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805b1d:	48 83 c4 30          	add    $0x30,%rsp
+  805b21:	5b                   	pop    %rbx
+  805b22:	41 5f                	pop    %r15
+  805b24:	5d                   	pop    %rbp
+  805b25:	c3                   	ret
+
+0000000000805b26 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805b26:	55                   	push   %rbp
+  805b27:	48 89 e5             	mov    %rsp,%rbp
+  805b2a:	41 57                	push   %r15
+  805b2c:	41 54                	push   %r12
+  805b2e:	53                   	push   %rbx
+  805b2f:	48 83 ec 28          	sub    $0x28,%rsp
+  805b33:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b33 <_pipeisclosed+0xd>
+  805b3a:	49 bb 0d 35 00 00 00 	movabs $0x350d,%r11
+  805b41:	00 00 00 
+  805b44:	4c 01 db             	add    %r11,%rbx
+  805b47:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805b4b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805b4f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805b56:	ff ff ff 
+  805b59:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b5d:	48 8b 00             	mov    (%rax),%rax
+  805b60:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805b66:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805b69:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b6d:	48 89 c7             	mov    %rax,%rdi
+  805b70:	49 89 df             	mov    %rbx,%r15
+  805b73:	48 b8 1c dd ff ff ff 	movabs $0xffffffffffffdd1c,%rax
+  805b7a:	ff ff ff 
+  805b7d:	48 01 d8             	add    %rbx,%rax
+  805b80:	ff d0                	call   *%rax
+  805b82:	41 89 c4             	mov    %eax,%r12d
+  805b85:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805b89:	48 89 c7             	mov    %rax,%rdi
+  805b8c:	49 89 df             	mov    %rbx,%r15
+  805b8f:	48 b8 1c dd ff ff ff 	movabs $0xffffffffffffdd1c,%rax
+  805b96:	ff ff ff 
+  805b99:	48 01 d8             	add    %rbx,%rax
+  805b9c:	ff d0                	call   *%rax
+  805b9e:	41 39 c4             	cmp    %eax,%r12d
+  805ba1:	0f 94 c0             	sete   %al
+  805ba4:	0f b6 c0             	movzbl %al,%eax
+  805ba7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805baa:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805bb1:	ff ff ff 
+  805bb4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bb8:	48 8b 00             	mov    (%rax),%rax
+  805bbb:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805bc1:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805bc4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bc7:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805bca:	75 05                	jne    805bd1 <_pipeisclosed+0xab>
+			return ret;
+  805bcc:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805bcf:	eb 63                	jmp    805c34 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805bd1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bd4:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805bd7:	0f 84 72 ff ff ff    	je     805b4f <_pipeisclosed+0x29>
+  805bdd:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805be1:	0f 85 68 ff ff ff    	jne    805b4f <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805be7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805bee:	ff ff ff 
+  805bf1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bf5:	48 8b 00             	mov    (%rax),%rax
+  805bf8:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805bfe:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805c01:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c04:	89 c6                	mov    %eax,%esi
+  805c06:	48 b8 36 e5 ff ff ff 	movabs $0xffffffffffffe536,%rax
+  805c0d:	ff ff ff 
+  805c10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c14:	48 89 c7             	mov    %rax,%rdi
+  805c17:	49 89 df             	mov    %rbx,%r15
+  805c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c1f:	49 b8 12 77 ff ff ff 	movabs $0xffffffffffff7712,%r8
+  805c26:	ff ff ff 
+  805c29:	49 01 d8             	add    %rbx,%r8
+  805c2c:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805c2f:	e9 1b ff ff ff       	jmp    805b4f <_pipeisclosed+0x29>
+	}
+}
+  805c34:	48 83 c4 28          	add    $0x28,%rsp
+  805c38:	5b                   	pop    %rbx
+  805c39:	41 5c                	pop    %r12
+  805c3b:	41 5f                	pop    %r15
+  805c3d:	5d                   	pop    %rbp
+  805c3e:	c3                   	ret
+
+0000000000805c3f <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805c3f:	55                   	push   %rbp
+  805c40:	48 89 e5             	mov    %rsp,%rbp
+  805c43:	41 57                	push   %r15
+  805c45:	53                   	push   %rbx
+  805c46:	48 83 ec 30          	sub    $0x30,%rsp
+  805c4a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c4a <pipeisclosed+0xb>
+  805c51:	49 bb f6 33 00 00 00 	movabs $0x33f6,%r11
+  805c58:	00 00 00 
+  805c5b:	4c 01 db             	add    %r11,%rbx
+  805c5e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805c61:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805c65:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c68:	48 89 d6             	mov    %rdx,%rsi
+  805c6b:	89 c7                	mov    %eax,%edi
+  805c6d:	49 89 df             	mov    %rbx,%r15
+  805c70:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  805c77:	ff ff ff 
+  805c7a:	48 01 d8             	add    %rbx,%rax
+  805c7d:	ff d0                	call   *%rax
+  805c7f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c82:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c86:	79 05                	jns    805c8d <pipeisclosed+0x4e>
+		return r;
+  805c88:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c8b:	eb 3b                	jmp    805cc8 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805c8d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c91:	48 89 c7             	mov    %rax,%rdi
+  805c94:	49 89 df             	mov    %rbx,%r15
+  805c97:	48 b8 fc a4 ff ff ff 	movabs $0xffffffffffffa4fc,%rax
+  805c9e:	ff ff ff 
+  805ca1:	48 01 d8             	add    %rbx,%rax
+  805ca4:	ff d0                	call   *%rax
+  805ca6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805caa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805cb2:	48 89 d6             	mov    %rdx,%rsi
+  805cb5:	48 89 c7             	mov    %rax,%rdi
+  805cb8:	48 b8 e6 ca ff ff ff 	movabs $0xffffffffffffcae6,%rax
+  805cbf:	ff ff ff 
+  805cc2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cc6:	ff d0                	call   *%rax
+}
+  805cc8:	48 83 c4 30          	add    $0x30,%rsp
+  805ccc:	5b                   	pop    %rbx
+  805ccd:	41 5f                	pop    %r15
+  805ccf:	5d                   	pop    %rbp
+  805cd0:	c3                   	ret
+
+0000000000805cd1 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805cd1:	55                   	push   %rbp
+  805cd2:	48 89 e5             	mov    %rsp,%rbp
+  805cd5:	41 57                	push   %r15
+  805cd7:	53                   	push   %rbx
+  805cd8:	48 83 ec 40          	sub    $0x40,%rsp
+  805cdc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cdc <devpipe_read+0xb>
+  805ce3:	49 bb 64 33 00 00 00 	movabs $0x3364,%r11
+  805cea:	00 00 00 
+  805ced:	4c 01 db             	add    %r11,%rbx
+  805cf0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805cf4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805cf8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805cfc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d00:	48 89 c7             	mov    %rax,%rdi
+  805d03:	49 89 df             	mov    %rbx,%r15
+  805d06:	48 b8 fc a4 ff ff ff 	movabs $0xffffffffffffa4fc,%rax
+  805d0d:	ff ff ff 
+  805d10:	48 01 d8             	add    %rbx,%rax
+  805d13:	ff d0                	call   *%rax
+  805d15:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805d19:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d1d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805d21:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805d28:	00 
+  805d29:	e9 a1 00 00 00       	jmp    805dcf <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805d2e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805d33:	74 09                	je     805d3e <devpipe_read+0x6d>
+				return i;
+  805d35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d39:	e9 9f 00 00 00       	jmp    805ddd <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805d3e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d46:	48 89 d6             	mov    %rdx,%rsi
+  805d49:	48 89 c7             	mov    %rax,%rdi
+  805d4c:	48 b8 e6 ca ff ff ff 	movabs $0xffffffffffffcae6,%rax
+  805d53:	ff ff ff 
+  805d56:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d5a:	ff d0                	call   *%rax
+  805d5c:	85 c0                	test   %eax,%eax
+  805d5e:	74 07                	je     805d67 <devpipe_read+0x96>
+				return 0;
+  805d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d65:	eb 76                	jmp    805ddd <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805d67:	49 89 df             	mov    %rbx,%r15
+  805d6a:	48 b8 3b 91 ff ff ff 	movabs $0xffffffffffff913b,%rax
+  805d71:	ff ff ff 
+  805d74:	48 01 d8             	add    %rbx,%rax
+  805d77:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805d79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d7d:	8b 10                	mov    (%rax),%edx
+  805d7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d83:	8b 40 04             	mov    0x4(%rax),%eax
+  805d86:	39 c2                	cmp    %eax,%edx
+  805d88:	74 a4                	je     805d2e <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805d8a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d8e:	8b 10                	mov    (%rax),%edx
+  805d90:	89 d0                	mov    %edx,%eax
+  805d92:	c1 f8 1f             	sar    $0x1f,%eax
+  805d95:	c1 e8 1b             	shr    $0x1b,%eax
+  805d98:	01 c2                	add    %eax,%edx
+  805d9a:	83 e2 1f             	and    $0x1f,%edx
+  805d9d:	29 c2                	sub    %eax,%edx
+  805d9f:	89 d6                	mov    %edx,%esi
+  805da1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805da5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805da9:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805dad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805db1:	48 63 c6             	movslq %esi,%rax
+  805db4:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805db9:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805dbb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805dbf:	8b 00                	mov    (%rax),%eax
+  805dc1:	8d 50 01             	lea    0x1(%rax),%edx
+  805dc4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805dc8:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805dca:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805dcf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dd3:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805dd7:	72 a0                	jb     805d79 <devpipe_read+0xa8>
+	}
+	return i;
+  805dd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805ddd:	48 83 c4 40          	add    $0x40,%rsp
+  805de1:	5b                   	pop    %rbx
+  805de2:	41 5f                	pop    %r15
+  805de4:	5d                   	pop    %rbp
+  805de5:	c3                   	ret
+
+0000000000805de6 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805de6:	55                   	push   %rbp
+  805de7:	48 89 e5             	mov    %rsp,%rbp
+  805dea:	41 57                	push   %r15
+  805dec:	53                   	push   %rbx
+  805ded:	48 83 ec 40          	sub    $0x40,%rsp
+  805df1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805df1 <devpipe_write+0xb>
+  805df8:	49 bb 4f 32 00 00 00 	movabs $0x324f,%r11
+  805dff:	00 00 00 
+  805e02:	4c 01 db             	add    %r11,%rbx
+  805e05:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805e09:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805e0d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805e11:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e15:	48 89 c7             	mov    %rax,%rdi
+  805e18:	49 89 df             	mov    %rbx,%r15
+  805e1b:	48 b8 fc a4 ff ff ff 	movabs $0xffffffffffffa4fc,%rax
+  805e22:	ff ff ff 
+  805e25:	48 01 d8             	add    %rbx,%rax
+  805e28:	ff d0                	call   *%rax
+  805e2a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805e2e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805e32:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805e36:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805e3d:	00 
+  805e3e:	e9 a0 00 00 00       	jmp    805ee3 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805e43:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e4b:	48 89 d6             	mov    %rdx,%rsi
+  805e4e:	48 89 c7             	mov    %rax,%rdi
+  805e51:	48 b8 e6 ca ff ff ff 	movabs $0xffffffffffffcae6,%rax
+  805e58:	ff ff ff 
+  805e5b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e5f:	ff d0                	call   *%rax
+  805e61:	85 c0                	test   %eax,%eax
+  805e63:	74 0a                	je     805e6f <devpipe_write+0x89>
+				return 0;
+  805e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e6a:	e9 82 00 00 00       	jmp    805ef1 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805e6f:	49 89 df             	mov    %rbx,%r15
+  805e72:	48 b8 3b 91 ff ff ff 	movabs $0xffffffffffff913b,%rax
+  805e79:	ff ff ff 
+  805e7c:	48 01 d8             	add    %rbx,%rax
+  805e7f:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805e81:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e85:	8b 40 04             	mov    0x4(%rax),%eax
+  805e88:	48 63 d0             	movslq %eax,%rdx
+  805e8b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e8f:	8b 00                	mov    (%rax),%eax
+  805e91:	48 98                	cltq
+  805e93:	48 83 c0 20          	add    $0x20,%rax
+  805e97:	48 39 c2             	cmp    %rax,%rdx
+  805e9a:	73 a7                	jae    805e43 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805e9c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805ea0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ea4:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805ea8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805eac:	8b 50 04             	mov    0x4(%rax),%edx
+  805eaf:	89 d0                	mov    %edx,%eax
+  805eb1:	c1 f8 1f             	sar    $0x1f,%eax
+  805eb4:	c1 e8 1b             	shr    $0x1b,%eax
+  805eb7:	01 c2                	add    %eax,%edx
+  805eb9:	83 e2 1f             	and    $0x1f,%edx
+  805ebc:	29 c2                	sub    %eax,%edx
+  805ebe:	89 d0                	mov    %edx,%eax
+  805ec0:	0f b6 09             	movzbl (%rcx),%ecx
+  805ec3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ec7:	48 98                	cltq
+  805ec9:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805ecd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ed1:	8b 40 04             	mov    0x4(%rax),%eax
+  805ed4:	8d 50 01             	lea    0x1(%rax),%edx
+  805ed7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805edb:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805ede:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805ee3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ee7:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805eeb:	72 94                	jb     805e81 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805eed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805ef1:	48 83 c4 40          	add    $0x40,%rsp
+  805ef5:	5b                   	pop    %rbx
+  805ef6:	41 5f                	pop    %r15
+  805ef8:	5d                   	pop    %rbp
+  805ef9:	c3                   	ret
+
+0000000000805efa <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805efa:	55                   	push   %rbp
+  805efb:	48 89 e5             	mov    %rsp,%rbp
+  805efe:	41 57                	push   %r15
+  805f00:	53                   	push   %rbx
+  805f01:	48 83 ec 20          	sub    $0x20,%rsp
+  805f05:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f05 <devpipe_stat+0xb>
+  805f0c:	49 bb 3b 31 00 00 00 	movabs $0x313b,%r11
+  805f13:	00 00 00 
+  805f16:	4c 01 db             	add    %r11,%rbx
+  805f19:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805f1d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805f21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f25:	48 89 c7             	mov    %rax,%rdi
+  805f28:	49 89 df             	mov    %rbx,%r15
+  805f2b:	48 b8 fc a4 ff ff ff 	movabs $0xffffffffffffa4fc,%rax
+  805f32:	ff ff ff 
+  805f35:	48 01 d8             	add    %rbx,%rax
+  805f38:	ff d0                	call   *%rax
+  805f3a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805f3e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f42:	48 ba 49 e5 ff ff ff 	movabs $0xffffffffffffe549,%rdx
+  805f49:	ff ff ff 
+  805f4c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805f50:	48 89 d6             	mov    %rdx,%rsi
+  805f53:	48 89 c7             	mov    %rax,%rdi
+  805f56:	49 89 df             	mov    %rbx,%r15
+  805f59:	48 b8 d4 84 ff ff ff 	movabs $0xffffffffffff84d4,%rax
+  805f60:	ff ff ff 
+  805f63:	48 01 d8             	add    %rbx,%rax
+  805f66:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805f68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f6c:	8b 50 04             	mov    0x4(%rax),%edx
+  805f6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f73:	8b 00                	mov    (%rax),%eax
+  805f75:	29 c2                	sub    %eax,%edx
+  805f77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f7b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805f81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f85:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805f8c:	00 00 00 
+	stat->st_dev = &devpipe;
+  805f8f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f93:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805f9a:	00 00 00 
+  805f9d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805fa1:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805fad:	48 83 c4 20          	add    $0x20,%rsp
+  805fb1:	5b                   	pop    %rbx
+  805fb2:	41 5f                	pop    %r15
+  805fb4:	5d                   	pop    %rbp
+  805fb5:	c3                   	ret
+
+0000000000805fb6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805fb6:	55                   	push   %rbp
+  805fb7:	48 89 e5             	mov    %rsp,%rbp
+  805fba:	41 57                	push   %r15
+  805fbc:	53                   	push   %rbx
+  805fbd:	48 83 ec 10          	sub    $0x10,%rsp
+  805fc1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fc1 <devpipe_close+0xb>
+  805fc8:	49 bb 7f 30 00 00 00 	movabs $0x307f,%r11
+  805fcf:	00 00 00 
+  805fd2:	4c 01 db             	add    %r11,%rbx
+  805fd5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805fd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fdd:	48 89 c6             	mov    %rax,%rsi
+  805fe0:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fe5:	49 89 df             	mov    %rbx,%r15
+  805fe8:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  805fef:	ff ff ff 
+  805ff2:	48 01 d8             	add    %rbx,%rax
+  805ff5:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  805ff7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ffb:	48 89 c7             	mov    %rax,%rdi
+  805ffe:	49 89 df             	mov    %rbx,%r15
+  806001:	48 b8 fc a4 ff ff ff 	movabs $0xffffffffffffa4fc,%rax
+  806008:	ff ff ff 
+  80600b:	48 01 d8             	add    %rbx,%rax
+  80600e:	ff d0                	call   *%rax
+  806010:	48 89 c6             	mov    %rax,%rsi
+  806013:	bf 00 00 00 00       	mov    $0x0,%edi
+  806018:	49 89 df             	mov    %rbx,%r15
+  80601b:	48 b8 68 92 ff ff ff 	movabs $0xffffffffffff9268,%rax
+  806022:	ff ff ff 
+  806025:	48 01 d8             	add    %rbx,%rax
+  806028:	ff d0                	call   *%rax
+}
+  80602a:	48 83 c4 10          	add    $0x10,%rsp
+  80602e:	5b                   	pop    %rbx
+  80602f:	41 5f                	pop    %r15
+  806031:	5d                   	pop    %rbp
+  806032:	c3                   	ret
+
+0000000000806033 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  806033:	55                   	push   %rbp
+  806034:	48 89 e5             	mov    %rsp,%rbp
+  806037:	41 57                	push   %r15
+  806039:	48 83 ec 28          	sub    $0x28,%rsp
+  80603d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80603d <cputchar+0xa>
+  806044:	49 bb 03 30 00 00 00 	movabs $0x3003,%r11
+  80604b:	00 00 00 
+  80604e:	4c 01 d8             	add    %r11,%rax
+  806051:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806054:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806057:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  80605a:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  80605e:	be 01 00 00 00       	mov    $0x1,%esi
+  806063:	48 89 d7             	mov    %rdx,%rdi
+  806066:	49 89 c7             	mov    %rax,%r15
+  806069:	48 ba d8 8f ff ff ff 	movabs $0xffffffffffff8fd8,%rdx
+  806070:	ff ff ff 
+  806073:	48 01 c2             	add    %rax,%rdx
+  806076:	ff d2                	call   *%rdx
+}
+  806078:	90                   	nop
+  806079:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80607d:	c9                   	leave
+  80607e:	c3                   	ret
+
+000000000080607f <getchar>:
+
+int
+getchar(void)
+{
+  80607f:	55                   	push   %rbp
+  806080:	48 89 e5             	mov    %rsp,%rbp
+  806083:	41 57                	push   %r15
+  806085:	48 83 ec 18          	sub    $0x18,%rsp
+  806089:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806089 <getchar+0xa>
+  806090:	49 bb b7 2f 00 00 00 	movabs $0x2fb7,%r11
+  806097:	00 00 00 
+  80609a:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  80609d:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8060a1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8060a6:	48 89 ce             	mov    %rcx,%rsi
+  8060a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060ae:	49 89 c7             	mov    %rax,%r15
+  8060b1:	48 b9 3c ab ff ff ff 	movabs $0xffffffffffffab3c,%rcx
+  8060b8:	ff ff ff 
+  8060bb:	48 01 c1             	add    %rax,%rcx
+  8060be:	ff d1                	call   *%rcx
+  8060c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8060c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060c7:	79 05                	jns    8060ce <getchar+0x4f>
+		return r;
+  8060c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060cc:	eb 14                	jmp    8060e2 <getchar+0x63>
+	if (r < 1)
+  8060ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8060d2:	7f 07                	jg     8060db <getchar+0x5c>
+		return -E_EOF;
+  8060d4:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8060d9:	eb 07                	jmp    8060e2 <getchar+0x63>
+	return c;
+  8060db:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8060df:	0f b6 c0             	movzbl %al,%eax
+}
+  8060e2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8060e6:	c9                   	leave
+  8060e7:	c3                   	ret
+
+00000000008060e8 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8060e8:	55                   	push   %rbp
+  8060e9:	48 89 e5             	mov    %rsp,%rbp
+  8060ec:	41 57                	push   %r15
+  8060ee:	53                   	push   %rbx
+  8060ef:	48 83 ec 20          	sub    $0x20,%rsp
+  8060f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060f3 <iscons+0xb>
+  8060fa:	49 bb 4d 2f 00 00 00 	movabs $0x2f4d,%r11
+  806101:	00 00 00 
+  806104:	4c 01 db             	add    %r11,%rbx
+  806107:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80610a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80610e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806111:	48 89 d6             	mov    %rdx,%rsi
+  806114:	89 c7                	mov    %eax,%edi
+  806116:	49 89 df             	mov    %rbx,%r15
+  806119:	48 b8 f5 a5 ff ff ff 	movabs $0xffffffffffffa5f5,%rax
+  806120:	ff ff ff 
+  806123:	48 01 d8             	add    %rbx,%rax
+  806126:	ff d0                	call   *%rax
+  806128:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80612b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80612f:	79 05                	jns    806136 <iscons+0x4e>
+		return r;
+  806131:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806134:	eb 1b                	jmp    806151 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  806136:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80613a:	8b 10                	mov    (%rax),%edx
+  80613c:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  806143:	00 00 00 
+  806146:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806149:	39 c2                	cmp    %eax,%edx
+  80614b:	0f 94 c0             	sete   %al
+  80614e:	0f b6 c0             	movzbl %al,%eax
+}
+  806151:	48 83 c4 20          	add    $0x20,%rsp
+  806155:	5b                   	pop    %rbx
+  806156:	41 5f                	pop    %r15
+  806158:	5d                   	pop    %rbp
+  806159:	c3                   	ret
+
+000000000080615a <opencons>:
+
+int
+opencons(void)
+{
+  80615a:	55                   	push   %rbp
+  80615b:	48 89 e5             	mov    %rsp,%rbp
+  80615e:	41 57                	push   %r15
+  806160:	53                   	push   %rbx
+  806161:	48 83 ec 10          	sub    $0x10,%rsp
+  806165:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806165 <opencons+0xb>
+  80616c:	49 bb db 2e 00 00 00 	movabs $0x2edb,%r11
+  806173:	00 00 00 
+  806176:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806179:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80617d:	48 89 c7             	mov    %rax,%rdi
+  806180:	49 89 df             	mov    %rbx,%r15
+  806183:	48 b8 3f a5 ff ff ff 	movabs $0xffffffffffffa53f,%rax
+  80618a:	ff ff ff 
+  80618d:	48 01 d8             	add    %rbx,%rax
+  806190:	ff d0                	call   *%rax
+  806192:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806195:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806199:	79 05                	jns    8061a0 <opencons+0x46>
+		return r;
+  80619b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80619e:	eb 68                	jmp    806208 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8061a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061a4:	ba 07 04 00 00       	mov    $0x407,%edx
+  8061a9:	48 89 c6             	mov    %rax,%rsi
+  8061ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061b1:	49 89 df             	mov    %rbx,%r15
+  8061b4:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  8061bb:	ff ff ff 
+  8061be:	48 01 d8             	add    %rbx,%rax
+  8061c1:	ff d0                	call   *%rax
+  8061c3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061ca:	79 05                	jns    8061d1 <opencons+0x77>
+		return r;
+  8061cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061cf:	eb 37                	jmp    806208 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8061d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061d5:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  8061dc:	00 00 00 
+  8061df:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8061e2:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8061e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061e8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8061ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8061f3:	48 89 c7             	mov    %rax,%rdi
+  8061f6:	49 89 df             	mov    %rbx,%r15
+  8061f9:	48 b8 c5 a4 ff ff ff 	movabs $0xffffffffffffa4c5,%rax
+  806200:	ff ff ff 
+  806203:	48 01 d8             	add    %rbx,%rax
+  806206:	ff d0                	call   *%rax
+}
+  806208:	48 83 c4 10          	add    $0x10,%rsp
+  80620c:	5b                   	pop    %rbx
+  80620d:	41 5f                	pop    %r15
+  80620f:	5d                   	pop    %rbp
+  806210:	c3                   	ret
+
+0000000000806211 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806211:	55                   	push   %rbp
+  806212:	48 89 e5             	mov    %rsp,%rbp
+  806215:	41 57                	push   %r15
+  806217:	53                   	push   %rbx
+  806218:	48 83 ec 30          	sub    $0x30,%rsp
+  80621c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80621c <devcons_read+0xb>
+  806223:	49 bb 24 2e 00 00 00 	movabs $0x2e24,%r11
+  80622a:	00 00 00 
+  80622d:	4c 01 db             	add    %r11,%rbx
+  806230:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806234:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806238:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  80623c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806241:	75 19                	jne    80625c <devcons_read+0x4b>
+		return 0;
+  806243:	b8 00 00 00 00       	mov    $0x0,%eax
+  806248:	eb 55                	jmp    80629f <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  80624a:	49 89 df             	mov    %rbx,%r15
+  80624d:	48 b8 3b 91 ff ff ff 	movabs $0xffffffffffff913b,%rax
+  806254:	ff ff ff 
+  806257:	48 01 d8             	add    %rbx,%rax
+  80625a:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  80625c:	49 89 df             	mov    %rbx,%r15
+  80625f:	48 b8 37 90 ff ff ff 	movabs $0xffffffffffff9037,%rax
+  806266:	ff ff ff 
+  806269:	48 01 d8             	add    %rbx,%rax
+  80626c:	ff d0                	call   *%rax
+  80626e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806271:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806275:	74 d3                	je     80624a <devcons_read+0x39>
+	if (c < 0)
+  806277:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80627b:	79 05                	jns    806282 <devcons_read+0x71>
+		return c;
+  80627d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806280:	eb 1d                	jmp    80629f <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806282:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806286:	75 07                	jne    80628f <devcons_read+0x7e>
+		return 0;
+  806288:	b8 00 00 00 00       	mov    $0x0,%eax
+  80628d:	eb 10                	jmp    80629f <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  80628f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806292:	89 c2                	mov    %eax,%edx
+  806294:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806298:	88 10                	mov    %dl,(%rax)
+	return 1;
+  80629a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80629f:	48 83 c4 30          	add    $0x30,%rsp
+  8062a3:	5b                   	pop    %rbx
+  8062a4:	41 5f                	pop    %r15
+  8062a6:	5d                   	pop    %rbp
+  8062a7:	c3                   	ret
+
+00000000008062a8 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8062a8:	55                   	push   %rbp
+  8062a9:	48 89 e5             	mov    %rsp,%rbp
+  8062ac:	41 57                	push   %r15
+  8062ae:	53                   	push   %rbx
+  8062af:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8062b6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8062b6 <devcons_write+0xe>
+  8062bd:	49 bb 8a 2d 00 00 00 	movabs $0x2d8a,%r11
+  8062c4:	00 00 00 
+  8062c7:	4c 01 db             	add    %r11,%rbx
+  8062ca:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8062d1:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8062d8:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8062df:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8062e6:	e9 80 00 00 00       	jmp    80636b <devcons_write+0xc3>
+		m = n - tot;
+  8062eb:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8062f2:	89 c2                	mov    %eax,%edx
+  8062f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062f7:	29 c2                	sub    %eax,%edx
+  8062f9:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8062fc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8062ff:	83 f8 7f             	cmp    $0x7f,%eax
+  806302:	76 07                	jbe    80630b <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806304:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  80630b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80630e:	48 63 d0             	movslq %eax,%rdx
+  806311:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806314:	48 63 c8             	movslq %eax,%rcx
+  806317:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  80631e:	48 01 c1             	add    %rax,%rcx
+  806321:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806328:	48 89 ce             	mov    %rcx,%rsi
+  80632b:	48 89 c7             	mov    %rax,%rdi
+  80632e:	49 89 df             	mov    %rbx,%r15
+  806331:	48 b8 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rax
+  806338:	ff ff ff 
+  80633b:	48 01 d8             	add    %rbx,%rax
+  80633e:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806340:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806343:	48 63 d0             	movslq %eax,%rdx
+  806346:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80634d:	48 89 d6             	mov    %rdx,%rsi
+  806350:	48 89 c7             	mov    %rax,%rdi
+  806353:	49 89 df             	mov    %rbx,%r15
+  806356:	48 b8 d8 8f ff ff ff 	movabs $0xffffffffffff8fd8,%rax
+  80635d:	ff ff ff 
+  806360:	48 01 d8             	add    %rbx,%rax
+  806363:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806365:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806368:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80636b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80636e:	48 98                	cltq
+  806370:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806377:	0f 82 6e ff ff ff    	jb     8062eb <devcons_write+0x43>
+	}
+	return tot;
+  80637d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806380:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806387:	5b                   	pop    %rbx
+  806388:	41 5f                	pop    %r15
+  80638a:	5d                   	pop    %rbp
+  80638b:	c3                   	ret
+
+000000000080638c <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  80638c:	55                   	push   %rbp
+  80638d:	48 89 e5             	mov    %rsp,%rbp
+  806390:	48 83 ec 08          	sub    $0x8,%rsp
+  806394:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806394 <devcons_close+0x8>
+  80639b:	49 bb ac 2c 00 00 00 	movabs $0x2cac,%r11
+  8063a2:	00 00 00 
+  8063a5:	4c 01 d8             	add    %r11,%rax
+  8063a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8063ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8063b1:	c9                   	leave
+  8063b2:	c3                   	ret
+
+00000000008063b3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8063b3:	55                   	push   %rbp
+  8063b4:	48 89 e5             	mov    %rsp,%rbp
+  8063b7:	41 57                	push   %r15
+  8063b9:	48 83 ec 18          	sub    $0x18,%rsp
+  8063bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8063bd <devcons_stat+0xa>
+  8063c4:	49 bb 83 2c 00 00 00 	movabs $0x2c83,%r11
+  8063cb:	00 00 00 
+  8063ce:	4c 01 d8             	add    %r11,%rax
+  8063d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8063d5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8063d9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8063dd:	48 b9 55 e5 ff ff ff 	movabs $0xffffffffffffe555,%rcx
+  8063e4:	ff ff ff 
+  8063e7:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8063eb:	48 89 ce             	mov    %rcx,%rsi
+  8063ee:	48 89 d7             	mov    %rdx,%rdi
+  8063f1:	49 89 c7             	mov    %rax,%r15
+  8063f4:	48 ba d4 84 ff ff ff 	movabs $0xffffffffffff84d4,%rdx
+  8063fb:	ff ff ff 
+  8063fe:	48 01 c2             	add    %rax,%rdx
+  806401:	ff d2                	call   *%rdx
+	return 0;
+  806403:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806408:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80640c:	c9                   	leave
+  80640d:	c3                   	ret
+
+000000000080640e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80640e:	55                   	push   %rbp
+  80640f:	48 89 e5             	mov    %rsp,%rbp
+  806412:	41 57                	push   %r15
+  806414:	53                   	push   %rbx
+  806415:	48 83 ec 20          	sub    $0x20,%rsp
+  806419:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806419 <set_pgfault_handler+0xb>
+  806420:	49 bb 27 2c 00 00 00 	movabs $0x2c27,%r11
+  806427:	00 00 00 
+  80642a:	4c 01 db             	add    %r11,%rbx
+  80642d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806431:	49 89 df             	mov    %rbx,%r15
+  806434:	48 b8 e7 90 ff ff ff 	movabs $0xffffffffffff90e7,%rax
+  80643b:	ff ff ff 
+  80643e:	48 01 d8             	add    %rbx,%rax
+  806441:	ff d0                	call   *%rax
+  806443:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806446:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  80644d:	00 00 00 
+  806450:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806454:	48 85 c0             	test   %rax,%rax
+  806457:	75 6b                	jne    8064c4 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806459:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80645c:	ba 07 00 00 00       	mov    $0x7,%edx
+  806461:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806466:	48 89 ce             	mov    %rcx,%rsi
+  806469:	89 c7                	mov    %eax,%edi
+  80646b:	49 89 df             	mov    %rbx,%r15
+  80646e:	48 b8 90 91 ff ff ff 	movabs $0xffffffffffff9190,%rax
+  806475:	ff ff ff 
+  806478:	48 01 d8             	add    %rbx,%rax
+  80647b:	ff d0                	call   *%rax
+  80647d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806480:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806484:	74 3e                	je     8064c4 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806486:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  80648d:	ff ff ff 
+  806490:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806494:	48 89 c2             	mov    %rax,%rdx
+  806497:	be 23 00 00 00       	mov    $0x23,%esi
+  80649c:	48 b8 8e e5 ff ff ff 	movabs $0xffffffffffffe58e,%rax
+  8064a3:	ff ff ff 
+  8064a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8064aa:	48 89 c7             	mov    %rax,%rdi
+  8064ad:	49 89 df             	mov    %rbx,%r15
+  8064b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064b5:	48 b9 3b 74 ff ff ff 	movabs $0xffffffffffff743b,%rcx
+  8064bc:	ff ff ff 
+  8064bf:	48 01 d9             	add    %rbx,%rcx
+  8064c2:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8064c4:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  8064cb:	00 00 00 
+  8064ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8064d2:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  8064d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064d9:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8064e0:	ff ff ff 
+  8064e3:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8064e7:	48 89 d6             	mov    %rdx,%rsi
+  8064ea:	89 c7                	mov    %eax,%edi
+  8064ec:	49 89 df             	mov    %rbx,%r15
+  8064ef:	48 b8 86 93 ff ff ff 	movabs $0xffffffffffff9386,%rax
+  8064f6:	ff ff ff 
+  8064f9:	48 01 d8             	add    %rbx,%rax
+  8064fc:	ff d0                	call   *%rax
+}
+  8064fe:	90                   	nop
+  8064ff:	48 83 c4 20          	add    $0x20,%rsp
+  806503:	5b                   	pop    %rbx
+  806504:	41 5f                	pop    %r15
+  806506:	5d                   	pop    %rbp
+  806507:	c3                   	ret
+
+0000000000806508 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806508:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  80650b:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806512:	00 00 00 
+call *%rax
+  806515:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806517:	58                   	pop    %rax
+	popq %rax;
+  806518:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806519:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806520:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806524:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806528:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  80652c:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806530:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806534:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806537:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  80653b:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80653f:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806544:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806549:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80654e:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806553:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806558:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80655d:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806562:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806567:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80656c:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806571:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806576:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80657b:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806580:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806585:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806589:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  80658d:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  80658e:	5c                   	pop    %rsp
+	ret;			//return
+  80658f:	c3                   	ret
+
+0000000000806590 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806590:	55                   	push   %rbp
+  806591:	48 89 e5             	mov    %rsp,%rbp
+  806594:	41 57                	push   %r15
+  806596:	53                   	push   %rbx
+  806597:	48 83 ec 30          	sub    $0x30,%rsp
+  80659b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80659b <ipc_recv+0xb>
+  8065a2:	49 bb a5 2a 00 00 00 	movabs $0x2aa5,%r11
+  8065a9:	00 00 00 
+  8065ac:	4c 01 db             	add    %r11,%rbx
+  8065af:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8065b3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8065b7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8065bb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8065c0:	75 0e                	jne    8065d0 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8065c2:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8065c9:	00 00 00 
+  8065cc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8065d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065d4:	48 89 c7             	mov    %rax,%rdi
+  8065d7:	49 89 df             	mov    %rbx,%r15
+  8065da:	48 b8 b9 94 ff ff ff 	movabs $0xffffffffffff94b9,%rax
+  8065e1:	ff ff ff 
+  8065e4:	48 01 d8             	add    %rbx,%rax
+  8065e7:	ff d0                	call   *%rax
+  8065e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8065ec:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8065f1:	74 2a                	je     80661d <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8065f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065f7:	75 19                	jne    806612 <ipc_recv+0x82>
+  8065f9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806600:	ff ff ff 
+  806603:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806607:	48 8b 00             	mov    (%rax),%rax
+  80660a:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806610:	eb 05                	jmp    806617 <ipc_recv+0x87>
+  806612:	b8 00 00 00 00       	mov    $0x0,%eax
+  806617:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80661b:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80661d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806622:	74 2a                	je     80664e <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  806624:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806628:	75 19                	jne    806643 <ipc_recv+0xb3>
+  80662a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806631:	ff ff ff 
+  806634:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806638:	48 8b 00             	mov    (%rax),%rax
+  80663b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806641:	eb 05                	jmp    806648 <ipc_recv+0xb8>
+  806643:	b8 00 00 00 00       	mov    $0x0,%eax
+  806648:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80664c:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80664e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806652:	74 05                	je     806659 <ipc_recv+0xc9>
+		return res;
+  806654:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806657:	eb 17                	jmp    806670 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806659:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806660:	ff ff ff 
+  806663:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806667:	48 8b 00             	mov    (%rax),%rax
+  80666a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806670:	48 83 c4 30          	add    $0x30,%rsp
+  806674:	5b                   	pop    %rbx
+  806675:	41 5f                	pop    %r15
+  806677:	5d                   	pop    %rbp
+  806678:	c3                   	ret
+
+0000000000806679 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806679:	55                   	push   %rbp
+  80667a:	48 89 e5             	mov    %rsp,%rbp
+  80667d:	41 57                	push   %r15
+  80667f:	53                   	push   %rbx
+  806680:	48 83 ec 20          	sub    $0x20,%rsp
+  806684:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806684 <ipc_send+0xb>
+  80668b:	49 bb bc 29 00 00 00 	movabs $0x29bc,%r11
+  806692:	00 00 00 
+  806695:	4c 01 db             	add    %r11,%rbx
+  806698:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80669b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80669e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8066a2:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8066a5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8066aa:	75 0e                	jne    8066ba <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8066ac:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8066b3:	00 00 00 
+  8066b6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8066ba:	90                   	nop
+  8066bb:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8066be:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8066c1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8066c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066c8:	89 c7                	mov    %eax,%edi
+  8066ca:	49 89 df             	mov    %rbx,%r15
+  8066cd:	48 b8 4f 94 ff ff ff 	movabs $0xffffffffffff944f,%rax
+  8066d4:	ff ff ff 
+  8066d7:	48 01 d8             	add    %rbx,%rax
+  8066da:	ff d0                	call   *%rax
+  8066dc:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8066df:	74 da                	je     8066bb <ipc_send+0x42>
+		;
+}
+  8066e1:	90                   	nop
+  8066e2:	90                   	nop
+  8066e3:	48 83 c4 20          	add    $0x20,%rsp
+  8066e7:	5b                   	pop    %rbx
+  8066e8:	41 5f                	pop    %r15
+  8066ea:	5d                   	pop    %rbp
+  8066eb:	c3                   	ret
+
+00000000008066ec <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8066ec:	55                   	push   %rbp
+  8066ed:	48 89 e5             	mov    %rsp,%rbp
+  8066f0:	41 57                	push   %r15
+  8066f2:	53                   	push   %rbx
+  8066f3:	48 83 ec 40          	sub    $0x40,%rsp
+  8066f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8066f7 <ipc_call+0xb>
+  8066fe:	49 bb 49 29 00 00 00 	movabs $0x2949,%r11
+  806705:	00 00 00 
+  806708:	4c 01 db             	add    %r11,%rbx
+  80670b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80670e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806711:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806715:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806718:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80671c:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806720:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806725:	75 0e                	jne    806735 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806727:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80672e:	00 00 00 
+  806731:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806735:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80673a:	75 0e                	jne    80674a <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80673c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806743:	00 00 00 
+  806746:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80674a:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80674d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806751:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806754:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806758:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80675b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806761:	49 89 f8             	mov    %rdi,%r8
+  806764:	89 c7                	mov    %eax,%edi
+  806766:	49 89 df             	mov    %rbx,%r15
+  806769:	48 b8 12 95 ff ff ff 	movabs $0xffffffffffff9512,%rax
+  806770:	ff ff ff 
+  806773:	48 01 d8             	add    %rbx,%rax
+  806776:	ff d0                	call   *%rax
+  806778:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80677b:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806780:	74 2a                	je     8067ac <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806782:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806786:	75 19                	jne    8067a1 <ipc_call+0xb5>
+  806788:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80678f:	ff ff ff 
+  806792:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806796:	48 8b 00             	mov    (%rax),%rax
+  806799:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80679f:	eb 05                	jmp    8067a6 <ipc_call+0xba>
+  8067a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067a6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8067aa:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8067ac:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067b0:	74 05                	je     8067b7 <ipc_call+0xcb>
+		return r;
+  8067b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067b5:	eb 17                	jmp    8067ce <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8067b7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8067be:	ff ff ff 
+  8067c1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8067c5:	48 8b 00             	mov    (%rax),%rax
+  8067c8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8067ce:	48 83 c4 40          	add    $0x40,%rsp
+  8067d2:	5b                   	pop    %rbx
+  8067d3:	41 5f                	pop    %r15
+  8067d5:	5d                   	pop    %rbp
+  8067d6:	c3                   	ret
+
+00000000008067d7 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8067d7:	55                   	push   %rbp
+  8067d8:	48 89 e5             	mov    %rsp,%rbp
+  8067db:	41 57                	push   %r15
+  8067dd:	53                   	push   %rbx
+  8067de:	48 83 ec 70          	sub    $0x70,%rsp
+  8067e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067e2 <ipc_callw+0xb>
+  8067e9:	49 bb 5e 28 00 00 00 	movabs $0x285e,%r11
+  8067f0:	00 00 00 
+  8067f3:	4c 01 db             	add    %r11,%rbx
+  8067f6:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8067f9:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8067fc:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  806800:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  806804:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  806809:	76 0a                	jbe    806815 <ipc_callw+0x3e>
+		return -E_INVAL;
+  80680b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806810:	e9 b7 00 00 00       	jmp    8068cc <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806815:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806819:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80681d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806821:	48 89 ce             	mov    %rcx,%rsi
+  806824:	48 89 c7             	mov    %rax,%rdi
+  806827:	49 89 df             	mov    %rbx,%r15
+  80682a:	48 b8 b4 88 ff ff ff 	movabs $0xffffffffffff88b4,%rax
+  806831:	ff ff ff 
+  806834:	48 01 d8             	add    %rbx,%rax
+  806837:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806839:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806840:	00 
+  806841:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806845:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806849:	48 01 d0             	add    %rdx,%rax
+  80684c:	48 83 e8 01          	sub    $0x1,%rax
+  806850:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806854:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806858:	ba 00 00 00 00       	mov    $0x0,%edx
+  80685d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806861:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806865:	48 29 d0             	sub    %rdx,%rax
+  806868:	48 c1 e8 03          	shr    $0x3,%rax
+  80686c:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806870:	89 c1                	mov    %eax,%ecx
+  806872:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806875:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806879:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80687c:	49 89 d1             	mov    %rdx,%r9
+  80687f:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806886:	00 00 00 
+  806889:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806890:	00 00 00 
+  806893:	89 c7                	mov    %eax,%edi
+  806895:	49 89 df             	mov    %rbx,%r15
+  806898:	48 b8 12 95 ff ff ff 	movabs $0xffffffffffff9512,%rax
+  80689f:	ff ff ff 
+  8068a2:	48 01 d8             	add    %rbx,%rax
+  8068a5:	ff d0                	call   *%rax
+  8068a7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8068aa:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8068ae:	74 05                	je     8068b5 <ipc_callw+0xde>
+		return r;
+  8068b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8068b3:	eb 17                	jmp    8068cc <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8068b5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068bc:	ff ff ff 
+  8068bf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068c3:	48 8b 00             	mov    (%rax),%rax
+  8068c6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8068cc:	48 83 c4 70          	add    $0x70,%rsp
+  8068d0:	5b                   	pop    %rbx
+  8068d1:	41 5f                	pop    %r15
+  8068d3:	5d                   	pop    %rbp
+  8068d4:	c3                   	ret
+
+00000000008068d5 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8068d5:	55                   	push   %rbp
+  8068d6:	48 89 e5             	mov    %rsp,%rbp
+  8068d9:	41 57                	push   %r15
+  8068db:	53                   	push   %rbx
+  8068dc:	48 83 ec 40          	sub    $0x40,%rsp
+  8068e0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068e0 <ipc_callv+0xb>
+  8068e7:	49 bb 60 27 00 00 00 	movabs $0x2760,%r11
+  8068ee:	00 00 00 
+  8068f1:	4c 01 db             	add    %r11,%rbx
+  8068f4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8068f7:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8068fa:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8068fe:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806901:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806905:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806909:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806910:	00 00 00 
+  806913:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806917:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80691b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80691f:	74 11                	je     806932 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806921:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806925:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806929:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80692c:	c1 e0 14             	shl    $0x14,%eax
+  80692f:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806932:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806936:	74 14                	je     80694c <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806938:	8b 45 20             	mov    0x20(%rbp),%eax
+  80693b:	83 e8 01             	sub    $0x1,%eax
+  80693e:	48 63 d0             	movslq %eax,%rdx
+  806941:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806945:	48 09 d0             	or     %rdx,%rax
+  806948:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  80694c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80694f:	c1 e0 10             	shl    $0x10,%eax
+  806952:	0b 45 10             	or     0x10(%rbp),%eax
+  806955:	89 c1                	mov    %eax,%ecx
+  806957:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80695a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80695e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806962:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806966:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806969:	4d 89 c1             	mov    %r8,%r9
+  80696c:	49 89 f8             	mov    %rdi,%r8
+  80696f:	89 c7                	mov    %eax,%edi
+  806971:	49 89 df             	mov    %rbx,%r15
+  806974:	48 b8 12 95 ff ff ff 	movabs $0xffffffffffff9512,%rax
+  80697b:	ff ff ff 
+  80697e:	48 01 d8             	add    %rbx,%rax
+  806981:	ff d0                	call   *%rax
+  806983:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806986:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80698a:	74 05                	je     806991 <ipc_callv+0xbc>
+		return r;
+  80698c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80698f:	eb 17                	jmp    8069a8 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806991:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806998:	ff ff ff 
+  80699b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80699f:	48 8b 00             	mov    (%rax),%rax
+  8069a2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8069a8:	48 83 c4 40          	add    $0x40,%rsp
+  8069ac:	5b                   	pop    %rbx
+  8069ad:	41 5f                	pop    %r15
+  8069af:	5d                   	pop    %rbp
+  8069b0:	c3                   	ret
+
+00000000008069b1 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8069b1:	55                   	push   %rbp
+  8069b2:	48 89 e5             	mov    %rsp,%rbp
+  8069b5:	41 57                	push   %r15
+  8069b7:	53                   	push   %rbx
+  8069b8:	48 83 ec 40          	sub    $0x40,%rsp
+  8069bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069bc <ipc_reply_recv+0xb>
+  8069c3:	49 bb 84 26 00 00 00 	movabs $0x2684,%r11
+  8069ca:	00 00 00 
+  8069cd:	4c 01 db             	add    %r11,%rbx
+  8069d0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8069d3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8069d6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8069da:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8069dd:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8069e1:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8069e5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8069ea:	75 0e                	jne    8069fa <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  8069ec:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8069f3:	00 00 00 
+  8069f6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8069fa:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8069ff:	75 0e                	jne    806a0f <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806a01:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806a08:	00 00 00 
+  806a0b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806a0f:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806a12:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806a16:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806a1a:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806a1d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806a21:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a24:	4d 89 c1             	mov    %r8,%r9
+  806a27:	49 89 f8             	mov    %rdi,%r8
+  806a2a:	89 c7                	mov    %eax,%edi
+  806a2c:	49 89 df             	mov    %rbx,%r15
+  806a2f:	48 b8 86 95 ff ff ff 	movabs $0xffffffffffff9586,%rax
+  806a36:	ff ff ff 
+  806a39:	48 01 d8             	add    %rbx,%rax
+  806a3c:	ff d0                	call   *%rax
+  806a3e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806a41:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806a46:	74 2a                	je     806a72 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806a48:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a4c:	75 19                	jne    806a67 <ipc_reply_recv+0xb6>
+  806a4e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a55:	ff ff ff 
+  806a58:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a5c:	48 8b 00             	mov    (%rax),%rax
+  806a5f:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806a65:	eb 05                	jmp    806a6c <ipc_reply_recv+0xbb>
+  806a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806a70:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806a72:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806a77:	74 2a                	je     806aa3 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806a79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a7d:	75 19                	jne    806a98 <ipc_reply_recv+0xe7>
+  806a7f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a86:	ff ff ff 
+  806a89:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a8d:	48 8b 00             	mov    (%rax),%rax
+  806a90:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806a96:	eb 05                	jmp    806a9d <ipc_reply_recv+0xec>
+  806a98:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a9d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806aa1:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806aa3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806aa7:	74 05                	je     806aae <ipc_reply_recv+0xfd>
+		return r;
+  806aa9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806aac:	eb 17                	jmp    806ac5 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806aae:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806ab5:	ff ff ff 
+  806ab8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806abc:	48 8b 00             	mov    (%rax),%rax
+  806abf:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806ac5:	48 83 c4 40          	add    $0x40,%rsp
+  806ac9:	5b                   	pop    %rbx
+  806aca:	41 5f                	pop    %r15
+  806acc:	5d                   	pop    %rbp
+  806acd:	c3                   	ret
+
+0000000000806ace <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806ace:	55                   	push   %rbp
+  806acf:	48 89 e5             	mov    %rsp,%rbp
+  806ad2:	41 57                	push   %r15
+  806ad4:	53                   	push   %rbx
+  806ad5:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806adc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806adc <ipc_window_batch+0xe>
+  806ae3:	49 bb 64 25 00 00 00 	movabs $0x2564,%r11
+  806aea:	00 00 00 
+  806aed:	4c 01 db             	add    %r11,%rbx
+  806af0:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806af6:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806afd:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806b03:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806b09:	e9 15 01 00 00       	jmp    806c23 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806b0e:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806b14:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806b17:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806b1e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806b21:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806b24:	39 c2                	cmp    %eax,%edx
+  806b26:	0f 4e c2             	cmovle %edx,%eax
+  806b29:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806b2c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806b33:	eb 6b                	jmp    806ba0 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806b35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b38:	48 98                	cltq
+  806b3a:	48 c1 e0 05          	shl    $0x5,%rax
+  806b3e:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806b42:	48 01 e8             	add    %rbp,%rax
+  806b45:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806b4b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806b51:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b54:	c1 e0 0c             	shl    $0xc,%eax
+  806b57:	48 63 d0             	movslq %eax,%rdx
+  806b5a:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806b61:	48 01 c2             	add    %rax,%rdx
+  806b64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b67:	48 98                	cltq
+  806b69:	48 c1 e0 05          	shl    $0x5,%rax
+  806b6d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806b71:	48 01 e8             	add    %rbp,%rax
+  806b74:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806b7a:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806b7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b80:	48 98                	cltq
+  806b82:	48 c1 e0 05          	shl    $0x5,%rax
+  806b86:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806b8a:	48 01 e8             	add    %rbp,%rax
+  806b8d:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806b94:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806b9a:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806b9c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806ba0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ba3:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806ba6:	7c 8d                	jl     806b35 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806ba8:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806baf:	74 27                	je     806bd8 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806bb1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806bb4:	48 63 d0             	movslq %eax,%rdx
+  806bb7:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806bbe:	48 89 d6             	mov    %rdx,%rsi
+  806bc1:	48 89 c7             	mov    %rax,%rdi
+  806bc4:	49 89 df             	mov    %rbx,%r15
+  806bc7:	48 b8 29 98 ff ff ff 	movabs $0xffffffffffff9829,%rax
+  806bce:	ff ff ff 
+  806bd1:	48 01 d8             	add    %rbx,%rax
+  806bd4:	ff d0                	call   *%rax
+  806bd6:	eb 25                	jmp    806bfd <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806bd8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806bdb:	48 63 d0             	movslq %eax,%rdx
+  806bde:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806be5:	48 89 d6             	mov    %rdx,%rsi
+  806be8:	48 89 c7             	mov    %rax,%rdi
+  806beb:	49 89 df             	mov    %rbx,%r15
+  806bee:	48 b8 87 98 ff ff ff 	movabs $0xffffffffffff9887,%rax
+  806bf5:	ff ff ff 
+  806bf8:	48 01 d8             	add    %rbx,%rax
+  806bfb:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806bfd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806c00:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806c04:	79 05                	jns    806c0b <ipc_window_batch+0x13d>
+			return r;
+  806c06:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806c09:	eb 2a                	jmp    806c35 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806c0b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806c0e:	c1 e0 0c             	shl    $0xc,%eax
+  806c11:	48 98                	cltq
+  806c13:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806c1a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806c1d:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806c23:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806c2a:	0f 8f de fe ff ff    	jg     806b0e <ipc_window_batch+0x40>
+	}
+	return 0;
+  806c30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806c35:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806c3c:	5b                   	pop    %rbx
+  806c3d:	41 5f                	pop    %r15
+  806c3f:	5d                   	pop    %rbp
+  806c40:	c3                   	ret
+
+0000000000806c41 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806c41:	55                   	push   %rbp
+  806c42:	48 89 e5             	mov    %rsp,%rbp
+  806c45:	48 83 ec 10          	sub    $0x10,%rsp
+  806c49:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806c49 <ipc_map_window+0x8>
+  806c50:	49 bb f7 23 00 00 00 	movabs $0x23f7,%r11
+  806c57:	00 00 00 
+  806c5a:	4c 01 d8             	add    %r11,%rax
+  806c5d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806c61:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806c64:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806c67:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806c6b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806c70:	bf 01 00 00 00       	mov    $0x1,%edi
+  806c75:	49 b8 8e da ff ff ff 	movabs $0xffffffffffffda8e,%r8
+  806c7c:	ff ff ff 
+  806c7f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806c83:	ff d0                	call   *%rax
+}
+  806c85:	c9                   	leave
+  806c86:	c3                   	ret
+
+0000000000806c87 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806c87:	55                   	push   %rbp
+  806c88:	48 89 e5             	mov    %rsp,%rbp
+  806c8b:	48 83 ec 10          	sub    $0x10,%rsp
+  806c8f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806c8f <ipc_unmap_window+0x8>
+  806c96:	49 bb b1 23 00 00 00 	movabs $0x23b1,%r11
+  806c9d:	00 00 00 
+  806ca0:	4c 01 d8             	add    %r11,%rax
+  806ca3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806ca7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806caa:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806cad:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806cb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806cb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  806cbb:	49 b8 8e da ff ff ff 	movabs $0xffffffffffffda8e,%r8
+  806cc2:	ff ff ff 
+  806cc5:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806cc9:	ff d0                	call   *%rax
+}
+  806ccb:	c9                   	leave
+  806ccc:	c3                   	ret
+
+0000000000806ccd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806ccd:	55                   	push   %rbp
+  806cce:	48 89 e5             	mov    %rsp,%rbp
+  806cd1:	48 83 ec 18          	sub    $0x18,%rsp
+  806cd5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806cd5 <ipc_find_env+0x8>
+  806cdc:	49 bb 6b 23 00 00 00 	movabs $0x236b,%r11
+  806ce3:	00 00 00 
+  806ce6:	4c 01 d8             	add    %r11,%rax
+  806ce9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806cec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806cf3:	eb 57                	jmp    806d4c <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806cf5:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806cfc:	ff ff ff 
+  806cff:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806d03:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806d06:	48 63 d2             	movslq %edx,%rdx
+  806d09:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806d10:	48 01 ca             	add    %rcx,%rdx
+  806d13:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806d1a:	8b 12                	mov    (%rdx),%edx
+  806d1c:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806d1f:	75 27                	jne    806d48 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806d21:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806d28:	ff ff ff 
+  806d2b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806d2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806d32:	48 98                	cltq
+  806d34:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806d3b:	48 01 d0             	add    %rdx,%rax
+  806d3e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806d44:	8b 00                	mov    (%rax),%eax
+  806d46:	eb 12                	jmp    806d5a <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806d48:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806d4c:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806d53:	7e a0                	jle    806cf5 <ipc_find_env+0x28>
+	}
+	return 0;
+  806d55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806d5a:	c9                   	leave
+  806d5b:	c3                   	ret
+
+0000000000806d5c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806d5c:	55                   	push   %rbp
+  806d5d:	48 89 e5             	mov    %rsp,%rbp
+  806d60:	48 83 ec 18          	sub    $0x18,%rsp
+  806d64:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d64 <pageref+0x8>
+  806d6b:	49 bb dc 22 00 00 00 	movabs $0x22dc,%r11
+  806d72:	00 00 00 
+  806d75:	4c 01 d8             	add    %r11,%rax
+  806d78:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806d7c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806d80:	48 89 d1             	mov    %rdx,%rcx
+  806d83:	48 c1 e9 15          	shr    $0x15,%rcx
+  806d87:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806d8e:	ff ff ff 
+  806d91:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806d95:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806d99:	83 e2 01             	and    $0x1,%edx
+  806d9c:	48 85 d2             	test   %rdx,%rdx
+  806d9f:	75 07                	jne    806da8 <pageref+0x4c>
+		return 0;
+  806da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  806da6:	eb 64                	jmp    806e0c <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806da8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806dac:	48 89 d1             	mov    %rdx,%rcx
+  806daf:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806db3:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806dba:	ff ff ff 
+  806dbd:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806dc1:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806dc5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806dc9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806dcd:	83 e2 01             	and    $0x1,%edx
+  806dd0:	48 85 d2             	test   %rdx,%rdx
+  806dd3:	75 07                	jne    806ddc <pageref+0x80>
+		return 0;
+  806dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  806dda:	eb 30                	jmp    806e0c <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806ddc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806de0:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806de4:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806deb:	ff ff ff 
+  806dee:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806df2:	48 89 d0             	mov    %rdx,%rax
+  806df5:	48 01 c0             	add    %rax,%rax
+  806df8:	48 01 d0             	add    %rdx,%rax
+  806dfb:	48 c1 e0 03          	shl    $0x3,%rax
+  806dff:	48 01 c8             	add    %rcx,%rax
+  806e02:	48 83 c0 08          	add    $0x8,%rax
+  806e06:	0f b7 00             	movzwl (%rax),%eax
+  806e09:	0f b7 c0             	movzwl %ax,%eax
+}
+  806e0c:	c9                   	leave
+  806e0d:	c3                   	ret
@@ -0,0 +1,10816 @@
+
+obj/user/testfdsharing:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 31 04 00 00       	call   800472 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r, n, n2;
+
+	if ((fd = open("motd", O_RDONLY)) < 0)
+  800069:	be 00 00 00 00       	mov    $0x0,%esi
+  80006e:	48 b8 a8 df ff ff ff 	movabs $0xffffffffffffdfa8,%rax
+  800075:	ff ff ff 
+  800078:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80007c:	48 89 c7             	mov    %rax,%rdi
+  80007f:	49 89 df             	mov    %rbx,%r15
+  800082:	48 b8 0c b4 ff ff ff 	movabs $0xffffffffffffb40c,%rax
+  800089:	ff ff ff 
+  80008c:	48 01 d8             	add    %rbx,%rax
+  80008f:	ff d0                	call   *%rax
+  800091:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800094:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800098:	79 44                	jns    8000de <umain+0x9b>
+		panic("open motd: %e", fd);
+  80009a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80009d:	89 c1                	mov    %eax,%ecx
+  80009f:	48 b8 ad df ff ff ff 	movabs $0xffffffffffffdfad,%rax
+  8000a6:	ff ff ff 
+  8000a9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000ad:	48 89 c2             	mov    %rax,%rdx
+  8000b0:	be 0c 00 00 00       	mov    $0xc,%esi
+  8000b5:	48 b8 bb df ff ff ff 	movabs $0xffffffffffffdfbb,%rax
+  8000bc:	ff ff ff 
+  8000bf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000c3:	48 89 c7             	mov    %rax,%rdi
+  8000c6:	49 89 df             	mov    %rbx,%r15
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b8 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r8
+  8000d5:	ff ff ff 
+  8000d8:	49 01 d8             	add    %rbx,%r8
+  8000db:	41 ff d0             	call   *%r8
+	seek(fd, 0);
+  8000de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e6:	89 c7                	mov    %eax,%edi
+  8000e8:	49 89 df             	mov    %rbx,%r15
+  8000eb:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  8000f2:	ff ff ff 
+  8000f5:	48 01 d8             	add    %rbx,%rax
+  8000f8:	ff d0                	call   *%rax
+	if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  8000fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000fd:	ba 00 02 00 00       	mov    $0x200,%edx
+  800102:	48 b9 e0 31 01 00 00 	movabs $0x131e0,%rcx
+  800109:	00 00 00 
+  80010c:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  800110:	48 89 ce             	mov    %rcx,%rsi
+  800113:	89 c7                	mov    %eax,%edi
+  800115:	49 89 df             	mov    %rbx,%r15
+  800118:	48 b8 50 ad ff ff ff 	movabs $0xffffffffffffad50,%rax
+  80011f:	ff ff ff 
+  800122:	48 01 d8             	add    %rbx,%rax
+  800125:	ff d0                	call   *%rax
+  800127:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  80012a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80012e:	7f 44                	jg     800174 <umain+0x131>
+		panic("readn: %e", n);
+  800130:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800133:	89 c1                	mov    %eax,%ecx
+  800135:	48 b8 d0 df ff ff ff 	movabs $0xffffffffffffdfd0,%rax
+  80013c:	ff ff ff 
+  80013f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800143:	48 89 c2             	mov    %rax,%rdx
+  800146:	be 0f 00 00 00       	mov    $0xf,%esi
+  80014b:	48 b8 bb df ff ff ff 	movabs $0xffffffffffffdfbb,%rax
+  800152:	ff ff ff 
+  800155:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800159:	48 89 c7             	mov    %rax,%rdi
+  80015c:	49 89 df             	mov    %rbx,%r15
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	49 b8 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r8
+  80016b:	ff ff ff 
+  80016e:	49 01 d8             	add    %rbx,%r8
+  800171:	41 ff d0             	call   *%r8
+
+	if ((r = fork()) < 0)
+  800174:	49 89 df             	mov    %rbx,%r15
+  800177:	48 b8 20 a2 ff ff ff 	movabs $0xffffffffffffa220,%rax
+  80017e:	ff ff ff 
+  800181:	48 01 d8             	add    %rbx,%rax
+  800184:	ff d0                	call   *%rax
+  800186:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  800189:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80018d:	79 44                	jns    8001d3 <umain+0x190>
+		panic("fork: %e", r);
+  80018f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800192:	89 c1                	mov    %eax,%ecx
+  800194:	48 b8 da df ff ff ff 	movabs $0xffffffffffffdfda,%rax
+  80019b:	ff ff ff 
+  80019e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001a2:	48 89 c2             	mov    %rax,%rdx
+  8001a5:	be 12 00 00 00       	mov    $0x12,%esi
+  8001aa:	48 b8 bb df ff ff ff 	movabs $0xffffffffffffdfbb,%rax
+  8001b1:	ff ff ff 
+  8001b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001b8:	48 89 c7             	mov    %rax,%rdi
+  8001bb:	49 89 df             	mov    %rbx,%r15
+  8001be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c3:	49 b8 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r8
+  8001ca:	ff ff ff 
+  8001cd:	49 01 d8             	add    %rbx,%r8
+  8001d0:	41 ff d0             	call   *%r8
+	if (r == 0) {
+  8001d3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8001d7:	0f 85 b1 01 00 00    	jne    80038e <umain+0x34b>
+		seek(fd, 0);
+  8001dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8001e5:	89 c7                	mov    %eax,%edi
+  8001e7:	49 89 df             	mov    %rbx,%r15
+  8001ea:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  8001f1:	ff ff ff 
+  8001f4:	48 01 d8             	add    %rbx,%rax
+  8001f7:	ff d0                	call   *%rax
+		cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  8001f9:	48 b8 e8 df ff ff ff 	movabs $0xffffffffffffdfe8,%rax
+  800200:	ff ff ff 
+  800203:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800207:	48 89 c7             	mov    %rax,%rdi
+  80020a:	49 89 df             	mov    %rbx,%r15
+  80020d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800212:	48 ba 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rdx
+  800219:	ff ff ff 
+  80021c:	48 01 da             	add    %rbx,%rdx
+  80021f:	ff d2                	call   *%rdx
+		if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800221:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800224:	ba 00 02 00 00       	mov    $0x200,%edx
+  800229:	48 b9 e0 2f 01 00 00 	movabs $0x12fe0,%rcx
+  800230:	00 00 00 
+  800233:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  800237:	48 89 ce             	mov    %rcx,%rsi
+  80023a:	89 c7                	mov    %eax,%edi
+  80023c:	49 89 df             	mov    %rbx,%r15
+  80023f:	48 b8 50 ad ff ff ff 	movabs $0xffffffffffffad50,%rax
+  800246:	ff ff ff 
+  800249:	48 01 d8             	add    %rbx,%rax
+  80024c:	ff d0                	call   *%rax
+  80024e:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  800251:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800254:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+  800257:	74 4a                	je     8002a3 <umain+0x260>
+			panic("read in parent got %d, read in child got %d", n, n2);
+  800259:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80025c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80025f:	41 89 d0             	mov    %edx,%r8d
+  800262:	89 c1                	mov    %eax,%ecx
+  800264:	48 b8 30 e0 ff ff ff 	movabs $0xffffffffffffe030,%rax
+  80026b:	ff ff ff 
+  80026e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800272:	48 89 c2             	mov    %rax,%rdx
+  800275:	be 17 00 00 00       	mov    $0x17,%esi
+  80027a:	48 b8 bb df ff ff ff 	movabs $0xffffffffffffdfbb,%rax
+  800281:	ff ff ff 
+  800284:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800288:	48 89 c7             	mov    %rax,%rdi
+  80028b:	49 89 df             	mov    %rbx,%r15
+  80028e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800293:	49 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r9
+  80029a:	ff ff ff 
+  80029d:	49 01 d9             	add    %rbx,%r9
+  8002a0:	41 ff d1             	call   *%r9
+		if (memcmp(buf, buf2, n) != 0)
+  8002a3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8002a6:	48 98                	cltq
+  8002a8:	48 89 c2             	mov    %rax,%rdx
+  8002ab:	48 b8 e0 2f 01 00 00 	movabs $0x12fe0,%rax
+  8002b2:	00 00 00 
+  8002b5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002b9:	48 89 c6             	mov    %rax,%rsi
+  8002bc:	48 b8 e0 31 01 00 00 	movabs $0x131e0,%rax
+  8002c3:	00 00 00 
+  8002c6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002ca:	48 89 c7             	mov    %rax,%rdi
+  8002cd:	49 89 df             	mov    %rbx,%r15
+  8002d0:	48 b8 29 8b ff ff ff 	movabs $0xffffffffffff8b29,%rax
+  8002d7:	ff ff ff 
+  8002da:	48 01 d8             	add    %rbx,%rax
+  8002dd:	ff d0                	call   *%rax
+  8002df:	85 c0                	test   %eax,%eax
+  8002e1:	74 3e                	je     800321 <umain+0x2de>
+			panic("read in parent got different bytes from read in child");
+  8002e3:	48 b8 60 e0 ff ff ff 	movabs $0xffffffffffffe060,%rax
+  8002ea:	ff ff ff 
+  8002ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002f1:	48 89 c2             	mov    %rax,%rdx
+  8002f4:	be 19 00 00 00       	mov    $0x19,%esi
+  8002f9:	48 b8 bb df ff ff ff 	movabs $0xffffffffffffdfbb,%rax
+  800300:	ff ff ff 
+  800303:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800307:	48 89 c7             	mov    %rax,%rdi
+  80030a:	49 89 df             	mov    %rbx,%r15
+  80030d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800312:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  800319:	ff ff ff 
+  80031c:	48 01 d9             	add    %rbx,%rcx
+  80031f:	ff d1                	call   *%rcx
+		cprintf("read in child succeeded\n");
+  800321:	48 b8 96 e0 ff ff ff 	movabs $0xffffffffffffe096,%rax
+  800328:	ff ff ff 
+  80032b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80032f:	48 89 c7             	mov    %rax,%rdi
+  800332:	49 89 df             	mov    %rbx,%r15
+  800335:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033a:	48 ba 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rdx
+  800341:	ff ff ff 
+  800344:	48 01 da             	add    %rbx,%rdx
+  800347:	ff d2                	call   *%rdx
+		seek(fd, 0);
+  800349:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80034c:	be 00 00 00 00       	mov    $0x0,%esi
+  800351:	89 c7                	mov    %eax,%edi
+  800353:	49 89 df             	mov    %rbx,%r15
+  800356:	48 b8 f5 ae ff ff ff 	movabs $0xffffffffffffaef5,%rax
+  80035d:	ff ff ff 
+  800360:	48 01 d8             	add    %rbx,%rax
+  800363:	ff d0                	call   *%rax
+		close(fd);
+  800365:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800368:	89 c7                	mov    %eax,%edi
+  80036a:	49 89 df             	mov    %rbx,%r15
+  80036d:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  800374:	ff ff ff 
+  800377:	48 01 d8             	add    %rbx,%rax
+  80037a:	ff d0                	call   *%rax
+		exit();
+  80037c:	49 89 df             	mov    %rbx,%r15
+  80037f:	48 b8 f2 74 ff ff ff 	movabs $0xffffffffffff74f2,%rax
+  800386:	ff ff ff 
+  800389:	48 01 d8             	add    %rbx,%rax
+  80038c:	ff d0                	call   *%rax
+	}
+	wait(r);
+  80038e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800391:	89 c7                	mov    %eax,%edi
+  800393:	49 89 df             	mov    %rbx,%r15
+  800396:	48 b8 f4 d0 ff ff ff 	movabs $0xffffffffffffd0f4,%rax
+  80039d:	ff ff ff 
+  8003a0:	48 01 d8             	add    %rbx,%rax
+  8003a3:	ff d0                	call   *%rax
+	if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8003a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003a8:	ba 00 02 00 00       	mov    $0x200,%edx
+  8003ad:	48 b9 e0 2f 01 00 00 	movabs $0x12fe0,%rcx
+  8003b4:	00 00 00 
+  8003b7:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  8003bb:	48 89 ce             	mov    %rcx,%rsi
+  8003be:	89 c7                	mov    %eax,%edi
+  8003c0:	49 89 df             	mov    %rbx,%r15
+  8003c3:	48 b8 50 ad ff ff ff 	movabs $0xffffffffffffad50,%rax
+  8003ca:	ff ff ff 
+  8003cd:	48 01 d8             	add    %rbx,%rax
+  8003d0:	ff d0                	call   *%rax
+  8003d2:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8003d5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003d8:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+  8003db:	74 4a                	je     800427 <umain+0x3e4>
+		panic("read in parent got %d, then got %d", n, n2);
+  8003dd:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8003e0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003e3:	41 89 d0             	mov    %edx,%r8d
+  8003e6:	89 c1                	mov    %eax,%ecx
+  8003e8:	48 b8 b0 e0 ff ff ff 	movabs $0xffffffffffffe0b0,%rax
+  8003ef:	ff ff ff 
+  8003f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003f6:	48 89 c2             	mov    %rax,%rdx
+  8003f9:	be 21 00 00 00       	mov    $0x21,%esi
+  8003fe:	48 b8 bb df ff ff ff 	movabs $0xffffffffffffdfbb,%rax
+  800405:	ff ff ff 
+  800408:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80040c:	48 89 c7             	mov    %rax,%rdi
+  80040f:	49 89 df             	mov    %rbx,%r15
+  800412:	b8 00 00 00 00       	mov    $0x0,%eax
+  800417:	49 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r9
+  80041e:	ff ff ff 
+  800421:	49 01 d9             	add    %rbx,%r9
+  800424:	41 ff d1             	call   *%r9
+	cprintf("read in parent succeeded\n");
+  800427:	48 b8 d3 e0 ff ff ff 	movabs $0xffffffffffffe0d3,%rax
+  80042e:	ff ff ff 
+  800431:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800435:	48 89 c7             	mov    %rax,%rdi
+  800438:	49 89 df             	mov    %rbx,%r15
+  80043b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800440:	48 ba 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rdx
+  800447:	ff ff ff 
+  80044a:	48 01 da             	add    %rbx,%rdx
+  80044d:	ff d2                	call   *%rdx
+	close(fd);
+  80044f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800452:	89 c7                	mov    %eax,%edi
+  800454:	49 89 df             	mov    %rbx,%r15
+  800457:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  80045e:	ff ff ff 
+  800461:	48 01 d8             	add    %rbx,%rax
+  800464:	ff d0                	call   *%rax
+static __inline void read_gdtr (uint64_t *gdtbase, uint16_t *gdtlimit) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  800466:	cc                   	int3
+}
+  800467:	90                   	nop
+
+	breakpoint();
+}
+  800468:	90                   	nop
+  800469:	48 83 c4 20          	add    $0x20,%rsp
+  80046d:	5b                   	pop    %rbx
+  80046e:	41 5f                	pop    %r15
+  800470:	5d                   	pop    %rbp
+  800471:	c3                   	ret
+
+0000000000800472 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800472:	55                   	push   %rbp
+  800473:	48 89 e5             	mov    %rsp,%rbp
+  800476:	41 57                	push   %r15
+  800478:	53                   	push   %rbx
+  800479:	48 83 ec 20          	sub    $0x20,%rsp
+  80047d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80047d <libmain+0xb>
+  800484:	49 bb c3 8b 00 00 00 	movabs $0x8bc3,%r11
+  80048b:	00 00 00 
+  80048e:	4c 01 db             	add    %r11,%rbx
+  800491:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800494:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800498:	49 89 df             	mov    %rbx,%r15
+  80049b:	48 b8 e8 91 ff ff ff 	movabs $0xffffffffffff91e8,%rax
+  8004a2:	ff ff ff 
+  8004a5:	48 01 d8             	add    %rbx,%rax
+  8004a8:	ff d0                	call   *%rax
+  8004aa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8004ad:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004b0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004b5:	48 98                	cltq
+  8004b7:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8004be:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8004c5:	ff ff ff 
+  8004c8:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8004cc:	48 01 c2             	add    %rax,%rdx
+  8004cf:	48 b8 e0 33 01 00 00 	movabs $0x133e0,%rax
+  8004d6:	00 00 00 
+  8004d9:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004dd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8004e1:	7e 15                	jle    8004f8 <libmain+0x86>
+		binaryname = argv[0];
+  8004e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004e7:	48 8b 00             	mov    (%rax),%rax
+  8004ea:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8004f1:	00 00 00 
+  8004f4:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8004f8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8004fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004ff:	48 89 d6             	mov    %rdx,%rsi
+  800502:	89 c7                	mov    %eax,%edi
+  800504:	49 89 df             	mov    %rbx,%r15
+  800507:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  80050e:	ff ff ff 
+  800511:	48 01 d8             	add    %rbx,%rax
+  800514:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800516:	49 89 df             	mov    %rbx,%r15
+  800519:	48 b8 f2 74 ff ff ff 	movabs $0xffffffffffff74f2,%rax
+  800520:	ff ff ff 
+  800523:	48 01 d8             	add    %rbx,%rax
+  800526:	ff d0                	call   *%rax
+}
+  800528:	90                   	nop
+  800529:	48 83 c4 20          	add    $0x20,%rsp
+  80052d:	5b                   	pop    %rbx
+  80052e:	41 5f                	pop    %r15
+  800530:	5d                   	pop    %rbp
+  800531:	c3                   	ret
+
+0000000000800532 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800532:	55                   	push   %rbp
+  800533:	48 89 e5             	mov    %rsp,%rbp
+  800536:	41 57                	push   %r15
+  800538:	53                   	push   %rbx
+  800539:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800539 <exit+0x7>
+  800540:	49 bb 07 8b 00 00 00 	movabs $0x8b07,%r11
+  800547:	00 00 00 
+  80054a:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80054d:	49 89 df             	mov    %rbx,%r15
+  800550:	48 b8 f1 a9 ff ff ff 	movabs $0xffffffffffffa9f1,%rax
+  800557:	ff ff ff 
+  80055a:	48 01 d8             	add    %rbx,%rax
+  80055d:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80055f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800564:	49 89 df             	mov    %rbx,%r15
+  800567:	48 b8 8c 91 ff ff ff 	movabs $0xffffffffffff918c,%rax
+  80056e:	ff ff ff 
+  800571:	48 01 d8             	add    %rbx,%rax
+  800574:	ff d0                	call   *%rax
+}
+  800576:	90                   	nop
+  800577:	5b                   	pop    %rbx
+  800578:	41 5f                	pop    %r15
+  80057a:	5d                   	pop    %rbp
+  80057b:	c3                   	ret
+
+000000000080057c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80057c:	55                   	push   %rbp
+  80057d:	48 89 e5             	mov    %rsp,%rbp
+  800580:	41 57                	push   %r15
+  800582:	41 54                	push   %r12
+  800584:	53                   	push   %rbx
+  800585:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80058c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80058c <_panic+0x10>
+  800593:	49 bb b4 8a 00 00 00 	movabs $0x8ab4,%r11
+  80059a:	00 00 00 
+  80059d:	4c 01 db             	add    %r11,%rbx
+  8005a0:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8005a7:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8005ad:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8005b4:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8005bb:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8005c2:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8005c9:	84 c0                	test   %al,%al
+  8005cb:	74 26                	je     8005f3 <_panic+0x77>
+  8005cd:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8005d4:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8005db:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8005df:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8005e3:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8005e7:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8005eb:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8005ef:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005f3:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8005fa:	00 00 00 
+  8005fd:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  800604:	00 00 00 
+  800607:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80060b:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  800612:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800619:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800620:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800627:	ff ff ff 
+  80062a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80062e:	4c 8b 20             	mov    (%rax),%r12
+  800631:	49 89 df             	mov    %rbx,%r15
+  800634:	48 b8 e8 91 ff ff ff 	movabs $0xffffffffffff91e8,%rax
+  80063b:	ff ff ff 
+  80063e:	48 01 d8             	add    %rbx,%rax
+  800641:	ff d0                	call   *%rax
+  800643:	89 c6                	mov    %eax,%esi
+  800645:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  80064b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800652:	41 89 d0             	mov    %edx,%r8d
+  800655:	48 89 c1             	mov    %rax,%rcx
+  800658:	4c 89 e2             	mov    %r12,%rdx
+  80065b:	48 b8 f8 e0 ff ff ff 	movabs $0xffffffffffffe0f8,%rax
+  800662:	ff ff ff 
+  800665:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800669:	48 89 c7             	mov    %rax,%rdi
+  80066c:	49 89 df             	mov    %rbx,%r15
+  80066f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800674:	49 b9 13 78 ff ff ff 	movabs $0xffffffffffff7813,%r9
+  80067b:	ff ff ff 
+  80067e:	49 01 d9             	add    %rbx,%r9
+  800681:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800684:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80068b:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  800692:	48 89 d6             	mov    %rdx,%rsi
+  800695:	48 89 c7             	mov    %rax,%rdi
+  800698:	49 89 df             	mov    %rbx,%r15
+  80069b:	48 b8 33 77 ff ff ff 	movabs $0xffffffffffff7733,%rax
+  8006a2:	ff ff ff 
+  8006a5:	48 01 d8             	add    %rbx,%rax
+  8006a8:	ff d0                	call   *%rax
+	cprintf("\n");
+  8006aa:	48 b8 1b e1 ff ff ff 	movabs $0xffffffffffffe11b,%rax
+  8006b1:	ff ff ff 
+  8006b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006b8:	48 89 c7             	mov    %rax,%rdi
+  8006bb:	49 89 df             	mov    %rbx,%r15
+  8006be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c3:	48 ba 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rdx
+  8006ca:	ff ff ff 
+  8006cd:	48 01 da             	add    %rbx,%rdx
+  8006d0:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006d2:	cc                   	int3
+  8006d3:	eb fd                	jmp    8006d2 <_panic+0x156>
+
+00000000008006d5 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8006d5:	55                   	push   %rbp
+  8006d6:	48 89 e5             	mov    %rsp,%rbp
+  8006d9:	41 57                	push   %r15
+  8006db:	48 83 ec 18          	sub    $0x18,%rsp
+  8006df:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006df <putch+0xa>
+  8006e6:	49 bb 61 89 00 00 00 	movabs $0x8961,%r11
+  8006ed:	00 00 00 
+  8006f0:	4c 01 d8             	add    %r11,%rax
+  8006f3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8006f6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8006fa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006fe:	8b 12                	mov    (%rdx),%edx
+  800700:	8d 72 01             	lea    0x1(%rdx),%esi
+  800703:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800707:	89 31                	mov    %esi,(%rcx)
+  800709:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  80070c:	89 ce                	mov    %ecx,%esi
+  80070e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800712:	48 63 d2             	movslq %edx,%rdx
+  800715:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80071a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80071e:	8b 12                	mov    (%rdx),%edx
+  800720:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800726:	75 33                	jne    80075b <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800728:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80072c:	8b 12                	mov    (%rdx),%edx
+  80072e:	48 63 d2             	movslq %edx,%rdx
+  800731:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800735:	48 83 c1 08          	add    $0x8,%rcx
+  800739:	48 89 d6             	mov    %rdx,%rsi
+  80073c:	48 89 cf             	mov    %rcx,%rdi
+  80073f:	49 89 c7             	mov    %rax,%r15
+  800742:	48 ba d9 90 ff ff ff 	movabs $0xffffffffffff90d9,%rdx
+  800749:	ff ff ff 
+  80074c:	48 01 c2             	add    %rax,%rdx
+  80074f:	ff d2                	call   *%rdx
+        b->idx = 0;
+  800751:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800755:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  80075b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80075f:	8b 40 04             	mov    0x4(%rax),%eax
+  800762:	8d 50 01             	lea    0x1(%rax),%edx
+  800765:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800769:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80076c:	90                   	nop
+  80076d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  800771:	c9                   	leave
+  800772:	c3                   	ret
+
+0000000000800773 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  800773:	55                   	push   %rbp
+  800774:	48 89 e5             	mov    %rsp,%rbp
+  800777:	41 57                	push   %r15
+  800779:	53                   	push   %rbx
+  80077a:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  800781:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800781 <vcprintf+0xe>
+  800788:	49 bb bf 88 00 00 00 	movabs $0x88bf,%r11
+  80078f:	00 00 00 
+  800792:	4c 01 db             	add    %r11,%rbx
+  800795:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  80079c:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8007a3:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8007aa:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8007b1:	48 8b 06             	mov    (%rsi),%rax
+  8007b4:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007b8:	48 89 01             	mov    %rax,(%rcx)
+  8007bb:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007bf:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007c3:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8007c7:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8007ce:	00 00 00 
+    b.cnt = 0;
+  8007d1:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8007d8:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8007db:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8007e2:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8007e9:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8007f0:	48 89 c6             	mov    %rax,%rsi
+  8007f3:	48 b8 95 76 ff ff ff 	movabs $0xffffffffffff7695,%rax
+  8007fa:	ff ff ff 
+  8007fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800801:	48 89 c7             	mov    %rax,%rdi
+  800804:	49 89 df             	mov    %rbx,%r15
+  800807:	48 b8 57 7c ff ff ff 	movabs $0xffffffffffff7c57,%rax
+  80080e:	ff ff ff 
+  800811:	48 01 d8             	add    %rbx,%rax
+  800814:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800816:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  80081c:	48 98                	cltq
+  80081e:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800825:	48 83 c2 08          	add    $0x8,%rdx
+  800829:	48 89 c6             	mov    %rax,%rsi
+  80082c:	48 89 d7             	mov    %rdx,%rdi
+  80082f:	49 89 df             	mov    %rbx,%r15
+  800832:	48 b8 d9 90 ff ff ff 	movabs $0xffffffffffff90d9,%rax
+  800839:	ff ff ff 
+  80083c:	48 01 d8             	add    %rbx,%rax
+  80083f:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  800841:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800847:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  80084e:	5b                   	pop    %rbx
+  80084f:	41 5f                	pop    %r15
+  800851:	5d                   	pop    %rbp
+  800852:	c3                   	ret
+
+0000000000800853 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  800853:	55                   	push   %rbp
+  800854:	48 89 e5             	mov    %rsp,%rbp
+  800857:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  80085e:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80085e <cprintf+0xb>
+  800865:	49 bb e2 87 00 00 00 	movabs $0x87e2,%r11
+  80086c:	00 00 00 
+  80086f:	4d 01 da             	add    %r11,%r10
+  800872:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800879:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800880:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800887:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80088e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800895:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80089c:	84 c0                	test   %al,%al
+  80089e:	74 20                	je     8008c0 <cprintf+0x6d>
+  8008a0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8008a4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8008a8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8008ac:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8008b0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8008b4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8008b8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8008bc:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8008c0:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8008c7:	00 00 00 
+  8008ca:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8008d1:	00 00 00 
+  8008d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008d8:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8008df:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8008e6:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8008ed:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8008f4:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8008fb:	48 8b 06             	mov    (%rsi),%rax
+  8008fe:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800902:	48 89 01             	mov    %rax,(%rcx)
+  800905:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800909:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80090d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800911:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800918:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80091f:	48 89 d6             	mov    %rdx,%rsi
+  800922:	48 89 c7             	mov    %rax,%rdi
+  800925:	48 b8 33 77 ff ff ff 	movabs $0xffffffffffff7733,%rax
+  80092c:	ff ff ff 
+  80092f:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800933:	ff d0                	call   *%rax
+  800935:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80093b:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800941:	c9                   	leave
+  800942:	c3                   	ret
+
+0000000000800943 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800943:	55                   	push   %rbp
+  800944:	48 89 e5             	mov    %rsp,%rbp
+  800947:	53                   	push   %rbx
+  800948:	48 83 ec 38          	sub    $0x38,%rsp
+  80094c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80094c <printnum+0x9>
+  800953:	49 bb f4 86 00 00 00 	movabs $0x86f4,%r11
+  80095a:	00 00 00 
+  80095d:	4c 01 db             	add    %r11,%rbx
+  800960:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800964:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800968:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80096c:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  80096f:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  800973:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800977:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80097a:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80097e:	72 58                	jb     8009d8 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800980:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800983:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800986:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800989:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80098d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800992:	48 f7 f6             	div    %rsi
+  800995:	49 89 c2             	mov    %rax,%r10
+  800998:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80099b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80099e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8009a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a6:	41 89 c9             	mov    %ecx,%r9d
+  8009a9:	41 89 f8             	mov    %edi,%r8d
+  8009ac:	89 d1                	mov    %edx,%ecx
+  8009ae:	4c 89 d2             	mov    %r10,%rdx
+  8009b1:	48 89 c7             	mov    %rax,%rdi
+  8009b4:	48 b8 03 79 ff ff ff 	movabs $0xffffffffffff7903,%rax
+  8009bb:	ff ff ff 
+  8009be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009c2:	ff d0                	call   *%rax
+  8009c4:	eb 1c                	jmp    8009e2 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009c6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8009ca:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8009cd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009d1:	48 89 d6             	mov    %rdx,%rsi
+  8009d4:	89 c7                	mov    %eax,%edi
+  8009d6:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8009d8:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8009dc:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8009e0:	7f e4                	jg     8009c6 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8009e2:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8009e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ee:	48 f7 f1             	div    %rcx
+  8009f1:	48 b8 57 e2 ff ff ff 	movabs $0xffffffffffffe257,%rax
+  8009f8:	ff ff ff 
+  8009fb:	48 01 d8             	add    %rbx,%rax
+  8009fe:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800a02:	0f be c0             	movsbl %al,%eax
+  800a05:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a09:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a0d:	48 89 d6             	mov    %rdx,%rsi
+  800a10:	89 c7                	mov    %eax,%edi
+  800a12:	ff d1                	call   *%rcx
+}
+  800a14:	90                   	nop
+  800a15:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a19:	c9                   	leave
+  800a1a:	c3                   	ret
+
+0000000000800a1b <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800a1b:	55                   	push   %rbp
+  800a1c:	48 89 e5             	mov    %rsp,%rbp
+  800a1f:	48 83 ec 20          	sub    $0x20,%rsp
+  800a23:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a23 <getuint+0x8>
+  800a2a:	49 bb 1d 86 00 00 00 	movabs $0x861d,%r11
+  800a31:	00 00 00 
+  800a34:	4c 01 d8             	add    %r11,%rax
+  800a37:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a3b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800a3e:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a42:	7e 4f                	jle    800a93 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800a44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a48:	8b 00                	mov    (%rax),%eax
+  800a4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4d:	77 24                	ja     800a73 <getuint+0x58>
+  800a4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a53:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a5b:	8b 00                	mov    (%rax),%eax
+  800a5d:	89 c0                	mov    %eax,%eax
+  800a5f:	48 01 d0             	add    %rdx,%rax
+  800a62:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a66:	8b 12                	mov    (%rdx),%edx
+  800a68:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a6b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a6f:	89 0a                	mov    %ecx,(%rdx)
+  800a71:	eb 14                	jmp    800a87 <getuint+0x6c>
+  800a73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a77:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a7b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a7f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a83:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a87:	48 8b 00             	mov    (%rax),%rax
+  800a8a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a8e:	e9 9d 00 00 00       	jmp    800b30 <getuint+0x115>
+	else if (lflag)
+  800a93:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800a97:	74 4c                	je     800ae5 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800a99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a9d:	8b 00                	mov    (%rax),%eax
+  800a9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa2:	77 24                	ja     800ac8 <getuint+0xad>
+  800aa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800aac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab0:	8b 00                	mov    (%rax),%eax
+  800ab2:	89 c0                	mov    %eax,%eax
+  800ab4:	48 01 d0             	add    %rdx,%rax
+  800ab7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800abb:	8b 12                	mov    (%rdx),%edx
+  800abd:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ac0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ac4:	89 0a                	mov    %ecx,(%rdx)
+  800ac6:	eb 14                	jmp    800adc <getuint+0xc1>
+  800ac8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800acc:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ad0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ad4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ad8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800adc:	48 8b 00             	mov    (%rax),%rax
+  800adf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800ae3:	eb 4b                	jmp    800b30 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800ae5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae9:	8b 00                	mov    (%rax),%eax
+  800aeb:	83 f8 2f             	cmp    $0x2f,%eax
+  800aee:	77 24                	ja     800b14 <getuint+0xf9>
+  800af0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800af8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afc:	8b 00                	mov    (%rax),%eax
+  800afe:	89 c0                	mov    %eax,%eax
+  800b00:	48 01 d0             	add    %rdx,%rax
+  800b03:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b07:	8b 12                	mov    (%rdx),%edx
+  800b09:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b0c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b10:	89 0a                	mov    %ecx,(%rdx)
+  800b12:	eb 14                	jmp    800b28 <getuint+0x10d>
+  800b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b18:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b1c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b24:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b28:	8b 00                	mov    (%rax),%eax
+  800b2a:	89 c0                	mov    %eax,%eax
+  800b2c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b34:	c9                   	leave
+  800b35:	c3                   	ret
+
+0000000000800b36 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800b36:	55                   	push   %rbp
+  800b37:	48 89 e5             	mov    %rsp,%rbp
+  800b3a:	48 83 ec 20          	sub    $0x20,%rsp
+  800b3e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b3e <printfloat+0x8>
+  800b45:	49 bb 02 85 00 00 00 	movabs $0x8502,%r11
+  800b4c:	00 00 00 
+  800b4f:	4c 01 d8             	add    %r11,%rax
+  800b52:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800b56:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800b5a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800b5e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b62:	48 85 c0             	test   %rax,%rax
+  800b65:	79 12                	jns    800b79 <printfloat+0x43>
+		putch('-',putdat);
+  800b67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b6b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b6f:	48 89 c6             	mov    %rax,%rsi
+  800b72:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b77:	ff d2                	call   *%rdx
+	
+}
+  800b79:	90                   	nop
+  800b7a:	c9                   	leave
+  800b7b:	c3                   	ret
+
+0000000000800b7c <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800b7c:	55                   	push   %rbp
+  800b7d:	48 89 e5             	mov    %rsp,%rbp
+  800b80:	48 83 ec 20          	sub    $0x20,%rsp
+  800b84:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b84 <getint+0x8>
+  800b8b:	49 bb bc 84 00 00 00 	movabs $0x84bc,%r11
+  800b92:	00 00 00 
+  800b95:	4c 01 d8             	add    %r11,%rax
+  800b98:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b9c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800b9f:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800ba3:	7e 4f                	jle    800bf4 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800ba5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba9:	8b 00                	mov    (%rax),%eax
+  800bab:	83 f8 2f             	cmp    $0x2f,%eax
+  800bae:	77 24                	ja     800bd4 <getint+0x58>
+  800bb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bb4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800bb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bbc:	8b 00                	mov    (%rax),%eax
+  800bbe:	89 c0                	mov    %eax,%eax
+  800bc0:	48 01 d0             	add    %rdx,%rax
+  800bc3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bc7:	8b 12                	mov    (%rdx),%edx
+  800bc9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bcc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bd0:	89 0a                	mov    %ecx,(%rdx)
+  800bd2:	eb 14                	jmp    800be8 <getint+0x6c>
+  800bd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bd8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bdc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800be0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800be4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800be8:	48 8b 00             	mov    (%rax),%rax
+  800beb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800bef:	e9 9d 00 00 00       	jmp    800c91 <getint+0x115>
+	else if (lflag)
+  800bf4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800bf8:	74 4c                	je     800c46 <getint+0xca>
+		x=va_arg(*ap, long);
+  800bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bfe:	8b 00                	mov    (%rax),%eax
+  800c00:	83 f8 2f             	cmp    $0x2f,%eax
+  800c03:	77 24                	ja     800c29 <getint+0xad>
+  800c05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c09:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c11:	8b 00                	mov    (%rax),%eax
+  800c13:	89 c0                	mov    %eax,%eax
+  800c15:	48 01 d0             	add    %rdx,%rax
+  800c18:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c1c:	8b 12                	mov    (%rdx),%edx
+  800c1e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c21:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c25:	89 0a                	mov    %ecx,(%rdx)
+  800c27:	eb 14                	jmp    800c3d <getint+0xc1>
+  800c29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c2d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c31:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c35:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c39:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c3d:	48 8b 00             	mov    (%rax),%rax
+  800c40:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c44:	eb 4b                	jmp    800c91 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800c46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c4a:	8b 00                	mov    (%rax),%eax
+  800c4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4f:	77 24                	ja     800c75 <getint+0xf9>
+  800c51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c55:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c5d:	8b 00                	mov    (%rax),%eax
+  800c5f:	89 c0                	mov    %eax,%eax
+  800c61:	48 01 d0             	add    %rdx,%rax
+  800c64:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c68:	8b 12                	mov    (%rdx),%edx
+  800c6a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c6d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c71:	89 0a                	mov    %ecx,(%rdx)
+  800c73:	eb 14                	jmp    800c89 <getint+0x10d>
+  800c75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c79:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c7d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c85:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c89:	8b 00                	mov    (%rax),%eax
+  800c8b:	48 98                	cltq
+  800c8d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800c91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800c95:	c9                   	leave
+  800c96:	c3                   	ret
+
+0000000000800c97 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800c97:	55                   	push   %rbp
+  800c98:	48 89 e5             	mov    %rsp,%rbp
+  800c9b:	41 57                	push   %r15
+  800c9d:	41 55                	push   %r13
+  800c9f:	41 54                	push   %r12
+  800ca1:	53                   	push   %rbx
+  800ca2:	48 83 ec 60          	sub    $0x60,%rsp
+  800ca6:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800ca6 <vprintfmt+0xf>
+  800cad:	49 bb 9a 83 00 00 00 	movabs $0x839a,%r11
+  800cb4:	00 00 00 
+  800cb7:	4d 01 dc             	add    %r11,%r12
+  800cba:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800cbe:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800cc2:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800cc6:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800cca:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800cd1:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800cd5:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800cd9:	48 8b 06             	mov    (%rsi),%rax
+  800cdc:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800ce0:	48 89 01             	mov    %rax,(%rcx)
+  800ce3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ce7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ceb:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800cef:	eb 17                	jmp    800d08 <vprintfmt+0x71>
+			if (ch == '\0')
+  800cf1:	85 db                	test   %ebx,%ebx
+  800cf3:	0f 84 97 05 00 00    	je     801290 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800cf9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cfd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d01:	48 89 c6             	mov    %rax,%rsi
+  800d04:	89 df                	mov    %ebx,%edi
+  800d06:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d08:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d0c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d10:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d14:	0f b6 00             	movzbl (%rax),%eax
+  800d17:	0f b6 d8             	movzbl %al,%ebx
+  800d1a:	83 fb 25             	cmp    $0x25,%ebx
+  800d1d:	75 d2                	jne    800cf1 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800d1f:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800d23:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800d2a:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800d31:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800d38:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800d3f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d43:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d47:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d4b:	0f b6 00             	movzbl (%rax),%eax
+  800d4e:	0f b6 d8             	movzbl %al,%ebx
+  800d51:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800d54:	83 f8 55             	cmp    $0x55,%eax
+  800d57:	0f 87 00 05 00 00    	ja     80125d <vprintfmt+0x5c6>
+  800d5d:	89 c0                	mov    %eax,%eax
+  800d5f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800d66:	00 
+  800d67:	48 8d 05 52 65 00 00 	lea    0x6552(%rip),%rax        # 8072c0 <.LC18+0xc>
+  800d6e:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800d72:	48 8d 15 47 65 00 00 	lea    0x6547(%rip),%rdx        # 8072c0 <.LC18+0xc>
+  800d79:	48 01 d0             	add    %rdx,%rax
+  800d7c:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800d7e:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800d82:	eb bb                	jmp    800d3f <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800d84:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800d88:	eb b5                	jmp    800d3f <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800d8a:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800d91:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800d94:	89 d0                	mov    %edx,%eax
+  800d96:	c1 e0 02             	shl    $0x2,%eax
+  800d99:	01 d0                	add    %edx,%eax
+  800d9b:	01 c0                	add    %eax,%eax
+  800d9d:	01 d8                	add    %ebx,%eax
+  800d9f:	83 e8 30             	sub    $0x30,%eax
+  800da2:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800da5:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800da9:	0f b6 00             	movzbl (%rax),%eax
+  800dac:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800daf:	83 fb 2f             	cmp    $0x2f,%ebx
+  800db2:	7e 60                	jle    800e14 <vprintfmt+0x17d>
+  800db4:	83 fb 39             	cmp    $0x39,%ebx
+  800db7:	7f 5b                	jg     800e14 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800db9:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800dbe:	eb d1                	jmp    800d91 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800dc0:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800dc3:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc6:	77 17                	ja     800ddf <vprintfmt+0x148>
+  800dc8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dcc:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dcf:	89 d2                	mov    %edx,%edx
+  800dd1:	48 01 d0             	add    %rdx,%rax
+  800dd4:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dd7:	83 c2 08             	add    $0x8,%edx
+  800dda:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ddd:	eb 0c                	jmp    800deb <vprintfmt+0x154>
+  800ddf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800de3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800de7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800deb:	8b 00                	mov    (%rax),%eax
+  800ded:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800df0:	eb 23                	jmp    800e15 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800df2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800df6:	0f 89 43 ff ff ff    	jns    800d3f <vprintfmt+0xa8>
+				width = 0;
+  800dfc:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800e03:	e9 37 ff ff ff       	jmp    800d3f <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800e08:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800e0f:	e9 2b ff ff ff       	jmp    800d3f <vprintfmt+0xa8>
+			goto process_precision;
+  800e14:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800e15:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e19:	0f 89 20 ff ff ff    	jns    800d3f <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800e1f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800e22:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800e25:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800e2c:	e9 0e ff ff ff       	jmp    800d3f <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800e31:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800e35:	e9 05 ff ff ff       	jmp    800d3f <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800e3a:	83 fb 39             	cmp    $0x39,%ebx
+  800e3d:	7f 0b                	jg     800e4a <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800e3f:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800e42:	c1 e0 08             	shl    $0x8,%eax
+  800e45:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e48:	eb 21                	jmp    800e6b <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800e4a:	83 fb 60             	cmp    $0x60,%ebx
+  800e4d:	7e 10                	jle    800e5f <vprintfmt+0x1c8>
+  800e4f:	83 fb 66             	cmp    $0x66,%ebx
+  800e52:	7f 0b                	jg     800e5f <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800e54:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800e57:	c1 e0 08             	shl    $0x8,%eax
+  800e5a:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e5d:	eb 0c                	jmp    800e6b <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800e5f:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800e66:	e9 04 01 00 00       	jmp    800f6f <vprintfmt+0x2d8>
+  800e6b:	e9 ff 00 00 00       	jmp    800f6f <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800e70:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e73:	83 f8 2f             	cmp    $0x2f,%eax
+  800e76:	77 17                	ja     800e8f <vprintfmt+0x1f8>
+  800e78:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e7c:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e7f:	89 d2                	mov    %edx,%edx
+  800e81:	48 01 d0             	add    %rdx,%rax
+  800e84:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e87:	83 c2 08             	add    $0x8,%edx
+  800e8a:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e8d:	eb 0c                	jmp    800e9b <vprintfmt+0x204>
+  800e8f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e93:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e97:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e9b:	8b 00                	mov    (%rax),%eax
+  800e9d:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800ea1:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800ea5:	48 89 d6             	mov    %rdx,%rsi
+  800ea8:	89 c7                	mov    %eax,%edi
+  800eaa:	ff d1                	call   *%rcx
+			break;
+  800eac:	e9 da 03 00 00       	jmp    80128b <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800eb1:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800eb4:	83 f8 2f             	cmp    $0x2f,%eax
+  800eb7:	77 17                	ja     800ed0 <vprintfmt+0x239>
+  800eb9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ebd:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ec0:	89 d2                	mov    %edx,%edx
+  800ec2:	48 01 d0             	add    %rdx,%rax
+  800ec5:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ec8:	83 c2 08             	add    $0x8,%edx
+  800ecb:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ece:	eb 0c                	jmp    800edc <vprintfmt+0x245>
+  800ed0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ed4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ed8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800edc:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800ede:	85 db                	test   %ebx,%ebx
+  800ee0:	79 02                	jns    800ee4 <vprintfmt+0x24d>
+				err = -err;
+  800ee2:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800ee4:	83 fb 15             	cmp    $0x15,%ebx
+  800ee7:	7f 19                	jg     800f02 <vprintfmt+0x26b>
+  800ee9:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800ef0:	00 00 00 
+  800ef3:	48 63 c3             	movslq %ebx,%rax
+  800ef6:	4c 01 e2             	add    %r12,%rdx
+  800ef9:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800efd:	4d 85 ed             	test   %r13,%r13
+  800f00:	75 36                	jne    800f38 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800f02:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f06:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f0a:	89 d9                	mov    %ebx,%ecx
+  800f0c:	48 ba 68 e2 ff ff ff 	movabs $0xffffffffffffe268,%rdx
+  800f13:	ff ff ff 
+  800f16:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f1a:	48 89 c7             	mov    %rax,%rdi
+  800f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f22:	49 b8 5e 82 ff ff ff 	movabs $0xffffffffffff825e,%r8
+  800f29:	ff ff ff 
+  800f2c:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f30:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800f33:	e9 53 03 00 00       	jmp    80128b <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800f38:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f3c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f40:	4c 89 e9             	mov    %r13,%rcx
+  800f43:	48 ba 71 e2 ff ff ff 	movabs $0xffffffffffffe271,%rdx
+  800f4a:	ff ff ff 
+  800f4d:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f51:	48 89 c7             	mov    %rax,%rdi
+  800f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f59:	49 b8 5e 82 ff ff ff 	movabs $0xffffffffffff825e,%r8
+  800f60:	ff ff ff 
+  800f63:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f67:	41 ff d0             	call   *%r8
+			break;
+  800f6a:	e9 1c 03 00 00       	jmp    80128b <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800f6f:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f72:	83 f8 2f             	cmp    $0x2f,%eax
+  800f75:	77 17                	ja     800f8e <vprintfmt+0x2f7>
+  800f77:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f7b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f7e:	89 d2                	mov    %edx,%edx
+  800f80:	48 01 d0             	add    %rdx,%rax
+  800f83:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f86:	83 c2 08             	add    $0x8,%edx
+  800f89:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f8c:	eb 0c                	jmp    800f9a <vprintfmt+0x303>
+  800f8e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f92:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f96:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f9a:	4c 8b 28             	mov    (%rax),%r13
+  800f9d:	4d 85 ed             	test   %r13,%r13
+  800fa0:	75 0e                	jne    800fb0 <vprintfmt+0x319>
+				p = "(null)";
+  800fa2:	48 b8 74 e2 ff ff ff 	movabs $0xffffffffffffe274,%rax
+  800fa9:	ff ff ff 
+  800fac:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800fb0:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800fb4:	0f 8e 84 00 00 00    	jle    80103e <vprintfmt+0x3a7>
+  800fba:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800fbe:	74 7e                	je     80103e <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800fc0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800fc3:	48 98                	cltq
+  800fc5:	48 89 c6             	mov    %rax,%rsi
+  800fc8:	4c 89 ef             	mov    %r13,%rdi
+  800fcb:	4d 89 e7             	mov    %r12,%r15
+  800fce:	48 b8 83 85 ff ff ff 	movabs $0xffffffffffff8583,%rax
+  800fd5:	ff ff ff 
+  800fd8:	4c 01 e0             	add    %r12,%rax
+  800fdb:	ff d0                	call   *%rax
+  800fdd:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800fe0:	eb 17                	jmp    800ff9 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800fe2:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800fe6:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800fea:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800fee:	48 89 d6             	mov    %rdx,%rsi
+  800ff1:	89 c7                	mov    %eax,%edi
+  800ff3:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ff5:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ff9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ffd:	7f e3                	jg     800fe2 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800fff:	eb 3d                	jmp    80103e <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801001:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  801005:	74 1e                	je     801025 <vprintfmt+0x38e>
+  801007:	83 fb 1f             	cmp    $0x1f,%ebx
+  80100a:	7e 05                	jle    801011 <vprintfmt+0x37a>
+  80100c:	83 fb 7e             	cmp    $0x7e,%ebx
+  80100f:	7e 14                	jle    801025 <vprintfmt+0x38e>
+					putch('?', putdat);
+  801011:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801015:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801019:	48 89 c6             	mov    %rax,%rsi
+  80101c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801021:	ff d2                	call   *%rdx
+  801023:	eb 15                	jmp    80103a <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  801025:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801028:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  80102b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80102f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801033:	48 89 c6             	mov    %rax,%rsi
+  801036:	89 cf                	mov    %ecx,%edi
+  801038:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80103a:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  80103e:	4c 89 e8             	mov    %r13,%rax
+  801041:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801045:	0f b6 00             	movzbl (%rax),%eax
+  801048:	0f be d8             	movsbl %al,%ebx
+  80104b:	85 db                	test   %ebx,%ebx
+  80104d:	74 28                	je     801077 <vprintfmt+0x3e0>
+  80104f:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801053:	78 ac                	js     801001 <vprintfmt+0x36a>
+  801055:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801059:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80105d:	79 a2                	jns    801001 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  80105f:	eb 16                	jmp    801077 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  801061:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801065:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801069:	48 89 c6             	mov    %rax,%rsi
+  80106c:	bf 20 00 00 00       	mov    $0x20,%edi
+  801071:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801073:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801077:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80107b:	7f e4                	jg     801061 <vprintfmt+0x3ca>
+			break;
+  80107d:	e9 09 02 00 00       	jmp    80128b <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  801082:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801086:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80108a:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  80108e:	0f b6 00             	movzbl (%rax),%eax
+  801091:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801094:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801095:	83 fb 2f             	cmp    $0x2f,%ebx
+  801098:	0f 8e ac fd ff ff    	jle    800e4a <vprintfmt+0x1b3>
+  80109e:	e9 97 fd ff ff       	jmp    800e3a <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  8010a3:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010a7:	be 03 00 00 00       	mov    $0x3,%esi
+  8010ac:	48 89 c7             	mov    %rax,%rdi
+  8010af:	48 b8 3c 7b ff ff ff 	movabs $0xffffffffffff7b3c,%rax
+  8010b6:	ff ff ff 
+  8010b9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010bd:	ff d0                	call   *%rax
+  8010bf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8010c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010c7:	48 85 c0             	test   %rax,%rax
+  8010ca:	79 1d                	jns    8010e9 <vprintfmt+0x452>
+				putch('-', putdat);
+  8010cc:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010d0:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010d4:	48 89 c6             	mov    %rax,%rsi
+  8010d7:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8010dc:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8010de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010e2:	48 f7 d8             	neg    %rax
+  8010e5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8010e9:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8010f0:	e9 de 00 00 00       	jmp    8011d3 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8010f5:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010f9:	be 03 00 00 00       	mov    $0x3,%esi
+  8010fe:	48 89 c7             	mov    %rax,%rdi
+  801101:	48 b8 db 79 ff ff ff 	movabs $0xffffffffffff79db,%rax
+  801108:	ff ff ff 
+  80110b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80110f:	ff d0                	call   *%rax
+  801111:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801115:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80111c:	e9 b2 00 00 00       	jmp    8011d3 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801121:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801125:	be 03 00 00 00       	mov    $0x3,%esi
+  80112a:	48 89 c7             	mov    %rax,%rdi
+  80112d:	48 b8 db 79 ff ff ff 	movabs $0xffffffffffff79db,%rax
+  801134:	ff ff ff 
+  801137:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80113b:	ff d0                	call   *%rax
+  80113d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801141:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801148:	e9 86 00 00 00       	jmp    8011d3 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  80114d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801151:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801155:	48 89 c6             	mov    %rax,%rsi
+  801158:	bf 30 00 00 00       	mov    $0x30,%edi
+  80115d:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  80115f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801163:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801167:	48 89 c6             	mov    %rax,%rsi
+  80116a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80116f:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801171:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801174:	83 f8 2f             	cmp    $0x2f,%eax
+  801177:	77 17                	ja     801190 <vprintfmt+0x4f9>
+  801179:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80117d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801180:	89 d2                	mov    %edx,%edx
+  801182:	48 01 d0             	add    %rdx,%rax
+  801185:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801188:	83 c2 08             	add    $0x8,%edx
+  80118b:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  80118e:	eb 0c                	jmp    80119c <vprintfmt+0x505>
+  801190:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801194:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801198:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80119c:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  80119f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8011a3:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8011aa:	eb 27                	jmp    8011d3 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8011ac:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011b0:	be 03 00 00 00       	mov    $0x3,%esi
+  8011b5:	48 89 c7             	mov    %rax,%rdi
+  8011b8:	48 b8 db 79 ff ff ff 	movabs $0xffffffffffff79db,%rax
+  8011bf:	ff ff ff 
+  8011c2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011c6:	ff d0                	call   *%rax
+  8011c8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8011cc:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8011d3:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8011d8:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8011db:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8011de:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8011e2:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8011e6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8011ea:	45 89 c1             	mov    %r8d,%r9d
+  8011ed:	41 89 f8             	mov    %edi,%r8d
+  8011f0:	48 89 c7             	mov    %rax,%rdi
+  8011f3:	48 b8 03 79 ff ff ff 	movabs $0xffffffffffff7903,%rax
+  8011fa:	ff ff ff 
+  8011fd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801201:	ff d0                	call   *%rax
+			break;
+  801203:	e9 83 00 00 00       	jmp    80128b <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801208:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80120c:	be 03 00 00 00       	mov    $0x3,%esi
+  801211:	48 89 c7             	mov    %rax,%rdi
+  801214:	48 b8 db 79 ff ff ff 	movabs $0xffffffffffff79db,%rax
+  80121b:	ff ff ff 
+  80121e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801222:	ff d0                	call   *%rax
+  801224:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801228:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80122c:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801230:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801234:	48 89 ce             	mov    %rcx,%rsi
+  801237:	48 89 c7             	mov    %rax,%rdi
+  80123a:	48 b8 f6 7a ff ff ff 	movabs $0xffffffffffff7af6,%rax
+  801241:	ff ff ff 
+  801244:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801248:	ff d0                	call   *%rax
+	
+			break;
+  80124a:	eb 3f                	jmp    80128b <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  80124c:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801250:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801254:	48 89 c6             	mov    %rax,%rsi
+  801257:	89 df                	mov    %ebx,%edi
+  801259:	ff d2                	call   *%rdx
+			break;
+  80125b:	eb 2e                	jmp    80128b <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  80125d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801261:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801265:	48 89 c6             	mov    %rax,%rsi
+  801268:	bf 25 00 00 00       	mov    $0x25,%edi
+  80126d:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80126f:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801274:	eb 05                	jmp    80127b <vprintfmt+0x5e4>
+  801276:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80127b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80127f:	48 83 e8 01          	sub    $0x1,%rax
+  801283:	0f b6 00             	movzbl (%rax),%eax
+  801286:	3c 25                	cmp    $0x25,%al
+  801288:	75 ec                	jne    801276 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  80128a:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80128b:	e9 78 fa ff ff       	jmp    800d08 <vprintfmt+0x71>
+				return;
+  801290:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801291:	48 83 c4 60          	add    $0x60,%rsp
+  801295:	5b                   	pop    %rbx
+  801296:	41 5c                	pop    %r12
+  801298:	41 5d                	pop    %r13
+  80129a:	41 5f                	pop    %r15
+  80129c:	5d                   	pop    %rbp
+  80129d:	c3                   	ret
+
+000000000080129e <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  80129e:	55                   	push   %rbp
+  80129f:	48 89 e5             	mov    %rsp,%rbp
+  8012a2:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8012a9:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8012a9 <printfmt+0xb>
+  8012b0:	49 bb 97 7d 00 00 00 	movabs $0x7d97,%r11
+  8012b7:	00 00 00 
+  8012ba:	4d 01 da             	add    %r11,%r10
+  8012bd:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8012c4:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8012cb:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8012d2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8012d9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8012e0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8012e7:	84 c0                	test   %al,%al
+  8012e9:	74 20                	je     80130b <printfmt+0x6d>
+  8012eb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8012ef:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8012f3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012f7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8012fb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012ff:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801303:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801307:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80130b:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801312:	00 00 00 
+  801315:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80131c:	00 00 00 
+  80131f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801323:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80132a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801331:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801338:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80133f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801346:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80134d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801354:	48 89 c7             	mov    %rax,%rdi
+  801357:	48 b8 57 7c ff ff ff 	movabs $0xffffffffffff7c57,%rax
+  80135e:	ff ff ff 
+  801361:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801365:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801367:	90                   	nop
+  801368:	c9                   	leave
+  801369:	c3                   	ret
+
+000000000080136a <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80136a:	55                   	push   %rbp
+  80136b:	48 89 e5             	mov    %rsp,%rbp
+  80136e:	48 83 ec 10          	sub    $0x10,%rsp
+  801372:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801372 <sprintputch+0x8>
+  801379:	49 bb ce 7c 00 00 00 	movabs $0x7cce,%r11
+  801380:	00 00 00 
+  801383:	4c 01 d8             	add    %r11,%rax
+  801386:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801389:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  80138d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801391:	8b 40 10             	mov    0x10(%rax),%eax
+  801394:	8d 50 01             	lea    0x1(%rax),%edx
+  801397:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80139b:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  80139e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013a2:	48 8b 10             	mov    (%rax),%rdx
+  8013a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013a9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013ad:	48 39 c2             	cmp    %rax,%rdx
+  8013b0:	73 17                	jae    8013c9 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8013b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013b6:	48 8b 00             	mov    (%rax),%rax
+  8013b9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013bd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013c1:	48 89 0a             	mov    %rcx,(%rdx)
+  8013c4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8013c7:	88 10                	mov    %dl,(%rax)
+}
+  8013c9:	90                   	nop
+  8013ca:	c9                   	leave
+  8013cb:	c3                   	ret
+
+00000000008013cc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8013cc:	55                   	push   %rbp
+  8013cd:	48 89 e5             	mov    %rsp,%rbp
+  8013d0:	53                   	push   %rbx
+  8013d1:	48 83 ec 58          	sub    $0x58,%rsp
+  8013d5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013d5 <vsnprintf+0x9>
+  8013dc:	49 bb 6b 7c 00 00 00 	movabs $0x7c6b,%r11
+  8013e3:	00 00 00 
+  8013e6:	4c 01 d8             	add    %r11,%rax
+  8013e9:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8013ed:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8013f0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8013f4:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8013f8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8013fc:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801400:	48 8b 0e             	mov    (%rsi),%rcx
+  801403:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801407:	48 89 0a             	mov    %rcx,(%rdx)
+  80140a:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  80140e:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801412:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801416:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80141a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80141e:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801421:	48 63 d2             	movslq %edx,%rdx
+  801424:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801428:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80142c:	48 01 ca             	add    %rcx,%rdx
+  80142f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801433:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80143a:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80143f:	74 06                	je     801447 <vsnprintf+0x7b>
+  801441:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  801445:	7f 07                	jg     80144e <vsnprintf+0x82>
+		return -E_INVAL;
+  801447:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80144c:	eb 34                	jmp    801482 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  80144e:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  801452:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801456:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80145a:	48 bf 2a 83 ff ff ff 	movabs $0xffffffffffff832a,%rdi
+  801461:	ff ff ff 
+  801464:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801468:	49 b8 57 7c ff ff ff 	movabs $0xffffffffffff7c57,%r8
+  80146f:	ff ff ff 
+  801472:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801476:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801478:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80147c:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  80147f:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  801482:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801486:	c9                   	leave
+  801487:	c3                   	ret
+
+0000000000801488 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801488:	55                   	push   %rbp
+  801489:	48 89 e5             	mov    %rsp,%rbp
+  80148c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801493:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801493 <snprintf+0xb>
+  80149a:	49 bb ad 7b 00 00 00 	movabs $0x7bad,%r11
+  8014a1:	00 00 00 
+  8014a4:	4d 01 da             	add    %r11,%r10
+  8014a7:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8014ae:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8014b4:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8014bb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8014c2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8014c9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8014d0:	84 c0                	test   %al,%al
+  8014d2:	74 20                	je     8014f4 <snprintf+0x6c>
+  8014d4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8014d8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8014dc:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8014e0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8014e4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8014e8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8014ec:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8014f0:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8014f4:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8014fb:	00 00 00 
+  8014fe:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801505:	00 00 00 
+  801508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80150c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801513:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80151a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801521:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801528:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80152f:	48 8b 06             	mov    (%rsi),%rax
+  801532:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801536:	48 89 01             	mov    %rax,(%rcx)
+  801539:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80153d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  801541:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  801545:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80154c:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  801553:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801559:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801560:	48 89 c7             	mov    %rax,%rdi
+  801563:	48 b8 8c 83 ff ff ff 	movabs $0xffffffffffff838c,%rax
+  80156a:	ff ff ff 
+  80156d:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801571:	ff d0                	call   *%rax
+  801573:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801579:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80157f:	c9                   	leave
+  801580:	c3                   	ret
+
+0000000000801581 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801581:	55                   	push   %rbp
+  801582:	48 89 e5             	mov    %rsp,%rbp
+  801585:	48 83 ec 18          	sub    $0x18,%rsp
+  801589:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801589 <strlen+0x8>
+  801590:	49 bb b7 7a 00 00 00 	movabs $0x7ab7,%r11
+  801597:	00 00 00 
+  80159a:	4c 01 d8             	add    %r11,%rax
+  80159d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8015a1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015a8:	eb 09                	jmp    8015b3 <strlen+0x32>
+		n++;
+  8015aa:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8015ae:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b7:	0f b6 00             	movzbl (%rax),%eax
+  8015ba:	84 c0                	test   %al,%al
+  8015bc:	75 ec                	jne    8015aa <strlen+0x29>
+	return n;
+  8015be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+
+00000000008015c3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8015cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015cb <strnlen+0x8>
+  8015d2:	49 bb 75 7a 00 00 00 	movabs $0x7a75,%r11
+  8015d9:	00 00 00 
+  8015dc:	4c 01 d8             	add    %r11,%rax
+  8015df:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015e3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015e7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015ee:	eb 0e                	jmp    8015fe <strnlen+0x3b>
+		n++;
+  8015f0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015f4:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015f9:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8015fe:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801603:	74 0b                	je     801610 <strnlen+0x4d>
+  801605:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801609:	0f b6 00             	movzbl (%rax),%eax
+  80160c:	84 c0                	test   %al,%al
+  80160e:	75 e0                	jne    8015f0 <strnlen+0x2d>
+	return n;
+  801610:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801613:	c9                   	leave
+  801614:	c3                   	ret
+
+0000000000801615 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801615:	55                   	push   %rbp
+  801616:	48 89 e5             	mov    %rsp,%rbp
+  801619:	48 83 ec 20          	sub    $0x20,%rsp
+  80161d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80161d <strcpy+0x8>
+  801624:	49 bb 23 7a 00 00 00 	movabs $0x7a23,%r11
+  80162b:	00 00 00 
+  80162e:	4c 01 d8             	add    %r11,%rax
+  801631:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801635:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801639:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80163d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  801641:	90                   	nop
+  801642:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801646:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80164a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80164e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801652:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801656:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80165a:	0f b6 12             	movzbl (%rdx),%edx
+  80165d:	88 10                	mov    %dl,(%rax)
+  80165f:	0f b6 00             	movzbl (%rax),%eax
+  801662:	84 c0                	test   %al,%al
+  801664:	75 dc                	jne    801642 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80166a:	c9                   	leave
+  80166b:	c3                   	ret
+
+000000000080166c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80166c:	55                   	push   %rbp
+  80166d:	48 89 e5             	mov    %rsp,%rbp
+  801670:	53                   	push   %rbx
+  801671:	48 83 ec 20          	sub    $0x20,%rsp
+  801675:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801675 <strcat+0x9>
+  80167c:	49 bb cb 79 00 00 00 	movabs $0x79cb,%r11
+  801683:	00 00 00 
+  801686:	4c 01 db             	add    %r11,%rbx
+  801689:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  80168d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  801691:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801695:	48 89 c7             	mov    %rax,%rdi
+  801698:	48 b8 41 85 ff ff ff 	movabs $0xffffffffffff8541,%rax
+  80169f:	ff ff ff 
+  8016a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016a6:	ff d0                	call   *%rax
+  8016a8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8016ab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016ae:	48 63 d0             	movslq %eax,%rdx
+  8016b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016b5:	48 01 c2             	add    %rax,%rdx
+  8016b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016bc:	48 89 c6             	mov    %rax,%rsi
+  8016bf:	48 89 d7             	mov    %rdx,%rdi
+  8016c2:	48 b8 d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rax
+  8016c9:	ff ff ff 
+  8016cc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016d0:	ff d0                	call   *%rax
+	return dst;
+  8016d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8016d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016da:	c9                   	leave
+  8016db:	c3                   	ret
+
+00000000008016dc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8016dc:	55                   	push   %rbp
+  8016dd:	48 89 e5             	mov    %rsp,%rbp
+  8016e0:	48 83 ec 28          	sub    $0x28,%rsp
+  8016e4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016e4 <strncpy+0x8>
+  8016eb:	49 bb 5c 79 00 00 00 	movabs $0x795c,%r11
+  8016f2:	00 00 00 
+  8016f5:	4c 01 d8             	add    %r11,%rax
+  8016f8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016fc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801700:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801704:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801708:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  80170c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801713:	00 
+  801714:	eb 2a                	jmp    801740 <strncpy+0x64>
+		*dst++ = *src;
+  801716:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80171a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80171e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801722:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801726:	0f b6 12             	movzbl (%rdx),%edx
+  801729:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80172b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80172f:	0f b6 00             	movzbl (%rax),%eax
+  801732:	84 c0                	test   %al,%al
+  801734:	74 05                	je     80173b <strncpy+0x5f>
+			src++;
+  801736:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80173b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801740:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801744:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801748:	72 cc                	jb     801716 <strncpy+0x3a>
+	}
+	return ret;
+  80174a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80174e:	c9                   	leave
+  80174f:	c3                   	ret
+
+0000000000801750 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801750:	55                   	push   %rbp
+  801751:	48 89 e5             	mov    %rsp,%rbp
+  801754:	48 83 ec 28          	sub    $0x28,%rsp
+  801758:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801758 <strlcpy+0x8>
+  80175f:	49 bb e8 78 00 00 00 	movabs $0x78e8,%r11
+  801766:	00 00 00 
+  801769:	4c 01 d8             	add    %r11,%rax
+  80176c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801770:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801774:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801778:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80177c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  801780:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801785:	74 3d                	je     8017c4 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801787:	eb 1d                	jmp    8017a6 <strlcpy+0x56>
+			*dst++ = *src++;
+  801789:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80178d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801791:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801795:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801799:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80179d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017a1:	0f b6 12             	movzbl (%rdx),%edx
+  8017a4:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8017a6:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8017ab:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017b0:	74 0b                	je     8017bd <strlcpy+0x6d>
+  8017b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017b6:	0f b6 00             	movzbl (%rax),%eax
+  8017b9:	84 c0                	test   %al,%al
+  8017bb:	75 cc                	jne    801789 <strlcpy+0x39>
+		*dst = '\0';
+  8017bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c1:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8017c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c8:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8017cc:	c9                   	leave
+  8017cd:	c3                   	ret
+
+00000000008017ce <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8017ce:	55                   	push   %rbp
+  8017cf:	48 89 e5             	mov    %rsp,%rbp
+  8017d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8017d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017d6 <strcmp+0x8>
+  8017dd:	49 bb 6a 78 00 00 00 	movabs $0x786a,%r11
+  8017e4:	00 00 00 
+  8017e7:	4c 01 d8             	add    %r11,%rax
+  8017ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8017f2:	eb 0a                	jmp    8017fe <strcmp+0x30>
+		p++, q++;
+  8017f4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017f9:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8017fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801802:	0f b6 00             	movzbl (%rax),%eax
+  801805:	84 c0                	test   %al,%al
+  801807:	74 12                	je     80181b <strcmp+0x4d>
+  801809:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180d:	0f b6 10             	movzbl (%rax),%edx
+  801810:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801814:	0f b6 00             	movzbl (%rax),%eax
+  801817:	38 c2                	cmp    %al,%dl
+  801819:	74 d9                	je     8017f4 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80181b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181f:	0f b6 00             	movzbl (%rax),%eax
+  801822:	0f b6 d0             	movzbl %al,%edx
+  801825:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801829:	0f b6 00             	movzbl (%rax),%eax
+  80182c:	0f b6 c0             	movzbl %al,%eax
+  80182f:	29 c2                	sub    %eax,%edx
+  801831:	89 d0                	mov    %edx,%eax
+}
+  801833:	c9                   	leave
+  801834:	c3                   	ret
+
+0000000000801835 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801835:	55                   	push   %rbp
+  801836:	48 89 e5             	mov    %rsp,%rbp
+  801839:	48 83 ec 18          	sub    $0x18,%rsp
+  80183d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80183d <strncmp+0x8>
+  801844:	49 bb 03 78 00 00 00 	movabs $0x7803,%r11
+  80184b:	00 00 00 
+  80184e:	4c 01 d8             	add    %r11,%rax
+  801851:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801855:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801859:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80185d:	eb 0f                	jmp    80186e <strncmp+0x39>
+		n--, p++, q++;
+  80185f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801864:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801869:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  80186e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801873:	74 1d                	je     801892 <strncmp+0x5d>
+  801875:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801879:	0f b6 00             	movzbl (%rax),%eax
+  80187c:	84 c0                	test   %al,%al
+  80187e:	74 12                	je     801892 <strncmp+0x5d>
+  801880:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801884:	0f b6 10             	movzbl (%rax),%edx
+  801887:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80188b:	0f b6 00             	movzbl (%rax),%eax
+  80188e:	38 c2                	cmp    %al,%dl
+  801890:	74 cd                	je     80185f <strncmp+0x2a>
+	if (n == 0)
+  801892:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801897:	75 07                	jne    8018a0 <strncmp+0x6b>
+		return 0;
+  801899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189e:	eb 16                	jmp    8018b6 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8018a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a4:	0f b6 00             	movzbl (%rax),%eax
+  8018a7:	0f b6 d0             	movzbl %al,%edx
+  8018aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ae:	0f b6 00             	movzbl (%rax),%eax
+  8018b1:	0f b6 c0             	movzbl %al,%eax
+  8018b4:	29 c2                	sub    %eax,%edx
+}
+  8018b6:	89 d0                	mov    %edx,%eax
+  8018b8:	c9                   	leave
+  8018b9:	c3                   	ret
+
+00000000008018ba <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8018ba:	55                   	push   %rbp
+  8018bb:	48 89 e5             	mov    %rsp,%rbp
+  8018be:	48 83 ec 10          	sub    $0x10,%rsp
+  8018c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018c2 <strchr+0x8>
+  8018c9:	49 bb 7e 77 00 00 00 	movabs $0x777e,%r11
+  8018d0:	00 00 00 
+  8018d3:	4c 01 d8             	add    %r11,%rax
+  8018d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018da:	89 f0                	mov    %esi,%eax
+  8018dc:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8018df:	eb 17                	jmp    8018f8 <strchr+0x3e>
+		if (*s == c)
+  8018e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e5:	0f b6 00             	movzbl (%rax),%eax
+  8018e8:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8018eb:	75 06                	jne    8018f3 <strchr+0x39>
+			return (char *) s;
+  8018ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f1:	eb 15                	jmp    801908 <strchr+0x4e>
+	for (; *s; s++)
+  8018f3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018fc:	0f b6 00             	movzbl (%rax),%eax
+  8018ff:	84 c0                	test   %al,%al
+  801901:	75 de                	jne    8018e1 <strchr+0x27>
+	return 0;
+  801903:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801908:	c9                   	leave
+  801909:	c3                   	ret
+
+000000000080190a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80190a:	55                   	push   %rbp
+  80190b:	48 89 e5             	mov    %rsp,%rbp
+  80190e:	48 83 ec 10          	sub    $0x10,%rsp
+  801912:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801912 <strfind+0x8>
+  801919:	49 bb 2e 77 00 00 00 	movabs $0x772e,%r11
+  801920:	00 00 00 
+  801923:	4c 01 d8             	add    %r11,%rax
+  801926:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80192a:	89 f0                	mov    %esi,%eax
+  80192c:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  80192f:	eb 11                	jmp    801942 <strfind+0x38>
+		if (*s == c)
+  801931:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801935:	0f b6 00             	movzbl (%rax),%eax
+  801938:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80193b:	74 12                	je     80194f <strfind+0x45>
+	for (; *s; s++)
+  80193d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801942:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801946:	0f b6 00             	movzbl (%rax),%eax
+  801949:	84 c0                	test   %al,%al
+  80194b:	75 e4                	jne    801931 <strfind+0x27>
+  80194d:	eb 01                	jmp    801950 <strfind+0x46>
+			break;
+  80194f:	90                   	nop
+	return (char *) s;
+  801950:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801954:	c9                   	leave
+  801955:	c3                   	ret
+
+0000000000801956 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801956:	55                   	push   %rbp
+  801957:	48 89 e5             	mov    %rsp,%rbp
+  80195a:	48 83 ec 18          	sub    $0x18,%rsp
+  80195e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80195e <memset+0x8>
+  801965:	49 bb e2 76 00 00 00 	movabs $0x76e2,%r11
+  80196c:	00 00 00 
+  80196f:	4c 01 d8             	add    %r11,%rax
+  801972:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801976:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801979:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  80197d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801982:	75 06                	jne    80198a <memset+0x34>
+		return v;
+  801984:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801988:	eb 69                	jmp    8019f3 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  80198a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80198e:	83 e0 03             	and    $0x3,%eax
+  801991:	48 85 c0             	test   %rax,%rax
+  801994:	75 48                	jne    8019de <memset+0x88>
+  801996:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80199a:	83 e0 03             	and    $0x3,%eax
+  80199d:	48 85 c0             	test   %rax,%rax
+  8019a0:	75 3c                	jne    8019de <memset+0x88>
+		c &= 0xFF;
+  8019a2:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8019a9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019ac:	c1 e0 18             	shl    $0x18,%eax
+  8019af:	89 c2                	mov    %eax,%edx
+  8019b1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019b4:	c1 e0 10             	shl    $0x10,%eax
+  8019b7:	09 c2                	or     %eax,%edx
+  8019b9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019bc:	c1 e0 08             	shl    $0x8,%eax
+  8019bf:	09 d0                	or     %edx,%eax
+  8019c1:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8019c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019c8:	48 c1 e8 02          	shr    $0x2,%rax
+  8019cc:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8019cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019d6:	48 89 d7             	mov    %rdx,%rdi
+  8019d9:	fc                   	cld
+  8019da:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8019dc:	eb 11                	jmp    8019ef <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8019de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019e2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019e5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019e9:	48 89 d7             	mov    %rdx,%rdi
+  8019ec:	fc                   	cld
+  8019ed:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8019ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8019f3:	c9                   	leave
+  8019f4:	c3                   	ret
+
+00000000008019f5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8019f5:	55                   	push   %rbp
+  8019f6:	48 89 e5             	mov    %rsp,%rbp
+  8019f9:	48 83 ec 28          	sub    $0x28,%rsp
+  8019fd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019fd <memmove+0x8>
+  801a04:	49 bb 43 76 00 00 00 	movabs $0x7643,%r11
+  801a0b:	00 00 00 
+  801a0e:	4c 01 d8             	add    %r11,%rax
+  801a11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a15:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a19:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801a1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a21:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801a25:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a29:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801a2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a31:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801a35:	0f 83 88 00 00 00    	jae    801ac3 <memmove+0xce>
+  801a3b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a3f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a43:	48 01 d0             	add    %rdx,%rax
+  801a46:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801a4a:	73 77                	jae    801ac3 <memmove+0xce>
+		s += n;
+  801a4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a50:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801a54:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a58:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801a5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a60:	83 e0 03             	and    $0x3,%eax
+  801a63:	48 85 c0             	test   %rax,%rax
+  801a66:	75 3b                	jne    801aa3 <memmove+0xae>
+  801a68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a6c:	83 e0 03             	and    $0x3,%eax
+  801a6f:	48 85 c0             	test   %rax,%rax
+  801a72:	75 2f                	jne    801aa3 <memmove+0xae>
+  801a74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a78:	83 e0 03             	and    $0x3,%eax
+  801a7b:	48 85 c0             	test   %rax,%rax
+  801a7e:	75 23                	jne    801aa3 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801a80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a84:	48 83 e8 04          	sub    $0x4,%rax
+  801a88:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a8c:	48 83 ea 04          	sub    $0x4,%rdx
+  801a90:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a94:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801a98:	48 89 c7             	mov    %rax,%rdi
+  801a9b:	48 89 d6             	mov    %rdx,%rsi
+  801a9e:	fd                   	std
+  801a9f:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801aa1:	eb 1d                	jmp    801ac0 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801aa3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801aab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aaf:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801ab3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ab7:	48 89 d7             	mov    %rdx,%rdi
+  801aba:	48 89 c1             	mov    %rax,%rcx
+  801abd:	fd                   	std
+  801abe:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801ac0:	fc                   	cld
+  801ac1:	eb 57                	jmp    801b1a <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801ac3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac7:	83 e0 03             	and    $0x3,%eax
+  801aca:	48 85 c0             	test   %rax,%rax
+  801acd:	75 36                	jne    801b05 <memmove+0x110>
+  801acf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ad3:	83 e0 03             	and    $0x3,%eax
+  801ad6:	48 85 c0             	test   %rax,%rax
+  801ad9:	75 2a                	jne    801b05 <memmove+0x110>
+  801adb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801adf:	83 e0 03             	and    $0x3,%eax
+  801ae2:	48 85 c0             	test   %rax,%rax
+  801ae5:	75 1e                	jne    801b05 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801ae7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aeb:	48 c1 e8 02          	shr    $0x2,%rax
+  801aef:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801af2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801afa:	48 89 c7             	mov    %rax,%rdi
+  801afd:	48 89 d6             	mov    %rdx,%rsi
+  801b00:	fc                   	cld
+  801b01:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801b03:	eb 15                	jmp    801b1a <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801b05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b09:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b0d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b11:	48 89 c7             	mov    %rax,%rdi
+  801b14:	48 89 d6             	mov    %rdx,%rsi
+  801b17:	fc                   	cld
+  801b18:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801b1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b1e:	c9                   	leave
+  801b1f:	c3                   	ret
+
+0000000000801b20 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801b20:	55                   	push   %rbp
+  801b21:	48 89 e5             	mov    %rsp,%rbp
+  801b24:	48 83 ec 18          	sub    $0x18,%rsp
+  801b28:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b28 <memcpy+0x8>
+  801b2f:	49 bb 18 75 00 00 00 	movabs $0x7518,%r11
+  801b36:	00 00 00 
+  801b39:	4c 01 d8             	add    %r11,%rax
+  801b3c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b40:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b44:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801b48:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b4c:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801b50:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b54:	48 89 cf             	mov    %rcx,%rdi
+  801b57:	48 b9 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rcx
+  801b5e:	ff ff ff 
+  801b61:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801b65:	ff d0                	call   *%rax
+}
+  801b67:	c9                   	leave
+  801b68:	c3                   	ret
+
+0000000000801b69 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801b69:	55                   	push   %rbp
+  801b6a:	48 89 e5             	mov    %rsp,%rbp
+  801b6d:	48 83 ec 28          	sub    $0x28,%rsp
+  801b71:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b71 <memcmp+0x8>
+  801b78:	49 bb cf 74 00 00 00 	movabs $0x74cf,%r11
+  801b7f:	00 00 00 
+  801b82:	4c 01 d8             	add    %r11,%rax
+  801b85:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b89:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b8d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801b91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b95:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801b99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b9d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801ba1:	eb 34                	jmp    801bd7 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801ba3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ba7:	0f b6 10             	movzbl (%rax),%edx
+  801baa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bae:	0f b6 00             	movzbl (%rax),%eax
+  801bb1:	38 c2                	cmp    %al,%dl
+  801bb3:	74 18                	je     801bcd <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801bb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bb9:	0f b6 00             	movzbl (%rax),%eax
+  801bbc:	0f b6 d0             	movzbl %al,%edx
+  801bbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bc3:	0f b6 00             	movzbl (%rax),%eax
+  801bc6:	0f b6 c0             	movzbl %al,%eax
+  801bc9:	29 c2                	sub    %eax,%edx
+  801bcb:	eb 20                	jmp    801bed <memcmp+0x84>
+		s1++, s2++;
+  801bcd:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bd2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801bd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bdb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bdf:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801be3:	48 85 c0             	test   %rax,%rax
+  801be6:	75 bb                	jne    801ba3 <memcmp+0x3a>
+	}
+
+	return 0;
+  801be8:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801bed:	89 d0                	mov    %edx,%eax
+  801bef:	c9                   	leave
+  801bf0:	c3                   	ret
+
+0000000000801bf1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801bf1:	55                   	push   %rbp
+  801bf2:	48 89 e5             	mov    %rsp,%rbp
+  801bf5:	48 83 ec 28          	sub    $0x28,%rsp
+  801bf9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bf9 <memfind+0x8>
+  801c00:	49 bb 47 74 00 00 00 	movabs $0x7447,%r11
+  801c07:	00 00 00 
+  801c0a:	4c 01 d8             	add    %r11,%rax
+  801c0d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c11:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801c14:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801c18:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c20:	48 01 d0             	add    %rdx,%rax
+  801c23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801c27:	eb 13                	jmp    801c3c <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801c29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c2d:	0f b6 00             	movzbl (%rax),%eax
+  801c30:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801c33:	38 d0                	cmp    %dl,%al
+  801c35:	74 11                	je     801c48 <memfind+0x57>
+	for (; s < ends; s++)
+  801c37:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801c3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c40:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c44:	72 e3                	jb     801c29 <memfind+0x38>
+  801c46:	eb 01                	jmp    801c49 <memfind+0x58>
+			break;
+  801c48:	90                   	nop
+	return (void *) s;
+  801c49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c4d:	c9                   	leave
+  801c4e:	c3                   	ret
+
+0000000000801c4f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801c4f:	55                   	push   %rbp
+  801c50:	48 89 e5             	mov    %rsp,%rbp
+  801c53:	48 83 ec 38          	sub    $0x38,%rsp
+  801c57:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c57 <strtol+0x8>
+  801c5e:	49 bb e9 73 00 00 00 	movabs $0x73e9,%r11
+  801c65:	00 00 00 
+  801c68:	4c 01 d8             	add    %r11,%rax
+  801c6b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c6f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c73:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801c76:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801c7d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c84:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801c85:	eb 05                	jmp    801c8c <strtol+0x3d>
+		s++;
+  801c87:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801c8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c90:	0f b6 00             	movzbl (%rax),%eax
+  801c93:	3c 20                	cmp    $0x20,%al
+  801c95:	74 f0                	je     801c87 <strtol+0x38>
+  801c97:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c9b:	0f b6 00             	movzbl (%rax),%eax
+  801c9e:	3c 09                	cmp    $0x9,%al
+  801ca0:	74 e5                	je     801c87 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801ca2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca6:	0f b6 00             	movzbl (%rax),%eax
+  801ca9:	3c 2b                	cmp    $0x2b,%al
+  801cab:	75 07                	jne    801cb4 <strtol+0x65>
+		s++;
+  801cad:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cb2:	eb 17                	jmp    801ccb <strtol+0x7c>
+	else if (*s == '-')
+  801cb4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb8:	0f b6 00             	movzbl (%rax),%eax
+  801cbb:	3c 2d                	cmp    $0x2d,%al
+  801cbd:	75 0c                	jne    801ccb <strtol+0x7c>
+		s++, neg = 1;
+  801cbf:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cc4:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801ccb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801ccf:	74 06                	je     801cd7 <strtol+0x88>
+  801cd1:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801cd5:	75 28                	jne    801cff <strtol+0xb0>
+  801cd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cdb:	0f b6 00             	movzbl (%rax),%eax
+  801cde:	3c 30                	cmp    $0x30,%al
+  801ce0:	75 1d                	jne    801cff <strtol+0xb0>
+  801ce2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce6:	48 83 c0 01          	add    $0x1,%rax
+  801cea:	0f b6 00             	movzbl (%rax),%eax
+  801ced:	3c 78                	cmp    $0x78,%al
+  801cef:	75 0e                	jne    801cff <strtol+0xb0>
+		s += 2, base = 16;
+  801cf1:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801cf6:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801cfd:	eb 2c                	jmp    801d2b <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801cff:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d03:	75 19                	jne    801d1e <strtol+0xcf>
+  801d05:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d09:	0f b6 00             	movzbl (%rax),%eax
+  801d0c:	3c 30                	cmp    $0x30,%al
+  801d0e:	75 0e                	jne    801d1e <strtol+0xcf>
+		s++, base = 8;
+  801d10:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d15:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801d1c:	eb 0d                	jmp    801d2b <strtol+0xdc>
+	else if (base == 0)
+  801d1e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d22:	75 07                	jne    801d2b <strtol+0xdc>
+		base = 10;
+  801d24:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801d2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d2f:	0f b6 00             	movzbl (%rax),%eax
+  801d32:	3c 2f                	cmp    $0x2f,%al
+  801d34:	7e 1d                	jle    801d53 <strtol+0x104>
+  801d36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3a:	0f b6 00             	movzbl (%rax),%eax
+  801d3d:	3c 39                	cmp    $0x39,%al
+  801d3f:	7f 12                	jg     801d53 <strtol+0x104>
+			dig = *s - '0';
+  801d41:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d45:	0f b6 00             	movzbl (%rax),%eax
+  801d48:	0f be c0             	movsbl %al,%eax
+  801d4b:	83 e8 30             	sub    $0x30,%eax
+  801d4e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d51:	eb 4e                	jmp    801da1 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801d53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d57:	0f b6 00             	movzbl (%rax),%eax
+  801d5a:	3c 60                	cmp    $0x60,%al
+  801d5c:	7e 1d                	jle    801d7b <strtol+0x12c>
+  801d5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d62:	0f b6 00             	movzbl (%rax),%eax
+  801d65:	3c 7a                	cmp    $0x7a,%al
+  801d67:	7f 12                	jg     801d7b <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801d69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d6d:	0f b6 00             	movzbl (%rax),%eax
+  801d70:	0f be c0             	movsbl %al,%eax
+  801d73:	83 e8 57             	sub    $0x57,%eax
+  801d76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d79:	eb 26                	jmp    801da1 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801d7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d7f:	0f b6 00             	movzbl (%rax),%eax
+  801d82:	3c 40                	cmp    $0x40,%al
+  801d84:	7e 47                	jle    801dcd <strtol+0x17e>
+  801d86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d8a:	0f b6 00             	movzbl (%rax),%eax
+  801d8d:	3c 5a                	cmp    $0x5a,%al
+  801d8f:	7f 3c                	jg     801dcd <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801d91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d95:	0f b6 00             	movzbl (%rax),%eax
+  801d98:	0f be c0             	movsbl %al,%eax
+  801d9b:	83 e8 37             	sub    $0x37,%eax
+  801d9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801da1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801da4:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801da7:	7d 23                	jge    801dcc <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801da9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801dae:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801db1:	48 98                	cltq
+  801db3:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801db8:	48 89 c2             	mov    %rax,%rdx
+  801dbb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801dbe:	48 98                	cltq
+  801dc0:	48 01 d0             	add    %rdx,%rax
+  801dc3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801dc7:	e9 5f ff ff ff       	jmp    801d2b <strtol+0xdc>
+			break;
+  801dcc:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801dcd:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801dd2:	74 0b                	je     801ddf <strtol+0x190>
+		*endptr = (char *) s;
+  801dd4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dd8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801ddc:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801ddf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801de3:	74 09                	je     801dee <strtol+0x19f>
+  801de5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801de9:	48 f7 d8             	neg    %rax
+  801dec:	eb 04                	jmp    801df2 <strtol+0x1a3>
+  801dee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801df2:	c9                   	leave
+  801df3:	c3                   	ret
+
+0000000000801df4 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801df4:	55                   	push   %rbp
+  801df5:	48 89 e5             	mov    %rsp,%rbp
+  801df8:	53                   	push   %rbx
+  801df9:	48 83 ec 30          	sub    $0x30,%rsp
+  801dfd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801dfd <strstr+0x9>
+  801e04:	49 bb 43 72 00 00 00 	movabs $0x7243,%r11
+  801e0b:	00 00 00 
+  801e0e:	4c 01 db             	add    %r11,%rbx
+  801e11:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801e15:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801e19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e1d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e21:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e25:	0f b6 00             	movzbl (%rax),%eax
+  801e28:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801e2b:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801e2f:	75 06                	jne    801e37 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801e31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e35:	eb 73                	jmp    801eaa <strstr+0xb6>
+
+	len = strlen(str);
+  801e37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e3b:	48 89 c7             	mov    %rax,%rdi
+  801e3e:	48 b8 41 85 ff ff ff 	movabs $0xffffffffffff8541,%rax
+  801e45:	ff ff ff 
+  801e48:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e4c:	ff d0                	call   *%rax
+  801e4e:	48 98                	cltq
+  801e50:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801e54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e58:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e5c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801e60:	0f b6 00             	movzbl (%rax),%eax
+  801e63:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801e66:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801e6a:	75 07                	jne    801e73 <strstr+0x7f>
+				return (char *) 0;
+  801e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e71:	eb 37                	jmp    801eaa <strstr+0xb6>
+		} while (sc != c);
+  801e73:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801e77:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801e7a:	75 d8                	jne    801e54 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801e7c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e80:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e88:	48 89 ce             	mov    %rcx,%rsi
+  801e8b:	48 89 c7             	mov    %rax,%rdi
+  801e8e:	48 b8 f5 87 ff ff ff 	movabs $0xffffffffffff87f5,%rax
+  801e95:	ff ff ff 
+  801e98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e9c:	ff d0                	call   *%rax
+  801e9e:	85 c0                	test   %eax,%eax
+  801ea0:	75 b2                	jne    801e54 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801ea2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ea6:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801eaa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801eae:	c9                   	leave
+  801eaf:	c3                   	ret
+
+0000000000801eb0 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801eb0:	55                   	push   %rbp
+  801eb1:	48 89 e5             	mov    %rsp,%rbp
+  801eb4:	41 57                	push   %r15
+  801eb6:	53                   	push   %rbx
+  801eb7:	48 83 ec 40          	sub    $0x40,%rsp
+  801ebb:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801ebb <syscall+0xb>
+  801ec2:	49 bb 85 71 00 00 00 	movabs $0x7185,%r11
+  801ec9:	00 00 00 
+  801ecc:	4d 01 da             	add    %r11,%r10
+  801ecf:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801ed2:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801ed5:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ed9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801edd:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801ee1:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801ee5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ee8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801eec:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801ef0:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801ef4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801ef8:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801efc:	4c 89 c3             	mov    %r8,%rbx
+  801eff:	cd 30                	int    $0x30
+  801f01:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801f05:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801f09:	74 52                	je     801f5d <syscall+0xad>
+  801f0b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f10:	7e 4b                	jle    801f5d <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f12:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f16:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f19:	49 89 d0             	mov    %rdx,%r8
+  801f1c:	89 c1                	mov    %eax,%ecx
+  801f1e:	48 b8 30 e5 ff ff ff 	movabs $0xffffffffffffe530,%rax
+  801f25:	ff ff ff 
+  801f28:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f2c:	48 89 c2             	mov    %rax,%rdx
+  801f2f:	be 23 00 00 00       	mov    $0x23,%esi
+  801f34:	48 b8 4d e5 ff ff ff 	movabs $0xffffffffffffe54d,%rax
+  801f3b:	ff ff ff 
+  801f3e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f42:	48 89 c7             	mov    %rax,%rdi
+  801f45:	4d 89 d7             	mov    %r10,%r15
+  801f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4d:	49 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r9
+  801f54:	ff ff ff 
+  801f57:	4d 01 d1             	add    %r10,%r9
+  801f5a:	41 ff d1             	call   *%r9
+
+	return ret;
+  801f5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f61:	48 83 c4 40          	add    $0x40,%rsp
+  801f65:	5b                   	pop    %rbx
+  801f66:	41 5f                	pop    %r15
+  801f68:	5d                   	pop    %rbp
+  801f69:	c3                   	ret
+
+0000000000801f6a <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801f6a:	55                   	push   %rbp
+  801f6b:	48 89 e5             	mov    %rsp,%rbp
+  801f6e:	41 57                	push   %r15
+  801f70:	41 56                	push   %r14
+  801f72:	41 55                	push   %r13
+  801f74:	41 54                	push   %r12
+  801f76:	53                   	push   %rbx
+  801f77:	48 83 ec 48          	sub    $0x48,%rsp
+  801f7b:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801f7b <syscall_words+0x11>
+  801f82:	49 bb c5 70 00 00 00 	movabs $0x70c5,%r11
+  801f89:	00 00 00 
+  801f8c:	4d 01 de             	add    %r11,%r14
+  801f8f:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801f92:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801f95:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801f99:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801f9d:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801fa1:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801fa5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801faa:	74 09                	je     801fb5 <syscall_words+0x4b>
+  801fac:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fb0:	48 8b 00             	mov    (%rax),%rax
+  801fb3:	eb 05                	jmp    801fba <syscall_words+0x50>
+  801fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fba:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801fbd:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fc2:	74 0a                	je     801fce <syscall_words+0x64>
+  801fc4:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fc8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fcc:	eb 05                	jmp    801fd3 <syscall_words+0x69>
+  801fce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd3:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801fd6:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fdb:	74 0a                	je     801fe7 <syscall_words+0x7d>
+  801fdd:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fe1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fe5:	eb 05                	jmp    801fec <syscall_words+0x82>
+  801fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fec:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801fef:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ff4:	74 0a                	je     802000 <syscall_words+0x96>
+  801ff6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ffa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ffe:	eb 05                	jmp    802005 <syscall_words+0x9b>
+  802000:	b8 00 00 00 00       	mov    $0x0,%eax
+  802005:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  802008:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80200d:	74 0a                	je     802019 <syscall_words+0xaf>
+  80200f:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802013:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802017:	eb 05                	jmp    80201e <syscall_words+0xb4>
+  802019:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201e:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  802021:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802026:	74 0a                	je     802032 <syscall_words+0xc8>
+  802028:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80202c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802030:	eb 05                	jmp    802037 <syscall_words+0xcd>
+  802032:	b8 00 00 00 00       	mov    $0x0,%eax
+  802037:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  80203a:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80203d:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802041:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802045:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802049:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  80204d:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802051:	cd 30                	int    $0x30
+  802053:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802057:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  80205c:	74 50                	je     8020ae <syscall_words+0x144>
+		words[0] = r8;
+  80205e:	4c 89 c2             	mov    %r8,%rdx
+  802061:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802065:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802068:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80206c:	48 83 c0 08          	add    $0x8,%rax
+  802070:	4c 89 ca             	mov    %r9,%rdx
+  802073:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802076:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80207a:	48 83 c0 10          	add    $0x10,%rax
+  80207e:	4c 89 d2             	mov    %r10,%rdx
+  802081:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  802084:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802088:	48 83 c0 18          	add    $0x18,%rax
+  80208c:	4c 89 da             	mov    %r11,%rdx
+  80208f:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  802092:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802096:	48 83 c0 20          	add    $0x20,%rax
+  80209a:	4c 89 e2             	mov    %r12,%rdx
+  80209d:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  8020a0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8020a4:	48 83 c0 28          	add    $0x28,%rax
+  8020a8:	4c 89 ea             	mov    %r13,%rdx
+  8020ab:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  8020ae:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8020b2:	74 52                	je     802106 <syscall_words+0x19c>
+  8020b4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8020b9:	7e 4b                	jle    802106 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020bb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020bf:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8020c2:	49 89 d0             	mov    %rdx,%r8
+  8020c5:	89 c1                	mov    %eax,%ecx
+  8020c7:	48 b8 30 e5 ff ff ff 	movabs $0xffffffffffffe530,%rax
+  8020ce:	ff ff ff 
+  8020d1:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8020d5:	48 89 c2             	mov    %rax,%rdx
+  8020d8:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8020dd:	48 b8 4d e5 ff ff ff 	movabs $0xffffffffffffe54d,%rax
+  8020e4:	ff ff ff 
+  8020e7:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8020eb:	48 89 c7             	mov    %rax,%rdi
+  8020ee:	4d 89 f7             	mov    %r14,%r15
+  8020f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f6:	49 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r9
+  8020fd:	ff ff ff 
+  802100:	4d 01 f1             	add    %r14,%r9
+  802103:	41 ff d1             	call   *%r9
+
+	return ret;
+  802106:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80210a:	48 83 c4 48          	add    $0x48,%rsp
+  80210e:	5b                   	pop    %rbx
+  80210f:	41 5c                	pop    %r12
+  802111:	41 5d                	pop    %r13
+  802113:	41 5e                	pop    %r14
+  802115:	41 5f                	pop    %r15
+  802117:	5d                   	pop    %rbp
+  802118:	c3                   	ret
+
+0000000000802119 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802119:	55                   	push   %rbp
+  80211a:	48 89 e5             	mov    %rsp,%rbp
+  80211d:	48 83 ec 10          	sub    $0x10,%rsp
+  802121:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802121 <sys_cputs+0x8>
+  802128:	49 bb 1f 6f 00 00 00 	movabs $0x6f1f,%r11
+  80212f:	00 00 00 
+  802132:	4c 01 d8             	add    %r11,%rax
+  802135:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802139:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80213d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802141:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802145:	48 83 ec 08          	sub    $0x8,%rsp
+  802149:	6a 00                	push   $0x0
+  80214b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802151:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802157:	be 00 00 00 00       	mov    $0x0,%esi
+  80215c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802161:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  802168:	ff ff ff 
+  80216b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80216f:	ff d0                	call   *%rax
+  802171:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802175:	90                   	nop
+  802176:	c9                   	leave
+  802177:	c3                   	ret
+
+0000000000802178 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802178:	55                   	push   %rbp
+  802179:	48 89 e5             	mov    %rsp,%rbp
+  80217c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80217c <sys_cgetc+0x4>
+  802183:	49 bb c4 6e 00 00 00 	movabs $0x6ec4,%r11
+  80218a:	00 00 00 
+  80218d:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802190:	48 83 ec 08          	sub    $0x8,%rsp
+  802194:	6a 00                	push   $0x0
+  802196:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80219c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021b6:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  8021bd:	ff ff ff 
+  8021c0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021c4:	ff d0                	call   *%rax
+  8021c6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ca:	c9                   	leave
+  8021cb:	c3                   	ret
+
+00000000008021cc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8021cc:	55                   	push   %rbp
+  8021cd:	48 89 e5             	mov    %rsp,%rbp
+  8021d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021d4 <sys_env_destroy+0x8>
+  8021db:	49 bb 6c 6e 00 00 00 	movabs $0x6e6c,%r11
+  8021e2:	00 00 00 
+  8021e5:	4c 01 d8             	add    %r11,%rax
+  8021e8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8021eb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021ee:	48 63 d2             	movslq %edx,%rdx
+  8021f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8021f5:	6a 00                	push   $0x0
+  8021f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802203:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802208:	be 01 00 00 00       	mov    $0x1,%esi
+  80220d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802212:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  802219:	ff ff ff 
+  80221c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802220:	ff d0                	call   *%rax
+  802222:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802226:	c9                   	leave
+  802227:	c3                   	ret
+
+0000000000802228 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802228:	55                   	push   %rbp
+  802229:	48 89 e5             	mov    %rsp,%rbp
+  80222c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80222c <sys_getenvid+0x4>
+  802233:	49 bb 14 6e 00 00 00 	movabs $0x6e14,%r11
+  80223a:	00 00 00 
+  80223d:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802240:	48 83 ec 08          	sub    $0x8,%rsp
+  802244:	6a 00                	push   $0x0
+  802246:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80224c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802252:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225c:	be 00 00 00 00       	mov    $0x0,%esi
+  802261:	bf 02 00 00 00       	mov    $0x2,%edi
+  802266:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  80226d:	ff ff ff 
+  802270:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802274:	ff d0                	call   *%rax
+  802276:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80227a:	c9                   	leave
+  80227b:	c3                   	ret
+
+000000000080227c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80227c:	55                   	push   %rbp
+  80227d:	48 89 e5             	mov    %rsp,%rbp
+  802280:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802280 <sys_yield+0x4>
+  802287:	49 bb c0 6d 00 00 00 	movabs $0x6dc0,%r11
+  80228e:	00 00 00 
+  802291:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802294:	48 83 ec 08          	sub    $0x8,%rsp
+  802298:	6a 00                	push   $0x0
+  80229a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8022ba:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  8022c1:	ff ff ff 
+  8022c4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c8:	ff d0                	call   *%rax
+  8022ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ce:	90                   	nop
+  8022cf:	c9                   	leave
+  8022d0:	c3                   	ret
+
+00000000008022d1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8022d1:	55                   	push   %rbp
+  8022d2:	48 89 e5             	mov    %rsp,%rbp
+  8022d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d9 <sys_page_alloc+0x8>
+  8022e0:	49 bb 67 6d 00 00 00 	movabs $0x6d67,%r11
+  8022e7:	00 00 00 
+  8022ea:	4c 01 d8             	add    %r11,%rax
+  8022ed:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022f4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8022f7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022fa:	48 63 f2             	movslq %edx,%rsi
+  8022fd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802301:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802304:	48 63 d2             	movslq %edx,%rdx
+  802307:	48 83 ec 08          	sub    $0x8,%rsp
+  80230b:	6a 00                	push   $0x0
+  80230d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802313:	49 89 f0             	mov    %rsi,%r8
+  802316:	be 01 00 00 00       	mov    $0x1,%esi
+  80231b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802320:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  802327:	ff ff ff 
+  80232a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80232e:	ff d0                	call   *%rax
+  802330:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+
+0000000000802336 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802336:	55                   	push   %rbp
+  802337:	48 89 e5             	mov    %rsp,%rbp
+  80233a:	48 83 ec 20          	sub    $0x20,%rsp
+  80233e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80233e <sys_page_map+0x8>
+  802345:	49 bb 02 6d 00 00 00 	movabs $0x6d02,%r11
+  80234c:	00 00 00 
+  80234f:	4c 01 d8             	add    %r11,%rax
+  802352:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802355:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802359:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80235c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802360:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802364:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802367:	48 63 f2             	movslq %edx,%rsi
+  80236a:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  80236e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802371:	48 63 fa             	movslq %edx,%rdi
+  802374:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802378:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80237b:	48 63 d2             	movslq %edx,%rdx
+  80237e:	48 83 ec 08          	sub    $0x8,%rsp
+  802382:	56                   	push   %rsi
+  802383:	4d 89 c1             	mov    %r8,%r9
+  802386:	49 89 f8             	mov    %rdi,%r8
+  802389:	be 01 00 00 00       	mov    $0x1,%esi
+  80238e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802393:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  80239a:	ff ff ff 
+  80239d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023a1:	ff d0                	call   *%rax
+  8023a3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a7:	c9                   	leave
+  8023a8:	c3                   	ret
+
+00000000008023a9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8023a9:	55                   	push   %rbp
+  8023aa:	48 89 e5             	mov    %rsp,%rbp
+  8023ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8023b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023b1 <sys_page_unmap+0x8>
+  8023b8:	49 bb 8f 6c 00 00 00 	movabs $0x6c8f,%r11
+  8023bf:	00 00 00 
+  8023c2:	4c 01 d8             	add    %r11,%rax
+  8023c5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023c8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8023cc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023d0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023d3:	48 63 d2             	movslq %edx,%rdx
+  8023d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8023da:	6a 00                	push   $0x0
+  8023dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ed:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023f2:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  8023f9:	ff ff ff 
+  8023fc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802400:	ff d0                	call   *%rax
+  802402:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802406:	c9                   	leave
+  802407:	c3                   	ret
+
+0000000000802408 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802408:	55                   	push   %rbp
+  802409:	48 89 e5             	mov    %rsp,%rbp
+  80240c:	48 83 ec 10          	sub    $0x10,%rsp
+  802410:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802410 <sys_env_set_status+0x8>
+  802417:	49 bb 30 6c 00 00 00 	movabs $0x6c30,%r11
+  80241e:	00 00 00 
+  802421:	4c 01 d8             	add    %r11,%rax
+  802424:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802427:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80242a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80242d:	48 63 ca             	movslq %edx,%rcx
+  802430:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802433:	48 63 d2             	movslq %edx,%rdx
+  802436:	48 83 ec 08          	sub    $0x8,%rsp
+  80243a:	6a 00                	push   $0x0
+  80243c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802442:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802448:	be 01 00 00 00       	mov    $0x1,%esi
+  80244d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802452:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  802459:	ff ff ff 
+  80245c:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802460:	ff d0                	call   *%rax
+  802462:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802466:	c9                   	leave
+  802467:	c3                   	ret
+
+0000000000802468 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802468:	55                   	push   %rbp
+  802469:	48 89 e5             	mov    %rsp,%rbp
+  80246c:	48 83 ec 10          	sub    $0x10,%rsp
+  802470:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802470 <sys_env_set_trapframe+0x8>
+  802477:	49 bb d0 6b 00 00 00 	movabs $0x6bd0,%r11
+  80247e:	00 00 00 
+  802481:	4c 01 d8             	add    %r11,%rax
+  802484:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802487:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  80248b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80248f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802492:	48 63 d2             	movslq %edx,%rdx
+  802495:	48 83 ec 08          	sub    $0x8,%rsp
+  802499:	6a 00                	push   $0x0
+  80249b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8024ac:	bf 09 00 00 00       	mov    $0x9,%edi
+  8024b1:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  8024b8:	ff ff ff 
+  8024bb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024bf:	ff d0                	call   *%rax
+  8024c1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024c5:	c9                   	leave
+  8024c6:	c3                   	ret
+
+00000000008024c7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8024c7:	55                   	push   %rbp
+  8024c8:	48 89 e5             	mov    %rsp,%rbp
+  8024cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8024cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024cf <sys_env_set_pgfault_upcall+0x8>
+  8024d6:	49 bb 71 6b 00 00 00 	movabs $0x6b71,%r11
+  8024dd:	00 00 00 
+  8024e0:	4c 01 d8             	add    %r11,%rax
+  8024e3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8024ea:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024ee:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024f1:	48 63 d2             	movslq %edx,%rdx
+  8024f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f8:	6a 00                	push   $0x0
+  8024fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802500:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802506:	be 01 00 00 00       	mov    $0x1,%esi
+  80250b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802510:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  802517:	ff ff ff 
+  80251a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80251e:	ff d0                	call   *%rax
+  802520:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802524:	c9                   	leave
+  802525:	c3                   	ret
+
+0000000000802526 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802526:	55                   	push   %rbp
+  802527:	48 89 e5             	mov    %rsp,%rbp
+  80252a:	48 83 ec 20          	sub    $0x20,%rsp
+  80252e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80252e <sys_ipc_try_send+0x8>
+  802535:	49 bb 12 6b 00 00 00 	movabs $0x6b12,%r11
+  80253c:	00 00 00 
+  80253f:	4c 01 d8             	add    %r11,%rax
+  802542:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802545:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802549:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80254d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802550:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802553:	48 63 fa             	movslq %edx,%rdi
+  802556:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80255a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80255d:	48 63 d2             	movslq %edx,%rdx
+  802560:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802564:	48 83 ec 08          	sub    $0x8,%rsp
+  802568:	6a 00                	push   $0x0
+  80256a:	49 89 f9             	mov    %rdi,%r9
+  80256d:	49 89 f0             	mov    %rsi,%r8
+  802570:	be 00 00 00 00       	mov    $0x0,%esi
+  802575:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80257a:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  802581:	ff ff ff 
+  802584:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802588:	ff d0                	call   *%rax
+  80258a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80258e:	c9                   	leave
+  80258f:	c3                   	ret
+
+0000000000802590 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802590:	55                   	push   %rbp
+  802591:	48 89 e5             	mov    %rsp,%rbp
+  802594:	48 83 ec 20          	sub    $0x20,%rsp
+  802598:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802598 <sys_ipc_send+0x8>
+  80259f:	49 bb a8 6a 00 00 00 	movabs $0x6aa8,%r11
+  8025a6:	00 00 00 
+  8025a9:	4c 01 d8             	add    %r11,%rax
+  8025ac:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025b3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025b7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8025ba:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025bd:	48 63 fa             	movslq %edx,%rdi
+  8025c0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025c4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025c7:	48 63 d2             	movslq %edx,%rdx
+  8025ca:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d2:	6a 00                	push   $0x0
+  8025d4:	49 89 f9             	mov    %rdi,%r9
+  8025d7:	49 89 f0             	mov    %rsi,%r8
+  8025da:	be 00 00 00 00       	mov    $0x0,%esi
+  8025df:	bf 17 00 00 00       	mov    $0x17,%edi
+  8025e4:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  8025eb:	ff ff ff 
+  8025ee:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025f2:	ff d0                	call   *%rax
+  8025f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f8:	c9                   	leave
+  8025f9:	c3                   	ret
+
+00000000008025fa <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8025fa:	55                   	push   %rbp
+  8025fb:	48 89 e5             	mov    %rsp,%rbp
+  8025fe:	48 83 ec 10          	sub    $0x10,%rsp
+  802602:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802602 <sys_ipc_recv+0x8>
+  802609:	49 bb 3e 6a 00 00 00 	movabs $0x6a3e,%r11
+  802610:	00 00 00 
+  802613:	4c 01 d8             	add    %r11,%rax
+  802616:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80261a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80261e:	6a 00                	push   $0x0
+  802620:	6a 00                	push   $0x0
+  802622:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802628:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80262e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802633:	be 01 00 00 00       	mov    $0x1,%esi
+  802638:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80263d:	49 ba 2a 8f ff ff ff 	movabs $0xffffffffffff8f2a,%r10
+  802644:	ff ff ff 
+  802647:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80264b:	ff d0                	call   *%rax
+  80264d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802651:	c9                   	leave
+  802652:	c3                   	ret
+
+0000000000802653 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  802653:	55                   	push   %rbp
+  802654:	48 89 e5             	mov    %rsp,%rbp
+  802657:	48 83 ec 30          	sub    $0x30,%rsp
+  80265b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80265b <sys_ipc_call+0x8>
+  802662:	49 bb e5 69 00 00 00 	movabs $0x69e5,%r11
+  802669:	00 00 00 
+  80266c:	4c 01 d8             	add    %r11,%rax
+  80266f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802672:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802676:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80267a:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80267d:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802681:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  802685:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802689:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80268c:	4c 63 c2             	movslq %edx,%r8
+  80268f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802693:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802696:	48 63 d2             	movslq %edx,%rdx
+  802699:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80269d:	ff 75 d8             	push   -0x28(%rbp)
+  8026a0:	56                   	push   %rsi
+  8026a1:	4d 89 c1             	mov    %r8,%r9
+  8026a4:	49 89 f8             	mov    %rdi,%r8
+  8026a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ac:	bf 18 00 00 00       	mov    $0x18,%edi
+  8026b1:	49 ba 2a 8f ff ff ff 	movabs $0xffffffffffff8f2a,%r10
+  8026b8:	ff ff ff 
+  8026bb:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026bf:	ff d0                	call   *%rax
+  8026c1:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8026c5:	c9                   	leave
+  8026c6:	c3                   	ret
+
+00000000008026c7 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8026c7:	55                   	push   %rbp
+  8026c8:	48 89 e5             	mov    %rsp,%rbp
+  8026cb:	48 83 ec 30          	sub    $0x30,%rsp
+  8026cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026cf <sys_ipc_reply_recv+0x8>
+  8026d6:	49 bb 71 69 00 00 00 	movabs $0x6971,%r11
+  8026dd:	00 00 00 
+  8026e0:	4c 01 d8             	add    %r11,%rax
+  8026e3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026ea:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026ee:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8026f1:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8026f5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8026f9:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8026fd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802700:	4c 63 c2             	movslq %edx,%r8
+  802703:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802707:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80270a:	48 63 d2             	movslq %edx,%rdx
+  80270d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802711:	ff 75 d8             	push   -0x28(%rbp)
+  802714:	56                   	push   %rsi
+  802715:	4d 89 c1             	mov    %r8,%r9
+  802718:	49 89 f8             	mov    %rdi,%r8
+  80271b:	be 00 00 00 00       	mov    $0x0,%esi
+  802720:	bf 19 00 00 00       	mov    $0x19,%edi
+  802725:	49 ba 2a 8f ff ff ff 	movabs $0xffffffffffff8f2a,%r10
+  80272c:	ff ff ff 
+  80272f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802733:	ff d0                	call   *%rax
+  802735:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802739:	c9                   	leave
+  80273a:	c3                   	ret
+
+000000000080273b <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80273b:	55                   	push   %rbp
+  80273c:	48 89 e5             	mov    %rsp,%rbp
+  80273f:	48 83 ec 10          	sub    $0x10,%rsp
+  802743:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802743 <sys_env_set_priority+0x8>
+  80274a:	49 bb fd 68 00 00 00 	movabs $0x68fd,%r11
+  802751:	00 00 00 
+  802754:	4c 01 d8             	add    %r11,%rax
+  802757:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80275a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  80275d:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802760:	48 63 ca             	movslq %edx,%rcx
+  802763:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802766:	48 63 d2             	movslq %edx,%rdx
+  802769:	48 83 ec 08          	sub    $0x8,%rsp
+  80276d:	6a 00                	push   $0x0
+  80276f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802775:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80277b:	be 01 00 00 00       	mov    $0x1,%esi
+  802780:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802785:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  80278c:	ff ff ff 
+  80278f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802793:	ff d0                	call   *%rax
+  802795:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802799:	c9                   	leave
+  80279a:	c3                   	ret
+
+000000000080279b <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  80279b:	55                   	push   %rbp
+  80279c:	48 89 e5             	mov    %rsp,%rbp
+  80279f:	48 83 ec 10          	sub    $0x10,%rsp
+  8027a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027a3 <sys_env_set_affinity+0x8>
+  8027aa:	49 bb 9d 68 00 00 00 	movabs $0x689d,%r11
+  8027b1:	00 00 00 
+  8027b4:	4c 01 d8             	add    %r11,%rax
+  8027b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027ba:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8027bd:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8027c0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027c3:	48 63 d2             	movslq %edx,%rdx
+  8027c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ca:	6a 00                	push   $0x0
+  8027cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8027dd:	bf 10 00 00 00       	mov    $0x10,%edi
+  8027e2:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  8027e9:	ff ff ff 
+  8027ec:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027f0:	ff d0                	call   *%rax
+  8027f2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027f6:	c9                   	leave
+  8027f7:	c3                   	ret
+
+00000000008027f8 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8027f8:	55                   	push   %rbp
+  8027f9:	48 89 e5             	mov    %rsp,%rbp
+  8027fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027fc <sys_time_msec+0x4>
+  802803:	49 bb 44 68 00 00 00 	movabs $0x6844,%r11
+  80280a:	00 00 00 
+  80280d:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802810:	48 83 ec 08          	sub    $0x8,%rsp
+  802814:	6a 00                	push   $0x0
+  802816:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80281c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802822:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802827:	ba 00 00 00 00       	mov    $0x0,%edx
+  80282c:	be 00 00 00 00       	mov    $0x0,%esi
+  802831:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802836:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  80283d:	ff ff ff 
+  802840:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802844:	ff d0                	call   *%rax
+  802846:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80284a:	c9                   	leave
+  80284b:	c3                   	ret
+
+000000000080284c <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  80284c:	55                   	push   %rbp
+  80284d:	48 89 e5             	mov    %rsp,%rbp
+  802850:	48 83 ec 10          	sub    $0x10,%rsp
+  802854:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802854 <sys_sleep_usec+0x8>
+  80285b:	49 bb ec 67 00 00 00 	movabs $0x67ec,%r11
+  802862:	00 00 00 
+  802865:	4c 01 d8             	add    %r11,%rax
+  802868:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  80286c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802870:	48 83 ec 08          	sub    $0x8,%rsp
+  802874:	6a 00                	push   $0x0
+  802876:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80287c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802882:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802887:	be 00 00 00 00       	mov    $0x0,%esi
+  80288c:	bf 11 00 00 00       	mov    $0x11,%edi
+  802891:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  802898:	ff ff ff 
+  80289b:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80289f:	ff d0                	call   *%rax
+  8028a1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028a5:	c9                   	leave
+  8028a6:	c3                   	ret
+
+00000000008028a7 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8028a7:	55                   	push   %rbp
+  8028a8:	48 89 e5             	mov    %rsp,%rbp
+  8028ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8028af:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028af <sys_page_alloc_huge+0x8>
+  8028b6:	49 bb 91 67 00 00 00 	movabs $0x6791,%r11
+  8028bd:	00 00 00 
+  8028c0:	4c 01 d8             	add    %r11,%rax
+  8028c3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028ca:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8028cd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8028d0:	48 63 f2             	movslq %edx,%rsi
+  8028d3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028d7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8028da:	48 63 d2             	movslq %edx,%rdx
+  8028dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e1:	6a 00                	push   $0x0
+  8028e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028e9:	49 89 f0             	mov    %rsi,%r8
+  8028ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8028f1:	bf 12 00 00 00       	mov    $0x12,%edi
+  8028f6:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  8028fd:	ff ff ff 
+  802900:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802904:	ff d0                	call   *%rax
+  802906:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80290a:	c9                   	leave
+  80290b:	c3                   	ret
+
+000000000080290c <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  80290c:	55                   	push   %rbp
+  80290d:	48 89 e5             	mov    %rsp,%rbp
+  802910:	48 83 ec 10          	sub    $0x10,%rsp
+  802914:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802914 <sys_page_map_batch+0x8>
+  80291b:	49 bb 2c 67 00 00 00 	movabs $0x672c,%r11
+  802922:	00 00 00 
+  802925:	4c 01 d8             	add    %r11,%rax
+  802928:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80292c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802930:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802934:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802938:	48 83 ec 08          	sub    $0x8,%rsp
+  80293c:	6a 00                	push   $0x0
+  80293e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802944:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80294a:	be 01 00 00 00       	mov    $0x1,%esi
+  80294f:	bf 13 00 00 00       	mov    $0x13,%edi
+  802954:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  80295b:	ff ff ff 
+  80295e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802962:	ff d0                	call   *%rax
+  802964:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802968:	c9                   	leave
+  802969:	c3                   	ret
+
+000000000080296a <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+  80296e:	48 83 ec 10          	sub    $0x10,%rsp
+  802972:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802972 <sys_page_alloc_batch+0x8>
+  802979:	49 bb ce 66 00 00 00 	movabs $0x66ce,%r11
+  802980:	00 00 00 
+  802983:	4c 01 d8             	add    %r11,%rax
+  802986:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80298a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80298e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802992:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802996:	48 83 ec 08          	sub    $0x8,%rsp
+  80299a:	6a 00                	push   $0x0
+  80299c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8029ad:	bf 14 00 00 00       	mov    $0x14,%edi
+  8029b2:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  8029b9:	ff ff ff 
+  8029bc:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029c0:	ff d0                	call   *%rax
+  8029c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+
+00000000008029c8 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8029c8:	55                   	push   %rbp
+  8029c9:	48 89 e5             	mov    %rsp,%rbp
+  8029cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8029d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029d0 <sys_page_unmap_batch+0x8>
+  8029d7:	49 bb 70 66 00 00 00 	movabs $0x6670,%r11
+  8029de:	00 00 00 
+  8029e1:	4c 01 d8             	add    %r11,%rax
+  8029e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029e8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8029ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029f0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8029f8:	6a 00                	push   $0x0
+  8029fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a06:	be 01 00 00 00       	mov    $0x1,%esi
+  802a0b:	bf 15 00 00 00       	mov    $0x15,%edi
+  802a10:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  802a17:	ff ff ff 
+  802a1a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a1e:	ff d0                	call   *%rax
+  802a20:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a24:	c9                   	leave
+  802a25:	c3                   	ret
+
+0000000000802a26 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802a26:	55                   	push   %rbp
+  802a27:	48 89 e5             	mov    %rsp,%rbp
+  802a2a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a2a <sys_fork+0x4>
+  802a31:	49 bb 16 66 00 00 00 	movabs $0x6616,%r11
+  802a38:	00 00 00 
+  802a3b:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802a3e:	48 83 ec 08          	sub    $0x8,%rsp
+  802a42:	6a 00                	push   $0x0
+  802a44:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a55:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a5f:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a64:	49 ba 70 8e ff ff ff 	movabs $0xffffffffffff8e70,%r10
+  802a6b:	ff ff ff 
+  802a6e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a72:	ff d0                	call   *%rax
+  802a74:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a78:	c9                   	leave
+  802a79:	c3                   	ret
+
+0000000000802a7a <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802a7a:	55                   	push   %rbp
+  802a7b:	48 89 e5             	mov    %rsp,%rbp
+  802a7e:	41 57                	push   %r15
+  802a80:	53                   	push   %rbx
+  802a81:	48 83 ec 40          	sub    $0x40,%rsp
+  802a85:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a85 <pgfault+0xb>
+  802a8c:	49 bb bb 65 00 00 00 	movabs $0x65bb,%r11
+  802a93:	00 00 00 
+  802a96:	4c 01 db             	add    %r11,%rbx
+  802a99:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802a9d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802aa1:	48 8b 00             	mov    (%rax),%rax
+  802aa4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802aa8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802aac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802ab0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802ab3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ab7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802abb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802abf:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ac5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802ac9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802acc:	83 e0 02             	and    $0x2,%eax
+  802acf:	85 c0                	test   %eax,%eax
+  802ad1:	0f 84 91 03 00 00    	je     802e68 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802ad7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802adb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802adf:	48 89 c2             	mov    %rax,%rdx
+  802ae2:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802ae9:	ff ff ff 
+  802aec:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802af0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802af4:	83 e0 01             	and    $0x1,%eax
+  802af7:	48 85 c0             	test   %rax,%rax
+  802afa:	0f 84 a7 01 00 00    	je     802ca7 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802b00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b04:	48 c1 e8 15          	shr    $0x15,%rax
+  802b08:	48 89 c2             	mov    %rax,%rdx
+  802b0b:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802b12:	ff ff ff 
+  802b15:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b19:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b1d:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802b22:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802b28:	0f 85 79 01 00 00    	jne    802ca7 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802b2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b32:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802b36:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b3a:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802b40:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802b44:	ba 07 00 00 00       	mov    $0x7,%edx
+  802b49:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b53:	49 89 df             	mov    %rbx,%r15
+  802b56:	48 b8 67 98 ff ff ff 	movabs $0xffffffffffff9867,%rax
+  802b5d:	ff ff ff 
+  802b60:	48 01 d8             	add    %rbx,%rax
+  802b63:	ff d0                	call   *%rax
+  802b65:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802b68:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802b6c:	79 44                	jns    802bb2 <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802b6e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802b71:	89 c1                	mov    %eax,%ecx
+  802b73:	48 b8 60 e5 ff ff ff 	movabs $0xffffffffffffe560,%rax
+  802b7a:	ff ff ff 
+  802b7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b81:	48 89 c2             	mov    %rax,%rdx
+  802b84:	be 20 00 00 00       	mov    $0x20,%esi
+  802b89:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802b90:	ff ff ff 
+  802b93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b97:	48 89 c7             	mov    %rax,%rdi
+  802b9a:	49 89 df             	mov    %rbx,%r15
+  802b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba2:	49 b8 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r8
+  802ba9:	ff ff ff 
+  802bac:	49 01 d8             	add    %rbx,%r8
+  802baf:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802bb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bb6:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802bbb:	48 89 c6             	mov    %rax,%rsi
+  802bbe:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802bc3:	49 89 df             	mov    %rbx,%r15
+  802bc6:	48 b8 e0 8a ff ff ff 	movabs $0xffffffffffff8ae0,%rax
+  802bcd:	ff ff ff 
+  802bd0:	48 01 d8             	add    %rbx,%rax
+  802bd3:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802bd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bd9:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802bdf:	48 89 c1             	mov    %rax,%rcx
+  802be2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be7:	be 00 00 60 00       	mov    $0x600000,%esi
+  802bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf1:	49 89 df             	mov    %rbx,%r15
+  802bf4:	48 b8 f6 92 ff ff ff 	movabs $0xffffffffffff92f6,%rax
+  802bfb:	ff ff ff 
+  802bfe:	48 01 d8             	add    %rbx,%rax
+  802c01:	ff d0                	call   *%rax
+  802c03:	85 c0                	test   %eax,%eax
+  802c05:	74 3e                	je     802c45 <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802c07:	48 b8 8b e5 ff ff ff 	movabs $0xffffffffffffe58b,%rax
+  802c0e:	ff ff ff 
+  802c11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c15:	48 89 c2             	mov    %rax,%rdx
+  802c18:	be 23 00 00 00       	mov    $0x23,%esi
+  802c1d:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802c24:	ff ff ff 
+  802c27:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c2b:	48 89 c7             	mov    %rax,%rdi
+  802c2e:	49 89 df             	mov    %rbx,%r15
+  802c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c36:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  802c3d:	ff ff ff 
+  802c40:	48 01 d9             	add    %rbx,%rcx
+  802c43:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802c45:	be 00 00 60 00       	mov    $0x600000,%esi
+  802c4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c4f:	49 89 df             	mov    %rbx,%r15
+  802c52:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  802c59:	ff ff ff 
+  802c5c:	48 01 d8             	add    %rbx,%rax
+  802c5f:	ff d0                	call   *%rax
+  802c61:	85 c0                	test   %eax,%eax
+  802c63:	0f 84 3d 02 00 00    	je     802ea6 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802c69:	48 b8 a0 e5 ff ff ff 	movabs $0xffffffffffffe5a0,%rax
+  802c70:	ff ff ff 
+  802c73:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c77:	48 89 c2             	mov    %rax,%rdx
+  802c7a:	be 25 00 00 00       	mov    $0x25,%esi
+  802c7f:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802c86:	ff ff ff 
+  802c89:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c8d:	48 89 c7             	mov    %rax,%rdi
+  802c90:	49 89 df             	mov    %rbx,%r15
+  802c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c98:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  802c9f:	ff ff ff 
+  802ca2:	48 01 d9             	add    %rbx,%rcx
+  802ca5:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802ca7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cab:	48 c1 e8 0c          	shr    $0xc,%rax
+  802caf:	48 89 c2             	mov    %rax,%rdx
+  802cb2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802cb9:	ff ff ff 
+  802cbc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cc0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cc4:	25 00 08 00 00       	and    $0x800,%eax
+  802cc9:	48 85 c0             	test   %rax,%rax
+  802ccc:	0f 84 58 01 00 00    	je     802e2a <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802cd2:	ba 07 00 00 00       	mov    $0x7,%edx
+  802cd7:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce1:	49 89 df             	mov    %rbx,%r15
+  802ce4:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  802ceb:	ff ff ff 
+  802cee:	48 01 d8             	add    %rbx,%rax
+  802cf1:	ff d0                	call   *%rax
+  802cf3:	85 c0                	test   %eax,%eax
+  802cf5:	74 3e                	je     802d35 <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802cf7:	48 b8 b7 e5 ff ff ff 	movabs $0xffffffffffffe5b7,%rax
+  802cfe:	ff ff ff 
+  802d01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d05:	48 89 c2             	mov    %rax,%rdx
+  802d08:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802d0d:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802d14:	ff ff ff 
+  802d17:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d1b:	48 89 c7             	mov    %rax,%rdi
+  802d1e:	49 89 df             	mov    %rbx,%r15
+  802d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d26:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  802d2d:	ff ff ff 
+  802d30:	48 01 d9             	add    %rbx,%rcx
+  802d33:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802d35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d39:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d3e:	48 89 c6             	mov    %rax,%rsi
+  802d41:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802d46:	49 89 df             	mov    %rbx,%r15
+  802d49:	48 b8 e0 8a ff ff ff 	movabs $0xffffffffffff8ae0,%rax
+  802d50:	ff ff ff 
+  802d53:	48 01 d8             	add    %rbx,%rax
+  802d56:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802d58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d5c:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802d62:	48 89 c1             	mov    %rax,%rcx
+  802d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d6a:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802d6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d74:	49 89 df             	mov    %rbx,%r15
+  802d77:	48 b8 f6 92 ff ff ff 	movabs $0xffffffffffff92f6,%rax
+  802d7e:	ff ff ff 
+  802d81:	48 01 d8             	add    %rbx,%rax
+  802d84:	ff d0                	call   *%rax
+  802d86:	85 c0                	test   %eax,%eax
+  802d88:	74 3e                	je     802dc8 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802d8a:	48 b8 8b e5 ff ff ff 	movabs $0xffffffffffffe58b,%rax
+  802d91:	ff ff ff 
+  802d94:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d98:	48 89 c2             	mov    %rax,%rdx
+  802d9b:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802da0:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802da7:	ff ff ff 
+  802daa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dae:	48 89 c7             	mov    %rax,%rdi
+  802db1:	49 89 df             	mov    %rbx,%r15
+  802db4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db9:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  802dc0:	ff ff ff 
+  802dc3:	48 01 d9             	add    %rbx,%rcx
+  802dc6:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802dc8:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802dcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd2:	49 89 df             	mov    %rbx,%r15
+  802dd5:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  802ddc:	ff ff ff 
+  802ddf:	48 01 d8             	add    %rbx,%rax
+  802de2:	ff d0                	call   *%rax
+  802de4:	85 c0                	test   %eax,%eax
+  802de6:	0f 84 bb 00 00 00    	je     802ea7 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802dec:	48 b8 a0 e5 ff ff ff 	movabs $0xffffffffffffe5a0,%rax
+  802df3:	ff ff ff 
+  802df6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dfa:	48 89 c2             	mov    %rax,%rdx
+  802dfd:	be 32 00 00 00       	mov    $0x32,%esi
+  802e02:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802e09:	ff ff ff 
+  802e0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e10:	48 89 c7             	mov    %rax,%rdi
+  802e13:	49 89 df             	mov    %rbx,%r15
+  802e16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e1b:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  802e22:	ff ff ff 
+  802e25:	48 01 d9             	add    %rbx,%rcx
+  802e28:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802e2a:	48 b8 d0 e5 ff ff ff 	movabs $0xffffffffffffe5d0,%rax
+  802e31:	ff ff ff 
+  802e34:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e38:	48 89 c2             	mov    %rax,%rdx
+  802e3b:	be 36 00 00 00       	mov    $0x36,%esi
+  802e40:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802e47:	ff ff ff 
+  802e4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e4e:	48 89 c7             	mov    %rax,%rdi
+  802e51:	49 89 df             	mov    %rbx,%r15
+  802e54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e59:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  802e60:	ff ff ff 
+  802e63:	48 01 d9             	add    %rbx,%rcx
+  802e66:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802e68:	48 b8 ef e5 ff ff ff 	movabs $0xffffffffffffe5ef,%rax
+  802e6f:	ff ff ff 
+  802e72:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e76:	48 89 c2             	mov    %rax,%rdx
+  802e79:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802e7e:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802e85:	ff ff ff 
+  802e88:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e8c:	48 89 c7             	mov    %rax,%rdi
+  802e8f:	49 89 df             	mov    %rbx,%r15
+  802e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e97:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  802e9e:	ff ff ff 
+  802ea1:	48 01 d9             	add    %rbx,%rcx
+  802ea4:	ff d1                	call   *%rcx
+			return;
+  802ea6:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802ea7:	48 83 c4 40          	add    $0x40,%rsp
+  802eab:	5b                   	pop    %rbx
+  802eac:	41 5f                	pop    %r15
+  802eae:	5d                   	pop    %rbp
+  802eaf:	c3                   	ret
+
+0000000000802eb0 <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802eb0:	55                   	push   %rbp
+  802eb1:	48 89 e5             	mov    %rsp,%rbp
+  802eb4:	41 57                	push   %r15
+  802eb6:	53                   	push   %rbx
+  802eb7:	48 83 ec 10          	sub    $0x10,%rsp
+  802ebb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ebb <fork_flush+0xb>
+  802ec2:	49 bb 85 61 00 00 00 	movabs $0x6185,%r11
+  802ec9:	00 00 00 
+  802ecc:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802ecf:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ed6:	00 00 00 
+  802ed9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802edd:	48 85 c0             	test   %rax,%rax
+  802ee0:	0f 84 81 00 00 00    	je     802f67 <fork_flush+0xb7>
+  802ee6:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802eed:	00 00 00 
+  802ef0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ef4:	48 89 c6             	mov    %rax,%rsi
+  802ef7:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802efe:	00 00 00 
+  802f01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f05:	48 89 c7             	mov    %rax,%rdi
+  802f08:	49 89 df             	mov    %rbx,%r15
+  802f0b:	48 b8 cc 98 ff ff ff 	movabs $0xffffffffffff98cc,%rax
+  802f12:	ff ff ff 
+  802f15:	48 01 d8             	add    %rbx,%rax
+  802f18:	ff d0                	call   *%rax
+  802f1a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f1d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f21:	79 44                	jns    802f67 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802f23:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f26:	89 c1                	mov    %eax,%ecx
+  802f28:	48 b8 08 e6 ff ff ff 	movabs $0xffffffffffffe608,%rax
+  802f2f:	ff ff ff 
+  802f32:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f36:	48 89 c2             	mov    %rax,%rdx
+  802f39:	be 56 00 00 00       	mov    $0x56,%esi
+  802f3e:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  802f45:	ff ff ff 
+  802f48:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f4c:	48 89 c7             	mov    %rax,%rdi
+  802f4f:	49 89 df             	mov    %rbx,%r15
+  802f52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f57:	49 b8 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r8
+  802f5e:	ff ff ff 
+  802f61:	49 01 d8             	add    %rbx,%r8
+  802f64:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802f67:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f6e:	00 00 00 
+  802f71:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802f78:	00 
+}
+  802f79:	90                   	nop
+  802f7a:	48 83 c4 10          	add    $0x10,%rsp
+  802f7e:	5b                   	pop    %rbx
+  802f7f:	41 5f                	pop    %r15
+  802f81:	5d                   	pop    %rbp
+  802f82:	c3                   	ret
+
+0000000000802f83 <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802f83:	55                   	push   %rbp
+  802f84:	48 89 e5             	mov    %rsp,%rbp
+  802f87:	53                   	push   %rbx
+  802f88:	48 83 ec 28          	sub    $0x28,%rsp
+  802f8c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f8c <fork_map+0x9>
+  802f93:	49 bb b4 60 00 00 00 	movabs $0x60b4,%r11
+  802f9a:	00 00 00 
+  802f9d:	4c 01 db             	add    %r11,%rbx
+  802fa0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802fa3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802fa7:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802faa:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fb1:	00 00 00 
+  802fb4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fb8:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802fbe:	75 10                	jne    802fd0 <fork_map+0x4d>
+		fork_flush();
+  802fc0:	48 b8 70 9e ff ff ff 	movabs $0xffffffffffff9e70,%rax
+  802fc7:	ff ff ff 
+  802fca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fce:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802fd0:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fd7:	00 00 00 
+  802fda:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fde:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802fe2:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802fe9:	00 00 00 
+  802fec:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802ff0:	48 c1 e0 05          	shl    $0x5,%rax
+  802ff4:	48 89 c2             	mov    %rax,%rdx
+  802ff7:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802ffe:	00 00 00 
+  803001:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803005:	48 01 d0             	add    %rdx,%rax
+  803008:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  80300c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803010:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  803016:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80301a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80301e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  803022:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803026:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803029:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  80302c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803030:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803034:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  803038:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80303c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80303f:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  803042:	90                   	nop
+  803043:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803047:	c9                   	leave
+  803048:	c3                   	ret
+
+0000000000803049 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  803049:	55                   	push   %rbp
+  80304a:	48 89 e5             	mov    %rsp,%rbp
+  80304d:	53                   	push   %rbx
+  80304e:	48 83 ec 28          	sub    $0x28,%rsp
+  803052:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803052 <duppage+0x9>
+  803059:	49 bb ee 5f 00 00 00 	movabs $0x5fee,%r11
+  803060:	00 00 00 
+  803063:	4c 01 db             	add    %r11,%rbx
+  803066:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803069:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  80306c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80306f:	48 c1 e0 0c          	shl    $0xc,%rax
+  803073:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  803077:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80307e:	ff ff ff 
+  803081:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803085:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803088:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80308c:	25 00 04 00 00       	and    $0x400,%eax
+  803091:	48 85 c0             	test   %rax,%rax
+  803094:	74 42                	je     8030d8 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  803096:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80309d:	ff ff ff 
+  8030a0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030a4:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030a7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030ab:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030b0:	89 c2                	mov    %eax,%edx
+  8030b2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8030b6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030b9:	48 89 ce             	mov    %rcx,%rsi
+  8030bc:	89 c7                	mov    %eax,%edi
+  8030be:	48 b8 43 9f ff ff ff 	movabs $0xffffffffffff9f43,%rax
+  8030c5:	ff ff ff 
+  8030c8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030cc:	ff d0                	call   *%rax
+		return 0;
+  8030ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d3:	e9 ae 00 00 00       	jmp    803186 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  8030d8:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030df:	ff ff ff 
+  8030e2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030e6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030e9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030ed:	83 e0 02             	and    $0x2,%eax
+  8030f0:	48 85 c0             	test   %rax,%rax
+  8030f3:	75 1f                	jne    803114 <duppage+0xcb>
+  8030f5:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030fc:	ff ff ff 
+  8030ff:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803103:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803106:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80310a:	25 00 08 00 00       	and    $0x800,%eax
+  80310f:	48 85 c0             	test   %rax,%rax
+  803112:	74 4c                	je     803160 <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  803114:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  80311b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80311e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803122:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803125:	48 89 ce             	mov    %rcx,%rsi
+  803128:	89 c7                	mov    %eax,%edi
+  80312a:	48 b8 43 9f ff ff ff 	movabs $0xffffffffffff9f43,%rax
+  803131:	ff ff ff 
+  803134:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803138:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  80313a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80313d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803141:	48 89 c6             	mov    %rax,%rsi
+  803144:	bf 00 00 00 00       	mov    $0x0,%edi
+  803149:	48 b8 43 9f ff ff ff 	movabs $0xffffffffffff9f43,%rax
+  803150:	ff ff ff 
+  803153:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803157:	ff d0                	call   *%rax
+		return 0;
+  803159:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315e:	eb 26                	jmp    803186 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  803160:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803164:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803167:	ba 05 00 00 00       	mov    $0x5,%edx
+  80316c:	48 89 ce             	mov    %rcx,%rsi
+  80316f:	89 c7                	mov    %eax,%edi
+  803171:	48 b8 43 9f ff ff ff 	movabs $0xffffffffffff9f43,%rax
+  803178:	ff ff ff 
+  80317b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80317f:	ff d0                	call   *%rax
+		return 0;
+  803181:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803186:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80318a:	c9                   	leave
+  80318b:	c3                   	ret
+
+000000000080318c <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  80318c:	55                   	push   %rbp
+  80318d:	48 89 e5             	mov    %rsp,%rbp
+  803190:	53                   	push   %rbx
+  803191:	48 83 ec 28          	sub    $0x28,%rsp
+  803195:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803195 <duphuge+0x9>
+  80319c:	49 bb ab 5e 00 00 00 	movabs $0x5eab,%r11
+  8031a3:	00 00 00 
+  8031a6:	4c 01 db             	add    %r11,%rbx
+  8031a9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031ac:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  8031b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031b4:	48 c1 e8 15          	shr    $0x15,%rax
+  8031b8:	48 89 c2             	mov    %rax,%rdx
+  8031bb:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8031c2:	ff ff ff 
+  8031c5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031c9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031cd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8031d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031d5:	25 00 04 00 00       	and    $0x400,%eax
+  8031da:	48 85 c0             	test   %rax,%rax
+  8031dd:	74 0e                	je     8031ed <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8031df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031e3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031eb:	eb 1e                	jmp    80320b <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  8031ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031f1:	25 02 08 00 00       	and    $0x802,%eax
+  8031f6:	48 85 c0             	test   %rax,%rax
+  8031f9:	74 09                	je     803204 <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  8031fb:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  803202:	eb 07                	jmp    80320b <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  803204:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  80320b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80320e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803212:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803215:	48 89 ce             	mov    %rcx,%rsi
+  803218:	89 c7                	mov    %eax,%edi
+  80321a:	48 b8 43 9f ff ff ff 	movabs $0xffffffffffff9f43,%rax
+  803221:	ff ff ff 
+  803224:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803228:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  80322a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80322d:	25 00 08 00 00       	and    $0x800,%eax
+  803232:	85 c0                	test   %eax,%eax
+  803234:	74 1f                	je     803255 <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  803236:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803239:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80323d:	48 89 c6             	mov    %rax,%rsi
+  803240:	bf 00 00 00 00       	mov    $0x0,%edi
+  803245:	48 b8 43 9f ff ff ff 	movabs $0xffffffffffff9f43,%rax
+  80324c:	ff ff ff 
+  80324f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803253:	ff d0                	call   *%rax
+	return 0;
+  803255:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80325a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80325e:	c9                   	leave
+  80325f:	c3                   	ret
+
+0000000000803260 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  803260:	55                   	push   %rbp
+  803261:	48 89 e5             	mov    %rsp,%rbp
+  803264:	41 57                	push   %r15
+  803266:	53                   	push   %rbx
+  803267:	48 83 ec 10          	sub    $0x10,%rsp
+  80326b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80326b <fork+0xb>
+  803272:	49 bb d5 5d 00 00 00 	movabs $0x5dd5,%r11
+  803279:	00 00 00 
+  80327c:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  80327f:	49 89 df             	mov    %rbx,%r15
+  803282:	48 b8 e6 99 ff ff ff 	movabs $0xffffffffffff99e6,%rax
+  803289:	ff ff ff 
+  80328c:	48 01 d8             	add    %rbx,%rax
+  80328f:	ff d0                	call   *%rax
+  803291:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803294:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803298:	75 42                	jne    8032dc <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80329a:	49 89 df             	mov    %rbx,%r15
+  80329d:	48 b8 e8 91 ff ff ff 	movabs $0xffffffffffff91e8,%rax
+  8032a4:	ff ff ff 
+  8032a7:	48 01 d8             	add    %rbx,%rax
+  8032aa:	ff d0                	call   *%rax
+  8032ac:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032b1:	48 98                	cltq
+  8032b3:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8032ba:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8032c1:	ff ff ff 
+  8032c4:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8032c8:	48 01 c2             	add    %rax,%rdx
+  8032cb:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8032d2:	ff ff ff 
+  8032d5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032d9:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8032dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8032df:	48 83 c4 10          	add    $0x10,%rsp
+  8032e3:	5b                   	pop    %rbx
+  8032e4:	41 5f                	pop    %r15
+  8032e6:	5d                   	pop    %rbp
+  8032e7:	c3                   	ret
+
+00000000008032e8 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8032e8:	55                   	push   %rbp
+  8032e9:	48 89 e5             	mov    %rsp,%rbp
+  8032ec:	41 57                	push   %r15
+  8032ee:	53                   	push   %rbx
+  8032ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8032f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032f3 <ufork+0xb>
+  8032fa:	49 bb 4d 5d 00 00 00 	movabs $0x5d4d,%r11
+  803301:	00 00 00 
+  803304:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  803307:	48 b8 3a 9a ff ff ff 	movabs $0xffffffffffff9a3a,%rax
+  80330e:	ff ff ff 
+  803311:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803315:	48 89 c7             	mov    %rax,%rdi
+  803318:	49 89 df             	mov    %rbx,%r15
+  80331b:	48 b8 a8 d5 ff ff ff 	movabs $0xffffffffffffd5a8,%rax
+  803322:	ff ff ff 
+  803325:	48 01 d8             	add    %rbx,%rax
+  803328:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80332a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80332f:	cd 30                	int    $0x30
+  803331:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  803334:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  803337:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  80333a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80333e:	0f 84 03 02 00 00    	je     803547 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  803344:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80334b:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  80334c:	e9 28 01 00 00       	jmp    803479 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  803351:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803355:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803359:	48 89 c2             	mov    %rax,%rdx
+  80335c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803363:	ff ff ff 
+  803366:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80336a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80336e:	83 e0 01             	and    $0x1,%eax
+  803371:	48 85 c0             	test   %rax,%rax
+  803374:	0f 84 f7 00 00 00    	je     803471 <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  80337a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80337e:	48 c1 e8 15          	shr    $0x15,%rax
+  803382:	48 89 c2             	mov    %rax,%rdx
+  803385:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80338c:	ff ff ff 
+  80338f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803393:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803397:	25 81 00 00 00       	and    $0x81,%eax
+  80339c:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  8033a2:	75 29                	jne    8033cd <ufork+0xe5>
+					duphuge(child_envid, addr);
+  8033a4:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8033a8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033ab:	48 89 d6             	mov    %rdx,%rsi
+  8033ae:	89 c7                	mov    %eax,%edi
+  8033b0:	48 b8 4c a1 ff ff ff 	movabs $0xffffffffffffa14c,%rax
+  8033b7:	ff ff ff 
+  8033ba:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033be:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  8033c0:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8033c7:	00 
+  8033c8:	e9 ac 00 00 00       	jmp    803479 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8033cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033d1:	48 c1 e8 15          	shr    $0x15,%rax
+  8033d5:	48 89 c2             	mov    %rax,%rdx
+  8033d8:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8033df:	ff ff ff 
+  8033e2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033e6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033ea:	83 e0 01             	and    $0x1,%eax
+  8033ed:	48 85 c0             	test   %rax,%rax
+  8033f0:	74 75                	je     803467 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  8033f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033f6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033fa:	48 89 c2             	mov    %rax,%rdx
+  8033fd:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803404:	ff ff ff 
+  803407:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80340b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80340f:	83 e0 01             	and    $0x1,%eax
+  803412:	48 85 c0             	test   %rax,%rax
+  803415:	74 46                	je     80345d <ufork+0x175>
+  803417:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80341b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80341f:	48 89 c2             	mov    %rax,%rdx
+  803422:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803429:	ff ff ff 
+  80342c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803430:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803434:	83 e0 04             	and    $0x4,%eax
+  803437:	48 85 c0             	test   %rax,%rax
+  80343a:	74 21                	je     80345d <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  80343c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803440:	48 c1 e8 0c          	shr    $0xc,%rax
+  803444:	89 c2                	mov    %eax,%edx
+  803446:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803449:	89 d6                	mov    %edx,%esi
+  80344b:	89 c7                	mov    %eax,%edi
+  80344d:	48 b8 09 a0 ff ff ff 	movabs $0xffffffffffffa009,%rax
+  803454:	ff ff ff 
+  803457:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80345b:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  80345d:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  803464:	00 
+  803465:	eb 12                	jmp    803479 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803467:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  80346e:	00 
+  80346f:	eb 08                	jmp    803479 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  803471:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803478:	40 
+		for (; addr < USTACKTOP;){
+  803479:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  80347e:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  803482:	0f 83 c9 fe ff ff    	jae    803351 <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803488:	48 b8 70 9e ff ff ff 	movabs $0xffffffffffff9e70,%rax
+  80348f:	ff ff ff 
+  803492:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803496:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803498:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80349b:	ba 07 00 00 00       	mov    $0x7,%edx
+  8034a0:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8034a5:	48 89 ce             	mov    %rcx,%rsi
+  8034a8:	89 c7                	mov    %eax,%edi
+  8034aa:	49 89 df             	mov    %rbx,%r15
+  8034ad:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  8034b4:	ff ff ff 
+  8034b7:	48 01 d8             	add    %rbx,%rax
+  8034ba:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8034bc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8034bf:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8034c6:	ff ff ff 
+  8034c9:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8034cd:	48 89 d6             	mov    %rdx,%rsi
+  8034d0:	89 c7                	mov    %eax,%edi
+  8034d2:	49 89 df             	mov    %rbx,%r15
+  8034d5:	48 b8 87 94 ff ff ff 	movabs $0xffffffffffff9487,%rax
+  8034dc:	ff ff ff 
+  8034df:	48 01 d8             	add    %rbx,%rax
+  8034e2:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8034e4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8034e7:	be 02 00 00 00       	mov    $0x2,%esi
+  8034ec:	89 c7                	mov    %eax,%edi
+  8034ee:	49 89 df             	mov    %rbx,%r15
+  8034f1:	48 b8 c8 93 ff ff ff 	movabs $0xffffffffffff93c8,%rax
+  8034f8:	ff ff ff 
+  8034fb:	48 01 d8             	add    %rbx,%rax
+  8034fe:	ff d0                	call   *%rax
+  803500:	85 c0                	test   %eax,%eax
+  803502:	74 3e                	je     803542 <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  803504:	48 b8 2f e6 ff ff ff 	movabs $0xffffffffffffe62f,%rax
+  80350b:	ff ff ff 
+  80350e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803512:	48 89 c2             	mov    %rax,%rdx
+  803515:	be 07 01 00 00       	mov    $0x107,%esi
+  80351a:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  803521:	ff ff ff 
+  803524:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803528:	48 89 c7             	mov    %rax,%rdi
+  80352b:	49 89 df             	mov    %rbx,%r15
+  80352e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803533:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  80353a:	ff ff ff 
+  80353d:	48 01 d9             	add    %rbx,%rcx
+  803540:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  803542:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803545:	eb 59                	jmp    8035a0 <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803547:	49 89 df             	mov    %rbx,%r15
+  80354a:	48 b8 e8 91 ff ff ff 	movabs $0xffffffffffff91e8,%rax
+  803551:	ff ff ff 
+  803554:	48 01 d8             	add    %rbx,%rax
+  803557:	ff d0                	call   *%rax
+  803559:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80355e:	48 98                	cltq
+  803560:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803567:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80356e:	ff ff ff 
+  803571:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803575:	48 01 c2             	add    %rax,%rdx
+  803578:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80357f:	ff ff ff 
+  803582:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803586:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803589:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  803590:	00 00 00 
+  803593:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  80359a:	00 
+		return 0;
+  80359b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  8035a0:	48 83 c4 10          	add    $0x10,%rsp
+  8035a4:	5b                   	pop    %rbx
+  8035a5:	41 5f                	pop    %r15
+  8035a7:	5d                   	pop    %rbp
+  8035a8:	c3                   	ret
+
+00000000008035a9 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8035a9:	55                   	push   %rbp
+  8035aa:	48 89 e5             	mov    %rsp,%rbp
+  8035ad:	41 57                	push   %r15
+  8035af:	48 83 ec 08          	sub    $0x8,%rsp
+  8035b3:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8035b3 <sfork+0xa>
+  8035ba:	49 bb 8d 5a 00 00 00 	movabs $0x5a8d,%r11
+  8035c1:	00 00 00 
+  8035c4:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8035c7:	48 b8 4a e6 ff ff ff 	movabs $0xffffffffffffe64a,%rax
+  8035ce:	ff ff ff 
+  8035d1:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8035d5:	48 89 c2             	mov    %rax,%rdx
+  8035d8:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8035dd:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  8035e4:	ff ff ff 
+  8035e7:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8035eb:	48 89 c7             	mov    %rax,%rdi
+  8035ee:	49 89 cf             	mov    %rcx,%r15
+  8035f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f6:	49 b8 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r8
+  8035fd:	ff ff ff 
+  803600:	49 01 c8             	add    %rcx,%r8
+  803603:	41 ff d0             	call   *%r8
+
+0000000000803606 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803606:	55                   	push   %rbp
+  803607:	48 89 e5             	mov    %rsp,%rbp
+  80360a:	48 83 ec 08          	sub    $0x8,%rsp
+  80360e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80360e <fd2num+0x8>
+  803615:	49 bb 32 5a 00 00 00 	movabs $0x5a32,%r11
+  80361c:	00 00 00 
+  80361f:	4c 01 d8             	add    %r11,%rax
+  803622:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803626:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80362a:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803631:	ff ff ff 
+  803634:	48 01 d0             	add    %rdx,%rax
+  803637:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80363b:	c9                   	leave
+  80363c:	c3                   	ret
+
+000000000080363d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80363d:	55                   	push   %rbp
+  80363e:	48 89 e5             	mov    %rsp,%rbp
+  803641:	48 83 ec 08          	sub    $0x8,%rsp
+  803645:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803645 <fd2data+0x8>
+  80364c:	49 bb fb 59 00 00 00 	movabs $0x59fb,%r11
+  803653:	00 00 00 
+  803656:	4c 01 d8             	add    %r11,%rax
+  803659:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  80365d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803661:	48 89 d7             	mov    %rdx,%rdi
+  803664:	48 ba c6 a5 ff ff ff 	movabs $0xffffffffffffa5c6,%rdx
+  80366b:	ff ff ff 
+  80366e:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803672:	ff d0                	call   *%rax
+  803674:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80367a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80367e:	c9                   	leave
+  80367f:	c3                   	ret
+
+0000000000803680 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803680:	55                   	push   %rbp
+  803681:	48 89 e5             	mov    %rsp,%rbp
+  803684:	48 83 ec 18          	sub    $0x18,%rsp
+  803688:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803688 <fd_alloc+0x8>
+  80368f:	49 bb b8 59 00 00 00 	movabs $0x59b8,%r11
+  803696:	00 00 00 
+  803699:	4c 01 d8             	add    %r11,%rax
+  80369c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8036a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8036a7:	eb 75                	jmp    80371e <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8036a9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8036ac:	48 63 d2             	movslq %edx,%rdx
+  8036af:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8036b6:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8036ba:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8036be:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8036c2:	48 89 d1             	mov    %rdx,%rcx
+  8036c5:	48 c1 e9 15          	shr    $0x15,%rcx
+  8036c9:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8036d0:	ff ff ff 
+  8036d3:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8036d7:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8036db:	83 e2 01             	and    $0x1,%edx
+  8036de:	48 85 d2             	test   %rdx,%rdx
+  8036e1:	74 25                	je     803708 <fd_alloc+0x88>
+  8036e3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8036e7:	48 89 d1             	mov    %rdx,%rcx
+  8036ea:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8036ee:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  8036f5:	ff ff ff 
+  8036f8:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8036fc:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803700:	83 e2 01             	and    $0x1,%edx
+  803703:	48 85 d2             	test   %rdx,%rdx
+  803706:	75 12                	jne    80371a <fd_alloc+0x9a>
+			*fd_store = fd;
+  803708:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80370c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803710:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803713:	b8 00 00 00 00       	mov    $0x0,%eax
+  803718:	eb 1a                	jmp    803734 <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  80371a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80371e:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803722:	7e 85                	jle    8036a9 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803724:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803728:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  80372f:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803734:	c9                   	leave
+  803735:	c3                   	ret
+
+0000000000803736 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803736:	55                   	push   %rbp
+  803737:	48 89 e5             	mov    %rsp,%rbp
+  80373a:	48 83 ec 20          	sub    $0x20,%rsp
+  80373e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80373e <fd_lookup+0x8>
+  803745:	49 bb 02 59 00 00 00 	movabs $0x5902,%r11
+  80374c:	00 00 00 
+  80374f:	4c 01 d8             	add    %r11,%rax
+  803752:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803755:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803759:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80375d:	78 06                	js     803765 <fd_lookup+0x2f>
+  80375f:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803763:	7e 07                	jle    80376c <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803765:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80376a:	eb 73                	jmp    8037df <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  80376c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80376f:	48 63 d2             	movslq %edx,%rdx
+  803772:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803779:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80377d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803781:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803785:	48 89 d1             	mov    %rdx,%rcx
+  803788:	48 c1 e9 15          	shr    $0x15,%rcx
+  80378c:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803793:	ff ff ff 
+  803796:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  80379a:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80379e:	83 e2 01             	and    $0x1,%edx
+  8037a1:	48 85 d2             	test   %rdx,%rdx
+  8037a4:	74 22                	je     8037c8 <fd_lookup+0x92>
+  8037a6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037aa:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8037ae:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  8037b5:	ff ff ff 
+  8037b8:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8037bc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037c0:	83 e0 01             	and    $0x1,%eax
+  8037c3:	48 85 c0             	test   %rax,%rax
+  8037c6:	75 07                	jne    8037cf <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8037c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037cd:	eb 10                	jmp    8037df <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8037cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037d7:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8037da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037df:	c9                   	leave
+  8037e0:	c3                   	ret
+
+00000000008037e1 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8037e1:	55                   	push   %rbp
+  8037e2:	48 89 e5             	mov    %rsp,%rbp
+  8037e5:	41 57                	push   %r15
+  8037e7:	53                   	push   %rbx
+  8037e8:	48 83 ec 30          	sub    $0x30,%rsp
+  8037ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037ec <fd_close+0xb>
+  8037f3:	49 bb 54 58 00 00 00 	movabs $0x5854,%r11
+  8037fa:	00 00 00 
+  8037fd:	4c 01 db             	add    %r11,%rbx
+  803800:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803804:	89 f0                	mov    %esi,%eax
+  803806:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803809:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80380d:	48 89 c7             	mov    %rax,%rdi
+  803810:	48 b8 c6 a5 ff ff ff 	movabs $0xffffffffffffa5c6,%rax
+  803817:	ff ff ff 
+  80381a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80381e:	ff d0                	call   *%rax
+  803820:	89 c2                	mov    %eax,%edx
+  803822:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803826:	48 89 c6             	mov    %rax,%rsi
+  803829:	89 d7                	mov    %edx,%edi
+  80382b:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  803832:	ff ff ff 
+  803835:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803839:	ff d0                	call   *%rax
+  80383b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80383e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803842:	78 0a                	js     80384e <fd_close+0x6d>
+	    || fd != fd2)
+  803844:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803848:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  80384c:	74 12                	je     803860 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  80384e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803852:	74 05                	je     803859 <fd_close+0x78>
+  803854:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803857:	eb 7a                	jmp    8038d3 <fd_close+0xf2>
+  803859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385e:	eb 73                	jmp    8038d3 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803860:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803864:	8b 00                	mov    (%rax),%eax
+  803866:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80386a:	48 89 d6             	mov    %rdx,%rsi
+  80386d:	89 c7                	mov    %eax,%edi
+  80386f:	48 b8 9c a8 ff ff ff 	movabs $0xffffffffffffa89c,%rax
+  803876:	ff ff ff 
+  803879:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80387d:	ff d0                	call   *%rax
+  80387f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803882:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803886:	78 2a                	js     8038b2 <fd_close+0xd1>
+		if (dev->dev_close)
+  803888:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80388c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803890:	48 85 c0             	test   %rax,%rax
+  803893:	74 16                	je     8038ab <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803895:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803899:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80389d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038a1:	48 89 c7             	mov    %rax,%rdi
+  8038a4:	ff d2                	call   *%rdx
+  8038a6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8038a9:	eb 07                	jmp    8038b2 <fd_close+0xd1>
+		else
+			r = 0;
+  8038ab:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8038b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8038b6:	48 89 c6             	mov    %rax,%rsi
+  8038b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038be:	49 89 df             	mov    %rbx,%r15
+  8038c1:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  8038c8:	ff ff ff 
+  8038cb:	48 01 d8             	add    %rbx,%rax
+  8038ce:	ff d0                	call   *%rax
+	return r;
+  8038d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8038d3:	48 83 c4 30          	add    $0x30,%rsp
+  8038d7:	5b                   	pop    %rbx
+  8038d8:	41 5f                	pop    %r15
+  8038da:	5d                   	pop    %rbp
+  8038db:	c3                   	ret
+
+00000000008038dc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8038dc:	55                   	push   %rbp
+  8038dd:	48 89 e5             	mov    %rsp,%rbp
+  8038e0:	41 57                	push   %r15
+  8038e2:	48 83 ec 28          	sub    $0x28,%rsp
+  8038e6:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8038e6 <dev_lookup+0xa>
+  8038ed:	49 bb 5a 57 00 00 00 	movabs $0x575a,%r11
+  8038f4:	00 00 00 
+  8038f7:	4c 01 d9             	add    %r11,%rcx
+  8038fa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8038fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  803901:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803908:	eb 45                	jmp    80394f <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  80390a:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803911:	00 00 00 
+  803914:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803917:	48 98                	cltq
+  803919:	48 01 ca             	add    %rcx,%rdx
+  80391c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803920:	8b 00                	mov    (%rax),%eax
+  803922:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  803925:	75 24                	jne    80394b <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803927:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80392e:	00 00 00 
+  803931:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803934:	48 98                	cltq
+  803936:	48 01 ca             	add    %rcx,%rdx
+  803939:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80393d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803941:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803944:	b8 00 00 00 00       	mov    $0x0,%eax
+  803949:	eb 74                	jmp    8039bf <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  80394b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80394f:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803956:	00 00 00 
+  803959:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80395c:	48 98                	cltq
+  80395e:	48 01 ca             	add    %rcx,%rdx
+  803961:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803965:	48 85 c0             	test   %rax,%rax
+  803968:	75 a0                	jne    80390a <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80396a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803971:	ff ff ff 
+  803974:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803978:	48 8b 00             	mov    (%rax),%rax
+  80397b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803981:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803984:	89 c6                	mov    %eax,%esi
+  803986:	48 b8 60 e6 ff ff ff 	movabs $0xffffffffffffe660,%rax
+  80398d:	ff ff ff 
+  803990:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803994:	48 89 c7             	mov    %rax,%rdi
+  803997:	49 89 cf             	mov    %rcx,%r15
+  80399a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80399f:	49 b8 13 78 ff ff ff 	movabs $0xffffffffffff7813,%r8
+  8039a6:	ff ff ff 
+  8039a9:	49 01 c8             	add    %rcx,%r8
+  8039ac:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8039af:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039b3:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8039ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8039bf:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8039c3:	c9                   	leave
+  8039c4:	c3                   	ret
+
+00000000008039c5 <close>:
+
+int
+close(int fdnum)
+{
+  8039c5:	55                   	push   %rbp
+  8039c6:	48 89 e5             	mov    %rsp,%rbp
+  8039c9:	53                   	push   %rbx
+  8039ca:	48 83 ec 28          	sub    $0x28,%rsp
+  8039ce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039ce <close+0x9>
+  8039d5:	49 bb 72 56 00 00 00 	movabs $0x5672,%r11
+  8039dc:	00 00 00 
+  8039df:	4c 01 db             	add    %r11,%rbx
+  8039e2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8039e5:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8039e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039ec:	48 89 d6             	mov    %rdx,%rsi
+  8039ef:	89 c7                	mov    %eax,%edi
+  8039f1:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  8039f8:	ff ff ff 
+  8039fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039ff:	ff d0                	call   *%rax
+  803a01:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a04:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a08:	79 05                	jns    803a0f <close+0x4a>
+		return r;
+  803a0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a0d:	eb 1c                	jmp    803a2b <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803a0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a13:	be 01 00 00 00       	mov    $0x1,%esi
+  803a18:	48 89 c7             	mov    %rax,%rdi
+  803a1b:	48 b8 a1 a7 ff ff ff 	movabs $0xffffffffffffa7a1,%rax
+  803a22:	ff ff ff 
+  803a25:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a29:	ff d0                	call   *%rax
+}
+  803a2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a2f:	c9                   	leave
+  803a30:	c3                   	ret
+
+0000000000803a31 <close_all>:
+
+void
+close_all(void)
+{
+  803a31:	55                   	push   %rbp
+  803a32:	48 89 e5             	mov    %rsp,%rbp
+  803a35:	53                   	push   %rbx
+  803a36:	48 83 ec 18          	sub    $0x18,%rsp
+  803a3a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a3a <close_all+0x9>
+  803a41:	49 bb 06 56 00 00 00 	movabs $0x5606,%r11
+  803a48:	00 00 00 
+  803a4b:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803a4e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803a55:	eb 19                	jmp    803a70 <close_all+0x3f>
+		close(i);
+  803a57:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a5a:	89 c7                	mov    %eax,%edi
+  803a5c:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  803a63:	ff ff ff 
+  803a66:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a6a:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803a6c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803a70:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803a74:	7e e1                	jle    803a57 <close_all+0x26>
+}
+  803a76:	90                   	nop
+  803a77:	90                   	nop
+  803a78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a7c:	c9                   	leave
+  803a7d:	c3                   	ret
+
+0000000000803a7e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803a7e:	55                   	push   %rbp
+  803a7f:	48 89 e5             	mov    %rsp,%rbp
+  803a82:	41 57                	push   %r15
+  803a84:	53                   	push   %rbx
+  803a85:	48 83 ec 40          	sub    $0x40,%rsp
+  803a89:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a89 <dup+0xb>
+  803a90:	49 bb b7 55 00 00 00 	movabs $0x55b7,%r11
+  803a97:	00 00 00 
+  803a9a:	4c 01 db             	add    %r11,%rbx
+  803a9d:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  803aa0:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803aa3:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803aa7:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803aaa:	48 89 d6             	mov    %rdx,%rsi
+  803aad:	89 c7                	mov    %eax,%edi
+  803aaf:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  803ab6:	ff ff ff 
+  803ab9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803abd:	ff d0                	call   *%rax
+  803abf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ac2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ac6:	79 08                	jns    803ad0 <dup+0x52>
+		return r;
+  803ac8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803acb:	e9 a4 01 00 00       	jmp    803c74 <dup+0x1f6>
+	close(newfdnum);
+  803ad0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ad3:	89 c7                	mov    %eax,%edi
+  803ad5:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  803adc:	ff ff ff 
+  803adf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ae3:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  803ae5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ae8:	48 98                	cltq
+  803aea:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803af0:	48 c1 e0 0c          	shl    $0xc,%rax
+  803af4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803af8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803afc:	48 89 c7             	mov    %rax,%rdi
+  803aff:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  803b06:	ff ff ff 
+  803b09:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b0d:	ff d0                	call   *%rax
+  803b0f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803b13:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b17:	48 89 c7             	mov    %rax,%rdi
+  803b1a:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  803b21:	ff ff ff 
+  803b24:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803b28:	ff d0                	call   *%rax
+  803b2a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803b2e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b32:	48 c1 e8 15          	shr    $0x15,%rax
+  803b36:	48 89 c2             	mov    %rax,%rdx
+  803b39:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803b40:	ff ff ff 
+  803b43:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b47:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b4b:	83 e0 01             	and    $0x1,%eax
+  803b4e:	48 85 c0             	test   %rax,%rax
+  803b51:	74 7f                	je     803bd2 <dup+0x154>
+  803b53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b57:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b5b:	48 89 c2             	mov    %rax,%rdx
+  803b5e:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803b65:	ff ff ff 
+  803b68:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b6c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b70:	83 e0 01             	and    $0x1,%eax
+  803b73:	48 85 c0             	test   %rax,%rax
+  803b76:	74 5a                	je     803bd2 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803b78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803b7c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b80:	48 89 c2             	mov    %rax,%rdx
+  803b83:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803b8a:	ff ff ff 
+  803b8d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b91:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b95:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b9a:	89 c1                	mov    %eax,%ecx
+  803b9c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ba0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ba4:	41 89 c8             	mov    %ecx,%r8d
+  803ba7:	48 89 d1             	mov    %rdx,%rcx
+  803baa:	ba 00 00 00 00       	mov    $0x0,%edx
+  803baf:	48 89 c6             	mov    %rax,%rsi
+  803bb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bb7:	49 89 df             	mov    %rbx,%r15
+  803bba:	48 b8 f6 92 ff ff ff 	movabs $0xffffffffffff92f6,%rax
+  803bc1:	ff ff ff 
+  803bc4:	48 01 d8             	add    %rbx,%rax
+  803bc7:	ff d0                	call   *%rax
+  803bc9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803bcc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803bd0:	78 5f                	js     803c31 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803bd2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bd6:	48 c1 e8 0c          	shr    $0xc,%rax
+  803bda:	48 89 c2             	mov    %rax,%rdx
+  803bdd:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803be4:	ff ff ff 
+  803be7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803beb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803bef:	25 07 0e 00 00       	and    $0xe07,%eax
+  803bf4:	89 c1                	mov    %eax,%ecx
+  803bf6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bfa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803bfe:	41 89 c8             	mov    %ecx,%r8d
+  803c01:	48 89 d1             	mov    %rdx,%rcx
+  803c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c09:	48 89 c6             	mov    %rax,%rsi
+  803c0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c11:	49 89 df             	mov    %rbx,%r15
+  803c14:	48 b8 f6 92 ff ff ff 	movabs $0xffffffffffff92f6,%rax
+  803c1b:	ff ff ff 
+  803c1e:	48 01 d8             	add    %rbx,%rax
+  803c21:	ff d0                	call   *%rax
+  803c23:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c26:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c2a:	78 08                	js     803c34 <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803c2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c2f:	eb 43                	jmp    803c74 <dup+0x1f6>
+			goto err;
+  803c31:	90                   	nop
+  803c32:	eb 01                	jmp    803c35 <dup+0x1b7>
+		goto err;
+  803c34:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803c35:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c39:	48 89 c6             	mov    %rax,%rsi
+  803c3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c41:	49 89 df             	mov    %rbx,%r15
+  803c44:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  803c4b:	ff ff ff 
+  803c4e:	48 01 d8             	add    %rbx,%rax
+  803c51:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803c53:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c57:	48 89 c6             	mov    %rax,%rsi
+  803c5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c5f:	49 89 df             	mov    %rbx,%r15
+  803c62:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  803c69:	ff ff ff 
+  803c6c:	48 01 d8             	add    %rbx,%rax
+  803c6f:	ff d0                	call   *%rax
+	return r;
+  803c71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803c74:	48 83 c4 40          	add    $0x40,%rsp
+  803c78:	5b                   	pop    %rbx
+  803c79:	41 5f                	pop    %r15
+  803c7b:	5d                   	pop    %rbp
+  803c7c:	c3                   	ret
+
+0000000000803c7d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803c7d:	55                   	push   %rbp
+  803c7e:	48 89 e5             	mov    %rsp,%rbp
+  803c81:	41 57                	push   %r15
+  803c83:	53                   	push   %rbx
+  803c84:	48 83 ec 40          	sub    $0x40,%rsp
+  803c88:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c88 <read+0xb>
+  803c8f:	49 bb b8 53 00 00 00 	movabs $0x53b8,%r11
+  803c96:	00 00 00 
+  803c99:	4c 01 db             	add    %r11,%rbx
+  803c9c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803c9f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ca3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803ca7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803cab:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803cae:	48 89 d6             	mov    %rdx,%rsi
+  803cb1:	89 c7                	mov    %eax,%edi
+  803cb3:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  803cba:	ff ff ff 
+  803cbd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cc1:	ff d0                	call   *%rax
+  803cc3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cc6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cca:	78 28                	js     803cf4 <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ccc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803cd0:	8b 00                	mov    (%rax),%eax
+  803cd2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803cd6:	48 89 d6             	mov    %rdx,%rsi
+  803cd9:	89 c7                	mov    %eax,%edi
+  803cdb:	48 b8 9c a8 ff ff ff 	movabs $0xffffffffffffa89c,%rax
+  803ce2:	ff ff ff 
+  803ce5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ce9:	ff d0                	call   *%rax
+  803ceb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803cee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803cf2:	79 08                	jns    803cfc <read+0x7f>
+		return r;
+  803cf4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cf7:	e9 8b 00 00 00       	jmp    803d87 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803cfc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d00:	8b 40 08             	mov    0x8(%rax),%eax
+  803d03:	83 e0 03             	and    $0x3,%eax
+  803d06:	83 f8 01             	cmp    $0x1,%eax
+  803d09:	75 4b                	jne    803d56 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803d0b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803d12:	ff ff ff 
+  803d15:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803d19:	48 8b 00             	mov    (%rax),%rax
+  803d1c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803d22:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803d25:	89 c6                	mov    %eax,%esi
+  803d27:	48 b8 7f e6 ff ff ff 	movabs $0xffffffffffffe67f,%rax
+  803d2e:	ff ff ff 
+  803d31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d35:	48 89 c7             	mov    %rax,%rdi
+  803d38:	49 89 df             	mov    %rbx,%r15
+  803d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d40:	48 b9 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rcx
+  803d47:	ff ff ff 
+  803d4a:	48 01 d9             	add    %rbx,%rcx
+  803d4d:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803d4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d54:	eb 31                	jmp    803d87 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803d56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d5a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803d5e:	48 85 c0             	test   %rax,%rax
+  803d61:	75 07                	jne    803d6a <read+0xed>
+		return -E_NOT_SUPP;
+  803d63:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803d68:	eb 1d                	jmp    803d87 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803d6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d6e:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803d72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d76:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803d7a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803d7e:	48 89 ce             	mov    %rcx,%rsi
+  803d81:	48 89 c7             	mov    %rax,%rdi
+  803d84:	41 ff d0             	call   *%r8
+}
+  803d87:	48 83 c4 40          	add    $0x40,%rsp
+  803d8b:	5b                   	pop    %rbx
+  803d8c:	41 5f                	pop    %r15
+  803d8e:	5d                   	pop    %rbp
+  803d8f:	c3                   	ret
+
+0000000000803d90 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803d90:	55                   	push   %rbp
+  803d91:	48 89 e5             	mov    %rsp,%rbp
+  803d94:	53                   	push   %rbx
+  803d95:	48 83 ec 38          	sub    $0x38,%rsp
+  803d99:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d99 <readn+0x9>
+  803da0:	49 bb a7 52 00 00 00 	movabs $0x52a7,%r11
+  803da7:	00 00 00 
+  803daa:	4c 01 db             	add    %r11,%rbx
+  803dad:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803db0:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803db4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803db8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803dbf:	eb 4b                	jmp    803e0c <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803dc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dc4:	48 98                	cltq
+  803dc6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803dca:	48 29 c2             	sub    %rax,%rdx
+  803dcd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dd0:	48 63 c8             	movslq %eax,%rcx
+  803dd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803dd7:	48 01 c1             	add    %rax,%rcx
+  803dda:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ddd:	48 89 ce             	mov    %rcx,%rsi
+  803de0:	89 c7                	mov    %eax,%edi
+  803de2:	48 b8 3d ac ff ff ff 	movabs $0xffffffffffffac3d,%rax
+  803de9:	ff ff ff 
+  803dec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803df0:	ff d0                	call   *%rax
+  803df2:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803df5:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803df9:	79 05                	jns    803e00 <readn+0x70>
+			return m;
+  803dfb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803dfe:	eb 1d                	jmp    803e1d <readn+0x8d>
+		if (m == 0)
+  803e00:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803e04:	74 13                	je     803e19 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803e06:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e09:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803e0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e0f:	48 98                	cltq
+  803e11:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803e15:	72 aa                	jb     803dc1 <readn+0x31>
+  803e17:	eb 01                	jmp    803e1a <readn+0x8a>
+			break;
+  803e19:	90                   	nop
+	}
+	return tot;
+  803e1a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803e1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e21:	c9                   	leave
+  803e22:	c3                   	ret
+
+0000000000803e23 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803e23:	55                   	push   %rbp
+  803e24:	48 89 e5             	mov    %rsp,%rbp
+  803e27:	41 57                	push   %r15
+  803e29:	53                   	push   %rbx
+  803e2a:	48 83 ec 40          	sub    $0x40,%rsp
+  803e2e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803e2e <write+0xb>
+  803e35:	49 bb 12 52 00 00 00 	movabs $0x5212,%r11
+  803e3c:	00 00 00 
+  803e3f:	4c 01 db             	add    %r11,%rbx
+  803e42:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803e45:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803e49:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803e4d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803e51:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803e54:	48 89 d6             	mov    %rdx,%rsi
+  803e57:	89 c7                	mov    %eax,%edi
+  803e59:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  803e60:	ff ff ff 
+  803e63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e67:	ff d0                	call   *%rax
+  803e69:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e6c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e70:	78 28                	js     803e9a <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803e72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e76:	8b 00                	mov    (%rax),%eax
+  803e78:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803e7c:	48 89 d6             	mov    %rdx,%rsi
+  803e7f:	89 c7                	mov    %eax,%edi
+  803e81:	48 b8 9c a8 ff ff ff 	movabs $0xffffffffffffa89c,%rax
+  803e88:	ff ff ff 
+  803e8b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e8f:	ff d0                	call   *%rax
+  803e91:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803e94:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803e98:	79 08                	jns    803ea2 <write+0x7f>
+		return r;
+  803e9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e9d:	e9 8a 00 00 00       	jmp    803f2c <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803ea2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ea6:	8b 40 08             	mov    0x8(%rax),%eax
+  803ea9:	83 e0 03             	and    $0x3,%eax
+  803eac:	85 c0                	test   %eax,%eax
+  803eae:	75 4b                	jne    803efb <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803eb0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803eb7:	ff ff ff 
+  803eba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803ebe:	48 8b 00             	mov    (%rax),%rax
+  803ec1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803ec7:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803eca:	89 c6                	mov    %eax,%esi
+  803ecc:	48 b8 9b e6 ff ff ff 	movabs $0xffffffffffffe69b,%rax
+  803ed3:	ff ff ff 
+  803ed6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eda:	48 89 c7             	mov    %rax,%rdi
+  803edd:	49 89 df             	mov    %rbx,%r15
+  803ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee5:	48 b9 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rcx
+  803eec:	ff ff ff 
+  803eef:	48 01 d9             	add    %rbx,%rcx
+  803ef2:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803ef4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ef9:	eb 31                	jmp    803f2c <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803efb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803eff:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803f03:	48 85 c0             	test   %rax,%rax
+  803f06:	75 07                	jne    803f0f <write+0xec>
+		return -E_NOT_SUPP;
+  803f08:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f0d:	eb 1d                	jmp    803f2c <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803f0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f13:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803f17:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f1b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803f1f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f23:	48 89 ce             	mov    %rcx,%rsi
+  803f26:	48 89 c7             	mov    %rax,%rdi
+  803f29:	41 ff d0             	call   *%r8
+}
+  803f2c:	48 83 c4 40          	add    $0x40,%rsp
+  803f30:	5b                   	pop    %rbx
+  803f31:	41 5f                	pop    %r15
+  803f33:	5d                   	pop    %rbp
+  803f34:	c3                   	ret
+
+0000000000803f35 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803f35:	55                   	push   %rbp
+  803f36:	48 89 e5             	mov    %rsp,%rbp
+  803f39:	48 83 ec 18          	sub    $0x18,%rsp
+  803f3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803f3d <seek+0x8>
+  803f44:	49 bb 03 51 00 00 00 	movabs $0x5103,%r11
+  803f4b:	00 00 00 
+  803f4e:	4c 01 d8             	add    %r11,%rax
+  803f51:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f54:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803f57:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803f5b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803f5e:	48 89 ce             	mov    %rcx,%rsi
+  803f61:	89 d7                	mov    %edx,%edi
+  803f63:	48 ba f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rdx
+  803f6a:	ff ff ff 
+  803f6d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803f71:	ff d0                	call   *%rax
+  803f73:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f76:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f7a:	79 05                	jns    803f81 <seek+0x4c>
+		return r;
+  803f7c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f7f:	eb 0f                	jmp    803f90 <seek+0x5b>
+	fd->fd_offset = offset;
+  803f81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f85:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803f88:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f90:	c9                   	leave
+  803f91:	c3                   	ret
+
+0000000000803f92 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803f92:	55                   	push   %rbp
+  803f93:	48 89 e5             	mov    %rsp,%rbp
+  803f96:	41 57                	push   %r15
+  803f98:	53                   	push   %rbx
+  803f99:	48 83 ec 30          	sub    $0x30,%rsp
+  803f9d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f9d <ftruncate+0xb>
+  803fa4:	49 bb a3 50 00 00 00 	movabs $0x50a3,%r11
+  803fab:	00 00 00 
+  803fae:	4c 01 db             	add    %r11,%rbx
+  803fb1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803fb4:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803fb7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803fbb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803fbe:	48 89 d6             	mov    %rdx,%rsi
+  803fc1:	89 c7                	mov    %eax,%edi
+  803fc3:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  803fca:	ff ff ff 
+  803fcd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fd1:	ff d0                	call   *%rax
+  803fd3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fd6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fda:	78 28                	js     804004 <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803fdc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fe0:	8b 00                	mov    (%rax),%eax
+  803fe2:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803fe6:	48 89 d6             	mov    %rdx,%rsi
+  803fe9:	89 c7                	mov    %eax,%edi
+  803feb:	48 b8 9c a8 ff ff ff 	movabs $0xffffffffffffa89c,%rax
+  803ff2:	ff ff ff 
+  803ff5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ff9:	ff d0                	call   *%rax
+  803ffb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ffe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804002:	79 08                	jns    80400c <ftruncate+0x7a>
+		return r;
+  804004:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804007:	e9 83 00 00 00       	jmp    80408f <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80400c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804010:	8b 40 08             	mov    0x8(%rax),%eax
+  804013:	83 e0 03             	and    $0x3,%eax
+  804016:	85 c0                	test   %eax,%eax
+  804018:	75 4b                	jne    804065 <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  80401a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804021:	ff ff ff 
+  804024:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804028:	48 8b 00             	mov    (%rax),%rax
+  80402b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804031:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804034:	89 c6                	mov    %eax,%esi
+  804036:	48 b8 b8 e6 ff ff ff 	movabs $0xffffffffffffe6b8,%rax
+  80403d:	ff ff ff 
+  804040:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804044:	48 89 c7             	mov    %rax,%rdi
+  804047:	49 89 df             	mov    %rbx,%r15
+  80404a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80404f:	48 b9 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rcx
+  804056:	ff ff ff 
+  804059:	48 01 d9             	add    %rbx,%rcx
+  80405c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80405e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804063:	eb 2a                	jmp    80408f <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  804065:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804069:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80406d:	48 85 c0             	test   %rax,%rax
+  804070:	75 07                	jne    804079 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  804072:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804077:	eb 16                	jmp    80408f <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  804079:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80407d:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804081:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804085:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  804088:	89 d6                	mov    %edx,%esi
+  80408a:	48 89 c7             	mov    %rax,%rdi
+  80408d:	ff d1                	call   *%rcx
+}
+  80408f:	48 83 c4 30          	add    $0x30,%rsp
+  804093:	5b                   	pop    %rbx
+  804094:	41 5f                	pop    %r15
+  804096:	5d                   	pop    %rbp
+  804097:	c3                   	ret
+
+0000000000804098 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  804098:	55                   	push   %rbp
+  804099:	48 89 e5             	mov    %rsp,%rbp
+  80409c:	53                   	push   %rbx
+  80409d:	48 83 ec 38          	sub    $0x38,%rsp
+  8040a1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8040a1 <fstat+0x9>
+  8040a8:	49 bb 9f 4f 00 00 00 	movabs $0x4f9f,%r11
+  8040af:	00 00 00 
+  8040b2:	4c 01 db             	add    %r11,%rbx
+  8040b5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8040b8:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8040bc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8040c0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8040c3:	48 89 d6             	mov    %rdx,%rsi
+  8040c6:	89 c7                	mov    %eax,%edi
+  8040c8:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  8040cf:	ff ff ff 
+  8040d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040d6:	ff d0                	call   *%rax
+  8040d8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040db:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040df:	78 28                	js     804109 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8040e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040e5:	8b 00                	mov    (%rax),%eax
+  8040e7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8040eb:	48 89 d6             	mov    %rdx,%rsi
+  8040ee:	89 c7                	mov    %eax,%edi
+  8040f0:	48 b8 9c a8 ff ff ff 	movabs $0xffffffffffffa89c,%rax
+  8040f7:	ff ff ff 
+  8040fa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040fe:	ff d0                	call   *%rax
+  804100:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804103:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804107:	79 05                	jns    80410e <fstat+0x76>
+		return r;
+  804109:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80410c:	eb 5e                	jmp    80416c <fstat+0xd4>
+	if (!dev->dev_stat)
+  80410e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804112:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804116:	48 85 c0             	test   %rax,%rax
+  804119:	75 07                	jne    804122 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  80411b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804120:	eb 4a                	jmp    80416c <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804122:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804126:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804129:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80412d:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804134:	00 00 00 
+	stat->st_isdir = 0;
+  804137:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80413b:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804142:	00 00 00 
+	stat->st_dev = dev;
+  804145:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804149:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80414d:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  804154:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804158:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80415c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804160:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804164:	48 89 d6             	mov    %rdx,%rsi
+  804167:	48 89 c7             	mov    %rax,%rdi
+  80416a:	ff d1                	call   *%rcx
+}
+  80416c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804170:	c9                   	leave
+  804171:	c3                   	ret
+
+0000000000804172 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804172:	55                   	push   %rbp
+  804173:	48 89 e5             	mov    %rsp,%rbp
+  804176:	41 57                	push   %r15
+  804178:	53                   	push   %rbx
+  804179:	48 83 ec 20          	sub    $0x20,%rsp
+  80417d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80417d <stat+0xb>
+  804184:	49 bb c3 4e 00 00 00 	movabs $0x4ec3,%r11
+  80418b:	00 00 00 
+  80418e:	4c 01 db             	add    %r11,%rbx
+  804191:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804195:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  804199:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80419d:	be 00 00 00 00       	mov    $0x0,%esi
+  8041a2:	48 89 c7             	mov    %rax,%rdi
+  8041a5:	49 89 df             	mov    %rbx,%r15
+  8041a8:	48 b8 0c b4 ff ff ff 	movabs $0xffffffffffffb40c,%rax
+  8041af:	ff ff ff 
+  8041b2:	48 01 d8             	add    %rbx,%rax
+  8041b5:	ff d0                	call   *%rax
+  8041b7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041be:	79 05                	jns    8041c5 <stat+0x53>
+		return fd;
+  8041c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041c3:	eb 37                	jmp    8041fc <stat+0x8a>
+	r = fstat(fd, stat);
+  8041c5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8041c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041cc:	48 89 d6             	mov    %rdx,%rsi
+  8041cf:	89 c7                	mov    %eax,%edi
+  8041d1:	48 b8 58 b0 ff ff ff 	movabs $0xffffffffffffb058,%rax
+  8041d8:	ff ff ff 
+  8041db:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041df:	ff d0                	call   *%rax
+  8041e1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8041e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041e7:	89 c7                	mov    %eax,%edi
+  8041e9:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  8041f0:	ff ff ff 
+  8041f3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041f7:	ff d0                	call   *%rax
+	return r;
+  8041f9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8041fc:	48 83 c4 20          	add    $0x20,%rsp
+  804200:	5b                   	pop    %rbx
+  804201:	41 5f                	pop    %r15
+  804203:	5d                   	pop    %rbp
+  804204:	c3                   	ret
+
+0000000000804205 <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  804205:	55                   	push   %rbp
+  804206:	48 89 e5             	mov    %rsp,%rbp
+  804209:	41 57                	push   %r15
+  80420b:	53                   	push   %rbx
+  80420c:	48 83 ec 10          	sub    $0x10,%rsp
+  804210:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804210 <fsipc+0xb>
+  804217:	49 bb 30 4e 00 00 00 	movabs $0x4e30,%r11
+  80421e:	00 00 00 
+  804221:	4c 01 db             	add    %r11,%rbx
+  804224:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804227:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  80422b:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804232:	00 00 00 
+  804235:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804238:	85 c0                	test   %eax,%eax
+  80423a:	75 24                	jne    804260 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80423c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804241:	49 89 df             	mov    %rbx,%r15
+  804244:	48 b8 67 de ff ff ff 	movabs $0xffffffffffffde67,%rax
+  80424b:	ff ff ff 
+  80424e:	48 01 d8             	add    %rbx,%rax
+  804251:	ff d0                	call   *%rax
+  804253:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80425a:	00 00 00 
+  80425d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  804260:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804267:	00 00 00 
+  80426a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80426d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804271:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804274:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80427a:	49 89 d0             	mov    %rdx,%r8
+  80427d:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804282:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804289:	00 00 00 
+  80428c:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804290:	89 c7                	mov    %eax,%edi
+  804292:	49 89 df             	mov    %rbx,%r15
+  804295:	48 b8 86 d8 ff ff ff 	movabs $0xffffffffffffd886,%rax
+  80429c:	ff ff ff 
+  80429f:	48 01 d8             	add    %rbx,%rax
+  8042a2:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8042a4:	48 83 c4 10          	add    $0x10,%rsp
+  8042a8:	5b                   	pop    %rbx
+  8042a9:	41 5f                	pop    %r15
+  8042ab:	5d                   	pop    %rbp
+  8042ac:	c3                   	ret
+
+00000000008042ad <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8042ad:	55                   	push   %rbp
+  8042ae:	48 89 e5             	mov    %rsp,%rbp
+  8042b1:	41 57                	push   %r15
+  8042b3:	53                   	push   %rbx
+  8042b4:	48 83 ec 20          	sub    $0x20,%rsp
+  8042b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042b8 <fsipc_words+0xb>
+  8042bf:	49 bb 88 4d 00 00 00 	movabs $0x4d88,%r11
+  8042c6:	00 00 00 
+  8042c9:	4c 01 db             	add    %r11,%rbx
+  8042cc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8042cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8042d3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8042d7:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8042de:	00 00 00 
+  8042e1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8042e4:	85 c0                	test   %eax,%eax
+  8042e6:	75 24                	jne    80430c <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8042e8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042ed:	49 89 df             	mov    %rbx,%r15
+  8042f0:	48 b8 67 de ff ff ff 	movabs $0xffffffffffffde67,%rax
+  8042f7:	ff ff ff 
+  8042fa:	48 01 d8             	add    %rbx,%rax
+  8042fd:	ff d0                	call   *%rax
+  8042ff:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804306:	00 00 00 
+  804309:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  80430c:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804313:	00 00 00 
+  804316:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804319:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80431d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804321:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804324:	89 c7                	mov    %eax,%edi
+  804326:	49 89 df             	mov    %rbx,%r15
+  804329:	48 b8 71 d9 ff ff ff 	movabs $0xffffffffffffd971,%rax
+  804330:	ff ff ff 
+  804333:	48 01 d8             	add    %rbx,%rax
+  804336:	ff d0                	call   *%rax
+}
+  804338:	48 83 c4 20          	add    $0x20,%rsp
+  80433c:	5b                   	pop    %rbx
+  80433d:	41 5f                	pop    %r15
+  80433f:	5d                   	pop    %rbp
+  804340:	c3                   	ret
+
+0000000000804341 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804341:	55                   	push   %rbp
+  804342:	48 89 e5             	mov    %rsp,%rbp
+  804345:	41 57                	push   %r15
+  804347:	53                   	push   %rbx
+  804348:	48 83 ec 40          	sub    $0x40,%rsp
+  80434c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80434c <fsipc_pages+0xb>
+  804353:	49 bb f4 4c 00 00 00 	movabs $0x4cf4,%r11
+  80435a:	00 00 00 
+  80435d:	4c 01 db             	add    %r11,%rbx
+  804360:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804363:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804367:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  80436b:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  80436e:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804375:	00 00 00 
+  804378:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80437b:	85 c0                	test   %eax,%eax
+  80437d:	75 24                	jne    8043a3 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80437f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804384:	49 89 df             	mov    %rbx,%r15
+  804387:	48 b8 67 de ff ff ff 	movabs $0xffffffffffffde67,%rax
+  80438e:	ff ff ff 
+  804391:	48 01 d8             	add    %rbx,%rax
+  804394:	ff d0                	call   *%rax
+  804396:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  80439d:	00 00 00 
+  8043a0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8043a3:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8043a8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8043ac:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8043af:	48 98                	cltq
+  8043b1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8043b5:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8043b9:	0f 95 c0             	setne  %al
+  8043bc:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  8043bf:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8043c6:	00 
+  8043c7:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8043cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043cf:	48 01 d0             	add    %rdx,%rax
+  8043d2:	48 83 e8 01          	sub    $0x1,%rax
+  8043d6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8043da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043e3:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8043e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043eb:	48 29 d0             	sub    %rdx,%rax
+  8043ee:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8043f2:	41 89 c2             	mov    %eax,%r10d
+  8043f5:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8043fc:	00 00 00 
+  8043ff:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804402:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804406:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80440a:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  80440d:	48 83 ec 08          	sub    $0x8,%rsp
+  804411:	6a 40                	push   $0x40
+  804413:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804418:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  80441f:	00 
+  804420:	6a 05                	push   $0x5
+  804422:	41 89 f9             	mov    %edi,%r9d
+  804425:	49 89 c8             	mov    %rcx,%r8
+  804428:	44 89 d1             	mov    %r10d,%ecx
+  80442b:	89 c7                	mov    %eax,%edi
+  80442d:	49 89 df             	mov    %rbx,%r15
+  804430:	48 b8 6f da ff ff ff 	movabs $0xffffffffffffda6f,%rax
+  804437:	ff ff ff 
+  80443a:	48 01 d8             	add    %rbx,%rax
+  80443d:	ff d0                	call   *%rax
+  80443f:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804443:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804447:	5b                   	pop    %rbx
+  804448:	41 5f                	pop    %r15
+  80444a:	5d                   	pop    %rbp
+  80444b:	c3                   	ret
+
+000000000080444c <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  80444c:	55                   	push   %rbp
+  80444d:	48 89 e5             	mov    %rsp,%rbp
+  804450:	41 57                	push   %r15
+  804452:	53                   	push   %rbx
+  804453:	48 83 ec 20          	sub    $0x20,%rsp
+  804457:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804457 <open+0xb>
+  80445e:	49 bb e9 4b 00 00 00 	movabs $0x4be9,%r11
+  804465:	00 00 00 
+  804468:	4c 01 db             	add    %r11,%rbx
+  80446b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80446f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804472:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804476:	48 89 c7             	mov    %rax,%rdi
+  804479:	49 89 df             	mov    %rbx,%r15
+  80447c:	48 b8 41 85 ff ff ff 	movabs $0xffffffffffff8541,%rax
+  804483:	ff ff ff 
+  804486:	48 01 d8             	add    %rbx,%rax
+  804489:	ff d0                	call   *%rax
+  80448b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804490:	7e 0a                	jle    80449c <open+0x50>
+		return -E_BAD_PATH;
+  804492:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804497:	e9 18 01 00 00       	jmp    8045b4 <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  80449c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8044a0:	48 89 c7             	mov    %rax,%rdi
+  8044a3:	49 89 df             	mov    %rbx,%r15
+  8044a6:	48 b8 40 a6 ff ff ff 	movabs $0xffffffffffffa640,%rax
+  8044ad:	ff ff ff 
+  8044b0:	48 01 d8             	add    %rbx,%rax
+  8044b3:	ff d0                	call   *%rax
+  8044b5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044b8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044bc:	74 08                	je     8044c6 <open+0x7a>
+		return r;
+  8044be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044c1:	e9 ee 00 00 00       	jmp    8045b4 <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8044c6:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8044cd:	00 00 00 
+  8044d0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8044d3:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8044da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044de:	48 89 c6             	mov    %rax,%rsi
+  8044e1:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8044e8:	00 00 00 
+  8044eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044ef:	48 89 c7             	mov    %rax,%rdi
+  8044f2:	49 89 df             	mov    %rbx,%r15
+  8044f5:	48 b8 d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rax
+  8044fc:	ff ff ff 
+  8044ff:	48 01 d8             	add    %rbx,%rax
+  804502:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804504:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804508:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  80450d:	48 89 c6             	mov    %rax,%rsi
+  804510:	bf 00 00 00 00       	mov    $0x0,%edi
+  804515:	49 89 df             	mov    %rbx,%r15
+  804518:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  80451f:	ff ff ff 
+  804522:	48 01 d8             	add    %rbx,%rax
+  804525:	ff d0                	call   *%rax
+  804527:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80452a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80452e:	74 23                	je     804553 <open+0x107>
+		fd_close(fd,0);
+  804530:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804534:	be 00 00 00 00       	mov    $0x0,%esi
+  804539:	48 89 c7             	mov    %rax,%rdi
+  80453c:	49 89 df             	mov    %rbx,%r15
+  80453f:	48 b8 a1 a7 ff ff ff 	movabs $0xffffffffffffa7a1,%rax
+  804546:	ff ff ff 
+  804549:	48 01 d8             	add    %rbx,%rax
+  80454c:	ff d0                	call   *%rax
+		return r;
+  80454e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804551:	eb 61                	jmp    8045b4 <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804553:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804557:	48 89 c6             	mov    %rax,%rsi
+  80455a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80455f:	48 b8 c5 b1 ff ff ff 	movabs $0xffffffffffffb1c5,%rax
+  804566:	ff ff ff 
+  804569:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80456d:	ff d0                	call   *%rax
+  80456f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804572:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804576:	74 23                	je     80459b <open+0x14f>
+		fd_close(fd,0);
+  804578:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80457c:	be 00 00 00 00       	mov    $0x0,%esi
+  804581:	48 89 c7             	mov    %rax,%rdi
+  804584:	49 89 df             	mov    %rbx,%r15
+  804587:	48 b8 a1 a7 ff ff ff 	movabs $0xffffffffffffa7a1,%rax
+  80458e:	ff ff ff 
+  804591:	48 01 d8             	add    %rbx,%rax
+  804594:	ff d0                	call   *%rax
+		return r;
+  804596:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804599:	eb 19                	jmp    8045b4 <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  80459b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80459f:	48 89 c7             	mov    %rax,%rdi
+  8045a2:	49 89 df             	mov    %rbx,%r15
+  8045a5:	48 b8 c6 a5 ff ff ff 	movabs $0xffffffffffffa5c6,%rax
+  8045ac:	ff ff ff 
+  8045af:	48 01 d8             	add    %rbx,%rax
+  8045b2:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8045b4:	48 83 c4 20          	add    $0x20,%rsp
+  8045b8:	5b                   	pop    %rbx
+  8045b9:	41 5f                	pop    %r15
+  8045bb:	5d                   	pop    %rbp
+  8045bc:	c3                   	ret
+
+00000000008045bd <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8045bd:	55                   	push   %rbp
+  8045be:	48 89 e5             	mov    %rsp,%rbp
+  8045c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8045c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8045c5 <devfile_flush+0x8>
+  8045cc:	49 bb 7b 4a 00 00 00 	movabs $0x4a7b,%r11
+  8045d3:	00 00 00 
+  8045d6:	4c 01 d8             	add    %r11,%rax
+  8045d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8045dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8045e1:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8045e4:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8045e7:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8045eb:	ba 04 00 00 00       	mov    $0x4,%edx
+  8045f0:	48 89 ce             	mov    %rcx,%rsi
+  8045f3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8045f8:	48 b9 6d b2 ff ff ff 	movabs $0xffffffffffffb26d,%rcx
+  8045ff:	ff ff ff 
+  804602:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804606:	ff d0                	call   *%rax
+}
+  804608:	c9                   	leave
+  804609:	c3                   	ret
+
+000000000080460a <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  80460a:	55                   	push   %rbp
+  80460b:	48 89 e5             	mov    %rsp,%rbp
+  80460e:	41 57                	push   %r15
+  804610:	53                   	push   %rbx
+  804611:	48 83 ec 60          	sub    $0x60,%rsp
+  804615:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804615 <devfile_read+0xb>
+  80461c:	49 bb 2b 4a 00 00 00 	movabs $0x4a2b,%r11
+  804623:	00 00 00 
+  804626:	4c 01 db             	add    %r11,%rbx
+  804629:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80462d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804631:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804635:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804639:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  80463d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804641:	8b 50 0c             	mov    0xc(%rax),%edx
+  804644:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804648:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80464a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80464e:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804652:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804656:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80465a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80465f:	ba 10 00 00 00       	mov    $0x10,%edx
+  804664:	48 89 c6             	mov    %rax,%rsi
+  804667:	bf 03 00 00 00       	mov    $0x3,%edi
+  80466c:	48 b8 01 b3 ff ff ff 	movabs $0xffffffffffffb301,%rax
+  804673:	ff ff ff 
+  804676:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80467a:	ff d0                	call   *%rax
+  80467c:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80467f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804683:	79 05                	jns    80468a <devfile_read+0x80>
+		return r;
+  804685:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804688:	eb 64                	jmp    8046ee <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  80468a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80468d:	48 63 d0             	movslq %eax,%rdx
+  804690:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804694:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804699:	48 01 c1             	add    %rax,%rcx
+  80469c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8046a0:	48 89 ce             	mov    %rcx,%rsi
+  8046a3:	48 89 c7             	mov    %rax,%rdi
+  8046a6:	49 89 df             	mov    %rbx,%r15
+  8046a9:	48 b8 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rax
+  8046b0:	ff ff ff 
+  8046b3:	48 01 d8             	add    %rbx,%rax
+  8046b6:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8046b8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8046bf:	ff ff ff 
+  8046c2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8046c6:	48 8b 00             	mov    (%rax),%rax
+  8046c9:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8046cf:	89 c6                	mov    %eax,%esi
+  8046d1:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8046d6:	48 89 c7             	mov    %rax,%rdi
+  8046d9:	49 89 df             	mov    %rbx,%r15
+  8046dc:	48 b8 21 de ff ff ff 	movabs $0xffffffffffffde21,%rax
+  8046e3:	ff ff ff 
+  8046e6:	48 01 d8             	add    %rbx,%rax
+  8046e9:	ff d0                	call   *%rax
+	return r;
+  8046eb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8046ee:	48 83 c4 60          	add    $0x60,%rsp
+  8046f2:	5b                   	pop    %rbx
+  8046f3:	41 5f                	pop    %r15
+  8046f5:	5d                   	pop    %rbp
+  8046f6:	c3                   	ret
+
+00000000008046f7 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8046f7:	55                   	push   %rbp
+  8046f8:	48 89 e5             	mov    %rsp,%rbp
+  8046fb:	41 57                	push   %r15
+  8046fd:	53                   	push   %rbx
+  8046fe:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804702:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804702 <devfile_write+0xb>
+  804709:	49 bb 3e 49 00 00 00 	movabs $0x493e,%r11
+  804710:	00 00 00 
+  804713:	4c 01 db             	add    %r11,%rbx
+  804716:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80471a:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  80471e:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804725:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804729:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  80472d:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804734:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804738:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  80473f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804742:	48 63 d0             	movslq %eax,%rdx
+  804745:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804749:	48 39 c2             	cmp    %rax,%rdx
+  80474c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804750:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804757:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  80475e:	00 
+  80475f:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804766:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80476a:	48 01 d0             	add    %rdx,%rax
+  80476d:	48 83 e8 01          	sub    $0x1,%rax
+  804771:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804775:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804779:	ba 00 00 00 00       	mov    $0x0,%edx
+  80477e:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804782:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804786:	48 29 d0             	sub    %rdx,%rax
+  804789:	48 c1 e8 0c          	shr    $0xc,%rax
+  80478d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804790:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804793:	89 c6                	mov    %eax,%esi
+  804795:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80479a:	48 89 c7             	mov    %rax,%rdi
+  80479d:	49 89 df             	mov    %rbx,%r15
+  8047a0:	48 b8 db dd ff ff ff 	movabs $0xffffffffffffdddb,%rax
+  8047a7:	ff ff ff 
+  8047aa:	48 01 d8             	add    %rbx,%rax
+  8047ad:	ff d0                	call   *%rax
+  8047af:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8047b2:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8047b6:	79 08                	jns    8047c0 <devfile_write+0xc9>
+		return r;
+  8047b8:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8047bb:	e9 8f 00 00 00       	jmp    80484f <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8047c0:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8047c7:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8047cb:	48 89 c6             	mov    %rax,%rsi
+  8047ce:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8047d3:	48 89 c7             	mov    %rax,%rdi
+  8047d6:	49 89 df             	mov    %rbx,%r15
+  8047d9:	48 b8 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rax
+  8047e0:	ff ff ff 
+  8047e3:	48 01 d8             	add    %rbx,%rax
+  8047e6:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8047e8:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8047ec:	8b 50 0c             	mov    0xc(%rax),%edx
+  8047ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047f3:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8047f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047f9:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804800:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804804:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804807:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80480b:	89 d1                	mov    %edx,%ecx
+  80480d:	ba 10 00 00 00       	mov    $0x10,%edx
+  804812:	48 89 c6             	mov    %rax,%rsi
+  804815:	bf 04 00 00 00       	mov    $0x4,%edi
+  80481a:	48 b8 01 b3 ff ff ff 	movabs $0xffffffffffffb301,%rax
+  804821:	ff ff ff 
+  804824:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804828:	ff d0                	call   *%rax
+  80482a:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  80482d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804830:	89 c6                	mov    %eax,%esi
+  804832:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804837:	48 89 c7             	mov    %rax,%rdi
+  80483a:	49 89 df             	mov    %rbx,%r15
+  80483d:	48 b8 21 de ff ff ff 	movabs $0xffffffffffffde21,%rax
+  804844:	ff ff ff 
+  804847:	48 01 d8             	add    %rbx,%rax
+  80484a:	ff d0                	call   *%rax
+	return r;
+  80484c:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  80484f:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804853:	5b                   	pop    %rbx
+  804854:	41 5f                	pop    %r15
+  804856:	5d                   	pop    %rbp
+  804857:	c3                   	ret
+
+0000000000804858 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804858:	55                   	push   %rbp
+  804859:	48 89 e5             	mov    %rsp,%rbp
+  80485c:	41 57                	push   %r15
+  80485e:	53                   	push   %rbx
+  80485f:	48 83 ec 20          	sub    $0x20,%rsp
+  804863:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804863 <devfile_stat+0xb>
+  80486a:	49 bb dd 47 00 00 00 	movabs $0x47dd,%r11
+  804871:	00 00 00 
+  804874:	4c 01 db             	add    %r11,%rbx
+  804877:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80487b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80487f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804883:	8b 40 0c             	mov    0xc(%rax),%eax
+  804886:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80488d:	00 00 00 
+  804890:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804893:	be 00 00 00 00       	mov    $0x0,%esi
+  804898:	bf 05 00 00 00       	mov    $0x5,%edi
+  80489d:	48 b8 c5 b1 ff ff ff 	movabs $0xffffffffffffb1c5,%rax
+  8048a4:	ff ff ff 
+  8048a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048ab:	ff d0                	call   *%rax
+  8048ad:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048b0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048b4:	79 05                	jns    8048bb <devfile_stat+0x63>
+		return r;
+  8048b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048b9:	eb 65                	jmp    804920 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8048bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048bf:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8048c6:	00 00 00 
+  8048c9:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8048cd:	48 89 d6             	mov    %rdx,%rsi
+  8048d0:	48 89 c7             	mov    %rax,%rdi
+  8048d3:	49 89 df             	mov    %rbx,%r15
+  8048d6:	48 b8 d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rax
+  8048dd:	ff ff ff 
+  8048e0:	48 01 d8             	add    %rbx,%rax
+  8048e3:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8048e5:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8048ec:	00 00 00 
+  8048ef:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8048f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048fa:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804900:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804907:	00 00 00 
+  80490a:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  804911:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804915:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  80491b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804920:	48 83 c4 20          	add    $0x20,%rsp
+  804924:	5b                   	pop    %rbx
+  804925:	41 5f                	pop    %r15
+  804927:	5d                   	pop    %rbp
+  804928:	c3                   	ret
+
+0000000000804929 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804929:	55                   	push   %rbp
+  80492a:	48 89 e5             	mov    %rsp,%rbp
+  80492d:	48 83 ec 20          	sub    $0x20,%rsp
+  804931:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804931 <devfile_trunc+0x8>
+  804938:	49 bb 0f 47 00 00 00 	movabs $0x470f,%r11
+  80493f:	00 00 00 
+  804942:	4c 01 d8             	add    %r11,%rax
+  804945:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804949:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  80494c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804950:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804953:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804956:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804959:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  80495c:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804960:	ba 08 00 00 00       	mov    $0x8,%edx
+  804965:	48 89 ce             	mov    %rcx,%rsi
+  804968:	bf 02 00 00 00       	mov    $0x2,%edi
+  80496d:	48 b9 6d b2 ff ff ff 	movabs $0xffffffffffffb26d,%rcx
+  804974:	ff ff ff 
+  804977:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80497b:	ff d0                	call   *%rax
+}
+  80497d:	c9                   	leave
+  80497e:	c3                   	ret
+
+000000000080497f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80497f:	55                   	push   %rbp
+  804980:	48 89 e5             	mov    %rsp,%rbp
+  804983:	41 57                	push   %r15
+  804985:	53                   	push   %rbx
+  804986:	48 83 ec 10          	sub    $0x10,%rsp
+  80498a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80498a <remove+0xb>
+  804991:	49 bb b6 46 00 00 00 	movabs $0x46b6,%r11
+  804998:	00 00 00 
+  80499b:	4c 01 db             	add    %r11,%rbx
+  80499e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8049a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049a6:	48 89 c7             	mov    %rax,%rdi
+  8049a9:	49 89 df             	mov    %rbx,%r15
+  8049ac:	48 b8 41 85 ff ff ff 	movabs $0xffffffffffff8541,%rax
+  8049b3:	ff ff ff 
+  8049b6:	48 01 d8             	add    %rbx,%rax
+  8049b9:	ff d0                	call   *%rax
+  8049bb:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8049c0:	7e 07                	jle    8049c9 <remove+0x4a>
+		return -E_BAD_PATH;
+  8049c2:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8049c7:	eb 44                	jmp    804a0d <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8049c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049cd:	48 89 c6             	mov    %rax,%rsi
+  8049d0:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8049d7:	00 00 00 
+  8049da:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049de:	48 89 c7             	mov    %rax,%rdi
+  8049e1:	49 89 df             	mov    %rbx,%r15
+  8049e4:	48 b8 d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rax
+  8049eb:	ff ff ff 
+  8049ee:	48 01 d8             	add    %rbx,%rax
+  8049f1:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8049f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8049f8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8049fd:	48 b8 c5 b1 ff ff ff 	movabs $0xffffffffffffb1c5,%rax
+  804a04:	ff ff ff 
+  804a07:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a0b:	ff d0                	call   *%rax
+}
+  804a0d:	48 83 c4 10          	add    $0x10,%rsp
+  804a11:	5b                   	pop    %rbx
+  804a12:	41 5f                	pop    %r15
+  804a14:	5d                   	pop    %rbp
+  804a15:	c3                   	ret
+
+0000000000804a16 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804a16:	55                   	push   %rbp
+  804a17:	48 89 e5             	mov    %rsp,%rbp
+  804a1a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804a1a <sync+0x4>
+  804a21:	49 bb 26 46 00 00 00 	movabs $0x4626,%r11
+  804a28:	00 00 00 
+  804a2b:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804a2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a33:	be 00 00 00 00       	mov    $0x0,%esi
+  804a38:	bf 08 00 00 00       	mov    $0x8,%edi
+  804a3d:	48 b9 6d b2 ff ff ff 	movabs $0xffffffffffffb26d,%rcx
+  804a44:	ff ff ff 
+  804a47:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804a4b:	ff d0                	call   *%rax
+}
+  804a4d:	5d                   	pop    %rbp
+  804a4e:	c3                   	ret
+
+0000000000804a4f <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804a4f:	55                   	push   %rbp
+  804a50:	48 89 e5             	mov    %rsp,%rbp
+  804a53:	41 57                	push   %r15
+  804a55:	53                   	push   %rbx
+  804a56:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804a5d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a5d <copy+0xe>
+  804a64:	49 bb e3 45 00 00 00 	movabs $0x45e3,%r11
+  804a6b:	00 00 00 
+  804a6e:	4c 01 db             	add    %r11,%rbx
+  804a71:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804a78:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  804a7f:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  804a86:	be 00 00 00 00       	mov    $0x0,%esi
+  804a8b:	48 89 c7             	mov    %rax,%rdi
+  804a8e:	48 b8 0c b4 ff ff ff 	movabs $0xffffffffffffb40c,%rax
+  804a95:	ff ff ff 
+  804a98:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a9c:	ff d0                	call   *%rax
+  804a9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  804aa1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804aa5:	79 35                	jns    804adc <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  804aa7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804aaa:	89 c6                	mov    %eax,%esi
+  804aac:	48 b8 de e6 ff ff ff 	movabs $0xffffffffffffe6de,%rax
+  804ab3:	ff ff ff 
+  804ab6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804aba:	48 89 c7             	mov    %rax,%rdi
+  804abd:	49 89 df             	mov    %rbx,%r15
+  804ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ac5:	48 ba 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rdx
+  804acc:	ff ff ff 
+  804acf:	48 01 da             	add    %rbx,%rdx
+  804ad2:	ff d2                	call   *%rdx
+		return fd_src;
+  804ad4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ad7:	e9 d7 01 00 00       	jmp    804cb3 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  804adc:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  804ae3:	be 01 01 00 00       	mov    $0x101,%esi
+  804ae8:	48 89 c7             	mov    %rax,%rdi
+  804aeb:	48 b8 0c b4 ff ff ff 	movabs $0xffffffffffffb40c,%rax
+  804af2:	ff ff ff 
+  804af5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804af9:	ff d0                	call   *%rax
+  804afb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804afe:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804b02:	0f 89 df 00 00 00    	jns    804be7 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804b08:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b0b:	89 c6                	mov    %eax,%esi
+  804b0d:	48 b8 f4 e6 ff ff ff 	movabs $0xffffffffffffe6f4,%rax
+  804b14:	ff ff ff 
+  804b17:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b1b:	48 89 c7             	mov    %rax,%rdi
+  804b1e:	49 89 df             	mov    %rbx,%r15
+  804b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b26:	48 ba 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rdx
+  804b2d:	ff ff ff 
+  804b30:	48 01 da             	add    %rbx,%rdx
+  804b33:	ff d2                	call   *%rdx
+		close(fd_src);
+  804b35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b38:	89 c7                	mov    %eax,%edi
+  804b3a:	49 89 df             	mov    %rbx,%r15
+  804b3d:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  804b44:	ff ff ff 
+  804b47:	48 01 d8             	add    %rbx,%rax
+  804b4a:	ff d0                	call   *%rax
+		return fd_dest;
+  804b4c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b4f:	e9 5f 01 00 00       	jmp    804cb3 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804b54:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b57:	48 63 d0             	movslq %eax,%rdx
+  804b5a:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804b61:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b64:	48 89 ce             	mov    %rcx,%rsi
+  804b67:	89 c7                	mov    %eax,%edi
+  804b69:	49 89 df             	mov    %rbx,%r15
+  804b6c:	48 b8 e3 ad ff ff ff 	movabs $0xffffffffffffade3,%rax
+  804b73:	ff ff ff 
+  804b76:	48 01 d8             	add    %rbx,%rax
+  804b79:	ff d0                	call   *%rax
+  804b7b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804b7e:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804b82:	79 63                	jns    804be7 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804b84:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804b87:	89 c6                	mov    %eax,%esi
+  804b89:	48 b8 0e e7 ff ff ff 	movabs $0xffffffffffffe70e,%rax
+  804b90:	ff ff ff 
+  804b93:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b97:	48 89 c7             	mov    %rax,%rdi
+  804b9a:	49 89 df             	mov    %rbx,%r15
+  804b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba2:	48 ba 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rdx
+  804ba9:	ff ff ff 
+  804bac:	48 01 da             	add    %rbx,%rdx
+  804baf:	ff d2                	call   *%rdx
+			close(fd_src);
+  804bb1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bb4:	89 c7                	mov    %eax,%edi
+  804bb6:	49 89 df             	mov    %rbx,%r15
+  804bb9:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  804bc0:	ff ff ff 
+  804bc3:	48 01 d8             	add    %rbx,%rax
+  804bc6:	ff d0                	call   *%rax
+			close(fd_dest);
+  804bc8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bcb:	89 c7                	mov    %eax,%edi
+  804bcd:	49 89 df             	mov    %rbx,%r15
+  804bd0:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  804bd7:	ff ff ff 
+  804bda:	48 01 d8             	add    %rbx,%rax
+  804bdd:	ff d0                	call   *%rax
+			return write_size;
+  804bdf:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804be2:	e9 cc 00 00 00       	jmp    804cb3 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804be7:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804bee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bf1:	ba 00 02 00 00       	mov    $0x200,%edx
+  804bf6:	48 89 ce             	mov    %rcx,%rsi
+  804bf9:	89 c7                	mov    %eax,%edi
+  804bfb:	49 89 df             	mov    %rbx,%r15
+  804bfe:	48 b8 3d ac ff ff ff 	movabs $0xffffffffffffac3d,%rax
+  804c05:	ff ff ff 
+  804c08:	48 01 d8             	add    %rbx,%rax
+  804c0b:	ff d0                	call   *%rax
+  804c0d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804c10:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804c14:	0f 8f 3a ff ff ff    	jg     804b54 <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804c1a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804c1e:	79 60                	jns    804c80 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804c20:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c23:	89 c6                	mov    %eax,%esi
+  804c25:	48 b8 21 e7 ff ff ff 	movabs $0xffffffffffffe721,%rax
+  804c2c:	ff ff ff 
+  804c2f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c33:	48 89 c7             	mov    %rax,%rdi
+  804c36:	49 89 df             	mov    %rbx,%r15
+  804c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c3e:	48 ba 13 78 ff ff ff 	movabs $0xffffffffffff7813,%rdx
+  804c45:	ff ff ff 
+  804c48:	48 01 da             	add    %rbx,%rdx
+  804c4b:	ff d2                	call   *%rdx
+		close(fd_src);
+  804c4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c50:	89 c7                	mov    %eax,%edi
+  804c52:	49 89 df             	mov    %rbx,%r15
+  804c55:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  804c5c:	ff ff ff 
+  804c5f:	48 01 d8             	add    %rbx,%rax
+  804c62:	ff d0                	call   *%rax
+		close(fd_dest);
+  804c64:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c67:	89 c7                	mov    %eax,%edi
+  804c69:	49 89 df             	mov    %rbx,%r15
+  804c6c:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  804c73:	ff ff ff 
+  804c76:	48 01 d8             	add    %rbx,%rax
+  804c79:	ff d0                	call   *%rax
+		return read_size;
+  804c7b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804c7e:	eb 33                	jmp    804cb3 <copy+0x264>
+	}
+	close(fd_src);
+  804c80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c83:	89 c7                	mov    %eax,%edi
+  804c85:	49 89 df             	mov    %rbx,%r15
+  804c88:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  804c8f:	ff ff ff 
+  804c92:	48 01 d8             	add    %rbx,%rax
+  804c95:	ff d0                	call   *%rax
+	close(fd_dest);
+  804c97:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804c9a:	89 c7                	mov    %eax,%edi
+  804c9c:	49 89 df             	mov    %rbx,%r15
+  804c9f:	48 b8 85 a9 ff ff ff 	movabs $0xffffffffffffa985,%rax
+  804ca6:	ff ff ff 
+  804ca9:	48 01 d8             	add    %rbx,%rax
+  804cac:	ff d0                	call   *%rax
+	return 0;
+  804cae:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804cb3:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804cba:	5b                   	pop    %rbx
+  804cbb:	41 5f                	pop    %r15
+  804cbd:	5d                   	pop    %rbp
+  804cbe:	c3                   	ret
+
+0000000000804cbf <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804cbf:	55                   	push   %rbp
+  804cc0:	48 89 e5             	mov    %rsp,%rbp
+  804cc3:	41 57                	push   %r15
+  804cc5:	53                   	push   %rbx
+  804cc6:	48 83 ec 20          	sub    $0x20,%rsp
+  804cca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804cca <fd2sockid+0xb>
+  804cd1:	49 bb 76 43 00 00 00 	movabs $0x4376,%r11
+  804cd8:	00 00 00 
+  804cdb:	4c 01 db             	add    %r11,%rbx
+  804cde:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804ce1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804ce5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ce8:	48 89 d6             	mov    %rdx,%rsi
+  804ceb:	89 c7                	mov    %eax,%edi
+  804ced:	49 89 df             	mov    %rbx,%r15
+  804cf0:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  804cf7:	ff ff ff 
+  804cfa:	48 01 d8             	add    %rbx,%rax
+  804cfd:	ff d0                	call   *%rax
+  804cff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d02:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d06:	79 05                	jns    804d0d <fd2sockid+0x4e>
+		return r;
+  804d08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d0b:	eb 25                	jmp    804d32 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804d0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d11:	8b 10                	mov    (%rax),%edx
+  804d13:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  804d1a:	00 00 00 
+  804d1d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804d20:	39 c2                	cmp    %eax,%edx
+  804d22:	74 07                	je     804d2b <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804d24:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804d29:	eb 07                	jmp    804d32 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804d2b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d2f:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804d32:	48 83 c4 20          	add    $0x20,%rsp
+  804d36:	5b                   	pop    %rbx
+  804d37:	41 5f                	pop    %r15
+  804d39:	5d                   	pop    %rbp
+  804d3a:	c3                   	ret
+
+0000000000804d3b <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804d3b:	55                   	push   %rbp
+  804d3c:	48 89 e5             	mov    %rsp,%rbp
+  804d3f:	41 57                	push   %r15
+  804d41:	53                   	push   %rbx
+  804d42:	48 83 ec 20          	sub    $0x20,%rsp
+  804d46:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d46 <alloc_sockfd+0xb>
+  804d4d:	49 bb fa 42 00 00 00 	movabs $0x42fa,%r11
+  804d54:	00 00 00 
+  804d57:	4c 01 db             	add    %r11,%rbx
+  804d5a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804d5d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804d61:	48 89 c7             	mov    %rax,%rdi
+  804d64:	49 89 df             	mov    %rbx,%r15
+  804d67:	48 b8 40 a6 ff ff ff 	movabs $0xffffffffffffa640,%rax
+  804d6e:	ff ff ff 
+  804d71:	48 01 d8             	add    %rbx,%rax
+  804d74:	ff d0                	call   *%rax
+  804d76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d7d:	78 2c                	js     804dab <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804d7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d83:	ba 07 04 00 00       	mov    $0x407,%edx
+  804d88:	48 89 c6             	mov    %rax,%rsi
+  804d8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d90:	49 89 df             	mov    %rbx,%r15
+  804d93:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  804d9a:	ff ff ff 
+  804d9d:	48 01 d8             	add    %rbx,%rax
+  804da0:	ff d0                	call   *%rax
+  804da2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804da5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804da9:	79 1c                	jns    804dc7 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804dab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804dae:	89 c7                	mov    %eax,%edi
+  804db0:	49 89 df             	mov    %rbx,%r15
+  804db3:	48 b8 ef c4 ff ff ff 	movabs $0xffffffffffffc4ef,%rax
+  804dba:	ff ff ff 
+  804dbd:	48 01 d8             	add    %rbx,%rax
+  804dc0:	ff d0                	call   *%rax
+		return r;
+  804dc2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dc5:	eb 41                	jmp    804e08 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804dc7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804dcb:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  804dd2:	00 00 00 
+  804dd5:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804dd8:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804dda:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804dde:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804de5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804de9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804dec:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804def:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804df3:	48 89 c7             	mov    %rax,%rdi
+  804df6:	49 89 df             	mov    %rbx,%r15
+  804df9:	48 b8 c6 a5 ff ff ff 	movabs $0xffffffffffffa5c6,%rax
+  804e00:	ff ff ff 
+  804e03:	48 01 d8             	add    %rbx,%rax
+  804e06:	ff d0                	call   *%rax
+}
+  804e08:	48 83 c4 20          	add    $0x20,%rsp
+  804e0c:	5b                   	pop    %rbx
+  804e0d:	41 5f                	pop    %r15
+  804e0f:	5d                   	pop    %rbp
+  804e10:	c3                   	ret
+
+0000000000804e11 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804e11:	55                   	push   %rbp
+  804e12:	48 89 e5             	mov    %rsp,%rbp
+  804e15:	41 57                	push   %r15
+  804e17:	53                   	push   %rbx
+  804e18:	48 83 ec 30          	sub    $0x30,%rsp
+  804e1c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e1c <accept+0xb>
+  804e23:	49 bb 24 42 00 00 00 	movabs $0x4224,%r11
+  804e2a:	00 00 00 
+  804e2d:	4c 01 db             	add    %r11,%rbx
+  804e30:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e33:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804e37:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804e3b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e3e:	89 c7                	mov    %eax,%edi
+  804e40:	48 b8 7f bc ff ff ff 	movabs $0xffffffffffffbc7f,%rax
+  804e47:	ff ff ff 
+  804e4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e4e:	ff d0                	call   *%rax
+  804e50:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e53:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e57:	79 05                	jns    804e5e <accept+0x4d>
+		return r;
+  804e59:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e5c:	eb 45                	jmp    804ea3 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804e5e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e62:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804e66:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e69:	48 89 ce             	mov    %rcx,%rsi
+  804e6c:	89 c7                	mov    %eax,%edi
+  804e6e:	49 89 df             	mov    %rbx,%r15
+  804e71:	48 b8 5d c3 ff ff ff 	movabs $0xffffffffffffc35d,%rax
+  804e78:	ff ff ff 
+  804e7b:	48 01 d8             	add    %rbx,%rax
+  804e7e:	ff d0                	call   *%rax
+  804e80:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e83:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e87:	79 05                	jns    804e8e <accept+0x7d>
+		return r;
+  804e89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e8c:	eb 15                	jmp    804ea3 <accept+0x92>
+	return alloc_sockfd(r);
+  804e8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e91:	89 c7                	mov    %eax,%edi
+  804e93:	48 b8 fb bc ff ff ff 	movabs $0xffffffffffffbcfb,%rax
+  804e9a:	ff ff ff 
+  804e9d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ea1:	ff d0                	call   *%rax
+}
+  804ea3:	48 83 c4 30          	add    $0x30,%rsp
+  804ea7:	5b                   	pop    %rbx
+  804ea8:	41 5f                	pop    %r15
+  804eaa:	5d                   	pop    %rbp
+  804eab:	c3                   	ret
+
+0000000000804eac <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804eac:	55                   	push   %rbp
+  804ead:	48 89 e5             	mov    %rsp,%rbp
+  804eb0:	41 57                	push   %r15
+  804eb2:	53                   	push   %rbx
+  804eb3:	48 83 ec 20          	sub    $0x20,%rsp
+  804eb7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804eb7 <bind+0xb>
+  804ebe:	49 bb 89 41 00 00 00 	movabs $0x4189,%r11
+  804ec5:	00 00 00 
+  804ec8:	4c 01 db             	add    %r11,%rbx
+  804ecb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804ece:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804ed2:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804ed5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ed8:	89 c7                	mov    %eax,%edi
+  804eda:	48 b8 7f bc ff ff ff 	movabs $0xffffffffffffbc7f,%rax
+  804ee1:	ff ff ff 
+  804ee4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ee8:	ff d0                	call   *%rax
+  804eea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804eed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ef1:	79 05                	jns    804ef8 <bind+0x4c>
+		return r;
+  804ef3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ef6:	eb 21                	jmp    804f19 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804ef8:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804efb:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804eff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f02:	48 89 ce             	mov    %rcx,%rsi
+  804f05:	89 c7                	mov    %eax,%edi
+  804f07:	49 89 df             	mov    %rbx,%r15
+  804f0a:	48 b8 09 c4 ff ff ff 	movabs $0xffffffffffffc409,%rax
+  804f11:	ff ff ff 
+  804f14:	48 01 d8             	add    %rbx,%rax
+  804f17:	ff d0                	call   *%rax
+}
+  804f19:	48 83 c4 20          	add    $0x20,%rsp
+  804f1d:	5b                   	pop    %rbx
+  804f1e:	41 5f                	pop    %r15
+  804f20:	5d                   	pop    %rbp
+  804f21:	c3                   	ret
+
+0000000000804f22 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804f22:	55                   	push   %rbp
+  804f23:	48 89 e5             	mov    %rsp,%rbp
+  804f26:	41 57                	push   %r15
+  804f28:	53                   	push   %rbx
+  804f29:	48 83 ec 20          	sub    $0x20,%rsp
+  804f2d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f2d <shutdown+0xb>
+  804f34:	49 bb 13 41 00 00 00 	movabs $0x4113,%r11
+  804f3b:	00 00 00 
+  804f3e:	4c 01 db             	add    %r11,%rbx
+  804f41:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f44:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804f47:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f4a:	89 c7                	mov    %eax,%edi
+  804f4c:	48 b8 7f bc ff ff ff 	movabs $0xffffffffffffbc7f,%rax
+  804f53:	ff ff ff 
+  804f56:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f5a:	ff d0                	call   *%rax
+  804f5c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f5f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f63:	79 05                	jns    804f6a <shutdown+0x48>
+		return r;
+  804f65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f68:	eb 1c                	jmp    804f86 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804f6a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804f6d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f70:	89 d6                	mov    %edx,%esi
+  804f72:	89 c7                	mov    %eax,%edi
+  804f74:	49 89 df             	mov    %rbx,%r15
+  804f77:	48 b8 9e c4 ff ff ff 	movabs $0xffffffffffffc49e,%rax
+  804f7e:	ff ff ff 
+  804f81:	48 01 d8             	add    %rbx,%rax
+  804f84:	ff d0                	call   *%rax
+}
+  804f86:	48 83 c4 20          	add    $0x20,%rsp
+  804f8a:	5b                   	pop    %rbx
+  804f8b:	41 5f                	pop    %r15
+  804f8d:	5d                   	pop    %rbp
+  804f8e:	c3                   	ret
+
+0000000000804f8f <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804f8f:	55                   	push   %rbp
+  804f90:	48 89 e5             	mov    %rsp,%rbp
+  804f93:	41 57                	push   %r15
+  804f95:	53                   	push   %rbx
+  804f96:	48 83 ec 10          	sub    $0x10,%rsp
+  804f9a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f9a <devsock_close+0xb>
+  804fa1:	49 bb a6 40 00 00 00 	movabs $0x40a6,%r11
+  804fa8:	00 00 00 
+  804fab:	4c 01 db             	add    %r11,%rbx
+  804fae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804fb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fb6:	48 89 c7             	mov    %rax,%rdi
+  804fb9:	49 89 df             	mov    %rbx,%r15
+  804fbc:	48 b8 f6 de ff ff ff 	movabs $0xffffffffffffdef6,%rax
+  804fc3:	ff ff ff 
+  804fc6:	48 01 d8             	add    %rbx,%rax
+  804fc9:	ff d0                	call   *%rax
+  804fcb:	83 f8 01             	cmp    $0x1,%eax
+  804fce:	75 1d                	jne    804fed <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804fd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fd4:	8b 40 0c             	mov    0xc(%rax),%eax
+  804fd7:	89 c7                	mov    %eax,%edi
+  804fd9:	49 89 df             	mov    %rbx,%r15
+  804fdc:	48 b8 ef c4 ff ff ff 	movabs $0xffffffffffffc4ef,%rax
+  804fe3:	ff ff ff 
+  804fe6:	48 01 d8             	add    %rbx,%rax
+  804fe9:	ff d0                	call   *%rax
+  804feb:	eb 05                	jmp    804ff2 <devsock_close+0x63>
+	else
+		return 0;
+  804fed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ff2:	48 83 c4 10          	add    $0x10,%rsp
+  804ff6:	5b                   	pop    %rbx
+  804ff7:	41 5f                	pop    %r15
+  804ff9:	5d                   	pop    %rbp
+  804ffa:	c3                   	ret
+
+0000000000804ffb <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804ffb:	55                   	push   %rbp
+  804ffc:	48 89 e5             	mov    %rsp,%rbp
+  804fff:	41 57                	push   %r15
+  805001:	53                   	push   %rbx
+  805002:	48 83 ec 20          	sub    $0x20,%rsp
+  805006:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805006 <connect+0xb>
+  80500d:	49 bb 3a 40 00 00 00 	movabs $0x403a,%r11
+  805014:	00 00 00 
+  805017:	4c 01 db             	add    %r11,%rbx
+  80501a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80501d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805021:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805024:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805027:	89 c7                	mov    %eax,%edi
+  805029:	48 b8 7f bc ff ff ff 	movabs $0xffffffffffffbc7f,%rax
+  805030:	ff ff ff 
+  805033:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805037:	ff d0                	call   *%rax
+  805039:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80503c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805040:	79 05                	jns    805047 <connect+0x4c>
+		return r;
+  805042:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805045:	eb 21                	jmp    805068 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  805047:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80504a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80504e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805051:	48 89 ce             	mov    %rcx,%rsi
+  805054:	89 c7                	mov    %eax,%edi
+  805056:	49 89 df             	mov    %rbx,%r15
+  805059:	48 b8 37 c5 ff ff ff 	movabs $0xffffffffffffc537,%rax
+  805060:	ff ff ff 
+  805063:	48 01 d8             	add    %rbx,%rax
+  805066:	ff d0                	call   *%rax
+}
+  805068:	48 83 c4 20          	add    $0x20,%rsp
+  80506c:	5b                   	pop    %rbx
+  80506d:	41 5f                	pop    %r15
+  80506f:	5d                   	pop    %rbp
+  805070:	c3                   	ret
+
+0000000000805071 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  805071:	55                   	push   %rbp
+  805072:	48 89 e5             	mov    %rsp,%rbp
+  805075:	41 57                	push   %r15
+  805077:	53                   	push   %rbx
+  805078:	48 83 ec 20          	sub    $0x20,%rsp
+  80507c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80507c <listen+0xb>
+  805083:	49 bb c4 3f 00 00 00 	movabs $0x3fc4,%r11
+  80508a:	00 00 00 
+  80508d:	4c 01 db             	add    %r11,%rbx
+  805090:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805093:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805096:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805099:	89 c7                	mov    %eax,%edi
+  80509b:	48 b8 7f bc ff ff ff 	movabs $0xffffffffffffbc7f,%rax
+  8050a2:	ff ff ff 
+  8050a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050a9:	ff d0                	call   *%rax
+  8050ab:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050b2:	79 05                	jns    8050b9 <listen+0x48>
+		return r;
+  8050b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050b7:	eb 1c                	jmp    8050d5 <listen+0x64>
+	return nsipc_listen(r, backlog);
+  8050b9:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8050bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050bf:	89 d6                	mov    %edx,%esi
+  8050c1:	89 c7                	mov    %eax,%edi
+  8050c3:	49 89 df             	mov    %rbx,%r15
+  8050c6:	48 b8 cc c5 ff ff ff 	movabs $0xffffffffffffc5cc,%rax
+  8050cd:	ff ff ff 
+  8050d0:	48 01 d8             	add    %rbx,%rax
+  8050d3:	ff d0                	call   *%rax
+}
+  8050d5:	48 83 c4 20          	add    $0x20,%rsp
+  8050d9:	5b                   	pop    %rbx
+  8050da:	41 5f                	pop    %r15
+  8050dc:	5d                   	pop    %rbp
+  8050dd:	c3                   	ret
+
+00000000008050de <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8050de:	55                   	push   %rbp
+  8050df:	48 89 e5             	mov    %rsp,%rbp
+  8050e2:	41 57                	push   %r15
+  8050e4:	48 83 ec 28          	sub    $0x28,%rsp
+  8050e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050e8 <devsock_read+0xa>
+  8050ef:	49 bb 58 3f 00 00 00 	movabs $0x3f58,%r11
+  8050f6:	00 00 00 
+  8050f9:	4c 01 d8             	add    %r11,%rax
+  8050fc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805100:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805104:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805108:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80510c:	41 89 d0             	mov    %edx,%r8d
+  80510f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805113:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805116:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80511a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80511f:	44 89 c2             	mov    %r8d,%edx
+  805122:	49 89 c7             	mov    %rax,%r15
+  805125:	49 b8 1d c6 ff ff ff 	movabs $0xffffffffffffc61d,%r8
+  80512c:	ff ff ff 
+  80512f:	49 01 c0             	add    %rax,%r8
+  805132:	41 ff d0             	call   *%r8
+}
+  805135:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805139:	c9                   	leave
+  80513a:	c3                   	ret
+
+000000000080513b <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  80513b:	55                   	push   %rbp
+  80513c:	48 89 e5             	mov    %rsp,%rbp
+  80513f:	41 57                	push   %r15
+  805141:	48 83 ec 28          	sub    $0x28,%rsp
+  805145:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805145 <devsock_write+0xa>
+  80514c:	49 bb fb 3e 00 00 00 	movabs $0x3efb,%r11
+  805153:	00 00 00 
+  805156:	4c 01 d8             	add    %r11,%rax
+  805159:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80515d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805161:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  805165:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805169:	41 89 d0             	mov    %edx,%r8d
+  80516c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805170:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805173:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805177:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80517c:	44 89 c2             	mov    %r8d,%edx
+  80517f:	49 89 c7             	mov    %rax,%r15
+  805182:	49 b8 3a c7 ff ff ff 	movabs $0xffffffffffffc73a,%r8
+  805189:	ff ff ff 
+  80518c:	49 01 c0             	add    %rax,%r8
+  80518f:	41 ff d0             	call   *%r8
+}
+  805192:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805196:	c9                   	leave
+  805197:	c3                   	ret
+
+0000000000805198 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  805198:	55                   	push   %rbp
+  805199:	48 89 e5             	mov    %rsp,%rbp
+  80519c:	41 57                	push   %r15
+  80519e:	48 83 ec 18          	sub    $0x18,%rsp
+  8051a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8051a2 <devsock_stat+0xa>
+  8051a9:	49 bb 9e 3e 00 00 00 	movabs $0x3e9e,%r11
+  8051b0:	00 00 00 
+  8051b3:	4c 01 d8             	add    %r11,%rax
+  8051b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8051ba:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8051be:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051c2:	48 b9 3c e7 ff ff ff 	movabs $0xffffffffffffe73c,%rcx
+  8051c9:	ff ff ff 
+  8051cc:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8051d0:	48 89 ce             	mov    %rcx,%rsi
+  8051d3:	48 89 d7             	mov    %rdx,%rdi
+  8051d6:	49 89 c7             	mov    %rax,%r15
+  8051d9:	48 ba d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rdx
+  8051e0:	ff ff ff 
+  8051e3:	48 01 c2             	add    %rax,%rdx
+  8051e6:	ff d2                	call   *%rdx
+	return 0;
+  8051e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051ed:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8051f1:	c9                   	leave
+  8051f2:	c3                   	ret
+
+00000000008051f3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8051f3:	55                   	push   %rbp
+  8051f4:	48 89 e5             	mov    %rsp,%rbp
+  8051f7:	41 57                	push   %r15
+  8051f9:	53                   	push   %rbx
+  8051fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8051fe:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051fe <socket+0xb>
+  805205:	49 bb 42 3e 00 00 00 	movabs $0x3e42,%r11
+  80520c:	00 00 00 
+  80520f:	4c 01 db             	add    %r11,%rbx
+  805212:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805215:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805218:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80521b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80521e:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805221:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805224:	89 ce                	mov    %ecx,%esi
+  805226:	89 c7                	mov    %eax,%edi
+  805228:	49 89 df             	mov    %rbx,%r15
+  80522b:	48 b8 11 c9 ff ff ff 	movabs $0xffffffffffffc911,%rax
+  805232:	ff ff ff 
+  805235:	48 01 d8             	add    %rbx,%rax
+  805238:	ff d0                	call   *%rax
+  80523a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80523d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805241:	79 05                	jns    805248 <socket+0x55>
+		return r;
+  805243:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805246:	eb 15                	jmp    80525d <socket+0x6a>
+	return alloc_sockfd(r);
+  805248:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80524b:	89 c7                	mov    %eax,%edi
+  80524d:	48 b8 fb bc ff ff ff 	movabs $0xffffffffffffbcfb,%rax
+  805254:	ff ff ff 
+  805257:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80525b:	ff d0                	call   *%rax
+}
+  80525d:	48 83 c4 20          	add    $0x20,%rsp
+  805261:	5b                   	pop    %rbx
+  805262:	41 5f                	pop    %r15
+  805264:	5d                   	pop    %rbp
+  805265:	c3                   	ret
+
+0000000000805266 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805266:	55                   	push   %rbp
+  805267:	48 89 e5             	mov    %rsp,%rbp
+  80526a:	41 57                	push   %r15
+  80526c:	53                   	push   %rbx
+  80526d:	48 83 ec 10          	sub    $0x10,%rsp
+  805271:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805271 <nsipc+0xb>
+  805278:	49 bb cf 3d 00 00 00 	movabs $0x3dcf,%r11
+  80527f:	00 00 00 
+  805282:	4c 01 db             	add    %r11,%rbx
+  805285:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805288:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80528f:	00 00 00 
+  805292:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805295:	85 c0                	test   %eax,%eax
+  805297:	75 24                	jne    8052bd <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805299:	bf 02 00 00 00       	mov    $0x2,%edi
+  80529e:	49 89 df             	mov    %rbx,%r15
+  8052a1:	48 b8 67 de ff ff ff 	movabs $0xffffffffffffde67,%rax
+  8052a8:	ff ff ff 
+  8052ab:	48 01 d8             	add    %rbx,%rax
+  8052ae:	ff d0                	call   *%rax
+  8052b0:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8052b7:	00 00 00 
+  8052ba:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  8052bd:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8052c4:	00 00 00 
+  8052c7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8052ca:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8052cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8052d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8052d9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8052de:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8052e5:	00 00 00 
+  8052e8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8052ec:	89 c7                	mov    %eax,%edi
+  8052ee:	49 89 df             	mov    %rbx,%r15
+  8052f1:	48 b8 86 d8 ff ff ff 	movabs $0xffffffffffffd886,%rax
+  8052f8:	ff ff ff 
+  8052fb:	48 01 d8             	add    %rbx,%rax
+  8052fe:	ff d0                	call   *%rax
+}
+  805300:	48 83 c4 10          	add    $0x10,%rsp
+  805304:	5b                   	pop    %rbx
+  805305:	41 5f                	pop    %r15
+  805307:	5d                   	pop    %rbp
+  805308:	c3                   	ret
+
+0000000000805309 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805309:	55                   	push   %rbp
+  80530a:	48 89 e5             	mov    %rsp,%rbp
+  80530d:	41 57                	push   %r15
+  80530f:	53                   	push   %rbx
+  805310:	48 83 ec 20          	sub    $0x20,%rsp
+  805314:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805314 <nsipc_words+0xb>
+  80531b:	49 bb 2c 3d 00 00 00 	movabs $0x3d2c,%r11
+  805322:	00 00 00 
+  805325:	4c 01 db             	add    %r11,%rbx
+  805328:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80532b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80532f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805333:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80533a:	00 00 00 
+  80533d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805340:	85 c0                	test   %eax,%eax
+  805342:	75 24                	jne    805368 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805344:	bf 02 00 00 00       	mov    $0x2,%edi
+  805349:	49 89 df             	mov    %rbx,%r15
+  80534c:	48 b8 67 de ff ff ff 	movabs $0xffffffffffffde67,%rax
+  805353:	ff ff ff 
+  805356:	48 01 d8             	add    %rbx,%rax
+  805359:	ff d0                	call   *%rax
+  80535b:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805362:	00 00 00 
+  805365:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805368:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80536f:	00 00 00 
+  805372:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805375:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805379:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80537d:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805380:	89 c7                	mov    %eax,%edi
+  805382:	49 89 df             	mov    %rbx,%r15
+  805385:	48 b8 71 d9 ff ff ff 	movabs $0xffffffffffffd971,%rax
+  80538c:	ff ff ff 
+  80538f:	48 01 d8             	add    %rbx,%rax
+  805392:	ff d0                	call   *%rax
+}
+  805394:	48 83 c4 20          	add    $0x20,%rsp
+  805398:	5b                   	pop    %rbx
+  805399:	41 5f                	pop    %r15
+  80539b:	5d                   	pop    %rbp
+  80539c:	c3                   	ret
+
+000000000080539d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80539d:	55                   	push   %rbp
+  80539e:	48 89 e5             	mov    %rsp,%rbp
+  8053a1:	41 57                	push   %r15
+  8053a3:	53                   	push   %rbx
+  8053a4:	48 83 ec 30          	sub    $0x30,%rsp
+  8053a8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053a8 <nsipc_accept+0xb>
+  8053af:	49 bb 98 3c 00 00 00 	movabs $0x3c98,%r11
+  8053b6:	00 00 00 
+  8053b9:	4c 01 db             	add    %r11,%rbx
+  8053bc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8053bf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8053c3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8053c7:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8053ce:	00 00 00 
+  8053d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8053d4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8053d7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8053dc:	48 b8 26 c2 ff ff ff 	movabs $0xffffffffffffc226,%rax
+  8053e3:	ff ff ff 
+  8053e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053ea:	ff d0                	call   *%rax
+  8053ec:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8053ef:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053f3:	78 48                	js     80543d <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8053f5:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  8053fc:	00 00 00 
+  8053ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805403:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805407:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80540b:	8b 40 10             	mov    0x10(%rax),%eax
+  80540e:	89 c2                	mov    %eax,%edx
+  805410:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805414:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805418:	48 89 ce             	mov    %rcx,%rsi
+  80541b:	48 89 c7             	mov    %rax,%rdi
+  80541e:	49 89 df             	mov    %rbx,%r15
+  805421:	48 b8 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rax
+  805428:	ff ff ff 
+  80542b:	48 01 d8             	add    %rbx,%rax
+  80542e:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805430:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805434:	8b 50 10             	mov    0x10(%rax),%edx
+  805437:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80543b:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  80543d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805440:	48 83 c4 30          	add    $0x30,%rsp
+  805444:	5b                   	pop    %rbx
+  805445:	41 5f                	pop    %r15
+  805447:	5d                   	pop    %rbp
+  805448:	c3                   	ret
+
+0000000000805449 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805449:	55                   	push   %rbp
+  80544a:	48 89 e5             	mov    %rsp,%rbp
+  80544d:	41 57                	push   %r15
+  80544f:	53                   	push   %rbx
+  805450:	48 83 ec 10          	sub    $0x10,%rsp
+  805454:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805454 <nsipc_bind+0xb>
+  80545b:	49 bb ec 3b 00 00 00 	movabs $0x3bec,%r11
+  805462:	00 00 00 
+  805465:	4c 01 db             	add    %r11,%rbx
+  805468:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80546b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80546f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805472:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805479:	00 00 00 
+  80547c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80547f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805482:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805485:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805489:	48 89 c6             	mov    %rax,%rsi
+  80548c:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805493:	00 00 00 
+  805496:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80549a:	48 89 c7             	mov    %rax,%rdi
+  80549d:	49 89 df             	mov    %rbx,%r15
+  8054a0:	48 b8 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rax
+  8054a7:	ff ff ff 
+  8054aa:	48 01 d8             	add    %rbx,%rax
+  8054ad:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8054af:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8054b6:	00 00 00 
+  8054b9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8054bc:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8054c0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8054c5:	48 b8 26 c2 ff ff ff 	movabs $0xffffffffffffc226,%rax
+  8054cc:	ff ff ff 
+  8054cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054d3:	ff d0                	call   *%rax
+}
+  8054d5:	48 83 c4 10          	add    $0x10,%rsp
+  8054d9:	5b                   	pop    %rbx
+  8054da:	41 5f                	pop    %r15
+  8054dc:	5d                   	pop    %rbp
+  8054dd:	c3                   	ret
+
+00000000008054de <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8054de:	55                   	push   %rbp
+  8054df:	48 89 e5             	mov    %rsp,%rbp
+  8054e2:	48 83 ec 20          	sub    $0x20,%rsp
+  8054e6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8054e6 <nsipc_shutdown+0x8>
+  8054ed:	49 bb 5a 3b 00 00 00 	movabs $0x3b5a,%r11
+  8054f4:	00 00 00 
+  8054f7:	4c 01 d8             	add    %r11,%rax
+  8054fa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8054fd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805500:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805503:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805506:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805509:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  80550c:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805510:	ba 08 00 00 00       	mov    $0x8,%edx
+  805515:	48 89 ce             	mov    %rcx,%rsi
+  805518:	bf 03 00 00 00       	mov    $0x3,%edi
+  80551d:	48 b9 c9 c2 ff ff ff 	movabs $0xffffffffffffc2c9,%rcx
+  805524:	ff ff ff 
+  805527:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80552b:	ff d0                	call   *%rax
+}
+  80552d:	c9                   	leave
+  80552e:	c3                   	ret
+
+000000000080552f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80552f:	55                   	push   %rbp
+  805530:	48 89 e5             	mov    %rsp,%rbp
+  805533:	48 83 ec 20          	sub    $0x20,%rsp
+  805537:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805537 <nsipc_close+0x8>
+  80553e:	49 bb 09 3b 00 00 00 	movabs $0x3b09,%r11
+  805545:	00 00 00 
+  805548:	4c 01 d8             	add    %r11,%rax
+  80554b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  80554e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805551:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805554:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805558:	ba 04 00 00 00       	mov    $0x4,%edx
+  80555d:	48 89 ce             	mov    %rcx,%rsi
+  805560:	bf 04 00 00 00       	mov    $0x4,%edi
+  805565:	48 b9 c9 c2 ff ff ff 	movabs $0xffffffffffffc2c9,%rcx
+  80556c:	ff ff ff 
+  80556f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805573:	ff d0                	call   *%rax
+}
+  805575:	c9                   	leave
+  805576:	c3                   	ret
+
+0000000000805577 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805577:	55                   	push   %rbp
+  805578:	48 89 e5             	mov    %rsp,%rbp
+  80557b:	41 57                	push   %r15
+  80557d:	53                   	push   %rbx
+  80557e:	48 83 ec 10          	sub    $0x10,%rsp
+  805582:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805582 <nsipc_connect+0xb>
+  805589:	49 bb be 3a 00 00 00 	movabs $0x3abe,%r11
+  805590:	00 00 00 
+  805593:	4c 01 db             	add    %r11,%rbx
+  805596:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805599:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80559d:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8055a0:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8055a7:	00 00 00 
+  8055aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055ad:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8055b0:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8055b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055b7:	48 89 c6             	mov    %rax,%rsi
+  8055ba:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  8055c1:	00 00 00 
+  8055c4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055c8:	48 89 c7             	mov    %rax,%rdi
+  8055cb:	49 89 df             	mov    %rbx,%r15
+  8055ce:	48 b8 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rax
+  8055d5:	ff ff ff 
+  8055d8:	48 01 d8             	add    %rbx,%rax
+  8055db:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8055dd:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8055e4:	00 00 00 
+  8055e7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8055ea:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8055ee:	bf 05 00 00 00       	mov    $0x5,%edi
+  8055f3:	48 b8 26 c2 ff ff ff 	movabs $0xffffffffffffc226,%rax
+  8055fa:	ff ff ff 
+  8055fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805601:	ff d0                	call   *%rax
+}
+  805603:	48 83 c4 10          	add    $0x10,%rsp
+  805607:	5b                   	pop    %rbx
+  805608:	41 5f                	pop    %r15
+  80560a:	5d                   	pop    %rbp
+  80560b:	c3                   	ret
+
+000000000080560c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80560c:	55                   	push   %rbp
+  80560d:	48 89 e5             	mov    %rsp,%rbp
+  805610:	48 83 ec 20          	sub    $0x20,%rsp
+  805614:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805614 <nsipc_listen+0x8>
+  80561b:	49 bb 2c 3a 00 00 00 	movabs $0x3a2c,%r11
+  805622:	00 00 00 
+  805625:	4c 01 d8             	add    %r11,%rax
+  805628:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80562b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  80562e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805631:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805634:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805637:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  80563a:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80563e:	ba 08 00 00 00       	mov    $0x8,%edx
+  805643:	48 89 ce             	mov    %rcx,%rsi
+  805646:	bf 06 00 00 00       	mov    $0x6,%edi
+  80564b:	48 b9 c9 c2 ff ff ff 	movabs $0xffffffffffffc2c9,%rcx
+  805652:	ff ff ff 
+  805655:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805659:	ff d0                	call   *%rax
+}
+  80565b:	c9                   	leave
+  80565c:	c3                   	ret
+
+000000000080565d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  80565d:	55                   	push   %rbp
+  80565e:	48 89 e5             	mov    %rsp,%rbp
+  805661:	41 57                	push   %r15
+  805663:	53                   	push   %rbx
+  805664:	48 83 ec 30          	sub    $0x30,%rsp
+  805668:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805668 <nsipc_recv+0xb>
+  80566f:	49 bb d8 39 00 00 00 	movabs $0x39d8,%r11
+  805676:	00 00 00 
+  805679:	4c 01 db             	add    %r11,%rbx
+  80567c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80567f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805683:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805686:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805689:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805690:	00 00 00 
+  805693:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805696:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805699:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8056a0:	00 00 00 
+  8056a3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8056a6:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8056aa:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8056b1:	00 00 00 
+  8056b4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8056b7:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8056bb:	bf 07 00 00 00       	mov    $0x7,%edi
+  8056c0:	48 b8 26 c2 ff ff ff 	movabs $0xffffffffffffc226,%rax
+  8056c7:	ff ff ff 
+  8056ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056ce:	ff d0                	call   *%rax
+  8056d0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056d3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056d7:	0f 88 91 00 00 00    	js     80576e <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8056dd:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8056e4:	7f 08                	jg     8056ee <nsipc_recv+0x91>
+  8056e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056e9:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8056ec:	7e 50                	jle    80573e <nsipc_recv+0xe1>
+  8056ee:	48 b8 43 e7 ff ff ff 	movabs $0xffffffffffffe743,%rax
+  8056f5:	ff ff ff 
+  8056f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056fc:	48 89 c1             	mov    %rax,%rcx
+  8056ff:	48 b8 58 e7 ff ff ff 	movabs $0xffffffffffffe758,%rax
+  805706:	ff ff ff 
+  805709:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80570d:	48 89 c2             	mov    %rax,%rdx
+  805710:	be 79 00 00 00       	mov    $0x79,%esi
+  805715:	48 b8 6d e7 ff ff ff 	movabs $0xffffffffffffe76d,%rax
+  80571c:	ff ff ff 
+  80571f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805723:	48 89 c7             	mov    %rax,%rdi
+  805726:	49 89 df             	mov    %rbx,%r15
+  805729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80572e:	49 b8 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r8
+  805735:	ff ff ff 
+  805738:	49 01 d8             	add    %rbx,%r8
+  80573b:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80573e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805741:	48 63 d0             	movslq %eax,%rdx
+  805744:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805748:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80574f:	00 00 00 
+  805752:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805756:	48 89 ce             	mov    %rcx,%rsi
+  805759:	48 89 c7             	mov    %rax,%rdi
+  80575c:	49 89 df             	mov    %rbx,%r15
+  80575f:	48 b8 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rax
+  805766:	ff ff ff 
+  805769:	48 01 d8             	add    %rbx,%rax
+  80576c:	ff d0                	call   *%rax
+	}
+
+	return r;
+  80576e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805771:	48 83 c4 30          	add    $0x30,%rsp
+  805775:	5b                   	pop    %rbx
+  805776:	41 5f                	pop    %r15
+  805778:	5d                   	pop    %rbp
+  805779:	c3                   	ret
+
+000000000080577a <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80577a:	55                   	push   %rbp
+  80577b:	48 89 e5             	mov    %rsp,%rbp
+  80577e:	41 57                	push   %r15
+  805780:	53                   	push   %rbx
+  805781:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805788:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805788 <nsipc_send+0xe>
+  80578f:	49 bb b8 38 00 00 00 	movabs $0x38b8,%r11
+  805796:	00 00 00 
+  805799:	4c 01 db             	add    %r11,%rbx
+  80579c:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8057a2:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8057a9:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8057af:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8057b5:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8057b9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  8057bd:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8057c4:	00 00 00 
+  8057c7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8057ca:	85 c0                	test   %eax,%eax
+  8057cc:	75 24                	jne    8057f2 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8057ce:	bf 02 00 00 00       	mov    $0x2,%edi
+  8057d3:	49 89 df             	mov    %rbx,%r15
+  8057d6:	48 b8 67 de ff ff ff 	movabs $0xffffffffffffde67,%rax
+  8057dd:	ff ff ff 
+  8057e0:	48 01 d8             	add    %rbx,%rax
+  8057e3:	ff d0                	call   *%rax
+  8057e5:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8057ec:	00 00 00 
+  8057ef:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8057f2:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8057f8:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8057fb:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805802:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805805:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805808:	39 c2                	cmp    %eax,%edx
+  80580a:	0f 4e c2             	cmovle %edx,%eax
+  80580d:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805813:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805819:	48 63 d0             	movslq %eax,%rdx
+  80581c:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805823:	48 89 c6             	mov    %rax,%rsi
+  805826:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  80582d:	00 00 00 
+  805830:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805834:	48 89 c7             	mov    %rax,%rdi
+  805837:	49 89 df             	mov    %rbx,%r15
+  80583a:	48 b8 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rax
+  805841:	ff ff ff 
+  805844:	48 01 d8             	add    %rbx,%rax
+  805847:	ff d0                	call   *%rax
+	req->req_s = s;
+  805849:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80584d:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805853:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805855:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805859:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  80585f:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805862:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805866:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  80586c:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  80586f:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805876:	00 00 00 
+  805879:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80587d:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805881:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805888:	00 
+  805889:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80588f:	48 63 d0             	movslq %eax,%rdx
+  805892:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805896:	48 01 d0             	add    %rdx,%rax
+  805899:	48 83 e8 01          	sub    $0x1,%rax
+  80589d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8058a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8058a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058aa:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8058ae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8058b2:	48 29 d0             	sub    %rdx,%rax
+  8058b5:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8058bb:	85 c0                	test   %eax,%eax
+  8058bd:	0f 48 c2             	cmovs  %edx,%eax
+  8058c0:	c1 f8 0c             	sar    $0xc,%eax
+  8058c3:	48 98                	cltq
+  8058c5:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8058c9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8058cd:	48 85 c0             	test   %rax,%rax
+  8058d0:	0f 95 c0             	setne  %al
+  8058d3:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8058d6:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8058dd:	00 
+  8058de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8058e2:	48 83 c0 0b          	add    $0xb,%rax
+  8058e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8058ea:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8058ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058f3:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8058f7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8058fb:	48 29 d0             	sub    %rdx,%rax
+  8058fe:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  805902:	89 c7                	mov    %eax,%edi
+  805904:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80590b:	00 00 00 
+  80590e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805911:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  805915:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805919:	48 83 ec 08          	sub    $0x8,%rsp
+  80591d:	6a 00                	push   $0x0
+  80591f:	6a 00                	push   $0x0
+  805921:	6a 05                	push   $0x5
+  805923:	41 89 f1             	mov    %esi,%r9d
+  805926:	49 89 c8             	mov    %rcx,%r8
+  805929:	89 f9                	mov    %edi,%ecx
+  80592b:	be 08 00 00 00       	mov    $0x8,%esi
+  805930:	89 c7                	mov    %eax,%edi
+  805932:	49 89 df             	mov    %rbx,%r15
+  805935:	48 b8 6f da ff ff ff 	movabs $0xffffffffffffda6f,%rax
+  80593c:	ff ff ff 
+  80593f:	48 01 d8             	add    %rbx,%rax
+  805942:	ff d0                	call   *%rax
+  805944:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805948:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80594c:	5b                   	pop    %rbx
+  80594d:	41 5f                	pop    %r15
+  80594f:	5d                   	pop    %rbp
+  805950:	c3                   	ret
+
+0000000000805951 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  805951:	55                   	push   %rbp
+  805952:	48 89 e5             	mov    %rsp,%rbp
+  805955:	48 83 ec 10          	sub    $0x10,%rsp
+  805959:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805959 <nsipc_socket+0x8>
+  805960:	49 bb e7 36 00 00 00 	movabs $0x36e7,%r11
+  805967:	00 00 00 
+  80596a:	4c 01 d8             	add    %r11,%rax
+  80596d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805970:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  805973:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805976:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80597d:	00 00 00 
+  805980:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805983:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  805986:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80598d:	00 00 00 
+  805990:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  805993:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  805997:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  80599e:	00 00 00 
+  8059a1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8059a4:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8059a8:	bf 09 00 00 00       	mov    $0x9,%edi
+  8059ad:	48 ba 26 c2 ff ff ff 	movabs $0xffffffffffffc226,%rdx
+  8059b4:	ff ff ff 
+  8059b7:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8059bb:	ff d0                	call   *%rax
+}
+  8059bd:	c9                   	leave
+  8059be:	c3                   	ret
+
+00000000008059bf <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8059bf:	55                   	push   %rbp
+  8059c0:	48 89 e5             	mov    %rsp,%rbp
+  8059c3:	41 57                	push   %r15
+  8059c5:	53                   	push   %rbx
+  8059c6:	48 83 ec 30          	sub    $0x30,%rsp
+  8059ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059ca <pipe+0xb>
+  8059d1:	49 bb 76 36 00 00 00 	movabs $0x3676,%r11
+  8059d8:	00 00 00 
+  8059db:	4c 01 db             	add    %r11,%rbx
+  8059de:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8059e2:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8059e6:	48 89 c7             	mov    %rax,%rdi
+  8059e9:	49 89 df             	mov    %rbx,%r15
+  8059ec:	48 b8 40 a6 ff ff ff 	movabs $0xffffffffffffa640,%rax
+  8059f3:	ff ff ff 
+  8059f6:	48 01 d8             	add    %rbx,%rax
+  8059f9:	ff d0                	call   *%rax
+  8059fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a02:	0f 88 12 02 00 00    	js     805c1a <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805a08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a0c:	ba 07 04 00 00       	mov    $0x407,%edx
+  805a11:	48 89 c6             	mov    %rax,%rsi
+  805a14:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a19:	49 89 df             	mov    %rbx,%r15
+  805a1c:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  805a23:	ff ff ff 
+  805a26:	48 01 d8             	add    %rbx,%rax
+  805a29:	ff d0                	call   *%rax
+  805a2b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a2e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a32:	0f 88 e2 01 00 00    	js     805c1a <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805a38:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805a3c:	48 89 c7             	mov    %rax,%rdi
+  805a3f:	49 89 df             	mov    %rbx,%r15
+  805a42:	48 b8 40 a6 ff ff ff 	movabs $0xffffffffffffa640,%rax
+  805a49:	ff ff ff 
+  805a4c:	48 01 d8             	add    %rbx,%rax
+  805a4f:	ff d0                	call   *%rax
+  805a51:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a54:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a58:	0f 88 9b 01 00 00    	js     805bf9 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805a5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a62:	ba 07 04 00 00       	mov    $0x407,%edx
+  805a67:	48 89 c6             	mov    %rax,%rsi
+  805a6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a6f:	49 89 df             	mov    %rbx,%r15
+  805a72:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  805a79:	ff ff ff 
+  805a7c:	48 01 d8             	add    %rbx,%rax
+  805a7f:	ff d0                	call   *%rax
+  805a81:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a84:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a88:	0f 88 6b 01 00 00    	js     805bf9 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  805a8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a92:	48 89 c7             	mov    %rax,%rdi
+  805a95:	49 89 df             	mov    %rbx,%r15
+  805a98:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  805a9f:	ff ff ff 
+  805aa2:	48 01 d8             	add    %rbx,%rax
+  805aa5:	ff d0                	call   *%rax
+  805aa7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805aab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805aaf:	ba 07 04 00 00       	mov    $0x407,%edx
+  805ab4:	48 89 c6             	mov    %rax,%rsi
+  805ab7:	bf 00 00 00 00       	mov    $0x0,%edi
+  805abc:	49 89 df             	mov    %rbx,%r15
+  805abf:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  805ac6:	ff ff ff 
+  805ac9:	48 01 d8             	add    %rbx,%rax
+  805acc:	ff d0                	call   *%rax
+  805ace:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ad1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ad5:	0f 88 fd 00 00 00    	js     805bd8 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805adb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805adf:	48 89 c7             	mov    %rax,%rdi
+  805ae2:	49 89 df             	mov    %rbx,%r15
+  805ae5:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  805aec:	ff ff ff 
+  805aef:	48 01 d8             	add    %rbx,%rax
+  805af2:	ff d0                	call   *%rax
+  805af4:	48 89 c2             	mov    %rax,%rdx
+  805af7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805afb:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805b01:	48 89 d1             	mov    %rdx,%rcx
+  805b04:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b09:	48 89 c6             	mov    %rax,%rsi
+  805b0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b11:	49 89 df             	mov    %rbx,%r15
+  805b14:	48 b8 f6 92 ff ff ff 	movabs $0xffffffffffff92f6,%rax
+  805b1b:	ff ff ff 
+  805b1e:	48 01 d8             	add    %rbx,%rax
+  805b21:	ff d0                	call   *%rax
+  805b23:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b26:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b2a:	0f 88 87 00 00 00    	js     805bb7 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805b30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b34:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805b3b:	00 00 00 
+  805b3e:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805b41:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805b43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b47:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805b4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b52:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805b59:	00 00 00 
+  805b5c:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805b5f:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805b61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b65:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805b6c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b70:	48 89 c7             	mov    %rax,%rdi
+  805b73:	49 89 df             	mov    %rbx,%r15
+  805b76:	48 b8 c6 a5 ff ff ff 	movabs $0xffffffffffffa5c6,%rax
+  805b7d:	ff ff ff 
+  805b80:	48 01 d8             	add    %rbx,%rax
+  805b83:	ff d0                	call   *%rax
+  805b85:	89 c2                	mov    %eax,%edx
+  805b87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b8b:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805b8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b91:	48 89 c7             	mov    %rax,%rdi
+  805b94:	49 89 df             	mov    %rbx,%r15
+  805b97:	48 b8 c6 a5 ff ff ff 	movabs $0xffffffffffffa5c6,%rax
+  805b9e:	ff ff ff 
+  805ba1:	48 01 d8             	add    %rbx,%rax
+  805ba4:	ff d0                	call   *%rax
+  805ba6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805baa:	48 83 c2 04          	add    $0x4,%rdx
+  805bae:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bb5:	eb 67                	jmp    805c1e <pipe+0x25f>
+		goto err3;
+  805bb7:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805bb8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bbc:	48 89 c6             	mov    %rax,%rsi
+  805bbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bc4:	49 89 df             	mov    %rbx,%r15
+  805bc7:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  805bce:	ff ff ff 
+  805bd1:	48 01 d8             	add    %rbx,%rax
+  805bd4:	ff d0                	call   *%rax
+  805bd6:	eb 01                	jmp    805bd9 <pipe+0x21a>
+		goto err2;
+  805bd8:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805bd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bdd:	48 89 c6             	mov    %rax,%rsi
+  805be0:	bf 00 00 00 00       	mov    $0x0,%edi
+  805be5:	49 89 df             	mov    %rbx,%r15
+  805be8:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  805bef:	ff ff ff 
+  805bf2:	48 01 d8             	add    %rbx,%rax
+  805bf5:	ff d0                	call   *%rax
+  805bf7:	eb 01                	jmp    805bfa <pipe+0x23b>
+		goto err1;
+  805bf9:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805bfa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805bfe:	48 89 c6             	mov    %rax,%rsi
+  805c01:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c06:	49 89 df             	mov    %rbx,%r15
+  805c09:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  805c10:	ff ff ff 
+  805c13:	48 01 d8             	add    %rbx,%rax
+  805c16:	ff d0                	call   *%rax
+  805c18:	eb 01                	jmp    805c1b <pipe+0x25c>
+		goto err;
+  805c1a:	90                   	nop
+err:
+	return r;
+  805c1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805c1e:	48 83 c4 30          	add    $0x30,%rsp
+  805c22:	5b                   	pop    %rbx
+  805c23:	41 5f                	pop    %r15
+  805c25:	5d                   	pop    %rbp
+  805c26:	c3                   	ret
+
+0000000000805c27 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805c27:	55                   	push   %rbp
+  805c28:	48 89 e5             	mov    %rsp,%rbp
+  805c2b:	41 57                	push   %r15
+  805c2d:	41 54                	push   %r12
+  805c2f:	53                   	push   %rbx
+  805c30:	48 83 ec 28          	sub    $0x28,%rsp
+  805c34:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c34 <_pipeisclosed+0xd>
+  805c3b:	49 bb 0c 34 00 00 00 	movabs $0x340c,%r11
+  805c42:	00 00 00 
+  805c45:	4c 01 db             	add    %r11,%rbx
+  805c48:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805c4c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805c50:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805c57:	ff ff ff 
+  805c5a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c5e:	48 8b 00             	mov    (%rax),%rax
+  805c61:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805c67:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805c6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c6e:	48 89 c7             	mov    %rax,%rdi
+  805c71:	49 89 df             	mov    %rbx,%r15
+  805c74:	48 b8 f6 de ff ff ff 	movabs $0xffffffffffffdef6,%rax
+  805c7b:	ff ff ff 
+  805c7e:	48 01 d8             	add    %rbx,%rax
+  805c81:	ff d0                	call   *%rax
+  805c83:	41 89 c4             	mov    %eax,%r12d
+  805c86:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805c8a:	48 89 c7             	mov    %rax,%rdi
+  805c8d:	49 89 df             	mov    %rbx,%r15
+  805c90:	48 b8 f6 de ff ff ff 	movabs $0xffffffffffffdef6,%rax
+  805c97:	ff ff ff 
+  805c9a:	48 01 d8             	add    %rbx,%rax
+  805c9d:	ff d0                	call   *%rax
+  805c9f:	41 39 c4             	cmp    %eax,%r12d
+  805ca2:	0f 94 c0             	sete   %al
+  805ca5:	0f b6 c0             	movzbl %al,%eax
+  805ca8:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805cab:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805cb2:	ff ff ff 
+  805cb5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805cb9:	48 8b 00             	mov    (%rax),%rax
+  805cbc:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805cc2:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805cc5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805cc8:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805ccb:	75 05                	jne    805cd2 <_pipeisclosed+0xab>
+			return ret;
+  805ccd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805cd0:	eb 63                	jmp    805d35 <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805cd2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805cd5:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805cd8:	0f 84 72 ff ff ff    	je     805c50 <_pipeisclosed+0x29>
+  805cde:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805ce2:	0f 85 68 ff ff ff    	jne    805c50 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805ce8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805cef:	ff ff ff 
+  805cf2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805cf6:	48 8b 00             	mov    (%rax),%rax
+  805cf9:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805cff:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805d02:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805d05:	89 c6                	mov    %eax,%esi
+  805d07:	48 b8 7e e7 ff ff ff 	movabs $0xffffffffffffe77e,%rax
+  805d0e:	ff ff ff 
+  805d11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d15:	48 89 c7             	mov    %rax,%rdi
+  805d18:	49 89 df             	mov    %rbx,%r15
+  805d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d20:	49 b8 13 78 ff ff ff 	movabs $0xffffffffffff7813,%r8
+  805d27:	ff ff ff 
+  805d2a:	49 01 d8             	add    %rbx,%r8
+  805d2d:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805d30:	e9 1b ff ff ff       	jmp    805c50 <_pipeisclosed+0x29>
+	}
+}
+  805d35:	48 83 c4 28          	add    $0x28,%rsp
+  805d39:	5b                   	pop    %rbx
+  805d3a:	41 5c                	pop    %r12
+  805d3c:	41 5f                	pop    %r15
+  805d3e:	5d                   	pop    %rbp
+  805d3f:	c3                   	ret
+
+0000000000805d40 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805d40:	55                   	push   %rbp
+  805d41:	48 89 e5             	mov    %rsp,%rbp
+  805d44:	41 57                	push   %r15
+  805d46:	53                   	push   %rbx
+  805d47:	48 83 ec 30          	sub    $0x30,%rsp
+  805d4b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d4b <pipeisclosed+0xb>
+  805d52:	49 bb f5 32 00 00 00 	movabs $0x32f5,%r11
+  805d59:	00 00 00 
+  805d5c:	4c 01 db             	add    %r11,%rbx
+  805d5f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805d62:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805d66:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805d69:	48 89 d6             	mov    %rdx,%rsi
+  805d6c:	89 c7                	mov    %eax,%edi
+  805d6e:	49 89 df             	mov    %rbx,%r15
+  805d71:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  805d78:	ff ff ff 
+  805d7b:	48 01 d8             	add    %rbx,%rax
+  805d7e:	ff d0                	call   *%rax
+  805d80:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d83:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d87:	79 05                	jns    805d8e <pipeisclosed+0x4e>
+		return r;
+  805d89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d8c:	eb 3b                	jmp    805dc9 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805d8e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d92:	48 89 c7             	mov    %rax,%rdi
+  805d95:	49 89 df             	mov    %rbx,%r15
+  805d98:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  805d9f:	ff ff ff 
+  805da2:	48 01 d8             	add    %rbx,%rax
+  805da5:	ff d0                	call   *%rax
+  805da7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805dab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805daf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805db3:	48 89 d6             	mov    %rdx,%rsi
+  805db6:	48 89 c7             	mov    %rax,%rdi
+  805db9:	48 b8 e7 cb ff ff ff 	movabs $0xffffffffffffcbe7,%rax
+  805dc0:	ff ff ff 
+  805dc3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dc7:	ff d0                	call   *%rax
+}
+  805dc9:	48 83 c4 30          	add    $0x30,%rsp
+  805dcd:	5b                   	pop    %rbx
+  805dce:	41 5f                	pop    %r15
+  805dd0:	5d                   	pop    %rbp
+  805dd1:	c3                   	ret
+
+0000000000805dd2 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805dd2:	55                   	push   %rbp
+  805dd3:	48 89 e5             	mov    %rsp,%rbp
+  805dd6:	41 57                	push   %r15
+  805dd8:	53                   	push   %rbx
+  805dd9:	48 83 ec 40          	sub    $0x40,%rsp
+  805ddd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ddd <devpipe_read+0xb>
+  805de4:	49 bb 63 32 00 00 00 	movabs $0x3263,%r11
+  805deb:	00 00 00 
+  805dee:	4c 01 db             	add    %r11,%rbx
+  805df1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805df5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805df9:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805dfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e01:	48 89 c7             	mov    %rax,%rdi
+  805e04:	49 89 df             	mov    %rbx,%r15
+  805e07:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  805e0e:	ff ff ff 
+  805e11:	48 01 d8             	add    %rbx,%rax
+  805e14:	ff d0                	call   *%rax
+  805e16:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805e1a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805e1e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805e22:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805e29:	00 
+  805e2a:	e9 a1 00 00 00       	jmp    805ed0 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805e2f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805e34:	74 09                	je     805e3f <devpipe_read+0x6d>
+				return i;
+  805e36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e3a:	e9 9f 00 00 00       	jmp    805ede <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805e3f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e47:	48 89 d6             	mov    %rdx,%rsi
+  805e4a:	48 89 c7             	mov    %rax,%rdi
+  805e4d:	48 b8 e7 cb ff ff ff 	movabs $0xffffffffffffcbe7,%rax
+  805e54:	ff ff ff 
+  805e57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e5b:	ff d0                	call   *%rax
+  805e5d:	85 c0                	test   %eax,%eax
+  805e5f:	74 07                	je     805e68 <devpipe_read+0x96>
+				return 0;
+  805e61:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e66:	eb 76                	jmp    805ede <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805e68:	49 89 df             	mov    %rbx,%r15
+  805e6b:	48 b8 3c 92 ff ff ff 	movabs $0xffffffffffff923c,%rax
+  805e72:	ff ff ff 
+  805e75:	48 01 d8             	add    %rbx,%rax
+  805e78:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805e7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e7e:	8b 10                	mov    (%rax),%edx
+  805e80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e84:	8b 40 04             	mov    0x4(%rax),%eax
+  805e87:	39 c2                	cmp    %eax,%edx
+  805e89:	74 a4                	je     805e2f <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805e8b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e8f:	8b 10                	mov    (%rax),%edx
+  805e91:	89 d0                	mov    %edx,%eax
+  805e93:	c1 f8 1f             	sar    $0x1f,%eax
+  805e96:	c1 e8 1b             	shr    $0x1b,%eax
+  805e99:	01 c2                	add    %eax,%edx
+  805e9b:	83 e2 1f             	and    $0x1f,%edx
+  805e9e:	29 c2                	sub    %eax,%edx
+  805ea0:	89 d6                	mov    %edx,%esi
+  805ea2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805ea6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805eaa:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805eae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805eb2:	48 63 c6             	movslq %esi,%rax
+  805eb5:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805eba:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805ebc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ec0:	8b 00                	mov    (%rax),%eax
+  805ec2:	8d 50 01             	lea    0x1(%rax),%edx
+  805ec5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ec9:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805ecb:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805ed0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ed4:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805ed8:	72 a0                	jb     805e7a <devpipe_read+0xa8>
+	}
+	return i;
+  805eda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805ede:	48 83 c4 40          	add    $0x40,%rsp
+  805ee2:	5b                   	pop    %rbx
+  805ee3:	41 5f                	pop    %r15
+  805ee5:	5d                   	pop    %rbp
+  805ee6:	c3                   	ret
+
+0000000000805ee7 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805ee7:	55                   	push   %rbp
+  805ee8:	48 89 e5             	mov    %rsp,%rbp
+  805eeb:	41 57                	push   %r15
+  805eed:	53                   	push   %rbx
+  805eee:	48 83 ec 40          	sub    $0x40,%rsp
+  805ef2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ef2 <devpipe_write+0xb>
+  805ef9:	49 bb 4e 31 00 00 00 	movabs $0x314e,%r11
+  805f00:	00 00 00 
+  805f03:	4c 01 db             	add    %r11,%rbx
+  805f06:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805f0a:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805f0e:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805f12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805f16:	48 89 c7             	mov    %rax,%rdi
+  805f19:	49 89 df             	mov    %rbx,%r15
+  805f1c:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  805f23:	ff ff ff 
+  805f26:	48 01 d8             	add    %rbx,%rax
+  805f29:	ff d0                	call   *%rax
+  805f2b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805f2f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805f33:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805f37:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805f3e:	00 
+  805f3f:	e9 a0 00 00 00       	jmp    805fe4 <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805f44:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805f48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805f4c:	48 89 d6             	mov    %rdx,%rsi
+  805f4f:	48 89 c7             	mov    %rax,%rdi
+  805f52:	48 b8 e7 cb ff ff ff 	movabs $0xffffffffffffcbe7,%rax
+  805f59:	ff ff ff 
+  805f5c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f60:	ff d0                	call   *%rax
+  805f62:	85 c0                	test   %eax,%eax
+  805f64:	74 0a                	je     805f70 <devpipe_write+0x89>
+				return 0;
+  805f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f6b:	e9 82 00 00 00       	jmp    805ff2 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805f70:	49 89 df             	mov    %rbx,%r15
+  805f73:	48 b8 3c 92 ff ff ff 	movabs $0xffffffffffff923c,%rax
+  805f7a:	ff ff ff 
+  805f7d:	48 01 d8             	add    %rbx,%rax
+  805f80:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805f82:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f86:	8b 40 04             	mov    0x4(%rax),%eax
+  805f89:	48 63 d0             	movslq %eax,%rdx
+  805f8c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805f90:	8b 00                	mov    (%rax),%eax
+  805f92:	48 98                	cltq
+  805f94:	48 83 c0 20          	add    $0x20,%rax
+  805f98:	48 39 c2             	cmp    %rax,%rdx
+  805f9b:	73 a7                	jae    805f44 <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805f9d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805fa1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fa5:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805fa9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805fad:	8b 50 04             	mov    0x4(%rax),%edx
+  805fb0:	89 d0                	mov    %edx,%eax
+  805fb2:	c1 f8 1f             	sar    $0x1f,%eax
+  805fb5:	c1 e8 1b             	shr    $0x1b,%eax
+  805fb8:	01 c2                	add    %eax,%edx
+  805fba:	83 e2 1f             	and    $0x1f,%edx
+  805fbd:	29 c2                	sub    %eax,%edx
+  805fbf:	89 d0                	mov    %edx,%eax
+  805fc1:	0f b6 09             	movzbl (%rcx),%ecx
+  805fc4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805fc8:	48 98                	cltq
+  805fca:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805fce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805fd2:	8b 40 04             	mov    0x4(%rax),%eax
+  805fd5:	8d 50 01             	lea    0x1(%rax),%edx
+  805fd8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805fdc:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805fdf:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805fe4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fe8:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805fec:	72 94                	jb     805f82 <devpipe_write+0x9b>
+	}
+
+	return i;
+  805fee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805ff2:	48 83 c4 40          	add    $0x40,%rsp
+  805ff6:	5b                   	pop    %rbx
+  805ff7:	41 5f                	pop    %r15
+  805ff9:	5d                   	pop    %rbp
+  805ffa:	c3                   	ret
+
+0000000000805ffb <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805ffb:	55                   	push   %rbp
+  805ffc:	48 89 e5             	mov    %rsp,%rbp
+  805fff:	41 57                	push   %r15
+  806001:	53                   	push   %rbx
+  806002:	48 83 ec 20          	sub    $0x20,%rsp
+  806006:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806006 <devpipe_stat+0xb>
+  80600d:	49 bb 3a 30 00 00 00 	movabs $0x303a,%r11
+  806014:	00 00 00 
+  806017:	4c 01 db             	add    %r11,%rbx
+  80601a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80601e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  806022:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806026:	48 89 c7             	mov    %rax,%rdi
+  806029:	49 89 df             	mov    %rbx,%r15
+  80602c:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  806033:	ff ff ff 
+  806036:	48 01 d8             	add    %rbx,%rax
+  806039:	ff d0                	call   *%rax
+  80603b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  80603f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806043:	48 ba 91 e7 ff ff ff 	movabs $0xffffffffffffe791,%rdx
+  80604a:	ff ff ff 
+  80604d:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806051:	48 89 d6             	mov    %rdx,%rsi
+  806054:	48 89 c7             	mov    %rax,%rdi
+  806057:	49 89 df             	mov    %rbx,%r15
+  80605a:	48 b8 d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rax
+  806061:	ff ff ff 
+  806064:	48 01 d8             	add    %rbx,%rax
+  806067:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  806069:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80606d:	8b 50 04             	mov    0x4(%rax),%edx
+  806070:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806074:	8b 00                	mov    (%rax),%eax
+  806076:	29 c2                	sub    %eax,%edx
+  806078:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80607c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  806082:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806086:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80608d:	00 00 00 
+	stat->st_dev = &devpipe;
+  806090:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806094:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  80609b:	00 00 00 
+  80609e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8060a2:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8060a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8060ae:	48 83 c4 20          	add    $0x20,%rsp
+  8060b2:	5b                   	pop    %rbx
+  8060b3:	41 5f                	pop    %r15
+  8060b5:	5d                   	pop    %rbp
+  8060b6:	c3                   	ret
+
+00000000008060b7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8060b7:	55                   	push   %rbp
+  8060b8:	48 89 e5             	mov    %rsp,%rbp
+  8060bb:	41 57                	push   %r15
+  8060bd:	53                   	push   %rbx
+  8060be:	48 83 ec 10          	sub    $0x10,%rsp
+  8060c2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8060c2 <devpipe_close+0xb>
+  8060c9:	49 bb 7e 2f 00 00 00 	movabs $0x2f7e,%r11
+  8060d0:	00 00 00 
+  8060d3:	4c 01 db             	add    %r11,%rbx
+  8060d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8060da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060de:	48 89 c6             	mov    %rax,%rsi
+  8060e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060e6:	49 89 df             	mov    %rbx,%r15
+  8060e9:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  8060f0:	ff ff ff 
+  8060f3:	48 01 d8             	add    %rbx,%rax
+  8060f6:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8060f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060fc:	48 89 c7             	mov    %rax,%rdi
+  8060ff:	49 89 df             	mov    %rbx,%r15
+  806102:	48 b8 fd a5 ff ff ff 	movabs $0xffffffffffffa5fd,%rax
+  806109:	ff ff ff 
+  80610c:	48 01 d8             	add    %rbx,%rax
+  80610f:	ff d0                	call   *%rax
+  806111:	48 89 c6             	mov    %rax,%rsi
+  806114:	bf 00 00 00 00       	mov    $0x0,%edi
+  806119:	49 89 df             	mov    %rbx,%r15
+  80611c:	48 b8 69 93 ff ff ff 	movabs $0xffffffffffff9369,%rax
+  806123:	ff ff ff 
+  806126:	48 01 d8             	add    %rbx,%rax
+  806129:	ff d0                	call   *%rax
+}
+  80612b:	48 83 c4 10          	add    $0x10,%rsp
+  80612f:	5b                   	pop    %rbx
+  806130:	41 5f                	pop    %r15
+  806132:	5d                   	pop    %rbp
+  806133:	c3                   	ret
+
+0000000000806134 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  806134:	55                   	push   %rbp
+  806135:	48 89 e5             	mov    %rsp,%rbp
+  806138:	41 57                	push   %r15
+  80613a:	53                   	push   %rbx
+  80613b:	48 83 ec 20          	sub    $0x20,%rsp
+  80613f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80613f <wait+0xb>
+  806146:	49 bb 01 2f 00 00 00 	movabs $0x2f01,%r11
+  80614d:	00 00 00 
+  806150:	4c 01 db             	add    %r11,%rbx
+  806153:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  806156:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80615a:	75 50                	jne    8061ac <wait+0x78>
+  80615c:	48 b8 98 e7 ff ff ff 	movabs $0xffffffffffffe798,%rax
+  806163:	ff ff ff 
+  806166:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80616a:	48 89 c1             	mov    %rax,%rcx
+  80616d:	48 b8 a3 e7 ff ff ff 	movabs $0xffffffffffffe7a3,%rax
+  806174:	ff ff ff 
+  806177:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80617b:	48 89 c2             	mov    %rax,%rdx
+  80617e:	be 09 00 00 00       	mov    $0x9,%esi
+  806183:	48 b8 b8 e7 ff ff ff 	movabs $0xffffffffffffe7b8,%rax
+  80618a:	ff ff ff 
+  80618d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806191:	48 89 c7             	mov    %rax,%rdi
+  806194:	49 89 df             	mov    %rbx,%r15
+  806197:	b8 00 00 00 00       	mov    $0x0,%eax
+  80619c:	49 b8 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%r8
+  8061a3:	ff ff ff 
+  8061a6:	49 01 d8             	add    %rbx,%r8
+  8061a9:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  8061ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8061af:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8061b4:	48 98                	cltq
+  8061b6:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8061bd:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8061c4:	ff ff ff 
+  8061c7:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8061cb:	48 01 d0             	add    %rdx,%rax
+  8061ce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8061d2:	eb 12                	jmp    8061e6 <wait+0xb2>
+		sys_yield();
+  8061d4:	49 89 df             	mov    %rbx,%r15
+  8061d7:	48 b8 3c 92 ff ff ff 	movabs $0xffffffffffff923c,%rax
+  8061de:	ff ff ff 
+  8061e1:	48 01 d8             	add    %rbx,%rax
+  8061e4:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8061e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061ea:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8061f0:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8061f3:	75 0e                	jne    806203 <wait+0xcf>
+  8061f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061f9:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8061ff:	85 c0                	test   %eax,%eax
+  806201:	75 d1                	jne    8061d4 <wait+0xa0>
+}
+  806203:	90                   	nop
+  806204:	48 83 c4 20          	add    $0x20,%rsp
+  806208:	5b                   	pop    %rbx
+  806209:	41 5f                	pop    %r15
+  80620b:	5d                   	pop    %rbp
+  80620c:	c3                   	ret
+
+000000000080620d <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80620d:	55                   	push   %rbp
+  80620e:	48 89 e5             	mov    %rsp,%rbp
+  806211:	41 57                	push   %r15
+  806213:	48 83 ec 28          	sub    $0x28,%rsp
+  806217:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806217 <cputchar+0xa>
+  80621e:	49 bb 29 2e 00 00 00 	movabs $0x2e29,%r11
+  806225:	00 00 00 
+  806228:	4c 01 d8             	add    %r11,%rax
+  80622b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80622e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806231:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806234:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806238:	be 01 00 00 00       	mov    $0x1,%esi
+  80623d:	48 89 d7             	mov    %rdx,%rdi
+  806240:	49 89 c7             	mov    %rax,%r15
+  806243:	48 ba d9 90 ff ff ff 	movabs $0xffffffffffff90d9,%rdx
+  80624a:	ff ff ff 
+  80624d:	48 01 c2             	add    %rax,%rdx
+  806250:	ff d2                	call   *%rdx
+}
+  806252:	90                   	nop
+  806253:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806257:	c9                   	leave
+  806258:	c3                   	ret
+
+0000000000806259 <getchar>:
+
+int
+getchar(void)
+{
+  806259:	55                   	push   %rbp
+  80625a:	48 89 e5             	mov    %rsp,%rbp
+  80625d:	41 57                	push   %r15
+  80625f:	48 83 ec 18          	sub    $0x18,%rsp
+  806263:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806263 <getchar+0xa>
+  80626a:	49 bb dd 2d 00 00 00 	movabs $0x2ddd,%r11
+  806271:	00 00 00 
+  806274:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806277:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80627b:	ba 01 00 00 00       	mov    $0x1,%edx
+  806280:	48 89 ce             	mov    %rcx,%rsi
+  806283:	bf 00 00 00 00       	mov    $0x0,%edi
+  806288:	49 89 c7             	mov    %rax,%r15
+  80628b:	48 b9 3d ac ff ff ff 	movabs $0xffffffffffffac3d,%rcx
+  806292:	ff ff ff 
+  806295:	48 01 c1             	add    %rax,%rcx
+  806298:	ff d1                	call   *%rcx
+  80629a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80629d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062a1:	79 05                	jns    8062a8 <getchar+0x4f>
+		return r;
+  8062a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062a6:	eb 14                	jmp    8062bc <getchar+0x63>
+	if (r < 1)
+  8062a8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062ac:	7f 07                	jg     8062b5 <getchar+0x5c>
+		return -E_EOF;
+  8062ae:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8062b3:	eb 07                	jmp    8062bc <getchar+0x63>
+	return c;
+  8062b5:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8062b9:	0f b6 c0             	movzbl %al,%eax
+}
+  8062bc:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8062c0:	c9                   	leave
+  8062c1:	c3                   	ret
+
+00000000008062c2 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8062c2:	55                   	push   %rbp
+  8062c3:	48 89 e5             	mov    %rsp,%rbp
+  8062c6:	41 57                	push   %r15
+  8062c8:	53                   	push   %rbx
+  8062c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8062cd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8062cd <iscons+0xb>
+  8062d4:	49 bb 73 2d 00 00 00 	movabs $0x2d73,%r11
+  8062db:	00 00 00 
+  8062de:	4c 01 db             	add    %r11,%rbx
+  8062e1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8062e4:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8062e8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8062eb:	48 89 d6             	mov    %rdx,%rsi
+  8062ee:	89 c7                	mov    %eax,%edi
+  8062f0:	49 89 df             	mov    %rbx,%r15
+  8062f3:	48 b8 f6 a6 ff ff ff 	movabs $0xffffffffffffa6f6,%rax
+  8062fa:	ff ff ff 
+  8062fd:	48 01 d8             	add    %rbx,%rax
+  806300:	ff d0                	call   *%rax
+  806302:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806305:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806309:	79 05                	jns    806310 <iscons+0x4e>
+		return r;
+  80630b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80630e:	eb 1b                	jmp    80632b <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  806310:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806314:	8b 10                	mov    (%rax),%edx
+  806316:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  80631d:	00 00 00 
+  806320:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806323:	39 c2                	cmp    %eax,%edx
+  806325:	0f 94 c0             	sete   %al
+  806328:	0f b6 c0             	movzbl %al,%eax
+}
+  80632b:	48 83 c4 20          	add    $0x20,%rsp
+  80632f:	5b                   	pop    %rbx
+  806330:	41 5f                	pop    %r15
+  806332:	5d                   	pop    %rbp
+  806333:	c3                   	ret
+
+0000000000806334 <opencons>:
+
+int
+opencons(void)
+{
+  806334:	55                   	push   %rbp
+  806335:	48 89 e5             	mov    %rsp,%rbp
+  806338:	41 57                	push   %r15
+  80633a:	53                   	push   %rbx
+  80633b:	48 83 ec 10          	sub    $0x10,%rsp
+  80633f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80633f <opencons+0xb>
+  806346:	49 bb 01 2d 00 00 00 	movabs $0x2d01,%r11
+  80634d:	00 00 00 
+  806350:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806353:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806357:	48 89 c7             	mov    %rax,%rdi
+  80635a:	49 89 df             	mov    %rbx,%r15
+  80635d:	48 b8 40 a6 ff ff ff 	movabs $0xffffffffffffa640,%rax
+  806364:	ff ff ff 
+  806367:	48 01 d8             	add    %rbx,%rax
+  80636a:	ff d0                	call   *%rax
+  80636c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80636f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806373:	79 05                	jns    80637a <opencons+0x46>
+		return r;
+  806375:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806378:	eb 68                	jmp    8063e2 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80637a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80637e:	ba 07 04 00 00       	mov    $0x407,%edx
+  806383:	48 89 c6             	mov    %rax,%rsi
+  806386:	bf 00 00 00 00       	mov    $0x0,%edi
+  80638b:	49 89 df             	mov    %rbx,%r15
+  80638e:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  806395:	ff ff ff 
+  806398:	48 01 d8             	add    %rbx,%rax
+  80639b:	ff d0                	call   *%rax
+  80639d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8063a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8063a4:	79 05                	jns    8063ab <opencons+0x77>
+		return r;
+  8063a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063a9:	eb 37                	jmp    8063e2 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8063ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063af:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  8063b6:	00 00 00 
+  8063b9:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8063bc:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8063be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063c2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8063c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063cd:	48 89 c7             	mov    %rax,%rdi
+  8063d0:	49 89 df             	mov    %rbx,%r15
+  8063d3:	48 b8 c6 a5 ff ff ff 	movabs $0xffffffffffffa5c6,%rax
+  8063da:	ff ff ff 
+  8063dd:	48 01 d8             	add    %rbx,%rax
+  8063e0:	ff d0                	call   *%rax
+}
+  8063e2:	48 83 c4 10          	add    $0x10,%rsp
+  8063e6:	5b                   	pop    %rbx
+  8063e7:	41 5f                	pop    %r15
+  8063e9:	5d                   	pop    %rbp
+  8063ea:	c3                   	ret
+
+00000000008063eb <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8063eb:	55                   	push   %rbp
+  8063ec:	48 89 e5             	mov    %rsp,%rbp
+  8063ef:	41 57                	push   %r15
+  8063f1:	53                   	push   %rbx
+  8063f2:	48 83 ec 30          	sub    $0x30,%rsp
+  8063f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063f6 <devcons_read+0xb>
+  8063fd:	49 bb 4a 2c 00 00 00 	movabs $0x2c4a,%r11
+  806404:	00 00 00 
+  806407:	4c 01 db             	add    %r11,%rbx
+  80640a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80640e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806412:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806416:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80641b:	75 19                	jne    806436 <devcons_read+0x4b>
+		return 0;
+  80641d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806422:	eb 55                	jmp    806479 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806424:	49 89 df             	mov    %rbx,%r15
+  806427:	48 b8 3c 92 ff ff ff 	movabs $0xffffffffffff923c,%rax
+  80642e:	ff ff ff 
+  806431:	48 01 d8             	add    %rbx,%rax
+  806434:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806436:	49 89 df             	mov    %rbx,%r15
+  806439:	48 b8 38 91 ff ff ff 	movabs $0xffffffffffff9138,%rax
+  806440:	ff ff ff 
+  806443:	48 01 d8             	add    %rbx,%rax
+  806446:	ff d0                	call   *%rax
+  806448:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80644b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80644f:	74 d3                	je     806424 <devcons_read+0x39>
+	if (c < 0)
+  806451:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806455:	79 05                	jns    80645c <devcons_read+0x71>
+		return c;
+  806457:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80645a:	eb 1d                	jmp    806479 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  80645c:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806460:	75 07                	jne    806469 <devcons_read+0x7e>
+		return 0;
+  806462:	b8 00 00 00 00       	mov    $0x0,%eax
+  806467:	eb 10                	jmp    806479 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806469:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80646c:	89 c2                	mov    %eax,%edx
+  80646e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806472:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806474:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806479:	48 83 c4 30          	add    $0x30,%rsp
+  80647d:	5b                   	pop    %rbx
+  80647e:	41 5f                	pop    %r15
+  806480:	5d                   	pop    %rbp
+  806481:	c3                   	ret
+
+0000000000806482 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806482:	55                   	push   %rbp
+  806483:	48 89 e5             	mov    %rsp,%rbp
+  806486:	41 57                	push   %r15
+  806488:	53                   	push   %rbx
+  806489:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806490:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806490 <devcons_write+0xe>
+  806497:	49 bb b0 2b 00 00 00 	movabs $0x2bb0,%r11
+  80649e:	00 00 00 
+  8064a1:	4c 01 db             	add    %r11,%rbx
+  8064a4:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8064ab:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8064b2:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8064b9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8064c0:	e9 80 00 00 00       	jmp    806545 <devcons_write+0xc3>
+		m = n - tot;
+  8064c5:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8064cc:	89 c2                	mov    %eax,%edx
+  8064ce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064d1:	29 c2                	sub    %eax,%edx
+  8064d3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8064d6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8064d9:	83 f8 7f             	cmp    $0x7f,%eax
+  8064dc:	76 07                	jbe    8064e5 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8064de:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8064e5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8064e8:	48 63 d0             	movslq %eax,%rdx
+  8064eb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064ee:	48 63 c8             	movslq %eax,%rcx
+  8064f1:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8064f8:	48 01 c1             	add    %rax,%rcx
+  8064fb:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806502:	48 89 ce             	mov    %rcx,%rsi
+  806505:	48 89 c7             	mov    %rax,%rdi
+  806508:	49 89 df             	mov    %rbx,%r15
+  80650b:	48 b8 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rax
+  806512:	ff ff ff 
+  806515:	48 01 d8             	add    %rbx,%rax
+  806518:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  80651a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80651d:	48 63 d0             	movslq %eax,%rdx
+  806520:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806527:	48 89 d6             	mov    %rdx,%rsi
+  80652a:	48 89 c7             	mov    %rax,%rdi
+  80652d:	49 89 df             	mov    %rbx,%r15
+  806530:	48 b8 d9 90 ff ff ff 	movabs $0xffffffffffff90d9,%rax
+  806537:	ff ff ff 
+  80653a:	48 01 d8             	add    %rbx,%rax
+  80653d:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80653f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806542:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806545:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806548:	48 98                	cltq
+  80654a:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806551:	0f 82 6e ff ff ff    	jb     8064c5 <devcons_write+0x43>
+	}
+	return tot;
+  806557:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80655a:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806561:	5b                   	pop    %rbx
+  806562:	41 5f                	pop    %r15
+  806564:	5d                   	pop    %rbp
+  806565:	c3                   	ret
+
+0000000000806566 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806566:	55                   	push   %rbp
+  806567:	48 89 e5             	mov    %rsp,%rbp
+  80656a:	48 83 ec 08          	sub    $0x8,%rsp
+  80656e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80656e <devcons_close+0x8>
+  806575:	49 bb d2 2a 00 00 00 	movabs $0x2ad2,%r11
+  80657c:	00 00 00 
+  80657f:	4c 01 d8             	add    %r11,%rax
+  806582:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806586:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80658b:	c9                   	leave
+  80658c:	c3                   	ret
+
+000000000080658d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80658d:	55                   	push   %rbp
+  80658e:	48 89 e5             	mov    %rsp,%rbp
+  806591:	41 57                	push   %r15
+  806593:	48 83 ec 18          	sub    $0x18,%rsp
+  806597:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806597 <devcons_stat+0xa>
+  80659e:	49 bb a9 2a 00 00 00 	movabs $0x2aa9,%r11
+  8065a5:	00 00 00 
+  8065a8:	4c 01 d8             	add    %r11,%rax
+  8065ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8065af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8065b3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8065b7:	48 b9 c8 e7 ff ff ff 	movabs $0xffffffffffffe7c8,%rcx
+  8065be:	ff ff ff 
+  8065c1:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8065c5:	48 89 ce             	mov    %rcx,%rsi
+  8065c8:	48 89 d7             	mov    %rdx,%rdi
+  8065cb:	49 89 c7             	mov    %rax,%r15
+  8065ce:	48 ba d5 85 ff ff ff 	movabs $0xffffffffffff85d5,%rdx
+  8065d5:	ff ff ff 
+  8065d8:	48 01 c2             	add    %rax,%rdx
+  8065db:	ff d2                	call   *%rdx
+	return 0;
+  8065dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8065e2:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8065e6:	c9                   	leave
+  8065e7:	c3                   	ret
+
+00000000008065e8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8065e8:	55                   	push   %rbp
+  8065e9:	48 89 e5             	mov    %rsp,%rbp
+  8065ec:	41 57                	push   %r15
+  8065ee:	53                   	push   %rbx
+  8065ef:	48 83 ec 20          	sub    $0x20,%rsp
+  8065f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065f3 <set_pgfault_handler+0xb>
+  8065fa:	49 bb 4d 2a 00 00 00 	movabs $0x2a4d,%r11
+  806601:	00 00 00 
+  806604:	4c 01 db             	add    %r11,%rbx
+  806607:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  80660b:	49 89 df             	mov    %rbx,%r15
+  80660e:	48 b8 e8 91 ff ff ff 	movabs $0xffffffffffff91e8,%rax
+  806615:	ff ff ff 
+  806618:	48 01 d8             	add    %rbx,%rax
+  80661b:	ff d0                	call   *%rax
+  80661d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806620:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806627:	00 00 00 
+  80662a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80662e:	48 85 c0             	test   %rax,%rax
+  806631:	75 6b                	jne    80669e <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806633:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806636:	ba 07 00 00 00       	mov    $0x7,%edx
+  80663b:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806640:	48 89 ce             	mov    %rcx,%rsi
+  806643:	89 c7                	mov    %eax,%edi
+  806645:	49 89 df             	mov    %rbx,%r15
+  806648:	48 b8 91 92 ff ff ff 	movabs $0xffffffffffff9291,%rax
+  80664f:	ff ff ff 
+  806652:	48 01 d8             	add    %rbx,%rax
+  806655:	ff d0                	call   *%rax
+  806657:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  80665a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80665e:	74 3e                	je     80669e <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806660:	48 b8 d0 e7 ff ff ff 	movabs $0xffffffffffffe7d0,%rax
+  806667:	ff ff ff 
+  80666a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80666e:	48 89 c2             	mov    %rax,%rdx
+  806671:	be 23 00 00 00       	mov    $0x23,%esi
+  806676:	48 b8 fe e7 ff ff ff 	movabs $0xffffffffffffe7fe,%rax
+  80667d:	ff ff ff 
+  806680:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806684:	48 89 c7             	mov    %rax,%rdi
+  806687:	49 89 df             	mov    %rbx,%r15
+  80668a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80668f:	48 b9 3c 75 ff ff ff 	movabs $0xffffffffffff753c,%rcx
+  806696:	ff ff ff 
+  806699:	48 01 d9             	add    %rbx,%rcx
+  80669c:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80669e:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  8066a5:	00 00 00 
+  8066a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8066ac:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  8066b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066b3:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8066ba:	ff ff ff 
+  8066bd:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8066c1:	48 89 d6             	mov    %rdx,%rsi
+  8066c4:	89 c7                	mov    %eax,%edi
+  8066c6:	49 89 df             	mov    %rbx,%r15
+  8066c9:	48 b8 87 94 ff ff ff 	movabs $0xffffffffffff9487,%rax
+  8066d0:	ff ff ff 
+  8066d3:	48 01 d8             	add    %rbx,%rax
+  8066d6:	ff d0                	call   *%rax
+}
+  8066d8:	90                   	nop
+  8066d9:	48 83 c4 20          	add    $0x20,%rsp
+  8066dd:	5b                   	pop    %rbx
+  8066de:	41 5f                	pop    %r15
+  8066e0:	5d                   	pop    %rbp
+  8066e1:	c3                   	ret
+
+00000000008066e2 <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  8066e2:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  8066e5:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  8066ec:	00 00 00 
+call *%rax
+  8066ef:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  8066f1:	58                   	pop    %rax
+	popq %rax;
+  8066f2:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  8066f3:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  8066fa:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  8066fe:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806702:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806706:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  80670a:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  80670e:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806711:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806715:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806719:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80671e:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806723:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806728:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80672d:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806732:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806737:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80673c:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806741:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806746:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80674b:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806750:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806755:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80675a:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80675f:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806763:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806767:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806768:	5c                   	pop    %rsp
+	ret;			//return
+  806769:	c3                   	ret
+
+000000000080676a <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80676a:	55                   	push   %rbp
+  80676b:	48 89 e5             	mov    %rsp,%rbp
+  80676e:	41 57                	push   %r15
+  806770:	53                   	push   %rbx
+  806771:	48 83 ec 30          	sub    $0x30,%rsp
+  806775:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806775 <ipc_recv+0xb>
+  80677c:	49 bb cb 28 00 00 00 	movabs $0x28cb,%r11
+  806783:	00 00 00 
+  806786:	4c 01 db             	add    %r11,%rbx
+  806789:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80678d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806791:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  806795:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80679a:	75 0e                	jne    8067aa <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  80679c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8067a3:	00 00 00 
+  8067a6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8067aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8067ae:	48 89 c7             	mov    %rax,%rdi
+  8067b1:	49 89 df             	mov    %rbx,%r15
+  8067b4:	48 b8 ba 95 ff ff ff 	movabs $0xffffffffffff95ba,%rax
+  8067bb:	ff ff ff 
+  8067be:	48 01 d8             	add    %rbx,%rax
+  8067c1:	ff d0                	call   *%rax
+  8067c3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8067c6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8067cb:	74 2a                	je     8067f7 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8067cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8067d1:	75 19                	jne    8067ec <ipc_recv+0x82>
+  8067d3:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8067da:	ff ff ff 
+  8067dd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8067e1:	48 8b 00             	mov    (%rax),%rax
+  8067e4:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8067ea:	eb 05                	jmp    8067f1 <ipc_recv+0x87>
+  8067ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067f1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8067f5:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8067f7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8067fc:	74 2a                	je     806828 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8067fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806802:	75 19                	jne    80681d <ipc_recv+0xb3>
+  806804:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80680b:	ff ff ff 
+  80680e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806812:	48 8b 00             	mov    (%rax),%rax
+  806815:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80681b:	eb 05                	jmp    806822 <ipc_recv+0xb8>
+  80681d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806822:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806826:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806828:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80682c:	74 05                	je     806833 <ipc_recv+0xc9>
+		return res;
+  80682e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806831:	eb 17                	jmp    80684a <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  806833:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80683a:	ff ff ff 
+  80683d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806841:	48 8b 00             	mov    (%rax),%rax
+  806844:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80684a:	48 83 c4 30          	add    $0x30,%rsp
+  80684e:	5b                   	pop    %rbx
+  80684f:	41 5f                	pop    %r15
+  806851:	5d                   	pop    %rbp
+  806852:	c3                   	ret
+
+0000000000806853 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  806853:	55                   	push   %rbp
+  806854:	48 89 e5             	mov    %rsp,%rbp
+  806857:	41 57                	push   %r15
+  806859:	53                   	push   %rbx
+  80685a:	48 83 ec 20          	sub    $0x20,%rsp
+  80685e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80685e <ipc_send+0xb>
+  806865:	49 bb e2 27 00 00 00 	movabs $0x27e2,%r11
+  80686c:	00 00 00 
+  80686f:	4c 01 db             	add    %r11,%rbx
+  806872:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806875:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806878:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80687c:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  80687f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806884:	75 0e                	jne    806894 <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  806886:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80688d:	00 00 00 
+  806890:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  806894:	90                   	nop
+  806895:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806898:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80689b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80689f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068a2:	89 c7                	mov    %eax,%edi
+  8068a4:	49 89 df             	mov    %rbx,%r15
+  8068a7:	48 b8 50 95 ff ff ff 	movabs $0xffffffffffff9550,%rax
+  8068ae:	ff ff ff 
+  8068b1:	48 01 d8             	add    %rbx,%rax
+  8068b4:	ff d0                	call   *%rax
+  8068b6:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8068b9:	74 da                	je     806895 <ipc_send+0x42>
+		;
+}
+  8068bb:	90                   	nop
+  8068bc:	90                   	nop
+  8068bd:	48 83 c4 20          	add    $0x20,%rsp
+  8068c1:	5b                   	pop    %rbx
+  8068c2:	41 5f                	pop    %r15
+  8068c4:	5d                   	pop    %rbp
+  8068c5:	c3                   	ret
+
+00000000008068c6 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8068c6:	55                   	push   %rbp
+  8068c7:	48 89 e5             	mov    %rsp,%rbp
+  8068ca:	41 57                	push   %r15
+  8068cc:	53                   	push   %rbx
+  8068cd:	48 83 ec 40          	sub    $0x40,%rsp
+  8068d1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068d1 <ipc_call+0xb>
+  8068d8:	49 bb 6f 27 00 00 00 	movabs $0x276f,%r11
+  8068df:	00 00 00 
+  8068e2:	4c 01 db             	add    %r11,%rbx
+  8068e5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8068e8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8068eb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8068ef:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8068f2:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8068f6:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8068fa:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8068ff:	75 0e                	jne    80690f <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  806901:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806908:	00 00 00 
+  80690b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  80690f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806914:	75 0e                	jne    806924 <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806916:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80691d:	00 00 00 
+  806920:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  806924:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806927:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80692b:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  80692e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806932:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806935:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80693b:	49 89 f8             	mov    %rdi,%r8
+  80693e:	89 c7                	mov    %eax,%edi
+  806940:	49 89 df             	mov    %rbx,%r15
+  806943:	48 b8 13 96 ff ff ff 	movabs $0xffffffffffff9613,%rax
+  80694a:	ff ff ff 
+  80694d:	48 01 d8             	add    %rbx,%rax
+  806950:	ff d0                	call   *%rax
+  806952:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  806955:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80695a:	74 2a                	je     806986 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80695c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806960:	75 19                	jne    80697b <ipc_call+0xb5>
+  806962:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806969:	ff ff ff 
+  80696c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806970:	48 8b 00             	mov    (%rax),%rax
+  806973:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806979:	eb 05                	jmp    806980 <ipc_call+0xba>
+  80697b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806980:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  806984:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806986:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80698a:	74 05                	je     806991 <ipc_call+0xcb>
+		return r;
+  80698c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80698f:	eb 17                	jmp    8069a8 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  806991:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806998:	ff ff ff 
+  80699b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80699f:	48 8b 00             	mov    (%rax),%rax
+  8069a2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8069a8:	48 83 c4 40          	add    $0x40,%rsp
+  8069ac:	5b                   	pop    %rbx
+  8069ad:	41 5f                	pop    %r15
+  8069af:	5d                   	pop    %rbp
+  8069b0:	c3                   	ret
+
+00000000008069b1 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8069b1:	55                   	push   %rbp
+  8069b2:	48 89 e5             	mov    %rsp,%rbp
+  8069b5:	41 57                	push   %r15
+  8069b7:	53                   	push   %rbx
+  8069b8:	48 83 ec 70          	sub    $0x70,%rsp
+  8069bc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069bc <ipc_callw+0xb>
+  8069c3:	49 bb 84 26 00 00 00 	movabs $0x2684,%r11
+  8069ca:	00 00 00 
+  8069cd:	4c 01 db             	add    %r11,%rbx
+  8069d0:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8069d3:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8069d6:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8069da:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8069de:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8069e3:	76 0a                	jbe    8069ef <ipc_callw+0x3e>
+		return -E_INVAL;
+  8069e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8069ea:	e9 b7 00 00 00       	jmp    806aa6 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8069ef:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8069f3:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8069f7:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8069fb:	48 89 ce             	mov    %rcx,%rsi
+  8069fe:	48 89 c7             	mov    %rax,%rdi
+  806a01:	49 89 df             	mov    %rbx,%r15
+  806a04:	48 b8 b5 89 ff ff ff 	movabs $0xffffffffffff89b5,%rax
+  806a0b:	ff ff ff 
+  806a0e:	48 01 d8             	add    %rbx,%rax
+  806a11:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  806a13:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806a1a:	00 
+  806a1b:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806a1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806a23:	48 01 d0             	add    %rdx,%rax
+  806a26:	48 83 e8 01          	sub    $0x1,%rax
+  806a2a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806a2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a32:	ba 00 00 00 00       	mov    $0x0,%edx
+  806a37:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806a3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a3f:	48 29 d0             	sub    %rdx,%rax
+  806a42:	48 c1 e8 03          	shr    $0x3,%rax
+  806a46:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806a4a:	89 c1                	mov    %eax,%ecx
+  806a4c:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806a4f:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  806a53:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806a56:	49 89 d1             	mov    %rdx,%r9
+  806a59:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  806a60:	00 00 00 
+  806a63:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806a6a:	00 00 00 
+  806a6d:	89 c7                	mov    %eax,%edi
+  806a6f:	49 89 df             	mov    %rbx,%r15
+  806a72:	48 b8 13 96 ff ff ff 	movabs $0xffffffffffff9613,%rax
+  806a79:	ff ff ff 
+  806a7c:	48 01 d8             	add    %rbx,%rax
+  806a7f:	ff d0                	call   *%rax
+  806a81:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  806a84:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806a88:	74 05                	je     806a8f <ipc_callw+0xde>
+		return r;
+  806a8a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a8d:	eb 17                	jmp    806aa6 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  806a8f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a96:	ff ff ff 
+  806a99:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a9d:	48 8b 00             	mov    (%rax),%rax
+  806aa0:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806aa6:	48 83 c4 70          	add    $0x70,%rsp
+  806aaa:	5b                   	pop    %rbx
+  806aab:	41 5f                	pop    %r15
+  806aad:	5d                   	pop    %rbp
+  806aae:	c3                   	ret
+
+0000000000806aaf <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  806aaf:	55                   	push   %rbp
+  806ab0:	48 89 e5             	mov    %rsp,%rbp
+  806ab3:	41 57                	push   %r15
+  806ab5:	53                   	push   %rbx
+  806ab6:	48 83 ec 40          	sub    $0x40,%rsp
+  806aba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806aba <ipc_callv+0xb>
+  806ac1:	49 bb 86 25 00 00 00 	movabs $0x2586,%r11
+  806ac8:	00 00 00 
+  806acb:	4c 01 db             	add    %r11,%rbx
+  806ace:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  806ad1:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  806ad4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  806ad8:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  806adb:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  806adf:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  806ae3:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806aea:	00 00 00 
+  806aed:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806af1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806af5:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806af9:	74 11                	je     806b0c <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806afb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806aff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806b03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806b06:	c1 e0 14             	shl    $0x14,%eax
+  806b09:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806b0c:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806b10:	74 14                	je     806b26 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806b12:	8b 45 20             	mov    0x20(%rbp),%eax
+  806b15:	83 e8 01             	sub    $0x1,%eax
+  806b18:	48 63 d0             	movslq %eax,%rdx
+  806b1b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806b1f:	48 09 d0             	or     %rdx,%rax
+  806b22:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806b26:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806b29:	c1 e0 10             	shl    $0x10,%eax
+  806b2c:	0b 45 10             	or     0x10(%rbp),%eax
+  806b2f:	89 c1                	mov    %eax,%ecx
+  806b31:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806b34:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806b38:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806b3c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806b40:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806b43:	4d 89 c1             	mov    %r8,%r9
+  806b46:	49 89 f8             	mov    %rdi,%r8
+  806b49:	89 c7                	mov    %eax,%edi
+  806b4b:	49 89 df             	mov    %rbx,%r15
+  806b4e:	48 b8 13 96 ff ff ff 	movabs $0xffffffffffff9613,%rax
+  806b55:	ff ff ff 
+  806b58:	48 01 d8             	add    %rbx,%rax
+  806b5b:	ff d0                	call   *%rax
+  806b5d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806b60:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806b64:	74 05                	je     806b6b <ipc_callv+0xbc>
+		return r;
+  806b66:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b69:	eb 17                	jmp    806b82 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806b6b:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b72:	ff ff ff 
+  806b75:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b79:	48 8b 00             	mov    (%rax),%rax
+  806b7c:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806b82:	48 83 c4 40          	add    $0x40,%rsp
+  806b86:	5b                   	pop    %rbx
+  806b87:	41 5f                	pop    %r15
+  806b89:	5d                   	pop    %rbp
+  806b8a:	c3                   	ret
+
+0000000000806b8b <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806b8b:	55                   	push   %rbp
+  806b8c:	48 89 e5             	mov    %rsp,%rbp
+  806b8f:	41 57                	push   %r15
+  806b91:	53                   	push   %rbx
+  806b92:	48 83 ec 40          	sub    $0x40,%rsp
+  806b96:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b96 <ipc_reply_recv+0xb>
+  806b9d:	49 bb aa 24 00 00 00 	movabs $0x24aa,%r11
+  806ba4:	00 00 00 
+  806ba7:	4c 01 db             	add    %r11,%rbx
+  806baa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806bad:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806bb0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806bb4:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806bb7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806bbb:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806bbf:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806bc4:	75 0e                	jne    806bd4 <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806bc6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806bcd:	00 00 00 
+  806bd0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806bd4:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806bd9:	75 0e                	jne    806be9 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806bdb:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806be2:	00 00 00 
+  806be5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806be9:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806bec:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806bf0:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806bf4:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806bf7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806bfb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806bfe:	4d 89 c1             	mov    %r8,%r9
+  806c01:	49 89 f8             	mov    %rdi,%r8
+  806c04:	89 c7                	mov    %eax,%edi
+  806c06:	49 89 df             	mov    %rbx,%r15
+  806c09:	48 b8 87 96 ff ff ff 	movabs $0xffffffffffff9687,%rax
+  806c10:	ff ff ff 
+  806c13:	48 01 d8             	add    %rbx,%rax
+  806c16:	ff d0                	call   *%rax
+  806c18:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806c1b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806c20:	74 2a                	je     806c4c <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806c22:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c26:	75 19                	jne    806c41 <ipc_reply_recv+0xb6>
+  806c28:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c2f:	ff ff ff 
+  806c32:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c36:	48 8b 00             	mov    (%rax),%rax
+  806c39:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806c3f:	eb 05                	jmp    806c46 <ipc_reply_recv+0xbb>
+  806c41:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806c4a:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806c4c:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806c51:	74 2a                	je     806c7d <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806c53:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c57:	75 19                	jne    806c72 <ipc_reply_recv+0xe7>
+  806c59:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c60:	ff ff ff 
+  806c63:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c67:	48 8b 00             	mov    (%rax),%rax
+  806c6a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806c70:	eb 05                	jmp    806c77 <ipc_reply_recv+0xec>
+  806c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c77:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806c7b:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806c7d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806c81:	74 05                	je     806c88 <ipc_reply_recv+0xfd>
+		return r;
+  806c83:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c86:	eb 17                	jmp    806c9f <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806c88:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806c8f:	ff ff ff 
+  806c92:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806c96:	48 8b 00             	mov    (%rax),%rax
+  806c99:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806c9f:	48 83 c4 40          	add    $0x40,%rsp
+  806ca3:	5b                   	pop    %rbx
+  806ca4:	41 5f                	pop    %r15
+  806ca6:	5d                   	pop    %rbp
+  806ca7:	c3                   	ret
+
+0000000000806ca8 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806ca8:	55                   	push   %rbp
+  806ca9:	48 89 e5             	mov    %rsp,%rbp
+  806cac:	41 57                	push   %r15
+  806cae:	53                   	push   %rbx
+  806caf:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806cb6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806cb6 <ipc_window_batch+0xe>
+  806cbd:	49 bb 8a 23 00 00 00 	movabs $0x238a,%r11
+  806cc4:	00 00 00 
+  806cc7:	4c 01 db             	add    %r11,%rbx
+  806cca:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806cd0:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806cd7:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806cdd:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806ce3:	e9 15 01 00 00       	jmp    806dfd <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806ce8:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806cee:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806cf1:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806cf8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806cfb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806cfe:	39 c2                	cmp    %eax,%edx
+  806d00:	0f 4e c2             	cmovle %edx,%eax
+  806d03:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806d06:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806d0d:	eb 6b                	jmp    806d7a <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806d0f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d12:	48 98                	cltq
+  806d14:	48 c1 e0 05          	shl    $0x5,%rax
+  806d18:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806d1c:	48 01 e8             	add    %rbp,%rax
+  806d1f:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806d25:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806d2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d2e:	c1 e0 0c             	shl    $0xc,%eax
+  806d31:	48 63 d0             	movslq %eax,%rdx
+  806d34:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806d3b:	48 01 c2             	add    %rax,%rdx
+  806d3e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d41:	48 98                	cltq
+  806d43:	48 c1 e0 05          	shl    $0x5,%rax
+  806d47:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806d4b:	48 01 e8             	add    %rbp,%rax
+  806d4e:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806d54:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806d57:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d5a:	48 98                	cltq
+  806d5c:	48 c1 e0 05          	shl    $0x5,%rax
+  806d60:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806d64:	48 01 e8             	add    %rbp,%rax
+  806d67:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806d6e:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806d74:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806d76:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806d7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d7d:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806d80:	7c 8d                	jl     806d0f <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806d82:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806d89:	74 27                	je     806db2 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806d8b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806d8e:	48 63 d0             	movslq %eax,%rdx
+  806d91:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806d98:	48 89 d6             	mov    %rdx,%rsi
+  806d9b:	48 89 c7             	mov    %rax,%rdi
+  806d9e:	49 89 df             	mov    %rbx,%r15
+  806da1:	48 b8 2a 99 ff ff ff 	movabs $0xffffffffffff992a,%rax
+  806da8:	ff ff ff 
+  806dab:	48 01 d8             	add    %rbx,%rax
+  806dae:	ff d0                	call   *%rax
+  806db0:	eb 25                	jmp    806dd7 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806db2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806db5:	48 63 d0             	movslq %eax,%rdx
+  806db8:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806dbf:	48 89 d6             	mov    %rdx,%rsi
+  806dc2:	48 89 c7             	mov    %rax,%rdi
+  806dc5:	49 89 df             	mov    %rbx,%r15
+  806dc8:	48 b8 88 99 ff ff ff 	movabs $0xffffffffffff9988,%rax
+  806dcf:	ff ff ff 
+  806dd2:	48 01 d8             	add    %rbx,%rax
+  806dd5:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806dd7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806dda:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806dde:	79 05                	jns    806de5 <ipc_window_batch+0x13d>
+			return r;
+  806de0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806de3:	eb 2a                	jmp    806e0f <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806de5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806de8:	c1 e0 0c             	shl    $0xc,%eax
+  806deb:	48 98                	cltq
+  806ded:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806df4:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806df7:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806dfd:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806e04:	0f 8f de fe ff ff    	jg     806ce8 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806e0f:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806e16:	5b                   	pop    %rbx
+  806e17:	41 5f                	pop    %r15
+  806e19:	5d                   	pop    %rbp
+  806e1a:	c3                   	ret
+
+0000000000806e1b <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806e1b:	55                   	push   %rbp
+  806e1c:	48 89 e5             	mov    %rsp,%rbp
+  806e1f:	48 83 ec 10          	sub    $0x10,%rsp
+  806e23:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e23 <ipc_map_window+0x8>
+  806e2a:	49 bb 1d 22 00 00 00 	movabs $0x221d,%r11
+  806e31:	00 00 00 
+  806e34:	4c 01 d8             	add    %r11,%rax
+  806e37:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806e3b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806e3e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806e41:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806e45:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806e4a:	bf 01 00 00 00       	mov    $0x1,%edi
+  806e4f:	49 b8 68 dc ff ff ff 	movabs $0xffffffffffffdc68,%r8
+  806e56:	ff ff ff 
+  806e59:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806e5d:	ff d0                	call   *%rax
+}
+  806e5f:	c9                   	leave
+  806e60:	c3                   	ret
+
+0000000000806e61 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806e61:	55                   	push   %rbp
+  806e62:	48 89 e5             	mov    %rsp,%rbp
+  806e65:	48 83 ec 10          	sub    $0x10,%rsp
+  806e69:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e69 <ipc_unmap_window+0x8>
+  806e70:	49 bb d7 21 00 00 00 	movabs $0x21d7,%r11
+  806e77:	00 00 00 
+  806e7a:	4c 01 d8             	add    %r11,%rax
+  806e7d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806e81:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806e84:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806e87:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806e8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806e90:	bf 00 00 00 00       	mov    $0x0,%edi
+  806e95:	49 b8 68 dc ff ff ff 	movabs $0xffffffffffffdc68,%r8
+  806e9c:	ff ff ff 
+  806e9f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806ea3:	ff d0                	call   *%rax
+}
+  806ea5:	c9                   	leave
+  806ea6:	c3                   	ret
+
+0000000000806ea7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806ea7:	55                   	push   %rbp
+  806ea8:	48 89 e5             	mov    %rsp,%rbp
+  806eab:	48 83 ec 18          	sub    $0x18,%rsp
+  806eaf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806eaf <ipc_find_env+0x8>
+  806eb6:	49 bb 91 21 00 00 00 	movabs $0x2191,%r11
+  806ebd:	00 00 00 
+  806ec0:	4c 01 d8             	add    %r11,%rax
+  806ec3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806ec6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806ecd:	eb 57                	jmp    806f26 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806ecf:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806ed6:	ff ff ff 
+  806ed9:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806edd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806ee0:	48 63 d2             	movslq %edx,%rdx
+  806ee3:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806eea:	48 01 ca             	add    %rcx,%rdx
+  806eed:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806ef4:	8b 12                	mov    (%rdx),%edx
+  806ef6:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806ef9:	75 27                	jne    806f22 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806efb:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806f02:	ff ff ff 
+  806f05:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806f09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806f0c:	48 98                	cltq
+  806f0e:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806f15:	48 01 d0             	add    %rdx,%rax
+  806f18:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806f1e:	8b 00                	mov    (%rax),%eax
+  806f20:	eb 12                	jmp    806f34 <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806f22:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806f26:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806f2d:	7e a0                	jle    806ecf <ipc_find_env+0x28>
+	}
+	return 0;
+  806f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806f34:	c9                   	leave
+  806f35:	c3                   	ret
+
+0000000000806f36 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806f36:	55                   	push   %rbp
+  806f37:	48 89 e5             	mov    %rsp,%rbp
+  806f3a:	48 83 ec 18          	sub    $0x18,%rsp
+  806f3e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806f3e <pageref+0x8>
+  806f45:	49 bb 02 21 00 00 00 	movabs $0x2102,%r11
+  806f4c:	00 00 00 
+  806f4f:	4c 01 d8             	add    %r11,%rax
+  806f52:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806f56:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806f5a:	48 89 d1             	mov    %rdx,%rcx
+  806f5d:	48 c1 e9 15          	shr    $0x15,%rcx
+  806f61:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806f68:	ff ff ff 
+  806f6b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806f6f:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806f73:	83 e2 01             	and    $0x1,%edx
+  806f76:	48 85 d2             	test   %rdx,%rdx
+  806f79:	75 07                	jne    806f82 <pageref+0x4c>
+		return 0;
+  806f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f80:	eb 64                	jmp    806fe6 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806f82:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806f86:	48 89 d1             	mov    %rdx,%rcx
+  806f89:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806f8d:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806f94:	ff ff ff 
+  806f97:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806f9b:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806f9f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806fa3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806fa7:	83 e2 01             	and    $0x1,%edx
+  806faa:	48 85 d2             	test   %rdx,%rdx
+  806fad:	75 07                	jne    806fb6 <pageref+0x80>
+		return 0;
+  806faf:	b8 00 00 00 00       	mov    $0x0,%eax
+  806fb4:	eb 30                	jmp    806fe6 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806fb6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806fba:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806fbe:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806fc5:	ff ff ff 
+  806fc8:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806fcc:	48 89 d0             	mov    %rdx,%rax
+  806fcf:	48 01 c0             	add    %rax,%rax
+  806fd2:	48 01 d0             	add    %rdx,%rax
+  806fd5:	48 c1 e0 03          	shl    $0x3,%rax
+  806fd9:	48 01 c8             	add    %rcx,%rax
+  806fdc:	48 83 c0 08          	add    $0x8,%rax
+  806fe0:	0f b7 00             	movzwl (%rax),%eax
+  806fe3:	0f b7 c0             	movzwl %ax,%eax
+}
+  806fe6:	c9                   	leave
+  806fe7:	c3                   	ret
@@ -0,0 +1,10397 @@
+
+obj/user/testfile:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 17 10 00 00       	call   801058 <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <xopen>:
+
+#define FVA ((struct Fd*)0xCCCCC000)
+
+static int
+xopen(const char *path, int mode)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <xopen+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800066:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	extern union Fsipc fsipcbuf;
+	envid_t fsenv;
+
+	strcpy(fsipcbuf.open.req_path, path);
+  800069:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80006d:	48 89 c6             	mov    %rax,%rsi
+  800070:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  800077:	ff ff ff 
+  80007a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80007e:	48 89 c7             	mov    %rax,%rdi
+  800081:	49 89 df             	mov    %rbx,%r15
+  800084:	48 b8 bb 91 ff ff ff 	movabs $0xffffffffffff91bb,%rax
+  80008b:	ff ff ff 
+  80008e:	48 01 d8             	add    %rbx,%rax
+  800091:	ff d0                	call   *%rax
+	fsipcbuf.open.req_omode = mode;
+  800093:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80009a:	ff ff ff 
+  80009d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8000a1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8000a4:	89 90 00 04 00 00    	mov    %edx,0x400(%rax)
+
+	fsenv = ipc_find_env(ENV_TYPE_FS);
+  8000aa:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000af:	49 89 df             	mov    %rbx,%r15
+  8000b2:	48 b8 5d ad ff ff ff 	movabs $0xffffffffffffad5d,%rax
+  8000b9:	ff ff ff 
+  8000bc:	48 01 d8             	add    %rbx,%rax
+  8000bf:	ff d0                	call   *%rax
+  8000c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8000c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000c7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8000cc:	48 ba f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rdx
+  8000d3:	ff ff ff 
+  8000d6:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8000da:	be 01 00 00 00       	mov    $0x1,%esi
+  8000df:	89 c7                	mov    %eax,%edi
+  8000e1:	49 89 df             	mov    %rbx,%r15
+  8000e4:	48 b8 09 a7 ff ff ff 	movabs $0xffffffffffffa709,%rax
+  8000eb:	ff ff ff 
+  8000ee:	48 01 d8             	add    %rbx,%rax
+  8000f1:	ff d0                	call   *%rax
+	return ipc_recv(NULL, FVA, NULL);
+  8000f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f8:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  8000fd:	48 89 c6             	mov    %rax,%rsi
+  800100:	bf 00 00 00 00       	mov    $0x0,%edi
+  800105:	49 89 df             	mov    %rbx,%r15
+  800108:	48 b8 20 a6 ff ff ff 	movabs $0xffffffffffffa620,%rax
+  80010f:	ff ff ff 
+  800112:	48 01 d8             	add    %rbx,%rax
+  800115:	ff d0                	call   *%rax
+}
+  800117:	48 83 c4 20          	add    $0x20,%rsp
+  80011b:	5b                   	pop    %rbx
+  80011c:	41 5f                	pop    %r15
+  80011e:	5d                   	pop    %rbp
+  80011f:	c3                   	ret
+
+0000000000800120 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800120:	55                   	push   %rbp
+  800121:	48 89 e5             	mov    %rsp,%rbp
+  800124:	41 57                	push   %r15
+  800126:	41 54                	push   %r12
+  800128:	53                   	push   %rbx
+  800129:	48 81 ec d8 02 00 00 	sub    $0x2d8,%rsp
+  800130:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800130 <umain+0x10>
+  800137:	49 bb 10 8f 00 00 00 	movabs $0x8f10,%r11
+  80013e:	00 00 00 
+  800141:	4c 01 db             	add    %r11,%rbx
+  800144:	89 bd 1c fd ff ff    	mov    %edi,-0x2e4(%rbp)
+  80014a:	48 89 b5 10 fd ff ff 	mov    %rsi,-0x2f0(%rbp)
+	struct Fd fdcopy;
+	struct Stat st;
+	char buf[512];
+
+	// We open files manually first, to avoid the FD layer
+	if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800151:	be 00 00 00 00       	mov    $0x0,%esi
+  800156:	48 b8 ce dd ff ff ff 	movabs $0xffffffffffffddce,%rax
+  80015d:	ff ff ff 
+  800160:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800164:	48 89 c7             	mov    %rax,%rdi
+  800167:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  80016e:	ff ff ff 
+  800171:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800175:	ff d0                	call   *%rax
+  800177:	48 98                	cltq
+  800179:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80017d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800182:	79 4d                	jns    8001d1 <umain+0xb1>
+  800184:	48 83 7d d0 f4       	cmpq   $0xfffffffffffffff4,-0x30(%rbp)
+  800189:	74 46                	je     8001d1 <umain+0xb1>
+		panic("serve_open /not-found: %e", r);
+  80018b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80018f:	48 89 c1             	mov    %rax,%rcx
+  800192:	48 b8 d9 dd ff ff ff 	movabs $0xffffffffffffddd9,%rax
+  800199:	ff ff ff 
+  80019c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001a0:	48 89 c2             	mov    %rax,%rdx
+  8001a3:	be 20 00 00 00       	mov    $0x20,%esi
+  8001a8:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  8001af:	ff ff ff 
+  8001b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001b6:	48 89 c7             	mov    %rax,%rdi
+  8001b9:	49 89 df             	mov    %rbx,%r15
+  8001bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c1:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  8001c8:	ff ff ff 
+  8001cb:	49 01 d8             	add    %rbx,%r8
+  8001ce:	41 ff d0             	call   *%r8
+	else if (r >= 0)
+  8001d1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8001d6:	78 3e                	js     800216 <umain+0xf6>
+		panic("serve_open /not-found succeeded!");
+  8001d8:	48 b8 08 de ff ff ff 	movabs $0xffffffffffffde08,%rax
+  8001df:	ff ff ff 
+  8001e2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001e6:	48 89 c2             	mov    %rax,%rdx
+  8001e9:	be 22 00 00 00       	mov    $0x22,%esi
+  8001ee:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  8001f5:	ff ff ff 
+  8001f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001fc:	48 89 c7             	mov    %rax,%rdi
+  8001ff:	49 89 df             	mov    %rbx,%r15
+  800202:	b8 00 00 00 00       	mov    $0x0,%eax
+  800207:	48 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%rcx
+  80020e:	ff ff ff 
+  800211:	48 01 d9             	add    %rbx,%rcx
+  800214:	ff d1                	call   *%rcx
+	if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  800216:	be 00 00 00 00       	mov    $0x0,%esi
+  80021b:	48 b8 29 de ff ff ff 	movabs $0xffffffffffffde29,%rax
+  800222:	ff ff ff 
+  800225:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800229:	48 89 c7             	mov    %rax,%rdi
+  80022c:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800233:	ff ff ff 
+  800236:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80023a:	ff d0                	call   *%rax
+  80023c:	48 98                	cltq
+  80023e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800242:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800247:	79 46                	jns    80028f <umain+0x16f>
+		panic("serve_open /newmotd: %e", r);
+  800249:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80024d:	48 89 c1             	mov    %rax,%rcx
+  800250:	48 b8 32 de ff ff ff 	movabs $0xffffffffffffde32,%rax
+  800257:	ff ff ff 
+  80025a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80025e:	48 89 c2             	mov    %rax,%rdx
+  800261:	be 24 00 00 00       	mov    $0x24,%esi
+  800266:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  80026d:	ff ff ff 
+  800270:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800274:	48 89 c7             	mov    %rax,%rdi
+  800277:	49 89 df             	mov    %rbx,%r15
+  80027a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027f:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  800286:	ff ff ff 
+  800289:	49 01 d8             	add    %rbx,%r8
+  80028c:	41 ff d0             	call   *%r8
+	if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  80028f:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  800294:	8b 00                	mov    (%rax),%eax
+  800296:	83 f8 66             	cmp    $0x66,%eax
+  800299:	75 18                	jne    8002b3 <umain+0x193>
+  80029b:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  8002a0:	8b 40 04             	mov    0x4(%rax),%eax
+  8002a3:	85 c0                	test   %eax,%eax
+  8002a5:	75 0c                	jne    8002b3 <umain+0x193>
+  8002a7:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  8002ac:	8b 40 08             	mov    0x8(%rax),%eax
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	74 3e                	je     8002f1 <umain+0x1d1>
+		panic("serve_open did not fill struct Fd correctly\n");
+  8002b3:	48 b8 50 de ff ff ff 	movabs $0xffffffffffffde50,%rax
+  8002ba:	ff ff ff 
+  8002bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002c1:	48 89 c2             	mov    %rax,%rdx
+  8002c4:	be 26 00 00 00       	mov    $0x26,%esi
+  8002c9:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  8002d0:	ff ff ff 
+  8002d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002d7:	48 89 c7             	mov    %rax,%rdi
+  8002da:	49 89 df             	mov    %rbx,%r15
+  8002dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e2:	48 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%rcx
+  8002e9:	ff ff ff 
+  8002ec:	48 01 d9             	add    %rbx,%rcx
+  8002ef:	ff d1                	call   *%rcx
+	cprintf("serve_open is good\n");
+  8002f1:	48 b8 7d de ff ff ff 	movabs $0xffffffffffffde7d,%rax
+  8002f8:	ff ff ff 
+  8002fb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002ff:	48 89 c7             	mov    %rax,%rdi
+  800302:	49 89 df             	mov    %rbx,%r15
+  800305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030a:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  800311:	ff ff ff 
+  800314:	48 01 da             	add    %rbx,%rdx
+  800317:	ff d2                	call   *%rdx
+
+	if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  800319:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800320:	ff ff ff 
+  800323:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800327:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  80032b:	48 8d 85 20 ff ff ff 	lea    -0xe0(%rbp),%rax
+  800332:	48 89 c6             	mov    %rax,%rsi
+  800335:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  80033a:	48 89 c7             	mov    %rax,%rdi
+  80033d:	ff d2                	call   *%rdx
+  80033f:	48 98                	cltq
+  800341:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800345:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80034a:	79 46                	jns    800392 <umain+0x272>
+		panic("file_stat: %e", r);
+  80034c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800350:	48 89 c1             	mov    %rax,%rcx
+  800353:	48 b8 91 de ff ff ff 	movabs $0xffffffffffffde91,%rax
+  80035a:	ff ff ff 
+  80035d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800361:	48 89 c2             	mov    %rax,%rdx
+  800364:	be 2a 00 00 00       	mov    $0x2a,%esi
+  800369:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800370:	ff ff ff 
+  800373:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800377:	48 89 c7             	mov    %rax,%rdi
+  80037a:	49 89 df             	mov    %rbx,%r15
+  80037d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800382:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  800389:	ff ff ff 
+  80038c:	49 01 d8             	add    %rbx,%r8
+  80038f:	41 ff d0             	call   *%r8
+	if (strlen(msg) != st.st_size)
+  800392:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  800399:	00 00 00 
+  80039c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8003a0:	48 89 c7             	mov    %rax,%rdi
+  8003a3:	49 89 df             	mov    %rbx,%r15
+  8003a6:	48 b8 27 91 ff ff ff 	movabs $0xffffffffffff9127,%rax
+  8003ad:	ff ff ff 
+  8003b0:	48 01 d8             	add    %rbx,%rax
+  8003b3:	ff d0                	call   *%rax
+  8003b5:	89 c2                	mov    %eax,%edx
+  8003b7:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8003ba:	39 c2                	cmp    %eax,%edx
+  8003bc:	74 6c                	je     80042a <umain+0x30a>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  8003be:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  8003c5:	00 00 00 
+  8003c8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8003cc:	48 89 c7             	mov    %rax,%rdi
+  8003cf:	49 89 df             	mov    %rbx,%r15
+  8003d2:	48 b8 27 91 ff ff ff 	movabs $0xffffffffffff9127,%rax
+  8003d9:	ff ff ff 
+  8003dc:	48 01 d8             	add    %rbx,%rax
+  8003df:	ff d0                	call   *%rax
+  8003e1:	89 c2                	mov    %eax,%edx
+  8003e3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8003e6:	41 89 d0             	mov    %edx,%r8d
+  8003e9:	89 c1                	mov    %eax,%ecx
+  8003eb:	48 b8 a0 de ff ff ff 	movabs $0xffffffffffffdea0,%rax
+  8003f2:	ff ff ff 
+  8003f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003f9:	48 89 c2             	mov    %rax,%rdx
+  8003fc:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800401:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800408:	ff ff ff 
+  80040b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80040f:	48 89 c7             	mov    %rax,%rdi
+  800412:	49 89 df             	mov    %rbx,%r15
+  800415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041a:	49 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r9
+  800421:	ff ff ff 
+  800424:	49 01 d9             	add    %rbx,%r9
+  800427:	41 ff d1             	call   *%r9
+	cprintf("file_stat is good\n");
+  80042a:	48 b8 c6 de ff ff ff 	movabs $0xffffffffffffdec6,%rax
+  800431:	ff ff ff 
+  800434:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800438:	48 89 c7             	mov    %rax,%rdi
+  80043b:	49 89 df             	mov    %rbx,%r15
+  80043e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800443:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  80044a:	ff ff ff 
+  80044d:	48 01 da             	add    %rbx,%rdx
+  800450:	ff d2                	call   *%rdx
+
+	memset(buf, 0, sizeof buf);
+  800452:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800459:	ba 00 02 00 00       	mov    $0x200,%edx
+  80045e:	be 00 00 00 00       	mov    $0x0,%esi
+  800463:	48 89 c7             	mov    %rax,%rdi
+  800466:	49 89 df             	mov    %rbx,%r15
+  800469:	48 b8 fc 94 ff ff ff 	movabs $0xffffffffffff94fc,%rax
+  800470:	ff ff ff 
+  800473:	48 01 d8             	add    %rbx,%rax
+  800476:	ff d0                	call   *%rax
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800478:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80047f:	ff ff ff 
+  800482:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800486:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  80048a:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800491:	ba 00 02 00 00       	mov    $0x200,%edx
+  800496:	48 89 c6             	mov    %rax,%rsi
+  800499:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  80049e:	48 89 c7             	mov    %rax,%rdi
+  8004a1:	ff d1                	call   *%rcx
+  8004a3:	48 98                	cltq
+  8004a5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8004a9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8004ae:	79 46                	jns    8004f6 <umain+0x3d6>
+		panic("file_read: %e", r);
+  8004b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004b4:	48 89 c1             	mov    %rax,%rcx
+  8004b7:	48 b8 d9 de ff ff ff 	movabs $0xffffffffffffded9,%rax
+  8004be:	ff ff ff 
+  8004c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004c5:	48 89 c2             	mov    %rax,%rdx
+  8004c8:	be 31 00 00 00       	mov    $0x31,%esi
+  8004cd:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  8004d4:	ff ff ff 
+  8004d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8004db:	48 89 c7             	mov    %rax,%rdi
+  8004de:	49 89 df             	mov    %rbx,%r15
+  8004e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e6:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  8004ed:	ff ff ff 
+  8004f0:	49 01 d8             	add    %rbx,%r8
+  8004f3:	41 ff d0             	call   *%r8
+	if (strcmp(buf, msg) != 0)
+  8004f6:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  8004fd:	00 00 00 
+  800500:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  800504:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  80050b:	48 89 d6             	mov    %rdx,%rsi
+  80050e:	48 89 c7             	mov    %rax,%rdi
+  800511:	49 89 df             	mov    %rbx,%r15
+  800514:	48 b8 74 93 ff ff ff 	movabs $0xffffffffffff9374,%rax
+  80051b:	ff ff ff 
+  80051e:	48 01 d8             	add    %rbx,%rax
+  800521:	ff d0                	call   *%rax
+  800523:	85 c0                	test   %eax,%eax
+  800525:	74 3e                	je     800565 <umain+0x445>
+		panic("file_read returned wrong data");
+  800527:	48 b8 e7 de ff ff ff 	movabs $0xffffffffffffdee7,%rax
+  80052e:	ff ff ff 
+  800531:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800535:	48 89 c2             	mov    %rax,%rdx
+  800538:	be 33 00 00 00       	mov    $0x33,%esi
+  80053d:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800544:	ff ff ff 
+  800547:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80054b:	48 89 c7             	mov    %rax,%rdi
+  80054e:	49 89 df             	mov    %rbx,%r15
+  800551:	b8 00 00 00 00       	mov    $0x0,%eax
+  800556:	48 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%rcx
+  80055d:	ff ff ff 
+  800560:	48 01 d9             	add    %rbx,%rcx
+  800563:	ff d1                	call   *%rcx
+	cprintf("file_read is good\n");
+  800565:	48 b8 05 df ff ff ff 	movabs $0xffffffffffffdf05,%rax
+  80056c:	ff ff ff 
+  80056f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800573:	48 89 c7             	mov    %rax,%rdi
+  800576:	49 89 df             	mov    %rbx,%r15
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  800585:	ff ff ff 
+  800588:	48 01 da             	add    %rbx,%rdx
+  80058b:	ff d2                	call   *%rdx
+
+	if ((r = devfile.dev_close(FVA)) < 0)
+  80058d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800594:	ff ff ff 
+  800597:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80059b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80059f:	ba 00 c0 cc cc       	mov    $0xccccc000,%edx
+  8005a4:	48 89 d7             	mov    %rdx,%rdi
+  8005a7:	ff d0                	call   *%rax
+  8005a9:	48 98                	cltq
+  8005ab:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8005af:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8005b4:	79 46                	jns    8005fc <umain+0x4dc>
+		panic("file_close: %e", r);
+  8005b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8005ba:	48 89 c1             	mov    %rax,%rcx
+  8005bd:	48 b8 18 df ff ff ff 	movabs $0xffffffffffffdf18,%rax
+  8005c4:	ff ff ff 
+  8005c7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005cb:	48 89 c2             	mov    %rax,%rdx
+  8005ce:	be 37 00 00 00       	mov    $0x37,%esi
+  8005d3:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  8005da:	ff ff ff 
+  8005dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005e1:	48 89 c7             	mov    %rax,%rdi
+  8005e4:	49 89 df             	mov    %rbx,%r15
+  8005e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ec:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  8005f3:	ff ff ff 
+  8005f6:	49 01 d8             	add    %rbx,%r8
+  8005f9:	41 ff d0             	call   *%r8
+	cprintf("file_close is good\n");
+  8005fc:	48 b8 27 df ff ff ff 	movabs $0xffffffffffffdf27,%rax
+  800603:	ff ff ff 
+  800606:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80060a:	48 89 c7             	mov    %rax,%rdi
+  80060d:	49 89 df             	mov    %rbx,%r15
+  800610:	b8 00 00 00 00       	mov    $0x0,%eax
+  800615:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  80061c:	ff ff ff 
+  80061f:	48 01 da             	add    %rbx,%rdx
+  800622:	ff d2                	call   *%rdx
+
+	// We're about to unmap the FD, but still need a way to get
+	// the stale filenum to serve_read, so we make a local copy.
+	// The file server won't think it's stale until we unmap the
+	// FD page.
+	fdcopy = *FVA;
+  800624:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  800629:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80062d:	48 8b 00             	mov    (%rax),%rax
+  800630:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  800634:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	sys_page_unmap(0, FVA);
+  800638:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  80063d:	48 89 c6             	mov    %rax,%rsi
+  800640:	bf 00 00 00 00       	mov    $0x0,%edi
+  800645:	49 89 df             	mov    %rbx,%r15
+  800648:	48 b8 4f 9f ff ff ff 	movabs $0xffffffffffff9f4f,%rax
+  80064f:	ff ff ff 
+  800652:	48 01 d8             	add    %rbx,%rax
+  800655:	ff d0                	call   *%rax
+
+	if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  800657:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80065e:	ff ff ff 
+  800661:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800665:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  800669:	48 8d 8d 20 fd ff ff 	lea    -0x2e0(%rbp),%rcx
+  800670:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800674:	ba 00 02 00 00       	mov    $0x200,%edx
+  800679:	48 89 ce             	mov    %rcx,%rsi
+  80067c:	48 89 c7             	mov    %rax,%rdi
+  80067f:	41 ff d0             	call   *%r8
+  800682:	48 98                	cltq
+  800684:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800688:	48 83 7d d0 fd       	cmpq   $0xfffffffffffffffd,-0x30(%rbp)
+  80068d:	74 46                	je     8006d5 <umain+0x5b5>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+  80068f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800693:	48 89 c1             	mov    %rax,%rcx
+  800696:	48 b8 40 df ff ff ff 	movabs $0xffffffffffffdf40,%rax
+  80069d:	ff ff ff 
+  8006a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006a4:	48 89 c2             	mov    %rax,%rdx
+  8006a7:	be 42 00 00 00       	mov    $0x42,%esi
+  8006ac:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  8006b3:	ff ff ff 
+  8006b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006ba:	48 89 c7             	mov    %rax,%rdi
+  8006bd:	49 89 df             	mov    %rbx,%r15
+  8006c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c5:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  8006cc:	ff ff ff 
+  8006cf:	49 01 d8             	add    %rbx,%r8
+  8006d2:	41 ff d0             	call   *%r8
+	cprintf("stale fileid is good\n");
+  8006d5:	48 b8 77 df ff ff ff 	movabs $0xffffffffffffdf77,%rax
+  8006dc:	ff ff ff 
+  8006df:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006e3:	48 89 c7             	mov    %rax,%rdi
+  8006e6:	49 89 df             	mov    %rbx,%r15
+  8006e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ee:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  8006f5:	ff ff ff 
+  8006f8:	48 01 da             	add    %rbx,%rdx
+  8006fb:	ff d2                	call   *%rdx
+
+	// Try writing
+	if ((r = xopen("/new-file", O_RDWR|O_CREAT)) < 0)
+  8006fd:	be 02 01 00 00       	mov    $0x102,%esi
+  800702:	48 b8 8d df ff ff ff 	movabs $0xffffffffffffdf8d,%rax
+  800709:	ff ff ff 
+  80070c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800710:	48 89 c7             	mov    %rax,%rdi
+  800713:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  80071a:	ff ff ff 
+  80071d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800721:	ff d0                	call   *%rax
+  800723:	48 98                	cltq
+  800725:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800729:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80072e:	79 46                	jns    800776 <umain+0x656>
+		panic("serve_open /new-file: %e", r);
+  800730:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800734:	48 89 c1             	mov    %rax,%rcx
+  800737:	48 b8 97 df ff ff ff 	movabs $0xffffffffffffdf97,%rax
+  80073e:	ff ff ff 
+  800741:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800745:	48 89 c2             	mov    %rax,%rdx
+  800748:	be 47 00 00 00       	mov    $0x47,%esi
+  80074d:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800754:	ff ff ff 
+  800757:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80075b:	48 89 c7             	mov    %rax,%rdi
+  80075e:	49 89 df             	mov    %rbx,%r15
+  800761:	b8 00 00 00 00       	mov    $0x0,%eax
+  800766:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  80076d:	ff ff ff 
+  800770:	49 01 d8             	add    %rbx,%r8
+  800773:	41 ff d0             	call   *%r8
+
+	cprintf("xopen new file worked devfile %p, dev_write %p, msg %p, FVA %p\n", devfile, devfile.dev_write, msg, FVA);
+  800776:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  80077d:	00 00 00 
+  800780:	4c 8b 0c 03          	mov    (%rbx,%rax,1),%r9
+  800784:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80078b:	ff ff ff 
+  80078e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800792:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  800796:	48 83 ec 08          	sub    $0x8,%rsp
+  80079a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8007a1:	ff ff ff 
+  8007a4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8007a8:	48 83 ec 38          	sub    $0x38,%rsp
+  8007ac:	48 89 e2             	mov    %rsp,%rdx
+  8007af:	48 8b 30             	mov    (%rax),%rsi
+  8007b2:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8007b6:	48 89 32             	mov    %rsi,(%rdx)
+  8007b9:	48 89 7a 08          	mov    %rdi,0x8(%rdx)
+  8007bd:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8007c1:	48 8b 78 18          	mov    0x18(%rax),%rdi
+  8007c5:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+  8007c9:	48 89 7a 18          	mov    %rdi,0x18(%rdx)
+  8007cd:	48 8b 70 20          	mov    0x20(%rax),%rsi
+  8007d1:	48 8b 78 28          	mov    0x28(%rax),%rdi
+  8007d5:	48 89 72 20          	mov    %rsi,0x20(%rdx)
+  8007d9:	48 89 7a 28          	mov    %rdi,0x28(%rdx)
+  8007dd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8007e1:	48 89 42 30          	mov    %rax,0x30(%rdx)
+  8007e5:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  8007ea:	48 89 c1             	mov    %rax,%rcx
+  8007ed:	4c 89 ca             	mov    %r9,%rdx
+  8007f0:	4c 89 c6             	mov    %r8,%rsi
+  8007f3:	48 b8 b0 df ff ff ff 	movabs $0xffffffffffffdfb0,%rax
+  8007fa:	ff ff ff 
+  8007fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800801:	48 89 c7             	mov    %rax,%rdi
+  800804:	49 89 df             	mov    %rbx,%r15
+  800807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080c:	49 b8 f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%r8
+  800813:	ff ff ff 
+  800816:	49 01 d8             	add    %rbx,%r8
+  800819:	41 ff d0             	call   *%r8
+  80081c:	48 83 c4 40          	add    $0x40,%rsp
+
+	if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  800820:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800827:	ff ff ff 
+  80082a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80082e:	4c 8b 60 18          	mov    0x18(%rax),%r12
+  800832:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  800839:	00 00 00 
+  80083c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800840:	48 89 c7             	mov    %rax,%rdi
+  800843:	49 89 df             	mov    %rbx,%r15
+  800846:	48 b8 27 91 ff ff ff 	movabs $0xffffffffffff9127,%rax
+  80084d:	ff ff ff 
+  800850:	48 01 d8             	add    %rbx,%rax
+  800853:	ff d0                	call   *%rax
+  800855:	48 63 d0             	movslq %eax,%rdx
+  800858:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  80085f:	00 00 00 
+  800862:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800866:	48 89 c6             	mov    %rax,%rsi
+  800869:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  80086e:	48 89 c7             	mov    %rax,%rdi
+  800871:	41 ff d4             	call   *%r12
+  800874:	48 98                	cltq
+  800876:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80087a:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  800881:	00 00 00 
+  800884:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800888:	48 89 c7             	mov    %rax,%rdi
+  80088b:	49 89 df             	mov    %rbx,%r15
+  80088e:	48 b8 27 91 ff ff ff 	movabs $0xffffffffffff9127,%rax
+  800895:	ff ff ff 
+  800898:	48 01 d8             	add    %rbx,%rax
+  80089b:	ff d0                	call   *%rax
+  80089d:	48 98                	cltq
+  80089f:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  8008a3:	74 46                	je     8008eb <umain+0x7cb>
+		panic("file_write: %e", r);
+  8008a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8008a9:	48 89 c1             	mov    %rax,%rcx
+  8008ac:	48 b8 f0 df ff ff ff 	movabs $0xffffffffffffdff0,%rax
+  8008b3:	ff ff ff 
+  8008b6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008ba:	48 89 c2             	mov    %rax,%rdx
+  8008bd:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8008c2:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  8008c9:	ff ff ff 
+  8008cc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008d0:	48 89 c7             	mov    %rax,%rdi
+  8008d3:	49 89 df             	mov    %rbx,%r15
+  8008d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008db:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  8008e2:	ff ff ff 
+  8008e5:	49 01 d8             	add    %rbx,%r8
+  8008e8:	41 ff d0             	call   *%r8
+	cprintf("file_write is good\n");
+  8008eb:	48 b8 ff df ff ff ff 	movabs $0xffffffffffffdfff,%rax
+  8008f2:	ff ff ff 
+  8008f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008f9:	48 89 c7             	mov    %rax,%rdi
+  8008fc:	49 89 df             	mov    %rbx,%r15
+  8008ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800904:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  80090b:	ff ff ff 
+  80090e:	48 01 da             	add    %rbx,%rdx
+  800911:	ff d2                	call   *%rdx
+
+	FVA->fd_offset = 0;
+  800913:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  800918:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+	memset(buf, 0, sizeof buf);
+  80091f:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800926:	ba 00 02 00 00       	mov    $0x200,%edx
+  80092b:	be 00 00 00 00       	mov    $0x0,%esi
+  800930:	48 89 c7             	mov    %rax,%rdi
+  800933:	49 89 df             	mov    %rbx,%r15
+  800936:	48 b8 fc 94 ff ff ff 	movabs $0xffffffffffff94fc,%rax
+  80093d:	ff ff ff 
+  800940:	48 01 d8             	add    %rbx,%rax
+  800943:	ff d0                	call   *%rax
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800945:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80094c:	ff ff ff 
+  80094f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800953:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  800957:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  80095e:	ba 00 02 00 00       	mov    $0x200,%edx
+  800963:	48 89 c6             	mov    %rax,%rsi
+  800966:	b8 00 c0 cc cc       	mov    $0xccccc000,%eax
+  80096b:	48 89 c7             	mov    %rax,%rdi
+  80096e:	ff d1                	call   *%rcx
+  800970:	48 98                	cltq
+  800972:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800976:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80097b:	79 46                	jns    8009c3 <umain+0x8a3>
+		panic("file_read after file_write: %e", r);
+  80097d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800981:	48 89 c1             	mov    %rax,%rcx
+  800984:	48 b8 18 e0 ff ff ff 	movabs $0xffffffffffffe018,%rax
+  80098b:	ff ff ff 
+  80098e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800992:	48 89 c2             	mov    %rax,%rdx
+  800995:	be 52 00 00 00       	mov    $0x52,%esi
+  80099a:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  8009a1:	ff ff ff 
+  8009a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009a8:	48 89 c7             	mov    %rax,%rdi
+  8009ab:	49 89 df             	mov    %rbx,%r15
+  8009ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b3:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  8009ba:	ff ff ff 
+  8009bd:	49 01 d8             	add    %rbx,%r8
+  8009c0:	41 ff d0             	call   *%r8
+	if (r != strlen(msg))
+  8009c3:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  8009ca:	00 00 00 
+  8009cd:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8009d1:	48 89 c7             	mov    %rax,%rdi
+  8009d4:	49 89 df             	mov    %rbx,%r15
+  8009d7:	48 b8 27 91 ff ff ff 	movabs $0xffffffffffff9127,%rax
+  8009de:	ff ff ff 
+  8009e1:	48 01 d8             	add    %rbx,%rax
+  8009e4:	ff d0                	call   *%rax
+  8009e6:	48 98                	cltq
+  8009e8:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  8009ec:	74 46                	je     800a34 <umain+0x914>
+		panic("file_read after file_write returned wrong length: %d", r);
+  8009ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8009f2:	48 89 c1             	mov    %rax,%rcx
+  8009f5:	48 b8 38 e0 ff ff ff 	movabs $0xffffffffffffe038,%rax
+  8009fc:	ff ff ff 
+  8009ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a03:	48 89 c2             	mov    %rax,%rdx
+  800a06:	be 54 00 00 00       	mov    $0x54,%esi
+  800a0b:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800a12:	ff ff ff 
+  800a15:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a19:	48 89 c7             	mov    %rax,%rdi
+  800a1c:	49 89 df             	mov    %rbx,%r15
+  800a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a24:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  800a2b:	ff ff ff 
+  800a2e:	49 01 d8             	add    %rbx,%r8
+  800a31:	41 ff d0             	call   *%r8
+	if (strcmp(buf, msg) != 0)
+  800a34:	48 b8 20 00 00 00 00 	movabs $0x20,%rax
+  800a3b:	00 00 00 
+  800a3e:	48 8b 14 03          	mov    (%rbx,%rax,1),%rdx
+  800a42:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800a49:	48 89 d6             	mov    %rdx,%rsi
+  800a4c:	48 89 c7             	mov    %rax,%rdi
+  800a4f:	49 89 df             	mov    %rbx,%r15
+  800a52:	48 b8 74 93 ff ff ff 	movabs $0xffffffffffff9374,%rax
+  800a59:	ff ff ff 
+  800a5c:	48 01 d8             	add    %rbx,%rax
+  800a5f:	ff d0                	call   *%rax
+  800a61:	85 c0                	test   %eax,%eax
+  800a63:	74 3e                	je     800aa3 <umain+0x983>
+		panic("file_read after file_write returned wrong data");
+  800a65:	48 b8 70 e0 ff ff ff 	movabs $0xffffffffffffe070,%rax
+  800a6c:	ff ff ff 
+  800a6f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a73:	48 89 c2             	mov    %rax,%rdx
+  800a76:	be 56 00 00 00       	mov    $0x56,%esi
+  800a7b:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800a82:	ff ff ff 
+  800a85:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800a89:	48 89 c7             	mov    %rax,%rdi
+  800a8c:	49 89 df             	mov    %rbx,%r15
+  800a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a94:	48 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%rcx
+  800a9b:	ff ff ff 
+  800a9e:	48 01 d9             	add    %rbx,%rcx
+  800aa1:	ff d1                	call   *%rcx
+	cprintf("file_read after file_write is good\n");
+  800aa3:	48 b8 a0 e0 ff ff ff 	movabs $0xffffffffffffe0a0,%rax
+  800aaa:	ff ff ff 
+  800aad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ab1:	48 89 c7             	mov    %rax,%rdi
+  800ab4:	49 89 df             	mov    %rbx,%r15
+  800ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abc:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  800ac3:	ff ff ff 
+  800ac6:	48 01 da             	add    %rbx,%rdx
+  800ac9:	ff d2                	call   *%rdx
+
+	// Now we'll try out open
+	if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800acb:	be 00 00 00 00       	mov    $0x0,%esi
+  800ad0:	48 b8 ce dd ff ff ff 	movabs $0xffffffffffffddce,%rax
+  800ad7:	ff ff ff 
+  800ada:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ade:	48 89 c7             	mov    %rax,%rdi
+  800ae1:	49 89 df             	mov    %rbx,%r15
+  800ae4:	48 b8 32 bc ff ff ff 	movabs $0xffffffffffffbc32,%rax
+  800aeb:	ff ff ff 
+  800aee:	48 01 d8             	add    %rbx,%rax
+  800af1:	ff d0                	call   *%rax
+  800af3:	48 98                	cltq
+  800af5:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800af9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800afe:	79 4d                	jns    800b4d <umain+0xa2d>
+  800b00:	48 83 7d d0 f4       	cmpq   $0xfffffffffffffff4,-0x30(%rbp)
+  800b05:	74 46                	je     800b4d <umain+0xa2d>
+		panic("open /not-found: %e", r);
+  800b07:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b0b:	48 89 c1             	mov    %rax,%rcx
+  800b0e:	48 b8 c4 e0 ff ff ff 	movabs $0xffffffffffffe0c4,%rax
+  800b15:	ff ff ff 
+  800b18:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b1c:	48 89 c2             	mov    %rax,%rdx
+  800b1f:	be 5b 00 00 00       	mov    $0x5b,%esi
+  800b24:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800b2b:	ff ff ff 
+  800b2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b32:	48 89 c7             	mov    %rax,%rdi
+  800b35:	49 89 df             	mov    %rbx,%r15
+  800b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3d:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  800b44:	ff ff ff 
+  800b47:	49 01 d8             	add    %rbx,%r8
+  800b4a:	41 ff d0             	call   *%r8
+	else if (r >= 0)
+  800b4d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800b52:	78 3e                	js     800b92 <umain+0xa72>
+		panic("open /not-found succeeded!");
+  800b54:	48 b8 d8 e0 ff ff ff 	movabs $0xffffffffffffe0d8,%rax
+  800b5b:	ff ff ff 
+  800b5e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b62:	48 89 c2             	mov    %rax,%rdx
+  800b65:	be 5d 00 00 00       	mov    $0x5d,%esi
+  800b6a:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800b71:	ff ff ff 
+  800b74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800b78:	48 89 c7             	mov    %rax,%rdi
+  800b7b:	49 89 df             	mov    %rbx,%r15
+  800b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b83:	48 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%rcx
+  800b8a:	ff ff ff 
+  800b8d:	48 01 d9             	add    %rbx,%rcx
+  800b90:	ff d1                	call   *%rcx
+
+	if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800b92:	be 00 00 00 00       	mov    $0x0,%esi
+  800b97:	48 b8 29 de ff ff ff 	movabs $0xffffffffffffde29,%rax
+  800b9e:	ff ff ff 
+  800ba1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800ba5:	48 89 c7             	mov    %rax,%rdi
+  800ba8:	49 89 df             	mov    %rbx,%r15
+  800bab:	48 b8 32 bc ff ff ff 	movabs $0xffffffffffffbc32,%rax
+  800bb2:	ff ff ff 
+  800bb5:	48 01 d8             	add    %rbx,%rax
+  800bb8:	ff d0                	call   *%rax
+  800bba:	48 98                	cltq
+  800bbc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800bc0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800bc5:	79 46                	jns    800c0d <umain+0xaed>
+		panic("open /newmotd: %e", r);
+  800bc7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bcb:	48 89 c1             	mov    %rax,%rcx
+  800bce:	48 b8 f3 e0 ff ff ff 	movabs $0xffffffffffffe0f3,%rax
+  800bd5:	ff ff ff 
+  800bd8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800bdc:	48 89 c2             	mov    %rax,%rdx
+  800bdf:	be 60 00 00 00       	mov    $0x60,%esi
+  800be4:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800beb:	ff ff ff 
+  800bee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800bf2:	48 89 c7             	mov    %rax,%rdi
+  800bf5:	49 89 df             	mov    %rbx,%r15
+  800bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfd:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  800c04:	ff ff ff 
+  800c07:	49 01 d8             	add    %rbx,%r8
+  800c0a:	41 ff d0             	call   *%r8
+	fd = (struct Fd*) (0xD0000000 + r*PGSIZE);
+  800c0d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c11:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800c17:	48 c1 e0 0c          	shl    $0xc,%rax
+  800c1b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800c1f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c23:	8b 00                	mov    (%rax),%eax
+  800c25:	83 f8 66             	cmp    $0x66,%eax
+  800c28:	75 16                	jne    800c40 <umain+0xb20>
+  800c2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c2e:	8b 40 04             	mov    0x4(%rax),%eax
+  800c31:	85 c0                	test   %eax,%eax
+  800c33:	75 0b                	jne    800c40 <umain+0xb20>
+  800c35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c39:	8b 40 08             	mov    0x8(%rax),%eax
+  800c3c:	85 c0                	test   %eax,%eax
+  800c3e:	74 3e                	je     800c7e <umain+0xb5e>
+		panic("open did not fill struct Fd correctly\n");
+  800c40:	48 b8 08 e1 ff ff ff 	movabs $0xffffffffffffe108,%rax
+  800c47:	ff ff ff 
+  800c4a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c4e:	48 89 c2             	mov    %rax,%rdx
+  800c51:	be 63 00 00 00       	mov    $0x63,%esi
+  800c56:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800c5d:	ff ff ff 
+  800c60:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c64:	48 89 c7             	mov    %rax,%rdi
+  800c67:	49 89 df             	mov    %rbx,%r15
+  800c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6f:	48 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%rcx
+  800c76:	ff ff ff 
+  800c79:	48 01 d9             	add    %rbx,%rcx
+  800c7c:	ff d1                	call   *%rcx
+	cprintf("open is good\n");
+  800c7e:	48 b8 2f e1 ff ff ff 	movabs $0xffffffffffffe12f,%rax
+  800c85:	ff ff ff 
+  800c88:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800c8c:	48 89 c7             	mov    %rax,%rdi
+  800c8f:	49 89 df             	mov    %rbx,%r15
+  800c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c97:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  800c9e:	ff ff ff 
+  800ca1:	48 01 da             	add    %rbx,%rdx
+  800ca4:	ff d2                	call   *%rdx
+
+	// Try files with indirect blocks
+	if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
+  800ca6:	be 01 01 00 00       	mov    $0x101,%esi
+  800cab:	48 b8 3d e1 ff ff ff 	movabs $0xffffffffffffe13d,%rax
+  800cb2:	ff ff ff 
+  800cb5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800cb9:	48 89 c7             	mov    %rax,%rdi
+  800cbc:	49 89 df             	mov    %rbx,%r15
+  800cbf:	48 b8 32 bc ff ff ff 	movabs $0xffffffffffffbc32,%rax
+  800cc6:	ff ff ff 
+  800cc9:	48 01 d8             	add    %rbx,%rax
+  800ccc:	ff d0                	call   *%rax
+  800cce:	48 98                	cltq
+  800cd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd4:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800cd9:	79 46                	jns    800d21 <umain+0xc01>
+		panic("creat /big: %e", f);
+  800cdb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800cdf:	48 89 c1             	mov    %rax,%rcx
+  800ce2:	48 b8 42 e1 ff ff ff 	movabs $0xffffffffffffe142,%rax
+  800ce9:	ff ff ff 
+  800cec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800cf0:	48 89 c2             	mov    %rax,%rdx
+  800cf3:	be 68 00 00 00       	mov    $0x68,%esi
+  800cf8:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800cff:	ff ff ff 
+  800d02:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800d06:	48 89 c7             	mov    %rax,%rdi
+  800d09:	49 89 df             	mov    %rbx,%r15
+  800d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d11:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  800d18:	ff ff ff 
+  800d1b:	49 01 d8             	add    %rbx,%r8
+  800d1e:	41 ff d0             	call   *%r8
+	memset(buf, 0, sizeof(buf));
+  800d21:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800d28:	ba 00 02 00 00       	mov    $0x200,%edx
+  800d2d:	be 00 00 00 00       	mov    $0x0,%esi
+  800d32:	48 89 c7             	mov    %rax,%rdi
+  800d35:	49 89 df             	mov    %rbx,%r15
+  800d38:	48 b8 fc 94 ff ff ff 	movabs $0xffffffffffff94fc,%rax
+  800d3f:	ff ff ff 
+  800d42:	48 01 d8             	add    %rbx,%rax
+  800d45:	ff d0                	call   *%rax
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  800d47:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800d4e:	00 
+  800d4f:	e9 9e 00 00 00       	jmp    800df2 <umain+0xcd2>
+		*(int*)buf = i;
+  800d54:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800d5b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800d5f:	89 10                	mov    %edx,(%rax)
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  800d61:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d65:	89 c1                	mov    %eax,%ecx
+  800d67:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800d6e:	ba 00 02 00 00       	mov    $0x200,%edx
+  800d73:	48 89 c6             	mov    %rax,%rsi
+  800d76:	89 cf                	mov    %ecx,%edi
+  800d78:	49 89 df             	mov    %rbx,%r15
+  800d7b:	48 b8 09 b6 ff ff ff 	movabs $0xffffffffffffb609,%rax
+  800d82:	ff ff ff 
+  800d85:	48 01 d8             	add    %rbx,%rax
+  800d88:	ff d0                	call   *%rax
+  800d8a:	48 98                	cltq
+  800d8c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800d90:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800d95:	79 4d                	jns    800de4 <umain+0xcc4>
+			panic("write /big@%d: %e", i, r);
+  800d97:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800d9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800d9f:	49 89 d0             	mov    %rdx,%r8
+  800da2:	48 89 c1             	mov    %rax,%rcx
+  800da5:	48 b8 51 e1 ff ff ff 	movabs $0xffffffffffffe151,%rax
+  800dac:	ff ff ff 
+  800daf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800db3:	48 89 c2             	mov    %rax,%rdx
+  800db6:	be 6d 00 00 00       	mov    $0x6d,%esi
+  800dbb:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800dc2:	ff ff ff 
+  800dc5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800dc9:	48 89 c7             	mov    %rax,%rdi
+  800dcc:	49 89 df             	mov    %rbx,%r15
+  800dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd4:	49 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r9
+  800ddb:	ff ff ff 
+  800dde:	49 01 d9             	add    %rbx,%r9
+  800de1:	41 ff d1             	call   *%r9
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  800de4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800de8:	48 05 00 02 00 00    	add    $0x200,%rax
+  800dee:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800df2:	48 81 7d d8 ff df 01 	cmpq   $0x1dfff,-0x28(%rbp)
+  800df9:	00 
+  800dfa:	0f 8e 54 ff ff ff    	jle    800d54 <umain+0xc34>
+	}
+	close(f);
+  800e00:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e04:	89 c7                	mov    %eax,%edi
+  800e06:	49 89 df             	mov    %rbx,%r15
+  800e09:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  800e10:	ff ff ff 
+  800e13:	48 01 d8             	add    %rbx,%rax
+  800e16:	ff d0                	call   *%rax
+
+	if ((f = open("/big", O_RDONLY)) < 0)
+  800e18:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1d:	48 b8 3d e1 ff ff ff 	movabs $0xffffffffffffe13d,%rax
+  800e24:	ff ff ff 
+  800e27:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e2b:	48 89 c7             	mov    %rax,%rdi
+  800e2e:	49 89 df             	mov    %rbx,%r15
+  800e31:	48 b8 32 bc ff ff ff 	movabs $0xffffffffffffbc32,%rax
+  800e38:	ff ff ff 
+  800e3b:	48 01 d8             	add    %rbx,%rax
+  800e3e:	ff d0                	call   *%rax
+  800e40:	48 98                	cltq
+  800e42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e46:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e4b:	79 46                	jns    800e93 <umain+0xd73>
+		panic("open /big: %e", f);
+  800e4d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e51:	48 89 c1             	mov    %rax,%rcx
+  800e54:	48 b8 63 e1 ff ff ff 	movabs $0xffffffffffffe163,%rax
+  800e5b:	ff ff ff 
+  800e5e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e62:	48 89 c2             	mov    %rax,%rdx
+  800e65:	be 72 00 00 00       	mov    $0x72,%esi
+  800e6a:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800e71:	ff ff ff 
+  800e74:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800e78:	48 89 c7             	mov    %rax,%rdi
+  800e7b:	49 89 df             	mov    %rbx,%r15
+  800e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e83:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  800e8a:	ff ff ff 
+  800e8d:	49 01 d8             	add    %rbx,%r8
+  800e90:	41 ff d0             	call   *%r8
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  800e93:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  800e9a:	00 
+  800e9b:	e9 5e 01 00 00       	jmp    800ffe <umain+0xede>
+		*(int*)buf = i;
+  800ea0:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800ea7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800eab:	89 10                	mov    %edx,(%rax)
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800ead:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800eb1:	89 c1                	mov    %eax,%ecx
+  800eb3:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800eba:	ba 00 02 00 00       	mov    $0x200,%edx
+  800ebf:	48 89 c6             	mov    %rax,%rsi
+  800ec2:	89 cf                	mov    %ecx,%edi
+  800ec4:	49 89 df             	mov    %rbx,%r15
+  800ec7:	48 b8 76 b5 ff ff ff 	movabs $0xffffffffffffb576,%rax
+  800ece:	ff ff ff 
+  800ed1:	48 01 d8             	add    %rbx,%rax
+  800ed4:	ff d0                	call   *%rax
+  800ed6:	48 98                	cltq
+  800ed8:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  800edc:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800ee1:	79 4d                	jns    800f30 <umain+0xe10>
+			panic("read /big@%d: %e", i, r);
+  800ee3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800ee7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800eeb:	49 89 d0             	mov    %rdx,%r8
+  800eee:	48 89 c1             	mov    %rax,%rcx
+  800ef1:	48 b8 71 e1 ff ff ff 	movabs $0xffffffffffffe171,%rax
+  800ef8:	ff ff ff 
+  800efb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800eff:	48 89 c2             	mov    %rax,%rdx
+  800f02:	be 76 00 00 00       	mov    $0x76,%esi
+  800f07:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800f0e:	ff ff ff 
+  800f11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f15:	48 89 c7             	mov    %rax,%rdi
+  800f18:	49 89 df             	mov    %rbx,%r15
+  800f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f20:	49 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r9
+  800f27:	ff ff ff 
+  800f2a:	49 01 d9             	add    %rbx,%r9
+  800f2d:	41 ff d1             	call   *%r9
+		if (r != sizeof(buf))
+  800f30:	48 81 7d d0 00 02 00 	cmpq   $0x200,-0x30(%rbp)
+  800f37:	00 
+  800f38:	74 53                	je     800f8d <umain+0xe6d>
+			panic("read /big from %d returned %d < %d bytes",
+  800f3a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800f3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f42:	41 b9 00 02 00 00    	mov    $0x200,%r9d
+  800f48:	49 89 d0             	mov    %rdx,%r8
+  800f4b:	48 89 c1             	mov    %rax,%rcx
+  800f4e:	48 b8 88 e1 ff ff ff 	movabs $0xffffffffffffe188,%rax
+  800f55:	ff ff ff 
+  800f58:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f5c:	48 89 c2             	mov    %rax,%rdx
+  800f5f:	be 78 00 00 00       	mov    $0x78,%esi
+  800f64:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800f6b:	ff ff ff 
+  800f6e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800f72:	48 89 c7             	mov    %rax,%rdi
+  800f75:	49 89 df             	mov    %rbx,%r15
+  800f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f7d:	49 ba 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r10
+  800f84:	ff ff ff 
+  800f87:	49 01 da             	add    %rbx,%r10
+  800f8a:	41 ff d2             	call   *%r10
+			      i, r, sizeof(buf));
+		if (*(int*)buf != i)
+  800f8d:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800f94:	8b 00                	mov    (%rax),%eax
+  800f96:	48 98                	cltq
+  800f98:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800f9c:	74 52                	je     800ff0 <umain+0xed0>
+			panic("read /big from %d returned bad data %d",
+  800f9e:	48 8d 85 20 fd ff ff 	lea    -0x2e0(%rbp),%rax
+  800fa5:	8b 10                	mov    (%rax),%edx
+  800fa7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fab:	41 89 d0             	mov    %edx,%r8d
+  800fae:	48 89 c1             	mov    %rax,%rcx
+  800fb1:	48 b8 b8 e1 ff ff ff 	movabs $0xffffffffffffe1b8,%rax
+  800fb8:	ff ff ff 
+  800fbb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fbf:	48 89 c2             	mov    %rax,%rdx
+  800fc2:	be 7b 00 00 00       	mov    $0x7b,%esi
+  800fc7:	48 b8 f3 dd ff ff ff 	movabs $0xffffffffffffddf3,%rax
+  800fce:	ff ff ff 
+  800fd1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800fd5:	48 89 c7             	mov    %rax,%rdi
+  800fd8:	49 89 df             	mov    %rbx,%r15
+  800fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe0:	49 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r9
+  800fe7:	ff ff ff 
+  800fea:	49 01 d9             	add    %rbx,%r9
+  800fed:	41 ff d1             	call   *%r9
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  800ff0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ff4:	48 05 00 02 00 00    	add    $0x200,%rax
+  800ffa:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800ffe:	48 81 7d d8 ff df 01 	cmpq   $0x1dfff,-0x28(%rbp)
+  801005:	00 
+  801006:	0f 8e 94 fe ff ff    	jle    800ea0 <umain+0xd80>
+			      i, *(int*)buf);
+	}
+	close(f);
+  80100c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801010:	89 c7                	mov    %eax,%edi
+  801012:	49 89 df             	mov    %rbx,%r15
+  801015:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  80101c:	ff ff ff 
+  80101f:	48 01 d8             	add    %rbx,%rax
+  801022:	ff d0                	call   *%rax
+	cprintf("large file is good\n");
+  801024:	48 b8 df e1 ff ff ff 	movabs $0xffffffffffffe1df,%rax
+  80102b:	ff ff ff 
+  80102e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801032:	48 89 c7             	mov    %rax,%rdi
+  801035:	49 89 df             	mov    %rbx,%r15
+  801038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103d:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  801044:	ff ff ff 
+  801047:	48 01 da             	add    %rbx,%rdx
+  80104a:	ff d2                	call   *%rdx
+}
+  80104c:	90                   	nop
+  80104d:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  801051:	5b                   	pop    %rbx
+  801052:	41 5c                	pop    %r12
+  801054:	41 5f                	pop    %r15
+  801056:	5d                   	pop    %rbp
+  801057:	c3                   	ret
+
+0000000000801058 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  801058:	55                   	push   %rbp
+  801059:	48 89 e5             	mov    %rsp,%rbp
+  80105c:	41 57                	push   %r15
+  80105e:	53                   	push   %rbx
+  80105f:	48 83 ec 20          	sub    $0x20,%rsp
+  801063:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801063 <libmain+0xb>
+  80106a:	49 bb dd 7f 00 00 00 	movabs $0x7fdd,%r11
+  801071:	00 00 00 
+  801074:	4c 01 db             	add    %r11,%rbx
+  801077:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80107a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  80107e:	49 89 df             	mov    %rbx,%r15
+  801081:	48 b8 ce 9d ff ff ff 	movabs $0xffffffffffff9dce,%rax
+  801088:	ff ff ff 
+  80108b:	48 01 d8             	add    %rbx,%rax
+  80108e:	ff d0                	call   *%rax
+  801090:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  801093:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801096:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80109b:	48 98                	cltq
+  80109d:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8010a4:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8010ab:	ff ff ff 
+  8010ae:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8010b2:	48 01 c2             	add    %rax,%rdx
+  8010b5:	48 b8 c8 1f 01 00 00 	movabs $0x11fc8,%rax
+  8010bc:	00 00 00 
+  8010bf:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8010c3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8010c7:	7e 15                	jle    8010de <libmain+0x86>
+		binaryname = argv[0];
+  8010c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010cd:	48 8b 00             	mov    (%rax),%rax
+  8010d0:	48 ba 28 00 00 00 00 	movabs $0x28,%rdx
+  8010d7:	00 00 00 
+  8010da:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8010de:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8010e2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8010e5:	48 89 d6             	mov    %rdx,%rsi
+  8010e8:	89 c7                	mov    %eax,%edi
+  8010ea:	49 89 df             	mov    %rbx,%r15
+  8010ed:	48 b8 e0 70 ff ff ff 	movabs $0xffffffffffff70e0,%rax
+  8010f4:	ff ff ff 
+  8010f7:	48 01 d8             	add    %rbx,%rax
+  8010fa:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8010fc:	49 89 df             	mov    %rbx,%r15
+  8010ff:	48 b8 d8 80 ff ff ff 	movabs $0xffffffffffff80d8,%rax
+  801106:	ff ff ff 
+  801109:	48 01 d8             	add    %rbx,%rax
+  80110c:	ff d0                	call   *%rax
+}
+  80110e:	90                   	nop
+  80110f:	48 83 c4 20          	add    $0x20,%rsp
+  801113:	5b                   	pop    %rbx
+  801114:	41 5f                	pop    %r15
+  801116:	5d                   	pop    %rbp
+  801117:	c3                   	ret
+
+0000000000801118 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  801118:	55                   	push   %rbp
+  801119:	48 89 e5             	mov    %rsp,%rbp
+  80111c:	41 57                	push   %r15
+  80111e:	53                   	push   %rbx
+  80111f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80111f <exit+0x7>
+  801126:	49 bb 21 7f 00 00 00 	movabs $0x7f21,%r11
+  80112d:	00 00 00 
+  801130:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  801133:	49 89 df             	mov    %rbx,%r15
+  801136:	48 b8 17 b2 ff ff ff 	movabs $0xffffffffffffb217,%rax
+  80113d:	ff ff ff 
+  801140:	48 01 d8             	add    %rbx,%rax
+  801143:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  801145:	bf 00 00 00 00       	mov    $0x0,%edi
+  80114a:	49 89 df             	mov    %rbx,%r15
+  80114d:	48 b8 72 9d ff ff ff 	movabs $0xffffffffffff9d72,%rax
+  801154:	ff ff ff 
+  801157:	48 01 d8             	add    %rbx,%rax
+  80115a:	ff d0                	call   *%rax
+}
+  80115c:	90                   	nop
+  80115d:	5b                   	pop    %rbx
+  80115e:	41 5f                	pop    %r15
+  801160:	5d                   	pop    %rbp
+  801161:	c3                   	ret
+
+0000000000801162 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  801162:	55                   	push   %rbp
+  801163:	48 89 e5             	mov    %rsp,%rbp
+  801166:	41 57                	push   %r15
+  801168:	41 54                	push   %r12
+  80116a:	53                   	push   %rbx
+  80116b:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  801172:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801172 <_panic+0x10>
+  801179:	49 bb ce 7e 00 00 00 	movabs $0x7ece,%r11
+  801180:	00 00 00 
+  801183:	4c 01 db             	add    %r11,%rbx
+  801186:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80118d:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801193:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80119a:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8011a1:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8011a8:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8011af:	84 c0                	test   %al,%al
+  8011b1:	74 26                	je     8011d9 <_panic+0x77>
+  8011b3:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8011ba:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8011c1:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8011c5:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8011c9:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8011cd:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8011d1:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8011d5:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8011d9:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8011e0:	00 00 00 
+  8011e3:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8011ea:	00 00 00 
+  8011ed:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011f1:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8011f8:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8011ff:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  801206:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  80120d:	ff ff ff 
+  801210:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  801214:	4c 8b 20             	mov    (%rax),%r12
+  801217:	49 89 df             	mov    %rbx,%r15
+  80121a:	48 b8 ce 9d ff ff ff 	movabs $0xffffffffffff9dce,%rax
+  801221:	ff ff ff 
+  801224:	48 01 d8             	add    %rbx,%rax
+  801227:	ff d0                	call   *%rax
+  801229:	89 c6                	mov    %eax,%esi
+  80122b:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  801231:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801238:	41 89 d0             	mov    %edx,%r8d
+  80123b:	48 89 c1             	mov    %rax,%rcx
+  80123e:	4c 89 e2             	mov    %r12,%rdx
+  801241:	48 b8 00 e2 ff ff ff 	movabs $0xffffffffffffe200,%rax
+  801248:	ff ff ff 
+  80124b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80124f:	48 89 c7             	mov    %rax,%rdi
+  801252:	49 89 df             	mov    %rbx,%r15
+  801255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80125a:	49 b9 f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%r9
+  801261:	ff ff ff 
+  801264:	49 01 d9             	add    %rbx,%r9
+  801267:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80126a:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  801271:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  801278:	48 89 d6             	mov    %rdx,%rsi
+  80127b:	48 89 c7             	mov    %rax,%rdi
+  80127e:	49 89 df             	mov    %rbx,%r15
+  801281:	48 b8 19 83 ff ff ff 	movabs $0xffffffffffff8319,%rax
+  801288:	ff ff ff 
+  80128b:	48 01 d8             	add    %rbx,%rax
+  80128e:	ff d0                	call   *%rax
+	cprintf("\n");
+  801290:	48 b8 23 e2 ff ff ff 	movabs $0xffffffffffffe223,%rax
+  801297:	ff ff ff 
+  80129a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80129e:	48 89 c7             	mov    %rax,%rdi
+  8012a1:	49 89 df             	mov    %rbx,%r15
+  8012a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a9:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  8012b0:	ff ff ff 
+  8012b3:	48 01 da             	add    %rbx,%rdx
+  8012b6:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8012b8:	cc                   	int3
+  8012b9:	eb fd                	jmp    8012b8 <_panic+0x156>
+
+00000000008012bb <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8012bb:	55                   	push   %rbp
+  8012bc:	48 89 e5             	mov    %rsp,%rbp
+  8012bf:	41 57                	push   %r15
+  8012c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8012c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012c5 <putch+0xa>
+  8012cc:	49 bb 7b 7d 00 00 00 	movabs $0x7d7b,%r11
+  8012d3:	00 00 00 
+  8012d6:	4c 01 d8             	add    %r11,%rax
+  8012d9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8012dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8012e0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012e4:	8b 12                	mov    (%rdx),%edx
+  8012e6:	8d 72 01             	lea    0x1(%rdx),%esi
+  8012e9:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8012ed:	89 31                	mov    %esi,(%rcx)
+  8012ef:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8012f2:	89 ce                	mov    %ecx,%esi
+  8012f4:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8012f8:	48 63 d2             	movslq %edx,%rdx
+  8012fb:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  801300:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801304:	8b 12                	mov    (%rdx),%edx
+  801306:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80130c:	75 33                	jne    801341 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80130e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801312:	8b 12                	mov    (%rdx),%edx
+  801314:	48 63 d2             	movslq %edx,%rdx
+  801317:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80131b:	48 83 c1 08          	add    $0x8,%rcx
+  80131f:	48 89 d6             	mov    %rdx,%rsi
+  801322:	48 89 cf             	mov    %rcx,%rdi
+  801325:	49 89 c7             	mov    %rax,%r15
+  801328:	48 ba bf 9c ff ff ff 	movabs $0xffffffffffff9cbf,%rdx
+  80132f:	ff ff ff 
+  801332:	48 01 c2             	add    %rax,%rdx
+  801335:	ff d2                	call   *%rdx
+        b->idx = 0;
+  801337:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80133b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  801341:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801345:	8b 40 04             	mov    0x4(%rax),%eax
+  801348:	8d 50 01             	lea    0x1(%rax),%edx
+  80134b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80134f:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  801352:	90                   	nop
+  801353:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  801357:	c9                   	leave
+  801358:	c3                   	ret
+
+0000000000801359 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  801359:	55                   	push   %rbp
+  80135a:	48 89 e5             	mov    %rsp,%rbp
+  80135d:	41 57                	push   %r15
+  80135f:	53                   	push   %rbx
+  801360:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  801367:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801367 <vcprintf+0xe>
+  80136e:	49 bb d9 7c 00 00 00 	movabs $0x7cd9,%r11
+  801375:	00 00 00 
+  801378:	4c 01 db             	add    %r11,%rbx
+  80137b:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  801382:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  801389:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  801390:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  801397:	48 8b 06             	mov    (%rsi),%rax
+  80139a:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80139e:	48 89 01             	mov    %rax,(%rcx)
+  8013a1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8013a5:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8013a9:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8013ad:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8013b4:	00 00 00 
+    b.cnt = 0;
+  8013b7:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8013be:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8013c1:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8013c8:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8013cf:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8013d6:	48 89 c6             	mov    %rax,%rsi
+  8013d9:	48 b8 7b 82 ff ff ff 	movabs $0xffffffffffff827b,%rax
+  8013e0:	ff ff ff 
+  8013e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8013e7:	48 89 c7             	mov    %rax,%rdi
+  8013ea:	49 89 df             	mov    %rbx,%r15
+  8013ed:	48 b8 3d 88 ff ff ff 	movabs $0xffffffffffff883d,%rax
+  8013f4:	ff ff ff 
+  8013f7:	48 01 d8             	add    %rbx,%rax
+  8013fa:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8013fc:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  801402:	48 98                	cltq
+  801404:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  80140b:	48 83 c2 08          	add    $0x8,%rdx
+  80140f:	48 89 c6             	mov    %rax,%rsi
+  801412:	48 89 d7             	mov    %rdx,%rdi
+  801415:	49 89 df             	mov    %rbx,%r15
+  801418:	48 b8 bf 9c ff ff ff 	movabs $0xffffffffffff9cbf,%rax
+  80141f:	ff ff ff 
+  801422:	48 01 d8             	add    %rbx,%rax
+  801425:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  801427:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  80142d:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  801434:	5b                   	pop    %rbx
+  801435:	41 5f                	pop    %r15
+  801437:	5d                   	pop    %rbp
+  801438:	c3                   	ret
+
+0000000000801439 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  801439:	55                   	push   %rbp
+  80143a:	48 89 e5             	mov    %rsp,%rbp
+  80143d:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  801444:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801444 <cprintf+0xb>
+  80144b:	49 bb fc 7b 00 00 00 	movabs $0x7bfc,%r11
+  801452:	00 00 00 
+  801455:	4d 01 da             	add    %r11,%r10
+  801458:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  80145f:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  801466:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80146d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801474:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80147b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801482:	84 c0                	test   %al,%al
+  801484:	74 20                	je     8014a6 <cprintf+0x6d>
+  801486:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80148a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80148e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801492:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801496:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80149a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80149e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8014a2:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8014a6:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8014ad:	00 00 00 
+  8014b0:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8014b7:	00 00 00 
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8014c5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8014cc:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8014d3:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8014da:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8014e1:	48 8b 06             	mov    (%rsi),%rax
+  8014e4:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8014e8:	48 89 01             	mov    %rax,(%rcx)
+  8014eb:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8014ef:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8014f3:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8014f7:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8014fe:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  801505:	48 89 d6             	mov    %rdx,%rsi
+  801508:	48 89 c7             	mov    %rax,%rdi
+  80150b:	48 b8 19 83 ff ff ff 	movabs $0xffffffffffff8319,%rax
+  801512:	ff ff ff 
+  801515:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801519:	ff d0                	call   *%rax
+  80151b:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  801521:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+
+0000000000801529 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  801529:	55                   	push   %rbp
+  80152a:	48 89 e5             	mov    %rsp,%rbp
+  80152d:	53                   	push   %rbx
+  80152e:	48 83 ec 38          	sub    $0x38,%rsp
+  801532:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801532 <printnum+0x9>
+  801539:	49 bb 0e 7b 00 00 00 	movabs $0x7b0e,%r11
+  801540:	00 00 00 
+  801543:	4c 01 db             	add    %r11,%rbx
+  801546:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80154a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80154e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801552:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  801555:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  801559:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80155d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801560:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  801564:	72 58                	jb     8015be <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  801566:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  801569:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80156c:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  80156f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801573:	ba 00 00 00 00       	mov    $0x0,%edx
+  801578:	48 f7 f6             	div    %rsi
+  80157b:	49 89 c2             	mov    %rax,%r10
+  80157e:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  801581:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801584:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  801588:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80158c:	41 89 c9             	mov    %ecx,%r9d
+  80158f:	41 89 f8             	mov    %edi,%r8d
+  801592:	89 d1                	mov    %edx,%ecx
+  801594:	4c 89 d2             	mov    %r10,%rdx
+  801597:	48 89 c7             	mov    %rax,%rdi
+  80159a:	48 b8 e9 84 ff ff ff 	movabs $0xffffffffffff84e9,%rax
+  8015a1:	ff ff ff 
+  8015a4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015a8:	ff d0                	call   *%rax
+  8015aa:	eb 1c                	jmp    8015c8 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8015ac:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015b0:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8015b3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015b7:	48 89 d6             	mov    %rdx,%rsi
+  8015ba:	89 c7                	mov    %eax,%edi
+  8015bc:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8015be:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8015c2:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8015c6:	7f e4                	jg     8015ac <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8015c8:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8015cb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d4:	48 f7 f1             	div    %rcx
+  8015d7:	48 b8 5f e3 ff ff ff 	movabs $0xffffffffffffe35f,%rax
+  8015de:	ff ff ff 
+  8015e1:	48 01 d8             	add    %rbx,%rax
+  8015e4:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8015e8:	0f be c0             	movsbl %al,%eax
+  8015eb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015ef:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8015f3:	48 89 d6             	mov    %rdx,%rsi
+  8015f6:	89 c7                	mov    %eax,%edi
+  8015f8:	ff d1                	call   *%rcx
+}
+  8015fa:	90                   	nop
+  8015fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015ff:	c9                   	leave
+  801600:	c3                   	ret
+
+0000000000801601 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  801601:	55                   	push   %rbp
+  801602:	48 89 e5             	mov    %rsp,%rbp
+  801605:	48 83 ec 20          	sub    $0x20,%rsp
+  801609:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801609 <getuint+0x8>
+  801610:	49 bb 37 7a 00 00 00 	movabs $0x7a37,%r11
+  801617:	00 00 00 
+  80161a:	4c 01 d8             	add    %r11,%rax
+  80161d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801621:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  801624:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801628:	7e 4f                	jle    801679 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  80162a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80162e:	8b 00                	mov    (%rax),%eax
+  801630:	83 f8 2f             	cmp    $0x2f,%eax
+  801633:	77 24                	ja     801659 <getuint+0x58>
+  801635:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801639:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80163d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801641:	8b 00                	mov    (%rax),%eax
+  801643:	89 c0                	mov    %eax,%eax
+  801645:	48 01 d0             	add    %rdx,%rax
+  801648:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80164c:	8b 12                	mov    (%rdx),%edx
+  80164e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801651:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801655:	89 0a                	mov    %ecx,(%rdx)
+  801657:	eb 14                	jmp    80166d <getuint+0x6c>
+  801659:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80165d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801661:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801665:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801669:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80166d:	48 8b 00             	mov    (%rax),%rax
+  801670:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801674:	e9 9d 00 00 00       	jmp    801716 <getuint+0x115>
+	else if (lflag)
+  801679:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80167d:	74 4c                	je     8016cb <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  80167f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801683:	8b 00                	mov    (%rax),%eax
+  801685:	83 f8 2f             	cmp    $0x2f,%eax
+  801688:	77 24                	ja     8016ae <getuint+0xad>
+  80168a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80168e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801692:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801696:	8b 00                	mov    (%rax),%eax
+  801698:	89 c0                	mov    %eax,%eax
+  80169a:	48 01 d0             	add    %rdx,%rax
+  80169d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016a1:	8b 12                	mov    (%rdx),%edx
+  8016a3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8016a6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016aa:	89 0a                	mov    %ecx,(%rdx)
+  8016ac:	eb 14                	jmp    8016c2 <getuint+0xc1>
+  8016ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016b2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8016b6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8016ba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016be:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8016c2:	48 8b 00             	mov    (%rax),%rax
+  8016c5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8016c9:	eb 4b                	jmp    801716 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8016cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016cf:	8b 00                	mov    (%rax),%eax
+  8016d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8016d4:	77 24                	ja     8016fa <getuint+0xf9>
+  8016d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016da:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8016de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e2:	8b 00                	mov    (%rax),%eax
+  8016e4:	89 c0                	mov    %eax,%eax
+  8016e6:	48 01 d0             	add    %rdx,%rax
+  8016e9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016ed:	8b 12                	mov    (%rdx),%edx
+  8016ef:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8016f2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8016f6:	89 0a                	mov    %ecx,(%rdx)
+  8016f8:	eb 14                	jmp    80170e <getuint+0x10d>
+  8016fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016fe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801702:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801706:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80170a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80170e:	8b 00                	mov    (%rax),%eax
+  801710:	89 c0                	mov    %eax,%eax
+  801712:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  801716:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80171a:	c9                   	leave
+  80171b:	c3                   	ret
+
+000000000080171c <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  80171c:	55                   	push   %rbp
+  80171d:	48 89 e5             	mov    %rsp,%rbp
+  801720:	48 83 ec 20          	sub    $0x20,%rsp
+  801724:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801724 <printfloat+0x8>
+  80172b:	49 bb 1c 79 00 00 00 	movabs $0x791c,%r11
+  801732:	00 00 00 
+  801735:	4c 01 d8             	add    %r11,%rax
+  801738:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80173c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801740:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  801744:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801748:	48 85 c0             	test   %rax,%rax
+  80174b:	79 12                	jns    80175f <printfloat+0x43>
+		putch('-',putdat);
+  80174d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801751:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801755:	48 89 c6             	mov    %rax,%rsi
+  801758:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80175d:	ff d2                	call   *%rdx
+	
+}
+  80175f:	90                   	nop
+  801760:	c9                   	leave
+  801761:	c3                   	ret
+
+0000000000801762 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  801762:	55                   	push   %rbp
+  801763:	48 89 e5             	mov    %rsp,%rbp
+  801766:	48 83 ec 20          	sub    $0x20,%rsp
+  80176a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80176a <getint+0x8>
+  801771:	49 bb d6 78 00 00 00 	movabs $0x78d6,%r11
+  801778:	00 00 00 
+  80177b:	4c 01 d8             	add    %r11,%rax
+  80177e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801782:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  801785:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  801789:	7e 4f                	jle    8017da <getint+0x78>
+		x=va_arg(*ap, long long);
+  80178b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80178f:	8b 00                	mov    (%rax),%eax
+  801791:	83 f8 2f             	cmp    $0x2f,%eax
+  801794:	77 24                	ja     8017ba <getint+0x58>
+  801796:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80179a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80179e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017a2:	8b 00                	mov    (%rax),%eax
+  8017a4:	89 c0                	mov    %eax,%eax
+  8017a6:	48 01 d0             	add    %rdx,%rax
+  8017a9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017ad:	8b 12                	mov    (%rdx),%edx
+  8017af:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8017b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017b6:	89 0a                	mov    %ecx,(%rdx)
+  8017b8:	eb 14                	jmp    8017ce <getint+0x6c>
+  8017ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017be:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8017c2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8017c6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017ca:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8017ce:	48 8b 00             	mov    (%rax),%rax
+  8017d1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8017d5:	e9 9d 00 00 00       	jmp    801877 <getint+0x115>
+	else if (lflag)
+  8017da:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8017de:	74 4c                	je     80182c <getint+0xca>
+		x=va_arg(*ap, long);
+  8017e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017e4:	8b 00                	mov    (%rax),%eax
+  8017e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8017e9:	77 24                	ja     80180f <getint+0xad>
+  8017eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017ef:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8017f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f7:	8b 00                	mov    (%rax),%eax
+  8017f9:	89 c0                	mov    %eax,%eax
+  8017fb:	48 01 d0             	add    %rdx,%rax
+  8017fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801802:	8b 12                	mov    (%rdx),%edx
+  801804:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801807:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80180b:	89 0a                	mov    %ecx,(%rdx)
+  80180d:	eb 14                	jmp    801823 <getint+0xc1>
+  80180f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801813:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801817:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80181b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80181f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801823:	48 8b 00             	mov    (%rax),%rax
+  801826:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80182a:	eb 4b                	jmp    801877 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  80182c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801830:	8b 00                	mov    (%rax),%eax
+  801832:	83 f8 2f             	cmp    $0x2f,%eax
+  801835:	77 24                	ja     80185b <getint+0xf9>
+  801837:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80183b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80183f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801843:	8b 00                	mov    (%rax),%eax
+  801845:	89 c0                	mov    %eax,%eax
+  801847:	48 01 d0             	add    %rdx,%rax
+  80184a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80184e:	8b 12                	mov    (%rdx),%edx
+  801850:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801853:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801857:	89 0a                	mov    %ecx,(%rdx)
+  801859:	eb 14                	jmp    80186f <getint+0x10d>
+  80185b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80185f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801863:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801867:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80186b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80186f:	8b 00                	mov    (%rax),%eax
+  801871:	48 98                	cltq
+  801873:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  801877:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80187b:	c9                   	leave
+  80187c:	c3                   	ret
+
+000000000080187d <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  80187d:	55                   	push   %rbp
+  80187e:	48 89 e5             	mov    %rsp,%rbp
+  801881:	41 57                	push   %r15
+  801883:	41 55                	push   %r13
+  801885:	41 54                	push   %r12
+  801887:	53                   	push   %rbx
+  801888:	48 83 ec 60          	sub    $0x60,%rsp
+  80188c:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 80188c <vprintfmt+0xf>
+  801893:	49 bb b4 77 00 00 00 	movabs $0x77b4,%r11
+  80189a:	00 00 00 
+  80189d:	4d 01 dc             	add    %r11,%r12
+  8018a0:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  8018a4:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  8018a8:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8018ac:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  8018b0:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  8018b7:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  8018bb:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  8018bf:	48 8b 06             	mov    (%rsi),%rax
+  8018c2:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8018c6:	48 89 01             	mov    %rax,(%rcx)
+  8018c9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8018cd:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8018d1:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8018d5:	eb 17                	jmp    8018ee <vprintfmt+0x71>
+			if (ch == '\0')
+  8018d7:	85 db                	test   %ebx,%ebx
+  8018d9:	0f 84 97 05 00 00    	je     801e76 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  8018df:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8018e3:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8018e7:	48 89 c6             	mov    %rax,%rsi
+  8018ea:	89 df                	mov    %ebx,%edi
+  8018ec:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8018ee:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8018f2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018f6:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  8018fa:	0f b6 00             	movzbl (%rax),%eax
+  8018fd:	0f b6 d8             	movzbl %al,%ebx
+  801900:	83 fb 25             	cmp    $0x25,%ebx
+  801903:	75 d2                	jne    8018d7 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  801905:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  801909:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  801910:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  801917:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  80191e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  801925:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801929:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80192d:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801931:	0f b6 00             	movzbl (%rax),%eax
+  801934:	0f b6 d8             	movzbl %al,%ebx
+  801937:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80193a:	83 f8 55             	cmp    $0x55,%eax
+  80193d:	0f 87 00 05 00 00    	ja     801e43 <vprintfmt+0x5c6>
+  801943:	89 c0                	mov    %eax,%eax
+  801945:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80194c:	00 
+  80194d:	48 8d 05 74 5a 00 00 	lea    0x5a74(%rip),%rax        # 8073c8 <.LC18+0xc>
+  801954:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  801958:	48 8d 15 69 5a 00 00 	lea    0x5a69(%rip),%rdx        # 8073c8 <.LC18+0xc>
+  80195f:	48 01 d0             	add    %rdx,%rax
+  801962:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  801964:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  801968:	eb bb                	jmp    801925 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  80196a:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  80196e:	eb b5                	jmp    801925 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  801970:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  801977:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80197a:	89 d0                	mov    %edx,%eax
+  80197c:	c1 e0 02             	shl    $0x2,%eax
+  80197f:	01 d0                	add    %edx,%eax
+  801981:	01 c0                	add    %eax,%eax
+  801983:	01 d8                	add    %ebx,%eax
+  801985:	83 e8 30             	sub    $0x30,%eax
+  801988:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  80198b:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  80198f:	0f b6 00             	movzbl (%rax),%eax
+  801992:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  801995:	83 fb 2f             	cmp    $0x2f,%ebx
+  801998:	7e 60                	jle    8019fa <vprintfmt+0x17d>
+  80199a:	83 fb 39             	cmp    $0x39,%ebx
+  80199d:	7f 5b                	jg     8019fa <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  80199f:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  8019a4:	eb d1                	jmp    801977 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  8019a6:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  8019a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8019ac:	77 17                	ja     8019c5 <vprintfmt+0x148>
+  8019ae:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8019b2:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8019b5:	89 d2                	mov    %edx,%edx
+  8019b7:	48 01 d0             	add    %rdx,%rax
+  8019ba:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8019bd:	83 c2 08             	add    $0x8,%edx
+  8019c0:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8019c3:	eb 0c                	jmp    8019d1 <vprintfmt+0x154>
+  8019c5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8019c9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8019cd:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8019d1:	8b 00                	mov    (%rax),%eax
+  8019d3:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  8019d6:	eb 23                	jmp    8019fb <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  8019d8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019dc:	0f 89 43 ff ff ff    	jns    801925 <vprintfmt+0xa8>
+				width = 0;
+  8019e2:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  8019e9:	e9 37 ff ff ff       	jmp    801925 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  8019ee:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  8019f5:	e9 2b ff ff ff       	jmp    801925 <vprintfmt+0xa8>
+			goto process_precision;
+  8019fa:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  8019fb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8019ff:	0f 89 20 ff ff ff    	jns    801925 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  801a05:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801a08:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  801a0b:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  801a12:	e9 0e ff ff ff       	jmp    801925 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  801a17:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  801a1b:	e9 05 ff ff ff       	jmp    801925 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  801a20:	83 fb 39             	cmp    $0x39,%ebx
+  801a23:	7f 0b                	jg     801a30 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  801a25:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  801a28:	c1 e0 08             	shl    $0x8,%eax
+  801a2b:	01 45 bc             	add    %eax,-0x44(%rbp)
+  801a2e:	eb 21                	jmp    801a51 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  801a30:	83 fb 60             	cmp    $0x60,%ebx
+  801a33:	7e 10                	jle    801a45 <vprintfmt+0x1c8>
+  801a35:	83 fb 66             	cmp    $0x66,%ebx
+  801a38:	7f 0b                	jg     801a45 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  801a3a:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  801a3d:	c1 e0 08             	shl    $0x8,%eax
+  801a40:	01 45 bc             	add    %eax,-0x44(%rbp)
+  801a43:	eb 0c                	jmp    801a51 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  801a45:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  801a4c:	e9 04 01 00 00       	jmp    801b55 <vprintfmt+0x2d8>
+  801a51:	e9 ff 00 00 00       	jmp    801b55 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  801a56:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801a59:	83 f8 2f             	cmp    $0x2f,%eax
+  801a5c:	77 17                	ja     801a75 <vprintfmt+0x1f8>
+  801a5e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a62:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801a65:	89 d2                	mov    %edx,%edx
+  801a67:	48 01 d0             	add    %rdx,%rax
+  801a6a:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801a6d:	83 c2 08             	add    $0x8,%edx
+  801a70:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801a73:	eb 0c                	jmp    801a81 <vprintfmt+0x204>
+  801a75:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a79:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801a7d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801a81:	8b 00                	mov    (%rax),%eax
+  801a83:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  801a87:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801a8b:	48 89 d6             	mov    %rdx,%rsi
+  801a8e:	89 c7                	mov    %eax,%edi
+  801a90:	ff d1                	call   *%rcx
+			break;
+  801a92:	e9 da 03 00 00       	jmp    801e71 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  801a97:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801a9a:	83 f8 2f             	cmp    $0x2f,%eax
+  801a9d:	77 17                	ja     801ab6 <vprintfmt+0x239>
+  801a9f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801aa3:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801aa6:	89 d2                	mov    %edx,%edx
+  801aa8:	48 01 d0             	add    %rdx,%rax
+  801aab:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801aae:	83 c2 08             	add    $0x8,%edx
+  801ab1:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801ab4:	eb 0c                	jmp    801ac2 <vprintfmt+0x245>
+  801ab6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801aba:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801abe:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801ac2:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  801ac4:	85 db                	test   %ebx,%ebx
+  801ac6:	79 02                	jns    801aca <vprintfmt+0x24d>
+				err = -err;
+  801ac8:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801aca:	83 fb 15             	cmp    $0x15,%ebx
+  801acd:	7f 19                	jg     801ae8 <vprintfmt+0x26b>
+  801acf:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  801ad6:	00 00 00 
+  801ad9:	48 63 c3             	movslq %ebx,%rax
+  801adc:	4c 01 e2             	add    %r12,%rdx
+  801adf:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  801ae3:	4d 85 ed             	test   %r13,%r13
+  801ae6:	75 36                	jne    801b1e <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  801ae8:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801aec:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801af0:	89 d9                	mov    %ebx,%ecx
+  801af2:	48 ba 70 e3 ff ff ff 	movabs $0xffffffffffffe370,%rdx
+  801af9:	ff ff ff 
+  801afc:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  801b00:	48 89 c7             	mov    %rax,%rdi
+  801b03:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b08:	49 b8 44 8e ff ff ff 	movabs $0xffffffffffff8e44,%r8
+  801b0f:	ff ff ff 
+  801b12:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801b16:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  801b19:	e9 53 03 00 00       	jmp    801e71 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  801b1e:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801b22:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801b26:	4c 89 e9             	mov    %r13,%rcx
+  801b29:	48 ba 79 e3 ff ff ff 	movabs $0xffffffffffffe379,%rdx
+  801b30:	ff ff ff 
+  801b33:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  801b37:	48 89 c7             	mov    %rax,%rdi
+  801b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b3f:	49 b8 44 8e ff ff ff 	movabs $0xffffffffffff8e44,%r8
+  801b46:	ff ff ff 
+  801b49:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  801b4d:	41 ff d0             	call   *%r8
+			break;
+  801b50:	e9 1c 03 00 00       	jmp    801e71 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  801b55:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801b58:	83 f8 2f             	cmp    $0x2f,%eax
+  801b5b:	77 17                	ja     801b74 <vprintfmt+0x2f7>
+  801b5d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801b61:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801b64:	89 d2                	mov    %edx,%edx
+  801b66:	48 01 d0             	add    %rdx,%rax
+  801b69:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801b6c:	83 c2 08             	add    $0x8,%edx
+  801b6f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801b72:	eb 0c                	jmp    801b80 <vprintfmt+0x303>
+  801b74:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801b78:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801b7c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801b80:	4c 8b 28             	mov    (%rax),%r13
+  801b83:	4d 85 ed             	test   %r13,%r13
+  801b86:	75 0e                	jne    801b96 <vprintfmt+0x319>
+				p = "(null)";
+  801b88:	48 b8 7c e3 ff ff ff 	movabs $0xffffffffffffe37c,%rax
+  801b8f:	ff ff ff 
+  801b92:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  801b96:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801b9a:	0f 8e 84 00 00 00    	jle    801c24 <vprintfmt+0x3a7>
+  801ba0:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  801ba4:	74 7e                	je     801c24 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801ba6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801ba9:	48 98                	cltq
+  801bab:	48 89 c6             	mov    %rax,%rsi
+  801bae:	4c 89 ef             	mov    %r13,%rdi
+  801bb1:	4d 89 e7             	mov    %r12,%r15
+  801bb4:	48 b8 69 91 ff ff ff 	movabs $0xffffffffffff9169,%rax
+  801bbb:	ff ff ff 
+  801bbe:	4c 01 e0             	add    %r12,%rax
+  801bc1:	ff d0                	call   *%rax
+  801bc3:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  801bc6:	eb 17                	jmp    801bdf <vprintfmt+0x362>
+					putch(padc, putdat);
+  801bc8:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  801bcc:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  801bd0:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  801bd4:	48 89 d6             	mov    %rdx,%rsi
+  801bd7:	89 c7                	mov    %eax,%edi
+  801bd9:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  801bdb:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801bdf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801be3:	7f e3                	jg     801bc8 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801be5:	eb 3d                	jmp    801c24 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  801be7:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  801beb:	74 1e                	je     801c0b <vprintfmt+0x38e>
+  801bed:	83 fb 1f             	cmp    $0x1f,%ebx
+  801bf0:	7e 05                	jle    801bf7 <vprintfmt+0x37a>
+  801bf2:	83 fb 7e             	cmp    $0x7e,%ebx
+  801bf5:	7e 14                	jle    801c0b <vprintfmt+0x38e>
+					putch('?', putdat);
+  801bf7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801bfb:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801bff:	48 89 c6             	mov    %rax,%rsi
+  801c02:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801c07:	ff d2                	call   *%rdx
+  801c09:	eb 15                	jmp    801c20 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  801c0b:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801c0e:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  801c11:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801c15:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801c19:	48 89 c6             	mov    %rax,%rsi
+  801c1c:	89 cf                	mov    %ecx,%edi
+  801c1e:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801c20:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801c24:	4c 89 e8             	mov    %r13,%rax
+  801c27:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  801c2b:	0f b6 00             	movzbl (%rax),%eax
+  801c2e:	0f be d8             	movsbl %al,%ebx
+  801c31:	85 db                	test   %ebx,%ebx
+  801c33:	74 28                	je     801c5d <vprintfmt+0x3e0>
+  801c35:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801c39:	78 ac                	js     801be7 <vprintfmt+0x36a>
+  801c3b:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801c3f:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801c43:	79 a2                	jns    801be7 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  801c45:	eb 16                	jmp    801c5d <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  801c47:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801c4b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801c4f:	48 89 c6             	mov    %rax,%rsi
+  801c52:	bf 20 00 00 00       	mov    $0x20,%edi
+  801c57:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  801c59:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801c5d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c61:	7f e4                	jg     801c47 <vprintfmt+0x3ca>
+			break;
+  801c63:	e9 09 02 00 00       	jmp    801e71 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  801c68:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801c6c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c70:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801c74:	0f b6 00             	movzbl (%rax),%eax
+  801c77:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  801c7a:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  801c7b:	83 fb 2f             	cmp    $0x2f,%ebx
+  801c7e:	0f 8e ac fd ff ff    	jle    801a30 <vprintfmt+0x1b3>
+  801c84:	e9 97 fd ff ff       	jmp    801a20 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  801c89:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801c8d:	be 03 00 00 00       	mov    $0x3,%esi
+  801c92:	48 89 c7             	mov    %rax,%rdi
+  801c95:	48 b8 22 87 ff ff ff 	movabs $0xffffffffffff8722,%rax
+  801c9c:	ff ff ff 
+  801c9f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801ca3:	ff d0                	call   *%rax
+  801ca5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  801ca9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cad:	48 85 c0             	test   %rax,%rax
+  801cb0:	79 1d                	jns    801ccf <vprintfmt+0x452>
+				putch('-', putdat);
+  801cb2:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801cb6:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801cba:	48 89 c6             	mov    %rax,%rsi
+  801cbd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801cc2:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  801cc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc8:	48 f7 d8             	neg    %rax
+  801ccb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  801ccf:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801cd6:	e9 de 00 00 00       	jmp    801db9 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  801cdb:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801cdf:	be 03 00 00 00       	mov    $0x3,%esi
+  801ce4:	48 89 c7             	mov    %rax,%rdi
+  801ce7:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  801cee:	ff ff ff 
+  801cf1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801cf5:	ff d0                	call   *%rax
+  801cf7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  801cfb:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801d02:	e9 b2 00 00 00       	jmp    801db9 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  801d07:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801d0b:	be 03 00 00 00       	mov    $0x3,%esi
+  801d10:	48 89 c7             	mov    %rax,%rdi
+  801d13:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  801d1a:	ff ff ff 
+  801d1d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801d21:	ff d0                	call   *%rax
+  801d23:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  801d27:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801d2e:	e9 86 00 00 00       	jmp    801db9 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801d33:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801d37:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801d3b:	48 89 c6             	mov    %rax,%rsi
+  801d3e:	bf 30 00 00 00       	mov    $0x30,%edi
+  801d43:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801d45:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801d49:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801d4d:	48 89 c6             	mov    %rax,%rsi
+  801d50:	bf 78 00 00 00       	mov    $0x78,%edi
+  801d55:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  801d57:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  801d5a:	83 f8 2f             	cmp    $0x2f,%eax
+  801d5d:	77 17                	ja     801d76 <vprintfmt+0x4f9>
+  801d5f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801d63:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801d66:	89 d2                	mov    %edx,%edx
+  801d68:	48 01 d0             	add    %rdx,%rax
+  801d6b:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801d6e:	83 c2 08             	add    $0x8,%edx
+  801d71:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801d74:	eb 0c                	jmp    801d82 <vprintfmt+0x505>
+  801d76:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801d7a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801d7e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801d82:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801d85:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801d89:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801d90:	eb 27                	jmp    801db9 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801d92:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801d96:	be 03 00 00 00       	mov    $0x3,%esi
+  801d9b:	48 89 c7             	mov    %rax,%rdi
+  801d9e:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  801da5:	ff ff ff 
+  801da8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801dac:	ff d0                	call   *%rax
+  801dae:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801db2:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  801db9:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801dbe:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801dc1:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801dc4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801dc8:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801dcc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801dd0:	45 89 c1             	mov    %r8d,%r9d
+  801dd3:	41 89 f8             	mov    %edi,%r8d
+  801dd6:	48 89 c7             	mov    %rax,%rdi
+  801dd9:	48 b8 e9 84 ff ff ff 	movabs $0xffffffffffff84e9,%rax
+  801de0:	ff ff ff 
+  801de3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801de7:	ff d0                	call   *%rax
+			break;
+  801de9:	e9 83 00 00 00       	jmp    801e71 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801dee:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801df2:	be 03 00 00 00       	mov    $0x3,%esi
+  801df7:	48 89 c7             	mov    %rax,%rdi
+  801dfa:	48 b8 c1 85 ff ff ff 	movabs $0xffffffffffff85c1,%rax
+  801e01:	ff ff ff 
+  801e04:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801e08:	ff d0                	call   *%rax
+  801e0a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801e0e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801e12:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  801e16:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801e1a:	48 89 ce             	mov    %rcx,%rsi
+  801e1d:	48 89 c7             	mov    %rax,%rdi
+  801e20:	48 b8 dc 86 ff ff ff 	movabs $0xffffffffffff86dc,%rax
+  801e27:	ff ff ff 
+  801e2a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801e2e:	ff d0                	call   *%rax
+	
+			break;
+  801e30:	eb 3f                	jmp    801e71 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801e32:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801e36:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801e3a:	48 89 c6             	mov    %rax,%rsi
+  801e3d:	89 df                	mov    %ebx,%edi
+  801e3f:	ff d2                	call   *%rdx
+			break;
+  801e41:	eb 2e                	jmp    801e71 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801e43:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801e47:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801e4b:	48 89 c6             	mov    %rax,%rsi
+  801e4e:	bf 25 00 00 00       	mov    $0x25,%edi
+  801e53:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801e55:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801e5a:	eb 05                	jmp    801e61 <vprintfmt+0x5e4>
+  801e5c:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801e61:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801e65:	48 83 e8 01          	sub    $0x1,%rax
+  801e69:	0f b6 00             	movzbl (%rax),%eax
+  801e6c:	3c 25                	cmp    $0x25,%al
+  801e6e:	75 ec                	jne    801e5c <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801e70:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801e71:	e9 78 fa ff ff       	jmp    8018ee <vprintfmt+0x71>
+				return;
+  801e76:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  801e77:	48 83 c4 60          	add    $0x60,%rsp
+  801e7b:	5b                   	pop    %rbx
+  801e7c:	41 5c                	pop    %r12
+  801e7e:	41 5d                	pop    %r13
+  801e80:	41 5f                	pop    %r15
+  801e82:	5d                   	pop    %rbp
+  801e83:	c3                   	ret
+
+0000000000801e84 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801e84:	55                   	push   %rbp
+  801e85:	48 89 e5             	mov    %rsp,%rbp
+  801e88:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801e8f:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801e8f <printfmt+0xb>
+  801e96:	49 bb b1 71 00 00 00 	movabs $0x71b1,%r11
+  801e9d:	00 00 00 
+  801ea0:	4d 01 da             	add    %r11,%r10
+  801ea3:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801eaa:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801eb1:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801eb8:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801ebf:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801ec6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801ecd:	84 c0                	test   %al,%al
+  801ecf:	74 20                	je     801ef1 <printfmt+0x6d>
+  801ed1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801ed5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801ed9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801edd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801ee1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801ee5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801ee9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801eed:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801ef1:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801ef8:	00 00 00 
+  801efb:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801f02:	00 00 00 
+  801f05:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f09:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801f10:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801f17:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801f1e:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801f25:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801f2c:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801f33:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801f3a:	48 89 c7             	mov    %rax,%rdi
+  801f3d:	48 b8 3d 88 ff ff ff 	movabs $0xffffffffffff883d,%rax
+  801f44:	ff ff ff 
+  801f47:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f4b:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801f4d:	90                   	nop
+  801f4e:	c9                   	leave
+  801f4f:	c3                   	ret
+
+0000000000801f50 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801f50:	55                   	push   %rbp
+  801f51:	48 89 e5             	mov    %rsp,%rbp
+  801f54:	48 83 ec 10          	sub    $0x10,%rsp
+  801f58:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f58 <sprintputch+0x8>
+  801f5f:	49 bb e8 70 00 00 00 	movabs $0x70e8,%r11
+  801f66:	00 00 00 
+  801f69:	4c 01 d8             	add    %r11,%rax
+  801f6c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801f6f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801f73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f77:	8b 40 10             	mov    0x10(%rax),%eax
+  801f7a:	8d 50 01             	lea    0x1(%rax),%edx
+  801f7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f81:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801f84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f88:	48 8b 10             	mov    (%rax),%rdx
+  801f8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f8f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f93:	48 39 c2             	cmp    %rax,%rdx
+  801f96:	73 17                	jae    801faf <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801f98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f9c:	48 8b 00             	mov    (%rax),%rax
+  801f9f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801fa3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801fa7:	48 89 0a             	mov    %rcx,(%rdx)
+  801faa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801fad:	88 10                	mov    %dl,(%rax)
+}
+  801faf:	90                   	nop
+  801fb0:	c9                   	leave
+  801fb1:	c3                   	ret
+
+0000000000801fb2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801fb2:	55                   	push   %rbp
+  801fb3:	48 89 e5             	mov    %rsp,%rbp
+  801fb6:	53                   	push   %rbx
+  801fb7:	48 83 ec 58          	sub    $0x58,%rsp
+  801fbb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fbb <vsnprintf+0x9>
+  801fc2:	49 bb 85 70 00 00 00 	movabs $0x7085,%r11
+  801fc9:	00 00 00 
+  801fcc:	4c 01 d8             	add    %r11,%rax
+  801fcf:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801fd3:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801fd6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801fda:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801fde:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801fe2:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801fe6:	48 8b 0e             	mov    (%rsi),%rcx
+  801fe9:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801fed:	48 89 0a             	mov    %rcx,(%rdx)
+  801ff0:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801ff4:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801ff8:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801ffc:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802000:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  802004:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  802007:	48 63 d2             	movslq %edx,%rdx
+  80200a:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80200e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802012:	48 01 ca             	add    %rcx,%rdx
+  802015:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802019:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  802020:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  802025:	74 06                	je     80202d <vsnprintf+0x7b>
+  802027:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  80202b:	7f 07                	jg     802034 <vsnprintf+0x82>
+		return -E_INVAL;
+  80202d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802032:	eb 34                	jmp    802068 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  802034:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  802038:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80203c:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  802040:	48 bf 10 8f ff ff ff 	movabs $0xffffffffffff8f10,%rdi
+  802047:	ff ff ff 
+  80204a:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  80204e:	49 b8 3d 88 ff ff ff 	movabs $0xffffffffffff883d,%r8
+  802055:	ff ff ff 
+  802058:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  80205c:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  80205e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802062:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  802065:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  802068:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80206c:	c9                   	leave
+  80206d:	c3                   	ret
+
+000000000080206e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80206e:	55                   	push   %rbp
+  80206f:	48 89 e5             	mov    %rsp,%rbp
+  802072:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  802079:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 802079 <snprintf+0xb>
+  802080:	49 bb c7 6f 00 00 00 	movabs $0x6fc7,%r11
+  802087:	00 00 00 
+  80208a:	4d 01 da             	add    %r11,%r10
+  80208d:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  802094:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80209a:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8020a1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8020a8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8020af:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8020b6:	84 c0                	test   %al,%al
+  8020b8:	74 20                	je     8020da <snprintf+0x6c>
+  8020ba:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8020be:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8020c2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8020c6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8020ca:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8020ce:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8020d2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8020d6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8020da:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8020e1:	00 00 00 
+  8020e4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8020eb:	00 00 00 
+  8020ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8020f2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8020f9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  802100:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  802107:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80210e:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  802115:	48 8b 06             	mov    (%rsi),%rax
+  802118:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80211c:	48 89 01             	mov    %rax,(%rcx)
+  80211f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  802123:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  802127:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80212b:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  802132:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  802139:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  80213f:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  802146:	48 89 c7             	mov    %rax,%rdi
+  802149:	48 b8 72 8f ff ff ff 	movabs $0xffffffffffff8f72,%rax
+  802150:	ff ff ff 
+  802153:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  802157:	ff d0                	call   *%rax
+  802159:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  80215f:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  802165:	c9                   	leave
+  802166:	c3                   	ret
+
+0000000000802167 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802167:	55                   	push   %rbp
+  802168:	48 89 e5             	mov    %rsp,%rbp
+  80216b:	48 83 ec 18          	sub    $0x18,%rsp
+  80216f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80216f <strlen+0x8>
+  802176:	49 bb d1 6e 00 00 00 	movabs $0x6ed1,%r11
+  80217d:	00 00 00 
+  802180:	4c 01 d8             	add    %r11,%rax
+  802183:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  802187:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80218e:	eb 09                	jmp    802199 <strlen+0x32>
+		n++;
+  802190:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  802194:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  802199:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80219d:	0f b6 00             	movzbl (%rax),%eax
+  8021a0:	84 c0                	test   %al,%al
+  8021a2:	75 ec                	jne    802190 <strlen+0x29>
+	return n;
+  8021a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8021a7:	c9                   	leave
+  8021a8:	c3                   	ret
+
+00000000008021a9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8021a9:	55                   	push   %rbp
+  8021aa:	48 89 e5             	mov    %rsp,%rbp
+  8021ad:	48 83 ec 20          	sub    $0x20,%rsp
+  8021b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021b1 <strnlen+0x8>
+  8021b8:	49 bb 8f 6e 00 00 00 	movabs $0x6e8f,%r11
+  8021bf:	00 00 00 
+  8021c2:	4c 01 d8             	add    %r11,%rax
+  8021c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8021c9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8021cd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8021d4:	eb 0e                	jmp    8021e4 <strnlen+0x3b>
+		n++;
+  8021d6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8021da:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8021df:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8021e4:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8021e9:	74 0b                	je     8021f6 <strnlen+0x4d>
+  8021eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021ef:	0f b6 00             	movzbl (%rax),%eax
+  8021f2:	84 c0                	test   %al,%al
+  8021f4:	75 e0                	jne    8021d6 <strnlen+0x2d>
+	return n;
+  8021f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8021f9:	c9                   	leave
+  8021fa:	c3                   	ret
+
+00000000008021fb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8021fb:	55                   	push   %rbp
+  8021fc:	48 89 e5             	mov    %rsp,%rbp
+  8021ff:	48 83 ec 20          	sub    $0x20,%rsp
+  802203:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802203 <strcpy+0x8>
+  80220a:	49 bb 3d 6e 00 00 00 	movabs $0x6e3d,%r11
+  802211:	00 00 00 
+  802214:	4c 01 d8             	add    %r11,%rax
+  802217:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80221b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80221f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802223:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  802227:	90                   	nop
+  802228:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80222c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802230:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  802234:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802238:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80223c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802240:	0f b6 12             	movzbl (%rdx),%edx
+  802243:	88 10                	mov    %dl,(%rax)
+  802245:	0f b6 00             	movzbl (%rax),%eax
+  802248:	84 c0                	test   %al,%al
+  80224a:	75 dc                	jne    802228 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  80224c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802250:	c9                   	leave
+  802251:	c3                   	ret
+
+0000000000802252 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802252:	55                   	push   %rbp
+  802253:	48 89 e5             	mov    %rsp,%rbp
+  802256:	53                   	push   %rbx
+  802257:	48 83 ec 20          	sub    $0x20,%rsp
+  80225b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80225b <strcat+0x9>
+  802262:	49 bb e5 6d 00 00 00 	movabs $0x6de5,%r11
+  802269:	00 00 00 
+  80226c:	4c 01 db             	add    %r11,%rbx
+  80226f:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  802273:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  802277:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80227b:	48 89 c7             	mov    %rax,%rdi
+  80227e:	48 b8 27 91 ff ff ff 	movabs $0xffffffffffff9127,%rax
+  802285:	ff ff ff 
+  802288:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80228c:	ff d0                	call   *%rax
+  80228e:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  802291:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802294:	48 63 d0             	movslq %eax,%rdx
+  802297:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80229b:	48 01 c2             	add    %rax,%rdx
+  80229e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022a2:	48 89 c6             	mov    %rax,%rsi
+  8022a5:	48 89 d7             	mov    %rdx,%rdi
+  8022a8:	48 b8 bb 91 ff ff ff 	movabs $0xffffffffffff91bb,%rax
+  8022af:	ff ff ff 
+  8022b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8022b6:	ff d0                	call   *%rax
+	return dst;
+  8022b8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8022bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022c0:	c9                   	leave
+  8022c1:	c3                   	ret
+
+00000000008022c2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8022c2:	55                   	push   %rbp
+  8022c3:	48 89 e5             	mov    %rsp,%rbp
+  8022c6:	48 83 ec 28          	sub    $0x28,%rsp
+  8022ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022ca <strncpy+0x8>
+  8022d1:	49 bb 76 6d 00 00 00 	movabs $0x6d76,%r11
+  8022d8:	00 00 00 
+  8022db:	4c 01 d8             	add    %r11,%rax
+  8022de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8022e6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8022ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022ee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8022f2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8022f9:	00 
+  8022fa:	eb 2a                	jmp    802326 <strncpy+0x64>
+		*dst++ = *src;
+  8022fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802300:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802304:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802308:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80230c:	0f b6 12             	movzbl (%rdx),%edx
+  80230f:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  802311:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802315:	0f b6 00             	movzbl (%rax),%eax
+  802318:	84 c0                	test   %al,%al
+  80231a:	74 05                	je     802321 <strncpy+0x5f>
+			src++;
+  80231c:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  802321:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802326:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80232a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80232e:	72 cc                	jb     8022fc <strncpy+0x3a>
+	}
+	return ret;
+  802330:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+
+0000000000802336 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  802336:	55                   	push   %rbp
+  802337:	48 89 e5             	mov    %rsp,%rbp
+  80233a:	48 83 ec 28          	sub    $0x28,%rsp
+  80233e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80233e <strlcpy+0x8>
+  802345:	49 bb 02 6d 00 00 00 	movabs $0x6d02,%r11
+  80234c:	00 00 00 
+  80234f:	4c 01 d8             	add    %r11,%rax
+  802352:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802356:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80235a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  80235e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802362:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  802366:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80236b:	74 3d                	je     8023aa <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  80236d:	eb 1d                	jmp    80238c <strlcpy+0x56>
+			*dst++ = *src++;
+  80236f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802373:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802377:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80237b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80237f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802383:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802387:	0f b6 12             	movzbl (%rdx),%edx
+  80238a:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80238c:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  802391:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  802396:	74 0b                	je     8023a3 <strlcpy+0x6d>
+  802398:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80239c:	0f b6 00             	movzbl (%rax),%eax
+  80239f:	84 c0                	test   %al,%al
+  8023a1:	75 cc                	jne    80236f <strlcpy+0x39>
+		*dst = '\0';
+  8023a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023a7:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8023aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023ae:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8023b2:	c9                   	leave
+  8023b3:	c3                   	ret
+
+00000000008023b4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8023b4:	55                   	push   %rbp
+  8023b5:	48 89 e5             	mov    %rsp,%rbp
+  8023b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8023bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023bc <strcmp+0x8>
+  8023c3:	49 bb 84 6c 00 00 00 	movabs $0x6c84,%r11
+  8023ca:	00 00 00 
+  8023cd:	4c 01 d8             	add    %r11,%rax
+  8023d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023d4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8023d8:	eb 0a                	jmp    8023e4 <strcmp+0x30>
+		p++, q++;
+  8023da:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8023df:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8023e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023e8:	0f b6 00             	movzbl (%rax),%eax
+  8023eb:	84 c0                	test   %al,%al
+  8023ed:	74 12                	je     802401 <strcmp+0x4d>
+  8023ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023f3:	0f b6 10             	movzbl (%rax),%edx
+  8023f6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023fa:	0f b6 00             	movzbl (%rax),%eax
+  8023fd:	38 c2                	cmp    %al,%dl
+  8023ff:	74 d9                	je     8023da <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  802401:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802405:	0f b6 00             	movzbl (%rax),%eax
+  802408:	0f b6 d0             	movzbl %al,%edx
+  80240b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80240f:	0f b6 00             	movzbl (%rax),%eax
+  802412:	0f b6 c0             	movzbl %al,%eax
+  802415:	29 c2                	sub    %eax,%edx
+  802417:	89 d0                	mov    %edx,%eax
+}
+  802419:	c9                   	leave
+  80241a:	c3                   	ret
+
+000000000080241b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80241b:	55                   	push   %rbp
+  80241c:	48 89 e5             	mov    %rsp,%rbp
+  80241f:	48 83 ec 18          	sub    $0x18,%rsp
+  802423:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802423 <strncmp+0x8>
+  80242a:	49 bb 1d 6c 00 00 00 	movabs $0x6c1d,%r11
+  802431:	00 00 00 
+  802434:	4c 01 d8             	add    %r11,%rax
+  802437:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80243b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80243f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  802443:	eb 0f                	jmp    802454 <strncmp+0x39>
+		n--, p++, q++;
+  802445:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80244a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80244f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  802454:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802459:	74 1d                	je     802478 <strncmp+0x5d>
+  80245b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80245f:	0f b6 00             	movzbl (%rax),%eax
+  802462:	84 c0                	test   %al,%al
+  802464:	74 12                	je     802478 <strncmp+0x5d>
+  802466:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80246a:	0f b6 10             	movzbl (%rax),%edx
+  80246d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802471:	0f b6 00             	movzbl (%rax),%eax
+  802474:	38 c2                	cmp    %al,%dl
+  802476:	74 cd                	je     802445 <strncmp+0x2a>
+	if (n == 0)
+  802478:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80247d:	75 07                	jne    802486 <strncmp+0x6b>
+		return 0;
+  80247f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802484:	eb 16                	jmp    80249c <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  802486:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80248a:	0f b6 00             	movzbl (%rax),%eax
+  80248d:	0f b6 d0             	movzbl %al,%edx
+  802490:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802494:	0f b6 00             	movzbl (%rax),%eax
+  802497:	0f b6 c0             	movzbl %al,%eax
+  80249a:	29 c2                	sub    %eax,%edx
+}
+  80249c:	89 d0                	mov    %edx,%eax
+  80249e:	c9                   	leave
+  80249f:	c3                   	ret
+
+00000000008024a0 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8024a0:	55                   	push   %rbp
+  8024a1:	48 89 e5             	mov    %rsp,%rbp
+  8024a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024a8 <strchr+0x8>
+  8024af:	49 bb 98 6b 00 00 00 	movabs $0x6b98,%r11
+  8024b6:	00 00 00 
+  8024b9:	4c 01 d8             	add    %r11,%rax
+  8024bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024c0:	89 f0                	mov    %esi,%eax
+  8024c2:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8024c5:	eb 17                	jmp    8024de <strchr+0x3e>
+		if (*s == c)
+  8024c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024cb:	0f b6 00             	movzbl (%rax),%eax
+  8024ce:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8024d1:	75 06                	jne    8024d9 <strchr+0x39>
+			return (char *) s;
+  8024d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024d7:	eb 15                	jmp    8024ee <strchr+0x4e>
+	for (; *s; s++)
+  8024d9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8024de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024e2:	0f b6 00             	movzbl (%rax),%eax
+  8024e5:	84 c0                	test   %al,%al
+  8024e7:	75 de                	jne    8024c7 <strchr+0x27>
+	return 0;
+  8024e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ee:	c9                   	leave
+  8024ef:	c3                   	ret
+
+00000000008024f0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8024f0:	55                   	push   %rbp
+  8024f1:	48 89 e5             	mov    %rsp,%rbp
+  8024f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8024f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024f8 <strfind+0x8>
+  8024ff:	49 bb 48 6b 00 00 00 	movabs $0x6b48,%r11
+  802506:	00 00 00 
+  802509:	4c 01 d8             	add    %r11,%rax
+  80250c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802510:	89 f0                	mov    %esi,%eax
+  802512:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  802515:	eb 11                	jmp    802528 <strfind+0x38>
+		if (*s == c)
+  802517:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80251b:	0f b6 00             	movzbl (%rax),%eax
+  80251e:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  802521:	74 12                	je     802535 <strfind+0x45>
+	for (; *s; s++)
+  802523:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802528:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80252c:	0f b6 00             	movzbl (%rax),%eax
+  80252f:	84 c0                	test   %al,%al
+  802531:	75 e4                	jne    802517 <strfind+0x27>
+  802533:	eb 01                	jmp    802536 <strfind+0x46>
+			break;
+  802535:	90                   	nop
+	return (char *) s;
+  802536:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80253a:	c9                   	leave
+  80253b:	c3                   	ret
+
+000000000080253c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80253c:	55                   	push   %rbp
+  80253d:	48 89 e5             	mov    %rsp,%rbp
+  802540:	48 83 ec 18          	sub    $0x18,%rsp
+  802544:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802544 <memset+0x8>
+  80254b:	49 bb fc 6a 00 00 00 	movabs $0x6afc,%r11
+  802552:	00 00 00 
+  802555:	4c 01 d8             	add    %r11,%rax
+  802558:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80255c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80255f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  802563:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802568:	75 06                	jne    802570 <memset+0x34>
+		return v;
+  80256a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80256e:	eb 69                	jmp    8025d9 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  802570:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802574:	83 e0 03             	and    $0x3,%eax
+  802577:	48 85 c0             	test   %rax,%rax
+  80257a:	75 48                	jne    8025c4 <memset+0x88>
+  80257c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802580:	83 e0 03             	and    $0x3,%eax
+  802583:	48 85 c0             	test   %rax,%rax
+  802586:	75 3c                	jne    8025c4 <memset+0x88>
+		c &= 0xFF;
+  802588:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  80258f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802592:	c1 e0 18             	shl    $0x18,%eax
+  802595:	89 c2                	mov    %eax,%edx
+  802597:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80259a:	c1 e0 10             	shl    $0x10,%eax
+  80259d:	09 c2                	or     %eax,%edx
+  80259f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8025a2:	c1 e0 08             	shl    $0x8,%eax
+  8025a5:	09 d0                	or     %edx,%eax
+  8025a7:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8025aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8025ae:	48 c1 e8 02          	shr    $0x2,%rax
+  8025b2:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8025b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025b9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8025bc:	48 89 d7             	mov    %rdx,%rdi
+  8025bf:	fc                   	cld
+  8025c0:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8025c2:	eb 11                	jmp    8025d5 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8025c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8025cb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025cf:	48 89 d7             	mov    %rdx,%rdi
+  8025d2:	fc                   	cld
+  8025d3:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8025d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8025d9:	c9                   	leave
+  8025da:	c3                   	ret
+
+00000000008025db <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8025db:	55                   	push   %rbp
+  8025dc:	48 89 e5             	mov    %rsp,%rbp
+  8025df:	48 83 ec 28          	sub    $0x28,%rsp
+  8025e3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025e3 <memmove+0x8>
+  8025ea:	49 bb 5d 6a 00 00 00 	movabs $0x6a5d,%r11
+  8025f1:	00 00 00 
+  8025f4:	4c 01 d8             	add    %r11,%rax
+  8025f7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8025fb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025ff:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  802603:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802607:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  80260b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80260f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  802613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802617:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80261b:	0f 83 88 00 00 00    	jae    8026a9 <memmove+0xce>
+  802621:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802625:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802629:	48 01 d0             	add    %rdx,%rax
+  80262c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802630:	73 77                	jae    8026a9 <memmove+0xce>
+		s += n;
+  802632:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802636:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80263a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80263e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  802642:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802646:	83 e0 03             	and    $0x3,%eax
+  802649:	48 85 c0             	test   %rax,%rax
+  80264c:	75 3b                	jne    802689 <memmove+0xae>
+  80264e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802652:	83 e0 03             	and    $0x3,%eax
+  802655:	48 85 c0             	test   %rax,%rax
+  802658:	75 2f                	jne    802689 <memmove+0xae>
+  80265a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80265e:	83 e0 03             	and    $0x3,%eax
+  802661:	48 85 c0             	test   %rax,%rax
+  802664:	75 23                	jne    802689 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  802666:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80266a:	48 83 e8 04          	sub    $0x4,%rax
+  80266e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802672:	48 83 ea 04          	sub    $0x4,%rdx
+  802676:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80267a:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  80267e:	48 89 c7             	mov    %rax,%rdi
+  802681:	48 89 d6             	mov    %rdx,%rsi
+  802684:	fd                   	std
+  802685:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  802687:	eb 1d                	jmp    8026a6 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802689:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80268d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802691:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802695:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  802699:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80269d:	48 89 d7             	mov    %rdx,%rdi
+  8026a0:	48 89 c1             	mov    %rax,%rcx
+  8026a3:	fd                   	std
+  8026a4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8026a6:	fc                   	cld
+  8026a7:	eb 57                	jmp    802700 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8026a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026ad:	83 e0 03             	and    $0x3,%eax
+  8026b0:	48 85 c0             	test   %rax,%rax
+  8026b3:	75 36                	jne    8026eb <memmove+0x110>
+  8026b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026b9:	83 e0 03             	and    $0x3,%eax
+  8026bc:	48 85 c0             	test   %rax,%rax
+  8026bf:	75 2a                	jne    8026eb <memmove+0x110>
+  8026c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026c5:	83 e0 03             	and    $0x3,%eax
+  8026c8:	48 85 c0             	test   %rax,%rax
+  8026cb:	75 1e                	jne    8026eb <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8026cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026d1:	48 c1 e8 02          	shr    $0x2,%rax
+  8026d5:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  8026d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026dc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026e0:	48 89 c7             	mov    %rax,%rdi
+  8026e3:	48 89 d6             	mov    %rdx,%rsi
+  8026e6:	fc                   	cld
+  8026e7:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8026e9:	eb 15                	jmp    802700 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  8026eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026f3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8026f7:	48 89 c7             	mov    %rax,%rdi
+  8026fa:	48 89 d6             	mov    %rdx,%rsi
+  8026fd:	fc                   	cld
+  8026fe:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  802700:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802704:	c9                   	leave
+  802705:	c3                   	ret
+
+0000000000802706 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802706:	55                   	push   %rbp
+  802707:	48 89 e5             	mov    %rsp,%rbp
+  80270a:	48 83 ec 18          	sub    $0x18,%rsp
+  80270e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80270e <memcpy+0x8>
+  802715:	49 bb 32 69 00 00 00 	movabs $0x6932,%r11
+  80271c:	00 00 00 
+  80271f:	4c 01 d8             	add    %r11,%rax
+  802722:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802726:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80272a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  80272e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802732:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  802736:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80273a:	48 89 cf             	mov    %rcx,%rdi
+  80273d:	48 b9 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rcx
+  802744:	ff ff ff 
+  802747:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80274b:	ff d0                	call   *%rax
+}
+  80274d:	c9                   	leave
+  80274e:	c3                   	ret
+
+000000000080274f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80274f:	55                   	push   %rbp
+  802750:	48 89 e5             	mov    %rsp,%rbp
+  802753:	48 83 ec 28          	sub    $0x28,%rsp
+  802757:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802757 <memcmp+0x8>
+  80275e:	49 bb e9 68 00 00 00 	movabs $0x68e9,%r11
+  802765:	00 00 00 
+  802768:	4c 01 d8             	add    %r11,%rax
+  80276b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80276f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802773:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  802777:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80277b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  80277f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802783:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  802787:	eb 34                	jmp    8027bd <memcmp+0x6e>
+		if (*s1 != *s2)
+  802789:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80278d:	0f b6 10             	movzbl (%rax),%edx
+  802790:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802794:	0f b6 00             	movzbl (%rax),%eax
+  802797:	38 c2                	cmp    %al,%dl
+  802799:	74 18                	je     8027b3 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  80279b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80279f:	0f b6 00             	movzbl (%rax),%eax
+  8027a2:	0f b6 d0             	movzbl %al,%edx
+  8027a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027a9:	0f b6 00             	movzbl (%rax),%eax
+  8027ac:	0f b6 c0             	movzbl %al,%eax
+  8027af:	29 c2                	sub    %eax,%edx
+  8027b1:	eb 20                	jmp    8027d3 <memcmp+0x84>
+		s1++, s2++;
+  8027b3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8027b8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  8027bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027c1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8027c5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8027c9:	48 85 c0             	test   %rax,%rax
+  8027cc:	75 bb                	jne    802789 <memcmp+0x3a>
+	}
+
+	return 0;
+  8027ce:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  8027d3:	89 d0                	mov    %edx,%eax
+  8027d5:	c9                   	leave
+  8027d6:	c3                   	ret
+
+00000000008027d7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8027d7:	55                   	push   %rbp
+  8027d8:	48 89 e5             	mov    %rsp,%rbp
+  8027db:	48 83 ec 28          	sub    $0x28,%rsp
+  8027df:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027df <memfind+0x8>
+  8027e6:	49 bb 61 68 00 00 00 	movabs $0x6861,%r11
+  8027ed:	00 00 00 
+  8027f0:	4c 01 d8             	add    %r11,%rax
+  8027f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8027f7:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8027fa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  8027fe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802802:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802806:	48 01 d0             	add    %rdx,%rax
+  802809:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80280d:	eb 13                	jmp    802822 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80280f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802813:	0f b6 00             	movzbl (%rax),%eax
+  802816:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802819:	38 d0                	cmp    %dl,%al
+  80281b:	74 11                	je     80282e <memfind+0x57>
+	for (; s < ends; s++)
+  80281d:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  802822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802826:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80282a:	72 e3                	jb     80280f <memfind+0x38>
+  80282c:	eb 01                	jmp    80282f <memfind+0x58>
+			break;
+  80282e:	90                   	nop
+	return (void *) s;
+  80282f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802833:	c9                   	leave
+  802834:	c3                   	ret
+
+0000000000802835 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802835:	55                   	push   %rbp
+  802836:	48 89 e5             	mov    %rsp,%rbp
+  802839:	48 83 ec 38          	sub    $0x38,%rsp
+  80283d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80283d <strtol+0x8>
+  802844:	49 bb 03 68 00 00 00 	movabs $0x6803,%r11
+  80284b:	00 00 00 
+  80284e:	4c 01 d8             	add    %r11,%rax
+  802851:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802855:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802859:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  80285c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  802863:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80286a:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  80286b:	eb 05                	jmp    802872 <strtol+0x3d>
+		s++;
+  80286d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  802872:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802876:	0f b6 00             	movzbl (%rax),%eax
+  802879:	3c 20                	cmp    $0x20,%al
+  80287b:	74 f0                	je     80286d <strtol+0x38>
+  80287d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802881:	0f b6 00             	movzbl (%rax),%eax
+  802884:	3c 09                	cmp    $0x9,%al
+  802886:	74 e5                	je     80286d <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  802888:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80288c:	0f b6 00             	movzbl (%rax),%eax
+  80288f:	3c 2b                	cmp    $0x2b,%al
+  802891:	75 07                	jne    80289a <strtol+0x65>
+		s++;
+  802893:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802898:	eb 17                	jmp    8028b1 <strtol+0x7c>
+	else if (*s == '-')
+  80289a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80289e:	0f b6 00             	movzbl (%rax),%eax
+  8028a1:	3c 2d                	cmp    $0x2d,%al
+  8028a3:	75 0c                	jne    8028b1 <strtol+0x7c>
+		s++, neg = 1;
+  8028a5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8028aa:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8028b1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8028b5:	74 06                	je     8028bd <strtol+0x88>
+  8028b7:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8028bb:	75 28                	jne    8028e5 <strtol+0xb0>
+  8028bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028c1:	0f b6 00             	movzbl (%rax),%eax
+  8028c4:	3c 30                	cmp    $0x30,%al
+  8028c6:	75 1d                	jne    8028e5 <strtol+0xb0>
+  8028c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028cc:	48 83 c0 01          	add    $0x1,%rax
+  8028d0:	0f b6 00             	movzbl (%rax),%eax
+  8028d3:	3c 78                	cmp    $0x78,%al
+  8028d5:	75 0e                	jne    8028e5 <strtol+0xb0>
+		s += 2, base = 16;
+  8028d7:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8028dc:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8028e3:	eb 2c                	jmp    802911 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  8028e5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8028e9:	75 19                	jne    802904 <strtol+0xcf>
+  8028eb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028ef:	0f b6 00             	movzbl (%rax),%eax
+  8028f2:	3c 30                	cmp    $0x30,%al
+  8028f4:	75 0e                	jne    802904 <strtol+0xcf>
+		s++, base = 8;
+  8028f6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8028fb:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802902:	eb 0d                	jmp    802911 <strtol+0xdc>
+	else if (base == 0)
+  802904:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802908:	75 07                	jne    802911 <strtol+0xdc>
+		base = 10;
+  80290a:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  802911:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802915:	0f b6 00             	movzbl (%rax),%eax
+  802918:	3c 2f                	cmp    $0x2f,%al
+  80291a:	7e 1d                	jle    802939 <strtol+0x104>
+  80291c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802920:	0f b6 00             	movzbl (%rax),%eax
+  802923:	3c 39                	cmp    $0x39,%al
+  802925:	7f 12                	jg     802939 <strtol+0x104>
+			dig = *s - '0';
+  802927:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80292b:	0f b6 00             	movzbl (%rax),%eax
+  80292e:	0f be c0             	movsbl %al,%eax
+  802931:	83 e8 30             	sub    $0x30,%eax
+  802934:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802937:	eb 4e                	jmp    802987 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  802939:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80293d:	0f b6 00             	movzbl (%rax),%eax
+  802940:	3c 60                	cmp    $0x60,%al
+  802942:	7e 1d                	jle    802961 <strtol+0x12c>
+  802944:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802948:	0f b6 00             	movzbl (%rax),%eax
+  80294b:	3c 7a                	cmp    $0x7a,%al
+  80294d:	7f 12                	jg     802961 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  80294f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802953:	0f b6 00             	movzbl (%rax),%eax
+  802956:	0f be c0             	movsbl %al,%eax
+  802959:	83 e8 57             	sub    $0x57,%eax
+  80295c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80295f:	eb 26                	jmp    802987 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  802961:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802965:	0f b6 00             	movzbl (%rax),%eax
+  802968:	3c 40                	cmp    $0x40,%al
+  80296a:	7e 47                	jle    8029b3 <strtol+0x17e>
+  80296c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802970:	0f b6 00             	movzbl (%rax),%eax
+  802973:	3c 5a                	cmp    $0x5a,%al
+  802975:	7f 3c                	jg     8029b3 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  802977:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80297b:	0f b6 00             	movzbl (%rax),%eax
+  80297e:	0f be c0             	movsbl %al,%eax
+  802981:	83 e8 37             	sub    $0x37,%eax
+  802984:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  802987:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80298a:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80298d:	7d 23                	jge    8029b2 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  80298f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802994:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802997:	48 98                	cltq
+  802999:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80299e:	48 89 c2             	mov    %rax,%rdx
+  8029a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029a4:	48 98                	cltq
+  8029a6:	48 01 d0             	add    %rdx,%rax
+  8029a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  8029ad:	e9 5f ff ff ff       	jmp    802911 <strtol+0xdc>
+			break;
+  8029b2:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8029b3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8029b8:	74 0b                	je     8029c5 <strtol+0x190>
+		*endptr = (char *) s;
+  8029ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8029be:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8029c2:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  8029c5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8029c9:	74 09                	je     8029d4 <strtol+0x19f>
+  8029cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029cf:	48 f7 d8             	neg    %rax
+  8029d2:	eb 04                	jmp    8029d8 <strtol+0x1a3>
+  8029d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8029d8:	c9                   	leave
+  8029d9:	c3                   	ret
+
+00000000008029da <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  8029da:	55                   	push   %rbp
+  8029db:	48 89 e5             	mov    %rsp,%rbp
+  8029de:	53                   	push   %rbx
+  8029df:	48 83 ec 30          	sub    $0x30,%rsp
+  8029e3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8029e3 <strstr+0x9>
+  8029ea:	49 bb 5d 66 00 00 00 	movabs $0x665d,%r11
+  8029f1:	00 00 00 
+  8029f4:	4c 01 db             	add    %r11,%rbx
+  8029f7:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  8029fb:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  8029ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a03:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802a07:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802a0b:	0f b6 00             	movzbl (%rax),%eax
+  802a0e:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  802a11:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  802a15:	75 06                	jne    802a1d <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  802a17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a1b:	eb 73                	jmp    802a90 <strstr+0xb6>
+
+	len = strlen(str);
+  802a1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a21:	48 89 c7             	mov    %rax,%rdi
+  802a24:	48 b8 27 91 ff ff ff 	movabs $0xffffffffffff9127,%rax
+  802a2b:	ff ff ff 
+  802a2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a32:	ff d0                	call   *%rax
+  802a34:	48 98                	cltq
+  802a36:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  802a3a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a3e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802a42:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  802a46:	0f b6 00             	movzbl (%rax),%eax
+  802a49:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  802a4c:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  802a50:	75 07                	jne    802a59 <strstr+0x7f>
+				return (char *) 0;
+  802a52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a57:	eb 37                	jmp    802a90 <strstr+0xb6>
+		} while (sc != c);
+  802a59:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  802a5d:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  802a60:	75 d8                	jne    802a3a <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  802a62:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802a66:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802a6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a6e:	48 89 ce             	mov    %rcx,%rsi
+  802a71:	48 89 c7             	mov    %rax,%rdi
+  802a74:	48 b8 db 93 ff ff ff 	movabs $0xffffffffffff93db,%rax
+  802a7b:	ff ff ff 
+  802a7e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a82:	ff d0                	call   *%rax
+  802a84:	85 c0                	test   %eax,%eax
+  802a86:	75 b2                	jne    802a3a <strstr+0x60>
+
+	return (char *) (in - 1);
+  802a88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a8c:	48 83 e8 01          	sub    $0x1,%rax
+}
+  802a90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a94:	c9                   	leave
+  802a95:	c3                   	ret
+
+0000000000802a96 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  802a96:	55                   	push   %rbp
+  802a97:	48 89 e5             	mov    %rsp,%rbp
+  802a9a:	41 57                	push   %r15
+  802a9c:	53                   	push   %rbx
+  802a9d:	48 83 ec 40          	sub    $0x40,%rsp
+  802aa1:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 802aa1 <syscall+0xb>
+  802aa8:	49 bb 9f 65 00 00 00 	movabs $0x659f,%r11
+  802aaf:	00 00 00 
+  802ab2:	4d 01 da             	add    %r11,%r10
+  802ab5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ab8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  802abb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  802abf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ac3:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  802ac7:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  802acb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ace:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ad2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802ad6:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  802ada:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802ade:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802ae2:	4c 89 c3             	mov    %r8,%rbx
+  802ae5:	cd 30                	int    $0x30
+  802ae7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  802aeb:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  802aef:	74 52                	je     802b43 <syscall+0xad>
+  802af1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802af6:	7e 4b                	jle    802b43 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802af8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802afc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802aff:	49 89 d0             	mov    %rdx,%r8
+  802b02:	89 c1                	mov    %eax,%ecx
+  802b04:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802b0b:	ff ff ff 
+  802b0e:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  802b12:	48 89 c2             	mov    %rax,%rdx
+  802b15:	be 23 00 00 00       	mov    $0x23,%esi
+  802b1a:	48 b8 55 e6 ff ff ff 	movabs $0xffffffffffffe655,%rax
+  802b21:	ff ff ff 
+  802b24:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  802b28:	48 89 c7             	mov    %rax,%rdi
+  802b2b:	4d 89 d7             	mov    %r10,%r15
+  802b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b33:	49 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r9
+  802b3a:	ff ff ff 
+  802b3d:	4d 01 d1             	add    %r10,%r9
+  802b40:	41 ff d1             	call   *%r9
+
+	return ret;
+  802b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802b47:	48 83 c4 40          	add    $0x40,%rsp
+  802b4b:	5b                   	pop    %rbx
+  802b4c:	41 5f                	pop    %r15
+  802b4e:	5d                   	pop    %rbp
+  802b4f:	c3                   	ret
+
+0000000000802b50 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  802b50:	55                   	push   %rbp
+  802b51:	48 89 e5             	mov    %rsp,%rbp
+  802b54:	41 57                	push   %r15
+  802b56:	41 56                	push   %r14
+  802b58:	41 55                	push   %r13
+  802b5a:	41 54                	push   %r12
+  802b5c:	53                   	push   %rbx
+  802b5d:	48 83 ec 48          	sub    $0x48,%rsp
+  802b61:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 802b61 <syscall_words+0x11>
+  802b68:	49 bb df 64 00 00 00 	movabs $0x64df,%r11
+  802b6f:	00 00 00 
+  802b72:	4d 01 de             	add    %r11,%r14
+  802b75:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802b78:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  802b7b:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  802b7f:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  802b83:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  802b87:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  802b8b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802b90:	74 09                	je     802b9b <syscall_words+0x4b>
+  802b92:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802b96:	48 8b 00             	mov    (%rax),%rax
+  802b99:	eb 05                	jmp    802ba0 <syscall_words+0x50>
+  802b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba0:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  802ba3:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802ba8:	74 0a                	je     802bb4 <syscall_words+0x64>
+  802baa:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802bae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802bb2:	eb 05                	jmp    802bb9 <syscall_words+0x69>
+  802bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb9:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  802bbc:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802bc1:	74 0a                	je     802bcd <syscall_words+0x7d>
+  802bc3:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802bc7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802bcb:	eb 05                	jmp    802bd2 <syscall_words+0x82>
+  802bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd2:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  802bd5:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802bda:	74 0a                	je     802be6 <syscall_words+0x96>
+  802bdc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802be0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802be4:	eb 05                	jmp    802beb <syscall_words+0x9b>
+  802be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802beb:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  802bee:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802bf3:	74 0a                	je     802bff <syscall_words+0xaf>
+  802bf5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802bf9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802bfd:	eb 05                	jmp    802c04 <syscall_words+0xb4>
+  802bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c04:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  802c07:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802c0c:	74 0a                	je     802c18 <syscall_words+0xc8>
+  802c0e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802c12:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802c16:	eb 05                	jmp    802c1d <syscall_words+0xcd>
+  802c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1d:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  802c20:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802c23:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  802c27:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802c2b:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802c2f:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  802c33:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802c37:	cd 30                	int    $0x30
+  802c39:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802c3d:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802c42:	74 50                	je     802c94 <syscall_words+0x144>
+		words[0] = r8;
+  802c44:	4c 89 c2             	mov    %r8,%rdx
+  802c47:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802c4b:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802c4e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802c52:	48 83 c0 08          	add    $0x8,%rax
+  802c56:	4c 89 ca             	mov    %r9,%rdx
+  802c59:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802c5c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802c60:	48 83 c0 10          	add    $0x10,%rax
+  802c64:	4c 89 d2             	mov    %r10,%rdx
+  802c67:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  802c6a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802c6e:	48 83 c0 18          	add    $0x18,%rax
+  802c72:	4c 89 da             	mov    %r11,%rdx
+  802c75:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  802c78:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802c7c:	48 83 c0 20          	add    $0x20,%rax
+  802c80:	4c 89 e2             	mov    %r12,%rdx
+  802c83:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  802c86:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802c8a:	48 83 c0 28          	add    $0x28,%rax
+  802c8e:	4c 89 ea             	mov    %r13,%rdx
+  802c91:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  802c94:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  802c98:	74 52                	je     802cec <syscall_words+0x19c>
+  802c9a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802c9f:	7e 4b                	jle    802cec <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802ca1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802ca5:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802ca8:	49 89 d0             	mov    %rdx,%r8
+  802cab:	89 c1                	mov    %eax,%ecx
+  802cad:	48 b8 38 e6 ff ff ff 	movabs $0xffffffffffffe638,%rax
+  802cb4:	ff ff ff 
+  802cb7:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802cbb:	48 89 c2             	mov    %rax,%rdx
+  802cbe:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802cc3:	48 b8 55 e6 ff ff ff 	movabs $0xffffffffffffe655,%rax
+  802cca:	ff ff ff 
+  802ccd:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802cd1:	48 89 c7             	mov    %rax,%rdi
+  802cd4:	4d 89 f7             	mov    %r14,%r15
+  802cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cdc:	49 b9 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r9
+  802ce3:	ff ff ff 
+  802ce6:	4d 01 f1             	add    %r14,%r9
+  802ce9:	41 ff d1             	call   *%r9
+
+	return ret;
+  802cec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802cf0:	48 83 c4 48          	add    $0x48,%rsp
+  802cf4:	5b                   	pop    %rbx
+  802cf5:	41 5c                	pop    %r12
+  802cf7:	41 5d                	pop    %r13
+  802cf9:	41 5e                	pop    %r14
+  802cfb:	41 5f                	pop    %r15
+  802cfd:	5d                   	pop    %rbp
+  802cfe:	c3                   	ret
+
+0000000000802cff <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802cff:	55                   	push   %rbp
+  802d00:	48 89 e5             	mov    %rsp,%rbp
+  802d03:	48 83 ec 10          	sub    $0x10,%rsp
+  802d07:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d07 <sys_cputs+0x8>
+  802d0e:	49 bb 39 63 00 00 00 	movabs $0x6339,%r11
+  802d15:	00 00 00 
+  802d18:	4c 01 d8             	add    %r11,%rax
+  802d1b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d1f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802d23:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d27:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802d2b:	48 83 ec 08          	sub    $0x8,%rsp
+  802d2f:	6a 00                	push   $0x0
+  802d31:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d37:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d3d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d42:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d47:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  802d4e:	ff ff ff 
+  802d51:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802d55:	ff d0                	call   *%rax
+  802d57:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d5b:	90                   	nop
+  802d5c:	c9                   	leave
+  802d5d:	c3                   	ret
+
+0000000000802d5e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802d5e:	55                   	push   %rbp
+  802d5f:	48 89 e5             	mov    %rsp,%rbp
+  802d62:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802d62 <sys_cgetc+0x4>
+  802d69:	49 bb de 62 00 00 00 	movabs $0x62de,%r11
+  802d70:	00 00 00 
+  802d73:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802d76:	48 83 ec 08          	sub    $0x8,%rsp
+  802d7a:	6a 00                	push   $0x0
+  802d7c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d92:	be 00 00 00 00       	mov    $0x0,%esi
+  802d97:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d9c:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  802da3:	ff ff ff 
+  802da6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802daa:	ff d0                	call   *%rax
+  802dac:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802db0:	c9                   	leave
+  802db1:	c3                   	ret
+
+0000000000802db2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802db2:	55                   	push   %rbp
+  802db3:	48 89 e5             	mov    %rsp,%rbp
+  802db6:	48 83 ec 10          	sub    $0x10,%rsp
+  802dba:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802dba <sys_env_destroy+0x8>
+  802dc1:	49 bb 86 62 00 00 00 	movabs $0x6286,%r11
+  802dc8:	00 00 00 
+  802dcb:	4c 01 d8             	add    %r11,%rax
+  802dce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802dd1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802dd4:	48 63 d2             	movslq %edx,%rdx
+  802dd7:	48 83 ec 08          	sub    $0x8,%rsp
+  802ddb:	6a 00                	push   $0x0
+  802ddd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802de3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802de9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802dee:	be 01 00 00 00       	mov    $0x1,%esi
+  802df3:	bf 03 00 00 00       	mov    $0x3,%edi
+  802df8:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  802dff:	ff ff ff 
+  802e02:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e06:	ff d0                	call   *%rax
+  802e08:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e0c:	c9                   	leave
+  802e0d:	c3                   	ret
+
+0000000000802e0e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802e0e:	55                   	push   %rbp
+  802e0f:	48 89 e5             	mov    %rsp,%rbp
+  802e12:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e12 <sys_getenvid+0x4>
+  802e19:	49 bb 2e 62 00 00 00 	movabs $0x622e,%r11
+  802e20:	00 00 00 
+  802e23:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802e26:	48 83 ec 08          	sub    $0x8,%rsp
+  802e2a:	6a 00                	push   $0x0
+  802e2c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e42:	be 00 00 00 00       	mov    $0x0,%esi
+  802e47:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e4c:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  802e53:	ff ff ff 
+  802e56:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802e5a:	ff d0                	call   *%rax
+  802e5c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e60:	c9                   	leave
+  802e61:	c3                   	ret
+
+0000000000802e62 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802e62:	55                   	push   %rbp
+  802e63:	48 89 e5             	mov    %rsp,%rbp
+  802e66:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802e66 <sys_yield+0x4>
+  802e6d:	49 bb da 61 00 00 00 	movabs $0x61da,%r11
+  802e74:	00 00 00 
+  802e77:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802e7a:	48 83 ec 08          	sub    $0x8,%rsp
+  802e7e:	6a 00                	push   $0x0
+  802e80:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e91:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e96:	be 00 00 00 00       	mov    $0x0,%esi
+  802e9b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802ea0:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  802ea7:	ff ff ff 
+  802eaa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802eae:	ff d0                	call   *%rax
+  802eb0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802eb4:	90                   	nop
+  802eb5:	c9                   	leave
+  802eb6:	c3                   	ret
+
+0000000000802eb7 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802eb7:	55                   	push   %rbp
+  802eb8:	48 89 e5             	mov    %rsp,%rbp
+  802ebb:	48 83 ec 10          	sub    $0x10,%rsp
+  802ebf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ebf <sys_page_alloc+0x8>
+  802ec6:	49 bb 81 61 00 00 00 	movabs $0x6181,%r11
+  802ecd:	00 00 00 
+  802ed0:	4c 01 d8             	add    %r11,%rax
+  802ed3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802ed6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802eda:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802edd:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802ee0:	48 63 f2             	movslq %edx,%rsi
+  802ee3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802ee7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802eea:	48 63 d2             	movslq %edx,%rdx
+  802eed:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef1:	6a 00                	push   $0x0
+  802ef3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ef9:	49 89 f0             	mov    %rsi,%r8
+  802efc:	be 01 00 00 00       	mov    $0x1,%esi
+  802f01:	bf 04 00 00 00       	mov    $0x4,%edi
+  802f06:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  802f0d:	ff ff ff 
+  802f10:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f14:	ff d0                	call   *%rax
+  802f16:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f1a:	c9                   	leave
+  802f1b:	c3                   	ret
+
+0000000000802f1c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802f1c:	55                   	push   %rbp
+  802f1d:	48 89 e5             	mov    %rsp,%rbp
+  802f20:	48 83 ec 20          	sub    $0x20,%rsp
+  802f24:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f24 <sys_page_map+0x8>
+  802f2b:	49 bb 1c 61 00 00 00 	movabs $0x611c,%r11
+  802f32:	00 00 00 
+  802f35:	4c 01 d8             	add    %r11,%rax
+  802f38:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802f3b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802f3f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802f42:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802f46:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  802f4a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802f4d:	48 63 f2             	movslq %edx,%rsi
+  802f50:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802f54:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802f57:	48 63 fa             	movslq %edx,%rdi
+  802f5a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802f5e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802f61:	48 63 d2             	movslq %edx,%rdx
+  802f64:	48 83 ec 08          	sub    $0x8,%rsp
+  802f68:	56                   	push   %rsi
+  802f69:	4d 89 c1             	mov    %r8,%r9
+  802f6c:	49 89 f8             	mov    %rdi,%r8
+  802f6f:	be 01 00 00 00       	mov    $0x1,%esi
+  802f74:	bf 05 00 00 00       	mov    $0x5,%edi
+  802f79:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  802f80:	ff ff ff 
+  802f83:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802f87:	ff d0                	call   *%rax
+  802f89:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f8d:	c9                   	leave
+  802f8e:	c3                   	ret
+
+0000000000802f8f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802f8f:	55                   	push   %rbp
+  802f90:	48 89 e5             	mov    %rsp,%rbp
+  802f93:	48 83 ec 10          	sub    $0x10,%rsp
+  802f97:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802f97 <sys_page_unmap+0x8>
+  802f9e:	49 bb a9 60 00 00 00 	movabs $0x60a9,%r11
+  802fa5:	00 00 00 
+  802fa8:	4c 01 d8             	add    %r11,%rax
+  802fab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802fae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802fb2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802fb6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802fb9:	48 63 d2             	movslq %edx,%rdx
+  802fbc:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc0:	6a 00                	push   $0x0
+  802fc2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802fc8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fce:	be 01 00 00 00       	mov    $0x1,%esi
+  802fd3:	bf 06 00 00 00       	mov    $0x6,%edi
+  802fd8:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  802fdf:	ff ff ff 
+  802fe2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802fe6:	ff d0                	call   *%rax
+  802fe8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802fec:	c9                   	leave
+  802fed:	c3                   	ret
+
+0000000000802fee <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802fee:	55                   	push   %rbp
+  802fef:	48 89 e5             	mov    %rsp,%rbp
+  802ff2:	48 83 ec 10          	sub    $0x10,%rsp
+  802ff6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802ff6 <sys_env_set_status+0x8>
+  802ffd:	49 bb 4a 60 00 00 00 	movabs $0x604a,%r11
+  803004:	00 00 00 
+  803007:	4c 01 d8             	add    %r11,%rax
+  80300a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80300d:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  803010:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803013:	48 63 ca             	movslq %edx,%rcx
+  803016:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803019:	48 63 d2             	movslq %edx,%rdx
+  80301c:	48 83 ec 08          	sub    $0x8,%rsp
+  803020:	6a 00                	push   $0x0
+  803022:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803028:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80302e:	be 01 00 00 00       	mov    $0x1,%esi
+  803033:	bf 08 00 00 00       	mov    $0x8,%edi
+  803038:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  80303f:	ff ff ff 
+  803042:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803046:	ff d0                	call   *%rax
+  803048:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80304c:	c9                   	leave
+  80304d:	c3                   	ret
+
+000000000080304e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80304e:	55                   	push   %rbp
+  80304f:	48 89 e5             	mov    %rsp,%rbp
+  803052:	48 83 ec 10          	sub    $0x10,%rsp
+  803056:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803056 <sys_env_set_trapframe+0x8>
+  80305d:	49 bb ea 5f 00 00 00 	movabs $0x5fea,%r11
+  803064:	00 00 00 
+  803067:	4c 01 d8             	add    %r11,%rax
+  80306a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80306d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  803071:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803075:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803078:	48 63 d2             	movslq %edx,%rdx
+  80307b:	48 83 ec 08          	sub    $0x8,%rsp
+  80307f:	6a 00                	push   $0x0
+  803081:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803087:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80308d:	be 01 00 00 00       	mov    $0x1,%esi
+  803092:	bf 09 00 00 00       	mov    $0x9,%edi
+  803097:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  80309e:	ff ff ff 
+  8030a1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8030a5:	ff d0                	call   *%rax
+  8030a7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8030ab:	c9                   	leave
+  8030ac:	c3                   	ret
+
+00000000008030ad <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8030ad:	55                   	push   %rbp
+  8030ae:	48 89 e5             	mov    %rsp,%rbp
+  8030b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8030b5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8030b5 <sys_env_set_pgfault_upcall+0x8>
+  8030bc:	49 bb 8b 5f 00 00 00 	movabs $0x5f8b,%r11
+  8030c3:	00 00 00 
+  8030c6:	4c 01 d8             	add    %r11,%rax
+  8030c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8030cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8030d0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8030d4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8030d7:	48 63 d2             	movslq %edx,%rdx
+  8030da:	48 83 ec 08          	sub    $0x8,%rsp
+  8030de:	6a 00                	push   $0x0
+  8030e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8030f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8030f6:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  8030fd:	ff ff ff 
+  803100:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803104:	ff d0                	call   *%rax
+  803106:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80310a:	c9                   	leave
+  80310b:	c3                   	ret
+
+000000000080310c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80310c:	55                   	push   %rbp
+  80310d:	48 89 e5             	mov    %rsp,%rbp
+  803110:	48 83 ec 20          	sub    $0x20,%rsp
+  803114:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803114 <sys_ipc_try_send+0x8>
+  80311b:	49 bb 2c 5f 00 00 00 	movabs $0x5f2c,%r11
+  803122:	00 00 00 
+  803125:	4c 01 d8             	add    %r11,%rax
+  803128:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80312b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80312f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803133:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  803136:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803139:	48 63 fa             	movslq %edx,%rdi
+  80313c:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  803140:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803143:	48 63 d2             	movslq %edx,%rdx
+  803146:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80314a:	48 83 ec 08          	sub    $0x8,%rsp
+  80314e:	6a 00                	push   $0x0
+  803150:	49 89 f9             	mov    %rdi,%r9
+  803153:	49 89 f0             	mov    %rsi,%r8
+  803156:	be 00 00 00 00       	mov    $0x0,%esi
+  80315b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803160:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  803167:	ff ff ff 
+  80316a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80316e:	ff d0                	call   *%rax
+  803170:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803174:	c9                   	leave
+  803175:	c3                   	ret
+
+0000000000803176 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  803176:	55                   	push   %rbp
+  803177:	48 89 e5             	mov    %rsp,%rbp
+  80317a:	48 83 ec 20          	sub    $0x20,%rsp
+  80317e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80317e <sys_ipc_send+0x8>
+  803185:	49 bb c2 5e 00 00 00 	movabs $0x5ec2,%r11
+  80318c:	00 00 00 
+  80318f:	4c 01 d8             	add    %r11,%rax
+  803192:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803195:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803199:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80319d:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8031a0:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8031a3:	48 63 fa             	movslq %edx,%rdi
+  8031a6:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8031aa:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8031ad:	48 63 d2             	movslq %edx,%rdx
+  8031b0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8031b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8031b8:	6a 00                	push   $0x0
+  8031ba:	49 89 f9             	mov    %rdi,%r9
+  8031bd:	49 89 f0             	mov    %rsi,%r8
+  8031c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8031c5:	bf 17 00 00 00       	mov    $0x17,%edi
+  8031ca:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  8031d1:	ff ff ff 
+  8031d4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8031d8:	ff d0                	call   *%rax
+  8031da:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031de:	c9                   	leave
+  8031df:	c3                   	ret
+
+00000000008031e0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8031e0:	55                   	push   %rbp
+  8031e1:	48 89 e5             	mov    %rsp,%rbp
+  8031e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8031e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8031e8 <sys_ipc_recv+0x8>
+  8031ef:	49 bb 58 5e 00 00 00 	movabs $0x5e58,%r11
+  8031f6:	00 00 00 
+  8031f9:	4c 01 d8             	add    %r11,%rax
+  8031fc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  803200:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803204:	6a 00                	push   $0x0
+  803206:	6a 00                	push   $0x0
+  803208:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80320e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803214:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803219:	be 01 00 00 00       	mov    $0x1,%esi
+  80321e:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803223:	49 ba 10 9b ff ff ff 	movabs $0xffffffffffff9b10,%r10
+  80322a:	ff ff ff 
+  80322d:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803231:	ff d0                	call   *%rax
+  803233:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803237:	c9                   	leave
+  803238:	c3                   	ret
+
+0000000000803239 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  803239:	55                   	push   %rbp
+  80323a:	48 89 e5             	mov    %rsp,%rbp
+  80323d:	48 83 ec 30          	sub    $0x30,%rsp
+  803241:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803241 <sys_ipc_call+0x8>
+  803248:	49 bb ff 5d 00 00 00 	movabs $0x5dff,%r11
+  80324f:	00 00 00 
+  803252:	4c 01 d8             	add    %r11,%rax
+  803255:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803258:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80325c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803260:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  803263:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  803267:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80326b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80326f:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803272:	4c 63 c2             	movslq %edx,%r8
+  803275:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  803279:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80327c:	48 63 d2             	movslq %edx,%rdx
+  80327f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  803283:	ff 75 d8             	push   -0x28(%rbp)
+  803286:	56                   	push   %rsi
+  803287:	4d 89 c1             	mov    %r8,%r9
+  80328a:	49 89 f8             	mov    %rdi,%r8
+  80328d:	be 00 00 00 00       	mov    $0x0,%esi
+  803292:	bf 18 00 00 00       	mov    $0x18,%edi
+  803297:	49 ba 10 9b ff ff ff 	movabs $0xffffffffffff9b10,%r10
+  80329e:	ff ff ff 
+  8032a1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8032a5:	ff d0                	call   *%rax
+  8032a7:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8032ab:	c9                   	leave
+  8032ac:	c3                   	ret
+
+00000000008032ad <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8032ad:	55                   	push   %rbp
+  8032ae:	48 89 e5             	mov    %rsp,%rbp
+  8032b1:	48 83 ec 30          	sub    $0x30,%rsp
+  8032b5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8032b5 <sys_ipc_reply_recv+0x8>
+  8032bc:	49 bb 8b 5d 00 00 00 	movabs $0x5d8b,%r11
+  8032c3:	00 00 00 
+  8032c6:	4c 01 d8             	add    %r11,%rax
+  8032c9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8032cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8032d0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8032d4:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8032d7:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8032db:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8032df:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8032e3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8032e6:	4c 63 c2             	movslq %edx,%r8
+  8032e9:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8032ed:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8032f0:	48 63 d2             	movslq %edx,%rdx
+  8032f3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8032f7:	ff 75 d8             	push   -0x28(%rbp)
+  8032fa:	56                   	push   %rsi
+  8032fb:	4d 89 c1             	mov    %r8,%r9
+  8032fe:	49 89 f8             	mov    %rdi,%r8
+  803301:	be 00 00 00 00       	mov    $0x0,%esi
+  803306:	bf 19 00 00 00       	mov    $0x19,%edi
+  80330b:	49 ba 10 9b ff ff ff 	movabs $0xffffffffffff9b10,%r10
+  803312:	ff ff ff 
+  803315:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803319:	ff d0                	call   *%rax
+  80331b:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80331f:	c9                   	leave
+  803320:	c3                   	ret
+
+0000000000803321 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  803321:	55                   	push   %rbp
+  803322:	48 89 e5             	mov    %rsp,%rbp
+  803325:	48 83 ec 10          	sub    $0x10,%rsp
+  803329:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803329 <sys_env_set_priority+0x8>
+  803330:	49 bb 17 5d 00 00 00 	movabs $0x5d17,%r11
+  803337:	00 00 00 
+  80333a:	4c 01 d8             	add    %r11,%rax
+  80333d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803340:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  803343:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  803346:	48 63 ca             	movslq %edx,%rcx
+  803349:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80334c:	48 63 d2             	movslq %edx,%rdx
+  80334f:	48 83 ec 08          	sub    $0x8,%rsp
+  803353:	6a 00                	push   $0x0
+  803355:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80335b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803361:	be 01 00 00 00       	mov    $0x1,%esi
+  803366:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80336b:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  803372:	ff ff ff 
+  803375:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803379:	ff d0                	call   *%rax
+  80337b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80337f:	c9                   	leave
+  803380:	c3                   	ret
+
+0000000000803381 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  803381:	55                   	push   %rbp
+  803382:	48 89 e5             	mov    %rsp,%rbp
+  803385:	48 83 ec 10          	sub    $0x10,%rsp
+  803389:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803389 <sys_env_set_affinity+0x8>
+  803390:	49 bb b7 5c 00 00 00 	movabs $0x5cb7,%r11
+  803397:	00 00 00 
+  80339a:	4c 01 d8             	add    %r11,%rax
+  80339d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8033a0:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8033a3:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8033a6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8033a9:	48 63 d2             	movslq %edx,%rdx
+  8033ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8033b0:	6a 00                	push   $0x0
+  8033b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8033b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8033be:	be 01 00 00 00       	mov    $0x1,%esi
+  8033c3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8033c8:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  8033cf:	ff ff ff 
+  8033d2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8033d6:	ff d0                	call   *%rax
+  8033d8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8033dc:	c9                   	leave
+  8033dd:	c3                   	ret
+
+00000000008033de <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8033de:	55                   	push   %rbp
+  8033df:	48 89 e5             	mov    %rsp,%rbp
+  8033e2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8033e2 <sys_time_msec+0x4>
+  8033e9:	49 bb 5e 5c 00 00 00 	movabs $0x5c5e,%r11
+  8033f0:	00 00 00 
+  8033f3:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8033f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8033fa:	6a 00                	push   $0x0
+  8033fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803402:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803408:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80340d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803412:	be 00 00 00 00       	mov    $0x0,%esi
+  803417:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80341c:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  803423:	ff ff ff 
+  803426:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80342a:	ff d0                	call   *%rax
+  80342c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803430:	c9                   	leave
+  803431:	c3                   	ret
+
+0000000000803432 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  803432:	55                   	push   %rbp
+  803433:	48 89 e5             	mov    %rsp,%rbp
+  803436:	48 83 ec 10          	sub    $0x10,%rsp
+  80343a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80343a <sys_sleep_usec+0x8>
+  803441:	49 bb 06 5c 00 00 00 	movabs $0x5c06,%r11
+  803448:	00 00 00 
+  80344b:	4c 01 d8             	add    %r11,%rax
+  80344e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  803452:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803456:	48 83 ec 08          	sub    $0x8,%rsp
+  80345a:	6a 00                	push   $0x0
+  80345c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803462:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803468:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80346d:	be 00 00 00 00       	mov    $0x0,%esi
+  803472:	bf 11 00 00 00       	mov    $0x11,%edi
+  803477:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  80347e:	ff ff ff 
+  803481:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803485:	ff d0                	call   *%rax
+  803487:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80348b:	c9                   	leave
+  80348c:	c3                   	ret
+
+000000000080348d <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80348d:	55                   	push   %rbp
+  80348e:	48 89 e5             	mov    %rsp,%rbp
+  803491:	48 83 ec 10          	sub    $0x10,%rsp
+  803495:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803495 <sys_page_alloc_huge+0x8>
+  80349c:	49 bb ab 5b 00 00 00 	movabs $0x5bab,%r11
+  8034a3:	00 00 00 
+  8034a6:	4c 01 d8             	add    %r11,%rax
+  8034a9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8034ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8034b0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8034b3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8034b6:	48 63 f2             	movslq %edx,%rsi
+  8034b9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8034bd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8034c0:	48 63 d2             	movslq %edx,%rdx
+  8034c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8034c7:	6a 00                	push   $0x0
+  8034c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8034cf:	49 89 f0             	mov    %rsi,%r8
+  8034d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8034d7:	bf 12 00 00 00       	mov    $0x12,%edi
+  8034dc:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  8034e3:	ff ff ff 
+  8034e6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8034ea:	ff d0                	call   *%rax
+  8034ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8034f0:	c9                   	leave
+  8034f1:	c3                   	ret
+
+00000000008034f2 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8034f2:	55                   	push   %rbp
+  8034f3:	48 89 e5             	mov    %rsp,%rbp
+  8034f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8034fa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8034fa <sys_page_map_batch+0x8>
+  803501:	49 bb 46 5b 00 00 00 	movabs $0x5b46,%r11
+  803508:	00 00 00 
+  80350b:	4c 01 d8             	add    %r11,%rax
+  80350e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803512:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  803516:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80351a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80351e:	48 83 ec 08          	sub    $0x8,%rsp
+  803522:	6a 00                	push   $0x0
+  803524:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80352a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803530:	be 01 00 00 00       	mov    $0x1,%esi
+  803535:	bf 13 00 00 00       	mov    $0x13,%edi
+  80353a:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  803541:	ff ff ff 
+  803544:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803548:	ff d0                	call   *%rax
+  80354a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80354e:	c9                   	leave
+  80354f:	c3                   	ret
+
+0000000000803550 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  803550:	55                   	push   %rbp
+  803551:	48 89 e5             	mov    %rsp,%rbp
+  803554:	48 83 ec 10          	sub    $0x10,%rsp
+  803558:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803558 <sys_page_alloc_batch+0x8>
+  80355f:	49 bb e8 5a 00 00 00 	movabs $0x5ae8,%r11
+  803566:	00 00 00 
+  803569:	4c 01 d8             	add    %r11,%rax
+  80356c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803570:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  803574:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803578:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80357c:	48 83 ec 08          	sub    $0x8,%rsp
+  803580:	6a 00                	push   $0x0
+  803582:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803588:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80358e:	be 01 00 00 00       	mov    $0x1,%esi
+  803593:	bf 14 00 00 00       	mov    $0x14,%edi
+  803598:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  80359f:	ff ff ff 
+  8035a2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8035a6:	ff d0                	call   *%rax
+  8035a8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8035ac:	c9                   	leave
+  8035ad:	c3                   	ret
+
+00000000008035ae <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8035ae:	55                   	push   %rbp
+  8035af:	48 89 e5             	mov    %rsp,%rbp
+  8035b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8035b6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8035b6 <sys_page_unmap_batch+0x8>
+  8035bd:	49 bb 8a 5a 00 00 00 	movabs $0x5a8a,%r11
+  8035c4:	00 00 00 
+  8035c7:	4c 01 d8             	add    %r11,%rax
+  8035ca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8035ce:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8035d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8035d6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8035da:	48 83 ec 08          	sub    $0x8,%rsp
+  8035de:	6a 00                	push   $0x0
+  8035e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8035e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8035ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8035f1:	bf 15 00 00 00       	mov    $0x15,%edi
+  8035f6:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  8035fd:	ff ff ff 
+  803600:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803604:	ff d0                	call   *%rax
+  803606:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80360a:	c9                   	leave
+  80360b:	c3                   	ret
+
+000000000080360c <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80360c:	55                   	push   %rbp
+  80360d:	48 89 e5             	mov    %rsp,%rbp
+  803610:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803610 <sys_fork+0x4>
+  803617:	49 bb 30 5a 00 00 00 	movabs $0x5a30,%r11
+  80361e:	00 00 00 
+  803621:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  803624:	48 83 ec 08          	sub    $0x8,%rsp
+  803628:	6a 00                	push   $0x0
+  80362a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803630:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803636:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80363b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803640:	be 00 00 00 00       	mov    $0x0,%esi
+  803645:	bf 16 00 00 00       	mov    $0x16,%edi
+  80364a:	49 ba 56 9a ff ff ff 	movabs $0xffffffffffff9a56,%r10
+  803651:	ff ff ff 
+  803654:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  803658:	ff d0                	call   *%rax
+  80365a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80365e:	c9                   	leave
+  80365f:	c3                   	ret
+
+0000000000803660 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803660:	55                   	push   %rbp
+  803661:	48 89 e5             	mov    %rsp,%rbp
+  803664:	41 57                	push   %r15
+  803666:	53                   	push   %rbx
+  803667:	48 83 ec 30          	sub    $0x30,%rsp
+  80366b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80366b <ipc_recv+0xb>
+  803672:	49 bb d5 59 00 00 00 	movabs $0x59d5,%r11
+  803679:	00 00 00 
+  80367c:	4c 01 db             	add    %r11,%rbx
+  80367f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803683:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803687:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80368b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803690:	75 0e                	jne    8036a0 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  803692:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803699:	00 00 00 
+  80369c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8036a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036a4:	48 89 c7             	mov    %rax,%rdi
+  8036a7:	49 89 df             	mov    %rbx,%r15
+  8036aa:	48 b8 a0 a1 ff ff ff 	movabs $0xffffffffffffa1a0,%rax
+  8036b1:	ff ff ff 
+  8036b4:	48 01 d8             	add    %rbx,%rax
+  8036b7:	ff d0                	call   *%rax
+  8036b9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8036bc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8036c1:	74 2a                	je     8036ed <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8036c3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036c7:	75 19                	jne    8036e2 <ipc_recv+0x82>
+  8036c9:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8036d0:	ff ff ff 
+  8036d3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036d7:	48 8b 00             	mov    (%rax),%rax
+  8036da:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8036e0:	eb 05                	jmp    8036e7 <ipc_recv+0x87>
+  8036e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8036eb:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8036ed:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8036f2:	74 2a                	je     80371e <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8036f4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036f8:	75 19                	jne    803713 <ipc_recv+0xb3>
+  8036fa:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  803701:	ff ff ff 
+  803704:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803708:	48 8b 00             	mov    (%rax),%rax
+  80370b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803711:	eb 05                	jmp    803718 <ipc_recv+0xb8>
+  803713:	b8 00 00 00 00       	mov    $0x0,%eax
+  803718:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80371c:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80371e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803722:	74 05                	je     803729 <ipc_recv+0xc9>
+		return res;
+  803724:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803727:	eb 17                	jmp    803740 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  803729:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  803730:	ff ff ff 
+  803733:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803737:	48 8b 00             	mov    (%rax),%rax
+  80373a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803740:	48 83 c4 30          	add    $0x30,%rsp
+  803744:	5b                   	pop    %rbx
+  803745:	41 5f                	pop    %r15
+  803747:	5d                   	pop    %rbp
+  803748:	c3                   	ret
+
+0000000000803749 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803749:	55                   	push   %rbp
+  80374a:	48 89 e5             	mov    %rsp,%rbp
+  80374d:	41 57                	push   %r15
+  80374f:	53                   	push   %rbx
+  803750:	48 83 ec 20          	sub    $0x20,%rsp
+  803754:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803754 <ipc_send+0xb>
+  80375b:	49 bb ec 58 00 00 00 	movabs $0x58ec,%r11
+  803762:	00 00 00 
+  803765:	4c 01 db             	add    %r11,%rbx
+  803768:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80376b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80376e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803772:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  803775:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80377a:	75 0e                	jne    80378a <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  80377c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803783:	00 00 00 
+  803786:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  80378a:	90                   	nop
+  80378b:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80378e:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803791:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803795:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803798:	89 c7                	mov    %eax,%edi
+  80379a:	49 89 df             	mov    %rbx,%r15
+  80379d:	48 b8 36 a1 ff ff ff 	movabs $0xffffffffffffa136,%rax
+  8037a4:	ff ff ff 
+  8037a7:	48 01 d8             	add    %rbx,%rax
+  8037aa:	ff d0                	call   *%rax
+  8037ac:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8037af:	74 da                	je     80378b <ipc_send+0x42>
+		;
+}
+  8037b1:	90                   	nop
+  8037b2:	90                   	nop
+  8037b3:	48 83 c4 20          	add    $0x20,%rsp
+  8037b7:	5b                   	pop    %rbx
+  8037b8:	41 5f                	pop    %r15
+  8037ba:	5d                   	pop    %rbp
+  8037bb:	c3                   	ret
+
+00000000008037bc <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8037bc:	55                   	push   %rbp
+  8037bd:	48 89 e5             	mov    %rsp,%rbp
+  8037c0:	41 57                	push   %r15
+  8037c2:	53                   	push   %rbx
+  8037c3:	48 83 ec 40          	sub    $0x40,%rsp
+  8037c7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037c7 <ipc_call+0xb>
+  8037ce:	49 bb 79 58 00 00 00 	movabs $0x5879,%r11
+  8037d5:	00 00 00 
+  8037d8:	4c 01 db             	add    %r11,%rbx
+  8037db:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8037de:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8037e1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8037e5:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8037e8:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8037ec:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8037f0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8037f5:	75 0e                	jne    803805 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  8037f7:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8037fe:	00 00 00 
+  803801:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803805:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80380a:	75 0e                	jne    80381a <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80380c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803813:	00 00 00 
+  803816:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80381a:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80381d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803821:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803824:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803828:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80382b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803831:	49 89 f8             	mov    %rdi,%r8
+  803834:	89 c7                	mov    %eax,%edi
+  803836:	49 89 df             	mov    %rbx,%r15
+  803839:	48 b8 f9 a1 ff ff ff 	movabs $0xffffffffffffa1f9,%rax
+  803840:	ff ff ff 
+  803843:	48 01 d8             	add    %rbx,%rax
+  803846:	ff d0                	call   *%rax
+  803848:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80384b:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803850:	74 2a                	je     80387c <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803852:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803856:	75 19                	jne    803871 <ipc_call+0xb5>
+  803858:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  80385f:	ff ff ff 
+  803862:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803866:	48 8b 00             	mov    (%rax),%rax
+  803869:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80386f:	eb 05                	jmp    803876 <ipc_call+0xba>
+  803871:	b8 00 00 00 00       	mov    $0x0,%eax
+  803876:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80387a:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  80387c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803880:	74 05                	je     803887 <ipc_call+0xcb>
+		return r;
+  803882:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803885:	eb 17                	jmp    80389e <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  803887:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  80388e:	ff ff ff 
+  803891:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803895:	48 8b 00             	mov    (%rax),%rax
+  803898:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80389e:	48 83 c4 40          	add    $0x40,%rsp
+  8038a2:	5b                   	pop    %rbx
+  8038a3:	41 5f                	pop    %r15
+  8038a5:	5d                   	pop    %rbp
+  8038a6:	c3                   	ret
+
+00000000008038a7 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8038a7:	55                   	push   %rbp
+  8038a8:	48 89 e5             	mov    %rsp,%rbp
+  8038ab:	41 57                	push   %r15
+  8038ad:	53                   	push   %rbx
+  8038ae:	48 83 ec 70          	sub    $0x70,%rsp
+  8038b2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038b2 <ipc_callw+0xb>
+  8038b9:	49 bb 8e 57 00 00 00 	movabs $0x578e,%r11
+  8038c0:	00 00 00 
+  8038c3:	4c 01 db             	add    %r11,%rbx
+  8038c6:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8038c9:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8038cc:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8038d0:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8038d4:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8038d9:	76 0a                	jbe    8038e5 <ipc_callw+0x3e>
+		return -E_INVAL;
+  8038db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038e0:	e9 b7 00 00 00       	jmp    80399c <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  8038e5:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8038e9:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8038ed:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8038f1:	48 89 ce             	mov    %rcx,%rsi
+  8038f4:	48 89 c7             	mov    %rax,%rdi
+  8038f7:	49 89 df             	mov    %rbx,%r15
+  8038fa:	48 b8 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rax
+  803901:	ff ff ff 
+  803904:	48 01 d8             	add    %rbx,%rax
+  803907:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  803909:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803910:	00 
+  803911:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803915:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803919:	48 01 d0             	add    %rdx,%rax
+  80391c:	48 83 e8 01          	sub    $0x1,%rax
+  803920:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803924:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803928:	ba 00 00 00 00       	mov    $0x0,%edx
+  80392d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803931:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803935:	48 29 d0             	sub    %rdx,%rax
+  803938:	48 c1 e8 03          	shr    $0x3,%rax
+  80393c:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  803940:	89 c1                	mov    %eax,%ecx
+  803942:	8b 75 98             	mov    -0x68(%rbp),%esi
+  803945:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  803949:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80394c:	49 89 d1             	mov    %rdx,%r9
+  80394f:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  803956:	00 00 00 
+  803959:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  803960:	00 00 00 
+  803963:	89 c7                	mov    %eax,%edi
+  803965:	49 89 df             	mov    %rbx,%r15
+  803968:	48 b8 f9 a1 ff ff ff 	movabs $0xffffffffffffa1f9,%rax
+  80396f:	ff ff ff 
+  803972:	48 01 d8             	add    %rbx,%rax
+  803975:	ff d0                	call   *%rax
+  803977:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  80397a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80397e:	74 05                	je     803985 <ipc_callw+0xde>
+		return r;
+  803980:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803983:	eb 17                	jmp    80399c <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  803985:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  80398c:	ff ff ff 
+  80398f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803993:	48 8b 00             	mov    (%rax),%rax
+  803996:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80399c:	48 83 c4 70          	add    $0x70,%rsp
+  8039a0:	5b                   	pop    %rbx
+  8039a1:	41 5f                	pop    %r15
+  8039a3:	5d                   	pop    %rbp
+  8039a4:	c3                   	ret
+
+00000000008039a5 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8039a5:	55                   	push   %rbp
+  8039a6:	48 89 e5             	mov    %rsp,%rbp
+  8039a9:	41 57                	push   %r15
+  8039ab:	53                   	push   %rbx
+  8039ac:	48 83 ec 40          	sub    $0x40,%rsp
+  8039b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039b0 <ipc_callv+0xb>
+  8039b7:	49 bb 90 56 00 00 00 	movabs $0x5690,%r11
+  8039be:	00 00 00 
+  8039c1:	4c 01 db             	add    %r11,%rbx
+  8039c4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8039c7:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8039ca:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8039ce:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8039d1:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8039d5:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  8039d9:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8039e0:	00 00 00 
+  8039e3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  8039e7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  8039eb:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8039ef:	74 11                	je     803a02 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  8039f1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039f5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  8039f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039fc:	c1 e0 14             	shl    $0x14,%eax
+  8039ff:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  803a02:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  803a06:	74 14                	je     803a1c <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  803a08:	8b 45 20             	mov    0x20(%rbp),%eax
+  803a0b:	83 e8 01             	sub    $0x1,%eax
+  803a0e:	48 63 d0             	movslq %eax,%rdx
+  803a11:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803a15:	48 09 d0             	or     %rdx,%rax
+  803a18:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  803a1c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  803a1f:	c1 e0 10             	shl    $0x10,%eax
+  803a22:	0b 45 10             	or     0x10(%rbp),%eax
+  803a25:	89 c1                	mov    %eax,%ecx
+  803a27:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  803a2a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  803a2e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  803a32:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803a36:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803a39:	4d 89 c1             	mov    %r8,%r9
+  803a3c:	49 89 f8             	mov    %rdi,%r8
+  803a3f:	89 c7                	mov    %eax,%edi
+  803a41:	49 89 df             	mov    %rbx,%r15
+  803a44:	48 b8 f9 a1 ff ff ff 	movabs $0xffffffffffffa1f9,%rax
+  803a4b:	ff ff ff 
+  803a4e:	48 01 d8             	add    %rbx,%rax
+  803a51:	ff d0                	call   *%rax
+  803a53:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  803a56:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803a5a:	74 05                	je     803a61 <ipc_callv+0xbc>
+		return r;
+  803a5c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a5f:	eb 17                	jmp    803a78 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  803a61:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  803a68:	ff ff ff 
+  803a6b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a6f:	48 8b 00             	mov    (%rax),%rax
+  803a72:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803a78:	48 83 c4 40          	add    $0x40,%rsp
+  803a7c:	5b                   	pop    %rbx
+  803a7d:	41 5f                	pop    %r15
+  803a7f:	5d                   	pop    %rbp
+  803a80:	c3                   	ret
+
+0000000000803a81 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  803a81:	55                   	push   %rbp
+  803a82:	48 89 e5             	mov    %rsp,%rbp
+  803a85:	41 57                	push   %r15
+  803a87:	53                   	push   %rbx
+  803a88:	48 83 ec 40          	sub    $0x40,%rsp
+  803a8c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a8c <ipc_reply_recv+0xb>
+  803a93:	49 bb b4 55 00 00 00 	movabs $0x55b4,%r11
+  803a9a:	00 00 00 
+  803a9d:	4c 01 db             	add    %r11,%rbx
+  803aa0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803aa3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803aa6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803aaa:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803aad:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803ab1:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803ab5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803aba:	75 0e                	jne    803aca <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  803abc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803ac3:	00 00 00 
+  803ac6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803aca:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803acf:	75 0e                	jne    803adf <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803ad1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803ad8:	00 00 00 
+  803adb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803adf:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803ae2:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  803ae6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803aea:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803aed:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803af1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803af4:	4d 89 c1             	mov    %r8,%r9
+  803af7:	49 89 f8             	mov    %rdi,%r8
+  803afa:	89 c7                	mov    %eax,%edi
+  803afc:	49 89 df             	mov    %rbx,%r15
+  803aff:	48 b8 6d a2 ff ff ff 	movabs $0xffffffffffffa26d,%rax
+  803b06:	ff ff ff 
+  803b09:	48 01 d8             	add    %rbx,%rax
+  803b0c:	ff d0                	call   *%rax
+  803b0e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  803b11:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803b16:	74 2a                	je     803b42 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803b18:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b1c:	75 19                	jne    803b37 <ipc_reply_recv+0xb6>
+  803b1e:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  803b25:	ff ff ff 
+  803b28:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b2c:	48 8b 00             	mov    (%rax),%rax
+  803b2f:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803b35:	eb 05                	jmp    803b3c <ipc_reply_recv+0xbb>
+  803b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b40:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  803b42:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  803b47:	74 2a                	je     803b73 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803b49:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b4d:	75 19                	jne    803b68 <ipc_reply_recv+0xe7>
+  803b4f:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  803b56:	ff ff ff 
+  803b59:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b5d:	48 8b 00             	mov    (%rax),%rax
+  803b60:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803b66:	eb 05                	jmp    803b6d <ipc_reply_recv+0xec>
+  803b68:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b6d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  803b71:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803b73:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b77:	74 05                	je     803b7e <ipc_reply_recv+0xfd>
+		return r;
+  803b79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b7c:	eb 17                	jmp    803b95 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  803b7e:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  803b85:	ff ff ff 
+  803b88:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b8c:	48 8b 00             	mov    (%rax),%rax
+  803b8f:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803b95:	48 83 c4 40          	add    $0x40,%rsp
+  803b99:	5b                   	pop    %rbx
+  803b9a:	41 5f                	pop    %r15
+  803b9c:	5d                   	pop    %rbp
+  803b9d:	c3                   	ret
+
+0000000000803b9e <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  803b9e:	55                   	push   %rbp
+  803b9f:	48 89 e5             	mov    %rsp,%rbp
+  803ba2:	41 57                	push   %r15
+  803ba4:	53                   	push   %rbx
+  803ba5:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  803bac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803bac <ipc_window_batch+0xe>
+  803bb3:	49 bb 94 54 00 00 00 	movabs $0x5494,%r11
+  803bba:	00 00 00 
+  803bbd:	4c 01 db             	add    %r11,%rbx
+  803bc0:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  803bc6:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  803bcd:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803bd3:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  803bd9:	e9 15 01 00 00       	jmp    803cf3 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803bde:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803be4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803be7:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803bee:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803bf1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803bf4:	39 c2                	cmp    %eax,%edx
+  803bf6:	0f 4e c2             	cmovle %edx,%eax
+  803bf9:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  803bfc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803c03:	eb 6b                	jmp    803c70 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803c05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c08:	48 98                	cltq
+  803c0a:	48 c1 e0 05          	shl    $0x5,%rax
+  803c0e:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803c12:	48 01 e8             	add    %rbp,%rax
+  803c15:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  803c1b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803c21:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c24:	c1 e0 0c             	shl    $0xc,%eax
+  803c27:	48 63 d0             	movslq %eax,%rdx
+  803c2a:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803c31:	48 01 c2             	add    %rax,%rdx
+  803c34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c37:	48 98                	cltq
+  803c39:	48 c1 e0 05          	shl    $0x5,%rax
+  803c3d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803c41:	48 01 e8             	add    %rbp,%rax
+  803c44:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  803c4a:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  803c4d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c50:	48 98                	cltq
+  803c52:	48 c1 e0 05          	shl    $0x5,%rax
+  803c56:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803c5a:	48 01 e8             	add    %rbp,%rax
+  803c5d:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  803c64:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  803c6a:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  803c6c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803c70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c73:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  803c76:	7c 8d                	jl     803c05 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  803c78:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  803c7f:	74 27                	je     803ca8 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803c81:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803c84:	48 63 d0             	movslq %eax,%rdx
+  803c87:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803c8e:	48 89 d6             	mov    %rdx,%rsi
+  803c91:	48 89 c7             	mov    %rax,%rdi
+  803c94:	49 89 df             	mov    %rbx,%r15
+  803c97:	48 b8 10 a5 ff ff ff 	movabs $0xffffffffffffa510,%rax
+  803c9e:	ff ff ff 
+  803ca1:	48 01 d8             	add    %rbx,%rax
+  803ca4:	ff d0                	call   *%rax
+  803ca6:	eb 25                	jmp    803ccd <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  803ca8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803cab:	48 63 d0             	movslq %eax,%rdx
+  803cae:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803cb5:	48 89 d6             	mov    %rdx,%rsi
+  803cb8:	48 89 c7             	mov    %rax,%rdi
+  803cbb:	49 89 df             	mov    %rbx,%r15
+  803cbe:	48 b8 6e a5 ff ff ff 	movabs $0xffffffffffffa56e,%rax
+  803cc5:	ff ff ff 
+  803cc8:	48 01 d8             	add    %rbx,%rax
+  803ccb:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803ccd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803cd0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803cd4:	79 05                	jns    803cdb <ipc_window_batch+0x13d>
+			return r;
+  803cd6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cd9:	eb 2a                	jmp    803d05 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  803cdb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803cde:	c1 e0 0c             	shl    $0xc,%eax
+  803ce1:	48 98                	cltq
+  803ce3:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  803cea:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803ced:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803cf3:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  803cfa:	0f 8f de fe ff ff    	jg     803bde <ipc_window_batch+0x40>
+	}
+	return 0;
+  803d00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d05:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  803d0c:	5b                   	pop    %rbx
+  803d0d:	41 5f                	pop    %r15
+  803d0f:	5d                   	pop    %rbp
+  803d10:	c3                   	ret
+
+0000000000803d11 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803d11:	55                   	push   %rbp
+  803d12:	48 89 e5             	mov    %rsp,%rbp
+  803d15:	48 83 ec 10          	sub    $0x10,%rsp
+  803d19:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d19 <ipc_map_window+0x8>
+  803d20:	49 bb 27 53 00 00 00 	movabs $0x5327,%r11
+  803d27:	00 00 00 
+  803d2a:	4c 01 d8             	add    %r11,%rax
+  803d2d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d31:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803d34:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803d37:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d3b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803d40:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d45:	49 b8 5e ab ff ff ff 	movabs $0xffffffffffffab5e,%r8
+  803d4c:	ff ff ff 
+  803d4f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803d53:	ff d0                	call   *%rax
+}
+  803d55:	c9                   	leave
+  803d56:	c3                   	ret
+
+0000000000803d57 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803d57:	55                   	push   %rbp
+  803d58:	48 89 e5             	mov    %rsp,%rbp
+  803d5b:	48 83 ec 10          	sub    $0x10,%rsp
+  803d5f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d5f <ipc_unmap_window+0x8>
+  803d66:	49 bb e1 52 00 00 00 	movabs $0x52e1,%r11
+  803d6d:	00 00 00 
+  803d70:	4c 01 d8             	add    %r11,%rax
+  803d73:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d77:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  803d7a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803d7d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d86:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d8b:	49 b8 5e ab ff ff ff 	movabs $0xffffffffffffab5e,%r8
+  803d92:	ff ff ff 
+  803d95:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803d99:	ff d0                	call   *%rax
+}
+  803d9b:	c9                   	leave
+  803d9c:	c3                   	ret
+
+0000000000803d9d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803d9d:	55                   	push   %rbp
+  803d9e:	48 89 e5             	mov    %rsp,%rbp
+  803da1:	48 83 ec 18          	sub    $0x18,%rsp
+  803da5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803da5 <ipc_find_env+0x8>
+  803dac:	49 bb 9b 52 00 00 00 	movabs $0x529b,%r11
+  803db3:	00 00 00 
+  803db6:	4c 01 d8             	add    %r11,%rax
+  803db9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803dbc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803dc3:	eb 57                	jmp    803e1c <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803dc5:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803dcc:	ff ff ff 
+  803dcf:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803dd3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803dd6:	48 63 d2             	movslq %edx,%rdx
+  803dd9:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803de0:	48 01 ca             	add    %rcx,%rdx
+  803de3:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803dea:	8b 12                	mov    (%rdx),%edx
+  803dec:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803def:	75 27                	jne    803e18 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803df1:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803df8:	ff ff ff 
+  803dfb:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803dff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e02:	48 98                	cltq
+  803e04:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803e0b:	48 01 d0             	add    %rdx,%rax
+  803e0e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803e14:	8b 00                	mov    (%rax),%eax
+  803e16:	eb 12                	jmp    803e2a <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803e18:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803e1c:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803e23:	7e a0                	jle    803dc5 <ipc_find_env+0x28>
+	}
+	return 0;
+  803e25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e2a:	c9                   	leave
+  803e2b:	c3                   	ret
+
+0000000000803e2c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803e2c:	55                   	push   %rbp
+  803e2d:	48 89 e5             	mov    %rsp,%rbp
+  803e30:	48 83 ec 08          	sub    $0x8,%rsp
+  803e34:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e34 <fd2num+0x8>
+  803e3b:	49 bb 0c 52 00 00 00 	movabs $0x520c,%r11
+  803e42:	00 00 00 
+  803e45:	4c 01 d8             	add    %r11,%rax
+  803e48:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803e4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e50:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803e57:	ff ff ff 
+  803e5a:	48 01 d0             	add    %rdx,%rax
+  803e5d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803e61:	c9                   	leave
+  803e62:	c3                   	ret
+
+0000000000803e63 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803e63:	55                   	push   %rbp
+  803e64:	48 89 e5             	mov    %rsp,%rbp
+  803e67:	48 83 ec 08          	sub    $0x8,%rsp
+  803e6b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e6b <fd2data+0x8>
+  803e72:	49 bb d5 51 00 00 00 	movabs $0x51d5,%r11
+  803e79:	00 00 00 
+  803e7c:	4c 01 d8             	add    %r11,%rax
+  803e7f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803e83:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e87:	48 89 d7             	mov    %rdx,%rdi
+  803e8a:	48 ba ec ad ff ff ff 	movabs $0xffffffffffffadec,%rdx
+  803e91:	ff ff ff 
+  803e94:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803e98:	ff d0                	call   *%rax
+  803e9a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803ea0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803ea4:	c9                   	leave
+  803ea5:	c3                   	ret
+
+0000000000803ea6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803ea6:	55                   	push   %rbp
+  803ea7:	48 89 e5             	mov    %rsp,%rbp
+  803eaa:	48 83 ec 18          	sub    $0x18,%rsp
+  803eae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803eae <fd_alloc+0x8>
+  803eb5:	49 bb 92 51 00 00 00 	movabs $0x5192,%r11
+  803ebc:	00 00 00 
+  803ebf:	4c 01 d8             	add    %r11,%rax
+  803ec2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803ec6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803ecd:	eb 75                	jmp    803f44 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803ecf:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803ed2:	48 63 d2             	movslq %edx,%rdx
+  803ed5:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803edc:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803ee0:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803ee4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ee8:	48 89 d1             	mov    %rdx,%rcx
+  803eeb:	48 c1 e9 15          	shr    $0x15,%rcx
+  803eef:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803ef6:	ff ff ff 
+  803ef9:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803efd:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803f01:	83 e2 01             	and    $0x1,%edx
+  803f04:	48 85 d2             	test   %rdx,%rdx
+  803f07:	74 25                	je     803f2e <fd_alloc+0x88>
+  803f09:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f0d:	48 89 d1             	mov    %rdx,%rcx
+  803f10:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803f14:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803f1b:	ff ff ff 
+  803f1e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803f22:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803f26:	83 e2 01             	and    $0x1,%edx
+  803f29:	48 85 d2             	test   %rdx,%rdx
+  803f2c:	75 12                	jne    803f40 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803f2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f32:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f36:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f3e:	eb 1a                	jmp    803f5a <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803f40:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803f44:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803f48:	7e 85                	jle    803ecf <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803f4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f4e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803f55:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803f5a:	c9                   	leave
+  803f5b:	c3                   	ret
+
+0000000000803f5c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803f5c:	55                   	push   %rbp
+  803f5d:	48 89 e5             	mov    %rsp,%rbp
+  803f60:	48 83 ec 20          	sub    $0x20,%rsp
+  803f64:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803f64 <fd_lookup+0x8>
+  803f6b:	49 bb dc 50 00 00 00 	movabs $0x50dc,%r11
+  803f72:	00 00 00 
+  803f75:	4c 01 d8             	add    %r11,%rax
+  803f78:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f7b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803f7f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f83:	78 06                	js     803f8b <fd_lookup+0x2f>
+  803f85:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803f89:	7e 07                	jle    803f92 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803f8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f90:	eb 73                	jmp    804005 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803f92:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803f95:	48 63 d2             	movslq %edx,%rdx
+  803f98:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803f9f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803fa3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803fa7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803fab:	48 89 d1             	mov    %rdx,%rcx
+  803fae:	48 c1 e9 15          	shr    $0x15,%rcx
+  803fb2:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803fb9:	ff ff ff 
+  803fbc:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803fc0:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803fc4:	83 e2 01             	and    $0x1,%edx
+  803fc7:	48 85 d2             	test   %rdx,%rdx
+  803fca:	74 22                	je     803fee <fd_lookup+0x92>
+  803fcc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803fd0:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803fd4:	48 b9 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rcx
+  803fdb:	ff ff ff 
+  803fde:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803fe2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803fe6:	83 e0 01             	and    $0x1,%eax
+  803fe9:	48 85 c0             	test   %rax,%rax
+  803fec:	75 07                	jne    803ff5 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803fee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ff3:	eb 10                	jmp    804005 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803ff5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ff9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803ffd:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  804000:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804005:	c9                   	leave
+  804006:	c3                   	ret
+
+0000000000804007 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  804007:	55                   	push   %rbp
+  804008:	48 89 e5             	mov    %rsp,%rbp
+  80400b:	41 57                	push   %r15
+  80400d:	53                   	push   %rbx
+  80400e:	48 83 ec 30          	sub    $0x30,%rsp
+  804012:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804012 <fd_close+0xb>
+  804019:	49 bb 2e 50 00 00 00 	movabs $0x502e,%r11
+  804020:	00 00 00 
+  804023:	4c 01 db             	add    %r11,%rbx
+  804026:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80402a:	89 f0                	mov    %esi,%eax
+  80402c:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80402f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804033:	48 89 c7             	mov    %rax,%rdi
+  804036:	48 b8 ec ad ff ff ff 	movabs $0xffffffffffffadec,%rax
+  80403d:	ff ff ff 
+  804040:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804044:	ff d0                	call   *%rax
+  804046:	89 c2                	mov    %eax,%edx
+  804048:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80404c:	48 89 c6             	mov    %rax,%rsi
+  80404f:	89 d7                	mov    %edx,%edi
+  804051:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  804058:	ff ff ff 
+  80405b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80405f:	ff d0                	call   *%rax
+  804061:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804064:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804068:	78 0a                	js     804074 <fd_close+0x6d>
+	    || fd != fd2)
+  80406a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80406e:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  804072:	74 12                	je     804086 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  804074:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  804078:	74 05                	je     80407f <fd_close+0x78>
+  80407a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80407d:	eb 7a                	jmp    8040f9 <fd_close+0xf2>
+  80407f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804084:	eb 73                	jmp    8040f9 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  804086:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80408a:	8b 00                	mov    (%rax),%eax
+  80408c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804090:	48 89 d6             	mov    %rdx,%rsi
+  804093:	89 c7                	mov    %eax,%edi
+  804095:	48 b8 c2 b0 ff ff ff 	movabs $0xffffffffffffb0c2,%rax
+  80409c:	ff ff ff 
+  80409f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040a3:	ff d0                	call   *%rax
+  8040a5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040a8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040ac:	78 2a                	js     8040d8 <fd_close+0xd1>
+		if (dev->dev_close)
+  8040ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040b2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8040b6:	48 85 c0             	test   %rax,%rax
+  8040b9:	74 16                	je     8040d1 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8040bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040bf:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8040c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040c7:	48 89 c7             	mov    %rax,%rdi
+  8040ca:	ff d2                	call   *%rdx
+  8040cc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040cf:	eb 07                	jmp    8040d8 <fd_close+0xd1>
+		else
+			r = 0;
+  8040d1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8040d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040dc:	48 89 c6             	mov    %rax,%rsi
+  8040df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040e4:	49 89 df             	mov    %rbx,%r15
+  8040e7:	48 b8 4f 9f ff ff ff 	movabs $0xffffffffffff9f4f,%rax
+  8040ee:	ff ff ff 
+  8040f1:	48 01 d8             	add    %rbx,%rax
+  8040f4:	ff d0                	call   *%rax
+	return r;
+  8040f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8040f9:	48 83 c4 30          	add    $0x30,%rsp
+  8040fd:	5b                   	pop    %rbx
+  8040fe:	41 5f                	pop    %r15
+  804100:	5d                   	pop    %rbp
+  804101:	c3                   	ret
+
+0000000000804102 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  804102:	55                   	push   %rbp
+  804103:	48 89 e5             	mov    %rsp,%rbp
+  804106:	41 57                	push   %r15
+  804108:	48 83 ec 28          	sub    $0x28,%rsp
+  80410c:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80410c <dev_lookup+0xa>
+  804113:	49 bb 34 4f 00 00 00 	movabs $0x4f34,%r11
+  80411a:	00 00 00 
+  80411d:	4c 01 d9             	add    %r11,%rcx
+  804120:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804123:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  804127:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80412e:	eb 45                	jmp    804175 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  804130:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  804137:	00 00 00 
+  80413a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80413d:	48 98                	cltq
+  80413f:	48 01 ca             	add    %rcx,%rdx
+  804142:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804146:	8b 00                	mov    (%rax),%eax
+  804148:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80414b:	75 24                	jne    804171 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  80414d:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  804154:	00 00 00 
+  804157:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80415a:	48 98                	cltq
+  80415c:	48 01 ca             	add    %rcx,%rdx
+  80415f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804163:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804167:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80416a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80416f:	eb 74                	jmp    8041e5 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  804171:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804175:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80417c:	00 00 00 
+  80417f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804182:	48 98                	cltq
+  804184:	48 01 ca             	add    %rcx,%rdx
+  804187:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80418b:	48 85 c0             	test   %rax,%rax
+  80418e:	75 a0                	jne    804130 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  804190:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  804197:	ff ff ff 
+  80419a:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  80419e:	48 8b 00             	mov    (%rax),%rax
+  8041a1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8041a7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8041aa:	89 c6                	mov    %eax,%esi
+  8041ac:	48 b8 68 e6 ff ff ff 	movabs $0xffffffffffffe668,%rax
+  8041b3:	ff ff ff 
+  8041b6:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8041ba:	48 89 c7             	mov    %rax,%rdi
+  8041bd:	49 89 cf             	mov    %rcx,%r15
+  8041c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c5:	49 b8 f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%r8
+  8041cc:	ff ff ff 
+  8041cf:	49 01 c8             	add    %rcx,%r8
+  8041d2:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8041d5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8041d9:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8041e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8041e5:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8041e9:	c9                   	leave
+  8041ea:	c3                   	ret
+
+00000000008041eb <close>:
+
+int
+close(int fdnum)
+{
+  8041eb:	55                   	push   %rbp
+  8041ec:	48 89 e5             	mov    %rsp,%rbp
+  8041ef:	53                   	push   %rbx
+  8041f0:	48 83 ec 28          	sub    $0x28,%rsp
+  8041f4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041f4 <close+0x9>
+  8041fb:	49 bb 4c 4e 00 00 00 	movabs $0x4e4c,%r11
+  804202:	00 00 00 
+  804205:	4c 01 db             	add    %r11,%rbx
+  804208:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80420b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80420f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804212:	48 89 d6             	mov    %rdx,%rsi
+  804215:	89 c7                	mov    %eax,%edi
+  804217:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  80421e:	ff ff ff 
+  804221:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804225:	ff d0                	call   *%rax
+  804227:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80422a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80422e:	79 05                	jns    804235 <close+0x4a>
+		return r;
+  804230:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804233:	eb 1c                	jmp    804251 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  804235:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804239:	be 01 00 00 00       	mov    $0x1,%esi
+  80423e:	48 89 c7             	mov    %rax,%rdi
+  804241:	48 b8 c7 af ff ff ff 	movabs $0xffffffffffffafc7,%rax
+  804248:	ff ff ff 
+  80424b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80424f:	ff d0                	call   *%rax
+}
+  804251:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804255:	c9                   	leave
+  804256:	c3                   	ret
+
+0000000000804257 <close_all>:
+
+void
+close_all(void)
+{
+  804257:	55                   	push   %rbp
+  804258:	48 89 e5             	mov    %rsp,%rbp
+  80425b:	53                   	push   %rbx
+  80425c:	48 83 ec 18          	sub    $0x18,%rsp
+  804260:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804260 <close_all+0x9>
+  804267:	49 bb e0 4d 00 00 00 	movabs $0x4de0,%r11
+  80426e:	00 00 00 
+  804271:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  804274:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80427b:	eb 19                	jmp    804296 <close_all+0x3f>
+		close(i);
+  80427d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804280:	89 c7                	mov    %eax,%edi
+  804282:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  804289:	ff ff ff 
+  80428c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804290:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  804292:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804296:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80429a:	7e e1                	jle    80427d <close_all+0x26>
+}
+  80429c:	90                   	nop
+  80429d:	90                   	nop
+  80429e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8042a2:	c9                   	leave
+  8042a3:	c3                   	ret
+
+00000000008042a4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8042a4:	55                   	push   %rbp
+  8042a5:	48 89 e5             	mov    %rsp,%rbp
+  8042a8:	41 57                	push   %r15
+  8042aa:	53                   	push   %rbx
+  8042ab:	48 83 ec 40          	sub    $0x40,%rsp
+  8042af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8042af <dup+0xb>
+  8042b6:	49 bb 91 4d 00 00 00 	movabs $0x4d91,%r11
+  8042bd:	00 00 00 
+  8042c0:	4c 01 db             	add    %r11,%rbx
+  8042c3:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8042c6:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8042c9:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8042cd:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8042d0:	48 89 d6             	mov    %rdx,%rsi
+  8042d3:	89 c7                	mov    %eax,%edi
+  8042d5:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  8042dc:	ff ff ff 
+  8042df:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042e3:	ff d0                	call   *%rax
+  8042e5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8042e8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8042ec:	79 08                	jns    8042f6 <dup+0x52>
+		return r;
+  8042ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042f1:	e9 a4 01 00 00       	jmp    80449a <dup+0x1f6>
+	close(newfdnum);
+  8042f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8042f9:	89 c7                	mov    %eax,%edi
+  8042fb:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  804302:	ff ff ff 
+  804305:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804309:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  80430b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80430e:	48 98                	cltq
+  804310:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  804316:	48 c1 e0 0c          	shl    $0xc,%rax
+  80431a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  80431e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804322:	48 89 c7             	mov    %rax,%rdi
+  804325:	48 b8 23 ae ff ff ff 	movabs $0xffffffffffffae23,%rax
+  80432c:	ff ff ff 
+  80432f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804333:	ff d0                	call   *%rax
+  804335:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  804339:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80433d:	48 89 c7             	mov    %rax,%rdi
+  804340:	48 b8 23 ae ff ff ff 	movabs $0xffffffffffffae23,%rax
+  804347:	ff ff ff 
+  80434a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80434e:	ff d0                	call   *%rax
+  804350:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  804354:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804358:	48 c1 e8 15          	shr    $0x15,%rax
+  80435c:	48 89 c2             	mov    %rax,%rdx
+  80435f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804366:	ff ff ff 
+  804369:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80436d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804371:	83 e0 01             	and    $0x1,%eax
+  804374:	48 85 c0             	test   %rax,%rax
+  804377:	74 7f                	je     8043f8 <dup+0x154>
+  804379:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80437d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804381:	48 89 c2             	mov    %rax,%rdx
+  804384:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  80438b:	ff ff ff 
+  80438e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804392:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804396:	83 e0 01             	and    $0x1,%eax
+  804399:	48 85 c0             	test   %rax,%rax
+  80439c:	74 5a                	je     8043f8 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80439e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043a2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043a6:	48 89 c2             	mov    %rax,%rdx
+  8043a9:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  8043b0:	ff ff ff 
+  8043b3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8043b7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8043bb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8043c0:	89 c1                	mov    %eax,%ecx
+  8043c2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8043c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043ca:	41 89 c8             	mov    %ecx,%r8d
+  8043cd:	48 89 d1             	mov    %rdx,%rcx
+  8043d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043d5:	48 89 c6             	mov    %rax,%rsi
+  8043d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043dd:	49 89 df             	mov    %rbx,%r15
+  8043e0:	48 b8 dc 9e ff ff ff 	movabs $0xffffffffffff9edc,%rax
+  8043e7:	ff ff ff 
+  8043ea:	48 01 d8             	add    %rbx,%rax
+  8043ed:	ff d0                	call   *%rax
+  8043ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043f6:	78 5f                	js     804457 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8043f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043fc:	48 c1 e8 0c          	shr    $0xc,%rax
+  804400:	48 89 c2             	mov    %rax,%rdx
+  804403:	48 b8 c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rax
+  80440a:	ff ff ff 
+  80440d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804411:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804415:	25 07 0e 00 00       	and    $0xe07,%eax
+  80441a:	89 c1                	mov    %eax,%ecx
+  80441c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804420:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804424:	41 89 c8             	mov    %ecx,%r8d
+  804427:	48 89 d1             	mov    %rdx,%rcx
+  80442a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80442f:	48 89 c6             	mov    %rax,%rsi
+  804432:	bf 00 00 00 00       	mov    $0x0,%edi
+  804437:	49 89 df             	mov    %rbx,%r15
+  80443a:	48 b8 dc 9e ff ff ff 	movabs $0xffffffffffff9edc,%rax
+  804441:	ff ff ff 
+  804444:	48 01 d8             	add    %rbx,%rax
+  804447:	ff d0                	call   *%rax
+  804449:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80444c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804450:	78 08                	js     80445a <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  804452:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804455:	eb 43                	jmp    80449a <dup+0x1f6>
+			goto err;
+  804457:	90                   	nop
+  804458:	eb 01                	jmp    80445b <dup+0x1b7>
+		goto err;
+  80445a:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80445b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80445f:	48 89 c6             	mov    %rax,%rsi
+  804462:	bf 00 00 00 00       	mov    $0x0,%edi
+  804467:	49 89 df             	mov    %rbx,%r15
+  80446a:	48 b8 4f 9f ff ff ff 	movabs $0xffffffffffff9f4f,%rax
+  804471:	ff ff ff 
+  804474:	48 01 d8             	add    %rbx,%rax
+  804477:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  804479:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80447d:	48 89 c6             	mov    %rax,%rsi
+  804480:	bf 00 00 00 00       	mov    $0x0,%edi
+  804485:	49 89 df             	mov    %rbx,%r15
+  804488:	48 b8 4f 9f ff ff ff 	movabs $0xffffffffffff9f4f,%rax
+  80448f:	ff ff ff 
+  804492:	48 01 d8             	add    %rbx,%rax
+  804495:	ff d0                	call   *%rax
+	return r;
+  804497:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80449a:	48 83 c4 40          	add    $0x40,%rsp
+  80449e:	5b                   	pop    %rbx
+  80449f:	41 5f                	pop    %r15
+  8044a1:	5d                   	pop    %rbp
+  8044a2:	c3                   	ret
+
+00000000008044a3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8044a3:	55                   	push   %rbp
+  8044a4:	48 89 e5             	mov    %rsp,%rbp
+  8044a7:	41 57                	push   %r15
+  8044a9:	53                   	push   %rbx
+  8044aa:	48 83 ec 40          	sub    $0x40,%rsp
+  8044ae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044ae <read+0xb>
+  8044b5:	49 bb 92 4b 00 00 00 	movabs $0x4b92,%r11
+  8044bc:	00 00 00 
+  8044bf:	4c 01 db             	add    %r11,%rbx
+  8044c2:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8044c5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044c9:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8044cd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8044d1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8044d4:	48 89 d6             	mov    %rdx,%rsi
+  8044d7:	89 c7                	mov    %eax,%edi
+  8044d9:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  8044e0:	ff ff ff 
+  8044e3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044e7:	ff d0                	call   *%rax
+  8044e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044f0:	78 28                	js     80451a <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8044f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044f6:	8b 00                	mov    (%rax),%eax
+  8044f8:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8044fc:	48 89 d6             	mov    %rdx,%rsi
+  8044ff:	89 c7                	mov    %eax,%edi
+  804501:	48 b8 c2 b0 ff ff ff 	movabs $0xffffffffffffb0c2,%rax
+  804508:	ff ff ff 
+  80450b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80450f:	ff d0                	call   *%rax
+  804511:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804514:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804518:	79 08                	jns    804522 <read+0x7f>
+		return r;
+  80451a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80451d:	e9 8b 00 00 00       	jmp    8045ad <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804522:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804526:	8b 40 08             	mov    0x8(%rax),%eax
+  804529:	83 e0 03             	and    $0x3,%eax
+  80452c:	83 f8 01             	cmp    $0x1,%eax
+  80452f:	75 4b                	jne    80457c <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804531:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  804538:	ff ff ff 
+  80453b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80453f:	48 8b 00             	mov    (%rax),%rax
+  804542:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804548:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80454b:	89 c6                	mov    %eax,%esi
+  80454d:	48 b8 87 e6 ff ff ff 	movabs $0xffffffffffffe687,%rax
+  804554:	ff ff ff 
+  804557:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80455b:	48 89 c7             	mov    %rax,%rdi
+  80455e:	49 89 df             	mov    %rbx,%r15
+  804561:	b8 00 00 00 00       	mov    $0x0,%eax
+  804566:	48 b9 f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rcx
+  80456d:	ff ff ff 
+  804570:	48 01 d9             	add    %rbx,%rcx
+  804573:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804575:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80457a:	eb 31                	jmp    8045ad <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80457c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804580:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804584:	48 85 c0             	test   %rax,%rax
+  804587:	75 07                	jne    804590 <read+0xed>
+		return -E_NOT_SUPP;
+  804589:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80458e:	eb 1d                	jmp    8045ad <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  804590:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804594:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  804598:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80459c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8045a0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8045a4:	48 89 ce             	mov    %rcx,%rsi
+  8045a7:	48 89 c7             	mov    %rax,%rdi
+  8045aa:	41 ff d0             	call   *%r8
+}
+  8045ad:	48 83 c4 40          	add    $0x40,%rsp
+  8045b1:	5b                   	pop    %rbx
+  8045b2:	41 5f                	pop    %r15
+  8045b4:	5d                   	pop    %rbp
+  8045b5:	c3                   	ret
+
+00000000008045b6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8045b6:	55                   	push   %rbp
+  8045b7:	48 89 e5             	mov    %rsp,%rbp
+  8045ba:	53                   	push   %rbx
+  8045bb:	48 83 ec 38          	sub    $0x38,%rsp
+  8045bf:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045bf <readn+0x9>
+  8045c6:	49 bb 81 4a 00 00 00 	movabs $0x4a81,%r11
+  8045cd:	00 00 00 
+  8045d0:	4c 01 db             	add    %r11,%rbx
+  8045d3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8045d6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8045da:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8045de:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8045e5:	eb 4b                	jmp    804632 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8045e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045ea:	48 98                	cltq
+  8045ec:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8045f0:	48 29 c2             	sub    %rax,%rdx
+  8045f3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045f6:	48 63 c8             	movslq %eax,%rcx
+  8045f9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045fd:	48 01 c1             	add    %rax,%rcx
+  804600:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804603:	48 89 ce             	mov    %rcx,%rsi
+  804606:	89 c7                	mov    %eax,%edi
+  804608:	48 b8 63 b4 ff ff ff 	movabs $0xffffffffffffb463,%rax
+  80460f:	ff ff ff 
+  804612:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804616:	ff d0                	call   *%rax
+  804618:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80461b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80461f:	79 05                	jns    804626 <readn+0x70>
+			return m;
+  804621:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804624:	eb 1d                	jmp    804643 <readn+0x8d>
+		if (m == 0)
+  804626:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80462a:	74 13                	je     80463f <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80462c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80462f:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804632:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804635:	48 98                	cltq
+  804637:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80463b:	72 aa                	jb     8045e7 <readn+0x31>
+  80463d:	eb 01                	jmp    804640 <readn+0x8a>
+			break;
+  80463f:	90                   	nop
+	}
+	return tot;
+  804640:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804643:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804647:	c9                   	leave
+  804648:	c3                   	ret
+
+0000000000804649 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  804649:	55                   	push   %rbp
+  80464a:	48 89 e5             	mov    %rsp,%rbp
+  80464d:	41 57                	push   %r15
+  80464f:	53                   	push   %rbx
+  804650:	48 83 ec 40          	sub    $0x40,%rsp
+  804654:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804654 <write+0xb>
+  80465b:	49 bb ec 49 00 00 00 	movabs $0x49ec,%r11
+  804662:	00 00 00 
+  804665:	4c 01 db             	add    %r11,%rbx
+  804668:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80466b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80466f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804673:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804677:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80467a:	48 89 d6             	mov    %rdx,%rsi
+  80467d:	89 c7                	mov    %eax,%edi
+  80467f:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  804686:	ff ff ff 
+  804689:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80468d:	ff d0                	call   *%rax
+  80468f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804692:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804696:	78 28                	js     8046c0 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804698:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80469c:	8b 00                	mov    (%rax),%eax
+  80469e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8046a2:	48 89 d6             	mov    %rdx,%rsi
+  8046a5:	89 c7                	mov    %eax,%edi
+  8046a7:	48 b8 c2 b0 ff ff ff 	movabs $0xffffffffffffb0c2,%rax
+  8046ae:	ff ff ff 
+  8046b1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046b5:	ff d0                	call   *%rax
+  8046b7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8046ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8046be:	79 08                	jns    8046c8 <write+0x7f>
+		return r;
+  8046c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8046c3:	e9 8a 00 00 00       	jmp    804752 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8046c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046cc:	8b 40 08             	mov    0x8(%rax),%eax
+  8046cf:	83 e0 03             	and    $0x3,%eax
+  8046d2:	85 c0                	test   %eax,%eax
+  8046d4:	75 4b                	jne    804721 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8046d6:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8046dd:	ff ff ff 
+  8046e0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8046e4:	48 8b 00             	mov    (%rax),%rax
+  8046e7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046ed:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8046f0:	89 c6                	mov    %eax,%esi
+  8046f2:	48 b8 a3 e6 ff ff ff 	movabs $0xffffffffffffe6a3,%rax
+  8046f9:	ff ff ff 
+  8046fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804700:	48 89 c7             	mov    %rax,%rdi
+  804703:	49 89 df             	mov    %rbx,%r15
+  804706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470b:	48 b9 f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rcx
+  804712:	ff ff ff 
+  804715:	48 01 d9             	add    %rbx,%rcx
+  804718:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80471a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80471f:	eb 31                	jmp    804752 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  804721:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804725:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804729:	48 85 c0             	test   %rax,%rax
+  80472c:	75 07                	jne    804735 <write+0xec>
+		return -E_NOT_SUPP;
+  80472e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804733:	eb 1d                	jmp    804752 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  804735:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804739:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80473d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804741:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804745:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804749:	48 89 ce             	mov    %rcx,%rsi
+  80474c:	48 89 c7             	mov    %rax,%rdi
+  80474f:	41 ff d0             	call   *%r8
+}
+  804752:	48 83 c4 40          	add    $0x40,%rsp
+  804756:	5b                   	pop    %rbx
+  804757:	41 5f                	pop    %r15
+  804759:	5d                   	pop    %rbp
+  80475a:	c3                   	ret
+
+000000000080475b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80475b:	55                   	push   %rbp
+  80475c:	48 89 e5             	mov    %rsp,%rbp
+  80475f:	48 83 ec 18          	sub    $0x18,%rsp
+  804763:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804763 <seek+0x8>
+  80476a:	49 bb dd 48 00 00 00 	movabs $0x48dd,%r11
+  804771:	00 00 00 
+  804774:	4c 01 d8             	add    %r11,%rax
+  804777:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80477a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80477d:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  804781:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804784:	48 89 ce             	mov    %rcx,%rsi
+  804787:	89 d7                	mov    %edx,%edi
+  804789:	48 ba 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rdx
+  804790:	ff ff ff 
+  804793:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804797:	ff d0                	call   *%rax
+  804799:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80479c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047a0:	79 05                	jns    8047a7 <seek+0x4c>
+		return r;
+  8047a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047a5:	eb 0f                	jmp    8047b6 <seek+0x5b>
+	fd->fd_offset = offset;
+  8047a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047ab:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8047ae:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8047b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047b6:	c9                   	leave
+  8047b7:	c3                   	ret
+
+00000000008047b8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8047b8:	55                   	push   %rbp
+  8047b9:	48 89 e5             	mov    %rsp,%rbp
+  8047bc:	41 57                	push   %r15
+  8047be:	53                   	push   %rbx
+  8047bf:	48 83 ec 30          	sub    $0x30,%rsp
+  8047c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8047c3 <ftruncate+0xb>
+  8047ca:	49 bb 7d 48 00 00 00 	movabs $0x487d,%r11
+  8047d1:	00 00 00 
+  8047d4:	4c 01 db             	add    %r11,%rbx
+  8047d7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8047da:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8047dd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8047e1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8047e4:	48 89 d6             	mov    %rdx,%rsi
+  8047e7:	89 c7                	mov    %eax,%edi
+  8047e9:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  8047f0:	ff ff ff 
+  8047f3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047f7:	ff d0                	call   *%rax
+  8047f9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804800:	78 28                	js     80482a <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804802:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804806:	8b 00                	mov    (%rax),%eax
+  804808:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80480c:	48 89 d6             	mov    %rdx,%rsi
+  80480f:	89 c7                	mov    %eax,%edi
+  804811:	48 b8 c2 b0 ff ff ff 	movabs $0xffffffffffffb0c2,%rax
+  804818:	ff ff ff 
+  80481b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80481f:	ff d0                	call   *%rax
+  804821:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804824:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804828:	79 08                	jns    804832 <ftruncate+0x7a>
+		return r;
+  80482a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80482d:	e9 83 00 00 00       	jmp    8048b5 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804832:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804836:	8b 40 08             	mov    0x8(%rax),%eax
+  804839:	83 e0 03             	and    $0x3,%eax
+  80483c:	85 c0                	test   %eax,%eax
+  80483e:	75 4b                	jne    80488b <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804840:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  804847:	ff ff ff 
+  80484a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80484e:	48 8b 00             	mov    (%rax),%rax
+  804851:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804857:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80485a:	89 c6                	mov    %eax,%esi
+  80485c:	48 b8 c0 e6 ff ff ff 	movabs $0xffffffffffffe6c0,%rax
+  804863:	ff ff ff 
+  804866:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80486a:	48 89 c7             	mov    %rax,%rdi
+  80486d:	49 89 df             	mov    %rbx,%r15
+  804870:	b8 00 00 00 00       	mov    $0x0,%eax
+  804875:	48 b9 f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rcx
+  80487c:	ff ff ff 
+  80487f:	48 01 d9             	add    %rbx,%rcx
+  804882:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804884:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804889:	eb 2a                	jmp    8048b5 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80488b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80488f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  804893:	48 85 c0             	test   %rax,%rax
+  804896:	75 07                	jne    80489f <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  804898:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80489d:	eb 16                	jmp    8048b5 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  80489f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048a3:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8048a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048ab:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8048ae:	89 d6                	mov    %edx,%esi
+  8048b0:	48 89 c7             	mov    %rax,%rdi
+  8048b3:	ff d1                	call   *%rcx
+}
+  8048b5:	48 83 c4 30          	add    $0x30,%rsp
+  8048b9:	5b                   	pop    %rbx
+  8048ba:	41 5f                	pop    %r15
+  8048bc:	5d                   	pop    %rbp
+  8048bd:	c3                   	ret
+
+00000000008048be <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8048be:	55                   	push   %rbp
+  8048bf:	48 89 e5             	mov    %rsp,%rbp
+  8048c2:	53                   	push   %rbx
+  8048c3:	48 83 ec 38          	sub    $0x38,%rsp
+  8048c7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048c7 <fstat+0x9>
+  8048ce:	49 bb 79 47 00 00 00 	movabs $0x4779,%r11
+  8048d5:	00 00 00 
+  8048d8:	4c 01 db             	add    %r11,%rbx
+  8048db:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8048de:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8048e2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8048e6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8048e9:	48 89 d6             	mov    %rdx,%rsi
+  8048ec:	89 c7                	mov    %eax,%edi
+  8048ee:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  8048f5:	ff ff ff 
+  8048f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048fc:	ff d0                	call   *%rax
+  8048fe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804901:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804905:	78 28                	js     80492f <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804907:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80490b:	8b 00                	mov    (%rax),%eax
+  80490d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804911:	48 89 d6             	mov    %rdx,%rsi
+  804914:	89 c7                	mov    %eax,%edi
+  804916:	48 b8 c2 b0 ff ff ff 	movabs $0xffffffffffffb0c2,%rax
+  80491d:	ff ff ff 
+  804920:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804924:	ff d0                	call   *%rax
+  804926:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804929:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80492d:	79 05                	jns    804934 <fstat+0x76>
+		return r;
+  80492f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804932:	eb 5e                	jmp    804992 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804934:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804938:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80493c:	48 85 c0             	test   %rax,%rax
+  80493f:	75 07                	jne    804948 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804941:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804946:	eb 4a                	jmp    804992 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804948:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80494c:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80494f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804953:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80495a:	00 00 00 
+	stat->st_isdir = 0;
+  80495d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804961:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804968:	00 00 00 
+	stat->st_dev = dev;
+  80496b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80496f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804973:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80497a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80497e:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804982:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804986:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80498a:	48 89 d6             	mov    %rdx,%rsi
+  80498d:	48 89 c7             	mov    %rax,%rdi
+  804990:	ff d1                	call   *%rcx
+}
+  804992:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804996:	c9                   	leave
+  804997:	c3                   	ret
+
+0000000000804998 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804998:	55                   	push   %rbp
+  804999:	48 89 e5             	mov    %rsp,%rbp
+  80499c:	41 57                	push   %r15
+  80499e:	53                   	push   %rbx
+  80499f:	48 83 ec 20          	sub    $0x20,%rsp
+  8049a3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049a3 <stat+0xb>
+  8049aa:	49 bb 9d 46 00 00 00 	movabs $0x469d,%r11
+  8049b1:	00 00 00 
+  8049b4:	4c 01 db             	add    %r11,%rbx
+  8049b7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8049bb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8049bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8049c8:	48 89 c7             	mov    %rax,%rdi
+  8049cb:	49 89 df             	mov    %rbx,%r15
+  8049ce:	48 b8 32 bc ff ff ff 	movabs $0xffffffffffffbc32,%rax
+  8049d5:	ff ff ff 
+  8049d8:	48 01 d8             	add    %rbx,%rax
+  8049db:	ff d0                	call   *%rax
+  8049dd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049e0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049e4:	79 05                	jns    8049eb <stat+0x53>
+		return fd;
+  8049e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049e9:	eb 37                	jmp    804a22 <stat+0x8a>
+	r = fstat(fd, stat);
+  8049eb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8049ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049f2:	48 89 d6             	mov    %rdx,%rsi
+  8049f5:	89 c7                	mov    %eax,%edi
+  8049f7:	48 b8 7e b8 ff ff ff 	movabs $0xffffffffffffb87e,%rax
+  8049fe:	ff ff ff 
+  804a01:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a05:	ff d0                	call   *%rax
+  804a07:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  804a0a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a0d:	89 c7                	mov    %eax,%edi
+  804a0f:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  804a16:	ff ff ff 
+  804a19:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a1d:	ff d0                	call   *%rax
+	return r;
+  804a1f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804a22:	48 83 c4 20          	add    $0x20,%rsp
+  804a26:	5b                   	pop    %rbx
+  804a27:	41 5f                	pop    %r15
+  804a29:	5d                   	pop    %rbp
+  804a2a:	c3                   	ret
+
+0000000000804a2b <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  804a2b:	55                   	push   %rbp
+  804a2c:	48 89 e5             	mov    %rsp,%rbp
+  804a2f:	41 57                	push   %r15
+  804a31:	53                   	push   %rbx
+  804a32:	48 83 ec 10          	sub    $0x10,%rsp
+  804a36:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a36 <fsipc+0xb>
+  804a3d:	49 bb 0a 46 00 00 00 	movabs $0x460a,%r11
+  804a44:	00 00 00 
+  804a47:	4c 01 db             	add    %r11,%rbx
+  804a4a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804a4d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804a51:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  804a58:	00 00 00 
+  804a5b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a5e:	85 c0                	test   %eax,%eax
+  804a60:	75 24                	jne    804a86 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804a62:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a67:	49 89 df             	mov    %rbx,%r15
+  804a6a:	48 b8 5d ad ff ff ff 	movabs $0xffffffffffffad5d,%rax
+  804a71:	ff ff ff 
+  804a74:	48 01 d8             	add    %rbx,%rax
+  804a77:	ff d0                	call   *%rax
+  804a79:	48 ba c0 0f 00 00 00 	movabs $0xfc0,%rdx
+  804a80:	00 00 00 
+  804a83:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  804a86:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  804a8d:	00 00 00 
+  804a90:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a93:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a97:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804a9a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804aa0:	49 89 d0             	mov    %rdx,%r8
+  804aa3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804aa8:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  804aaf:	00 00 00 
+  804ab2:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804ab6:	89 c7                	mov    %eax,%edi
+  804ab8:	49 89 df             	mov    %rbx,%r15
+  804abb:	48 b8 7c a7 ff ff ff 	movabs $0xffffffffffffa77c,%rax
+  804ac2:	ff ff ff 
+  804ac5:	48 01 d8             	add    %rbx,%rax
+  804ac8:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804aca:	48 83 c4 10          	add    $0x10,%rsp
+  804ace:	5b                   	pop    %rbx
+  804acf:	41 5f                	pop    %r15
+  804ad1:	5d                   	pop    %rbp
+  804ad2:	c3                   	ret
+
+0000000000804ad3 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804ad3:	55                   	push   %rbp
+  804ad4:	48 89 e5             	mov    %rsp,%rbp
+  804ad7:	41 57                	push   %r15
+  804ad9:	53                   	push   %rbx
+  804ada:	48 83 ec 20          	sub    $0x20,%rsp
+  804ade:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ade <fsipc_words+0xb>
+  804ae5:	49 bb 62 45 00 00 00 	movabs $0x4562,%r11
+  804aec:	00 00 00 
+  804aef:	4c 01 db             	add    %r11,%rbx
+  804af2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804af5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804af9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804afd:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  804b04:	00 00 00 
+  804b07:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b0a:	85 c0                	test   %eax,%eax
+  804b0c:	75 24                	jne    804b32 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804b0e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804b13:	49 89 df             	mov    %rbx,%r15
+  804b16:	48 b8 5d ad ff ff ff 	movabs $0xffffffffffffad5d,%rax
+  804b1d:	ff ff ff 
+  804b20:	48 01 d8             	add    %rbx,%rax
+  804b23:	ff d0                	call   *%rax
+  804b25:	48 ba c0 0f 00 00 00 	movabs $0xfc0,%rdx
+  804b2c:	00 00 00 
+  804b2f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804b32:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  804b39:	00 00 00 
+  804b3c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b3f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804b43:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804b47:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804b4a:	89 c7                	mov    %eax,%edi
+  804b4c:	49 89 df             	mov    %rbx,%r15
+  804b4f:	48 b8 67 a8 ff ff ff 	movabs $0xffffffffffffa867,%rax
+  804b56:	ff ff ff 
+  804b59:	48 01 d8             	add    %rbx,%rax
+  804b5c:	ff d0                	call   *%rax
+}
+  804b5e:	48 83 c4 20          	add    $0x20,%rsp
+  804b62:	5b                   	pop    %rbx
+  804b63:	41 5f                	pop    %r15
+  804b65:	5d                   	pop    %rbp
+  804b66:	c3                   	ret
+
+0000000000804b67 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804b67:	55                   	push   %rbp
+  804b68:	48 89 e5             	mov    %rsp,%rbp
+  804b6b:	41 57                	push   %r15
+  804b6d:	53                   	push   %rbx
+  804b6e:	48 83 ec 40          	sub    $0x40,%rsp
+  804b72:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b72 <fsipc_pages+0xb>
+  804b79:	49 bb ce 44 00 00 00 	movabs $0x44ce,%r11
+  804b80:	00 00 00 
+  804b83:	4c 01 db             	add    %r11,%rbx
+  804b86:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804b89:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804b8d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804b91:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804b94:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  804b9b:	00 00 00 
+  804b9e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ba1:	85 c0                	test   %eax,%eax
+  804ba3:	75 24                	jne    804bc9 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804ba5:	bf 01 00 00 00       	mov    $0x1,%edi
+  804baa:	49 89 df             	mov    %rbx,%r15
+  804bad:	48 b8 5d ad ff ff ff 	movabs $0xffffffffffffad5d,%rax
+  804bb4:	ff ff ff 
+  804bb7:	48 01 d8             	add    %rbx,%rax
+  804bba:	ff d0                	call   *%rax
+  804bbc:	48 ba c0 0f 00 00 00 	movabs $0xfc0,%rdx
+  804bc3:	00 00 00 
+  804bc6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804bc9:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804bce:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804bd2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804bd5:	48 98                	cltq
+  804bd7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804bdb:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804bdf:	0f 95 c0             	setne  %al
+  804be2:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804be5:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804bec:	00 
+  804bed:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804bf1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bf5:	48 01 d0             	add    %rdx,%rax
+  804bf8:	48 83 e8 01          	sub    $0x1,%rax
+  804bfc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804c00:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c04:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c09:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804c0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c11:	48 29 d0             	sub    %rdx,%rax
+  804c14:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804c18:	41 89 c2             	mov    %eax,%r10d
+  804c1b:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  804c22:	00 00 00 
+  804c25:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c28:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804c2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804c30:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804c33:	48 83 ec 08          	sub    $0x8,%rsp
+  804c37:	6a 40                	push   $0x40
+  804c39:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804c3e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804c45:	00 
+  804c46:	6a 05                	push   $0x5
+  804c48:	41 89 f9             	mov    %edi,%r9d
+  804c4b:	49 89 c8             	mov    %rcx,%r8
+  804c4e:	44 89 d1             	mov    %r10d,%ecx
+  804c51:	89 c7                	mov    %eax,%edi
+  804c53:	49 89 df             	mov    %rbx,%r15
+  804c56:	48 b8 65 a9 ff ff ff 	movabs $0xffffffffffffa965,%rax
+  804c5d:	ff ff ff 
+  804c60:	48 01 d8             	add    %rbx,%rax
+  804c63:	ff d0                	call   *%rax
+  804c65:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804c69:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804c6d:	5b                   	pop    %rbx
+  804c6e:	41 5f                	pop    %r15
+  804c70:	5d                   	pop    %rbp
+  804c71:	c3                   	ret
+
+0000000000804c72 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804c72:	55                   	push   %rbp
+  804c73:	48 89 e5             	mov    %rsp,%rbp
+  804c76:	41 57                	push   %r15
+  804c78:	53                   	push   %rbx
+  804c79:	48 83 ec 20          	sub    $0x20,%rsp
+  804c7d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c7d <open+0xb>
+  804c84:	49 bb c3 43 00 00 00 	movabs $0x43c3,%r11
+  804c8b:	00 00 00 
+  804c8e:	4c 01 db             	add    %r11,%rbx
+  804c91:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804c95:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804c98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c9c:	48 89 c7             	mov    %rax,%rdi
+  804c9f:	49 89 df             	mov    %rbx,%r15
+  804ca2:	48 b8 27 91 ff ff ff 	movabs $0xffffffffffff9127,%rax
+  804ca9:	ff ff ff 
+  804cac:	48 01 d8             	add    %rbx,%rax
+  804caf:	ff d0                	call   *%rax
+  804cb1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804cb6:	7e 0a                	jle    804cc2 <open+0x50>
+		return -E_BAD_PATH;
+  804cb8:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804cbd:	e9 18 01 00 00       	jmp    804dda <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804cc2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804cc6:	48 89 c7             	mov    %rax,%rdi
+  804cc9:	49 89 df             	mov    %rbx,%r15
+  804ccc:	48 b8 66 ae ff ff ff 	movabs $0xffffffffffffae66,%rax
+  804cd3:	ff ff ff 
+  804cd6:	48 01 d8             	add    %rbx,%rax
+  804cd9:	ff d0                	call   *%rax
+  804cdb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cde:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ce2:	74 08                	je     804cec <open+0x7a>
+		return r;
+  804ce4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ce7:	e9 ee 00 00 00       	jmp    804dda <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804cec:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  804cf3:	00 00 00 
+  804cf6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804cf9:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804d00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d04:	48 89 c6             	mov    %rax,%rsi
+  804d07:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  804d0e:	00 00 00 
+  804d11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d15:	48 89 c7             	mov    %rax,%rdi
+  804d18:	49 89 df             	mov    %rbx,%r15
+  804d1b:	48 b8 bb 91 ff ff ff 	movabs $0xffffffffffff91bb,%rax
+  804d22:	ff ff ff 
+  804d25:	48 01 d8             	add    %rbx,%rax
+  804d28:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804d2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d2e:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804d33:	48 89 c6             	mov    %rax,%rsi
+  804d36:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d3b:	49 89 df             	mov    %rbx,%r15
+  804d3e:	48 b8 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%rax
+  804d45:	ff ff ff 
+  804d48:	48 01 d8             	add    %rbx,%rax
+  804d4b:	ff d0                	call   *%rax
+  804d4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d50:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d54:	74 23                	je     804d79 <open+0x107>
+		fd_close(fd,0);
+  804d56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d5a:	be 00 00 00 00       	mov    $0x0,%esi
+  804d5f:	48 89 c7             	mov    %rax,%rdi
+  804d62:	49 89 df             	mov    %rbx,%r15
+  804d65:	48 b8 c7 af ff ff ff 	movabs $0xffffffffffffafc7,%rax
+  804d6c:	ff ff ff 
+  804d6f:	48 01 d8             	add    %rbx,%rax
+  804d72:	ff d0                	call   *%rax
+		return r;
+  804d74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d77:	eb 61                	jmp    804dda <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804d79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d7d:	48 89 c6             	mov    %rax,%rsi
+  804d80:	bf 01 00 00 00       	mov    $0x1,%edi
+  804d85:	48 b8 eb b9 ff ff ff 	movabs $0xffffffffffffb9eb,%rax
+  804d8c:	ff ff ff 
+  804d8f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d93:	ff d0                	call   *%rax
+  804d95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d9c:	74 23                	je     804dc1 <open+0x14f>
+		fd_close(fd,0);
+  804d9e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804da2:	be 00 00 00 00       	mov    $0x0,%esi
+  804da7:	48 89 c7             	mov    %rax,%rdi
+  804daa:	49 89 df             	mov    %rbx,%r15
+  804dad:	48 b8 c7 af ff ff ff 	movabs $0xffffffffffffafc7,%rax
+  804db4:	ff ff ff 
+  804db7:	48 01 d8             	add    %rbx,%rax
+  804dba:	ff d0                	call   *%rax
+		return r;
+  804dbc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dbf:	eb 19                	jmp    804dda <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804dc1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804dc5:	48 89 c7             	mov    %rax,%rdi
+  804dc8:	49 89 df             	mov    %rbx,%r15
+  804dcb:	48 b8 ec ad ff ff ff 	movabs $0xffffffffffffadec,%rax
+  804dd2:	ff ff ff 
+  804dd5:	48 01 d8             	add    %rbx,%rax
+  804dd8:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804dda:	48 83 c4 20          	add    $0x20,%rsp
+  804dde:	5b                   	pop    %rbx
+  804ddf:	41 5f                	pop    %r15
+  804de1:	5d                   	pop    %rbp
+  804de2:	c3                   	ret
+
+0000000000804de3 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804de3:	55                   	push   %rbp
+  804de4:	48 89 e5             	mov    %rsp,%rbp
+  804de7:	48 83 ec 20          	sub    $0x20,%rsp
+  804deb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804deb <devfile_flush+0x8>
+  804df2:	49 bb 55 42 00 00 00 	movabs $0x4255,%r11
+  804df9:	00 00 00 
+  804dfc:	4c 01 d8             	add    %r11,%rax
+  804dff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804e03:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804e07:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804e0a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804e0d:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804e11:	ba 04 00 00 00       	mov    $0x4,%edx
+  804e16:	48 89 ce             	mov    %rcx,%rsi
+  804e19:	bf 06 00 00 00       	mov    $0x6,%edi
+  804e1e:	48 b9 93 ba ff ff ff 	movabs $0xffffffffffffba93,%rcx
+  804e25:	ff ff ff 
+  804e28:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804e2c:	ff d0                	call   *%rax
+}
+  804e2e:	c9                   	leave
+  804e2f:	c3                   	ret
+
+0000000000804e30 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804e30:	55                   	push   %rbp
+  804e31:	48 89 e5             	mov    %rsp,%rbp
+  804e34:	41 57                	push   %r15
+  804e36:	53                   	push   %rbx
+  804e37:	48 83 ec 60          	sub    $0x60,%rsp
+  804e3b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e3b <devfile_read+0xb>
+  804e42:	49 bb 05 42 00 00 00 	movabs $0x4205,%r11
+  804e49:	00 00 00 
+  804e4c:	4c 01 db             	add    %r11,%rbx
+  804e4f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804e53:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804e57:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804e5b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804e5f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804e63:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e67:	8b 50 0c             	mov    0xc(%rax),%edx
+  804e6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e6e:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804e70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e74:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804e78:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804e7c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804e80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804e85:	ba 10 00 00 00       	mov    $0x10,%edx
+  804e8a:	48 89 c6             	mov    %rax,%rsi
+  804e8d:	bf 03 00 00 00       	mov    $0x3,%edi
+  804e92:	48 b8 27 bb ff ff ff 	movabs $0xffffffffffffbb27,%rax
+  804e99:	ff ff ff 
+  804e9c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ea0:	ff d0                	call   *%rax
+  804ea2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804ea5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804ea9:	79 05                	jns    804eb0 <devfile_read+0x80>
+		return r;
+  804eab:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804eae:	eb 64                	jmp    804f14 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804eb0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804eb3:	48 63 d0             	movslq %eax,%rdx
+  804eb6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804eba:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804ebf:	48 01 c1             	add    %rax,%rcx
+  804ec2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804ec6:	48 89 ce             	mov    %rcx,%rsi
+  804ec9:	48 89 c7             	mov    %rax,%rdi
+  804ecc:	49 89 df             	mov    %rbx,%r15
+  804ecf:	48 b8 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rax
+  804ed6:	ff ff ff 
+  804ed9:	48 01 d8             	add    %rbx,%rax
+  804edc:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804ede:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  804ee5:	ff ff ff 
+  804ee8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804eec:	48 8b 00             	mov    (%rax),%rax
+  804eef:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804ef5:	89 c6                	mov    %eax,%esi
+  804ef7:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804efc:	48 89 c7             	mov    %rax,%rdi
+  804eff:	49 89 df             	mov    %rbx,%r15
+  804f02:	48 b8 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rax
+  804f09:	ff ff ff 
+  804f0c:	48 01 d8             	add    %rbx,%rax
+  804f0f:	ff d0                	call   *%rax
+	return r;
+  804f11:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804f14:	48 83 c4 60          	add    $0x60,%rsp
+  804f18:	5b                   	pop    %rbx
+  804f19:	41 5f                	pop    %r15
+  804f1b:	5d                   	pop    %rbp
+  804f1c:	c3                   	ret
+
+0000000000804f1d <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804f1d:	55                   	push   %rbp
+  804f1e:	48 89 e5             	mov    %rsp,%rbp
+  804f21:	41 57                	push   %r15
+  804f23:	53                   	push   %rbx
+  804f24:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804f28:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f28 <devfile_write+0xb>
+  804f2f:	49 bb 18 41 00 00 00 	movabs $0x4118,%r11
+  804f36:	00 00 00 
+  804f39:	4c 01 db             	add    %r11,%rbx
+  804f3c:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804f40:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804f44:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804f4b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804f4f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804f53:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804f5a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804f5e:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804f65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f68:	48 63 d0             	movslq %eax,%rdx
+  804f6b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f6f:	48 39 c2             	cmp    %rax,%rdx
+  804f72:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f76:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804f7d:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804f84:	00 
+  804f85:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804f8c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f90:	48 01 d0             	add    %rdx,%rax
+  804f93:	48 83 e8 01          	sub    $0x1,%rax
+  804f97:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804f9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fa4:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804fa8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fac:	48 29 d0             	sub    %rdx,%rax
+  804faf:	48 c1 e8 0c          	shr    $0xc,%rax
+  804fb3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804fb6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804fb9:	89 c6                	mov    %eax,%esi
+  804fbb:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804fc0:	48 89 c7             	mov    %rax,%rdi
+  804fc3:	49 89 df             	mov    %rbx,%r15
+  804fc6:	48 b8 d1 ac ff ff ff 	movabs $0xffffffffffffacd1,%rax
+  804fcd:	ff ff ff 
+  804fd0:	48 01 d8             	add    %rbx,%rax
+  804fd3:	ff d0                	call   *%rax
+  804fd5:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804fd8:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804fdc:	79 08                	jns    804fe6 <devfile_write+0xc9>
+		return r;
+  804fde:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804fe1:	e9 8f 00 00 00       	jmp    805075 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804fe6:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804fed:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804ff1:	48 89 c6             	mov    %rax,%rsi
+  804ff4:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804ff9:	48 89 c7             	mov    %rax,%rdi
+  804ffc:	49 89 df             	mov    %rbx,%r15
+  804fff:	48 b8 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rax
+  805006:	ff ff ff 
+  805009:	48 01 d8             	add    %rbx,%rax
+  80500c:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  80500e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  805012:	8b 50 0c             	mov    0xc(%rax),%edx
+  805015:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805019:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80501b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80501f:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  805026:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  80502a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80502d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805031:	89 d1                	mov    %edx,%ecx
+  805033:	ba 10 00 00 00       	mov    $0x10,%edx
+  805038:	48 89 c6             	mov    %rax,%rsi
+  80503b:	bf 04 00 00 00       	mov    $0x4,%edi
+  805040:	48 b8 27 bb ff ff ff 	movabs $0xffffffffffffbb27,%rax
+  805047:	ff ff ff 
+  80504a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80504e:	ff d0                	call   *%rax
+  805050:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  805053:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805056:	89 c6                	mov    %eax,%esi
+  805058:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  80505d:	48 89 c7             	mov    %rax,%rdi
+  805060:	49 89 df             	mov    %rbx,%r15
+  805063:	48 b8 17 ad ff ff ff 	movabs $0xffffffffffffad17,%rax
+  80506a:	ff ff ff 
+  80506d:	48 01 d8             	add    %rbx,%rax
+  805070:	ff d0                	call   *%rax
+	return r;
+  805072:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  805075:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  805079:	5b                   	pop    %rbx
+  80507a:	41 5f                	pop    %r15
+  80507c:	5d                   	pop    %rbp
+  80507d:	c3                   	ret
+
+000000000080507e <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  80507e:	55                   	push   %rbp
+  80507f:	48 89 e5             	mov    %rsp,%rbp
+  805082:	41 57                	push   %r15
+  805084:	53                   	push   %rbx
+  805085:	48 83 ec 20          	sub    $0x20,%rsp
+  805089:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805089 <devfile_stat+0xb>
+  805090:	49 bb b7 3f 00 00 00 	movabs $0x3fb7,%r11
+  805097:	00 00 00 
+  80509a:	4c 01 db             	add    %r11,%rbx
+  80509d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8050a1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8050a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050a9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8050ac:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8050b3:	00 00 00 
+  8050b6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8050b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8050be:	bf 05 00 00 00       	mov    $0x5,%edi
+  8050c3:	48 b8 eb b9 ff ff ff 	movabs $0xffffffffffffb9eb,%rax
+  8050ca:	ff ff ff 
+  8050cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8050d1:	ff d0                	call   *%rax
+  8050d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050da:	79 05                	jns    8050e1 <devfile_stat+0x63>
+		return r;
+  8050dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050df:	eb 65                	jmp    805146 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8050e1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050e5:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8050ec:	00 00 00 
+  8050ef:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8050f3:	48 89 d6             	mov    %rdx,%rsi
+  8050f6:	48 89 c7             	mov    %rax,%rdi
+  8050f9:	49 89 df             	mov    %rbx,%r15
+  8050fc:	48 b8 bb 91 ff ff ff 	movabs $0xffffffffffff91bb,%rax
+  805103:	ff ff ff 
+  805106:	48 01 d8             	add    %rbx,%rax
+  805109:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80510b:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805112:	00 00 00 
+  805115:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  80511c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805120:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  805126:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  80512d:	00 00 00 
+  805130:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  805137:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80513b:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  805141:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805146:	48 83 c4 20          	add    $0x20,%rsp
+  80514a:	5b                   	pop    %rbx
+  80514b:	41 5f                	pop    %r15
+  80514d:	5d                   	pop    %rbp
+  80514e:	c3                   	ret
+
+000000000080514f <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80514f:	55                   	push   %rbp
+  805150:	48 89 e5             	mov    %rsp,%rbp
+  805153:	48 83 ec 20          	sub    $0x20,%rsp
+  805157:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805157 <devfile_trunc+0x8>
+  80515e:	49 bb e9 3e 00 00 00 	movabs $0x3ee9,%r11
+  805165:	00 00 00 
+  805168:	4c 01 d8             	add    %r11,%rax
+  80516b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80516f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  805172:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805176:	8b 52 0c             	mov    0xc(%rdx),%edx
+  805179:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  80517c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80517f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  805182:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805186:	ba 08 00 00 00       	mov    $0x8,%edx
+  80518b:	48 89 ce             	mov    %rcx,%rsi
+  80518e:	bf 02 00 00 00       	mov    $0x2,%edi
+  805193:	48 b9 93 ba ff ff ff 	movabs $0xffffffffffffba93,%rcx
+  80519a:	ff ff ff 
+  80519d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8051a1:	ff d0                	call   *%rax
+}
+  8051a3:	c9                   	leave
+  8051a4:	c3                   	ret
+
+00000000008051a5 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8051a5:	55                   	push   %rbp
+  8051a6:	48 89 e5             	mov    %rsp,%rbp
+  8051a9:	41 57                	push   %r15
+  8051ab:	53                   	push   %rbx
+  8051ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8051b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051b0 <remove+0xb>
+  8051b7:	49 bb 90 3e 00 00 00 	movabs $0x3e90,%r11
+  8051be:	00 00 00 
+  8051c1:	4c 01 db             	add    %r11,%rbx
+  8051c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8051c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051cc:	48 89 c7             	mov    %rax,%rdi
+  8051cf:	49 89 df             	mov    %rbx,%r15
+  8051d2:	48 b8 27 91 ff ff ff 	movabs $0xffffffffffff9127,%rax
+  8051d9:	ff ff ff 
+  8051dc:	48 01 d8             	add    %rbx,%rax
+  8051df:	ff d0                	call   *%rax
+  8051e1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8051e6:	7e 07                	jle    8051ef <remove+0x4a>
+		return -E_BAD_PATH;
+  8051e8:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8051ed:	eb 44                	jmp    805233 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8051ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051f3:	48 89 c6             	mov    %rax,%rsi
+  8051f6:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8051fd:	00 00 00 
+  805200:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805204:	48 89 c7             	mov    %rax,%rdi
+  805207:	49 89 df             	mov    %rbx,%r15
+  80520a:	48 b8 bb 91 ff ff ff 	movabs $0xffffffffffff91bb,%rax
+  805211:	ff ff ff 
+  805214:	48 01 d8             	add    %rbx,%rax
+  805217:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  805219:	be 00 00 00 00       	mov    $0x0,%esi
+  80521e:	bf 07 00 00 00       	mov    $0x7,%edi
+  805223:	48 b8 eb b9 ff ff ff 	movabs $0xffffffffffffb9eb,%rax
+  80522a:	ff ff ff 
+  80522d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805231:	ff d0                	call   *%rax
+}
+  805233:	48 83 c4 10          	add    $0x10,%rsp
+  805237:	5b                   	pop    %rbx
+  805238:	41 5f                	pop    %r15
+  80523a:	5d                   	pop    %rbp
+  80523b:	c3                   	ret
+
+000000000080523c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80523c:	55                   	push   %rbp
+  80523d:	48 89 e5             	mov    %rsp,%rbp
+  805240:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805240 <sync+0x4>
+  805247:	49 bb 00 3e 00 00 00 	movabs $0x3e00,%r11
+  80524e:	00 00 00 
+  805251:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  805254:	ba 00 00 00 00       	mov    $0x0,%edx
+  805259:	be 00 00 00 00       	mov    $0x0,%esi
+  80525e:	bf 08 00 00 00       	mov    $0x8,%edi
+  805263:	48 b9 93 ba ff ff ff 	movabs $0xffffffffffffba93,%rcx
+  80526a:	ff ff ff 
+  80526d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805271:	ff d0                	call   *%rax
+}
+  805273:	5d                   	pop    %rbp
+  805274:	c3                   	ret
+
+0000000000805275 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  805275:	55                   	push   %rbp
+  805276:	48 89 e5             	mov    %rsp,%rbp
+  805279:	41 57                	push   %r15
+  80527b:	53                   	push   %rbx
+  80527c:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  805283:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805283 <copy+0xe>
+  80528a:	49 bb bd 3d 00 00 00 	movabs $0x3dbd,%r11
+  805291:	00 00 00 
+  805294:	4c 01 db             	add    %r11,%rbx
+  805297:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  80529e:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8052a5:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8052ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8052b1:	48 89 c7             	mov    %rax,%rdi
+  8052b4:	48 b8 32 bc ff ff ff 	movabs $0xffffffffffffbc32,%rax
+  8052bb:	ff ff ff 
+  8052be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052c2:	ff d0                	call   *%rax
+  8052c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8052c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8052cb:	79 35                	jns    805302 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8052cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052d0:	89 c6                	mov    %eax,%esi
+  8052d2:	48 b8 e6 e6 ff ff ff 	movabs $0xffffffffffffe6e6,%rax
+  8052d9:	ff ff ff 
+  8052dc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052e0:	48 89 c7             	mov    %rax,%rdi
+  8052e3:	49 89 df             	mov    %rbx,%r15
+  8052e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052eb:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  8052f2:	ff ff ff 
+  8052f5:	48 01 da             	add    %rbx,%rdx
+  8052f8:	ff d2                	call   *%rdx
+		return fd_src;
+  8052fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052fd:	e9 d7 01 00 00       	jmp    8054d9 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  805302:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  805309:	be 01 01 00 00       	mov    $0x101,%esi
+  80530e:	48 89 c7             	mov    %rax,%rdi
+  805311:	48 b8 32 bc ff ff ff 	movabs $0xffffffffffffbc32,%rax
+  805318:	ff ff ff 
+  80531b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80531f:	ff d0                	call   *%rax
+  805321:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  805324:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  805328:	0f 89 df 00 00 00    	jns    80540d <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  80532e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805331:	89 c6                	mov    %eax,%esi
+  805333:	48 b8 fc e6 ff ff ff 	movabs $0xffffffffffffe6fc,%rax
+  80533a:	ff ff ff 
+  80533d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805341:	48 89 c7             	mov    %rax,%rdi
+  805344:	49 89 df             	mov    %rbx,%r15
+  805347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80534c:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  805353:	ff ff ff 
+  805356:	48 01 da             	add    %rbx,%rdx
+  805359:	ff d2                	call   *%rdx
+		close(fd_src);
+  80535b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80535e:	89 c7                	mov    %eax,%edi
+  805360:	49 89 df             	mov    %rbx,%r15
+  805363:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  80536a:	ff ff ff 
+  80536d:	48 01 d8             	add    %rbx,%rax
+  805370:	ff d0                	call   *%rax
+		return fd_dest;
+  805372:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805375:	e9 5f 01 00 00       	jmp    8054d9 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  80537a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80537d:	48 63 d0             	movslq %eax,%rdx
+  805380:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805387:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80538a:	48 89 ce             	mov    %rcx,%rsi
+  80538d:	89 c7                	mov    %eax,%edi
+  80538f:	49 89 df             	mov    %rbx,%r15
+  805392:	48 b8 09 b6 ff ff ff 	movabs $0xffffffffffffb609,%rax
+  805399:	ff ff ff 
+  80539c:	48 01 d8             	add    %rbx,%rax
+  80539f:	ff d0                	call   *%rax
+  8053a1:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8053a4:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8053a8:	79 63                	jns    80540d <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8053aa:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8053ad:	89 c6                	mov    %eax,%esi
+  8053af:	48 b8 16 e7 ff ff ff 	movabs $0xffffffffffffe716,%rax
+  8053b6:	ff ff ff 
+  8053b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053bd:	48 89 c7             	mov    %rax,%rdi
+  8053c0:	49 89 df             	mov    %rbx,%r15
+  8053c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053c8:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  8053cf:	ff ff ff 
+  8053d2:	48 01 da             	add    %rbx,%rdx
+  8053d5:	ff d2                	call   *%rdx
+			close(fd_src);
+  8053d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053da:	89 c7                	mov    %eax,%edi
+  8053dc:	49 89 df             	mov    %rbx,%r15
+  8053df:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  8053e6:	ff ff ff 
+  8053e9:	48 01 d8             	add    %rbx,%rax
+  8053ec:	ff d0                	call   *%rax
+			close(fd_dest);
+  8053ee:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053f1:	89 c7                	mov    %eax,%edi
+  8053f3:	49 89 df             	mov    %rbx,%r15
+  8053f6:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  8053fd:	ff ff ff 
+  805400:	48 01 d8             	add    %rbx,%rax
+  805403:	ff d0                	call   *%rax
+			return write_size;
+  805405:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805408:	e9 cc 00 00 00       	jmp    8054d9 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  80540d:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805414:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805417:	ba 00 02 00 00       	mov    $0x200,%edx
+  80541c:	48 89 ce             	mov    %rcx,%rsi
+  80541f:	89 c7                	mov    %eax,%edi
+  805421:	49 89 df             	mov    %rbx,%r15
+  805424:	48 b8 63 b4 ff ff ff 	movabs $0xffffffffffffb463,%rax
+  80542b:	ff ff ff 
+  80542e:	48 01 d8             	add    %rbx,%rax
+  805431:	ff d0                	call   *%rax
+  805433:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805436:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80543a:	0f 8f 3a ff ff ff    	jg     80537a <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805440:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805444:	79 60                	jns    8054a6 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  805446:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805449:	89 c6                	mov    %eax,%esi
+  80544b:	48 b8 29 e7 ff ff ff 	movabs $0xffffffffffffe729,%rax
+  805452:	ff ff ff 
+  805455:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805459:	48 89 c7             	mov    %rax,%rdi
+  80545c:	49 89 df             	mov    %rbx,%r15
+  80545f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805464:	48 ba f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%rdx
+  80546b:	ff ff ff 
+  80546e:	48 01 da             	add    %rbx,%rdx
+  805471:	ff d2                	call   *%rdx
+		close(fd_src);
+  805473:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805476:	89 c7                	mov    %eax,%edi
+  805478:	49 89 df             	mov    %rbx,%r15
+  80547b:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  805482:	ff ff ff 
+  805485:	48 01 d8             	add    %rbx,%rax
+  805488:	ff d0                	call   *%rax
+		close(fd_dest);
+  80548a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80548d:	89 c7                	mov    %eax,%edi
+  80548f:	49 89 df             	mov    %rbx,%r15
+  805492:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  805499:	ff ff ff 
+  80549c:	48 01 d8             	add    %rbx,%rax
+  80549f:	ff d0                	call   *%rax
+		return read_size;
+  8054a1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8054a4:	eb 33                	jmp    8054d9 <copy+0x264>
+	}
+	close(fd_src);
+  8054a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054a9:	89 c7                	mov    %eax,%edi
+  8054ab:	49 89 df             	mov    %rbx,%r15
+  8054ae:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  8054b5:	ff ff ff 
+  8054b8:	48 01 d8             	add    %rbx,%rax
+  8054bb:	ff d0                	call   *%rax
+	close(fd_dest);
+  8054bd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8054c0:	89 c7                	mov    %eax,%edi
+  8054c2:	49 89 df             	mov    %rbx,%r15
+  8054c5:	48 b8 ab b1 ff ff ff 	movabs $0xffffffffffffb1ab,%rax
+  8054cc:	ff ff ff 
+  8054cf:	48 01 d8             	add    %rbx,%rax
+  8054d2:	ff d0                	call   *%rax
+	return 0;
+  8054d4:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  8054d9:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  8054e0:	5b                   	pop    %rbx
+  8054e1:	41 5f                	pop    %r15
+  8054e3:	5d                   	pop    %rbp
+  8054e4:	c3                   	ret
+
+00000000008054e5 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  8054e5:	55                   	push   %rbp
+  8054e6:	48 89 e5             	mov    %rsp,%rbp
+  8054e9:	41 57                	push   %r15
+  8054eb:	53                   	push   %rbx
+  8054ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8054f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054f0 <fd2sockid+0xb>
+  8054f7:	49 bb 50 3b 00 00 00 	movabs $0x3b50,%r11
+  8054fe:	00 00 00 
+  805501:	4c 01 db             	add    %r11,%rbx
+  805504:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805507:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80550b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80550e:	48 89 d6             	mov    %rdx,%rsi
+  805511:	89 c7                	mov    %eax,%edi
+  805513:	49 89 df             	mov    %rbx,%r15
+  805516:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  80551d:	ff ff ff 
+  805520:	48 01 d8             	add    %rbx,%rax
+  805523:	ff d0                	call   *%rax
+  805525:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805528:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80552c:	79 05                	jns    805533 <fd2sockid+0x4e>
+		return r;
+  80552e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805531:	eb 25                	jmp    805558 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805533:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805537:	8b 10                	mov    (%rax),%edx
+  805539:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  805540:	00 00 00 
+  805543:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805546:	39 c2                	cmp    %eax,%edx
+  805548:	74 07                	je     805551 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80554a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80554f:	eb 07                	jmp    805558 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  805551:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805555:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  805558:	48 83 c4 20          	add    $0x20,%rsp
+  80555c:	5b                   	pop    %rbx
+  80555d:	41 5f                	pop    %r15
+  80555f:	5d                   	pop    %rbp
+  805560:	c3                   	ret
+
+0000000000805561 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  805561:	55                   	push   %rbp
+  805562:	48 89 e5             	mov    %rsp,%rbp
+  805565:	41 57                	push   %r15
+  805567:	53                   	push   %rbx
+  805568:	48 83 ec 20          	sub    $0x20,%rsp
+  80556c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80556c <alloc_sockfd+0xb>
+  805573:	49 bb d4 3a 00 00 00 	movabs $0x3ad4,%r11
+  80557a:	00 00 00 
+  80557d:	4c 01 db             	add    %r11,%rbx
+  805580:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  805583:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805587:	48 89 c7             	mov    %rax,%rdi
+  80558a:	49 89 df             	mov    %rbx,%r15
+  80558d:	48 b8 66 ae ff ff ff 	movabs $0xffffffffffffae66,%rax
+  805594:	ff ff ff 
+  805597:	48 01 d8             	add    %rbx,%rax
+  80559a:	ff d0                	call   *%rax
+  80559c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80559f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055a3:	78 2c                	js     8055d1 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8055a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055a9:	ba 07 04 00 00       	mov    $0x407,%edx
+  8055ae:	48 89 c6             	mov    %rax,%rsi
+  8055b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055b6:	49 89 df             	mov    %rbx,%r15
+  8055b9:	48 b8 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%rax
+  8055c0:	ff ff ff 
+  8055c3:	48 01 d8             	add    %rbx,%rax
+  8055c6:	ff d0                	call   *%rax
+  8055c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055cf:	79 1c                	jns    8055ed <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  8055d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8055d4:	89 c7                	mov    %eax,%edi
+  8055d6:	49 89 df             	mov    %rbx,%r15
+  8055d9:	48 b8 15 cd ff ff ff 	movabs $0xffffffffffffcd15,%rax
+  8055e0:	ff ff ff 
+  8055e3:	48 01 d8             	add    %rbx,%rax
+  8055e6:	ff d0                	call   *%rax
+		return r;
+  8055e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055eb:	eb 41                	jmp    80562e <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  8055ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055f1:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  8055f8:	00 00 00 
+  8055fb:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8055fe:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805600:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805604:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80560b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80560f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805612:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805615:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805619:	48 89 c7             	mov    %rax,%rdi
+  80561c:	49 89 df             	mov    %rbx,%r15
+  80561f:	48 b8 ec ad ff ff ff 	movabs $0xffffffffffffadec,%rax
+  805626:	ff ff ff 
+  805629:	48 01 d8             	add    %rbx,%rax
+  80562c:	ff d0                	call   *%rax
+}
+  80562e:	48 83 c4 20          	add    $0x20,%rsp
+  805632:	5b                   	pop    %rbx
+  805633:	41 5f                	pop    %r15
+  805635:	5d                   	pop    %rbp
+  805636:	c3                   	ret
+
+0000000000805637 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805637:	55                   	push   %rbp
+  805638:	48 89 e5             	mov    %rsp,%rbp
+  80563b:	41 57                	push   %r15
+  80563d:	53                   	push   %rbx
+  80563e:	48 83 ec 30          	sub    $0x30,%rsp
+  805642:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805642 <accept+0xb>
+  805649:	49 bb fe 39 00 00 00 	movabs $0x39fe,%r11
+  805650:	00 00 00 
+  805653:	4c 01 db             	add    %r11,%rbx
+  805656:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805659:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80565d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805661:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805664:	89 c7                	mov    %eax,%edi
+  805666:	48 b8 a5 c4 ff ff ff 	movabs $0xffffffffffffc4a5,%rax
+  80566d:	ff ff ff 
+  805670:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805674:	ff d0                	call   *%rax
+  805676:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805679:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80567d:	79 05                	jns    805684 <accept+0x4d>
+		return r;
+  80567f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805682:	eb 45                	jmp    8056c9 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  805684:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805688:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80568c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80568f:	48 89 ce             	mov    %rcx,%rsi
+  805692:	89 c7                	mov    %eax,%edi
+  805694:	49 89 df             	mov    %rbx,%r15
+  805697:	48 b8 83 cb ff ff ff 	movabs $0xffffffffffffcb83,%rax
+  80569e:	ff ff ff 
+  8056a1:	48 01 d8             	add    %rbx,%rax
+  8056a4:	ff d0                	call   *%rax
+  8056a6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056ad:	79 05                	jns    8056b4 <accept+0x7d>
+		return r;
+  8056af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056b2:	eb 15                	jmp    8056c9 <accept+0x92>
+	return alloc_sockfd(r);
+  8056b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056b7:	89 c7                	mov    %eax,%edi
+  8056b9:	48 b8 21 c5 ff ff ff 	movabs $0xffffffffffffc521,%rax
+  8056c0:	ff ff ff 
+  8056c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056c7:	ff d0                	call   *%rax
+}
+  8056c9:	48 83 c4 30          	add    $0x30,%rsp
+  8056cd:	5b                   	pop    %rbx
+  8056ce:	41 5f                	pop    %r15
+  8056d0:	5d                   	pop    %rbp
+  8056d1:	c3                   	ret
+
+00000000008056d2 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8056d2:	55                   	push   %rbp
+  8056d3:	48 89 e5             	mov    %rsp,%rbp
+  8056d6:	41 57                	push   %r15
+  8056d8:	53                   	push   %rbx
+  8056d9:	48 83 ec 20          	sub    $0x20,%rsp
+  8056dd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056dd <bind+0xb>
+  8056e4:	49 bb 63 39 00 00 00 	movabs $0x3963,%r11
+  8056eb:	00 00 00 
+  8056ee:	4c 01 db             	add    %r11,%rbx
+  8056f1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8056f4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8056f8:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8056fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8056fe:	89 c7                	mov    %eax,%edi
+  805700:	48 b8 a5 c4 ff ff ff 	movabs $0xffffffffffffc4a5,%rax
+  805707:	ff ff ff 
+  80570a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80570e:	ff d0                	call   *%rax
+  805710:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805713:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805717:	79 05                	jns    80571e <bind+0x4c>
+		return r;
+  805719:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80571c:	eb 21                	jmp    80573f <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80571e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805721:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805725:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805728:	48 89 ce             	mov    %rcx,%rsi
+  80572b:	89 c7                	mov    %eax,%edi
+  80572d:	49 89 df             	mov    %rbx,%r15
+  805730:	48 b8 2f cc ff ff ff 	movabs $0xffffffffffffcc2f,%rax
+  805737:	ff ff ff 
+  80573a:	48 01 d8             	add    %rbx,%rax
+  80573d:	ff d0                	call   *%rax
+}
+  80573f:	48 83 c4 20          	add    $0x20,%rsp
+  805743:	5b                   	pop    %rbx
+  805744:	41 5f                	pop    %r15
+  805746:	5d                   	pop    %rbp
+  805747:	c3                   	ret
+
+0000000000805748 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  805748:	55                   	push   %rbp
+  805749:	48 89 e5             	mov    %rsp,%rbp
+  80574c:	41 57                	push   %r15
+  80574e:	53                   	push   %rbx
+  80574f:	48 83 ec 20          	sub    $0x20,%rsp
+  805753:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805753 <shutdown+0xb>
+  80575a:	49 bb ed 38 00 00 00 	movabs $0x38ed,%r11
+  805761:	00 00 00 
+  805764:	4c 01 db             	add    %r11,%rbx
+  805767:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80576a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80576d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805770:	89 c7                	mov    %eax,%edi
+  805772:	48 b8 a5 c4 ff ff ff 	movabs $0xffffffffffffc4a5,%rax
+  805779:	ff ff ff 
+  80577c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805780:	ff d0                	call   *%rax
+  805782:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805785:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805789:	79 05                	jns    805790 <shutdown+0x48>
+		return r;
+  80578b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80578e:	eb 1c                	jmp    8057ac <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  805790:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805793:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805796:	89 d6                	mov    %edx,%esi
+  805798:	89 c7                	mov    %eax,%edi
+  80579a:	49 89 df             	mov    %rbx,%r15
+  80579d:	48 b8 c4 cc ff ff ff 	movabs $0xffffffffffffccc4,%rax
+  8057a4:	ff ff ff 
+  8057a7:	48 01 d8             	add    %rbx,%rax
+  8057aa:	ff d0                	call   *%rax
+}
+  8057ac:	48 83 c4 20          	add    $0x20,%rsp
+  8057b0:	5b                   	pop    %rbx
+  8057b1:	41 5f                	pop    %r15
+  8057b3:	5d                   	pop    %rbp
+  8057b4:	c3                   	ret
+
+00000000008057b5 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8057b5:	55                   	push   %rbp
+  8057b6:	48 89 e5             	mov    %rsp,%rbp
+  8057b9:	41 57                	push   %r15
+  8057bb:	53                   	push   %rbx
+  8057bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8057c0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057c0 <devsock_close+0xb>
+  8057c7:	49 bb 80 38 00 00 00 	movabs $0x3880,%r11
+  8057ce:	00 00 00 
+  8057d1:	4c 01 db             	add    %r11,%rbx
+  8057d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  8057d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057dc:	48 89 c7             	mov    %rax,%rdi
+  8057df:	49 89 df             	mov    %rbx,%r15
+  8057e2:	48 b8 f5 dc ff ff ff 	movabs $0xffffffffffffdcf5,%rax
+  8057e9:	ff ff ff 
+  8057ec:	48 01 d8             	add    %rbx,%rax
+  8057ef:	ff d0                	call   *%rax
+  8057f1:	83 f8 01             	cmp    $0x1,%eax
+  8057f4:	75 1d                	jne    805813 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  8057f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8057fa:	8b 40 0c             	mov    0xc(%rax),%eax
+  8057fd:	89 c7                	mov    %eax,%edi
+  8057ff:	49 89 df             	mov    %rbx,%r15
+  805802:	48 b8 15 cd ff ff ff 	movabs $0xffffffffffffcd15,%rax
+  805809:	ff ff ff 
+  80580c:	48 01 d8             	add    %rbx,%rax
+  80580f:	ff d0                	call   *%rax
+  805811:	eb 05                	jmp    805818 <devsock_close+0x63>
+	else
+		return 0;
+  805813:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805818:	48 83 c4 10          	add    $0x10,%rsp
+  80581c:	5b                   	pop    %rbx
+  80581d:	41 5f                	pop    %r15
+  80581f:	5d                   	pop    %rbp
+  805820:	c3                   	ret
+
+0000000000805821 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805821:	55                   	push   %rbp
+  805822:	48 89 e5             	mov    %rsp,%rbp
+  805825:	41 57                	push   %r15
+  805827:	53                   	push   %rbx
+  805828:	48 83 ec 20          	sub    $0x20,%rsp
+  80582c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80582c <connect+0xb>
+  805833:	49 bb 14 38 00 00 00 	movabs $0x3814,%r11
+  80583a:	00 00 00 
+  80583d:	4c 01 db             	add    %r11,%rbx
+  805840:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805843:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805847:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80584a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80584d:	89 c7                	mov    %eax,%edi
+  80584f:	48 b8 a5 c4 ff ff ff 	movabs $0xffffffffffffc4a5,%rax
+  805856:	ff ff ff 
+  805859:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80585d:	ff d0                	call   *%rax
+  80585f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805862:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805866:	79 05                	jns    80586d <connect+0x4c>
+		return r;
+  805868:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80586b:	eb 21                	jmp    80588e <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80586d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805870:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805874:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805877:	48 89 ce             	mov    %rcx,%rsi
+  80587a:	89 c7                	mov    %eax,%edi
+  80587c:	49 89 df             	mov    %rbx,%r15
+  80587f:	48 b8 5d cd ff ff ff 	movabs $0xffffffffffffcd5d,%rax
+  805886:	ff ff ff 
+  805889:	48 01 d8             	add    %rbx,%rax
+  80588c:	ff d0                	call   *%rax
+}
+  80588e:	48 83 c4 20          	add    $0x20,%rsp
+  805892:	5b                   	pop    %rbx
+  805893:	41 5f                	pop    %r15
+  805895:	5d                   	pop    %rbp
+  805896:	c3                   	ret
+
+0000000000805897 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  805897:	55                   	push   %rbp
+  805898:	48 89 e5             	mov    %rsp,%rbp
+  80589b:	41 57                	push   %r15
+  80589d:	53                   	push   %rbx
+  80589e:	48 83 ec 20          	sub    $0x20,%rsp
+  8058a2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058a2 <listen+0xb>
+  8058a9:	49 bb 9e 37 00 00 00 	movabs $0x379e,%r11
+  8058b0:	00 00 00 
+  8058b3:	4c 01 db             	add    %r11,%rbx
+  8058b6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8058b9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8058bc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058bf:	89 c7                	mov    %eax,%edi
+  8058c1:	48 b8 a5 c4 ff ff ff 	movabs $0xffffffffffffc4a5,%rax
+  8058c8:	ff ff ff 
+  8058cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8058cf:	ff d0                	call   *%rax
+  8058d1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8058d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058d8:	79 05                	jns    8058df <listen+0x48>
+		return r;
+  8058da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058dd:	eb 1c                	jmp    8058fb <listen+0x64>
+	return nsipc_listen(r, backlog);
+  8058df:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8058e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058e5:	89 d6                	mov    %edx,%esi
+  8058e7:	89 c7                	mov    %eax,%edi
+  8058e9:	49 89 df             	mov    %rbx,%r15
+  8058ec:	48 b8 f2 cd ff ff ff 	movabs $0xffffffffffffcdf2,%rax
+  8058f3:	ff ff ff 
+  8058f6:	48 01 d8             	add    %rbx,%rax
+  8058f9:	ff d0                	call   *%rax
+}
+  8058fb:	48 83 c4 20          	add    $0x20,%rsp
+  8058ff:	5b                   	pop    %rbx
+  805900:	41 5f                	pop    %r15
+  805902:	5d                   	pop    %rbp
+  805903:	c3                   	ret
+
+0000000000805904 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805904:	55                   	push   %rbp
+  805905:	48 89 e5             	mov    %rsp,%rbp
+  805908:	41 57                	push   %r15
+  80590a:	48 83 ec 28          	sub    $0x28,%rsp
+  80590e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80590e <devsock_read+0xa>
+  805915:	49 bb 32 37 00 00 00 	movabs $0x3732,%r11
+  80591c:	00 00 00 
+  80591f:	4c 01 d8             	add    %r11,%rax
+  805922:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805926:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80592a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80592e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805932:	41 89 d0             	mov    %edx,%r8d
+  805935:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805939:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80593c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805940:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805945:	44 89 c2             	mov    %r8d,%edx
+  805948:	49 89 c7             	mov    %rax,%r15
+  80594b:	49 b8 43 ce ff ff ff 	movabs $0xffffffffffffce43,%r8
+  805952:	ff ff ff 
+  805955:	49 01 c0             	add    %rax,%r8
+  805958:	41 ff d0             	call   *%r8
+}
+  80595b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80595f:	c9                   	leave
+  805960:	c3                   	ret
+
+0000000000805961 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805961:	55                   	push   %rbp
+  805962:	48 89 e5             	mov    %rsp,%rbp
+  805965:	41 57                	push   %r15
+  805967:	48 83 ec 28          	sub    $0x28,%rsp
+  80596b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80596b <devsock_write+0xa>
+  805972:	49 bb d5 36 00 00 00 	movabs $0x36d5,%r11
+  805979:	00 00 00 
+  80597c:	4c 01 d8             	add    %r11,%rax
+  80597f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805983:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805987:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80598b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80598f:	41 89 d0             	mov    %edx,%r8d
+  805992:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805996:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805999:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80599d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8059a2:	44 89 c2             	mov    %r8d,%edx
+  8059a5:	49 89 c7             	mov    %rax,%r15
+  8059a8:	49 b8 60 cf ff ff ff 	movabs $0xffffffffffffcf60,%r8
+  8059af:	ff ff ff 
+  8059b2:	49 01 c0             	add    %rax,%r8
+  8059b5:	41 ff d0             	call   *%r8
+}
+  8059b8:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8059bc:	c9                   	leave
+  8059bd:	c3                   	ret
+
+00000000008059be <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8059be:	55                   	push   %rbp
+  8059bf:	48 89 e5             	mov    %rsp,%rbp
+  8059c2:	41 57                	push   %r15
+  8059c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8059c8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8059c8 <devsock_stat+0xa>
+  8059cf:	49 bb 78 36 00 00 00 	movabs $0x3678,%r11
+  8059d6:	00 00 00 
+  8059d9:	4c 01 d8             	add    %r11,%rax
+  8059dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8059e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8059e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8059e8:	48 b9 44 e7 ff ff ff 	movabs $0xffffffffffffe744,%rcx
+  8059ef:	ff ff ff 
+  8059f2:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8059f6:	48 89 ce             	mov    %rcx,%rsi
+  8059f9:	48 89 d7             	mov    %rdx,%rdi
+  8059fc:	49 89 c7             	mov    %rax,%r15
+  8059ff:	48 ba bb 91 ff ff ff 	movabs $0xffffffffffff91bb,%rdx
+  805a06:	ff ff ff 
+  805a09:	48 01 c2             	add    %rax,%rdx
+  805a0c:	ff d2                	call   *%rdx
+	return 0;
+  805a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a13:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805a17:	c9                   	leave
+  805a18:	c3                   	ret
+
+0000000000805a19 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  805a19:	55                   	push   %rbp
+  805a1a:	48 89 e5             	mov    %rsp,%rbp
+  805a1d:	41 57                	push   %r15
+  805a1f:	53                   	push   %rbx
+  805a20:	48 83 ec 20          	sub    $0x20,%rsp
+  805a24:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a24 <socket+0xb>
+  805a2b:	49 bb 1c 36 00 00 00 	movabs $0x361c,%r11
+  805a32:	00 00 00 
+  805a35:	4c 01 db             	add    %r11,%rbx
+  805a38:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805a3b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805a3e:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805a41:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805a44:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805a47:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a4a:	89 ce                	mov    %ecx,%esi
+  805a4c:	89 c7                	mov    %eax,%edi
+  805a4e:	49 89 df             	mov    %rbx,%r15
+  805a51:	48 b8 37 d1 ff ff ff 	movabs $0xffffffffffffd137,%rax
+  805a58:	ff ff ff 
+  805a5b:	48 01 d8             	add    %rbx,%rax
+  805a5e:	ff d0                	call   *%rax
+  805a60:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a63:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a67:	79 05                	jns    805a6e <socket+0x55>
+		return r;
+  805a69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a6c:	eb 15                	jmp    805a83 <socket+0x6a>
+	return alloc_sockfd(r);
+  805a6e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a71:	89 c7                	mov    %eax,%edi
+  805a73:	48 b8 21 c5 ff ff ff 	movabs $0xffffffffffffc521,%rax
+  805a7a:	ff ff ff 
+  805a7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a81:	ff d0                	call   *%rax
+}
+  805a83:	48 83 c4 20          	add    $0x20,%rsp
+  805a87:	5b                   	pop    %rbx
+  805a88:	41 5f                	pop    %r15
+  805a8a:	5d                   	pop    %rbp
+  805a8b:	c3                   	ret
+
+0000000000805a8c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805a8c:	55                   	push   %rbp
+  805a8d:	48 89 e5             	mov    %rsp,%rbp
+  805a90:	41 57                	push   %r15
+  805a92:	53                   	push   %rbx
+  805a93:	48 83 ec 10          	sub    $0x10,%rsp
+  805a97:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a97 <nsipc+0xb>
+  805a9e:	49 bb a9 35 00 00 00 	movabs $0x35a9,%r11
+  805aa5:	00 00 00 
+  805aa8:	4c 01 db             	add    %r11,%rbx
+  805aab:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805aae:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  805ab5:	00 00 00 
+  805ab8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805abb:	85 c0                	test   %eax,%eax
+  805abd:	75 24                	jne    805ae3 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805abf:	bf 02 00 00 00       	mov    $0x2,%edi
+  805ac4:	49 89 df             	mov    %rbx,%r15
+  805ac7:	48 b8 5d ad ff ff ff 	movabs $0xffffffffffffad5d,%rax
+  805ace:	ff ff ff 
+  805ad1:	48 01 d8             	add    %rbx,%rax
+  805ad4:	ff d0                	call   *%rax
+  805ad6:	48 ba c0 1f 01 00 00 	movabs $0x11fc0,%rdx
+  805add:	00 00 00 
+  805ae0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805ae3:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  805aea:	00 00 00 
+  805aed:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805af0:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805af3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805af9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805aff:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805b04:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805b0b:	00 00 00 
+  805b0e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805b12:	89 c7                	mov    %eax,%edi
+  805b14:	49 89 df             	mov    %rbx,%r15
+  805b17:	48 b8 7c a7 ff ff ff 	movabs $0xffffffffffffa77c,%rax
+  805b1e:	ff ff ff 
+  805b21:	48 01 d8             	add    %rbx,%rax
+  805b24:	ff d0                	call   *%rax
+}
+  805b26:	48 83 c4 10          	add    $0x10,%rsp
+  805b2a:	5b                   	pop    %rbx
+  805b2b:	41 5f                	pop    %r15
+  805b2d:	5d                   	pop    %rbp
+  805b2e:	c3                   	ret
+
+0000000000805b2f <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805b2f:	55                   	push   %rbp
+  805b30:	48 89 e5             	mov    %rsp,%rbp
+  805b33:	41 57                	push   %r15
+  805b35:	53                   	push   %rbx
+  805b36:	48 83 ec 20          	sub    $0x20,%rsp
+  805b3a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b3a <nsipc_words+0xb>
+  805b41:	49 bb 06 35 00 00 00 	movabs $0x3506,%r11
+  805b48:	00 00 00 
+  805b4b:	4c 01 db             	add    %r11,%rbx
+  805b4e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805b51:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805b55:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805b59:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  805b60:	00 00 00 
+  805b63:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b66:	85 c0                	test   %eax,%eax
+  805b68:	75 24                	jne    805b8e <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805b6a:	bf 02 00 00 00       	mov    $0x2,%edi
+  805b6f:	49 89 df             	mov    %rbx,%r15
+  805b72:	48 b8 5d ad ff ff ff 	movabs $0xffffffffffffad5d,%rax
+  805b79:	ff ff ff 
+  805b7c:	48 01 d8             	add    %rbx,%rax
+  805b7f:	ff d0                	call   *%rax
+  805b81:	48 ba c0 1f 01 00 00 	movabs $0x11fc0,%rdx
+  805b88:	00 00 00 
+  805b8b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805b8e:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  805b95:	00 00 00 
+  805b98:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b9b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805b9f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ba3:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805ba6:	89 c7                	mov    %eax,%edi
+  805ba8:	49 89 df             	mov    %rbx,%r15
+  805bab:	48 b8 67 a8 ff ff ff 	movabs $0xffffffffffffa867,%rax
+  805bb2:	ff ff ff 
+  805bb5:	48 01 d8             	add    %rbx,%rax
+  805bb8:	ff d0                	call   *%rax
+}
+  805bba:	48 83 c4 20          	add    $0x20,%rsp
+  805bbe:	5b                   	pop    %rbx
+  805bbf:	41 5f                	pop    %r15
+  805bc1:	5d                   	pop    %rbp
+  805bc2:	c3                   	ret
+
+0000000000805bc3 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805bc3:	55                   	push   %rbp
+  805bc4:	48 89 e5             	mov    %rsp,%rbp
+  805bc7:	41 57                	push   %r15
+  805bc9:	53                   	push   %rbx
+  805bca:	48 83 ec 30          	sub    $0x30,%rsp
+  805bce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bce <nsipc_accept+0xb>
+  805bd5:	49 bb 72 34 00 00 00 	movabs $0x3472,%r11
+  805bdc:	00 00 00 
+  805bdf:	4c 01 db             	add    %r11,%rbx
+  805be2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805be5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805be9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805bed:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805bf4:	00 00 00 
+  805bf7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bfa:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805bfd:	bf 01 00 00 00       	mov    $0x1,%edi
+  805c02:	48 b8 4c ca ff ff ff 	movabs $0xffffffffffffca4c,%rax
+  805c09:	ff ff ff 
+  805c0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c10:	ff d0                	call   *%rax
+  805c12:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c15:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c19:	78 48                	js     805c63 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805c1b:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  805c22:	00 00 00 
+  805c25:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c29:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805c2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c31:	8b 40 10             	mov    0x10(%rax),%eax
+  805c34:	89 c2                	mov    %eax,%edx
+  805c36:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805c3a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805c3e:	48 89 ce             	mov    %rcx,%rsi
+  805c41:	48 89 c7             	mov    %rax,%rdi
+  805c44:	49 89 df             	mov    %rbx,%r15
+  805c47:	48 b8 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rax
+  805c4e:	ff ff ff 
+  805c51:	48 01 d8             	add    %rbx,%rax
+  805c54:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805c56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c5a:	8b 50 10             	mov    0x10(%rax),%edx
+  805c5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c61:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805c63:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805c66:	48 83 c4 30          	add    $0x30,%rsp
+  805c6a:	5b                   	pop    %rbx
+  805c6b:	41 5f                	pop    %r15
+  805c6d:	5d                   	pop    %rbp
+  805c6e:	c3                   	ret
+
+0000000000805c6f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805c6f:	55                   	push   %rbp
+  805c70:	48 89 e5             	mov    %rsp,%rbp
+  805c73:	41 57                	push   %r15
+  805c75:	53                   	push   %rbx
+  805c76:	48 83 ec 10          	sub    $0x10,%rsp
+  805c7a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c7a <nsipc_bind+0xb>
+  805c81:	49 bb c6 33 00 00 00 	movabs $0x33c6,%r11
+  805c88:	00 00 00 
+  805c8b:	4c 01 db             	add    %r11,%rbx
+  805c8e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c91:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805c95:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805c98:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805c9f:	00 00 00 
+  805ca2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ca5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805ca8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805cab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805caf:	48 89 c6             	mov    %rax,%rsi
+  805cb2:	48 b8 c4 3f 01 00 00 	movabs $0x13fc4,%rax
+  805cb9:	00 00 00 
+  805cbc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cc0:	48 89 c7             	mov    %rax,%rdi
+  805cc3:	49 89 df             	mov    %rbx,%r15
+  805cc6:	48 b8 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rax
+  805ccd:	ff ff ff 
+  805cd0:	48 01 d8             	add    %rbx,%rax
+  805cd3:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805cd5:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805cdc:	00 00 00 
+  805cdf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805ce2:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805ce6:	bf 02 00 00 00       	mov    $0x2,%edi
+  805ceb:	48 b8 4c ca ff ff ff 	movabs $0xffffffffffffca4c,%rax
+  805cf2:	ff ff ff 
+  805cf5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805cf9:	ff d0                	call   *%rax
+}
+  805cfb:	48 83 c4 10          	add    $0x10,%rsp
+  805cff:	5b                   	pop    %rbx
+  805d00:	41 5f                	pop    %r15
+  805d02:	5d                   	pop    %rbp
+  805d03:	c3                   	ret
+
+0000000000805d04 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805d04:	55                   	push   %rbp
+  805d05:	48 89 e5             	mov    %rsp,%rbp
+  805d08:	48 83 ec 20          	sub    $0x20,%rsp
+  805d0c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d0c <nsipc_shutdown+0x8>
+  805d13:	49 bb 34 33 00 00 00 	movabs $0x3334,%r11
+  805d1a:	00 00 00 
+  805d1d:	4c 01 d8             	add    %r11,%rax
+  805d20:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805d23:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805d26:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805d29:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805d2c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d2f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805d32:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805d36:	ba 08 00 00 00       	mov    $0x8,%edx
+  805d3b:	48 89 ce             	mov    %rcx,%rsi
+  805d3e:	bf 03 00 00 00       	mov    $0x3,%edi
+  805d43:	48 b9 ef ca ff ff ff 	movabs $0xffffffffffffcaef,%rcx
+  805d4a:	ff ff ff 
+  805d4d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805d51:	ff d0                	call   *%rax
+}
+  805d53:	c9                   	leave
+  805d54:	c3                   	ret
+
+0000000000805d55 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805d55:	55                   	push   %rbp
+  805d56:	48 89 e5             	mov    %rsp,%rbp
+  805d59:	48 83 ec 20          	sub    $0x20,%rsp
+  805d5d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d5d <nsipc_close+0x8>
+  805d64:	49 bb e3 32 00 00 00 	movabs $0x32e3,%r11
+  805d6b:	00 00 00 
+  805d6e:	4c 01 d8             	add    %r11,%rax
+  805d71:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805d74:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805d77:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805d7a:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805d7e:	ba 04 00 00 00       	mov    $0x4,%edx
+  805d83:	48 89 ce             	mov    %rcx,%rsi
+  805d86:	bf 04 00 00 00       	mov    $0x4,%edi
+  805d8b:	48 b9 ef ca ff ff ff 	movabs $0xffffffffffffcaef,%rcx
+  805d92:	ff ff ff 
+  805d95:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805d99:	ff d0                	call   *%rax
+}
+  805d9b:	c9                   	leave
+  805d9c:	c3                   	ret
+
+0000000000805d9d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805d9d:	55                   	push   %rbp
+  805d9e:	48 89 e5             	mov    %rsp,%rbp
+  805da1:	41 57                	push   %r15
+  805da3:	53                   	push   %rbx
+  805da4:	48 83 ec 10          	sub    $0x10,%rsp
+  805da8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805da8 <nsipc_connect+0xb>
+  805daf:	49 bb 98 32 00 00 00 	movabs $0x3298,%r11
+  805db6:	00 00 00 
+  805db9:	4c 01 db             	add    %r11,%rbx
+  805dbc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805dbf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805dc3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805dc6:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805dcd:	00 00 00 
+  805dd0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805dd3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805dd6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805dd9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ddd:	48 89 c6             	mov    %rax,%rsi
+  805de0:	48 b8 c4 3f 01 00 00 	movabs $0x13fc4,%rax
+  805de7:	00 00 00 
+  805dea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dee:	48 89 c7             	mov    %rax,%rdi
+  805df1:	49 89 df             	mov    %rbx,%r15
+  805df4:	48 b8 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rax
+  805dfb:	ff ff ff 
+  805dfe:	48 01 d8             	add    %rbx,%rax
+  805e01:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805e03:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805e0a:	00 00 00 
+  805e0d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805e10:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805e14:	bf 05 00 00 00       	mov    $0x5,%edi
+  805e19:	48 b8 4c ca ff ff ff 	movabs $0xffffffffffffca4c,%rax
+  805e20:	ff ff ff 
+  805e23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e27:	ff d0                	call   *%rax
+}
+  805e29:	48 83 c4 10          	add    $0x10,%rsp
+  805e2d:	5b                   	pop    %rbx
+  805e2e:	41 5f                	pop    %r15
+  805e30:	5d                   	pop    %rbp
+  805e31:	c3                   	ret
+
+0000000000805e32 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805e32:	55                   	push   %rbp
+  805e33:	48 89 e5             	mov    %rsp,%rbp
+  805e36:	48 83 ec 20          	sub    $0x20,%rsp
+  805e3a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805e3a <nsipc_listen+0x8>
+  805e41:	49 bb 06 32 00 00 00 	movabs $0x3206,%r11
+  805e48:	00 00 00 
+  805e4b:	4c 01 d8             	add    %r11,%rax
+  805e4e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805e51:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805e54:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805e57:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805e5a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805e5d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805e60:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805e64:	ba 08 00 00 00       	mov    $0x8,%edx
+  805e69:	48 89 ce             	mov    %rcx,%rsi
+  805e6c:	bf 06 00 00 00       	mov    $0x6,%edi
+  805e71:	48 b9 ef ca ff ff ff 	movabs $0xffffffffffffcaef,%rcx
+  805e78:	ff ff ff 
+  805e7b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805e7f:	ff d0                	call   *%rax
+}
+  805e81:	c9                   	leave
+  805e82:	c3                   	ret
+
+0000000000805e83 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805e83:	55                   	push   %rbp
+  805e84:	48 89 e5             	mov    %rsp,%rbp
+  805e87:	41 57                	push   %r15
+  805e89:	53                   	push   %rbx
+  805e8a:	48 83 ec 30          	sub    $0x30,%rsp
+  805e8e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e8e <nsipc_recv+0xb>
+  805e95:	49 bb b2 31 00 00 00 	movabs $0x31b2,%r11
+  805e9c:	00 00 00 
+  805e9f:	4c 01 db             	add    %r11,%rbx
+  805ea2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805ea5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805ea9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805eac:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805eaf:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805eb6:	00 00 00 
+  805eb9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805ebc:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805ebf:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805ec6:	00 00 00 
+  805ec9:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805ecc:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805ed0:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805ed7:	00 00 00 
+  805eda:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805edd:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805ee1:	bf 07 00 00 00       	mov    $0x7,%edi
+  805ee6:	48 b8 4c ca ff ff ff 	movabs $0xffffffffffffca4c,%rax
+  805eed:	ff ff ff 
+  805ef0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ef4:	ff d0                	call   *%rax
+  805ef6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805ef9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805efd:	0f 88 91 00 00 00    	js     805f94 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805f03:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805f0a:	7f 08                	jg     805f14 <nsipc_recv+0x91>
+  805f0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f0f:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805f12:	7e 50                	jle    805f64 <nsipc_recv+0xe1>
+  805f14:	48 b8 4b e7 ff ff ff 	movabs $0xffffffffffffe74b,%rax
+  805f1b:	ff ff ff 
+  805f1e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f22:	48 89 c1             	mov    %rax,%rcx
+  805f25:	48 b8 60 e7 ff ff ff 	movabs $0xffffffffffffe760,%rax
+  805f2c:	ff ff ff 
+  805f2f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f33:	48 89 c2             	mov    %rax,%rdx
+  805f36:	be 79 00 00 00       	mov    $0x79,%esi
+  805f3b:	48 b8 75 e7 ff ff ff 	movabs $0xffffffffffffe775,%rax
+  805f42:	ff ff ff 
+  805f45:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f49:	48 89 c7             	mov    %rax,%rdi
+  805f4c:	49 89 df             	mov    %rbx,%r15
+  805f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f54:	49 b8 22 81 ff ff ff 	movabs $0xffffffffffff8122,%r8
+  805f5b:	ff ff ff 
+  805f5e:	49 01 d8             	add    %rbx,%r8
+  805f61:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805f64:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f67:	48 63 d0             	movslq %eax,%rdx
+  805f6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f6e:	48 b9 c0 3f 01 00 00 	movabs $0x13fc0,%rcx
+  805f75:	00 00 00 
+  805f78:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805f7c:	48 89 ce             	mov    %rcx,%rsi
+  805f7f:	48 89 c7             	mov    %rax,%rdi
+  805f82:	49 89 df             	mov    %rbx,%r15
+  805f85:	48 b8 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rax
+  805f8c:	ff ff ff 
+  805f8f:	48 01 d8             	add    %rbx,%rax
+  805f92:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805f94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805f97:	48 83 c4 30          	add    $0x30,%rsp
+  805f9b:	5b                   	pop    %rbx
+  805f9c:	41 5f                	pop    %r15
+  805f9e:	5d                   	pop    %rbp
+  805f9f:	c3                   	ret
+
+0000000000805fa0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805fa0:	55                   	push   %rbp
+  805fa1:	48 89 e5             	mov    %rsp,%rbp
+  805fa4:	41 57                	push   %r15
+  805fa6:	53                   	push   %rbx
+  805fa7:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805fae:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fae <nsipc_send+0xe>
+  805fb5:	49 bb 92 30 00 00 00 	movabs $0x3092,%r11
+  805fbc:	00 00 00 
+  805fbf:	4c 01 db             	add    %r11,%rbx
+  805fc2:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805fc8:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805fcf:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805fd5:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805fdb:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805fdf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805fe3:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  805fea:	00 00 00 
+  805fed:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805ff0:	85 c0                	test   %eax,%eax
+  805ff2:	75 24                	jne    806018 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805ff4:	bf 02 00 00 00       	mov    $0x2,%edi
+  805ff9:	49 89 df             	mov    %rbx,%r15
+  805ffc:	48 b8 5d ad ff ff ff 	movabs $0xffffffffffffad5d,%rax
+  806003:	ff ff ff 
+  806006:	48 01 d8             	add    %rbx,%rax
+  806009:	ff d0                	call   *%rax
+  80600b:	48 ba c0 1f 01 00 00 	movabs $0x11fc0,%rdx
+  806012:	00 00 00 
+  806015:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  806018:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80601e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  806021:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  806028:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80602b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80602e:	39 c2                	cmp    %eax,%edx
+  806030:	0f 4e c2             	cmovle %edx,%eax
+  806033:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  806039:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  80603f:	48 63 d0             	movslq %eax,%rdx
+  806042:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  806049:	48 89 c6             	mov    %rax,%rsi
+  80604c:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  806053:	00 00 00 
+  806056:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80605a:	48 89 c7             	mov    %rax,%rdi
+  80605d:	49 89 df             	mov    %rbx,%r15
+  806060:	48 b8 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rax
+  806067:	ff ff ff 
+  80606a:	48 01 d8             	add    %rbx,%rax
+  80606d:	ff d0                	call   *%rax
+	req->req_s = s;
+  80606f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806073:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  806079:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80607b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80607f:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  806085:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  806088:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80608c:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  806092:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  806095:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80609c:	00 00 00 
+  80609f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060a3:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  8060a7:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8060ae:	00 
+  8060af:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8060b5:	48 63 d0             	movslq %eax,%rdx
+  8060b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060bc:	48 01 d0             	add    %rdx,%rax
+  8060bf:	48 83 e8 01          	sub    $0x1,%rax
+  8060c3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8060c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8060d0:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8060d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8060d8:	48 29 d0             	sub    %rdx,%rax
+  8060db:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8060e1:	85 c0                	test   %eax,%eax
+  8060e3:	0f 48 c2             	cmovs  %edx,%eax
+  8060e6:	c1 f8 0c             	sar    $0xc,%eax
+  8060e9:	48 98                	cltq
+  8060eb:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8060ef:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8060f3:	48 85 c0             	test   %rax,%rax
+  8060f6:	0f 95 c0             	setne  %al
+  8060f9:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8060fc:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  806103:	00 
+  806104:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806108:	48 83 c0 0b          	add    $0xb,%rax
+  80610c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806110:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806114:	ba 00 00 00 00       	mov    $0x0,%edx
+  806119:	48 f7 75 c8          	divq   -0x38(%rbp)
+  80611d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806121:	48 29 d0             	sub    %rdx,%rax
+  806124:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806128:	89 c7                	mov    %eax,%edi
+  80612a:	48 b8 c0 1f 01 00 00 	movabs $0x11fc0,%rax
+  806131:	00 00 00 
+  806134:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806137:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80613b:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  80613f:	48 83 ec 08          	sub    $0x8,%rsp
+  806143:	6a 00                	push   $0x0
+  806145:	6a 00                	push   $0x0
+  806147:	6a 05                	push   $0x5
+  806149:	41 89 f1             	mov    %esi,%r9d
+  80614c:	49 89 c8             	mov    %rcx,%r8
+  80614f:	89 f9                	mov    %edi,%ecx
+  806151:	be 08 00 00 00       	mov    $0x8,%esi
+  806156:	89 c7                	mov    %eax,%edi
+  806158:	49 89 df             	mov    %rbx,%r15
+  80615b:	48 b8 65 a9 ff ff ff 	movabs $0xffffffffffffa965,%rax
+  806162:	ff ff ff 
+  806165:	48 01 d8             	add    %rbx,%rax
+  806168:	ff d0                	call   *%rax
+  80616a:	48 83 c4 20          	add    $0x20,%rsp
+}
+  80616e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  806172:	5b                   	pop    %rbx
+  806173:	41 5f                	pop    %r15
+  806175:	5d                   	pop    %rbp
+  806176:	c3                   	ret
+
+0000000000806177 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  806177:	55                   	push   %rbp
+  806178:	48 89 e5             	mov    %rsp,%rbp
+  80617b:	48 83 ec 10          	sub    $0x10,%rsp
+  80617f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80617f <nsipc_socket+0x8>
+  806186:	49 bb c1 2e 00 00 00 	movabs $0x2ec1,%r11
+  80618d:	00 00 00 
+  806190:	4c 01 d8             	add    %r11,%rax
+  806193:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806196:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  806199:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  80619c:	48 b9 c0 3f 01 00 00 	movabs $0x13fc0,%rcx
+  8061a3:	00 00 00 
+  8061a6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8061a9:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8061ac:	48 b9 c0 3f 01 00 00 	movabs $0x13fc0,%rcx
+  8061b3:	00 00 00 
+  8061b6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8061b9:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8061bd:	48 b9 c0 3f 01 00 00 	movabs $0x13fc0,%rcx
+  8061c4:	00 00 00 
+  8061c7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8061ca:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8061ce:	bf 09 00 00 00       	mov    $0x9,%edi
+  8061d3:	48 ba 4c ca ff ff ff 	movabs $0xffffffffffffca4c,%rdx
+  8061da:	ff ff ff 
+  8061dd:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8061e1:	ff d0                	call   *%rax
+}
+  8061e3:	c9                   	leave
+  8061e4:	c3                   	ret
+
+00000000008061e5 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8061e5:	55                   	push   %rbp
+  8061e6:	48 89 e5             	mov    %rsp,%rbp
+  8061e9:	41 57                	push   %r15
+  8061eb:	53                   	push   %rbx
+  8061ec:	48 83 ec 30          	sub    $0x30,%rsp
+  8061f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061f0 <pipe+0xb>
+  8061f7:	49 bb 50 2e 00 00 00 	movabs $0x2e50,%r11
+  8061fe:	00 00 00 
+  806201:	4c 01 db             	add    %r11,%rbx
+  806204:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  806208:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  80620c:	48 89 c7             	mov    %rax,%rdi
+  80620f:	49 89 df             	mov    %rbx,%r15
+  806212:	48 b8 66 ae ff ff ff 	movabs $0xffffffffffffae66,%rax
+  806219:	ff ff ff 
+  80621c:	48 01 d8             	add    %rbx,%rax
+  80621f:	ff d0                	call   *%rax
+  806221:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806224:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806228:	0f 88 12 02 00 00    	js     806440 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80622e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806232:	ba 07 04 00 00       	mov    $0x407,%edx
+  806237:	48 89 c6             	mov    %rax,%rsi
+  80623a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80623f:	49 89 df             	mov    %rbx,%r15
+  806242:	48 b8 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%rax
+  806249:	ff ff ff 
+  80624c:	48 01 d8             	add    %rbx,%rax
+  80624f:	ff d0                	call   *%rax
+  806251:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806254:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806258:	0f 88 e2 01 00 00    	js     806440 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  80625e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  806262:	48 89 c7             	mov    %rax,%rdi
+  806265:	49 89 df             	mov    %rbx,%r15
+  806268:	48 b8 66 ae ff ff ff 	movabs $0xffffffffffffae66,%rax
+  80626f:	ff ff ff 
+  806272:	48 01 d8             	add    %rbx,%rax
+  806275:	ff d0                	call   *%rax
+  806277:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80627a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80627e:	0f 88 9b 01 00 00    	js     80641f <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806284:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806288:	ba 07 04 00 00       	mov    $0x407,%edx
+  80628d:	48 89 c6             	mov    %rax,%rsi
+  806290:	bf 00 00 00 00       	mov    $0x0,%edi
+  806295:	49 89 df             	mov    %rbx,%r15
+  806298:	48 b8 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%rax
+  80629f:	ff ff ff 
+  8062a2:	48 01 d8             	add    %rbx,%rax
+  8062a5:	ff d0                	call   *%rax
+  8062a7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062aa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062ae:	0f 88 6b 01 00 00    	js     80641f <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8062b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062b8:	48 89 c7             	mov    %rax,%rdi
+  8062bb:	49 89 df             	mov    %rbx,%r15
+  8062be:	48 b8 23 ae ff ff ff 	movabs $0xffffffffffffae23,%rax
+  8062c5:	ff ff ff 
+  8062c8:	48 01 d8             	add    %rbx,%rax
+  8062cb:	ff d0                	call   *%rax
+  8062cd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8062d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062d5:	ba 07 04 00 00       	mov    $0x407,%edx
+  8062da:	48 89 c6             	mov    %rax,%rsi
+  8062dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8062e2:	49 89 df             	mov    %rbx,%r15
+  8062e5:	48 b8 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%rax
+  8062ec:	ff ff ff 
+  8062ef:	48 01 d8             	add    %rbx,%rax
+  8062f2:	ff d0                	call   *%rax
+  8062f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062fb:	0f 88 fd 00 00 00    	js     8063fe <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806301:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806305:	48 89 c7             	mov    %rax,%rdi
+  806308:	49 89 df             	mov    %rbx,%r15
+  80630b:	48 b8 23 ae ff ff ff 	movabs $0xffffffffffffae23,%rax
+  806312:	ff ff ff 
+  806315:	48 01 d8             	add    %rbx,%rax
+  806318:	ff d0                	call   *%rax
+  80631a:	48 89 c2             	mov    %rax,%rdx
+  80631d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806321:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  806327:	48 89 d1             	mov    %rdx,%rcx
+  80632a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80632f:	48 89 c6             	mov    %rax,%rsi
+  806332:	bf 00 00 00 00       	mov    $0x0,%edi
+  806337:	49 89 df             	mov    %rbx,%r15
+  80633a:	48 b8 dc 9e ff ff ff 	movabs $0xffffffffffff9edc,%rax
+  806341:	ff ff ff 
+  806344:	48 01 d8             	add    %rbx,%rax
+  806347:	ff d0                	call   *%rax
+  806349:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80634c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806350:	0f 88 87 00 00 00    	js     8063dd <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  806356:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80635a:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806361:	00 00 00 
+  806364:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806367:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  806369:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80636d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  806374:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806378:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  80637f:	00 00 00 
+  806382:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806385:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  806387:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80638b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  806392:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806396:	48 89 c7             	mov    %rax,%rdi
+  806399:	49 89 df             	mov    %rbx,%r15
+  80639c:	48 b8 ec ad ff ff ff 	movabs $0xffffffffffffadec,%rax
+  8063a3:	ff ff ff 
+  8063a6:	48 01 d8             	add    %rbx,%rax
+  8063a9:	ff d0                	call   *%rax
+  8063ab:	89 c2                	mov    %eax,%edx
+  8063ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063b1:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8063b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063b7:	48 89 c7             	mov    %rax,%rdi
+  8063ba:	49 89 df             	mov    %rbx,%r15
+  8063bd:	48 b8 ec ad ff ff ff 	movabs $0xffffffffffffadec,%rax
+  8063c4:	ff ff ff 
+  8063c7:	48 01 d8             	add    %rbx,%rax
+  8063ca:	ff d0                	call   *%rax
+  8063cc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8063d0:	48 83 c2 04          	add    $0x4,%rdx
+  8063d4:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  8063d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063db:	eb 67                	jmp    806444 <pipe+0x25f>
+		goto err3;
+  8063dd:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  8063de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063e2:	48 89 c6             	mov    %rax,%rsi
+  8063e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8063ea:	49 89 df             	mov    %rbx,%r15
+  8063ed:	48 b8 4f 9f ff ff ff 	movabs $0xffffffffffff9f4f,%rax
+  8063f4:	ff ff ff 
+  8063f7:	48 01 d8             	add    %rbx,%rax
+  8063fa:	ff d0                	call   *%rax
+  8063fc:	eb 01                	jmp    8063ff <pipe+0x21a>
+		goto err2;
+  8063fe:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  8063ff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806403:	48 89 c6             	mov    %rax,%rsi
+  806406:	bf 00 00 00 00       	mov    $0x0,%edi
+  80640b:	49 89 df             	mov    %rbx,%r15
+  80640e:	48 b8 4f 9f ff ff ff 	movabs $0xffffffffffff9f4f,%rax
+  806415:	ff ff ff 
+  806418:	48 01 d8             	add    %rbx,%rax
+  80641b:	ff d0                	call   *%rax
+  80641d:	eb 01                	jmp    806420 <pipe+0x23b>
+		goto err1;
+  80641f:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806420:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806424:	48 89 c6             	mov    %rax,%rsi
+  806427:	bf 00 00 00 00       	mov    $0x0,%edi
+  80642c:	49 89 df             	mov    %rbx,%r15
+  80642f:	48 b8 4f 9f ff ff ff 	movabs $0xffffffffffff9f4f,%rax
+  806436:	ff ff ff 
+  806439:	48 01 d8             	add    %rbx,%rax
+  80643c:	ff d0                	call   *%rax
+  80643e:	eb 01                	jmp    806441 <pipe+0x25c>
+		goto err;
+  806440:	90                   	nop
+err:
+	return r;
+  806441:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806444:	48 83 c4 30          	add    $0x30,%rsp
+  806448:	5b                   	pop    %rbx
+  806449:	41 5f                	pop    %r15
+  80644b:	5d                   	pop    %rbp
+  80644c:	c3                   	ret
+
+000000000080644d <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80644d:	55                   	push   %rbp
+  80644e:	48 89 e5             	mov    %rsp,%rbp
+  806451:	41 57                	push   %r15
+  806453:	41 54                	push   %r12
+  806455:	53                   	push   %rbx
+  806456:	48 83 ec 28          	sub    $0x28,%rsp
+  80645a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80645a <_pipeisclosed+0xd>
+  806461:	49 bb e6 2b 00 00 00 	movabs $0x2be6,%r11
+  806468:	00 00 00 
+  80646b:	4c 01 db             	add    %r11,%rbx
+  80646e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806472:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  806476:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  80647d:	ff ff ff 
+  806480:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806484:	48 8b 00             	mov    (%rax),%rax
+  806487:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80648d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  806490:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806494:	48 89 c7             	mov    %rax,%rdi
+  806497:	49 89 df             	mov    %rbx,%r15
+  80649a:	48 b8 f5 dc ff ff ff 	movabs $0xffffffffffffdcf5,%rax
+  8064a1:	ff ff ff 
+  8064a4:	48 01 d8             	add    %rbx,%rax
+  8064a7:	ff d0                	call   *%rax
+  8064a9:	41 89 c4             	mov    %eax,%r12d
+  8064ac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8064b0:	48 89 c7             	mov    %rax,%rdi
+  8064b3:	49 89 df             	mov    %rbx,%r15
+  8064b6:	48 b8 f5 dc ff ff ff 	movabs $0xffffffffffffdcf5,%rax
+  8064bd:	ff ff ff 
+  8064c0:	48 01 d8             	add    %rbx,%rax
+  8064c3:	ff d0                	call   *%rax
+  8064c5:	41 39 c4             	cmp    %eax,%r12d
+  8064c8:	0f 94 c0             	sete   %al
+  8064cb:	0f b6 c0             	movzbl %al,%eax
+  8064ce:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  8064d1:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  8064d8:	ff ff ff 
+  8064db:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064df:	48 8b 00             	mov    (%rax),%rax
+  8064e2:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8064e8:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  8064eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8064ee:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8064f1:	75 05                	jne    8064f8 <_pipeisclosed+0xab>
+			return ret;
+  8064f3:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8064f6:	eb 63                	jmp    80655b <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  8064f8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8064fb:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  8064fe:	0f 84 72 ff ff ff    	je     806476 <_pipeisclosed+0x29>
+  806504:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  806508:	0f 85 68 ff ff ff    	jne    806476 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80650e:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  806515:	ff ff ff 
+  806518:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80651c:	48 8b 00             	mov    (%rax),%rax
+  80651f:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806525:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  806528:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80652b:	89 c6                	mov    %eax,%esi
+  80652d:	48 b8 86 e7 ff ff ff 	movabs $0xffffffffffffe786,%rax
+  806534:	ff ff ff 
+  806537:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80653b:	48 89 c7             	mov    %rax,%rdi
+  80653e:	49 89 df             	mov    %rbx,%r15
+  806541:	b8 00 00 00 00       	mov    $0x0,%eax
+  806546:	49 b8 f9 83 ff ff ff 	movabs $0xffffffffffff83f9,%r8
+  80654d:	ff ff ff 
+  806550:	49 01 d8             	add    %rbx,%r8
+  806553:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  806556:	e9 1b ff ff ff       	jmp    806476 <_pipeisclosed+0x29>
+	}
+}
+  80655b:	48 83 c4 28          	add    $0x28,%rsp
+  80655f:	5b                   	pop    %rbx
+  806560:	41 5c                	pop    %r12
+  806562:	41 5f                	pop    %r15
+  806564:	5d                   	pop    %rbp
+  806565:	c3                   	ret
+
+0000000000806566 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  806566:	55                   	push   %rbp
+  806567:	48 89 e5             	mov    %rsp,%rbp
+  80656a:	41 57                	push   %r15
+  80656c:	53                   	push   %rbx
+  80656d:	48 83 ec 30          	sub    $0x30,%rsp
+  806571:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806571 <pipeisclosed+0xb>
+  806578:	49 bb cf 2a 00 00 00 	movabs $0x2acf,%r11
+  80657f:	00 00 00 
+  806582:	4c 01 db             	add    %r11,%rbx
+  806585:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806588:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80658c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80658f:	48 89 d6             	mov    %rdx,%rsi
+  806592:	89 c7                	mov    %eax,%edi
+  806594:	49 89 df             	mov    %rbx,%r15
+  806597:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  80659e:	ff ff ff 
+  8065a1:	48 01 d8             	add    %rbx,%rax
+  8065a4:	ff d0                	call   *%rax
+  8065a6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8065a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8065ad:	79 05                	jns    8065b4 <pipeisclosed+0x4e>
+		return r;
+  8065af:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065b2:	eb 3b                	jmp    8065ef <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8065b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065b8:	48 89 c7             	mov    %rax,%rdi
+  8065bb:	49 89 df             	mov    %rbx,%r15
+  8065be:	48 b8 23 ae ff ff ff 	movabs $0xffffffffffffae23,%rax
+  8065c5:	ff ff ff 
+  8065c8:	48 01 d8             	add    %rbx,%rax
+  8065cb:	ff d0                	call   *%rax
+  8065cd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  8065d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8065d9:	48 89 d6             	mov    %rdx,%rsi
+  8065dc:	48 89 c7             	mov    %rax,%rdi
+  8065df:	48 b8 0d d4 ff ff ff 	movabs $0xffffffffffffd40d,%rax
+  8065e6:	ff ff ff 
+  8065e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8065ed:	ff d0                	call   *%rax
+}
+  8065ef:	48 83 c4 30          	add    $0x30,%rsp
+  8065f3:	5b                   	pop    %rbx
+  8065f4:	41 5f                	pop    %r15
+  8065f6:	5d                   	pop    %rbp
+  8065f7:	c3                   	ret
+
+00000000008065f8 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8065f8:	55                   	push   %rbp
+  8065f9:	48 89 e5             	mov    %rsp,%rbp
+  8065fc:	41 57                	push   %r15
+  8065fe:	53                   	push   %rbx
+  8065ff:	48 83 ec 40          	sub    $0x40,%rsp
+  806603:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806603 <devpipe_read+0xb>
+  80660a:	49 bb 3d 2a 00 00 00 	movabs $0x2a3d,%r11
+  806611:	00 00 00 
+  806614:	4c 01 db             	add    %r11,%rbx
+  806617:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80661b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80661f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806623:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806627:	48 89 c7             	mov    %rax,%rdi
+  80662a:	49 89 df             	mov    %rbx,%r15
+  80662d:	48 b8 23 ae ff ff ff 	movabs $0xffffffffffffae23,%rax
+  806634:	ff ff ff 
+  806637:	48 01 d8             	add    %rbx,%rax
+  80663a:	ff d0                	call   *%rax
+  80663c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806640:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806644:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806648:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80664f:	00 
+  806650:	e9 a1 00 00 00       	jmp    8066f6 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  806655:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80665a:	74 09                	je     806665 <devpipe_read+0x6d>
+				return i;
+  80665c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806660:	e9 9f 00 00 00       	jmp    806704 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  806665:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806669:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80666d:	48 89 d6             	mov    %rdx,%rsi
+  806670:	48 89 c7             	mov    %rax,%rdi
+  806673:	48 b8 0d d4 ff ff ff 	movabs $0xffffffffffffd40d,%rax
+  80667a:	ff ff ff 
+  80667d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806681:	ff d0                	call   *%rax
+  806683:	85 c0                	test   %eax,%eax
+  806685:	74 07                	je     80668e <devpipe_read+0x96>
+				return 0;
+  806687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80668c:	eb 76                	jmp    806704 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  80668e:	49 89 df             	mov    %rbx,%r15
+  806691:	48 b8 22 9e ff ff ff 	movabs $0xffffffffffff9e22,%rax
+  806698:	ff ff ff 
+  80669b:	48 01 d8             	add    %rbx,%rax
+  80669e:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8066a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066a4:	8b 10                	mov    (%rax),%edx
+  8066a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066aa:	8b 40 04             	mov    0x4(%rax),%eax
+  8066ad:	39 c2                	cmp    %eax,%edx
+  8066af:	74 a4                	je     806655 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8066b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066b5:	8b 10                	mov    (%rax),%edx
+  8066b7:	89 d0                	mov    %edx,%eax
+  8066b9:	c1 f8 1f             	sar    $0x1f,%eax
+  8066bc:	c1 e8 1b             	shr    $0x1b,%eax
+  8066bf:	01 c2                	add    %eax,%edx
+  8066c1:	83 e2 1f             	and    $0x1f,%edx
+  8066c4:	29 c2                	sub    %eax,%edx
+  8066c6:	89 d6                	mov    %edx,%esi
+  8066c8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8066cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066d0:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8066d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8066d8:	48 63 c6             	movslq %esi,%rax
+  8066db:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  8066e0:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  8066e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066e6:	8b 00                	mov    (%rax),%eax
+  8066e8:	8d 50 01             	lea    0x1(%rax),%edx
+  8066eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066ef:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  8066f1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8066f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066fa:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8066fe:	72 a0                	jb     8066a0 <devpipe_read+0xa8>
+	}
+	return i;
+  806700:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806704:	48 83 c4 40          	add    $0x40,%rsp
+  806708:	5b                   	pop    %rbx
+  806709:	41 5f                	pop    %r15
+  80670b:	5d                   	pop    %rbp
+  80670c:	c3                   	ret
+
+000000000080670d <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80670d:	55                   	push   %rbp
+  80670e:	48 89 e5             	mov    %rsp,%rbp
+  806711:	41 57                	push   %r15
+  806713:	53                   	push   %rbx
+  806714:	48 83 ec 40          	sub    $0x40,%rsp
+  806718:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806718 <devpipe_write+0xb>
+  80671f:	49 bb 28 29 00 00 00 	movabs $0x2928,%r11
+  806726:	00 00 00 
+  806729:	4c 01 db             	add    %r11,%rbx
+  80672c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806730:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806734:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  806738:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80673c:	48 89 c7             	mov    %rax,%rdi
+  80673f:	49 89 df             	mov    %rbx,%r15
+  806742:	48 b8 23 ae ff ff ff 	movabs $0xffffffffffffae23,%rax
+  806749:	ff ff ff 
+  80674c:	48 01 d8             	add    %rbx,%rax
+  80674f:	ff d0                	call   *%rax
+  806751:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806755:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806759:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80675d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806764:	00 
+  806765:	e9 a0 00 00 00       	jmp    80680a <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80676a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80676e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806772:	48 89 d6             	mov    %rdx,%rsi
+  806775:	48 89 c7             	mov    %rax,%rdi
+  806778:	48 b8 0d d4 ff ff ff 	movabs $0xffffffffffffd40d,%rax
+  80677f:	ff ff ff 
+  806782:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806786:	ff d0                	call   *%rax
+  806788:	85 c0                	test   %eax,%eax
+  80678a:	74 0a                	je     806796 <devpipe_write+0x89>
+				return 0;
+  80678c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806791:	e9 82 00 00 00       	jmp    806818 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  806796:	49 89 df             	mov    %rbx,%r15
+  806799:	48 b8 22 9e ff ff ff 	movabs $0xffffffffffff9e22,%rax
+  8067a0:	ff ff ff 
+  8067a3:	48 01 d8             	add    %rbx,%rax
+  8067a6:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8067a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067ac:	8b 40 04             	mov    0x4(%rax),%eax
+  8067af:	48 63 d0             	movslq %eax,%rdx
+  8067b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067b6:	8b 00                	mov    (%rax),%eax
+  8067b8:	48 98                	cltq
+  8067ba:	48 83 c0 20          	add    $0x20,%rax
+  8067be:	48 39 c2             	cmp    %rax,%rdx
+  8067c1:	73 a7                	jae    80676a <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8067c3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8067c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8067cb:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8067cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067d3:	8b 50 04             	mov    0x4(%rax),%edx
+  8067d6:	89 d0                	mov    %edx,%eax
+  8067d8:	c1 f8 1f             	sar    $0x1f,%eax
+  8067db:	c1 e8 1b             	shr    $0x1b,%eax
+  8067de:	01 c2                	add    %eax,%edx
+  8067e0:	83 e2 1f             	and    $0x1f,%edx
+  8067e3:	29 c2                	sub    %eax,%edx
+  8067e5:	89 d0                	mov    %edx,%eax
+  8067e7:	0f b6 09             	movzbl (%rcx),%ecx
+  8067ea:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8067ee:	48 98                	cltq
+  8067f0:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  8067f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067f8:	8b 40 04             	mov    0x4(%rax),%eax
+  8067fb:	8d 50 01             	lea    0x1(%rax),%edx
+  8067fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806802:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806805:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80680a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80680e:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806812:	72 94                	jb     8067a8 <devpipe_write+0x9b>
+	}
+
+	return i;
+  806814:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806818:	48 83 c4 40          	add    $0x40,%rsp
+  80681c:	5b                   	pop    %rbx
+  80681d:	41 5f                	pop    %r15
+  80681f:	5d                   	pop    %rbp
+  806820:	c3                   	ret
+
+0000000000806821 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806821:	55                   	push   %rbp
+  806822:	48 89 e5             	mov    %rsp,%rbp
+  806825:	41 57                	push   %r15
+  806827:	53                   	push   %rbx
+  806828:	48 83 ec 20          	sub    $0x20,%rsp
+  80682c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80682c <devpipe_stat+0xb>
+  806833:	49 bb 14 28 00 00 00 	movabs $0x2814,%r11
+  80683a:	00 00 00 
+  80683d:	4c 01 db             	add    %r11,%rbx
+  806840:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806844:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  806848:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80684c:	48 89 c7             	mov    %rax,%rdi
+  80684f:	49 89 df             	mov    %rbx,%r15
+  806852:	48 b8 23 ae ff ff ff 	movabs $0xffffffffffffae23,%rax
+  806859:	ff ff ff 
+  80685c:	48 01 d8             	add    %rbx,%rax
+  80685f:	ff d0                	call   *%rax
+  806861:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  806865:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806869:	48 ba 99 e7 ff ff ff 	movabs $0xffffffffffffe799,%rdx
+  806870:	ff ff ff 
+  806873:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806877:	48 89 d6             	mov    %rdx,%rsi
+  80687a:	48 89 c7             	mov    %rax,%rdi
+  80687d:	49 89 df             	mov    %rbx,%r15
+  806880:	48 b8 bb 91 ff ff ff 	movabs $0xffffffffffff91bb,%rax
+  806887:	ff ff ff 
+  80688a:	48 01 d8             	add    %rbx,%rax
+  80688d:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80688f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806893:	8b 50 04             	mov    0x4(%rax),%edx
+  806896:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80689a:	8b 00                	mov    (%rax),%eax
+  80689c:	29 c2                	sub    %eax,%edx
+  80689e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068a2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8068a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068ac:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8068b3:	00 00 00 
+	stat->st_dev = &devpipe;
+  8068b6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8068ba:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8068c1:	00 00 00 
+  8068c4:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8068c8:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  8068cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8068d4:	48 83 c4 20          	add    $0x20,%rsp
+  8068d8:	5b                   	pop    %rbx
+  8068d9:	41 5f                	pop    %r15
+  8068db:	5d                   	pop    %rbp
+  8068dc:	c3                   	ret
+
+00000000008068dd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8068dd:	55                   	push   %rbp
+  8068de:	48 89 e5             	mov    %rsp,%rbp
+  8068e1:	41 57                	push   %r15
+  8068e3:	53                   	push   %rbx
+  8068e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8068e8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068e8 <devpipe_close+0xb>
+  8068ef:	49 bb 58 27 00 00 00 	movabs $0x2758,%r11
+  8068f6:	00 00 00 
+  8068f9:	4c 01 db             	add    %r11,%rbx
+  8068fc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806900:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806904:	48 89 c6             	mov    %rax,%rsi
+  806907:	bf 00 00 00 00       	mov    $0x0,%edi
+  80690c:	49 89 df             	mov    %rbx,%r15
+  80690f:	48 b8 4f 9f ff ff ff 	movabs $0xffffffffffff9f4f,%rax
+  806916:	ff ff ff 
+  806919:	48 01 d8             	add    %rbx,%rax
+  80691c:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80691e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806922:	48 89 c7             	mov    %rax,%rdi
+  806925:	49 89 df             	mov    %rbx,%r15
+  806928:	48 b8 23 ae ff ff ff 	movabs $0xffffffffffffae23,%rax
+  80692f:	ff ff ff 
+  806932:	48 01 d8             	add    %rbx,%rax
+  806935:	ff d0                	call   *%rax
+  806937:	48 89 c6             	mov    %rax,%rsi
+  80693a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80693f:	49 89 df             	mov    %rbx,%r15
+  806942:	48 b8 4f 9f ff ff ff 	movabs $0xffffffffffff9f4f,%rax
+  806949:	ff ff ff 
+  80694c:	48 01 d8             	add    %rbx,%rax
+  80694f:	ff d0                	call   *%rax
+}
+  806951:	48 83 c4 10          	add    $0x10,%rsp
+  806955:	5b                   	pop    %rbx
+  806956:	41 5f                	pop    %r15
+  806958:	5d                   	pop    %rbp
+  806959:	c3                   	ret
+
+000000000080695a <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80695a:	55                   	push   %rbp
+  80695b:	48 89 e5             	mov    %rsp,%rbp
+  80695e:	41 57                	push   %r15
+  806960:	48 83 ec 28          	sub    $0x28,%rsp
+  806964:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806964 <cputchar+0xa>
+  80696b:	49 bb dc 26 00 00 00 	movabs $0x26dc,%r11
+  806972:	00 00 00 
+  806975:	4c 01 d8             	add    %r11,%rax
+  806978:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80697b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80697e:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806981:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806985:	be 01 00 00 00       	mov    $0x1,%esi
+  80698a:	48 89 d7             	mov    %rdx,%rdi
+  80698d:	49 89 c7             	mov    %rax,%r15
+  806990:	48 ba bf 9c ff ff ff 	movabs $0xffffffffffff9cbf,%rdx
+  806997:	ff ff ff 
+  80699a:	48 01 c2             	add    %rax,%rdx
+  80699d:	ff d2                	call   *%rdx
+}
+  80699f:	90                   	nop
+  8069a0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8069a4:	c9                   	leave
+  8069a5:	c3                   	ret
+
+00000000008069a6 <getchar>:
+
+int
+getchar(void)
+{
+  8069a6:	55                   	push   %rbp
+  8069a7:	48 89 e5             	mov    %rsp,%rbp
+  8069aa:	41 57                	push   %r15
+  8069ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8069b0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8069b0 <getchar+0xa>
+  8069b7:	49 bb 90 26 00 00 00 	movabs $0x2690,%r11
+  8069be:	00 00 00 
+  8069c1:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  8069c4:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  8069c8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8069cd:	48 89 ce             	mov    %rcx,%rsi
+  8069d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8069d5:	49 89 c7             	mov    %rax,%r15
+  8069d8:	48 b9 63 b4 ff ff ff 	movabs $0xffffffffffffb463,%rcx
+  8069df:	ff ff ff 
+  8069e2:	48 01 c1             	add    %rax,%rcx
+  8069e5:	ff d1                	call   *%rcx
+  8069e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8069ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8069ee:	79 05                	jns    8069f5 <getchar+0x4f>
+		return r;
+  8069f0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069f3:	eb 14                	jmp    806a09 <getchar+0x63>
+	if (r < 1)
+  8069f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8069f9:	7f 07                	jg     806a02 <getchar+0x5c>
+		return -E_EOF;
+  8069fb:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806a00:	eb 07                	jmp    806a09 <getchar+0x63>
+	return c;
+  806a02:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806a06:	0f b6 c0             	movzbl %al,%eax
+}
+  806a09:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806a0d:	c9                   	leave
+  806a0e:	c3                   	ret
+
+0000000000806a0f <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  806a0f:	55                   	push   %rbp
+  806a10:	48 89 e5             	mov    %rsp,%rbp
+  806a13:	41 57                	push   %r15
+  806a15:	53                   	push   %rbx
+  806a16:	48 83 ec 20          	sub    $0x20,%rsp
+  806a1a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a1a <iscons+0xb>
+  806a21:	49 bb 26 26 00 00 00 	movabs $0x2626,%r11
+  806a28:	00 00 00 
+  806a2b:	4c 01 db             	add    %r11,%rbx
+  806a2e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806a31:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806a35:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a38:	48 89 d6             	mov    %rdx,%rsi
+  806a3b:	89 c7                	mov    %eax,%edi
+  806a3d:	49 89 df             	mov    %rbx,%r15
+  806a40:	48 b8 1c af ff ff ff 	movabs $0xffffffffffffaf1c,%rax
+  806a47:	ff ff ff 
+  806a4a:	48 01 d8             	add    %rbx,%rax
+  806a4d:	ff d0                	call   *%rax
+  806a4f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806a52:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a56:	79 05                	jns    806a5d <iscons+0x4e>
+		return r;
+  806a58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a5b:	eb 1b                	jmp    806a78 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  806a5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a61:	8b 10                	mov    (%rax),%edx
+  806a63:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  806a6a:	00 00 00 
+  806a6d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806a70:	39 c2                	cmp    %eax,%edx
+  806a72:	0f 94 c0             	sete   %al
+  806a75:	0f b6 c0             	movzbl %al,%eax
+}
+  806a78:	48 83 c4 20          	add    $0x20,%rsp
+  806a7c:	5b                   	pop    %rbx
+  806a7d:	41 5f                	pop    %r15
+  806a7f:	5d                   	pop    %rbp
+  806a80:	c3                   	ret
+
+0000000000806a81 <opencons>:
+
+int
+opencons(void)
+{
+  806a81:	55                   	push   %rbp
+  806a82:	48 89 e5             	mov    %rsp,%rbp
+  806a85:	41 57                	push   %r15
+  806a87:	53                   	push   %rbx
+  806a88:	48 83 ec 10          	sub    $0x10,%rsp
+  806a8c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a8c <opencons+0xb>
+  806a93:	49 bb b4 25 00 00 00 	movabs $0x25b4,%r11
+  806a9a:	00 00 00 
+  806a9d:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806aa0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806aa4:	48 89 c7             	mov    %rax,%rdi
+  806aa7:	49 89 df             	mov    %rbx,%r15
+  806aaa:	48 b8 66 ae ff ff ff 	movabs $0xffffffffffffae66,%rax
+  806ab1:	ff ff ff 
+  806ab4:	48 01 d8             	add    %rbx,%rax
+  806ab7:	ff d0                	call   *%rax
+  806ab9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806abc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ac0:	79 05                	jns    806ac7 <opencons+0x46>
+		return r;
+  806ac2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ac5:	eb 68                	jmp    806b2f <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806ac7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806acb:	ba 07 04 00 00       	mov    $0x407,%edx
+  806ad0:	48 89 c6             	mov    %rax,%rsi
+  806ad3:	bf 00 00 00 00       	mov    $0x0,%edi
+  806ad8:	49 89 df             	mov    %rbx,%r15
+  806adb:	48 b8 77 9e ff ff ff 	movabs $0xffffffffffff9e77,%rax
+  806ae2:	ff ff ff 
+  806ae5:	48 01 d8             	add    %rbx,%rax
+  806ae8:	ff d0                	call   *%rax
+  806aea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806aed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806af1:	79 05                	jns    806af8 <opencons+0x77>
+		return r;
+  806af3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806af6:	eb 37                	jmp    806b2f <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806af8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806afc:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806b03:	00 00 00 
+  806b06:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806b09:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806b0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b0f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806b16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806b1a:	48 89 c7             	mov    %rax,%rdi
+  806b1d:	49 89 df             	mov    %rbx,%r15
+  806b20:	48 b8 ec ad ff ff ff 	movabs $0xffffffffffffadec,%rax
+  806b27:	ff ff ff 
+  806b2a:	48 01 d8             	add    %rbx,%rax
+  806b2d:	ff d0                	call   *%rax
+}
+  806b2f:	48 83 c4 10          	add    $0x10,%rsp
+  806b33:	5b                   	pop    %rbx
+  806b34:	41 5f                	pop    %r15
+  806b36:	5d                   	pop    %rbp
+  806b37:	c3                   	ret
+
+0000000000806b38 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806b38:	55                   	push   %rbp
+  806b39:	48 89 e5             	mov    %rsp,%rbp
+  806b3c:	41 57                	push   %r15
+  806b3e:	53                   	push   %rbx
+  806b3f:	48 83 ec 30          	sub    $0x30,%rsp
+  806b43:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b43 <devcons_read+0xb>
+  806b4a:	49 bb fd 24 00 00 00 	movabs $0x24fd,%r11
+  806b51:	00 00 00 
+  806b54:	4c 01 db             	add    %r11,%rbx
+  806b57:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806b5b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806b5f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806b63:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806b68:	75 19                	jne    806b83 <devcons_read+0x4b>
+		return 0;
+  806b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b6f:	eb 55                	jmp    806bc6 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806b71:	49 89 df             	mov    %rbx,%r15
+  806b74:	48 b8 22 9e ff ff ff 	movabs $0xffffffffffff9e22,%rax
+  806b7b:	ff ff ff 
+  806b7e:	48 01 d8             	add    %rbx,%rax
+  806b81:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806b83:	49 89 df             	mov    %rbx,%r15
+  806b86:	48 b8 1e 9d ff ff ff 	movabs $0xffffffffffff9d1e,%rax
+  806b8d:	ff ff ff 
+  806b90:	48 01 d8             	add    %rbx,%rax
+  806b93:	ff d0                	call   *%rax
+  806b95:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b9c:	74 d3                	je     806b71 <devcons_read+0x39>
+	if (c < 0)
+  806b9e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ba2:	79 05                	jns    806ba9 <devcons_read+0x71>
+		return c;
+  806ba4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ba7:	eb 1d                	jmp    806bc6 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806ba9:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806bad:	75 07                	jne    806bb6 <devcons_read+0x7e>
+		return 0;
+  806baf:	b8 00 00 00 00       	mov    $0x0,%eax
+  806bb4:	eb 10                	jmp    806bc6 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806bb6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bb9:	89 c2                	mov    %eax,%edx
+  806bbb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806bbf:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806bc1:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806bc6:	48 83 c4 30          	add    $0x30,%rsp
+  806bca:	5b                   	pop    %rbx
+  806bcb:	41 5f                	pop    %r15
+  806bcd:	5d                   	pop    %rbp
+  806bce:	c3                   	ret
+
+0000000000806bcf <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806bcf:	55                   	push   %rbp
+  806bd0:	48 89 e5             	mov    %rsp,%rbp
+  806bd3:	41 57                	push   %r15
+  806bd5:	53                   	push   %rbx
+  806bd6:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806bdd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806bdd <devcons_write+0xe>
+  806be4:	49 bb 63 24 00 00 00 	movabs $0x2463,%r11
+  806beb:	00 00 00 
+  806bee:	4c 01 db             	add    %r11,%rbx
+  806bf1:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806bf8:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806bff:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806c06:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806c0d:	e9 80 00 00 00       	jmp    806c92 <devcons_write+0xc3>
+		m = n - tot;
+  806c12:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806c19:	89 c2                	mov    %eax,%edx
+  806c1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c1e:	29 c2                	sub    %eax,%edx
+  806c20:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806c23:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806c26:	83 f8 7f             	cmp    $0x7f,%eax
+  806c29:	76 07                	jbe    806c32 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806c2b:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806c32:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806c35:	48 63 d0             	movslq %eax,%rdx
+  806c38:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c3b:	48 63 c8             	movslq %eax,%rcx
+  806c3e:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806c45:	48 01 c1             	add    %rax,%rcx
+  806c48:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806c4f:	48 89 ce             	mov    %rcx,%rsi
+  806c52:	48 89 c7             	mov    %rax,%rdi
+  806c55:	49 89 df             	mov    %rbx,%r15
+  806c58:	48 b8 9b 95 ff ff ff 	movabs $0xffffffffffff959b,%rax
+  806c5f:	ff ff ff 
+  806c62:	48 01 d8             	add    %rbx,%rax
+  806c65:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806c67:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806c6a:	48 63 d0             	movslq %eax,%rdx
+  806c6d:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806c74:	48 89 d6             	mov    %rdx,%rsi
+  806c77:	48 89 c7             	mov    %rax,%rdi
+  806c7a:	49 89 df             	mov    %rbx,%r15
+  806c7d:	48 b8 bf 9c ff ff ff 	movabs $0xffffffffffff9cbf,%rax
+  806c84:	ff ff ff 
+  806c87:	48 01 d8             	add    %rbx,%rax
+  806c8a:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806c8c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806c8f:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806c92:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c95:	48 98                	cltq
+  806c97:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806c9e:	0f 82 6e ff ff ff    	jb     806c12 <devcons_write+0x43>
+	}
+	return tot;
+  806ca4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806ca7:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806cae:	5b                   	pop    %rbx
+  806caf:	41 5f                	pop    %r15
+  806cb1:	5d                   	pop    %rbp
+  806cb2:	c3                   	ret
+
+0000000000806cb3 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806cb3:	55                   	push   %rbp
+  806cb4:	48 89 e5             	mov    %rsp,%rbp
+  806cb7:	48 83 ec 08          	sub    $0x8,%rsp
+  806cbb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806cbb <devcons_close+0x8>
+  806cc2:	49 bb 85 23 00 00 00 	movabs $0x2385,%r11
+  806cc9:	00 00 00 
+  806ccc:	4c 01 d8             	add    %r11,%rax
+  806ccf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806cd8:	c9                   	leave
+  806cd9:	c3                   	ret
+
+0000000000806cda <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806cda:	55                   	push   %rbp
+  806cdb:	48 89 e5             	mov    %rsp,%rbp
+  806cde:	41 57                	push   %r15
+  806ce0:	48 83 ec 18          	sub    $0x18,%rsp
+  806ce4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806ce4 <devcons_stat+0xa>
+  806ceb:	49 bb 5c 23 00 00 00 	movabs $0x235c,%r11
+  806cf2:	00 00 00 
+  806cf5:	4c 01 d8             	add    %r11,%rax
+  806cf8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806cfc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806d00:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806d04:	48 b9 a5 e7 ff ff ff 	movabs $0xffffffffffffe7a5,%rcx
+  806d0b:	ff ff ff 
+  806d0e:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806d12:	48 89 ce             	mov    %rcx,%rsi
+  806d15:	48 89 d7             	mov    %rdx,%rdi
+  806d18:	49 89 c7             	mov    %rax,%r15
+  806d1b:	48 ba bb 91 ff ff ff 	movabs $0xffffffffffff91bb,%rdx
+  806d22:	ff ff ff 
+  806d25:	48 01 c2             	add    %rax,%rdx
+  806d28:	ff d2                	call   *%rdx
+	return 0;
+  806d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806d2f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806d33:	c9                   	leave
+  806d34:	c3                   	ret
+
+0000000000806d35 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806d35:	55                   	push   %rbp
+  806d36:	48 89 e5             	mov    %rsp,%rbp
+  806d39:	48 83 ec 18          	sub    $0x18,%rsp
+  806d3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d3d <pageref+0x8>
+  806d44:	49 bb 03 23 00 00 00 	movabs $0x2303,%r11
+  806d4b:	00 00 00 
+  806d4e:	4c 01 d8             	add    %r11,%rax
+  806d51:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806d55:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806d59:	48 89 d1             	mov    %rdx,%rcx
+  806d5c:	48 c1 e9 15          	shr    $0x15,%rcx
+  806d60:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806d67:	ff ff ff 
+  806d6a:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806d6e:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806d72:	83 e2 01             	and    $0x1,%edx
+  806d75:	48 85 d2             	test   %rdx,%rdx
+  806d78:	75 07                	jne    806d81 <pageref+0x4c>
+		return 0;
+  806d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d7f:	eb 64                	jmp    806de5 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806d81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806d85:	48 89 d1             	mov    %rdx,%rcx
+  806d88:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806d8c:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806d93:	ff ff ff 
+  806d96:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806d9a:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806d9e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806da2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806da6:	83 e2 01             	and    $0x1,%edx
+  806da9:	48 85 d2             	test   %rdx,%rdx
+  806dac:	75 07                	jne    806db5 <pageref+0x80>
+		return 0;
+  806dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  806db3:	eb 30                	jmp    806de5 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806db5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806db9:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806dbd:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806dc4:	ff ff ff 
+  806dc7:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806dcb:	48 89 d0             	mov    %rdx,%rax
+  806dce:	48 01 c0             	add    %rax,%rax
+  806dd1:	48 01 d0             	add    %rdx,%rax
+  806dd4:	48 c1 e0 03          	shl    $0x3,%rax
+  806dd8:	48 01 c8             	add    %rcx,%rax
+  806ddb:	48 83 c0 08          	add    $0x8,%rax
+  806ddf:	0f b7 00             	movzwl (%rax),%eax
+  806de2:	0f b7 c0             	movzwl %ax,%eax
+}
+  806de5:	c9                   	leave
+  806de6:	c3                   	ret
@@ -0,0 +1,9478 @@
+
+obj/user/testfloat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 ee 02 00 00       	call   80032f <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <print_float>:
+#include <inc/lib.h>
+
+void print_float(float a){
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	48 83 ec 18          	sub    $0x18,%rsp
+  80004b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80004b <print_float+0x8>
+  800052:	49 bb e5 7f 00 00 00 	movabs $0x7fe5,%r11
+  800059:	00 00 00 
+  80005c:	4c 01 d8             	add    %r11,%rax
+  80005f:	f3 0f 11 45 ec       	movss  %xmm0,-0x14(%rbp)
+	unsigned int num = (unsigned int)a;
+  800064:	f3 0f 10 45 ec       	movss  -0x14(%rbp),%xmm0
+  800069:	f3 48 0f 2c c0       	cvttss2si %xmm0,%rax
+  80006e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+}
+  800071:	90                   	nop
+  800072:	c9                   	leave
+  800073:	c3                   	ret
+
+0000000000800074 <test_func>:
+
+float test_func(float a){
+  800074:	55                   	push   %rbp
+  800075:	48 89 e5             	mov    %rsp,%rbp
+  800078:	48 83 ec 08          	sub    $0x8,%rsp
+  80007c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80007c <test_func+0x8>
+  800083:	49 bb b4 7f 00 00 00 	movabs $0x7fb4,%r11
+  80008a:	00 00 00 
+  80008d:	4c 01 d8             	add    %r11,%rax
+  800090:	f3 0f 11 45 fc       	movss  %xmm0,-0x4(%rbp)
+
+	return a * 2.5;
+  800095:	f3 0f 10 4d fc       	movss  -0x4(%rbp),%xmm1
+  80009a:	48 ba a8 e0 ff ff ff 	movabs $0xffffffffffffe0a8,%rdx
+  8000a1:	ff ff ff 
+  8000a4:	f3 0f 10 04 10       	movss  (%rax,%rdx,1),%xmm0
+  8000a9:	f3 0f 59 c1          	mulss  %xmm1,%xmm0
+}	
+  8000ad:	c9                   	leave
+  8000ae:	c3                   	ret
+
+00000000008000af <exponent>:
+
+float exponent(float base, unsigned int exp){
+  8000af:	55                   	push   %rbp
+  8000b0:	48 89 e5             	mov    %rsp,%rbp
+  8000b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8000b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8000b7 <exponent+0x8>
+  8000be:	49 bb 79 7f 00 00 00 	movabs $0x7f79,%r11
+  8000c5:	00 00 00 
+  8000c8:	4c 01 d8             	add    %r11,%rax
+  8000cb:	f3 0f 11 45 ec       	movss  %xmm0,-0x14(%rbp)
+  8000d0:	89 7d e8             	mov    %edi,-0x18(%rbp)
+	float product = 1.0;
+  8000d3:	48 ba ac e0 ff ff ff 	movabs $0xffffffffffffe0ac,%rdx
+  8000da:	ff ff ff 
+  8000dd:	f3 0f 10 04 10       	movss  (%rax,%rdx,1),%xmm0
+  8000e2:	f3 0f 11 45 fc       	movss  %xmm0,-0x4(%rbp)
+	int count = 0;
+  8000e7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+	while (count < exp){
+  8000ee:	eb 13                	jmp    800103 <exponent+0x54>
+		product *= base;
+  8000f0:	f3 0f 10 45 fc       	movss  -0x4(%rbp),%xmm0
+  8000f5:	f3 0f 59 45 ec       	mulss  -0x14(%rbp),%xmm0
+  8000fa:	f3 0f 11 45 fc       	movss  %xmm0,-0x4(%rbp)
+		count++;
+  8000ff:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+	while (count < exp){
+  800103:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800106:	3b 45 e8             	cmp    -0x18(%rbp),%eax
+  800109:	72 e5                	jb     8000f0 <exponent+0x41>
+	}
+	return product;
+  80010b:	f3 0f 10 45 fc       	movss  -0x4(%rbp),%xmm0
+}
+  800110:	c9                   	leave
+  800111:	c3                   	ret
+
+0000000000800112 <calc_pi>:
+
+void calc_pi(int n){
+  800112:	55                   	push   %rbp
+  800113:	48 89 e5             	mov    %rsp,%rbp
+  800116:	41 57                	push   %r15
+  800118:	53                   	push   %rbx
+  800119:	48 83 ec 20          	sub    $0x20,%rsp
+  80011d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80011d <calc_pi+0xb>
+  800124:	49 bb 13 7f 00 00 00 	movabs $0x7f13,%r11
+  80012b:	00 00 00 
+  80012e:	4c 01 db             	add    %r11,%rbx
+  800131:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int k = 0;
+  800134:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	float running_sum = 0.0;
+  80013b:	48 b8 b0 e0 ff ff ff 	movabs $0xffffffffffffe0b0,%rax
+  800142:	ff ff ff 
+  800145:	f3 0f 10 04 03       	movss  (%rbx,%rax,1),%xmm0
+  80014a:	f3 0f 11 45 e8       	movss  %xmm0,-0x18(%rbp)
+	float coeff = 0;
+  80014f:	48 b8 b0 e0 ff ff ff 	movabs $0xffffffffffffe0b0,%rax
+  800156:	ff ff ff 
+  800159:	f3 0f 10 04 03       	movss  (%rbx,%rax,1),%xmm0
+  80015e:	f3 0f 11 45 e4       	movss  %xmm0,-0x1c(%rbp)
+
+	float garbage = 2.75;	
+  800163:	48 b8 b4 e0 ff ff ff 	movabs $0xffffffffffffe0b4,%rax
+  80016a:	ff ff ff 
+  80016d:	f3 0f 10 04 03       	movss  (%rbx,%rax,1),%xmm0
+  800172:	f3 0f 11 45 e0       	movss  %xmm0,-0x20(%rbp)
+	print_float(garbage);
+  800177:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80017a:	66 0f 6e c0          	movd   %eax,%xmm0
+  80017e:	48 b8 13 80 ff ff ff 	movabs $0xffffffffffff8013,%rax
+  800185:	ff ff ff 
+  800188:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80018c:	ff d0                	call   *%rax
+	if (n){
+  80018e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800192:	0f 84 52 01 00 00    	je     8002ea <calc_pi+0x1d8>
+		for (; k < n; k++){
+  800198:	e9 41 01 00 00       	jmp    8002de <calc_pi+0x1cc>
+			coeff = (1.0 / (exponent(16,k))) * 
+  80019d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001a0:	89 c7                	mov    %eax,%edi
+  8001a2:	48 b8 b8 e0 ff ff ff 	movabs $0xffffffffffffe0b8,%rax
+  8001a9:	ff ff ff 
+  8001ac:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8001af:	66 0f 6e c0          	movd   %eax,%xmm0
+  8001b3:	48 b8 7f 80 ff ff ff 	movabs $0xffffffffffff807f,%rax
+  8001ba:	ff ff ff 
+  8001bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001c1:	ff d0                	call   *%rax
+  8001c3:	66 0f ef c9          	pxor   %xmm1,%xmm1
+  8001c7:	f3 0f 5a c8          	cvtss2sd %xmm0,%xmm1
+  8001cb:	48 b8 c0 e0 ff ff ff 	movabs $0xffffffffffffe0c0,%rax
+  8001d2:	ff ff ff 
+  8001d5:	f2 0f 10 04 03       	movsd  (%rbx,%rax,1),%xmm0
+  8001da:	66 0f 28 d0          	movapd %xmm0,%xmm2
+  8001de:	f2 0f 5e d1          	divsd  %xmm1,%xmm2
+			(
+			(4.0/(8*k + 1)) -
+  8001e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001e5:	c1 e0 03             	shl    $0x3,%eax
+  8001e8:	83 c0 01             	add    $0x1,%eax
+  8001eb:	66 0f ef c9          	pxor   %xmm1,%xmm1
+  8001ef:	f2 0f 2a c8          	cvtsi2sd %eax,%xmm1
+  8001f3:	48 b8 c8 e0 ff ff ff 	movabs $0xffffffffffffe0c8,%rax
+  8001fa:	ff ff ff 
+  8001fd:	f2 0f 10 04 03       	movsd  (%rbx,%rax,1),%xmm0
+  800202:	f2 0f 5e c1          	divsd  %xmm1,%xmm0
+			(2.0/(8*k + 4)) -
+  800206:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800209:	c1 e0 03             	shl    $0x3,%eax
+  80020c:	83 c0 04             	add    $0x4,%eax
+  80020f:	66 0f ef db          	pxor   %xmm3,%xmm3
+  800213:	f2 0f 2a d8          	cvtsi2sd %eax,%xmm3
+  800217:	48 b8 d0 e0 ff ff ff 	movabs $0xffffffffffffe0d0,%rax
+  80021e:	ff ff ff 
+  800221:	f2 0f 10 0c 03       	movsd  (%rbx,%rax,1),%xmm1
+  800226:	f2 0f 5e cb          	divsd  %xmm3,%xmm1
+			(4.0/(8*k + 1)) -
+  80022a:	f2 0f 5c c1          	subsd  %xmm1,%xmm0
+			(1.0/(8*k + 5)) -
+  80022e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800231:	c1 e0 03             	shl    $0x3,%eax
+  800234:	83 c0 05             	add    $0x5,%eax
+  800237:	66 0f ef db          	pxor   %xmm3,%xmm3
+  80023b:	f2 0f 2a d8          	cvtsi2sd %eax,%xmm3
+  80023f:	48 b8 c0 e0 ff ff ff 	movabs $0xffffffffffffe0c0,%rax
+  800246:	ff ff ff 
+  800249:	f2 0f 10 0c 03       	movsd  (%rbx,%rax,1),%xmm1
+  80024e:	f2 0f 5e cb          	divsd  %xmm3,%xmm1
+			(2.0/(8*k + 4)) -
+  800252:	f2 0f 5c c1          	subsd  %xmm1,%xmm0
+			(1.0/(8*k + 6))
+  800256:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800259:	c1 e0 03             	shl    $0x3,%eax
+  80025c:	83 c0 06             	add    $0x6,%eax
+  80025f:	66 0f ef db          	pxor   %xmm3,%xmm3
+  800263:	f2 0f 2a d8          	cvtsi2sd %eax,%xmm3
+  800267:	48 b8 c0 e0 ff ff ff 	movabs $0xffffffffffffe0c0,%rax
+  80026e:	ff ff ff 
+  800271:	f2 0f 10 0c 03       	movsd  (%rbx,%rax,1),%xmm1
+  800276:	f2 0f 5e cb          	divsd  %xmm3,%xmm1
+			(1.0/(8*k + 5)) -
+  80027a:	f2 0f 5c c1          	subsd  %xmm1,%xmm0
+			coeff = (1.0 / (exponent(16,k))) * 
+  80027e:	f2 0f 59 c2          	mulsd  %xmm2,%xmm0
+  800282:	f2 0f 5a c0          	cvtsd2ss %xmm0,%xmm0
+  800286:	f3 0f 11 45 e4       	movss  %xmm0,-0x1c(%rbp)
+			);
+			running_sum += coeff;
+  80028b:	f3 0f 10 45 e8       	movss  -0x18(%rbp),%xmm0
+  800290:	f3 0f 58 45 e4       	addss  -0x1c(%rbp),%xmm0
+  800295:	f3 0f 11 45 e8       	movss  %xmm0,-0x18(%rbp)
+			cprintf("Approximation #%d: %f\n",k,running_sum);	
+  80029a:	66 0f ef e4          	pxor   %xmm4,%xmm4
+  80029e:	f3 0f 5a 65 e8       	cvtss2sd -0x18(%rbp),%xmm4
+  8002a3:	66 48 0f 7e e2       	movq   %xmm4,%rdx
+  8002a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002ab:	66 48 0f 6e c2       	movq   %rdx,%xmm0
+  8002b0:	89 c6                	mov    %eax,%esi
+  8002b2:	48 b8 90 e0 ff ff ff 	movabs $0xffffffffffffe090,%rax
+  8002b9:	ff ff ff 
+  8002bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002c0:	48 89 c7             	mov    %rax,%rdi
+  8002c3:	49 89 df             	mov    %rbx,%r15
+  8002c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002cb:	48 ba 87 85 ff ff ff 	movabs $0xffffffffffff8587,%rdx
+  8002d2:	ff ff ff 
+  8002d5:	48 01 da             	add    %rbx,%rdx
+  8002d8:	ff d2                	call   *%rdx
+		for (; k < n; k++){
+  8002da:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8002de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8002e1:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+  8002e4:	0f 8c b3 fe ff ff    	jl     80019d <calc_pi+0x8b>
+		}
+		
+	}
+}
+  8002ea:	90                   	nop
+  8002eb:	48 83 c4 20          	add    $0x20,%rsp
+  8002ef:	5b                   	pop    %rbx
+  8002f0:	41 5f                	pop    %r15
+  8002f2:	5d                   	pop    %rbp
+  8002f3:	c3                   	ret
+
+00000000008002f4 <umain>:
+
+void umain(int argc, char **argv){
+  8002f4:	55                   	push   %rbp
+  8002f5:	48 89 e5             	mov    %rsp,%rbp
+  8002f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8002fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8002fc <umain+0x8>
+  800303:	49 bb 34 7d 00 00 00 	movabs $0x7d34,%r11
+  80030a:	00 00 00 
+  80030d:	4c 01 d8             	add    %r11,%rax
+  800310:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800313:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+
+
+	calc_pi(10);
+  800317:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80031c:	48 ba e2 80 ff ff ff 	movabs $0xffffffffffff80e2,%rdx
+  800323:	ff ff ff 
+  800326:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80032a:	ff d0                	call   *%rax
+}
+  80032c:	90                   	nop
+  80032d:	c9                   	leave
+  80032e:	c3                   	ret
+
+000000000080032f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80032f:	55                   	push   %rbp
+  800330:	48 89 e5             	mov    %rsp,%rbp
+  800333:	41 57                	push   %r15
+  800335:	53                   	push   %rbx
+  800336:	48 83 ec 20          	sub    $0x20,%rsp
+  80033a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80033a <libmain+0xb>
+  800341:	49 bb f6 7c 00 00 00 	movabs $0x7cf6,%r11
+  800348:	00 00 00 
+  80034b:	4c 01 db             	add    %r11,%rbx
+  80034e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800351:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800355:	49 89 df             	mov    %rbx,%r15
+  800358:	48 b8 5c 9f ff ff ff 	movabs $0xffffffffffff9f5c,%rax
+  80035f:	ff ff ff 
+  800362:	48 01 d8             	add    %rbx,%rax
+  800365:	ff d0                	call   *%rax
+  800367:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  80036a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80036d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800372:	48 98                	cltq
+  800374:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  80037b:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  800382:	ff ff ff 
+  800385:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800389:	48 01 c2             	add    %rax,%rdx
+  80038c:	48 b8 d8 1f 01 00 00 	movabs $0x11fd8,%rax
+  800393:	00 00 00 
+  800396:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80039a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80039e:	7e 15                	jle    8003b5 <libmain+0x86>
+		binaryname = argv[0];
+  8003a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8003a4:	48 8b 00             	mov    (%rax),%rax
+  8003a7:	48 ba 30 00 00 00 00 	movabs $0x30,%rdx
+  8003ae:	00 00 00 
+  8003b1:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8003b5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8003b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8003bc:	48 89 d6             	mov    %rdx,%rsi
+  8003bf:	89 c7                	mov    %eax,%edi
+  8003c1:	49 89 df             	mov    %rbx,%r15
+  8003c4:	48 b8 c4 82 ff ff ff 	movabs $0xffffffffffff82c4,%rax
+  8003cb:	ff ff ff 
+  8003ce:	48 01 d8             	add    %rbx,%rax
+  8003d1:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8003d3:	49 89 df             	mov    %rbx,%r15
+  8003d6:	48 b8 bf 83 ff ff ff 	movabs $0xffffffffffff83bf,%rax
+  8003dd:	ff ff ff 
+  8003e0:	48 01 d8             	add    %rbx,%rax
+  8003e3:	ff d0                	call   *%rax
+}
+  8003e5:	90                   	nop
+  8003e6:	48 83 c4 20          	add    $0x20,%rsp
+  8003ea:	5b                   	pop    %rbx
+  8003eb:	41 5f                	pop    %r15
+  8003ed:	5d                   	pop    %rbp
+  8003ee:	c3                   	ret
+
+00000000008003ef <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003ef:	55                   	push   %rbp
+  8003f0:	48 89 e5             	mov    %rsp,%rbp
+  8003f3:	41 57                	push   %r15
+  8003f5:	53                   	push   %rbx
+  8003f6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8003f6 <exit+0x7>
+  8003fd:	49 bb 3a 7c 00 00 00 	movabs $0x7c3a,%r11
+  800404:	00 00 00 
+  800407:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  80040a:	49 89 df             	mov    %rbx,%r15
+  80040d:	48 b8 d9 ab ff ff ff 	movabs $0xffffffffffffabd9,%rax
+  800414:	ff ff ff 
+  800417:	48 01 d8             	add    %rbx,%rax
+  80041a:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  80041c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800421:	49 89 df             	mov    %rbx,%r15
+  800424:	48 b8 00 9f ff ff ff 	movabs $0xffffffffffff9f00,%rax
+  80042b:	ff ff ff 
+  80042e:	48 01 d8             	add    %rbx,%rax
+  800431:	ff d0                	call   *%rax
+}
+  800433:	90                   	nop
+  800434:	5b                   	pop    %rbx
+  800435:	41 5f                	pop    %r15
+  800437:	5d                   	pop    %rbp
+  800438:	c3                   	ret
+
+0000000000800439 <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  800439:	55                   	push   %rbp
+  80043a:	48 89 e5             	mov    %rsp,%rbp
+  80043d:	41 57                	push   %r15
+  80043f:	48 83 ec 18          	sub    $0x18,%rsp
+  800443:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800443 <putch+0xa>
+  80044a:	49 bb ed 7b 00 00 00 	movabs $0x7bed,%r11
+  800451:	00 00 00 
+  800454:	4c 01 d8             	add    %r11,%rax
+  800457:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80045a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  80045e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800462:	8b 12                	mov    (%rdx),%edx
+  800464:	8d 72 01             	lea    0x1(%rdx),%esi
+  800467:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80046b:	89 31                	mov    %esi,(%rcx)
+  80046d:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800470:	89 ce                	mov    %ecx,%esi
+  800472:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800476:	48 63 d2             	movslq %edx,%rdx
+  800479:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  80047e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800482:	8b 12                	mov    (%rdx),%edx
+  800484:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80048a:	75 33                	jne    8004bf <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  80048c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800490:	8b 12                	mov    (%rdx),%edx
+  800492:	48 63 d2             	movslq %edx,%rdx
+  800495:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800499:	48 83 c1 08          	add    $0x8,%rcx
+  80049d:	48 89 d6             	mov    %rdx,%rsi
+  8004a0:	48 89 cf             	mov    %rcx,%rdi
+  8004a3:	49 89 c7             	mov    %rax,%r15
+  8004a6:	48 ba 4d 9e ff ff ff 	movabs $0xffffffffffff9e4d,%rdx
+  8004ad:	ff ff ff 
+  8004b0:	48 01 c2             	add    %rax,%rdx
+  8004b3:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8004b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004b9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8004bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004c3:	8b 40 04             	mov    0x4(%rax),%eax
+  8004c6:	8d 50 01             	lea    0x1(%rax),%edx
+  8004c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004cd:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8004d0:	90                   	nop
+  8004d1:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8004d5:	c9                   	leave
+  8004d6:	c3                   	ret
+
+00000000008004d7 <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004d7:	55                   	push   %rbp
+  8004d8:	48 89 e5             	mov    %rsp,%rbp
+  8004db:	41 57                	push   %r15
+  8004dd:	53                   	push   %rbx
+  8004de:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  8004e5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004e5 <vcprintf+0xe>
+  8004ec:	49 bb 4b 7b 00 00 00 	movabs $0x7b4b,%r11
+  8004f3:	00 00 00 
+  8004f6:	4c 01 db             	add    %r11,%rbx
+  8004f9:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800500:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  800507:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80050e:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  800515:	48 8b 06             	mov    (%rsi),%rax
+  800518:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80051c:	48 89 01             	mov    %rax,(%rcx)
+  80051f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800523:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800527:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  80052b:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800532:	00 00 00 
+    b.cnt = 0;
+  800535:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80053c:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  80053f:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800546:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  80054d:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  800554:	48 89 c6             	mov    %rax,%rsi
+  800557:	48 b8 09 84 ff ff ff 	movabs $0xffffffffffff8409,%rax
+  80055e:	ff ff ff 
+  800561:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800565:	48 89 c7             	mov    %rax,%rdi
+  800568:	49 89 df             	mov    %rbx,%r15
+  80056b:	48 b8 cb 89 ff ff ff 	movabs $0xffffffffffff89cb,%rax
+  800572:	ff ff ff 
+  800575:	48 01 d8             	add    %rbx,%rax
+  800578:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  80057a:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800580:	48 98                	cltq
+  800582:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  800589:	48 83 c2 08          	add    $0x8,%rdx
+  80058d:	48 89 c6             	mov    %rax,%rsi
+  800590:	48 89 d7             	mov    %rdx,%rdi
+  800593:	49 89 df             	mov    %rbx,%r15
+  800596:	48 b8 4d 9e ff ff ff 	movabs $0xffffffffffff9e4d,%rax
+  80059d:	ff ff ff 
+  8005a0:	48 01 d8             	add    %rbx,%rax
+  8005a3:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8005a5:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8005ab:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8005b2:	5b                   	pop    %rbx
+  8005b3:	41 5f                	pop    %r15
+  8005b5:	5d                   	pop    %rbp
+  8005b6:	c3                   	ret
+
+00000000008005b7 <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8005b7:	55                   	push   %rbp
+  8005b8:	48 89 e5             	mov    %rsp,%rbp
+  8005bb:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8005c2:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8005c2 <cprintf+0xb>
+  8005c9:	49 bb 6e 7a 00 00 00 	movabs $0x7a6e,%r11
+  8005d0:	00 00 00 
+  8005d3:	4d 01 da             	add    %r11,%r10
+  8005d6:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8005dd:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8005e4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8005eb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8005f2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8005f9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800600:	84 c0                	test   %al,%al
+  800602:	74 20                	je     800624 <cprintf+0x6d>
+  800604:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800608:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80060c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800610:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800614:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800618:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80061c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800620:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  800624:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80062b:	00 00 00 
+  80062e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800635:	00 00 00 
+  800638:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80063c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800643:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80064a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800651:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  800658:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  80065f:	48 8b 06             	mov    (%rsi),%rax
+  800662:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800666:	48 89 01             	mov    %rax,(%rcx)
+  800669:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80066d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800671:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  800675:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  80067c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800683:	48 89 d6             	mov    %rdx,%rsi
+  800686:	48 89 c7             	mov    %rax,%rdi
+  800689:	48 b8 a7 84 ff ff ff 	movabs $0xffffffffffff84a7,%rax
+  800690:	ff ff ff 
+  800693:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  800697:	ff d0                	call   *%rax
+  800699:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  80069f:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8006a5:	c9                   	leave
+  8006a6:	c3                   	ret
+
+00000000008006a7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8006a7:	55                   	push   %rbp
+  8006a8:	48 89 e5             	mov    %rsp,%rbp
+  8006ab:	53                   	push   %rbx
+  8006ac:	48 83 ec 38          	sub    $0x38,%rsp
+  8006b0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8006b0 <printnum+0x9>
+  8006b7:	49 bb 80 79 00 00 00 	movabs $0x7980,%r11
+  8006be:	00 00 00 
+  8006c1:	4c 01 db             	add    %r11,%rbx
+  8006c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8006c8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8006cc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8006d0:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  8006d3:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  8006d7:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8006db:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8006de:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8006e2:	72 58                	jb     80073c <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006e4:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8006e7:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8006ea:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8006ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8006f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f6:	48 f7 f6             	div    %rsi
+  8006f9:	49 89 c2             	mov    %rax,%r10
+  8006fc:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8006ff:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800702:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  800706:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80070a:	41 89 c9             	mov    %ecx,%r9d
+  80070d:	41 89 f8             	mov    %edi,%r8d
+  800710:	89 d1                	mov    %edx,%ecx
+  800712:	4c 89 d2             	mov    %r10,%rdx
+  800715:	48 89 c7             	mov    %rax,%rdi
+  800718:	48 b8 77 86 ff ff ff 	movabs $0xffffffffffff8677,%rax
+  80071f:	ff ff ff 
+  800722:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800726:	ff d0                	call   *%rax
+  800728:	eb 1c                	jmp    800746 <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80072a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80072e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800731:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800735:	48 89 d6             	mov    %rdx,%rsi
+  800738:	89 c7                	mov    %eax,%edi
+  80073a:	ff d1                	call   *%rcx
+		while (--width > 0)
+  80073c:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800740:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  800744:	7f e4                	jg     80072a <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800746:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800749:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80074d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800752:	48 f7 f1             	div    %rcx
+  800755:	48 b8 1f e2 ff ff ff 	movabs $0xffffffffffffe21f,%rax
+  80075c:	ff ff ff 
+  80075f:	48 01 d8             	add    %rbx,%rax
+  800762:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800766:	0f be c0             	movsbl %al,%eax
+  800769:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80076d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800771:	48 89 d6             	mov    %rdx,%rsi
+  800774:	89 c7                	mov    %eax,%edi
+  800776:	ff d1                	call   *%rcx
+}
+  800778:	90                   	nop
+  800779:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80077d:	c9                   	leave
+  80077e:	c3                   	ret
+
+000000000080077f <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  80077f:	55                   	push   %rbp
+  800780:	48 89 e5             	mov    %rsp,%rbp
+  800783:	48 83 ec 20          	sub    $0x20,%rsp
+  800787:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800787 <getuint+0x8>
+  80078e:	49 bb a9 78 00 00 00 	movabs $0x78a9,%r11
+  800795:	00 00 00 
+  800798:	4c 01 d8             	add    %r11,%rax
+  80079b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80079f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8007a2:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8007a6:	7e 4f                	jle    8007f7 <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8007a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007ac:	8b 00                	mov    (%rax),%eax
+  8007ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b1:	77 24                	ja     8007d7 <getuint+0x58>
+  8007b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007b7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007bf:	8b 00                	mov    (%rax),%eax
+  8007c1:	89 c0                	mov    %eax,%eax
+  8007c3:	48 01 d0             	add    %rdx,%rax
+  8007c6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007ca:	8b 12                	mov    (%rdx),%edx
+  8007cc:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007cf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007d3:	89 0a                	mov    %ecx,(%rdx)
+  8007d5:	eb 14                	jmp    8007eb <getuint+0x6c>
+  8007d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007db:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007df:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007e3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8007e7:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007eb:	48 8b 00             	mov    (%rax),%rax
+  8007ee:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8007f2:	e9 9d 00 00 00       	jmp    800894 <getuint+0x115>
+	else if (lflag)
+  8007f7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8007fb:	74 4c                	je     800849 <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8007fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800801:	8b 00                	mov    (%rax),%eax
+  800803:	83 f8 2f             	cmp    $0x2f,%eax
+  800806:	77 24                	ja     80082c <getuint+0xad>
+  800808:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80080c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800810:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800814:	8b 00                	mov    (%rax),%eax
+  800816:	89 c0                	mov    %eax,%eax
+  800818:	48 01 d0             	add    %rdx,%rax
+  80081b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80081f:	8b 12                	mov    (%rdx),%edx
+  800821:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800824:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800828:	89 0a                	mov    %ecx,(%rdx)
+  80082a:	eb 14                	jmp    800840 <getuint+0xc1>
+  80082c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800830:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800834:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800838:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80083c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800840:	48 8b 00             	mov    (%rax),%rax
+  800843:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800847:	eb 4b                	jmp    800894 <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800849:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80084d:	8b 00                	mov    (%rax),%eax
+  80084f:	83 f8 2f             	cmp    $0x2f,%eax
+  800852:	77 24                	ja     800878 <getuint+0xf9>
+  800854:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800858:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80085c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800860:	8b 00                	mov    (%rax),%eax
+  800862:	89 c0                	mov    %eax,%eax
+  800864:	48 01 d0             	add    %rdx,%rax
+  800867:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80086b:	8b 12                	mov    (%rdx),%edx
+  80086d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800870:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800874:	89 0a                	mov    %ecx,(%rdx)
+  800876:	eb 14                	jmp    80088c <getuint+0x10d>
+  800878:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80087c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800880:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800884:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800888:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80088c:	8b 00                	mov    (%rax),%eax
+  80088e:	89 c0                	mov    %eax,%eax
+  800890:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800894:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800898:	c9                   	leave
+  800899:	c3                   	ret
+
+000000000080089a <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  80089a:	55                   	push   %rbp
+  80089b:	48 89 e5             	mov    %rsp,%rbp
+  80089e:	48 83 ec 20          	sub    $0x20,%rsp
+  8008a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008a2 <printfloat+0x8>
+  8008a9:	49 bb 8e 77 00 00 00 	movabs $0x778e,%r11
+  8008b0:	00 00 00 
+  8008b3:	4c 01 d8             	add    %r11,%rax
+  8008b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008be:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  8008c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008c6:	48 85 c0             	test   %rax,%rax
+  8008c9:	79 12                	jns    8008dd <printfloat+0x43>
+		putch('-',putdat);
+  8008cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8008cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008d3:	48 89 c6             	mov    %rax,%rsi
+  8008d6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008db:	ff d2                	call   *%rdx
+	
+}
+  8008dd:	90                   	nop
+  8008de:	c9                   	leave
+  8008df:	c3                   	ret
+
+00000000008008e0 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  8008e0:	55                   	push   %rbp
+  8008e1:	48 89 e5             	mov    %rsp,%rbp
+  8008e4:	48 83 ec 20          	sub    $0x20,%rsp
+  8008e8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8008e8 <getint+0x8>
+  8008ef:	49 bb 48 77 00 00 00 	movabs $0x7748,%r11
+  8008f6:	00 00 00 
+  8008f9:	4c 01 d8             	add    %r11,%rax
+  8008fc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800900:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800903:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800907:	7e 4f                	jle    800958 <getint+0x78>
+		x=va_arg(*ap, long long);
+  800909:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80090d:	8b 00                	mov    (%rax),%eax
+  80090f:	83 f8 2f             	cmp    $0x2f,%eax
+  800912:	77 24                	ja     800938 <getint+0x58>
+  800914:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800918:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80091c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800920:	8b 00                	mov    (%rax),%eax
+  800922:	89 c0                	mov    %eax,%eax
+  800924:	48 01 d0             	add    %rdx,%rax
+  800927:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80092b:	8b 12                	mov    (%rdx),%edx
+  80092d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800930:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800934:	89 0a                	mov    %ecx,(%rdx)
+  800936:	eb 14                	jmp    80094c <getint+0x6c>
+  800938:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80093c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800940:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800944:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800948:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80094c:	48 8b 00             	mov    (%rax),%rax
+  80094f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800953:	e9 9d 00 00 00       	jmp    8009f5 <getint+0x115>
+	else if (lflag)
+  800958:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80095c:	74 4c                	je     8009aa <getint+0xca>
+		x=va_arg(*ap, long);
+  80095e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800962:	8b 00                	mov    (%rax),%eax
+  800964:	83 f8 2f             	cmp    $0x2f,%eax
+  800967:	77 24                	ja     80098d <getint+0xad>
+  800969:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80096d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800971:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800975:	8b 00                	mov    (%rax),%eax
+  800977:	89 c0                	mov    %eax,%eax
+  800979:	48 01 d0             	add    %rdx,%rax
+  80097c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800980:	8b 12                	mov    (%rdx),%edx
+  800982:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800985:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800989:	89 0a                	mov    %ecx,(%rdx)
+  80098b:	eb 14                	jmp    8009a1 <getint+0xc1>
+  80098d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800991:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800995:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800999:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80099d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009a1:	48 8b 00             	mov    (%rax),%rax
+  8009a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009a8:	eb 4b                	jmp    8009f5 <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  8009aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ae:	8b 00                	mov    (%rax),%eax
+  8009b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b3:	77 24                	ja     8009d9 <getint+0xf9>
+  8009b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009b9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c1:	8b 00                	mov    (%rax),%eax
+  8009c3:	89 c0                	mov    %eax,%eax
+  8009c5:	48 01 d0             	add    %rdx,%rax
+  8009c8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009cc:	8b 12                	mov    (%rdx),%edx
+  8009ce:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009d1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009d5:	89 0a                	mov    %ecx,(%rdx)
+  8009d7:	eb 14                	jmp    8009ed <getint+0x10d>
+  8009d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009dd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009e1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009e5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009e9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009ed:	8b 00                	mov    (%rax),%eax
+  8009ef:	48 98                	cltq
+  8009f1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  8009f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8009f9:	c9                   	leave
+  8009fa:	c3                   	ret
+
+00000000008009fb <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  8009fb:	55                   	push   %rbp
+  8009fc:	48 89 e5             	mov    %rsp,%rbp
+  8009ff:	41 57                	push   %r15
+  800a01:	41 55                	push   %r13
+  800a03:	41 54                	push   %r12
+  800a05:	53                   	push   %rbx
+  800a06:	48 83 ec 60          	sub    $0x60,%rsp
+  800a0a:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800a0a <vprintfmt+0xf>
+  800a11:	49 bb 26 76 00 00 00 	movabs $0x7626,%r11
+  800a18:	00 00 00 
+  800a1b:	4d 01 dc             	add    %r11,%r12
+  800a1e:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800a22:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800a26:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800a2a:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800a2e:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800a35:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800a39:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800a3d:	48 8b 06             	mov    (%rsi),%rax
+  800a40:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a44:	48 89 01             	mov    %rax,(%rcx)
+  800a47:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a4b:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a4f:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a53:	eb 17                	jmp    800a6c <vprintfmt+0x71>
+			if (ch == '\0')
+  800a55:	85 db                	test   %ebx,%ebx
+  800a57:	0f 84 97 05 00 00    	je     800ff4 <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800a5d:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800a61:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800a65:	48 89 c6             	mov    %rax,%rsi
+  800a68:	89 df                	mov    %ebx,%edi
+  800a6a:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a6c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800a70:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a74:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800a78:	0f b6 00             	movzbl (%rax),%eax
+  800a7b:	0f b6 d8             	movzbl %al,%ebx
+  800a7e:	83 fb 25             	cmp    $0x25,%ebx
+  800a81:	75 d2                	jne    800a55 <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800a83:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800a87:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800a8e:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800a95:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800a9c:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800aa3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800aa7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800aab:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800aaf:	0f b6 00             	movzbl (%rax),%eax
+  800ab2:	0f b6 d8             	movzbl %al,%ebx
+  800ab5:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800ab8:	83 f8 55             	cmp    $0x55,%eax
+  800abb:	0f 87 00 05 00 00    	ja     800fc1 <vprintfmt+0x5c6>
+  800ac1:	89 c0                	mov    %eax,%eax
+  800ac3:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800aca:	00 
+  800acb:	48 8d 05 a6 57 00 00 	lea    0x57a6(%rip),%rax        # 806278 <.LC18+0xc>
+  800ad2:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800ad6:	48 8d 15 9b 57 00 00 	lea    0x579b(%rip),%rdx        # 806278 <.LC18+0xc>
+  800add:	48 01 d0             	add    %rdx,%rax
+  800ae0:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800ae2:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800ae6:	eb bb                	jmp    800aa3 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800ae8:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800aec:	eb b5                	jmp    800aa3 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800aee:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800af5:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800af8:	89 d0                	mov    %edx,%eax
+  800afa:	c1 e0 02             	shl    $0x2,%eax
+  800afd:	01 d0                	add    %edx,%eax
+  800aff:	01 c0                	add    %eax,%eax
+  800b01:	01 d8                	add    %ebx,%eax
+  800b03:	83 e8 30             	sub    $0x30,%eax
+  800b06:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800b09:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800b0d:	0f b6 00             	movzbl (%rax),%eax
+  800b10:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800b13:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b16:	7e 60                	jle    800b78 <vprintfmt+0x17d>
+  800b18:	83 fb 39             	cmp    $0x39,%ebx
+  800b1b:	7f 5b                	jg     800b78 <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800b1d:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800b22:	eb d1                	jmp    800af5 <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800b24:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800b27:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2a:	77 17                	ja     800b43 <vprintfmt+0x148>
+  800b2c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800b30:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b33:	89 d2                	mov    %edx,%edx
+  800b35:	48 01 d0             	add    %rdx,%rax
+  800b38:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800b3b:	83 c2 08             	add    $0x8,%edx
+  800b3e:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800b41:	eb 0c                	jmp    800b4f <vprintfmt+0x154>
+  800b43:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b47:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b4b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800b4f:	8b 00                	mov    (%rax),%eax
+  800b51:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800b54:	eb 23                	jmp    800b79 <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800b56:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b5a:	0f 89 43 ff ff ff    	jns    800aa3 <vprintfmt+0xa8>
+				width = 0;
+  800b60:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800b67:	e9 37 ff ff ff       	jmp    800aa3 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800b6c:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800b73:	e9 2b ff ff ff       	jmp    800aa3 <vprintfmt+0xa8>
+			goto process_precision;
+  800b78:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800b79:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800b7d:	0f 89 20 ff ff ff    	jns    800aa3 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800b83:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800b86:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800b89:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800b90:	e9 0e ff ff ff       	jmp    800aa3 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800b95:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800b99:	e9 05 ff ff ff       	jmp    800aa3 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800b9e:	83 fb 39             	cmp    $0x39,%ebx
+  800ba1:	7f 0b                	jg     800bae <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800ba3:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800ba6:	c1 e0 08             	shl    $0x8,%eax
+  800ba9:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800bac:	eb 21                	jmp    800bcf <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800bae:	83 fb 60             	cmp    $0x60,%ebx
+  800bb1:	7e 10                	jle    800bc3 <vprintfmt+0x1c8>
+  800bb3:	83 fb 66             	cmp    $0x66,%ebx
+  800bb6:	7f 0b                	jg     800bc3 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800bb8:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800bbb:	c1 e0 08             	shl    $0x8,%eax
+  800bbe:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800bc1:	eb 0c                	jmp    800bcf <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800bc3:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800bca:	e9 04 01 00 00       	jmp    800cd3 <vprintfmt+0x2d8>
+  800bcf:	e9 ff 00 00 00       	jmp    800cd3 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800bd4:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800bd7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bda:	77 17                	ja     800bf3 <vprintfmt+0x1f8>
+  800bdc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800be0:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800be3:	89 d2                	mov    %edx,%edx
+  800be5:	48 01 d0             	add    %rdx,%rax
+  800be8:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800beb:	83 c2 08             	add    $0x8,%edx
+  800bee:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800bf1:	eb 0c                	jmp    800bff <vprintfmt+0x204>
+  800bf3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bf7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bfb:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800bff:	8b 00                	mov    (%rax),%eax
+  800c01:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800c05:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800c09:	48 89 d6             	mov    %rdx,%rsi
+  800c0c:	89 c7                	mov    %eax,%edi
+  800c0e:	ff d1                	call   *%rcx
+			break;
+  800c10:	e9 da 03 00 00       	jmp    800fef <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800c15:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800c18:	83 f8 2f             	cmp    $0x2f,%eax
+  800c1b:	77 17                	ja     800c34 <vprintfmt+0x239>
+  800c1d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800c21:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c24:	89 d2                	mov    %edx,%edx
+  800c26:	48 01 d0             	add    %rdx,%rax
+  800c29:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800c2c:	83 c2 08             	add    $0x8,%edx
+  800c2f:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800c32:	eb 0c                	jmp    800c40 <vprintfmt+0x245>
+  800c34:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c38:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c3c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800c40:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800c42:	85 db                	test   %ebx,%ebx
+  800c44:	79 02                	jns    800c48 <vprintfmt+0x24d>
+				err = -err;
+  800c46:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800c48:	83 fb 15             	cmp    $0x15,%ebx
+  800c4b:	7f 19                	jg     800c66 <vprintfmt+0x26b>
+  800c4d:	48 ba 50 01 00 00 00 	movabs $0x150,%rdx
+  800c54:	00 00 00 
+  800c57:	48 63 c3             	movslq %ebx,%rax
+  800c5a:	4c 01 e2             	add    %r12,%rdx
+  800c5d:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800c61:	4d 85 ed             	test   %r13,%r13
+  800c64:	75 36                	jne    800c9c <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800c66:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800c6a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c6e:	89 d9                	mov    %ebx,%ecx
+  800c70:	48 ba 30 e2 ff ff ff 	movabs $0xffffffffffffe230,%rdx
+  800c77:	ff ff ff 
+  800c7a:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800c7e:	48 89 c7             	mov    %rax,%rdi
+  800c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c86:	49 b8 d2 8f ff ff ff 	movabs $0xffffffffffff8fd2,%r8
+  800c8d:	ff ff ff 
+  800c90:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800c94:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800c97:	e9 53 03 00 00       	jmp    800fef <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800c9c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800ca0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ca4:	4c 89 e9             	mov    %r13,%rcx
+  800ca7:	48 ba 39 e2 ff ff ff 	movabs $0xffffffffffffe239,%rdx
+  800cae:	ff ff ff 
+  800cb1:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800cb5:	48 89 c7             	mov    %rax,%rdi
+  800cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbd:	49 b8 d2 8f ff ff ff 	movabs $0xffffffffffff8fd2,%r8
+  800cc4:	ff ff ff 
+  800cc7:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800ccb:	41 ff d0             	call   *%r8
+			break;
+  800cce:	e9 1c 03 00 00       	jmp    800fef <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800cd3:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800cd6:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd9:	77 17                	ja     800cf2 <vprintfmt+0x2f7>
+  800cdb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800cdf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ce2:	89 d2                	mov    %edx,%edx
+  800ce4:	48 01 d0             	add    %rdx,%rax
+  800ce7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cea:	83 c2 08             	add    $0x8,%edx
+  800ced:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cf0:	eb 0c                	jmp    800cfe <vprintfmt+0x303>
+  800cf2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cf6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cfa:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800cfe:	4c 8b 28             	mov    (%rax),%r13
+  800d01:	4d 85 ed             	test   %r13,%r13
+  800d04:	75 0e                	jne    800d14 <vprintfmt+0x319>
+				p = "(null)";
+  800d06:	48 b8 3c e2 ff ff ff 	movabs $0xffffffffffffe23c,%rax
+  800d0d:	ff ff ff 
+  800d10:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800d14:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d18:	0f 8e 84 00 00 00    	jle    800da2 <vprintfmt+0x3a7>
+  800d1e:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800d22:	74 7e                	je     800da2 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d24:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d27:	48 98                	cltq
+  800d29:	48 89 c6             	mov    %rax,%rsi
+  800d2c:	4c 89 ef             	mov    %r13,%rdi
+  800d2f:	4d 89 e7             	mov    %r12,%r15
+  800d32:	48 b8 f7 92 ff ff ff 	movabs $0xffffffffffff92f7,%rax
+  800d39:	ff ff ff 
+  800d3c:	4c 01 e0             	add    %r12,%rax
+  800d3f:	ff d0                	call   *%rax
+  800d41:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800d44:	eb 17                	jmp    800d5d <vprintfmt+0x362>
+					putch(padc, putdat);
+  800d46:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800d4a:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800d4e:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800d52:	48 89 d6             	mov    %rdx,%rsi
+  800d55:	89 c7                	mov    %eax,%edi
+  800d57:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d59:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800d5d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d61:	7f e3                	jg     800d46 <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d63:	eb 3d                	jmp    800da2 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800d65:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800d69:	74 1e                	je     800d89 <vprintfmt+0x38e>
+  800d6b:	83 fb 1f             	cmp    $0x1f,%ebx
+  800d6e:	7e 05                	jle    800d75 <vprintfmt+0x37a>
+  800d70:	83 fb 7e             	cmp    $0x7e,%ebx
+  800d73:	7e 14                	jle    800d89 <vprintfmt+0x38e>
+					putch('?', putdat);
+  800d75:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d79:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d7d:	48 89 c6             	mov    %rax,%rsi
+  800d80:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d85:	ff d2                	call   *%rdx
+  800d87:	eb 15                	jmp    800d9e <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800d89:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800d8c:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800d8f:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800d93:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800d97:	48 89 c6             	mov    %rax,%rsi
+  800d9a:	89 cf                	mov    %ecx,%edi
+  800d9c:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d9e:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800da2:	4c 89 e8             	mov    %r13,%rax
+  800da5:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800da9:	0f b6 00             	movzbl (%rax),%eax
+  800dac:	0f be d8             	movsbl %al,%ebx
+  800daf:	85 db                	test   %ebx,%ebx
+  800db1:	74 28                	je     800ddb <vprintfmt+0x3e0>
+  800db3:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800db7:	78 ac                	js     800d65 <vprintfmt+0x36a>
+  800db9:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800dbd:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800dc1:	79 a2                	jns    800d65 <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800dc3:	eb 16                	jmp    800ddb <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800dc5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800dc9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800dcd:	48 89 c6             	mov    %rax,%rsi
+  800dd0:	bf 20 00 00 00       	mov    $0x20,%edi
+  800dd5:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800dd7:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ddb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ddf:	7f e4                	jg     800dc5 <vprintfmt+0x3ca>
+			break;
+  800de1:	e9 09 02 00 00       	jmp    800fef <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800de6:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800dea:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800dee:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800df2:	0f b6 00             	movzbl (%rax),%eax
+  800df5:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800df8:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800df9:	83 fb 2f             	cmp    $0x2f,%ebx
+  800dfc:	0f 8e ac fd ff ff    	jle    800bae <vprintfmt+0x1b3>
+  800e02:	e9 97 fd ff ff       	jmp    800b9e <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800e07:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e0b:	be 03 00 00 00       	mov    $0x3,%esi
+  800e10:	48 89 c7             	mov    %rax,%rdi
+  800e13:	48 b8 b0 88 ff ff ff 	movabs $0xffffffffffff88b0,%rax
+  800e1a:	ff ff ff 
+  800e1d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e21:	ff d0                	call   *%rax
+  800e23:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800e27:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e2b:	48 85 c0             	test   %rax,%rax
+  800e2e:	79 1d                	jns    800e4d <vprintfmt+0x452>
+				putch('-', putdat);
+  800e30:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800e34:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800e38:	48 89 c6             	mov    %rax,%rsi
+  800e3b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e40:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800e42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800e46:	48 f7 d8             	neg    %rax
+  800e49:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  800e4d:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800e54:	e9 de 00 00 00       	jmp    800f37 <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  800e59:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e5d:	be 03 00 00 00       	mov    $0x3,%esi
+  800e62:	48 89 c7             	mov    %rax,%rdi
+  800e65:	48 b8 4f 87 ff ff ff 	movabs $0xffffffffffff874f,%rax
+  800e6c:	ff ff ff 
+  800e6f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e73:	ff d0                	call   *%rax
+  800e75:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  800e79:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  800e80:	e9 b2 00 00 00       	jmp    800f37 <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  800e85:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800e89:	be 03 00 00 00       	mov    $0x3,%esi
+  800e8e:	48 89 c7             	mov    %rax,%rdi
+  800e91:	48 b8 4f 87 ff ff ff 	movabs $0xffffffffffff874f,%rax
+  800e98:	ff ff ff 
+  800e9b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e9f:	ff d0                	call   *%rax
+  800ea1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  800ea5:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  800eac:	e9 86 00 00 00       	jmp    800f37 <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  800eb1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800eb5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800eb9:	48 89 c6             	mov    %rax,%rsi
+  800ebc:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ec1:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  800ec3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800ec7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800ecb:	48 89 c6             	mov    %rax,%rsi
+  800ece:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ed3:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  800ed5:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800ed8:	83 f8 2f             	cmp    $0x2f,%eax
+  800edb:	77 17                	ja     800ef4 <vprintfmt+0x4f9>
+  800edd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ee1:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ee4:	89 d2                	mov    %edx,%edx
+  800ee6:	48 01 d0             	add    %rdx,%rax
+  800ee9:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800eec:	83 c2 08             	add    $0x8,%edx
+  800eef:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ef2:	eb 0c                	jmp    800f00 <vprintfmt+0x505>
+  800ef4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ef8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800efc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f00:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  800f03:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f07:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  800f0e:	eb 27                	jmp    800f37 <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  800f10:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f14:	be 03 00 00 00       	mov    $0x3,%esi
+  800f19:	48 89 c7             	mov    %rax,%rdi
+  800f1c:	48 b8 4f 87 ff ff ff 	movabs $0xffffffffffff874f,%rax
+  800f23:	ff ff ff 
+  800f26:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f2a:	ff d0                	call   *%rax
+  800f2c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  800f30:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  800f37:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  800f3c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  800f3f:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800f42:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800f46:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f4a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f4e:	45 89 c1             	mov    %r8d,%r9d
+  800f51:	41 89 f8             	mov    %edi,%r8d
+  800f54:	48 89 c7             	mov    %rax,%rdi
+  800f57:	48 b8 77 86 ff ff ff 	movabs $0xffffffffffff8677,%rax
+  800f5e:	ff ff ff 
+  800f61:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f65:	ff d0                	call   *%rax
+			break;
+  800f67:	e9 83 00 00 00       	jmp    800fef <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  800f6c:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800f70:	be 03 00 00 00       	mov    $0x3,%esi
+  800f75:	48 89 c7             	mov    %rax,%rdi
+  800f78:	48 b8 4f 87 ff ff ff 	movabs $0xffffffffffff874f,%rax
+  800f7f:	ff ff ff 
+  800f82:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f86:	ff d0                	call   *%rax
+  800f88:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  800f8c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800f90:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  800f94:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f98:	48 89 ce             	mov    %rcx,%rsi
+  800f9b:	48 89 c7             	mov    %rax,%rdi
+  800f9e:	48 b8 6a 88 ff ff ff 	movabs $0xffffffffffff886a,%rax
+  800fa5:	ff ff ff 
+  800fa8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fac:	ff d0                	call   *%rax
+	
+			break;
+  800fae:	eb 3f                	jmp    800fef <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  800fb0:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fb4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fb8:	48 89 c6             	mov    %rax,%rsi
+  800fbb:	89 df                	mov    %ebx,%edi
+  800fbd:	ff d2                	call   *%rdx
+			break;
+  800fbf:	eb 2e                	jmp    800fef <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  800fc1:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fc5:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fc9:	48 89 c6             	mov    %rax,%rsi
+  800fcc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fd1:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800fd3:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800fd8:	eb 05                	jmp    800fdf <vprintfmt+0x5e4>
+  800fda:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  800fdf:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800fe3:	48 83 e8 01          	sub    $0x1,%rax
+  800fe7:	0f b6 00             	movzbl (%rax),%eax
+  800fea:	3c 25                	cmp    $0x25,%al
+  800fec:	75 ec                	jne    800fda <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  800fee:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800fef:	e9 78 fa ff ff       	jmp    800a6c <vprintfmt+0x71>
+				return;
+  800ff4:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  800ff5:	48 83 c4 60          	add    $0x60,%rsp
+  800ff9:	5b                   	pop    %rbx
+  800ffa:	41 5c                	pop    %r12
+  800ffc:	41 5d                	pop    %r13
+  800ffe:	41 5f                	pop    %r15
+  801000:	5d                   	pop    %rbp
+  801001:	c3                   	ret
+
+0000000000801002 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801002:	55                   	push   %rbp
+  801003:	48 89 e5             	mov    %rsp,%rbp
+  801006:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80100d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80100d <printfmt+0xb>
+  801014:	49 bb 23 70 00 00 00 	movabs $0x7023,%r11
+  80101b:	00 00 00 
+  80101e:	4d 01 da             	add    %r11,%r10
+  801021:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801028:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80102f:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801036:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80103d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801044:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80104b:	84 c0                	test   %al,%al
+  80104d:	74 20                	je     80106f <printfmt+0x6d>
+  80104f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801053:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801057:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80105b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80105f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801063:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801067:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80106b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80106f:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801076:	00 00 00 
+  801079:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801080:	00 00 00 
+  801083:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801087:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  80108e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801095:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  80109c:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8010a3:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8010aa:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8010b1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8010b8:	48 89 c7             	mov    %rax,%rdi
+  8010bb:	48 b8 cb 89 ff ff ff 	movabs $0xffffffffffff89cb,%rax
+  8010c2:	ff ff ff 
+  8010c5:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8010c9:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  8010cb:	90                   	nop
+  8010cc:	c9                   	leave
+  8010cd:	c3                   	ret
+
+00000000008010ce <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8010ce:	55                   	push   %rbp
+  8010cf:	48 89 e5             	mov    %rsp,%rbp
+  8010d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8010d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8010d6 <sprintputch+0x8>
+  8010dd:	49 bb 5a 6f 00 00 00 	movabs $0x6f5a,%r11
+  8010e4:	00 00 00 
+  8010e7:	4c 01 d8             	add    %r11,%rax
+  8010ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8010ed:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8010f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010f5:	8b 40 10             	mov    0x10(%rax),%eax
+  8010f8:	8d 50 01             	lea    0x1(%rax),%edx
+  8010fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8010ff:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801102:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801106:	48 8b 10             	mov    (%rax),%rdx
+  801109:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80110d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801111:	48 39 c2             	cmp    %rax,%rdx
+  801114:	73 17                	jae    80112d <sprintputch+0x5f>
+		*b->buf++ = ch;
+  801116:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80111a:	48 8b 00             	mov    (%rax),%rax
+  80111d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801121:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801125:	48 89 0a             	mov    %rcx,(%rdx)
+  801128:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80112b:	88 10                	mov    %dl,(%rax)
+}
+  80112d:	90                   	nop
+  80112e:	c9                   	leave
+  80112f:	c3                   	ret
+
+0000000000801130 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801130:	55                   	push   %rbp
+  801131:	48 89 e5             	mov    %rsp,%rbp
+  801134:	53                   	push   %rbx
+  801135:	48 83 ec 58          	sub    $0x58,%rsp
+  801139:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801139 <vsnprintf+0x9>
+  801140:	49 bb f7 6e 00 00 00 	movabs $0x6ef7,%r11
+  801147:	00 00 00 
+  80114a:	4c 01 d8             	add    %r11,%rax
+  80114d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801151:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  801154:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801158:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  80115c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801160:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801164:	48 8b 0e             	mov    (%rsi),%rcx
+  801167:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  80116b:	48 89 0a             	mov    %rcx,(%rdx)
+  80116e:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801172:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  801176:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80117a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80117e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801182:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  801185:	48 63 d2             	movslq %edx,%rdx
+  801188:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  80118c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801190:	48 01 ca             	add    %rcx,%rdx
+  801193:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801197:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  80119e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8011a3:	74 06                	je     8011ab <vsnprintf+0x7b>
+  8011a5:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8011a9:	7f 07                	jg     8011b2 <vsnprintf+0x82>
+		return -E_INVAL;
+  8011ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b0:	eb 34                	jmp    8011e6 <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8011b2:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8011b6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8011ba:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8011be:	48 bf 9e 90 ff ff ff 	movabs $0xffffffffffff909e,%rdi
+  8011c5:	ff ff ff 
+  8011c8:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  8011cc:	49 b8 cb 89 ff ff ff 	movabs $0xffffffffffff89cb,%r8
+  8011d3:	ff ff ff 
+  8011d6:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  8011da:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  8011dc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011e0:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  8011e3:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  8011e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ea:	c9                   	leave
+  8011eb:	c3                   	ret
+
+00000000008011ec <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8011ec:	55                   	push   %rbp
+  8011ed:	48 89 e5             	mov    %rsp,%rbp
+  8011f0:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8011f7:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8011f7 <snprintf+0xb>
+  8011fe:	49 bb 39 6e 00 00 00 	movabs $0x6e39,%r11
+  801205:	00 00 00 
+  801208:	4d 01 da             	add    %r11,%r10
+  80120b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801212:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  801218:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80121f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801226:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80122d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801234:	84 c0                	test   %al,%al
+  801236:	74 20                	je     801258 <snprintf+0x6c>
+  801238:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80123c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801240:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801244:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801248:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80124c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801250:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801254:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  801258:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80125f:	00 00 00 
+  801262:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801269:	00 00 00 
+  80126c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801270:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801277:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80127e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  801285:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80128c:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801293:	48 8b 06             	mov    (%rsi),%rax
+  801296:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80129a:	48 89 01             	mov    %rax,(%rcx)
+  80129d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8012a1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8012a5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8012a9:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8012b0:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8012b7:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8012bd:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8012c4:	48 89 c7             	mov    %rax,%rdi
+  8012c7:	48 b8 00 91 ff ff ff 	movabs $0xffffffffffff9100,%rax
+  8012ce:	ff ff ff 
+  8012d1:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8012d5:	ff d0                	call   *%rax
+  8012d7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  8012dd:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8012e3:	c9                   	leave
+  8012e4:	c3                   	ret
+
+00000000008012e5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8012e5:	55                   	push   %rbp
+  8012e6:	48 89 e5             	mov    %rsp,%rbp
+  8012e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8012ed:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012ed <strlen+0x8>
+  8012f4:	49 bb 43 6d 00 00 00 	movabs $0x6d43,%r11
+  8012fb:	00 00 00 
+  8012fe:	4c 01 d8             	add    %r11,%rax
+  801301:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  801305:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80130c:	eb 09                	jmp    801317 <strlen+0x32>
+		n++;
+  80130e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801312:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801317:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80131b:	0f b6 00             	movzbl (%rax),%eax
+  80131e:	84 c0                	test   %al,%al
+  801320:	75 ec                	jne    80130e <strlen+0x29>
+	return n;
+  801322:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801325:	c9                   	leave
+  801326:	c3                   	ret
+
+0000000000801327 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  801327:	55                   	push   %rbp
+  801328:	48 89 e5             	mov    %rsp,%rbp
+  80132b:	48 83 ec 20          	sub    $0x20,%rsp
+  80132f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80132f <strnlen+0x8>
+  801336:	49 bb 01 6d 00 00 00 	movabs $0x6d01,%r11
+  80133d:	00 00 00 
+  801340:	4c 01 d8             	add    %r11,%rax
+  801343:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801347:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80134b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801352:	eb 0e                	jmp    801362 <strnlen+0x3b>
+		n++;
+  801354:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801358:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80135d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801362:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801367:	74 0b                	je     801374 <strnlen+0x4d>
+  801369:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80136d:	0f b6 00             	movzbl (%rax),%eax
+  801370:	84 c0                	test   %al,%al
+  801372:	75 e0                	jne    801354 <strnlen+0x2d>
+	return n;
+  801374:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801377:	c9                   	leave
+  801378:	c3                   	ret
+
+0000000000801379 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801379:	55                   	push   %rbp
+  80137a:	48 89 e5             	mov    %rsp,%rbp
+  80137d:	48 83 ec 20          	sub    $0x20,%rsp
+  801381:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801381 <strcpy+0x8>
+  801388:	49 bb af 6c 00 00 00 	movabs $0x6caf,%r11
+  80138f:	00 00 00 
+  801392:	4c 01 d8             	add    %r11,%rax
+  801395:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801399:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  80139d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013a1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8013a5:	90                   	nop
+  8013a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013aa:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013ae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013b6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013ba:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013be:	0f b6 12             	movzbl (%rdx),%edx
+  8013c1:	88 10                	mov    %dl,(%rax)
+  8013c3:	0f b6 00             	movzbl (%rax),%eax
+  8013c6:	84 c0                	test   %al,%al
+  8013c8:	75 dc                	jne    8013a6 <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  8013ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8013ce:	c9                   	leave
+  8013cf:	c3                   	ret
+
+00000000008013d0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8013d0:	55                   	push   %rbp
+  8013d1:	48 89 e5             	mov    %rsp,%rbp
+  8013d4:	53                   	push   %rbx
+  8013d5:	48 83 ec 20          	sub    $0x20,%rsp
+  8013d9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8013d9 <strcat+0x9>
+  8013e0:	49 bb 57 6c 00 00 00 	movabs $0x6c57,%r11
+  8013e7:	00 00 00 
+  8013ea:	4c 01 db             	add    %r11,%rbx
+  8013ed:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8013f1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8013f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013f9:	48 89 c7             	mov    %rax,%rdi
+  8013fc:	48 b8 b5 92 ff ff ff 	movabs $0xffffffffffff92b5,%rax
+  801403:	ff ff ff 
+  801406:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80140a:	ff d0                	call   *%rax
+  80140c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  80140f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801412:	48 63 d0             	movslq %eax,%rdx
+  801415:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801419:	48 01 c2             	add    %rax,%rdx
+  80141c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801420:	48 89 c6             	mov    %rax,%rsi
+  801423:	48 89 d7             	mov    %rdx,%rdi
+  801426:	48 b8 49 93 ff ff ff 	movabs $0xffffffffffff9349,%rax
+  80142d:	ff ff ff 
+  801430:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801434:	ff d0                	call   *%rax
+	return dst;
+  801436:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  80143a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80143e:	c9                   	leave
+  80143f:	c3                   	ret
+
+0000000000801440 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801440:	55                   	push   %rbp
+  801441:	48 89 e5             	mov    %rsp,%rbp
+  801444:	48 83 ec 28          	sub    $0x28,%rsp
+  801448:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801448 <strncpy+0x8>
+  80144f:	49 bb e8 6b 00 00 00 	movabs $0x6be8,%r11
+  801456:	00 00 00 
+  801459:	4c 01 d8             	add    %r11,%rax
+  80145c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801460:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801464:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  801468:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80146c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801470:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801477:	00 
+  801478:	eb 2a                	jmp    8014a4 <strncpy+0x64>
+		*dst++ = *src;
+  80147a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80147e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801482:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801486:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80148a:	0f b6 12             	movzbl (%rdx),%edx
+  80148d:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  80148f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801493:	0f b6 00             	movzbl (%rax),%eax
+  801496:	84 c0                	test   %al,%al
+  801498:	74 05                	je     80149f <strncpy+0x5f>
+			src++;
+  80149a:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  80149f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8014a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014a8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8014ac:	72 cc                	jb     80147a <strncpy+0x3a>
+	}
+	return ret;
+  8014ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8014b2:	c9                   	leave
+  8014b3:	c3                   	ret
+
+00000000008014b4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8014b4:	55                   	push   %rbp
+  8014b5:	48 89 e5             	mov    %rsp,%rbp
+  8014b8:	48 83 ec 28          	sub    $0x28,%rsp
+  8014bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014bc <strlcpy+0x8>
+  8014c3:	49 bb 74 6b 00 00 00 	movabs $0x6b74,%r11
+  8014ca:	00 00 00 
+  8014cd:	4c 01 d8             	add    %r11,%rax
+  8014d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014d4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8014d8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  8014dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  8014e4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8014e9:	74 3d                	je     801528 <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8014eb:	eb 1d                	jmp    80150a <strlcpy+0x56>
+			*dst++ = *src++;
+  8014ed:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8014f1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8014f5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8014f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014fd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801501:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801505:	0f b6 12             	movzbl (%rdx),%edx
+  801508:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  80150a:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80150f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801514:	74 0b                	je     801521 <strlcpy+0x6d>
+  801516:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80151a:	0f b6 00             	movzbl (%rax),%eax
+  80151d:	84 c0                	test   %al,%al
+  80151f:	75 cc                	jne    8014ed <strlcpy+0x39>
+		*dst = '\0';
+  801521:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801525:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  801528:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80152c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801530:	c9                   	leave
+  801531:	c3                   	ret
+
+0000000000801532 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801532:	55                   	push   %rbp
+  801533:	48 89 e5             	mov    %rsp,%rbp
+  801536:	48 83 ec 10          	sub    $0x10,%rsp
+  80153a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80153a <strcmp+0x8>
+  801541:	49 bb f6 6a 00 00 00 	movabs $0x6af6,%r11
+  801548:	00 00 00 
+  80154b:	4c 01 d8             	add    %r11,%rax
+  80154e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801552:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  801556:	eb 0a                	jmp    801562 <strcmp+0x30>
+		p++, q++;
+  801558:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80155d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801562:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801566:	0f b6 00             	movzbl (%rax),%eax
+  801569:	84 c0                	test   %al,%al
+  80156b:	74 12                	je     80157f <strcmp+0x4d>
+  80156d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801571:	0f b6 10             	movzbl (%rax),%edx
+  801574:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801578:	0f b6 00             	movzbl (%rax),%eax
+  80157b:	38 c2                	cmp    %al,%dl
+  80157d:	74 d9                	je     801558 <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80157f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801583:	0f b6 00             	movzbl (%rax),%eax
+  801586:	0f b6 d0             	movzbl %al,%edx
+  801589:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80158d:	0f b6 00             	movzbl (%rax),%eax
+  801590:	0f b6 c0             	movzbl %al,%eax
+  801593:	29 c2                	sub    %eax,%edx
+  801595:	89 d0                	mov    %edx,%eax
+}
+  801597:	c9                   	leave
+  801598:	c3                   	ret
+
+0000000000801599 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801599:	55                   	push   %rbp
+  80159a:	48 89 e5             	mov    %rsp,%rbp
+  80159d:	48 83 ec 18          	sub    $0x18,%rsp
+  8015a1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015a1 <strncmp+0x8>
+  8015a8:	49 bb 8f 6a 00 00 00 	movabs $0x6a8f,%r11
+  8015af:	00 00 00 
+  8015b2:	4c 01 d8             	add    %r11,%rax
+  8015b5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8015b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8015bd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8015c1:	eb 0f                	jmp    8015d2 <strncmp+0x39>
+		n--, p++, q++;
+  8015c3:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8015c8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8015cd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8015d2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8015d7:	74 1d                	je     8015f6 <strncmp+0x5d>
+  8015d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015dd:	0f b6 00             	movzbl (%rax),%eax
+  8015e0:	84 c0                	test   %al,%al
+  8015e2:	74 12                	je     8015f6 <strncmp+0x5d>
+  8015e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015e8:	0f b6 10             	movzbl (%rax),%edx
+  8015eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ef:	0f b6 00             	movzbl (%rax),%eax
+  8015f2:	38 c2                	cmp    %al,%dl
+  8015f4:	74 cd                	je     8015c3 <strncmp+0x2a>
+	if (n == 0)
+  8015f6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8015fb:	75 07                	jne    801604 <strncmp+0x6b>
+		return 0;
+  8015fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801602:	eb 16                	jmp    80161a <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801604:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801608:	0f b6 00             	movzbl (%rax),%eax
+  80160b:	0f b6 d0             	movzbl %al,%edx
+  80160e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801612:	0f b6 00             	movzbl (%rax),%eax
+  801615:	0f b6 c0             	movzbl %al,%eax
+  801618:	29 c2                	sub    %eax,%edx
+}
+  80161a:	89 d0                	mov    %edx,%eax
+  80161c:	c9                   	leave
+  80161d:	c3                   	ret
+
+000000000080161e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80161e:	55                   	push   %rbp
+  80161f:	48 89 e5             	mov    %rsp,%rbp
+  801622:	48 83 ec 10          	sub    $0x10,%rsp
+  801626:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801626 <strchr+0x8>
+  80162d:	49 bb 0a 6a 00 00 00 	movabs $0x6a0a,%r11
+  801634:	00 00 00 
+  801637:	4c 01 d8             	add    %r11,%rax
+  80163a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80163e:	89 f0                	mov    %esi,%eax
+  801640:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801643:	eb 17                	jmp    80165c <strchr+0x3e>
+		if (*s == c)
+  801645:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801649:	0f b6 00             	movzbl (%rax),%eax
+  80164c:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80164f:	75 06                	jne    801657 <strchr+0x39>
+			return (char *) s;
+  801651:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801655:	eb 15                	jmp    80166c <strchr+0x4e>
+	for (; *s; s++)
+  801657:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80165c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801660:	0f b6 00             	movzbl (%rax),%eax
+  801663:	84 c0                	test   %al,%al
+  801665:	75 de                	jne    801645 <strchr+0x27>
+	return 0;
+  801667:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80166c:	c9                   	leave
+  80166d:	c3                   	ret
+
+000000000080166e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+  801672:	48 83 ec 10          	sub    $0x10,%rsp
+  801676:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801676 <strfind+0x8>
+  80167d:	49 bb ba 69 00 00 00 	movabs $0x69ba,%r11
+  801684:	00 00 00 
+  801687:	4c 01 d8             	add    %r11,%rax
+  80168a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80168e:	89 f0                	mov    %esi,%eax
+  801690:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801693:	eb 11                	jmp    8016a6 <strfind+0x38>
+		if (*s == c)
+  801695:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801699:	0f b6 00             	movzbl (%rax),%eax
+  80169c:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80169f:	74 12                	je     8016b3 <strfind+0x45>
+	for (; *s; s++)
+  8016a1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016aa:	0f b6 00             	movzbl (%rax),%eax
+  8016ad:	84 c0                	test   %al,%al
+  8016af:	75 e4                	jne    801695 <strfind+0x27>
+  8016b1:	eb 01                	jmp    8016b4 <strfind+0x46>
+			break;
+  8016b3:	90                   	nop
+	return (char *) s;
+  8016b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016b8:	c9                   	leave
+  8016b9:	c3                   	ret
+
+00000000008016ba <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8016ba:	55                   	push   %rbp
+  8016bb:	48 89 e5             	mov    %rsp,%rbp
+  8016be:	48 83 ec 18          	sub    $0x18,%rsp
+  8016c2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016c2 <memset+0x8>
+  8016c9:	49 bb 6e 69 00 00 00 	movabs $0x696e,%r11
+  8016d0:	00 00 00 
+  8016d3:	4c 01 d8             	add    %r11,%rax
+  8016d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016da:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8016dd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  8016e1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8016e6:	75 06                	jne    8016ee <memset+0x34>
+		return v;
+  8016e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ec:	eb 69                	jmp    801757 <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8016ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016f2:	83 e0 03             	and    $0x3,%eax
+  8016f5:	48 85 c0             	test   %rax,%rax
+  8016f8:	75 48                	jne    801742 <memset+0x88>
+  8016fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016fe:	83 e0 03             	and    $0x3,%eax
+  801701:	48 85 c0             	test   %rax,%rax
+  801704:	75 3c                	jne    801742 <memset+0x88>
+		c &= 0xFF;
+  801706:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  80170d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801710:	c1 e0 18             	shl    $0x18,%eax
+  801713:	89 c2                	mov    %eax,%edx
+  801715:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801718:	c1 e0 10             	shl    $0x10,%eax
+  80171b:	09 c2                	or     %eax,%edx
+  80171d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801720:	c1 e0 08             	shl    $0x8,%eax
+  801723:	09 d0                	or     %edx,%eax
+  801725:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  801728:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80172c:	48 c1 e8 02          	shr    $0x2,%rax
+  801730:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801733:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801737:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80173a:	48 89 d7             	mov    %rdx,%rdi
+  80173d:	fc                   	cld
+  80173e:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801740:	eb 11                	jmp    801753 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801742:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801746:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801749:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80174d:	48 89 d7             	mov    %rdx,%rdi
+  801750:	fc                   	cld
+  801751:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801753:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801757:	c9                   	leave
+  801758:	c3                   	ret
+
+0000000000801759 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801759:	55                   	push   %rbp
+  80175a:	48 89 e5             	mov    %rsp,%rbp
+  80175d:	48 83 ec 28          	sub    $0x28,%rsp
+  801761:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801761 <memmove+0x8>
+  801768:	49 bb cf 68 00 00 00 	movabs $0x68cf,%r11
+  80176f:	00 00 00 
+  801772:	4c 01 d8             	add    %r11,%rax
+  801775:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801779:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80177d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801781:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801785:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80178d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801791:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801795:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801799:	0f 83 88 00 00 00    	jae    801827 <memmove+0xce>
+  80179f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017a7:	48 01 d0             	add    %rdx,%rax
+  8017aa:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8017ae:	73 77                	jae    801827 <memmove+0xce>
+		s += n;
+  8017b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017b4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8017b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017bc:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8017c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017c4:	83 e0 03             	and    $0x3,%eax
+  8017c7:	48 85 c0             	test   %rax,%rax
+  8017ca:	75 3b                	jne    801807 <memmove+0xae>
+  8017cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d0:	83 e0 03             	and    $0x3,%eax
+  8017d3:	48 85 c0             	test   %rax,%rax
+  8017d6:	75 2f                	jne    801807 <memmove+0xae>
+  8017d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017dc:	83 e0 03             	and    $0x3,%eax
+  8017df:	48 85 c0             	test   %rax,%rax
+  8017e2:	75 23                	jne    801807 <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8017e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017e8:	48 83 e8 04          	sub    $0x4,%rax
+  8017ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8017f0:	48 83 ea 04          	sub    $0x4,%rdx
+  8017f4:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8017f8:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8017fc:	48 89 c7             	mov    %rax,%rdi
+  8017ff:	48 89 d6             	mov    %rdx,%rsi
+  801802:	fd                   	std
+  801803:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801805:	eb 1d                	jmp    801824 <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801807:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80180b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80180f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801813:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801817:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80181b:	48 89 d7             	mov    %rdx,%rdi
+  80181e:	48 89 c1             	mov    %rax,%rcx
+  801821:	fd                   	std
+  801822:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801824:	fc                   	cld
+  801825:	eb 57                	jmp    80187e <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801827:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80182b:	83 e0 03             	and    $0x3,%eax
+  80182e:	48 85 c0             	test   %rax,%rax
+  801831:	75 36                	jne    801869 <memmove+0x110>
+  801833:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801837:	83 e0 03             	and    $0x3,%eax
+  80183a:	48 85 c0             	test   %rax,%rax
+  80183d:	75 2a                	jne    801869 <memmove+0x110>
+  80183f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801843:	83 e0 03             	and    $0x3,%eax
+  801846:	48 85 c0             	test   %rax,%rax
+  801849:	75 1e                	jne    801869 <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80184b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80184f:	48 c1 e8 02          	shr    $0x2,%rax
+  801853:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801856:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80185a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80185e:	48 89 c7             	mov    %rax,%rdi
+  801861:	48 89 d6             	mov    %rdx,%rsi
+  801864:	fc                   	cld
+  801865:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801867:	eb 15                	jmp    80187e <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801869:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801871:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801875:	48 89 c7             	mov    %rax,%rdi
+  801878:	48 89 d6             	mov    %rdx,%rsi
+  80187b:	fc                   	cld
+  80187c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  80187e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801882:	c9                   	leave
+  801883:	c3                   	ret
+
+0000000000801884 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801884:	55                   	push   %rbp
+  801885:	48 89 e5             	mov    %rsp,%rbp
+  801888:	48 83 ec 18          	sub    $0x18,%rsp
+  80188c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80188c <memcpy+0x8>
+  801893:	49 bb a4 67 00 00 00 	movabs $0x67a4,%r11
+  80189a:	00 00 00 
+  80189d:	4c 01 d8             	add    %r11,%rax
+  8018a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018a8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  8018ac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018b0:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8018b4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8018b8:	48 89 cf             	mov    %rcx,%rdi
+  8018bb:	48 b9 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rcx
+  8018c2:	ff ff ff 
+  8018c5:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8018c9:	ff d0                	call   *%rax
+}
+  8018cb:	c9                   	leave
+  8018cc:	c3                   	ret
+
+00000000008018cd <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8018cd:	55                   	push   %rbp
+  8018ce:	48 89 e5             	mov    %rsp,%rbp
+  8018d1:	48 83 ec 28          	sub    $0x28,%rsp
+  8018d5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018d5 <memcmp+0x8>
+  8018dc:	49 bb 5b 67 00 00 00 	movabs $0x675b,%r11
+  8018e3:	00 00 00 
+  8018e6:	4c 01 d8             	add    %r11,%rax
+  8018e9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018ed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018f1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  8018f5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018f9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  8018fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801901:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801905:	eb 34                	jmp    80193b <memcmp+0x6e>
+		if (*s1 != *s2)
+  801907:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80190b:	0f b6 10             	movzbl (%rax),%edx
+  80190e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801912:	0f b6 00             	movzbl (%rax),%eax
+  801915:	38 c2                	cmp    %al,%dl
+  801917:	74 18                	je     801931 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801919:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80191d:	0f b6 00             	movzbl (%rax),%eax
+  801920:	0f b6 d0             	movzbl %al,%edx
+  801923:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801927:	0f b6 00             	movzbl (%rax),%eax
+  80192a:	0f b6 c0             	movzbl %al,%eax
+  80192d:	29 c2                	sub    %eax,%edx
+  80192f:	eb 20                	jmp    801951 <memcmp+0x84>
+		s1++, s2++;
+  801931:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801936:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  80193b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80193f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801943:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801947:	48 85 c0             	test   %rax,%rax
+  80194a:	75 bb                	jne    801907 <memcmp+0x3a>
+	}
+
+	return 0;
+  80194c:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801951:	89 d0                	mov    %edx,%eax
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+0000000000801955 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801955:	55                   	push   %rbp
+  801956:	48 89 e5             	mov    %rsp,%rbp
+  801959:	48 83 ec 28          	sub    $0x28,%rsp
+  80195d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80195d <memfind+0x8>
+  801964:	49 bb d3 66 00 00 00 	movabs $0x66d3,%r11
+  80196b:	00 00 00 
+  80196e:	4c 01 d8             	add    %r11,%rax
+  801971:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801975:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801978:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  80197c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801980:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801984:	48 01 d0             	add    %rdx,%rax
+  801987:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  80198b:	eb 13                	jmp    8019a0 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  80198d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801991:	0f b6 00             	movzbl (%rax),%eax
+  801994:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801997:	38 d0                	cmp    %dl,%al
+  801999:	74 11                	je     8019ac <memfind+0x57>
+	for (; s < ends; s++)
+  80199b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8019a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019a4:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8019a8:	72 e3                	jb     80198d <memfind+0x38>
+  8019aa:	eb 01                	jmp    8019ad <memfind+0x58>
+			break;
+  8019ac:	90                   	nop
+	return (void *) s;
+  8019ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8019b1:	c9                   	leave
+  8019b2:	c3                   	ret
+
+00000000008019b3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8019b3:	55                   	push   %rbp
+  8019b4:	48 89 e5             	mov    %rsp,%rbp
+  8019b7:	48 83 ec 38          	sub    $0x38,%rsp
+  8019bb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019bb <strtol+0x8>
+  8019c2:	49 bb 75 66 00 00 00 	movabs $0x6675,%r11
+  8019c9:	00 00 00 
+  8019cc:	4c 01 d8             	add    %r11,%rax
+  8019cf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019d3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8019d7:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  8019da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  8019e1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8019e8:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8019e9:	eb 05                	jmp    8019f0 <strtol+0x3d>
+		s++;
+  8019eb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  8019f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f4:	0f b6 00             	movzbl (%rax),%eax
+  8019f7:	3c 20                	cmp    $0x20,%al
+  8019f9:	74 f0                	je     8019eb <strtol+0x38>
+  8019fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ff:	0f b6 00             	movzbl (%rax),%eax
+  801a02:	3c 09                	cmp    $0x9,%al
+  801a04:	74 e5                	je     8019eb <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801a06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a0a:	0f b6 00             	movzbl (%rax),%eax
+  801a0d:	3c 2b                	cmp    $0x2b,%al
+  801a0f:	75 07                	jne    801a18 <strtol+0x65>
+		s++;
+  801a11:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a16:	eb 17                	jmp    801a2f <strtol+0x7c>
+	else if (*s == '-')
+  801a18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a1c:	0f b6 00             	movzbl (%rax),%eax
+  801a1f:	3c 2d                	cmp    $0x2d,%al
+  801a21:	75 0c                	jne    801a2f <strtol+0x7c>
+		s++, neg = 1;
+  801a23:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a28:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801a2f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a33:	74 06                	je     801a3b <strtol+0x88>
+  801a35:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801a39:	75 28                	jne    801a63 <strtol+0xb0>
+  801a3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a3f:	0f b6 00             	movzbl (%rax),%eax
+  801a42:	3c 30                	cmp    $0x30,%al
+  801a44:	75 1d                	jne    801a63 <strtol+0xb0>
+  801a46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a4a:	48 83 c0 01          	add    $0x1,%rax
+  801a4e:	0f b6 00             	movzbl (%rax),%eax
+  801a51:	3c 78                	cmp    $0x78,%al
+  801a53:	75 0e                	jne    801a63 <strtol+0xb0>
+		s += 2, base = 16;
+  801a55:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801a5a:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801a61:	eb 2c                	jmp    801a8f <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801a63:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a67:	75 19                	jne    801a82 <strtol+0xcf>
+  801a69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a6d:	0f b6 00             	movzbl (%rax),%eax
+  801a70:	3c 30                	cmp    $0x30,%al
+  801a72:	75 0e                	jne    801a82 <strtol+0xcf>
+		s++, base = 8;
+  801a74:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801a79:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801a80:	eb 0d                	jmp    801a8f <strtol+0xdc>
+	else if (base == 0)
+  801a82:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801a86:	75 07                	jne    801a8f <strtol+0xdc>
+		base = 10;
+  801a88:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801a8f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a93:	0f b6 00             	movzbl (%rax),%eax
+  801a96:	3c 2f                	cmp    $0x2f,%al
+  801a98:	7e 1d                	jle    801ab7 <strtol+0x104>
+  801a9a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a9e:	0f b6 00             	movzbl (%rax),%eax
+  801aa1:	3c 39                	cmp    $0x39,%al
+  801aa3:	7f 12                	jg     801ab7 <strtol+0x104>
+			dig = *s - '0';
+  801aa5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa9:	0f b6 00             	movzbl (%rax),%eax
+  801aac:	0f be c0             	movsbl %al,%eax
+  801aaf:	83 e8 30             	sub    $0x30,%eax
+  801ab2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ab5:	eb 4e                	jmp    801b05 <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801ab7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801abb:	0f b6 00             	movzbl (%rax),%eax
+  801abe:	3c 60                	cmp    $0x60,%al
+  801ac0:	7e 1d                	jle    801adf <strtol+0x12c>
+  801ac2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ac6:	0f b6 00             	movzbl (%rax),%eax
+  801ac9:	3c 7a                	cmp    $0x7a,%al
+  801acb:	7f 12                	jg     801adf <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801acd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad1:	0f b6 00             	movzbl (%rax),%eax
+  801ad4:	0f be c0             	movsbl %al,%eax
+  801ad7:	83 e8 57             	sub    $0x57,%eax
+  801ada:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801add:	eb 26                	jmp    801b05 <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801adf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae3:	0f b6 00             	movzbl (%rax),%eax
+  801ae6:	3c 40                	cmp    $0x40,%al
+  801ae8:	7e 47                	jle    801b31 <strtol+0x17e>
+  801aea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aee:	0f b6 00             	movzbl (%rax),%eax
+  801af1:	3c 5a                	cmp    $0x5a,%al
+  801af3:	7f 3c                	jg     801b31 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801af5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801af9:	0f b6 00             	movzbl (%rax),%eax
+  801afc:	0f be c0             	movsbl %al,%eax
+  801aff:	83 e8 37             	sub    $0x37,%eax
+  801b02:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801b05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b08:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801b0b:	7d 23                	jge    801b30 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801b0d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801b12:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801b15:	48 98                	cltq
+  801b17:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801b1c:	48 89 c2             	mov    %rax,%rdx
+  801b1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b22:	48 98                	cltq
+  801b24:	48 01 d0             	add    %rdx,%rax
+  801b27:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801b2b:	e9 5f ff ff ff       	jmp    801a8f <strtol+0xdc>
+			break;
+  801b30:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801b31:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801b36:	74 0b                	je     801b43 <strtol+0x190>
+		*endptr = (char *) s;
+  801b38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b3c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801b40:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801b43:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b47:	74 09                	je     801b52 <strtol+0x19f>
+  801b49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b4d:	48 f7 d8             	neg    %rax
+  801b50:	eb 04                	jmp    801b56 <strtol+0x1a3>
+  801b52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801b56:	c9                   	leave
+  801b57:	c3                   	ret
+
+0000000000801b58 <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801b58:	55                   	push   %rbp
+  801b59:	48 89 e5             	mov    %rsp,%rbp
+  801b5c:	53                   	push   %rbx
+  801b5d:	48 83 ec 30          	sub    $0x30,%rsp
+  801b61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801b61 <strstr+0x9>
+  801b68:	49 bb cf 64 00 00 00 	movabs $0x64cf,%r11
+  801b6f:	00 00 00 
+  801b72:	4c 01 db             	add    %r11,%rbx
+  801b75:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801b79:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801b7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b81:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b85:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b89:	0f b6 00             	movzbl (%rax),%eax
+  801b8c:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801b8f:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801b93:	75 06                	jne    801b9b <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801b95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b99:	eb 73                	jmp    801c0e <strstr+0xb6>
+
+	len = strlen(str);
+  801b9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b9f:	48 89 c7             	mov    %rax,%rdi
+  801ba2:	48 b8 b5 92 ff ff ff 	movabs $0xffffffffffff92b5,%rax
+  801ba9:	ff ff ff 
+  801bac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801bb0:	ff d0                	call   *%rax
+  801bb2:	48 98                	cltq
+  801bb4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801bb8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bbc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bc0:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801bc4:	0f b6 00             	movzbl (%rax),%eax
+  801bc7:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801bca:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801bce:	75 07                	jne    801bd7 <strstr+0x7f>
+				return (char *) 0;
+  801bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd5:	eb 37                	jmp    801c0e <strstr+0xb6>
+		} while (sc != c);
+  801bd7:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801bdb:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801bde:	75 d8                	jne    801bb8 <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801be0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801be4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801be8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bec:	48 89 ce             	mov    %rcx,%rsi
+  801bef:	48 89 c7             	mov    %rax,%rdi
+  801bf2:	48 b8 69 95 ff ff ff 	movabs $0xffffffffffff9569,%rax
+  801bf9:	ff ff ff 
+  801bfc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801c00:	ff d0                	call   *%rax
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	75 b2                	jne    801bb8 <strstr+0x60>
+
+	return (char *) (in - 1);
+  801c06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c0a:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801c0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c12:	c9                   	leave
+  801c13:	c3                   	ret
+
+0000000000801c14 <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801c14:	55                   	push   %rbp
+  801c15:	48 89 e5             	mov    %rsp,%rbp
+  801c18:	41 57                	push   %r15
+  801c1a:	53                   	push   %rbx
+  801c1b:	48 83 ec 40          	sub    $0x40,%rsp
+  801c1f:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801c1f <syscall+0xb>
+  801c26:	49 bb 11 64 00 00 00 	movabs $0x6411,%r11
+  801c2d:	00 00 00 
+  801c30:	4d 01 da             	add    %r11,%r10
+  801c33:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801c36:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801c39:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801c3d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801c41:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801c45:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801c49:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801c4c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801c50:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801c54:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801c58:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801c5c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801c60:	4c 89 c3             	mov    %r8,%rbx
+  801c63:	cd 30                	int    $0x30
+  801c65:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801c69:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801c6d:	74 52                	je     801cc1 <syscall+0xad>
+  801c6f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801c74:	7e 4b                	jle    801cc1 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801c76:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c7a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801c7d:	49 89 d0             	mov    %rdx,%r8
+  801c80:	89 c1                	mov    %eax,%ecx
+  801c82:	48 b8 f8 e4 ff ff ff 	movabs $0xffffffffffffe4f8,%rax
+  801c89:	ff ff ff 
+  801c8c:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801c90:	48 89 c2             	mov    %rax,%rdx
+  801c93:	be 23 00 00 00       	mov    $0x23,%esi
+  801c98:	48 b8 15 e5 ff ff ff 	movabs $0xffffffffffffe515,%rax
+  801c9f:	ff ff ff 
+  801ca2:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801ca6:	48 89 c7             	mov    %rax,%rdi
+  801ca9:	4d 89 d7             	mov    %r10,%r15
+  801cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb1:	49 b9 b7 d6 ff ff ff 	movabs $0xffffffffffffd6b7,%r9
+  801cb8:	ff ff ff 
+  801cbb:	4d 01 d1             	add    %r10,%r9
+  801cbe:	41 ff d1             	call   *%r9
+
+	return ret;
+  801cc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801cc5:	48 83 c4 40          	add    $0x40,%rsp
+  801cc9:	5b                   	pop    %rbx
+  801cca:	41 5f                	pop    %r15
+  801ccc:	5d                   	pop    %rbp
+  801ccd:	c3                   	ret
+
+0000000000801cce <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801cce:	55                   	push   %rbp
+  801ccf:	48 89 e5             	mov    %rsp,%rbp
+  801cd2:	41 57                	push   %r15
+  801cd4:	41 56                	push   %r14
+  801cd6:	41 55                	push   %r13
+  801cd8:	41 54                	push   %r12
+  801cda:	53                   	push   %rbx
+  801cdb:	48 83 ec 48          	sub    $0x48,%rsp
+  801cdf:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801cdf <syscall_words+0x11>
+  801ce6:	49 bb 51 63 00 00 00 	movabs $0x6351,%r11
+  801ced:	00 00 00 
+  801cf0:	4d 01 de             	add    %r11,%r14
+  801cf3:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801cf6:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801cf9:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801cfd:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801d01:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801d05:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801d09:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d0e:	74 09                	je     801d19 <syscall_words+0x4b>
+  801d10:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d14:	48 8b 00             	mov    (%rax),%rax
+  801d17:	eb 05                	jmp    801d1e <syscall_words+0x50>
+  801d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1e:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801d21:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d26:	74 0a                	je     801d32 <syscall_words+0x64>
+  801d28:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d2c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801d30:	eb 05                	jmp    801d37 <syscall_words+0x69>
+  801d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d37:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801d3a:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d3f:	74 0a                	je     801d4b <syscall_words+0x7d>
+  801d41:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d45:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d49:	eb 05                	jmp    801d50 <syscall_words+0x82>
+  801d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d50:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801d53:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d58:	74 0a                	je     801d64 <syscall_words+0x96>
+  801d5a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d5e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d62:	eb 05                	jmp    801d69 <syscall_words+0x9b>
+  801d64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d69:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801d6c:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d71:	74 0a                	je     801d7d <syscall_words+0xaf>
+  801d73:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d77:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d7b:	eb 05                	jmp    801d82 <syscall_words+0xb4>
+  801d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d82:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801d85:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801d8a:	74 0a                	je     801d96 <syscall_words+0xc8>
+  801d8c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801d90:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801d94:	eb 05                	jmp    801d9b <syscall_words+0xcd>
+  801d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9b:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801d9e:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801da1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801da5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801da9:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801dad:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801db1:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801db5:	cd 30                	int    $0x30
+  801db7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801dbb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801dc0:	74 50                	je     801e12 <syscall_words+0x144>
+		words[0] = r8;
+  801dc2:	4c 89 c2             	mov    %r8,%rdx
+  801dc5:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dc9:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801dcc:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dd0:	48 83 c0 08          	add    $0x8,%rax
+  801dd4:	4c 89 ca             	mov    %r9,%rdx
+  801dd7:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801dda:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dde:	48 83 c0 10          	add    $0x10,%rax
+  801de2:	4c 89 d2             	mov    %r10,%rdx
+  801de5:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801de8:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dec:	48 83 c0 18          	add    $0x18,%rax
+  801df0:	4c 89 da             	mov    %r11,%rdx
+  801df3:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801df6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801dfa:	48 83 c0 20          	add    $0x20,%rax
+  801dfe:	4c 89 e2             	mov    %r12,%rdx
+  801e01:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801e04:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801e08:	48 83 c0 28          	add    $0x28,%rax
+  801e0c:	4c 89 ea             	mov    %r13,%rdx
+  801e0f:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801e12:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801e16:	74 52                	je     801e6a <syscall_words+0x19c>
+  801e18:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801e1d:	7e 4b                	jle    801e6a <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e1f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e23:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801e26:	49 89 d0             	mov    %rdx,%r8
+  801e29:	89 c1                	mov    %eax,%ecx
+  801e2b:	48 b8 f8 e4 ff ff ff 	movabs $0xffffffffffffe4f8,%rax
+  801e32:	ff ff ff 
+  801e35:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801e39:	48 89 c2             	mov    %rax,%rdx
+  801e3c:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801e41:	48 b8 15 e5 ff ff ff 	movabs $0xffffffffffffe515,%rax
+  801e48:	ff ff ff 
+  801e4b:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801e4f:	48 89 c7             	mov    %rax,%rdi
+  801e52:	4d 89 f7             	mov    %r14,%r15
+  801e55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5a:	49 b9 b7 d6 ff ff ff 	movabs $0xffffffffffffd6b7,%r9
+  801e61:	ff ff ff 
+  801e64:	4d 01 f1             	add    %r14,%r9
+  801e67:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801e6e:	48 83 c4 48          	add    $0x48,%rsp
+  801e72:	5b                   	pop    %rbx
+  801e73:	41 5c                	pop    %r12
+  801e75:	41 5d                	pop    %r13
+  801e77:	41 5e                	pop    %r14
+  801e79:	41 5f                	pop    %r15
+  801e7b:	5d                   	pop    %rbp
+  801e7c:	c3                   	ret
+
+0000000000801e7d <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801e7d:	55                   	push   %rbp
+  801e7e:	48 89 e5             	mov    %rsp,%rbp
+  801e81:	48 83 ec 10          	sub    $0x10,%rsp
+  801e85:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801e85 <sys_cputs+0x8>
+  801e8c:	49 bb ab 61 00 00 00 	movabs $0x61ab,%r11
+  801e93:	00 00 00 
+  801e96:	4c 01 d8             	add    %r11,%rax
+  801e99:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e9d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801ea1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ea5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ea9:	48 83 ec 08          	sub    $0x8,%rsp
+  801ead:	6a 00                	push   $0x0
+  801eaf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801eb5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ebb:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec5:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  801ecc:	ff ff ff 
+  801ecf:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801ed3:	ff d0                	call   *%rax
+  801ed5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ed9:	90                   	nop
+  801eda:	c9                   	leave
+  801edb:	c3                   	ret
+
+0000000000801edc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801edc:	55                   	push   %rbp
+  801edd:	48 89 e5             	mov    %rsp,%rbp
+  801ee0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ee0 <sys_cgetc+0x4>
+  801ee7:	49 bb 50 61 00 00 00 	movabs $0x6150,%r11
+  801eee:	00 00 00 
+  801ef1:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801ef4:	48 83 ec 08          	sub    $0x8,%rsp
+  801ef8:	6a 00                	push   $0x0
+  801efa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f10:	be 00 00 00 00       	mov    $0x0,%esi
+  801f15:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f1a:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  801f21:	ff ff ff 
+  801f24:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f28:	ff d0                	call   *%rax
+  801f2a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f2e:	c9                   	leave
+  801f2f:	c3                   	ret
+
+0000000000801f30 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801f30:	55                   	push   %rbp
+  801f31:	48 89 e5             	mov    %rsp,%rbp
+  801f34:	48 83 ec 10          	sub    $0x10,%rsp
+  801f38:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f38 <sys_env_destroy+0x8>
+  801f3f:	49 bb f8 60 00 00 00 	movabs $0x60f8,%r11
+  801f46:	00 00 00 
+  801f49:	4c 01 d8             	add    %r11,%rax
+  801f4c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801f4f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801f52:	48 63 d2             	movslq %edx,%rdx
+  801f55:	48 83 ec 08          	sub    $0x8,%rsp
+  801f59:	6a 00                	push   $0x0
+  801f5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f6c:	be 01 00 00 00       	mov    $0x1,%esi
+  801f71:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f76:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  801f7d:	ff ff ff 
+  801f80:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801f84:	ff d0                	call   *%rax
+  801f86:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f8a:	c9                   	leave
+  801f8b:	c3                   	ret
+
+0000000000801f8c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801f8c:	55                   	push   %rbp
+  801f8d:	48 89 e5             	mov    %rsp,%rbp
+  801f90:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801f90 <sys_getenvid+0x4>
+  801f97:	49 bb a0 60 00 00 00 	movabs $0x60a0,%r11
+  801f9e:	00 00 00 
+  801fa1:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  801fa4:	48 83 ec 08          	sub    $0x8,%rsp
+  801fa8:	6a 00                	push   $0x0
+  801faa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801fb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc0:	be 00 00 00 00       	mov    $0x0,%esi
+  801fc5:	bf 02 00 00 00       	mov    $0x2,%edi
+  801fca:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  801fd1:	ff ff ff 
+  801fd4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  801fd8:	ff d0                	call   *%rax
+  801fda:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801fde:	c9                   	leave
+  801fdf:	c3                   	ret
+
+0000000000801fe0 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801fe0:	55                   	push   %rbp
+  801fe1:	48 89 e5             	mov    %rsp,%rbp
+  801fe4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801fe4 <sys_yield+0x4>
+  801feb:	49 bb 4c 60 00 00 00 	movabs $0x604c,%r11
+  801ff2:	00 00 00 
+  801ff5:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  801ff8:	48 83 ec 08          	sub    $0x8,%rsp
+  801ffc:	6a 00                	push   $0x0
+  801ffe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802004:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80200a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80200f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802014:	be 00 00 00 00       	mov    $0x0,%esi
+  802019:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80201e:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  802025:	ff ff ff 
+  802028:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80202c:	ff d0                	call   *%rax
+  80202e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802032:	90                   	nop
+  802033:	c9                   	leave
+  802034:	c3                   	ret
+
+0000000000802035 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  802035:	55                   	push   %rbp
+  802036:	48 89 e5             	mov    %rsp,%rbp
+  802039:	48 83 ec 10          	sub    $0x10,%rsp
+  80203d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80203d <sys_page_alloc+0x8>
+  802044:	49 bb f3 5f 00 00 00 	movabs $0x5ff3,%r11
+  80204b:	00 00 00 
+  80204e:	4c 01 d8             	add    %r11,%rax
+  802051:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802054:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802058:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  80205b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80205e:	48 63 f2             	movslq %edx,%rsi
+  802061:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802065:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802068:	48 63 d2             	movslq %edx,%rdx
+  80206b:	48 83 ec 08          	sub    $0x8,%rsp
+  80206f:	6a 00                	push   $0x0
+  802071:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802077:	49 89 f0             	mov    %rsi,%r8
+  80207a:	be 01 00 00 00       	mov    $0x1,%esi
+  80207f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802084:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  80208b:	ff ff ff 
+  80208e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802092:	ff d0                	call   *%rax
+  802094:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802098:	c9                   	leave
+  802099:	c3                   	ret
+
+000000000080209a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80209a:	55                   	push   %rbp
+  80209b:	48 89 e5             	mov    %rsp,%rbp
+  80209e:	48 83 ec 20          	sub    $0x20,%rsp
+  8020a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020a2 <sys_page_map+0x8>
+  8020a9:	49 bb 8e 5f 00 00 00 	movabs $0x5f8e,%r11
+  8020b0:	00 00 00 
+  8020b3:	4c 01 d8             	add    %r11,%rax
+  8020b6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020b9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020bd:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8020c0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020c4:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8020c8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8020cb:	48 63 f2             	movslq %edx,%rsi
+  8020ce:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  8020d2:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8020d5:	48 63 fa             	movslq %edx,%rdi
+  8020d8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020dc:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8020df:	48 63 d2             	movslq %edx,%rdx
+  8020e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e6:	56                   	push   %rsi
+  8020e7:	4d 89 c1             	mov    %r8,%r9
+  8020ea:	49 89 f8             	mov    %rdi,%r8
+  8020ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8020f2:	bf 05 00 00 00       	mov    $0x5,%edi
+  8020f7:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  8020fe:	ff ff ff 
+  802101:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802105:	ff d0                	call   *%rax
+  802107:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80210b:	c9                   	leave
+  80210c:	c3                   	ret
+
+000000000080210d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80210d:	55                   	push   %rbp
+  80210e:	48 89 e5             	mov    %rsp,%rbp
+  802111:	48 83 ec 10          	sub    $0x10,%rsp
+  802115:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802115 <sys_page_unmap+0x8>
+  80211c:	49 bb 1b 5f 00 00 00 	movabs $0x5f1b,%r11
+  802123:	00 00 00 
+  802126:	4c 01 d8             	add    %r11,%rax
+  802129:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80212c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802130:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802134:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802137:	48 63 d2             	movslq %edx,%rdx
+  80213a:	48 83 ec 08          	sub    $0x8,%rsp
+  80213e:	6a 00                	push   $0x0
+  802140:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802146:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80214c:	be 01 00 00 00       	mov    $0x1,%esi
+  802151:	bf 06 00 00 00       	mov    $0x6,%edi
+  802156:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  80215d:	ff ff ff 
+  802160:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802164:	ff d0                	call   *%rax
+  802166:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80216a:	c9                   	leave
+  80216b:	c3                   	ret
+
+000000000080216c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80216c:	55                   	push   %rbp
+  80216d:	48 89 e5             	mov    %rsp,%rbp
+  802170:	48 83 ec 10          	sub    $0x10,%rsp
+  802174:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802174 <sys_env_set_status+0x8>
+  80217b:	49 bb bc 5e 00 00 00 	movabs $0x5ebc,%r11
+  802182:	00 00 00 
+  802185:	4c 01 d8             	add    %r11,%rax
+  802188:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80218b:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80218e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802191:	48 63 ca             	movslq %edx,%rcx
+  802194:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802197:	48 63 d2             	movslq %edx,%rdx
+  80219a:	48 83 ec 08          	sub    $0x8,%rsp
+  80219e:	6a 00                	push   $0x0
+  8021a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021ac:	be 01 00 00 00       	mov    $0x1,%esi
+  8021b1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021b6:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  8021bd:	ff ff ff 
+  8021c0:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021c4:	ff d0                	call   *%rax
+  8021c6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021ca:	c9                   	leave
+  8021cb:	c3                   	ret
+
+00000000008021cc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8021cc:	55                   	push   %rbp
+  8021cd:	48 89 e5             	mov    %rsp,%rbp
+  8021d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021d4 <sys_env_set_trapframe+0x8>
+  8021db:	49 bb 5c 5e 00 00 00 	movabs $0x5e5c,%r11
+  8021e2:	00 00 00 
+  8021e5:	4c 01 d8             	add    %r11,%rax
+  8021e8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021eb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8021ef:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8021f3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021f6:	48 63 d2             	movslq %edx,%rdx
+  8021f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8021fd:	6a 00                	push   $0x0
+  8021ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802205:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80220b:	be 01 00 00 00       	mov    $0x1,%esi
+  802210:	bf 09 00 00 00       	mov    $0x9,%edi
+  802215:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  80221c:	ff ff ff 
+  80221f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802223:	ff d0                	call   *%rax
+  802225:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802229:	c9                   	leave
+  80222a:	c3                   	ret
+
+000000000080222b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80222b:	55                   	push   %rbp
+  80222c:	48 89 e5             	mov    %rsp,%rbp
+  80222f:	48 83 ec 10          	sub    $0x10,%rsp
+  802233:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802233 <sys_env_set_pgfault_upcall+0x8>
+  80223a:	49 bb fd 5d 00 00 00 	movabs $0x5dfd,%r11
+  802241:	00 00 00 
+  802244:	4c 01 d8             	add    %r11,%rax
+  802247:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80224a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  80224e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802252:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802255:	48 63 d2             	movslq %edx,%rdx
+  802258:	48 83 ec 08          	sub    $0x8,%rsp
+  80225c:	6a 00                	push   $0x0
+  80225e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80226a:	be 01 00 00 00       	mov    $0x1,%esi
+  80226f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802274:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  80227b:	ff ff ff 
+  80227e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802282:	ff d0                	call   *%rax
+  802284:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802288:	c9                   	leave
+  802289:	c3                   	ret
+
+000000000080228a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80228a:	55                   	push   %rbp
+  80228b:	48 89 e5             	mov    %rsp,%rbp
+  80228e:	48 83 ec 20          	sub    $0x20,%rsp
+  802292:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802292 <sys_ipc_try_send+0x8>
+  802299:	49 bb 9e 5d 00 00 00 	movabs $0x5d9e,%r11
+  8022a0:	00 00 00 
+  8022a3:	4c 01 d8             	add    %r11,%rax
+  8022a6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022a9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022ad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8022b1:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8022b4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022b7:	48 63 fa             	movslq %edx,%rdi
+  8022ba:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8022be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022c1:	48 63 d2             	movslq %edx,%rdx
+  8022c4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8022cc:	6a 00                	push   $0x0
+  8022ce:	49 89 f9             	mov    %rdi,%r9
+  8022d1:	49 89 f0             	mov    %rsi,%r8
+  8022d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8022d9:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8022de:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  8022e5:	ff ff ff 
+  8022e8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022ec:	ff d0                	call   *%rax
+  8022ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022f2:	c9                   	leave
+  8022f3:	c3                   	ret
+
+00000000008022f4 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8022f4:	55                   	push   %rbp
+  8022f5:	48 89 e5             	mov    %rsp,%rbp
+  8022f8:	48 83 ec 20          	sub    $0x20,%rsp
+  8022fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022fc <sys_ipc_send+0x8>
+  802303:	49 bb 34 5d 00 00 00 	movabs $0x5d34,%r11
+  80230a:	00 00 00 
+  80230d:	4c 01 d8             	add    %r11,%rax
+  802310:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802313:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802317:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80231b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80231e:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802321:	48 63 fa             	movslq %edx,%rdi
+  802324:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802328:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80232b:	48 63 d2             	movslq %edx,%rdx
+  80232e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802332:	48 83 ec 08          	sub    $0x8,%rsp
+  802336:	6a 00                	push   $0x0
+  802338:	49 89 f9             	mov    %rdi,%r9
+  80233b:	49 89 f0             	mov    %rsi,%r8
+  80233e:	be 00 00 00 00       	mov    $0x0,%esi
+  802343:	bf 17 00 00 00       	mov    $0x17,%edi
+  802348:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  80234f:	ff ff ff 
+  802352:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802356:	ff d0                	call   *%rax
+  802358:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80235c:	c9                   	leave
+  80235d:	c3                   	ret
+
+000000000080235e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80235e:	55                   	push   %rbp
+  80235f:	48 89 e5             	mov    %rsp,%rbp
+  802362:	48 83 ec 10          	sub    $0x10,%rsp
+  802366:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802366 <sys_ipc_recv+0x8>
+  80236d:	49 bb ca 5c 00 00 00 	movabs $0x5cca,%r11
+  802374:	00 00 00 
+  802377:	4c 01 d8             	add    %r11,%rax
+  80237a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  80237e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802382:	6a 00                	push   $0x0
+  802384:	6a 00                	push   $0x0
+  802386:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80238c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802392:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802397:	be 01 00 00 00       	mov    $0x1,%esi
+  80239c:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8023a1:	49 ba 9e 9c ff ff ff 	movabs $0xffffffffffff9c9e,%r10
+  8023a8:	ff ff ff 
+  8023ab:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023af:	ff d0                	call   *%rax
+  8023b1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023b5:	c9                   	leave
+  8023b6:	c3                   	ret
+
+00000000008023b7 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8023b7:	55                   	push   %rbp
+  8023b8:	48 89 e5             	mov    %rsp,%rbp
+  8023bb:	48 83 ec 30          	sub    $0x30,%rsp
+  8023bf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023bf <sys_ipc_call+0x8>
+  8023c6:	49 bb 71 5c 00 00 00 	movabs $0x5c71,%r11
+  8023cd:	00 00 00 
+  8023d0:	4c 01 d8             	add    %r11,%rax
+  8023d3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023da:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8023de:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8023e1:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8023e5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  8023e9:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8023ed:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023f0:	4c 63 c2             	movslq %edx,%r8
+  8023f3:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8023f7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023fa:	48 63 d2             	movslq %edx,%rdx
+  8023fd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802401:	ff 75 d8             	push   -0x28(%rbp)
+  802404:	56                   	push   %rsi
+  802405:	4d 89 c1             	mov    %r8,%r9
+  802408:	49 89 f8             	mov    %rdi,%r8
+  80240b:	be 00 00 00 00       	mov    $0x0,%esi
+  802410:	bf 18 00 00 00       	mov    $0x18,%edi
+  802415:	49 ba 9e 9c ff ff ff 	movabs $0xffffffffffff9c9e,%r10
+  80241c:	ff ff ff 
+  80241f:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802423:	ff d0                	call   *%rax
+  802425:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  802429:	c9                   	leave
+  80242a:	c3                   	ret
+
+000000000080242b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  80242b:	55                   	push   %rbp
+  80242c:	48 89 e5             	mov    %rsp,%rbp
+  80242f:	48 83 ec 30          	sub    $0x30,%rsp
+  802433:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802433 <sys_ipc_reply_recv+0x8>
+  80243a:	49 bb fd 5b 00 00 00 	movabs $0x5bfd,%r11
+  802441:	00 00 00 
+  802444:	4c 01 d8             	add    %r11,%rax
+  802447:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80244a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80244e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802452:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802455:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  802459:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  80245d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802461:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802464:	4c 63 c2             	movslq %edx,%r8
+  802467:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80246b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80246e:	48 63 d2             	movslq %edx,%rdx
+  802471:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802475:	ff 75 d8             	push   -0x28(%rbp)
+  802478:	56                   	push   %rsi
+  802479:	4d 89 c1             	mov    %r8,%r9
+  80247c:	49 89 f8             	mov    %rdi,%r8
+  80247f:	be 00 00 00 00       	mov    $0x0,%esi
+  802484:	bf 19 00 00 00       	mov    $0x19,%edi
+  802489:	49 ba 9e 9c ff ff ff 	movabs $0xffffffffffff9c9e,%r10
+  802490:	ff ff ff 
+  802493:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802497:	ff d0                	call   *%rax
+  802499:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  80249d:	c9                   	leave
+  80249e:	c3                   	ret
+
+000000000080249f <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  80249f:	55                   	push   %rbp
+  8024a0:	48 89 e5             	mov    %rsp,%rbp
+  8024a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024a7 <sys_env_set_priority+0x8>
+  8024ae:	49 bb 89 5b 00 00 00 	movabs $0x5b89,%r11
+  8024b5:	00 00 00 
+  8024b8:	4c 01 d8             	add    %r11,%rax
+  8024bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024be:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8024c1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024c4:	48 63 ca             	movslq %edx,%rcx
+  8024c7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024ca:	48 63 d2             	movslq %edx,%rdx
+  8024cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8024d1:	6a 00                	push   $0x0
+  8024d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024df:	be 01 00 00 00       	mov    $0x1,%esi
+  8024e4:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8024e9:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  8024f0:	ff ff ff 
+  8024f3:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024f7:	ff d0                	call   *%rax
+  8024f9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024fd:	c9                   	leave
+  8024fe:	c3                   	ret
+
+00000000008024ff <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8024ff:	55                   	push   %rbp
+  802500:	48 89 e5             	mov    %rsp,%rbp
+  802503:	48 83 ec 10          	sub    $0x10,%rsp
+  802507:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802507 <sys_env_set_affinity+0x8>
+  80250e:	49 bb 29 5b 00 00 00 	movabs $0x5b29,%r11
+  802515:	00 00 00 
+  802518:	4c 01 d8             	add    %r11,%rax
+  80251b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80251e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802521:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  802524:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802527:	48 63 d2             	movslq %edx,%rdx
+  80252a:	48 83 ec 08          	sub    $0x8,%rsp
+  80252e:	6a 00                	push   $0x0
+  802530:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80253c:	be 01 00 00 00       	mov    $0x1,%esi
+  802541:	bf 10 00 00 00       	mov    $0x10,%edi
+  802546:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  80254d:	ff ff ff 
+  802550:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802554:	ff d0                	call   *%rax
+  802556:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80255a:	c9                   	leave
+  80255b:	c3                   	ret
+
+000000000080255c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80255c:	55                   	push   %rbp
+  80255d:	48 89 e5             	mov    %rsp,%rbp
+  802560:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802560 <sys_time_msec+0x4>
+  802567:	49 bb d0 5a 00 00 00 	movabs $0x5ad0,%r11
+  80256e:	00 00 00 
+  802571:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  802574:	48 83 ec 08          	sub    $0x8,%rsp
+  802578:	6a 00                	push   $0x0
+  80257a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802580:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802586:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80258b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802590:	be 00 00 00 00       	mov    $0x0,%esi
+  802595:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80259a:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  8025a1:	ff ff ff 
+  8025a4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025a8:	ff d0                	call   *%rax
+  8025aa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ae:	c9                   	leave
+  8025af:	c3                   	ret
+
+00000000008025b0 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8025b0:	55                   	push   %rbp
+  8025b1:	48 89 e5             	mov    %rsp,%rbp
+  8025b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025b8 <sys_sleep_usec+0x8>
+  8025bf:	49 bb 78 5a 00 00 00 	movabs $0x5a78,%r11
+  8025c6:	00 00 00 
+  8025c9:	4c 01 d8             	add    %r11,%rax
+  8025cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  8025d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d8:	6a 00                	push   $0x0
+  8025da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f0:	bf 11 00 00 00       	mov    $0x11,%edi
+  8025f5:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  8025fc:	ff ff ff 
+  8025ff:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802603:	ff d0                	call   *%rax
+  802605:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802609:	c9                   	leave
+  80260a:	c3                   	ret
+
+000000000080260b <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  80260b:	55                   	push   %rbp
+  80260c:	48 89 e5             	mov    %rsp,%rbp
+  80260f:	48 83 ec 10          	sub    $0x10,%rsp
+  802613:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802613 <sys_page_alloc_huge+0x8>
+  80261a:	49 bb 1d 5a 00 00 00 	movabs $0x5a1d,%r11
+  802621:	00 00 00 
+  802624:	4c 01 d8             	add    %r11,%rax
+  802627:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80262a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80262e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802631:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802634:	48 63 f2             	movslq %edx,%rsi
+  802637:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80263b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80263e:	48 63 d2             	movslq %edx,%rdx
+  802641:	48 83 ec 08          	sub    $0x8,%rsp
+  802645:	6a 00                	push   $0x0
+  802647:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80264d:	49 89 f0             	mov    %rsi,%r8
+  802650:	be 01 00 00 00       	mov    $0x1,%esi
+  802655:	bf 12 00 00 00       	mov    $0x12,%edi
+  80265a:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  802661:	ff ff ff 
+  802664:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802668:	ff d0                	call   *%rax
+  80266a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80266e:	c9                   	leave
+  80266f:	c3                   	ret
+
+0000000000802670 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802670:	55                   	push   %rbp
+  802671:	48 89 e5             	mov    %rsp,%rbp
+  802674:	48 83 ec 10          	sub    $0x10,%rsp
+  802678:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802678 <sys_page_map_batch+0x8>
+  80267f:	49 bb b8 59 00 00 00 	movabs $0x59b8,%r11
+  802686:	00 00 00 
+  802689:	4c 01 d8             	add    %r11,%rax
+  80268c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802690:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802694:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802698:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80269c:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a0:	6a 00                	push   $0x0
+  8026a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8026b3:	bf 13 00 00 00       	mov    $0x13,%edi
+  8026b8:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  8026bf:	ff ff ff 
+  8026c2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026c6:	ff d0                	call   *%rax
+  8026c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026cc:	c9                   	leave
+  8026cd:	c3                   	ret
+
+00000000008026ce <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  8026ce:	55                   	push   %rbp
+  8026cf:	48 89 e5             	mov    %rsp,%rbp
+  8026d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8026d6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026d6 <sys_page_alloc_batch+0x8>
+  8026dd:	49 bb 5a 59 00 00 00 	movabs $0x595a,%r11
+  8026e4:	00 00 00 
+  8026e7:	4c 01 d8             	add    %r11,%rax
+  8026ea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026ee:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8026f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026f6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8026fe:	6a 00                	push   $0x0
+  802700:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802706:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80270c:	be 01 00 00 00       	mov    $0x1,%esi
+  802711:	bf 14 00 00 00       	mov    $0x14,%edi
+  802716:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  80271d:	ff ff ff 
+  802720:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802724:	ff d0                	call   *%rax
+  802726:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80272a:	c9                   	leave
+  80272b:	c3                   	ret
+
+000000000080272c <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  80272c:	55                   	push   %rbp
+  80272d:	48 89 e5             	mov    %rsp,%rbp
+  802730:	48 83 ec 10          	sub    $0x10,%rsp
+  802734:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802734 <sys_page_unmap_batch+0x8>
+  80273b:	49 bb fc 58 00 00 00 	movabs $0x58fc,%r11
+  802742:	00 00 00 
+  802745:	4c 01 d8             	add    %r11,%rax
+  802748:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80274c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802750:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802754:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802758:	48 83 ec 08          	sub    $0x8,%rsp
+  80275c:	6a 00                	push   $0x0
+  80275e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802764:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80276a:	be 01 00 00 00       	mov    $0x1,%esi
+  80276f:	bf 15 00 00 00       	mov    $0x15,%edi
+  802774:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  80277b:	ff ff ff 
+  80277e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802782:	ff d0                	call   *%rax
+  802784:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802788:	c9                   	leave
+  802789:	c3                   	ret
+
+000000000080278a <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  80278a:	55                   	push   %rbp
+  80278b:	48 89 e5             	mov    %rsp,%rbp
+  80278e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80278e <sys_fork+0x4>
+  802795:	49 bb a2 58 00 00 00 	movabs $0x58a2,%r11
+  80279c:	00 00 00 
+  80279f:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8027a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a6:	6a 00                	push   $0x0
+  8027a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027be:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c3:	bf 16 00 00 00       	mov    $0x16,%edi
+  8027c8:	49 ba e4 9b ff ff ff 	movabs $0xffffffffffff9be4,%r10
+  8027cf:	ff ff ff 
+  8027d2:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027d6:	ff d0                	call   *%rax
+  8027d8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027dc:	c9                   	leave
+  8027dd:	c3                   	ret
+
+00000000008027de <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  8027de:	55                   	push   %rbp
+  8027df:	48 89 e5             	mov    %rsp,%rbp
+  8027e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027e6 <fd2num+0x8>
+  8027ed:	49 bb 4a 58 00 00 00 	movabs $0x584a,%r11
+  8027f4:	00 00 00 
+  8027f7:	4c 01 d8             	add    %r11,%rax
+  8027fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8027fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802802:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802809:	ff ff ff 
+  80280c:	48 01 d0             	add    %rdx,%rax
+  80280f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802813:	c9                   	leave
+  802814:	c3                   	ret
+
+0000000000802815 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802815:	55                   	push   %rbp
+  802816:	48 89 e5             	mov    %rsp,%rbp
+  802819:	48 83 ec 08          	sub    $0x8,%rsp
+  80281d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80281d <fd2data+0x8>
+  802824:	49 bb 13 58 00 00 00 	movabs $0x5813,%r11
+  80282b:	00 00 00 
+  80282e:	4c 01 d8             	add    %r11,%rax
+  802831:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  802835:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802839:	48 89 d7             	mov    %rdx,%rdi
+  80283c:	48 ba ae a7 ff ff ff 	movabs $0xffffffffffffa7ae,%rdx
+  802843:	ff ff ff 
+  802846:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80284a:	ff d0                	call   *%rax
+  80284c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802852:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802856:	c9                   	leave
+  802857:	c3                   	ret
+
+0000000000802858 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802858:	55                   	push   %rbp
+  802859:	48 89 e5             	mov    %rsp,%rbp
+  80285c:	48 83 ec 18          	sub    $0x18,%rsp
+  802860:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802860 <fd_alloc+0x8>
+  802867:	49 bb d0 57 00 00 00 	movabs $0x57d0,%r11
+  80286e:	00 00 00 
+  802871:	4c 01 d8             	add    %r11,%rax
+  802874:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  802878:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80287f:	eb 75                	jmp    8028f6 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  802881:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802884:	48 63 d2             	movslq %edx,%rdx
+  802887:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  80288e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802892:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802896:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80289a:	48 89 d1             	mov    %rdx,%rcx
+  80289d:	48 c1 e9 15          	shr    $0x15,%rcx
+  8028a1:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8028a8:	ff ff ff 
+  8028ab:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8028af:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8028b3:	83 e2 01             	and    $0x1,%edx
+  8028b6:	48 85 d2             	test   %rdx,%rdx
+  8028b9:	74 25                	je     8028e0 <fd_alloc+0x88>
+  8028bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028bf:	48 89 d1             	mov    %rdx,%rcx
+  8028c2:	48 c1 e9 0c          	shr    $0xc,%rcx
+  8028c6:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8028cd:	ff ff ff 
+  8028d0:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8028d4:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8028d8:	83 e2 01             	and    $0x1,%edx
+  8028db:	48 85 d2             	test   %rdx,%rdx
+  8028de:	75 12                	jne    8028f2 <fd_alloc+0x9a>
+			*fd_store = fd;
+  8028e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8028e4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028e8:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8028eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f0:	eb 1a                	jmp    80290c <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  8028f2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8028f6:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8028fa:	7e 85                	jle    802881 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  8028fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802900:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  802907:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  80290c:	c9                   	leave
+  80290d:	c3                   	ret
+
+000000000080290e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80290e:	55                   	push   %rbp
+  80290f:	48 89 e5             	mov    %rsp,%rbp
+  802912:	48 83 ec 20          	sub    $0x20,%rsp
+  802916:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802916 <fd_lookup+0x8>
+  80291d:	49 bb 1a 57 00 00 00 	movabs $0x571a,%r11
+  802924:	00 00 00 
+  802927:	4c 01 d8             	add    %r11,%rax
+  80292a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80292d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  802931:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802935:	78 06                	js     80293d <fd_lookup+0x2f>
+  802937:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80293b:	7e 07                	jle    802944 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80293d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802942:	eb 73                	jmp    8029b7 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  802944:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802947:	48 63 d2             	movslq %edx,%rdx
+  80294a:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  802951:	48 c1 e2 0c          	shl    $0xc,%rdx
+  802955:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802959:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80295d:	48 89 d1             	mov    %rdx,%rcx
+  802960:	48 c1 e9 15          	shr    $0x15,%rcx
+  802964:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80296b:	ff ff ff 
+  80296e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  802972:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  802976:	83 e2 01             	and    $0x1,%edx
+  802979:	48 85 d2             	test   %rdx,%rdx
+  80297c:	74 22                	je     8029a0 <fd_lookup+0x92>
+  80297e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802982:	48 c1 ea 0c          	shr    $0xc,%rdx
+  802986:	48 b9 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rcx
+  80298d:	ff ff ff 
+  802990:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  802994:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802998:	83 e0 01             	and    $0x1,%eax
+  80299b:	48 85 c0             	test   %rax,%rax
+  80299e:	75 07                	jne    8029a7 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8029a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a5:	eb 10                	jmp    8029b7 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8029a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8029ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029af:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8029b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029b7:	c9                   	leave
+  8029b8:	c3                   	ret
+
+00000000008029b9 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8029b9:	55                   	push   %rbp
+  8029ba:	48 89 e5             	mov    %rsp,%rbp
+  8029bd:	41 57                	push   %r15
+  8029bf:	53                   	push   %rbx
+  8029c0:	48 83 ec 30          	sub    $0x30,%rsp
+  8029c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8029c4 <fd_close+0xb>
+  8029cb:	49 bb 6c 56 00 00 00 	movabs $0x566c,%r11
+  8029d2:	00 00 00 
+  8029d5:	4c 01 db             	add    %r11,%rbx
+  8029d8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8029dc:	89 f0                	mov    %esi,%eax
+  8029de:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8029e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029e5:	48 89 c7             	mov    %rax,%rdi
+  8029e8:	48 b8 ae a7 ff ff ff 	movabs $0xffffffffffffa7ae,%rax
+  8029ef:	ff ff ff 
+  8029f2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8029f6:	ff d0                	call   *%rax
+  8029f8:	89 c2                	mov    %eax,%edx
+  8029fa:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8029fe:	48 89 c6             	mov    %rax,%rsi
+  802a01:	89 d7                	mov    %edx,%edi
+  802a03:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  802a0a:	ff ff ff 
+  802a0d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a11:	ff d0                	call   *%rax
+  802a13:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802a16:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a1a:	78 0a                	js     802a26 <fd_close+0x6d>
+	    || fd != fd2)
+  802a1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a20:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  802a24:	74 12                	je     802a38 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  802a26:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802a2a:	74 05                	je     802a31 <fd_close+0x78>
+  802a2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a2f:	eb 7a                	jmp    802aab <fd_close+0xf2>
+  802a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a36:	eb 73                	jmp    802aab <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802a38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a3c:	8b 00                	mov    (%rax),%eax
+  802a3e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802a42:	48 89 d6             	mov    %rdx,%rsi
+  802a45:	89 c7                	mov    %eax,%edi
+  802a47:	48 b8 84 aa ff ff ff 	movabs $0xffffffffffffaa84,%rax
+  802a4e:	ff ff ff 
+  802a51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a55:	ff d0                	call   *%rax
+  802a57:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802a5a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802a5e:	78 2a                	js     802a8a <fd_close+0xd1>
+		if (dev->dev_close)
+  802a60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a64:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802a68:	48 85 c0             	test   %rax,%rax
+  802a6b:	74 16                	je     802a83 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  802a6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a71:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802a75:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a79:	48 89 c7             	mov    %rax,%rdi
+  802a7c:	ff d2                	call   *%rdx
+  802a7e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802a81:	eb 07                	jmp    802a8a <fd_close+0xd1>
+		else
+			r = 0;
+  802a83:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  802a8a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a8e:	48 89 c6             	mov    %rax,%rsi
+  802a91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a96:	49 89 df             	mov    %rbx,%r15
+  802a99:	48 b8 dd a0 ff ff ff 	movabs $0xffffffffffffa0dd,%rax
+  802aa0:	ff ff ff 
+  802aa3:	48 01 d8             	add    %rbx,%rax
+  802aa6:	ff d0                	call   *%rax
+	return r;
+  802aa8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802aab:	48 83 c4 30          	add    $0x30,%rsp
+  802aaf:	5b                   	pop    %rbx
+  802ab0:	41 5f                	pop    %r15
+  802ab2:	5d                   	pop    %rbp
+  802ab3:	c3                   	ret
+
+0000000000802ab4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802ab4:	55                   	push   %rbp
+  802ab5:	48 89 e5             	mov    %rsp,%rbp
+  802ab8:	41 57                	push   %r15
+  802aba:	48 83 ec 28          	sub    $0x28,%rsp
+  802abe:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 802abe <dev_lookup+0xa>
+  802ac5:	49 bb 72 55 00 00 00 	movabs $0x5572,%r11
+  802acc:	00 00 00 
+  802acf:	4c 01 d9             	add    %r11,%rcx
+  802ad2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ad5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  802ad9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802ae0:	eb 45                	jmp    802b27 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  802ae2:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802ae9:	00 00 00 
+  802aec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802aef:	48 98                	cltq
+  802af1:	48 01 ca             	add    %rcx,%rdx
+  802af4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802af8:	8b 00                	mov    (%rax),%eax
+  802afa:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  802afd:	75 24                	jne    802b23 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  802aff:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802b06:	00 00 00 
+  802b09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b0c:	48 98                	cltq
+  802b0e:	48 01 ca             	add    %rcx,%rdx
+  802b11:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802b15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b19:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  802b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b21:	eb 74                	jmp    802b97 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  802b23:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802b27:	48 ba 10 02 00 00 00 	movabs $0x210,%rdx
+  802b2e:	00 00 00 
+  802b31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b34:	48 98                	cltq
+  802b36:	48 01 ca             	add    %rcx,%rdx
+  802b39:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802b3d:	48 85 c0             	test   %rax,%rax
+  802b40:	75 a0                	jne    802ae2 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802b42:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802b49:	ff ff ff 
+  802b4c:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  802b50:	48 8b 00             	mov    (%rax),%rax
+  802b53:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802b59:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802b5c:	89 c6                	mov    %eax,%esi
+  802b5e:	48 b8 28 e5 ff ff ff 	movabs $0xffffffffffffe528,%rax
+  802b65:	ff ff ff 
+  802b68:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  802b6c:	48 89 c7             	mov    %rax,%rdi
+  802b6f:	49 89 cf             	mov    %rcx,%r15
+  802b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b77:	49 b8 87 85 ff ff ff 	movabs $0xffffffffffff8587,%r8
+  802b7e:	ff ff ff 
+  802b81:	49 01 c8             	add    %rcx,%r8
+  802b84:	41 ff d0             	call   *%r8
+	*dev = 0;
+  802b87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b8b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  802b92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b97:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+
+0000000000802b9d <close>:
+
+int
+close(int fdnum)
+{
+  802b9d:	55                   	push   %rbp
+  802b9e:	48 89 e5             	mov    %rsp,%rbp
+  802ba1:	53                   	push   %rbx
+  802ba2:	48 83 ec 28          	sub    $0x28,%rsp
+  802ba6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ba6 <close+0x9>
+  802bad:	49 bb 8a 54 00 00 00 	movabs $0x548a,%r11
+  802bb4:	00 00 00 
+  802bb7:	4c 01 db             	add    %r11,%rbx
+  802bba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bbd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802bc1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802bc4:	48 89 d6             	mov    %rdx,%rsi
+  802bc7:	89 c7                	mov    %eax,%edi
+  802bc9:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  802bd0:	ff ff ff 
+  802bd3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802bdc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802be0:	79 05                	jns    802be7 <close+0x4a>
+		return r;
+  802be2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802be5:	eb 1c                	jmp    802c03 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  802be7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802beb:	be 01 00 00 00       	mov    $0x1,%esi
+  802bf0:	48 89 c7             	mov    %rax,%rdi
+  802bf3:	48 b8 89 a9 ff ff ff 	movabs $0xffffffffffffa989,%rax
+  802bfa:	ff ff ff 
+  802bfd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c01:	ff d0                	call   *%rax
+}
+  802c03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c07:	c9                   	leave
+  802c08:	c3                   	ret
+
+0000000000802c09 <close_all>:
+
+void
+close_all(void)
+{
+  802c09:	55                   	push   %rbp
+  802c0a:	48 89 e5             	mov    %rsp,%rbp
+  802c0d:	53                   	push   %rbx
+  802c0e:	48 83 ec 18          	sub    $0x18,%rsp
+  802c12:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c12 <close_all+0x9>
+  802c19:	49 bb 1e 54 00 00 00 	movabs $0x541e,%r11
+  802c20:	00 00 00 
+  802c23:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  802c26:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802c2d:	eb 19                	jmp    802c48 <close_all+0x3f>
+		close(i);
+  802c2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c32:	89 c7                	mov    %eax,%edi
+  802c34:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  802c3b:	ff ff ff 
+  802c3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c42:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  802c44:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  802c48:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802c4c:	7e e1                	jle    802c2f <close_all+0x26>
+}
+  802c4e:	90                   	nop
+  802c4f:	90                   	nop
+  802c50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c54:	c9                   	leave
+  802c55:	c3                   	ret
+
+0000000000802c56 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802c56:	55                   	push   %rbp
+  802c57:	48 89 e5             	mov    %rsp,%rbp
+  802c5a:	41 57                	push   %r15
+  802c5c:	53                   	push   %rbx
+  802c5d:	48 83 ec 40          	sub    $0x40,%rsp
+  802c61:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802c61 <dup+0xb>
+  802c68:	49 bb cf 53 00 00 00 	movabs $0x53cf,%r11
+  802c6f:	00 00 00 
+  802c72:	4c 01 db             	add    %r11,%rbx
+  802c75:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  802c78:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802c7b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c7f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802c82:	48 89 d6             	mov    %rdx,%rsi
+  802c85:	89 c7                	mov    %eax,%edi
+  802c87:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  802c8e:	ff ff ff 
+  802c91:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c95:	ff d0                	call   *%rax
+  802c97:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802c9a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c9e:	79 08                	jns    802ca8 <dup+0x52>
+		return r;
+  802ca0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ca3:	e9 a4 01 00 00       	jmp    802e4c <dup+0x1f6>
+	close(newfdnum);
+  802ca8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cab:	89 c7                	mov    %eax,%edi
+  802cad:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  802cb4:	ff ff ff 
+  802cb7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cbb:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  802cbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802cc0:	48 98                	cltq
+  802cc2:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  802cc8:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ccc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  802cd0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cd4:	48 89 c7             	mov    %rax,%rdi
+  802cd7:	48 b8 e5 a7 ff ff ff 	movabs $0xffffffffffffa7e5,%rax
+  802cde:	ff ff ff 
+  802ce1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ce5:	ff d0                	call   *%rax
+  802ce7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  802ceb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802cef:	48 89 c7             	mov    %rax,%rdi
+  802cf2:	48 b8 e5 a7 ff ff ff 	movabs $0xffffffffffffa7e5,%rax
+  802cf9:	ff ff ff 
+  802cfc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d00:	ff d0                	call   *%rax
+  802d02:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  802d06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d0a:	48 c1 e8 15          	shr    $0x15,%rax
+  802d0e:	48 89 c2             	mov    %rax,%rdx
+  802d11:	48 b8 e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rax
+  802d18:	ff ff ff 
+  802d1b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d1f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d23:	83 e0 01             	and    $0x1,%eax
+  802d26:	48 85 c0             	test   %rax,%rax
+  802d29:	74 7f                	je     802daa <dup+0x154>
+  802d2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d2f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d33:	48 89 c2             	mov    %rax,%rdx
+  802d36:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802d3d:	ff ff ff 
+  802d40:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d44:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d48:	83 e0 01             	and    $0x1,%eax
+  802d4b:	48 85 c0             	test   %rax,%rax
+  802d4e:	74 5a                	je     802daa <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802d50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d54:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d58:	48 89 c2             	mov    %rax,%rdx
+  802d5b:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802d62:	ff ff ff 
+  802d65:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802d69:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d6d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d72:	89 c1                	mov    %eax,%ecx
+  802d74:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802d78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d7c:	41 89 c8             	mov    %ecx,%r8d
+  802d7f:	48 89 d1             	mov    %rdx,%rcx
+  802d82:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d87:	48 89 c6             	mov    %rax,%rsi
+  802d8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d8f:	49 89 df             	mov    %rbx,%r15
+  802d92:	48 b8 6a a0 ff ff ff 	movabs $0xffffffffffffa06a,%rax
+  802d99:	ff ff ff 
+  802d9c:	48 01 d8             	add    %rbx,%rax
+  802d9f:	ff d0                	call   *%rax
+  802da1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802da4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802da8:	78 5f                	js     802e09 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802daa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dae:	48 c1 e8 0c          	shr    $0xc,%rax
+  802db2:	48 89 c2             	mov    %rax,%rdx
+  802db5:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802dbc:	ff ff ff 
+  802dbf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802dc3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802dc7:	25 07 0e 00 00       	and    $0xe07,%eax
+  802dcc:	89 c1                	mov    %eax,%ecx
+  802dce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dd2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802dd6:	41 89 c8             	mov    %ecx,%r8d
+  802dd9:	48 89 d1             	mov    %rdx,%rcx
+  802ddc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de1:	48 89 c6             	mov    %rax,%rsi
+  802de4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de9:	49 89 df             	mov    %rbx,%r15
+  802dec:	48 b8 6a a0 ff ff ff 	movabs $0xffffffffffffa06a,%rax
+  802df3:	ff ff ff 
+  802df6:	48 01 d8             	add    %rbx,%rax
+  802df9:	ff d0                	call   *%rax
+  802dfb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802dfe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e02:	78 08                	js     802e0c <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  802e04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802e07:	eb 43                	jmp    802e4c <dup+0x1f6>
+			goto err;
+  802e09:	90                   	nop
+  802e0a:	eb 01                	jmp    802e0d <dup+0x1b7>
+		goto err;
+  802e0c:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  802e0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e11:	48 89 c6             	mov    %rax,%rsi
+  802e14:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e19:	49 89 df             	mov    %rbx,%r15
+  802e1c:	48 b8 dd a0 ff ff ff 	movabs $0xffffffffffffa0dd,%rax
+  802e23:	ff ff ff 
+  802e26:	48 01 d8             	add    %rbx,%rax
+  802e29:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  802e2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e2f:	48 89 c6             	mov    %rax,%rsi
+  802e32:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e37:	49 89 df             	mov    %rbx,%r15
+  802e3a:	48 b8 dd a0 ff ff ff 	movabs $0xffffffffffffa0dd,%rax
+  802e41:	ff ff ff 
+  802e44:	48 01 d8             	add    %rbx,%rax
+  802e47:	ff d0                	call   *%rax
+	return r;
+  802e49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802e4c:	48 83 c4 40          	add    $0x40,%rsp
+  802e50:	5b                   	pop    %rbx
+  802e51:	41 5f                	pop    %r15
+  802e53:	5d                   	pop    %rbp
+  802e54:	c3                   	ret
+
+0000000000802e55 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802e55:	55                   	push   %rbp
+  802e56:	48 89 e5             	mov    %rsp,%rbp
+  802e59:	41 57                	push   %r15
+  802e5b:	53                   	push   %rbx
+  802e5c:	48 83 ec 40          	sub    $0x40,%rsp
+  802e60:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e60 <read+0xb>
+  802e67:	49 bb d0 51 00 00 00 	movabs $0x51d0,%r11
+  802e6e:	00 00 00 
+  802e71:	4c 01 db             	add    %r11,%rbx
+  802e74:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802e77:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  802e7b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802e7f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802e83:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802e86:	48 89 d6             	mov    %rdx,%rsi
+  802e89:	89 c7                	mov    %eax,%edi
+  802e8b:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  802e92:	ff ff ff 
+  802e95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e99:	ff d0                	call   *%rax
+  802e9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e9e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ea2:	78 28                	js     802ecc <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802ea4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ea8:	8b 00                	mov    (%rax),%eax
+  802eaa:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  802eae:	48 89 d6             	mov    %rdx,%rsi
+  802eb1:	89 c7                	mov    %eax,%edi
+  802eb3:	48 b8 84 aa ff ff ff 	movabs $0xffffffffffffaa84,%rax
+  802eba:	ff ff ff 
+  802ebd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ec1:	ff d0                	call   *%rax
+  802ec3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802ec6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802eca:	79 08                	jns    802ed4 <read+0x7f>
+		return r;
+  802ecc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ecf:	e9 8b 00 00 00       	jmp    802f5f <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802ed4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ed8:	8b 40 08             	mov    0x8(%rax),%eax
+  802edb:	83 e0 03             	and    $0x3,%eax
+  802ede:	83 f8 01             	cmp    $0x1,%eax
+  802ee1:	75 4b                	jne    802f2e <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802ee3:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802eea:	ff ff ff 
+  802eed:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ef1:	48 8b 00             	mov    (%rax),%rax
+  802ef4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802efa:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  802efd:	89 c6                	mov    %eax,%esi
+  802eff:	48 b8 47 e5 ff ff ff 	movabs $0xffffffffffffe547,%rax
+  802f06:	ff ff ff 
+  802f09:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f0d:	48 89 c7             	mov    %rax,%rdi
+  802f10:	49 89 df             	mov    %rbx,%r15
+  802f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f18:	48 b9 87 85 ff ff ff 	movabs $0xffffffffffff8587,%rcx
+  802f1f:	ff ff ff 
+  802f22:	48 01 d9             	add    %rbx,%rcx
+  802f25:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  802f27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f2c:	eb 31                	jmp    802f5f <read+0x10a>
+	}
+	if (!dev->dev_read)
+  802f2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f32:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802f36:	48 85 c0             	test   %rax,%rax
+  802f39:	75 07                	jne    802f42 <read+0xed>
+		return -E_NOT_SUPP;
+  802f3b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f40:	eb 1d                	jmp    802f5f <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  802f42:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f46:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802f4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f4e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802f52:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802f56:	48 89 ce             	mov    %rcx,%rsi
+  802f59:	48 89 c7             	mov    %rax,%rdi
+  802f5c:	41 ff d0             	call   *%r8
+}
+  802f5f:	48 83 c4 40          	add    $0x40,%rsp
+  802f63:	5b                   	pop    %rbx
+  802f64:	41 5f                	pop    %r15
+  802f66:	5d                   	pop    %rbp
+  802f67:	c3                   	ret
+
+0000000000802f68 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802f68:	55                   	push   %rbp
+  802f69:	48 89 e5             	mov    %rsp,%rbp
+  802f6c:	53                   	push   %rbx
+  802f6d:	48 83 ec 38          	sub    $0x38,%rsp
+  802f71:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f71 <readn+0x9>
+  802f78:	49 bb bf 50 00 00 00 	movabs $0x50bf,%r11
+  802f7f:	00 00 00 
+  802f82:	4c 01 db             	add    %r11,%rbx
+  802f85:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f88:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802f8c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802f90:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  802f97:	eb 4b                	jmp    802fe4 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802f99:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f9c:	48 98                	cltq
+  802f9e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802fa2:	48 29 c2             	sub    %rax,%rdx
+  802fa5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fa8:	48 63 c8             	movslq %eax,%rcx
+  802fab:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802faf:	48 01 c1             	add    %rax,%rcx
+  802fb2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fb5:	48 89 ce             	mov    %rcx,%rsi
+  802fb8:	89 c7                	mov    %eax,%edi
+  802fba:	48 b8 25 ae ff ff ff 	movabs $0xffffffffffffae25,%rax
+  802fc1:	ff ff ff 
+  802fc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fc8:	ff d0                	call   *%rax
+  802fca:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  802fcd:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802fd1:	79 05                	jns    802fd8 <readn+0x70>
+			return m;
+  802fd3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802fd6:	eb 1d                	jmp    802ff5 <readn+0x8d>
+		if (m == 0)
+  802fd8:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  802fdc:	74 13                	je     802ff1 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  802fde:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802fe1:	01 45 ec             	add    %eax,-0x14(%rbp)
+  802fe4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fe7:	48 98                	cltq
+  802fe9:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  802fed:	72 aa                	jb     802f99 <readn+0x31>
+  802fef:	eb 01                	jmp    802ff2 <readn+0x8a>
+			break;
+  802ff1:	90                   	nop
+	}
+	return tot;
+  802ff2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  802ff5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff9:	c9                   	leave
+  802ffa:	c3                   	ret
+
+0000000000802ffb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802ffb:	55                   	push   %rbp
+  802ffc:	48 89 e5             	mov    %rsp,%rbp
+  802fff:	41 57                	push   %r15
+  803001:	53                   	push   %rbx
+  803002:	48 83 ec 40          	sub    $0x40,%rsp
+  803006:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803006 <write+0xb>
+  80300d:	49 bb 2a 50 00 00 00 	movabs $0x502a,%r11
+  803014:	00 00 00 
+  803017:	4c 01 db             	add    %r11,%rbx
+  80301a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80301d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803021:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803025:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803029:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80302c:	48 89 d6             	mov    %rdx,%rsi
+  80302f:	89 c7                	mov    %eax,%edi
+  803031:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  803038:	ff ff ff 
+  80303b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80303f:	ff d0                	call   *%rax
+  803041:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803044:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803048:	78 28                	js     803072 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80304a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80304e:	8b 00                	mov    (%rax),%eax
+  803050:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803054:	48 89 d6             	mov    %rdx,%rsi
+  803057:	89 c7                	mov    %eax,%edi
+  803059:	48 b8 84 aa ff ff ff 	movabs $0xffffffffffffaa84,%rax
+  803060:	ff ff ff 
+  803063:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803067:	ff d0                	call   *%rax
+  803069:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80306c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803070:	79 08                	jns    80307a <write+0x7f>
+		return r;
+  803072:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803075:	e9 8a 00 00 00       	jmp    803104 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80307a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80307e:	8b 40 08             	mov    0x8(%rax),%eax
+  803081:	83 e0 03             	and    $0x3,%eax
+  803084:	85 c0                	test   %eax,%eax
+  803086:	75 4b                	jne    8030d3 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803088:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80308f:	ff ff ff 
+  803092:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803096:	48 8b 00             	mov    (%rax),%rax
+  803099:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80309f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8030a2:	89 c6                	mov    %eax,%esi
+  8030a4:	48 b8 63 e5 ff ff ff 	movabs $0xffffffffffffe563,%rax
+  8030ab:	ff ff ff 
+  8030ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030b2:	48 89 c7             	mov    %rax,%rdi
+  8030b5:	49 89 df             	mov    %rbx,%r15
+  8030b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bd:	48 b9 87 85 ff ff ff 	movabs $0xffffffffffff8587,%rcx
+  8030c4:	ff ff ff 
+  8030c7:	48 01 d9             	add    %rbx,%rcx
+  8030ca:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8030cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030d1:	eb 31                	jmp    803104 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8030d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030d7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8030db:	48 85 c0             	test   %rax,%rax
+  8030de:	75 07                	jne    8030e7 <write+0xec>
+		return -E_NOT_SUPP;
+  8030e0:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030e5:	eb 1d                	jmp    803104 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  8030e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030eb:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8030ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030f3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8030f7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8030fb:	48 89 ce             	mov    %rcx,%rsi
+  8030fe:	48 89 c7             	mov    %rax,%rdi
+  803101:	41 ff d0             	call   *%r8
+}
+  803104:	48 83 c4 40          	add    $0x40,%rsp
+  803108:	5b                   	pop    %rbx
+  803109:	41 5f                	pop    %r15
+  80310b:	5d                   	pop    %rbp
+  80310c:	c3                   	ret
+
+000000000080310d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80310d:	55                   	push   %rbp
+  80310e:	48 89 e5             	mov    %rsp,%rbp
+  803111:	48 83 ec 18          	sub    $0x18,%rsp
+  803115:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803115 <seek+0x8>
+  80311c:	49 bb 1b 4f 00 00 00 	movabs $0x4f1b,%r11
+  803123:	00 00 00 
+  803126:	4c 01 d8             	add    %r11,%rax
+  803129:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80312c:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80312f:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803133:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803136:	48 89 ce             	mov    %rcx,%rsi
+  803139:	89 d7                	mov    %edx,%edi
+  80313b:	48 ba de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rdx
+  803142:	ff ff ff 
+  803145:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803149:	ff d0                	call   *%rax
+  80314b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80314e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803152:	79 05                	jns    803159 <seek+0x4c>
+		return r;
+  803154:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803157:	eb 0f                	jmp    803168 <seek+0x5b>
+	fd->fd_offset = offset;
+  803159:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80315d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803160:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803163:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803168:	c9                   	leave
+  803169:	c3                   	ret
+
+000000000080316a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80316a:	55                   	push   %rbp
+  80316b:	48 89 e5             	mov    %rsp,%rbp
+  80316e:	41 57                	push   %r15
+  803170:	53                   	push   %rbx
+  803171:	48 83 ec 30          	sub    $0x30,%rsp
+  803175:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803175 <ftruncate+0xb>
+  80317c:	49 bb bb 4e 00 00 00 	movabs $0x4ebb,%r11
+  803183:	00 00 00 
+  803186:	4c 01 db             	add    %r11,%rbx
+  803189:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80318c:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80318f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803193:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803196:	48 89 d6             	mov    %rdx,%rsi
+  803199:	89 c7                	mov    %eax,%edi
+  80319b:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  8031a2:	ff ff ff 
+  8031a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031a9:	ff d0                	call   *%rax
+  8031ab:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031b2:	78 28                	js     8031dc <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8031b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031b8:	8b 00                	mov    (%rax),%eax
+  8031ba:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8031be:	48 89 d6             	mov    %rdx,%rsi
+  8031c1:	89 c7                	mov    %eax,%edi
+  8031c3:	48 b8 84 aa ff ff ff 	movabs $0xffffffffffffaa84,%rax
+  8031ca:	ff ff ff 
+  8031cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031d1:	ff d0                	call   *%rax
+  8031d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031da:	79 08                	jns    8031e4 <ftruncate+0x7a>
+		return r;
+  8031dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031df:	e9 83 00 00 00       	jmp    803267 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8031e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031e8:	8b 40 08             	mov    0x8(%rax),%eax
+  8031eb:	83 e0 03             	and    $0x3,%eax
+  8031ee:	85 c0                	test   %eax,%eax
+  8031f0:	75 4b                	jne    80323d <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8031f2:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8031f9:	ff ff ff 
+  8031fc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803200:	48 8b 00             	mov    (%rax),%rax
+  803203:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803209:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80320c:	89 c6                	mov    %eax,%esi
+  80320e:	48 b8 80 e5 ff ff ff 	movabs $0xffffffffffffe580,%rax
+  803215:	ff ff ff 
+  803218:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80321c:	48 89 c7             	mov    %rax,%rdi
+  80321f:	49 89 df             	mov    %rbx,%r15
+  803222:	b8 00 00 00 00       	mov    $0x0,%eax
+  803227:	48 b9 87 85 ff ff ff 	movabs $0xffffffffffff8587,%rcx
+  80322e:	ff ff ff 
+  803231:	48 01 d9             	add    %rbx,%rcx
+  803234:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803236:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80323b:	eb 2a                	jmp    803267 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80323d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803241:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803245:	48 85 c0             	test   %rax,%rax
+  803248:	75 07                	jne    803251 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  80324a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80324f:	eb 16                	jmp    803267 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803251:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803255:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803259:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80325d:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803260:	89 d6                	mov    %edx,%esi
+  803262:	48 89 c7             	mov    %rax,%rdi
+  803265:	ff d1                	call   *%rcx
+}
+  803267:	48 83 c4 30          	add    $0x30,%rsp
+  80326b:	5b                   	pop    %rbx
+  80326c:	41 5f                	pop    %r15
+  80326e:	5d                   	pop    %rbp
+  80326f:	c3                   	ret
+
+0000000000803270 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803270:	55                   	push   %rbp
+  803271:	48 89 e5             	mov    %rsp,%rbp
+  803274:	53                   	push   %rbx
+  803275:	48 83 ec 38          	sub    $0x38,%rsp
+  803279:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803279 <fstat+0x9>
+  803280:	49 bb b7 4d 00 00 00 	movabs $0x4db7,%r11
+  803287:	00 00 00 
+  80328a:	4c 01 db             	add    %r11,%rbx
+  80328d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803290:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803294:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803298:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80329b:	48 89 d6             	mov    %rdx,%rsi
+  80329e:	89 c7                	mov    %eax,%edi
+  8032a0:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  8032a7:	ff ff ff 
+  8032aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032ae:	ff d0                	call   *%rax
+  8032b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032b7:	78 28                	js     8032e1 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8032b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032bd:	8b 00                	mov    (%rax),%eax
+  8032bf:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8032c3:	48 89 d6             	mov    %rdx,%rsi
+  8032c6:	89 c7                	mov    %eax,%edi
+  8032c8:	48 b8 84 aa ff ff ff 	movabs $0xffffffffffffaa84,%rax
+  8032cf:	ff ff ff 
+  8032d2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032d6:	ff d0                	call   *%rax
+  8032d8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8032db:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8032df:	79 05                	jns    8032e6 <fstat+0x76>
+		return r;
+  8032e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032e4:	eb 5e                	jmp    803344 <fstat+0xd4>
+	if (!dev->dev_stat)
+  8032e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032ea:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8032ee:	48 85 c0             	test   %rax,%rax
+  8032f1:	75 07                	jne    8032fa <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8032f3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8032f8:	eb 4a                	jmp    803344 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8032fa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8032fe:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  803301:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803305:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80330c:	00 00 00 
+	stat->st_isdir = 0;
+  80330f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803313:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80331a:	00 00 00 
+	stat->st_dev = dev;
+  80331d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803321:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803325:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80332c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803330:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803334:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803338:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80333c:	48 89 d6             	mov    %rdx,%rsi
+  80333f:	48 89 c7             	mov    %rax,%rdi
+  803342:	ff d1                	call   *%rcx
+}
+  803344:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803348:	c9                   	leave
+  803349:	c3                   	ret
+
+000000000080334a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80334a:	55                   	push   %rbp
+  80334b:	48 89 e5             	mov    %rsp,%rbp
+  80334e:	41 57                	push   %r15
+  803350:	53                   	push   %rbx
+  803351:	48 83 ec 20          	sub    $0x20,%rsp
+  803355:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803355 <stat+0xb>
+  80335c:	49 bb db 4c 00 00 00 	movabs $0x4cdb,%r11
+  803363:	00 00 00 
+  803366:	4c 01 db             	add    %r11,%rbx
+  803369:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80336d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  803371:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803375:	be 00 00 00 00       	mov    $0x0,%esi
+  80337a:	48 89 c7             	mov    %rax,%rdi
+  80337d:	49 89 df             	mov    %rbx,%r15
+  803380:	48 b8 f4 b5 ff ff ff 	movabs $0xffffffffffffb5f4,%rax
+  803387:	ff ff ff 
+  80338a:	48 01 d8             	add    %rbx,%rax
+  80338d:	ff d0                	call   *%rax
+  80338f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803392:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803396:	79 05                	jns    80339d <stat+0x53>
+		return fd;
+  803398:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80339b:	eb 37                	jmp    8033d4 <stat+0x8a>
+	r = fstat(fd, stat);
+  80339d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8033a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033a4:	48 89 d6             	mov    %rdx,%rsi
+  8033a7:	89 c7                	mov    %eax,%edi
+  8033a9:	48 b8 40 b2 ff ff ff 	movabs $0xffffffffffffb240,%rax
+  8033b0:	ff ff ff 
+  8033b3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033b7:	ff d0                	call   *%rax
+  8033b9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8033bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033bf:	89 c7                	mov    %eax,%edi
+  8033c1:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  8033c8:	ff ff ff 
+  8033cb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033cf:	ff d0                	call   *%rax
+	return r;
+  8033d1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8033d4:	48 83 c4 20          	add    $0x20,%rsp
+  8033d8:	5b                   	pop    %rbx
+  8033d9:	41 5f                	pop    %r15
+  8033db:	5d                   	pop    %rbp
+  8033dc:	c3                   	ret
+
+00000000008033dd <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8033dd:	55                   	push   %rbp
+  8033de:	48 89 e5             	mov    %rsp,%rbp
+  8033e1:	41 57                	push   %r15
+  8033e3:	53                   	push   %rbx
+  8033e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8033e8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8033e8 <fsipc+0xb>
+  8033ef:	49 bb 48 4c 00 00 00 	movabs $0x4c48,%r11
+  8033f6:	00 00 00 
+  8033f9:	4c 01 db             	add    %r11,%rbx
+  8033fc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8033ff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  803403:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80340a:	00 00 00 
+  80340d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803410:	85 c0                	test   %eax,%eax
+  803412:	75 24                	jne    803438 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803414:	bf 01 00 00 00       	mov    $0x1,%edi
+  803419:	49 89 df             	mov    %rbx,%r15
+  80341c:	48 b8 4d df ff ff ff 	movabs $0xffffffffffffdf4d,%rax
+  803423:	ff ff ff 
+  803426:	48 01 d8             	add    %rbx,%rax
+  803429:	ff d0                	call   *%rax
+  80342b:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803432:	00 00 00 
+  803435:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  803438:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80343f:	00 00 00 
+  803442:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803445:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803449:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80344c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803452:	49 89 d0             	mov    %rdx,%r8
+  803455:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80345a:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803461:	00 00 00 
+  803464:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803468:	89 c7                	mov    %eax,%edi
+  80346a:	49 89 df             	mov    %rbx,%r15
+  80346d:	48 b8 6c d9 ff ff ff 	movabs $0xffffffffffffd96c,%rax
+  803474:	ff ff ff 
+  803477:	48 01 d8             	add    %rbx,%rax
+  80347a:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  80347c:	48 83 c4 10          	add    $0x10,%rsp
+  803480:	5b                   	pop    %rbx
+  803481:	41 5f                	pop    %r15
+  803483:	5d                   	pop    %rbp
+  803484:	c3                   	ret
+
+0000000000803485 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  803485:	55                   	push   %rbp
+  803486:	48 89 e5             	mov    %rsp,%rbp
+  803489:	41 57                	push   %r15
+  80348b:	53                   	push   %rbx
+  80348c:	48 83 ec 20          	sub    $0x20,%rsp
+  803490:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803490 <fsipc_words+0xb>
+  803497:	49 bb a0 4b 00 00 00 	movabs $0x4ba0,%r11
+  80349e:	00 00 00 
+  8034a1:	4c 01 db             	add    %r11,%rbx
+  8034a4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8034a7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8034ab:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8034af:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8034b6:	00 00 00 
+  8034b9:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8034bc:	85 c0                	test   %eax,%eax
+  8034be:	75 24                	jne    8034e4 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034c0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034c5:	49 89 df             	mov    %rbx,%r15
+  8034c8:	48 b8 4d df ff ff ff 	movabs $0xffffffffffffdf4d,%rax
+  8034cf:	ff ff ff 
+  8034d2:	48 01 d8             	add    %rbx,%rax
+  8034d5:	ff d0                	call   *%rax
+  8034d7:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  8034de:	00 00 00 
+  8034e1:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  8034e4:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8034eb:	00 00 00 
+  8034ee:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8034f1:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8034f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034f9:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8034fc:	89 c7                	mov    %eax,%edi
+  8034fe:	49 89 df             	mov    %rbx,%r15
+  803501:	48 b8 57 da ff ff ff 	movabs $0xffffffffffffda57,%rax
+  803508:	ff ff ff 
+  80350b:	48 01 d8             	add    %rbx,%rax
+  80350e:	ff d0                	call   *%rax
+}
+  803510:	48 83 c4 20          	add    $0x20,%rsp
+  803514:	5b                   	pop    %rbx
+  803515:	41 5f                	pop    %r15
+  803517:	5d                   	pop    %rbp
+  803518:	c3                   	ret
+
+0000000000803519 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  803519:	55                   	push   %rbp
+  80351a:	48 89 e5             	mov    %rsp,%rbp
+  80351d:	41 57                	push   %r15
+  80351f:	53                   	push   %rbx
+  803520:	48 83 ec 40          	sub    $0x40,%rsp
+  803524:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803524 <fsipc_pages+0xb>
+  80352b:	49 bb 0c 4b 00 00 00 	movabs $0x4b0c,%r11
+  803532:	00 00 00 
+  803535:	4c 01 db             	add    %r11,%rbx
+  803538:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80353b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80353f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  803543:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  803546:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  80354d:	00 00 00 
+  803550:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803553:	85 c0                	test   %eax,%eax
+  803555:	75 24                	jne    80357b <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  803557:	bf 01 00 00 00       	mov    $0x1,%edi
+  80355c:	49 89 df             	mov    %rbx,%r15
+  80355f:	48 b8 4d df ff ff ff 	movabs $0xffffffffffffdf4d,%rax
+  803566:	ff ff ff 
+  803569:	48 01 d8             	add    %rbx,%rax
+  80356c:	ff d0                	call   *%rax
+  80356e:	48 ba d0 0f 00 00 00 	movabs $0xfd0,%rdx
+  803575:	00 00 00 
+  803578:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  80357b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803580:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  803584:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803587:	48 98                	cltq
+  803589:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  80358d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  803591:	0f 95 c0             	setne  %al
+  803594:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  803597:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  80359e:	00 
+  80359f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8035a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035a7:	48 01 d0             	add    %rdx,%rax
+  8035aa:	48 83 e8 01          	sub    $0x1,%rax
+  8035ae:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8035b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035bb:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8035bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035c3:	48 29 d0             	sub    %rdx,%rax
+  8035c6:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  8035ca:	41 89 c2             	mov    %eax,%r10d
+  8035cd:	48 b8 d0 0f 00 00 00 	movabs $0xfd0,%rax
+  8035d4:	00 00 00 
+  8035d7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8035da:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8035de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8035e2:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8035e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8035e9:	6a 40                	push   $0x40
+  8035eb:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  8035f0:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  8035f7:	00 
+  8035f8:	6a 05                	push   $0x5
+  8035fa:	41 89 f9             	mov    %edi,%r9d
+  8035fd:	49 89 c8             	mov    %rcx,%r8
+  803600:	44 89 d1             	mov    %r10d,%ecx
+  803603:	89 c7                	mov    %eax,%edi
+  803605:	49 89 df             	mov    %rbx,%r15
+  803608:	48 b8 55 db ff ff ff 	movabs $0xffffffffffffdb55,%rax
+  80360f:	ff ff ff 
+  803612:	48 01 d8             	add    %rbx,%rax
+  803615:	ff d0                	call   *%rax
+  803617:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80361b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80361f:	5b                   	pop    %rbx
+  803620:	41 5f                	pop    %r15
+  803622:	5d                   	pop    %rbp
+  803623:	c3                   	ret
+
+0000000000803624 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  803624:	55                   	push   %rbp
+  803625:	48 89 e5             	mov    %rsp,%rbp
+  803628:	41 57                	push   %r15
+  80362a:	53                   	push   %rbx
+  80362b:	48 83 ec 20          	sub    $0x20,%rsp
+  80362f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80362f <open+0xb>
+  803636:	49 bb 01 4a 00 00 00 	movabs $0x4a01,%r11
+  80363d:	00 00 00 
+  803640:	4c 01 db             	add    %r11,%rbx
+  803643:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803647:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  80364a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80364e:	48 89 c7             	mov    %rax,%rdi
+  803651:	49 89 df             	mov    %rbx,%r15
+  803654:	48 b8 b5 92 ff ff ff 	movabs $0xffffffffffff92b5,%rax
+  80365b:	ff ff ff 
+  80365e:	48 01 d8             	add    %rbx,%rax
+  803661:	ff d0                	call   *%rax
+  803663:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803668:	7e 0a                	jle    803674 <open+0x50>
+		return -E_BAD_PATH;
+  80366a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80366f:	e9 18 01 00 00       	jmp    80378c <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  803674:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803678:	48 89 c7             	mov    %rax,%rdi
+  80367b:	49 89 df             	mov    %rbx,%r15
+  80367e:	48 b8 28 a8 ff ff ff 	movabs $0xffffffffffffa828,%rax
+  803685:	ff ff ff 
+  803688:	48 01 d8             	add    %rbx,%rax
+  80368b:	ff d0                	call   *%rax
+  80368d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803690:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803694:	74 08                	je     80369e <open+0x7a>
+		return r;
+  803696:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803699:	e9 ee 00 00 00       	jmp    80378c <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  80369e:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  8036a5:	00 00 00 
+  8036a8:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8036ab:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8036b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036b6:	48 89 c6             	mov    %rax,%rsi
+  8036b9:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  8036c0:	00 00 00 
+  8036c3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8036c7:	48 89 c7             	mov    %rax,%rdi
+  8036ca:	49 89 df             	mov    %rbx,%r15
+  8036cd:	48 b8 49 93 ff ff ff 	movabs $0xffffffffffff9349,%rax
+  8036d4:	ff ff ff 
+  8036d7:	48 01 d8             	add    %rbx,%rax
+  8036da:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  8036dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036e0:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  8036e5:	48 89 c6             	mov    %rax,%rsi
+  8036e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ed:	49 89 df             	mov    %rbx,%r15
+  8036f0:	48 b8 05 a0 ff ff ff 	movabs $0xffffffffffffa005,%rax
+  8036f7:	ff ff ff 
+  8036fa:	48 01 d8             	add    %rbx,%rax
+  8036fd:	ff d0                	call   *%rax
+  8036ff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803702:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803706:	74 23                	je     80372b <open+0x107>
+		fd_close(fd,0);
+  803708:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80370c:	be 00 00 00 00       	mov    $0x0,%esi
+  803711:	48 89 c7             	mov    %rax,%rdi
+  803714:	49 89 df             	mov    %rbx,%r15
+  803717:	48 b8 89 a9 ff ff ff 	movabs $0xffffffffffffa989,%rax
+  80371e:	ff ff ff 
+  803721:	48 01 d8             	add    %rbx,%rax
+  803724:	ff d0                	call   *%rax
+		return r;
+  803726:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803729:	eb 61                	jmp    80378c <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80372b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80372f:	48 89 c6             	mov    %rax,%rsi
+  803732:	bf 01 00 00 00       	mov    $0x1,%edi
+  803737:	48 b8 ad b3 ff ff ff 	movabs $0xffffffffffffb3ad,%rax
+  80373e:	ff ff ff 
+  803741:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803745:	ff d0                	call   *%rax
+  803747:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80374a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80374e:	74 23                	je     803773 <open+0x14f>
+		fd_close(fd,0);
+  803750:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803754:	be 00 00 00 00       	mov    $0x0,%esi
+  803759:	48 89 c7             	mov    %rax,%rdi
+  80375c:	49 89 df             	mov    %rbx,%r15
+  80375f:	48 b8 89 a9 ff ff ff 	movabs $0xffffffffffffa989,%rax
+  803766:	ff ff ff 
+  803769:	48 01 d8             	add    %rbx,%rax
+  80376c:	ff d0                	call   *%rax
+		return r;
+  80376e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803771:	eb 19                	jmp    80378c <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  803773:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803777:	48 89 c7             	mov    %rax,%rdi
+  80377a:	49 89 df             	mov    %rbx,%r15
+  80377d:	48 b8 ae a7 ff ff ff 	movabs $0xffffffffffffa7ae,%rax
+  803784:	ff ff ff 
+  803787:	48 01 d8             	add    %rbx,%rax
+  80378a:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  80378c:	48 83 c4 20          	add    $0x20,%rsp
+  803790:	5b                   	pop    %rbx
+  803791:	41 5f                	pop    %r15
+  803793:	5d                   	pop    %rbp
+  803794:	c3                   	ret
+
+0000000000803795 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  803795:	55                   	push   %rbp
+  803796:	48 89 e5             	mov    %rsp,%rbp
+  803799:	48 83 ec 20          	sub    $0x20,%rsp
+  80379d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80379d <devfile_flush+0x8>
+  8037a4:	49 bb 93 48 00 00 00 	movabs $0x4893,%r11
+  8037ab:	00 00 00 
+  8037ae:	4c 01 d8             	add    %r11,%rax
+  8037b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8037b5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8037b9:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8037bc:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  8037bf:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  8037c3:	ba 04 00 00 00       	mov    $0x4,%edx
+  8037c8:	48 89 ce             	mov    %rcx,%rsi
+  8037cb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037d0:	48 b9 55 b4 ff ff ff 	movabs $0xffffffffffffb455,%rcx
+  8037d7:	ff ff ff 
+  8037da:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8037de:	ff d0                	call   *%rax
+}
+  8037e0:	c9                   	leave
+  8037e1:	c3                   	ret
+
+00000000008037e2 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  8037e2:	55                   	push   %rbp
+  8037e3:	48 89 e5             	mov    %rsp,%rbp
+  8037e6:	41 57                	push   %r15
+  8037e8:	53                   	push   %rbx
+  8037e9:	48 83 ec 60          	sub    $0x60,%rsp
+  8037ed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037ed <devfile_read+0xb>
+  8037f4:	49 bb 43 48 00 00 00 	movabs $0x4843,%r11
+  8037fb:	00 00 00 
+  8037fe:	4c 01 db             	add    %r11,%rbx
+  803801:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803805:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803809:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80380d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803811:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  803815:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803819:	8b 50 0c             	mov    0xc(%rax),%edx
+  80381c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803820:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  803822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803826:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80382a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  80382e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803832:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803837:	ba 10 00 00 00       	mov    $0x10,%edx
+  80383c:	48 89 c6             	mov    %rax,%rsi
+  80383f:	bf 03 00 00 00       	mov    $0x3,%edi
+  803844:	48 b8 e9 b4 ff ff ff 	movabs $0xffffffffffffb4e9,%rax
+  80384b:	ff ff ff 
+  80384e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803852:	ff d0                	call   *%rax
+  803854:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803857:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80385b:	79 05                	jns    803862 <devfile_read+0x80>
+		return r;
+  80385d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803860:	eb 64                	jmp    8038c6 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  803862:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803865:	48 63 d0             	movslq %eax,%rdx
+  803868:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80386c:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  803871:	48 01 c1             	add    %rax,%rcx
+  803874:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803878:	48 89 ce             	mov    %rcx,%rsi
+  80387b:	48 89 c7             	mov    %rax,%rdi
+  80387e:	49 89 df             	mov    %rbx,%r15
+  803881:	48 b8 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rax
+  803888:	ff ff ff 
+  80388b:	48 01 d8             	add    %rbx,%rax
+  80388e:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  803890:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  803897:	ff ff ff 
+  80389a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80389e:	48 8b 00             	mov    (%rax),%rax
+  8038a1:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8038a7:	89 c6                	mov    %eax,%esi
+  8038a9:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8038ae:	48 89 c7             	mov    %rax,%rdi
+  8038b1:	49 89 df             	mov    %rbx,%r15
+  8038b4:	48 b8 07 df ff ff ff 	movabs $0xffffffffffffdf07,%rax
+  8038bb:	ff ff ff 
+  8038be:	48 01 d8             	add    %rbx,%rax
+  8038c1:	ff d0                	call   *%rax
+	return r;
+  8038c3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  8038c6:	48 83 c4 60          	add    $0x60,%rsp
+  8038ca:	5b                   	pop    %rbx
+  8038cb:	41 5f                	pop    %r15
+  8038cd:	5d                   	pop    %rbp
+  8038ce:	c3                   	ret
+
+00000000008038cf <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8038cf:	55                   	push   %rbp
+  8038d0:	48 89 e5             	mov    %rsp,%rbp
+  8038d3:	41 57                	push   %r15
+  8038d5:	53                   	push   %rbx
+  8038d6:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  8038da:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038da <devfile_write+0xb>
+  8038e1:	49 bb 56 47 00 00 00 	movabs $0x4756,%r11
+  8038e8:	00 00 00 
+  8038eb:	4c 01 db             	add    %r11,%rbx
+  8038ee:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  8038f2:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  8038f6:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  8038fd:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  803901:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  803905:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  80390c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803910:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  803917:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80391a:	48 63 d0             	movslq %eax,%rdx
+  80391d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803921:	48 39 c2             	cmp    %rax,%rdx
+  803924:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803928:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80392f:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  803936:	00 
+  803937:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80393e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803942:	48 01 d0             	add    %rdx,%rax
+  803945:	48 83 e8 01          	sub    $0x1,%rax
+  803949:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80394d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803951:	ba 00 00 00 00       	mov    $0x0,%edx
+  803956:	48 f7 75 d0          	divq   -0x30(%rbp)
+  80395a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80395e:	48 29 d0             	sub    %rdx,%rax
+  803961:	48 c1 e8 0c          	shr    $0xc,%rax
+  803965:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  803968:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80396b:	89 c6                	mov    %eax,%esi
+  80396d:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803972:	48 89 c7             	mov    %rax,%rdi
+  803975:	49 89 df             	mov    %rbx,%r15
+  803978:	48 b8 c1 de ff ff ff 	movabs $0xffffffffffffdec1,%rax
+  80397f:	ff ff ff 
+  803982:	48 01 d8             	add    %rbx,%rax
+  803985:	ff d0                	call   *%rax
+  803987:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  80398a:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  80398e:	79 08                	jns    803998 <devfile_write+0xc9>
+		return r;
+  803990:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  803993:	e9 8f 00 00 00       	jmp    803a27 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  803998:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80399f:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8039a3:	48 89 c6             	mov    %rax,%rsi
+  8039a6:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8039ab:	48 89 c7             	mov    %rax,%rdi
+  8039ae:	49 89 df             	mov    %rbx,%r15
+  8039b1:	48 b8 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rax
+  8039b8:	ff ff ff 
+  8039bb:	48 01 d8             	add    %rbx,%rax
+  8039be:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  8039c0:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  8039c4:	8b 50 0c             	mov    0xc(%rax),%edx
+  8039c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039cb:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  8039cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039d1:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8039d8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  8039dc:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  8039df:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8039e3:	89 d1                	mov    %edx,%ecx
+  8039e5:	ba 10 00 00 00       	mov    $0x10,%edx
+  8039ea:	48 89 c6             	mov    %rax,%rsi
+  8039ed:	bf 04 00 00 00       	mov    $0x4,%edi
+  8039f2:	48 b8 e9 b4 ff ff ff 	movabs $0xffffffffffffb4e9,%rax
+  8039f9:	ff ff ff 
+  8039fc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a00:	ff d0                	call   *%rax
+  803a02:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  803a05:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  803a08:	89 c6                	mov    %eax,%esi
+  803a0a:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  803a0f:	48 89 c7             	mov    %rax,%rdi
+  803a12:	49 89 df             	mov    %rbx,%r15
+  803a15:	48 b8 07 df ff ff ff 	movabs $0xffffffffffffdf07,%rax
+  803a1c:	ff ff ff 
+  803a1f:	48 01 d8             	add    %rbx,%rax
+  803a22:	ff d0                	call   *%rax
+	return r;
+  803a24:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  803a27:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  803a2b:	5b                   	pop    %rbx
+  803a2c:	41 5f                	pop    %r15
+  803a2e:	5d                   	pop    %rbp
+  803a2f:	c3                   	ret
+
+0000000000803a30 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  803a30:	55                   	push   %rbp
+  803a31:	48 89 e5             	mov    %rsp,%rbp
+  803a34:	41 57                	push   %r15
+  803a36:	53                   	push   %rbx
+  803a37:	48 83 ec 20          	sub    $0x20,%rsp
+  803a3b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a3b <devfile_stat+0xb>
+  803a42:	49 bb f5 45 00 00 00 	movabs $0x45f5,%r11
+  803a49:	00 00 00 
+  803a4c:	4c 01 db             	add    %r11,%rbx
+  803a4f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803a53:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803a57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a5b:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a5e:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803a65:	00 00 00 
+  803a68:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803a6b:	be 00 00 00 00       	mov    $0x0,%esi
+  803a70:	bf 05 00 00 00       	mov    $0x5,%edi
+  803a75:	48 b8 ad b3 ff ff ff 	movabs $0xffffffffffffb3ad,%rax
+  803a7c:	ff ff ff 
+  803a7f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a83:	ff d0                	call   *%rax
+  803a85:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803a88:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a8c:	79 05                	jns    803a93 <devfile_stat+0x63>
+		return r;
+  803a8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a91:	eb 65                	jmp    803af8 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803a93:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a97:	48 ba d0 2f 01 00 00 	movabs $0x12fd0,%rdx
+  803a9e:	00 00 00 
+  803aa1:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  803aa5:	48 89 d6             	mov    %rdx,%rsi
+  803aa8:	48 89 c7             	mov    %rax,%rdi
+  803aab:	49 89 df             	mov    %rbx,%r15
+  803aae:	48 b8 49 93 ff ff ff 	movabs $0xffffffffffff9349,%rax
+  803ab5:	ff ff ff 
+  803ab8:	48 01 d8             	add    %rbx,%rax
+  803abb:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  803abd:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803ac4:	00 00 00 
+  803ac7:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  803ace:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ad2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ad8:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803adf:	00 00 00 
+  803ae2:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  803ae9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803aed:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  803af3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803af8:	48 83 c4 20          	add    $0x20,%rsp
+  803afc:	5b                   	pop    %rbx
+  803afd:	41 5f                	pop    %r15
+  803aff:	5d                   	pop    %rbp
+  803b00:	c3                   	ret
+
+0000000000803b01 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  803b01:	55                   	push   %rbp
+  803b02:	48 89 e5             	mov    %rsp,%rbp
+  803b05:	48 83 ec 20          	sub    $0x20,%rsp
+  803b09:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803b09 <devfile_trunc+0x8>
+  803b10:	49 bb 27 45 00 00 00 	movabs $0x4527,%r11
+  803b17:	00 00 00 
+  803b1a:	4c 01 d8             	add    %r11,%rax
+  803b1d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b21:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  803b24:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803b28:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803b2b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  803b2e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803b31:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  803b34:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  803b38:	ba 08 00 00 00       	mov    $0x8,%edx
+  803b3d:	48 89 ce             	mov    %rcx,%rsi
+  803b40:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b45:	48 b9 55 b4 ff ff ff 	movabs $0xffffffffffffb455,%rcx
+  803b4c:	ff ff ff 
+  803b4f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803b53:	ff d0                	call   *%rax
+}
+  803b55:	c9                   	leave
+  803b56:	c3                   	ret
+
+0000000000803b57 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  803b57:	55                   	push   %rbp
+  803b58:	48 89 e5             	mov    %rsp,%rbp
+  803b5b:	41 57                	push   %r15
+  803b5d:	53                   	push   %rbx
+  803b5e:	48 83 ec 10          	sub    $0x10,%rsp
+  803b62:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b62 <remove+0xb>
+  803b69:	49 bb ce 44 00 00 00 	movabs $0x44ce,%r11
+  803b70:	00 00 00 
+  803b73:	4c 01 db             	add    %r11,%rbx
+  803b76:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  803b7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b7e:	48 89 c7             	mov    %rax,%rdi
+  803b81:	49 89 df             	mov    %rbx,%r15
+  803b84:	48 b8 b5 92 ff ff ff 	movabs $0xffffffffffff92b5,%rax
+  803b8b:	ff ff ff 
+  803b8e:	48 01 d8             	add    %rbx,%rax
+  803b91:	ff d0                	call   *%rax
+  803b93:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803b98:	7e 07                	jle    803ba1 <remove+0x4a>
+		return -E_BAD_PATH;
+  803b9a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803b9f:	eb 44                	jmp    803be5 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  803ba1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ba5:	48 89 c6             	mov    %rax,%rsi
+  803ba8:	48 b8 d0 2f 01 00 00 	movabs $0x12fd0,%rax
+  803baf:	00 00 00 
+  803bb2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bb6:	48 89 c7             	mov    %rax,%rdi
+  803bb9:	49 89 df             	mov    %rbx,%r15
+  803bbc:	48 b8 49 93 ff ff ff 	movabs $0xffffffffffff9349,%rax
+  803bc3:	ff ff ff 
+  803bc6:	48 01 d8             	add    %rbx,%rax
+  803bc9:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  803bcb:	be 00 00 00 00       	mov    $0x0,%esi
+  803bd0:	bf 07 00 00 00       	mov    $0x7,%edi
+  803bd5:	48 b8 ad b3 ff ff ff 	movabs $0xffffffffffffb3ad,%rax
+  803bdc:	ff ff ff 
+  803bdf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803be3:	ff d0                	call   *%rax
+}
+  803be5:	48 83 c4 10          	add    $0x10,%rsp
+  803be9:	5b                   	pop    %rbx
+  803bea:	41 5f                	pop    %r15
+  803bec:	5d                   	pop    %rbp
+  803bed:	c3                   	ret
+
+0000000000803bee <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  803bee:	55                   	push   %rbp
+  803bef:	48 89 e5             	mov    %rsp,%rbp
+  803bf2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803bf2 <sync+0x4>
+  803bf9:	49 bb 3e 44 00 00 00 	movabs $0x443e,%r11
+  803c00:	00 00 00 
+  803c03:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  803c06:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c0b:	be 00 00 00 00       	mov    $0x0,%esi
+  803c10:	bf 08 00 00 00       	mov    $0x8,%edi
+  803c15:	48 b9 55 b4 ff ff ff 	movabs $0xffffffffffffb455,%rcx
+  803c1c:	ff ff ff 
+  803c1f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  803c23:	ff d0                	call   *%rax
+}
+  803c25:	5d                   	pop    %rbp
+  803c26:	c3                   	ret
+
+0000000000803c27 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  803c27:	55                   	push   %rbp
+  803c28:	48 89 e5             	mov    %rsp,%rbp
+  803c2b:	41 57                	push   %r15
+  803c2d:	53                   	push   %rbx
+  803c2e:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  803c35:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803c35 <copy+0xe>
+  803c3c:	49 bb fb 43 00 00 00 	movabs $0x43fb,%r11
+  803c43:	00 00 00 
+  803c46:	4c 01 db             	add    %r11,%rbx
+  803c49:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  803c50:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  803c57:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  803c5e:	be 00 00 00 00       	mov    $0x0,%esi
+  803c63:	48 89 c7             	mov    %rax,%rdi
+  803c66:	48 b8 f4 b5 ff ff ff 	movabs $0xffffffffffffb5f4,%rax
+  803c6d:	ff ff ff 
+  803c70:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c74:	ff d0                	call   *%rax
+  803c76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  803c79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c7d:	79 35                	jns    803cb4 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  803c7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c82:	89 c6                	mov    %eax,%esi
+  803c84:	48 b8 a6 e5 ff ff ff 	movabs $0xffffffffffffe5a6,%rax
+  803c8b:	ff ff ff 
+  803c8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c92:	48 89 c7             	mov    %rax,%rdi
+  803c95:	49 89 df             	mov    %rbx,%r15
+  803c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c9d:	48 ba 87 85 ff ff ff 	movabs $0xffffffffffff8587,%rdx
+  803ca4:	ff ff ff 
+  803ca7:	48 01 da             	add    %rbx,%rdx
+  803caa:	ff d2                	call   *%rdx
+		return fd_src;
+  803cac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803caf:	e9 d7 01 00 00       	jmp    803e8b <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  803cb4:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  803cbb:	be 01 01 00 00       	mov    $0x101,%esi
+  803cc0:	48 89 c7             	mov    %rax,%rdi
+  803cc3:	48 b8 f4 b5 ff ff ff 	movabs $0xffffffffffffb5f4,%rax
+  803cca:	ff ff ff 
+  803ccd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cd1:	ff d0                	call   *%rax
+  803cd3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  803cd6:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803cda:	0f 89 df 00 00 00    	jns    803dbf <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  803ce0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803ce3:	89 c6                	mov    %eax,%esi
+  803ce5:	48 b8 bc e5 ff ff ff 	movabs $0xffffffffffffe5bc,%rax
+  803cec:	ff ff ff 
+  803cef:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803cf3:	48 89 c7             	mov    %rax,%rdi
+  803cf6:	49 89 df             	mov    %rbx,%r15
+  803cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cfe:	48 ba 87 85 ff ff ff 	movabs $0xffffffffffff8587,%rdx
+  803d05:	ff ff ff 
+  803d08:	48 01 da             	add    %rbx,%rdx
+  803d0b:	ff d2                	call   *%rdx
+		close(fd_src);
+  803d0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d10:	89 c7                	mov    %eax,%edi
+  803d12:	49 89 df             	mov    %rbx,%r15
+  803d15:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  803d1c:	ff ff ff 
+  803d1f:	48 01 d8             	add    %rbx,%rax
+  803d22:	ff d0                	call   *%rax
+		return fd_dest;
+  803d24:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d27:	e9 5f 01 00 00       	jmp    803e8b <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  803d2c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803d2f:	48 63 d0             	movslq %eax,%rdx
+  803d32:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803d39:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d3c:	48 89 ce             	mov    %rcx,%rsi
+  803d3f:	89 c7                	mov    %eax,%edi
+  803d41:	49 89 df             	mov    %rbx,%r15
+  803d44:	48 b8 cb af ff ff ff 	movabs $0xffffffffffffafcb,%rax
+  803d4b:	ff ff ff 
+  803d4e:	48 01 d8             	add    %rbx,%rax
+  803d51:	ff d0                	call   *%rax
+  803d53:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  803d56:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  803d5a:	79 63                	jns    803dbf <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  803d5c:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803d5f:	89 c6                	mov    %eax,%esi
+  803d61:	48 b8 d6 e5 ff ff ff 	movabs $0xffffffffffffe5d6,%rax
+  803d68:	ff ff ff 
+  803d6b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d6f:	48 89 c7             	mov    %rax,%rdi
+  803d72:	49 89 df             	mov    %rbx,%r15
+  803d75:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d7a:	48 ba 87 85 ff ff ff 	movabs $0xffffffffffff8587,%rdx
+  803d81:	ff ff ff 
+  803d84:	48 01 da             	add    %rbx,%rdx
+  803d87:	ff d2                	call   *%rdx
+			close(fd_src);
+  803d89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d8c:	89 c7                	mov    %eax,%edi
+  803d8e:	49 89 df             	mov    %rbx,%r15
+  803d91:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  803d98:	ff ff ff 
+  803d9b:	48 01 d8             	add    %rbx,%rax
+  803d9e:	ff d0                	call   *%rax
+			close(fd_dest);
+  803da0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803da3:	89 c7                	mov    %eax,%edi
+  803da5:	49 89 df             	mov    %rbx,%r15
+  803da8:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  803daf:	ff ff ff 
+  803db2:	48 01 d8             	add    %rbx,%rax
+  803db5:	ff d0                	call   *%rax
+			return write_size;
+  803db7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803dba:	e9 cc 00 00 00       	jmp    803e8b <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  803dbf:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  803dc6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dc9:	ba 00 02 00 00       	mov    $0x200,%edx
+  803dce:	48 89 ce             	mov    %rcx,%rsi
+  803dd1:	89 c7                	mov    %eax,%edi
+  803dd3:	49 89 df             	mov    %rbx,%r15
+  803dd6:	48 b8 25 ae ff ff ff 	movabs $0xffffffffffffae25,%rax
+  803ddd:	ff ff ff 
+  803de0:	48 01 d8             	add    %rbx,%rax
+  803de3:	ff d0                	call   *%rax
+  803de5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803de8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803dec:	0f 8f 3a ff ff ff    	jg     803d2c <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  803df2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803df6:	79 60                	jns    803e58 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  803df8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803dfb:	89 c6                	mov    %eax,%esi
+  803dfd:	48 b8 e9 e5 ff ff ff 	movabs $0xffffffffffffe5e9,%rax
+  803e04:	ff ff ff 
+  803e07:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803e0b:	48 89 c7             	mov    %rax,%rdi
+  803e0e:	49 89 df             	mov    %rbx,%r15
+  803e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e16:	48 ba 87 85 ff ff ff 	movabs $0xffffffffffff8587,%rdx
+  803e1d:	ff ff ff 
+  803e20:	48 01 da             	add    %rbx,%rdx
+  803e23:	ff d2                	call   *%rdx
+		close(fd_src);
+  803e25:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e28:	89 c7                	mov    %eax,%edi
+  803e2a:	49 89 df             	mov    %rbx,%r15
+  803e2d:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  803e34:	ff ff ff 
+  803e37:	48 01 d8             	add    %rbx,%rax
+  803e3a:	ff d0                	call   *%rax
+		close(fd_dest);
+  803e3c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e3f:	89 c7                	mov    %eax,%edi
+  803e41:	49 89 df             	mov    %rbx,%r15
+  803e44:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  803e4b:	ff ff ff 
+  803e4e:	48 01 d8             	add    %rbx,%rax
+  803e51:	ff d0                	call   *%rax
+		return read_size;
+  803e53:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803e56:	eb 33                	jmp    803e8b <copy+0x264>
+	}
+	close(fd_src);
+  803e58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e5b:	89 c7                	mov    %eax,%edi
+  803e5d:	49 89 df             	mov    %rbx,%r15
+  803e60:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  803e67:	ff ff ff 
+  803e6a:	48 01 d8             	add    %rbx,%rax
+  803e6d:	ff d0                	call   *%rax
+	close(fd_dest);
+  803e6f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803e72:	89 c7                	mov    %eax,%edi
+  803e74:	49 89 df             	mov    %rbx,%r15
+  803e77:	48 b8 6d ab ff ff ff 	movabs $0xffffffffffffab6d,%rax
+  803e7e:	ff ff ff 
+  803e81:	48 01 d8             	add    %rbx,%rax
+  803e84:	ff d0                	call   *%rax
+	return 0;
+  803e86:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  803e8b:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  803e92:	5b                   	pop    %rbx
+  803e93:	41 5f                	pop    %r15
+  803e95:	5d                   	pop    %rbp
+  803e96:	c3                   	ret
+
+0000000000803e97 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  803e97:	55                   	push   %rbp
+  803e98:	48 89 e5             	mov    %rsp,%rbp
+  803e9b:	41 57                	push   %r15
+  803e9d:	53                   	push   %rbx
+  803e9e:	48 83 ec 20          	sub    $0x20,%rsp
+  803ea2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ea2 <fd2sockid+0xb>
+  803ea9:	49 bb 8e 41 00 00 00 	movabs $0x418e,%r11
+  803eb0:	00 00 00 
+  803eb3:	4c 01 db             	add    %r11,%rbx
+  803eb6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803eb9:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803ebd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ec0:	48 89 d6             	mov    %rdx,%rsi
+  803ec3:	89 c7                	mov    %eax,%edi
+  803ec5:	49 89 df             	mov    %rbx,%r15
+  803ec8:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  803ecf:	ff ff ff 
+  803ed2:	48 01 d8             	add    %rbx,%rax
+  803ed5:	ff d0                	call   *%rax
+  803ed7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803eda:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ede:	79 05                	jns    803ee5 <fd2sockid+0x4e>
+		return r;
+  803ee0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ee3:	eb 25                	jmp    803f0a <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803ee5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ee9:	8b 10                	mov    (%rax),%edx
+  803eeb:	48 b8 90 00 00 00 00 	movabs $0x90,%rax
+  803ef2:	00 00 00 
+  803ef5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  803ef8:	39 c2                	cmp    %eax,%edx
+  803efa:	74 07                	je     803f03 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  803efc:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f01:	eb 07                	jmp    803f0a <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  803f03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f07:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  803f0a:	48 83 c4 20          	add    $0x20,%rsp
+  803f0e:	5b                   	pop    %rbx
+  803f0f:	41 5f                	pop    %r15
+  803f11:	5d                   	pop    %rbp
+  803f12:	c3                   	ret
+
+0000000000803f13 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  803f13:	55                   	push   %rbp
+  803f14:	48 89 e5             	mov    %rsp,%rbp
+  803f17:	41 57                	push   %r15
+  803f19:	53                   	push   %rbx
+  803f1a:	48 83 ec 20          	sub    $0x20,%rsp
+  803f1e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f1e <alloc_sockfd+0xb>
+  803f25:	49 bb 12 41 00 00 00 	movabs $0x4112,%r11
+  803f2c:	00 00 00 
+  803f2f:	4c 01 db             	add    %r11,%rbx
+  803f32:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  803f35:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803f39:	48 89 c7             	mov    %rax,%rdi
+  803f3c:	49 89 df             	mov    %rbx,%r15
+  803f3f:	48 b8 28 a8 ff ff ff 	movabs $0xffffffffffffa828,%rax
+  803f46:	ff ff ff 
+  803f49:	48 01 d8             	add    %rbx,%rax
+  803f4c:	ff d0                	call   *%rax
+  803f4e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f51:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f55:	78 2c                	js     803f83 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803f57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f5b:	ba 07 04 00 00       	mov    $0x407,%edx
+  803f60:	48 89 c6             	mov    %rax,%rsi
+  803f63:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f68:	49 89 df             	mov    %rbx,%r15
+  803f6b:	48 b8 05 a0 ff ff ff 	movabs $0xffffffffffffa005,%rax
+  803f72:	ff ff ff 
+  803f75:	48 01 d8             	add    %rbx,%rax
+  803f78:	ff d0                	call   *%rax
+  803f7a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f7d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f81:	79 1c                	jns    803f9f <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  803f83:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f86:	89 c7                	mov    %eax,%edi
+  803f88:	49 89 df             	mov    %rbx,%r15
+  803f8b:	48 b8 d7 c6 ff ff ff 	movabs $0xffffffffffffc6d7,%rax
+  803f92:	ff ff ff 
+  803f95:	48 01 d8             	add    %rbx,%rax
+  803f98:	ff d0                	call   *%rax
+		return r;
+  803f9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f9d:	eb 41                	jmp    803fe0 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  803f9f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fa3:	48 ba 90 00 00 00 00 	movabs $0x90,%rdx
+  803faa:	00 00 00 
+  803fad:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  803fb0:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  803fb2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fb6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  803fbd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fc1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803fc4:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  803fc7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fcb:	48 89 c7             	mov    %rax,%rdi
+  803fce:	49 89 df             	mov    %rbx,%r15
+  803fd1:	48 b8 ae a7 ff ff ff 	movabs $0xffffffffffffa7ae,%rax
+  803fd8:	ff ff ff 
+  803fdb:	48 01 d8             	add    %rbx,%rax
+  803fde:	ff d0                	call   *%rax
+}
+  803fe0:	48 83 c4 20          	add    $0x20,%rsp
+  803fe4:	5b                   	pop    %rbx
+  803fe5:	41 5f                	pop    %r15
+  803fe7:	5d                   	pop    %rbp
+  803fe8:	c3                   	ret
+
+0000000000803fe9 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  803fe9:	55                   	push   %rbp
+  803fea:	48 89 e5             	mov    %rsp,%rbp
+  803fed:	41 57                	push   %r15
+  803fef:	53                   	push   %rbx
+  803ff0:	48 83 ec 30          	sub    $0x30,%rsp
+  803ff4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ff4 <accept+0xb>
+  803ffb:	49 bb 3c 40 00 00 00 	movabs $0x403c,%r11
+  804002:	00 00 00 
+  804005:	4c 01 db             	add    %r11,%rbx
+  804008:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80400b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80400f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804013:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804016:	89 c7                	mov    %eax,%edi
+  804018:	48 b8 67 be ff ff ff 	movabs $0xffffffffffffbe67,%rax
+  80401f:	ff ff ff 
+  804022:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804026:	ff d0                	call   *%rax
+  804028:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80402b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80402f:	79 05                	jns    804036 <accept+0x4d>
+		return r;
+  804031:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804034:	eb 45                	jmp    80407b <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804036:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80403a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80403e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804041:	48 89 ce             	mov    %rcx,%rsi
+  804044:	89 c7                	mov    %eax,%edi
+  804046:	49 89 df             	mov    %rbx,%r15
+  804049:	48 b8 45 c5 ff ff ff 	movabs $0xffffffffffffc545,%rax
+  804050:	ff ff ff 
+  804053:	48 01 d8             	add    %rbx,%rax
+  804056:	ff d0                	call   *%rax
+  804058:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80405b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80405f:	79 05                	jns    804066 <accept+0x7d>
+		return r;
+  804061:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804064:	eb 15                	jmp    80407b <accept+0x92>
+	return alloc_sockfd(r);
+  804066:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804069:	89 c7                	mov    %eax,%edi
+  80406b:	48 b8 e3 be ff ff ff 	movabs $0xffffffffffffbee3,%rax
+  804072:	ff ff ff 
+  804075:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804079:	ff d0                	call   *%rax
+}
+  80407b:	48 83 c4 30          	add    $0x30,%rsp
+  80407f:	5b                   	pop    %rbx
+  804080:	41 5f                	pop    %r15
+  804082:	5d                   	pop    %rbp
+  804083:	c3                   	ret
+
+0000000000804084 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804084:	55                   	push   %rbp
+  804085:	48 89 e5             	mov    %rsp,%rbp
+  804088:	41 57                	push   %r15
+  80408a:	53                   	push   %rbx
+  80408b:	48 83 ec 20          	sub    $0x20,%rsp
+  80408f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80408f <bind+0xb>
+  804096:	49 bb a1 3f 00 00 00 	movabs $0x3fa1,%r11
+  80409d:	00 00 00 
+  8040a0:	4c 01 db             	add    %r11,%rbx
+  8040a3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8040a6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8040aa:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8040ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040b0:	89 c7                	mov    %eax,%edi
+  8040b2:	48 b8 67 be ff ff ff 	movabs $0xffffffffffffbe67,%rax
+  8040b9:	ff ff ff 
+  8040bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040c0:	ff d0                	call   *%rax
+  8040c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040c9:	79 05                	jns    8040d0 <bind+0x4c>
+		return r;
+  8040cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040ce:	eb 21                	jmp    8040f1 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  8040d0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8040d3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8040d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040da:	48 89 ce             	mov    %rcx,%rsi
+  8040dd:	89 c7                	mov    %eax,%edi
+  8040df:	49 89 df             	mov    %rbx,%r15
+  8040e2:	48 b8 f1 c5 ff ff ff 	movabs $0xffffffffffffc5f1,%rax
+  8040e9:	ff ff ff 
+  8040ec:	48 01 d8             	add    %rbx,%rax
+  8040ef:	ff d0                	call   *%rax
+}
+  8040f1:	48 83 c4 20          	add    $0x20,%rsp
+  8040f5:	5b                   	pop    %rbx
+  8040f6:	41 5f                	pop    %r15
+  8040f8:	5d                   	pop    %rbp
+  8040f9:	c3                   	ret
+
+00000000008040fa <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8040fa:	55                   	push   %rbp
+  8040fb:	48 89 e5             	mov    %rsp,%rbp
+  8040fe:	41 57                	push   %r15
+  804100:	53                   	push   %rbx
+  804101:	48 83 ec 20          	sub    $0x20,%rsp
+  804105:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804105 <shutdown+0xb>
+  80410c:	49 bb 2b 3f 00 00 00 	movabs $0x3f2b,%r11
+  804113:	00 00 00 
+  804116:	4c 01 db             	add    %r11,%rbx
+  804119:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80411c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80411f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804122:	89 c7                	mov    %eax,%edi
+  804124:	48 b8 67 be ff ff ff 	movabs $0xffffffffffffbe67,%rax
+  80412b:	ff ff ff 
+  80412e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804132:	ff d0                	call   *%rax
+  804134:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804137:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80413b:	79 05                	jns    804142 <shutdown+0x48>
+		return r;
+  80413d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804140:	eb 1c                	jmp    80415e <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804142:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804145:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804148:	89 d6                	mov    %edx,%esi
+  80414a:	89 c7                	mov    %eax,%edi
+  80414c:	49 89 df             	mov    %rbx,%r15
+  80414f:	48 b8 86 c6 ff ff ff 	movabs $0xffffffffffffc686,%rax
+  804156:	ff ff ff 
+  804159:	48 01 d8             	add    %rbx,%rax
+  80415c:	ff d0                	call   *%rax
+}
+  80415e:	48 83 c4 20          	add    $0x20,%rsp
+  804162:	5b                   	pop    %rbx
+  804163:	41 5f                	pop    %r15
+  804165:	5d                   	pop    %rbp
+  804166:	c3                   	ret
+
+0000000000804167 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804167:	55                   	push   %rbp
+  804168:	48 89 e5             	mov    %rsp,%rbp
+  80416b:	41 57                	push   %r15
+  80416d:	53                   	push   %rbx
+  80416e:	48 83 ec 10          	sub    $0x10,%rsp
+  804172:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804172 <devsock_close+0xb>
+  804179:	49 bb be 3e 00 00 00 	movabs $0x3ebe,%r11
+  804180:	00 00 00 
+  804183:	4c 01 db             	add    %r11,%rbx
+  804186:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  80418a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80418e:	48 89 c7             	mov    %rax,%rdi
+  804191:	49 89 df             	mov    %rbx,%r15
+  804194:	48 b8 dc df ff ff ff 	movabs $0xffffffffffffdfdc,%rax
+  80419b:	ff ff ff 
+  80419e:	48 01 d8             	add    %rbx,%rax
+  8041a1:	ff d0                	call   *%rax
+  8041a3:	83 f8 01             	cmp    $0x1,%eax
+  8041a6:	75 1d                	jne    8041c5 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  8041a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041ac:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041af:	89 c7                	mov    %eax,%edi
+  8041b1:	49 89 df             	mov    %rbx,%r15
+  8041b4:	48 b8 d7 c6 ff ff ff 	movabs $0xffffffffffffc6d7,%rax
+  8041bb:	ff ff ff 
+  8041be:	48 01 d8             	add    %rbx,%rax
+  8041c1:	ff d0                	call   *%rax
+  8041c3:	eb 05                	jmp    8041ca <devsock_close+0x63>
+	else
+		return 0;
+  8041c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041ca:	48 83 c4 10          	add    $0x10,%rsp
+  8041ce:	5b                   	pop    %rbx
+  8041cf:	41 5f                	pop    %r15
+  8041d1:	5d                   	pop    %rbp
+  8041d2:	c3                   	ret
+
+00000000008041d3 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8041d3:	55                   	push   %rbp
+  8041d4:	48 89 e5             	mov    %rsp,%rbp
+  8041d7:	41 57                	push   %r15
+  8041d9:	53                   	push   %rbx
+  8041da:	48 83 ec 20          	sub    $0x20,%rsp
+  8041de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041de <connect+0xb>
+  8041e5:	49 bb 52 3e 00 00 00 	movabs $0x3e52,%r11
+  8041ec:	00 00 00 
+  8041ef:	4c 01 db             	add    %r11,%rbx
+  8041f2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8041f5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8041f9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8041fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041ff:	89 c7                	mov    %eax,%edi
+  804201:	48 b8 67 be ff ff ff 	movabs $0xffffffffffffbe67,%rax
+  804208:	ff ff ff 
+  80420b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80420f:	ff d0                	call   *%rax
+  804211:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804214:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804218:	79 05                	jns    80421f <connect+0x4c>
+		return r;
+  80421a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80421d:	eb 21                	jmp    804240 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80421f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804222:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804226:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804229:	48 89 ce             	mov    %rcx,%rsi
+  80422c:	89 c7                	mov    %eax,%edi
+  80422e:	49 89 df             	mov    %rbx,%r15
+  804231:	48 b8 1f c7 ff ff ff 	movabs $0xffffffffffffc71f,%rax
+  804238:	ff ff ff 
+  80423b:	48 01 d8             	add    %rbx,%rax
+  80423e:	ff d0                	call   *%rax
+}
+  804240:	48 83 c4 20          	add    $0x20,%rsp
+  804244:	5b                   	pop    %rbx
+  804245:	41 5f                	pop    %r15
+  804247:	5d                   	pop    %rbp
+  804248:	c3                   	ret
+
+0000000000804249 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804249:	55                   	push   %rbp
+  80424a:	48 89 e5             	mov    %rsp,%rbp
+  80424d:	41 57                	push   %r15
+  80424f:	53                   	push   %rbx
+  804250:	48 83 ec 20          	sub    $0x20,%rsp
+  804254:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804254 <listen+0xb>
+  80425b:	49 bb dc 3d 00 00 00 	movabs $0x3ddc,%r11
+  804262:	00 00 00 
+  804265:	4c 01 db             	add    %r11,%rbx
+  804268:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80426b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80426e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804271:	89 c7                	mov    %eax,%edi
+  804273:	48 b8 67 be ff ff ff 	movabs $0xffffffffffffbe67,%rax
+  80427a:	ff ff ff 
+  80427d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804281:	ff d0                	call   *%rax
+  804283:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804286:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80428a:	79 05                	jns    804291 <listen+0x48>
+		return r;
+  80428c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80428f:	eb 1c                	jmp    8042ad <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804291:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804294:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804297:	89 d6                	mov    %edx,%esi
+  804299:	89 c7                	mov    %eax,%edi
+  80429b:	49 89 df             	mov    %rbx,%r15
+  80429e:	48 b8 b4 c7 ff ff ff 	movabs $0xffffffffffffc7b4,%rax
+  8042a5:	ff ff ff 
+  8042a8:	48 01 d8             	add    %rbx,%rax
+  8042ab:	ff d0                	call   *%rax
+}
+  8042ad:	48 83 c4 20          	add    $0x20,%rsp
+  8042b1:	5b                   	pop    %rbx
+  8042b2:	41 5f                	pop    %r15
+  8042b4:	5d                   	pop    %rbp
+  8042b5:	c3                   	ret
+
+00000000008042b6 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8042b6:	55                   	push   %rbp
+  8042b7:	48 89 e5             	mov    %rsp,%rbp
+  8042ba:	41 57                	push   %r15
+  8042bc:	48 83 ec 28          	sub    $0x28,%rsp
+  8042c0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8042c0 <devsock_read+0xa>
+  8042c7:	49 bb 70 3d 00 00 00 	movabs $0x3d70,%r11
+  8042ce:	00 00 00 
+  8042d1:	4c 01 d8             	add    %r11,%rax
+  8042d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8042dc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8042e0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042e4:	41 89 d0             	mov    %edx,%r8d
+  8042e7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8042eb:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8042ee:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8042f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8042f7:	44 89 c2             	mov    %r8d,%edx
+  8042fa:	49 89 c7             	mov    %rax,%r15
+  8042fd:	49 b8 05 c8 ff ff ff 	movabs $0xffffffffffffc805,%r8
+  804304:	ff ff ff 
+  804307:	49 01 c0             	add    %rax,%r8
+  80430a:	41 ff d0             	call   *%r8
+}
+  80430d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804311:	c9                   	leave
+  804312:	c3                   	ret
+
+0000000000804313 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804313:	55                   	push   %rbp
+  804314:	48 89 e5             	mov    %rsp,%rbp
+  804317:	41 57                	push   %r15
+  804319:	48 83 ec 28          	sub    $0x28,%rsp
+  80431d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80431d <devsock_write+0xa>
+  804324:	49 bb 13 3d 00 00 00 	movabs $0x3d13,%r11
+  80432b:	00 00 00 
+  80432e:	4c 01 d8             	add    %r11,%rax
+  804331:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804335:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804339:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80433d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804341:	41 89 d0             	mov    %edx,%r8d
+  804344:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804348:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80434b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80434f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804354:	44 89 c2             	mov    %r8d,%edx
+  804357:	49 89 c7             	mov    %rax,%r15
+  80435a:	49 b8 22 c9 ff ff ff 	movabs $0xffffffffffffc922,%r8
+  804361:	ff ff ff 
+  804364:	49 01 c0             	add    %rax,%r8
+  804367:	41 ff d0             	call   *%r8
+}
+  80436a:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80436e:	c9                   	leave
+  80436f:	c3                   	ret
+
+0000000000804370 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  804370:	55                   	push   %rbp
+  804371:	48 89 e5             	mov    %rsp,%rbp
+  804374:	41 57                	push   %r15
+  804376:	48 83 ec 18          	sub    $0x18,%rsp
+  80437a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80437a <devsock_stat+0xa>
+  804381:	49 bb b6 3c 00 00 00 	movabs $0x3cb6,%r11
+  804388:	00 00 00 
+  80438b:	4c 01 d8             	add    %r11,%rax
+  80438e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804392:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  804396:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80439a:	48 b9 04 e6 ff ff ff 	movabs $0xffffffffffffe604,%rcx
+  8043a1:	ff ff ff 
+  8043a4:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8043a8:	48 89 ce             	mov    %rcx,%rsi
+  8043ab:	48 89 d7             	mov    %rdx,%rdi
+  8043ae:	49 89 c7             	mov    %rax,%r15
+  8043b1:	48 ba 49 93 ff ff ff 	movabs $0xffffffffffff9349,%rdx
+  8043b8:	ff ff ff 
+  8043bb:	48 01 c2             	add    %rax,%rdx
+  8043be:	ff d2                	call   *%rdx
+	return 0;
+  8043c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043c5:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8043c9:	c9                   	leave
+  8043ca:	c3                   	ret
+
+00000000008043cb <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8043cb:	55                   	push   %rbp
+  8043cc:	48 89 e5             	mov    %rsp,%rbp
+  8043cf:	41 57                	push   %r15
+  8043d1:	53                   	push   %rbx
+  8043d2:	48 83 ec 20          	sub    $0x20,%rsp
+  8043d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043d6 <socket+0xb>
+  8043dd:	49 bb 5a 3c 00 00 00 	movabs $0x3c5a,%r11
+  8043e4:	00 00 00 
+  8043e7:	4c 01 db             	add    %r11,%rbx
+  8043ea:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8043ed:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8043f0:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8043f3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8043f6:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8043f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043fc:	89 ce                	mov    %ecx,%esi
+  8043fe:	89 c7                	mov    %eax,%edi
+  804400:	49 89 df             	mov    %rbx,%r15
+  804403:	48 b8 f9 ca ff ff ff 	movabs $0xffffffffffffcaf9,%rax
+  80440a:	ff ff ff 
+  80440d:	48 01 d8             	add    %rbx,%rax
+  804410:	ff d0                	call   *%rax
+  804412:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804415:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804419:	79 05                	jns    804420 <socket+0x55>
+		return r;
+  80441b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80441e:	eb 15                	jmp    804435 <socket+0x6a>
+	return alloc_sockfd(r);
+  804420:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804423:	89 c7                	mov    %eax,%edi
+  804425:	48 b8 e3 be ff ff ff 	movabs $0xffffffffffffbee3,%rax
+  80442c:	ff ff ff 
+  80442f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804433:	ff d0                	call   *%rax
+}
+  804435:	48 83 c4 20          	add    $0x20,%rsp
+  804439:	5b                   	pop    %rbx
+  80443a:	41 5f                	pop    %r15
+  80443c:	5d                   	pop    %rbp
+  80443d:	c3                   	ret
+
+000000000080443e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80443e:	55                   	push   %rbp
+  80443f:	48 89 e5             	mov    %rsp,%rbp
+  804442:	41 57                	push   %r15
+  804444:	53                   	push   %rbx
+  804445:	48 83 ec 10          	sub    $0x10,%rsp
+  804449:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804449 <nsipc+0xb>
+  804450:	49 bb e7 3b 00 00 00 	movabs $0x3be7,%r11
+  804457:	00 00 00 
+  80445a:	4c 01 db             	add    %r11,%rbx
+  80445d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  804460:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804467:	00 00 00 
+  80446a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80446d:	85 c0                	test   %eax,%eax
+  80446f:	75 24                	jne    804495 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  804471:	bf 02 00 00 00       	mov    $0x2,%edi
+  804476:	49 89 df             	mov    %rbx,%r15
+  804479:	48 b8 4d df ff ff ff 	movabs $0xffffffffffffdf4d,%rax
+  804480:	ff ff ff 
+  804483:	48 01 d8             	add    %rbx,%rax
+  804486:	ff d0                	call   *%rax
+  804488:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  80448f:	00 00 00 
+  804492:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  804495:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80449c:	00 00 00 
+  80449f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8044a2:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8044a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8044ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8044b1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8044b6:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8044bd:	00 00 00 
+  8044c0:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8044c4:	89 c7                	mov    %eax,%edi
+  8044c6:	49 89 df             	mov    %rbx,%r15
+  8044c9:	48 b8 6c d9 ff ff ff 	movabs $0xffffffffffffd96c,%rax
+  8044d0:	ff ff ff 
+  8044d3:	48 01 d8             	add    %rbx,%rax
+  8044d6:	ff d0                	call   *%rax
+}
+  8044d8:	48 83 c4 10          	add    $0x10,%rsp
+  8044dc:	5b                   	pop    %rbx
+  8044dd:	41 5f                	pop    %r15
+  8044df:	5d                   	pop    %rbp
+  8044e0:	c3                   	ret
+
+00000000008044e1 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  8044e1:	55                   	push   %rbp
+  8044e2:	48 89 e5             	mov    %rsp,%rbp
+  8044e5:	41 57                	push   %r15
+  8044e7:	53                   	push   %rbx
+  8044e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8044ec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044ec <nsipc_words+0xb>
+  8044f3:	49 bb 44 3b 00 00 00 	movabs $0x3b44,%r11
+  8044fa:	00 00 00 
+  8044fd:	4c 01 db             	add    %r11,%rbx
+  804500:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804503:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804507:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80450b:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804512:	00 00 00 
+  804515:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804518:	85 c0                	test   %eax,%eax
+  80451a:	75 24                	jne    804540 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80451c:	bf 02 00 00 00       	mov    $0x2,%edi
+  804521:	49 89 df             	mov    %rbx,%r15
+  804524:	48 b8 4d df ff ff ff 	movabs $0xffffffffffffdf4d,%rax
+  80452b:	ff ff ff 
+  80452e:	48 01 d8             	add    %rbx,%rax
+  804531:	ff d0                	call   *%rax
+  804533:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  80453a:	00 00 00 
+  80453d:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  804540:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804547:	00 00 00 
+  80454a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80454d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804551:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804555:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804558:	89 c7                	mov    %eax,%edi
+  80455a:	49 89 df             	mov    %rbx,%r15
+  80455d:	48 b8 57 da ff ff ff 	movabs $0xffffffffffffda57,%rax
+  804564:	ff ff ff 
+  804567:	48 01 d8             	add    %rbx,%rax
+  80456a:	ff d0                	call   *%rax
+}
+  80456c:	48 83 c4 20          	add    $0x20,%rsp
+  804570:	5b                   	pop    %rbx
+  804571:	41 5f                	pop    %r15
+  804573:	5d                   	pop    %rbp
+  804574:	c3                   	ret
+
+0000000000804575 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804575:	55                   	push   %rbp
+  804576:	48 89 e5             	mov    %rsp,%rbp
+  804579:	41 57                	push   %r15
+  80457b:	53                   	push   %rbx
+  80457c:	48 83 ec 30          	sub    $0x30,%rsp
+  804580:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804580 <nsipc_accept+0xb>
+  804587:	49 bb b0 3a 00 00 00 	movabs $0x3ab0,%r11
+  80458e:	00 00 00 
+  804591:	4c 01 db             	add    %r11,%rbx
+  804594:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804597:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80459b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80459f:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8045a6:	00 00 00 
+  8045a9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045ac:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8045af:	bf 01 00 00 00       	mov    $0x1,%edi
+  8045b4:	48 b8 0e c4 ff ff ff 	movabs $0xffffffffffffc40e,%rax
+  8045bb:	ff ff ff 
+  8045be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045c2:	ff d0                	call   *%rax
+  8045c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8045c7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045cb:	78 48                	js     804615 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  8045cd:	48 b8 d0 3f 01 00 00 	movabs $0x13fd0,%rax
+  8045d4:	00 00 00 
+  8045d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045db:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8045df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045e3:	8b 40 10             	mov    0x10(%rax),%eax
+  8045e6:	89 c2                	mov    %eax,%edx
+  8045e8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8045ec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045f0:	48 89 ce             	mov    %rcx,%rsi
+  8045f3:	48 89 c7             	mov    %rax,%rdi
+  8045f6:	49 89 df             	mov    %rbx,%r15
+  8045f9:	48 b8 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rax
+  804600:	ff ff ff 
+  804603:	48 01 d8             	add    %rbx,%rax
+  804606:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  804608:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80460c:	8b 50 10             	mov    0x10(%rax),%edx
+  80460f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804613:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  804615:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804618:	48 83 c4 30          	add    $0x30,%rsp
+  80461c:	5b                   	pop    %rbx
+  80461d:	41 5f                	pop    %r15
+  80461f:	5d                   	pop    %rbp
+  804620:	c3                   	ret
+
+0000000000804621 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804621:	55                   	push   %rbp
+  804622:	48 89 e5             	mov    %rsp,%rbp
+  804625:	41 57                	push   %r15
+  804627:	53                   	push   %rbx
+  804628:	48 83 ec 10          	sub    $0x10,%rsp
+  80462c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80462c <nsipc_bind+0xb>
+  804633:	49 bb 04 3a 00 00 00 	movabs $0x3a04,%r11
+  80463a:	00 00 00 
+  80463d:	4c 01 db             	add    %r11,%rbx
+  804640:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804643:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804647:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  80464a:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804651:	00 00 00 
+  804654:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804657:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80465a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80465d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804661:	48 89 c6             	mov    %rax,%rsi
+  804664:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  80466b:	00 00 00 
+  80466e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804672:	48 89 c7             	mov    %rax,%rdi
+  804675:	49 89 df             	mov    %rbx,%r15
+  804678:	48 b8 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rax
+  80467f:	ff ff ff 
+  804682:	48 01 d8             	add    %rbx,%rax
+  804685:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  804687:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80468e:	00 00 00 
+  804691:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804694:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  804698:	bf 02 00 00 00       	mov    $0x2,%edi
+  80469d:	48 b8 0e c4 ff ff ff 	movabs $0xffffffffffffc40e,%rax
+  8046a4:	ff ff ff 
+  8046a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046ab:	ff d0                	call   *%rax
+}
+  8046ad:	48 83 c4 10          	add    $0x10,%rsp
+  8046b1:	5b                   	pop    %rbx
+  8046b2:	41 5f                	pop    %r15
+  8046b4:	5d                   	pop    %rbp
+  8046b5:	c3                   	ret
+
+00000000008046b6 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8046b6:	55                   	push   %rbp
+  8046b7:	48 89 e5             	mov    %rsp,%rbp
+  8046ba:	48 83 ec 20          	sub    $0x20,%rsp
+  8046be:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8046be <nsipc_shutdown+0x8>
+  8046c5:	49 bb 72 39 00 00 00 	movabs $0x3972,%r11
+  8046cc:	00 00 00 
+  8046cf:	4c 01 d8             	add    %r11,%rax
+  8046d2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8046d5:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  8046d8:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8046db:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  8046de:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8046e1:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  8046e4:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8046e8:	ba 08 00 00 00       	mov    $0x8,%edx
+  8046ed:	48 89 ce             	mov    %rcx,%rsi
+  8046f0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8046f5:	48 b9 b1 c4 ff ff ff 	movabs $0xffffffffffffc4b1,%rcx
+  8046fc:	ff ff ff 
+  8046ff:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804703:	ff d0                	call   *%rax
+}
+  804705:	c9                   	leave
+  804706:	c3                   	ret
+
+0000000000804707 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  804707:	55                   	push   %rbp
+  804708:	48 89 e5             	mov    %rsp,%rbp
+  80470b:	48 83 ec 20          	sub    $0x20,%rsp
+  80470f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80470f <nsipc_close+0x8>
+  804716:	49 bb 21 39 00 00 00 	movabs $0x3921,%r11
+  80471d:	00 00 00 
+  804720:	4c 01 d8             	add    %r11,%rax
+  804723:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  804726:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804729:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80472c:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804730:	ba 04 00 00 00       	mov    $0x4,%edx
+  804735:	48 89 ce             	mov    %rcx,%rsi
+  804738:	bf 04 00 00 00       	mov    $0x4,%edi
+  80473d:	48 b9 b1 c4 ff ff ff 	movabs $0xffffffffffffc4b1,%rcx
+  804744:	ff ff ff 
+  804747:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80474b:	ff d0                	call   *%rax
+}
+  80474d:	c9                   	leave
+  80474e:	c3                   	ret
+
+000000000080474f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80474f:	55                   	push   %rbp
+  804750:	48 89 e5             	mov    %rsp,%rbp
+  804753:	41 57                	push   %r15
+  804755:	53                   	push   %rbx
+  804756:	48 83 ec 10          	sub    $0x10,%rsp
+  80475a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80475a <nsipc_connect+0xb>
+  804761:	49 bb d6 38 00 00 00 	movabs $0x38d6,%r11
+  804768:	00 00 00 
+  80476b:	4c 01 db             	add    %r11,%rbx
+  80476e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804771:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804775:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  804778:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  80477f:	00 00 00 
+  804782:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804785:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  804788:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80478b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80478f:	48 89 c6             	mov    %rax,%rsi
+  804792:	48 b8 d4 3f 01 00 00 	movabs $0x13fd4,%rax
+  804799:	00 00 00 
+  80479c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047a0:	48 89 c7             	mov    %rax,%rdi
+  8047a3:	49 89 df             	mov    %rbx,%r15
+  8047a6:	48 b8 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rax
+  8047ad:	ff ff ff 
+  8047b0:	48 01 d8             	add    %rbx,%rax
+  8047b3:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8047b5:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  8047bc:	00 00 00 
+  8047bf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8047c2:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  8047c6:	bf 05 00 00 00       	mov    $0x5,%edi
+  8047cb:	48 b8 0e c4 ff ff ff 	movabs $0xffffffffffffc40e,%rax
+  8047d2:	ff ff ff 
+  8047d5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047d9:	ff d0                	call   *%rax
+}
+  8047db:	48 83 c4 10          	add    $0x10,%rsp
+  8047df:	5b                   	pop    %rbx
+  8047e0:	41 5f                	pop    %r15
+  8047e2:	5d                   	pop    %rbp
+  8047e3:	c3                   	ret
+
+00000000008047e4 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8047e4:	55                   	push   %rbp
+  8047e5:	48 89 e5             	mov    %rsp,%rbp
+  8047e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8047ec:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8047ec <nsipc_listen+0x8>
+  8047f3:	49 bb 44 38 00 00 00 	movabs $0x3844,%r11
+  8047fa:	00 00 00 
+  8047fd:	4c 01 d8             	add    %r11,%rax
+  804800:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804803:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  804806:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804809:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  80480c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80480f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  804812:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  804816:	ba 08 00 00 00       	mov    $0x8,%edx
+  80481b:	48 89 ce             	mov    %rcx,%rsi
+  80481e:	bf 06 00 00 00       	mov    $0x6,%edi
+  804823:	48 b9 b1 c4 ff ff ff 	movabs $0xffffffffffffc4b1,%rcx
+  80482a:	ff ff ff 
+  80482d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804831:	ff d0                	call   *%rax
+}
+  804833:	c9                   	leave
+  804834:	c3                   	ret
+
+0000000000804835 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  804835:	55                   	push   %rbp
+  804836:	48 89 e5             	mov    %rsp,%rbp
+  804839:	41 57                	push   %r15
+  80483b:	53                   	push   %rbx
+  80483c:	48 83 ec 30          	sub    $0x30,%rsp
+  804840:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804840 <nsipc_recv+0xb>
+  804847:	49 bb f0 37 00 00 00 	movabs $0x37f0,%r11
+  80484e:	00 00 00 
+  804851:	4c 01 db             	add    %r11,%rbx
+  804854:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804857:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80485b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  80485e:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  804861:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804868:	00 00 00 
+  80486b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80486e:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  804871:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804878:	00 00 00 
+  80487b:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80487e:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  804882:	48 ba d0 3f 01 00 00 	movabs $0x13fd0,%rdx
+  804889:	00 00 00 
+  80488c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80488f:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  804893:	bf 07 00 00 00       	mov    $0x7,%edi
+  804898:	48 b8 0e c4 ff ff ff 	movabs $0xffffffffffffc40e,%rax
+  80489f:	ff ff ff 
+  8048a2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048a6:	ff d0                	call   *%rax
+  8048a8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048ab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048af:	0f 88 91 00 00 00    	js     804946 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8048b5:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8048bc:	7f 08                	jg     8048c6 <nsipc_recv+0x91>
+  8048be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048c1:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  8048c4:	7e 50                	jle    804916 <nsipc_recv+0xe1>
+  8048c6:	48 b8 0b e6 ff ff ff 	movabs $0xffffffffffffe60b,%rax
+  8048cd:	ff ff ff 
+  8048d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048d4:	48 89 c1             	mov    %rax,%rcx
+  8048d7:	48 b8 20 e6 ff ff ff 	movabs $0xffffffffffffe620,%rax
+  8048de:	ff ff ff 
+  8048e1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048e5:	48 89 c2             	mov    %rax,%rdx
+  8048e8:	be 79 00 00 00       	mov    $0x79,%esi
+  8048ed:	48 b8 35 e6 ff ff ff 	movabs $0xffffffffffffe635,%rax
+  8048f4:	ff ff ff 
+  8048f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048fb:	48 89 c7             	mov    %rax,%rdi
+  8048fe:	49 89 df             	mov    %rbx,%r15
+  804901:	b8 00 00 00 00       	mov    $0x0,%eax
+  804906:	49 b8 b7 d6 ff ff ff 	movabs $0xffffffffffffd6b7,%r8
+  80490d:	ff ff ff 
+  804910:	49 01 d8             	add    %rbx,%r8
+  804913:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  804916:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804919:	48 63 d0             	movslq %eax,%rdx
+  80491c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804920:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804927:	00 00 00 
+  80492a:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  80492e:	48 89 ce             	mov    %rcx,%rsi
+  804931:	48 89 c7             	mov    %rax,%rdi
+  804934:	49 89 df             	mov    %rbx,%r15
+  804937:	48 b8 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rax
+  80493e:	ff ff ff 
+  804941:	48 01 d8             	add    %rbx,%rax
+  804944:	ff d0                	call   *%rax
+	}
+
+	return r;
+  804946:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804949:	48 83 c4 30          	add    $0x30,%rsp
+  80494d:	5b                   	pop    %rbx
+  80494e:	41 5f                	pop    %r15
+  804950:	5d                   	pop    %rbp
+  804951:	c3                   	ret
+
+0000000000804952 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  804952:	55                   	push   %rbp
+  804953:	48 89 e5             	mov    %rsp,%rbp
+  804956:	41 57                	push   %r15
+  804958:	53                   	push   %rbx
+  804959:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  804960:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804960 <nsipc_send+0xe>
+  804967:	49 bb d0 36 00 00 00 	movabs $0x36d0,%r11
+  80496e:	00 00 00 
+  804971:	4c 01 db             	add    %r11,%rbx
+  804974:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  80497a:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  804981:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  804987:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  80498d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804991:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  804995:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  80499c:	00 00 00 
+  80499f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049a2:	85 c0                	test   %eax,%eax
+  8049a4:	75 24                	jne    8049ca <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8049a6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8049ab:	49 89 df             	mov    %rbx,%r15
+  8049ae:	48 b8 4d df ff ff ff 	movabs $0xffffffffffffdf4d,%rax
+  8049b5:	ff ff ff 
+  8049b8:	48 01 d8             	add    %rbx,%rax
+  8049bb:	ff d0                	call   *%rax
+  8049bd:	48 ba d0 1f 01 00 00 	movabs $0x11fd0,%rdx
+  8049c4:	00 00 00 
+  8049c7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  8049ca:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8049d0:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8049d3:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  8049da:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8049dd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8049e0:	39 c2                	cmp    %eax,%edx
+  8049e2:	0f 4e c2             	cmovle %edx,%eax
+  8049e5:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  8049eb:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8049f1:	48 63 d0             	movslq %eax,%rdx
+  8049f4:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8049fb:	48 89 c6             	mov    %rax,%rsi
+  8049fe:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804a05:	00 00 00 
+  804a08:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a0c:	48 89 c7             	mov    %rax,%rdi
+  804a0f:	49 89 df             	mov    %rbx,%r15
+  804a12:	48 b8 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rax
+  804a19:	ff ff ff 
+  804a1c:	48 01 d8             	add    %rbx,%rax
+  804a1f:	ff d0                	call   *%rax
+	req->req_s = s;
+  804a21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a25:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  804a2b:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  804a2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a31:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  804a37:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  804a3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a3e:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  804a44:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  804a47:	48 b8 d0 1f 00 00 00 	movabs $0x1fd0,%rax
+  804a4e:	00 00 00 
+  804a51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a55:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  804a59:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  804a60:	00 
+  804a61:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  804a67:	48 63 d0             	movslq %eax,%rdx
+  804a6a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a6e:	48 01 d0             	add    %rdx,%rax
+  804a71:	48 83 e8 01          	sub    $0x1,%rax
+  804a75:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804a79:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a82:	48 f7 75 d8          	divq   -0x28(%rbp)
+  804a86:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a8a:	48 29 d0             	sub    %rdx,%rax
+  804a8d:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  804a93:	85 c0                	test   %eax,%eax
+  804a95:	0f 48 c2             	cmovs  %edx,%eax
+  804a98:	c1 f8 0c             	sar    $0xc,%eax
+  804a9b:	48 98                	cltq
+  804a9d:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  804aa1:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804aa5:	48 85 c0             	test   %rax,%rax
+  804aa8:	0f 95 c0             	setne  %al
+  804aab:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  804aae:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  804ab5:	00 
+  804ab6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aba:	48 83 c0 0b          	add    $0xb,%rax
+  804abe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804ac2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ac6:	ba 00 00 00 00       	mov    $0x0,%edx
+  804acb:	48 f7 75 c8          	divq   -0x38(%rbp)
+  804acf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ad3:	48 29 d0             	sub    %rdx,%rax
+  804ad6:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  804ada:	89 c7                	mov    %eax,%edi
+  804adc:	48 b8 d0 1f 01 00 00 	movabs $0x11fd0,%rax
+  804ae3:	00 00 00 
+  804ae6:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ae9:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  804aed:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  804af1:	48 83 ec 08          	sub    $0x8,%rsp
+  804af5:	6a 00                	push   $0x0
+  804af7:	6a 00                	push   $0x0
+  804af9:	6a 05                	push   $0x5
+  804afb:	41 89 f1             	mov    %esi,%r9d
+  804afe:	49 89 c8             	mov    %rcx,%r8
+  804b01:	89 f9                	mov    %edi,%ecx
+  804b03:	be 08 00 00 00       	mov    $0x8,%esi
+  804b08:	89 c7                	mov    %eax,%edi
+  804b0a:	49 89 df             	mov    %rbx,%r15
+  804b0d:	48 b8 55 db ff ff ff 	movabs $0xffffffffffffdb55,%rax
+  804b14:	ff ff ff 
+  804b17:	48 01 d8             	add    %rbx,%rax
+  804b1a:	ff d0                	call   *%rax
+  804b1c:	48 83 c4 20          	add    $0x20,%rsp
+}
+  804b20:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804b24:	5b                   	pop    %rbx
+  804b25:	41 5f                	pop    %r15
+  804b27:	5d                   	pop    %rbp
+  804b28:	c3                   	ret
+
+0000000000804b29 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  804b29:	55                   	push   %rbp
+  804b2a:	48 89 e5             	mov    %rsp,%rbp
+  804b2d:	48 83 ec 10          	sub    $0x10,%rsp
+  804b31:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804b31 <nsipc_socket+0x8>
+  804b38:	49 bb ff 34 00 00 00 	movabs $0x34ff,%r11
+  804b3f:	00 00 00 
+  804b42:	4c 01 d8             	add    %r11,%rax
+  804b45:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804b48:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  804b4b:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  804b4e:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804b55:	00 00 00 
+  804b58:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804b5b:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  804b5e:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804b65:	00 00 00 
+  804b68:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  804b6b:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  804b6f:	48 b9 d0 3f 01 00 00 	movabs $0x13fd0,%rcx
+  804b76:	00 00 00 
+  804b79:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804b7c:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  804b80:	bf 09 00 00 00       	mov    $0x9,%edi
+  804b85:	48 ba 0e c4 ff ff ff 	movabs $0xffffffffffffc40e,%rdx
+  804b8c:	ff ff ff 
+  804b8f:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804b93:	ff d0                	call   *%rax
+}
+  804b95:	c9                   	leave
+  804b96:	c3                   	ret
+
+0000000000804b97 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  804b97:	55                   	push   %rbp
+  804b98:	48 89 e5             	mov    %rsp,%rbp
+  804b9b:	41 57                	push   %r15
+  804b9d:	53                   	push   %rbx
+  804b9e:	48 83 ec 30          	sub    $0x30,%rsp
+  804ba2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ba2 <pipe+0xb>
+  804ba9:	49 bb 8e 34 00 00 00 	movabs $0x348e,%r11
+  804bb0:	00 00 00 
+  804bb3:	4c 01 db             	add    %r11,%rbx
+  804bb6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  804bba:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  804bbe:	48 89 c7             	mov    %rax,%rdi
+  804bc1:	49 89 df             	mov    %rbx,%r15
+  804bc4:	48 b8 28 a8 ff ff ff 	movabs $0xffffffffffffa828,%rax
+  804bcb:	ff ff ff 
+  804bce:	48 01 d8             	add    %rbx,%rax
+  804bd1:	ff d0                	call   *%rax
+  804bd3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804bd6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804bda:	0f 88 12 02 00 00    	js     804df2 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804be0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804be4:	ba 07 04 00 00       	mov    $0x407,%edx
+  804be9:	48 89 c6             	mov    %rax,%rsi
+  804bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bf1:	49 89 df             	mov    %rbx,%r15
+  804bf4:	48 b8 05 a0 ff ff ff 	movabs $0xffffffffffffa005,%rax
+  804bfb:	ff ff ff 
+  804bfe:	48 01 d8             	add    %rbx,%rax
+  804c01:	ff d0                	call   *%rax
+  804c03:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c06:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c0a:	0f 88 e2 01 00 00    	js     804df2 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  804c10:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804c14:	48 89 c7             	mov    %rax,%rdi
+  804c17:	49 89 df             	mov    %rbx,%r15
+  804c1a:	48 b8 28 a8 ff ff ff 	movabs $0xffffffffffffa828,%rax
+  804c21:	ff ff ff 
+  804c24:	48 01 d8             	add    %rbx,%rax
+  804c27:	ff d0                	call   *%rax
+  804c29:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c2c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c30:	0f 88 9b 01 00 00    	js     804dd1 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c36:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c3a:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c3f:	48 89 c6             	mov    %rax,%rsi
+  804c42:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c47:	49 89 df             	mov    %rbx,%r15
+  804c4a:	48 b8 05 a0 ff ff ff 	movabs $0xffffffffffffa005,%rax
+  804c51:	ff ff ff 
+  804c54:	48 01 d8             	add    %rbx,%rax
+  804c57:	ff d0                	call   *%rax
+  804c59:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c5c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c60:	0f 88 6b 01 00 00    	js     804dd1 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  804c66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c6a:	48 89 c7             	mov    %rax,%rdi
+  804c6d:	49 89 df             	mov    %rbx,%r15
+  804c70:	48 b8 e5 a7 ff ff ff 	movabs $0xffffffffffffa7e5,%rax
+  804c77:	ff ff ff 
+  804c7a:	48 01 d8             	add    %rbx,%rax
+  804c7d:	ff d0                	call   *%rax
+  804c7f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804c83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c87:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c8c:	48 89 c6             	mov    %rax,%rsi
+  804c8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c94:	49 89 df             	mov    %rbx,%r15
+  804c97:	48 b8 05 a0 ff ff ff 	movabs $0xffffffffffffa005,%rax
+  804c9e:	ff ff ff 
+  804ca1:	48 01 d8             	add    %rbx,%rax
+  804ca4:	ff d0                	call   *%rax
+  804ca6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ca9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cad:	0f 88 fd 00 00 00    	js     804db0 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804cb3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804cb7:	48 89 c7             	mov    %rax,%rdi
+  804cba:	49 89 df             	mov    %rbx,%r15
+  804cbd:	48 b8 e5 a7 ff ff ff 	movabs $0xffffffffffffa7e5,%rax
+  804cc4:	ff ff ff 
+  804cc7:	48 01 d8             	add    %rbx,%rax
+  804cca:	ff d0                	call   *%rax
+  804ccc:	48 89 c2             	mov    %rax,%rdx
+  804ccf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cd3:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804cd9:	48 89 d1             	mov    %rdx,%rcx
+  804cdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ce1:	48 89 c6             	mov    %rax,%rsi
+  804ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ce9:	49 89 df             	mov    %rbx,%r15
+  804cec:	48 b8 6a a0 ff ff ff 	movabs $0xffffffffffffa06a,%rax
+  804cf3:	ff ff ff 
+  804cf6:	48 01 d8             	add    %rbx,%rax
+  804cf9:	ff d0                	call   *%rax
+  804cfb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cfe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d02:	0f 88 87 00 00 00    	js     804d8f <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  804d08:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d0c:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804d13:	00 00 00 
+  804d16:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804d19:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  804d1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d1f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  804d26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d2a:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  804d31:	00 00 00 
+  804d34:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804d37:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  804d39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d3d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  804d44:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d48:	48 89 c7             	mov    %rax,%rdi
+  804d4b:	49 89 df             	mov    %rbx,%r15
+  804d4e:	48 b8 ae a7 ff ff ff 	movabs $0xffffffffffffa7ae,%rax
+  804d55:	ff ff ff 
+  804d58:	48 01 d8             	add    %rbx,%rax
+  804d5b:	ff d0                	call   *%rax
+  804d5d:	89 c2                	mov    %eax,%edx
+  804d5f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d63:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  804d65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d69:	48 89 c7             	mov    %rax,%rdi
+  804d6c:	49 89 df             	mov    %rbx,%r15
+  804d6f:	48 b8 ae a7 ff ff ff 	movabs $0xffffffffffffa7ae,%rax
+  804d76:	ff ff ff 
+  804d79:	48 01 d8             	add    %rbx,%rax
+  804d7c:	ff d0                	call   *%rax
+  804d7e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d82:	48 83 c2 04          	add    $0x4,%rdx
+  804d86:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  804d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d8d:	eb 67                	jmp    804df6 <pipe+0x25f>
+		goto err3;
+  804d8f:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  804d90:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d94:	48 89 c6             	mov    %rax,%rsi
+  804d97:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d9c:	49 89 df             	mov    %rbx,%r15
+  804d9f:	48 b8 dd a0 ff ff ff 	movabs $0xffffffffffffa0dd,%rax
+  804da6:	ff ff ff 
+  804da9:	48 01 d8             	add    %rbx,%rax
+  804dac:	ff d0                	call   *%rax
+  804dae:	eb 01                	jmp    804db1 <pipe+0x21a>
+		goto err2;
+  804db0:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  804db1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804db5:	48 89 c6             	mov    %rax,%rsi
+  804db8:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dbd:	49 89 df             	mov    %rbx,%r15
+  804dc0:	48 b8 dd a0 ff ff ff 	movabs $0xffffffffffffa0dd,%rax
+  804dc7:	ff ff ff 
+  804dca:	48 01 d8             	add    %rbx,%rax
+  804dcd:	ff d0                	call   *%rax
+  804dcf:	eb 01                	jmp    804dd2 <pipe+0x23b>
+		goto err1;
+  804dd1:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  804dd2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dd6:	48 89 c6             	mov    %rax,%rsi
+  804dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dde:	49 89 df             	mov    %rbx,%r15
+  804de1:	48 b8 dd a0 ff ff ff 	movabs $0xffffffffffffa0dd,%rax
+  804de8:	ff ff ff 
+  804deb:	48 01 d8             	add    %rbx,%rax
+  804dee:	ff d0                	call   *%rax
+  804df0:	eb 01                	jmp    804df3 <pipe+0x25c>
+		goto err;
+  804df2:	90                   	nop
+err:
+	return r;
+  804df3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804df6:	48 83 c4 30          	add    $0x30,%rsp
+  804dfa:	5b                   	pop    %rbx
+  804dfb:	41 5f                	pop    %r15
+  804dfd:	5d                   	pop    %rbp
+  804dfe:	c3                   	ret
+
+0000000000804dff <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  804dff:	55                   	push   %rbp
+  804e00:	48 89 e5             	mov    %rsp,%rbp
+  804e03:	41 57                	push   %r15
+  804e05:	41 54                	push   %r12
+  804e07:	53                   	push   %rbx
+  804e08:	48 83 ec 28          	sub    $0x28,%rsp
+  804e0c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e0c <_pipeisclosed+0xd>
+  804e13:	49 bb 24 32 00 00 00 	movabs $0x3224,%r11
+  804e1a:	00 00 00 
+  804e1d:	4c 01 db             	add    %r11,%rbx
+  804e20:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804e24:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804e28:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804e2f:	ff ff ff 
+  804e32:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804e36:	48 8b 00             	mov    (%rax),%rax
+  804e39:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804e3f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  804e42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e46:	48 89 c7             	mov    %rax,%rdi
+  804e49:	49 89 df             	mov    %rbx,%r15
+  804e4c:	48 b8 dc df ff ff ff 	movabs $0xffffffffffffdfdc,%rax
+  804e53:	ff ff ff 
+  804e56:	48 01 d8             	add    %rbx,%rax
+  804e59:	ff d0                	call   *%rax
+  804e5b:	41 89 c4             	mov    %eax,%r12d
+  804e5e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e62:	48 89 c7             	mov    %rax,%rdi
+  804e65:	49 89 df             	mov    %rbx,%r15
+  804e68:	48 b8 dc df ff ff ff 	movabs $0xffffffffffffdfdc,%rax
+  804e6f:	ff ff ff 
+  804e72:	48 01 d8             	add    %rbx,%rax
+  804e75:	ff d0                	call   *%rax
+  804e77:	41 39 c4             	cmp    %eax,%r12d
+  804e7a:	0f 94 c0             	sete   %al
+  804e7d:	0f b6 c0             	movzbl %al,%eax
+  804e80:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  804e83:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804e8a:	ff ff ff 
+  804e8d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804e91:	48 8b 00             	mov    (%rax),%rax
+  804e94:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  804e9a:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  804e9d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ea0:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804ea3:	75 05                	jne    804eaa <_pipeisclosed+0xab>
+			return ret;
+  804ea5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804ea8:	eb 63                	jmp    804f0d <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  804eaa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ead:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  804eb0:	0f 84 72 ff ff ff    	je     804e28 <_pipeisclosed+0x29>
+  804eb6:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  804eba:	0f 85 68 ff ff ff    	jne    804e28 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  804ec0:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  804ec7:	ff ff ff 
+  804eca:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804ece:	48 8b 00             	mov    (%rax),%rax
+  804ed1:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  804ed7:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  804eda:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804edd:	89 c6                	mov    %eax,%esi
+  804edf:	48 b8 46 e6 ff ff ff 	movabs $0xffffffffffffe646,%rax
+  804ee6:	ff ff ff 
+  804ee9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804eed:	48 89 c7             	mov    %rax,%rdi
+  804ef0:	49 89 df             	mov    %rbx,%r15
+  804ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ef8:	49 b8 87 85 ff ff ff 	movabs $0xffffffffffff8587,%r8
+  804eff:	ff ff ff 
+  804f02:	49 01 d8             	add    %rbx,%r8
+  804f05:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  804f08:	e9 1b ff ff ff       	jmp    804e28 <_pipeisclosed+0x29>
+	}
+}
+  804f0d:	48 83 c4 28          	add    $0x28,%rsp
+  804f11:	5b                   	pop    %rbx
+  804f12:	41 5c                	pop    %r12
+  804f14:	41 5f                	pop    %r15
+  804f16:	5d                   	pop    %rbp
+  804f17:	c3                   	ret
+
+0000000000804f18 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  804f18:	55                   	push   %rbp
+  804f19:	48 89 e5             	mov    %rsp,%rbp
+  804f1c:	41 57                	push   %r15
+  804f1e:	53                   	push   %rbx
+  804f1f:	48 83 ec 30          	sub    $0x30,%rsp
+  804f23:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f23 <pipeisclosed+0xb>
+  804f2a:	49 bb 0d 31 00 00 00 	movabs $0x310d,%r11
+  804f31:	00 00 00 
+  804f34:	4c 01 db             	add    %r11,%rbx
+  804f37:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804f3a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804f3e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804f41:	48 89 d6             	mov    %rdx,%rsi
+  804f44:	89 c7                	mov    %eax,%edi
+  804f46:	49 89 df             	mov    %rbx,%r15
+  804f49:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  804f50:	ff ff ff 
+  804f53:	48 01 d8             	add    %rbx,%rax
+  804f56:	ff d0                	call   *%rax
+  804f58:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f5f:	79 05                	jns    804f66 <pipeisclosed+0x4e>
+		return r;
+  804f61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f64:	eb 3b                	jmp    804fa1 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  804f66:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f6a:	48 89 c7             	mov    %rax,%rdi
+  804f6d:	49 89 df             	mov    %rbx,%r15
+  804f70:	48 b8 e5 a7 ff ff ff 	movabs $0xffffffffffffa7e5,%rax
+  804f77:	ff ff ff 
+  804f7a:	48 01 d8             	add    %rbx,%rax
+  804f7d:	ff d0                	call   *%rax
+  804f7f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  804f83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804f87:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f8b:	48 89 d6             	mov    %rdx,%rsi
+  804f8e:	48 89 c7             	mov    %rax,%rdi
+  804f91:	48 b8 cf cd ff ff ff 	movabs $0xffffffffffffcdcf,%rax
+  804f98:	ff ff ff 
+  804f9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f9f:	ff d0                	call   *%rax
+}
+  804fa1:	48 83 c4 30          	add    $0x30,%rsp
+  804fa5:	5b                   	pop    %rbx
+  804fa6:	41 5f                	pop    %r15
+  804fa8:	5d                   	pop    %rbp
+  804fa9:	c3                   	ret
+
+0000000000804faa <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  804faa:	55                   	push   %rbp
+  804fab:	48 89 e5             	mov    %rsp,%rbp
+  804fae:	41 57                	push   %r15
+  804fb0:	53                   	push   %rbx
+  804fb1:	48 83 ec 40          	sub    $0x40,%rsp
+  804fb5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fb5 <devpipe_read+0xb>
+  804fbc:	49 bb 7b 30 00 00 00 	movabs $0x307b,%r11
+  804fc3:	00 00 00 
+  804fc6:	4c 01 db             	add    %r11,%rbx
+  804fc9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804fcd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804fd1:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  804fd5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fd9:	48 89 c7             	mov    %rax,%rdi
+  804fdc:	49 89 df             	mov    %rbx,%r15
+  804fdf:	48 b8 e5 a7 ff ff ff 	movabs $0xffffffffffffa7e5,%rax
+  804fe6:	ff ff ff 
+  804fe9:	48 01 d8             	add    %rbx,%rax
+  804fec:	ff d0                	call   *%rax
+  804fee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  804ff2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ff6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  804ffa:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805001:	00 
+  805002:	e9 a1 00 00 00       	jmp    8050a8 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805007:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80500c:	74 09                	je     805017 <devpipe_read+0x6d>
+				return i;
+  80500e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805012:	e9 9f 00 00 00       	jmp    8050b6 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805017:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80501b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80501f:	48 89 d6             	mov    %rdx,%rsi
+  805022:	48 89 c7             	mov    %rax,%rdi
+  805025:	48 b8 cf cd ff ff ff 	movabs $0xffffffffffffcdcf,%rax
+  80502c:	ff ff ff 
+  80502f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805033:	ff d0                	call   *%rax
+  805035:	85 c0                	test   %eax,%eax
+  805037:	74 07                	je     805040 <devpipe_read+0x96>
+				return 0;
+  805039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80503e:	eb 76                	jmp    8050b6 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805040:	49 89 df             	mov    %rbx,%r15
+  805043:	48 b8 b0 9f ff ff ff 	movabs $0xffffffffffff9fb0,%rax
+  80504a:	ff ff ff 
+  80504d:	48 01 d8             	add    %rbx,%rax
+  805050:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805052:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805056:	8b 10                	mov    (%rax),%edx
+  805058:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80505c:	8b 40 04             	mov    0x4(%rax),%eax
+  80505f:	39 c2                	cmp    %eax,%edx
+  805061:	74 a4                	je     805007 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805063:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805067:	8b 10                	mov    (%rax),%edx
+  805069:	89 d0                	mov    %edx,%eax
+  80506b:	c1 f8 1f             	sar    $0x1f,%eax
+  80506e:	c1 e8 1b             	shr    $0x1b,%eax
+  805071:	01 c2                	add    %eax,%edx
+  805073:	83 e2 1f             	and    $0x1f,%edx
+  805076:	29 c2                	sub    %eax,%edx
+  805078:	89 d6                	mov    %edx,%esi
+  80507a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80507e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805082:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805086:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80508a:	48 63 c6             	movslq %esi,%rax
+  80508d:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805092:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805094:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805098:	8b 00                	mov    (%rax),%eax
+  80509a:	8d 50 01             	lea    0x1(%rax),%edx
+  80509d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050a1:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  8050a3:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8050a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050ac:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8050b0:	72 a0                	jb     805052 <devpipe_read+0xa8>
+	}
+	return i;
+  8050b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8050b6:	48 83 c4 40          	add    $0x40,%rsp
+  8050ba:	5b                   	pop    %rbx
+  8050bb:	41 5f                	pop    %r15
+  8050bd:	5d                   	pop    %rbp
+  8050be:	c3                   	ret
+
+00000000008050bf <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8050bf:	55                   	push   %rbp
+  8050c0:	48 89 e5             	mov    %rsp,%rbp
+  8050c3:	41 57                	push   %r15
+  8050c5:	53                   	push   %rbx
+  8050c6:	48 83 ec 40          	sub    $0x40,%rsp
+  8050ca:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050ca <devpipe_write+0xb>
+  8050d1:	49 bb 66 2f 00 00 00 	movabs $0x2f66,%r11
+  8050d8:	00 00 00 
+  8050db:	4c 01 db             	add    %r11,%rbx
+  8050de:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8050e2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8050e6:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8050ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050ee:	48 89 c7             	mov    %rax,%rdi
+  8050f1:	49 89 df             	mov    %rbx,%r15
+  8050f4:	48 b8 e5 a7 ff ff ff 	movabs $0xffffffffffffa7e5,%rax
+  8050fb:	ff ff ff 
+  8050fe:	48 01 d8             	add    %rbx,%rax
+  805101:	ff d0                	call   *%rax
+  805103:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805107:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80510b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80510f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805116:	00 
+  805117:	e9 a0 00 00 00       	jmp    8051bc <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80511c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805120:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805124:	48 89 d6             	mov    %rdx,%rsi
+  805127:	48 89 c7             	mov    %rax,%rdi
+  80512a:	48 b8 cf cd ff ff ff 	movabs $0xffffffffffffcdcf,%rax
+  805131:	ff ff ff 
+  805134:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805138:	ff d0                	call   *%rax
+  80513a:	85 c0                	test   %eax,%eax
+  80513c:	74 0a                	je     805148 <devpipe_write+0x89>
+				return 0;
+  80513e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805143:	e9 82 00 00 00       	jmp    8051ca <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805148:	49 89 df             	mov    %rbx,%r15
+  80514b:	48 b8 b0 9f ff ff ff 	movabs $0xffffffffffff9fb0,%rax
+  805152:	ff ff ff 
+  805155:	48 01 d8             	add    %rbx,%rax
+  805158:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80515a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80515e:	8b 40 04             	mov    0x4(%rax),%eax
+  805161:	48 63 d0             	movslq %eax,%rdx
+  805164:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805168:	8b 00                	mov    (%rax),%eax
+  80516a:	48 98                	cltq
+  80516c:	48 83 c0 20          	add    $0x20,%rax
+  805170:	48 39 c2             	cmp    %rax,%rdx
+  805173:	73 a7                	jae    80511c <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805175:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805179:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80517d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805181:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805185:	8b 50 04             	mov    0x4(%rax),%edx
+  805188:	89 d0                	mov    %edx,%eax
+  80518a:	c1 f8 1f             	sar    $0x1f,%eax
+  80518d:	c1 e8 1b             	shr    $0x1b,%eax
+  805190:	01 c2                	add    %eax,%edx
+  805192:	83 e2 1f             	and    $0x1f,%edx
+  805195:	29 c2                	sub    %eax,%edx
+  805197:	89 d0                	mov    %edx,%eax
+  805199:	0f b6 09             	movzbl (%rcx),%ecx
+  80519c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8051a0:	48 98                	cltq
+  8051a2:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  8051a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051aa:	8b 40 04             	mov    0x4(%rax),%eax
+  8051ad:	8d 50 01             	lea    0x1(%rax),%edx
+  8051b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051b4:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8051b7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8051bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051c0:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8051c4:	72 94                	jb     80515a <devpipe_write+0x9b>
+	}
+
+	return i;
+  8051c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8051ca:	48 83 c4 40          	add    $0x40,%rsp
+  8051ce:	5b                   	pop    %rbx
+  8051cf:	41 5f                	pop    %r15
+  8051d1:	5d                   	pop    %rbp
+  8051d2:	c3                   	ret
+
+00000000008051d3 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8051d3:	55                   	push   %rbp
+  8051d4:	48 89 e5             	mov    %rsp,%rbp
+  8051d7:	41 57                	push   %r15
+  8051d9:	53                   	push   %rbx
+  8051da:	48 83 ec 20          	sub    $0x20,%rsp
+  8051de:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051de <devpipe_stat+0xb>
+  8051e5:	49 bb 52 2e 00 00 00 	movabs $0x2e52,%r11
+  8051ec:	00 00 00 
+  8051ef:	4c 01 db             	add    %r11,%rbx
+  8051f2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8051f6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8051fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051fe:	48 89 c7             	mov    %rax,%rdi
+  805201:	49 89 df             	mov    %rbx,%r15
+  805204:	48 b8 e5 a7 ff ff ff 	movabs $0xffffffffffffa7e5,%rax
+  80520b:	ff ff ff 
+  80520e:	48 01 d8             	add    %rbx,%rax
+  805211:	ff d0                	call   *%rax
+  805213:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805217:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80521b:	48 ba 59 e6 ff ff ff 	movabs $0xffffffffffffe659,%rdx
+  805222:	ff ff ff 
+  805225:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805229:	48 89 d6             	mov    %rdx,%rsi
+  80522c:	48 89 c7             	mov    %rax,%rdi
+  80522f:	49 89 df             	mov    %rbx,%r15
+  805232:	48 b8 49 93 ff ff ff 	movabs $0xffffffffffff9349,%rax
+  805239:	ff ff ff 
+  80523c:	48 01 d8             	add    %rbx,%rax
+  80523f:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805241:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805245:	8b 50 04             	mov    0x4(%rax),%edx
+  805248:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80524c:	8b 00                	mov    (%rax),%eax
+  80524e:	29 c2                	sub    %eax,%edx
+  805250:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805254:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  80525a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80525e:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805265:	00 00 00 
+	stat->st_dev = &devpipe;
+  805268:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80526c:	48 ba d0 00 00 00 00 	movabs $0xd0,%rdx
+  805273:	00 00 00 
+  805276:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  80527a:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805281:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805286:	48 83 c4 20          	add    $0x20,%rsp
+  80528a:	5b                   	pop    %rbx
+  80528b:	41 5f                	pop    %r15
+  80528d:	5d                   	pop    %rbp
+  80528e:	c3                   	ret
+
+000000000080528f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80528f:	55                   	push   %rbp
+  805290:	48 89 e5             	mov    %rsp,%rbp
+  805293:	41 57                	push   %r15
+  805295:	53                   	push   %rbx
+  805296:	48 83 ec 10          	sub    $0x10,%rsp
+  80529a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80529a <devpipe_close+0xb>
+  8052a1:	49 bb 96 2d 00 00 00 	movabs $0x2d96,%r11
+  8052a8:	00 00 00 
+  8052ab:	4c 01 db             	add    %r11,%rbx
+  8052ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8052b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052b6:	48 89 c6             	mov    %rax,%rsi
+  8052b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052be:	49 89 df             	mov    %rbx,%r15
+  8052c1:	48 b8 dd a0 ff ff ff 	movabs $0xffffffffffffa0dd,%rax
+  8052c8:	ff ff ff 
+  8052cb:	48 01 d8             	add    %rbx,%rax
+  8052ce:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8052d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052d4:	48 89 c7             	mov    %rax,%rdi
+  8052d7:	49 89 df             	mov    %rbx,%r15
+  8052da:	48 b8 e5 a7 ff ff ff 	movabs $0xffffffffffffa7e5,%rax
+  8052e1:	ff ff ff 
+  8052e4:	48 01 d8             	add    %rbx,%rax
+  8052e7:	ff d0                	call   *%rax
+  8052e9:	48 89 c6             	mov    %rax,%rsi
+  8052ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052f1:	49 89 df             	mov    %rbx,%r15
+  8052f4:	48 b8 dd a0 ff ff ff 	movabs $0xffffffffffffa0dd,%rax
+  8052fb:	ff ff ff 
+  8052fe:	48 01 d8             	add    %rbx,%rax
+  805301:	ff d0                	call   *%rax
+}
+  805303:	48 83 c4 10          	add    $0x10,%rsp
+  805307:	5b                   	pop    %rbx
+  805308:	41 5f                	pop    %r15
+  80530a:	5d                   	pop    %rbp
+  80530b:	c3                   	ret
+
+000000000080530c <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80530c:	55                   	push   %rbp
+  80530d:	48 89 e5             	mov    %rsp,%rbp
+  805310:	41 57                	push   %r15
+  805312:	48 83 ec 28          	sub    $0x28,%rsp
+  805316:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805316 <cputchar+0xa>
+  80531d:	49 bb 1a 2d 00 00 00 	movabs $0x2d1a,%r11
+  805324:	00 00 00 
+  805327:	4c 01 d8             	add    %r11,%rax
+  80532a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80532d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805330:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  805333:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  805337:	be 01 00 00 00       	mov    $0x1,%esi
+  80533c:	48 89 d7             	mov    %rdx,%rdi
+  80533f:	49 89 c7             	mov    %rax,%r15
+  805342:	48 ba 4d 9e ff ff ff 	movabs $0xffffffffffff9e4d,%rdx
+  805349:	ff ff ff 
+  80534c:	48 01 c2             	add    %rax,%rdx
+  80534f:	ff d2                	call   *%rdx
+}
+  805351:	90                   	nop
+  805352:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805356:	c9                   	leave
+  805357:	c3                   	ret
+
+0000000000805358 <getchar>:
+
+int
+getchar(void)
+{
+  805358:	55                   	push   %rbp
+  805359:	48 89 e5             	mov    %rsp,%rbp
+  80535c:	41 57                	push   %r15
+  80535e:	48 83 ec 18          	sub    $0x18,%rsp
+  805362:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805362 <getchar+0xa>
+  805369:	49 bb ce 2c 00 00 00 	movabs $0x2cce,%r11
+  805370:	00 00 00 
+  805373:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  805376:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  80537a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80537f:	48 89 ce             	mov    %rcx,%rsi
+  805382:	bf 00 00 00 00       	mov    $0x0,%edi
+  805387:	49 89 c7             	mov    %rax,%r15
+  80538a:	48 b9 25 ae ff ff ff 	movabs $0xffffffffffffae25,%rcx
+  805391:	ff ff ff 
+  805394:	48 01 c1             	add    %rax,%rcx
+  805397:	ff d1                	call   *%rcx
+  805399:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80539c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053a0:	79 05                	jns    8053a7 <getchar+0x4f>
+		return r;
+  8053a2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053a5:	eb 14                	jmp    8053bb <getchar+0x63>
+	if (r < 1)
+  8053a7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053ab:	7f 07                	jg     8053b4 <getchar+0x5c>
+		return -E_EOF;
+  8053ad:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8053b2:	eb 07                	jmp    8053bb <getchar+0x63>
+	return c;
+  8053b4:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8053b8:	0f b6 c0             	movzbl %al,%eax
+}
+  8053bb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8053bf:	c9                   	leave
+  8053c0:	c3                   	ret
+
+00000000008053c1 <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8053c1:	55                   	push   %rbp
+  8053c2:	48 89 e5             	mov    %rsp,%rbp
+  8053c5:	41 57                	push   %r15
+  8053c7:	53                   	push   %rbx
+  8053c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8053cc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8053cc <iscons+0xb>
+  8053d3:	49 bb 64 2c 00 00 00 	movabs $0x2c64,%r11
+  8053da:	00 00 00 
+  8053dd:	4c 01 db             	add    %r11,%rbx
+  8053e0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8053e3:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8053e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8053ea:	48 89 d6             	mov    %rdx,%rsi
+  8053ed:	89 c7                	mov    %eax,%edi
+  8053ef:	49 89 df             	mov    %rbx,%r15
+  8053f2:	48 b8 de a8 ff ff ff 	movabs $0xffffffffffffa8de,%rax
+  8053f9:	ff ff ff 
+  8053fc:	48 01 d8             	add    %rbx,%rax
+  8053ff:	ff d0                	call   *%rax
+  805401:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805404:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805408:	79 05                	jns    80540f <iscons+0x4e>
+		return r;
+  80540a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80540d:	eb 1b                	jmp    80542a <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80540f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805413:	8b 10                	mov    (%rax),%edx
+  805415:	48 b8 10 01 00 00 00 	movabs $0x110,%rax
+  80541c:	00 00 00 
+  80541f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805422:	39 c2                	cmp    %eax,%edx
+  805424:	0f 94 c0             	sete   %al
+  805427:	0f b6 c0             	movzbl %al,%eax
+}
+  80542a:	48 83 c4 20          	add    $0x20,%rsp
+  80542e:	5b                   	pop    %rbx
+  80542f:	41 5f                	pop    %r15
+  805431:	5d                   	pop    %rbp
+  805432:	c3                   	ret
+
+0000000000805433 <opencons>:
+
+int
+opencons(void)
+{
+  805433:	55                   	push   %rbp
+  805434:	48 89 e5             	mov    %rsp,%rbp
+  805437:	41 57                	push   %r15
+  805439:	53                   	push   %rbx
+  80543a:	48 83 ec 10          	sub    $0x10,%rsp
+  80543e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80543e <opencons+0xb>
+  805445:	49 bb f2 2b 00 00 00 	movabs $0x2bf2,%r11
+  80544c:	00 00 00 
+  80544f:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  805452:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805456:	48 89 c7             	mov    %rax,%rdi
+  805459:	49 89 df             	mov    %rbx,%r15
+  80545c:	48 b8 28 a8 ff ff ff 	movabs $0xffffffffffffa828,%rax
+  805463:	ff ff ff 
+  805466:	48 01 d8             	add    %rbx,%rax
+  805469:	ff d0                	call   *%rax
+  80546b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80546e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805472:	79 05                	jns    805479 <opencons+0x46>
+		return r;
+  805474:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805477:	eb 68                	jmp    8054e1 <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805479:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80547d:	ba 07 04 00 00       	mov    $0x407,%edx
+  805482:	48 89 c6             	mov    %rax,%rsi
+  805485:	bf 00 00 00 00       	mov    $0x0,%edi
+  80548a:	49 89 df             	mov    %rbx,%r15
+  80548d:	48 b8 05 a0 ff ff ff 	movabs $0xffffffffffffa005,%rax
+  805494:	ff ff ff 
+  805497:	48 01 d8             	add    %rbx,%rax
+  80549a:	ff d0                	call   *%rax
+  80549c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80549f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054a3:	79 05                	jns    8054aa <opencons+0x77>
+		return r;
+  8054a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054a8:	eb 37                	jmp    8054e1 <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8054aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054ae:	48 ba 10 01 00 00 00 	movabs $0x110,%rdx
+  8054b5:	00 00 00 
+  8054b8:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8054bb:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8054bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054c1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8054c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054cc:	48 89 c7             	mov    %rax,%rdi
+  8054cf:	49 89 df             	mov    %rbx,%r15
+  8054d2:	48 b8 ae a7 ff ff ff 	movabs $0xffffffffffffa7ae,%rax
+  8054d9:	ff ff ff 
+  8054dc:	48 01 d8             	add    %rbx,%rax
+  8054df:	ff d0                	call   *%rax
+}
+  8054e1:	48 83 c4 10          	add    $0x10,%rsp
+  8054e5:	5b                   	pop    %rbx
+  8054e6:	41 5f                	pop    %r15
+  8054e8:	5d                   	pop    %rbp
+  8054e9:	c3                   	ret
+
+00000000008054ea <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  8054ea:	55                   	push   %rbp
+  8054eb:	48 89 e5             	mov    %rsp,%rbp
+  8054ee:	41 57                	push   %r15
+  8054f0:	53                   	push   %rbx
+  8054f1:	48 83 ec 30          	sub    $0x30,%rsp
+  8054f5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054f5 <devcons_read+0xb>
+  8054fc:	49 bb 3b 2b 00 00 00 	movabs $0x2b3b,%r11
+  805503:	00 00 00 
+  805506:	4c 01 db             	add    %r11,%rbx
+  805509:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80550d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805511:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  805515:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80551a:	75 19                	jne    805535 <devcons_read+0x4b>
+		return 0;
+  80551c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805521:	eb 55                	jmp    805578 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  805523:	49 89 df             	mov    %rbx,%r15
+  805526:	48 b8 b0 9f ff ff ff 	movabs $0xffffffffffff9fb0,%rax
+  80552d:	ff ff ff 
+  805530:	48 01 d8             	add    %rbx,%rax
+  805533:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  805535:	49 89 df             	mov    %rbx,%r15
+  805538:	48 b8 ac 9e ff ff ff 	movabs $0xffffffffffff9eac,%rax
+  80553f:	ff ff ff 
+  805542:	48 01 d8             	add    %rbx,%rax
+  805545:	ff d0                	call   *%rax
+  805547:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80554a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80554e:	74 d3                	je     805523 <devcons_read+0x39>
+	if (c < 0)
+  805550:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805554:	79 05                	jns    80555b <devcons_read+0x71>
+		return c;
+  805556:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805559:	eb 1d                	jmp    805578 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  80555b:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80555f:	75 07                	jne    805568 <devcons_read+0x7e>
+		return 0;
+  805561:	b8 00 00 00 00       	mov    $0x0,%eax
+  805566:	eb 10                	jmp    805578 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  805568:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80556b:	89 c2                	mov    %eax,%edx
+  80556d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805571:	88 10                	mov    %dl,(%rax)
+	return 1;
+  805573:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805578:	48 83 c4 30          	add    $0x30,%rsp
+  80557c:	5b                   	pop    %rbx
+  80557d:	41 5f                	pop    %r15
+  80557f:	5d                   	pop    %rbp
+  805580:	c3                   	ret
+
+0000000000805581 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805581:	55                   	push   %rbp
+  805582:	48 89 e5             	mov    %rsp,%rbp
+  805585:	41 57                	push   %r15
+  805587:	53                   	push   %rbx
+  805588:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80558f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80558f <devcons_write+0xe>
+  805596:	49 bb a1 2a 00 00 00 	movabs $0x2aa1,%r11
+  80559d:	00 00 00 
+  8055a0:	4c 01 db             	add    %r11,%rbx
+  8055a3:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8055aa:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8055b1:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8055b8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8055bf:	e9 80 00 00 00       	jmp    805644 <devcons_write+0xc3>
+		m = n - tot;
+  8055c4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8055cb:	89 c2                	mov    %eax,%edx
+  8055cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055d0:	29 c2                	sub    %eax,%edx
+  8055d2:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8055d5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8055d8:	83 f8 7f             	cmp    $0x7f,%eax
+  8055db:	76 07                	jbe    8055e4 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8055dd:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8055e4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8055e7:	48 63 d0             	movslq %eax,%rdx
+  8055ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055ed:	48 63 c8             	movslq %eax,%rcx
+  8055f0:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  8055f7:	48 01 c1             	add    %rax,%rcx
+  8055fa:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805601:	48 89 ce             	mov    %rcx,%rsi
+  805604:	48 89 c7             	mov    %rax,%rdi
+  805607:	49 89 df             	mov    %rbx,%r15
+  80560a:	48 b8 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rax
+  805611:	ff ff ff 
+  805614:	48 01 d8             	add    %rbx,%rax
+  805617:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  805619:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80561c:	48 63 d0             	movslq %eax,%rdx
+  80561f:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  805626:	48 89 d6             	mov    %rdx,%rsi
+  805629:	48 89 c7             	mov    %rax,%rdi
+  80562c:	49 89 df             	mov    %rbx,%r15
+  80562f:	48 b8 4d 9e ff ff ff 	movabs $0xffffffffffff9e4d,%rax
+  805636:	ff ff ff 
+  805639:	48 01 d8             	add    %rbx,%rax
+  80563c:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  80563e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805641:	01 45 ec             	add    %eax,-0x14(%rbp)
+  805644:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805647:	48 98                	cltq
+  805649:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  805650:	0f 82 6e ff ff ff    	jb     8055c4 <devcons_write+0x43>
+	}
+	return tot;
+  805656:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805659:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  805660:	5b                   	pop    %rbx
+  805661:	41 5f                	pop    %r15
+  805663:	5d                   	pop    %rbp
+  805664:	c3                   	ret
+
+0000000000805665 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  805665:	55                   	push   %rbp
+  805666:	48 89 e5             	mov    %rsp,%rbp
+  805669:	48 83 ec 08          	sub    $0x8,%rsp
+  80566d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80566d <devcons_close+0x8>
+  805674:	49 bb c3 29 00 00 00 	movabs $0x29c3,%r11
+  80567b:	00 00 00 
+  80567e:	4c 01 d8             	add    %r11,%rax
+  805681:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  805685:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80568a:	c9                   	leave
+  80568b:	c3                   	ret
+
+000000000080568c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80568c:	55                   	push   %rbp
+  80568d:	48 89 e5             	mov    %rsp,%rbp
+  805690:	41 57                	push   %r15
+  805692:	48 83 ec 18          	sub    $0x18,%rsp
+  805696:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805696 <devcons_stat+0xa>
+  80569d:	49 bb 9a 29 00 00 00 	movabs $0x299a,%r11
+  8056a4:	00 00 00 
+  8056a7:	4c 01 d8             	add    %r11,%rax
+  8056aa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8056ae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8056b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8056b6:	48 b9 65 e6 ff ff ff 	movabs $0xffffffffffffe665,%rcx
+  8056bd:	ff ff ff 
+  8056c0:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8056c4:	48 89 ce             	mov    %rcx,%rsi
+  8056c7:	48 89 d7             	mov    %rdx,%rdi
+  8056ca:	49 89 c7             	mov    %rax,%r15
+  8056cd:	48 ba 49 93 ff ff ff 	movabs $0xffffffffffff9349,%rdx
+  8056d4:	ff ff ff 
+  8056d7:	48 01 c2             	add    %rax,%rdx
+  8056da:	ff d2                	call   *%rdx
+	return 0;
+  8056dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056e1:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8056e5:	c9                   	leave
+  8056e6:	c3                   	ret
+
+00000000008056e7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8056e7:	55                   	push   %rbp
+  8056e8:	48 89 e5             	mov    %rsp,%rbp
+  8056eb:	41 57                	push   %r15
+  8056ed:	41 54                	push   %r12
+  8056ef:	53                   	push   %rbx
+  8056f0:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8056f7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056f7 <_panic+0x10>
+  8056fe:	49 bb 39 29 00 00 00 	movabs $0x2939,%r11
+  805705:	00 00 00 
+  805708:	4c 01 db             	add    %r11,%rbx
+  80570b:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  805712:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  805718:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80571f:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  805726:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80572d:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  805734:	84 c0                	test   %al,%al
+  805736:	74 26                	je     80575e <_panic+0x77>
+  805738:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80573f:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  805746:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  80574a:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80574e:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  805752:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  805756:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  80575a:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80575e:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  805765:	00 00 00 
+  805768:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80576f:	00 00 00 
+  805772:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805776:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80577d:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  805784:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80578b:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  805792:	ff ff ff 
+  805795:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805799:	4c 8b 20             	mov    (%rax),%r12
+  80579c:	49 89 df             	mov    %rbx,%r15
+  80579f:	48 b8 5c 9f ff ff ff 	movabs $0xffffffffffff9f5c,%rax
+  8057a6:	ff ff ff 
+  8057a9:	48 01 d8             	add    %rbx,%rax
+  8057ac:	ff d0                	call   *%rax
+  8057ae:	89 c6                	mov    %eax,%esi
+  8057b0:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8057b6:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8057bd:	41 89 d0             	mov    %edx,%r8d
+  8057c0:	48 89 c1             	mov    %rax,%rcx
+  8057c3:	4c 89 e2             	mov    %r12,%rdx
+  8057c6:	48 b8 70 e6 ff ff ff 	movabs $0xffffffffffffe670,%rax
+  8057cd:	ff ff ff 
+  8057d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057d4:	48 89 c7             	mov    %rax,%rdi
+  8057d7:	49 89 df             	mov    %rbx,%r15
+  8057da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057df:	49 b9 87 85 ff ff ff 	movabs $0xffffffffffff8587,%r9
+  8057e6:	ff ff ff 
+  8057e9:	49 01 d9             	add    %rbx,%r9
+  8057ec:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8057ef:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8057f6:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8057fd:	48 89 d6             	mov    %rdx,%rsi
+  805800:	48 89 c7             	mov    %rax,%rdi
+  805803:	49 89 df             	mov    %rbx,%r15
+  805806:	48 b8 a7 84 ff ff ff 	movabs $0xffffffffffff84a7,%rax
+  80580d:	ff ff ff 
+  805810:	48 01 d8             	add    %rbx,%rax
+  805813:	ff d0                	call   *%rax
+	cprintf("\n");
+  805815:	48 b8 93 e6 ff ff ff 	movabs $0xffffffffffffe693,%rax
+  80581c:	ff ff ff 
+  80581f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805823:	48 89 c7             	mov    %rax,%rdi
+  805826:	49 89 df             	mov    %rbx,%r15
+  805829:	b8 00 00 00 00       	mov    $0x0,%eax
+  80582e:	48 ba 87 85 ff ff ff 	movabs $0xffffffffffff8587,%rdx
+  805835:	ff ff ff 
+  805838:	48 01 da             	add    %rbx,%rdx
+  80583b:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80583d:	cc                   	int3
+  80583e:	eb fd                	jmp    80583d <_panic+0x156>
+
+0000000000805840 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805840:	55                   	push   %rbp
+  805841:	48 89 e5             	mov    %rsp,%rbp
+  805844:	41 57                	push   %r15
+  805846:	53                   	push   %rbx
+  805847:	48 83 ec 30          	sub    $0x30,%rsp
+  80584b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80584b <ipc_recv+0xb>
+  805852:	49 bb e5 27 00 00 00 	movabs $0x27e5,%r11
+  805859:	00 00 00 
+  80585c:	4c 01 db             	add    %r11,%rbx
+  80585f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805863:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805867:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80586b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805870:	75 0e                	jne    805880 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  805872:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805879:	00 00 00 
+  80587c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  805880:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805884:	48 89 c7             	mov    %rax,%rdi
+  805887:	49 89 df             	mov    %rbx,%r15
+  80588a:	48 b8 2e a3 ff ff ff 	movabs $0xffffffffffffa32e,%rax
+  805891:	ff ff ff 
+  805894:	48 01 d8             	add    %rbx,%rax
+  805897:	ff d0                	call   *%rax
+  805899:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  80589c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8058a1:	74 2a                	je     8058cd <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8058a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058a7:	75 19                	jne    8058c2 <ipc_recv+0x82>
+  8058a9:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8058b0:	ff ff ff 
+  8058b3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058b7:	48 8b 00             	mov    (%rax),%rax
+  8058ba:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  8058c0:	eb 05                	jmp    8058c7 <ipc_recv+0x87>
+  8058c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058c7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8058cb:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  8058cd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8058d2:	74 2a                	je     8058fe <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  8058d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058d8:	75 19                	jne    8058f3 <ipc_recv+0xb3>
+  8058da:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8058e1:	ff ff ff 
+  8058e4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8058e8:	48 8b 00             	mov    (%rax),%rax
+  8058eb:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8058f1:	eb 05                	jmp    8058f8 <ipc_recv+0xb8>
+  8058f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058f8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8058fc:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  8058fe:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805902:	74 05                	je     805909 <ipc_recv+0xc9>
+		return res;
+  805904:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805907:	eb 17                	jmp    805920 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  805909:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805910:	ff ff ff 
+  805913:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805917:	48 8b 00             	mov    (%rax),%rax
+  80591a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805920:	48 83 c4 30          	add    $0x30,%rsp
+  805924:	5b                   	pop    %rbx
+  805925:	41 5f                	pop    %r15
+  805927:	5d                   	pop    %rbp
+  805928:	c3                   	ret
+
+0000000000805929 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  805929:	55                   	push   %rbp
+  80592a:	48 89 e5             	mov    %rsp,%rbp
+  80592d:	41 57                	push   %r15
+  80592f:	53                   	push   %rbx
+  805930:	48 83 ec 20          	sub    $0x20,%rsp
+  805934:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805934 <ipc_send+0xb>
+  80593b:	49 bb fc 26 00 00 00 	movabs $0x26fc,%r11
+  805942:	00 00 00 
+  805945:	4c 01 db             	add    %r11,%rbx
+  805948:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80594b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80594e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805952:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  805955:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80595a:	75 0e                	jne    80596a <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  80595c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805963:	00 00 00 
+  805966:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  80596a:	90                   	nop
+  80596b:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80596e:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805971:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805975:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805978:	89 c7                	mov    %eax,%edi
+  80597a:	49 89 df             	mov    %rbx,%r15
+  80597d:	48 b8 c4 a2 ff ff ff 	movabs $0xffffffffffffa2c4,%rax
+  805984:	ff ff ff 
+  805987:	48 01 d8             	add    %rbx,%rax
+  80598a:	ff d0                	call   *%rax
+  80598c:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  80598f:	74 da                	je     80596b <ipc_send+0x42>
+		;
+}
+  805991:	90                   	nop
+  805992:	90                   	nop
+  805993:	48 83 c4 20          	add    $0x20,%rsp
+  805997:	5b                   	pop    %rbx
+  805998:	41 5f                	pop    %r15
+  80599a:	5d                   	pop    %rbp
+  80599b:	c3                   	ret
+
+000000000080599c <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  80599c:	55                   	push   %rbp
+  80599d:	48 89 e5             	mov    %rsp,%rbp
+  8059a0:	41 57                	push   %r15
+  8059a2:	53                   	push   %rbx
+  8059a3:	48 83 ec 40          	sub    $0x40,%rsp
+  8059a7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059a7 <ipc_call+0xb>
+  8059ae:	49 bb 89 26 00 00 00 	movabs $0x2689,%r11
+  8059b5:	00 00 00 
+  8059b8:	4c 01 db             	add    %r11,%rbx
+  8059bb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8059be:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8059c1:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8059c5:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8059c8:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8059cc:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8059d0:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8059d5:	75 0e                	jne    8059e5 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  8059d7:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8059de:	00 00 00 
+  8059e1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8059e5:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8059ea:	75 0e                	jne    8059fa <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8059ec:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8059f3:	00 00 00 
+  8059f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8059fa:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8059fd:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805a01:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805a04:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805a08:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805a0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805a11:	49 89 f8             	mov    %rdi,%r8
+  805a14:	89 c7                	mov    %eax,%edi
+  805a16:	49 89 df             	mov    %rbx,%r15
+  805a19:	48 b8 87 a3 ff ff ff 	movabs $0xffffffffffffa387,%rax
+  805a20:	ff ff ff 
+  805a23:	48 01 d8             	add    %rbx,%rax
+  805a26:	ff d0                	call   *%rax
+  805a28:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  805a2b:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805a30:	74 2a                	je     805a5c <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805a32:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a36:	75 19                	jne    805a51 <ipc_call+0xb5>
+  805a38:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a3f:	ff ff ff 
+  805a42:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a46:	48 8b 00             	mov    (%rax),%rax
+  805a49:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805a4f:	eb 05                	jmp    805a56 <ipc_call+0xba>
+  805a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a56:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805a5a:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805a5c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a60:	74 05                	je     805a67 <ipc_call+0xcb>
+		return r;
+  805a62:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a65:	eb 17                	jmp    805a7e <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  805a67:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805a6e:	ff ff ff 
+  805a71:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805a75:	48 8b 00             	mov    (%rax),%rax
+  805a78:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805a7e:	48 83 c4 40          	add    $0x40,%rsp
+  805a82:	5b                   	pop    %rbx
+  805a83:	41 5f                	pop    %r15
+  805a85:	5d                   	pop    %rbp
+  805a86:	c3                   	ret
+
+0000000000805a87 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  805a87:	55                   	push   %rbp
+  805a88:	48 89 e5             	mov    %rsp,%rbp
+  805a8b:	41 57                	push   %r15
+  805a8d:	53                   	push   %rbx
+  805a8e:	48 83 ec 70          	sub    $0x70,%rsp
+  805a92:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a92 <ipc_callw+0xb>
+  805a99:	49 bb 9e 25 00 00 00 	movabs $0x259e,%r11
+  805aa0:	00 00 00 
+  805aa3:	4c 01 db             	add    %r11,%rbx
+  805aa6:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  805aa9:	89 75 98             	mov    %esi,-0x68(%rbp)
+  805aac:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  805ab0:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  805ab4:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  805ab9:	76 0a                	jbe    805ac5 <ipc_callw+0x3e>
+		return -E_INVAL;
+  805abb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805ac0:	e9 b7 00 00 00       	jmp    805b7c <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  805ac5:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805ac9:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  805acd:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  805ad1:	48 89 ce             	mov    %rcx,%rsi
+  805ad4:	48 89 c7             	mov    %rax,%rdi
+  805ad7:	49 89 df             	mov    %rbx,%r15
+  805ada:	48 b8 29 97 ff ff ff 	movabs $0xffffffffffff9729,%rax
+  805ae1:	ff ff ff 
+  805ae4:	48 01 d8             	add    %rbx,%rax
+  805ae7:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  805ae9:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  805af0:	00 
+  805af1:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  805af5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805af9:	48 01 d0             	add    %rdx,%rax
+  805afc:	48 83 e8 01          	sub    $0x1,%rax
+  805b00:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805b04:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b08:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b0d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805b11:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b15:	48 29 d0             	sub    %rdx,%rax
+  805b18:	48 c1 e8 03          	shr    $0x3,%rax
+  805b1c:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  805b20:	89 c1                	mov    %eax,%ecx
+  805b22:	8b 75 98             	mov    -0x68(%rbp),%esi
+  805b25:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  805b29:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805b2c:	49 89 d1             	mov    %rdx,%r9
+  805b2f:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  805b36:	00 00 00 
+  805b39:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  805b40:	00 00 00 
+  805b43:	89 c7                	mov    %eax,%edi
+  805b45:	49 89 df             	mov    %rbx,%r15
+  805b48:	48 b8 87 a3 ff ff ff 	movabs $0xffffffffffffa387,%rax
+  805b4f:	ff ff ff 
+  805b52:	48 01 d8             	add    %rbx,%rax
+  805b55:	ff d0                	call   *%rax
+  805b57:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  805b5a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805b5e:	74 05                	je     805b65 <ipc_callw+0xde>
+		return r;
+  805b60:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b63:	eb 17                	jmp    805b7c <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  805b65:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805b6c:	ff ff ff 
+  805b6f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b73:	48 8b 00             	mov    (%rax),%rax
+  805b76:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805b7c:	48 83 c4 70          	add    $0x70,%rsp
+  805b80:	5b                   	pop    %rbx
+  805b81:	41 5f                	pop    %r15
+  805b83:	5d                   	pop    %rbp
+  805b84:	c3                   	ret
+
+0000000000805b85 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  805b85:	55                   	push   %rbp
+  805b86:	48 89 e5             	mov    %rsp,%rbp
+  805b89:	41 57                	push   %r15
+  805b8b:	53                   	push   %rbx
+  805b8c:	48 83 ec 40          	sub    $0x40,%rsp
+  805b90:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b90 <ipc_callv+0xb>
+  805b97:	49 bb a0 24 00 00 00 	movabs $0x24a0,%r11
+  805b9e:	00 00 00 
+  805ba1:	4c 01 db             	add    %r11,%rbx
+  805ba4:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805ba7:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  805baa:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  805bae:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  805bb1:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  805bb5:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  805bb9:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805bc0:	00 00 00 
+  805bc3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  805bc7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  805bcb:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  805bcf:	74 11                	je     805be2 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  805bd1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805bd5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  805bd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805bdc:	c1 e0 14             	shl    $0x14,%eax
+  805bdf:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  805be2:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  805be6:	74 14                	je     805bfc <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  805be8:	8b 45 20             	mov    0x20(%rbp),%eax
+  805beb:	83 e8 01             	sub    $0x1,%eax
+  805bee:	48 63 d0             	movslq %eax,%rdx
+  805bf1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  805bf5:	48 09 d0             	or     %rdx,%rax
+  805bf8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  805bfc:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  805bff:	c1 e0 10             	shl    $0x10,%eax
+  805c02:	0b 45 10             	or     0x10(%rbp),%eax
+  805c05:	89 c1                	mov    %eax,%ecx
+  805c07:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  805c0a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805c0e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  805c12:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805c16:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c19:	4d 89 c1             	mov    %r8,%r9
+  805c1c:	49 89 f8             	mov    %rdi,%r8
+  805c1f:	89 c7                	mov    %eax,%edi
+  805c21:	49 89 df             	mov    %rbx,%r15
+  805c24:	48 b8 87 a3 ff ff ff 	movabs $0xffffffffffffa387,%rax
+  805c2b:	ff ff ff 
+  805c2e:	48 01 d8             	add    %rbx,%rax
+  805c31:	ff d0                	call   *%rax
+  805c33:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  805c36:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805c3a:	74 05                	je     805c41 <ipc_callv+0xbc>
+		return r;
+  805c3c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c3f:	eb 17                	jmp    805c58 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  805c41:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805c48:	ff ff ff 
+  805c4b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c4f:	48 8b 00             	mov    (%rax),%rax
+  805c52:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805c58:	48 83 c4 40          	add    $0x40,%rsp
+  805c5c:	5b                   	pop    %rbx
+  805c5d:	41 5f                	pop    %r15
+  805c5f:	5d                   	pop    %rbp
+  805c60:	c3                   	ret
+
+0000000000805c61 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  805c61:	55                   	push   %rbp
+  805c62:	48 89 e5             	mov    %rsp,%rbp
+  805c65:	41 57                	push   %r15
+  805c67:	53                   	push   %rbx
+  805c68:	48 83 ec 40          	sub    $0x40,%rsp
+  805c6c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c6c <ipc_reply_recv+0xb>
+  805c73:	49 bb c4 23 00 00 00 	movabs $0x23c4,%r11
+  805c7a:	00 00 00 
+  805c7d:	4c 01 db             	add    %r11,%rbx
+  805c80:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805c83:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805c86:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  805c8a:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  805c8d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805c91:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  805c95:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  805c9a:	75 0e                	jne    805caa <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  805c9c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805ca3:	00 00 00 
+  805ca6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  805caa:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  805caf:	75 0e                	jne    805cbf <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  805cb1:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  805cb8:	00 00 00 
+  805cbb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  805cbf:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  805cc2:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  805cc6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805cca:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  805ccd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805cd1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805cd4:	4d 89 c1             	mov    %r8,%r9
+  805cd7:	49 89 f8             	mov    %rdi,%r8
+  805cda:	89 c7                	mov    %eax,%edi
+  805cdc:	49 89 df             	mov    %rbx,%r15
+  805cdf:	48 b8 fb a3 ff ff ff 	movabs $0xffffffffffffa3fb,%rax
+  805ce6:	ff ff ff 
+  805ce9:	48 01 d8             	add    %rbx,%rax
+  805cec:	ff d0                	call   *%rax
+  805cee:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  805cf1:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  805cf6:	74 2a                	je     805d22 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  805cf8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805cfc:	75 19                	jne    805d17 <ipc_reply_recv+0xb6>
+  805cfe:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d05:	ff ff ff 
+  805d08:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d0c:	48 8b 00             	mov    (%rax),%rax
+  805d0f:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  805d15:	eb 05                	jmp    805d1c <ipc_reply_recv+0xbb>
+  805d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805d20:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  805d22:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  805d27:	74 2a                	je     805d53 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  805d29:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d2d:	75 19                	jne    805d48 <ipc_reply_recv+0xe7>
+  805d2f:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d36:	ff ff ff 
+  805d39:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d3d:	48 8b 00             	mov    (%rax),%rax
+  805d40:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805d46:	eb 05                	jmp    805d4d <ipc_reply_recv+0xec>
+  805d48:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d4d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  805d51:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  805d53:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d57:	74 05                	je     805d5e <ipc_reply_recv+0xfd>
+		return r;
+  805d59:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d5c:	eb 17                	jmp    805d75 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  805d5e:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  805d65:	ff ff ff 
+  805d68:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805d6c:	48 8b 00             	mov    (%rax),%rax
+  805d6f:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  805d75:	48 83 c4 40          	add    $0x40,%rsp
+  805d79:	5b                   	pop    %rbx
+  805d7a:	41 5f                	pop    %r15
+  805d7c:	5d                   	pop    %rbp
+  805d7d:	c3                   	ret
+
+0000000000805d7e <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  805d7e:	55                   	push   %rbp
+  805d7f:	48 89 e5             	mov    %rsp,%rbp
+  805d82:	41 57                	push   %r15
+  805d84:	53                   	push   %rbx
+  805d85:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  805d8c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d8c <ipc_window_batch+0xe>
+  805d93:	49 bb a4 22 00 00 00 	movabs $0x22a4,%r11
+  805d9a:	00 00 00 
+  805d9d:	4c 01 db             	add    %r11,%rbx
+  805da0:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  805da6:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  805dad:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  805db3:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  805db9:	e9 15 01 00 00       	jmp    805ed3 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  805dbe:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  805dc4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  805dc7:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  805dce:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805dd1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805dd4:	39 c2                	cmp    %eax,%edx
+  805dd6:	0f 4e c2             	cmovle %edx,%eax
+  805dd9:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  805ddc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805de3:	eb 6b                	jmp    805e50 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  805de5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805de8:	48 98                	cltq
+  805dea:	48 c1 e0 05          	shl    $0x5,%rax
+  805dee:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805df2:	48 01 e8             	add    %rbp,%rax
+  805df5:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  805dfb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  805e01:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e04:	c1 e0 0c             	shl    $0xc,%eax
+  805e07:	48 63 d0             	movslq %eax,%rdx
+  805e0a:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  805e11:	48 01 c2             	add    %rax,%rdx
+  805e14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e17:	48 98                	cltq
+  805e19:	48 c1 e0 05          	shl    $0x5,%rax
+  805e1d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805e21:	48 01 e8             	add    %rbp,%rax
+  805e24:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  805e2a:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  805e2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e30:	48 98                	cltq
+  805e32:	48 c1 e0 05          	shl    $0x5,%rax
+  805e36:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  805e3a:	48 01 e8             	add    %rbp,%rax
+  805e3d:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  805e44:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  805e4a:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  805e4c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805e50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e53:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  805e56:	7c 8d                	jl     805de5 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  805e58:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  805e5f:	74 27                	je     805e88 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805e61:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805e64:	48 63 d0             	movslq %eax,%rdx
+  805e67:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805e6e:	48 89 d6             	mov    %rdx,%rsi
+  805e71:	48 89 c7             	mov    %rax,%rdi
+  805e74:	49 89 df             	mov    %rbx,%r15
+  805e77:	48 b8 9e a6 ff ff ff 	movabs $0xffffffffffffa69e,%rax
+  805e7e:	ff ff ff 
+  805e81:	48 01 d8             	add    %rbx,%rax
+  805e84:	ff d0                	call   *%rax
+  805e86:	eb 25                	jmp    805ead <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  805e88:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805e8b:	48 63 d0             	movslq %eax,%rdx
+  805e8e:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  805e95:	48 89 d6             	mov    %rdx,%rsi
+  805e98:	48 89 c7             	mov    %rax,%rdi
+  805e9b:	49 89 df             	mov    %rbx,%r15
+  805e9e:	48 b8 fc a6 ff ff ff 	movabs $0xffffffffffffa6fc,%rax
+  805ea5:	ff ff ff 
+  805ea8:	48 01 d8             	add    %rbx,%rax
+  805eab:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  805ead:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  805eb0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  805eb4:	79 05                	jns    805ebb <ipc_window_batch+0x13d>
+			return r;
+  805eb6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805eb9:	eb 2a                	jmp    805ee5 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  805ebb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805ebe:	c1 e0 0c             	shl    $0xc,%eax
+  805ec1:	48 98                	cltq
+  805ec3:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  805eca:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805ecd:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  805ed3:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  805eda:	0f 8f de fe ff ff    	jg     805dbe <ipc_window_batch+0x40>
+	}
+	return 0;
+  805ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805ee5:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  805eec:	5b                   	pop    %rbx
+  805eed:	41 5f                	pop    %r15
+  805eef:	5d                   	pop    %rbp
+  805ef0:	c3                   	ret
+
+0000000000805ef1 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  805ef1:	55                   	push   %rbp
+  805ef2:	48 89 e5             	mov    %rsp,%rbp
+  805ef5:	48 83 ec 10          	sub    $0x10,%rsp
+  805ef9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805ef9 <ipc_map_window+0x8>
+  805f00:	49 bb 37 21 00 00 00 	movabs $0x2137,%r11
+  805f07:	00 00 00 
+  805f0a:	4c 01 d8             	add    %r11,%rax
+  805f0d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f11:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  805f14:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805f17:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805f1b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805f20:	bf 01 00 00 00       	mov    $0x1,%edi
+  805f25:	49 b8 4e dd ff ff ff 	movabs $0xffffffffffffdd4e,%r8
+  805f2c:	ff ff ff 
+  805f2f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805f33:	ff d0                	call   *%rax
+}
+  805f35:	c9                   	leave
+  805f36:	c3                   	ret
+
+0000000000805f37 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  805f37:	55                   	push   %rbp
+  805f38:	48 89 e5             	mov    %rsp,%rbp
+  805f3b:	48 83 ec 10          	sub    $0x10,%rsp
+  805f3f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f3f <ipc_unmap_window+0x8>
+  805f46:	49 bb f1 20 00 00 00 	movabs $0x20f1,%r11
+  805f4d:	00 00 00 
+  805f50:	4c 01 d8             	add    %r11,%rax
+  805f53:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f57:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  805f5a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805f5d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805f61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805f66:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f6b:	49 b8 4e dd ff ff ff 	movabs $0xffffffffffffdd4e,%r8
+  805f72:	ff ff ff 
+  805f75:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  805f79:	ff d0                	call   *%rax
+}
+  805f7b:	c9                   	leave
+  805f7c:	c3                   	ret
+
+0000000000805f7d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805f7d:	55                   	push   %rbp
+  805f7e:	48 89 e5             	mov    %rsp,%rbp
+  805f81:	48 83 ec 18          	sub    $0x18,%rsp
+  805f85:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805f85 <ipc_find_env+0x8>
+  805f8c:	49 bb ab 20 00 00 00 	movabs $0x20ab,%r11
+  805f93:	00 00 00 
+  805f96:	4c 01 d8             	add    %r11,%rax
+  805f99:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  805f9c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805fa3:	eb 57                	jmp    805ffc <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  805fa5:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805fac:	ff ff ff 
+  805faf:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  805fb3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  805fb6:	48 63 d2             	movslq %edx,%rdx
+  805fb9:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  805fc0:	48 01 ca             	add    %rcx,%rdx
+  805fc3:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  805fca:	8b 12                	mov    (%rdx),%edx
+  805fcc:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  805fcf:	75 27                	jne    805ff8 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  805fd1:	48 ba e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rdx
+  805fd8:	ff ff ff 
+  805fdb:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  805fdf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fe2:	48 98                	cltq
+  805fe4:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  805feb:	48 01 d0             	add    %rdx,%rax
+  805fee:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805ff4:	8b 00                	mov    (%rax),%eax
+  805ff6:	eb 12                	jmp    80600a <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  805ff8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805ffc:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806003:	7e a0                	jle    805fa5 <ipc_find_env+0x28>
+	}
+	return 0;
+  806005:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80600a:	c9                   	leave
+  80600b:	c3                   	ret
+
+000000000080600c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80600c:	55                   	push   %rbp
+  80600d:	48 89 e5             	mov    %rsp,%rbp
+  806010:	48 83 ec 18          	sub    $0x18,%rsp
+  806014:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806014 <pageref+0x8>
+  80601b:	49 bb 1c 20 00 00 00 	movabs $0x201c,%r11
+  806022:	00 00 00 
+  806025:	4c 01 d8             	add    %r11,%rax
+  806028:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  80602c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806030:	48 89 d1             	mov    %rdx,%rcx
+  806033:	48 c1 e9 15          	shr    $0x15,%rcx
+  806037:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80603e:	ff ff ff 
+  806041:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806045:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806049:	83 e2 01             	and    $0x1,%edx
+  80604c:	48 85 d2             	test   %rdx,%rdx
+  80604f:	75 07                	jne    806058 <pageref+0x4c>
+		return 0;
+  806051:	b8 00 00 00 00       	mov    $0x0,%eax
+  806056:	eb 64                	jmp    8060bc <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806058:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80605c:	48 89 d1             	mov    %rdx,%rcx
+  80605f:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806063:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  80606a:	ff ff ff 
+  80606d:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806071:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806075:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806079:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80607d:	83 e2 01             	and    $0x1,%edx
+  806080:	48 85 d2             	test   %rdx,%rdx
+  806083:	75 07                	jne    80608c <pageref+0x80>
+		return 0;
+  806085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80608a:	eb 30                	jmp    8060bc <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  80608c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806090:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806094:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  80609b:	ff ff ff 
+  80609e:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  8060a2:	48 89 d0             	mov    %rdx,%rax
+  8060a5:	48 01 c0             	add    %rax,%rax
+  8060a8:	48 01 d0             	add    %rdx,%rax
+  8060ab:	48 c1 e0 03          	shl    $0x3,%rax
+  8060af:	48 01 c8             	add    %rcx,%rax
+  8060b2:	48 83 c0 08          	add    $0x8,%rax
+  8060b6:	0f b7 00             	movzwl (%rax),%eax
+  8060b9:	0f b7 c0             	movzwl %ax,%eax
+}
+  8060bc:	c9                   	leave
+  8060bd:	c3                   	ret
@@ -0,0 +1,10747 @@
+
+obj/user/testhuge:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 4b 03 00 00       	call   80038c <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+
+#define VA	((char *) 0xA0000000)
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800065:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i, r;
+
+	if ((r = sys_page_alloc_huge(0, VA, PTE_P|PTE_W|PTE_U)) < 0)
+  800069:	ba 07 00 00 00       	mov    $0x7,%edx
+  80006e:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  800073:	48 89 c6             	mov    %rax,%rsi
+  800076:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007b:	49 89 df             	mov    %rbx,%r15
+  80007e:	48 b8 81 97 ff ff ff 	movabs $0xffffffffffff9781,%rax
+  800085:	ff ff ff 
+  800088:	48 01 d8             	add    %rbx,%rax
+  80008b:	ff d0                	call   *%rax
+  80008d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800090:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800094:	79 44                	jns    8000da <umain+0x97>
+		panic("sys_page_alloc_huge: %e", r);
+  800096:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800099:	89 c1                	mov    %eax,%ecx
+  80009b:	48 b8 c8 de ff ff ff 	movabs $0xffffffffffffdec8,%rax
+  8000a2:	ff ff ff 
+  8000a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000a9:	48 89 c2             	mov    %rax,%rdx
+  8000ac:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000b1:	48 b8 e0 de ff ff ff 	movabs $0xffffffffffffdee0,%rax
+  8000b8:	ff ff ff 
+  8000bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000bf:	48 89 c7             	mov    %rax,%rdi
+  8000c2:	49 89 df             	mov    %rbx,%r15
+  8000c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ca:	49 b8 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r8
+  8000d1:	ff ff ff 
+  8000d4:	49 01 d8             	add    %rbx,%r8
+  8000d7:	41 ff d0             	call   *%r8
+	for (i = 0; i < PTSIZE; i += PGSIZE)
+  8000da:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8000e1:	eb 5f                	jmp    800142 <umain+0xff>
+		if (VA[i] != 0)
+  8000e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000e6:	48 98                	cltq
+  8000e8:	ba 00 00 00 a0       	mov    $0xa0000000,%edx
+  8000ed:	48 01 d0             	add    %rdx,%rax
+  8000f0:	0f b6 00             	movzbl (%rax),%eax
+  8000f3:	84 c0                	test   %al,%al
+  8000f5:	74 44                	je     80013b <umain+0xf8>
+			panic("huge page not zeroed at offset %x", i);
+  8000f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8000fa:	89 c1                	mov    %eax,%ecx
+  8000fc:	48 b8 f0 de ff ff ff 	movabs $0xffffffffffffdef0,%rax
+  800103:	ff ff ff 
+  800106:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80010a:	48 89 c2             	mov    %rax,%rdx
+  80010d:	be 10 00 00 00       	mov    $0x10,%esi
+  800112:	48 b8 e0 de ff ff ff 	movabs $0xffffffffffffdee0,%rax
+  800119:	ff ff ff 
+  80011c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800120:	48 89 c7             	mov    %rax,%rdi
+  800123:	49 89 df             	mov    %rbx,%r15
+  800126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012b:	49 b8 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r8
+  800132:	ff ff ff 
+  800135:	49 01 d8             	add    %rbx,%r8
+  800138:	41 ff d0             	call   *%r8
+	for (i = 0; i < PTSIZE; i += PGSIZE)
+  80013b:	81 45 ec 00 10 00 00 	addl   $0x1000,-0x14(%rbp)
+  800142:	81 7d ec ff ff 1f 00 	cmpl   $0x1fffff,-0x14(%rbp)
+  800149:	7e 98                	jle    8000e3 <umain+0xa0>
+	VA[0] = 'p';
+  80014b:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  800150:	c6 00 70             	movb   $0x70,(%rax)
+	VA[PTSIZE - 1] = 'p';
+  800153:	b8 ff ff 1f a0       	mov    $0xa01fffff,%eax
+  800158:	c6 00 70             	movb   $0x70,(%rax)
+
+	// The child's write must not show up in the parent.
+	if ((r = fork()) < 0)
+  80015b:	49 89 df             	mov    %rbx,%r15
+  80015e:	48 b8 3a a1 ff ff ff 	movabs $0xffffffffffffa13a,%rax
+  800165:	ff ff ff 
+  800168:	48 01 d8             	add    %rbx,%rax
+  80016b:	ff d0                	call   *%rax
+  80016d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  800170:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800174:	79 44                	jns    8001ba <umain+0x177>
+		panic("fork: %e", r);
+  800176:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800179:	89 c1                	mov    %eax,%ecx
+  80017b:	48 b8 12 df ff ff ff 	movabs $0xffffffffffffdf12,%rax
+  800182:	ff ff ff 
+  800185:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800189:	48 89 c2             	mov    %rax,%rdx
+  80018c:	be 16 00 00 00       	mov    $0x16,%esi
+  800191:	48 b8 e0 de ff ff ff 	movabs $0xffffffffffffdee0,%rax
+  800198:	ff ff ff 
+  80019b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80019f:	48 89 c7             	mov    %rax,%rdi
+  8001a2:	49 89 df             	mov    %rbx,%r15
+  8001a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001aa:	49 b8 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r8
+  8001b1:	ff ff ff 
+  8001b4:	49 01 d8             	add    %rbx,%r8
+  8001b7:	41 ff d0             	call   *%r8
+	if (r == 0) {
+  8001ba:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8001be:	75 78                	jne    800238 <umain+0x1f5>
+		if (VA[0] != 'p' || VA[PTSIZE - 1] != 'p')
+  8001c0:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  8001c5:	0f b6 00             	movzbl (%rax),%eax
+  8001c8:	3c 70                	cmp    $0x70,%al
+  8001ca:	75 0c                	jne    8001d8 <umain+0x195>
+  8001cc:	b8 ff ff 1f a0       	mov    $0xa01fffff,%eax
+  8001d1:	0f b6 00             	movzbl (%rax),%eax
+  8001d4:	3c 70                	cmp    $0x70,%al
+  8001d6:	74 3e                	je     800216 <umain+0x1d3>
+			panic("child does not see parent's huge page");
+  8001d8:	48 b8 20 df ff ff ff 	movabs $0xffffffffffffdf20,%rax
+  8001df:	ff ff ff 
+  8001e2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001e6:	48 89 c2             	mov    %rax,%rdx
+  8001e9:	be 19 00 00 00       	mov    $0x19,%esi
+  8001ee:	48 b8 e0 de ff ff ff 	movabs $0xffffffffffffdee0,%rax
+  8001f5:	ff ff ff 
+  8001f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001fc:	48 89 c7             	mov    %rax,%rdi
+  8001ff:	49 89 df             	mov    %rbx,%r15
+  800202:	b8 00 00 00 00       	mov    $0x0,%eax
+  800207:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  80020e:	ff ff ff 
+  800211:	48 01 d9             	add    %rbx,%rcx
+  800214:	ff d1                	call   *%rcx
+		VA[0] = 'c';
+  800216:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  80021b:	c6 00 63             	movb   $0x63,(%rax)
+		VA[PTSIZE - 1] = 'c';
+  80021e:	b8 ff ff 1f a0       	mov    $0xa01fffff,%eax
+  800223:	c6 00 63             	movb   $0x63,(%rax)
+		exit();
+  800226:	49 89 df             	mov    %rbx,%r15
+  800229:	48 b8 0c 74 ff ff ff 	movabs $0xffffffffffff740c,%rax
+  800230:	ff ff ff 
+  800233:	48 01 d8             	add    %rbx,%rax
+  800236:	ff d0                	call   *%rax
+	}
+	wait(r);
+  800238:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80023b:	89 c7                	mov    %eax,%edi
+  80023d:	49 89 df             	mov    %rbx,%r15
+  800240:	48 b8 0e d0 ff ff ff 	movabs $0xffffffffffffd00e,%rax
+  800247:	ff ff ff 
+  80024a:	48 01 d8             	add    %rbx,%rax
+  80024d:	ff d0                	call   *%rax
+	cprintf("fork handles huge pages %s\n",
+		VA[0] == 'p' && VA[PTSIZE - 1] == 'p' ? "right" : "wrong");
+  80024f:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  800254:	0f b6 00             	movzbl (%rax),%eax
+	cprintf("fork handles huge pages %s\n",
+  800257:	3c 70                	cmp    $0x70,%al
+  800259:	75 1c                	jne    800277 <umain+0x234>
+		VA[0] == 'p' && VA[PTSIZE - 1] == 'p' ? "right" : "wrong");
+  80025b:	b8 ff ff 1f a0       	mov    $0xa01fffff,%eax
+  800260:	0f b6 00             	movzbl (%rax),%eax
+  800263:	3c 70                	cmp    $0x70,%al
+  800265:	75 10                	jne    800277 <umain+0x234>
+	cprintf("fork handles huge pages %s\n",
+  800267:	48 b8 46 df ff ff ff 	movabs $0xffffffffffffdf46,%rax
+  80026e:	ff ff ff 
+  800271:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800275:	eb 0e                	jmp    800285 <umain+0x242>
+  800277:	48 b8 4c df ff ff ff 	movabs $0xffffffffffffdf4c,%rax
+  80027e:	ff ff ff 
+  800281:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800285:	48 89 c6             	mov    %rax,%rsi
+  800288:	48 b8 52 df ff ff ff 	movabs $0xffffffffffffdf52,%rax
+  80028f:	ff ff ff 
+  800292:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800296:	48 89 c7             	mov    %rax,%rdi
+  800299:	49 89 df             	mov    %rbx,%r15
+  80029c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a1:	48 ba 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rdx
+  8002a8:	ff ff ff 
+  8002ab:	48 01 da             	add    %rbx,%rdx
+  8002ae:	ff d2                	call   *%rdx
+
+	// Unmapping any page in it removes the whole mapping.
+	if ((r = sys_page_unmap(0, VA + PGSIZE)) < 0)
+  8002b0:	b8 00 10 00 a0       	mov    $0xa0001000,%eax
+  8002b5:	48 89 c6             	mov    %rax,%rsi
+  8002b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002bd:	49 89 df             	mov    %rbx,%r15
+  8002c0:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  8002c7:	ff ff ff 
+  8002ca:	48 01 d8             	add    %rbx,%rax
+  8002cd:	ff d0                	call   *%rax
+  8002cf:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8002d2:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8002d6:	79 44                	jns    80031c <umain+0x2d9>
+		panic("sys_page_unmap: %e", r);
+  8002d8:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8002db:	89 c1                	mov    %eax,%ecx
+  8002dd:	48 b8 6e df ff ff ff 	movabs $0xffffffffffffdf6e,%rax
+  8002e4:	ff ff ff 
+  8002e7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002eb:	48 89 c2             	mov    %rax,%rdx
+  8002ee:	be 24 00 00 00       	mov    $0x24,%esi
+  8002f3:	48 b8 e0 de ff ff ff 	movabs $0xffffffffffffdee0,%rax
+  8002fa:	ff ff ff 
+  8002fd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800301:	48 89 c7             	mov    %rax,%rdi
+  800304:	49 89 df             	mov    %rbx,%r15
+  800307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030c:	49 b8 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r8
+  800313:	ff ff ff 
+  800316:	49 01 d8             	add    %rbx,%r8
+  800319:	41 ff d0             	call   *%r8
+	cprintf("unmap handles huge pages %s\n",
+		(uvpd[VPD(VA)] & PTE_P) ? "wrong" : "right");
+  80031c:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  800323:	ff ff ff 
+  800326:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80032a:	48 8b 80 00 28 00 00 	mov    0x2800(%rax),%rax
+  800331:	83 e0 01             	and    $0x1,%eax
+	cprintf("unmap handles huge pages %s\n",
+  800334:	48 85 c0             	test   %rax,%rax
+  800337:	74 10                	je     800349 <umain+0x306>
+  800339:	48 b8 4c df ff ff ff 	movabs $0xffffffffffffdf4c,%rax
+  800340:	ff ff ff 
+  800343:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800347:	eb 0e                	jmp    800357 <umain+0x314>
+  800349:	48 b8 46 df ff ff ff 	movabs $0xffffffffffffdf46,%rax
+  800350:	ff ff ff 
+  800353:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800357:	48 89 c6             	mov    %rax,%rsi
+  80035a:	48 b8 81 df ff ff ff 	movabs $0xffffffffffffdf81,%rax
+  800361:	ff ff ff 
+  800364:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800368:	48 89 c7             	mov    %rax,%rdi
+  80036b:	49 89 df             	mov    %rbx,%r15
+  80036e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800373:	48 ba 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rdx
+  80037a:	ff ff ff 
+  80037d:	48 01 da             	add    %rbx,%rdx
+  800380:	ff d2                	call   *%rdx
+}
+  800382:	90                   	nop
+  800383:	48 83 c4 20          	add    $0x20,%rsp
+  800387:	5b                   	pop    %rbx
+  800388:	41 5f                	pop    %r15
+  80038a:	5d                   	pop    %rbp
+  80038b:	c3                   	ret
+
+000000000080038c <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80038c:	55                   	push   %rbp
+  80038d:	48 89 e5             	mov    %rsp,%rbp
+  800390:	41 57                	push   %r15
+  800392:	53                   	push   %rbx
+  800393:	48 83 ec 20          	sub    $0x20,%rsp
+  800397:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800397 <libmain+0xb>
+  80039e:	49 bb a9 8c 00 00 00 	movabs $0x8ca9,%r11
+  8003a5:	00 00 00 
+  8003a8:	4c 01 db             	add    %r11,%rbx
+  8003ab:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8003ae:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  8003b2:	49 89 df             	mov    %rbx,%r15
+  8003b5:	48 b8 02 91 ff ff ff 	movabs $0xffffffffffff9102,%rax
+  8003bc:	ff ff ff 
+  8003bf:	48 01 d8             	add    %rbx,%rax
+  8003c2:	ff d0                	call   *%rax
+  8003c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8003c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003ca:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003cf:	48 98                	cltq
+  8003d1:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8003d8:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8003df:	ff ff ff 
+  8003e2:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8003e6:	48 01 c2             	add    %rax,%rdx
+  8003e9:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8003f0:	00 00 00 
+  8003f3:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003f7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8003fb:	7e 15                	jle    800412 <libmain+0x86>
+		binaryname = argv[0];
+  8003fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800401:	48 8b 00             	mov    (%rax),%rax
+  800404:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  80040b:	00 00 00 
+  80040e:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800412:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800416:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800419:	48 89 d6             	mov    %rdx,%rsi
+  80041c:	89 c7                	mov    %eax,%edi
+  80041e:	49 89 df             	mov    %rbx,%r15
+  800421:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800428:	ff ff ff 
+  80042b:	48 01 d8             	add    %rbx,%rax
+  80042e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800430:	49 89 df             	mov    %rbx,%r15
+  800433:	48 b8 0c 74 ff ff ff 	movabs $0xffffffffffff740c,%rax
+  80043a:	ff ff ff 
+  80043d:	48 01 d8             	add    %rbx,%rax
+  800440:	ff d0                	call   *%rax
+}
+  800442:	90                   	nop
+  800443:	48 83 c4 20          	add    $0x20,%rsp
+  800447:	5b                   	pop    %rbx
+  800448:	41 5f                	pop    %r15
+  80044a:	5d                   	pop    %rbp
+  80044b:	c3                   	ret
+
+000000000080044c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80044c:	55                   	push   %rbp
+  80044d:	48 89 e5             	mov    %rsp,%rbp
+  800450:	41 57                	push   %r15
+  800452:	53                   	push   %rbx
+  800453:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800453 <exit+0x7>
+  80045a:	49 bb ed 8b 00 00 00 	movabs $0x8bed,%r11
+  800461:	00 00 00 
+  800464:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800467:	49 89 df             	mov    %rbx,%r15
+  80046a:	48 b8 0b a9 ff ff ff 	movabs $0xffffffffffffa90b,%rax
+  800471:	ff ff ff 
+  800474:	48 01 d8             	add    %rbx,%rax
+  800477:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800479:	bf 00 00 00 00       	mov    $0x0,%edi
+  80047e:	49 89 df             	mov    %rbx,%r15
+  800481:	48 b8 a6 90 ff ff ff 	movabs $0xffffffffffff90a6,%rax
+  800488:	ff ff ff 
+  80048b:	48 01 d8             	add    %rbx,%rax
+  80048e:	ff d0                	call   *%rax
+}
+  800490:	90                   	nop
+  800491:	5b                   	pop    %rbx
+  800492:	41 5f                	pop    %r15
+  800494:	5d                   	pop    %rbp
+  800495:	c3                   	ret
+
+0000000000800496 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800496:	55                   	push   %rbp
+  800497:	48 89 e5             	mov    %rsp,%rbp
+  80049a:	41 57                	push   %r15
+  80049c:	41 54                	push   %r12
+  80049e:	53                   	push   %rbx
+  80049f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8004a6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004a6 <_panic+0x10>
+  8004ad:	49 bb 9a 8b 00 00 00 	movabs $0x8b9a,%r11
+  8004b4:	00 00 00 
+  8004b7:	4c 01 db             	add    %r11,%rbx
+  8004ba:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8004c1:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8004c7:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8004ce:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8004d5:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8004dc:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8004e3:	84 c0                	test   %al,%al
+  8004e5:	74 26                	je     80050d <_panic+0x77>
+  8004e7:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8004ee:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8004f5:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8004f9:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8004fd:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800501:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800505:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800509:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80050d:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800514:	00 00 00 
+  800517:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80051e:	00 00 00 
+  800521:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800525:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80052c:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800533:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80053a:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800541:	ff ff ff 
+  800544:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800548:	4c 8b 20             	mov    (%rax),%r12
+  80054b:	49 89 df             	mov    %rbx,%r15
+  80054e:	48 b8 02 91 ff ff ff 	movabs $0xffffffffffff9102,%rax
+  800555:	ff ff ff 
+  800558:	48 01 d8             	add    %rbx,%rax
+  80055b:	ff d0                	call   *%rax
+  80055d:	89 c6                	mov    %eax,%esi
+  80055f:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800565:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80056c:	41 89 d0             	mov    %edx,%r8d
+  80056f:	48 89 c1             	mov    %rax,%rcx
+  800572:	4c 89 e2             	mov    %r12,%rdx
+  800575:	48 b8 a8 df ff ff ff 	movabs $0xffffffffffffdfa8,%rax
+  80057c:	ff ff ff 
+  80057f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800583:	48 89 c7             	mov    %rax,%rdi
+  800586:	49 89 df             	mov    %rbx,%r15
+  800589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058e:	49 b9 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%r9
+  800595:	ff ff ff 
+  800598:	49 01 d9             	add    %rbx,%r9
+  80059b:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80059e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8005a5:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  8005ac:	48 89 d6             	mov    %rdx,%rsi
+  8005af:	48 89 c7             	mov    %rax,%rdi
+  8005b2:	49 89 df             	mov    %rbx,%r15
+  8005b5:	48 b8 4d 76 ff ff ff 	movabs $0xffffffffffff764d,%rax
+  8005bc:	ff ff ff 
+  8005bf:	48 01 d8             	add    %rbx,%rax
+  8005c2:	ff d0                	call   *%rax
+	cprintf("\n");
+  8005c4:	48 b8 cb df ff ff ff 	movabs $0xffffffffffffdfcb,%rax
+  8005cb:	ff ff ff 
+  8005ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8005d2:	48 89 c7             	mov    %rax,%rdi
+  8005d5:	49 89 df             	mov    %rbx,%r15
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	48 ba 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rdx
+  8005e4:	ff ff ff 
+  8005e7:	48 01 da             	add    %rbx,%rdx
+  8005ea:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8005ec:	cc                   	int3
+  8005ed:	eb fd                	jmp    8005ec <_panic+0x156>
+
+00000000008005ef <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8005ef:	55                   	push   %rbp
+  8005f0:	48 89 e5             	mov    %rsp,%rbp
+  8005f3:	41 57                	push   %r15
+  8005f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8005f9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8005f9 <putch+0xa>
+  800600:	49 bb 47 8a 00 00 00 	movabs $0x8a47,%r11
+  800607:	00 00 00 
+  80060a:	4c 01 d8             	add    %r11,%rax
+  80060d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800610:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800614:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800618:	8b 12                	mov    (%rdx),%edx
+  80061a:	8d 72 01             	lea    0x1(%rdx),%esi
+  80061d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800621:	89 31                	mov    %esi,(%rcx)
+  800623:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800626:	89 ce                	mov    %ecx,%esi
+  800628:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80062c:	48 63 d2             	movslq %edx,%rdx
+  80062f:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800634:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800638:	8b 12                	mov    (%rdx),%edx
+  80063a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800640:	75 33                	jne    800675 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800642:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800646:	8b 12                	mov    (%rdx),%edx
+  800648:	48 63 d2             	movslq %edx,%rdx
+  80064b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80064f:	48 83 c1 08          	add    $0x8,%rcx
+  800653:	48 89 d6             	mov    %rdx,%rsi
+  800656:	48 89 cf             	mov    %rcx,%rdi
+  800659:	49 89 c7             	mov    %rax,%r15
+  80065c:	48 ba f3 8f ff ff ff 	movabs $0xffffffffffff8ff3,%rdx
+  800663:	ff ff ff 
+  800666:	48 01 c2             	add    %rax,%rdx
+  800669:	ff d2                	call   *%rdx
+        b->idx = 0;
+  80066b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80066f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800675:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800679:	8b 40 04             	mov    0x4(%rax),%eax
+  80067c:	8d 50 01             	lea    0x1(%rax),%edx
+  80067f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800683:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800686:	90                   	nop
+  800687:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80068b:	c9                   	leave
+  80068c:	c3                   	ret
+
+000000000080068d <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80068d:	55                   	push   %rbp
+  80068e:	48 89 e5             	mov    %rsp,%rbp
+  800691:	41 57                	push   %r15
+  800693:	53                   	push   %rbx
+  800694:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80069b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80069b <vcprintf+0xe>
+  8006a2:	49 bb a5 89 00 00 00 	movabs $0x89a5,%r11
+  8006a9:	00 00 00 
+  8006ac:	4c 01 db             	add    %r11,%rbx
+  8006af:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  8006b6:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  8006bd:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006c4:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8006cb:	48 8b 06             	mov    (%rsi),%rax
+  8006ce:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8006d2:	48 89 01             	mov    %rax,(%rcx)
+  8006d5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8006d9:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8006dd:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8006e1:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8006e8:	00 00 00 
+    b.cnt = 0;
+  8006eb:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8006f2:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8006f5:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8006fc:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800703:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80070a:	48 89 c6             	mov    %rax,%rsi
+  80070d:	48 b8 af 75 ff ff ff 	movabs $0xffffffffffff75af,%rax
+  800714:	ff ff ff 
+  800717:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80071b:	48 89 c7             	mov    %rax,%rdi
+  80071e:	49 89 df             	mov    %rbx,%r15
+  800721:	48 b8 71 7b ff ff ff 	movabs $0xffffffffffff7b71,%rax
+  800728:	ff ff ff 
+  80072b:	48 01 d8             	add    %rbx,%rax
+  80072e:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800730:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800736:	48 98                	cltq
+  800738:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  80073f:	48 83 c2 08          	add    $0x8,%rdx
+  800743:	48 89 c6             	mov    %rax,%rsi
+  800746:	48 89 d7             	mov    %rdx,%rdi
+  800749:	49 89 df             	mov    %rbx,%r15
+  80074c:	48 b8 f3 8f ff ff ff 	movabs $0xffffffffffff8ff3,%rax
+  800753:	ff ff ff 
+  800756:	48 01 d8             	add    %rbx,%rax
+  800759:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  80075b:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800761:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800768:	5b                   	pop    %rbx
+  800769:	41 5f                	pop    %r15
+  80076b:	5d                   	pop    %rbp
+  80076c:	c3                   	ret
+
+000000000080076d <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  80076d:	55                   	push   %rbp
+  80076e:	48 89 e5             	mov    %rsp,%rbp
+  800771:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800778:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800778 <cprintf+0xb>
+  80077f:	49 bb c8 88 00 00 00 	movabs $0x88c8,%r11
+  800786:	00 00 00 
+  800789:	4d 01 da             	add    %r11,%r10
+  80078c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800793:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80079a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8007a1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8007a8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8007af:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8007b6:	84 c0                	test   %al,%al
+  8007b8:	74 20                	je     8007da <cprintf+0x6d>
+  8007ba:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8007be:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8007c2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8007c6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8007ca:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8007ce:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8007d2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8007d6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8007da:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8007e1:	00 00 00 
+  8007e4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8007eb:	00 00 00 
+  8007ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007f2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8007f9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800800:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800807:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80080e:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800815:	48 8b 06             	mov    (%rsi),%rax
+  800818:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80081c:	48 89 01             	mov    %rax,(%rcx)
+  80081f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800823:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800827:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80082b:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800832:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800839:	48 89 d6             	mov    %rdx,%rsi
+  80083c:	48 89 c7             	mov    %rax,%rdi
+  80083f:	48 b8 4d 76 ff ff ff 	movabs $0xffffffffffff764d,%rax
+  800846:	ff ff ff 
+  800849:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80084d:	ff d0                	call   *%rax
+  80084f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800855:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80085b:	c9                   	leave
+  80085c:	c3                   	ret
+
+000000000080085d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80085d:	55                   	push   %rbp
+  80085e:	48 89 e5             	mov    %rsp,%rbp
+  800861:	53                   	push   %rbx
+  800862:	48 83 ec 38          	sub    $0x38,%rsp
+  800866:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800866 <printnum+0x9>
+  80086d:	49 bb da 87 00 00 00 	movabs $0x87da,%r11
+  800874:	00 00 00 
+  800877:	4c 01 db             	add    %r11,%rbx
+  80087a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80087e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800882:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800886:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800889:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  80088d:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800891:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800894:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800898:	72 58                	jb     8008f2 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80089a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80089d:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8008a0:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  8008a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8008a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008ac:	48 f7 f6             	div    %rsi
+  8008af:	49 89 c2             	mov    %rax,%r10
+  8008b2:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8008b5:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8008b8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8008bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008c0:	41 89 c9             	mov    %ecx,%r9d
+  8008c3:	41 89 f8             	mov    %edi,%r8d
+  8008c6:	89 d1                	mov    %edx,%ecx
+  8008c8:	4c 89 d2             	mov    %r10,%rdx
+  8008cb:	48 89 c7             	mov    %rax,%rdi
+  8008ce:	48 b8 1d 78 ff ff ff 	movabs $0xffffffffffff781d,%rax
+  8008d5:	ff ff ff 
+  8008d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8008dc:	ff d0                	call   *%rax
+  8008de:	eb 1c                	jmp    8008fc <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8008e0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8008e4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8008e7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8008eb:	48 89 d6             	mov    %rdx,%rsi
+  8008ee:	89 c7                	mov    %eax,%edi
+  8008f0:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8008f2:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8008f6:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8008fa:	7f e4                	jg     8008e0 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8008fc:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8008ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800903:	ba 00 00 00 00       	mov    $0x0,%edx
+  800908:	48 f7 f1             	div    %rcx
+  80090b:	48 b8 07 e1 ff ff ff 	movabs $0xffffffffffffe107,%rax
+  800912:	ff ff ff 
+  800915:	48 01 d8             	add    %rbx,%rax
+  800918:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80091c:	0f be c0             	movsbl %al,%eax
+  80091f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800923:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800927:	48 89 d6             	mov    %rdx,%rsi
+  80092a:	89 c7                	mov    %eax,%edi
+  80092c:	ff d1                	call   *%rcx
+}
+  80092e:	90                   	nop
+  80092f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800933:	c9                   	leave
+  800934:	c3                   	ret
+
+0000000000800935 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800935:	55                   	push   %rbp
+  800936:	48 89 e5             	mov    %rsp,%rbp
+  800939:	48 83 ec 20          	sub    $0x20,%rsp
+  80093d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80093d <getuint+0x8>
+  800944:	49 bb 03 87 00 00 00 	movabs $0x8703,%r11
+  80094b:	00 00 00 
+  80094e:	4c 01 d8             	add    %r11,%rax
+  800951:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800955:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800958:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  80095c:	7e 4f                	jle    8009ad <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  80095e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800962:	8b 00                	mov    (%rax),%eax
+  800964:	83 f8 2f             	cmp    $0x2f,%eax
+  800967:	77 24                	ja     80098d <getuint+0x58>
+  800969:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80096d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800971:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800975:	8b 00                	mov    (%rax),%eax
+  800977:	89 c0                	mov    %eax,%eax
+  800979:	48 01 d0             	add    %rdx,%rax
+  80097c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800980:	8b 12                	mov    (%rdx),%edx
+  800982:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800985:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800989:	89 0a                	mov    %ecx,(%rdx)
+  80098b:	eb 14                	jmp    8009a1 <getuint+0x6c>
+  80098d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800991:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800995:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800999:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80099d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009a1:	48 8b 00             	mov    (%rax),%rax
+  8009a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009a8:	e9 9d 00 00 00       	jmp    800a4a <getuint+0x115>
+	else if (lflag)
+  8009ad:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8009b1:	74 4c                	je     8009ff <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  8009b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009b7:	8b 00                	mov    (%rax),%eax
+  8009b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bc:	77 24                	ja     8009e2 <getuint+0xad>
+  8009be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009c2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ca:	8b 00                	mov    (%rax),%eax
+  8009cc:	89 c0                	mov    %eax,%eax
+  8009ce:	48 01 d0             	add    %rdx,%rax
+  8009d1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009d5:	8b 12                	mov    (%rdx),%edx
+  8009d7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009da:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009de:	89 0a                	mov    %ecx,(%rdx)
+  8009e0:	eb 14                	jmp    8009f6 <getuint+0xc1>
+  8009e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009ea:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009ee:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8009f2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009f6:	48 8b 00             	mov    (%rax),%rax
+  8009f9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8009fd:	eb 4b                	jmp    800a4a <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  8009ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a03:	8b 00                	mov    (%rax),%eax
+  800a05:	83 f8 2f             	cmp    $0x2f,%eax
+  800a08:	77 24                	ja     800a2e <getuint+0xf9>
+  800a0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a0e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a12:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a16:	8b 00                	mov    (%rax),%eax
+  800a18:	89 c0                	mov    %eax,%eax
+  800a1a:	48 01 d0             	add    %rdx,%rax
+  800a1d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a21:	8b 12                	mov    (%rdx),%edx
+  800a23:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a26:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a2a:	89 0a                	mov    %ecx,(%rdx)
+  800a2c:	eb 14                	jmp    800a42 <getuint+0x10d>
+  800a2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a32:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a36:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a3a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a3e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a42:	8b 00                	mov    (%rax),%eax
+  800a44:	89 c0                	mov    %eax,%eax
+  800a46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800a4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800a4e:	c9                   	leave
+  800a4f:	c3                   	ret
+
+0000000000800a50 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800a50:	55                   	push   %rbp
+  800a51:	48 89 e5             	mov    %rsp,%rbp
+  800a54:	48 83 ec 20          	sub    $0x20,%rsp
+  800a58:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a58 <printfloat+0x8>
+  800a5f:	49 bb e8 85 00 00 00 	movabs $0x85e8,%r11
+  800a66:	00 00 00 
+  800a69:	4c 01 d8             	add    %r11,%rax
+  800a6c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a70:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800a74:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800a78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a7c:	48 85 c0             	test   %rax,%rax
+  800a7f:	79 12                	jns    800a93 <printfloat+0x43>
+		putch('-',putdat);
+  800a81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a85:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a89:	48 89 c6             	mov    %rax,%rsi
+  800a8c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a91:	ff d2                	call   *%rdx
+	
+}
+  800a93:	90                   	nop
+  800a94:	c9                   	leave
+  800a95:	c3                   	ret
+
+0000000000800a96 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800a96:	55                   	push   %rbp
+  800a97:	48 89 e5             	mov    %rsp,%rbp
+  800a9a:	48 83 ec 20          	sub    $0x20,%rsp
+  800a9e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a9e <getint+0x8>
+  800aa5:	49 bb a2 85 00 00 00 	movabs $0x85a2,%r11
+  800aac:	00 00 00 
+  800aaf:	4c 01 d8             	add    %r11,%rax
+  800ab2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ab6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800ab9:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800abd:	7e 4f                	jle    800b0e <getint+0x78>
+		x=va_arg(*ap, long long);
+  800abf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ac3:	8b 00                	mov    (%rax),%eax
+  800ac5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac8:	77 24                	ja     800aee <getint+0x58>
+  800aca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ace:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ad2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ad6:	8b 00                	mov    (%rax),%eax
+  800ad8:	89 c0                	mov    %eax,%eax
+  800ada:	48 01 d0             	add    %rdx,%rax
+  800add:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ae1:	8b 12                	mov    (%rdx),%edx
+  800ae3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ae6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aea:	89 0a                	mov    %ecx,(%rdx)
+  800aec:	eb 14                	jmp    800b02 <getint+0x6c>
+  800aee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800af6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800afa:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800afe:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b02:	48 8b 00             	mov    (%rax),%rax
+  800b05:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b09:	e9 9d 00 00 00       	jmp    800bab <getint+0x115>
+	else if (lflag)
+  800b0e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800b12:	74 4c                	je     800b60 <getint+0xca>
+		x=va_arg(*ap, long);
+  800b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b18:	8b 00                	mov    (%rax),%eax
+  800b1a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1d:	77 24                	ja     800b43 <getint+0xad>
+  800b1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b23:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b2b:	8b 00                	mov    (%rax),%eax
+  800b2d:	89 c0                	mov    %eax,%eax
+  800b2f:	48 01 d0             	add    %rdx,%rax
+  800b32:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b36:	8b 12                	mov    (%rdx),%edx
+  800b38:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b3b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b3f:	89 0a                	mov    %ecx,(%rdx)
+  800b41:	eb 14                	jmp    800b57 <getint+0xc1>
+  800b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b47:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b4b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b4f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b53:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b57:	48 8b 00             	mov    (%rax),%rax
+  800b5a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b5e:	eb 4b                	jmp    800bab <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800b60:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b64:	8b 00                	mov    (%rax),%eax
+  800b66:	83 f8 2f             	cmp    $0x2f,%eax
+  800b69:	77 24                	ja     800b8f <getint+0xf9>
+  800b6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b6f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b77:	8b 00                	mov    (%rax),%eax
+  800b79:	89 c0                	mov    %eax,%eax
+  800b7b:	48 01 d0             	add    %rdx,%rax
+  800b7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b82:	8b 12                	mov    (%rdx),%edx
+  800b84:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b87:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b8b:	89 0a                	mov    %ecx,(%rdx)
+  800b8d:	eb 14                	jmp    800ba3 <getint+0x10d>
+  800b8f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b93:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b97:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b9b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b9f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ba3:	8b 00                	mov    (%rax),%eax
+  800ba5:	48 98                	cltq
+  800ba7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800bab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800baf:	c9                   	leave
+  800bb0:	c3                   	ret
+
+0000000000800bb1 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800bb1:	55                   	push   %rbp
+  800bb2:	48 89 e5             	mov    %rsp,%rbp
+  800bb5:	41 57                	push   %r15
+  800bb7:	41 55                	push   %r13
+  800bb9:	41 54                	push   %r12
+  800bbb:	53                   	push   %rbx
+  800bbc:	48 83 ec 60          	sub    $0x60,%rsp
+  800bc0:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800bc0 <vprintfmt+0xf>
+  800bc7:	49 bb 80 84 00 00 00 	movabs $0x8480,%r11
+  800bce:	00 00 00 
+  800bd1:	4d 01 dc             	add    %r11,%r12
+  800bd4:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800bd8:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800bdc:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800be0:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800be4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800beb:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800bef:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800bf3:	48 8b 06             	mov    (%rsi),%rax
+  800bf6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800bfa:	48 89 01             	mov    %rax,(%rcx)
+  800bfd:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800c01:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800c05:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c09:	eb 17                	jmp    800c22 <vprintfmt+0x71>
+			if (ch == '\0')
+  800c0b:	85 db                	test   %ebx,%ebx
+  800c0d:	0f 84 97 05 00 00    	je     8011aa <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800c13:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c17:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c1b:	48 89 c6             	mov    %rax,%rsi
+  800c1e:	89 df                	mov    %ebx,%edi
+  800c20:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c22:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c26:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c2a:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c2e:	0f b6 00             	movzbl (%rax),%eax
+  800c31:	0f b6 d8             	movzbl %al,%ebx
+  800c34:	83 fb 25             	cmp    $0x25,%ebx
+  800c37:	75 d2                	jne    800c0b <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800c39:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800c3d:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800c44:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800c4b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800c52:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800c59:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800c5d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c61:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c65:	0f b6 00             	movzbl (%rax),%eax
+  800c68:	0f b6 d8             	movzbl %al,%ebx
+  800c6b:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c6e:	83 f8 55             	cmp    $0x55,%eax
+  800c71:	0f 87 00 05 00 00    	ja     801177 <vprintfmt+0x5c6>
+  800c77:	89 c0                	mov    %eax,%eax
+  800c79:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c80:	00 
+  800c81:	48 8d 05 e8 64 00 00 	lea    0x64e8(%rip),%rax        # 807170 <.LC18+0xc>
+  800c88:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800c8c:	48 8d 15 dd 64 00 00 	lea    0x64dd(%rip),%rdx        # 807170 <.LC18+0xc>
+  800c93:	48 01 d0             	add    %rdx,%rax
+  800c96:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800c98:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800c9c:	eb bb                	jmp    800c59 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800c9e:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800ca2:	eb b5                	jmp    800c59 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800ca4:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800cab:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800cae:	89 d0                	mov    %edx,%eax
+  800cb0:	c1 e0 02             	shl    $0x2,%eax
+  800cb3:	01 d0                	add    %edx,%eax
+  800cb5:	01 c0                	add    %eax,%eax
+  800cb7:	01 d8                	add    %ebx,%eax
+  800cb9:	83 e8 30             	sub    $0x30,%eax
+  800cbc:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800cbf:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800cc3:	0f b6 00             	movzbl (%rax),%eax
+  800cc6:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800cc9:	83 fb 2f             	cmp    $0x2f,%ebx
+  800ccc:	7e 60                	jle    800d2e <vprintfmt+0x17d>
+  800cce:	83 fb 39             	cmp    $0x39,%ebx
+  800cd1:	7f 5b                	jg     800d2e <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800cd3:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800cd8:	eb d1                	jmp    800cab <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800cda:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800cdd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce0:	77 17                	ja     800cf9 <vprintfmt+0x148>
+  800ce2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800ce6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ce9:	89 d2                	mov    %edx,%edx
+  800ceb:	48 01 d0             	add    %rdx,%rax
+  800cee:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800cf1:	83 c2 08             	add    $0x8,%edx
+  800cf4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800cf7:	eb 0c                	jmp    800d05 <vprintfmt+0x154>
+  800cf9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cfd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d01:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d05:	8b 00                	mov    (%rax),%eax
+  800d07:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800d0a:	eb 23                	jmp    800d2f <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800d0c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d10:	0f 89 43 ff ff ff    	jns    800c59 <vprintfmt+0xa8>
+				width = 0;
+  800d16:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800d1d:	e9 37 ff ff ff       	jmp    800c59 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800d22:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800d29:	e9 2b ff ff ff       	jmp    800c59 <vprintfmt+0xa8>
+			goto process_precision;
+  800d2e:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800d2f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d33:	0f 89 20 ff ff ff    	jns    800c59 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800d39:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800d3c:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800d3f:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800d46:	e9 0e ff ff ff       	jmp    800c59 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800d4b:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800d4f:	e9 05 ff ff ff       	jmp    800c59 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800d54:	83 fb 39             	cmp    $0x39,%ebx
+  800d57:	7f 0b                	jg     800d64 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800d59:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800d5c:	c1 e0 08             	shl    $0x8,%eax
+  800d5f:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d62:	eb 21                	jmp    800d85 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800d64:	83 fb 60             	cmp    $0x60,%ebx
+  800d67:	7e 10                	jle    800d79 <vprintfmt+0x1c8>
+  800d69:	83 fb 66             	cmp    $0x66,%ebx
+  800d6c:	7f 0b                	jg     800d79 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800d6e:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800d71:	c1 e0 08             	shl    $0x8,%eax
+  800d74:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800d77:	eb 0c                	jmp    800d85 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800d79:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800d80:	e9 04 01 00 00       	jmp    800e89 <vprintfmt+0x2d8>
+  800d85:	e9 ff 00 00 00       	jmp    800e89 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800d8a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d90:	77 17                	ja     800da9 <vprintfmt+0x1f8>
+  800d92:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d96:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d99:	89 d2                	mov    %edx,%edx
+  800d9b:	48 01 d0             	add    %rdx,%rax
+  800d9e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800da7:	eb 0c                	jmp    800db5 <vprintfmt+0x204>
+  800da9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dad:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800db1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800db5:	8b 00                	mov    (%rax),%eax
+  800db7:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800dbb:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800dbf:	48 89 d6             	mov    %rdx,%rsi
+  800dc2:	89 c7                	mov    %eax,%edi
+  800dc4:	ff d1                	call   *%rcx
+			break;
+  800dc6:	e9 da 03 00 00       	jmp    8011a5 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800dcb:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800dce:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd1:	77 17                	ja     800dea <vprintfmt+0x239>
+  800dd3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dd7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dda:	89 d2                	mov    %edx,%edx
+  800ddc:	48 01 d0             	add    %rdx,%rax
+  800ddf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800de2:	83 c2 08             	add    $0x8,%edx
+  800de5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800de8:	eb 0c                	jmp    800df6 <vprintfmt+0x245>
+  800dea:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800df2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800df6:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800df8:	85 db                	test   %ebx,%ebx
+  800dfa:	79 02                	jns    800dfe <vprintfmt+0x24d>
+				err = -err;
+  800dfc:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800dfe:	83 fb 15             	cmp    $0x15,%ebx
+  800e01:	7f 19                	jg     800e1c <vprintfmt+0x26b>
+  800e03:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800e0a:	00 00 00 
+  800e0d:	48 63 c3             	movslq %ebx,%rax
+  800e10:	4c 01 e2             	add    %r12,%rdx
+  800e13:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800e17:	4d 85 ed             	test   %r13,%r13
+  800e1a:	75 36                	jne    800e52 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800e1c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e20:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e24:	89 d9                	mov    %ebx,%ecx
+  800e26:	48 ba 18 e1 ff ff ff 	movabs $0xffffffffffffe118,%rdx
+  800e2d:	ff ff ff 
+  800e30:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e34:	48 89 c7             	mov    %rax,%rdi
+  800e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3c:	49 b8 78 81 ff ff ff 	movabs $0xffffffffffff8178,%r8
+  800e43:	ff ff ff 
+  800e46:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e4a:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800e4d:	e9 53 03 00 00       	jmp    8011a5 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800e52:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800e56:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e5a:	4c 89 e9             	mov    %r13,%rcx
+  800e5d:	48 ba 21 e1 ff ff ff 	movabs $0xffffffffffffe121,%rdx
+  800e64:	ff ff ff 
+  800e67:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800e6b:	48 89 c7             	mov    %rax,%rdi
+  800e6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e73:	49 b8 78 81 ff ff ff 	movabs $0xffffffffffff8178,%r8
+  800e7a:	ff ff ff 
+  800e7d:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800e81:	41 ff d0             	call   *%r8
+			break;
+  800e84:	e9 1c 03 00 00       	jmp    8011a5 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800e89:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e8c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e8f:	77 17                	ja     800ea8 <vprintfmt+0x2f7>
+  800e91:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e95:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e98:	89 d2                	mov    %edx,%edx
+  800e9a:	48 01 d0             	add    %rdx,%rax
+  800e9d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ea0:	83 c2 08             	add    $0x8,%edx
+  800ea3:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ea6:	eb 0c                	jmp    800eb4 <vprintfmt+0x303>
+  800ea8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800eac:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800eb0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800eb4:	4c 8b 28             	mov    (%rax),%r13
+  800eb7:	4d 85 ed             	test   %r13,%r13
+  800eba:	75 0e                	jne    800eca <vprintfmt+0x319>
+				p = "(null)";
+  800ebc:	48 b8 24 e1 ff ff ff 	movabs $0xffffffffffffe124,%rax
+  800ec3:	ff ff ff 
+  800ec6:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800eca:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ece:	0f 8e 84 00 00 00    	jle    800f58 <vprintfmt+0x3a7>
+  800ed4:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800ed8:	74 7e                	je     800f58 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800eda:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800edd:	48 98                	cltq
+  800edf:	48 89 c6             	mov    %rax,%rsi
+  800ee2:	4c 89 ef             	mov    %r13,%rdi
+  800ee5:	4d 89 e7             	mov    %r12,%r15
+  800ee8:	48 b8 9d 84 ff ff ff 	movabs $0xffffffffffff849d,%rax
+  800eef:	ff ff ff 
+  800ef2:	4c 01 e0             	add    %r12,%rax
+  800ef5:	ff d0                	call   *%rax
+  800ef7:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800efa:	eb 17                	jmp    800f13 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800efc:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800f00:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800f04:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800f08:	48 89 d6             	mov    %rdx,%rsi
+  800f0b:	89 c7                	mov    %eax,%edi
+  800f0d:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f0f:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f13:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f17:	7f e3                	jg     800efc <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f19:	eb 3d                	jmp    800f58 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800f1b:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800f1f:	74 1e                	je     800f3f <vprintfmt+0x38e>
+  800f21:	83 fb 1f             	cmp    $0x1f,%ebx
+  800f24:	7e 05                	jle    800f2b <vprintfmt+0x37a>
+  800f26:	83 fb 7e             	cmp    $0x7e,%ebx
+  800f29:	7e 14                	jle    800f3f <vprintfmt+0x38e>
+					putch('?', putdat);
+  800f2b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f2f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f33:	48 89 c6             	mov    %rax,%rsi
+  800f36:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800f3b:	ff d2                	call   *%rdx
+  800f3d:	eb 15                	jmp    800f54 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800f3f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800f42:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800f45:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f49:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f4d:	48 89 c6             	mov    %rax,%rsi
+  800f50:	89 cf                	mov    %ecx,%edi
+  800f52:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f54:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f58:	4c 89 e8             	mov    %r13,%rax
+  800f5b:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800f5f:	0f b6 00             	movzbl (%rax),%eax
+  800f62:	0f be d8             	movsbl %al,%ebx
+  800f65:	85 db                	test   %ebx,%ebx
+  800f67:	74 28                	je     800f91 <vprintfmt+0x3e0>
+  800f69:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f6d:	78 ac                	js     800f1b <vprintfmt+0x36a>
+  800f6f:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800f73:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800f77:	79 a2                	jns    800f1b <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800f79:	eb 16                	jmp    800f91 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800f7b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800f7f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800f83:	48 89 c6             	mov    %rax,%rsi
+  800f86:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f8b:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  800f8d:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f91:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f95:	7f e4                	jg     800f7b <vprintfmt+0x3ca>
+			break;
+  800f97:	e9 09 02 00 00       	jmp    8011a5 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  800f9c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800fa0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fa4:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800fa8:	0f b6 00             	movzbl (%rax),%eax
+  800fab:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  800fae:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  800faf:	83 fb 2f             	cmp    $0x2f,%ebx
+  800fb2:	0f 8e ac fd ff ff    	jle    800d64 <vprintfmt+0x1b3>
+  800fb8:	e9 97 fd ff ff       	jmp    800d54 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  800fbd:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  800fc1:	be 03 00 00 00       	mov    $0x3,%esi
+  800fc6:	48 89 c7             	mov    %rax,%rdi
+  800fc9:	48 b8 56 7a ff ff ff 	movabs $0xffffffffffff7a56,%rax
+  800fd0:	ff ff ff 
+  800fd3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fd7:	ff d0                	call   *%rax
+  800fd9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  800fdd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fe1:	48 85 c0             	test   %rax,%rax
+  800fe4:	79 1d                	jns    801003 <vprintfmt+0x452>
+				putch('-', putdat);
+  800fe6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fea:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fee:	48 89 c6             	mov    %rax,%rsi
+  800ff1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ff6:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  800ff8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ffc:	48 f7 d8             	neg    %rax
+  800fff:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  801003:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80100a:	e9 de 00 00 00       	jmp    8010ed <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  80100f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801013:	be 03 00 00 00       	mov    $0x3,%esi
+  801018:	48 89 c7             	mov    %rax,%rdi
+  80101b:	48 b8 f5 78 ff ff ff 	movabs $0xffffffffffff78f5,%rax
+  801022:	ff ff ff 
+  801025:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801029:	ff d0                	call   *%rax
+  80102b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  80102f:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801036:	e9 b2 00 00 00       	jmp    8010ed <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  80103b:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80103f:	be 03 00 00 00       	mov    $0x3,%esi
+  801044:	48 89 c7             	mov    %rax,%rdi
+  801047:	48 b8 f5 78 ff ff ff 	movabs $0xffffffffffff78f5,%rax
+  80104e:	ff ff ff 
+  801051:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801055:	ff d0                	call   *%rax
+  801057:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  80105b:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801062:	e9 86 00 00 00       	jmp    8010ed <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801067:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80106b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80106f:	48 89 c6             	mov    %rax,%rsi
+  801072:	bf 30 00 00 00       	mov    $0x30,%edi
+  801077:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801079:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80107d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801081:	48 89 c6             	mov    %rax,%rsi
+  801084:	bf 78 00 00 00       	mov    $0x78,%edi
+  801089:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80108b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80108e:	83 f8 2f             	cmp    $0x2f,%eax
+  801091:	77 17                	ja     8010aa <vprintfmt+0x4f9>
+  801093:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801097:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80109a:	89 d2                	mov    %edx,%edx
+  80109c:	48 01 d0             	add    %rdx,%rax
+  80109f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  8010a2:	83 c2 08             	add    $0x8,%edx
+  8010a5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  8010a8:	eb 0c                	jmp    8010b6 <vprintfmt+0x505>
+  8010aa:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8010ae:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8010b2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8010b6:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  8010b9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010bd:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8010c4:	eb 27                	jmp    8010ed <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8010c6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010ca:	be 03 00 00 00       	mov    $0x3,%esi
+  8010cf:	48 89 c7             	mov    %rax,%rdi
+  8010d2:	48 b8 f5 78 ff ff ff 	movabs $0xffffffffffff78f5,%rax
+  8010d9:	ff ff ff 
+  8010dc:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010e0:	ff d0                	call   *%rax
+  8010e2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8010e6:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8010ed:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8010f2:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8010f5:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8010f8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8010fc:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801100:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801104:	45 89 c1             	mov    %r8d,%r9d
+  801107:	41 89 f8             	mov    %edi,%r8d
+  80110a:	48 89 c7             	mov    %rax,%rdi
+  80110d:	48 b8 1d 78 ff ff ff 	movabs $0xffffffffffff781d,%rax
+  801114:	ff ff ff 
+  801117:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80111b:	ff d0                	call   *%rax
+			break;
+  80111d:	e9 83 00 00 00       	jmp    8011a5 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801122:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801126:	be 03 00 00 00       	mov    $0x3,%esi
+  80112b:	48 89 c7             	mov    %rax,%rdi
+  80112e:	48 b8 f5 78 ff ff ff 	movabs $0xffffffffffff78f5,%rax
+  801135:	ff ff ff 
+  801138:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80113c:	ff d0                	call   *%rax
+  80113e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801142:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801146:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80114a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80114e:	48 89 ce             	mov    %rcx,%rsi
+  801151:	48 89 c7             	mov    %rax,%rdi
+  801154:	48 b8 10 7a ff ff ff 	movabs $0xffffffffffff7a10,%rax
+  80115b:	ff ff ff 
+  80115e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801162:	ff d0                	call   *%rax
+	
+			break;
+  801164:	eb 3f                	jmp    8011a5 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801166:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80116a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80116e:	48 89 c6             	mov    %rax,%rsi
+  801171:	89 df                	mov    %ebx,%edi
+  801173:	ff d2                	call   *%rdx
+			break;
+  801175:	eb 2e                	jmp    8011a5 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801177:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80117b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80117f:	48 89 c6             	mov    %rax,%rsi
+  801182:	bf 25 00 00 00       	mov    $0x25,%edi
+  801187:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801189:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80118e:	eb 05                	jmp    801195 <vprintfmt+0x5e4>
+  801190:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801195:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801199:	48 83 e8 01          	sub    $0x1,%rax
+  80119d:	0f b6 00             	movzbl (%rax),%eax
+  8011a0:	3c 25                	cmp    $0x25,%al
+  8011a2:	75 ec                	jne    801190 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  8011a4:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8011a5:	e9 78 fa ff ff       	jmp    800c22 <vprintfmt+0x71>
+				return;
+  8011aa:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  8011ab:	48 83 c4 60          	add    $0x60,%rsp
+  8011af:	5b                   	pop    %rbx
+  8011b0:	41 5c                	pop    %r12
+  8011b2:	41 5d                	pop    %r13
+  8011b4:	41 5f                	pop    %r15
+  8011b6:	5d                   	pop    %rbp
+  8011b7:	c3                   	ret
+
+00000000008011b8 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  8011b8:	55                   	push   %rbp
+  8011b9:	48 89 e5             	mov    %rsp,%rbp
+  8011bc:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8011c3:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8011c3 <printfmt+0xb>
+  8011ca:	49 bb 7d 7e 00 00 00 	movabs $0x7e7d,%r11
+  8011d1:	00 00 00 
+  8011d4:	4d 01 da             	add    %r11,%r10
+  8011d7:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8011de:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8011e5:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8011ec:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8011f3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8011fa:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801201:	84 c0                	test   %al,%al
+  801203:	74 20                	je     801225 <printfmt+0x6d>
+  801205:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801209:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80120d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801211:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801215:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801219:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80121d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801221:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801225:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80122c:	00 00 00 
+  80122f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801236:	00 00 00 
+  801239:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80123d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801244:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80124b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801252:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801259:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801260:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801267:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80126e:	48 89 c7             	mov    %rax,%rdi
+  801271:	48 b8 71 7b ff ff ff 	movabs $0xffffffffffff7b71,%rax
+  801278:	ff ff ff 
+  80127b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80127f:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801281:	90                   	nop
+  801282:	c9                   	leave
+  801283:	c3                   	ret
+
+0000000000801284 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801284:	55                   	push   %rbp
+  801285:	48 89 e5             	mov    %rsp,%rbp
+  801288:	48 83 ec 10          	sub    $0x10,%rsp
+  80128c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80128c <sprintputch+0x8>
+  801293:	49 bb b4 7d 00 00 00 	movabs $0x7db4,%r11
+  80129a:	00 00 00 
+  80129d:	4c 01 d8             	add    %r11,%rax
+  8012a0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8012a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  8012a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012ab:	8b 40 10             	mov    0x10(%rax),%eax
+  8012ae:	8d 50 01             	lea    0x1(%rax),%edx
+  8012b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012b5:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  8012b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012bc:	48 8b 10             	mov    (%rax),%rdx
+  8012bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012c3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012c7:	48 39 c2             	cmp    %rax,%rdx
+  8012ca:	73 17                	jae    8012e3 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8012cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8012d0:	48 8b 00             	mov    (%rax),%rax
+  8012d3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012d7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8012db:	48 89 0a             	mov    %rcx,(%rdx)
+  8012de:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8012e1:	88 10                	mov    %dl,(%rax)
+}
+  8012e3:	90                   	nop
+  8012e4:	c9                   	leave
+  8012e5:	c3                   	ret
+
+00000000008012e6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8012e6:	55                   	push   %rbp
+  8012e7:	48 89 e5             	mov    %rsp,%rbp
+  8012ea:	53                   	push   %rbx
+  8012eb:	48 83 ec 58          	sub    $0x58,%rsp
+  8012ef:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8012ef <vsnprintf+0x9>
+  8012f6:	49 bb 51 7d 00 00 00 	movabs $0x7d51,%r11
+  8012fd:	00 00 00 
+  801300:	4c 01 d8             	add    %r11,%rax
+  801303:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801307:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80130a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80130e:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801312:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801316:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80131a:	48 8b 0e             	mov    (%rsi),%rcx
+  80131d:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801321:	48 89 0a             	mov    %rcx,(%rdx)
+  801324:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801328:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  80132c:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801330:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801334:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801338:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80133b:	48 63 d2             	movslq %edx,%rdx
+  80133e:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801342:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801346:	48 01 ca             	add    %rcx,%rdx
+  801349:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80134d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801354:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801359:	74 06                	je     801361 <vsnprintf+0x7b>
+  80135b:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  80135f:	7f 07                	jg     801368 <vsnprintf+0x82>
+		return -E_INVAL;
+  801361:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801366:	eb 34                	jmp    80139c <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801368:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  80136c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801370:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801374:	48 bf 44 82 ff ff ff 	movabs $0xffffffffffff8244,%rdi
+  80137b:	ff ff ff 
+  80137e:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801382:	49 b8 71 7b ff ff ff 	movabs $0xffffffffffff7b71,%r8
+  801389:	ff ff ff 
+  80138c:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801390:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801392:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801396:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801399:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80139c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8013a0:	c9                   	leave
+  8013a1:	c3                   	ret
+
+00000000008013a2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8013a2:	55                   	push   %rbp
+  8013a3:	48 89 e5             	mov    %rsp,%rbp
+  8013a6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8013ad:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8013ad <snprintf+0xb>
+  8013b4:	49 bb 93 7c 00 00 00 	movabs $0x7c93,%r11
+  8013bb:	00 00 00 
+  8013be:	4d 01 da             	add    %r11,%r10
+  8013c1:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8013c8:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8013ce:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8013d5:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8013dc:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8013e3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8013ea:	84 c0                	test   %al,%al
+  8013ec:	74 20                	je     80140e <snprintf+0x6c>
+  8013ee:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8013f2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8013f6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8013fa:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8013fe:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801402:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801406:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80140a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80140e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801415:	00 00 00 
+  801418:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80141f:	00 00 00 
+  801422:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801426:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80142d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801434:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80143b:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801442:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801449:	48 8b 06             	mov    (%rsi),%rax
+  80144c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801450:	48 89 01             	mov    %rax,(%rcx)
+  801453:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801457:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80145b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80145f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801466:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80146d:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801473:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80147a:	48 89 c7             	mov    %rax,%rdi
+  80147d:	48 b8 a6 82 ff ff ff 	movabs $0xffffffffffff82a6,%rax
+  801484:	ff ff ff 
+  801487:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80148b:	ff d0                	call   *%rax
+  80148d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801493:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801499:	c9                   	leave
+  80149a:	c3                   	ret
+
+000000000080149b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 18          	sub    $0x18,%rsp
+  8014a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014a3 <strlen+0x8>
+  8014aa:	49 bb 9d 7b 00 00 00 	movabs $0x7b9d,%r11
+  8014b1:	00 00 00 
+  8014b4:	4c 01 d8             	add    %r11,%rax
+  8014b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8014bb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8014c2:	eb 09                	jmp    8014cd <strlen+0x32>
+		n++;
+  8014c4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8014c8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8014cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014d1:	0f b6 00             	movzbl (%rax),%eax
+  8014d4:	84 c0                	test   %al,%al
+  8014d6:	75 ec                	jne    8014c4 <strlen+0x29>
+	return n;
+  8014d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8014db:	c9                   	leave
+  8014dc:	c3                   	ret
+
+00000000008014dd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8014dd:	55                   	push   %rbp
+  8014de:	48 89 e5             	mov    %rsp,%rbp
+  8014e1:	48 83 ec 20          	sub    $0x20,%rsp
+  8014e5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8014e5 <strnlen+0x8>
+  8014ec:	49 bb 5b 7b 00 00 00 	movabs $0x7b5b,%r11
+  8014f3:	00 00 00 
+  8014f6:	4c 01 d8             	add    %r11,%rax
+  8014f9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014fd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801501:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801508:	eb 0e                	jmp    801518 <strnlen+0x3b>
+		n++;
+  80150a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80150e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801513:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801518:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80151d:	74 0b                	je     80152a <strnlen+0x4d>
+  80151f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801523:	0f b6 00             	movzbl (%rax),%eax
+  801526:	84 c0                	test   %al,%al
+  801528:	75 e0                	jne    80150a <strnlen+0x2d>
+	return n;
+  80152a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80152d:	c9                   	leave
+  80152e:	c3                   	ret
+
+000000000080152f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80152f:	55                   	push   %rbp
+  801530:	48 89 e5             	mov    %rsp,%rbp
+  801533:	48 83 ec 20          	sub    $0x20,%rsp
+  801537:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801537 <strcpy+0x8>
+  80153e:	49 bb 09 7b 00 00 00 	movabs $0x7b09,%r11
+  801545:	00 00 00 
+  801548:	4c 01 d8             	add    %r11,%rax
+  80154b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80154f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801553:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801557:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80155b:	90                   	nop
+  80155c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801560:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801564:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801568:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80156c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801570:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801574:	0f b6 12             	movzbl (%rdx),%edx
+  801577:	88 10                	mov    %dl,(%rax)
+  801579:	0f b6 00             	movzbl (%rax),%eax
+  80157c:	84 c0                	test   %al,%al
+  80157e:	75 dc                	jne    80155c <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801580:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801584:	c9                   	leave
+  801585:	c3                   	ret
+
+0000000000801586 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801586:	55                   	push   %rbp
+  801587:	48 89 e5             	mov    %rsp,%rbp
+  80158a:	53                   	push   %rbx
+  80158b:	48 83 ec 20          	sub    $0x20,%rsp
+  80158f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80158f <strcat+0x9>
+  801596:	49 bb b1 7a 00 00 00 	movabs $0x7ab1,%r11
+  80159d:	00 00 00 
+  8015a0:	4c 01 db             	add    %r11,%rbx
+  8015a3:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  8015a7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  8015ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015af:	48 89 c7             	mov    %rax,%rdi
+  8015b2:	48 b8 5b 84 ff ff ff 	movabs $0xffffffffffff845b,%rax
+  8015b9:	ff ff ff 
+  8015bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015c0:	ff d0                	call   *%rax
+  8015c2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8015c5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8015c8:	48 63 d0             	movslq %eax,%rdx
+  8015cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015cf:	48 01 c2             	add    %rax,%rdx
+  8015d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015d6:	48 89 c6             	mov    %rax,%rsi
+  8015d9:	48 89 d7             	mov    %rdx,%rdi
+  8015dc:	48 b8 ef 84 ff ff ff 	movabs $0xffffffffffff84ef,%rax
+  8015e3:	ff ff ff 
+  8015e6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8015ea:	ff d0                	call   *%rax
+	return dst;
+  8015ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8015f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015f4:	c9                   	leave
+  8015f5:	c3                   	ret
+
+00000000008015f6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8015f6:	55                   	push   %rbp
+  8015f7:	48 89 e5             	mov    %rsp,%rbp
+  8015fa:	48 83 ec 28          	sub    $0x28,%rsp
+  8015fe:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015fe <strncpy+0x8>
+  801605:	49 bb 42 7a 00 00 00 	movabs $0x7a42,%r11
+  80160c:	00 00 00 
+  80160f:	4c 01 d8             	add    %r11,%rax
+  801612:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801616:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80161a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80161e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801622:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801626:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80162d:	00 
+  80162e:	eb 2a                	jmp    80165a <strncpy+0x64>
+		*dst++ = *src;
+  801630:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801634:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801638:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80163c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801640:	0f b6 12             	movzbl (%rdx),%edx
+  801643:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801645:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801649:	0f b6 00             	movzbl (%rax),%eax
+  80164c:	84 c0                	test   %al,%al
+  80164e:	74 05                	je     801655 <strncpy+0x5f>
+			src++;
+  801650:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801655:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80165a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80165e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801662:	72 cc                	jb     801630 <strncpy+0x3a>
+	}
+	return ret;
+  801664:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801668:	c9                   	leave
+  801669:	c3                   	ret
+
+000000000080166a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80166a:	55                   	push   %rbp
+  80166b:	48 89 e5             	mov    %rsp,%rbp
+  80166e:	48 83 ec 28          	sub    $0x28,%rsp
+  801672:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801672 <strlcpy+0x8>
+  801679:	49 bb ce 79 00 00 00 	movabs $0x79ce,%r11
+  801680:	00 00 00 
+  801683:	4c 01 d8             	add    %r11,%rax
+  801686:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80168a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80168e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801692:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801696:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80169a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80169f:	74 3d                	je     8016de <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  8016a1:	eb 1d                	jmp    8016c0 <strlcpy+0x56>
+			*dst++ = *src++;
+  8016a3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016a7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016ab:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016b3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016b7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016bb:	0f b6 12             	movzbl (%rdx),%edx
+  8016be:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8016c0:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016c5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016ca:	74 0b                	je     8016d7 <strlcpy+0x6d>
+  8016cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016d0:	0f b6 00             	movzbl (%rax),%eax
+  8016d3:	84 c0                	test   %al,%al
+  8016d5:	75 cc                	jne    8016a3 <strlcpy+0x39>
+		*dst = '\0';
+  8016d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016db:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8016de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e2:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8016e6:	c9                   	leave
+  8016e7:	c3                   	ret
+
+00000000008016e8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8016e8:	55                   	push   %rbp
+  8016e9:	48 89 e5             	mov    %rsp,%rbp
+  8016ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8016f0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016f0 <strcmp+0x8>
+  8016f7:	49 bb 50 79 00 00 00 	movabs $0x7950,%r11
+  8016fe:	00 00 00 
+  801701:	4c 01 d8             	add    %r11,%rax
+  801704:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801708:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  80170c:	eb 0a                	jmp    801718 <strcmp+0x30>
+		p++, q++;
+  80170e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801713:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801718:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80171c:	0f b6 00             	movzbl (%rax),%eax
+  80171f:	84 c0                	test   %al,%al
+  801721:	74 12                	je     801735 <strcmp+0x4d>
+  801723:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801727:	0f b6 10             	movzbl (%rax),%edx
+  80172a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80172e:	0f b6 00             	movzbl (%rax),%eax
+  801731:	38 c2                	cmp    %al,%dl
+  801733:	74 d9                	je     80170e <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801735:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801739:	0f b6 00             	movzbl (%rax),%eax
+  80173c:	0f b6 d0             	movzbl %al,%edx
+  80173f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801743:	0f b6 00             	movzbl (%rax),%eax
+  801746:	0f b6 c0             	movzbl %al,%eax
+  801749:	29 c2                	sub    %eax,%edx
+  80174b:	89 d0                	mov    %edx,%eax
+}
+  80174d:	c9                   	leave
+  80174e:	c3                   	ret
+
+000000000080174f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80174f:	55                   	push   %rbp
+  801750:	48 89 e5             	mov    %rsp,%rbp
+  801753:	48 83 ec 18          	sub    $0x18,%rsp
+  801757:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801757 <strncmp+0x8>
+  80175e:	49 bb e9 78 00 00 00 	movabs $0x78e9,%r11
+  801765:	00 00 00 
+  801768:	4c 01 d8             	add    %r11,%rax
+  80176b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80176f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801773:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801777:	eb 0f                	jmp    801788 <strncmp+0x39>
+		n--, p++, q++;
+  801779:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80177e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801783:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801788:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80178d:	74 1d                	je     8017ac <strncmp+0x5d>
+  80178f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801793:	0f b6 00             	movzbl (%rax),%eax
+  801796:	84 c0                	test   %al,%al
+  801798:	74 12                	je     8017ac <strncmp+0x5d>
+  80179a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179e:	0f b6 10             	movzbl (%rax),%edx
+  8017a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017a5:	0f b6 00             	movzbl (%rax),%eax
+  8017a8:	38 c2                	cmp    %al,%dl
+  8017aa:	74 cd                	je     801779 <strncmp+0x2a>
+	if (n == 0)
+  8017ac:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8017b1:	75 07                	jne    8017ba <strncmp+0x6b>
+		return 0;
+  8017b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b8:	eb 16                	jmp    8017d0 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8017ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017be:	0f b6 00             	movzbl (%rax),%eax
+  8017c1:	0f b6 d0             	movzbl %al,%edx
+  8017c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c8:	0f b6 00             	movzbl (%rax),%eax
+  8017cb:	0f b6 c0             	movzbl %al,%eax
+  8017ce:	29 c2                	sub    %eax,%edx
+}
+  8017d0:	89 d0                	mov    %edx,%eax
+  8017d2:	c9                   	leave
+  8017d3:	c3                   	ret
+
+00000000008017d4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8017d4:	55                   	push   %rbp
+  8017d5:	48 89 e5             	mov    %rsp,%rbp
+  8017d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8017dc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017dc <strchr+0x8>
+  8017e3:	49 bb 64 78 00 00 00 	movabs $0x7864,%r11
+  8017ea:	00 00 00 
+  8017ed:	4c 01 d8             	add    %r11,%rax
+  8017f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017f4:	89 f0                	mov    %esi,%eax
+  8017f6:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8017f9:	eb 17                	jmp    801812 <strchr+0x3e>
+		if (*s == c)
+  8017fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ff:	0f b6 00             	movzbl (%rax),%eax
+  801802:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801805:	75 06                	jne    80180d <strchr+0x39>
+			return (char *) s;
+  801807:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180b:	eb 15                	jmp    801822 <strchr+0x4e>
+	for (; *s; s++)
+  80180d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801812:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801816:	0f b6 00             	movzbl (%rax),%eax
+  801819:	84 c0                	test   %al,%al
+  80181b:	75 de                	jne    8017fb <strchr+0x27>
+	return 0;
+  80181d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801822:	c9                   	leave
+  801823:	c3                   	ret
+
+0000000000801824 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801824:	55                   	push   %rbp
+  801825:	48 89 e5             	mov    %rsp,%rbp
+  801828:	48 83 ec 10          	sub    $0x10,%rsp
+  80182c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80182c <strfind+0x8>
+  801833:	49 bb 14 78 00 00 00 	movabs $0x7814,%r11
+  80183a:	00 00 00 
+  80183d:	4c 01 d8             	add    %r11,%rax
+  801840:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801844:	89 f0                	mov    %esi,%eax
+  801846:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801849:	eb 11                	jmp    80185c <strfind+0x38>
+		if (*s == c)
+  80184b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80184f:	0f b6 00             	movzbl (%rax),%eax
+  801852:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801855:	74 12                	je     801869 <strfind+0x45>
+	for (; *s; s++)
+  801857:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80185c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801860:	0f b6 00             	movzbl (%rax),%eax
+  801863:	84 c0                	test   %al,%al
+  801865:	75 e4                	jne    80184b <strfind+0x27>
+  801867:	eb 01                	jmp    80186a <strfind+0x46>
+			break;
+  801869:	90                   	nop
+	return (char *) s;
+  80186a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80186e:	c9                   	leave
+  80186f:	c3                   	ret
+
+0000000000801870 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801870:	55                   	push   %rbp
+  801871:	48 89 e5             	mov    %rsp,%rbp
+  801874:	48 83 ec 18          	sub    $0x18,%rsp
+  801878:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801878 <memset+0x8>
+  80187f:	49 bb c8 77 00 00 00 	movabs $0x77c8,%r11
+  801886:	00 00 00 
+  801889:	4c 01 d8             	add    %r11,%rax
+  80188c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801890:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801893:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801897:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80189c:	75 06                	jne    8018a4 <memset+0x34>
+		return v;
+  80189e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a2:	eb 69                	jmp    80190d <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  8018a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a8:	83 e0 03             	and    $0x3,%eax
+  8018ab:	48 85 c0             	test   %rax,%rax
+  8018ae:	75 48                	jne    8018f8 <memset+0x88>
+  8018b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b4:	83 e0 03             	and    $0x3,%eax
+  8018b7:	48 85 c0             	test   %rax,%rax
+  8018ba:	75 3c                	jne    8018f8 <memset+0x88>
+		c &= 0xFF;
+  8018bc:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8018c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018c6:	c1 e0 18             	shl    $0x18,%eax
+  8018c9:	89 c2                	mov    %eax,%edx
+  8018cb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ce:	c1 e0 10             	shl    $0x10,%eax
+  8018d1:	09 c2                	or     %eax,%edx
+  8018d3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018d6:	c1 e0 08             	shl    $0x8,%eax
+  8018d9:	09 d0                	or     %edx,%eax
+  8018db:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8018de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018e2:	48 c1 e8 02          	shr    $0x2,%rax
+  8018e6:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8018e9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018ed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018f0:	48 89 d7             	mov    %rdx,%rdi
+  8018f3:	fc                   	cld
+  8018f4:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8018f6:	eb 11                	jmp    801909 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8018f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018fc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8018ff:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801903:	48 89 d7             	mov    %rdx,%rdi
+  801906:	fc                   	cld
+  801907:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801909:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80190d:	c9                   	leave
+  80190e:	c3                   	ret
+
+000000000080190f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80190f:	55                   	push   %rbp
+  801910:	48 89 e5             	mov    %rsp,%rbp
+  801913:	48 83 ec 28          	sub    $0x28,%rsp
+  801917:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801917 <memmove+0x8>
+  80191e:	49 bb 29 77 00 00 00 	movabs $0x7729,%r11
+  801925:	00 00 00 
+  801928:	4c 01 d8             	add    %r11,%rax
+  80192b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80192f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801933:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801937:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80193b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  80193f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801943:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801947:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80194b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80194f:	0f 83 88 00 00 00    	jae    8019dd <memmove+0xce>
+  801955:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801959:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80195d:	48 01 d0             	add    %rdx,%rax
+  801960:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801964:	73 77                	jae    8019dd <memmove+0xce>
+		s += n;
+  801966:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80196a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  80196e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801972:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801976:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80197a:	83 e0 03             	and    $0x3,%eax
+  80197d:	48 85 c0             	test   %rax,%rax
+  801980:	75 3b                	jne    8019bd <memmove+0xae>
+  801982:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801986:	83 e0 03             	and    $0x3,%eax
+  801989:	48 85 c0             	test   %rax,%rax
+  80198c:	75 2f                	jne    8019bd <memmove+0xae>
+  80198e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801992:	83 e0 03             	and    $0x3,%eax
+  801995:	48 85 c0             	test   %rax,%rax
+  801998:	75 23                	jne    8019bd <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80199a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80199e:	48 83 e8 04          	sub    $0x4,%rax
+  8019a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019a6:	48 83 ea 04          	sub    $0x4,%rdx
+  8019aa:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8019ae:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  8019b2:	48 89 c7             	mov    %rax,%rdi
+  8019b5:	48 89 d6             	mov    %rdx,%rsi
+  8019b8:	fd                   	std
+  8019b9:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  8019bb:	eb 1d                	jmp    8019da <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8019bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019c9:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  8019cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019d1:	48 89 d7             	mov    %rdx,%rdi
+  8019d4:	48 89 c1             	mov    %rax,%rcx
+  8019d7:	fd                   	std
+  8019d8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8019da:	fc                   	cld
+  8019db:	eb 57                	jmp    801a34 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8019dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019e1:	83 e0 03             	and    $0x3,%eax
+  8019e4:	48 85 c0             	test   %rax,%rax
+  8019e7:	75 36                	jne    801a1f <memmove+0x110>
+  8019e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ed:	83 e0 03             	and    $0x3,%eax
+  8019f0:	48 85 c0             	test   %rax,%rax
+  8019f3:	75 2a                	jne    801a1f <memmove+0x110>
+  8019f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f9:	83 e0 03             	and    $0x3,%eax
+  8019fc:	48 85 c0             	test   %rax,%rax
+  8019ff:	75 1e                	jne    801a1f <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801a01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a05:	48 c1 e8 02          	shr    $0x2,%rax
+  801a09:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801a0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a10:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a14:	48 89 c7             	mov    %rax,%rdi
+  801a17:	48 89 d6             	mov    %rdx,%rsi
+  801a1a:	fc                   	cld
+  801a1b:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a1d:	eb 15                	jmp    801a34 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801a1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a23:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a27:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a2b:	48 89 c7             	mov    %rax,%rdi
+  801a2e:	48 89 d6             	mov    %rdx,%rsi
+  801a31:	fc                   	cld
+  801a32:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801a34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801a38:	c9                   	leave
+  801a39:	c3                   	ret
+
+0000000000801a3a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801a3a:	55                   	push   %rbp
+  801a3b:	48 89 e5             	mov    %rsp,%rbp
+  801a3e:	48 83 ec 18          	sub    $0x18,%rsp
+  801a42:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a42 <memcpy+0x8>
+  801a49:	49 bb fe 75 00 00 00 	movabs $0x75fe,%r11
+  801a50:	00 00 00 
+  801a53:	4c 01 d8             	add    %r11,%rax
+  801a56:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a5a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a5e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801a62:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a66:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801a6a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a6e:	48 89 cf             	mov    %rcx,%rdi
+  801a71:	48 b9 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rcx
+  801a78:	ff ff ff 
+  801a7b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801a7f:	ff d0                	call   *%rax
+}
+  801a81:	c9                   	leave
+  801a82:	c3                   	ret
+
+0000000000801a83 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801a83:	55                   	push   %rbp
+  801a84:	48 89 e5             	mov    %rsp,%rbp
+  801a87:	48 83 ec 28          	sub    $0x28,%rsp
+  801a8b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801a8b <memcmp+0x8>
+  801a92:	49 bb b5 75 00 00 00 	movabs $0x75b5,%r11
+  801a99:	00 00 00 
+  801a9c:	4c 01 d8             	add    %r11,%rax
+  801a9f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801aa3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801aa7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801aab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801aaf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801ab3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ab7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801abb:	eb 34                	jmp    801af1 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801abd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac1:	0f b6 10             	movzbl (%rax),%edx
+  801ac4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ac8:	0f b6 00             	movzbl (%rax),%eax
+  801acb:	38 c2                	cmp    %al,%dl
+  801acd:	74 18                	je     801ae7 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801acf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ad3:	0f b6 00             	movzbl (%rax),%eax
+  801ad6:	0f b6 d0             	movzbl %al,%edx
+  801ad9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801add:	0f b6 00             	movzbl (%rax),%eax
+  801ae0:	0f b6 c0             	movzbl %al,%eax
+  801ae3:	29 c2                	sub    %eax,%edx
+  801ae5:	eb 20                	jmp    801b07 <memcmp+0x84>
+		s1++, s2++;
+  801ae7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801aec:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801af1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801af5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801af9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801afd:	48 85 c0             	test   %rax,%rax
+  801b00:	75 bb                	jne    801abd <memcmp+0x3a>
+	}
+
+	return 0;
+  801b02:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801b07:	89 d0                	mov    %edx,%eax
+  801b09:	c9                   	leave
+  801b0a:	c3                   	ret
+
+0000000000801b0b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801b0b:	55                   	push   %rbp
+  801b0c:	48 89 e5             	mov    %rsp,%rbp
+  801b0f:	48 83 ec 28          	sub    $0x28,%rsp
+  801b13:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b13 <memfind+0x8>
+  801b1a:	49 bb 2d 75 00 00 00 	movabs $0x752d,%r11
+  801b21:	00 00 00 
+  801b24:	4c 01 d8             	add    %r11,%rax
+  801b27:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b2b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801b2e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801b32:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b3a:	48 01 d0             	add    %rdx,%rax
+  801b3d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801b41:	eb 13                	jmp    801b56 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b47:	0f b6 00             	movzbl (%rax),%eax
+  801b4a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801b4d:	38 d0                	cmp    %dl,%al
+  801b4f:	74 11                	je     801b62 <memfind+0x57>
+	for (; s < ends; s++)
+  801b51:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801b56:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b5a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801b5e:	72 e3                	jb     801b43 <memfind+0x38>
+  801b60:	eb 01                	jmp    801b63 <memfind+0x58>
+			break;
+  801b62:	90                   	nop
+	return (void *) s;
+  801b63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b67:	c9                   	leave
+  801b68:	c3                   	ret
+
+0000000000801b69 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801b69:	55                   	push   %rbp
+  801b6a:	48 89 e5             	mov    %rsp,%rbp
+  801b6d:	48 83 ec 38          	sub    $0x38,%rsp
+  801b71:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b71 <strtol+0x8>
+  801b78:	49 bb cf 74 00 00 00 	movabs $0x74cf,%r11
+  801b7f:	00 00 00 
+  801b82:	4c 01 d8             	add    %r11,%rax
+  801b85:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b89:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b8d:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801b90:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801b97:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801b9e:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801b9f:	eb 05                	jmp    801ba6 <strtol+0x3d>
+		s++;
+  801ba1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801ba6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801baa:	0f b6 00             	movzbl (%rax),%eax
+  801bad:	3c 20                	cmp    $0x20,%al
+  801baf:	74 f0                	je     801ba1 <strtol+0x38>
+  801bb1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb5:	0f b6 00             	movzbl (%rax),%eax
+  801bb8:	3c 09                	cmp    $0x9,%al
+  801bba:	74 e5                	je     801ba1 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801bbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc0:	0f b6 00             	movzbl (%rax),%eax
+  801bc3:	3c 2b                	cmp    $0x2b,%al
+  801bc5:	75 07                	jne    801bce <strtol+0x65>
+		s++;
+  801bc7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bcc:	eb 17                	jmp    801be5 <strtol+0x7c>
+	else if (*s == '-')
+  801bce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd2:	0f b6 00             	movzbl (%rax),%eax
+  801bd5:	3c 2d                	cmp    $0x2d,%al
+  801bd7:	75 0c                	jne    801be5 <strtol+0x7c>
+		s++, neg = 1;
+  801bd9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801bde:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801be5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801be9:	74 06                	je     801bf1 <strtol+0x88>
+  801beb:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801bef:	75 28                	jne    801c19 <strtol+0xb0>
+  801bf1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bf5:	0f b6 00             	movzbl (%rax),%eax
+  801bf8:	3c 30                	cmp    $0x30,%al
+  801bfa:	75 1d                	jne    801c19 <strtol+0xb0>
+  801bfc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c00:	48 83 c0 01          	add    $0x1,%rax
+  801c04:	0f b6 00             	movzbl (%rax),%eax
+  801c07:	3c 78                	cmp    $0x78,%al
+  801c09:	75 0e                	jne    801c19 <strtol+0xb0>
+		s += 2, base = 16;
+  801c0b:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801c10:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801c17:	eb 2c                	jmp    801c45 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801c19:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c1d:	75 19                	jne    801c38 <strtol+0xcf>
+  801c1f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c23:	0f b6 00             	movzbl (%rax),%eax
+  801c26:	3c 30                	cmp    $0x30,%al
+  801c28:	75 0e                	jne    801c38 <strtol+0xcf>
+		s++, base = 8;
+  801c2a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c2f:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801c36:	eb 0d                	jmp    801c45 <strtol+0xdc>
+	else if (base == 0)
+  801c38:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c3c:	75 07                	jne    801c45 <strtol+0xdc>
+		base = 10;
+  801c3e:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801c45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c49:	0f b6 00             	movzbl (%rax),%eax
+  801c4c:	3c 2f                	cmp    $0x2f,%al
+  801c4e:	7e 1d                	jle    801c6d <strtol+0x104>
+  801c50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c54:	0f b6 00             	movzbl (%rax),%eax
+  801c57:	3c 39                	cmp    $0x39,%al
+  801c59:	7f 12                	jg     801c6d <strtol+0x104>
+			dig = *s - '0';
+  801c5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c5f:	0f b6 00             	movzbl (%rax),%eax
+  801c62:	0f be c0             	movsbl %al,%eax
+  801c65:	83 e8 30             	sub    $0x30,%eax
+  801c68:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c6b:	eb 4e                	jmp    801cbb <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801c6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c71:	0f b6 00             	movzbl (%rax),%eax
+  801c74:	3c 60                	cmp    $0x60,%al
+  801c76:	7e 1d                	jle    801c95 <strtol+0x12c>
+  801c78:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c7c:	0f b6 00             	movzbl (%rax),%eax
+  801c7f:	3c 7a                	cmp    $0x7a,%al
+  801c81:	7f 12                	jg     801c95 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801c83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c87:	0f b6 00             	movzbl (%rax),%eax
+  801c8a:	0f be c0             	movsbl %al,%eax
+  801c8d:	83 e8 57             	sub    $0x57,%eax
+  801c90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801c93:	eb 26                	jmp    801cbb <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801c95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c99:	0f b6 00             	movzbl (%rax),%eax
+  801c9c:	3c 40                	cmp    $0x40,%al
+  801c9e:	7e 47                	jle    801ce7 <strtol+0x17e>
+  801ca0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca4:	0f b6 00             	movzbl (%rax),%eax
+  801ca7:	3c 5a                	cmp    $0x5a,%al
+  801ca9:	7f 3c                	jg     801ce7 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801cab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801caf:	0f b6 00             	movzbl (%rax),%eax
+  801cb2:	0f be c0             	movsbl %al,%eax
+  801cb5:	83 e8 37             	sub    $0x37,%eax
+  801cb8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801cbb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cbe:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801cc1:	7d 23                	jge    801ce6 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801cc3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cc8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801ccb:	48 98                	cltq
+  801ccd:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801cd2:	48 89 c2             	mov    %rax,%rdx
+  801cd5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801cd8:	48 98                	cltq
+  801cda:	48 01 d0             	add    %rdx,%rax
+  801cdd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801ce1:	e9 5f ff ff ff       	jmp    801c45 <strtol+0xdc>
+			break;
+  801ce6:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801ce7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801cec:	74 0b                	je     801cf9 <strtol+0x190>
+		*endptr = (char *) s;
+  801cee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cf2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801cf6:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801cf9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801cfd:	74 09                	je     801d08 <strtol+0x19f>
+  801cff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d03:	48 f7 d8             	neg    %rax
+  801d06:	eb 04                	jmp    801d0c <strtol+0x1a3>
+  801d08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801d0c:	c9                   	leave
+  801d0d:	c3                   	ret
+
+0000000000801d0e <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801d0e:	55                   	push   %rbp
+  801d0f:	48 89 e5             	mov    %rsp,%rbp
+  801d12:	53                   	push   %rbx
+  801d13:	48 83 ec 30          	sub    $0x30,%rsp
+  801d17:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801d17 <strstr+0x9>
+  801d1e:	49 bb 29 73 00 00 00 	movabs $0x7329,%r11
+  801d25:	00 00 00 
+  801d28:	4c 01 db             	add    %r11,%rbx
+  801d2b:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801d2f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801d33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d37:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d3b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d3f:	0f b6 00             	movzbl (%rax),%eax
+  801d42:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801d45:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801d49:	75 06                	jne    801d51 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801d4b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d4f:	eb 73                	jmp    801dc4 <strstr+0xb6>
+
+	len = strlen(str);
+  801d51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d55:	48 89 c7             	mov    %rax,%rdi
+  801d58:	48 b8 5b 84 ff ff ff 	movabs $0xffffffffffff845b,%rax
+  801d5f:	ff ff ff 
+  801d62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801d66:	ff d0                	call   *%rax
+  801d68:	48 98                	cltq
+  801d6a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801d6e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d72:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d76:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801d7a:	0f b6 00             	movzbl (%rax),%eax
+  801d7d:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801d80:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801d84:	75 07                	jne    801d8d <strstr+0x7f>
+				return (char *) 0;
+  801d86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8b:	eb 37                	jmp    801dc4 <strstr+0xb6>
+		} while (sc != c);
+  801d8d:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801d91:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801d94:	75 d8                	jne    801d6e <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801d96:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d9a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da2:	48 89 ce             	mov    %rcx,%rsi
+  801da5:	48 89 c7             	mov    %rax,%rdi
+  801da8:	48 b8 0f 87 ff ff ff 	movabs $0xffffffffffff870f,%rax
+  801daf:	ff ff ff 
+  801db2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801db6:	ff d0                	call   *%rax
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	75 b2                	jne    801d6e <strstr+0x60>
+
+	return (char *) (in - 1);
+  801dbc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc0:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801dc4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801dc8:	c9                   	leave
+  801dc9:	c3                   	ret
+
+0000000000801dca <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801dca:	55                   	push   %rbp
+  801dcb:	48 89 e5             	mov    %rsp,%rbp
+  801dce:	41 57                	push   %r15
+  801dd0:	53                   	push   %rbx
+  801dd1:	48 83 ec 40          	sub    $0x40,%rsp
+  801dd5:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801dd5 <syscall+0xb>
+  801ddc:	49 bb 6b 72 00 00 00 	movabs $0x726b,%r11
+  801de3:	00 00 00 
+  801de6:	4d 01 da             	add    %r11,%r10
+  801de9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801dec:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801def:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801df3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801df7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801dfb:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801dff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e02:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801e06:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e0a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801e0e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801e12:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e16:	4c 89 c3             	mov    %r8,%rbx
+  801e19:	cd 30                	int    $0x30
+  801e1b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801e1f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801e23:	74 52                	je     801e77 <syscall+0xad>
+  801e25:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e2a:	7e 4b                	jle    801e77 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801e2c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e30:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e33:	49 89 d0             	mov    %rdx,%r8
+  801e36:	89 c1                	mov    %eax,%ecx
+  801e38:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  801e3f:	ff ff ff 
+  801e42:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e46:	48 89 c2             	mov    %rax,%rdx
+  801e49:	be 23 00 00 00       	mov    $0x23,%esi
+  801e4e:	48 b8 fd e3 ff ff ff 	movabs $0xffffffffffffe3fd,%rax
+  801e55:	ff ff ff 
+  801e58:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801e5c:	48 89 c7             	mov    %rax,%rdi
+  801e5f:	4d 89 d7             	mov    %r10,%r15
+  801e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e67:	49 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r9
+  801e6e:	ff ff ff 
+  801e71:	4d 01 d1             	add    %r10,%r9
+  801e74:	41 ff d1             	call   *%r9
+
+	return ret;
+  801e77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e7b:	48 83 c4 40          	add    $0x40,%rsp
+  801e7f:	5b                   	pop    %rbx
+  801e80:	41 5f                	pop    %r15
+  801e82:	5d                   	pop    %rbp
+  801e83:	c3                   	ret
+
+0000000000801e84 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801e84:	55                   	push   %rbp
+  801e85:	48 89 e5             	mov    %rsp,%rbp
+  801e88:	41 57                	push   %r15
+  801e8a:	41 56                	push   %r14
+  801e8c:	41 55                	push   %r13
+  801e8e:	41 54                	push   %r12
+  801e90:	53                   	push   %rbx
+  801e91:	48 83 ec 48          	sub    $0x48,%rsp
+  801e95:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801e95 <syscall_words+0x11>
+  801e9c:	49 bb ab 71 00 00 00 	movabs $0x71ab,%r11
+  801ea3:	00 00 00 
+  801ea6:	4d 01 de             	add    %r11,%r14
+  801ea9:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801eac:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801eaf:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801eb3:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801eb7:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801ebb:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801ebf:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ec4:	74 09                	je     801ecf <syscall_words+0x4b>
+  801ec6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801eca:	48 8b 00             	mov    (%rax),%rax
+  801ecd:	eb 05                	jmp    801ed4 <syscall_words+0x50>
+  801ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed4:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801ed7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801edc:	74 0a                	je     801ee8 <syscall_words+0x64>
+  801ede:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ee2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801ee6:	eb 05                	jmp    801eed <syscall_words+0x69>
+  801ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eed:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801ef0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ef5:	74 0a                	je     801f01 <syscall_words+0x7d>
+  801ef7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801efb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801eff:	eb 05                	jmp    801f06 <syscall_words+0x82>
+  801f01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f06:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801f09:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f0e:	74 0a                	je     801f1a <syscall_words+0x96>
+  801f10:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f14:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f18:	eb 05                	jmp    801f1f <syscall_words+0x9b>
+  801f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1f:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801f22:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f27:	74 0a                	je     801f33 <syscall_words+0xaf>
+  801f29:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f2d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f31:	eb 05                	jmp    801f38 <syscall_words+0xb4>
+  801f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f38:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801f3b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f40:	74 0a                	je     801f4c <syscall_words+0xc8>
+  801f42:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f46:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801f4a:	eb 05                	jmp    801f51 <syscall_words+0xcd>
+  801f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f51:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801f54:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801f57:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801f5b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f5f:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801f63:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801f67:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801f6b:	cd 30                	int    $0x30
+  801f6d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801f71:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f76:	74 50                	je     801fc8 <syscall_words+0x144>
+		words[0] = r8;
+  801f78:	4c 89 c2             	mov    %r8,%rdx
+  801f7b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f7f:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  801f82:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f86:	48 83 c0 08          	add    $0x8,%rax
+  801f8a:	4c 89 ca             	mov    %r9,%rdx
+  801f8d:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  801f90:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f94:	48 83 c0 10          	add    $0x10,%rax
+  801f98:	4c 89 d2             	mov    %r10,%rdx
+  801f9b:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  801f9e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fa2:	48 83 c0 18          	add    $0x18,%rax
+  801fa6:	4c 89 da             	mov    %r11,%rdx
+  801fa9:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  801fac:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fb0:	48 83 c0 20          	add    $0x20,%rax
+  801fb4:	4c 89 e2             	mov    %r12,%rdx
+  801fb7:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  801fba:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fbe:	48 83 c0 28          	add    $0x28,%rax
+  801fc2:	4c 89 ea             	mov    %r13,%rdx
+  801fc5:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  801fc8:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  801fcc:	74 52                	je     802020 <syscall_words+0x19c>
+  801fce:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801fd3:	7e 4b                	jle    802020 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801fd5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801fd9:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801fdc:	49 89 d0             	mov    %rdx,%r8
+  801fdf:	89 c1                	mov    %eax,%ecx
+  801fe1:	48 b8 e0 e3 ff ff ff 	movabs $0xffffffffffffe3e0,%rax
+  801fe8:	ff ff ff 
+  801feb:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  801fef:	48 89 c2             	mov    %rax,%rdx
+  801ff2:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801ff7:	48 b8 fd e3 ff ff ff 	movabs $0xffffffffffffe3fd,%rax
+  801ffe:	ff ff ff 
+  802001:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802005:	48 89 c7             	mov    %rax,%rdi
+  802008:	4d 89 f7             	mov    %r14,%r15
+  80200b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802010:	49 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r9
+  802017:	ff ff ff 
+  80201a:	4d 01 f1             	add    %r14,%r9
+  80201d:	41 ff d1             	call   *%r9
+
+	return ret;
+  802020:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802024:	48 83 c4 48          	add    $0x48,%rsp
+  802028:	5b                   	pop    %rbx
+  802029:	41 5c                	pop    %r12
+  80202b:	41 5d                	pop    %r13
+  80202d:	41 5e                	pop    %r14
+  80202f:	41 5f                	pop    %r15
+  802031:	5d                   	pop    %rbp
+  802032:	c3                   	ret
+
+0000000000802033 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802033:	55                   	push   %rbp
+  802034:	48 89 e5             	mov    %rsp,%rbp
+  802037:	48 83 ec 10          	sub    $0x10,%rsp
+  80203b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80203b <sys_cputs+0x8>
+  802042:	49 bb 05 70 00 00 00 	movabs $0x7005,%r11
+  802049:	00 00 00 
+  80204c:	4c 01 d8             	add    %r11,%rax
+  80204f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802053:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802057:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80205b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80205f:	48 83 ec 08          	sub    $0x8,%rsp
+  802063:	6a 00                	push   $0x0
+  802065:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80206b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802071:	be 00 00 00 00       	mov    $0x0,%esi
+  802076:	bf 00 00 00 00       	mov    $0x0,%edi
+  80207b:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802082:	ff ff ff 
+  802085:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802089:	ff d0                	call   *%rax
+  80208b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80208f:	90                   	nop
+  802090:	c9                   	leave
+  802091:	c3                   	ret
+
+0000000000802092 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802092:	55                   	push   %rbp
+  802093:	48 89 e5             	mov    %rsp,%rbp
+  802096:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802096 <sys_cgetc+0x4>
+  80209d:	49 bb aa 6f 00 00 00 	movabs $0x6faa,%r11
+  8020a4:	00 00 00 
+  8020a7:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8020aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ae:	6a 00                	push   $0x0
+  8020b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8020cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8020d0:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  8020d7:	ff ff ff 
+  8020da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8020de:	ff d0                	call   *%rax
+  8020e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8020e4:	c9                   	leave
+  8020e5:	c3                   	ret
+
+00000000008020e6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8020e6:	55                   	push   %rbp
+  8020e7:	48 89 e5             	mov    %rsp,%rbp
+  8020ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020ee <sys_env_destroy+0x8>
+  8020f5:	49 bb 52 6f 00 00 00 	movabs $0x6f52,%r11
+  8020fc:	00 00 00 
+  8020ff:	4c 01 d8             	add    %r11,%rax
+  802102:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802105:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802108:	48 63 d2             	movslq %edx,%rdx
+  80210b:	48 83 ec 08          	sub    $0x8,%rsp
+  80210f:	6a 00                	push   $0x0
+  802111:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802117:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80211d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802122:	be 01 00 00 00       	mov    $0x1,%esi
+  802127:	bf 03 00 00 00       	mov    $0x3,%edi
+  80212c:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802133:	ff ff ff 
+  802136:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80213a:	ff d0                	call   *%rax
+  80213c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802140:	c9                   	leave
+  802141:	c3                   	ret
+
+0000000000802142 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802142:	55                   	push   %rbp
+  802143:	48 89 e5             	mov    %rsp,%rbp
+  802146:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802146 <sys_getenvid+0x4>
+  80214d:	49 bb fa 6e 00 00 00 	movabs $0x6efa,%r11
+  802154:	00 00 00 
+  802157:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80215a:	48 83 ec 08          	sub    $0x8,%rsp
+  80215e:	6a 00                	push   $0x0
+  802160:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802166:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80216c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802171:	ba 00 00 00 00       	mov    $0x0,%edx
+  802176:	be 00 00 00 00       	mov    $0x0,%esi
+  80217b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802180:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802187:	ff ff ff 
+  80218a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80218e:	ff d0                	call   *%rax
+  802190:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802194:	c9                   	leave
+  802195:	c3                   	ret
+
+0000000000802196 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802196:	55                   	push   %rbp
+  802197:	48 89 e5             	mov    %rsp,%rbp
+  80219a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80219a <sys_yield+0x4>
+  8021a1:	49 bb a6 6e 00 00 00 	movabs $0x6ea6,%r11
+  8021a8:	00 00 00 
+  8021ab:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8021ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8021b2:	6a 00                	push   $0x0
+  8021b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cf:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021d4:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  8021db:	ff ff ff 
+  8021de:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021e2:	ff d0                	call   *%rax
+  8021e4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021e8:	90                   	nop
+  8021e9:	c9                   	leave
+  8021ea:	c3                   	ret
+
+00000000008021eb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8021eb:	55                   	push   %rbp
+  8021ec:	48 89 e5             	mov    %rsp,%rbp
+  8021ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021f3 <sys_page_alloc+0x8>
+  8021fa:	49 bb 4d 6e 00 00 00 	movabs $0x6e4d,%r11
+  802201:	00 00 00 
+  802204:	4c 01 d8             	add    %r11,%rax
+  802207:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80220a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80220e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802211:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802214:	48 63 f2             	movslq %edx,%rsi
+  802217:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80221b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80221e:	48 63 d2             	movslq %edx,%rdx
+  802221:	48 83 ec 08          	sub    $0x8,%rsp
+  802225:	6a 00                	push   $0x0
+  802227:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80222d:	49 89 f0             	mov    %rsi,%r8
+  802230:	be 01 00 00 00       	mov    $0x1,%esi
+  802235:	bf 04 00 00 00       	mov    $0x4,%edi
+  80223a:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802241:	ff ff ff 
+  802244:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802248:	ff d0                	call   *%rax
+  80224a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80224e:	c9                   	leave
+  80224f:	c3                   	ret
+
+0000000000802250 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+  802254:	48 83 ec 20          	sub    $0x20,%rsp
+  802258:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802258 <sys_page_map+0x8>
+  80225f:	49 bb e8 6d 00 00 00 	movabs $0x6de8,%r11
+  802266:	00 00 00 
+  802269:	4c 01 d8             	add    %r11,%rax
+  80226c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80226f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802273:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802276:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80227a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80227e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802281:	48 63 f2             	movslq %edx,%rsi
+  802284:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802288:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80228b:	48 63 fa             	movslq %edx,%rdi
+  80228e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802292:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802295:	48 63 d2             	movslq %edx,%rdx
+  802298:	48 83 ec 08          	sub    $0x8,%rsp
+  80229c:	56                   	push   %rsi
+  80229d:	4d 89 c1             	mov    %r8,%r9
+  8022a0:	49 89 f8             	mov    %rdi,%r8
+  8022a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8022a8:	bf 05 00 00 00       	mov    $0x5,%edi
+  8022ad:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  8022b4:	ff ff ff 
+  8022b7:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022bb:	ff d0                	call   *%rax
+  8022bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c1:	c9                   	leave
+  8022c2:	c3                   	ret
+
+00000000008022c3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8022c3:	55                   	push   %rbp
+  8022c4:	48 89 e5             	mov    %rsp,%rbp
+  8022c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8022cb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022cb <sys_page_unmap+0x8>
+  8022d2:	49 bb 75 6d 00 00 00 	movabs $0x6d75,%r11
+  8022d9:	00 00 00 
+  8022dc:	4c 01 d8             	add    %r11,%rax
+  8022df:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8022e6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022ea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022ed:	48 63 d2             	movslq %edx,%rdx
+  8022f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8022f4:	6a 00                	push   $0x0
+  8022f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802302:	be 01 00 00 00       	mov    $0x1,%esi
+  802307:	bf 06 00 00 00       	mov    $0x6,%edi
+  80230c:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802313:	ff ff ff 
+  802316:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80231a:	ff d0                	call   *%rax
+  80231c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802320:	c9                   	leave
+  802321:	c3                   	ret
+
+0000000000802322 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802322:	55                   	push   %rbp
+  802323:	48 89 e5             	mov    %rsp,%rbp
+  802326:	48 83 ec 10          	sub    $0x10,%rsp
+  80232a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80232a <sys_env_set_status+0x8>
+  802331:	49 bb 16 6d 00 00 00 	movabs $0x6d16,%r11
+  802338:	00 00 00 
+  80233b:	4c 01 d8             	add    %r11,%rax
+  80233e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802341:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802344:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802347:	48 63 ca             	movslq %edx,%rcx
+  80234a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80234d:	48 63 d2             	movslq %edx,%rdx
+  802350:	48 83 ec 08          	sub    $0x8,%rsp
+  802354:	6a 00                	push   $0x0
+  802356:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80235c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802362:	be 01 00 00 00       	mov    $0x1,%esi
+  802367:	bf 08 00 00 00       	mov    $0x8,%edi
+  80236c:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802373:	ff ff ff 
+  802376:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80237a:	ff d0                	call   *%rax
+  80237c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802380:	c9                   	leave
+  802381:	c3                   	ret
+
+0000000000802382 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802382:	55                   	push   %rbp
+  802383:	48 89 e5             	mov    %rsp,%rbp
+  802386:	48 83 ec 10          	sub    $0x10,%rsp
+  80238a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80238a <sys_env_set_trapframe+0x8>
+  802391:	49 bb b6 6c 00 00 00 	movabs $0x6cb6,%r11
+  802398:	00 00 00 
+  80239b:	4c 01 d8             	add    %r11,%rax
+  80239e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023a1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  8023a5:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023a9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023ac:	48 63 d2             	movslq %edx,%rdx
+  8023af:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b3:	6a 00                	push   $0x0
+  8023b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8023c6:	bf 09 00 00 00       	mov    $0x9,%edi
+  8023cb:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  8023d2:	ff ff ff 
+  8023d5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023d9:	ff d0                	call   *%rax
+  8023db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023df:	c9                   	leave
+  8023e0:	c3                   	ret
+
+00000000008023e1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8023e1:	55                   	push   %rbp
+  8023e2:	48 89 e5             	mov    %rsp,%rbp
+  8023e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023e9 <sys_env_set_pgfault_upcall+0x8>
+  8023f0:	49 bb 57 6c 00 00 00 	movabs $0x6c57,%r11
+  8023f7:	00 00 00 
+  8023fa:	4c 01 d8             	add    %r11,%rax
+  8023fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802400:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802404:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802408:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80240b:	48 63 d2             	movslq %edx,%rdx
+  80240e:	48 83 ec 08          	sub    $0x8,%rsp
+  802412:	6a 00                	push   $0x0
+  802414:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80241a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802420:	be 01 00 00 00       	mov    $0x1,%esi
+  802425:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80242a:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802431:	ff ff ff 
+  802434:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802438:	ff d0                	call   *%rax
+  80243a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80243e:	c9                   	leave
+  80243f:	c3                   	ret
+
+0000000000802440 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802440:	55                   	push   %rbp
+  802441:	48 89 e5             	mov    %rsp,%rbp
+  802444:	48 83 ec 20          	sub    $0x20,%rsp
+  802448:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802448 <sys_ipc_try_send+0x8>
+  80244f:	49 bb f8 6b 00 00 00 	movabs $0x6bf8,%r11
+  802456:	00 00 00 
+  802459:	4c 01 d8             	add    %r11,%rax
+  80245c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80245f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802463:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802467:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80246a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80246d:	48 63 fa             	movslq %edx,%rdi
+  802470:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802474:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802477:	48 63 d2             	movslq %edx,%rdx
+  80247a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80247e:	48 83 ec 08          	sub    $0x8,%rsp
+  802482:	6a 00                	push   $0x0
+  802484:	49 89 f9             	mov    %rdi,%r9
+  802487:	49 89 f0             	mov    %rsi,%r8
+  80248a:	be 00 00 00 00       	mov    $0x0,%esi
+  80248f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802494:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  80249b:	ff ff ff 
+  80249e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024a2:	ff d0                	call   *%rax
+  8024a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024a8:	c9                   	leave
+  8024a9:	c3                   	ret
+
+00000000008024aa <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8024aa:	55                   	push   %rbp
+  8024ab:	48 89 e5             	mov    %rsp,%rbp
+  8024ae:	48 83 ec 20          	sub    $0x20,%rsp
+  8024b2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024b2 <sys_ipc_send+0x8>
+  8024b9:	49 bb 8e 6b 00 00 00 	movabs $0x6b8e,%r11
+  8024c0:	00 00 00 
+  8024c3:	4c 01 d8             	add    %r11,%rax
+  8024c6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024c9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024cd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024d1:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8024d4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024d7:	48 63 fa             	movslq %edx,%rdi
+  8024da:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024de:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024e1:	48 63 d2             	movslq %edx,%rdx
+  8024e4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ec:	6a 00                	push   $0x0
+  8024ee:	49 89 f9             	mov    %rdi,%r9
+  8024f1:	49 89 f0             	mov    %rsi,%r8
+  8024f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8024f9:	bf 17 00 00 00       	mov    $0x17,%edi
+  8024fe:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802505:	ff ff ff 
+  802508:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80250c:	ff d0                	call   *%rax
+  80250e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802512:	c9                   	leave
+  802513:	c3                   	ret
+
+0000000000802514 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802514:	55                   	push   %rbp
+  802515:	48 89 e5             	mov    %rsp,%rbp
+  802518:	48 83 ec 10          	sub    $0x10,%rsp
+  80251c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80251c <sys_ipc_recv+0x8>
+  802523:	49 bb 24 6b 00 00 00 	movabs $0x6b24,%r11
+  80252a:	00 00 00 
+  80252d:	4c 01 d8             	add    %r11,%rax
+  802530:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802534:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802538:	6a 00                	push   $0x0
+  80253a:	6a 00                	push   $0x0
+  80253c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802542:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802548:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80254d:	be 01 00 00 00       	mov    $0x1,%esi
+  802552:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802557:	49 ba 44 8e ff ff ff 	movabs $0xffffffffffff8e44,%r10
+  80255e:	ff ff ff 
+  802561:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802565:	ff d0                	call   *%rax
+  802567:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80256b:	c9                   	leave
+  80256c:	c3                   	ret
+
+000000000080256d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  80256d:	55                   	push   %rbp
+  80256e:	48 89 e5             	mov    %rsp,%rbp
+  802571:	48 83 ec 30          	sub    $0x30,%rsp
+  802575:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802575 <sys_ipc_call+0x8>
+  80257c:	49 bb cb 6a 00 00 00 	movabs $0x6acb,%r11
+  802583:	00 00 00 
+  802586:	4c 01 d8             	add    %r11,%rax
+  802589:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80258c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802590:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802594:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802597:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80259b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80259f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8025a3:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025a6:	4c 63 c2             	movslq %edx,%r8
+  8025a9:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8025ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025b0:	48 63 d2             	movslq %edx,%rdx
+  8025b3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025b7:	ff 75 d8             	push   -0x28(%rbp)
+  8025ba:	56                   	push   %rsi
+  8025bb:	4d 89 c1             	mov    %r8,%r9
+  8025be:	49 89 f8             	mov    %rdi,%r8
+  8025c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8025c6:	bf 18 00 00 00       	mov    $0x18,%edi
+  8025cb:	49 ba 44 8e ff ff ff 	movabs $0xffffffffffff8e44,%r10
+  8025d2:	ff ff ff 
+  8025d5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025d9:	ff d0                	call   *%rax
+  8025db:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8025df:	c9                   	leave
+  8025e0:	c3                   	ret
+
+00000000008025e1 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8025e1:	55                   	push   %rbp
+  8025e2:	48 89 e5             	mov    %rsp,%rbp
+  8025e5:	48 83 ec 30          	sub    $0x30,%rsp
+  8025e9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025e9 <sys_ipc_reply_recv+0x8>
+  8025f0:	49 bb 57 6a 00 00 00 	movabs $0x6a57,%r11
+  8025f7:	00 00 00 
+  8025fa:	4c 01 d8             	add    %r11,%rax
+  8025fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802600:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802604:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802608:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80260b:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80260f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802613:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802617:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80261a:	4c 63 c2             	movslq %edx,%r8
+  80261d:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802621:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802624:	48 63 d2             	movslq %edx,%rdx
+  802627:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80262b:	ff 75 d8             	push   -0x28(%rbp)
+  80262e:	56                   	push   %rsi
+  80262f:	4d 89 c1             	mov    %r8,%r9
+  802632:	49 89 f8             	mov    %rdi,%r8
+  802635:	be 00 00 00 00       	mov    $0x0,%esi
+  80263a:	bf 19 00 00 00       	mov    $0x19,%edi
+  80263f:	49 ba 44 8e ff ff ff 	movabs $0xffffffffffff8e44,%r10
+  802646:	ff ff ff 
+  802649:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80264d:	ff d0                	call   *%rax
+  80264f:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802653:	c9                   	leave
+  802654:	c3                   	ret
+
+0000000000802655 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802655:	55                   	push   %rbp
+  802656:	48 89 e5             	mov    %rsp,%rbp
+  802659:	48 83 ec 10          	sub    $0x10,%rsp
+  80265d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80265d <sys_env_set_priority+0x8>
+  802664:	49 bb e3 69 00 00 00 	movabs $0x69e3,%r11
+  80266b:	00 00 00 
+  80266e:	4c 01 d8             	add    %r11,%rax
+  802671:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802674:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802677:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80267a:	48 63 ca             	movslq %edx,%rcx
+  80267d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802680:	48 63 d2             	movslq %edx,%rdx
+  802683:	48 83 ec 08          	sub    $0x8,%rsp
+  802687:	6a 00                	push   $0x0
+  802689:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80268f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802695:	be 01 00 00 00       	mov    $0x1,%esi
+  80269a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80269f:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  8026a6:	ff ff ff 
+  8026a9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026ad:	ff d0                	call   *%rax
+  8026af:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b3:	c9                   	leave
+  8026b4:	c3                   	ret
+
+00000000008026b5 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  8026b5:	55                   	push   %rbp
+  8026b6:	48 89 e5             	mov    %rsp,%rbp
+  8026b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8026bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026bd <sys_env_set_affinity+0x8>
+  8026c4:	49 bb 83 69 00 00 00 	movabs $0x6983,%r11
+  8026cb:	00 00 00 
+  8026ce:	4c 01 d8             	add    %r11,%rax
+  8026d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026d4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8026d7:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8026da:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026dd:	48 63 d2             	movslq %edx,%rdx
+  8026e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e4:	6a 00                	push   $0x0
+  8026e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026f2:	be 01 00 00 00       	mov    $0x1,%esi
+  8026f7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8026fc:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802703:	ff ff ff 
+  802706:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80270a:	ff d0                	call   *%rax
+  80270c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802710:	c9                   	leave
+  802711:	c3                   	ret
+
+0000000000802712 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802712:	55                   	push   %rbp
+  802713:	48 89 e5             	mov    %rsp,%rbp
+  802716:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802716 <sys_time_msec+0x4>
+  80271d:	49 bb 2a 69 00 00 00 	movabs $0x692a,%r11
+  802724:	00 00 00 
+  802727:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80272a:	48 83 ec 08          	sub    $0x8,%rsp
+  80272e:	6a 00                	push   $0x0
+  802730:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802736:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80273c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802741:	ba 00 00 00 00       	mov    $0x0,%edx
+  802746:	be 00 00 00 00       	mov    $0x0,%esi
+  80274b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802750:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802757:	ff ff ff 
+  80275a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80275e:	ff d0                	call   *%rax
+  802760:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802764:	c9                   	leave
+  802765:	c3                   	ret
+
+0000000000802766 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802766:	55                   	push   %rbp
+  802767:	48 89 e5             	mov    %rsp,%rbp
+  80276a:	48 83 ec 10          	sub    $0x10,%rsp
+  80276e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80276e <sys_sleep_usec+0x8>
+  802775:	49 bb d2 68 00 00 00 	movabs $0x68d2,%r11
+  80277c:	00 00 00 
+  80277f:	4c 01 d8             	add    %r11,%rax
+  802782:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802786:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80278a:	48 83 ec 08          	sub    $0x8,%rsp
+  80278e:	6a 00                	push   $0x0
+  802790:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802796:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80279c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a6:	bf 11 00 00 00       	mov    $0x11,%edi
+  8027ab:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  8027b2:	ff ff ff 
+  8027b5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027b9:	ff d0                	call   *%rax
+  8027bb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027bf:	c9                   	leave
+  8027c0:	c3                   	ret
+
+00000000008027c1 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8027c1:	55                   	push   %rbp
+  8027c2:	48 89 e5             	mov    %rsp,%rbp
+  8027c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8027c9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027c9 <sys_page_alloc_huge+0x8>
+  8027d0:	49 bb 77 68 00 00 00 	movabs $0x6877,%r11
+  8027d7:	00 00 00 
+  8027da:	4c 01 d8             	add    %r11,%rax
+  8027dd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027e4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8027e7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8027ea:	48 63 f2             	movslq %edx,%rsi
+  8027ed:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027f1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027f4:	48 63 d2             	movslq %edx,%rdx
+  8027f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fb:	6a 00                	push   $0x0
+  8027fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802803:	49 89 f0             	mov    %rsi,%r8
+  802806:	be 01 00 00 00       	mov    $0x1,%esi
+  80280b:	bf 12 00 00 00       	mov    $0x12,%edi
+  802810:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802817:	ff ff ff 
+  80281a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80281e:	ff d0                	call   *%rax
+  802820:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802824:	c9                   	leave
+  802825:	c3                   	ret
+
+0000000000802826 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802826:	55                   	push   %rbp
+  802827:	48 89 e5             	mov    %rsp,%rbp
+  80282a:	48 83 ec 10          	sub    $0x10,%rsp
+  80282e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80282e <sys_page_map_batch+0x8>
+  802835:	49 bb 12 68 00 00 00 	movabs $0x6812,%r11
+  80283c:	00 00 00 
+  80283f:	4c 01 d8             	add    %r11,%rax
+  802842:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802846:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80284a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80284e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802852:	48 83 ec 08          	sub    $0x8,%rsp
+  802856:	6a 00                	push   $0x0
+  802858:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80285e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802864:	be 01 00 00 00       	mov    $0x1,%esi
+  802869:	bf 13 00 00 00       	mov    $0x13,%edi
+  80286e:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802875:	ff ff ff 
+  802878:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80287c:	ff d0                	call   *%rax
+  80287e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802882:	c9                   	leave
+  802883:	c3                   	ret
+
+0000000000802884 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802884:	55                   	push   %rbp
+  802885:	48 89 e5             	mov    %rsp,%rbp
+  802888:	48 83 ec 10          	sub    $0x10,%rsp
+  80288c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80288c <sys_page_alloc_batch+0x8>
+  802893:	49 bb b4 67 00 00 00 	movabs $0x67b4,%r11
+  80289a:	00 00 00 
+  80289d:	4c 01 d8             	add    %r11,%rax
+  8028a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8028a8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028ac:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b4:	6a 00                	push   $0x0
+  8028b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8028c7:	bf 14 00 00 00       	mov    $0x14,%edi
+  8028cc:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  8028d3:	ff ff ff 
+  8028d6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028da:	ff d0                	call   *%rax
+  8028dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028e0:	c9                   	leave
+  8028e1:	c3                   	ret
+
+00000000008028e2 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8028e2:	55                   	push   %rbp
+  8028e3:	48 89 e5             	mov    %rsp,%rbp
+  8028e6:	48 83 ec 10          	sub    $0x10,%rsp
+  8028ea:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028ea <sys_page_unmap_batch+0x8>
+  8028f1:	49 bb 56 67 00 00 00 	movabs $0x6756,%r11
+  8028f8:	00 00 00 
+  8028fb:	4c 01 d8             	add    %r11,%rax
+  8028fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802902:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802906:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80290a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80290e:	48 83 ec 08          	sub    $0x8,%rsp
+  802912:	6a 00                	push   $0x0
+  802914:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802920:	be 01 00 00 00       	mov    $0x1,%esi
+  802925:	bf 15 00 00 00       	mov    $0x15,%edi
+  80292a:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802931:	ff ff ff 
+  802934:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802938:	ff d0                	call   *%rax
+  80293a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80293e:	c9                   	leave
+  80293f:	c3                   	ret
+
+0000000000802940 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802940:	55                   	push   %rbp
+  802941:	48 89 e5             	mov    %rsp,%rbp
+  802944:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802944 <sys_fork+0x4>
+  80294b:	49 bb fc 66 00 00 00 	movabs $0x66fc,%r11
+  802952:	00 00 00 
+  802955:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802958:	48 83 ec 08          	sub    $0x8,%rsp
+  80295c:	6a 00                	push   $0x0
+  80295e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802964:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80296a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80296f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802974:	be 00 00 00 00       	mov    $0x0,%esi
+  802979:	bf 16 00 00 00       	mov    $0x16,%edi
+  80297e:	49 ba 8a 8d ff ff ff 	movabs $0xffffffffffff8d8a,%r10
+  802985:	ff ff ff 
+  802988:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80298c:	ff d0                	call   *%rax
+  80298e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802992:	c9                   	leave
+  802993:	c3                   	ret
+
+0000000000802994 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802994:	55                   	push   %rbp
+  802995:	48 89 e5             	mov    %rsp,%rbp
+  802998:	41 57                	push   %r15
+  80299a:	53                   	push   %rbx
+  80299b:	48 83 ec 40          	sub    $0x40,%rsp
+  80299f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80299f <pgfault+0xb>
+  8029a6:	49 bb a1 66 00 00 00 	movabs $0x66a1,%r11
+  8029ad:	00 00 00 
+  8029b0:	4c 01 db             	add    %r11,%rbx
+  8029b3:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  8029b7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029bb:	48 8b 00             	mov    (%rax),%rax
+  8029be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  8029c2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8029c6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8029ca:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  8029cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029d1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8029d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029d9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029df:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  8029e3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8029e6:	83 e0 02             	and    $0x2,%eax
+  8029e9:	85 c0                	test   %eax,%eax
+  8029eb:	0f 84 91 03 00 00    	je     802d82 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  8029f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029f5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8029f9:	48 89 c2             	mov    %rax,%rdx
+  8029fc:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802a03:	ff ff ff 
+  802a06:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a0a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a0e:	83 e0 01             	and    $0x1,%eax
+  802a11:	48 85 c0             	test   %rax,%rax
+  802a14:	0f 84 a7 01 00 00    	je     802bc1 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802a1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a1e:	48 c1 e8 15          	shr    $0x15,%rax
+  802a22:	48 89 c2             	mov    %rax,%rdx
+  802a25:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802a2c:	ff ff ff 
+  802a2f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a33:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a37:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802a3c:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802a42:	0f 85 79 01 00 00    	jne    802bc1 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802a48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a4c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802a50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a54:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802a5a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802a5e:	ba 07 00 00 00       	mov    $0x7,%edx
+  802a63:	be 00 00 60 00       	mov    $0x600000,%esi
+  802a68:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a6d:	49 89 df             	mov    %rbx,%r15
+  802a70:	48 b8 81 97 ff ff ff 	movabs $0xffffffffffff9781,%rax
+  802a77:	ff ff ff 
+  802a7a:	48 01 d8             	add    %rbx,%rax
+  802a7d:	ff d0                	call   *%rax
+  802a7f:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802a82:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802a86:	79 44                	jns    802acc <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802a88:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802a8b:	89 c1                	mov    %eax,%ecx
+  802a8d:	48 b8 10 e4 ff ff ff 	movabs $0xffffffffffffe410,%rax
+  802a94:	ff ff ff 
+  802a97:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802a9b:	48 89 c2             	mov    %rax,%rdx
+  802a9e:	be 20 00 00 00       	mov    $0x20,%esi
+  802aa3:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802aaa:	ff ff ff 
+  802aad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ab1:	48 89 c7             	mov    %rax,%rdi
+  802ab4:	49 89 df             	mov    %rbx,%r15
+  802ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802abc:	49 b8 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r8
+  802ac3:	ff ff ff 
+  802ac6:	49 01 d8             	add    %rbx,%r8
+  802ac9:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802acc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ad0:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802ad5:	48 89 c6             	mov    %rax,%rsi
+  802ad8:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802add:	49 89 df             	mov    %rbx,%r15
+  802ae0:	48 b8 fa 89 ff ff ff 	movabs $0xffffffffffff89fa,%rax
+  802ae7:	ff ff ff 
+  802aea:	48 01 d8             	add    %rbx,%rax
+  802aed:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802aef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802af3:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802af9:	48 89 c1             	mov    %rax,%rcx
+  802afc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b01:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b06:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b0b:	49 89 df             	mov    %rbx,%r15
+  802b0e:	48 b8 10 92 ff ff ff 	movabs $0xffffffffffff9210,%rax
+  802b15:	ff ff ff 
+  802b18:	48 01 d8             	add    %rbx,%rax
+  802b1b:	ff d0                	call   *%rax
+  802b1d:	85 c0                	test   %eax,%eax
+  802b1f:	74 3e                	je     802b5f <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802b21:	48 b8 3b e4 ff ff ff 	movabs $0xffffffffffffe43b,%rax
+  802b28:	ff ff ff 
+  802b2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b2f:	48 89 c2             	mov    %rax,%rdx
+  802b32:	be 23 00 00 00       	mov    $0x23,%esi
+  802b37:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802b3e:	ff ff ff 
+  802b41:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b45:	48 89 c7             	mov    %rax,%rdi
+  802b48:	49 89 df             	mov    %rbx,%r15
+  802b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b50:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  802b57:	ff ff ff 
+  802b5a:	48 01 d9             	add    %rbx,%rcx
+  802b5d:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802b5f:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b64:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b69:	49 89 df             	mov    %rbx,%r15
+  802b6c:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  802b73:	ff ff ff 
+  802b76:	48 01 d8             	add    %rbx,%rax
+  802b79:	ff d0                	call   *%rax
+  802b7b:	85 c0                	test   %eax,%eax
+  802b7d:	0f 84 3d 02 00 00    	je     802dc0 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802b83:	48 b8 50 e4 ff ff ff 	movabs $0xffffffffffffe450,%rax
+  802b8a:	ff ff ff 
+  802b8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b91:	48 89 c2             	mov    %rax,%rdx
+  802b94:	be 25 00 00 00       	mov    $0x25,%esi
+  802b99:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802ba0:	ff ff ff 
+  802ba3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ba7:	48 89 c7             	mov    %rax,%rdi
+  802baa:	49 89 df             	mov    %rbx,%r15
+  802bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb2:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  802bb9:	ff ff ff 
+  802bbc:	48 01 d9             	add    %rbx,%rcx
+  802bbf:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802bc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bc5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bc9:	48 89 c2             	mov    %rax,%rdx
+  802bcc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802bd3:	ff ff ff 
+  802bd6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802bda:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bde:	25 00 08 00 00       	and    $0x800,%eax
+  802be3:	48 85 c0             	test   %rax,%rax
+  802be6:	0f 84 58 01 00 00    	je     802d44 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802bec:	ba 07 00 00 00       	mov    $0x7,%edx
+  802bf1:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802bf6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bfb:	49 89 df             	mov    %rbx,%r15
+  802bfe:	48 b8 ab 91 ff ff ff 	movabs $0xffffffffffff91ab,%rax
+  802c05:	ff ff ff 
+  802c08:	48 01 d8             	add    %rbx,%rax
+  802c0b:	ff d0                	call   *%rax
+  802c0d:	85 c0                	test   %eax,%eax
+  802c0f:	74 3e                	je     802c4f <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802c11:	48 b8 67 e4 ff ff ff 	movabs $0xffffffffffffe467,%rax
+  802c18:	ff ff ff 
+  802c1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c1f:	48 89 c2             	mov    %rax,%rdx
+  802c22:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802c27:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802c2e:	ff ff ff 
+  802c31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c35:	48 89 c7             	mov    %rax,%rdi
+  802c38:	49 89 df             	mov    %rbx,%r15
+  802c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c40:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  802c47:	ff ff ff 
+  802c4a:	48 01 d9             	add    %rbx,%rcx
+  802c4d:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802c4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c53:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c58:	48 89 c6             	mov    %rax,%rsi
+  802c5b:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802c60:	49 89 df             	mov    %rbx,%r15
+  802c63:	48 b8 fa 89 ff ff ff 	movabs $0xffffffffffff89fa,%rax
+  802c6a:	ff ff ff 
+  802c6d:	48 01 d8             	add    %rbx,%rax
+  802c70:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802c72:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c76:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c7c:	48 89 c1             	mov    %rax,%rcx
+  802c7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c84:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802c89:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c8e:	49 89 df             	mov    %rbx,%r15
+  802c91:	48 b8 10 92 ff ff ff 	movabs $0xffffffffffff9210,%rax
+  802c98:	ff ff ff 
+  802c9b:	48 01 d8             	add    %rbx,%rax
+  802c9e:	ff d0                	call   *%rax
+  802ca0:	85 c0                	test   %eax,%eax
+  802ca2:	74 3e                	je     802ce2 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802ca4:	48 b8 3b e4 ff ff ff 	movabs $0xffffffffffffe43b,%rax
+  802cab:	ff ff ff 
+  802cae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cb2:	48 89 c2             	mov    %rax,%rdx
+  802cb5:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802cba:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802cc1:	ff ff ff 
+  802cc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cc8:	48 89 c7             	mov    %rax,%rdi
+  802ccb:	49 89 df             	mov    %rbx,%r15
+  802cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd3:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  802cda:	ff ff ff 
+  802cdd:	48 01 d9             	add    %rbx,%rcx
+  802ce0:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802ce2:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802ce7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cec:	49 89 df             	mov    %rbx,%r15
+  802cef:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  802cf6:	ff ff ff 
+  802cf9:	48 01 d8             	add    %rbx,%rax
+  802cfc:	ff d0                	call   *%rax
+  802cfe:	85 c0                	test   %eax,%eax
+  802d00:	0f 84 bb 00 00 00    	je     802dc1 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802d06:	48 b8 50 e4 ff ff ff 	movabs $0xffffffffffffe450,%rax
+  802d0d:	ff ff ff 
+  802d10:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d14:	48 89 c2             	mov    %rax,%rdx
+  802d17:	be 32 00 00 00       	mov    $0x32,%esi
+  802d1c:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802d23:	ff ff ff 
+  802d26:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d2a:	48 89 c7             	mov    %rax,%rdi
+  802d2d:	49 89 df             	mov    %rbx,%r15
+  802d30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d35:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  802d3c:	ff ff ff 
+  802d3f:	48 01 d9             	add    %rbx,%rcx
+  802d42:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802d44:	48 b8 80 e4 ff ff ff 	movabs $0xffffffffffffe480,%rax
+  802d4b:	ff ff ff 
+  802d4e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d52:	48 89 c2             	mov    %rax,%rdx
+  802d55:	be 36 00 00 00       	mov    $0x36,%esi
+  802d5a:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802d61:	ff ff ff 
+  802d64:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d68:	48 89 c7             	mov    %rax,%rdi
+  802d6b:	49 89 df             	mov    %rbx,%r15
+  802d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d73:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  802d7a:	ff ff ff 
+  802d7d:	48 01 d9             	add    %rbx,%rcx
+  802d80:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802d82:	48 b8 9f e4 ff ff ff 	movabs $0xffffffffffffe49f,%rax
+  802d89:	ff ff ff 
+  802d8c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d90:	48 89 c2             	mov    %rax,%rdx
+  802d93:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802d98:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802d9f:	ff ff ff 
+  802da2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802da6:	48 89 c7             	mov    %rax,%rdi
+  802da9:	49 89 df             	mov    %rbx,%r15
+  802dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db1:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  802db8:	ff ff ff 
+  802dbb:	48 01 d9             	add    %rbx,%rcx
+  802dbe:	ff d1                	call   *%rcx
+			return;
+  802dc0:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802dc1:	48 83 c4 40          	add    $0x40,%rsp
+  802dc5:	5b                   	pop    %rbx
+  802dc6:	41 5f                	pop    %r15
+  802dc8:	5d                   	pop    %rbp
+  802dc9:	c3                   	ret
+
+0000000000802dca <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802dca:	55                   	push   %rbp
+  802dcb:	48 89 e5             	mov    %rsp,%rbp
+  802dce:	41 57                	push   %r15
+  802dd0:	53                   	push   %rbx
+  802dd1:	48 83 ec 10          	sub    $0x10,%rsp
+  802dd5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802dd5 <fork_flush+0xb>
+  802ddc:	49 bb 6b 62 00 00 00 	movabs $0x626b,%r11
+  802de3:	00 00 00 
+  802de6:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802de9:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802df0:	00 00 00 
+  802df3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802df7:	48 85 c0             	test   %rax,%rax
+  802dfa:	0f 84 81 00 00 00    	je     802e81 <fork_flush+0xb7>
+  802e00:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802e07:	00 00 00 
+  802e0a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e0e:	48 89 c6             	mov    %rax,%rsi
+  802e11:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802e18:	00 00 00 
+  802e1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e1f:	48 89 c7             	mov    %rax,%rdi
+  802e22:	49 89 df             	mov    %rbx,%r15
+  802e25:	48 b8 e6 97 ff ff ff 	movabs $0xffffffffffff97e6,%rax
+  802e2c:	ff ff ff 
+  802e2f:	48 01 d8             	add    %rbx,%rax
+  802e32:	ff d0                	call   *%rax
+  802e34:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e37:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e3b:	79 44                	jns    802e81 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802e3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e40:	89 c1                	mov    %eax,%ecx
+  802e42:	48 b8 b8 e4 ff ff ff 	movabs $0xffffffffffffe4b8,%rax
+  802e49:	ff ff ff 
+  802e4c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e50:	48 89 c2             	mov    %rax,%rdx
+  802e53:	be 56 00 00 00       	mov    $0x56,%esi
+  802e58:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  802e5f:	ff ff ff 
+  802e62:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e66:	48 89 c7             	mov    %rax,%rdi
+  802e69:	49 89 df             	mov    %rbx,%r15
+  802e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e71:	49 b8 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r8
+  802e78:	ff ff ff 
+  802e7b:	49 01 d8             	add    %rbx,%r8
+  802e7e:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802e81:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802e88:	00 00 00 
+  802e8b:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802e92:	00 
+}
+  802e93:	90                   	nop
+  802e94:	48 83 c4 10          	add    $0x10,%rsp
+  802e98:	5b                   	pop    %rbx
+  802e99:	41 5f                	pop    %r15
+  802e9b:	5d                   	pop    %rbp
+  802e9c:	c3                   	ret
+
+0000000000802e9d <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802e9d:	55                   	push   %rbp
+  802e9e:	48 89 e5             	mov    %rsp,%rbp
+  802ea1:	53                   	push   %rbx
+  802ea2:	48 83 ec 28          	sub    $0x28,%rsp
+  802ea6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802ea6 <fork_map+0x9>
+  802ead:	49 bb 9a 61 00 00 00 	movabs $0x619a,%r11
+  802eb4:	00 00 00 
+  802eb7:	4c 01 db             	add    %r11,%rbx
+  802eba:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802ebd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802ec1:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802ec4:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ecb:	00 00 00 
+  802ece:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ed2:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802ed8:	75 10                	jne    802eea <fork_map+0x4d>
+		fork_flush();
+  802eda:	48 b8 8a 9d ff ff ff 	movabs $0xffffffffffff9d8a,%rax
+  802ee1:	ff ff ff 
+  802ee4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ee8:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802eea:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ef1:	00 00 00 
+  802ef4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ef8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802efc:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802f03:	00 00 00 
+  802f06:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802f0a:	48 c1 e0 05          	shl    $0x5,%rax
+  802f0e:	48 89 c2             	mov    %rax,%rdx
+  802f11:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802f18:	00 00 00 
+  802f1b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f1f:	48 01 d0             	add    %rdx,%rax
+  802f22:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f2a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802f30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f34:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f38:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802f3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f40:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f43:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802f46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f4a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802f4e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802f52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f56:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802f59:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802f5c:	90                   	nop
+  802f5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f61:	c9                   	leave
+  802f62:	c3                   	ret
+
+0000000000802f63 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802f63:	55                   	push   %rbp
+  802f64:	48 89 e5             	mov    %rsp,%rbp
+  802f67:	53                   	push   %rbx
+  802f68:	48 83 ec 28          	sub    $0x28,%rsp
+  802f6c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f6c <duppage+0x9>
+  802f73:	49 bb d4 60 00 00 00 	movabs $0x60d4,%r11
+  802f7a:	00 00 00 
+  802f7d:	4c 01 db             	add    %r11,%rbx
+  802f80:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f83:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  802f86:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  802f89:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f8d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  802f91:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802f98:	ff ff ff 
+  802f9b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f9f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fa2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fa6:	25 00 04 00 00       	and    $0x400,%eax
+  802fab:	48 85 c0             	test   %rax,%rax
+  802fae:	74 42                	je     802ff2 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  802fb0:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802fb7:	ff ff ff 
+  802fba:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fbe:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fc1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fc5:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fca:	89 c2                	mov    %eax,%edx
+  802fcc:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802fd0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fd3:	48 89 ce             	mov    %rcx,%rsi
+  802fd6:	89 c7                	mov    %eax,%edi
+  802fd8:	48 b8 5d 9e ff ff ff 	movabs $0xffffffffffff9e5d,%rax
+  802fdf:	ff ff ff 
+  802fe2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fe6:	ff d0                	call   *%rax
+		return 0;
+  802fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fed:	e9 ae 00 00 00       	jmp    8030a0 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  802ff2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802ff9:	ff ff ff 
+  802ffc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803000:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803003:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803007:	83 e0 02             	and    $0x2,%eax
+  80300a:	48 85 c0             	test   %rax,%rax
+  80300d:	75 1f                	jne    80302e <duppage+0xcb>
+  80300f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803016:	ff ff ff 
+  803019:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80301d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803020:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803024:	25 00 08 00 00       	and    $0x800,%eax
+  803029:	48 85 c0             	test   %rax,%rax
+  80302c:	74 4c                	je     80307a <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  80302e:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  803035:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803038:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80303c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80303f:	48 89 ce             	mov    %rcx,%rsi
+  803042:	89 c7                	mov    %eax,%edi
+  803044:	48 b8 5d 9e ff ff ff 	movabs $0xffffffffffff9e5d,%rax
+  80304b:	ff ff ff 
+  80304e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803052:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  803054:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803057:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80305b:	48 89 c6             	mov    %rax,%rsi
+  80305e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803063:	48 b8 5d 9e ff ff ff 	movabs $0xffffffffffff9e5d,%rax
+  80306a:	ff ff ff 
+  80306d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803071:	ff d0                	call   *%rax
+		return 0;
+  803073:	b8 00 00 00 00       	mov    $0x0,%eax
+  803078:	eb 26                	jmp    8030a0 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  80307a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80307e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803081:	ba 05 00 00 00       	mov    $0x5,%edx
+  803086:	48 89 ce             	mov    %rcx,%rsi
+  803089:	89 c7                	mov    %eax,%edi
+  80308b:	48 b8 5d 9e ff ff ff 	movabs $0xffffffffffff9e5d,%rax
+  803092:	ff ff ff 
+  803095:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803099:	ff d0                	call   *%rax
+		return 0;
+  80309b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  8030a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030a4:	c9                   	leave
+  8030a5:	c3                   	ret
+
+00000000008030a6 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  8030a6:	55                   	push   %rbp
+  8030a7:	48 89 e5             	mov    %rsp,%rbp
+  8030aa:	53                   	push   %rbx
+  8030ab:	48 83 ec 28          	sub    $0x28,%rsp
+  8030af:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8030af <duphuge+0x9>
+  8030b6:	49 bb 91 5f 00 00 00 	movabs $0x5f91,%r11
+  8030bd:	00 00 00 
+  8030c0:	4c 01 db             	add    %r11,%rbx
+  8030c3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030c6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  8030ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8030ce:	48 c1 e8 15          	shr    $0x15,%rax
+  8030d2:	48 89 c2             	mov    %rax,%rdx
+  8030d5:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8030dc:	ff ff ff 
+  8030df:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030e3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030e7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8030eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030ef:	25 00 04 00 00       	and    $0x400,%eax
+  8030f4:	48 85 c0             	test   %rax,%rax
+  8030f7:	74 0e                	je     803107 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8030f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030fd:	25 07 0e 00 00       	and    $0xe07,%eax
+  803102:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803105:	eb 1e                	jmp    803125 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  803107:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80310b:	25 02 08 00 00       	and    $0x802,%eax
+  803110:	48 85 c0             	test   %rax,%rax
+  803113:	74 09                	je     80311e <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  803115:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  80311c:	eb 07                	jmp    803125 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  80311e:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  803125:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803128:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80312c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80312f:	48 89 ce             	mov    %rcx,%rsi
+  803132:	89 c7                	mov    %eax,%edi
+  803134:	48 b8 5d 9e ff ff ff 	movabs $0xffffffffffff9e5d,%rax
+  80313b:	ff ff ff 
+  80313e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803142:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  803144:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803147:	25 00 08 00 00       	and    $0x800,%eax
+  80314c:	85 c0                	test   %eax,%eax
+  80314e:	74 1f                	je     80316f <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  803150:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803153:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803157:	48 89 c6             	mov    %rax,%rsi
+  80315a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80315f:	48 b8 5d 9e ff ff ff 	movabs $0xffffffffffff9e5d,%rax
+  803166:	ff ff ff 
+  803169:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80316d:	ff d0                	call   *%rax
+	return 0;
+  80316f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803174:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803178:	c9                   	leave
+  803179:	c3                   	ret
+
+000000000080317a <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  80317a:	55                   	push   %rbp
+  80317b:	48 89 e5             	mov    %rsp,%rbp
+  80317e:	41 57                	push   %r15
+  803180:	53                   	push   %rbx
+  803181:	48 83 ec 10          	sub    $0x10,%rsp
+  803185:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803185 <fork+0xb>
+  80318c:	49 bb bb 5e 00 00 00 	movabs $0x5ebb,%r11
+  803193:	00 00 00 
+  803196:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  803199:	49 89 df             	mov    %rbx,%r15
+  80319c:	48 b8 00 99 ff ff ff 	movabs $0xffffffffffff9900,%rax
+  8031a3:	ff ff ff 
+  8031a6:	48 01 d8             	add    %rbx,%rax
+  8031a9:	ff d0                	call   *%rax
+  8031ab:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031b2:	75 42                	jne    8031f6 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8031b4:	49 89 df             	mov    %rbx,%r15
+  8031b7:	48 b8 02 91 ff ff ff 	movabs $0xffffffffffff9102,%rax
+  8031be:	ff ff ff 
+  8031c1:	48 01 d8             	add    %rbx,%rax
+  8031c4:	ff d0                	call   *%rax
+  8031c6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031cb:	48 98                	cltq
+  8031cd:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8031d4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8031db:	ff ff ff 
+  8031de:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8031e2:	48 01 c2             	add    %rax,%rdx
+  8031e5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8031ec:	ff ff ff 
+  8031ef:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031f3:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8031f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8031f9:	48 83 c4 10          	add    $0x10,%rsp
+  8031fd:	5b                   	pop    %rbx
+  8031fe:	41 5f                	pop    %r15
+  803200:	5d                   	pop    %rbp
+  803201:	c3                   	ret
+
+0000000000803202 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  803202:	55                   	push   %rbp
+  803203:	48 89 e5             	mov    %rsp,%rbp
+  803206:	41 57                	push   %r15
+  803208:	53                   	push   %rbx
+  803209:	48 83 ec 10          	sub    $0x10,%rsp
+  80320d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80320d <ufork+0xb>
+  803214:	49 bb 33 5e 00 00 00 	movabs $0x5e33,%r11
+  80321b:	00 00 00 
+  80321e:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  803221:	48 b8 54 99 ff ff ff 	movabs $0xffffffffffff9954,%rax
+  803228:	ff ff ff 
+  80322b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80322f:	48 89 c7             	mov    %rax,%rdi
+  803232:	49 89 df             	mov    %rbx,%r15
+  803235:	48 b8 c2 d4 ff ff ff 	movabs $0xffffffffffffd4c2,%rax
+  80323c:	ff ff ff 
+  80323f:	48 01 d8             	add    %rbx,%rax
+  803242:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  803244:	b8 07 00 00 00       	mov    $0x7,%eax
+  803249:	cd 30                	int    $0x30
+  80324b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  80324e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  803251:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  803254:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803258:	0f 84 03 02 00 00    	je     803461 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  80325e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803265:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  803266:	e9 28 01 00 00       	jmp    803393 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  80326b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80326f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803273:	48 89 c2             	mov    %rax,%rdx
+  803276:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80327d:	ff ff ff 
+  803280:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803284:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803288:	83 e0 01             	and    $0x1,%eax
+  80328b:	48 85 c0             	test   %rax,%rax
+  80328e:	0f 84 f7 00 00 00    	je     80338b <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803294:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803298:	48 c1 e8 15          	shr    $0x15,%rax
+  80329c:	48 89 c2             	mov    %rax,%rdx
+  80329f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8032a6:	ff ff ff 
+  8032a9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032ad:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032b1:	25 81 00 00 00       	and    $0x81,%eax
+  8032b6:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  8032bc:	75 29                	jne    8032e7 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  8032be:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8032c2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8032c5:	48 89 d6             	mov    %rdx,%rsi
+  8032c8:	89 c7                	mov    %eax,%edi
+  8032ca:	48 b8 66 a0 ff ff ff 	movabs $0xffffffffffffa066,%rax
+  8032d1:	ff ff ff 
+  8032d4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032d8:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  8032da:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8032e1:	00 
+  8032e2:	e9 ac 00 00 00       	jmp    803393 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8032e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032eb:	48 c1 e8 15          	shr    $0x15,%rax
+  8032ef:	48 89 c2             	mov    %rax,%rdx
+  8032f2:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8032f9:	ff ff ff 
+  8032fc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803300:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803304:	83 e0 01             	and    $0x1,%eax
+  803307:	48 85 c0             	test   %rax,%rax
+  80330a:	74 75                	je     803381 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  80330c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803310:	48 c1 e8 0c          	shr    $0xc,%rax
+  803314:	48 89 c2             	mov    %rax,%rdx
+  803317:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80331e:	ff ff ff 
+  803321:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803325:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803329:	83 e0 01             	and    $0x1,%eax
+  80332c:	48 85 c0             	test   %rax,%rax
+  80332f:	74 46                	je     803377 <ufork+0x175>
+  803331:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803335:	48 c1 e8 0c          	shr    $0xc,%rax
+  803339:	48 89 c2             	mov    %rax,%rdx
+  80333c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803343:	ff ff ff 
+  803346:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80334a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80334e:	83 e0 04             	and    $0x4,%eax
+  803351:	48 85 c0             	test   %rax,%rax
+  803354:	74 21                	je     803377 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  803356:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80335a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80335e:	89 c2                	mov    %eax,%edx
+  803360:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803363:	89 d6                	mov    %edx,%esi
+  803365:	89 c7                	mov    %eax,%edi
+  803367:	48 b8 23 9f ff ff ff 	movabs $0xffffffffffff9f23,%rax
+  80336e:	ff ff ff 
+  803371:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803375:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  803377:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  80337e:	00 
+  80337f:	eb 12                	jmp    803393 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803381:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803388:	00 
+  803389:	eb 08                	jmp    803393 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  80338b:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803392:	40 
+		for (; addr < USTACKTOP;){
+  803393:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803398:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80339c:	0f 83 c9 fe ff ff    	jae    80326b <ufork+0x69>
+			}
+		}
+		fork_flush();
+  8033a2:	48 b8 8a 9d ff ff ff 	movabs $0xffffffffffff9d8a,%rax
+  8033a9:	ff ff ff 
+  8033ac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033b0:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  8033b2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033b5:	ba 07 00 00 00       	mov    $0x7,%edx
+  8033ba:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  8033bf:	48 89 ce             	mov    %rcx,%rsi
+  8033c2:	89 c7                	mov    %eax,%edi
+  8033c4:	49 89 df             	mov    %rbx,%r15
+  8033c7:	48 b8 ab 91 ff ff ff 	movabs $0xffffffffffff91ab,%rax
+  8033ce:	ff ff ff 
+  8033d1:	48 01 d8             	add    %rbx,%rax
+  8033d4:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8033d6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033d9:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8033e0:	ff ff ff 
+  8033e3:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8033e7:	48 89 d6             	mov    %rdx,%rsi
+  8033ea:	89 c7                	mov    %eax,%edi
+  8033ec:	49 89 df             	mov    %rbx,%r15
+  8033ef:	48 b8 a1 93 ff ff ff 	movabs $0xffffffffffff93a1,%rax
+  8033f6:	ff ff ff 
+  8033f9:	48 01 d8             	add    %rbx,%rax
+  8033fc:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8033fe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803401:	be 02 00 00 00       	mov    $0x2,%esi
+  803406:	89 c7                	mov    %eax,%edi
+  803408:	49 89 df             	mov    %rbx,%r15
+  80340b:	48 b8 e2 92 ff ff ff 	movabs $0xffffffffffff92e2,%rax
+  803412:	ff ff ff 
+  803415:	48 01 d8             	add    %rbx,%rax
+  803418:	ff d0                	call   *%rax
+  80341a:	85 c0                	test   %eax,%eax
+  80341c:	74 3e                	je     80345c <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  80341e:	48 b8 df e4 ff ff ff 	movabs $0xffffffffffffe4df,%rax
+  803425:	ff ff ff 
+  803428:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80342c:	48 89 c2             	mov    %rax,%rdx
+  80342f:	be 07 01 00 00       	mov    $0x107,%esi
+  803434:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  80343b:	ff ff ff 
+  80343e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803442:	48 89 c7             	mov    %rax,%rdi
+  803445:	49 89 df             	mov    %rbx,%r15
+  803448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344d:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  803454:	ff ff ff 
+  803457:	48 01 d9             	add    %rbx,%rcx
+  80345a:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  80345c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80345f:	eb 59                	jmp    8034ba <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803461:	49 89 df             	mov    %rbx,%r15
+  803464:	48 b8 02 91 ff ff ff 	movabs $0xffffffffffff9102,%rax
+  80346b:	ff ff ff 
+  80346e:	48 01 d8             	add    %rbx,%rax
+  803471:	ff d0                	call   *%rax
+  803473:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803478:	48 98                	cltq
+  80347a:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803481:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803488:	ff ff ff 
+  80348b:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80348f:	48 01 c2             	add    %rax,%rdx
+  803492:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803499:	ff ff ff 
+  80349c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8034a0:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  8034a3:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  8034aa:	00 00 00 
+  8034ad:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  8034b4:	00 
+		return 0;
+  8034b5:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  8034ba:	48 83 c4 10          	add    $0x10,%rsp
+  8034be:	5b                   	pop    %rbx
+  8034bf:	41 5f                	pop    %r15
+  8034c1:	5d                   	pop    %rbp
+  8034c2:	c3                   	ret
+
+00000000008034c3 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8034c3:	55                   	push   %rbp
+  8034c4:	48 89 e5             	mov    %rsp,%rbp
+  8034c7:	41 57                	push   %r15
+  8034c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8034cd:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8034cd <sfork+0xa>
+  8034d4:	49 bb 73 5b 00 00 00 	movabs $0x5b73,%r11
+  8034db:	00 00 00 
+  8034de:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8034e1:	48 b8 fa e4 ff ff ff 	movabs $0xffffffffffffe4fa,%rax
+  8034e8:	ff ff ff 
+  8034eb:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8034ef:	48 89 c2             	mov    %rax,%rdx
+  8034f2:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8034f7:	48 b8 30 e4 ff ff ff 	movabs $0xffffffffffffe430,%rax
+  8034fe:	ff ff ff 
+  803501:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803505:	48 89 c7             	mov    %rax,%rdi
+  803508:	49 89 cf             	mov    %rcx,%r15
+  80350b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803510:	49 b8 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r8
+  803517:	ff ff ff 
+  80351a:	49 01 c8             	add    %rcx,%r8
+  80351d:	41 ff d0             	call   *%r8
+
+0000000000803520 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803520:	55                   	push   %rbp
+  803521:	48 89 e5             	mov    %rsp,%rbp
+  803524:	48 83 ec 08          	sub    $0x8,%rsp
+  803528:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803528 <fd2num+0x8>
+  80352f:	49 bb 18 5b 00 00 00 	movabs $0x5b18,%r11
+  803536:	00 00 00 
+  803539:	4c 01 d8             	add    %r11,%rax
+  80353c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803540:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803544:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80354b:	ff ff ff 
+  80354e:	48 01 d0             	add    %rdx,%rax
+  803551:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803555:	c9                   	leave
+  803556:	c3                   	ret
+
+0000000000803557 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803557:	55                   	push   %rbp
+  803558:	48 89 e5             	mov    %rsp,%rbp
+  80355b:	48 83 ec 08          	sub    $0x8,%rsp
+  80355f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80355f <fd2data+0x8>
+  803566:	49 bb e1 5a 00 00 00 	movabs $0x5ae1,%r11
+  80356d:	00 00 00 
+  803570:	4c 01 d8             	add    %r11,%rax
+  803573:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803577:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80357b:	48 89 d7             	mov    %rdx,%rdi
+  80357e:	48 ba e0 a4 ff ff ff 	movabs $0xffffffffffffa4e0,%rdx
+  803585:	ff ff ff 
+  803588:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  80358c:	ff d0                	call   *%rax
+  80358e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803594:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803598:	c9                   	leave
+  803599:	c3                   	ret
+
+000000000080359a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80359a:	55                   	push   %rbp
+  80359b:	48 89 e5             	mov    %rsp,%rbp
+  80359e:	48 83 ec 18          	sub    $0x18,%rsp
+  8035a2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8035a2 <fd_alloc+0x8>
+  8035a9:	49 bb 9e 5a 00 00 00 	movabs $0x5a9e,%r11
+  8035b0:	00 00 00 
+  8035b3:	4c 01 d8             	add    %r11,%rax
+  8035b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8035ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035c1:	eb 75                	jmp    803638 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  8035c3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8035c6:	48 63 d2             	movslq %edx,%rdx
+  8035c9:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  8035d0:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8035d4:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8035d8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8035dc:	48 89 d1             	mov    %rdx,%rcx
+  8035df:	48 c1 e9 15          	shr    $0x15,%rcx
+  8035e3:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8035ea:	ff ff ff 
+  8035ed:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8035f1:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8035f5:	83 e2 01             	and    $0x1,%edx
+  8035f8:	48 85 d2             	test   %rdx,%rdx
+  8035fb:	74 25                	je     803622 <fd_alloc+0x88>
+  8035fd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803601:	48 89 d1             	mov    %rdx,%rcx
+  803604:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803608:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  80360f:	ff ff ff 
+  803612:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803616:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  80361a:	83 e2 01             	and    $0x1,%edx
+  80361d:	48 85 d2             	test   %rdx,%rdx
+  803620:	75 12                	jne    803634 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803622:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803626:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80362a:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80362d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803632:	eb 1a                	jmp    80364e <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803634:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803638:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80363c:	7e 85                	jle    8035c3 <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  80363e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803642:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803649:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  80364e:	c9                   	leave
+  80364f:	c3                   	ret
+
+0000000000803650 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803650:	55                   	push   %rbp
+  803651:	48 89 e5             	mov    %rsp,%rbp
+  803654:	48 83 ec 20          	sub    $0x20,%rsp
+  803658:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803658 <fd_lookup+0x8>
+  80365f:	49 bb e8 59 00 00 00 	movabs $0x59e8,%r11
+  803666:	00 00 00 
+  803669:	4c 01 d8             	add    %r11,%rax
+  80366c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80366f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803673:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803677:	78 06                	js     80367f <fd_lookup+0x2f>
+  803679:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80367d:	7e 07                	jle    803686 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  80367f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803684:	eb 73                	jmp    8036f9 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803686:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803689:	48 63 d2             	movslq %edx,%rdx
+  80368c:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803693:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803697:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80369b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80369f:	48 89 d1             	mov    %rdx,%rcx
+  8036a2:	48 c1 e9 15          	shr    $0x15,%rcx
+  8036a6:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  8036ad:	ff ff ff 
+  8036b0:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  8036b4:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  8036b8:	83 e2 01             	and    $0x1,%edx
+  8036bb:	48 85 d2             	test   %rdx,%rdx
+  8036be:	74 22                	je     8036e2 <fd_lookup+0x92>
+  8036c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036c4:	48 c1 ea 0c          	shr    $0xc,%rdx
+  8036c8:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  8036cf:	ff ff ff 
+  8036d2:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  8036d6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036da:	83 e0 01             	and    $0x1,%eax
+  8036dd:	48 85 c0             	test   %rax,%rax
+  8036e0:	75 07                	jne    8036e9 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  8036e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036e7:	eb 10                	jmp    8036f9 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  8036e9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036ed:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036f1:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  8036f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f9:	c9                   	leave
+  8036fa:	c3                   	ret
+
+00000000008036fb <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  8036fb:	55                   	push   %rbp
+  8036fc:	48 89 e5             	mov    %rsp,%rbp
+  8036ff:	41 57                	push   %r15
+  803701:	53                   	push   %rbx
+  803702:	48 83 ec 30          	sub    $0x30,%rsp
+  803706:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803706 <fd_close+0xb>
+  80370d:	49 bb 3a 59 00 00 00 	movabs $0x593a,%r11
+  803714:	00 00 00 
+  803717:	4c 01 db             	add    %r11,%rbx
+  80371a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80371e:	89 f0                	mov    %esi,%eax
+  803720:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803723:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803727:	48 89 c7             	mov    %rax,%rdi
+  80372a:	48 b8 e0 a4 ff ff ff 	movabs $0xffffffffffffa4e0,%rax
+  803731:	ff ff ff 
+  803734:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803738:	ff d0                	call   *%rax
+  80373a:	89 c2                	mov    %eax,%edx
+  80373c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803740:	48 89 c6             	mov    %rax,%rsi
+  803743:	89 d7                	mov    %edx,%edi
+  803745:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  80374c:	ff ff ff 
+  80374f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803753:	ff d0                	call   *%rax
+  803755:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803758:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80375c:	78 0a                	js     803768 <fd_close+0x6d>
+	    || fd != fd2)
+  80375e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803762:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803766:	74 12                	je     80377a <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803768:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80376c:	74 05                	je     803773 <fd_close+0x78>
+  80376e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803771:	eb 7a                	jmp    8037ed <fd_close+0xf2>
+  803773:	b8 00 00 00 00       	mov    $0x0,%eax
+  803778:	eb 73                	jmp    8037ed <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80377a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80377e:	8b 00                	mov    (%rax),%eax
+  803780:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803784:	48 89 d6             	mov    %rdx,%rsi
+  803787:	89 c7                	mov    %eax,%edi
+  803789:	48 b8 b6 a7 ff ff ff 	movabs $0xffffffffffffa7b6,%rax
+  803790:	ff ff ff 
+  803793:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803797:	ff d0                	call   *%rax
+  803799:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80379c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037a0:	78 2a                	js     8037cc <fd_close+0xd1>
+		if (dev->dev_close)
+  8037a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037a6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8037aa:	48 85 c0             	test   %rax,%rax
+  8037ad:	74 16                	je     8037c5 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  8037af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037b3:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8037b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037bb:	48 89 c7             	mov    %rax,%rdi
+  8037be:	ff d2                	call   *%rdx
+  8037c0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8037c3:	eb 07                	jmp    8037cc <fd_close+0xd1>
+		else
+			r = 0;
+  8037c5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  8037cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037d0:	48 89 c6             	mov    %rax,%rsi
+  8037d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d8:	49 89 df             	mov    %rbx,%r15
+  8037db:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  8037e2:	ff ff ff 
+  8037e5:	48 01 d8             	add    %rbx,%rax
+  8037e8:	ff d0                	call   *%rax
+	return r;
+  8037ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8037ed:	48 83 c4 30          	add    $0x30,%rsp
+  8037f1:	5b                   	pop    %rbx
+  8037f2:	41 5f                	pop    %r15
+  8037f4:	5d                   	pop    %rbp
+  8037f5:	c3                   	ret
+
+00000000008037f6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8037f6:	55                   	push   %rbp
+  8037f7:	48 89 e5             	mov    %rsp,%rbp
+  8037fa:	41 57                	push   %r15
+  8037fc:	48 83 ec 28          	sub    $0x28,%rsp
+  803800:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 803800 <dev_lookup+0xa>
+  803807:	49 bb 40 58 00 00 00 	movabs $0x5840,%r11
+  80380e:	00 00 00 
+  803811:	4c 01 d9             	add    %r11,%rcx
+  803814:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803817:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80381b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803822:	eb 45                	jmp    803869 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  803824:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80382b:	00 00 00 
+  80382e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803831:	48 98                	cltq
+  803833:	48 01 ca             	add    %rcx,%rdx
+  803836:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80383a:	8b 00                	mov    (%rax),%eax
+  80383c:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80383f:	75 24                	jne    803865 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  803841:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803848:	00 00 00 
+  80384b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80384e:	48 98                	cltq
+  803850:	48 01 ca             	add    %rcx,%rdx
+  803853:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803857:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80385b:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80385e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803863:	eb 74                	jmp    8038d9 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  803865:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803869:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  803870:	00 00 00 
+  803873:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803876:	48 98                	cltq
+  803878:	48 01 ca             	add    %rcx,%rdx
+  80387b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80387f:	48 85 c0             	test   %rax,%rax
+  803882:	75 a0                	jne    803824 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803884:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80388b:	ff ff ff 
+  80388e:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  803892:	48 8b 00             	mov    (%rax),%rax
+  803895:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80389b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80389e:	89 c6                	mov    %eax,%esi
+  8038a0:	48 b8 10 e5 ff ff ff 	movabs $0xffffffffffffe510,%rax
+  8038a7:	ff ff ff 
+  8038aa:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8038ae:	48 89 c7             	mov    %rax,%rdi
+  8038b1:	49 89 cf             	mov    %rcx,%r15
+  8038b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b9:	49 b8 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%r8
+  8038c0:	ff ff ff 
+  8038c3:	49 01 c8             	add    %rcx,%r8
+  8038c6:	41 ff d0             	call   *%r8
+	*dev = 0;
+  8038c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038cd:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  8038d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8038d9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8038dd:	c9                   	leave
+  8038de:	c3                   	ret
+
+00000000008038df <close>:
+
+int
+close(int fdnum)
+{
+  8038df:	55                   	push   %rbp
+  8038e0:	48 89 e5             	mov    %rsp,%rbp
+  8038e3:	53                   	push   %rbx
+  8038e4:	48 83 ec 28          	sub    $0x28,%rsp
+  8038e8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038e8 <close+0x9>
+  8038ef:	49 bb 58 57 00 00 00 	movabs $0x5758,%r11
+  8038f6:	00 00 00 
+  8038f9:	4c 01 db             	add    %r11,%rbx
+  8038fc:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8038ff:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803903:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803906:	48 89 d6             	mov    %rdx,%rsi
+  803909:	89 c7                	mov    %eax,%edi
+  80390b:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  803912:	ff ff ff 
+  803915:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803919:	ff d0                	call   *%rax
+  80391b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80391e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803922:	79 05                	jns    803929 <close+0x4a>
+		return r;
+  803924:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803927:	eb 1c                	jmp    803945 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  803929:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80392d:	be 01 00 00 00       	mov    $0x1,%esi
+  803932:	48 89 c7             	mov    %rax,%rdi
+  803935:	48 b8 bb a6 ff ff ff 	movabs $0xffffffffffffa6bb,%rax
+  80393c:	ff ff ff 
+  80393f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803943:	ff d0                	call   *%rax
+}
+  803945:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803949:	c9                   	leave
+  80394a:	c3                   	ret
+
+000000000080394b <close_all>:
+
+void
+close_all(void)
+{
+  80394b:	55                   	push   %rbp
+  80394c:	48 89 e5             	mov    %rsp,%rbp
+  80394f:	53                   	push   %rbx
+  803950:	48 83 ec 18          	sub    $0x18,%rsp
+  803954:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803954 <close_all+0x9>
+  80395b:	49 bb ec 56 00 00 00 	movabs $0x56ec,%r11
+  803962:	00 00 00 
+  803965:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  803968:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80396f:	eb 19                	jmp    80398a <close_all+0x3f>
+		close(i);
+  803971:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803974:	89 c7                	mov    %eax,%edi
+  803976:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  80397d:	ff ff ff 
+  803980:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803984:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  803986:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80398a:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80398e:	7e e1                	jle    803971 <close_all+0x26>
+}
+  803990:	90                   	nop
+  803991:	90                   	nop
+  803992:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803996:	c9                   	leave
+  803997:	c3                   	ret
+
+0000000000803998 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  803998:	55                   	push   %rbp
+  803999:	48 89 e5             	mov    %rsp,%rbp
+  80399c:	41 57                	push   %r15
+  80399e:	53                   	push   %rbx
+  80399f:	48 83 ec 40          	sub    $0x40,%rsp
+  8039a3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039a3 <dup+0xb>
+  8039aa:	49 bb 9d 56 00 00 00 	movabs $0x569d,%r11
+  8039b1:	00 00 00 
+  8039b4:	4c 01 db             	add    %r11,%rbx
+  8039b7:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8039ba:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8039bd:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8039c1:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8039c4:	48 89 d6             	mov    %rdx,%rsi
+  8039c7:	89 c7                	mov    %eax,%edi
+  8039c9:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  8039d0:	ff ff ff 
+  8039d3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039d7:	ff d0                	call   *%rax
+  8039d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8039dc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8039e0:	79 08                	jns    8039ea <dup+0x52>
+		return r;
+  8039e2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039e5:	e9 a4 01 00 00       	jmp    803b8e <dup+0x1f6>
+	close(newfdnum);
+  8039ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039ed:	89 c7                	mov    %eax,%edi
+  8039ef:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  8039f6:	ff ff ff 
+  8039f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8039fd:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8039ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a02:	48 98                	cltq
+  803a04:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  803a0a:	48 c1 e0 0c          	shl    $0xc,%rax
+  803a0e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  803a12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a16:	48 89 c7             	mov    %rax,%rdi
+  803a19:	48 b8 17 a5 ff ff ff 	movabs $0xffffffffffffa517,%rax
+  803a20:	ff ff ff 
+  803a23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a27:	ff d0                	call   *%rax
+  803a29:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  803a2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a31:	48 89 c7             	mov    %rax,%rdi
+  803a34:	48 b8 17 a5 ff ff ff 	movabs $0xffffffffffffa517,%rax
+  803a3b:	ff ff ff 
+  803a3e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803a42:	ff d0                	call   *%rax
+  803a44:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  803a48:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a4c:	48 c1 e8 15          	shr    $0x15,%rax
+  803a50:	48 89 c2             	mov    %rax,%rdx
+  803a53:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803a5a:	ff ff ff 
+  803a5d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a61:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a65:	83 e0 01             	and    $0x1,%eax
+  803a68:	48 85 c0             	test   %rax,%rax
+  803a6b:	74 7f                	je     803aec <dup+0x154>
+  803a6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a71:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a75:	48 89 c2             	mov    %rax,%rdx
+  803a78:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803a7f:	ff ff ff 
+  803a82:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a86:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a8a:	83 e0 01             	and    $0x1,%eax
+  803a8d:	48 85 c0             	test   %rax,%rax
+  803a90:	74 5a                	je     803aec <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  803a92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a96:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a9a:	48 89 c2             	mov    %rax,%rdx
+  803a9d:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803aa4:	ff ff ff 
+  803aa7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803aab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803aaf:	25 07 0e 00 00       	and    $0xe07,%eax
+  803ab4:	89 c1                	mov    %eax,%ecx
+  803ab6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803aba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803abe:	41 89 c8             	mov    %ecx,%r8d
+  803ac1:	48 89 d1             	mov    %rdx,%rcx
+  803ac4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ac9:	48 89 c6             	mov    %rax,%rsi
+  803acc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad1:	49 89 df             	mov    %rbx,%r15
+  803ad4:	48 b8 10 92 ff ff ff 	movabs $0xffffffffffff9210,%rax
+  803adb:	ff ff ff 
+  803ade:	48 01 d8             	add    %rbx,%rax
+  803ae1:	ff d0                	call   *%rax
+  803ae3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ae6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803aea:	78 5f                	js     803b4b <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803aec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803af0:	48 c1 e8 0c          	shr    $0xc,%rax
+  803af4:	48 89 c2             	mov    %rax,%rdx
+  803af7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803afe:	ff ff ff 
+  803b01:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b05:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b09:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b0e:	89 c1                	mov    %eax,%ecx
+  803b10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b14:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b18:	41 89 c8             	mov    %ecx,%r8d
+  803b1b:	48 89 d1             	mov    %rdx,%rcx
+  803b1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b23:	48 89 c6             	mov    %rax,%rsi
+  803b26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b2b:	49 89 df             	mov    %rbx,%r15
+  803b2e:	48 b8 10 92 ff ff ff 	movabs $0xffffffffffff9210,%rax
+  803b35:	ff ff ff 
+  803b38:	48 01 d8             	add    %rbx,%rax
+  803b3b:	ff d0                	call   *%rax
+  803b3d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803b40:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b44:	78 08                	js     803b4e <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  803b46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b49:	eb 43                	jmp    803b8e <dup+0x1f6>
+			goto err;
+  803b4b:	90                   	nop
+  803b4c:	eb 01                	jmp    803b4f <dup+0x1b7>
+		goto err;
+  803b4e:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  803b4f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b53:	48 89 c6             	mov    %rax,%rsi
+  803b56:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b5b:	49 89 df             	mov    %rbx,%r15
+  803b5e:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  803b65:	ff ff ff 
+  803b68:	48 01 d8             	add    %rbx,%rax
+  803b6b:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  803b6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b71:	48 89 c6             	mov    %rax,%rsi
+  803b74:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b79:	49 89 df             	mov    %rbx,%r15
+  803b7c:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  803b83:	ff ff ff 
+  803b86:	48 01 d8             	add    %rbx,%rax
+  803b89:	ff d0                	call   *%rax
+	return r;
+  803b8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803b8e:	48 83 c4 40          	add    $0x40,%rsp
+  803b92:	5b                   	pop    %rbx
+  803b93:	41 5f                	pop    %r15
+  803b95:	5d                   	pop    %rbp
+  803b96:	c3                   	ret
+
+0000000000803b97 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  803b97:	55                   	push   %rbp
+  803b98:	48 89 e5             	mov    %rsp,%rbp
+  803b9b:	41 57                	push   %r15
+  803b9d:	53                   	push   %rbx
+  803b9e:	48 83 ec 40          	sub    $0x40,%rsp
+  803ba2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803ba2 <read+0xb>
+  803ba9:	49 bb 9e 54 00 00 00 	movabs $0x549e,%r11
+  803bb0:	00 00 00 
+  803bb3:	4c 01 db             	add    %r11,%rbx
+  803bb6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803bb9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803bbd:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803bc1:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803bc5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803bc8:	48 89 d6             	mov    %rdx,%rsi
+  803bcb:	89 c7                	mov    %eax,%edi
+  803bcd:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  803bd4:	ff ff ff 
+  803bd7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803bdb:	ff d0                	call   *%rax
+  803bdd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803be0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803be4:	78 28                	js     803c0e <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803be6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803bea:	8b 00                	mov    (%rax),%eax
+  803bec:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803bf0:	48 89 d6             	mov    %rdx,%rsi
+  803bf3:	89 c7                	mov    %eax,%edi
+  803bf5:	48 b8 b6 a7 ff ff ff 	movabs $0xffffffffffffa7b6,%rax
+  803bfc:	ff ff ff 
+  803bff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c03:	ff d0                	call   *%rax
+  803c05:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803c08:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803c0c:	79 08                	jns    803c16 <read+0x7f>
+		return r;
+  803c0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c11:	e9 8b 00 00 00       	jmp    803ca1 <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803c16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c1a:	8b 40 08             	mov    0x8(%rax),%eax
+  803c1d:	83 e0 03             	and    $0x3,%eax
+  803c20:	83 f8 01             	cmp    $0x1,%eax
+  803c23:	75 4b                	jne    803c70 <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803c25:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803c2c:	ff ff ff 
+  803c2f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803c33:	48 8b 00             	mov    (%rax),%rax
+  803c36:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803c3c:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803c3f:	89 c6                	mov    %eax,%esi
+  803c41:	48 b8 2f e5 ff ff ff 	movabs $0xffffffffffffe52f,%rax
+  803c48:	ff ff ff 
+  803c4b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803c4f:	48 89 c7             	mov    %rax,%rdi
+  803c52:	49 89 df             	mov    %rbx,%r15
+  803c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c5a:	48 b9 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rcx
+  803c61:	ff ff ff 
+  803c64:	48 01 d9             	add    %rbx,%rcx
+  803c67:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803c69:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c6e:	eb 31                	jmp    803ca1 <read+0x10a>
+	}
+	if (!dev->dev_read)
+  803c70:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c74:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803c78:	48 85 c0             	test   %rax,%rax
+  803c7b:	75 07                	jne    803c84 <read+0xed>
+		return -E_NOT_SUPP;
+  803c7d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c82:	eb 1d                	jmp    803ca1 <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  803c84:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c88:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803c8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803c90:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803c94:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c98:	48 89 ce             	mov    %rcx,%rsi
+  803c9b:	48 89 c7             	mov    %rax,%rdi
+  803c9e:	41 ff d0             	call   *%r8
+}
+  803ca1:	48 83 c4 40          	add    $0x40,%rsp
+  803ca5:	5b                   	pop    %rbx
+  803ca6:	41 5f                	pop    %r15
+  803ca8:	5d                   	pop    %rbp
+  803ca9:	c3                   	ret
+
+0000000000803caa <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  803caa:	55                   	push   %rbp
+  803cab:	48 89 e5             	mov    %rsp,%rbp
+  803cae:	53                   	push   %rbx
+  803caf:	48 83 ec 38          	sub    $0x38,%rsp
+  803cb3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803cb3 <readn+0x9>
+  803cba:	49 bb 8d 53 00 00 00 	movabs $0x538d,%r11
+  803cc1:	00 00 00 
+  803cc4:	4c 01 db             	add    %r11,%rbx
+  803cc7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803cca:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803cce:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  803cd2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803cd9:	eb 4b                	jmp    803d26 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  803cdb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cde:	48 98                	cltq
+  803ce0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803ce4:	48 29 c2             	sub    %rax,%rdx
+  803ce7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cea:	48 63 c8             	movslq %eax,%rcx
+  803ced:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cf1:	48 01 c1             	add    %rax,%rcx
+  803cf4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cf7:	48 89 ce             	mov    %rcx,%rsi
+  803cfa:	89 c7                	mov    %eax,%edi
+  803cfc:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  803d03:	ff ff ff 
+  803d06:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d0a:	ff d0                	call   *%rax
+  803d0c:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  803d0f:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803d13:	79 05                	jns    803d1a <readn+0x70>
+			return m;
+  803d15:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d18:	eb 1d                	jmp    803d37 <readn+0x8d>
+		if (m == 0)
+  803d1a:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  803d1e:	74 13                	je     803d33 <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  803d20:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  803d23:	01 45 ec             	add    %eax,-0x14(%rbp)
+  803d26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d29:	48 98                	cltq
+  803d2b:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  803d2f:	72 aa                	jb     803cdb <readn+0x31>
+  803d31:	eb 01                	jmp    803d34 <readn+0x8a>
+			break;
+  803d33:	90                   	nop
+	}
+	return tot;
+  803d34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803d37:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d3b:	c9                   	leave
+  803d3c:	c3                   	ret
+
+0000000000803d3d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  803d3d:	55                   	push   %rbp
+  803d3e:	48 89 e5             	mov    %rsp,%rbp
+  803d41:	41 57                	push   %r15
+  803d43:	53                   	push   %rbx
+  803d44:	48 83 ec 40          	sub    $0x40,%rsp
+  803d48:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803d48 <write+0xb>
+  803d4f:	49 bb f8 52 00 00 00 	movabs $0x52f8,%r11
+  803d56:	00 00 00 
+  803d59:	4c 01 db             	add    %r11,%rbx
+  803d5c:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803d5f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d63:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803d67:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803d6b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803d6e:	48 89 d6             	mov    %rdx,%rsi
+  803d71:	89 c7                	mov    %eax,%edi
+  803d73:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  803d7a:	ff ff ff 
+  803d7d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803d81:	ff d0                	call   *%rax
+  803d83:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803d86:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803d8a:	78 28                	js     803db4 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d8c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803d90:	8b 00                	mov    (%rax),%eax
+  803d92:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803d96:	48 89 d6             	mov    %rdx,%rsi
+  803d99:	89 c7                	mov    %eax,%edi
+  803d9b:	48 b8 b6 a7 ff ff ff 	movabs $0xffffffffffffa7b6,%rax
+  803da2:	ff ff ff 
+  803da5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803da9:	ff d0                	call   *%rax
+  803dab:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803dae:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803db2:	79 08                	jns    803dbc <write+0x7f>
+		return r;
+  803db4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803db7:	e9 8a 00 00 00       	jmp    803e46 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803dbc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803dc0:	8b 40 08             	mov    0x8(%rax),%eax
+  803dc3:	83 e0 03             	and    $0x3,%eax
+  803dc6:	85 c0                	test   %eax,%eax
+  803dc8:	75 4b                	jne    803e15 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803dca:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803dd1:	ff ff ff 
+  803dd4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803dd8:	48 8b 00             	mov    (%rax),%rax
+  803ddb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803de1:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803de4:	89 c6                	mov    %eax,%esi
+  803de6:	48 b8 4b e5 ff ff ff 	movabs $0xffffffffffffe54b,%rax
+  803ded:	ff ff ff 
+  803df0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803df4:	48 89 c7             	mov    %rax,%rdi
+  803df7:	49 89 df             	mov    %rbx,%r15
+  803dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dff:	48 b9 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rcx
+  803e06:	ff ff ff 
+  803e09:	48 01 d9             	add    %rbx,%rcx
+  803e0c:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803e0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e13:	eb 31                	jmp    803e46 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  803e15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e19:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803e1d:	48 85 c0             	test   %rax,%rax
+  803e20:	75 07                	jne    803e29 <write+0xec>
+		return -E_NOT_SUPP;
+  803e22:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803e27:	eb 1d                	jmp    803e46 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  803e29:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e2d:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803e31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e35:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803e39:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803e3d:	48 89 ce             	mov    %rcx,%rsi
+  803e40:	48 89 c7             	mov    %rax,%rdi
+  803e43:	41 ff d0             	call   *%r8
+}
+  803e46:	48 83 c4 40          	add    $0x40,%rsp
+  803e4a:	5b                   	pop    %rbx
+  803e4b:	41 5f                	pop    %r15
+  803e4d:	5d                   	pop    %rbp
+  803e4e:	c3                   	ret
+
+0000000000803e4f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  803e4f:	55                   	push   %rbp
+  803e50:	48 89 e5             	mov    %rsp,%rbp
+  803e53:	48 83 ec 18          	sub    $0x18,%rsp
+  803e57:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e57 <seek+0x8>
+  803e5e:	49 bb e9 51 00 00 00 	movabs $0x51e9,%r11
+  803e65:	00 00 00 
+  803e68:	4c 01 d8             	add    %r11,%rax
+  803e6b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e6e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e71:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  803e75:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803e78:	48 89 ce             	mov    %rcx,%rsi
+  803e7b:	89 d7                	mov    %edx,%edi
+  803e7d:	48 ba 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rdx
+  803e84:	ff ff ff 
+  803e87:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803e8b:	ff d0                	call   *%rax
+  803e8d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e94:	79 05                	jns    803e9b <seek+0x4c>
+		return r;
+  803e96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e99:	eb 0f                	jmp    803eaa <seek+0x5b>
+	fd->fd_offset = offset;
+  803e9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e9f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803ea2:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  803ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eaa:	c9                   	leave
+  803eab:	c3                   	ret
+
+0000000000803eac <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  803eac:	55                   	push   %rbp
+  803ead:	48 89 e5             	mov    %rsp,%rbp
+  803eb0:	41 57                	push   %r15
+  803eb2:	53                   	push   %rbx
+  803eb3:	48 83 ec 30          	sub    $0x30,%rsp
+  803eb7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803eb7 <ftruncate+0xb>
+  803ebe:	49 bb 89 51 00 00 00 	movabs $0x5189,%r11
+  803ec5:	00 00 00 
+  803ec8:	4c 01 db             	add    %r11,%rbx
+  803ecb:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803ece:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803ed1:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803ed5:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803ed8:	48 89 d6             	mov    %rdx,%rsi
+  803edb:	89 c7                	mov    %eax,%edi
+  803edd:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  803ee4:	ff ff ff 
+  803ee7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803eeb:	ff d0                	call   *%rax
+  803eed:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ef0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ef4:	78 28                	js     803f1e <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ef6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803efa:	8b 00                	mov    (%rax),%eax
+  803efc:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  803f00:	48 89 d6             	mov    %rdx,%rsi
+  803f03:	89 c7                	mov    %eax,%edi
+  803f05:	48 b8 b6 a7 ff ff ff 	movabs $0xffffffffffffa7b6,%rax
+  803f0c:	ff ff ff 
+  803f0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f13:	ff d0                	call   *%rax
+  803f15:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803f18:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f1c:	79 08                	jns    803f26 <ftruncate+0x7a>
+		return r;
+  803f1e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f21:	e9 83 00 00 00       	jmp    803fa9 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803f26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f2a:	8b 40 08             	mov    0x8(%rax),%eax
+  803f2d:	83 e0 03             	and    $0x3,%eax
+  803f30:	85 c0                	test   %eax,%eax
+  803f32:	75 4b                	jne    803f7f <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  803f34:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803f3b:	ff ff ff 
+  803f3e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803f42:	48 8b 00             	mov    (%rax),%rax
+  803f45:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803f4b:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  803f4e:	89 c6                	mov    %eax,%esi
+  803f50:	48 b8 68 e5 ff ff ff 	movabs $0xffffffffffffe568,%rax
+  803f57:	ff ff ff 
+  803f5a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f5e:	48 89 c7             	mov    %rax,%rdi
+  803f61:	49 89 df             	mov    %rbx,%r15
+  803f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f69:	48 b9 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rcx
+  803f70:	ff ff ff 
+  803f73:	48 01 d9             	add    %rbx,%rcx
+  803f76:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  803f78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f7d:	eb 2a                	jmp    803fa9 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  803f7f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f83:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803f87:	48 85 c0             	test   %rax,%rax
+  803f8a:	75 07                	jne    803f93 <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  803f8c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f91:	eb 16                	jmp    803fa9 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  803f93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f97:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803f9b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803f9f:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  803fa2:	89 d6                	mov    %edx,%esi
+  803fa4:	48 89 c7             	mov    %rax,%rdi
+  803fa7:	ff d1                	call   *%rcx
+}
+  803fa9:	48 83 c4 30          	add    $0x30,%rsp
+  803fad:	5b                   	pop    %rbx
+  803fae:	41 5f                	pop    %r15
+  803fb0:	5d                   	pop    %rbp
+  803fb1:	c3                   	ret
+
+0000000000803fb2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  803fb2:	55                   	push   %rbp
+  803fb3:	48 89 e5             	mov    %rsp,%rbp
+  803fb6:	53                   	push   %rbx
+  803fb7:	48 83 ec 38          	sub    $0x38,%rsp
+  803fbb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fbb <fstat+0x9>
+  803fc2:	49 bb 85 50 00 00 00 	movabs $0x5085,%r11
+  803fc9:	00 00 00 
+  803fcc:	4c 01 db             	add    %r11,%rbx
+  803fcf:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803fd2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  803fd6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803fda:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803fdd:	48 89 d6             	mov    %rdx,%rsi
+  803fe0:	89 c7                	mov    %eax,%edi
+  803fe2:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  803fe9:	ff ff ff 
+  803fec:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803ff0:	ff d0                	call   *%rax
+  803ff2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803ff5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ff9:	78 28                	js     804023 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ffb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fff:	8b 00                	mov    (%rax),%eax
+  804001:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804005:	48 89 d6             	mov    %rdx,%rsi
+  804008:	89 c7                	mov    %eax,%edi
+  80400a:	48 b8 b6 a7 ff ff ff 	movabs $0xffffffffffffa7b6,%rax
+  804011:	ff ff ff 
+  804014:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804018:	ff d0                	call   *%rax
+  80401a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80401d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804021:	79 05                	jns    804028 <fstat+0x76>
+		return r;
+  804023:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804026:	eb 5e                	jmp    804086 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804028:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80402c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804030:	48 85 c0             	test   %rax,%rax
+  804033:	75 07                	jne    80403c <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804035:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80403a:	eb 4a                	jmp    804086 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  80403c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804040:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  804043:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804047:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80404e:	00 00 00 
+	stat->st_isdir = 0;
+  804051:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804055:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80405c:	00 00 00 
+	stat->st_dev = dev;
+  80405f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804063:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804067:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80406e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804072:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804076:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80407a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80407e:	48 89 d6             	mov    %rdx,%rsi
+  804081:	48 89 c7             	mov    %rax,%rdi
+  804084:	ff d1                	call   *%rcx
+}
+  804086:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80408a:	c9                   	leave
+  80408b:	c3                   	ret
+
+000000000080408c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80408c:	55                   	push   %rbp
+  80408d:	48 89 e5             	mov    %rsp,%rbp
+  804090:	41 57                	push   %r15
+  804092:	53                   	push   %rbx
+  804093:	48 83 ec 20          	sub    $0x20,%rsp
+  804097:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804097 <stat+0xb>
+  80409e:	49 bb a9 4f 00 00 00 	movabs $0x4fa9,%r11
+  8040a5:	00 00 00 
+  8040a8:	4c 01 db             	add    %r11,%rbx
+  8040ab:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8040af:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8040b3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8040b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8040bc:	48 89 c7             	mov    %rax,%rdi
+  8040bf:	49 89 df             	mov    %rbx,%r15
+  8040c2:	48 b8 26 b3 ff ff ff 	movabs $0xffffffffffffb326,%rax
+  8040c9:	ff ff ff 
+  8040cc:	48 01 d8             	add    %rbx,%rax
+  8040cf:	ff d0                	call   *%rax
+  8040d1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8040d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8040d8:	79 05                	jns    8040df <stat+0x53>
+		return fd;
+  8040da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040dd:	eb 37                	jmp    804116 <stat+0x8a>
+	r = fstat(fd, stat);
+  8040df:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040e6:	48 89 d6             	mov    %rdx,%rsi
+  8040e9:	89 c7                	mov    %eax,%edi
+  8040eb:	48 b8 72 af ff ff ff 	movabs $0xffffffffffffaf72,%rax
+  8040f2:	ff ff ff 
+  8040f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8040f9:	ff d0                	call   *%rax
+  8040fb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8040fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804101:	89 c7                	mov    %eax,%edi
+  804103:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  80410a:	ff ff ff 
+  80410d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804111:	ff d0                	call   *%rax
+	return r;
+  804113:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804116:	48 83 c4 20          	add    $0x20,%rsp
+  80411a:	5b                   	pop    %rbx
+  80411b:	41 5f                	pop    %r15
+  80411d:	5d                   	pop    %rbp
+  80411e:	c3                   	ret
+
+000000000080411f <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80411f:	55                   	push   %rbp
+  804120:	48 89 e5             	mov    %rsp,%rbp
+  804123:	41 57                	push   %r15
+  804125:	53                   	push   %rbx
+  804126:	48 83 ec 10          	sub    $0x10,%rsp
+  80412a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80412a <fsipc+0xb>
+  804131:	49 bb 16 4f 00 00 00 	movabs $0x4f16,%r11
+  804138:	00 00 00 
+  80413b:	4c 01 db             	add    %r11,%rbx
+  80413e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804141:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804145:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80414c:	00 00 00 
+  80414f:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804152:	85 c0                	test   %eax,%eax
+  804154:	75 24                	jne    80417a <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804156:	bf 01 00 00 00       	mov    $0x1,%edi
+  80415b:	49 89 df             	mov    %rbx,%r15
+  80415e:	48 b8 81 dd ff ff ff 	movabs $0xffffffffffffdd81,%rax
+  804165:	ff ff ff 
+  804168:	48 01 d8             	add    %rbx,%rax
+  80416b:	ff d0                	call   *%rax
+  80416d:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804174:	00 00 00 
+  804177:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  80417a:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804181:	00 00 00 
+  804184:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804187:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80418b:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80418e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804194:	49 89 d0             	mov    %rdx,%r8
+  804197:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80419c:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8041a3:	00 00 00 
+  8041a6:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8041aa:	89 c7                	mov    %eax,%edi
+  8041ac:	49 89 df             	mov    %rbx,%r15
+  8041af:	48 b8 a0 d7 ff ff ff 	movabs $0xffffffffffffd7a0,%rax
+  8041b6:	ff ff ff 
+  8041b9:	48 01 d8             	add    %rbx,%rax
+  8041bc:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  8041be:	48 83 c4 10          	add    $0x10,%rsp
+  8041c2:	5b                   	pop    %rbx
+  8041c3:	41 5f                	pop    %r15
+  8041c5:	5d                   	pop    %rbp
+  8041c6:	c3                   	ret
+
+00000000008041c7 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  8041c7:	55                   	push   %rbp
+  8041c8:	48 89 e5             	mov    %rsp,%rbp
+  8041cb:	41 57                	push   %r15
+  8041cd:	53                   	push   %rbx
+  8041ce:	48 83 ec 20          	sub    $0x20,%rsp
+  8041d2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041d2 <fsipc_words+0xb>
+  8041d9:	49 bb 6e 4e 00 00 00 	movabs $0x4e6e,%r11
+  8041e0:	00 00 00 
+  8041e3:	4c 01 db             	add    %r11,%rbx
+  8041e6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8041e9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8041ed:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  8041f1:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8041f8:	00 00 00 
+  8041fb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8041fe:	85 c0                	test   %eax,%eax
+  804200:	75 24                	jne    804226 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804202:	bf 01 00 00 00       	mov    $0x1,%edi
+  804207:	49 89 df             	mov    %rbx,%r15
+  80420a:	48 b8 81 dd ff ff ff 	movabs $0xffffffffffffdd81,%rax
+  804211:	ff ff ff 
+  804214:	48 01 d8             	add    %rbx,%rax
+  804217:	ff d0                	call   *%rax
+  804219:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804220:	00 00 00 
+  804223:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804226:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80422d:	00 00 00 
+  804230:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804233:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804237:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80423b:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80423e:	89 c7                	mov    %eax,%edi
+  804240:	49 89 df             	mov    %rbx,%r15
+  804243:	48 b8 8b d8 ff ff ff 	movabs $0xffffffffffffd88b,%rax
+  80424a:	ff ff ff 
+  80424d:	48 01 d8             	add    %rbx,%rax
+  804250:	ff d0                	call   *%rax
+}
+  804252:	48 83 c4 20          	add    $0x20,%rsp
+  804256:	5b                   	pop    %rbx
+  804257:	41 5f                	pop    %r15
+  804259:	5d                   	pop    %rbp
+  80425a:	c3                   	ret
+
+000000000080425b <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  80425b:	55                   	push   %rbp
+  80425c:	48 89 e5             	mov    %rsp,%rbp
+  80425f:	41 57                	push   %r15
+  804261:	53                   	push   %rbx
+  804262:	48 83 ec 40          	sub    $0x40,%rsp
+  804266:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804266 <fsipc_pages+0xb>
+  80426d:	49 bb da 4d 00 00 00 	movabs $0x4dda,%r11
+  804274:	00 00 00 
+  804277:	4c 01 db             	add    %r11,%rbx
+  80427a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80427d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804281:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804285:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804288:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  80428f:	00 00 00 
+  804292:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804295:	85 c0                	test   %eax,%eax
+  804297:	75 24                	jne    8042bd <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804299:	bf 01 00 00 00       	mov    $0x1,%edi
+  80429e:	49 89 df             	mov    %rbx,%r15
+  8042a1:	48 b8 81 dd ff ff ff 	movabs $0xffffffffffffdd81,%rax
+  8042a8:	ff ff ff 
+  8042ab:	48 01 d8             	add    %rbx,%rax
+  8042ae:	ff d0                	call   *%rax
+  8042b0:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8042b7:	00 00 00 
+  8042ba:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  8042bd:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8042c2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  8042c6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8042c9:	48 98                	cltq
+  8042cb:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  8042cf:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  8042d3:	0f 95 c0             	setne  %al
+  8042d6:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  8042d9:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8042e0:	00 
+  8042e1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8042e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042e9:	48 01 d0             	add    %rdx,%rax
+  8042ec:	48 83 e8 01          	sub    $0x1,%rax
+  8042f0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8042f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042fd:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804301:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804305:	48 29 d0             	sub    %rdx,%rax
+  804308:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  80430c:	41 89 c2             	mov    %eax,%r10d
+  80430f:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804316:	00 00 00 
+  804319:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80431c:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804320:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804324:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804327:	48 83 ec 08          	sub    $0x8,%rsp
+  80432b:	6a 40                	push   $0x40
+  80432d:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804332:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804339:	00 
+  80433a:	6a 05                	push   $0x5
+  80433c:	41 89 f9             	mov    %edi,%r9d
+  80433f:	49 89 c8             	mov    %rcx,%r8
+  804342:	44 89 d1             	mov    %r10d,%ecx
+  804345:	89 c7                	mov    %eax,%edi
+  804347:	49 89 df             	mov    %rbx,%r15
+  80434a:	48 b8 89 d9 ff ff ff 	movabs $0xffffffffffffd989,%rax
+  804351:	ff ff ff 
+  804354:	48 01 d8             	add    %rbx,%rax
+  804357:	ff d0                	call   *%rax
+  804359:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  80435d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804361:	5b                   	pop    %rbx
+  804362:	41 5f                	pop    %r15
+  804364:	5d                   	pop    %rbp
+  804365:	c3                   	ret
+
+0000000000804366 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804366:	55                   	push   %rbp
+  804367:	48 89 e5             	mov    %rsp,%rbp
+  80436a:	41 57                	push   %r15
+  80436c:	53                   	push   %rbx
+  80436d:	48 83 ec 20          	sub    $0x20,%rsp
+  804371:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804371 <open+0xb>
+  804378:	49 bb cf 4c 00 00 00 	movabs $0x4ccf,%r11
+  80437f:	00 00 00 
+  804382:	4c 01 db             	add    %r11,%rbx
+  804385:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804389:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  80438c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804390:	48 89 c7             	mov    %rax,%rdi
+  804393:	49 89 df             	mov    %rbx,%r15
+  804396:	48 b8 5b 84 ff ff ff 	movabs $0xffffffffffff845b,%rax
+  80439d:	ff ff ff 
+  8043a0:	48 01 d8             	add    %rbx,%rax
+  8043a3:	ff d0                	call   *%rax
+  8043a5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043aa:	7e 0a                	jle    8043b6 <open+0x50>
+		return -E_BAD_PATH;
+  8043ac:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8043b1:	e9 18 01 00 00       	jmp    8044ce <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  8043b6:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8043ba:	48 89 c7             	mov    %rax,%rdi
+  8043bd:	49 89 df             	mov    %rbx,%r15
+  8043c0:	48 b8 5a a5 ff ff ff 	movabs $0xffffffffffffa55a,%rax
+  8043c7:	ff ff ff 
+  8043ca:	48 01 d8             	add    %rbx,%rax
+  8043cd:	ff d0                	call   *%rax
+  8043cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043d6:	74 08                	je     8043e0 <open+0x7a>
+		return r;
+  8043d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8043db:	e9 ee 00 00 00       	jmp    8044ce <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  8043e0:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8043e7:	00 00 00 
+  8043ea:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8043ed:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  8043f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043f8:	48 89 c6             	mov    %rax,%rsi
+  8043fb:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804402:	00 00 00 
+  804405:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804409:	48 89 c7             	mov    %rax,%rdi
+  80440c:	49 89 df             	mov    %rbx,%r15
+  80440f:	48 b8 ef 84 ff ff ff 	movabs $0xffffffffffff84ef,%rax
+  804416:	ff ff ff 
+  804419:	48 01 d8             	add    %rbx,%rax
+  80441c:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  80441e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804422:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804427:	48 89 c6             	mov    %rax,%rsi
+  80442a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80442f:	49 89 df             	mov    %rbx,%r15
+  804432:	48 b8 ab 91 ff ff ff 	movabs $0xffffffffffff91ab,%rax
+  804439:	ff ff ff 
+  80443c:	48 01 d8             	add    %rbx,%rax
+  80443f:	ff d0                	call   *%rax
+  804441:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804444:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804448:	74 23                	je     80446d <open+0x107>
+		fd_close(fd,0);
+  80444a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80444e:	be 00 00 00 00       	mov    $0x0,%esi
+  804453:	48 89 c7             	mov    %rax,%rdi
+  804456:	49 89 df             	mov    %rbx,%r15
+  804459:	48 b8 bb a6 ff ff ff 	movabs $0xffffffffffffa6bb,%rax
+  804460:	ff ff ff 
+  804463:	48 01 d8             	add    %rbx,%rax
+  804466:	ff d0                	call   *%rax
+		return r;
+  804468:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80446b:	eb 61                	jmp    8044ce <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  80446d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804471:	48 89 c6             	mov    %rax,%rsi
+  804474:	bf 01 00 00 00       	mov    $0x1,%edi
+  804479:	48 b8 df b0 ff ff ff 	movabs $0xffffffffffffb0df,%rax
+  804480:	ff ff ff 
+  804483:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804487:	ff d0                	call   *%rax
+  804489:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80448c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804490:	74 23                	je     8044b5 <open+0x14f>
+		fd_close(fd,0);
+  804492:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804496:	be 00 00 00 00       	mov    $0x0,%esi
+  80449b:	48 89 c7             	mov    %rax,%rdi
+  80449e:	49 89 df             	mov    %rbx,%r15
+  8044a1:	48 b8 bb a6 ff ff ff 	movabs $0xffffffffffffa6bb,%rax
+  8044a8:	ff ff ff 
+  8044ab:	48 01 d8             	add    %rbx,%rax
+  8044ae:	ff d0                	call   *%rax
+		return r;
+  8044b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044b3:	eb 19                	jmp    8044ce <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  8044b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b9:	48 89 c7             	mov    %rax,%rdi
+  8044bc:	49 89 df             	mov    %rbx,%r15
+  8044bf:	48 b8 e0 a4 ff ff ff 	movabs $0xffffffffffffa4e0,%rax
+  8044c6:	ff ff ff 
+  8044c9:	48 01 d8             	add    %rbx,%rax
+  8044cc:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  8044ce:	48 83 c4 20          	add    $0x20,%rsp
+  8044d2:	5b                   	pop    %rbx
+  8044d3:	41 5f                	pop    %r15
+  8044d5:	5d                   	pop    %rbp
+  8044d6:	c3                   	ret
+
+00000000008044d7 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  8044d7:	55                   	push   %rbp
+  8044d8:	48 89 e5             	mov    %rsp,%rbp
+  8044db:	48 83 ec 20          	sub    $0x20,%rsp
+  8044df:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8044df <devfile_flush+0x8>
+  8044e6:	49 bb 61 4b 00 00 00 	movabs $0x4b61,%r11
+  8044ed:	00 00 00 
+  8044f0:	4c 01 d8             	add    %r11,%rax
+  8044f3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  8044f7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8044fb:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8044fe:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804501:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804505:	ba 04 00 00 00       	mov    $0x4,%edx
+  80450a:	48 89 ce             	mov    %rcx,%rsi
+  80450d:	bf 06 00 00 00       	mov    $0x6,%edi
+  804512:	48 b9 87 b1 ff ff ff 	movabs $0xffffffffffffb187,%rcx
+  804519:	ff ff ff 
+  80451c:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804520:	ff d0                	call   *%rax
+}
+  804522:	c9                   	leave
+  804523:	c3                   	ret
+
+0000000000804524 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804524:	55                   	push   %rbp
+  804525:	48 89 e5             	mov    %rsp,%rbp
+  804528:	41 57                	push   %r15
+  80452a:	53                   	push   %rbx
+  80452b:	48 83 ec 60          	sub    $0x60,%rsp
+  80452f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80452f <devfile_read+0xb>
+  804536:	49 bb 11 4b 00 00 00 	movabs $0x4b11,%r11
+  80453d:	00 00 00 
+  804540:	4c 01 db             	add    %r11,%rbx
+  804543:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804547:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80454b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  80454f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804553:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804557:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80455b:	8b 50 0c             	mov    0xc(%rax),%edx
+  80455e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804562:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804564:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804568:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80456c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804570:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804574:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804579:	ba 10 00 00 00       	mov    $0x10,%edx
+  80457e:	48 89 c6             	mov    %rax,%rsi
+  804581:	bf 03 00 00 00       	mov    $0x3,%edi
+  804586:	48 b8 1b b2 ff ff ff 	movabs $0xffffffffffffb21b,%rax
+  80458d:	ff ff ff 
+  804590:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804594:	ff d0                	call   *%rax
+  804596:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804599:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80459d:	79 05                	jns    8045a4 <devfile_read+0x80>
+		return r;
+  80459f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045a2:	eb 64                	jmp    804608 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  8045a4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045a7:	48 63 d0             	movslq %eax,%rdx
+  8045aa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8045ae:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  8045b3:	48 01 c1             	add    %rax,%rcx
+  8045b6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8045ba:	48 89 ce             	mov    %rcx,%rsi
+  8045bd:	48 89 c7             	mov    %rax,%rdi
+  8045c0:	49 89 df             	mov    %rbx,%r15
+  8045c3:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  8045ca:	ff ff ff 
+  8045cd:	48 01 d8             	add    %rbx,%rax
+  8045d0:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  8045d2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8045d9:	ff ff ff 
+  8045dc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8045e0:	48 8b 00             	mov    (%rax),%rax
+  8045e3:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  8045e9:	89 c6                	mov    %eax,%esi
+  8045eb:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  8045f0:	48 89 c7             	mov    %rax,%rdi
+  8045f3:	49 89 df             	mov    %rbx,%r15
+  8045f6:	48 b8 3b dd ff ff ff 	movabs $0xffffffffffffdd3b,%rax
+  8045fd:	ff ff ff 
+  804600:	48 01 d8             	add    %rbx,%rax
+  804603:	ff d0                	call   *%rax
+	return r;
+  804605:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804608:	48 83 c4 60          	add    $0x60,%rsp
+  80460c:	5b                   	pop    %rbx
+  80460d:	41 5f                	pop    %r15
+  80460f:	5d                   	pop    %rbp
+  804610:	c3                   	ret
+
+0000000000804611 <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804611:	55                   	push   %rbp
+  804612:	48 89 e5             	mov    %rsp,%rbp
+  804615:	41 57                	push   %r15
+  804617:	53                   	push   %rbx
+  804618:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  80461c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80461c <devfile_write+0xb>
+  804623:	49 bb 24 4a 00 00 00 	movabs $0x4a24,%r11
+  80462a:	00 00 00 
+  80462d:	4c 01 db             	add    %r11,%rbx
+  804630:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804634:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804638:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  80463f:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804643:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804647:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  80464e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804652:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804659:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80465c:	48 63 d0             	movslq %eax,%rdx
+  80465f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804663:	48 39 c2             	cmp    %rax,%rdx
+  804666:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80466a:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804671:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804678:	00 
+  804679:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804680:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804684:	48 01 d0             	add    %rdx,%rax
+  804687:	48 83 e8 01          	sub    $0x1,%rax
+  80468b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80468f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804693:	ba 00 00 00 00       	mov    $0x0,%edx
+  804698:	48 f7 75 d0          	divq   -0x30(%rbp)
+  80469c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8046a0:	48 29 d0             	sub    %rdx,%rax
+  8046a3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8046a7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  8046aa:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8046ad:	89 c6                	mov    %eax,%esi
+  8046af:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8046b4:	48 89 c7             	mov    %rax,%rdi
+  8046b7:	49 89 df             	mov    %rbx,%r15
+  8046ba:	48 b8 f5 dc ff ff ff 	movabs $0xffffffffffffdcf5,%rax
+  8046c1:	ff ff ff 
+  8046c4:	48 01 d8             	add    %rbx,%rax
+  8046c7:	ff d0                	call   *%rax
+  8046c9:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  8046cc:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  8046d0:	79 08                	jns    8046da <devfile_write+0xc9>
+		return r;
+  8046d2:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8046d5:	e9 8f 00 00 00       	jmp    804769 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  8046da:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  8046e1:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  8046e5:	48 89 c6             	mov    %rax,%rsi
+  8046e8:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  8046ed:	48 89 c7             	mov    %rax,%rdi
+  8046f0:	49 89 df             	mov    %rbx,%r15
+  8046f3:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  8046fa:	ff ff ff 
+  8046fd:	48 01 d8             	add    %rbx,%rax
+  804700:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804702:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804706:	8b 50 0c             	mov    0xc(%rax),%edx
+  804709:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80470d:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  80470f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804713:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  80471a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  80471e:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804721:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804725:	89 d1                	mov    %edx,%ecx
+  804727:	ba 10 00 00 00       	mov    $0x10,%edx
+  80472c:	48 89 c6             	mov    %rax,%rsi
+  80472f:	bf 04 00 00 00       	mov    $0x4,%edi
+  804734:	48 b8 1b b2 ff ff ff 	movabs $0xffffffffffffb21b,%rax
+  80473b:	ff ff ff 
+  80473e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804742:	ff d0                	call   *%rax
+  804744:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804747:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80474a:	89 c6                	mov    %eax,%esi
+  80474c:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804751:	48 89 c7             	mov    %rax,%rdi
+  804754:	49 89 df             	mov    %rbx,%r15
+  804757:	48 b8 3b dd ff ff ff 	movabs $0xffffffffffffdd3b,%rax
+  80475e:	ff ff ff 
+  804761:	48 01 d8             	add    %rbx,%rax
+  804764:	ff d0                	call   *%rax
+	return r;
+  804766:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804769:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  80476d:	5b                   	pop    %rbx
+  80476e:	41 5f                	pop    %r15
+  804770:	5d                   	pop    %rbp
+  804771:	c3                   	ret
+
+0000000000804772 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804772:	55                   	push   %rbp
+  804773:	48 89 e5             	mov    %rsp,%rbp
+  804776:	41 57                	push   %r15
+  804778:	53                   	push   %rbx
+  804779:	48 83 ec 20          	sub    $0x20,%rsp
+  80477d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80477d <devfile_stat+0xb>
+  804784:	49 bb c3 48 00 00 00 	movabs $0x48c3,%r11
+  80478b:	00 00 00 
+  80478e:	4c 01 db             	add    %r11,%rbx
+  804791:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804795:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804799:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80479d:	8b 40 0c             	mov    0xc(%rax),%eax
+  8047a0:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8047a7:	00 00 00 
+  8047aa:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8047ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8047b2:	bf 05 00 00 00       	mov    $0x5,%edi
+  8047b7:	48 b8 df b0 ff ff ff 	movabs $0xffffffffffffb0df,%rax
+  8047be:	ff ff ff 
+  8047c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047c5:	ff d0                	call   *%rax
+  8047c7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047ce:	79 05                	jns    8047d5 <devfile_stat+0x63>
+		return r;
+  8047d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047d3:	eb 65                	jmp    80483a <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8047d5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047d9:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8047e0:	00 00 00 
+  8047e3:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8047e7:	48 89 d6             	mov    %rdx,%rsi
+  8047ea:	48 89 c7             	mov    %rax,%rdi
+  8047ed:	49 89 df             	mov    %rbx,%r15
+  8047f0:	48 b8 ef 84 ff ff ff 	movabs $0xffffffffffff84ef,%rax
+  8047f7:	ff ff ff 
+  8047fa:	48 01 d8             	add    %rbx,%rax
+  8047fd:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8047ff:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804806:	00 00 00 
+  804809:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  804810:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804814:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80481a:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804821:	00 00 00 
+  804824:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  80482b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80482f:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  804835:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80483a:	48 83 c4 20          	add    $0x20,%rsp
+  80483e:	5b                   	pop    %rbx
+  80483f:	41 5f                	pop    %r15
+  804841:	5d                   	pop    %rbp
+  804842:	c3                   	ret
+
+0000000000804843 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  804843:	55                   	push   %rbp
+  804844:	48 89 e5             	mov    %rsp,%rbp
+  804847:	48 83 ec 20          	sub    $0x20,%rsp
+  80484b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80484b <devfile_trunc+0x8>
+  804852:	49 bb f5 47 00 00 00 	movabs $0x47f5,%r11
+  804859:	00 00 00 
+  80485c:	4c 01 d8             	add    %r11,%rax
+  80485f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804863:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  804866:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80486a:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80486d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  804870:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  804873:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  804876:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80487a:	ba 08 00 00 00       	mov    $0x8,%edx
+  80487f:	48 89 ce             	mov    %rcx,%rsi
+  804882:	bf 02 00 00 00       	mov    $0x2,%edi
+  804887:	48 b9 87 b1 ff ff ff 	movabs $0xffffffffffffb187,%rcx
+  80488e:	ff ff ff 
+  804891:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804895:	ff d0                	call   *%rax
+}
+  804897:	c9                   	leave
+  804898:	c3                   	ret
+
+0000000000804899 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  804899:	55                   	push   %rbp
+  80489a:	48 89 e5             	mov    %rsp,%rbp
+  80489d:	41 57                	push   %r15
+  80489f:	53                   	push   %rbx
+  8048a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8048a4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048a4 <remove+0xb>
+  8048ab:	49 bb 9c 47 00 00 00 	movabs $0x479c,%r11
+  8048b2:	00 00 00 
+  8048b5:	4c 01 db             	add    %r11,%rbx
+  8048b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  8048bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048c0:	48 89 c7             	mov    %rax,%rdi
+  8048c3:	49 89 df             	mov    %rbx,%r15
+  8048c6:	48 b8 5b 84 ff ff ff 	movabs $0xffffffffffff845b,%rax
+  8048cd:	ff ff ff 
+  8048d0:	48 01 d8             	add    %rbx,%rax
+  8048d3:	ff d0                	call   *%rax
+  8048d5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8048da:	7e 07                	jle    8048e3 <remove+0x4a>
+		return -E_BAD_PATH;
+  8048dc:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8048e1:	eb 44                	jmp    804927 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  8048e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048e7:	48 89 c6             	mov    %rax,%rsi
+  8048ea:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8048f1:	00 00 00 
+  8048f4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048f8:	48 89 c7             	mov    %rax,%rdi
+  8048fb:	49 89 df             	mov    %rbx,%r15
+  8048fe:	48 b8 ef 84 ff ff ff 	movabs $0xffffffffffff84ef,%rax
+  804905:	ff ff ff 
+  804908:	48 01 d8             	add    %rbx,%rax
+  80490b:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  80490d:	be 00 00 00 00       	mov    $0x0,%esi
+  804912:	bf 07 00 00 00       	mov    $0x7,%edi
+  804917:	48 b8 df b0 ff ff ff 	movabs $0xffffffffffffb0df,%rax
+  80491e:	ff ff ff 
+  804921:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804925:	ff d0                	call   *%rax
+}
+  804927:	48 83 c4 10          	add    $0x10,%rsp
+  80492b:	5b                   	pop    %rbx
+  80492c:	41 5f                	pop    %r15
+  80492e:	5d                   	pop    %rbp
+  80492f:	c3                   	ret
+
+0000000000804930 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  804930:	55                   	push   %rbp
+  804931:	48 89 e5             	mov    %rsp,%rbp
+  804934:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804934 <sync+0x4>
+  80493b:	49 bb 0c 47 00 00 00 	movabs $0x470c,%r11
+  804942:	00 00 00 
+  804945:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  804948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80494d:	be 00 00 00 00       	mov    $0x0,%esi
+  804952:	bf 08 00 00 00       	mov    $0x8,%edi
+  804957:	48 b9 87 b1 ff ff ff 	movabs $0xffffffffffffb187,%rcx
+  80495e:	ff ff ff 
+  804961:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804965:	ff d0                	call   *%rax
+}
+  804967:	5d                   	pop    %rbp
+  804968:	c3                   	ret
+
+0000000000804969 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  804969:	55                   	push   %rbp
+  80496a:	48 89 e5             	mov    %rsp,%rbp
+  80496d:	41 57                	push   %r15
+  80496f:	53                   	push   %rbx
+  804970:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  804977:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804977 <copy+0xe>
+  80497e:	49 bb c9 46 00 00 00 	movabs $0x46c9,%r11
+  804985:	00 00 00 
+  804988:	4c 01 db             	add    %r11,%rbx
+  80498b:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  804992:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  804999:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8049a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8049a5:	48 89 c7             	mov    %rax,%rdi
+  8049a8:	48 b8 26 b3 ff ff ff 	movabs $0xffffffffffffb326,%rax
+  8049af:	ff ff ff 
+  8049b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049b6:	ff d0                	call   *%rax
+  8049b8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  8049bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049bf:	79 35                	jns    8049f6 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  8049c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049c4:	89 c6                	mov    %eax,%esi
+  8049c6:	48 b8 8e e5 ff ff ff 	movabs $0xffffffffffffe58e,%rax
+  8049cd:	ff ff ff 
+  8049d0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049d4:	48 89 c7             	mov    %rax,%rdi
+  8049d7:	49 89 df             	mov    %rbx,%r15
+  8049da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049df:	48 ba 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rdx
+  8049e6:	ff ff ff 
+  8049e9:	48 01 da             	add    %rbx,%rdx
+  8049ec:	ff d2                	call   *%rdx
+		return fd_src;
+  8049ee:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049f1:	e9 d7 01 00 00       	jmp    804bcd <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8049f6:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8049fd:	be 01 01 00 00       	mov    $0x101,%esi
+  804a02:	48 89 c7             	mov    %rax,%rdi
+  804a05:	48 b8 26 b3 ff ff ff 	movabs $0xffffffffffffb326,%rax
+  804a0c:	ff ff ff 
+  804a0f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a13:	ff d0                	call   *%rax
+  804a15:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  804a18:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  804a1c:	0f 89 df 00 00 00    	jns    804b01 <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  804a22:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a25:	89 c6                	mov    %eax,%esi
+  804a27:	48 b8 a4 e5 ff ff ff 	movabs $0xffffffffffffe5a4,%rax
+  804a2e:	ff ff ff 
+  804a31:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804a35:	48 89 c7             	mov    %rax,%rdi
+  804a38:	49 89 df             	mov    %rbx,%r15
+  804a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a40:	48 ba 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rdx
+  804a47:	ff ff ff 
+  804a4a:	48 01 da             	add    %rbx,%rdx
+  804a4d:	ff d2                	call   *%rdx
+		close(fd_src);
+  804a4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804a52:	89 c7                	mov    %eax,%edi
+  804a54:	49 89 df             	mov    %rbx,%r15
+  804a57:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  804a5e:	ff ff ff 
+  804a61:	48 01 d8             	add    %rbx,%rax
+  804a64:	ff d0                	call   *%rax
+		return fd_dest;
+  804a66:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a69:	e9 5f 01 00 00       	jmp    804bcd <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  804a6e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804a71:	48 63 d0             	movslq %eax,%rdx
+  804a74:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804a7b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804a7e:	48 89 ce             	mov    %rcx,%rsi
+  804a81:	89 c7                	mov    %eax,%edi
+  804a83:	49 89 df             	mov    %rbx,%r15
+  804a86:	48 b8 fd ac ff ff ff 	movabs $0xffffffffffffacfd,%rax
+  804a8d:	ff ff ff 
+  804a90:	48 01 d8             	add    %rbx,%rax
+  804a93:	ff d0                	call   *%rax
+  804a95:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  804a98:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  804a9c:	79 63                	jns    804b01 <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  804a9e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804aa1:	89 c6                	mov    %eax,%esi
+  804aa3:	48 b8 be e5 ff ff ff 	movabs $0xffffffffffffe5be,%rax
+  804aaa:	ff ff ff 
+  804aad:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804ab1:	48 89 c7             	mov    %rax,%rdi
+  804ab4:	49 89 df             	mov    %rbx,%r15
+  804ab7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804abc:	48 ba 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rdx
+  804ac3:	ff ff ff 
+  804ac6:	48 01 da             	add    %rbx,%rdx
+  804ac9:	ff d2                	call   *%rdx
+			close(fd_src);
+  804acb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ace:	89 c7                	mov    %eax,%edi
+  804ad0:	49 89 df             	mov    %rbx,%r15
+  804ad3:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  804ada:	ff ff ff 
+  804add:	48 01 d8             	add    %rbx,%rax
+  804ae0:	ff d0                	call   *%rax
+			close(fd_dest);
+  804ae2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804ae5:	89 c7                	mov    %eax,%edi
+  804ae7:	49 89 df             	mov    %rbx,%r15
+  804aea:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  804af1:	ff ff ff 
+  804af4:	48 01 d8             	add    %rbx,%rax
+  804af7:	ff d0                	call   *%rax
+			return write_size;
+  804af9:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  804afc:	e9 cc 00 00 00       	jmp    804bcd <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  804b01:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  804b08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b0b:	ba 00 02 00 00       	mov    $0x200,%edx
+  804b10:	48 89 ce             	mov    %rcx,%rsi
+  804b13:	89 c7                	mov    %eax,%edi
+  804b15:	49 89 df             	mov    %rbx,%r15
+  804b18:	48 b8 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rax
+  804b1f:	ff ff ff 
+  804b22:	48 01 d8             	add    %rbx,%rax
+  804b25:	ff d0                	call   *%rax
+  804b27:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804b2a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804b2e:	0f 8f 3a ff ff ff    	jg     804a6e <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  804b34:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804b38:	79 60                	jns    804b9a <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  804b3a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b3d:	89 c6                	mov    %eax,%esi
+  804b3f:	48 b8 d1 e5 ff ff ff 	movabs $0xffffffffffffe5d1,%rax
+  804b46:	ff ff ff 
+  804b49:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804b4d:	48 89 c7             	mov    %rax,%rdi
+  804b50:	49 89 df             	mov    %rbx,%r15
+  804b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b58:	48 ba 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rdx
+  804b5f:	ff ff ff 
+  804b62:	48 01 da             	add    %rbx,%rdx
+  804b65:	ff d2                	call   *%rdx
+		close(fd_src);
+  804b67:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b6a:	89 c7                	mov    %eax,%edi
+  804b6c:	49 89 df             	mov    %rbx,%r15
+  804b6f:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  804b76:	ff ff ff 
+  804b79:	48 01 d8             	add    %rbx,%rax
+  804b7c:	ff d0                	call   *%rax
+		close(fd_dest);
+  804b7e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b81:	89 c7                	mov    %eax,%edi
+  804b83:	49 89 df             	mov    %rbx,%r15
+  804b86:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  804b8d:	ff ff ff 
+  804b90:	48 01 d8             	add    %rbx,%rax
+  804b93:	ff d0                	call   *%rax
+		return read_size;
+  804b95:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804b98:	eb 33                	jmp    804bcd <copy+0x264>
+	}
+	close(fd_src);
+  804b9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b9d:	89 c7                	mov    %eax,%edi
+  804b9f:	49 89 df             	mov    %rbx,%r15
+  804ba2:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  804ba9:	ff ff ff 
+  804bac:	48 01 d8             	add    %rbx,%rax
+  804baf:	ff d0                	call   *%rax
+	close(fd_dest);
+  804bb1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bb4:	89 c7                	mov    %eax,%edi
+  804bb6:	49 89 df             	mov    %rbx,%r15
+  804bb9:	48 b8 9f a8 ff ff ff 	movabs $0xffffffffffffa89f,%rax
+  804bc0:	ff ff ff 
+  804bc3:	48 01 d8             	add    %rbx,%rax
+  804bc6:	ff d0                	call   *%rax
+	return 0;
+  804bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  804bcd:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  804bd4:	5b                   	pop    %rbx
+  804bd5:	41 5f                	pop    %r15
+  804bd7:	5d                   	pop    %rbp
+  804bd8:	c3                   	ret
+
+0000000000804bd9 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  804bd9:	55                   	push   %rbp
+  804bda:	48 89 e5             	mov    %rsp,%rbp
+  804bdd:	41 57                	push   %r15
+  804bdf:	53                   	push   %rbx
+  804be0:	48 83 ec 20          	sub    $0x20,%rsp
+  804be4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804be4 <fd2sockid+0xb>
+  804beb:	49 bb 5c 44 00 00 00 	movabs $0x445c,%r11
+  804bf2:	00 00 00 
+  804bf5:	4c 01 db             	add    %r11,%rbx
+  804bf8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  804bfb:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804bff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c02:	48 89 d6             	mov    %rdx,%rsi
+  804c05:	89 c7                	mov    %eax,%edi
+  804c07:	49 89 df             	mov    %rbx,%r15
+  804c0a:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  804c11:	ff ff ff 
+  804c14:	48 01 d8             	add    %rbx,%rax
+  804c17:	ff d0                	call   *%rax
+  804c19:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c1c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c20:	79 05                	jns    804c27 <fd2sockid+0x4e>
+		return r;
+  804c22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c25:	eb 25                	jmp    804c4c <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  804c27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c2b:	8b 10                	mov    (%rax),%edx
+  804c2d:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  804c34:	00 00 00 
+  804c37:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804c3a:	39 c2                	cmp    %eax,%edx
+  804c3c:	74 07                	je     804c45 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  804c3e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804c43:	eb 07                	jmp    804c4c <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  804c45:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c49:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  804c4c:	48 83 c4 20          	add    $0x20,%rsp
+  804c50:	5b                   	pop    %rbx
+  804c51:	41 5f                	pop    %r15
+  804c53:	5d                   	pop    %rbp
+  804c54:	c3                   	ret
+
+0000000000804c55 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  804c55:	55                   	push   %rbp
+  804c56:	48 89 e5             	mov    %rsp,%rbp
+  804c59:	41 57                	push   %r15
+  804c5b:	53                   	push   %rbx
+  804c5c:	48 83 ec 20          	sub    $0x20,%rsp
+  804c60:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c60 <alloc_sockfd+0xb>
+  804c67:	49 bb e0 43 00 00 00 	movabs $0x43e0,%r11
+  804c6e:	00 00 00 
+  804c71:	4c 01 db             	add    %r11,%rbx
+  804c74:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  804c77:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804c7b:	48 89 c7             	mov    %rax,%rdi
+  804c7e:	49 89 df             	mov    %rbx,%r15
+  804c81:	48 b8 5a a5 ff ff ff 	movabs $0xffffffffffffa55a,%rax
+  804c88:	ff ff ff 
+  804c8b:	48 01 d8             	add    %rbx,%rax
+  804c8e:	ff d0                	call   *%rax
+  804c90:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c93:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c97:	78 2c                	js     804cc5 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  804c99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c9d:	ba 07 04 00 00       	mov    $0x407,%edx
+  804ca2:	48 89 c6             	mov    %rax,%rsi
+  804ca5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804caa:	49 89 df             	mov    %rbx,%r15
+  804cad:	48 b8 ab 91 ff ff ff 	movabs $0xffffffffffff91ab,%rax
+  804cb4:	ff ff ff 
+  804cb7:	48 01 d8             	add    %rbx,%rax
+  804cba:	ff d0                	call   *%rax
+  804cbc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cbf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cc3:	79 1c                	jns    804ce1 <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  804cc5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804cc8:	89 c7                	mov    %eax,%edi
+  804cca:	49 89 df             	mov    %rbx,%r15
+  804ccd:	48 b8 09 c4 ff ff ff 	movabs $0xffffffffffffc409,%rax
+  804cd4:	ff ff ff 
+  804cd7:	48 01 d8             	add    %rbx,%rax
+  804cda:	ff d0                	call   *%rax
+		return r;
+  804cdc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cdf:	eb 41                	jmp    804d22 <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  804ce1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ce5:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  804cec:	00 00 00 
+  804cef:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  804cf2:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  804cf4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cf8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  804cff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d03:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804d06:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  804d09:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d0d:	48 89 c7             	mov    %rax,%rdi
+  804d10:	49 89 df             	mov    %rbx,%r15
+  804d13:	48 b8 e0 a4 ff ff ff 	movabs $0xffffffffffffa4e0,%rax
+  804d1a:	ff ff ff 
+  804d1d:	48 01 d8             	add    %rbx,%rax
+  804d20:	ff d0                	call   *%rax
+}
+  804d22:	48 83 c4 20          	add    $0x20,%rsp
+  804d26:	5b                   	pop    %rbx
+  804d27:	41 5f                	pop    %r15
+  804d29:	5d                   	pop    %rbp
+  804d2a:	c3                   	ret
+
+0000000000804d2b <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  804d2b:	55                   	push   %rbp
+  804d2c:	48 89 e5             	mov    %rsp,%rbp
+  804d2f:	41 57                	push   %r15
+  804d31:	53                   	push   %rbx
+  804d32:	48 83 ec 30          	sub    $0x30,%rsp
+  804d36:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d36 <accept+0xb>
+  804d3d:	49 bb 0a 43 00 00 00 	movabs $0x430a,%r11
+  804d44:	00 00 00 
+  804d47:	4c 01 db             	add    %r11,%rbx
+  804d4a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804d4d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804d51:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804d55:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804d58:	89 c7                	mov    %eax,%edi
+  804d5a:	48 b8 99 bb ff ff ff 	movabs $0xffffffffffffbb99,%rax
+  804d61:	ff ff ff 
+  804d64:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d68:	ff d0                	call   *%rax
+  804d6a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d6d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d71:	79 05                	jns    804d78 <accept+0x4d>
+		return r;
+  804d73:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d76:	eb 45                	jmp    804dbd <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  804d78:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d7c:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804d80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d83:	48 89 ce             	mov    %rcx,%rsi
+  804d86:	89 c7                	mov    %eax,%edi
+  804d88:	49 89 df             	mov    %rbx,%r15
+  804d8b:	48 b8 77 c2 ff ff ff 	movabs $0xffffffffffffc277,%rax
+  804d92:	ff ff ff 
+  804d95:	48 01 d8             	add    %rbx,%rax
+  804d98:	ff d0                	call   *%rax
+  804d9a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d9d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804da1:	79 05                	jns    804da8 <accept+0x7d>
+		return r;
+  804da3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804da6:	eb 15                	jmp    804dbd <accept+0x92>
+	return alloc_sockfd(r);
+  804da8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dab:	89 c7                	mov    %eax,%edi
+  804dad:	48 b8 15 bc ff ff ff 	movabs $0xffffffffffffbc15,%rax
+  804db4:	ff ff ff 
+  804db7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804dbb:	ff d0                	call   *%rax
+}
+  804dbd:	48 83 c4 30          	add    $0x30,%rsp
+  804dc1:	5b                   	pop    %rbx
+  804dc2:	41 5f                	pop    %r15
+  804dc4:	5d                   	pop    %rbp
+  804dc5:	c3                   	ret
+
+0000000000804dc6 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  804dc6:	55                   	push   %rbp
+  804dc7:	48 89 e5             	mov    %rsp,%rbp
+  804dca:	41 57                	push   %r15
+  804dcc:	53                   	push   %rbx
+  804dcd:	48 83 ec 20          	sub    $0x20,%rsp
+  804dd1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804dd1 <bind+0xb>
+  804dd8:	49 bb 6f 42 00 00 00 	movabs $0x426f,%r11
+  804ddf:	00 00 00 
+  804de2:	4c 01 db             	add    %r11,%rbx
+  804de5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804de8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804dec:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804def:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804df2:	89 c7                	mov    %eax,%edi
+  804df4:	48 b8 99 bb ff ff ff 	movabs $0xffffffffffffbb99,%rax
+  804dfb:	ff ff ff 
+  804dfe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e02:	ff d0                	call   *%rax
+  804e04:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e07:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e0b:	79 05                	jns    804e12 <bind+0x4c>
+		return r;
+  804e0d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e10:	eb 21                	jmp    804e33 <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  804e12:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804e15:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804e19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e1c:	48 89 ce             	mov    %rcx,%rsi
+  804e1f:	89 c7                	mov    %eax,%edi
+  804e21:	49 89 df             	mov    %rbx,%r15
+  804e24:	48 b8 23 c3 ff ff ff 	movabs $0xffffffffffffc323,%rax
+  804e2b:	ff ff ff 
+  804e2e:	48 01 d8             	add    %rbx,%rax
+  804e31:	ff d0                	call   *%rax
+}
+  804e33:	48 83 c4 20          	add    $0x20,%rsp
+  804e37:	5b                   	pop    %rbx
+  804e38:	41 5f                	pop    %r15
+  804e3a:	5d                   	pop    %rbp
+  804e3b:	c3                   	ret
+
+0000000000804e3c <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  804e3c:	55                   	push   %rbp
+  804e3d:	48 89 e5             	mov    %rsp,%rbp
+  804e40:	41 57                	push   %r15
+  804e42:	53                   	push   %rbx
+  804e43:	48 83 ec 20          	sub    $0x20,%rsp
+  804e47:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e47 <shutdown+0xb>
+  804e4e:	49 bb f9 41 00 00 00 	movabs $0x41f9,%r11
+  804e55:	00 00 00 
+  804e58:	4c 01 db             	add    %r11,%rbx
+  804e5b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804e5e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804e61:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e64:	89 c7                	mov    %eax,%edi
+  804e66:	48 b8 99 bb ff ff ff 	movabs $0xffffffffffffbb99,%rax
+  804e6d:	ff ff ff 
+  804e70:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e74:	ff d0                	call   *%rax
+  804e76:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804e79:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804e7d:	79 05                	jns    804e84 <shutdown+0x48>
+		return r;
+  804e7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e82:	eb 1c                	jmp    804ea0 <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  804e84:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804e87:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e8a:	89 d6                	mov    %edx,%esi
+  804e8c:	89 c7                	mov    %eax,%edi
+  804e8e:	49 89 df             	mov    %rbx,%r15
+  804e91:	48 b8 b8 c3 ff ff ff 	movabs $0xffffffffffffc3b8,%rax
+  804e98:	ff ff ff 
+  804e9b:	48 01 d8             	add    %rbx,%rax
+  804e9e:	ff d0                	call   *%rax
+}
+  804ea0:	48 83 c4 20          	add    $0x20,%rsp
+  804ea4:	5b                   	pop    %rbx
+  804ea5:	41 5f                	pop    %r15
+  804ea7:	5d                   	pop    %rbp
+  804ea8:	c3                   	ret
+
+0000000000804ea9 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  804ea9:	55                   	push   %rbp
+  804eaa:	48 89 e5             	mov    %rsp,%rbp
+  804ead:	41 57                	push   %r15
+  804eaf:	53                   	push   %rbx
+  804eb0:	48 83 ec 10          	sub    $0x10,%rsp
+  804eb4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804eb4 <devsock_close+0xb>
+  804ebb:	49 bb 8c 41 00 00 00 	movabs $0x418c,%r11
+  804ec2:	00 00 00 
+  804ec5:	4c 01 db             	add    %r11,%rbx
+  804ec8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  804ecc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed0:	48 89 c7             	mov    %rax,%rdi
+  804ed3:	49 89 df             	mov    %rbx,%r15
+  804ed6:	48 b8 10 de ff ff ff 	movabs $0xffffffffffffde10,%rax
+  804edd:	ff ff ff 
+  804ee0:	48 01 d8             	add    %rbx,%rax
+  804ee3:	ff d0                	call   *%rax
+  804ee5:	83 f8 01             	cmp    $0x1,%eax
+  804ee8:	75 1d                	jne    804f07 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  804eea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eee:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ef1:	89 c7                	mov    %eax,%edi
+  804ef3:	49 89 df             	mov    %rbx,%r15
+  804ef6:	48 b8 09 c4 ff ff ff 	movabs $0xffffffffffffc409,%rax
+  804efd:	ff ff ff 
+  804f00:	48 01 d8             	add    %rbx,%rax
+  804f03:	ff d0                	call   *%rax
+  804f05:	eb 05                	jmp    804f0c <devsock_close+0x63>
+	else
+		return 0;
+  804f07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f0c:	48 83 c4 10          	add    $0x10,%rsp
+  804f10:	5b                   	pop    %rbx
+  804f11:	41 5f                	pop    %r15
+  804f13:	5d                   	pop    %rbp
+  804f14:	c3                   	ret
+
+0000000000804f15 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  804f15:	55                   	push   %rbp
+  804f16:	48 89 e5             	mov    %rsp,%rbp
+  804f19:	41 57                	push   %r15
+  804f1b:	53                   	push   %rbx
+  804f1c:	48 83 ec 20          	sub    $0x20,%rsp
+  804f20:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f20 <connect+0xb>
+  804f27:	49 bb 20 41 00 00 00 	movabs $0x4120,%r11
+  804f2e:	00 00 00 
+  804f31:	4c 01 db             	add    %r11,%rbx
+  804f34:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804f37:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  804f3b:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804f3e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f41:	89 c7                	mov    %eax,%edi
+  804f43:	48 b8 99 bb ff ff ff 	movabs $0xffffffffffffbb99,%rax
+  804f4a:	ff ff ff 
+  804f4d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f51:	ff d0                	call   *%rax
+  804f53:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804f56:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804f5a:	79 05                	jns    804f61 <connect+0x4c>
+		return r;
+  804f5c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f5f:	eb 21                	jmp    804f82 <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  804f61:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804f64:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804f68:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f6b:	48 89 ce             	mov    %rcx,%rsi
+  804f6e:	89 c7                	mov    %eax,%edi
+  804f70:	49 89 df             	mov    %rbx,%r15
+  804f73:	48 b8 51 c4 ff ff ff 	movabs $0xffffffffffffc451,%rax
+  804f7a:	ff ff ff 
+  804f7d:	48 01 d8             	add    %rbx,%rax
+  804f80:	ff d0                	call   *%rax
+}
+  804f82:	48 83 c4 20          	add    $0x20,%rsp
+  804f86:	5b                   	pop    %rbx
+  804f87:	41 5f                	pop    %r15
+  804f89:	5d                   	pop    %rbp
+  804f8a:	c3                   	ret
+
+0000000000804f8b <listen>:
+
+int
+listen(int s, int backlog)
+{
+  804f8b:	55                   	push   %rbp
+  804f8c:	48 89 e5             	mov    %rsp,%rbp
+  804f8f:	41 57                	push   %r15
+  804f91:	53                   	push   %rbx
+  804f92:	48 83 ec 20          	sub    $0x20,%rsp
+  804f96:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804f96 <listen+0xb>
+  804f9d:	49 bb aa 40 00 00 00 	movabs $0x40aa,%r11
+  804fa4:	00 00 00 
+  804fa7:	4c 01 db             	add    %r11,%rbx
+  804faa:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804fad:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  804fb0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fb3:	89 c7                	mov    %eax,%edi
+  804fb5:	48 b8 99 bb ff ff ff 	movabs $0xffffffffffffbb99,%rax
+  804fbc:	ff ff ff 
+  804fbf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fc3:	ff d0                	call   *%rax
+  804fc5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804fc8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804fcc:	79 05                	jns    804fd3 <listen+0x48>
+		return r;
+  804fce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fd1:	eb 1c                	jmp    804fef <listen+0x64>
+	return nsipc_listen(r, backlog);
+  804fd3:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  804fd6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804fd9:	89 d6                	mov    %edx,%esi
+  804fdb:	89 c7                	mov    %eax,%edi
+  804fdd:	49 89 df             	mov    %rbx,%r15
+  804fe0:	48 b8 e6 c4 ff ff ff 	movabs $0xffffffffffffc4e6,%rax
+  804fe7:	ff ff ff 
+  804fea:	48 01 d8             	add    %rbx,%rax
+  804fed:	ff d0                	call   *%rax
+}
+  804fef:	48 83 c4 20          	add    $0x20,%rsp
+  804ff3:	5b                   	pop    %rbx
+  804ff4:	41 5f                	pop    %r15
+  804ff6:	5d                   	pop    %rbp
+  804ff7:	c3                   	ret
+
+0000000000804ff8 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  804ff8:	55                   	push   %rbp
+  804ff9:	48 89 e5             	mov    %rsp,%rbp
+  804ffc:	41 57                	push   %r15
+  804ffe:	48 83 ec 28          	sub    $0x28,%rsp
+  805002:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805002 <devsock_read+0xa>
+  805009:	49 bb 3e 40 00 00 00 	movabs $0x403e,%r11
+  805010:	00 00 00 
+  805013:	4c 01 d8             	add    %r11,%rax
+  805016:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80501a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80501e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  805022:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805026:	41 89 d0             	mov    %edx,%r8d
+  805029:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80502d:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805030:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805034:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805039:	44 89 c2             	mov    %r8d,%edx
+  80503c:	49 89 c7             	mov    %rax,%r15
+  80503f:	49 b8 37 c5 ff ff ff 	movabs $0xffffffffffffc537,%r8
+  805046:	ff ff ff 
+  805049:	49 01 c0             	add    %rax,%r8
+  80504c:	41 ff d0             	call   *%r8
+}
+  80504f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805053:	c9                   	leave
+  805054:	c3                   	ret
+
+0000000000805055 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805055:	55                   	push   %rbp
+  805056:	48 89 e5             	mov    %rsp,%rbp
+  805059:	41 57                	push   %r15
+  80505b:	48 83 ec 28          	sub    $0x28,%rsp
+  80505f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80505f <devsock_write+0xa>
+  805066:	49 bb e1 3f 00 00 00 	movabs $0x3fe1,%r11
+  80506d:	00 00 00 
+  805070:	4c 01 d8             	add    %r11,%rax
+  805073:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805077:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80507b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80507f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805083:	41 89 d0             	mov    %edx,%r8d
+  805086:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80508a:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80508d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805091:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805096:	44 89 c2             	mov    %r8d,%edx
+  805099:	49 89 c7             	mov    %rax,%r15
+  80509c:	49 b8 54 c6 ff ff ff 	movabs $0xffffffffffffc654,%r8
+  8050a3:	ff ff ff 
+  8050a6:	49 01 c0             	add    %rax,%r8
+  8050a9:	41 ff d0             	call   *%r8
+}
+  8050ac:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8050b0:	c9                   	leave
+  8050b1:	c3                   	ret
+
+00000000008050b2 <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8050b2:	55                   	push   %rbp
+  8050b3:	48 89 e5             	mov    %rsp,%rbp
+  8050b6:	41 57                	push   %r15
+  8050b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8050bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050bc <devsock_stat+0xa>
+  8050c3:	49 bb 84 3f 00 00 00 	movabs $0x3f84,%r11
+  8050ca:	00 00 00 
+  8050cd:	4c 01 d8             	add    %r11,%rax
+  8050d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8050d4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  8050d8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8050dc:	48 b9 ec e5 ff ff ff 	movabs $0xffffffffffffe5ec,%rcx
+  8050e3:	ff ff ff 
+  8050e6:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8050ea:	48 89 ce             	mov    %rcx,%rsi
+  8050ed:	48 89 d7             	mov    %rdx,%rdi
+  8050f0:	49 89 c7             	mov    %rax,%r15
+  8050f3:	48 ba ef 84 ff ff ff 	movabs $0xffffffffffff84ef,%rdx
+  8050fa:	ff ff ff 
+  8050fd:	48 01 c2             	add    %rax,%rdx
+  805100:	ff d2                	call   *%rdx
+	return 0;
+  805102:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805107:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80510b:	c9                   	leave
+  80510c:	c3                   	ret
+
+000000000080510d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80510d:	55                   	push   %rbp
+  80510e:	48 89 e5             	mov    %rsp,%rbp
+  805111:	41 57                	push   %r15
+  805113:	53                   	push   %rbx
+  805114:	48 83 ec 20          	sub    $0x20,%rsp
+  805118:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805118 <socket+0xb>
+  80511f:	49 bb 28 3f 00 00 00 	movabs $0x3f28,%r11
+  805126:	00 00 00 
+  805129:	4c 01 db             	add    %r11,%rbx
+  80512c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80512f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  805132:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805135:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805138:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  80513b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80513e:	89 ce                	mov    %ecx,%esi
+  805140:	89 c7                	mov    %eax,%edi
+  805142:	49 89 df             	mov    %rbx,%r15
+  805145:	48 b8 2b c8 ff ff ff 	movabs $0xffffffffffffc82b,%rax
+  80514c:	ff ff ff 
+  80514f:	48 01 d8             	add    %rbx,%rax
+  805152:	ff d0                	call   *%rax
+  805154:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805157:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80515b:	79 05                	jns    805162 <socket+0x55>
+		return r;
+  80515d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805160:	eb 15                	jmp    805177 <socket+0x6a>
+	return alloc_sockfd(r);
+  805162:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805165:	89 c7                	mov    %eax,%edi
+  805167:	48 b8 15 bc ff ff ff 	movabs $0xffffffffffffbc15,%rax
+  80516e:	ff ff ff 
+  805171:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805175:	ff d0                	call   *%rax
+}
+  805177:	48 83 c4 20          	add    $0x20,%rsp
+  80517b:	5b                   	pop    %rbx
+  80517c:	41 5f                	pop    %r15
+  80517e:	5d                   	pop    %rbp
+  80517f:	c3                   	ret
+
+0000000000805180 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805180:	55                   	push   %rbp
+  805181:	48 89 e5             	mov    %rsp,%rbp
+  805184:	41 57                	push   %r15
+  805186:	53                   	push   %rbx
+  805187:	48 83 ec 10          	sub    $0x10,%rsp
+  80518b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80518b <nsipc+0xb>
+  805192:	49 bb b5 3e 00 00 00 	movabs $0x3eb5,%r11
+  805199:	00 00 00 
+  80519c:	4c 01 db             	add    %r11,%rbx
+  80519f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8051a2:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8051a9:	00 00 00 
+  8051ac:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8051af:	85 c0                	test   %eax,%eax
+  8051b1:	75 24                	jne    8051d7 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8051b3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8051b8:	49 89 df             	mov    %rbx,%r15
+  8051bb:	48 b8 81 dd ff ff ff 	movabs $0xffffffffffffdd81,%rax
+  8051c2:	ff ff ff 
+  8051c5:	48 01 d8             	add    %rbx,%rax
+  8051c8:	ff d0                	call   *%rax
+  8051ca:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  8051d1:	00 00 00 
+  8051d4:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  8051d7:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8051de:	00 00 00 
+  8051e1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8051e4:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8051e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8051ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8051f3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8051f8:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8051ff:	00 00 00 
+  805202:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805206:	89 c7                	mov    %eax,%edi
+  805208:	49 89 df             	mov    %rbx,%r15
+  80520b:	48 b8 a0 d7 ff ff ff 	movabs $0xffffffffffffd7a0,%rax
+  805212:	ff ff ff 
+  805215:	48 01 d8             	add    %rbx,%rax
+  805218:	ff d0                	call   *%rax
+}
+  80521a:	48 83 c4 10          	add    $0x10,%rsp
+  80521e:	5b                   	pop    %rbx
+  80521f:	41 5f                	pop    %r15
+  805221:	5d                   	pop    %rbp
+  805222:	c3                   	ret
+
+0000000000805223 <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805223:	55                   	push   %rbp
+  805224:	48 89 e5             	mov    %rsp,%rbp
+  805227:	41 57                	push   %r15
+  805229:	53                   	push   %rbx
+  80522a:	48 83 ec 20          	sub    $0x20,%rsp
+  80522e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80522e <nsipc_words+0xb>
+  805235:	49 bb 12 3e 00 00 00 	movabs $0x3e12,%r11
+  80523c:	00 00 00 
+  80523f:	4c 01 db             	add    %r11,%rbx
+  805242:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805245:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805249:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  80524d:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805254:	00 00 00 
+  805257:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80525a:	85 c0                	test   %eax,%eax
+  80525c:	75 24                	jne    805282 <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80525e:	bf 02 00 00 00       	mov    $0x2,%edi
+  805263:	49 89 df             	mov    %rbx,%r15
+  805266:	48 b8 81 dd ff ff ff 	movabs $0xffffffffffffdd81,%rax
+  80526d:	ff ff ff 
+  805270:	48 01 d8             	add    %rbx,%rax
+  805273:	ff d0                	call   *%rax
+  805275:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  80527c:	00 00 00 
+  80527f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805282:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805289:	00 00 00 
+  80528c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80528f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805293:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805297:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  80529a:	89 c7                	mov    %eax,%edi
+  80529c:	49 89 df             	mov    %rbx,%r15
+  80529f:	48 b8 8b d8 ff ff ff 	movabs $0xffffffffffffd88b,%rax
+  8052a6:	ff ff ff 
+  8052a9:	48 01 d8             	add    %rbx,%rax
+  8052ac:	ff d0                	call   *%rax
+}
+  8052ae:	48 83 c4 20          	add    $0x20,%rsp
+  8052b2:	5b                   	pop    %rbx
+  8052b3:	41 5f                	pop    %r15
+  8052b5:	5d                   	pop    %rbp
+  8052b6:	c3                   	ret
+
+00000000008052b7 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8052b7:	55                   	push   %rbp
+  8052b8:	48 89 e5             	mov    %rsp,%rbp
+  8052bb:	41 57                	push   %r15
+  8052bd:	53                   	push   %rbx
+  8052be:	48 83 ec 30          	sub    $0x30,%rsp
+  8052c2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8052c2 <nsipc_accept+0xb>
+  8052c9:	49 bb 7e 3d 00 00 00 	movabs $0x3d7e,%r11
+  8052d0:	00 00 00 
+  8052d3:	4c 01 db             	add    %r11,%rbx
+  8052d6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8052d9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8052dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8052e1:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8052e8:	00 00 00 
+  8052eb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8052ee:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8052f1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8052f6:	48 b8 40 c1 ff ff ff 	movabs $0xffffffffffffc140,%rax
+  8052fd:	ff ff ff 
+  805300:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805304:	ff d0                	call   *%rax
+  805306:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805309:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80530d:	78 48                	js     805357 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  80530f:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805316:	00 00 00 
+  805319:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80531d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805321:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805325:	8b 40 10             	mov    0x10(%rax),%eax
+  805328:	89 c2                	mov    %eax,%edx
+  80532a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80532e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805332:	48 89 ce             	mov    %rcx,%rsi
+  805335:	48 89 c7             	mov    %rax,%rdi
+  805338:	49 89 df             	mov    %rbx,%r15
+  80533b:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  805342:	ff ff ff 
+  805345:	48 01 d8             	add    %rbx,%rax
+  805348:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  80534a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80534e:	8b 50 10             	mov    0x10(%rax),%edx
+  805351:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805355:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805357:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80535a:	48 83 c4 30          	add    $0x30,%rsp
+  80535e:	5b                   	pop    %rbx
+  80535f:	41 5f                	pop    %r15
+  805361:	5d                   	pop    %rbp
+  805362:	c3                   	ret
+
+0000000000805363 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805363:	55                   	push   %rbp
+  805364:	48 89 e5             	mov    %rsp,%rbp
+  805367:	41 57                	push   %r15
+  805369:	53                   	push   %rbx
+  80536a:	48 83 ec 10          	sub    $0x10,%rsp
+  80536e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80536e <nsipc_bind+0xb>
+  805375:	49 bb d2 3c 00 00 00 	movabs $0x3cd2,%r11
+  80537c:	00 00 00 
+  80537f:	4c 01 db             	add    %r11,%rbx
+  805382:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805385:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805389:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  80538c:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805393:	00 00 00 
+  805396:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805399:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80539c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80539f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053a3:	48 89 c6             	mov    %rax,%rsi
+  8053a6:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  8053ad:	00 00 00 
+  8053b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053b4:	48 89 c7             	mov    %rax,%rdi
+  8053b7:	49 89 df             	mov    %rbx,%r15
+  8053ba:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  8053c1:	ff ff ff 
+  8053c4:	48 01 d8             	add    %rbx,%rax
+  8053c7:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  8053c9:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8053d0:	00 00 00 
+  8053d3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053d6:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  8053da:	bf 02 00 00 00       	mov    $0x2,%edi
+  8053df:	48 b8 40 c1 ff ff ff 	movabs $0xffffffffffffc140,%rax
+  8053e6:	ff ff ff 
+  8053e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053ed:	ff d0                	call   *%rax
+}
+  8053ef:	48 83 c4 10          	add    $0x10,%rsp
+  8053f3:	5b                   	pop    %rbx
+  8053f4:	41 5f                	pop    %r15
+  8053f6:	5d                   	pop    %rbp
+  8053f7:	c3                   	ret
+
+00000000008053f8 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8053f8:	55                   	push   %rbp
+  8053f9:	48 89 e5             	mov    %rsp,%rbp
+  8053fc:	48 83 ec 20          	sub    $0x20,%rsp
+  805400:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805400 <nsipc_shutdown+0x8>
+  805407:	49 bb 40 3c 00 00 00 	movabs $0x3c40,%r11
+  80540e:	00 00 00 
+  805411:	4c 01 d8             	add    %r11,%rax
+  805414:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805417:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  80541a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80541d:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805420:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805423:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805426:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  80542a:	ba 08 00 00 00       	mov    $0x8,%edx
+  80542f:	48 89 ce             	mov    %rcx,%rsi
+  805432:	bf 03 00 00 00       	mov    $0x3,%edi
+  805437:	48 b9 e3 c1 ff ff ff 	movabs $0xffffffffffffc1e3,%rcx
+  80543e:	ff ff ff 
+  805441:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805445:	ff d0                	call   *%rax
+}
+  805447:	c9                   	leave
+  805448:	c3                   	ret
+
+0000000000805449 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805449:	55                   	push   %rbp
+  80544a:	48 89 e5             	mov    %rsp,%rbp
+  80544d:	48 83 ec 20          	sub    $0x20,%rsp
+  805451:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805451 <nsipc_close+0x8>
+  805458:	49 bb ef 3b 00 00 00 	movabs $0x3bef,%r11
+  80545f:	00 00 00 
+  805462:	4c 01 d8             	add    %r11,%rax
+  805465:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805468:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80546b:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  80546e:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805472:	ba 04 00 00 00       	mov    $0x4,%edx
+  805477:	48 89 ce             	mov    %rcx,%rsi
+  80547a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80547f:	48 b9 e3 c1 ff ff ff 	movabs $0xffffffffffffc1e3,%rcx
+  805486:	ff ff ff 
+  805489:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  80548d:	ff d0                	call   *%rax
+}
+  80548f:	c9                   	leave
+  805490:	c3                   	ret
+
+0000000000805491 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805491:	55                   	push   %rbp
+  805492:	48 89 e5             	mov    %rsp,%rbp
+  805495:	41 57                	push   %r15
+  805497:	53                   	push   %rbx
+  805498:	48 83 ec 10          	sub    $0x10,%rsp
+  80549c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80549c <nsipc_connect+0xb>
+  8054a3:	49 bb a4 3b 00 00 00 	movabs $0x3ba4,%r11
+  8054aa:	00 00 00 
+  8054ad:	4c 01 db             	add    %r11,%rbx
+  8054b0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8054b3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8054b7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  8054ba:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8054c1:	00 00 00 
+  8054c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054c7:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8054ca:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8054cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054d1:	48 89 c6             	mov    %rax,%rsi
+  8054d4:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  8054db:	00 00 00 
+  8054de:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8054e2:	48 89 c7             	mov    %rax,%rdi
+  8054e5:	49 89 df             	mov    %rbx,%r15
+  8054e8:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  8054ef:	ff ff ff 
+  8054f2:	48 01 d8             	add    %rbx,%rax
+  8054f5:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  8054f7:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8054fe:	00 00 00 
+  805501:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805504:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805508:	bf 05 00 00 00       	mov    $0x5,%edi
+  80550d:	48 b8 40 c1 ff ff ff 	movabs $0xffffffffffffc140,%rax
+  805514:	ff ff ff 
+  805517:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80551b:	ff d0                	call   *%rax
+}
+  80551d:	48 83 c4 10          	add    $0x10,%rsp
+  805521:	5b                   	pop    %rbx
+  805522:	41 5f                	pop    %r15
+  805524:	5d                   	pop    %rbp
+  805525:	c3                   	ret
+
+0000000000805526 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805526:	55                   	push   %rbp
+  805527:	48 89 e5             	mov    %rsp,%rbp
+  80552a:	48 83 ec 20          	sub    $0x20,%rsp
+  80552e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80552e <nsipc_listen+0x8>
+  805535:	49 bb 12 3b 00 00 00 	movabs $0x3b12,%r11
+  80553c:	00 00 00 
+  80553f:	4c 01 d8             	add    %r11,%rax
+  805542:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805545:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805548:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80554b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  80554e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805551:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805554:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805558:	ba 08 00 00 00       	mov    $0x8,%edx
+  80555d:	48 89 ce             	mov    %rcx,%rsi
+  805560:	bf 06 00 00 00       	mov    $0x6,%edi
+  805565:	48 b9 e3 c1 ff ff ff 	movabs $0xffffffffffffc1e3,%rcx
+  80556c:	ff ff ff 
+  80556f:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805573:	ff d0                	call   *%rax
+}
+  805575:	c9                   	leave
+  805576:	c3                   	ret
+
+0000000000805577 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805577:	55                   	push   %rbp
+  805578:	48 89 e5             	mov    %rsp,%rbp
+  80557b:	41 57                	push   %r15
+  80557d:	53                   	push   %rbx
+  80557e:	48 83 ec 30          	sub    $0x30,%rsp
+  805582:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805582 <nsipc_recv+0xb>
+  805589:	49 bb be 3a 00 00 00 	movabs $0x3abe,%r11
+  805590:	00 00 00 
+  805593:	4c 01 db             	add    %r11,%rbx
+  805596:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805599:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80559d:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  8055a0:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8055a3:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8055aa:	00 00 00 
+  8055ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8055b0:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  8055b3:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8055ba:	00 00 00 
+  8055bd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8055c0:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  8055c4:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  8055cb:	00 00 00 
+  8055ce:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8055d1:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8055d5:	bf 07 00 00 00       	mov    $0x7,%edi
+  8055da:	48 b8 40 c1 ff ff ff 	movabs $0xffffffffffffc140,%rax
+  8055e1:	ff ff ff 
+  8055e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055e8:	ff d0                	call   *%rax
+  8055ea:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055ed:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055f1:	0f 88 91 00 00 00    	js     805688 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  8055f7:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  8055fe:	7f 08                	jg     805608 <nsipc_recv+0x91>
+  805600:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805603:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805606:	7e 50                	jle    805658 <nsipc_recv+0xe1>
+  805608:	48 b8 f3 e5 ff ff ff 	movabs $0xffffffffffffe5f3,%rax
+  80560f:	ff ff ff 
+  805612:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805616:	48 89 c1             	mov    %rax,%rcx
+  805619:	48 b8 08 e6 ff ff ff 	movabs $0xffffffffffffe608,%rax
+  805620:	ff ff ff 
+  805623:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805627:	48 89 c2             	mov    %rax,%rdx
+  80562a:	be 79 00 00 00       	mov    $0x79,%esi
+  80562f:	48 b8 1d e6 ff ff ff 	movabs $0xffffffffffffe61d,%rax
+  805636:	ff ff ff 
+  805639:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80563d:	48 89 c7             	mov    %rax,%rdi
+  805640:	49 89 df             	mov    %rbx,%r15
+  805643:	b8 00 00 00 00       	mov    $0x0,%eax
+  805648:	49 b8 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r8
+  80564f:	ff ff ff 
+  805652:	49 01 d8             	add    %rbx,%r8
+  805655:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805658:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80565b:	48 63 d0             	movslq %eax,%rdx
+  80565e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805662:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805669:	00 00 00 
+  80566c:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805670:	48 89 ce             	mov    %rcx,%rsi
+  805673:	48 89 c7             	mov    %rax,%rdi
+  805676:	49 89 df             	mov    %rbx,%r15
+  805679:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  805680:	ff ff ff 
+  805683:	48 01 d8             	add    %rbx,%rax
+  805686:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805688:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80568b:	48 83 c4 30          	add    $0x30,%rsp
+  80568f:	5b                   	pop    %rbx
+  805690:	41 5f                	pop    %r15
+  805692:	5d                   	pop    %rbp
+  805693:	c3                   	ret
+
+0000000000805694 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805694:	55                   	push   %rbp
+  805695:	48 89 e5             	mov    %rsp,%rbp
+  805698:	41 57                	push   %r15
+  80569a:	53                   	push   %rbx
+  80569b:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  8056a2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056a2 <nsipc_send+0xe>
+  8056a9:	49 bb 9e 39 00 00 00 	movabs $0x399e,%r11
+  8056b0:	00 00 00 
+  8056b3:	4c 01 db             	add    %r11,%rbx
+  8056b6:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  8056bc:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  8056c3:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  8056c9:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  8056cf:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8056d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  8056d7:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8056de:	00 00 00 
+  8056e1:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8056e4:	85 c0                	test   %eax,%eax
+  8056e6:	75 24                	jne    80570c <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8056e8:	bf 02 00 00 00       	mov    $0x2,%edi
+  8056ed:	49 89 df             	mov    %rbx,%r15
+  8056f0:	48 b8 81 dd ff ff ff 	movabs $0xffffffffffffdd81,%rax
+  8056f7:	ff ff ff 
+  8056fa:	48 01 d8             	add    %rbx,%rax
+  8056fd:	ff d0                	call   *%rax
+  8056ff:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805706:	00 00 00 
+  805709:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  80570c:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805712:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805715:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  80571c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80571f:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805722:	39 c2                	cmp    %eax,%edx
+  805724:	0f 4e c2             	cmovle %edx,%eax
+  805727:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  80572d:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805733:	48 63 d0             	movslq %eax,%rdx
+  805736:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  80573d:	48 89 c6             	mov    %rax,%rsi
+  805740:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805747:	00 00 00 
+  80574a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80574e:	48 89 c7             	mov    %rax,%rdi
+  805751:	49 89 df             	mov    %rbx,%r15
+  805754:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  80575b:	ff ff ff 
+  80575e:	48 01 d8             	add    %rbx,%rax
+  805761:	ff d0                	call   *%rax
+	req->req_s = s;
+  805763:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805767:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80576d:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80576f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805773:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805779:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  80577c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805780:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805786:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805789:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805790:	00 00 00 
+  805793:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805797:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  80579b:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8057a2:	00 
+  8057a3:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  8057a9:	48 63 d0             	movslq %eax,%rdx
+  8057ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057b0:	48 01 d0             	add    %rdx,%rax
+  8057b3:	48 83 e8 01          	sub    $0x1,%rax
+  8057b7:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8057bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057c4:	48 f7 75 d8          	divq   -0x28(%rbp)
+  8057c8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057cc:	48 29 d0             	sub    %rdx,%rax
+  8057cf:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  8057d5:	85 c0                	test   %eax,%eax
+  8057d7:	0f 48 c2             	cmovs  %edx,%eax
+  8057da:	c1 f8 0c             	sar    $0xc,%eax
+  8057dd:	48 98                	cltq
+  8057df:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  8057e3:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8057e7:	48 85 c0             	test   %rax,%rax
+  8057ea:	0f 95 c0             	setne  %al
+  8057ed:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  8057f0:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8057f7:	00 
+  8057f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8057fc:	48 83 c0 0b          	add    $0xb,%rax
+  805800:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805804:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805808:	ba 00 00 00 00       	mov    $0x0,%edx
+  80580d:	48 f7 75 c8          	divq   -0x38(%rbp)
+  805811:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805815:	48 29 d0             	sub    %rdx,%rax
+  805818:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  80581c:	89 c7                	mov    %eax,%edi
+  80581e:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805825:	00 00 00 
+  805828:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80582b:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80582f:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  805833:	48 83 ec 08          	sub    $0x8,%rsp
+  805837:	6a 00                	push   $0x0
+  805839:	6a 00                	push   $0x0
+  80583b:	6a 05                	push   $0x5
+  80583d:	41 89 f1             	mov    %esi,%r9d
+  805840:	49 89 c8             	mov    %rcx,%r8
+  805843:	89 f9                	mov    %edi,%ecx
+  805845:	be 08 00 00 00       	mov    $0x8,%esi
+  80584a:	89 c7                	mov    %eax,%edi
+  80584c:	49 89 df             	mov    %rbx,%r15
+  80584f:	48 b8 89 d9 ff ff ff 	movabs $0xffffffffffffd989,%rax
+  805856:	ff ff ff 
+  805859:	48 01 d8             	add    %rbx,%rax
+  80585c:	ff d0                	call   *%rax
+  80585e:	48 83 c4 20          	add    $0x20,%rsp
+}
+  805862:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805866:	5b                   	pop    %rbx
+  805867:	41 5f                	pop    %r15
+  805869:	5d                   	pop    %rbp
+  80586a:	c3                   	ret
+
+000000000080586b <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80586b:	55                   	push   %rbp
+  80586c:	48 89 e5             	mov    %rsp,%rbp
+  80586f:	48 83 ec 10          	sub    $0x10,%rsp
+  805873:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805873 <nsipc_socket+0x8>
+  80587a:	49 bb cd 37 00 00 00 	movabs $0x37cd,%r11
+  805881:	00 00 00 
+  805884:	4c 01 d8             	add    %r11,%rax
+  805887:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80588a:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  80588d:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  805890:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805897:	00 00 00 
+  80589a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80589d:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8058a0:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8058a7:	00 00 00 
+  8058aa:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8058ad:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8058b1:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8058b8:	00 00 00 
+  8058bb:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8058be:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  8058c2:	bf 09 00 00 00       	mov    $0x9,%edi
+  8058c7:	48 ba 40 c1 ff ff ff 	movabs $0xffffffffffffc140,%rdx
+  8058ce:	ff ff ff 
+  8058d1:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8058d5:	ff d0                	call   *%rax
+}
+  8058d7:	c9                   	leave
+  8058d8:	c3                   	ret
+
+00000000008058d9 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  8058d9:	55                   	push   %rbp
+  8058da:	48 89 e5             	mov    %rsp,%rbp
+  8058dd:	41 57                	push   %r15
+  8058df:	53                   	push   %rbx
+  8058e0:	48 83 ec 30          	sub    $0x30,%rsp
+  8058e4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8058e4 <pipe+0xb>
+  8058eb:	49 bb 5c 37 00 00 00 	movabs $0x375c,%r11
+  8058f2:	00 00 00 
+  8058f5:	4c 01 db             	add    %r11,%rbx
+  8058f8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8058fc:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  805900:	48 89 c7             	mov    %rax,%rdi
+  805903:	49 89 df             	mov    %rbx,%r15
+  805906:	48 b8 5a a5 ff ff ff 	movabs $0xffffffffffffa55a,%rax
+  80590d:	ff ff ff 
+  805910:	48 01 d8             	add    %rbx,%rax
+  805913:	ff d0                	call   *%rax
+  805915:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805918:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80591c:	0f 88 12 02 00 00    	js     805b34 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805922:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805926:	ba 07 04 00 00       	mov    $0x407,%edx
+  80592b:	48 89 c6             	mov    %rax,%rsi
+  80592e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805933:	49 89 df             	mov    %rbx,%r15
+  805936:	48 b8 ab 91 ff ff ff 	movabs $0xffffffffffff91ab,%rax
+  80593d:	ff ff ff 
+  805940:	48 01 d8             	add    %rbx,%rax
+  805943:	ff d0                	call   *%rax
+  805945:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805948:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80594c:	0f 88 e2 01 00 00    	js     805b34 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  805952:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805956:	48 89 c7             	mov    %rax,%rdi
+  805959:	49 89 df             	mov    %rbx,%r15
+  80595c:	48 b8 5a a5 ff ff ff 	movabs $0xffffffffffffa55a,%rax
+  805963:	ff ff ff 
+  805966:	48 01 d8             	add    %rbx,%rax
+  805969:	ff d0                	call   *%rax
+  80596b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80596e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805972:	0f 88 9b 01 00 00    	js     805b13 <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  805978:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80597c:	ba 07 04 00 00       	mov    $0x407,%edx
+  805981:	48 89 c6             	mov    %rax,%rsi
+  805984:	bf 00 00 00 00       	mov    $0x0,%edi
+  805989:	49 89 df             	mov    %rbx,%r15
+  80598c:	48 b8 ab 91 ff ff ff 	movabs $0xffffffffffff91ab,%rax
+  805993:	ff ff ff 
+  805996:	48 01 d8             	add    %rbx,%rax
+  805999:	ff d0                	call   *%rax
+  80599b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80599e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059a2:	0f 88 6b 01 00 00    	js     805b13 <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8059a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059ac:	48 89 c7             	mov    %rax,%rdi
+  8059af:	49 89 df             	mov    %rbx,%r15
+  8059b2:	48 b8 17 a5 ff ff ff 	movabs $0xffffffffffffa517,%rax
+  8059b9:	ff ff ff 
+  8059bc:	48 01 d8             	add    %rbx,%rax
+  8059bf:	ff d0                	call   *%rax
+  8059c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8059c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8059c9:	ba 07 04 00 00       	mov    $0x407,%edx
+  8059ce:	48 89 c6             	mov    %rax,%rsi
+  8059d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059d6:	49 89 df             	mov    %rbx,%r15
+  8059d9:	48 b8 ab 91 ff ff ff 	movabs $0xffffffffffff91ab,%rax
+  8059e0:	ff ff ff 
+  8059e3:	48 01 d8             	add    %rbx,%rax
+  8059e6:	ff d0                	call   *%rax
+  8059e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059ef:	0f 88 fd 00 00 00    	js     805af2 <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8059f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059f9:	48 89 c7             	mov    %rax,%rdi
+  8059fc:	49 89 df             	mov    %rbx,%r15
+  8059ff:	48 b8 17 a5 ff ff ff 	movabs $0xffffffffffffa517,%rax
+  805a06:	ff ff ff 
+  805a09:	48 01 d8             	add    %rbx,%rax
+  805a0c:	ff d0                	call   *%rax
+  805a0e:	48 89 c2             	mov    %rax,%rdx
+  805a11:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a15:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805a1b:	48 89 d1             	mov    %rdx,%rcx
+  805a1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a23:	48 89 c6             	mov    %rax,%rsi
+  805a26:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a2b:	49 89 df             	mov    %rbx,%r15
+  805a2e:	48 b8 10 92 ff ff ff 	movabs $0xffffffffffff9210,%rax
+  805a35:	ff ff ff 
+  805a38:	48 01 d8             	add    %rbx,%rax
+  805a3b:	ff d0                	call   *%rax
+  805a3d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a40:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a44:	0f 88 87 00 00 00    	js     805ad1 <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  805a4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a4e:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805a55:	00 00 00 
+  805a58:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805a5b:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  805a5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a61:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  805a68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a6c:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805a73:	00 00 00 
+  805a76:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  805a79:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  805a7b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a7f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  805a86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a8a:	48 89 c7             	mov    %rax,%rdi
+  805a8d:	49 89 df             	mov    %rbx,%r15
+  805a90:	48 b8 e0 a4 ff ff ff 	movabs $0xffffffffffffa4e0,%rax
+  805a97:	ff ff ff 
+  805a9a:	48 01 d8             	add    %rbx,%rax
+  805a9d:	ff d0                	call   *%rax
+  805a9f:	89 c2                	mov    %eax,%edx
+  805aa1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805aa5:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  805aa7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805aab:	48 89 c7             	mov    %rax,%rdi
+  805aae:	49 89 df             	mov    %rbx,%r15
+  805ab1:	48 b8 e0 a4 ff ff ff 	movabs $0xffffffffffffa4e0,%rax
+  805ab8:	ff ff ff 
+  805abb:	48 01 d8             	add    %rbx,%rax
+  805abe:	ff d0                	call   *%rax
+  805ac0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805ac4:	48 83 c2 04          	add    $0x4,%rdx
+  805ac8:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  805aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  805acf:	eb 67                	jmp    805b38 <pipe+0x25f>
+		goto err3;
+  805ad1:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  805ad2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ad6:	48 89 c6             	mov    %rax,%rsi
+  805ad9:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ade:	49 89 df             	mov    %rbx,%r15
+  805ae1:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  805ae8:	ff ff ff 
+  805aeb:	48 01 d8             	add    %rbx,%rax
+  805aee:	ff d0                	call   *%rax
+  805af0:	eb 01                	jmp    805af3 <pipe+0x21a>
+		goto err2;
+  805af2:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  805af3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805af7:	48 89 c6             	mov    %rax,%rsi
+  805afa:	bf 00 00 00 00       	mov    $0x0,%edi
+  805aff:	49 89 df             	mov    %rbx,%r15
+  805b02:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  805b09:	ff ff ff 
+  805b0c:	48 01 d8             	add    %rbx,%rax
+  805b0f:	ff d0                	call   *%rax
+  805b11:	eb 01                	jmp    805b14 <pipe+0x23b>
+		goto err1;
+  805b13:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  805b14:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b18:	48 89 c6             	mov    %rax,%rsi
+  805b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b20:	49 89 df             	mov    %rbx,%r15
+  805b23:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  805b2a:	ff ff ff 
+  805b2d:	48 01 d8             	add    %rbx,%rax
+  805b30:	ff d0                	call   *%rax
+  805b32:	eb 01                	jmp    805b35 <pipe+0x25c>
+		goto err;
+  805b34:	90                   	nop
+err:
+	return r;
+  805b35:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805b38:	48 83 c4 30          	add    $0x30,%rsp
+  805b3c:	5b                   	pop    %rbx
+  805b3d:	41 5f                	pop    %r15
+  805b3f:	5d                   	pop    %rbp
+  805b40:	c3                   	ret
+
+0000000000805b41 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  805b41:	55                   	push   %rbp
+  805b42:	48 89 e5             	mov    %rsp,%rbp
+  805b45:	41 57                	push   %r15
+  805b47:	41 54                	push   %r12
+  805b49:	53                   	push   %rbx
+  805b4a:	48 83 ec 28          	sub    $0x28,%rsp
+  805b4e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b4e <_pipeisclosed+0xd>
+  805b55:	49 bb f2 34 00 00 00 	movabs $0x34f2,%r11
+  805b5c:	00 00 00 
+  805b5f:	4c 01 db             	add    %r11,%rbx
+  805b62:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805b66:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  805b6a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805b71:	ff ff ff 
+  805b74:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805b78:	48 8b 00             	mov    (%rax),%rax
+  805b7b:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805b81:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  805b84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b88:	48 89 c7             	mov    %rax,%rdi
+  805b8b:	49 89 df             	mov    %rbx,%r15
+  805b8e:	48 b8 10 de ff ff ff 	movabs $0xffffffffffffde10,%rax
+  805b95:	ff ff ff 
+  805b98:	48 01 d8             	add    %rbx,%rax
+  805b9b:	ff d0                	call   *%rax
+  805b9d:	41 89 c4             	mov    %eax,%r12d
+  805ba0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805ba4:	48 89 c7             	mov    %rax,%rdi
+  805ba7:	49 89 df             	mov    %rbx,%r15
+  805baa:	48 b8 10 de ff ff ff 	movabs $0xffffffffffffde10,%rax
+  805bb1:	ff ff ff 
+  805bb4:	48 01 d8             	add    %rbx,%rax
+  805bb7:	ff d0                	call   *%rax
+  805bb9:	41 39 c4             	cmp    %eax,%r12d
+  805bbc:	0f 94 c0             	sete   %al
+  805bbf:	0f b6 c0             	movzbl %al,%eax
+  805bc2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  805bc5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805bcc:	ff ff ff 
+  805bcf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805bd3:	48 8b 00             	mov    (%rax),%rax
+  805bd6:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  805bdc:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  805bdf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805be2:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805be5:	75 05                	jne    805bec <_pipeisclosed+0xab>
+			return ret;
+  805be7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805bea:	eb 63                	jmp    805c4f <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  805bec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805bef:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  805bf2:	0f 84 72 ff ff ff    	je     805b6a <_pipeisclosed+0x29>
+  805bf8:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  805bfc:	0f 85 68 ff ff ff    	jne    805b6a <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  805c02:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  805c09:	ff ff ff 
+  805c0c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  805c10:	48 8b 00             	mov    (%rax),%rax
+  805c13:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  805c19:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805c1c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805c1f:	89 c6                	mov    %eax,%esi
+  805c21:	48 b8 2e e6 ff ff ff 	movabs $0xffffffffffffe62e,%rax
+  805c28:	ff ff ff 
+  805c2b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c2f:	48 89 c7             	mov    %rax,%rdi
+  805c32:	49 89 df             	mov    %rbx,%r15
+  805c35:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c3a:	49 b8 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%r8
+  805c41:	ff ff ff 
+  805c44:	49 01 d8             	add    %rbx,%r8
+  805c47:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  805c4a:	e9 1b ff ff ff       	jmp    805b6a <_pipeisclosed+0x29>
+	}
+}
+  805c4f:	48 83 c4 28          	add    $0x28,%rsp
+  805c53:	5b                   	pop    %rbx
+  805c54:	41 5c                	pop    %r12
+  805c56:	41 5f                	pop    %r15
+  805c58:	5d                   	pop    %rbp
+  805c59:	c3                   	ret
+
+0000000000805c5a <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  805c5a:	55                   	push   %rbp
+  805c5b:	48 89 e5             	mov    %rsp,%rbp
+  805c5e:	41 57                	push   %r15
+  805c60:	53                   	push   %rbx
+  805c61:	48 83 ec 30          	sub    $0x30,%rsp
+  805c65:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c65 <pipeisclosed+0xb>
+  805c6c:	49 bb db 33 00 00 00 	movabs $0x33db,%r11
+  805c73:	00 00 00 
+  805c76:	4c 01 db             	add    %r11,%rbx
+  805c79:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805c7c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805c80:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805c83:	48 89 d6             	mov    %rdx,%rsi
+  805c86:	89 c7                	mov    %eax,%edi
+  805c88:	49 89 df             	mov    %rbx,%r15
+  805c8b:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  805c92:	ff ff ff 
+  805c95:	48 01 d8             	add    %rbx,%rax
+  805c98:	ff d0                	call   *%rax
+  805c9a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805c9d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805ca1:	79 05                	jns    805ca8 <pipeisclosed+0x4e>
+		return r;
+  805ca3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ca6:	eb 3b                	jmp    805ce3 <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  805ca8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cac:	48 89 c7             	mov    %rax,%rdi
+  805caf:	49 89 df             	mov    %rbx,%r15
+  805cb2:	48 b8 17 a5 ff ff ff 	movabs $0xffffffffffffa517,%rax
+  805cb9:	ff ff ff 
+  805cbc:	48 01 d8             	add    %rbx,%rax
+  805cbf:	ff d0                	call   *%rax
+  805cc1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  805cc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805cc9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ccd:	48 89 d6             	mov    %rdx,%rsi
+  805cd0:	48 89 c7             	mov    %rax,%rdi
+  805cd3:	48 b8 01 cb ff ff ff 	movabs $0xffffffffffffcb01,%rax
+  805cda:	ff ff ff 
+  805cdd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ce1:	ff d0                	call   *%rax
+}
+  805ce3:	48 83 c4 30          	add    $0x30,%rsp
+  805ce7:	5b                   	pop    %rbx
+  805ce8:	41 5f                	pop    %r15
+  805cea:	5d                   	pop    %rbp
+  805ceb:	c3                   	ret
+
+0000000000805cec <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  805cec:	55                   	push   %rbp
+  805ced:	48 89 e5             	mov    %rsp,%rbp
+  805cf0:	41 57                	push   %r15
+  805cf2:	53                   	push   %rbx
+  805cf3:	48 83 ec 40          	sub    $0x40,%rsp
+  805cf7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805cf7 <devpipe_read+0xb>
+  805cfe:	49 bb 49 33 00 00 00 	movabs $0x3349,%r11
+  805d05:	00 00 00 
+  805d08:	4c 01 db             	add    %r11,%rbx
+  805d0b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805d0f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805d13:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  805d17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d1b:	48 89 c7             	mov    %rax,%rdi
+  805d1e:	49 89 df             	mov    %rbx,%r15
+  805d21:	48 b8 17 a5 ff ff ff 	movabs $0xffffffffffffa517,%rax
+  805d28:	ff ff ff 
+  805d2b:	48 01 d8             	add    %rbx,%rax
+  805d2e:	ff d0                	call   *%rax
+  805d30:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805d34:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d38:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805d3c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805d43:	00 
+  805d44:	e9 a1 00 00 00       	jmp    805dea <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  805d49:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805d4e:	74 09                	je     805d59 <devpipe_read+0x6d>
+				return i;
+  805d50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d54:	e9 9f 00 00 00       	jmp    805df8 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  805d59:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805d5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d61:	48 89 d6             	mov    %rdx,%rsi
+  805d64:	48 89 c7             	mov    %rax,%rdi
+  805d67:	48 b8 01 cb ff ff ff 	movabs $0xffffffffffffcb01,%rax
+  805d6e:	ff ff ff 
+  805d71:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d75:	ff d0                	call   *%rax
+  805d77:	85 c0                	test   %eax,%eax
+  805d79:	74 07                	je     805d82 <devpipe_read+0x96>
+				return 0;
+  805d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d80:	eb 76                	jmp    805df8 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  805d82:	49 89 df             	mov    %rbx,%r15
+  805d85:	48 b8 56 91 ff ff ff 	movabs $0xffffffffffff9156,%rax
+  805d8c:	ff ff ff 
+  805d8f:	48 01 d8             	add    %rbx,%rax
+  805d92:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  805d94:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d98:	8b 10                	mov    (%rax),%edx
+  805d9a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d9e:	8b 40 04             	mov    0x4(%rax),%eax
+  805da1:	39 c2                	cmp    %eax,%edx
+  805da3:	74 a4                	je     805d49 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805da5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805da9:	8b 10                	mov    (%rax),%edx
+  805dab:	89 d0                	mov    %edx,%eax
+  805dad:	c1 f8 1f             	sar    $0x1f,%eax
+  805db0:	c1 e8 1b             	shr    $0x1b,%eax
+  805db3:	01 c2                	add    %eax,%edx
+  805db5:	83 e2 1f             	and    $0x1f,%edx
+  805db8:	29 c2                	sub    %eax,%edx
+  805dba:	89 d6                	mov    %edx,%esi
+  805dbc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805dc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dc4:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805dc8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805dcc:	48 63 c6             	movslq %esi,%rax
+  805dcf:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  805dd4:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  805dd6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805dda:	8b 00                	mov    (%rax),%eax
+  805ddc:	8d 50 01             	lea    0x1(%rax),%edx
+  805ddf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805de3:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  805de5:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dee:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805df2:	72 a0                	jb     805d94 <devpipe_read+0xa8>
+	}
+	return i;
+  805df4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805df8:	48 83 c4 40          	add    $0x40,%rsp
+  805dfc:	5b                   	pop    %rbx
+  805dfd:	41 5f                	pop    %r15
+  805dff:	5d                   	pop    %rbp
+  805e00:	c3                   	ret
+
+0000000000805e01 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  805e01:	55                   	push   %rbp
+  805e02:	48 89 e5             	mov    %rsp,%rbp
+  805e05:	41 57                	push   %r15
+  805e07:	53                   	push   %rbx
+  805e08:	48 83 ec 40          	sub    $0x40,%rsp
+  805e0c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e0c <devpipe_write+0xb>
+  805e13:	49 bb 34 32 00 00 00 	movabs $0x3234,%r11
+  805e1a:	00 00 00 
+  805e1d:	4c 01 db             	add    %r11,%rbx
+  805e20:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  805e24:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805e28:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  805e2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e30:	48 89 c7             	mov    %rax,%rdi
+  805e33:	49 89 df             	mov    %rbx,%r15
+  805e36:	48 b8 17 a5 ff ff ff 	movabs $0xffffffffffffa517,%rax
+  805e3d:	ff ff ff 
+  805e40:	48 01 d8             	add    %rbx,%rax
+  805e43:	ff d0                	call   *%rax
+  805e45:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  805e49:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805e4d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  805e51:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  805e58:	00 
+  805e59:	e9 a0 00 00 00       	jmp    805efe <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  805e5e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805e62:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805e66:	48 89 d6             	mov    %rdx,%rsi
+  805e69:	48 89 c7             	mov    %rax,%rdi
+  805e6c:	48 b8 01 cb ff ff ff 	movabs $0xffffffffffffcb01,%rax
+  805e73:	ff ff ff 
+  805e76:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e7a:	ff d0                	call   *%rax
+  805e7c:	85 c0                	test   %eax,%eax
+  805e7e:	74 0a                	je     805e8a <devpipe_write+0x89>
+				return 0;
+  805e80:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e85:	e9 82 00 00 00       	jmp    805f0c <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  805e8a:	49 89 df             	mov    %rbx,%r15
+  805e8d:	48 b8 56 91 ff ff ff 	movabs $0xffffffffffff9156,%rax
+  805e94:	ff ff ff 
+  805e97:	48 01 d8             	add    %rbx,%rax
+  805e9a:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  805e9c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ea0:	8b 40 04             	mov    0x4(%rax),%eax
+  805ea3:	48 63 d0             	movslq %eax,%rdx
+  805ea6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805eaa:	8b 00                	mov    (%rax),%eax
+  805eac:	48 98                	cltq
+  805eae:	48 83 c0 20          	add    $0x20,%rax
+  805eb2:	48 39 c2             	cmp    %rax,%rdx
+  805eb5:	73 a7                	jae    805e5e <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805eb7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805ebb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ebf:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805ec3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ec7:	8b 50 04             	mov    0x4(%rax),%edx
+  805eca:	89 d0                	mov    %edx,%eax
+  805ecc:	c1 f8 1f             	sar    $0x1f,%eax
+  805ecf:	c1 e8 1b             	shr    $0x1b,%eax
+  805ed2:	01 c2                	add    %eax,%edx
+  805ed4:	83 e2 1f             	and    $0x1f,%edx
+  805ed7:	29 c2                	sub    %eax,%edx
+  805ed9:	89 d0                	mov    %edx,%eax
+  805edb:	0f b6 09             	movzbl (%rcx),%ecx
+  805ede:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ee2:	48 98                	cltq
+  805ee4:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  805ee8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805eec:	8b 40 04             	mov    0x4(%rax),%eax
+  805eef:	8d 50 01             	lea    0x1(%rax),%edx
+  805ef2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805ef6:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  805ef9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  805efe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f02:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  805f06:	72 94                	jb     805e9c <devpipe_write+0x9b>
+	}
+
+	return i;
+  805f08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  805f0c:	48 83 c4 40          	add    $0x40,%rsp
+  805f10:	5b                   	pop    %rbx
+  805f11:	41 5f                	pop    %r15
+  805f13:	5d                   	pop    %rbp
+  805f14:	c3                   	ret
+
+0000000000805f15 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  805f15:	55                   	push   %rbp
+  805f16:	48 89 e5             	mov    %rsp,%rbp
+  805f19:	41 57                	push   %r15
+  805f1b:	53                   	push   %rbx
+  805f1c:	48 83 ec 20          	sub    $0x20,%rsp
+  805f20:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f20 <devpipe_stat+0xb>
+  805f27:	49 bb 20 31 00 00 00 	movabs $0x3120,%r11
+  805f2e:	00 00 00 
+  805f31:	4c 01 db             	add    %r11,%rbx
+  805f34:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805f38:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  805f3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f40:	48 89 c7             	mov    %rax,%rdi
+  805f43:	49 89 df             	mov    %rbx,%r15
+  805f46:	48 b8 17 a5 ff ff ff 	movabs $0xffffffffffffa517,%rax
+  805f4d:	ff ff ff 
+  805f50:	48 01 d8             	add    %rbx,%rax
+  805f53:	ff d0                	call   *%rax
+  805f55:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  805f59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f5d:	48 ba 41 e6 ff ff ff 	movabs $0xffffffffffffe641,%rdx
+  805f64:	ff ff ff 
+  805f67:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805f6b:	48 89 d6             	mov    %rdx,%rsi
+  805f6e:	48 89 c7             	mov    %rax,%rdi
+  805f71:	49 89 df             	mov    %rbx,%r15
+  805f74:	48 b8 ef 84 ff ff ff 	movabs $0xffffffffffff84ef,%rax
+  805f7b:	ff ff ff 
+  805f7e:	48 01 d8             	add    %rbx,%rax
+  805f81:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  805f83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f87:	8b 50 04             	mov    0x4(%rax),%edx
+  805f8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f8e:	8b 00                	mov    (%rax),%eax
+  805f90:	29 c2                	sub    %eax,%edx
+  805f92:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f96:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  805f9c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fa0:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805fa7:	00 00 00 
+	stat->st_dev = &devpipe;
+  805faa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805fae:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  805fb5:	00 00 00 
+  805fb8:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805fbc:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  805fc3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805fc8:	48 83 c4 20          	add    $0x20,%rsp
+  805fcc:	5b                   	pop    %rbx
+  805fcd:	41 5f                	pop    %r15
+  805fcf:	5d                   	pop    %rbp
+  805fd0:	c3                   	ret
+
+0000000000805fd1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  805fd1:	55                   	push   %rbp
+  805fd2:	48 89 e5             	mov    %rsp,%rbp
+  805fd5:	41 57                	push   %r15
+  805fd7:	53                   	push   %rbx
+  805fd8:	48 83 ec 10          	sub    $0x10,%rsp
+  805fdc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805fdc <devpipe_close+0xb>
+  805fe3:	49 bb 64 30 00 00 00 	movabs $0x3064,%r11
+  805fea:	00 00 00 
+  805fed:	4c 01 db             	add    %r11,%rbx
+  805ff0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  805ff4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ff8:	48 89 c6             	mov    %rax,%rsi
+  805ffb:	bf 00 00 00 00       	mov    $0x0,%edi
+  806000:	49 89 df             	mov    %rbx,%r15
+  806003:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  80600a:	ff ff ff 
+  80600d:	48 01 d8             	add    %rbx,%rax
+  806010:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  806012:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806016:	48 89 c7             	mov    %rax,%rdi
+  806019:	49 89 df             	mov    %rbx,%r15
+  80601c:	48 b8 17 a5 ff ff ff 	movabs $0xffffffffffffa517,%rax
+  806023:	ff ff ff 
+  806026:	48 01 d8             	add    %rbx,%rax
+  806029:	ff d0                	call   *%rax
+  80602b:	48 89 c6             	mov    %rax,%rsi
+  80602e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806033:	49 89 df             	mov    %rbx,%r15
+  806036:	48 b8 83 92 ff ff ff 	movabs $0xffffffffffff9283,%rax
+  80603d:	ff ff ff 
+  806040:	48 01 d8             	add    %rbx,%rax
+  806043:	ff d0                	call   *%rax
+}
+  806045:	48 83 c4 10          	add    $0x10,%rsp
+  806049:	5b                   	pop    %rbx
+  80604a:	41 5f                	pop    %r15
+  80604c:	5d                   	pop    %rbp
+  80604d:	c3                   	ret
+
+000000000080604e <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80604e:	55                   	push   %rbp
+  80604f:	48 89 e5             	mov    %rsp,%rbp
+  806052:	41 57                	push   %r15
+  806054:	53                   	push   %rbx
+  806055:	48 83 ec 20          	sub    $0x20,%rsp
+  806059:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806059 <wait+0xb>
+  806060:	49 bb e7 2f 00 00 00 	movabs $0x2fe7,%r11
+  806067:	00 00 00 
+  80606a:	4c 01 db             	add    %r11,%rbx
+  80606d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  806070:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806074:	75 50                	jne    8060c6 <wait+0x78>
+  806076:	48 b8 48 e6 ff ff ff 	movabs $0xffffffffffffe648,%rax
+  80607d:	ff ff ff 
+  806080:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806084:	48 89 c1             	mov    %rax,%rcx
+  806087:	48 b8 53 e6 ff ff ff 	movabs $0xffffffffffffe653,%rax
+  80608e:	ff ff ff 
+  806091:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806095:	48 89 c2             	mov    %rax,%rdx
+  806098:	be 09 00 00 00       	mov    $0x9,%esi
+  80609d:	48 b8 68 e6 ff ff ff 	movabs $0xffffffffffffe668,%rax
+  8060a4:	ff ff ff 
+  8060a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8060ab:	48 89 c7             	mov    %rax,%rdi
+  8060ae:	49 89 df             	mov    %rbx,%r15
+  8060b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060b6:	49 b8 56 74 ff ff ff 	movabs $0xffffffffffff7456,%r8
+  8060bd:	ff ff ff 
+  8060c0:	49 01 d8             	add    %rbx,%r8
+  8060c3:	41 ff d0             	call   *%r8
+	e = &envs[ENVX(envid)];
+  8060c6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8060c9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8060ce:	48 98                	cltq
+  8060d0:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8060d7:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8060de:	ff ff ff 
+  8060e1:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8060e5:	48 01 d0             	add    %rdx,%rax
+  8060e8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8060ec:	eb 12                	jmp    806100 <wait+0xb2>
+		sys_yield();
+  8060ee:	49 89 df             	mov    %rbx,%r15
+  8060f1:	48 b8 56 91 ff ff ff 	movabs $0xffffffffffff9156,%rax
+  8060f8:	ff ff ff 
+  8060fb:	48 01 d8             	add    %rbx,%rax
+  8060fe:	ff d0                	call   *%rax
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  806100:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806104:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80610a:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80610d:	75 0e                	jne    80611d <wait+0xcf>
+  80610f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806113:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  806119:	85 c0                	test   %eax,%eax
+  80611b:	75 d1                	jne    8060ee <wait+0xa0>
+}
+  80611d:	90                   	nop
+  80611e:	48 83 c4 20          	add    $0x20,%rsp
+  806122:	5b                   	pop    %rbx
+  806123:	41 5f                	pop    %r15
+  806125:	5d                   	pop    %rbp
+  806126:	c3                   	ret
+
+0000000000806127 <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  806127:	55                   	push   %rbp
+  806128:	48 89 e5             	mov    %rsp,%rbp
+  80612b:	41 57                	push   %r15
+  80612d:	48 83 ec 28          	sub    $0x28,%rsp
+  806131:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806131 <cputchar+0xa>
+  806138:	49 bb 0f 2f 00 00 00 	movabs $0x2f0f,%r11
+  80613f:	00 00 00 
+  806142:	4c 01 d8             	add    %r11,%rax
+  806145:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  806148:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80614b:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  80614e:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806152:	be 01 00 00 00       	mov    $0x1,%esi
+  806157:	48 89 d7             	mov    %rdx,%rdi
+  80615a:	49 89 c7             	mov    %rax,%r15
+  80615d:	48 ba f3 8f ff ff ff 	movabs $0xffffffffffff8ff3,%rdx
+  806164:	ff ff ff 
+  806167:	48 01 c2             	add    %rax,%rdx
+  80616a:	ff d2                	call   *%rdx
+}
+  80616c:	90                   	nop
+  80616d:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806171:	c9                   	leave
+  806172:	c3                   	ret
+
+0000000000806173 <getchar>:
+
+int
+getchar(void)
+{
+  806173:	55                   	push   %rbp
+  806174:	48 89 e5             	mov    %rsp,%rbp
+  806177:	41 57                	push   %r15
+  806179:	48 83 ec 18          	sub    $0x18,%rsp
+  80617d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80617d <getchar+0xa>
+  806184:	49 bb c3 2e 00 00 00 	movabs $0x2ec3,%r11
+  80618b:	00 00 00 
+  80618e:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806191:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806195:	ba 01 00 00 00       	mov    $0x1,%edx
+  80619a:	48 89 ce             	mov    %rcx,%rsi
+  80619d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061a2:	49 89 c7             	mov    %rax,%r15
+  8061a5:	48 b9 57 ab ff ff ff 	movabs $0xffffffffffffab57,%rcx
+  8061ac:	ff ff ff 
+  8061af:	48 01 c1             	add    %rax,%rcx
+  8061b2:	ff d1                	call   *%rcx
+  8061b4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  8061b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061bb:	79 05                	jns    8061c2 <getchar+0x4f>
+		return r;
+  8061bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061c0:	eb 14                	jmp    8061d6 <getchar+0x63>
+	if (r < 1)
+  8061c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061c6:	7f 07                	jg     8061cf <getchar+0x5c>
+		return -E_EOF;
+  8061c8:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8061cd:	eb 07                	jmp    8061d6 <getchar+0x63>
+	return c;
+  8061cf:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8061d3:	0f b6 c0             	movzbl %al,%eax
+}
+  8061d6:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8061da:	c9                   	leave
+  8061db:	c3                   	ret
+
+00000000008061dc <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8061dc:	55                   	push   %rbp
+  8061dd:	48 89 e5             	mov    %rsp,%rbp
+  8061e0:	41 57                	push   %r15
+  8061e2:	53                   	push   %rbx
+  8061e3:	48 83 ec 20          	sub    $0x20,%rsp
+  8061e7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8061e7 <iscons+0xb>
+  8061ee:	49 bb 59 2e 00 00 00 	movabs $0x2e59,%r11
+  8061f5:	00 00 00 
+  8061f8:	4c 01 db             	add    %r11,%rbx
+  8061fb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8061fe:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806202:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806205:	48 89 d6             	mov    %rdx,%rsi
+  806208:	89 c7                	mov    %eax,%edi
+  80620a:	49 89 df             	mov    %rbx,%r15
+  80620d:	48 b8 10 a6 ff ff ff 	movabs $0xffffffffffffa610,%rax
+  806214:	ff ff ff 
+  806217:	48 01 d8             	add    %rbx,%rax
+  80621a:	ff d0                	call   *%rax
+  80621c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80621f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806223:	79 05                	jns    80622a <iscons+0x4e>
+		return r;
+  806225:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806228:	eb 1b                	jmp    806245 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80622a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80622e:	8b 10                	mov    (%rax),%edx
+  806230:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  806237:	00 00 00 
+  80623a:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80623d:	39 c2                	cmp    %eax,%edx
+  80623f:	0f 94 c0             	sete   %al
+  806242:	0f b6 c0             	movzbl %al,%eax
+}
+  806245:	48 83 c4 20          	add    $0x20,%rsp
+  806249:	5b                   	pop    %rbx
+  80624a:	41 5f                	pop    %r15
+  80624c:	5d                   	pop    %rbp
+  80624d:	c3                   	ret
+
+000000000080624e <opencons>:
+
+int
+opencons(void)
+{
+  80624e:	55                   	push   %rbp
+  80624f:	48 89 e5             	mov    %rsp,%rbp
+  806252:	41 57                	push   %r15
+  806254:	53                   	push   %rbx
+  806255:	48 83 ec 10          	sub    $0x10,%rsp
+  806259:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806259 <opencons+0xb>
+  806260:	49 bb e7 2d 00 00 00 	movabs $0x2de7,%r11
+  806267:	00 00 00 
+  80626a:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  80626d:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806271:	48 89 c7             	mov    %rax,%rdi
+  806274:	49 89 df             	mov    %rbx,%r15
+  806277:	48 b8 5a a5 ff ff ff 	movabs $0xffffffffffffa55a,%rax
+  80627e:	ff ff ff 
+  806281:	48 01 d8             	add    %rbx,%rax
+  806284:	ff d0                	call   *%rax
+  806286:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806289:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80628d:	79 05                	jns    806294 <opencons+0x46>
+		return r;
+  80628f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806292:	eb 68                	jmp    8062fc <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806294:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806298:	ba 07 04 00 00       	mov    $0x407,%edx
+  80629d:	48 89 c6             	mov    %rax,%rsi
+  8062a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8062a5:	49 89 df             	mov    %rbx,%r15
+  8062a8:	48 b8 ab 91 ff ff ff 	movabs $0xffffffffffff91ab,%rax
+  8062af:	ff ff ff 
+  8062b2:	48 01 d8             	add    %rbx,%rax
+  8062b5:	ff d0                	call   *%rax
+  8062b7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062be:	79 05                	jns    8062c5 <opencons+0x77>
+		return r;
+  8062c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8062c3:	eb 37                	jmp    8062fc <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  8062c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062c9:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  8062d0:	00 00 00 
+  8062d3:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8062d6:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  8062d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062dc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  8062e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062e7:	48 89 c7             	mov    %rax,%rdi
+  8062ea:	49 89 df             	mov    %rbx,%r15
+  8062ed:	48 b8 e0 a4 ff ff ff 	movabs $0xffffffffffffa4e0,%rax
+  8062f4:	ff ff ff 
+  8062f7:	48 01 d8             	add    %rbx,%rax
+  8062fa:	ff d0                	call   *%rax
+}
+  8062fc:	48 83 c4 10          	add    $0x10,%rsp
+  806300:	5b                   	pop    %rbx
+  806301:	41 5f                	pop    %r15
+  806303:	5d                   	pop    %rbp
+  806304:	c3                   	ret
+
+0000000000806305 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806305:	55                   	push   %rbp
+  806306:	48 89 e5             	mov    %rsp,%rbp
+  806309:	41 57                	push   %r15
+  80630b:	53                   	push   %rbx
+  80630c:	48 83 ec 30          	sub    $0x30,%rsp
+  806310:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806310 <devcons_read+0xb>
+  806317:	49 bb 30 2d 00 00 00 	movabs $0x2d30,%r11
+  80631e:	00 00 00 
+  806321:	4c 01 db             	add    %r11,%rbx
+  806324:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806328:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80632c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806330:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806335:	75 19                	jne    806350 <devcons_read+0x4b>
+		return 0;
+  806337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80633c:	eb 55                	jmp    806393 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  80633e:	49 89 df             	mov    %rbx,%r15
+  806341:	48 b8 56 91 ff ff ff 	movabs $0xffffffffffff9156,%rax
+  806348:	ff ff ff 
+  80634b:	48 01 d8             	add    %rbx,%rax
+  80634e:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806350:	49 89 df             	mov    %rbx,%r15
+  806353:	48 b8 52 90 ff ff ff 	movabs $0xffffffffffff9052,%rax
+  80635a:	ff ff ff 
+  80635d:	48 01 d8             	add    %rbx,%rax
+  806360:	ff d0                	call   *%rax
+  806362:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806365:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806369:	74 d3                	je     80633e <devcons_read+0x39>
+	if (c < 0)
+  80636b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80636f:	79 05                	jns    806376 <devcons_read+0x71>
+		return c;
+  806371:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806374:	eb 1d                	jmp    806393 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806376:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  80637a:	75 07                	jne    806383 <devcons_read+0x7e>
+		return 0;
+  80637c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806381:	eb 10                	jmp    806393 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806383:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806386:	89 c2                	mov    %eax,%edx
+  806388:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80638c:	88 10                	mov    %dl,(%rax)
+	return 1;
+  80638e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806393:	48 83 c4 30          	add    $0x30,%rsp
+  806397:	5b                   	pop    %rbx
+  806398:	41 5f                	pop    %r15
+  80639a:	5d                   	pop    %rbp
+  80639b:	c3                   	ret
+
+000000000080639c <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80639c:	55                   	push   %rbp
+  80639d:	48 89 e5             	mov    %rsp,%rbp
+  8063a0:	41 57                	push   %r15
+  8063a2:	53                   	push   %rbx
+  8063a3:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8063aa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063aa <devcons_write+0xe>
+  8063b1:	49 bb 96 2c 00 00 00 	movabs $0x2c96,%r11
+  8063b8:	00 00 00 
+  8063bb:	4c 01 db             	add    %r11,%rbx
+  8063be:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  8063c5:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  8063cc:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  8063d3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8063da:	e9 80 00 00 00       	jmp    80645f <devcons_write+0xc3>
+		m = n - tot;
+  8063df:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8063e6:	89 c2                	mov    %eax,%edx
+  8063e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063eb:	29 c2                	sub    %eax,%edx
+  8063ed:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  8063f0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8063f3:	83 f8 7f             	cmp    $0x7f,%eax
+  8063f6:	76 07                	jbe    8063ff <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  8063f8:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  8063ff:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806402:	48 63 d0             	movslq %eax,%rdx
+  806405:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806408:	48 63 c8             	movslq %eax,%rcx
+  80640b:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806412:	48 01 c1             	add    %rax,%rcx
+  806415:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  80641c:	48 89 ce             	mov    %rcx,%rsi
+  80641f:	48 89 c7             	mov    %rax,%rdi
+  806422:	49 89 df             	mov    %rbx,%r15
+  806425:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  80642c:	ff ff ff 
+  80642f:	48 01 d8             	add    %rbx,%rax
+  806432:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806434:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806437:	48 63 d0             	movslq %eax,%rdx
+  80643a:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806441:	48 89 d6             	mov    %rdx,%rsi
+  806444:	48 89 c7             	mov    %rax,%rdi
+  806447:	49 89 df             	mov    %rbx,%r15
+  80644a:	48 b8 f3 8f ff ff ff 	movabs $0xffffffffffff8ff3,%rax
+  806451:	ff ff ff 
+  806454:	48 01 d8             	add    %rbx,%rax
+  806457:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806459:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80645c:	01 45 ec             	add    %eax,-0x14(%rbp)
+  80645f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806462:	48 98                	cltq
+  806464:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  80646b:	0f 82 6e ff ff ff    	jb     8063df <devcons_write+0x43>
+	}
+	return tot;
+  806471:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806474:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  80647b:	5b                   	pop    %rbx
+  80647c:	41 5f                	pop    %r15
+  80647e:	5d                   	pop    %rbp
+  80647f:	c3                   	ret
+
+0000000000806480 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806480:	55                   	push   %rbp
+  806481:	48 89 e5             	mov    %rsp,%rbp
+  806484:	48 83 ec 08          	sub    $0x8,%rsp
+  806488:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806488 <devcons_close+0x8>
+  80648f:	49 bb b8 2b 00 00 00 	movabs $0x2bb8,%r11
+  806496:	00 00 00 
+  806499:	4c 01 d8             	add    %r11,%rax
+  80649c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  8064a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8064a5:	c9                   	leave
+  8064a6:	c3                   	ret
+
+00000000008064a7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8064a7:	55                   	push   %rbp
+  8064a8:	48 89 e5             	mov    %rsp,%rbp
+  8064ab:	41 57                	push   %r15
+  8064ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8064b1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8064b1 <devcons_stat+0xa>
+  8064b8:	49 bb 8f 2b 00 00 00 	movabs $0x2b8f,%r11
+  8064bf:	00 00 00 
+  8064c2:	4c 01 d8             	add    %r11,%rax
+  8064c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8064c9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  8064cd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8064d1:	48 b9 78 e6 ff ff ff 	movabs $0xffffffffffffe678,%rcx
+  8064d8:	ff ff ff 
+  8064db:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  8064df:	48 89 ce             	mov    %rcx,%rsi
+  8064e2:	48 89 d7             	mov    %rdx,%rdi
+  8064e5:	49 89 c7             	mov    %rax,%r15
+  8064e8:	48 ba ef 84 ff ff ff 	movabs $0xffffffffffff84ef,%rdx
+  8064ef:	ff ff ff 
+  8064f2:	48 01 c2             	add    %rax,%rdx
+  8064f5:	ff d2                	call   *%rdx
+	return 0;
+  8064f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8064fc:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806500:	c9                   	leave
+  806501:	c3                   	ret
+
+0000000000806502 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806502:	55                   	push   %rbp
+  806503:	48 89 e5             	mov    %rsp,%rbp
+  806506:	41 57                	push   %r15
+  806508:	53                   	push   %rbx
+  806509:	48 83 ec 20          	sub    $0x20,%rsp
+  80650d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80650d <set_pgfault_handler+0xb>
+  806514:	49 bb 33 2b 00 00 00 	movabs $0x2b33,%r11
+  80651b:	00 00 00 
+  80651e:	4c 01 db             	add    %r11,%rbx
+  806521:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806525:	49 89 df             	mov    %rbx,%r15
+  806528:	48 b8 02 91 ff ff ff 	movabs $0xffffffffffff9102,%rax
+  80652f:	ff ff ff 
+  806532:	48 01 d8             	add    %rbx,%rax
+  806535:	ff d0                	call   *%rax
+  806537:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  80653a:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806541:	00 00 00 
+  806544:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806548:	48 85 c0             	test   %rax,%rax
+  80654b:	75 6b                	jne    8065b8 <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  80654d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806550:	ba 07 00 00 00       	mov    $0x7,%edx
+  806555:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80655a:	48 89 ce             	mov    %rcx,%rsi
+  80655d:	89 c7                	mov    %eax,%edi
+  80655f:	49 89 df             	mov    %rbx,%r15
+  806562:	48 b8 ab 91 ff ff ff 	movabs $0xffffffffffff91ab,%rax
+  806569:	ff ff ff 
+  80656c:	48 01 d8             	add    %rbx,%rax
+  80656f:	ff d0                	call   *%rax
+  806571:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806574:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806578:	74 3e                	je     8065b8 <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  80657a:	48 b8 80 e6 ff ff ff 	movabs $0xffffffffffffe680,%rax
+  806581:	ff ff ff 
+  806584:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806588:	48 89 c2             	mov    %rax,%rdx
+  80658b:	be 23 00 00 00       	mov    $0x23,%esi
+  806590:	48 b8 ae e6 ff ff ff 	movabs $0xffffffffffffe6ae,%rax
+  806597:	ff ff ff 
+  80659a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80659e:	48 89 c7             	mov    %rax,%rdi
+  8065a1:	49 89 df             	mov    %rbx,%r15
+  8065a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065a9:	48 b9 56 74 ff ff ff 	movabs $0xffffffffffff7456,%rcx
+  8065b0:	ff ff ff 
+  8065b3:	48 01 d9             	add    %rbx,%rcx
+  8065b6:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8065b8:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  8065bf:	00 00 00 
+  8065c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065c6:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  8065ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8065cd:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8065d4:	ff ff ff 
+  8065d7:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8065db:	48 89 d6             	mov    %rdx,%rsi
+  8065de:	89 c7                	mov    %eax,%edi
+  8065e0:	49 89 df             	mov    %rbx,%r15
+  8065e3:	48 b8 a1 93 ff ff ff 	movabs $0xffffffffffff93a1,%rax
+  8065ea:	ff ff ff 
+  8065ed:	48 01 d8             	add    %rbx,%rax
+  8065f0:	ff d0                	call   *%rax
+}
+  8065f2:	90                   	nop
+  8065f3:	48 83 c4 20          	add    $0x20,%rsp
+  8065f7:	5b                   	pop    %rbx
+  8065f8:	41 5f                	pop    %r15
+  8065fa:	5d                   	pop    %rbp
+  8065fb:	c3                   	ret
+
+00000000008065fc <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  8065fc:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  8065ff:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806606:	00 00 00 
+call *%rax
+  806609:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  80660b:	58                   	pop    %rax
+	popq %rax;
+  80660c:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  80660d:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806614:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806618:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  80661c:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806620:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806624:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806628:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  80662b:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  80662f:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806633:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806638:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80663d:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806642:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806647:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80664c:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806651:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806656:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80665b:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806660:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806665:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80666a:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80666f:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806674:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806679:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  80667d:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806681:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806682:	5c                   	pop    %rsp
+	ret;			//return
+  806683:	c3                   	ret
+
+0000000000806684 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  806684:	55                   	push   %rbp
+  806685:	48 89 e5             	mov    %rsp,%rbp
+  806688:	41 57                	push   %r15
+  80668a:	53                   	push   %rbx
+  80668b:	48 83 ec 30          	sub    $0x30,%rsp
+  80668f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80668f <ipc_recv+0xb>
+  806696:	49 bb b1 29 00 00 00 	movabs $0x29b1,%r11
+  80669d:	00 00 00 
+  8066a0:	4c 01 db             	add    %r11,%rbx
+  8066a3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8066a7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8066ab:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8066af:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8066b4:	75 0e                	jne    8066c4 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8066b6:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8066bd:	00 00 00 
+  8066c0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8066c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8066c8:	48 89 c7             	mov    %rax,%rdi
+  8066cb:	49 89 df             	mov    %rbx,%r15
+  8066ce:	48 b8 d4 94 ff ff ff 	movabs $0xffffffffffff94d4,%rax
+  8066d5:	ff ff ff 
+  8066d8:	48 01 d8             	add    %rbx,%rax
+  8066db:	ff d0                	call   *%rax
+  8066dd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8066e0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8066e5:	74 2a                	je     806711 <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  8066e7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8066eb:	75 19                	jne    806706 <ipc_recv+0x82>
+  8066ed:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8066f4:	ff ff ff 
+  8066f7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8066fb:	48 8b 00             	mov    (%rax),%rax
+  8066fe:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806704:	eb 05                	jmp    80670b <ipc_recv+0x87>
+  806706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80670b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80670f:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  806711:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806716:	74 2a                	je     806742 <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  806718:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80671c:	75 19                	jne    806737 <ipc_recv+0xb3>
+  80671e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806725:	ff ff ff 
+  806728:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80672c:	48 8b 00             	mov    (%rax),%rax
+  80672f:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806735:	eb 05                	jmp    80673c <ipc_recv+0xb8>
+  806737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80673c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806740:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  806742:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806746:	74 05                	je     80674d <ipc_recv+0xc9>
+		return res;
+  806748:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80674b:	eb 17                	jmp    806764 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  80674d:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806754:	ff ff ff 
+  806757:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80675b:	48 8b 00             	mov    (%rax),%rax
+  80675e:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806764:	48 83 c4 30          	add    $0x30,%rsp
+  806768:	5b                   	pop    %rbx
+  806769:	41 5f                	pop    %r15
+  80676b:	5d                   	pop    %rbp
+  80676c:	c3                   	ret
+
+000000000080676d <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80676d:	55                   	push   %rbp
+  80676e:	48 89 e5             	mov    %rsp,%rbp
+  806771:	41 57                	push   %r15
+  806773:	53                   	push   %rbx
+  806774:	48 83 ec 20          	sub    $0x20,%rsp
+  806778:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806778 <ipc_send+0xb>
+  80677f:	49 bb c8 28 00 00 00 	movabs $0x28c8,%r11
+  806786:	00 00 00 
+  806789:	4c 01 db             	add    %r11,%rbx
+  80678c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80678f:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806792:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806796:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  806799:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80679e:	75 0e                	jne    8067ae <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8067a0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8067a7:	00 00 00 
+  8067aa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8067ae:	90                   	nop
+  8067af:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8067b2:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8067b5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8067b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8067bc:	89 c7                	mov    %eax,%edi
+  8067be:	49 89 df             	mov    %rbx,%r15
+  8067c1:	48 b8 6a 94 ff ff ff 	movabs $0xffffffffffff946a,%rax
+  8067c8:	ff ff ff 
+  8067cb:	48 01 d8             	add    %rbx,%rax
+  8067ce:	ff d0                	call   *%rax
+  8067d0:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8067d3:	74 da                	je     8067af <ipc_send+0x42>
+		;
+}
+  8067d5:	90                   	nop
+  8067d6:	90                   	nop
+  8067d7:	48 83 c4 20          	add    $0x20,%rsp
+  8067db:	5b                   	pop    %rbx
+  8067dc:	41 5f                	pop    %r15
+  8067de:	5d                   	pop    %rbp
+  8067df:	c3                   	ret
+
+00000000008067e0 <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8067e0:	55                   	push   %rbp
+  8067e1:	48 89 e5             	mov    %rsp,%rbp
+  8067e4:	41 57                	push   %r15
+  8067e6:	53                   	push   %rbx
+  8067e7:	48 83 ec 40          	sub    $0x40,%rsp
+  8067eb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067eb <ipc_call+0xb>
+  8067f2:	49 bb 55 28 00 00 00 	movabs $0x2855,%r11
+  8067f9:	00 00 00 
+  8067fc:	4c 01 db             	add    %r11,%rbx
+  8067ff:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806802:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806805:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806809:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  80680c:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806810:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806814:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806819:	75 0e                	jne    806829 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  80681b:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806822:	00 00 00 
+  806825:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806829:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80682e:	75 0e                	jne    80683e <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806830:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806837:	00 00 00 
+  80683a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80683e:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806841:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  806845:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806848:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80684c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80684f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806855:	49 89 f8             	mov    %rdi,%r8
+  806858:	89 c7                	mov    %eax,%edi
+  80685a:	49 89 df             	mov    %rbx,%r15
+  80685d:	48 b8 2d 95 ff ff ff 	movabs $0xffffffffffff952d,%rax
+  806864:	ff ff ff 
+  806867:	48 01 d8             	add    %rbx,%rax
+  80686a:	ff d0                	call   *%rax
+  80686c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80686f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806874:	74 2a                	je     8068a0 <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806876:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80687a:	75 19                	jne    806895 <ipc_call+0xb5>
+  80687c:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806883:	ff ff ff 
+  806886:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80688a:	48 8b 00             	mov    (%rax),%rax
+  80688d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806893:	eb 05                	jmp    80689a <ipc_call+0xba>
+  806895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80689a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80689e:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8068a0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068a4:	74 05                	je     8068ab <ipc_call+0xcb>
+		return r;
+  8068a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068a9:	eb 17                	jmp    8068c2 <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8068ab:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8068b2:	ff ff ff 
+  8068b5:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8068b9:	48 8b 00             	mov    (%rax),%rax
+  8068bc:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8068c2:	48 83 c4 40          	add    $0x40,%rsp
+  8068c6:	5b                   	pop    %rbx
+  8068c7:	41 5f                	pop    %r15
+  8068c9:	5d                   	pop    %rbp
+  8068ca:	c3                   	ret
+
+00000000008068cb <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8068cb:	55                   	push   %rbp
+  8068cc:	48 89 e5             	mov    %rsp,%rbp
+  8068cf:	41 57                	push   %r15
+  8068d1:	53                   	push   %rbx
+  8068d2:	48 83 ec 70          	sub    $0x70,%rsp
+  8068d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8068d6 <ipc_callw+0xb>
+  8068dd:	49 bb 6a 27 00 00 00 	movabs $0x276a,%r11
+  8068e4:	00 00 00 
+  8068e7:	4c 01 db             	add    %r11,%rbx
+  8068ea:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  8068ed:	89 75 98             	mov    %esi,-0x68(%rbp)
+  8068f0:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  8068f4:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  8068f8:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  8068fd:	76 0a                	jbe    806909 <ipc_callw+0x3e>
+		return -E_INVAL;
+  8068ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806904:	e9 b7 00 00 00       	jmp    8069c0 <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  806909:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  80690d:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  806911:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  806915:	48 89 ce             	mov    %rcx,%rsi
+  806918:	48 89 c7             	mov    %rax,%rdi
+  80691b:	49 89 df             	mov    %rbx,%r15
+  80691e:	48 b8 cf 88 ff ff ff 	movabs $0xffffffffffff88cf,%rax
+  806925:	ff ff ff 
+  806928:	48 01 d8             	add    %rbx,%rax
+  80692b:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  80692d:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  806934:	00 
+  806935:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  806939:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80693d:	48 01 d0             	add    %rdx,%rax
+  806940:	48 83 e8 01          	sub    $0x1,%rax
+  806944:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806948:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80694c:	ba 00 00 00 00       	mov    $0x0,%edx
+  806951:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806955:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806959:	48 29 d0             	sub    %rdx,%rax
+  80695c:	48 c1 e8 03          	shr    $0x3,%rax
+  806960:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  806964:	89 c1                	mov    %eax,%ecx
+  806966:	8b 75 98             	mov    -0x68(%rbp),%esi
+  806969:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  80696d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  806970:	49 89 d1             	mov    %rdx,%r9
+  806973:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  80697a:	00 00 00 
+  80697d:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  806984:	00 00 00 
+  806987:	89 c7                	mov    %eax,%edi
+  806989:	49 89 df             	mov    %rbx,%r15
+  80698c:	48 b8 2d 95 ff ff ff 	movabs $0xffffffffffff952d,%rax
+  806993:	ff ff ff 
+  806996:	48 01 d8             	add    %rbx,%rax
+  806999:	ff d0                	call   *%rax
+  80699b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  80699e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8069a2:	74 05                	je     8069a9 <ipc_callw+0xde>
+		return r;
+  8069a4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8069a7:	eb 17                	jmp    8069c0 <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8069a9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8069b0:	ff ff ff 
+  8069b3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8069b7:	48 8b 00             	mov    (%rax),%rax
+  8069ba:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8069c0:	48 83 c4 70          	add    $0x70,%rsp
+  8069c4:	5b                   	pop    %rbx
+  8069c5:	41 5f                	pop    %r15
+  8069c7:	5d                   	pop    %rbp
+  8069c8:	c3                   	ret
+
+00000000008069c9 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8069c9:	55                   	push   %rbp
+  8069ca:	48 89 e5             	mov    %rsp,%rbp
+  8069cd:	41 57                	push   %r15
+  8069cf:	53                   	push   %rbx
+  8069d0:	48 83 ec 40          	sub    $0x40,%rsp
+  8069d4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069d4 <ipc_callv+0xb>
+  8069db:	49 bb 6c 26 00 00 00 	movabs $0x266c,%r11
+  8069e2:	00 00 00 
+  8069e5:	4c 01 db             	add    %r11,%rbx
+  8069e8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8069eb:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  8069ee:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8069f2:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8069f5:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  8069f9:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  8069fd:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806a04:	00 00 00 
+  806a07:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  806a0b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  806a0f:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  806a13:	74 11                	je     806a26 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  806a15:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806a19:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  806a1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  806a20:	c1 e0 14             	shl    $0x14,%eax
+  806a23:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  806a26:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  806a2a:	74 14                	je     806a40 <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  806a2c:	8b 45 20             	mov    0x20(%rbp),%eax
+  806a2f:	83 e8 01             	sub    $0x1,%eax
+  806a32:	48 63 d0             	movslq %eax,%rdx
+  806a35:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  806a39:	48 09 d0             	or     %rdx,%rax
+  806a3c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  806a40:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806a43:	c1 e0 10             	shl    $0x10,%eax
+  806a46:	0b 45 10             	or     0x10(%rbp),%eax
+  806a49:	89 c1                	mov    %eax,%ecx
+  806a4b:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  806a4e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  806a52:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806a56:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806a5a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806a5d:	4d 89 c1             	mov    %r8,%r9
+  806a60:	49 89 f8             	mov    %rdi,%r8
+  806a63:	89 c7                	mov    %eax,%edi
+  806a65:	49 89 df             	mov    %rbx,%r15
+  806a68:	48 b8 2d 95 ff ff ff 	movabs $0xffffffffffff952d,%rax
+  806a6f:	ff ff ff 
+  806a72:	48 01 d8             	add    %rbx,%rax
+  806a75:	ff d0                	call   *%rax
+  806a77:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  806a7a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806a7e:	74 05                	je     806a85 <ipc_callv+0xbc>
+		return r;
+  806a80:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806a83:	eb 17                	jmp    806a9c <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  806a85:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806a8c:	ff ff ff 
+  806a8f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806a93:	48 8b 00             	mov    (%rax),%rax
+  806a96:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806a9c:	48 83 c4 40          	add    $0x40,%rsp
+  806aa0:	5b                   	pop    %rbx
+  806aa1:	41 5f                	pop    %r15
+  806aa3:	5d                   	pop    %rbp
+  806aa4:	c3                   	ret
+
+0000000000806aa5 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  806aa5:	55                   	push   %rbp
+  806aa6:	48 89 e5             	mov    %rsp,%rbp
+  806aa9:	41 57                	push   %r15
+  806aab:	53                   	push   %rbx
+  806aac:	48 83 ec 40          	sub    $0x40,%rsp
+  806ab0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ab0 <ipc_reply_recv+0xb>
+  806ab7:	49 bb 90 25 00 00 00 	movabs $0x2590,%r11
+  806abe:	00 00 00 
+  806ac1:	4c 01 db             	add    %r11,%rbx
+  806ac4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  806ac7:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  806aca:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  806ace:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  806ad1:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  806ad5:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  806ad9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806ade:	75 0e                	jne    806aee <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  806ae0:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806ae7:	00 00 00 
+  806aea:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  806aee:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  806af3:	75 0e                	jne    806b03 <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  806af5:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  806afc:	00 00 00 
+  806aff:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  806b03:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  806b06:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  806b0a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  806b0e:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  806b11:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806b15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806b18:	4d 89 c1             	mov    %r8,%r9
+  806b1b:	49 89 f8             	mov    %rdi,%r8
+  806b1e:	89 c7                	mov    %eax,%edi
+  806b20:	49 89 df             	mov    %rbx,%r15
+  806b23:	48 b8 a1 95 ff ff ff 	movabs $0xffffffffffff95a1,%rax
+  806b2a:	ff ff ff 
+  806b2d:	48 01 d8             	add    %rbx,%rax
+  806b30:	ff d0                	call   *%rax
+  806b32:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  806b35:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  806b3a:	74 2a                	je     806b66 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  806b3c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b40:	75 19                	jne    806b5b <ipc_reply_recv+0xb6>
+  806b42:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b49:	ff ff ff 
+  806b4c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b50:	48 8b 00             	mov    (%rax),%rax
+  806b53:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  806b59:	eb 05                	jmp    806b60 <ipc_reply_recv+0xbb>
+  806b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806b64:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  806b66:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  806b6b:	74 2a                	je     806b97 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  806b6d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b71:	75 19                	jne    806b8c <ipc_reply_recv+0xe7>
+  806b73:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806b7a:	ff ff ff 
+  806b7d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806b81:	48 8b 00             	mov    (%rax),%rax
+  806b84:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  806b8a:	eb 05                	jmp    806b91 <ipc_reply_recv+0xec>
+  806b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b91:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  806b95:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  806b97:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b9b:	74 05                	je     806ba2 <ipc_reply_recv+0xfd>
+		return r;
+  806b9d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ba0:	eb 17                	jmp    806bb9 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  806ba2:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806ba9:	ff ff ff 
+  806bac:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806bb0:	48 8b 00             	mov    (%rax),%rax
+  806bb3:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  806bb9:	48 83 c4 40          	add    $0x40,%rsp
+  806bbd:	5b                   	pop    %rbx
+  806bbe:	41 5f                	pop    %r15
+  806bc0:	5d                   	pop    %rbp
+  806bc1:	c3                   	ret
+
+0000000000806bc2 <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  806bc2:	55                   	push   %rbp
+  806bc3:	48 89 e5             	mov    %rsp,%rbp
+  806bc6:	41 57                	push   %r15
+  806bc8:	53                   	push   %rbx
+  806bc9:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  806bd0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806bd0 <ipc_window_batch+0xe>
+  806bd7:	49 bb 70 24 00 00 00 	movabs $0x2470,%r11
+  806bde:	00 00 00 
+  806be1:	4c 01 db             	add    %r11,%rbx
+  806be4:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  806bea:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  806bf1:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  806bf7:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  806bfd:	e9 15 01 00 00       	jmp    806d17 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  806c02:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  806c08:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  806c0b:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  806c12:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806c15:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806c18:	39 c2                	cmp    %eax,%edx
+  806c1a:	0f 4e c2             	cmovle %edx,%eax
+  806c1d:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  806c20:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806c27:	eb 6b                	jmp    806c94 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  806c29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c2c:	48 98                	cltq
+  806c2e:	48 c1 e0 05          	shl    $0x5,%rax
+  806c32:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806c36:	48 01 e8             	add    %rbp,%rax
+  806c39:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  806c3f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  806c45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c48:	c1 e0 0c             	shl    $0xc,%eax
+  806c4b:	48 63 d0             	movslq %eax,%rdx
+  806c4e:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  806c55:	48 01 c2             	add    %rax,%rdx
+  806c58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c5b:	48 98                	cltq
+  806c5d:	48 c1 e0 05          	shl    $0x5,%rax
+  806c61:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806c65:	48 01 e8             	add    %rbp,%rax
+  806c68:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  806c6e:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  806c71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c74:	48 98                	cltq
+  806c76:	48 c1 e0 05          	shl    $0x5,%rax
+  806c7a:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  806c7e:	48 01 e8             	add    %rbp,%rax
+  806c81:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  806c88:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  806c8e:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  806c90:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  806c94:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c97:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  806c9a:	7c 8d                	jl     806c29 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  806c9c:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  806ca3:	74 27                	je     806ccc <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806ca5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806ca8:	48 63 d0             	movslq %eax,%rdx
+  806cab:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806cb2:	48 89 d6             	mov    %rdx,%rsi
+  806cb5:	48 89 c7             	mov    %rax,%rdi
+  806cb8:	49 89 df             	mov    %rbx,%r15
+  806cbb:	48 b8 44 98 ff ff ff 	movabs $0xffffffffffff9844,%rax
+  806cc2:	ff ff ff 
+  806cc5:	48 01 d8             	add    %rbx,%rax
+  806cc8:	ff d0                	call   *%rax
+  806cca:	eb 25                	jmp    806cf1 <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  806ccc:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806ccf:	48 63 d0             	movslq %eax,%rdx
+  806cd2:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  806cd9:	48 89 d6             	mov    %rdx,%rsi
+  806cdc:	48 89 c7             	mov    %rax,%rdi
+  806cdf:	49 89 df             	mov    %rbx,%r15
+  806ce2:	48 b8 a2 98 ff ff ff 	movabs $0xffffffffffff98a2,%rax
+  806ce9:	ff ff ff 
+  806cec:	48 01 d8             	add    %rbx,%rax
+  806cef:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  806cf1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  806cf4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  806cf8:	79 05                	jns    806cff <ipc_window_batch+0x13d>
+			return r;
+  806cfa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806cfd:	eb 2a                	jmp    806d29 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  806cff:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806d02:	c1 e0 0c             	shl    $0xc,%eax
+  806d05:	48 98                	cltq
+  806d07:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  806d0e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  806d11:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  806d17:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  806d1e:	0f 8f de fe ff ff    	jg     806c02 <ipc_window_batch+0x40>
+	}
+	return 0;
+  806d24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806d29:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  806d30:	5b                   	pop    %rbx
+  806d31:	41 5f                	pop    %r15
+  806d33:	5d                   	pop    %rbp
+  806d34:	c3                   	ret
+
+0000000000806d35 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  806d35:	55                   	push   %rbp
+  806d36:	48 89 e5             	mov    %rsp,%rbp
+  806d39:	48 83 ec 10          	sub    $0x10,%rsp
+  806d3d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d3d <ipc_map_window+0x8>
+  806d44:	49 bb 03 23 00 00 00 	movabs $0x2303,%r11
+  806d4b:	00 00 00 
+  806d4e:	4c 01 d8             	add    %r11,%rax
+  806d51:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806d55:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  806d58:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806d5b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806d5f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  806d64:	bf 01 00 00 00       	mov    $0x1,%edi
+  806d69:	49 b8 82 db ff ff ff 	movabs $0xffffffffffffdb82,%r8
+  806d70:	ff ff ff 
+  806d73:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806d77:	ff d0                	call   *%rax
+}
+  806d79:	c9                   	leave
+  806d7a:	c3                   	ret
+
+0000000000806d7b <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  806d7b:	55                   	push   %rbp
+  806d7c:	48 89 e5             	mov    %rsp,%rbp
+  806d7f:	48 83 ec 10          	sub    $0x10,%rsp
+  806d83:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806d83 <ipc_unmap_window+0x8>
+  806d8a:	49 bb bd 22 00 00 00 	movabs $0x22bd,%r11
+  806d91:	00 00 00 
+  806d94:	4c 01 d8             	add    %r11,%rax
+  806d97:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806d9b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  806d9e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806da1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  806da5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806daa:	bf 00 00 00 00       	mov    $0x0,%edi
+  806daf:	49 b8 82 db ff ff ff 	movabs $0xffffffffffffdb82,%r8
+  806db6:	ff ff ff 
+  806db9:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  806dbd:	ff d0                	call   *%rax
+}
+  806dbf:	c9                   	leave
+  806dc0:	c3                   	ret
+
+0000000000806dc1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  806dc1:	55                   	push   %rbp
+  806dc2:	48 89 e5             	mov    %rsp,%rbp
+  806dc5:	48 83 ec 18          	sub    $0x18,%rsp
+  806dc9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806dc9 <ipc_find_env+0x8>
+  806dd0:	49 bb 77 22 00 00 00 	movabs $0x2277,%r11
+  806dd7:	00 00 00 
+  806dda:	4c 01 d8             	add    %r11,%rax
+  806ddd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  806de0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806de7:	eb 57                	jmp    806e40 <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  806de9:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806df0:	ff ff ff 
+  806df3:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  806df7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806dfa:	48 63 d2             	movslq %edx,%rdx
+  806dfd:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  806e04:	48 01 ca             	add    %rcx,%rdx
+  806e07:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  806e0e:	8b 12                	mov    (%rdx),%edx
+  806e10:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  806e13:	75 27                	jne    806e3c <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  806e15:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  806e1c:	ff ff ff 
+  806e1f:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806e23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806e26:	48 98                	cltq
+  806e28:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  806e2f:	48 01 d0             	add    %rdx,%rax
+  806e32:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806e38:	8b 00                	mov    (%rax),%eax
+  806e3a:	eb 12                	jmp    806e4e <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  806e3c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806e40:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806e47:	7e a0                	jle    806de9 <ipc_find_env+0x28>
+	}
+	return 0;
+  806e49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806e4e:	c9                   	leave
+  806e4f:	c3                   	ret
+
+0000000000806e50 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806e50:	55                   	push   %rbp
+  806e51:	48 89 e5             	mov    %rsp,%rbp
+  806e54:	48 83 ec 18          	sub    $0x18,%rsp
+  806e58:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e58 <pageref+0x8>
+  806e5f:	49 bb e8 21 00 00 00 	movabs $0x21e8,%r11
+  806e66:	00 00 00 
+  806e69:	4c 01 d8             	add    %r11,%rax
+  806e6c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806e70:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806e74:	48 89 d1             	mov    %rdx,%rcx
+  806e77:	48 c1 e9 15          	shr    $0x15,%rcx
+  806e7b:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806e82:	ff ff ff 
+  806e85:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806e89:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806e8d:	83 e2 01             	and    $0x1,%edx
+  806e90:	48 85 d2             	test   %rdx,%rdx
+  806e93:	75 07                	jne    806e9c <pageref+0x4c>
+		return 0;
+  806e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e9a:	eb 64                	jmp    806f00 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806e9c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806ea0:	48 89 d1             	mov    %rdx,%rcx
+  806ea3:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806ea7:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806eae:	ff ff ff 
+  806eb1:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806eb5:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806eb9:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806ebd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806ec1:	83 e2 01             	and    $0x1,%edx
+  806ec4:	48 85 d2             	test   %rdx,%rdx
+  806ec7:	75 07                	jne    806ed0 <pageref+0x80>
+		return 0;
+  806ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ece:	eb 30                	jmp    806f00 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806ed0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806ed4:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806ed8:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806edf:	ff ff ff 
+  806ee2:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806ee6:	48 89 d0             	mov    %rdx,%rax
+  806ee9:	48 01 c0             	add    %rax,%rax
+  806eec:	48 01 d0             	add    %rdx,%rax
+  806eef:	48 c1 e0 03          	shl    $0x3,%rax
+  806ef3:	48 01 c8             	add    %rcx,%rax
+  806ef6:	48 83 c0 08          	add    $0x8,%rax
+  806efa:	0f b7 00             	movzwl (%rax),%eax
+  806efd:	0f b7 c0             	movzwl %ax,%eax
+}
+  806f00:	c9                   	leave
+  806f01:	c3                   	ret
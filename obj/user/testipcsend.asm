@@ -0,0 +1,10725 @@
+
+obj/user/testipcsend:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 cb 03 00 00       	call   80040c <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <wait_blocked>:
+#define NSENDERS	4
+
+// Wait until 'envid' is blocked, as a sender or receiver.
+static void
+wait_blocked(envid_t envid)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 20          	sub    $0x20,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <wait_blocked+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	const volatile struct Env *e = &envs[ENVX(envid)];
+  800065:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800068:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80006d:	48 98                	cltq
+  80006f:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800076:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80007d:	ff ff ff 
+  800080:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800084:	48 01 d0             	add    %rdx,%rax
+  800087:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	while (e->env_status != ENV_NOT_RUNNABLE)
+  80008b:	eb 12                	jmp    80009f <wait_blocked+0x5c>
+		sys_yield();
+  80008d:	49 89 df             	mov    %rbx,%r15
+  800090:	48 b8 d6 91 ff ff ff 	movabs $0xffffffffffff91d6,%rax
+  800097:	ff ff ff 
+  80009a:	48 01 d8             	add    %rbx,%rax
+  80009d:	ff d0                	call   *%rax
+	while (e->env_status != ENV_NOT_RUNNABLE)
+  80009f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8000a3:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8000a9:	83 f8 04             	cmp    $0x4,%eax
+  8000ac:	75 df                	jne    80008d <wait_blocked+0x4a>
+}
+  8000ae:	90                   	nop
+  8000af:	90                   	nop
+  8000b0:	48 83 c4 20          	add    $0x20,%rsp
+  8000b4:	5b                   	pop    %rbx
+  8000b5:	41 5f                	pop    %r15
+  8000b7:	5d                   	pop    %rbp
+  8000b8:	c3                   	ret
+
+00000000008000b9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000b9:	55                   	push   %rbp
+  8000ba:	48 89 e5             	mov    %rsp,%rbp
+  8000bd:	41 57                	push   %r15
+  8000bf:	53                   	push   %rbx
+  8000c0:	48 83 ec 40          	sub    $0x40,%rsp
+  8000c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8000c4 <umain+0xb>
+  8000cb:	49 bb 7c 8f 00 00 00 	movabs $0x8f7c,%r11
+  8000d2:	00 00 00 
+  8000d5:	4c 01 db             	add    %r11,%rbx
+  8000d8:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  8000db:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+	envid_t parent = thisenv->env_id, from, who[NSENDERS];
+  8000df:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8000e6:	ff ff ff 
+  8000e9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8000ed:	48 8b 00             	mov    (%rax),%rax
+  8000f0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8000f6:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	uint32_t v;
+	int i, r, inorder = 1;
+  8000f9:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%rbp)
+
+	for (i = 0; i < NSENDERS; i++) {
+  800100:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800107:	e9 c0 00 00 00       	jmp    8001cc <umain+0x113>
+		if ((r = fork()) < 0)
+  80010c:	49 89 df             	mov    %rbx,%r15
+  80010f:	48 b8 ba a1 ff ff ff 	movabs $0xffffffffffffa1ba,%rax
+  800116:	ff ff ff 
+  800119:	48 01 d8             	add    %rbx,%rax
+  80011c:	ff d0                	call   *%rax
+  80011e:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  800121:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800125:	79 44                	jns    80016b <umain+0xb2>
+			panic("fork: %e", r);
+  800127:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80012a:	89 c1                	mov    %eax,%ecx
+  80012c:	48 b8 70 de ff ff ff 	movabs $0xffffffffffffde70,%rax
+  800133:	ff ff ff 
+  800136:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80013a:	48 89 c2             	mov    %rax,%rdx
+  80013d:	be 1b 00 00 00       	mov    $0x1b,%esi
+  800142:	48 b8 79 de ff ff ff 	movabs $0xffffffffffffde79,%rax
+  800149:	ff ff ff 
+  80014c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800150:	48 89 c7             	mov    %rax,%rdi
+  800153:	49 89 df             	mov    %rbx,%r15
+  800156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015b:	49 b8 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r8
+  800162:	ff ff ff 
+  800165:	49 01 d8             	add    %rbx,%r8
+  800168:	41 ff d0             	call   *%r8
+		if (r == 0) {
+  80016b:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80016f:	75 36                	jne    8001a7 <umain+0xee>
+			ipc_send(parent, i, 0, 0);
+  800171:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  800174:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800177:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80017c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800181:	89 c7                	mov    %eax,%edi
+  800183:	49 89 df             	mov    %rbx,%r15
+  800186:	48 b8 49 a6 ff ff ff 	movabs $0xffffffffffffa649,%rax
+  80018d:	ff ff ff 
+  800190:	48 01 d8             	add    %rbx,%rax
+  800193:	ff d0                	call   *%rax
+			exit();
+  800195:	49 89 df             	mov    %rbx,%r15
+  800198:	48 b8 8c 74 ff ff ff 	movabs $0xffffffffffff748c,%rax
+  80019f:	ff ff ff 
+  8001a2:	48 01 d8             	add    %rbx,%rax
+  8001a5:	ff d0                	call   *%rax
+		}
+		who[i] = r;
+  8001a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001aa:	48 98                	cltq
+  8001ac:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8001af:	89 54 85 c0          	mov    %edx,-0x40(%rbp,%rax,4)
+		// Child i must be on our queue before we fork the next.
+		wait_blocked(r);
+  8001b3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  8001bf:	ff ff ff 
+  8001c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8001c6:	ff d0                	call   *%rax
+	for (i = 0; i < NSENDERS; i++) {
+  8001c8:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8001cc:	83 7d ec 03          	cmpl   $0x3,-0x14(%rbp)
+  8001d0:	0f 8e 36 ff ff ff    	jle    80010c <umain+0x53>
+	}
+
+	for (i = 0; i < NSENDERS; i++) {
+  8001d6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8001dd:	e9 9b 00 00 00       	jmp    80027d <umain+0x1c4>
+		v = ipc_recv(&from, 0, 0);
+  8001e2:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8001e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8001f0:	48 89 c7             	mov    %rax,%rdi
+  8001f3:	49 89 df             	mov    %rbx,%r15
+  8001f6:	48 b8 60 a5 ff ff ff 	movabs $0xffffffffffffa560,%rax
+  8001fd:	ff ff ff 
+  800200:	48 01 d8             	add    %rbx,%rax
+  800203:	ff d0                	call   *%rax
+  800205:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (from != who[v])
+  800208:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80020b:	8b 54 85 c0          	mov    -0x40(%rbp,%rax,4),%edx
+  80020f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800212:	39 c2                	cmp    %eax,%edx
+  800214:	74 54                	je     80026a <umain+0x1b1>
+			panic("message %d from %08x, not %08x", v, from, who[v]);
+  800216:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800219:	8b 4c 85 c0          	mov    -0x40(%rbp,%rax,4),%ecx
+  80021d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800220:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800223:	41 89 c9             	mov    %ecx,%r9d
+  800226:	41 89 d0             	mov    %edx,%r8d
+  800229:	89 c1                	mov    %eax,%ecx
+  80022b:	48 b8 90 de ff ff ff 	movabs $0xffffffffffffde90,%rax
+  800232:	ff ff ff 
+  800235:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800239:	48 89 c2             	mov    %rax,%rdx
+  80023c:	be 28 00 00 00       	mov    $0x28,%esi
+  800241:	48 b8 79 de ff ff ff 	movabs $0xffffffffffffde79,%rax
+  800248:	ff ff ff 
+  80024b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80024f:	48 89 c7             	mov    %rax,%rdi
+  800252:	49 89 df             	mov    %rbx,%r15
+  800255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025a:	49 ba d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r10
+  800261:	ff ff ff 
+  800264:	49 01 da             	add    %rbx,%r10
+  800267:	41 ff d2             	call   *%r10
+		if (v != i)
+  80026a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80026d:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  800270:	74 07                	je     800279 <umain+0x1c0>
+			inorder = 0;
+  800272:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%rbp)
+	for (i = 0; i < NSENDERS; i++) {
+  800279:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80027d:	83 7d ec 03          	cmpl   $0x3,-0x14(%rbp)
+  800281:	0f 8e 5b ff ff ff    	jle    8001e2 <umain+0x129>
+	}
+	cprintf("senders served in order %s\n", inorder ? "right" : "wrong");
+  800287:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80028b:	74 10                	je     80029d <umain+0x1e4>
+  80028d:	48 b8 af de ff ff ff 	movabs $0xffffffffffffdeaf,%rax
+  800294:	ff ff ff 
+  800297:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80029b:	eb 0e                	jmp    8002ab <umain+0x1f2>
+  80029d:	48 b8 b5 de ff ff ff 	movabs $0xffffffffffffdeb5,%rax
+  8002a4:	ff ff ff 
+  8002a7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002ab:	48 89 c6             	mov    %rax,%rsi
+  8002ae:	48 b8 bb de ff ff ff 	movabs $0xffffffffffffdebb,%rax
+  8002b5:	ff ff ff 
+  8002b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002bc:	48 89 c7             	mov    %rax,%rdi
+  8002bf:	49 89 df             	mov    %rbx,%r15
+  8002c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c7:	48 ba ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rdx
+  8002ce:	ff ff ff 
+  8002d1:	48 01 da             	add    %rbx,%rdx
+  8002d4:	ff d2                	call   *%rdx
+
+	// A sender to an env that dies is let go.
+	if ((r = fork()) < 0)
+  8002d6:	49 89 df             	mov    %rbx,%r15
+  8002d9:	48 b8 ba a1 ff ff ff 	movabs $0xffffffffffffa1ba,%rax
+  8002e0:	ff ff ff 
+  8002e3:	48 01 d8             	add    %rbx,%rax
+  8002e6:	ff d0                	call   *%rax
+  8002e8:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  8002eb:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8002ef:	79 44                	jns    800335 <umain+0x27c>
+		panic("fork: %e", r);
+  8002f1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8002f4:	89 c1                	mov    %eax,%ecx
+  8002f6:	48 b8 70 de ff ff ff 	movabs $0xffffffffffffde70,%rax
+  8002fd:	ff ff ff 
+  800300:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800304:	48 89 c2             	mov    %rax,%rdx
+  800307:	be 30 00 00 00       	mov    $0x30,%esi
+  80030c:	48 b8 79 de ff ff ff 	movabs $0xffffffffffffde79,%rax
+  800313:	ff ff ff 
+  800316:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80031a:	48 89 c7             	mov    %rax,%rdi
+  80031d:	49 89 df             	mov    %rbx,%r15
+  800320:	b8 00 00 00 00       	mov    $0x0,%eax
+  800325:	49 b8 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r8
+  80032c:	ff ff ff 
+  80032f:	49 01 d8             	add    %rbx,%r8
+  800332:	41 ff d0             	call   *%r8
+	if (r == 0) {
+  800335:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800339:	75 27                	jne    800362 <umain+0x2a9>
+		wait_blocked(parent);
+  80033b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80033e:	89 c7                	mov    %eax,%edi
+  800340:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800347:	ff ff ff 
+  80034a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80034e:	ff d0                	call   *%rax
+		exit();
+  800350:	49 89 df             	mov    %rbx,%r15
+  800353:	48 b8 8c 74 ff ff ff 	movabs $0xffffffffffff748c,%rax
+  80035a:	ff ff ff 
+  80035d:	48 01 d8             	add    %rbx,%rax
+  800360:	ff d0                	call   *%rax
+	}
+	r = sys_ipc_send(r, 0, (void *) UTOP, 0);
+  800362:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800365:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80036a:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800371:	00 00 00 
+  800374:	be 00 00 00 00       	mov    $0x0,%esi
+  800379:	89 c7                	mov    %eax,%edi
+  80037b:	49 89 df             	mov    %rbx,%r15
+  80037e:	48 b8 ea 94 ff ff ff 	movabs $0xffffffffffff94ea,%rax
+  800385:	ff ff ff 
+  800388:	48 01 d8             	add    %rbx,%rax
+  80038b:	ff d0                	call   *%rax
+  80038d:	89 45 e0             	mov    %eax,-0x20(%rbp)
+	if (r != -E_BAD_ENV)
+  800390:	83 7d e0 fe          	cmpl   $0xfffffffe,-0x20(%rbp)
+  800394:	74 44                	je     8003da <umain+0x321>
+		panic("send to an exiting env returned %e", r);
+  800396:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800399:	89 c1                	mov    %eax,%ecx
+  80039b:	48 b8 d8 de ff ff ff 	movabs $0xffffffffffffded8,%rax
+  8003a2:	ff ff ff 
+  8003a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003a9:	48 89 c2             	mov    %rax,%rdx
+  8003ac:	be 37 00 00 00       	mov    $0x37,%esi
+  8003b1:	48 b8 79 de ff ff ff 	movabs $0xffffffffffffde79,%rax
+  8003b8:	ff ff ff 
+  8003bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003bf:	48 89 c7             	mov    %rax,%rdi
+  8003c2:	49 89 df             	mov    %rbx,%r15
+  8003c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ca:	49 b8 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r8
+  8003d1:	ff ff ff 
+  8003d4:	49 01 d8             	add    %rbx,%r8
+  8003d7:	41 ff d0             	call   *%r8
+	cprintf("send to an exiting env fails right\n");
+  8003da:	48 b8 00 df ff ff ff 	movabs $0xffffffffffffdf00,%rax
+  8003e1:	ff ff ff 
+  8003e4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003e8:	48 89 c7             	mov    %rax,%rdi
+  8003eb:	49 89 df             	mov    %rbx,%r15
+  8003ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f3:	48 ba ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rdx
+  8003fa:	ff ff ff 
+  8003fd:	48 01 da             	add    %rbx,%rdx
+  800400:	ff d2                	call   *%rdx
+}
+  800402:	90                   	nop
+  800403:	48 83 c4 40          	add    $0x40,%rsp
+  800407:	5b                   	pop    %rbx
+  800408:	41 5f                	pop    %r15
+  80040a:	5d                   	pop    %rbp
+  80040b:	c3                   	ret
+
+000000000080040c <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80040c:	55                   	push   %rbp
+  80040d:	48 89 e5             	mov    %rsp,%rbp
+  800410:	41 57                	push   %r15
+  800412:	53                   	push   %rbx
+  800413:	48 83 ec 20          	sub    $0x20,%rsp
+  800417:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800417 <libmain+0xb>
+  80041e:	49 bb 29 8c 00 00 00 	movabs $0x8c29,%r11
+  800425:	00 00 00 
+  800428:	4c 01 db             	add    %r11,%rbx
+  80042b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80042e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800432:	49 89 df             	mov    %rbx,%r15
+  800435:	48 b8 82 91 ff ff ff 	movabs $0xffffffffffff9182,%rax
+  80043c:	ff ff ff 
+  80043f:	48 01 d8             	add    %rbx,%rax
+  800442:	ff d0                	call   *%rax
+  800444:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  800447:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80044a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80044f:	48 98                	cltq
+  800451:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  800458:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80045f:	ff ff ff 
+  800462:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  800466:	48 01 c2             	add    %rax,%rdx
+  800469:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  800470:	00 00 00 
+  800473:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800477:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80047b:	7e 15                	jle    800492 <libmain+0x86>
+		binaryname = argv[0];
+  80047d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800481:	48 8b 00             	mov    (%rax),%rax
+  800484:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  80048b:	00 00 00 
+  80048e:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  800492:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  800496:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800499:	48 89 d6             	mov    %rdx,%rsi
+  80049c:	89 c7                	mov    %eax,%edi
+  80049e:	49 89 df             	mov    %rbx,%r15
+  8004a1:	48 b8 79 70 ff ff ff 	movabs $0xffffffffffff7079,%rax
+  8004a8:	ff ff ff 
+  8004ab:	48 01 d8             	add    %rbx,%rax
+  8004ae:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  8004b0:	49 89 df             	mov    %rbx,%r15
+  8004b3:	48 b8 8c 74 ff ff ff 	movabs $0xffffffffffff748c,%rax
+  8004ba:	ff ff ff 
+  8004bd:	48 01 d8             	add    %rbx,%rax
+  8004c0:	ff d0                	call   *%rax
+}
+  8004c2:	90                   	nop
+  8004c3:	48 83 c4 20          	add    $0x20,%rsp
+  8004c7:	5b                   	pop    %rbx
+  8004c8:	41 5f                	pop    %r15
+  8004ca:	5d                   	pop    %rbp
+  8004cb:	c3                   	ret
+
+00000000008004cc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004cc:	55                   	push   %rbp
+  8004cd:	48 89 e5             	mov    %rsp,%rbp
+  8004d0:	41 57                	push   %r15
+  8004d2:	53                   	push   %rbx
+  8004d3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8004d3 <exit+0x7>
+  8004da:	49 bb 6d 8b 00 00 00 	movabs $0x8b6d,%r11
+  8004e1:	00 00 00 
+  8004e4:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  8004e7:	49 89 df             	mov    %rbx,%r15
+  8004ea:	48 b8 57 b1 ff ff ff 	movabs $0xffffffffffffb157,%rax
+  8004f1:	ff ff ff 
+  8004f4:	48 01 d8             	add    %rbx,%rax
+  8004f7:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  8004f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004fe:	49 89 df             	mov    %rbx,%r15
+  800501:	48 b8 26 91 ff ff ff 	movabs $0xffffffffffff9126,%rax
+  800508:	ff ff ff 
+  80050b:	48 01 d8             	add    %rbx,%rax
+  80050e:	ff d0                	call   *%rax
+}
+  800510:	90                   	nop
+  800511:	5b                   	pop    %rbx
+  800512:	41 5f                	pop    %r15
+  800514:	5d                   	pop    %rbp
+  800515:	c3                   	ret
+
+0000000000800516 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800516:	55                   	push   %rbp
+  800517:	48 89 e5             	mov    %rsp,%rbp
+  80051a:	41 57                	push   %r15
+  80051c:	41 54                	push   %r12
+  80051e:	53                   	push   %rbx
+  80051f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800526:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800526 <_panic+0x10>
+  80052d:	49 bb 1a 8b 00 00 00 	movabs $0x8b1a,%r11
+  800534:	00 00 00 
+  800537:	4c 01 db             	add    %r11,%rbx
+  80053a:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800541:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  800547:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  80054e:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  800555:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  80055c:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  800563:	84 c0                	test   %al,%al
+  800565:	74 26                	je     80058d <_panic+0x77>
+  800567:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  80056e:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  800575:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  800579:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  80057d:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  800581:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  800585:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  800589:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  80058d:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  800594:	00 00 00 
+  800597:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  80059e:	00 00 00 
+  8005a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a5:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  8005ac:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8005b3:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005ba:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  8005c1:	ff ff ff 
+  8005c4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8005c8:	4c 8b 20             	mov    (%rax),%r12
+  8005cb:	49 89 df             	mov    %rbx,%r15
+  8005ce:	48 b8 82 91 ff ff ff 	movabs $0xffffffffffff9182,%rax
+  8005d5:	ff ff ff 
+  8005d8:	48 01 d8             	add    %rbx,%rax
+  8005db:	ff d0                	call   *%rax
+  8005dd:	89 c6                	mov    %eax,%esi
+  8005df:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  8005e5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8005ec:	41 89 d0             	mov    %edx,%r8d
+  8005ef:	48 89 c1             	mov    %rax,%rcx
+  8005f2:	4c 89 e2             	mov    %r12,%rdx
+  8005f5:	48 b8 30 df ff ff ff 	movabs $0xffffffffffffdf30,%rax
+  8005fc:	ff ff ff 
+  8005ff:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800603:	48 89 c7             	mov    %rax,%rdi
+  800606:	49 89 df             	mov    %rbx,%r15
+  800609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060e:	49 b9 ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%r9
+  800615:	ff ff ff 
+  800618:	49 01 d9             	add    %rbx,%r9
+  80061b:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80061e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800625:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80062c:	48 89 d6             	mov    %rdx,%rsi
+  80062f:	48 89 c7             	mov    %rax,%rdi
+  800632:	49 89 df             	mov    %rbx,%r15
+  800635:	48 b8 cd 76 ff ff ff 	movabs $0xffffffffffff76cd,%rax
+  80063c:	ff ff ff 
+  80063f:	48 01 d8             	add    %rbx,%rax
+  800642:	ff d0                	call   *%rax
+	cprintf("\n");
+  800644:	48 b8 53 df ff ff ff 	movabs $0xffffffffffffdf53,%rax
+  80064b:	ff ff ff 
+  80064e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800652:	48 89 c7             	mov    %rax,%rdi
+  800655:	49 89 df             	mov    %rbx,%r15
+  800658:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065d:	48 ba ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rdx
+  800664:	ff ff ff 
+  800667:	48 01 da             	add    %rbx,%rdx
+  80066a:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80066c:	cc                   	int3
+  80066d:	eb fd                	jmp    80066c <_panic+0x156>
+
+000000000080066f <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  80066f:	55                   	push   %rbp
+  800670:	48 89 e5             	mov    %rsp,%rbp
+  800673:	41 57                	push   %r15
+  800675:	48 83 ec 18          	sub    $0x18,%rsp
+  800679:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800679 <putch+0xa>
+  800680:	49 bb c7 89 00 00 00 	movabs $0x89c7,%r11
+  800687:	00 00 00 
+  80068a:	4c 01 d8             	add    %r11,%rax
+  80068d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800690:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  800694:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800698:	8b 12                	mov    (%rdx),%edx
+  80069a:	8d 72 01             	lea    0x1(%rdx),%esi
+  80069d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8006a1:	89 31                	mov    %esi,(%rcx)
+  8006a3:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  8006a6:	89 ce                	mov    %ecx,%esi
+  8006a8:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8006ac:	48 63 d2             	movslq %edx,%rdx
+  8006af:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  8006b4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006b8:	8b 12                	mov    (%rdx),%edx
+  8006ba:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8006c0:	75 33                	jne    8006f5 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  8006c2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006c6:	8b 12                	mov    (%rdx),%edx
+  8006c8:	48 63 d2             	movslq %edx,%rdx
+  8006cb:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8006cf:	48 83 c1 08          	add    $0x8,%rcx
+  8006d3:	48 89 d6             	mov    %rdx,%rsi
+  8006d6:	48 89 cf             	mov    %rcx,%rdi
+  8006d9:	49 89 c7             	mov    %rax,%r15
+  8006dc:	48 ba 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rdx
+  8006e3:	ff ff ff 
+  8006e6:	48 01 c2             	add    %rax,%rdx
+  8006e9:	ff d2                	call   *%rdx
+        b->idx = 0;
+  8006eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8006ef:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  8006f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8006f9:	8b 40 04             	mov    0x4(%rax),%eax
+  8006fc:	8d 50 01             	lea    0x1(%rax),%edx
+  8006ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800703:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800706:	90                   	nop
+  800707:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80070b:	c9                   	leave
+  80070c:	c3                   	ret
+
+000000000080070d <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80070d:	55                   	push   %rbp
+  80070e:	48 89 e5             	mov    %rsp,%rbp
+  800711:	41 57                	push   %r15
+  800713:	53                   	push   %rbx
+  800714:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80071b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80071b <vcprintf+0xe>
+  800722:	49 bb 25 89 00 00 00 	movabs $0x8925,%r11
+  800729:	00 00 00 
+  80072c:	4c 01 db             	add    %r11,%rbx
+  80072f:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800736:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80073d:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  800744:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  80074b:	48 8b 06             	mov    (%rsi),%rax
+  80074e:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800752:	48 89 01             	mov    %rax,(%rcx)
+  800755:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800759:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80075d:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  800761:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  800768:	00 00 00 
+    b.cnt = 0;
+  80076b:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  800772:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  800775:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  80077c:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  800783:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  80078a:	48 89 c6             	mov    %rax,%rsi
+  80078d:	48 b8 2f 76 ff ff ff 	movabs $0xffffffffffff762f,%rax
+  800794:	ff ff ff 
+  800797:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80079b:	48 89 c7             	mov    %rax,%rdi
+  80079e:	49 89 df             	mov    %rbx,%r15
+  8007a1:	48 b8 f1 7b ff ff ff 	movabs $0xffffffffffff7bf1,%rax
+  8007a8:	ff ff ff 
+  8007ab:	48 01 d8             	add    %rbx,%rax
+  8007ae:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  8007b0:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  8007b6:	48 98                	cltq
+  8007b8:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  8007bf:	48 83 c2 08          	add    $0x8,%rdx
+  8007c3:	48 89 c6             	mov    %rax,%rsi
+  8007c6:	48 89 d7             	mov    %rdx,%rdi
+  8007c9:	49 89 df             	mov    %rbx,%r15
+  8007cc:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  8007d3:	ff ff ff 
+  8007d6:	48 01 d8             	add    %rbx,%rax
+  8007d9:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  8007db:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  8007e1:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  8007e8:	5b                   	pop    %rbx
+  8007e9:	41 5f                	pop    %r15
+  8007eb:	5d                   	pop    %rbp
+  8007ec:	c3                   	ret
+
+00000000008007ed <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  8007ed:	55                   	push   %rbp
+  8007ee:	48 89 e5             	mov    %rsp,%rbp
+  8007f1:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  8007f8:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8007f8 <cprintf+0xb>
+  8007ff:	49 bb 48 88 00 00 00 	movabs $0x8848,%r11
+  800806:	00 00 00 
+  800809:	4d 01 da             	add    %r11,%r10
+  80080c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800813:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80081a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800821:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800828:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80082f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800836:	84 c0                	test   %al,%al
+  800838:	74 20                	je     80085a <cprintf+0x6d>
+  80083a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80083e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800842:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800846:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80084a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80084e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800852:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800856:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  80085a:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800861:	00 00 00 
+  800864:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80086b:	00 00 00 
+  80086e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800872:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800879:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800880:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  800887:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  80088e:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  800895:	48 8b 06             	mov    (%rsi),%rax
+  800898:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80089c:	48 89 01             	mov    %rax,(%rcx)
+  80089f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8008a3:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8008a7:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  8008ab:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  8008b2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8008b9:	48 89 d6             	mov    %rdx,%rsi
+  8008bc:	48 89 c7             	mov    %rax,%rdi
+  8008bf:	48 b8 cd 76 ff ff ff 	movabs $0xffffffffffff76cd,%rax
+  8008c6:	ff ff ff 
+  8008c9:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8008cd:	ff d0                	call   *%rax
+  8008cf:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  8008d5:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8008db:	c9                   	leave
+  8008dc:	c3                   	ret
+
+00000000008008dd <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8008dd:	55                   	push   %rbp
+  8008de:	48 89 e5             	mov    %rsp,%rbp
+  8008e1:	53                   	push   %rbx
+  8008e2:	48 83 ec 38          	sub    $0x38,%rsp
+  8008e6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8008e6 <printnum+0x9>
+  8008ed:	49 bb 5a 87 00 00 00 	movabs $0x875a,%r11
+  8008f4:	00 00 00 
+  8008f7:	4c 01 db             	add    %r11,%rbx
+  8008fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800902:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800906:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800909:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  80090d:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800911:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800914:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800918:	72 58                	jb     800972 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80091a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80091d:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800920:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800923:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800927:	ba 00 00 00 00       	mov    $0x0,%edx
+  80092c:	48 f7 f6             	div    %rsi
+  80092f:	49 89 c2             	mov    %rax,%r10
+  800932:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800935:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800938:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80093c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800940:	41 89 c9             	mov    %ecx,%r9d
+  800943:	41 89 f8             	mov    %edi,%r8d
+  800946:	89 d1                	mov    %edx,%ecx
+  800948:	4c 89 d2             	mov    %r10,%rdx
+  80094b:	48 89 c7             	mov    %rax,%rdi
+  80094e:	48 b8 9d 78 ff ff ff 	movabs $0xffffffffffff789d,%rax
+  800955:	ff ff ff 
+  800958:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80095c:	ff d0                	call   *%rax
+  80095e:	eb 1c                	jmp    80097c <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800960:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800964:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  800967:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80096b:	48 89 d6             	mov    %rdx,%rsi
+  80096e:	89 c7                	mov    %eax,%edi
+  800970:	ff d1                	call   *%rcx
+		while (--width > 0)
+  800972:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  800976:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80097a:	7f e4                	jg     800960 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80097c:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  80097f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800983:	ba 00 00 00 00       	mov    $0x0,%edx
+  800988:	48 f7 f1             	div    %rcx
+  80098b:	48 b8 8f e0 ff ff ff 	movabs $0xffffffffffffe08f,%rax
+  800992:	ff ff ff 
+  800995:	48 01 d8             	add    %rbx,%rax
+  800998:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80099c:	0f be c0             	movsbl %al,%eax
+  80099f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8009a3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009a7:	48 89 d6             	mov    %rdx,%rsi
+  8009aa:	89 c7                	mov    %eax,%edi
+  8009ac:	ff d1                	call   *%rcx
+}
+  8009ae:	90                   	nop
+  8009af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8009b3:	c9                   	leave
+  8009b4:	c3                   	ret
+
+00000000008009b5 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  8009b5:	55                   	push   %rbp
+  8009b6:	48 89 e5             	mov    %rsp,%rbp
+  8009b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8009bd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8009bd <getuint+0x8>
+  8009c4:	49 bb 83 86 00 00 00 	movabs $0x8683,%r11
+  8009cb:	00 00 00 
+  8009ce:	4c 01 d8             	add    %r11,%rax
+  8009d1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8009d5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  8009d8:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  8009dc:	7e 4f                	jle    800a2d <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  8009de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009e2:	8b 00                	mov    (%rax),%eax
+  8009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e7:	77 24                	ja     800a0d <getuint+0x58>
+  8009e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ed:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009f5:	8b 00                	mov    (%rax),%eax
+  8009f7:	89 c0                	mov    %eax,%eax
+  8009f9:	48 01 d0             	add    %rdx,%rax
+  8009fc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a00:	8b 12                	mov    (%rdx),%edx
+  800a02:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a09:	89 0a                	mov    %ecx,(%rdx)
+  800a0b:	eb 14                	jmp    800a21 <getuint+0x6c>
+  800a0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a11:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a15:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a19:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a1d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a21:	48 8b 00             	mov    (%rax),%rax
+  800a24:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a28:	e9 9d 00 00 00       	jmp    800aca <getuint+0x115>
+	else if (lflag)
+  800a2d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800a31:	74 4c                	je     800a7f <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800a33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a37:	8b 00                	mov    (%rax),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 24                	ja     800a62 <getuint+0xad>
+  800a3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a42:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a4a:	8b 00                	mov    (%rax),%eax
+  800a4c:	89 c0                	mov    %eax,%eax
+  800a4e:	48 01 d0             	add    %rdx,%rax
+  800a51:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a55:	8b 12                	mov    (%rdx),%edx
+  800a57:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a5a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a5e:	89 0a                	mov    %ecx,(%rdx)
+  800a60:	eb 14                	jmp    800a76 <getuint+0xc1>
+  800a62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a6a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a6e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a72:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a76:	48 8b 00             	mov    (%rax),%rax
+  800a79:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a7d:	eb 4b                	jmp    800aca <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800a7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a83:	8b 00                	mov    (%rax),%eax
+  800a85:	83 f8 2f             	cmp    $0x2f,%eax
+  800a88:	77 24                	ja     800aae <getuint+0xf9>
+  800a8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a8e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a96:	8b 00                	mov    (%rax),%eax
+  800a98:	89 c0                	mov    %eax,%eax
+  800a9a:	48 01 d0             	add    %rdx,%rax
+  800a9d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aa1:	8b 12                	mov    (%rdx),%edx
+  800aa3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800aa6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800aaa:	89 0a                	mov    %ecx,(%rdx)
+  800aac:	eb 14                	jmp    800ac2 <getuint+0x10d>
+  800aae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ab6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800aba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800abe:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ac2:	8b 00                	mov    (%rax),%eax
+  800ac4:	89 c0                	mov    %eax,%eax
+  800ac6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800aca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800ace:	c9                   	leave
+  800acf:	c3                   	ret
+
+0000000000800ad0 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800ad0:	55                   	push   %rbp
+  800ad1:	48 89 e5             	mov    %rsp,%rbp
+  800ad4:	48 83 ec 20          	sub    $0x20,%rsp
+  800ad8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800ad8 <printfloat+0x8>
+  800adf:	49 bb 68 85 00 00 00 	movabs $0x8568,%r11
+  800ae6:	00 00 00 
+  800ae9:	4c 01 d8             	add    %r11,%rax
+  800aec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800af0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800af4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800af8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800afc:	48 85 c0             	test   %rax,%rax
+  800aff:	79 12                	jns    800b13 <printfloat+0x43>
+		putch('-',putdat);
+  800b01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b05:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b09:	48 89 c6             	mov    %rax,%rsi
+  800b0c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b11:	ff d2                	call   *%rdx
+	
+}
+  800b13:	90                   	nop
+  800b14:	c9                   	leave
+  800b15:	c3                   	ret
+
+0000000000800b16 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800b16:	55                   	push   %rbp
+  800b17:	48 89 e5             	mov    %rsp,%rbp
+  800b1a:	48 83 ec 20          	sub    $0x20,%rsp
+  800b1e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b1e <getint+0x8>
+  800b25:	49 bb 22 85 00 00 00 	movabs $0x8522,%r11
+  800b2c:	00 00 00 
+  800b2f:	4c 01 d8             	add    %r11,%rax
+  800b32:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b36:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800b39:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800b3d:	7e 4f                	jle    800b8e <getint+0x78>
+		x=va_arg(*ap, long long);
+  800b3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b43:	8b 00                	mov    (%rax),%eax
+  800b45:	83 f8 2f             	cmp    $0x2f,%eax
+  800b48:	77 24                	ja     800b6e <getint+0x58>
+  800b4a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b4e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b56:	8b 00                	mov    (%rax),%eax
+  800b58:	89 c0                	mov    %eax,%eax
+  800b5a:	48 01 d0             	add    %rdx,%rax
+  800b5d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b61:	8b 12                	mov    (%rdx),%edx
+  800b63:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b66:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b6a:	89 0a                	mov    %ecx,(%rdx)
+  800b6c:	eb 14                	jmp    800b82 <getint+0x6c>
+  800b6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b72:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b76:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b7a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b7e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b82:	48 8b 00             	mov    (%rax),%rax
+  800b85:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800b89:	e9 9d 00 00 00       	jmp    800c2b <getint+0x115>
+	else if (lflag)
+  800b8e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800b92:	74 4c                	je     800be0 <getint+0xca>
+		x=va_arg(*ap, long);
+  800b94:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b98:	8b 00                	mov    (%rax),%eax
+  800b9a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b9d:	77 24                	ja     800bc3 <getint+0xad>
+  800b9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ba7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bab:	8b 00                	mov    (%rax),%eax
+  800bad:	89 c0                	mov    %eax,%eax
+  800baf:	48 01 d0             	add    %rdx,%rax
+  800bb2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bb6:	8b 12                	mov    (%rdx),%edx
+  800bb8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bbb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bbf:	89 0a                	mov    %ecx,(%rdx)
+  800bc1:	eb 14                	jmp    800bd7 <getint+0xc1>
+  800bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bc7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bcb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bcf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bd3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bd7:	48 8b 00             	mov    (%rax),%rax
+  800bda:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800bde:	eb 4b                	jmp    800c2b <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800be0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800be4:	8b 00                	mov    (%rax),%eax
+  800be6:	83 f8 2f             	cmp    $0x2f,%eax
+  800be9:	77 24                	ja     800c0f <getint+0xf9>
+  800beb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bef:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800bf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf7:	8b 00                	mov    (%rax),%eax
+  800bf9:	89 c0                	mov    %eax,%eax
+  800bfb:	48 01 d0             	add    %rdx,%rax
+  800bfe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c02:	8b 12                	mov    (%rdx),%edx
+  800c04:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c07:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c0b:	89 0a                	mov    %ecx,(%rdx)
+  800c0d:	eb 14                	jmp    800c23 <getint+0x10d>
+  800c0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c13:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c17:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c1b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c1f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c23:	8b 00                	mov    (%rax),%eax
+  800c25:	48 98                	cltq
+  800c27:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800c2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800c2f:	c9                   	leave
+  800c30:	c3                   	ret
+
+0000000000800c31 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800c31:	55                   	push   %rbp
+  800c32:	48 89 e5             	mov    %rsp,%rbp
+  800c35:	41 57                	push   %r15
+  800c37:	41 55                	push   %r13
+  800c39:	41 54                	push   %r12
+  800c3b:	53                   	push   %rbx
+  800c3c:	48 83 ec 60          	sub    $0x60,%rsp
+  800c40:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800c40 <vprintfmt+0xf>
+  800c47:	49 bb 00 84 00 00 00 	movabs $0x8400,%r11
+  800c4e:	00 00 00 
+  800c51:	4d 01 dc             	add    %r11,%r12
+  800c54:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800c58:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800c5c:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800c60:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800c64:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800c6b:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800c6f:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800c73:	48 8b 06             	mov    (%rsi),%rax
+  800c76:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800c7a:	48 89 01             	mov    %rax,(%rcx)
+  800c7d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800c81:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800c85:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c89:	eb 17                	jmp    800ca2 <vprintfmt+0x71>
+			if (ch == '\0')
+  800c8b:	85 db                	test   %ebx,%ebx
+  800c8d:	0f 84 97 05 00 00    	je     80122a <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800c93:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800c97:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800c9b:	48 89 c6             	mov    %rax,%rsi
+  800c9e:	89 df                	mov    %ebx,%edi
+  800ca0:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ca2:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800ca6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800caa:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800cae:	0f b6 00             	movzbl (%rax),%eax
+  800cb1:	0f b6 d8             	movzbl %al,%ebx
+  800cb4:	83 fb 25             	cmp    $0x25,%ebx
+  800cb7:	75 d2                	jne    800c8b <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800cb9:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800cbd:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800cc4:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800ccb:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800cd2:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800cd9:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800cdd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ce1:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800ce5:	0f b6 00             	movzbl (%rax),%eax
+  800ce8:	0f b6 d8             	movzbl %al,%ebx
+  800ceb:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800cee:	83 f8 55             	cmp    $0x55,%eax
+  800cf1:	0f 87 00 05 00 00    	ja     8011f7 <vprintfmt+0x5c6>
+  800cf7:	89 c0                	mov    %eax,%eax
+  800cf9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800d00:	00 
+  800d01:	48 8d 05 f0 63 00 00 	lea    0x63f0(%rip),%rax        # 8070f8 <.LC18+0xc>
+  800d08:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800d0c:	48 8d 15 e5 63 00 00 	lea    0x63e5(%rip),%rdx        # 8070f8 <.LC18+0xc>
+  800d13:	48 01 d0             	add    %rdx,%rax
+  800d16:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800d18:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800d1c:	eb bb                	jmp    800cd9 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800d1e:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800d22:	eb b5                	jmp    800cd9 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800d24:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800d2b:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800d2e:	89 d0                	mov    %edx,%eax
+  800d30:	c1 e0 02             	shl    $0x2,%eax
+  800d33:	01 d0                	add    %edx,%eax
+  800d35:	01 c0                	add    %eax,%eax
+  800d37:	01 d8                	add    %ebx,%eax
+  800d39:	83 e8 30             	sub    $0x30,%eax
+  800d3c:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800d3f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d43:	0f b6 00             	movzbl (%rax),%eax
+  800d46:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800d49:	83 fb 2f             	cmp    $0x2f,%ebx
+  800d4c:	7e 60                	jle    800dae <vprintfmt+0x17d>
+  800d4e:	83 fb 39             	cmp    $0x39,%ebx
+  800d51:	7f 5b                	jg     800dae <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800d53:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800d58:	eb d1                	jmp    800d2b <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800d5a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800d5d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d60:	77 17                	ja     800d79 <vprintfmt+0x148>
+  800d62:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800d66:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d69:	89 d2                	mov    %edx,%edx
+  800d6b:	48 01 d0             	add    %rdx,%rax
+  800d6e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800d71:	83 c2 08             	add    $0x8,%edx
+  800d74:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800d77:	eb 0c                	jmp    800d85 <vprintfmt+0x154>
+  800d79:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d7d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d81:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800d85:	8b 00                	mov    (%rax),%eax
+  800d87:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800d8a:	eb 23                	jmp    800daf <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800d8c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800d90:	0f 89 43 ff ff ff    	jns    800cd9 <vprintfmt+0xa8>
+				width = 0;
+  800d96:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800d9d:	e9 37 ff ff ff       	jmp    800cd9 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800da2:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800da9:	e9 2b ff ff ff       	jmp    800cd9 <vprintfmt+0xa8>
+			goto process_precision;
+  800dae:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800daf:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800db3:	0f 89 20 ff ff ff    	jns    800cd9 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800db9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800dbc:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800dbf:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800dc6:	e9 0e ff ff ff       	jmp    800cd9 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800dcb:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800dcf:	e9 05 ff ff ff       	jmp    800cd9 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800dd4:	83 fb 39             	cmp    $0x39,%ebx
+  800dd7:	7f 0b                	jg     800de4 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800dd9:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800ddc:	c1 e0 08             	shl    $0x8,%eax
+  800ddf:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800de2:	eb 21                	jmp    800e05 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800de4:	83 fb 60             	cmp    $0x60,%ebx
+  800de7:	7e 10                	jle    800df9 <vprintfmt+0x1c8>
+  800de9:	83 fb 66             	cmp    $0x66,%ebx
+  800dec:	7f 0b                	jg     800df9 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800dee:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800df1:	c1 e0 08             	shl    $0x8,%eax
+  800df4:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800df7:	eb 0c                	jmp    800e05 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800df9:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800e00:	e9 04 01 00 00       	jmp    800f09 <vprintfmt+0x2d8>
+  800e05:	e9 ff 00 00 00       	jmp    800f09 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800e0a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e10:	77 17                	ja     800e29 <vprintfmt+0x1f8>
+  800e12:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e16:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e19:	89 d2                	mov    %edx,%edx
+  800e1b:	48 01 d0             	add    %rdx,%rax
+  800e1e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e21:	83 c2 08             	add    $0x8,%edx
+  800e24:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e27:	eb 0c                	jmp    800e35 <vprintfmt+0x204>
+  800e29:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e2d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e31:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e35:	8b 00                	mov    (%rax),%eax
+  800e37:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800e3b:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800e3f:	48 89 d6             	mov    %rdx,%rsi
+  800e42:	89 c7                	mov    %eax,%edi
+  800e44:	ff d1                	call   *%rcx
+			break;
+  800e46:	e9 da 03 00 00       	jmp    801225 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800e4b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800e51:	77 17                	ja     800e6a <vprintfmt+0x239>
+  800e53:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e57:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e5a:	89 d2                	mov    %edx,%edx
+  800e5c:	48 01 d0             	add    %rdx,%rax
+  800e5f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e62:	83 c2 08             	add    $0x8,%edx
+  800e65:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e68:	eb 0c                	jmp    800e76 <vprintfmt+0x245>
+  800e6a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e6e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e72:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e76:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800e78:	85 db                	test   %ebx,%ebx
+  800e7a:	79 02                	jns    800e7e <vprintfmt+0x24d>
+				err = -err;
+  800e7c:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800e7e:	83 fb 15             	cmp    $0x15,%ebx
+  800e81:	7f 19                	jg     800e9c <vprintfmt+0x26b>
+  800e83:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800e8a:	00 00 00 
+  800e8d:	48 63 c3             	movslq %ebx,%rax
+  800e90:	4c 01 e2             	add    %r12,%rdx
+  800e93:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800e97:	4d 85 ed             	test   %r13,%r13
+  800e9a:	75 36                	jne    800ed2 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800e9c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800ea0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ea4:	89 d9                	mov    %ebx,%ecx
+  800ea6:	48 ba a0 e0 ff ff ff 	movabs $0xffffffffffffe0a0,%rdx
+  800ead:	ff ff ff 
+  800eb0:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800eb4:	48 89 c7             	mov    %rax,%rdi
+  800eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ebc:	49 b8 f8 81 ff ff ff 	movabs $0xffffffffffff81f8,%r8
+  800ec3:	ff ff ff 
+  800ec6:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800eca:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800ecd:	e9 53 03 00 00       	jmp    801225 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800ed2:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800ed6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800eda:	4c 89 e9             	mov    %r13,%rcx
+  800edd:	48 ba a9 e0 ff ff ff 	movabs $0xffffffffffffe0a9,%rdx
+  800ee4:	ff ff ff 
+  800ee7:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800eeb:	48 89 c7             	mov    %rax,%rdi
+  800eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef3:	49 b8 f8 81 ff ff ff 	movabs $0xffffffffffff81f8,%r8
+  800efa:	ff ff ff 
+  800efd:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f01:	41 ff d0             	call   *%r8
+			break;
+  800f04:	e9 1c 03 00 00       	jmp    801225 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800f09:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f0f:	77 17                	ja     800f28 <vprintfmt+0x2f7>
+  800f11:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f15:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f18:	89 d2                	mov    %edx,%edx
+  800f1a:	48 01 d0             	add    %rdx,%rax
+  800f1d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f20:	83 c2 08             	add    $0x8,%edx
+  800f23:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f26:	eb 0c                	jmp    800f34 <vprintfmt+0x303>
+  800f28:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f2c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f30:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f34:	4c 8b 28             	mov    (%rax),%r13
+  800f37:	4d 85 ed             	test   %r13,%r13
+  800f3a:	75 0e                	jne    800f4a <vprintfmt+0x319>
+				p = "(null)";
+  800f3c:	48 b8 ac e0 ff ff ff 	movabs $0xffffffffffffe0ac,%rax
+  800f43:	ff ff ff 
+  800f46:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800f4a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f4e:	0f 8e 84 00 00 00    	jle    800fd8 <vprintfmt+0x3a7>
+  800f54:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800f58:	74 7e                	je     800fd8 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f5a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800f5d:	48 98                	cltq
+  800f5f:	48 89 c6             	mov    %rax,%rsi
+  800f62:	4c 89 ef             	mov    %r13,%rdi
+  800f65:	4d 89 e7             	mov    %r12,%r15
+  800f68:	48 b8 1d 85 ff ff ff 	movabs $0xffffffffffff851d,%rax
+  800f6f:	ff ff ff 
+  800f72:	4c 01 e0             	add    %r12,%rax
+  800f75:	ff d0                	call   *%rax
+  800f77:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800f7a:	eb 17                	jmp    800f93 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800f7c:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800f80:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800f84:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800f88:	48 89 d6             	mov    %rdx,%rsi
+  800f8b:	89 c7                	mov    %eax,%edi
+  800f8d:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800f8f:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800f93:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800f97:	7f e3                	jg     800f7c <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800f99:	eb 3d                	jmp    800fd8 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800f9b:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800f9f:	74 1e                	je     800fbf <vprintfmt+0x38e>
+  800fa1:	83 fb 1f             	cmp    $0x1f,%ebx
+  800fa4:	7e 05                	jle    800fab <vprintfmt+0x37a>
+  800fa6:	83 fb 7e             	cmp    $0x7e,%ebx
+  800fa9:	7e 14                	jle    800fbf <vprintfmt+0x38e>
+					putch('?', putdat);
+  800fab:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800faf:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fb3:	48 89 c6             	mov    %rax,%rsi
+  800fb6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800fbb:	ff d2                	call   *%rdx
+  800fbd:	eb 15                	jmp    800fd4 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  800fbf:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800fc2:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  800fc5:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fc9:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800fcd:	48 89 c6             	mov    %rax,%rsi
+  800fd0:	89 cf                	mov    %ecx,%edi
+  800fd2:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800fd4:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800fd8:	4c 89 e8             	mov    %r13,%rax
+  800fdb:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  800fdf:	0f b6 00             	movzbl (%rax),%eax
+  800fe2:	0f be d8             	movsbl %al,%ebx
+  800fe5:	85 db                	test   %ebx,%ebx
+  800fe7:	74 28                	je     801011 <vprintfmt+0x3e0>
+  800fe9:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800fed:	78 ac                	js     800f9b <vprintfmt+0x36a>
+  800fef:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  800ff3:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  800ff7:	79 a2                	jns    800f9b <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  800ff9:	eb 16                	jmp    801011 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  800ffb:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800fff:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801003:	48 89 c6             	mov    %rax,%rsi
+  801006:	bf 20 00 00 00       	mov    $0x20,%edi
+  80100b:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  80100d:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801011:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801015:	7f e4                	jg     800ffb <vprintfmt+0x3ca>
+			break;
+  801017:	e9 09 02 00 00       	jmp    801225 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80101c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801020:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801024:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801028:	0f b6 00             	movzbl (%rax),%eax
+  80102b:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  80102e:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  80102f:	83 fb 2f             	cmp    $0x2f,%ebx
+  801032:	0f 8e ac fd ff ff    	jle    800de4 <vprintfmt+0x1b3>
+  801038:	e9 97 fd ff ff       	jmp    800dd4 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  80103d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801041:	be 03 00 00 00       	mov    $0x3,%esi
+  801046:	48 89 c7             	mov    %rax,%rdi
+  801049:	48 b8 d6 7a ff ff ff 	movabs $0xffffffffffff7ad6,%rax
+  801050:	ff ff ff 
+  801053:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801057:	ff d0                	call   *%rax
+  801059:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  80105d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801061:	48 85 c0             	test   %rax,%rax
+  801064:	79 1d                	jns    801083 <vprintfmt+0x452>
+				putch('-', putdat);
+  801066:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80106a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80106e:	48 89 c6             	mov    %rax,%rsi
+  801071:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801076:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  801078:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80107c:	48 f7 d8             	neg    %rax
+  80107f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  801083:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  80108a:	e9 de 00 00 00       	jmp    80116d <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  80108f:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801093:	be 03 00 00 00       	mov    $0x3,%esi
+  801098:	48 89 c7             	mov    %rax,%rdi
+  80109b:	48 b8 75 79 ff ff ff 	movabs $0xffffffffffff7975,%rax
+  8010a2:	ff ff ff 
+  8010a5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010a9:	ff d0                	call   *%rax
+  8010ab:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  8010af:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8010b6:	e9 b2 00 00 00       	jmp    80116d <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  8010bb:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010bf:	be 03 00 00 00       	mov    $0x3,%esi
+  8010c4:	48 89 c7             	mov    %rax,%rdi
+  8010c7:	48 b8 75 79 ff ff ff 	movabs $0xffffffffffff7975,%rax
+  8010ce:	ff ff ff 
+  8010d1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010d5:	ff d0                	call   *%rax
+  8010d7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  8010db:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  8010e2:	e9 86 00 00 00       	jmp    80116d <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  8010e7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010eb:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010ef:	48 89 c6             	mov    %rax,%rsi
+  8010f2:	bf 30 00 00 00       	mov    $0x30,%edi
+  8010f7:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  8010f9:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010fd:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801101:	48 89 c6             	mov    %rax,%rsi
+  801104:	bf 78 00 00 00       	mov    $0x78,%edi
+  801109:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80110b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80110e:	83 f8 2f             	cmp    $0x2f,%eax
+  801111:	77 17                	ja     80112a <vprintfmt+0x4f9>
+  801113:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801117:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80111a:	89 d2                	mov    %edx,%edx
+  80111c:	48 01 d0             	add    %rdx,%rax
+  80111f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801122:	83 c2 08             	add    $0x8,%edx
+  801125:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801128:	eb 0c                	jmp    801136 <vprintfmt+0x505>
+  80112a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80112e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801132:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801136:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801139:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80113d:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  801144:	eb 27                	jmp    80116d <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  801146:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80114a:	be 03 00 00 00       	mov    $0x3,%esi
+  80114f:	48 89 c7             	mov    %rax,%rdi
+  801152:	48 b8 75 79 ff ff ff 	movabs $0xffffffffffff7975,%rax
+  801159:	ff ff ff 
+  80115c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801160:	ff d0                	call   *%rax
+  801162:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  801166:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  80116d:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  801172:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  801175:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801178:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80117c:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801180:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801184:	45 89 c1             	mov    %r8d,%r9d
+  801187:	41 89 f8             	mov    %edi,%r8d
+  80118a:	48 89 c7             	mov    %rax,%rdi
+  80118d:	48 b8 9d 78 ff ff ff 	movabs $0xffffffffffff789d,%rax
+  801194:	ff ff ff 
+  801197:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80119b:	ff d0                	call   *%rax
+			break;
+  80119d:	e9 83 00 00 00       	jmp    801225 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  8011a2:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011a6:	be 03 00 00 00       	mov    $0x3,%esi
+  8011ab:	48 89 c7             	mov    %rax,%rdi
+  8011ae:	48 b8 75 79 ff ff ff 	movabs $0xffffffffffff7975,%rax
+  8011b5:	ff ff ff 
+  8011b8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011bc:	ff d0                	call   *%rax
+  8011be:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  8011c2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8011c6:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8011ca:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8011ce:	48 89 ce             	mov    %rcx,%rsi
+  8011d1:	48 89 c7             	mov    %rax,%rdi
+  8011d4:	48 b8 90 7a ff ff ff 	movabs $0xffffffffffff7a90,%rax
+  8011db:	ff ff ff 
+  8011de:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011e2:	ff d0                	call   *%rax
+	
+			break;
+  8011e4:	eb 3f                	jmp    801225 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  8011e6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011ea:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011ee:	48 89 c6             	mov    %rax,%rsi
+  8011f1:	89 df                	mov    %ebx,%edi
+  8011f3:	ff d2                	call   *%rdx
+			break;
+  8011f5:	eb 2e                	jmp    801225 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  8011f7:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8011fb:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8011ff:	48 89 c6             	mov    %rax,%rsi
+  801202:	bf 25 00 00 00       	mov    $0x25,%edi
+  801207:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801209:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80120e:	eb 05                	jmp    801215 <vprintfmt+0x5e4>
+  801210:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801215:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801219:	48 83 e8 01          	sub    $0x1,%rax
+  80121d:	0f b6 00             	movzbl (%rax),%eax
+  801220:	3c 25                	cmp    $0x25,%al
+  801222:	75 ec                	jne    801210 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801224:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801225:	e9 78 fa ff ff       	jmp    800ca2 <vprintfmt+0x71>
+				return;
+  80122a:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80122b:	48 83 c4 60          	add    $0x60,%rsp
+  80122f:	5b                   	pop    %rbx
+  801230:	41 5c                	pop    %r12
+  801232:	41 5d                	pop    %r13
+  801234:	41 5f                	pop    %r15
+  801236:	5d                   	pop    %rbp
+  801237:	c3                   	ret
+
+0000000000801238 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801238:	55                   	push   %rbp
+  801239:	48 89 e5             	mov    %rsp,%rbp
+  80123c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801243:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801243 <printfmt+0xb>
+  80124a:	49 bb fd 7d 00 00 00 	movabs $0x7dfd,%r11
+  801251:	00 00 00 
+  801254:	4d 01 da             	add    %r11,%r10
+  801257:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80125e:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801265:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80126c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801273:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80127a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801281:	84 c0                	test   %al,%al
+  801283:	74 20                	je     8012a5 <printfmt+0x6d>
+  801285:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801289:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80128d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801291:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801295:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801299:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80129d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8012a1:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8012a5:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8012ac:	00 00 00 
+  8012af:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8012b6:	00 00 00 
+  8012b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8012bd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8012c4:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8012cb:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  8012d2:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8012d9:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8012e0:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8012e7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8012ee:	48 89 c7             	mov    %rax,%rdi
+  8012f1:	48 b8 f1 7b ff ff ff 	movabs $0xffffffffffff7bf1,%rax
+  8012f8:	ff ff ff 
+  8012fb:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  8012ff:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801301:	90                   	nop
+  801302:	c9                   	leave
+  801303:	c3                   	ret
+
+0000000000801304 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801304:	55                   	push   %rbp
+  801305:	48 89 e5             	mov    %rsp,%rbp
+  801308:	48 83 ec 10          	sub    $0x10,%rsp
+  80130c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80130c <sprintputch+0x8>
+  801313:	49 bb 34 7d 00 00 00 	movabs $0x7d34,%r11
+  80131a:	00 00 00 
+  80131d:	4c 01 d8             	add    %r11,%rax
+  801320:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801323:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801327:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80132b:	8b 40 10             	mov    0x10(%rax),%eax
+  80132e:	8d 50 01             	lea    0x1(%rax),%edx
+  801331:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801335:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801338:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80133c:	48 8b 10             	mov    (%rax),%rdx
+  80133f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801343:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801347:	48 39 c2             	cmp    %rax,%rdx
+  80134a:	73 17                	jae    801363 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  80134c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801350:	48 8b 00             	mov    (%rax),%rax
+  801353:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801357:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80135b:	48 89 0a             	mov    %rcx,(%rdx)
+  80135e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801361:	88 10                	mov    %dl,(%rax)
+}
+  801363:	90                   	nop
+  801364:	c9                   	leave
+  801365:	c3                   	ret
+
+0000000000801366 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801366:	55                   	push   %rbp
+  801367:	48 89 e5             	mov    %rsp,%rbp
+  80136a:	53                   	push   %rbx
+  80136b:	48 83 ec 58          	sub    $0x58,%rsp
+  80136f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80136f <vsnprintf+0x9>
+  801376:	49 bb d1 7c 00 00 00 	movabs $0x7cd1,%r11
+  80137d:	00 00 00 
+  801380:	4c 01 d8             	add    %r11,%rax
+  801383:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  801387:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  80138a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  80138e:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  801392:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801396:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80139a:	48 8b 0e             	mov    (%rsi),%rcx
+  80139d:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  8013a1:	48 89 0a             	mov    %rcx,(%rdx)
+  8013a4:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  8013a8:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  8013ac:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8013b0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8013b4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8013b8:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8013bb:	48 63 d2             	movslq %edx,%rdx
+  8013be:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  8013c2:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8013c6:	48 01 ca             	add    %rcx,%rdx
+  8013c9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8013cd:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  8013d4:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8013d9:	74 06                	je     8013e1 <vsnprintf+0x7b>
+  8013db:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  8013df:	7f 07                	jg     8013e8 <vsnprintf+0x82>
+		return -E_INVAL;
+  8013e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013e6:	eb 34                	jmp    80141c <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  8013e8:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  8013ec:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8013f0:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  8013f4:	48 bf c4 82 ff ff ff 	movabs $0xffffffffffff82c4,%rdi
+  8013fb:	ff ff ff 
+  8013fe:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801402:	49 b8 f1 7b ff ff ff 	movabs $0xffffffffffff7bf1,%r8
+  801409:	ff ff ff 
+  80140c:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801410:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801412:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801416:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801419:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80141c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801420:	c9                   	leave
+  801421:	c3                   	ret
+
+0000000000801422 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801422:	55                   	push   %rbp
+  801423:	48 89 e5             	mov    %rsp,%rbp
+  801426:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80142d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80142d <snprintf+0xb>
+  801434:	49 bb 13 7c 00 00 00 	movabs $0x7c13,%r11
+  80143b:	00 00 00 
+  80143e:	4d 01 da             	add    %r11,%r10
+  801441:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  801448:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  80144e:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  801455:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80145c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801463:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80146a:	84 c0                	test   %al,%al
+  80146c:	74 20                	je     80148e <snprintf+0x6c>
+  80146e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801472:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801476:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80147a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80147e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801482:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801486:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80148a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  80148e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801495:	00 00 00 
+  801498:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80149f:	00 00 00 
+  8014a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014a6:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8014ad:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8014b4:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  8014bb:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8014c2:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8014c9:	48 8b 06             	mov    (%rsi),%rax
+  8014cc:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8014d0:	48 89 01             	mov    %rax,(%rcx)
+  8014d3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8014d7:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8014db:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  8014df:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8014e6:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  8014ed:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  8014f3:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8014fa:	48 89 c7             	mov    %rax,%rdi
+  8014fd:	48 b8 26 83 ff ff ff 	movabs $0xffffffffffff8326,%rax
+  801504:	ff ff ff 
+  801507:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80150b:	ff d0                	call   *%rax
+  80150d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801513:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801519:	c9                   	leave
+  80151a:	c3                   	ret
+
+000000000080151b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80151b:	55                   	push   %rbp
+  80151c:	48 89 e5             	mov    %rsp,%rbp
+  80151f:	48 83 ec 18          	sub    $0x18,%rsp
+  801523:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801523 <strlen+0x8>
+  80152a:	49 bb 1d 7b 00 00 00 	movabs $0x7b1d,%r11
+  801531:	00 00 00 
+  801534:	4c 01 d8             	add    %r11,%rax
+  801537:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80153b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801542:	eb 09                	jmp    80154d <strlen+0x32>
+		n++;
+  801544:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  801548:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80154d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801551:	0f b6 00             	movzbl (%rax),%eax
+  801554:	84 c0                	test   %al,%al
+  801556:	75 ec                	jne    801544 <strlen+0x29>
+	return n;
+  801558:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80155b:	c9                   	leave
+  80155c:	c3                   	ret
+
+000000000080155d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80155d:	55                   	push   %rbp
+  80155e:	48 89 e5             	mov    %rsp,%rbp
+  801561:	48 83 ec 20          	sub    $0x20,%rsp
+  801565:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801565 <strnlen+0x8>
+  80156c:	49 bb db 7a 00 00 00 	movabs $0x7adb,%r11
+  801573:	00 00 00 
+  801576:	4c 01 d8             	add    %r11,%rax
+  801579:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80157d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801581:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801588:	eb 0e                	jmp    801598 <strnlen+0x3b>
+		n++;
+  80158a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80158e:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801593:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801598:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80159d:	74 0b                	je     8015aa <strnlen+0x4d>
+  80159f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015a3:	0f b6 00             	movzbl (%rax),%eax
+  8015a6:	84 c0                	test   %al,%al
+  8015a8:	75 e0                	jne    80158a <strnlen+0x2d>
+	return n;
+  8015aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015ad:	c9                   	leave
+  8015ae:	c3                   	ret
+
+00000000008015af <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8015af:	55                   	push   %rbp
+  8015b0:	48 89 e5             	mov    %rsp,%rbp
+  8015b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8015b7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015b7 <strcpy+0x8>
+  8015be:	49 bb 89 7a 00 00 00 	movabs $0x7a89,%r11
+  8015c5:	00 00 00 
+  8015c8:	4c 01 d8             	add    %r11,%rax
+  8015cb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  8015d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015d7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  8015db:	90                   	nop
+  8015dc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015e0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8015e4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8015e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015ec:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8015f0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8015f4:	0f b6 12             	movzbl (%rdx),%edx
+  8015f7:	88 10                	mov    %dl,(%rax)
+  8015f9:	0f b6 00             	movzbl (%rax),%eax
+  8015fc:	84 c0                	test   %al,%al
+  8015fe:	75 dc                	jne    8015dc <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801600:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801604:	c9                   	leave
+  801605:	c3                   	ret
+
+0000000000801606 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801606:	55                   	push   %rbp
+  801607:	48 89 e5             	mov    %rsp,%rbp
+  80160a:	53                   	push   %rbx
+  80160b:	48 83 ec 20          	sub    $0x20,%rsp
+  80160f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80160f <strcat+0x9>
+  801616:	49 bb 31 7a 00 00 00 	movabs $0x7a31,%r11
+  80161d:	00 00 00 
+  801620:	4c 01 db             	add    %r11,%rbx
+  801623:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801627:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80162b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80162f:	48 89 c7             	mov    %rax,%rdi
+  801632:	48 b8 db 84 ff ff ff 	movabs $0xffffffffffff84db,%rax
+  801639:	ff ff ff 
+  80163c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801640:	ff d0                	call   *%rax
+  801642:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  801645:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801648:	48 63 d0             	movslq %eax,%rdx
+  80164b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80164f:	48 01 c2             	add    %rax,%rdx
+  801652:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801656:	48 89 c6             	mov    %rax,%rsi
+  801659:	48 89 d7             	mov    %rdx,%rdi
+  80165c:	48 b8 6f 85 ff ff ff 	movabs $0xffffffffffff856f,%rax
+  801663:	ff ff ff 
+  801666:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80166a:	ff d0                	call   *%rax
+	return dst;
+  80166c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  801670:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801674:	c9                   	leave
+  801675:	c3                   	ret
+
+0000000000801676 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801676:	55                   	push   %rbp
+  801677:	48 89 e5             	mov    %rsp,%rbp
+  80167a:	48 83 ec 28          	sub    $0x28,%rsp
+  80167e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80167e <strncpy+0x8>
+  801685:	49 bb c2 79 00 00 00 	movabs $0x79c2,%r11
+  80168c:	00 00 00 
+  80168f:	4c 01 d8             	add    %r11,%rax
+  801692:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801696:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80169a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  80169e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016a2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  8016a6:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8016ad:	00 
+  8016ae:	eb 2a                	jmp    8016da <strncpy+0x64>
+		*dst++ = *src;
+  8016b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016b4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016b8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8016bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016c0:	0f b6 12             	movzbl (%rdx),%edx
+  8016c3:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  8016c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016c9:	0f b6 00             	movzbl (%rax),%eax
+  8016cc:	84 c0                	test   %al,%al
+  8016ce:	74 05                	je     8016d5 <strncpy+0x5f>
+			src++;
+  8016d0:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  8016d5:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016de:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8016e2:	72 cc                	jb     8016b0 <strncpy+0x3a>
+	}
+	return ret;
+  8016e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8016e8:	c9                   	leave
+  8016e9:	c3                   	ret
+
+00000000008016ea <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8016ea:	55                   	push   %rbp
+  8016eb:	48 89 e5             	mov    %rsp,%rbp
+  8016ee:	48 83 ec 28          	sub    $0x28,%rsp
+  8016f2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016f2 <strlcpy+0x8>
+  8016f9:	49 bb 4e 79 00 00 00 	movabs $0x794e,%r11
+  801700:	00 00 00 
+  801703:	4c 01 d8             	add    %r11,%rax
+  801706:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80170a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80170e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801712:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801716:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80171a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80171f:	74 3d                	je     80175e <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801721:	eb 1d                	jmp    801740 <strlcpy+0x56>
+			*dst++ = *src++;
+  801723:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801727:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80172b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80172f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801733:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801737:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80173b:	0f b6 12             	movzbl (%rdx),%edx
+  80173e:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  801740:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801745:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80174a:	74 0b                	je     801757 <strlcpy+0x6d>
+  80174c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801750:	0f b6 00             	movzbl (%rax),%eax
+  801753:	84 c0                	test   %al,%al
+  801755:	75 cc                	jne    801723 <strlcpy+0x39>
+		*dst = '\0';
+  801757:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80175b:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  80175e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801762:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+
+0000000000801768 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801768:	55                   	push   %rbp
+  801769:	48 89 e5             	mov    %rsp,%rbp
+  80176c:	48 83 ec 10          	sub    $0x10,%rsp
+  801770:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801770 <strcmp+0x8>
+  801777:	49 bb d0 78 00 00 00 	movabs $0x78d0,%r11
+  80177e:	00 00 00 
+  801781:	4c 01 d8             	add    %r11,%rax
+  801784:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801788:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  80178c:	eb 0a                	jmp    801798 <strcmp+0x30>
+		p++, q++;
+  80178e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801793:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  801798:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179c:	0f b6 00             	movzbl (%rax),%eax
+  80179f:	84 c0                	test   %al,%al
+  8017a1:	74 12                	je     8017b5 <strcmp+0x4d>
+  8017a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017a7:	0f b6 10             	movzbl (%rax),%edx
+  8017aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ae:	0f b6 00             	movzbl (%rax),%eax
+  8017b1:	38 c2                	cmp    %al,%dl
+  8017b3:	74 d9                	je     80178e <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8017b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b9:	0f b6 00             	movzbl (%rax),%eax
+  8017bc:	0f b6 d0             	movzbl %al,%edx
+  8017bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c3:	0f b6 00             	movzbl (%rax),%eax
+  8017c6:	0f b6 c0             	movzbl %al,%eax
+  8017c9:	29 c2                	sub    %eax,%edx
+  8017cb:	89 d0                	mov    %edx,%eax
+}
+  8017cd:	c9                   	leave
+  8017ce:	c3                   	ret
+
+00000000008017cf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8017cf:	55                   	push   %rbp
+  8017d0:	48 89 e5             	mov    %rsp,%rbp
+  8017d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8017d7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017d7 <strncmp+0x8>
+  8017de:	49 bb 69 78 00 00 00 	movabs $0x7869,%r11
+  8017e5:	00 00 00 
+  8017e8:	4c 01 d8             	add    %r11,%rax
+  8017eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8017f3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  8017f7:	eb 0f                	jmp    801808 <strncmp+0x39>
+		n--, p++, q++;
+  8017f9:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8017fe:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801803:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801808:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80180d:	74 1d                	je     80182c <strncmp+0x5d>
+  80180f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801813:	0f b6 00             	movzbl (%rax),%eax
+  801816:	84 c0                	test   %al,%al
+  801818:	74 12                	je     80182c <strncmp+0x5d>
+  80181a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181e:	0f b6 10             	movzbl (%rax),%edx
+  801821:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801825:	0f b6 00             	movzbl (%rax),%eax
+  801828:	38 c2                	cmp    %al,%dl
+  80182a:	74 cd                	je     8017f9 <strncmp+0x2a>
+	if (n == 0)
+  80182c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801831:	75 07                	jne    80183a <strncmp+0x6b>
+		return 0;
+  801833:	ba 00 00 00 00       	mov    $0x0,%edx
+  801838:	eb 16                	jmp    801850 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80183a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80183e:	0f b6 00             	movzbl (%rax),%eax
+  801841:	0f b6 d0             	movzbl %al,%edx
+  801844:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801848:	0f b6 00             	movzbl (%rax),%eax
+  80184b:	0f b6 c0             	movzbl %al,%eax
+  80184e:	29 c2                	sub    %eax,%edx
+}
+  801850:	89 d0                	mov    %edx,%eax
+  801852:	c9                   	leave
+  801853:	c3                   	ret
+
+0000000000801854 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801854:	55                   	push   %rbp
+  801855:	48 89 e5             	mov    %rsp,%rbp
+  801858:	48 83 ec 10          	sub    $0x10,%rsp
+  80185c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80185c <strchr+0x8>
+  801863:	49 bb e4 77 00 00 00 	movabs $0x77e4,%r11
+  80186a:	00 00 00 
+  80186d:	4c 01 d8             	add    %r11,%rax
+  801870:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801874:	89 f0                	mov    %esi,%eax
+  801876:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801879:	eb 17                	jmp    801892 <strchr+0x3e>
+		if (*s == c)
+  80187b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80187f:	0f b6 00             	movzbl (%rax),%eax
+  801882:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801885:	75 06                	jne    80188d <strchr+0x39>
+			return (char *) s;
+  801887:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80188b:	eb 15                	jmp    8018a2 <strchr+0x4e>
+	for (; *s; s++)
+  80188d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801892:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801896:	0f b6 00             	movzbl (%rax),%eax
+  801899:	84 c0                	test   %al,%al
+  80189b:	75 de                	jne    80187b <strchr+0x27>
+	return 0;
+  80189d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018a2:	c9                   	leave
+  8018a3:	c3                   	ret
+
+00000000008018a4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8018a4:	55                   	push   %rbp
+  8018a5:	48 89 e5             	mov    %rsp,%rbp
+  8018a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8018ac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018ac <strfind+0x8>
+  8018b3:	49 bb 94 77 00 00 00 	movabs $0x7794,%r11
+  8018ba:	00 00 00 
+  8018bd:	4c 01 d8             	add    %r11,%rax
+  8018c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018c4:	89 f0                	mov    %esi,%eax
+  8018c6:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8018c9:	eb 11                	jmp    8018dc <strfind+0x38>
+		if (*s == c)
+  8018cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018cf:	0f b6 00             	movzbl (%rax),%eax
+  8018d2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8018d5:	74 12                	je     8018e9 <strfind+0x45>
+	for (; *s; s++)
+  8018d7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e0:	0f b6 00             	movzbl (%rax),%eax
+  8018e3:	84 c0                	test   %al,%al
+  8018e5:	75 e4                	jne    8018cb <strfind+0x27>
+  8018e7:	eb 01                	jmp    8018ea <strfind+0x46>
+			break;
+  8018e9:	90                   	nop
+	return (char *) s;
+  8018ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8018ee:	c9                   	leave
+  8018ef:	c3                   	ret
+
+00000000008018f0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8018f0:	55                   	push   %rbp
+  8018f1:	48 89 e5             	mov    %rsp,%rbp
+  8018f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8018f8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018f8 <memset+0x8>
+  8018ff:	49 bb 48 77 00 00 00 	movabs $0x7748,%r11
+  801906:	00 00 00 
+  801909:	4c 01 d8             	add    %r11,%rax
+  80190c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801910:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801913:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801917:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80191c:	75 06                	jne    801924 <memset+0x34>
+		return v;
+  80191e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801922:	eb 69                	jmp    80198d <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801924:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801928:	83 e0 03             	and    $0x3,%eax
+  80192b:	48 85 c0             	test   %rax,%rax
+  80192e:	75 48                	jne    801978 <memset+0x88>
+  801930:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801934:	83 e0 03             	and    $0x3,%eax
+  801937:	48 85 c0             	test   %rax,%rax
+  80193a:	75 3c                	jne    801978 <memset+0x88>
+		c &= 0xFF;
+  80193c:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  801943:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801946:	c1 e0 18             	shl    $0x18,%eax
+  801949:	89 c2                	mov    %eax,%edx
+  80194b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80194e:	c1 e0 10             	shl    $0x10,%eax
+  801951:	09 c2                	or     %eax,%edx
+  801953:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801956:	c1 e0 08             	shl    $0x8,%eax
+  801959:	09 d0                	or     %edx,%eax
+  80195b:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  80195e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801962:	48 c1 e8 02          	shr    $0x2,%rax
+  801966:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  801969:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80196d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801970:	48 89 d7             	mov    %rdx,%rdi
+  801973:	fc                   	cld
+  801974:	f3 ab                	rep stos %eax,%es:(%rdi)
+  801976:	eb 11                	jmp    801989 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  801978:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80197c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80197f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801983:	48 89 d7             	mov    %rdx,%rdi
+  801986:	fc                   	cld
+  801987:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  801989:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80198d:	c9                   	leave
+  80198e:	c3                   	ret
+
+000000000080198f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80198f:	55                   	push   %rbp
+  801990:	48 89 e5             	mov    %rsp,%rbp
+  801993:	48 83 ec 28          	sub    $0x28,%rsp
+  801997:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801997 <memmove+0x8>
+  80199e:	49 bb a9 76 00 00 00 	movabs $0x76a9,%r11
+  8019a5:	00 00 00 
+  8019a8:	4c 01 d8             	add    %r11,%rax
+  8019ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8019af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8019b3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  8019b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019bb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  8019bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  8019c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019cb:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8019cf:	0f 83 88 00 00 00    	jae    801a5d <memmove+0xce>
+  8019d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019dd:	48 01 d0             	add    %rdx,%rax
+  8019e0:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8019e4:	73 77                	jae    801a5d <memmove+0xce>
+		s += n;
+  8019e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019ea:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  8019ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019f2:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  8019f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019fa:	83 e0 03             	and    $0x3,%eax
+  8019fd:	48 85 c0             	test   %rax,%rax
+  801a00:	75 3b                	jne    801a3d <memmove+0xae>
+  801a02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a06:	83 e0 03             	and    $0x3,%eax
+  801a09:	48 85 c0             	test   %rax,%rax
+  801a0c:	75 2f                	jne    801a3d <memmove+0xae>
+  801a0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a12:	83 e0 03             	and    $0x3,%eax
+  801a15:	48 85 c0             	test   %rax,%rax
+  801a18:	75 23                	jne    801a3d <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801a1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a1e:	48 83 e8 04          	sub    $0x4,%rax
+  801a22:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a26:	48 83 ea 04          	sub    $0x4,%rdx
+  801a2a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a2e:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801a32:	48 89 c7             	mov    %rax,%rdi
+  801a35:	48 89 d6             	mov    %rdx,%rsi
+  801a38:	fd                   	std
+  801a39:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a3b:	eb 1d                	jmp    801a5a <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801a3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a41:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a49:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801a4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a51:	48 89 d7             	mov    %rdx,%rdi
+  801a54:	48 89 c1             	mov    %rax,%rcx
+  801a57:	fd                   	std
+  801a58:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801a5a:	fc                   	cld
+  801a5b:	eb 57                	jmp    801ab4 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801a5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a61:	83 e0 03             	and    $0x3,%eax
+  801a64:	48 85 c0             	test   %rax,%rax
+  801a67:	75 36                	jne    801a9f <memmove+0x110>
+  801a69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a6d:	83 e0 03             	and    $0x3,%eax
+  801a70:	48 85 c0             	test   %rax,%rax
+  801a73:	75 2a                	jne    801a9f <memmove+0x110>
+  801a75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a79:	83 e0 03             	and    $0x3,%eax
+  801a7c:	48 85 c0             	test   %rax,%rax
+  801a7f:	75 1e                	jne    801a9f <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801a81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a85:	48 c1 e8 02          	shr    $0x2,%rax
+  801a89:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801a8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a90:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a94:	48 89 c7             	mov    %rax,%rdi
+  801a97:	48 89 d6             	mov    %rdx,%rsi
+  801a9a:	fc                   	cld
+  801a9b:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a9d:	eb 15                	jmp    801ab4 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801a9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aa7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801aab:	48 89 c7             	mov    %rax,%rdi
+  801aae:	48 89 d6             	mov    %rdx,%rsi
+  801ab1:	fc                   	cld
+  801ab2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801ab4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801ab8:	c9                   	leave
+  801ab9:	c3                   	ret
+
+0000000000801aba <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801aba:	55                   	push   %rbp
+  801abb:	48 89 e5             	mov    %rsp,%rbp
+  801abe:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac2:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801ac2 <memcpy+0x8>
+  801ac9:	49 bb 7e 75 00 00 00 	movabs $0x757e,%r11
+  801ad0:	00 00 00 
+  801ad3:	4c 01 d8             	add    %r11,%rax
+  801ad6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ada:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ade:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801ae2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ae6:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801aea:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801aee:	48 89 cf             	mov    %rcx,%rdi
+  801af1:	48 b9 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rcx
+  801af8:	ff ff ff 
+  801afb:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801aff:	ff d0                	call   *%rax
+}
+  801b01:	c9                   	leave
+  801b02:	c3                   	ret
+
+0000000000801b03 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801b03:	55                   	push   %rbp
+  801b04:	48 89 e5             	mov    %rsp,%rbp
+  801b07:	48 83 ec 28          	sub    $0x28,%rsp
+  801b0b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b0b <memcmp+0x8>
+  801b12:	49 bb 35 75 00 00 00 	movabs $0x7535,%r11
+  801b19:	00 00 00 
+  801b1c:	4c 01 d8             	add    %r11,%rax
+  801b1f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b23:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b27:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801b2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b2f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801b33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b37:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801b3b:	eb 34                	jmp    801b71 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801b3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b41:	0f b6 10             	movzbl (%rax),%edx
+  801b44:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b48:	0f b6 00             	movzbl (%rax),%eax
+  801b4b:	38 c2                	cmp    %al,%dl
+  801b4d:	74 18                	je     801b67 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801b4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b53:	0f b6 00             	movzbl (%rax),%eax
+  801b56:	0f b6 d0             	movzbl %al,%edx
+  801b59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b5d:	0f b6 00             	movzbl (%rax),%eax
+  801b60:	0f b6 c0             	movzbl %al,%eax
+  801b63:	29 c2                	sub    %eax,%edx
+  801b65:	eb 20                	jmp    801b87 <memcmp+0x84>
+		s1++, s2++;
+  801b67:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b6c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801b71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b75:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b79:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801b7d:	48 85 c0             	test   %rax,%rax
+  801b80:	75 bb                	jne    801b3d <memcmp+0x3a>
+	}
+
+	return 0;
+  801b82:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801b87:	89 d0                	mov    %edx,%eax
+  801b89:	c9                   	leave
+  801b8a:	c3                   	ret
+
+0000000000801b8b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801b8b:	55                   	push   %rbp
+  801b8c:	48 89 e5             	mov    %rsp,%rbp
+  801b8f:	48 83 ec 28          	sub    $0x28,%rsp
+  801b93:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b93 <memfind+0x8>
+  801b9a:	49 bb ad 74 00 00 00 	movabs $0x74ad,%r11
+  801ba1:	00 00 00 
+  801ba4:	4c 01 d8             	add    %r11,%rax
+  801ba7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bab:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801bae:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801bb2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801bb6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bba:	48 01 d0             	add    %rdx,%rax
+  801bbd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801bc1:	eb 13                	jmp    801bd6 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801bc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc7:	0f b6 00             	movzbl (%rax),%eax
+  801bca:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801bcd:	38 d0                	cmp    %dl,%al
+  801bcf:	74 11                	je     801be2 <memfind+0x57>
+	for (; s < ends; s++)
+  801bd1:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801bd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bda:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801bde:	72 e3                	jb     801bc3 <memfind+0x38>
+  801be0:	eb 01                	jmp    801be3 <memfind+0x58>
+			break;
+  801be2:	90                   	nop
+	return (void *) s;
+  801be3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801be7:	c9                   	leave
+  801be8:	c3                   	ret
+
+0000000000801be9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801be9:	55                   	push   %rbp
+  801bea:	48 89 e5             	mov    %rsp,%rbp
+  801bed:	48 83 ec 38          	sub    $0x38,%rsp
+  801bf1:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bf1 <strtol+0x8>
+  801bf8:	49 bb 4f 74 00 00 00 	movabs $0x744f,%r11
+  801bff:	00 00 00 
+  801c02:	4c 01 d8             	add    %r11,%rax
+  801c05:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c09:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c0d:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801c10:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801c17:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c1e:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801c1f:	eb 05                	jmp    801c26 <strtol+0x3d>
+		s++;
+  801c21:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801c26:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c2a:	0f b6 00             	movzbl (%rax),%eax
+  801c2d:	3c 20                	cmp    $0x20,%al
+  801c2f:	74 f0                	je     801c21 <strtol+0x38>
+  801c31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c35:	0f b6 00             	movzbl (%rax),%eax
+  801c38:	3c 09                	cmp    $0x9,%al
+  801c3a:	74 e5                	je     801c21 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801c3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c40:	0f b6 00             	movzbl (%rax),%eax
+  801c43:	3c 2b                	cmp    $0x2b,%al
+  801c45:	75 07                	jne    801c4e <strtol+0x65>
+		s++;
+  801c47:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c4c:	eb 17                	jmp    801c65 <strtol+0x7c>
+	else if (*s == '-')
+  801c4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c52:	0f b6 00             	movzbl (%rax),%eax
+  801c55:	3c 2d                	cmp    $0x2d,%al
+  801c57:	75 0c                	jne    801c65 <strtol+0x7c>
+		s++, neg = 1;
+  801c59:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c5e:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801c65:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c69:	74 06                	je     801c71 <strtol+0x88>
+  801c6b:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801c6f:	75 28                	jne    801c99 <strtol+0xb0>
+  801c71:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c75:	0f b6 00             	movzbl (%rax),%eax
+  801c78:	3c 30                	cmp    $0x30,%al
+  801c7a:	75 1d                	jne    801c99 <strtol+0xb0>
+  801c7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c80:	48 83 c0 01          	add    $0x1,%rax
+  801c84:	0f b6 00             	movzbl (%rax),%eax
+  801c87:	3c 78                	cmp    $0x78,%al
+  801c89:	75 0e                	jne    801c99 <strtol+0xb0>
+		s += 2, base = 16;
+  801c8b:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801c90:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801c97:	eb 2c                	jmp    801cc5 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801c99:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801c9d:	75 19                	jne    801cb8 <strtol+0xcf>
+  801c9f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca3:	0f b6 00             	movzbl (%rax),%eax
+  801ca6:	3c 30                	cmp    $0x30,%al
+  801ca8:	75 0e                	jne    801cb8 <strtol+0xcf>
+		s++, base = 8;
+  801caa:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801caf:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801cb6:	eb 0d                	jmp    801cc5 <strtol+0xdc>
+	else if (base == 0)
+  801cb8:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cbc:	75 07                	jne    801cc5 <strtol+0xdc>
+		base = 10;
+  801cbe:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801cc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc9:	0f b6 00             	movzbl (%rax),%eax
+  801ccc:	3c 2f                	cmp    $0x2f,%al
+  801cce:	7e 1d                	jle    801ced <strtol+0x104>
+  801cd0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd4:	0f b6 00             	movzbl (%rax),%eax
+  801cd7:	3c 39                	cmp    $0x39,%al
+  801cd9:	7f 12                	jg     801ced <strtol+0x104>
+			dig = *s - '0';
+  801cdb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cdf:	0f b6 00             	movzbl (%rax),%eax
+  801ce2:	0f be c0             	movsbl %al,%eax
+  801ce5:	83 e8 30             	sub    $0x30,%eax
+  801ce8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801ceb:	eb 4e                	jmp    801d3b <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801ced:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cf1:	0f b6 00             	movzbl (%rax),%eax
+  801cf4:	3c 60                	cmp    $0x60,%al
+  801cf6:	7e 1d                	jle    801d15 <strtol+0x12c>
+  801cf8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cfc:	0f b6 00             	movzbl (%rax),%eax
+  801cff:	3c 7a                	cmp    $0x7a,%al
+  801d01:	7f 12                	jg     801d15 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801d03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d07:	0f b6 00             	movzbl (%rax),%eax
+  801d0a:	0f be c0             	movsbl %al,%eax
+  801d0d:	83 e8 57             	sub    $0x57,%eax
+  801d10:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d13:	eb 26                	jmp    801d3b <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801d15:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d19:	0f b6 00             	movzbl (%rax),%eax
+  801d1c:	3c 40                	cmp    $0x40,%al
+  801d1e:	7e 47                	jle    801d67 <strtol+0x17e>
+  801d20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d24:	0f b6 00             	movzbl (%rax),%eax
+  801d27:	3c 5a                	cmp    $0x5a,%al
+  801d29:	7f 3c                	jg     801d67 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801d2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d2f:	0f b6 00             	movzbl (%rax),%eax
+  801d32:	0f be c0             	movsbl %al,%eax
+  801d35:	83 e8 37             	sub    $0x37,%eax
+  801d38:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801d3b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d3e:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801d41:	7d 23                	jge    801d66 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801d43:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d48:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801d4b:	48 98                	cltq
+  801d4d:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801d52:	48 89 c2             	mov    %rax,%rdx
+  801d55:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d58:	48 98                	cltq
+  801d5a:	48 01 d0             	add    %rdx,%rax
+  801d5d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801d61:	e9 5f ff ff ff       	jmp    801cc5 <strtol+0xdc>
+			break;
+  801d66:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801d67:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801d6c:	74 0b                	je     801d79 <strtol+0x190>
+		*endptr = (char *) s;
+  801d6e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d72:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d76:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801d79:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801d7d:	74 09                	je     801d88 <strtol+0x19f>
+  801d7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d83:	48 f7 d8             	neg    %rax
+  801d86:	eb 04                	jmp    801d8c <strtol+0x1a3>
+  801d88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801d8c:	c9                   	leave
+  801d8d:	c3                   	ret
+
+0000000000801d8e <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801d8e:	55                   	push   %rbp
+  801d8f:	48 89 e5             	mov    %rsp,%rbp
+  801d92:	53                   	push   %rbx
+  801d93:	48 83 ec 30          	sub    $0x30,%rsp
+  801d97:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801d97 <strstr+0x9>
+  801d9e:	49 bb a9 72 00 00 00 	movabs $0x72a9,%r11
+  801da5:	00 00 00 
+  801da8:	4c 01 db             	add    %r11,%rbx
+  801dab:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801daf:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801db3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801db7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801dbb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dbf:	0f b6 00             	movzbl (%rax),%eax
+  801dc2:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801dc5:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801dc9:	75 06                	jne    801dd1 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801dcb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dcf:	eb 73                	jmp    801e44 <strstr+0xb6>
+
+	len = strlen(str);
+  801dd1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dd5:	48 89 c7             	mov    %rax,%rdi
+  801dd8:	48 b8 db 84 ff ff ff 	movabs $0xffffffffffff84db,%rax
+  801ddf:	ff ff ff 
+  801de2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801de6:	ff d0                	call   *%rax
+  801de8:	48 98                	cltq
+  801dea:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801dee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801df2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801df6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801dfa:	0f b6 00             	movzbl (%rax),%eax
+  801dfd:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801e00:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801e04:	75 07                	jne    801e0d <strstr+0x7f>
+				return (char *) 0;
+  801e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0b:	eb 37                	jmp    801e44 <strstr+0xb6>
+		} while (sc != c);
+  801e0d:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801e11:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801e14:	75 d8                	jne    801dee <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801e16:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e1a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e1e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e22:	48 89 ce             	mov    %rcx,%rsi
+  801e25:	48 89 c7             	mov    %rax,%rdi
+  801e28:	48 b8 8f 87 ff ff ff 	movabs $0xffffffffffff878f,%rax
+  801e2f:	ff ff ff 
+  801e32:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e36:	ff d0                	call   *%rax
+  801e38:	85 c0                	test   %eax,%eax
+  801e3a:	75 b2                	jne    801dee <strstr+0x60>
+
+	return (char *) (in - 1);
+  801e3c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e40:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801e44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e48:	c9                   	leave
+  801e49:	c3                   	ret
+
+0000000000801e4a <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801e4a:	55                   	push   %rbp
+  801e4b:	48 89 e5             	mov    %rsp,%rbp
+  801e4e:	41 57                	push   %r15
+  801e50:	53                   	push   %rbx
+  801e51:	48 83 ec 40          	sub    $0x40,%rsp
+  801e55:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801e55 <syscall+0xb>
+  801e5c:	49 bb eb 71 00 00 00 	movabs $0x71eb,%r11
+  801e63:	00 00 00 
+  801e66:	4d 01 da             	add    %r11,%r10
+  801e69:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801e6c:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801e6f:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801e73:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801e77:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801e7b:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801e7f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801e82:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801e86:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e8a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801e8e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801e92:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e96:	4c 89 c3             	mov    %r8,%rbx
+  801e99:	cd 30                	int    $0x30
+  801e9b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801e9f:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801ea3:	74 52                	je     801ef7 <syscall+0xad>
+  801ea5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801eaa:	7e 4b                	jle    801ef7 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801eac:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801eb0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801eb3:	49 89 d0             	mov    %rdx,%r8
+  801eb6:	89 c1                	mov    %eax,%ecx
+  801eb8:	48 b8 68 e3 ff ff ff 	movabs $0xffffffffffffe368,%rax
+  801ebf:	ff ff ff 
+  801ec2:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801ec6:	48 89 c2             	mov    %rax,%rdx
+  801ec9:	be 23 00 00 00       	mov    $0x23,%esi
+  801ece:	48 b8 85 e3 ff ff ff 	movabs $0xffffffffffffe385,%rax
+  801ed5:	ff ff ff 
+  801ed8:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801edc:	48 89 c7             	mov    %rax,%rdi
+  801edf:	4d 89 d7             	mov    %r10,%r15
+  801ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee7:	49 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r9
+  801eee:	ff ff ff 
+  801ef1:	4d 01 d1             	add    %r10,%r9
+  801ef4:	41 ff d1             	call   *%r9
+
+	return ret;
+  801ef7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801efb:	48 83 c4 40          	add    $0x40,%rsp
+  801eff:	5b                   	pop    %rbx
+  801f00:	41 5f                	pop    %r15
+  801f02:	5d                   	pop    %rbp
+  801f03:	c3                   	ret
+
+0000000000801f04 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801f04:	55                   	push   %rbp
+  801f05:	48 89 e5             	mov    %rsp,%rbp
+  801f08:	41 57                	push   %r15
+  801f0a:	41 56                	push   %r14
+  801f0c:	41 55                	push   %r13
+  801f0e:	41 54                	push   %r12
+  801f10:	53                   	push   %rbx
+  801f11:	48 83 ec 48          	sub    $0x48,%rsp
+  801f15:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801f15 <syscall_words+0x11>
+  801f1c:	49 bb 2b 71 00 00 00 	movabs $0x712b,%r11
+  801f23:	00 00 00 
+  801f26:	4d 01 de             	add    %r11,%r14
+  801f29:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801f2c:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801f2f:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801f33:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801f37:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801f3b:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801f3f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f44:	74 09                	je     801f4f <syscall_words+0x4b>
+  801f46:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f4a:	48 8b 00             	mov    (%rax),%rax
+  801f4d:	eb 05                	jmp    801f54 <syscall_words+0x50>
+  801f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f54:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801f57:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f5c:	74 0a                	je     801f68 <syscall_words+0x64>
+  801f5e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f62:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801f66:	eb 05                	jmp    801f6d <syscall_words+0x69>
+  801f68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6d:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801f70:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f75:	74 0a                	je     801f81 <syscall_words+0x7d>
+  801f77:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f7b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f7f:	eb 05                	jmp    801f86 <syscall_words+0x82>
+  801f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f86:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801f89:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801f8e:	74 0a                	je     801f9a <syscall_words+0x96>
+  801f90:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801f94:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f98:	eb 05                	jmp    801f9f <syscall_words+0x9b>
+  801f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9f:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  801fa2:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fa7:	74 0a                	je     801fb3 <syscall_words+0xaf>
+  801fa9:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fad:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801fb1:	eb 05                	jmp    801fb8 <syscall_words+0xb4>
+  801fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb8:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  801fbb:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fc0:	74 0a                	je     801fcc <syscall_words+0xc8>
+  801fc2:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fc6:	48 8b 40 28          	mov    0x28(%rax),%rax
+  801fca:	eb 05                	jmp    801fd1 <syscall_words+0xcd>
+  801fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd1:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  801fd4:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801fd7:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  801fdb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801fdf:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  801fe3:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  801fe7:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801feb:	cd 30                	int    $0x30
+  801fed:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  801ff1:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801ff6:	74 50                	je     802048 <syscall_words+0x144>
+		words[0] = r8;
+  801ff8:	4c 89 c2             	mov    %r8,%rdx
+  801ffb:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fff:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802002:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802006:	48 83 c0 08          	add    $0x8,%rax
+  80200a:	4c 89 ca             	mov    %r9,%rdx
+  80200d:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802010:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802014:	48 83 c0 10          	add    $0x10,%rax
+  802018:	4c 89 d2             	mov    %r10,%rdx
+  80201b:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  80201e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802022:	48 83 c0 18          	add    $0x18,%rax
+  802026:	4c 89 da             	mov    %r11,%rdx
+  802029:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80202c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802030:	48 83 c0 20          	add    $0x20,%rax
+  802034:	4c 89 e2             	mov    %r12,%rdx
+  802037:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80203a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80203e:	48 83 c0 28          	add    $0x28,%rax
+  802042:	4c 89 ea             	mov    %r13,%rdx
+  802045:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  802048:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80204c:	74 52                	je     8020a0 <syscall_words+0x19c>
+  80204e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  802053:	7e 4b                	jle    8020a0 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  802055:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802059:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80205c:	49 89 d0             	mov    %rdx,%r8
+  80205f:	89 c1                	mov    %eax,%ecx
+  802061:	48 b8 68 e3 ff ff ff 	movabs $0xffffffffffffe368,%rax
+  802068:	ff ff ff 
+  80206b:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  80206f:	48 89 c2             	mov    %rax,%rdx
+  802072:	be 4e 00 00 00       	mov    $0x4e,%esi
+  802077:	48 b8 85 e3 ff ff ff 	movabs $0xffffffffffffe385,%rax
+  80207e:	ff ff ff 
+  802081:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  802085:	48 89 c7             	mov    %rax,%rdi
+  802088:	4d 89 f7             	mov    %r14,%r15
+  80208b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802090:	49 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r9
+  802097:	ff ff ff 
+  80209a:	4d 01 f1             	add    %r14,%r9
+  80209d:	41 ff d1             	call   *%r9
+
+	return ret;
+  8020a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8020a4:	48 83 c4 48          	add    $0x48,%rsp
+  8020a8:	5b                   	pop    %rbx
+  8020a9:	41 5c                	pop    %r12
+  8020ab:	41 5d                	pop    %r13
+  8020ad:	41 5e                	pop    %r14
+  8020af:	41 5f                	pop    %r15
+  8020b1:	5d                   	pop    %rbp
+  8020b2:	c3                   	ret
+
+00000000008020b3 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8020b3:	55                   	push   %rbp
+  8020b4:	48 89 e5             	mov    %rsp,%rbp
+  8020b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8020bb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8020bb <sys_cputs+0x8>
+  8020c2:	49 bb 85 6f 00 00 00 	movabs $0x6f85,%r11
+  8020c9:	00 00 00 
+  8020cc:	4c 01 d8             	add    %r11,%rax
+  8020cf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8020d3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8020d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8020db:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8020df:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e3:	6a 00                	push   $0x0
+  8020e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020fb:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802102:	ff ff ff 
+  802105:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802109:	ff d0                	call   *%rax
+  80210b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80210f:	90                   	nop
+  802110:	c9                   	leave
+  802111:	c3                   	ret
+
+0000000000802112 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802112:	55                   	push   %rbp
+  802113:	48 89 e5             	mov    %rsp,%rbp
+  802116:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802116 <sys_cgetc+0x4>
+  80211d:	49 bb 2a 6f 00 00 00 	movabs $0x6f2a,%r11
+  802124:	00 00 00 
+  802127:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80212a:	48 83 ec 08          	sub    $0x8,%rsp
+  80212e:	6a 00                	push   $0x0
+  802130:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802136:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80213c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802141:	ba 00 00 00 00       	mov    $0x0,%edx
+  802146:	be 00 00 00 00       	mov    $0x0,%esi
+  80214b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802150:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802157:	ff ff ff 
+  80215a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80215e:	ff d0                	call   *%rax
+  802160:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802164:	c9                   	leave
+  802165:	c3                   	ret
+
+0000000000802166 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  802166:	55                   	push   %rbp
+  802167:	48 89 e5             	mov    %rsp,%rbp
+  80216a:	48 83 ec 10          	sub    $0x10,%rsp
+  80216e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80216e <sys_env_destroy+0x8>
+  802175:	49 bb d2 6e 00 00 00 	movabs $0x6ed2,%r11
+  80217c:	00 00 00 
+  80217f:	4c 01 d8             	add    %r11,%rax
+  802182:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802185:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802188:	48 63 d2             	movslq %edx,%rdx
+  80218b:	48 83 ec 08          	sub    $0x8,%rsp
+  80218f:	6a 00                	push   $0x0
+  802191:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802197:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80219d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8021a7:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021ac:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  8021b3:	ff ff ff 
+  8021b6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021ba:	ff d0                	call   *%rax
+  8021bc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021c0:	c9                   	leave
+  8021c1:	c3                   	ret
+
+00000000008021c2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8021c2:	55                   	push   %rbp
+  8021c3:	48 89 e5             	mov    %rsp,%rbp
+  8021c6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021c6 <sys_getenvid+0x4>
+  8021cd:	49 bb 7a 6e 00 00 00 	movabs $0x6e7a,%r11
+  8021d4:	00 00 00 
+  8021d7:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8021da:	48 83 ec 08          	sub    $0x8,%rsp
+  8021de:	6a 00                	push   $0x0
+  8021e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021fb:	bf 02 00 00 00       	mov    $0x2,%edi
+  802200:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802207:	ff ff ff 
+  80220a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80220e:	ff d0                	call   *%rax
+  802210:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802214:	c9                   	leave
+  802215:	c3                   	ret
+
+0000000000802216 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802216:	55                   	push   %rbp
+  802217:	48 89 e5             	mov    %rsp,%rbp
+  80221a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80221a <sys_yield+0x4>
+  802221:	49 bb 26 6e 00 00 00 	movabs $0x6e26,%r11
+  802228:	00 00 00 
+  80222b:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80222e:	48 83 ec 08          	sub    $0x8,%rsp
+  802232:	6a 00                	push   $0x0
+  802234:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80223a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802245:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224a:	be 00 00 00 00       	mov    $0x0,%esi
+  80224f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802254:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  80225b:	ff ff ff 
+  80225e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802262:	ff d0                	call   *%rax
+  802264:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802268:	90                   	nop
+  802269:	c9                   	leave
+  80226a:	c3                   	ret
+
+000000000080226b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80226b:	55                   	push   %rbp
+  80226c:	48 89 e5             	mov    %rsp,%rbp
+  80226f:	48 83 ec 10          	sub    $0x10,%rsp
+  802273:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802273 <sys_page_alloc+0x8>
+  80227a:	49 bb cd 6d 00 00 00 	movabs $0x6dcd,%r11
+  802281:	00 00 00 
+  802284:	4c 01 d8             	add    %r11,%rax
+  802287:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80228a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80228e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  802291:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802294:	48 63 f2             	movslq %edx,%rsi
+  802297:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80229b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80229e:	48 63 d2             	movslq %edx,%rdx
+  8022a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a5:	6a 00                	push   $0x0
+  8022a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022ad:	49 89 f0             	mov    %rsi,%r8
+  8022b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8022b5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022ba:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  8022c1:	ff ff ff 
+  8022c4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c8:	ff d0                	call   *%rax
+  8022ca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022ce:	c9                   	leave
+  8022cf:	c3                   	ret
+
+00000000008022d0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8022d0:	55                   	push   %rbp
+  8022d1:	48 89 e5             	mov    %rsp,%rbp
+  8022d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8022d8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d8 <sys_page_map+0x8>
+  8022df:	49 bb 68 6d 00 00 00 	movabs $0x6d68,%r11
+  8022e6:	00 00 00 
+  8022e9:	4c 01 d8             	add    %r11,%rax
+  8022ec:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022f3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8022f6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8022fa:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  8022fe:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802301:	48 63 f2             	movslq %edx,%rsi
+  802304:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802308:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80230b:	48 63 fa             	movslq %edx,%rdi
+  80230e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802312:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802315:	48 63 d2             	movslq %edx,%rdx
+  802318:	48 83 ec 08          	sub    $0x8,%rsp
+  80231c:	56                   	push   %rsi
+  80231d:	4d 89 c1             	mov    %r8,%r9
+  802320:	49 89 f8             	mov    %rdi,%r8
+  802323:	be 01 00 00 00       	mov    $0x1,%esi
+  802328:	bf 05 00 00 00       	mov    $0x5,%edi
+  80232d:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802334:	ff ff ff 
+  802337:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80233b:	ff d0                	call   *%rax
+  80233d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802341:	c9                   	leave
+  802342:	c3                   	ret
+
+0000000000802343 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  802343:	55                   	push   %rbp
+  802344:	48 89 e5             	mov    %rsp,%rbp
+  802347:	48 83 ec 10          	sub    $0x10,%rsp
+  80234b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80234b <sys_page_unmap+0x8>
+  802352:	49 bb f5 6c 00 00 00 	movabs $0x6cf5,%r11
+  802359:	00 00 00 
+  80235c:	4c 01 d8             	add    %r11,%rax
+  80235f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802362:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  802366:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80236a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80236d:	48 63 d2             	movslq %edx,%rdx
+  802370:	48 83 ec 08          	sub    $0x8,%rsp
+  802374:	6a 00                	push   $0x0
+  802376:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80237c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802382:	be 01 00 00 00       	mov    $0x1,%esi
+  802387:	bf 06 00 00 00       	mov    $0x6,%edi
+  80238c:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802393:	ff ff ff 
+  802396:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80239a:	ff d0                	call   *%rax
+  80239c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a0:	c9                   	leave
+  8023a1:	c3                   	ret
+
+00000000008023a2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8023a2:	55                   	push   %rbp
+  8023a3:	48 89 e5             	mov    %rsp,%rbp
+  8023a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8023aa:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023aa <sys_env_set_status+0x8>
+  8023b1:	49 bb 96 6c 00 00 00 	movabs $0x6c96,%r11
+  8023b8:	00 00 00 
+  8023bb:	4c 01 d8             	add    %r11,%rax
+  8023be:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023c1:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8023c4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8023c7:	48 63 ca             	movslq %edx,%rcx
+  8023ca:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023cd:	48 63 d2             	movslq %edx,%rdx
+  8023d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d4:	6a 00                	push   $0x0
+  8023d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8023e7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8023ec:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  8023f3:	ff ff ff 
+  8023f6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023fa:	ff d0                	call   *%rax
+  8023fc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802400:	c9                   	leave
+  802401:	c3                   	ret
+
+0000000000802402 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802402:	55                   	push   %rbp
+  802403:	48 89 e5             	mov    %rsp,%rbp
+  802406:	48 83 ec 10          	sub    $0x10,%rsp
+  80240a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80240a <sys_env_set_trapframe+0x8>
+  802411:	49 bb 36 6c 00 00 00 	movabs $0x6c36,%r11
+  802418:	00 00 00 
+  80241b:	4c 01 d8             	add    %r11,%rax
+  80241e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802421:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802425:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802429:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80242c:	48 63 d2             	movslq %edx,%rdx
+  80242f:	48 83 ec 08          	sub    $0x8,%rsp
+  802433:	6a 00                	push   $0x0
+  802435:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80243b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802441:	be 01 00 00 00       	mov    $0x1,%esi
+  802446:	bf 09 00 00 00       	mov    $0x9,%edi
+  80244b:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802452:	ff ff ff 
+  802455:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802459:	ff d0                	call   *%rax
+  80245b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80245f:	c9                   	leave
+  802460:	c3                   	ret
+
+0000000000802461 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  802461:	55                   	push   %rbp
+  802462:	48 89 e5             	mov    %rsp,%rbp
+  802465:	48 83 ec 10          	sub    $0x10,%rsp
+  802469:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802469 <sys_env_set_pgfault_upcall+0x8>
+  802470:	49 bb d7 6b 00 00 00 	movabs $0x6bd7,%r11
+  802477:	00 00 00 
+  80247a:	4c 01 d8             	add    %r11,%rax
+  80247d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802480:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  802484:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802488:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80248b:	48 63 d2             	movslq %edx,%rdx
+  80248e:	48 83 ec 08          	sub    $0x8,%rsp
+  802492:	6a 00                	push   $0x0
+  802494:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80249a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8024a5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8024aa:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  8024b1:	ff ff ff 
+  8024b4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024b8:	ff d0                	call   *%rax
+  8024ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024be:	c9                   	leave
+  8024bf:	c3                   	ret
+
+00000000008024c0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  8024c0:	55                   	push   %rbp
+  8024c1:	48 89 e5             	mov    %rsp,%rbp
+  8024c4:	48 83 ec 20          	sub    $0x20,%rsp
+  8024c8:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024c8 <sys_ipc_try_send+0x8>
+  8024cf:	49 bb 78 6b 00 00 00 	movabs $0x6b78,%r11
+  8024d6:	00 00 00 
+  8024d9:	4c 01 d8             	add    %r11,%rax
+  8024dc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024df:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024e3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024e7:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8024ea:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024ed:	48 63 fa             	movslq %edx,%rdi
+  8024f0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024f4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024f7:	48 63 d2             	movslq %edx,%rdx
+  8024fa:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802502:	6a 00                	push   $0x0
+  802504:	49 89 f9             	mov    %rdi,%r9
+  802507:	49 89 f0             	mov    %rsi,%r8
+  80250a:	be 00 00 00 00       	mov    $0x0,%esi
+  80250f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802514:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  80251b:	ff ff ff 
+  80251e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802522:	ff d0                	call   *%rax
+  802524:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802528:	c9                   	leave
+  802529:	c3                   	ret
+
+000000000080252a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80252a:	55                   	push   %rbp
+  80252b:	48 89 e5             	mov    %rsp,%rbp
+  80252e:	48 83 ec 20          	sub    $0x20,%rsp
+  802532:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802532 <sys_ipc_send+0x8>
+  802539:	49 bb 0e 6b 00 00 00 	movabs $0x6b0e,%r11
+  802540:	00 00 00 
+  802543:	4c 01 d8             	add    %r11,%rax
+  802546:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802549:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80254d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802551:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  802554:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802557:	48 63 fa             	movslq %edx,%rdi
+  80255a:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80255e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802561:	48 63 d2             	movslq %edx,%rdx
+  802564:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802568:	48 83 ec 08          	sub    $0x8,%rsp
+  80256c:	6a 00                	push   $0x0
+  80256e:	49 89 f9             	mov    %rdi,%r9
+  802571:	49 89 f0             	mov    %rsi,%r8
+  802574:	be 00 00 00 00       	mov    $0x0,%esi
+  802579:	bf 17 00 00 00       	mov    $0x17,%edi
+  80257e:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802585:	ff ff ff 
+  802588:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80258c:	ff d0                	call   *%rax
+  80258e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802592:	c9                   	leave
+  802593:	c3                   	ret
+
+0000000000802594 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  802594:	55                   	push   %rbp
+  802595:	48 89 e5             	mov    %rsp,%rbp
+  802598:	48 83 ec 10          	sub    $0x10,%rsp
+  80259c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80259c <sys_ipc_recv+0x8>
+  8025a3:	49 bb a4 6a 00 00 00 	movabs $0x6aa4,%r11
+  8025aa:	00 00 00 
+  8025ad:	4c 01 d8             	add    %r11,%rax
+  8025b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  8025b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025b8:	6a 00                	push   $0x0
+  8025ba:	6a 00                	push   $0x0
+  8025bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8025d2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8025d7:	49 ba c4 8e ff ff ff 	movabs $0xffffffffffff8ec4,%r10
+  8025de:	ff ff ff 
+  8025e1:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025e5:	ff d0                	call   *%rax
+  8025e7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025eb:	c9                   	leave
+  8025ec:	c3                   	ret
+
+00000000008025ed <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  8025ed:	55                   	push   %rbp
+  8025ee:	48 89 e5             	mov    %rsp,%rbp
+  8025f1:	48 83 ec 30          	sub    $0x30,%rsp
+  8025f5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025f5 <sys_ipc_call+0x8>
+  8025fc:	49 bb 4b 6a 00 00 00 	movabs $0x6a4b,%r11
+  802603:	00 00 00 
+  802606:	4c 01 d8             	add    %r11,%rax
+  802609:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80260c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802610:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802614:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802617:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80261b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80261f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802623:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802626:	4c 63 c2             	movslq %edx,%r8
+  802629:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80262d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802630:	48 63 d2             	movslq %edx,%rdx
+  802633:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802637:	ff 75 d8             	push   -0x28(%rbp)
+  80263a:	56                   	push   %rsi
+  80263b:	4d 89 c1             	mov    %r8,%r9
+  80263e:	49 89 f8             	mov    %rdi,%r8
+  802641:	be 00 00 00 00       	mov    $0x0,%esi
+  802646:	bf 18 00 00 00       	mov    $0x18,%edi
+  80264b:	49 ba c4 8e ff ff ff 	movabs $0xffffffffffff8ec4,%r10
+  802652:	ff ff ff 
+  802655:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802659:	ff d0                	call   *%rax
+  80265b:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  80265f:	c9                   	leave
+  802660:	c3                   	ret
+
+0000000000802661 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  802661:	55                   	push   %rbp
+  802662:	48 89 e5             	mov    %rsp,%rbp
+  802665:	48 83 ec 30          	sub    $0x30,%rsp
+  802669:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802669 <sys_ipc_reply_recv+0x8>
+  802670:	49 bb d7 69 00 00 00 	movabs $0x69d7,%r11
+  802677:	00 00 00 
+  80267a:	4c 01 d8             	add    %r11,%rax
+  80267d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802680:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802684:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802688:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  80268b:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80268f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  802693:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802697:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80269a:	4c 63 c2             	movslq %edx,%r8
+  80269d:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8026a1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8026a4:	48 63 d2             	movslq %edx,%rdx
+  8026a7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026ab:	ff 75 d8             	push   -0x28(%rbp)
+  8026ae:	56                   	push   %rsi
+  8026af:	4d 89 c1             	mov    %r8,%r9
+  8026b2:	49 89 f8             	mov    %rdi,%r8
+  8026b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ba:	bf 19 00 00 00       	mov    $0x19,%edi
+  8026bf:	49 ba c4 8e ff ff ff 	movabs $0xffffffffffff8ec4,%r10
+  8026c6:	ff ff ff 
+  8026c9:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026cd:	ff d0                	call   *%rax
+  8026cf:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  8026d3:	c9                   	leave
+  8026d4:	c3                   	ret
+
+00000000008026d5 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  8026d5:	55                   	push   %rbp
+  8026d6:	48 89 e5             	mov    %rsp,%rbp
+  8026d9:	48 83 ec 10          	sub    $0x10,%rsp
+  8026dd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026dd <sys_env_set_priority+0x8>
+  8026e4:	49 bb 63 69 00 00 00 	movabs $0x6963,%r11
+  8026eb:	00 00 00 
+  8026ee:	4c 01 d8             	add    %r11,%rax
+  8026f1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026f4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  8026f7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026fa:	48 63 ca             	movslq %edx,%rcx
+  8026fd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802700:	48 63 d2             	movslq %edx,%rdx
+  802703:	48 83 ec 08          	sub    $0x8,%rsp
+  802707:	6a 00                	push   $0x0
+  802709:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80270f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802715:	be 01 00 00 00       	mov    $0x1,%esi
+  80271a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80271f:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802726:	ff ff ff 
+  802729:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80272d:	ff d0                	call   *%rax
+  80272f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802733:	c9                   	leave
+  802734:	c3                   	ret
+
+0000000000802735 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802735:	55                   	push   %rbp
+  802736:	48 89 e5             	mov    %rsp,%rbp
+  802739:	48 83 ec 10          	sub    $0x10,%rsp
+  80273d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80273d <sys_env_set_affinity+0x8>
+  802744:	49 bb 03 69 00 00 00 	movabs $0x6903,%r11
+  80274b:	00 00 00 
+  80274e:	4c 01 d8             	add    %r11,%rax
+  802751:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802754:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  802757:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  80275a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80275d:	48 63 d2             	movslq %edx,%rdx
+  802760:	48 83 ec 08          	sub    $0x8,%rsp
+  802764:	6a 00                	push   $0x0
+  802766:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80276c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802772:	be 01 00 00 00       	mov    $0x1,%esi
+  802777:	bf 10 00 00 00       	mov    $0x10,%edi
+  80277c:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802783:	ff ff ff 
+  802786:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80278a:	ff d0                	call   *%rax
+  80278c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802790:	c9                   	leave
+  802791:	c3                   	ret
+
+0000000000802792 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  802792:	55                   	push   %rbp
+  802793:	48 89 e5             	mov    %rsp,%rbp
+  802796:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802796 <sys_time_msec+0x4>
+  80279d:	49 bb aa 68 00 00 00 	movabs $0x68aa,%r11
+  8027a4:	00 00 00 
+  8027a7:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  8027aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ae:	6a 00                	push   $0x0
+  8027b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027cb:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8027d0:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  8027d7:	ff ff ff 
+  8027da:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027de:	ff d0                	call   *%rax
+  8027e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027e4:	c9                   	leave
+  8027e5:	c3                   	ret
+
+00000000008027e6 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  8027e6:	55                   	push   %rbp
+  8027e7:	48 89 e5             	mov    %rsp,%rbp
+  8027ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8027ee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027ee <sys_sleep_usec+0x8>
+  8027f5:	49 bb 52 68 00 00 00 	movabs $0x6852,%r11
+  8027fc:	00 00 00 
+  8027ff:	4c 01 d8             	add    %r11,%rax
+  802802:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802806:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80280a:	48 83 ec 08          	sub    $0x8,%rsp
+  80280e:	6a 00                	push   $0x0
+  802810:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802816:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80281c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802821:	be 00 00 00 00       	mov    $0x0,%esi
+  802826:	bf 11 00 00 00       	mov    $0x11,%edi
+  80282b:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802832:	ff ff ff 
+  802835:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802839:	ff d0                	call   *%rax
+  80283b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80283f:	c9                   	leave
+  802840:	c3                   	ret
+
+0000000000802841 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  802841:	55                   	push   %rbp
+  802842:	48 89 e5             	mov    %rsp,%rbp
+  802845:	48 83 ec 10          	sub    $0x10,%rsp
+  802849:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802849 <sys_page_alloc_huge+0x8>
+  802850:	49 bb f7 67 00 00 00 	movabs $0x67f7,%r11
+  802857:	00 00 00 
+  80285a:	4c 01 d8             	add    %r11,%rax
+  80285d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802860:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802864:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  802867:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80286a:	48 63 f2             	movslq %edx,%rsi
+  80286d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802871:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802874:	48 63 d2             	movslq %edx,%rdx
+  802877:	48 83 ec 08          	sub    $0x8,%rsp
+  80287b:	6a 00                	push   $0x0
+  80287d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802883:	49 89 f0             	mov    %rsi,%r8
+  802886:	be 01 00 00 00       	mov    $0x1,%esi
+  80288b:	bf 12 00 00 00       	mov    $0x12,%edi
+  802890:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802897:	ff ff ff 
+  80289a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80289e:	ff d0                	call   *%rax
+  8028a0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028a4:	c9                   	leave
+  8028a5:	c3                   	ret
+
+00000000008028a6 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  8028a6:	55                   	push   %rbp
+  8028a7:	48 89 e5             	mov    %rsp,%rbp
+  8028aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8028ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028ae <sys_page_map_batch+0x8>
+  8028b5:	49 bb 92 67 00 00 00 	movabs $0x6792,%r11
+  8028bc:	00 00 00 
+  8028bf:	4c 01 d8             	add    %r11,%rax
+  8028c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028c6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8028ca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8028ce:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d6:	6a 00                	push   $0x0
+  8028d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028e4:	be 01 00 00 00       	mov    $0x1,%esi
+  8028e9:	bf 13 00 00 00       	mov    $0x13,%edi
+  8028ee:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  8028f5:	ff ff ff 
+  8028f8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028fc:	ff d0                	call   *%rax
+  8028fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802902:	c9                   	leave
+  802903:	c3                   	ret
+
+0000000000802904 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802904:	55                   	push   %rbp
+  802905:	48 89 e5             	mov    %rsp,%rbp
+  802908:	48 83 ec 10          	sub    $0x10,%rsp
+  80290c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80290c <sys_page_alloc_batch+0x8>
+  802913:	49 bb 34 67 00 00 00 	movabs $0x6734,%r11
+  80291a:	00 00 00 
+  80291d:	4c 01 d8             	add    %r11,%rax
+  802920:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802924:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802928:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80292c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802930:	48 83 ec 08          	sub    $0x8,%rsp
+  802934:	6a 00                	push   $0x0
+  802936:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80293c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802942:	be 01 00 00 00       	mov    $0x1,%esi
+  802947:	bf 14 00 00 00       	mov    $0x14,%edi
+  80294c:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802953:	ff ff ff 
+  802956:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80295a:	ff d0                	call   *%rax
+  80295c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802960:	c9                   	leave
+  802961:	c3                   	ret
+
+0000000000802962 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  802962:	55                   	push   %rbp
+  802963:	48 89 e5             	mov    %rsp,%rbp
+  802966:	48 83 ec 10          	sub    $0x10,%rsp
+  80296a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80296a <sys_page_unmap_batch+0x8>
+  802971:	49 bb d6 66 00 00 00 	movabs $0x66d6,%r11
+  802978:	00 00 00 
+  80297b:	4c 01 d8             	add    %r11,%rax
+  80297e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802982:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802986:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80298a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80298e:	48 83 ec 08          	sub    $0x8,%rsp
+  802992:	6a 00                	push   $0x0
+  802994:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80299a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8029a5:	bf 15 00 00 00       	mov    $0x15,%edi
+  8029aa:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  8029b1:	ff ff ff 
+  8029b4:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029b8:	ff d0                	call   *%rax
+  8029ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029be:	c9                   	leave
+  8029bf:	c3                   	ret
+
+00000000008029c0 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029c4 <sys_fork+0x4>
+  8029cb:	49 bb 7c 66 00 00 00 	movabs $0x667c,%r11
+  8029d2:	00 00 00 
+  8029d5:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  8029d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8029dc:	6a 00                	push   $0x0
+  8029de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f9:	bf 16 00 00 00       	mov    $0x16,%edi
+  8029fe:	49 ba 0a 8e ff ff ff 	movabs $0xffffffffffff8e0a,%r10
+  802a05:	ff ff ff 
+  802a08:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a0c:	ff d0                	call   *%rax
+  802a0e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a12:	c9                   	leave
+  802a13:	c3                   	ret
+
+0000000000802a14 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802a14:	55                   	push   %rbp
+  802a15:	48 89 e5             	mov    %rsp,%rbp
+  802a18:	41 57                	push   %r15
+  802a1a:	53                   	push   %rbx
+  802a1b:	48 83 ec 40          	sub    $0x40,%rsp
+  802a1f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a1f <pgfault+0xb>
+  802a26:	49 bb 21 66 00 00 00 	movabs $0x6621,%r11
+  802a2d:	00 00 00 
+  802a30:	4c 01 db             	add    %r11,%rbx
+  802a33:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802a37:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a3b:	48 8b 00             	mov    (%rax),%rax
+  802a3e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802a42:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a46:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a4a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802a4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a51:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802a55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a59:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802a5f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802a63:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802a66:	83 e0 02             	and    $0x2,%eax
+  802a69:	85 c0                	test   %eax,%eax
+  802a6b:	0f 84 91 03 00 00    	je     802e02 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802a71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a75:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802a79:	48 89 c2             	mov    %rax,%rdx
+  802a7c:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802a83:	ff ff ff 
+  802a86:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802a8a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a8e:	83 e0 01             	and    $0x1,%eax
+  802a91:	48 85 c0             	test   %rax,%rax
+  802a94:	0f 84 a7 01 00 00    	je     802c41 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802a9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a9e:	48 c1 e8 15          	shr    $0x15,%rax
+  802aa2:	48 89 c2             	mov    %rax,%rdx
+  802aa5:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802aac:	ff ff ff 
+  802aaf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ab3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ab7:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802abc:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802ac2:	0f 85 79 01 00 00    	jne    802c41 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802ac8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802acc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802ad0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ad4:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802ada:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802ade:	ba 07 00 00 00       	mov    $0x7,%edx
+  802ae3:	be 00 00 60 00       	mov    $0x600000,%esi
+  802ae8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aed:	49 89 df             	mov    %rbx,%r15
+  802af0:	48 b8 01 98 ff ff ff 	movabs $0xffffffffffff9801,%rax
+  802af7:	ff ff ff 
+  802afa:	48 01 d8             	add    %rbx,%rax
+  802afd:	ff d0                	call   *%rax
+  802aff:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802b02:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802b06:	79 44                	jns    802b4c <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802b08:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802b0b:	89 c1                	mov    %eax,%ecx
+  802b0d:	48 b8 98 e3 ff ff ff 	movabs $0xffffffffffffe398,%rax
+  802b14:	ff ff ff 
+  802b17:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b1b:	48 89 c2             	mov    %rax,%rdx
+  802b1e:	be 20 00 00 00       	mov    $0x20,%esi
+  802b23:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  802b2a:	ff ff ff 
+  802b2d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b31:	48 89 c7             	mov    %rax,%rdi
+  802b34:	49 89 df             	mov    %rbx,%r15
+  802b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3c:	49 b8 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r8
+  802b43:	ff ff ff 
+  802b46:	49 01 d8             	add    %rbx,%r8
+  802b49:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802b4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b50:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802b55:	48 89 c6             	mov    %rax,%rsi
+  802b58:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802b5d:	49 89 df             	mov    %rbx,%r15
+  802b60:	48 b8 7a 8a ff ff ff 	movabs $0xffffffffffff8a7a,%rax
+  802b67:	ff ff ff 
+  802b6a:	48 01 d8             	add    %rbx,%rax
+  802b6d:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802b6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b73:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802b79:	48 89 c1             	mov    %rax,%rcx
+  802b7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b81:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b86:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b8b:	49 89 df             	mov    %rbx,%r15
+  802b8e:	48 b8 90 92 ff ff ff 	movabs $0xffffffffffff9290,%rax
+  802b95:	ff ff ff 
+  802b98:	48 01 d8             	add    %rbx,%rax
+  802b9b:	ff d0                	call   *%rax
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	74 3e                	je     802bdf <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802ba1:	48 b8 c3 e3 ff ff ff 	movabs $0xffffffffffffe3c3,%rax
+  802ba8:	ff ff ff 
+  802bab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802baf:	48 89 c2             	mov    %rax,%rdx
+  802bb2:	be 23 00 00 00       	mov    $0x23,%esi
+  802bb7:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  802bbe:	ff ff ff 
+  802bc1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802bc5:	48 89 c7             	mov    %rax,%rdi
+  802bc8:	49 89 df             	mov    %rbx,%r15
+  802bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd0:	48 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%rcx
+  802bd7:	ff ff ff 
+  802bda:	48 01 d9             	add    %rbx,%rcx
+  802bdd:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802bdf:	be 00 00 60 00       	mov    $0x600000,%esi
+  802be4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be9:	49 89 df             	mov    %rbx,%r15
+  802bec:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  802bf3:	ff ff ff 
+  802bf6:	48 01 d8             	add    %rbx,%rax
+  802bf9:	ff d0                	call   *%rax
+  802bfb:	85 c0                	test   %eax,%eax
+  802bfd:	0f 84 3d 02 00 00    	je     802e40 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802c03:	48 b8 d8 e3 ff ff ff 	movabs $0xffffffffffffe3d8,%rax
+  802c0a:	ff ff ff 
+  802c0d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c11:	48 89 c2             	mov    %rax,%rdx
+  802c14:	be 25 00 00 00       	mov    $0x25,%esi
+  802c19:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  802c20:	ff ff ff 
+  802c23:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c27:	48 89 c7             	mov    %rax,%rdi
+  802c2a:	49 89 df             	mov    %rbx,%r15
+  802c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c32:	48 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%rcx
+  802c39:	ff ff ff 
+  802c3c:	48 01 d9             	add    %rbx,%rcx
+  802c3f:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802c41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c45:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c49:	48 89 c2             	mov    %rax,%rdx
+  802c4c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802c53:	ff ff ff 
+  802c56:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802c5a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c5e:	25 00 08 00 00       	and    $0x800,%eax
+  802c63:	48 85 c0             	test   %rax,%rax
+  802c66:	0f 84 58 01 00 00    	je     802dc4 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802c6c:	ba 07 00 00 00       	mov    $0x7,%edx
+  802c71:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c7b:	49 89 df             	mov    %rbx,%r15
+  802c7e:	48 b8 2b 92 ff ff ff 	movabs $0xffffffffffff922b,%rax
+  802c85:	ff ff ff 
+  802c88:	48 01 d8             	add    %rbx,%rax
+  802c8b:	ff d0                	call   *%rax
+  802c8d:	85 c0                	test   %eax,%eax
+  802c8f:	74 3e                	je     802ccf <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802c91:	48 b8 ef e3 ff ff ff 	movabs $0xffffffffffffe3ef,%rax
+  802c98:	ff ff ff 
+  802c9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c9f:	48 89 c2             	mov    %rax,%rdx
+  802ca2:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802ca7:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  802cae:	ff ff ff 
+  802cb1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cb5:	48 89 c7             	mov    %rax,%rdi
+  802cb8:	49 89 df             	mov    %rbx,%r15
+  802cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cc0:	48 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%rcx
+  802cc7:	ff ff ff 
+  802cca:	48 01 d9             	add    %rbx,%rcx
+  802ccd:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802ccf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cd3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cd8:	48 89 c6             	mov    %rax,%rsi
+  802cdb:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802ce0:	49 89 df             	mov    %rbx,%r15
+  802ce3:	48 b8 7a 8a ff ff ff 	movabs $0xffffffffffff8a7a,%rax
+  802cea:	ff ff ff 
+  802ced:	48 01 d8             	add    %rbx,%rax
+  802cf0:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802cf2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cf6:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802cfc:	48 89 c1             	mov    %rax,%rcx
+  802cff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d04:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802d09:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d0e:	49 89 df             	mov    %rbx,%r15
+  802d11:	48 b8 90 92 ff ff ff 	movabs $0xffffffffffff9290,%rax
+  802d18:	ff ff ff 
+  802d1b:	48 01 d8             	add    %rbx,%rax
+  802d1e:	ff d0                	call   *%rax
+  802d20:	85 c0                	test   %eax,%eax
+  802d22:	74 3e                	je     802d62 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802d24:	48 b8 c3 e3 ff ff ff 	movabs $0xffffffffffffe3c3,%rax
+  802d2b:	ff ff ff 
+  802d2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d32:	48 89 c2             	mov    %rax,%rdx
+  802d35:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802d3a:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  802d41:	ff ff ff 
+  802d44:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d48:	48 89 c7             	mov    %rax,%rdi
+  802d4b:	49 89 df             	mov    %rbx,%r15
+  802d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d53:	48 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%rcx
+  802d5a:	ff ff ff 
+  802d5d:	48 01 d9             	add    %rbx,%rcx
+  802d60:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802d62:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802d67:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6c:	49 89 df             	mov    %rbx,%r15
+  802d6f:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  802d76:	ff ff ff 
+  802d79:	48 01 d8             	add    %rbx,%rax
+  802d7c:	ff d0                	call   *%rax
+  802d7e:	85 c0                	test   %eax,%eax
+  802d80:	0f 84 bb 00 00 00    	je     802e41 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802d86:	48 b8 d8 e3 ff ff ff 	movabs $0xffffffffffffe3d8,%rax
+  802d8d:	ff ff ff 
+  802d90:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d94:	48 89 c2             	mov    %rax,%rdx
+  802d97:	be 32 00 00 00       	mov    $0x32,%esi
+  802d9c:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  802da3:	ff ff ff 
+  802da6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802daa:	48 89 c7             	mov    %rax,%rdi
+  802dad:	49 89 df             	mov    %rbx,%r15
+  802db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db5:	48 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%rcx
+  802dbc:	ff ff ff 
+  802dbf:	48 01 d9             	add    %rbx,%rcx
+  802dc2:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802dc4:	48 b8 08 e4 ff ff ff 	movabs $0xffffffffffffe408,%rax
+  802dcb:	ff ff ff 
+  802dce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802dd2:	48 89 c2             	mov    %rax,%rdx
+  802dd5:	be 36 00 00 00       	mov    $0x36,%esi
+  802dda:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  802de1:	ff ff ff 
+  802de4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802de8:	48 89 c7             	mov    %rax,%rdi
+  802deb:	49 89 df             	mov    %rbx,%r15
+  802dee:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df3:	48 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%rcx
+  802dfa:	ff ff ff 
+  802dfd:	48 01 d9             	add    %rbx,%rcx
+  802e00:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802e02:	48 b8 27 e4 ff ff ff 	movabs $0xffffffffffffe427,%rax
+  802e09:	ff ff ff 
+  802e0c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e10:	48 89 c2             	mov    %rax,%rdx
+  802e13:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802e18:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  802e1f:	ff ff ff 
+  802e22:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e26:	48 89 c7             	mov    %rax,%rdi
+  802e29:	49 89 df             	mov    %rbx,%r15
+  802e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e31:	48 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%rcx
+  802e38:	ff ff ff 
+  802e3b:	48 01 d9             	add    %rbx,%rcx
+  802e3e:	ff d1                	call   *%rcx
+			return;
+  802e40:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802e41:	48 83 c4 40          	add    $0x40,%rsp
+  802e45:	5b                   	pop    %rbx
+  802e46:	41 5f                	pop    %r15
+  802e48:	5d                   	pop    %rbp
+  802e49:	c3                   	ret
+
+0000000000802e4a <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802e4a:	55                   	push   %rbp
+  802e4b:	48 89 e5             	mov    %rsp,%rbp
+  802e4e:	41 57                	push   %r15
+  802e50:	53                   	push   %rbx
+  802e51:	48 83 ec 10          	sub    $0x10,%rsp
+  802e55:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802e55 <fork_flush+0xb>
+  802e5c:	49 bb eb 61 00 00 00 	movabs $0x61eb,%r11
+  802e63:	00 00 00 
+  802e66:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802e69:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802e70:	00 00 00 
+  802e73:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e77:	48 85 c0             	test   %rax,%rax
+  802e7a:	0f 84 81 00 00 00    	je     802f01 <fork_flush+0xb7>
+  802e80:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802e87:	00 00 00 
+  802e8a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802e8e:	48 89 c6             	mov    %rax,%rsi
+  802e91:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802e98:	00 00 00 
+  802e9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e9f:	48 89 c7             	mov    %rax,%rdi
+  802ea2:	49 89 df             	mov    %rbx,%r15
+  802ea5:	48 b8 66 98 ff ff ff 	movabs $0xffffffffffff9866,%rax
+  802eac:	ff ff ff 
+  802eaf:	48 01 d8             	add    %rbx,%rax
+  802eb2:	ff d0                	call   *%rax
+  802eb4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802eb7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802ebb:	79 44                	jns    802f01 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802ebd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ec0:	89 c1                	mov    %eax,%ecx
+  802ec2:	48 b8 40 e4 ff ff ff 	movabs $0xffffffffffffe440,%rax
+  802ec9:	ff ff ff 
+  802ecc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ed0:	48 89 c2             	mov    %rax,%rdx
+  802ed3:	be 56 00 00 00       	mov    $0x56,%esi
+  802ed8:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  802edf:	ff ff ff 
+  802ee2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802ee6:	48 89 c7             	mov    %rax,%rdi
+  802ee9:	49 89 df             	mov    %rbx,%r15
+  802eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef1:	49 b8 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r8
+  802ef8:	ff ff ff 
+  802efb:	49 01 d8             	add    %rbx,%r8
+  802efe:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802f01:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f08:	00 00 00 
+  802f0b:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802f12:	00 
+}
+  802f13:	90                   	nop
+  802f14:	48 83 c4 10          	add    $0x10,%rsp
+  802f18:	5b                   	pop    %rbx
+  802f19:	41 5f                	pop    %r15
+  802f1b:	5d                   	pop    %rbp
+  802f1c:	c3                   	ret
+
+0000000000802f1d <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802f1d:	55                   	push   %rbp
+  802f1e:	48 89 e5             	mov    %rsp,%rbp
+  802f21:	53                   	push   %rbx
+  802f22:	48 83 ec 28          	sub    $0x28,%rsp
+  802f26:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f26 <fork_map+0x9>
+  802f2d:	49 bb 1a 61 00 00 00 	movabs $0x611a,%r11
+  802f34:	00 00 00 
+  802f37:	4c 01 db             	add    %r11,%rbx
+  802f3a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f3d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802f41:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802f44:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f4b:	00 00 00 
+  802f4e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f52:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802f58:	75 10                	jne    802f6a <fork_map+0x4d>
+		fork_flush();
+  802f5a:	48 b8 0a 9e ff ff ff 	movabs $0xffffffffffff9e0a,%rax
+  802f61:	ff ff ff 
+  802f64:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f68:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802f6a:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f71:	00 00 00 
+  802f74:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802f78:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802f7c:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802f83:	00 00 00 
+  802f86:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802f8a:	48 c1 e0 05          	shl    $0x5,%rax
+  802f8e:	48 89 c2             	mov    %rax,%rdx
+  802f91:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802f98:	00 00 00 
+  802f9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f9f:	48 01 d0             	add    %rdx,%rax
+  802fa2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  802fa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802faa:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  802fb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fb4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802fb8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  802fbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fc0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802fc3:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  802fc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fca:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802fce:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  802fd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fd6:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  802fd9:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  802fdc:	90                   	nop
+  802fdd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fe1:	c9                   	leave
+  802fe2:	c3                   	ret
+
+0000000000802fe3 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  802fe3:	55                   	push   %rbp
+  802fe4:	48 89 e5             	mov    %rsp,%rbp
+  802fe7:	53                   	push   %rbx
+  802fe8:	48 83 ec 28          	sub    $0x28,%rsp
+  802fec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802fec <duppage+0x9>
+  802ff3:	49 bb 54 60 00 00 00 	movabs $0x6054,%r11
+  802ffa:	00 00 00 
+  802ffd:	4c 01 db             	add    %r11,%rbx
+  803000:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803003:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  803006:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803009:	48 c1 e0 0c          	shl    $0xc,%rax
+  80300d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  803011:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803018:	ff ff ff 
+  80301b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80301f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803022:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803026:	25 00 04 00 00       	and    $0x400,%eax
+  80302b:	48 85 c0             	test   %rax,%rax
+  80302e:	74 42                	je     803072 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  803030:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803037:	ff ff ff 
+  80303a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80303e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803041:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803045:	25 07 0e 00 00       	and    $0xe07,%eax
+  80304a:	89 c2                	mov    %eax,%edx
+  80304c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803050:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803053:	48 89 ce             	mov    %rcx,%rsi
+  803056:	89 c7                	mov    %eax,%edi
+  803058:	48 b8 dd 9e ff ff ff 	movabs $0xffffffffffff9edd,%rax
+  80305f:	ff ff ff 
+  803062:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803066:	ff d0                	call   *%rax
+		return 0;
+  803068:	b8 00 00 00 00       	mov    $0x0,%eax
+  80306d:	e9 ae 00 00 00       	jmp    803120 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  803072:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803079:	ff ff ff 
+  80307c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803080:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803083:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803087:	83 e0 02             	and    $0x2,%eax
+  80308a:	48 85 c0             	test   %rax,%rax
+  80308d:	75 1f                	jne    8030ae <duppage+0xcb>
+  80308f:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803096:	ff ff ff 
+  803099:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80309d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030a0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030a4:	25 00 08 00 00       	and    $0x800,%eax
+  8030a9:	48 85 c0             	test   %rax,%rax
+  8030ac:	74 4c                	je     8030fa <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  8030ae:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  8030b5:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8030b8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8030bc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030bf:	48 89 ce             	mov    %rcx,%rsi
+  8030c2:	89 c7                	mov    %eax,%edi
+  8030c4:	48 b8 dd 9e ff ff ff 	movabs $0xffffffffffff9edd,%rax
+  8030cb:	ff ff ff 
+  8030ce:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030d2:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  8030d4:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8030d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030db:	48 89 c6             	mov    %rax,%rsi
+  8030de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030e3:	48 b8 dd 9e ff ff ff 	movabs $0xffffffffffff9edd,%rax
+  8030ea:	ff ff ff 
+  8030ed:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030f1:	ff d0                	call   *%rax
+		return 0;
+  8030f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f8:	eb 26                	jmp    803120 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  8030fa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8030fe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803101:	ba 05 00 00 00       	mov    $0x5,%edx
+  803106:	48 89 ce             	mov    %rcx,%rsi
+  803109:	89 c7                	mov    %eax,%edi
+  80310b:	48 b8 dd 9e ff ff ff 	movabs $0xffffffffffff9edd,%rax
+  803112:	ff ff ff 
+  803115:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803119:	ff d0                	call   *%rax
+		return 0;
+  80311b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803120:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803124:	c9                   	leave
+  803125:	c3                   	ret
+
+0000000000803126 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  803126:	55                   	push   %rbp
+  803127:	48 89 e5             	mov    %rsp,%rbp
+  80312a:	53                   	push   %rbx
+  80312b:	48 83 ec 28          	sub    $0x28,%rsp
+  80312f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80312f <duphuge+0x9>
+  803136:	49 bb 11 5f 00 00 00 	movabs $0x5f11,%r11
+  80313d:	00 00 00 
+  803140:	4c 01 db             	add    %r11,%rbx
+  803143:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803146:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  80314a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80314e:	48 c1 e8 15          	shr    $0x15,%rax
+  803152:	48 89 c2             	mov    %rax,%rdx
+  803155:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  80315c:	ff ff ff 
+  80315f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803163:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803167:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  80316b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80316f:	25 00 04 00 00       	and    $0x400,%eax
+  803174:	48 85 c0             	test   %rax,%rax
+  803177:	74 0e                	je     803187 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  803179:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80317d:	25 07 0e 00 00       	and    $0xe07,%eax
+  803182:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803185:	eb 1e                	jmp    8031a5 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  803187:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80318b:	25 02 08 00 00       	and    $0x802,%eax
+  803190:	48 85 c0             	test   %rax,%rax
+  803193:	74 09                	je     80319e <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  803195:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  80319c:	eb 07                	jmp    8031a5 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  80319e:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  8031a5:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8031a8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8031ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031af:	48 89 ce             	mov    %rcx,%rsi
+  8031b2:	89 c7                	mov    %eax,%edi
+  8031b4:	48 b8 dd 9e ff ff ff 	movabs $0xffffffffffff9edd,%rax
+  8031bb:	ff ff ff 
+  8031be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031c2:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  8031c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031c7:	25 00 08 00 00       	and    $0x800,%eax
+  8031cc:	85 c0                	test   %eax,%eax
+  8031ce:	74 1f                	je     8031ef <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  8031d0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8031d3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031d7:	48 89 c6             	mov    %rax,%rsi
+  8031da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031df:	48 b8 dd 9e ff ff ff 	movabs $0xffffffffffff9edd,%rax
+  8031e6:	ff ff ff 
+  8031e9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8031ed:	ff d0                	call   *%rax
+	return 0;
+  8031ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031f8:	c9                   	leave
+  8031f9:	c3                   	ret
+
+00000000008031fa <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8031fa:	55                   	push   %rbp
+  8031fb:	48 89 e5             	mov    %rsp,%rbp
+  8031fe:	41 57                	push   %r15
+  803200:	53                   	push   %rbx
+  803201:	48 83 ec 10          	sub    $0x10,%rsp
+  803205:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803205 <fork+0xb>
+  80320c:	49 bb 3b 5e 00 00 00 	movabs $0x5e3b,%r11
+  803213:	00 00 00 
+  803216:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  803219:	49 89 df             	mov    %rbx,%r15
+  80321c:	48 b8 80 99 ff ff ff 	movabs $0xffffffffffff9980,%rax
+  803223:	ff ff ff 
+  803226:	48 01 d8             	add    %rbx,%rax
+  803229:	ff d0                	call   *%rax
+  80322b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80322e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803232:	75 42                	jne    803276 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803234:	49 89 df             	mov    %rbx,%r15
+  803237:	48 b8 82 91 ff ff ff 	movabs $0xffffffffffff9182,%rax
+  80323e:	ff ff ff 
+  803241:	48 01 d8             	add    %rbx,%rax
+  803244:	ff d0                	call   *%rax
+  803246:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80324b:	48 98                	cltq
+  80324d:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803254:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  80325b:	ff ff ff 
+  80325e:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803262:	48 01 c2             	add    %rax,%rdx
+  803265:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80326c:	ff ff ff 
+  80326f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803273:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  803276:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  803279:	48 83 c4 10          	add    $0x10,%rsp
+  80327d:	5b                   	pop    %rbx
+  80327e:	41 5f                	pop    %r15
+  803280:	5d                   	pop    %rbp
+  803281:	c3                   	ret
+
+0000000000803282 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  803282:	55                   	push   %rbp
+  803283:	48 89 e5             	mov    %rsp,%rbp
+  803286:	41 57                	push   %r15
+  803288:	53                   	push   %rbx
+  803289:	48 83 ec 10          	sub    $0x10,%rsp
+  80328d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80328d <ufork+0xb>
+  803294:	49 bb b3 5d 00 00 00 	movabs $0x5db3,%r11
+  80329b:	00 00 00 
+  80329e:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  8032a1:	48 b8 d4 99 ff ff ff 	movabs $0xffffffffffff99d4,%rax
+  8032a8:	ff ff ff 
+  8032ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8032af:	48 89 c7             	mov    %rax,%rdi
+  8032b2:	49 89 df             	mov    %rbx,%r15
+  8032b5:	48 b8 35 dc ff ff ff 	movabs $0xffffffffffffdc35,%rax
+  8032bc:	ff ff ff 
+  8032bf:	48 01 d8             	add    %rbx,%rax
+  8032c2:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8032c4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8032c9:	cd 30                	int    $0x30
+  8032cb:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  8032ce:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  8032d1:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  8032d4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8032d8:	0f 84 03 02 00 00    	je     8034e1 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  8032de:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8032e5:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  8032e6:	e9 28 01 00 00       	jmp    803413 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  8032eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032ef:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8032f3:	48 89 c2             	mov    %rax,%rdx
+  8032f6:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  8032fd:	ff ff ff 
+  803300:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803304:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803308:	83 e0 01             	and    $0x1,%eax
+  80330b:	48 85 c0             	test   %rax,%rax
+  80330e:	0f 84 f7 00 00 00    	je     80340b <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803314:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803318:	48 c1 e8 15          	shr    $0x15,%rax
+  80331c:	48 89 c2             	mov    %rax,%rdx
+  80331f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803326:	ff ff ff 
+  803329:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80332d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803331:	25 81 00 00 00       	and    $0x81,%eax
+  803336:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  80333c:	75 29                	jne    803367 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  80333e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803342:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803345:	48 89 d6             	mov    %rdx,%rsi
+  803348:	89 c7                	mov    %eax,%edi
+  80334a:	48 b8 e6 a0 ff ff ff 	movabs $0xffffffffffffa0e6,%rax
+  803351:	ff ff ff 
+  803354:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803358:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  80335a:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803361:	00 
+  803362:	e9 ac 00 00 00       	jmp    803413 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  803367:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80336b:	48 c1 e8 15          	shr    $0x15,%rax
+  80336f:	48 89 c2             	mov    %rax,%rdx
+  803372:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803379:	ff ff ff 
+  80337c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803380:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803384:	83 e0 01             	and    $0x1,%eax
+  803387:	48 85 c0             	test   %rax,%rax
+  80338a:	74 75                	je     803401 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  80338c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803390:	48 c1 e8 0c          	shr    $0xc,%rax
+  803394:	48 89 c2             	mov    %rax,%rdx
+  803397:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80339e:	ff ff ff 
+  8033a1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033a5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033a9:	83 e0 01             	and    $0x1,%eax
+  8033ac:	48 85 c0             	test   %rax,%rax
+  8033af:	74 46                	je     8033f7 <ufork+0x175>
+  8033b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033b5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033b9:	48 89 c2             	mov    %rax,%rdx
+  8033bc:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8033c3:	ff ff ff 
+  8033c6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033ca:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033ce:	83 e0 04             	and    $0x4,%eax
+  8033d1:	48 85 c0             	test   %rax,%rax
+  8033d4:	74 21                	je     8033f7 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  8033d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033da:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033de:	89 c2                	mov    %eax,%edx
+  8033e0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033e3:	89 d6                	mov    %edx,%esi
+  8033e5:	89 c7                	mov    %eax,%edi
+  8033e7:	48 b8 a3 9f ff ff ff 	movabs $0xffffffffffff9fa3,%rax
+  8033ee:	ff ff ff 
+  8033f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033f5:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  8033f7:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  8033fe:	00 
+  8033ff:	eb 12                	jmp    803413 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803401:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803408:	00 
+  803409:	eb 08                	jmp    803413 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  80340b:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803412:	40 
+		for (; addr < USTACKTOP;){
+  803413:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803418:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80341c:	0f 83 c9 fe ff ff    	jae    8032eb <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803422:	48 b8 0a 9e ff ff ff 	movabs $0xffffffffffff9e0a,%rax
+  803429:	ff ff ff 
+  80342c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803430:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803432:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803435:	ba 07 00 00 00       	mov    $0x7,%edx
+  80343a:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80343f:	48 89 ce             	mov    %rcx,%rsi
+  803442:	89 c7                	mov    %eax,%edi
+  803444:	49 89 df             	mov    %rbx,%r15
+  803447:	48 b8 2b 92 ff ff ff 	movabs $0xffffffffffff922b,%rax
+  80344e:	ff ff ff 
+  803451:	48 01 d8             	add    %rbx,%rax
+  803454:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  803456:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803459:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  803460:	ff ff ff 
+  803463:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  803467:	48 89 d6             	mov    %rdx,%rsi
+  80346a:	89 c7                	mov    %eax,%edi
+  80346c:	49 89 df             	mov    %rbx,%r15
+  80346f:	48 b8 21 94 ff ff ff 	movabs $0xffffffffffff9421,%rax
+  803476:	ff ff ff 
+  803479:	48 01 d8             	add    %rbx,%rax
+  80347c:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  80347e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803481:	be 02 00 00 00       	mov    $0x2,%esi
+  803486:	89 c7                	mov    %eax,%edi
+  803488:	49 89 df             	mov    %rbx,%r15
+  80348b:	48 b8 62 93 ff ff ff 	movabs $0xffffffffffff9362,%rax
+  803492:	ff ff ff 
+  803495:	48 01 d8             	add    %rbx,%rax
+  803498:	ff d0                	call   *%rax
+  80349a:	85 c0                	test   %eax,%eax
+  80349c:	74 3e                	je     8034dc <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  80349e:	48 b8 67 e4 ff ff ff 	movabs $0xffffffffffffe467,%rax
+  8034a5:	ff ff ff 
+  8034a8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034ac:	48 89 c2             	mov    %rax,%rdx
+  8034af:	be 07 01 00 00       	mov    $0x107,%esi
+  8034b4:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  8034bb:	ff ff ff 
+  8034be:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8034c2:	48 89 c7             	mov    %rax,%rdi
+  8034c5:	49 89 df             	mov    %rbx,%r15
+  8034c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034cd:	48 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%rcx
+  8034d4:	ff ff ff 
+  8034d7:	48 01 d9             	add    %rbx,%rcx
+  8034da:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  8034dc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8034df:	eb 59                	jmp    80353a <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8034e1:	49 89 df             	mov    %rbx,%r15
+  8034e4:	48 b8 82 91 ff ff ff 	movabs $0xffffffffffff9182,%rax
+  8034eb:	ff ff ff 
+  8034ee:	48 01 d8             	add    %rbx,%rax
+  8034f1:	ff d0                	call   *%rax
+  8034f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8034f8:	48 98                	cltq
+  8034fa:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803501:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803508:	ff ff ff 
+  80350b:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80350f:	48 01 c2             	add    %rax,%rdx
+  803512:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803519:	ff ff ff 
+  80351c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803520:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803523:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80352a:	00 00 00 
+  80352d:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803534:	00 
+		return 0;
+  803535:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  80353a:	48 83 c4 10          	add    $0x10,%rsp
+  80353e:	5b                   	pop    %rbx
+  80353f:	41 5f                	pop    %r15
+  803541:	5d                   	pop    %rbp
+  803542:	c3                   	ret
+
+0000000000803543 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803543:	55                   	push   %rbp
+  803544:	48 89 e5             	mov    %rsp,%rbp
+  803547:	41 57                	push   %r15
+  803549:	48 83 ec 08          	sub    $0x8,%rsp
+  80354d:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80354d <sfork+0xa>
+  803554:	49 bb f3 5a 00 00 00 	movabs $0x5af3,%r11
+  80355b:	00 00 00 
+  80355e:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  803561:	48 b8 82 e4 ff ff ff 	movabs $0xffffffffffffe482,%rax
+  803568:	ff ff ff 
+  80356b:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80356f:	48 89 c2             	mov    %rax,%rdx
+  803572:	be 1a 01 00 00       	mov    $0x11a,%esi
+  803577:	48 b8 b8 e3 ff ff ff 	movabs $0xffffffffffffe3b8,%rax
+  80357e:	ff ff ff 
+  803581:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  803585:	48 89 c7             	mov    %rax,%rdi
+  803588:	49 89 cf             	mov    %rcx,%r15
+  80358b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803590:	49 b8 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r8
+  803597:	ff ff ff 
+  80359a:	49 01 c8             	add    %rcx,%r8
+  80359d:	41 ff d0             	call   *%r8
+
+00000000008035a0 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8035a0:	55                   	push   %rbp
+  8035a1:	48 89 e5             	mov    %rsp,%rbp
+  8035a4:	41 57                	push   %r15
+  8035a6:	53                   	push   %rbx
+  8035a7:	48 83 ec 30          	sub    $0x30,%rsp
+  8035ab:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8035ab <ipc_recv+0xb>
+  8035b2:	49 bb 95 5a 00 00 00 	movabs $0x5a95,%r11
+  8035b9:	00 00 00 
+  8035bc:	4c 01 db             	add    %r11,%rbx
+  8035bf:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8035c3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8035c7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  8035cb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8035d0:	75 0e                	jne    8035e0 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  8035d2:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8035d9:	00 00 00 
+  8035dc:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  8035e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035e4:	48 89 c7             	mov    %rax,%rdi
+  8035e7:	49 89 df             	mov    %rbx,%r15
+  8035ea:	48 b8 54 95 ff ff ff 	movabs $0xffffffffffff9554,%rax
+  8035f1:	ff ff ff 
+  8035f4:	48 01 d8             	add    %rbx,%rax
+  8035f7:	ff d0                	call   *%rax
+  8035f9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  8035fc:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803601:	74 2a                	je     80362d <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  803603:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803607:	75 19                	jne    803622 <ipc_recv+0x82>
+  803609:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803610:	ff ff ff 
+  803613:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803617:	48 8b 00             	mov    (%rax),%rax
+  80361a:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803620:	eb 05                	jmp    803627 <ipc_recv+0x87>
+  803622:	b8 00 00 00 00       	mov    $0x0,%eax
+  803627:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80362b:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80362d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803632:	74 2a                	je     80365e <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  803634:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803638:	75 19                	jne    803653 <ipc_recv+0xb3>
+  80363a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803641:	ff ff ff 
+  803644:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803648:	48 8b 00             	mov    (%rax),%rax
+  80364b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803651:	eb 05                	jmp    803658 <ipc_recv+0xb8>
+  803653:	b8 00 00 00 00       	mov    $0x0,%eax
+  803658:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80365c:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  80365e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803662:	74 05                	je     803669 <ipc_recv+0xc9>
+		return res;
+  803664:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803667:	eb 17                	jmp    803680 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  803669:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803670:	ff ff ff 
+  803673:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803677:	48 8b 00             	mov    (%rax),%rax
+  80367a:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803680:	48 83 c4 30          	add    $0x30,%rsp
+  803684:	5b                   	pop    %rbx
+  803685:	41 5f                	pop    %r15
+  803687:	5d                   	pop    %rbp
+  803688:	c3                   	ret
+
+0000000000803689 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803689:	55                   	push   %rbp
+  80368a:	48 89 e5             	mov    %rsp,%rbp
+  80368d:	41 57                	push   %r15
+  80368f:	53                   	push   %rbx
+  803690:	48 83 ec 20          	sub    $0x20,%rsp
+  803694:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803694 <ipc_send+0xb>
+  80369b:	49 bb ac 59 00 00 00 	movabs $0x59ac,%r11
+  8036a2:	00 00 00 
+  8036a5:	4c 01 db             	add    %r11,%rbx
+  8036a8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8036ab:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8036ae:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8036b2:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  8036b5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8036ba:	75 0e                	jne    8036ca <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  8036bc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8036c3:	00 00 00 
+  8036c6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  8036ca:	90                   	nop
+  8036cb:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8036ce:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8036d1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036d5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036d8:	89 c7                	mov    %eax,%edi
+  8036da:	49 89 df             	mov    %rbx,%r15
+  8036dd:	48 b8 ea 94 ff ff ff 	movabs $0xffffffffffff94ea,%rax
+  8036e4:	ff ff ff 
+  8036e7:	48 01 d8             	add    %rbx,%rax
+  8036ea:	ff d0                	call   *%rax
+  8036ec:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  8036ef:	74 da                	je     8036cb <ipc_send+0x42>
+		;
+}
+  8036f1:	90                   	nop
+  8036f2:	90                   	nop
+  8036f3:	48 83 c4 20          	add    $0x20,%rsp
+  8036f7:	5b                   	pop    %rbx
+  8036f8:	41 5f                	pop    %r15
+  8036fa:	5d                   	pop    %rbp
+  8036fb:	c3                   	ret
+
+00000000008036fc <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  8036fc:	55                   	push   %rbp
+  8036fd:	48 89 e5             	mov    %rsp,%rbp
+  803700:	41 57                	push   %r15
+  803702:	53                   	push   %rbx
+  803703:	48 83 ec 40          	sub    $0x40,%rsp
+  803707:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803707 <ipc_call+0xb>
+  80370e:	49 bb 39 59 00 00 00 	movabs $0x5939,%r11
+  803715:	00 00 00 
+  803718:	4c 01 db             	add    %r11,%rbx
+  80371b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80371e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803721:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803725:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803728:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80372c:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803730:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803735:	75 0e                	jne    803745 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  803737:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80373e:	00 00 00 
+  803741:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803745:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80374a:	75 0e                	jne    80375a <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  80374c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803753:	00 00 00 
+  803756:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  80375a:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  80375d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803761:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803764:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803768:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80376b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803771:	49 89 f8             	mov    %rdi,%r8
+  803774:	89 c7                	mov    %eax,%edi
+  803776:	49 89 df             	mov    %rbx,%r15
+  803779:	48 b8 ad 95 ff ff ff 	movabs $0xffffffffffff95ad,%rax
+  803780:	ff ff ff 
+  803783:	48 01 d8             	add    %rbx,%rax
+  803786:	ff d0                	call   *%rax
+  803788:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  80378b:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803790:	74 2a                	je     8037bc <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803792:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803796:	75 19                	jne    8037b1 <ipc_call+0xb5>
+  803798:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80379f:	ff ff ff 
+  8037a2:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037a6:	48 8b 00             	mov    (%rax),%rax
+  8037a9:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8037af:	eb 05                	jmp    8037b6 <ipc_call+0xba>
+  8037b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8037ba:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  8037bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037c0:	74 05                	je     8037c7 <ipc_call+0xcb>
+		return r;
+  8037c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037c5:	eb 17                	jmp    8037de <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  8037c7:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8037ce:	ff ff ff 
+  8037d1:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8037d5:	48 8b 00             	mov    (%rax),%rax
+  8037d8:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8037de:	48 83 c4 40          	add    $0x40,%rsp
+  8037e2:	5b                   	pop    %rbx
+  8037e3:	41 5f                	pop    %r15
+  8037e5:	5d                   	pop    %rbp
+  8037e6:	c3                   	ret
+
+00000000008037e7 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  8037e7:	55                   	push   %rbp
+  8037e8:	48 89 e5             	mov    %rsp,%rbp
+  8037eb:	41 57                	push   %r15
+  8037ed:	53                   	push   %rbx
+  8037ee:	48 83 ec 70          	sub    $0x70,%rsp
+  8037f2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8037f2 <ipc_callw+0xb>
+  8037f9:	49 bb 4e 58 00 00 00 	movabs $0x584e,%r11
+  803800:	00 00 00 
+  803803:	4c 01 db             	add    %r11,%rbx
+  803806:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  803809:	89 75 98             	mov    %esi,-0x68(%rbp)
+  80380c:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  803810:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  803814:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  803819:	76 0a                	jbe    803825 <ipc_callw+0x3e>
+		return -E_INVAL;
+  80381b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803820:	e9 b7 00 00 00       	jmp    8038dc <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  803825:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803829:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80382d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803831:	48 89 ce             	mov    %rcx,%rsi
+  803834:	48 89 c7             	mov    %rax,%rdi
+  803837:	49 89 df             	mov    %rbx,%r15
+  80383a:	48 b8 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rax
+  803841:	ff ff ff 
+  803844:	48 01 d8             	add    %rbx,%rax
+  803847:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  803849:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  803850:	00 
+  803851:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803855:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803859:	48 01 d0             	add    %rdx,%rax
+  80385c:	48 83 e8 01          	sub    $0x1,%rax
+  803860:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  803864:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803868:	ba 00 00 00 00       	mov    $0x0,%edx
+  80386d:	48 f7 75 e8          	divq   -0x18(%rbp)
+  803871:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803875:	48 29 d0             	sub    %rdx,%rax
+  803878:	48 c1 e8 03          	shr    $0x3,%rax
+  80387c:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  803880:	89 c1                	mov    %eax,%ecx
+  803882:	8b 75 98             	mov    -0x68(%rbp),%esi
+  803885:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  803889:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80388c:	49 89 d1             	mov    %rdx,%r9
+  80388f:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  803896:	00 00 00 
+  803899:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  8038a0:	00 00 00 
+  8038a3:	89 c7                	mov    %eax,%edi
+  8038a5:	49 89 df             	mov    %rbx,%r15
+  8038a8:	48 b8 ad 95 ff ff ff 	movabs $0xffffffffffff95ad,%rax
+  8038af:	ff ff ff 
+  8038b2:	48 01 d8             	add    %rbx,%rax
+  8038b5:	ff d0                	call   *%rax
+  8038b7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  8038ba:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8038be:	74 05                	je     8038c5 <ipc_callw+0xde>
+		return r;
+  8038c0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038c3:	eb 17                	jmp    8038dc <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  8038c5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8038cc:	ff ff ff 
+  8038cf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8038d3:	48 8b 00             	mov    (%rax),%rax
+  8038d6:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8038dc:	48 83 c4 70          	add    $0x70,%rsp
+  8038e0:	5b                   	pop    %rbx
+  8038e1:	41 5f                	pop    %r15
+  8038e3:	5d                   	pop    %rbp
+  8038e4:	c3                   	ret
+
+00000000008038e5 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  8038e5:	55                   	push   %rbp
+  8038e6:	48 89 e5             	mov    %rsp,%rbp
+  8038e9:	41 57                	push   %r15
+  8038eb:	53                   	push   %rbx
+  8038ec:	48 83 ec 40          	sub    $0x40,%rsp
+  8038f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8038f0 <ipc_callv+0xb>
+  8038f7:	49 bb 50 57 00 00 00 	movabs $0x5750,%r11
+  8038fe:	00 00 00 
+  803901:	4c 01 db             	add    %r11,%rbx
+  803904:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803907:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  80390a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80390e:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803911:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  803915:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  803919:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803920:	00 00 00 
+  803923:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  803927:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80392b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80392f:	74 11                	je     803942 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  803931:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803935:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  803939:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80393c:	c1 e0 14             	shl    $0x14,%eax
+  80393f:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  803942:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  803946:	74 14                	je     80395c <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  803948:	8b 45 20             	mov    0x20(%rbp),%eax
+  80394b:	83 e8 01             	sub    $0x1,%eax
+  80394e:	48 63 d0             	movslq %eax,%rdx
+  803951:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  803955:	48 09 d0             	or     %rdx,%rax
+  803958:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  80395c:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  80395f:	c1 e0 10             	shl    $0x10,%eax
+  803962:	0b 45 10             	or     0x10(%rbp),%eax
+  803965:	89 c1                	mov    %eax,%ecx
+  803967:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  80396a:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80396e:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  803972:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803976:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803979:	4d 89 c1             	mov    %r8,%r9
+  80397c:	49 89 f8             	mov    %rdi,%r8
+  80397f:	89 c7                	mov    %eax,%edi
+  803981:	49 89 df             	mov    %rbx,%r15
+  803984:	48 b8 ad 95 ff ff ff 	movabs $0xffffffffffff95ad,%rax
+  80398b:	ff ff ff 
+  80398e:	48 01 d8             	add    %rbx,%rax
+  803991:	ff d0                	call   *%rax
+  803993:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  803996:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80399a:	74 05                	je     8039a1 <ipc_callv+0xbc>
+		return r;
+  80399c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80399f:	eb 17                	jmp    8039b8 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  8039a1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8039a8:	ff ff ff 
+  8039ab:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8039af:	48 8b 00             	mov    (%rax),%rax
+  8039b2:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8039b8:	48 83 c4 40          	add    $0x40,%rsp
+  8039bc:	5b                   	pop    %rbx
+  8039bd:	41 5f                	pop    %r15
+  8039bf:	5d                   	pop    %rbp
+  8039c0:	c3                   	ret
+
+00000000008039c1 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  8039c1:	55                   	push   %rbp
+  8039c2:	48 89 e5             	mov    %rsp,%rbp
+  8039c5:	41 57                	push   %r15
+  8039c7:	53                   	push   %rbx
+  8039c8:	48 83 ec 40          	sub    $0x40,%rsp
+  8039cc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8039cc <ipc_reply_recv+0xb>
+  8039d3:	49 bb 74 56 00 00 00 	movabs $0x5674,%r11
+  8039da:	00 00 00 
+  8039dd:	4c 01 db             	add    %r11,%rbx
+  8039e0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039e3:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8039e6:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8039ea:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  8039ed:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8039f1:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  8039f5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8039fa:	75 0e                	jne    803a0a <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  8039fc:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803a03:	00 00 00 
+  803a06:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803a0a:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803a0f:	75 0e                	jne    803a1f <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803a11:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803a18:	00 00 00 
+  803a1b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803a1f:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803a22:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  803a26:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a2a:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803a2d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a34:	4d 89 c1             	mov    %r8,%r9
+  803a37:	49 89 f8             	mov    %rdi,%r8
+  803a3a:	89 c7                	mov    %eax,%edi
+  803a3c:	49 89 df             	mov    %rbx,%r15
+  803a3f:	48 b8 21 96 ff ff ff 	movabs $0xffffffffffff9621,%rax
+  803a46:	ff ff ff 
+  803a49:	48 01 d8             	add    %rbx,%rax
+  803a4c:	ff d0                	call   *%rax
+  803a4e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  803a51:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803a56:	74 2a                	je     803a82 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803a58:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a5c:	75 19                	jne    803a77 <ipc_reply_recv+0xb6>
+  803a5e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803a65:	ff ff ff 
+  803a68:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a6c:	48 8b 00             	mov    (%rax),%rax
+  803a6f:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803a75:	eb 05                	jmp    803a7c <ipc_reply_recv+0xbb>
+  803a77:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a80:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  803a82:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  803a87:	74 2a                	je     803ab3 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803a89:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803a8d:	75 19                	jne    803aa8 <ipc_reply_recv+0xe7>
+  803a8f:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803a96:	ff ff ff 
+  803a99:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a9d:	48 8b 00             	mov    (%rax),%rax
+  803aa0:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803aa6:	eb 05                	jmp    803aad <ipc_reply_recv+0xec>
+  803aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aad:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  803ab1:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803ab3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ab7:	74 05                	je     803abe <ipc_reply_recv+0xfd>
+		return r;
+  803ab9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803abc:	eb 17                	jmp    803ad5 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  803abe:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803ac5:	ff ff ff 
+  803ac8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803acc:	48 8b 00             	mov    (%rax),%rax
+  803acf:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803ad5:	48 83 c4 40          	add    $0x40,%rsp
+  803ad9:	5b                   	pop    %rbx
+  803ada:	41 5f                	pop    %r15
+  803adc:	5d                   	pop    %rbp
+  803add:	c3                   	ret
+
+0000000000803ade <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  803ade:	55                   	push   %rbp
+  803adf:	48 89 e5             	mov    %rsp,%rbp
+  803ae2:	41 57                	push   %r15
+  803ae4:	53                   	push   %rbx
+  803ae5:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  803aec:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803aec <ipc_window_batch+0xe>
+  803af3:	49 bb 54 55 00 00 00 	movabs $0x5554,%r11
+  803afa:	00 00 00 
+  803afd:	4c 01 db             	add    %r11,%rbx
+  803b00:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  803b06:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  803b0d:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803b13:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  803b19:	e9 15 01 00 00       	jmp    803c33 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803b1e:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803b24:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803b27:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803b2e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803b31:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b34:	39 c2                	cmp    %eax,%edx
+  803b36:	0f 4e c2             	cmovle %edx,%eax
+  803b39:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  803b3c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803b43:	eb 6b                	jmp    803bb0 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803b45:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b48:	48 98                	cltq
+  803b4a:	48 c1 e0 05          	shl    $0x5,%rax
+  803b4e:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803b52:	48 01 e8             	add    %rbp,%rax
+  803b55:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  803b5b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803b61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b64:	c1 e0 0c             	shl    $0xc,%eax
+  803b67:	48 63 d0             	movslq %eax,%rdx
+  803b6a:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803b71:	48 01 c2             	add    %rax,%rdx
+  803b74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b77:	48 98                	cltq
+  803b79:	48 c1 e0 05          	shl    $0x5,%rax
+  803b7d:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803b81:	48 01 e8             	add    %rbp,%rax
+  803b84:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  803b8a:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  803b8d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b90:	48 98                	cltq
+  803b92:	48 c1 e0 05          	shl    $0x5,%rax
+  803b96:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803b9a:	48 01 e8             	add    %rbp,%rax
+  803b9d:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  803ba4:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  803baa:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  803bac:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803bb0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bb3:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  803bb6:	7c 8d                	jl     803b45 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  803bb8:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  803bbf:	74 27                	je     803be8 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803bc1:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803bc4:	48 63 d0             	movslq %eax,%rdx
+  803bc7:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803bce:	48 89 d6             	mov    %rdx,%rsi
+  803bd1:	48 89 c7             	mov    %rax,%rdi
+  803bd4:	49 89 df             	mov    %rbx,%r15
+  803bd7:	48 b8 c4 98 ff ff ff 	movabs $0xffffffffffff98c4,%rax
+  803bde:	ff ff ff 
+  803be1:	48 01 d8             	add    %rbx,%rax
+  803be4:	ff d0                	call   *%rax
+  803be6:	eb 25                	jmp    803c0d <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  803be8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803beb:	48 63 d0             	movslq %eax,%rdx
+  803bee:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803bf5:	48 89 d6             	mov    %rdx,%rsi
+  803bf8:	48 89 c7             	mov    %rax,%rdi
+  803bfb:	49 89 df             	mov    %rbx,%r15
+  803bfe:	48 b8 22 99 ff ff ff 	movabs $0xffffffffffff9922,%rax
+  803c05:	ff ff ff 
+  803c08:	48 01 d8             	add    %rbx,%rax
+  803c0b:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803c0d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803c10:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803c14:	79 05                	jns    803c1b <ipc_window_batch+0x13d>
+			return r;
+  803c16:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c19:	eb 2a                	jmp    803c45 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  803c1b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803c1e:	c1 e0 0c             	shl    $0xc,%eax
+  803c21:	48 98                	cltq
+  803c23:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  803c2a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803c2d:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803c33:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  803c3a:	0f 8f de fe ff ff    	jg     803b1e <ipc_window_batch+0x40>
+	}
+	return 0;
+  803c40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c45:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  803c4c:	5b                   	pop    %rbx
+  803c4d:	41 5f                	pop    %r15
+  803c4f:	5d                   	pop    %rbp
+  803c50:	c3                   	ret
+
+0000000000803c51 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803c51:	55                   	push   %rbp
+  803c52:	48 89 e5             	mov    %rsp,%rbp
+  803c55:	48 83 ec 10          	sub    $0x10,%rsp
+  803c59:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c59 <ipc_map_window+0x8>
+  803c60:	49 bb e7 53 00 00 00 	movabs $0x53e7,%r11
+  803c67:	00 00 00 
+  803c6a:	4c 01 d8             	add    %r11,%rax
+  803c6d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803c71:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803c74:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803c77:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803c7b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803c80:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c85:	49 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%r8
+  803c8c:	ff ff ff 
+  803c8f:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803c93:	ff d0                	call   *%rax
+}
+  803c95:	c9                   	leave
+  803c96:	c3                   	ret
+
+0000000000803c97 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803c97:	55                   	push   %rbp
+  803c98:	48 89 e5             	mov    %rsp,%rbp
+  803c9b:	48 83 ec 10          	sub    $0x10,%rsp
+  803c9f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803c9f <ipc_unmap_window+0x8>
+  803ca6:	49 bb a1 53 00 00 00 	movabs $0x53a1,%r11
+  803cad:	00 00 00 
+  803cb0:	4c 01 d8             	add    %r11,%rax
+  803cb3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803cb7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  803cba:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803cbd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803cc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803cc6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ccb:	49 b8 9e aa ff ff ff 	movabs $0xffffffffffffaa9e,%r8
+  803cd2:	ff ff ff 
+  803cd5:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803cd9:	ff d0                	call   *%rax
+}
+  803cdb:	c9                   	leave
+  803cdc:	c3                   	ret
+
+0000000000803cdd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803cdd:	55                   	push   %rbp
+  803cde:	48 89 e5             	mov    %rsp,%rbp
+  803ce1:	48 83 ec 18          	sub    $0x18,%rsp
+  803ce5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ce5 <ipc_find_env+0x8>
+  803cec:	49 bb 5b 53 00 00 00 	movabs $0x535b,%r11
+  803cf3:	00 00 00 
+  803cf6:	4c 01 d8             	add    %r11,%rax
+  803cf9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803cfc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803d03:	eb 57                	jmp    803d5c <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803d05:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803d0c:	ff ff ff 
+  803d0f:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803d13:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803d16:	48 63 d2             	movslq %edx,%rdx
+  803d19:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803d20:	48 01 ca             	add    %rcx,%rdx
+  803d23:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803d2a:	8b 12                	mov    (%rdx),%edx
+  803d2c:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803d2f:	75 27                	jne    803d58 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803d31:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803d38:	ff ff ff 
+  803d3b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803d3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d42:	48 98                	cltq
+  803d44:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803d4b:	48 01 d0             	add    %rdx,%rax
+  803d4e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803d54:	8b 00                	mov    (%rax),%eax
+  803d56:	eb 12                	jmp    803d6a <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803d58:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803d5c:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803d63:	7e a0                	jle    803d05 <ipc_find_env+0x28>
+	}
+	return 0;
+  803d65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d6a:	c9                   	leave
+  803d6b:	c3                   	ret
+
+0000000000803d6c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803d6c:	55                   	push   %rbp
+  803d6d:	48 89 e5             	mov    %rsp,%rbp
+  803d70:	48 83 ec 08          	sub    $0x8,%rsp
+  803d74:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d74 <fd2num+0x8>
+  803d7b:	49 bb cc 52 00 00 00 	movabs $0x52cc,%r11
+  803d82:	00 00 00 
+  803d85:	4c 01 d8             	add    %r11,%rax
+  803d88:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803d8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d90:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803d97:	ff ff ff 
+  803d9a:	48 01 d0             	add    %rdx,%rax
+  803d9d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803da1:	c9                   	leave
+  803da2:	c3                   	ret
+
+0000000000803da3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803da3:	55                   	push   %rbp
+  803da4:	48 89 e5             	mov    %rsp,%rbp
+  803da7:	48 83 ec 08          	sub    $0x8,%rsp
+  803dab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803dab <fd2data+0x8>
+  803db2:	49 bb 95 52 00 00 00 	movabs $0x5295,%r11
+  803db9:	00 00 00 
+  803dbc:	4c 01 d8             	add    %r11,%rax
+  803dbf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803dc3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803dc7:	48 89 d7             	mov    %rdx,%rdi
+  803dca:	48 ba 2c ad ff ff ff 	movabs $0xffffffffffffad2c,%rdx
+  803dd1:	ff ff ff 
+  803dd4:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803dd8:	ff d0                	call   *%rax
+  803dda:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803de0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803de4:	c9                   	leave
+  803de5:	c3                   	ret
+
+0000000000803de6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803de6:	55                   	push   %rbp
+  803de7:	48 89 e5             	mov    %rsp,%rbp
+  803dea:	48 83 ec 18          	sub    $0x18,%rsp
+  803dee:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803dee <fd_alloc+0x8>
+  803df5:	49 bb 52 52 00 00 00 	movabs $0x5252,%r11
+  803dfc:	00 00 00 
+  803dff:	4c 01 d8             	add    %r11,%rax
+  803e02:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803e06:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803e0d:	eb 75                	jmp    803e84 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803e0f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803e12:	48 63 d2             	movslq %edx,%rdx
+  803e15:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803e1c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803e20:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803e24:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e28:	48 89 d1             	mov    %rdx,%rcx
+  803e2b:	48 c1 e9 15          	shr    $0x15,%rcx
+  803e2f:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803e36:	ff ff ff 
+  803e39:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803e3d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803e41:	83 e2 01             	and    $0x1,%edx
+  803e44:	48 85 d2             	test   %rdx,%rdx
+  803e47:	74 25                	je     803e6e <fd_alloc+0x88>
+  803e49:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e4d:	48 89 d1             	mov    %rdx,%rcx
+  803e50:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803e54:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803e5b:	ff ff ff 
+  803e5e:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803e62:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803e66:	83 e2 01             	and    $0x1,%edx
+  803e69:	48 85 d2             	test   %rdx,%rdx
+  803e6c:	75 12                	jne    803e80 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803e6e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e72:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e76:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803e79:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e7e:	eb 1a                	jmp    803e9a <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803e80:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803e84:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803e88:	7e 85                	jle    803e0f <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803e8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e8e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803e95:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803e9a:	c9                   	leave
+  803e9b:	c3                   	ret
+
+0000000000803e9c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803e9c:	55                   	push   %rbp
+  803e9d:	48 89 e5             	mov    %rsp,%rbp
+  803ea0:	48 83 ec 20          	sub    $0x20,%rsp
+  803ea4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803ea4 <fd_lookup+0x8>
+  803eab:	49 bb 9c 51 00 00 00 	movabs $0x519c,%r11
+  803eb2:	00 00 00 
+  803eb5:	4c 01 d8             	add    %r11,%rax
+  803eb8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803ebb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803ebf:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803ec3:	78 06                	js     803ecb <fd_lookup+0x2f>
+  803ec5:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803ec9:	7e 07                	jle    803ed2 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803ecb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ed0:	eb 73                	jmp    803f45 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803ed2:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803ed5:	48 63 d2             	movslq %edx,%rdx
+  803ed8:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803edf:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803ee3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803ee7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803eeb:	48 89 d1             	mov    %rdx,%rcx
+  803eee:	48 c1 e9 15          	shr    $0x15,%rcx
+  803ef2:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803ef9:	ff ff ff 
+  803efc:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803f00:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803f04:	83 e2 01             	and    $0x1,%edx
+  803f07:	48 85 d2             	test   %rdx,%rdx
+  803f0a:	74 22                	je     803f2e <fd_lookup+0x92>
+  803f0c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f10:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803f14:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803f1b:	ff ff ff 
+  803f1e:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803f22:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803f26:	83 e0 01             	and    $0x1,%eax
+  803f29:	48 85 c0             	test   %rax,%rax
+  803f2c:	75 07                	jne    803f35 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803f2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f33:	eb 10                	jmp    803f45 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803f35:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f3d:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803f40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f45:	c9                   	leave
+  803f46:	c3                   	ret
+
+0000000000803f47 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803f47:	55                   	push   %rbp
+  803f48:	48 89 e5             	mov    %rsp,%rbp
+  803f4b:	41 57                	push   %r15
+  803f4d:	53                   	push   %rbx
+  803f4e:	48 83 ec 30          	sub    $0x30,%rsp
+  803f52:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803f52 <fd_close+0xb>
+  803f59:	49 bb ee 50 00 00 00 	movabs $0x50ee,%r11
+  803f60:	00 00 00 
+  803f63:	4c 01 db             	add    %r11,%rbx
+  803f66:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803f6a:	89 f0                	mov    %esi,%eax
+  803f6c:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803f6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f73:	48 89 c7             	mov    %rax,%rdi
+  803f76:	48 b8 2c ad ff ff ff 	movabs $0xffffffffffffad2c,%rax
+  803f7d:	ff ff ff 
+  803f80:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f84:	ff d0                	call   *%rax
+  803f86:	89 c2                	mov    %eax,%edx
+  803f88:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803f8c:	48 89 c6             	mov    %rax,%rsi
+  803f8f:	89 d7                	mov    %edx,%edi
+  803f91:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  803f98:	ff ff ff 
+  803f9b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803f9f:	ff d0                	call   *%rax
+  803fa1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fa4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fa8:	78 0a                	js     803fb4 <fd_close+0x6d>
+	    || fd != fd2)
+  803faa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803fae:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  803fb2:	74 12                	je     803fc6 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  803fb4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803fb8:	74 05                	je     803fbf <fd_close+0x78>
+  803fba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803fbd:	eb 7a                	jmp    804039 <fd_close+0xf2>
+  803fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fc4:	eb 73                	jmp    804039 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803fc6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fca:	8b 00                	mov    (%rax),%eax
+  803fcc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803fd0:	48 89 d6             	mov    %rdx,%rsi
+  803fd3:	89 c7                	mov    %eax,%edi
+  803fd5:	48 b8 02 b0 ff ff ff 	movabs $0xffffffffffffb002,%rax
+  803fdc:	ff ff ff 
+  803fdf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fe3:	ff d0                	call   *%rax
+  803fe5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  803fe8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803fec:	78 2a                	js     804018 <fd_close+0xd1>
+		if (dev->dev_close)
+  803fee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ff2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803ff6:	48 85 c0             	test   %rax,%rax
+  803ff9:	74 16                	je     804011 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  803ffb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803fff:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  804003:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804007:	48 89 c7             	mov    %rax,%rdi
+  80400a:	ff d2                	call   *%rdx
+  80400c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80400f:	eb 07                	jmp    804018 <fd_close+0xd1>
+		else
+			r = 0;
+  804011:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  804018:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80401c:	48 89 c6             	mov    %rax,%rsi
+  80401f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804024:	49 89 df             	mov    %rbx,%r15
+  804027:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  80402e:	ff ff ff 
+  804031:	48 01 d8             	add    %rbx,%rax
+  804034:	ff d0                	call   *%rax
+	return r;
+  804036:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804039:	48 83 c4 30          	add    $0x30,%rsp
+  80403d:	5b                   	pop    %rbx
+  80403e:	41 5f                	pop    %r15
+  804040:	5d                   	pop    %rbp
+  804041:	c3                   	ret
+
+0000000000804042 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  804042:	55                   	push   %rbp
+  804043:	48 89 e5             	mov    %rsp,%rbp
+  804046:	41 57                	push   %r15
+  804048:	48 83 ec 28          	sub    $0x28,%rsp
+  80404c:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 80404c <dev_lookup+0xa>
+  804053:	49 bb f4 4f 00 00 00 	movabs $0x4ff4,%r11
+  80405a:	00 00 00 
+  80405d:	4c 01 d9             	add    %r11,%rcx
+  804060:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804063:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  804067:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80406e:	eb 45                	jmp    8040b5 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  804070:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  804077:	00 00 00 
+  80407a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80407d:	48 98                	cltq
+  80407f:	48 01 ca             	add    %rcx,%rdx
+  804082:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804086:	8b 00                	mov    (%rax),%eax
+  804088:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  80408b:	75 24                	jne    8040b1 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  80408d:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  804094:	00 00 00 
+  804097:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80409a:	48 98                	cltq
+  80409c:	48 01 ca             	add    %rcx,%rdx
+  80409f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040a7:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  8040aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040af:	eb 74                	jmp    804125 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  8040b1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8040b5:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  8040bc:	00 00 00 
+  8040bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040c2:	48 98                	cltq
+  8040c4:	48 01 ca             	add    %rcx,%rdx
+  8040c7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8040cb:	48 85 c0             	test   %rax,%rax
+  8040ce:	75 a0                	jne    804070 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8040d0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8040d7:	ff ff ff 
+  8040da:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  8040de:	48 8b 00             	mov    (%rax),%rax
+  8040e1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8040e7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8040ea:	89 c6                	mov    %eax,%esi
+  8040ec:	48 b8 98 e4 ff ff ff 	movabs $0xffffffffffffe498,%rax
+  8040f3:	ff ff ff 
+  8040f6:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8040fa:	48 89 c7             	mov    %rax,%rdi
+  8040fd:	49 89 cf             	mov    %rcx,%r15
+  804100:	b8 00 00 00 00       	mov    $0x0,%eax
+  804105:	49 b8 ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%r8
+  80410c:	ff ff ff 
+  80410f:	49 01 c8             	add    %rcx,%r8
+  804112:	41 ff d0             	call   *%r8
+	*dev = 0;
+  804115:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804119:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  804120:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  804125:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804129:	c9                   	leave
+  80412a:	c3                   	ret
+
+000000000080412b <close>:
+
+int
+close(int fdnum)
+{
+  80412b:	55                   	push   %rbp
+  80412c:	48 89 e5             	mov    %rsp,%rbp
+  80412f:	53                   	push   %rbx
+  804130:	48 83 ec 28          	sub    $0x28,%rsp
+  804134:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804134 <close+0x9>
+  80413b:	49 bb 0c 4f 00 00 00 	movabs $0x4f0c,%r11
+  804142:	00 00 00 
+  804145:	4c 01 db             	add    %r11,%rbx
+  804148:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80414b:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80414f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804152:	48 89 d6             	mov    %rdx,%rsi
+  804155:	89 c7                	mov    %eax,%edi
+  804157:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  80415e:	ff ff ff 
+  804161:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804165:	ff d0                	call   *%rax
+  804167:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80416a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80416e:	79 05                	jns    804175 <close+0x4a>
+		return r;
+  804170:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804173:	eb 1c                	jmp    804191 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  804175:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804179:	be 01 00 00 00       	mov    $0x1,%esi
+  80417e:	48 89 c7             	mov    %rax,%rdi
+  804181:	48 b8 07 af ff ff ff 	movabs $0xffffffffffffaf07,%rax
+  804188:	ff ff ff 
+  80418b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80418f:	ff d0                	call   *%rax
+}
+  804191:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804195:	c9                   	leave
+  804196:	c3                   	ret
+
+0000000000804197 <close_all>:
+
+void
+close_all(void)
+{
+  804197:	55                   	push   %rbp
+  804198:	48 89 e5             	mov    %rsp,%rbp
+  80419b:	53                   	push   %rbx
+  80419c:	48 83 ec 18          	sub    $0x18,%rsp
+  8041a0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041a0 <close_all+0x9>
+  8041a7:	49 bb a0 4e 00 00 00 	movabs $0x4ea0,%r11
+  8041ae:	00 00 00 
+  8041b1:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8041b4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8041bb:	eb 19                	jmp    8041d6 <close_all+0x3f>
+		close(i);
+  8041bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041c0:	89 c7                	mov    %eax,%edi
+  8041c2:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  8041c9:	ff ff ff 
+  8041cc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041d0:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  8041d2:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8041d6:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8041da:	7e e1                	jle    8041bd <close_all+0x26>
+}
+  8041dc:	90                   	nop
+  8041dd:	90                   	nop
+  8041de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041e2:	c9                   	leave
+  8041e3:	c3                   	ret
+
+00000000008041e4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8041e4:	55                   	push   %rbp
+  8041e5:	48 89 e5             	mov    %rsp,%rbp
+  8041e8:	41 57                	push   %r15
+  8041ea:	53                   	push   %rbx
+  8041eb:	48 83 ec 40          	sub    $0x40,%rsp
+  8041ef:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8041ef <dup+0xb>
+  8041f6:	49 bb 51 4e 00 00 00 	movabs $0x4e51,%r11
+  8041fd:	00 00 00 
+  804200:	4c 01 db             	add    %r11,%rbx
+  804203:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  804206:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  804209:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80420d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804210:	48 89 d6             	mov    %rdx,%rsi
+  804213:	89 c7                	mov    %eax,%edi
+  804215:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  80421c:	ff ff ff 
+  80421f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804223:	ff d0                	call   *%rax
+  804225:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804228:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80422c:	79 08                	jns    804236 <dup+0x52>
+		return r;
+  80422e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804231:	e9 a4 01 00 00       	jmp    8043da <dup+0x1f6>
+	close(newfdnum);
+  804236:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804239:	89 c7                	mov    %eax,%edi
+  80423b:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  804242:	ff ff ff 
+  804245:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804249:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  80424b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80424e:	48 98                	cltq
+  804250:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  804256:	48 c1 e0 0c          	shl    $0xc,%rax
+  80425a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  80425e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804262:	48 89 c7             	mov    %rax,%rdi
+  804265:	48 b8 63 ad ff ff ff 	movabs $0xffffffffffffad63,%rax
+  80426c:	ff ff ff 
+  80426f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804273:	ff d0                	call   *%rax
+  804275:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  804279:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80427d:	48 89 c7             	mov    %rax,%rdi
+  804280:	48 b8 63 ad ff ff ff 	movabs $0xffffffffffffad63,%rax
+  804287:	ff ff ff 
+  80428a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80428e:	ff d0                	call   *%rax
+  804290:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  804294:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804298:	48 c1 e8 15          	shr    $0x15,%rax
+  80429c:	48 89 c2             	mov    %rax,%rdx
+  80429f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8042a6:	ff ff ff 
+  8042a9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8042ad:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8042b1:	83 e0 01             	and    $0x1,%eax
+  8042b4:	48 85 c0             	test   %rax,%rax
+  8042b7:	74 7f                	je     804338 <dup+0x154>
+  8042b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042bd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8042c1:	48 89 c2             	mov    %rax,%rdx
+  8042c4:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8042cb:	ff ff ff 
+  8042ce:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8042d2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8042d6:	83 e0 01             	and    $0x1,%eax
+  8042d9:	48 85 c0             	test   %rax,%rax
+  8042dc:	74 5a                	je     804338 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8042de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042e2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8042e6:	48 89 c2             	mov    %rax,%rdx
+  8042e9:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8042f0:	ff ff ff 
+  8042f3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8042f7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8042fb:	25 07 0e 00 00       	and    $0xe07,%eax
+  804300:	89 c1                	mov    %eax,%ecx
+  804302:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804306:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80430a:	41 89 c8             	mov    %ecx,%r8d
+  80430d:	48 89 d1             	mov    %rdx,%rcx
+  804310:	ba 00 00 00 00       	mov    $0x0,%edx
+  804315:	48 89 c6             	mov    %rax,%rsi
+  804318:	bf 00 00 00 00       	mov    $0x0,%edi
+  80431d:	49 89 df             	mov    %rbx,%r15
+  804320:	48 b8 90 92 ff ff ff 	movabs $0xffffffffffff9290,%rax
+  804327:	ff ff ff 
+  80432a:	48 01 d8             	add    %rbx,%rax
+  80432d:	ff d0                	call   *%rax
+  80432f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804332:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804336:	78 5f                	js     804397 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  804338:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80433c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804340:	48 89 c2             	mov    %rax,%rdx
+  804343:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80434a:	ff ff ff 
+  80434d:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804351:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804355:	25 07 0e 00 00       	and    $0xe07,%eax
+  80435a:	89 c1                	mov    %eax,%ecx
+  80435c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804360:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804364:	41 89 c8             	mov    %ecx,%r8d
+  804367:	48 89 d1             	mov    %rdx,%rcx
+  80436a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80436f:	48 89 c6             	mov    %rax,%rsi
+  804372:	bf 00 00 00 00       	mov    $0x0,%edi
+  804377:	49 89 df             	mov    %rbx,%r15
+  80437a:	48 b8 90 92 ff ff ff 	movabs $0xffffffffffff9290,%rax
+  804381:	ff ff ff 
+  804384:	48 01 d8             	add    %rbx,%rax
+  804387:	ff d0                	call   *%rax
+  804389:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80438c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804390:	78 08                	js     80439a <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  804392:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804395:	eb 43                	jmp    8043da <dup+0x1f6>
+			goto err;
+  804397:	90                   	nop
+  804398:	eb 01                	jmp    80439b <dup+0x1b7>
+		goto err;
+  80439a:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  80439b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80439f:	48 89 c6             	mov    %rax,%rsi
+  8043a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043a7:	49 89 df             	mov    %rbx,%r15
+  8043aa:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  8043b1:	ff ff ff 
+  8043b4:	48 01 d8             	add    %rbx,%rax
+  8043b7:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  8043b9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043bd:	48 89 c6             	mov    %rax,%rsi
+  8043c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043c5:	49 89 df             	mov    %rbx,%r15
+  8043c8:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  8043cf:	ff ff ff 
+  8043d2:	48 01 d8             	add    %rbx,%rax
+  8043d5:	ff d0                	call   *%rax
+	return r;
+  8043d7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8043da:	48 83 c4 40          	add    $0x40,%rsp
+  8043de:	5b                   	pop    %rbx
+  8043df:	41 5f                	pop    %r15
+  8043e1:	5d                   	pop    %rbp
+  8043e2:	c3                   	ret
+
+00000000008043e3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8043e3:	55                   	push   %rbp
+  8043e4:	48 89 e5             	mov    %rsp,%rbp
+  8043e7:	41 57                	push   %r15
+  8043e9:	53                   	push   %rbx
+  8043ea:	48 83 ec 40          	sub    $0x40,%rsp
+  8043ee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8043ee <read+0xb>
+  8043f5:	49 bb 52 4c 00 00 00 	movabs $0x4c52,%r11
+  8043fc:	00 00 00 
+  8043ff:	4c 01 db             	add    %r11,%rbx
+  804402:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804405:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804409:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80440d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804411:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804414:	48 89 d6             	mov    %rdx,%rsi
+  804417:	89 c7                	mov    %eax,%edi
+  804419:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  804420:	ff ff ff 
+  804423:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804427:	ff d0                	call   *%rax
+  804429:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80442c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804430:	78 28                	js     80445a <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804432:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804436:	8b 00                	mov    (%rax),%eax
+  804438:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80443c:	48 89 d6             	mov    %rdx,%rsi
+  80443f:	89 c7                	mov    %eax,%edi
+  804441:	48 b8 02 b0 ff ff ff 	movabs $0xffffffffffffb002,%rax
+  804448:	ff ff ff 
+  80444b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80444f:	ff d0                	call   *%rax
+  804451:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804454:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804458:	79 08                	jns    804462 <read+0x7f>
+		return r;
+  80445a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80445d:	e9 8b 00 00 00       	jmp    8044ed <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804462:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804466:	8b 40 08             	mov    0x8(%rax),%eax
+  804469:	83 e0 03             	and    $0x3,%eax
+  80446c:	83 f8 01             	cmp    $0x1,%eax
+  80446f:	75 4b                	jne    8044bc <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  804471:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804478:	ff ff ff 
+  80447b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80447f:	48 8b 00             	mov    (%rax),%rax
+  804482:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804488:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80448b:	89 c6                	mov    %eax,%esi
+  80448d:	48 b8 b7 e4 ff ff ff 	movabs $0xffffffffffffe4b7,%rax
+  804494:	ff ff ff 
+  804497:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80449b:	48 89 c7             	mov    %rax,%rdi
+  80449e:	49 89 df             	mov    %rbx,%r15
+  8044a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044a6:	48 b9 ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rcx
+  8044ad:	ff ff ff 
+  8044b0:	48 01 d9             	add    %rbx,%rcx
+  8044b3:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8044b5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8044ba:	eb 31                	jmp    8044ed <read+0x10a>
+	}
+	if (!dev->dev_read)
+  8044bc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044c0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8044c4:	48 85 c0             	test   %rax,%rax
+  8044c7:	75 07                	jne    8044d0 <read+0xed>
+		return -E_NOT_SUPP;
+  8044c9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8044ce:	eb 1d                	jmp    8044ed <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  8044d0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044d4:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8044d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044dc:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8044e0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8044e4:	48 89 ce             	mov    %rcx,%rsi
+  8044e7:	48 89 c7             	mov    %rax,%rdi
+  8044ea:	41 ff d0             	call   *%r8
+}
+  8044ed:	48 83 c4 40          	add    $0x40,%rsp
+  8044f1:	5b                   	pop    %rbx
+  8044f2:	41 5f                	pop    %r15
+  8044f4:	5d                   	pop    %rbp
+  8044f5:	c3                   	ret
+
+00000000008044f6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8044f6:	55                   	push   %rbp
+  8044f7:	48 89 e5             	mov    %rsp,%rbp
+  8044fa:	53                   	push   %rbx
+  8044fb:	48 83 ec 38          	sub    $0x38,%rsp
+  8044ff:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8044ff <readn+0x9>
+  804506:	49 bb 41 4b 00 00 00 	movabs $0x4b41,%r11
+  80450d:	00 00 00 
+  804510:	4c 01 db             	add    %r11,%rbx
+  804513:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804516:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80451a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80451e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804525:	eb 4b                	jmp    804572 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  804527:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80452a:	48 98                	cltq
+  80452c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804530:	48 29 c2             	sub    %rax,%rdx
+  804533:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804536:	48 63 c8             	movslq %eax,%rcx
+  804539:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80453d:	48 01 c1             	add    %rax,%rcx
+  804540:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804543:	48 89 ce             	mov    %rcx,%rsi
+  804546:	89 c7                	mov    %eax,%edi
+  804548:	48 b8 a3 b3 ff ff ff 	movabs $0xffffffffffffb3a3,%rax
+  80454f:	ff ff ff 
+  804552:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804556:	ff d0                	call   *%rax
+  804558:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  80455b:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80455f:	79 05                	jns    804566 <readn+0x70>
+			return m;
+  804561:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804564:	eb 1d                	jmp    804583 <readn+0x8d>
+		if (m == 0)
+  804566:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  80456a:	74 13                	je     80457f <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  80456c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80456f:	01 45 ec             	add    %eax,-0x14(%rbp)
+  804572:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804575:	48 98                	cltq
+  804577:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80457b:	72 aa                	jb     804527 <readn+0x31>
+  80457d:	eb 01                	jmp    804580 <readn+0x8a>
+			break;
+  80457f:	90                   	nop
+	}
+	return tot;
+  804580:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804583:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804587:	c9                   	leave
+  804588:	c3                   	ret
+
+0000000000804589 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  804589:	55                   	push   %rbp
+  80458a:	48 89 e5             	mov    %rsp,%rbp
+  80458d:	41 57                	push   %r15
+  80458f:	53                   	push   %rbx
+  804590:	48 83 ec 40          	sub    $0x40,%rsp
+  804594:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804594 <write+0xb>
+  80459b:	49 bb ac 4a 00 00 00 	movabs $0x4aac,%r11
+  8045a2:	00 00 00 
+  8045a5:	4c 01 db             	add    %r11,%rbx
+  8045a8:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8045ab:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8045af:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8045b3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8045b7:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8045ba:	48 89 d6             	mov    %rdx,%rsi
+  8045bd:	89 c7                	mov    %eax,%edi
+  8045bf:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  8045c6:	ff ff ff 
+  8045c9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045cd:	ff d0                	call   *%rax
+  8045cf:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8045d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045d6:	78 28                	js     804600 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8045d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8045dc:	8b 00                	mov    (%rax),%eax
+  8045de:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8045e2:	48 89 d6             	mov    %rdx,%rsi
+  8045e5:	89 c7                	mov    %eax,%edi
+  8045e7:	48 b8 02 b0 ff ff ff 	movabs $0xffffffffffffb002,%rax
+  8045ee:	ff ff ff 
+  8045f1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045f5:	ff d0                	call   *%rax
+  8045f7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8045fa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045fe:	79 08                	jns    804608 <write+0x7f>
+		return r;
+  804600:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804603:	e9 8a 00 00 00       	jmp    804692 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804608:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80460c:	8b 40 08             	mov    0x8(%rax),%eax
+  80460f:	83 e0 03             	and    $0x3,%eax
+  804612:	85 c0                	test   %eax,%eax
+  804614:	75 4b                	jne    804661 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  804616:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80461d:	ff ff ff 
+  804620:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804624:	48 8b 00             	mov    (%rax),%rax
+  804627:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80462d:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804630:	89 c6                	mov    %eax,%esi
+  804632:	48 b8 d3 e4 ff ff ff 	movabs $0xffffffffffffe4d3,%rax
+  804639:	ff ff ff 
+  80463c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804640:	48 89 c7             	mov    %rax,%rdi
+  804643:	49 89 df             	mov    %rbx,%r15
+  804646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464b:	48 b9 ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rcx
+  804652:	ff ff ff 
+  804655:	48 01 d9             	add    %rbx,%rcx
+  804658:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  80465a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80465f:	eb 31                	jmp    804692 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  804661:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804665:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804669:	48 85 c0             	test   %rax,%rax
+  80466c:	75 07                	jne    804675 <write+0xec>
+		return -E_NOT_SUPP;
+  80466e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804673:	eb 1d                	jmp    804692 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  804675:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804679:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  80467d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804681:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804685:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804689:	48 89 ce             	mov    %rcx,%rsi
+  80468c:	48 89 c7             	mov    %rax,%rdi
+  80468f:	41 ff d0             	call   *%r8
+}
+  804692:	48 83 c4 40          	add    $0x40,%rsp
+  804696:	5b                   	pop    %rbx
+  804697:	41 5f                	pop    %r15
+  804699:	5d                   	pop    %rbp
+  80469a:	c3                   	ret
+
+000000000080469b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80469b:	55                   	push   %rbp
+  80469c:	48 89 e5             	mov    %rsp,%rbp
+  80469f:	48 83 ec 18          	sub    $0x18,%rsp
+  8046a3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8046a3 <seek+0x8>
+  8046aa:	49 bb 9d 49 00 00 00 	movabs $0x499d,%r11
+  8046b1:	00 00 00 
+  8046b4:	4c 01 d8             	add    %r11,%rax
+  8046b7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8046ba:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8046bd:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  8046c1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8046c4:	48 89 ce             	mov    %rcx,%rsi
+  8046c7:	89 d7                	mov    %edx,%edi
+  8046c9:	48 ba 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rdx
+  8046d0:	ff ff ff 
+  8046d3:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  8046d7:	ff d0                	call   *%rax
+  8046d9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8046dc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8046e0:	79 05                	jns    8046e7 <seek+0x4c>
+		return r;
+  8046e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8046e5:	eb 0f                	jmp    8046f6 <seek+0x5b>
+	fd->fd_offset = offset;
+  8046e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046eb:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8046ee:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  8046f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046f6:	c9                   	leave
+  8046f7:	c3                   	ret
+
+00000000008046f8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8046f8:	55                   	push   %rbp
+  8046f9:	48 89 e5             	mov    %rsp,%rbp
+  8046fc:	41 57                	push   %r15
+  8046fe:	53                   	push   %rbx
+  8046ff:	48 83 ec 30          	sub    $0x30,%rsp
+  804703:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804703 <ftruncate+0xb>
+  80470a:	49 bb 3d 49 00 00 00 	movabs $0x493d,%r11
+  804711:	00 00 00 
+  804714:	4c 01 db             	add    %r11,%rbx
+  804717:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80471a:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80471d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804721:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804724:	48 89 d6             	mov    %rdx,%rsi
+  804727:	89 c7                	mov    %eax,%edi
+  804729:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  804730:	ff ff ff 
+  804733:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804737:	ff d0                	call   *%rax
+  804739:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80473c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804740:	78 28                	js     80476a <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804742:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804746:	8b 00                	mov    (%rax),%eax
+  804748:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80474c:	48 89 d6             	mov    %rdx,%rsi
+  80474f:	89 c7                	mov    %eax,%edi
+  804751:	48 b8 02 b0 ff ff ff 	movabs $0xffffffffffffb002,%rax
+  804758:	ff ff ff 
+  80475b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80475f:	ff d0                	call   *%rax
+  804761:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804764:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804768:	79 08                	jns    804772 <ftruncate+0x7a>
+		return r;
+  80476a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80476d:	e9 83 00 00 00       	jmp    8047f5 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804772:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804776:	8b 40 08             	mov    0x8(%rax),%eax
+  804779:	83 e0 03             	and    $0x3,%eax
+  80477c:	85 c0                	test   %eax,%eax
+  80477e:	75 4b                	jne    8047cb <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  804780:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804787:	ff ff ff 
+  80478a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80478e:	48 8b 00             	mov    (%rax),%rax
+  804791:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  804797:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  80479a:	89 c6                	mov    %eax,%esi
+  80479c:	48 b8 f0 e4 ff ff ff 	movabs $0xffffffffffffe4f0,%rax
+  8047a3:	ff ff ff 
+  8047a6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047aa:	48 89 c7             	mov    %rax,%rdi
+  8047ad:	49 89 df             	mov    %rbx,%r15
+  8047b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b5:	48 b9 ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rcx
+  8047bc:	ff ff ff 
+  8047bf:	48 01 d9             	add    %rbx,%rcx
+  8047c2:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8047c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8047c9:	eb 2a                	jmp    8047f5 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  8047cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047cf:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8047d3:	48 85 c0             	test   %rax,%rax
+  8047d6:	75 07                	jne    8047df <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  8047d8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8047dd:	eb 16                	jmp    8047f5 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  8047df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047e3:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8047e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047eb:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  8047ee:	89 d6                	mov    %edx,%esi
+  8047f0:	48 89 c7             	mov    %rax,%rdi
+  8047f3:	ff d1                	call   *%rcx
+}
+  8047f5:	48 83 c4 30          	add    $0x30,%rsp
+  8047f9:	5b                   	pop    %rbx
+  8047fa:	41 5f                	pop    %r15
+  8047fc:	5d                   	pop    %rbp
+  8047fd:	c3                   	ret
+
+00000000008047fe <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8047fe:	55                   	push   %rbp
+  8047ff:	48 89 e5             	mov    %rsp,%rbp
+  804802:	53                   	push   %rbx
+  804803:	48 83 ec 38          	sub    $0x38,%rsp
+  804807:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804807 <fstat+0x9>
+  80480e:	49 bb 39 48 00 00 00 	movabs $0x4839,%r11
+  804815:	00 00 00 
+  804818:	4c 01 db             	add    %r11,%rbx
+  80481b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80481e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804822:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804826:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804829:	48 89 d6             	mov    %rdx,%rsi
+  80482c:	89 c7                	mov    %eax,%edi
+  80482e:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  804835:	ff ff ff 
+  804838:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80483c:	ff d0                	call   *%rax
+  80483e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804841:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804845:	78 28                	js     80486f <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804847:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80484b:	8b 00                	mov    (%rax),%eax
+  80484d:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804851:	48 89 d6             	mov    %rdx,%rsi
+  804854:	89 c7                	mov    %eax,%edi
+  804856:	48 b8 02 b0 ff ff ff 	movabs $0xffffffffffffb002,%rax
+  80485d:	ff ff ff 
+  804860:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804864:	ff d0                	call   *%rax
+  804866:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804869:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80486d:	79 05                	jns    804874 <fstat+0x76>
+		return r;
+  80486f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804872:	eb 5e                	jmp    8048d2 <fstat+0xd4>
+	if (!dev->dev_stat)
+  804874:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804878:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80487c:	48 85 c0             	test   %rax,%rax
+  80487f:	75 07                	jne    804888 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  804881:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804886:	eb 4a                	jmp    8048d2 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  804888:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80488c:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  80488f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804893:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80489a:	00 00 00 
+	stat->st_isdir = 0;
+  80489d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048a1:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8048a8:	00 00 00 
+	stat->st_dev = dev;
+  8048ab:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8048af:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048b3:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  8048ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048be:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8048c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8048ca:	48 89 d6             	mov    %rdx,%rsi
+  8048cd:	48 89 c7             	mov    %rax,%rdi
+  8048d0:	ff d1                	call   *%rcx
+}
+  8048d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8048d6:	c9                   	leave
+  8048d7:	c3                   	ret
+
+00000000008048d8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8048d8:	55                   	push   %rbp
+  8048d9:	48 89 e5             	mov    %rsp,%rbp
+  8048dc:	41 57                	push   %r15
+  8048de:	53                   	push   %rbx
+  8048df:	48 83 ec 20          	sub    $0x20,%rsp
+  8048e3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8048e3 <stat+0xb>
+  8048ea:	49 bb 5d 47 00 00 00 	movabs $0x475d,%r11
+  8048f1:	00 00 00 
+  8048f4:	4c 01 db             	add    %r11,%rbx
+  8048f7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8048fb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8048ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804903:	be 00 00 00 00       	mov    $0x0,%esi
+  804908:	48 89 c7             	mov    %rax,%rdi
+  80490b:	49 89 df             	mov    %rbx,%r15
+  80490e:	48 b8 72 bb ff ff ff 	movabs $0xffffffffffffbb72,%rax
+  804915:	ff ff ff 
+  804918:	48 01 d8             	add    %rbx,%rax
+  80491b:	ff d0                	call   *%rax
+  80491d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804920:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804924:	79 05                	jns    80492b <stat+0x53>
+		return fd;
+  804926:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804929:	eb 37                	jmp    804962 <stat+0x8a>
+	r = fstat(fd, stat);
+  80492b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80492f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804932:	48 89 d6             	mov    %rdx,%rsi
+  804935:	89 c7                	mov    %eax,%edi
+  804937:	48 b8 be b7 ff ff ff 	movabs $0xffffffffffffb7be,%rax
+  80493e:	ff ff ff 
+  804941:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804945:	ff d0                	call   *%rax
+  804947:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  80494a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80494d:	89 c7                	mov    %eax,%edi
+  80494f:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  804956:	ff ff ff 
+  804959:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80495d:	ff d0                	call   *%rax
+	return r;
+  80495f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  804962:	48 83 c4 20          	add    $0x20,%rsp
+  804966:	5b                   	pop    %rbx
+  804967:	41 5f                	pop    %r15
+  804969:	5d                   	pop    %rbp
+  80496a:	c3                   	ret
+
+000000000080496b <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80496b:	55                   	push   %rbp
+  80496c:	48 89 e5             	mov    %rsp,%rbp
+  80496f:	41 57                	push   %r15
+  804971:	53                   	push   %rbx
+  804972:	48 83 ec 10          	sub    $0x10,%rsp
+  804976:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804976 <fsipc+0xb>
+  80497d:	49 bb ca 46 00 00 00 	movabs $0x46ca,%r11
+  804984:	00 00 00 
+  804987:	4c 01 db             	add    %r11,%rbx
+  80498a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80498d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  804991:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804998:	00 00 00 
+  80499b:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  80499e:	85 c0                	test   %eax,%eax
+  8049a0:	75 24                	jne    8049c6 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8049a2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8049a7:	49 89 df             	mov    %rbx,%r15
+  8049aa:	48 b8 9d ac ff ff ff 	movabs $0xffffffffffffac9d,%rax
+  8049b1:	ff ff ff 
+  8049b4:	48 01 d8             	add    %rbx,%rax
+  8049b7:	ff d0                	call   *%rax
+  8049b9:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  8049c0:	00 00 00 
+  8049c3:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  8049c6:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8049cd:	00 00 00 
+  8049d0:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8049d7:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  8049da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8049e0:	49 89 d0             	mov    %rdx,%r8
+  8049e3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8049e8:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  8049ef:	00 00 00 
+  8049f2:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8049f6:	89 c7                	mov    %eax,%edi
+  8049f8:	49 89 df             	mov    %rbx,%r15
+  8049fb:	48 b8 bc a6 ff ff ff 	movabs $0xffffffffffffa6bc,%rax
+  804a02:	ff ff ff 
+  804a05:	48 01 d8             	add    %rbx,%rax
+  804a08:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804a0a:	48 83 c4 10          	add    $0x10,%rsp
+  804a0e:	5b                   	pop    %rbx
+  804a0f:	41 5f                	pop    %r15
+  804a11:	5d                   	pop    %rbp
+  804a12:	c3                   	ret
+
+0000000000804a13 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804a13:	55                   	push   %rbp
+  804a14:	48 89 e5             	mov    %rsp,%rbp
+  804a17:	41 57                	push   %r15
+  804a19:	53                   	push   %rbx
+  804a1a:	48 83 ec 20          	sub    $0x20,%rsp
+  804a1e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a1e <fsipc_words+0xb>
+  804a25:	49 bb 22 46 00 00 00 	movabs $0x4622,%r11
+  804a2c:	00 00 00 
+  804a2f:	4c 01 db             	add    %r11,%rbx
+  804a32:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804a35:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804a39:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804a3d:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804a44:	00 00 00 
+  804a47:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a4a:	85 c0                	test   %eax,%eax
+  804a4c:	75 24                	jne    804a72 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804a4e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a53:	49 89 df             	mov    %rbx,%r15
+  804a56:	48 b8 9d ac ff ff ff 	movabs $0xffffffffffffac9d,%rax
+  804a5d:	ff ff ff 
+  804a60:	48 01 d8             	add    %rbx,%rax
+  804a63:	ff d0                	call   *%rax
+  804a65:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804a6c:	00 00 00 
+  804a6f:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804a72:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804a79:	00 00 00 
+  804a7c:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a7f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804a83:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a87:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804a8a:	89 c7                	mov    %eax,%edi
+  804a8c:	49 89 df             	mov    %rbx,%r15
+  804a8f:	48 b8 a7 a7 ff ff ff 	movabs $0xffffffffffffa7a7,%rax
+  804a96:	ff ff ff 
+  804a99:	48 01 d8             	add    %rbx,%rax
+  804a9c:	ff d0                	call   *%rax
+}
+  804a9e:	48 83 c4 20          	add    $0x20,%rsp
+  804aa2:	5b                   	pop    %rbx
+  804aa3:	41 5f                	pop    %r15
+  804aa5:	5d                   	pop    %rbp
+  804aa6:	c3                   	ret
+
+0000000000804aa7 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804aa7:	55                   	push   %rbp
+  804aa8:	48 89 e5             	mov    %rsp,%rbp
+  804aab:	41 57                	push   %r15
+  804aad:	53                   	push   %rbx
+  804aae:	48 83 ec 40          	sub    $0x40,%rsp
+  804ab2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ab2 <fsipc_pages+0xb>
+  804ab9:	49 bb 8e 45 00 00 00 	movabs $0x458e,%r11
+  804ac0:	00 00 00 
+  804ac3:	4c 01 db             	add    %r11,%rbx
+  804ac6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804ac9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804acd:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804ad1:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804ad4:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804adb:	00 00 00 
+  804ade:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804ae1:	85 c0                	test   %eax,%eax
+  804ae3:	75 24                	jne    804b09 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804ae5:	bf 01 00 00 00       	mov    $0x1,%edi
+  804aea:	49 89 df             	mov    %rbx,%r15
+  804aed:	48 b8 9d ac ff ff ff 	movabs $0xffffffffffffac9d,%rax
+  804af4:	ff ff ff 
+  804af7:	48 01 d8             	add    %rbx,%rax
+  804afa:	ff d0                	call   *%rax
+  804afc:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804b03:	00 00 00 
+  804b06:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804b09:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804b0e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804b12:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804b15:	48 98                	cltq
+  804b17:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804b1b:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804b1f:	0f 95 c0             	setne  %al
+  804b22:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804b25:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804b2c:	00 
+  804b2d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804b31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b35:	48 01 d0             	add    %rdx,%rax
+  804b38:	48 83 e8 01          	sub    $0x1,%rax
+  804b3c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804b40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b44:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b49:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804b4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b51:	48 29 d0             	sub    %rdx,%rax
+  804b54:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804b58:	41 89 c2             	mov    %eax,%r10d
+  804b5b:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804b62:	00 00 00 
+  804b65:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b68:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804b70:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804b73:	48 83 ec 08          	sub    $0x8,%rsp
+  804b77:	6a 40                	push   $0x40
+  804b79:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804b7e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804b85:	00 
+  804b86:	6a 05                	push   $0x5
+  804b88:	41 89 f9             	mov    %edi,%r9d
+  804b8b:	49 89 c8             	mov    %rcx,%r8
+  804b8e:	44 89 d1             	mov    %r10d,%ecx
+  804b91:	89 c7                	mov    %eax,%edi
+  804b93:	49 89 df             	mov    %rbx,%r15
+  804b96:	48 b8 a5 a8 ff ff ff 	movabs $0xffffffffffffa8a5,%rax
+  804b9d:	ff ff ff 
+  804ba0:	48 01 d8             	add    %rbx,%rax
+  804ba3:	ff d0                	call   *%rax
+  804ba5:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804ba9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804bad:	5b                   	pop    %rbx
+  804bae:	41 5f                	pop    %r15
+  804bb0:	5d                   	pop    %rbp
+  804bb1:	c3                   	ret
+
+0000000000804bb2 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804bb2:	55                   	push   %rbp
+  804bb3:	48 89 e5             	mov    %rsp,%rbp
+  804bb6:	41 57                	push   %r15
+  804bb8:	53                   	push   %rbx
+  804bb9:	48 83 ec 20          	sub    $0x20,%rsp
+  804bbd:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804bbd <open+0xb>
+  804bc4:	49 bb 83 44 00 00 00 	movabs $0x4483,%r11
+  804bcb:	00 00 00 
+  804bce:	4c 01 db             	add    %r11,%rbx
+  804bd1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804bd5:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804bd8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bdc:	48 89 c7             	mov    %rax,%rdi
+  804bdf:	49 89 df             	mov    %rbx,%r15
+  804be2:	48 b8 db 84 ff ff ff 	movabs $0xffffffffffff84db,%rax
+  804be9:	ff ff ff 
+  804bec:	48 01 d8             	add    %rbx,%rax
+  804bef:	ff d0                	call   *%rax
+  804bf1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804bf6:	7e 0a                	jle    804c02 <open+0x50>
+		return -E_BAD_PATH;
+  804bf8:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804bfd:	e9 18 01 00 00       	jmp    804d1a <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804c02:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804c06:	48 89 c7             	mov    %rax,%rdi
+  804c09:	49 89 df             	mov    %rbx,%r15
+  804c0c:	48 b8 a6 ad ff ff ff 	movabs $0xffffffffffffada6,%rax
+  804c13:	ff ff ff 
+  804c16:	48 01 d8             	add    %rbx,%rax
+  804c19:	ff d0                	call   *%rax
+  804c1b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c1e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c22:	74 08                	je     804c2c <open+0x7a>
+		return r;
+  804c24:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c27:	e9 ee 00 00 00       	jmp    804d1a <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804c2c:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804c33:	00 00 00 
+  804c36:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804c39:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804c40:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c44:	48 89 c6             	mov    %rax,%rsi
+  804c47:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804c4e:	00 00 00 
+  804c51:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804c55:	48 89 c7             	mov    %rax,%rdi
+  804c58:	49 89 df             	mov    %rbx,%r15
+  804c5b:	48 b8 6f 85 ff ff ff 	movabs $0xffffffffffff856f,%rax
+  804c62:	ff ff ff 
+  804c65:	48 01 d8             	add    %rbx,%rax
+  804c68:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804c6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c6e:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804c73:	48 89 c6             	mov    %rax,%rsi
+  804c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c7b:	49 89 df             	mov    %rbx,%r15
+  804c7e:	48 b8 2b 92 ff ff ff 	movabs $0xffffffffffff922b,%rax
+  804c85:	ff ff ff 
+  804c88:	48 01 d8             	add    %rbx,%rax
+  804c8b:	ff d0                	call   *%rax
+  804c8d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c90:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c94:	74 23                	je     804cb9 <open+0x107>
+		fd_close(fd,0);
+  804c96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c9a:	be 00 00 00 00       	mov    $0x0,%esi
+  804c9f:	48 89 c7             	mov    %rax,%rdi
+  804ca2:	49 89 df             	mov    %rbx,%r15
+  804ca5:	48 b8 07 af ff ff ff 	movabs $0xffffffffffffaf07,%rax
+  804cac:	ff ff ff 
+  804caf:	48 01 d8             	add    %rbx,%rax
+  804cb2:	ff d0                	call   *%rax
+		return r;
+  804cb4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cb7:	eb 61                	jmp    804d1a <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804cb9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cbd:	48 89 c6             	mov    %rax,%rsi
+  804cc0:	bf 01 00 00 00       	mov    $0x1,%edi
+  804cc5:	48 b8 2b b9 ff ff ff 	movabs $0xffffffffffffb92b,%rax
+  804ccc:	ff ff ff 
+  804ccf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cd3:	ff d0                	call   *%rax
+  804cd5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cd8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cdc:	74 23                	je     804d01 <open+0x14f>
+		fd_close(fd,0);
+  804cde:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ce2:	be 00 00 00 00       	mov    $0x0,%esi
+  804ce7:	48 89 c7             	mov    %rax,%rdi
+  804cea:	49 89 df             	mov    %rbx,%r15
+  804ced:	48 b8 07 af ff ff ff 	movabs $0xffffffffffffaf07,%rax
+  804cf4:	ff ff ff 
+  804cf7:	48 01 d8             	add    %rbx,%rax
+  804cfa:	ff d0                	call   *%rax
+		return r;
+  804cfc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804cff:	eb 19                	jmp    804d1a <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804d01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d05:	48 89 c7             	mov    %rax,%rdi
+  804d08:	49 89 df             	mov    %rbx,%r15
+  804d0b:	48 b8 2c ad ff ff ff 	movabs $0xffffffffffffad2c,%rax
+  804d12:	ff ff ff 
+  804d15:	48 01 d8             	add    %rbx,%rax
+  804d18:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804d1a:	48 83 c4 20          	add    $0x20,%rsp
+  804d1e:	5b                   	pop    %rbx
+  804d1f:	41 5f                	pop    %r15
+  804d21:	5d                   	pop    %rbp
+  804d22:	c3                   	ret
+
+0000000000804d23 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804d23:	55                   	push   %rbp
+  804d24:	48 89 e5             	mov    %rsp,%rbp
+  804d27:	48 83 ec 20          	sub    $0x20,%rsp
+  804d2b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d2b <devfile_flush+0x8>
+  804d32:	49 bb 15 43 00 00 00 	movabs $0x4315,%r11
+  804d39:	00 00 00 
+  804d3c:	4c 01 d8             	add    %r11,%rax
+  804d3f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804d43:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d47:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804d4a:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804d4d:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804d51:	ba 04 00 00 00       	mov    $0x4,%edx
+  804d56:	48 89 ce             	mov    %rcx,%rsi
+  804d59:	bf 06 00 00 00       	mov    $0x6,%edi
+  804d5e:	48 b9 d3 b9 ff ff ff 	movabs $0xffffffffffffb9d3,%rcx
+  804d65:	ff ff ff 
+  804d68:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804d6c:	ff d0                	call   *%rax
+}
+  804d6e:	c9                   	leave
+  804d6f:	c3                   	ret
+
+0000000000804d70 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804d70:	55                   	push   %rbp
+  804d71:	48 89 e5             	mov    %rsp,%rbp
+  804d74:	41 57                	push   %r15
+  804d76:	53                   	push   %rbx
+  804d77:	48 83 ec 60          	sub    $0x60,%rsp
+  804d7b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804d7b <devfile_read+0xb>
+  804d82:	49 bb c5 42 00 00 00 	movabs $0x42c5,%r11
+  804d89:	00 00 00 
+  804d8c:	4c 01 db             	add    %r11,%rbx
+  804d8f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804d93:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804d97:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804d9b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804d9f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804da3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804da7:	8b 50 0c             	mov    0xc(%rax),%edx
+  804daa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804dae:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804db0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804db4:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804db8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804dbc:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804dc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804dc5:	ba 10 00 00 00       	mov    $0x10,%edx
+  804dca:	48 89 c6             	mov    %rax,%rsi
+  804dcd:	bf 03 00 00 00       	mov    $0x3,%edi
+  804dd2:	48 b8 67 ba ff ff ff 	movabs $0xffffffffffffba67,%rax
+  804dd9:	ff ff ff 
+  804ddc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804de0:	ff d0                	call   *%rax
+  804de2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804de5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804de9:	79 05                	jns    804df0 <devfile_read+0x80>
+		return r;
+  804deb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804dee:	eb 64                	jmp    804e54 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804df0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804df3:	48 63 d0             	movslq %eax,%rdx
+  804df6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804dfa:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804dff:	48 01 c1             	add    %rax,%rcx
+  804e02:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804e06:	48 89 ce             	mov    %rcx,%rsi
+  804e09:	48 89 c7             	mov    %rax,%rdi
+  804e0c:	49 89 df             	mov    %rbx,%r15
+  804e0f:	48 b8 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rax
+  804e16:	ff ff ff 
+  804e19:	48 01 d8             	add    %rbx,%rax
+  804e1c:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804e1e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804e25:	ff ff ff 
+  804e28:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804e2c:	48 8b 00             	mov    (%rax),%rax
+  804e2f:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804e35:	89 c6                	mov    %eax,%esi
+  804e37:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804e3c:	48 89 c7             	mov    %rax,%rdi
+  804e3f:	49 89 df             	mov    %rbx,%r15
+  804e42:	48 b8 57 ac ff ff ff 	movabs $0xffffffffffffac57,%rax
+  804e49:	ff ff ff 
+  804e4c:	48 01 d8             	add    %rbx,%rax
+  804e4f:	ff d0                	call   *%rax
+	return r;
+  804e51:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804e54:	48 83 c4 60          	add    $0x60,%rsp
+  804e58:	5b                   	pop    %rbx
+  804e59:	41 5f                	pop    %r15
+  804e5b:	5d                   	pop    %rbp
+  804e5c:	c3                   	ret
+
+0000000000804e5d <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804e5d:	55                   	push   %rbp
+  804e5e:	48 89 e5             	mov    %rsp,%rbp
+  804e61:	41 57                	push   %r15
+  804e63:	53                   	push   %rbx
+  804e64:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804e68:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804e68 <devfile_write+0xb>
+  804e6f:	49 bb d8 41 00 00 00 	movabs $0x41d8,%r11
+  804e76:	00 00 00 
+  804e79:	4c 01 db             	add    %r11,%rbx
+  804e7c:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804e80:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804e84:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804e8b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804e8f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804e93:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804e9a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804e9e:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804ea5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804ea8:	48 63 d0             	movslq %eax,%rdx
+  804eab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804eaf:	48 39 c2             	cmp    %rax,%rdx
+  804eb2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804eb6:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804ebd:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804ec4:	00 
+  804ec5:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804ecc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ed0:	48 01 d0             	add    %rdx,%rax
+  804ed3:	48 83 e8 01          	sub    $0x1,%rax
+  804ed7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804edb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804edf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ee4:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804ee8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804eec:	48 29 d0             	sub    %rdx,%rax
+  804eef:	48 c1 e8 0c          	shr    $0xc,%rax
+  804ef3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804ef6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804ef9:	89 c6                	mov    %eax,%esi
+  804efb:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804f00:	48 89 c7             	mov    %rax,%rdi
+  804f03:	49 89 df             	mov    %rbx,%r15
+  804f06:	48 b8 11 ac ff ff ff 	movabs $0xffffffffffffac11,%rax
+  804f0d:	ff ff ff 
+  804f10:	48 01 d8             	add    %rbx,%rax
+  804f13:	ff d0                	call   *%rax
+  804f15:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804f18:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804f1c:	79 08                	jns    804f26 <devfile_write+0xc9>
+		return r;
+  804f1e:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804f21:	e9 8f 00 00 00       	jmp    804fb5 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804f26:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804f2d:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804f31:	48 89 c6             	mov    %rax,%rsi
+  804f34:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804f39:	48 89 c7             	mov    %rax,%rdi
+  804f3c:	49 89 df             	mov    %rbx,%r15
+  804f3f:	48 b8 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rax
+  804f46:	ff ff ff 
+  804f49:	48 01 d8             	add    %rbx,%rax
+  804f4c:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804f4e:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804f52:	8b 50 0c             	mov    0xc(%rax),%edx
+  804f55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f59:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5f:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804f66:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804f6a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804f6d:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804f71:	89 d1                	mov    %edx,%ecx
+  804f73:	ba 10 00 00 00       	mov    $0x10,%edx
+  804f78:	48 89 c6             	mov    %rax,%rsi
+  804f7b:	bf 04 00 00 00       	mov    $0x4,%edi
+  804f80:	48 b8 67 ba ff ff ff 	movabs $0xffffffffffffba67,%rax
+  804f87:	ff ff ff 
+  804f8a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804f8e:	ff d0                	call   *%rax
+  804f90:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804f93:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804f96:	89 c6                	mov    %eax,%esi
+  804f98:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804f9d:	48 89 c7             	mov    %rax,%rdi
+  804fa0:	49 89 df             	mov    %rbx,%r15
+  804fa3:	48 b8 57 ac ff ff ff 	movabs $0xffffffffffffac57,%rax
+  804faa:	ff ff ff 
+  804fad:	48 01 d8             	add    %rbx,%rax
+  804fb0:	ff d0                	call   *%rax
+	return r;
+  804fb2:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  804fb5:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  804fb9:	5b                   	pop    %rbx
+  804fba:	41 5f                	pop    %r15
+  804fbc:	5d                   	pop    %rbp
+  804fbd:	c3                   	ret
+
+0000000000804fbe <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  804fbe:	55                   	push   %rbp
+  804fbf:	48 89 e5             	mov    %rsp,%rbp
+  804fc2:	41 57                	push   %r15
+  804fc4:	53                   	push   %rbx
+  804fc5:	48 83 ec 20          	sub    $0x20,%rsp
+  804fc9:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804fc9 <devfile_stat+0xb>
+  804fd0:	49 bb 77 40 00 00 00 	movabs $0x4077,%r11
+  804fd7:	00 00 00 
+  804fda:	4c 01 db             	add    %r11,%rbx
+  804fdd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804fe1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804fe5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804fe9:	8b 40 0c             	mov    0xc(%rax),%eax
+  804fec:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804ff3:	00 00 00 
+  804ff6:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804ff9:	be 00 00 00 00       	mov    $0x0,%esi
+  804ffe:	bf 05 00 00 00       	mov    $0x5,%edi
+  805003:	48 b8 2b b9 ff ff ff 	movabs $0xffffffffffffb92b,%rax
+  80500a:	ff ff ff 
+  80500d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805011:	ff d0                	call   *%rax
+  805013:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805016:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80501a:	79 05                	jns    805021 <devfile_stat+0x63>
+		return r;
+  80501c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80501f:	eb 65                	jmp    805086 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  805021:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805025:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80502c:	00 00 00 
+  80502f:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805033:	48 89 d6             	mov    %rdx,%rsi
+  805036:	48 89 c7             	mov    %rax,%rdi
+  805039:	49 89 df             	mov    %rbx,%r15
+  80503c:	48 b8 6f 85 ff ff ff 	movabs $0xffffffffffff856f,%rax
+  805043:	ff ff ff 
+  805046:	48 01 d8             	add    %rbx,%rax
+  805049:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80504b:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  805052:	00 00 00 
+  805055:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  80505c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805060:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  805066:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80506d:	00 00 00 
+  805070:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  805077:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80507b:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  805081:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805086:	48 83 c4 20          	add    $0x20,%rsp
+  80508a:	5b                   	pop    %rbx
+  80508b:	41 5f                	pop    %r15
+  80508d:	5d                   	pop    %rbp
+  80508e:	c3                   	ret
+
+000000000080508f <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80508f:	55                   	push   %rbp
+  805090:	48 89 e5             	mov    %rsp,%rbp
+  805093:	48 83 ec 20          	sub    $0x20,%rsp
+  805097:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805097 <devfile_trunc+0x8>
+  80509e:	49 bb a9 3f 00 00 00 	movabs $0x3fa9,%r11
+  8050a5:	00 00 00 
+  8050a8:	4c 01 d8             	add    %r11,%rax
+  8050ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8050af:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  8050b2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8050b6:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8050b9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  8050bc:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8050bf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  8050c2:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8050c6:	ba 08 00 00 00       	mov    $0x8,%edx
+  8050cb:	48 89 ce             	mov    %rcx,%rsi
+  8050ce:	bf 02 00 00 00       	mov    $0x2,%edi
+  8050d3:	48 b9 d3 b9 ff ff ff 	movabs $0xffffffffffffb9d3,%rcx
+  8050da:	ff ff ff 
+  8050dd:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8050e1:	ff d0                	call   *%rax
+}
+  8050e3:	c9                   	leave
+  8050e4:	c3                   	ret
+
+00000000008050e5 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8050e5:	55                   	push   %rbp
+  8050e6:	48 89 e5             	mov    %rsp,%rbp
+  8050e9:	41 57                	push   %r15
+  8050eb:	53                   	push   %rbx
+  8050ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8050f0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8050f0 <remove+0xb>
+  8050f7:	49 bb 50 3f 00 00 00 	movabs $0x3f50,%r11
+  8050fe:	00 00 00 
+  805101:	4c 01 db             	add    %r11,%rbx
+  805104:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  805108:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80510c:	48 89 c7             	mov    %rax,%rdi
+  80510f:	49 89 df             	mov    %rbx,%r15
+  805112:	48 b8 db 84 ff ff ff 	movabs $0xffffffffffff84db,%rax
+  805119:	ff ff ff 
+  80511c:	48 01 d8             	add    %rbx,%rax
+  80511f:	ff d0                	call   *%rax
+  805121:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  805126:	7e 07                	jle    80512f <remove+0x4a>
+		return -E_BAD_PATH;
+  805128:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80512d:	eb 44                	jmp    805173 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80512f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805133:	48 89 c6             	mov    %rax,%rsi
+  805136:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80513d:	00 00 00 
+  805140:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805144:	48 89 c7             	mov    %rax,%rdi
+  805147:	49 89 df             	mov    %rbx,%r15
+  80514a:	48 b8 6f 85 ff ff ff 	movabs $0xffffffffffff856f,%rax
+  805151:	ff ff ff 
+  805154:	48 01 d8             	add    %rbx,%rax
+  805157:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  805159:	be 00 00 00 00       	mov    $0x0,%esi
+  80515e:	bf 07 00 00 00       	mov    $0x7,%edi
+  805163:	48 b8 2b b9 ff ff ff 	movabs $0xffffffffffffb92b,%rax
+  80516a:	ff ff ff 
+  80516d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805171:	ff d0                	call   *%rax
+}
+  805173:	48 83 c4 10          	add    $0x10,%rsp
+  805177:	5b                   	pop    %rbx
+  805178:	41 5f                	pop    %r15
+  80517a:	5d                   	pop    %rbp
+  80517b:	c3                   	ret
+
+000000000080517c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80517c:	55                   	push   %rbp
+  80517d:	48 89 e5             	mov    %rsp,%rbp
+  805180:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805180 <sync+0x4>
+  805187:	49 bb c0 3e 00 00 00 	movabs $0x3ec0,%r11
+  80518e:	00 00 00 
+  805191:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  805194:	ba 00 00 00 00       	mov    $0x0,%edx
+  805199:	be 00 00 00 00       	mov    $0x0,%esi
+  80519e:	bf 08 00 00 00       	mov    $0x8,%edi
+  8051a3:	48 b9 d3 b9 ff ff ff 	movabs $0xffffffffffffb9d3,%rcx
+  8051aa:	ff ff ff 
+  8051ad:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  8051b1:	ff d0                	call   *%rax
+}
+  8051b3:	5d                   	pop    %rbp
+  8051b4:	c3                   	ret
+
+00000000008051b5 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  8051b5:	55                   	push   %rbp
+  8051b6:	48 89 e5             	mov    %rsp,%rbp
+  8051b9:	41 57                	push   %r15
+  8051bb:	53                   	push   %rbx
+  8051bc:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  8051c3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8051c3 <copy+0xe>
+  8051ca:	49 bb 7d 3e 00 00 00 	movabs $0x3e7d,%r11
+  8051d1:	00 00 00 
+  8051d4:	4c 01 db             	add    %r11,%rbx
+  8051d7:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  8051de:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  8051e5:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  8051ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8051f1:	48 89 c7             	mov    %rax,%rdi
+  8051f4:	48 b8 72 bb ff ff ff 	movabs $0xffffffffffffbb72,%rax
+  8051fb:	ff ff ff 
+  8051fe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805202:	ff d0                	call   *%rax
+  805204:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  805207:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80520b:	79 35                	jns    805242 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  80520d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805210:	89 c6                	mov    %eax,%esi
+  805212:	48 b8 16 e5 ff ff ff 	movabs $0xffffffffffffe516,%rax
+  805219:	ff ff ff 
+  80521c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805220:	48 89 c7             	mov    %rax,%rdi
+  805223:	49 89 df             	mov    %rbx,%r15
+  805226:	b8 00 00 00 00       	mov    $0x0,%eax
+  80522b:	48 ba ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rdx
+  805232:	ff ff ff 
+  805235:	48 01 da             	add    %rbx,%rdx
+  805238:	ff d2                	call   *%rdx
+		return fd_src;
+  80523a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80523d:	e9 d7 01 00 00       	jmp    805419 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  805242:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  805249:	be 01 01 00 00       	mov    $0x101,%esi
+  80524e:	48 89 c7             	mov    %rax,%rdi
+  805251:	48 b8 72 bb ff ff ff 	movabs $0xffffffffffffbb72,%rax
+  805258:	ff ff ff 
+  80525b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80525f:	ff d0                	call   *%rax
+  805261:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  805264:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  805268:	0f 89 df 00 00 00    	jns    80534d <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  80526e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805271:	89 c6                	mov    %eax,%esi
+  805273:	48 b8 2c e5 ff ff ff 	movabs $0xffffffffffffe52c,%rax
+  80527a:	ff ff ff 
+  80527d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805281:	48 89 c7             	mov    %rax,%rdi
+  805284:	49 89 df             	mov    %rbx,%r15
+  805287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80528c:	48 ba ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rdx
+  805293:	ff ff ff 
+  805296:	48 01 da             	add    %rbx,%rdx
+  805299:	ff d2                	call   *%rdx
+		close(fd_src);
+  80529b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80529e:	89 c7                	mov    %eax,%edi
+  8052a0:	49 89 df             	mov    %rbx,%r15
+  8052a3:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  8052aa:	ff ff ff 
+  8052ad:	48 01 d8             	add    %rbx,%rax
+  8052b0:	ff d0                	call   *%rax
+		return fd_dest;
+  8052b2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8052b5:	e9 5f 01 00 00       	jmp    805419 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  8052ba:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8052bd:	48 63 d0             	movslq %eax,%rdx
+  8052c0:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8052c7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8052ca:	48 89 ce             	mov    %rcx,%rsi
+  8052cd:	89 c7                	mov    %eax,%edi
+  8052cf:	49 89 df             	mov    %rbx,%r15
+  8052d2:	48 b8 49 b5 ff ff ff 	movabs $0xffffffffffffb549,%rax
+  8052d9:	ff ff ff 
+  8052dc:	48 01 d8             	add    %rbx,%rax
+  8052df:	ff d0                	call   *%rax
+  8052e1:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  8052e4:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8052e8:	79 63                	jns    80534d <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  8052ea:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8052ed:	89 c6                	mov    %eax,%esi
+  8052ef:	48 b8 46 e5 ff ff ff 	movabs $0xffffffffffffe546,%rax
+  8052f6:	ff ff ff 
+  8052f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052fd:	48 89 c7             	mov    %rax,%rdi
+  805300:	49 89 df             	mov    %rbx,%r15
+  805303:	b8 00 00 00 00       	mov    $0x0,%eax
+  805308:	48 ba ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rdx
+  80530f:	ff ff ff 
+  805312:	48 01 da             	add    %rbx,%rdx
+  805315:	ff d2                	call   *%rdx
+			close(fd_src);
+  805317:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80531a:	89 c7                	mov    %eax,%edi
+  80531c:	49 89 df             	mov    %rbx,%r15
+  80531f:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  805326:	ff ff ff 
+  805329:	48 01 d8             	add    %rbx,%rax
+  80532c:	ff d0                	call   *%rax
+			close(fd_dest);
+  80532e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805331:	89 c7                	mov    %eax,%edi
+  805333:	49 89 df             	mov    %rbx,%r15
+  805336:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  80533d:	ff ff ff 
+  805340:	48 01 d8             	add    %rbx,%rax
+  805343:	ff d0                	call   *%rax
+			return write_size;
+  805345:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805348:	e9 cc 00 00 00       	jmp    805419 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  80534d:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805354:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805357:	ba 00 02 00 00       	mov    $0x200,%edx
+  80535c:	48 89 ce             	mov    %rcx,%rsi
+  80535f:	89 c7                	mov    %eax,%edi
+  805361:	49 89 df             	mov    %rbx,%r15
+  805364:	48 b8 a3 b3 ff ff ff 	movabs $0xffffffffffffb3a3,%rax
+  80536b:	ff ff ff 
+  80536e:	48 01 d8             	add    %rbx,%rax
+  805371:	ff d0                	call   *%rax
+  805373:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805376:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80537a:	0f 8f 3a ff ff ff    	jg     8052ba <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  805380:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805384:	79 60                	jns    8053e6 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  805386:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805389:	89 c6                	mov    %eax,%esi
+  80538b:	48 b8 59 e5 ff ff ff 	movabs $0xffffffffffffe559,%rax
+  805392:	ff ff ff 
+  805395:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805399:	48 89 c7             	mov    %rax,%rdi
+  80539c:	49 89 df             	mov    %rbx,%r15
+  80539f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053a4:	48 ba ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%rdx
+  8053ab:	ff ff ff 
+  8053ae:	48 01 da             	add    %rbx,%rdx
+  8053b1:	ff d2                	call   *%rdx
+		close(fd_src);
+  8053b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b6:	89 c7                	mov    %eax,%edi
+  8053b8:	49 89 df             	mov    %rbx,%r15
+  8053bb:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  8053c2:	ff ff ff 
+  8053c5:	48 01 d8             	add    %rbx,%rax
+  8053c8:	ff d0                	call   *%rax
+		close(fd_dest);
+  8053ca:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8053cd:	89 c7                	mov    %eax,%edi
+  8053cf:	49 89 df             	mov    %rbx,%r15
+  8053d2:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  8053d9:	ff ff ff 
+  8053dc:	48 01 d8             	add    %rbx,%rax
+  8053df:	ff d0                	call   *%rax
+		return read_size;
+  8053e1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8053e4:	eb 33                	jmp    805419 <copy+0x264>
+	}
+	close(fd_src);
+  8053e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053e9:	89 c7                	mov    %eax,%edi
+  8053eb:	49 89 df             	mov    %rbx,%r15
+  8053ee:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  8053f5:	ff ff ff 
+  8053f8:	48 01 d8             	add    %rbx,%rax
+  8053fb:	ff d0                	call   *%rax
+	close(fd_dest);
+  8053fd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805400:	89 c7                	mov    %eax,%edi
+  805402:	49 89 df             	mov    %rbx,%r15
+  805405:	48 b8 eb b0 ff ff ff 	movabs $0xffffffffffffb0eb,%rax
+  80540c:	ff ff ff 
+  80540f:	48 01 d8             	add    %rbx,%rax
+  805412:	ff d0                	call   *%rax
+	return 0;
+  805414:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  805419:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  805420:	5b                   	pop    %rbx
+  805421:	41 5f                	pop    %r15
+  805423:	5d                   	pop    %rbp
+  805424:	c3                   	ret
+
+0000000000805425 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805425:	55                   	push   %rbp
+  805426:	48 89 e5             	mov    %rsp,%rbp
+  805429:	41 57                	push   %r15
+  80542b:	53                   	push   %rbx
+  80542c:	48 83 ec 20          	sub    $0x20,%rsp
+  805430:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805430 <fd2sockid+0xb>
+  805437:	49 bb 10 3c 00 00 00 	movabs $0x3c10,%r11
+  80543e:	00 00 00 
+  805441:	4c 01 db             	add    %r11,%rbx
+  805444:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  805447:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80544b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80544e:	48 89 d6             	mov    %rdx,%rsi
+  805451:	89 c7                	mov    %eax,%edi
+  805453:	49 89 df             	mov    %rbx,%r15
+  805456:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  80545d:	ff ff ff 
+  805460:	48 01 d8             	add    %rbx,%rax
+  805463:	ff d0                	call   *%rax
+  805465:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805468:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80546c:	79 05                	jns    805473 <fd2sockid+0x4e>
+		return r;
+  80546e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805471:	eb 25                	jmp    805498 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  805473:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805477:	8b 10                	mov    (%rax),%edx
+  805479:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  805480:	00 00 00 
+  805483:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805486:	39 c2                	cmp    %eax,%edx
+  805488:	74 07                	je     805491 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  80548a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80548f:	eb 07                	jmp    805498 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  805491:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805495:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  805498:	48 83 c4 20          	add    $0x20,%rsp
+  80549c:	5b                   	pop    %rbx
+  80549d:	41 5f                	pop    %r15
+  80549f:	5d                   	pop    %rbp
+  8054a0:	c3                   	ret
+
+00000000008054a1 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  8054a1:	55                   	push   %rbp
+  8054a2:	48 89 e5             	mov    %rsp,%rbp
+  8054a5:	41 57                	push   %r15
+  8054a7:	53                   	push   %rbx
+  8054a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8054ac:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8054ac <alloc_sockfd+0xb>
+  8054b3:	49 bb 94 3b 00 00 00 	movabs $0x3b94,%r11
+  8054ba:	00 00 00 
+  8054bd:	4c 01 db             	add    %r11,%rbx
+  8054c0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  8054c3:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8054c7:	48 89 c7             	mov    %rax,%rdi
+  8054ca:	49 89 df             	mov    %rbx,%r15
+  8054cd:	48 b8 a6 ad ff ff ff 	movabs $0xffffffffffffada6,%rax
+  8054d4:	ff ff ff 
+  8054d7:	48 01 d8             	add    %rbx,%rax
+  8054da:	ff d0                	call   *%rax
+  8054dc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054df:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054e3:	78 2c                	js     805511 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8054e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054e9:	ba 07 04 00 00       	mov    $0x407,%edx
+  8054ee:	48 89 c6             	mov    %rax,%rsi
+  8054f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054f6:	49 89 df             	mov    %rbx,%r15
+  8054f9:	48 b8 2b 92 ff ff ff 	movabs $0xffffffffffff922b,%rax
+  805500:	ff ff ff 
+  805503:	48 01 d8             	add    %rbx,%rax
+  805506:	ff d0                	call   *%rax
+  805508:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80550b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80550f:	79 1c                	jns    80552d <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805511:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805514:	89 c7                	mov    %eax,%edi
+  805516:	49 89 df             	mov    %rbx,%r15
+  805519:	48 b8 55 cc ff ff ff 	movabs $0xffffffffffffcc55,%rax
+  805520:	ff ff ff 
+  805523:	48 01 d8             	add    %rbx,%rax
+  805526:	ff d0                	call   *%rax
+		return r;
+  805528:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80552b:	eb 41                	jmp    80556e <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80552d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805531:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  805538:	00 00 00 
+  80553b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80553e:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  805540:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805544:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  80554b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80554f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805552:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  805555:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805559:	48 89 c7             	mov    %rax,%rdi
+  80555c:	49 89 df             	mov    %rbx,%r15
+  80555f:	48 b8 2c ad ff ff ff 	movabs $0xffffffffffffad2c,%rax
+  805566:	ff ff ff 
+  805569:	48 01 d8             	add    %rbx,%rax
+  80556c:	ff d0                	call   *%rax
+}
+  80556e:	48 83 c4 20          	add    $0x20,%rsp
+  805572:	5b                   	pop    %rbx
+  805573:	41 5f                	pop    %r15
+  805575:	5d                   	pop    %rbp
+  805576:	c3                   	ret
+
+0000000000805577 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805577:	55                   	push   %rbp
+  805578:	48 89 e5             	mov    %rsp,%rbp
+  80557b:	41 57                	push   %r15
+  80557d:	53                   	push   %rbx
+  80557e:	48 83 ec 30          	sub    $0x30,%rsp
+  805582:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805582 <accept+0xb>
+  805589:	49 bb be 3a 00 00 00 	movabs $0x3abe,%r11
+  805590:	00 00 00 
+  805593:	4c 01 db             	add    %r11,%rbx
+  805596:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805599:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80559d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8055a1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8055a4:	89 c7                	mov    %eax,%edi
+  8055a6:	48 b8 e5 c3 ff ff ff 	movabs $0xffffffffffffc3e5,%rax
+  8055ad:	ff ff ff 
+  8055b0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8055b4:	ff d0                	call   *%rax
+  8055b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055b9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055bd:	79 05                	jns    8055c4 <accept+0x4d>
+		return r;
+  8055bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055c2:	eb 45                	jmp    805609 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8055c4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8055c8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8055cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055cf:	48 89 ce             	mov    %rcx,%rsi
+  8055d2:	89 c7                	mov    %eax,%edi
+  8055d4:	49 89 df             	mov    %rbx,%r15
+  8055d7:	48 b8 c3 ca ff ff ff 	movabs $0xffffffffffffcac3,%rax
+  8055de:	ff ff ff 
+  8055e1:	48 01 d8             	add    %rbx,%rax
+  8055e4:	ff d0                	call   *%rax
+  8055e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055ed:	79 05                	jns    8055f4 <accept+0x7d>
+		return r;
+  8055ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055f2:	eb 15                	jmp    805609 <accept+0x92>
+	return alloc_sockfd(r);
+  8055f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055f7:	89 c7                	mov    %eax,%edi
+  8055f9:	48 b8 61 c4 ff ff ff 	movabs $0xffffffffffffc461,%rax
+  805600:	ff ff ff 
+  805603:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805607:	ff d0                	call   *%rax
+}
+  805609:	48 83 c4 30          	add    $0x30,%rsp
+  80560d:	5b                   	pop    %rbx
+  80560e:	41 5f                	pop    %r15
+  805610:	5d                   	pop    %rbp
+  805611:	c3                   	ret
+
+0000000000805612 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805612:	55                   	push   %rbp
+  805613:	48 89 e5             	mov    %rsp,%rbp
+  805616:	41 57                	push   %r15
+  805618:	53                   	push   %rbx
+  805619:	48 83 ec 20          	sub    $0x20,%rsp
+  80561d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80561d <bind+0xb>
+  805624:	49 bb 23 3a 00 00 00 	movabs $0x3a23,%r11
+  80562b:	00 00 00 
+  80562e:	4c 01 db             	add    %r11,%rbx
+  805631:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805634:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805638:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80563b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80563e:	89 c7                	mov    %eax,%edi
+  805640:	48 b8 e5 c3 ff ff ff 	movabs $0xffffffffffffc3e5,%rax
+  805647:	ff ff ff 
+  80564a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80564e:	ff d0                	call   *%rax
+  805650:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805653:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805657:	79 05                	jns    80565e <bind+0x4c>
+		return r;
+  805659:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80565c:	eb 21                	jmp    80567f <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  80565e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805661:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805665:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805668:	48 89 ce             	mov    %rcx,%rsi
+  80566b:	89 c7                	mov    %eax,%edi
+  80566d:	49 89 df             	mov    %rbx,%r15
+  805670:	48 b8 6f cb ff ff ff 	movabs $0xffffffffffffcb6f,%rax
+  805677:	ff ff ff 
+  80567a:	48 01 d8             	add    %rbx,%rax
+  80567d:	ff d0                	call   *%rax
+}
+  80567f:	48 83 c4 20          	add    $0x20,%rsp
+  805683:	5b                   	pop    %rbx
+  805684:	41 5f                	pop    %r15
+  805686:	5d                   	pop    %rbp
+  805687:	c3                   	ret
+
+0000000000805688 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  805688:	55                   	push   %rbp
+  805689:	48 89 e5             	mov    %rsp,%rbp
+  80568c:	41 57                	push   %r15
+  80568e:	53                   	push   %rbx
+  80568f:	48 83 ec 20          	sub    $0x20,%rsp
+  805693:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805693 <shutdown+0xb>
+  80569a:	49 bb ad 39 00 00 00 	movabs $0x39ad,%r11
+  8056a1:	00 00 00 
+  8056a4:	4c 01 db             	add    %r11,%rbx
+  8056a7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8056aa:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8056ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8056b0:	89 c7                	mov    %eax,%edi
+  8056b2:	48 b8 e5 c3 ff ff ff 	movabs $0xffffffffffffc3e5,%rax
+  8056b9:	ff ff ff 
+  8056bc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056c0:	ff d0                	call   *%rax
+  8056c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056c9:	79 05                	jns    8056d0 <shutdown+0x48>
+		return r;
+  8056cb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056ce:	eb 1c                	jmp    8056ec <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  8056d0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8056d3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056d6:	89 d6                	mov    %edx,%esi
+  8056d8:	89 c7                	mov    %eax,%edi
+  8056da:	49 89 df             	mov    %rbx,%r15
+  8056dd:	48 b8 04 cc ff ff ff 	movabs $0xffffffffffffcc04,%rax
+  8056e4:	ff ff ff 
+  8056e7:	48 01 d8             	add    %rbx,%rax
+  8056ea:	ff d0                	call   *%rax
+}
+  8056ec:	48 83 c4 20          	add    $0x20,%rsp
+  8056f0:	5b                   	pop    %rbx
+  8056f1:	41 5f                	pop    %r15
+  8056f3:	5d                   	pop    %rbp
+  8056f4:	c3                   	ret
+
+00000000008056f5 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  8056f5:	55                   	push   %rbp
+  8056f6:	48 89 e5             	mov    %rsp,%rbp
+  8056f9:	41 57                	push   %r15
+  8056fb:	53                   	push   %rbx
+  8056fc:	48 83 ec 10          	sub    $0x10,%rsp
+  805700:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805700 <devsock_close+0xb>
+  805707:	49 bb 40 39 00 00 00 	movabs $0x3940,%r11
+  80570e:	00 00 00 
+  805711:	4c 01 db             	add    %r11,%rbx
+  805714:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805718:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80571c:	48 89 c7             	mov    %rax,%rdi
+  80571f:	49 89 df             	mov    %rbx,%r15
+  805722:	48 b8 b7 dd ff ff ff 	movabs $0xffffffffffffddb7,%rax
+  805729:	ff ff ff 
+  80572c:	48 01 d8             	add    %rbx,%rax
+  80572f:	ff d0                	call   *%rax
+  805731:	83 f8 01             	cmp    $0x1,%eax
+  805734:	75 1d                	jne    805753 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805736:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80573a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80573d:	89 c7                	mov    %eax,%edi
+  80573f:	49 89 df             	mov    %rbx,%r15
+  805742:	48 b8 55 cc ff ff ff 	movabs $0xffffffffffffcc55,%rax
+  805749:	ff ff ff 
+  80574c:	48 01 d8             	add    %rbx,%rax
+  80574f:	ff d0                	call   *%rax
+  805751:	eb 05                	jmp    805758 <devsock_close+0x63>
+	else
+		return 0;
+  805753:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805758:	48 83 c4 10          	add    $0x10,%rsp
+  80575c:	5b                   	pop    %rbx
+  80575d:	41 5f                	pop    %r15
+  80575f:	5d                   	pop    %rbp
+  805760:	c3                   	ret
+
+0000000000805761 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805761:	55                   	push   %rbp
+  805762:	48 89 e5             	mov    %rsp,%rbp
+  805765:	41 57                	push   %r15
+  805767:	53                   	push   %rbx
+  805768:	48 83 ec 20          	sub    $0x20,%rsp
+  80576c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80576c <connect+0xb>
+  805773:	49 bb d4 38 00 00 00 	movabs $0x38d4,%r11
+  80577a:	00 00 00 
+  80577d:	4c 01 db             	add    %r11,%rbx
+  805780:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805783:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805787:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80578a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80578d:	89 c7                	mov    %eax,%edi
+  80578f:	48 b8 e5 c3 ff ff ff 	movabs $0xffffffffffffc3e5,%rax
+  805796:	ff ff ff 
+  805799:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80579d:	ff d0                	call   *%rax
+  80579f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8057a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057a6:	79 05                	jns    8057ad <connect+0x4c>
+		return r;
+  8057a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057ab:	eb 21                	jmp    8057ce <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  8057ad:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8057b0:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8057b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057b7:	48 89 ce             	mov    %rcx,%rsi
+  8057ba:	89 c7                	mov    %eax,%edi
+  8057bc:	49 89 df             	mov    %rbx,%r15
+  8057bf:	48 b8 9d cc ff ff ff 	movabs $0xffffffffffffcc9d,%rax
+  8057c6:	ff ff ff 
+  8057c9:	48 01 d8             	add    %rbx,%rax
+  8057cc:	ff d0                	call   *%rax
+}
+  8057ce:	48 83 c4 20          	add    $0x20,%rsp
+  8057d2:	5b                   	pop    %rbx
+  8057d3:	41 5f                	pop    %r15
+  8057d5:	5d                   	pop    %rbp
+  8057d6:	c3                   	ret
+
+00000000008057d7 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  8057d7:	55                   	push   %rbp
+  8057d8:	48 89 e5             	mov    %rsp,%rbp
+  8057db:	41 57                	push   %r15
+  8057dd:	53                   	push   %rbx
+  8057de:	48 83 ec 20          	sub    $0x20,%rsp
+  8057e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057e2 <listen+0xb>
+  8057e9:	49 bb 5e 38 00 00 00 	movabs $0x385e,%r11
+  8057f0:	00 00 00 
+  8057f3:	4c 01 db             	add    %r11,%rbx
+  8057f6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8057f9:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8057fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8057ff:	89 c7                	mov    %eax,%edi
+  805801:	48 b8 e5 c3 ff ff ff 	movabs $0xffffffffffffc3e5,%rax
+  805808:	ff ff ff 
+  80580b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80580f:	ff d0                	call   *%rax
+  805811:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805814:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805818:	79 05                	jns    80581f <listen+0x48>
+		return r;
+  80581a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80581d:	eb 1c                	jmp    80583b <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80581f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805822:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805825:	89 d6                	mov    %edx,%esi
+  805827:	89 c7                	mov    %eax,%edi
+  805829:	49 89 df             	mov    %rbx,%r15
+  80582c:	48 b8 32 cd ff ff ff 	movabs $0xffffffffffffcd32,%rax
+  805833:	ff ff ff 
+  805836:	48 01 d8             	add    %rbx,%rax
+  805839:	ff d0                	call   *%rax
+}
+  80583b:	48 83 c4 20          	add    $0x20,%rsp
+  80583f:	5b                   	pop    %rbx
+  805840:	41 5f                	pop    %r15
+  805842:	5d                   	pop    %rbp
+  805843:	c3                   	ret
+
+0000000000805844 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  805844:	55                   	push   %rbp
+  805845:	48 89 e5             	mov    %rsp,%rbp
+  805848:	41 57                	push   %r15
+  80584a:	48 83 ec 28          	sub    $0x28,%rsp
+  80584e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80584e <devsock_read+0xa>
+  805855:	49 bb f2 37 00 00 00 	movabs $0x37f2,%r11
+  80585c:	00 00 00 
+  80585f:	4c 01 d8             	add    %r11,%rax
+  805862:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805866:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80586a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  80586e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805872:	41 89 d0             	mov    %edx,%r8d
+  805875:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805879:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  80587c:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  805880:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805885:	44 89 c2             	mov    %r8d,%edx
+  805888:	49 89 c7             	mov    %rax,%r15
+  80588b:	49 b8 83 cd ff ff ff 	movabs $0xffffffffffffcd83,%r8
+  805892:	ff ff ff 
+  805895:	49 01 c0             	add    %rax,%r8
+  805898:	41 ff d0             	call   *%r8
+}
+  80589b:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80589f:	c9                   	leave
+  8058a0:	c3                   	ret
+
+00000000008058a1 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  8058a1:	55                   	push   %rbp
+  8058a2:	48 89 e5             	mov    %rsp,%rbp
+  8058a5:	41 57                	push   %r15
+  8058a7:	48 83 ec 28          	sub    $0x28,%rsp
+  8058ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8058ab <devsock_write+0xa>
+  8058b2:	49 bb 95 37 00 00 00 	movabs $0x3795,%r11
+  8058b9:	00 00 00 
+  8058bc:	4c 01 d8             	add    %r11,%rax
+  8058bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8058c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8058c7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8058cb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8058cf:	41 89 d0             	mov    %edx,%r8d
+  8058d2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8058d6:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8058d9:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8058dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8058e2:	44 89 c2             	mov    %r8d,%edx
+  8058e5:	49 89 c7             	mov    %rax,%r15
+  8058e8:	49 b8 a0 ce ff ff ff 	movabs $0xffffffffffffcea0,%r8
+  8058ef:	ff ff ff 
+  8058f2:	49 01 c0             	add    %rax,%r8
+  8058f5:	41 ff d0             	call   *%r8
+}
+  8058f8:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8058fc:	c9                   	leave
+  8058fd:	c3                   	ret
+
+00000000008058fe <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8058fe:	55                   	push   %rbp
+  8058ff:	48 89 e5             	mov    %rsp,%rbp
+  805902:	41 57                	push   %r15
+  805904:	48 83 ec 18          	sub    $0x18,%rsp
+  805908:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805908 <devsock_stat+0xa>
+  80590f:	49 bb 38 37 00 00 00 	movabs $0x3738,%r11
+  805916:	00 00 00 
+  805919:	4c 01 d8             	add    %r11,%rax
+  80591c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805920:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805924:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805928:	48 b9 74 e5 ff ff ff 	movabs $0xffffffffffffe574,%rcx
+  80592f:	ff ff ff 
+  805932:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805936:	48 89 ce             	mov    %rcx,%rsi
+  805939:	48 89 d7             	mov    %rdx,%rdi
+  80593c:	49 89 c7             	mov    %rax,%r15
+  80593f:	48 ba 6f 85 ff ff ff 	movabs $0xffffffffffff856f,%rdx
+  805946:	ff ff ff 
+  805949:	48 01 c2             	add    %rax,%rdx
+  80594c:	ff d2                	call   *%rdx
+	return 0;
+  80594e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805953:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  805957:	c9                   	leave
+  805958:	c3                   	ret
+
+0000000000805959 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  805959:	55                   	push   %rbp
+  80595a:	48 89 e5             	mov    %rsp,%rbp
+  80595d:	41 57                	push   %r15
+  80595f:	53                   	push   %rbx
+  805960:	48 83 ec 20          	sub    $0x20,%rsp
+  805964:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805964 <socket+0xb>
+  80596b:	49 bb dc 36 00 00 00 	movabs $0x36dc,%r11
+  805972:	00 00 00 
+  805975:	4c 01 db             	add    %r11,%rbx
+  805978:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80597b:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  80597e:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  805981:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  805984:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  805987:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80598a:	89 ce                	mov    %ecx,%esi
+  80598c:	89 c7                	mov    %eax,%edi
+  80598e:	49 89 df             	mov    %rbx,%r15
+  805991:	48 b8 77 d0 ff ff ff 	movabs $0xffffffffffffd077,%rax
+  805998:	ff ff ff 
+  80599b:	48 01 d8             	add    %rbx,%rax
+  80599e:	ff d0                	call   *%rax
+  8059a0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8059a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059a7:	79 05                	jns    8059ae <socket+0x55>
+		return r;
+  8059a9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059ac:	eb 15                	jmp    8059c3 <socket+0x6a>
+	return alloc_sockfd(r);
+  8059ae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059b1:	89 c7                	mov    %eax,%edi
+  8059b3:	48 b8 61 c4 ff ff ff 	movabs $0xffffffffffffc461,%rax
+  8059ba:	ff ff ff 
+  8059bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8059c1:	ff d0                	call   *%rax
+}
+  8059c3:	48 83 c4 20          	add    $0x20,%rsp
+  8059c7:	5b                   	pop    %rbx
+  8059c8:	41 5f                	pop    %r15
+  8059ca:	5d                   	pop    %rbp
+  8059cb:	c3                   	ret
+
+00000000008059cc <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8059cc:	55                   	push   %rbp
+  8059cd:	48 89 e5             	mov    %rsp,%rbp
+  8059d0:	41 57                	push   %r15
+  8059d2:	53                   	push   %rbx
+  8059d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8059d7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059d7 <nsipc+0xb>
+  8059de:	49 bb 69 36 00 00 00 	movabs $0x3669,%r11
+  8059e5:	00 00 00 
+  8059e8:	4c 01 db             	add    %r11,%rbx
+  8059eb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  8059ee:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8059f5:	00 00 00 
+  8059f8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8059fb:	85 c0                	test   %eax,%eax
+  8059fd:	75 24                	jne    805a23 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8059ff:	bf 02 00 00 00       	mov    $0x2,%edi
+  805a04:	49 89 df             	mov    %rbx,%r15
+  805a07:	48 b8 9d ac ff ff ff 	movabs $0xffffffffffffac9d,%rax
+  805a0e:	ff ff ff 
+  805a11:	48 01 d8             	add    %rbx,%rax
+  805a14:	ff d0                	call   *%rax
+  805a16:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805a1d:	00 00 00 
+  805a20:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805a23:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805a2a:	00 00 00 
+  805a2d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805a30:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805a33:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805a39:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805a3f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805a44:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805a4b:	00 00 00 
+  805a4e:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805a52:	89 c7                	mov    %eax,%edi
+  805a54:	49 89 df             	mov    %rbx,%r15
+  805a57:	48 b8 bc a6 ff ff ff 	movabs $0xffffffffffffa6bc,%rax
+  805a5e:	ff ff ff 
+  805a61:	48 01 d8             	add    %rbx,%rax
+  805a64:	ff d0                	call   *%rax
+}
+  805a66:	48 83 c4 10          	add    $0x10,%rsp
+  805a6a:	5b                   	pop    %rbx
+  805a6b:	41 5f                	pop    %r15
+  805a6d:	5d                   	pop    %rbp
+  805a6e:	c3                   	ret
+
+0000000000805a6f <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805a6f:	55                   	push   %rbp
+  805a70:	48 89 e5             	mov    %rsp,%rbp
+  805a73:	41 57                	push   %r15
+  805a75:	53                   	push   %rbx
+  805a76:	48 83 ec 20          	sub    $0x20,%rsp
+  805a7a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a7a <nsipc_words+0xb>
+  805a81:	49 bb c6 35 00 00 00 	movabs $0x35c6,%r11
+  805a88:	00 00 00 
+  805a8b:	4c 01 db             	add    %r11,%rbx
+  805a8e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805a91:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805a95:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805a99:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805aa0:	00 00 00 
+  805aa3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805aa6:	85 c0                	test   %eax,%eax
+  805aa8:	75 24                	jne    805ace <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805aaa:	bf 02 00 00 00       	mov    $0x2,%edi
+  805aaf:	49 89 df             	mov    %rbx,%r15
+  805ab2:	48 b8 9d ac ff ff ff 	movabs $0xffffffffffffac9d,%rax
+  805ab9:	ff ff ff 
+  805abc:	48 01 d8             	add    %rbx,%rax
+  805abf:	ff d0                	call   *%rax
+  805ac1:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805ac8:	00 00 00 
+  805acb:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805ace:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805ad5:	00 00 00 
+  805ad8:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805adb:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805adf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ae3:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805ae6:	89 c7                	mov    %eax,%edi
+  805ae8:	49 89 df             	mov    %rbx,%r15
+  805aeb:	48 b8 a7 a7 ff ff ff 	movabs $0xffffffffffffa7a7,%rax
+  805af2:	ff ff ff 
+  805af5:	48 01 d8             	add    %rbx,%rax
+  805af8:	ff d0                	call   *%rax
+}
+  805afa:	48 83 c4 20          	add    $0x20,%rsp
+  805afe:	5b                   	pop    %rbx
+  805aff:	41 5f                	pop    %r15
+  805b01:	5d                   	pop    %rbp
+  805b02:	c3                   	ret
+
+0000000000805b03 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805b03:	55                   	push   %rbp
+  805b04:	48 89 e5             	mov    %rsp,%rbp
+  805b07:	41 57                	push   %r15
+  805b09:	53                   	push   %rbx
+  805b0a:	48 83 ec 30          	sub    $0x30,%rsp
+  805b0e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b0e <nsipc_accept+0xb>
+  805b15:	49 bb 32 35 00 00 00 	movabs $0x3532,%r11
+  805b1c:	00 00 00 
+  805b1f:	4c 01 db             	add    %r11,%rbx
+  805b22:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805b25:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805b29:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805b2d:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b34:	00 00 00 
+  805b37:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b3a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805b3d:	bf 01 00 00 00       	mov    $0x1,%edi
+  805b42:	48 b8 8c c9 ff ff ff 	movabs $0xffffffffffffc98c,%rax
+  805b49:	ff ff ff 
+  805b4c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b50:	ff d0                	call   *%rax
+  805b52:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b55:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b59:	78 48                	js     805ba3 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805b5b:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805b62:	00 00 00 
+  805b65:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805b69:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805b6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b71:	8b 40 10             	mov    0x10(%rax),%eax
+  805b74:	89 c2                	mov    %eax,%edx
+  805b76:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805b7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805b7e:	48 89 ce             	mov    %rcx,%rsi
+  805b81:	48 89 c7             	mov    %rax,%rdi
+  805b84:	49 89 df             	mov    %rbx,%r15
+  805b87:	48 b8 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rax
+  805b8e:	ff ff ff 
+  805b91:	48 01 d8             	add    %rbx,%rax
+  805b94:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805b96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b9a:	8b 50 10             	mov    0x10(%rax),%edx
+  805b9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ba1:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805ba3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805ba6:	48 83 c4 30          	add    $0x30,%rsp
+  805baa:	5b                   	pop    %rbx
+  805bab:	41 5f                	pop    %r15
+  805bad:	5d                   	pop    %rbp
+  805bae:	c3                   	ret
+
+0000000000805baf <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805baf:	55                   	push   %rbp
+  805bb0:	48 89 e5             	mov    %rsp,%rbp
+  805bb3:	41 57                	push   %r15
+  805bb5:	53                   	push   %rbx
+  805bb6:	48 83 ec 10          	sub    $0x10,%rsp
+  805bba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805bba <nsipc_bind+0xb>
+  805bc1:	49 bb 86 34 00 00 00 	movabs $0x3486,%r11
+  805bc8:	00 00 00 
+  805bcb:	4c 01 db             	add    %r11,%rbx
+  805bce:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805bd1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805bd5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805bd8:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805bdf:	00 00 00 
+  805be2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805be5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805be8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805beb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bef:	48 89 c6             	mov    %rax,%rsi
+  805bf2:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805bf9:	00 00 00 
+  805bfc:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c00:	48 89 c7             	mov    %rax,%rdi
+  805c03:	49 89 df             	mov    %rbx,%r15
+  805c06:	48 b8 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rax
+  805c0d:	ff ff ff 
+  805c10:	48 01 d8             	add    %rbx,%rax
+  805c13:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805c15:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c1c:	00 00 00 
+  805c1f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805c22:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805c26:	bf 02 00 00 00       	mov    $0x2,%edi
+  805c2b:	48 b8 8c c9 ff ff ff 	movabs $0xffffffffffffc98c,%rax
+  805c32:	ff ff ff 
+  805c35:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c39:	ff d0                	call   *%rax
+}
+  805c3b:	48 83 c4 10          	add    $0x10,%rsp
+  805c3f:	5b                   	pop    %rbx
+  805c40:	41 5f                	pop    %r15
+  805c42:	5d                   	pop    %rbp
+  805c43:	c3                   	ret
+
+0000000000805c44 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805c44:	55                   	push   %rbp
+  805c45:	48 89 e5             	mov    %rsp,%rbp
+  805c48:	48 83 ec 20          	sub    $0x20,%rsp
+  805c4c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805c4c <nsipc_shutdown+0x8>
+  805c53:	49 bb f4 33 00 00 00 	movabs $0x33f4,%r11
+  805c5a:	00 00 00 
+  805c5d:	4c 01 d8             	add    %r11,%rax
+  805c60:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c63:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805c66:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805c69:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805c6c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805c6f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805c72:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805c76:	ba 08 00 00 00       	mov    $0x8,%edx
+  805c7b:	48 89 ce             	mov    %rcx,%rsi
+  805c7e:	bf 03 00 00 00       	mov    $0x3,%edi
+  805c83:	48 b9 2f ca ff ff ff 	movabs $0xffffffffffffca2f,%rcx
+  805c8a:	ff ff ff 
+  805c8d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805c91:	ff d0                	call   *%rax
+}
+  805c93:	c9                   	leave
+  805c94:	c3                   	ret
+
+0000000000805c95 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805c95:	55                   	push   %rbp
+  805c96:	48 89 e5             	mov    %rsp,%rbp
+  805c99:	48 83 ec 20          	sub    $0x20,%rsp
+  805c9d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805c9d <nsipc_close+0x8>
+  805ca4:	49 bb a3 33 00 00 00 	movabs $0x33a3,%r11
+  805cab:	00 00 00 
+  805cae:	4c 01 d8             	add    %r11,%rax
+  805cb1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805cb4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805cb7:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805cba:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805cbe:	ba 04 00 00 00       	mov    $0x4,%edx
+  805cc3:	48 89 ce             	mov    %rcx,%rsi
+  805cc6:	bf 04 00 00 00       	mov    $0x4,%edi
+  805ccb:	48 b9 2f ca ff ff ff 	movabs $0xffffffffffffca2f,%rcx
+  805cd2:	ff ff ff 
+  805cd5:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805cd9:	ff d0                	call   *%rax
+}
+  805cdb:	c9                   	leave
+  805cdc:	c3                   	ret
+
+0000000000805cdd <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805cdd:	55                   	push   %rbp
+  805cde:	48 89 e5             	mov    %rsp,%rbp
+  805ce1:	41 57                	push   %r15
+  805ce3:	53                   	push   %rbx
+  805ce4:	48 83 ec 10          	sub    $0x10,%rsp
+  805ce8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ce8 <nsipc_connect+0xb>
+  805cef:	49 bb 58 33 00 00 00 	movabs $0x3358,%r11
+  805cf6:	00 00 00 
+  805cf9:	4c 01 db             	add    %r11,%rbx
+  805cfc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805cff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805d03:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805d06:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805d0d:	00 00 00 
+  805d10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d13:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805d16:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d1d:	48 89 c6             	mov    %rax,%rsi
+  805d20:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805d27:	00 00 00 
+  805d2a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d2e:	48 89 c7             	mov    %rax,%rdi
+  805d31:	49 89 df             	mov    %rbx,%r15
+  805d34:	48 b8 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rax
+  805d3b:	ff ff ff 
+  805d3e:	48 01 d8             	add    %rbx,%rax
+  805d41:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805d43:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805d4a:	00 00 00 
+  805d4d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805d50:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805d54:	bf 05 00 00 00       	mov    $0x5,%edi
+  805d59:	48 b8 8c c9 ff ff ff 	movabs $0xffffffffffffc98c,%rax
+  805d60:	ff ff ff 
+  805d63:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d67:	ff d0                	call   *%rax
+}
+  805d69:	48 83 c4 10          	add    $0x10,%rsp
+  805d6d:	5b                   	pop    %rbx
+  805d6e:	41 5f                	pop    %r15
+  805d70:	5d                   	pop    %rbp
+  805d71:	c3                   	ret
+
+0000000000805d72 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805d72:	55                   	push   %rbp
+  805d73:	48 89 e5             	mov    %rsp,%rbp
+  805d76:	48 83 ec 20          	sub    $0x20,%rsp
+  805d7a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805d7a <nsipc_listen+0x8>
+  805d81:	49 bb c6 32 00 00 00 	movabs $0x32c6,%r11
+  805d88:	00 00 00 
+  805d8b:	4c 01 d8             	add    %r11,%rax
+  805d8e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805d91:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805d94:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805d97:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805d9a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d9d:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805da0:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805da4:	ba 08 00 00 00       	mov    $0x8,%edx
+  805da9:	48 89 ce             	mov    %rcx,%rsi
+  805dac:	bf 06 00 00 00       	mov    $0x6,%edi
+  805db1:	48 b9 2f ca ff ff ff 	movabs $0xffffffffffffca2f,%rcx
+  805db8:	ff ff ff 
+  805dbb:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805dbf:	ff d0                	call   *%rax
+}
+  805dc1:	c9                   	leave
+  805dc2:	c3                   	ret
+
+0000000000805dc3 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805dc3:	55                   	push   %rbp
+  805dc4:	48 89 e5             	mov    %rsp,%rbp
+  805dc7:	41 57                	push   %r15
+  805dc9:	53                   	push   %rbx
+  805dca:	48 83 ec 30          	sub    $0x30,%rsp
+  805dce:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805dce <nsipc_recv+0xb>
+  805dd5:	49 bb 72 32 00 00 00 	movabs $0x3272,%r11
+  805ddc:	00 00 00 
+  805ddf:	4c 01 db             	add    %r11,%rbx
+  805de2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805de5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805de9:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805dec:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805def:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805df6:	00 00 00 
+  805df9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805dfc:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805dff:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805e06:	00 00 00 
+  805e09:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805e0c:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805e10:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805e17:	00 00 00 
+  805e1a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805e1d:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805e21:	bf 07 00 00 00       	mov    $0x7,%edi
+  805e26:	48 b8 8c c9 ff ff ff 	movabs $0xffffffffffffc98c,%rax
+  805e2d:	ff ff ff 
+  805e30:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e34:	ff d0                	call   *%rax
+  805e36:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e39:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e3d:	0f 88 91 00 00 00    	js     805ed4 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805e43:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805e4a:	7f 08                	jg     805e54 <nsipc_recv+0x91>
+  805e4c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e4f:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805e52:	7e 50                	jle    805ea4 <nsipc_recv+0xe1>
+  805e54:	48 b8 7b e5 ff ff ff 	movabs $0xffffffffffffe57b,%rax
+  805e5b:	ff ff ff 
+  805e5e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e62:	48 89 c1             	mov    %rax,%rcx
+  805e65:	48 b8 90 e5 ff ff ff 	movabs $0xffffffffffffe590,%rax
+  805e6c:	ff ff ff 
+  805e6f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e73:	48 89 c2             	mov    %rax,%rdx
+  805e76:	be 79 00 00 00       	mov    $0x79,%esi
+  805e7b:	48 b8 a5 e5 ff ff ff 	movabs $0xffffffffffffe5a5,%rax
+  805e82:	ff ff ff 
+  805e85:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e89:	48 89 c7             	mov    %rax,%rdi
+  805e8c:	49 89 df             	mov    %rbx,%r15
+  805e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e94:	49 b8 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%r8
+  805e9b:	ff ff ff 
+  805e9e:	49 01 d8             	add    %rbx,%r8
+  805ea1:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805ea4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ea7:	48 63 d0             	movslq %eax,%rdx
+  805eaa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805eae:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805eb5:	00 00 00 
+  805eb8:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805ebc:	48 89 ce             	mov    %rcx,%rsi
+  805ebf:	48 89 c7             	mov    %rax,%rdi
+  805ec2:	49 89 df             	mov    %rbx,%r15
+  805ec5:	48 b8 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rax
+  805ecc:	ff ff ff 
+  805ecf:	48 01 d8             	add    %rbx,%rax
+  805ed2:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805ed4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805ed7:	48 83 c4 30          	add    $0x30,%rsp
+  805edb:	5b                   	pop    %rbx
+  805edc:	41 5f                	pop    %r15
+  805ede:	5d                   	pop    %rbp
+  805edf:	c3                   	ret
+
+0000000000805ee0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805ee0:	55                   	push   %rbp
+  805ee1:	48 89 e5             	mov    %rsp,%rbp
+  805ee4:	41 57                	push   %r15
+  805ee6:	53                   	push   %rbx
+  805ee7:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805eee:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805eee <nsipc_send+0xe>
+  805ef5:	49 bb 52 31 00 00 00 	movabs $0x3152,%r11
+  805efc:	00 00 00 
+  805eff:	4c 01 db             	add    %r11,%rbx
+  805f02:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805f08:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805f0f:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805f15:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805f1b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805f1f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805f23:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805f2a:	00 00 00 
+  805f2d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805f30:	85 c0                	test   %eax,%eax
+  805f32:	75 24                	jne    805f58 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805f34:	bf 02 00 00 00       	mov    $0x2,%edi
+  805f39:	49 89 df             	mov    %rbx,%r15
+  805f3c:	48 b8 9d ac ff ff ff 	movabs $0xffffffffffffac9d,%rax
+  805f43:	ff ff ff 
+  805f46:	48 01 d8             	add    %rbx,%rax
+  805f49:	ff d0                	call   *%rax
+  805f4b:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805f52:	00 00 00 
+  805f55:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805f58:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805f5e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805f61:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805f68:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805f6b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805f6e:	39 c2                	cmp    %eax,%edx
+  805f70:	0f 4e c2             	cmovle %edx,%eax
+  805f73:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805f79:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805f7f:	48 63 d0             	movslq %eax,%rdx
+  805f82:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805f89:	48 89 c6             	mov    %rax,%rsi
+  805f8c:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805f93:	00 00 00 
+  805f96:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805f9a:	48 89 c7             	mov    %rax,%rdi
+  805f9d:	49 89 df             	mov    %rbx,%r15
+  805fa0:	48 b8 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rax
+  805fa7:	ff ff ff 
+  805faa:	48 01 d8             	add    %rbx,%rax
+  805fad:	ff d0                	call   *%rax
+	req->req_s = s;
+  805faf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fb3:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  805fb9:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  805fbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fbf:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  805fc5:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  805fc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fcc:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  805fd2:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  805fd5:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805fdc:	00 00 00 
+  805fdf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805fe3:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  805fe7:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  805fee:	00 
+  805fef:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805ff5:	48 63 d0             	movslq %eax,%rdx
+  805ff8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805ffc:	48 01 d0             	add    %rdx,%rax
+  805fff:	48 83 e8 01          	sub    $0x1,%rax
+  806003:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  806007:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80600b:	ba 00 00 00 00       	mov    $0x0,%edx
+  806010:	48 f7 75 d8          	divq   -0x28(%rbp)
+  806014:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806018:	48 29 d0             	sub    %rdx,%rax
+  80601b:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  806021:	85 c0                	test   %eax,%eax
+  806023:	0f 48 c2             	cmovs  %edx,%eax
+  806026:	c1 f8 0c             	sar    $0xc,%eax
+  806029:	48 98                	cltq
+  80602b:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  80602f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806033:	48 85 c0             	test   %rax,%rax
+  806036:	0f 95 c0             	setne  %al
+  806039:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  80603c:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  806043:	00 
+  806044:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806048:	48 83 c0 0b          	add    $0xb,%rax
+  80604c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  806050:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806054:	ba 00 00 00 00       	mov    $0x0,%edx
+  806059:	48 f7 75 c8          	divq   -0x38(%rbp)
+  80605d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806061:	48 29 d0             	sub    %rdx,%rax
+  806064:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806068:	89 c7                	mov    %eax,%edi
+  80606a:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  806071:	00 00 00 
+  806074:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806077:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  80607b:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  80607f:	48 83 ec 08          	sub    $0x8,%rsp
+  806083:	6a 00                	push   $0x0
+  806085:	6a 00                	push   $0x0
+  806087:	6a 05                	push   $0x5
+  806089:	41 89 f1             	mov    %esi,%r9d
+  80608c:	49 89 c8             	mov    %rcx,%r8
+  80608f:	89 f9                	mov    %edi,%ecx
+  806091:	be 08 00 00 00       	mov    $0x8,%esi
+  806096:	89 c7                	mov    %eax,%edi
+  806098:	49 89 df             	mov    %rbx,%r15
+  80609b:	48 b8 a5 a8 ff ff ff 	movabs $0xffffffffffffa8a5,%rax
+  8060a2:	ff ff ff 
+  8060a5:	48 01 d8             	add    %rbx,%rax
+  8060a8:	ff d0                	call   *%rax
+  8060aa:	48 83 c4 20          	add    $0x20,%rsp
+}
+  8060ae:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8060b2:	5b                   	pop    %rbx
+  8060b3:	41 5f                	pop    %r15
+  8060b5:	5d                   	pop    %rbp
+  8060b6:	c3                   	ret
+
+00000000008060b7 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8060b7:	55                   	push   %rbp
+  8060b8:	48 89 e5             	mov    %rsp,%rbp
+  8060bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8060bf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8060bf <nsipc_socket+0x8>
+  8060c6:	49 bb 81 2f 00 00 00 	movabs $0x2f81,%r11
+  8060cd:	00 00 00 
+  8060d0:	4c 01 d8             	add    %r11,%rax
+  8060d3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8060d6:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  8060d9:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  8060dc:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8060e3:	00 00 00 
+  8060e6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8060e9:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  8060ec:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  8060f3:	00 00 00 
+  8060f6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8060f9:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  8060fd:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  806104:	00 00 00 
+  806107:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80610a:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  80610e:	bf 09 00 00 00       	mov    $0x9,%edi
+  806113:	48 ba 8c c9 ff ff ff 	movabs $0xffffffffffffc98c,%rdx
+  80611a:	ff ff ff 
+  80611d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806121:	ff d0                	call   *%rax
+}
+  806123:	c9                   	leave
+  806124:	c3                   	ret
+
+0000000000806125 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  806125:	55                   	push   %rbp
+  806126:	48 89 e5             	mov    %rsp,%rbp
+  806129:	41 57                	push   %r15
+  80612b:	53                   	push   %rbx
+  80612c:	48 83 ec 30          	sub    $0x30,%rsp
+  806130:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806130 <pipe+0xb>
+  806137:	49 bb 10 2f 00 00 00 	movabs $0x2f10,%r11
+  80613e:	00 00 00 
+  806141:	4c 01 db             	add    %r11,%rbx
+  806144:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  806148:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  80614c:	48 89 c7             	mov    %rax,%rdi
+  80614f:	49 89 df             	mov    %rbx,%r15
+  806152:	48 b8 a6 ad ff ff ff 	movabs $0xffffffffffffada6,%rax
+  806159:	ff ff ff 
+  80615c:	48 01 d8             	add    %rbx,%rax
+  80615f:	ff d0                	call   *%rax
+  806161:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806164:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806168:	0f 88 12 02 00 00    	js     806380 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80616e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806172:	ba 07 04 00 00       	mov    $0x407,%edx
+  806177:	48 89 c6             	mov    %rax,%rsi
+  80617a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80617f:	49 89 df             	mov    %rbx,%r15
+  806182:	48 b8 2b 92 ff ff ff 	movabs $0xffffffffffff922b,%rax
+  806189:	ff ff ff 
+  80618c:	48 01 d8             	add    %rbx,%rax
+  80618f:	ff d0                	call   *%rax
+  806191:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806194:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806198:	0f 88 e2 01 00 00    	js     806380 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  80619e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8061a2:	48 89 c7             	mov    %rax,%rdi
+  8061a5:	49 89 df             	mov    %rbx,%r15
+  8061a8:	48 b8 a6 ad ff ff ff 	movabs $0xffffffffffffada6,%rax
+  8061af:	ff ff ff 
+  8061b2:	48 01 d8             	add    %rbx,%rax
+  8061b5:	ff d0                	call   *%rax
+  8061b7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061ba:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061be:	0f 88 9b 01 00 00    	js     80635f <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8061c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8061c8:	ba 07 04 00 00       	mov    $0x407,%edx
+  8061cd:	48 89 c6             	mov    %rax,%rsi
+  8061d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061d5:	49 89 df             	mov    %rbx,%r15
+  8061d8:	48 b8 2b 92 ff ff ff 	movabs $0xffffffffffff922b,%rax
+  8061df:	ff ff ff 
+  8061e2:	48 01 d8             	add    %rbx,%rax
+  8061e5:	ff d0                	call   *%rax
+  8061e7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061ee:	0f 88 6b 01 00 00    	js     80635f <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  8061f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8061f8:	48 89 c7             	mov    %rax,%rdi
+  8061fb:	49 89 df             	mov    %rbx,%r15
+  8061fe:	48 b8 63 ad ff ff ff 	movabs $0xffffffffffffad63,%rax
+  806205:	ff ff ff 
+  806208:	48 01 d8             	add    %rbx,%rax
+  80620b:	ff d0                	call   *%rax
+  80620d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806211:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806215:	ba 07 04 00 00       	mov    $0x407,%edx
+  80621a:	48 89 c6             	mov    %rax,%rsi
+  80621d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806222:	49 89 df             	mov    %rbx,%r15
+  806225:	48 b8 2b 92 ff ff ff 	movabs $0xffffffffffff922b,%rax
+  80622c:	ff ff ff 
+  80622f:	48 01 d8             	add    %rbx,%rax
+  806232:	ff d0                	call   *%rax
+  806234:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806237:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80623b:	0f 88 fd 00 00 00    	js     80633e <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806241:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806245:	48 89 c7             	mov    %rax,%rdi
+  806248:	49 89 df             	mov    %rbx,%r15
+  80624b:	48 b8 63 ad ff ff ff 	movabs $0xffffffffffffad63,%rax
+  806252:	ff ff ff 
+  806255:	48 01 d8             	add    %rbx,%rax
+  806258:	ff d0                	call   *%rax
+  80625a:	48 89 c2             	mov    %rax,%rdx
+  80625d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806261:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  806267:	48 89 d1             	mov    %rdx,%rcx
+  80626a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80626f:	48 89 c6             	mov    %rax,%rsi
+  806272:	bf 00 00 00 00       	mov    $0x0,%edi
+  806277:	49 89 df             	mov    %rbx,%r15
+  80627a:	48 b8 90 92 ff ff ff 	movabs $0xffffffffffff9290,%rax
+  806281:	ff ff ff 
+  806284:	48 01 d8             	add    %rbx,%rax
+  806287:	ff d0                	call   *%rax
+  806289:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80628c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806290:	0f 88 87 00 00 00    	js     80631d <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  806296:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80629a:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8062a1:	00 00 00 
+  8062a4:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8062a7:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  8062a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062ad:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  8062b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062b8:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  8062bf:	00 00 00 
+  8062c2:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  8062c5:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  8062c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062cb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  8062d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062d6:	48 89 c7             	mov    %rax,%rdi
+  8062d9:	49 89 df             	mov    %rbx,%r15
+  8062dc:	48 b8 2c ad ff ff ff 	movabs $0xffffffffffffad2c,%rax
+  8062e3:	ff ff ff 
+  8062e6:	48 01 d8             	add    %rbx,%rax
+  8062e9:	ff d0                	call   *%rax
+  8062eb:	89 c2                	mov    %eax,%edx
+  8062ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8062f1:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  8062f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062f7:	48 89 c7             	mov    %rax,%rdi
+  8062fa:	49 89 df             	mov    %rbx,%r15
+  8062fd:	48 b8 2c ad ff ff ff 	movabs $0xffffffffffffad2c,%rax
+  806304:	ff ff ff 
+  806307:	48 01 d8             	add    %rbx,%rax
+  80630a:	ff d0                	call   *%rax
+  80630c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806310:	48 83 c2 04          	add    $0x4,%rdx
+  806314:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  806316:	b8 00 00 00 00       	mov    $0x0,%eax
+  80631b:	eb 67                	jmp    806384 <pipe+0x25f>
+		goto err3;
+  80631d:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80631e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806322:	48 89 c6             	mov    %rax,%rsi
+  806325:	bf 00 00 00 00       	mov    $0x0,%edi
+  80632a:	49 89 df             	mov    %rbx,%r15
+  80632d:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  806334:	ff ff ff 
+  806337:	48 01 d8             	add    %rbx,%rax
+  80633a:	ff d0                	call   *%rax
+  80633c:	eb 01                	jmp    80633f <pipe+0x21a>
+		goto err2;
+  80633e:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80633f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806343:	48 89 c6             	mov    %rax,%rsi
+  806346:	bf 00 00 00 00       	mov    $0x0,%edi
+  80634b:	49 89 df             	mov    %rbx,%r15
+  80634e:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  806355:	ff ff ff 
+  806358:	48 01 d8             	add    %rbx,%rax
+  80635b:	ff d0                	call   *%rax
+  80635d:	eb 01                	jmp    806360 <pipe+0x23b>
+		goto err1;
+  80635f:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  806360:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806364:	48 89 c6             	mov    %rax,%rsi
+  806367:	bf 00 00 00 00       	mov    $0x0,%edi
+  80636c:	49 89 df             	mov    %rbx,%r15
+  80636f:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  806376:	ff ff ff 
+  806379:	48 01 d8             	add    %rbx,%rax
+  80637c:	ff d0                	call   *%rax
+  80637e:	eb 01                	jmp    806381 <pipe+0x25c>
+		goto err;
+  806380:	90                   	nop
+err:
+	return r;
+  806381:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806384:	48 83 c4 30          	add    $0x30,%rsp
+  806388:	5b                   	pop    %rbx
+  806389:	41 5f                	pop    %r15
+  80638b:	5d                   	pop    %rbp
+  80638c:	c3                   	ret
+
+000000000080638d <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80638d:	55                   	push   %rbp
+  80638e:	48 89 e5             	mov    %rsp,%rbp
+  806391:	41 57                	push   %r15
+  806393:	41 54                	push   %r12
+  806395:	53                   	push   %rbx
+  806396:	48 83 ec 28          	sub    $0x28,%rsp
+  80639a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80639a <_pipeisclosed+0xd>
+  8063a1:	49 bb a6 2c 00 00 00 	movabs $0x2ca6,%r11
+  8063a8:	00 00 00 
+  8063ab:	4c 01 db             	add    %r11,%rbx
+  8063ae:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8063b2:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8063b6:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8063bd:	ff ff ff 
+  8063c0:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8063c4:	48 8b 00             	mov    (%rax),%rax
+  8063c7:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8063cd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  8063d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063d4:	48 89 c7             	mov    %rax,%rdi
+  8063d7:	49 89 df             	mov    %rbx,%r15
+  8063da:	48 b8 b7 dd ff ff ff 	movabs $0xffffffffffffddb7,%rax
+  8063e1:	ff ff ff 
+  8063e4:	48 01 d8             	add    %rbx,%rax
+  8063e7:	ff d0                	call   *%rax
+  8063e9:	41 89 c4             	mov    %eax,%r12d
+  8063ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8063f0:	48 89 c7             	mov    %rax,%rdi
+  8063f3:	49 89 df             	mov    %rbx,%r15
+  8063f6:	48 b8 b7 dd ff ff ff 	movabs $0xffffffffffffddb7,%rax
+  8063fd:	ff ff ff 
+  806400:	48 01 d8             	add    %rbx,%rax
+  806403:	ff d0                	call   *%rax
+  806405:	41 39 c4             	cmp    %eax,%r12d
+  806408:	0f 94 c0             	sete   %al
+  80640b:	0f b6 c0             	movzbl %al,%eax
+  80640e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806411:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806418:	ff ff ff 
+  80641b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80641f:	48 8b 00             	mov    (%rax),%rax
+  806422:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806428:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80642b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80642e:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806431:	75 05                	jne    806438 <_pipeisclosed+0xab>
+			return ret;
+  806433:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806436:	eb 63                	jmp    80649b <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  806438:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80643b:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80643e:	0f 84 72 ff ff ff    	je     8063b6 <_pipeisclosed+0x29>
+  806444:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  806448:	0f 85 68 ff ff ff    	jne    8063b6 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80644e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806455:	ff ff ff 
+  806458:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80645c:	48 8b 00             	mov    (%rax),%rax
+  80645f:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  806465:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  806468:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80646b:	89 c6                	mov    %eax,%esi
+  80646d:	48 b8 b6 e5 ff ff ff 	movabs $0xffffffffffffe5b6,%rax
+  806474:	ff ff ff 
+  806477:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80647b:	48 89 c7             	mov    %rax,%rdi
+  80647e:	49 89 df             	mov    %rbx,%r15
+  806481:	b8 00 00 00 00       	mov    $0x0,%eax
+  806486:	49 b8 ad 77 ff ff ff 	movabs $0xffffffffffff77ad,%r8
+  80648d:	ff ff ff 
+  806490:	49 01 d8             	add    %rbx,%r8
+  806493:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  806496:	e9 1b ff ff ff       	jmp    8063b6 <_pipeisclosed+0x29>
+	}
+}
+  80649b:	48 83 c4 28          	add    $0x28,%rsp
+  80649f:	5b                   	pop    %rbx
+  8064a0:	41 5c                	pop    %r12
+  8064a2:	41 5f                	pop    %r15
+  8064a4:	5d                   	pop    %rbp
+  8064a5:	c3                   	ret
+
+00000000008064a6 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  8064a6:	55                   	push   %rbp
+  8064a7:	48 89 e5             	mov    %rsp,%rbp
+  8064aa:	41 57                	push   %r15
+  8064ac:	53                   	push   %rbx
+  8064ad:	48 83 ec 30          	sub    $0x30,%rsp
+  8064b1:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8064b1 <pipeisclosed+0xb>
+  8064b8:	49 bb 8f 2b 00 00 00 	movabs $0x2b8f,%r11
+  8064bf:	00 00 00 
+  8064c2:	4c 01 db             	add    %r11,%rbx
+  8064c5:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8064c8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8064cc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8064cf:	48 89 d6             	mov    %rdx,%rsi
+  8064d2:	89 c7                	mov    %eax,%edi
+  8064d4:	49 89 df             	mov    %rbx,%r15
+  8064d7:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  8064de:	ff ff ff 
+  8064e1:	48 01 d8             	add    %rbx,%rax
+  8064e4:	ff d0                	call   *%rax
+  8064e6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8064e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8064ed:	79 05                	jns    8064f4 <pipeisclosed+0x4e>
+		return r;
+  8064ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064f2:	eb 3b                	jmp    80652f <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  8064f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8064f8:	48 89 c7             	mov    %rax,%rdi
+  8064fb:	49 89 df             	mov    %rbx,%r15
+  8064fe:	48 b8 63 ad ff ff ff 	movabs $0xffffffffffffad63,%rax
+  806505:	ff ff ff 
+  806508:	48 01 d8             	add    %rbx,%rax
+  80650b:	ff d0                	call   *%rax
+  80650d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806511:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806515:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806519:	48 89 d6             	mov    %rdx,%rsi
+  80651c:	48 89 c7             	mov    %rax,%rdi
+  80651f:	48 b8 4d d3 ff ff ff 	movabs $0xffffffffffffd34d,%rax
+  806526:	ff ff ff 
+  806529:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80652d:	ff d0                	call   *%rax
+}
+  80652f:	48 83 c4 30          	add    $0x30,%rsp
+  806533:	5b                   	pop    %rbx
+  806534:	41 5f                	pop    %r15
+  806536:	5d                   	pop    %rbp
+  806537:	c3                   	ret
+
+0000000000806538 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806538:	55                   	push   %rbp
+  806539:	48 89 e5             	mov    %rsp,%rbp
+  80653c:	41 57                	push   %r15
+  80653e:	53                   	push   %rbx
+  80653f:	48 83 ec 40          	sub    $0x40,%rsp
+  806543:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806543 <devpipe_read+0xb>
+  80654a:	49 bb fd 2a 00 00 00 	movabs $0x2afd,%r11
+  806551:	00 00 00 
+  806554:	4c 01 db             	add    %r11,%rbx
+  806557:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80655b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80655f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  806563:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806567:	48 89 c7             	mov    %rax,%rdi
+  80656a:	49 89 df             	mov    %rbx,%r15
+  80656d:	48 b8 63 ad ff ff ff 	movabs $0xffffffffffffad63,%rax
+  806574:	ff ff ff 
+  806577:	48 01 d8             	add    %rbx,%rax
+  80657a:	ff d0                	call   *%rax
+  80657c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806580:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806584:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  806588:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80658f:	00 
+  806590:	e9 a1 00 00 00       	jmp    806636 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  806595:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80659a:	74 09                	je     8065a5 <devpipe_read+0x6d>
+				return i;
+  80659c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065a0:	e9 9f 00 00 00       	jmp    806644 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  8065a5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8065a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8065ad:	48 89 d6             	mov    %rdx,%rsi
+  8065b0:	48 89 c7             	mov    %rax,%rdi
+  8065b3:	48 b8 4d d3 ff ff ff 	movabs $0xffffffffffffd34d,%rax
+  8065ba:	ff ff ff 
+  8065bd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8065c1:	ff d0                	call   *%rax
+  8065c3:	85 c0                	test   %eax,%eax
+  8065c5:	74 07                	je     8065ce <devpipe_read+0x96>
+				return 0;
+  8065c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065cc:	eb 76                	jmp    806644 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  8065ce:	49 89 df             	mov    %rbx,%r15
+  8065d1:	48 b8 d6 91 ff ff ff 	movabs $0xffffffffffff91d6,%rax
+  8065d8:	ff ff ff 
+  8065db:	48 01 d8             	add    %rbx,%rax
+  8065de:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  8065e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8065e4:	8b 10                	mov    (%rax),%edx
+  8065e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8065ea:	8b 40 04             	mov    0x4(%rax),%eax
+  8065ed:	39 c2                	cmp    %eax,%edx
+  8065ef:	74 a4                	je     806595 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8065f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8065f5:	8b 10                	mov    (%rax),%edx
+  8065f7:	89 d0                	mov    %edx,%eax
+  8065f9:	c1 f8 1f             	sar    $0x1f,%eax
+  8065fc:	c1 e8 1b             	shr    $0x1b,%eax
+  8065ff:	01 c2                	add    %eax,%edx
+  806601:	83 e2 1f             	and    $0x1f,%edx
+  806604:	29 c2                	sub    %eax,%edx
+  806606:	89 d6                	mov    %edx,%esi
+  806608:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80660c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806610:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806614:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806618:	48 63 c6             	movslq %esi,%rax
+  80661b:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806620:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806622:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806626:	8b 00                	mov    (%rax),%eax
+  806628:	8d 50 01             	lea    0x1(%rax),%edx
+  80662b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80662f:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806631:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806636:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80663a:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80663e:	72 a0                	jb     8065e0 <devpipe_read+0xa8>
+	}
+	return i;
+  806640:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806644:	48 83 c4 40          	add    $0x40,%rsp
+  806648:	5b                   	pop    %rbx
+  806649:	41 5f                	pop    %r15
+  80664b:	5d                   	pop    %rbp
+  80664c:	c3                   	ret
+
+000000000080664d <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  80664d:	55                   	push   %rbp
+  80664e:	48 89 e5             	mov    %rsp,%rbp
+  806651:	41 57                	push   %r15
+  806653:	53                   	push   %rbx
+  806654:	48 83 ec 40          	sub    $0x40,%rsp
+  806658:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806658 <devpipe_write+0xb>
+  80665f:	49 bb e8 29 00 00 00 	movabs $0x29e8,%r11
+  806666:	00 00 00 
+  806669:	4c 01 db             	add    %r11,%rbx
+  80666c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806670:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  806674:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  806678:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80667c:	48 89 c7             	mov    %rax,%rdi
+  80667f:	49 89 df             	mov    %rbx,%r15
+  806682:	48 b8 63 ad ff ff ff 	movabs $0xffffffffffffad63,%rax
+  806689:	ff ff ff 
+  80668c:	48 01 d8             	add    %rbx,%rax
+  80668f:	ff d0                	call   *%rax
+  806691:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  806695:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806699:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  80669d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8066a4:	00 
+  8066a5:	e9 a0 00 00 00       	jmp    80674a <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  8066aa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8066ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8066b2:	48 89 d6             	mov    %rdx,%rsi
+  8066b5:	48 89 c7             	mov    %rax,%rdi
+  8066b8:	48 b8 4d d3 ff ff ff 	movabs $0xffffffffffffd34d,%rax
+  8066bf:	ff ff ff 
+  8066c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8066c6:	ff d0                	call   *%rax
+  8066c8:	85 c0                	test   %eax,%eax
+  8066ca:	74 0a                	je     8066d6 <devpipe_write+0x89>
+				return 0;
+  8066cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8066d1:	e9 82 00 00 00       	jmp    806758 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  8066d6:	49 89 df             	mov    %rbx,%r15
+  8066d9:	48 b8 d6 91 ff ff ff 	movabs $0xffffffffffff91d6,%rax
+  8066e0:	ff ff ff 
+  8066e3:	48 01 d8             	add    %rbx,%rax
+  8066e6:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8066e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066ec:	8b 40 04             	mov    0x4(%rax),%eax
+  8066ef:	48 63 d0             	movslq %eax,%rdx
+  8066f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8066f6:	8b 00                	mov    (%rax),%eax
+  8066f8:	48 98                	cltq
+  8066fa:	48 83 c0 20          	add    $0x20,%rax
+  8066fe:	48 39 c2             	cmp    %rax,%rdx
+  806701:	73 a7                	jae    8066aa <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806703:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806707:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80670b:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80670f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806713:	8b 50 04             	mov    0x4(%rax),%edx
+  806716:	89 d0                	mov    %edx,%eax
+  806718:	c1 f8 1f             	sar    $0x1f,%eax
+  80671b:	c1 e8 1b             	shr    $0x1b,%eax
+  80671e:	01 c2                	add    %eax,%edx
+  806720:	83 e2 1f             	and    $0x1f,%edx
+  806723:	29 c2                	sub    %eax,%edx
+  806725:	89 d0                	mov    %edx,%eax
+  806727:	0f b6 09             	movzbl (%rcx),%ecx
+  80672a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80672e:	48 98                	cltq
+  806730:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806734:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806738:	8b 40 04             	mov    0x4(%rax),%eax
+  80673b:	8d 50 01             	lea    0x1(%rax),%edx
+  80673e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806742:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  806745:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80674a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80674e:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  806752:	72 94                	jb     8066e8 <devpipe_write+0x9b>
+	}
+
+	return i;
+  806754:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  806758:	48 83 c4 40          	add    $0x40,%rsp
+  80675c:	5b                   	pop    %rbx
+  80675d:	41 5f                	pop    %r15
+  80675f:	5d                   	pop    %rbp
+  806760:	c3                   	ret
+
+0000000000806761 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  806761:	55                   	push   %rbp
+  806762:	48 89 e5             	mov    %rsp,%rbp
+  806765:	41 57                	push   %r15
+  806767:	53                   	push   %rbx
+  806768:	48 83 ec 20          	sub    $0x20,%rsp
+  80676c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80676c <devpipe_stat+0xb>
+  806773:	49 bb d4 28 00 00 00 	movabs $0x28d4,%r11
+  80677a:	00 00 00 
+  80677d:	4c 01 db             	add    %r11,%rbx
+  806780:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806784:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  806788:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80678c:	48 89 c7             	mov    %rax,%rdi
+  80678f:	49 89 df             	mov    %rbx,%r15
+  806792:	48 b8 63 ad ff ff ff 	movabs $0xffffffffffffad63,%rax
+  806799:	ff ff ff 
+  80679c:	48 01 d8             	add    %rbx,%rax
+  80679f:	ff d0                	call   *%rax
+  8067a1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  8067a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8067a9:	48 ba c9 e5 ff ff ff 	movabs $0xffffffffffffe5c9,%rdx
+  8067b0:	ff ff ff 
+  8067b3:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  8067b7:	48 89 d6             	mov    %rdx,%rsi
+  8067ba:	48 89 c7             	mov    %rax,%rdi
+  8067bd:	49 89 df             	mov    %rbx,%r15
+  8067c0:	48 b8 6f 85 ff ff ff 	movabs $0xffffffffffff856f,%rax
+  8067c7:	ff ff ff 
+  8067ca:	48 01 d8             	add    %rbx,%rax
+  8067cd:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  8067cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8067d3:	8b 50 04             	mov    0x4(%rax),%edx
+  8067d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8067da:	8b 00                	mov    (%rax),%eax
+  8067dc:	29 c2                	sub    %eax,%edx
+  8067de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8067e2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  8067e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8067ec:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8067f3:	00 00 00 
+	stat->st_dev = &devpipe;
+  8067f6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8067fa:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806801:	00 00 00 
+  806804:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806808:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80680f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806814:	48 83 c4 20          	add    $0x20,%rsp
+  806818:	5b                   	pop    %rbx
+  806819:	41 5f                	pop    %r15
+  80681b:	5d                   	pop    %rbp
+  80681c:	c3                   	ret
+
+000000000080681d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80681d:	55                   	push   %rbp
+  80681e:	48 89 e5             	mov    %rsp,%rbp
+  806821:	41 57                	push   %r15
+  806823:	53                   	push   %rbx
+  806824:	48 83 ec 10          	sub    $0x10,%rsp
+  806828:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806828 <devpipe_close+0xb>
+  80682f:	49 bb 18 28 00 00 00 	movabs $0x2818,%r11
+  806836:	00 00 00 
+  806839:	4c 01 db             	add    %r11,%rbx
+  80683c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  806840:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806844:	48 89 c6             	mov    %rax,%rsi
+  806847:	bf 00 00 00 00       	mov    $0x0,%edi
+  80684c:	49 89 df             	mov    %rbx,%r15
+  80684f:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  806856:	ff ff ff 
+  806859:	48 01 d8             	add    %rbx,%rax
+  80685c:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  80685e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806862:	48 89 c7             	mov    %rax,%rdi
+  806865:	49 89 df             	mov    %rbx,%r15
+  806868:	48 b8 63 ad ff ff ff 	movabs $0xffffffffffffad63,%rax
+  80686f:	ff ff ff 
+  806872:	48 01 d8             	add    %rbx,%rax
+  806875:	ff d0                	call   *%rax
+  806877:	48 89 c6             	mov    %rax,%rsi
+  80687a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80687f:	49 89 df             	mov    %rbx,%r15
+  806882:	48 b8 03 93 ff ff ff 	movabs $0xffffffffffff9303,%rax
+  806889:	ff ff ff 
+  80688c:	48 01 d8             	add    %rbx,%rax
+  80688f:	ff d0                	call   *%rax
+}
+  806891:	48 83 c4 10          	add    $0x10,%rsp
+  806895:	5b                   	pop    %rbx
+  806896:	41 5f                	pop    %r15
+  806898:	5d                   	pop    %rbp
+  806899:	c3                   	ret
+
+000000000080689a <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  80689a:	55                   	push   %rbp
+  80689b:	48 89 e5             	mov    %rsp,%rbp
+  80689e:	41 57                	push   %r15
+  8068a0:	48 83 ec 28          	sub    $0x28,%rsp
+  8068a4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8068a4 <cputchar+0xa>
+  8068ab:	49 bb 9c 27 00 00 00 	movabs $0x279c,%r11
+  8068b2:	00 00 00 
+  8068b5:	4c 01 d8             	add    %r11,%rax
+  8068b8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  8068bb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8068be:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  8068c1:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  8068c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8068ca:	48 89 d7             	mov    %rdx,%rdi
+  8068cd:	49 89 c7             	mov    %rax,%r15
+  8068d0:	48 ba 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rdx
+  8068d7:	ff ff ff 
+  8068da:	48 01 c2             	add    %rax,%rdx
+  8068dd:	ff d2                	call   *%rdx
+}
+  8068df:	90                   	nop
+  8068e0:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8068e4:	c9                   	leave
+  8068e5:	c3                   	ret
+
+00000000008068e6 <getchar>:
+
+int
+getchar(void)
+{
+  8068e6:	55                   	push   %rbp
+  8068e7:	48 89 e5             	mov    %rsp,%rbp
+  8068ea:	41 57                	push   %r15
+  8068ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8068f0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8068f0 <getchar+0xa>
+  8068f7:	49 bb 50 27 00 00 00 	movabs $0x2750,%r11
+  8068fe:	00 00 00 
+  806901:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806904:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806908:	ba 01 00 00 00       	mov    $0x1,%edx
+  80690d:	48 89 ce             	mov    %rcx,%rsi
+  806910:	bf 00 00 00 00       	mov    $0x0,%edi
+  806915:	49 89 c7             	mov    %rax,%r15
+  806918:	48 b9 a3 b3 ff ff ff 	movabs $0xffffffffffffb3a3,%rcx
+  80691f:	ff ff ff 
+  806922:	48 01 c1             	add    %rax,%rcx
+  806925:	ff d1                	call   *%rcx
+  806927:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80692a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80692e:	79 05                	jns    806935 <getchar+0x4f>
+		return r;
+  806930:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806933:	eb 14                	jmp    806949 <getchar+0x63>
+	if (r < 1)
+  806935:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806939:	7f 07                	jg     806942 <getchar+0x5c>
+		return -E_EOF;
+  80693b:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  806940:	eb 07                	jmp    806949 <getchar+0x63>
+	return c;
+  806942:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  806946:	0f b6 c0             	movzbl %al,%eax
+}
+  806949:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80694d:	c9                   	leave
+  80694e:	c3                   	ret
+
+000000000080694f <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  80694f:	55                   	push   %rbp
+  806950:	48 89 e5             	mov    %rsp,%rbp
+  806953:	41 57                	push   %r15
+  806955:	53                   	push   %rbx
+  806956:	48 83 ec 20          	sub    $0x20,%rsp
+  80695a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80695a <iscons+0xb>
+  806961:	49 bb e6 26 00 00 00 	movabs $0x26e6,%r11
+  806968:	00 00 00 
+  80696b:	4c 01 db             	add    %r11,%rbx
+  80696e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806971:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806975:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  806978:	48 89 d6             	mov    %rdx,%rsi
+  80697b:	89 c7                	mov    %eax,%edi
+  80697d:	49 89 df             	mov    %rbx,%r15
+  806980:	48 b8 5c ae ff ff ff 	movabs $0xffffffffffffae5c,%rax
+  806987:	ff ff ff 
+  80698a:	48 01 d8             	add    %rbx,%rax
+  80698d:	ff d0                	call   *%rax
+  80698f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806992:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806996:	79 05                	jns    80699d <iscons+0x4e>
+		return r;
+  806998:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80699b:	eb 1b                	jmp    8069b8 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  80699d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8069a1:	8b 10                	mov    (%rax),%edx
+  8069a3:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  8069aa:	00 00 00 
+  8069ad:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8069b0:	39 c2                	cmp    %eax,%edx
+  8069b2:	0f 94 c0             	sete   %al
+  8069b5:	0f b6 c0             	movzbl %al,%eax
+}
+  8069b8:	48 83 c4 20          	add    $0x20,%rsp
+  8069bc:	5b                   	pop    %rbx
+  8069bd:	41 5f                	pop    %r15
+  8069bf:	5d                   	pop    %rbp
+  8069c0:	c3                   	ret
+
+00000000008069c1 <opencons>:
+
+int
+opencons(void)
+{
+  8069c1:	55                   	push   %rbp
+  8069c2:	48 89 e5             	mov    %rsp,%rbp
+  8069c5:	41 57                	push   %r15
+  8069c7:	53                   	push   %rbx
+  8069c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8069cc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069cc <opencons+0xb>
+  8069d3:	49 bb 74 26 00 00 00 	movabs $0x2674,%r11
+  8069da:	00 00 00 
+  8069dd:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  8069e0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8069e4:	48 89 c7             	mov    %rax,%rdi
+  8069e7:	49 89 df             	mov    %rbx,%r15
+  8069ea:	48 b8 a6 ad ff ff ff 	movabs $0xffffffffffffada6,%rax
+  8069f1:	ff ff ff 
+  8069f4:	48 01 d8             	add    %rbx,%rax
+  8069f7:	ff d0                	call   *%rax
+  8069f9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8069fc:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a00:	79 05                	jns    806a07 <opencons+0x46>
+		return r;
+  806a02:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a05:	eb 68                	jmp    806a6f <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806a07:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a0b:	ba 07 04 00 00       	mov    $0x407,%edx
+  806a10:	48 89 c6             	mov    %rax,%rsi
+  806a13:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a18:	49 89 df             	mov    %rbx,%r15
+  806a1b:	48 b8 2b 92 ff ff ff 	movabs $0xffffffffffff922b,%rax
+  806a22:	ff ff ff 
+  806a25:	48 01 d8             	add    %rbx,%rax
+  806a28:	ff d0                	call   *%rax
+  806a2a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806a2d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a31:	79 05                	jns    806a38 <opencons+0x77>
+		return r;
+  806a33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a36:	eb 37                	jmp    806a6f <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806a38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a3c:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806a43:	00 00 00 
+  806a46:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806a49:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806a4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a4f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806a56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a5a:	48 89 c7             	mov    %rax,%rdi
+  806a5d:	49 89 df             	mov    %rbx,%r15
+  806a60:	48 b8 2c ad ff ff ff 	movabs $0xffffffffffffad2c,%rax
+  806a67:	ff ff ff 
+  806a6a:	48 01 d8             	add    %rbx,%rax
+  806a6d:	ff d0                	call   *%rax
+}
+  806a6f:	48 83 c4 10          	add    $0x10,%rsp
+  806a73:	5b                   	pop    %rbx
+  806a74:	41 5f                	pop    %r15
+  806a76:	5d                   	pop    %rbp
+  806a77:	c3                   	ret
+
+0000000000806a78 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806a78:	55                   	push   %rbp
+  806a79:	48 89 e5             	mov    %rsp,%rbp
+  806a7c:	41 57                	push   %r15
+  806a7e:	53                   	push   %rbx
+  806a7f:	48 83 ec 30          	sub    $0x30,%rsp
+  806a83:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a83 <devcons_read+0xb>
+  806a8a:	49 bb bd 25 00 00 00 	movabs $0x25bd,%r11
+  806a91:	00 00 00 
+  806a94:	4c 01 db             	add    %r11,%rbx
+  806a97:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806a9b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806a9f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806aa3:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806aa8:	75 19                	jne    806ac3 <devcons_read+0x4b>
+		return 0;
+  806aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  806aaf:	eb 55                	jmp    806b06 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806ab1:	49 89 df             	mov    %rbx,%r15
+  806ab4:	48 b8 d6 91 ff ff ff 	movabs $0xffffffffffff91d6,%rax
+  806abb:	ff ff ff 
+  806abe:	48 01 d8             	add    %rbx,%rax
+  806ac1:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806ac3:	49 89 df             	mov    %rbx,%r15
+  806ac6:	48 b8 d2 90 ff ff ff 	movabs $0xffffffffffff90d2,%rax
+  806acd:	ff ff ff 
+  806ad0:	48 01 d8             	add    %rbx,%rax
+  806ad3:	ff d0                	call   *%rax
+  806ad5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806ad8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806adc:	74 d3                	je     806ab1 <devcons_read+0x39>
+	if (c < 0)
+  806ade:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806ae2:	79 05                	jns    806ae9 <devcons_read+0x71>
+		return c;
+  806ae4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ae7:	eb 1d                	jmp    806b06 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806ae9:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806aed:	75 07                	jne    806af6 <devcons_read+0x7e>
+		return 0;
+  806aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  806af4:	eb 10                	jmp    806b06 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806af6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806af9:	89 c2                	mov    %eax,%edx
+  806afb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806aff:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806b01:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806b06:	48 83 c4 30          	add    $0x30,%rsp
+  806b0a:	5b                   	pop    %rbx
+  806b0b:	41 5f                	pop    %r15
+  806b0d:	5d                   	pop    %rbp
+  806b0e:	c3                   	ret
+
+0000000000806b0f <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806b0f:	55                   	push   %rbp
+  806b10:	48 89 e5             	mov    %rsp,%rbp
+  806b13:	41 57                	push   %r15
+  806b15:	53                   	push   %rbx
+  806b16:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806b1d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b1d <devcons_write+0xe>
+  806b24:	49 bb 23 25 00 00 00 	movabs $0x2523,%r11
+  806b2b:	00 00 00 
+  806b2e:	4c 01 db             	add    %r11,%rbx
+  806b31:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806b38:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806b3f:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806b46:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806b4d:	e9 80 00 00 00       	jmp    806bd2 <devcons_write+0xc3>
+		m = n - tot;
+  806b52:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806b59:	89 c2                	mov    %eax,%edx
+  806b5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b5e:	29 c2                	sub    %eax,%edx
+  806b60:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806b63:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806b66:	83 f8 7f             	cmp    $0x7f,%eax
+  806b69:	76 07                	jbe    806b72 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806b6b:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806b72:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806b75:	48 63 d0             	movslq %eax,%rdx
+  806b78:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b7b:	48 63 c8             	movslq %eax,%rcx
+  806b7e:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806b85:	48 01 c1             	add    %rax,%rcx
+  806b88:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806b8f:	48 89 ce             	mov    %rcx,%rsi
+  806b92:	48 89 c7             	mov    %rax,%rdi
+  806b95:	49 89 df             	mov    %rbx,%r15
+  806b98:	48 b8 4f 89 ff ff ff 	movabs $0xffffffffffff894f,%rax
+  806b9f:	ff ff ff 
+  806ba2:	48 01 d8             	add    %rbx,%rax
+  806ba5:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806ba7:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806baa:	48 63 d0             	movslq %eax,%rdx
+  806bad:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806bb4:	48 89 d6             	mov    %rdx,%rsi
+  806bb7:	48 89 c7             	mov    %rax,%rdi
+  806bba:	49 89 df             	mov    %rbx,%r15
+  806bbd:	48 b8 73 90 ff ff ff 	movabs $0xffffffffffff9073,%rax
+  806bc4:	ff ff ff 
+  806bc7:	48 01 d8             	add    %rbx,%rax
+  806bca:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806bcc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806bcf:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806bd2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bd5:	48 98                	cltq
+  806bd7:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806bde:	0f 82 6e ff ff ff    	jb     806b52 <devcons_write+0x43>
+	}
+	return tot;
+  806be4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806be7:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806bee:	5b                   	pop    %rbx
+  806bef:	41 5f                	pop    %r15
+  806bf1:	5d                   	pop    %rbp
+  806bf2:	c3                   	ret
+
+0000000000806bf3 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806bf3:	55                   	push   %rbp
+  806bf4:	48 89 e5             	mov    %rsp,%rbp
+  806bf7:	48 83 ec 08          	sub    $0x8,%rsp
+  806bfb:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806bfb <devcons_close+0x8>
+  806c02:	49 bb 45 24 00 00 00 	movabs $0x2445,%r11
+  806c09:	00 00 00 
+  806c0c:	4c 01 d8             	add    %r11,%rax
+  806c0f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806c13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806c18:	c9                   	leave
+  806c19:	c3                   	ret
+
+0000000000806c1a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806c1a:	55                   	push   %rbp
+  806c1b:	48 89 e5             	mov    %rsp,%rbp
+  806c1e:	41 57                	push   %r15
+  806c20:	48 83 ec 18          	sub    $0x18,%rsp
+  806c24:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806c24 <devcons_stat+0xa>
+  806c2b:	49 bb 1c 24 00 00 00 	movabs $0x241c,%r11
+  806c32:	00 00 00 
+  806c35:	4c 01 d8             	add    %r11,%rax
+  806c38:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806c3c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806c40:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806c44:	48 b9 d5 e5 ff ff ff 	movabs $0xffffffffffffe5d5,%rcx
+  806c4b:	ff ff ff 
+  806c4e:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806c52:	48 89 ce             	mov    %rcx,%rsi
+  806c55:	48 89 d7             	mov    %rdx,%rdi
+  806c58:	49 89 c7             	mov    %rax,%r15
+  806c5b:	48 ba 6f 85 ff ff ff 	movabs $0xffffffffffff856f,%rdx
+  806c62:	ff ff ff 
+  806c65:	48 01 c2             	add    %rax,%rdx
+  806c68:	ff d2                	call   *%rdx
+	return 0;
+  806c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806c6f:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806c73:	c9                   	leave
+  806c74:	c3                   	ret
+
+0000000000806c75 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806c75:	55                   	push   %rbp
+  806c76:	48 89 e5             	mov    %rsp,%rbp
+  806c79:	41 57                	push   %r15
+  806c7b:	53                   	push   %rbx
+  806c7c:	48 83 ec 20          	sub    $0x20,%rsp
+  806c80:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806c80 <set_pgfault_handler+0xb>
+  806c87:	49 bb c0 23 00 00 00 	movabs $0x23c0,%r11
+  806c8e:	00 00 00 
+  806c91:	4c 01 db             	add    %r11,%rbx
+  806c94:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806c98:	49 89 df             	mov    %rbx,%r15
+  806c9b:	48 b8 82 91 ff ff ff 	movabs $0xffffffffffff9182,%rax
+  806ca2:	ff ff ff 
+  806ca5:	48 01 d8             	add    %rbx,%rax
+  806ca8:	ff d0                	call   *%rax
+  806caa:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806cad:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806cb4:	00 00 00 
+  806cb7:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806cbb:	48 85 c0             	test   %rax,%rax
+  806cbe:	75 6b                	jne    806d2b <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806cc0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806cc3:	ba 07 00 00 00       	mov    $0x7,%edx
+  806cc8:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806ccd:	48 89 ce             	mov    %rcx,%rsi
+  806cd0:	89 c7                	mov    %eax,%edi
+  806cd2:	49 89 df             	mov    %rbx,%r15
+  806cd5:	48 b8 2b 92 ff ff ff 	movabs $0xffffffffffff922b,%rax
+  806cdc:	ff ff ff 
+  806cdf:	48 01 d8             	add    %rbx,%rax
+  806ce2:	ff d0                	call   *%rax
+  806ce4:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806ce7:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806ceb:	74 3e                	je     806d2b <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806ced:	48 b8 e0 e5 ff ff ff 	movabs $0xffffffffffffe5e0,%rax
+  806cf4:	ff ff ff 
+  806cf7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806cfb:	48 89 c2             	mov    %rax,%rdx
+  806cfe:	be 23 00 00 00       	mov    $0x23,%esi
+  806d03:	48 b8 0e e6 ff ff ff 	movabs $0xffffffffffffe60e,%rax
+  806d0a:	ff ff ff 
+  806d0d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806d11:	48 89 c7             	mov    %rax,%rdi
+  806d14:	49 89 df             	mov    %rbx,%r15
+  806d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d1c:	48 b9 d6 74 ff ff ff 	movabs $0xffffffffffff74d6,%rcx
+  806d23:	ff ff ff 
+  806d26:	48 01 d9             	add    %rbx,%rcx
+  806d29:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806d2b:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806d32:	00 00 00 
+  806d35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806d39:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806d3d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d40:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806d47:	ff ff ff 
+  806d4a:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806d4e:	48 89 d6             	mov    %rdx,%rsi
+  806d51:	89 c7                	mov    %eax,%edi
+  806d53:	49 89 df             	mov    %rbx,%r15
+  806d56:	48 b8 21 94 ff ff ff 	movabs $0xffffffffffff9421,%rax
+  806d5d:	ff ff ff 
+  806d60:	48 01 d8             	add    %rbx,%rax
+  806d63:	ff d0                	call   *%rax
+}
+  806d65:	90                   	nop
+  806d66:	48 83 c4 20          	add    $0x20,%rsp
+  806d6a:	5b                   	pop    %rbx
+  806d6b:	41 5f                	pop    %r15
+  806d6d:	5d                   	pop    %rbp
+  806d6e:	c3                   	ret
+
+0000000000806d6f <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806d6f:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806d72:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806d79:	00 00 00 
+call *%rax
+  806d7c:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806d7e:	58                   	pop    %rax
+	popq %rax;
+  806d7f:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806d80:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806d87:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806d8b:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806d8f:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806d93:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806d97:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806d9b:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806d9e:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806da2:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806da6:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806dab:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806db0:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806db5:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806dba:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806dbf:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806dc4:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806dc9:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806dce:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806dd3:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806dd8:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806ddd:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806de2:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806de7:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806dec:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806df0:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806df4:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806df5:	5c                   	pop    %rsp
+	ret;			//return
+  806df6:	c3                   	ret
+
+0000000000806df7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806df7:	55                   	push   %rbp
+  806df8:	48 89 e5             	mov    %rsp,%rbp
+  806dfb:	48 83 ec 18          	sub    $0x18,%rsp
+  806dff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806dff <pageref+0x8>
+  806e06:	49 bb 41 22 00 00 00 	movabs $0x2241,%r11
+  806e0d:	00 00 00 
+  806e10:	4c 01 d8             	add    %r11,%rax
+  806e13:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806e17:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806e1b:	48 89 d1             	mov    %rdx,%rcx
+  806e1e:	48 c1 e9 15          	shr    $0x15,%rcx
+  806e22:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806e29:	ff ff ff 
+  806e2c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806e30:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806e34:	83 e2 01             	and    $0x1,%edx
+  806e37:	48 85 d2             	test   %rdx,%rdx
+  806e3a:	75 07                	jne    806e43 <pageref+0x4c>
+		return 0;
+  806e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e41:	eb 64                	jmp    806ea7 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806e43:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806e47:	48 89 d1             	mov    %rdx,%rcx
+  806e4a:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806e4e:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806e55:	ff ff ff 
+  806e58:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806e5c:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806e60:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806e64:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806e68:	83 e2 01             	and    $0x1,%edx
+  806e6b:	48 85 d2             	test   %rdx,%rdx
+  806e6e:	75 07                	jne    806e77 <pageref+0x80>
+		return 0;
+  806e70:	b8 00 00 00 00       	mov    $0x0,%eax
+  806e75:	eb 30                	jmp    806ea7 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806e77:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806e7b:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806e7f:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806e86:	ff ff ff 
+  806e89:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806e8d:	48 89 d0             	mov    %rdx,%rax
+  806e90:	48 01 c0             	add    %rax,%rax
+  806e93:	48 01 d0             	add    %rdx,%rax
+  806e96:	48 c1 e0 03          	shl    $0x3,%rax
+  806e9a:	48 01 c8             	add    %rcx,%rax
+  806e9d:	48 83 c0 08          	add    $0x8,%rax
+  806ea1:	0f b7 00             	movzwl (%rax),%eax
+  806ea4:	0f b7 c0             	movzwl %ax,%eax
+}
+  806ea7:	c9                   	leave
+  806ea8:	c3                   	ret
@@ -0,0 +1,10738 @@
+
+obj/user/testipcvec:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	movabs $USTACKTOP, %rax
+  800020:	48 b8 00 e0 7f ef 00 	movabs $0xef7fe000,%rax
+  800027:	00 00 00 
+	cmpq %rax,%rsp
+  80002a:	48 39 c4             	cmp    %rax,%rsp
+	jne args_exist
+  80002d:	75 04                	jne    800033 <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushq $0
+  80002f:	6a 00                	push   $0x0
+	pushq $0
+  800031:	6a 00                	push   $0x0
+
+0000000000800033 <args_exist>:
+
+args_exist:
+	movq 8(%rsp), %rsi
+  800033:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+	movq (%rsp), %rdi
+  800038:	48 8b 3c 24          	mov    (%rsp),%rdi
+	call libmain
+  80003c:	e8 2b 04 00 00       	call   80046c <libmain>
+1:	jmp 1b
+  800041:	eb fe                	jmp    800041 <args_exist+0xe>
+
+0000000000800043 <umain>:
+#define WINDOW		0xC0000000
+#define NPAGES		5
+
+void
+umain(int argc, char **argv)
+{
+  800043:	55                   	push   %rbp
+  800044:	48 89 e5             	mov    %rsp,%rbp
+  800047:	41 57                	push   %r15
+  800049:	53                   	push   %rbx
+  80004a:	48 83 ec 70          	sub    $0x70,%rsp
+  80004e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80004e <umain+0xb>
+  800055:	49 bb f2 8f 00 00 00 	movabs $0x8ff2,%r11
+  80005c:	00 00 00 
+  80005f:	4c 01 db             	add    %r11,%rbx
+  800062:	89 7d 8c             	mov    %edi,-0x74(%rbp)
+  800065:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+	envid_t parent = thisenv->env_id, who;
+  800069:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800070:	ff ff ff 
+  800073:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800077:	48 8b 00             	mov    (%rax),%rax
+  80007a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800080:	89 45 e0             	mov    %eax,-0x20(%rbp)
+	struct IpcSeg segs[2] = {
+  800083:	b8 00 00 00 a0       	mov    $0xa0000000,%eax
+  800088:	48 89 45 90          	mov    %rax,-0x70(%rbp)
+  80008c:	48 c7 45 98 03 00 00 	movq   $0x3,-0x68(%rbp)
+  800093:	00 
+  800094:	b8 00 00 00 b0       	mov    $0xb0000000,%eax
+  800099:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80009d:	48 c7 45 a8 02 00 00 	movq   $0x2,-0x58(%rbp)
+  8000a4:	00 
+		{ RUNA, 3 },
+		{ RUNB, NPAGES - 3 },
+	};
+	char *win = (char *) WINDOW;
+  8000a5:	b8 00 00 00 c0       	mov    $0xc0000000,%eax
+  8000aa:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	int i, n, r, ok;
+
+	if ((who = fork()) < 0)
+  8000ae:	49 89 df             	mov    %rbx,%r15
+  8000b1:	48 b8 1a a2 ff ff ff 	movabs $0xffffffffffffa21a,%rax
+  8000b8:	ff ff ff 
+  8000bb:	48 01 d8             	add    %rbx,%rax
+  8000be:	ff d0                	call   *%rax
+  8000c0:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8000c3:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8000c7:	79 44                	jns    80010d <umain+0xca>
+		panic("fork: %e", who);
+  8000c9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8000cc:	89 c1                	mov    %eax,%ecx
+  8000ce:	48 b8 d0 de ff ff ff 	movabs $0xffffffffffffded0,%rax
+  8000d5:	ff ff ff 
+  8000d8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000dc:	48 89 c2             	mov    %rax,%rdx
+  8000df:	be 17 00 00 00       	mov    $0x17,%esi
+  8000e4:	48 b8 d9 de ff ff ff 	movabs $0xffffffffffffded9,%rax
+  8000eb:	ff ff ff 
+  8000ee:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8000f2:	48 89 c7             	mov    %rax,%rdi
+  8000f5:	49 89 df             	mov    %rbx,%r15
+  8000f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fd:	49 b8 36 75 ff ff ff 	movabs $0xffffffffffff7536,%r8
+  800104:	ff ff ff 
+  800107:	49 01 d8             	add    %rbx,%r8
+  80010a:	41 ff d0             	call   *%r8
+	if (who == 0) {
+  80010d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800111:	0f 85 43 01 00 00    	jne    80025a <umain+0x217>
+		for (n = 4; n <= 8; n += 4) {
+  800117:	c7 45 e8 04 00 00 00 	movl   $0x4,-0x18(%rbp)
+  80011e:	e9 1b 01 00 00       	jmp    80023e <umain+0x1fb>
+			if ((r = sys_ipc_recv(IPC_WINDOW(WINDOW, n))) < 0)
+  800123:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800126:	83 e8 01             	sub    $0x1,%eax
+  800129:	48 98                	cltq
+  80012b:	ba 00 00 00 c0       	mov    $0xc0000000,%edx
+  800130:	48 09 d0             	or     %rdx,%rax
+  800133:	48 89 c7             	mov    %rax,%rdi
+  800136:	49 89 df             	mov    %rbx,%r15
+  800139:	48 b8 b4 95 ff ff ff 	movabs $0xffffffffffff95b4,%rax
+  800140:	ff ff ff 
+  800143:	48 01 d8             	add    %rbx,%rax
+  800146:	ff d0                	call   *%rax
+  800148:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  80014b:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  80014f:	79 44                	jns    800195 <umain+0x152>
+				panic("sys_ipc_recv: %e", r);
+  800151:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  800154:	89 c1                	mov    %eax,%ecx
+  800156:	48 b8 eb de ff ff ff 	movabs $0xffffffffffffdeeb,%rax
+  80015d:	ff ff ff 
+  800160:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800164:	48 89 c2             	mov    %rax,%rdx
+  800167:	be 1b 00 00 00       	mov    $0x1b,%esi
+  80016c:	48 b8 d9 de ff ff ff 	movabs $0xffffffffffffded9,%rax
+  800173:	ff ff ff 
+  800176:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80017a:	48 89 c7             	mov    %rax,%rdi
+  80017d:	49 89 df             	mov    %rbx,%r15
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	49 b8 36 75 ff ff ff 	movabs $0xffffffffffff7536,%r8
+  80018c:	ff ff ff 
+  80018f:	49 01 d8             	add    %rbx,%r8
+  800192:	41 ff d0             	call   *%r8
+			ok = thisenv->env_ipc_npages == MIN(n, NPAGES);
+  800195:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80019c:	ff ff ff 
+  80019f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8001a3:	48 8b 00             	mov    (%rax),%rax
+  8001a6:	8b 88 54 01 00 00    	mov    0x154(%rax),%ecx
+  8001ac:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8001af:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8001b2:	c7 45 c8 05 00 00 00 	movl   $0x5,-0x38(%rbp)
+  8001b9:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8001bc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8001bf:	39 c2                	cmp    %eax,%edx
+  8001c1:	0f 4e c2             	cmovle %edx,%eax
+  8001c4:	39 c8                	cmp    %ecx,%eax
+  8001c6:	0f 94 c0             	sete   %al
+  8001c9:	0f b6 c0             	movzbl %al,%eax
+  8001cc:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+			for (i = 0; i < thisenv->env_ipc_npages; i++)
+  8001cf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8001d6:	eb 22                	jmp    8001fa <umain+0x1b7>
+				if (*(int *) (win + i * PGSIZE) != i)
+  8001d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001db:	c1 e0 0c             	shl    $0xc,%eax
+  8001de:	48 63 d0             	movslq %eax,%rdx
+  8001e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8001e5:	48 01 d0             	add    %rdx,%rax
+  8001e8:	8b 00                	mov    (%rax),%eax
+  8001ea:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8001ed:	74 07                	je     8001f6 <umain+0x1b3>
+					ok = 0;
+  8001ef:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+			for (i = 0; i < thisenv->env_ipc_npages; i++)
+  8001f6:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  8001fa:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  800201:	ff ff ff 
+  800204:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800208:	48 8b 00             	mov    (%rax),%rax
+  80020b:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  800211:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  800214:	7c c2                	jl     8001d8 <umain+0x195>
+			ipc_send(parent, ok, 0, 0);
+  800216:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800219:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80021c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800221:	ba 00 00 00 00       	mov    $0x0,%edx
+  800226:	89 c7                	mov    %eax,%edi
+  800228:	49 89 df             	mov    %rbx,%r15
+  80022b:	48 b8 a9 a6 ff ff ff 	movabs $0xffffffffffffa6a9,%rax
+  800232:	ff ff ff 
+  800235:	48 01 d8             	add    %rbx,%rax
+  800238:	ff d0                	call   *%rax
+		for (n = 4; n <= 8; n += 4) {
+  80023a:	83 45 e8 04          	addl   $0x4,-0x18(%rbp)
+  80023e:	83 7d e8 08          	cmpl   $0x8,-0x18(%rbp)
+  800242:	0f 8e db fe ff ff    	jle    800123 <umain+0xe0>
+		}
+		exit();
+  800248:	49 89 df             	mov    %rbx,%r15
+  80024b:	48 b8 ec 74 ff ff ff 	movabs $0xffffffffffff74ec,%rax
+  800252:	ff ff ff 
+  800255:	48 01 d8             	add    %rbx,%rax
+  800258:	ff d0                	call   *%rax
+	}
+
+	for (i = 0; i < NPAGES; i++) {
+  80025a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  800261:	e9 a6 00 00 00       	jmp    80030c <umain+0x2c9>
+		uintptr_t va = i < 3 ? RUNA + i * PGSIZE : RUNB + (i - 3) * PGSIZE;
+  800266:	83 7d ec 02          	cmpl   $0x2,-0x14(%rbp)
+  80026a:	7f 0f                	jg     80027b <umain+0x238>
+  80026c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80026f:	c1 e0 0c             	shl    $0xc,%eax
+  800272:	2d 00 00 00 60       	sub    $0x60000000,%eax
+  800277:	89 c0                	mov    %eax,%eax
+  800279:	eb 10                	jmp    80028b <umain+0x248>
+  80027b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80027e:	83 e8 03             	sub    $0x3,%eax
+  800281:	c1 e0 0c             	shl    $0xc,%eax
+  800284:	2d 00 00 00 50       	sub    $0x50000000,%eax
+  800289:	89 c0                	mov    %eax,%eax
+  80028b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+		if ((r = sys_page_alloc(0, (void *) va, PTE_P|PTE_U|PTE_W)) < 0)
+  80028f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  800293:	ba 07 00 00 00       	mov    $0x7,%edx
+  800298:	48 89 c6             	mov    %rax,%rsi
+  80029b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002a0:	49 89 df             	mov    %rbx,%r15
+  8002a3:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  8002aa:	ff ff ff 
+  8002ad:	48 01 d8             	add    %rbx,%rax
+  8002b0:	ff d0                	call   *%rax
+  8002b2:	89 45 d0             	mov    %eax,-0x30(%rbp)
+  8002b5:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8002b9:	79 44                	jns    8002ff <umain+0x2bc>
+			panic("sys_page_alloc: %e", r);
+  8002bb:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  8002be:	89 c1                	mov    %eax,%ecx
+  8002c0:	48 b8 fc de ff ff ff 	movabs $0xffffffffffffdefc,%rax
+  8002c7:	ff ff ff 
+  8002ca:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002ce:	48 89 c2             	mov    %rax,%rdx
+  8002d1:	be 28 00 00 00       	mov    $0x28,%esi
+  8002d6:	48 b8 d9 de ff ff ff 	movabs $0xffffffffffffded9,%rax
+  8002dd:	ff ff ff 
+  8002e0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8002e4:	48 89 c7             	mov    %rax,%rdi
+  8002e7:	49 89 df             	mov    %rbx,%r15
+  8002ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ef:	49 b8 36 75 ff ff ff 	movabs $0xffffffffffff7536,%r8
+  8002f6:	ff ff ff 
+  8002f9:	49 01 d8             	add    %rbx,%r8
+  8002fc:	41 ff d0             	call   *%r8
+		*(int *) va = i;
+  8002ff:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  800303:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800306:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < NPAGES; i++) {
+  800308:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80030c:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  800310:	0f 8e 50 ff ff ff    	jle    800266 <umain+0x223>
+	}
+
+	r = sys_ipc_send(who, 0, (void *) UTOP, PTE_P|PTE_U|IPC_PERM_SEGS(1));
+  800316:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800319:	b9 05 00 10 00       	mov    $0x100005,%ecx
+  80031e:	48 ba 00 00 80 00 80 	movabs $0x8000800000,%rdx
+  800325:	00 00 00 
+  800328:	be 00 00 00 00       	mov    $0x0,%esi
+  80032d:	89 c7                	mov    %eax,%edi
+  80032f:	49 89 df             	mov    %rbx,%r15
+  800332:	48 b8 4a 95 ff ff ff 	movabs $0xffffffffffff954a,%rax
+  800339:	ff ff ff 
+  80033c:	48 01 d8             	add    %rbx,%rax
+  80033f:	ff d0                	call   *%rax
+  800341:	89 45 d0             	mov    %eax,-0x30(%rbp)
+	cprintf("vector above UTOP fails %s\n", r == -E_INVAL ? "right" : "wrong");
+  800344:	83 7d d0 fd          	cmpl   $0xfffffffd,-0x30(%rbp)
+  800348:	75 10                	jne    80035a <umain+0x317>
+  80034a:	48 b8 0f df ff ff ff 	movabs $0xffffffffffffdf0f,%rax
+  800351:	ff ff ff 
+  800354:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800358:	eb 0e                	jmp    800368 <umain+0x325>
+  80035a:	48 b8 15 df ff ff ff 	movabs $0xffffffffffffdf15,%rax
+  800361:	ff ff ff 
+  800364:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800368:	48 89 c6             	mov    %rax,%rsi
+  80036b:	48 b8 1b df ff ff ff 	movabs $0xffffffffffffdf1b,%rax
+  800372:	ff ff ff 
+  800375:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800379:	48 89 c7             	mov    %rax,%rdi
+  80037c:	49 89 df             	mov    %rbx,%r15
+  80037f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800384:	48 ba 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rdx
+  80038b:	ff ff ff 
+  80038e:	48 01 da             	add    %rbx,%rdx
+  800391:	ff d2                	call   *%rdx
+
+	for (n = 4; n <= 8; n += 4) {
+  800393:	c7 45 e8 04 00 00 00 	movl   $0x4,-0x18(%rbp)
+  80039a:	e9 b8 00 00 00       	jmp    800457 <umain+0x414>
+		ipc_send(who, 0, segs, PTE_P|PTE_U|IPC_PERM_SEGS(2));
+  80039f:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8003a3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8003a6:	b9 05 00 20 00       	mov    $0x200005,%ecx
+  8003ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b0:	89 c7                	mov    %eax,%edi
+  8003b2:	49 89 df             	mov    %rbx,%r15
+  8003b5:	48 b8 a9 a6 ff ff ff 	movabs $0xffffffffffffa6a9,%rax
+  8003bc:	ff ff ff 
+  8003bf:	48 01 d8             	add    %rbx,%rax
+  8003c2:	ff d0                	call   *%rax
+		ok = ipc_recv(NULL, 0, 0);
+  8003c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8003ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003d3:	49 89 df             	mov    %rbx,%r15
+  8003d6:	48 b8 c0 a5 ff ff ff 	movabs $0xffffffffffffa5c0,%rax
+  8003dd:	ff ff ff 
+  8003e0:	48 01 d8             	add    %rbx,%rax
+  8003e3:	ff d0                	call   *%rax
+  8003e5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+		cprintf("window of %d pages got %d in order %s\n", n,
+  8003e8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8003ec:	74 10                	je     8003fe <umain+0x3bb>
+  8003ee:	48 b8 0f df ff ff ff 	movabs $0xffffffffffffdf0f,%rax
+  8003f5:	ff ff ff 
+  8003f8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8003fc:	eb 0e                	jmp    80040c <umain+0x3c9>
+  8003fe:	48 b8 15 df ff ff ff 	movabs $0xffffffffffffdf15,%rax
+  800405:	ff ff ff 
+  800408:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+			MIN(n, NPAGES), ok ? "right" : "wrong");
+  80040c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80040f:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  800412:	c7 45 c0 05 00 00 00 	movl   $0x5,-0x40(%rbp)
+  800419:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+  80041c:	8b 55 c0             	mov    -0x40(%rbp),%edx
+  80041f:	39 d1                	cmp    %edx,%ecx
+  800421:	0f 4e d1             	cmovle %ecx,%edx
+		cprintf("window of %d pages got %d in order %s\n", n,
+  800424:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  800427:	48 89 c1             	mov    %rax,%rcx
+  80042a:	48 b8 38 df ff ff ff 	movabs $0xffffffffffffdf38,%rax
+  800431:	ff ff ff 
+  800434:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800438:	48 89 c7             	mov    %rax,%rdi
+  80043b:	49 89 df             	mov    %rbx,%r15
+  80043e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800443:	49 b8 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%r8
+  80044a:	ff ff ff 
+  80044d:	49 01 d8             	add    %rbx,%r8
+  800450:	41 ff d0             	call   *%r8
+	for (n = 4; n <= 8; n += 4) {
+  800453:	83 45 e8 04          	addl   $0x4,-0x18(%rbp)
+  800457:	83 7d e8 08          	cmpl   $0x8,-0x18(%rbp)
+  80045b:	0f 8e 3e ff ff ff    	jle    80039f <umain+0x35c>
+	}
+}
+  800461:	90                   	nop
+  800462:	90                   	nop
+  800463:	48 83 c4 70          	add    $0x70,%rsp
+  800467:	5b                   	pop    %rbx
+  800468:	41 5f                	pop    %r15
+  80046a:	5d                   	pop    %rbp
+  80046b:	c3                   	ret
+
+000000000080046c <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80046c:	55                   	push   %rbp
+  80046d:	48 89 e5             	mov    %rsp,%rbp
+  800470:	41 57                	push   %r15
+  800472:	53                   	push   %rbx
+  800473:	48 83 ec 20          	sub    $0x20,%rsp
+  800477:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800477 <libmain+0xb>
+  80047e:	49 bb c9 8b 00 00 00 	movabs $0x8bc9,%r11
+  800485:	00 00 00 
+  800488:	4c 01 db             	add    %r11,%rbx
+  80048b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80048e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	int envid = sys_getenvid();
+  800492:	49 89 df             	mov    %rbx,%r15
+  800495:	48 b8 e2 91 ff ff ff 	movabs $0xffffffffffff91e2,%rax
+  80049c:	ff ff ff 
+  80049f:	48 01 d8             	add    %rbx,%rax
+  8004a2:	ff d0                	call   *%rax
+  8004a4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+	thisenv = &envs[ENVX(envid)];
+  8004a7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004af:	48 98                	cltq
+  8004b1:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8004b8:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8004bf:	ff ff ff 
+  8004c2:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8004c6:	48 01 c2             	add    %rax,%rdx
+  8004c9:	48 b8 c8 2f 01 00 00 	movabs $0x12fc8,%rax
+  8004d0:	00 00 00 
+  8004d3:	48 89 14 03          	mov    %rdx,(%rbx,%rax,1)
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004d7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8004db:	7e 15                	jle    8004f2 <libmain+0x86>
+		binaryname = argv[0];
+  8004dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004e1:	48 8b 00             	mov    (%rax),%rax
+  8004e4:	48 ba 20 00 00 00 00 	movabs $0x20,%rdx
+  8004eb:	00 00 00 
+  8004ee:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+
+	// call user main routine
+	umain(argc, argv);
+  8004f2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8004f6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8004f9:	48 89 d6             	mov    %rdx,%rsi
+  8004fc:	89 c7                	mov    %eax,%edi
+  8004fe:	49 89 df             	mov    %rbx,%r15
+  800501:	48 b8 03 70 ff ff ff 	movabs $0xffffffffffff7003,%rax
+  800508:	ff ff ff 
+  80050b:	48 01 d8             	add    %rbx,%rax
+  80050e:	ff d0                	call   *%rax
+
+	// exit gracefully
+	exit();
+  800510:	49 89 df             	mov    %rbx,%r15
+  800513:	48 b8 ec 74 ff ff ff 	movabs $0xffffffffffff74ec,%rax
+  80051a:	ff ff ff 
+  80051d:	48 01 d8             	add    %rbx,%rax
+  800520:	ff d0                	call   *%rax
+}
+  800522:	90                   	nop
+  800523:	48 83 c4 20          	add    $0x20,%rsp
+  800527:	5b                   	pop    %rbx
+  800528:	41 5f                	pop    %r15
+  80052a:	5d                   	pop    %rbp
+  80052b:	c3                   	ret
+
+000000000080052c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80052c:	55                   	push   %rbp
+  80052d:	48 89 e5             	mov    %rsp,%rbp
+  800530:	41 57                	push   %r15
+  800532:	53                   	push   %rbx
+  800533:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800533 <exit+0x7>
+  80053a:	49 bb 0d 8b 00 00 00 	movabs $0x8b0d,%r11
+  800541:	00 00 00 
+  800544:	4c 01 db             	add    %r11,%rbx
+	close_all();
+  800547:	49 89 df             	mov    %rbx,%r15
+  80054a:	48 b8 b7 b1 ff ff ff 	movabs $0xffffffffffffb1b7,%rax
+  800551:	ff ff ff 
+  800554:	48 01 d8             	add    %rbx,%rax
+  800557:	ff d0                	call   *%rax
+	sys_env_destroy(0);
+  800559:	bf 00 00 00 00       	mov    $0x0,%edi
+  80055e:	49 89 df             	mov    %rbx,%r15
+  800561:	48 b8 86 91 ff ff ff 	movabs $0xffffffffffff9186,%rax
+  800568:	ff ff ff 
+  80056b:	48 01 d8             	add    %rbx,%rax
+  80056e:	ff d0                	call   *%rax
+}
+  800570:	90                   	nop
+  800571:	5b                   	pop    %rbx
+  800572:	41 5f                	pop    %r15
+  800574:	5d                   	pop    %rbp
+  800575:	c3                   	ret
+
+0000000000800576 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800576:	55                   	push   %rbp
+  800577:	48 89 e5             	mov    %rsp,%rbp
+  80057a:	41 57                	push   %r15
+  80057c:	41 54                	push   %r12
+  80057e:	53                   	push   %rbx
+  80057f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800586:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800586 <_panic+0x10>
+  80058d:	49 bb ba 8a 00 00 00 	movabs $0x8aba,%r11
+  800594:	00 00 00 
+  800597:	4c 01 db             	add    %r11,%rbx
+  80059a:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8005a1:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8005a7:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8005ae:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  8005b5:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  8005bc:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  8005c3:	84 c0                	test   %al,%al
+  8005c5:	74 26                	je     8005ed <_panic+0x77>
+  8005c7:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  8005ce:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  8005d5:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  8005d9:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  8005dd:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  8005e1:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  8005e5:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  8005e9:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005ed:	c7 85 18 ff ff ff 18 	movl   $0x18,-0xe8(%rbp)
+  8005f4:	00 00 00 
+  8005f7:	c7 85 1c ff ff ff 30 	movl   $0x30,-0xe4(%rbp)
+  8005fe:	00 00 00 
+  800601:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800605:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80060c:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  800613:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80061a:	48 b8 c0 ff ff ff ff 	movabs $0xffffffffffffffc0,%rax
+  800621:	ff ff ff 
+  800624:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  800628:	4c 8b 20             	mov    (%rax),%r12
+  80062b:	49 89 df             	mov    %rbx,%r15
+  80062e:	48 b8 e2 91 ff ff ff 	movabs $0xffffffffffff91e2,%rax
+  800635:	ff ff ff 
+  800638:	48 01 d8             	add    %rbx,%rax
+  80063b:	ff d0                	call   *%rax
+  80063d:	89 c6                	mov    %eax,%esi
+  80063f:	8b 95 04 ff ff ff    	mov    -0xfc(%rbp),%edx
+  800645:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80064c:	41 89 d0             	mov    %edx,%r8d
+  80064f:	48 89 c1             	mov    %rax,%rcx
+  800652:	4c 89 e2             	mov    %r12,%rdx
+  800655:	48 b8 70 df ff ff ff 	movabs $0xffffffffffffdf70,%rax
+  80065c:	ff ff ff 
+  80065f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  800663:	48 89 c7             	mov    %rax,%rdi
+  800666:	49 89 df             	mov    %rbx,%r15
+  800669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066e:	49 b9 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%r9
+  800675:	ff ff ff 
+  800678:	49 01 d9             	add    %rbx,%r9
+  80067b:	41 ff d1             	call   *%r9
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80067e:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800685:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  80068c:	48 89 d6             	mov    %rdx,%rsi
+  80068f:	48 89 c7             	mov    %rax,%rdi
+  800692:	49 89 df             	mov    %rbx,%r15
+  800695:	48 b8 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rax
+  80069c:	ff ff ff 
+  80069f:	48 01 d8             	add    %rbx,%rax
+  8006a2:	ff d0                	call   *%rax
+	cprintf("\n");
+  8006a4:	48 b8 93 df ff ff ff 	movabs $0xffffffffffffdf93,%rax
+  8006ab:	ff ff ff 
+  8006ae:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8006b2:	48 89 c7             	mov    %rax,%rdi
+  8006b5:	49 89 df             	mov    %rbx,%r15
+  8006b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006bd:	48 ba 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rdx
+  8006c4:	ff ff ff 
+  8006c7:	48 01 da             	add    %rbx,%rdx
+  8006ca:	ff d2                	call   *%rdx
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006cc:	cc                   	int3
+  8006cd:	eb fd                	jmp    8006cc <_panic+0x156>
+
+00000000008006cf <putch>:
+};
+
+
+    static void
+putch(int ch, struct printbuf *b)
+{
+  8006cf:	55                   	push   %rbp
+  8006d0:	48 89 e5             	mov    %rsp,%rbp
+  8006d3:	41 57                	push   %r15
+  8006d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8006d9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8006d9 <putch+0xa>
+  8006e0:	49 bb 67 89 00 00 00 	movabs $0x8967,%r11
+  8006e7:	00 00 00 
+  8006ea:	4c 01 d8             	add    %r11,%rax
+  8006ed:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8006f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+    b->buf[b->idx++] = ch;
+  8006f4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8006f8:	8b 12                	mov    (%rdx),%edx
+  8006fa:	8d 72 01             	lea    0x1(%rdx),%esi
+  8006fd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  800701:	89 31                	mov    %esi,(%rcx)
+  800703:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+  800706:	89 ce                	mov    %ecx,%esi
+  800708:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80070c:	48 63 d2             	movslq %edx,%rdx
+  80070f:	40 88 74 11 08       	mov    %sil,0x8(%rcx,%rdx,1)
+    if (b->idx == 256-1) {
+  800714:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800718:	8b 12                	mov    (%rdx),%edx
+  80071a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800720:	75 33                	jne    800755 <putch+0x86>
+        sys_cputs(b->buf, b->idx);
+  800722:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800726:	8b 12                	mov    (%rdx),%edx
+  800728:	48 63 d2             	movslq %edx,%rdx
+  80072b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80072f:	48 83 c1 08          	add    $0x8,%rcx
+  800733:	48 89 d6             	mov    %rdx,%rsi
+  800736:	48 89 cf             	mov    %rcx,%rdi
+  800739:	49 89 c7             	mov    %rax,%r15
+  80073c:	48 ba d3 90 ff ff ff 	movabs $0xffffffffffff90d3,%rdx
+  800743:	ff ff ff 
+  800746:	48 01 c2             	add    %rax,%rdx
+  800749:	ff d2                	call   *%rdx
+        b->idx = 0;
+  80074b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80074f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    b->cnt++;
+  800755:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800759:	8b 40 04             	mov    0x4(%rax),%eax
+  80075c:	8d 50 01             	lea    0x1(%rax),%edx
+  80075f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800763:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800766:	90                   	nop
+  800767:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80076b:	c9                   	leave
+  80076c:	c3                   	ret
+
+000000000080076d <vcprintf>:
+
+    int
+vcprintf(const char *fmt, va_list ap)
+{
+  80076d:	55                   	push   %rbp
+  80076e:	48 89 e5             	mov    %rsp,%rbp
+  800771:	41 57                	push   %r15
+  800773:	53                   	push   %rbx
+  800774:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  80077b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80077b <vcprintf+0xe>
+  800782:	49 bb c5 88 00 00 00 	movabs $0x88c5,%r11
+  800789:	00 00 00 
+  80078c:	4c 01 db             	add    %r11,%rbx
+  80078f:	48 89 bd b8 fe ff ff 	mov    %rdi,-0x148(%rbp)
+  800796:	48 89 b5 b0 fe ff ff 	mov    %rsi,-0x150(%rbp)
+    struct printbuf b;
+    va_list aq;
+    va_copy(aq,ap);
+  80079d:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8007a4:	48 8b b5 b0 fe ff ff 	mov    -0x150(%rbp),%rsi
+  8007ab:	48 8b 06             	mov    (%rsi),%rax
+  8007ae:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8007b2:	48 89 01             	mov    %rax,(%rcx)
+  8007b5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8007b9:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8007bd:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    b.idx = 0;
+  8007c1:	c7 85 e0 fe ff ff 00 	movl   $0x0,-0x120(%rbp)
+  8007c8:	00 00 00 
+    b.cnt = 0;
+  8007cb:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  8007d2:	00 00 00 
+    vprintfmt((void*)putch, &b, fmt, aq);
+  8007d5:	48 8d 8d c8 fe ff ff 	lea    -0x138(%rbp),%rcx
+  8007dc:	48 8b 95 b8 fe ff ff 	mov    -0x148(%rbp),%rdx
+  8007e3:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  8007ea:	48 89 c6             	mov    %rax,%rsi
+  8007ed:	48 b8 8f 76 ff ff ff 	movabs $0xffffffffffff768f,%rax
+  8007f4:	ff ff ff 
+  8007f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8007fb:	48 89 c7             	mov    %rax,%rdi
+  8007fe:	49 89 df             	mov    %rbx,%r15
+  800801:	48 b8 51 7c ff ff ff 	movabs $0xffffffffffff7c51,%rax
+  800808:	ff ff ff 
+  80080b:	48 01 d8             	add    %rbx,%rax
+  80080e:	ff d0                	call   *%rax
+    sys_cputs(b.buf, b.idx);
+  800810:	8b 85 e0 fe ff ff    	mov    -0x120(%rbp),%eax
+  800816:	48 98                	cltq
+  800818:	48 8d 95 e0 fe ff ff 	lea    -0x120(%rbp),%rdx
+  80081f:	48 83 c2 08          	add    $0x8,%rdx
+  800823:	48 89 c6             	mov    %rax,%rsi
+  800826:	48 89 d7             	mov    %rdx,%rdi
+  800829:	49 89 df             	mov    %rbx,%r15
+  80082c:	48 b8 d3 90 ff ff ff 	movabs $0xffffffffffff90d3,%rax
+  800833:	ff ff ff 
+  800836:	48 01 d8             	add    %rbx,%rax
+  800839:	ff d0                	call   *%rax
+    va_end(aq);
+
+    return b.cnt;
+  80083b:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+}
+  800841:	48 81 c4 40 01 00 00 	add    $0x140,%rsp
+  800848:	5b                   	pop    %rbx
+  800849:	41 5f                	pop    %r15
+  80084b:	5d                   	pop    %rbp
+  80084c:	c3                   	ret
+
+000000000080084d <cprintf>:
+
+    int
+cprintf(const char *fmt, ...)
+{
+  80084d:	55                   	push   %rbp
+  80084e:	48 89 e5             	mov    %rsp,%rbp
+  800851:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800858:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 800858 <cprintf+0xb>
+  80085f:	49 bb e8 87 00 00 00 	movabs $0x87e8,%r11
+  800866:	00 00 00 
+  800869:	4d 01 da             	add    %r11,%r10
+  80086c:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  800873:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80087a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800881:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800888:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80088f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800896:	84 c0                	test   %al,%al
+  800898:	74 20                	je     8008ba <cprintf+0x6d>
+  80089a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80089e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8008a2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8008a6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8008aa:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8008ae:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8008b2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8008b6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+    va_list ap;
+    int cnt;
+    va_list aq;
+    va_start(ap, fmt);
+  8008ba:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8008c1:	00 00 00 
+  8008c4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8008cb:	00 00 00 
+  8008ce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008d2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8008d9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8008e0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    va_copy(aq,ap);
+  8008e7:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  8008ee:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  8008f5:	48 8b 06             	mov    (%rsi),%rax
+  8008f8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8008fc:	48 89 01             	mov    %rax,(%rcx)
+  8008ff:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800903:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800907:	48 89 41 10          	mov    %rax,0x10(%rcx)
+    cnt = vcprintf(fmt, aq);
+  80090b:	48 8d 95 18 ff ff ff 	lea    -0xe8(%rbp),%rdx
+  800912:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800919:	48 89 d6             	mov    %rdx,%rsi
+  80091c:	48 89 c7             	mov    %rax,%rdi
+  80091f:	48 b8 2d 77 ff ff ff 	movabs $0xffffffffffff772d,%rax
+  800926:	ff ff ff 
+  800929:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80092d:	ff d0                	call   *%rax
+  80092f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+    va_end(aq);
+
+    return cnt;
+  800935:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80093b:	c9                   	leave
+  80093c:	c3                   	ret
+
+000000000080093d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80093d:	55                   	push   %rbp
+  80093e:	48 89 e5             	mov    %rsp,%rbp
+  800941:	53                   	push   %rbx
+  800942:	48 83 ec 38          	sub    $0x38,%rsp
+  800946:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 800946 <printnum+0x9>
+  80094d:	49 bb fa 86 00 00 00 	movabs $0x86fa,%r11
+  800954:	00 00 00 
+  800957:	4c 01 db             	add    %r11,%rbx
+  80095a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80095e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800962:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  800966:	89 4d d4             	mov    %ecx,-0x2c(%rbp)
+  800969:	44 89 45 d0          	mov    %r8d,-0x30(%rbp)
+  80096d:	44 89 4d cc          	mov    %r9d,-0x34(%rbp)
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800971:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800974:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800978:	72 58                	jb     8009d2 <printnum+0x95>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80097a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80097d:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800980:	8b 75 d4             	mov    -0x2c(%rbp),%esi
+  800983:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800987:	ba 00 00 00 00       	mov    $0x0,%edx
+  80098c:	48 f7 f6             	div    %rsi
+  80098f:	49 89 c2             	mov    %rax,%r10
+  800992:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  800995:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  800998:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80099c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009a0:	41 89 c9             	mov    %ecx,%r9d
+  8009a3:	41 89 f8             	mov    %edi,%r8d
+  8009a6:	89 d1                	mov    %edx,%ecx
+  8009a8:	4c 89 d2             	mov    %r10,%rdx
+  8009ab:	48 89 c7             	mov    %rax,%rdi
+  8009ae:	48 b8 fd 78 ff ff ff 	movabs $0xffffffffffff78fd,%rax
+  8009b5:	ff ff ff 
+  8009b8:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8009bc:	ff d0                	call   *%rax
+  8009be:	eb 1c                	jmp    8009dc <printnum+0x9f>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8009c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8009c4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8009c7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8009cb:	48 89 d6             	mov    %rdx,%rsi
+  8009ce:	89 c7                	mov    %eax,%edi
+  8009d0:	ff d1                	call   *%rcx
+		while (--width > 0)
+  8009d2:	83 6d d0 01          	subl   $0x1,-0x30(%rbp)
+  8009d6:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+  8009da:	7f e4                	jg     8009c0 <printnum+0x83>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8009dc:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8009df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8009e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009e8:	48 f7 f1             	div    %rcx
+  8009eb:	48 b8 cf e0 ff ff ff 	movabs $0xffffffffffffe0cf,%rax
+  8009f2:	ff ff ff 
+  8009f5:	48 01 d8             	add    %rbx,%rax
+  8009f8:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8009fc:	0f be c0             	movsbl %al,%eax
+  8009ff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a03:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800a07:	48 89 d6             	mov    %rdx,%rsi
+  800a0a:	89 c7                	mov    %eax,%edi
+  800a0c:	ff d1                	call   *%rcx
+}
+  800a0e:	90                   	nop
+  800a0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800a13:	c9                   	leave
+  800a14:	c3                   	ret
+
+0000000000800a15 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag)
+{
+  800a15:	55                   	push   %rbp
+  800a16:	48 89 e5             	mov    %rsp,%rbp
+  800a19:	48 83 ec 20          	sub    $0x20,%rsp
+  800a1d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800a1d <getuint+0x8>
+  800a24:	49 bb 23 86 00 00 00 	movabs $0x8623,%r11
+  800a2b:	00 00 00 
+  800a2e:	4c 01 d8             	add    %r11,%rax
+  800a31:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a35:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	unsigned long long x;    
+	if (lflag >= 2)
+  800a38:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800a3c:	7e 4f                	jle    800a8d <getuint+0x78>
+		x= va_arg(*ap, unsigned long long);
+  800a3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a42:	8b 00                	mov    (%rax),%eax
+  800a44:	83 f8 2f             	cmp    $0x2f,%eax
+  800a47:	77 24                	ja     800a6d <getuint+0x58>
+  800a49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a4d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a55:	8b 00                	mov    (%rax),%eax
+  800a57:	89 c0                	mov    %eax,%eax
+  800a59:	48 01 d0             	add    %rdx,%rax
+  800a5c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a60:	8b 12                	mov    (%rdx),%edx
+  800a62:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a65:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a69:	89 0a                	mov    %ecx,(%rdx)
+  800a6b:	eb 14                	jmp    800a81 <getuint+0x6c>
+  800a6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a71:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a75:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a79:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800a7d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a81:	48 8b 00             	mov    (%rax),%rax
+  800a84:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800a88:	e9 9d 00 00 00       	jmp    800b2a <getuint+0x115>
+	else if (lflag)
+  800a8d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800a91:	74 4c                	je     800adf <getuint+0xca>
+		x= va_arg(*ap, unsigned long);
+  800a93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a97:	8b 00                	mov    (%rax),%eax
+  800a99:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9c:	77 24                	ja     800ac2 <getuint+0xad>
+  800a9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aa2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800aa6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aaa:	8b 00                	mov    (%rax),%eax
+  800aac:	89 c0                	mov    %eax,%eax
+  800aae:	48 01 d0             	add    %rdx,%rax
+  800ab1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ab5:	8b 12                	mov    (%rdx),%edx
+  800ab7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800aba:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800abe:	89 0a                	mov    %ecx,(%rdx)
+  800ac0:	eb 14                	jmp    800ad6 <getuint+0xc1>
+  800ac2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ac6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800aca:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ace:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ad2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ad6:	48 8b 00             	mov    (%rax),%rax
+  800ad9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800add:	eb 4b                	jmp    800b2a <getuint+0x115>
+	else
+		x= va_arg(*ap, unsigned int);
+  800adf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ae3:	8b 00                	mov    (%rax),%eax
+  800ae5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae8:	77 24                	ja     800b0e <getuint+0xf9>
+  800aea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800aee:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800af2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800af6:	8b 00                	mov    (%rax),%eax
+  800af8:	89 c0                	mov    %eax,%eax
+  800afa:	48 01 d0             	add    %rdx,%rax
+  800afd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b01:	8b 12                	mov    (%rdx),%edx
+  800b03:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b06:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b0a:	89 0a                	mov    %ecx,(%rdx)
+  800b0c:	eb 14                	jmp    800b22 <getuint+0x10d>
+  800b0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b12:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b16:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b1a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800b1e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b22:	8b 00                	mov    (%rax),%eax
+  800b24:	89 c0                	mov    %eax,%eax
+  800b26:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800b2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800b2e:	c9                   	leave
+  800b2f:	c3                   	ret
+
+0000000000800b30 <printfloat>:
+
+//default precision will be 8
+static void
+printfloat(void (*putch)(int, void*), void *putdat,
+         unsigned long long num){
+  800b30:	55                   	push   %rbp
+  800b31:	48 89 e5             	mov    %rsp,%rbp
+  800b34:	48 83 ec 20          	sub    $0x20,%rsp
+  800b38:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b38 <printfloat+0x8>
+  800b3f:	49 bb 08 85 00 00 00 	movabs $0x8508,%r11
+  800b46:	00 00 00 
+  800b49:	4c 01 d8             	add    %r11,%rax
+  800b4c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800b50:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800b54:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	if (num & (((unsigned long long)1)<<63))
+  800b58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b5c:	48 85 c0             	test   %rax,%rax
+  800b5f:	79 12                	jns    800b73 <printfloat+0x43>
+		putch('-',putdat);
+  800b61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b65:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b69:	48 89 c6             	mov    %rax,%rsi
+  800b6c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b71:	ff d2                	call   *%rdx
+	
+}
+  800b73:	90                   	nop
+  800b74:	c9                   	leave
+  800b75:	c3                   	ret
+
+0000000000800b76 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag)
+{
+  800b76:	55                   	push   %rbp
+  800b77:	48 89 e5             	mov    %rsp,%rbp
+  800b7a:	48 83 ec 20          	sub    $0x20,%rsp
+  800b7e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 800b7e <getint+0x8>
+  800b85:	49 bb c2 84 00 00 00 	movabs $0x84c2,%r11
+  800b8c:	00 00 00 
+  800b8f:	4c 01 d8             	add    %r11,%rax
+  800b92:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b96:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	long long x;
+	if (lflag >= 2)
+  800b99:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800b9d:	7e 4f                	jle    800bee <getint+0x78>
+		x=va_arg(*ap, long long);
+  800b9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba3:	8b 00                	mov    (%rax),%eax
+  800ba5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba8:	77 24                	ja     800bce <getint+0x58>
+  800baa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bae:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800bb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bb6:	8b 00                	mov    (%rax),%eax
+  800bb8:	89 c0                	mov    %eax,%eax
+  800bba:	48 01 d0             	add    %rdx,%rax
+  800bbd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bc1:	8b 12                	mov    (%rdx),%edx
+  800bc3:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bc6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bca:	89 0a                	mov    %ecx,(%rdx)
+  800bcc:	eb 14                	jmp    800be2 <getint+0x6c>
+  800bce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bd2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bd6:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bda:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800bde:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800be2:	48 8b 00             	mov    (%rax),%rax
+  800be5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800be9:	e9 9d 00 00 00       	jmp    800c8b <getint+0x115>
+	else if (lflag)
+  800bee:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800bf2:	74 4c                	je     800c40 <getint+0xca>
+		x=va_arg(*ap, long);
+  800bf4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf8:	8b 00                	mov    (%rax),%eax
+  800bfa:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfd:	77 24                	ja     800c23 <getint+0xad>
+  800bff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c03:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c0b:	8b 00                	mov    (%rax),%eax
+  800c0d:	89 c0                	mov    %eax,%eax
+  800c0f:	48 01 d0             	add    %rdx,%rax
+  800c12:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c16:	8b 12                	mov    (%rdx),%edx
+  800c18:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c1b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c1f:	89 0a                	mov    %ecx,(%rdx)
+  800c21:	eb 14                	jmp    800c37 <getint+0xc1>
+  800c23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c27:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c2b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c2f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c33:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c37:	48 8b 00             	mov    (%rax),%rax
+  800c3a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  800c3e:	eb 4b                	jmp    800c8b <getint+0x115>
+	else
+		x=va_arg(*ap, int);
+  800c40:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c44:	8b 00                	mov    (%rax),%eax
+  800c46:	83 f8 2f             	cmp    $0x2f,%eax
+  800c49:	77 24                	ja     800c6f <getint+0xf9>
+  800c4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c4f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800c53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c57:	8b 00                	mov    (%rax),%eax
+  800c59:	89 c0                	mov    %eax,%eax
+  800c5b:	48 01 d0             	add    %rdx,%rax
+  800c5e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c62:	8b 12                	mov    (%rdx),%edx
+  800c64:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800c67:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c6b:	89 0a                	mov    %ecx,(%rdx)
+  800c6d:	eb 14                	jmp    800c83 <getint+0x10d>
+  800c6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c73:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c77:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800c7b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c7f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800c83:	8b 00                	mov    (%rax),%eax
+  800c85:	48 98                	cltq
+  800c87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	return x;
+  800c8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  800c8f:	c9                   	leave
+  800c90:	c3                   	ret
+
+0000000000800c91 <vprintfmt>:
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void*), void *putdat, const char *fmt, va_list ap)
+{
+  800c91:	55                   	push   %rbp
+  800c92:	48 89 e5             	mov    %rsp,%rbp
+  800c95:	41 57                	push   %r15
+  800c97:	41 55                	push   %r13
+  800c99:	41 54                	push   %r12
+  800c9b:	53                   	push   %rbx
+  800c9c:	48 83 ec 60          	sub    $0x60,%rsp
+  800ca0:	4c 8d 25 f9 ff ff ff 	lea    -0x7(%rip),%r12        # 800ca0 <vprintfmt+0xf>
+  800ca7:	49 bb a0 83 00 00 00 	movabs $0x83a0,%r11
+  800cae:	00 00 00 
+  800cb1:	4d 01 dc             	add    %r11,%r12
+  800cb4:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800cb8:	48 89 75 90          	mov    %rsi,-0x70(%rbp)
+  800cbc:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800cc0:	48 89 4d 80          	mov    %rcx,-0x80(%rbp)
+	register int ch, err;
+	unsigned long long num;
+	int base, lflag, width, precision, altflag;
+	char padc;
+	va_list aq;
+	int textcolor = 0;
+  800cc4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+	va_copy(aq,ap);
+  800ccb:	48 8d 4d a0          	lea    -0x60(%rbp),%rcx
+  800ccf:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  800cd3:	48 8b 06             	mov    (%rsi),%rax
+  800cd6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800cda:	48 89 01             	mov    %rax,(%rcx)
+  800cdd:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ce1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ce5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	while (1) {
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800ce9:	eb 17                	jmp    800d02 <vprintfmt+0x71>
+			if (ch == '\0')
+  800ceb:	85 db                	test   %ebx,%ebx
+  800ced:	0f 84 97 05 00 00    	je     80128a <vprintfmt+0x5f9>
+				return;
+			putch(ch, putdat);
+  800cf3:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  800cf7:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  800cfb:	48 89 c6             	mov    %rax,%rsi
+  800cfe:	89 df                	mov    %ebx,%edi
+  800d00:	ff d2                	call   *%rdx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800d02:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d06:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d0a:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d0e:	0f b6 00             	movzbl (%rax),%eax
+  800d11:	0f b6 d8             	movzbl %al,%ebx
+  800d14:	83 fb 25             	cmp    $0x25,%ebx
+  800d17:	75 d2                	jne    800ceb <vprintfmt+0x5a>
+		}
+
+		// Process a %-escape sequence
+		padc = ' ';
+  800d19:	c6 45 c3 20          	movb   $0x20,-0x3d(%rbp)
+		width = -1;
+  800d1d:	c7 45 cc ff ff ff ff 	movl   $0xffffffff,-0x34(%rbp)
+		precision = -1;
+  800d24:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+		lflag = 0;
+  800d2b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+		altflag = 0;
+  800d32:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%rbp)
+	reswitch:
+		switch (ch = *(unsigned char *) fmt++) {
+  800d39:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800d3d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800d41:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  800d45:	0f b6 00             	movzbl (%rax),%eax
+  800d48:	0f b6 d8             	movzbl %al,%ebx
+  800d4b:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800d4e:	83 f8 55             	cmp    $0x55,%eax
+  800d51:	0f 87 00 05 00 00    	ja     801257 <vprintfmt+0x5c6>
+  800d57:	89 c0                	mov    %eax,%eax
+  800d59:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800d60:	00 
+  800d61:	48 8d 05 d0 63 00 00 	lea    0x63d0(%rip),%rax        # 807138 <.LC18+0xc>
+  800d68:	48 8b 04 02          	mov    (%rdx,%rax,1),%rax
+  800d6c:	48 8d 15 c5 63 00 00 	lea    0x63c5(%rip),%rdx        # 807138 <.LC18+0xc>
+  800d73:	48 01 d0             	add    %rdx,%rax
+  800d76:	ff e0                	jmp    *%rax
+
+			// flag to pad on the right
+		case '-':
+			padc = '-';
+  800d78:	c6 45 c3 2d          	movb   $0x2d,-0x3d(%rbp)
+			goto reswitch;
+  800d7c:	eb bb                	jmp    800d39 <vprintfmt+0xa8>
+
+			// flag to pad with 0's instead of spaces
+		case '0':
+			padc = '0';
+  800d7e:	c6 45 c3 30          	movb   $0x30,-0x3d(%rbp)
+			goto reswitch;
+  800d82:	eb b5                	jmp    800d39 <vprintfmt+0xa8>
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			for (precision = 0; ; ++fmt) {
+  800d84:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%rbp)
+				precision = precision * 10 + ch - '0';
+  800d8b:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  800d8e:	89 d0                	mov    %edx,%eax
+  800d90:	c1 e0 02             	shl    $0x2,%eax
+  800d93:	01 d0                	add    %edx,%eax
+  800d95:	01 c0                	add    %eax,%eax
+  800d97:	01 d8                	add    %ebx,%eax
+  800d99:	83 e8 30             	sub    $0x30,%eax
+  800d9c:	89 45 c8             	mov    %eax,-0x38(%rbp)
+				ch = *fmt;
+  800d9f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  800da3:	0f b6 00             	movzbl (%rax),%eax
+  800da6:	0f be d8             	movsbl %al,%ebx
+				if (ch < '0' || ch > '9')
+  800da9:	83 fb 2f             	cmp    $0x2f,%ebx
+  800dac:	7e 60                	jle    800e0e <vprintfmt+0x17d>
+  800dae:	83 fb 39             	cmp    $0x39,%ebx
+  800db1:	7f 5b                	jg     800e0e <vprintfmt+0x17d>
+			for (precision = 0; ; ++fmt) {
+  800db3:	48 83 45 88 01       	addq   $0x1,-0x78(%rbp)
+				precision = precision * 10 + ch - '0';
+  800db8:	eb d1                	jmp    800d8b <vprintfmt+0xfa>
+					break;
+			}
+			goto process_precision;
+
+		case '*':
+			precision = va_arg(aq, int);
+  800dba:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800dbd:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc0:	77 17                	ja     800dd9 <vprintfmt+0x148>
+  800dc2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800dc6:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dc9:	89 d2                	mov    %edx,%edx
+  800dcb:	48 01 d0             	add    %rdx,%rax
+  800dce:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800dd1:	83 c2 08             	add    $0x8,%edx
+  800dd4:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800dd7:	eb 0c                	jmp    800de5 <vprintfmt+0x154>
+  800dd9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ddd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800de1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800de5:	8b 00                	mov    (%rax),%eax
+  800de7:	89 45 c8             	mov    %eax,-0x38(%rbp)
+			goto process_precision;
+  800dea:	eb 23                	jmp    800e0f <vprintfmt+0x17e>
+
+		case '.':
+			if (width < 0)
+  800dec:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800df0:	0f 89 43 ff ff ff    	jns    800d39 <vprintfmt+0xa8>
+				width = 0;
+  800df6:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+			goto reswitch;
+  800dfd:	e9 37 ff ff ff       	jmp    800d39 <vprintfmt+0xa8>
+
+		case '#':
+			altflag = 1;
+  800e02:	c7 45 c4 01 00 00 00 	movl   $0x1,-0x3c(%rbp)
+			goto reswitch;
+  800e09:	e9 2b ff ff ff       	jmp    800d39 <vprintfmt+0xa8>
+			goto process_precision;
+  800e0e:	90                   	nop
+
+		process_precision:
+			if (width < 0)
+  800e0f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800e13:	0f 89 20 ff ff ff    	jns    800d39 <vprintfmt+0xa8>
+				width = precision, precision = -1;
+  800e19:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800e1c:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800e1f:	c7 45 c8 ff ff ff ff 	movl   $0xffffffff,-0x38(%rbp)
+			goto reswitch;
+  800e26:	e9 0e ff ff ff       	jmp    800d39 <vprintfmt+0xa8>
+
+			// long flag (doubled for long long)
+		case 'l':
+			lflag++;
+  800e2b:	83 45 d0 01          	addl   $0x1,-0x30(%rbp)
+			goto reswitch;
+  800e2f:	e9 05 ff ff ff       	jmp    800d39 <vprintfmt+0xa8>
+
+		colorswitch:
+			
+			//for colors: normal, blue, green, teal, red, magenta, brown, light grey, dark grey, and purple	
+			if (ch >= '0' && ch <= '9'){
+  800e34:	83 fb 39             	cmp    $0x39,%ebx
+  800e37:	7f 0b                	jg     800e44 <vprintfmt+0x1b3>
+				textcolor += (ch - '0') << 8;
+  800e39:	8d 43 d0             	lea    -0x30(%rbx),%eax
+  800e3c:	c1 e0 08             	shl    $0x8,%eax
+  800e3f:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e42:	eb 21                	jmp    800e65 <vprintfmt+0x1d4>
+			}
+			//for colors: neon green, neon teal, orange, pink, yellow, white
+			else if (ch >= 'a' && ch <= 'f'){
+  800e44:	83 fb 60             	cmp    $0x60,%ebx
+  800e47:	7e 10                	jle    800e59 <vprintfmt+0x1c8>
+  800e49:	83 fb 66             	cmp    $0x66,%ebx
+  800e4c:	7f 0b                	jg     800e59 <vprintfmt+0x1c8>
+				textcolor += ((ch - 'a')+ 10) << 8;
+  800e4e:	8d 43 a9             	lea    -0x57(%rbx),%eax
+  800e51:	c1 e0 08             	shl    $0x8,%eax
+  800e54:	01 45 bc             	add    %eax,-0x44(%rbp)
+  800e57:	eb 0c                	jmp    800e65 <vprintfmt+0x1d4>
+			}
+			//invalid color - print with no colors.
+			else {
+				textcolor = 0;
+  800e59:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+			}
+			goto printstring;
+  800e60:	e9 04 01 00 00       	jmp    800f69 <vprintfmt+0x2d8>
+  800e65:	e9 ff 00 00 00       	jmp    800f69 <vprintfmt+0x2d8>
+
+
+			// character
+		case 'c':
+			putch(va_arg(aq, int), putdat);
+  800e6a:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800e6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e70:	77 17                	ja     800e89 <vprintfmt+0x1f8>
+  800e72:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800e76:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e79:	89 d2                	mov    %edx,%edx
+  800e7b:	48 01 d0             	add    %rdx,%rax
+  800e7e:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800e81:	83 c2 08             	add    $0x8,%edx
+  800e84:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800e87:	eb 0c                	jmp    800e95 <vprintfmt+0x204>
+  800e89:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e8d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e91:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800e95:	8b 00                	mov    (%rax),%eax
+  800e97:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800e9b:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800e9f:	48 89 d6             	mov    %rdx,%rsi
+  800ea2:	89 c7                	mov    %eax,%edi
+  800ea4:	ff d1                	call   *%rcx
+			break;
+  800ea6:	e9 da 03 00 00       	jmp    801285 <vprintfmt+0x5f4>
+
+			// error message
+		case 'e':
+			err = va_arg(aq, int);
+  800eab:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800eae:	83 f8 2f             	cmp    $0x2f,%eax
+  800eb1:	77 17                	ja     800eca <vprintfmt+0x239>
+  800eb3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800eb7:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800eba:	89 d2                	mov    %edx,%edx
+  800ebc:	48 01 d0             	add    %rdx,%rax
+  800ebf:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800ec2:	83 c2 08             	add    $0x8,%edx
+  800ec5:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800ec8:	eb 0c                	jmp    800ed6 <vprintfmt+0x245>
+  800eca:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800ece:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ed2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800ed6:	8b 18                	mov    (%rax),%ebx
+			if (err < 0)
+  800ed8:	85 db                	test   %ebx,%ebx
+  800eda:	79 02                	jns    800ede <vprintfmt+0x24d>
+				err = -err;
+  800edc:	f7 db                	neg    %ebx
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800ede:	83 fb 15             	cmp    $0x15,%ebx
+  800ee1:	7f 19                	jg     800efc <vprintfmt+0x26b>
+  800ee3:	48 ba 40 01 00 00 00 	movabs $0x140,%rdx
+  800eea:	00 00 00 
+  800eed:	48 63 c3             	movslq %ebx,%rax
+  800ef0:	4c 01 e2             	add    %r12,%rdx
+  800ef3:	4c 8b 2c c2          	mov    (%rdx,%rax,8),%r13
+  800ef7:	4d 85 ed             	test   %r13,%r13
+  800efa:	75 36                	jne    800f32 <vprintfmt+0x2a1>
+				printfmt(putch, putdat, "error %d", err);
+  800efc:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f00:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f04:	89 d9                	mov    %ebx,%ecx
+  800f06:	48 ba e0 e0 ff ff ff 	movabs $0xffffffffffffe0e0,%rdx
+  800f0d:	ff ff ff 
+  800f10:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f14:	48 89 c7             	mov    %rax,%rdi
+  800f17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1c:	49 b8 58 82 ff ff ff 	movabs $0xffffffffffff8258,%r8
+  800f23:	ff ff ff 
+  800f26:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f2a:	41 ff d0             	call   *%r8
+			else
+				printfmt(putch, putdat, "%s", p);
+			break;
+  800f2d:	e9 53 03 00 00       	jmp    801285 <vprintfmt+0x5f4>
+				printfmt(putch, putdat, "%s", p);
+  800f32:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f36:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f3a:	4c 89 e9             	mov    %r13,%rcx
+  800f3d:	48 ba e9 e0 ff ff ff 	movabs $0xffffffffffffe0e9,%rdx
+  800f44:	ff ff ff 
+  800f47:	49 8d 14 14          	lea    (%r12,%rdx,1),%rdx
+  800f4b:	48 89 c7             	mov    %rax,%rdi
+  800f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f53:	49 b8 58 82 ff ff ff 	movabs $0xffffffffffff8258,%r8
+  800f5a:	ff ff ff 
+  800f5d:	4f 8d 04 04          	lea    (%r12,%r8,1),%r8
+  800f61:	41 ff d0             	call   *%r8
+			break;
+  800f64:	e9 1c 03 00 00       	jmp    801285 <vprintfmt+0x5f4>
+
+			// string
+		case 's':
+		printstring:
+			if ((p = va_arg(aq, char *)) == NULL)
+  800f69:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  800f6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f6f:	77 17                	ja     800f88 <vprintfmt+0x2f7>
+  800f71:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  800f75:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f78:	89 d2                	mov    %edx,%edx
+  800f7a:	48 01 d0             	add    %rdx,%rax
+  800f7d:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  800f80:	83 c2 08             	add    $0x8,%edx
+  800f83:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  800f86:	eb 0c                	jmp    800f94 <vprintfmt+0x303>
+  800f88:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f8c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800f90:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  800f94:	4c 8b 28             	mov    (%rax),%r13
+  800f97:	4d 85 ed             	test   %r13,%r13
+  800f9a:	75 0e                	jne    800faa <vprintfmt+0x319>
+				p = "(null)";
+  800f9c:	48 b8 ec e0 ff ff ff 	movabs $0xffffffffffffe0ec,%rax
+  800fa3:	ff ff ff 
+  800fa6:	4d 8d 2c 04          	lea    (%r12,%rax,1),%r13
+			if (width > 0 && padc != '-')
+  800faa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800fae:	0f 8e 84 00 00 00    	jle    801038 <vprintfmt+0x3a7>
+  800fb4:	80 7d c3 2d          	cmpb   $0x2d,-0x3d(%rbp)
+  800fb8:	74 7e                	je     801038 <vprintfmt+0x3a7>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800fba:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800fbd:	48 98                	cltq
+  800fbf:	48 89 c6             	mov    %rax,%rsi
+  800fc2:	4c 89 ef             	mov    %r13,%rdi
+  800fc5:	4d 89 e7             	mov    %r12,%r15
+  800fc8:	48 b8 7d 85 ff ff ff 	movabs $0xffffffffffff857d,%rax
+  800fcf:	ff ff ff 
+  800fd2:	4c 01 e0             	add    %r12,%rax
+  800fd5:	ff d0                	call   *%rax
+  800fd7:	29 45 cc             	sub    %eax,-0x34(%rbp)
+  800fda:	eb 17                	jmp    800ff3 <vprintfmt+0x362>
+					putch(padc, putdat);
+  800fdc:	0f be 45 c3          	movsbl -0x3d(%rbp),%eax
+  800fe0:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800fe4:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800fe8:	48 89 d6             	mov    %rdx,%rsi
+  800feb:	89 c7                	mov    %eax,%edi
+  800fed:	ff d1                	call   *%rcx
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800fef:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  800ff3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  800ff7:	7f e3                	jg     800fdc <vprintfmt+0x34b>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ff9:	eb 3d                	jmp    801038 <vprintfmt+0x3a7>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800ffb:	83 7d c4 00          	cmpl   $0x0,-0x3c(%rbp)
+  800fff:	74 1e                	je     80101f <vprintfmt+0x38e>
+  801001:	83 fb 1f             	cmp    $0x1f,%ebx
+  801004:	7e 05                	jle    80100b <vprintfmt+0x37a>
+  801006:	83 fb 7e             	cmp    $0x7e,%ebx
+  801009:	7e 14                	jle    80101f <vprintfmt+0x38e>
+					putch('?', putdat);
+  80100b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80100f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801013:	48 89 c6             	mov    %rax,%rsi
+  801016:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80101b:	ff d2                	call   *%rdx
+  80101d:	eb 15                	jmp    801034 <vprintfmt+0x3a3>
+				else
+					putch(ch + textcolor, putdat);
+  80101f:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801022:	8d 0c 03             	lea    (%rbx,%rax,1),%ecx
+  801025:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  801029:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80102d:	48 89 c6             	mov    %rax,%rsi
+  801030:	89 cf                	mov    %ecx,%edi
+  801032:	ff d2                	call   *%rdx
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801034:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801038:	4c 89 e8             	mov    %r13,%rax
+  80103b:	4c 8d 68 01          	lea    0x1(%rax),%r13
+  80103f:	0f b6 00             	movzbl (%rax),%eax
+  801042:	0f be d8             	movsbl %al,%ebx
+  801045:	85 db                	test   %ebx,%ebx
+  801047:	74 28                	je     801071 <vprintfmt+0x3e0>
+  801049:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  80104d:	78 ac                	js     800ffb <vprintfmt+0x36a>
+  80104f:	83 6d c8 01          	subl   $0x1,-0x38(%rbp)
+  801053:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  801057:	79 a2                	jns    800ffb <vprintfmt+0x36a>
+			for (; width > 0; width--)
+  801059:	eb 16                	jmp    801071 <vprintfmt+0x3e0>
+				putch(' ', putdat);
+  80105b:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80105f:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801063:	48 89 c6             	mov    %rax,%rsi
+  801066:	bf 20 00 00 00       	mov    $0x20,%edi
+  80106b:	ff d2                	call   *%rdx
+			for (; width > 0; width--)
+  80106d:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  801071:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801075:	7f e4                	jg     80105b <vprintfmt+0x3ca>
+			break;
+  801077:	e9 09 02 00 00       	jmp    801285 <vprintfmt+0x5f4>
+
+		//printing colors
+		case 'r':
+			ch = *(unsigned char *) fmt++;
+  80107c:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801080:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801084:	48 89 55 88          	mov    %rdx,-0x78(%rbp)
+  801088:	0f b6 00             	movzbl (%rax),%eax
+  80108b:	0f b6 d8             	movzbl %al,%ebx
+			goto colorswitch;
+  80108e:	90                   	nop
+			if (ch >= '0' && ch <= '9'){
+  80108f:	83 fb 2f             	cmp    $0x2f,%ebx
+  801092:	0f 8e ac fd ff ff    	jle    800e44 <vprintfmt+0x1b3>
+  801098:	e9 97 fd ff ff       	jmp    800e34 <vprintfmt+0x1a3>
+
+			// (signed) decimal
+		case 'd':
+			num = getint(&aq, 3);
+  80109d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010a1:	be 03 00 00 00       	mov    $0x3,%esi
+  8010a6:	48 89 c7             	mov    %rax,%rdi
+  8010a9:	48 b8 36 7b ff ff ff 	movabs $0xffffffffffff7b36,%rax
+  8010b0:	ff ff ff 
+  8010b3:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010b7:	ff d0                	call   *%rax
+  8010b9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			if ((long long) num < 0) {
+  8010bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010c1:	48 85 c0             	test   %rax,%rax
+  8010c4:	79 1d                	jns    8010e3 <vprintfmt+0x452>
+				putch('-', putdat);
+  8010c6:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  8010ca:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  8010ce:	48 89 c6             	mov    %rax,%rsi
+  8010d1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8010d6:	ff d2                	call   *%rdx
+				num = -(long long) num;
+  8010d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010dc:	48 f7 d8             	neg    %rax
+  8010df:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			}
+			base = 10;
+  8010e3:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  8010ea:	e9 de 00 00 00       	jmp    8011cd <vprintfmt+0x53c>
+
+			// unsigned decimal
+		case 'u':
+			num = getuint(&aq, 3);
+  8010ef:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8010f3:	be 03 00 00 00       	mov    $0x3,%esi
+  8010f8:	48 89 c7             	mov    %rax,%rdi
+  8010fb:	48 b8 d5 79 ff ff ff 	movabs $0xffffffffffff79d5,%rax
+  801102:	ff ff ff 
+  801105:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801109:	ff d0                	call   *%rax
+  80110b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 10;
+  80110f:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%rbp)
+			goto number;
+  801116:	e9 b2 00 00 00       	jmp    8011cd <vprintfmt+0x53c>
+
+			// (unsigned) octal
+		case 'o':
+			// Replace this with your code.
+			num = getuint(&aq,3);
+  80111b:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  80111f:	be 03 00 00 00       	mov    $0x3,%esi
+  801124:	48 89 c7             	mov    %rax,%rdi
+  801127:	48 b8 d5 79 ff ff ff 	movabs $0xffffffffffff79d5,%rax
+  80112e:	ff ff ff 
+  801131:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801135:	ff d0                	call   *%rax
+  801137:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 8;
+  80113b:	c7 45 d4 08 00 00 00 	movl   $0x8,-0x2c(%rbp)
+			goto number;
+  801142:	e9 86 00 00 00       	jmp    8011cd <vprintfmt+0x53c>
+			
+
+			// pointer
+		case 'p':
+			putch('0', putdat);
+  801147:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80114b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80114f:	48 89 c6             	mov    %rax,%rsi
+  801152:	bf 30 00 00 00       	mov    $0x30,%edi
+  801157:	ff d2                	call   *%rdx
+			putch('x', putdat);
+  801159:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80115d:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  801161:	48 89 c6             	mov    %rax,%rsi
+  801164:	bf 78 00 00 00       	mov    $0x78,%edi
+  801169:	ff d2                	call   *%rdx
+			num = (unsigned long long)
+				(uintptr_t) va_arg(aq, void *);
+  80116b:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  80116e:	83 f8 2f             	cmp    $0x2f,%eax
+  801171:	77 17                	ja     80118a <vprintfmt+0x4f9>
+  801173:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801177:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  80117a:	89 d2                	mov    %edx,%edx
+  80117c:	48 01 d0             	add    %rdx,%rax
+  80117f:	8b 55 a0             	mov    -0x60(%rbp),%edx
+  801182:	83 c2 08             	add    $0x8,%edx
+  801185:	89 55 a0             	mov    %edx,-0x60(%rbp)
+  801188:	eb 0c                	jmp    801196 <vprintfmt+0x505>
+  80118a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80118e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801192:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  801196:	48 8b 00             	mov    (%rax),%rax
+			num = (unsigned long long)
+  801199:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  80119d:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+			goto number;
+  8011a4:	eb 27                	jmp    8011cd <vprintfmt+0x53c>
+
+			// (unsigned) hexadecimal
+		case 'x':
+			num = getuint(&aq, 3);
+  8011a6:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  8011aa:	be 03 00 00 00       	mov    $0x3,%esi
+  8011af:	48 89 c7             	mov    %rax,%rdi
+  8011b2:	48 b8 d5 79 ff ff ff 	movabs $0xffffffffffff79d5,%rax
+  8011b9:	ff ff ff 
+  8011bc:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011c0:	ff d0                	call   *%rax
+  8011c2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			base = 16;
+  8011c6:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%rbp)
+		number:
+			printnum(putch, putdat, num, base, width, padc);
+  8011cd:	44 0f be 45 c3       	movsbl -0x3d(%rbp),%r8d
+  8011d2:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8011d5:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8011d8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8011dc:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8011e0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8011e4:	45 89 c1             	mov    %r8d,%r9d
+  8011e7:	41 89 f8             	mov    %edi,%r8d
+  8011ea:	48 89 c7             	mov    %rax,%rdi
+  8011ed:	48 b8 fd 78 ff ff ff 	movabs $0xffffffffffff78fd,%rax
+  8011f4:	ff ff ff 
+  8011f7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011fb:	ff d0                	call   *%rax
+			break;
+  8011fd:	e9 83 00 00 00       	jmp    801285 <vprintfmt+0x5f4>
+
+			//floating point numbers
+		case 'f':
+			num = getuint(&aq, 3);
+  801202:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  801206:	be 03 00 00 00       	mov    $0x3,%esi
+  80120b:	48 89 c7             	mov    %rax,%rdi
+  80120e:	48 b8 d5 79 ff ff ff 	movabs $0xffffffffffff79d5,%rax
+  801215:	ff ff ff 
+  801218:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80121c:	ff d0                	call   *%rax
+  80121e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+			printfloat(putch,putdat,num);
+  801222:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801226:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80122a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80122e:	48 89 ce             	mov    %rcx,%rsi
+  801231:	48 89 c7             	mov    %rax,%rdi
+  801234:	48 b8 f0 7a ff ff ff 	movabs $0xffffffffffff7af0,%rax
+  80123b:	ff ff ff 
+  80123e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801242:	ff d0                	call   *%rax
+	
+			break;
+  801244:	eb 3f                	jmp    801285 <vprintfmt+0x5f4>
+
+
+			// escaped '%' character
+		case '%':
+			putch(ch, putdat);
+  801246:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80124a:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80124e:	48 89 c6             	mov    %rax,%rsi
+  801251:	89 df                	mov    %ebx,%edi
+  801253:	ff d2                	call   *%rdx
+			break;
+  801255:	eb 2e                	jmp    801285 <vprintfmt+0x5f4>
+
+			// unrecognized escape sequence - just print it literally
+		default:
+			putch('%', putdat);
+  801257:	48 8b 45 90          	mov    -0x70(%rbp),%rax
+  80125b:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  80125f:	48 89 c6             	mov    %rax,%rsi
+  801262:	bf 25 00 00 00       	mov    $0x25,%edi
+  801267:	ff d2                	call   *%rdx
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  801269:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  80126e:	eb 05                	jmp    801275 <vprintfmt+0x5e4>
+  801270:	48 83 6d 88 01       	subq   $0x1,-0x78(%rbp)
+  801275:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  801279:	48 83 e8 01          	sub    $0x1,%rax
+  80127d:	0f b6 00             	movzbl (%rax),%eax
+  801280:	3c 25                	cmp    $0x25,%al
+  801282:	75 ec                	jne    801270 <vprintfmt+0x5df>
+				/* do nothing */;
+			break;
+  801284:	90                   	nop
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  801285:	e9 78 fa ff ff       	jmp    800d02 <vprintfmt+0x71>
+				return;
+  80128a:	90                   	nop
+		}
+	}
+	va_end(aq);
+}
+  80128b:	48 83 c4 60          	add    $0x60,%rsp
+  80128f:	5b                   	pop    %rbx
+  801290:	41 5c                	pop    %r12
+  801292:	41 5d                	pop    %r13
+  801294:	41 5f                	pop    %r15
+  801296:	5d                   	pop    %rbp
+  801297:	c3                   	ret
+
+0000000000801298 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void*), void *putdat, const char *fmt, ...)
+{
+  801298:	55                   	push   %rbp
+  801299:	48 89 e5             	mov    %rsp,%rbp
+  80129c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8012a3:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 8012a3 <printfmt+0xb>
+  8012aa:	49 bb 9d 7d 00 00 00 	movabs $0x7d9d,%r11
+  8012b1:	00 00 00 
+  8012b4:	4d 01 da             	add    %r11,%r10
+  8012b7:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8012be:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8012c5:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8012cc:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8012d3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8012da:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8012e1:	84 c0                	test   %al,%al
+  8012e3:	74 20                	je     801305 <printfmt+0x6d>
+  8012e5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8012e9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8012ed:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012f1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8012f5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012f9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8012fd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801301:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+
+	va_start(ap, fmt);
+  801305:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80130c:	00 00 00 
+  80130f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801316:	00 00 00 
+  801319:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80131d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801324:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80132b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+	vprintfmt(putch, putdat, fmt, ap);
+  801332:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801339:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801340:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801347:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80134e:	48 89 c7             	mov    %rax,%rdi
+  801351:	48 b8 51 7c ff ff ff 	movabs $0xffffffffffff7c51,%rax
+  801358:	ff ff ff 
+  80135b:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80135f:	ff d0                	call   *%rax
+	va_end(ap);
+}
+  801361:	90                   	nop
+  801362:	c9                   	leave
+  801363:	c3                   	ret
+
+0000000000801364 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  801364:	55                   	push   %rbp
+  801365:	48 89 e5             	mov    %rsp,%rbp
+  801368:	48 83 ec 10          	sub    $0x10,%rsp
+  80136c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80136c <sprintputch+0x8>
+  801373:	49 bb d4 7c 00 00 00 	movabs $0x7cd4,%r11
+  80137a:	00 00 00 
+  80137d:	4c 01 d8             	add    %r11,%rax
+  801380:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801383:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	b->cnt++;
+  801387:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80138b:	8b 40 10             	mov    0x10(%rax),%eax
+  80138e:	8d 50 01             	lea    0x1(%rax),%edx
+  801391:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801395:	89 50 10             	mov    %edx,0x10(%rax)
+	if (b->buf < b->ebuf)
+  801398:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80139c:	48 8b 10             	mov    (%rax),%rdx
+  80139f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013a3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013a7:	48 39 c2             	cmp    %rax,%rdx
+  8013aa:	73 17                	jae    8013c3 <sprintputch+0x5f>
+		*b->buf++ = ch;
+  8013ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8013b0:	48 8b 00             	mov    (%rax),%rax
+  8013b3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013b7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8013bb:	48 89 0a             	mov    %rcx,(%rdx)
+  8013be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8013c1:	88 10                	mov    %dl,(%rax)
+}
+  8013c3:	90                   	nop
+  8013c4:	c9                   	leave
+  8013c5:	c3                   	ret
+
+00000000008013c6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8013c6:	55                   	push   %rbp
+  8013c7:	48 89 e5             	mov    %rsp,%rbp
+  8013ca:	53                   	push   %rbx
+  8013cb:	48 83 ec 58          	sub    $0x58,%rsp
+  8013cf:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8013cf <vsnprintf+0x9>
+  8013d6:	49 bb 71 7c 00 00 00 	movabs $0x7c71,%r11
+  8013dd:	00 00 00 
+  8013e0:	4c 01 d8             	add    %r11,%rax
+  8013e3:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8013e7:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  8013ea:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+  8013ee:	48 89 4d a0          	mov    %rcx,-0x60(%rbp)
+	va_list aq;
+	va_copy(aq,ap);
+  8013f2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8013f6:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8013fa:	48 8b 0e             	mov    (%rsi),%rcx
+  8013fd:	48 8b 5e 08          	mov    0x8(%rsi),%rbx
+  801401:	48 89 0a             	mov    %rcx,(%rdx)
+  801404:	48 89 5a 08          	mov    %rbx,0x8(%rdx)
+  801408:	48 8b 4e 10          	mov    0x10(%rsi),%rcx
+  80140c:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  801410:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801414:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801418:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  80141b:	48 63 d2             	movslq %edx,%rdx
+  80141e:	48 8d 4a ff          	lea    -0x1(%rdx),%rcx
+  801422:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801426:	48 01 ca             	add    %rcx,%rdx
+  801429:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80142d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+
+	if (buf == NULL || n < 1)
+  801434:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  801439:	74 06                	je     801441 <vsnprintf+0x7b>
+  80143b:	83 7d b4 00          	cmpl   $0x0,-0x4c(%rbp)
+  80143f:	7f 07                	jg     801448 <vsnprintf+0x82>
+		return -E_INVAL;
+  801441:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801446:	eb 34                	jmp    80147c <vsnprintf+0xb6>
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, aq);
+  801448:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+  80144c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801450:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801454:	48 bf 24 83 ff ff ff 	movabs $0xffffffffffff8324,%rdi
+  80145b:	ff ff ff 
+  80145e:	48 8d 3c 38          	lea    (%rax,%rdi,1),%rdi
+  801462:	49 b8 51 7c ff ff ff 	movabs $0xffffffffffff7c51,%r8
+  801469:	ff ff ff 
+  80146c:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  801470:	ff d0                	call   *%rax
+	va_end(aq);
+	// null terminate the buffer
+	*b.buf = '\0';
+  801472:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801476:	c6 00 00             	movb   $0x0,(%rax)
+
+	return b.cnt;
+  801479:	8b 45 d0             	mov    -0x30(%rbp),%eax
+}
+  80147c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801480:	c9                   	leave
+  801481:	c3                   	ret
+
+0000000000801482 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  801482:	55                   	push   %rbp
+  801483:	48 89 e5             	mov    %rsp,%rbp
+  801486:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80148d:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 80148d <snprintf+0xb>
+  801494:	49 bb b3 7b 00 00 00 	movabs $0x7bb3,%r11
+  80149b:	00 00 00 
+  80149e:	4d 01 da             	add    %r11,%r10
+  8014a1:	48 89 bd 08 ff ff ff 	mov    %rdi,-0xf8(%rbp)
+  8014a8:	89 b5 04 ff ff ff    	mov    %esi,-0xfc(%rbp)
+  8014ae:	48 89 95 f8 fe ff ff 	mov    %rdx,-0x108(%rbp)
+  8014b5:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8014bc:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8014c3:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8014ca:	84 c0                	test   %al,%al
+  8014cc:	74 20                	je     8014ee <snprintf+0x6c>
+  8014ce:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8014d2:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8014d6:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8014da:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8014de:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8014e2:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8014e6:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8014ea:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+	va_list ap;
+	int rc;
+	va_list aq;
+	va_start(ap, fmt);
+  8014ee:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8014f5:	00 00 00 
+  8014f8:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8014ff:	00 00 00 
+  801502:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801506:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80150d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801514:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+	va_copy(aq,ap);
+  80151b:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801522:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801529:	48 8b 06             	mov    (%rsi),%rax
+  80152c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801530:	48 89 01             	mov    %rax,(%rcx)
+  801533:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801537:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80153b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+	rc = vsnprintf(buf, n, fmt, aq);
+  80153f:	48 8d 8d 18 ff ff ff 	lea    -0xe8(%rbp),%rcx
+  801546:	48 8b 95 f8 fe ff ff 	mov    -0x108(%rbp),%rdx
+  80154d:	8b b5 04 ff ff ff    	mov    -0xfc(%rbp),%esi
+  801553:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80155a:	48 89 c7             	mov    %rax,%rdi
+  80155d:	48 b8 86 83 ff ff ff 	movabs $0xffffffffffff8386,%rax
+  801564:	ff ff ff 
+  801567:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  80156b:	ff d0                	call   *%rax
+  80156d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+	va_end(aq);
+
+	return rc;
+  801573:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801579:	c9                   	leave
+  80157a:	c3                   	ret
+
+000000000080157b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80157b:	55                   	push   %rbp
+  80157c:	48 89 e5             	mov    %rsp,%rbp
+  80157f:	48 83 ec 18          	sub    $0x18,%rsp
+  801583:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801583 <strlen+0x8>
+  80158a:	49 bb bd 7a 00 00 00 	movabs $0x7abd,%r11
+  801591:	00 00 00 
+  801594:	4c 01 d8             	add    %r11,%rax
+  801597:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80159b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015a2:	eb 09                	jmp    8015ad <strlen+0x32>
+		n++;
+  8015a4:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; *s != '\0'; s++)
+  8015a8:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b1:	0f b6 00             	movzbl (%rax),%eax
+  8015b4:	84 c0                	test   %al,%al
+  8015b6:	75 ec                	jne    8015a4 <strlen+0x29>
+	return n;
+  8015b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015bb:	c9                   	leave
+  8015bc:	c3                   	ret
+
+00000000008015bd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8015bd:	55                   	push   %rbp
+  8015be:	48 89 e5             	mov    %rsp,%rbp
+  8015c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8015c5:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8015c5 <strnlen+0x8>
+  8015cc:	49 bb 7b 7a 00 00 00 	movabs $0x7a7b,%r11
+  8015d3:	00 00 00 
+  8015d6:	4c 01 d8             	add    %r11,%rax
+  8015d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015e1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015e8:	eb 0e                	jmp    8015f8 <strnlen+0x3b>
+		n++;
+  8015ea:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015ee:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015f3:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8015f8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8015fd:	74 0b                	je     80160a <strnlen+0x4d>
+  8015ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801603:	0f b6 00             	movzbl (%rax),%eax
+  801606:	84 c0                	test   %al,%al
+  801608:	75 e0                	jne    8015ea <strnlen+0x2d>
+	return n;
+  80160a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80160d:	c9                   	leave
+  80160e:	c3                   	ret
+
+000000000080160f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80160f:	55                   	push   %rbp
+  801610:	48 89 e5             	mov    %rsp,%rbp
+  801613:	48 83 ec 20          	sub    $0x20,%rsp
+  801617:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801617 <strcpy+0x8>
+  80161e:	49 bb 29 7a 00 00 00 	movabs $0x7a29,%r11
+  801625:	00 00 00 
+  801628:	4c 01 d8             	add    %r11,%rax
+  80162b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80162f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	char *ret;
+
+	ret = dst;
+  801633:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801637:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	while ((*dst++ = *src++) != '\0')
+  80163b:	90                   	nop
+  80163c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801640:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801644:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80164c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801650:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801654:	0f b6 12             	movzbl (%rdx),%edx
+  801657:	88 10                	mov    %dl,(%rax)
+  801659:	0f b6 00             	movzbl (%rax),%eax
+  80165c:	84 c0                	test   %al,%al
+  80165e:	75 dc                	jne    80163c <strcpy+0x2d>
+		/* do nothing */;
+	return ret;
+  801660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801664:	c9                   	leave
+  801665:	c3                   	ret
+
+0000000000801666 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801666:	55                   	push   %rbp
+  801667:	48 89 e5             	mov    %rsp,%rbp
+  80166a:	53                   	push   %rbx
+  80166b:	48 83 ec 20          	sub    $0x20,%rsp
+  80166f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80166f <strcat+0x9>
+  801676:	49 bb d1 79 00 00 00 	movabs $0x79d1,%r11
+  80167d:	00 00 00 
+  801680:	4c 01 db             	add    %r11,%rbx
+  801683:	48 89 7d e0          	mov    %rdi,-0x20(%rbp)
+  801687:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+	int len = strlen(dst);
+  80168b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80168f:	48 89 c7             	mov    %rax,%rdi
+  801692:	48 b8 3b 85 ff ff ff 	movabs $0xffffffffffff853b,%rax
+  801699:	ff ff ff 
+  80169c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016a0:	ff d0                	call   *%rax
+  8016a2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+	strcpy(dst + len, src);
+  8016a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8016a8:	48 63 d0             	movslq %eax,%rdx
+  8016ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016af:	48 01 c2             	add    %rax,%rdx
+  8016b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016b6:	48 89 c6             	mov    %rax,%rsi
+  8016b9:	48 89 d7             	mov    %rdx,%rdi
+  8016bc:	48 b8 cf 85 ff ff ff 	movabs $0xffffffffffff85cf,%rax
+  8016c3:	ff ff ff 
+  8016c6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8016ca:	ff d0                	call   *%rax
+	return dst;
+  8016cc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+}
+  8016d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016d4:	c9                   	leave
+  8016d5:	c3                   	ret
+
+00000000008016d6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8016d6:	55                   	push   %rbp
+  8016d7:	48 89 e5             	mov    %rsp,%rbp
+  8016da:	48 83 ec 28          	sub    $0x28,%rsp
+  8016de:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8016de <strncpy+0x8>
+  8016e5:	49 bb 62 79 00 00 00 	movabs $0x7962,%r11
+  8016ec:	00 00 00 
+  8016ef:	4c 01 d8             	add    %r11,%rax
+  8016f2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016f6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016fa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	size_t i;
+	char *ret;
+
+	ret = dst;
+  8016fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801702:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	for (i = 0; i < size; i++) {
+  801706:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80170d:	00 
+  80170e:	eb 2a                	jmp    80173a <strncpy+0x64>
+		*dst++ = *src;
+  801710:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801714:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801718:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80171c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801720:	0f b6 12             	movzbl (%rdx),%edx
+  801723:	88 10                	mov    %dl,(%rax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+  801725:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801729:	0f b6 00             	movzbl (%rax),%eax
+  80172c:	84 c0                	test   %al,%al
+  80172e:	74 05                	je     801735 <strncpy+0x5f>
+			src++;
+  801730:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+	for (i = 0; i < size; i++) {
+  801735:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80173a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80173e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801742:	72 cc                	jb     801710 <strncpy+0x3a>
+	}
+	return ret;
+  801744:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801748:	c9                   	leave
+  801749:	c3                   	ret
+
+000000000080174a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80174a:	55                   	push   %rbp
+  80174b:	48 89 e5             	mov    %rsp,%rbp
+  80174e:	48 83 ec 28          	sub    $0x28,%rsp
+  801752:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801752 <strlcpy+0x8>
+  801759:	49 bb ee 78 00 00 00 	movabs $0x78ee,%r11
+  801760:	00 00 00 
+  801763:	4c 01 d8             	add    %r11,%rax
+  801766:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80176a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80176e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	char *dst_in;
+
+	dst_in = dst;
+  801772:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801776:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	if (size > 0) {
+  80177a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80177f:	74 3d                	je     8017be <strlcpy+0x74>
+		while (--size > 0 && *src != '\0')
+  801781:	eb 1d                	jmp    8017a0 <strlcpy+0x56>
+			*dst++ = *src++;
+  801783:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801787:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80178b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80178f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801793:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801797:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80179b:	0f b6 12             	movzbl (%rdx),%edx
+  80179e:	88 10                	mov    %dl,(%rax)
+		while (--size > 0 && *src != '\0')
+  8017a0:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8017a5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017aa:	74 0b                	je     8017b7 <strlcpy+0x6d>
+  8017ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017b0:	0f b6 00             	movzbl (%rax),%eax
+  8017b3:	84 c0                	test   %al,%al
+  8017b5:	75 cc                	jne    801783 <strlcpy+0x39>
+		*dst = '\0';
+  8017b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017bb:	c6 00 00             	movb   $0x0,(%rax)
+	}
+	return dst - dst_in;
+  8017be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c2:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8017c6:	c9                   	leave
+  8017c7:	c3                   	ret
+
+00000000008017c8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8017c8:	55                   	push   %rbp
+  8017c9:	48 89 e5             	mov    %rsp,%rbp
+  8017cc:	48 83 ec 10          	sub    $0x10,%rsp
+  8017d0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8017d0 <strcmp+0x8>
+  8017d7:	49 bb 70 78 00 00 00 	movabs $0x7870,%r11
+  8017de:	00 00 00 
+  8017e1:	4c 01 d8             	add    %r11,%rax
+  8017e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017e8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	while (*p && *p == *q)
+  8017ec:	eb 0a                	jmp    8017f8 <strcmp+0x30>
+		p++, q++;
+  8017ee:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017f3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (*p && *p == *q)
+  8017f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017fc:	0f b6 00             	movzbl (%rax),%eax
+  8017ff:	84 c0                	test   %al,%al
+  801801:	74 12                	je     801815 <strcmp+0x4d>
+  801803:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801807:	0f b6 10             	movzbl (%rax),%edx
+  80180a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80180e:	0f b6 00             	movzbl (%rax),%eax
+  801811:	38 c2                	cmp    %al,%dl
+  801813:	74 d9                	je     8017ee <strcmp+0x26>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  801815:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801819:	0f b6 00             	movzbl (%rax),%eax
+  80181c:	0f b6 d0             	movzbl %al,%edx
+  80181f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801823:	0f b6 00             	movzbl (%rax),%eax
+  801826:	0f b6 c0             	movzbl %al,%eax
+  801829:	29 c2                	sub    %eax,%edx
+  80182b:	89 d0                	mov    %edx,%eax
+}
+  80182d:	c9                   	leave
+  80182e:	c3                   	ret
+
+000000000080182f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80182f:	55                   	push   %rbp
+  801830:	48 89 e5             	mov    %rsp,%rbp
+  801833:	48 83 ec 18          	sub    $0x18,%rsp
+  801837:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801837 <strncmp+0x8>
+  80183e:	49 bb 09 78 00 00 00 	movabs $0x7809,%r11
+  801845:	00 00 00 
+  801848:	4c 01 d8             	add    %r11,%rax
+  80184b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80184f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801853:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801857:	eb 0f                	jmp    801868 <strncmp+0x39>
+		n--, p++, q++;
+  801859:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80185e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801863:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n > 0 && *p && *p == *q)
+  801868:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80186d:	74 1d                	je     80188c <strncmp+0x5d>
+  80186f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801873:	0f b6 00             	movzbl (%rax),%eax
+  801876:	84 c0                	test   %al,%al
+  801878:	74 12                	je     80188c <strncmp+0x5d>
+  80187a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80187e:	0f b6 10             	movzbl (%rax),%edx
+  801881:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801885:	0f b6 00             	movzbl (%rax),%eax
+  801888:	38 c2                	cmp    %al,%dl
+  80188a:	74 cd                	je     801859 <strncmp+0x2a>
+	if (n == 0)
+  80188c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801891:	75 07                	jne    80189a <strncmp+0x6b>
+		return 0;
+  801893:	ba 00 00 00 00       	mov    $0x0,%edx
+  801898:	eb 16                	jmp    8018b0 <strncmp+0x81>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80189a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80189e:	0f b6 00             	movzbl (%rax),%eax
+  8018a1:	0f b6 d0             	movzbl %al,%edx
+  8018a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018a8:	0f b6 00             	movzbl (%rax),%eax
+  8018ab:	0f b6 c0             	movzbl %al,%eax
+  8018ae:	29 c2                	sub    %eax,%edx
+}
+  8018b0:	89 d0                	mov    %edx,%eax
+  8018b2:	c9                   	leave
+  8018b3:	c3                   	ret
+
+00000000008018b4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8018b4:	55                   	push   %rbp
+  8018b5:	48 89 e5             	mov    %rsp,%rbp
+  8018b8:	48 83 ec 10          	sub    $0x10,%rsp
+  8018bc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8018bc <strchr+0x8>
+  8018c3:	49 bb 84 77 00 00 00 	movabs $0x7784,%r11
+  8018ca:	00 00 00 
+  8018cd:	4c 01 d8             	add    %r11,%rax
+  8018d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018d4:	89 f0                	mov    %esi,%eax
+  8018d6:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  8018d9:	eb 17                	jmp    8018f2 <strchr+0x3e>
+		if (*s == c)
+  8018db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018df:	0f b6 00             	movzbl (%rax),%eax
+  8018e2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8018e5:	75 06                	jne    8018ed <strchr+0x39>
+			return (char *) s;
+  8018e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018eb:	eb 15                	jmp    801902 <strchr+0x4e>
+	for (; *s; s++)
+  8018ed:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f6:	0f b6 00             	movzbl (%rax),%eax
+  8018f9:	84 c0                	test   %al,%al
+  8018fb:	75 de                	jne    8018db <strchr+0x27>
+	return 0;
+  8018fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801902:	c9                   	leave
+  801903:	c3                   	ret
+
+0000000000801904 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801904:	55                   	push   %rbp
+  801905:	48 89 e5             	mov    %rsp,%rbp
+  801908:	48 83 ec 10          	sub    $0x10,%rsp
+  80190c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80190c <strfind+0x8>
+  801913:	49 bb 34 77 00 00 00 	movabs $0x7734,%r11
+  80191a:	00 00 00 
+  80191d:	4c 01 d8             	add    %r11,%rax
+  801920:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801924:	89 f0                	mov    %esi,%eax
+  801926:	88 45 f4             	mov    %al,-0xc(%rbp)
+	for (; *s; s++)
+  801929:	eb 11                	jmp    80193c <strfind+0x38>
+		if (*s == c)
+  80192b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80192f:	0f b6 00             	movzbl (%rax),%eax
+  801932:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801935:	74 12                	je     801949 <strfind+0x45>
+	for (; *s; s++)
+  801937:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80193c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801940:	0f b6 00             	movzbl (%rax),%eax
+  801943:	84 c0                	test   %al,%al
+  801945:	75 e4                	jne    80192b <strfind+0x27>
+  801947:	eb 01                	jmp    80194a <strfind+0x46>
+			break;
+  801949:	90                   	nop
+	return (char *) s;
+  80194a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80194e:	c9                   	leave
+  80194f:	c3                   	ret
+
+0000000000801950 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801950:	55                   	push   %rbp
+  801951:	48 89 e5             	mov    %rsp,%rbp
+  801954:	48 83 ec 18          	sub    $0x18,%rsp
+  801958:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801958 <memset+0x8>
+  80195f:	49 bb e8 76 00 00 00 	movabs $0x76e8,%r11
+  801966:	00 00 00 
+  801969:	4c 01 d8             	add    %r11,%rax
+  80196c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801970:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  801973:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	char *p;
+
+	if (n == 0)
+  801977:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80197c:	75 06                	jne    801984 <memset+0x34>
+		return v;
+  80197e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801982:	eb 69                	jmp    8019ed <memset+0x9d>
+	if ((int64_t)v%4 == 0 && n%4 == 0) {
+  801984:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801988:	83 e0 03             	and    $0x3,%eax
+  80198b:	48 85 c0             	test   %rax,%rax
+  80198e:	75 48                	jne    8019d8 <memset+0x88>
+  801990:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801994:	83 e0 03             	and    $0x3,%eax
+  801997:	48 85 c0             	test   %rax,%rax
+  80199a:	75 3c                	jne    8019d8 <memset+0x88>
+		c &= 0xFF;
+  80199c:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+  8019a3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019a6:	c1 e0 18             	shl    $0x18,%eax
+  8019a9:	89 c2                	mov    %eax,%edx
+  8019ab:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019ae:	c1 e0 10             	shl    $0x10,%eax
+  8019b1:	09 c2                	or     %eax,%edx
+  8019b3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019b6:	c1 e0 08             	shl    $0x8,%eax
+  8019b9:	09 d0                	or     %edx,%eax
+  8019bb:	09 45 f4             	or     %eax,-0xc(%rbp)
+		asm volatile("cld; rep stosl\n"
+			     :: "D" (v), "a" (c), "c" (n/4)
+  8019be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019c2:	48 c1 e8 02          	shr    $0x2,%rax
+  8019c6:	48 89 c1             	mov    %rax,%rcx
+		asm volatile("cld; rep stosl\n"
+  8019c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019cd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019d0:	48 89 d7             	mov    %rdx,%rdi
+  8019d3:	fc                   	cld
+  8019d4:	f3 ab                	rep stos %eax,%es:(%rdi)
+  8019d6:	eb 11                	jmp    8019e9 <memset+0x99>
+			     : "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8019d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8019df:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019e3:	48 89 d7             	mov    %rdx,%rdi
+  8019e6:	fc                   	cld
+  8019e7:	f3 aa                	rep stos %al,%es:(%rdi)
+			     :: "D" (v), "a" (c), "c" (n)
+			     : "cc", "memory");
+	return v;
+  8019e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8019ed:	c9                   	leave
+  8019ee:	c3                   	ret
+
+00000000008019ef <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8019ef:	55                   	push   %rbp
+  8019f0:	48 89 e5             	mov    %rsp,%rbp
+  8019f3:	48 83 ec 28          	sub    $0x28,%rsp
+  8019f7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8019f7 <memmove+0x8>
+  8019fe:	49 bb 49 76 00 00 00 	movabs $0x7649,%r11
+  801a05:	00 00 00 
+  801a08:	4c 01 d8             	add    %r11,%rax
+  801a0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801a0f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801a13:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const char *s;
+	char *d;
+
+	s = src;
+  801a17:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a1b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	d = dst;
+  801a1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a23:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	if (s < d && s + n > d) {
+  801a27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a2b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801a2f:	0f 83 88 00 00 00    	jae    801abd <memmove+0xce>
+  801a35:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a39:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a3d:	48 01 d0             	add    %rdx,%rax
+  801a40:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801a44:	73 77                	jae    801abd <memmove+0xce>
+		s += n;
+  801a46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a4a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+		d += n;
+  801a4e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a52:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801a56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a5a:	83 e0 03             	and    $0x3,%eax
+  801a5d:	48 85 c0             	test   %rax,%rax
+  801a60:	75 3b                	jne    801a9d <memmove+0xae>
+  801a62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a66:	83 e0 03             	and    $0x3,%eax
+  801a69:	48 85 c0             	test   %rax,%rax
+  801a6c:	75 2f                	jne    801a9d <memmove+0xae>
+  801a6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a72:	83 e0 03             	and    $0x3,%eax
+  801a75:	48 85 c0             	test   %rax,%rax
+  801a78:	75 23                	jne    801a9d <memmove+0xae>
+			asm volatile("std; rep movsl\n"
+				     :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  801a7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7e:	48 83 e8 04          	sub    $0x4,%rax
+  801a82:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801a86:	48 83 ea 04          	sub    $0x4,%rdx
+  801a8a:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801a8e:	48 c1 e9 02          	shr    $0x2,%rcx
+			asm volatile("std; rep movsl\n"
+  801a92:	48 89 c7             	mov    %rax,%rdi
+  801a95:	48 89 d6             	mov    %rdx,%rsi
+  801a98:	fd                   	std
+  801a99:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801a9b:	eb 1d                	jmp    801aba <memmove+0xcb>
+		else
+			asm volatile("std; rep movsb\n"
+				     :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  801a9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801aa5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aa9:	48 8d 70 ff          	lea    -0x1(%rax),%rsi
+			asm volatile("std; rep movsb\n"
+  801aad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ab1:	48 89 d7             	mov    %rdx,%rdi
+  801ab4:	48 89 c1             	mov    %rax,%rcx
+  801ab7:	fd                   	std
+  801ab8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801aba:	fc                   	cld
+  801abb:	eb 57                	jmp    801b14 <memmove+0x125>
+	} else {
+		if ((int64_t)s%4 == 0 && (int64_t)d%4 == 0 && n%4 == 0)
+  801abd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac1:	83 e0 03             	and    $0x3,%eax
+  801ac4:	48 85 c0             	test   %rax,%rax
+  801ac7:	75 36                	jne    801aff <memmove+0x110>
+  801ac9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801acd:	83 e0 03             	and    $0x3,%eax
+  801ad0:	48 85 c0             	test   %rax,%rax
+  801ad3:	75 2a                	jne    801aff <memmove+0x110>
+  801ad5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad9:	83 e0 03             	and    $0x3,%eax
+  801adc:	48 85 c0             	test   %rax,%rax
+  801adf:	75 1e                	jne    801aff <memmove+0x110>
+			asm volatile("cld; rep movsl\n"
+				     :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801ae1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ae5:	48 c1 e8 02          	shr    $0x2,%rax
+  801ae9:	48 89 c1             	mov    %rax,%rcx
+			asm volatile("cld; rep movsl\n"
+  801aec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801af4:	48 89 c7             	mov    %rax,%rdi
+  801af7:	48 89 d6             	mov    %rdx,%rsi
+  801afa:	fc                   	cld
+  801afb:	f3 a5                	rep movsl %ds:(%rsi),%es:(%rdi)
+  801afd:	eb 15                	jmp    801b14 <memmove+0x125>
+		else
+			asm volatile("cld; rep movsb\n"
+  801aff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b03:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b07:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  801b0b:	48 89 c7             	mov    %rax,%rdi
+  801b0e:	48 89 d6             	mov    %rdx,%rsi
+  801b11:	fc                   	cld
+  801b12:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+				     :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+  801b14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801b18:	c9                   	leave
+  801b19:	c3                   	ret
+
+0000000000801b1a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801b1a:	55                   	push   %rbp
+  801b1b:	48 89 e5             	mov    %rsp,%rbp
+  801b1e:	48 83 ec 18          	sub    $0x18,%rsp
+  801b22:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b22 <memcpy+0x8>
+  801b29:	49 bb 1e 75 00 00 00 	movabs $0x751e,%r11
+  801b30:	00 00 00 
+  801b33:	4c 01 d8             	add    %r11,%rax
+  801b36:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801b3a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801b3e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+	return memmove(dst, src, n);
+  801b42:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b46:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  801b4a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b4e:	48 89 cf             	mov    %rcx,%rdi
+  801b51:	48 b9 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rcx
+  801b58:	ff ff ff 
+  801b5b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  801b5f:	ff d0                	call   *%rax
+}
+  801b61:	c9                   	leave
+  801b62:	c3                   	ret
+
+0000000000801b63 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801b63:	55                   	push   %rbp
+  801b64:	48 89 e5             	mov    %rsp,%rbp
+  801b67:	48 83 ec 28          	sub    $0x28,%rsp
+  801b6b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801b6b <memcmp+0x8>
+  801b72:	49 bb d5 74 00 00 00 	movabs $0x74d5,%r11
+  801b79:	00 00 00 
+  801b7c:	4c 01 d8             	add    %r11,%rax
+  801b7f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b83:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801b87:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const uint8_t *s1 = (const uint8_t *) v1;
+  801b8b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b8f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	const uint8_t *s2 = (const uint8_t *) v2;
+  801b93:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b97:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+	while (n-- > 0) {
+  801b9b:	eb 34                	jmp    801bd1 <memcmp+0x6e>
+		if (*s1 != *s2)
+  801b9d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ba1:	0f b6 10             	movzbl (%rax),%edx
+  801ba4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ba8:	0f b6 00             	movzbl (%rax),%eax
+  801bab:	38 c2                	cmp    %al,%dl
+  801bad:	74 18                	je     801bc7 <memcmp+0x64>
+			return (int) *s1 - (int) *s2;
+  801baf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bb3:	0f b6 00             	movzbl (%rax),%eax
+  801bb6:	0f b6 d0             	movzbl %al,%edx
+  801bb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bbd:	0f b6 00             	movzbl (%rax),%eax
+  801bc0:	0f b6 c0             	movzbl %al,%eax
+  801bc3:	29 c2                	sub    %eax,%edx
+  801bc5:	eb 20                	jmp    801be7 <memcmp+0x84>
+		s1++, s2++;
+  801bc7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bcc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+	while (n-- > 0) {
+  801bd1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bd5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bd9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  801bdd:	48 85 c0             	test   %rax,%rax
+  801be0:	75 bb                	jne    801b9d <memcmp+0x3a>
+	}
+
+	return 0;
+  801be2:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  801be7:	89 d0                	mov    %edx,%eax
+  801be9:	c9                   	leave
+  801bea:	c3                   	ret
+
+0000000000801beb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801beb:	55                   	push   %rbp
+  801bec:	48 89 e5             	mov    %rsp,%rbp
+  801bef:	48 83 ec 28          	sub    $0x28,%rsp
+  801bf3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801bf3 <memfind+0x8>
+  801bfa:	49 bb 4d 74 00 00 00 	movabs $0x744d,%r11
+  801c01:	00 00 00 
+  801c04:	4c 01 d8             	add    %r11,%rax
+  801c07:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c0b:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  801c0e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	const void *ends = (const char *) s + n;
+  801c12:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c1a:	48 01 d0             	add    %rdx,%rax
+  801c1d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+	for (; s < ends; s++)
+  801c21:	eb 13                	jmp    801c36 <memfind+0x4b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801c23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c27:	0f b6 00             	movzbl (%rax),%eax
+  801c2a:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  801c2d:	38 d0                	cmp    %dl,%al
+  801c2f:	74 11                	je     801c42 <memfind+0x57>
+	for (; s < ends; s++)
+  801c31:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801c36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c3a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c3e:	72 e3                	jb     801c23 <memfind+0x38>
+  801c40:	eb 01                	jmp    801c43 <memfind+0x58>
+			break;
+  801c42:	90                   	nop
+	return (void *) s;
+  801c43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c47:	c9                   	leave
+  801c48:	c3                   	ret
+
+0000000000801c49 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801c49:	55                   	push   %rbp
+  801c4a:	48 89 e5             	mov    %rsp,%rbp
+  801c4d:	48 83 ec 38          	sub    $0x38,%rsp
+  801c51:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 801c51 <strtol+0x8>
+  801c58:	49 bb ef 73 00 00 00 	movabs $0x73ef,%r11
+  801c5f:	00 00 00 
+  801c62:	4c 01 d8             	add    %r11,%rax
+  801c65:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c69:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c6d:	89 55 cc             	mov    %edx,-0x34(%rbp)
+	int neg = 0;
+  801c70:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+	long val = 0;
+  801c77:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c7e:	00 
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801c7f:	eb 05                	jmp    801c86 <strtol+0x3d>
+		s++;
+  801c81:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+	while (*s == ' ' || *s == '\t')
+  801c86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c8a:	0f b6 00             	movzbl (%rax),%eax
+  801c8d:	3c 20                	cmp    $0x20,%al
+  801c8f:	74 f0                	je     801c81 <strtol+0x38>
+  801c91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c95:	0f b6 00             	movzbl (%rax),%eax
+  801c98:	3c 09                	cmp    $0x9,%al
+  801c9a:	74 e5                	je     801c81 <strtol+0x38>
+
+	// plus/minus sign
+	if (*s == '+')
+  801c9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ca0:	0f b6 00             	movzbl (%rax),%eax
+  801ca3:	3c 2b                	cmp    $0x2b,%al
+  801ca5:	75 07                	jne    801cae <strtol+0x65>
+		s++;
+  801ca7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cac:	eb 17                	jmp    801cc5 <strtol+0x7c>
+	else if (*s == '-')
+  801cae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb2:	0f b6 00             	movzbl (%rax),%eax
+  801cb5:	3c 2d                	cmp    $0x2d,%al
+  801cb7:	75 0c                	jne    801cc5 <strtol+0x7c>
+		s++, neg = 1;
+  801cb9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cbe:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801cc5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cc9:	74 06                	je     801cd1 <strtol+0x88>
+  801ccb:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801ccf:	75 28                	jne    801cf9 <strtol+0xb0>
+  801cd1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd5:	0f b6 00             	movzbl (%rax),%eax
+  801cd8:	3c 30                	cmp    $0x30,%al
+  801cda:	75 1d                	jne    801cf9 <strtol+0xb0>
+  801cdc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce0:	48 83 c0 01          	add    $0x1,%rax
+  801ce4:	0f b6 00             	movzbl (%rax),%eax
+  801ce7:	3c 78                	cmp    $0x78,%al
+  801ce9:	75 0e                	jne    801cf9 <strtol+0xb0>
+		s += 2, base = 16;
+  801ceb:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801cf0:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801cf7:	eb 2c                	jmp    801d25 <strtol+0xdc>
+	else if (base == 0 && s[0] == '0')
+  801cf9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cfd:	75 19                	jne    801d18 <strtol+0xcf>
+  801cff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d03:	0f b6 00             	movzbl (%rax),%eax
+  801d06:	3c 30                	cmp    $0x30,%al
+  801d08:	75 0e                	jne    801d18 <strtol+0xcf>
+		s++, base = 8;
+  801d0a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d0f:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801d16:	eb 0d                	jmp    801d25 <strtol+0xdc>
+	else if (base == 0)
+  801d18:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801d1c:	75 07                	jne    801d25 <strtol+0xdc>
+		base = 10;
+  801d1e:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+  801d25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d29:	0f b6 00             	movzbl (%rax),%eax
+  801d2c:	3c 2f                	cmp    $0x2f,%al
+  801d2e:	7e 1d                	jle    801d4d <strtol+0x104>
+  801d30:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d34:	0f b6 00             	movzbl (%rax),%eax
+  801d37:	3c 39                	cmp    $0x39,%al
+  801d39:	7f 12                	jg     801d4d <strtol+0x104>
+			dig = *s - '0';
+  801d3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3f:	0f b6 00             	movzbl (%rax),%eax
+  801d42:	0f be c0             	movsbl %al,%eax
+  801d45:	83 e8 30             	sub    $0x30,%eax
+  801d48:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d4b:	eb 4e                	jmp    801d9b <strtol+0x152>
+		else if (*s >= 'a' && *s <= 'z')
+  801d4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d51:	0f b6 00             	movzbl (%rax),%eax
+  801d54:	3c 60                	cmp    $0x60,%al
+  801d56:	7e 1d                	jle    801d75 <strtol+0x12c>
+  801d58:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d5c:	0f b6 00             	movzbl (%rax),%eax
+  801d5f:	3c 7a                	cmp    $0x7a,%al
+  801d61:	7f 12                	jg     801d75 <strtol+0x12c>
+			dig = *s - 'a' + 10;
+  801d63:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d67:	0f b6 00             	movzbl (%rax),%eax
+  801d6a:	0f be c0             	movsbl %al,%eax
+  801d6d:	83 e8 57             	sub    $0x57,%eax
+  801d70:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d73:	eb 26                	jmp    801d9b <strtol+0x152>
+		else if (*s >= 'A' && *s <= 'Z')
+  801d75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d79:	0f b6 00             	movzbl (%rax),%eax
+  801d7c:	3c 40                	cmp    $0x40,%al
+  801d7e:	7e 47                	jle    801dc7 <strtol+0x17e>
+  801d80:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d84:	0f b6 00             	movzbl (%rax),%eax
+  801d87:	3c 5a                	cmp    $0x5a,%al
+  801d89:	7f 3c                	jg     801dc7 <strtol+0x17e>
+			dig = *s - 'A' + 10;
+  801d8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d8f:	0f b6 00             	movzbl (%rax),%eax
+  801d92:	0f be c0             	movsbl %al,%eax
+  801d95:	83 e8 37             	sub    $0x37,%eax
+  801d98:	89 45 ec             	mov    %eax,-0x14(%rbp)
+		else
+			break;
+		if (dig >= base)
+  801d9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d9e:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801da1:	7d 23                	jge    801dc6 <strtol+0x17d>
+			break;
+		s++, val = (val * base) + dig;
+  801da3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801da8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801dab:	48 98                	cltq
+  801dad:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801db2:	48 89 c2             	mov    %rax,%rdx
+  801db5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801db8:	48 98                	cltq
+  801dba:	48 01 d0             	add    %rdx,%rax
+  801dbd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+	while (1) {
+  801dc1:	e9 5f ff ff ff       	jmp    801d25 <strtol+0xdc>
+			break;
+  801dc6:	90                   	nop
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801dc7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801dcc:	74 0b                	je     801dd9 <strtol+0x190>
+		*endptr = (char *) s;
+  801dce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dd2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801dd6:	48 89 10             	mov    %rdx,(%rax)
+	return (neg ? -val : val);
+  801dd9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801ddd:	74 09                	je     801de8 <strtol+0x19f>
+  801ddf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801de3:	48 f7 d8             	neg    %rax
+  801de6:	eb 04                	jmp    801dec <strtol+0x1a3>
+  801de8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801dec:	c9                   	leave
+  801ded:	c3                   	ret
+
+0000000000801dee <strstr>:
+
+char * strstr(const char *in, const char *str)
+{
+  801dee:	55                   	push   %rbp
+  801def:	48 89 e5             	mov    %rsp,%rbp
+  801df2:	53                   	push   %rbx
+  801df3:	48 83 ec 30          	sub    $0x30,%rsp
+  801df7:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 801df7 <strstr+0x9>
+  801dfe:	49 bb 49 72 00 00 00 	movabs $0x7249,%r11
+  801e05:	00 00 00 
+  801e08:	4c 01 db             	add    %r11,%rbx
+  801e0b:	48 89 7d d0          	mov    %rdi,-0x30(%rbp)
+  801e0f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+	char c;
+	size_t len;
+
+	c = *str++;
+  801e13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e17:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e1b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e1f:	0f b6 00             	movzbl (%rax),%eax
+  801e22:	88 45 f7             	mov    %al,-0x9(%rbp)
+	if (!c)
+  801e25:	80 7d f7 00          	cmpb   $0x0,-0x9(%rbp)
+  801e29:	75 06                	jne    801e31 <strstr+0x43>
+		return (char *) in;	// Trivial empty string case
+  801e2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e2f:	eb 73                	jmp    801ea4 <strstr+0xb6>
+
+	len = strlen(str);
+  801e31:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e35:	48 89 c7             	mov    %rax,%rdi
+  801e38:	48 b8 3b 85 ff ff ff 	movabs $0xffffffffffff853b,%rax
+  801e3f:	ff ff ff 
+  801e42:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e46:	ff d0                	call   *%rax
+  801e48:	48 98                	cltq
+  801e4a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	do {
+		char sc;
+
+		do {
+			sc = *in++;
+  801e4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e52:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801e56:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801e5a:	0f b6 00             	movzbl (%rax),%eax
+  801e5d:	88 45 e7             	mov    %al,-0x19(%rbp)
+			if (!sc)
+  801e60:	80 7d e7 00          	cmpb   $0x0,-0x19(%rbp)
+  801e64:	75 07                	jne    801e6d <strstr+0x7f>
+				return (char *) 0;
+  801e66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6b:	eb 37                	jmp    801ea4 <strstr+0xb6>
+		} while (sc != c);
+  801e6d:	0f b6 45 e7          	movzbl -0x19(%rbp),%eax
+  801e71:	3a 45 f7             	cmp    -0x9(%rbp),%al
+  801e74:	75 d8                	jne    801e4e <strstr+0x60>
+	} while (strncmp(in, str, len) != 0);
+  801e76:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e7a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801e7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e82:	48 89 ce             	mov    %rcx,%rsi
+  801e85:	48 89 c7             	mov    %rax,%rdi
+  801e88:	48 b8 ef 87 ff ff ff 	movabs $0xffffffffffff87ef,%rax
+  801e8f:	ff ff ff 
+  801e92:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  801e96:	ff d0                	call   *%rax
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	75 b2                	jne    801e4e <strstr+0x60>
+
+	return (char *) (in - 1);
+  801e9c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ea0:	48 83 e8 01          	sub    $0x1,%rax
+}
+  801ea4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801ea8:	c9                   	leave
+  801ea9:	c3                   	ret
+
+0000000000801eaa <syscall>:
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3, uint64_t a4, uint64_t a5)
+{
+  801eaa:	55                   	push   %rbp
+  801eab:	48 89 e5             	mov    %rsp,%rbp
+  801eae:	41 57                	push   %r15
+  801eb0:	53                   	push   %rbx
+  801eb1:	48 83 ec 40          	sub    $0x40,%rsp
+  801eb5:	4c 8d 15 f9 ff ff ff 	lea    -0x7(%rip),%r10        # 801eb5 <syscall+0xb>
+  801ebc:	49 bb 8b 71 00 00 00 	movabs $0x718b,%r11
+  801ec3:	00 00 00 
+  801ec6:	4d 01 da             	add    %r11,%r10
+  801ec9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  801ecc:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  801ecf:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801ed3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801ed7:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  801edb:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	//
+	// The last clause tells the assembler that this can
+	// potentially change the condition codes and arbitrary
+	// memory locations.
+
+	asm volatile("int %1\n"
+  801edf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ee2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  801ee6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801eea:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  801eee:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801ef2:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801ef6:	4c 89 c3             	mov    %r8,%rbx
+  801ef9:	cd 30                	int    $0x30
+  801efb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if(check && ret > 0)
+  801eff:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801f03:	74 52                	je     801f57 <syscall+0xad>
+  801f05:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801f0a:	7e 4b                	jle    801f57 <syscall+0xad>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801f0c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f10:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801f13:	49 89 d0             	mov    %rdx,%r8
+  801f16:	89 c1                	mov    %eax,%ecx
+  801f18:	48 b8 a8 e3 ff ff ff 	movabs $0xffffffffffffe3a8,%rax
+  801f1f:	ff ff ff 
+  801f22:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f26:	48 89 c2             	mov    %rax,%rdx
+  801f29:	be 23 00 00 00       	mov    $0x23,%esi
+  801f2e:	48 b8 c5 e3 ff ff ff 	movabs $0xffffffffffffe3c5,%rax
+  801f35:	ff ff ff 
+  801f38:	49 8d 04 02          	lea    (%r10,%rax,1),%rax
+  801f3c:	48 89 c7             	mov    %rax,%rdi
+  801f3f:	4d 89 d7             	mov    %r10,%r15
+  801f42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f47:	49 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%r9
+  801f4e:	ff ff ff 
+  801f51:	4d 01 d1             	add    %r10,%r9
+  801f54:	41 ff d1             	call   *%r9
+
+	return ret;
+  801f57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801f5b:	48 83 c4 40          	add    $0x40,%rsp
+  801f5f:	5b                   	pop    %rbx
+  801f60:	41 5f                	pop    %r15
+  801f62:	5d                   	pop    %rbp
+  801f63:	c3                   	ret
+
+0000000000801f64 <syscall_words>:
+// is nonnull, its IPC_NWORDS words are passed in those registers, and
+// replaced by their values on return.
+static inline int64_t
+syscall_words(int num, int check, uint64_t a1, uint64_t a2, uint64_t a3,
+	      uint64_t a4, uint64_t a5, uint64_t *words)
+{
+  801f64:	55                   	push   %rbp
+  801f65:	48 89 e5             	mov    %rsp,%rbp
+  801f68:	41 57                	push   %r15
+  801f6a:	41 56                	push   %r14
+  801f6c:	41 55                	push   %r13
+  801f6e:	41 54                	push   %r12
+  801f70:	53                   	push   %rbx
+  801f71:	48 83 ec 48          	sub    $0x48,%rsp
+  801f75:	4c 8d 35 f9 ff ff ff 	lea    -0x7(%rip),%r14        # 801f75 <syscall_words+0x11>
+  801f7c:	49 bb cb 70 00 00 00 	movabs $0x70cb,%r11
+  801f83:	00 00 00 
+  801f86:	4d 01 de             	add    %r11,%r14
+  801f89:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  801f8c:	89 75 b8             	mov    %esi,-0x48(%rbp)
+  801f8f:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  801f93:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  801f97:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+  801f9b:	4c 89 4d 98          	mov    %r9,-0x68(%rbp)
+	register uint64_t r8 asm("r8") = words ? words[0] : 0;
+  801f9f:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fa4:	74 09                	je     801faf <syscall_words+0x4b>
+  801fa6:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801faa:	48 8b 00             	mov    (%rax),%rax
+  801fad:	eb 05                	jmp    801fb4 <syscall_words+0x50>
+  801faf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb4:	49 89 c0             	mov    %rax,%r8
+	register uint64_t r9 asm("r9") = words ? words[1] : 0;
+  801fb7:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fbc:	74 0a                	je     801fc8 <syscall_words+0x64>
+  801fbe:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fc2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801fc6:	eb 05                	jmp    801fcd <syscall_words+0x69>
+  801fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcd:	49 89 c1             	mov    %rax,%r9
+	register uint64_t r10 asm("r10") = words ? words[2] : 0;
+  801fd0:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fd5:	74 0a                	je     801fe1 <syscall_words+0x7d>
+  801fd7:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801fdb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fdf:	eb 05                	jmp    801fe6 <syscall_words+0x82>
+  801fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe6:	49 89 c2             	mov    %rax,%r10
+	register uint64_t r11 asm("r11") = words ? words[3] : 0;
+  801fe9:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  801fee:	74 0a                	je     801ffa <syscall_words+0x96>
+  801ff0:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  801ff4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ff8:	eb 05                	jmp    801fff <syscall_words+0x9b>
+  801ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fff:	49 89 c3             	mov    %rax,%r11
+	register uint64_t r12 asm("r12") = words ? words[4] : 0;
+  802002:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802007:	74 0a                	je     802013 <syscall_words+0xaf>
+  802009:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80200d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802011:	eb 05                	jmp    802018 <syscall_words+0xb4>
+  802013:	b8 00 00 00 00       	mov    $0x0,%eax
+  802018:	49 89 c4             	mov    %rax,%r12
+	register uint64_t r13 asm("r13") = words ? words[5] : 0;
+  80201b:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802020:	74 0a                	je     80202c <syscall_words+0xc8>
+  802022:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802026:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80202a:	eb 05                	jmp    802031 <syscall_words+0xcd>
+  80202c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802031:	49 89 c5             	mov    %rax,%r13
+	int64_t ret;
+
+	asm volatile("int %7\n"
+  802034:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  802037:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80203b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80203f:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  802043:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  802047:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80204b:	cd 30                	int    $0x30
+  80204d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+		       "b" (a3),
+		       "D" (a4),
+		       "S" (a5)
+		     : "cc", "memory");
+
+	if (words) {
+  802051:	48 83 7d 18 00       	cmpq   $0x0,0x18(%rbp)
+  802056:	74 50                	je     8020a8 <syscall_words+0x144>
+		words[0] = r8;
+  802058:	4c 89 c2             	mov    %r8,%rdx
+  80205b:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80205f:	48 89 10             	mov    %rdx,(%rax)
+		words[1] = r9;
+  802062:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802066:	48 83 c0 08          	add    $0x8,%rax
+  80206a:	4c 89 ca             	mov    %r9,%rdx
+  80206d:	48 89 10             	mov    %rdx,(%rax)
+		words[2] = r10;
+  802070:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802074:	48 83 c0 10          	add    $0x10,%rax
+  802078:	4c 89 d2             	mov    %r10,%rdx
+  80207b:	48 89 10             	mov    %rdx,(%rax)
+		words[3] = r11;
+  80207e:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802082:	48 83 c0 18          	add    $0x18,%rax
+  802086:	4c 89 da             	mov    %r11,%rdx
+  802089:	48 89 10             	mov    %rdx,(%rax)
+		words[4] = r12;
+  80208c:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  802090:	48 83 c0 20          	add    $0x20,%rax
+  802094:	4c 89 e2             	mov    %r12,%rdx
+  802097:	48 89 10             	mov    %rdx,(%rax)
+		words[5] = r13;
+  80209a:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  80209e:	48 83 c0 28          	add    $0x28,%rax
+  8020a2:	4c 89 ea             	mov    %r13,%rdx
+  8020a5:	48 89 10             	mov    %rdx,(%rax)
+	}
+
+	if(check && ret > 0)
+  8020a8:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  8020ac:	74 52                	je     802100 <syscall_words+0x19c>
+  8020ae:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8020b3:	7e 4b                	jle    802100 <syscall_words+0x19c>
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8020b5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020b9:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8020bc:	49 89 d0             	mov    %rdx,%r8
+  8020bf:	89 c1                	mov    %eax,%ecx
+  8020c1:	48 b8 a8 e3 ff ff ff 	movabs $0xffffffffffffe3a8,%rax
+  8020c8:	ff ff ff 
+  8020cb:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8020cf:	48 89 c2             	mov    %rax,%rdx
+  8020d2:	be 4e 00 00 00       	mov    $0x4e,%esi
+  8020d7:	48 b8 c5 e3 ff ff ff 	movabs $0xffffffffffffe3c5,%rax
+  8020de:	ff ff ff 
+  8020e1:	49 8d 04 06          	lea    (%r14,%rax,1),%rax
+  8020e5:	48 89 c7             	mov    %rax,%rdi
+  8020e8:	4d 89 f7             	mov    %r14,%r15
+  8020eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f0:	49 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%r9
+  8020f7:	ff ff ff 
+  8020fa:	4d 01 f1             	add    %r14,%r9
+  8020fd:	41 ff d1             	call   *%r9
+
+	return ret;
+  802100:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802104:	48 83 c4 48          	add    $0x48,%rsp
+  802108:	5b                   	pop    %rbx
+  802109:	41 5c                	pop    %r12
+  80210b:	41 5d                	pop    %r13
+  80210d:	41 5e                	pop    %r14
+  80210f:	41 5f                	pop    %r15
+  802111:	5d                   	pop    %rbp
+  802112:	c3                   	ret
+
+0000000000802113 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  802113:	55                   	push   %rbp
+  802114:	48 89 e5             	mov    %rsp,%rbp
+  802117:	48 83 ec 10          	sub    $0x10,%rsp
+  80211b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80211b <sys_cputs+0x8>
+  802122:	49 bb 25 6f 00 00 00 	movabs $0x6f25,%r11
+  802129:	00 00 00 
+  80212c:	4c 01 d8             	add    %r11,%rax
+  80212f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802133:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802137:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80213b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80213f:	48 83 ec 08          	sub    $0x8,%rsp
+  802143:	6a 00                	push   $0x0
+  802145:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80214b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802151:	be 00 00 00 00       	mov    $0x0,%esi
+  802156:	bf 00 00 00 00       	mov    $0x0,%edi
+  80215b:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802162:	ff ff ff 
+  802165:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802169:	ff d0                	call   *%rax
+  80216b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80216f:	90                   	nop
+  802170:	c9                   	leave
+  802171:	c3                   	ret
+
+0000000000802172 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  802172:	55                   	push   %rbp
+  802173:	48 89 e5             	mov    %rsp,%rbp
+  802176:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802176 <sys_cgetc+0x4>
+  80217d:	49 bb ca 6e 00 00 00 	movabs $0x6eca,%r11
+  802184:	00 00 00 
+  802187:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80218a:	48 83 ec 08          	sub    $0x8,%rsp
+  80218e:	6a 00                	push   $0x0
+  802190:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802196:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80219c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ab:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021b0:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  8021b7:	ff ff ff 
+  8021ba:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8021be:	ff d0                	call   *%rax
+  8021c0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021c4:	c9                   	leave
+  8021c5:	c3                   	ret
+
+00000000008021c6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8021c6:	55                   	push   %rbp
+  8021c7:	48 89 e5             	mov    %rsp,%rbp
+  8021ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ce:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8021ce <sys_env_destroy+0x8>
+  8021d5:	49 bb 72 6e 00 00 00 	movabs $0x6e72,%r11
+  8021dc:	00 00 00 
+  8021df:	4c 01 d8             	add    %r11,%rax
+  8021e2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8021e5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8021e8:	48 63 d2             	movslq %edx,%rdx
+  8021eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ef:	6a 00                	push   $0x0
+  8021f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802202:	be 01 00 00 00       	mov    $0x1,%esi
+  802207:	bf 03 00 00 00       	mov    $0x3,%edi
+  80220c:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802213:	ff ff ff 
+  802216:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80221a:	ff d0                	call   *%rax
+  80221c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802220:	c9                   	leave
+  802221:	c3                   	ret
+
+0000000000802222 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  802222:	55                   	push   %rbp
+  802223:	48 89 e5             	mov    %rsp,%rbp
+  802226:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802226 <sys_getenvid+0x4>
+  80222d:	49 bb 1a 6e 00 00 00 	movabs $0x6e1a,%r11
+  802234:	00 00 00 
+  802237:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80223a:	48 83 ec 08          	sub    $0x8,%rsp
+  80223e:	6a 00                	push   $0x0
+  802240:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802246:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80224c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802251:	ba 00 00 00 00       	mov    $0x0,%edx
+  802256:	be 00 00 00 00       	mov    $0x0,%esi
+  80225b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802260:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802267:	ff ff ff 
+  80226a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80226e:	ff d0                	call   *%rax
+  802270:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802274:	c9                   	leave
+  802275:	c3                   	ret
+
+0000000000802276 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  802276:	55                   	push   %rbp
+  802277:	48 89 e5             	mov    %rsp,%rbp
+  80227a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80227a <sys_yield+0x4>
+  802281:	49 bb c6 6d 00 00 00 	movabs $0x6dc6,%r11
+  802288:	00 00 00 
+  80228b:	4c 01 d8             	add    %r11,%rax
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80228e:	48 83 ec 08          	sub    $0x8,%rsp
+  802292:	6a 00                	push   $0x0
+  802294:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80229a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8022af:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8022b4:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  8022bb:	ff ff ff 
+  8022be:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8022c2:	ff d0                	call   *%rax
+  8022c4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c8:	90                   	nop
+  8022c9:	c9                   	leave
+  8022ca:	c3                   	ret
+
+00000000008022cb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8022cb:	55                   	push   %rbp
+  8022cc:	48 89 e5             	mov    %rsp,%rbp
+  8022cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d3:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8022d3 <sys_page_alloc+0x8>
+  8022da:	49 bb 6d 6d 00 00 00 	movabs $0x6d6d,%r11
+  8022e1:	00 00 00 
+  8022e4:	4c 01 d8             	add    %r11,%rax
+  8022e7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8022ea:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8022ee:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc, 1, envid, (uint64_t) va, perm, 0, 0);
+  8022f1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8022f4:	48 63 f2             	movslq %edx,%rsi
+  8022f7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8022fb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8022fe:	48 63 d2             	movslq %edx,%rdx
+  802301:	48 83 ec 08          	sub    $0x8,%rsp
+  802305:	6a 00                	push   $0x0
+  802307:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80230d:	49 89 f0             	mov    %rsi,%r8
+  802310:	be 01 00 00 00       	mov    $0x1,%esi
+  802315:	bf 04 00 00 00       	mov    $0x4,%edi
+  80231a:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802321:	ff ff ff 
+  802324:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802328:	ff d0                	call   *%rax
+  80232a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80232e:	c9                   	leave
+  80232f:	c3                   	ret
+
+0000000000802330 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  802330:	55                   	push   %rbp
+  802331:	48 89 e5             	mov    %rsp,%rbp
+  802334:	48 83 ec 20          	sub    $0x20,%rsp
+  802338:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802338 <sys_page_map+0x8>
+  80233f:	49 bb 08 6d 00 00 00 	movabs $0x6d08,%r11
+  802346:	00 00 00 
+  802349:	4c 01 d8             	add    %r11,%rax
+  80234c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80234f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802353:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802356:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80235a:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+	return syscall(SYS_page_map, 1, srcenv, (uint64_t) srcva, dstenv, (uint64_t) dstva, perm);
+  80235e:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  802361:	48 63 f2             	movslq %edx,%rsi
+  802364:	4c 8b 45 e8          	mov    -0x18(%rbp),%r8
+  802368:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80236b:	48 63 fa             	movslq %edx,%rdi
+  80236e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802372:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802375:	48 63 d2             	movslq %edx,%rdx
+  802378:	48 83 ec 08          	sub    $0x8,%rsp
+  80237c:	56                   	push   %rsi
+  80237d:	4d 89 c1             	mov    %r8,%r9
+  802380:	49 89 f8             	mov    %rdi,%r8
+  802383:	be 01 00 00 00       	mov    $0x1,%esi
+  802388:	bf 05 00 00 00       	mov    $0x5,%edi
+  80238d:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802394:	ff ff ff 
+  802397:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80239b:	ff d0                	call   *%rax
+  80239d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a1:	c9                   	leave
+  8023a2:	c3                   	ret
+
+00000000008023a3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8023a3:	55                   	push   %rbp
+  8023a4:	48 89 e5             	mov    %rsp,%rbp
+  8023a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8023ab:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8023ab <sys_page_unmap+0x8>
+  8023b2:	49 bb 95 6c 00 00 00 	movabs $0x6c95,%r11
+  8023b9:	00 00 00 
+  8023bc:	4c 01 d8             	add    %r11,%rax
+  8023bf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023c2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap, 1, envid, (uint64_t) va, 0, 0, 0);
+  8023c6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8023ca:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8023cd:	48 63 d2             	movslq %edx,%rdx
+  8023d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d4:	6a 00                	push   $0x0
+  8023d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8023e7:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023ec:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  8023f3:	ff ff ff 
+  8023f6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8023fa:	ff d0                	call   *%rax
+  8023fc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802400:	c9                   	leave
+  802401:	c3                   	ret
+
+0000000000802402 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  802402:	55                   	push   %rbp
+  802403:	48 89 e5             	mov    %rsp,%rbp
+  802406:	48 83 ec 10          	sub    $0x10,%rsp
+  80240a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80240a <sys_env_set_status+0x8>
+  802411:	49 bb 36 6c 00 00 00 	movabs $0x6c36,%r11
+  802418:	00 00 00 
+  80241b:	4c 01 d8             	add    %r11,%rax
+  80241e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802421:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802424:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802427:	48 63 ca             	movslq %edx,%rcx
+  80242a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80242d:	48 63 d2             	movslq %edx,%rdx
+  802430:	48 83 ec 08          	sub    $0x8,%rsp
+  802434:	6a 00                	push   $0x0
+  802436:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80243c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802442:	be 01 00 00 00       	mov    $0x1,%esi
+  802447:	bf 08 00 00 00       	mov    $0x8,%edi
+  80244c:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802453:	ff ff ff 
+  802456:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80245a:	ff d0                	call   *%rax
+  80245c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802460:	c9                   	leave
+  802461:	c3                   	ret
+
+0000000000802462 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  802462:	55                   	push   %rbp
+  802463:	48 89 e5             	mov    %rsp,%rbp
+  802466:	48 83 ec 10          	sub    $0x10,%rsp
+  80246a:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80246a <sys_env_set_trapframe+0x8>
+  802471:	49 bb d6 6b 00 00 00 	movabs $0x6bd6,%r11
+  802478:	00 00 00 
+  80247b:	4c 01 d8             	add    %r11,%rax
+  80247e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802481:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t) tf, 0, 0, 0);
+  802485:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802489:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80248c:	48 63 d2             	movslq %edx,%rdx
+  80248f:	48 83 ec 08          	sub    $0x8,%rsp
+  802493:	6a 00                	push   $0x0
+  802495:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80249b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8024a6:	bf 09 00 00 00       	mov    $0x9,%edi
+  8024ab:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  8024b2:	ff ff ff 
+  8024b5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8024b9:	ff d0                	call   *%rax
+  8024bb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024bf:	c9                   	leave
+  8024c0:	c3                   	ret
+
+00000000008024c1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8024c1:	55                   	push   %rbp
+  8024c2:	48 89 e5             	mov    %rsp,%rbp
+  8024c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8024c9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8024c9 <sys_env_set_pgfault_upcall+0x8>
+  8024d0:	49 bb 77 6b 00 00 00 	movabs $0x6b77,%r11
+  8024d7:	00 00 00 
+  8024da:	4c 01 d8             	add    %r11,%rax
+  8024dd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t) upcall, 0, 0, 0);
+  8024e4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8024e8:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8024eb:	48 63 d2             	movslq %edx,%rdx
+  8024ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f2:	6a 00                	push   $0x0
+  8024f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802500:	be 01 00 00 00       	mov    $0x1,%esi
+  802505:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80250a:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802511:	ff ff ff 
+  802514:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802518:	ff d0                	call   *%rax
+  80251a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80251e:	c9                   	leave
+  80251f:	c3                   	ret
+
+0000000000802520 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  802520:	55                   	push   %rbp
+  802521:	48 89 e5             	mov    %rsp,%rbp
+  802524:	48 83 ec 20          	sub    $0x20,%rsp
+  802528:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802528 <sys_ipc_try_send+0x8>
+  80252f:	49 bb 18 6b 00 00 00 	movabs $0x6b18,%r11
+  802536:	00 00 00 
+  802539:	4c 01 d8             	add    %r11,%rax
+  80253c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80253f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802543:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802547:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  80254a:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80254d:	48 63 fa             	movslq %edx,%rdi
+  802550:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802554:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802557:	48 63 d2             	movslq %edx,%rdx
+  80255a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80255e:	48 83 ec 08          	sub    $0x8,%rsp
+  802562:	6a 00                	push   $0x0
+  802564:	49 89 f9             	mov    %rdi,%r9
+  802567:	49 89 f0             	mov    %rsi,%r8
+  80256a:	be 00 00 00 00       	mov    $0x0,%esi
+  80256f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802574:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  80257b:	ff ff ff 
+  80257e:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802582:	ff d0                	call   *%rax
+  802584:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802588:	c9                   	leave
+  802589:	c3                   	ret
+
+000000000080258a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint64_t value, void *srcva, int perm)
+{
+  80258a:	55                   	push   %rbp
+  80258b:	48 89 e5             	mov    %rsp,%rbp
+  80258e:	48 83 ec 20          	sub    $0x20,%rsp
+  802592:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802592 <sys_ipc_send+0x8>
+  802599:	49 bb ae 6a 00 00 00 	movabs $0x6aae,%r11
+  8025a0:	00 00 00 
+  8025a3:	4c 01 d8             	add    %r11,%rax
+  8025a6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025a9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025ad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025b1:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+	return syscall(SYS_ipc_send, 0, envid, value, (uint64_t) srcva, perm, 0);
+  8025b4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8025b7:	48 63 fa             	movslq %edx,%rdi
+  8025ba:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8025be:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8025c1:	48 63 d2             	movslq %edx,%rdx
+  8025c4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8025c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8025cc:	6a 00                	push   $0x0
+  8025ce:	49 89 f9             	mov    %rdi,%r9
+  8025d1:	49 89 f0             	mov    %rsi,%r8
+  8025d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d9:	bf 17 00 00 00       	mov    $0x17,%edi
+  8025de:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  8025e5:	ff ff ff 
+  8025e8:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8025ec:	ff d0                	call   *%rax
+  8025ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f2:	c9                   	leave
+  8025f3:	c3                   	ret
+
+00000000008025f4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8025f4:	55                   	push   %rbp
+  8025f5:	48 89 e5             	mov    %rsp,%rbp
+  8025f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8025fc:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8025fc <sys_ipc_recv+0x8>
+  802603:	49 bb 44 6a 00 00 00 	movabs $0x6a44,%r11
+  80260a:	00 00 00 
+  80260d:	4c 01 d8             	add    %r11,%rax
+  802610:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall_words(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0, 0);
+  802614:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802618:	6a 00                	push   $0x0
+  80261a:	6a 00                	push   $0x0
+  80261c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802622:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802628:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80262d:	be 01 00 00 00       	mov    $0x1,%esi
+  802632:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802637:	49 ba 24 8f ff ff ff 	movabs $0xffffffffffff8f24,%r10
+  80263e:	ff ff ff 
+  802641:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802645:	ff d0                	call   *%rax
+  802647:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80264b:	c9                   	leave
+  80264c:	c3                   	ret
+
+000000000080264d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint64_t value, void *srcva, int perm,
+	     void *dstva, uint64_t *words)
+{
+  80264d:	55                   	push   %rbp
+  80264e:	48 89 e5             	mov    %rsp,%rbp
+  802651:	48 83 ec 30          	sub    $0x30,%rsp
+  802655:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802655 <sys_ipc_call+0x8>
+  80265c:	49 bb eb 69 00 00 00 	movabs $0x69eb,%r11
+  802663:	00 00 00 
+  802666:	4c 01 d8             	add    %r11,%rax
+  802669:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80266c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802670:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802674:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  802677:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  80267b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_call, 0, envid, value, (uint64_t) srcva,
+  80267f:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802683:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  802686:	4c 63 c2             	movslq %edx,%r8
+  802689:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80268d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802690:	48 63 d2             	movslq %edx,%rdx
+  802693:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802697:	ff 75 d8             	push   -0x28(%rbp)
+  80269a:	56                   	push   %rsi
+  80269b:	4d 89 c1             	mov    %r8,%r9
+  80269e:	49 89 f8             	mov    %rdi,%r8
+  8026a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026a6:	bf 18 00 00 00       	mov    $0x18,%edi
+  8026ab:	49 ba 24 8f ff ff ff 	movabs $0xffffffffffff8f24,%r10
+  8026b2:	ff ff ff 
+  8026b5:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8026b9:	ff d0                	call   *%rax
+  8026bb:	48 83 c4 10          	add    $0x10,%rsp
+			     perm, (uint64_t) dstva, words);
+}
+  8026bf:	c9                   	leave
+  8026c0:	c3                   	ret
+
+00000000008026c1 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint64_t value, void *srcva, int perm,
+		   void *dstva, uint64_t *words)
+{
+  8026c1:	55                   	push   %rbp
+  8026c2:	48 89 e5             	mov    %rsp,%rbp
+  8026c5:	48 83 ec 30          	sub    $0x30,%rsp
+  8026c9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8026c9 <sys_ipc_reply_recv+0x8>
+  8026d0:	49 bb 77 69 00 00 00 	movabs $0x6977,%r11
+  8026d7:	00 00 00 
+  8026da:	4c 01 d8             	add    %r11,%rax
+  8026dd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026e4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026e8:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  8026eb:	4c 89 45 e0          	mov    %r8,-0x20(%rbp)
+  8026ef:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+	return syscall_words(SYS_ipc_reply_recv, 0, envid, value,
+  8026f3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8026f7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8026fa:	4c 63 c2             	movslq %edx,%r8
+  8026fd:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802701:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802704:	48 63 d2             	movslq %edx,%rdx
+  802707:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80270b:	ff 75 d8             	push   -0x28(%rbp)
+  80270e:	56                   	push   %rsi
+  80270f:	4d 89 c1             	mov    %r8,%r9
+  802712:	49 89 f8             	mov    %rdi,%r8
+  802715:	be 00 00 00 00       	mov    $0x0,%esi
+  80271a:	bf 19 00 00 00       	mov    $0x19,%edi
+  80271f:	49 ba 24 8f ff ff ff 	movabs $0xffffffffffff8f24,%r10
+  802726:	ff ff ff 
+  802729:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80272d:	ff d0                	call   *%rax
+  80272f:	48 83 c4 10          	add    $0x10,%rsp
+			     (uint64_t) srcva, perm, (uint64_t) dstva, words);
+}
+  802733:	c9                   	leave
+  802734:	c3                   	ret
+
+0000000000802735 <sys_env_set_priority>:
+
+int
+sys_env_set_priority(envid_t envid, int prio)
+{
+  802735:	55                   	push   %rbp
+  802736:	48 89 e5             	mov    %rsp,%rbp
+  802739:	48 83 ec 10          	sub    $0x10,%rsp
+  80273d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80273d <sys_env_set_priority+0x8>
+  802744:	49 bb 03 69 00 00 00 	movabs $0x6903,%r11
+  80274b:	00 00 00 
+  80274e:	4c 01 d8             	add    %r11,%rax
+  802751:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802754:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_priority, 1, envid, prio, 0, 0, 0);
+  802757:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80275a:	48 63 ca             	movslq %edx,%rcx
+  80275d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  802760:	48 63 d2             	movslq %edx,%rdx
+  802763:	48 83 ec 08          	sub    $0x8,%rsp
+  802767:	6a 00                	push   $0x0
+  802769:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80276f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802775:	be 01 00 00 00       	mov    $0x1,%esi
+  80277a:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80277f:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802786:	ff ff ff 
+  802789:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80278d:	ff d0                	call   *%rax
+  80278f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802793:	c9                   	leave
+  802794:	c3                   	ret
+
+0000000000802795 <sys_env_set_affinity>:
+
+int
+sys_env_set_affinity(envid_t envid, uint32_t mask)
+{
+  802795:	55                   	push   %rbp
+  802796:	48 89 e5             	mov    %rsp,%rbp
+  802799:	48 83 ec 10          	sub    $0x10,%rsp
+  80279d:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80279d <sys_env_set_affinity+0x8>
+  8027a4:	49 bb a3 68 00 00 00 	movabs $0x68a3,%r11
+  8027ab:	00 00 00 
+  8027ae:	4c 01 d8             	add    %r11,%rax
+  8027b1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027b4:	89 75 f8             	mov    %esi,-0x8(%rbp)
+	return syscall(SYS_env_set_affinity, 1, envid, mask, 0, 0, 0);
+  8027b7:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  8027ba:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8027bd:	48 63 d2             	movslq %edx,%rdx
+  8027c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8027c4:	6a 00                	push   $0x0
+  8027c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8027d7:	bf 10 00 00 00       	mov    $0x10,%edi
+  8027dc:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  8027e3:	ff ff ff 
+  8027e6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8027ea:	ff d0                	call   *%rax
+  8027ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027f0:	c9                   	leave
+  8027f1:	c3                   	ret
+
+00000000008027f2 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8027f2:	55                   	push   %rbp
+  8027f3:	48 89 e5             	mov    %rsp,%rbp
+  8027f6:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8027f6 <sys_time_msec+0x4>
+  8027fd:	49 bb 4a 68 00 00 00 	movabs $0x684a,%r11
+  802804:	00 00 00 
+  802807:	4c 01 d8             	add    %r11,%rax
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+  80280a:	48 83 ec 08          	sub    $0x8,%rsp
+  80280e:	6a 00                	push   $0x0
+  802810:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802816:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80281c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802821:	ba 00 00 00 00       	mov    $0x0,%edx
+  802826:	be 00 00 00 00       	mov    $0x0,%esi
+  80282b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802830:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802837:	ff ff ff 
+  80283a:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80283e:	ff d0                	call   *%rax
+  802840:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802844:	c9                   	leave
+  802845:	c3                   	ret
+
+0000000000802846 <sys_sleep_usec>:
+
+int
+sys_sleep_usec(uint64_t usec)
+{
+  802846:	55                   	push   %rbp
+  802847:	48 89 e5             	mov    %rsp,%rbp
+  80284a:	48 83 ec 10          	sub    $0x10,%rsp
+  80284e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80284e <sys_sleep_usec+0x8>
+  802855:	49 bb f2 67 00 00 00 	movabs $0x67f2,%r11
+  80285c:	00 00 00 
+  80285f:	4c 01 d8             	add    %r11,%rax
+  802862:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return syscall(SYS_sleep_usec, 0, usec, 0, 0, 0, 0);
+  802866:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80286a:	48 83 ec 08          	sub    $0x8,%rsp
+  80286e:	6a 00                	push   $0x0
+  802870:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802876:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80287c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802881:	be 00 00 00 00       	mov    $0x0,%esi
+  802886:	bf 11 00 00 00       	mov    $0x11,%edi
+  80288b:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802892:	ff ff ff 
+  802895:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802899:	ff d0                	call   *%rax
+  80289b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80289f:	c9                   	leave
+  8028a0:	c3                   	ret
+
+00000000008028a1 <sys_page_alloc_huge>:
+
+int
+sys_page_alloc_huge(envid_t envid, void *va, int perm)
+{
+  8028a1:	55                   	push   %rbp
+  8028a2:	48 89 e5             	mov    %rsp,%rbp
+  8028a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8028a9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8028a9 <sys_page_alloc_huge+0x8>
+  8028b0:	49 bb 97 67 00 00 00 	movabs $0x6797,%r11
+  8028b7:	00 00 00 
+  8028ba:	4c 01 d8             	add    %r11,%rax
+  8028bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028c4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	return syscall(SYS_page_alloc_huge, 1, envid, (uint64_t) va, perm, 0, 0);
+  8028c7:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8028ca:	48 63 f2             	movslq %edx,%rsi
+  8028cd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8028d1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8028d4:	48 63 d2             	movslq %edx,%rdx
+  8028d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8028db:	6a 00                	push   $0x0
+  8028dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028e3:	49 89 f0             	mov    %rsi,%r8
+  8028e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8028eb:	bf 12 00 00 00       	mov    $0x12,%edi
+  8028f0:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  8028f7:	ff ff ff 
+  8028fa:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8028fe:	ff d0                	call   *%rax
+  802900:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802904:	c9                   	leave
+  802905:	c3                   	ret
+
+0000000000802906 <sys_page_map_batch>:
+
+int
+sys_page_map_batch(const struct PageOp *ops, size_t n)
+{
+  802906:	55                   	push   %rbp
+  802907:	48 89 e5             	mov    %rsp,%rbp
+  80290a:	48 83 ec 10          	sub    $0x10,%rsp
+  80290e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80290e <sys_page_map_batch+0x8>
+  802915:	49 bb 32 67 00 00 00 	movabs $0x6732,%r11
+  80291c:	00 00 00 
+  80291f:	4c 01 d8             	add    %r11,%rax
+  802922:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802926:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_map_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  80292a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80292e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802932:	48 83 ec 08          	sub    $0x8,%rsp
+  802936:	6a 00                	push   $0x0
+  802938:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80293e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802944:	be 01 00 00 00       	mov    $0x1,%esi
+  802949:	bf 13 00 00 00       	mov    $0x13,%edi
+  80294e:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802955:	ff ff ff 
+  802958:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  80295c:	ff d0                	call   *%rax
+  80295e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802962:	c9                   	leave
+  802963:	c3                   	ret
+
+0000000000802964 <sys_page_alloc_batch>:
+
+int
+sys_page_alloc_batch(const struct PageOp *ops, size_t n)
+{
+  802964:	55                   	push   %rbp
+  802965:	48 89 e5             	mov    %rsp,%rbp
+  802968:	48 83 ec 10          	sub    $0x10,%rsp
+  80296c:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80296c <sys_page_alloc_batch+0x8>
+  802973:	49 bb d4 66 00 00 00 	movabs $0x66d4,%r11
+  80297a:	00 00 00 
+  80297d:	4c 01 d8             	add    %r11,%rax
+  802980:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802984:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_alloc_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  802988:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80298c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802990:	48 83 ec 08          	sub    $0x8,%rsp
+  802994:	6a 00                	push   $0x0
+  802996:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80299c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8029a7:	bf 14 00 00 00       	mov    $0x14,%edi
+  8029ac:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  8029b3:	ff ff ff 
+  8029b6:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  8029ba:	ff d0                	call   *%rax
+  8029bc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029c0:	c9                   	leave
+  8029c1:	c3                   	ret
+
+00000000008029c2 <sys_page_unmap_batch>:
+
+int
+sys_page_unmap_batch(const struct PageOp *ops, size_t n)
+{
+  8029c2:	55                   	push   %rbp
+  8029c3:	48 89 e5             	mov    %rsp,%rbp
+  8029c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8029ca:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8029ca <sys_page_unmap_batch+0x8>
+  8029d1:	49 bb 76 66 00 00 00 	movabs $0x6676,%r11
+  8029d8:	00 00 00 
+  8029db:	4c 01 d8             	add    %r11,%rax
+  8029de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+	return syscall(SYS_page_unmap_batch, 1, (uint64_t) ops, n, 0, 0, 0);
+  8029e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8029ea:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8029ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8029f2:	6a 00                	push   $0x0
+  8029f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a00:	be 01 00 00 00       	mov    $0x1,%esi
+  802a05:	bf 15 00 00 00       	mov    $0x15,%edi
+  802a0a:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802a11:	ff ff ff 
+  802a14:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a18:	ff d0                	call   *%rax
+  802a1a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a1e:	c9                   	leave
+  802a1f:	c3                   	ret
+
+0000000000802a20 <sys_fork>:
+
+envid_t
+sys_fork(void)
+{
+  802a20:	55                   	push   %rbp
+  802a21:	48 89 e5             	mov    %rsp,%rbp
+  802a24:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 802a24 <sys_fork+0x4>
+  802a2b:	49 bb 1c 66 00 00 00 	movabs $0x661c,%r11
+  802a32:	00 00 00 
+  802a35:	4c 01 d8             	add    %r11,%rax
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+  802a38:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3c:	6a 00                	push   $0x0
+  802a3e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a44:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a54:	be 00 00 00 00       	mov    $0x0,%esi
+  802a59:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a5e:	49 ba 6a 8e ff ff ff 	movabs $0xffffffffffff8e6a,%r10
+  802a65:	ff ff ff 
+  802a68:	4a 8d 04 10          	lea    (%rax,%r10,1),%rax
+  802a6c:	ff d0                	call   *%rax
+  802a6e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a72:	c9                   	leave
+  802a73:	c3                   	ret
+
+0000000000802a74 <pgfault>:
+// The kernel now does this itself (page_cow), so ufork's children only
+// get here if the kernel had no memory for the copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  802a74:	55                   	push   %rbp
+  802a75:	48 89 e5             	mov    %rsp,%rbp
+  802a78:	41 57                	push   %r15
+  802a7a:	53                   	push   %rbx
+  802a7b:	48 83 ec 40          	sub    $0x40,%rsp
+  802a7f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802a7f <pgfault+0xb>
+  802a86:	49 bb c1 65 00 00 00 	movabs $0x65c1,%r11
+  802a8d:	00 00 00 
+  802a90:	4c 01 db             	add    %r11,%rbx
+  802a93:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+	void *addr = (void *) utf->utf_fault_va;
+  802a97:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a9b:	48 8b 00             	mov    (%rax),%rax
+  802a9e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	uint32_t err = utf->utf_err;
+  802aa2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802aa6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802aaa:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	int r;
+
+	addr = (void*)ROUNDDOWN(addr,PGSIZE);
+  802aad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ab1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802ab5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ab9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802abf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	// copy-on-write page.  If not, panic.
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	if (err & FEC_WR){
+  802ac3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ac6:	83 e0 02             	and    $0x2,%eax
+  802ac9:	85 c0                	test   %eax,%eax
+  802acb:	0f 84 91 03 00 00    	je     802e62 <pgfault+0x3ee>
+		// A 2MB page is copied as a whole.
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802ad1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ad5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ad9:	48 89 c2             	mov    %rax,%rdx
+  802adc:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  802ae3:	ff ff ff 
+  802ae6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802aea:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802aee:	83 e0 01             	and    $0x1,%eax
+  802af1:	48 85 c0             	test   %rax,%rax
+  802af4:	0f 84 a7 01 00 00    	je     802ca1 <pgfault+0x22d>
+		    (uvpd[VPD(addr)] & (PTE_PS | PTE_COW)) == (PTE_PS | PTE_COW)){
+  802afa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802afe:	48 c1 e8 15          	shr    $0x15,%rax
+  802b02:	48 89 c2             	mov    %rax,%rdx
+  802b05:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  802b0c:	ff ff ff 
+  802b0f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802b13:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b17:	25 80 08 00 00       	and    $0x880,%eax
+		if ((uvpde[VPDPE(addr)] & PTE_P) &&
+  802b1c:	48 3d 80 08 00 00    	cmp    $0x880,%rax
+  802b22:	0f 85 79 01 00 00    	jne    802ca1 <pgfault+0x22d>
+			addr = (void*)ROUNDDOWN(addr,PTSIZE);
+  802b28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b2c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802b30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b34:	48 25 00 00 e0 ff    	and    $0xffffffffffe00000,%rax
+  802b3a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+			if ((r = sys_page_alloc_huge(0,HUGETEMP,PTE_W | PTE_U | PTE_P)) < 0)
+  802b3e:	ba 07 00 00 00       	mov    $0x7,%edx
+  802b43:	be 00 00 60 00       	mov    $0x600000,%esi
+  802b48:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b4d:	49 89 df             	mov    %rbx,%r15
+  802b50:	48 b8 61 98 ff ff ff 	movabs $0xffffffffffff9861,%rax
+  802b57:	ff ff ff 
+  802b5a:	48 01 d8             	add    %rbx,%rax
+  802b5d:	ff d0                	call   *%rax
+  802b5f:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802b62:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802b66:	79 44                	jns    802bac <pgfault+0x138>
+				panic("sys_page_alloc_huge failed: %e\n", r);
+  802b68:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802b6b:	89 c1                	mov    %eax,%ecx
+  802b6d:	48 b8 d8 e3 ff ff ff 	movabs $0xffffffffffffe3d8,%rax
+  802b74:	ff ff ff 
+  802b77:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b7b:	48 89 c2             	mov    %rax,%rdx
+  802b7e:	be 20 00 00 00       	mov    $0x20,%esi
+  802b83:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802b8a:	ff ff ff 
+  802b8d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802b91:	48 89 c7             	mov    %rax,%rdi
+  802b94:	49 89 df             	mov    %rbx,%r15
+  802b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9c:	49 b8 36 75 ff ff ff 	movabs $0xffffffffffff7536,%r8
+  802ba3:	ff ff ff 
+  802ba6:	49 01 d8             	add    %rbx,%r8
+  802ba9:	41 ff d0             	call   *%r8
+			memcpy(HUGETEMP,addr,PTSIZE);
+  802bac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bb0:	ba 00 00 20 00       	mov    $0x200000,%edx
+  802bb5:	48 89 c6             	mov    %rax,%rsi
+  802bb8:	bf 00 00 60 00       	mov    $0x600000,%edi
+  802bbd:	49 89 df             	mov    %rbx,%r15
+  802bc0:	48 b8 da 8a ff ff ff 	movabs $0xffffffffffff8ada,%rax
+  802bc7:	ff ff ff 
+  802bca:	48 01 d8             	add    %rbx,%rax
+  802bcd:	ff d0                	call   *%rax
+			if (sys_page_map(0,HUGETEMP,0,addr,PTE_W | PTE_U | PTE_P))
+  802bcf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bd3:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802bd9:	48 89 c1             	mov    %rax,%rcx
+  802bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be1:	be 00 00 60 00       	mov    $0x600000,%esi
+  802be6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802beb:	49 89 df             	mov    %rbx,%r15
+  802bee:	48 b8 f0 92 ff ff ff 	movabs $0xffffffffffff92f0,%rax
+  802bf5:	ff ff ff 
+  802bf8:	48 01 d8             	add    %rbx,%rax
+  802bfb:	ff d0                	call   *%rax
+  802bfd:	85 c0                	test   %eax,%eax
+  802bff:	74 3e                	je     802c3f <pgfault+0x1cb>
+				panic("sys_page_map failed\n");
+  802c01:	48 b8 03 e4 ff ff ff 	movabs $0xffffffffffffe403,%rax
+  802c08:	ff ff ff 
+  802c0b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c0f:	48 89 c2             	mov    %rax,%rdx
+  802c12:	be 23 00 00 00       	mov    $0x23,%esi
+  802c17:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802c1e:	ff ff ff 
+  802c21:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c25:	48 89 c7             	mov    %rax,%rdi
+  802c28:	49 89 df             	mov    %rbx,%r15
+  802c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c30:	48 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%rcx
+  802c37:	ff ff ff 
+  802c3a:	48 01 d9             	add    %rbx,%rcx
+  802c3d:	ff d1                	call   *%rcx
+			if (sys_page_unmap(0,HUGETEMP))
+  802c3f:	be 00 00 60 00       	mov    $0x600000,%esi
+  802c44:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c49:	49 89 df             	mov    %rbx,%r15
+  802c4c:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  802c53:	ff ff ff 
+  802c56:	48 01 d8             	add    %rbx,%rax
+  802c59:	ff d0                	call   *%rax
+  802c5b:	85 c0                	test   %eax,%eax
+  802c5d:	0f 84 3d 02 00 00    	je     802ea0 <pgfault+0x42c>
+				panic("sys_page_unmap failed\n");
+  802c63:	48 b8 18 e4 ff ff ff 	movabs $0xffffffffffffe418,%rax
+  802c6a:	ff ff ff 
+  802c6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c71:	48 89 c2             	mov    %rax,%rdx
+  802c74:	be 25 00 00 00       	mov    $0x25,%esi
+  802c79:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802c80:	ff ff ff 
+  802c83:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802c87:	48 89 c7             	mov    %rax,%rdi
+  802c8a:	49 89 df             	mov    %rbx,%r15
+  802c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c92:	48 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%rcx
+  802c99:	ff ff ff 
+  802c9c:	48 01 d9             	add    %rbx,%rcx
+  802c9f:	ff d1                	call   *%rcx
+			return;
+		}
+		if (uvpt[VPN(addr)] & PTE_COW){
+  802ca1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ca5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ca9:	48 89 c2             	mov    %rax,%rdx
+  802cac:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  802cb3:	ff ff ff 
+  802cb6:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802cba:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cbe:	25 00 08 00 00       	and    $0x800,%eax
+  802cc3:	48 85 c0             	test   %rax,%rax
+  802cc6:	0f 84 58 01 00 00    	je     802e24 <pgfault+0x3b0>
+			if (sys_page_alloc(0,PFTEMP,PTE_W | PTE_U | PTE_P)){
+  802ccc:	ba 07 00 00 00       	mov    $0x7,%edx
+  802cd1:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802cd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cdb:	49 89 df             	mov    %rbx,%r15
+  802cde:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  802ce5:	ff ff ff 
+  802ce8:	48 01 d8             	add    %rbx,%rax
+  802ceb:	ff d0                	call   *%rax
+  802ced:	85 c0                	test   %eax,%eax
+  802cef:	74 3e                	je     802d2f <pgfault+0x2bb>
+				panic("sys_page_alloc failed\n");
+  802cf1:	48 b8 2f e4 ff ff ff 	movabs $0xffffffffffffe42f,%rax
+  802cf8:	ff ff ff 
+  802cfb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802cff:	48 89 c2             	mov    %rax,%rdx
+  802d02:	be 2a 00 00 00       	mov    $0x2a,%esi
+  802d07:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802d0e:	ff ff ff 
+  802d11:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d15:	48 89 c7             	mov    %rax,%rdi
+  802d18:	49 89 df             	mov    %rbx,%r15
+  802d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d20:	48 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%rcx
+  802d27:	ff ff ff 
+  802d2a:	48 01 d9             	add    %rbx,%rcx
+  802d2d:	ff d1                	call   *%rcx
+			}
+			memcpy((void*)PFTEMP,addr,PGSIZE);
+  802d2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d33:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d38:	48 89 c6             	mov    %rax,%rsi
+  802d3b:	bf 00 f0 5f 00       	mov    $0x5ff000,%edi
+  802d40:	49 89 df             	mov    %rbx,%r15
+  802d43:	48 b8 da 8a ff ff ff 	movabs $0xffffffffffff8ada,%rax
+  802d4a:	ff ff ff 
+  802d4d:	48 01 d8             	add    %rbx,%rax
+  802d50:	ff d0                	call   *%rax
+			if (sys_page_map(0,PFTEMP,0,addr,PTE_W | PTE_U | PTE_P)){
+  802d52:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d56:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802d5c:	48 89 c1             	mov    %rax,%rcx
+  802d5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d64:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6e:	49 89 df             	mov    %rbx,%r15
+  802d71:	48 b8 f0 92 ff ff ff 	movabs $0xffffffffffff92f0,%rax
+  802d78:	ff ff ff 
+  802d7b:	48 01 d8             	add    %rbx,%rax
+  802d7e:	ff d0                	call   *%rax
+  802d80:	85 c0                	test   %eax,%eax
+  802d82:	74 3e                	je     802dc2 <pgfault+0x34e>
+				panic("sys_page_map failed\n");
+  802d84:	48 b8 03 e4 ff ff ff 	movabs $0xffffffffffffe403,%rax
+  802d8b:	ff ff ff 
+  802d8e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802d92:	48 89 c2             	mov    %rax,%rdx
+  802d95:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802d9a:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802da1:	ff ff ff 
+  802da4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802da8:	48 89 c7             	mov    %rax,%rdi
+  802dab:	49 89 df             	mov    %rbx,%r15
+  802dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db3:	48 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%rcx
+  802dba:	ff ff ff 
+  802dbd:	48 01 d9             	add    %rbx,%rcx
+  802dc0:	ff d1                	call   *%rcx
+			}
+
+			if (sys_page_unmap(0,(void*)PFTEMP)){
+  802dc2:	be 00 f0 5f 00       	mov    $0x5ff000,%esi
+  802dc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dcc:	49 89 df             	mov    %rbx,%r15
+  802dcf:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  802dd6:	ff ff ff 
+  802dd9:	48 01 d8             	add    %rbx,%rax
+  802ddc:	ff d0                	call   *%rax
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	0f 84 bb 00 00 00    	je     802ea1 <pgfault+0x42d>
+				panic ("sys_page_unmap failed\n");
+  802de6:	48 b8 18 e4 ff ff ff 	movabs $0xffffffffffffe418,%rax
+  802ded:	ff ff ff 
+  802df0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802df4:	48 89 c2             	mov    %rax,%rdx
+  802df7:	be 32 00 00 00       	mov    $0x32,%esi
+  802dfc:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802e03:	ff ff ff 
+  802e06:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e0a:	48 89 c7             	mov    %rax,%rdi
+  802e0d:	49 89 df             	mov    %rbx,%r15
+  802e10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e15:	48 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%rcx
+  802e1c:	ff ff ff 
+  802e1f:	48 01 d9             	add    %rbx,%rcx
+  802e22:	ff d1                	call   *%rcx
+			}
+		}
+		else {
+			panic("pgfault VPN(addr) not PTE_COW\n");
+  802e24:	48 b8 48 e4 ff ff ff 	movabs $0xffffffffffffe448,%rax
+  802e2b:	ff ff ff 
+  802e2e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e32:	48 89 c2             	mov    %rax,%rdx
+  802e35:	be 36 00 00 00       	mov    $0x36,%esi
+  802e3a:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802e41:	ff ff ff 
+  802e44:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e48:	48 89 c7             	mov    %rax,%rdi
+  802e4b:	49 89 df             	mov    %rbx,%r15
+  802e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e53:	48 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%rcx
+  802e5a:	ff ff ff 
+  802e5d:	48 01 d9             	add    %rbx,%rcx
+  802e60:	ff d1                	call   *%rcx
+		}
+	}
+	else {
+		panic("pgfault err not PTE_W\n");
+  802e62:	48 b8 67 e4 ff ff ff 	movabs $0xffffffffffffe467,%rax
+  802e69:	ff ff ff 
+  802e6c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e70:	48 89 c2             	mov    %rax,%rdx
+  802e73:	be 3a 00 00 00       	mov    $0x3a,%esi
+  802e78:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802e7f:	ff ff ff 
+  802e82:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802e86:	48 89 c7             	mov    %rax,%rdi
+  802e89:	49 89 df             	mov    %rbx,%r15
+  802e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e91:	48 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%rcx
+  802e98:	ff ff ff 
+  802e9b:	48 01 d9             	add    %rbx,%rcx
+  802e9e:	ff d1                	call   *%rcx
+			return;
+  802ea0:	90                   	nop
+	//   You should make three system calls.
+	//   No need to explicitly delete the old page's mapping.
+
+	// LAB 4: Your code here.
+
+}
+  802ea1:	48 83 c4 40          	add    $0x40,%rsp
+  802ea5:	5b                   	pop    %rbx
+  802ea6:	41 5f                	pop    %r15
+  802ea8:	5d                   	pop    %rbp
+  802ea9:	c3                   	ret
+
+0000000000802eaa <fork_flush>:
+static struct PageOp fork_ops[FORK_NOPS];
+static size_t fork_nops;
+
+static void
+fork_flush(void)
+{
+  802eaa:	55                   	push   %rbp
+  802eab:	48 89 e5             	mov    %rsp,%rbp
+  802eae:	41 57                	push   %r15
+  802eb0:	53                   	push   %rbx
+  802eb1:	48 83 ec 10          	sub    $0x10,%rsp
+  802eb5:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802eb5 <fork_flush+0xb>
+  802ebc:	49 bb 8b 61 00 00 00 	movabs $0x618b,%r11
+  802ec3:	00 00 00 
+  802ec6:	4c 01 db             	add    %r11,%rbx
+	int r;
+
+	if (fork_nops && (r = sys_page_map_batch(fork_ops, fork_nops)) < 0)
+  802ec9:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ed0:	00 00 00 
+  802ed3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802ed7:	48 85 c0             	test   %rax,%rax
+  802eda:	0f 84 81 00 00 00    	je     802f61 <fork_flush+0xb7>
+  802ee0:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802ee7:	00 00 00 
+  802eea:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802eee:	48 89 c6             	mov    %rax,%rsi
+  802ef1:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802ef8:	00 00 00 
+  802efb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802eff:	48 89 c7             	mov    %rax,%rdi
+  802f02:	49 89 df             	mov    %rbx,%r15
+  802f05:	48 b8 c6 98 ff ff ff 	movabs $0xffffffffffff98c6,%rax
+  802f0c:	ff ff ff 
+  802f0f:	48 01 d8             	add    %rbx,%rax
+  802f12:	ff d0                	call   *%rax
+  802f14:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f17:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f1b:	79 44                	jns    802f61 <fork_flush+0xb7>
+		panic("sys_page_map_batch in fork failed: %e\n", r);
+  802f1d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f20:	89 c1                	mov    %eax,%ecx
+  802f22:	48 b8 80 e4 ff ff ff 	movabs $0xffffffffffffe480,%rax
+  802f29:	ff ff ff 
+  802f2c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f30:	48 89 c2             	mov    %rax,%rdx
+  802f33:	be 56 00 00 00       	mov    $0x56,%esi
+  802f38:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  802f3f:	ff ff ff 
+  802f42:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802f46:	48 89 c7             	mov    %rax,%rdi
+  802f49:	49 89 df             	mov    %rbx,%r15
+  802f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f51:	49 b8 36 75 ff ff ff 	movabs $0xffffffffffff7536,%r8
+  802f58:	ff ff ff 
+  802f5b:	49 01 d8             	add    %rbx,%r8
+  802f5e:	41 ff d0             	call   *%r8
+	fork_nops = 0;
+  802f61:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802f68:	00 00 00 
+  802f6b:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  802f72:	00 
+}
+  802f73:	90                   	nop
+  802f74:	48 83 c4 10          	add    $0x10,%rsp
+  802f78:	5b                   	pop    %rbx
+  802f79:	41 5f                	pop    %r15
+  802f7b:	5d                   	pop    %rbp
+  802f7c:	c3                   	ret
+
+0000000000802f7d <fork_map>:
+
+// Queue sys_page_map(0, addr, envid, addr, perm).
+static void
+fork_map(envid_t envid, uintptr_t addr, int perm)
+{
+  802f7d:	55                   	push   %rbp
+  802f7e:	48 89 e5             	mov    %rsp,%rbp
+  802f81:	53                   	push   %rbx
+  802f82:	48 83 ec 28          	sub    $0x28,%rsp
+  802f86:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 802f86 <fork_map+0x9>
+  802f8d:	49 bb ba 60 00 00 00 	movabs $0x60ba,%r11
+  802f94:	00 00 00 
+  802f97:	4c 01 db             	add    %r11,%rbx
+  802f9a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f9d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802fa1:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	struct PageOp *op;
+
+	if (fork_nops == FORK_NOPS)
+  802fa4:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fab:	00 00 00 
+  802fae:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fb2:	48 3d 80 00 00 00    	cmp    $0x80,%rax
+  802fb8:	75 10                	jne    802fca <fork_map+0x4d>
+		fork_flush();
+  802fba:	48 b8 6a 9e ff ff ff 	movabs $0xffffffffffff9e6a,%rax
+  802fc1:	ff ff ff 
+  802fc4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fc8:	ff d0                	call   *%rax
+	op = &fork_ops[fork_nops++];
+  802fca:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  802fd1:	00 00 00 
+  802fd4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  802fd8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802fdc:	48 b9 c0 1f 00 00 00 	movabs $0x1fc0,%rcx
+  802fe3:	00 00 00 
+  802fe6:	48 89 14 0b          	mov    %rdx,(%rbx,%rcx,1)
+  802fea:	48 c1 e0 05          	shl    $0x5,%rax
+  802fee:	48 89 c2             	mov    %rax,%rdx
+  802ff1:	48 b8 c0 0f 00 00 00 	movabs $0xfc0,%rax
+  802ff8:	00 00 00 
+  802ffb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  802fff:	48 01 d0             	add    %rdx,%rax
+  803002:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	op->srcenvid = 0;
+  803006:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80300a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+	op->srcva = addr;
+  803010:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803014:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803018:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	op->dstenvid = envid;
+  80301c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803020:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803023:	89 50 04             	mov    %edx,0x4(%rax)
+	op->dstva = addr;
+  803026:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80302a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80302e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+	op->perm = perm;
+  803032:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803036:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803039:	89 50 18             	mov    %edx,0x18(%rax)
+}
+  80303c:	90                   	nop
+  80303d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803041:	c9                   	leave
+  803042:	c3                   	ret
+
+0000000000803043 <duppage>:
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, unsigned pn)
+{
+  803043:	55                   	push   %rbp
+  803044:	48 89 e5             	mov    %rsp,%rbp
+  803047:	53                   	push   %rbx
+  803048:	48 83 ec 28          	sub    $0x28,%rsp
+  80304c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80304c <duppage+0x9>
+  803053:	49 bb f4 5f 00 00 00 	movabs $0x5ff4,%r11
+  80305a:	00 00 00 
+  80305d:	4c 01 db             	add    %r11,%rbx
+  803060:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803063:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	uintptr_t addr = (uintptr_t)pn * PGSIZE;
+  803066:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  803069:	48 c1 e0 0c          	shl    $0xc,%rax
+  80306d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+	if (uvpt[pn] & PTE_SHARE){
+  803071:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803078:	ff ff ff 
+  80307b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80307f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803082:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803086:	25 00 04 00 00       	and    $0x400,%eax
+  80308b:	48 85 c0             	test   %rax,%rax
+  80308e:	74 42                	je     8030d2 <duppage+0x8f>
+		fork_map(envid, addr, uvpt[pn] & (PTE_SYSCALL | PTE_SHARE));
+  803090:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803097:	ff ff ff 
+  80309a:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80309e:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030a1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030a5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030aa:	89 c2                	mov    %eax,%edx
+  8030ac:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8030b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030b3:	48 89 ce             	mov    %rcx,%rsi
+  8030b6:	89 c7                	mov    %eax,%edi
+  8030b8:	48 b8 3d 9f ff ff ff 	movabs $0xffffffffffff9f3d,%rax
+  8030bf:	ff ff ff 
+  8030c2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8030c6:	ff d0                	call   *%rax
+		return 0;
+  8030c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030cd:	e9 ae 00 00 00       	jmp    803180 <duppage+0x13d>
+	}
+		
+	if (uvpt[pn] & PTE_W || uvpt[pn] & PTE_COW){
+  8030d2:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030d9:	ff ff ff 
+  8030dc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030e0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8030e3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030e7:	83 e0 02             	and    $0x2,%eax
+  8030ea:	48 85 c0             	test   %rax,%rax
+  8030ed:	75 1f                	jne    80310e <duppage+0xcb>
+  8030ef:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8030f6:	ff ff ff 
+  8030f9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8030fd:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803100:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803104:	25 00 08 00 00       	and    $0x800,%eax
+  803109:	48 85 c0             	test   %rax,%rax
+  80310c:	74 4c                	je     80315a <duppage+0x117>
+		unsigned int perm = PTE_COW | PTE_U | PTE_P;
+  80310e:	c7 45 e4 05 08 00 00 	movl   $0x805,-0x1c(%rbp)
+		fork_map(envid, addr, perm);
+  803115:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803118:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80311c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80311f:	48 89 ce             	mov    %rcx,%rsi
+  803122:	89 c7                	mov    %eax,%edi
+  803124:	48 b8 3d 9f ff ff ff 	movabs $0xffffffffffff9f3d,%rax
+  80312b:	ff ff ff 
+  80312e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803132:	ff d0                	call   *%rax
+		fork_map(0, addr, perm);
+  803134:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  803137:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80313b:	48 89 c6             	mov    %rax,%rsi
+  80313e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803143:	48 b8 3d 9f ff ff ff 	movabs $0xffffffffffff9f3d,%rax
+  80314a:	ff ff ff 
+  80314d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803151:	ff d0                	call   *%rax
+		return 0;
+  803153:	b8 00 00 00 00       	mov    $0x0,%eax
+  803158:	eb 26                	jmp    803180 <duppage+0x13d>
+
+	}
+	else {
+		fork_map(envid, addr, PTE_U | PTE_P);
+  80315a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80315e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803161:	ba 05 00 00 00       	mov    $0x5,%edx
+  803166:	48 89 ce             	mov    %rcx,%rsi
+  803169:	89 c7                	mov    %eax,%edi
+  80316b:	48 b8 3d 9f ff ff ff 	movabs $0xffffffffffff9f3d,%rax
+  803172:	ff ff ff 
+  803175:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803179:	ff d0                	call   *%rax
+		return 0;
+  80317b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+}
+  803180:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803184:	c9                   	leave
+  803185:	c3                   	ret
+
+0000000000803186 <duphuge>:
+// Like duppage, for the 2MB page (see sys_page_alloc_huge) at 'addr'.
+// uvpt does not describe it; its page directory entry does.
+//
+static int
+duphuge(envid_t envid, uintptr_t addr)
+{
+  803186:	55                   	push   %rbp
+  803187:	48 89 e5             	mov    %rsp,%rbp
+  80318a:	53                   	push   %rbx
+  80318b:	48 83 ec 28          	sub    $0x28,%rsp
+  80318f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80318f <duphuge+0x9>
+  803196:	49 bb b1 5e 00 00 00 	movabs $0x5eb1,%r11
+  80319d:	00 00 00 
+  8031a0:	4c 01 db             	add    %r11,%rbx
+  8031a3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031a6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	pde_t pde = uvpd[VPD(addr)];
+  8031aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031ae:	48 c1 e8 15          	shr    $0x15,%rax
+  8031b2:	48 89 c2             	mov    %rax,%rdx
+  8031b5:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8031bc:	ff ff ff 
+  8031bf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8031c3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031c7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	unsigned int perm;
+
+	if (pde & PTE_SHARE)
+  8031cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031cf:	25 00 04 00 00       	and    $0x400,%eax
+  8031d4:	48 85 c0             	test   %rax,%rax
+  8031d7:	74 0e                	je     8031e7 <duphuge+0x61>
+		perm = pde & PTE_SYSCALL;
+  8031d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031e2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8031e5:	eb 1e                	jmp    803205 <duphuge+0x7f>
+	else if (pde & (PTE_W | PTE_COW))
+  8031e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031eb:	25 02 08 00 00       	and    $0x802,%eax
+  8031f0:	48 85 c0             	test   %rax,%rax
+  8031f3:	74 09                	je     8031fe <duphuge+0x78>
+		perm = PTE_COW | PTE_U | PTE_P;
+  8031f5:	c7 45 ec 05 08 00 00 	movl   $0x805,-0x14(%rbp)
+  8031fc:	eb 07                	jmp    803205 <duphuge+0x7f>
+	else
+		perm = PTE_U | PTE_P;
+  8031fe:	c7 45 ec 05 00 00 00 	movl   $0x5,-0x14(%rbp)
+
+	fork_map(envid, addr, perm);
+  803205:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803208:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80320c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80320f:	48 89 ce             	mov    %rcx,%rsi
+  803212:	89 c7                	mov    %eax,%edi
+  803214:	48 b8 3d 9f ff ff ff 	movabs $0xffffffffffff9f3d,%rax
+  80321b:	ff ff ff 
+  80321e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803222:	ff d0                	call   *%rax
+	if (perm & PTE_COW)
+  803224:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803227:	25 00 08 00 00       	and    $0x800,%eax
+  80322c:	85 c0                	test   %eax,%eax
+  80322e:	74 1f                	je     80324f <duphuge+0xc9>
+		fork_map(0, addr, perm);
+  803230:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803233:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803237:	48 89 c6             	mov    %rax,%rsi
+  80323a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80323f:	48 b8 3d 9f ff ff ff 	movabs $0xffffffffffff9f3d,%rax
+  803246:	ff ff ff 
+  803249:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80324d:	ff d0                	call   *%rax
+	return 0;
+  80324f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803254:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803258:	c9                   	leave
+  803259:	c3                   	ret
+
+000000000080325a <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  80325a:	55                   	push   %rbp
+  80325b:	48 89 e5             	mov    %rsp,%rbp
+  80325e:	41 57                	push   %r15
+  803260:	53                   	push   %rbx
+  803261:	48 83 ec 10          	sub    $0x10,%rsp
+  803265:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803265 <fork+0xb>
+  80326c:	49 bb db 5d 00 00 00 	movabs $0x5ddb,%r11
+  803273:	00 00 00 
+  803276:	4c 01 db             	add    %r11,%rbx
+	envid_t envid;
+
+	if ((envid = sys_fork()) == 0)
+  803279:	49 89 df             	mov    %rbx,%r15
+  80327c:	48 b8 e0 99 ff ff ff 	movabs $0xffffffffffff99e0,%rax
+  803283:	ff ff ff 
+  803286:	48 01 d8             	add    %rbx,%rax
+  803289:	ff d0                	call   *%rax
+  80328b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80328e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803292:	75 42                	jne    8032d6 <fork+0x7c>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803294:	49 89 df             	mov    %rbx,%r15
+  803297:	48 b8 e2 91 ff ff ff 	movabs $0xffffffffffff91e2,%rax
+  80329e:	ff ff ff 
+  8032a1:	48 01 d8             	add    %rbx,%rax
+  8032a4:	ff d0                	call   *%rax
+  8032a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8032ab:	48 98                	cltq
+  8032ad:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  8032b4:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  8032bb:	ff ff ff 
+  8032be:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8032c2:	48 01 c2             	add    %rax,%rdx
+  8032c5:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8032cc:	ff ff ff 
+  8032cf:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8032d3:	48 89 10             	mov    %rdx,(%rax)
+	return envid;
+  8032d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8032d9:	48 83 c4 10          	add    $0x10,%rsp
+  8032dd:	5b                   	pop    %rbx
+  8032de:	41 5f                	pop    %r15
+  8032e0:	5d                   	pop    %rbp
+  8032e1:	c3                   	ret
+
+00000000008032e2 <ufork>:
+    The child is now ready to run, so the parent marks it runnable.
+
+*/
+envid_t
+ufork(void)
+{
+  8032e2:	55                   	push   %rbp
+  8032e3:	48 89 e5             	mov    %rsp,%rbp
+  8032e6:	41 57                	push   %r15
+  8032e8:	53                   	push   %rbx
+  8032e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8032ed:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8032ed <ufork+0xb>
+  8032f4:	49 bb 53 5d 00 00 00 	movabs $0x5d53,%r11
+  8032fb:	00 00 00 
+  8032fe:	4c 01 db             	add    %r11,%rbx
+	
+	set_pgfault_handler(pgfault);
+  803301:	48 b8 34 9a ff ff ff 	movabs $0xffffffffffff9a34,%rax
+  803308:	ff ff ff 
+  80330b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80330f:	48 89 c7             	mov    %rax,%rdi
+  803312:	49 89 df             	mov    %rbx,%r15
+  803315:	48 b8 95 dc ff ff ff 	movabs $0xffffffffffffdc95,%rax
+  80331c:	ff ff ff 
+  80331f:	48 01 d8             	add    %rbx,%rax
+  803322:	ff d0                	call   *%rax
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  803324:	b8 07 00 00 00       	mov    $0x7,%eax
+  803329:	cd 30                	int    $0x30
+  80332b:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		: "=a" (ret)
+		: "a" (SYS_exofork),
+		  "i" (T_SYSCALL)
+	);
+	return ret;
+  80332e:	8b 45 e0             	mov    -0x20(%rbp),%eax
+	envid_t child_envid = sys_exofork();
+  803331:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+	if (child_envid){
+  803334:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803338:	0f 84 03 02 00 00    	je     803541 <ufork+0x25f>
+		//called inside parent
+
+		
+		//user address space is below UTOP, so we only need PML4[0].
+		uint64_t addr = 0;
+  80333e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803345:	00 
+
+		//even though I think user mode can potentially have mappings 
+		//above the UXSTACKTOP, I think for the lab its safe and easier
+		//to keep the bound at USTACKTOP.
+		for (; addr < USTACKTOP;){
+  803346:	e9 28 01 00 00       	jmp    803473 <ufork+0x191>
+			if (uvpde[VPDPE(addr)] & PTE_P){
+  80334b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80334f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803353:	48 89 c2             	mov    %rax,%rdx
+  803356:	48 b8 f0 ff ff ff ff 	movabs $0xfffffffffffffff0,%rax
+  80335d:	ff ff ff 
+  803360:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803364:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803368:	83 e0 01             	and    $0x1,%eax
+  80336b:	48 85 c0             	test   %rax,%rax
+  80336e:	0f 84 f7 00 00 00    	je     80346b <ufork+0x189>
+				if ((uvpd[VPD(addr)] & (PTE_P | PTE_PS)) == (PTE_P | PTE_PS)){
+  803374:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803378:	48 c1 e8 15          	shr    $0x15,%rax
+  80337c:	48 89 c2             	mov    %rax,%rdx
+  80337f:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  803386:	ff ff ff 
+  803389:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80338d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803391:	25 81 00 00 00       	and    $0x81,%eax
+  803396:	48 3d 81 00 00 00    	cmp    $0x81,%rax
+  80339c:	75 29                	jne    8033c7 <ufork+0xe5>
+					duphuge(child_envid, addr);
+  80339e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8033a2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8033a5:	48 89 d6             	mov    %rdx,%rsi
+  8033a8:	89 c7                	mov    %eax,%edi
+  8033aa:	48 b8 46 a1 ff ff ff 	movabs $0xffffffffffffa146,%rax
+  8033b1:	ff ff ff 
+  8033b4:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8033b8:	ff d0                	call   *%rax
+					addr += PTSIZE;
+  8033ba:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  8033c1:	00 
+  8033c2:	e9 ac 00 00 00       	jmp    803473 <ufork+0x191>
+				}
+				else if (uvpd[VPD(addr)] & PTE_P){
+  8033c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033cb:	48 c1 e8 15          	shr    $0x15,%rax
+  8033cf:	48 89 c2             	mov    %rax,%rdx
+  8033d2:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  8033d9:	ff ff ff 
+  8033dc:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8033e0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033e4:	83 e0 01             	and    $0x1,%eax
+  8033e7:	48 85 c0             	test   %rax,%rax
+  8033ea:	74 75                	je     803461 <ufork+0x17f>
+					if (uvpt[VPN(addr)] & PTE_P && uvpt[VPN(addr)] & PTE_U){
+  8033ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033f0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033f4:	48 89 c2             	mov    %rax,%rdx
+  8033f7:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8033fe:	ff ff ff 
+  803401:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803405:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803409:	83 e0 01             	and    $0x1,%eax
+  80340c:	48 85 c0             	test   %rax,%rax
+  80340f:	74 46                	je     803457 <ufork+0x175>
+  803411:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803415:	48 c1 e8 0c          	shr    $0xc,%rax
+  803419:	48 89 c2             	mov    %rax,%rdx
+  80341c:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  803423:	ff ff ff 
+  803426:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80342a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80342e:	83 e0 04             	and    $0x4,%eax
+  803431:	48 85 c0             	test   %rax,%rax
+  803434:	74 21                	je     803457 <ufork+0x175>
+						duppage(child_envid, VPN(addr));
+  803436:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80343a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80343e:	89 c2                	mov    %eax,%edx
+  803440:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803443:	89 d6                	mov    %edx,%esi
+  803445:	89 c7                	mov    %eax,%edi
+  803447:	48 b8 03 a0 ff ff ff 	movabs $0xffffffffffffa003,%rax
+  80344e:	ff ff ff 
+  803451:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803455:	ff d0                	call   *%rax
+					}
+					addr += PGSIZE;	
+  803457:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+  80345e:	00 
+  80345f:	eb 12                	jmp    803473 <ufork+0x191>
+				}
+				//we will discover a PDE not present is at 
+				//a multiple of PTSIZE;
+				else {
+					addr += PTSIZE;
+  803461:	48 81 45 e8 00 00 20 	addq   $0x200000,-0x18(%rbp)
+  803468:	00 
+  803469:	eb 08                	jmp    803473 <ufork+0x191>
+				}
+			}
+			//we will discover a PDPE not present is at
+			//a multiple of PTSIZE * NPDENTRIES;	
+			else {
+				addr += PTSIZE * NPDENTRIES;
+  80346b:	48 81 45 e8 00 00 00 	addq   $0x40000000,-0x18(%rbp)
+  803472:	40 
+		for (; addr < USTACKTOP;){
+  803473:	b8 ff df 7f ef       	mov    $0xef7fdfff,%eax
+  803478:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+  80347c:	0f 83 c9 fe ff ff    	jae    80334b <ufork+0x69>
+			}
+		}
+		fork_flush();
+  803482:	48 b8 6a 9e ff ff ff 	movabs $0xffffffffffff9e6a,%rax
+  803489:	ff ff ff 
+  80348c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803490:	ff d0                	call   *%rax
+
+		//map a user exception stack for the child
+		sys_page_alloc(child_envid,(void*)(UXSTACKTOP-PGSIZE),PTE_U | PTE_W| PTE_P);
+  803492:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803495:	ba 07 00 00 00       	mov    $0x7,%edx
+  80349a:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  80349f:	48 89 ce             	mov    %rcx,%rsi
+  8034a2:	89 c7                	mov    %eax,%edi
+  8034a4:	49 89 df             	mov    %rbx,%r15
+  8034a7:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  8034ae:	ff ff ff 
+  8034b1:	48 01 d8             	add    %rbx,%rax
+  8034b4:	ff d0                	call   *%rax
+
+		//set the pgfault upcall
+		extern void* _pgfault_upcall();
+		sys_env_set_pgfault_upcall(child_envid,_pgfault_upcall);
+  8034b6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8034b9:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  8034c0:	ff ff ff 
+  8034c3:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  8034c7:	48 89 d6             	mov    %rdx,%rsi
+  8034ca:	89 c7                	mov    %eax,%edi
+  8034cc:	49 89 df             	mov    %rbx,%r15
+  8034cf:	48 b8 81 94 ff ff ff 	movabs $0xffffffffffff9481,%rax
+  8034d6:	ff ff ff 
+  8034d9:	48 01 d8             	add    %rbx,%rax
+  8034dc:	ff d0                	call   *%rax
+
+		if(sys_env_set_status(child_envid,ENV_RUNNABLE)){
+  8034de:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8034e1:	be 02 00 00 00       	mov    $0x2,%esi
+  8034e6:	89 c7                	mov    %eax,%edi
+  8034e8:	49 89 df             	mov    %rbx,%r15
+  8034eb:	48 b8 c2 93 ff ff ff 	movabs $0xffffffffffff93c2,%rax
+  8034f2:	ff ff ff 
+  8034f5:	48 01 d8             	add    %rbx,%rax
+  8034f8:	ff d0                	call   *%rax
+  8034fa:	85 c0                	test   %eax,%eax
+  8034fc:	74 3e                	je     80353c <ufork+0x25a>
+			panic("sys_env_set_status failed\n");
+  8034fe:	48 b8 a7 e4 ff ff ff 	movabs $0xffffffffffffe4a7,%rax
+  803505:	ff ff ff 
+  803508:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80350c:	48 89 c2             	mov    %rax,%rdx
+  80350f:	be 07 01 00 00       	mov    $0x107,%esi
+  803514:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  80351b:	ff ff ff 
+  80351e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803522:	48 89 c7             	mov    %rax,%rdi
+  803525:	49 89 df             	mov    %rbx,%r15
+  803528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352d:	48 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%rcx
+  803534:	ff ff ff 
+  803537:	48 01 d9             	add    %rbx,%rcx
+  80353a:	ff d1                	call   *%rcx
+		}		
+
+		// return the childs envid to the parent	
+		return child_envid;
+  80353c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80353f:	eb 59                	jmp    80359a <ufork+0x2b8>
+	}
+	else {
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803541:	49 89 df             	mov    %rbx,%r15
+  803544:	48 b8 e2 91 ff ff ff 	movabs $0xffffffffffff91e2,%rax
+  80354b:	ff ff ff 
+  80354e:	48 01 d8             	add    %rbx,%rax
+  803551:	ff d0                	call   *%rax
+  803553:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803558:	48 98                	cltq
+  80355a:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803561:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803568:	ff ff ff 
+  80356b:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  80356f:	48 01 c2             	add    %rax,%rdx
+  803572:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803579:	ff ff ff 
+  80357c:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803580:	48 89 10             	mov    %rdx,(%rax)
+		// Our copy of fork_ops was taken mid-fork.
+		fork_nops = 0;
+  803583:	48 b8 c0 1f 00 00 00 	movabs $0x1fc0,%rax
+  80358a:	00 00 00 
+  80358d:	48 c7 04 03 00 00 00 	movq   $0x0,(%rbx,%rax,1)
+  803594:	00 
+		return 0;
+  803595:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	
+}
+  80359a:	48 83 c4 10          	add    $0x10,%rsp
+  80359e:	5b                   	pop    %rbx
+  80359f:	41 5f                	pop    %r15
+  8035a1:	5d                   	pop    %rbp
+  8035a2:	c3                   	ret
+
+00000000008035a3 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8035a3:	55                   	push   %rbp
+  8035a4:	48 89 e5             	mov    %rsp,%rbp
+  8035a7:	41 57                	push   %r15
+  8035a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8035ad:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8035ad <sfork+0xa>
+  8035b4:	49 bb 93 5a 00 00 00 	movabs $0x5a93,%r11
+  8035bb:	00 00 00 
+  8035be:	4c 01 d9             	add    %r11,%rcx
+	panic("sfork not implemented");
+  8035c1:	48 b8 c2 e4 ff ff ff 	movabs $0xffffffffffffe4c2,%rax
+  8035c8:	ff ff ff 
+  8035cb:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8035cf:	48 89 c2             	mov    %rax,%rdx
+  8035d2:	be 1a 01 00 00       	mov    $0x11a,%esi
+  8035d7:	48 b8 f8 e3 ff ff ff 	movabs $0xffffffffffffe3f8,%rax
+  8035de:	ff ff ff 
+  8035e1:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  8035e5:	48 89 c7             	mov    %rax,%rdi
+  8035e8:	49 89 cf             	mov    %rcx,%r15
+  8035eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f0:	49 b8 36 75 ff ff ff 	movabs $0xffffffffffff7536,%r8
+  8035f7:	ff ff ff 
+  8035fa:	49 01 c8             	add    %rcx,%r8
+  8035fd:	41 ff d0             	call   *%r8
+
+0000000000803600 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803600:	55                   	push   %rbp
+  803601:	48 89 e5             	mov    %rsp,%rbp
+  803604:	41 57                	push   %r15
+  803606:	53                   	push   %rbx
+  803607:	48 83 ec 30          	sub    $0x30,%rsp
+  80360b:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80360b <ipc_recv+0xb>
+  803612:	49 bb 35 5a 00 00 00 	movabs $0x5a35,%r11
+  803619:	00 00 00 
+  80361c:	4c 01 db             	add    %r11,%rbx
+  80361f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803623:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803627:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	// LAB 4: Your code here.
+	if (!pg)
+  80362b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803630:	75 0e                	jne    803640 <ipc_recv+0x40>
+		pg = (void*)(UTOP + 1);
+  803632:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803639:	00 00 00 
+  80363c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	
+	int res = sys_ipc_recv(pg);
+  803640:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803644:	48 89 c7             	mov    %rax,%rdi
+  803647:	49 89 df             	mov    %rbx,%r15
+  80364a:	48 b8 b4 95 ff ff ff 	movabs $0xffffffffffff95b4,%rax
+  803651:	ff ff ff 
+  803654:	48 01 d8             	add    %rbx,%rax
+  803657:	ff d0                	call   *%rax
+  803659:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	
+	if (from_env_store){
+  80365c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803661:	74 2a                	je     80368d <ipc_recv+0x8d>
+		*from_env_store	= !res ? thisenv->env_ipc_from : 0;
+  803663:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803667:	75 19                	jne    803682 <ipc_recv+0x82>
+  803669:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803670:	ff ff ff 
+  803673:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803677:	48 8b 00             	mov    (%rax),%rax
+  80367a:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803680:	eb 05                	jmp    803687 <ipc_recv+0x87>
+  803682:	b8 00 00 00 00       	mov    $0x0,%eax
+  803687:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80368b:	89 02                	mov    %eax,(%rdx)
+	}	
+	if (perm_store){
+  80368d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803692:	74 2a                	je     8036be <ipc_recv+0xbe>
+		*perm_store = !res ? thisenv->env_ipc_perm : 0;
+  803694:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803698:	75 19                	jne    8036b3 <ipc_recv+0xb3>
+  80369a:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8036a1:	ff ff ff 
+  8036a4:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036a8:	48 8b 00             	mov    (%rax),%rax
+  8036ab:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8036b1:	eb 05                	jmp    8036b8 <ipc_recv+0xb8>
+  8036b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8036bc:	89 02                	mov    %eax,(%rdx)
+	}
+	if (res){
+  8036be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8036c2:	74 05                	je     8036c9 <ipc_recv+0xc9>
+		return res;
+  8036c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036c7:	eb 17                	jmp    8036e0 <ipc_recv+0xe0>
+	}
+	return thisenv->env_ipc_value;
+  8036c9:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8036d0:	ff ff ff 
+  8036d3:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8036d7:	48 8b 00             	mov    (%rax),%rax
+  8036da:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  8036e0:	48 83 c4 30          	add    $0x30,%rsp
+  8036e4:	5b                   	pop    %rbx
+  8036e5:	41 5f                	pop    %r15
+  8036e7:	5d                   	pop    %rbp
+  8036e8:	c3                   	ret
+
+00000000008036e9 <ipc_send>:
+// Hint:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8036e9:	55                   	push   %rbp
+  8036ea:	48 89 e5             	mov    %rsp,%rbp
+  8036ed:	41 57                	push   %r15
+  8036ef:	53                   	push   %rbx
+  8036f0:	48 83 ec 20          	sub    $0x20,%rsp
+  8036f4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8036f4 <ipc_send+0xb>
+  8036fb:	49 bb 4c 59 00 00 00 	movabs $0x594c,%r11
+  803702:	00 00 00 
+  803705:	4c 01 db             	add    %r11,%rbx
+  803708:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80370b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  80370e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803712:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+	if (!pg)
+  803715:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80371a:	75 0e                	jne    80372a <ipc_send+0x41>
+		pg = (void*)(UTOP + 1);
+  80371c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803723:	00 00 00 
+  803726:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	while (sys_ipc_send(to_env,val,pg,perm) == -E_IPC_NOT_RECV)
+  80372a:	90                   	nop
+  80372b:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  80372e:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803731:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803735:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803738:	89 c7                	mov    %eax,%edi
+  80373a:	49 89 df             	mov    %rbx,%r15
+  80373d:	48 b8 4a 95 ff ff ff 	movabs $0xffffffffffff954a,%rax
+  803744:	ff ff ff 
+  803747:	48 01 d8             	add    %rbx,%rax
+  80374a:	ff d0                	call   *%rax
+  80374c:	83 f8 f8             	cmp    $0xfffffff8,%eax
+  80374f:	74 da                	je     80372b <ipc_send+0x42>
+		;
+}
+  803751:	90                   	nop
+  803752:	90                   	nop
+  803753:	48 83 c4 20          	add    $0x20,%rsp
+  803757:	5b                   	pop    %rbx
+  803758:	41 5f                	pop    %r15
+  80375a:	5d                   	pop    %rbp
+  80375b:	c3                   	ret
+
+000000000080375c <ipc_call>:
+// The reply's page, if any, is mapped at 'rcv_pg' (if nonnull), and
+// its permissions stored in *perm_store (if nonnull).
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, int perm,
+	 void *rcv_pg, int *perm_store)
+{
+  80375c:	55                   	push   %rbp
+  80375d:	48 89 e5             	mov    %rsp,%rbp
+  803760:	41 57                	push   %r15
+  803762:	53                   	push   %rbx
+  803763:	48 83 ec 40          	sub    $0x40,%rsp
+  803767:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803767 <ipc_call+0xb>
+  80376e:	49 bb d9 58 00 00 00 	movabs $0x58d9,%r11
+  803775:	00 00 00 
+  803778:	4c 01 db             	add    %r11,%rbx
+  80377b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80377e:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803781:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803785:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803788:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  80378c:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803790:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803795:	75 0e                	jne    8037a5 <ipc_call+0x49>
+		pg = (void*)(UTOP + 1);
+  803797:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  80379e:	00 00 00 
+  8037a1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  8037a5:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8037aa:	75 0e                	jne    8037ba <ipc_call+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  8037ac:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  8037b3:	00 00 00 
+  8037b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm, rcv_pg, NULL);
+  8037ba:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  8037bd:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8037c1:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8037c4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8037c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8037cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8037d1:	49 89 f8             	mov    %rdi,%r8
+  8037d4:	89 c7                	mov    %eax,%edi
+  8037d6:	49 89 df             	mov    %rbx,%r15
+  8037d9:	48 b8 0d 96 ff ff ff 	movabs $0xffffffffffff960d,%rax
+  8037e0:	ff ff ff 
+  8037e3:	48 01 d8             	add    %rbx,%rax
+  8037e6:	ff d0                	call   *%rax
+  8037e8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (perm_store)
+  8037eb:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8037f0:	74 2a                	je     80381c <ipc_call+0xc0>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8037f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8037f6:	75 19                	jne    803811 <ipc_call+0xb5>
+  8037f8:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8037ff:	ff ff ff 
+  803802:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803806:	48 8b 00             	mov    (%rax),%rax
+  803809:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80380f:	eb 05                	jmp    803816 <ipc_call+0xba>
+  803811:	b8 00 00 00 00       	mov    $0x0,%eax
+  803816:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80381a:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  80381c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803820:	74 05                	je     803827 <ipc_call+0xcb>
+		return r;
+  803822:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803825:	eb 17                	jmp    80383e <ipc_call+0xe2>
+	return thisenv->env_ipc_value;
+  803827:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80382e:	ff ff ff 
+  803831:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803835:	48 8b 00             	mov    (%rax),%rax
+  803838:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80383e:	48 83 c4 40          	add    $0x40,%rsp
+  803842:	5b                   	pop    %rbx
+  803843:	41 5f                	pop    %r15
+  803845:	5d                   	pop    %rbp
+  803846:	c3                   	ret
+
+0000000000803847 <ipc_callw>:
+// Like ipc_call, but send the 'len' bytes at 'msg' (at most
+// IPC_NWORDS words) in registers instead of a page, and expect no page
+// back.  The receiver finds them in the words of ipc_reply_recv.
+int32_t
+ipc_callw(envid_t to_env, uint32_t val, const void *msg, size_t len)
+{
+  803847:	55                   	push   %rbp
+  803848:	48 89 e5             	mov    %rsp,%rbp
+  80384b:	41 57                	push   %r15
+  80384d:	53                   	push   %rbx
+  80384e:	48 83 ec 70          	sub    $0x70,%rsp
+  803852:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803852 <ipc_callw+0xb>
+  803859:	49 bb ee 57 00 00 00 	movabs $0x57ee,%r11
+  803860:	00 00 00 
+  803863:	4c 01 db             	add    %r11,%rbx
+  803866:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+  803869:	89 75 98             	mov    %esi,-0x68(%rbp)
+  80386c:	48 89 55 90          	mov    %rdx,-0x70(%rbp)
+  803870:	48 89 4d 88          	mov    %rcx,-0x78(%rbp)
+	uint64_t words[IPC_NWORDS];
+	int r;
+
+	if (len > sizeof(words))
+  803874:	48 83 7d 88 30       	cmpq   $0x30,-0x78(%rbp)
+  803879:	76 0a                	jbe    803885 <ipc_callw+0x3e>
+		return -E_INVAL;
+  80387b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803880:	e9 b7 00 00 00       	jmp    80393c <ipc_callw+0xf5>
+	memmove(words, msg, len);
+  803885:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  803889:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  80388d:	48 8d 45 a0          	lea    -0x60(%rbp),%rax
+  803891:	48 89 ce             	mov    %rcx,%rsi
+  803894:	48 89 c7             	mov    %rax,%rdi
+  803897:	49 89 df             	mov    %rbx,%r15
+  80389a:	48 b8 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rax
+  8038a1:	ff ff ff 
+  8038a4:	48 01 d8             	add    %rbx,%rax
+  8038a7:	ff d0                	call   *%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+			 IPC_PERM_WORDS(ROUNDUP(len, sizeof(uint64_t))
+  8038a9:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  8038b0:	00 
+  8038b1:	48 8b 55 88          	mov    -0x78(%rbp),%rdx
+  8038b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038b9:	48 01 d0             	add    %rdx,%rax
+  8038bc:	48 83 e8 01          	sub    $0x1,%rax
+  8038c0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8038c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038cd:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8038d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038d5:	48 29 d0             	sub    %rdx,%rax
+  8038d8:	48 c1 e8 03          	shr    $0x3,%rax
+  8038dc:	48 c1 e0 10          	shl    $0x10,%rax
+	r = sys_ipc_call(to_env, val, (void*)(UTOP + 1),
+  8038e0:	89 c1                	mov    %eax,%ecx
+  8038e2:	8b 75 98             	mov    -0x68(%rbp),%esi
+  8038e5:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+  8038e9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8038ec:	49 89 d1             	mov    %rdx,%r9
+  8038ef:	49 b8 01 00 80 00 80 	movabs $0x8000800001,%r8
+  8038f6:	00 00 00 
+  8038f9:	48 ba 01 00 80 00 80 	movabs $0x8000800001,%rdx
+  803900:	00 00 00 
+  803903:	89 c7                	mov    %eax,%edi
+  803905:	49 89 df             	mov    %rbx,%r15
+  803908:	48 b8 0d 96 ff ff ff 	movabs $0xffffffffffff960d,%rax
+  80390f:	ff ff ff 
+  803912:	48 01 d8             	add    %rbx,%rax
+  803915:	ff d0                	call   *%rax
+  803917:	89 45 dc             	mov    %eax,-0x24(%rbp)
+					/ sizeof(uint64_t)),
+			 (void*)(UTOP + 1), words);
+	if (r)
+  80391a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80391e:	74 05                	je     803925 <ipc_callw+0xde>
+		return r;
+  803920:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803923:	eb 17                	jmp    80393c <ipc_callw+0xf5>
+	return thisenv->env_ipc_value;
+  803925:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80392c:	ff ff ff 
+  80392f:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803933:	48 8b 00             	mov    (%rax),%rax
+  803936:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  80393c:	48 83 c4 70          	add    $0x70,%rsp
+  803940:	5b                   	pop    %rbx
+  803941:	41 5f                	pop    %r15
+  803943:	5d                   	pop    %rbp
+  803944:	c3                   	ret
+
+0000000000803945 <ipc_callv>:
+// thisenv->env_ipc_npages.
+int32_t
+ipc_callv(envid_t to_env, uint32_t val, uint64_t *words, int nwords,
+	  const struct IpcSeg *segs, int nsegs, int perm,
+	  void *rcv_window, int rcv_npages)
+{
+  803945:	55                   	push   %rbp
+  803946:	48 89 e5             	mov    %rsp,%rbp
+  803949:	41 57                	push   %r15
+  80394b:	53                   	push   %rbx
+  80394c:	48 83 ec 40          	sub    $0x40,%rsp
+  803950:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803950 <ipc_callv+0xb>
+  803957:	49 bb f0 56 00 00 00 	movabs $0x56f0,%r11
+  80395e:	00 00 00 
+  803961:	4c 01 db             	add    %r11,%rbx
+  803964:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803967:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  80396a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80396e:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803971:	4c 89 45 b0          	mov    %r8,-0x50(%rbp)
+  803975:	44 89 4d b8          	mov    %r9d,-0x48(%rbp)
+	void *pg = (void*)(UTOP + 1);
+  803979:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803980:	00 00 00 
+  803983:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	void *rcv_pg = (void*)(UTOP + 1);
+  803987:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	int r;
+
+	if (nsegs) {
+  80398b:	83 7d b8 00          	cmpl   $0x0,-0x48(%rbp)
+  80398f:	74 11                	je     8039a2 <ipc_callv+0x5d>
+		pg = (void *) segs;
+  803991:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803995:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+		perm |= IPC_PERM_SEGS(nsegs);
+  803999:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80399c:	c1 e0 14             	shl    $0x14,%eax
+  80399f:	09 45 10             	or     %eax,0x10(%rbp)
+	}
+	if (rcv_npages)
+  8039a2:	83 7d 20 00          	cmpl   $0x0,0x20(%rbp)
+  8039a6:	74 14                	je     8039bc <ipc_callv+0x77>
+		rcv_pg = IPC_WINDOW(rcv_window, rcv_npages);
+  8039a8:	8b 45 20             	mov    0x20(%rbp),%eax
+  8039ab:	83 e8 01             	sub    $0x1,%eax
+  8039ae:	48 63 d0             	movslq %eax,%rdx
+  8039b1:	48 8b 45 18          	mov    0x18(%rbp),%rax
+  8039b5:	48 09 d0             	or     %rdx,%rax
+  8039b8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	r = sys_ipc_call(to_env, val, pg, perm | IPC_PERM_WORDS(nwords),
+  8039bc:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  8039bf:	c1 e0 10             	shl    $0x10,%eax
+  8039c2:	0b 45 10             	or     0x10(%rbp),%eax
+  8039c5:	89 c1                	mov    %eax,%ecx
+  8039c7:	8b 75 c8             	mov    -0x38(%rbp),%esi
+  8039ca:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8039ce:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8039d2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8039d6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8039d9:	4d 89 c1             	mov    %r8,%r9
+  8039dc:	49 89 f8             	mov    %rdi,%r8
+  8039df:	89 c7                	mov    %eax,%edi
+  8039e1:	49 89 df             	mov    %rbx,%r15
+  8039e4:	48 b8 0d 96 ff ff ff 	movabs $0xffffffffffff960d,%rax
+  8039eb:	ff ff ff 
+  8039ee:	48 01 d8             	add    %rbx,%rax
+  8039f1:	ff d0                	call   *%rax
+  8039f3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+			 rcv_pg, words);
+	if (r)
+  8039f6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8039fa:	74 05                	je     803a01 <ipc_callv+0xbc>
+		return r;
+  8039fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039ff:	eb 17                	jmp    803a18 <ipc_callv+0xd3>
+	return thisenv->env_ipc_value;
+  803a01:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803a08:	ff ff ff 
+  803a0b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803a0f:	48 8b 00             	mov    (%rax),%rax
+  803a12:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803a18:	48 83 c4 40          	add    $0x40,%rsp
+  803a1c:	5b                   	pop    %rbx
+  803a1d:	41 5f                	pop    %r15
+  803a1f:	5d                   	pop    %rbp
+  803a20:	c3                   	ret
+
+0000000000803a21 <ipc_reply_recv>:
+// IPC_PERM_WORDS(n), its first n words are sent with the reply first.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, int perm,
+	       envid_t *from_env_store, void *rcv_pg, int *perm_store,
+	       uint64_t *words_store)
+{
+  803a21:	55                   	push   %rbp
+  803a22:	48 89 e5             	mov    %rsp,%rbp
+  803a25:	41 57                	push   %r15
+  803a27:	53                   	push   %rbx
+  803a28:	48 83 ec 40          	sub    $0x40,%rsp
+  803a2c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803a2c <ipc_reply_recv+0xb>
+  803a33:	49 bb 14 56 00 00 00 	movabs $0x5614,%r11
+  803a3a:	00 00 00 
+  803a3d:	4c 01 db             	add    %r11,%rbx
+  803a40:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803a43:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  803a46:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  803a4a:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+  803a4d:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  803a51:	4c 89 4d b8          	mov    %r9,-0x48(%rbp)
+	int r;
+
+	if (!pg)
+  803a55:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  803a5a:	75 0e                	jne    803a6a <ipc_reply_recv+0x49>
+		pg = (void*)(UTOP + 1);
+  803a5c:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803a63:	00 00 00 
+  803a66:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	if (!rcv_pg)
+  803a6a:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803a6f:	75 0e                	jne    803a7f <ipc_reply_recv+0x5e>
+		rcv_pg = (void*)(UTOP + 1);
+  803a71:	48 b8 01 00 80 00 80 	movabs $0x8000800001,%rax
+  803a78:	00 00 00 
+  803a7b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+	r = sys_ipc_reply_recv(to_env, val, pg, perm, rcv_pg, words_store);
+  803a7f:	8b 75 d8             	mov    -0x28(%rbp),%esi
+  803a82:	4c 8b 45 18          	mov    0x18(%rbp),%r8
+  803a86:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803a8a:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  803a8d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a91:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a94:	4d 89 c1             	mov    %r8,%r9
+  803a97:	49 89 f8             	mov    %rdi,%r8
+  803a9a:	89 c7                	mov    %eax,%edi
+  803a9c:	49 89 df             	mov    %rbx,%r15
+  803a9f:	48 b8 81 96 ff ff ff 	movabs $0xffffffffffff9681,%rax
+  803aa6:	ff ff ff 
+  803aa9:	48 01 d8             	add    %rbx,%rax
+  803aac:	ff d0                	call   *%rax
+  803aae:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (from_env_store)
+  803ab1:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803ab6:	74 2a                	je     803ae2 <ipc_reply_recv+0xc1>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803ab8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803abc:	75 19                	jne    803ad7 <ipc_reply_recv+0xb6>
+  803abe:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803ac5:	ff ff ff 
+  803ac8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803acc:	48 8b 00             	mov    (%rax),%rax
+  803acf:	8b 80 44 01 00 00    	mov    0x144(%rax),%eax
+  803ad5:	eb 05                	jmp    803adc <ipc_reply_recv+0xbb>
+  803ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803adc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ae0:	89 02                	mov    %eax,(%rdx)
+	if (perm_store)
+  803ae2:	48 83 7d 10 00       	cmpq   $0x0,0x10(%rbp)
+  803ae7:	74 2a                	je     803b13 <ipc_reply_recv+0xf2>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803ae9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803aed:	75 19                	jne    803b08 <ipc_reply_recv+0xe7>
+  803aef:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803af6:	ff ff ff 
+  803af9:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803afd:	48 8b 00             	mov    (%rax),%rax
+  803b00:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  803b06:	eb 05                	jmp    803b0d <ipc_reply_recv+0xec>
+  803b08:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0d:	48 8b 55 10          	mov    0x10(%rbp),%rdx
+  803b11:	89 02                	mov    %eax,(%rdx)
+	if (r)
+  803b13:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803b17:	74 05                	je     803b1e <ipc_reply_recv+0xfd>
+		return r;
+  803b19:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b1c:	eb 17                	jmp    803b35 <ipc_reply_recv+0x114>
+	return thisenv->env_ipc_value;
+  803b1e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  803b25:	ff ff ff 
+  803b28:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  803b2c:	48 8b 00             	mov    (%rax),%rax
+  803b2f:	8b 80 40 01 00 00    	mov    0x140(%rax),%eax
+}
+  803b35:	48 83 c4 40          	add    $0x40,%rsp
+  803b39:	5b                   	pop    %rbx
+  803b3a:	41 5f                	pop    %r15
+  803b3c:	5d                   	pop    %rbp
+  803b3d:	c3                   	ret
+
+0000000000803b3e <ipc_window_batch>:
+// Apply sys_page_alloc(0, va, 'perm') (if 'alloc') or sys_page_unmap(0,
+// va) to each of the 'npages' pages at 'va', a chunk of pages per
+// system call.
+static int
+ipc_window_batch(int alloc, void *va, int npages, int perm)
+{
+  803b3e:	55                   	push   %rbp
+  803b3f:	48 89 e5             	mov    %rsp,%rbp
+  803b42:	41 57                	push   %r15
+  803b44:	53                   	push   %rbx
+  803b45:	48 81 ec 40 04 00 00 	sub    $0x440,%rsp
+  803b4c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803b4c <ipc_window_batch+0xe>
+  803b53:	49 bb f4 54 00 00 00 	movabs $0x54f4,%r11
+  803b5a:	00 00 00 
+  803b5d:	4c 01 db             	add    %r11,%rbx
+  803b60:	89 bd cc fb ff ff    	mov    %edi,-0x434(%rbp)
+  803b66:	48 89 b5 c0 fb ff ff 	mov    %rsi,-0x440(%rbp)
+  803b6d:	89 95 c8 fb ff ff    	mov    %edx,-0x438(%rbp)
+  803b73:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%rbp)
+	struct PageOp ops[PAGE_BATCH_CHUNK];
+	int i, n, r;
+
+	for (; npages > 0; npages -= n) {
+  803b79:	e9 15 01 00 00       	jmp    803c93 <ipc_window_batch+0x155>
+		n = MIN(npages, PAGE_BATCH_CHUNK);
+  803b7e:	8b 85 c8 fb ff ff    	mov    -0x438(%rbp),%eax
+  803b84:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  803b87:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%rbp)
+  803b8e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803b91:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803b94:	39 c2                	cmp    %eax,%edx
+  803b96:	0f 4e c2             	cmovle %edx,%eax
+  803b99:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		for (i = 0; i < n; i++) {
+  803b9c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  803ba3:	eb 6b                	jmp    803c10 <ipc_window_batch+0xd2>
+			ops[i].dstenvid = 0;
+  803ba5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ba8:	48 98                	cltq
+  803baa:	48 c1 e0 05          	shl    $0x5,%rax
+  803bae:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803bb2:	48 01 e8             	add    %rbp,%rax
+  803bb5:	48 2d 1c 04 00 00    	sub    $0x41c,%rax
+  803bbb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+			ops[i].dstva = (uintptr_t) va + i * PGSIZE;
+  803bc1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bc4:	c1 e0 0c             	shl    $0xc,%eax
+  803bc7:	48 63 d0             	movslq %eax,%rdx
+  803bca:	48 8b 85 c0 fb ff ff 	mov    -0x440(%rbp),%rax
+  803bd1:	48 01 c2             	add    %rax,%rdx
+  803bd4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bd7:	48 98                	cltq
+  803bd9:	48 c1 e0 05          	shl    $0x5,%rax
+  803bdd:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803be1:	48 01 e8             	add    %rbp,%rax
+  803be4:	48 2d 10 04 00 00    	sub    $0x410,%rax
+  803bea:	48 89 10             	mov    %rdx,(%rax)
+			ops[i].perm = perm;
+  803bed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bf0:	48 98                	cltq
+  803bf2:	48 c1 e0 05          	shl    $0x5,%rax
+  803bf6:	48 8d 40 f0          	lea    -0x10(%rax),%rax
+  803bfa:	48 01 e8             	add    %rbp,%rax
+  803bfd:	48 8d 90 f8 fb ff ff 	lea    -0x408(%rax),%rdx
+  803c04:	8b 85 bc fb ff ff    	mov    -0x444(%rbp),%eax
+  803c0a:	89 02                	mov    %eax,(%rdx)
+		for (i = 0; i < n; i++) {
+  803c0c:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  803c10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c13:	3b 45 e0             	cmp    -0x20(%rbp),%eax
+  803c16:	7c 8d                	jl     803ba5 <ipc_window_batch+0x67>
+		}
+		r = alloc ? sys_page_alloc_batch(ops, n)
+			  : sys_page_unmap_batch(ops, n);
+  803c18:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  803c1f:	74 27                	je     803c48 <ipc_window_batch+0x10a>
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803c21:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803c24:	48 63 d0             	movslq %eax,%rdx
+  803c27:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803c2e:	48 89 d6             	mov    %rdx,%rsi
+  803c31:	48 89 c7             	mov    %rax,%rdi
+  803c34:	49 89 df             	mov    %rbx,%r15
+  803c37:	48 b8 24 99 ff ff ff 	movabs $0xffffffffffff9924,%rax
+  803c3e:	ff ff ff 
+  803c41:	48 01 d8             	add    %rbx,%rax
+  803c44:	ff d0                	call   *%rax
+  803c46:	eb 25                	jmp    803c6d <ipc_window_batch+0x12f>
+			  : sys_page_unmap_batch(ops, n);
+  803c48:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803c4b:	48 63 d0             	movslq %eax,%rdx
+  803c4e:	48 8d 85 d0 fb ff ff 	lea    -0x430(%rbp),%rax
+  803c55:	48 89 d6             	mov    %rdx,%rsi
+  803c58:	48 89 c7             	mov    %rax,%rdi
+  803c5b:	49 89 df             	mov    %rbx,%r15
+  803c5e:	48 b8 82 99 ff ff ff 	movabs $0xffffffffffff9982,%rax
+  803c65:	ff ff ff 
+  803c68:	48 01 d8             	add    %rbx,%rax
+  803c6b:	ff d0                	call   *%rax
+		r = alloc ? sys_page_alloc_batch(ops, n)
+  803c6d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		if (r < 0)
+  803c70:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803c74:	79 05                	jns    803c7b <ipc_window_batch+0x13d>
+			return r;
+  803c76:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c79:	eb 2a                	jmp    803ca5 <ipc_window_batch+0x167>
+		va = (char *) va + n * PGSIZE;
+  803c7b:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803c7e:	c1 e0 0c             	shl    $0xc,%eax
+  803c81:	48 98                	cltq
+  803c83:	48 01 85 c0 fb ff ff 	add    %rax,-0x440(%rbp)
+	for (; npages > 0; npages -= n) {
+  803c8a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  803c8d:	29 85 c8 fb ff ff    	sub    %eax,-0x438(%rbp)
+  803c93:	83 bd c8 fb ff ff 00 	cmpl   $0x0,-0x438(%rbp)
+  803c9a:	0f 8f de fe ff ff    	jg     803b7e <ipc_window_batch+0x40>
+	}
+	return 0;
+  803ca0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ca5:	48 81 c4 40 04 00 00 	add    $0x440,%rsp
+  803cac:	5b                   	pop    %rbx
+  803cad:	41 5f                	pop    %r15
+  803caf:	5d                   	pop    %rbp
+  803cb0:	c3                   	ret
+
+0000000000803cb1 <ipc_map_window>:
+
+// Map 'npages' fresh pages at 'va', to stage the pages of a vector
+// IPC (see ipc_callv).
+int
+ipc_map_window(void *va, int npages)
+{
+  803cb1:	55                   	push   %rbp
+  803cb2:	48 89 e5             	mov    %rsp,%rbp
+  803cb5:	48 83 ec 10          	sub    $0x10,%rsp
+  803cb9:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cb9 <ipc_map_window+0x8>
+  803cc0:	49 bb 87 53 00 00 00 	movabs $0x5387,%r11
+  803cc7:	00 00 00 
+  803cca:	4c 01 d8             	add    %r11,%rax
+  803ccd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803cd1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(1, va, npages, PTE_P|PTE_U|PTE_W);
+  803cd4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803cd7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803cdb:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803ce0:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ce5:	49 b8 fe aa ff ff ff 	movabs $0xffffffffffffaafe,%r8
+  803cec:	ff ff ff 
+  803cef:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803cf3:	ff d0                	call   *%rax
+}
+  803cf5:	c9                   	leave
+  803cf6:	c3                   	ret
+
+0000000000803cf7 <ipc_unmap_window>:
+
+// Unmap the 'npages' pages at 'va', once the pages sent or received
+// there are done with, so that neither side keeps the other's.
+int
+ipc_unmap_window(void *va, int npages)
+{
+  803cf7:	55                   	push   %rbp
+  803cf8:	48 89 e5             	mov    %rsp,%rbp
+  803cfb:	48 83 ec 10          	sub    $0x10,%rsp
+  803cff:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803cff <ipc_unmap_window+0x8>
+  803d06:	49 bb 41 53 00 00 00 	movabs $0x5341,%r11
+  803d0d:	00 00 00 
+  803d10:	4c 01 d8             	add    %r11,%rax
+  803d13:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d17:	89 75 f4             	mov    %esi,-0xc(%rbp)
+	return ipc_window_batch(0, va, npages, 0);
+  803d1a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  803d1d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803d21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d2b:	49 b8 fe aa ff ff ff 	movabs $0xffffffffffffaafe,%r8
+  803d32:	ff ff ff 
+  803d35:	4a 8d 04 00          	lea    (%rax,%r8,1),%rax
+  803d39:	ff d0                	call   *%rax
+}
+  803d3b:	c9                   	leave
+  803d3c:	c3                   	ret
+
+0000000000803d3d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803d3d:	55                   	push   %rbp
+  803d3e:	48 89 e5             	mov    %rsp,%rbp
+  803d41:	48 83 ec 18          	sub    $0x18,%rsp
+  803d45:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803d45 <ipc_find_env+0x8>
+  803d4c:	49 bb fb 52 00 00 00 	movabs $0x52fb,%r11
+  803d53:	00 00 00 
+  803d56:	4c 01 d8             	add    %r11,%rax
+  803d59:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	int i;
+	for (i = 0; i < NENV; i++) {
+  803d5c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803d63:	eb 57                	jmp    803dbc <ipc_find_env+0x7f>
+		if (envs[i].env_type == type)
+  803d65:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803d6c:	ff ff ff 
+  803d6f:	48 8b 0c 10          	mov    (%rax,%rdx,1),%rcx
+  803d73:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803d76:	48 63 d2             	movslq %edx,%rdx
+  803d79:	48 69 d2 b8 01 00 00 	imul   $0x1b8,%rdx,%rdx
+  803d80:	48 01 ca             	add    %rcx,%rdx
+  803d83:	48 81 c2 d0 00 00 00 	add    $0xd0,%rdx
+  803d8a:	8b 12                	mov    (%rdx),%edx
+  803d8c:	39 55 ec             	cmp    %edx,-0x14(%rbp)
+  803d8f:	75 27                	jne    803db8 <ipc_find_env+0x7b>
+			return envs[i].env_id;
+  803d91:	48 ba e0 ff ff ff ff 	movabs $0xffffffffffffffe0,%rdx
+  803d98:	ff ff ff 
+  803d9b:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803d9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803da2:	48 98                	cltq
+  803da4:	48 69 c0 b8 01 00 00 	imul   $0x1b8,%rax,%rax
+  803dab:	48 01 d0             	add    %rdx,%rax
+  803dae:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803db4:	8b 00                	mov    (%rax),%eax
+  803db6:	eb 12                	jmp    803dca <ipc_find_env+0x8d>
+	for (i = 0; i < NENV; i++) {
+  803db8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803dbc:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  803dc3:	7e a0                	jle    803d65 <ipc_find_env+0x28>
+	}
+	return 0;
+  803dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dca:	c9                   	leave
+  803dcb:	c3                   	ret
+
+0000000000803dcc <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd)
+{
+  803dcc:	55                   	push   %rbp
+  803dcd:	48 89 e5             	mov    %rsp,%rbp
+  803dd0:	48 83 ec 08          	sub    $0x8,%rsp
+  803dd4:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803dd4 <fd2num+0x8>
+  803ddb:	49 bb 6c 52 00 00 00 	movabs $0x526c,%r11
+  803de2:	00 00 00 
+  803de5:	4c 01 d8             	add    %r11,%rax
+  803de8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  803dec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803df0:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803df7:	ff ff ff 
+  803dfa:	48 01 d0             	add    %rdx,%rax
+  803dfd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803e01:	c9                   	leave
+  803e02:	c3                   	ret
+
+0000000000803e03 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  803e03:	55                   	push   %rbp
+  803e04:	48 89 e5             	mov    %rsp,%rbp
+  803e07:	48 83 ec 08          	sub    $0x8,%rsp
+  803e0b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e0b <fd2data+0x8>
+  803e12:	49 bb 35 52 00 00 00 	movabs $0x5235,%r11
+  803e19:	00 00 00 
+  803e1c:	4c 01 d8             	add    %r11,%rax
+  803e1f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	return INDEX2DATA(fd2num(fd));
+  803e23:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e27:	48 89 d7             	mov    %rdx,%rdi
+  803e2a:	48 ba 8c ad ff ff ff 	movabs $0xffffffffffffad8c,%rdx
+  803e31:	ff ff ff 
+  803e34:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  803e38:	ff d0                	call   *%rax
+  803e3a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803e40:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803e44:	c9                   	leave
+  803e45:	c3                   	ret
+
+0000000000803e46 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  803e46:	55                   	push   %rbp
+  803e47:	48 89 e5             	mov    %rsp,%rbp
+  803e4a:	48 83 ec 18          	sub    $0x18,%rsp
+  803e4e:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803e4e <fd_alloc+0x8>
+  803e55:	49 bb f2 51 00 00 00 	movabs $0x51f2,%r11
+  803e5c:	00 00 00 
+  803e5f:	4c 01 d8             	add    %r11,%rax
+  803e62:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  803e66:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803e6d:	eb 75                	jmp    803ee4 <fd_alloc+0x9e>
+		fd = INDEX2FD(i);
+  803e6f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  803e72:	48 63 d2             	movslq %edx,%rdx
+  803e75:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803e7c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803e80:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+		if ((uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803e84:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803e88:	48 89 d1             	mov    %rdx,%rcx
+  803e8b:	48 c1 e9 15          	shr    $0x15,%rcx
+  803e8f:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803e96:	ff ff ff 
+  803e99:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803e9d:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803ea1:	83 e2 01             	and    $0x1,%edx
+  803ea4:	48 85 d2             	test   %rdx,%rdx
+  803ea7:	74 25                	je     803ece <fd_alloc+0x88>
+  803ea9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ead:	48 89 d1             	mov    %rdx,%rcx
+  803eb0:	48 c1 e9 0c          	shr    $0xc,%rcx
+  803eb4:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  803ebb:	ff ff ff 
+  803ebe:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803ec2:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803ec6:	83 e2 01             	and    $0x1,%edx
+  803ec9:	48 85 d2             	test   %rdx,%rdx
+  803ecc:	75 12                	jne    803ee0 <fd_alloc+0x9a>
+			*fd_store = fd;
+  803ece:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ed2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803ed6:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  803ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ede:	eb 1a                	jmp    803efa <fd_alloc+0xb4>
+	for (i = 0; i < MAXFD; i++) {
+  803ee0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803ee4:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803ee8:	7e 85                	jle    803e6f <fd_alloc+0x29>
+		}
+	}
+	*fd_store = 0;
+  803eea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eee:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_MAX_OPEN;
+  803ef5:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+}
+  803efa:	c9                   	leave
+  803efb:	c3                   	ret
+
+0000000000803efc <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  803efc:	55                   	push   %rbp
+  803efd:	48 89 e5             	mov    %rsp,%rbp
+  803f00:	48 83 ec 20          	sub    $0x20,%rsp
+  803f04:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 803f04 <fd_lookup+0x8>
+  803f0b:	49 bb 3c 51 00 00 00 	movabs $0x513c,%r11
+  803f12:	00 00 00 
+  803f15:	4c 01 d8             	add    %r11,%rax
+  803f18:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f1b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  803f1f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803f23:	78 06                	js     803f2b <fd_lookup+0x2f>
+  803f25:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803f29:	7e 07                	jle    803f32 <fd_lookup+0x36>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803f2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f30:	eb 73                	jmp    803fa5 <fd_lookup+0xa9>
+	}
+	fd = INDEX2FD(fdnum);
+  803f32:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803f35:	48 63 d2             	movslq %edx,%rdx
+  803f38:	48 81 c2 00 00 0d 00 	add    $0xd0000,%rdx
+  803f3f:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803f43:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803f47:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f4b:	48 89 d1             	mov    %rdx,%rcx
+  803f4e:	48 c1 e9 15          	shr    $0x15,%rcx
+  803f52:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  803f59:	ff ff ff 
+  803f5c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  803f60:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  803f64:	83 e2 01             	and    $0x1,%edx
+  803f67:	48 85 d2             	test   %rdx,%rdx
+  803f6a:	74 22                	je     803f8e <fd_lookup+0x92>
+  803f6c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f70:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803f74:	48 b9 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rcx
+  803f7b:	ff ff ff 
+  803f7e:	48 8b 04 08          	mov    (%rax,%rcx,1),%rax
+  803f82:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803f86:	83 e0 01             	and    $0x1,%eax
+  803f89:	48 85 c0             	test   %rax,%rax
+  803f8c:	75 07                	jne    803f95 <fd_lookup+0x99>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+  803f8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f93:	eb 10                	jmp    803fa5 <fd_lookup+0xa9>
+	}
+	*fd_store = fd;
+  803f95:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f99:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f9d:	48 89 10             	mov    %rdx,(%rax)
+	return 0;
+  803fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fa5:	c9                   	leave
+  803fa6:	c3                   	ret
+
+0000000000803fa7 <fd_close>:
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist)
+{
+  803fa7:	55                   	push   %rbp
+  803fa8:	48 89 e5             	mov    %rsp,%rbp
+  803fab:	41 57                	push   %r15
+  803fad:	53                   	push   %rbx
+  803fae:	48 83 ec 30          	sub    $0x30,%rsp
+  803fb2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 803fb2 <fd_close+0xb>
+  803fb9:	49 bb 8e 50 00 00 00 	movabs $0x508e,%r11
+  803fc0:	00 00 00 
+  803fc3:	4c 01 db             	add    %r11,%rbx
+  803fc6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803fca:	89 f0                	mov    %esi,%eax
+  803fcc:	88 45 c4             	mov    %al,-0x3c(%rbp)
+	struct Fd *fd2;
+	struct Dev *dev;
+	int r;
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  803fcf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fd3:	48 89 c7             	mov    %rax,%rdi
+  803fd6:	48 b8 8c ad ff ff ff 	movabs $0xffffffffffffad8c,%rax
+  803fdd:	ff ff ff 
+  803fe0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fe4:	ff d0                	call   *%rax
+  803fe6:	89 c2                	mov    %eax,%edx
+  803fe8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  803fec:	48 89 c6             	mov    %rax,%rsi
+  803fef:	89 d7                	mov    %edx,%edi
+  803ff1:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  803ff8:	ff ff ff 
+  803ffb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  803fff:	ff d0                	call   *%rax
+  804001:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804004:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804008:	78 0a                	js     804014 <fd_close+0x6d>
+	    || fd != fd2)
+  80400a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80400e:	48 39 45 c8          	cmp    %rax,-0x38(%rbp)
+  804012:	74 12                	je     804026 <fd_close+0x7f>
+		return (must_exist ? r : 0);
+  804014:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  804018:	74 05                	je     80401f <fd_close+0x78>
+  80401a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80401d:	eb 7a                	jmp    804099 <fd_close+0xf2>
+  80401f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804024:	eb 73                	jmp    804099 <fd_close+0xf2>
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  804026:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80402a:	8b 00                	mov    (%rax),%eax
+  80402c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804030:	48 89 d6             	mov    %rdx,%rsi
+  804033:	89 c7                	mov    %eax,%edi
+  804035:	48 b8 62 b0 ff ff ff 	movabs $0xffffffffffffb062,%rax
+  80403c:	ff ff ff 
+  80403f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804043:	ff d0                	call   *%rax
+  804045:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804048:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80404c:	78 2a                	js     804078 <fd_close+0xd1>
+		if (dev->dev_close)
+  80404e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804052:	48 8b 40 20          	mov    0x20(%rax),%rax
+  804056:	48 85 c0             	test   %rax,%rax
+  804059:	74 16                	je     804071 <fd_close+0xca>
+			r = (*dev->dev_close)(fd);
+  80405b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80405f:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  804063:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804067:	48 89 c7             	mov    %rax,%rdi
+  80406a:	ff d2                	call   *%rdx
+  80406c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80406f:	eb 07                	jmp    804078 <fd_close+0xd1>
+		else
+			r = 0;
+  804071:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+	}
+	// Make sure fd is unmapped.  Might be a no-op if
+	// (*dev->dev_close)(fd) already unmapped it.
+	(void) sys_page_unmap(0, fd);
+  804078:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80407c:	48 89 c6             	mov    %rax,%rsi
+  80407f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804084:	49 89 df             	mov    %rbx,%r15
+  804087:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  80408e:	ff ff ff 
+  804091:	48 01 d8             	add    %rbx,%rax
+  804094:	ff d0                	call   *%rax
+	return r;
+  804096:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  804099:	48 83 c4 30          	add    $0x30,%rsp
+  80409d:	5b                   	pop    %rbx
+  80409e:	41 5f                	pop    %r15
+  8040a0:	5d                   	pop    %rbp
+  8040a1:	c3                   	ret
+
+00000000008040a2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8040a2:	55                   	push   %rbp
+  8040a3:	48 89 e5             	mov    %rsp,%rbp
+  8040a6:	41 57                	push   %r15
+  8040a8:	48 83 ec 28          	sub    $0x28,%rsp
+  8040ac:	48 8d 0d f9 ff ff ff 	lea    -0x7(%rip),%rcx        # 8040ac <dev_lookup+0xa>
+  8040b3:	49 bb 94 4f 00 00 00 	movabs $0x4f94,%r11
+  8040ba:	00 00 00 
+  8040bd:	4c 01 d9             	add    %r11,%rcx
+  8040c0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8040c3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8040c7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8040ce:	eb 45                	jmp    804115 <dev_lookup+0x73>
+		if (devtab[i]->dev_id == dev_id) {
+  8040d0:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  8040d7:	00 00 00 
+  8040da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040dd:	48 98                	cltq
+  8040df:	48 01 ca             	add    %rcx,%rdx
+  8040e2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8040e6:	8b 00                	mov    (%rax),%eax
+  8040e8:	39 45 dc             	cmp    %eax,-0x24(%rbp)
+  8040eb:	75 24                	jne    804111 <dev_lookup+0x6f>
+			*dev = devtab[i];
+  8040ed:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  8040f4:	00 00 00 
+  8040f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040fa:	48 98                	cltq
+  8040fc:	48 01 ca             	add    %rcx,%rdx
+  8040ff:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804103:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804107:	48 89 10             	mov    %rdx,(%rax)
+			return 0;
+  80410a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410f:	eb 74                	jmp    804185 <dev_lookup+0xe3>
+	for (i = 0; devtab[i]; i++)
+  804111:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804115:	48 ba 00 02 00 00 00 	movabs $0x200,%rdx
+  80411c:	00 00 00 
+  80411f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804122:	48 98                	cltq
+  804124:	48 01 ca             	add    %rcx,%rdx
+  804127:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80412b:	48 85 c0             	test   %rax,%rax
+  80412e:	75 a0                	jne    8040d0 <dev_lookup+0x2e>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  804130:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804137:	ff ff ff 
+  80413a:	48 8b 04 01          	mov    (%rcx,%rax,1),%rax
+  80413e:	48 8b 00             	mov    (%rax),%rax
+  804141:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804147:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80414a:	89 c6                	mov    %eax,%esi
+  80414c:	48 b8 d8 e4 ff ff ff 	movabs $0xffffffffffffe4d8,%rax
+  804153:	ff ff ff 
+  804156:	48 8d 04 01          	lea    (%rcx,%rax,1),%rax
+  80415a:	48 89 c7             	mov    %rax,%rdi
+  80415d:	49 89 cf             	mov    %rcx,%r15
+  804160:	b8 00 00 00 00       	mov    $0x0,%eax
+  804165:	49 b8 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%r8
+  80416c:	ff ff ff 
+  80416f:	49 01 c8             	add    %rcx,%r8
+  804172:	41 ff d0             	call   *%r8
+	*dev = 0;
+  804175:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804179:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+	return -E_INVAL;
+  804180:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  804185:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  804189:	c9                   	leave
+  80418a:	c3                   	ret
+
+000000000080418b <close>:
+
+int
+close(int fdnum)
+{
+  80418b:	55                   	push   %rbp
+  80418c:	48 89 e5             	mov    %rsp,%rbp
+  80418f:	53                   	push   %rbx
+  804190:	48 83 ec 28          	sub    $0x28,%rsp
+  804194:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804194 <close+0x9>
+  80419b:	49 bb ac 4e 00 00 00 	movabs $0x4eac,%r11
+  8041a2:	00 00 00 
+  8041a5:	4c 01 db             	add    %r11,%rbx
+  8041a8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8041ab:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8041af:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041b2:	48 89 d6             	mov    %rdx,%rsi
+  8041b5:	89 c7                	mov    %eax,%edi
+  8041b7:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  8041be:	ff ff ff 
+  8041c1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041c5:	ff d0                	call   *%rax
+  8041c7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8041ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8041ce:	79 05                	jns    8041d5 <close+0x4a>
+		return r;
+  8041d0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041d3:	eb 1c                	jmp    8041f1 <close+0x66>
+	else
+		return fd_close(fd, 1);
+  8041d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8041de:	48 89 c7             	mov    %rax,%rdi
+  8041e1:	48 b8 67 af ff ff ff 	movabs $0xffffffffffffaf67,%rax
+  8041e8:	ff ff ff 
+  8041eb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8041ef:	ff d0                	call   *%rax
+}
+  8041f1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041f5:	c9                   	leave
+  8041f6:	c3                   	ret
+
+00000000008041f7 <close_all>:
+
+void
+close_all(void)
+{
+  8041f7:	55                   	push   %rbp
+  8041f8:	48 89 e5             	mov    %rsp,%rbp
+  8041fb:	53                   	push   %rbx
+  8041fc:	48 83 ec 18          	sub    $0x18,%rsp
+  804200:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804200 <close_all+0x9>
+  804207:	49 bb 40 4e 00 00 00 	movabs $0x4e40,%r11
+  80420e:	00 00 00 
+  804211:	4c 01 db             	add    %r11,%rbx
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  804214:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  80421b:	eb 19                	jmp    804236 <close_all+0x3f>
+		close(i);
+  80421d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804220:	89 c7                	mov    %eax,%edi
+  804222:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  804229:	ff ff ff 
+  80422c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804230:	ff d0                	call   *%rax
+	for (i = 0; i < MAXFD; i++)
+  804232:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804236:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80423a:	7e e1                	jle    80421d <close_all+0x26>
+}
+  80423c:	90                   	nop
+  80423d:	90                   	nop
+  80423e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804242:	c9                   	leave
+  804243:	c3                   	ret
+
+0000000000804244 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  804244:	55                   	push   %rbp
+  804245:	48 89 e5             	mov    %rsp,%rbp
+  804248:	41 57                	push   %r15
+  80424a:	53                   	push   %rbx
+  80424b:	48 83 ec 40          	sub    $0x40,%rsp
+  80424f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80424f <dup+0xb>
+  804256:	49 bb f1 4d 00 00 00 	movabs $0x4df1,%r11
+  80425d:	00 00 00 
+  804260:	4c 01 db             	add    %r11,%rbx
+  804263:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  804266:	89 75 b8             	mov    %esi,-0x48(%rbp)
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  804269:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80426d:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  804270:	48 89 d6             	mov    %rdx,%rsi
+  804273:	89 c7                	mov    %eax,%edi
+  804275:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  80427c:	ff ff ff 
+  80427f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804283:	ff d0                	call   *%rax
+  804285:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804288:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80428c:	79 08                	jns    804296 <dup+0x52>
+		return r;
+  80428e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804291:	e9 a4 01 00 00       	jmp    80443a <dup+0x1f6>
+	close(newfdnum);
+  804296:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804299:	89 c7                	mov    %eax,%edi
+  80429b:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  8042a2:	ff ff ff 
+  8042a5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042a9:	ff d0                	call   *%rax
+
+	newfd = INDEX2FD(newfdnum);
+  8042ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8042ae:	48 98                	cltq
+  8042b0:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  8042b6:	48 c1 e0 0c          	shl    $0xc,%rax
+  8042ba:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	ova = fd2data(oldfd);
+  8042be:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042c2:	48 89 c7             	mov    %rax,%rdi
+  8042c5:	48 b8 c3 ad ff ff ff 	movabs $0xffffffffffffadc3,%rax
+  8042cc:	ff ff ff 
+  8042cf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042d3:	ff d0                	call   *%rax
+  8042d5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	nva = fd2data(newfd);
+  8042d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8042dd:	48 89 c7             	mov    %rax,%rdi
+  8042e0:	48 b8 c3 ad ff ff ff 	movabs $0xffffffffffffadc3,%rax
+  8042e7:	ff ff ff 
+  8042ea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8042ee:	ff d0                	call   *%rax
+  8042f0:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+	if ((uvpd[VPD(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8042f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042f8:	48 c1 e8 15          	shr    $0x15,%rax
+  8042fc:	48 89 c2             	mov    %rax,%rdx
+  8042ff:	48 b8 d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rax
+  804306:	ff ff ff 
+  804309:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80430d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804311:	83 e0 01             	and    $0x1,%eax
+  804314:	48 85 c0             	test   %rax,%rax
+  804317:	74 7f                	je     804398 <dup+0x154>
+  804319:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80431d:	48 c1 e8 0c          	shr    $0xc,%rax
+  804321:	48 89 c2             	mov    %rax,%rdx
+  804324:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  80432b:	ff ff ff 
+  80432e:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804332:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804336:	83 e0 01             	and    $0x1,%eax
+  804339:	48 85 c0             	test   %rax,%rax
+  80433c:	74 5a                	je     804398 <dup+0x154>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80433e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804342:	48 c1 e8 0c          	shr    $0xc,%rax
+  804346:	48 89 c2             	mov    %rax,%rdx
+  804349:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  804350:	ff ff ff 
+  804353:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804357:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80435b:	25 07 0e 00 00       	and    $0xe07,%eax
+  804360:	89 c1                	mov    %eax,%ecx
+  804362:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804366:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80436a:	41 89 c8             	mov    %ecx,%r8d
+  80436d:	48 89 d1             	mov    %rdx,%rcx
+  804370:	ba 00 00 00 00       	mov    $0x0,%edx
+  804375:	48 89 c6             	mov    %rax,%rsi
+  804378:	bf 00 00 00 00       	mov    $0x0,%edi
+  80437d:	49 89 df             	mov    %rbx,%r15
+  804380:	48 b8 f0 92 ff ff ff 	movabs $0xffffffffffff92f0,%rax
+  804387:	ff ff ff 
+  80438a:	48 01 d8             	add    %rbx,%rax
+  80438d:	ff d0                	call   *%rax
+  80438f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804392:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804396:	78 5f                	js     8043f7 <dup+0x1b3>
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  804398:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80439c:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043a0:	48 89 c2             	mov    %rax,%rdx
+  8043a3:	48 b8 d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rax
+  8043aa:	ff ff ff 
+  8043ad:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8043b1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8043b5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8043ba:	89 c1                	mov    %eax,%ecx
+  8043bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043c0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8043c4:	41 89 c8             	mov    %ecx,%r8d
+  8043c7:	48 89 d1             	mov    %rdx,%rcx
+  8043ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043cf:	48 89 c6             	mov    %rax,%rsi
+  8043d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043d7:	49 89 df             	mov    %rbx,%r15
+  8043da:	48 b8 f0 92 ff ff ff 	movabs $0xffffffffffff92f0,%rax
+  8043e1:	ff ff ff 
+  8043e4:	48 01 d8             	add    %rbx,%rax
+  8043e7:	ff d0                	call   *%rax
+  8043e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8043ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8043f0:	78 08                	js     8043fa <dup+0x1b6>
+		goto err;
+
+	return newfdnum;
+  8043f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8043f5:	eb 43                	jmp    80443a <dup+0x1f6>
+			goto err;
+  8043f7:	90                   	nop
+  8043f8:	eb 01                	jmp    8043fb <dup+0x1b7>
+		goto err;
+  8043fa:	90                   	nop
+
+err:
+	sys_page_unmap(0, newfd);
+  8043fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043ff:	48 89 c6             	mov    %rax,%rsi
+  804402:	bf 00 00 00 00       	mov    $0x0,%edi
+  804407:	49 89 df             	mov    %rbx,%r15
+  80440a:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  804411:	ff ff ff 
+  804414:	48 01 d8             	add    %rbx,%rax
+  804417:	ff d0                	call   *%rax
+	sys_page_unmap(0, nva);
+  804419:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80441d:	48 89 c6             	mov    %rax,%rsi
+  804420:	bf 00 00 00 00       	mov    $0x0,%edi
+  804425:	49 89 df             	mov    %rbx,%r15
+  804428:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  80442f:	ff ff ff 
+  804432:	48 01 d8             	add    %rbx,%rax
+  804435:	ff d0                	call   *%rax
+	return r;
+  804437:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80443a:	48 83 c4 40          	add    $0x40,%rsp
+  80443e:	5b                   	pop    %rbx
+  80443f:	41 5f                	pop    %r15
+  804441:	5d                   	pop    %rbp
+  804442:	c3                   	ret
+
+0000000000804443 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  804443:	55                   	push   %rbp
+  804444:	48 89 e5             	mov    %rsp,%rbp
+  804447:	41 57                	push   %r15
+  804449:	53                   	push   %rbx
+  80444a:	48 83 ec 40          	sub    $0x40,%rsp
+  80444e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80444e <read+0xb>
+  804455:	49 bb f2 4b 00 00 00 	movabs $0x4bf2,%r11
+  80445c:	00 00 00 
+  80445f:	4c 01 db             	add    %r11,%rbx
+  804462:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804465:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804469:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80446d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804471:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804474:	48 89 d6             	mov    %rdx,%rsi
+  804477:	89 c7                	mov    %eax,%edi
+  804479:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  804480:	ff ff ff 
+  804483:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804487:	ff d0                	call   *%rax
+  804489:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80448c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804490:	78 28                	js     8044ba <read+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804492:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804496:	8b 00                	mov    (%rax),%eax
+  804498:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  80449c:	48 89 d6             	mov    %rdx,%rsi
+  80449f:	89 c7                	mov    %eax,%edi
+  8044a1:	48 b8 62 b0 ff ff ff 	movabs $0xffffffffffffb062,%rax
+  8044a8:	ff ff ff 
+  8044ab:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044af:	ff d0                	call   *%rax
+  8044b1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8044b4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8044b8:	79 08                	jns    8044c2 <read+0x7f>
+		return r;
+  8044ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8044bd:	e9 8b 00 00 00       	jmp    80454d <read+0x10a>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8044c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8044c6:	8b 40 08             	mov    0x8(%rax),%eax
+  8044c9:	83 e0 03             	and    $0x3,%eax
+  8044cc:	83 f8 01             	cmp    $0x1,%eax
+  8044cf:	75 4b                	jne    80451c <read+0xd9>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8044d1:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8044d8:	ff ff ff 
+  8044db:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8044df:	48 8b 00             	mov    (%rax),%rax
+  8044e2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8044e8:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8044eb:	89 c6                	mov    %eax,%esi
+  8044ed:	48 b8 f7 e4 ff ff ff 	movabs $0xffffffffffffe4f7,%rax
+  8044f4:	ff ff ff 
+  8044f7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8044fb:	48 89 c7             	mov    %rax,%rdi
+  8044fe:	49 89 df             	mov    %rbx,%r15
+  804501:	b8 00 00 00 00       	mov    $0x0,%eax
+  804506:	48 b9 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rcx
+  80450d:	ff ff ff 
+  804510:	48 01 d9             	add    %rbx,%rcx
+  804513:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804515:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80451a:	eb 31                	jmp    80454d <read+0x10a>
+	}
+	if (!dev->dev_read)
+  80451c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804520:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804524:	48 85 c0             	test   %rax,%rax
+  804527:	75 07                	jne    804530 <read+0xed>
+		return -E_NOT_SUPP;
+  804529:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80452e:	eb 1d                	jmp    80454d <read+0x10a>
+	return (*dev->dev_read)(fd, buf, n);
+  804530:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804534:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  804538:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80453c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804540:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804544:	48 89 ce             	mov    %rcx,%rsi
+  804547:	48 89 c7             	mov    %rax,%rdi
+  80454a:	41 ff d0             	call   *%r8
+}
+  80454d:	48 83 c4 40          	add    $0x40,%rsp
+  804551:	5b                   	pop    %rbx
+  804552:	41 5f                	pop    %r15
+  804554:	5d                   	pop    %rbp
+  804555:	c3                   	ret
+
+0000000000804556 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  804556:	55                   	push   %rbp
+  804557:	48 89 e5             	mov    %rsp,%rbp
+  80455a:	53                   	push   %rbx
+  80455b:	48 83 ec 38          	sub    $0x38,%rsp
+  80455f:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80455f <readn+0x9>
+  804566:	49 bb e1 4a 00 00 00 	movabs $0x4ae1,%r11
+  80456d:	00 00 00 
+  804570:	4c 01 db             	add    %r11,%rbx
+  804573:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804576:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80457a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80457e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804585:	eb 4b                	jmp    8045d2 <readn+0x7c>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  804587:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80458a:	48 98                	cltq
+  80458c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804590:	48 29 c2             	sub    %rax,%rdx
+  804593:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804596:	48 63 c8             	movslq %eax,%rcx
+  804599:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80459d:	48 01 c1             	add    %rax,%rcx
+  8045a0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045a3:	48 89 ce             	mov    %rcx,%rsi
+  8045a6:	89 c7                	mov    %eax,%edi
+  8045a8:	48 b8 03 b4 ff ff ff 	movabs $0xffffffffffffb403,%rax
+  8045af:	ff ff ff 
+  8045b2:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8045b6:	ff d0                	call   *%rax
+  8045b8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (m < 0)
+  8045bb:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8045bf:	79 05                	jns    8045c6 <readn+0x70>
+			return m;
+  8045c1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045c4:	eb 1d                	jmp    8045e3 <readn+0x8d>
+		if (m == 0)
+  8045c6:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8045ca:	74 13                	je     8045df <readn+0x89>
+	for (tot = 0; tot < n; tot += m) {
+  8045cc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045cf:	01 45 ec             	add    %eax,-0x14(%rbp)
+  8045d2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045d5:	48 98                	cltq
+  8045d7:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  8045db:	72 aa                	jb     804587 <readn+0x31>
+  8045dd:	eb 01                	jmp    8045e0 <readn+0x8a>
+			break;
+  8045df:	90                   	nop
+	}
+	return tot;
+  8045e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8045e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045e7:	c9                   	leave
+  8045e8:	c3                   	ret
+
+00000000008045e9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8045e9:	55                   	push   %rbp
+  8045ea:	48 89 e5             	mov    %rsp,%rbp
+  8045ed:	41 57                	push   %r15
+  8045ef:	53                   	push   %rbx
+  8045f0:	48 83 ec 40          	sub    $0x40,%rsp
+  8045f4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8045f4 <write+0xb>
+  8045fb:	49 bb 4c 4a 00 00 00 	movabs $0x4a4c,%r11
+  804602:	00 00 00 
+  804605:	4c 01 db             	add    %r11,%rbx
+  804608:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80460b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80460f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804613:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804617:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80461a:	48 89 d6             	mov    %rdx,%rsi
+  80461d:	89 c7                	mov    %eax,%edi
+  80461f:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  804626:	ff ff ff 
+  804629:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80462d:	ff d0                	call   *%rax
+  80462f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804632:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804636:	78 28                	js     804660 <write+0x77>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804638:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80463c:	8b 00                	mov    (%rax),%eax
+  80463e:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  804642:	48 89 d6             	mov    %rdx,%rsi
+  804645:	89 c7                	mov    %eax,%edi
+  804647:	48 b8 62 b0 ff ff ff 	movabs $0xffffffffffffb062,%rax
+  80464e:	ff ff ff 
+  804651:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804655:	ff d0                	call   *%rax
+  804657:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80465a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80465e:	79 08                	jns    804668 <write+0x7f>
+		return r;
+  804660:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804663:	e9 8a 00 00 00       	jmp    8046f2 <write+0x109>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804668:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80466c:	8b 40 08             	mov    0x8(%rax),%eax
+  80466f:	83 e0 03             	and    $0x3,%eax
+  804672:	85 c0                	test   %eax,%eax
+  804674:	75 4b                	jne    8046c1 <write+0xd8>
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  804676:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80467d:	ff ff ff 
+  804680:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804684:	48 8b 00             	mov    (%rax),%rax
+  804687:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80468d:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  804690:	89 c6                	mov    %eax,%esi
+  804692:	48 b8 13 e5 ff ff ff 	movabs $0xffffffffffffe513,%rax
+  804699:	ff ff ff 
+  80469c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8046a0:	48 89 c7             	mov    %rax,%rdi
+  8046a3:	49 89 df             	mov    %rbx,%r15
+  8046a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ab:	48 b9 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rcx
+  8046b2:	ff ff ff 
+  8046b5:	48 01 d9             	add    %rbx,%rcx
+  8046b8:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  8046ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8046bf:	eb 31                	jmp    8046f2 <write+0x109>
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8046c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046c5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8046c9:	48 85 c0             	test   %rax,%rax
+  8046cc:	75 07                	jne    8046d5 <write+0xec>
+		return -E_NOT_SUPP;
+  8046ce:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8046d3:	eb 1d                	jmp    8046f2 <write+0x109>
+	return (*dev->dev_write)(fd, buf, n);
+  8046d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046d9:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8046dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046e1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8046e5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8046e9:	48 89 ce             	mov    %rcx,%rsi
+  8046ec:	48 89 c7             	mov    %rax,%rdi
+  8046ef:	41 ff d0             	call   *%r8
+}
+  8046f2:	48 83 c4 40          	add    $0x40,%rsp
+  8046f6:	5b                   	pop    %rbx
+  8046f7:	41 5f                	pop    %r15
+  8046f9:	5d                   	pop    %rbp
+  8046fa:	c3                   	ret
+
+00000000008046fb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8046fb:	55                   	push   %rbp
+  8046fc:	48 89 e5             	mov    %rsp,%rbp
+  8046ff:	48 83 ec 18          	sub    $0x18,%rsp
+  804703:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804703 <seek+0x8>
+  80470a:	49 bb 3d 49 00 00 00 	movabs $0x493d,%r11
+  804711:	00 00 00 
+  804714:	4c 01 d8             	add    %r11,%rax
+  804717:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80471a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80471d:	48 8d 4d f0          	lea    -0x10(%rbp),%rcx
+  804721:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  804724:	48 89 ce             	mov    %rcx,%rsi
+  804727:	89 d7                	mov    %edx,%edi
+  804729:	48 ba bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rdx
+  804730:	ff ff ff 
+  804733:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  804737:	ff d0                	call   *%rax
+  804739:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80473c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804740:	79 05                	jns    804747 <seek+0x4c>
+		return r;
+  804742:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804745:	eb 0f                	jmp    804756 <seek+0x5b>
+	fd->fd_offset = offset;
+  804747:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80474b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80474e:	89 50 04             	mov    %edx,0x4(%rax)
+	return 0;
+  804751:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804756:	c9                   	leave
+  804757:	c3                   	ret
+
+0000000000804758 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  804758:	55                   	push   %rbp
+  804759:	48 89 e5             	mov    %rsp,%rbp
+  80475c:	41 57                	push   %r15
+  80475e:	53                   	push   %rbx
+  80475f:	48 83 ec 30          	sub    $0x30,%rsp
+  804763:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804763 <ftruncate+0xb>
+  80476a:	49 bb dd 48 00 00 00 	movabs $0x48dd,%r11
+  804771:	00 00 00 
+  804774:	4c 01 db             	add    %r11,%rbx
+  804777:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80477a:	89 75 c8             	mov    %esi,-0x38(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80477d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804781:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804784:	48 89 d6             	mov    %rdx,%rsi
+  804787:	89 c7                	mov    %eax,%edi
+  804789:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  804790:	ff ff ff 
+  804793:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804797:	ff d0                	call   *%rax
+  804799:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80479c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047a0:	78 28                	js     8047ca <ftruncate+0x72>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8047a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047a6:	8b 00                	mov    (%rax),%eax
+  8047a8:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8047ac:	48 89 d6             	mov    %rdx,%rsi
+  8047af:	89 c7                	mov    %eax,%edi
+  8047b1:	48 b8 62 b0 ff ff ff 	movabs $0xffffffffffffb062,%rax
+  8047b8:	ff ff ff 
+  8047bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8047bf:	ff d0                	call   *%rax
+  8047c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8047c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8047c8:	79 08                	jns    8047d2 <ftruncate+0x7a>
+		return r;
+  8047ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8047cd:	e9 83 00 00 00       	jmp    804855 <ftruncate+0xfd>
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8047d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8047d6:	8b 40 08             	mov    0x8(%rax),%eax
+  8047d9:	83 e0 03             	and    $0x3,%eax
+  8047dc:	85 c0                	test   %eax,%eax
+  8047de:	75 4b                	jne    80482b <ftruncate+0xd3>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+  8047e0:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8047e7:	ff ff ff 
+  8047ea:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8047ee:	48 8b 00             	mov    (%rax),%rax
+  8047f1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8047f7:	8b 55 cc             	mov    -0x34(%rbp),%edx
+  8047fa:	89 c6                	mov    %eax,%esi
+  8047fc:	48 b8 30 e5 ff ff ff 	movabs $0xffffffffffffe530,%rax
+  804803:	ff ff ff 
+  804806:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80480a:	48 89 c7             	mov    %rax,%rdi
+  80480d:	49 89 df             	mov    %rbx,%r15
+  804810:	b8 00 00 00 00       	mov    $0x0,%eax
+  804815:	48 b9 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rcx
+  80481c:	ff ff ff 
+  80481f:	48 01 d9             	add    %rbx,%rcx
+  804822:	ff d1                	call   *%rcx
+		return -E_INVAL;
+  804824:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804829:	eb 2a                	jmp    804855 <ftruncate+0xfd>
+	}
+	if (!dev->dev_trunc)
+  80482b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80482f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  804833:	48 85 c0             	test   %rax,%rax
+  804836:	75 07                	jne    80483f <ftruncate+0xe7>
+		return -E_NOT_SUPP;
+  804838:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80483d:	eb 16                	jmp    804855 <ftruncate+0xfd>
+	return (*dev->dev_trunc)(fd, newsize);
+  80483f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804843:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804847:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80484b:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80484e:	89 d6                	mov    %edx,%esi
+  804850:	48 89 c7             	mov    %rax,%rdi
+  804853:	ff d1                	call   *%rcx
+}
+  804855:	48 83 c4 30          	add    $0x30,%rsp
+  804859:	5b                   	pop    %rbx
+  80485a:	41 5f                	pop    %r15
+  80485c:	5d                   	pop    %rbp
+  80485d:	c3                   	ret
+
+000000000080485e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80485e:	55                   	push   %rbp
+  80485f:	48 89 e5             	mov    %rsp,%rbp
+  804862:	53                   	push   %rbx
+  804863:	48 83 ec 38          	sub    $0x38,%rsp
+  804867:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804867 <fstat+0x9>
+  80486e:	49 bb d9 47 00 00 00 	movabs $0x47d9,%r11
+  804875:	00 00 00 
+  804878:	4c 01 db             	add    %r11,%rbx
+  80487b:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80487e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  804882:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  804886:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804889:	48 89 d6             	mov    %rdx,%rsi
+  80488c:	89 c7                	mov    %eax,%edi
+  80488e:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  804895:	ff ff ff 
+  804898:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80489c:	ff d0                	call   *%rax
+  80489e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048a1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048a5:	78 28                	js     8048cf <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8048a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8048ab:	8b 00                	mov    (%rax),%eax
+  8048ad:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8048b1:	48 89 d6             	mov    %rdx,%rsi
+  8048b4:	89 c7                	mov    %eax,%edi
+  8048b6:	48 b8 62 b0 ff ff ff 	movabs $0xffffffffffffb062,%rax
+  8048bd:	ff ff ff 
+  8048c0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8048c4:	ff d0                	call   *%rax
+  8048c6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8048c9:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8048cd:	79 05                	jns    8048d4 <fstat+0x76>
+		return r;
+  8048cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048d2:	eb 5e                	jmp    804932 <fstat+0xd4>
+	if (!dev->dev_stat)
+  8048d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048d8:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8048dc:	48 85 c0             	test   %rax,%rax
+  8048df:	75 07                	jne    8048e8 <fstat+0x8a>
+		return -E_NOT_SUPP;
+  8048e1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8048e6:	eb 4a                	jmp    804932 <fstat+0xd4>
+	stat->st_name[0] = 0;
+  8048e8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048ec:	c6 00 00             	movb   $0x0,(%rax)
+	stat->st_size = 0;
+  8048ef:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048f3:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8048fa:	00 00 00 
+	stat->st_isdir = 0;
+  8048fd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804901:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804908:	00 00 00 
+	stat->st_dev = dev;
+  80490b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80490f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804913:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return (*dev->dev_stat)(fd, stat);
+  80491a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80491e:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804922:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804926:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80492a:	48 89 d6             	mov    %rdx,%rsi
+  80492d:	48 89 c7             	mov    %rax,%rdi
+  804930:	ff d1                	call   *%rcx
+}
+  804932:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804936:	c9                   	leave
+  804937:	c3                   	ret
+
+0000000000804938 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  804938:	55                   	push   %rbp
+  804939:	48 89 e5             	mov    %rsp,%rbp
+  80493c:	41 57                	push   %r15
+  80493e:	53                   	push   %rbx
+  80493f:	48 83 ec 20          	sub    $0x20,%rsp
+  804943:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804943 <stat+0xb>
+  80494a:	49 bb fd 46 00 00 00 	movabs $0x46fd,%r11
+  804951:	00 00 00 
+  804954:	4c 01 db             	add    %r11,%rbx
+  804957:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80495b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80495f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804963:	be 00 00 00 00       	mov    $0x0,%esi
+  804968:	48 89 c7             	mov    %rax,%rdi
+  80496b:	49 89 df             	mov    %rbx,%r15
+  80496e:	48 b8 d2 bb ff ff ff 	movabs $0xffffffffffffbbd2,%rax
+  804975:	ff ff ff 
+  804978:	48 01 d8             	add    %rbx,%rax
+  80497b:	ff d0                	call   *%rax
+  80497d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804980:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804984:	79 05                	jns    80498b <stat+0x53>
+		return fd;
+  804986:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804989:	eb 37                	jmp    8049c2 <stat+0x8a>
+	r = fstat(fd, stat);
+  80498b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80498f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804992:	48 89 d6             	mov    %rdx,%rsi
+  804995:	89 c7                	mov    %eax,%edi
+  804997:	48 b8 1e b8 ff ff ff 	movabs $0xffffffffffffb81e,%rax
+  80499e:	ff ff ff 
+  8049a1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049a5:	ff d0                	call   *%rax
+  8049a7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	close(fd);
+  8049aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049ad:	89 c7                	mov    %eax,%edi
+  8049af:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  8049b6:	ff ff ff 
+  8049b9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8049bd:	ff d0                	call   *%rax
+	return r;
+  8049bf:	8b 45 e8             	mov    -0x18(%rbp),%eax
+}
+  8049c2:	48 83 c4 20          	add    $0x20,%rsp
+  8049c6:	5b                   	pop    %rbx
+  8049c7:	41 5f                	pop    %r15
+  8049c9:	5d                   	pop    %rbp
+  8049ca:	c3                   	ret
+
+00000000008049cb <fsipc>:
+// Returns result from the file server.
+static envid_t fsenv;
+
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8049cb:	55                   	push   %rbp
+  8049cc:	48 89 e5             	mov    %rsp,%rbp
+  8049cf:	41 57                	push   %r15
+  8049d1:	53                   	push   %rbx
+  8049d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8049d6:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8049d6 <fsipc+0xb>
+  8049dd:	49 bb 6a 46 00 00 00 	movabs $0x466a,%r11
+  8049e4:	00 00 00 
+  8049e7:	4c 01 db             	add    %r11,%rbx
+  8049ea:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8049ed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	if (fsenv == 0)
+  8049f1:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  8049f8:	00 00 00 
+  8049fb:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8049fe:	85 c0                	test   %eax,%eax
+  804a00:	75 24                	jne    804a26 <fsipc+0x5b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804a02:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a07:	49 89 df             	mov    %rbx,%r15
+  804a0a:	48 b8 fd ac ff ff ff 	movabs $0xffffffffffffacfd,%rax
+  804a11:	ff ff ff 
+  804a14:	48 01 d8             	add    %rbx,%rax
+  804a17:	ff d0                	call   *%rax
+  804a19:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804a20:	00 00 00 
+  804a23:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	//static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	return ipc_call(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U,
+  804a26:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804a2d:	00 00 00 
+  804a30:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804a33:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a37:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804a3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804a40:	49 89 d0             	mov    %rdx,%r8
+  804a43:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804a48:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804a4f:	00 00 00 
+  804a52:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  804a56:	89 c7                	mov    %eax,%edi
+  804a58:	49 89 df             	mov    %rbx,%r15
+  804a5b:	48 b8 1c a7 ff ff ff 	movabs $0xffffffffffffa71c,%rax
+  804a62:	ff ff ff 
+  804a65:	48 01 d8             	add    %rbx,%rax
+  804a68:	ff d0                	call   *%rax
+			dstva, NULL);
+}
+  804a6a:	48 83 c4 10          	add    $0x10,%rsp
+  804a6e:	5b                   	pop    %rbx
+  804a6f:	41 5f                	pop    %r15
+  804a71:	5d                   	pop    %rbp
+  804a72:	c3                   	ret
+
+0000000000804a73 <fsipc_words>:
+// Like fsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// fsipcbuf, saving the file server mapping and unmapping the page.
+static int
+fsipc_words(unsigned type, const void *req, size_t len)
+{
+  804a73:	55                   	push   %rbp
+  804a74:	48 89 e5             	mov    %rsp,%rbp
+  804a77:	41 57                	push   %r15
+  804a79:	53                   	push   %rbx
+  804a7a:	48 83 ec 20          	sub    $0x20,%rsp
+  804a7e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804a7e <fsipc_words+0xb>
+  804a85:	49 bb c2 45 00 00 00 	movabs $0x45c2,%r11
+  804a8c:	00 00 00 
+  804a8f:	4c 01 db             	add    %r11,%rbx
+  804a92:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804a95:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804a99:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (fsenv == 0)
+  804a9d:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804aa4:	00 00 00 
+  804aa7:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804aaa:	85 c0                	test   %eax,%eax
+  804aac:	75 24                	jne    804ad2 <fsipc_words+0x5f>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804aae:	bf 01 00 00 00       	mov    $0x1,%edi
+  804ab3:	49 89 df             	mov    %rbx,%r15
+  804ab6:	48 b8 fd ac ff ff ff 	movabs $0xffffffffffffacfd,%rax
+  804abd:	ff ff ff 
+  804ac0:	48 01 d8             	add    %rbx,%rax
+  804ac3:	ff d0                	call   *%rax
+  804ac5:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804acc:	00 00 00 
+  804acf:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(fsenv, type, req, len);
+  804ad2:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804ad9:	00 00 00 
+  804adc:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804adf:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  804ae3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804ae7:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  804aea:	89 c7                	mov    %eax,%edi
+  804aec:	49 89 df             	mov    %rbx,%r15
+  804aef:	48 b8 07 a8 ff ff ff 	movabs $0xffffffffffffa807,%rax
+  804af6:	ff ff ff 
+  804af9:	48 01 d8             	add    %rbx,%rax
+  804afc:	ff d0                	call   *%rax
+}
+  804afe:	48 83 c4 20          	add    $0x20,%rsp
+  804b02:	5b                   	pop    %rbx
+  804b03:	41 5f                	pop    %r15
+  804b05:	5d                   	pop    %rbp
+  804b06:	c3                   	ret
+
+0000000000804b07 <fsipc_pages>:
+// at 'words' with the first 'npages' pages at WRITEVA, and map the
+// reply's pages at READVA.  The reply's words are stored back in
+// 'words', which has room for IPC_NWORDS.
+static int
+fsipc_pages(unsigned type, uint64_t *words, size_t len, int npages)
+{
+  804b07:	55                   	push   %rbp
+  804b08:	48 89 e5             	mov    %rsp,%rbp
+  804b0b:	41 57                	push   %r15
+  804b0d:	53                   	push   %rbx
+  804b0e:	48 83 ec 40          	sub    $0x40,%rsp
+  804b12:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804b12 <fsipc_pages+0xb>
+  804b19:	49 bb 2e 45 00 00 00 	movabs $0x452e,%r11
+  804b20:	00 00 00 
+  804b23:	4c 01 db             	add    %r11,%rbx
+  804b26:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804b29:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804b2d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  804b31:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+	struct IpcSeg seg;
+
+	if (fsenv == 0)
+  804b34:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804b3b:	00 00 00 
+  804b3e:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804b41:	85 c0                	test   %eax,%eax
+  804b43:	75 24                	jne    804b69 <fsipc_pages+0x62>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  804b45:	bf 01 00 00 00       	mov    $0x1,%edi
+  804b4a:	49 89 df             	mov    %rbx,%r15
+  804b4d:	48 b8 fd ac ff ff ff 	movabs $0xffffffffffffacfd,%rax
+  804b54:	ff ff ff 
+  804b57:	48 01 d8             	add    %rbx,%rax
+  804b5a:	ff d0                	call   *%rax
+  804b5c:	48 ba c8 1f 00 00 00 	movabs $0x1fc8,%rdx
+  804b63:	00 00 00 
+  804b66:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %d\n", thisenv->env_id, type,
+			npages);
+
+	seg.seg_va = WRITEVA;
+  804b69:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804b6e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+	seg.seg_npages = npages;
+  804b72:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  804b75:	48 98                	cltq
+  804b77:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	return ipc_callv(fsenv, type, words,
+  804b7b:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+  804b7f:	0f 95 c0             	setne  %al
+  804b82:	0f b6 f8             	movzbl %al,%edi
+			 ROUNDUP(len, sizeof(uint64_t)) / sizeof(uint64_t),
+  804b85:	48 c7 45 e8 08 00 00 	movq   $0x8,-0x18(%rbp)
+  804b8c:	00 
+  804b8d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804b91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b95:	48 01 d0             	add    %rdx,%rax
+  804b98:	48 83 e8 01          	sub    $0x1,%rax
+  804b9c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804ba0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ba9:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804bad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bb1:	48 29 d0             	sub    %rdx,%rax
+  804bb4:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(fsenv, type, words,
+  804bb8:	41 89 c2             	mov    %eax,%r10d
+  804bbb:	48 b8 c8 1f 00 00 00 	movabs $0x1fc8,%rax
+  804bc2:	00 00 00 
+  804bc5:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  804bc8:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  804bcc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804bd0:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  804bd3:	48 83 ec 08          	sub    $0x8,%rsp
+  804bd7:	6a 40                	push   $0x40
+  804bd9:	68 00 00 00 e0       	push   $0xffffffffe0000000
+  804bde:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%rsp)
+  804be5:	00 
+  804be6:	6a 05                	push   $0x5
+  804be8:	41 89 f9             	mov    %edi,%r9d
+  804beb:	49 89 c8             	mov    %rcx,%r8
+  804bee:	44 89 d1             	mov    %r10d,%ecx
+  804bf1:	89 c7                	mov    %eax,%edi
+  804bf3:	49 89 df             	mov    %rbx,%r15
+  804bf6:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  804bfd:	ff ff ff 
+  804c00:	48 01 d8             	add    %rbx,%rax
+  804c03:	ff d0                	call   *%rax
+  804c05:	48 83 c4 20          	add    $0x20,%rsp
+			 &seg, npages ? 1 : 0, PTE_P | PTE_U,
+			 (void *) READVA, IPC_MAXPAGES);
+}
+  804c09:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804c0d:	5b                   	pop    %rbx
+  804c0e:	41 5f                	pop    %r15
+  804c10:	5d                   	pop    %rbp
+  804c11:	c3                   	ret
+
+0000000000804c12 <open>:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode)
+{
+  804c12:	55                   	push   %rbp
+  804c13:	48 89 e5             	mov    %rsp,%rbp
+  804c16:	41 57                	push   %r15
+  804c18:	53                   	push   %rbx
+  804c19:	48 83 ec 20          	sub    $0x20,%rsp
+  804c1d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804c1d <open+0xb>
+  804c24:	49 bb 23 44 00 00 00 	movabs $0x4423,%r11
+  804c2b:	00 00 00 
+  804c2e:	4c 01 db             	add    %r11,%rbx
+  804c31:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804c35:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+	int r;
+	struct Fd* fd; 
+
+	if (strlen(path) >= MAXPATHLEN){
+  804c38:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c3c:	48 89 c7             	mov    %rax,%rdi
+  804c3f:	49 89 df             	mov    %rbx,%r15
+  804c42:	48 b8 3b 85 ff ff ff 	movabs $0xffffffffffff853b,%rax
+  804c49:	ff ff ff 
+  804c4c:	48 01 d8             	add    %rbx,%rax
+  804c4f:	ff d0                	call   *%rax
+  804c51:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804c56:	7e 0a                	jle    804c62 <open+0x50>
+		return -E_BAD_PATH;
+  804c58:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  804c5d:	e9 18 01 00 00       	jmp    804d7a <open+0x168>
+	}
+	
+	if ((r = fd_alloc(&fd)))
+  804c62:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  804c66:	48 89 c7             	mov    %rax,%rdi
+  804c69:	49 89 df             	mov    %rbx,%r15
+  804c6c:	48 b8 06 ae ff ff ff 	movabs $0xffffffffffffae06,%rax
+  804c73:	ff ff ff 
+  804c76:	48 01 d8             	add    %rbx,%rax
+  804c79:	ff d0                	call   *%rax
+  804c7b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804c7e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804c82:	74 08                	je     804c8c <open+0x7a>
+		return r;
+  804c84:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c87:	e9 ee 00 00 00       	jmp    804d7a <open+0x168>
+	fsipcbuf.open.req_omode = mode;
+  804c8c:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  804c93:	00 00 00 
+  804c96:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804c99:	89 84 13 00 04 00 00 	mov    %eax,0x400(%rbx,%rdx,1)
+	strcpy(fsipcbuf.open.req_path,path);
+  804ca0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ca4:	48 89 c6             	mov    %rax,%rsi
+  804ca7:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  804cae:	00 00 00 
+  804cb1:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804cb5:	48 89 c7             	mov    %rax,%rdi
+  804cb8:	49 89 df             	mov    %rbx,%r15
+  804cbb:	48 b8 cf 85 ff ff ff 	movabs $0xffffffffffff85cf,%rax
+  804cc2:	ff ff ff 
+  804cc5:	48 01 d8             	add    %rbx,%rax
+  804cc8:	ff d0                	call   *%rax
+
+
+	if((r = sys_page_alloc(0,fd,PTE_SYSCALL))){
+  804cca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cce:	ba 07 0e 00 00       	mov    $0xe07,%edx
+  804cd3:	48 89 c6             	mov    %rax,%rsi
+  804cd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cdb:	49 89 df             	mov    %rbx,%r15
+  804cde:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  804ce5:	ff ff ff 
+  804ce8:	48 01 d8             	add    %rbx,%rax
+  804ceb:	ff d0                	call   *%rax
+  804ced:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804cf0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804cf4:	74 23                	je     804d19 <open+0x107>
+		fd_close(fd,0);
+  804cf6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cfa:	be 00 00 00 00       	mov    $0x0,%esi
+  804cff:	48 89 c7             	mov    %rax,%rdi
+  804d02:	49 89 df             	mov    %rbx,%r15
+  804d05:	48 b8 67 af ff ff ff 	movabs $0xffffffffffffaf67,%rax
+  804d0c:	ff ff ff 
+  804d0f:	48 01 d8             	add    %rbx,%rax
+  804d12:	ff d0                	call   *%rax
+		return r;
+  804d14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d17:	eb 61                	jmp    804d7a <open+0x168>
+	}
+
+
+	if ((r = fsipc(FSREQ_OPEN,fd))){
+  804d19:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d1d:	48 89 c6             	mov    %rax,%rsi
+  804d20:	bf 01 00 00 00       	mov    $0x1,%edi
+  804d25:	48 b8 8b b9 ff ff ff 	movabs $0xffffffffffffb98b,%rax
+  804d2c:	ff ff ff 
+  804d2f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804d33:	ff d0                	call   *%rax
+  804d35:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d38:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804d3c:	74 23                	je     804d61 <open+0x14f>
+		fd_close(fd,0);
+  804d3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d42:	be 00 00 00 00       	mov    $0x0,%esi
+  804d47:	48 89 c7             	mov    %rax,%rdi
+  804d4a:	49 89 df             	mov    %rbx,%r15
+  804d4d:	48 b8 67 af ff ff ff 	movabs $0xffffffffffffaf67,%rax
+  804d54:	ff ff ff 
+  804d57:	48 01 d8             	add    %rbx,%rax
+  804d5a:	ff d0                	call   *%rax
+		return r;
+  804d5c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d5f:	eb 19                	jmp    804d7a <open+0x168>
+	}
+
+
+		 
+	return fd2num(fd);
+  804d61:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d65:	48 89 c7             	mov    %rax,%rdi
+  804d68:	49 89 df             	mov    %rbx,%r15
+  804d6b:	48 b8 8c ad ff ff ff 	movabs $0xffffffffffffad8c,%rax
+  804d72:	ff ff ff 
+  804d75:	48 01 d8             	add    %rbx,%rax
+  804d78:	ff d0                	call   *%rax
+	// Return the file descriptor index.
+	// If any step after fd_alloc fails, use fd_close to free the
+	// file descriptor.
+
+	// LAB 5: Your code here
+}
+  804d7a:	48 83 c4 20          	add    $0x20,%rsp
+  804d7e:	5b                   	pop    %rbx
+  804d7f:	41 5f                	pop    %r15
+  804d81:	5d                   	pop    %rbp
+  804d82:	c3                   	ret
+
+0000000000804d83 <devfile_flush>:
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd)
+{
+  804d83:	55                   	push   %rbp
+  804d84:	48 89 e5             	mov    %rsp,%rbp
+  804d87:	48 83 ec 20          	sub    $0x20,%rsp
+  804d8b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 804d8b <devfile_flush+0x8>
+  804d92:	49 bb b5 42 00 00 00 	movabs $0x42b5,%r11
+  804d99:	00 00 00 
+  804d9c:	4c 01 d8             	add    %r11,%rax
+  804d9f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	struct Fsreq_flush req;
+
+	req.req_fileid = fd->fd_file.id;
+  804da3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804da7:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804daa:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_FLUSH, &req, sizeof(req));
+  804dad:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  804db1:	ba 04 00 00 00       	mov    $0x4,%edx
+  804db6:	48 89 ce             	mov    %rcx,%rsi
+  804db9:	bf 06 00 00 00       	mov    $0x6,%edi
+  804dbe:	48 b9 33 ba ff ff ff 	movabs $0xffffffffffffba33,%rcx
+  804dc5:	ff ff ff 
+  804dc8:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  804dcc:	ff d0                	call   *%rax
+}
+  804dce:	c9                   	leave
+  804dcf:	c3                   	ret
+
+0000000000804dd0 <devfile_read>:
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n)
+{
+  804dd0:	55                   	push   %rbp
+  804dd1:	48 89 e5             	mov    %rsp,%rbp
+  804dd4:	41 57                	push   %r15
+  804dd6:	53                   	push   %rbx
+  804dd7:	48 83 ec 60          	sub    $0x60,%rsp
+  804ddb:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ddb <devfile_read+0xb>
+  804de2:	49 bb 65 42 00 00 00 	movabs $0x4265,%r11
+  804de9:	00 00 00 
+  804dec:	4c 01 db             	add    %r11,%rbx
+  804def:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804df3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804df7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+	// Make an FSREQ_READ request to the file system server, with
+	// the arguments in registers.  The server replies with the file
+	// blocks holding the bytes read, mapped at READVA, and the
+	// offset of the first byte in its first register word.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_read *req = (struct Fsreq_read *) words;
+  804dfb:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804dff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int r;
+
+	req->req_fileid = fd->fd_file.id;
+  804e03:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e07:	8b 50 0c             	mov    0xc(%rax),%edx
+  804e0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e0e:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804e10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e14:	48 8b 55 98          	mov    -0x68(%rbp),%rdx
+  804e18:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	if ((r = fsipc_pages(FSREQ_READ, words, sizeof(*req), 0)) < 0)
+  804e1c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804e20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804e25:	ba 10 00 00 00       	mov    $0x10,%edx
+  804e2a:	48 89 c6             	mov    %rax,%rsi
+  804e2d:	bf 03 00 00 00       	mov    $0x3,%edi
+  804e32:	48 b8 c7 ba ff ff ff 	movabs $0xffffffffffffbac7,%rax
+  804e39:	ff ff ff 
+  804e3c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804e40:	ff d0                	call   *%rax
+  804e42:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  804e45:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  804e49:	79 05                	jns    804e50 <devfile_read+0x80>
+		return r;
+  804e4b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e4e:	eb 64                	jmp    804eb4 <devfile_read+0xe4>
+	memmove(buf, (char *) READVA + words[0], r);
+  804e50:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804e53:	48 63 d0             	movslq %eax,%rdx
+  804e56:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e5a:	b9 00 00 00 e0       	mov    $0xe0000000,%ecx
+  804e5f:	48 01 c1             	add    %rax,%rcx
+  804e62:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804e66:	48 89 ce             	mov    %rcx,%rsi
+  804e69:	48 89 c7             	mov    %rax,%rdi
+  804e6c:	49 89 df             	mov    %rbx,%r15
+  804e6f:	48 b8 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rax
+  804e76:	ff ff ff 
+  804e79:	48 01 d8             	add    %rbx,%rax
+  804e7c:	ff d0                	call   *%rax
+	// Don't keep the file's blocks: they may be reused for another.
+	ipc_unmap_window((void *) READVA, thisenv->env_ipc_npages);
+  804e7e:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  804e85:	ff ff ff 
+  804e88:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  804e8c:	48 8b 00             	mov    (%rax),%rax
+  804e8f:	8b 80 54 01 00 00    	mov    0x154(%rax),%eax
+  804e95:	89 c6                	mov    %eax,%esi
+  804e97:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+  804e9c:	48 89 c7             	mov    %rax,%rdi
+  804e9f:	49 89 df             	mov    %rbx,%r15
+  804ea2:	48 b8 b7 ac ff ff ff 	movabs $0xffffffffffffacb7,%rax
+  804ea9:	ff ff ff 
+  804eac:	48 01 d8             	add    %rbx,%rax
+  804eaf:	ff d0                	call   *%rax
+	return r;
+  804eb1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+}
+  804eb4:	48 83 c4 60          	add    $0x60,%rsp
+  804eb8:	5b                   	pop    %rbx
+  804eb9:	41 5f                	pop    %r15
+  804ebb:	5d                   	pop    %rbp
+  804ebc:	c3                   	ret
+
+0000000000804ebd <devfile_write>:
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n)
+{
+  804ebd:	55                   	push   %rbp
+  804ebe:	48 89 e5             	mov    %rsp,%rbp
+  804ec1:	41 57                	push   %r15
+  804ec3:	53                   	push   %rbx
+  804ec4:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  804ec8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 804ec8 <devfile_write+0xb>
+  804ecf:	49 bb 78 41 00 00 00 	movabs $0x4178,%r11
+  804ed6:	00 00 00 
+  804ed9:	4c 01 db             	add    %r11,%rbx
+  804edc:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  804ee0:	48 89 75 80          	mov    %rsi,-0x80(%rbp)
+  804ee4:	48 89 95 78 ff ff ff 	mov    %rdx,-0x88(%rbp)
+	// Make an FSREQ_WRITE request to the file system server, with
+	// the arguments in registers and the bytes staged in the pages
+	// at WRITEVA.  Remember that write is always allowed to write
+	// *fewer* bytes than requested.
+	uint64_t words[IPC_NWORDS];
+	struct Fsreq_write *req = (struct Fsreq_write *) words;
+  804eeb:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804eef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	int npages, r;
+
+	n = MIN(n, IPC_MAXPAGES * PGSIZE);
+  804ef3:	48 8b 85 78 ff ff ff 	mov    -0x88(%rbp),%rax
+  804efa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804efe:	c7 45 dc 00 00 04 00 	movl   $0x40000,-0x24(%rbp)
+  804f05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f08:	48 63 d0             	movslq %eax,%rdx
+  804f0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f0f:	48 39 c2             	cmp    %rax,%rdx
+  804f12:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f16:	48 89 85 78 ff ff ff 	mov    %rax,-0x88(%rbp)
+	npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  804f1d:	48 c7 45 d0 00 10 00 	movq   $0x1000,-0x30(%rbp)
+  804f24:	00 
+  804f25:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804f2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f30:	48 01 d0             	add    %rdx,%rax
+  804f33:	48 83 e8 01          	sub    $0x1,%rax
+  804f37:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804f3b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f44:	48 f7 75 d0          	divq   -0x30(%rbp)
+  804f48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f4c:	48 29 d0             	sub    %rdx,%rax
+  804f4f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f53:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+	if ((r = ipc_map_window((void *) WRITEVA, npages)) < 0)
+  804f56:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804f59:	89 c6                	mov    %eax,%esi
+  804f5b:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804f60:	48 89 c7             	mov    %rax,%rdi
+  804f63:	49 89 df             	mov    %rbx,%r15
+  804f66:	48 b8 71 ac ff ff ff 	movabs $0xffffffffffffac71,%rax
+  804f6d:	ff ff ff 
+  804f70:	48 01 d8             	add    %rbx,%rax
+  804f73:	ff d0                	call   *%rax
+  804f75:	89 45 c0             	mov    %eax,-0x40(%rbp)
+  804f78:	83 7d c0 00          	cmpl   $0x0,-0x40(%rbp)
+  804f7c:	79 08                	jns    804f86 <devfile_write+0xc9>
+		return r;
+  804f7e:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  804f81:	e9 8f 00 00 00       	jmp    805015 <devfile_write+0x158>
+	memmove((void *) WRITEVA, buf, n);
+  804f86:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804f8d:	48 8b 45 80          	mov    -0x80(%rbp),%rax
+  804f91:	48 89 c6             	mov    %rax,%rsi
+  804f94:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804f99:	48 89 c7             	mov    %rax,%rdi
+  804f9c:	49 89 df             	mov    %rbx,%r15
+  804f9f:	48 b8 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rax
+  804fa6:	ff ff ff 
+  804fa9:	48 01 d8             	add    %rbx,%rax
+  804fac:	ff d0                	call   *%rax
+	req->req_fileid = fd->fd_file.id;
+  804fae:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+  804fb2:	8b 50 0c             	mov    0xc(%rax),%edx
+  804fb5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fb9:	89 10                	mov    %edx,(%rax)
+	req->req_n = n;
+  804fbb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fbf:	48 8b 95 78 ff ff ff 	mov    -0x88(%rbp),%rdx
+  804fc6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+	r = fsipc_pages(FSREQ_WRITE, words, sizeof(*req), npages);
+  804fca:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  804fcd:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  804fd1:	89 d1                	mov    %edx,%ecx
+  804fd3:	ba 10 00 00 00       	mov    $0x10,%edx
+  804fd8:	48 89 c6             	mov    %rax,%rsi
+  804fdb:	bf 04 00 00 00       	mov    $0x4,%edi
+  804fe0:	48 b8 c7 ba ff ff ff 	movabs $0xffffffffffffbac7,%rax
+  804fe7:	ff ff ff 
+  804fea:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  804fee:	ff d0                	call   *%rax
+  804ff0:	89 45 c0             	mov    %eax,-0x40(%rbp)
+	ipc_unmap_window((void *) WRITEVA, npages);
+  804ff3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804ff6:	89 c6                	mov    %eax,%esi
+  804ff8:	b8 00 00 04 e0       	mov    $0xe0040000,%eax
+  804ffd:	48 89 c7             	mov    %rax,%rdi
+  805000:	49 89 df             	mov    %rbx,%r15
+  805003:	48 b8 b7 ac ff ff ff 	movabs $0xffffffffffffacb7,%rax
+  80500a:	ff ff ff 
+  80500d:	48 01 d8             	add    %rbx,%rax
+  805010:	ff d0                	call   *%rax
+	return r;
+  805012:	8b 45 c0             	mov    -0x40(%rbp),%eax
+}
+  805015:	48 83 ec 80          	sub    $0xffffffffffffff80,%rsp
+  805019:	5b                   	pop    %rbx
+  80501a:	41 5f                	pop    %r15
+  80501c:	5d                   	pop    %rbp
+  80501d:	c3                   	ret
+
+000000000080501e <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st)
+{
+  80501e:	55                   	push   %rbp
+  80501f:	48 89 e5             	mov    %rsp,%rbp
+  805022:	41 57                	push   %r15
+  805024:	53                   	push   %rbx
+  805025:	48 83 ec 20          	sub    $0x20,%rsp
+  805029:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805029 <devfile_stat+0xb>
+  805030:	49 bb 17 40 00 00 00 	movabs $0x4017,%r11
+  805037:	00 00 00 
+  80503a:	4c 01 db             	add    %r11,%rbx
+  80503d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805041:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	int r;
+
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  805045:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805049:	8b 40 0c             	mov    0xc(%rax),%eax
+  80504c:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  805053:	00 00 00 
+  805056:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  805059:	be 00 00 00 00       	mov    $0x0,%esi
+  80505e:	bf 05 00 00 00       	mov    $0x5,%edi
+  805063:	48 b8 8b b9 ff ff ff 	movabs $0xffffffffffffb98b,%rax
+  80506a:	ff ff ff 
+  80506d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805071:	ff d0                	call   *%rax
+  805073:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805076:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80507a:	79 05                	jns    805081 <devfile_stat+0x63>
+		return r;
+  80507c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80507f:	eb 65                	jmp    8050e6 <devfile_stat+0xc8>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  805081:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805085:	48 ba c0 3f 01 00 00 	movabs $0x13fc0,%rdx
+  80508c:	00 00 00 
+  80508f:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805093:	48 89 d6             	mov    %rdx,%rsi
+  805096:	48 89 c7             	mov    %rax,%rdi
+  805099:	49 89 df             	mov    %rbx,%r15
+  80509c:	48 b8 cf 85 ff ff ff 	movabs $0xffffffffffff85cf,%rax
+  8050a3:	ff ff ff 
+  8050a6:	48 01 d8             	add    %rbx,%rax
+  8050a9:	ff d0                	call   *%rax
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8050ab:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8050b2:	00 00 00 
+  8050b5:	8b 94 03 80 00 00 00 	mov    0x80(%rbx,%rax,1),%edx
+  8050bc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050c0:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8050c6:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  8050cd:	00 00 00 
+  8050d0:	8b 94 03 84 00 00 00 	mov    0x84(%rbx,%rax,1),%edx
+  8050d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050db:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+	return 0;
+  8050e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050e6:	48 83 c4 20          	add    $0x20,%rsp
+  8050ea:	5b                   	pop    %rbx
+  8050eb:	41 5f                	pop    %r15
+  8050ed:	5d                   	pop    %rbp
+  8050ee:	c3                   	ret
+
+00000000008050ef <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8050ef:	55                   	push   %rbp
+  8050f0:	48 89 e5             	mov    %rsp,%rbp
+  8050f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8050f7:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8050f7 <devfile_trunc+0x8>
+  8050fe:	49 bb 49 3f 00 00 00 	movabs $0x3f49,%r11
+  805105:	00 00 00 
+  805108:	4c 01 d8             	add    %r11,%rax
+  80510b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80510f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+	struct Fsreq_set_size req;
+
+	req.req_fileid = fd->fd_file.id;
+  805112:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805116:	8b 52 0c             	mov    0xc(%rdx),%edx
+  805119:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_size = newsize;
+  80511c:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80511f:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return fsipc_words(FSREQ_SET_SIZE, &req, sizeof(req));
+  805122:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805126:	ba 08 00 00 00       	mov    $0x8,%edx
+  80512b:	48 89 ce             	mov    %rcx,%rsi
+  80512e:	bf 02 00 00 00       	mov    $0x2,%edi
+  805133:	48 b9 33 ba ff ff ff 	movabs $0xffffffffffffba33,%rcx
+  80513a:	ff ff ff 
+  80513d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805141:	ff d0                	call   *%rax
+}
+  805143:	c9                   	leave
+  805144:	c3                   	ret
+
+0000000000805145 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  805145:	55                   	push   %rbp
+  805146:	48 89 e5             	mov    %rsp,%rbp
+  805149:	41 57                	push   %r15
+  80514b:	53                   	push   %rbx
+  80514c:	48 83 ec 10          	sub    $0x10,%rsp
+  805150:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805150 <remove+0xb>
+  805157:	49 bb f0 3e 00 00 00 	movabs $0x3ef0,%r11
+  80515e:	00 00 00 
+  805161:	4c 01 db             	add    %r11,%rbx
+  805164:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (strlen(path) >= MAXPATHLEN)
+  805168:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80516c:	48 89 c7             	mov    %rax,%rdi
+  80516f:	49 89 df             	mov    %rbx,%r15
+  805172:	48 b8 3b 85 ff ff ff 	movabs $0xffffffffffff853b,%rax
+  805179:	ff ff ff 
+  80517c:	48 01 d8             	add    %rbx,%rax
+  80517f:	ff d0                	call   *%rax
+  805181:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  805186:	7e 07                	jle    80518f <remove+0x4a>
+		return -E_BAD_PATH;
+  805188:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80518d:	eb 44                	jmp    8051d3 <remove+0x8e>
+	strcpy(fsipcbuf.remove.req_path, path);
+  80518f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805193:	48 89 c6             	mov    %rax,%rsi
+  805196:	48 b8 c0 3f 01 00 00 	movabs $0x13fc0,%rax
+  80519d:	00 00 00 
+  8051a0:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051a4:	48 89 c7             	mov    %rax,%rdi
+  8051a7:	49 89 df             	mov    %rbx,%r15
+  8051aa:	48 b8 cf 85 ff ff ff 	movabs $0xffffffffffff85cf,%rax
+  8051b1:	ff ff ff 
+  8051b4:	48 01 d8             	add    %rbx,%rax
+  8051b7:	ff d0                	call   *%rax
+	return fsipc(FSREQ_REMOVE, NULL);
+  8051b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8051be:	bf 07 00 00 00       	mov    $0x7,%edi
+  8051c3:	48 b8 8b b9 ff ff ff 	movabs $0xffffffffffffb98b,%rax
+  8051ca:	ff ff ff 
+  8051cd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8051d1:	ff d0                	call   *%rax
+}
+  8051d3:	48 83 c4 10          	add    $0x10,%rsp
+  8051d7:	5b                   	pop    %rbx
+  8051d8:	41 5f                	pop    %r15
+  8051da:	5d                   	pop    %rbp
+  8051db:	c3                   	ret
+
+00000000008051dc <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8051dc:	55                   	push   %rbp
+  8051dd:	48 89 e5             	mov    %rsp,%rbp
+  8051e0:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8051e0 <sync+0x4>
+  8051e7:	49 bb 60 3e 00 00 00 	movabs $0x3e60,%r11
+  8051ee:	00 00 00 
+  8051f1:	4c 01 d8             	add    %r11,%rax
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc_words(FSREQ_SYNC, NULL, 0);
+  8051f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8051fe:	bf 08 00 00 00       	mov    $0x8,%edi
+  805203:	48 b9 33 ba ff ff ff 	movabs $0xffffffffffffba33,%rcx
+  80520a:	ff ff ff 
+  80520d:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805211:	ff d0                	call   *%rax
+}
+  805213:	5d                   	pop    %rbp
+  805214:	c3                   	ret
+
+0000000000805215 <copy>:
+
+//Copy a file from src to dest
+int
+copy(char *src, char *dest)
+{
+  805215:	55                   	push   %rbp
+  805216:	48 89 e5             	mov    %rsp,%rbp
+  805219:	41 57                	push   %r15
+  80521b:	53                   	push   %rbx
+  80521c:	48 81 ec 20 02 00 00 	sub    $0x220,%rsp
+  805223:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805223 <copy+0xe>
+  80522a:	49 bb 1d 3e 00 00 00 	movabs $0x3e1d,%r11
+  805231:	00 00 00 
+  805234:	4c 01 db             	add    %r11,%rbx
+  805237:	48 89 bd d8 fd ff ff 	mov    %rdi,-0x228(%rbp)
+  80523e:	48 89 b5 d0 fd ff ff 	mov    %rsi,-0x230(%rbp)
+	int r;
+	int fd_src, fd_dest;
+	char buffer[512];	//keep this small
+	ssize_t read_size;
+	ssize_t write_size;
+	fd_src = open(src, O_RDONLY);
+  805245:	48 8b 85 d8 fd ff ff 	mov    -0x228(%rbp),%rax
+  80524c:	be 00 00 00 00       	mov    $0x0,%esi
+  805251:	48 89 c7             	mov    %rax,%rdi
+  805254:	48 b8 d2 bb ff ff ff 	movabs $0xffffffffffffbbd2,%rax
+  80525b:	ff ff ff 
+  80525e:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805262:	ff d0                	call   *%rax
+  805264:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (fd_src < 0) {	//error
+  805267:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80526b:	79 35                	jns    8052a2 <copy+0x8d>
+		cprintf("cp open src error:%e\n", fd_src);
+  80526d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805270:	89 c6                	mov    %eax,%esi
+  805272:	48 b8 56 e5 ff ff ff 	movabs $0xffffffffffffe556,%rax
+  805279:	ff ff ff 
+  80527c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805280:	48 89 c7             	mov    %rax,%rdi
+  805283:	49 89 df             	mov    %rbx,%r15
+  805286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80528b:	48 ba 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rdx
+  805292:	ff ff ff 
+  805295:	48 01 da             	add    %rbx,%rdx
+  805298:	ff d2                	call   *%rdx
+		return fd_src;
+  80529a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80529d:	e9 d7 01 00 00       	jmp    805479 <copy+0x264>
+	}
+	
+	fd_dest = open(dest, O_CREAT | O_WRONLY);
+  8052a2:	48 8b 85 d0 fd ff ff 	mov    -0x230(%rbp),%rax
+  8052a9:	be 01 01 00 00       	mov    $0x101,%esi
+  8052ae:	48 89 c7             	mov    %rax,%rdi
+  8052b1:	48 b8 d2 bb ff ff ff 	movabs $0xffffffffffffbbd2,%rax
+  8052b8:	ff ff ff 
+  8052bb:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052bf:	ff d0                	call   *%rax
+  8052c1:	89 45 e8             	mov    %eax,-0x18(%rbp)
+	if (fd_dest < 0) {	//error
+  8052c4:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8052c8:	0f 89 df 00 00 00    	jns    8053ad <copy+0x198>
+		cprintf("cp create dest  error:%e\n", fd_dest);
+  8052ce:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8052d1:	89 c6                	mov    %eax,%esi
+  8052d3:	48 b8 6c e5 ff ff ff 	movabs $0xffffffffffffe56c,%rax
+  8052da:	ff ff ff 
+  8052dd:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8052e1:	48 89 c7             	mov    %rax,%rdi
+  8052e4:	49 89 df             	mov    %rbx,%r15
+  8052e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052ec:	48 ba 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rdx
+  8052f3:	ff ff ff 
+  8052f6:	48 01 da             	add    %rbx,%rdx
+  8052f9:	ff d2                	call   *%rdx
+		close(fd_src);
+  8052fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052fe:	89 c7                	mov    %eax,%edi
+  805300:	49 89 df             	mov    %rbx,%r15
+  805303:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  80530a:	ff ff ff 
+  80530d:	48 01 d8             	add    %rbx,%rax
+  805310:	ff d0                	call   *%rax
+		return fd_dest;
+  805312:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805315:	e9 5f 01 00 00       	jmp    805479 <copy+0x264>
+	}
+	
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+		write_size = write(fd_dest, buffer, read_size);
+  80531a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80531d:	48 63 d0             	movslq %eax,%rdx
+  805320:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  805327:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80532a:	48 89 ce             	mov    %rcx,%rsi
+  80532d:	89 c7                	mov    %eax,%edi
+  80532f:	49 89 df             	mov    %rbx,%r15
+  805332:	48 b8 a9 b5 ff ff ff 	movabs $0xffffffffffffb5a9,%rax
+  805339:	ff ff ff 
+  80533c:	48 01 d8             	add    %rbx,%rax
+  80533f:	ff d0                	call   *%rax
+  805341:	89 45 e0             	mov    %eax,-0x20(%rbp)
+		if (write_size < 0) {
+  805344:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  805348:	79 63                	jns    8053ad <copy+0x198>
+			cprintf("cp write error:%e\n", write_size);
+  80534a:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80534d:	89 c6                	mov    %eax,%esi
+  80534f:	48 b8 86 e5 ff ff ff 	movabs $0xffffffffffffe586,%rax
+  805356:	ff ff ff 
+  805359:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80535d:	48 89 c7             	mov    %rax,%rdi
+  805360:	49 89 df             	mov    %rbx,%r15
+  805363:	b8 00 00 00 00       	mov    $0x0,%eax
+  805368:	48 ba 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rdx
+  80536f:	ff ff ff 
+  805372:	48 01 da             	add    %rbx,%rdx
+  805375:	ff d2                	call   *%rdx
+			close(fd_src);
+  805377:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80537a:	89 c7                	mov    %eax,%edi
+  80537c:	49 89 df             	mov    %rbx,%r15
+  80537f:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  805386:	ff ff ff 
+  805389:	48 01 d8             	add    %rbx,%rax
+  80538c:	ff d0                	call   *%rax
+			close(fd_dest);
+  80538e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805391:	89 c7                	mov    %eax,%edi
+  805393:	49 89 df             	mov    %rbx,%r15
+  805396:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  80539d:	ff ff ff 
+  8053a0:	48 01 d8             	add    %rbx,%rax
+  8053a3:	ff d0                	call   *%rax
+			return write_size;
+  8053a5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8053a8:	e9 cc 00 00 00       	jmp    805479 <copy+0x264>
+	while ((read_size = read(fd_src, buffer, 512)) > 0) {
+  8053ad:	48 8d 8d e0 fd ff ff 	lea    -0x220(%rbp),%rcx
+  8053b4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053b7:	ba 00 02 00 00       	mov    $0x200,%edx
+  8053bc:	48 89 ce             	mov    %rcx,%rsi
+  8053bf:	89 c7                	mov    %eax,%edi
+  8053c1:	49 89 df             	mov    %rbx,%r15
+  8053c4:	48 b8 03 b4 ff ff ff 	movabs $0xffffffffffffb403,%rax
+  8053cb:	ff ff ff 
+  8053ce:	48 01 d8             	add    %rbx,%rax
+  8053d1:	ff d0                	call   *%rax
+  8053d3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  8053d6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8053da:	0f 8f 3a ff ff ff    	jg     80531a <copy+0x105>
+		}		
+	}
+	if (read_size < 0) {
+  8053e0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8053e4:	79 60                	jns    805446 <copy+0x231>
+		cprintf("cp read src error:%e\n", read_size);
+  8053e6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8053e9:	89 c6                	mov    %eax,%esi
+  8053eb:	48 b8 99 e5 ff ff ff 	movabs $0xffffffffffffe599,%rax
+  8053f2:	ff ff ff 
+  8053f5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8053f9:	48 89 c7             	mov    %rax,%rdi
+  8053fc:	49 89 df             	mov    %rbx,%r15
+  8053ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  805404:	48 ba 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%rdx
+  80540b:	ff ff ff 
+  80540e:	48 01 da             	add    %rbx,%rdx
+  805411:	ff d2                	call   *%rdx
+		close(fd_src);
+  805413:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805416:	89 c7                	mov    %eax,%edi
+  805418:	49 89 df             	mov    %rbx,%r15
+  80541b:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  805422:	ff ff ff 
+  805425:	48 01 d8             	add    %rbx,%rax
+  805428:	ff d0                	call   *%rax
+		close(fd_dest);
+  80542a:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80542d:	89 c7                	mov    %eax,%edi
+  80542f:	49 89 df             	mov    %rbx,%r15
+  805432:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  805439:	ff ff ff 
+  80543c:	48 01 d8             	add    %rbx,%rax
+  80543f:	ff d0                	call   *%rax
+		return read_size;
+  805441:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805444:	eb 33                	jmp    805479 <copy+0x264>
+	}
+	close(fd_src);
+  805446:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805449:	89 c7                	mov    %eax,%edi
+  80544b:	49 89 df             	mov    %rbx,%r15
+  80544e:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  805455:	ff ff ff 
+  805458:	48 01 d8             	add    %rbx,%rax
+  80545b:	ff d0                	call   *%rax
+	close(fd_dest);
+  80545d:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805460:	89 c7                	mov    %eax,%edi
+  805462:	49 89 df             	mov    %rbx,%r15
+  805465:	48 b8 4b b1 ff ff ff 	movabs $0xffffffffffffb14b,%rax
+  80546c:	ff ff ff 
+  80546f:	48 01 d8             	add    %rbx,%rax
+  805472:	ff d0                	call   *%rax
+	return 0;
+  805474:	b8 00 00 00 00       	mov    $0x0,%eax
+	
+}
+  805479:	48 81 c4 20 02 00 00 	add    $0x220,%rsp
+  805480:	5b                   	pop    %rbx
+  805481:	41 5f                	pop    %r15
+  805483:	5d                   	pop    %rbp
+  805484:	c3                   	ret
+
+0000000000805485 <fd2sockid>:
+	.dev_stat =	devsock_stat,
+};
+
+static int
+fd2sockid(int fd)
+{
+  805485:	55                   	push   %rbp
+  805486:	48 89 e5             	mov    %rsp,%rbp
+  805489:	41 57                	push   %r15
+  80548b:	53                   	push   %rbx
+  80548c:	48 83 ec 20          	sub    $0x20,%rsp
+  805490:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805490 <fd2sockid+0xb>
+  805497:	49 bb b0 3b 00 00 00 	movabs $0x3bb0,%r11
+  80549e:	00 00 00 
+  8054a1:	4c 01 db             	add    %r11,%rbx
+  8054a4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8054a7:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8054ab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8054ae:	48 89 d6             	mov    %rdx,%rsi
+  8054b1:	89 c7                	mov    %eax,%edi
+  8054b3:	49 89 df             	mov    %rbx,%r15
+  8054b6:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  8054bd:	ff ff ff 
+  8054c0:	48 01 d8             	add    %rbx,%rax
+  8054c3:	ff d0                	call   *%rax
+  8054c5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054c8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054cc:	79 05                	jns    8054d3 <fd2sockid+0x4e>
+		return r;
+  8054ce:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054d1:	eb 25                	jmp    8054f8 <fd2sockid+0x73>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8054d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054d7:	8b 10                	mov    (%rax),%edx
+  8054d9:	48 b8 80 00 00 00 00 	movabs $0x80,%rax
+  8054e0:	00 00 00 
+  8054e3:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8054e6:	39 c2                	cmp    %eax,%edx
+  8054e8:	74 07                	je     8054f1 <fd2sockid+0x6c>
+		return -E_NOT_SUPP;
+  8054ea:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8054ef:	eb 07                	jmp    8054f8 <fd2sockid+0x73>
+	return sfd->fd_sock.sockid;
+  8054f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054f5:	8b 40 0c             	mov    0xc(%rax),%eax
+}
+  8054f8:	48 83 c4 20          	add    $0x20,%rsp
+  8054fc:	5b                   	pop    %rbx
+  8054fd:	41 5f                	pop    %r15
+  8054ff:	5d                   	pop    %rbp
+  805500:	c3                   	ret
+
+0000000000805501 <alloc_sockfd>:
+
+static int
+alloc_sockfd(int sockid)
+{
+  805501:	55                   	push   %rbp
+  805502:	48 89 e5             	mov    %rsp,%rbp
+  805505:	41 57                	push   %r15
+  805507:	53                   	push   %rbx
+  805508:	48 83 ec 20          	sub    $0x20,%rsp
+  80550c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80550c <alloc_sockfd+0xb>
+  805513:	49 bb 34 3b 00 00 00 	movabs $0x3b34,%r11
+  80551a:	00 00 00 
+  80551d:	4c 01 db             	add    %r11,%rbx
+  805520:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	struct Fd *sfd;
+	int r;
+
+	if ((r = fd_alloc(&sfd)) < 0
+  805523:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  805527:	48 89 c7             	mov    %rax,%rdi
+  80552a:	49 89 df             	mov    %rbx,%r15
+  80552d:	48 b8 06 ae ff ff ff 	movabs $0xffffffffffffae06,%rax
+  805534:	ff ff ff 
+  805537:	48 01 d8             	add    %rbx,%rax
+  80553a:	ff d0                	call   *%rax
+  80553c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80553f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805543:	78 2c                	js     805571 <alloc_sockfd+0x70>
+            || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  805545:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805549:	ba 07 04 00 00       	mov    $0x407,%edx
+  80554e:	48 89 c6             	mov    %rax,%rsi
+  805551:	bf 00 00 00 00       	mov    $0x0,%edi
+  805556:	49 89 df             	mov    %rbx,%r15
+  805559:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  805560:	ff ff ff 
+  805563:	48 01 d8             	add    %rbx,%rax
+  805566:	ff d0                	call   *%rax
+  805568:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80556b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80556f:	79 1c                	jns    80558d <alloc_sockfd+0x8c>
+		nsipc_close(sockid);
+  805571:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805574:	89 c7                	mov    %eax,%edi
+  805576:	49 89 df             	mov    %rbx,%r15
+  805579:	48 b8 b5 cc ff ff ff 	movabs $0xffffffffffffccb5,%rax
+  805580:	ff ff ff 
+  805583:	48 01 d8             	add    %rbx,%rax
+  805586:	ff d0                	call   *%rax
+		return r;
+  805588:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80558b:	eb 41                	jmp    8055ce <alloc_sockfd+0xcd>
+	}
+
+	sfd->fd_dev_id = devsock.dev_id;
+  80558d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805591:	48 ba 80 00 00 00 00 	movabs $0x80,%rdx
+  805598:	00 00 00 
+  80559b:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  80559e:	89 10                	mov    %edx,(%rax)
+	sfd->fd_omode = O_RDWR;
+  8055a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055a4:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	sfd->fd_sock.sockid = sockid;
+  8055ab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055af:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8055b2:	89 50 0c             	mov    %edx,0xc(%rax)
+	return fd2num(sfd);
+  8055b5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055b9:	48 89 c7             	mov    %rax,%rdi
+  8055bc:	49 89 df             	mov    %rbx,%r15
+  8055bf:	48 b8 8c ad ff ff ff 	movabs $0xffffffffffffad8c,%rax
+  8055c6:	ff ff ff 
+  8055c9:	48 01 d8             	add    %rbx,%rax
+  8055cc:	ff d0                	call   *%rax
+}
+  8055ce:	48 83 c4 20          	add    $0x20,%rsp
+  8055d2:	5b                   	pop    %rbx
+  8055d3:	41 5f                	pop    %r15
+  8055d5:	5d                   	pop    %rbp
+  8055d6:	c3                   	ret
+
+00000000008055d7 <accept>:
+
+int
+accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8055d7:	55                   	push   %rbp
+  8055d8:	48 89 e5             	mov    %rsp,%rbp
+  8055db:	41 57                	push   %r15
+  8055dd:	53                   	push   %rbx
+  8055de:	48 83 ec 30          	sub    $0x30,%rsp
+  8055e2:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8055e2 <accept+0xb>
+  8055e9:	49 bb 5e 3a 00 00 00 	movabs $0x3a5e,%r11
+  8055f0:	00 00 00 
+  8055f3:	4c 01 db             	add    %r11,%rbx
+  8055f6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8055f9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8055fd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  805601:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805604:	89 c7                	mov    %eax,%edi
+  805606:	48 b8 45 c4 ff ff ff 	movabs $0xffffffffffffc445,%rax
+  80560d:	ff ff ff 
+  805610:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805614:	ff d0                	call   *%rax
+  805616:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805619:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80561d:	79 05                	jns    805624 <accept+0x4d>
+		return r;
+  80561f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805622:	eb 45                	jmp    805669 <accept+0x92>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  805624:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805628:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80562c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80562f:	48 89 ce             	mov    %rcx,%rsi
+  805632:	89 c7                	mov    %eax,%edi
+  805634:	49 89 df             	mov    %rbx,%r15
+  805637:	48 b8 23 cb ff ff ff 	movabs $0xffffffffffffcb23,%rax
+  80563e:	ff ff ff 
+  805641:	48 01 d8             	add    %rbx,%rax
+  805644:	ff d0                	call   *%rax
+  805646:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805649:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80564d:	79 05                	jns    805654 <accept+0x7d>
+		return r;
+  80564f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805652:	eb 15                	jmp    805669 <accept+0x92>
+	return alloc_sockfd(r);
+  805654:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805657:	89 c7                	mov    %eax,%edi
+  805659:	48 b8 c1 c4 ff ff ff 	movabs $0xffffffffffffc4c1,%rax
+  805660:	ff ff ff 
+  805663:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805667:	ff d0                	call   *%rax
+}
+  805669:	48 83 c4 30          	add    $0x30,%rsp
+  80566d:	5b                   	pop    %rbx
+  80566e:	41 5f                	pop    %r15
+  805670:	5d                   	pop    %rbp
+  805671:	c3                   	ret
+
+0000000000805672 <bind>:
+
+int
+bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805672:	55                   	push   %rbp
+  805673:	48 89 e5             	mov    %rsp,%rbp
+  805676:	41 57                	push   %r15
+  805678:	53                   	push   %rbx
+  805679:	48 83 ec 20          	sub    $0x20,%rsp
+  80567d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 80567d <bind+0xb>
+  805684:	49 bb c3 39 00 00 00 	movabs $0x39c3,%r11
+  80568b:	00 00 00 
+  80568e:	4c 01 db             	add    %r11,%rbx
+  805691:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805694:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805698:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80569b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80569e:	89 c7                	mov    %eax,%edi
+  8056a0:	48 b8 45 c4 ff ff ff 	movabs $0xffffffffffffc445,%rax
+  8056a7:	ff ff ff 
+  8056aa:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8056ae:	ff d0                	call   *%rax
+  8056b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8056b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8056b7:	79 05                	jns    8056be <bind+0x4c>
+		return r;
+  8056b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056bc:	eb 21                	jmp    8056df <bind+0x6d>
+	return nsipc_bind(r, name, namelen);
+  8056be:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8056c1:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8056c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056c8:	48 89 ce             	mov    %rcx,%rsi
+  8056cb:	89 c7                	mov    %eax,%edi
+  8056cd:	49 89 df             	mov    %rbx,%r15
+  8056d0:	48 b8 cf cb ff ff ff 	movabs $0xffffffffffffcbcf,%rax
+  8056d7:	ff ff ff 
+  8056da:	48 01 d8             	add    %rbx,%rax
+  8056dd:	ff d0                	call   *%rax
+}
+  8056df:	48 83 c4 20          	add    $0x20,%rsp
+  8056e3:	5b                   	pop    %rbx
+  8056e4:	41 5f                	pop    %r15
+  8056e6:	5d                   	pop    %rbp
+  8056e7:	c3                   	ret
+
+00000000008056e8 <shutdown>:
+
+int
+shutdown(int s, int how)
+{
+  8056e8:	55                   	push   %rbp
+  8056e9:	48 89 e5             	mov    %rsp,%rbp
+  8056ec:	41 57                	push   %r15
+  8056ee:	53                   	push   %rbx
+  8056ef:	48 83 ec 20          	sub    $0x20,%rsp
+  8056f3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8056f3 <shutdown+0xb>
+  8056fa:	49 bb 4d 39 00 00 00 	movabs $0x394d,%r11
+  805701:	00 00 00 
+  805704:	4c 01 db             	add    %r11,%rbx
+  805707:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80570a:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80570d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805710:	89 c7                	mov    %eax,%edi
+  805712:	48 b8 45 c4 ff ff ff 	movabs $0xffffffffffffc445,%rax
+  805719:	ff ff ff 
+  80571c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805720:	ff d0                	call   *%rax
+  805722:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805725:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805729:	79 05                	jns    805730 <shutdown+0x48>
+		return r;
+  80572b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80572e:	eb 1c                	jmp    80574c <shutdown+0x64>
+	return nsipc_shutdown(r, how);
+  805730:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805733:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805736:	89 d6                	mov    %edx,%esi
+  805738:	89 c7                	mov    %eax,%edi
+  80573a:	49 89 df             	mov    %rbx,%r15
+  80573d:	48 b8 64 cc ff ff ff 	movabs $0xffffffffffffcc64,%rax
+  805744:	ff ff ff 
+  805747:	48 01 d8             	add    %rbx,%rax
+  80574a:	ff d0                	call   *%rax
+}
+  80574c:	48 83 c4 20          	add    $0x20,%rsp
+  805750:	5b                   	pop    %rbx
+  805751:	41 5f                	pop    %r15
+  805753:	5d                   	pop    %rbp
+  805754:	c3                   	ret
+
+0000000000805755 <devsock_close>:
+
+static int
+devsock_close(struct Fd *fd)
+{
+  805755:	55                   	push   %rbp
+  805756:	48 89 e5             	mov    %rsp,%rbp
+  805759:	41 57                	push   %r15
+  80575b:	53                   	push   %rbx
+  80575c:	48 83 ec 10          	sub    $0x10,%rsp
+  805760:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805760 <devsock_close+0xb>
+  805767:	49 bb e0 38 00 00 00 	movabs $0x38e0,%r11
+  80576e:	00 00 00 
+  805771:	4c 01 db             	add    %r11,%rbx
+  805774:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	if (pageref(fd) == 1)
+  805778:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80577c:	48 89 c7             	mov    %rax,%rdi
+  80577f:	49 89 df             	mov    %rbx,%r15
+  805782:	48 b8 17 de ff ff ff 	movabs $0xffffffffffffde17,%rax
+  805789:	ff ff ff 
+  80578c:	48 01 d8             	add    %rbx,%rax
+  80578f:	ff d0                	call   *%rax
+  805791:	83 f8 01             	cmp    $0x1,%eax
+  805794:	75 1d                	jne    8057b3 <devsock_close+0x5e>
+		return nsipc_close(fd->fd_sock.sockid);
+  805796:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80579a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80579d:	89 c7                	mov    %eax,%edi
+  80579f:	49 89 df             	mov    %rbx,%r15
+  8057a2:	48 b8 b5 cc ff ff ff 	movabs $0xffffffffffffccb5,%rax
+  8057a9:	ff ff ff 
+  8057ac:	48 01 d8             	add    %rbx,%rax
+  8057af:	ff d0                	call   *%rax
+  8057b1:	eb 05                	jmp    8057b8 <devsock_close+0x63>
+	else
+		return 0;
+  8057b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057b8:	48 83 c4 10          	add    $0x10,%rsp
+  8057bc:	5b                   	pop    %rbx
+  8057bd:	41 5f                	pop    %r15
+  8057bf:	5d                   	pop    %rbp
+  8057c0:	c3                   	ret
+
+00000000008057c1 <connect>:
+
+int
+connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8057c1:	55                   	push   %rbp
+  8057c2:	48 89 e5             	mov    %rsp,%rbp
+  8057c5:	41 57                	push   %r15
+  8057c7:	53                   	push   %rbx
+  8057c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8057cc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8057cc <connect+0xb>
+  8057d3:	49 bb 74 38 00 00 00 	movabs $0x3874,%r11
+  8057da:	00 00 00 
+  8057dd:	4c 01 db             	add    %r11,%rbx
+  8057e0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8057e3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8057e7:	89 55 d8             	mov    %edx,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  8057ea:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8057ed:	89 c7                	mov    %eax,%edi
+  8057ef:	48 b8 45 c4 ff ff ff 	movabs $0xffffffffffffc445,%rax
+  8057f6:	ff ff ff 
+  8057f9:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8057fd:	ff d0                	call   *%rax
+  8057ff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805802:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805806:	79 05                	jns    80580d <connect+0x4c>
+		return r;
+  805808:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80580b:	eb 21                	jmp    80582e <connect+0x6d>
+	return nsipc_connect(r, name, namelen);
+  80580d:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805810:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805814:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805817:	48 89 ce             	mov    %rcx,%rsi
+  80581a:	89 c7                	mov    %eax,%edi
+  80581c:	49 89 df             	mov    %rbx,%r15
+  80581f:	48 b8 fd cc ff ff ff 	movabs $0xffffffffffffccfd,%rax
+  805826:	ff ff ff 
+  805829:	48 01 d8             	add    %rbx,%rax
+  80582c:	ff d0                	call   *%rax
+}
+  80582e:	48 83 c4 20          	add    $0x20,%rsp
+  805832:	5b                   	pop    %rbx
+  805833:	41 5f                	pop    %r15
+  805835:	5d                   	pop    %rbp
+  805836:	c3                   	ret
+
+0000000000805837 <listen>:
+
+int
+listen(int s, int backlog)
+{
+  805837:	55                   	push   %rbp
+  805838:	48 89 e5             	mov    %rsp,%rbp
+  80583b:	41 57                	push   %r15
+  80583d:	53                   	push   %rbx
+  80583e:	48 83 ec 20          	sub    $0x20,%rsp
+  805842:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805842 <listen+0xb>
+  805849:	49 bb fe 37 00 00 00 	movabs $0x37fe,%r11
+  805850:	00 00 00 
+  805853:	4c 01 db             	add    %r11,%rbx
+  805856:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805859:	89 75 d8             	mov    %esi,-0x28(%rbp)
+	int r;
+	if ((r = fd2sockid(s)) < 0)
+  80585c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80585f:	89 c7                	mov    %eax,%edi
+  805861:	48 b8 45 c4 ff ff ff 	movabs $0xffffffffffffc445,%rax
+  805868:	ff ff ff 
+  80586b:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80586f:	ff d0                	call   *%rax
+  805871:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805874:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805878:	79 05                	jns    80587f <listen+0x48>
+		return r;
+  80587a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80587d:	eb 1c                	jmp    80589b <listen+0x64>
+	return nsipc_listen(r, backlog);
+  80587f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  805882:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805885:	89 d6                	mov    %edx,%esi
+  805887:	89 c7                	mov    %eax,%edi
+  805889:	49 89 df             	mov    %rbx,%r15
+  80588c:	48 b8 92 cd ff ff ff 	movabs $0xffffffffffffcd92,%rax
+  805893:	ff ff ff 
+  805896:	48 01 d8             	add    %rbx,%rax
+  805899:	ff d0                	call   *%rax
+}
+  80589b:	48 83 c4 20          	add    $0x20,%rsp
+  80589f:	5b                   	pop    %rbx
+  8058a0:	41 5f                	pop    %r15
+  8058a2:	5d                   	pop    %rbp
+  8058a3:	c3                   	ret
+
+00000000008058a4 <devsock_read>:
+
+static ssize_t
+devsock_read(struct Fd *fd, void *buf, size_t n)
+{
+  8058a4:	55                   	push   %rbp
+  8058a5:	48 89 e5             	mov    %rsp,%rbp
+  8058a8:	41 57                	push   %r15
+  8058aa:	48 83 ec 28          	sub    $0x28,%rsp
+  8058ae:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 8058ae <devsock_read+0xa>
+  8058b5:	49 bb 92 37 00 00 00 	movabs $0x3792,%r11
+  8058bc:	00 00 00 
+  8058bf:	4c 01 d8             	add    %r11,%rax
+  8058c2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8058c6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8058ca:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8058ce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8058d2:	41 89 d0             	mov    %edx,%r8d
+  8058d5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8058d9:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  8058dc:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8058e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8058e5:	44 89 c2             	mov    %r8d,%edx
+  8058e8:	49 89 c7             	mov    %rax,%r15
+  8058eb:	49 b8 e3 cd ff ff ff 	movabs $0xffffffffffffcde3,%r8
+  8058f2:	ff ff ff 
+  8058f5:	49 01 c0             	add    %rax,%r8
+  8058f8:	41 ff d0             	call   *%r8
+}
+  8058fb:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8058ff:	c9                   	leave
+  805900:	c3                   	ret
+
+0000000000805901 <devsock_write>:
+
+static ssize_t
+devsock_write(struct Fd *fd, const void *buf, size_t n)
+{
+  805901:	55                   	push   %rbp
+  805902:	48 89 e5             	mov    %rsp,%rbp
+  805905:	41 57                	push   %r15
+  805907:	48 83 ec 28          	sub    $0x28,%rsp
+  80590b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80590b <devsock_write+0xa>
+  805912:	49 bb 35 37 00 00 00 	movabs $0x3735,%r11
+  805919:	00 00 00 
+  80591c:	4c 01 d8             	add    %r11,%rax
+  80591f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805923:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805927:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  80592b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80592f:	41 89 d0             	mov    %edx,%r8d
+  805932:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805936:	8b 7a 0c             	mov    0xc(%rdx),%edi
+  805939:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80593d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805942:	44 89 c2             	mov    %r8d,%edx
+  805945:	49 89 c7             	mov    %rax,%r15
+  805948:	49 b8 00 cf ff ff ff 	movabs $0xffffffffffffcf00,%r8
+  80594f:	ff ff ff 
+  805952:	49 01 c0             	add    %rax,%r8
+  805955:	41 ff d0             	call   *%r8
+}
+  805958:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  80595c:	c9                   	leave
+  80595d:	c3                   	ret
+
+000000000080595e <devsock_stat>:
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80595e:	55                   	push   %rbp
+  80595f:	48 89 e5             	mov    %rsp,%rbp
+  805962:	41 57                	push   %r15
+  805964:	48 83 ec 18          	sub    $0x18,%rsp
+  805968:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805968 <devsock_stat+0xa>
+  80596f:	49 bb d8 36 00 00 00 	movabs $0x36d8,%r11
+  805976:	00 00 00 
+  805979:	4c 01 d8             	add    %r11,%rax
+  80597c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805980:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<sock>");
+  805984:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805988:	48 b9 b4 e5 ff ff ff 	movabs $0xffffffffffffe5b4,%rcx
+  80598f:	ff ff ff 
+  805992:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  805996:	48 89 ce             	mov    %rcx,%rsi
+  805999:	48 89 d7             	mov    %rdx,%rdi
+  80599c:	49 89 c7             	mov    %rax,%r15
+  80599f:	48 ba cf 85 ff ff ff 	movabs $0xffffffffffff85cf,%rdx
+  8059a6:	ff ff ff 
+  8059a9:	48 01 c2             	add    %rax,%rdx
+  8059ac:	ff d2                	call   *%rdx
+	return 0;
+  8059ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059b3:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8059b7:	c9                   	leave
+  8059b8:	c3                   	ret
+
+00000000008059b9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8059b9:	55                   	push   %rbp
+  8059ba:	48 89 e5             	mov    %rsp,%rbp
+  8059bd:	41 57                	push   %r15
+  8059bf:	53                   	push   %rbx
+  8059c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8059c4:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8059c4 <socket+0xb>
+  8059cb:	49 bb 7c 36 00 00 00 	movabs $0x367c,%r11
+  8059d2:	00 00 00 
+  8059d5:	4c 01 db             	add    %r11,%rbx
+  8059d8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8059db:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  8059de:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8059e1:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8059e4:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8059e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8059ea:	89 ce                	mov    %ecx,%esi
+  8059ec:	89 c7                	mov    %eax,%edi
+  8059ee:	49 89 df             	mov    %rbx,%r15
+  8059f1:	48 b8 d7 d0 ff ff ff 	movabs $0xffffffffffffd0d7,%rax
+  8059f8:	ff ff ff 
+  8059fb:	48 01 d8             	add    %rbx,%rax
+  8059fe:	ff d0                	call   *%rax
+  805a00:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a03:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a07:	79 05                	jns    805a0e <socket+0x55>
+		return r;
+  805a09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a0c:	eb 15                	jmp    805a23 <socket+0x6a>
+	return alloc_sockfd(r);
+  805a0e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a11:	89 c7                	mov    %eax,%edi
+  805a13:	48 b8 c1 c4 ff ff ff 	movabs $0xffffffffffffc4c1,%rax
+  805a1a:	ff ff ff 
+  805a1d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805a21:	ff d0                	call   *%rax
+}
+  805a23:	48 83 c4 20          	add    $0x20,%rsp
+  805a27:	5b                   	pop    %rbx
+  805a28:	41 5f                	pop    %r15
+  805a2a:	5d                   	pop    %rbp
+  805a2b:	c3                   	ret
+
+0000000000805a2c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  805a2c:	55                   	push   %rbp
+  805a2d:	48 89 e5             	mov    %rsp,%rbp
+  805a30:	41 57                	push   %r15
+  805a32:	53                   	push   %rbx
+  805a33:	48 83 ec 10          	sub    $0x10,%rsp
+  805a37:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805a37 <nsipc+0xb>
+  805a3e:	49 bb 09 36 00 00 00 	movabs $0x3609,%r11
+  805a45:	00 00 00 
+  805a48:	4c 01 db             	add    %r11,%rbx
+  805a4b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	if (nsenv == 0)
+  805a4e:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805a55:	00 00 00 
+  805a58:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805a5b:	85 c0                	test   %eax,%eax
+  805a5d:	75 24                	jne    805a83 <nsipc+0x57>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805a5f:	bf 02 00 00 00       	mov    $0x2,%edi
+  805a64:	49 89 df             	mov    %rbx,%r15
+  805a67:	48 b8 fd ac ff ff ff 	movabs $0xffffffffffffacfd,%rax
+  805a6e:	ff ff ff 
+  805a71:	48 01 d8             	add    %rbx,%rax
+  805a74:	ff d0                	call   *%rax
+  805a76:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805a7d:	00 00 00 
+  805a80:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	return ipc_call(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U, NULL, NULL);
+  805a83:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805a8a:	00 00 00 
+  805a8d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805a90:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805a93:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805a99:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805a9f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  805aa4:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805aab:	00 00 00 
+  805aae:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  805ab2:	89 c7                	mov    %eax,%edi
+  805ab4:	49 89 df             	mov    %rbx,%r15
+  805ab7:	48 b8 1c a7 ff ff ff 	movabs $0xffffffffffffa71c,%rax
+  805abe:	ff ff ff 
+  805ac1:	48 01 d8             	add    %rbx,%rax
+  805ac4:	ff d0                	call   *%rax
+}
+  805ac6:	48 83 c4 10          	add    $0x10,%rsp
+  805aca:	5b                   	pop    %rbx
+  805acb:	41 5f                	pop    %r15
+  805acd:	5d                   	pop    %rbp
+  805ace:	c3                   	ret
+
+0000000000805acf <nsipc_words>:
+// Like nsipc, for requests that return nothing but the result: the
+// 'len' byte request at 'req' is passed in registers rather than in
+// nsipcbuf, saving the network server a buffer and a page mapping.
+static int
+nsipc_words(unsigned type, const void *req, size_t len)
+{
+  805acf:	55                   	push   %rbp
+  805ad0:	48 89 e5             	mov    %rsp,%rbp
+  805ad3:	41 57                	push   %r15
+  805ad5:	53                   	push   %rbx
+  805ad6:	48 83 ec 20          	sub    $0x20,%rsp
+  805ada:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805ada <nsipc_words+0xb>
+  805ae1:	49 bb 66 35 00 00 00 	movabs $0x3566,%r11
+  805ae8:	00 00 00 
+  805aeb:	4c 01 db             	add    %r11,%rbx
+  805aee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805af1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805af5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+	if (nsenv == 0)
+  805af9:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805b00:	00 00 00 
+  805b03:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b06:	85 c0                	test   %eax,%eax
+  805b08:	75 24                	jne    805b2e <nsipc_words+0x5f>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805b0a:	bf 02 00 00 00       	mov    $0x2,%edi
+  805b0f:	49 89 df             	mov    %rbx,%r15
+  805b12:	48 b8 fd ac ff ff ff 	movabs $0xffffffffffffacfd,%rax
+  805b19:	ff ff ff 
+  805b1c:	48 01 d8             	add    %rbx,%rax
+  805b1f:	ff d0                	call   *%rax
+  805b21:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805b28:	00 00 00 
+  805b2b:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	if (debug)
+		cprintf("[%08x] nsipc_words %d\n", thisenv->env_id, type);
+
+	return ipc_callw(nsenv, type, req, len);
+  805b2e:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805b35:	00 00 00 
+  805b38:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805b3b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  805b3f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805b43:	8b 75 ec             	mov    -0x14(%rbp),%esi
+  805b46:	89 c7                	mov    %eax,%edi
+  805b48:	49 89 df             	mov    %rbx,%r15
+  805b4b:	48 b8 07 a8 ff ff ff 	movabs $0xffffffffffffa807,%rax
+  805b52:	ff ff ff 
+  805b55:	48 01 d8             	add    %rbx,%rax
+  805b58:	ff d0                	call   *%rax
+}
+  805b5a:	48 83 c4 20          	add    $0x20,%rsp
+  805b5e:	5b                   	pop    %rbx
+  805b5f:	41 5f                	pop    %r15
+  805b61:	5d                   	pop    %rbp
+  805b62:	c3                   	ret
+
+0000000000805b63 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  805b63:	55                   	push   %rbp
+  805b64:	48 89 e5             	mov    %rsp,%rbp
+  805b67:	41 57                	push   %r15
+  805b69:	53                   	push   %rbx
+  805b6a:	48 83 ec 30          	sub    $0x30,%rsp
+  805b6e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805b6e <nsipc_accept+0xb>
+  805b75:	49 bb d2 34 00 00 00 	movabs $0x34d2,%r11
+  805b7c:	00 00 00 
+  805b7f:	4c 01 db             	add    %r11,%rbx
+  805b82:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805b85:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805b89:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  805b8d:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805b94:	00 00 00 
+  805b97:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805b9a:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  805b9d:	bf 01 00 00 00       	mov    $0x1,%edi
+  805ba2:	48 b8 ec c9 ff ff ff 	movabs $0xffffffffffffc9ec,%rax
+  805ba9:	ff ff ff 
+  805bac:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805bb0:	ff d0                	call   *%rax
+  805bb2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805bb5:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805bb9:	78 48                	js     805c03 <nsipc_accept+0xa0>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+  805bbb:	48 b8 c0 4f 01 00 00 	movabs $0x14fc0,%rax
+  805bc2:	00 00 00 
+  805bc5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805bc9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  805bcd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bd1:	8b 40 10             	mov    0x10(%rax),%eax
+  805bd4:	89 c2                	mov    %eax,%edx
+  805bd6:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805bda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805bde:	48 89 ce             	mov    %rcx,%rsi
+  805be1:	48 89 c7             	mov    %rax,%rdi
+  805be4:	49 89 df             	mov    %rbx,%r15
+  805be7:	48 b8 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rax
+  805bee:	ff ff ff 
+  805bf1:	48 01 d8             	add    %rbx,%rax
+  805bf4:	ff d0                	call   *%rax
+		*addrlen = ret->ret_addrlen;
+  805bf6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805bfa:	8b 50 10             	mov    0x10(%rax),%edx
+  805bfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805c01:	89 10                	mov    %edx,(%rax)
+	}
+	return r;
+  805c03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805c06:	48 83 c4 30          	add    $0x30,%rsp
+  805c0a:	5b                   	pop    %rbx
+  805c0b:	41 5f                	pop    %r15
+  805c0d:	5d                   	pop    %rbp
+  805c0e:	c3                   	ret
+
+0000000000805c0f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  805c0f:	55                   	push   %rbp
+  805c10:	48 89 e5             	mov    %rsp,%rbp
+  805c13:	41 57                	push   %r15
+  805c15:	53                   	push   %rbx
+  805c16:	48 83 ec 10          	sub    $0x10,%rsp
+  805c1a:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805c1a <nsipc_bind+0xb>
+  805c21:	49 bb 26 34 00 00 00 	movabs $0x3426,%r11
+  805c28:	00 00 00 
+  805c2b:	4c 01 db             	add    %r11,%rbx
+  805c2e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c31:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805c35:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.bind.req_s = s;
+  805c38:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c3f:	00 00 00 
+  805c42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c45:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  805c48:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805c4b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c4f:	48 89 c6             	mov    %rax,%rsi
+  805c52:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805c59:	00 00 00 
+  805c5c:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c60:	48 89 c7             	mov    %rax,%rdi
+  805c63:	49 89 df             	mov    %rbx,%r15
+  805c66:	48 b8 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rax
+  805c6d:	ff ff ff 
+  805c70:	48 01 d8             	add    %rbx,%rax
+  805c73:	ff d0                	call   *%rax
+	nsipcbuf.bind.req_namelen = namelen;
+  805c75:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805c7c:	00 00 00 
+  805c7f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805c82:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_BIND);
+  805c86:	bf 02 00 00 00       	mov    $0x2,%edi
+  805c8b:	48 b8 ec c9 ff ff ff 	movabs $0xffffffffffffc9ec,%rax
+  805c92:	ff ff ff 
+  805c95:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805c99:	ff d0                	call   *%rax
+}
+  805c9b:	48 83 c4 10          	add    $0x10,%rsp
+  805c9f:	5b                   	pop    %rbx
+  805ca0:	41 5f                	pop    %r15
+  805ca2:	5d                   	pop    %rbp
+  805ca3:	c3                   	ret
+
+0000000000805ca4 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  805ca4:	55                   	push   %rbp
+  805ca5:	48 89 e5             	mov    %rsp,%rbp
+  805ca8:	48 83 ec 20          	sub    $0x20,%rsp
+  805cac:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805cac <nsipc_shutdown+0x8>
+  805cb3:	49 bb 94 33 00 00 00 	movabs $0x3394,%r11
+  805cba:	00 00 00 
+  805cbd:	4c 01 d8             	add    %r11,%rax
+  805cc0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805cc3:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_shutdown req;
+
+	req.req_s = s;
+  805cc6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805cc9:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_how = how;
+  805ccc:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805ccf:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_SHUTDOWN, &req, sizeof(req));
+  805cd2:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805cd6:	ba 08 00 00 00       	mov    $0x8,%edx
+  805cdb:	48 89 ce             	mov    %rcx,%rsi
+  805cde:	bf 03 00 00 00       	mov    $0x3,%edi
+  805ce3:	48 b9 8f ca ff ff ff 	movabs $0xffffffffffffca8f,%rcx
+  805cea:	ff ff ff 
+  805ced:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805cf1:	ff d0                	call   *%rax
+}
+  805cf3:	c9                   	leave
+  805cf4:	c3                   	ret
+
+0000000000805cf5 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  805cf5:	55                   	push   %rbp
+  805cf6:	48 89 e5             	mov    %rsp,%rbp
+  805cf9:	48 83 ec 20          	sub    $0x20,%rsp
+  805cfd:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805cfd <nsipc_close+0x8>
+  805d04:	49 bb 43 33 00 00 00 	movabs $0x3343,%r11
+  805d0b:	00 00 00 
+  805d0e:	4c 01 d8             	add    %r11,%rax
+  805d11:	89 7d ec             	mov    %edi,-0x14(%rbp)
+	struct Nsreq_close req;
+
+	req.req_s = s;
+  805d14:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805d17:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_CLOSE, &req, sizeof(req));
+  805d1a:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  805d1e:	ba 04 00 00 00       	mov    $0x4,%edx
+  805d23:	48 89 ce             	mov    %rcx,%rsi
+  805d26:	bf 04 00 00 00       	mov    $0x4,%edi
+  805d2b:	48 b9 8f ca ff ff ff 	movabs $0xffffffffffffca8f,%rcx
+  805d32:	ff ff ff 
+  805d35:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805d39:	ff d0                	call   *%rax
+}
+  805d3b:	c9                   	leave
+  805d3c:	c3                   	ret
+
+0000000000805d3d <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  805d3d:	55                   	push   %rbp
+  805d3e:	48 89 e5             	mov    %rsp,%rbp
+  805d41:	41 57                	push   %r15
+  805d43:	53                   	push   %rbx
+  805d44:	48 83 ec 10          	sub    $0x10,%rsp
+  805d48:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805d48 <nsipc_connect+0xb>
+  805d4f:	49 bb f8 32 00 00 00 	movabs $0x32f8,%r11
+  805d56:	00 00 00 
+  805d59:	4c 01 db             	add    %r11,%rbx
+  805d5c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805d5f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805d63:	89 55 e8             	mov    %edx,-0x18(%rbp)
+	nsipcbuf.connect.req_s = s;
+  805d66:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805d6d:	00 00 00 
+  805d70:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d73:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  805d76:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d7d:	48 89 c6             	mov    %rax,%rsi
+  805d80:	48 b8 c4 4f 01 00 00 	movabs $0x14fc4,%rax
+  805d87:	00 00 00 
+  805d8a:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805d8e:	48 89 c7             	mov    %rax,%rdi
+  805d91:	49 89 df             	mov    %rbx,%r15
+  805d94:	48 b8 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rax
+  805d9b:	ff ff ff 
+  805d9e:	48 01 d8             	add    %rbx,%rax
+  805da1:	ff d0                	call   *%rax
+	nsipcbuf.connect.req_namelen = namelen;
+  805da3:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805daa:	00 00 00 
+  805dad:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805db0:	89 44 13 14          	mov    %eax,0x14(%rbx,%rdx,1)
+	return nsipc(NSREQ_CONNECT);
+  805db4:	bf 05 00 00 00       	mov    $0x5,%edi
+  805db9:	48 b8 ec c9 ff ff ff 	movabs $0xffffffffffffc9ec,%rax
+  805dc0:	ff ff ff 
+  805dc3:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805dc7:	ff d0                	call   *%rax
+}
+  805dc9:	48 83 c4 10          	add    $0x10,%rsp
+  805dcd:	5b                   	pop    %rbx
+  805dce:	41 5f                	pop    %r15
+  805dd0:	5d                   	pop    %rbp
+  805dd1:	c3                   	ret
+
+0000000000805dd2 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  805dd2:	55                   	push   %rbp
+  805dd3:	48 89 e5             	mov    %rsp,%rbp
+  805dd6:	48 83 ec 20          	sub    $0x20,%rsp
+  805dda:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 805dda <nsipc_listen+0x8>
+  805de1:	49 bb 66 32 00 00 00 	movabs $0x3266,%r11
+  805de8:	00 00 00 
+  805deb:	4c 01 d8             	add    %r11,%rax
+  805dee:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805df1:	89 75 e8             	mov    %esi,-0x18(%rbp)
+	struct Nsreq_listen req;
+
+	req.req_s = s;
+  805df4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805df7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+	req.req_backlog = backlog;
+  805dfa:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805dfd:	89 55 fc             	mov    %edx,-0x4(%rbp)
+	return nsipc_words(NSREQ_LISTEN, &req, sizeof(req));
+  805e00:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  805e04:	ba 08 00 00 00       	mov    $0x8,%edx
+  805e09:	48 89 ce             	mov    %rcx,%rsi
+  805e0c:	bf 06 00 00 00       	mov    $0x6,%edi
+  805e11:	48 b9 8f ca ff ff ff 	movabs $0xffffffffffffca8f,%rcx
+  805e18:	ff ff ff 
+  805e1b:	48 8d 04 08          	lea    (%rax,%rcx,1),%rax
+  805e1f:	ff d0                	call   *%rax
+}
+  805e21:	c9                   	leave
+  805e22:	c3                   	ret
+
+0000000000805e23 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  805e23:	55                   	push   %rbp
+  805e24:	48 89 e5             	mov    %rsp,%rbp
+  805e27:	41 57                	push   %r15
+  805e29:	53                   	push   %rbx
+  805e2a:	48 83 ec 30          	sub    $0x30,%rsp
+  805e2e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805e2e <nsipc_recv+0xb>
+  805e35:	49 bb 12 32 00 00 00 	movabs $0x3212,%r11
+  805e3c:	00 00 00 
+  805e3f:	4c 01 db             	add    %r11,%rbx
+  805e42:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805e45:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  805e49:	89 55 d8             	mov    %edx,-0x28(%rbp)
+  805e4c:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  805e4f:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805e56:	00 00 00 
+  805e59:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805e5c:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+	nsipcbuf.recv.req_len = len;
+  805e5f:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805e66:	00 00 00 
+  805e69:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805e6c:	89 44 13 04          	mov    %eax,0x4(%rbx,%rdx,1)
+	nsipcbuf.recv.req_flags = flags;
+  805e70:	48 ba c0 4f 01 00 00 	movabs $0x14fc0,%rdx
+  805e77:	00 00 00 
+  805e7a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805e7d:	89 44 13 08          	mov    %eax,0x8(%rbx,%rdx,1)
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  805e81:	bf 07 00 00 00       	mov    $0x7,%edi
+  805e86:	48 b8 ec c9 ff ff ff 	movabs $0xffffffffffffc9ec,%rax
+  805e8d:	ff ff ff 
+  805e90:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805e94:	ff d0                	call   *%rax
+  805e96:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805e99:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805e9d:	0f 88 91 00 00 00    	js     805f34 <nsipc_recv+0x111>
+		assert(r < 1600 && r <= len);
+  805ea3:	81 7d ec 3f 06 00 00 	cmpl   $0x63f,-0x14(%rbp)
+  805eaa:	7f 08                	jg     805eb4 <nsipc_recv+0x91>
+  805eac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805eaf:	3b 45 d8             	cmp    -0x28(%rbp),%eax
+  805eb2:	7e 50                	jle    805f04 <nsipc_recv+0xe1>
+  805eb4:	48 b8 bb e5 ff ff ff 	movabs $0xffffffffffffe5bb,%rax
+  805ebb:	ff ff ff 
+  805ebe:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ec2:	48 89 c1             	mov    %rax,%rcx
+  805ec5:	48 b8 d0 e5 ff ff ff 	movabs $0xffffffffffffe5d0,%rax
+  805ecc:	ff ff ff 
+  805ecf:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ed3:	48 89 c2             	mov    %rax,%rdx
+  805ed6:	be 79 00 00 00       	mov    $0x79,%esi
+  805edb:	48 b8 e5 e5 ff ff ff 	movabs $0xffffffffffffe5e5,%rax
+  805ee2:	ff ff ff 
+  805ee5:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ee9:	48 89 c7             	mov    %rax,%rdi
+  805eec:	49 89 df             	mov    %rbx,%r15
+  805eef:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ef4:	49 b8 36 75 ff ff ff 	movabs $0xffffffffffff7536,%r8
+  805efb:	ff ff ff 
+  805efe:	49 01 d8             	add    %rbx,%r8
+  805f01:	41 ff d0             	call   *%r8
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  805f04:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f07:	48 63 d0             	movslq %eax,%rdx
+  805f0a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805f0e:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  805f15:	00 00 00 
+  805f18:	48 8d 0c 0b          	lea    (%rbx,%rcx,1),%rcx
+  805f1c:	48 89 ce             	mov    %rcx,%rsi
+  805f1f:	48 89 c7             	mov    %rax,%rdi
+  805f22:	49 89 df             	mov    %rbx,%r15
+  805f25:	48 b8 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rax
+  805f2c:	ff ff ff 
+  805f2f:	48 01 d8             	add    %rbx,%rax
+  805f32:	ff d0                	call   *%rax
+	}
+
+	return r;
+  805f34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  805f37:	48 83 c4 30          	add    $0x30,%rsp
+  805f3b:	5b                   	pop    %rbx
+  805f3c:	41 5f                	pop    %r15
+  805f3e:	5d                   	pop    %rbp
+  805f3f:	c3                   	ret
+
+0000000000805f40 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  805f40:	55                   	push   %rbp
+  805f41:	48 89 e5             	mov    %rsp,%rbp
+  805f44:	41 57                	push   %r15
+  805f46:	53                   	push   %rbx
+  805f47:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  805f4e:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 805f4e <nsipc_send+0xe>
+  805f55:	49 bb f2 30 00 00 00 	movabs $0x30f2,%r11
+  805f5c:	00 00 00 
+  805f5f:	4c 01 db             	add    %r11,%rbx
+  805f62:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  805f68:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  805f6f:	89 95 78 ff ff ff    	mov    %edx,-0x88(%rbp)
+  805f75:	89 8d 6c ff ff ff    	mov    %ecx,-0x94(%rbp)
+	uint64_t words[IPC_NWORDS];
+	struct Nsreq_send *req = (struct Nsreq_send *) words;
+  805f7b:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  805f7f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	struct IpcSeg seg;
+
+	if (nsenv == 0)
+  805f83:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  805f8a:	00 00 00 
+  805f8d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  805f90:	85 c0                	test   %eax,%eax
+  805f92:	75 24                	jne    805fb8 <nsipc_send+0x78>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  805f94:	bf 02 00 00 00       	mov    $0x2,%edi
+  805f99:	49 89 df             	mov    %rbx,%r15
+  805f9c:	48 b8 fd ac ff ff ff 	movabs $0xffffffffffffacfd,%rax
+  805fa3:	ff ff ff 
+  805fa6:	48 01 d8             	add    %rbx,%rax
+  805fa9:	ff d0                	call   *%rax
+  805fab:	48 ba c0 2f 01 00 00 	movabs $0x12fc0,%rdx
+  805fb2:	00 00 00 
+  805fb5:	89 04 13             	mov    %eax,(%rbx,%rdx,1)
+
+	// The request goes in registers, and up to NSSEND_MAXPAGES
+	// pages of bytes with it in one call.
+	size = MIN(size, NSSEND_MAXPAGES * PGSIZE);
+  805fb8:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805fbe:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805fc1:	c7 45 e0 00 00 01 00 	movl   $0x10000,-0x20(%rbp)
+  805fc8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  805fcb:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  805fce:	39 c2                	cmp    %eax,%edx
+  805fd0:	0f 4e c2             	cmovle %edx,%eax
+  805fd3:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+	memmove(sendbuf, buf, size);
+  805fd9:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  805fdf:	48 63 d0             	movslq %eax,%rdx
+  805fe2:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  805fe9:	48 89 c6             	mov    %rax,%rsi
+  805fec:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  805ff3:	00 00 00 
+  805ff6:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  805ffa:	48 89 c7             	mov    %rax,%rdi
+  805ffd:	49 89 df             	mov    %rbx,%r15
+  806000:	48 b8 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rax
+  806007:	ff ff ff 
+  80600a:	48 01 d8             	add    %rbx,%rax
+  80600d:	ff d0                	call   *%rax
+	req->req_s = s;
+  80600f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806013:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  806019:	89 10                	mov    %edx,(%rax)
+	req->req_size = size;
+  80601b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80601f:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  806025:	89 50 04             	mov    %edx,0x4(%rax)
+	req->req_flags = flags;
+  806028:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80602c:	8b 95 6c ff ff ff    	mov    -0x94(%rbp),%edx
+  806032:	89 50 08             	mov    %edx,0x8(%rax)
+	seg.seg_va = (uintptr_t) sendbuf;
+  806035:	48 b8 c0 2f 00 00 00 	movabs $0x2fc0,%rax
+  80603c:	00 00 00 
+  80603f:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806043:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+	seg.seg_npages = ROUNDUP(size, PGSIZE) / PGSIZE;
+  806047:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80604e:	00 
+  80604f:	8b 85 78 ff ff ff    	mov    -0x88(%rbp),%eax
+  806055:	48 63 d0             	movslq %eax,%rdx
+  806058:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80605c:	48 01 d0             	add    %rdx,%rax
+  80605f:	48 83 e8 01          	sub    $0x1,%rax
+  806063:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  806067:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80606b:	ba 00 00 00 00       	mov    $0x0,%edx
+  806070:	48 f7 75 d8          	divq   -0x28(%rbp)
+  806074:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806078:	48 29 d0             	sub    %rdx,%rax
+  80607b:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  806081:	85 c0                	test   %eax,%eax
+  806083:	0f 48 c2             	cmovs  %edx,%eax
+  806086:	c1 f8 0c             	sar    $0xc,%eax
+  806089:	48 98                	cltq
+  80608b:	48 89 45 88          	mov    %rax,-0x78(%rbp)
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+			 &seg, seg.seg_npages ? 1 : 0, PTE_P | PTE_U, NULL, 0);
+  80608f:	48 8b 45 88          	mov    -0x78(%rbp),%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  806093:	48 85 c0             	test   %rax,%rax
+  806096:	0f 95 c0             	setne  %al
+  806099:	0f b6 f0             	movzbl %al,%esi
+			 ROUNDUP(sizeof(*req), sizeof(uint64_t)) / sizeof(uint64_t),
+  80609c:	48 c7 45 c8 08 00 00 	movq   $0x8,-0x38(%rbp)
+  8060a3:	00 
+  8060a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8060a8:	48 83 c0 0b          	add    $0xb,%rax
+  8060ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8060b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8060b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8060b9:	48 f7 75 c8          	divq   -0x38(%rbp)
+  8060bd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8060c1:	48 29 d0             	sub    %rdx,%rax
+  8060c4:	48 c1 e8 03          	shr    $0x3,%rax
+	return ipc_callv(nsenv, NSREQ_SEND, words,
+  8060c8:	89 c7                	mov    %eax,%edi
+  8060ca:	48 b8 c0 2f 01 00 00 	movabs $0x12fc0,%rax
+  8060d1:	00 00 00 
+  8060d4:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  8060d7:	48 8d 4d 80          	lea    -0x80(%rbp),%rcx
+  8060db:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  8060df:	48 83 ec 08          	sub    $0x8,%rsp
+  8060e3:	6a 00                	push   $0x0
+  8060e5:	6a 00                	push   $0x0
+  8060e7:	6a 05                	push   $0x5
+  8060e9:	41 89 f1             	mov    %esi,%r9d
+  8060ec:	49 89 c8             	mov    %rcx,%r8
+  8060ef:	89 f9                	mov    %edi,%ecx
+  8060f1:	be 08 00 00 00       	mov    $0x8,%esi
+  8060f6:	89 c7                	mov    %eax,%edi
+  8060f8:	49 89 df             	mov    %rbx,%r15
+  8060fb:	48 b8 05 a9 ff ff ff 	movabs $0xffffffffffffa905,%rax
+  806102:	ff ff ff 
+  806105:	48 01 d8             	add    %rbx,%rax
+  806108:	ff d0                	call   *%rax
+  80610a:	48 83 c4 20          	add    $0x20,%rsp
+}
+  80610e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  806112:	5b                   	pop    %rbx
+  806113:	41 5f                	pop    %r15
+  806115:	5d                   	pop    %rbp
+  806116:	c3                   	ret
+
+0000000000806117 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  806117:	55                   	push   %rbp
+  806118:	48 89 e5             	mov    %rsp,%rbp
+  80611b:	48 83 ec 10          	sub    $0x10,%rsp
+  80611f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 80611f <nsipc_socket+0x8>
+  806126:	49 bb 21 2f 00 00 00 	movabs $0x2f21,%r11
+  80612d:	00 00 00 
+  806130:	4c 01 d8             	add    %r11,%rax
+  806133:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806136:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  806139:	89 55 f4             	mov    %edx,-0xc(%rbp)
+	nsipcbuf.socket.req_domain = domain;
+  80613c:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  806143:	00 00 00 
+  806146:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  806149:	89 14 08             	mov    %edx,(%rax,%rcx,1)
+	nsipcbuf.socket.req_type = type;
+  80614c:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  806153:	00 00 00 
+  806156:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  806159:	89 54 08 04          	mov    %edx,0x4(%rax,%rcx,1)
+	nsipcbuf.socket.req_protocol = protocol;
+  80615d:	48 b9 c0 4f 01 00 00 	movabs $0x14fc0,%rcx
+  806164:	00 00 00 
+  806167:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80616a:	89 54 08 08          	mov    %edx,0x8(%rax,%rcx,1)
+	return nsipc(NSREQ_SOCKET);
+  80616e:	bf 09 00 00 00       	mov    $0x9,%edi
+  806173:	48 ba ec c9 ff ff ff 	movabs $0xffffffffffffc9ec,%rdx
+  80617a:	ff ff ff 
+  80617d:	48 8d 04 10          	lea    (%rax,%rdx,1),%rax
+  806181:	ff d0                	call   *%rax
+}
+  806183:	c9                   	leave
+  806184:	c3                   	ret
+
+0000000000806185 <pipe>:
+	uint8_t p_buf[PIPEBUFSIZ];	// data buffer
+};
+
+int
+pipe(int pfd[2])
+{
+  806185:	55                   	push   %rbp
+  806186:	48 89 e5             	mov    %rsp,%rbp
+  806189:	41 57                	push   %r15
+  80618b:	53                   	push   %rbx
+  80618c:	48 83 ec 30          	sub    $0x30,%rsp
+  806190:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806190 <pipe+0xb>
+  806197:	49 bb b0 2e 00 00 00 	movabs $0x2eb0,%r11
+  80619e:	00 00 00 
+  8061a1:	4c 01 db             	add    %r11,%rbx
+  8061a4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+	int r;
+	struct Fd *fd0, *fd1;
+	void *va;
+
+	// allocate the file descriptor table entries
+	if ((r = fd_alloc(&fd0)) < 0
+  8061a8:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  8061ac:	48 89 c7             	mov    %rax,%rdi
+  8061af:	49 89 df             	mov    %rbx,%r15
+  8061b2:	48 b8 06 ae ff ff ff 	movabs $0xffffffffffffae06,%rax
+  8061b9:	ff ff ff 
+  8061bc:	48 01 d8             	add    %rbx,%rax
+  8061bf:	ff d0                	call   *%rax
+  8061c1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061c4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061c8:	0f 88 12 02 00 00    	js     8063e0 <pipe+0x25b>
+            || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8061ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8061d2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8061d7:	48 89 c6             	mov    %rax,%rsi
+  8061da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061df:	49 89 df             	mov    %rbx,%r15
+  8061e2:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  8061e9:	ff ff ff 
+  8061ec:	48 01 d8             	add    %rbx,%rax
+  8061ef:	ff d0                	call   *%rax
+  8061f1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8061f4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8061f8:	0f 88 e2 01 00 00    	js     8063e0 <pipe+0x25b>
+		goto err;
+
+	if ((r = fd_alloc(&fd1)) < 0
+  8061fe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  806202:	48 89 c7             	mov    %rax,%rdi
+  806205:	49 89 df             	mov    %rbx,%r15
+  806208:	48 b8 06 ae ff ff ff 	movabs $0xffffffffffffae06,%rax
+  80620f:	ff ff ff 
+  806212:	48 01 d8             	add    %rbx,%rax
+  806215:	ff d0                	call   *%rax
+  806217:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80621a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80621e:	0f 88 9b 01 00 00    	js     8063bf <pipe+0x23a>
+            || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806224:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806228:	ba 07 04 00 00       	mov    $0x407,%edx
+  80622d:	48 89 c6             	mov    %rax,%rsi
+  806230:	bf 00 00 00 00       	mov    $0x0,%edi
+  806235:	49 89 df             	mov    %rbx,%r15
+  806238:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  80623f:	ff ff ff 
+  806242:	48 01 d8             	add    %rbx,%rax
+  806245:	ff d0                	call   *%rax
+  806247:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80624a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80624e:	0f 88 6b 01 00 00    	js     8063bf <pipe+0x23a>
+		goto err1;
+
+	// allocate the pipe structure as first data page in both
+	va = fd2data(fd0);
+  806254:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806258:	48 89 c7             	mov    %rax,%rdi
+  80625b:	49 89 df             	mov    %rbx,%r15
+  80625e:	48 b8 c3 ad ff ff ff 	movabs $0xffffffffffffadc3,%rax
+  806265:	ff ff ff 
+  806268:	48 01 d8             	add    %rbx,%rax
+  80626b:	ff d0                	call   *%rax
+  80626d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  806271:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806275:	ba 07 04 00 00       	mov    $0x407,%edx
+  80627a:	48 89 c6             	mov    %rax,%rsi
+  80627d:	bf 00 00 00 00       	mov    $0x0,%edi
+  806282:	49 89 df             	mov    %rbx,%r15
+  806285:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  80628c:	ff ff ff 
+  80628f:	48 01 d8             	add    %rbx,%rax
+  806292:	ff d0                	call   *%rax
+  806294:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806297:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80629b:	0f 88 fd 00 00 00    	js     80639e <pipe+0x219>
+		goto err2;
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8062a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8062a5:	48 89 c7             	mov    %rax,%rdi
+  8062a8:	49 89 df             	mov    %rbx,%r15
+  8062ab:	48 b8 c3 ad ff ff ff 	movabs $0xffffffffffffadc3,%rax
+  8062b2:	ff ff ff 
+  8062b5:	48 01 d8             	add    %rbx,%rax
+  8062b8:	ff d0                	call   *%rax
+  8062ba:	48 89 c2             	mov    %rax,%rdx
+  8062bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062c1:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8062c7:	48 89 d1             	mov    %rdx,%rcx
+  8062ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8062cf:	48 89 c6             	mov    %rax,%rsi
+  8062d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8062d7:	49 89 df             	mov    %rbx,%r15
+  8062da:	48 b8 f0 92 ff ff ff 	movabs $0xffffffffffff92f0,%rax
+  8062e1:	ff ff ff 
+  8062e4:	48 01 d8             	add    %rbx,%rax
+  8062e7:	ff d0                	call   *%rax
+  8062e9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8062ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8062f0:	0f 88 87 00 00 00    	js     80637d <pipe+0x1f8>
+		goto err3;
+
+	// set up fd structures
+	fd0->fd_dev_id = devpipe.dev_id;
+  8062f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8062fa:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806301:	00 00 00 
+  806304:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806307:	89 10                	mov    %edx,(%rax)
+	fd0->fd_omode = O_RDONLY;
+  806309:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80630d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+	fd1->fd_dev_id = devpipe.dev_id;
+  806314:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806318:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  80631f:	00 00 00 
+  806322:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806325:	89 10                	mov    %edx,(%rax)
+	fd1->fd_omode = O_WRONLY;
+  806327:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80632b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+	if (debug)
+		cprintf("[%08x] pipecreate %08x\n", thisenv->env_id, uvpt[PGNUM(va)]);
+
+	pfd[0] = fd2num(fd0);
+  806332:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806336:	48 89 c7             	mov    %rax,%rdi
+  806339:	49 89 df             	mov    %rbx,%r15
+  80633c:	48 b8 8c ad ff ff ff 	movabs $0xffffffffffffad8c,%rax
+  806343:	ff ff ff 
+  806346:	48 01 d8             	add    %rbx,%rax
+  806349:	ff d0                	call   *%rax
+  80634b:	89 c2                	mov    %eax,%edx
+  80634d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806351:	89 10                	mov    %edx,(%rax)
+	pfd[1] = fd2num(fd1);
+  806353:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806357:	48 89 c7             	mov    %rax,%rdi
+  80635a:	49 89 df             	mov    %rbx,%r15
+  80635d:	48 b8 8c ad ff ff ff 	movabs $0xffffffffffffad8c,%rax
+  806364:	ff ff ff 
+  806367:	48 01 d8             	add    %rbx,%rax
+  80636a:	ff d0                	call   *%rax
+  80636c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  806370:	48 83 c2 04          	add    $0x4,%rdx
+  806374:	89 02                	mov    %eax,(%rdx)
+	return 0;
+  806376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80637b:	eb 67                	jmp    8063e4 <pipe+0x25f>
+		goto err3;
+  80637d:	90                   	nop
+
+err3:
+	sys_page_unmap(0, va);
+  80637e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806382:	48 89 c6             	mov    %rax,%rsi
+  806385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80638a:	49 89 df             	mov    %rbx,%r15
+  80638d:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  806394:	ff ff ff 
+  806397:	48 01 d8             	add    %rbx,%rax
+  80639a:	ff d0                	call   *%rax
+  80639c:	eb 01                	jmp    80639f <pipe+0x21a>
+		goto err2;
+  80639e:	90                   	nop
+err2:
+	sys_page_unmap(0, fd1);
+  80639f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8063a3:	48 89 c6             	mov    %rax,%rsi
+  8063a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8063ab:	49 89 df             	mov    %rbx,%r15
+  8063ae:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  8063b5:	ff ff ff 
+  8063b8:	48 01 d8             	add    %rbx,%rax
+  8063bb:	ff d0                	call   *%rax
+  8063bd:	eb 01                	jmp    8063c0 <pipe+0x23b>
+		goto err1;
+  8063bf:	90                   	nop
+err1:
+	sys_page_unmap(0, fd0);
+  8063c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063c4:	48 89 c6             	mov    %rax,%rsi
+  8063c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8063cc:	49 89 df             	mov    %rbx,%r15
+  8063cf:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  8063d6:	ff ff ff 
+  8063d9:	48 01 d8             	add    %rbx,%rax
+  8063dc:	ff d0                	call   *%rax
+  8063de:	eb 01                	jmp    8063e1 <pipe+0x25c>
+		goto err;
+  8063e0:	90                   	nop
+err:
+	return r;
+  8063e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  8063e4:	48 83 c4 30          	add    $0x30,%rsp
+  8063e8:	5b                   	pop    %rbx
+  8063e9:	41 5f                	pop    %r15
+  8063eb:	5d                   	pop    %rbp
+  8063ec:	c3                   	ret
+
+00000000008063ed <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8063ed:	55                   	push   %rbp
+  8063ee:	48 89 e5             	mov    %rsp,%rbp
+  8063f1:	41 57                	push   %r15
+  8063f3:	41 54                	push   %r12
+  8063f5:	53                   	push   %rbx
+  8063f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8063fa:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8063fa <_pipeisclosed+0xd>
+  806401:	49 bb 46 2c 00 00 00 	movabs $0x2c46,%r11
+  806408:	00 00 00 
+  80640b:	4c 01 db             	add    %r11,%rbx
+  80640e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  806412:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  806416:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  80641d:	ff ff ff 
+  806420:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806424:	48 8b 00             	mov    (%rax),%rax
+  806427:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80642d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+		ret = pageref(fd) == pageref(p);
+  806430:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806434:	48 89 c7             	mov    %rax,%rdi
+  806437:	49 89 df             	mov    %rbx,%r15
+  80643a:	48 b8 17 de ff ff ff 	movabs $0xffffffffffffde17,%rax
+  806441:	ff ff ff 
+  806444:	48 01 d8             	add    %rbx,%rax
+  806447:	ff d0                	call   *%rax
+  806449:	41 89 c4             	mov    %eax,%r12d
+  80644c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806450:	48 89 c7             	mov    %rax,%rdi
+  806453:	49 89 df             	mov    %rbx,%r15
+  806456:	48 b8 17 de ff ff ff 	movabs $0xffffffffffffde17,%rax
+  80645d:	ff ff ff 
+  806460:	48 01 d8             	add    %rbx,%rax
+  806463:	ff d0                	call   *%rax
+  806465:	41 39 c4             	cmp    %eax,%r12d
+  806468:	0f 94 c0             	sete   %al
+  80646b:	0f b6 c0             	movzbl %al,%eax
+  80646e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+		nn = thisenv->env_runs;
+  806471:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  806478:	ff ff ff 
+  80647b:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  80647f:	48 8b 00             	mov    (%rax),%rax
+  806482:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  806488:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+		if (n == nn)
+  80648b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80648e:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  806491:	75 05                	jne    806498 <_pipeisclosed+0xab>
+			return ret;
+  806493:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  806496:	eb 63                	jmp    8064fb <_pipeisclosed+0x10e>
+		if (n != nn && ret == 1)
+  806498:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80649b:	3b 45 d4             	cmp    -0x2c(%rbp),%eax
+  80649e:	0f 84 72 ff ff ff    	je     806416 <_pipeisclosed+0x29>
+  8064a4:	83 7d d8 01          	cmpl   $0x1,-0x28(%rbp)
+  8064a8:	0f 85 68 ff ff ff    	jne    806416 <_pipeisclosed+0x29>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8064ae:	48 b8 e8 ff ff ff ff 	movabs $0xffffffffffffffe8,%rax
+  8064b5:	ff ff ff 
+  8064b8:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  8064bc:	48 8b 00             	mov    (%rax),%rax
+  8064bf:	8b 90 d8 00 00 00    	mov    0xd8(%rax),%edx
+  8064c5:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+  8064c8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8064cb:	89 c6                	mov    %eax,%esi
+  8064cd:	48 b8 f6 e5 ff ff ff 	movabs $0xffffffffffffe5f6,%rax
+  8064d4:	ff ff ff 
+  8064d7:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  8064db:	48 89 c7             	mov    %rax,%rdi
+  8064de:	49 89 df             	mov    %rbx,%r15
+  8064e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064e6:	49 b8 0d 78 ff ff ff 	movabs $0xffffffffffff780d,%r8
+  8064ed:	ff ff ff 
+  8064f0:	49 01 d8             	add    %rbx,%r8
+  8064f3:	41 ff d0             	call   *%r8
+		n = thisenv->env_runs;
+  8064f6:	e9 1b ff ff ff       	jmp    806416 <_pipeisclosed+0x29>
+	}
+}
+  8064fb:	48 83 c4 28          	add    $0x28,%rsp
+  8064ff:	5b                   	pop    %rbx
+  806500:	41 5c                	pop    %r12
+  806502:	41 5f                	pop    %r15
+  806504:	5d                   	pop    %rbp
+  806505:	c3                   	ret
+
+0000000000806506 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum)
+{
+  806506:	55                   	push   %rbp
+  806507:	48 89 e5             	mov    %rsp,%rbp
+  80650a:	41 57                	push   %r15
+  80650c:	53                   	push   %rbx
+  80650d:	48 83 ec 30          	sub    $0x30,%rsp
+  806511:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806511 <pipeisclosed+0xb>
+  806518:	49 bb 2f 2b 00 00 00 	movabs $0x2b2f,%r11
+  80651f:	00 00 00 
+  806522:	4c 01 db             	add    %r11,%rbx
+  806525:	89 7d cc             	mov    %edi,-0x34(%rbp)
+	struct Fd *fd;
+	struct Pipe *p;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806528:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80652c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80652f:	48 89 d6             	mov    %rdx,%rsi
+  806532:	89 c7                	mov    %eax,%edi
+  806534:	49 89 df             	mov    %rbx,%r15
+  806537:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  80653e:	ff ff ff 
+  806541:	48 01 d8             	add    %rbx,%rax
+  806544:	ff d0                	call   *%rax
+  806546:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806549:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80654d:	79 05                	jns    806554 <pipeisclosed+0x4e>
+		return r;
+  80654f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806552:	eb 3b                	jmp    80658f <pipeisclosed+0x89>
+	p = (struct Pipe*) fd2data(fd);
+  806554:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806558:	48 89 c7             	mov    %rax,%rdi
+  80655b:	49 89 df             	mov    %rbx,%r15
+  80655e:	48 b8 c3 ad ff ff ff 	movabs $0xffffffffffffadc3,%rax
+  806565:	ff ff ff 
+  806568:	48 01 d8             	add    %rbx,%rax
+  80656b:	ff d0                	call   *%rax
+  80656d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	return _pipeisclosed(fd, p);
+  806571:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806575:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806579:	48 89 d6             	mov    %rdx,%rsi
+  80657c:	48 89 c7             	mov    %rax,%rdi
+  80657f:	48 b8 ad d3 ff ff ff 	movabs $0xffffffffffffd3ad,%rax
+  806586:	ff ff ff 
+  806589:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  80658d:	ff d0                	call   *%rax
+}
+  80658f:	48 83 c4 30          	add    $0x30,%rsp
+  806593:	5b                   	pop    %rbx
+  806594:	41 5f                	pop    %r15
+  806596:	5d                   	pop    %rbp
+  806597:	c3                   	ret
+
+0000000000806598 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806598:	55                   	push   %rbp
+  806599:	48 89 e5             	mov    %rsp,%rbp
+  80659c:	41 57                	push   %r15
+  80659e:	53                   	push   %rbx
+  80659f:	48 83 ec 40          	sub    $0x40,%rsp
+  8065a3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8065a3 <devpipe_read+0xb>
+  8065aa:	49 bb 9d 2a 00 00 00 	movabs $0x2a9d,%r11
+  8065b1:	00 00 00 
+  8065b4:	4c 01 db             	add    %r11,%rbx
+  8065b7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8065bb:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8065bf:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*)fd2data(fd);
+  8065c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8065c7:	48 89 c7             	mov    %rax,%rdi
+  8065ca:	49 89 df             	mov    %rbx,%r15
+  8065cd:	48 b8 c3 ad ff ff ff 	movabs $0xffffffffffffadc3,%rax
+  8065d4:	ff ff ff 
+  8065d7:	48 01 d8             	add    %rbx,%rax
+  8065da:	ff d0                	call   *%rax
+  8065dc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8065e0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8065e4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8065e8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8065ef:	00 
+  8065f0:	e9 a1 00 00 00       	jmp    806696 <devpipe_read+0xfe>
+		while (p->p_rpos == p->p_wpos) {
+			// pipe is empty
+			// if we got any data, return it
+			if (i > 0)
+  8065f5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8065fa:	74 09                	je     806605 <devpipe_read+0x6d>
+				return i;
+  8065fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806600:	e9 9f 00 00 00       	jmp    8066a4 <devpipe_read+0x10c>
+			// if all the writers are gone, note eof
+			if (_pipeisclosed(fd, p))
+  806605:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806609:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80660d:	48 89 d6             	mov    %rdx,%rsi
+  806610:	48 89 c7             	mov    %rax,%rdi
+  806613:	48 b8 ad d3 ff ff ff 	movabs $0xffffffffffffd3ad,%rax
+  80661a:	ff ff ff 
+  80661d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806621:	ff d0                	call   *%rax
+  806623:	85 c0                	test   %eax,%eax
+  806625:	74 07                	je     80662e <devpipe_read+0x96>
+				return 0;
+  806627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80662c:	eb 76                	jmp    8066a4 <devpipe_read+0x10c>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_read yield\n");
+			sys_yield();
+  80662e:	49 89 df             	mov    %rbx,%r15
+  806631:	48 b8 36 92 ff ff ff 	movabs $0xffffffffffff9236,%rax
+  806638:	ff ff ff 
+  80663b:	48 01 d8             	add    %rbx,%rax
+  80663e:	ff d0                	call   *%rax
+		while (p->p_rpos == p->p_wpos) {
+  806640:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806644:	8b 10                	mov    (%rax),%edx
+  806646:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80664a:	8b 40 04             	mov    0x4(%rax),%eax
+  80664d:	39 c2                	cmp    %eax,%edx
+  80664f:	74 a4                	je     8065f5 <devpipe_read+0x5d>
+		}
+		// there's a byte.  take it.
+		// wait to increment rpos until the byte is taken!
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  806651:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806655:	8b 10                	mov    (%rax),%edx
+  806657:	89 d0                	mov    %edx,%eax
+  806659:	c1 f8 1f             	sar    $0x1f,%eax
+  80665c:	c1 e8 1b             	shr    $0x1b,%eax
+  80665f:	01 c2                	add    %eax,%edx
+  806661:	83 e2 1f             	and    $0x1f,%edx
+  806664:	29 c2                	sub    %eax,%edx
+  806666:	89 d6                	mov    %edx,%esi
+  806668:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80666c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806670:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  806674:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806678:	48 63 c6             	movslq %esi,%rax
+  80667b:	0f b6 44 02 08       	movzbl 0x8(%rdx,%rax,1),%eax
+  806680:	88 01                	mov    %al,(%rcx)
+		p->p_rpos++;
+  806682:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806686:	8b 00                	mov    (%rax),%eax
+  806688:	8d 50 01             	lea    0x1(%rax),%edx
+  80668b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80668f:	89 10                	mov    %edx,(%rax)
+	for (i = 0; i < n; i++) {
+  806691:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  806696:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80669a:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  80669e:	72 a0                	jb     806640 <devpipe_read+0xa8>
+	}
+	return i;
+  8066a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8066a4:	48 83 c4 40          	add    $0x40,%rsp
+  8066a8:	5b                   	pop    %rbx
+  8066a9:	41 5f                	pop    %r15
+  8066ab:	5d                   	pop    %rbp
+  8066ac:	c3                   	ret
+
+00000000008066ad <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  8066ad:	55                   	push   %rbp
+  8066ae:	48 89 e5             	mov    %rsp,%rbp
+  8066b1:	41 57                	push   %r15
+  8066b3:	53                   	push   %rbx
+  8066b4:	48 83 ec 40          	sub    $0x40,%rsp
+  8066b8:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8066b8 <devpipe_write+0xb>
+  8066bf:	49 bb 88 29 00 00 00 	movabs $0x2988,%r11
+  8066c6:	00 00 00 
+  8066c9:	4c 01 db             	add    %r11,%rbx
+  8066cc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8066d0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8066d4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+	const uint8_t *buf;
+	size_t i;
+	struct Pipe *p;
+
+	p = (struct Pipe*) fd2data(fd);
+  8066d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8066dc:	48 89 c7             	mov    %rax,%rdi
+  8066df:	49 89 df             	mov    %rbx,%r15
+  8066e2:	48 b8 c3 ad ff ff ff 	movabs $0xffffffffffffadc3,%rax
+  8066e9:	ff ff ff 
+  8066ec:	48 01 d8             	add    %rbx,%rax
+  8066ef:	ff d0                	call   *%rax
+  8066f1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+	if (debug)
+		cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
+			thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
+
+	buf = vbuf;
+  8066f5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8066f9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+	for (i = 0; i < n; i++) {
+  8066fd:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  806704:	00 
+  806705:	e9 a0 00 00 00       	jmp    8067aa <devpipe_write+0xfd>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+			// pipe is full
+			// if all the readers are gone
+			// (it's only writers like us now),
+			// note eof
+			if (_pipeisclosed(fd, p))
+  80670a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80670e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806712:	48 89 d6             	mov    %rdx,%rsi
+  806715:	48 89 c7             	mov    %rax,%rdi
+  806718:	48 b8 ad d3 ff ff ff 	movabs $0xffffffffffffd3ad,%rax
+  80671f:	ff ff ff 
+  806722:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806726:	ff d0                	call   *%rax
+  806728:	85 c0                	test   %eax,%eax
+  80672a:	74 0a                	je     806736 <devpipe_write+0x89>
+				return 0;
+  80672c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806731:	e9 82 00 00 00       	jmp    8067b8 <devpipe_write+0x10b>
+			// yield and see what happens
+			if (debug)
+				cprintf("devpipe_write yield\n");
+			sys_yield();
+  806736:	49 89 df             	mov    %rbx,%r15
+  806739:	48 b8 36 92 ff ff ff 	movabs $0xffffffffffff9236,%rax
+  806740:	ff ff ff 
+  806743:	48 01 d8             	add    %rbx,%rax
+  806746:	ff d0                	call   *%rax
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  806748:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80674c:	8b 40 04             	mov    0x4(%rax),%eax
+  80674f:	48 63 d0             	movslq %eax,%rdx
+  806752:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806756:	8b 00                	mov    (%rax),%eax
+  806758:	48 98                	cltq
+  80675a:	48 83 c0 20          	add    $0x20,%rax
+  80675e:	48 39 c2             	cmp    %rax,%rdx
+  806761:	73 a7                	jae    80670a <devpipe_write+0x5d>
+		}
+		// there's room for a byte.  store it.
+		// wait to increment wpos until the byte is stored!
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  806763:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806767:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80676b:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80676f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806773:	8b 50 04             	mov    0x4(%rax),%edx
+  806776:	89 d0                	mov    %edx,%eax
+  806778:	c1 f8 1f             	sar    $0x1f,%eax
+  80677b:	c1 e8 1b             	shr    $0x1b,%eax
+  80677e:	01 c2                	add    %eax,%edx
+  806780:	83 e2 1f             	and    $0x1f,%edx
+  806783:	29 c2                	sub    %eax,%edx
+  806785:	89 d0                	mov    %edx,%eax
+  806787:	0f b6 09             	movzbl (%rcx),%ecx
+  80678a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80678e:	48 98                	cltq
+  806790:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+		p->p_wpos++;
+  806794:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806798:	8b 40 04             	mov    0x4(%rax),%eax
+  80679b:	8d 50 01             	lea    0x1(%rax),%edx
+  80679e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8067a2:	89 50 04             	mov    %edx,0x4(%rax)
+	for (i = 0; i < n; i++) {
+  8067a5:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8067aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8067ae:	48 3b 45 b8          	cmp    -0x48(%rbp),%rax
+  8067b2:	72 94                	jb     806748 <devpipe_write+0x9b>
+	}
+
+	return i;
+  8067b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8067b8:	48 83 c4 40          	add    $0x40,%rsp
+  8067bc:	5b                   	pop    %rbx
+  8067bd:	41 5f                	pop    %r15
+  8067bf:	5d                   	pop    %rbp
+  8067c0:	c3                   	ret
+
+00000000008067c1 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8067c1:	55                   	push   %rbp
+  8067c2:	48 89 e5             	mov    %rsp,%rbp
+  8067c5:	41 57                	push   %r15
+  8067c7:	53                   	push   %rbx
+  8067c8:	48 83 ec 20          	sub    $0x20,%rsp
+  8067cc:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8067cc <devpipe_stat+0xb>
+  8067d3:	49 bb 74 28 00 00 00 	movabs $0x2874,%r11
+  8067da:	00 00 00 
+  8067dd:	4c 01 db             	add    %r11,%rbx
+  8067e0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8067e4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8067e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8067ec:	48 89 c7             	mov    %rax,%rdi
+  8067ef:	49 89 df             	mov    %rbx,%r15
+  8067f2:	48 b8 c3 ad ff ff ff 	movabs $0xffffffffffffadc3,%rax
+  8067f9:	ff ff ff 
+  8067fc:	48 01 d8             	add    %rbx,%rax
+  8067ff:	ff d0                	call   *%rax
+  806801:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+	strcpy(stat->st_name, "<pipe>");
+  806805:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806809:	48 ba 09 e6 ff ff ff 	movabs $0xffffffffffffe609,%rdx
+  806810:	ff ff ff 
+  806813:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806817:	48 89 d6             	mov    %rdx,%rsi
+  80681a:	48 89 c7             	mov    %rax,%rdi
+  80681d:	49 89 df             	mov    %rbx,%r15
+  806820:	48 b8 cf 85 ff ff ff 	movabs $0xffffffffffff85cf,%rax
+  806827:	ff ff ff 
+  80682a:	48 01 d8             	add    %rbx,%rax
+  80682d:	ff d0                	call   *%rax
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80682f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806833:	8b 50 04             	mov    0x4(%rax),%edx
+  806836:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80683a:	8b 00                	mov    (%rax),%eax
+  80683c:	29 c2                	sub    %eax,%edx
+  80683e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806842:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+	stat->st_isdir = 0;
+  806848:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80684c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  806853:	00 00 00 
+	stat->st_dev = &devpipe;
+  806856:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80685a:	48 ba c0 00 00 00 00 	movabs $0xc0,%rdx
+  806861:	00 00 00 
+  806864:	48 8d 14 13          	lea    (%rbx,%rdx,1),%rdx
+  806868:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+	return 0;
+  80686f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806874:	48 83 c4 20          	add    $0x20,%rsp
+  806878:	5b                   	pop    %rbx
+  806879:	41 5f                	pop    %r15
+  80687b:	5d                   	pop    %rbp
+  80687c:	c3                   	ret
+
+000000000080687d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80687d:	55                   	push   %rbp
+  80687e:	48 89 e5             	mov    %rsp,%rbp
+  806881:	41 57                	push   %r15
+  806883:	53                   	push   %rbx
+  806884:	48 83 ec 10          	sub    $0x10,%rsp
+  806888:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806888 <devpipe_close+0xb>
+  80688f:	49 bb b8 27 00 00 00 	movabs $0x27b8,%r11
+  806896:	00 00 00 
+  806899:	4c 01 db             	add    %r11,%rbx
+  80689c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	(void) sys_page_unmap(0, fd);
+  8068a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8068a4:	48 89 c6             	mov    %rax,%rsi
+  8068a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8068ac:	49 89 df             	mov    %rbx,%r15
+  8068af:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  8068b6:	ff ff ff 
+  8068b9:	48 01 d8             	add    %rbx,%rax
+  8068bc:	ff d0                	call   *%rax
+	return sys_page_unmap(0, fd2data(fd));
+  8068be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8068c2:	48 89 c7             	mov    %rax,%rdi
+  8068c5:	49 89 df             	mov    %rbx,%r15
+  8068c8:	48 b8 c3 ad ff ff ff 	movabs $0xffffffffffffadc3,%rax
+  8068cf:	ff ff ff 
+  8068d2:	48 01 d8             	add    %rbx,%rax
+  8068d5:	ff d0                	call   *%rax
+  8068d7:	48 89 c6             	mov    %rax,%rsi
+  8068da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8068df:	49 89 df             	mov    %rbx,%r15
+  8068e2:	48 b8 63 93 ff ff ff 	movabs $0xffffffffffff9363,%rax
+  8068e9:	ff ff ff 
+  8068ec:	48 01 d8             	add    %rbx,%rax
+  8068ef:	ff d0                	call   *%rax
+}
+  8068f1:	48 83 c4 10          	add    $0x10,%rsp
+  8068f5:	5b                   	pop    %rbx
+  8068f6:	41 5f                	pop    %r15
+  8068f8:	5d                   	pop    %rbp
+  8068f9:	c3                   	ret
+
+00000000008068fa <cputchar>:
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch)
+{
+  8068fa:	55                   	push   %rbp
+  8068fb:	48 89 e5             	mov    %rsp,%rbp
+  8068fe:	41 57                	push   %r15
+  806900:	48 83 ec 28          	sub    $0x28,%rsp
+  806904:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806904 <cputchar+0xa>
+  80690b:	49 bb 3c 27 00 00 00 	movabs $0x273c,%r11
+  806912:	00 00 00 
+  806915:	4c 01 d8             	add    %r11,%rax
+  806918:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	char c = ch;
+  80691b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80691e:	88 55 ef             	mov    %dl,-0x11(%rbp)
+
+	// Unlike standard Unix's putchar,
+	// the cputchar function _always_ outputs to the system console.
+	sys_cputs(&c, 1);
+  806921:	48 8d 55 ef          	lea    -0x11(%rbp),%rdx
+  806925:	be 01 00 00 00       	mov    $0x1,%esi
+  80692a:	48 89 d7             	mov    %rdx,%rdi
+  80692d:	49 89 c7             	mov    %rax,%r15
+  806930:	48 ba d3 90 ff ff ff 	movabs $0xffffffffffff90d3,%rdx
+  806937:	ff ff ff 
+  80693a:	48 01 c2             	add    %rax,%rdx
+  80693d:	ff d2                	call   *%rdx
+}
+  80693f:	90                   	nop
+  806940:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806944:	c9                   	leave
+  806945:	c3                   	ret
+
+0000000000806946 <getchar>:
+
+int
+getchar(void)
+{
+  806946:	55                   	push   %rbp
+  806947:	48 89 e5             	mov    %rsp,%rbp
+  80694a:	41 57                	push   %r15
+  80694c:	48 83 ec 18          	sub    $0x18,%rsp
+  806950:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806950 <getchar+0xa>
+  806957:	49 bb f0 26 00 00 00 	movabs $0x26f0,%r11
+  80695e:	00 00 00 
+  806961:	4c 01 d8             	add    %r11,%rax
+	int r;
+
+	// JOS does, however, support standard _input_ redirection,
+	// allowing the user to redirect script files to the shell and such.
+	// getchar() reads a character from file descriptor 0.
+	r = read(0, &c, 1);
+  806964:	48 8d 4d eb          	lea    -0x15(%rbp),%rcx
+  806968:	ba 01 00 00 00       	mov    $0x1,%edx
+  80696d:	48 89 ce             	mov    %rcx,%rsi
+  806970:	bf 00 00 00 00       	mov    $0x0,%edi
+  806975:	49 89 c7             	mov    %rax,%r15
+  806978:	48 b9 03 b4 ff ff ff 	movabs $0xffffffffffffb403,%rcx
+  80697f:	ff ff ff 
+  806982:	48 01 c1             	add    %rax,%rcx
+  806985:	ff d1                	call   *%rcx
+  806987:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (r < 0)
+  80698a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80698e:	79 05                	jns    806995 <getchar+0x4f>
+		return r;
+  806990:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806993:	eb 14                	jmp    8069a9 <getchar+0x63>
+	if (r < 1)
+  806995:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806999:	7f 07                	jg     8069a2 <getchar+0x5c>
+		return -E_EOF;
+  80699b:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8069a0:	eb 07                	jmp    8069a9 <getchar+0x63>
+	return c;
+  8069a2:	0f b6 45 eb          	movzbl -0x15(%rbp),%eax
+  8069a6:	0f b6 c0             	movzbl %al,%eax
+}
+  8069a9:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  8069ad:	c9                   	leave
+  8069ae:	c3                   	ret
+
+00000000008069af <iscons>:
+	.dev_stat =	devcons_stat
+};
+
+int
+iscons(int fdnum)
+{
+  8069af:	55                   	push   %rbp
+  8069b0:	48 89 e5             	mov    %rsp,%rbp
+  8069b3:	41 57                	push   %r15
+  8069b5:	53                   	push   %rbx
+  8069b6:	48 83 ec 20          	sub    $0x20,%rsp
+  8069ba:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 8069ba <iscons+0xb>
+  8069c1:	49 bb 86 26 00 00 00 	movabs $0x2686,%r11
+  8069c8:	00 00 00 
+  8069cb:	4c 01 db             	add    %r11,%rbx
+  8069ce:	89 7d dc             	mov    %edi,-0x24(%rbp)
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8069d1:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8069d5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8069d8:	48 89 d6             	mov    %rdx,%rsi
+  8069db:	89 c7                	mov    %eax,%edi
+  8069dd:	49 89 df             	mov    %rbx,%r15
+  8069e0:	48 b8 bc ae ff ff ff 	movabs $0xffffffffffffaebc,%rax
+  8069e7:	ff ff ff 
+  8069ea:	48 01 d8             	add    %rbx,%rax
+  8069ed:	ff d0                	call   *%rax
+  8069ef:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8069f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8069f6:	79 05                	jns    8069fd <iscons+0x4e>
+		return r;
+  8069f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069fb:	eb 1b                	jmp    806a18 <iscons+0x69>
+	return fd->fd_dev_id == devcons.dev_id;
+  8069fd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a01:	8b 10                	mov    (%rax),%edx
+  806a03:	48 b8 00 01 00 00 00 	movabs $0x100,%rax
+  806a0a:	00 00 00 
+  806a0d:	8b 04 03             	mov    (%rbx,%rax,1),%eax
+  806a10:	39 c2                	cmp    %eax,%edx
+  806a12:	0f 94 c0             	sete   %al
+  806a15:	0f b6 c0             	movzbl %al,%eax
+}
+  806a18:	48 83 c4 20          	add    $0x20,%rsp
+  806a1c:	5b                   	pop    %rbx
+  806a1d:	41 5f                	pop    %r15
+  806a1f:	5d                   	pop    %rbp
+  806a20:	c3                   	ret
+
+0000000000806a21 <opencons>:
+
+int
+opencons(void)
+{
+  806a21:	55                   	push   %rbp
+  806a22:	48 89 e5             	mov    %rsp,%rbp
+  806a25:	41 57                	push   %r15
+  806a27:	53                   	push   %rbx
+  806a28:	48 83 ec 10          	sub    $0x10,%rsp
+  806a2c:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806a2c <opencons+0xb>
+  806a33:	49 bb 14 26 00 00 00 	movabs $0x2614,%r11
+  806a3a:	00 00 00 
+  806a3d:	4c 01 db             	add    %r11,%rbx
+	int r;
+	struct Fd* fd;
+
+	if ((r = fd_alloc(&fd)) < 0)
+  806a40:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  806a44:	48 89 c7             	mov    %rax,%rdi
+  806a47:	49 89 df             	mov    %rbx,%r15
+  806a4a:	48 b8 06 ae ff ff ff 	movabs $0xffffffffffffae06,%rax
+  806a51:	ff ff ff 
+  806a54:	48 01 d8             	add    %rbx,%rax
+  806a57:	ff d0                	call   *%rax
+  806a59:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806a5c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a60:	79 05                	jns    806a67 <opencons+0x46>
+		return r;
+  806a62:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a65:	eb 68                	jmp    806acf <opencons+0xae>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  806a67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a6b:	ba 07 04 00 00       	mov    $0x407,%edx
+  806a70:	48 89 c6             	mov    %rax,%rsi
+  806a73:	bf 00 00 00 00       	mov    $0x0,%edi
+  806a78:	49 89 df             	mov    %rbx,%r15
+  806a7b:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  806a82:	ff ff ff 
+  806a85:	48 01 d8             	add    %rbx,%rax
+  806a88:	ff d0                	call   *%rax
+  806a8a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806a8d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806a91:	79 05                	jns    806a98 <opencons+0x77>
+		return r;
+  806a93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806a96:	eb 37                	jmp    806acf <opencons+0xae>
+	fd->fd_dev_id = devcons.dev_id;
+  806a98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a9c:	48 ba 00 01 00 00 00 	movabs $0x100,%rdx
+  806aa3:	00 00 00 
+  806aa6:	8b 14 13             	mov    (%rbx,%rdx,1),%edx
+  806aa9:	89 10                	mov    %edx,(%rax)
+	fd->fd_omode = O_RDWR;
+  806aab:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806aaf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+	return fd2num(fd);
+  806ab6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806aba:	48 89 c7             	mov    %rax,%rdi
+  806abd:	49 89 df             	mov    %rbx,%r15
+  806ac0:	48 b8 8c ad ff ff ff 	movabs $0xffffffffffffad8c,%rax
+  806ac7:	ff ff ff 
+  806aca:	48 01 d8             	add    %rbx,%rax
+  806acd:	ff d0                	call   *%rax
+}
+  806acf:	48 83 c4 10          	add    $0x10,%rsp
+  806ad3:	5b                   	pop    %rbx
+  806ad4:	41 5f                	pop    %r15
+  806ad6:	5d                   	pop    %rbp
+  806ad7:	c3                   	ret
+
+0000000000806ad8 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n)
+{
+  806ad8:	55                   	push   %rbp
+  806ad9:	48 89 e5             	mov    %rsp,%rbp
+  806adc:	41 57                	push   %r15
+  806ade:	53                   	push   %rbx
+  806adf:	48 83 ec 30          	sub    $0x30,%rsp
+  806ae3:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ae3 <devcons_read+0xb>
+  806aea:	49 bb 5d 25 00 00 00 	movabs $0x255d,%r11
+  806af1:	00 00 00 
+  806af4:	4c 01 db             	add    %r11,%rbx
+  806af7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806afb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  806aff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+	int c;
+
+	if (n == 0)
+  806b03:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  806b08:	75 19                	jne    806b23 <devcons_read+0x4b>
+		return 0;
+  806b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b0f:	eb 55                	jmp    806b66 <devcons_read+0x8e>
+
+	while ((c = sys_cgetc()) == 0)
+		sys_yield();
+  806b11:	49 89 df             	mov    %rbx,%r15
+  806b14:	48 b8 36 92 ff ff ff 	movabs $0xffffffffffff9236,%rax
+  806b1b:	ff ff ff 
+  806b1e:	48 01 d8             	add    %rbx,%rax
+  806b21:	ff d0                	call   *%rax
+	while ((c = sys_cgetc()) == 0)
+  806b23:	49 89 df             	mov    %rbx,%r15
+  806b26:	48 b8 32 91 ff ff ff 	movabs $0xffffffffffff9132,%rax
+  806b2d:	ff ff ff 
+  806b30:	48 01 d8             	add    %rbx,%rax
+  806b33:	ff d0                	call   *%rax
+  806b35:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b38:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b3c:	74 d3                	je     806b11 <devcons_read+0x39>
+	if (c < 0)
+  806b3e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806b42:	79 05                	jns    806b49 <devcons_read+0x71>
+		return c;
+  806b44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b47:	eb 1d                	jmp    806b66 <devcons_read+0x8e>
+	if (c == 0x04)	// ctl-d is eof
+  806b49:	83 7d ec 04          	cmpl   $0x4,-0x14(%rbp)
+  806b4d:	75 07                	jne    806b56 <devcons_read+0x7e>
+		return 0;
+  806b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806b54:	eb 10                	jmp    806b66 <devcons_read+0x8e>
+	*(char*)vbuf = c;
+  806b56:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b59:	89 c2                	mov    %eax,%edx
+  806b5b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806b5f:	88 10                	mov    %dl,(%rax)
+	return 1;
+  806b61:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  806b66:	48 83 c4 30          	add    $0x30,%rsp
+  806b6a:	5b                   	pop    %rbx
+  806b6b:	41 5f                	pop    %r15
+  806b6d:	5d                   	pop    %rbp
+  806b6e:	c3                   	ret
+
+0000000000806b6f <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n)
+{
+  806b6f:	55                   	push   %rbp
+  806b70:	48 89 e5             	mov    %rsp,%rbp
+  806b73:	41 57                	push   %r15
+  806b75:	53                   	push   %rbx
+  806b76:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806b7d:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806b7d <devcons_write+0xe>
+  806b84:	49 bb c3 24 00 00 00 	movabs $0x24c3,%r11
+  806b8b:	00 00 00 
+  806b8e:	4c 01 db             	add    %r11,%rbx
+  806b91:	48 89 bd 58 ff ff ff 	mov    %rdi,-0xa8(%rbp)
+  806b98:	48 89 b5 50 ff ff ff 	mov    %rsi,-0xb0(%rbp)
+  806b9f:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+	int tot, m;
+	char buf[128];
+
+	// mistake: have to nul-terminate arg to sys_cputs,
+	// so we have to copy vbuf into buf in chunks and nul-terminate.
+	for (tot = 0; tot < n; tot += m) {
+  806ba6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  806bad:	e9 80 00 00 00       	jmp    806c32 <devcons_write+0xc3>
+		m = n - tot;
+  806bb2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  806bb9:	89 c2                	mov    %eax,%edx
+  806bbb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bbe:	29 c2                	sub    %eax,%edx
+  806bc0:	89 55 e8             	mov    %edx,-0x18(%rbp)
+		if (m > sizeof(buf) - 1)
+  806bc3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806bc6:	83 f8 7f             	cmp    $0x7f,%eax
+  806bc9:	76 07                	jbe    806bd2 <devcons_write+0x63>
+			m = sizeof(buf) - 1;
+  806bcb:	c7 45 e8 7f 00 00 00 	movl   $0x7f,-0x18(%rbp)
+		memmove(buf, (char*)vbuf + tot, m);
+  806bd2:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806bd5:	48 63 d0             	movslq %eax,%rdx
+  806bd8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bdb:	48 63 c8             	movslq %eax,%rcx
+  806bde:	48 8b 85 50 ff ff ff 	mov    -0xb0(%rbp),%rax
+  806be5:	48 01 c1             	add    %rax,%rcx
+  806be8:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806bef:	48 89 ce             	mov    %rcx,%rsi
+  806bf2:	48 89 c7             	mov    %rax,%rdi
+  806bf5:	49 89 df             	mov    %rbx,%r15
+  806bf8:	48 b8 af 89 ff ff ff 	movabs $0xffffffffffff89af,%rax
+  806bff:	ff ff ff 
+  806c02:	48 01 d8             	add    %rbx,%rax
+  806c05:	ff d0                	call   *%rax
+		sys_cputs(buf, m);
+  806c07:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806c0a:	48 63 d0             	movslq %eax,%rdx
+  806c0d:	48 8d 85 60 ff ff ff 	lea    -0xa0(%rbp),%rax
+  806c14:	48 89 d6             	mov    %rdx,%rsi
+  806c17:	48 89 c7             	mov    %rax,%rdi
+  806c1a:	49 89 df             	mov    %rbx,%r15
+  806c1d:	48 b8 d3 90 ff ff ff 	movabs $0xffffffffffff90d3,%rax
+  806c24:	ff ff ff 
+  806c27:	48 01 d8             	add    %rbx,%rax
+  806c2a:	ff d0                	call   *%rax
+	for (tot = 0; tot < n; tot += m) {
+  806c2c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  806c2f:	01 45 ec             	add    %eax,-0x14(%rbp)
+  806c32:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806c35:	48 98                	cltq
+  806c37:	48 3b 85 48 ff ff ff 	cmp    -0xb8(%rbp),%rax
+  806c3e:	0f 82 6e ff ff ff    	jb     806bb2 <devcons_write+0x43>
+	}
+	return tot;
+  806c44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  806c47:	48 81 c4 b0 00 00 00 	add    $0xb0,%rsp
+  806c4e:	5b                   	pop    %rbx
+  806c4f:	41 5f                	pop    %r15
+  806c51:	5d                   	pop    %rbp
+  806c52:	c3                   	ret
+
+0000000000806c53 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd)
+{
+  806c53:	55                   	push   %rbp
+  806c54:	48 89 e5             	mov    %rsp,%rbp
+  806c57:	48 83 ec 08          	sub    $0x8,%rsp
+  806c5b:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806c5b <devcons_close+0x8>
+  806c62:	49 bb e5 23 00 00 00 	movabs $0x23e5,%r11
+  806c69:	00 00 00 
+  806c6c:	4c 01 d8             	add    %r11,%rax
+  806c6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+	USED(fd);
+
+	return 0;
+  806c73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806c78:	c9                   	leave
+  806c79:	c3                   	ret
+
+0000000000806c7a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  806c7a:	55                   	push   %rbp
+  806c7b:	48 89 e5             	mov    %rsp,%rbp
+  806c7e:	41 57                	push   %r15
+  806c80:	48 83 ec 18          	sub    $0x18,%rsp
+  806c84:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806c84 <devcons_stat+0xa>
+  806c8b:	49 bb bc 23 00 00 00 	movabs $0x23bc,%r11
+  806c92:	00 00 00 
+  806c95:	4c 01 d8             	add    %r11,%rax
+  806c98:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806c9c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+	strcpy(stat->st_name, "<cons>");
+  806ca0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806ca4:	48 b9 15 e6 ff ff ff 	movabs $0xffffffffffffe615,%rcx
+  806cab:	ff ff ff 
+  806cae:	48 8d 0c 08          	lea    (%rax,%rcx,1),%rcx
+  806cb2:	48 89 ce             	mov    %rcx,%rsi
+  806cb5:	48 89 d7             	mov    %rdx,%rdi
+  806cb8:	49 89 c7             	mov    %rax,%r15
+  806cbb:	48 ba cf 85 ff ff ff 	movabs $0xffffffffffff85cf,%rdx
+  806cc2:	ff ff ff 
+  806cc5:	48 01 c2             	add    %rax,%rdx
+  806cc8:	ff d2                	call   *%rdx
+	return 0;
+  806cca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806ccf:	4c 8b 7d f8          	mov    -0x8(%rbp),%r15
+  806cd3:	c9                   	leave
+  806cd4:	c3                   	ret
+
+0000000000806cd5 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  806cd5:	55                   	push   %rbp
+  806cd6:	48 89 e5             	mov    %rsp,%rbp
+  806cd9:	41 57                	push   %r15
+  806cdb:	53                   	push   %rbx
+  806cdc:	48 83 ec 20          	sub    $0x20,%rsp
+  806ce0:	48 8d 1d f9 ff ff ff 	lea    -0x7(%rip),%rbx        # 806ce0 <set_pgfault_handler+0xb>
+  806ce7:	49 bb 60 23 00 00 00 	movabs $0x2360,%r11
+  806cee:	00 00 00 
+  806cf1:	4c 01 db             	add    %r11,%rbx
+  806cf4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+	int r;
+
+	envid_t envid = sys_getenvid();
+  806cf8:	49 89 df             	mov    %rbx,%r15
+  806cfb:	48 b8 e2 91 ff ff ff 	movabs $0xffffffffffff91e2,%rax
+  806d02:	ff ff ff 
+  806d05:	48 01 d8             	add    %rbx,%rax
+  806d08:	ff d0                	call   *%rax
+  806d0a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+	if (_pgfault_handler == 0) {
+  806d0d:	48 b8 c0 5f 01 00 00 	movabs $0x15fc0,%rax
+  806d14:	00 00 00 
+  806d17:	48 8b 04 03          	mov    (%rbx,%rax,1),%rax
+  806d1b:	48 85 c0             	test   %rax,%rax
+  806d1e:	75 6b                	jne    806d8b <set_pgfault_handler+0xb6>
+		// First time through!
+		// LAB 4: Your code here.
+		int result = sys_page_alloc(envid,(void*)(UXSTACKTOP - PGSIZE),PTE_U | PTE_P | PTE_W);
+  806d20:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806d23:	ba 07 00 00 00       	mov    $0x7,%edx
+  806d28:	b9 00 f0 7f ef       	mov    $0xef7ff000,%ecx
+  806d2d:	48 89 ce             	mov    %rcx,%rsi
+  806d30:	89 c7                	mov    %eax,%edi
+  806d32:	49 89 df             	mov    %rbx,%r15
+  806d35:	48 b8 8b 92 ff ff ff 	movabs $0xffffffffffff928b,%rax
+  806d3c:	ff ff ff 
+  806d3f:	48 01 d8             	add    %rbx,%rax
+  806d42:	ff d0                	call   *%rax
+  806d44:	89 45 e8             	mov    %eax,-0x18(%rbp)
+		if (result){
+  806d47:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  806d4b:	74 3e                	je     806d8b <set_pgfault_handler+0xb6>
+			panic("sys_page_alloc failed in set_pgfault_handler\n");
+  806d4d:	48 b8 20 e6 ff ff ff 	movabs $0xffffffffffffe620,%rax
+  806d54:	ff ff ff 
+  806d57:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806d5b:	48 89 c2             	mov    %rax,%rdx
+  806d5e:	be 23 00 00 00       	mov    $0x23,%esi
+  806d63:	48 b8 4e e6 ff ff ff 	movabs $0xffffffffffffe64e,%rax
+  806d6a:	ff ff ff 
+  806d6d:	48 8d 04 03          	lea    (%rbx,%rax,1),%rax
+  806d71:	48 89 c7             	mov    %rax,%rdi
+  806d74:	49 89 df             	mov    %rbx,%r15
+  806d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d7c:	48 b9 36 75 ff ff ff 	movabs $0xffffffffffff7536,%rcx
+  806d83:	ff ff ff 
+  806d86:	48 01 d9             	add    %rbx,%rcx
+  806d89:	ff d1                	call   *%rcx
+		}
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  806d8b:	48 ba c0 5f 01 00 00 	movabs $0x15fc0,%rdx
+  806d92:	00 00 00 
+  806d95:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806d99:	48 89 04 13          	mov    %rax,(%rbx,%rdx,1)
+	sys_env_set_pgfault_upcall(envid,_pgfault_upcall);
+  806d9d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806da0:	48 ba c8 ff ff ff ff 	movabs $0xffffffffffffffc8,%rdx
+  806da7:	ff ff ff 
+  806daa:	48 8b 14 13          	mov    (%rbx,%rdx,1),%rdx
+  806dae:	48 89 d6             	mov    %rdx,%rsi
+  806db1:	89 c7                	mov    %eax,%edi
+  806db3:	49 89 df             	mov    %rbx,%r15
+  806db6:	48 b8 81 94 ff ff ff 	movabs $0xffffffffffff9481,%rax
+  806dbd:	ff ff ff 
+  806dc0:	48 01 d8             	add    %rbx,%rax
+  806dc3:	ff d0                	call   *%rax
+}
+  806dc5:	90                   	nop
+  806dc6:	48 83 c4 20          	add    $0x20,%rsp
+  806dca:	5b                   	pop    %rbx
+  806dcb:	41 5f                	pop    %r15
+  806dcd:	5d                   	pop    %rbp
+  806dce:	c3                   	ret
+
+0000000000806dcf <_pgfault_upcall>:
+.globl _pgfault_upcall
+_pgfault_upcall:
+// Call the C page fault handler.
+// function argument: pointer to UTF
+
+movq  %rsp,%rdi                // passing the function argument in rdi
+  806dcf:	48 89 e7             	mov    %rsp,%rdi
+movabs _pgfault_handler, %rax
+  806dd2:	48 a1 00 f0 81 00 00 	movabs 0x81f000,%rax
+  806dd9:	00 00 00 
+call *%rax
+  806ddc:	ff d0                	call   *%rax
+
+    // Return to re-execute the instruction that faulted.
+    // LAB 4: Your code here.
+
+	//moving past tf_err and fault_va
+	popq %rax;
+  806dde:	58                   	pop    %rax
+	popq %rax;
+  806ddf:	58                   	pop    %rax
+
+	//regs are (15 * 8) = 120 bytes, eflags is 8, rip is 8, rsp is 8.
+	add $136,	%rsp; 	// rsp is pointing to tf_rsp
+  806de0:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+	mov (%rsp),	%r15;	// tf_rsp is moved into r15
+  806de7:	4c 8b 3c 24          	mov    (%rsp),%r15
+	sub $8,		%r15;	// subtract a word from tf_rsp, so that it is correct once we ret
+  806deb:	49 83 ef 08          	sub    $0x8,%r15
+	mov %r15,	(%rsp);	// move the updated tf_rsp back into tf_rsp
+  806def:	4c 89 3c 24          	mov    %r15,(%rsp)
+	sub $16,	%rsp;	// rsp is pointing to tf_rip
+  806df3:	48 83 ec 10          	sub    $0x10,%rsp
+	mov (%rsp),	%r14;	// mov tf_rip onto into r14
+  806df7:	4c 8b 34 24          	mov    (%rsp),%r14
+	mov %r14,	(%r15);	// mov tf_rip onto the top of the traptime stack.
+  806dfb:	4d 89 37             	mov    %r14,(%r15)
+
+	sub $120,	%rsp;	//rsp is now pointing to rax in user trapframe.
+  806dfe:	48 83 ec 78          	sub    $0x78,%rsp
+	
+	POPA_;			//after this, rsp is now pointing to rip again.
+  806e02:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806e06:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806e0b:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806e10:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806e15:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806e1a:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806e1f:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806e24:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806e29:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806e2e:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806e33:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806e38:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806e3d:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806e42:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806e47:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806e4c:	48 83 c4 78          	add    $0x78,%rsp
+
+	add $8,		%rsp;	//go past rip, to eflags
+  806e50:	48 83 c4 08          	add    $0x8,%rsp
+	popfq;			//pop into eflags
+  806e54:	9d                   	popf
+	popq 		%rsp;	//now rsp is pointing to tf_rsp, which we pop into rsp
+  806e55:	5c                   	pop    %rsp
+	ret;			//return
+  806e56:	c3                   	ret
+
+0000000000806e57 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  806e57:	55                   	push   %rbp
+  806e58:	48 89 e5             	mov    %rsp,%rbp
+  806e5b:	48 83 ec 18          	sub    $0x18,%rsp
+  806e5f:	48 8d 05 f9 ff ff ff 	lea    -0x7(%rip),%rax        # 806e5f <pageref+0x8>
+  806e66:	49 bb e1 21 00 00 00 	movabs $0x21e1,%r11
+  806e6d:	00 00 00 
+  806e70:	4c 01 d8             	add    %r11,%rax
+  806e73:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+	pte_t pte;
+
+	if (!(uvpd[VPD(v)] & PTE_P))
+  806e77:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806e7b:	48 89 d1             	mov    %rdx,%rcx
+  806e7e:	48 c1 e9 15          	shr    $0x15,%rcx
+  806e82:	48 ba d8 ff ff ff ff 	movabs $0xffffffffffffffd8,%rdx
+  806e89:	ff ff ff 
+  806e8c:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806e90:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806e94:	83 e2 01             	and    $0x1,%edx
+  806e97:	48 85 d2             	test   %rdx,%rdx
+  806e9a:	75 07                	jne    806ea3 <pageref+0x4c>
+		return 0;
+  806e9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ea1:	eb 64                	jmp    806f07 <pageref+0xb0>
+	pte = uvpt[PGNUM(v)];
+  806ea3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806ea7:	48 89 d1             	mov    %rdx,%rcx
+  806eaa:	48 c1 e9 0c          	shr    $0xc,%rcx
+  806eae:	48 ba d0 ff ff ff ff 	movabs $0xffffffffffffffd0,%rdx
+  806eb5:	ff ff ff 
+  806eb8:	48 8b 14 10          	mov    (%rax,%rdx,1),%rdx
+  806ebc:	48 8b 14 ca          	mov    (%rdx,%rcx,8),%rdx
+  806ec0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+	if (!(pte & PTE_P))
+  806ec4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806ec8:	83 e2 01             	and    $0x1,%edx
+  806ecb:	48 85 d2             	test   %rdx,%rdx
+  806ece:	75 07                	jne    806ed7 <pageref+0x80>
+		return 0;
+  806ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ed5:	eb 30                	jmp    806f07 <pageref+0xb0>
+	return pages[PPN(pte)].pp_ref;
+  806ed7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806edb:	48 c1 ea 0c          	shr    $0xc,%rdx
+  806edf:	48 b9 f8 ff ff ff ff 	movabs $0xfffffffffffffff8,%rcx
+  806ee6:	ff ff ff 
+  806ee9:	48 8b 0c 08          	mov    (%rax,%rcx,1),%rcx
+  806eed:	48 89 d0             	mov    %rdx,%rax
+  806ef0:	48 01 c0             	add    %rax,%rax
+  806ef3:	48 01 d0             	add    %rdx,%rax
+  806ef6:	48 c1 e0 03          	shl    $0x3,%rax
+  806efa:	48 01 c8             	add    %rcx,%rax
+  806efd:	48 83 c0 08          	add    $0x8,%rax
+  806f01:	0f b7 00             	movzwl (%rax),%eax
+  806f04:	0f b7 c0             	movzwl %ax,%eax
+}
+  806f07:	c9                   	leave
+  806f08:	c3                   	ret